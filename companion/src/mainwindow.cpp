@@ -43,6 +43,7 @@
 #include "translations.h"
 
 #include "dialogs/filesyncdialog.h"
+#include "nativebitmap.h"
 #include "profilechooser.h"
 #include "constants.h"
 #include "updates/updates.h"
@@ -510,6 +511,24 @@ void MainWindow::sdsync(bool postUpdate)
   });
 }
 
+void MainWindow::convertImages()
+{
+  QString path = QFileDialog::getExistingDirectory(this, tr("Select the SD card folder to convert"), g.profile[g.id()].sdPath());
+  if (path.isEmpty())
+    return;
+
+  QStringList errors;
+  QApplication::setOverrideCursor(Qt::WaitCursor);
+  int count = NativeBitmap::convertFolder(path, false, errors);
+  QApplication::restoreOverrideCursor();
+
+  QString msg = tr("%1 image(s) converted.").arg(count);
+  if (errors.isEmpty())
+    QMessageBox::information(this, CPN_STR_APP_NAME, msg);
+  else
+    QMessageBox::warning(this, CPN_STR_APP_NAME, msg + "\n\n" + errors.join('\n'));
+}
+
 void MainWindow::changelog()
 {
   QString link = "https://github.com/EdgeTX/edgetx/releases";
@@ -837,6 +856,7 @@ void MainWindow::retranslateUi(bool showMsg)
   trAct(updatesAct,         tr("Update components..."),   tr("Download and update EdgeTX components and supporting resources"));
   trAct(sdsyncAct,          tr("Synchronize SD card..."), tr("SD card synchronization"));
   trAct(logsAct,            tr("View Log File..."),       tr("Open and view log file"));
+  trAct(convertImagesAct,   tr("Convert SD card images..."), tr("Pre-convert the images of a SD card folder for faster loading on color radios"));
 
   trAct(profilesMenuAct,    tr("Radio Profiles"),                  tr("Create or Select Radio Profiles"));
   trAct(createProfileAct,   tr("Add Radio Profile"),               tr("Create a new Radio Settings Profile"));
@@ -908,6 +928,7 @@ void MainWindow::createActions()
   copyProfileAct   =       addAct("copy.png",               SLOT(copyProfile()));
   deleteProfileAct =       addAct("clear.png",              SLOT(deleteCurrentProfile()));
   sdsyncAct =              addAct("sdsync.png",             SLOT(sdsync()));
+  convertImagesAct =       addAct("paintbrush.png",         SLOT(convertImages()));
   logsAct =                addAct("logs.png",               SLOT(logFile()),          tr("Ctrl+Alt+L"));
 
   burnListAct =            addAct("list.png",               SLOT(burnList()));
@@ -1016,6 +1037,7 @@ void MainWindow::createMenus()
   toolsMenu = menuBar()->addMenu("");
   toolsMenu->addAction(updatesAct);
   toolsMenu->addAction(sdsyncAct);
+  toolsMenu->addAction(convertImagesAct);
   toolsMenu->addAction(logsAct);
   toolsMenu->addSeparator();
 
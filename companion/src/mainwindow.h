@@ -97,6 +97,7 @@ class MainWindow : public QMainWindow
     void burnConfig();
     void burnList();
     void sdsync(bool postUpdate = false);
+    void convertImages();
     void changelog();
     void customizeSplash();
     void about();
@@ -204,6 +205,7 @@ class MainWindow : public QMainWindow
     QAction *updatesAct;
     QAction *manualChkForUpdAct;
     QAction *sdsyncAct;
+    QAction *convertImagesAct;
     QAction *changelogAct;
     QAction *compareAct;
     QAction *editSplashAct;
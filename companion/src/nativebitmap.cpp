@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "nativebitmap.h"
+
+#include <QDataStream>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+
+#define EBM_EXT       ".ebm"
+#define EBM_MAGIC     0x314D4245  // "EBM1"
+#define EBM_RGB565    0
+#define EBM_ARGB4444  1
+
+// only some transparent pixel needs ARGB4444: opaque images keep the
+// RGB565 precision, whether or not they have an alpha channel
+static bool hasTransparentPixels(const QImage & image)
+{
+  for (int y = 0; y < image.height(); y++) {
+    const QRgb * line = (const QRgb *)image.constScanLine(y);
+    for (int x = 0; x < image.width(); x++) {
+      if (qAlpha(line[x]) != 0xFF)
+        return true;
+    }
+  }
+  return false;
+}
+
+QByteArray NativeBitmap::encode(const QImage & image)
+{
+  const QImage src = image.convertToFormat(QImage::Format_ARGB32);
+  const bool alpha = image.hasAlphaChannel() && hasTransparentPixels(src);
+
+  QByteArray result;
+  QDataStream out(&result, QIODevice::WriteOnly);
+  out.setByteOrder(QDataStream::LittleEndian);
+
+  out << (quint32)EBM_MAGIC;
+  out << (quint8)(alpha ? EBM_ARGB4444 : EBM_RGB565);
+  out << (quint8)0;   // flags: not compressed
+  out << (quint16)0;  // reserved
+  out << (quint16)src.width() << (quint16)src.height();
+  out << (quint32)(src.width() * src.height() * 2);
+
+  for (int y = 0; y < src.height(); y++) {
+    const QRgb * line = (const QRgb *)src.constScanLine(y);
+    for (int x = 0; x < src.width(); x++) {
+      const int r = qRed(line[x]), g = qGreen(line[x]), b = qBlue(line[x]);
+      if (alpha)
+        out << (quint16)(((qAlpha(line[x]) & 0xF0) << 8) + ((r & 0xF0) << 4) + (g & 0xF0) + (b >> 4));
+      else
+        out << (quint16)(((r & 0xF8) << 8) + ((g & 0xFC) << 3) + (b >> 3));
+    }
+  }
+
+  return result;
+}
+
+bool NativeBitmap::convertFile(const QString & path, bool force, QString & error)
+{
+  const QFileInfo source(path);
+  const QFileInfo target(source.dir().filePath(source.completeBaseName() + EBM_EXT));
+
+  if (!force && target.exists() && target.lastModified() >= source.lastModified())
+    return false;
+
+  QImage image(path);
+  if (image.isNull()) {
+    error = QObject::tr("%1: unable to read the image").arg(path);
+    return false;
+  }
+
+  QFile file(target.filePath());
+  if (!file.open(QIODevice::WriteOnly) || file.write(encode(image)) < 0) {
+    error = QObject::tr("%1: %2").arg(target.filePath()).arg(file.errorString());
+    return false;
+  }
+
+  return true;
+}
+
+int NativeBitmap::convertFolder(const QString & path, bool force, QStringList & errors)
+{
+  int count = 0;
+  QDirIterator it(path, QStringList() << "*.png" << "*.jpg" << "*.jpeg" << "*.bmp", QDir::Files, QDirIterator::Subdirectories);
+
+  while (it.hasNext()) {
+    QString error;
+    if (convertFile(it.next(), force, error))
+      count++;
+    else if (!error.isEmpty())
+      errors << error;
+  }
+
+  return count;
+}
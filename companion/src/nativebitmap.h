@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#pragma once
+
+#include <QImage>
+#include <QString>
+#include <QStringList>
+
+// Pre-converted bitmaps (".ebm") for the color radios: the pixels are
+// stored in the radio format so that they are loaded without decoding.
+// The file format is described in radio/src/gui/colorlcd/libui/bitmapbuffer.h
+namespace NativeBitmap
+{
+  QByteArray encode(const QImage & image);
+
+  // writes "image.ebm" next to "image.png", unless already up to date
+  bool convertFile(const QString & path, bool force, QString & error);
+
+  // converts all the images found in a folder and its sub-folders,
+  // returns the number of converted images
+  int convertFolder(const QString & path, bool force, QStringList & errors);
+}
@@ -39,6 +39,7 @@ RadioOutputsWidget::RadioOutputsWidget(SimulatorInterface * simulator, Firmware
   m_simulator(simulator),
   m_firmware(firmware),
   m_radioProfileId(g.sessionId()),
+  m_outputsValid(false),
   ui(new Ui::RadioOutputsWidget)
 {
   ui->setupUi(this);
@@ -49,11 +50,7 @@ RadioOutputsWidget::RadioOutputsWidget(SimulatorInterface * simulator, Firmware
   connect(ui->channelsScroll->horizontalScrollBar(), &QScrollBar::sliderMoved, ui->mixersScroll->horizontalScrollBar(), &QScrollBar::setValue);
   connect(ui->mixersScroll->horizontalScrollBar(), &QScrollBar::sliderMoved, ui->channelsScroll->horizontalScrollBar(), &QScrollBar::setValue);
 
-  connect(m_simulator, &SimulatorInterface::channelOutValueChange, this, &RadioOutputsWidget::onChannelOutValueChange);
-  connect(m_simulator, &SimulatorInterface::channelMixValueChange, this, &RadioOutputsWidget::onChannelMixValueChange);
-  connect(m_simulator, &SimulatorInterface::virtualSwValueChange, this, &RadioOutputsWidget::onVirtSwValueChange);
-  connect(m_simulator, &SimulatorInterface::gVarValueChange, this, &RadioOutputsWidget::onGVarValueChange);
-  connect(m_simulator, &SimulatorInterface::phaseChanged, this, &RadioOutputsWidget::onPhaseChanged);
+  connect(m_simulator, &SimulatorInterface::outputsChanged, this, &RadioOutputsWidget::onOutputsChanged);
 }
 
 RadioOutputsWidget::~RadioOutputsWidget()
@@ -81,6 +78,8 @@ void RadioOutputsWidget::start()
   setupChannelsDisplay(true);
   setupGVarsDisplay();
   setupLsDisplay();
+  // widgets were re-created, next snapshot must refresh all of them
+  m_outputsValid = false;
 }
 
 //void RadioOutputsWidget::stop()
@@ -305,6 +304,50 @@ QWidget * RadioOutputsWidget::createLogicalSwitch(QWidget * parent, int switchNo
   return swtch;
 }
 
+void RadioOutputsWidget::onOutputsChanged()
+{
+  // The snapshot read here may be newer than the one this signal was emitted
+  // for (queued signals): every group is compared with the last shown
+  // snapshot, only the changed labels/sliders are updated.
+
+  SimulatorInterface::TxOutputs outputs;
+  m_simulator->getOutputs(outputs);
+
+  const bool all = !m_outputsValid;
+  const int chansLimit = 512 * 2;
+
+  bool limitChanged = outputs.chansLimit != m_outputs.chansLimit;
+  for (int i = 0; i < CPN_MAX_CHNOUT; i++) {
+    if (all || limitChanged || outputs.chans[i] != m_outputs.chans[i])
+      onChannelOutValueChange(i, outputs.chans[i], outputs.chansLimit);
+  }
+
+  for (int i = 0; i < CPN_MAX_CHNOUT; i++) {
+    if (all || outputs.ex_chans[i] != m_outputs.ex_chans[i])
+      onChannelMixValueChange(i, outputs.ex_chans[i], chansLimit * 2);
+  }
+
+  for (int i = 0; i < CPN_MAX_LOGICAL_SWITCHES; i++) {
+    if (all || outputs.vsw[i] != m_outputs.vsw[i])
+      onVirtSwValueChange(i, outputs.vsw[i]);
+  }
+
+  for (int fm = 0; fm < CPN_MAX_FLIGHT_MODES; fm++) {
+    for (int gv = 0; gv < CPN_MAX_GVARS; gv++) {
+      if (SimulatorInterface::gVarMode_t(outputs.gvars[fm][gv]).mode != fm)
+        continue;  // slot not provided by this firmware
+      if (all || outputs.gvars[fm][gv] != m_outputs.gvars[fm][gv])
+        onGVarValueChange(gv, outputs.gvars[fm][gv]);
+    }
+  }
+
+  if (all || outputs.phase != m_outputs.phase)
+    onPhaseChanged(outputs.phase, QString());
+
+  m_outputs = outputs;
+  m_outputsValid = true;
+}
+
 void RadioOutputsWidget::onChannelOutValueChange(quint8 index, qint32 value, qint32 limit)
 {
   if (m_channelsMap.contains(index)) {
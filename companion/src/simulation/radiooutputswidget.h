@@ -56,6 +56,7 @@ class RadioOutputsWidget : public QWidget
   protected slots:
     void saveState();
     void restoreState();
+    void onOutputsChanged();
     void onChannelOutValueChange(quint8 index, qint32 value, qint32 limit);
     void onChannelMixValueChange(quint8 index, qint32 value, qint32 limit);
     void onVirtSwValueChange(quint8 index, qint32 value);
@@ -80,6 +81,9 @@ class RadioOutputsWidget : public QWidget
     int m_radioProfileId;
     int m_dataUpdateFreq;
 
+    SimulatorInterface::TxOutputs m_outputs;  // last snapshot shown
+    bool m_outputsValid;
+
     const static quint16 m_savedViewStateVersion;
 
   private:
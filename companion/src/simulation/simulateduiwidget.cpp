@@ -34,10 +34,6 @@
 constexpr int BUTTON_WIDTH  {65};
 constexpr int BUTTON_HEIGHT {30};
 
-//#define FLASH_DURATION 10
-//#define CBEEP_ON      "QLabel { background-color: #FF364E }"
-//#define CBEEP_OFF     "QLabel { }"
-
 SimulatedUIWidget::SimulatedUIWidget(SimulatorInterface * simulator, QWidget * parent) :
   QWidget(parent),
   m_simulator(simulator),
@@ -48,9 +44,7 @@ SimulatedUIWidget::SimulatedUIWidget(SimulatorInterface * simulator, QWidget * p
   m_mouseMidClickAction(nullptr),
   m_screenshotAction(nullptr),
   m_board(getCurrentBoard()),
-  m_backLight(0),
-  m_beepShow(0),
-  m_beepVal(0)
+  m_backLight(0)
 {
   m_screenshotAction = new RadioUiAction(-1, Qt::Key_Print);
   connect(m_screenshotAction, static_cast<void (RadioUiAction::*)(void)>(&RadioUiAction::pushed), this, &SimulatedUIWidget::captureScreenshot);
@@ -115,34 +109,14 @@ QPolygon SimulatedUIWidget::polyArc(int ctrX, int ctrY, int radius, int startAng
   return polygon;
 }
 
-/*  TODO : beep indicator
-void SimulatedUIWidget::updateUi()
-{
-  //static quint32 loop = 0;
-      if (!(loop % 5)) {
-        TxOutputs outputs;
-        simulator->getValues(outputs);
-        if (outputs.beep) {
-          beepVal = outputs.beep;
-        }
-        if (beepVal) {
-          beepShow = 20;
-          beepVal = 0;
-          QApplication::beep();
-        } else if (beepShow) {
-          beepShow--;
-        }
-        ui->label_beep->setStyleSheet(beepShow ? CBEEP_ON : CBEEP_OFF);
-      }
-} */
-
 void SimulatedUIWidget::onLcdChange(bool backlightEnable)
 {
   if (!m_lcd || !m_lcd->isVisible())
     return;
 
-  uint8_t* lcdBuf = m_simulator->getLcd();
-  m_lcd->onLcdChanged(lcdBuf, backlightEnable);
+  QVector<QRect> dirtyRects;
+  uint8_t* lcdBuf = m_simulator->getLcd(dirtyRects);
+  m_lcd->onLcdChanged(lcdBuf, backlightEnable, dirtyRects);
   m_simulator->lcdFlushed();
 
   setLightOn(backlightEnable);
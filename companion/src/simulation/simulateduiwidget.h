@@ -147,8 +147,6 @@ class SimulatedUIWidget : public QWidget
     RadioUiAction * m_screenshotAction;
     Board::Type m_board;
     unsigned int m_backLight;
-    int m_beepShow;
-    int m_beepVal;
 
     static int strKeyToInt(std::string key);
 
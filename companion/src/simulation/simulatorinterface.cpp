@@ -24,13 +24,16 @@
 #include "version.h"
 
 #include <QDebug>
+#include <QFileInfo>
 #include <QLibraryInfo>
+#include <QTemporaryDir>
 
 #if defined _MSC_VER || !defined __GNUC__
   #include <windows.h>
 #endif
 
 QMap<QString, QPair<QString, QLibrary *>> SimulatorLoader::registeredSimulators;
+QMap<SimulatorInterface *, QLibrary *> SimulatorLoader::loadedSimulators;
 
 QStringList SimulatorLoader::getAvailableSimulators()
 {
@@ -113,6 +116,37 @@ QString SimulatorLoader::findSimulatorByName(const QString & name)
   return ret;
 }
 
+// The firmware state (g_model, mixer, tasks...) is global to a simulator
+// library, so a library can only host one radio at a time. Any further
+// concurrent instance gets its own private copy of the library file, which
+// the dynamic loader maps with its own independent set of globals.
+// The state itself is not per instance: code linking the firmware
+// statically (simu-headless) runs one radio per process.
+QLibrary * SimulatorLoader::createInstanceLibrary(const QString & libPath)
+{
+  static QTemporaryDir instancesDir(QDir::tempPath() + "/edgetx-simulators-XXXXXX");
+  static quint32 instancesCount = 0;
+
+  if (!instancesDir.isValid()) {
+    qWarning() << "Unable to create simulator instances directory";
+    return nullptr;
+  }
+
+  QFileInfo libInfo(libPath);
+  QString copyPath = instancesDir.filePath(QString("%1-%2.%3")
+                                           .arg(libInfo.completeBaseName())
+                                           .arg(++instancesCount)
+                                           .arg(libInfo.suffix()));
+
+  if (!QFile::copy(libPath, copyPath)) {
+    qWarning() << "Unable to copy simulator library to" << copyPath;
+    return nullptr;
+  }
+
+  qCDebug(simulatorInterfaceLoader) << "Using library copy" << copyPath;
+  return new QLibrary(copyPath);
+}
+
 SimulatorInterface * SimulatorLoader::loadSimulator(const QString & name)
 {
   SimulatorInterface * si = nullptr;
@@ -137,46 +171,63 @@ SimulatorInterface * SimulatorLoader::loadSimulator(const QString & name)
       return si;
     }
   }
+  else if (lib->property("instances_used").toUInt()) {
+    lib = createInstanceLibrary(libPath);
+    if (!lib)
+      return si;
+  }
 
   SimulatorFactory * factory;
   RegisterSimulator registerFunc = (RegisterSimulator)lib->resolve("registerSimu");
   if (registerFunc && (factory = registerFunc()) && (si = factory->create())) {
     quint8 instance = lib->property("instances_used").toUInt();
     lib->setProperty("instances_used", ++instance);
-    qCDebug(simulatorInterfaceLoader) << "Loaded" << factory->name() << "simulator instance" << instance;
+    loadedSimulators.insert(si, lib);
+    qCDebug(simulatorInterfaceLoader) << "Loaded" << factory->name() << "simulator from" << lib->fileName();
     delete factory;
   }
   else {
-    qWarning() << "Library error" << libPath << lib->errorString();
+    qWarning() << "Library error" << lib->fileName() << lib->errorString();
   }
 
   return si;
 }
 
-bool SimulatorLoader::unloadSimulator(const QString & name)
+bool SimulatorLoader::unloadSimulator(SimulatorInterface * simulator)
 {
   bool ret = false;
-  QString simuName = findSimulatorByName(name);
 
-  if (simuName.isEmpty())
+  if (!simulator)
     return ret;
 
-  QLibrary * lib = registeredSimulators.value(simuName).second;
+  QLibrary * lib = loadedSimulators.take(simulator);
+  // the instance code lives in the library, delete it before unloading
+  delete simulator;
 
   if (lib && lib->isLoaded()) {
     quint8 instance = lib->property("instances_used").toUInt();
     lib->setProperty("instances_used", --instance);
     if (!instance) {
       ret = lib->unload();
-      qCDebug(simulatorInterfaceLoader) << "Unloading" << simuName << "(" << lib->fileName() << ")" << "result:" << ret;
+      qCDebug(simulatorInterfaceLoader) << "Unloading" << lib->fileName() << "result:" << ret;
     }
     else {
       ret = true;
-      qCDebug(simulatorInterfaceLoader) << "Simulator" << simuName << "instances remaining:" << instance;
+      qCDebug(simulatorInterfaceLoader) << "Simulator" << lib->fileName() << "instances remaining:" << instance;
+    }
+
+    bool registered = false;
+    for (const QPair<QString, QLibrary *> & reg : registeredSimulators) {
+      if (reg.second == lib)
+        registered = true;
+    }
+    if (!registered && !instance) {
+      QFile::remove(lib->fileName());
+      delete lib;
     }
   }
   else {
-    qCDebug(simulatorInterfaceLoader) << "Simulator library for " << simuName << "already unloaded.";
+    qCDebug(simulatorInterfaceLoader) << "Simulator library already unloaded.";
   }
 
   return ret;
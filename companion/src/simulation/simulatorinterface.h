@@ -33,6 +33,8 @@
 #include <QDir>
 #include <QLibrary>
 #include <QMap>
+#include <QRect>
+#include <QVector>
 #include <QSerialPort>
 
 #define SIMULATOR_INTERFACE_HEARTBEAT_PERIOD    1000  // ms
@@ -74,18 +76,6 @@ class SimulatorInterface : public QObject
       INPUT_SRC_ENUM_COUNT
     };
 
-    enum OutputSourceType {
-      OUTPUT_SRC_NONE = 0,
-      OUTPUT_SRC_CHAN_OUT,
-      OUTPUT_SRC_CHAN_MIX,
-      OUTPUT_SRC_TRIM_VALUE,
-      OUTPUT_SRC_TRIM_RANGE,
-      OUTPUT_SRC_VIRTUAL_SW,
-      OUTPUT_SRC_PHASE,
-      OUTPUT_SRC_GVAR,
-      OUTPUT_SRC_ENUM_COUNT
-    };
-
     // only for data not available from Boards or Firmware, eg. compile-time options
     enum Capability {
       CAP_LUA,                // LUA
@@ -127,13 +117,13 @@ class SimulatorInterface : public QObject
       void clear() { memset(this, 0, sizeof(TxOutputs)); }
 
       int16_t chans[CPN_MAX_CHNOUT];       // final channel outputs
+      int16_t chansLimit;                  // channel outputs display limit (extended limits)
       int16_t ex_chans[CPN_MAX_CHNOUT];    // raw mix outputs
       qint32 gvars[CPN_MAX_FLIGHT_MODES][CPN_MAX_GVARS];
       int trims[CPN_MAX_TRIMS];            // Board::TrimAxes enum
       bool vsw[CPN_MAX_LOGICAL_SWITCHES];  // virtual/logic switches
       int8_t phase;
       qint16 trimRange;                  // TRIM_MAX or TRIM_EXTENDED_MAX
-      // bool beep;
     };
 
     virtual ~SimulatorInterface() {}
@@ -142,9 +132,13 @@ class SimulatorInterface : public QObject
     virtual bool isRunning() = 0;
     virtual void readRadioData(QByteArray & dest) = 0;
     virtual uint8_t * getLcd() = 0;
+    // same as getLcd(), also returns the areas changed since the previous call
+    virtual uint8_t * getLcd(QVector<QRect> & dirtyRects) = 0;
     virtual uint8_t getSensorInstance(uint16_t id, uint8_t defaultValue = 0) = 0;
     virtual uint16_t getSensorRatio(uint16_t id) = 0;
     virtual const int getCapability(Capability cap) = 0;
+    // copy the latest outputs snapshot, must only be called from one (UI) thread
+    virtual void getOutputs(TxOutputs & outputs) = 0;
 
   public slots:
 
@@ -180,13 +174,10 @@ class SimulatorInterface : public QObject
     void runtimeError(const QString & error);
     void lcdChange(bool backlightEnable);
     void phaseChanged(qint8 phase, const QString & name);
-    void channelOutValueChange(quint8 index, qint32 value, qint32 limit);
-    void channelMixValueChange(quint8 index, qint32 value, qint32 limit);
-    void virtualSwValueChange(quint8 index, qint32 value);
+    // a new outputs snapshot is available from getOutputs()
+    void outputsChanged();
     void trimValueChange(quint8 index, qint32 value);
     void trimRangeChange(quint8 index, qint32 min, qint16 max);
-    void gVarValueChange(quint8 index, qint32 value);
-    void outputValueChange(int type, quint8 index, qint32 value);
     void auxSerialSendData(const quint8 port_num, const QByteArray & data);
     void auxSerialSetEncoding(const quint8 port_num, const quint8 encoding);
     void auxSerialSetBaudrate(const quint8 port_num, const quint32 baudrate);
@@ -212,11 +203,14 @@ class SimulatorLoader
     static QStringList getAvailableSimulators();
     static QString findSimulatorByName(const QString & name);
     static SimulatorInterface * loadSimulator(const QString & name);
-    static bool unloadSimulator(const QString & name);
+    // deletes the simulator instance and releases its library
+    static bool unloadSimulator(SimulatorInterface * simulator);
 
   protected:
     typedef SimulatorFactory * (*RegisterSimulator)();
 
     static int registerSimulators(const QDir & dir);
+    static QLibrary * createInstanceLibrary(const QString & libPath);
     static QMap<QString, QPair<QString, QLibrary *>> registeredSimulators;
+    static QMap<SimulatorInterface *, QLibrary *> loadedSimulators;
 };
@@ -187,11 +187,10 @@ SimulatorMainWindow::~SimulatorMainWindow()
       m_simulator->removeTracebackDevice(&m_simuLogFile);
       m_simuLogFile.close();
     }
-    delete m_simulator;
+    SimulatorLoader::unloadSimulator(m_simulator);
   }
 
   delete hostSerialConnector;
-  SimulatorLoader::unloadSimulator(m_simulatorId);
 }
 
 void SimulatorMainWindow::closeEvent(QCloseEvent *)
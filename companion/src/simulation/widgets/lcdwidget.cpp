@@ -59,7 +59,7 @@ void LcdWidget::makeScreenshot(const QString &fileName)
   }
   QPixmap buffer(width, height);
   QPainter p(&buffer);
-  doPaint(p);
+  doPaint(p, buffer.rect());
   if (fileName.isEmpty()) {
     QApplication::clipboard()->setPixmap(buffer);
     qInfo() << "Screenshot saved to clipboard";
@@ -70,46 +70,75 @@ void LcdWidget::makeScreenshot(const QString &fileName)
 }
 
 void LcdWidget::onLcdChanged(uint8_t* lcdBuf, bool light)
+{
+  onLcdChanged(lcdBuf, light, {QRect(0, 0, lcdWidth, lcdHeight)});
+}
+
+void LcdWidget::onLcdChanged(uint8_t* lcdBuf, bool light,
+                             const QVector<QRect>& dirtyRects)
 {
   QMutexLocker locker(&lcdMtx);
-  lightEnable = light;
-  if (lcdBuf) memcpy(localBuf, lcdBuf, lcdSize);
-  if (!redrawTimer.isValid() ||
-      redrawTimer.hasExpired(LCD_WIDGET_REFRESH_PERIOD)) {
-    update();
-    redrawTimer.start();
+
+  if (light != lightEnable) {
+    lightEnable = light;
+    dirtyRegion = rect();
   }
+
+  if (lcdBuf && !dirtyRects.isEmpty()) {
+    if (lcdDepth >= 12) {
+      const QRect screen(0, 0, lcdWidth, lcdHeight);
+      for (const QRect& r : dirtyRects) {
+        QRect area = r.intersected(screen);
+        if (area.isEmpty()) continue;
+        int offset = (area.y() * lcdWidth + area.x()) * sizeof(uint16_t);
+        int stride = lcdWidth * sizeof(uint16_t);
+        for (int y = 0; y < area.height(); y++, offset += stride) {
+          memcpy(localBuf + offset, lcdBuf + offset,
+                 area.width() * sizeof(uint16_t));
+        }
+        dirtyRegion += area;
+      }
+    } else {
+      // packed monochrome / greyscale screens are small, copy them whole
+      memcpy(localBuf, lcdBuf, lcdSize);
+      dirtyRegion = rect();
+    }
+  }
+
+  scheduleUpdate();
+}
+
+void LcdWidget::scheduleUpdate()
+{
+  if (dirtyRegion.isEmpty() || updatePending) return;
+
+  qint64 wait = 0;
+  if (redrawTimer.isValid() && !redrawTimer.hasExpired(LCD_WIDGET_REFRESH_PERIOD))
+    wait = LCD_WIDGET_REFRESH_PERIOD - redrawTimer.elapsed();
+
+  // throttle repaints, but never drop areas changed in between
+  updatePending = true;
+  QTimer::singleShot(wait, this, [this]() {
+    QMutexLocker locker(&lcdMtx);
+    updatePending = false;
+    update(dirtyRegion);
+    dirtyRegion = QRegion();
+    redrawTimer.start();
+  });
 }
 
-void LcdWidget::doPaint(QPainter &p)
+void LcdWidget::doPaint(QPainter &p, const QRect &rect)
 {
   QRgb rgb;
   uint16_t z;
 
   if (!localBuf) return;
 
-  if (lcdDepth == 16) {
-    for (int x = 0; x < lcdWidth; x++) {
-      for (int y = 0; y < lcdHeight; y++) {
-        z = ((uint16_t *)localBuf)[y * lcdWidth + x];
-        rgb = qRgb(255 * ((z & 0xF800) >> 11) / 0x1F,
-                   255 * ((z & 0x07E0) >> 5) / 0x3F, 255 * (z & 0x001F) / 0x1F);
-        p.setPen(rgb);
-        p.drawPoint(x, y);
-      }
-    }
-    return;
-  }
-  if (lcdDepth == 12) {
-    for (int x = 0; x < lcdWidth; x++) {
-      for (int y = 0; y < lcdHeight; y++) {
-        z = ((uint16_t *)localBuf)[y * lcdWidth + x];
-        rgb = qRgb(255 * ((z & 0xF00) >> 8) / 0x0F,
-                   255 * ((z & 0x0F0) >> 4) / 0x0F, 255 * (z & 0x00F) / 0x0F);
-        p.setPen(rgb);
-        p.drawPoint(x, y);
-      }
-    }
+  if (lcdDepth >= 12) {
+    // RGB565 / RGB444 frame buffers map directly onto a QImage
+    QImage image(localBuf, lcdWidth, lcdHeight, lcdWidth * sizeof(uint16_t),
+                 lcdDepth == 16 ? QImage::Format_RGB16 : QImage::Format_RGB444);
+    p.drawImage(rect, image, rect);
     return;
   }
 
@@ -155,10 +184,10 @@ void LcdWidget::doPaint(QPainter &p)
   }
 }
 
-void LcdWidget::paintEvent(QPaintEvent *)
+void LcdWidget::paintEvent(QPaintEvent *event)
 {
   QPainter p(this);
-  doPaint(p);
+  doPaint(p, event->rect());
 }
 
 void LcdWidget::mouseMoveEvent(QMouseEvent *event)
@@ -30,6 +30,8 @@
 #include <QMutex>
 #include <QMutexLocker>
 #include <QMouseEvent>
+#include <QRegion>
+#include <QTimer>
 #include <AppDebugMessageHandler>
 
 #include "appdata.h"
@@ -47,6 +49,7 @@ class LcdWidget : public QWidget
       QWidget(parent),
       localBuf(NULL),
       lightEnable(false),
+      updatePending(false),
       bgDefaultColor(QColor(198, 208, 199)),
       fgDefaultColor(QColor(0, 0, 0))
   {
@@ -67,6 +70,9 @@ class LcdWidget : public QWidget
   void makeScreenshot(const QString &fileName);
 
   void onLcdChanged(uint8_t* lcdBuf, bool light);
+  // copy and repaint only the given areas (LCD coordinates)
+  void onLcdChanged(uint8_t* lcdBuf, bool light,
+                    const QVector<QRect>& dirtyRects);
 
  signals:
   void touchEvent(int type, int x, int y);
@@ -80,13 +86,16 @@ class LcdWidget : public QWidget
   unsigned char *localBuf;
 
   bool lightEnable;
+  bool updatePending;
+  QRegion dirtyRegion;
   QColor bgColor;
   QColor bgDefaultColor;
   QColor fgDefaultColor;
   QMutex lcdMtx;
   QElapsedTimer redrawTimer;
 
-  void doPaint(QPainter &p);
+  void doPaint(QPainter &p, const QRect &rect);
+  void scheduleUpdate();
 
   void paintEvent(QPaintEvent *) override;
 
@@ -43,6 +43,7 @@
 
 #include "tasks.h"
 #include "tasks/mixer_task.h"
+#include "mixer_scheduler.h"
 
 #include "cli.h"
 
@@ -53,6 +54,10 @@
 
 #include "lua/lua_states.h"
 
+#if defined(COLORLCD)
+#include "ui_profiler.h"
+#endif
+
 #define CLI_COMMAND_MAX_ARGS           8
 #define CLI_COMMAND_MAX_LEN            256
 
@@ -1598,6 +1603,94 @@ int cliRepeat(const char ** argv)
 }
 #endif
 
+int cliLatency(const char ** argv)
+{
+  const char * arg = argv[1] ? argv[1] : "";
+  if (!strcmp(arg, "reset")) {
+    mixerSchedulerResetLatencyStats();
+    return 0;
+  }
+  else if (!strcmp(arg, "align")) {
+    const char * mode = argv[2] ? argv[2] : "";
+    if (!strcmp(mode, "on")) {
+      mixerSchedulerSetPhaseAlign(true);
+    }
+    else if (!strcmp(mode, "off")) {
+      mixerSchedulerSetPhaseAlign(false);
+    }
+    else {
+      cliSerialPrint("%s: Invalid argument \"%s\"", argv[0], mode);
+      return -1;
+    }
+  }
+  else if (arg[0] != '\0') {
+    cliSerialPrint("%s: Invalid argument \"%s\"", argv[0], arg);
+    return -1;
+  }
+
+  const MixerLatencyStats& stats = mixerSchedulerGetLatencyStats();
+  cliSerialPrint("Mixer to RF latency: %u runs, %u late frames reported",
+                 stats.count, stats.late);
+  cliSerialPrint("min %uus / avg %uus / max %uus", stats.min, stats.avg,
+                 stats.max);
+  cliSerialPrint("phase align %s, margin %uus",
+                 mixerSchedulerGetPhaseAlign() ? "on" : "off",
+                 mixerSchedulerGetPhaseMargin());
+  for (int i = 0; i < MIXER_LATENCY_BINS; i++) {
+    if (!stats.bins[i]) continue;
+    cliSerialPrint("%5uus%s %u", i * MIXER_LATENCY_BIN_US,
+                   i == MIXER_LATENCY_BINS - 1 ? "+" : " ", stats.bins[i]);
+  }
+  return 0;
+}
+
+#if defined(COLORLCD)
+int cliUiProfiler(const char ** argv)
+{
+  const char * arg = argv[1] ? argv[1] : "";
+  if (!strcmp(arg, "on") || !strcmp(arg, "off")) {
+    uiProfilerEnable(arg[1] == 'n');
+    return 0;
+  }
+  else if (!strcmp(arg, "reset")) {
+    uiProfilerReset();
+    return 0;
+  }
+  else if (!strcmp(arg, "csv")) {
+    uiProfilerDumpCsv(
+        [](const char * line, void *) { cliSerialPrint("%s", line); },
+        nullptr);
+    return 0;
+  }
+  else if (arg[0] != '\0') {
+    cliSerialPrint("%s: Invalid argument \"%s\"", argv[0], arg);
+    return -1;
+  }
+
+  static const char * const stageNames[UI_PROF_STAGES] = {
+    "frame", "lua", "lvgl", "flush", "events", "lua widgets",
+  };
+
+  const UiProfilerStats & stats = uiProfilerGetStats();
+  cliSerialPrint("UI profiler %s: %u frames, interval %uus",
+                 uiProfilerEnabled() ? "on" : "off", stats.frames,
+                 stats.interval);
+  for (int i = 0; i < UI_PROF_STAGES; i++) {
+    cliSerialPrint("%-12s last %6uus avg %6uus max %6uus", stageNames[i],
+                   stats.stages[i].last, stats.stages[i].avg,
+                   stats.stages[i].max);
+  }
+  for (const auto & widget : stats.widgets) {
+    if (!widget.key) continue;
+    cliSerialPrint("%-12s update %6uus refresh %6uus background %6uus",
+                   widget.name, widget.stats[UI_PROF_WIDGET_UPDATE].avg,
+                   widget.stats[UI_PROF_WIDGET_REFRESH].avg,
+                   widget.stats[UI_PROF_WIDGET_BACKGROUND].avg);
+  }
+  return 0;
+}
+#endif
+
 #if defined(JITTER_MEASURE)
 int cliShowJitter(const char ** argv)
 {
@@ -1793,6 +1886,10 @@ const CliCommand cliCommands[] = {
   { "testfatfs", cliTestFatFsSD, "" },
 #endif
   { "help", cliHelp, "[<command>]" },
+  { "latency", cliLatency, "[reset | align on|off]" },
+#if defined(COLORLCD)
+  { "uiprof", cliUiProfiler, "[on | off | reset | csv]" },
+#endif
 #if defined(JITTER_MEASURE)
   { "jitter", cliShowJitter, "" },
 #endif
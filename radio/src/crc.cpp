@@ -21,8 +21,55 @@
 
 #include "crc.h"
 
+#if defined(HARDWARE_CRC)
+  #include "stm32_crc.h"
+#endif
+
+#if defined(CRC_SLICE_TABLES)
+// Slice-by-N tables: tab[k][v] is the CRC of byte v followed by k zero
+// bytes, tab[0] being the byte-at-a-time table. They are derived from
+// the byte-at-a-time tables at compile time.
+template <typename T, unsigned N>
+struct CrcSliceTables {
+  T tab[N][256];
+};
+
+template <unsigned N>
+static constexpr CrcSliceTables<uint16_t, N> crc16SliceTables(
+    const unsigned short (&base)[256])
+{
+  CrcSliceTables<uint16_t, N> tables = {};
+  for (unsigned v = 0; v < 256; v++) {
+    tables.tab[0][v] = base[v];
+  }
+  for (unsigned k = 1; k < N; k++) {
+    for (unsigned v = 0; v < 256; v++) {
+      uint16_t crc = tables.tab[k - 1][v];
+      tables.tab[k][v] = (uint16_t)(crc << 8) ^ base[crc >> 8];
+    }
+  }
+  return tables;
+}
+
+template <unsigned N>
+static constexpr CrcSliceTables<uint8_t, N> crc8SliceTables(
+    const unsigned char (&base)[256])
+{
+  CrcSliceTables<uint8_t, N> tables = {};
+  for (unsigned v = 0; v < 256; v++) {
+    tables.tab[0][v] = base[v];
+  }
+  for (unsigned k = 1; k < N; k++) {
+    for (unsigned v = 0; v < 256; v++) {
+      tables.tab[k][v] = base[tables.tab[k - 1][v]];
+    }
+  }
+  return tables;
+}
+#endif
+
 // CRC16 implementation according to CCITT standards
-static const unsigned short crc16tab_1021[256] = {
+static constexpr unsigned short crc16tab_1021[256] = {
   0x0000,0x1021,0x2042,0x3063,0x4084,0x50a5,0x60c6,0x70e7,
   0x8108,0x9129,0xa14a,0xb16b,0xc18c,0xd1ad,0xe1ce,0xf1ef,
   0x1231,0x0210,0x3273,0x2252,0x52b5,0x4294,0x72f7,0x62d6,
@@ -57,7 +104,7 @@ static const unsigned short crc16tab_1021[256] = {
   0x6e17,0x7e36,0x4e55,0x5e74,0x2e93,0x3eb2,0x0ed1,0x1ef0
 };
 
-static const unsigned short crc16tab_1189[256] = {
+static constexpr unsigned short crc16tab_1189[256] = {
   0x0000,0x1189,0x2312,0x329b,0x4624,0x57ad,0x6536,0x74bf,
   0x8c48,0x9dc1,0xaf5a,0xbed3,0xca6c,0xdbe5,0xe97e,0xf8f7,
   0x1081,0x0108,0x3393,0x221a,0x56a5,0x472c,0x75b7,0x643e,
@@ -97,18 +144,76 @@ const unsigned short * const crc16tab[] = {
   crc16tab_1189
 };
 
-uint16_t crc16(uint8_t index, const uint8_t * buf, uint32_t len, uint16_t start)
+#if defined(CRC_SLICE_TABLES)
+// slice-by-4 uses the first 4 tables
+static constexpr CrcSliceTables<uint16_t, 8> crc16slices[] = {
+  crc16SliceTables<8>(crc16tab_1021),
+  crc16SliceTables<8>(crc16tab_1189),
+};
+#endif
+
+static uint16_t crc16_bytewise(const uint16_t * tab, const uint8_t * buf,
+                               uint32_t len, uint16_t crc)
 {
-  uint16_t crc = start;
-  const unsigned short * tab = crc16tab[index];
   for (uint32_t i = 0; i < len; i++) {
     crc = (crc << 8) ^ tab[((crc >> 8) ^ *buf++) & 0x00FF];
   }
   return crc;
 }
 
+#if defined(CRC_SLICE_TABLES)
+static uint16_t crc16_slice4(const CrcSliceTables<uint16_t, 8> & t,
+                             const uint8_t * buf, uint32_t len, uint16_t crc)
+{
+  for (; len >= 4; len -= 4, buf += 4) {
+    uint16_t x = crc ^ ((buf[0] << 8) | buf[1]);
+    crc = t.tab[3][x >> 8] ^ t.tab[2][x & 0xFF] ^
+          t.tab[1][buf[2]] ^ t.tab[0][buf[3]];
+  }
+  return crc16_bytewise(t.tab[0], buf, len, crc);
+}
+
+static uint16_t crc16_slice8(const CrcSliceTables<uint16_t, 8> & t,
+                             const uint8_t * buf, uint32_t len, uint16_t crc)
+{
+  for (; len >= 8; len -= 8, buf += 8) {
+    uint16_t x = crc ^ ((buf[0] << 8) | buf[1]);
+    crc = t.tab[7][x >> 8] ^ t.tab[6][x & 0xFF] ^
+          t.tab[5][buf[2]] ^ t.tab[4][buf[3]] ^
+          t.tab[3][buf[4]] ^ t.tab[2][buf[5]] ^
+          t.tab[1][buf[6]] ^ t.tab[0][buf[7]];
+  }
+  return crc16_slice4(t, buf, len, crc);
+}
+#endif
+
+uint16_t crc16(uint8_t index, const uint8_t * buf, uint32_t len, uint16_t start,
+               uint8_t method)
+{
+#if defined(HARDWARE_CRC)
+  // CRC_1189 table is not a plain MSB first CRC, no hardware for it
+  if (method == CRC_HARDWARE && index == CRC_1021) {
+    uint16_t crc;
+    if (stm32_crc_compute(0x1021, 16, start, buf, len, &crc))
+      return crc;
+  }
+#endif
+#if defined(CRC_SLICE_TABLES)
+  switch (method) {
+    case CRC_HARDWARE:
+    case CRC_SLICE_BY_8:
+      return crc16_slice8(crc16slices[index], buf, len, start);
+    case CRC_SLICE_BY_4:
+      return crc16_slice4(crc16slices[index], buf, len, start);
+  }
+#else
+  (void)method;
+#endif
+  return crc16_bytewise(crc16tab[index], buf, len, start);
+}
+
 // CRC8 implementation with polynom = x^8+x^7+x^6+x^4+x^2+1 (0xD5)
-const unsigned char crc8tab[256] = {
+static constexpr unsigned char crc8tab[256] = {
   0x00, 0xD5, 0x7F, 0xAA, 0xFE, 0x2B, 0x81, 0x54,
   0x29, 0xFC, 0x56, 0x83, 0xD7, 0x02, 0xA8, 0x7D,
   0x52, 0x87, 0x2D, 0xF8, 0xAC, 0x79, 0xD3, 0x06,
@@ -143,17 +248,50 @@ const unsigned char crc8tab[256] = {
   0xAD, 0x78, 0xD2, 0x07, 0x53, 0x86, 0x2C, 0xF9
 };
 
-uint8_t crc8(const uint8_t * ptr, uint32_t len)
+static uint8_t crc8_bytewise(const uint8_t * tab, const uint8_t * ptr,
+                             uint32_t len, uint8_t crc)
 {
-  uint8_t crc = 0;
   for (uint32_t i=0; i<len; i++) {
-    crc = crc8tab[crc ^ *ptr++];
+    crc = tab[crc ^ *ptr++];
   }
   return crc;
 }
 
+#if defined(CRC_SLICE_TABLES)
+// 8 bit CRCs frames are short, slice-by-4 at most
+static uint8_t crc8_slice4(const CrcSliceTables<uint8_t, 4> & t,
+                           const uint8_t * ptr, uint32_t len, uint8_t crc)
+{
+  for (; len >= 4; len -= 4, ptr += 4) {
+    crc = t.tab[3][crc ^ ptr[0]] ^ t.tab[2][ptr[1]] ^
+          t.tab[1][ptr[2]] ^ t.tab[0][ptr[3]];
+  }
+  return crc8_bytewise(t.tab[0], ptr, len, crc);
+}
+
+static constexpr CrcSliceTables<uint8_t, 4> crc8slices = crc8SliceTables<4>(crc8tab);
+#endif
+
+uint8_t crc8(const uint8_t * ptr, uint32_t len, uint8_t method)
+{
+#if defined(HARDWARE_CRC)
+  if (method == CRC_HARDWARE) {
+    uint16_t crc;
+    if (stm32_crc_compute(0xD5, 8, 0, ptr, len, &crc))
+      return crc;
+  }
+#endif
+#if defined(CRC_SLICE_TABLES)
+  if (method != CRC_BYTEWISE)
+    return crc8_slice4(crc8slices, ptr, len, 0);
+#else
+  (void)method;
+#endif
+  return crc8_bytewise(crc8tab, ptr, len, 0);
+}
+
 // CRC8 implementation with polynom = 0xBA
-const unsigned char crc8tab_BA[256] = {
+static constexpr unsigned char crc8tab_BA[256] = {
   0x00, 0xBA, 0xCE, 0x74, 0x26, 0x9C, 0xE8, 0x52,
   0x4C, 0xF6, 0x82, 0x38, 0x6A, 0xD0, 0xA4, 0x1E,
   0x98, 0x22, 0x56, 0xEC, 0xBE, 0x04, 0x70, 0xCA,
@@ -188,11 +326,18 @@ const unsigned char crc8tab_BA[256] = {
   0x16, 0xAC, 0xD8, 0x62, 0x30, 0x8A, 0xFE, 0x44
 };
 
-uint8_t crc8_BA(const uint8_t * ptr, uint32_t len)
+#if defined(CRC_SLICE_TABLES)
+static constexpr CrcSliceTables<uint8_t, 4> crc8slices_BA = crc8SliceTables<4>(crc8tab_BA);
+#endif
+
+// 0xBA is even, not supported by the CRC unit
+uint8_t crc8_BA(const uint8_t * ptr, uint32_t len, uint8_t method)
 {
-  uint8_t crc = 0;
-  for (uint32_t i=0; i<len; i++) {
-    crc = crc8tab_BA[crc ^ *ptr++];
-  }
-  return crc;
+#if defined(CRC_SLICE_TABLES)
+  if (method != CRC_BYTEWISE)
+    return crc8_slice4(crc8slices_BA, ptr, len, 0);
+#else
+  (void)method;
+#endif
+  return crc8_bytewise(crc8tab_BA, ptr, len, 0);
 }
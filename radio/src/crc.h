@@ -28,8 +28,26 @@ enum {
   CRC_1189,
 };
 
+// CRC computation method, chosen per call site: the slice-by-N tables
+// trade flash for speed on large buffers, small frames are better off
+// with the byte-at-a-time tables.
+//
+// The slice tables (~10 KB) are only linked on color radios and in the
+// simulator, other targets run every method byte-at-a-time.
+#if defined(COLORLCD) || defined(SIMU)
+  #define CRC_SLICE_TABLES
+#endif
+
+enum CrcMethod {
+  CRC_BYTEWISE,
+  CRC_SLICE_BY_4,
+  CRC_SLICE_BY_8,
+  CRC_HARDWARE,  // CRC unit when supported, slice-by-8 otherwise
+};
+
 extern const unsigned short * const crc16tab[2];
 
-uint8_t crc8(const uint8_t * ptr, uint32_t len);
-uint8_t crc8_BA(const uint8_t * ptr, uint32_t len);
-uint16_t crc16(uint8_t index, const uint8_t * buf, uint32_t len, uint16_t start = 0);
+uint8_t crc8(const uint8_t * ptr, uint32_t len, uint8_t method = CRC_BYTEWISE);
+uint8_t crc8_BA(const uint8_t * ptr, uint32_t len, uint8_t method = CRC_BYTEWISE);
+uint16_t crc16(uint8_t index, const uint8_t * buf, uint32_t len, uint16_t start = 0,
+               uint8_t method = CRC_BYTEWISE);
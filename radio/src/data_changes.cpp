@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "data_changes.h"
+#include "dataconstants.h"
+
+#include <atomic>
+
+static std::atomic<uint32_t> topicSequence[DATA_TOPIC_COUNT];
+
+void dataPublish(uint8_t topic)
+{
+  topicSequence[topic].fetch_add(1, std::memory_order_release);
+}
+
+uint32_t dataTopicSequence(uint8_t topic)
+{
+  return topicSequence[topic].load(std::memory_order_acquire);
+}
+
+DataSequences dataSequences()
+{
+  DataSequences sequences;
+  for (uint8_t topic = 0; topic < DATA_TOPIC_COUNT; topic++) {
+    sequences.topic[topic] = dataTopicSequence(topic);
+  }
+  return sequences;
+}
+
+uint32_t dataTopicsForSource(int32_t source)
+{
+  if (source < 0) source = -source;
+
+  if (source >= MIXSRC_FIRST_STICK && source <= MIXSRC_LAST_POT)
+    return DATA_TOPIC(DATA_ANALOGS);
+  if (source >= MIXSRC_FIRST_TRIM && source <= MIXSRC_LAST_TRIM)
+    return DATA_TOPIC(DATA_TRIMS) | DATA_TOPIC(DATA_FLIGHT_MODE);
+  if (source >= MIXSRC_FIRST_SWITCH && source <= MIXSRC_LAST_SWITCH)
+    return DATA_TOPIC(DATA_SWITCHES);
+  if (source >= MIXSRC_FIRST_LOGICAL_SWITCH &&
+      source <= MIXSRC_LAST_LOGICAL_SWITCH)
+    return DATA_TOPIC(DATA_LOGICAL_SWITCHES);
+  if (source >= MIXSRC_FIRST_CH && source <= MIXSRC_LAST_CH)
+    return DATA_TOPIC(DATA_CHANNELS);
+  if (source >= MIXSRC_FIRST_GVAR && source <= MIXSRC_LAST_GVAR)
+    return DATA_TOPIC(DATA_GVARS) | DATA_TOPIC(DATA_FLIGHT_MODE);
+  if (source >= MIXSRC_FIRST_TIMER && source <= MIXSRC_LAST_TIMER)
+    return DATA_TOPIC(DATA_TIMERS);
+  if (source >= MIXSRC_FIRST_TELEM && source <= MIXSRC_LAST_TELEM)
+    return DATA_TOPIC(DATA_TELEMETRY);
+
+  // inputs, radio time, battery, trainer inputs, ...
+  return DATA_ALL_TOPICS;
+}
+
+bool DataSubscription::changed()
+{
+  if (topics == DATA_ALL_TOPICS) {
+    return true;
+  }
+
+  bool result = force;
+
+  // each topic remembers the sequence it was compared with
+  for (uint32_t mask = topics; mask; mask &= mask - 1) {
+    uint8_t topic = __builtin_ctz(mask);
+    uint32_t seq = dataTopicSequence(topic);
+    if (seq != seen.topic[topic]) {
+      seen.topic[topic] = seq;
+      result = true;
+    }
+  }
+
+  force = false;
+  return result;
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// Data changes notifications
+//
+// The mixer, telemetry and storage sides publish a topic each time the
+// data it covers changes. Each publication increments the sequence of its
+// topic, so a subscriber only has to remember the sequences it last saw
+// to know whether anything it displays changed since.
+
+enum DataTopic {
+  DATA_CHANNELS,          // mixer outputs and channels
+  DATA_ANALOGS,           // calibrated sticks, pots and sliders
+  DATA_SWITCHES,          // physical switches positions
+  DATA_LOGICAL_SWITCHES,  // logical switches states
+  DATA_TRIMS,
+  DATA_GVARS,
+  DATA_TIMERS,
+  DATA_FLIGHT_MODE,
+  DATA_TELEMETRY,         // sensors values
+  DATA_SETTINGS,          // any model or radio setting
+  DATA_TOPIC_COUNT
+};
+
+#define DATA_TOPIC(topic)  (1u << (topic))
+#define DATA_ALL_TOPICS    (DATA_TOPIC(DATA_TOPIC_COUNT) - 1)
+
+void dataPublish(uint8_t topic);
+
+// Number of publications of a topic
+uint32_t dataTopicSequence(uint8_t topic);
+
+// Sequences of all the topics at a given time
+struct DataSequences {
+  uint32_t topic[DATA_TOPIC_COUNT];
+};
+
+DataSequences dataSequences();
+
+// Topics read by a source (mixsrc_t), DATA_ALL_TOPICS when unknown
+uint32_t dataTopicsForSource(int32_t source);
+
+class DataSubscription
+{
+ public:
+  explicit DataSubscription(uint32_t topics = 0) : topics(topics) {}
+
+  void subscribe(uint32_t newTopics)
+  {
+    topics = newTopics;
+    force = true;
+  }
+
+  // Only the changes published after dataSequences() returned since
+  void subscribe(uint32_t newTopics, const DataSequences& since)
+  {
+    topics = newTopics;
+    seen = since;
+    force = false;
+  }
+
+  // Returns true once for each batch of changes of the subscribed
+  // topics, and on the first call after subscribe()
+  bool changed();
+
+ protected:
+  uint32_t topics;
+  DataSequences seen = {};
+  bool force = true;
+};
@@ -170,7 +170,8 @@ static void setPhysicalPageState(FrFTL* ftl, uint16_t physicalPageNo,
 static const uint16_t crc16_ccitt_start = 0xFFFF;
 
 static inline uint16_t crc16_x25_ccitt(const void* buf, uint32_t len) {
-  return crc16(CRC_1021, (const uint8_t*)buf, len, crc16_ccitt_start);
+  return crc16(CRC_1021, (const uint8_t*)buf, len, crc16_ccitt_start,
+               CRC_HARDWARE);
 }
 
 static inline uint16_t calcCRC(TransTableHeader* header)
@@ -546,6 +546,7 @@ bool setTrimValue(uint8_t phase, uint8_t idx, int trim)
     }
   }
   storageDirty(EE_MODEL);
+  dataPublish(DATA_TRIMS);
   return true;
 }
 
@@ -149,6 +149,7 @@ void memswap(void * a, void * b, uint8_t size);
 #endif
 
 #include "timers.h"
+#include "data_changes.h"
 #include "storage/storage.h"
 #include "pulses/pulses.h"
 #include "pulses/modules_helpers.h"
@@ -156,11 +157,25 @@ void memswap(void * a, void * b, uint8_t size);
 #define MASK_CFN_TYPE  uint64_t  // current max = 64 customizable switches
 #define MASK_FUNC_TYPE uint32_t  // current max = 32 functions
 
+#define CFN_SWITCH_NOT_SHARED 0xFF
+
+struct CustomFunctionIndex {
+  uint8_t cfn;          // index in the functions array
+  uint8_t switchSlot;   // entries with the same slot share the switch state
+  uint8_t switchFlags;  // getSwitch() flags
+};
+
 struct CustomFunctionsContext {
   MASK_FUNC_TYPE activeFunctions;
   MASK_CFN_TYPE  activeSwitches;
   tmr10ms_t lastFunctionTime[MAX_SPECIAL_FUNCTIONS];
 
+  // Functions with a switch, in evaluation order
+  bool indexValid;
+  uint8_t indexVersion;
+  uint8_t indexCount;
+  CustomFunctionIndex index[MAX_SPECIAL_FUNCTIONS];
+
   inline bool isFunctionActive(uint8_t func)
   {
     return activeFunctions & ((MASK_FUNC_TYPE)1 << func);
@@ -453,6 +468,7 @@ inline bool isFunctionActive(uint8_t func)
   return globalFunctionsContext.isFunctionActive(func) || modelFunctionsContext.isFunctionActive(func);
 }
 void evalFunctions(CustomFunctionData * functions, CustomFunctionsContext & functionsContext);
+void customFunctionsChanged();
 inline void customFunctionsReset()
 {
   globalFunctionsContext.reset();
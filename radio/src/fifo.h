@@ -22,7 +22,14 @@
 #pragma once
 
 #include <inttypes.h>
-
+#include <string.h>
+#include <atomic>
+#include <type_traits>
+
+// Lock-free single producer / single consumer ring buffer: one context
+// (task or ISR) pushes, one context pops. The indexes are free running,
+// the producer publishes the elements with a release store of widx and
+// the consumer frees the slots with a release store of ridx.
 template <class T, int N>
 class Fifo
 {
@@ -35,81 +42,177 @@ class Fifo
     {
     }
 
+    // consumer side: drops everything pushed so far
     void clear()
     {
-      widx = ridx = 0;
+      ridx.store(widx.load(std::memory_order_acquire),
+                 std::memory_order_release);
     }
 
     void push(T element)
     {
-      uint32_t next = nextIndex(widx);
-      if (next != ridx) {
-        fifo[widx] = element;
-        widx = next;
+      uint32_t w = widx.load(std::memory_order_relaxed);
+      if (w - ridx.load(std::memory_order_acquire) >= N) {
+        _overflows++;
+        return;
+      }
+      fifo[w & (N - 1)] = element;
+      widx.store(w + 1, std::memory_order_release);
+    }
+
+    // Pushes as many elements as possible, returns how many were pushed
+    // (the others are counted as overflows)
+    uint32_t push(const T * elements, uint32_t count)
+    {
+      uint32_t w = widx.load(std::memory_order_relaxed);
+      uint32_t space = N - (w - ridx.load(std::memory_order_acquire));
+      if (count > space) {
+        _overflows += count - space;
+        count = space;
       }
+      copyIn(w, elements, count);
+      widx.store(w + count, std::memory_order_release);
+      return count;
     }
 
     void skip()
     {
-      ridx = nextIndex(ridx);
+      skip(1);
+    }
+
+    // consumer side: releases count elements (at most size())
+    void skip(uint32_t count)
+    {
+      uint32_t r = ridx.load(std::memory_order_relaxed);
+      uint32_t available = widx.load(std::memory_order_acquire) - r;
+      if (count > available) count = available;
+      ridx.store(r + count, std::memory_order_release);
     }
 
     bool pop(T & element)
     {
-      if (isEmpty()) {
+      uint32_t r = ridx.load(std::memory_order_relaxed);
+      if (r == widx.load(std::memory_order_acquire)) {
         return false;
       }
       else {
-        element = fifo[ridx];
-        ridx = nextIndex(ridx);
+        element = fifo[r & (N - 1)];
+        ridx.store(r + 1, std::memory_order_release);
         return true;
       }
     }
 
+    // Pops up to count elements, returns how many were popped
+    uint32_t pop(T * elements, uint32_t count)
+    {
+      uint32_t r = ridx.load(std::memory_order_relaxed);
+      uint32_t available = widx.load(std::memory_order_acquire) - r;
+      if (count > available) count = available;
+      copyOut(r, elements, count);
+      ridx.store(r + count, std::memory_order_release);
+      return count;
+    }
+
+    // Contiguous elements ready to be read (e.g. for memcpy or DMA),
+    // to be released with skip(len)
+    const T * readSpan(uint32_t & len) const
+    {
+      uint32_t r = ridx.load(std::memory_order_relaxed);
+      uint32_t available = widx.load(std::memory_order_acquire) - r;
+      uint32_t idx = r & (N - 1);
+      len = available < N - idx ? available : N - idx;
+      return &fifo[idx];
+    }
+
+    // Contiguous free slots (e.g. for a DMA transfer),
+    // to be published with commit(len)
+    T * writeSpan(uint32_t & len)
+    {
+      uint32_t w = widx.load(std::memory_order_relaxed);
+      uint32_t space = N - (w - ridx.load(std::memory_order_acquire));
+      uint32_t idx = w & (N - 1);
+      len = space < N - idx ? space : N - idx;
+      return &fifo[idx];
+    }
+
+    // producer side: publishes count elements written with writeSpan()
+    void commit(uint32_t count)
+    {
+      widx.store(widx.load(std::memory_order_relaxed) + count,
+                 std::memory_order_release);
+    }
+
     bool isEmpty() const
     {
-      return (ridx == widx);
+      return size() == 0;
     }
 
     bool isFull() const
     {
-      uint32_t next = nextIndex(widx);
-      return (next == ridx);
+      return size() == N;
     }
 
     uint32_t size() const
     {
-      return (N + widx - ridx) & (N - 1);
+      return widx.load(std::memory_order_acquire) -
+             ridx.load(std::memory_order_acquire);
     }
 
     bool hasSpace(uint32_t n) const
     {
-      return (N > (size() + n));
+      return N - size() >= n;
     }
 
     bool probe(T & element) const
     {
-      if (isEmpty()) {
+      uint32_t r = ridx.load(std::memory_order_relaxed);
+      if (r == widx.load(std::memory_order_acquire)) {
         return false;
       }
       else {
-        element = fifo[ridx];
+        element = fifo[r & (N - 1)];
         return true;
       }
     }
 
-    T * buffer()
+    // elements dropped because the fifo was full
+    uint32_t overflows() const
     {
-      return fifo;
+      return _overflows;
     }
 
   protected:
     T fifo[N];
-    volatile uint32_t widx;
-    volatile uint32_t ridx;
+    std::atomic<uint32_t> widx;
+    std::atomic<uint32_t> ridx;
+    uint32_t _overflows = 0;
+
+    // copies in at most 2 chunks (before and after the wrap)
+    void copyIn(uint32_t w, const T * elements, uint32_t count)
+    {
+      uint32_t idx = w & (N - 1);
+      uint32_t first = count < N - idx ? count : N - idx;
+      copy(&fifo[idx], elements, first);
+      copy(fifo, elements + first, count - first);
+    }
+
+    void copyOut(uint32_t r, T * elements, uint32_t count) const
+    {
+      uint32_t idx = r & (N - 1);
+      uint32_t first = count < N - idx ? count : N - idx;
+      copy(elements, &fifo[idx], first);
+      copy(elements + first, fifo, count - first);
+    }
 
-    static inline uint32_t nextIndex(uint32_t idx)
+    static void copy(T * dst, const T * src, uint32_t count)
     {
-      return (idx + 1) & (N - 1);
+      if constexpr (std::is_trivially_copyable<T>::value) {
+        memcpy(dst, src, count * sizeof(T));
+      }
+      else {
+        for (uint32_t i = 0; i < count; i++) {
+          dst[i] = src[i];
+        }
+      }
     }
 };
@@ -135,10 +135,68 @@ static const uint8_t lz4FontData[] ={
 0x88,0x25,0x11,0xd0,0x03,0xf0,0x05,0xba,0x26,0xa1,0x15,0x16,0x21,0x00,0x00,0x25,
 0x28,0x91,0x15,0x14,0x22,0x01,0x00,0x79,0x29,0xd1,0x11,0xe8,0x00,0xf2,0x03,0x59,
 0x2a,0x91,0x15,0x14,0x20,0x01,0x00,0x99,0x2b,0xd1,0x11,0x10,0x1a,0x01,0x00,0x69,
-0x2c,0x20,0x00,0x22,0xbd,0x2d,0x20,0x00,0x40,0x9d,0x2e,0xf1,0x08,0xf8,0x01,0xa5,
-0x0f,0xff,0x50,0xff,0xf5,0x0f,0xff,0x40,0xff,0xf4,0x05,0x00,0xf3,0x0e,0xf3,0x0f,
-0xff,0x30,0xff,0xf3,0x0e,0xff,0x30,0xef,0xf3,0x0e,0xff,0x20,0xef,0xf2,0x0e,0xff,
-0x20,0xdf,0xf2,0x0d,0xff,0x20,0xdf,0xf1,0x0c,0xff,0x10,0xad,0x09,0xf1,0x03,0x05,
+0x2c,0x20,0x00,0x22,0xbd,0x2d,0x20,0x00,0x40,0x9d,0x2e,0xf1,0x08,0xf8,0x01,0x09,
+0x01,0x00,0x2f,0xf5,0x00,0x01,0x00,0x05,0x13,0xe2,0x08,0x00,0x17,0xde,0x14,0x00,
+0xbf,0xf2,0xef,0x00,0xfa,0xef,0x00,0xea,0x00,0x00,0x00,0x03,0x34,0x00,0x02,0x4f,
+0x06,0x05,0x00,0x06,0x18,0x00,0x01,0x2f,0xd0,0x00,0x01,0x00,0x17,0x1f,0xc1,0x20,
+0x00,0x0c,0x03,0x90,0x00,0xb1,0xef,0x00,0xfd,0x00,0x00,0xdc,0xfb,0xe8,0xed,0x00,
+0xe6,0x11,0x00,0x00,0x0f,0x00,0x5e,0xfb,0xfd,0xf2,0xf7,0x00,0x9a,0x00,0x6f,0xf8,
+0x00,0xf9,0x00,0x00,0xf1,0x4e,0x00,0x03,0x17,0xf9,0x26,0x00,0x04,0x47,0x00,0x07,
+0x01,0x00,0x14,0xfb,0x09,0x00,0x51,0xe3,0x00,0x00,0x00,0xfa,0x26,0x00,0x5b,0xfa,
+0x00,0xfa,0xf4,0xfa,0x46,0x00,0x1c,0xf7,0x08,0x01,0x05,0x40,0x00,0x11,0xfb,0x43,
+0x00,0x28,0xfb,0xf9,0x32,0x00,0x11,0xbe,0x12,0x01,0x15,0xb6,0x26,0x00,0x62,0xf6,
+0xfa,0x00,0x00,0xfa,0xf9,0x04,0x00,0x0a,0x01,0x00,0x13,0x05,0x98,0x00,0x2f,0x05,
+0xf8,0x12,0x01,0x09,0x1f,0xfa,0x55,0x01,0x0f,0x1b,0xee,0xa5,0x00,0x40,0xf9,0x00,
+0xfa,0xf8,0x3a,0x00,0x23,0xf5,0xee,0x11,0x00,0x14,0xa2,0x72,0x00,0x96,0xee,0x00,
+0x00,0xb3,0xf1,0xcf,0xd8,0x00,0xbd,0x2d,0x00,0x37,0xf4,0xdb,0xe6,0x3b,0x00,0x73,
+0xa5,0x00,0x00,0x00,0xd9,0x00,0xc8,0xf8,0x00,0xc0,0xf9,0x00,0xfd,0xfc,0x00,0x00,
+0xfc,0x00,0x00,0x04,0x00,0x04,0x12,0x00,0x1b,0xe5,0x79,0x00,0x6f,0xf4,0x00,0xf8,
+0xfa,0x00,0xf6,0x9f,0x00,0x0d,0x10,0xea,0x26,0x01,0x1e,0xf3,0x19,0x00,0x02,0x9f,
+0x02,0xc0,0xc3,0xbf,0x00,0x00,0xea,0xf8,0xbd,0xfc,0x05,0x00,0x05,0x04,0x13,0x01,
+0xf1,0x02,0xe0,0xe4,0x00,0xe1,0xe4,0xeb,0xdf,0x00,0xe5,0xec,0xf0,0xea,0xef,0x00,
+0xce,0xe0,0xe5,0x72,0x01,0x66,0xc1,0xf6,0x00,0x00,0xeb,0xfc,0x3b,0x01,0xa3,0xf3,
+0xf4,0x00,0x00,0xf3,0xf8,0x00,0x00,0xf8,0xfd,0x49,0x01,0x10,0x00,0xa5,0x00,0x20,
+0xdd,0xef,0x94,0x00,0x11,0x00,0xad,0x00,0x00,0xc7,0x02,0x63,0xf7,0xf7,0x00,0x00,
+0xf7,0xfa,0xe9,0x01,0x15,0x04,0x3e,0x00,0x14,0xf3,0x1b,0x02,0x15,0x04,0x27,0x02,
+0x10,0xfa,0x30,0x01,0x16,0xf7,0x2f,0x02,0xf5,0x14,0x06,0xf2,0xc5,0xf1,0x00,0x00,
+0xe6,0xf8,0xe5,0xfc,0x05,0xe5,0x05,0x05,0x04,0x05,0x00,0x05,0xeb,0xee,0xfa,0xf5,
+0xee,0xf5,0xf0,0xfa,0xf5,0xfa,0x00,0xfa,0xf8,0x05,0xe5,0xee,0xee,0x2d,0x00,0x2a,
+0x04,0xf9,0xaf,0x01,0x10,0xfa,0x14,0x02,0x1e,0xf8,0xd5,0x01,0x17,0xfb,0x72,0x02,
+0x0c,0x01,0x00,0x1f,0xed,0x41,0x01,0x09,0x05,0xf8,0x00,0x0f,0x29,0x02,0x0a,0x4e,
+0xfd,0x00,0xfc,0xfc,0xe5,0x02,0x0f,0x55,0x00,0x0f,0x0f,0x1d,0x00,0x0a,0x0d,0xf3,
+0x03,0x00,0x13,0x00,0x1b,0xf9,0xc5,0x02,0x01,0x40,0x03,0x0f,0x01,0x00,0x24,0x0d,
+0xdf,0x02,0x1f,0xda,0x98,0x00,0x0b,0x25,0xfa,0xfc,0x77,0x00,0x1c,0xdd,0x4f,0x02,
+0x20,0xfb,0x04,0x4f,0x00,0x4f,0x0e,0x00,0x05,0x05,0x75,0x00,0x1a,0x17,0x04,0x10,
+0x05,0x05,0x69,0x00,0x3e,0xfc,0x04,0x00,0x22,0x01,0x1f,0xdd,0xe4,0x00,0x26,0x1f,
+0xfa,0x91,0x01,0x12,0x1f,0xfc,0x41,0x00,0x20,0x21,0x01,0x00,0xf5,0x05,0x31,0x02,
+0x03,0x00,0xa7,0x03,0x1e,0x05,0xb7,0x05,0xf1,0x0b,0x07,0x08,0x09,0x0a,0x0b,0x00,
+0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,
+0x16,0x17,0x18,0x19,0x20,0x00,0xff,0x0c,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,
+0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,
+0x24,0x27,0x28,0x05,0x06,0x01,0x01,0x01,0x00,0xd0,0x00,0x08,0x0a,0x0a,0x0a,0x0a,
+0x0c,0x0c,0x0c,0x0c,0x09,0x0c,0x09,0x01,0x00,0xa1,0x00,0x00,0x0d,0x0d,0x0d,0x0d,
+0x17,0x00,0x00,0x1a,0x01,0x00,0x61,0x00,0x1c,0x1d,0x1d,0x1d,0x1d,0x31,0x00,0x20,
+0x1f,0x21,0x01,0x00,0x02,0x3d,0x00,0x50,0x24,0x1b,0x24,0x06,0x1a,0x02,0x00,0x22,
+0x08,0x1c,0x02,0x00,0x64,0x09,0x00,0x09,0x00,0x0a,0x1d,0x02,0x00,0x04,0x64,0x00,
+0x55,0x0c,0x1f,0x00,0x00,0x0c,0x02,0x00,0x83,0x00,0x00,0x0d,0x00,0x0e,0x00,0x00,
+0x0f,0x02,0x00,0x00,0x1f,0x00,0x00,0x02,0x00,0x00,0xbc,0x07,0x40,0x21,0x09,0x21,
+0x09,0x5b,0x00,0x11,0x22,0x02,0x00,0x03,0x01,0x00,0x11,0x13,0x02,0x00,0x17,0x0d,
+0x02,0x00,0x70,0x15,0x00,0x17,0x24,0x17,0x18,0x27,0x02,0x00,0x04,0x30,0x01,0x20,
+0x03,0x02,0x2b,0x01,0x4a,0x06,0x07,0x06,0x08,0xe0,0x00,0x00,0x90,0x00,0x60,0x00,
+0x0b,0x00,0x00,0x00,0x0b,0x83,0x00,0x01,0x08,0x00,0xf1,0x08,0x0b,0x00,0x0d,0x0e,
+0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,
+0x17,0x18,0x17,0x2e,0x00,0xfd,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,
+0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x30,0x01,0x11,0x0a,0x01,0x00,0x26,0x24,
+0x0b,0x12,0x00,0x10,0x0b,0x01,0x00,0xa1,0x00,0x0b,0x0f,0x0f,0x0f,0x0f,0x13,0x00,
+0x00,0x16,0x01,0x00,0x20,0x25,0x17,0x01,0x00,0x02,0x53,0x00,0x02,0x41,0x01,0xa0,
+0x26,0x1e,0x1e,0x1e,0x1e,0x1f,0x00,0x1f,0x0a,0x16,0x02,0x00,0x22,0x0b,0x17,0x02,
+0x00,0x10,0x00,0x24,0x00,0x14,0x17,0x02,0x00,0x05,0x16,0x00,0x0b,0x01,0x00,0x1b,
+0x0c,0x10,0x00,0x10,0x19,0x02,0x00,0x51,0x19,0x00,0x00,0x0b,0x1a,0x02,0x00,0x03,
+0x30,0x00,0x22,0x0d,0x1c,0x02,0x00,0x10,0x0e,0x5e,0x01,0x36,0x00,0x0f,0x1e,0x02,
+0x00,0xc0,0x11,0x00,0x13,0x1f,0x13,0x14,0x22,0x14,0x22,0x14,0x22,0x00,0xa5,0x0f,
+0xff,0x50,0xff,0xf5,0x0f,0xff,0x40,0xff,0xf4,0x05,0x00,0xf2,0x0f,0xf3,0x0f,0xff,
+0x30,0xff,0xf3,0x0e,0xff,0x30,0xef,0xf3,0x0e,0xff,0x20,0xef,0xf2,0x0e,0xff,0x20,
+0xdf,0xf2,0x0d,0xff,0x20,0xdf,0xf1,0x0c,0xff,0x10,0x00,0x01,0x00,0xf1,0x03,0x05,
 0xca,0x11,0xff,0xf8,0x1f,0xff,0x90,0x8f,0xd2,0x9f,0xd0,0x0d,0xf9,0x9f,0xe0,0x0d,
 0xf9,0x08,0x00,0xf0,0x11,0xc0,0x0d,0xf8,0x9f,0xb0,0x0d,0xf7,0x9f,0xa0,0x0d,0xf5,
 0x9f,0x80,0x0d,0xf4,0x9f,0x70,0x0d,0xf3,0x9f,0x60,0x0d,0xf2,0x00,0x00,0x00,0x03,
@@ -167,1359 +225,2007 @@ static const uint8_t lz4FontData[] ={
 0x41,0xf3,0x09,0xff,0xe0,0x37,0x00,0x30,0xf0,0x03,0xff,0x7e,0x00,0xe1,0x5f,0xff,
 0xa0,0x00,0xaf,0xff,0xe8,0x55,0x7c,0xff,0xff,0x20,0x00,0x0b,0xcf,0x00,0x00,0x9b,
 0x01,0x10,0x7e,0xbf,0x01,0x01,0x44,0x00,0x42,0x48,0xff,0xc5,0x10,0xfd,0x00,0x03,
-0x7c,0x00,0x0d,0x09,0x00,0x44,0x06,0xcf,0xfd,0x70,0x27,0x0c,0x43,0xbf,0xff,0xff,
-0xfd,0x86,0x02,0x63,0x08,0xff,0xa4,0x49,0xff,0xa0,0xd7,0x00,0xe1,0xfb,0x00,0x00,
-0x8f,0xf1,0x00,0x00,0x0d,0x91,0x00,0x00,0x1f,0xf5,0x00,0xff,0x01,0x61,0x8f,0xe0,
-0x00,0x00,0x2f,0xf4,0x10,0x00,0x32,0x03,0xff,0x50,0xef,0x01,0x21,0x2f,0xf4,0x0a,
-0x02,0x72,0x00,0x0f,0xf9,0x00,0x00,0x6f,0xf2,0x1c,0x02,0x71,0x09,0xff,0x71,0x15,
-0xff,0xc0,0x02,0x6d,0x02,0x62,0x01,0xdf,0xff,0xff,0xfe,0x20,0xee,0x01,0x00,0x72,
-0x02,0x43,0xa2,0x00,0x5f,0xf2,0x8c,0x00,0x43,0x20,0x00,0x01,0xef,0x98,0x00,0x03,
-0xed,0x01,0x04,0x01,0x00,0x00,0xab,0x02,0x13,0x21,0x0c,0x00,0x62,0xdf,0xa0,0x04,
-0xcf,0xff,0xd5,0xa0,0x00,0x71,0xfe,0x10,0x5f,0xff,0xff,0xff,0x70,0x3c,0x01,0x71,
-0xf5,0x01,0xff,0xd4,0x03,0xcf,0xf2,0xec,0x01,0x71,0xb0,0x07,0xff,0x20,0x00,0x1f,
-0xf8,0x26,0x01,0x10,0x20,0x49,0x00,0x20,0x0b,0xfb,0x8e,0x02,0x91,0xf7,0x00,0x0a,
-0xfb,0x00,0x00,0x0a,0xfc,0x00,0x0d,0x03,0x04,0x0c,0x00,0x10,0x06,0xfb,0x02,0x12,
-0xfd,0xc1,0x02,0x90,0x0b,0xf9,0x00,0x00,0x05,0xff,0x40,0x00,0x2f,0xfb,0x01,0x00,
-0xaf,0x00,0x53,0xef,0xf6,0x35,0xef,0xf1,0x7a,0x00,0x32,0x3e,0xff,0xff,0x8c,0x01,
-0x00,0xad,0x00,0x30,0x9e,0xfe,0xa2,0x07,0x00,0x42,0x8c,0xff,0xea,0x30,0x12,0x00,
-0x51,0x4e,0xff,0xff,0xff,0xf8,0x0a,0x00,0x43,0x02,0xff,0xff,0xec,0x96,0x00,0x71,
-0x0a,0xff,0xf5,0x00,0x0a,0xff,0xf0,0xa9,0x02,0x00,0x12,0x00,0x11,0xdf,0x35,0x03,
-0x66,0x1f,0xff,0x30,0x00,0x00,0xbf,0x0b,0x00,0x22,0xdf,0xf2,0x39,0x02,0x52,0x70,
-0x00,0x05,0xff,0xd0,0x79,0x01,0x32,0xe1,0x00,0x7f,0x6c,0x00,0x51,0x01,0xef,0xfb,
-0x2b,0xff,0x08,0x03,0x00,0xea,0x01,0x44,0xff,0xfe,0x40,0x00,0x3a,0x01,0x25,0xb1,
-0x00,0x79,0x00,0x03,0x15,0x00,0x00,0xcc,0x02,0x50,0xe2,0x00,0x00,0x03,0x32,0x8f,
-0x02,0xf0,0x12,0xa2,0xdf,0xfd,0x10,0x00,0x3f,0xfb,0x00,0x03,0xff,0xf9,0x00,0x2e,
-0xff,0xc0,0x00,0x4f,0xfa,0x00,0x0c,0xff,0xc0,0x00,0x04,0xff,0xfa,0x00,0x7f,0xf8,
-0x00,0x1f,0xff,0x40,0xe5,0x02,0x70,0x70,0xcf,0xf5,0x00,0x3f,0xff,0x10,0x50,0x00,
-0x72,0xf8,0xff,0xf0,0x00,0x2f,0xff,0x10,0x02,0x02,0x10,0x90,0xb8,0x04,0x00,0x68,
-0x03,0x71,0xff,0xff,0x10,0x00,0x0b,0xff,0xd1,0x94,0x00,0x10,0xfd,0xfc,0x02,0x40,
-0xfd,0x40,0x00,0x03,0x21,0x00,0x00,0x63,0x00,0x50,0xfe,0xcc,0xef,0xff,0xfd,0x0b,
-0x03,0x20,0x05,0xef,0x4e,0x03,0xf1,0x11,0x70,0xaf,0xff,0x20,0x00,0x00,0x06,0xbe,
-0xff,0xea,0x60,0x00,0x1e,0xff,0xd0,0x1b,0xb5,0x2f,0xf7,0x2f,0xf7,0x2f,0xf6,0x2f,
-0xf5,0x2f,0xf4,0x2f,0xf3,0x3f,0xf2,0x3f,0x48,0x01,0x60,0x81,0x00,0x00,0x00,0x0b,
-0xf5,0xa5,0x01,0x40,0xf6,0x00,0x00,0x0a,0x14,0x01,0x20,0x6f,0xfa,0xe6,0x00,0x40,
-0xe0,0x00,0x00,0x09,0x21,0x02,0x60,0x2f,0xfe,0x00,0x00,0x00,0x9f,0x7f,0x01,0x00,
-0x78,0x01,0x10,0x04,0x12,0x03,0x10,0x09,0x26,0x00,0x10,0x0d,0xb1,0x00,0x10,0x1f,
-0xa0,0x00,0x20,0x4f,0xfe,0xbf,0x03,0x00,0xc5,0x01,0x20,0x8f,0xfb,0x2c,0x00,0x64,
-0xfa,0x00,0x00,0x00,0xaf,0xf9,0x05,0x00,0x24,0x9f,0xfa,0x05,0x00,0x20,0x7f,0xfb,
-0x28,0x00,0x11,0xfd,0x58,0x03,0x01,0x80,0x01,0x10,0x20,0xce,0x03,0x10,0x50,0xca,
-0x00,0x10,0x90,0xca,0x00,0x10,0xd0,0x4d,0x02,0x10,0xf3,0x29,0x00,0x11,0xf9,0x7e,
-0x01,0x01,0x2e,0x02,0x23,0x80,0x00,0x8f,0x01,0x21,0x3f,0xfc,0x51,0x01,0x10,0x90,
-0x67,0x00,0x10,0xf7,0x1b,0x00,0x01,0xaf,0x01,0x30,0x30,0x07,0x10,0xb5,0x01,0xc0,
-0xe3,0x00,0x00,0x00,0x1e,0xfe,0x20,0x00,0x00,0x02,0xef,0xd0,0x98,0x01,0x10,0xfa,
-0xd5,0x00,0x00,0xa1,0x00,0x11,0x02,0x56,0x00,0x20,0xbf,0xf6,0x41,0x00,0x23,0xfd,
-0x00,0xb6,0x00,0x10,0x09,0x46,0x00,0x11,0x04,0xb5,0x03,0x20,0xff,0xf2,0x60,0x00,
-0x14,0xf6,0xad,0x00,0x01,0xc1,0x00,0x20,0x7f,0xfd,0xa8,0x00,0x11,0xfe,0xe0,0x01,
-0x00,0xec,0x02,0x10,0xff,0x0a,0x00,0x01,0xe4,0x00,0x0a,0xe9,0x00,0x20,0xaf,0xf8,
-0x3c,0x00,0x10,0xf5,0x46,0x00,0x00,0x1a,0x01,0x00,0x6a,0x00,0x10,0x09,0xb0,0x00,
-0x10,0x0e,0xd9,0x00,0x32,0x4f,0xfb,0x00,0x53,0x02,0x60,0x03,0xff,0xb0,0x00,0x00,
-0x0c,0x13,0x00,0x50,0x7f,0xf7,0x00,0x00,0x05,0x0e,0x00,0x20,0x2f,0xfc,0xff,0x00,
-0x10,0xb0,0x93,0x04,0x03,0x33,0x02,0x23,0x8f,0xf2,0xe0,0x03,0x12,0x10,0xbc,0x04,
-0x13,0xf1,0x89,0x04,0x00,0x14,0x00,0x10,0x50,0x63,0x05,0xf1,0x0f,0x06,0x21,0xff,
-0xe8,0x26,0xff,0x04,0xaf,0xf8,0x5f,0xff,0xff,0xef,0xfd,0xff,0xff,0xd0,0x49,0xdf,
-0xff,0xff,0xff,0xfd,0x83,0x00,0x00,0x2a,0xff,0xfe,0x72,0x87,0x03,0x21,0xff,0xf2,
-0x4a,0x00,0x11,0xf8,0xb4,0x04,0x30,0x4f,0xfc,0x08,0x8b,0x00,0x30,0x1e,0xff,0x20,
-0xf2,0x00,0x00,0x0c,0x00,0xa2,0x4f,0xfd,0x00,0x00,0x08,0xe0,0x00,0x00,0xad,0x20,
-0x30,0x03,0x02,0x06,0x00,0x24,0x33,0x20,0xf4,0x04,0x1f,0xc0,0x09,0x00,0x26,0xa3,
-0x12,0x22,0x22,0x29,0xff,0xd2,0x22,0x22,0x22,0xaf,0x4b,0x06,0x1e,0xfe,0x09,0x00,
-0x0f,0x63,0x00,0x2c,0x06,0x09,0x00,0x22,0xcf,0xf6,0x03,0x00,0x00,0x79,0x01,0xf0,
-0x08,0xff,0xf2,0x04,0xff,0xd0,0x0a,0xff,0x60,0x3f,0xfd,0x00,0x0a,0xe2,0x00,0x00,
-0x10,0x00,0x4b,0xbb,0xbb,0xbb,0xb2,0x5f,0x3f,0x06,0x01,0x05,0x00,0xa2,0x0b,0xfb,
-0x15,0xff,0xf7,0x6f,0xff,0x70,0xbf,0xc1,0xce,0x05,0x02,0xe0,0x05,0x21,0x9f,0xf3,
-0x07,0x00,0x21,0xef,0xd0,0xd7,0x07,0x02,0x17,0x04,0x12,0x0b,0x79,0x01,0x22,0x1f,
-0xfb,0x7f,0x01,0x12,0xf5,0xd9,0x04,0x21,0xf0,0x00,0x5e,0x06,0x12,0x90,0xe0,0x03,
-0x11,0x30,0x14,0x04,0x12,0xfd,0xf9,0x03,0x12,0xf7,0x9b,0x05,0x12,0xf1,0xb4,0x05,
-0x12,0xb0,0xa1,0x00,0x21,0x50,0x00,0x62,0x02,0x0f,0x6d,0x00,0x44,0x23,0x48,0x81,
-0x2d,0x02,0x40,0x4a,0xdf,0xfe,0xb6,0x77,0x00,0x10,0xbf,0x02,0x02,0xf0,0x05,0x20,
-0x00,0x00,0xcf,0xff,0xfd,0xce,0xff,0xfe,0x20,0x00,0x7f,0xff,0x80,0x00,0x06,0xff,
-0xfa,0x00,0x0e,0xfa,0x01,0x10,0x05,0x1d,0x01,0x11,0xf1,0x90,0x00,0x10,0x80,0xae,
-0x02,0x00,0xb4,0x02,0x10,0x0b,0x4e,0x03,0x00,0xf9,0x02,0x00,0xb5,0x02,0x00,0x61,
-0x07,0x31,0x0e,0xff,0x50,0xc0,0x00,0x23,0xf1,0xff,0xfc,0x04,0x31,0x2f,0xff,0x40,
-0x11,0x00,0x1f,0xf2,0x11,0x00,0x0f,0x22,0xef,0xf5,0x11,0x00,0x31,0x1d,0xff,0x60,
-0x63,0x05,0x41,0xf0,0xbf,0xf8,0x00,0x29,0x03,0x31,0x08,0xff,0xc0,0xcb,0x02,0x20,
-0xb0,0x4f,0xe8,0x00,0x00,0xb5,0x07,0x21,0xef,0xfa,0x4c,0x03,0x40,0x20,0x06,0xff,
-0xf9,0xe4,0x04,0x10,0xa0,0x15,0x07,0x70,0xcc,0xef,0xff,0xe1,0x00,0x00,0x0a,0x1d,
-0x02,0x10,0xd2,0x95,0x00,0x33,0x9d,0xff,0xeb,0x75,0x07,0x20,0x4b,0xc0,0x8d,0x07,
-0x80,0xfd,0x00,0x16,0xcf,0xff,0xff,0xd0,0xaf,0xe4,0x00,0xc0,0x0f,0xff,0xfd,0x78,
-0xff,0xd0,0xfe,0x93,0x00,0x7f,0xfd,0x05,0x68,0x01,0x14,0xd0,0xa5,0x03,0x0f,0x0b,
-0x00,0x4f,0x50,0x06,0xae,0xff,0xeb,0x60,0xa0,0x00,0x13,0xef,0x9f,0x08,0x40,0x5f,
-0xff,0xfe,0xcc,0x9f,0x08,0x10,0x02,0x79,0x05,0x50,0x07,0xff,0xfd,0x00,0x0a,0x8d,
-0x05,0x00,0x9f,0x08,0x04,0xa1,0x05,0x32,0x90,0x3f,0xff,0x6a,0x06,0x32,0xa0,0x4f,
-0xfd,0xcd,0x01,0x03,0xb2,0x07,0x12,0x0b,0xff,0x01,0x03,0xfa,0x04,0x14,0x00,0x12,
-0x05,0x01,0x3e,0x01,0x12,0xf3,0x09,0x00,0x14,0x1d,0xb5,0x08,0x23,0xbf,0xfd,0x75,
-0x07,0x23,0xff,0xe2,0x22,0x04,0x23,0xff,0x30,0x07,0x03,0x14,0xf4,0x7c,0x06,0x22,
-0x50,0x00,0x98,0x09,0x14,0xf7,0xad,0x08,0x12,0x80,0x4d,0x00,0x13,0xef,0xc8,0x08,
-0x13,0x1e,0x79,0x00,0x34,0x01,0xdf,0xfb,0x81,0x00,0x20,0xfc,0xbb,0x01,0x00,0x24,
-0xba,0x0e,0x97,0x03,0x16,0x0e,0xa0,0x03,0x40,0x07,0xbe,0xff,0xda,0xdb,0x01,0x10,
-0x5e,0x10,0x00,0x10,0xc2,0xd2,0x00,0x00,0xe9,0x00,0x51,0xe1,0x00,0x3f,0xff,0xc3,
-0xb5,0x01,0x31,0x0a,0xff,0xd0,0x76,0x00,0x31,0x10,0xff,0xf5,0xff,0x08,0x41,0xf5,
-0x1d,0xdd,0x20,0x8f,0x09,0x03,0xd5,0x00,0x01,0x45,0x05,0x04,0x41,0x07,0x01,0x6d,
-0x00,0x11,0xb0,0x7d,0x00,0x31,0x5c,0xff,0xd1,0x6c,0x02,0x01,0x20,0x07,0x00,0x8b,
-0x07,0x20,0xff,0xd3,0x18,0x00,0x25,0x1c,0xcc,0x70,0x09,0x14,0x18,0x09,0x00,0x14,
-0x05,0x07,0x01,0x14,0x0b,0x07,0x01,0x42,0x7f,0xfc,0x13,0x33,0x49,0x07,0x32,0xd4,
-0xff,0xf0,0x11,0x00,0x32,0x2f,0xff,0x30,0x22,0x00,0x21,0xdf,0xfc,0x31,0x03,0x20,
-0xf4,0x05,0x56,0x09,0x30,0x05,0xff,0xfc,0x83,0x07,0x70,0xdc,0xcf,0xff,0xfe,0x10,
-0x00,0x07,0xc3,0x00,0x20,0xfc,0x10,0x5d,0x0a,0x34,0xef,0xfd,0xa4,0xb4,0x08,0x34,
-0xef,0xfd,0x00,0xab,0x07,0x04,0x0a,0x00,0x15,0x3f,0x0a,0x00,0x34,0xdf,0xff,0xfd,
-0x63,0x09,0x04,0x28,0x00,0x43,0x2f,0xfe,0x7f,0xfd,0xab,0x0a,0x33,0xf5,0x6f,0xfd,
-0x7d,0x01,0x12,0xb0,0x0a,0x00,0x00,0x99,0x07,0x03,0x0a,0x00,0x21,0xbf,0xf6,0xd4,
-0x06,0x00,0xa4,0x00,0x12,0xc0,0x0a,0x00,0x00,0x76,0x05,0x03,0x0a,0x00,0x23,0xaf,
-0xf8,0xf2,0x06,0x01,0x48,0x08,0x21,0x6f,0xfd,0xd8,0x06,0x13,0x30,0x0a,0x00,0x23,
-0x9f,0xf9,0x10,0x07,0x02,0x8b,0x06,0x00,0x0a,0x00,0x14,0x0d,0x8e,0x0b,0x25,0xf6,
-0x1f,0x0a,0x00,0x11,0x0b,0xb4,0x01,0x42,0xdf,0xff,0xbb,0xb4,0x8e,0x00,0x03,0x78,
-0x00,0x0f,0x0a,0x00,0x1d,0x12,0x2f,0x4f,0x00,0x22,0x00,0x03,0x08,0x00,0x33,0xf0,
-0x00,0x5f,0x11,0x00,0xb4,0x07,0xff,0xa1,0x11,0x11,0x11,0x11,0x10,0x00,0x8f,0xf8,
-0x74,0x02,0x13,0x60,0xf8,0x00,0x14,0xf3,0x42,0x0b,0x03,0x80,0x0a,0x31,0xff,0xf2,
-0x9d,0x25,0x02,0x02,0x9d,0x00,0x14,0xa0,0x4c,0x00,0xd0,0xb0,0x00,0x4f,0xff,0xc4,
-0x10,0x27,0xef,0xff,0x70,0x01,0x59,0x70,0x81,0x02,0x14,0xfe,0xd0,0x01,0x12,0xf5,
-0x09,0x00,0x14,0x0d,0xdf,0x0a,0x2b,0x9f,0xfb,0xd6,0x05,0x42,0x7f,0xfc,0x17,0x76,
-0x94,0x01,0x12,0xb2,0xe1,0x01,0x51,0xcf,0xf8,0x0e,0xff,0x40,0xaf,0x00,0x31,0x40,
-0x9f,0xfd,0xe9,0x01,0xf3,0x02,0xe0,0x01,0xff,0xfc,0x20,0x00,0x1a,0xff,0xf6,0x00,
-0x05,0xff,0xff,0xdc,0xdf,0xff,0xfa,0x8e,0x03,0x01,0x35,0x02,0x42,0x7b,0xef,0xed,
-0x92,0xf6,0x02,0x21,0x7b,0xde,0xec,0x0c,0x12,0x2b,0x6d,0x06,0x00,0x4f,0x0c,0x21,
-0xfe,0xc0,0x08,0x00,0x22,0xe8,0x30,0xb1,0x01,0x02,0x9f,0x09,0x13,0x0c,0x15,0x03,
-0x33,0x03,0xff,0xe0,0x93,0x00,0x15,0xf6,0xe5,0x00,0x30,0x59,0xbc,0xa6,0xa2,0x02,
-0x21,0xd3,0xdf,0xd7,0x09,0x21,0x5f,0xfe,0xdd,0x00,0xb1,0x50,0x07,0xff,0xff,0xf7,
-0x20,0x17,0xff,0xff,0x10,0x8f,0xcc,0x09,0x51,0xff,0xf9,0x09,0xff,0xf3,0x29,0x02,
-0x32,0xf0,0xaf,0xfb,0xf1,0x02,0x32,0x3a,0xff,0x90,0x02,0x03,0x22,0xaf,0xfa,0x63,
-0x00,0x12,0x79,0xfc,0x02,0x42,0xbf,0xf7,0x6f,0xfe,0xff,0x00,0x32,0x63,0xff,0xf2,
-0x3d,0x0c,0x31,0x0d,0xff,0x90,0x95,0x00,0x02,0x4e,0x0a,0xf0,0x02,0x1e,0xff,0x90,
-0x00,0xdf,0xff,0x60,0x00,0x3d,0xff,0xf2,0x00,0x02,0xef,0xff,0xec,0xef,0x31,0x01,
-0x10,0x02,0xda,0x07,0x10,0xe5,0x2f,0x00,0x64,0x5b,0xef,0xec,0x71,0x00,0x00,0x44,
-0x07,0x15,0xfa,0x09,0x00,0x21,0x7c,0xcc,0x01,0x00,0x04,0x86,0x0a,0x14,0x02,0xcb,
-0x00,0x14,0x09,0x67,0x01,0x14,0x1f,0xb1,0x01,0x24,0x7f,0xfa,0xfd,0x02,0x14,0xf3,
-0x92,0x0a,0x14,0xb0,0x93,0x01,0x13,0x40,0x48,0x04,0x14,0xfd,0x91,0x0d,0x03,0x4f,
-0x00,0x00,0x4f,0x0d,0x03,0x08,0x02,0x03,0x4f,0x00,0x02,0x86,0x0a,0x04,0xc7,0x09,
-0x02,0xf4,0x0c,0x0b,0xc8,0x01,0x14,0x0e,0x33,0x0d,0x02,0xf2,0x00,0x02,0xf8,0x05,
-0x03,0x05,0x02,0x03,0xaf,0x0b,0x14,0x0c,0xd5,0x03,0x14,0x3f,0xff,0x04,0x15,0xaf,
-0xff,0x04,0x13,0xf4,0x35,0x00,0x22,0x04,0xad,0x6f,0x05,0x20,0x01,0xcf,0xf8,0x05,
-0x10,0x30,0x11,0x05,0x21,0xff,0xcc,0x0e,0x0e,0x11,0xaf,0xdd,0x06,0x51,0xfd,0x00,
-0x01,0xff,0xf8,0x87,0x04,0x42,0x40,0x05,0xff,0xf0,0x5a,0x02,0x32,0x06,0xff,0xd0,
-0x6f,0x05,0x13,0x05,0x09,0x00,0x41,0x90,0x02,0xff,0xf1,0x93,0x00,0x31,0x60,0x00,
-0xbf,0x78,0x0a,0x90,0xfe,0x00,0x00,0x2e,0xff,0xb4,0x00,0x39,0xff,0x8f,0x09,0x10,
-0xdf,0xef,0x04,0x11,0x50,0x87,0x00,0x11,0xff,0xa0,0x02,0x11,0x08,0x8d,0x06,0x10,
-0xa0,0x63,0x05,0x71,0x60,0x00,0x05,0xef,0xfa,0x00,0x03,0xde,0x00,0x62,0x2e,0xff,
-0x60,0x0a,0xff,0xa0,0x0d,0x06,0x02,0xde,0x00,0x67,0x02,0xff,0xf2,0x0f,0xff,0x30,
-0x05,0x0e,0x00,0x07,0x07,0x02,0xdb,0x02,0x61,0x05,0xff,0xf0,0x08,0xff,0xf2,0x90,
-0x00,0x20,0xb0,0x01,0x3d,0x02,0x61,0x03,0xcf,0xff,0x30,0x00,0x4f,0x91,0x0b,0x13,
-0xf7,0xb0,0x02,0x01,0x56,0x03,0x51,0x05,0xae,0xff,0xeb,0x71,0x89,0x01,0x30,0xbe,
-0xfe,0xc7,0x56,0x01,0x12,0x2d,0x8f,0x00,0x00,0x8e,0x00,0x10,0xde,0x78,0x0e,0x30,
-0x0d,0xff,0xe5,0xa4,0x00,0x40,0x10,0x06,0xff,0xf3,0x86,0x0b,0x42,0xfa,0x00,0xbf,
-0xf9,0x45,0x01,0x02,0x7b,0x00,0x32,0x0e,0xff,0x51,0x9f,0x01,0x22,0xaf,0xf9,0x67,
-0x06,0x14,0x07,0x39,0x03,0x22,0x6f,0xfc,0x22,0x00,0x51,0x06,0xff,0xd0,0xdf,0xf8,
-0xd0,0x01,0x41,0xfd,0x07,0xff,0xf2,0x3a,0x06,0x90,0xc0,0x1e,0xff,0xe4,0x00,0x02,
-0xbf,0xff,0xfc,0xbe,0x06,0x51,0xce,0xff,0xfc,0xff,0xb0,0xfd,0x03,0x95,0xe5,0x8f,
-0xf9,0x00,0x00,0x29,0xdf,0xfd,0x81,0xf1,0x03,0x04,0x26,0x02,0x24,0x3f,0xfe,0x02,
-0x02,0x19,0x90,0x99,0x05,0x01,0xc1,0x07,0x01,0xd4,0x05,0x10,0xfd,0x39,0x01,0x12,
-0xde,0x66,0x05,0x00,0xa2,0x02,0x12,0xe7,0xdf,0x10,0x20,0xc9,0x50,0xdb,0x05,0xaf,
-0xfa,0x08,0xff,0xf5,0x8f,0xff,0x51,0xcf,0xa0,0x00,0x01,0x00,0x0a,0x00,0x28,0x00,
-0xc0,0xf4,0x8f,0xff,0x52,0xcf,0xa0,0x00,0x6e,0xe5,0x00,0xff,0xfe,0x03,0x00,0x3f,
-0x6e,0xe5,0x00,0x01,0x00,0x11,0x21,0x9f,0xfa,0x03,0x00,0xf2,0x01,0xf9,0x00,0x9f,
-0xf8,0x00,0xcf,0xf5,0x01,0xff,0xf0,0x07,0xff,0x90,0x1f,0xff,0x10,0x14,0x0c,0x03,
-0xea,0x02,0x02,0x98,0x06,0x21,0x6e,0xfa,0x26,0x01,0x01,0xe1,0x01,0x50,0x01,0x8e,
-0xff,0xff,0xf7,0x70,0x06,0x90,0xff,0xfe,0x82,0x00,0x02,0x9f,0xff,0xff,0xd6,0x3f,
-0x0b,0x30,0xff,0xfa,0x40,0x67,0x04,0x22,0xfe,0x81,0x6d,0x0f,0x22,0x50,0x00,0x14,
-0x02,0x20,0xe7,0x10,0xf3,0x01,0x40,0xaf,0xff,0xff,0xa3,0x11,0x00,0x41,0x29,0xff,
-0xff,0xfd,0x99,0x02,0x61,0x9f,0xff,0xff,0xf9,0x20,0x00,0x45,0x00,0x11,0xfa,0x0c,
-0x01,0x13,0x7e,0x51,0x04,0x23,0x07,0xea,0x79,0x00,0x13,0x30,0x59,0x05,0x14,0xf5,
-0x08,0x00,0x21,0x4e,0xee,0x01,0x00,0x1f,0xe4,0xd5,0x00,0x0d,0x04,0x28,0x00,0x0c,
-0x40,0x00,0x23,0x86,0x00,0x2f,0x03,0x22,0xe8,0x10,0x08,0x00,0x02,0x82,0x00,0x63,
-0x00,0x6e,0xff,0xff,0xfa,0x30,0xc5,0x10,0x27,0xfc,0x40,0xa6,0x00,0x00,0x40,0x10,
-0x31,0xff,0xfe,0x70,0xcd,0x03,0x13,0x9f,0x26,0x04,0x12,0x3a,0x08,0x00,0x81,0x6c,
-0xff,0xff,0xe3,0x00,0x00,0x02,0x8e,0xfc,0x00,0xc2,0x05,0xbf,0xff,0xff,0xc5,0x00,
-0x00,0x18,0xef,0xff,0xff,0xb4,0xc7,0x01,0x12,0xa2,0x60,0x00,0x02,0x6a,0x0a,0x13,
-0xae,0xda,0x07,0x24,0x20,0x00,0x64,0x0f,0x50,0x7c,0xef,0xec,0x81,0x00,0x87,0x05,
-0x12,0xff,0x8e,0x05,0x01,0x42,0x03,0xa0,0xef,0xfe,0x61,0x00,0x5e,0xff,0xe0,0x6f,
-0xff,0x20,0x98,0x03,0x31,0x49,0xff,0xb0,0xfd,0x03,0x21,0x46,0x63,0xbd,0x05,0x12,
-0x80,0x5b,0x04,0x13,0xf7,0xf8,0x08,0x12,0x40,0x5d,0x01,0x17,0xe0,0x1e,0x06,0x32,
-0x05,0xff,0xfa,0xc7,0x08,0x12,0xfc,0x0b,0x04,0x12,0xfc,0x3e,0x04,0x12,0xfc,0x68,
-0x10,0x02,0x2b,0x04,0x02,0x53,0x0a,0x02,0xa4,0x0d,0x00,0xde,0x00,0x2f,0x88,0x40,
-0x47,0x01,0x08,0x38,0x02,0xbb,0x30,0x43,0x09,0x13,0x0c,0x1e,0x05,0x15,0x4e,0x5a,
-0x02,0x32,0x03,0x8c,0xef,0xa9,0x02,0x02,0xdc,0x02,0x11,0xdf,0xc8,0x00,0x13,0x81,
-0x3d,0x00,0x64,0xcf,0xff,0xea,0x76,0x68,0x9d,0xd7,0x0f,0x31,0x3e,0xff,0xc4,0x1c,
-0x12,0x02,0x3d,0x01,0x14,0x03,0x72,0x05,0x31,0x2c,0xff,0x40,0xe7,0x07,0x14,0x30,
-0x3b,0x05,0x10,0xe1,0x70,0x00,0x14,0xf3,0x53,0x00,0x24,0x1e,0xf9,0xec,0x0b,0x21,
-0x03,0x43,0xe2,0x00,0x42,0x10,0x00,0x0d,0xfd,0x86,0x02,0x92,0xfa,0x10,0x00,0x00,
-0xdf,0x70,0x00,0x4f,0xf5,0xd7,0x0f,0x00,0x8d,0x01,0x21,0x8f,0xc0,0xa7,0x13,0xd2,
-0x0a,0xff,0xb3,0x01,0x9f,0xf4,0x00,0x00,0x3f,0xf0,0x00,0xff,0x90,0x40,0x0e,0x70,
-0x6f,0xf3,0x00,0x00,0x0f,0xf3,0x04,0x6d,0x00,0xa0,0xdf,0xf1,0x00,0x00,0x7f,0xf2,
-0x00,0x00,0x0e,0xf6,0x7e,0x13,0x10,0x03,0x58,0x01,0x60,0x9f,0xf0,0x00,0x00,0x0c,
-0xf7,0x53,0x14,0x10,0x09,0x26,0x01,0xc1,0xaf,0xf0,0x00,0x00,0x0b,0xf8,0x0c,0xfc,
-0x00,0x00,0x0d,0xfe,0x50,0x11,0x00,0x0f,0x00,0x00,0x97,0x13,0x20,0x0f,0xfb,0x50,
-0x01,0x10,0xc0,0x0f,0x00,0x23,0x0e,0xf9,0x99,0x0c,0x20,0xef,0xa0,0x3c,0x00,0x00,
-0x0f,0x00,0x10,0x4f,0x9b,0x01,0x00,0x71,0x00,0x42,0x0e,0xf5,0x0e,0xf9,0x6c,0x0c,
-0x01,0x84,0x12,0x80,0x1f,0xf2,0x0d,0xfb,0x00,0x00,0x4f,0xf8,0x62,0x04,0x00,0x14,
-0x10,0x32,0xe0,0x0b,0xfc,0xb9,0x0e,0x10,0x1e,0x1e,0x00,0x41,0xdf,0x80,0x09,0xff,
-0xf5,0x05,0x40,0x01,0xcf,0xff,0xc0,0xb7,0x0e,0x00,0xb4,0x11,0xa2,0x08,0xff,0xfb,
-0xae,0xfb,0x9f,0xf8,0x24,0xaf,0xf6,0x43,0x00,0x52,0xdf,0xff,0xff,0xc1,0x1e,0x0f,
-0x12,0xc0,0xcf,0xe0,0x00,0x00,0x08,0xef,0xd7,0x00,0x02,0xae,0xfe,0xa3,0xac,0x04,
-0x19,0xf6,0xb2,0x01,0x38,0x0d,0xfe,0x10,0x0f,0x00,0x14,0x04,0x55,0x06,0x04,0x1d,
-0x0f,0x19,0xfc,0x1f,0x00,0x12,0x09,0x6d,0x04,0x25,0x03,0x70,0xe9,0x13,0x64,0xfb,
-0x75,0x44,0x69,0xdf,0xf0,0xff,0x01,0x02,0x27,0x07,0x15,0xc1,0xb5,0x02,0x56,0x6a,
-0xde,0xff,0xeb,0x73,0x3f,0x00,0x16,0xef,0x7c,0x00,0x03,0x74,0x02,0x03,0xeb,0x04,
-0x04,0x96,0x06,0x01,0xdf,0x08,0x15,0x80,0x3c,0x09,0x13,0xfb,0x5e,0x07,0x00,0xe7,
-0x01,0x45,0xf4,0xcf,0xf4,0x00,0x74,0x07,0x13,0x6f,0x5c,0x07,0x00,0x5e,0x0f,0x04,
-0x71,0x07,0x00,0xfc,0x0f,0x05,0x4e,0x05,0x26,0x4f,0xfc,0xcb,0x00,0x10,0xaf,0xe6,
-0x15,0x13,0xf2,0x3d,0x07,0x20,0xf1,0x00,0xb8,0x04,0x05,0x8f,0x07,0x03,0x6e,0x05,
-0x01,0x0b,0x11,0x03,0x97,0x07,0x12,0x2f,0xfd,0x10,0x11,0xa0,0xff,0x00,0x13,0xfa,
-0x35,0x00,0x00,0xbd,0x00,0x10,0xfe,0x22,0x04,0x01,0x87,0x02,0x13,0x04,0x0e,0x08,
-0x12,0xfc,0xbd,0x00,0x02,0x01,0x00,0x15,0x30,0x80,0x0b,0x01,0x43,0x0b,0x03,0xc1,
-0x0a,0x10,0x05,0xc3,0x00,0x02,0x15,0x06,0x00,0xb9,0x0b,0x00,0xc9,0x06,0x05,0x81,
-0x07,0x12,0x09,0xe1,0x12,0x01,0xda,0x0b,0x16,0x0e,0xa1,0x0c,0x44,0x70,0x5f,0xff,
-0x20,0x19,0x01,0x20,0xd0,0x0f,0x5b,0x00,0x20,0xed,0xa5,0x3d,0x00,0x02,0x2e,0x0c,
-0x40,0x40,0x00,0x0f,0xff,0x88,0x00,0x00,0xe9,0x12,0x21,0xff,0xf5,0x21,0x03,0x13,
-0xfe,0xa1,0x12,0x00,0xd6,0x03,0x22,0xff,0xf5,0x0b,0x01,0x12,0x90,0x13,0x00,0x00,
-0x86,0x07,0x22,0xff,0xf5,0x95,0x00,0x13,0xa0,0x13,0x00,0x23,0xff,0xf7,0x13,0x00,
-0x31,0xaf,0xff,0x10,0x13,0x00,0x43,0x15,0xcf,0xff,0x50,0x5f,0x00,0x10,0xfd,0x5f,
-0x00,0x04,0x95,0x03,0x83,0xff,0xfd,0xcc,0xcc,0xcd,0xff,0xff,0xe4,0x5f,0x00,0x32,
-0x3c,0xff,0xf2,0x39,0x00,0x00,0x6a,0x07,0x03,0x4c,0x00,0x05,0x94,0x0c,0x33,0x01,
-0xff,0xf5,0x13,0x00,0x01,0xe5,0x17,0x02,0x13,0x00,0x13,0xf4,0x13,0x00,0x31,0x6f,
-0xff,0x20,0x13,0x00,0x00,0x0a,0x13,0x02,0x13,0x00,0x10,0x5e,0xab,0x00,0x40,0xfe,
-0xdd,0xdd,0xde,0x4c,0x0a,0x03,0x72,0x00,0x13,0xf7,0xe4,0x00,0x02,0xa5,0x07,0x51,
-0x00,0x49,0xdf,0xfe,0xc9,0x4f,0x01,0x11,0x3d,0x7d,0x17,0x12,0x10,0xd3,0x13,0x11,
-0xef,0xd6,0x13,0x40,0x5f,0xff,0xf7,0x20,0xf9,0x00,0x20,0x10,0x01,0x7d,0x0f,0x00,
-0xac,0x04,0x22,0x90,0x09,0x59,0x01,0x10,0x08,0xae,0x07,0x12,0x80,0x7f,0x00,0x14,
-0xf6,0x49,0x01,0x33,0xcf,0xf9,0x9f,0x6a,0x09,0x34,0x58,0x86,0xcf,0x3b,0x02,0x04,
-0x96,0x01,0x00,0xdb,0x01,0x06,0x0a,0x00,0x1f,0xf7,0x0a,0x00,0x09,0x06,0x32,0x00,
-0x06,0x46,0x00,0x04,0x5a,0x00,0x53,0x47,0x75,0x5f,0xff,0x10,0x6e,0x00,0x15,0x1f,
-0x82,0x00,0x33,0x09,0xff,0xf1,0x96,0x00,0x12,0x01,0x4a,0x16,0x81,0x3f,0xff,0x90,
-0x00,0x5f,0xff,0xe6,0x00,0xbe,0x00,0x00,0xd2,0x00,0x31,0xfe,0xdf,0xff,0x68,0x0e,
-0x14,0x4d,0xe6,0x00,0x81,0x00,0x00,0x5a,0xdf,0xfe,0xc8,0x20,0x00,0x17,0x01,0x02,
-0x03,0x01,0x12,0x0f,0x6e,0x02,0x21,0x30,0x00,0xfc,0x01,0x11,0xef,0x2b,0x01,0x01,
-0x48,0x01,0x43,0x27,0xef,0xff,0x80,0x9e,0x01,0x32,0x1c,0xff,0xf4,0x0a,0x00,0x00,
-0x7e,0x08,0x04,0x0a,0x00,0x13,0x2f,0x1b,0x0f,0x00,0x4b,0x02,0x12,0xc0,0x0a,0x00,
-0x00,0x30,0x09,0x03,0x0a,0x00,0x10,0x01,0x4c,0x09,0x12,0x50,0x9a,0x02,0x14,0xf6,
-0x0a,0x00,0x24,0xef,0xf7,0x0a,0x00,0x1e,0xdf,0x0a,0x00,0x07,0x1e,0x00,0x05,0x32,
-0x00,0x15,0x02,0xe7,0x01,0x01,0x2a,0x09,0x12,0x50,0x6d,0x02,0x04,0x6e,0x00,0x33,
-0x3f,0xff,0x60,0x0a,0x00,0x25,0xdf,0xfe,0xaa,0x00,0x12,0xf5,0x0a,0x00,0x21,0x38,
-0xff,0xbe,0x00,0x31,0xed,0xdd,0xef,0x2e,0x16,0x07,0xe6,0x00,0x00,0xfa,0x00,0x16,
-0xc8,0xfa,0x00,0x37,0xff,0xff,0xf1,0x09,0x00,0x02,0xab,0x07,0x24,0xe0,0x0f,0xf7,
-0x0a,0x0f,0x09,0x00,0x2e,0x03,0x7e,0x02,0x07,0x09,0x00,0x6f,0xed,0xdd,0xdd,0xdd,
-0xdd,0xd5,0x5a,0x00,0x2f,0x0e,0x09,0x00,0x01,0x5a,0x00,0x24,0xdd,0xd3,0xcf,0x00,
-0x1d,0xf3,0x09,0x00,0x23,0xd0,0xff,0x8a,0x03,0x04,0xe9,0x00,0x3b,0xb0,0xff,0xf5,
-0x46,0x00,0x0f,0x11,0x00,0x21,0x11,0xfe,0x78,0x00,0x23,0x10,0x0f,0x46,0x01,0x13,
-0x00,0x66,0x00,0x1e,0x10,0x55,0x00,0x0f,0x11,0x00,0x40,0x00,0x01,0x00,0x41,0x59,
-0xde,0xfe,0xda,0x16,0x00,0x13,0x4d,0xc7,0x04,0x01,0x2b,0x10,0x11,0xee,0xcc,0x02,
-0xa2,0x6f,0xff,0xf7,0x10,0x00,0x17,0xef,0xff,0x50,0x02,0x25,0x03,0x33,0x1d,0xff,
-0xe0,0xcf,0x03,0x10,0x03,0x57,0x04,0x13,0x80,0x73,0x03,0x13,0x4f,0xcf,0x03,0x45,
-0x36,0x65,0x8f,0xfe,0xa2,0x19,0x15,0xfb,0x93,0x03,0x1e,0xf9,0xa7,0x03,0x01,0x0a,
-0x00,0x74,0x5d,0xdd,0xdd,0xdd,0xdb,0xdf,0xf8,0xe8,0x1a,0x06,0x0a,0x00,0x04,0x32,
-0x00,0x44,0x7f,0xfe,0xaf,0xfc,0x0a,0x00,0x24,0x7f,0xff,0x0a,0x00,0x33,0x3f,0xff,
-0x50,0x0a,0x00,0x33,0x0e,0xff,0xc0,0x0a,0x00,0x12,0x07,0x86,0x08,0x00,0xd7,0x0c,
-0x12,0xdf,0xc0,0x13,0x40,0xcf,0xfe,0x00,0x2f,0x0b,0x0a,0x40,0x02,0x7e,0xff,0xf9,
-0xe6,0x1a,0x00,0xd2,0x00,0x00,0x3c,0x06,0x11,0x1a,0x5f,0x01,0x11,0xe6,0xc2,0x08,
-0x45,0xce,0xff,0xdc,0x84,0x15,0x01,0x00,0x06,0x0f,0x24,0xff,0xf5,0x46,0x04,0x0f,
-0x15,0x00,0x4d,0x14,0xff,0xb8,0x0e,0x15,0x0f,0x0b,0x00,0x13,0xa0,0x0c,0x02,0x3f,
-0xdd,0xff,0xfa,0x93,0x00,0x62,0x05,0x15,0x00,0x2f,0xcf,0xf9,0x02,0x00,0x1f,0x0b,
-0xd8,0x0e,0x0f,0x09,0x00,0x80,0x34,0x08,0x88,0x20,0x0b,0x05,0x12,0x60,0x9a,0x1c,
-0x10,0x0d,0x4c,0x08,0x00,0x70,0x1a,0x31,0x08,0xff,0xf3,0x33,0x07,0x20,0x70,0x01,
-0x91,0x0e,0x10,0x18,0x2d,0x11,0x11,0x6f,0x31,0x02,0x13,0xf4,0xd9,0x0b,0x10,0xfe,
-0xf3,0x04,0x11,0x17,0x34,0x1a,0x15,0x00,0x4a,0x05,0x04,0xd4,0x07,0x11,0x09,0x9a,
-0x04,0x11,0x50,0x54,0x00,0x13,0xf9,0x5b,0x03,0x33,0x06,0xff,0xfb,0x2a,0x00,0x02,
-0x50,0x09,0x00,0x15,0x00,0x10,0x03,0x59,0x06,0x00,0x15,0x00,0x00,0x0d,0x12,0x11,
-0x20,0x15,0x00,0x00,0x69,0x1c,0x13,0x30,0x98,0x03,0x00,0xec,0x07,0x02,0x15,0x00,
-0x33,0xaf,0xff,0x70,0xad,0x03,0x33,0x9f,0xff,0x90,0xaf,0x03,0x33,0x7f,0xff,0xe0,
-0xc2,0x03,0x23,0xaf,0xff,0x92,0x08,0x04,0xdd,0x08,0x01,0x2a,0x05,0x42,0xc2,0xef,
-0xfe,0x10,0x15,0x00,0x42,0xd1,0x04,0xff,0xfb,0x15,0x00,0x54,0xe1,0x00,0x08,0xff,
-0xf7,0xee,0x03,0x34,0x0c,0xff,0xf3,0x01,0x04,0x34,0x2e,0xff,0xe1,0x03,0x04,0x34,
-0x5f,0xff,0xb0,0xd2,0x00,0x34,0x9f,0xff,0x70,0x18,0x04,0x00,0xa8,0x0f,0x12,0x0f,
-0xdf,0x0f,0x00,0xb4,0x00,0x04,0x94,0x0c,0x14,0xfb,0xfc,0x00,0x15,0x09,0xaa,0x08,
-0x00,0x57,0x00,0x0e,0xaa,0x04,0x0f,0x11,0x00,0xa0,0x02,0x7b,0x03,0x14,0xd6,0x8e,
-0x03,0x13,0x80,0x08,0x00,0x23,0xf8,0x0f,0x2f,0x1d,0x01,0xa6,0x15,0x25,0x70,0xff,
-0xf8,0x0a,0x45,0x8f,0xff,0xf7,0x0f,0x13,0x1f,0x11,0x0e,0x1b,0x00,0x14,0xfb,0x6b,
-0x02,0x01,0x1b,0x00,0x15,0xf1,0xa9,0x1e,0x53,0x70,0xff,0xfd,0xff,0x70,0x44,0x0b,
-0x63,0xcf,0xf7,0x0f,0xff,0x7f,0xfe,0x22,0x0b,0x34,0xca,0xff,0x70,0x44,0x18,0x92,
-0x00,0xef,0xf5,0xbf,0xf7,0x0f,0xff,0x19,0xff,0xf5,0x20,0x20,0xfe,0x0b,0x1b,0x00,
-0x01,0xf4,0x1c,0x00,0x70,0x10,0x00,0x1b,0x00,0x32,0x20,0xcf,0xf7,0x5d,0x11,0x62,
-0x0c,0xff,0x70,0xff,0xf3,0x06,0x8d,0x17,0x20,0xfc,0x00,0x51,0x00,0x11,0x30,0x44,
-0x0e,0x81,0x0d,0xff,0x60,0x0d,0xff,0x70,0xff,0xf4,0x91,0x12,0x00,0x3e,0x15,0x00,
-0x1d,0x08,0x40,0x40,0x03,0xff,0xf1,0x23,0x0e,0x00,0xb8,0x1d,0x21,0xff,0xf5,0x99,
-0x16,0x33,0x1f,0xff,0x20,0x2e,0x08,0x21,0x6f,0xfd,0xac,0x12,0x11,0x0f,0x1b,0x00,
-0x00,0x37,0x20,0x00,0xaf,0x16,0x10,0xff,0x1b,0x00,0x00,0xa0,0x17,0x00,0x4b,0x11,
-0x03,0x1b,0x00,0x21,0x3f,0xff,0x1e,0x1c,0x01,0x1b,0x00,0x00,0xb9,0x0e,0x25,0xff,
-0xf2,0x1b,0x00,0x12,0x06,0x6d,0x0b,0x03,0x1b,0x00,0x11,0x0f,0xd1,0x11,0x02,0x1b,
-0x00,0x00,0x52,0x02,0x16,0xf0,0x1b,0x00,0x00,0xe2,0x1d,0x06,0x1b,0x00,0x01,0xfc,
-0x1b,0x01,0x1b,0x00,0x23,0xa0,0x00,0x05,0x0b,0x04,0x4e,0x01,0x31,0xbf,0xfa,0x0f,
-0x29,0x03,0x03,0x15,0x00,0x15,0xf9,0x15,0x00,0x25,0xff,0xf4,0x15,0x00,0x24,0xff,
-0xd0,0x15,0x00,0x00,0x03,0x13,0x02,0x15,0x00,0x43,0xf5,0xaf,0xff,0x30,0x15,0x00,
+0x7c,0x00,0x0d,0x09,0x00,0x53,0x06,0xcf,0xfd,0x70,0x00,0x01,0x00,0x43,0xbf,0xff,
+0xff,0xfd,0x86,0x02,0x63,0x08,0xff,0xa4,0x49,0xff,0xa0,0xd7,0x00,0xe1,0xfb,0x00,
+0x00,0x8f,0xf1,0x00,0x00,0x0d,0x91,0x00,0x00,0x1f,0xf5,0x00,0xff,0x01,0x61,0x8f,
+0xe0,0x00,0x00,0x2f,0xf4,0x10,0x00,0x32,0x03,0xff,0x50,0xef,0x01,0x21,0x2f,0xf4,
+0x0a,0x02,0x72,0x00,0x0f,0xf9,0x00,0x00,0x6f,0xf2,0x1c,0x02,0x71,0x09,0xff,0x71,
+0x15,0xff,0xc0,0x02,0x6d,0x02,0x62,0x01,0xdf,0xff,0xff,0xfe,0x20,0xee,0x01,0x00,
+0x72,0x02,0x43,0xa2,0x00,0x5f,0xf2,0x8c,0x00,0x43,0x20,0x00,0x01,0xef,0x98,0x00,
+0x03,0xed,0x01,0x04,0x01,0x00,0x00,0xab,0x02,0x13,0x21,0x0c,0x00,0x62,0xdf,0xa0,
+0x04,0xcf,0xff,0xd5,0xa0,0x00,0x71,0xfe,0x10,0x5f,0xff,0xff,0xff,0x70,0x3c,0x01,
+0x71,0xf5,0x01,0xff,0xd4,0x03,0xcf,0xf2,0xec,0x01,0x71,0xb0,0x07,0xff,0x20,0x00,
+0x1f,0xf8,0x26,0x01,0x10,0x20,0x49,0x00,0x20,0x0b,0xfb,0x8e,0x02,0x91,0xf7,0x00,
+0x0a,0xfb,0x00,0x00,0x0a,0xfc,0x00,0x0d,0x03,0x04,0x0c,0x00,0x10,0x06,0xfb,0x02,
+0x12,0xfd,0xc1,0x02,0x90,0x0b,0xf9,0x00,0x00,0x05,0xff,0x40,0x00,0x2f,0xfb,0x01,
+0x00,0xaf,0x00,0x53,0xef,0xf6,0x35,0xef,0xf1,0x7a,0x00,0x32,0x3e,0xff,0xff,0x8c,
+0x01,0x00,0xad,0x00,0x30,0x9e,0xfe,0xa2,0x07,0x00,0x42,0x8c,0xff,0xea,0x30,0x12,
+0x00,0x51,0x4e,0xff,0xff,0xff,0xf8,0x0a,0x00,0x43,0x02,0xff,0xff,0xec,0x96,0x00,
+0x71,0x0a,0xff,0xf5,0x00,0x0a,0xff,0xf0,0xa9,0x02,0x00,0x12,0x00,0x11,0xdf,0x35,
+0x03,0x66,0x1f,0xff,0x30,0x00,0x00,0xbf,0x0b,0x00,0x22,0xdf,0xf2,0x39,0x02,0x52,
+0x70,0x00,0x05,0xff,0xd0,0x79,0x01,0x32,0xe1,0x00,0x7f,0x6c,0x00,0x51,0x01,0xef,
+0xfb,0x2b,0xff,0x08,0x03,0x00,0xea,0x01,0x44,0xff,0xfe,0x40,0x00,0x3a,0x01,0x25,
+0xb1,0x00,0x79,0x00,0x03,0x15,0x00,0x00,0xcc,0x02,0x50,0xe2,0x00,0x00,0x03,0x32,
+0x8f,0x02,0xf0,0x12,0xa2,0xdf,0xfd,0x10,0x00,0x3f,0xfb,0x00,0x03,0xff,0xf9,0x00,
+0x2e,0xff,0xc0,0x00,0x4f,0xfa,0x00,0x0c,0xff,0xc0,0x00,0x04,0xff,0xfa,0x00,0x7f,
+0xf8,0x00,0x1f,0xff,0x40,0xe5,0x02,0x70,0x70,0xcf,0xf5,0x00,0x3f,0xff,0x10,0x50,
+0x00,0x72,0xf8,0xff,0xf0,0x00,0x2f,0xff,0x10,0x02,0x02,0x31,0x90,0x00,0x0f,0x95,
+0x02,0x81,0x0d,0xff,0xff,0x10,0x00,0x0b,0xff,0xd1,0x94,0x00,0x10,0xfd,0xfc,0x02,
+0x40,0xfd,0x40,0x00,0x03,0x21,0x00,0x00,0x63,0x00,0x50,0xfe,0xcc,0xef,0xff,0xfd,
+0x0b,0x03,0x20,0x05,0xef,0x4e,0x03,0xf1,0x11,0x70,0xaf,0xff,0x20,0x00,0x00,0x06,
+0xbe,0xff,0xea,0x60,0x00,0x1e,0xff,0xd0,0x1b,0xb5,0x2f,0xf7,0x2f,0xf7,0x2f,0xf6,
+0x2f,0xf5,0x2f,0xf4,0x2f,0xf3,0x3f,0xf2,0x3f,0x48,0x01,0x60,0x81,0x00,0x00,0x00,
+0x0b,0xf5,0xa5,0x01,0x40,0xf6,0x00,0x00,0x0a,0x14,0x01,0x20,0x6f,0xfa,0xe6,0x00,
+0x40,0xe0,0x00,0x00,0x09,0x21,0x02,0x60,0x2f,0xfe,0x00,0x00,0x00,0x9f,0x7f,0x01,
+0x00,0x78,0x01,0x10,0x04,0x12,0x03,0x10,0x09,0x26,0x00,0x10,0x0d,0xb1,0x00,0x10,
+0x1f,0xa0,0x00,0x20,0x4f,0xfe,0xbf,0x03,0x00,0xc5,0x01,0x20,0x8f,0xfb,0x2c,0x00,
+0x64,0xfa,0x00,0x00,0x00,0xaf,0xf9,0x05,0x00,0x24,0x9f,0xfa,0x05,0x00,0x20,0x7f,
+0xfb,0x28,0x00,0x11,0xfd,0x58,0x03,0x01,0x80,0x01,0x10,0x20,0xce,0x03,0x10,0x50,
+0xca,0x00,0x10,0x90,0xca,0x00,0x10,0xd0,0x4d,0x02,0x10,0xf3,0x29,0x00,0x11,0xf9,
+0x7e,0x01,0x01,0x2e,0x02,0x23,0x80,0x00,0x8f,0x01,0x21,0x3f,0xfc,0x51,0x01,0x10,
+0x90,0x67,0x00,0x10,0xf7,0x1b,0x00,0x01,0xaf,0x01,0x30,0x30,0x07,0x10,0xb5,0x01,
+0xc0,0xe3,0x00,0x00,0x00,0x1e,0xfe,0x20,0x00,0x00,0x02,0xef,0xd0,0x98,0x01,0x10,
+0xfa,0xd5,0x00,0x00,0xa1,0x00,0x11,0x02,0x56,0x00,0x20,0xbf,0xf6,0x41,0x00,0x23,
+0xfd,0x00,0xb6,0x00,0x10,0x09,0x46,0x00,0x11,0x04,0xb5,0x03,0x20,0xff,0xf2,0x60,
+0x00,0x14,0xf6,0xad,0x00,0x01,0xc1,0x00,0x20,0x7f,0xfd,0xa8,0x00,0x11,0xfe,0xe0,
+0x01,0x00,0xec,0x02,0x10,0xff,0x0a,0x00,0x01,0xe4,0x00,0x0a,0xe9,0x00,0x20,0xaf,
+0xf8,0x3c,0x00,0x10,0xf5,0x46,0x00,0x00,0x1a,0x01,0x00,0x6a,0x00,0x10,0x09,0xb0,
+0x00,0x10,0x0e,0xd9,0x00,0x32,0x4f,0xfb,0x00,0x53,0x02,0x60,0x03,0xff,0xb0,0x00,
+0x00,0x0c,0x13,0x00,0x50,0x7f,0xf7,0x00,0x00,0x05,0x0e,0x00,0x20,0x2f,0xfc,0xff,
+0x00,0x10,0xb0,0x93,0x04,0x03,0x33,0x02,0x23,0x8f,0xf2,0xe0,0x03,0x12,0x10,0xbc,
+0x04,0x13,0xf1,0x89,0x04,0x00,0x14,0x00,0x10,0x50,0x63,0x05,0xf1,0x0f,0x06,0x21,
+0xff,0xe8,0x26,0xff,0x04,0xaf,0xf8,0x5f,0xff,0xff,0xef,0xfd,0xff,0xff,0xd0,0x49,
+0xdf,0xff,0xff,0xff,0xfd,0x83,0x00,0x00,0x2a,0xff,0xfe,0x72,0x87,0x03,0x21,0xff,
+0xf2,0x4a,0x00,0x11,0xf8,0xb4,0x04,0x30,0x4f,0xfc,0x08,0x8b,0x00,0x30,0x1e,0xff,
+0x20,0xf2,0x00,0x00,0x0c,0x00,0xa2,0x4f,0xfd,0x00,0x00,0x08,0xe0,0x00,0x00,0xad,
+0x20,0x30,0x03,0x02,0x06,0x00,0x24,0x33,0x20,0xf4,0x04,0x1f,0xc0,0x09,0x00,0x26,
+0xa3,0x12,0x22,0x22,0x29,0xff,0xd2,0x22,0x22,0x22,0xaf,0x4b,0x06,0x1e,0xfe,0x09,
+0x00,0x0f,0x63,0x00,0x2c,0x06,0x09,0x00,0x22,0xcf,0xf6,0x03,0x00,0x00,0x79,0x01,
+0xf0,0x08,0xff,0xf2,0x04,0xff,0xd0,0x0a,0xff,0x60,0x3f,0xfd,0x00,0x0a,0xe2,0x00,
+0x00,0x10,0x00,0x4b,0xbb,0xbb,0xbb,0xb2,0x5f,0x3f,0x06,0x01,0x05,0x00,0xa2,0x0b,
+0xfb,0x15,0xff,0xf7,0x6f,0xff,0x70,0xbf,0xc1,0xce,0x05,0x02,0xe0,0x05,0x21,0x9f,
+0xf3,0x07,0x00,0x21,0xef,0xd0,0xd7,0x07,0x02,0x17,0x04,0x12,0x0b,0x79,0x01,0x22,
+0x1f,0xfb,0x7f,0x01,0x12,0xf5,0xd9,0x04,0x21,0xf0,0x00,0x5e,0x06,0x12,0x90,0xe0,
+0x03,0x11,0x30,0x14,0x04,0x12,0xfd,0xf9,0x03,0x12,0xf7,0x9b,0x05,0x12,0xf1,0xb4,
+0x05,0x12,0xb0,0xa1,0x00,0x21,0x50,0x00,0x62,0x02,0x0f,0x6d,0x00,0x44,0x23,0x48,
+0x81,0x2d,0x02,0x40,0x4a,0xdf,0xfe,0xb6,0x77,0x00,0x10,0xbf,0x02,0x02,0xf0,0x05,
+0x20,0x00,0x00,0xcf,0xff,0xfd,0xce,0xff,0xfe,0x20,0x00,0x7f,0xff,0x80,0x00,0x06,
+0xff,0xfa,0x00,0x0e,0xfa,0x01,0x10,0x05,0x1d,0x01,0x11,0xf1,0x90,0x00,0x10,0x80,
+0xae,0x02,0x00,0xb4,0x02,0x10,0x0b,0x4e,0x03,0x00,0xf9,0x02,0x00,0xb5,0x02,0x00,
+0x61,0x07,0x31,0x0e,0xff,0x50,0xc0,0x00,0x23,0xf1,0xff,0xfc,0x04,0x31,0x2f,0xff,
+0x40,0x11,0x00,0x1f,0xf2,0x11,0x00,0x0f,0x22,0xef,0xf5,0x11,0x00,0x31,0x1d,0xff,
+0x60,0x63,0x05,0x41,0xf0,0xbf,0xf8,0x00,0x29,0x03,0x31,0x08,0xff,0xc0,0xcb,0x02,
+0x20,0xb0,0x4f,0xe8,0x00,0x00,0xb5,0x07,0x21,0xef,0xfa,0x4c,0x03,0x40,0x20,0x06,
+0xff,0xf9,0xe4,0x04,0x10,0xa0,0x15,0x07,0x70,0xcc,0xef,0xff,0xe1,0x00,0x00,0x0a,
+0x1d,0x02,0x10,0xd2,0x95,0x00,0x33,0x9d,0xff,0xeb,0x75,0x07,0x20,0x4b,0xc0,0x8d,
+0x07,0x80,0xfd,0x00,0x16,0xcf,0xff,0xff,0xd0,0xaf,0xe4,0x00,0xc0,0x0f,0xff,0xfd,
+0x78,0xff,0xd0,0xfe,0x93,0x00,0x7f,0xfd,0x05,0x68,0x01,0x14,0xd0,0xa5,0x03,0x0f,
+0x0b,0x00,0x4f,0x50,0x06,0xae,0xff,0xeb,0x60,0xa0,0x00,0x13,0xef,0x9f,0x08,0x40,
+0x5f,0xff,0xfe,0xcc,0x9f,0x08,0x10,0x02,0x79,0x05,0x50,0x07,0xff,0xfd,0x00,0x0a,
+0x8d,0x05,0x00,0x9f,0x08,0x04,0xa1,0x05,0x32,0x90,0x3f,0xff,0x6a,0x06,0x32,0xa0,
+0x4f,0xfd,0xcd,0x01,0x03,0xb2,0x07,0x12,0x0b,0xff,0x01,0x03,0xfa,0x04,0x14,0x00,
+0x12,0x05,0x01,0x3e,0x01,0x12,0xf3,0x09,0x00,0x14,0x1d,0xb5,0x08,0x23,0xbf,0xfd,
+0x75,0x07,0x23,0xff,0xe2,0x22,0x04,0x23,0xff,0x30,0x07,0x03,0x14,0xf4,0x7c,0x06,
+0x22,0x50,0x00,0x98,0x09,0x14,0xf7,0xad,0x08,0x12,0x80,0x4d,0x00,0x13,0xef,0xc8,
+0x08,0x13,0x1e,0x79,0x00,0x34,0x01,0xdf,0xfb,0x81,0x00,0x20,0xfc,0xbb,0x01,0x00,
+0x24,0xba,0x0e,0x97,0x03,0x16,0x0e,0xa0,0x03,0x40,0x07,0xbe,0xff,0xda,0xdb,0x01,
+0x10,0x5e,0x10,0x00,0x10,0xc2,0xd2,0x00,0x00,0xe9,0x00,0x51,0xe1,0x00,0x3f,0xff,
+0xc3,0xb5,0x01,0x31,0x0a,0xff,0xd0,0x76,0x00,0x31,0x10,0xff,0xf5,0xff,0x08,0x41,
+0xf5,0x1d,0xdd,0x20,0x8f,0x09,0x03,0xd5,0x00,0x01,0x45,0x05,0x04,0x41,0x07,0x01,
+0x6d,0x00,0x11,0xb0,0x7d,0x00,0x31,0x5c,0xff,0xd1,0x6c,0x02,0x01,0x20,0x07,0x00,
+0x8b,0x07,0x20,0xff,0xd3,0x18,0x00,0x25,0x1c,0xcc,0x70,0x09,0x14,0x18,0x09,0x00,
+0x14,0x05,0x07,0x01,0x14,0x0b,0x07,0x01,0x42,0x7f,0xfc,0x13,0x33,0x49,0x07,0x32,
+0xd4,0xff,0xf0,0x11,0x00,0x32,0x2f,0xff,0x30,0x22,0x00,0x21,0xdf,0xfc,0x31,0x03,
+0x20,0xf4,0x05,0x56,0x09,0x30,0x05,0xff,0xfc,0x83,0x07,0x70,0xdc,0xcf,0xff,0xfe,
+0x10,0x00,0x07,0xc3,0x00,0x20,0xfc,0x10,0x5d,0x0a,0x34,0xef,0xfd,0xa4,0xb4,0x08,
+0x34,0xef,0xfd,0x00,0xab,0x07,0x04,0x0a,0x00,0x15,0x3f,0x0a,0x00,0x34,0xdf,0xff,
+0xfd,0x63,0x09,0x04,0x28,0x00,0x43,0x2f,0xfe,0x7f,0xfd,0xab,0x0a,0x33,0xf5,0x6f,
+0xfd,0x7d,0x01,0x12,0xb0,0x0a,0x00,0x00,0x99,0x07,0x03,0x0a,0x00,0x21,0xbf,0xf6,
+0xd4,0x06,0x00,0xa4,0x00,0x12,0xc0,0x0a,0x00,0x00,0x76,0x05,0x03,0x0a,0x00,0x23,
+0xaf,0xf8,0xf2,0x06,0x01,0x48,0x08,0x21,0x6f,0xfd,0xd8,0x06,0x13,0x30,0x0a,0x00,
+0x23,0x9f,0xf9,0x10,0x07,0x02,0x8b,0x06,0x00,0x0a,0x00,0x14,0x0d,0x8e,0x0b,0x25,
+0xf6,0x1f,0x0a,0x00,0x11,0x0b,0xb4,0x01,0x42,0xdf,0xff,0xbb,0xb4,0x8e,0x00,0x03,
+0x78,0x00,0x0f,0x0a,0x00,0x1d,0x12,0x2f,0x4f,0x00,0x22,0x00,0x03,0x08,0x00,0x33,
+0xf0,0x00,0x5f,0x11,0x00,0xb4,0x07,0xff,0xa1,0x11,0x11,0x11,0x11,0x10,0x00,0x8f,
+0xf8,0x74,0x02,0x13,0x60,0xf8,0x00,0x14,0xf3,0x42,0x0b,0x03,0x80,0x0a,0x31,0xff,
+0xf2,0x9d,0x25,0x02,0x02,0x9d,0x00,0x14,0xa0,0x4c,0x00,0xd0,0xb0,0x00,0x4f,0xff,
+0xc4,0x10,0x27,0xef,0xff,0x70,0x01,0x59,0x70,0x81,0x02,0x14,0xfe,0xd0,0x01,0x12,
+0xf5,0x09,0x00,0x14,0x0d,0xdf,0x0a,0x2b,0x9f,0xfb,0xd6,0x05,0x42,0x7f,0xfc,0x17,
+0x76,0x94,0x01,0x12,0xb2,0xe1,0x01,0x51,0xcf,0xf8,0x0e,0xff,0x40,0xaf,0x00,0x31,
+0x40,0x9f,0xfd,0xe9,0x01,0xf3,0x02,0xe0,0x01,0xff,0xfc,0x20,0x00,0x1a,0xff,0xf6,
+0x00,0x05,0xff,0xff,0xdc,0xdf,0xff,0xfa,0x8e,0x03,0x01,0x35,0x02,0x42,0x7b,0xef,
+0xed,0x92,0xf6,0x02,0x21,0x7b,0xde,0xec,0x0c,0x12,0x2b,0x6d,0x06,0x00,0x4f,0x0c,
+0x21,0xfe,0xc0,0x08,0x00,0x22,0xe8,0x30,0xb1,0x01,0x02,0x9f,0x09,0x13,0x0c,0x15,
+0x03,0x33,0x03,0xff,0xe0,0x93,0x00,0x15,0xf6,0xe5,0x00,0x30,0x59,0xbc,0xa6,0xa2,
+0x02,0x21,0xd3,0xdf,0xd7,0x09,0x21,0x5f,0xfe,0xdd,0x00,0xb1,0x50,0x07,0xff,0xff,
+0xf7,0x20,0x17,0xff,0xff,0x10,0x8f,0xcc,0x09,0x51,0xff,0xf9,0x09,0xff,0xf3,0x29,
+0x02,0x32,0xf0,0xaf,0xfb,0xf1,0x02,0x32,0x3a,0xff,0x90,0x02,0x03,0x22,0xaf,0xfa,
+0x63,0x00,0x12,0x79,0xfc,0x02,0x42,0xbf,0xf7,0x6f,0xfe,0xff,0x00,0x32,0x63,0xff,
+0xf2,0x3d,0x0c,0x31,0x0d,0xff,0x90,0x95,0x00,0x02,0x4e,0x0a,0xf0,0x02,0x1e,0xff,
+0x90,0x00,0xdf,0xff,0x60,0x00,0x3d,0xff,0xf2,0x00,0x02,0xef,0xff,0xec,0xef,0x31,
+0x01,0x10,0x02,0xda,0x07,0x10,0xe5,0x2f,0x00,0x64,0x5b,0xef,0xec,0x71,0x00,0x00,
+0x44,0x07,0x15,0xfa,0x09,0x00,0x21,0x7c,0xcc,0x01,0x00,0x04,0x86,0x0a,0x14,0x02,
+0xcb,0x00,0x14,0x09,0x67,0x01,0x14,0x1f,0xb1,0x01,0x24,0x7f,0xfa,0xfd,0x02,0x14,
+0xf3,0x92,0x0a,0x14,0xb0,0x93,0x01,0x13,0x40,0x48,0x04,0x14,0xfd,0x91,0x0d,0x03,
+0x4f,0x00,0x00,0x4f,0x0d,0x03,0x08,0x02,0x03,0x4f,0x00,0x02,0x86,0x0a,0x04,0xc7,
+0x09,0x02,0xf4,0x0c,0x0b,0xc8,0x01,0x14,0x0e,0x33,0x0d,0x02,0xf2,0x00,0x02,0xf8,
+0x05,0x03,0x05,0x02,0x03,0xaf,0x0b,0x14,0x0c,0xd5,0x03,0x14,0x3f,0xff,0x04,0x15,
+0xaf,0xff,0x04,0x60,0xf4,0x00,0x00,0x00,0x00,0x00,0xf3,0x31,0x00,0x00,0x04,0xad,
+0xff,0xeb,0x60,0x00,0x00,0x00,0x01,0xcf,0xff,0xff,0xff,0xfd,0x30,0x00,0x00,0x1d,
+0xff,0xff,0xcc,0xff,0xff,0xf3,0x00,0x00,0xaf,0xff,0x80,0x00,0x06,0xff,0xfd,0x00,
+0x01,0xff,0xf8,0x00,0x00,0x00,0x5f,0xff,0x40,0x05,0xff,0xf0,0x00,0x00,0x00,0x0d,
+0xff,0x80,0x06,0xff,0xd0,0x00,0x00,0x00,0x0a,0xff,0xa0,0x05,0x09,0x00,0xf0,0x35,
+0x90,0x02,0xff,0xf1,0x00,0x00,0x00,0x0e,0xff,0x60,0x00,0xbf,0xfa,0x00,0x00,0x00,
+0x7f,0xfe,0x00,0x00,0x2e,0xff,0xb4,0x00,0x39,0xff,0xf4,0x00,0x00,0x03,0xdf,0xff,
+0xff,0xff,0xfe,0x50,0x00,0x00,0x00,0x3f,0xff,0xff,0xff,0xf5,0x00,0x00,0x00,0x08,
+0xff,0xff,0xcc,0xef,0xff,0xa0,0x00,0x00,0x8f,0xff,0x60,0x00,0x05,0xef,0xfa,0x00,
+0x03,0xff,0xf3,0x00,0x32,0x00,0x20,0x60,0x0a,0x16,0x00,0x60,0x00,0x07,0xff,0xd0,
+0x0e,0xff,0x31,0x00,0xf0,0x00,0x02,0xff,0xf2,0x0f,0xff,0x30,0x00,0x00,0x00,0x00,
+0xff,0xf3,0x0f,0xff,0x40,0xa7,0x00,0xe1,0xff,0xf2,0x0d,0xff,0x80,0x00,0x00,0x00,
+0x05,0xff,0xf0,0x08,0xff,0xf2,0x90,0x00,0xf0,0x0c,0xb0,0x01,0xff,0xfe,0x40,0x00,
+0x03,0xcf,0xff,0x30,0x00,0x4f,0xff,0xfe,0xcc,0xef,0xff,0xf7,0x00,0x00,0x04,0xef,
+0xff,0xff,0xff,0xff,0x60,0x29,0x00,0x40,0xae,0xff,0xeb,0x71,0x43,0x00,0x92,0x06,
+0xbe,0xfe,0xc7,0x10,0x00,0x00,0x00,0x2d,0x8f,0x00,0x00,0x8e,0x00,0x80,0xde,0xff,
+0xff,0x50,0x00,0x0d,0xff,0xe5,0xa4,0x00,0x20,0x10,0x06,0x85,0x00,0x61,0x01,0xef,
+0xfa,0x00,0xbf,0xf9,0x60,0x00,0x12,0xf1,0x7b,0x00,0x31,0x0e,0xff,0x51,0xf8,0x00,
+0x61,0x00,0xaf,0xf9,0x3f,0xff,0x00,0x9e,0x00,0x12,0xb2,0x11,0x00,0x22,0x6f,0xfc,
+0x22,0x00,0x50,0x06,0xff,0xd0,0xdf,0xf8,0x11,0x00,0x31,0xcf,0xfd,0x07,0x93,0x00,
+0xf0,0x14,0x8f,0xff,0xc0,0x1e,0xff,0xe4,0x00,0x02,0xbf,0xff,0xfc,0x00,0x5f,0xff,
+0xfe,0xce,0xff,0xfc,0xff,0xb0,0x00,0x5f,0xff,0xff,0xff,0xe5,0x8f,0xf9,0x00,0x00,
+0x29,0xdf,0xfd,0x81,0x0a,0x9b,0x00,0x00,0x01,0x00,0x22,0xef,0xf3,0x08,0x00,0x21,
+0x3f,0xfe,0x08,0x00,0x00,0x4c,0x01,0x01,0x08,0x00,0x11,0x05,0x12,0x01,0x00,0x5c,
+0x00,0x20,0xf9,0x00,0xf7,0x00,0x30,0x5c,0xff,0xfd,0x39,0x01,0x60,0xde,0xff,0xff,
+0xfc,0x10,0x00,0x9c,0x01,0x21,0xff,0xe7,0x2f,0x00,0x20,0xfe,0xc9,0x28,0x01,0xbf,
+0x1c,0xfa,0x08,0xff,0xf5,0x8f,0xff,0x51,0xcf,0xa0,0x00,0x01,0x00,0x0a,0x00,0x28,
+0x00,0xc0,0xf4,0x8f,0xff,0x52,0xcf,0xa0,0x00,0x6e,0xe5,0x00,0xff,0xfe,0x03,0x00,
+0x3f,0x6e,0xe5,0x00,0x01,0x00,0x11,0x21,0x9f,0xfa,0x03,0x00,0xf6,0x03,0xf9,0x00,
+0x9f,0xf8,0x00,0xcf,0xf5,0x01,0xff,0xf0,0x07,0xff,0x90,0x1f,0xff,0x10,0x07,0xf4,
+0x23,0x00,0x21,0x06,0x70,0x07,0x00,0x21,0x6e,0xfa,0x26,0x01,0x01,0xe1,0x01,0x30,
+0x01,0x8e,0xff,0x8e,0x01,0xf0,0x09,0x18,0xff,0xff,0xfe,0x82,0x00,0x02,0x9f,0xff,
+0xff,0xd6,0x00,0x00,0x2a,0xff,0xff,0xfa,0x40,0x00,0x00,0x0b,0xff,0xfe,0x81,0x29,
+0x00,0x11,0xbf,0xea,0x01,0x00,0x14,0x02,0x20,0xe7,0x10,0xf3,0x01,0x40,0xaf,0xff,
+0xff,0xa3,0x11,0x00,0x41,0x29,0xff,0xff,0xfd,0x99,0x02,0x61,0x9f,0xff,0xff,0xf9,
+0x20,0x00,0x45,0x00,0x11,0xfa,0x0c,0x01,0x22,0x7e,0xff,0xe7,0x00,0x23,0x07,0xea,
+0x79,0x00,0x10,0x30,0x5c,0x01,0x00,0x5c,0x02,0x04,0x08,0x00,0x21,0x4e,0xee,0x01,
+0x00,0x1f,0xe4,0xd5,0x00,0x0d,0x04,0x28,0x00,0x0c,0x40,0x00,0x13,0x86,0x20,0x00,
+0x32,0xaf,0xe8,0x10,0x08,0x00,0x02,0x82,0x00,0x51,0x00,0x6e,0xff,0xff,0xfa,0x8f,
+0x02,0x58,0x5c,0xff,0xff,0xfc,0x40,0xa6,0x00,0x51,0x00,0x06,0xcf,0xff,0xfe,0x00,
+0x01,0x41,0x03,0x9f,0xff,0xf6,0x35,0x00,0x12,0x3a,0x08,0x00,0x81,0x6c,0xff,0xff,
+0xe3,0x00,0x00,0x02,0x8e,0xfc,0x00,0xc2,0x05,0xbf,0xff,0xff,0xc5,0x00,0x00,0x18,
+0xef,0xff,0xff,0xb4,0xc7,0x01,0x12,0xa2,0x60,0x00,0x11,0x81,0x33,0x00,0x22,0xae,
+0x70,0x78,0x00,0x14,0x20,0xa1,0x00,0x80,0x01,0x7c,0xef,0xec,0x81,0x00,0x00,0x05,
+0x96,0x00,0x11,0xf6,0x07,0x00,0x00,0x42,0x03,0xa0,0xef,0xfe,0x61,0x00,0x5e,0xff,
+0xe0,0x6f,0xff,0x20,0x98,0x03,0xb0,0x49,0xff,0xb0,0x00,0x00,0x00,0xdf,0xf7,0x46,
+0x63,0x00,0x56,0x01,0x21,0x80,0x00,0x8b,0x02,0x11,0xf7,0x07,0x00,0x01,0x35,0x03,
+0x00,0x5d,0x01,0x12,0xe0,0x55,0x02,0x12,0xf5,0x07,0x00,0x01,0x48,0x01,0x41,0x04,
+0xff,0xfc,0x00,0x64,0x03,0x11,0xfc,0x2b,0x00,0x12,0xdf,0x07,0x00,0x32,0x4f,0xff,
+0x20,0x32,0x00,0x22,0xc0,0x00,0xf5,0x02,0x02,0xdb,0x01,0x2f,0x88,0x40,0x47,0x01,
+0x08,0x41,0x02,0xbb,0x30,0x00,0xcb,0x01,0x11,0xfd,0x07,0x00,0x32,0x0c,0xff,0xe0,
+0x5e,0x01,0x05,0x5a,0x02,0x32,0x03,0x8c,0xef,0xa9,0x02,0x02,0xdc,0x02,0x11,0xdf,
+0xc8,0x00,0x13,0x81,0x3d,0x00,0x82,0xcf,0xff,0xea,0x76,0x68,0x9d,0xff,0xfe,0x62,
+0x00,0x30,0x3e,0xff,0xc4,0x07,0x00,0x12,0x28,0x3d,0x01,0x13,0x03,0x4c,0x01,0x21,
+0x00,0x2c,0xc9,0x00,0x12,0x1e,0x0d,0x04,0x00,0xe0,0x00,0x10,0xe1,0x70,0x00,0x14,
+0xf3,0x53,0x00,0x20,0x1e,0xf9,0xd7,0x00,0x10,0x70,0x32,0x00,0x11,0x43,0xe2,0x00,
+0x42,0x10,0x00,0x0d,0xfd,0x86,0x02,0x91,0xfa,0x10,0x00,0x00,0xdf,0x70,0x00,0x4f,
+0xf5,0x6c,0x02,0x01,0x8d,0x01,0x50,0x8f,0xc0,0x00,0xaf,0xe0,0x6c,0x03,0x90,0xb3,
+0x01,0x9f,0xf4,0x00,0x00,0x3f,0xf0,0x00,0x76,0x03,0xb0,0x4f,0xfb,0x00,0x00,0x6f,
+0xf3,0x00,0x00,0x0f,0xf3,0x04,0x6d,0x00,0xf0,0x00,0xdf,0xf1,0x00,0x00,0x7f,0xf2,
+0x00,0x00,0x0e,0xf6,0x07,0xff,0x10,0x00,0x03,0x58,0x01,0xb0,0x9f,0xf0,0x00,0x00,
+0x0c,0xf7,0x0a,0xfe,0x00,0x00,0x09,0x26,0x01,0xc0,0xaf,0xf0,0x00,0x00,0x0b,0xf8,
+0x0c,0xfc,0x00,0x00,0x0d,0xfe,0x5d,0x00,0x10,0xd0,0x0f,0x00,0x60,0x0d,0xfa,0x00,
+0x00,0x0f,0xfb,0x50,0x01,0x10,0xc0,0x0f,0x00,0x60,0x0e,0xf9,0x00,0x00,0x3f,0xf9,
+0xe9,0x03,0x10,0xa0,0x3c,0x00,0x00,0x0f,0x00,0x10,0x4f,0x9b,0x01,0x00,0x71,0x00,
+0x20,0x0e,0xf5,0x0f,0x00,0x50,0x5f,0xf7,0x00,0x00,0x01,0x5e,0x00,0xb0,0x1f,0xf2,
+0x0d,0xfb,0x00,0x00,0x4f,0xf8,0x00,0x00,0x07,0xca,0x00,0xb0,0x6f,0xe0,0x0b,0xfc,
+0x00,0x00,0x2f,0xfc,0x00,0x00,0x1e,0x1e,0x00,0x40,0xdf,0x80,0x09,0xff,0x8d,0x04,
+0x70,0x50,0x01,0xcf,0xff,0xc0,0x00,0x08,0xaf,0x04,0xc2,0x30,0x00,0x08,0xff,0xfb,
+0xae,0xfb,0x9f,0xf8,0x24,0xaf,0xf6,0x43,0x00,0x70,0xdf,0xff,0xff,0xc1,0x1e,0xff,
+0xff,0x3f,0x00,0xc0,0xcf,0xe0,0x00,0x00,0x08,0xef,0xd7,0x00,0x02,0xae,0xfe,0xa3,
+0xac,0x04,0x19,0xf6,0xb2,0x01,0x38,0x0d,0xfe,0x10,0x0f,0x00,0x39,0x04,0xff,0xc0,
+0x1f,0x00,0x29,0x8f,0xfc,0x1f,0x00,0x12,0x09,0x6d,0x04,0x23,0x03,0x70,0x10,0x00,
+0x84,0x7f,0xff,0xfb,0x75,0x44,0x69,0xdf,0xf0,0xff,0x01,0x11,0xaf,0xd0,0x01,0x15,
+0xc1,0xb5,0x02,0x56,0x6a,0xde,0xff,0xeb,0x73,0x3f,0x00,0x16,0xef,0x7c,0x00,0x03,
+0x74,0x02,0x03,0xeb,0x04,0x15,0xff,0xe8,0x02,0x23,0x1f,0xff,0xb8,0x02,0x00,0xab,
+0x00,0x13,0xfb,0x40,0x02,0x00,0xe7,0x01,0x34,0xf4,0xcf,0xf4,0x66,0x00,0x31,0xff,
+0xe0,0x6f,0xb8,0x02,0x01,0x9e,0x02,0x33,0x80,0x1f,0xff,0xa3,0x00,0x35,0x0e,0xff,
+0x20,0x4e,0x05,0x26,0x4f,0xfc,0xcb,0x00,0x62,0xaf,0xf7,0x00,0x00,0xef,0xf2,0x91,
+0x00,0x00,0x9e,0x06,0x23,0x9f,0xf8,0x51,0x05,0x15,0xb0,0x6e,0x05,0x10,0x0c,0x7b,
+0x04,0x12,0x0d,0x23,0x03,0x21,0x2f,0xff,0xdb,0x05,0x11,0xa0,0xff,0x00,0x13,0xfa,
+0x35,0x00,0x00,0xbd,0x00,0x10,0xfe,0x22,0x04,0x01,0x87,0x02,0x12,0x04,0x1e,0x04,
+0x01,0xc3,0x00,0x13,0x0a,0x0c,0x00,0x00,0x91,0x02,0x12,0x1f,0x96,0x02,0x10,0x0b,
+0xd4,0x01,0x22,0x7f,0xfd,0xbf,0x05,0x00,0xc3,0x00,0x01,0x15,0x06,0x00,0xec,0x01,
+0x10,0xf5,0xc9,0x06,0x03,0x96,0x00,0x31,0xfb,0x00,0x09,0x35,0x07,0x01,0x53,0x07,
+0x21,0x10,0x0e,0xb4,0x02,0x01,0xa9,0x03,0x44,0x70,0x5f,0xff,0x20,0x19,0x01,0x20,
+0xd0,0x0f,0x5b,0x00,0x20,0xed,0xa5,0x3d,0x00,0x00,0x01,0x00,0x00,0x1d,0x03,0x20,
+0x0f,0xff,0x88,0x00,0x30,0xff,0xff,0x40,0x50,0x00,0x00,0x21,0x03,0x53,0xfe,0x00,
+0x0f,0xff,0x50,0xd6,0x03,0x22,0xff,0xf5,0x0b,0x01,0x12,0x90,0x13,0x00,0x00,0x86,
+0x07,0x22,0xff,0xf5,0x95,0x00,0x13,0xa0,0x13,0x00,0x23,0xff,0xf7,0x13,0x00,0x31,
+0xaf,0xff,0x10,0x13,0x00,0x43,0x15,0xcf,0xff,0x50,0x5f,0x00,0x10,0xfd,0x5f,0x00,
+0x04,0x95,0x03,0x83,0xff,0xfd,0xcc,0xcc,0xcd,0xff,0xff,0xe4,0x5f,0x00,0x32,0x3c,
+0xff,0xf2,0x39,0x00,0x00,0x6a,0x07,0x02,0x4c,0x00,0x00,0xba,0x00,0x22,0xff,0xf5,
+0x5a,0x01,0x12,0xf5,0x13,0x00,0x00,0x2d,0x00,0x04,0x13,0x00,0x13,0xf4,0x13,0x00,
+0x32,0x6f,0xff,0x20,0x13,0x00,0x32,0x1e,0xff,0xd0,0x13,0x00,0x10,0x5e,0xab,0x00,
+0x74,0xfe,0xdd,0xdd,0xde,0xff,0xff,0xf9,0x72,0x00,0x13,0xf7,0xe4,0x00,0x02,0xa5,
+0x07,0x51,0x00,0x49,0xdf,0xfe,0xc9,0x4f,0x01,0x10,0x3d,0x15,0x00,0x20,0xfb,0x10,
+0xb2,0x01,0x60,0xff,0xff,0xef,0xff,0xff,0xe2,0x77,0x00,0x20,0xf7,0x20,0xf9,0x00,
+0x51,0x10,0x01,0xff,0xfe,0x20,0xac,0x04,0x22,0x90,0x09,0x59,0x01,0x10,0x08,0xae,
+0x07,0x12,0x80,0x7f,0x00,0x14,0xf6,0x49,0x01,0x42,0xcf,0xf9,0x9f,0xfd,0x52,0x01,
+0x34,0x58,0x86,0xcf,0x3b,0x02,0x04,0x96,0x01,0x00,0xdb,0x01,0x06,0x0a,0x00,0x1f,
+0xf7,0x0a,0x00,0x09,0x06,0x32,0x00,0x06,0x46,0x00,0x04,0x5a,0x00,0x53,0x47,0x75,
+0x5f,0xff,0x10,0x6e,0x00,0x15,0x1f,0x82,0x00,0x33,0x09,0xff,0xf1,0x96,0x00,0x41,
+0x01,0xff,0xfd,0x10,0xfa,0x08,0x61,0x90,0x00,0x5f,0xff,0xe6,0x00,0xbe,0x00,0x00,
+0xd2,0x00,0x21,0xfe,0xdf,0xd2,0x00,0x24,0x00,0x4d,0xe6,0x00,0x81,0x00,0x00,0x5a,
+0xdf,0xfe,0xc8,0x20,0x00,0x17,0x01,0x02,0x03,0x01,0x12,0x0f,0x6e,0x02,0x21,0x30,
+0x00,0xfc,0x01,0x11,0xef,0x2b,0x01,0x01,0x48,0x01,0x43,0x27,0xef,0xff,0x80,0x9e,
+0x01,0x32,0x1c,0xff,0xf4,0x0a,0x00,0x00,0x7e,0x08,0x04,0x0a,0x00,0x33,0x2f,0xff,
+0x50,0x0a,0x00,0x32,0x0a,0xff,0xc0,0x0a,0x00,0x00,0x30,0x09,0x03,0x0a,0x00,0x10,
+0x01,0x4c,0x09,0x12,0x50,0x9a,0x02,0x14,0xf6,0x0a,0x00,0x24,0xef,0xf7,0x0a,0x00,
+0x1e,0xdf,0x0a,0x00,0x07,0x1e,0x00,0x05,0x32,0x00,0x15,0x02,0xe7,0x01,0x01,0x2a,
+0x09,0x12,0x50,0x6d,0x02,0x04,0x6e,0x00,0x33,0x3f,0xff,0x60,0x0a,0x00,0x25,0xdf,
+0xfe,0xaa,0x00,0x12,0xf5,0x0a,0x00,0x21,0x38,0xff,0xbe,0x00,0x69,0xed,0xdd,0xef,
+0xff,0xff,0xf8,0xe6,0x00,0x00,0xfa,0x00,0x16,0xc8,0xfa,0x00,0x37,0xff,0xff,0xf1,
+0x09,0x00,0x02,0xab,0x07,0x14,0xe0,0x89,0x00,0x1f,0x00,0x09,0x00,0x2e,0x03,0x7e,
+0x02,0x07,0x09,0x00,0x6f,0xed,0xdd,0xdd,0xdd,0xdd,0xd5,0x5a,0x00,0x2f,0x0e,0x09,
+0x00,0x01,0x5a,0x00,0x24,0xdd,0xd3,0xcf,0x00,0x1d,0xf3,0x09,0x00,0x23,0xd0,0xff,
+0x8a,0x03,0x04,0xe9,0x00,0x3b,0xb0,0xff,0xf5,0x46,0x00,0x0f,0x11,0x00,0x21,0x11,
+0xfe,0x78,0x00,0x23,0x10,0x0f,0x46,0x01,0x13,0x00,0x66,0x00,0x1e,0x10,0x55,0x00,
+0x0f,0x11,0x00,0x40,0x00,0x01,0x00,0x41,0x59,0xde,0xfe,0xda,0x16,0x00,0x12,0x4d,
+0xc7,0x04,0x00,0x64,0x05,0x31,0xff,0xff,0xee,0xcc,0x02,0xa2,0x6f,0xff,0xf7,0x10,
+0x00,0x17,0xef,0xff,0x50,0x02,0x25,0x03,0x33,0x1d,0xff,0xe0,0xcf,0x03,0x10,0x03,
+0x57,0x04,0x13,0x80,0x73,0x03,0x13,0x4f,0xcf,0x03,0x44,0x36,0x65,0x8f,0xfe,0x57,
+0x00,0x25,0xbf,0xfb,0x93,0x03,0x1e,0xf9,0xa7,0x03,0x01,0x0a,0x00,0x51,0x5d,0xdd,
+0xdd,0xdd,0xdb,0x0a,0x00,0x10,0x6f,0x7a,0x00,0x06,0x0a,0x00,0x04,0x32,0x00,0x44,
+0x7f,0xfe,0xaf,0xfc,0x0a,0x00,0x24,0x7f,0xff,0x0a,0x00,0x33,0x3f,0xff,0x50,0x0a,
+0x00,0x33,0x0e,0xff,0xc0,0x0a,0x00,0x12,0x07,0x86,0x08,0x00,0xd7,0x0c,0x31,0xdf,
+0xff,0x50,0x2d,0x0d,0x30,0xfe,0x00,0x2f,0x0b,0x0a,0x71,0x02,0x7e,0xff,0xf9,0x00,
+0x03,0xef,0xd2,0x00,0x00,0x3c,0x06,0x11,0x1a,0x5f,0x01,0x11,0xe6,0xc2,0x08,0x46,
+0xce,0xff,0xdc,0x84,0x15,0x01,0x54,0x0c,0xff,0xa0,0xff,0xf5,0x46,0x04,0x0f,0x15,
+0x00,0x4d,0x04,0x01,0x00,0x25,0xfa,0x0f,0x0b,0x00,0x13,0xa0,0x0c,0x02,0x3f,0xdd,
+0xff,0xfa,0x93,0x00,0x62,0x05,0x15,0x00,0x2f,0xcf,0xf9,0x02,0x00,0x1f,0x23,0x00,
+0x00,0x69,0x04,0x0f,0x09,0x00,0x86,0x34,0x08,0x88,0x20,0x0b,0x05,0x11,0x60,0x49,
+0x08,0x41,0xf0,0x0d,0xff,0xa0,0xfb,0x00,0x41,0xc0,0x08,0xff,0xf3,0x33,0x07,0x20,
+0x70,0x01,0x91,0x0e,0x30,0x18,0xff,0xfe,0x88,0x02,0x00,0x31,0x02,0x13,0xf4,0xd9,
+0x0b,0xc0,0xfe,0x30,0x00,0x00,0x00,0x17,0xbe,0xff,0xea,0x60,0x00,0x00,0xd0,0x0f,
+0xff,0x50,0x00,0x00,0x00,0x00,0x0b,0xff,0xf5,0x00,0xff,0xf5,0x0a,0x00,0x42,0x09,
+0xff,0xf7,0x00,0x15,0x00,0x42,0x07,0xff,0xf9,0x00,0x15,0x00,0x42,0x06,0xff,0xfb,
+0x00,0x15,0x00,0x42,0x04,0xff,0xfc,0x00,0x15,0x00,0x42,0x03,0xff,0xfe,0x10,0x15,
+0x00,0x42,0x02,0xef,0xfe,0x20,0x15,0x00,0x52,0x01,0xdf,0xff,0x30,0x00,0x15,0x00,
+0x11,0xcf,0x58,0x00,0x00,0x15,0x00,0x42,0xaf,0xff,0x70,0x00,0x15,0x00,0x42,0x9f,
+0xff,0x90,0x00,0x15,0x00,0x42,0x7f,0xff,0xe0,0x00,0x15,0x00,0x42,0xaf,0xff,0xff,
+0x70,0x15,0x00,0x00,0x01,0x00,0x12,0x30,0x15,0x00,0x52,0xff,0xc2,0xef,0xfe,0x10,
+0x15,0x00,0x42,0xd1,0x04,0xff,0xfb,0x15,0x00,0x63,0xe1,0x00,0x08,0xff,0xf7,0x00,
+0x7e,0x00,0x43,0x0c,0xff,0xf3,0x00,0x93,0x00,0x43,0x2e,0xff,0xe1,0x00,0xa8,0x00,
+0x43,0x5f,0xff,0xb0,0x00,0xbd,0x00,0x10,0x9f,0x57,0x00,0x02,0xd2,0x00,0x33,0xcf,
+0xff,0x30,0x15,0x00,0x10,0x02,0xb4,0x00,0x02,0x15,0x00,0x33,0x05,0xff,0xfb,0x15,
+0x00,0x01,0xf2,0x00,0x02,0x15,0x00,0x00,0x57,0x00,0x03,0x15,0x00,0x14,0x00,0x13,
+0x00,0x1f,0x00,0x11,0x00,0xa1,0x20,0xfe,0xdd,0x01,0x00,0x32,0xd6,0x0f,0xff,0x01,
+0x00,0x13,0x80,0x08,0x00,0x41,0xf8,0x0f,0xff,0xf8,0x22,0x00,0x00,0x0b,0x01,0x53,
+0xff,0x70,0xff,0xff,0xe0,0x0e,0x00,0x54,0x8f,0xff,0xf7,0x0f,0xff,0x3e,0x00,0x11,
+0x0e,0x1b,0x00,0x01,0x76,0x01,0x00,0x28,0x01,0x01,0x1b,0x00,0x12,0xf1,0x0e,0x00,
+0x10,0xbf,0x1b,0x00,0x13,0xfd,0xb2,0x01,0x81,0x1f,0xff,0xcf,0xf7,0x0f,0xff,0x7f,
+0xfe,0x0d,0x00,0x91,0x08,0xff,0xca,0xff,0x70,0xff,0xf2,0xff,0xf4,0x0e,0x00,0x90,
+0xef,0xf5,0xbf,0xf7,0x0f,0xff,0x19,0xff,0xa0,0x0d,0x00,0x30,0x4f,0xfe,0x0b,0x1b,
+0x00,0x20,0x3f,0xff,0xd3,0x01,0x30,0x0a,0xff,0x90,0x1b,0x00,0x20,0x20,0xcf,0xcb,
+0x01,0xf0,0x02,0x01,0xff,0xf2,0x0c,0xff,0x70,0xff,0xf3,0x06,0xff,0xd0,0x00,0x00,
+0x00,0x7f,0xfc,0x00,0x51,0x00,0xf0,0x02,0x30,0x0f,0xff,0x40,0x00,0x00,0x0d,0xff,
+0x60,0x0d,0xff,0x70,0xff,0xf4,0x00,0x9f,0xfa,0x76,0x02,0x80,0xe0,0x00,0xdf,0xf7,
+0x0f,0xff,0x40,0x03,0x89,0x00,0xf0,0x04,0xaf,0xf9,0x00,0x0e,0xff,0x70,0xff,0xf5,
+0x00,0x0c,0xff,0x70,0x00,0x1f,0xff,0x20,0x00,0xef,0xf7,0xfa,0x00,0x81,0x6f,0xfd,
+0x00,0x07,0xff,0xc0,0x00,0x0f,0x1b,0x00,0x91,0x00,0xff,0xf3,0x00,0xdf,0xf6,0x00,
+0x00,0xff,0x1b,0x00,0x64,0x09,0xff,0xa0,0x3f,0xff,0x00,0x1b,0x00,0x54,0x3f,0xff,
+0x09,0xff,0x90,0x1b,0x00,0x55,0x00,0xcf,0xf7,0xff,0xf2,0x1b,0x00,0x22,0x06,0xff,
+0xe0,0x02,0x01,0x1b,0x00,0x00,0x89,0x02,0x14,0x60,0x1b,0x00,0x00,0x52,0x02,0x16,
+0xf0,0x1b,0x00,0x10,0x03,0x1c,0x03,0x05,0x1b,0x00,0x33,0x0c,0xff,0x20,0x1b,0x00,
+0x22,0xa0,0x00,0x4e,0x03,0x14,0xa0,0x4e,0x01,0x31,0xbf,0xfa,0x0f,0x29,0x03,0x03,
+0x15,0x00,0x15,0xf9,0x15,0x00,0x25,0xff,0xf4,0x15,0x00,0x24,0xff,0xd0,0x15,0x00,
+0x33,0xaf,0xff,0x80,0x15,0x00,0x43,0xf5,0xaf,0xff,0x30,0x15,0x00,0x34,0x51,0xef,
+0xfc,0x15,0x00,0x33,0x05,0xff,0xf7,0x15,0x00,0x43,0x50,0x0b,0xff,0xf2,0x15,0x00,
+0x43,0x00,0x2f,0xff,0xb0,0x15,0x00,0x43,0x00,0x7f,0xff,0x60,0x15,0x00,0x43,0x00,
+0xcf,0xfe,0x10,0x15,0x00,0x34,0x02,0xff,0xfa,0x15,0x00,0x32,0x08,0xff,0xf4,0x15,
+0x00,0x00,0x62,0x01,0x12,0xe0,0x15,0x00,0x00,0x12,0x01,0x34,0x90,0xbf,0xfa,0x38,
+0x03,0x13,0x3b,0x15,0x00,0x34,0x00,0xef,0xfd,0x15,0x00,0x34,0x04,0xff,0xff,0x15,
+0x00,0x43,0x0a,0xff,0xff,0xfa,0x68,0x02,0x15,0x1e,0x15,0x00,0x25,0x00,0x5f,0x15,
+0x00,0x25,0x00,0xbf,0x15,0x00,0xb1,0x01,0xff,0xfa,0x00,0x00,0x00,0x49,0xdf,0xfe,
+0xc8,0x20,0x72,0x02,0x10,0xcf,0x83,0x02,0x12,0xa1,0x54,0x02,0x00,0x01,0x00,0x10,
+0xe2,0x47,0x01,0x50,0xff,0xa4,0x10,0x15,0xbf,0xc2,0x03,0x11,0xef,0xf0,0x00,0x50,
+0x6f,0xff,0xb0,0x00,0x7f,0x00,0x02,0x10,0x00,0x07,0x00,0x13,0x0e,0x50,0x01,0x31,
+0xdf,0xfa,0x04,0xf0,0x03,0x00,0x94,0x04,0x32,0xf0,0x8f,0xfd,0x8c,0x02,0x33,0x2f,
+0xff,0x4b,0x1f,0x00,0x63,0x00,0xef,0xf7,0xdf,0xf8,0x00,0xc1,0x03,0x33,0x9e,0xff,
+0x70,0xac,0x02,0x43,0xf9,0xef,0xf7,0x00,0x8f,0x01,0x15,0xae,0x15,0x00,0x16,0xfa,
+0x15,0x00,0x11,0x9d,0x6d,0x01,0x00,0x21,0x04,0x34,0xf9,0xbf,0xfa,0xfb,0x02,0x33,
+0x78,0xff,0xe0,0xbd,0x00,0x21,0xf4,0x4f,0x8f,0x04,0x00,0x94,0x00,0x22,0x00,0xef,
+0x20,0x00,0x30,0x0d,0xff,0xb0,0x41,0x01,0x01,0x12,0x05,0x53,0xf4,0x00,0x0e,0xff,
+0xf3,0x49,0x04,0x71,0x00,0x4f,0xff,0xf9,0x30,0x00,0x4a,0xe9,0x01,0x11,0x5f,0xdc,
+0x00,0x10,0xfe,0x3b,0x00,0x10,0x2c,0x0a,0x00,0x11,0xfb,0xfd,0x01,0x51,0x04,0x9d,
+0xff,0xec,0x83,0xdc,0x04,0x00,0x1d,0x00,0x43,0xd9,0x40,0x00,0x00,0x9c,0x03,0x10,
+0xfd,0x9c,0x04,0x40,0xfe,0xee,0xee,0xef,0x11,0x02,0x02,0x44,0x01,0x43,0x29,0xff,
+0xff,0x20,0x4e,0x01,0x35,0x4f,0xff,0xa0,0xa5,0x04,0x13,0xf0,0x0a,0x00,0x16,0x03,
+0xa4,0x04,0x2d,0xff,0xf5,0x0a,0x00,0x06,0x1e,0x00,0x3b,0x08,0xff,0xf0,0x46,0x00,
+0x21,0x01,0x49,0x5a,0x00,0x02,0x01,0x00,0x14,0xf5,0x82,0x00,0x10,0xfc,0x82,0x00,
+0x67,0xed,0xdd,0xdd,0xdc,0xb7,0x30,0x43,0x04,0x0f,0x0a,0x00,0x48,0x00,0x35,0x01,
+0x51,0xad,0xff,0xec,0x72,0x00,0x19,0x01,0x10,0xdf,0x84,0x00,0x12,0x90,0xf1,0x01,
+0x01,0x11,0x01,0x11,0x10,0x87,0x03,0x60,0x93,0x10,0x26,0xcf,0xff,0xd0,0xe6,0x01,
+0x10,0xe2,0xcc,0x00,0x00,0x39,0x03,0x11,0xaf,0x66,0x03,0x00,0x07,0x00,0x33,0x01,
+0xff,0xf7,0x82,0x04,0x23,0x80,0x06,0x9b,0x04,0x40,0x09,0xff,0xe0,0x0a,0x07,0x03,
+0x01,0xae,0x02,0x44,0xf2,0x0d,0xff,0x80,0xc6,0x01,0x33,0x0f,0xff,0x60,0x15,0x05,
+0x15,0xf6,0x83,0x00,0x31,0xef,0xf7,0x1f,0x64,0x02,0x00,0x5b,0x02,0x17,0xf8,0x0b,
+0x00,0x07,0x21,0x00,0x07,0x37,0x00,0x16,0x0e,0x4d,0x00,0x16,0x0b,0x63,0x00,0x16,
+0x07,0x79,0x00,0x04,0x8f,0x00,0x00,0x29,0x00,0x03,0xa5,0x00,0x71,0x9f,0xff,0x20,
+0x00,0x2f,0xff,0xd2,0xb2,0x02,0x11,0xf8,0xd1,0x00,0x65,0x82,0x00,0x15,0xcf,0xff,
+0xc0,0xe7,0x00,0x25,0xfc,0x10,0xfd,0x00,0x15,0xf7,0x13,0x01,0x03,0x09,0x01,0x00,
+0x01,0x00,0x12,0x3e,0x22,0x00,0x01,0x78,0x00,0x34,0xcf,0xff,0xe3,0x17,0x00,0x35,
+0x0a,0xff,0xd1,0x45,0x01,0x26,0x7d,0x10,0x51,0x01,0x02,0xcd,0x01,0x35,0xed,0xa6,
+0x00,0x59,0x02,0x10,0xf7,0x0a,0x00,0x31,0xee,0xee,0xee,0x5e,0x01,0x02,0xff,0x01,
+0x34,0x7f,0xff,0xf5,0x09,0x07,0x24,0xef,0xfd,0x91,0x01,0x15,0x6f,0x6d,0x02,0x33,
+0x1f,0xff,0x50,0x0a,0x00,0x3d,0x0f,0xff,0x60,0x14,0x00,0x05,0x28,0x00,0x35,0x02,
+0xef,0xfc,0x50,0x00,0x12,0xf3,0x3b,0x02,0x10,0xef,0xee,0x04,0x03,0x78,0x00,0x14,
+0xc3,0x82,0x00,0x14,0xfb,0xf5,0x01,0x10,0x6f,0x13,0x01,0x03,0x73,0x04,0x13,0xa0,
+0x0a,0x00,0x34,0x06,0xff,0xf2,0x13,0x02,0x24,0xdf,0xfb,0x0a,0x00,0x14,0x5f,0xa9,
+0x07,0x00,0x69,0x03,0x03,0x0a,0x00,0x34,0x05,0xff,0xf3,0xaa,0x00,0x15,0xdf,0xb2,
+0x07,0x10,0x5f,0x25,0x06,0x12,0x50,0x92,0x03,0x13,0xc0,0x0a,0x00,0x10,0x05,0x99,
+0x03,0x50,0x02,0x8b,0xef,0xfe,0xb6,0x0e,0x00,0x11,0x19,0x68,0x03,0xf3,0x09,0x60,
+0x00,0x00,0x1d,0xff,0xff,0xfe,0xef,0xff,0xff,0xa0,0x00,0x0c,0xff,0xfa,0x30,0x00,
+0x04,0xcf,0xff,0x80,0x04,0xff,0xf7,0xa2,0x01,0x22,0x9f,0xfe,0xed,0x01,0x42,0xf9,
+0x0b,0xff,0xa0,0xcb,0x01,0x22,0xd0,0xbf,0xf7,0x06,0x33,0x5b,0xba,0x08,0xf3,0x06,
+0x00,0x82,0x02,0x15,0xc1,0x26,0x07,0x24,0xf8,0x20,0x0a,0x00,0x22,0xff,0xc7,0x1d,
+0x04,0x61,0x3c,0xff,0xff,0xff,0xd7,0x10,0x7a,0x03,0x10,0xaf,0x6a,0x07,0x02,0x1f,
+0x02,0x24,0x9e,0xff,0x35,0x00,0x12,0x05,0xf5,0x01,0x02,0x35,0x00,0x04,0x02,0x03,
+0x43,0xcf,0xfc,0x6b,0xb9,0xcf,0x04,0x33,0xe7,0xff,0xf0,0x65,0x04,0x32,0x3f,0xff,
+0x50,0xe2,0x01,0x41,0xd0,0xcf,0xfe,0x30,0x64,0x02,0xf0,0x02,0xf9,0x02,0xff,0xff,
+0x93,0x00,0x00,0x28,0xff,0xff,0x20,0x04,0xef,0xff,0xff,0xed,0xff,0x67,0x01,0x23,
+0x01,0xaf,0x37,0x04,0x70,0x00,0x00,0x16,0xbd,0xff,0xec,0x94,0xa1,0x00,0x04,0x01,
+0x00,0x15,0xa2,0x0a,0x00,0x60,0xfa,0x1e,0xee,0xee,0xee,0xef,0x00,0x02,0x21,0xee,
+0x90,0xe4,0x00,0x14,0xf6,0x29,0x02,0x14,0x0e,0xd9,0x02,0x0f,0x15,0x00,0xc7,0x32,
+0x8f,0xfc,0x00,0xa4,0x05,0x33,0xf8,0xff,0xc0,0x5d,0x01,0x0f,0x13,0x00,0x7d,0x13,
+0xd0,0x13,0x00,0x05,0x3e,0x09,0x13,0xe4,0x70,0x02,0x52,0xbf,0xfb,0x0f,0xff,0x80,
+0x77,0x02,0x41,0x70,0xaf,0xff,0x40,0xd3,0x06,0xa0,0xf1,0x01,0xef,0xff,0x82,0x00,
+0x00,0x5d,0xff,0xf6,0x31,0x07,0x54,0xfe,0xde,0xff,0xff,0xf8,0x4f,0x07,0x10,0xe6,
+0x2b,0x00,0x50,0x39,0xce,0xff,0xdb,0x60,0x16,0x03,0x23,0x50,0x00,0x57,0x00,0x34,
+0x40,0xef,0xfa,0x10,0x07,0x43,0xe0,0x09,0xff,0xf0,0xbf,0x04,0x23,0xf8,0x00,0x64,
+0x02,0x01,0x93,0x03,0x23,0xdf,0xfa,0x22,0x00,0x32,0xc0,0x00,0x07,0x23,0x00,0x01,
+0xc8,0x04,0x13,0x2f,0xef,0x03,0x00,0xae,0x09,0x22,0xcf,0xfa,0x22,0x00,0x10,0xb0,
+0xb5,0x00,0x11,0xf0,0x22,0x00,0x12,0xf5,0x15,0x04,0x01,0xc8,0x04,0x01,0x8e,0x05,
+0x11,0xfa,0x22,0x00,0x11,0x90,0x82,0x03,0x11,0xf0,0x25,0x05,0x01,0x94,0x01,0x00,
+0x23,0x00,0x03,0xdd,0x00,0x20,0x9f,0xfa,0x22,0x00,0x12,0x80,0x9e,0x06,0x10,0xf0,
+0xf5,0x09,0x03,0x4d,0x07,0x10,0x50,0xf3,0x09,0x11,0x00,0xfb,0x05,0x53,0xfa,0x00,
+0x0c,0xff,0x60,0x99,0x0a,0x44,0xf0,0x01,0xff,0xf1,0xbe,0x00,0x43,0x50,0x7f,0xfb,
+0x00,0xd5,0x00,0x23,0xfa,0x0c,0xe0,0x00,0x00,0x42,0x00,0x25,0xff,0xe0,0x11,0x05,
+0x24,0xcf,0xf9,0xfe,0x01,0x13,0x4f,0x41,0x0c,0x01,0x0a,0x02,0x03,0x63,0x01,0x01,
+0xd7,0x03,0x04,0xf5,0x0a,0x00,0xea,0x08,0x12,0x20,0xf2,0x07,0x02,0x89,0x01,0x12,
+0xb0,0x4e,0x04,0x32,0x09,0xff,0xc0,0x5a,0x06,0x02,0x8c,0x01,0x32,0xc0,0x5f,0xff,
+0xc4,0x00,0x12,0xf4,0x2c,0x00,0x11,0x01,0xe9,0x07,0x11,0x03,0xde,0x03,0x00,0x83,
+0x04,0x31,0x0d,0xff,0x70,0x00,0x01,0x00,0x89,0x08,0x00,0x92,0x0a,0x21,0x9f,0xfb,
+0xac,0x00,0x20,0xdf,0xf1,0x16,0x00,0x50,0xfd,0x00,0x06,0xff,0xe0,0xa4,0x00,0x31,
+0xe8,0xff,0x60,0xef,0x0a,0x20,0x00,0x2f,0x74,0x00,0x43,0x5f,0xfa,0x4f,0xfa,0xa1,
+0x02,0x20,0xef,0xf6,0x94,0x00,0x10,0x60,0x26,0x00,0x00,0xbe,0x0a,0x10,0x0a,0x3d,
+0x01,0xa0,0xef,0xf1,0x0b,0xff,0x30,0x00,0x05,0xff,0xe0,0x00,0xc8,0x0a,0x62,0x00,
+0x2f,0xfc,0x00,0x6f,0xf7,0x3a,0x01,0xa2,0x02,0xff,0xf1,0x00,0x07,0xff,0x80,0x02,
+0xff,0xb0,0x23,0x01,0x00,0x1e,0x0b,0x50,0xbf,0xf3,0x00,0x0e,0xff,0xe4,0x0a,0x00,
+0x31,0x02,0xb1,0xf8,0x00,0x0f,0xfe,0x00,0x00,0x9f,0xf4,0x00,0x3f,0xff,0x52,0x04,
+0x90,0xb0,0x04,0xff,0xa0,0x00,0x05,0xff,0x80,0x07,0xde,0x00,0x00,0x15,0x00,0x82,
+0x9f,0xf5,0x00,0x00,0x0f,0xfd,0x00,0xbf,0x3d,0x0d,0x21,0xf2,0x0d,0xda,0x01,0x41,
+0xf1,0x0e,0xff,0x30,0xb6,0x00,0x30,0x61,0xff,0xc0,0x36,0x00,0x12,0x52,0x03,0x02,
+0x40,0x8f,0xf9,0x6f,0xf8,0x36,0x00,0x32,0xfa,0x5f,0xfc,0xe8,0x06,0x11,0xb9,0x27,
+0x00,0x22,0xef,0xd7,0xc0,0x01,0x41,0x0f,0xfe,0xdf,0xe0,0x75,0x01,0x22,0xbf,0xf4,
+0xc9,0x04,0x01,0xe3,0x09,0x00,0xf4,0x08,0x03,0x6a,0x01,0x21,0xff,0x50,0xa0,0x01,
+0x23,0xff,0xc0,0x17,0x0a,0x12,0xf1,0xc7,0x01,0x13,0xf9,0xb8,0x01,0x19,0xfc,0x09,
+0x05,0x01,0x48,0x01,0x00,0x65,0x00,0x01,0x39,0x01,0x03,0xa3,0x09,0x41,0xdf,0xff,
+0x20,0xdf,0x2a,0x0c,0x00,0x12,0x00,0x32,0x03,0xff,0xfa,0x86,0x06,0x51,0xd0,0x00,
+0x09,0xff,0xf4,0x7a,0x00,0x10,0xf3,0x79,0x0a,0x11,0xd0,0x1f,0x05,0x00,0x62,0x00,
+0x00,0x98,0x00,0x31,0xdf,0xfe,0x10,0x79,0x0a,0x33,0x20,0x00,0x7f,0xe7,0x0d,0x52,
+0xfb,0x00,0x1f,0xff,0xb0,0x61,0x05,0x25,0xf5,0x0b,0x70,0x02,0x34,0xe5,0xff,0xf7,
+0x06,0x02,0x01,0xbc,0x01,0x02,0x07,0x06,0x05,0x34,0x02,0x15,0xef,0x7e,0x07,0x13,
+0x2f,0xfe,0x0c,0x00,0x26,0x0a,0x04,0x5d,0x0d,0x00,0xb5,0x0a,0x12,0xe1,0xc7,0x00,
+0x53,0xef,0xfe,0x5f,0xff,0x90,0x3e,0x00,0x12,0x40,0xa5,0x03,0x00,0x64,0x09,0x32,
+0x01,0xff,0xfd,0x68,0x00,0x10,0xf1,0xe3,0x03,0x01,0x4a,0x02,0x10,0xf6,0xfd,0x00,
+0x10,0xf2,0x92,0x00,0x11,0xfc,0x77,0x00,0x12,0xc0,0x8e,0x0e,0x00,0x03,0x01,0x52,
+0x60,0x00,0x6f,0xff,0x80,0x77,0x00,0x42,0x10,0x1f,0xff,0xe0,0x63,0x00,0xc0,0xfa,
+0x0a,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xf4,0x40,0x7f,0xff,0x50,0x00,
+0x01,0x00,0x61,0x0c,0xff,0xf1,0x0e,0xff,0xd0,0x0b,0x00,0x61,0x4f,0xff,0x70,0x06,
+0xff,0xf6,0x0b,0x00,0x60,0xcf,0xfe,0x00,0x00,0xdf,0xfd,0x0a,0x00,0x30,0x04,0xff,
+0xf6,0x1a,0x00,0x11,0x60,0x2b,0x00,0x13,0xd0,0x05,0x00,0x71,0x00,0x5f,0xff,0x40,
+0x00,0x00,0x03,0x2d,0x00,0x20,0xcf,0xfc,0x27,0x00,0x70,0xaf,0xfd,0x00,0x00,0x05,
+0xff,0xf3,0x0b,0x00,0x70,0x2f,0xff,0x60,0x00,0x0d,0xff,0xa0,0x0b,0x00,0x70,0x09,
+0xff,0xd0,0x00,0x5f,0xff,0x20,0x0b,0x00,0x71,0x01,0xff,0xf6,0x00,0xdf,0xf9,0x00,
+0x01,0x00,0x52,0x8f,0xfd,0x05,0xff,0xf1,0x0b,0x00,0x52,0x0e,0xff,0x6d,0xff,0x80,
+0x0b,0x00,0x53,0x06,0xff,0xff,0xfe,0x00,0x01,0x00,0x34,0xdf,0xff,0xf7,0x0b,0x00,
+0x13,0x5f,0x9e,0x00,0x01,0x2d,0x00,0x1f,0x70,0x0b,0x00,0x54,0x23,0x4f,0xff,0x01,
+0x00,0x16,0x90,0x0a,0x00,0x21,0x3e,0xee,0x01,0x00,0x34,0xef,0xff,0x80,0xa5,0x00,
+0x04,0xaf,0x00,0x53,0x09,0xff,0xf4,0x00,0x00,0x43,0x01,0x13,0x90,0x0a,0x00,0x25,
+0xef,0xfd,0x1d,0x00,0x15,0xf3,0x1d,0x00,0x03,0x3a,0x00,0x15,0x01,0x1d,0x00,0x35,
+0x0a,0xff,0xf2,0xe7,0x00,0x14,0x70,0x1d,0x00,0x13,0xfc,0x13,0x00,0x15,0x0b,0x1d,
+0x00,0x32,0x6f,0xff,0x60,0x09,0x00,0x54,0x02,0xff,0xfb,0x00,0x00,0xb8,0x01,0x03,
+0x0a,0x00,0x03,0xca,0x01,0x00,0x1d,0x00,0x15,0xfa,0x1d,0x00,0x23,0xe1,0x00,0x6b,
+0x01,0x04,0x1d,0x00,0x15,0x03,0x1d,0x00,0x35,0x0d,0xff,0xe0,0x57,0x00,0x21,0xed,
+0xdd,0x01,0x00,0x24,0xd1,0x7f,0xe6,0x00,0x16,0xf2,0x0a,0x00,0x81,0x5c,0xcc,0xcc,
+0xc2,0x7f,0xff,0xff,0xf3,0x04,0x00,0x3f,0xfd,0x00,0x00,0x04,0x00,0x62,0x16,0xff,
+0x84,0x00,0x22,0x1f,0xff,0xb6,0x00,0x21,0xbf,0xf5,0x07,0x00,0x31,0x05,0xff,0xb0,
+0x08,0x00,0x31,0x0f,0xff,0x10,0x08,0x00,0x23,0x9f,0xf7,0xe8,0x00,0x13,0xd0,0xe6,
+0x00,0x12,0x30,0x1e,0x01,0x22,0xf9,0x00,0x7f,0x02,0x13,0xf0,0x54,0x01,0x12,0x50,
+0x6f,0x01,0x03,0x48,0x01,0x03,0x46,0x01,0x13,0x09,0x7e,0x01,0x23,0x3f,0xfd,0xdb,
+0x01,0x02,0xb4,0x01,0x13,0x07,0xcf,0x01,0x0f,0x7b,0x00,0x49,0xff,0x04,0x05,0x88,
+0x30,0xac,0xcc,0xcc,0x9d,0xff,0xff,0xfc,0xdf,0xff,0xff,0xc0,0x00,0x7f,0xfc,0x00,
+0x07,0x07,0x00,0x50,0x30,0xca,0xcc,0xdf,0x70,0x00,0x82,0xcd,0xff,0xff,0xfc,0x00,
+0x00,0x0d,0xfc,0xbf,0x00,0x11,0xf3,0xca,0x03,0x21,0xff,0x90,0xf2,0x00,0x11,0xff,
+0x00,0x01,0x20,0xcf,0xf6,0x0e,0x01,0x10,0xf2,0xda,0x00,0xf0,0x11,0x4f,0xfa,0x0a,
+0xff,0x30,0x00,0x0a,0xff,0x40,0x4f,0xfa,0x00,0x01,0xff,0xd0,0x00,0xef,0xf1,0x00,
+0x7f,0xf7,0x00,0x08,0xff,0x70,0x0d,0xff,0x10,0x00,0x2f,0xfd,0x04,0x15,0x01,0x40,
+0xbf,0xf4,0xaf,0xf5,0x20,0x01,0x32,0xa0,0xab,0xbb,0x01,0x00,0x14,0x2e,0x4e,0x02,
+0x13,0xef,0x09,0x00,0xa0,0x20,0x68,0x87,0x00,0x00,0x3f,0xff,0x80,0x00,0x05,0xde,
+0x02,0x50,0x8f,0xfc,0x00,0x00,0x0b,0xdd,0x02,0xd0,0xdf,0xe1,0x00,0x00,0x06,0xbd,
+0xff,0xda,0x40,0x00,0x00,0x00,0x4e,0x28,0x00,0x10,0xb0,0x13,0x03,0x20,0xfd,0xbd,
+0x09,0x00,0x91,0x2f,0xff,0xb2,0x00,0x01,0x9f,0xff,0x50,0x08,0x60,0x01,0x51,0xbf,
+0xfa,0x00,0x58,0x85,0x2f,0x04,0x14,0xd0,0x3a,0x03,0x00,0x06,0x00,0x30,0x35,0x56,
+0x69,0x68,0x01,0x11,0x6c,0x65,0x00,0x31,0x00,0x02,0xdf,0x08,0x00,0x60,0xf0,0x00,
+0xef,0xff,0x84,0x10,0x22,0x00,0x30,0x8f,0xfe,0x10,0x98,0x00,0x42,0xf0,0x0d,0xff,
+0x60,0x33,0x00,0x00,0xed,0x00,0x00,0x11,0x00,0x30,0x0f,0xff,0x40,0xc2,0x01,0x41,
+0xff,0x00,0xef,0xfa,0x12,0x03,0xb0,0xf0,0x09,0xff,0xfa,0x20,0x03,0xaf,0xff,0xff,
+0x00,0x1e,0x42,0x00,0xf2,0x07,0xfe,0xff,0xf2,0x00,0x2d,0xff,0xff,0xff,0xfa,0x2f,
+0xff,0x50,0x00,0x07,0xcf,0xfe,0xa3,0x00,0x9a,0xa5,0x7e,0xea,0x79,0x00,0x33,0x08,
+0xff,0xb0,0x65,0x03,0x1f,0xfb,0x11,0x00,0x20,0x90,0x01,0x8c,0xef,0xd9,0x20,0x00,
+0x08,0xff,0xb4,0x1a,0x01,0xf0,0x07,0x70,0x00,0x8f,0xfe,0xff,0xff,0xef,0xff,0xff,
+0x60,0x08,0xff,0xff,0xb3,0x00,0x05,0xef,0xff,0x10,0x8f,0xff,0xa0,0x94,0x01,0x41,
+0xf9,0x08,0xff,0xe0,0x39,0x00,0x32,0xe0,0x8f,0xfb,0x5e,0x05,0x12,0x38,0x44,0x00,
+0x42,0xef,0xf6,0x8f,0xfb,0xec,0x03,0x12,0x78,0x11,0x00,0x42,0xbf,0xf8,0x8f,0xfb,
+0x68,0x02,0x12,0x88,0x11,0x00,0x42,0xcf,0xf7,0x8f,0xfb,0xd4,0x04,0x31,0x68,0xff,
+0xb0,0x20,0x04,0x31,0xf3,0x8f,0xfe,0x7d,0x00,0x21,0xfe,0x08,0x0e,0x04,0xf0,0x0c,
+0x3f,0xff,0x90,0x8f,0xff,0xfb,0x30,0x00,0x5e,0xff,0xf1,0x08,0xff,0xdf,0xff,0xfd,
+0xff,0xff,0xf6,0x00,0x8f,0xf8,0x5f,0xff,0xff,0xff,0xf6,0xd8,0x01,0x41,0x18,0xdf,
+0xfd,0x92,0x03,0x06,0x12,0xad,0x98,0x01,0x10,0x0b,0x11,0x01,0xe0,0xb1,0x00,0x00,
+0x1d,0xff,0xff,0xdc,0xff,0xff,0xd0,0x00,0x0a,0xff,0xf7,0xa2,0x03,0x41,0x90,0x04,
+0xff,0xf5,0x3b,0x01,0x31,0x20,0xbf,0xfb,0x77,0x00,0x12,0xf6,0x54,0x01,0x58,0x08,
+0xff,0x93,0xff,0xf1,0xa3,0x01,0x00,0x70,0x01,0x13,0xe0,0x11,0x00,0x03,0x3b,0x05,
+0x14,0x04,0x11,0x00,0x13,0x3f,0x4b,0x03,0x12,0x00,0x4b,0x05,0x51,0x37,0x74,0x0b,
+0xff,0xa0,0x20,0x05,0x22,0x70,0x4f,0x6b,0x06,0xf0,0x00,0xf2,0x00,0xbf,0xff,0x60,
+0x00,0x06,0xff,0xf9,0x00,0x01,0xdf,0xff,0xfc,0xce,0xb7,0x02,0x51,0x01,0xbf,0xff,
+0xff,0xff,0x64,0x03,0x44,0x49,0xdf,0xfd,0x93,0xc2,0x05,0x3f,0x07,0xee,0xa0,0x96,
+0x01,0x28,0x60,0x00,0x00,0x07,0xce,0xfd,0x93,0x11,0x00,0x00,0xf6,0x01,0x00,0x52,
+0x01,0xf1,0x04,0x2e,0xff,0xff,0xee,0xff,0xfe,0xff,0xb0,0x0c,0xff,0xf9,0x10,0x01,
+0x8f,0xff,0xfb,0x04,0xff,0xf7,0xd2,0x00,0x22,0xb0,0xaf,0xf9,0x06,0x41,0xfb,0x0f,
+0xff,0x60,0x44,0x00,0x32,0xb2,0xff,0xf2,0x44,0x00,0x22,0x3f,0xff,0x55,0x00,0x32,
+0xb4,0xff,0xf0,0x11,0x00,0x13,0x4f,0x11,0x00,0x14,0xb3,0x11,0x00,0x32,0x2f,0xff,
+0x20,0x77,0x00,0x22,0xef,0xf6,0x11,0x00,0x31,0x0a,0xff,0xc0,0xee,0x00,0x11,0xb0,
+0x6a,0x07,0xf2,0x05,0x05,0xff,0xfb,0x00,0xbf,0xff,0x81,0x00,0x18,0xff,0xff,0xb0,
+0x01,0xef,0xff,0xfe,0xef,0xff,0xef,0xfb,0xd3,0x02,0x10,0x96,0xaa,0x00,0xd1,0x7c,
+0xef,0xda,0x30,0x4f,0xfb,0x00,0x00,0x02,0x9d,0xff,0xd9,0x30,0x48,0x00,0x20,0xff,
+0xff,0x2e,0x01,0x11,0x0a,0xd0,0x03,0x50,0xb0,0x00,0x07,0xff,0xf7,0xf9,0x05,0x41,
+0x60,0x01,0xff,0xf5,0xed,0x01,0x03,0xe8,0x00,0x51,0xef,0xf4,0x0e,0xff,0x50,0x66,
+0x00,0x12,0x72,0x98,0x01,0x24,0x8f,0xfa,0xdd,0x06,0x13,0xb5,0x08,0x00,0x41,0xfc,
+0x5f,0xff,0xcc,0x01,0x00,0x3c,0x94,0xff,0xf0,0x98,0x01,0x14,0xf6,0x95,0x06,0x01,
+0x77,0x03,0x13,0x20,0xeb,0x06,0xf0,0x02,0x4f,0xa0,0x00,0xaf,0xff,0xa2,0x00,0x01,
+0x8f,0xff,0x40,0x00,0xcf,0xff,0xfd,0xcd,0xff,0x49,0x05,0x10,0x9f,0x4c,0x00,0x00,
+0x6b,0x00,0x50,0x28,0xde,0xfe,0xc7,0x10,0x03,0x05,0xa0,0x8c,0xff,0xe6,0x00,0x00,
+0x3e,0xff,0xff,0xf7,0x00,0xd0,0x00,0x51,0xe6,0x00,0x07,0xff,0xf8,0xbb,0x02,0x11,
+0xb0,0x9f,0x02,0x00,0x40,0x01,0x02,0x9c,0x00,0x10,0x0f,0x06,0x00,0x01,0x8b,0x00,
+0x12,0x60,0x06,0x00,0x62,0x99,0x9f,0xff,0xb9,0x99,0x30,0x18,0x00,0x0f,0x06,0x00,
+0x4e,0x00,0xfc,0x01,0x60,0xa3,0x04,0xff,0xc0,0x00,0x3d,0x59,0x02,0x22,0x5f,0xfc,
+0xfc,0x01,0x33,0xfd,0xff,0xc0,0xfc,0x01,0x14,0xfc,0xfc,0x01,0x31,0xc0,0xaf,0xfd,
+0xfc,0x01,0x41,0xfc,0x0f,0xff,0x70,0x81,0x01,0x12,0xc2,0x3c,0x05,0x24,0x8f,0xfc,
+0xfc,0x01,0x13,0xc4,0xeb,0x01,0x14,0xfc,0xfc,0x01,0x14,0xc3,0x11,0x00,0x13,0x1f,
+0xfc,0x01,0x13,0xc0,0xfc,0x01,0x14,0xfc,0xfc,0x01,0x40,0xc0,0x4f,0xff,0x70,0xfc,
+0x01,0x14,0xfc,0xfc,0x01,0x21,0xc0,0x02,0xfc,0x01,0x22,0xff,0xfc,0xfc,0x01,0x32,
+0x98,0xff,0xc0,0xfc,0x01,0x24,0x8f,0xfb,0x5a,0x08,0x03,0xea,0x02,0x42,0xcf,0xf9,
+0x00,0x07,0xa7,0x06,0x31,0x50,0x09,0xf7,0x4c,0x00,0xf0,0x00,0xf1,0x02,0xff,0xfa,
+0x20,0x00,0x2a,0xff,0xf8,0x00,0x07,0xff,0xff,0xdc,0xdf,0x36,0x08,0x24,0x05,0xef,
+0x2e,0x03,0x11,0x5b,0x2e,0x03,0x2a,0x7e,0xea,0x05,0x03,0x0f,0x08,0x00,0x20,0x81,
+0x6b,0xef,0xea,0x40,0x00,0x8f,0xfb,0x2d,0x59,0x00,0x30,0x8f,0xfd,0xef,0xc1,0x04,
+0x50,0x50,0x8f,0xff,0xfc,0x40,0xb5,0x09,0x40,0x8f,0xff,0xb0,0x00,0xe5,0x05,0x11,
+0x8f,0x42,0x02,0x22,0xff,0xf5,0x38,0x00,0x2f,0xdf,0xf6,0x08,0x00,0x55,0xa3,0x1c,
+0xfa,0x06,0xff,0xf3,0x6f,0xff,0x30,0x9c,0x70,0x7d,0x09,0x3f,0x04,0xff,0xf0,0x05,
+0x00,0x1a,0x40,0x00,0x00,0x3d,0xe6,0x4c,0x01,0x10,0xf0,0x14,0x07,0x66,0x00,0x00,
+0x02,0xbc,0x40,0x00,0x01,0x00,0x20,0x7f,0xfd,0x1e,0x07,0x1f,0xd0,0x09,0x00,0x4a,
+0x10,0xfc,0xe3,0x01,0xff,0x04,0xb0,0x00,0x02,0xef,0xf8,0x02,0xee,0xff,0xff,0x30,
+0x2f,0xff,0xff,0x90,0x01,0xdf,0xfc,0x60,0x00,0x80,0x06,0x32,0x00,0x11,0x00,0x31,
+0x2e,0xff,0xd1,0x11,0x00,0x31,0x1d,0xff,0xe1,0x11,0x00,0x31,0x0c,0xff,0xf2,0x22,
+0x00,0x31,0x0b,0xff,0xf4,0x22,0x00,0x31,0x0a,0xff,0xf5,0x33,0x00,0x31,0x08,0xff,
+0xf7,0x33,0x00,0x33,0x07,0xff,0xf9,0xd9,0x04,0x12,0xfb,0xc7,0x0b,0x13,0xef,0xcc,
+0x02,0x01,0x46,0x08,0x00,0x74,0x04,0x00,0xe2,0x03,0x00,0x11,0x00,0x41,0xfe,0x2b,
+0xff,0xf3,0x11,0x00,0x42,0x30,0x1e,0xff,0xd0,0x77,0x00,0x01,0x30,0x04,0x22,0x8f,
+0xfb,0x93,0x0a,0x01,0x77,0x00,0x31,0xcf,0xfe,0x10,0x11,0x00,0x00,0xd5,0x0a,0x01,
+0x11,0x00,0x31,0x06,0xff,0xf7,0x99,0x00,0x00,0x17,0x0b,0x02,0xaa,0x00,0x7f,0x1e,
+0xff,0xd0,0x3e,0xee,0x4f,0xff,0x02,0x00,0x21,0xf1,0x02,0x9f,0xf8,0x01,0x8c,0xef,
+0xda,0x30,0x00,0x03,0xad,0xff,0xd8,0x10,0x00,0x9f,0xf9,0x5f,0x9d,0x00,0x81,0xaf,
+0xff,0xff,0xff,0xe4,0x00,0x9f,0xfd,0x59,0x03,0x10,0x4b,0x06,0x00,0x81,0xfe,0x10,
+0x9f,0xff,0xf8,0x10,0x00,0x7f,0x9d,0x04,0x70,0x9f,0xff,0x80,0x9f,0xff,0x60,0x00,
+0x36,0x03,0x11,0x60,0xec,0x04,0x21,0x9f,0xfd,0xc2,0x09,0x12,0xfc,0x2d,0x08,0x12,
+0x9f,0x49,0x05,0x11,0xf8,0x4d,0x07,0x23,0xf1,0x9f,0x6a,0x02,0x0f,0x0e,0x00,0x9b,
+0x23,0x8f,0xf8,0xb8,0x03,0x13,0xf9,0xb8,0x03,0x1f,0xfc,0xb8,0x03,0x7b,0x01,0xd8,
+0x06,0x11,0xeb,0xf0,0x0c,0x00,0x48,0x06,0x21,0xfd,0x30,0x79,0x08,0x40,0xdc,0xef,
+0xff,0xf4,0x11,0x00,0x11,0x91,0x1c,0x09,0x31,0x02,0xff,0xf8,0xbf,0x02,0x20,0xa0,
+0x0a,0x8e,0x06,0x00,0xae,0x00,0x12,0x0f,0x22,0x0d,0x32,0xef,0xf7,0x3f,0x6f,0x0e,
+0x23,0x9f,0xfa,0x74,0x08,0x43,0x6f,0xfd,0x6f,0xfe,0x73,0x08,0x03,0x09,0x00,0x43,
+0x6f,0xfe,0x4f,0xff,0xc4,0x03,0x12,0x2f,0xde,0x06,0x25,0x9f,0xfb,0x3f,0x00,0x05,
+0x51,0x00,0x31,0x03,0xff,0xf8,0x80,0x02,0xa0,0xb0,0x00,0x8f,0xff,0x91,0x00,0x04,
+0xdf,0xff,0x10,0x87,0x00,0x11,0xcc,0x87,0x00,0x01,0x99,0x00,0xc0,0xfe,0x30,0x00,
+0x00,0x00,0x02,0x8d,0xef,0xeb,0x60,0x00,0x00,0xf0,0x2f,0x8f,0xf7,0x02,0x8d,0xff,
+0xd9,0x20,0x00,0x08,0xff,0x86,0xff,0xff,0xff,0xff,0x60,0x00,0x8f,0xfd,0xff,0xff,
+0xef,0xff,0xff,0x60,0x08,0xff,0xff,0x92,0x00,0x17,0xff,0xff,0x10,0x8f,0xff,0x70,
+0x00,0x00,0x05,0xff,0xf9,0x08,0xff,0xc0,0x00,0x00,0x00,0x0a,0xff,0xe0,0x8f,0xfb,
+0x00,0x00,0x00,0x00,0x3f,0xff,0x28,0xff,0xb0,0x09,0x00,0x22,0xff,0xf5,0x11,0x00,
+0x32,0x0c,0xff,0x78,0x11,0x00,0x24,0xbf,0xf8,0x11,0x00,0x12,0x88,0x11,0x00,0x22,
+0xdf,0xf7,0x11,0x00,0x31,0x0f,0xff,0x58,0x11,0x00,0x50,0x03,0xff,0xf2,0x8f,0xfc,
+0x11,0x00,0x51,0x9f,0xfe,0x08,0xff,0xf5,0x4c,0x00,0xf2,0x14,0x80,0x8f,0xff,0xf7,
+0x00,0x00,0x5f,0xff,0xf1,0x08,0xff,0xff,0xff,0xcc,0xef,0xff,0xf5,0x00,0x8f,0xfb,
+0x7f,0xff,0xff,0xff,0xf6,0x00,0x08,0xff,0xb0,0x28,0xdf,0xfd,0x92,0x00,0x00,0x44,
+0x00,0x32,0x00,0x00,0x08,0x55,0x00,0x0f,0x11,0x00,0x22,0xf1,0x16,0x00,0x00,0x07,
+0xce,0xfe,0xa4,0x05,0xff,0xb0,0x00,0x3e,0xff,0xff,0xff,0xfa,0x6f,0xfb,0x00,0x2e,
+0xff,0xff,0xdd,0xff,0xff,0xff,0xb0,0x0c,0xff,0xf8,0x10,0x00,0x6f,0xff,0xfb,0x05,
+0xff,0xf7,0x91,0x00,0x31,0xb0,0xbf,0xfd,0xa2,0x00,0x41,0xfb,0x0f,0xff,0x60,0x42,
+0x00,0x32,0xb2,0xff,0xf2,0x53,0x00,0x22,0x4f,0xff,0x53,0x00,0x3a,0xb4,0xff,0xf0,
+0x11,0x00,0x14,0xb3,0x11,0x00,0x32,0x2f,0xff,0x20,0x75,0x00,0x22,0xff,0xf6,0x11,
+0x00,0x11,0x0a,0x3b,0x01,0x60,0x09,0xff,0xb0,0x4f,0xff,0x60,0xff,0x00,0xf0,0x0a,
+0xfb,0x00,0xcf,0xff,0x70,0x00,0x06,0xff,0xff,0xb0,0x02,0xef,0xff,0xfc,0xce,0xff,
+0xff,0xfb,0x00,0x03,0xdf,0xff,0xff,0xff,0xa9,0xa8,0x00,0x4f,0x7c,0xef,0xea,0x40,
+0xec,0x00,0x31,0xf0,0x08,0x8f,0xfb,0x8f,0xfa,0x04,0xbe,0xfa,0x8f,0xfa,0x7f,0xff,
+0xfa,0x8f,0xfe,0xff,0xff,0xfa,0x8f,0xff,0xfe,0x75,0x43,0x8f,0x1f,0x00,0x33,0x8f,
+0xff,0x10,0x31,0x00,0x0f,0x05,0x00,0x2e,0xa0,0x00,0x00,0x28,0xcf,0xfe,0xc7,0x10,
+0x00,0x00,0x07,0x3f,0x02,0x10,0xe5,0x5c,0x00,0xf1,0x09,0xfd,0xcf,0xff,0xff,0x50,
+0x02,0xff,0xfa,0x10,0x00,0x5e,0xff,0xe1,0x08,0xff,0xd0,0x00,0x00,0x02,0xff,0xf6,
+0x0a,0xff,0xa0,0x1b,0x02,0x01,0x10,0x00,0x81,0x00,0x01,0x10,0x04,0xff,0xfa,0x20,
+0x00,0x62,0x01,0x31,0xff,0xfd,0x84,0x99,0x01,0x00,0x91,0x01,0xa0,0x40,0x00,0x00,
+0x00,0x17,0xcf,0xff,0xff,0xfb,0x10,0x13,0x00,0x21,0x48,0xdf,0x38,0x01,0x00,0x1c,
+0x00,0x31,0xf6,0x15,0x54,0x5b,0x02,0x41,0xfa,0x3f,0xff,0x10,0x7b,0x00,0x31,0x0f,
+0xff,0x80,0x10,0x00,0xf0,0x03,0x08,0xff,0xf9,0x10,0x00,0x19,0xff,0xf4,0x00,0xcf,
+0xff,0xfd,0xcd,0xff,0xff,0xa0,0x00,0x09,0x88,0x00,0xfd,0x05,0xf9,0x00,0x00,0x00,
+0x38,0xce,0xff,0xc8,0x20,0x00,0x00,0x06,0xff,0xe0,0x00,0x00,0x00,0x6f,0xfe,0x00,
+0x0b,0x00,0x20,0x0d,0xff,0x61,0x02,0x10,0xdf,0x06,0x00,0x6e,0x68,0x99,0xcf,0xff,
+0x99,0x94,0x2c,0x00,0x0f,0x0b,0x00,0x19,0x10,0x5f,0x0b,0x00,0x11,0x05,0x04,0x02,
+0x11,0x3f,0x34,0x02,0xf0,0x03,0xef,0xff,0xee,0x80,0x00,0x05,0xff,0xff,0xf8,0x00,
+0x00,0x04,0xcf,0xfd,0x50,0x9f,0xfa,0x00,0x15,0x00,0x1f,0xf6,0x08,0x00,0x55,0x20,
+0x7f,0xfd,0x69,0x01,0x50,0xff,0xf6,0x4f,0xff,0x30,0xb7,0x03,0xd1,0xf6,0x0e,0xff,
+0xd3,0x00,0x04,0xcf,0xff,0xf6,0x07,0xff,0xff,0xee,0x5a,0x03,0x10,0xaf,0x06,0x00,
+0xb1,0xcf,0xf6,0x00,0x04,0xbe,0xfe,0xc8,0x20,0xbf,0xf6,0x4f,0x5a,0x01,0x51,0x0b,
+0xff,0x90,0xef,0xf6,0xd7,0x03,0x42,0xf4,0x09,0xff,0xb0,0xd7,0x00,0x21,0x3f,0xff,
+0xf9,0x03,0x40,0x90,0x00,0xdf,0xf5,0x5a,0x00,0x30,0xf3,0x00,0x08,0xcd,0x01,0x90,
+0x4f,0xfe,0x00,0x00,0x2f,0xff,0x00,0x00,0x09,0x8a,0x01,0x20,0xdf,0xf4,0x19,0x00,
+0x00,0xaa,0x01,0x30,0x90,0x00,0x3f,0x79,0x00,0x41,0x2f,0xfe,0x00,0x08,0xa3,0x01,
+0x61,0xcf,0xf4,0x00,0xdf,0xf2,0x00,0x1a,0x00,0x11,0x2f,0x53,0x03,0x31,0x1f,0xfe,
+0x07,0x19,0x00,0x61,0x00,0xcf,0xf3,0xcf,0xf2,0x00,0x3f,0x01,0x31,0xaf,0xfd,0x00,
+0x1a,0x00,0x10,0xff,0x6b,0x04,0x00,0xd7,0x01,0x01,0x6c,0x03,0x00,0x1a,0x00,0x23,
+0xfc,0x00,0x1a,0x00,0x22,0x70,0x00,0x1a,0x00,0x11,0xf2,0x0e,0x00,0x00,0xaa,0x00,
+0x01,0x75,0x01,0x31,0x2f,0xff,0x10,0x95,0x00,0x01,0xe5,0x00,0x90,0x06,0xff,0xc0,
+0x08,0xff,0x90,0x00,0x00,0x09,0x73,0x01,0x60,0x00,0xaf,0xf8,0x00,0x4f,0xfd,0x7e,
+0x04,0x00,0x72,0x02,0x60,0x0e,0xff,0x30,0x00,0xff,0xf1,0x30,0x00,0xf0,0x1f,0xff,
+0x20,0x00,0x02,0xff,0xf0,0x00,0x0b,0xff,0x50,0x00,0x07,0xff,0x9f,0xf6,0x00,0x00,
+0x6f,0xfa,0x00,0x00,0x7f,0xf9,0x00,0x00,0xcf,0xe1,0xff,0xb0,0x00,0x0a,0xff,0x60,
+0x00,0x02,0xff,0xd0,0x00,0x1f,0xf9,0x0c,0xff,0x00,0x00,0xef,0xf2,0x3a,0x00,0x90,
+0x10,0x05,0xff,0x50,0x7f,0xf5,0x00,0x1f,0xfd,0x55,0x00,0xa0,0xf5,0x00,0xaf,0xf0,
+0x02,0xff,0xa0,0x05,0xff,0x90,0xed,0x01,0x90,0x90,0x0e,0xfb,0x00,0x0d,0xfe,0x00,
+0x9f,0xf4,0x96,0x00,0x91,0xfd,0x03,0xff,0x60,0x00,0x9f,0xf3,0x0d,0xff,0xdd,0x00,
+0x91,0xf1,0x8f,0xf2,0x00,0x04,0xff,0x81,0xff,0xb0,0x94,0x03,0x81,0x5d,0xfd,0x00,
+0x00,0x0e,0xfd,0x5f,0xf7,0x3a,0x05,0x10,0xfb,0x00,0x01,0x41,0xaf,0xfb,0xff,0x30,
+0x68,0x01,0x20,0xff,0xf3,0x4a,0x00,0x00,0xce,0x00,0x00,0x7e,0x01,0x11,0xfe,0x28,
+0x05,0x11,0xfa,0xed,0x00,0x12,0x6f,0x34,0x03,0x40,0xff,0x50,0x00,0x00,0x44,0x03,
+0x11,0xf5,0x12,0x01,0x11,0xf1,0x1b,0x00,0x11,0x0d,0x03,0x01,0x21,0x1f,0xfc,0x67,
+0x05,0x12,0xe0,0x43,0x05,0x11,0x02,0xf7,0x00,0x20,0xcf,0xfd,0x84,0x03,0x50,0x20,
+0x00,0x06,0xff,0xf4,0x27,0x00,0x30,0xb0,0x00,0x1e,0x46,0x00,0x70,0x04,0xff,0xf4,
+0x00,0x9f,0xfe,0x10,0x70,0x03,0x22,0xfd,0x02,0x97,0x04,0x32,0x1e,0xff,0x7c,0x5f,
+0x03,0x20,0x05,0xff,0x15,0x01,0x02,0x78,0x01,0x12,0xf8,0x67,0x01,0x11,0x2f,0xa6,
+0x03,0x01,0x58,0x01,0x12,0xe1,0x09,0x00,0x33,0xdf,0xff,0xfa,0x5f,0x04,0x32,0xef,
+0xff,0x40,0x23,0x00,0x12,0x58,0xb4,0x00,0x51,0xcf,0xfb,0x00,0xef,0xf8,0x9b,0x00,
+0x50,0xf2,0x00,0x5f,0xff,0x30,0x9f,0x01,0x30,0x80,0x00,0x0c,0x5b,0x00,0x20,0xbf,
+0xfe,0xed,0x04,0x51,0xf7,0x00,0x05,0xff,0xf6,0xe9,0x03,0x41,0x20,0x0e,0xff,0xc0,
+0x79,0x00,0x41,0xb0,0x7f,0xff,0x10,0xe8,0x00,0x31,0x61,0xff,0xf6,0x81,0x00,0x21,
+0xf1,0x0c,0x28,0x01,0x60,0xaf,0xfc,0x00,0x6f,0xff,0x10,0x74,0x01,0x40,0x60,0x01,
+0xff,0xf6,0x3d,0x00,0x31,0xf1,0x00,0x0b,0xb1,0x04,0x10,0xfc,0x0e,0x01,0x00,0xd0,
+0x00,0x90,0x60,0x00,0x01,0xff,0xf5,0x00,0x02,0xff,0xf1,0x2d,0x01,0x50,0xa0,0x00,
+0x7f,0xfc,0x00,0x37,0x06,0x41,0x00,0x0b,0xff,0x70,0x8b,0x06,0x31,0x01,0xff,0xf1,
+0xac,0x02,0x41,0xa0,0x5f,0xfc,0x00,0x1a,0x00,0x32,0x0a,0xff,0x70,0xce,0x02,0x31,
+0xef,0xf1,0x00,0x1a,0x00,0x23,0xdf,0xfc,0xd9,0x00,0x03,0x53,0x02,0x13,0xef,0x52,
+0x01,0x14,0x09,0x6c,0x02,0x14,0x4f,0x6c,0x02,0x23,0xef,0xf2,0x7d,0x02,0x13,0xfc,
+0x3b,0x06,0x04,0x19,0x00,0x13,0xdf,0x19,0x00,0x12,0x5f,0x19,0x00,0x22,0x01,0x6f,
+0x12,0x01,0x42,0x8f,0xff,0xff,0xb0,0x23,0x01,0x21,0xff,0xd1,0x19,0x00,0x34,0x6e,
+0xfd,0x80,0x6c,0x00,0x00,0x01,0x00,0x14,0xf2,0x08,0x00,0x62,0x3c,0xcc,0xcc,0xcc,
+0xcc,0xcf,0x3e,0x01,0x22,0x00,0x7f,0xdf,0x01,0x33,0x03,0xff,0xf9,0xd9,0x01,0x13,
+0xd0,0x17,0x05,0x01,0x1e,0x02,0x02,0x8f,0x06,0x00,0x34,0x01,0x12,0xc0,0xa2,0x01,
+0x22,0xfe,0x10,0x8b,0x00,0x22,0xf5,0x00,0x85,0x07,0x12,0x90,0x92,0x00,0x13,0xfd,
+0xc4,0x00,0x18,0xf3,0xc3,0x00,0x22,0x01,0xef,0xa1,0x00,0x13,0x0b,0xe3,0x00,0x92,
+0x5f,0xff,0xeb,0xbb,0xbb,0xbb,0xbb,0xb7,0x7f,0x88,0x00,0x14,0xfa,0x08,0x00,0x14,
+0x00,0x01,0x00,0x61,0x08,0xe4,0x00,0x00,0x00,0x4e,0xdd,0x03,0x20,0xff,0xa2,0x87,
+0x01,0x10,0x90,0x6b,0x00,0x10,0xe0,0xe5,0x01,0x11,0xf8,0xb0,0x01,0x10,0x40,0x52,
+0x04,0x12,0xf2,0x78,0x03,0x12,0x00,0x86,0x01,0x0a,0x0b,0x00,0x10,0x00,0x6b,0x02,
+0x11,0xf0,0x39,0x07,0x01,0x71,0x00,0x60,0x40,0x00,0x09,0xdf,0xff,0x90,0x66,0x01,
+0x10,0x80,0x50,0x00,0x52,0xfe,0x40,0x00,0x00,0x03,0xc4,0x00,0x25,0xdf,0xf8,0x3a,
+0x05,0x01,0x60,0x04,0x1e,0x02,0x4d,0x00,0x14,0x10,0x6e,0x00,0x11,0x0f,0x0d,0x01,
+0x01,0x98,0x04,0x11,0x09,0x09,0x01,0x11,0x3f,0x72,0x01,0x11,0x8f,0x06,0x00,0x11,
+0x9f,0x04,0x01,0x11,0x5d,0xd4,0x02,0x5f,0x04,0x10,0xef,0xbe,0xfb,0x03,0x00,0x18,
+0x31,0xb7,0x85,0x00,0x5c,0x03,0x24,0xe9,0x10,0x8a,0x01,0x21,0x01,0x9f,0xbc,0x05,
+0x11,0x7f,0x12,0x03,0x25,0xcf,0xf9,0xa4,0x00,0x02,0xd4,0x07,0x23,0xff,0xf3,0x07,
+0x01,0x00,0x52,0x02,0x0a,0x0b,0x00,0x11,0x0e,0x0b,0x00,0x22,0xdf,0xf6,0xe9,0x07,
+0x01,0x32,0x00,0x11,0x70,0xc4,0x03,0x10,0xda,0x91,0x01,0x00,0x14,0x01,0x21,0x2c,
+0xff,0xc2,0x02,0x14,0xc4,0x53,0x00,0x21,0xbf,0xf8,0x37,0x00,0x1e,0x50,0x4d,0x00,
+0x08,0x0b,0x00,0x39,0x1f,0xff,0x20,0x54,0x01,0x10,0x2f,0x31,0x00,0x10,0x3e,0xa4,
+0x01,0x10,0x7f,0x67,0x00,0x30,0x05,0xfe,0x60,0x27,0x02,0x12,0x00,0x30,0x05,0x30,
+0xcf,0xfc,0x70,0x06,0x01,0x70,0x88,0x10,0x0b,0xff,0xff,0xff,0xd3,0x52,0x03,0x11,
+0xf1,0x10,0x07,0x10,0xf5,0x77,0x05,0x00,0xf8,0x03,0xc0,0x5e,0xff,0xf9,0x10,0x3c,
+0xff,0x80,0x7f,0xf8,0x00,0x00,0x1c,0x19,0x00,0x20,0xe1,0x0a,0x6a,0x00,0x00,0x24,
+0x00,0x40,0xe3,0x00,0x46,0x60,0x88,0x02,0x4f,0xae,0xfe,0x91,0x00,0x01,0x00,0x04,
+0x1a,0x55,0x0f,0x00,0x19,0xdd,0x0e,0x00,0x38,0x06,0xff,0x60,0x0f,0x00,0x38,0x0e,
+0xff,0xe0,0x0f,0x00,0x38,0x7f,0xff,0xf7,0x0f,0x00,0x11,0xef,0xe8,0x04,0x05,0x94,
+0x09,0x14,0xff,0x8d,0x03,0x04,0x07,0x06,0x03,0xb1,0x02,0x12,0x00,0x57,0x03,0x14,
+0xbc,0x97,0x04,0x01,0xd1,0x06,0x31,0xff,0x33,0xff,0x3e,0x04,0x03,0xf2,0x02,0x33,
+0xfa,0x00,0xaf,0x05,0x03,0x01,0x1d,0x01,0x11,0xf2,0x04,0x00,0x03,0x01,0x00,0x00,
+0x1a,0x00,0x15,0x09,0xe0,0x02,0x10,0x03,0x38,0x00,0x22,0x01,0xff,0x59,0x03,0x00,
+0x16,0x03,0x11,0xf8,0x5e,0x00,0x03,0x2f,0x09,0x11,0x3f,0x74,0x00,0x13,0x1f,0x42,
+0x03,0x01,0xa1,0x09,0x00,0x9a,0x00,0x02,0x42,0x03,0x13,0x04,0xb0,0x00,0x03,0xfc,
+0x04,0x33,0x0d,0xff,0xf6,0xa1,0x05,0x12,0xd0,0x58,0x03,0x13,0xd0,0xbc,0x03,0x12,
+0xf5,0x2b,0x05,0x22,0x50,0x00,0xbc,0x03,0x18,0xfd,0xc4,0x06,0x20,0x00,0xcf,0x22,
+0x01,0x11,0x0e,0xd5,0x01,0x02,0xa5,0x03,0x10,0xe0,0x18,0x01,0x22,0xd2,0x22,0x01,
+0x00,0x30,0x2d,0xff,0xf7,0x60,0x00,0x06,0x01,0x00,0x48,0xfe,0x10,0x08,0xff,0x01,
+0x00,0x29,0x80,0x1f,0x0f,0x00,0x29,0xf1,0x9f,0x0f,0x00,0x15,0xf9,0x22,0x01,0x49,
+0x28,0xcd,0xb7,0x10,0x5b,0x01,0x16,0xe5,0x4b,0x01,0x00,0x2a,0x00,0x15,0x50,0x0f,
+0x01,0x33,0xfe,0x64,0x7e,0xdf,0x05,0x71,0x47,0x81,0x0a,0xff,0xe1,0x00,0x02,0xa5,
+0x01,0x32,0x01,0x8e,0xff,0xf5,0x0a,0x21,0x9f,0xfa,0xe3,0x00,0x52,0xff,0xfa,0x2f,
+0xff,0x40,0xee,0x09,0x80,0x0a,0xff,0xff,0xfc,0x81,0x4f,0xff,0x80,0x79,0x09,0x01,
+0x2e,0x06,0x90,0x10,0x00,0x7f,0xff,0xf4,0x00,0x05,0xff,0xf5,0x3f,0x05,0x20,0x10,
+0x00,0x53,0x08,0x61,0xb9,0xcf,0xff,0xd0,0x00,0x5f,0xa6,0x03,0x11,0xdf,0xc7,0x00,
+0x31,0x20,0x00,0xef,0xf1,0x03,0x01,0xa7,0x00,0x31,0xd2,0x00,0x06,0x25,0x01,0x11,
+0x03,0x79,0x04,0x22,0x14,0x20,0xf8,0x05,0x11,0x06,0x7b,0x0c,0x31,0xaf,0xf2,0x0f,
+0x9d,0x00,0x11,0x09,0x28,0x00,0x42,0xdf,0xf6,0x3f,0xff,0xa7,0x01,0x00,0xdc,0x00,
+0x31,0xaf,0xfa,0x5f,0xe3,0x04,0x02,0x43,0x04,0x42,0x6f,0xfc,0x6f,0xfc,0x2a,0x02,
+0x10,0xb1,0x7f,0x01,0x12,0xfd,0x1c,0x00,0x21,0x4f,0xf7,0x94,0x01,0x12,0xfc,0x38,
+0x00,0x22,0x7d,0x30,0x05,0x0b,0x11,0x1f,0xb3,0x01,0x12,0x50,0x27,0x05,0x26,0xf8,
+0x0c,0x2c,0x02,0x45,0x02,0xff,0xf3,0x07,0x68,0x02,0x00,0xd8,0x0c,0x25,0x01,0xef,
+0x0a,0x05,0x00,0xc1,0x09,0x14,0x7f,0x94,0x02,0x30,0x02,0xef,0xfe,0x66,0x07,0x03,
+0x84,0x02,0x10,0x3e,0xc1,0x01,0x40,0x01,0xdf,0xff,0xc4,0x0d,0x00,0x12,0x18,0xb9,
+0x02,0x82,0x2d,0xff,0xff,0xd8,0x53,0x34,0x6a,0xff,0xe5,0x02,0x23,0x01,0xbf,0xc1,
+0x01,0x12,0x40,0x07,0x02,0x12,0xcf,0xbf,0x01,0x04,0x77,0x01,0x6f,0x8c,0xff,0xff,
+0xda,0x50,0x00,0x01,0x00,0x12,0x12,0x0d,0x49,0x00,0x16,0x30,0xb3,0x00,0x00,0x01,
+0x00,0x05,0x4a,0x03,0x30,0x71,0x00,0x5f,0x10,0x00,0x32,0xc0,0x01,0xd9,0xd1,0x02,
+0x12,0xfd,0x32,0x02,0x02,0x55,0x01,0x00,0xee,0x01,0x30,0xd2,0x00,0xbf,0x2f,0x00,
+0x12,0xbf,0xa0,0x02,0xf0,0x06,0x2e,0xff,0xf7,0x00,0x1e,0xff,0xff,0xc0,0x00,0xcf,
+0xfe,0x20,0x10,0x00,0x00,0x06,0x02,0xef,0xa0,0x00,0x03,0xfb,0x07,0x40,0x0b,0xf3,
+0x4c,0xf1,0x04,0x09,0x10,0x47,0x3f,0x01,0x00,0xda,0x02,0x10,0x4c,0xed,0x00,0x11,
+0xef,0xc2,0x03,0x21,0x0a,0xc0,0x68,0x01,0x42,0xfe,0x00,0x02,0xef,0x3b,0x01,0x11,
+0x20,0xa2,0x01,0x65,0x91,0x00,0x00,0x06,0xdf,0x20,0x95,0x03,0x68,0x92,0x13,0x20,
+0x05,0x76,0x54,0xb4,0x03,0x26,0xd0,0x0f,0x93,0x02,0x00,0xa4,0x05,0x48,0xf0,0x0f,
+0xff,0xf8,0x20,0x00,0x0a,0x10,0x00,0x66,0x39,0x75,0x30,0x00,0x12,0x42,0x10,0x00,
+0x66,0x6c,0x73,0x00,0x01,0x7c,0xfd,0x10,0x00,0x10,0xcf,0xda,0x09,0x03,0xa5,0x08,
+0x02,0x35,0x09,0x36,0xa0,0x04,0xff,0x71,0x04,0x84,0x01,0xae,0xff,0x50,0x00,0xee,
+0x94,0x71,0x10,0x00,0x84,0x1d,0x80,0x26,0x00,0x00,0x10,0x1c,0xfb,0x10,0x00,0x95,
+0xbf,0xfc,0x20,0x00,0x00,0x02,0xdf,0xff,0x80,0x09,0x04,0x11,0xe0,0xf7,0x08,0x21,
+0x68,0x10,0x3e,0x00,0x21,0xa9,0x5e,0xc6,0x01,0x42,0xaf,0xe3,0x8f,0xf8,0x99,0x03,
+0x21,0x41,0xca,0x3c,0x03,0x73,0x11,0xff,0xfe,0x5b,0x96,0x29,0xce,0xdf,0x03,0x00,
+0xf7,0x00,0x63,0xf6,0x9f,0xff,0x5f,0xff,0x4a,0x7d,0x07,0xa4,0x00,0x05,0xef,0xd0,
+0xbf,0xfd,0x1f,0xff,0x81,0xee,0x89,0x00,0x86,0x19,0x40,0xef,0xfa,0x0e,0xff,0xb0,
+0x31,0xb9,0x00,0x5c,0xad,0xf7,0x0a,0xea,0x40,0xd7,0x01,0x50,0x00,0x00,0x00,0x00,
+0x00,0x68,0x00,0x00,0x00,0x05,0x20,0x00,0x01,0x00,0x75,0x01,0xdf,0xf4,0x00,0x00,
+0x13,0x43,0x15,0x00,0x93,0x0c,0xff,0xff,0x45,0xae,0xff,0xff,0xff,0xb5,0x10,0x00,
+0x23,0xbf,0xff,0x01,0x00,0x11,0xe6,0x0f,0x00,0x70,0x0b,0xff,0xf9,0xef,0xff,0xff,
+0xff,0x04,0x00,0x10,0xe3,0x10,0x00,0xf0,0x23,0xaf,0xff,0x90,0x2e,0xff,0xfa,0x10,
+0x00,0x03,0x8e,0xff,0xff,0x60,0x00,0x00,0x09,0xff,0xf9,0x00,0x02,0xef,0xff,0x80,
+0x00,0x00,0x00,0x7f,0xff,0xf6,0x00,0x00,0x2f,0xff,0xc0,0x00,0x00,0x1d,0xff,0xf9,
+0x00,0x00,0x00,0x03,0xef,0xff,0x30,0x00,0x0e,0xff,0xf7,0x73,0x00,0xb0,0xff,0xa0,
+0x00,0x00,0x00,0x2e,0xff,0xe0,0x00,0x02,0xdf,0x2c,0x00,0x30,0x1c,0xff,0xfa,0x21,
+0x00,0x00,0x1c,0x00,0x90,0x1f,0xff,0xf8,0x00,0x00,0x00,0xcf,0xff,0x10,0x42,0x00,
+0xb0,0xfe,0x10,0x00,0x3f,0xff,0xff,0x90,0x00,0x05,0xff,0xfd,0x6c,0x00,0xc0,0x0e,
+0xff,0x60,0x00,0x8f,0xff,0xff,0xfa,0x00,0x4f,0xff,0xe2,0x10,0x00,0xd1,0x08,0xff,
+0xb0,0x00,0xdf,0xf7,0xbf,0xff,0xb4,0xff,0xfe,0x20,0x00,0x41,0x00,0x92,0xf0,0x00,
+0xff,0xf3,0x0b,0xff,0xff,0xff,0xf3,0xbc,0x00,0xa3,0xff,0xf1,0x01,0xff,0xf1,0x00,
+0xaf,0xff,0xff,0x30,0x10,0x00,0x64,0xf3,0x01,0xff,0xf0,0x00,0x08,0x1f,0x00,0xb4,
+0x00,0xef,0xf4,0x00,0xff,0xf2,0x00,0x00,0x6a,0x30,0x00,0x20,0x00,0x36,0x00,0xef,
+0xf3,0x1b,0x01,0x00,0x3d,0x00,0x26,0xbf,0xf7,0x10,0x00,0x66,0x05,0xff,0xe0,0x00,
+0x7f,0xfc,0x10,0x00,0x64,0x09,0xff,0xa0,0x00,0x1f,0xff,0x3d,0x00,0x00,0xbc,0x00,
+0x55,0x40,0x00,0x0a,0xff,0xc0,0x10,0x00,0x65,0xaf,0xfd,0x00,0x00,0x02,0xff,0x41,
+0x00,0x93,0x06,0xff,0xf4,0x00,0x00,0x00,0x8f,0xff,0x50,0x10,0x00,0x31,0x4f,0xff,
+0xb0,0x70,0x01,0x14,0xf7,0x1f,0x00,0x20,0xfd,0x10,0x75,0x00,0x31,0xef,0xff,0xc4,
+0xcd,0x00,0x10,0xbf,0x9b,0x00,0x10,0x00,0x1d,0x01,0x63,0xff,0xd9,0x54,0x34,0x58,
+0xcf,0xe5,0x00,0x00,0x42,0x00,0x02,0x01,0x00,0x13,0xa1,0x48,0x00,0x21,0x02,0xaf,
+0x0f,0x00,0x16,0xb3,0xb8,0x00,0x55,0x6a,0xce,0xff,0xda,0x61,0x0e,0x00,0x14,0xbb,
+0x01,0x00,0x11,0xa0,0xc4,0x00,0x04,0x01,0x00,0x00,0x7d,0x00,0x15,0x0a,0x0e,0x00,
+0x00,0x95,0x00,0x14,0x0f,0x0d,0x00,0x12,0xfe,0x9f,0x00,0x12,0xf2,0xc6,0x00,0x10,
+0xf9,0x06,0x00,0x12,0x9f,0xd8,0x00,0x12,0x01,0x15,0x00,0x12,0xef,0xc5,0x00,0x11,
+0x07,0x15,0x00,0x12,0x03,0x30,0x00,0x01,0x9f,0x01,0x00,0x95,0x01,0x11,0xf9,0x0e,
+0x00,0x20,0x5f,0xff,0x06,0x00,0x13,0x0d,0x45,0x00,0x22,0xbf,0xf9,0x21,0x01,0x12,
+0xe0,0x37,0x00,0x12,0xf3,0x4b,0x02,0x12,0xf2,0x42,0x02,0x12,0xa0,0xbd,0x01,0x00,
+0xf9,0x01,0x32,0x2c,0xff,0xf6,0xb6,0x00,0x72,0xcf,0xfd,0x00,0x00,0x04,0xef,0xfc,
+0xf3,0x00,0x10,0x3d,0xc2,0x01,0x11,0x6f,0x56,0x02,0x02,0xc2,0x00,0x42,0x90,0x01,
+0xff,0xe3,0x28,0x00,0x82,0x3f,0xff,0xfa,0xff,0xd0,0x07,0xff,0xe1,0x0e,0x00,0x84,
+0xdf,0xff,0x41,0xff,0x80,0x0d,0xff,0xfb,0x70,0x01,0x43,0x05,0xff,0x30,0x3f,0xfe,
+0x01,0xa2,0x0c,0xff,0x90,0x08,0xfe,0x00,0x9f,0xbc,0xff,0x90,0x8a,0x00,0x62,0x20,
+0x0c,0xf9,0x00,0xef,0x46,0xd6,0x00,0xa3,0x2f,0xff,0x00,0x0f,0xf4,0x05,0xfc,0x03,
+0xff,0xe0,0x0e,0x00,0x81,0x3f,0xe0,0x08,0x93,0x03,0xff,0xd0,0x00,0x15,0x01,0x30,
+0x20,0x49,0x50,0x76,0x00,0x12,0xc0,0x46,0x00,0x21,0x70,0x00,0x38,0x01,0x12,0x70,
+0x62,0x00,0x12,0xe1,0x2a,0x01,0x12,0x20,0x4f,0x02,0x20,0xfd,0x10,0xe7,0x02,0x12,
+0xfa,0x8c,0x00,0x62,0x6f,0xff,0xe7,0x20,0x03,0x9f,0xaa,0x02,0x00,0x17,0x01,0x01,
+0x01,0x00,0x13,0x40,0x95,0x01,0x10,0x5e,0x0d,0x00,0x15,0xd3,0xb2,0x01,0x47,0x7c,
+0xff,0xff,0xb6,0x94,0x03,0x18,0x02,0xa3,0x03,0x72,0x06,0x88,0x88,0x88,0x88,0x80,
+0x00,0x7e,0x03,0x00,0x37,0x00,0x1f,0xf0,0x0c,0x00,0x09,0x40,0x11,0x11,0x1c,0xff,
+0x01,0x03,0x55,0x33,0x44,0x51,0xdf,0xff,0x01,0x00,0x10,0xfc,0xd5,0x01,0xa5,0xee,
+0xee,0xed,0xdd,0xdd,0xdc,0xcd,0xfd,0xff,0x20,0x68,0x00,0x08,0x0c,0x00,0x1b,0xfe,
+0x0c,0x00,0x62,0x23,0x33,0x33,0x33,0x33,0x31,0x0c,0x00,0x10,0xef,0x45,0x00,0x1b,
+0xf9,0x0c,0x00,0x1a,0xef,0x0c,0x00,0x05,0x3c,0x00,0x2f,0xef,0x30,0x0c,0x00,0x06,
+0x10,0x33,0x01,0x00,0x65,0x32,0x00,0x02,0xff,0xef,0x30,0x3c,0x00,0x0f,0x0c,0x00,
+0x09,0x04,0x3c,0x00,0x36,0xff,0xdf,0x30,0x95,0x03,0x27,0xdf,0x40,0x0c,0x00,0xb7,
+0x51,0x11,0x12,0x22,0x22,0x22,0x23,0x33,0x33,0x35,0xff,0xf0,0x00,0x41,0xff,0x9f,
+0xff,0xfe,0x48,0x00,0x4f,0xfd,0xcc,0xcc,0xb8,0x38,0x01,0x12,0x0a,0x0c,0x00,0x69,
+0x01,0x11,0x11,0x11,0x11,0x10,0x28,0x05,0x08,0x9f,0x01,0x53,0x8b,0xef,0xff,0xeb,
+0x72,0x0d,0x00,0x21,0x04,0xcf,0x71,0x00,0x21,0xa0,0x50,0x38,0x00,0x03,0x2e,0x05,
+0x20,0xf4,0xcd,0xb0,0x00,0x13,0x4e,0x8d,0x00,0xf0,0x03,0xf3,0xcf,0xf8,0x00,0x00,
+0x04,0xff,0xff,0xff,0xd7,0x42,0x23,0x59,0xdf,0x80,0xcf,0xff,0xd4,0xd7,0x04,0x13,
+0xe5,0xe9,0x02,0x41,0x9d,0xff,0xa1,0xdf,0x00,0x05,0x01,0x0e,0x00,0x20,0x50,0x8f,
+0xdf,0x02,0x05,0x0e,0x00,0x23,0x02,0xcf,0xcd,0x02,0x01,0x0e,0x00,0x47,0x00,0x06,
+0xff,0xf9,0x0e,0x00,0x46,0x00,0x1a,0xff,0xd3,0x0e,0x00,0x00,0x55,0x02,0x17,0x90,
+0x0e,0x00,0x47,0x00,0x9f,0xfe,0x40,0x0e,0x00,0x38,0x03,0xdf,0xfa,0x0e,0x00,0x27,
+0xef,0xf5,0x0e,0x00,0x36,0x6f,0xfc,0x20,0x0e,0x00,0x18,0x0a,0x46,0x00,0x37,0x02,
+0xdf,0xf5,0x62,0x00,0x36,0x5f,0xfd,0x20,0x0e,0x00,0x16,0x09,0xea,0x04,0x01,0xa8,
+0x00,0x16,0xf1,0x0e,0x00,0x27,0x4e,0xff,0xb6,0x00,0x64,0x58,0xff,0xca,0xff,0xff,
+0x80,0x0e,0x00,0x45,0xef,0xf9,0x00,0xef,0xc5,0x00,0x30,0xcf,0xff,0x50,0x0a,0x01,
+0x13,0xd4,0x0e,0x00,0x12,0xd2,0x26,0x01,0x70,0xd8,0x42,0x13,0x59,0xef,0x80,0xc9,
+0x13,0x00,0x13,0x3e,0x42,0x01,0x28,0xf2,0x30,0x5e,0x01,0x19,0xf2,0x7a,0x01,0x04,
+0x5b,0x00,0x10,0x03,0x96,0x01,0x1b,0x61,0xab,0x01,0x26,0x1c,0xdd,0x01,0x00,0x37,
+0xd7,0x4f,0xff,0x12,0x03,0x34,0x4f,0xc0,0x03,0x4a,0x00,0x8c,0x01,0xfd,0x4f,0xc0,
+0x02,0xff,0xff,0xf1,0x0d,0x00,0xa0,0x28,0x99,0x9a,0xfd,0x4f,0xc0,0x00,0xef,0xff,
+0xe0,0xec,0x05,0x20,0xff,0xff,0x0d,0x00,0x63,0x01,0x11,0x00,0x00,0x06,0xef,0x0d,
+0x00,0x00,0x76,0x00,0x23,0xcf,0xff,0x0d,0x00,0x54,0x25,0x55,0x30,0x2e,0xff,0x0d,
+0x00,0x00,0x83,0x06,0x13,0x7e,0x0d,0x00,0x20,0x01,0xff,0xf9,0x05,0x18,0x7f,0x0d,
+0x00,0x27,0x01,0x8f,0x0d,0x00,0x03,0x75,0x00,0x46,0x00,0xcf,0xff,0xd1,0x0d,0x00,
+0x05,0xe3,0x02,0x0d,0x0d,0x00,0x36,0x46,0x66,0x40,0x0d,0x00,0x04,0xeb,0x06,0x1c,
+0x01,0x4e,0x00,0x0c,0x0d,0x00,0x1f,0xf3,0x68,0x00,0x1e,0x38,0xbf,0xff,0xe2,0x68,
+0x00,0x1f,0xf6,0x0d,0x00,0x13,0x14,0xf5,0x0d,0x00,0x08,0x6c,0x01,0x26,0x1d,0xee,
+0x01,0x00,0x12,0xe8,0xad,0x01,0x56,0x7a,0xcd,0xdc,0xa7,0x30,0xe4,0x04,0x11,0xdf,
+0x2c,0x01,0x14,0x50,0x54,0x03,0x03,0xcb,0x03,0x25,0xfd,0x40,0xf2,0x06,0x52,0xcf,
+0xf3,0x5f,0xf9,0xef,0x2b,0x07,0x00,0x8c,0x01,0x92,0x92,0x1f,0xf0,0x4f,0xe0,0x06,
+0xef,0xff,0x90,0x1f,0x00,0x20,0xd3,0x00,0x10,0x00,0x41,0x00,0x1b,0xff,0xf8,0x21,
+0x06,0x22,0xfc,0x10,0x10,0x00,0x20,0x00,0xaf,0xa8,0x06,0x10,0x0e,0xf0,0x00,0x11,
+0x2f,0x10,0x00,0x30,0x0c,0xff,0xe0,0x8a,0x01,0x14,0x20,0x10,0x00,0x10,0x01,0x31,
+0x00,0x33,0xef,0xf9,0x00,0x10,0x00,0x00,0x73,0x08,0x46,0x00,0x05,0xff,0xf1,0x10,
+0x00,0x61,0x0e,0xff,0x50,0x09,0xff,0xb0,0x15,0x06,0x21,0xff,0xe0,0x7b,0x00,0x41,
+0x90,0x0d,0xff,0x60,0x41,0x06,0x01,0xff,0x02,0x41,0x04,0xff,0xd0,0x0f,0x60,0x06,
+0x50,0x01,0x44,0x44,0x00,0x10,0xaa,0x04,0x20,0xf0,0x0f,0xbc,0x08,0x50,0x01,0x40,
+0x00,0x00,0x09,0x58,0x00,0x03,0x10,0x00,0x20,0x4e,0xf9,0x12,0x07,0x14,0xd3,0x10,
+0x00,0xf0,0x2e,0x06,0xff,0xff,0x70,0x02,0xff,0xbe,0xff,0x80,0x00,0xff,0xf0,0x0d,
+0xff,0x40,0x00,0x9f,0xfb,0x9f,0xf5,0x0a,0xff,0x21,0xaf,0xfc,0x23,0xff,0xd0,0x0b,
+0xff,0x70,0x1b,0xff,0x90,0x4f,0xfa,0x07,0xff,0xe4,0x05,0xff,0xfb,0xff,0xb0,0x06,
+0xff,0xd2,0xdf,0xf6,0x06,0xff,0xd2,0x00,0x4d,0xff,0x90,0x1b,0xff,0xff,0x60,0x01,
+0x47,0x06,0x20,0x9f,0xfb,0xe1,0x03,0xc1,0xfd,0x30,0x8f,0xff,0x10,0x00,0x9f,0xff,
+0xe2,0x0b,0xff,0x90,0xe3,0x03,0x30,0xf8,0xcf,0xfa,0x9b,0x00,0x34,0x81,0xdf,0xf6,
+0x75,0x06,0x10,0xf2,0x6f,0x07,0x34,0xfe,0xff,0x40,0x94,0x06,0x11,0x70,0x72,0x07,
+0x14,0xf2,0xd1,0x08,0x12,0xfb,0xd5,0x06,0x02,0x00,0x04,0x43,0x01,0xaf,0xff,0xc0,
+0xf4,0x09,0x86,0xfb,0x51,0x00,0x00,0x05,0x9f,0xff,0xfb,0xbd,0x06,0x27,0xfd,0xdf,
+0x6c,0x03,0x12,0x2a,0xa0,0x01,0x15,0xa2,0xc1,0x01,0x68,0x17,0xcf,0xff,0xff,0xfc,
+0x71,0x7a,0x03,0x26,0x24,0x42,0x4f,0x02,0x37,0x7a,0xcc,0x95,0x1a,0x00,0x00,0xe2,
+0x04,0x16,0xe4,0xa2,0x03,0x01,0x4a,0x00,0x25,0x70,0x00,0x6f,0x0a,0x33,0xa4,0x23,
+0x6d,0xbb,0x02,0x00,0xbb,0x00,0x10,0xf4,0xb0,0x00,0x02,0x60,0x08,0x04,0x62,0x08,
+0x33,0x0c,0xff,0x60,0xfc,0x07,0x11,0xfd,0x2d,0x02,0x00,0xb5,0x00,0x62,0x12,0x10,
+0x00,0x00,0x6f,0xf8,0xc5,0x09,0x92,0xf0,0x00,0x7e,0xff,0xfc,0x40,0x00,0x7f,0xf6,
+0x95,0x07,0x10,0xf0,0x62,0x00,0x15,0xf7,0x1e,0x00,0x11,0xe0,0xb1,0x03,0x32,0x60,
+0x3f,0xfc,0x3c,0x00,0x11,0xc6,0x7f,0x00,0x41,0xf1,0x0e,0xff,0x50,0x5a,0x00,0x11,
+0x6c,0x0f,0x00,0x14,0xf6,0x78,0x00,0x02,0x12,0x09,0x94,0xfa,0x00,0xcf,0xff,0x93,
+0x01,0x5d,0xff,0xf4,0x0f,0x00,0x12,0x0c,0xb4,0x00,0x11,0x0d,0x07,0x00,0x13,0xf8,
+0x92,0x09,0x22,0x94,0x08,0xed,0x05,0x04,0x56,0x09,0x12,0xc8,0x66,0x09,0x00,0xee,
+0x0a,0x22,0xfd,0xbb,0xab,0x04,0x00,0xe2,0x09,0x53,0x0d,0xff,0xf7,0x10,0x01,0x0f,
+0x00,0x10,0xb1,0x24,0x0a,0x33,0x20,0x00,0x2e,0x28,0x03,0x50,0xe1,0x00,0x03,0xff,
+0xe2,0x01,0x0a,0x02,0x01,0x00,0x53,0xfb,0x00,0x0b,0xff,0x60,0x6c,0x00,0x01,0x3c,
+0x08,0x25,0x0f,0xfe,0xfd,0x09,0x00,0x5a,0x00,0x46,0x4f,0xf8,0x00,0x02,0x65,0x03,
+0x32,0xf1,0x7f,0xf4,0xc3,0x06,0x03,0x82,0x06,0x46,0x9f,0xf3,0x00,0x2f,0x0f,0x00,
+0x37,0xf7,0xaf,0xf2,0x3b,0x00,0x67,0xff,0xf8,0xaf,0xfb,0xbb,0xef,0x0f,0x00,0x28,
+0x9f,0xff,0x01,0x00,0x74,0xf7,0x6f,0xff,0xff,0xff,0xb7,0x77,0x01,0x00,0x5d,0x72,
+0x02,0x22,0x22,0x22,0x05,0x07,0x19,0x42,0x0e,0x00,0x38,0x04,0xfe,0x30,0x0f,0x00,
+0x15,0x05,0xc2,0x01,0x13,0x00,0x0d,0x0a,0x1a,0x50,0x1f,0x00,0x04,0x56,0x06,0x04,
+0x0a,0x0b,0x19,0x60,0x4d,0x00,0x06,0x34,0x0b,0x03,0xe4,0x09,0x18,0x80,0x0f,0x00,
+0x32,0x03,0xef,0xf9,0xa4,0x07,0x03,0xa1,0x07,0x11,0x3e,0x41,0x0a,0x13,0x3f,0xbd,
+0x00,0x21,0xee,0xef,0xb6,0x02,0x17,0x3f,0xd0,0x00,0x1a,0xc1,0x0f,0x00,0x29,0xfd,
+0x10,0x0f,0x00,0x53,0xff,0xe2,0x00,0x15,0x55,0x01,0x00,0x7b,0x56,0x66,0x66,0x66,
+0x64,0x00,0x00,0xfb,0x07,0x18,0x7f,0x2e,0x00,0x38,0xf3,0x00,0x06,0x0f,0x00,0x10,
+0xf2,0xbe,0x00,0x09,0x0f,0x00,0x19,0x04,0x0f,0x00,0x00,0x9f,0x00,0xa0,0xe4,0x44,
+0x45,0x55,0x66,0x66,0x77,0x78,0x88,0x91,0x3d,0x08,0x17,0xef,0x42,0x0c,0x01,0x06,
+0x0d,0x1a,0xc0,0x8f,0x0d,0x1a,0xfc,0xc1,0x06,0x29,0xff,0xc1,0x10,0x00,0x29,0xcf,
+0xfc,0x9c,0x00,0x1b,0x0b,0x1f,0x00,0x11,0xaf,0x44,0x0c,0x07,0xa2,0x0c,0x19,0x70,
+0x1f,0x00,0x2f,0x99,0x00,0x01,0x00,0x07,0x37,0xbc,0xb9,0x63,0x0f,0x00,0x00,0x87,
+0x09,0x17,0xfa,0xb5,0x01,0x68,0x46,0x7a,0xdf,0xff,0xfe,0x81,0xa9,0x00,0x17,0x5b,
+0xb6,0x03,0x10,0x21,0x03,0x04,0x34,0xef,0xfd,0x30,0x3c,0x00,0x76,0xfe,0xa7,0x20,
+0x00,0x07,0xff,0xf8,0x4b,0x00,0x63,0xfc,0x50,0x00,0x1b,0xff,0xb0,0x3a,0x00,0x20,
+0x35,0x9d,0xeb,0x05,0x25,0x7f,0x90,0x4c,0x00,0x53,0x39,0xff,0xfb,0x20,0x02,0x0c,
+0x00,0x56,0x54,0x20,0x00,0x00,0x19,0x20,0x02,0x86,0xef,0xfe,0xa4,0x00,0x00,0x3d,
+0xe4,0x00,0x8e,0x0e,0x36,0xd6,0x00,0x00,0xe4,0x00,0x46,0x15,0x9f,0xff,0xc3,0x94,
+0x00,0x54,0x11,0x00,0x00,0x7e,0xf6,0x26,0x02,0x74,0x8c,0xff,0xff,0xfd,0xa3,0x01,
+0x20,0x52,0x06,0x45,0xfd,0x61,0x02,0x6c,0x2c,0x00,0x31,0x9f,0xff,0x90,0xd8,0x01,
+0x13,0x80,0x64,0x01,0x12,0xf9,0x96,0x02,0x13,0xfa,0x96,0x08,0x50,0xd0,0x00,0x07,
+0xa9,0x20,0xdb,0x0e,0x02,0xfc,0x04,0x92,0x60,0x00,0xcf,0xff,0xf3,0x00,0x3f,0xff,
+0xf5,0x08,0x06,0x92,0x10,0x07,0xff,0xff,0xfd,0x00,0x0e,0xff,0xfe,0x1b,0x02,0x01,
+0x76,0x03,0x51,0x10,0x0d,0xff,0xff,0x20,0x1e,0x00,0x01,0xfe,0x03,0x42,0x00,0x0d,
+0xff,0xfe,0x5f,0x0d,0x20,0x20,0x04,0xcd,0x0a,0x32,0x0f,0xff,0xf7,0xdb,0x0d,0x11,
+0x80,0xa5,0x09,0x35,0x5f,0xff,0xd0,0x62,0x0d,0x10,0x10,0xb6,0x0c,0x12,0x20,0x4e,
+0x0c,0x01,0xdc,0x01,0x14,0x0a,0x3c,0x03,0x10,0x4e,0x19,0x09,0x23,0x02,0xcf,0xc6,
+0x09,0x00,0x9e,0x05,0x55,0xd9,0x89,0xcf,0xff,0x91,0x81,0x01,0x1c,0x7b,0xf0,0x08,
+0x90,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x08,0xee,0x01,0x00,0x62,
+0x90,0x00,0x00,0x00,0x2f,0xff,0x01,0x00,0x63,0xfb,0x00,0x00,0x00,0x3f,0xff,0x01,
+0x00,0x60,0xb0,0x00,0x00,0x3f,0xfd,0x33,0x01,0x00,0x10,0x38,0x19,0x00,0x30,0x3f,
+0xfc,0x00,0x1e,0x00,0x45,0xd0,0x8f,0xff,0xb0,0x0c,0x00,0x35,0x08,0xff,0xfa,0x0c,
+0x00,0x45,0x00,0x8f,0xff,0xa0,0x0c,0x00,0x33,0x08,0xff,0xf9,0x0c,0x00,0x53,0xfe,
+0xee,0xe8,0x8f,0xfd,0x0c,0x00,0x52,0xff,0xff,0xf9,0x1f,0xfe,0x0c,0x00,0x44,0x02,
+0x22,0x22,0x21,0x0c,0x00,0x00,0x01,0x00,0x0f,0x0c,0x00,0xa4,0x23,0xff,0xee,0x01,
+0x00,0x45,0xef,0xfe,0x3f,0xff,0x01,0x00,0x26,0xfd,0x0b,0x0c,0x00,0x2c,0xf8,0x00,
+0x01,0x00,0x29,0x01,0x22,0x0f,0x00,0x56,0x08,0xef,0xff,0xfc,0x60,0x0f,0x00,0x75,
+0x03,0xef,0xff,0xee,0xff,0xfc,0x10,0x10,0x00,0x75,0x4f,0xfc,0x50,0x00,0x17,0xef,
+0xe2,0x3d,0x00,0x92,0xef,0xa0,0x00,0x00,0x00,0x1d,0xfc,0x01,0x32,0x10,0x00,0x22,
+0x0a,0xfc,0x16,0x00,0x31,0xef,0xff,0xe8,0x10,0x00,0x21,0x2f,0xf2,0x07,0x00,0x50,
+0x5f,0xff,0xef,0xff,0xd1,0x09,0x00,0x21,0x7f,0xb0,0x10,0x00,0x50,0x0c,0x60,0x00,
+0x7e,0xfd,0x09,0x00,0x24,0xaf,0x70,0x4a,0x00,0x20,0x02,0xef,0xfa,0x01,0x16,0xbf,
+0x7b,0x00,0x20,0x3f,0xf1,0x10,0x00,0x15,0x70,0x10,0x00,0x72,0x0c,0xf6,0x00,0x00,
+0x04,0xff,0x90,0x0d,0x00,0x91,0x14,0x83,0x00,0x07,0xf9,0x00,0x00,0x2f,0xfa,0x0e,
+0x00,0xb0,0x15,0x8c,0xff,0xf7,0x00,0x06,0xfb,0x00,0x00,0xbf,0xc0,0x0e,0x00,0x10,
+0x9d,0x3b,0x02,0x00,0x10,0x00,0x32,0x03,0xff,0x20,0x0e,0x00,0xb1,0xff,0xfd,0xa5,
+0x00,0x09,0xf9,0x00,0x09,0xfa,0x00,0x0c,0x0e,0x00,0x60,0x95,0x10,0x00,0x00,0x0e,
+0xf4,0x03,0x00,0x60,0x0a,0xff,0xff,0xfc,0x86,0x30,0x45,0x00,0xc1,0x6f,0xf5,0x00,
+0x1f,0xf0,0x00,0x06,0xfb,0x74,0x00,0x0a,0xc0,0x70,0x00,0x42,0xfe,0x10,0x3f,0xd0,
+0xf4,0x00,0x11,0xf6,0x07,0x00,0x41,0xdf,0x90,0x4f,0xc0,0x09,0x00,0x31,0xef,0xff,
+0x10,0x17,0x00,0x21,0xf0,0x2f,0x20,0x00,0x11,0x09,0x9c,0x02,0x00,0x51,0x00,0x23,
+0x1f,0xf0,0x58,0x02,0x11,0xf5,0x0c,0x01,0x31,0xf6,0x0d,0xf4,0x38,0x00,0x31,0xff,
+0xff,0xfe,0x5a,0x01,0x30,0xf7,0x08,0xfa,0x07,0x00,0x00,0x82,0x00,0x10,0x80,0x38,
+0x00,0xc0,0xf6,0x01,0xff,0x30,0x00,0x00,0x06,0x77,0x77,0x77,0x77,0x70,0x71,0x00,
+0x47,0xf4,0x00,0x9f,0xd1,0x8a,0x01,0x47,0x2f,0xf0,0x00,0x1e,0x7a,0x01,0x75,0x00,
+0xbf,0xa0,0x00,0x03,0xef,0xe5,0x0f,0x00,0xf0,0x03,0x09,0xfe,0x10,0x00,0x00,0x2d,
+0xff,0xd7,0x43,0x33,0x34,0x44,0x45,0x55,0x56,0x68,0xdf,0xf3,0x16,0x00,0x15,0x8f,
+0xea,0x01,0x21,0xfc,0x30,0x27,0x00,0xa7,0x59,0xbc,0xcc,0xcc,0xcc,0xbb,0xbb,0xbb,
+0xb9,0x40,0x5b,0x00,0x38,0x09,0x99,0x60,0xf4,0x01,0x3f,0x1f,0xff,0xa0,0x0f,0x00,
+0x0c,0x29,0x35,0x41,0x0f,0x00,0x28,0xbf,0xf6,0x0f,0x00,0x38,0x01,0xff,0xf2,0x0f,
+0x00,0x35,0x07,0xff,0xd0,0x1f,0x02,0x61,0x9f,0xff,0xd4,0x07,0xff,0x70,0x0b,0x00,
+0x90,0x10,0x00,0x00,0x4f,0xff,0xff,0xff,0x90,0x8f,0xd3,0x00,0x51,0x4b,0xff,0xfd,
+0x81,0x02,0x90,0x02,0x13,0x04,0x13,0x01,0x81,0xfc,0x0b,0xff,0xe5,0x13,0xaf,0xff,
+0x10,0x2e,0x02,0xa0,0xfd,0xdf,0xfa,0x0f,0xff,0x40,0x00,0x0d,0xff,0x70,0x4d,0x02,
+0x90,0xfb,0x20,0x03,0xb8,0x2f,0xff,0x00,0x00,0x08,0xfe,0x01,0x60,0x07,0xff,0xc0,
+0x00,0x00,0x01,0x0f,0x00,0x10,0x0a,0x46,0x01,0x20,0x0e,0xff,0xd8,0x00,0x70,0x0f,
+0xff,0x70,0x00,0x2f,0xff,0x50,0x9f,0x02,0x11,0x00,0x50,0x00,0x21,0xfb,0x89,0x74,
+0x01,0x12,0x9f,0xa8,0x00,0x50,0xcf,0xff,0xff,0xff,0xf4,0x8a,0x01,0x12,0xf1,0xa5,
+0x02,0x30,0xff,0xff,0xfd,0x36,0x00,0x04,0xa8,0x00,0x11,0x3f,0xc0,0x01,0x38,0x03,
+0xff,0x90,0xff,0x00,0x38,0x06,0xff,0x50,0x0f,0x00,0x38,0x09,0xff,0x30,0x0f,0x00,
+0x29,0x0b,0xff,0x2c,0x01,0x29,0x0d,0xfe,0x0f,0x00,0x29,0x0f,0xfd,0x0f,0x00,0x29,
+0x1f,0xfb,0x0f,0x00,0x29,0x2f,0xf9,0x0f,0x00,0x29,0x4f,0xf8,0x0f,0x00,0x29,0x5f,
+0xf7,0x0f,0x00,0x2a,0x7f,0xf6,0x95,0x01,0x1b,0x10,0xbd,0x03,0x10,0x43,0xe6,0x00,
+0x30,0xff,0xe4,0x00,0xe3,0x03,0xf0,0x14,0x30,0x4f,0xf7,0x12,0xcf,0xc0,0x9f,0xb0,
+0x00,0x3f,0xf1,0xbf,0x80,0x00,0x0f,0xf2,0x9f,0xc0,0x00,0x4f,0xf0,0x3f,0xfb,0x57,
+0xff,0xa0,0x08,0xff,0xff,0xfe,0x10,0x00,0x5c,0xfe,0x91,0x34,0x00,0x36,0x38,0x88,
+0x30,0x55,0x03,0x05,0xac,0x01,0x00,0x69,0x01,0x07,0x1d,0x04,0x35,0x3f,0xff,0x20,
+0x0c,0x00,0x36,0x05,0xff,0xb0,0x19,0x00,0x3f,0x8f,0xf5,0x00,0x01,0x00,0x0e,0x16,
+0xef,0x1f,0x02,0x25,0x04,0xff,0xa0,0x04,0x00,0x78,0x01,0x16,0x20,0x28,0x02,0x24,
+0xff,0x80,0x0c,0x00,0x44,0x6f,0xfb,0xff,0xe0,0x0c,0x00,0x44,0xcf,0xf4,0xcf,0xf4,
+0x12,0x04,0x44,0xff,0xe0,0x6f,0xfa,0x96,0x04,0x32,0xff,0x80,0x1f,0x76,0x03,0x00,
+0xf3,0x01,0x44,0x20,0x0a,0xff,0x60,0x8f,0x04,0x20,0x00,0x04,0x11,0x02,0x01,0x4c,
+0x04,0x52,0xf7,0x00,0x00,0xef,0xf2,0xcb,0x00,0x52,0xff,0xf1,0x00,0x00,0x9f,0xcf,
+0x00,0x11,0x06,0x3a,0x06,0x12,0xfe,0xef,0x00,0x00,0xd5,0x01,0x31,0x0d,0xff,0x40,
+0x5f,0x03,0x00,0xc3,0x01,0x12,0x07,0x56,0x01,0x23,0x8f,0xfa,0x35,0x00,0x00,0xbd,
+0x00,0x10,0xfe,0x41,0x05,0x21,0xff,0xf6,0xbd,0x00,0x03,0x4b,0x03,0x02,0xbd,0x00,
+0x02,0x01,0x00,0x10,0x30,0xbd,0x00,0x01,0x42,0x01,0x10,0x0b,0x32,0x02,0x22,0x7f,
+0xfd,0x24,0x01,0x00,0xc3,0x00,0x13,0xdf,0x41,0x01,0x44,0xff,0xf5,0x00,0x02,0x14,
+0x03,0x44,0xaf,0xfb,0x00,0x09,0x65,0x01,0x42,0x5f,0xff,0x10,0x0e,0x0e,0x03,0x01,
+0xb3,0x02,0x14,0x5f,0x0f,0x01,0x14,0x0a,0x21,0x00,0x37,0x05,0x88,0x71,0x82,0x01,
+0x06,0xfc,0x04,0x14,0xcf,0x08,0x01,0x03,0x00,0x03,0x04,0x45,0x01,0x16,0xfd,0x0f,
+0x02,0x2f,0xaf,0xe2,0x98,0x01,0xff,0x48,0x36,0x38,0x70,0x00,0xa7,0x06,0x06,0x8b,
+0x01,0x25,0x1e,0xfd,0x2c,0x01,0x54,0x01,0xdf,0xd1,0x5f,0xf6,0x54,0x03,0x43,0xfe,
+0x20,0x07,0xff,0x6e,0x05,0x6f,0x38,0x83,0x00,0x00,0x68,0x70,0x30,0x03,0xff,0x47,
+0x33,0x00,0x00,0x32,0x39,0x03,0x54,0xdf,0xb3,0x00,0x04,0xff,0x36,0x00,0x43,0xff,
+0x81,0x1c,0xfd,0x5a,0x01,0x52,0xea,0xcf,0xff,0xff,0xf7,0xca,0x08,0x43,0xff,0x30,
+0x06,0xff,0xca,0x04,0x6f,0x04,0xdb,0x00,0x00,0x16,0x84,0x30,0x03,0xff,0x45,0x63,
+0x2b,0xc3,0x00,0x00,0x7c,0x90,0xb4,0x08,0x53,0xfd,0x00,0x02,0xff,0xf6,0x13,0x01,
+0x43,0xfe,0x00,0x03,0xff,0xde,0x06,0x6e,0x4e,0xe5,0x00,0x00,0xaf,0xc1,0xb2,0x04,
+0x0f,0x24,0x03,0xff,0x3f,0x36,0x03,0xcf,0xe9,0x52,0x06,0x35,0xfb,0xcf,0xc0,0x4d,
+0x0a,0x25,0x40,0x09,0xc9,0x07,0x35,0xed,0x00,0x03,0xfa,0x07,0x35,0xee,0x00,0x04,
+0x0c,0x00,0x46,0x9f,0x91,0x2d,0xf3,0x29,0x08,0x07,0x8f,0x06,0x2f,0x59,0x83,0xa4,
+0x01,0xff,0x32,0x50,0x00,0x00,0x0a,0xff,0xd0,0x12,0x00,0x01,0x00,0x23,0x01,0xff,
+0x01,0x00,0x23,0xf0,0x00,0x01,0x00,0x14,0xaf,0x12,0x00,0x04,0x11,0x00,0x50,0x4f,
+0xff,0xff,0xfc,0xcc,0x01,0x00,0x13,0xb0,0x11,0x00,0x58,0x0d,0xff,0xef,0xfd,0x00,
+0x01,0x00,0x58,0x07,0xff,0xf7,0xff,0xd0,0x11,0x00,0x59,0x01,0xff,0xf7,0x5f,0xfe,
+0x23,0x00,0x58,0xaf,0xfe,0x04,0xff,0xf0,0x11,0x00,0x45,0x3f,0xff,0x50,0x4f,0x63,
+0x00,0x02,0x56,0x00,0x29,0xc0,0x03,0x23,0x00,0x78,0x06,0xff,0xf3,0x00,0x2f,0xff,
+0x10,0x56,0x00,0x58,0xfa,0x00,0x02,0xff,0xf1,0x56,0x00,0x42,0xff,0x20,0x00,0x1f,
+0xae,0x00,0x12,0x80,0x56,0x00,0x00,0x08,0x00,0x02,0x11,0x00,0x11,0xf8,0x11,0x00,
+0xd2,0x0c,0xff,0xe1,0x00,0x00,0x0f,0xff,0xcb,0xbb,0xbb,0xbb,0xbb,0x60,0x56,0x00,
+0x66,0xf6,0x00,0x00,0x00,0xff,0xf4,0x56,0x00,0x01,0xcd,0x00,0x35,0x0e,0xff,0x50,
+0x12,0x00,0x87,0x9f,0xff,0x72,0x22,0x22,0x22,0xef,0xf5,0xac,0x00,0x02,0x01,0x00,
+0x14,0x60,0x11,0x00,0x13,0x0c,0x11,0x00,0x16,0xf7,0xac,0x00,0x03,0x01,0x00,0x15,
+0x70,0x56,0x00,0x02,0xba,0x00,0x26,0xbf,0xf8,0x56,0x00,0x01,0x3f,0x00,0x33,0x0a,
+0xff,0x90,0x11,0x00,0x13,0x2f,0x34,0x01,0x25,0xaf,0xf9,0x56,0x00,0x11,0xf3,0x08,
+0x00,0x40,0x09,0xff,0xeb,0xbb,0x01,0x00,0x42,0xb0,0x05,0xff,0xfa,0x1a,0x00,0x14,
+0x8f,0x93,0x01,0x13,0xef,0x10,0x01,0x17,0x08,0xb6,0x01,0x50,0x49,0xdf,0xfe,0xc9,
+0x30,0x15,0x00,0x10,0x3d,0x12,0x00,0x22,0xfb,0x10,0x8e,0x00,0xf1,0x04,0xef,0xff,
+0xff,0xe2,0x00,0x00,0x5f,0xff,0xf7,0x20,0x00,0x28,0xff,0xfe,0x10,0x01,0xff,0xfe,
+0x20,0xcc,0x01,0x42,0x90,0x09,0xff,0xf2,0x42,0x00,0x42,0xf1,0x0f,0xff,0x80,0x57,
+0x01,0x41,0xf6,0x5f,0xff,0x20,0x57,0x00,0x33,0xcf,0xf9,0x9f,0xda,0x01,0x44,0x58,
+0x86,0xcf,0xfa,0xba,0x00,0x15,0xdf,0xc4,0x00,0x16,0xef,0x0a,0x00,0x1f,0xf7,0x0a,
+0x00,0x09,0x06,0x32,0x00,0x06,0x46,0x00,0x04,0x5a,0x00,0x53,0x47,0x75,0x5f,0xff,
+0x10,0x6e,0x00,0x15,0x1f,0x82,0x00,0x33,0x09,0xff,0xf1,0x96,0x00,0x41,0x01,0xff,
+0xfd,0x10,0x74,0x01,0x61,0x90,0x00,0x5f,0xff,0xe6,0x00,0xbe,0x00,0x00,0xd2,0x00,
+0x21,0xfe,0xdf,0xd2,0x00,0x24,0x00,0x4d,0xe6,0x00,0x73,0x00,0x00,0x5a,0xef,0xff,
+0xc8,0x20,0xa5,0x02,0x05,0x17,0x02,0x33,0x8f,0xff,0x80,0x0a,0x00,0x25,0x48,0xdf,
+0xc3,0x01,0x24,0x1f,0xf9,0x0a,0x00,0x24,0x0e,0xfa,0xa2,0x01,0x23,0x9f,0xf6,0x0a,
+0x00,0x24,0xbf,0xff,0xda,0x02,0x21,0xae,0xb6,0x07,0x00,0x35,0x02,0x88,0x83,0xb7,
+0x02,0x03,0x80,0x02,0x15,0x0b,0x24,0x00,0x14,0xcf,0x37,0x00,0x14,0x1d,0x9c,0x02,
+0x4f,0x02,0x88,0x40,0x00,0x01,0x00,0x01,0x13,0x0f,0xa5,0x01,0x17,0xf1,0x09,0x00,
+0x11,0xee,0x01,0x00,0x24,0xe0,0x0f,0x6f,0x02,0x0f,0x09,0x00,0x2e,0x03,0x88,0x02,
+0x07,0x09,0x00,0x6f,0xed,0xdd,0xdd,0xdd,0xdd,0xd5,0x5a,0x00,0x2f,0x0e,0x09,0x00,
+0x01,0x5a,0x00,0x24,0xdd,0xd3,0xcf,0x00,0x15,0xf3,0x09,0x00,0x02,0x33,0x02,0x12,
+0x87,0x10,0x01,0x14,0x03,0x17,0x03,0x14,0x0d,0x8a,0x01,0x33,0x8f,0xf9,0x00,0x1a,
+0x00,0x12,0xa0,0x09,0x00,0x3f,0x05,0x87,0x00,0x32,0x01,0xef,0x14,0x02,0x05,0x01,
+0x13,0x1e,0x5c,0x02,0x42,0x01,0xdf,0xdf,0xf9,0x09,0x04,0x22,0xfe,0x24,0x49,0x04,
+0x51,0xbf,0xf3,0x00,0x6f,0xf5,0x62,0x02,0x1e,0x30,0x34,0x01,0x0f,0x32,0x01,0xdd,
+0x61,0x02,0xbc,0x40,0x00,0x06,0xca,0x43,0x05,0x50,0xf0,0x00,0x1f,0xff,0x70,0x95,
+0x03,0x30,0xf0,0x00,0x2f,0x65,0x02,0x63,0x03,0xdf,0x70,0x00,0x09,0xfd,0x0b,0x04,
+0x0f,0x5b,0x02,0xed,0x50,0x28,0x88,0x40,0x00,0x0a,0xf7,0x06,0x20,0xbf,0xfb,0x54,
+0x06,0x96,0x60,0x00,0x01,0xdf,0xf2,0x00,0x00,0x28,0x84,0x0c,0x01,0x2f,0xcf,0xf9,
+0x04,0x00,0x52,0x70,0x05,0x88,0x71,0x00,0x3f,0xff,0x70,0x0e,0x06,0xaf,0x08,0xff,
+0x90,0x00,0x3f,0xfa,0x00,0x00,0x58,0x70,0x86,0x00,0x5d,0x00,0x6a,0x00,0x21,0x28,
+0x70,0x92,0x07,0x10,0xfb,0xb5,0x05,0x10,0xfd,0x80,0x07,0xda,0xcf,0xe2,0x4f,0xf7,
+0x00,0x0a,0xff,0x30,0x05,0xff,0x50,0x28,0x84,0x96,0x00,0x04,0x9a,0x00,0x0f,0x06,
+0x00,0x83,0xfe,0x09,0x1a,0xc4,0x00,0x00,0x6c,0xa1,0xaf,0xff,0x00,0x01,0xff,0xf8,
+0xaf,0xff,0x00,0x02,0xff,0xf9,0x3d,0xf7,0x00,0x00,0x9f,0xd2,0xf2,0x02,0x0f,0xc6,
+0x00,0x89,0x02,0xbf,0x08,0x27,0xdb,0x61,0xdc,0x08,0x12,0xf8,0xfe,0x07,0x51,0xfe,
+0xee,0xef,0xff,0xff,0xc9,0x03,0x10,0x8f,0x40,0x0a,0x40,0x5b,0xff,0xfe,0x10,0x17,
+0x00,0x10,0xe0,0x34,0x06,0x24,0xff,0xfc,0x17,0x00,0x43,0x00,0x04,0xff,0xf6,0x17,
+0x00,0x00,0x2e,0x09,0x13,0xe0,0x17,0x00,0x00,0x53,0x09,0x14,0x40,0x17,0x00,0x01,
+0x69,0x00,0x23,0x8f,0xfe,0x51,0x09,0x15,0xc0,0x17,0x00,0x90,0x6f,0xfe,0x0a,0xcc,
+0xef,0xff,0xcc,0xcc,0x30,0x27,0x09,0x20,0xf0,0xef,0x7c,0x00,0x20,0xf4,0x00,0x29,
+0x09,0x11,0x0e,0x88,0x00,0x10,0x40,0x69,0x00,0x16,0xf0,0x2e,0x00,0x15,0xff,0x45,
+0x00,0x35,0x07,0xff,0xe0,0x17,0x00,0x25,0x9f,0xfc,0x17,0x00,0x34,0x0d,0xff,0x90,
+0x17,0x00,0x35,0x03,0xff,0xf4,0x17,0x00,0x25,0xaf,0xfe,0xa1,0x00,0x34,0x5f,0xff,
+0x70,0x17,0x00,0x33,0x6f,0xff,0xd0,0x17,0x00,0x41,0x15,0xcf,0xff,0xe2,0xfd,0x00,
+0x66,0xdd,0xdd,0xef,0xff,0xff,0xd2,0xd3,0x09,0x14,0x90,0x14,0x01,0x27,0xfd,0xa6,
+0xfb,0x0a,0x21,0x03,0x20,0x66,0x0a,0x53,0xdf,0xb3,0x00,0x05,0xff,0x70,0x0a,0x41,
+0xf8,0x12,0xdf,0xc0,0x76,0x09,0x51,0xea,0xcf,0xff,0xff,0xf6,0x04,0x09,0x32,0xf2,
+0x00,0x6f,0x32,0x0a,0x6f,0x05,0xdb,0x00,0x00,0x16,0x84,0x0b,0x05,0x07,0x13,0xa0,
+0xd4,0x08,0x23,0xa0,0xff,0x50,0x04,0x31,0xbf,0xfa,0x0f,0x6b,0x01,0x03,0x15,0x00,
+0x15,0xf9,0x15,0x00,0x25,0xff,0xf4,0x15,0x00,0x24,0xff,0xd0,0x15,0x00,0x33,0xaf,
+0xff,0x80,0x15,0x00,0x43,0xf5,0xaf,0xff,0x30,0x15,0x00,0x34,0x51,0xef,0xfc,0x15,
+0x00,0x33,0x05,0xff,0xf7,0x15,0x00,0x43,0x50,0x0b,0xff,0xf2,0x15,0x00,0x43,0x00,
+0x2f,0xff,0xb0,0x15,0x00,0x43,0x00,0x7f,0xff,0x60,0x15,0x00,0x43,0x00,0xcf,0xfe,
+0x10,0x15,0x00,0x34,0x02,0xff,0xfa,0x15,0x00,0x32,0x08,0xff,0xf4,0x15,0x00,0x00,
+0x60,0x01,0x13,0xe0,0x15,0x00,0x00,0x13,0x0a,0x02,0x15,0x00,0x00,0x4d,0x0b,0x13,
+0x3b,0x15,0x00,0x34,0x00,0xef,0xfd,0x15,0x00,0x34,0x04,0xff,0xff,0x15,0x00,0x43,
+0x0a,0xff,0xff,0xfa,0x2c,0x05,0x15,0x1e,0x15,0x00,0x25,0x00,0x5f,0x15,0x00,0x24,
+0x00,0xbf,0x15,0x00,0x00,0x56,0x0c,0x00,0x30,0x00,0x16,0xf2,0xdc,0x0b,0x25,0xc0,
+0x00,0x99,0x07,0x16,0x60,0x03,0x0c,0x05,0x8e,0x01,0x25,0x5f,0xfa,0x4a,0x01,0x2f,
+0x58,0x71,0x73,0x06,0x08,0x00,0x99,0x0b,0x02,0x9f,0x0a,0x20,0x02,0xcf,0xda,0x01,
+0x11,0xa1,0xc5,0x02,0x01,0x01,0x00,0x10,0xe2,0x2d,0x02,0x50,0xff,0xa4,0x10,0x15,
+0xbf,0xa8,0x05,0x31,0xef,0xff,0x30,0x1c,0x02,0x40,0xb0,0x00,0x7f,0xff,0x4a,0x0a,
+0x00,0x07,0x00,0x13,0x0e,0xa4,0x01,0x53,0xdf,0xfa,0x04,0xff,0xf3,0x80,0x02,0x34,
+0xf0,0x8f,0xfd,0x3a,0x0c,0x34,0x4b,0xff,0xa0,0x74,0x0b,0x24,0xdf,0xf8,0xb8,0x00,
+0x14,0x9e,0x7e,0x0c,0x44,0xbf,0xf9,0xef,0xf7,0xb7,0x0a,0x15,0xae,0x15,0x00,0x16,
+0xfa,0x15,0x00,0x34,0x9d,0xff,0x80,0x24,0x04,0x23,0xbf,0xfa,0x18,0x0b,0x43,0xff,
+0x78,0xff,0xe0,0x11,0x01,0x44,0xf4,0x4f,0xff,0x30,0xff,0x02,0x23,0xef,0xfa,0xe7,
+0x02,0x10,0xb0,0x95,0x01,0x01,0x7b,0x02,0x51,0xf4,0x00,0x0e,0xff,0xf3,0xcd,0x00,
+0x10,0xfb,0x52,0x0c,0x41,0xf9,0x30,0x00,0x4a,0x3d,0x02,0x11,0x5f,0xdc,0x00,0x10,
+0xfe,0x3b,0x00,0x16,0x2c,0xa5,0x0b,0x54,0x04,0x9d,0xff,0xec,0x83,0x13,0x01,0x13,
+0x04,0x97,0x0d,0x01,0xda,0x00,0x05,0xb2,0x0b,0x24,0xfc,0x00,0x13,0x0d,0x01,0xfb,
+0x0b,0x02,0x03,0x09,0x14,0x20,0xa8,0x0b,0x2f,0x88,0x30,0x65,0x01,0xff,0x13,0x50,
+0xec,0x83,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x00,0x2e,0xfc,0x00,0x01,0x00,0x33,
+0x1d,0xff,0xfa,0x0a,0x00,0x42,0x0c,0xfe,0x5f,0xf8,0x0a,0x00,0x51,0x0b,0xff,0x20,
+0x4f,0xf6,0x0a,0x00,0x7f,0x09,0xff,0x40,0x00,0x6f,0xf4,0x00,0x01,0x00,0x11,0x50,
+0x49,0xdf,0xfe,0xc8,0x20,0x09,0x00,0xc1,0x02,0xcf,0xff,0xff,0xff,0xff,0xa1,0x00,
+0x00,0x00,0x05,0xff,0x01,0x00,0xf0,0x0f,0xe2,0x00,0x00,0x03,0xff,0xff,0xa4,0x10,
+0x15,0xbf,0xff,0xe1,0x00,0x00,0xef,0xff,0x30,0x00,0x00,0x00,0x6f,0xff,0xb0,0x00,
+0x7f,0xff,0x40,0x00,0x00,0x00,0x07,0x00,0x31,0x0e,0xff,0xa0,0x44,0x00,0x51,0xdf,
+0xfa,0x04,0xff,0xf3,0x0a,0x00,0x52,0x07,0xff,0xf0,0x8f,0xfd,0x59,0x00,0x33,0x2f,
+0xff,0x4b,0x1f,0x00,0x53,0x00,0xef,0xf7,0xdf,0xf8,0xad,0x00,0x42,0xff,0x9e,0xff,
+0x70,0x0b,0x00,0x44,0xbf,0xf9,0xef,0xf7,0xb8,0x00,0x15,0xae,0x15,0x00,0x16,0xfa,
+0x15,0x00,0x32,0x9d,0xff,0x80,0x0b,0x00,0x33,0xcf,0xf9,0xbf,0xed,0x00,0x51,0x0e,
+0xff,0x78,0xff,0xe0,0x0a,0x00,0x41,0x01,0xff,0xf4,0x4f,0x92,0x00,0x00,0x94,0x00,
+0x22,0x00,0xef,0x20,0x00,0x51,0x0d,0xff,0xb0,0x08,0xff,0xf7,0x00,0x71,0x06,0xff,
+0xf4,0x00,0x0e,0xff,0xf3,0xcd,0x00,0xf1,0x00,0xfb,0x00,0x00,0x4f,0xff,0xf9,0x30,
+0x00,0x4a,0xff,0xfe,0x10,0x00,0x00,0x5f,0xdc,0x00,0x10,0xfe,0x3b,0x00,0x10,0x2c,
+0x0a,0x00,0x20,0xfb,0x10,0x30,0x00,0x56,0x04,0x9d,0xff,0xec,0x83,0x15,0x01,0x11,
+0x23,0x15,0x00,0x62,0x1a,0xfe,0xa3,0x00,0x0c,0xf9,0x59,0x00,0x51,0xff,0xfc,0x9c,
+0xff,0x60,0x59,0x00,0x51,0xc9,0xdf,0xff,0xff,0xd0,0xac,0x00,0x60,0xa0,0x00,0x5c,
+0xfe,0x91,0x00,0x64,0x00,0x1f,0x62,0x65,0x01,0xff,0x1d,0x61,0x06,0xc9,0x00,0x00,
+0x1a,0xc5,0x11,0x01,0x62,0xff,0xf7,0x00,0x09,0xff,0xf0,0xcc,0x00,0x41,0x80,0x00,
+0x9f,0xff,0x2a,0x00,0x6f,0x9f,0xc1,0x00,0x02,0xdf,0x80,0xbf,0x02,0x11,0x00,0x54,
+0x00,0x34,0x82,0x00,0x00,0x69,0x00,0x35,0xfa,0x10,0x00,0x7e,0x00,0x90,0x20,0x00,
+0x00,0x3f,0xff,0xfa,0x41,0x01,0x5b,0x93,0x00,0x02,0xa8,0x00,0x52,0x06,0xff,0xfb,
+0x00,0x07,0xbd,0x00,0x00,0x07,0x00,0x05,0xd2,0x00,0x14,0xa0,0xe7,0x00,0x31,0x7f,
+0xff,0x08,0xdd,0x01,0x00,0x99,0x00,0x16,0xf4,0x11,0x01,0x16,0x7d,0x26,0x01,0x06,
+0x3b,0x01,0x1e,0x9e,0x50,0x01,0x08,0x65,0x01,0x16,0xf9,0x8f,0x01,0x16,0x9b,0xa4,
+0x01,0x22,0x8f,0xfe,0x0a,0x00,0x33,0x1f,0xff,0x44,0xce,0x01,0x35,0x06,0xff,0xf0,
+0xe3,0x01,0x52,0xfb,0x00,0x8f,0xff,0x40,0x6f,0x01,0x13,0x40,0x0d,0x02,0xd5,0x5f,
+0xff,0xb0,0x00,0x04,0xff,0xff,0x93,0x00,0x04,0xaf,0xff,0xe1,0x37,0x02,0x15,0xe3,
+0x4c,0x02,0x15,0xb1,0x61,0x02,0x01,0xc2,0x00,0x22,0x20,0x00,0x06,0x00,0x11,0x3f,
+0xb1,0x00,0x31,0x9e,0x20,0x2e,0x90,0x00,0x60,0x8f,0xfe,0x10,0xcf,0xff,0x60,0xdf,
+0x00,0x20,0xb0,0x00,0x09,0x00,0x80,0x6f,0xff,0xc0,0x00,0x01,0xdf,0xff,0x50,0x08,
+0x00,0x00,0x09,0x00,0x30,0x8f,0xff,0xd1,0xef,0x01,0x41,0xef,0xff,0xff,0xd1,0xfc,
+0x00,0x10,0xef,0x6b,0x00,0x10,0x00,0x40,0x01,0x11,0xfe,0x51,0x00,0x22,0x3e,0xff,
+0x09,0x00,0x31,0x2e,0xff,0xe6,0x09,0x00,0xc0,0x2e,0xff,0xf3,0x04,0xff,0xfd,0x10,
+0x00,0x1d,0xff,0xf4,0x00,0x09,0x00,0x30,0x1d,0xff,0xf4,0x9b,0x00,0x41,0xfd,0x11,
+0xef,0xf5,0xd2,0x00,0x31,0xd1,0x02,0xe6,0xdb,0x00,0x32,0xe1,0x00,0x01,0x49,0x02,
+0x06,0xb1,0x01,0x24,0xbf,0xb0,0x10,0x03,0x33,0x04,0xff,0x20,0xb6,0x01,0x35,0xf9,
+0x0d,0xf9,0xda,0x00,0x50,0xef,0xe1,0x00,0x00,0x4f,0xb7,0x01,0x46,0x5c,0xff,0xff,
+0x60,0x12,0x03,0x23,0x90,0x00,0x75,0x02,0x43,0x5f,0xff,0xf3,0x00,0x30,0x01,0x42,
+0xef,0xff,0xf9,0x00,0xb9,0x01,0x52,0x09,0xfd,0x8f,0xff,0x00,0x5b,0x01,0x52,0x3f,
+0xf4,0x3f,0xff,0x30,0xba,0x01,0x51,0xdf,0x90,0x0f,0xff,0x60,0x86,0x01,0x61,0x08,
+0xfe,0x10,0x0d,0xff,0x80,0xa6,0x01,0x61,0x2f,0xf5,0x00,0x0c,0xff,0x90,0x0b,0x00,
+0x80,0xcf,0xb0,0x00,0x0b,0xff,0xa0,0xef,0xf7,0xb2,0x00,0x10,0x10,0x0b,0x00,0x70,
+0xdf,0xf7,0x00,0x00,0x1f,0xf6,0x00,0x0b,0x00,0x70,0xcf,0xf8,0x00,0x00,0xbf,0xc0,
+0x00,0x2c,0x00,0x60,0xbf,0xfa,0x00,0x05,0xff,0x20,0x07,0x02,0x61,0x70,0x7f,0xfd,
+0x00,0x1e,0xf8,0xbe,0x01,0x62,0x40,0x3f,0xff,0x30,0x9f,0xd0,0x19,0x03,0x52,0x0e,
+0xff,0xa4,0xff,0x30,0xbf,0x01,0x43,0x06,0xff,0xfe,0xf9,0x1a,0x03,0x21,0x00,0xdf,
+0x46,0x03,0x10,0x5f,0x63,0x01,0x16,0x2f,0x1b,0x03,0x16,0x0c,0xc1,0x01,0x25,0x5f,
+0xfc,0x1c,0x03,0x33,0xef,0x80,0x39,0xc2,0x01,0x25,0x08,0xfe,0x2b,0x01,0x27,0x07,
+0x84,0xe9,0x02,0x14,0x5f,0x59,0x02,0x43,0x00,0x8f,0xff,0x20,0x0a,0x00,0x24,0xaf,
+0xfb,0x1e,0x00,0x23,0xcf,0xf5,0x09,0x00,0x33,0x01,0xef,0xe1,0x0a,0x00,0x3f,0x03,
+0x88,0x30,0x33,0x03,0x03,0x23,0x8f,0xfc,0x78,0x02,0x33,0xf8,0xff,0xc0,0xdc,0x03,
+0x0f,0x13,0x00,0x7d,0x13,0xd0,0x13,0x00,0x12,0x7f,0x0d,0x01,0x52,0x08,0xff,0xe4,
+0xff,0xf1,0x3e,0x02,0x42,0xfb,0x0f,0xff,0x80,0x2d,0x04,0x41,0x70,0xaf,0xff,0x40,
+0x5e,0x03,0xa0,0xf1,0x01,0xef,0xff,0x82,0x00,0x00,0x5d,0xff,0xf6,0x4b,0x05,0x54,
+0xfe,0xde,0xff,0xff,0xf8,0x1d,0x03,0x01,0x86,0x02,0x53,0x39,0xce,0xff,0xdb,0x60,
+0xfc,0x00,0x13,0x1e,0x6e,0x00,0x22,0x00,0x09,0xe2,0x02,0x00,0x7e,0x05,0x13,0xf2,
+0x1c,0x00,0x14,0xdf,0x31,0x07,0x24,0x7f,0xf6,0x81,0x01,0x2f,0x86,0x00,0x43,0x01,
+0xfe,0x14,0xbf,0x2f,0x01,0x14,0x9f,0x42,0x01,0x33,0x8f,0xf6,0xdf,0x6d,0x00,0x40,
+0xf6,0x01,0xef,0xb0,0x09,0x00,0x6e,0x4f,0xf8,0x00,0x02,0xef,0x90,0xb9,0x05,0x0f,
+0x43,0x01,0xf2,0x61,0x3b,0xb3,0x00,0x00,0x8c,0x80,0x77,0x06,0x50,0xc0,0x00,0x4f,
+0xff,0x50,0x7a,0x02,0x50,0xfd,0x00,0x04,0xff,0xf6,0x48,0x07,0x5f,0xee,0x50,0x00,
+0x0b,0xfb,0x39,0x01,0x0b,0x1f,0x08,0x30,0x01,0x86,0x05,0x13,0x00,0x13,0xfd,0x13,
+0x00,0x13,0xf7,0x48,0x08,0x52,0x8f,0xfe,0x4f,0xff,0x10,0x20,0x07,0x33,0xb0,0xff,
+0xf8,0xf7,0x07,0x12,0x0a,0xd0,0x05,0xf3,0x06,0xcf,0xff,0x10,0x1e,0xff,0xf8,0x20,
+0x00,0x05,0xdf,0xff,0x60,0x00,0x3f,0xff,0xff,0xed,0xef,0xff,0xff,0x80,0x18,0x06,
+0x20,0xfe,0x60,0xa1,0x03,0x45,0x9c,0xef,0xfd,0xb6,0xfe,0x00,0x33,0x58,0x87,0x10,
+0x0a,0x00,0x12,0x02,0x4a,0x00,0x02,0x62,0x07,0x14,0xa0,0x0b,0x00,0x35,0x6f,0xfc,
+0x00,0x0a,0x05,0x14,0xd1,0x0b,0x00,0x3f,0x0a,0xff,0x20,0x50,0x01,0x07,0x11,0x7f,
+0x83,0x01,0x01,0xc3,0x01,0x13,0x0e,0xf3,0x01,0x62,0x4f,0xff,0x70,0x06,0xff,0xf6,
+0x59,0x05,0x11,0xfe,0x9f,0x01,0x22,0x00,0x00,0xa2,0x01,0x31,0x4f,0xff,0x60,0x2b,
+0x00,0x13,0xd0,0x05,0x00,0x20,0x00,0x5f,0xff,0x01,0x11,0x03,0x2d,0x00,0x21,0xcf,
+0xfc,0x94,0x05,0x10,0xfd,0xcb,0x06,0x12,0xf3,0x1e,0x02,0x10,0x60,0x5c,0x08,0x02,
+0x6f,0x04,0x52,0xd0,0x00,0x5f,0xff,0x20,0x55,0x09,0x43,0xf6,0x00,0xdf,0xf9,0x05,
+0x03,0x44,0xfd,0x05,0xff,0xf1,0x65,0x08,0x14,0x6d,0x65,0x08,0x35,0x06,0xff,0xff,
+0x05,0x06,0x36,0xdf,0xff,0xf7,0x02,0x06,0x13,0xd0,0x0b,0x00,0x00,0x8b,0x06,0x0f,
+0x0b,0x00,0x54,0x13,0x1f,0x19,0x09,0x0f,0x09,0x00,0x13,0x00,0xb5,0x01,0x23,0xdb,
+0x61,0x09,0x00,0xc2,0xff,0xff,0x70,0x00,0x1f,0xff,0xdc,0xcc,0xcc,0xef,0xff,0xfa,
+0x24,0x00,0x42,0x03,0xbf,0xff,0x70,0x2d,0x00,0x31,0x0b,0xff,0xf1,0x09,0x00,0x00,
+0x0e,0x01,0x03,0x3f,0x00,0x23,0xcf,0xf9,0x09,0x00,0x24,0xaf,0xf9,0x12,0x00,0x1b,
+0xf8,0x24,0x00,0x34,0x0a,0xff,0xf1,0x48,0x00,0x40,0x80,0x1f,0xff,0xcc,0x5a,0x00,
+0x14,0xfb,0x6c,0x00,0x12,0x80,0x09,0x00,0x2f,0xeb,0x71,0xb4,0x00,0x1e,0x05,0x27,
+0x07,0x42,0x38,0xbb,0xa8,0x30,0x2f,0x02,0x12,0xff,0x5e,0x0d,0x01,0xbe,0x03,0x10,
+0xc0,0x2c,0x0a,0x50,0xf9,0x20,0x2a,0xff,0xf6,0x15,0x01,0x10,0x90,0xfe,0x03,0x30,
+0x00,0x00,0x3f,0xd0,0x02,0x61,0x4f,0xfe,0x00,0x00,0x6f,0xfd,0xe9,0x01,0x40,0x00,
+0x00,0x8f,0xfb,0x7d,0x08,0x13,0xfe,0x09,0x00,0x60,0x7f,0xfb,0x00,0x00,0x9f,0xfb,
+0xd9,0x07,0x12,0xf6,0x09,0x00,0x01,0x57,0x0a,0x20,0x9f,0xfb,0x70,0x00,0x12,0x50,
+0x09,0x00,0x32,0x6f,0xfe,0x00,0x09,0x00,0x01,0x42,0x03,0x08,0x12,0x00,0x00,0x57,
+0x04,0x02,0x09,0x00,0x22,0x0a,0xff,0x3f,0x00,0x00,0xa4,0x09,0x12,0x80,0x51,0x00,
+0x32,0x1c,0xff,0xf9,0x09,0x00,0x62,0x00,0xbf,0xff,0x80,0x9f,0xfb,0xb0,0x00,0x33,
+0xf3,0x9f,0xfb,0x24,0x0c,0x03,0x09,0x00,0x2c,0x7f,0xfc,0x09,0x00,0x10,0xcf,0x1b,
+0x00,0xf0,0x03,0x99,0x30,0x00,0x19,0xff,0xf5,0x9f,0xfb,0x00,0xdf,0xfe,0xcd,0xff,
+0xff,0xc0,0x9f,0xfb,0x01,0xe2,0x00,0xa1,0xfc,0x10,0x9f,0xfb,0x00,0x38,0xbe,0xff,
+0xeb,0x50,0xf1,0x02,0x12,0x10,0x3f,0x03,0x24,0xdf,0xfb,0x48,0x03,0x13,0xf5,0x71,
+0x03,0x24,0xef,0xf1,0x33,0x07,0x1f,0xb0,0xa3,0x04,0x0b,0x40,0x06,0xbd,0xff,0xda,
+0x16,0x05,0x10,0x4e,0x5e,0x00,0x10,0xb0,0xba,0x02,0x20,0xfd,0xbd,0x09,0x00,0x82,
+0x2f,0xff,0xb2,0x00,0x01,0x9f,0xff,0x50,0x64,0x0b,0x51,0xbf,0xfa,0x00,0x58,0x85,
+0xef,0x02,0x14,0xd0,0xe1,0x02,0x00,0x06,0x00,0x30,0x35,0x56,0x69,0x10,0x0c,0x11,
+0x6c,0xd6,0x01,0x31,0x00,0x02,0xdf,0x08,0x00,0x90,0xf0,0x00,0xef,0xff,0x84,0x10,
+0x00,0x5f,0xff,0xcb,0x0a,0x00,0x61,0x03,0x42,0xf0,0x0d,0xff,0x60,0x33,0x00,0x03,
+0x81,0x0c,0x21,0xf0,0x0f,0x89,0x05,0x13,0x9f,0xa8,0x0c,0xd1,0x6f,0xff,0xf0,0x09,
+0xff,0xfa,0x20,0x03,0xaf,0xff,0xff,0x00,0x1e,0x4c,0x04,0x40,0xff,0xf2,0x00,0x2d,
+0xd9,0x01,0xb0,0x2f,0xff,0x50,0x00,0x07,0xcf,0xfe,0xa3,0x00,0x9a,0xa5,0x10,0x00,
+0x01,0x00,0x31,0x8f,0xff,0x40,0x08,0x00,0x31,0x3f,0xff,0x50,0x08,0x00,0x31,0x0d,
+0xff,0x60,0x08,0x00,0x31,0x09,0xff,0x70,0x08,0x00,0x4f,0x03,0xff,0x80,0x00,0x01,
+0x00,0x0a,0x40,0x06,0xbd,0xff,0xda,0x43,0x00,0xc0,0x4e,0xff,0xff,0xff,0xff,0xb0,
+0x00,0x00,0x5f,0xff,0xfd,0xbd,0x09,0x00,0xf0,0x04,0x2f,0xff,0xb2,0x00,0x01,0x9f,
+0xff,0x50,0x08,0xff,0xd0,0x00,0x00,0x00,0xbf,0xfa,0x00,0x58,0x85,0x2e,0x00,0x01,
+0x0e,0x00,0x10,0x00,0x27,0x00,0x00,0x06,0x00,0x90,0x35,0x56,0x69,0xff,0xf0,0x00,
+0x00,0x6c,0xff,0x01,0x00,0x31,0x00,0x02,0xdf,0x08,0x00,0x60,0xf0,0x00,0xef,0xff,
+0x84,0x10,0x22,0x00,0x81,0x8f,0xfe,0x10,0x00,0x00,0x05,0xff,0xf0,0x95,0x00,0x00,
+0x11,0x00,0x31,0xff,0xf3,0x00,0x11,0x00,0x11,0x0f,0xb6,0x00,0xf0,0x06,0x9f,0xff,
+0x00,0xef,0xfa,0x00,0x00,0x00,0x6f,0xff,0xf0,0x09,0xff,0xfa,0x20,0x03,0xaf,0xff,
+0xff,0x00,0x1e,0x42,0x00,0xf1,0x05,0xfe,0xff,0xf2,0x00,0x2d,0xff,0xff,0xff,0xfa,
+0x2f,0xff,0x50,0x00,0x07,0xcf,0xfe,0xa3,0x00,0x9a,0xa5,0xcc,0x00,0x11,0xa0,0x7c,
+0x00,0x22,0x02,0xff,0xd5,0x00,0x31,0x02,0xef,0xc6,0x59,0x00,0x41,0x01,0xdf,0xd1,
+0x07,0x51,0x00,0x6f,0xcf,0xe2,0x00,0x09,0xff,0x20,0xee,0x00,0xb4,0x00,0xf1,0x00,
+0xc1,0x30,0x00,0x00,0x03,0xcf,0xeb,0x61,0x04,0xff,0x60,0x00,0x03,0x6e,0x00,0x10,
+0xf1,0x9d,0x00,0xcf,0x9d,0xff,0xff,0xf6,0x00,0x00,0x0c,0xd4,0x00,0x02,0x78,0x61,
+0xdc,0x01,0xb4,0x60,0xbf,0xb0,0x00,0x04,0xee,0x50,0x2f,0x00,0x40,0x50,0x00,0xdf,
+0xfe,0x48,0x00,0x30,0xf4,0x00,0x0c,0x90,0x00,0x6f,0x09,0xc8,0x00,0x00,0x3b,0xb3,
+0xcb,0x01,0xac,0x31,0x09,0xef,0xc3,0x7c,0x00,0x50,0x0c,0xfc,0xbf,0xf3,0x00,0x49,
+0x00,0x41,0xfa,0x00,0x3f,0xb0,0xbe,0x03,0x30,0x30,0x00,0xdf,0x08,0x00,0x50,0x07,
+0xf5,0x00,0x0e,0xe0,0x09,0x00,0x41,0x2f,0xd3,0x18,0xf9,0x2b,0x00,0x41,0x7f,0xff,
+0xfd,0x10,0x09,0x00,0x2f,0x38,0x96,0xdc,0x01,0xad,0xf0,0x06,0x49,0xdf,0xfe,0xb6,
+0x00,0x00,0x06,0xbe,0xfe,0xc7,0x10,0x00,0x00,0x01,0xbf,0xff,0xff,0xff,0xfd,0x30,
+0x3d,0x2f,0x00,0xd0,0x50,0x00,0x01,0xef,0xff,0xfe,0xce,0xff,0xfe,0x4e,0xff,0xfd,
+0xce,0x0f,0x00,0xf0,0x02,0xaf,0xff,0x91,0x00,0x04,0xef,0xff,0xff,0xc3,0x00,0x02,
+0xcf,0xfe,0x10,0x0f,0xff,0x90,0x75,0x00,0x01,0xba,0x00,0xb1,0xdf,0xf7,0x01,0xbc,
+0xe2,0x00,0x00,0x00,0x0f,0xff,0xf3,0xce,0x00,0x12,0xc0,0xce,0x00,0x21,0xdf,0xfc,
+0x35,0x01,0x23,0xff,0x00,0xfc,0x04,0x10,0x90,0x0e,0x04,0x75,0xff,0xf1,0x00,0x01,
+0x7b,0xef,0xff,0x01,0x00,0x37,0x20,0x07,0xff,0x01,0x00,0xa1,0xf3,0x07,0xff,0xff,
+0xb8,0x88,0x88,0xef,0xfb,0x88,0x01,0x00,0x40,0x11,0xff,0xfd,0x20,0x3a,0x00,0x01,
+0x2e,0x05,0x00,0xd3,0x00,0x10,0x10,0x57,0x00,0x23,0xfa,0x00,0x45,0x05,0x11,0xb0,
+0x57,0x00,0x12,0xe0,0x0f,0x00,0x21,0x9f,0xfb,0x74,0x00,0x03,0x6a,0x05,0x31,0x07,
+0xff,0xe0,0xa8,0x01,0x20,0xfe,0x20,0x92,0x00,0xf1,0x02,0x00,0x3f,0xff,0xb1,0x00,
+0x03,0xcf,0xff,0xef,0xfe,0x50,0x00,0x00,0x6d,0xf4,0x00,0xbf,0xd3,0x00,0xa0,0x72,
+0xef,0xff,0xfc,0xbd,0xff,0xff,0xa0,0x01,0xcf,0x1e,0x01,0x30,0x50,0x02,0xcf,0x82,
+0x00,0x60,0xb1,0x00,0x00,0x6b,0xef,0xed,0x18,0x02,0x40,0x4a,0xdf,0xfe,0xc8,0x3e,
+0x00,0x22,0x04,0xad,0xcc,0x01,0x13,0x0b,0x1f,0x00,0x40,0x1d,0xff,0xff,0xdc,0xf8,
+0x00,0x30,0x0a,0xff,0xf7,0x62,0x00,0x41,0x90,0x04,0xff,0xf5,0x9c,0x00,0x21,0x20,
+0xbf,0x82,0x00,0x22,0xcf,0xf6,0x88,0x01,0x58,0x08,0xff,0x93,0xff,0xf1,0xd7,0x01,
+0x00,0x2f,0x01,0x13,0xe0,0x11,0x00,0x12,0xfe,0x08,0x00,0x14,0x04,0x11,0x00,0x32,
+0x3f,0xff,0x10,0x09,0x00,0x20,0xff,0xf4,0x06,0x00,0x31,0x37,0x74,0x0b,0x4e,0x05,
+0x60,0x0a,0xff,0x70,0x4f,0xff,0x40,0x5c,0x05,0xf3,0x02,0xf2,0x00,0xbf,0xff,0x60,
+0x00,0x06,0xff,0xf9,0x00,0x01,0xdf,0xff,0xfc,0xce,0xff,0xfc,0xad,0x01,0x01,0x90,
+0x02,0x41,0x49,0xff,0xfd,0x93,0x3e,0x00,0x22,0x0e,0xf8,0x46,0x00,0x32,0x01,0xff,
+0xfc,0x69,0x05,0x43,0x17,0xbf,0xfc,0x00,0x1f,0x01,0x12,0xf0,0x08,0x00,0x15,0x08,
+0x8c,0x00,0x13,0xc0,0x9c,0x00,0x12,0xe3,0x8b,0x00,0x22,0xfd,0x81,0xb6,0x05,0x23,
+0xfb,0x00,0x9b,0x06,0x14,0xf6,0xa4,0x00,0x19,0xf2,0x32,0x00,0x00,0x5c,0x01,0x1f,
+0x70,0xb6,0x06,0x0b,0x50,0x02,0x9d,0xff,0xd9,0x30,0x6c,0x00,0x00,0x32,0x01,0x10,
+0xa0,0xc7,0x00,0x20,0xff,0xcd,0xfe,0x02,0x30,0x07,0xff,0xf7,0x14,0x07,0x21,0x60,
+0x01,0x32,0x01,0x41,0x8f,0xfe,0x00,0x8f,0x6d,0x00,0x51,0xef,0xf4,0x0e,0xff,0x50,
+0xee,0x00,0x12,0x72,0x32,0x01,0x33,0x8f,0xfa,0x4f,0x10,0x02,0x13,0xb5,0x08,0x00,
+0x41,0xfc,0x5f,0xff,0xcc,0x01,0x00,0x3c,0x94,0xff,0xf0,0x32,0x01,0x03,0xa8,0x00,
+0x12,0x0b,0x45,0x03,0x31,0x20,0x00,0x4f,0x69,0x02,0x80,0x4f,0xa0,0x00,0xaf,0xff,
+0xa2,0x00,0x01,0x83,0x07,0x50,0xcf,0xff,0xfd,0xcd,0xff,0xb5,0x00,0x12,0x9f,0xd9,
+0x02,0x41,0x00,0x00,0x28,0xde,0xf0,0x02,0x01,0xb0,0x01,0x22,0xfe,0x10,0xd4,0x03,
+0x12,0xfe,0x33,0x01,0x33,0x2f,0xfe,0x20,0xb0,0x02,0x13,0x30,0x31,0x01,0x1f,0x40,
+0xee,0x00,0xb6,0x13,0x08,0x1e,0x03,0x42,0x06,0xff,0xff,0x30,0xd3,0x01,0x32,0x8a,
+0xfe,0x20,0xbc,0x07,0x30,0x0b,0xfd,0x10,0xbc,0x07,0x4f,0xb0,0x00,0x0d,0xfc,0xee,
+0x00,0xb3,0x50,0x03,0xdf,0x70,0x00,0x08,0x3f,0x04,0x60,0xaf,0xff,0x00,0x01,0xff,
+0xf9,0x30,0x04,0x30,0xf0,0x00,0x1f,0x40,0x00,0x6f,0x1a,0xc5,0x00,0x00,0x6c,0xa1,
+0xdd,0x00,0xa9,0x10,0x09,0x69,0x05,0x01,0x82,0x07,0x10,0x1e,0x1e,0x00,0x10,0x2f,
+0x53,0x00,0x10,0x5f,0x93,0x00,0x27,0x58,0x81,0xce,0x00,0x20,0x4f,0xff,0xbe,0x03,
+0x1f,0xf0,0x09,0x00,0x3f,0xfa,0x06,0x04,0xff,0xf8,0x00,0x0d,0xff,0xa0,0x00,0x8f,
+0xfc,0x00,0x02,0xff,0xd1,0x00,0x0b,0xff,0x20,0x00,0x18,0x83,0x78,0x00,0x0f,0x04,
+0x00,0x39,0x40,0x00,0x01,0xef,0xd0,0x48,0x0a,0x00,0xf0,0x05,0xe3,0xcf,0xe5,0xff,
+0x90,0x00,0xbf,0xf3,0x04,0xff,0x70,0x9f,0xf4,0x00,0x05,0xcf,0x02,0x08,0x01,0x00,
+0x01,0xa9,0x00,0x02,0x37,0x00,0x0f,0x0b,0x00,0x4f,0xf2,0x0a,0x09,0xfc,0x20,0x00,
+0x2d,0xf8,0x02,0xff,0xf8,0x00,0x09,0xff,0xf1,0x1f,0xff,0x80,0x00,0x8f,0xff,0x10,
+0x6c,0xa1,0x00,0x01,0xac,0xe7,0x0b,0x0a,0x13,0x01,0x04,0x39,0x00,0x0f,0x0d,0x00,
+0x62,0x33,0x09,0xa5,0x00,0x76,0x02,0x50,0xfe,0x80,0x00,0x00,0x54,0xf8,0x05,0xd0,
+0xff,0xe5,0x01,0xaf,0xe1,0x00,0x00,0x5a,0xff,0xff,0xfa,0xef,0xfa,0xfd,0x07,0x43,
+0x9f,0xff,0xff,0xf5,0x68,0x07,0x13,0xfb,0xe7,0x08,0x30,0xff,0xf8,0x00,0x69,0x06,
+0x21,0xfd,0x3c,0xda,0x07,0x41,0x0d,0xf9,0x00,0x1e,0x05,0x06,0x10,0x34,0x40,0x00,
+0x03,0x17,0x05,0x00,0x8f,0x07,0x90,0x02,0x8d,0xff,0xd8,0x16,0xff,0xf0,0x00,0x06,
+0xa7,0x02,0xf0,0x08,0x7f,0xff,0x40,0x07,0xff,0xff,0xec,0xdf,0xff,0xff,0xf7,0x03,
+0xff,0xfd,0x40,0x00,0x05,0xef,0xff,0x90,0xcf,0xfd,0x10,0xc7,0x01,0x41,0xfb,0x2f,
+0xff,0x40,0x41,0x06,0x12,0xc7,0xf4,0x02,0x42,0x7f,0xfc,0x9f,0xf9,0x52,0x06,0x32,
+0xcb,0xff,0x80,0x11,0x00,0x22,0xcf,0xf7,0xa9,0x04,0x11,0xbb,0x0d,0x03,0x61,0x00,
+0xbf,0xf8,0x8f,0xfd,0x00,0x5b,0x08,0x31,0x53,0xff,0xf4,0xba,0x04,0x40,0xf0,0x0c,
+0xff,0xe1,0x4c,0x00,0x90,0xf8,0x00,0x2f,0xff,0xd4,0x00,0x03,0xdf,0xfe,0x8c,0x00,
+0xa1,0xfe,0xcd,0xff,0xfe,0x30,0x00,0x00,0x3e,0xff,0xff,0x32,0x08,0x00,0xd0,0x08,
+0x15,0xb6,0x7d,0x01,0xf0,0x08,0x32,0x00,0x00,0x04,0xcf,0xd8,0x10,0x02,0xff,0x30,
+0x00,0x4f,0xff,0xff,0xfa,0x9e,0xff,0x00,0x00,0xcf,0xfa,0xaf,0xff,0xd4,0x03,0x9f,
+0xff,0x40,0x01,0x8e,0xfd,0x60,0x00,0x00,0x44,0xed,0x04,0x03,0xb1,0x8f,0xf8,0x00,
+0x6b,0xef,0xea,0x40,0x00,0x8f,0xf9,0x2d,0x6c,0x07,0xf0,0x04,0x8f,0xfc,0xef,0xff,
+0xef,0xff,0xff,0x50,0x8f,0xff,0xfc,0x40,0x00,0x5f,0xff,0xd0,0x8f,0xff,0xb0,0x45,
+0x05,0x21,0xf2,0x8f,0xd4,0x03,0x32,0xff,0xf5,0x8f,0x84,0x08,0x1f,0xf6,0x08,0x00,
+0x55,0x43,0x00,0x01,0xdf,0xfd,0xab,0x00,0x12,0x1e,0x30,0x01,0x00,0xc2,0x07,0x23,
+0xf4,0x00,0x6a,0x04,0x15,0xfe,0x14,0x03,0x1e,0xa0,0xc3,0x06,0x0d,0xfa,0x04,0x21,
+0xeb,0x60,0x28,0x08,0x01,0x02,0x0a,0x01,0xee,0x08,0x40,0xdc,0xef,0xff,0xf4,0x11,
+0x00,0x10,0x91,0xc3,0x01,0x21,0x10,0x02,0x0c,0x02,0x40,0x2e,0xff,0xa0,0x0a,0xbc,
+0x01,0x00,0xf6,0x00,0x12,0x0f,0xce,0x0e,0x32,0xef,0xf7,0x3f,0xd7,0x0d,0x23,0x9f,
+0xfa,0xe9,0x08,0x43,0x6f,0xfd,0x6f,0xfe,0xe8,0x08,0x03,0x09,0x00,0x42,0x6f,0xfe,
+0x4f,0xff,0x53,0x02,0x11,0xfd,0xad,0x04,0x00,0xaf,0x09,0x05,0x3f,0x00,0x05,0x51,
+0x00,0x31,0x03,0xff,0xf8,0xca,0x00,0x30,0xb0,0x00,0x8f,0x6c,0x0a,0x30,0xdf,0xff,
+0x10,0x87,0x00,0x11,0xcc,0x87,0x00,0x01,0x99,0x00,0x00,0xe4,0x01,0x80,0x00,0x02,
+0x8d,0xef,0xeb,0x60,0x00,0x00,0x10,0x00,0x01,0x00,0x31,0xaf,0xff,0x30,0x08,0x00,
+0x41,0x05,0xff,0xf4,0x00,0x01,0x00,0x42,0x1e,0xff,0x40,0x00,0x1a,0x00,0x23,0xf5,
+0x00,0x1a,0x00,0x2f,0x60,0x00,0x01,0x00,0x0c,0x41,0x02,0x9d,0xff,0xeb,0x25,0x00,
+0xd0,0x9f,0xff,0xff,0xff,0xfd,0x30,0x00,0x00,0x0b,0xff,0xff,0xdc,0xef,0x52,0x00,
+0xf1,0x05,0x9f,0xff,0x91,0x00,0x05,0xef,0xff,0x10,0x02,0xff,0xf8,0x00,0x00,0x00,
+0x2e,0xff,0xa0,0x0a,0xff,0xd0,0x54,0x00,0x22,0xf2,0x0f,0x57,0x00,0x51,0xef,0xf7,
+0x3f,0xff,0x20,0x3b,0x00,0x31,0xfa,0x5f,0xff,0x4d,0x00,0x41,0x6f,0xfd,0x6f,0xfe,
+0x09,0x00,0x23,0x5f,0xfe,0x09,0x00,0x32,0x6f,0xfe,0x4f,0x1b,0x00,0x51,0x7f,0xfd,
+0x2f,0xff,0x10,0x2d,0x00,0x15,0xfb,0x3f,0x00,0x05,0x51,0x00,0x31,0x03,0xff,0xf8,
+0xbf,0x00,0xa0,0xb0,0x00,0x8f,0xff,0x91,0x00,0x04,0xdf,0xff,0x10,0x87,0x00,0x11,
+0xcc,0x87,0x00,0x01,0x99,0x00,0x20,0xfe,0x30,0xab,0x00,0x43,0x8d,0xef,0xeb,0x60,
+0xd8,0x00,0x12,0x80,0xbe,0x00,0x31,0x4f,0xff,0xf6,0x08,0x00,0x32,0x03,0xff,0xb7,
+0xfc,0x00,0xff,0x00,0x2e,0xfc,0x00,0x9f,0xf2,0x00,0x00,0x00,0x01,0xdf,0xd1,0x00,
+0x0a,0xfe,0x10,0xfc,0x00,0xc0,0x00,0xee,0x00,0x00,0x7a,0x00,0x60,0x5c,0xfe,0xb5,
+0x10,0x5f,0xf4,0x43,0x00,0x00,0x01,0x00,0xff,0x03,0xe0,0x00,0x00,0x0d,0xff,0xaa,
+0xdf,0xff,0xfe,0x40,0x00,0x00,0x0d,0xd3,0x00,0x03,0x78,0x61,0xf8,0x01,0xbf,0xff,
+0x13,0x01,0xcf,0x90,0x00,0x05,0xee,0x40,0x00,0x00,0x07,0xff,0xf3,0x00,0x0e,0xff,
+0xc0,0x00,0x00,0x06,0xff,0xf2,0x00,0x0e,0xff,0xb0,0x00,0x00,0x00,0x9c,0x70,0x00,
+0x04,0xcb,0x20,0xe6,0x01,0xb7,0x32,0x04,0xee,0x70,0xbe,0x00,0x34,0x0c,0xff,0xf0,
+0x09,0x00,0x2a,0xf1,0x00,0x1b,0x00,0x0f,0x01,0x00,0x0e,0x22,0xcf,0xff,0x01,0x00,
+0x1e,0xfc,0x09,0x00,0x22,0x35,0x55,0x01,0x00,0x1f,0x54,0x42,0x00,0x0b,0x0f,0x87,
+0x00,0x15,0x23,0x78,0x10,0x15,0x00,0x13,0xfd,0x11,0x00,0x21,0x0b,0xf7,0xcf,0x00,
+0x43,0xff,0xda,0x6f,0xf1,0xe1,0x00,0x24,0xff,0xa0,0x7a,0x01,0x12,0xf3,0x7a,0x01,
+0x41,0x0a,0xff,0xfe,0x10,0x17,0x01,0x23,0x0e,0xfe,0x7a,0x01,0x41,0x7f,0xa5,0xff,
+0xf1,0x3b,0x01,0x40,0xef,0x30,0xef,0xf6,0x7a,0x01,0x23,0x07,0xfb,0x7a,0x01,0x50,
+0x0e,0xf3,0x00,0x7f,0xfc,0x71,0x01,0x70,0x6f,0xb0,0x00,0x6f,0xfd,0x5f,0xfe,0x23,
+0x00,0x02,0x7a,0x01,0x23,0x06,0xfb,0x7a,0x01,0x20,0x0e,0xf4,0x7a,0x01,0x52,0x0e,
+0xff,0x60,0x6f,0xc0,0x7a,0x01,0x30,0xc0,0xdf,0x40,0x7a,0x01,0x42,0x02,0xff,0xfc,
+0xfc,0x7a,0x01,0x30,0x9f,0xff,0xf5,0x7a,0x01,0x13,0x20,0x7a,0x01,0x10,0xf5,0xa2,
+0x01,0x21,0xff,0xff,0x33,0x03,0x32,0x05,0xfd,0x8c,0x7a,0x01,0x33,0x0d,0xf5,0x00,
+0x5a,0x04,0x13,0xd0,0x09,0x00,0x33,0x2e,0xff,0xc0,0x63,0x04,0x14,0xf7,0x74,0x04,
+0x13,0x20,0x85,0x04,0x22,0xc0,0x00,0x02,0x02,0x1f,0xf7,0x42,0x01,0x08,0x21,0x9f,
+0xfa,0x0a,0x02,0x1f,0xf6,0x08,0x00,0x55,0x20,0x7f,0xfd,0x2a,0x03,0x30,0xff,0xf6,
+0x4f,0x1d,0x06,0xf0,0x06,0x0a,0xff,0xf6,0x0e,0xff,0xd3,0x00,0x04,0xcf,0xff,0xf6,
+0x07,0xff,0xff,0xee,0xff,0xff,0xff,0xf6,0x00,0xaf,0x06,0x00,0xa2,0xcf,0xf6,0x00,
+0x04,0xbe,0xfe,0xc8,0x20,0xbf,0xf6,0xd4,0x01,0x12,0xe2,0xc2,0x02,0x21,0xfe,0x20,
+0x31,0x03,0x23,0xff,0xf3,0xeb,0x01,0x12,0x30,0x17,0x00,0x1f,0xf4,0xe0,0x00,0xab,
+0x12,0x7f,0x24,0x06,0x22,0x06,0xff,0x23,0x06,0x41,0x4f,0xf9,0x9f,0xf2,0xd0,0x01,
+0x41,0xa0,0x0b,0xfe,0x10,0x32,0x06,0x3f,0x00,0xcf,0xc0,0xe0,0x00,0xa7,0x60,0x2d,
+0xf7,0x00,0x00,0x7f,0xd2,0x53,0x03,0x40,0x10,0x01,0xff,0xfa,0x08,0x00,0xcf,0x00,
+0x00,0xff,0xf9,0x00,0x00,0x1a,0xc5,0x00,0x00,0x5c,0xa1,0x90,0x02,0xa2,0x42,0x00,
+0xcf,0xfe,0x20,0x5a,0x03,0x23,0xff,0x30,0xd9,0x08,0x11,0x50,0x08,0x00,0x33,0x0a,
+0xff,0x70,0x8c,0x03,0x12,0x90,0xce,0x00,0x1f,0x58,0x0b,0x05,0x02,0x11,0x7f,0x88,
+0x05,0x51,0x0f,0xff,0x61,0xff,0xf6,0xa8,0x03,0x21,0xf1,0x0c,0x24,0x06,0x40,0xaf,
+0xfc,0x00,0x6f,0x1a,0x00,0x60,0x0e,0xff,0x60,0x01,0xff,0xf6,0x46,0x00,0x30,0xf1,
+0x00,0x0b,0x1a,0x00,0x20,0x8f,0xfc,0x6b,0x00,0x00,0x42,0x07,0x90,0x60,0x00,0x01,
+0xff,0xf5,0x00,0x02,0xff,0xf1,0xac,0x04,0x40,0xa0,0x00,0x7f,0xfc,0xea,0x05,0x31,
+0xff,0x00,0x0b,0x78,0x00,0x51,0xff,0xf5,0x01,0xff,0xf1,0x86,0x00,0x41,0xa0,0x5f,
+0xfc,0x00,0x1a,0x00,0x03,0x91,0x00,0x42,0xff,0xf4,0xef,0xf1,0xa0,0x00,0x23,0xdf,
+0xfc,0x24,0x04,0x03,0xaa,0x00,0x13,0xef,0x2f,0x05,0x34,0x09,0xff,0xfc,0x3e,0x04,
+0x03,0xb3,0x00,0x22,0xef,0xf2,0x08,0x00,0x13,0x1f,0x19,0x00,0x14,0x07,0x19,0x00,
+0x13,0xdf,0x19,0x00,0x12,0x5f,0x19,0x00,0x22,0x01,0x6f,0xb7,0x02,0x21,0x8f,0xff,
+0xc5,0x00,0x51,0x00,0x08,0xff,0xff,0xd1,0x19,0x00,0x22,0x6e,0xfd,0x05,0x09,0x33,
+0x38,0x87,0x00,0xe0,0x02,0x23,0xe0,0x00,0x92,0x06,0x0f,0x11,0x00,0x21,0x80,0x7c,
+0xef,0xda,0x30,0x00,0x06,0xff,0xe3,0x13,0x05,0xe0,0x80,0x00,0x6f,0xff,0xff,0xff,
+0xef,0xff,0xff,0x80,0x06,0xff,0xff,0xb3,0x3a,0x03,0x40,0x30,0x6f,0xff,0x90,0x32,
+0x01,0x12,0xfb,0x33,0x00,0x32,0x07,0xff,0xf1,0x44,0x00,0x32,0x1f,0xff,0x56,0x44,
+0x00,0x42,0xcf,0xf8,0x6f,0xfe,0x03,0x01,0x32,0x96,0xff,0xe0,0x69,0x02,0x22,0x6f,
+0xfe,0xfa,0x00,0x12,0xa6,0x11,0x00,0x22,0xaf,0xf9,0x11,0x00,0x30,0x0d,0xff,0x86,
+0x11,0x00,0x00,0x6a,0x01,0x22,0x6f,0xfe,0xaf,0x01,0x13,0x16,0x81,0x07,0xb1,0xb0,
+0x6f,0xff,0xf9,0x10,0x00,0x4e,0xff,0xf3,0x06,0xff,0x2a,0x06,0x90,0xf8,0x00,0x6f,
+0xfe,0x5f,0xff,0xff,0xff,0xf8,0xaa,0x00,0x4f,0x18,0xce,0xfe,0xa3,0xdd,0x00,0x25,
+0x0a,0x11,0x00,0x80,0x00,0x03,0xdf,0x70,0x00,0x08,0xfd,0x20,0x43,0x0b,0x40,0x00,
+0x01,0xff,0xf9,0xa5,0x00,0x52,0xf0,0x00,0x1f,0xff,0x80,0x36,0x03,0x2f,0x6c,0xa1,
+0x53,0x02,0xed,0x00,0x80,0x00,0x10,0xff,0x2e,0x09,0x0e,0x0c,0x00,0x10,0x99,0x01,
+0x00,0x2f,0x97,0x00,0x01,0x00,0x18,0x26,0xef,0xf6,0x4f,0x08,0x04,0xb3,0x00,0x01,
+0xd9,0x00,0x03,0x48,0x07,0x01,0x46,0x02,0x15,0xff,0x79,0x00,0x45,0x6f,0xfb,0xff,
+0xe0,0xc1,0x08,0x34,0xf4,0xcf,0xf4,0xc6,0x09,0x31,0xff,0xe0,0x6f,0x53,0x04,0x01,
+0xb0,0x00,0x22,0x80,0x1f,0x6b,0x09,0x00,0x7a,0x01,0x24,0x20,0x0a,0xe6,0x0c,0x44,
+0x4f,0xfc,0x00,0x04,0x95,0x07,0x25,0xaf,0xf7,0x10,0x01,0x01,0x63,0x01,0x22,0x9f,
+0xf8,0x04,0x02,0x00,0xf2,0x00,0x23,0x3f,0xfe,0xe0,0x06,0x10,0x50,0xa1,0x01,0x01,
+0x0b,0x01,0x21,0x2f,0xff,0x30,0x01,0x11,0xa0,0x17,0x01,0x13,0xfa,0x35,0x00,0x00,
+0xbd,0x00,0x51,0xfe,0xee,0xee,0xee,0xee,0xf5,0x01,0x14,0x04,0x3c,0x09,0x02,0xbd,
+0x00,0x02,0x01,0x00,0x10,0x30,0xbd,0x00,0x11,0x30,0xf2,0x08,0x20,0xff,0x90,0x8a,
+0x08,0x02,0x1b,0x08,0x00,0xc3,0x00,0x23,0xdf,0xf8,0x3e,0x01,0x00,0xfe,0x01,0x13,
+0xf2,0x96,0x00,0x31,0xfb,0x00,0x09,0x13,0x0a,0x01,0xeb,0x01,0x24,0x10,0x0e,0xa1,
+0x01,0x44,0x0f,0xff,0x70,0x5f,0x0f,0x01,0x00,0x0b,0x09,0x11,0x09,0x5d,0x00,0x01,
+0x29,0x09,0x02,0x66,0x00,0x11,0x05,0x78,0x01,0x1f,0x91,0x68,0x01,0x09,0x40,0x06,
+0xbd,0xff,0xda,0xcc,0x00,0x10,0x4e,0x32,0x00,0x10,0xb0,0x60,0x00,0x20,0xfd,0xbd,
+0x09,0x00,0x91,0x2f,0xff,0xb2,0x00,0x01,0x9f,0xff,0x50,0x08,0x79,0x00,0x51,0xbf,
+0xfa,0x00,0x58,0x85,0x09,0x01,0x05,0x87,0x00,0x00,0x06,0x00,0x30,0x35,0x56,0x69,
+0xe2,0x09,0x11,0x6c,0x6f,0x00,0x31,0x00,0x02,0xdf,0x08,0x00,0x60,0xf0,0x00,0xef,
+0xff,0x84,0x10,0x22,0x00,0x30,0x8f,0xfe,0x10,0xd6,0x00,0x10,0xf0,0xcf,0x02,0x01,
+0x33,0x00,0x00,0x23,0x08,0x00,0x11,0x00,0x10,0x0f,0x3f,0x01,0x00,0x74,0x06,0x21,
+0xef,0xfa,0xb0,0x05,0xc0,0xf0,0x09,0xff,0xfa,0x20,0x03,0xaf,0xff,0xff,0x00,0x1e,
+0xff,0x5c,0x09,0xf0,0x04,0xff,0xf2,0x00,0x2d,0xff,0xff,0xff,0xfa,0x2f,0xff,0x50,
+0x00,0x07,0xcf,0xfe,0xa3,0x00,0x9a,0xa5,0xa1,0x00,0x00,0x00,0x6f,0xf4,0x00,0x00,
+0x9f,0xf0,0x00,0x01,0x00,0x62,0x3f,0xf8,0x00,0x00,0xdf,0xe0,0x0c,0x00,0x62,0x0d,
+0xff,0x50,0x19,0xff,0x80,0x0c,0x00,0x63,0x03,0xff,0xff,0xff,0xfc,0x00,0x01,0x00,
+0x54,0x2b,0xff,0xfe,0x80,0x00,0x01,0x00,0x3f,0x02,0x10,0x00,0x01,0x00,0x02,0x25,
+0xef,0xf6,0x0b,0x00,0x16,0x04,0x3b,0x00,0x54,0x00,0x0a,0xff,0xff,0x20,0x0c,0x00,
+0x35,0x1f,0xff,0xff,0x48,0x00,0x44,0x6f,0xfb,0xff,0xe0,0x0c,0x00,0x44,0xcf,0xf4,
+0xcf,0xf4,0x5e,0x00,0x43,0xff,0xe0,0x6f,0xfa,0x0c,0x00,0x53,0x08,0xff,0x80,0x1f,
+0xff,0x6e,0x00,0x62,0x0e,0xff,0x20,0x0a,0xff,0x60,0x0c,0x00,0x62,0x4f,0xfc,0x00,
+0x04,0xff,0xc0,0x0c,0x00,0x61,0xaf,0xf7,0x00,0x00,0xef,0xf2,0x0b,0x00,0x71,0x01,
+0xff,0xf1,0x00,0x00,0x9f,0xf8,0x0c,0x00,0x71,0x06,0xff,0xb0,0x00,0x00,0x3f,0xfe,
+0x0c,0x00,0x30,0x0c,0xff,0x50,0xdc,0x00,0x10,0x40,0x0c,0x00,0x80,0x2f,0xff,0x00,
+0x00,0x00,0x07,0xff,0xa0,0x0c,0x00,0x23,0x8f,0xfa,0x35,0x00,0x00,0xbd,0x00,0x71,
+0xfe,0xee,0xee,0xee,0xee,0xff,0xf6,0xbd,0x00,0x02,0x01,0x00,0x12,0xfc,0xbd,0x00,
+0x02,0x01,0x00,0x10,0x30,0xbd,0x00,0x10,0x30,0x2a,0x00,0x71,0x0b,0xff,0x90,0x00,
+0x00,0x7f,0xfd,0x5a,0x00,0x10,0x05,0xc3,0x00,0x22,0xdf,0xf8,0x8a,0x00,0x63,0xff,
+0xf5,0x00,0x02,0xff,0xf2,0x96,0x00,0x52,0xfb,0x00,0x09,0xff,0xd0,0x0c,0x00,0x62,
+0x5f,0xff,0x10,0x0e,0xff,0x70,0x0c,0x00,0x44,0x0f,0xff,0x70,0x5f,0x0f,0x01,0x10,
+0x0a,0x21,0x00,0x60,0xff,0xb0,0x00,0x04,0xff,0x60,0x56,0x00,0x30,0x71,0x03,0xdf,
+0x3d,0x00,0x41,0x2e,0xff,0xff,0xff,0x51,0x00,0x42,0x1a,0xff,0xff,0xc5,0x29,0x00,
+0x2f,0x12,0x00,0x01,0x00,0x03,0x40,0x5a,0xdf,0xfd,0xa4,0xaa,0x01,0x51,0xdf,0xff,
+0xff,0xff,0xfb,0xb2,0x01,0x20,0xeb,0xdf,0x09,0x00,0xb0,0xef,0xfd,0x40,0x00,0x19,
+0xff,0xf5,0x00,0x6f,0xfe,0x10,0x59,0x00,0x40,0xa0,0x0a,0xff,0x90,0x70,0x01,0x23,
+0xfd,0x00,0xb4,0x00,0x10,0xf0,0x35,0x00,0x80,0x55,0x66,0x9f,0xff,0x00,0x00,0x06,
+0xcf,0xdd,0x00,0x32,0xf0,0x00,0x2d,0xe6,0x00,0x50,0x00,0x0e,0xff,0xf8,0x41,0x22,
+0x00,0x31,0x08,0xff,0xe1,0xba,0x00,0x32,0x00,0xdf,0xf6,0x33,0x00,0x32,0x0f,0xff,
+0x30,0x11,0x00,0x10,0xff,0xa9,0x01,0x60,0x09,0xff,0xf0,0x0e,0xff,0xa0,0x66,0x01,
+0xc0,0xff,0x00,0x9f,0xff,0xa2,0x00,0x3a,0xff,0xff,0xf0,0x01,0xef,0x42,0x00,0x40,
+0xef,0xff,0x20,0x02,0x90,0x00,0xcf,0xa2,0xff,0xf5,0x00,0x00,0x7c,0xff,0xea,0x30,
+0x09,0xaa,0x50,0x1e,0x02,0xff,0x28,0x04,0x0d,0x01,0x15,0xfa,0x0b,0x00,0x12,0x05,
+0x9d,0x00,0x02,0x2f,0x00,0x16,0xfd,0x0c,0x02,0x26,0x5f,0xf7,0x0c,0x00,0x27,0x7f,
+0xf6,0x18,0x00,0x23,0xfe,0x9a,0x5d,0x00,0x00,0x25,0x01,0x25,0xff,0x90,0xc5,0x03,
+0x90,0xbe,0xeb,0x30,0x00,0x00,0x05,0xad,0xff,0xda,0xf9,0x00,0x40,0x3d,0xff,0xff,
+0xff,0x13,0x01,0x40,0x4f,0xff,0xfd,0xbc,0x09,0x00,0x91,0x1f,0xff,0xc3,0x00,0x00,
+0x9f,0xff,0x50,0x07,0x85,0x01,0x51,0xcf,0xfa,0x00,0x8c,0xc7,0x36,0x01,0x05,0xb4,
+0x00,0x07,0x4b,0x02,0x21,0x17,0xbd,0x3a,0x02,0x32,0x00,0x8f,0xff,0x4b,0x02,0x40,
+0xbf,0xff,0xe9,0x76,0x5c,0x02,0x31,0x6f,0xff,0x60,0x22,0x00,0x33,0x0c,0xff,0x70,
+0x3a,0x02,0x18,0xf3,0x4b,0x02,0x51,0x8f,0xff,0x00,0xff,0xf9,0x19,0x00,0x91,0xf0,
+0x0a,0xff,0xf9,0x20,0x03,0xaf,0xff,0xff,0xfc,0x02,0xf2,0x06,0xff,0xfe,0xff,0xf2,
+0x00,0x3e,0xff,0xff,0xff,0xfa,0x2f,0xff,0x50,0x00,0x17,0xcf,0xfe,0xa3,0x00,0xff,
+0xf6,0xc1,0x01,0x23,0xdf,0xe2,0x10,0x02,0x1a,0xf2,0xf4,0x00,0x14,0x0a,0x06,0x02,
+0x11,0xcf,0xad,0x01,0x00,0x9f,0x02,0x22,0xc9,0xc3,0xdd,0x04,0x22,0xff,0xff,0x7e,
+0x02,0x32,0x4c,0xfe,0x91,0x7b,0x02,0x23,0x88,0x82,0x01,0x01,0x15,0x2f,0x0c,0x01,
+0x25,0xbf,0xfb,0x5c,0x01,0x14,0xd1,0x2a,0x01,0x14,0xfe,0x95,0x02,0x3f,0x8f,0xf3,
+0x00,0x01,0x00,0x11,0x64,0x49,0xdf,0xfe,0xc9,0x30,0x00,0x4a,0x01,0x20,0xfb,0x10,
+0x1b,0x03,0x00,0x0d,0x03,0x20,0xff,0xe2,0xe2,0x00,0x91,0xf7,0x20,0x00,0x28,0xff,
+0xfe,0x10,0x01,0xff,0x57,0x00,0x62,0x4f,0xff,0x90,0x09,0xff,0xf2,0xc2,0x02,0x42,
+0xf1,0x0f,0xff,0x80,0x9d,0x02,0x14,0xf6,0xfa,0x01,0x33,0xcf,0xf9,0x9f,0xd8,0x01,
+0x35,0x58,0x86,0xcf,0xf9,0x01,0x25,0xdf,0xf8,0x67,0x05,0x06,0x0a,0x00,0x1f,0xf7,
+0x0a,0x00,0x09,0x06,0x32,0x00,0x06,0x46,0x00,0x04,0x5a,0x00,0x53,0x47,0x75,0x5f,
+0xff,0x10,0x6e,0x00,0x15,0x1f,0x82,0x00,0x33,0x09,0xff,0xf1,0x96,0x00,0x41,0x01,
+0xff,0xfd,0x10,0x3f,0x01,0x61,0x90,0x00,0x5f,0xff,0xe6,0x00,0xbe,0x00,0x00,0xd2,
+0x00,0x21,0xfe,0xdf,0xd2,0x00,0x24,0x00,0x4d,0xe6,0x00,0x00,0x85,0x04,0x23,0xfe,
+0xc8,0x2d,0x01,0x14,0x06,0xa9,0x01,0x23,0xff,0xf7,0x5a,0x01,0x13,0xf8,0xc0,0x02,
+0x13,0xf9,0x74,0x01,0x1f,0xfa,0x47,0x01,0x0c,0x13,0x04,0x90,0x02,0x10,0x0b,0x60,
+0x00,0xc0,0xb1,0x00,0x00,0x1d,0xff,0xff,0xdc,0xff,0xff,0xd0,0x00,0x0a,0x52,0x00,
+0x60,0x7f,0xff,0x90,0x04,0xff,0xf5,0x4f,0x00,0x22,0xff,0x20,0xb4,0x01,0x51,0xcf,
+0xf6,0x0f,0xff,0x40,0xb2,0x00,0x3c,0x93,0xff,0xf1,0x9b,0x02,0x14,0xe0,0x01,0x03,
+0x04,0x75,0x04,0x13,0xe0,0xf1,0x06,0x04,0x2e,0x02,0x11,0xff,0x55,0x04,0x51,0x37,
+0x74,0x0b,0xff,0xa0,0x45,0x02,0x40,0x70,0x4f,0xff,0x40,0x46,0x05,0xf0,0x00,0xf2,
+0x00,0xbf,0xff,0x60,0x00,0x06,0xff,0xf9,0x00,0x01,0xdf,0xff,0xfc,0xce,0xea,0x03,
+0x62,0x01,0xbf,0xff,0xff,0xff,0xf9,0xe9,0x01,0x22,0xfd,0x93,0x3f,0x00,0x43,0x28,
+0x71,0x00,0x00,0x98,0x02,0x04,0xcf,0x04,0x43,0x0c,0xfe,0xef,0xa0,0xfa,0x00,0x33,
+0xe2,0x3f,0xf8,0x9c,0x02,0x22,0x30,0x05,0x99,0x04,0x6f,0x28,0x84,0x00,0x00,0x58,
+0x70,0x4c,0x02,0xff,0x15,0x13,0x2e,0x94,0x03,0x22,0x1e,0xff,0x70,0x00,0x42,0x1d,
+0xfd,0x5f,0xf8,0x62,0x01,0x32,0x20,0x5f,0xf5,0x57,0x01,0x3f,0x00,0x7f,0xf4,0x4c,
+0x02,0xb6,0x25,0x5e,0xe4,0x74,0x01,0x15,0xfc,0x74,0x01,0x05,0x0a,0x00,0x2f,0x4c,
+0xb2,0x84,0x04,0xff,0x17,0x13,0x1c,0x6a,0x04,0x33,0x07,0xff,0xf3,0x0c,0x07,0x04,
+0x50,0x07,0x2f,0xac,0x70,0x27,0x02,0xad,0x62,0x28,0x83,0x00,0x00,0x58,0x82,0xe0,
+0x06,0x23,0x20,0x04,0xbf,0x06,0x43,0xbf,0xe1,0x3f,0xfa,0x7d,0x04,0x3c,0xfd,0xef,
+0xb0,0x91,0x04,0x06,0xa5,0x04,0x0f,0x3b,0x02,0xff,0x0e,0x61,0x0a,0xff,0x20,0x00,
+0x7f,0xf7,0x62,0x04,0x31,0x10,0x5f,0xf9,0x7b,0x04,0x33,0xfc,0x3f,0xfb,0x2a,0x08,
+0x13,0xfc,0x59,0x0a,0x13,0xfd,0xc7,0x01,0x2f,0x23,0x10,0x4c,0x02,0x29,0x1c,0x5f,
+0x4c,0x02,0x1f,0x07,0x4c,0x02,0x5e,0x62,0x04,0x88,0x10,0x00,0x07,0x87,0x68,0x01,
+0x42,0xd0,0x00,0x8f,0xf6,0x6c,0x05,0x23,0xfb,0x06,0x89,0x0a,0x24,0x02,0xef,0xba,
+0x07,0x01,0x44,0x01,0x03,0x82,0x00,0x1f,0x86,0x3f,0x02,0x06,0x10,0x0f,0xb7,0x09,
+0x01,0x41,0x02,0x12,0x0f,0x1c,0x0b,0x10,0x30,0x0a,0x00,0x40,0xee,0xee,0xef,0xff,
+0xf9,0x00,0x10,0x0f,0x84,0x09,0x42,0x27,0xef,0xff,0x80,0x0a,0x00,0x43,0x00,0x1c,
+0xff,0xf4,0x0a,0x00,0x34,0x00,0xcf,0xfd,0x0a,0x00,0x33,0x2f,0xff,0x50,0x0a,0x00,
+0x33,0x0a,0xff,0xc0,0x0a,0x00,0x01,0x2c,0x0a,0x12,0x50,0xde,0x01,0x23,0xf3,0x0f,
+0xca,0x09,0x24,0xff,0xf6,0x0a,0x00,0x24,0xef,0xf7,0x0a,0x00,0x1e,0xdf,0x0a,0x00,
+0x07,0x1e,0x00,0x05,0x32,0x00,0x35,0x02,0xff,0xf4,0x5a,0x00,0x13,0xf1,0x0a,0x00,
+0x15,0x0b,0x6e,0x00,0x33,0x3f,0xff,0x60,0x0a,0x00,0x25,0xdf,0xfe,0xaa,0x00,0x12,
+0xf5,0x0a,0x00,0x21,0x38,0xff,0xbe,0x00,0x31,0xed,0xdd,0xef,0x9d,0x0d,0x08,0xe6,
+0x00,0x80,0xff,0xff,0xfe,0xc8,0x30,0x00,0x00,0x00,0x11,0x00,0x01,0x00,0x62,0x07,
+0xee,0xa0,0x0c,0xee,0x30,0x0c,0x00,0x52,0x8f,0xfb,0x00,0xdf,0xf3,0x0b,0x00,0x64,
+0x08,0xff,0xb0,0x0e,0xff,0x20,0x17,0x00,0x35,0x01,0xff,0xf0,0x17,0x00,0x34,0x6f,
+0xfa,0x00,0x17,0x00,0x35,0x0d,0xff,0x20,0x17,0x00,0x35,0x8f,0x70,0x00,0x45,0x00,
+0x10,0x20,0x58,0x00,0x60,0xce,0xfd,0x93,0x08,0xff,0xb0,0x12,0x00,0x70,0x2d,0xff,
+0xff,0xff,0xf8,0x8f,0xfb,0x0b,0x00,0x61,0x2e,0xff,0xff,0xee,0xff,0xfe,0x17,0x00,
+0x70,0x0c,0xff,0xf9,0x10,0x01,0x8f,0xff,0x17,0x00,0x71,0x04,0xff,0xf7,0x00,0x00,
+0x00,0x5f,0x17,0x00,0x30,0xaf,0xfc,0x00,0x06,0x00,0x00,0x17,0x00,0x32,0x0f,0xff,
+0x60,0x5c,0x00,0x53,0x00,0x00,0x02,0xff,0xf2,0x5c,0x00,0x43,0x00,0x00,0x3f,0xff,
+0x73,0x00,0x00,0x39,0x00,0x15,0xf0,0x17,0x00,0x16,0x4f,0x17,0x00,0x17,0x03,0x17,
+0x00,0x11,0x2f,0xa4,0x00,0x02,0x8a,0x00,0x25,0xef,0xf6,0x17,0x00,0x31,0x0a,0xff,
+0xc0,0x06,0x00,0x10,0xb0,0x3a,0x00,0x00,0x68,0x00,0x21,0x05,0xff,0xa1,0x00,0x61,
+0xbf,0xff,0x81,0x00,0x18,0xff,0x17,0x00,0x71,0x01,0xef,0xff,0xfe,0xef,0xff,0xef,
+0x17,0x00,0x62,0x02,0xdf,0xff,0xff,0xff,0x96,0xcf,0x00,0x72,0x00,0x7c,0xef,0xda,
+0x30,0x4f,0xfb,0x6e,0x00,0x52,0xff,0xff,0xff,0xdb,0x61,0xf8,0x00,0x20,0xff,0xff,
+0xe8,0x00,0x02,0x17,0x00,0x70,0xfe,0xee,0xef,0xff,0xff,0xfd,0x20,0x17,0x00,0x80,
+0xfe,0x00,0x00,0x00,0x5b,0xff,0xfe,0x10,0x17,0x00,0x20,0xe0,0x00,0x69,0x00,0x13,
+0xfc,0x17,0x00,0x00,0xc0,0x00,0x14,0xf6,0x17,0x00,0x43,0x00,0x09,0xff,0xe0,0x17,
+0x00,0x00,0xb5,0x00,0x14,0x40,0x17,0x00,0x35,0x00,0xcf,0xf9,0x17,0x00,0x35,0x09,
+0xff,0xc0,0x17,0x00,0xf0,0x00,0x6f,0xfe,0x0a,0xcc,0xef,0xff,0xcc,0xcc,0x30,0x00,
+0x00,0x06,0xff,0xf0,0xef,0x7c,0x00,0x11,0xf4,0x45,0x01,0x11,0x0e,0x88,0x00,0x10,
+0x40,0x69,0x00,0x16,0xf0,0x2e,0x00,0x15,0xff,0x45,0x00,0x35,0x07,0xff,0xe0,0x17,
+0x00,0x25,0x9f,0xfc,0x17,0x00,0x34,0x0d,0xff,0x90,0x17,0x00,0x35,0x03,0xff,0xf4,
+0x17,0x00,0x25,0xaf,0xfe,0xa1,0x00,0x34,0x5f,0xff,0x70,0x17,0x00,0x33,0x6f,0xff,
+0xd0,0x17,0x00,0x41,0x15,0xcf,0xff,0xe2,0xfd,0x00,0x64,0xdd,0xdd,0xef,0xff,0xff,
+0xd2,0x14,0x01,0x34,0xff,0xff,0x90,0x14,0x01,0x33,0xfd,0xa6,0x10,0x1a,0x02,0x01,
+0x6d,0x02,0x16,0x00,0x27,0x02,0x01,0x01,0x00,0x61,0x2b,0xbb,0xbe,0xff,0xeb,0xbb,
+0x64,0x01,0x01,0x38,0x00,0x12,0xf0,0x00,0x01,0x00,0x01,0x00,0x0b,0x2a,0x00,0x04,
+0xc6,0x01,0x07,0x15,0x00,0x06,0x65,0x02,0x06,0x64,0x02,0x06,0x63,0x02,0x06,0x62,
+0x02,0x07,0x61,0x02,0x06,0x60,0x02,0x06,0x5f,0x02,0x07,0x5e,0x02,0x06,0x5d,0x02,
+0x07,0x5c,0x02,0x06,0x5b,0x02,0x07,0x5a,0x02,0x07,0x59,0x02,0x06,0x58,0x02,0x07,
+0x57,0x02,0x07,0x56,0x02,0x06,0x55,0x02,0x07,0x54,0x02,0x08,0x53,0x02,0x05,0x52,
+0x02,0x11,0x0f,0xf9,0x00,0x17,0xe0,0x09,0x00,0x20,0x08,0x99,0x01,0x00,0x2f,0x80,
+0x00,0x01,0x00,0x08,0x22,0x0f,0xff,0x01,0x00,0x17,0xf1,0x09,0x00,0x11,0xee,0x01,
+0x00,0x44,0xe0,0x0f,0xff,0x50,0x24,0x00,0x0f,0x09,0x00,0x2c,0x01,0x01,0x00,0x18,
+0xf7,0x09,0x00,0x6f,0xed,0xdd,0xdd,0xdd,0xdd,0xd5,0x5a,0x00,0x2f,0x0e,0x09,0x00,
+0x01,0x5a,0x00,0x24,0xdd,0xd3,0xcf,0x00,0x15,0xf3,0x09,0x00,0x24,0x00,0x0e,0x17,
+0x01,0x01,0xf1,0x02,0x1f,0xfe,0x1f,0x01,0x12,0x54,0x02,0x9d,0xff,0xd9,0x30,0x99,
+0x02,0x10,0xa0,0x9e,0x01,0x20,0xff,0xcd,0x8d,0x01,0x30,0x07,0xff,0xf7,0xa2,0x02,
+0x42,0x60,0x01,0xff,0xf5,0x91,0x03,0x02,0x54,0x02,0x51,0xef,0xf4,0x0e,0xff,0x50,
+0xc5,0x01,0x31,0x72,0xff,0xf1,0xd8,0x01,0x23,0xfa,0x4f,0x80,0x00,0x13,0xb5,0x08,
+0x00,0x41,0xfc,0x5f,0xff,0xcc,0x01,0x00,0x14,0x94,0x18,0x05,0x23,0x3f,0xff,0xe5,
+0x02,0x22,0xff,0xf6,0x08,0x00,0x30,0x0b,0xff,0xd0,0x07,0x00,0x31,0x20,0x00,0x4f,
+0x0a,0x03,0xf0,0x02,0x4f,0xa0,0x00,0xaf,0xff,0xa2,0x00,0x01,0x8f,0xff,0x40,0x00,
+0xcf,0xff,0xfd,0xcd,0xff,0x4c,0x03,0x10,0x9f,0x4c,0x00,0x00,0x6b,0x00,0x50,0x28,
+0xde,0xfe,0xc7,0x10,0x2d,0x02,0x50,0x50,0x00,0x08,0xff,0x10,0x0a,0x03,0x41,0x90,
+0x00,0x0d,0xfe,0xfd,0x03,0x31,0xf8,0x34,0xbf,0x53,0x04,0x32,0x1e,0xff,0xff,0x2b,
+0x02,0x4f,0x01,0x8d,0xff,0xc6,0x06,0x02,0xed,0x50,0x04,0xff,0x60,0x00,0x08,0x7f,
+0x03,0x41,0x0f,0xfe,0x40,0x15,0x9d,0x04,0x13,0x6f,0xff,0x04,0x52,0x00,0x4b,0xff,
+0xff,0xb3,0x41,0x00,0x1f,0x22,0x0f,0x02,0x04,0x44,0x29,0xdf,0xfd,0x93,0x9c,0x04,
+0x10,0xfa,0x0b,0x04,0x30,0xff,0xfc,0xdf,0xa6,0x03,0xb1,0x7f,0xff,0x70,0x00,0x08,
+0xff,0xf6,0x00,0x1f,0xff,0x50,0xdc,0x04,0x02,0x58,0x04,0x51,0x0e,0xff,0x40,0xef,
+0xf5,0x32,0x04,0x41,0xf7,0x2f,0xff,0x10,0x46,0x02,0x13,0xa4,0x88,0x00,0x23,0xfb,
+0x5f,0x09,0x00,0x31,0xc5,0xff,0xfc,0x0e,0x02,0x23,0xc9,0x4f,0xb3,0x04,0x12,0x03,
+0x39,0x02,0x04,0x63,0x04,0x00,0x02,0x04,0x11,0xfd,0x8a,0x02,0x40,0x00,0x04,0xff,
+0xf9,0xf7,0x05,0xf0,0x01,0xfa,0x00,0x0a,0xff,0xfa,0x20,0x00,0x18,0xff,0xf4,0x00,
+0x0c,0xff,0xff,0xdc,0xdf,0x8a,0x02,0x10,0x09,0x4b,0x00,0x10,0xf5,0x26,0x00,0x51,
+0x8d,0xef,0xec,0x71,0x00,0x1f,0x06,0x13,0xcb,0x60,0x07,0x14,0x0e,0xf9,0x04,0x14,
+0x0f,0x09,0x00,0x14,0x06,0xb4,0x07,0x0f,0x15,0x04,0xef,0x00,0x54,0x07,0x22,0xee,
+0x40,0x27,0x00,0x2b,0xef,0xfc,0x31,0x01,0x2f,0x4c,0xb2,0x15,0x04,0xab,0x0f,0xc7,
+0x01,0xda,0x00,0x29,0x03,0x14,0xf5,0x2b,0x01,0x03,0xd2,0x01,0x33,0x6f,0xf7,0x00,
+0x1a,0x00,0x13,0xf0,0x09,0x00,0x24,0xdf,0xf0,0x12,0x00,0x42,0xfc,0x9c,0x20,0x00,
+0x9a,0x08,0x12,0xff,0x0e,0x03,0x42,0x05,0xdf,0xd9,0x10,0xdc,0x01,0x01,0x83,0x0a,
+0x00,0x58,0x00,0x11,0x80,0x5a,0x03,0x10,0xdd,0x09,0x00,0x10,0x06,0x10,0x08,0x41,
+0xaf,0xff,0x30,0x01,0x85,0x03,0x22,0xbf,0xfb,0xcd,0x08,0x61,0x02,0xff,0xf1,0x0e,
+0xff,0x80,0x02,0x09,0x12,0x52,0x44,0x04,0x33,0x9f,0xf8,0x4f,0xeb,0x03,0x1c,0xa5,
+0xeb,0x03,0x14,0xc4,0xeb,0x03,0x14,0x3f,0x9e,0x08,0x24,0xff,0xf2,0xb1,0x00,0x12,
+0x90,0x09,0x00,0x11,0x4f,0xec,0x00,0x21,0x1b,0x30,0xf6,0x07,0xc0,0x00,0x6e,0xff,
+0x30,0x01,0xdf,0xff,0xfc,0xbc,0xff,0xff,0xe1,0x6b,0x04,0xc3,0xff,0xff,0xff,0xe3,
+0x00,0x00,0x00,0x39,0xdf,0xff,0xff,0xb1,0x2e,0x00,0x13,0x80,0x7f,0x09,0x22,0x70,
+0x00,0x12,0x0a,0x13,0xc0,0xe1,0x08,0x14,0xf5,0xf4,0x08,0x03,0x3b,0x01,0x42,0x5f,
+0xfe,0x9b,0x70,0x00,0x01,0x22,0xff,0xf8,0xc3,0x02,0xc0,0xbf,0xeb,0x30,0x00,0x00,
+0x02,0x88,0x30,0x00,0x05,0x88,0x10,0xa2,0x04,0x31,0xe2,0x00,0x5f,0x1a,0x00,0x32,
+0x0c,0xfd,0x13,0x8d,0x00,0x33,0x01,0xdf,0xce,0xad,0x0b,0x14,0x1e,0x10,0x03,0x2f,
+0x02,0x87,0x2f,0x04,0xee,0x70,0x02,0xef,0xa0,0x00,0x0d,0xfe,0x20,0xa7,0x05,0x41,
+0x80,0x0b,0xff,0x30,0x75,0x01,0x12,0x69,0x6f,0x02,0x11,0x06,0x39,0x0b,0x08,0x76,
+0x01,0x0f,0x55,0x08,0xad,0x00,0x01,0x00,0x24,0x38,0x70,0xb5,0x00,0x14,0xef,0xbc,
+0x0d,0x23,0x1e,0xfd,0x78,0x02,0x42,0x01,0xdf,0xd1,0x5f,0x5e,0x00,0x42,0x0c,0xfe,
+0x20,0x07,0xfe,0x00,0x7f,0x38,0x83,0x00,0x00,0x68,0x70,0x00,0x01,0x00,0x0f,0x41,
+0x59,0xde,0xfe,0xda,0x28,0x01,0x11,0x4d,0x8e,0x09,0x12,0x40,0x73,0x03,0x40,0xee,
+0xff,0xff,0xf7,0x92,0x07,0xa0,0xf7,0x10,0x00,0x17,0xef,0xff,0x50,0x02,0xff,0xfd,
+0x87,0x00,0x62,0x1d,0xff,0xe0,0x09,0xff,0xf2,0x1e,0x07,0x23,0xf5,0x0f,0x7e,0x00,
+0x33,0xcf,0xfa,0x4f,0x43,0x0e,0x23,0x36,0x65,0x71,0x0c,0x02,0x9a,0x03,0x25,0x00,
+0x00,0xfc,0x0c,0x03,0xf5,0x03,0x19,0xf8,0x0a,0x00,0x73,0x5d,0xdd,0xdd,0xdd,0xdb,
+0xdf,0xf8,0xfa,0x07,0x16,0xfe,0x0a,0x00,0x04,0x32,0x00,0x44,0x7f,0xfe,0xaf,0xfc,
+0x0a,0x00,0x24,0x7f,0xff,0x0a,0x00,0x33,0x3f,0xff,0x50,0x0a,0x00,0x33,0x0e,0xff,
+0xc0,0x0a,0x00,0x33,0x07,0xff,0xf6,0x0a,0x00,0x21,0x00,0xdf,0x1f,0x00,0xf1,0x01,
+0x01,0xcf,0xfe,0x00,0x2f,0xff,0xfa,0x30,0x00,0x02,0x7e,0xff,0xf9,0x00,0x03,0xef,
+0xd2,0x00,0x00,0xe4,0x01,0x11,0x1a,0xa8,0x01,0xc0,0xe6,0x00,0x00,0x00,0x00,0x28,
+0xce,0xff,0xdc,0x84,0x00,0x00,0x61,0x00,0x00,0x00,0x03,0x87,0x00,0x01,0x00,0x31,
+0x02,0xef,0xfa,0x08,0x00,0x41,0x01,0xef,0xdf,0xf7,0x08,0x00,0x40,0xdf,0xd1,0x6f,
+0xf5,0x09,0x00,0xe2,0xcf,0xe2,0x00,0x7f,0xf4,0x00,0x00,0x00,0x38,0x83,0x00,0x00,
+0x68,0x60,0x2d,0x00,0x0a,0x01,0x00,0xf0,0x13,0x07,0xce,0xfd,0xa3,0x04,0xff,0xc0,
+0x00,0x3d,0xff,0xff,0xff,0xf9,0x5f,0xfc,0x00,0x2e,0xff,0xff,0xee,0xff,0xfd,0xff,
+0xc0,0x0c,0xff,0xf9,0x10,0x01,0x8f,0xff,0xfc,0x04,0xff,0x52,0x00,0x50,0x5f,0xff,
+0xc0,0xaf,0xfd,0x2f,0x00,0xd0,0xaf,0xfc,0x0f,0xff,0x70,0x00,0x00,0x00,0x08,0xff,
+0xc2,0xff,0xf3,0x11,0x00,0x51,0x8f,0xfc,0x3f,0xff,0x00,0x11,0x00,0x32,0xc4,0xff,
+0xf0,0x11,0x00,0x13,0x4f,0x11,0x00,0x14,0xc3,0x11,0x00,0x31,0x1f,0xff,0x20,0x11,
+0x00,0x32,0xc0,0xef,0xf6,0x11,0x00,0xa0,0x0a,0xff,0xc0,0x00,0x00,0x00,0x0a,0xff,
+0xc0,0x4f,0x4d,0x00,0xf0,0x0c,0x05,0xff,0xfc,0x00,0xbf,0xff,0x81,0x00,0x18,0xff,
+0xff,0xc0,0x02,0xef,0xff,0xfe,0xef,0xff,0xff,0xfc,0x00,0x02,0xdf,0xff,0xff,0xff,
+0x98,0x28,0x00,0x62,0x7c,0xef,0xda,0x30,0x8f,0xfb,0xae,0x00,0x32,0x09,0xff,0xa0,
+0x09,0x00,0x40,0xcf,0xf9,0x00,0x07,0x08,0x00,0x51,0x1f,0xff,0x50,0x09,0xf7,0x4c,
+0x00,0xf0,0x06,0xf1,0x02,0xff,0xfa,0x20,0x00,0x2a,0xff,0xf8,0x00,0x07,0xff,0xff,
+0xdc,0xdf,0xff,0xfb,0x00,0x00,0x05,0xef,0xd5,0x00,0x00,0x27,0x00,0x50,0x5b,0xdf,
+0xfd,0x93,0x00,0x08,0x01,0x60,0x81,0x00,0x00,0x48,0x80,0x00,0xd2,0x00,0x51,0xf6,
+0x00,0x00,0xcf,0xf0,0x43,0x00,0x70,0xfe,0x40,0x18,0xff,0x90,0x00,0x00,0x89,0x00,
+0x41,0xff,0xff,0xfd,0x10,0x60,0x00,0x53,0x4c,0xff,0xff,0x91,0x00,0x5d,0x01,0x2f,
+0x10,0x00,0x01,0x00,0x07,0x50,0x59,0xde,0xfe,0xda,0x50,0x09,0x00,0xb0,0x4d,0xff,
+0xff,0xff,0xff,0xfe,0x40,0x00,0x00,0x07,0xff,0x42,0x01,0x00,0x36,0x01,0xa2,0x6f,
+0xff,0xf7,0x10,0x00,0x17,0xef,0xff,0x50,0x02,0x56,0x00,0x70,0x1d,0xff,0xe0,0x09,
+0xff,0xf2,0x00,0xb8,0x01,0x52,0xff,0xf5,0x0f,0xff,0x80,0xc9,0x00,0x41,0xfa,0x4f,
+0xff,0x20,0x0a,0x00,0x44,0x36,0x65,0x8f,0xfe,0x57,0x00,0x13,0xbf,0xf0,0x00,0x01,
+0xe9,0x00,0x03,0x01,0x00,0x29,0xdf,0xf8,0x0a,0x00,0x51,0x5d,0xdd,0xdd,0xdd,0xdb,
+0x0a,0x00,0x10,0x6f,0x7a,0x00,0x06,0x0a,0x00,0x04,0x32,0x00,0x44,0x7f,0xfe,0xaf,
+0xfc,0x0a,0x00,0x24,0x7f,0xff,0x0a,0x00,0x33,0x3f,0xff,0x50,0x0a,0x00,0x33,0x0e,
+0xff,0xc0,0x0a,0x00,0x33,0x07,0xff,0xf6,0x0a,0x00,0x21,0x00,0xdf,0x1f,0x00,0xf1,
+0x01,0x01,0xcf,0xfe,0x00,0x2f,0xff,0xfa,0x30,0x00,0x02,0x7e,0xff,0xf9,0x00,0x03,
+0xef,0xd2,0x00,0x00,0x7b,0x01,0x20,0x1a,0xff,0x01,0x00,0x10,0xe6,0x2d,0x00,0x60,
+0x28,0xce,0xff,0xdc,0x84,0x00,0xf0,0x00,0x30,0x30,0x00,0x0a,0x5f,0x00,0x60,0x4f,
+0xf8,0x00,0x00,0xef,0xd0,0x9f,0x00,0x41,0xf7,0x34,0xcf,0xf6,0x96,0x02,0x31,0xff,
+0xff,0xfa,0x8f,0x02,0x3f,0x9d,0xff,0xc5,0x3f,0x01,0x03,0x00,0xdc,0x01,0x40,0x4f,
+0xfc,0x00,0x03,0xed,0x01,0x14,0x95,0xfe,0x01,0x61,0xdf,0xfc,0x00,0xcf,0xff,0x91,
+0x0f,0x02,0x04,0x20,0x02,0x32,0x0a,0xff,0xd0,0x31,0x02,0x22,0xff,0xf7,0x42,0x02,
+0x3a,0x2f,0xff,0x30,0x64,0x02,0x1c,0x4f,0x86,0x02,0x04,0x97,0x02,0x32,0xc1,0xff,
+0xf2,0x11,0x00,0x32,0x0e,0xff,0x60,0x86,0x02,0x02,0x17,0x01,0x16,0xaf,0xdb,0x02,
+0x31,0x0b,0xff,0xf8,0xec,0x02,0x22,0x00,0x2e,0xe9,0x00,0x30,0xc0,0x00,0x2d,0x39,
+0x02,0x22,0x8f,0xfc,0x1f,0x03,0x32,0x08,0xff,0xb0,0xae,0x00,0x22,0x9f,0xfa,0x08,
+0x00,0x50,0x0c,0xff,0x90,0x00,0x70,0xd8,0x00,0x50,0xff,0xf5,0x00,0x9f,0x70,0x4c,
+0x00,0xf0,0x01,0xff,0x10,0x2f,0xff,0xa2,0x00,0x02,0xaf,0xff,0x80,0x00,0x7f,0xff,
+0xfd,0xcd,0xff,0x32,0x00,0x10,0x5e,0x2b,0x01,0x10,0x90,0x57,0x02,0x43,0xbd,0xff,
+0xd9,0x30,0x80,0x01,0x14,0xd2,0xfa,0x00,0x25,0xff,0xfa,0x0a,0x00,0x05,0xe2,0x01,
+0x2f,0x5c,0xb1,0x6a,0x02,0x08,0x0f,0x74,0x02,0xf8,0x00,0x76,0x02,0x22,0xfd,0x20,
+0xf2,0x04,0x04,0x3e,0x01,0x32,0x0f,0xff,0x90,0x09,0x00,0x1e,0x6c,0x45,0x01,0x0f,
+0xe9,0x04,0xe0,0x0f,0x25,0x02,0xf2,0x0e,0x01,0x00,0x01,0xbd,0x03,0x1d,0x50,0x0a,
+0x00,0x11,0x0d,0x4e,0x04,0x02,0x47,0x02,0x04,0x28,0x00,0x16,0x5f,0xea,0x00,0x14,
+0xf3,0x0a,0x00,0x24,0x5e,0x70,0x0a,0x00,0x2c,0x01,0x00,0x0a,0x00,0x24,0x03,0xf7,
+0x05,0x01,0x13,0xf3,0x41,0x00,0x12,0xfd,0x08,0x00,0x33,0x0b,0xff,0x80,0x19,0x00,
+0x14,0xf6,0x64,0x00,0x13,0x40,0xfa,0x03,0x13,0xf4,0x9b,0x02,0x2f,0x88,0x20,0x1f,
+0x05,0xf3,0x24,0x05,0x85,0xfa,0x00,0x33,0x06,0xff,0xf5,0x0a,0x00,0x43,0x04,0xff,
+0xdf,0xf4,0x62,0x01,0x43,0xff,0xa0,0xaf,0xe2,0xf0,0x08,0x41,0xc0,0x00,0xbf,0xe1,
+0x0b,0x00,0x6e,0x58,0x71,0x00,0x00,0x78,0x50,0xec,0x01,0x03,0x6a,0x01,0x13,0x50,
+0x92,0x00,0x14,0xa0,0x50,0x00,0x2f,0xcf,0xfa,0x15,0x00,0x4d,0x04,0x01,0x00,0x25,
+0xfa,0x0f,0x0b,0x00,0x41,0xa0,0xff,0xfe,0xdd,0x01,0x00,0x2f,0xff,0xfa,0x93,0x00,
+0x62,0x05,0x15,0x00,0x06,0x33,0x0a,0x33,0x2e,0xff,0xa0,0x32,0x0a,0x01,0xbe,0x03,
+0x56,0x1d,0xfd,0x15,0xff,0x60,0x31,0x0a,0xa2,0x03,0x88,0x30,0x00,0x06,0x87,0x00,
+0x00,0x7e,0xea,0x2e,0x00,0x2f,0x8f,0xfb,0x08,0x00,0x26,0x81,0x6b,0xef,0xea,0x40,
+0x00,0x8f,0xfb,0x2d,0xa2,0x04,0xf0,0x04,0x8f,0xfd,0xef,0xff,0xef,0xff,0xff,0x50,
+0x8f,0xff,0xfc,0x40,0x00,0x5f,0xff,0xd0,0x8f,0xff,0xb0,0xc1,0x02,0x40,0xf2,0x8f,
+0xff,0x10,0x10,0x03,0x32,0xf5,0x8f,0xfb,0x29,0x03,0x0f,0x08,0x00,0x55,0x43,0x00,
+0x2f,0xff,0x40,0x02,0x04,0x56,0x80,0x00,0x02,0xff,0xf4,0xc7,0x04,0x0f,0x19,0x00,
+0x11,0x26,0x07,0xff,0x01,0x00,0x27,0xfe,0x7f,0x0d,0x00,0x51,0xe4,0x9a,0xff,0xfb,
+0x99,0x01,0x00,0x3f,0xff,0xfc,0x98,0x64,0x00,0x15,0x04,0x01,0x00,0x01,0x19,0x00,
+0x04,0x01,0x00,0x00,0x19,0x00,0x04,0x3c,0x02,0x0f,0x96,0x00,0x14,0x0f,0x19,0x00,
+0x5f,0x35,0x00,0xee,0xe3,0x71,0x03,0x14,0x30,0xd6,0x08,0x02,0x06,0x05,0x12,0x08,
+0x00,0x03,0x00,0x0b,0x02,0x01,0x14,0x03,0x00,0xdb,0x03,0x68,0xbb,0xbf,0xff,0xcb,
+0xbb,0x70,0x26,0x00,0x0a,0x39,0x00,0x50,0x02,0x9d,0xff,0xd8,0x10,0x13,0x00,0x10,
+0x37,0x58,0x01,0x50,0x20,0x00,0x00,0xff,0xfb,0xf8,0x04,0x10,0xfd,0x13,0x00,0x40,
+0xff,0x81,0x00,0x1a,0xcf,0x02,0x30,0xff,0xff,0x40,0x89,0x00,0x22,0xa0,0x00,0xaf,
+0x06,0x23,0x7f,0xfd,0x4c,0x00,0x33,0x05,0xff,0xe0,0x4c,0x00,0x23,0x4f,0xff,0x13,
+0x00,0x3f,0x04,0xff,0xf0,0x13,0x00,0x57,0x00,0xa7,0x04,0xff,0x10,0x20,0x00,0x6d,
+0xfd,0x70,0x00,0x4f,0xf1,0x06,0xff,0xff,0xfe,0xaa,0xff,0xd0,0x0e,0xfe,0x9b,0xff,
+0xff,0xff,0x50,0x3f,0xf2,0x00,0x29,0xef,0xd5,0x00,0x15,0x40,0x96,0x06,0x04,0x1f,
+0x90,0x07,0x00,0x9f,0x00,0x01,0x00,0xfe,0x0e,0x23,0x10,0x1a,0xfe,0xb3,0x00,0x0b,
+0xfa,0x0d,0xff,0xff,0xfc,0x9c,0xff,0x66,0xff,0xb9,0xdf,0xff,0xff,0xd0,0xaf,0xa0,
+0x00,0x5c,0xfe,0xa1,0x02,0x31,0xea,0x00,0x04,0x26,0x01,0x00,0x36,0x01,0x0f,0x0d,
+0x00,0x63,0x11,0xef,0xae,0x03,0x02,0x06,0x00,0x10,0x89,0xa3,0x03,0x1e,0x98,0xa6,
+0x00,0x04,0xde,0x08,0x0f,0x06,0x00,0x7c,0x50,0x00,0xcf,0xf9,0x00,0x00,0x20,0x6f,
+0xff,0x01,0x00,0x11,0x76,0x06,0x00,0x30,0xf7,0x39,0x99,0x01,0x00,0x2f,0x40,0x00,
+0x01,0x00,0x01,0x20,0x4f,0xff,0x06,0x00,0x3f,0x04,0xff,0xf0,0x0d,0x00,0x64,0xfb,
+0x0e,0x5f,0xf5,0x00,0x00,0x8f,0xf2,0x2f,0xfa,0x00,0x00,0xcf,0xf0,0x0b,0xff,0x83,
+0x4a,0xff,0x80,0x01,0xdf,0xff,0xff,0xfc,0x00,0x00,0x18,0xdf,0xfc,0x70,0xac,0x00,
+0x2f,0xcf,0xf9,0x06,0x00,0x85,0xfe,0x0c,0xcf,0xe0,0x00,0x00,0xff,0xa9,0xff,0x30,
+0x00,0x4f,0xf8,0x3f,0xfd,0x53,0x6e,0xff,0x20,0x7f,0xff,0xff,0xff,0x50,0x00,0x3b,
+0xef,0xea,0x30,0x6e,0x01,0x02,0x05,0x01,0x0f,0x0b,0x00,0x50,0x30,0x0c,0xff,0x90,
+0x9e,0x00,0x0f,0x07,0x00,0x3e,0xf1,0x17,0xff,0xfa,0x00,0x8f,0xf8,0x00,0x8f,0xf7,
+0x00,0x2f,0xfb,0x00,0x07,0xff,0x50,0x00,0x8f,0xf5,0x00,0x06,0xff,0xe8,0xa6,0x1e,
+0xff,0xff,0x80,0x2b,0xfe,0xb3,0x00,0x01,0xcf,0xa0,0x00,0x06,0xff,0xf3,0x04,0x00,
+0x26,0x00,0x9c,0xc5,0x01,0x00,0x95,0x00,0x0f,0x04,0x00,0x39,0xf6,0x1a,0x1d,0xfe,
+0x30,0x01,0xdf,0xe2,0x00,0x09,0xff,0x40,0x00,0x0f,0xfd,0x00,0x00,0x1f,0xfd,0x00,
+0x00,0x0e,0xff,0xa9,0xc0,0x08,0xff,0xff,0xf0,0x00,0x8d,0xfd,0x70,0x04,0xcb,0x20,
+0xef,0xfb,0x0f,0xff,0xc0,0x6e,0xe3,0x40,0x02,0x3f,0x0c,0xff,0x90,0x05,0x00,0x29,
+0x2f,0x4f,0xff,0x02,0x00,0x13,0x24,0xcf,0xf9,0x73,0x00,0x2f,0x8f,0xfe,0x0c,0x00,
+0xbc,0x31,0x02,0x88,0x80,0x0c,0x00,0x70,0xfd,0xcf,0xf9,0x00,0x03,0xff,0xf2,0x0c,
+0x00,0x80,0xaf,0xfc,0xcf,0xf9,0x00,0x01,0xff,0xf7,0x0c,0x00,0x21,0xef,0xf9,0x0f,
+0x03,0x70,0xfe,0x10,0x00,0x00,0x09,0xff,0xf4,0x0c,0x00,0xa0,0x5f,0xff,0xd4,0x00,
+0x02,0xaf,0xff,0xc0,0xcf,0xf9,0x13,0x00,0x61,0xff,0xfd,0xef,0xff,0xfe,0x10,0x54,
+0x00,0x10,0x8f,0x9c,0x04,0x12,0xc1,0x45,0x03,0xe0,0x01,0x8c,0xef,0xfd,0xa4,0x00,
+0x00,0x1c,0xfa,0x00,0x00,0x06,0xed,0x36,0x38,0x02,0x90,0xff,0xfb,0x6f,0xff,0x30,
+0x00,0x0e,0xff,0xa0,0x41,0x02,0x2d,0x4c,0xb2,0x46,0x03,0x30,0x0b,0xff,0x94,0xe4,
+0x02,0x2f,0xbf,0xf9,0x0d,0x00,0x62,0x20,0x00,0x00,0x0d,0x00,0x36,0x90,0x00,0x00,
+0x0d,0x00,0x01,0x17,0x01,0x11,0xdf,0x05,0x01,0xf3,0x06,0x6f,0xff,0x40,0x00,0x00,
+0x6e,0xef,0xff,0xe0,0x00,0x00,0x06,0xff,0xff,0xf5,0x00,0x00,0x00,0x4e,0xfe,0xb3,
+0xbc,0x00,0x00,0x30,0x03,0x01,0x01,0x00,0x00,0x1b,0x00,0x14,0x40,0x19,0x03,0x31,
+0x8a,0xff,0x20,0x0a,0x00,0x60,0x03,0xff,0xa0,0x0b,0xfe,0x10,0x0a,0x00,0x7f,0x02,
+0xef,0xc0,0x00,0x0c,0xfc,0x00,0x01,0x00,0x12,0x34,0x05,0xff,0xf1,0x0b,0x00,0x3f,
+0x5f,0xff,0x10,0x15,0x00,0x96,0x34,0x08,0x88,0x20,0x15,0x00,0x20,0xff,0xf6,0x15,
+0x00,0x71,0x7f,0xff,0x00,0x00,0x0d,0xff,0xa0,0xba,0x04,0x10,0xc0,0x21,0x02,0x40,
+0x30,0x00,0x00,0x05,0x58,0x02,0x82,0x01,0xff,0xff,0x60,0x00,0x18,0xff,0xfe,0x36,
+0x01,0x22,0xfe,0xef,0x3a,0x01,0x10,0x05,0x41,0x02,0x11,0xfe,0x61,0x05,0x52,0x01,
+0x7b,0xef,0xfe,0xa6,0x5a,0x00,0x30,0x0c,0xfe,0x20,0x96,0x01,0x20,0xff,0xe2,0x95,
+0x01,0xfa,0x00,0x3b,0xfd,0x10,0x00,0xaf,0xf3,0x00,0xcf,0xd0,0x05,0xbb,0x40,0x00,
+0x1a,0xb7,0x37,0x01,0x3f,0x0f,0xff,0x40,0x06,0x00,0x6e,0x31,0x1f,0xff,0x30,0xd1,
+0x02,0x10,0x10,0x9f,0x04,0x50,0xfd,0x00,0x00,0x2d,0xcf,0x0b,0x01,0x20,0x3f,0xff,
+0x5c,0x02,0x31,0x3e,0xfe,0xb5,0x28,0x00,0x12,0x50,0x61,0x02,0x20,0xf5,0x00,0x4b,
+0x02,0x00,0x45,0x03,0x13,0xf7,0x15,0x00,0x42,0x07,0xff,0xf9,0x00,0x15,0x00,0x33,
+0x06,0xff,0xfb,0x2a,0x00,0x10,0x04,0x3c,0x07,0x01,0x15,0x00,0x42,0x03,0xff,0xfe,
+0x10,0x15,0x00,0x42,0x02,0xef,0xfe,0x20,0x15,0x00,0x43,0x01,0xdf,0xff,0x30,0x54,
+0x00,0x11,0xcf,0x58,0x00,0x00,0x15,0x00,0x42,0xaf,0xff,0x70,0x00,0x15,0x00,0x11,
+0x9f,0xd3,0x02,0x00,0x15,0x00,0x33,0x7f,0xff,0xe0,0x24,0x01,0x32,0xaf,0xff,0xff,
+0xc3,0x05,0x01,0x4c,0x08,0x12,0x30,0x15,0x00,0x52,0xff,0xc2,0xef,0xfe,0x10,0x15,
+0x00,0x42,0xd1,0x04,0xff,0xfb,0x15,0x00,0x52,0xe1,0x00,0x08,0xff,0xf7,0x54,0x00,
+0x00,0xc2,0x01,0x14,0xf3,0xbd,0x00,0x32,0x2e,0xff,0xe1,0x15,0x00,0x00,0xf7,0x01,
+0x14,0xb0,0xd2,0x00,0x10,0x9f,0x57,0x00,0x02,0xd2,0x00,0x33,0xcf,0xff,0x30,0x15,
+0x00,0x10,0x02,0xb4,0x00,0x22,0xff,0xf5,0x2d,0x02,0x14,0xfb,0xfc,0x00,0x00,0xf2,
+0x00,0x02,0x15,0x00,0x03,0x57,0x00,0x36,0x00,0x78,0x81,0xc5,0x01,0x14,0x10,0x0b,
+0x00,0x24,0xff,0xf0,0x0a,0x00,0x35,0x2f,0xfe,0x00,0x65,0x03,0x15,0xa0,0xfe,0x05,
+0x14,0xf3,0x0a,0x00,0x25,0x1e,0xfa,0x04,0x02,0x12,0x18,0x07,0x00,0x22,0x7e,0xea,
+0x08,0x00,0x33,0x08,0xff,0xb0,0xec,0x04,0x1f,0xfb,0x11,0x00,0x23,0x31,0x2e,0xff,
+0xd1,0x11,0x00,0x31,0x1d,0xff,0xe1,0x11,0x00,0x31,0x0c,0xff,0xf2,0x22,0x00,0x31,
+0x0b,0xff,0xf4,0x22,0x00,0x31,0x0a,0xff,0xf5,0x33,0x00,0x02,0x2a,0x01,0x20,0x8f,
+0xfb,0xc3,0x01,0x00,0x11,0x00,0x32,0xb4,0xff,0xfb,0x57,0x05,0x31,0xef,0xff,0x20,
+0x11,0x00,0x01,0x04,0x09,0x02,0x25,0x05,0x11,0xf7,0x11,0x00,0x20,0xfe,0x2b,0xfb,
+0x00,0x00,0x15,0x03,0x32,0x1e,0xff,0xd0,0x77,0x00,0x32,0x4f,0xff,0x90,0x77,0x00,
+0x32,0x8f,0xff,0x50,0x88,0x00,0x00,0x79,0x05,0x20,0x8f,0xfb,0x48,0x01,0x12,0xfb,
+0x11,0x00,0x32,0x06,0xff,0xf7,0x99,0x00,0x32,0x0a,0xff,0xf2,0xaa,0x00,0x01,0x3e,
+0x00,0x06,0x4b,0x05,0x14,0xfd,0x83,0x04,0x13,0xc0,0x99,0x03,0x05,0xd7,0x00,0x03,
+0xb9,0x07,0x23,0xdf,0xf2,0x19,0x00,0x03,0x35,0x01,0x24,0x01,0xbd,0x71,0x01,0x17,
+0x10,0x41,0x0a,0x30,0xcf,0xff,0x20,0x09,0x00,0x00,0xf5,0x05,0x02,0x12,0x00,0x31,
+0x6f,0xff,0x80,0x09,0x00,0x32,0x03,0xff,0xfb,0x24,0x00,0x00,0x12,0x01,0x01,0x09,
+0x00,0x31,0xbf,0xff,0x30,0x09,0x00,0x32,0x07,0xff,0xf6,0x3f,0x00,0x31,0x4f,0xff,
+0xa0,0x09,0x00,0x32,0x01,0xef,0xfd,0x51,0x00,0x34,0xff,0xff,0xf2,0x09,0x00,0x14,
+0xc0,0x09,0x00,0x13,0xfa,0x6c,0x00,0x32,0xaf,0xff,0x80,0x09,0x00,0x14,0x0b,0x3f,
+0x00,0x42,0x00,0xdf,0xff,0x40,0x09,0x00,0x32,0x1e,0xff,0xf3,0x09,0x00,0x01,0xf1,
+0x02,0x01,0x87,0x00,0x32,0x3f,0xff,0xd1,0x09,0x00,0x33,0x05,0xff,0xfc,0xab,0x00,
+0x10,0x6f,0x6f,0x00,0x45,0x78,0x87,0x00,0x00,0xab,0x05,0x01,0x16,0x01,0x02,0xef,
+0x00,0x13,0x0a,0x02,0x03,0x14,0x04,0xd6,0x01,0x2f,0xdf,0xd0,0x75,0x05,0x04,0x03,
+0x9c,0x02,0x04,0xc4,0x02,0x0f,0x11,0x00,0xa3,0x20,0xfe,0xdd,0x01,0x00,0x32,0xd6,
+0x0f,0xff,0x01,0x00,0x13,0x80,0x08,0x00,0x11,0xf8,0x77,0x05,0x30,0x1e,0xff,0x80,
+0xde,0x06,0x66,0x06,0xff,0x90,0x00,0x2f,0xfa,0xf9,0x00,0x22,0x3e,0xee,0x65,0x01,
+0x0f,0x04,0x00,0x55,0x0f,0x69,0x01,0xcb,0x0d,0x01,0x00,0x00,0xeb,0x05,0x12,0x60,
+0x09,0x00,0x23,0xbf,0xf6,0xd3,0x06,0x04,0x29,0x08,0x23,0xef,0xf1,0xb6,0x03,0x14,
+0xfc,0x2a,0x00,0x03,0x19,0x00,0x28,0x4e,0x80,0x94,0x03,0x8f,0x03,0xee,0xe0,0x4f,
+0xff,0x04,0xff,0xf0,0x05,0x00,0x2b,0x21,0x00,0x00,0x91,0x05,0xf1,0x02,0xf0,0x2f,
+0xfe,0x03,0xff,0xd0,0x6f,0xf9,0x0b,0xff,0x43,0xff,0xc0,0x0a,0xe2,0x00,0x01,0xd6,
+0x00,0x32,0x0d,0xff,0x40,0xe7,0x00,0x22,0xdf,0xf4,0xe7,0x00,0x32,0x0e,0xff,0x20,
+0x62,0x06,0x22,0xff,0xe0,0x11,0x00,0x22,0x7f,0xf9,0x09,0x01,0x23,0x0e,0xff,0x86,
+0x06,0x2f,0x4e,0x50,0x91,0x01,0x91,0x91,0x3e,0xee,0x00,0x0e,0xee,0x04,0xff,0xf0,
+0x01,0x03,0x01,0x10,0x2f,0x0b,0x01,0xd0,0x04,0xff,0xc0,0x4f,0xff,0x00,0x9f,0xf6,
+0x04,0xff,0xf0,0x1f,0xfe,0xa8,0x04,0x20,0xaf,0x40,0x7f,0x0c,0x1f,0x20,0xce,0x0d,
+0x57,0x50,0xff,0xf0,0x00,0x00,0x00,0x41,0x0f,0xff,0x50,0x00,0x01,0x00,0x22,0xff,
+0xf5,0x08,0x00,0x0f,0x11,0x00,0x35,0x22,0x2d,0xf7,0x11,0x00,0x32,0x0a,0xff,0xf1,
+0x11,0x00,0x22,0x9f,0xff,0x11,0x00,0x5f,0x01,0xbc,0x50,0x00,0x00,0x77,0x00,0x3b,
+0x20,0xfe,0xdd,0x01,0x00,0x32,0xd6,0x0f,0xff,0x01,0x00,0x13,0x80,0x08,0x00,0x8f,
+0xf8,0x3e,0xee,0x00,0x00,0x00,0x4f,0xff,0x05,0x00,0x25,0xb0,0x6e,0xd3,0x4f,0xff,
+0x00,0xff,0xfb,0x4f,0xff,0x00,0xef,0x05,0x00,0x2f,0x4c,0xb2,0x4b,0x00,0x27,0x08,
+0xaf,0x00,0x05,0xc1,0x00,0x0f,0x13,0x00,0x34,0x13,0x16,0x13,0x00,0x32,0x77,0xcf,
+0xf0,0x13,0x00,0x30,0xff,0xff,0xfc,0x08,0x00,0x50,0x18,0xdf,0xff,0xfc,0x72,0x09,
+0x00,0x42,0x06,0xff,0xff,0xf6,0x2e,0x00,0x2f,0x5b,0x6f,0x85,0x00,0x43,0x03,0x81,
+0x01,0x14,0x00,0x82,0x01,0x23,0x70,0x00,0x09,0x00,0xaf,0xf7,0x00,0x0c,0xee,0x50,
+0x00,0x00,0x0e,0xff,0x60,0x05,0x00,0x1e,0xff,0x08,0x63,0x92,0x00,0x0e,0xff,0xef,
+0xf2,0x00,0x3e,0xff,0xff,0xa1,0x3d,0xff,0xff,0x91,0x00,0x6f,0xff,0xff,0x60,0x00,
+0x46,0x4b,0x00,0x21,0x04,0x05,0x00,0x01,0x01,0x00,0x22,0x68,0x87,0x09,0x00,0x00,
+0x98,0x01,0x13,0x70,0x0a,0x00,0x33,0x0d,0xff,0x90,0x0a,0x00,0x33,0x07,0xff,0xb0,
+0x0a,0x00,0x34,0x02,0xff,0xd0,0x29,0x00,0x3e,0xbf,0xe1,0x00,0x01,0x00,0x04,0x05,
+0x01,0x11,0xa0,0x08,0x00,0x43,0x0b,0xff,0xa0,0xff,0x10,0x01,0x65,0xbf,0xfa,0x0f,
+0xff,0xfe,0x10,0x15,0x00,0x15,0xf9,0x15,0x00,0x25,0xff,0xf4,0x15,0x00,0x24,0xff,
+0xd0,0x15,0x00,0x33,0xaf,0xff,0x80,0x15,0x00,0x43,0xf5,0xaf,0xff,0x30,0x15,0x00,
 0x34,0x51,0xef,0xfc,0x15,0x00,0x33,0x05,0xff,0xf7,0x15,0x00,0x43,0x50,0x0b,0xff,
 0xf2,0x15,0x00,0x43,0x00,0x2f,0xff,0xb0,0x15,0x00,0x43,0x00,0x7f,0xff,0x60,0x15,
 0x00,0x43,0x00,0xcf,0xfe,0x10,0x15,0x00,0x34,0x02,0xff,0xfa,0x15,0x00,0x32,0x08,
-0xff,0xf4,0x15,0x00,0x00,0x62,0x01,0x13,0xe0,0x15,0x00,0x00,0x2e,0x0a,0x24,0xbf,
-0xfa,0x38,0x03,0x14,0x3b,0x3d,0x05,0x24,0xef,0xfd,0x15,0x00,0x11,0x04,0xd0,0x05,
-0x13,0xf5,0x45,0x0d,0x04,0x67,0x05,0x25,0x1e,0xff,0x67,0x05,0x16,0x5f,0xe5,0x05,
-0x15,0xbf,0x15,0x00,0x11,0x01,0xf7,0x0f,0x12,0x49,0x66,0x0a,0x00,0x78,0x0f,0x00,
-0x83,0x02,0x33,0xa1,0x00,0x00,0x57,0x10,0x02,0x6b,0x15,0x70,0xff,0xa4,0x10,0x15,
-0xbf,0xff,0xe1,0xb0,0x22,0x11,0x30,0x31,0x07,0x13,0xb0,0x86,0x1f,0x00,0x07,0x00,
-0x13,0x0e,0x50,0x01,0x32,0xdf,0xfa,0x04,0x9f,0x12,0x00,0xe8,0x04,0x24,0x8f,0xfd,
-0xb3,0x14,0x34,0x4b,0xff,0xa0,0x3b,0x0b,0x24,0xdf,0xf8,0x82,0x14,0x14,0x9e,0xe2,
-0x0c,0x44,0xbf,0xf9,0xef,0xf7,0x6c,0x18,0x15,0xae,0x15,0x00,0x16,0xfa,0x15,0x00,
-0x34,0x9d,0xff,0x80,0xd3,0x07,0x24,0xbf,0xfa,0xfb,0x02,0x12,0x78,0x14,0x03,0x00,
-0x56,0x0c,0x13,0x4f,0xfd,0x0f,0x22,0x6f,0xff,0xdf,0x1a,0x01,0x91,0x0c,0x00,0x41,
-0x01,0x01,0x12,0x05,0x52,0xf4,0x00,0x0e,0xff,0xf3,0x49,0x04,0x00,0x19,0x0c,0x41,
-0xf9,0x30,0x00,0x4a,0xe9,0x01,0x25,0x5f,0xff,0x63,0x05,0x15,0x2c,0x6c,0x0b,0x00,
-0xfd,0x1a,0x24,0xec,0x83,0x06,0x0a,0x35,0xfe,0xd9,0x40,0x10,0x0a,0x10,0xfd,0x9c,
-0x04,0x11,0xfe,0x6e,0x0b,0x03,0x59,0x0b,0x00,0xe3,0x11,0x13,0x20,0x4e,0x01,0x15,
-0x4f,0x4e,0x0d,0x15,0x09,0x4f,0x0b,0x17,0x03,0x4f,0x0b,0x1d,0xf5,0x0a,0x00,0x05,
-0x1e,0x00,0x00,0xbe,0x16,0x0b,0x46,0x00,0x21,0x01,0x49,0x5a,0x00,0x03,0x74,0x12,
-0x04,0x82,0x00,0x22,0xfc,0x30,0x30,0x0a,0x37,0xdc,0xb7,0x30,0x43,0x04,0x0f,0x0a,
-0x00,0x48,0x00,0x35,0x01,0x42,0xad,0xff,0xec,0x72,0xa1,0x0f,0x01,0x9c,0x11,0x12,
-0x90,0xf1,0x01,0x01,0x11,0x01,0x02,0x82,0x0d,0x40,0x93,0x10,0x26,0xcf,0x18,0x03,
-0x11,0x2f,0xb6,0x0c,0x10,0x08,0x39,0x03,0x01,0xeb,0x20,0x01,0x07,0x00,0x13,0x01,
-0x11,0x1b,0x10,0x1f,0x1b,0x16,0x13,0xf1,0x33,0x10,0x23,0xe0,0x0a,0xf9,0x16,0x14,
-0x04,0xb3,0x15,0x03,0x1c,0x0e,0x2a,0x60,0x00,0x7c,0x0c,0x00,0x30,0x02,0x01,0x8c,
-0x21,0x02,0xbb,0x09,0x07,0x0b,0x00,0x07,0x21,0x00,0x07,0x37,0x00,0x16,0x0e,0x4d,
-0x00,0x16,0x0b,0x63,0x00,0x16,0x07,0x79,0x00,0x04,0x8f,0x00,0x00,0x29,0x00,0x03,
-0xa5,0x00,0x71,0x9f,0xff,0x20,0x00,0x2f,0xff,0xd2,0xb2,0x02,0x11,0xf8,0xd1,0x00,
-0x10,0x82,0x00,0x0f,0x15,0xc0,0xe7,0x00,0x25,0xfc,0x10,0xfd,0x00,0x15,0xf7,0x13,
-0x01,0x03,0x09,0x01,0x02,0x97,0x12,0x04,0x13,0x11,0x00,0x2a,0x17,0x16,0xe3,0xc4,
-0x10,0x15,0xd1,0x45,0x01,0x18,0x7d,0x34,0x11,0x02,0xc1,0x0f,0x18,0xa6,0x69,0x0c,
-0x05,0xc2,0x0f,0x03,0x5a,0x22,0x23,0x01,0x7f,0x12,0x0d,0x00,0xc0,0x19,0x05,0xbc,
-0x0d,0x15,0x6f,0x6d,0x02,0x35,0x1f,0xff,0x50,0x5c,0x0f,0x1d,0x60,0x14,0x00,0x05,
-0x28,0x00,0x35,0x02,0xef,0xfc,0x50,0x00,0x12,0xf3,0x3b,0x02,0x10,0xef,0xee,0x04,
-0x03,0x78,0x00,0x14,0xc3,0x82,0x00,0x14,0xfb,0xf5,0x01,0x01,0x37,0x14,0x03,0x73,
-0x04,0x13,0xa0,0x0a,0x00,0x34,0x06,0xff,0xf2,0x13,0x02,0x24,0xdf,0xfb,0x0a,0x00,
-0x14,0x5f,0xa9,0x07,0x00,0x69,0x03,0x05,0x6d,0x10,0x24,0xf3,0x00,0xda,0x0d,0x05,
-0xb2,0x07,0x10,0x5f,0x25,0x06,0x03,0x8b,0x1f,0x05,0x70,0x0e,0x00,0x99,0x03,0x31,
-0x02,0x8b,0xef,0x39,0x1f,0x21,0x00,0x19,0x68,0x03,0x11,0x60,0x5e,0x18,0x20,0xfe,
-0xef,0x2b,0x0b,0x10,0x0c,0x3f,0x0b,0x42,0x04,0xcf,0xff,0x80,0x4e,0x1d,0x00,0xa2,
-0x01,0x22,0x9f,0xfe,0xed,0x01,0x21,0xf9,0x0b,0x49,0x04,0x00,0x29,0x11,0x03,0xe8,
-0x0b,0x33,0x5b,0xba,0x08,0xf3,0x06,0x00,0x82,0x02,0x15,0xc1,0x26,0x07,0x24,0xf8,
-0x20,0x0a,0x00,0x22,0xff,0xc7,0x1d,0x04,0x61,0x3c,0xff,0xff,0xff,0xd7,0x10,0x7a,
-0x03,0x15,0xaf,0x69,0x26,0x25,0x04,0x9e,0x9e,0x12,0x25,0x05,0xcf,0xeb,0x12,0x15,
-0x8f,0x02,0x03,0x43,0xcf,0xfc,0x6b,0xb9,0xcf,0x04,0x33,0xe7,0xff,0xf0,0x65,0x04,
-0x14,0x3f,0x42,0x0f,0x41,0xd0,0xcf,0xfe,0x30,0x64,0x02,0x50,0xf9,0x02,0xff,0xff,
-0x93,0xc3,0x0f,0x20,0xff,0x20,0x5f,0x18,0x20,0xed,0xff,0x67,0x01,0x33,0x01,0xaf,
-0xff,0x39,0x19,0x64,0x00,0x16,0xbd,0xff,0xec,0x94,0xf7,0x1b,0x00,0x01,0x00,0x16,
-0xa2,0x89,0x0b,0x20,0x1e,0xee,0x54,0x04,0x00,0xd9,0x0d,0x1a,0x90,0x13,0x13,0x14,
-0x0e,0xd9,0x02,0x0f,0x15,0x00,0xc7,0x23,0x8f,0xfc,0x7a,0x13,0x02,0x29,0x23,0x00,
-0x5d,0x01,0x0f,0x13,0x00,0x7d,0x13,0xd0,0x13,0x00,0x05,0x3e,0x09,0x33,0xe4,0xff,
-0xf1,0x69,0x0e,0x03,0x89,0x0e,0x61,0x2f,0xff,0x70,0xaf,0xff,0x40,0xd3,0x06,0xa0,
-0xf1,0x01,0xef,0xff,0x82,0x00,0x00,0x5d,0xff,0xf6,0x31,0x07,0x21,0xfe,0xde,0xc7,
-0x10,0x25,0x02,0xcf,0xfa,0x0d,0x55,0x39,0xce,0xff,0xdb,0x60,0x2f,0x20,0x00,0x57,
-0x00,0x13,0x40,0xb1,0x06,0x00,0x1b,0x17,0x13,0x09,0x62,0x02,0x00,0x57,0x1b,0x04,
-0x6d,0x0e,0x00,0x93,0x03,0x12,0xdf,0x23,0x00,0x00,0xa1,0x26,0x12,0x07,0x23,0x00,
-0x01,0xc8,0x04,0x14,0x2f,0xef,0x03,0x13,0x10,0x7f,0x12,0x00,0x8f,0x29,0x00,0xb5,
-0x00,0x12,0xf0,0x7f,0x13,0x02,0x15,0x04,0x01,0xc8,0x04,0x01,0x8e,0x05,0x15,0xfa,
-0xf8,0x1b,0x00,0xaf,0x1b,0x00,0x25,0x05,0x05,0x2d,0x1c,0x25,0x7f,0xfe,0x53,0x1c,
-0x34,0x0c,0xff,0x80,0x79,0x1c,0x13,0x01,0x9b,0x14,0x10,0x0d,0xaf,0x08,0x15,0xfc,
-0xc5,0x1c,0x12,0x0c,0xc6,0x01,0x00,0x67,0x22,0x16,0x01,0x50,0x1c,0x13,0x50,0x40,
-0x21,0x00,0xb3,0x26,0x14,0x0c,0xe0,0x00,0x00,0xac,0x22,0x15,0xe0,0x11,0x05,0x06,
-0x91,0x0f,0x24,0x4f,0xff,0xaf,0x17,0x00,0x4f,0x08,0x16,0xd0,0x4e,0x16,0x05,0xa9,
-0x0f,0x04,0x99,0x1c,0x27,0xcf,0xf9,0x2a,0x1d,0x52,0x5f,0xff,0x09,0xff,0xc0,0x5a,
-0x06,0x03,0x8a,0x18,0x22,0x5f,0xff,0xc4,0x00,0x12,0xf4,0x2c,0x00,0x13,0x01,0x84,
-0x2a,0x22,0xff,0x80,0xd3,0x04,0x02,0x16,0x2a,0x11,0x7f,0x22,0x1b,0x00,0x92,0x0a,
-0x21,0x9f,0xfb,0xac,0x00,0x21,0xdf,0xf1,0x52,0x22,0x00,0xb6,0x2a,0x00,0xa4,0x00,
-0x32,0xe8,0xff,0x60,0x5f,0x1b,0x11,0x2f,0x37,0x19,0x33,0xfa,0x4f,0xfa,0xa1,0x02,
-0x21,0xef,0xf6,0x78,0x27,0x00,0x26,0x00,0x00,0xbe,0x0a,0x01,0x82,0x1b,0x52,0xef,
-0xf1,0x0b,0xff,0x30,0xc6,0x15,0x21,0x6f,0xfd,0x86,0x17,0x22,0x6f,0xf7,0x3a,0x01,
-0x30,0x02,0xff,0xf1,0x24,0x27,0x32,0x02,0xff,0xb0,0x23,0x01,0x00,0x1e,0x0b,0x21,
-0xbf,0xf3,0x3c,0x27,0x01,0x97,0x00,0x91,0xbf,0xf8,0x00,0x0f,0xfe,0x00,0x00,0x9f,
-0xf4,0x73,0x27,0x00,0xc0,0x20,0xa2,0x04,0xff,0xa0,0x00,0x05,0xff,0x80,0x07,0xff,
-0xb0,0x88,0x27,0x92,0x9f,0xf5,0x00,0x00,0x0f,0xfd,0x00,0xbf,0xf7,0xe0,0x1f,0x11,
-0x0d,0xda,0x01,0x10,0xf1,0xa5,0x20,0x00,0xb6,0x00,0x30,0x61,0xff,0xc0,0x36,0x00,
-0x12,0x52,0x03,0x02,0x40,0x8f,0xf9,0x6f,0xf8,0x36,0x00,0x32,0xfa,0x5f,0xfc,0xe8,
-0x06,0x11,0xb9,0x27,0x00,0x22,0xef,0xd7,0xc0,0x01,0x41,0x0f,0xfe,0xdf,0xe0,0x75,
-0x01,0x01,0x4a,0x29,0x00,0x5b,0x0d,0x13,0xfa,0x25,0x29,0x04,0x22,0x29,0x02,0x6e,
-0x24,0x23,0xff,0xc0,0x17,0x0a,0x12,0xf1,0xc7,0x01,0x13,0xf9,0xb8,0x01,0x19,0xfc,
-0x09,0x05,0x12,0x0d,0x96,0x09,0x02,0xc5,0x24,0x33,0x7f,0xff,0x70,0xa7,0x21,0x21,
-0x20,0xdf,0xe2,0x14,0x00,0x12,0x00,0x32,0x03,0xff,0xfa,0x86,0x06,0x51,0xd0,0x00,
-0x09,0xff,0xf4,0x7a,0x00,0x11,0xf3,0xdf,0x15,0x01,0x1f,0x05,0x01,0x62,0x00,0x10,
-0x80,0xf3,0x13,0x02,0x43,0x29,0x00,0x20,0x25,0x02,0xe7,0x0d,0x34,0xfb,0x00,0x1f,
-0xb2,0x25,0x25,0xf5,0x0b,0x70,0x02,0x16,0xe5,0x48,0x23,0x05,0x16,0x22,0x16,0x9f,
-0x34,0x02,0x15,0xef,0x7e,0x07,0x14,0x2f,0xfe,0x0c,0x00,0xc7,0x24,0x15,0xf5,0x09,
-0x0d,0x01,0x69,0x0e,0x00,0xb3,0x1d,0x43,0xfe,0x5f,0xff,0x90,0x3e,0x00,0x12,0x40,
-0xa5,0x03,0x00,0x64,0x09,0x32,0x01,0xff,0xfd,0x68,0x00,0x10,0xf1,0xe3,0x03,0x01,
-0x4a,0x02,0x10,0xf6,0xfd,0x00,0x14,0xf2,0xf4,0x1a,0x01,0x6c,0x2c,0x00,0x8e,0x0e,
-0x02,0x89,0x1e,0x32,0x6f,0xff,0x80,0x77,0x00,0x24,0x10,0x1f,0x2f,0x1b,0x43,0xfa,
-0x0a,0xff,0xf4,0x78,0x00,0x25,0xf4,0x7f,0xcd,0x10,0x43,0xf1,0x0e,0xff,0xd0,0xe1,
-0x02,0x23,0x70,0x06,0x1b,0x12,0x62,0xcf,0xfe,0x00,0x00,0xdf,0xfd,0x3f,0x01,0x10,
-0xf6,0x1a,0x00,0x11,0x60,0x2b,0x00,0x13,0xd0,0x05,0x00,0x00,0x3f,0x1f,0x04,0xce,
-0x1a,0x21,0xcf,0xfc,0xdd,0x02,0x15,0xfd,0xe5,0x1d,0x55,0x2f,0xff,0x60,0x00,0x0d,
-0xf3,0x06,0x00,0xb7,0x25,0x03,0x47,0x16,0x33,0x00,0xdf,0xf9,0xab,0x06,0x15,0xfd,
-0x6c,0x10,0x34,0x0e,0xff,0x6d,0x28,0x0b,0x13,0x06,0x79,0x21,0x02,0xa7,0x01,0x05,
-0xaf,0x16,0x16,0x5f,0x6b,0x03,0x05,0x5f,0x18,0x0f,0x0b,0x00,0x4e,0x14,0x4f,0xea,
-0x06,0x16,0x90,0x0a,0x00,0x12,0x3e,0xca,0x14,0x15,0xef,0xdb,0x19,0x25,0xdf,0xfe,
-0x03,0x04,0x15,0xf4,0x24,0x04,0x1e,0x90,0x2d,0x24,0x15,0xf3,0x1d,0x00,0x04,0xa4,
-0x2d,0x05,0x1d,0x00,0x14,0x0a,0x49,0x19,0x00,0x51,0x11,0x04,0x1d,0x00,0x15,0xfc,
-0x1e,0x02,0x14,0xf2,0x9e,0x04,0x04,0x84,0x06,0x15,0x02,0x3b,0x02,0x15,0x0c,0x42,
-0x08,0x04,0xca,0x01,0x01,0x89,0x0d,0x04,0x1d,0x00,0x1c,0xe1,0x16,0x08,0x15,0x03,
-0x1d,0x00,0x15,0x0d,0xde,0x04,0x13,0x6f,0xc9,0x15,0x34,0xdd,0xd1,0x7f,0xe6,0x00,
-0x16,0xf2,0x0a,0x00,0x81,0x5c,0xcc,0xcc,0xc2,0x7f,0xff,0xff,0xf3,0x04,0x00,0x00,
-0xa8,0x2f,0x0f,0x04,0x00,0x61,0x16,0xff,0x84,0x00,0x23,0x1f,0xff,0x65,0x0d,0x13,
-0xf5,0x32,0x03,0x13,0xb0,0x9b,0x0a,0x02,0xa9,0x0a,0x01,0x62,0x2c,0x04,0x06,0x2c,
-0x10,0x00,0x06,0x33,0x02,0x1e,0x01,0x04,0x1d,0x04,0x13,0xf0,0x54,0x01,0x12,0x50,
-0x6f,0x01,0x03,0x48,0x01,0x05,0x67,0x0b,0x12,0x70,0xbb,0x03,0x13,0xfd,0xdb,0x01,
-0x04,0x10,0x0e,0x02,0xcf,0x01,0x0f,0x7b,0x00,0x49,0xe0,0x05,0x88,0x30,0xac,0xcc,
-0xcc,0x9d,0xff,0xff,0xfc,0xdf,0xff,0xff,0xc0,0xb4,0x06,0x1f,0x07,0x07,0x00,0x50,
-0x30,0xca,0xcc,0xdf,0x70,0x00,0x11,0xcd,0x92,0x10,0x23,0x0d,0xfc,0xdc,0x0d,0x02,
-0xa7,0x06,0x12,0x90,0xc2,0x1c,0x01,0x00,0x01,0x21,0xcf,0xf6,0x3f,0x2d,0x00,0xda,
-0x00,0xf0,0x03,0x4f,0xfa,0x0a,0xff,0x30,0x00,0x0a,0xff,0x40,0x4f,0xfa,0x00,0x01,
-0xff,0xd0,0x00,0xef,0xf1,0x91,0x2c,0x30,0x08,0xff,0x70,0xf3,0x05,0x31,0x2f,0xfd,
-0x04,0x27,0x10,0x30,0xf4,0xaf,0xf5,0x20,0x01,0x32,0xa0,0xab,0xbb,0x01,0x00,0x14,
-0x2e,0x4e,0x02,0x04,0x27,0x32,0x31,0x20,0x68,0x87,0x6a,0x28,0x00,0x60,0x2a,0x02,
-0x4c,0x09,0x10,0x0b,0xdd,0x02,0x62,0xdf,0xe1,0x00,0x00,0x06,0xbd,0x41,0x28,0x11,
-0x4e,0x13,0x26,0x00,0x13,0x03,0x20,0xfd,0xbd,0x09,0x00,0x30,0x2f,0xff,0xb2,0x37,
-0x21,0x42,0x50,0x08,0xff,0xd0,0x0c,0x1c,0x22,0x58,0x85,0xa7,0x22,0x04,0x3a,0x03,
-0x00,0x06,0x00,0x30,0x35,0x56,0x69,0x68,0x01,0x12,0x6c,0x93,0x26,0x23,0x02,0xdf,
-0xa4,0x26,0x40,0xef,0xff,0x84,0x10,0x22,0x00,0x10,0x8f,0xc5,0x05,0x10,0x05,0xc7,
-0x14,0x12,0x60,0x33,0x00,0x03,0x5e,0x0f,0x12,0xf0,0x53,0x20,0x13,0x9f,0x85,0x0f,
-0x70,0x6f,0xff,0xf0,0x09,0xff,0xfa,0x20,0x6d,0x0b,0x21,0x00,0x1e,0xe5,0x0b,0x21,
-0xff,0xf2,0x62,0x23,0x10,0xfa,0xb9,0x08,0x94,0x07,0xcf,0xfe,0xa3,0x00,0x9a,0xa5,
-0x7e,0xea,0xb7,0x1d,0x13,0xb0,0x65,0x03,0x1f,0xfb,0x11,0x00,0x20,0xa1,0x01,0x8c,
-0xef,0xd9,0x20,0x00,0x08,0xff,0xb4,0xef,0xe2,0x1e,0x21,0x8f,0xfe,0x17,0x1c,0x80,
-0x60,0x08,0xff,0xff,0xb3,0x00,0x05,0xef,0x2d,0x26,0x11,0xa0,0x09,0x12,0x01,0xed,
-0x20,0x00,0xf3,0x20,0x22,0x8f,0xfb,0x5e,0x05,0x32,0x38,0xff,0xb0,0x8d,0x0a,0x22,
-0x8f,0xfb,0xec,0x03,0x13,0x78,0x2d,0x26,0x32,0xf8,0x8f,0xfb,0x68,0x02,0x32,0x88,
-0xff,0xb0,0x35,0x21,0x22,0x8f,0xfb,0xd4,0x04,0x32,0x68,0xff,0xb0,0x25,0x2a,0x02,
-0x73,0x18,0x52,0x8f,0xfe,0x08,0xff,0xfa,0x99,0x11,0xd0,0x8f,0xff,0xfb,0x30,0x00,
-0x5e,0xff,0xf1,0x08,0xff,0xdf,0xff,0xfd,0x95,0x21,0x30,0x8f,0xf8,0x5f,0x9d,0x21,
-0x00,0xd8,0x01,0x43,0x18,0xdf,0xfd,0x92,0x54,0x25,0x01,0x98,0x01,0x01,0x8a,0x32,
-0x11,0xb1,0xf5,0x0c,0x10,0xdc,0x56,0x12,0x31,0x0a,0xff,0xf7,0x26,0x33,0x32,0x04,
-0xff,0xf5,0xf5,0x09,0x22,0xbf,0xfb,0x07,0x26,0x02,0x54,0x01,0x58,0x08,0xff,0x93,
-0xff,0xf1,0xa3,0x01,0x03,0x48,0x1e,0x14,0x00,0x0e,0x2f,0x02,0x4b,0x2c,0x04,0x34,
-0x07,0x04,0x22,0x28,0x01,0x4b,0x05,0x21,0x37,0x74,0x35,0x0d,0x00,0x4f,0x30,0x12,
-0x4f,0x6b,0x06,0x50,0xf2,0x00,0xbf,0xff,0x60,0x40,0x24,0x00,0x07,0x16,0x43,0xfc,
-0xce,0xff,0xfc,0xc0,0x2c,0x12,0xf9,0x66,0x1d,0x24,0xfd,0x93,0xc2,0x05,0x3f,0x07,
-0xee,0xa0,0x96,0x01,0x28,0x60,0x00,0x00,0x07,0xce,0xfd,0x93,0x11,0x00,0x00,0xf6,
-0x01,0x00,0x52,0x01,0x10,0x2e,0xdd,0x16,0xb1,0xfe,0xff,0xb0,0x0c,0xff,0xf9,0x10,
-0x01,0x8f,0xff,0xfb,0xe1,0x0d,0x00,0x0c,0x16,0x22,0xaf,0xfc,0x02,0x1f,0x02,0xcc,
-0x0f,0x33,0x08,0xff,0xb2,0x40,0x2f,0x23,0xfb,0x3f,0xe9,0x09,0x13,0xb4,0xf5,0x08,
-0x23,0xfb,0x4f,0x11,0x00,0x14,0xb3,0x11,0x00,0x01,0xb4,0x09,0x00,0x77,0x00,0x03,
-0x52,0x0c,0x21,0xfb,0x0a,0xd3,0x08,0x10,0x0a,0xf3,0x2c,0x12,0x60,0xf5,0x11,0x30,
-0xbf,0xff,0x81,0x23,0x24,0x30,0xb0,0x01,0xef,0x62,0x0e,0x22,0xef,0xfb,0xd3,0x02,
-0x10,0x96,0xaa,0x00,0x40,0x7c,0xef,0xda,0x30,0xde,0x21,0x52,0x02,0x9d,0xff,0xd9,
-0x30,0x6c,0x24,0x01,0xae,0x19,0x11,0x0a,0xd0,0x03,0x51,0xb0,0x00,0x07,0xff,0xf7,
-0x03,0x08,0x02,0x4f,0x0b,0x23,0x8f,0xfe,0xe8,0x00,0x22,0xef,0xf4,0x86,0x26,0x52,
-0x0a,0xff,0x72,0xff,0xf1,0x18,0x20,0x04,0xdd,0x06,0x14,0xb5,0x0b,0x20,0x22,0x5f,
-0xff,0x1a,0x28,0x3c,0x94,0xff,0xf0,0x98,0x01,0x14,0xf6,0x95,0x06,0x12,0xd0,0xd3,
-0x23,0x02,0xeb,0x06,0x10,0x4f,0xaa,0x34,0x60,0xa2,0x00,0x01,0x8f,0xff,0x40,0x47,
-0x2e,0x11,0xcd,0x70,0x17,0x11,0x9f,0xf7,0x28,0x00,0x35,0x1a,0x12,0xde,0xa4,0x26,
-0x20,0x01,0x8c,0x4b,0x0c,0x10,0x3e,0x37,0x10,0x00,0xd0,0x00,0x12,0xe6,0xb7,0x10,
-0x02,0xfb,0x0b,0x03,0x61,0x0d,0x02,0x9c,0x00,0x01,0x6e,0x0f,0x02,0x4e,0x36,0x02,
-0x06,0x00,0x54,0x99,0x9f,0xff,0xb9,0x99,0xb8,0x0f,0x0f,0x06,0x00,0x4d,0x00,0xfc,
-0x01,0x10,0xa3,0x72,0x21,0x10,0x3d,0x59,0x02,0x22,0x5f,0xfc,0xfc,0x01,0x33,0xfd,
-0xff,0xc0,0xfc,0x01,0x14,0xfc,0xfc,0x01,0x22,0xc0,0xaf,0x9d,0x2b,0x10,0xfc,0x03,
-0x34,0x00,0x81,0x01,0x32,0xc2,0xff,0xf3,0x1b,0x0e,0x04,0xfc,0x01,0x13,0xc4,0xeb,
-0x01,0x14,0xfc,0xfc,0x01,0x14,0xc3,0x11,0x00,0x13,0x1f,0xfc,0x01,0x14,0xc0,0x4e,
-0x0e,0x04,0xfc,0x01,0x20,0xc0,0x4f,0x4d,0x00,0x00,0x88,0x2c,0x03,0xfc,0x01,0x31,
-0xc0,0x02,0xef,0x5e,0x10,0x12,0xfc,0xfc,0x01,0x32,0x98,0xff,0xc0,0xfc,0x01,0x04,
-0xb7,0x02,0x04,0x18,0x2e,0x00,0x70,0x0c,0x13,0x07,0x4f,0x11,0x21,0x09,0xf7,0x4c,
-0x00,0xb1,0xf1,0x02,0xff,0xfa,0x20,0x00,0x2a,0xff,0xf8,0x00,0x07,0xf3,0x2a,0x13,
-0xfb,0xd2,0x33,0x11,0xf9,0x7f,0x10,0x01,0x2e,0x03,0x2a,0x7e,0xea,0x05,0x03,0x0f,
-0x08,0x00,0x20,0x81,0x6b,0xef,0xea,0x40,0x00,0x8f,0xfb,0x2d,0x59,0x00,0x40,0x8f,
-0xfd,0xef,0xff,0xaa,0x11,0x40,0x8f,0xff,0xfc,0x40,0xb5,0x09,0x31,0x8f,0xff,0xb0,
-0x45,0x30,0x31,0x8f,0xff,0x10,0x42,0x14,0x22,0x8f,0xfb,0xe3,0x2a,0x0f,0x08,0x00,
-0x55,0xa3,0x1c,0xfa,0x06,0xff,0xf3,0x6f,0xff,0x30,0x9c,0x70,0x7d,0x09,0x3f,0x04,
-0xff,0xf0,0x05,0x00,0x1a,0x52,0x00,0x00,0x3d,0xe6,0x00,0xec,0x35,0x00,0xbb,0x0d,
-0x28,0x02,0xbc,0x34,0x26,0x23,0x7f,0xfd,0xe5,0x2f,0x0f,0x09,0x00,0x48,0x10,0xfc,
-0xe3,0x01,0xff,0x04,0xb0,0x00,0x02,0xef,0xf8,0x02,0xee,0xff,0xff,0x30,0x2f,0xff,
-0xff,0x90,0x01,0xdf,0xfc,0x60,0x00,0x80,0x06,0x33,0x01,0xa2,0x2a,0x11,0xd1,0x11,
-0x00,0x30,0x1d,0xff,0xe1,0x11,0x00,0x00,0x4d,0x0c,0x00,0x22,0x00,0x00,0x1f,0x0c,
-0x01,0x22,0x00,0x12,0x0a,0xd4,0x17,0x12,0xb0,0x1a,0x1b,0x21,0x8f,0xfb,0xb3,0x1b,
-0x01,0xd9,0x04,0x12,0xfb,0xc7,0x0b,0x13,0xef,0xcc,0x02,0x12,0xff,0x7b,0x0d,0x13,
-0x8f,0x6f,0x14,0x62,0x08,0xff,0xfe,0x2b,0xff,0xf3,0x74,0x30,0x01,0x4e,0x0d,0x11,
-0x08,0xe2,0x2d,0x12,0x90,0x77,0x00,0x00,0x93,0x0a,0x01,0x77,0x00,0x00,0x43,0x18,
-0x22,0x8f,0xfb,0xd5,0x0a,0x12,0x08,0x06,0x10,0x11,0xf7,0x99,0x00,0x00,0x17,0x0b,
-0x01,0xaa,0x00,0x00,0x8c,0x0d,0x4f,0x3e,0xee,0x4f,0xff,0x02,0x00,0x21,0xf1,0x02,
-0x9f,0xf8,0x01,0x8c,0xef,0xda,0x30,0x00,0x03,0xad,0xff,0xd8,0x10,0x00,0x9f,0xf9,
-0x5f,0x9d,0x00,0x20,0xaf,0xff,0x0b,0x24,0x21,0x9f,0xfd,0x59,0x03,0x10,0x4b,0x06,
-0x00,0x60,0xfe,0x10,0x9f,0xff,0xf8,0x10,0x38,0x15,0x10,0xf7,0x66,0x08,0x41,0x80,
-0x9f,0xff,0x60,0xd6,0x1f,0x11,0x60,0xec,0x04,0x24,0x9f,0xfd,0x5a,0x0e,0x00,0x2d,
-0x08,0x24,0x9f,0xfb,0x69,0x23,0x00,0x39,0x0f,0x13,0x9f,0x6a,0x02,0x0f,0x0e,0x00,
-0x9b,0x23,0x8f,0xf8,0xb8,0x03,0x13,0xf9,0xb8,0x03,0x1f,0xfc,0xb8,0x03,0x7b,0x01,
-0xd8,0x06,0x23,0xeb,0x60,0x3e,0x0f,0x00,0x8b,0x14,0x00,0x79,0x08,0x40,0xdc,0xef,
-0xff,0xf4,0x11,0x00,0x11,0x91,0x1c,0x09,0x11,0x02,0x3f,0x06,0x14,0x2e,0x54,0x32,
-0x10,0x05,0x58,0x2d,0x12,0x60,0x5a,0x17,0x13,0x3f,0x22,0x17,0x33,0xfa,0x5f,0xff,
-0xbb,0x30,0x23,0x6f,0xfe,0x73,0x08,0x23,0x6f,0xfe,0x61,0x2e,0x23,0x4f,0xff,0xc4,
-0x03,0x03,0x98,0x2e,0x25,0x9f,0xfb,0x3f,0x00,0x05,0x51,0x00,0x31,0x03,0xff,0xf8,
-0x80,0x02,0x50,0xb0,0x00,0x8f,0xff,0x91,0x4b,0x17,0x13,0x10,0x75,0x34,0x13,0xf4,
-0x99,0x00,0x01,0x46,0x15,0x50,0x02,0x8d,0xef,0xeb,0x60,0x50,0x38,0x31,0x02,0x8d,
-0xff,0xce,0x09,0x12,0x86,0xa8,0x2d,0x25,0x8f,0xfd,0xce,0x09,0x22,0x92,0x00,0xfb,
-0x2f,0x01,0xdc,0x05,0x23,0xf9,0x08,0xed,0x05,0x03,0xce,0x09,0x32,0x3f,0xff,0x28,
-0x92,0x03,0x04,0x68,0x01,0x0d,0xce,0x09,0x14,0x0c,0xce,0x09,0x33,0xdf,0xf7,0x8f,
-0xab,0x1e,0x10,0x58,0x11,0x00,0x00,0x13,0x09,0x02,0xf2,0x13,0x33,0x9f,0xfe,0x08,
-0x67,0x1b,0x41,0x80,0x8f,0xff,0xf7,0x17,0x11,0x00,0x92,0x03,0x10,0xcc,0x0c,0x30,
-0x33,0x8f,0xfb,0x7f,0xce,0x09,0x21,0xb0,0x28,0xce,0x09,0x2f,0x8f,0xfb,0x3c,0x04,
-0x2f,0x00,0x28,0x07,0x20,0xfe,0xa4,0x05,0x0d,0x10,0x3e,0x1a,0x0b,0x11,0x6f,0x24,
-0x09,0x10,0xdd,0xb4,0x0b,0x10,0x0c,0x4a,0x03,0x32,0x6f,0xff,0xfb,0x49,0x1c,0x32,
-0x3f,0xff,0xb0,0x43,0x2b,0x1e,0x9f,0x24,0x09,0x1f,0x4f,0x24,0x09,0x17,0x19,0xff,
-0x24,0x09,0x13,0x09,0x24,0x09,0x00,0x2a,0x3d,0x30,0xcf,0xff,0x70,0x36,0x10,0x30,
-0xb0,0x02,0xef,0x12,0x0a,0x22,0xff,0xfb,0x9c,0x2f,0x12,0xa9,0x24,0x09,0x4f,0xea,
-0x40,0x8f,0xfb,0x28,0x05,0x31,0xa0,0x8f,0xfa,0x04,0xbe,0xfa,0x8f,0xfa,0x7f,0xff,
-0xfa,0xa3,0x0b,0x61,0xfa,0x8f,0xff,0xfe,0x75,0x43,0x24,0x03,0x01,0x21,0x03,0x01,
-0x31,0x00,0x0f,0x05,0x00,0x2d,0x00,0x2a,0x09,0x11,0xcf,0x2a,0x09,0x01,0x79,0x34,
-0x10,0xe5,0x5c,0x00,0x60,0xfd,0xcf,0xff,0xff,0x50,0x02,0xef,0x2b,0x31,0x5e,0xff,
-0xe1,0xfa,0x0c,0x32,0x02,0xff,0xf6,0x50,0x30,0x22,0xbf,0xf8,0x0a,0x0d,0x30,0x01,
-0x10,0x04,0xe6,0x07,0x02,0x2a,0x03,0x23,0xfd,0x84,0x7a,0x3e,0x01,0x8e,0x2e,0x34,
-0x00,0x17,0xcf,0x1c,0x1c,0x43,0x48,0xdf,0xff,0xc0,0xcd,0x0e,0x32,0xf6,0x15,0x54,
-0xa6,0x1c,0x02,0xd6,0x09,0x13,0x8f,0x0d,0x16,0xa3,0xbf,0xfa,0x08,0xff,0xf9,0x10,
-0x00,0x19,0xff,0xf4,0xc3,0x09,0x12,0xa0,0x39,0x40,0x00,0xed,0x05,0x52,0x38,0xce,
-0xff,0xc8,0x20,0x2b,0x3f,0x03,0x9b,0x31,0x0b,0x0b,0x00,0x11,0x0d,0xcc,0x2d,0x01,
-0x6f,0x0d,0x6e,0x68,0x99,0xcf,0xff,0x99,0x94,0x2c,0x00,0x0f,0x0b,0x00,0x19,0x24,
-0x5f,0xfe,0xeb,0x15,0x00,0x75,0x27,0x01,0xc0,0x12,0x10,0xee,0x2c,0x0e,0x00,0x8e,
-0x03,0x62,0x04,0xcf,0xfd,0x50,0x9f,0xfa,0xfc,0x0c,0x0f,0x08,0x00,0x55,0x22,0x7f,
-0xfd,0xbc,0x12,0x01,0xae,0x1d,0x10,0x0a,0xae,0x1b,0x10,0xd3,0xe7,0x19,0x22,0xf6,
-0x07,0x24,0x25,0x11,0xf6,0x51,0x06,0xb1,0xf6,0xcf,0xf6,0x00,0x04,0xbe,0xfe,0xc8,
-0x20,0xbf,0xf6,0xb3,0x38,0x00,0x3c,0x2b,0x22,0xef,0xf6,0xce,0x0c,0x00,0xc2,0x07,
-0x01,0xd7,0x00,0x23,0x3f,0xff,0x10,0x31,0x22,0xdf,0xf5,0x29,0x31,0x32,0x08,0xff,
-0xa0,0xfb,0x3c,0x23,0x2f,0xff,0x7a,0x33,0x22,0xdf,0xf4,0x42,0x31,0x00,0x77,0x10,
-0x21,0x3f,0xfd,0x42,0x36,0x01,0x7a,0x3b,0x00,0x39,0x2c,0x01,0xc4,0x3c,0x00,0x1a,
-0x00,0x21,0x2f,0xfd,0xeb,0x09,0x11,0xfe,0xda,0x3c,0x00,0x63,0x35,0x22,0xcf,0xf2,
-0x3e,0x13,0x24,0xaf,0xfd,0x7c,0x2c,0x13,0x70,0x2b,0x1f,0x13,0xf2,0x58,0x13,0x14,
-0xfc,0x96,0x2c,0x04,0xa7,0x1e,0x15,0xf2,0xe3,0x33,0x22,0xff,0xe0,0x9f,0x33,0x01,
-0x95,0x00,0x01,0xe5,0x00,0x10,0x06,0xe3,0x23,0x14,0x90,0xd8,0x16,0x20,0xaf,0xf8,
-0xf8,0x3b,0x00,0x91,0x13,0x12,0xd0,0x7a,0x36,0x21,0xff,0xf1,0x13,0x1a,0x10,0x20,
-0x4a,0x17,0x01,0xd3,0x10,0x42,0x07,0xff,0x9f,0xf6,0xf3,0x3d,0x20,0x7f,0xf9,0xc9,
-0x2e,0x21,0xff,0xb0,0x00,0x36,0x00,0x38,0x3d,0x41,0x1f,0xf9,0x0c,0xff,0xb6,0x2c,
-0x00,0x1c,0x35,0x80,0x05,0xff,0x50,0x7f,0xf5,0x00,0x1f,0xfd,0x55,0x00,0x50,0xf5,
-0x00,0xaf,0xf0,0x02,0x70,0x33,0x10,0x90,0xed,0x01,0x30,0x90,0x0e,0xfb,0x73,0x2e,
-0x20,0x9f,0xf4,0x96,0x00,0x72,0xfd,0x03,0xff,0x60,0x00,0x9f,0xf3,0x05,0x3b,0xa1,
-0xcf,0xf1,0x8f,0xf2,0x00,0x04,0xff,0x81,0xff,0xb0,0x94,0x03,0x20,0x5d,0xfd,0xd3,
-0x3a,0x02,0xce,0x3a,0x40,0x3f,0xfb,0xff,0x80,0x7e,0x0d,0x03,0x50,0x33,0x00,0x6f,
-0x08,0x13,0x05,0x72,0x22,0x11,0x0b,0x48,0x14,0x13,0x0f,0xf1,0x12,0x12,0x6f,0x34,
-0x03,0x04,0xe7,0x29,0x12,0xf5,0x8d,0x41,0x03,0xa9,0x11,0x01,0xfc,0x3d,0x15,0xfc,
-0xe5,0x2f,0x10,0x3f,0x0a,0x17,0x11,0xf8,0x7d,0x2a,0x00,0x84,0x03,0x11,0x20,0x89,
-0x1f,0x01,0x2f,0x1c,0x01,0x0b,0x39,0x31,0x04,0xff,0xf4,0x4c,0x42,0x00,0x30,0x2b,
-0x32,0x02,0xff,0xf6,0xa6,0x20,0x34,0x7c,0xff,0xc0,0xc1,0x15,0x13,0x20,0x78,0x01,
-0x14,0xf8,0xe8,0x15,0x14,0xd0,0xf9,0x13,0x14,0xe1,0xd7,0x14,0x14,0xfa,0x24,0x38,
-0x04,0xa7,0x2d,0x12,0x58,0xb4,0x00,0x22,0xcf,0xfb,0x57,0x08,0x00,0xba,0x1c,0x12,
-0x5f,0x86,0x2d,0x11,0x80,0x3d,0x19,0x30,0x00,0xbf,0xfe,0xed,0x04,0x52,0xf7,0x00,
-0x05,0xff,0xf6,0x58,0x1c,0x01,0xc9,0x27,0x00,0x9a,0x06,0x31,0x7f,0xff,0x10,0xe8,
-0x00,0x32,0x61,0xff,0xf6,0xad,0x25,0x02,0x50,0x0d,0x22,0xaf,0xfc,0x5f,0x19,0x10,
-0x0e,0x02,0x0e,0x12,0xf6,0x44,0x18,0x11,0x0b,0xb1,0x04,0x11,0xfc,0x6e,0x20,0x00,
-0xfd,0x22,0x01,0x6b,0x19,0x01,0xe6,0x34,0x00,0x68,0x0f,0x22,0x7f,0xfc,0xa4,0x0f,
-0x02,0x60,0x3a,0x21,0xff,0xf5,0x22,0x19,0x00,0x11,0x35,0x22,0x5f,0xfc,0xbe,0x0f,
-0x01,0xd6,0x3f,0x00,0xce,0x02,0x22,0xef,0xf1,0xb6,0x14,0x05,0x5e,0x31,0x03,0x53,
-0x02,0x15,0xef,0x48,0x13,0x14,0xfc,0xf3,0x00,0x03,0x6c,0x02,0x03,0xb4,0x2e,0x02,
-0x66,0x01,0x01,0xc2,0x02,0x04,0xef,0x39,0x13,0xf2,0x0b,0x10,0x12,0xfc,0x26,0x13,
-0x33,0x6f,0xff,0x40,0x44,0x0a,0x13,0xb0,0x41,0x33,0x12,0xd1,0x80,0x33,0x37,0xfd,
-0x80,0x00,0x93,0x15,0x14,0xf2,0x08,0x00,0x10,0x3c,0xa8,0x0e,0x38,0xcf,0xff,0xe0,
-0x04,0x15,0x13,0x03,0x0b,0x18,0x13,0x0d,0x7a,0x01,0x12,0x9f,0x1e,0x02,0x13,0x05,
-0x4e,0x16,0x13,0x1e,0x0a,0x05,0x33,0xbf,0xfe,0x10,0xbe,0x17,0x03,0xe4,0x0e,0x12,
-0x90,0x92,0x00,0x19,0xfd,0xb1,0x15,0x03,0xc3,0x00,0x04,0x90,0x15,0x33,0x0b,0xff,
-0xf1,0xcc,0x10,0x10,0xeb,0xd9,0x12,0x23,0xb7,0x7f,0x0b,0x1d,0x04,0x08,0x00,0x05,
-0x1b,0x0c,0x21,0x08,0xe4,0xc4,0x12,0x10,0xa0,0x42,0x00,0x11,0xa2,0xc6,0x2e,0x00,
-0x6b,0x00,0x11,0xe0,0x9b,0x38,0x04,0xc4,0x32,0x02,0xa6,0x1a,0x01,0x7f,0x08,0x02,
-0x6c,0x36,0x09,0x0b,0x00,0x01,0x19,0x11,0x14,0xf0,0xee,0x38,0x00,0x6c,0x17,0x21,
-0x09,0xdf,0xc7,0x19,0x02,0x1d,0x40,0x10,0xfe,0x11,0x11,0x02,0xc4,0x00,0x12,0xdf,
-0x34,0x02,0x02,0xbc,0x02,0x02,0xe0,0x09,0x0e,0x58,0x00,0x03,0x6e,0x00,0x02,0xde,
-0x35,0x01,0x98,0x04,0x02,0x92,0x1a,0x11,0x3f,0x72,0x01,0x13,0x8f,0x01,0x13,0x10,
-0x90,0x65,0x2a,0x11,0xf6,0x95,0x11,0x4f,0x10,0xef,0xbe,0xfb,0x03,0x00,0x18,0x22,
-0xb7,0x85,0x7f,0x16,0x24,0xe9,0x10,0x8a,0x01,0x10,0x01,0x45,0x0b,0x00,0x0c,0x00,
-0x14,0x20,0x0e,0x1b,0x02,0xa4,0x00,0x02,0xd4,0x07,0x03,0x5d,0x27,0x14,0x40,0xee,
-0x11,0x07,0x0b,0x00,0x02,0xbb,0x39,0x22,0xdf,0xf6,0xe9,0x07,0x02,0xa8,0x1c,0x01,
-0xc4,0x03,0x11,0xda,0x91,0x01,0x11,0xf0,0xf6,0x22,0x00,0xe0,0x01,0x14,0xc4,0x53,
-0x00,0x25,0xbf,0xf8,0x3d,0x10,0x0c,0x4d,0x00,0x07,0x0b,0x00,0x01,0x75,0x0f,0x07,
-0x54,0x01,0x01,0x87,0x1c,0x10,0x3e,0xa4,0x01,0x11,0x7f,0xef,0x0a,0x11,0xfe,0x5b,
-0x37,0x03,0x88,0x18,0x30,0xcf,0xfc,0x70,0x06,0x01,0x33,0x88,0x10,0x0b,0x6c,0x3c,
-0x31,0xaf,0xf1,0x09,0xd4,0x22,0x00,0x77,0x05,0x00,0xf8,0x03,0x90,0x5e,0xff,0xf9,
-0x10,0x3c,0xff,0x80,0x7f,0xf8,0x07,0x2e,0x00,0xb9,0x19,0x12,0x0a,0x15,0x42,0x00,
-0x8e,0x33,0x20,0x46,0x60,0x88,0x02,0x3f,0xae,0xfe,0x91,0x5e,0x34,0x05,0x1a,0x55,
-0x0f,0x00,0x19,0xdd,0x0e,0x00,0x16,0x06,0x6d,0x1e,0x02,0xba,0x13,0x28,0xe0,0x00,
-0x75,0x0e,0x06,0x16,0x19,0x02,0x75,0x03,0x17,0xfe,0x0e,0x00,0x14,0x07,0x38,0x45,
-0x05,0x83,0x32,0x05,0x22,0x18,0x01,0xe6,0x01,0x16,0xbc,0xa8,0x1c,0x00,0x43,0x1b,
-0x10,0x33,0x08,0x44,0x05,0xa3,0x18,0x13,0xfa,0xf7,0x15,0x03,0xb8,0x04,0x35,0xf2,
-0x00,0x2f,0x7c,0x18,0x01,0x1a,0x00,0x15,0x09,0xe0,0x02,0x10,0x03,0x38,0x00,0x15,
-0x01,0xd7,0x1a,0x11,0x0b,0x56,0x00,0x14,0x8f,0x2f,0x09,0x11,0x3f,0x74,0x00,0x14,
-0x1f,0xf3,0x18,0x11,0xcf,0x92,0x00,0x13,0x07,0x15,0x04,0x13,0x04,0xb0,0x00,0x03,
-0xfc,0x04,0x33,0x0d,0xff,0xf6,0xa1,0x05,0x18,0xd0,0xe8,0x19,0x12,0x0d,0x96,0x03,
-0x02,0x9a,0x2c,0x00,0xbc,0x03,0x18,0xfd,0xc4,0x06,0x20,0x00,0xcf,0x22,0x01,0x17,
-0x0e,0x71,0x19,0x10,0xe0,0x18,0x01,0x22,0xd2,0x22,0x01,0x00,0x37,0x2d,0xff,0xf7,
-0x9c,0x48,0x00,0xa6,0x0b,0x38,0x10,0x08,0xff,0x01,0x00,0x29,0x80,0x1f,0x0f,0x00,
-0x29,0xf1,0x9f,0x0f,0x00,0x15,0xf9,0x22,0x01,0x49,0x28,0xcd,0xb7,0x10,0x5b,0x01,
-0x17,0xe5,0x4b,0x01,0x15,0xff,0xcd,0x28,0x00,0xa8,0x2a,0x23,0x64,0x7e,0xdf,0x05,
-0x70,0x47,0x81,0x0a,0xff,0xe1,0x00,0x02,0xa5,0x01,0x00,0x2a,0x38,0x02,0xf5,0x0a,
-0x12,0x9f,0x57,0x16,0x00,0x41,0x16,0x11,0x40,0xee,0x09,0x00,0xa7,0x13,0x21,0xfc,
-0x81,0x0c,0x1a,0x10,0xbf,0xc4,0x49,0x02,0x7d,0x0e,0x11,0xf4,0xf8,0x32,0x10,0x09,
-0x97,0x23,0x00,0x53,0x08,0x21,0xb9,0xcf,0x3a,0x1b,0x00,0xa6,0x03,0x00,0x5b,0x09,
-0x00,0x20,0x32,0x02,0xb4,0x2a,0x12,0xff,0xf0,0x40,0x11,0x06,0x25,0x01,0x11,0x03,
-0x79,0x04,0x22,0x14,0x20,0xf8,0x05,0x11,0x06,0x7b,0x0c,0x22,0xaf,0xf2,0xcc,0x12,
-0x11,0x09,0x28,0x00,0x43,0xdf,0xf6,0x3f,0xff,0x69,0x1c,0x10,0xf9,0x4e,0x1f,0x02,
-0xac,0x3b,0x02,0x43,0x04,0x42,0x6f,0xfc,0x6f,0xfc,0x2a,0x02,0x11,0xb1,0xc6,0x3b,
-0x02,0x1c,0x00,0x22,0x4f,0xf7,0x0c,0x3a,0x02,0x38,0x00,0x22,0x7d,0x30,0x05,0x0b,
-0x02,0xc6,0x24,0x13,0x50,0xc9,0x24,0x05,0x89,0x3b,0x01,0x54,0x16,0x04,0xab,0x24,
-0x02,0xd8,0x0c,0x14,0x01,0x1c,0x20,0x02,0xc1,0x09,0x04,0x78,0x1d,0x02,0xd4,0x3d,
-0x34,0x0c,0xff,0xf8,0x80,0x24,0x11,0xf4,0x39,0x48,0x22,0xc4,0x00,0x0a,0x39,0x12,
-0x70,0xc9,0x3a,0x43,0xd8,0x53,0x34,0x6a,0xb2,0x24,0x25,0x01,0xbf,0x2b,0x34,0x03,
-0xe9,0x22,0x01,0xbf,0x01,0x05,0x82,0x37,0x4f,0xff,0xff,0xda,0x50,0xea,0x39,0x12,
-0x04,0x13,0x3f,0x16,0x30,0xb3,0x00,0x05,0x17,0x25,0x00,0x01,0x00,0x12,0x71,0x54,
-0x27,0x32,0xc0,0x01,0xd9,0xd1,0x02,0x12,0xfd,0x32,0x02,0x02,0x55,0x01,0x00,0xee,
-0x01,0x30,0xd2,0x00,0xbf,0x2f,0x00,0x12,0xbf,0xa0,0x02,0x50,0x2e,0xff,0xf7,0x00,
-0x1e,0xa9,0x19,0x30,0xcf,0xfe,0x20,0x4c,0x26,0x20,0x02,0xef,0xc6,0x3e,0x00,0xa8,
-0x49,0x30,0xf3,0x4c,0xf1,0x04,0x09,0x14,0x47,0x9f,0x36,0x30,0x4c,0xff,0xf8,0x8c,
-0x02,0x01,0xd2,0x1e,0x11,0xc0,0x68,0x01,0x33,0xfe,0x00,0x02,0x06,0x1e,0x11,0x20,
-0xa2,0x01,0x56,0x91,0x00,0x00,0x06,0xdf,0x1d,0x39,0x68,0x92,0x13,0x20,0x05,0x76,
-0x54,0xb4,0x03,0x27,0xd0,0x0f,0x93,0x02,0x00,0x23,0x2a,0x06,0x62,0x2b,0x01,0x20,
-0x00,0x0a,0x10,0x00,0x66,0x39,0x75,0x30,0x00,0x12,0x42,0x10,0x00,0x57,0x6c,0x73,
-0x00,0x01,0x7c,0x74,0x49,0x10,0xcf,0xda,0x09,0x05,0xa5,0x36,0x00,0x4c,0x02,0x36,
-0xa0,0x04,0xff,0x71,0x04,0x84,0x01,0xae,0xff,0x50,0x00,0xee,0x94,0x71,0x10,0x00,
-0x85,0x1d,0x80,0x26,0x00,0x00,0x10,0x1c,0xfb,0xa5,0x30,0x21,0xfc,0x20,0x5c,0x3e,
-0x15,0x80,0x09,0x04,0x11,0xe0,0xf7,0x08,0x21,0x68,0x10,0x3e,0x00,0x21,0xa9,0x5e,
-0xc6,0x01,0x42,0xaf,0xe3,0x8f,0xf8,0x99,0x03,0x21,0x41,0xca,0x3c,0x03,0x75,0x11,
-0xff,0xfe,0x5b,0x96,0x29,0xce,0xc7,0x1d,0x85,0x09,0xff,0xf6,0x9f,0xff,0x5f,0xff,
-0x4a,0xfa,0x1e,0x84,0xef,0xd0,0xbf,0xfd,0x1f,0xff,0x81,0xee,0x89,0x00,0x86,0x19,
-0x40,0xef,0xfa,0x0e,0xff,0xb0,0x31,0xb9,0x00,0x4f,0xad,0xf7,0x0a,0xea,0xb1,0x39,
-0x06,0x29,0x05,0x20,0x0f,0x00,0x10,0x01,0x45,0x0b,0x45,0x13,0x43,0x20,0x00,0x0b,
-0x1d,0x30,0xff,0x45,0xae,0xe3,0x16,0x06,0x0d,0x4b,0x15,0xff,0xd6,0x30,0x00,0x19,
-0x03,0x22,0xf9,0xef,0x91,0x35,0x23,0xff,0xe3,0xed,0x04,0x10,0x2e,0x75,0x0d,0x21,
-0x03,0x8e,0x1a,0x01,0x52,0x09,0xff,0xf9,0x00,0x02,0xf2,0x1d,0x10,0x7f,0xaf,0x04,
-0x10,0x2f,0x93,0x03,0x11,0x1d,0x95,0x01,0x10,0x03,0x53,0x2a,0x31,0x0e,0xff,0xf7,
-0xc8,0x02,0x11,0xa0,0x1a,0x02,0x13,0xe0,0x1f,0x01,0x11,0x1c,0x2e,0x05,0x10,0x03,
-0x1c,0x00,0x12,0x1f,0x4f,0x0a,0x21,0xff,0x10,0x70,0x31,0x10,0x10,0x1c,0x20,0x13,
-0x90,0xd4,0x04,0x01,0xf9,0x16,0x10,0x8f,0x3a,0x08,0x34,0x4f,0xff,0xe2,0x75,0x0e,
-0x52,0xdf,0xf7,0xbf,0xff,0xb4,0x0f,0x36,0x02,0x97,0x4c,0x22,0xf3,0x0b,0xcd,0x4c,
-0x02,0x32,0x1c,0x00,0x9a,0x09,0x15,0xaf,0xcc,0x02,0x20,0xff,0xf3,0x5c,0x1c,0x02,
-0x91,0x2f,0x02,0xe2,0x17,0x01,0x8f,0x48,0x34,0x6a,0x30,0x00,0x20,0x00,0x05,0x91,
-0x3d,0x04,0x38,0x38,0x02,0xa7,0x21,0x06,0x8e,0x19,0x04,0x23,0x23,0x04,0x50,0x16,
-0x16,0x1f,0x28,0x03,0x01,0x52,0x4a,0x17,0x0a,0x4b,0x39,0x00,0x61,0x0c,0x16,0x02,
-0x39,0x03,0x01,0x1c,0x0b,0x07,0x77,0x26,0x11,0x4f,0x31,0x03,0x14,0x0c,0x21,0x00,
-0x12,0x06,0x06,0x33,0x22,0x01,0xef,0xe5,0x03,0x13,0x03,0x8f,0x0c,0x00,0x32,0x07,
-0x53,0xd9,0x54,0x34,0x58,0xcf,0xe5,0x00,0x03,0x50,0x05,0x03,0xbc,0x2b,0x07,0x80,
-0x39,0x26,0xb3,0x00,0x81,0x39,0x45,0xce,0xff,0xda,0x61,0x0e,0x00,0x14,0xbb,0x01,
-0x00,0x16,0xa0,0xed,0x2b,0x02,0x31,0x1c,0x06,0xc7,0x38,0x03,0xd5,0x17,0x06,0x3d,
-0x48,0x00,0x9f,0x00,0x17,0xf2,0x03,0x3c,0x33,0x9f,0xff,0xc0,0xec,0x23,0x02,0x92,
-0x06,0x15,0x50,0x8d,0x40,0x00,0xd3,0x05,0x07,0xf9,0x25,0x01,0x1c,0x2a,0x05,0xc3,
-0x1a,0x33,0x0d,0xff,0xf2,0xfe,0x2b,0x02,0x21,0x01,0x12,0xe0,0x37,0x00,0x17,0xf3,
-0xaf,0x1f,0x12,0xaf,0x96,0x17,0x02,0x40,0x12,0x14,0x2c,0x37,0x19,0x20,0xcf,0xfd,
-0xc5,0x3f,0x00,0x42,0x03,0x02,0x0c,0x38,0x14,0x30,0xa0,0x21,0x01,0xc2,0x00,0x44,
-0x90,0x01,0xff,0xe3,0x34,0x05,0x46,0xfa,0xff,0xd0,0x07,0x30,0x0c,0x43,0x41,0xff,
-0x80,0x0d,0xf4,0x1f,0x10,0x06,0xaa,0x44,0x22,0x30,0x3f,0xfe,0x01,0x00,0x15,0x25,
-0x51,0x08,0xfe,0x00,0x9f,0xbc,0x50,0x04,0x00,0xe0,0x08,0x73,0x0c,0xf9,0x00,0xef,
-0x46,0xff,0xc0,0xfd,0x39,0x42,0x0f,0xf4,0x05,0xfc,0xa2,0x42,0x00,0x0e,0x00,0x42,
-0x3f,0xe0,0x08,0x93,0x9e,0x1e,0x00,0x3b,0x46,0x20,0x49,0x50,0x76,0x00,0x26,0xc0,
-0x00,0x7d,0x45,0x03,0xe0,0x0b,0x36,0x06,0xff,0xe1,0x34,0x3d,0x00,0xc3,0x20,0x10,
-0x10,0xe7,0x02,0x14,0xfa,0x2d,0x20,0x44,0xe7,0x20,0x03,0x9f,0x4e,0x46,0x03,0x56,
-0x07,0x04,0x96,0x03,0x01,0xf4,0x45,0x15,0xd3,0xb2,0x01,0x48,0x7c,0xff,0xff,0xb6,
-0x51,0x3d,0x18,0x20,0xe3,0x08,0x55,0x88,0x88,0x88,0x88,0x80,0x00,0x23,0x00,0xa5,
-0x1d,0x0f,0x0c,0x00,0x08,0x31,0x11,0x11,0x1c,0x59,0x36,0x46,0x33,0x44,0x51,0xdf,
-0xa8,0x07,0x30,0xfc,0xff,0xff,0xd6,0x2c,0x00,0x57,0x2c,0x26,0xcd,0xfd,0xd2,0x04,
-0x18,0x02,0x0c,0x00,0x1b,0xfe,0x0c,0x00,0x62,0x23,0x33,0x33,0x33,0x33,0x31,0x0c,
-0x00,0x12,0xef,0xed,0x07,0x0a,0x0c,0x00,0x1a,0xef,0x0c,0x00,0x05,0x3c,0x00,0x2f,
-0xef,0x30,0x0c,0x00,0x06,0x10,0x33,0x01,0x00,0x65,0x32,0x00,0x02,0xff,0xef,0x30,
-0x3c,0x00,0x0f,0x0c,0x00,0x09,0x05,0x82,0x06,0x26,0xdf,0x30,0x95,0x03,0x27,0xdf,
-0x40,0x0c,0x00,0xc7,0x51,0x11,0x12,0x22,0x22,0x22,0x23,0x33,0x33,0x35,0xff,0xdf,
-0x99,0x08,0x11,0x9f,0xb0,0x16,0x10,0xff,0xcc,0x3a,0x1f,0xb8,0x38,0x01,0x12,0x0a,
-0x0c,0x00,0x12,0x01,0xa0,0x45,0x0f,0xf0,0x3e,0x05,0x54,0x8b,0xef,0xff,0xeb,0x72,
-0xd3,0x3c,0x12,0xcf,0x60,0x35,0x18,0x50,0x85,0x07,0x34,0xf4,0xcd,0x30,0x98,0x1f,
-0x00,0x8d,0x01,0x22,0xcf,0xf8,0xb5,0x2f,0xb5,0xd7,0x42,0x23,0x59,0xdf,0x80,0xcf,
-0xff,0xd4,0x00,0x3f,0x21,0x09,0x55,0xcf,0x9d,0xff,0xa1,0xdf,0x2e,0x0a,0x34,0xcf,
-0x50,0x8f,0x80,0x2d,0x01,0x0e,0x00,0x36,0x02,0xcf,0xff,0xeb,0x36,0x14,0x50,0x0f,
-0x42,0x03,0x0e,0x00,0x25,0x00,0x1a,0x43,0x02,0x12,0xcf,0x5f,0x3b,0x16,0x90,0x0e,
-0x00,0x00,0xe8,0x14,0x17,0x40,0x0e,0x00,0x38,0x03,0xdf,0xfa,0x0e,0x00,0x27,0xef,
-0xf5,0x0e,0x00,0x36,0x6f,0xfc,0x20,0x0e,0x00,0x18,0x0a,0x46,0x00,0x37,0x02,0xdf,
-0xf5,0x62,0x00,0x36,0x5f,0xfd,0x20,0x0e,0x00,0x03,0xa6,0x27,0x05,0xa8,0x00,0x16,
-0xf1,0x0e,0x00,0x27,0x4e,0xff,0xb6,0x00,0x36,0x58,0xff,0xca,0x88,0x08,0x45,0xcf,
-0xef,0xf9,0x00,0x87,0x48,0x00,0x96,0x34,0x00,0x0a,0x01,0x13,0xd4,0x0e,0x00,0x12,
-0xd2,0x26,0x01,0x74,0xd8,0x42,0x13,0x59,0xef,0x80,0xc9,0x70,0x50,0x01,0xbd,0x0e,
-0x18,0x30,0x5e,0x01,0x19,0xf2,0x7a,0x01,0x05,0xe3,0x08,0x00,0x96,0x01,0x1c,0x61,
-0xf2,0x42,0x16,0xdd,0x01,0x00,0x37,0xd7,0x4f,0xff,0x12,0x03,0x34,0x4f,0xc0,0x03,
-0x4a,0x00,0x54,0x01,0xfd,0x4f,0xc0,0x02,0xfe,0x0b,0x07,0x0d,0x00,0x62,0x28,0x99,
-0x9a,0xfd,0x4f,0xc0,0x93,0x08,0x00,0x1f,0x0a,0x00,0x0d,0x00,0x63,0x01,0x11,0x00,
-0x00,0x06,0xef,0x0d,0x00,0x20,0x00,0x00,0x77,0x44,0x03,0x0d,0x00,0x54,0x25,0x55,
-0x30,0x2e,0xff,0x0d,0x00,0x00,0x83,0x06,0x13,0x7e,0x0d,0x00,0x11,0x01,0x5d,0x32,
-0x18,0x7f,0x0d,0x00,0x27,0x01,0x8f,0x0d,0x00,0x03,0x75,0x00,0x46,0x00,0xcf,0xff,
-0xd1,0x0d,0x00,0x05,0xe3,0x02,0x0d,0x0d,0x00,0x36,0x46,0x66,0x40,0x0d,0x00,0x04,
-0xeb,0x06,0x1c,0x01,0x4e,0x00,0x0c,0x0d,0x00,0x1f,0xf3,0x68,0x00,0x1e,0x38,0xbf,
-0xff,0xe2,0x68,0x00,0x1f,0xf6,0x0d,0x00,0x13,0x14,0xf5,0x0d,0x00,0x08,0x6c,0x01,
-0x26,0x1d,0xee,0x01,0x00,0x12,0xe8,0xad,0x01,0x56,0x7a,0xcd,0xdc,0xa7,0x30,0xe4,
-0x04,0x01,0xbc,0x03,0x03,0x36,0x54,0x04,0x89,0x2f,0x01,0x98,0x3e,0x04,0xf2,0x06,
-0x41,0xcf,0xf3,0x5f,0xf9,0xda,0x45,0x02,0xab,0x0b,0x63,0x92,0x1f,0xf0,0x4f,0xe0,
-0x06,0x1d,0x0a,0x40,0x8f,0xff,0xd3,0x00,0x10,0x00,0x21,0x00,0x1b,0x44,0x06,0x10,
-0x05,0x15,0x0c,0x01,0x10,0x00,0x20,0x00,0xaf,0xa8,0x06,0x10,0x0e,0xf0,0x00,0x11,
-0x2f,0x10,0x00,0x12,0x0c,0xfe,0x0c,0x14,0x20,0x10,0x00,0x01,0xdc,0x46,0x01,0xbe,
-0x4b,0x02,0x10,0x00,0x00,0x24,0x2b,0x02,0x6b,0x27,0x02,0x10,0x00,0x00,0x29,0x0f,
-0x04,0x58,0x0f,0x00,0x1d,0x06,0x00,0xc9,0x50,0x02,0x12,0x23,0x11,0x1f,0x55,0x29,
-0x00,0x84,0x50,0x02,0x27,0x10,0x51,0x01,0x44,0x44,0x00,0x10,0x2f,0x2b,0x11,0x0f,
-0x42,0x10,0x00,0xe0,0x0e,0x00,0x58,0x00,0x03,0x10,0x00,0x20,0x4e,0xf9,0x12,0x07,
-0x13,0xd3,0x10,0x00,0x00,0x7b,0x0c,0x90,0x70,0x02,0xff,0xbe,0xff,0x80,0x00,0xff,
-0xf0,0x81,0x40,0xf0,0x1e,0x9f,0xfb,0x9f,0xf5,0x0a,0xff,0x21,0xaf,0xfc,0x23,0xff,
-0xd0,0x0b,0xff,0x70,0x1b,0xff,0x90,0x4f,0xfa,0x07,0xff,0xe4,0x05,0xff,0xfb,0xff,
-0xb0,0x06,0xff,0xd2,0xdf,0xf6,0x06,0xff,0xd2,0x00,0x4d,0xff,0x90,0x1b,0xff,0xff,
-0x60,0x01,0x47,0x06,0x21,0x9f,0xfb,0x55,0x13,0x10,0x30,0x54,0x17,0x32,0x9f,0xff,
-0xe2,0xbf,0x4b,0x50,0x03,0xdf,0xf8,0xcf,0xfa,0x9b,0x00,0x34,0x81,0xdf,0xf6,0x75,
-0x06,0x10,0xf2,0x6f,0x07,0x14,0xfe,0x78,0x06,0x12,0x6f,0x73,0x0a,0x24,0xff,0xf2,
-0xd1,0x08,0x03,0x33,0x19,0x12,0xfc,0x73,0x28,0x14,0xaf,0xf0,0x11,0x96,0xff,0xfb,
-0x51,0x00,0x00,0x05,0x9f,0xff,0xfb,0xbd,0x06,0x27,0xfd,0xdf,0x6c,0x03,0x13,0x2a,
-0xe1,0x2e,0x05,0xc1,0x01,0x00,0x3f,0x17,0x28,0xfc,0x71,0x7a,0x03,0x26,0x24,0x42,
-0x4f,0x02,0x38,0x7a,0xcc,0x95,0x5e,0x42,0x01,0x53,0x1c,0x05,0xa2,0x03,0x01,0x4a,
-0x00,0x07,0x7c,0x55,0x35,0xa4,0x23,0x6d,0xae,0x0e,0x02,0x7c,0x4d,0x29,0xaf,0xfe,
-0x5b,0x2e,0x04,0x9b,0x2c,0x03,0x7d,0x26,0x01,0xf2,0x41,0x10,0x12,0xb1,0x56,0x12,
-0xf8,0xc5,0x09,0x30,0xf0,0x00,0x7e,0x9b,0x1b,0x22,0x7f,0xf6,0x95,0x07,0x21,0xf0,
-0x1c,0xbe,0x0c,0x04,0x1e,0x00,0x21,0xe0,0xcf,0xf7,0x0d,0x13,0x3f,0x51,0x2b,0x12,
-0xc6,0xd7,0x0e,0x02,0x11,0x11,0x32,0x0c,0xff,0x6c,0x02,0x4c,0x04,0x78,0x00,0x13,
-0x0f,0xab,0x12,0x74,0xcf,0xff,0x93,0x01,0x5d,0xff,0xf4,0x0f,0x00,0x12,0x0c,0xb4,
-0x00,0x12,0x0d,0xc6,0x37,0x03,0x92,0x09,0x24,0x94,0x08,0x48,0x57,0x02,0x56,0x09,
-0x12,0xc8,0x66,0x09,0x00,0xee,0x0a,0x44,0xfd,0xbb,0xcf,0xff,0x4e,0x33,0x53,0x0d,
-0xff,0xf7,0x10,0x01,0x0f,0x00,0x10,0xb1,0x24,0x0a,0x24,0x20,0x00,0xf4,0x25,0x50,
-0xe1,0x00,0x03,0xff,0xe2,0x01,0x0a,0x03,0x7a,0x58,0x01,0xea,0x25,0x15,0x0c,0x47,
-0x03,0x10,0x40,0x59,0x2c,0x16,0x8f,0xc0,0x09,0x47,0x4f,0xf8,0x00,0x02,0x9a,0x0f,
-0x23,0x7f,0xf4,0xfb,0x56,0x02,0x82,0x06,0x27,0x9f,0xf3,0x8a,0x30,0x47,0xff,0xf7,
-0xaf,0xf2,0x3b,0x00,0x67,0xff,0xf8,0xaf,0xfb,0xbb,0xef,0x0f,0x00,0x0a,0xd6,0x0f,
-0x10,0xf7,0x28,0x3d,0x24,0xb7,0x77,0x01,0x00,0x5d,0x72,0x02,0x22,0x22,0x22,0x05,
-0x07,0x29,0x42,0x00,0x42,0x44,0x29,0xfe,0x30,0x64,0x0c,0x05,0xc2,0x01,0x0a,0x3b,
-0x4f,0x1b,0x00,0xa7,0x4c,0x05,0x0a,0x0b,0x1a,0x60,0x8f,0x44,0x09,0xb7,0x11,0x05,
-0x68,0x4f,0x04,0xe9,0x05,0x12,0xef,0x14,0x49,0x04,0xa1,0x07,0x11,0x3e,0x41,0x0a,
-0x13,0x3f,0xbd,0x00,0x47,0xee,0xef,0xff,0xfb,0x0f,0x00,0x03,0x9a,0x44,0x08,0x0f,
-0x00,0x28,0xfd,0x10,0x0f,0x00,0x00,0xf9,0x36,0x23,0x15,0x55,0x01,0x00,0x7b,0x56,
-0x66,0x66,0x66,0x64,0x00,0x00,0xfb,0x07,0x18,0x7f,0x2e,0x00,0x13,0xf3,0x30,0x59,
-0x15,0xff,0x8c,0x06,0x1a,0x4f,0x0f,0x00,0x19,0x04,0x0f,0x00,0x00,0x9f,0x00,0xa3,
-0xe4,0x44,0x45,0x55,0x66,0x66,0x77,0x78,0x88,0x91,0xb0,0x33,0x08,0x01,0x00,0x00,
-0x99,0x56,0x09,0x8f,0x0d,0x1a,0xfc,0xc1,0x06,0x06,0x58,0x45,0x03,0xac,0x32,0x09,
-0x9c,0x00,0x1b,0x0b,0x1f,0x00,0x2b,0xaf,0xfd,0xba,0x45,0x19,0x70,0x1f,0x00,0x1f,
-0x99,0xf7,0x0f,0x08,0x3a,0xbc,0xb9,0x63,0x2d,0x13,0x27,0xff,0xfa,0xb5,0x01,0x33,
-0x46,0x7a,0xdf,0xb1,0x49,0x04,0xa9,0x00,0x17,0x5b,0xb6,0x03,0x10,0x21,0x03,0x04,
-0x25,0xef,0xfd,0xbb,0x2d,0x33,0xfe,0xa7,0x20,0xb3,0x24,0x03,0x4b,0x00,0x44,0xfc,
-0x50,0x00,0x1b,0xf4,0x12,0x30,0x01,0x35,0x9d,0xeb,0x05,0x26,0x7f,0x90,0x89,0x0f,
-0x43,0xff,0xfb,0x20,0x02,0x0c,0x00,0x20,0x54,0x20,0x2f,0x34,0x25,0xf5,0x00,0x4b,
-0x00,0x56,0xa4,0x00,0x00,0x3d,0xe4,0x9b,0x59,0x00,0x47,0x49,0x06,0xe4,0x00,0x46,
-0x15,0x9f,0xff,0xc3,0x94,0x00,0x57,0x11,0x00,0x00,0x7e,0xf6,0xf2,0x10,0x44,0xfd,
-0xa3,0x01,0x20,0x52,0x06,0x45,0xfd,0x61,0x02,0x6c,0x2c,0x00,0x02,0xbe,0x15,0x00,
-0xbf,0x53,0x02,0x64,0x01,0x17,0xf9,0x18,0x49,0x10,0x00,0x4b,0x12,0x33,0x07,0xa9,
-0x20,0xe2,0x13,0x10,0x08,0xd8,0x0e,0x72,0xcf,0xff,0xf3,0x00,0x3f,0xff,0xf5,0x08,
-0x06,0x50,0x10,0x07,0xff,0xff,0xfd,0x14,0x12,0x02,0x1b,0x02,0x01,0x76,0x03,0x20,
-0x10,0x0d,0x29,0x10,0x00,0x1e,0x00,0x01,0xfe,0x03,0x43,0x00,0x0d,0xff,0xfe,0xe3,
-0x46,0x12,0x04,0xec,0x44,0x12,0xf7,0xdb,0x0d,0x11,0x80,0xa5,0x09,0x03,0xdc,0x0f,
-0x01,0x62,0x0d,0x11,0x10,0x64,0x2f,0x03,0x78,0x1a,0x02,0x93,0x3b,0x14,0xf4,0xd6,
-0x58,0x10,0xd4,0x58,0x32,0x03,0xf0,0x58,0x00,0x9e,0x05,0x55,0xd9,0x89,0xcf,0xff,
-0x91,0x81,0x01,0x1c,0x7b,0xf0,0x08,0x15,0x10,0x52,0x17,0x03,0x6c,0x07,0x16,0x90,
-0x86,0x50,0x0a,0x15,0x03,0x10,0xb0,0x3d,0x05,0x01,0x8d,0x0b,0x10,0x38,0x19,0x00,
-0x02,0x0d,0x05,0x11,0x3f,0xcb,0x20,0x04,0x0c,0x00,0x00,0xf2,0x28,0x04,0x0c,0x00,
-0x44,0x00,0x8f,0xff,0xa0,0x0c,0x00,0x00,0xe1,0x0d,0x03,0x0c,0x00,0x73,0xfe,0xee,
-0xe8,0x8f,0xfd,0x3f,0xfc,0xc3,0x2f,0x42,0xf9,0x1f,0xfe,0x3f,0x52,0x4a,0x34,0x22,
-0x22,0x21,0x0c,0x00,0x02,0x7b,0x1b,0x0f,0x0c,0x00,0xa2,0x14,0xff,0xb2,0x08,0x37,
-0xef,0xfe,0x3f,0x3d,0x04,0x17,0x0b,0x37,0x05,0x0d,0x44,0x03,0x1a,0x01,0x28,0x05,
-0x58,0x08,0xef,0xff,0xfc,0x60,0xb9,0x04,0x26,0xff,0xee,0x48,0x38,0x00,0xaf,0x48,
-0x55,0x50,0x00,0x17,0xef,0xe2,0x3d,0x00,0x01,0x95,0x5e,0x43,0x1d,0xfc,0x01,0x32,
-0x1d,0x14,0x12,0xfc,0x16,0x00,0x32,0xef,0xff,0xe8,0x67,0x16,0x13,0xf2,0x4c,0x05,
-0x12,0xef,0xc1,0x09,0x22,0x7f,0xb0,0xb1,0x11,0x32,0x60,0x00,0x7e,0x5e,0x27,0x15,
-0x70,0xa1,0x0c,0x20,0xef,0x90,0x2c,0x03,0x06,0x7b,0x00,0x01,0x79,0x5a,0x16,0xbf,
-0x0c,0x04,0x20,0x0c,0xf6,0xa8,0x04,0x03,0x81,0x03,0x92,0x14,0x83,0x00,0x07,0xf9,
-0x00,0x00,0x2f,0xfa,0x52,0x03,0xa0,0x8c,0xff,0xf7,0x00,0x06,0xfb,0x00,0x00,0xbf,
-0xc0,0x0e,0x00,0x11,0x9d,0x3b,0x02,0x10,0x06,0x45,0x5b,0x12,0x20,0x0e,0x00,0x30,
-0xff,0xfd,0xa5,0xdb,0x08,0x13,0x09,0x07,0x07,0x20,0xfd,0x95,0x3b,0x1b,0x10,0xf4,
-0x03,0x00,0x00,0xa9,0x15,0x21,0x86,0x30,0x68,0x08,0xa2,0xf5,0x00,0x1f,0xf0,0x00,
-0x06,0xfb,0x74,0x00,0x0a,0x37,0x0f,0x33,0xfe,0x10,0x3f,0x34,0x31,0x12,0xf6,0xa9,
-0x0f,0x13,0x90,0x6f,0x0a,0x12,0xef,0x56,0x17,0x43,0x4f,0xf0,0x2f,0xd0,0xdb,0x09,
-0x11,0xb0,0xea,0x07,0x33,0xf4,0x1f,0xf0,0x58,0x02,0x02,0xe8,0x3c,0x32,0xf6,0x0d,
-0xf4,0xe1,0x0f,0x02,0x6d,0x10,0x44,0x08,0xf7,0x08,0xfa,0x56,0x0f,0x10,0x80,0x38,
-0x00,0x21,0xf6,0x01,0x8c,0x1d,0x00,0xb0,0x06,0x10,0x70,0x71,0x00,0x36,0xf4,0x00,
-0x9f,0x9b,0x39,0x00,0xcf,0x09,0x28,0x00,0x1e,0x3a,0x05,0x66,0xbf,0xa0,0x00,0x03,
-0xef,0xe5,0x28,0x05,0x20,0xfe,0x10,0x50,0x15,0xb8,0xd7,0x43,0x33,0x34,0x44,0x45,
-0x55,0x56,0x68,0xdf,0xf3,0x69,0x11,0x02,0x9f,0x46,0x00,0xce,0x44,0x98,0xbc,0xcc,
-0xcc,0xcc,0xbb,0xbb,0xbb,0xb9,0x40,0x64,0x05,0x19,0x99,0xbd,0x06,0x3f,0x1f,0xff,
-0xa0,0x0f,0x00,0x0c,0x29,0x35,0x41,0x0f,0x00,0x28,0xbf,0xf6,0x0f,0x00,0x04,0x8f,
-0x35,0x03,0x0f,0x00,0x15,0x07,0xcd,0x31,0x00,0x24,0x1a,0x23,0xd4,0x07,0x63,0x1b,
-0x12,0x10,0x76,0x06,0x30,0x90,0x8f,0x10,0xbf,0x57,0x41,0xff,0xfd,0x81,0x02,0x90,
-0x02,0x14,0x04,0x5d,0x26,0x50,0x0b,0xff,0xe5,0x13,0xaf,0x5a,0x01,0x00,0x14,0x2e,
-0x20,0xdf,0xfa,0xd9,0x19,0x00,0xde,0x33,0x00,0x4b,0x5d,0x53,0x20,0x03,0xb8,0x2f,
-0xff,0x02,0x5c,0x01,0xc0,0x11,0x33,0x01,0x2f,0xff,0x7a,0x52,0x02,0x4d,0x1a,0x00,
-0xa3,0x29,0x01,0xef,0x19,0x22,0x4f,0xfc,0xfc,0x09,0x46,0xfb,0x89,0xff,0xfe,0xb7,
-0x53,0x13,0xcf,0x5d,0x5f,0x24,0xdf,0xf1,0xc6,0x4b,0x01,0xa6,0x0b,0x04,0xa8,0x00,
-0x13,0x3f,0x6c,0x23,0x18,0x90,0xff,0x00,0x38,0x06,0xff,0x50,0x0f,0x00,0x03,0x6d,
-0x59,0x04,0x0f,0x00,0x29,0x0b,0xff,0x2c,0x01,0x29,0x0d,0xfe,0x0f,0x00,0x29,0x0f,
-0xfd,0x0f,0x00,0x29,0x1f,0xfb,0x0f,0x00,0x29,0x2f,0xf9,0x0f,0x00,0x29,0x4f,0xf8,
-0x0f,0x00,0x29,0x5f,0xf7,0x0f,0x00,0x2a,0x7f,0xf6,0x95,0x01,0x1b,0x10,0xbd,0x03,
-0x11,0x43,0x1a,0x06,0x11,0xe4,0xd1,0x05,0xf0,0x0d,0x30,0x4f,0xf7,0x12,0xcf,0xc0,
-0x9f,0xb0,0x00,0x3f,0xf1,0xbf,0x80,0x00,0x0f,0xf2,0x9f,0xc0,0x00,0x4f,0xf0,0x3f,
-0xfb,0x57,0xff,0xa0,0x08,0xff,0x59,0x3e,0x12,0x5c,0xb1,0x1a,0x26,0x38,0x88,0xf8,
-0x08,0x02,0xea,0x33,0x04,0xcc,0x03,0x2c,0xf8,0x00,0xe6,0x36,0x09,0x0b,0x31,0x02,
-0x0a,0x0b,0x1f,0xf5,0x8e,0x17,0x0f,0x0f,0x3e,0x4d,0xff,0x21,0x13,0x00,0x28,0x32,
-0x17,0x71,0x82,0x01,0x2e,0x70,0x00,0xc5,0x4b,0x06,0x4d,0x55,0x01,0x49,0x21,0x16,
-0x10,0x46,0x09,0x1f,0xe2,0x98,0x01,0xff,0x48,0x36,0x38,0x70,0x00,0xa7,0x06,0x06,
-0x8b,0x01,0x45,0x1e,0xfd,0xff,0x80,0x03,0x0b,0x34,0xd1,0x5f,0xf6,0x54,0x03,0x34,
-0xfe,0x20,0x07,0xbd,0x0e,0x6f,0x38,0x83,0x00,0x00,0x68,0x70,0x30,0x03,0xff,0x47,
-0x34,0x00,0x00,0x32,0xa0,0x53,0x45,0xb3,0x00,0x04,0xff,0x70,0x63,0x33,0x81,0x1c,
-0xfd,0x5a,0x01,0x44,0xea,0xcf,0xff,0xff,0xba,0x35,0x34,0x30,0x06,0xff,0x7d,0x41,
-0x5f,0xdb,0x00,0x00,0x16,0x84,0x30,0x03,0xff,0x45,0x56,0x2b,0xc3,0x00,0x00,0x7c,
-0xa2,0x5e,0x15,0x02,0x1f,0x19,0x12,0xfe,0x2f,0x1b,0x04,0x68,0x55,0x1a,0xaf,0x07,
-0x0e,0x0f,0x24,0x03,0xff,0x44,0x36,0x03,0xcf,0xe9,0x52,0x06,0x35,0xfb,0xcf,0xc0,
-0x4d,0x0a,0x25,0x40,0x09,0xc9,0x07,0x35,0xed,0x00,0x03,0xfa,0x07,0x45,0xee,0x00,
-0x04,0xf8,0x8c,0x1e,0x37,0x91,0x2d,0xf3,0x63,0x1d,0x16,0x70,0x22,0x4f,0x1f,0x83,
-0xc8,0x04,0xff,0x3e,0x14,0x01,0x66,0x00,0x16,0xf0,0x92,0x23,0x03,0x01,0x00,0x07,
-0x9b,0x40,0x11,0xfc,0xb8,0x35,0x15,0xb0,0xf4,0x20,0x05,0x63,0x3c,0x04,0x1b,0x08,
-0x17,0xf7,0xcf,0x09,0x02,0x8e,0x41,0x2a,0x5f,0xfe,0x6c,0x11,0x12,0xfe,0x21,0x25,
-0x07,0x66,0x08,0x3a,0x50,0x4f,0xff,0x4a,0x21,0x29,0xc0,0x03,0x23,0x00,0x00,0x64,
-0x5c,0x05,0xdc,0x5d,0x04,0x95,0x49,0x18,0x02,0x78,0x24,0x01,0xb2,0x46,0x13,0x1f,
-0x7c,0x23,0x06,0xfe,0x12,0x08,0x71,0x0e,0x01,0xad,0x3c,0x30,0x0f,0xff,0xcb,0xd3,
-0x1d,0x12,0x60,0x56,0x00,0x15,0xf6,0x09,0x38,0x07,0x30,0x3d,0x05,0x22,0x5e,0x01,
-0xd7,0x0a,0x67,0x72,0x22,0x22,0x22,0xef,0xf5,0xac,0x00,0x03,0x85,0x6c,0x07,0x95,
-0x02,0x0a,0xe8,0x21,0x05,0xe7,0x12,0x15,0x70,0x56,0x00,0x22,0xff,0x10,0x6a,0x2f,
-0x06,0x56,0x00,0x18,0x60,0xb5,0x5c,0x06,0xc2,0x29,0x03,0x37,0x5a,0x04,0x19,0x4e,
-0x00,0xf3,0x0b,0x11,0xeb,0x83,0x1e,0x14,0xb0,0x65,0x11,0x05,0x5d,0x0d,0x04,0x02,
-0x0e,0x27,0x00,0x08,0xb6,0x01,0x0f,0x06,0x56,0xe8,0x11,0xef,0x40,0x2e,0x01,0xa5,
-0x02,0x16,0xf1,0x32,0x17,0x04,0xe8,0x03,0x35,0x48,0xdf,0xf5,0xfe,0x03,0x15,0xf9,
-0xf6,0x26,0x15,0xfa,0x23,0x0e,0x15,0xf6,0x28,0x13,0x04,0xda,0x02,0x22,0xae,0xb6,
-0x09,0x04,0x25,0x88,0x83,0xb7,0x02,0x28,0x10,0x00,0x30,0x64,0x07,0x89,0x60,0x24,
-0x00,0x1d,0x9c,0x02,0x1f,0x02,0xf1,0x5b,0x04,0x0f,0x9a,0x55,0xd7,0x02,0x33,0x02,
-0x23,0x87,0x10,0xf0,0x08,0x1b,0xf7,0x58,0x63,0x24,0x8f,0xf9,0xd6,0x23,0x13,0xa0,
-0x36,0x09,0x2f,0x87,0x00,0x32,0x01,0xef,0x14,0x02,0x05,0x01,0x00,0x08,0x34,0x02,
-0xcc,0x0b,0x23,0xdf,0xf9,0xc9,0x0b,0x12,0x24,0x49,0x04,0x20,0xbf,0xf3,0x1e,0x12,
-0x00,0x62,0x02,0x1e,0x30,0x34,0x01,0x0f,0x32,0x01,0xdd,0x00,0x24,0x39,0x32,0x06,
-0xca,0x00,0x36,0x39,0x01,0x6f,0x30,0x11,0x0b,0x84,0x6e,0x10,0x80,0xcd,0x1b,0x35,
-0x70,0x00,0x09,0x70,0x1f,0x0f,0x5b,0x02,0xec,0x20,0x28,0x88,0x5a,0x25,0x12,0xe1,
-0xf9,0x57,0x10,0x0c,0x8f,0x2f,0x00,0x0e,0x2f,0x27,0x28,0x84,0x18,0x19,0x1f,0xf9,
-0x04,0x00,0x52,0x00,0x55,0x10,0x00,0x4d,0x10,0x21,0xdf,0xf8,0x42,0x13,0x6f,0x3f,
-0xfa,0x00,0x00,0x58,0x70,0x86,0x00,0x5e,0x00,0x9c,0x20,0x12,0x70,0x1a,0x71,0x00,
-0xb5,0x05,0x10,0xfd,0x80,0x07,0xda,0xcf,0xe2,0x4f,0xf7,0x00,0x0a,0xff,0x30,0x05,
-0xff,0x50,0x28,0x84,0x96,0x00,0x06,0x63,0x49,0x0f,0x06,0x00,0x81,0x80,0x1a,0xc4,
-0x00,0x00,0x6c,0xa1,0xaf,0xff,0x8d,0x1f,0x70,0xaf,0xff,0x00,0x02,0xff,0xf9,0x3d,
-0x6c,0x49,0x1e,0xd2,0xf2,0x02,0x0f,0xc6,0x00,0x89,0x02,0xbf,0x08,0x27,0xdb,0x61,
-0xdc,0x08,0x22,0xf8,0x00,0xdb,0x3b,0x00,0x4d,0x52,0x01,0xc9,0x03,0x01,0x4d,0x42,
-0x11,0x5b,0x97,0x52,0x02,0xa5,0x42,0x00,0xbc,0x3e,0x03,0x17,0x00,0x02,0x38,0x48,
-0x03,0xa9,0x63,0x01,0xdf,0x74,0x03,0xee,0x5a,0x11,0x2f,0x4e,0x70,0x15,0xe0,0xff,
-0x00,0x03,0x17,0x00,0x11,0x09,0x06,0x62,0x13,0xe0,0xa1,0x39,0x71,0x0a,0xcc,0xef,
-0xff,0xcc,0xcc,0x30,0x18,0x4c,0x14,0xef,0xff,0x74,0x34,0x5f,0xff,0x0e,0x74,0x26,
-0x00,0x21,0x36,0x05,0x2e,0x00,0x15,0xff,0x45,0x00,0x00,0x66,0x31,0x04,0x17,0x00,
-0x25,0x9f,0xfc,0x17,0x00,0x00,0x33,0x69,0x03,0x17,0x00,0x11,0x03,0xda,0x3c,0x13,
-0xfe,0x39,0x08,0x05,0xa1,0x00,0x01,0x7d,0x47,0x25,0x8f,0xfe,0x8e,0x2e,0x00,0x17,
-0x00,0x00,0x51,0x51,0x11,0xe2,0xfd,0x00,0x01,0x82,0x50,0x16,0xd2,0xd3,0x09,0x14,
-0x90,0x14,0x01,0x37,0xfd,0xa6,0x10,0x0e,0x19,0x12,0x20,0xfa,0x21,0x43,0xb3,0x00,
-0x05,0xff,0x70,0x0a,0x45,0xf8,0x12,0xdf,0xc0,0x6a,0x10,0x11,0xf6,0x04,0x09,0x32,
-0xf2,0x00,0x6f,0x32,0x0a,0x1f,0x05,0x67,0x10,0x0a,0x0f,0xeb,0x55,0xfe,0x08,0x2b,
-0x49,0x02,0x18,0x35,0x04,0x99,0x07,0x05,0xf2,0x0b,0x05,0xab,0x42,0x03,0xbf,0x73,
-0x03,0x26,0x0b,0x1f,0x71,0x73,0x06,0x09,0x0f,0x3f,0x56,0xfb,0x03,0x9e,0x0f,0x06,
-0x79,0x5e,0x16,0xfa,0x42,0x65,0x05,0x7a,0x1a,0x26,0xfd,0x10,0xcc,0x14,0x04,0xa8,
-0x0b,0x2f,0x88,0x30,0x65,0x01,0xff,0x1c,0x25,0x2e,0xfc,0x65,0x2f,0x06,0xb4,0x4b,
-0x34,0xfe,0x5f,0xf8,0x98,0x00,0x33,0x20,0x4f,0xf6,0x16,0x05,0x3a,0x40,0x00,0x6f,
-0x7b,0x22,0x0f,0xca,0x02,0xff,0x19,0x31,0x00,0x00,0x23,0x15,0x00,0x63,0x1a,0xfe,
-0xa3,0x00,0x0c,0xf9,0x0b,0x32,0x41,0xfc,0x9c,0xff,0x60,0x59,0x00,0x24,0xc9,0xdf,
-0x2f,0x05,0x14,0xa0,0xfe,0x1a,0x2f,0x05,0x62,0x65,0x01,0xff,0x1d,0x82,0x06,0xc9,
-0x00,0x00,0x1a,0xc5,0x00,0x00,0x18,0x30,0x03,0x0b,0x54,0x00,0xef,0x0b,0x13,0x9f,
-0x59,0x41,0x5f,0xc1,0x00,0x02,0xdf,0x80,0xbf,0x02,0x11,0x00,0x54,0x00,0x15,0x82,
-0x5b,0x7d,0x01,0xe6,0x6a,0x04,0x7e,0x00,0x11,0x20,0x16,0x2f,0x21,0x41,0x01,0x6a,
-0x08,0x13,0x0e,0xba,0x7d,0x14,0xfb,0xc8,0x74,0x00,0x07,0x00,0x05,0xd2,0x00,0x24,
-0xa0,0x4f,0x7b,0x4d,0x12,0xff,0x23,0x3f,0x01,0xd9,0x65,0x06,0x11,0x01,0x16,0x7d,
-0x26,0x01,0x06,0x3b,0x01,0x1e,0x9e,0x50,0x01,0x08,0x65,0x01,0x16,0xf9,0x8f,0x01,
-0x16,0x9b,0xa4,0x01,0x24,0x8f,0xfe,0xb4,0x14,0x15,0x44,0xdb,0x6e,0x15,0xf0,0xe3,
-0x01,0x13,0xfb,0x56,0x39,0x00,0x2c,0x55,0x03,0x0d,0x02,0x00,0x3d,0x60,0x10,0x04,
-0x71,0x57,0x45,0x04,0xaf,0xff,0xe1,0x37,0x02,0x15,0xe3,0x4c,0x02,0x15,0xb1,0x61,
-0x02,0x16,0x30,0x33,0x6d,0x31,0x20,0x00,0x3f,0xb1,0x00,0x30,0x9e,0x20,0x2e,0x90,
-0x00,0x00,0xc6,0x4c,0x01,0x00,0x37,0x00,0xb5,0x38,0x11,0xcf,0xe4,0x51,0x10,0xc0,
-0x90,0x27,0x10,0x50,0x08,0x00,0x00,0x09,0x00,0x11,0x8f,0x4a,0x21,0x00,0x72,0x27,
-0x12,0xd1,0x91,0x1a,0x03,0x49,0x30,0x13,0x3f,0x6d,0x31,0x11,0x3e,0x4f,0x01,0x00,
-0xa5,0x25,0x11,0xe6,0x09,0x00,0x40,0x2e,0xff,0xf3,0x04,0xcc,0x11,0x40,0x1d,0xff,
-0xf4,0x00,0x09,0x00,0x12,0x1d,0xc5,0x61,0x32,0xfd,0x11,0xef,0x27,0x3d,0x31,0xd1,
-0x02,0xe6,0xdb,0x00,0x14,0xe1,0xee,0x79,0x07,0x72,0x20,0x14,0xb0,0x10,0x03,0x33,
-0x04,0xff,0x20,0xb6,0x01,0x35,0xf9,0x0d,0xf9,0xda,0x00,0x50,0xef,0xe1,0x00,0x00,
-0x4f,0xb7,0x01,0x11,0x5c,0x95,0x13,0x04,0x12,0x03,0x11,0x90,0x39,0x08,0x01,0x10,
-0x01,0x23,0xf3,0x00,0x30,0x01,0x00,0x41,0x2d,0x02,0xb9,0x01,0x43,0x09,0xfd,0x8f,
-0xff,0x88,0x09,0x72,0x3f,0xf4,0x3f,0xff,0x30,0xbf,0xfa,0x5d,0x21,0x52,0x0f,0xff,
-0x60,0xdf,0xf8,0x1f,0x7e,0x51,0x0d,0xff,0x80,0xef,0xf7,0x89,0x80,0x00,0x03,0x31,
-0x21,0xef,0xf7,0x1d,0x7e,0x00,0x95,0x08,0x21,0xef,0xf7,0xc6,0x80,0x00,0x0b,0x00,
-0x10,0xdf,0x79,0x33,0x11,0xf6,0xd5,0x08,0x22,0xcf,0xf8,0xfa,0x21,0x10,0x0c,0x99,
-0x08,0x41,0x00,0x05,0xff,0x20,0xe3,0x51,0x52,0x7f,0xfd,0x00,0x1e,0xf8,0xe2,0x32,
-0x52,0x3f,0xff,0x30,0x9f,0xd0,0x19,0x03,0x52,0x0e,0xff,0xa4,0xff,0x30,0xbf,0x01,
-0x44,0x06,0xff,0xfe,0xf9,0xe3,0x32,0x12,0xdf,0x99,0x40,0x00,0x63,0x01,0x16,0x2f,
-0x1b,0x03,0x16,0x0c,0xc1,0x01,0x25,0x5f,0xfc,0x1c,0x03,0x33,0xef,0x80,0x39,0xc2,
-0x01,0x26,0x08,0xfe,0x7c,0x15,0x08,0xe7,0x09,0x05,0xe8,0x51,0x01,0x60,0x3e,0x0a,
-0xc7,0x72,0x00,0x29,0x76,0x05,0x9d,0x14,0x14,0xe1,0x58,0x0a,0x0f,0x5d,0x07,0x05,
-0x0f,0x88,0x58,0xe4,0x09,0xca,0x3d,0x24,0x00,0x09,0x2b,0x33,0x15,0x03,0x1f,0x0a,
-0x02,0x92,0x7f,0x08,0x20,0x21,0x3f,0x07,0x86,0x00,0x43,0x01,0xfe,0x25,0xbf,0xf2,
-0xf5,0x16,0x13,0xe1,0x0d,0x01,0x23,0xf6,0xdf,0x6d,0x00,0x31,0xf6,0x01,0xef,0xef,
-0x12,0x00,0x92,0x2b,0x16,0xef,0xd7,0x28,0x0f,0x43,0x01,0xfb,0x62,0x3b,0xb3,0x00,
-0x00,0x8c,0x80,0x16,0x19,0x42,0x00,0x4f,0xff,0x50,0x41,0x40,0x12,0x04,0x8c,0x41,
-0x22,0xee,0x50,0xa1,0x82,0x0f,0x01,0x00,0x08,0x1f,0x08,0x30,0x01,0x86,0x05,0x13,
-0x00,0x13,0xfd,0x13,0x00,0x13,0xf7,0x48,0x08,0x22,0x8f,0xfe,0xdf,0x44,0x00,0x6b,
-0x17,0x23,0xff,0xf8,0xf7,0x07,0x02,0xe0,0x29,0x00,0xe3,0x38,0x40,0x1e,0xff,0xf8,
-0x20,0x0e,0x73,0x10,0x60,0x8e,0x19,0x21,0xed,0xef,0xf1,0x19,0x14,0x2c,0x2a,0x5f,
-0x66,0x00,0x03,0x9c,0xef,0xfd,0xb6,0x97,0x0d,0x14,0x87,0x47,0x0c,0x02,0x71,0x43,
-0x09,0x5b,0x79,0x04,0x25,0x81,0x03,0x0a,0x05,0x16,0xd1,0x2d,0x1c,0x0f,0x40,0x14,
-0x08,0x0f,0xd1,0x58,0xff,0x0c,0x05,0xd8,0x39,0x0f,0x09,0x00,0x13,0x03,0xfc,0x11,
-0x03,0xb9,0x1b,0x00,0x08,0x67,0x61,0xdc,0xcc,0xcc,0xef,0xff,0xfa,0x24,0x00,0x00,
-0xcc,0x39,0x23,0x70,0x1f,0x46,0x7d,0x22,0xf1,0x1f,0x30,0x32,0x00,0x71,0x7c,0x14,
-0x30,0x33,0x1a,0x12,0x30,0x35,0x1b,0x04,0x12,0x00,0x1a,0xf8,0x24,0x00,0x00,0xa0,
-0x50,0x04,0x48,0x00,0x20,0x80,0x1f,0x72,0x52,0x00,0xe4,0x2e,0x05,0x25,0x1c,0x14,
-0x1f,0x3f,0x71,0x0f,0xb4,0x00,0x1c,0x05,0x27,0x07,0x53,0x38,0xbb,0xa8,0x30,0x00,
-0x9f,0x1d,0x14,0xfa,0xe4,0x27,0x02,0x88,0x5c,0x53,0xf9,0x20,0x2a,0xff,0xf6,0x94,
-0x43,0x10,0xbf,0x2a,0x2c,0x04,0x7f,0x84,0x03,0xe2,0x7c,0x03,0x90,0x49,0x24,0x3f,
-0xfe,0xca,0x83,0x13,0xfb,0x31,0x42,0x22,0xef,0xf6,0x09,0x00,0x01,0x57,0x0a,0x23,
-0x9f,0xfb,0xa6,0x5e,0x23,0x9f,0xfb,0xbd,0x48,0x23,0x9f,0xfb,0x0a,0x05,0x09,0x12,
-0x00,0x11,0x2f,0x0d,0x53,0x01,0xf3,0x3f,0x03,0x3f,0x00,0x20,0x01,0xdf,0x1d,0x0b,
-0x13,0xfb,0xa5,0x2d,0x22,0x9f,0xfb,0xe8,0x10,0x11,0x80,0x09,0x00,0x00,0x7e,0x5c,
-0x23,0x9f,0xfb,0x24,0x0c,0x23,0x9f,0xfb,0xde,0x7c,0x0c,0x09,0x00,0x10,0xcf,0x1b,
-0x00,0x20,0x99,0x30,0x54,0x2e,0xc2,0x9f,0xfb,0x00,0xdf,0xfe,0xcd,0xff,0xff,0xc0,
-0x9f,0xfb,0x01,0xf5,0x63,0x52,0x9f,0xfb,0x00,0x38,0xbe,0x08,0x81,0x00,0xb5,0x11,
-0x09,0xbc,0x7f,0x14,0x01,0x2e,0x1d,0x14,0x02,0xff,0x86,0x01,0x59,0x84,0x0f,0x01,
-0x00,0x09,0x0f,0x91,0x57,0x95,0x03,0x4f,0x09,0x14,0x40,0xb6,0x1e,0x03,0x0e,0x0c,
-0x19,0x60,0x34,0x30,0x01,0xf3,0x76,0x0f,0xee,0x00,0xb4,0x04,0xa6,0x1b,0x13,0x02,
-0x55,0x1f,0x33,0x02,0xef,0xc6,0x8b,0x89,0x12,0xd1,0x5f,0x26,0x22,0xcf,0xe2,0xd4,
-0x77,0x0f,0xdc,0x01,0xb4,0x30,0x00,0x03,0x30,0xaf,0x22,0x53,0xeb,0x61,0x04,0xff,
-0x60,0x34,0x80,0x10,0xf1,0x9d,0x00,0x21,0x9d,0xff,0x04,0x5f,0x5f,0xd4,0x00,0x02,
-0x78,0x61,0xdc,0x01,0xb3,0x00,0x58,0x0d,0x33,0x04,0xee,0x50,0xaf,0x8c,0x12,0xfe,
-0x7b,0x34,0x11,0x0c,0x1a,0x88,0x12,0xc8,0x74,0x08,0x0f,0xcb,0x01,0xaa,0x32,0x09,
-0xef,0xc3,0xa5,0x07,0x12,0xfc,0xed,0x7a,0x42,0x05,0xfa,0x00,0x3f,0x67,0x43,0x31,
-0x30,0x00,0xdf,0xab,0x0b,0x32,0xf5,0x00,0x0e,0xb6,0x3e,0x33,0xd3,0x18,0xf9,0xd8,
-0x07,0x03,0x72,0x14,0x2f,0x38,0x96,0xdc,0x01,0xad,0x11,0x49,0x78,0x87,0x03,0xb9,
-0x7f,0x02,0x7e,0x87,0x32,0x30,0x3d,0xff,0x78,0x67,0x10,0xef,0x59,0x7f,0x50,0xfe,
-0x4e,0xff,0xfd,0xce,0x0f,0x00,0x31,0xaf,0xff,0x91,0xf4,0x7f,0x10,0xc3,0x31,0x33,
-0x22,0x10,0x0f,0x28,0x4d,0x02,0xe0,0x8a,0x41,0xf7,0x01,0xbc,0xe2,0x22,0x18,0x13,
-0xf3,0x33,0x84,0x07,0xef,0x7c,0x01,0xc0,0x24,0x03,0xf2,0x18,0x02,0xbd,0x24,0x27,
-0x01,0x7b,0x18,0x37,0x29,0x20,0x07,0xfa,0x35,0x91,0x07,0xff,0xff,0xb8,0x88,0x88,
-0xef,0xfb,0x88,0x01,0x00,0x11,0x11,0xd5,0x19,0x03,0x35,0x63,0x03,0xa2,0x65,0x05,
-0x02,0x16,0x02,0x35,0x3a,0x15,0x0d,0xf3,0x82,0x18,0xfb,0xa3,0x47,0x02,0xdd,0x4a,
-0x12,0x7f,0x5b,0x10,0x50,0x06,0x00,0x3f,0xff,0xb1,0x47,0x3c,0x10,0xef,0x95,0x80,
-0x41,0x6d,0xf4,0x00,0xbf,0xd3,0x00,0xa1,0x72,0xef,0xff,0xfc,0xbd,0xff,0xff,0xa0,
-0x01,0xcf,0xaf,0x80,0x05,0xf4,0x10,0x21,0x6b,0xef,0x17,0x7a,0x13,0x4a,0x59,0x13,
-0x0f,0x6b,0x5c,0x90,0x13,0xff,0x6b,0x5c,0x24,0x0e,0xf8,0xf3,0x24,0x03,0x6e,0x3e,
-0x34,0x17,0xbf,0xfc,0x53,0x0d,0x14,0xf0,0xe3,0x0b,0x04,0x8c,0x00,0x04,0xb1,0x64,
-0x12,0xe3,0x8b,0x00,0x22,0xfd,0x81,0xb6,0x05,0x03,0x9b,0x07,0x05,0x17,0x7e,0x16,
-0x04,0xca,0x3a,0x05,0xb5,0x8a,0x0f,0x22,0x2c,0x0c,0x0f,0x05,0x5c,0x97,0x07,0x95,
-0x08,0x33,0x7f,0xfe,0x20,0x22,0x87,0x19,0x20,0x32,0x61,0x3f,0x08,0xff,0x40,0xee,
-0x00,0xb6,0x34,0x08,0xff,0x50,0x06,0x0c,0x03,0x85,0x4e,0x32,0x8a,0xfe,0x20,0xbc,
-0x07,0x21,0x0b,0xfd,0x5b,0x3d,0x13,0xb0,0x79,0x61,0x0f,0xee,0x00,0xaf,0x00,0xdd,
-0x21,0x10,0x08,0x3f,0x04,0x01,0xf7,0x1e,0x10,0xf9,0x50,0x70,0x00,0x00,0x22,0x12,
-0x90,0x1e,0x16,0x2f,0x6c,0xa1,0xdd,0x00,0xa9,0x01,0x0f,0x50,0x01,0x82,0x07,0x33,
-0x1e,0xff,0x70,0x51,0x4f,0x01,0xc3,0x63,0x29,0x58,0x81,0xf3,0x3b,0x03,0x60,0x4e,
-0x0f,0x09,0x00,0x3c,0x00,0x8f,0x1b,0x00,0x7d,0x0e,0x00,0x5e,0x0c,0x30,0x02,0xff,
-0xd1,0x1c,0x1a,0x3a,0x00,0x18,0x83,0x78,0x00,0x0f,0x04,0x00,0x38,0x00,0x27,0x0c,
-0x11,0xd0,0xa7,0x0c,0x00,0xa0,0x5b,0xa0,0xe5,0xff,0x90,0x00,0xbf,0xf3,0x04,0xff,
-0x70,0x9f,0x9f,0x4c,0x0e,0x6f,0x4b,0x02,0x30,0x2a,0x2f,0x4f,0xff,0x0b,0x00,0x52,
-0x60,0x09,0xfc,0x20,0x00,0x2d,0xf8,0x2e,0x10,0x10,0x09,0x3f,0x0e,0x10,0x80,0x80,
-0x57,0x59,0x6c,0xa1,0x00,0x01,0xac,0xaf,0x36,0x04,0x38,0x00,0x03,0x39,0x00,0x0f,
-0x0d,0x00,0x62,0x34,0x09,0xa5,0x00,0x29,0x77,0x41,0x80,0x00,0x00,0x54,0xc9,0x18,
-0xd2,0xe5,0x01,0xaf,0xe1,0x00,0x00,0x5a,0xff,0xff,0xfa,0xef,0xfa,0x10,0x06,0x86,
-0x13,0xf5,0x68,0x07,0x14,0xfb,0x95,0x3d,0x11,0xf8,0x14,0x44,0x21,0xfd,0x3c,0xda,
-0x07,0x23,0x0d,0xf9,0xe5,0x14,0x13,0x34,0x9d,0x10,0x04,0x91,0x1d,0x72,0x02,0x8d,
-0xff,0xd8,0x16,0xff,0xf0,0xd0,0x2a,0xb0,0x7f,0xff,0x40,0x07,0xff,0xff,0xec,0xdf,
-0xff,0xff,0xf7,0xc9,0x93,0x00,0x1d,0x5b,0x41,0x90,0xcf,0xfd,0x10,0x4b,0x23,0x02,
-0x69,0x8f,0x53,0x07,0xff,0xc7,0xff,0xd0,0x42,0x0e,0x12,0xf9,0x52,0x06,0x32,0xcb,
-0xff,0x80,0x11,0x00,0x22,0xcf,0xf7,0xa9,0x04,0x33,0xbb,0xff,0x90,0x73,0x5a,0x12,
-0xfd,0x7d,0x20,0x32,0x53,0xff,0xf4,0xd2,0x18,0x01,0x9c,0x2b,0x00,0xfd,0x35,0x71,
-0x2f,0xff,0xd4,0x00,0x03,0xdf,0xfe,0xbf,0x8e,0x11,0xcd,0x12,0x1a,0x13,0x3e,0x3d,
-0x90,0x00,0xd0,0x08,0x06,0xd8,0x11,0x10,0x32,0xc8,0x44,0x31,0xd8,0x10,0x02,0xbd,
-0x88,0x40,0xff,0xfa,0x9e,0xff,0xb2,0x0e,0x12,0xaf,0x17,0x81,0x30,0x40,0x01,0x8e,
-0x5d,0x86,0x1f,0x44,0x49,0x14,0x04,0x0f,0x98,0x5c,0x8d,0x13,0x01,0x20,0x54,0x02,
-0x76,0x8b,0x03,0x4b,0x0f,0x29,0xf4,0x00,0xf1,0x88,0x00,0x03,0x02,0x0f,0xb5,0x88,
-0x0c,0x0f,0xe0,0x5c,0xa1,0x03,0xca,0x2d,0x1a,0x30,0x0d,0x41,0x14,0x1e,0x97,0x02,
-0x15,0xaf,0xc5,0x6c,0x1f,0x60,0xfc,0x00,0xc1,0x00,0xef,0x6e,0x04,0x5b,0x04,0x13,
-0xf6,0xb1,0x09,0x33,0xb7,0xff,0x40,0xc9,0x1f,0x22,0x9f,0xf2,0x79,0x0f,0x4f,0x00,
-0x0a,0xfe,0x10,0xf8,0x01,0xc2,0x02,0xda,0x24,0x64,0x5c,0xfe,0xb5,0x10,0x5f,0xf4,
-0xdf,0x1b,0x10,0xe0,0xb4,0x09,0x21,0xaa,0xdf,0x9e,0x51,0x6f,0x0d,0xd3,0x00,0x03,
-0x78,0x61,0xf8,0x01,0xbf,0x72,0x01,0xcf,0x90,0x00,0x05,0xee,0x40,0xe0,0x4d,0x01,
-0x75,0x59,0x00,0x9d,0x59,0x11,0x0e,0x0a,0x0d,0x6f,0x9c,0x70,0x00,0x04,0xcb,0x20,
-0xe6,0x01,0xb7,0x34,0x04,0xee,0x70,0x83,0x17,0x1b,0xf0,0x60,0x6e,0x05,0x1b,0x00,
-0x0f,0x01,0x00,0x0e,0x14,0xcf,0x88,0x09,0x0e,0x09,0x00,0x13,0x35,0x91,0x44,0x1f,
-0x54,0x06,0x20,0x0c,0x0f,0x87,0x00,0x14,0x33,0x78,0x10,0x00,0x49,0x0d,0x04,0x38,
-0x44,0x21,0xf7,0x00,0x1a,0x07,0x43,0xda,0x6f,0xf1,0x00,0xc2,0x09,0x14,0xa0,0x7a,
-0x01,0x12,0xf3,0x7a,0x01,0x41,0x0a,0xff,0xfe,0x10,0x17,0x01,0x23,0x0e,0xfe,0x7a,
-0x01,0x23,0x7f,0xa5,0xe0,0x80,0x40,0xef,0x30,0xef,0xf6,0x7a,0x01,0x23,0x07,0xfb,
-0x7a,0x01,0x60,0x0e,0xf3,0x00,0x7f,0xfc,0x6f,0x17,0x16,0x60,0xb0,0x00,0x6f,0xfd,
-0x5f,0xfe,0x23,0x00,0x02,0x7a,0x01,0x23,0x06,0xfb,0x7a,0x01,0x20,0x0e,0xf4,0x7a,
-0x01,0x52,0x0e,0xff,0x60,0x6f,0xc0,0x7a,0x01,0x30,0xc0,0xdf,0x40,0x7a,0x01,0x42,
-0x02,0xff,0xfc,0xfc,0x7a,0x01,0x30,0x9f,0xff,0xf5,0x7a,0x01,0x13,0x20,0x7a,0x01,
-0x01,0xf6,0x5d,0x03,0xd1,0x54,0x32,0x05,0xfd,0x8c,0x7a,0x01,0x24,0x0d,0xf5,0xb5,
-0x08,0x1b,0xd0,0x40,0x45,0x05,0xa3,0x2f,0x04,0x8e,0x4f,0x05,0x13,0x0e,0x2f,0x6f,
-0xf7,0xd8,0x8e,0x0b,0x0f,0x20,0x5f,0x8a,0x02,0xd4,0x01,0x18,0xe2,0x06,0x0e,0x04,
-0xbc,0x96,0x14,0x0c,0xbc,0x21,0x1f,0xf4,0xe0,0x00,0xab,0x24,0x7f,0xf6,0xf8,0x0d,
-0x02,0xbb,0x73,0x33,0xf9,0x9f,0xf2,0xf7,0x0d,0x22,0xfe,0x10,0xfb,0x25,0x2f,0xcf,
-0xc0,0xe0,0x00,0xa7,0x10,0x2d,0x89,0x11,0x20,0xd2,0x00,0xe2,0x23,0x01,0x97,0x29,
-0x10,0x9f,0x2a,0x76,0x12,0xf9,0xe9,0x0d,0x2f,0x5c,0xa1,0x90,0x02,0xa2,0x00,0xcb,
-0x57,0x03,0x8c,0x0b,0x13,0x30,0xd9,0x08,0x27,0x50,0x00,0x17,0x53,0x06,0xff,0x41,
-0x1f,0x58,0x0b,0x05,0x02,0x0f,0x88,0x5f,0xdb,0x24,0x38,0x87,0xde,0x1c,0x1a,0xe0,
-0xb1,0x95,0x0f,0x11,0x00,0x1b,0x10,0x7c,0x9c,0x69,0x41,0x06,0xff,0xe3,0xef,0xf4,
-0x1b,0x12,0x6f,0x0f,0x37,0x20,0x80,0x06,0xf8,0x55,0x00,0x32,0x11,0x12,0x6f,0xd2,
-0x9f,0x23,0xfb,0x06,0x1a,0xa3,0x32,0xf1,0x6f,0xfe,0xe6,0x1b,0x13,0x56,0x30,0x61,
-0x32,0xf8,0x6f,0xfe,0x03,0x01,0x32,0x96,0xff,0xe0,0x69,0x02,0x22,0x6f,0xfe,0xfa,
-0x00,0x32,0xa6,0xff,0xe0,0x7f,0x1c,0x04,0x3c,0x97,0x32,0x86,0xff,0xe0,0x5d,0x7a,
-0x22,0x6f,0xfe,0xaf,0x01,0x13,0x16,0x81,0x07,0x20,0xb0,0x6f,0xf8,0x64,0x10,0x4e,
-0x22,0x84,0x01,0x2a,0x06,0x50,0xf8,0x00,0x6f,0xfe,0x5f,0xea,0x2e,0x00,0xaa,0x00,
-0x4f,0x18,0xce,0xfe,0xa3,0xdd,0x00,0x25,0x0a,0x11,0x00,0x0f,0x1f,0x11,0x05,0x1e,
-0x80,0x1f,0x11,0x0f,0x53,0x02,0xe3,0x04,0xd8,0x5c,0x1e,0xfd,0x0c,0x00,0x10,0x99,
-0x01,0x00,0x1f,0x97,0x0d,0x3e,0xff,0x4e,0x14,0x09,0xf2,0x36,0x13,0x9f,0x66,0x00,
-0x11,0x05,0x78,0x01,0x1f,0x91,0x41,0x1c,0xb4,0x26,0x6f,0xf4,0x94,0x17,0x10,0x3f,
-0xcb,0xa8,0x24,0xe0,0x00,0x24,0x7e,0x17,0x19,0xcf,0x5c,0x06,0x2e,0x02,0x11,0x2b,
-0xba,0x11,0x04,0x0b,0x02,0x1f,0x10,0xd2,0x3e,0xff,0x39,0x01,0x06,0x2b,0x01,0x5b,
-0x6f,0x21,0x71,0x03,0x27,0x04,0x14,0x2e,0x5a,0x34,0x11,0x1a,0x4b,0x98,0x10,0x00,
-0x0f,0xa4,0x0f,0x72,0x02,0x04,0x21,0x5a,0xdf,0x8c,0x9f,0x01,0xe5,0x6b,0x11,0xfb,
-0xb2,0x01,0x11,0xeb,0xda,0x72,0x31,0xef,0xfd,0x40,0x63,0x4f,0x31,0x6f,0xfe,0x10,
-0xf5,0x04,0x02,0xc0,0x3d,0x04,0xbe,0x9e,0x02,0x4d,0x6a,0x51,0x03,0x55,0x66,0x9f,
-0xff,0xd7,0x98,0x01,0x69,0x02,0x13,0x2d,0xad,0x3d,0x42,0x0e,0xff,0xf8,0x41,0x7c,
-0x9b,0x12,0xe1,0x69,0x02,0x24,0xdf,0xf6,0x69,0x02,0x02,0xb5,0x2b,0x02,0x25,0x1a,
-0x12,0x09,0xdc,0x2b,0x00,0x9a,0x06,0x92,0x00,0x9f,0xff,0xa2,0x00,0x3a,0xff,0xff,
-0xf0,0xd8,0x52,0x51,0xef,0xff,0x20,0x02,0xdf,0x1c,0x83,0x10,0xf5,0xf7,0x5a,0x5f,
-0xea,0x30,0x09,0xaa,0x50,0xb8,0x45,0xff,0x2e,0x01,0x4d,0x6a,0x05,0x60,0x4a,0x06,
-0x4f,0x13,0x05,0x3b,0x4b,0x08,0x0b,0x4b,0x08,0xe8,0x29,0x01,0x28,0x0f,0x17,0x9a,
-0xfb,0x24,0x07,0xa8,0x62,0x31,0xbe,0xeb,0x30,0x06,0x87,0x24,0xda,0x40,0x87,0x3f,
-0x10,0xb0,0xcb,0x06,0x20,0xfd,0xbc,0x09,0x00,0x10,0x1f,0x4a,0x51,0x10,0x9f,0xaa,
-0x9f,0x12,0xe0,0x11,0x3f,0x2e,0x8c,0xc7,0xb4,0x04,0x03,0x4b,0x02,0x22,0x17,0xbd,
-0x7a,0x41,0x13,0x8f,0xb4,0x04,0x40,0xbf,0xff,0xe9,0x76,0x5c,0x02,0x12,0x6f,0xba,
-0x77,0x12,0xf0,0x53,0x5d,0x09,0xb4,0x04,0x02,0x93,0x7f,0x13,0x00,0x53,0x80,0x42,
-0xf0,0x0a,0xff,0xf9,0xb4,0x04,0x14,0x2e,0xb4,0x04,0x14,0x3e,0xb4,0x04,0x10,0x17,
-0xb4,0x04,0x04,0x82,0x58,0x23,0xdf,0xe2,0x10,0x02,0x1a,0xf2,0xf4,0x00,0x24,0x0a,
-0xff,0x4f,0x1b,0x14,0xf1,0x9e,0x1d,0x24,0xc9,0xc3,0x06,0x41,0x02,0x7e,0x02,0x13,
-0x4c,0x80,0x66,0x35,0x04,0x88,0x82,0xcb,0x40,0x1c,0x90,0x6d,0x92,0x15,0x05,0xee,
-0x87,0x15,0x0e,0xcb,0x33,0x2f,0x8f,0xf3,0x6e,0x32,0x15,0x0f,0xd7,0x96,0xeb,0x06,
-0xa8,0x42,0x03,0xd9,0x84,0x08,0x4a,0x42,0x23,0x6f,0xf9,0x74,0x01,0x1f,0xfa,0xf6,
-0x30,0x0d,0x0f,0x5a,0x7b,0x98,0x2d,0x28,0x71,0xd3,0x55,0x43,0x0c,0xfe,0xef,0xa0,
-0xfa,0x00,0x33,0xe2,0x3f,0xf8,0x9c,0x02,0x13,0x30,0x06,0x16,0x0e,0xb6,0x3b,0x0f,
-0x4c,0x02,0xff,0x09,0x24,0x2e,0xfb,0x53,0x17,0x12,0xfa,0x17,0x36,0x33,0xfd,0x5f,
-0xf8,0x64,0x37,0x22,0x5f,0xf5,0x57,0x01,0x0e,0x18,0x11,0x0f,0x4c,0x02,0xa7,0x15,
-0x5e,0x01,0x57,0x06,0x3e,0x58,0x06,0x29,0x58,0x2f,0x4c,0xb2,0x84,0x04,0xff,0x17,
-0x15,0x1c,0x72,0xb2,0x14,0xf3,0x39,0x0e,0x03,0x9d,0x04,0x2f,0xac,0x70,0x27,0x02,
-0xad,0x62,0x28,0x83,0x00,0x00,0x58,0x82,0xe0,0x06,0x14,0x20,0xde,0x55,0x34,0xbf,
-0xe1,0x3f,0x7c,0x8a,0x3d,0xfd,0xef,0xb0,0x64,0x5a,0x2f,0x28,0x71,0x3b,0x02,0xff,
-0x15,0x10,0x0a,0xcf,0x88,0x12,0xf7,0xcb,0x56,0x21,0x5f,0xf9,0x7b,0x04,0x33,0xfc,
-0x3f,0xfb,0x2a,0x08,0x04,0xe9,0x0f,0x28,0xfd,0x10,0x47,0x39,0x0f,0x4c,0x02,0x25,
-0x1c,0x5f,0x4c,0x02,0x1f,0x07,0x4c,0x02,0x5d,0x00,0xcc,0x6f,0x32,0x00,0x07,0x87,
-0x68,0x01,0x42,0xd0,0x00,0x8f,0xf6,0x6c,0x05,0x43,0xfb,0x06,0xff,0x70,0xc7,0x1d,
-0x05,0x04,0x4a,0x15,0x3f,0x27,0x09,0x1f,0x04,0x35,0x34,0x05,0x0f,0xd4,0x9e,0xf3,
-0x05,0x6d,0x83,0x35,0x0c,0xee,0x30,0x3c,0x79,0x25,0xdf,0xf3,0x3f,0x79,0x01,0xc4,
-0xb2,0x03,0xea,0x84,0x25,0xff,0xf0,0x17,0x00,0x05,0xdb,0x0b,0x55,0x8f,0xfb,0x0d,
-0xff,0x20,0x17,0x00,0x25,0x8f,0x70,0x17,0x00,0x01,0xfb,0x38,0x04,0x85,0x83,0x03,
-0xe0,0xa8,0x03,0x0c,0x7b,0x04,0x8b,0x83,0x02,0xf5,0x8b,0x01,0x8e,0x83,0x05,0x5f,
-0x5f,0x14,0x5f,0x21,0x13,0x04,0x50,0x37,0x04,0x73,0x7a,0x11,0xb0,0x78,0xa9,0x05,
-0xdd,0x79,0x04,0xa1,0x81,0x15,0xb0,0xbb,0x21,0x01,0x17,0x00,0x16,0x4f,0x17,0x00,
-0x17,0x03,0x17,0x00,0x05,0x85,0x7a,0x06,0xfe,0x8f,0x02,0xa0,0x7e,0x03,0xaf,0x83,
-0x04,0xed,0x5f,0x03,0x7a,0x62,0x04,0xb5,0x83,0x02,0x85,0x39,0x02,0xb8,0x83,0x27,
-0x00,0x00,0xbb,0x83,0x16,0x00,0xbe,0x83,0x0f,0x63,0x43,0xff,0x20,0x05,0xda,0x85,
-0x06,0xa8,0x7b,0x66,0x2b,0xbb,0xbe,0xff,0xeb,0xbb,0xd6,0x6f,0x25,0xf0,0x00,0x23,
-0x5e,0x0b,0x2a,0x00,0x09,0xc0,0x7c,0x02,0x15,0x00,0x06,0x65,0x02,0x06,0x64,0x02,
-0x06,0x63,0x02,0x06,0x62,0x02,0x07,0x61,0x02,0x06,0x60,0x02,0x06,0x5f,0x02,0x07,
-0x5e,0x02,0x06,0x5d,0x02,0x07,0x5c,0x02,0x06,0x5b,0x02,0x07,0x5a,0x02,0x07,0x59,
-0x02,0x06,0x58,0x02,0x07,0x57,0x02,0x07,0x56,0x02,0x06,0x55,0x02,0x07,0x54,0x02,
-0x08,0x53,0x02,0x05,0x52,0x02,0x14,0x0f,0x9c,0x1f,0x05,0x09,0x00,0x11,0x08,0xc8,
-0x13,0x1f,0x80,0x76,0x49,0xf3,0x24,0x00,0x0e,0x17,0x01,0x13,0xef,0x16,0x6e,0x0e,
-0x1f,0x01,0x0f,0x84,0x29,0xa7,0x11,0x05,0x57,0x83,0x01,0x59,0x2a,0x13,0x90,0x75,
-0x5c,0x53,0xcf,0xf8,0x34,0xbf,0xf8,0x61,0x45,0x03,0x4d,0xb3,0x3f,0x8d,0xff,0xc6,
-0x06,0x02,0xed,0x00,0x80,0x14,0x11,0x08,0x35,0x98,0x32,0xfe,0x40,0x15,0x80,0x7e,
-0x13,0xff,0x45,0x47,0x15,0x4b,0x77,0x70,0x1f,0x22,0x0f,0x02,0x04,0x13,0x29,0x9d,
-0x0a,0x13,0x8f,0x5c,0x36,0x10,0xaf,0xb7,0x8d,0x12,0xfb,0x60,0x92,0x00,0x91,0x91,
-0x12,0x1f,0x8f,0xba,0x23,0xe0,0x08,0xdb,0x88,0x32,0x40,0xef,0xf5,0x98,0x13,0x01,
-0xad,0x21,0x00,0x80,0xbd,0x04,0xc0,0x62,0x13,0x5f,0x09,0x00,0x13,0xc5,0xbb,0x53,
-0x14,0xc9,0x6c,0x53,0x01,0x86,0x9e,0x03,0x28,0x99,0x08,0xcc,0xb5,0x13,0x02,0x95,
-0x92,0x40,0x04,0xfa,0x00,0x0a,0xf8,0x7f,0x11,0x18,0x1a,0x32,0x21,0xff,0xdc,0x5b,
-0x38,0x04,0xa1,0x78,0x00,0xd4,0x21,0x12,0xec,0x05,0x0b,0x05,0xa1,0x22,0x14,0x0e,
-0xf9,0x04,0x14,0x0f,0x09,0x00,0x2e,0x06,0xee,0xb1,0x45,0x0f,0xe6,0x4f,0xe7,0x01,
-0xe5,0x23,0x08,0x8d,0x0e,0x05,0x31,0x01,0x2f,0x4c,0xb2,0x15,0x04,0xab,0x0f,0xdf,
-0x52,0xdc,0x04,0xa0,0x91,0x02,0xba,0xbd,0x09,0x2c,0x23,0x24,0xbf,0xf0,0x68,0x0d,
-0x15,0xf0,0xcf,0x76,0x24,0x9c,0x20,0x14,0x5c,0x13,0x30,0x29,0x5c,0x22,0xd9,0x10,
-0xdc,0x01,0x01,0x83,0x0a,0x03,0xb3,0x56,0x10,0x09,0xdc,0x84,0x00,0x3c,0xb4,0x00,
-0x10,0x08,0x31,0xaf,0xff,0x30,0xc1,0x1d,0x00,0x45,0x15,0x01,0xcd,0x08,0x10,0x02,
-0x6e,0x3c,0x02,0x06,0x3e,0x12,0x52,0x44,0x04,0x33,0x9f,0xf8,0x4f,0xeb,0x03,0x1c,
-0xa5,0xeb,0x03,0x14,0xc4,0xeb,0x03,0x02,0x28,0x08,0x04,0x3e,0xbe,0x08,0xb0,0xb8,
-0x02,0x49,0x3e,0x20,0x1b,0x30,0xf6,0x07,0x00,0xa1,0xb1,0x10,0x30,0xd5,0x0c,0x11,
-0xbc,0x1c,0x96,0x14,0xaf,0x70,0x42,0x24,0x39,0xdf,0x2f,0x44,0x04,0x52,0x94,0x04,
-0xb6,0x33,0x05,0x08,0x18,0x04,0x8a,0x61,0x03,0x85,0x30,0x00,0x58,0x0d,0x14,0x9b,
-0x01,0x97,0x03,0xd3,0xc0,0x33,0xbf,0xeb,0x30,0xb6,0x52,0x22,0x88,0x10,0x24,0x60,
-0x03,0x73,0x12,0x42,0xfd,0x13,0xff,0x90,0x57,0x0f,0x2a,0xce,0xfa,0xfe,0x52,0x2f,
-0x00,0x02,0x15,0x54,0xef,0x00,0xf0,0x79,0x31,0x0d,0xfe,0x20,0x50,0x3a,0x22,0x0b,
-0xff,0x4a,0x9d,0x38,0x69,0xff,0x40,0xf2,0x23,0x06,0x76,0x01,0x0f,0xb5,0x33,0xb1,
-0x2d,0x38,0x70,0xdf,0x60,0x05,0xdd,0x60,0x06,0xdb,0x60,0x06,0xd9,0x60,0x0f,0xd7,
-0x60,0x13,0x0f,0x4c,0xab,0xf1,0x00,0xce,0x00,0x1a,0x87,0x5c,0x01,0x43,0x01,0xef,
-0xdf,0xf7,0x59,0x01,0x12,0x6f,0x5e,0xa8,0x12,0xe2,0xf8,0x15,0x01,0x56,0x01,0x0e,
-0x5e,0x2d,0x0f,0xb4,0x90,0xdb,0x00,0x08,0x01,0x41,0x81,0x00,0x00,0x48,0xff,0x01,
-0x00,0x79,0x02,0x22,0xcf,0xf0,0xdd,0x6a,0x22,0x40,0x18,0xb3,0x04,0x13,0x05,0xe2,
-0xa3,0x01,0x7e,0x7d,0x2f,0xff,0x91,0xc1,0x1f,0x0c,0x0f,0x86,0x02,0xf4,0x11,0x07,
-0xd6,0x97,0x03,0x6e,0x68,0x12,0xef,0x64,0x3a,0x32,0x34,0xcf,0xf6,0x40,0x4a,0x03,
-0xa4,0xb8,0x3e,0x9d,0xff,0xc5,0x3f,0x01,0x05,0x7c,0x0e,0x12,0xfc,0x94,0x1f,0x13,
-0x95,0xfe,0x01,0x00,0x43,0x24,0x00,0xd9,0x6d,0x26,0x18,0xff,0x20,0x02,0x13,0x0a,
-0x5b,0xbb,0x12,0xc0,0x2c,0x1b,0x13,0x8f,0x86,0xbf,0x07,0x64,0x02,0x1c,0x4f,0x86,
-0x02,0x04,0x97,0x02,0x13,0xc1,0x60,0x0f,0x14,0xfc,0x91,0x7b,0x13,0xc0,0x86,0x0f,
-0x06,0xdb,0x02,0x31,0x0b,0xff,0xf8,0xec,0x02,0x02,0xfd,0x02,0x00,0xec,0x41,0x01,
-0x44,0x32,0x22,0x8f,0xfc,0x1f,0x03,0x05,0xfa,0x0f,0x26,0x9f,0xfa,0x4a,0xbc,0x13,
-0x70,0x71,0xa0,0x22,0x9f,0x70,0x45,0xb4,0x30,0x2f,0xff,0xa2,0x7b,0x7c,0x10,0x80,
-0x71,0x3c,0x01,0x8d,0x05,0x02,0xd5,0x7a,0x01,0x7b,0xa0,0x12,0xbd,0xaf,0x05,0x00,
-0x62,0x01,0x05,0xc8,0x55,0x06,0xf2,0x85,0x06,0xc5,0x78,0x14,0x5c,0xc2,0xc7,0x0f,
-0xfa,0x04,0xff,0x10,0x23,0x07,0xfd,0x47,0xc6,0x04,0x3e,0x01,0x14,0x0f,0x03,0x09,
-0x1e,0x6c,0x45,0x01,0x0f,0xe9,0x04,0xe0,0x0f,0x25,0x02,0xf2,0x0e,0x01,0x00,0x04,
-0xc1,0x22,0x0b,0x0a,0x00,0x04,0x41,0x3c,0x00,0x47,0x02,0x05,0x0b,0x22,0x06,0xea,
-0x00,0x05,0xd5,0x20,0x25,0x5e,0x70,0x57,0x48,0x1c,0x00,0x0a,0x00,0x39,0x03,0xf7,
-0x00,0xfd,0x9d,0x05,0xd9,0xc0,0x04,0x85,0xbc,0x05,0xa2,0xc4,0x03,0x87,0xbc,0x06,
-0xa4,0x62,0x3f,0x07,0x88,0x20,0x1f,0x05,0xf3,0x26,0x05,0x85,0x6f,0x63,0x15,0xf5,
-0xff,0x24,0x25,0xdf,0xf4,0x5d,0x60,0x23,0xaf,0xe2,0xf0,0x08,0x45,0xc0,0x00,0xbf,
-0xe1,0xa1,0x57,0x1f,0x78,0x30,0x0b,0x05,0x0f,0x6f,0xb4,0xfe,0x05,0x33,0x0a,0x00,
-0x40,0x34,0x03,0x32,0x0a,0x12,0xf8,0x32,0x20,0x36,0x15,0xff,0x60,0x31,0x0a,0x00,
-0x36,0x50,0x2f,0x06,0x87,0xe6,0x99,0xcf,0x01,0xed,0x18,0x04,0xca,0x62,0x05,0x07,
-0xc4,0x00,0x13,0x01,0x0f,0x19,0x00,0x11,0x18,0x07,0x2a,0x8a,0x08,0x17,0x79,0x51,
-0xe4,0x9a,0xff,0xfb,0x99,0x01,0x00,0x3f,0xff,0xfc,0x98,0x64,0x00,0x15,0x07,0x48,
-0x75,0x06,0xab,0x7a,0x00,0x19,0x00,0x04,0x3c,0x02,0x0f,0x96,0x00,0x14,0x0f,0x19,
-0x00,0x5f,0x35,0x00,0xee,0xe3,0x71,0x03,0x07,0x3d,0x86,0x06,0xc7,0x66,0x14,0xa0,
-0xa3,0x1a,0x10,0xfa,0xdb,0x03,0x68,0xbb,0xbf,0xff,0xcb,0xbb,0x70,0x26,0x00,0x0a,
-0x39,0x00,0x41,0x02,0x9d,0xff,0xd8,0xbe,0xb5,0x13,0x37,0xc0,0x55,0x20,0xff,0xfb,
-0xf8,0x04,0x11,0xfd,0xc6,0x0f,0x31,0x81,0x00,0x1a,0x42,0xb3,0x22,0xff,0x40,0xb2,
-0xad,0x02,0xaf,0x06,0x00,0x43,0x28,0x03,0x31,0x27,0x13,0xe0,0x4c,0x00,0x14,0x4f,
-0x84,0xa8,0x00,0x4c,0x19,0x0f,0x13,0x00,0x56,0x02,0xf0,0x38,0x60,0x6d,0xfd,0x70,
-0x00,0x4f,0xf1,0x43,0x1f,0x60,0xaa,0xff,0xd0,0x0e,0xfe,0x9b,0x16,0x0f,0x8e,0x3f,
-0xf2,0x00,0x29,0xef,0xd5,0x00,0x15,0xa3,0x42,0x07,0x9d,0xc6,0x0f,0x07,0x00,0x9c,
-0x01,0xdd,0x1f,0x62,0x1a,0xfe,0xb3,0x00,0x0b,0xfa,0x1c,0x59,0x40,0x66,0xff,0xb9,
-0xdf,0x36,0xcd,0x00,0x14,0x59,0x27,0xa1,0x02,0x84,0x89,0x0f,0x60,0x3f,0x77,0x02,
-0xbd,0x19,0x02,0x06,0x00,0x10,0x89,0xa3,0x03,0x1f,0x98,0x5b,0x61,0x9b,0x11,0x6f,
-0x52,0x03,0x12,0x76,0xc6,0x12,0x11,0x39,0x65,0x04,0x2f,0x40,0x00,0x69,0x01,0x81,
-0x20,0x5f,0xf5,0x58,0xd2,0x20,0x2f,0xfa,0x68,0x0f,0x81,0x0b,0xff,0x83,0x4a,0xff,
-0x80,0x01,0xdf,0x09,0x2c,0x4f,0x18,0xdf,0xfc,0x70,0x6f,0x01,0x96,0x00,0x3a,0xc4,
-0x20,0xff,0xa9,0x90,0x40,0x81,0xf8,0x3f,0xfd,0x53,0x6e,0xff,0x20,0x7f,0xe3,0x12,
-0x4e,0x3b,0xef,0xea,0x30,0x6e,0x01,0x0f,0xd2,0x42,0x56,0x00,0x80,0x03,0x2f,0xcf,
-0xf9,0x07,0x00,0x3e,0x00,0x96,0x0e,0x20,0x8f,0xf8,0xe0,0xd4,0x20,0x2f,0xfb,0x50,
-0xd2,0x00,0x09,0x16,0xf1,0x00,0x06,0xff,0xe8,0xa6,0x1e,0xff,0xff,0x80,0x2b,0xfe,
-0xb3,0x00,0x01,0xcf,0xa0,0xb5,0x6d,0x01,0x1d,0xca,0x29,0x9c,0x70,0xca,0x43,0x0f,
-0x04,0x00,0x39,0x30,0x1d,0xfe,0x30,0xbf,0x2c,0x10,0x09,0x60,0xda,0x10,0xfd,0x8d,
-0x76,0x00,0x55,0x19,0x30,0xa9,0xc0,0x08,0xa2,0x1f,0xd6,0x8d,0xfd,0x70,0x04,0xcb,
-0x20,0xef,0xfb,0x0f,0xff,0xc0,0x6e,0xe3,0x40,0x02,0x3f,0x0c,0xff,0x90,0x05,0x00,
-0x29,0x0f,0x17,0xa0,0x15,0x06,0xf6,0x0c,0x2f,0x8f,0xfe,0x0c,0x00,0xbc,0x32,0x02,
-0x88,0x80,0x8d,0x54,0x24,0xcf,0xf9,0x0f,0x59,0x44,0xaf,0xfc,0xcf,0xf9,0xa0,0x2c,
-0x11,0xef,0x7a,0xbe,0x00,0x83,0x49,0x00,0xb1,0xac,0x11,0xcf,0xc2,0x85,0x10,0xd4,
-0xd4,0x0b,0x31,0xc0,0xcf,0xf9,0xe7,0x18,0x10,0xfd,0x0d,0xa1,0x24,0xcf,0xf9,0xeb,
-0x07,0x12,0xc1,0x45,0x03,0x21,0x01,0x8c,0x03,0xd1,0x90,0x1c,0xfa,0x00,0x00,0x06,
-0xed,0x36,0xff,0xf3,0xce,0x07,0x11,0x6f,0xfb,0x8e,0x3d,0xa0,0x9c,0x70,0x23,0x1b,
-0x20,0x4f,0xff,0x30,0x0d,0x01,0x85,0x16,0x2f,0xbf,0xf9,0x0d,0x00,0x62,0x07,0x4f,
-0x19,0x04,0x0d,0x00,0x16,0x80,0x4f,0xce,0x01,0x8b,0x36,0x11,0x6e,0x03,0x89,0x12,
-0x06,0x31,0x1d,0x24,0x4e,0xfe,0x55,0x4f,0x03,0x80,0xd5,0x07,0xca,0x17,0x00,0x19,
-0x03,0x13,0x8a,0x45,0x0f,0x04,0xc1,0x3b,0x02,0xbd,0x0c,0x2f,0x0c,0xfc,0x8e,0x36,
-0x13,0x05,0x18,0x56,0x01,0xfa,0x30,0x0f,0x15,0x00,0x96,0x05,0x00,0xc0,0x04,0x3f,
-0x18,0x00,0xe7,0x0f,0x05,0x03,0xc0,0x03,0x4d,0xd4,0x01,0x44,0x66,0x06,0x06,0xc0,
-0x01,0x72,0x28,0x12,0xef,0x3a,0x01,0x06,0x09,0xc0,0x00,0x82,0x4e,0x28,0xfe,0xa6,
-0x32,0x64,0x01,0x89,0x89,0xfc,0x02,0x0b,0xff,0x3b,0xfd,0x10,0x00,0xaf,0xf3,0x00,
-0xcf,0xd0,0x05,0xbb,0x40,0x00,0x1a,0xb7,0xf8,0x0d,0x1f,0x40,0x06,0x00,0x6e,0x13,
-0x1f,0x14,0x0a,0x13,0x10,0xbf,0x8f,0x20,0x2d,0xcf,0x0b,0x01,0x11,0x3f,0xf4,0x0e,
-0x20,0x3e,0xfe,0x50,0x92,0x0f,0xde,0xc0,0xfe,0x01,0x9c,0x41,0x16,0x81,0xc5,0x01,
-0x05,0x79,0x17,0x06,0x36,0x74,0x26,0x2f,0xfe,0x22,0x10,0x1e,0xa0,0xa1,0x11,0x16,
-0x1e,0x33,0x31,0x12,0x18,0x07,0x00,0x0f,0xee,0xa6,0xdb,0x08,0x4b,0x05,0x1b,0xfd,
-0xce,0xcc,0x15,0x5f,0xd7,0x00,0x0c,0x68,0x3b,0x04,0x56,0xd3,0x29,0xbd,0x10,0x3b,
-0x85,0x22,0x4f,0xff,0xc3,0x01,0x33,0x20,0x4f,0xff,0xa6,0xb2,0x01,0x09,0x00,0x00,
-0x7a,0x92,0x00,0x09,0x00,0x12,0x03,0xee,0x63,0x02,0x12,0x01,0x01,0x09,0x00,0x31,
-0xbf,0xff,0x30,0x09,0x00,0x02,0xb7,0x13,0x20,0x4f,0xff,0x78,0xb4,0x01,0x09,0x00,
-0x03,0xb2,0xb2,0x14,0x4f,0xae,0x8e,0x12,0x4f,0x51,0x59,0x02,0x09,0x00,0x13,0xfa,
-0x6c,0x00,0x02,0x74,0x6a,0x10,0x4f,0x6d,0x3c,0x02,0x3f,0x00,0x00,0x6e,0x1e,0x12,
-0x40,0x09,0x00,0x32,0x1e,0xff,0xf3,0x09,0x00,0x01,0xf1,0x02,0x21,0x4f,0xff,0xa1,
-0x1c,0x12,0xd1,0x09,0x00,0x00,0x56,0x15,0x25,0x4f,0xff,0xac,0x9f,0x25,0x78,0x87,
-0x68,0xb8,0x03,0x7e,0x1e,0x19,0x70,0x4c,0xd2,0x01,0x69,0xb0,0x03,0xcb,0x2b,0x0f,
-0x36,0x12,0x0b,0x0f,0x65,0xc3,0xc2,0x01,0x77,0x05,0x00,0x44,0xcf,0x21,0xbf,0xf9,
-0xce,0xde,0x08,0x65,0x34,0x2e,0x3e,0xee,0x12,0x4e,0x0f,0x04,0x00,0x49,0x0f,0x69,
-0x01,0xcb,0x0e,0x01,0x00,0x02,0xac,0xb2,0x03,0xb5,0xd9,0x03,0xf5,0x04,0x04,0x3c,
-0x24,0x15,0xf1,0x8e,0x39,0x0a,0x83,0x22,0x28,0x4e,0x80,0x94,0x03,0x3f,0x03,0xee,
-0xe0,0x8a,0xac,0x1f,0x0d,0x05,0x00,0x04,0xcb,0xba,0xf1,0x01,0x2f,0xfe,0x03,0xff,
-0xd0,0x6f,0xf9,0x0b,0xff,0x43,0xff,0xc0,0x0a,0xe2,0x00,0x01,0xd6,0x00,0x01,0xdc,
-0x39,0x22,0xff,0xf5,0x09,0x63,0x00,0x11,0x00,0x01,0x8b,0x2d,0x00,0x62,0x06,0x02,
-0x1b,0x2a,0x12,0x50,0x99,0xb4,0x22,0xff,0xf5,0x97,0xd9,0x00,0x11,0x00,0x2f,0x4e,
-0x50,0x91,0x01,0x91,0x60,0x3e,0xee,0x00,0x0e,0xee,0x04,0xc1,0xbb,0x00,0x03,0x01,
-0x10,0x2f,0x0b,0x01,0x10,0x04,0x43,0x17,0x80,0x00,0x9f,0xf6,0x04,0xff,0xf0,0x1f,
-0xfe,0xa8,0x04,0x20,0xaf,0x40,0x7f,0x0c,0x1f,0x20,0xce,0x0d,0x5c,0x0f,0x11,0x01,
-0x46,0x21,0x2d,0xf7,0x11,0x00,0x00,0x35,0x1a,0x02,0x11,0x00,0x23,0x9f,0xff,0x2e,
-0x08,0x2f,0xbc,0x50,0x77,0x01,0x58,0x03,0xed,0x00,0x0f,0x05,0x00,0x22,0x60,0x6e,
-0xd3,0x4f,0xff,0x00,0xff,0xe0,0xa9,0x10,0xef,0x05,0x00,0x2f,0x4c,0xb2,0x4b,0x00,
-0x27,0x09,0xe8,0xc3,0x05,0x60,0x18,0x0f,0x13,0x00,0x33,0x13,0x16,0x13,0x00,0x22,
-0x77,0xcf,0xab,0x08,0x04,0xe6,0x07,0x53,0x18,0xdf,0xff,0xfc,0x72,0x14,0x0c,0x03,
-0xf4,0x03,0x2f,0x5b,0x6f,0x85,0x00,0x43,0x03,0x81,0x01,0x25,0x00,0x0f,0xa9,0x7c,
-0x05,0xc4,0x7c,0x33,0x0c,0xee,0x50,0x2f,0x92,0x0f,0x05,0x00,0x1c,0x61,0x63,0x92,
-0x00,0x0e,0xff,0xef,0x62,0x3c,0x20,0xa1,0x3d,0x13,0x21,0x10,0x6f,0xb0,0x0b,0x1f,
-0x46,0x4b,0x00,0x21,0x18,0x60,0x0c,0xc1,0x00,0xc6,0xb7,0x0b,0x0f,0x44,0x03,0x76,
-0x5a,0x03,0xe7,0xde,0x05,0xc1,0x3e,0x05,0xa5,0x07,0x03,0xf0,0x19,0x0f,0xef,0x72,
-0xff,0x15,0x03,0x8d,0xbe,0x05,0x13,0x28,0x05,0x10,0xdd,0x13,0x08,0x66,0x01,0x23,
-0x2f,0xfb,0x43,0x7d,0x1f,0x70,0x4d,0x53,0xa0,0x0f,0xf1,0x01,0xfe,0x0f,0x1b,0x03,
-0x06,0x17,0x0e,0x75,0xc2,0x1e,0xf2,0x5a,0x0d,0x07,0x60,0x03,0x25,0x7f,0xf8,0x34,
-0x00,0x06,0x8a,0x52,0x2b,0x7f,0x50,0x4f,0x91,0x0f,0xff,0xb1,0x8f,0x0d,0x01,0x00,
-0x2a,0xbf,0xf6,0x08,0x00,0x29,0xcf,0xf4,0x73,0x09,0x04,0x20,0x0d,0x04,0x72,0x09,
-0x2a,0x04,0xe8,0x40,0x92,0x31,0x03,0x88,0x20,0x0b,0x1d,0x01,0xdc,0x2a,0x23,0x10,
-0x07,0xc3,0x04,0x25,0x1d,0xfc,0xd6,0x53,0x25,0x1e,0xfb,0xb9,0x04,0x16,0x3f,0x94,
-0x0e,0x2f,0x38,0x70,0xaf,0x04,0xff,0x19,0x21,0x1e,0xfc,0xbf,0xdc,0x00,0x25,0x13,
-0x12,0x09,0xb4,0x47,0x38,0xf8,0x7f,0xf8,0x01,0x91,0x02,0x56,0x69,0x00,0x26,0x5f,
-0x1f,0x81,0xfc,0x57,0xa1,0x06,0x47,0xa3,0x06,0x0a,0x00,0x05,0x32,0x13,0x05,0x3f,
-0xe3,0x03,0x6e,0xec,0x09,0xf2,0xe4,0x3e,0x00,0x07,0xf6,0xd1,0x94,0x06,0xf2,0x00,
-0x15,0x00,0xf4,0x00,0x15,0x00,0xf6,0x00,0x24,0x00,0x00,0xf8,0x00,0x24,0x00,0x00,
-0xfa,0x00,0x03,0x6f,0xb2,0x01,0x38,0x08,0x06,0x2b,0x03,0x0f,0x0a,0x00,0x6d,0x01,
-0xda,0x7f,0x01,0x72,0x37,0x34,0x32,0xff,0xff,0xcd,0x51,0x04,0x40,0x3c,0x01,0x15,
-0x00,0x15,0xf6,0x15,0x00,0x25,0xff,0xf1,0x15,0x00,0x24,0xff,0xa0,0x15,0x00,0x33,
-0x9f,0xff,0x40,0x15,0x00,0x34,0xf3,0xbf,0xfd,0x15,0x00,0x34,0x32,0xff,0xf8,0x15,
-0x00,0x01,0x81,0xe2,0x01,0x15,0x00,0x10,0x30,0x67,0x6d,0x02,0x15,0x00,0x01,0x59,
-0xa8,0x02,0x15,0x00,0x01,0x69,0x74,0x02,0x15,0x00,0x00,0x79,0xa8,0x03,0x15,0x00,
-0x00,0xa2,0x58,0x02,0x15,0x00,0x00,0xfe,0xe5,0x03,0x15,0x00,0x00,0x98,0x74,0x02,
-0x15,0x00,0x00,0xce,0x14,0x12,0x32,0x15,0x00,0x00,0x77,0x40,0x03,0x15,0x00,0x00,
-0x3d,0xae,0x04,0x15,0x00,0x00,0x4e,0x33,0x02,0x15,0x00,0x00,0xfe,0x02,0x03,0x15,
-0x00,0x25,0x00,0x5f,0x15,0x00,0x25,0x00,0xbf,0x15,0x00,0x16,0x02,0x15,0x00,0x25,
-0x07,0xff,0x1c,0x02,0x03,0x1d,0x00,0x06,0x56,0xc1,0x08,0xca,0x53,0x01,0x3d,0xcf,
-0x05,0x44,0x95,0x13,0xfc,0x81,0x15,0x26,0xfe,0xff,0xd6,0x9c,0x24,0xff,0x80,0x1c,
-0xa7,0x20,0xeb,0x40,0xd8,0x05,0x10,0x5b,0x2b,0x02,0x31,0x7f,0xf9,0x1b,0x29,0x02,
-0x30,0x7f,0xfa,0xbf,0x27,0x02,0x20,0x70,0x7f,0xc6,0xe1,0x42,0x4e,0xff,0xf0,0x7f,
-0x0f,0xb5,0x32,0xf5,0x7f,0xfd,0xf4,0x35,0x22,0x7f,0xfd,0xcc,0x23,0x22,0x7f,0xfd,
-0xfb,0x12,0x0f,0x08,0x00,0x4d,0x0e,0x39,0x22,0x05,0xba,0xc9,0x05,0x5c,0x26,0x24,
-0x10,0x08,0x26,0x6e,0x02,0xad,0x05,0x13,0xdf,0x91,0x74,0x11,0xcf,0x0a,0x63,0x02,
-0x05,0x1d,0x15,0x30,0xa5,0x87,0x14,0xf6,0xcf,0xf3,0x1e,0xff,0x51,0x5a,0x0f,0x47,
-0x76,0xff,0x1c,0x14,0x0b,0x2c,0x69,0x05,0x09,0x00,0x1e,0x06,0xda,0x4d,0x0f,0xc4,
-0x58,0xb3,0x62,0x0c,0xfe,0x00,0x00,0x0f,0xfa,0x7c,0x02,0x14,0xf2,0x2a,0xef,0x54,
-0x03,0xff,0xd5,0x36,0xef,0x0c,0xf1,0x04,0x6d,0xc9,0x00,0xfc,0x53,0x1f,0xa3,0x45,
-0x02,0xff,0x19,0x11,0x01,0xb3,0xaa,0x11,0x50,0xf2,0x05,0x32,0x10,0x4e,0xff,0x6b,
-0x42,0x04,0xdb,0x05,0x13,0xaf,0x3a,0xe6,0x0e,0xb7,0x4d,0x0f,0xf8,0x5c,0xab,0x00,
-0xe6,0x96,0x14,0x5f,0x6b,0xa9,0x24,0x70,0x2f,0x48,0x41,0x12,0xc0,0x6b,0xce,0x00,
-0x30,0x98,0x04,0xe2,0x2b,0x24,0x6f,0xf5,0x82,0x0a,0x5f,0x06,0x86,0x00,0x68,0x71,
-0xa4,0x7d,0xff,0x1a,0x10,0x08,0x7e,0xf3,0x12,0xd1,0xc0,0xaa,0x31,0x6f,0xfe,0x20,
-0x29,0x3b,0x12,0x02,0x7a,0x89,0x20,0xff,0xc0,0xc2,0xcf,0x01,0x0d,0x7f,0x02,0x5f,
-0xc9,0x5f,0x17,0x84,0x01,0x78,0x60,0x61,0x02,0xb8,0x26,0x28,0xce,0x6f,0x28,0x13,
-0x70,0x78,0xd3,0x05,0xf0,0x11,0x20,0x02,0xef,0xeb,0xa9,0x13,0xef,0x45,0x37,0x54,
-0x60,0x01,0xef,0xff,0x71,0xb6,0xb5,0x02,0x58,0x41,0x13,0x20,0x80,0x41,0x05,0xf1,
-0x41,0x07,0x1f,0x00,0x03,0x09,0x00,0x29,0x9f,0xfc,0x49,0xed,0x05,0x1f,0x00,0x03,
-0xaa,0x27,0x04,0x1f,0x00,0x03,0xbf,0x40,0x05,0x1f,0x00,0x04,0xe3,0x00,0x11,0xff,
-0x8e,0x12,0x13,0xb0,0xce,0x8f,0x13,0x09,0x2f,0x9e,0x06,0x1f,0x00,0x02,0xe8,0xe1,
-0x05,0x1f,0x00,0x0b,0x3e,0x00,0x05,0x5d,0x00,0x0c,0x1f,0x00,0x19,0x20,0x9b,0x00,
-0x29,0xff,0xf3,0x1f,0x00,0x03,0xc8,0x38,0x15,0x9f,0x49,0x6b,0x19,0xfc,0x1f,0x00,
-0x03,0xb4,0x28,0x05,0x1f,0x00,0x02,0xdc,0xf2,0x06,0x17,0x01,0x10,0x1e,0x17,0x2f,
-0x06,0x1f,0x00,0x00,0xef,0x2c,0x51,0xdc,0xbc,0xce,0xff,0xfd,0xca,0x00,0x14,0xd8,
-0x64,0x2e,0x24,0xff,0xff,0xd3,0x28,0x36,0x02,0x8c,0xef,0xed,0x2b,0x02,0x47,0x02,
-0x00,0x7d,0xdb,0x44,0x9d,0xfe,0xd9,0x20,0xf3,0x00,0x15,0xc2,0x94,0x9d,0x11,0x0b,
-0xdd,0x46,0x21,0xe2,0x0b,0xab,0x37,0x10,0x90,0x37,0xa0,0x00,0x9b,0xbd,0x30,0xd8,
-0xff,0xf8,0xbc,0x01,0x12,0x40,0x61,0x02,0x11,0x3f,0x12,0x1c,0x00,0x26,0x42,0x01,
-0x9a,0x03,0x00,0xc7,0xbd,0x02,0x05,0x01,0x04,0xea,0xfb,0x21,0xff,0x60,0xe6,0x00,
-0x32,0x51,0xff,0xf3,0xa2,0x03,0x02,0xdd,0xfa,0x03,0xa5,0xb3,0x05,0xd8,0x91,0x12,
-0x74,0x1f,0x0a,0x14,0x09,0x82,0x15,0x03,0x7f,0x02,0x13,0x9f,0xe3,0x37,0x12,0x63,
-0x1f,0x00,0x03,0x86,0xfa,0x03,0xdd,0xb6,0x00,0x54,0x09,0x18,0x10,0xf0,0x01,0x35,
-0x1f,0xff,0xf5,0x65,0x03,0x02,0xff,0x06,0x05,0x84,0x01,0x00,0x63,0xf1,0x03,0x09,
-0x91,0x12,0x06,0x8e,0x8f,0x31,0x04,0xef,0xfd,0x94,0x0e,0x20,0x5c,0xf5,0xdc,0x0a,
-0x00,0x4d,0xbf,0x21,0x20,0xcf,0xb1,0x6d,0x11,0xb0,0xeb,0x01,0x00,0xe3,0x6c,0x14,
-0x9f,0x1a,0x06,0x41,0x39,0xde,0xfe,0xb5,0xc0,0x02,0x05,0x09,0x46,0x05,0x0d,0x14,
-0x02,0xfe,0x78,0x04,0xad,0xd8,0x03,0x11,0x0a,0x15,0xfa,0x27,0x0d,0x24,0xc0,0x00,
-0xbb,0x49,0x0e,0x92,0x35,0x0f,0x69,0xd8,0xfa,0x02,0xb3,0x07,0x01,0x01,0xbf,0x01,
-0x70,0x06,0x11,0x06,0x7d,0xee,0x20,0xef,0xc0,0x97,0x10,0x0a,0x61,0x06,0x01,0x9e,
-0xc0,0x61,0x08,0xff,0xa7,0xff,0xff,0xa0,0x9f,0xc0,0x00,0x78,0xee,0x21,0x54,0x30,
-0x36,0x0e,0x02,0x64,0xd8,0x25,0x8f,0xfb,0x09,0x1f,0x0f,0x0b,0x00,0x2f,0x0f,0x9e,
-0x01,0xf4,0x0f,0x66,0xb6,0x03,0x1d,0x40,0x8c,0x32,0x04,0x04,0x49,0x00,0xa3,0x38,
-0x05,0xdc,0x54,0x06,0x76,0x33,0x15,0xf1,0x14,0x00,0x1a,0x60,0x8c,0x32,0x00,0x1b,
-0xc0,0x31,0x4b,0xef,0xa0,0x75,0xc2,0x20,0x08,0xff,0x60,0xda,0x01,0x76,0xc2,0x11,
-0x08,0xee,0x00,0x01,0x08,0x10,0x0f,0xd1,0x01,0x35,0x1b,0x8f,0xa5,0x7c,0x12,0x03,
-0x4b,0xbc,0x15,0xfd,0x70,0x62,0x24,0x8f,0xf8,0xd2,0x00,0x02,0x77,0x1f,0x26,0x1a,
-0xe1,0xa7,0x00,0x00,0x56,0x4b,0x03,0x59,0x13,0x15,0xcf,0x56,0x4b,0x1f,0x1d,0x56,
-0x4b,0x0c,0x0e,0x42,0x3e,0x0f,0xfb,0x03,0xf9,0x10,0x0d,0x15,0x25,0x50,0xf5,0x02,
-0xef,0xc0,0x07,0xa4,0x21,0x35,0xfa,0x5f,0xfa,0xb9,0x05,0x02,0xe7,0x94,0x2c,0x07,
-0x82,0x45,0x7e,0x00,0x29,0x02,0x02,0x00,0x04,0x02,0x2a,0x02,0x02,0x01,0x04,0x02,
-0x2b,0x02,0x02,0x02,0x04,0x02,0xea,0x01,0x0f,0x06,0x00,0x3b,0x18,0x00,0xc8,0x63,
-0x02,0x4e,0x2a,0x09,0x64,0x7a,0x01,0x89,0x58,0x08,0xc7,0xfc,0x0f,0x51,0x94,0x07,
-0x1f,0x00,0x58,0xdd,0xe4,0x09,0x01,0x00,0x14,0xdf,0x92,0xc0,0x17,0xf2,0xd1,0x09,
-0x07,0x70,0xd4,0x03,0x2b,0xb6,0x1e,0x65,0x3f,0x01,0x0b,0x3c,0xc6,0x1c,0xf5,0x3c,
-0xc6,0x1e,0xf1,0x3c,0xc6,0x02,0x8d,0x0e,0x0f,0x3c,0xc6,0x1e,0x1f,0x55,0x3c,0xc6,
-0x0c,0x1c,0xbf,0x3c,0xc6,0x12,0x28,0x3c,0xc6,0x08,0x19,0xa4,0x24,0x6f,0xff,0x5c,
-0x37,0x12,0xf8,0x0a,0x36,0x00,0x73,0x92,0x24,0xbf,0xd1,0xd0,0x1a,0x1e,0xdf,0x19,
-0x65,0x0f,0x2b,0x02,0xf4,0x04,0x1a,0x75,0x00,0xb1,0x04,0x01,0x12,0x02,0x31,0x7b,
-0xfe,0x10,0x5d,0x66,0x32,0x00,0xcf,0xd1,0xca,0x7d,0x1f,0x1d,0x70,0x82,0x09,0x0f,
-0x5f,0xc8,0x8c,0x0f,0xd7,0x01,0xdf,0x23,0xfc,0x94,0x1f,0x05,0x04,0x1a,0x03,0x06,
-0xe2,0xc0,0x26,0x26,0xcf,0x1f,0x54,0x05,0xd0,0x9d,0x14,0xfb,0x15,0x29,0x04,0xbe,
-0x0f,0x15,0xaf,0xee,0x0d,0x2f,0xec,0x60,0xe3,0x01,0x8b,0x53,0xcf,0xff,0xd8,0x20,
-0x00,0xc6,0xf6,0x08,0x31,0xdf,0x33,0x04,0x8e,0xff,0xfa,0xb5,0x04,0x2c,0x0c,0x03,
-0x26,0x08,0x12,0x1a,0x51,0x01,0x13,0x0c,0x16,0x1d,0x34,0x0b,0xeb,0x50,0x4d,0x5b,
-0x23,0xdf,0xf2,0x97,0x86,0x23,0xbf,0xf4,0xfa,0x5d,0x04,0x22,0x9c,0x15,0xaf,0x85,
-0x3f,0x03,0xf0,0x80,0x00,0xad,0x46,0x1f,0x10,0x71,0x06,0xfe,0x03,0x89,0x0d,0x51,
-0xa0,0x00,0x1d,0xfe,0x10,0x49,0x01,0x21,0xcf,0xf3,0x5f,0x00,0x12,0x5a,0x8b,0x01,
-0x04,0xec,0xf9,0x14,0x0b,0x66,0x02,0x1f,0x33,0x71,0x06,0xa0,0x0f,0xb1,0xe4,0xfe,
-0x01,0x5f,0x04,0x16,0xfe,0x92,0xa1,0x24,0xfc,0x40,0x15,0x00,0x16,0xbf,0x8d,0x62,
-0x26,0x4f,0xf6,0xc4,0xa1,0x15,0x70,0x8a,0xbf,0x15,0xf3,0x54,0x00,0x05,0xb7,0x0c,
-0x23,0xde,0xb5,0x56,0x1f,0x15,0x70,0xe4,0x68,0x0d,0x06,0x00,0x11,0xdf,0xbb,0x19,
-0x02,0x06,0x00,0x6e,0x89,0x9c,0xff,0xf9,0x99,0x40,0x2a,0x00,0x0f,0x06,0x00,0x1e,
-0x13,0x05,0x06,0x00,0x16,0xf0,0x32,0x7d,0x01,0x1d,0xce,0x00,0x67,0x14,0x10,0x80,
-0x13,0xb3,0x11,0xfe,0x82,0x0b,0x25,0xf3,0x00,0x91,0xc6,0x12,0x37,0x09,0xa0,0x25,
-0x0f,0xfa,0x56,0xa0,0x32,0x01,0x9f,0xf5,0xbc,0x1e,0x00,0x4a,0xa0,0x1f,0xb5,0x1d,
-0x20,0x0a,0x13,0x70,0x44,0x12,0x01,0x68,0xcc,0x0c,0x1d,0x20,0x1f,0x48,0x1d,0x20,
-0x07,0x0f,0x7f,0x02,0xff,0x03,0x04,0x16,0x30,0x27,0xff,0xf2,0x3b,0x1f,0x03,0x38,
-0x1f,0x02,0x08,0x30,0x00,0x65,0x0e,0x00,0xe9,0x01,0x22,0x1c,0xf8,0xf0,0x01,0x15,
-0x50,0x41,0x6b,0x09,0x07,0x00,0x02,0x54,0x02,0x04,0x07,0x00,0x03,0x5c,0x02,0x0e,
-0x2a,0x00,0x0f,0x07,0x00,0x29,0x14,0x05,0x07,0x00,0x18,0xf0,0x9c,0x7f,0x02,0x6b,
-0x02,0x03,0x6c,0x02,0x01,0x8b,0xd0,0x0f,0xea,0x01,0x44,0x75,0x08,0xbb,0xbf,0xff,
-0xdb,0xbb,0x50,0xac,0xc4,0x16,0xf7,0xc8,0x1b,0x1f,0x70,0xea,0x01,0x8e,0x2f,0x6f,
-0xfe,0x06,0x00,0x07,0x02,0x2a,0xd2,0x02,0x06,0x00,0x12,0x08,0x2b,0xd2,0x0d,0x24,
-0x00,0x02,0xc7,0xa5,0x02,0x06,0x00,0x6f,0x2b,0xbb,0xdf,0xff,0xbb,0xbb,0x54,0x00,
-0x0b,0x04,0x31,0x5c,0x24,0x5f,0xff,0x71,0xc8,0x01,0xde,0xc8,0x22,0xe8,0x00,0x33,
-0xd2,0x00,0x07,0x4a,0x13,0xd5,0xd6,0x04,0x11,0x32,0x4d,0x32,0x52,0xfc,0x50,0x00,
-0x7f,0xe0,0xc0,0x16,0x31,0xe9,0xaf,0xfb,0xd0,0x98,0x12,0x9c,0x3c,0x33,0x51,0x06,
-0xfe,0x10,0x03,0xae,0x19,0xb3,0x2f,0x26,0x40,0xee,0x8e,0xfe,0x04,0x23,0xbb,0x51,
-0x06,0xdf,0xea,0x51,0x07,0x0a,0xe7,0x02,0xa3,0x6d,0x30,0xff,0xe9,0xae,0x39,0x1c,
-0x6f,0x02,0xdd,0x10,0x00,0x47,0x85,0xb6,0x73,0xa9,0x01,0x16,0x1f,0x24,0x96,0x00,
-0xf3,0x8c,0x14,0xb0,0x77,0xa9,0x0e,0xc5,0x8f,0x0f,0xce,0x8f,0xfc,0x02,0xbb,0x6d,
-0x06,0x08,0x00,0x11,0x89,0x4a,0x01,0x0f,0x0a,0x02,0xa8,0x23,0x7f,0xf3,0x2e,0x54,
-0x00,0x03,0x08,0x22,0x1e,0xfc,0xe9,0x04,0x22,0x73,0x4c,0xec,0x04,0x15,0x3e,0xce,
-0xc4,0x4f,0x19,0xdf,0xfb,0x50,0x0a,0x02,0xfb,0x20,0x3f,0xf7,0x2f,0x40,0x00,0x7e,
-0x2a,0x23,0x40,0x05,0x1b,0xcc,0x02,0xd3,0x24,0x14,0x3b,0x56,0x59,0x2f,0x02,0x20,
-0xb2,0x78,0xa4,0x24,0x69,0x82,0x6a,0x64,0x14,0xff,0x70,0x0e,0x32,0x80,0x3e,0xf1,
-0xb6,0x16,0x14,0xd0,0xbf,0x17,0x42,0xfb,0x00,0x04,0xf7,0xad,0x0f,0x42,0xf2,0x00,
-0xaf,0x40,0x55,0x0b,0x24,0xfa,0xdf,0x4a,0x58,0x2f,0xfe,0x80,0x52,0x06,0xfc,0x42,
-0x02,0xbf,0xfa,0x10,0x7e,0x2b,0x21,0xcf,0xd1,0x08,0x02,0x31,0x60,0x07,0xf7,0x71,
-0x02,0x22,0x00,0x01,0x4c,0x61,0x31,0x10,0x02,0xfa,0x78,0x00,0x33,0xb1,0x1b,0xf5,
-0x03,0x09,0x12,0xa0,0x19,0x4d,0x1f,0x84,0x46,0x02,0xa4,0x23,0xef,0xf7,0x47,0xb9,
-0x00,0x8b,0xfa,0x12,0xfa,0xb1,0x1e,0x23,0x20,0x8f,0xe3,0x1e,0x11,0x60,0x6e,0x65,
-0x00,0x9c,0x0f,0x12,0x1e,0x1b,0x27,0x5f,0x48,0x71,0x04,0x88,0x30,0x85,0x08,0xfc,
-0x22,0xaf,0xfb,0x48,0x2c,0x61,0x3f,0xfe,0x10,0x8f,0xfd,0x10,0x01,0x4e,0x31,0x4f,
-0xfe,0x20,0x26,0x70,0x12,0x1e,0xce,0x29,0x22,0xe0,0x0b,0xbf,0x56,0x4f,0x83,0x02,
-0x88,0x50,0x27,0x02,0x08,0x01,0xbc,0x23,0x00,0xc1,0x0a,0x0f,0x11,0x00,0x53,0x04,
-0x2e,0x02,0x02,0xbb,0x23,0x34,0xaf,0xff,0x60,0x2f,0x02,0x22,0x00,0x7f,0xca,0x46,
-0x15,0x60,0x30,0x02,0x8f,0x00,0x4b,0xef,0xec,0x82,0x0b,0xff,0x60,0xe5,0x01,0xa1,
-0x14,0xf4,0xe5,0x01,0x15,0xfe,0xe5,0x01,0x14,0xb0,0xe5,0x01,0x14,0xf7,0xe5,0x01,
-0x22,0xff,0x10,0xe5,0x01,0x00,0xcf,0x0c,0x13,0x02,0x6d,0xcc,0x02,0xe5,0x01,0x05,
-0x17,0x13,0x14,0xff,0x28,0xac,0x01,0xcb,0x86,0x07,0x38,0x22,0x08,0x5f,0x85,0x04,
-0x59,0x1a,0x00,0x42,0x52,0x14,0xaa,0xf9,0x22,0x05,0x15,0x15,0x2f,0xef,0xc5,0x14,
-0x04,0x84,0x13,0xf5,0x14,0x04,0x39,0x10,0xdf,0xf4,0x41,0x3a,0x29,0xbf,0xf4,0x6b,
-0x7c,0x04,0xf0,0x17,0x00,0x42,0x45,0x02,0x10,0x13,0x23,0xd9,0xb5,0x0d,0xb4,0x12,
-0xf7,0x51,0x14,0x24,0xfe,0xa2,0x5b,0x0f,0x1b,0x30,0xc7,0xb3,0x19,0x20,0x2d,0x04,
-0x19,0xfd,0x6d,0x21,0x48,0x7f,0xf6,0x1d,0xfc,0x8e,0x9e,0x18,0xf8,0x72,0x3f,0x01,
-0x29,0x9d,0x2f,0x28,0x82,0xec,0x81,0x12,0x0f,0xe3,0xf4,0xff,0x80,0x05,0x59,0x51,
-0x07,0x7d,0xc7,0x08,0x8d,0x88,0x27,0xcf,0xe5,0x02,0x97,0x35,0xbf,0xf2,0x04,0xbe,
-0x0f,0x00,0xfb,0x00,0x3f,0x06,0xff,0x40,0x68,0x2d,0x19,0x0f,0x3d,0xe0,0xfb,0x0b,
-0x1b,0x5f,0x03,0x9a,0x51,0x08,0x2f,0xb2,0x00,0x9f,0x2c,0x26,0x15,0xff,0x7b,0x9f,
-0x13,0x6f,0xee,0x03,0x0e,0x35,0xb2,0x0f,0xd3,0x9c,0xff,0x18,0x07,0xb2,0x47,0x15,
-0x04,0x7e,0x32,0x23,0xbd,0xfd,0x3f,0x5d,0x23,0x2e,0xfa,0x6b,0x01,0x2e,0x4f,0xf7,
-0x8d,0x74,0x0f,0x68,0x7f,0xe6,0x01,0xa1,0xb3,0x13,0xc9,0xe4,0x19,0x13,0xe0,0x5e,
-0xdf,0x06,0xa5,0xb3,0x00,0xa0,0x40,0x3a,0x60,0x00,0x09,0x94,0xcb,0x0f,0x9d,0x02,
-0xff,0x26,0x08,0xb3,0xc3,0x06,0xf3,0xcd,0x05,0xde,0x71,0x05,0xbb,0x97,0x07,0xab,
-0xc3,0x0f,0xa9,0xc3,0x07,0x0f,0x91,0xf8,0xf1,0x0a,0x15,0x3d,0x18,0x40,0x93,0x59,
-0x0f,0x15,0x3d,0x12,0x0f,0x42,0xe4,0x91,0x2e,0x7f,0xd3,0x60,0x5e,0x06,0x0a,0x00,
-0x2f,0x5c,0xb2,0x20,0x02,0xff,0x0d,0x25,0x4e,0xe5,0x50,0xc2,0x05,0x77,0xdb,0x01,
-0xad,0xa5,0x1f,0xc3,0x10,0x02,0xa2,0x33,0x38,0x82,0x00,0x52,0x32,0x44,0x0b,0xfe,
-0x10,0x06,0xd8,0x5d,0x43,0xd0,0x4f,0xf9,0x00,0xa7,0x1c,0x04,0x6a,0x08,0x05,0x4b,
-0x9a,0x0e,0xb8,0x3c,0x0f,0x24,0x02,0xfc,0x09,0xaa,0x3c,0x10,0x50,0x30,0x00,0x06,
-0xaa,0x3c,0x1e,0xa0,0xaa,0x3c,0x0f,0x34,0x02,0x9e,0x40,0x02,0xae,0xff,0xc2,0x3c,
-0x39,0x61,0xf1,0x03,0xff,0xff,0xec,0xd0,0xc5,0x15,0x01,0x08,0x61,0x01,0xce,0x4e,
-0x01,0x9e,0x31,0x1f,0x3f,0x05,0x00,0x55,0x09,0x01,0x00,0x0f,0x1b,0xcc,0x07,0x14,
-0xe2,0x59,0x20,0x07,0x14,0x00,0x70,0xf2,0xef,0x00,0xfa,0xef,0x00,0xea,0x4d,0x01,
-0x0f,0x7d,0x86,0x03,0x10,0x05,0xba,0x30,0x0e,0x01,0x00,0x1f,0xd0,0xc4,0x0c,0x18,
-0x0f,0x63,0xc6,0x0d,0x13,0xde,0xf4,0x02,0x92,0x00,0xfd,0x00,0x00,0xdc,0xfb,0xe8,
-0xed,0x00,0x32,0xe2,0x00,0x0f,0x00,0x5e,0xfb,0xfd,0xf2,0xf7,0x00,0x9a,0x00,0x6f,
-0xf8,0x00,0xf9,0x00,0x00,0xf1,0x4e,0x00,0x03,0x06,0xc8,0xe3,0x03,0x15,0x2d,0x0a,
-0xa0,0xc3,0x05,0xbf,0x03,0x00,0x86,0x37,0x11,0xfa,0x26,0x00,0x4c,0xfa,0x00,0xfa,
-0xf4,0x18,0x42,0x1c,0xf7,0x08,0x01,0x05,0x40,0x00,0x11,0xfb,0x43,0x00,0x28,0xfb,
-0xf9,0x32,0x00,0x11,0xbe,0x12,0x01,0x15,0xb6,0x26,0x00,0x62,0xf6,0xfa,0x00,0x00,
-0xfa,0xf9,0x04,0x00,0x0b,0xa7,0x52,0x03,0x98,0x00,0x2f,0x05,0xf8,0x12,0x01,0x09,
-0x1f,0xfa,0x55,0x01,0x0f,0x1b,0xee,0xa5,0x00,0x40,0xf9,0x00,0xfa,0xf8,0x3a,0x00,
-0x23,0xf5,0xee,0x11,0x00,0x14,0xa2,0x72,0x00,0x96,0xee,0x00,0x00,0xb3,0xf1,0xcf,
-0xd8,0x00,0xbd,0x2d,0x00,0x37,0xf4,0xdb,0xe6,0x3b,0x00,0x00,0xba,0x87,0x33,0xd9,
-0x00,0xc8,0xf8,0x00,0xc0,0xf9,0x00,0xfd,0xfc,0x00,0x00,0xfc,0x00,0x00,0x04,0x00,
-0x04,0x12,0x00,0x1b,0xe5,0x79,0x00,0x6f,0xf4,0x00,0xf8,0xfa,0x00,0xf6,0x9f,0x00,
-0x0d,0x10,0xea,0x26,0x01,0x0e,0xe3,0x82,0x03,0x9f,0x02,0xc0,0xc3,0xbf,0x00,0x00,
-0xea,0xf8,0xbd,0xfc,0x05,0x00,0x05,0x04,0x13,0x01,0xf1,0x02,0xe0,0xe4,0x00,0xe1,
-0xe4,0xeb,0xdf,0x00,0xe5,0xec,0xf0,0xea,0xef,0x00,0xce,0xe0,0xe5,0x72,0x01,0x66,
-0xc1,0xf6,0x00,0x00,0xeb,0xfc,0x3b,0x01,0xa6,0xf3,0xf4,0x00,0x00,0xf3,0xf8,0x00,
-0x00,0xf8,0xfd,0x44,0xea,0x40,0x04,0x00,0xdd,0xef,0x94,0x00,0x00,0x0a,0x00,0x03,
-0x5d,0x62,0x53,0xf7,0x00,0x00,0xf7,0xfa,0xe9,0x01,0x15,0x04,0x3e,0x00,0x14,0xf3,
-0x1b,0x02,0x15,0x04,0x27,0x02,0x10,0xfa,0x30,0x01,0x16,0xf7,0x2f,0x02,0xf6,0x14,
-0x06,0xf2,0xc5,0xf1,0x00,0x00,0xe6,0xf8,0xe5,0xfc,0x05,0xe5,0x05,0x05,0x04,0x05,
-0x00,0x05,0xeb,0xee,0xfa,0xf5,0xee,0xf5,0xf0,0xfa,0xf5,0xfa,0x00,0xfa,0xf8,0x05,
-0xe5,0xee,0xee,0xbb,0x3a,0x1a,0xf9,0xaf,0x01,0x10,0xfa,0x14,0x02,0x1e,0xf8,0xd5,
-0x01,0x17,0xfb,0x72,0x02,0x0c,0x01,0x00,0x1f,0xed,0x41,0x01,0x09,0x05,0xf8,0x00,
-0x0f,0x29,0x02,0x0a,0x4e,0xfd,0x00,0xfc,0xfc,0xe5,0x02,0x0f,0x55,0x00,0x0f,0x0f,
-0x1d,0x00,0x0a,0x0d,0xf3,0x03,0x00,0x13,0x00,0x1b,0xf9,0xc5,0x02,0x01,0x40,0x03,
-0x0f,0x01,0x00,0x24,0x0d,0xdf,0x02,0x1f,0xda,0x98,0x00,0x0b,0x25,0xfa,0xfc,0x77,
-0x00,0x1c,0xdd,0x4f,0x02,0x20,0xfb,0x04,0x4f,0x00,0x4f,0x0e,0x00,0x05,0x05,0x75,
-0x00,0x1a,0x17,0x04,0x10,0x05,0x05,0x69,0x00,0x3e,0xfc,0x04,0x00,0x22,0x01,0x1f,
-0xdd,0xe4,0x00,0x26,0x1f,0xfa,0x91,0x01,0x12,0x1f,0xfc,0x41,0x00,0x20,0x31,0x01,
-0x00,0x02,0xb3,0x07,0x21,0x03,0x00,0xa7,0x03,0x1e,0x05,0xb7,0x05,0xf2,0x0b,0x07,
-0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,
-0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0xfa,0x29,0x70,0x1b,0x1c,0x00,0x1d,
-0x1e,0x00,0x1f,0xa6,0x6e,0xff,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,
-0x24,0x25,0x26,0x24,0x27,0x28,0x05,0x06,0x01,0x01,0x01,0x00,0xd0,0x00,0x08,0x0a,
-0x0a,0x0a,0x0a,0x0c,0x0c,0x0c,0x0c,0x09,0x0c,0x09,0x01,0x00,0xa1,0x00,0x00,0x0d,
-0x0d,0x0d,0x0d,0x17,0x00,0x00,0x1a,0x01,0x00,0x62,0x00,0x1c,0x1d,0x1d,0x1d,0x1d,
-0x69,0x0d,0x10,0x21,0x01,0x00,0x03,0xd0,0xdd,0x40,0x1b,0x24,0x06,0x1a,0x02,0x00,
-0x22,0x08,0x1c,0x02,0x00,0x64,0x09,0x00,0x09,0x00,0x0a,0x1d,0x02,0x00,0x05,0xe4,
-0x30,0x44,0x1f,0x00,0x00,0x0c,0x02,0x00,0x00,0xd4,0x07,0x53,0x00,0x0e,0x00,0x00,
-0x0f,0x02,0x00,0x00,0x1f,0x00,0x00,0x02,0x00,0x50,0x1f,0x00,0x00,0x09,0x21,0x02,
-0x00,0x01,0x39,0x76,0x16,0x22,0x3d,0x76,0x11,0x13,0x02,0x00,0x17,0x0d,0x02,0x00,
-0x70,0x15,0x00,0x17,0x24,0x17,0x18,0x27,0x02,0x00,0x04,0x30,0x01,0x20,0x03,0x02,
-0x2b,0x01,0x4a,0x06,0x07,0x06,0x08,0xe0,0x00,0x00,0x90,0x00,0x20,0x00,0x0b,0xf4,
-0x07,0x00,0x83,0x00,0x01,0x08,0x00,0xd0,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,
-0x13,0x14,0x00,0x00,0x15,0xda,0x29,0x62,0x00,0x17,0x17,0x17,0x18,0x17,0x91,0x1e,
-0xfd,0x01,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,
-0x00,0x23,0x30,0x01,0x11,0x0a,0x01,0x00,0x27,0x24,0x0b,0xcf,0x50,0x00,0x01,0x00,
-0xa1,0x00,0x0b,0x0f,0x0f,0x0f,0x0f,0x13,0x00,0x00,0x16,0x01,0x00,0x20,0x25,0x17,
-0x01,0x00,0x02,0x53,0x00,0x02,0x41,0x01,0xa0,0x26,0x1e,0x1e,0x1e,0x1e,0x1f,0x00,
-0x1f,0x0a,0x16,0x02,0x00,0x22,0x0b,0x17,0x02,0x00,0x20,0x00,0x17,0x24,0x09,0x04,
-0x02,0x00,0x05,0x16,0x00,0x0c,0x17,0x61,0x0b,0x10,0x00,0x10,0x19,0x02,0x00,0x51,
-0x19,0x00,0x00,0x0b,0x1a,0x02,0x00,0x13,0x17,0xbe,0x09,0x12,0x1c,0x02,0x00,0x30,
-0x0e,0x00,0x0e,0x8f,0x11,0x16,0x1e,0x02,0x00,0xc0,0x11,0x00,0x13,0x1f,0x13,0x14,
-0x22,0x14,0x22,0x14,0x22,0x00,
+0xff,0xf4,0x15,0x00,0x00,0xe7,0x00,0x13,0xe0,0x15,0x00,0x43,0x00,0x3f,0xff,0x90,
+0x15,0x00,0x43,0x00,0x9f,0xff,0x3b,0x15,0x00,0x34,0x00,0xef,0xfd,0x15,0x00,0x34,
+0x04,0xff,0xff,0x15,0x00,0x43,0x0a,0xff,0xff,0xfa,0xec,0x01,0x15,0x1e,0x15,0x00,
+0x25,0x00,0x5f,0x15,0x00,0x25,0x00,0xbf,0x15,0x00,0x32,0x01,0xff,0xfa,0x32,0x00,
+0x13,0xf3,0x61,0x01,0x02,0x21,0x00,0x21,0xdf,0xf7,0x07,0x00,0x13,0x08,0x66,0x01,
+0x22,0x2f,0xfb,0x3c,0x01,0x3e,0x48,0x70,0x00,0x01,0x00,0xc0,0x8f,0xf8,0x00,0x6b,
+0xef,0xea,0x40,0x00,0x8f,0xf9,0x2d,0xff,0x3d,0x01,0xf0,0x02,0x8f,0xfc,0xef,0xff,
+0xef,0xff,0xff,0x50,0x8f,0xff,0xfc,0x40,0x00,0x5f,0xff,0xd0,0x8f,0xfa,0x00,0x61,
+0x05,0xff,0xf2,0x8f,0xff,0x10,0x8d,0x02,0x21,0x8f,0xfb,0x62,0x00,0x1f,0xf6,0x08,
+0x00,0x55,0x0f,0xf1,0x01,0xfe,0x0f,0x1b,0x03,0x06,0x34,0x0e,0xff,0x30,0x0b,0x00,
+0x26,0xef,0xf2,0x30,0x03,0x1e,0x10,0x60,0x03,0x25,0x7f,0xf8,0x34,0x00,0x25,0xfe,
+0x10,0x15,0x00,0x15,0x50,0x4a,0x00,0x1f,0x10,0x1a,0x02,0x92,0x1e,0x00,0x01,0x00,
+0x2a,0xbf,0xf6,0x08,0x00,0x23,0xcf,0xf4,0x10,0x01,0x31,0xf1,0x00,0x00,0x74,0x01,
+0x13,0xc0,0x4c,0x02,0x12,0x40,0x10,0x00,0x19,0xe8,0xf1,0x00,0x62,0x00,0x03,0x88,
+0x20,0x00,0x06,0xaf,0x04,0x43,0x0c,0xfd,0x10,0x07,0xc3,0x04,0x31,0x1d,0xfc,0x05,
+0x43,0x02,0x00,0x9f,0x01,0x15,0xfb,0xb9,0x04,0x34,0x3f,0xff,0xa0,0x76,0x00,0x2f,
+0x38,0x70,0xaf,0x04,0xff,0x19,0xc1,0x1e,0xfc,0x00,0x00,0xbf,0xf3,0x00,0x00,0x03,
+0xff,0xa0,0x09,0x61,0x01,0x22,0x5f,0xf8,0x8f,0x02,0x23,0x09,0xff,0x0b,0x06,0x22,
+0xcf,0xfc,0x3c,0x01,0x2f,0x17,0x81,0xaf,0x04,0xa0,0x35,0x00,0xef,0xf3,0x85,0x03,
+0x05,0x0a,0x00,0x25,0xff,0xf1,0x84,0x03,0x15,0xe0,0xf8,0x06,0x15,0x80,0xb7,0x03,
+0x14,0x10,0x14,0x00,0x1b,0xf6,0x82,0x03,0x09,0xf2,0x00,0x15,0x00,0xf4,0x00,0x15,
+0x00,0xf6,0x00,0x24,0x00,0x00,0xf8,0x00,0x24,0x00,0x00,0xfa,0x00,0x00,0x0a,0x00,
+0x13,0x10,0x38,0x08,0x06,0x2b,0x03,0x0f,0x0a,0x00,0x6d,0x13,0x2f,0xf0,0x00,0x62,
+0x2f,0xff,0x32,0xff,0xff,0x20,0x0c,0x01,0x46,0xf3,0x2f,0xff,0xfc,0x15,0x00,0x15,
+0xf6,0x15,0x00,0x25,0xff,0xf1,0x15,0x00,0x24,0xff,0xa0,0x15,0x00,0x33,0x9f,0xff,
+0x40,0x15,0x00,0x34,0xf3,0xbf,0xfd,0x15,0x00,0x34,0x32,0xff,0xf8,0x15,0x00,0x33,
+0x07,0xff,0xf2,0x15,0x00,0x43,0x30,0x0d,0xff,0xc0,0x15,0x00,0x43,0x00,0x3f,0xff,
+0x60,0x15,0x00,0x43,0x00,0x9f,0xff,0x10,0x15,0x00,0x34,0x01,0xef,0xfa,0x15,0x00,
+0x32,0x05,0xff,0xf4,0x15,0x00,0x00,0x3a,0x03,0x12,0xe0,0x15,0x00,0x00,0x3c,0x00,
+0x13,0x80,0x15,0x00,0x43,0x00,0x7f,0xff,0x32,0x15,0x00,0x34,0x00,0xdf,0xfc,0x15,
+0x00,0x33,0x03,0xff,0xf9,0x15,0x00,0x00,0xb6,0x02,0x03,0x15,0x00,0x00,0xfe,0x02,
+0x03,0x15,0x00,0x25,0x00,0x5f,0x15,0x00,0x25,0x00,0xbf,0x15,0x00,0x16,0x02,0x15,
+0x00,0x25,0x07,0xff,0x1c,0x02,0x15,0x2f,0xb6,0x05,0x16,0x03,0x15,0x00,0x12,0x4f,
+0x23,0x01,0x01,0xc4,0x07,0x14,0xf0,0x1f,0x00,0x13,0xef,0x18,0x03,0x33,0x05,0xfe,
+0xff,0xc0,0x04,0x00,0xa3,0x09,0x13,0x80,0x15,0x00,0x30,0xef,0xeb,0x40,0xd8,0x05,
+0x10,0x5b,0x2b,0x02,0x31,0x7f,0xf9,0x1b,0x29,0x02,0x30,0x7f,0xfa,0xbf,0x27,0x02,
+0xc0,0x70,0x7f,0xff,0xf9,0x20,0x00,0x4e,0xff,0xf0,0x7f,0xff,0x60,0x67,0x00,0x31,
+0xf5,0x7f,0xfd,0x68,0x03,0x12,0xf8,0x08,0x00,0x22,0x9f,0xfa,0x08,0x00,0x2f,0x8f,
+0xfb,0x08,0x00,0x4d,0x03,0xd1,0x02,0x0b,0x08,0x00,0x13,0xaf,0xd3,0x06,0x21,0xdf,
+0xf8,0xfa,0x02,0x12,0x08,0x08,0x05,0x22,0xcf,0xff,0xad,0x05,0x41,0xdf,0xff,0xfe,
+0x20,0x10,0x00,0x10,0xfd,0x0f,0x04,0x20,0x39,0x99,0x01,0x00,0x12,0x30,0x65,0x0b,
+0x13,0xff,0x35,0x02,0x11,0x6f,0x0b,0x00,0x2f,0x60,0x00,0x01,0x00,0x1a,0x51,0x04,
+0x9d,0xff,0xec,0x82,0x0a,0x00,0x10,0x2c,0x3e,0x00,0x22,0xfa,0x10,0xb7,0x01,0x21,
+0xff,0xff,0x70,0x00,0x60,0x3f,0xff,0xfa,0x41,0x01,0x5b,0xa8,0x05,0x31,0x0e,0xff,
+0xf3,0x6e,0x00,0x32,0xfb,0x00,0x07,0x99,0x00,0x00,0x07,0x00,0x23,0xef,0xfa,0xc7,
+0x0a,0x23,0xa0,0x4f,0xbf,0x01,0x53,0x7f,0xff,0x08,0xff,0xd0,0xe4,0x03,0x34,0xf4,
+0xbf,0xfa,0xdb,0x03,0x14,0x7d,0xa0,0x01,0x53,0xcf,0xf9,0xef,0xf7,0x00,0x0b,0x06,
+0x14,0x9e,0x08,0x0b,0x26,0xbf,0xfa,0x15,0x00,0x15,0xae,0x15,0x00,0x23,0xf9,0xdf,
+0x9f,0x07,0x34,0x0c,0xff,0x9b,0x65,0x06,0x42,0xef,0xf7,0x8f,0xfe,0x0a,0x00,0x33,
+0x1f,0xff,0x44,0x28,0x02,0x43,0x06,0xff,0xf0,0x0e,0x20,0x00,0x62,0xdf,0xfb,0x00,
+0x8f,0xff,0x40,0x0c,0x01,0x51,0x40,0x00,0xef,0xff,0x30,0xcd,0x00,0x10,0xb0,0xa7,
+0x05,0x60,0x93,0x00,0x04,0xaf,0xff,0xe1,0x1a,0x04,0x01,0x01,0x00,0x10,0xe3,0xa2,
+0x00,0x10,0xcf,0x0a,0x00,0x11,0xb1,0x3a,0x00,0x52,0x49,0xdf,0xfe,0xc8,0x30,0x82,
+0x00,0x00,0x01,0x00,0x17,0xf1,0x09,0x00,0x11,0x06,0x6c,0x01,0x1f,0x91,0x47,0x01,
+0x0b,0x61,0x02,0x9d,0xff,0xeb,0x60,0x00,0x27,0x06,0x41,0xff,0xff,0xfd,0x30,0x3f,
+0x00,0x40,0xdc,0xef,0xff,0xf4,0x11,0x00,0x71,0x91,0x00,0x05,0xef,0xff,0x10,0x02,
+0xa4,0x03,0x40,0x2e,0xff,0xa0,0x0a,0x21,0x01,0x00,0xa2,0x04,0x32,0x0f,0xff,0x60,
+0xd4,0x00,0x32,0x3f,0xff,0x20,0x81,0x02,0x22,0x5f,0xff,0xcf,0x02,0x32,0xfd,0x6f,
+0xfe,0x3e,0x06,0x13,0xfe,0x09,0x00,0x42,0x6f,0xfe,0x4f,0xff,0x60,0x01,0x22,0xfd,
+0x2f,0x28,0x05,0x25,0x9f,0xfb,0x3f,0x00,0x05,0x51,0x00,0x31,0x03,0xff,0xf8,0x80,
+0x03,0xa0,0xb0,0x00,0x8f,0xff,0x91,0x00,0x04,0xdf,0xff,0x10,0x87,0x00,0x11,0xcc,
+0x87,0x00,0x01,0x99,0x00,0xc0,0xfe,0x30,0x00,0x00,0x00,0x02,0x8d,0xef,0xeb,0x60,
+0x00,0x00,0x90,0x00,0x00,0x0c,0xfe,0x00,0x00,0x0f,0xfa,0x00,0x01,0x00,0x60,0xaf,
+0xf2,0x00,0x05,0xff,0x70,0x0a,0x00,0x61,0x03,0xff,0xd5,0x36,0xef,0xf1,0x15,0x00,
+0x61,0x07,0xff,0xff,0xff,0xf5,0x00,0x01,0x00,0x5f,0x04,0xbe,0xfe,0xa3,0x00,0x01,
+0x00,0x07,0x51,0x04,0x9d,0xff,0xec,0x82,0x0a,0x00,0xc0,0x2c,0xff,0xff,0xff,0xff,
+0xfa,0x10,0x00,0x00,0x00,0x5f,0xff,0x01,0x00,0xf2,0x0c,0xfe,0x20,0x00,0x00,0x3f,
+0xff,0xfa,0x41,0x01,0x5b,0xff,0xfe,0x10,0x00,0x0e,0xff,0xf3,0x00,0x00,0x00,0x06,
+0xff,0xfb,0x00,0x07,0xff,0xf4,0x63,0x00,0x32,0xf4,0x00,0xef,0x83,0x00,0x61,0x0d,
+0xff,0xa0,0x4f,0xff,0x30,0x0b,0x00,0x51,0x7f,0xff,0x08,0xff,0xd0,0x0a,0x00,0x52,
+0x02,0xff,0xf4,0xbf,0xfa,0x64,0x00,0x52,0x0e,0xff,0x7d,0xff,0x80,0x0b,0x00,0x42,
+0xcf,0xf9,0xef,0xf7,0x0a,0x00,0x52,0x0b,0xff,0x9e,0xff,0x70,0x0b,0x00,0x26,0xbf,
+0xfa,0x15,0x00,0x15,0xae,0x15,0x00,0x32,0xf9,0xdf,0xf8,0x0a,0x00,0x52,0x0c,0xff,
+0x9b,0xff,0xa0,0x0b,0x00,0x42,0xef,0xf7,0x8f,0xfe,0x0a,0x00,0x31,0x1f,0xff,0x44,
+0x92,0x00,0x00,0x94,0x00,0x23,0xf0,0x0e,0x20,0x00,0x60,0xdf,0xfb,0x00,0x8f,0xff,
+0x40,0x0a,0x00,0x71,0x6f,0xff,0x40,0x00,0xef,0xff,0x30,0xcd,0x00,0xe1,0xb0,0x00,
+0x04,0xff,0xff,0x93,0x00,0x04,0xaf,0xff,0xe1,0x00,0x00,0x05,0xdc,0x00,0x20,0xff,
+0xe3,0xa2,0x00,0x10,0xcf,0x0a,0x00,0x11,0xb1,0x3a,0x00,0x41,0x49,0xdf,0xfe,0xc8,
+0xc2,0x00,0x70,0x01,0xff,0x90,0x00,0x05,0xff,0x50,0x4d,0x00,0x60,0xf6,0x10,0x4e,
+0xff,0x10,0x00,0x05,0x01,0x31,0xff,0xff,0xf6,0xd3,0x00,0x42,0xaf,0xff,0xfc,0x40,
+0x7f,0x00,0x1f,0x12,0x50,0x01,0x05,0x50,0x02,0x9d,0xff,0xeb,0x60,0x09,0x00,0x60,
+0x9f,0xff,0xff,0xff,0xfd,0x30,0xd3,0x00,0x50,0xff,0xdc,0xef,0xff,0xf4,0x11,0x00,
+0x80,0x91,0x00,0x05,0xef,0xff,0x10,0x02,0xff,0xd8,0x00,0x41,0x2e,0xff,0xa0,0x0a,
+0x2a,0x01,0x62,0x05,0xff,0xf2,0x0f,0xff,0x60,0xdd,0x00,0x31,0x3f,0xff,0x20,0x3b,
+0x00,0x41,0xfa,0x5f,0xff,0x00,0xc6,0x00,0x22,0xfd,0x6f,0xef,0x00,0x23,0x5f,0xfe,
+0x09,0x00,0x42,0x6f,0xfe,0x4f,0xff,0x69,0x01,0x41,0xfd,0x2f,0xff,0x10,0x2d,0x00,
+0x15,0xfb,0x3f,0x00,0x05,0x51,0x00,0x11,0x03,0x63,0x00,0xc0,0x1e,0xff,0xb0,0x00,
+0x8f,0xff,0x91,0x00,0x04,0xdf,0xff,0x10,0x87,0x00,0x11,0xcc,0x87,0x00,0x01,0x99,
+0x00,0x20,0xfe,0x30,0xab,0x00,0x22,0x8d,0xef,0xab,0x00,0x00,0xe3,0x00,0x42,0x20,
+0x5f,0xff,0x30,0x6d,0x01,0x20,0x70,0x2f,0xff,0x00,0x00,0x48,0x00,0x23,0xc0,0x0c,
+0xb7,0x01,0x33,0xdf,0xf1,0x09,0x62,0x01,0x52,0x6f,0xf5,0x04,0xff,0xc0,0x77,0x01,
+0x4f,0x86,0x00,0x68,0x71,0x59,0x02,0x08,0x00,0x52,0x01,0x25,0x20,0x00,0x67,0x01,
+0x25,0xa1,0x00,0x7c,0x01,0x10,0xe2,0xab,0x02,0x50,0xff,0xa4,0x10,0x15,0xbf,0x91,
+0x01,0x02,0xa6,0x01,0x51,0x6f,0xff,0xb0,0x00,0x7f,0xbb,0x01,0x00,0x07,0x00,0x05,
+0xd0,0x01,0x43,0xfa,0x04,0xff,0xf3,0xd1,0x02,0x32,0xf0,0x8f,0xfd,0x59,0x00,0x36,
+0x2f,0xff,0x4b,0x0f,0x02,0x06,0x24,0x02,0x16,0x9e,0x39,0x02,0x0e,0x4e,0x02,0x09,
+0x63,0x02,0x16,0x9d,0x8d,0x02,0x06,0xa2,0x02,0x42,0x78,0xff,0xe0,0x00,0x00,0x02,
+0x14,0xf4,0xcc,0x02,0x26,0x6f,0xff,0xe1,0x02,0x42,0xb0,0x08,0xff,0xf4,0x6d,0x02,
+0x13,0xf4,0x0b,0x03,0xb0,0x05,0xff,0xfb,0x00,0x00,0x4f,0xff,0xf9,0x30,0x00,0x4a,
+0x20,0x03,0x04,0x35,0x03,0x14,0x30,0x4a,0x03,0x24,0xfb,0x10,0x5f,0x03,0x12,0x83,
+0x64,0x00,0x61,0x08,0xff,0xd0,0x0a,0xff,0xd1,0xbb,0x02,0x40,0x20,0x6f,0xfe,0x20,
+0xbb,0x03,0x41,0xf7,0x02,0xff,0xf3,0x2b,0x03,0x41,0xc0,0x0d,0xff,0x50,0x9c,0x00,
+0x21,0x20,0x9f,0xa7,0x00,0x5f,0x17,0x84,0x01,0x78,0x60,0x61,0x02,0xb8,0x35,0x28,
+0xce,0xff,0x01,0x00,0x56,0x70,0x00,0x01,0xaf,0xff,0x01,0x00,0xb1,0xf7,0x00,0x02,
+0xef,0xff,0xfd,0xcc,0xcc,0xef,0xff,0xee,0x01,0x00,0x82,0x60,0x01,0xef,0xff,0x71,
+0x00,0x00,0x09,0x67,0x02,0x00,0x26,0x01,0x01,0x2c,0x01,0x34,0x9f,0xfc,0x00,0xff,
+0x01,0x27,0x40,0x00,0x1f,0x00,0x03,0x09,0x00,0x05,0x1f,0x00,0x38,0xdf,0xf7,0x00,
+0x1f,0x00,0x38,0x0f,0xff,0x30,0x1f,0x00,0x39,0x02,0xff,0xf2,0x1f,0x00,0x04,0xe3,
+0x00,0x20,0xff,0xdd,0x01,0x00,0x42,0xb0,0x02,0xff,0xf1,0x1f,0x00,0x01,0x01,0x00,
+0x16,0xfd,0x1f,0x00,0x01,0x01,0x00,0x15,0xd0,0x1f,0x00,0x0b,0x3e,0x00,0x05,0x5d,
+0x00,0x0c,0x1f,0x00,0x19,0x20,0x9b,0x00,0x29,0xff,0xf3,0x1f,0x00,0x39,0x0d,0xff,
+0x70,0x1f,0x00,0x28,0x9f,0xfc,0x1f,0x00,0x00,0x40,0x05,0x09,0x1f,0x00,0x37,0x0a,
+0xff,0xe2,0x1f,0x00,0x00,0x7d,0x01,0x26,0xf7,0x10,0x1f,0x00,0x00,0xf0,0x01,0x61,
+0xff,0xdc,0xbc,0xce,0xff,0xfd,0xca,0x00,0x47,0xd8,0x00,0x00,0x1a,0x64,0x01,0x00,
+0x30,0x03,0x35,0x02,0x8c,0xef,0x0f,0x00,0x12,0xfa,0x47,0x02,0x84,0x50,0x00,0x00,
+0x03,0x9d,0xfe,0xd9,0x20,0xf3,0x00,0x30,0xc2,0x00,0x08,0x07,0x00,0x12,0x80,0x54,
+0x02,0xf0,0x06,0xff,0xff,0xe2,0x0b,0xff,0xff,0xcd,0xff,0xff,0x90,0x00,0x08,0xff,
+0xf9,0x10,0x00,0x5e,0xff,0xd8,0xff,0xf8,0xbc,0x01,0x11,0x40,0x61,0x02,0x00,0x17,
+0x05,0x10,0xf7,0x9f,0x01,0x22,0xfc,0x00,0x9a,0x03,0x32,0x8f,0xff,0xfd,0x05,0x01,
+0x02,0xd9,0x00,0x41,0x01,0xff,0xff,0x60,0xe6,0x00,0x12,0x51,0xf8,0x00,0x12,0x0c,
+0x7b,0x01,0x32,0xcf,0xf6,0x3f,0x60,0x02,0x04,0x04,0x02,0x37,0x74,0xff,0xf0,0x74,
+0x01,0x23,0xff,0xf8,0x7f,0x02,0x31,0x9f,0xff,0xcc,0x01,0x00,0x32,0x63,0xff,0xf0,
+0xfe,0x00,0x14,0xf0,0xf8,0x05,0x01,0x55,0x01,0x00,0x72,0x02,0x07,0xf0,0x01,0x35,
+0x1f,0xff,0xf5,0x65,0x03,0x02,0xff,0x06,0x05,0x84,0x01,0x10,0x70,0x94,0x00,0x11,
+0xff,0x93,0x00,0x10,0x06,0xa5,0x00,0x60,0x80,0x00,0x04,0xef,0xfd,0xaf,0xe5,0x00,
+0xf2,0x03,0x5c,0xf5,0x00,0x00,0xbf,0xff,0xfc,0xce,0xff,0xff,0x20,0xcf,0xff,0xfc,
+0xbd,0xff,0xff,0xb0,0xeb,0x01,0x44,0xfc,0x20,0x00,0x9f,0x1a,0x06,0x41,0x39,0xde,
+0xfe,0xb5,0xc0,0x02,0x03,0x1f,0x06,0x44,0x00,0x00,0x68,0x87,0x3a,0x07,0x02,0x15,
+0x06,0x01,0x3e,0x04,0x13,0x80,0x0a,0x00,0x24,0x8f,0xfa,0xa6,0x03,0x05,0xa8,0x01,
+0x3f,0x0c,0xfd,0x10,0x23,0x05,0x05,0x10,0x0f,0x66,0x00,0x24,0xed,0xa6,0x0a,0x00,
+0x01,0x50,0x01,0x10,0x0f,0x07,0x03,0x10,0xff,0x75,0x01,0x10,0x0f,0x13,0x04,0x42,
+0x01,0x7f,0xff,0xf5,0x0a,0x00,0x42,0x00,0x02,0xef,0xfd,0x0a,0x00,0x00,0x9a,0x04,
+0x13,0x20,0x0a,0x00,0x33,0x1f,0xff,0x50,0x0a,0x00,0x3d,0x0f,0xff,0x60,0x14,0x00,
+0x05,0x28,0x00,0x35,0x02,0xef,0xfc,0x50,0x00,0xb4,0xf3,0x00,0x0f,0xff,0xed,0xdd,
+0xdd,0xef,0xff,0xff,0x50,0x78,0x00,0x14,0xc3,0x82,0x00,0x11,0xfb,0x49,0x00,0x11,
+0x50,0x3a,0x00,0x02,0x0a,0x00,0x00,0xdd,0x07,0x03,0x0a,0x00,0x33,0x06,0xff,0xf2,
+0x0a,0x00,0x00,0x69,0x07,0x03,0x0a,0x00,0x00,0x37,0x06,0x01,0x0a,0x00,0x00,0x25,
+0x05,0x03,0x0a,0x00,0x11,0x05,0x64,0x00,0x13,0x50,0x92,0x07,0x02,0x0a,0x00,0x00,
+0x29,0x00,0x03,0x0a,0x00,0x44,0x0d,0xff,0xc0,0x0f,0x63,0x06,0x00,0xe4,0x02,0x01,
+0xb3,0x07,0x10,0x3f,0x2e,0x02,0x01,0x70,0x06,0x10,0x06,0x71,0x00,0x20,0x01,0xef,
+0x40,0x01,0x1a,0x38,0x61,0x06,0xf0,0x08,0x8f,0xfa,0x04,0xbe,0xfa,0x08,0xff,0xa7,
+0xff,0xff,0xa0,0x8f,0xfe,0xff,0xff,0xfa,0x08,0xff,0xff,0xe7,0x54,0x30,0x8f,0xb8,
+0x01,0x11,0x08,0x7c,0x03,0x21,0x8f,0xfb,0x03,0x02,0x1f,0xb0,0x0b,0x00,0x32,0x0f,
+0x9e,0x01,0xf4,0x0e,0x01,0x00,0x00,0x24,0x00,0x15,0x40,0x0a,0x00,0x15,0x30,0x05,
+0x03,0x23,0x20,0x00,0xa3,0x03,0x14,0xfe,0x28,0x00,0x34,0x6f,0xf9,0x00,0x97,0x05,
+0x15,0xf1,0x14,0x00,0x05,0xd8,0x06,0x14,0x01,0xb3,0x03,0x70,0xa0,0x4b,0xef,0xa0,
+0x8f,0xfa,0x7f,0xd1,0x01,0x10,0xef,0xdc,0x01,0x71,0xff,0xfe,0x75,0x43,0x08,0xff,
+0xfb,0x1b,0x02,0x1f,0x10,0xd1,0x01,0x37,0x2a,0x8f,0xfb,0xc6,0x00,0x11,0x03,0xf3,
+0x07,0x22,0x3f,0xfd,0xec,0x08,0x00,0x21,0x00,0x14,0xf8,0xd2,0x00,0x11,0x04,0x31,
+0x00,0x26,0x1a,0xe1,0xa7,0x00,0x62,0x04,0x88,0x10,0x00,0x06,0x87,0x37,0x08,0x32,
+0xd0,0x00,0x8f,0xfb,0x03,0x33,0x1d,0xfb,0x06,0x61,0x08,0x54,0x02,0xef,0xbf,0xf8,
+0x00,0x4c,0x09,0x14,0x90,0x22,0x04,0x2f,0x87,0x00,0xfb,0x03,0xff,0x0a,0xf5,0x02,
+0x0d,0xfd,0x10,0x00,0xaf,0xf5,0x02,0xef,0xc0,0x07,0xff,0x80,0x00,0x4f,0xfa,0x5f,
+0xfa,0xb9,0x05,0x30,0xaf,0xfe,0x10,0xc6,0x05,0x1a,0x82,0x34,0x01,0x02,0x29,0x02,
+0x02,0x00,0x04,0x02,0x2a,0x02,0x02,0x01,0x04,0x02,0x2b,0x02,0x02,0x02,0x04,0x02,
+0xea,0x01,0x0f,0x06,0x00,0x3b,0x03,0x61,0x0a,0x23,0xe2,0x00,0x6f,0x0c,0x13,0xf3,
+0xbf,0x02,0x24,0xef,0xf5,0xa2,0x08,0x14,0xf7,0xfb,0x01,0x04,0xf0,0x02,0x1f,0x05,
+0xfa,0x01,0x07,0x50,0x02,0x8b,0xef,0xfe,0xb6,0x09,0x00,0x11,0x19,0x30,0x0a,0x80,
+0x60,0x00,0x00,0x1d,0xff,0xff,0xfe,0xef,0xa4,0x07,0xc2,0x0c,0xff,0xfa,0x30,0x00,
+0x04,0xcf,0xff,0x80,0x04,0xff,0xf7,0x04,0x07,0x32,0x20,0x9f,0xfe,0xe9,0x0a,0x42,
+0xf9,0x0b,0xff,0xa0,0x27,0x07,0x22,0xd0,0xbf,0xc7,0x02,0x22,0x5b,0xba,0xf2,0x00,
+0x02,0xe6,0x06,0x14,0xc1,0x23,0x05,0x34,0xff,0xf8,0x20,0x0a,0x00,0x22,0xff,0xc7,
+0x9c,0x03,0x61,0x3c,0xff,0xff,0xff,0xd7,0x10,0xf2,0x02,0x12,0xaf,0xdf,0x07,0x00,
+0x9c,0x02,0x24,0x9e,0xff,0x35,0x00,0x25,0x05,0xcf,0xad,0x06,0x12,0x8f,0x9d,0x01,
+0x00,0xe5,0x02,0x33,0xfc,0x6b,0xb9,0x7a,0x0b,0x33,0xe7,0xff,0xf0,0x10,0x0b,0x32,
+0x3f,0xff,0x50,0x8d,0x07,0x41,0xd0,0xcf,0xfe,0x30,0x03,0x07,0x20,0xf9,0x02,0x5b,
+0x0d,0xb0,0x00,0x28,0xff,0xff,0x20,0x04,0xef,0xff,0xff,0xed,0xff,0x5b,0x02,0x02,
+0xe0,0x09,0x10,0xfd,0x22,0x00,0x5b,0x16,0xbd,0xff,0xec,0x94,0x02,0x01,0x32,0xdf,
+0xfe,0x10,0x59,0x00,0x16,0xf2,0xd1,0x09,0x00,0xa3,0x0b,0x12,0xf5,0x8e,0x00,0x03,
+0xa1,0x00,0x2f,0x05,0x65,0x3f,0x01,0x02,0x52,0x28,0xcf,0xfe,0xc7,0x10,0xe1,0x0e,
+0x21,0xff,0xf5,0x75,0x08,0x70,0xcf,0xff,0xff,0x50,0x02,0xff,0xfa,0xa1,0x08,0x11,
+0xf1,0xff,0x07,0x41,0x02,0xff,0xf6,0x0a,0x2e,0x01,0x24,0xbf,0xf8,0x8d,0x0e,0x43,
+0x04,0xff,0xfa,0x20,0x57,0x08,0x24,0xfd,0x84,0x21,0x0f,0x20,0xfa,0x40,0x6a,0x0b,
+0x14,0xcf,0xab,0x0b,0x43,0x48,0xdf,0xff,0xc0,0xf2,0x00,0x32,0xf6,0x15,0x55,0x35,
+0x0c,0x31,0x3f,0xff,0x10,0x39,0x04,0x31,0x0f,0xff,0x80,0x10,0x00,0x01,0x09,0x09,
+0x80,0x19,0xff,0xf4,0x00,0xbf,0xff,0xfd,0xcd,0xb3,0x01,0x01,0xb7,0x08,0xa0,0xf9,
+0x00,0x00,0x00,0x28,0xce,0xff,0xc8,0x20,0x00,0x72,0x00,0x00,0x00,0x00,0x8f,0xf5,
+0x00,0x01,0x00,0x32,0x6f,0xff,0xf3,0x09,0x00,0x41,0x5f,0xf8,0xaf,0xe2,0x09,0x00,
+0x50,0x3f,0xfa,0x00,0xbf,0xd1,0x09,0x00,0x7f,0x2f,0xfb,0x00,0x00,0xdf,0xc0,0x00,
+0x01,0x00,0x0c,0x50,0x02,0x8b,0xef,0xfe,0xb6,0x09,0x00,0xf0,0x0f,0x19,0xff,0xff,
+0xff,0xff,0xfe,0x60,0x00,0x00,0x1d,0xff,0xff,0xfe,0xef,0xff,0xff,0xa0,0x00,0x0c,
+0xff,0xfa,0x30,0x00,0x04,0xcf,0xff,0x80,0x04,0xff,0xf7,0x22,0x00,0x51,0x9f,0xff,
+0x20,0x9f,0xfe,0x35,0x00,0x50,0xef,0xf9,0x0b,0xff,0xa0,0x09,0x00,0x51,0x09,0xff,
+0xd0,0xbf,0xfb,0x13,0x00,0x53,0x5b,0xba,0x08,0xff,0xf1,0x54,0x00,0x33,0x2f,0xff,
+0xc1,0x0a,0x00,0x44,0x8f,0xff,0xf8,0x20,0x0a,0x00,0x31,0xff,0xc7,0x30,0x0a,0x00,
+0x60,0x3c,0xff,0xff,0xff,0xd7,0x10,0x0a,0x00,0x61,0x03,0xaf,0xff,0xff,0xff,0x80,
+0x15,0x00,0x34,0x04,0x9e,0xff,0x35,0x00,0x45,0x05,0xcf,0xff,0xc0,0x3f,0x00,0x13,
+0x50,0x0a,0x00,0x41,0xcf,0xfc,0x6b,0xb9,0x09,0x00,0x53,0x07,0xff,0xe7,0xff,0xf0,
+0xfb,0x00,0x12,0x3f,0x1f,0x00,0x60,0x0a,0xff,0xd0,0xcf,0xfe,0x30,0x45,0x00,0xf0,
+0x09,0xff,0xf9,0x02,0xff,0xff,0x93,0x00,0x00,0x28,0xff,0xff,0x20,0x04,0xef,0xff,
+0xff,0xed,0xff,0xff,0xff,0x50,0x00,0x01,0xaf,0xdb,0x00,0x10,0xfd,0x22,0x00,0x51,
+0x16,0xbd,0xff,0xec,0x94,0x3e,0x00,0x31,0x08,0xff,0x40,0x08,0x00,0x12,0x7f,0x41,
+0x01,0x40,0x05,0xff,0x7b,0xfe,0x94,0x00,0xdf,0x4f,0xf9,0x00,0xcf,0xd1,0x00,0x00,
+0x03,0xff,0xb0,0x00,0x1d,0xfb,0x37,0x01,0x08,0x80,0x28,0xcf,0xfe,0xc7,0x10,0x00,
+0x00,0x07,0x5a,0x00,0x10,0xe5,0xa9,0x00,0xf1,0x07,0xfd,0xcf,0xff,0xff,0x50,0x02,
+0xff,0xfa,0x10,0x00,0x5e,0xff,0xe1,0x08,0xff,0xd0,0x00,0x00,0x02,0xff,0xf6,0x0a,
+0x26,0x01,0x21,0xbf,0xf8,0x10,0x00,0x82,0x00,0x01,0x10,0x04,0xff,0xfa,0x20,0x00,
+0x4b,0x01,0x42,0xfd,0x84,0x00,0x00,0x40,0x00,0x10,0xfa,0x89,0x00,0x51,0x17,0xcf,
+0xff,0xff,0xfb,0x15,0x01,0x43,0x48,0xdf,0xff,0xc0,0xea,0x00,0x40,0xf6,0x15,0x54,
+0x00,0x40,0x00,0x40,0xfa,0x3f,0xff,0x10,0x0e,0x01,0x41,0xfb,0x0f,0xff,0x80,0x10,
+0x00,0xd0,0x08,0xff,0xf9,0x10,0x00,0x19,0xff,0xf4,0x00,0xcf,0xff,0xfd,0xcd,0xab,
+0x01,0x10,0x09,0x88,0x00,0x9f,0xf9,0x00,0x00,0x00,0x38,0xce,0xff,0xc8,0x20,0xd7,
+0x01,0xe1,0x32,0xfc,0x94,0x00,0xff,0x02,0x04,0x1a,0x03,0x33,0x06,0xff,0xfc,0x0a,
+0x00,0x34,0x26,0xcf,0xf7,0xb7,0x01,0x23,0xef,0xb0,0x09,0x00,0x14,0x0d,0xdd,0x01,
+0x32,0x18,0xff,0x70,0x09,0x00,0x14,0xaf,0x9f,0x00,0x3f,0x09,0xec,0x60,0xe3,0x01,
+0x8b,0x42,0xcf,0xff,0xd8,0x20,0xb4,0x02,0x22,0x10,0x00,0xae,0x01,0x12,0xf8,0x6d,
+0x01,0x13,0x8e,0xd4,0x02,0x13,0x01,0x7e,0x01,0x31,0x00,0xff,0x90,0x07,0x00,0x11,
+0x1a,0x51,0x01,0x00,0xf9,0x01,0x01,0x0f,0x00,0x31,0x0b,0xeb,0x50,0xcf,0x01,0x60,
+0xfa,0x00,0x00,0xdf,0xf2,0x00,0xf5,0x02,0x42,0xf8,0x00,0xbf,0xf4,0x0e,0x03,0x34,
+0xf6,0x9f,0xf6,0x0f,0x01,0x13,0xf9,0x22,0x01,0x24,0xdf,0xfb,0x2b,0x04,0x2f,0x87,
+0x10,0x46,0x04,0xfd,0x03,0xfe,0x00,0x61,0xff,0xa0,0x00,0x1d,0xfe,0x10,0x49,0x01,
+0x21,0xcf,0xf3,0x5f,0x00,0x32,0x5a,0xff,0x40,0xed,0x00,0x12,0xf6,0x73,0x01,0x04,
+0x66,0x02,0x1f,0x33,0x4e,0x04,0x0e,0x1c,0xf5,0x6b,0x02,0x1f,0xf1,0x6b,0x02,0x03,
+0x2f,0x00,0x00,0x6b,0x02,0x1e,0x1f,0x55,0x6b,0x02,0x0c,0x1c,0xbf,0x6b,0x02,0x11,
+0x28,0x4e,0x04,0x24,0x2f,0xff,0x01,0x00,0x15,0xa2,0x0a,0x00,0xc1,0xfa,0x1e,0xee,
+0xee,0xee,0xef,0xff,0xee,0xee,0xee,0xee,0x90,0xcc,0x01,0x14,0xf6,0xcc,0x00,0x22,
+0x0e,0xff,0x3f,0x03,0x0f,0x15,0x00,0xcc,0x25,0x06,0xfe,0xbe,0x01,0x34,0xaf,0xfc,
+0x40,0x15,0x00,0x34,0xbf,0xff,0x20,0x16,0x00,0x15,0x4f,0x2b,0x00,0x34,0x01,0xff,
+0x70,0x29,0x02,0x25,0xaf,0xf3,0x54,0x00,0x14,0xf9,0x1f,0x00,0x31,0xde,0xb5,0x00,
+0xc7,0x02,0x21,0x88,0x70,0xb6,0x04,0x1f,0xe0,0x06,0x00,0x01,0x10,0xdf,0x74,0x01,
+0x12,0x60,0x06,0x00,0x6e,0x89,0x9c,0xff,0xf9,0x99,0x40,0x2a,0x00,0x0f,0x06,0x00,
+0x1e,0x13,0x05,0x06,0x00,0x10,0xf0,0x7e,0x00,0x02,0xa9,0x02,0x71,0xef,0xff,0xee,
+0x80,0x00,0x00,0x5f,0x50,0x03,0x40,0x04,0xdf,0xfe,0x50,0x59,0x08,0x12,0xf3,0x44,
+0x03,0x00,0x3a,0x05,0x21,0x37,0xcf,0x26,0x00,0x21,0x0f,0xfa,0xc3,0x00,0x10,0xfa,
+0xdc,0x00,0x20,0x9f,0xf5,0x44,0x02,0x01,0x9a,0x02,0x21,0xae,0xb5,0xc7,0x00,0x51,
+0x20,0x00,0x06,0x87,0x00,0x70,0x04,0x33,0xfd,0x10,0x07,0x3b,0x01,0x34,0x1d,0xfc,
+0x05,0x05,0x01,0x24,0x2e,0xfb,0x9e,0x04,0x22,0x00,0x3f,0xff,0x03,0x01,0xa8,0x02,
+0x1f,0x70,0x6b,0x07,0x06,0x0f,0x7f,0x02,0xff,0x03,0x32,0x00,0x78,0x81,0xe2,0x05,
+0x12,0xf2,0x07,0x00,0x12,0xf1,0x88,0x04,0x12,0xe0,0xfa,0x06,0x11,0xa0,0xe3,0x06,
+0x20,0xff,0x30,0xe9,0x01,0x22,0x1c,0xf8,0xf0,0x01,0x14,0x50,0xf7,0x01,0x0a,0x07,
+0x00,0x02,0x54,0x02,0x04,0x07,0x00,0x03,0x5c,0x02,0x0e,0x2a,0x00,0x0f,0x07,0x00,
+0x29,0x02,0x68,0x02,0x03,0x69,0x02,0x04,0x6a,0x02,0x03,0x6b,0x02,0x03,0x6c,0x02,
+0x5f,0x00,0x04,0xcf,0xfd,0x50,0xea,0x01,0x44,0x71,0x08,0xbb,0xbf,0xff,0xdb,0xbb,
+0x50,0xfc,0x04,0x00,0x52,0x00,0x12,0xf7,0x91,0x05,0x00,0x01,0x00,0x1f,0x70,0xea,
+0x01,0x8e,0x2f,0x6f,0xfe,0x06,0x00,0x07,0x10,0x0d,0xc3,0x00,0x12,0xf6,0x06,0x00,
+0x6e,0x08,0x99,0xcf,0xff,0x99,0x94,0x24,0x00,0x11,0x3f,0xe8,0x00,0x02,0x06,0x00,
+0x6f,0x2b,0xbb,0xdf,0xff,0xbb,0xbb,0x54,0x00,0x0a,0x00,0x91,0x01,0x02,0x06,0x00,
+0x12,0xff,0xa1,0x03,0x11,0x60,0x97,0x00,0x20,0xfe,0xe8,0xbf,0x01,0x01,0x67,0x08,
+0x33,0x4c,0xff,0xd5,0xd6,0x04,0x10,0x32,0x06,0x00,0x61,0x7e,0xfc,0x50,0x00,0x7f,
+0xe0,0x84,0x06,0x40,0xff,0xe9,0xaf,0xfb,0xaf,0x03,0x60,0xfd,0x9c,0xff,0xff,0xff,
+0x30,0x22,0x05,0x50,0x10,0x03,0xae,0xfc,0x30,0x81,0x09,0x1f,0x40,0xdd,0x03,0x06,
+0x23,0x8f,0xfc,0xad,0x09,0x33,0xf8,0xff,0xc0,0x90,0x07,0x0f,0x13,0x00,0x7d,0x13,
+0xd0,0x13,0x00,0x23,0x7f,0xfe,0x39,0x0c,0x13,0xe4,0xa3,0x08,0x12,0xbf,0x42,0x07,
+0x00,0xa2,0x04,0x41,0x70,0xaf,0xff,0x40,0x62,0x09,0xf1,0x01,0xf1,0x01,0xef,0xff,
+0x82,0x00,0x00,0x5d,0xff,0xf6,0x00,0x03,0xff,0xff,0xfe,0xde,0x35,0x01,0x20,0x02,
+0xcf,0x7f,0x01,0x10,0xe6,0x2b,0x00,0x45,0x39,0xce,0xff,0xdb,0xe5,0x01,0xc1,0x42,
+0x00,0x00,0x06,0xdf,0xea,0x51,0x07,0xff,0x20,0x00,0x7f,0x5d,0x08,0xff,0x00,0x00,
+0x00,0xff,0xe9,0xae,0xff,0xff,0xe3,0x00,0x02,0xdd,0x10,0x00,0x47,0x85,0x7f,0x0c,
+0x07,0x22,0x9f,0xfa,0x25,0x02,0x0f,0x08,0x00,0x55,0x21,0x7f,0xfd,0xc8,0x06,0x40,
+0xf6,0x4f,0xff,0x30,0x2a,0x09,0x40,0xf6,0x0e,0xff,0xd3,0xd4,0x09,0x50,0xf6,0x07,
+0xff,0xff,0xee,0x7f,0x02,0x20,0x00,0xaf,0x06,0x00,0xd0,0xcf,0xf6,0x00,0x04,0xbe,
+0xfe,0xc8,0x20,0xbf,0xf6,0x00,0x00,0x99,0x01,0x00,0x51,0x96,0x00,0x00,0x00,0x1f,
+0x7c,0x02,0x10,0xb0,0x3f,0x00,0x00,0x01,0x00,0x2f,0xfb,0x00,0x01,0x00,0x13,0x1f,
+0x08,0x10,0x02,0x86,0x05,0x13,0x00,0x13,0xfd,0x13,0x00,0x32,0xf7,0xff,0xe0,0xcc,
+0x02,0x42,0xfe,0x4f,0xff,0x10,0x5d,0x04,0x32,0xb0,0xff,0xf8,0x91,0x05,0x41,0xf7,
+0x0a,0xff,0xf4,0x7a,0x0a,0x30,0xff,0x10,0x1e,0xc6,0x0a,0x40,0x05,0xdf,0xff,0x60,
+0x95,0x03,0x21,0xed,0xef,0xf8,0x04,0x14,0x2c,0x2f,0x0b,0x90,0x00,0x03,0x9c,0xef,
+0xfd,0xb6,0x00,0x00,0x00,0x30,0x00,0xdf,0xff,0x01,0x00,0x15,0x00,0x08,0x00,0x20,
+0x89,0x99,0x01,0x00,0x1f,0x00,0x01,0x00,0x05,0x20,0x9f,0xfa,0x06,0x00,0x2f,0xef,
+0xf6,0x08,0x00,0x55,0xf0,0x13,0x7f,0xfd,0x00,0x00,0x00,0x01,0xff,0xf6,0x4f,0xff,
+0x30,0x00,0x00,0x0a,0xff,0xf6,0x0e,0xff,0xd3,0x00,0x04,0xcf,0xff,0xf6,0x07,0xff,
+0xff,0xee,0xff,0xff,0xff,0xf6,0x00,0xaf,0x06,0x00,0xf0,0x0c,0xcf,0xf6,0x00,0x04,
+0xbe,0xfe,0xc8,0x20,0xbf,0xf6,0x00,0x00,0x7f,0xf3,0x00,0x00,0xbf,0xf0,0x00,0x00,
+0x00,0x05,0xff,0x70,0x00,0x1e,0xfc,0x47,0x00,0x60,0x0e,0xff,0x73,0x4c,0xff,0x60,
+0x0a,0x00,0x51,0x3e,0xff,0xff,0xff,0x90,0xc9,0x00,0x4f,0x19,0xdf,0xfb,0x50,0xe2,
+0x00,0x02,0x31,0x08,0xff,0xc0,0x08,0x00,0x41,0x6f,0xff,0x8f,0xfc,0x09,0x00,0x3f,
+0x06,0xff,0xf8,0x13,0x00,0x7c,0x13,0xfd,0x13,0x00,0x31,0xf7,0xff,0xe0,0x0a,0x00,
+0x50,0x8f,0xfe,0x4f,0xff,0x10,0x09,0x00,0x50,0x0b,0xff,0xb0,0xff,0xf8,0x09,0x00,
+0x60,0x02,0xff,0xf7,0x0a,0xff,0xf4,0x0a,0x00,0xf0,0x09,0xcf,0xff,0x10,0x1e,0xff,
+0xf8,0x20,0x00,0x05,0xdf,0xff,0x60,0x00,0x3f,0xff,0xff,0xed,0xef,0xff,0xff,0x80,
+0x00,0x00,0x2c,0xee,0x01,0x10,0xfe,0x14,0x01,0x50,0x03,0x9c,0xef,0xfd,0xb6,0x2a,
+0x00,0xc0,0x3f,0xf7,0x00,0x00,0x8f,0xf2,0x00,0x00,0x0e,0xfe,0x40,0x05,0x59,0x00,
+0x10,0x05,0x23,0x00,0x91,0x40,0x00,0x00,0x00,0x3b,0xff,0xff,0xb3,0x00,0x56,0x00,
+0x1f,0x20,0x12,0x02,0xa2,0x42,0x00,0x00,0x69,0x82,0xac,0x00,0x42,0x01,0xdf,0xff,
+0xf6,0x0a,0x00,0x41,0xaf,0x80,0x3e,0xf1,0x09,0x00,0x51,0x0f,0xd0,0x00,0x6f,0x60,
+0x0a,0x00,0x41,0xfb,0x00,0x04,0xf7,0x09,0x00,0x51,0x0d,0xf2,0x00,0xaf,0x40,0x0a,
+0x00,0x42,0x4f,0xfa,0xdf,0xb0,0x30,0x00,0x3f,0x4c,0xfe,0x80,0x11,0x03,0x03,0x0f,
+0x25,0x02,0x86,0x06,0x13,0x00,0x13,0xd0,0x13,0x00,0x23,0x7f,0xfe,0xe1,0x02,0x22,
+0xe4,0xff,0xfc,0x00,0x41,0xbf,0xfb,0x0f,0xff,0xd7,0x00,0x41,0x2f,0xff,0x70,0xaf,
+0xeb,0x01,0xf0,0x04,0x0c,0xff,0xf1,0x01,0xef,0xff,0x82,0x00,0x00,0x5d,0xff,0xf6,
+0x00,0x03,0xff,0xff,0xfe,0xde,0xff,0x51,0x02,0x20,0x02,0xcf,0x0c,0x02,0x10,0xe6,
+0x2b,0x00,0x51,0x39,0xce,0xff,0xdb,0x60,0x0d,0x02,0x21,0xbf,0xfa,0x74,0x02,0x41,
+0x1e,0xfb,0xcf,0xd1,0x08,0x02,0x31,0x60,0x07,0xf7,0x71,0x02,0x31,0x00,0x01,0xfb,
+0x5d,0x00,0x31,0x10,0x02,0xfa,0x78,0x00,0x32,0xb1,0x1b,0xf5,0x9c,0x02,0x21,0xff,
+0xa0,0x76,0x00,0x2f,0x59,0x84,0x46,0x02,0xa4,0x41,0xef,0xf7,0x01,0xef,0x5e,0x03,
+0x51,0x7f,0xfc,0x00,0xcf,0xfa,0xfc,0x00,0x22,0xff,0x20,0x68,0x01,0x61,0x09,0xff,
+0x60,0x4f,0xfd,0x10,0x79,0x03,0x31,0xa0,0x1e,0xfe,0x27,0x03,0x5f,0x48,0x71,0x04,
+0x88,0x30,0x33,0x02,0xfb,0x60,0x00,0xaf,0xfb,0x00,0xcf,0xfc,0x6b,0x04,0x50,0xfe,
+0x10,0x8f,0xfd,0x10,0x3c,0x00,0x40,0x50,0x4f,0xfe,0x20,0x6b,0x04,0x30,0xa0,0x1e,
+0xff,0x2d,0x01,0x40,0xdf,0xe0,0x0b,0xff,0x97,0x05,0x5f,0x28,0x83,0x02,0x88,0x50,
+0x27,0x02,0x08,0x31,0x09,0xff,0xa0,0xd8,0x05,0x1f,0x60,0x11,0x00,0x53,0x04,0x2e,
+0x02,0x30,0x04,0xff,0xf3,0xc6,0x00,0x24,0xff,0x60,0x2f,0x02,0x95,0x00,0x7f,0xff,
+0xfe,0xef,0xff,0xff,0xff,0x60,0x30,0x02,0x8f,0x00,0x4b,0xef,0xec,0x82,0x0b,0xff,
+0x60,0xe5,0x01,0xa1,0x14,0xf4,0xe5,0x01,0x15,0xfe,0xe5,0x01,0x14,0xb0,0xe5,0x01,
+0x14,0xf7,0xe5,0x01,0x23,0xff,0x10,0xe5,0x01,0x23,0xff,0x70,0xe5,0x01,0x22,0xff,
+0xa0,0xe5,0x01,0x22,0xff,0xff,0x24,0x05,0x33,0x04,0xff,0xfd,0x29,0x06,0x11,0xcf,
+0x14,0x03,0x01,0x49,0x00,0x03,0x12,0x00,0x12,0x04,0x05,0x04,0x00,0x04,0x02,0x23,
+0xf9,0x00,0x95,0x05,0x52,0xff,0xf9,0xaa,0x00,0x00,0x46,0x03,0x23,0xff,0xc0,0x0a,
+0x00,0x2f,0xef,0xc5,0x14,0x04,0x84,0x13,0xf5,0x14,0x04,0x20,0x10,0xdf,0x5f,0x07,
+0x00,0x1a,0x01,0x12,0x40,0x34,0x01,0x02,0x0f,0x00,0x13,0x03,0x5f,0x08,0x13,0x08,
+0x17,0x00,0x13,0x09,0x08,0x00,0x42,0x07,0xff,0xd9,0xb5,0xed,0x00,0x12,0xff,0x65,
+0x06,0x33,0x3c,0xfe,0xa2,0x00,0x01,0x1a,0x78,0x26,0x04,0x39,0xaf,0xfe,0x20,0x2d,
+0x04,0x37,0xfd,0xfd,0x10,0x0f,0x00,0x47,0x7f,0xf6,0x1d,0xfc,0x0f,0x00,0x56,0x5f,
+0xf8,0x00,0x1e,0xfa,0x0f,0x00,0x7f,0x07,0x86,0x00,0x00,0x28,0x82,0x00,0x01,0x00,
+0x10,0x22,0xcf,0xf9,0x06,0x02,0x11,0xb0,0x46,0x00,0x22,0xff,0x09,0x79,0x01,0x23,
+0xaf,0xff,0x02,0x09,0x22,0x5f,0xff,0x38,0x09,0x12,0xf4,0x2c,0x00,0x11,0x01,0xf8,
+0x02,0x12,0x03,0xe1,0x01,0x60,0x0f,0xff,0x50,0x0d,0xff,0x70,0x8c,0x00,0x21,0xff,
+0xfd,0x16,0x00,0x41,0xf1,0x00,0x9f,0xfb,0x0a,0x01,0x20,0xdf,0xf1,0x16,0x00,0x50,
+0xfd,0x00,0x06,0xff,0xe0,0xea,0x00,0x30,0xe8,0xff,0x60,0x48,0x01,0x12,0x90,0xfe,
+0x01,0x41,0x5f,0xfa,0x4f,0xfa,0x67,0x01,0x01,0x04,0x00,0x00,0x32,0x05,0x00,0x26,
+0x00,0x31,0x1f,0xff,0x20,0x23,0x00,0x71,0x00,0xef,0xf1,0x0b,0xff,0x30,0x00,0x79,
+0x08,0x92,0x6f,0xfd,0x00,0x00,0x2f,0xfc,0x00,0x6f,0xf7,0x03,0x02,0xe0,0x02,0xff,
+0xf1,0x00,0x07,0xff,0x80,0x02,0xff,0xb0,0x00,0x0c,0xff,0x60,0x80,0x00,0x91,0x40,
+0x00,0xbf,0xf3,0x00,0x0e,0xff,0x00,0x00,0x97,0x00,0xc1,0xbf,0xf8,0x00,0x0f,0xfe,
+0x00,0x00,0x9f,0xf4,0x00,0x3f,0xff,0x6a,0x01,0x10,0xb0,0x65,0x02,0x40,0x05,0xff,
+0x80,0x07,0xde,0x00,0x00,0x15,0x00,0x81,0x9f,0xf5,0x00,0x00,0x0f,0xfd,0x00,0xbf,
+0x7a,0x01,0x30,0xff,0xf2,0x0d,0x2d,0x09,0x51,0xcf,0xf1,0x0e,0xff,0x30,0xb6,0x00,
+0x30,0x61,0xff,0xc0,0x36,0x00,0x31,0x52,0xff,0xf0,0x70,0x01,0x30,0xf9,0x6f,0xf8,
+0x36,0x00,0x32,0xfa,0x5f,0xfc,0xb0,0x02,0x11,0xb9,0x27,0x00,0x22,0xef,0xd7,0xdd,
+0x02,0x50,0x0f,0xfe,0xdf,0xe0,0x00,0xd6,0x00,0x03,0xf0,0x01,0x32,0xcf,0xff,0xfa,
+0x42,0x01,0x14,0xff,0xc2,0x02,0x12,0x50,0xe6,0x01,0x22,0xc0,0x00,0x18,0x00,0x12,
+0xf1,0x25,0x02,0x13,0xf9,0xeb,0x02,0x12,0xfc,0xd5,0x01,0x12,0xff,0xdd,0x04,0x02,
+0x48,0x01,0x23,0x00,0x04,0x78,0x03,0x00,0x40,0x06,0x13,0xef,0x02,0x03,0x03,0xaf,
+0x08,0x17,0xa0,0xb3,0x01,0x26,0xe5,0xff,0x84,0x08,0x55,0xbf,0xf2,0x04,0xff,0x60,
+0x16,0x05,0x33,0xf4,0x00,0x06,0x68,0x02,0x0f,0x01,0x00,0x14,0x11,0x1f,0x30,0x0a,
+0x21,0xff,0xe0,0x9b,0x03,0x20,0x10,0xdf,0xa1,0x07,0x01,0xf6,0x02,0x40,0x06,0xff,
+0xc0,0x08,0x8e,0x01,0x11,0x09,0x47,0x0a,0x50,0xaf,0xf8,0x00,0x4f,0xfd,0x96,0x05,
+0x00,0x2b,0x04,0x00,0x2f,0x01,0x20,0xff,0xf1,0x30,0x00,0x70,0xff,0x20,0x00,0x02,
+0xff,0xf0,0x00,0xaa,0x05,0xf0,0x14,0x07,0xff,0x9f,0xf6,0x00,0x00,0x6f,0xfa,0x00,
+0x00,0x7f,0xf9,0x00,0x00,0xcf,0xe1,0xff,0xb0,0x00,0x0a,0xff,0x60,0x00,0x02,0xff,
+0xd0,0x00,0x1f,0xf9,0x0c,0xff,0x00,0x00,0xef,0xf2,0x3a,0x00,0x90,0x10,0x05,0xff,
+0x50,0x7f,0xf5,0x00,0x1f,0xfd,0x55,0x00,0xa0,0xf5,0x00,0xaf,0xf0,0x02,0xff,0xa0,
+0x05,0xff,0x90,0xf9,0x05,0x90,0x90,0x0e,0xfb,0x00,0x0d,0xfe,0x00,0x9f,0xf4,0x96,
+0x00,0x91,0xfd,0x03,0xff,0x60,0x00,0x9f,0xf3,0x0d,0xff,0xf0,0x00,0x91,0xf1,0x8f,
+0xf2,0x00,0x04,0xff,0x81,0xff,0xb0,0x94,0x02,0x81,0x5d,0xfd,0x00,0x00,0x0e,0xfd,
+0x5f,0xf7,0x3c,0x04,0x30,0xfb,0xff,0x80,0x4e,0x06,0x21,0xff,0x30,0xd2,0x01,0x21,
+0xff,0xf3,0xae,0x0a,0x12,0xe0,0x67,0x08,0x11,0xfe,0xa4,0x02,0x13,0xfa,0xdd,0x04,
+0x10,0xa0,0x2d,0x01,0x22,0xff,0x50,0x15,0x0b,0x11,0xf5,0xf4,0x02,0x13,0xf1,0x7c,
+0x01,0x10,0x10,0x73,0x00,0x14,0xfc,0x79,0x01,0x15,0x87,0x1d,0x01,0x35,0x2e,0xff,
+0xa0,0x81,0x01,0x14,0xdf,0xa6,0x04,0x54,0x0c,0xfe,0x15,0xff,0x60,0x7c,0x01,0x23,
+0x00,0x6f,0xee,0x03,0x5f,0x88,0x30,0x00,0x05,0x87,0x66,0x01,0x06,0x12,0x7f,0xe7,
+0x01,0x00,0x23,0x07,0x13,0x0e,0x6e,0x05,0x43,0x4f,0xff,0x70,0x06,0x84,0x0a,0x62,
+0xcf,0xfe,0x00,0x00,0xdf,0xfd,0x00,0x02,0x10,0xf6,0x1a,0x00,0x11,0x60,0x2b,0x00,
+0x13,0xd0,0x05,0x00,0x20,0x00,0x5f,0xd3,0x01,0x11,0x03,0x2d,0x00,0x21,0xcf,0xfc,
+0x9e,0x03,0x10,0xfd,0xe7,0x00,0x12,0xf3,0x50,0x05,0x52,0x60,0x00,0x0d,0xff,0xa0,
+0x73,0x02,0x31,0xd0,0x00,0x5f,0x5f,0x05,0x00,0xbc,0x04,0x34,0x00,0xdf,0xf9,0x38,
+0x04,0x14,0x05,0x56,0x02,0x34,0x0e,0xff,0x6d,0x3a,0x02,0x32,0x06,0xff,0xff,0xed,
+0x05,0x01,0xd6,0x01,0x15,0xf7,0x47,0x04,0x03,0x9e,0x00,0x01,0x2d,0x00,0x1f,0x70,
+0x0b,0x00,0x57,0x13,0x07,0x21,0x01,0x10,0x04,0x54,0x02,0x01,0xa2,0x01,0x22,0xbd,
+0xfd,0x78,0x01,0x33,0xd1,0x2e,0xfa,0x6b,0x01,0x20,0x4f,0xf7,0x10,0x08,0x5f,0x84,
+0x00,0x00,0x58,0x70,0x62,0x01,0x01,0x11,0x10,0xee,0x01,0x31,0x61,0xff,0xf6,0xf2,
+0x0d,0x21,0xf1,0x0c,0x2e,0x02,0x61,0xaf,0xfc,0x00,0x6f,0xff,0x10,0xbb,0x07,0x00,
+0x14,0x01,0x00,0xa4,0x04,0x00,0x1c,0x0d,0x02,0x7b,0x09,0x20,0x6f,0xff,0xfd,0x01,
+0x50,0x60,0x00,0x01,0xff,0xf5,0x5c,0x04,0x00,0x33,0x02,0x10,0xa0,0xd3,0x09,0x00,
+0x07,0x01,0x21,0x00,0x0b,0x9c,0x00,0x51,0xff,0xf5,0x01,0xff,0xf1,0xe7,0x03,0x32,
+0xa0,0x5f,0xfc,0x21,0x01,0x12,0x0a,0xb5,0x00,0x51,0xff,0xf4,0xef,0xf1,0x00,0x1a,
+0x00,0x23,0xdf,0xfc,0xd1,0x01,0x03,0xce,0x00,0x33,0xef,0xff,0xf1,0x03,0x04,0x03,
+0x53,0x02,0x14,0x4f,0xe7,0x00,0x00,0x04,0x03,0x17,0x00,0x6c,0x02,0x14,0x07,0x19,
+0x00,0x23,0xdf,0xf2,0x7f,0x01,0x12,0xfc,0x6e,0x02,0x32,0x6f,0xff,0x40,0x1e,0x04,
+0x22,0xff,0xb0,0x88,0x05,0x21,0xff,0xd1,0x19,0x00,0x80,0x6e,0xfd,0x80,0x00,0x00,
+0x00,0x00,0x00,0x90,0x00,0x00,0x02,0xbc,0x40,0x00,0x06,0xc9,0x00,0x01,0x00,0x72,
+0x0b,0xff,0xe0,0x00,0x2f,0xff,0x70,0x0b,0x00,0x50,0xf0,0x00,0x2f,0xff,0x80,0x0b,
+0x00,0x8f,0x03,0xee,0x60,0x00,0x09,0xfc,0x10,0x00,0x01,0x00,0x0f,0x31,0x7f,0xff,
+0x50,0x08,0x00,0x61,0x0c,0xff,0xf1,0x0e,0xff,0xd0,0x0b,0x00,0x61,0x4f,0xff,0x70,
+0x06,0xff,0xf6,0x0b,0x00,0x60,0xcf,0xfe,0x00,0x00,0xdf,0xfd,0x0a,0x00,0x30,0x04,
+0xff,0xf6,0x1a,0x00,0x11,0x60,0x2b,0x00,0x13,0xd0,0x05,0x00,0x71,0x00,0x5f,0xff,
+0x40,0x00,0x00,0x03,0x2d,0x00,0x20,0xcf,0xfc,0x27,0x00,0x70,0xaf,0xfd,0x00,0x00,
+0x05,0xff,0xf3,0x0b,0x00,0x70,0x2f,0xff,0x60,0x00,0x0d,0xff,0xa0,0x0b,0x00,0x70,
+0x09,0xff,0xd0,0x00,0x5f,0xff,0x20,0x0b,0x00,0x62,0x01,0xff,0xf6,0x00,0xdf,0xf9,
+0x7c,0x00,0x52,0x8f,0xfd,0x05,0xff,0xf1,0x0b,0x00,0x52,0x0e,0xff,0x6d,0xff,0x80,
+0x0b,0x00,0x44,0x06,0xff,0xff,0xfe,0x9e,0x00,0x34,0xdf,0xff,0xf7,0x0b,0x00,0x13,
+0x5f,0x9e,0x00,0x01,0x2d,0x00,0x1f,0x70,0x0b,0x00,0x58,0x43,0x00,0x05,0x88,0x71,
+0x0a,0x00,0x14,0x3f,0xa4,0x00,0x44,0x00,0xcf,0xfa,0x00,0xae,0x00,0x13,0xc0,0x0a,
+0x00,0x24,0x1f,0xfd,0x70,0x01,0x2f,0xaf,0xe2,0x6e,0x01,0x05,0x23,0x4f,0xff,0x01,
+0x00,0x16,0x90,0x0a,0x00,0x21,0x3e,0xee,0x01,0x00,0x15,0xef,0x5c,0x00,0x14,0xdf,
+0xff,0x00,0x35,0x09,0xff,0xf4,0x38,0x00,0x13,0x90,0x0a,0x00,0x25,0xef,0xfd,0x1d,
+0x00,0x15,0xf3,0x1d,0x00,0x03,0x3a,0x00,0x15,0x01,0x1d,0x00,0x35,0x0a,0xff,0xf2,
+0x37,0x01,0x14,0x70,0x1d,0x00,0x13,0xfc,0x13,0x00,0x15,0x0b,0x1d,0x00,0x32,0x6f,
+0xff,0x60,0x09,0x00,0x54,0x02,0xff,0xfb,0x00,0x00,0x08,0x02,0x0a,0x1a,0x02,0x00,
+0x1d,0x00,0x15,0xfa,0x1d,0x00,0x23,0xe1,0x00,0xbb,0x01,0x04,0x1d,0x00,0x15,0x03,
+0x1d,0x00,0x35,0x0d,0xff,0xe0,0x57,0x00,0x21,0xed,0xdd,0x01,0x00,0x24,0xd1,0x7f,
+0xe6,0x00,0x16,0xf2,0x0a,0x00,0x02,0xa0,0x00,0x13,0xf3,0xbb,0x00,0x12,0x40,0xf3,
+0x00,0x02,0x6f,0x02,0x13,0x08,0xe7,0x00,0x13,0x2f,0x8e,0x00,0x2f,0x48,0x70,0x44,
+0x01,0x07,0x14,0xf2,0x08,0x00,0x88,0x3c,0xcc,0xcc,0xcc,0xcc,0xcf,0xff,0xe0,0xb5,
+0x00,0x33,0x03,0xff,0xf9,0x94,0x00,0x02,0x35,0x02,0x31,0x9f,0xff,0x30,0xca,0x01,
+0x03,0x4f,0x02,0x13,0x1e,0xb5,0x01,0x21,0xbf,0xfe,0xb3,0x01,0x33,0x07,0xff,0xf5,
+0xdf,0x01,0x12,0x90,0x8e,0x00,0x18,0xfd,0x62,0x01,0x00,0x10,0x03,0x08,0x41,0x01,
+0x33,0x0b,0xff,0xf1,0x5a,0x01,0x63,0xeb,0xbb,0xbb,0xbb,0xbb,0xb7,0xda,0x00,0x14,
+0xfa,0x08,0x00,0x01,0x87,0x00,0x14,0xd3,0xae,0x00,0x2e,0xff,0xfa,0x0a,0x00,0x2f,
+0x5c,0xb2,0x20,0x02,0xff,0x0d,0x35,0x4e,0xe5,0x00,0x7f,0x04,0x01,0x08,0x00,0x03,
+0xb8,0x00,0x2f,0x3b,0xc3,0x10,0x02,0xa2,0x61,0x38,0x82,0x00,0x00,0x68,0x71,0x2c,
+0x00,0x33,0xfe,0x10,0x06,0x8e,0x01,0x33,0xcf,0xd0,0x4f,0x07,0x05,0x43,0x1d,0xfc,
+0xff,0xa0,0x4a,0x01,0x24,0xef,0xfb,0xd6,0x00,0x2f,0x38,0x70,0x24,0x02,0xff,0x0b,
+0x60,0x1e,0xfc,0x00,0x00,0xbf,0xf3,0x3b,0x00,0x21,0xa0,0x09,0x47,0x00,0x42,0x6f,
+0xf8,0x7f,0xf8,0xd3,0x00,0x03,0x4d,0x01,0x13,0xcf,0xab,0x00,0x2f,0x17,0x81,0x34,
+0x02,0xa1,0xf0,0x00,0x02,0xae,0xff,0xc2,0x00,0x6f,0xff,0xff,0xf1,0x03,0xff,0xff,
+0xec,0xd0,0x0a,0xc5,0x01,0x10,0x0f,0x43,0x00,0x30,0x1f,0xff,0x30,0x5a,0x07,0x10,
+0x10,0x69,0x00,0x0f,0x05,0x00,0x4f,0x50,0x3f,0xff,0x10,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -1529,11 +2235,34 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 192, .range_length = 192, .glyph_id_start = 112, .list_length = 0, .type = 2, .unicode_list = 0, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[82433] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 3070, .size = 3995, .comp_size = 2508 },
+{ .bitmap_start = 3995, .comp_offset = 5578, .size = 3985, .comp_size = 2164 },
+{ .bitmap_start = 7980, .comp_offset = 7742, .size = 3994, .comp_size = 2157 },
+{ .bitmap_start = 11974, .comp_offset = 9899, .size = 3917, .comp_size = 1870 },
+{ .bitmap_start = 15891, .comp_offset = 11769, .size = 3961, .comp_size = 2424 },
+{ .bitmap_start = 19852, .comp_offset = 14193, .size = 4070, .comp_size = 2249 },
+{ .bitmap_start = 23922, .comp_offset = 16442, .size = 3831, .comp_size = 1183 },
+{ .bitmap_start = 27753, .comp_offset = 17625, .size = 4054, .comp_size = 1356 },
+{ .bitmap_start = 31807, .comp_offset = 18981, .size = 3923, .comp_size = 1657 },
+{ .bitmap_start = 35730, .comp_offset = 20638, .size = 3937, .comp_size = 1544 },
+{ .bitmap_start = 39667, .comp_offset = 22182, .size = 3772, .comp_size = 1378 },
+{ .bitmap_start = 43439, .comp_offset = 23560, .size = 3927, .comp_size = 1330 },
+{ .bitmap_start = 47366, .comp_offset = 24890, .size = 3907, .comp_size = 1420 },
+{ .bitmap_start = 51273, .comp_offset = 26310, .size = 4087, .comp_size = 1256 },
+{ .bitmap_start = 55360, .comp_offset = 27566, .size = 4051, .comp_size = 1321 },
+{ .bitmap_start = 59411, .comp_offset = 28887, .size = 3970, .comp_size = 1323 },
+{ .bitmap_start = 63381, .comp_offset = 30210, .size = 3994, .comp_size = 1831 },
+{ .bitmap_start = 67375, .comp_offset = 32041, .size = 4062, .comp_size = 1292 },
+{ .bitmap_start = 71437, .comp_offset = 33333, .size = 4013, .comp_size = 1646 },
+{ .bitmap_start = 75450, .comp_offset = 34979, .size = 2159, .comp_size = 602 },
+};
+
+static uint8_t etxUncompBuf[4824] __SDRAMFONTS;
 
 const etxLz4Font lv_font_en_L = {
-.uncomp_size = 82169,
-.comp_size = 24278,
+.uncomp_size = 4560,
+.comp_size = 3070,
 .line_height = 46,
 .base_line = 10,
 .subpx = 0,
@@ -1546,12 +2275,13 @@ const etxLz4Font lv_font_en_L = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 38,
-.glyph_bitmap = 2432,
-.class_pair_values = 80041,
-.left_class_mapping = 81561,
-.right_class_mapping = 81865,
+.class_pair_values = 2432,
+.left_class_mapping = 3952,
+.right_class_mapping = 4256,
+.block_num = 20,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 82433,
+.lvglFontBufSize = 4824,
 };
@@ -154,7 +154,7 @@ static const uint8_t lz4FontData[] ={
 0x08,0x00,0x22,0x12,0xc3,0x08,0x00,0xf2,0x03,0x02,0xc4,0x00,0x1e,0x1f,0x14,0x00,
 0xff,0x38,0xc5,0x00,0x15,0x13,0x18,0x01,0xfd,0x1c,0xc6,0x60,0x00,0x21,0x18,0xc7,
 0xa8,0x00,0xb2,0xfc,0x51,0xc8,0x00,0x1e,0x1e,0x12,0x00,0x00,0x5f,0xc9,0x60,0x00,
-0xf0,0xde,0x37,0xca,0x20,0x18,0x19,0x10,0x00,0x01,0x00,0x00,0x43,0x02,0xdf,0xcf,
+0xf8,0x76,0x37,0xca,0x20,0x18,0x19,0x10,0x00,0x01,0x00,0x00,0x43,0x02,0xdf,0xcf,
 0xe6,0xcf,0xe9,0xcf,0xea,0xcf,0xeb,0xcf,0xef,0xcf,0xf1,0xcf,0xf3,0xcf,0xf7,0xcf,
 0xfa,0xcf,0xff,0xcf,0x04,0xd0,0x05,0xd0,0x06,0xd0,0x1c,0xd0,0x21,0xd0,0x26,0xd0,
 0x29,0xd0,0x2a,0xd0,0x2b,0xd0,0x2f,0xd0,0x30,0xd0,0x31,0xd0,0x32,0xd0,0x45,0xd0,
@@ -162,1351 +162,1731 @@ static const uint8_t lz4FontData[] ={
 0x59,0xd0,0x71,0xd0,0x73,0xd0,0xa2,0xd0,0xa3,0xd0,0xa5,0xd0,0xa7,0xd0,0xbe,0xd0,
 0xc5,0xd0,0xc8,0xd0,0xd1,0xd0,0xfa,0xd0,0x02,0xd1,0x39,0xd1,0xc9,0xd1,0x1e,0xd2,
 0x1f,0xd2,0x20,0xd2,0x21,0xd2,0x22,0xd2,0x65,0xd2,0x71,0xd2,0xcb,0xd2,0xe2,0xd2,
-0x38,0xd5,0xa0,0xd7,0x80,0xd8,0x7f,0xff,0x16,0xff,0xf1,0x6f,0xff,0x05,0xff,0xf0,
-0x5f,0xff,0x04,0xff,0xf0,0x3f,0xfe,0x03,0xff,0xe0,0x2f,0xfd,0x02,0xff,0xd0,0x1f,
-0xfc,0x01,0xee,0xb0,0x00,0x00,0x00,0x58,0x30,0x5f,0xff,0x17,0xff,0xf2,0x1c,0xf9,
-0x00,0x4f,0xf2,0x6f,0xe4,0xff,0x16,0xfe,0x4f,0xf0,0x6f,0xd4,0xff,0x06,0xfb,0x4f,
-0xd0,0x6f,0xa4,0xfb,0x06,0xf8,0x17,0x50,0x37,0x30,0x00,0x00,0x08,0xf9,0x01,0xff,
-0x00,0x00,0x00,0x0b,0xf7,0x04,0xfd,0x00,0x00,0x00,0x0d,0xf4,0x07,0xfb,0x00,0x00,
-0x00,0x0f,0xf1,0x0a,0xf8,0x00,0x00,0x11,0x4f,0xe1,0x1c,0xf6,0x10,0x06,0xff,0x01,
-0x00,0x13,0xfd,0x07,0x00,0xf1,0x07,0x00,0x00,0xcf,0x60,0x5f,0xc0,0x00,0x00,0x00,
-0xff,0x30,0x8f,0x90,0x00,0x00,0x02,0xff,0x00,0xbf,0x60,0x00,0x4f,0x1c,0x00,0x13,
-0xf0,0x07,0x00,0x00,0x4c,0x00,0x17,0xfe,0x4c,0x00,0xf0,0x02,0xf2,0x09,0xf8,0x00,
-0x00,0x00,0x2f,0xf0,0x0c,0xf6,0x00,0x00,0x00,0x5f,0xc0,0x0f,0xf3,0xb7,0x0c,0x20,
-0x02,0x30,0x06,0x00,0x25,0x0a,0xf3,0x06,0x00,0xc0,0x03,0x8e,0xfa,0x40,0x00,0x00,
-0xaf,0xff,0xff,0xfc,0x10,0x09,0x47,0x00,0xd0,0xb0,0x1f,0xff,0xb1,0x19,0xff,0xf3,
-0x3f,0xff,0x30,0x00,0xef,0xf8,0x06,0x00,0x40,0x9c,0xc7,0x1f,0xff,0xd6,0x00,0x51,
-0x09,0xff,0xfe,0x71,0x00,0x2a,0x00,0xf0,0x0d,0x81,0x00,0x00,0x05,0xdf,0xff,0xfe,
-0x30,0x00,0x00,0x04,0xbf,0xff,0xe0,0x00,0x00,0x00,0x05,0xff,0xf6,0xce,0xe7,0x00,
-0x00,0xdf,0xf9,0xcf,0xfb,0x06,0x00,0x70,0x7f,0xff,0x81,0x18,0xff,0xf6,0x1e,0x4e,
-0x00,0xf3,0x03,0xe0,0x02,0xdf,0xff,0xff,0xfd,0x20,0x00,0x04,0x9f,0xf9,0x50,0x00,
-0x00,0x00,0x0e,0xf0,0x00,0x06,0x00,0x40,0x05,0xcf,0xea,0x20,0x0c,0x00,0x40,0x6f,
-0xff,0xff,0xe1,0x08,0x00,0xf2,0x07,0xcf,0xa0,0x2e,0xf6,0x00,0x4f,0x70,0x00,0xef,
-0x50,0x0b,0xf8,0x00,0xef,0x30,0x00,0xcf,0xa0,0x1e,0xf6,0x09,0xf8,0x20,0x00,0x22,
-0x3f,0xd0,0x30,0x00,0x21,0xdf,0x40,0x7a,0x0d,0x22,0x08,0xfa,0x82,0x0d,0x22,0x3f,
-0xe1,0x08,0x00,0xf0,0x06,0xdf,0x52,0xbe,0xeb,0x20,0x00,0x00,0x07,0xfb,0x2f,0xff,
-0xff,0xf2,0x00,0x00,0x2f,0xf1,0x9f,0xd1,0x1e,0xf8,0x30,0x01,0x81,0xbf,0x80,0x09,
-0xfa,0x00,0x07,0xfc,0x00,0x08,0x00,0xb1,0x0d,0xf2,0x00,0x9f,0xd1,0x1d,0xf8,0x00,
-0x00,0x30,0x00,0x28,0x00,0x00,0x0c,0x01,0x01,0x38,0x00,0x31,0x7d,0xff,0xc4,0x0d,
-0x01,0x40,0xff,0xff,0xff,0x60,0x29,0x01,0xc0,0xff,0xdd,0xff,0xf1,0x00,0x00,0x00,
-0x9f,0xf9,0x00,0xbf,0xf4,0xf0,0x00,0x30,0xf5,0x00,0x9f,0x28,0x01,0xd0,0x7f,0xfb,
-0x04,0xff,0xd0,0x00,0x00,0x00,0x1f,0xff,0xcf,0xfe,0x30,0x07,0x0e,0x30,0xff,0xff,
-0xc2,0x38,0x00,0xf1,0x2a,0x1b,0xff,0xff,0x30,0x02,0x66,0x20,0x01,0xdf,0xff,0xff,
-0xe2,0x08,0xff,0x60,0x0a,0xff,0xd2,0xef,0xfd,0x1b,0xff,0x40,0x0f,0xff,0x50,0x2f,
-0xff,0xcf,0xff,0x10,0x2f,0xff,0x40,0x04,0xff,0xff,0xfb,0x00,0x0f,0xff,0xa0,0x00,
-0x6f,0xff,0xf3,0x00,0x09,0xff,0xfc,0x8a,0xff,0xff,0xf5,0x00,0x00,0xcf,0xb5,0x01,
-0xf2,0x08,0x30,0x00,0x06,0xcf,0xfe,0xc8,0x2c,0xff,0xe2,0x4f,0xf3,0x4f,0xf3,0x4f,
-0xf2,0x4f,0xf1,0x4f,0xf0,0x4f,0xf0,0x28,0x70,0xd9,0x00,0xf0,0x38,0x97,0x00,0x00,
-0xcf,0xd0,0x00,0xaf,0xf3,0x00,0x4f,0xf6,0x00,0x0d,0xfd,0x00,0x04,0xff,0x60,0x00,
-0xaf,0xf1,0x00,0x0f,0xfd,0x00,0x02,0xff,0x90,0x00,0x5f,0xf8,0x00,0x07,0xff,0x60,
-0x00,0x8f,0xf5,0x00,0x08,0xff,0x50,0x00,0x7f,0xf6,0x00,0x06,0xff,0x70,0x00,0x4f,
-0xf8,0x00,0x00,0xff,0xc0,0x00,0x0c,0xff,0x00,0x00,0x6f,0xf4,0x00,0x01,0xff,0xa0,
-0x00,0x07,0xff,0x30,0x3c,0x00,0xa0,0x00,0x2e,0xfb,0x00,0x00,0x2d,0x90,0x00,0x00,
-0x01,0x59,0x00,0x21,0x1d,0x30,0x20,0x00,0xd0,0x00,0x0b,0xff,0x20,0x00,0x01,0xef,
-0xc0,0x00,0x00,0x6f,0xf6,0x00,0x58,0x00,0xf0,0x03,0x00,0x0a,0xff,0x30,0x00,0x07,
-0xff,0x80,0x00,0x03,0xff,0xc0,0x00,0x01,0xff,0xf0,0x00,0x00,0x04,0x00,0x00,0x0f,
-0x01,0x21,0xef,0xf1,0x0c,0x00,0x00,0x14,0x00,0xf1,0x00,0x02,0xff,0xd0,0x00,0x05,
-0xff,0x90,0x00,0x09,0xff,0x50,0x00,0x0d,0xfe,0x00,0x74,0x00,0x60,0xcf,0xe1,0x00,
-0x07,0xff,0x50,0x94,0x00,0x61,0x00,0x3f,0x80,0x00,0x00,0x02,0xbf,0x00,0x10,0x8f,
-0x36,0x02,0x20,0x07,0xfa,0x0f,0x00,0xa0,0x7f,0x90,0x01,0x04,0xfc,0x56,0xf8,0x39,
-0xf4,0x8f,0xf5,0x00,0xa0,0x90,0x16,0xbf,0xff,0xc8,0x30,0x00,0x08,0xff,0xf6,0x3b,
-0x02,0xd0,0x6f,0xf3,0x00,0x02,0xff,0x70,0x9f,0xe1,0x00,0x1b,0xd0,0x01,0xec,0xdb,
-0x03,0x11,0x02,0xe5,0x01,0x62,0x88,0x10,0x00,0x00,0x00,0x01,0xa9,0x01,0x3a,0x1f,
-0xff,0x20,0x0d,0x00,0x11,0x05,0x3d,0x01,0x21,0xf5,0x5f,0x07,0x00,0x12,0x55,0x0d,
-0x00,0x6f,0x01,0x11,0x2f,0xff,0x31,0x11,0x34,0x00,0x06,0x00,0x6b,0x00,0xe0,0x70,
-0x5f,0xf7,0x05,0xff,0x70,0x7f,0xf5,0x0b,0xff,0x02,0xff,0x80,0x3d,0x4e,0x03,0xf0,
-0x06,0x8b,0xbb,0xbb,0xab,0xff,0xff,0xfe,0xbf,0xff,0xff,0xe0,0x06,0x94,0x05,0xff,
-0xf2,0x7f,0xff,0x31,0xcf,0xa0,0x31,0x00,0x10,0xf7,0x9c,0x02,0x00,0x3c,0x00,0x20,
-0xbf,0xc0,0x46,0x00,0x40,0x70,0x00,0x00,0x06,0x44,0x00,0x25,0x0b,0xfc,0x1d,0x00,
-0x10,0xf1,0xb6,0x02,0x00,0x1d,0x00,0x00,0x37,0x02,0x70,0x07,0xff,0x10,0x00,0x00,
-0x0c,0xfb,0x1d,0x00,0x10,0xf6,0x2d,0x02,0x01,0x1d,0x00,0x10,0xb0,0xa8,0x03,0x04,
-0x1d,0x00,0x20,0x0d,0xfb,0x0e,0x01,0x10,0x83,0x8e,0x00,0xf0,0x1b,0x18,0xdf,0xfc,
-0x70,0x00,0x02,0xef,0xff,0xff,0xfc,0x00,0x0d,0xff,0xfd,0xef,0xff,0x90,0x5f,0xff,
-0x40,0x08,0xff,0xf1,0x9f,0xfc,0x00,0x00,0xff,0xf5,0xcf,0xf9,0x00,0x00,0xcf,0xf8,
-0xdf,0xf8,0x00,0x00,0xbf,0xf9,0xef,0x06,0x00,0x18,0xfa,0x06,0x00,0x02,0x18,0x00,
-0x00,0x24,0x00,0x22,0xdf,0xf8,0x30,0x00,0x11,0x4f,0x3c,0x00,0x02,0x48,0x00,0x02,
-0x54,0x00,0x01,0x60,0x00,0x00,0xfc,0x00,0x61,0x7c,0x60,0x01,0x6b,0xff,0xf6,0xd9,
-0x02,0xc0,0xff,0xff,0xff,0xf6,0x0f,0xc7,0x2f,0xff,0x60,0x10,0x00,0xff,0xec,0x01,
-0x00,0x97,0x00,0x0f,0x09,0x00,0x19,0x60,0x02,0x9d,0xff,0xd8,0x10,0x00,0x8c,0x04,
-0xf0,0x00,0xfe,0x20,0x04,0xff,0xff,0xce,0xff,0xfc,0x00,0xcf,0xfd,0x20,0x0a,0xff,
-0xf2,0x1d,0x00,0x81,0x3f,0xff,0x41,0x88,0x82,0x00,0x02,0xff,0x55,0x04,0x30,0x7f,
-0xfe,0x00,0x76,0x04,0x20,0xff,0x70,0x68,0x02,0x01,0x32,0x03,0x31,0x0c,0xff,0xe2,
-0x06,0x00,0x15,0xf3,0x06,0x00,0x35,0x0b,0xff,0xf4,0x06,0x00,0x81,0x0a,0xff,0xfe,
-0xcc,0xcc,0xcc,0xa0,0xdf,0xe6,0x04,0x11,0x0d,0xcb,0x01,0x60,0xd0,0x00,0x04,0xae,
-0xfe,0xc7,0x72,0x04,0x00,0x3c,0x04,0x12,0x07,0x6f,0x00,0x10,0xdf,0xa0,0x04,0x80,
-0xf2,0x08,0x99,0x30,0x00,0x1f,0xff,0x40,0xb8,0x04,0x11,0xff,0xbe,0x04,0x21,0xcf,
-0xfc,0x8b,0x03,0x21,0xfc,0x10,0x2b,0x04,0x91,0x50,0x00,0x00,0x04,0xab,0xdf,0xff,
-0x90,0x00,0xc9,0x03,0x01,0xeb,0x04,0xd1,0xef,0xf8,0x2c,0xcc,0x20,0x00,0x0d,0xff,
-0x81,0xff,0xfb,0x00,0x06,0x0e,0x01,0x51,0xce,0xff,0xfe,0x00,0x0b,0xca,0x00,0x51,
-0x00,0x05,0xbe,0xff,0xc7,0xac,0x02,0x12,0x09,0xbd,0x00,0x12,0x3f,0x07,0x00,0x11,
-0xdf,0x07,0x00,0x21,0x08,0xff,0x07,0x00,0x21,0x2f,0xfe,0x07,0x00,0x40,0xcf,0xf5,
-0xff,0xf3,0xcb,0x01,0x10,0x73,0x07,0x00,0x21,0x2f,0xfc,0x7f,0x00,0x20,0xcf,0xf3,
-0x07,0x00,0x30,0x06,0xff,0x80,0x07,0x00,0x72,0x1f,0xff,0xcb,0xbc,0xff,0xfc,0xb1,
-0x94,0x02,0x22,0xf1,0x3f,0x07,0x00,0x05,0xa9,0x00,0x1e,0x00,0x07,0x00,0x01,0xda,
-0x05,0x21,0xf3,0x08,0x06,0x00,0x81,0x0a,0xff,0xed,0xdd,0xdd,0xd2,0x0c,0xff,0x25,
-0x05,0x01,0xb9,0x00,0x40,0x0f,0xff,0x36,0x87,0xec,0x00,0x41,0xff,0xff,0xfb,0x10,
-0x4d,0x00,0x71,0xc0,0x18,0xcc,0x30,0x2b,0xff,0xf4,0xd4,0x00,0x20,0xf9,0x00,0x9a,
-0x02,0x20,0xfb,0x00,0xa0,0x04,0x20,0xfb,0xaf,0x75,0x05,0xf1,0x00,0xfa,0x7f,0xff,
-0x40,0x06,0xff,0xf5,0x0e,0xff,0xfd,0xdf,0xff,0xd0,0x03,0xef,0xde,0x00,0x40,0x17,
-0xcf,0xfd,0x81,0xaa,0x04,0x81,0xbe,0xf5,0x00,0x00,0x04,0xef,0xff,0xf5,0x23,0x01,
-0x91,0xd4,0x00,0x03,0xff,0xfb,0x30,0x00,0x00,0x0d,0x26,0x01,0xd0,0x4f,0xff,0x27,
-0xab,0x81,0x00,0x8f,0xfd,0xef,0xff,0xff,0x40,0xbf,0x66,0x00,0xd0,0xe1,0xcf,0xff,
-0x81,0x19,0xff,0xf7,0xdf,0xfa,0x00,0x00,0xcf,0xfc,0x68,0x02,0x40,0x8f,0xfe,0xbf,
-0xfa,0x06,0x00,0xf0,0x03,0x8f,0xfe,0x00,0x00,0xbf,0xfc,0x3f,0xff,0x70,0x05,0xff,
-0xf7,0x0a,0xff,0xfe,0xdf,0xff,0xe0,0xc3,0x04,0x10,0xfe,0xc1,0x04,0x23,0xfd,0x81,
-0x8a,0x06,0x11,0xc4,0x06,0x00,0x80,0xfc,0x3c,0xcc,0xcc,0xcc,0xcf,0xff,0x80,0x62,
-0x05,0x01,0x02,0x01,0x32,0x00,0x9f,0xfa,0x85,0x03,0x11,0x30,0x56,0x01,0x30,0xc0,
-0x00,0x00,0xb9,0x02,0x06,0x2d,0x02,0x11,0x0e,0x2d,0x02,0x10,0x06,0x6c,0x04,0x00,
-0x3f,0x06,0x02,0xbd,0x01,0x11,0x20,0x2e,0x02,0x11,0xb0,0x2c,0x01,0x11,0xf4,0xef,
-0x00,0x12,0xfd,0x59,0x02,0x10,0x60,0x07,0x00,0x42,0x3a,0xef,0xfd,0x81,0x8f,0x02,
-0xf0,0x00,0x30,0x2f,0xff,0xfc,0xdf,0xff,0xd0,0x6f,0xff,0x30,0x07,0xff,0xf3,0x7f,
-0xfe,0x87,0x02,0x10,0x3f,0x0c,0x00,0x20,0xf0,0x0a,0x18,0x00,0x30,0x60,0x00,0x9f,
-0x6e,0x05,0x11,0x07,0x6c,0x05,0x80,0x3f,0xff,0x71,0x1a,0xff,0xe0,0xaf,0xfb,0xd7,
-0x02,0x10,0xdf,0xb6,0x04,0x30,0xf9,0xdf,0xfa,0x4d,0x01,0x70,0xaf,0xff,0x30,0x06,
-0xff,0xf6,0x3f,0x3b,0x01,0x12,0xe0,0x54,0x00,0x50,0x00,0x3a,0xdf,0xfd,0x81,0x49,
-0x03,0x30,0xeb,0x30,0x00,0x4d,0x01,0x30,0xf7,0x00,0x1e,0x61,0x03,0xf0,0x00,0x40,
-0x7f,0xff,0x40,0x0b,0xff,0xd0,0xcf,0xfa,0x00,0x02,0xff,0xf2,0xef,0xf7,0x48,0x00,
-0x80,0xff,0xf7,0x00,0x00,0xef,0xf7,0xdf,0xfb,0x69,0x02,0x10,0x8f,0x60,0x00,0x11,
-0xf7,0xf8,0x06,0xd1,0xf6,0x03,0xef,0xff,0xfc,0xff,0xf4,0x00,0x06,0x98,0x43,0xff,
-0xf0,0xec,0x02,0xa0,0xa0,0x00,0x00,0x03,0xbf,0xff,0x20,0x00,0x6d,0xff,0x33,0x00,
-0x11,0x7f,0x6d,0x06,0xe2,0x7f,0xec,0x71,0x00,0x00,0x1c,0xf9,0x07,0xff,0xf3,0x5f,
-0xff,0x20,0x69,0xde,0x06,0x04,0x01,0x00,0xfd,0x08,0x69,0x40,0x5f,0xff,0x27,0xff,
-0xf3,0x1c,0xfa,0x00,0x02,0xdf,0x70,0x0a,0xff,0xf0,0x08,0xff,0xe0,0x00,0x79,0x20,
-0x00,0x01,0x00,0xf2,0x07,0x01,0xee,0xa0,0x01,0xff,0xc0,0x01,0xff,0xb0,0x03,0xff,
-0x90,0x07,0xff,0x50,0x0d,0xfd,0x00,0x1d,0xf3,0x00,0x00,0x29,0x00,0x50,0x17,0x90,
-0x00,0x00,0x03,0xf0,0x00,0xf0,0x03,0x5c,0xff,0xff,0xb0,0x17,0xef,0xff,0xff,0xb4,
-0x4f,0xff,0xff,0xd7,0x10,0x05,0xff,0xfa,0x30,0x63,0x01,0x20,0xfc,0x61,0xfe,0x06,
-0x30,0xff,0xfb,0x50,0xc8,0x07,0x00,0x6b,0x01,0x21,0x29,0xff,0x53,0x02,0x21,0x7d,
-0xb0,0x1e,0x07,0x11,0x6f,0xc2,0x02,0x02,0x06,0x00,0x68,0x5c,0xcc,0xcc,0xcc,0xcc,
-0xc0,0x78,0x00,0x02,0x12,0x00,0x08,0x24,0x00,0x21,0x88,0x10,0x49,0x03,0x10,0xa4,
-0xf1,0x01,0xe0,0xff,0xfd,0x60,0x00,0x03,0xaf,0xff,0xff,0xf9,0x20,0x00,0x05,0xbf,
-0xff,0xe0,0x01,0xf1,0x05,0x18,0xff,0xf9,0x00,0x00,0x5b,0xff,0xff,0x90,0x4a,0xff,
-0xff,0xfe,0x82,0x9f,0xff,0xff,0xd6,0x00,0x09,0x88,0x00,0x34,0x9e,0x81,0x00,0x32,
-0x06,0x20,0x00,0x29,0x77,0x01,0x10,0x04,0x83,0x01,0x20,0x10,0x0e,0x71,0x01,0x20,
-0xa0,0x5f,0x52,0x07,0x51,0xf0,0x4b,0xba,0x00,0x05,0x4a,0x02,0x11,0x08,0x6f,0x08,
-0x10,0x3f,0x50,0x00,0x11,0x04,0xac,0x00,0x11,0x2f,0x22,0x02,0x21,0xaf,0xfc,0x3a,
-0x02,0x01,0x27,0x02,0x26,0xab,0xb0,0xa4,0x00,0x21,0x39,0x50,0x03,0x06,0x11,0xf5,
-0x45,0x02,0x11,0xf7,0x8a,0x02,0x11,0xc1,0x19,0x00,0x51,0x04,0x9d,0xff,0xec,0x82,
-0x0a,0x00,0x10,0x2c,0xbb,0x00,0x02,0x73,0x02,0xb1,0xfe,0x72,0x00,0x03,0x8f,0xfd,
-0x10,0x00,0x00,0x4f,0xfb,0x25,0x07,0x42,0xfb,0x00,0x00,0x1e,0x6b,0x08,0xe0,0x1e,
-0xf5,0x00,0x08,0xfe,0x10,0x00,0x6d,0xfe,0xa2,0x00,0x6f,0xc0,0x00,0x87,0x07,0xf0,
-0x51,0xff,0xff,0xf1,0x01,0xff,0x10,0x5f,0xf1,0x00,0x7f,0xf7,0x16,0xff,0x00,0x0c,
-0xf5,0x09,0xfb,0x00,0x1f,0xf9,0x00,0x6f,0xf0,0x00,0xaf,0x70,0xcf,0x80,0x06,0xff,
-0x20,0x07,0xfe,0x00,0x09,0xf7,0x0e,0xf6,0x00,0xaf,0xe0,0x00,0x9f,0xc0,0x00,0x9f,
-0x70,0xff,0x50,0x0d,0xfb,0x00,0x0a,0xfb,0x00,0x0b,0xf6,0x0f,0xf5,0x00,0xef,0xb0,
-0x00,0xcf,0x90,0x00,0xef,0x30,0xef,0x60,0x0d,0xfd,0x00,0x1f,0xf8,0x00,0x4f,0xe0,
-0x0c,0xf8,0x00,0xaf,0xf7,0x3c,0xff,0xc0,0x1d,0xf7,0x00,0x9f,0xd0,0x02,0xff,0xff,
-0xfa,0x33,0x08,0xd5,0x03,0xff,0x30,0x04,0xdf,0xd5,0x06,0xdf,0xd7,0x00,0x00,0x0c,
-0xfd,0xd4,0x00,0x34,0x3f,0xfc,0x10,0x0b,0x00,0x61,0x6f,0xff,0x94,0x21,0x24,0x86,
-0x0b,0x00,0x11,0x4d,0xbb,0x09,0x01,0x0b,0x00,0x24,0x05,0xad,0xdc,0x00,0x23,0x00,
-0xcf,0x37,0x00,0x12,0x2f,0x42,0x03,0x00,0xd2,0x04,0x22,0xa0,0x00,0xe1,0x04,0x22,
-0xff,0x00,0xf0,0x04,0x22,0xef,0xf6,0xff,0x04,0x13,0xb9,0x97,0x03,0x41,0xf6,0x4f,
-0xff,0x20,0x80,0x03,0x31,0x10,0xef,0xf8,0xb8,0x02,0x40,0xb0,0x09,0xff,0xd0,0x45,
-0x01,0x50,0xf6,0x00,0x4f,0xff,0x40,0xb9,0x02,0x40,0x10,0x00,0xef,0xfa,0x3f,0x04,
-0x02,0x74,0x0a,0x11,0x03,0x08,0x00,0x01,0x68,0x03,0x90,0xee,0xee,0xee,0xff,0xfc,
-0x00,0x0f,0xff,0xc0,0x50,0x00,0x41,0xf2,0x05,0xff,0xf6,0x61,0x00,0x31,0x80,0xbf,
-0xff,0x72,0x00,0x10,0xfe,0xf4,0x02,0x31,0xff,0xd9,0x30,0x07,0x00,0x80,0xff,0xf8,
-0x00,0x7f,0xff,0xee,0xef,0xff,0x52,0x03,0x00,0xc8,0x00,0x30,0xa0,0x7f,0xff,0xee,
-0x03,0x12,0xc0,0x07,0x00,0x00,0x0e,0x00,0x41,0x01,0x7f,0xff,0x40,0x2a,0x00,0x12,
-0xf7,0x31,0x00,0xb0,0xd4,0x00,0x7f,0xff,0x98,0x89,0xdf,0xff,0x50,0x7f,0xff,0x96,
-0x00,0x30,0xe0,0x7f,0xff,0x32,0x04,0x17,0xf2,0x07,0x00,0xb1,0x2e,0xff,0xf0,0x7f,
-0xff,0xdd,0xde,0xff,0xff,0x90,0x7f,0x86,0x04,0x01,0x38,0x00,0xb0,0xeb,0x60,0x00,
-0x00,0x01,0x8c,0xef,0xea,0x40,0x00,0x00,0x99,0x05,0x10,0xfa,0x5d,0x02,0x00,0x2a,
-0x01,0x80,0x0e,0xff,0xe4,0x00,0x2b,0xff,0xf4,0x5f,0xd3,0x00,0x30,0xef,0xfa,0xaf,
-0x28,0x01,0x32,0x9e,0xec,0xdf,0xee,0x01,0x2e,0xff,0xf9,0x07,0x00,0x01,0xf4,0x00,
-0x04,0x85,0x04,0x50,0x8c,0xca,0x6f,0xff,0x30,0x13,0x00,0x92,0x0f,0xff,0xd3,0x00,
-0x1a,0xff,0xf5,0x05,0xff,0x7e,0x01,0x20,0x6f,0xff,0xb7,0x01,0x00,0x2c,0x07,0x20,
-0xea,0x40,0x7e,0x00,0x32,0xfd,0x82,0x00,0xbd,0x00,0x10,0x60,0xee,0x00,0x02,0xf5,
-0x00,0x32,0x00,0x03,0xcf,0xf5,0x00,0x37,0x0d,0xff,0xc0,0xbd,0x00,0x50,0x02,0xff,
-0xf6,0x7f,0xff,0x6e,0x00,0x12,0xf7,0x07,0x00,0x17,0xf8,0x0e,0x00,0x03,0x1c,0x00,
-0x03,0x2a,0x00,0x02,0x38,0x00,0x11,0x02,0x46,0x00,0x42,0xdd,0xef,0xff,0xf9,0x62,
-0x00,0x19,0x70,0x70,0x00,0x13,0xff,0x06,0x00,0x00,0x93,0x01,0x21,0xed,0x7f,0x80,
-0x01,0x0f,0x06,0x00,0x01,0x00,0x55,0x06,0x04,0x06,0x00,0x4f,0xcc,0xcc,0xcc,0x90,
-0x2a,0x00,0x07,0x4a,0xdd,0xdd,0xdd,0xdd,0x5a,0x00,0x00,0x4d,0x01,0x03,0x06,0x00,
-0x00,0x66,0x00,0x1f,0xe8,0x3c,0x00,0x0a,0x1a,0xa0,0x6c,0x00,0x0f,0x2a,0x00,0x05,
-0x0b,0x06,0x00,0x00,0xc2,0x08,0x31,0xef,0xeb,0x60,0xbc,0x06,0x30,0xff,0xff,0xd2,
-0x6b,0x02,0xd0,0xfe,0xff,0xff,0xe0,0x00,0xdf,0xff,0x50,0x00,0x8f,0xff,0x70,0x4f,
-0x42,0x05,0x30,0xbf,0xfd,0x09,0x60,0x05,0x40,0x03,0x88,0x70,0xcf,0x04,0x04,0x00,
-0x1f,0x01,0x14,0xb0,0xb0,0x01,0x00,0xe4,0x07,0x00,0x0f,0x00,0xb1,0xbf,0xff,0xff,
-0xf0,0xcf,0xfc,0x00,0x06,0x99,0xcf,0xff,0x2d,0x00,0x10,0x07,0x32,0x0d,0x11,0x70,
-0x65,0x00,0x90,0xdf,0xff,0x70,0x00,0x1b,0xff,0xf0,0x03,0xff,0x6d,0x04,0x11,0xfe,
-0xeb,0x05,0x93,0xff,0xfc,0x20,0x00,0x01,0x6c,0xef,0xed,0x94,0x86,0x00,0x51,0x1f,
-0xff,0x67,0xff,0xf0,0x01,0x03,0x0f,0x0f,0x00,0x14,0x11,0xff,0x00,0x06,0x12,0x7f,
-0x08,0x00,0x8f,0x67,0xff,0xfd,0xdd,0xdd,0xdd,0xff,0xf6,0x4b,0x00,0x21,0x6f,0x60,
-0x4f,0xff,0x44,0xff,0xf4,0x05,0x00,0x12,0x11,0x40,0xdc,0x04,0x1f,0xfe,0x06,0x00,
-0x29,0x20,0x13,0x33,0x06,0x00,0x00,0xdf,0x03,0xe1,0xbf,0xfd,0x4f,0xff,0x90,0x05,
-0xff,0xf9,0x0d,0xff,0xff,0xef,0xff,0xf2,0x14,0x01,0x61,0x50,0x00,0x18,0xdf,0xfd,
-0x92,0x11,0x01,0x41,0x07,0xff,0xfd,0x07,0xf8,0x03,0x20,0xfe,0x20,0xa7,0x03,0x30,
-0xef,0xff,0x40,0x0f,0x00,0x11,0xcf,0x82,0x02,0x20,0x00,0x8f,0x72,0x0c,0x00,0x18,
-0x0f,0x10,0xc0,0x3e,0x01,0x31,0x2f,0xff,0xe1,0x30,0x00,0x23,0xff,0xf6,0x6f,0x02,
-0x22,0xc0,0x00,0x8a,0x07,0x01,0x7d,0x01,0xb1,0xf9,0xdf,0xff,0x20,0x00,0x07,0xff,
-0xfa,0x04,0xff,0xfc,0x6b,0x01,0x40,0x0a,0xff,0xf7,0x00,0x4b,0x00,0x31,0x1e,0xff,
-0xf2,0x69,0x00,0x40,0x5f,0xff,0xc0,0x07,0x11,0x01,0x50,0xbf,0xff,0x70,0x7f,0xff,
-0x18,0x01,0x2e,0xff,0x20,0x3b,0x02,0x0f,0x06,0x00,0x30,0x00,0xa1,0x02,0x12,0xd6,
-0x95,0x04,0x04,0x06,0x00,0x11,0xf4,0xd4,0x0e,0x22,0xff,0x77,0x2f,0x05,0x10,0xaf,
-0x87,0x03,0x11,0xff,0x93,0x09,0x00,0x13,0x00,0x11,0xf5,0x71,0x0a,0x30,0xf7,0x7f,
-0xfe,0x6a,0x02,0xf1,0x34,0xbf,0xfe,0xff,0x77,0xff,0xbe,0xff,0x10,0x00,0x1f,0xfd,
-0xcf,0xf7,0x7f,0xfc,0x8f,0xf6,0x00,0x07,0xff,0x8c,0xff,0x77,0xff,0xd2,0xff,0xc0,
-0x00,0xcf,0xf2,0xdf,0xf7,0x7f,0xfd,0x0c,0xff,0x20,0x2f,0xfc,0x0e,0xff,0x77,0xff,
-0xe0,0x7f,0xf7,0x08,0xff,0x60,0xef,0xf7,0x7f,0xff,0x01,0xff,0xd0,0xdf,0xf1,0x0f,
-0xff,0x77,0xff,0xf0,0x0b,0xff,0x6f,0xfb,0xe6,0x03,0x00,0x9e,0x04,0x11,0x50,0x13,
-0x00,0x20,0x00,0xff,0x04,0x00,0x11,0xf7,0x11,0x01,0x22,0xf9,0x00,0x13,0x00,0x33,
-0x4f,0xff,0x30,0x0c,0x04,0x40,0xef,0xe0,0x00,0x0f,0x10,0x01,0x12,0x50,0x30,0x02,
-0x13,0xfe,0x30,0x02,0x13,0xf9,0x7b,0x02,0x12,0xf3,0x0f,0x00,0x23,0xff,0xc0,0x8a,
-0x02,0x11,0x60,0x0f,0x00,0x30,0x9f,0xfe,0x10,0x0f,0x00,0x31,0xf1,0xef,0xfa,0x0f,
-0x00,0x31,0x04,0xff,0xf3,0x6c,0x02,0x31,0x0b,0xff,0xd2,0x6c,0x02,0x31,0x2f,0xff,
-0x9f,0x7b,0x02,0x11,0x7f,0xb7,0x02,0x01,0x1d,0x06,0x00,0x0f,0x00,0x13,0x04,0x0f,
-0x00,0x22,0x0a,0xff,0x99,0x02,0x13,0x1e,0x99,0x02,0x10,0x6f,0x78,0x03,0x52,0x6c,
-0xef,0xda,0x30,0x00,0x30,0x03,0x33,0xa0,0x00,0x03,0x00,0x05,0x71,0xdf,0xff,0x60,
-0x02,0xbf,0xff,0x60,0x99,0x03,0x50,0xdf,0xfd,0x0a,0xff,0xe0,0x2a,0x01,0x22,0xf3,
-0xdf,0xa8,0x07,0x31,0x6e,0xff,0x90,0xd2,0x04,0x21,0xff,0xf9,0x4a,0x01,0x13,0x8e,
-0x0f,0x00,0x03,0x1e,0x00,0x13,0x6a,0x2d,0x00,0x11,0x5f,0x3c,0x00,0x10,0xfe,0x4b,
-0x00,0x42,0x01,0xbf,0xff,0x60,0xf3,0x03,0x14,0xb0,0x69,0x00,0x01,0x78,0x00,0x12,
-0x40,0x4c,0x02,0x11,0xda,0x63,0x05,0x00,0xd3,0x05,0x00,0x81,0x04,0x21,0xff,0xff,
-0xbe,0x04,0x12,0x2d,0x24,0x05,0x19,0x03,0x47,0x05,0x12,0x01,0x07,0x00,0x32,0x1b,
-0xff,0xf4,0x20,0x06,0x12,0xc0,0x20,0x06,0x11,0x10,0x20,0x06,0x14,0x50,0x6c,0x04,
-0x0f,0x07,0x00,0x0f,0x00,0xc0,0x0d,0x44,0xce,0xfd,0xa3,0x00,0xf8,0x00,0x00,0xde,
-0x06,0x02,0xf2,0x05,0x02,0xf9,0x00,0x40,0x50,0x05,0xff,0xf5,0x81,0x04,0x13,0xd0,
-0xfa,0x00,0x40,0xf2,0x0d,0xff,0xa0,0xbe,0x05,0x40,0xf5,0x0f,0xff,0x90,0x86,0x00,
-0x41,0xf7,0x0f,0xff,0x80,0x95,0x00,0x04,0x10,0x00,0x04,0x20,0x00,0x04,0x30,0x00,
-0x00,0x33,0x07,0x00,0x40,0x00,0x04,0x50,0x00,0x20,0x00,0x3f,0x82,0x03,0x13,0xfa,
-0x70,0x00,0x10,0xd0,0xd1,0x09,0x33,0xce,0xff,0xff,0xfe,0x10,0x32,0xaf,0xff,0xd2,
-0x93,0x00,0x03,0xd3,0x07,0x29,0x00,0x48,0x17,0x01,0x13,0xf9,0x61,0x07,0x01,0x3c,
-0x03,0x12,0x4f,0x30,0x07,0x37,0x08,0xff,0xf1,0x49,0x06,0x30,0x09,0xff,0xf0,0xc1,
-0x03,0x01,0x7d,0x07,0x01,0x0e,0x0d,0x01,0x07,0x00,0x12,0xb2,0x38,0x00,0x10,0x60,
-0xf4,0x00,0x30,0x0d,0xff,0xe0,0x07,0x00,0x31,0x04,0xff,0xf7,0x02,0x01,0x32,0xcf,
-0xfe,0x00,0x4d,0x00,0x12,0x80,0x84,0x07,0x12,0xf1,0x6b,0x01,0xa1,0xf8,0x00,0x00,
-0x6b,0xef,0xec,0x70,0x00,0x00,0x3e,0x3b,0x0b,0xf0,0x02,0x01,0xef,0xff,0xfd,0xff,
-0xff,0xe1,0x07,0xff,0xf7,0x00,0x06,0xff,0xf9,0x09,0xff,0xe0,0x49,0x0c,0x10,0x08,
-0x87,0x0f,0x62,0x13,0x32,0x02,0xff,0xff,0x82,0xde,0x0b,0x40,0xff,0xc7,0x10,0x00,
-0x0b,0x07,0x20,0xff,0xf8,0x4f,0x01,0x13,0x9e,0xbc,0x08,0xa1,0x4c,0xff,0xf7,0x17,
-0x77,0x20,0x00,0x00,0xdf,0xfc,0x2b,0x01,0x92,0xaf,0xfe,0x0c,0xff,0xf5,0x00,0x03,
-0xff,0xfc,0xa0,0x05,0x30,0xf5,0x00,0x4e,0xa2,0x00,0x10,0x80,0x70,0x00,0x42,0xfd,
-0x93,0x00,0x8f,0x62,0x05,0x13,0x68,0x71,0x05,0x80,0x7e,0xee,0xee,0xff,0xfe,0xee,
-0xee,0x50,0xa1,0x02,0x11,0x20,0xa8,0x1f,0x02,0xfb,0x0f,0x0f,0x0f,0x00,0x46,0x21,
-0xaf,0xfe,0xc5,0x01,0x0f,0x07,0x00,0x33,0x14,0x9f,0xe8,0x07,0x00,0xdc,0x10,0xa0,
-0xf4,0x3f,0xff,0xc2,0x00,0x3e,0xff,0xe0,0x0a,0xff,0x36,0x08,0x10,0x60,0xc1,0x06,
-0x00,0x28,0x01,0x20,0x04,0xae,0x3f,0x09,0x30,0xcf,0xff,0x20,0xf5,0x01,0x10,0xf6,
-0x87,0x03,0x00,0x85,0x01,0x01,0x9d,0x13,0x60,0x1f,0xff,0xb0,0x0b,0xff,0xf0,0x59,
-0x01,0x11,0x60,0x85,0x02,0x31,0xaf,0xff,0x10,0xb9,0x08,0x21,0xef,0xfa,0xa8,0x00,
-0x40,0x03,0xff,0xf5,0x00,0x45,0x04,0x30,0x08,0xff,0xf0,0x6e,0x0d,0x11,0x80,0x79,
-0x02,0x60,0x09,0xff,0xc0,0x2f,0xff,0x40,0x49,0x0b,0x12,0xf1,0x87,0x0d,0x41,0xef,
-0xf6,0xbf,0xf9,0x0c,0x06,0x14,0xfc,0x0d,0x0f,0x01,0x6e,0x0b,0x00,0xeb,0x09,0x13,
-0x80,0x3e,0x0a,0x21,0x30,0x00,0xd5,0x0d,0x13,0xfd,0x14,0x03,0x00,0x57,0x11,0x60,
-0x0f,0xff,0x74,0xff,0xf3,0x00,0x76,0x00,0x40,0x02,0xff,0xf4,0x0f,0x92,0x12,0x00,
-0x9d,0x12,0x10,0xff,0xc8,0x0d,0xa1,0x0c,0xff,0xfd,0x00,0x08,0xff,0xd0,0x09,0xff,
-0xc0,0xd5,0x04,0x50,0xbf,0xf9,0x00,0x5f,0xff,0x2a,0x0e,0xb0,0x40,0x0e,0xff,0x60,
-0x02,0xff,0xf2,0x07,0xff,0x9f,0xf8,0xa0,0x11,0x80,0x0e,0xff,0x50,0xbf,0xf1,0xff,
-0xb0,0x4f,0x61,0x0e,0xf0,0x0c,0xf8,0x0f,0xfc,0x0c,0xff,0x07,0xff,0xb0,0x00,0x07,
+0x38,0xd5,0xa0,0xd7,0x80,0xd8,0x00,0x01,0x00,0x2f,0xf5,0x00,0x01,0x00,0x06,0x13,
+0xf9,0x08,0x00,0x17,0xea,0x14,0x00,0xbf,0xf7,0xf5,0x00,0xfc,0xef,0x00,0xef,0x00,
+0x00,0x00,0x02,0x35,0x00,0x03,0x4f,0x04,0x07,0x00,0x04,0x19,0x00,0x02,0x2f,0xcb,
+0x00,0x01,0x00,0x18,0x1f,0xd2,0x21,0x00,0x0d,0x03,0x94,0x00,0xb2,0xf1,0x00,0xfc,
+0x00,0x00,0xea,0xfd,0xf2,0xf9,0x00,0xe4,0x9f,0x00,0x7f,0xfe,0x00,0x00,0xfd,0xfe,
+0xf7,0xfa,0x9e,0x00,0x01,0x10,0xfb,0x2c,0x00,0x1f,0xf6,0x50,0x00,0x04,0x1c,0xfb,
+0x0a,0x00,0x19,0xfe,0x1f,0x00,0x15,0xfd,0x0a,0x00,0x30,0xe9,0x00,0x00,0x48,0x00,
+0x8b,0x00,0xf0,0x00,0xfc,0x00,0xfc,0xf8,0xfc,0x47,0x00,0x1d,0xfa,0x0f,0x01,0x04,
+0x09,0x00,0x21,0xfc,0xfd,0x37,0x00,0x29,0xfd,0xfb,0x33,0x00,0x75,0xcd,0x00,0x00,
+0x00,0xdc,0x00,0xd9,0x27,0x00,0xad,0xfa,0xfc,0x00,0x00,0xfc,0xfb,0x00,0x00,0xfc,
+0xfc,0xa2,0x00,0x13,0x03,0x9c,0x00,0x2f,0x03,0xfb,0x19,0x01,0x0a,0x1f,0xfc,0x5e,
+0x01,0x10,0x1b,0xe1,0xaa,0x00,0x12,0xfb,0x5a,0x00,0x34,0xfc,0xf9,0xf4,0x12,0x00,
+0x14,0xca,0xbf,0x00,0x97,0xf4,0x00,0x00,0xda,0xfc,0xd9,0xef,0x00,0xcc,0x0c,0x01,
+0x19,0xe9,0x45,0x01,0x71,0xb4,0x00,0x00,0x00,0xdf,0x00,0xde,0x0c,0x00,0x61,0xf6,
+0x00,0xf9,0x00,0xfe,0xfe,0x3d,0x01,0x11,0x03,0xb1,0x00,0x3d,0x00,0xc8,0x00,0x22,
+0x01,0x4f,0xfb,0xfc,0x00,0xf9,0xa3,0x00,0x0e,0x10,0xf7,0xc9,0x00,0x1e,0xf7,0x1a,
+0x00,0x03,0xb1,0x02,0xb1,0xd0,0xcd,0x00,0x00,0xea,0xfb,0xd8,0xfd,0x03,0x00,0x03,
+0x69,0x00,0xf2,0x02,0xe1,0xef,0x00,0xef,0xd9,0xf4,0xf2,0x00,0xf4,0xf1,0xf7,0xf2,
+0xf5,0x00,0xdd,0xf0,0xee,0x7c,0x01,0x66,0xd8,0xe3,0x00,0x00,0xf2,0xfe,0x43,0x01,
+0xa7,0xf7,0xf8,0x00,0x00,0xf7,0xfa,0x00,0x00,0xfb,0xfe,0x9b,0x01,0x73,0x03,0x00,
+0xe5,0xf5,0x00,0x00,0xf8,0x63,0x01,0x00,0xda,0x02,0x23,0xfa,0xfa,0x8a,0x01,0x04,
+0x78,0x01,0x03,0x01,0x00,0x14,0xe3,0x1f,0x02,0x15,0x03,0x38,0x01,0x10,0xfc,0x38,
+0x01,0x17,0xfa,0xdf,0x00,0xf5,0x15,0x04,0xf7,0xd5,0xe4,0x00,0x00,0xe4,0xfb,0xee,
+0xfd,0x03,0xee,0x03,0x03,0x02,0x03,0x00,0x03,0xf4,0xf4,0xfc,0xf9,0xf4,0xf9,0xf5,
+0xfc,0xf9,0xfc,0x00,0xfc,0xfa,0x04,0xee,0xf4,0xf4,0xf8,0x2e,0x00,0x2a,0x02,0xfb,
+0xba,0x01,0x01,0x4e,0x00,0x1e,0xfb,0xe1,0x01,0x00,0x80,0x02,0x1e,0xfd,0x2c,0x01,
+0x0d,0x9d,0x02,0x0f,0x1d,0x00,0x0a,0x0f,0x38,0x02,0x0a,0x4f,0xfe,0x00,0xfd,0xfd,
+0xf9,0x02,0x01,0x0f,0x75,0x00,0x23,0x07,0x73,0x01,0x0e,0x0e,0x04,0x19,0x03,0xa4,
+0x02,0x13,0x04,0xc8,0x03,0x0f,0x01,0x00,0x27,0x0e,0xf2,0x02,0x1f,0xf0,0xb9,0x00,
+0x0b,0x26,0xfc,0xfd,0x52,0x03,0x1c,0xe0,0x9f,0x02,0x20,0xfc,0x04,0x9e,0x02,0x10,
+0x09,0x58,0x02,0x0f,0x01,0x00,0x0c,0x1e,0xfa,0xa0,0x03,0x1c,0xe1,0x6c,0x00,0x2f,
+0xfe,0x02,0x29,0x01,0x01,0x1f,0xe9,0xea,0x00,0x27,0x0e,0x3a,0x03,0x0f,0x2d,0x02,
+0x1b,0x1f,0xfc,0x22,0x04,0x09,0x12,0x01,0x37,0x05,0x21,0x02,0x03,0x98,0x01,0x2d,
+0x04,0x05,0x21,0x00,0xf0,0x00,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,
+0x0e,0x0f,0x0c,0x0c,0x09,0x82,0x08,0x81,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,
+0x20,0x00,0xff,0x0c,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,
+0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x73,
+0x00,0x04,0x11,0x06,0x01,0x00,0xd0,0x00,0x08,0x0a,0x0a,0x0a,0x0a,0x0c,0x0c,0x0c,
+0x0c,0x09,0x0c,0x09,0x01,0x00,0x40,0x00,0x00,0x0d,0x0d,0x08,0x0c,0x21,0x00,0x1a,
+0x01,0x00,0x61,0x00,0x1c,0x1d,0x1d,0x1d,0x1d,0x31,0x00,0x20,0x1f,0x21,0x01,0x00,
+0x02,0x3d,0x00,0x50,0x24,0x1b,0x24,0x06,0x1a,0x02,0x00,0x22,0x08,0x1c,0x02,0x00,
+0x64,0x09,0x00,0x09,0x00,0x0a,0x1d,0x02,0x00,0x04,0x64,0x00,0x55,0x0c,0x1f,0x00,
+0x00,0x0c,0x02,0x00,0x83,0x00,0x00,0x0d,0x00,0x0e,0x00,0x00,0x0f,0x02,0x00,0x00,
+0x1f,0x00,0x00,0x02,0x00,0x80,0x1f,0x00,0x00,0x09,0x21,0x09,0x21,0x09,0x5b,0x00,
+0x11,0x22,0x02,0x00,0x03,0x01,0x00,0x11,0x13,0x02,0x00,0x17,0x0d,0x02,0x00,0x70,
+0x15,0x00,0x17,0x24,0x17,0x18,0x27,0x02,0x00,0x0f,0xb7,0x02,0x28,0x07,0x72,0x01,
+0x20,0x03,0x02,0x6d,0x01,0x4a,0x06,0x07,0x06,0x08,0x1f,0x00,0x00,0xce,0x00,0x60,
+0x00,0x0b,0x00,0x00,0x00,0x0b,0xc1,0x00,0x01,0x08,0x00,0xf1,0x08,0x0b,0x00,0x0d,
+0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,
+0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,
+0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x73,0x00,0x02,0x11,0x0a,0x01,0x00,
+0x26,0x24,0x0b,0x12,0x00,0x10,0x0b,0x01,0x00,0xa1,0x00,0x0b,0x0f,0x0f,0x0f,0x0f,
+0x13,0x00,0x00,0x16,0x01,0x00,0x20,0x25,0x17,0x01,0x00,0x02,0x57,0x00,0x02,0x83,
+0x01,0xa0,0x26,0x1e,0x1e,0x1e,0x1e,0x1f,0x00,0x1f,0x0a,0x16,0x02,0x00,0x22,0x0b,
+0x17,0x02,0x00,0x10,0x00,0x24,0x00,0x14,0x17,0x02,0x00,0x05,0x16,0x00,0x0b,0x01,
+0x00,0x1b,0x0c,0x10,0x00,0x10,0x19,0x02,0x00,0x51,0x19,0x00,0x00,0x0b,0x1a,0x02,
+0x00,0x03,0x30,0x00,0x22,0x0d,0x1c,0x02,0x00,0x10,0x0e,0xa0,0x01,0x36,0x00,0x0f,
+0x1e,0x02,0x00,0x70,0x11,0x00,0x13,0x1f,0x13,0x14,0x22,0x02,0x00,0x1f,0x00,0x74,
+0x01,0x26,0x50,0x00,0x00,0x00,0x00,0x00,0xf0,0x5a,0x7f,0xff,0x16,0xff,0xf1,0x6f,
+0xff,0x05,0xff,0xf0,0x5f,0xff,0x04,0xff,0xf0,0x3f,0xfe,0x03,0xff,0xe0,0x2f,0xfd,
+0x02,0xff,0xd0,0x1f,0xfc,0x01,0xee,0xb0,0x00,0x00,0x00,0x58,0x30,0x5f,0xff,0x17,
+0xff,0xf2,0x1c,0xf9,0x00,0x4f,0xf2,0x6f,0xe4,0xff,0x16,0xfe,0x4f,0xf0,0x6f,0xd4,
+0xff,0x06,0xfb,0x4f,0xd0,0x6f,0xa4,0xfb,0x06,0xf8,0x17,0x50,0x37,0x30,0x00,0x00,
+0x08,0xf9,0x01,0xff,0x00,0x00,0x00,0x0b,0xf7,0x04,0xfd,0x00,0x00,0x00,0x0d,0xf4,
+0x07,0xfb,0x00,0x00,0x00,0x0f,0xf1,0x0a,0xf8,0x00,0x00,0x11,0x4f,0xe1,0x1c,0xf6,
+0x10,0x06,0xff,0x01,0x00,0x13,0xfd,0x07,0x00,0xf1,0x07,0x00,0x00,0xcf,0x60,0x5f,
+0xc0,0x00,0x00,0x00,0xff,0x30,0x8f,0x90,0x00,0x00,0x02,0xff,0x00,0xbf,0x60,0x00,
+0x4f,0x1c,0x00,0x13,0xf0,0x07,0x00,0x00,0x4c,0x00,0x17,0xfe,0x4c,0x00,0xf0,0x08,
+0xf2,0x09,0xf8,0x00,0x00,0x00,0x2f,0xf0,0x0c,0xf6,0x00,0x00,0x00,0x5f,0xc0,0x0f,
+0xf3,0x00,0x00,0x00,0x00,0x02,0x30,0x06,0x00,0x25,0x0a,0xf3,0x06,0x00,0xc0,0x03,
+0x8e,0xfa,0x40,0x00,0x00,0xaf,0xff,0xff,0xfc,0x10,0x09,0x47,0x00,0xd0,0xb0,0x1f,
+0xff,0xb1,0x19,0xff,0xf3,0x3f,0xff,0x30,0x00,0xef,0xf8,0x06,0x00,0x40,0x9c,0xc7,
+0x1f,0xff,0xd6,0x00,0x51,0x09,0xff,0xfe,0x71,0x00,0x2a,0x00,0xf0,0x0d,0x81,0x00,
+0x00,0x05,0xdf,0xff,0xfe,0x30,0x00,0x00,0x04,0xbf,0xff,0xe0,0x00,0x00,0x00,0x05,
+0xff,0xf6,0xce,0xe7,0x00,0x00,0xdf,0xf9,0xcf,0xfb,0x06,0x00,0x70,0x7f,0xff,0x81,
+0x18,0xff,0xf6,0x1e,0x4e,0x00,0xf3,0x03,0xe0,0x02,0xdf,0xff,0xff,0xfd,0x20,0x00,
+0x04,0x9f,0xf9,0x50,0x00,0x00,0x00,0x0e,0xf0,0x00,0x06,0x00,0x40,0x05,0xcf,0xea,
+0x20,0x0c,0x00,0x40,0x6f,0xff,0xff,0xe1,0x08,0x00,0xf2,0x07,0xcf,0xa0,0x2e,0xf6,
+0x00,0x4f,0x70,0x00,0xef,0x50,0x0b,0xf8,0x00,0xef,0x30,0x00,0xcf,0xa0,0x1e,0xf6,
+0x09,0xf8,0x20,0x00,0x22,0x3f,0xd0,0x30,0x00,0x30,0xdf,0x40,0x00,0x01,0x00,0x31,
+0x08,0xfa,0x00,0x01,0x00,0x22,0x3f,0xe1,0x08,0x00,0xf0,0x06,0xdf,0x52,0xbe,0xeb,
+0x20,0x00,0x00,0x07,0xfb,0x2f,0xff,0xff,0xf2,0x00,0x00,0x2f,0xf1,0x9f,0xd1,0x1e,
+0xf8,0x30,0x01,0x81,0xbf,0x80,0x09,0xfa,0x00,0x07,0xfc,0x00,0x08,0x00,0xb1,0x0d,
+0xf2,0x00,0x9f,0xd1,0x1d,0xf8,0x00,0x00,0x30,0x00,0x28,0x00,0x00,0x0c,0x01,0x01,
+0x38,0x00,0x31,0x7d,0xff,0xc4,0x0d,0x01,0x40,0xff,0xff,0xff,0x60,0x29,0x01,0xc0,
+0xff,0xdd,0xff,0xf1,0x00,0x00,0x00,0x9f,0xf9,0x00,0xbf,0xf4,0xf0,0x00,0x30,0xf5,
+0x00,0x9f,0x28,0x01,0xc0,0x7f,0xfb,0x04,0xff,0xd0,0x00,0x00,0x00,0x1f,0xff,0xcf,
+0xfe,0x44,0x01,0x40,0x06,0xff,0xff,0xc2,0x38,0x00,0xf1,0x2a,0x1b,0xff,0xff,0x30,
+0x02,0x66,0x20,0x01,0xdf,0xff,0xff,0xe2,0x08,0xff,0x60,0x0a,0xff,0xd2,0xef,0xfd,
+0x1b,0xff,0x40,0x0f,0xff,0x50,0x2f,0xff,0xcf,0xff,0x10,0x2f,0xff,0x40,0x04,0xff,
+0xff,0xfb,0x00,0x0f,0xff,0xa0,0x00,0x6f,0xff,0xf3,0x00,0x09,0xff,0xfc,0x8a,0xff,
+0xff,0xf5,0x00,0x00,0xcf,0xb5,0x01,0xf2,0x08,0x30,0x00,0x06,0xcf,0xfe,0xc8,0x2c,
+0xff,0xe2,0x4f,0xf3,0x4f,0xf3,0x4f,0xf2,0x4f,0xf1,0x4f,0xf0,0x4f,0xf0,0x28,0x70,
+0xd9,0x00,0xf0,0x38,0x97,0x00,0x00,0xcf,0xd0,0x00,0xaf,0xf3,0x00,0x4f,0xf6,0x00,
+0x0d,0xfd,0x00,0x04,0xff,0x60,0x00,0xaf,0xf1,0x00,0x0f,0xfd,0x00,0x02,0xff,0x90,
+0x00,0x5f,0xf8,0x00,0x07,0xff,0x60,0x00,0x8f,0xf5,0x00,0x08,0xff,0x50,0x00,0x7f,
+0xf6,0x00,0x06,0xff,0x70,0x00,0x4f,0xf8,0x00,0x00,0xff,0xc0,0x00,0x0c,0xff,0x00,
+0x00,0x6f,0xf4,0x00,0x01,0xff,0xa0,0x00,0x07,0xff,0x30,0x3c,0x00,0xa0,0x00,0x2e,
+0xfb,0x00,0x00,0x2d,0x90,0x00,0x00,0x01,0x59,0x00,0x21,0x1d,0x30,0x20,0x00,0xd0,
+0x00,0x0b,0xff,0x20,0x00,0x01,0xef,0xc0,0x00,0x00,0x6f,0xf6,0x00,0x58,0x00,0xf0,
+0x03,0x00,0x0a,0xff,0x30,0x00,0x07,0xff,0x80,0x00,0x03,0xff,0xc0,0x00,0x01,0xff,
+0xf0,0x00,0x00,0x04,0x00,0x00,0x0f,0x01,0x21,0xef,0xf1,0x0c,0x00,0x00,0x14,0x00,
+0xf1,0x00,0x02,0xff,0xd0,0x00,0x05,0xff,0x90,0x00,0x09,0xff,0x50,0x00,0x0d,0xfe,
+0x00,0x74,0x00,0x60,0xcf,0xe1,0x00,0x07,0xff,0x50,0x94,0x00,0x61,0x00,0x3f,0x80,
+0x00,0x00,0x02,0xbf,0x00,0x10,0x8f,0x36,0x02,0x20,0x07,0xfa,0x0f,0x00,0xa0,0x7f,
+0x90,0x01,0x04,0xfc,0x56,0xf8,0x39,0xf4,0x8f,0xf5,0x00,0xa0,0x90,0x16,0xbf,0xff,
+0xc8,0x30,0x00,0x08,0xff,0xf6,0x3b,0x02,0xf2,0x01,0x6f,0xf3,0x00,0x02,0xff,0x70,
+0x9f,0xe1,0x00,0x1b,0xd0,0x01,0xec,0x10,0x00,0x01,0x3e,0x00,0x72,0x08,0x88,0x10,
+0x00,0x00,0x00,0x01,0xa9,0x01,0x3a,0x1f,0xff,0x20,0x0d,0x00,0x11,0x05,0x3d,0x01,
+0x21,0xf5,0x5f,0x07,0x00,0x12,0x55,0x0d,0x00,0x6f,0x01,0x11,0x2f,0xff,0x31,0x11,
+0x34,0x00,0x06,0x00,0x6b,0x00,0xe0,0x70,0x5f,0xf7,0x05,0xff,0x70,0x7f,0xf5,0x0b,
+0xff,0x02,0xff,0x80,0x3d,0x4e,0x03,0xf0,0x06,0x8b,0xbb,0xbb,0xab,0xff,0xff,0xfe,
+0xbf,0xff,0xff,0xe0,0x06,0x94,0x05,0xff,0xf2,0x7f,0xff,0x31,0xcf,0xa0,0x31,0x00,
+0x10,0xf7,0x9c,0x02,0x00,0x3c,0x00,0x20,0xbf,0xc0,0x46,0x00,0x40,0x70,0x00,0x00,
+0x06,0x44,0x00,0x25,0x0b,0xfc,0x1d,0x00,0x10,0xf1,0xb6,0x02,0x00,0x1d,0x00,0x00,
+0x37,0x02,0x70,0x07,0xff,0x10,0x00,0x00,0x0c,0xfb,0x1d,0x00,0x10,0xf6,0x2d,0x02,
+0x01,0x1d,0x00,0x10,0xb0,0xa8,0x03,0x04,0x1d,0x00,0x20,0x0d,0xfb,0x0e,0x01,0x10,
+0x83,0x8e,0x00,0xf0,0x1b,0x18,0xdf,0xfc,0x70,0x00,0x02,0xef,0xff,0xff,0xfc,0x00,
+0x0d,0xff,0xfd,0xef,0xff,0x90,0x5f,0xff,0x40,0x08,0xff,0xf1,0x9f,0xfc,0x00,0x00,
+0xff,0xf5,0xcf,0xf9,0x00,0x00,0xcf,0xf8,0xdf,0xf8,0x00,0x00,0xbf,0xf9,0xef,0x06,
+0x00,0x18,0xfa,0x06,0x00,0x02,0x18,0x00,0x00,0x24,0x00,0x22,0xdf,0xf8,0x30,0x00,
+0x11,0x4f,0x3c,0x00,0x02,0x48,0x00,0x02,0x54,0x00,0x01,0x60,0x00,0x00,0xfc,0x00,
+0x61,0x7c,0x60,0x01,0x6b,0xff,0xf6,0xd9,0x02,0xc0,0xff,0xff,0xff,0xf6,0x0f,0xc7,
+0x2f,0xff,0x60,0x10,0x00,0xff,0xec,0x01,0x00,0x97,0x00,0x0f,0x09,0x00,0x19,0x60,
+0x02,0x9d,0xff,0xd8,0x10,0x00,0x8c,0x04,0xf0,0x00,0xfe,0x20,0x04,0xff,0xff,0xce,
+0xff,0xfc,0x00,0xcf,0xfd,0x20,0x0a,0xff,0xf2,0x1d,0x00,0x81,0x3f,0xff,0x41,0x88,
+0x82,0x00,0x02,0xff,0x55,0x04,0x30,0x7f,0xfe,0x00,0x76,0x04,0x20,0xff,0x70,0x68,
+0x02,0x01,0x32,0x03,0x31,0x0c,0xff,0xe2,0x06,0x00,0x15,0xf3,0x06,0x00,0x35,0x0b,
+0xff,0xf4,0x06,0x00,0x81,0x0a,0xff,0xfe,0xcc,0xcc,0xcc,0xa0,0xdf,0xe6,0x04,0x11,
+0x0d,0xcb,0x01,0x60,0xd0,0x00,0x04,0xae,0xfe,0xc7,0x72,0x04,0x00,0x3c,0x04,0x12,
+0x07,0x6f,0x00,0x10,0xdf,0xa0,0x04,0x80,0xf2,0x08,0x99,0x30,0x00,0x1f,0xff,0x40,
+0xb8,0x04,0x11,0xff,0xbe,0x04,0x21,0xcf,0xfc,0x8b,0x03,0x21,0xfc,0x10,0x2b,0x04,
+0x91,0x50,0x00,0x00,0x04,0xab,0xdf,0xff,0x90,0x00,0xc9,0x03,0x01,0xeb,0x04,0xd1,
+0xef,0xf8,0x2c,0xcc,0x20,0x00,0x0d,0xff,0x81,0xff,0xfb,0x00,0x06,0x0e,0x01,0x51,
+0xce,0xff,0xfe,0x00,0x0b,0xca,0x00,0x51,0x00,0x05,0xbe,0xff,0xc7,0xac,0x02,0x12,
+0x09,0xbd,0x00,0x12,0x3f,0x07,0x00,0x11,0xdf,0x07,0x00,0x21,0x08,0xff,0x07,0x00,
+0x21,0x2f,0xfe,0x07,0x00,0x40,0xcf,0xf5,0xff,0xf3,0xcb,0x01,0x10,0x73,0x07,0x00,
+0x21,0x2f,0xfc,0x7f,0x00,0x20,0xcf,0xf3,0x07,0x00,0x30,0x06,0xff,0x80,0x07,0x00,
+0x72,0x1f,0xff,0xcb,0xbc,0xff,0xfc,0xb1,0x94,0x02,0x22,0xf1,0x3f,0x07,0x00,0x05,
+0xa9,0x00,0x1e,0x00,0x07,0x00,0x01,0xda,0x05,0x21,0xf3,0x08,0x06,0x00,0x81,0x0a,
+0xff,0xed,0xdd,0xdd,0xd2,0x0c,0xff,0x25,0x05,0x01,0xb9,0x00,0x40,0x0f,0xff,0x36,
+0x87,0xec,0x00,0x41,0xff,0xff,0xfb,0x10,0x4d,0x00,0x71,0xc0,0x18,0xcc,0x30,0x2b,
+0xff,0xf4,0xd4,0x00,0x20,0xf9,0x00,0x9a,0x02,0x20,0xfb,0x00,0xa0,0x04,0x20,0xfb,
+0xaf,0x75,0x05,0xf1,0x00,0xfa,0x7f,0xff,0x40,0x06,0xff,0xf5,0x0e,0xff,0xfd,0xdf,
+0xff,0xd0,0x03,0xef,0xde,0x00,0x40,0x17,0xcf,0xfd,0x81,0xaa,0x04,0x81,0xbe,0xf5,
+0x00,0x00,0x04,0xef,0xff,0xf5,0x23,0x01,0x91,0xd4,0x00,0x03,0xff,0xfb,0x30,0x00,
+0x00,0x0d,0x26,0x01,0xd0,0x4f,0xff,0x27,0xab,0x81,0x00,0x8f,0xfd,0xef,0xff,0xff,
+0x40,0xbf,0x66,0x00,0xd0,0xe1,0xcf,0xff,0x81,0x19,0xff,0xf7,0xdf,0xfa,0x00,0x00,
+0xcf,0xfc,0x68,0x02,0x40,0x8f,0xfe,0xbf,0xfa,0x06,0x00,0xf0,0x03,0x8f,0xfe,0x00,
+0x00,0xbf,0xfc,0x3f,0xff,0x70,0x05,0xff,0xf7,0x0a,0xff,0xfe,0xdf,0xff,0xe0,0xc3,
+0x04,0x10,0xfe,0xc1,0x04,0x23,0xfd,0x81,0x8a,0x06,0x11,0xc4,0x06,0x00,0x80,0xfc,
+0x3c,0xcc,0xcc,0xcc,0xcf,0xff,0x80,0x62,0x05,0x01,0x02,0x01,0x32,0x00,0x9f,0xfa,
+0x85,0x03,0x11,0x30,0x56,0x01,0x30,0xc0,0x00,0x00,0xb9,0x02,0x06,0x2d,0x02,0x11,
+0x0e,0x2d,0x02,0x10,0x06,0x6c,0x04,0x00,0x3f,0x06,0x02,0xbd,0x01,0x11,0x20,0x2e,
+0x02,0x11,0xb0,0x2c,0x01,0x11,0xf4,0xef,0x00,0x12,0xfd,0x59,0x02,0x10,0x60,0x07,
+0x00,0x42,0x3a,0xef,0xfd,0x81,0x8f,0x02,0xf0,0x00,0x30,0x2f,0xff,0xfc,0xdf,0xff,
+0xd0,0x6f,0xff,0x30,0x07,0xff,0xf3,0x7f,0xfe,0x87,0x02,0x10,0x3f,0x0c,0x00,0x20,
+0xf0,0x0a,0x18,0x00,0x30,0x60,0x00,0x9f,0x6e,0x05,0x11,0x07,0x6c,0x05,0x80,0x3f,
+0xff,0x71,0x1a,0xff,0xe0,0xaf,0xfb,0xd7,0x02,0x10,0xdf,0xb6,0x04,0x30,0xf9,0xdf,
+0xfa,0x4d,0x01,0x70,0xaf,0xff,0x30,0x06,0xff,0xf6,0x3f,0x3b,0x01,0x12,0xe0,0x54,
+0x00,0x50,0x00,0x3a,0xdf,0xfd,0x81,0x49,0x03,0x30,0xeb,0x30,0x00,0x4d,0x01,0x30,
+0xf7,0x00,0x1e,0x61,0x03,0xf0,0x00,0x40,0x7f,0xff,0x40,0x0b,0xff,0xd0,0xcf,0xfa,
+0x00,0x02,0xff,0xf2,0xef,0xf7,0x48,0x00,0x80,0xff,0xf7,0x00,0x00,0xef,0xf7,0xdf,
+0xfb,0x69,0x02,0x10,0x8f,0x60,0x00,0x11,0xf7,0xf8,0x06,0xd1,0xf6,0x03,0xef,0xff,
+0xfc,0xff,0xf4,0x00,0x06,0x98,0x43,0xff,0xf0,0xec,0x02,0xa0,0xa0,0x00,0x00,0x03,
+0xbf,0xff,0x20,0x00,0x6d,0xff,0x33,0x00,0x11,0x7f,0x6d,0x06,0xe2,0x7f,0xec,0x71,
+0x00,0x00,0x1c,0xf9,0x07,0xff,0xf3,0x5f,0xff,0x20,0x69,0xde,0x06,0x04,0x01,0x00,
+0xfd,0x08,0x69,0x40,0x5f,0xff,0x27,0xff,0xf3,0x1c,0xfa,0x00,0x02,0xdf,0x70,0x0a,
+0xff,0xf0,0x08,0xff,0xe0,0x00,0x79,0x20,0x00,0x01,0x00,0xf2,0x07,0x01,0xee,0xa0,
+0x01,0xff,0xc0,0x01,0xff,0xb0,0x03,0xff,0x90,0x07,0xff,0x50,0x0d,0xfd,0x00,0x1d,
+0xf3,0x00,0x00,0x29,0x00,0x50,0x17,0x90,0x00,0x00,0x03,0xf0,0x00,0xf0,0x03,0x5c,
+0xff,0xff,0xb0,0x17,0xef,0xff,0xff,0xb4,0x4f,0xff,0xff,0xd7,0x10,0x05,0xff,0xfa,
+0x30,0x63,0x01,0x20,0xfc,0x61,0xfe,0x06,0x30,0xff,0xfb,0x50,0xc8,0x07,0x00,0x6b,
+0x01,0x21,0x29,0xff,0x53,0x02,0x21,0x7d,0xb0,0x1e,0x07,0x11,0x6f,0xc2,0x02,0x02,
+0x06,0x00,0x68,0x5c,0xcc,0xcc,0xcc,0xcc,0xc0,0x78,0x00,0x02,0x12,0x00,0x08,0x24,
+0x00,0x21,0x88,0x10,0x49,0x03,0x10,0xa4,0xf1,0x01,0xe0,0xff,0xfd,0x60,0x00,0x03,
+0xaf,0xff,0xff,0xf9,0x20,0x00,0x05,0xbf,0xff,0xe0,0x01,0xf1,0x05,0x18,0xff,0xf9,
+0x00,0x00,0x5b,0xff,0xff,0x90,0x4a,0xff,0xff,0xfe,0x82,0x9f,0xff,0xff,0xd6,0x00,
+0x09,0x88,0x00,0x34,0x9e,0x81,0x00,0x32,0x06,0x20,0x00,0x29,0x77,0x01,0x10,0x04,
+0x83,0x01,0x20,0x10,0x0e,0x71,0x01,0x20,0xa0,0x5f,0x52,0x07,0x51,0xf0,0x4b,0xba,
+0x00,0x05,0x4a,0x02,0x11,0x08,0x6f,0x08,0x10,0x3f,0x50,0x00,0x11,0x04,0xac,0x00,
+0x11,0x2f,0x22,0x02,0x21,0xaf,0xfc,0x3a,0x02,0x01,0x27,0x02,0x26,0xab,0xb0,0xa4,
+0x00,0x21,0x39,0x50,0x03,0x06,0x11,0xf5,0x45,0x02,0x11,0xf7,0x8a,0x02,0x11,0xc1,
+0x19,0x00,0x51,0x04,0x9d,0xff,0xec,0x82,0x0a,0x00,0x10,0x2c,0xbb,0x00,0x02,0x73,
+0x02,0xb1,0xfe,0x72,0x00,0x03,0x8f,0xfd,0x10,0x00,0x00,0x4f,0xfb,0x25,0x07,0x42,
+0xfb,0x00,0x00,0x1e,0x6b,0x08,0xe0,0x1e,0xf5,0x00,0x08,0xfe,0x10,0x00,0x6d,0xfe,
+0xa2,0x00,0x6f,0xc0,0x00,0x87,0x07,0xf0,0x51,0xff,0xff,0xf1,0x01,0xff,0x10,0x5f,
+0xf1,0x00,0x7f,0xf7,0x16,0xff,0x00,0x0c,0xf5,0x09,0xfb,0x00,0x1f,0xf9,0x00,0x6f,
+0xf0,0x00,0xaf,0x70,0xcf,0x80,0x06,0xff,0x20,0x07,0xfe,0x00,0x09,0xf7,0x0e,0xf6,
+0x00,0xaf,0xe0,0x00,0x9f,0xc0,0x00,0x9f,0x70,0xff,0x50,0x0d,0xfb,0x00,0x0a,0xfb,
+0x00,0x0b,0xf6,0x0f,0xf5,0x00,0xef,0xb0,0x00,0xcf,0x90,0x00,0xef,0x30,0xef,0x60,
+0x0d,0xfd,0x00,0x1f,0xf8,0x00,0x4f,0xe0,0x0c,0xf8,0x00,0xaf,0xf7,0x3c,0xff,0xc0,
+0x1d,0xf7,0x00,0x9f,0xd0,0x02,0xff,0xff,0xfa,0x33,0x08,0xd5,0x03,0xff,0x30,0x04,
+0xdf,0xd5,0x06,0xdf,0xd7,0x00,0x00,0x0c,0xfd,0xd4,0x00,0x34,0x3f,0xfc,0x10,0x0b,
+0x00,0x61,0x6f,0xff,0x94,0x21,0x24,0x86,0x0b,0x00,0x11,0x4d,0xbb,0x09,0x01,0x0b,
+0x00,0x24,0x05,0xad,0xdc,0x00,0x23,0x00,0xcf,0x37,0x00,0x12,0x2f,0x42,0x03,0x00,
+0xd2,0x04,0x22,0xa0,0x00,0xe1,0x04,0x22,0xff,0x00,0xf0,0x04,0x22,0xef,0xf6,0xff,
+0x04,0x13,0xb9,0x97,0x03,0x41,0xf6,0x4f,0xff,0x20,0x80,0x03,0x31,0x10,0xef,0xf8,
+0xb8,0x02,0x40,0xb0,0x09,0xff,0xd0,0x45,0x01,0x50,0xf6,0x00,0x4f,0xff,0x40,0xb9,
+0x02,0x40,0x10,0x00,0xef,0xfa,0x3f,0x04,0x02,0x74,0x0a,0x11,0x03,0x08,0x00,0x01,
+0x68,0x03,0x90,0xee,0xee,0xee,0xff,0xfc,0x00,0x0f,0xff,0xc0,0x50,0x00,0x41,0xf2,
+0x05,0xff,0xf6,0x61,0x00,0x31,0x80,0xbf,0xff,0x72,0x00,0x10,0xfe,0xf4,0x02,0x31,
+0xff,0xd9,0x30,0x07,0x00,0x80,0xff,0xf8,0x00,0x7f,0xff,0xee,0xef,0xff,0x52,0x03,
+0x00,0xc8,0x00,0x30,0xa0,0x7f,0xff,0xee,0x03,0x12,0xc0,0x07,0x00,0x00,0x0e,0x00,
+0x41,0x01,0x7f,0xff,0x40,0x2a,0x00,0x12,0xf7,0x31,0x00,0xb0,0xd4,0x00,0x7f,0xff,
+0x98,0x89,0xdf,0xff,0x50,0x7f,0xff,0x96,0x00,0x30,0xe0,0x7f,0xff,0x32,0x04,0x17,
+0xf2,0x07,0x00,0xb1,0x2e,0xff,0xf0,0x7f,0xff,0xdd,0xde,0xff,0xff,0x90,0x7f,0x86,
+0x04,0x01,0x38,0x00,0xb0,0xeb,0x60,0x00,0x00,0x01,0x8c,0xef,0xea,0x40,0x00,0x00,
+0x99,0x05,0x10,0xfa,0x5d,0x02,0x00,0x2a,0x01,0x80,0x0e,0xff,0xe4,0x00,0x2b,0xff,
+0xf4,0x5f,0xd3,0x00,0x30,0xef,0xfa,0xaf,0x28,0x01,0x32,0x9e,0xec,0xdf,0xee,0x01,
+0x2e,0xff,0xf9,0x07,0x00,0x01,0xf4,0x00,0x04,0x85,0x04,0x50,0x8c,0xca,0x6f,0xff,
+0x30,0x13,0x00,0x92,0x0f,0xff,0xd3,0x00,0x1a,0xff,0xf5,0x05,0xff,0x7e,0x01,0x20,
+0x6f,0xff,0xb7,0x01,0x00,0x2c,0x07,0x20,0xea,0x40,0x7e,0x00,0x32,0xfd,0x82,0x00,
+0xbd,0x00,0x10,0x60,0xee,0x00,0x02,0xf5,0x00,0x32,0x00,0x03,0xcf,0xf5,0x00,0x37,
+0x0d,0xff,0xc0,0xbd,0x00,0x50,0x02,0xff,0xf6,0x7f,0xff,0x6e,0x00,0x12,0xf7,0x07,
+0x00,0x17,0xf8,0x0e,0x00,0x03,0x1c,0x00,0x03,0x2a,0x00,0x02,0x38,0x00,0x11,0x02,
+0x46,0x00,0x42,0xdd,0xef,0xff,0xf9,0x62,0x00,0x19,0x70,0x70,0x00,0x13,0xff,0x06,
+0x00,0x00,0x93,0x01,0x21,0xed,0x7f,0x80,0x01,0x0f,0x06,0x00,0x01,0x00,0x55,0x06,
+0x04,0x06,0x00,0x4f,0xcc,0xcc,0xcc,0x90,0x2a,0x00,0x07,0x4a,0xdd,0xdd,0xdd,0xdd,
+0x5a,0x00,0x00,0x4d,0x01,0x03,0x06,0x00,0x00,0x66,0x00,0x1f,0xe8,0x3c,0x00,0x0a,
+0x1a,0xa0,0x6c,0x00,0x0f,0x2a,0x00,0x05,0x0b,0x06,0x00,0x00,0xc2,0x08,0x31,0xef,
+0xeb,0x60,0xbc,0x06,0x30,0xff,0xff,0xd2,0x6b,0x02,0xd0,0xfe,0xff,0xff,0xe0,0x00,
+0xdf,0xff,0x50,0x00,0x8f,0xff,0x70,0x4f,0x42,0x05,0x30,0xbf,0xfd,0x09,0x60,0x05,
+0x40,0x03,0x88,0x70,0xcf,0x04,0x04,0x00,0x1f,0x01,0x14,0xb0,0xb0,0x01,0x00,0xe4,
+0x07,0x00,0x0f,0x00,0xb1,0xbf,0xff,0xff,0xf0,0xcf,0xfc,0x00,0x06,0x99,0xcf,0xff,
+0x2d,0x00,0x10,0x07,0x32,0x0d,0x11,0x70,0x65,0x00,0x90,0xdf,0xff,0x70,0x00,0x1b,
+0xff,0xf0,0x03,0xff,0x6d,0x04,0x11,0xfe,0xeb,0x05,0x93,0xff,0xfc,0x20,0x00,0x01,
+0x6c,0xef,0xed,0x94,0x86,0x00,0x51,0x1f,0xff,0x67,0xff,0xf0,0x01,0x03,0x0f,0x0f,
+0x00,0x14,0x11,0xff,0x00,0x06,0x12,0x7f,0x08,0x00,0x8f,0x67,0xff,0xfd,0xdd,0xdd,
+0xdd,0xff,0xf6,0x4b,0x00,0x21,0x6f,0x60,0x4f,0xff,0x44,0xff,0xf4,0x05,0x00,0x12,
+0x11,0x40,0xdc,0x04,0x1f,0xfe,0x06,0x00,0x29,0x20,0x13,0x33,0x06,0x00,0x00,0xdf,
+0x03,0xe1,0xbf,0xfd,0x4f,0xff,0x90,0x05,0xff,0xf9,0x0d,0xff,0xff,0xef,0xff,0xf2,
+0x14,0x01,0x61,0x50,0x00,0x18,0xdf,0xfd,0x92,0x11,0x01,0x41,0x07,0xff,0xfd,0x07,
+0xf8,0x03,0x20,0xfe,0x20,0xa7,0x03,0x30,0xef,0xff,0x40,0x0f,0x00,0x11,0xcf,0x82,
+0x02,0x20,0x00,0x8f,0x72,0x0c,0x00,0x18,0x0f,0x10,0xc0,0x3e,0x01,0x31,0x2f,0xff,
+0xe1,0x30,0x00,0x23,0xff,0xf6,0x6f,0x02,0x22,0xc0,0x00,0x8a,0x07,0x01,0x7d,0x01,
+0xb1,0xf9,0xdf,0xff,0x20,0x00,0x07,0xff,0xfa,0x04,0xff,0xfc,0x6b,0x01,0x40,0x0a,
+0xff,0xf7,0x00,0x4b,0x00,0x31,0x1e,0xff,0xf2,0x69,0x00,0x40,0x5f,0xff,0xc0,0x07,
+0x11,0x01,0x50,0xbf,0xff,0x70,0x7f,0xff,0x18,0x01,0x2e,0xff,0x20,0x3b,0x02,0x0f,
+0x06,0x00,0x30,0x00,0xa1,0x02,0x12,0xd6,0x95,0x04,0x60,0x7f,0xff,0xff,0xff,0xff,
+0xf8,0xf1,0x0b,0x7f,0xff,0xf4,0x00,0x00,0x00,0x05,0xff,0xff,0x77,0xff,0xff,0xa0,
+0x00,0x00,0x00,0xaf,0xff,0xf7,0x7f,0xff,0xff,0x00,0x00,0x00,0x0f,0x13,0x00,0xf0,
+0x42,0xf5,0x00,0x00,0x06,0xff,0xff,0xf7,0x7f,0xfe,0xff,0xb0,0x00,0x00,0xbf,0xfe,
+0xff,0x77,0xff,0xbe,0xff,0x10,0x00,0x1f,0xfd,0xcf,0xf7,0x7f,0xfc,0x8f,0xf6,0x00,
+0x07,0xff,0x8c,0xff,0x77,0xff,0xd2,0xff,0xc0,0x00,0xcf,0xf2,0xdf,0xf7,0x7f,0xfd,
+0x0c,0xff,0x20,0x2f,0xfc,0x0e,0xff,0x77,0xff,0xe0,0x7f,0xf7,0x08,0xff,0x60,0xef,
+0xf7,0x7f,0xff,0x01,0xff,0xd0,0xdf,0xf1,0x0f,0xff,0x77,0xff,0xf0,0x0b,0xff,0x6f,
+0xfb,0x00,0x5f,0x00,0x51,0x00,0x5f,0xff,0xff,0x50,0x13,0x00,0x42,0x00,0xff,0xff,
+0xf0,0x13,0x00,0x42,0x0a,0xff,0xf9,0x00,0x13,0x00,0x32,0x4f,0xff,0x30,0x13,0x00,
+0xf2,0x0a,0x00,0xef,0xe0,0x00,0x0f,0xff,0x70,0x7f,0xff,0x50,0x00,0x00,0x1f,0xff,
+0x67,0xff,0xfe,0x00,0x00,0x01,0xff,0xf6,0x7f,0xff,0xf9,0x0f,0x00,0x22,0xff,0xf3,
+0x0f,0x00,0x22,0xff,0xc0,0x0f,0x00,0x21,0xff,0x60,0x0f,0x00,0x30,0x9f,0xfe,0x10,
+0x0f,0x00,0x31,0xf1,0xef,0xfa,0x0f,0x00,0x60,0x04,0xff,0xf3,0x1f,0xff,0x67,0x7d,
+0x00,0x10,0xd2,0x0f,0x00,0x40,0x00,0x2f,0xff,0x9f,0x0f,0x00,0x31,0x00,0x7f,0xff,
+0x0f,0x00,0x31,0x00,0xdf,0xff,0x0f,0x00,0x13,0x04,0x0f,0x00,0x12,0x0a,0x0f,0x00,
+0x22,0x00,0x1e,0x0f,0x00,0xf0,0x00,0x00,0x6f,0xff,0x60,0x00,0x00,0x6c,0xef,0xda,
+0x30,0x00,0x00,0x03,0xef,0xff,0x23,0x01,0x20,0x03,0xff,0x01,0x00,0xa0,0xb0,0x00,
+0xdf,0xff,0x60,0x02,0xbf,0xff,0x60,0x4f,0x21,0x00,0x50,0xdf,0xfd,0x0a,0xff,0xe0,
+0x2a,0x01,0xf1,0x03,0xf3,0xdf,0xfb,0x00,0x00,0x00,0x2f,0xff,0x6e,0xff,0x90,0x00,
+0x00,0x00,0xff,0xf7,0xff,0xf9,0x4a,0x01,0x13,0x8e,0x0f,0x00,0x03,0x1e,0x00,0x13,
+0x6a,0x2d,0x00,0x11,0x5f,0x3c,0x00,0x10,0xfe,0x4b,0x00,0x80,0x01,0xbf,0xff,0x60,
+0x03,0xff,0xff,0xfe,0x5a,0x00,0x03,0x69,0x00,0x01,0x78,0x00,0x20,0x40,0x00,0xaa,
+0x00,0x31,0xff,0xda,0x40,0x07,0x00,0xa0,0xff,0xfa,0x00,0x7f,0xff,0xee,0xee,0xff,
+0xff,0x90,0x9d,0x00,0x30,0x2d,0xff,0xf2,0x07,0x00,0x12,0x03,0x2d,0x01,0x30,0x00,
+0xff,0xf8,0x07,0x00,0x12,0x01,0x07,0x00,0xa1,0x1b,0xff,0xf4,0x7f,0xff,0xdd,0xde,
+0xff,0xff,0xc0,0x38,0x00,0x20,0xfc,0x10,0x07,0x00,0x31,0xeb,0x50,0x00,0x2a,0x00,
+0x1f,0x00,0x07,0x00,0x11,0x85,0x00,0x00,0x07,0xce,0xfd,0xa3,0x00,0x00,0x8f,0x00,
+0x10,0x3f,0x49,0x00,0x23,0xfb,0x00,0xf9,0x00,0x20,0x50,0x05,0x1c,0x02,0x33,0x0d,
+0xff,0xd0,0xfa,0x00,0x20,0xf2,0x0d,0x24,0x00,0x60,0x02,0xff,0xf5,0x0f,0xff,0x90,
+0x86,0x00,0x41,0xf7,0x0f,0xff,0x80,0x95,0x00,0x04,0x10,0x00,0x04,0x20,0x00,0x04,
+0x30,0x00,0x31,0x05,0xff,0xf6,0x40,0x00,0x04,0x50,0x00,0x00,0x60,0x00,0x33,0xef,
+0xff,0xfa,0x70,0x00,0x70,0xd0,0x00,0x00,0x00,0x17,0xce,0xff,0x10,0x00,0x11,0x00,
+0x96,0x02,0x12,0xd2,0x93,0x00,0x22,0xff,0xa0,0x11,0x00,0x19,0x48,0x17,0x01,0x10,
+0xf9,0x17,0x01,0x40,0xef,0xff,0xff,0x70,0xbc,0x00,0x30,0x4f,0xff,0xe0,0x07,0x00,
+0x30,0x08,0xff,0xf1,0x07,0x00,0x12,0x06,0x25,0x01,0xa1,0x09,0xff,0xf0,0x7f,0xff,
+0x00,0x01,0x6f,0xff,0xa0,0x31,0x00,0x21,0xfe,0x20,0x07,0x00,0x12,0xb2,0x38,0x00,
+0x10,0x60,0xf4,0x00,0x30,0x0d,0xff,0xe0,0x07,0x00,0x31,0x04,0xff,0xf7,0x02,0x01,
+0x32,0xcf,0xfe,0x00,0x4d,0x00,0x10,0x80,0x07,0x00,0x32,0x0b,0xff,0xf1,0x6b,0x01,
+0xa0,0xf8,0x00,0x00,0x6b,0xef,0xec,0x70,0x00,0x00,0x3e,0x46,0x00,0xf0,0x01,0x30,
+0x01,0xef,0xff,0xfd,0xff,0xff,0xe1,0x07,0xff,0xf7,0x00,0x06,0xff,0xf9,0x09,0xdb,
+0x00,0xd0,0xcf,0xfc,0x08,0xff,0xf2,0x00,0x00,0x13,0x32,0x02,0xff,0xff,0x82,0xab,
+0x00,0xc0,0x5f,0xff,0xff,0xc7,0x10,0x00,0x00,0x03,0xcf,0xff,0xff,0xf8,0x4f,0x01,
+0x40,0x9e,0xff,0xff,0xb0,0x18,0x00,0xa1,0x4c,0xff,0xf7,0x17,0x77,0x20,0x00,0x00,
+0xdf,0xfc,0x2b,0x01,0xf0,0x03,0xaf,0xfe,0x0c,0xff,0xf5,0x00,0x03,0xff,0xfc,0x03,
+0xff,0xff,0xfd,0xef,0xff,0xf5,0x00,0x4e,0xa2,0x00,0x10,0x80,0x70,0x00,0x51,0xfd,
+0x93,0x00,0x8f,0xff,0x01,0x00,0x12,0x68,0x07,0x00,0x90,0xf6,0x7e,0xee,0xee,0xff,
+0xfe,0xee,0xee,0x50,0xa1,0x02,0x31,0x20,0x00,0x00,0xe7,0x00,0x01,0x18,0x01,0x0f,
+0x0f,0x00,0x45,0x21,0xaf,0xfe,0xc5,0x01,0x0f,0x07,0x00,0x33,0x50,0x9f,0xff,0x00,
+0x00,0x02,0x61,0x03,0xf1,0x07,0x20,0x00,0x05,0xff,0xf4,0x3f,0xff,0xc2,0x00,0x3e,
+0xff,0xe0,0x0a,0xff,0xff,0xee,0xff,0xff,0x60,0x00,0xbf,0xff,0x28,0x01,0x90,0x04,
+0xae,0xff,0xd9,0x30,0x00,0xcf,0xff,0x20,0xf5,0x01,0x10,0xf6,0x87,0x03,0x00,0x85,
+0x01,0x30,0x1f,0xff,0xb0,0xfd,0x03,0x40,0xb0,0x0b,0xff,0xf0,0x59,0x01,0x11,0x60,
+0x85,0x02,0x40,0xaf,0xff,0x10,0x00,0x69,0x03,0x21,0xef,0xfa,0xa8,0x00,0x40,0x03,
+0xff,0xf5,0x00,0x45,0x04,0x10,0x08,0x24,0x00,0x31,0x0e,0xff,0x80,0x79,0x02,0xd0,
+0x09,0xff,0xc0,0x2f,0xff,0x40,0x00,0x00,0x04,0xff,0xf1,0x7f,0xfe,0xd7,0x00,0x40,
+0xef,0xf6,0xbf,0xf9,0x08,0x00,0x61,0x9f,0xfc,0xff,0xf3,0x00,0x00,0xde,0x02,0x10,
+0xe0,0x08,0x00,0x11,0x0d,0x74,0x01,0x00,0x3f,0x02,0x40,0xff,0x30,0x00,0x00,0xa8,
+0x00,0x13,0xfd,0x14,0x03,0xa0,0x1f,0xff,0x20,0x00,0x0f,0xff,0x74,0xff,0xf3,0x00,
+0x76,0x00,0xf1,0x0c,0x02,0xff,0xf4,0x0f,0xff,0x60,0x00,0x8f,0xff,0x90,0x00,0x5f,
+0xff,0x00,0xdf,0xf9,0x00,0x0c,0xff,0xfd,0x00,0x08,0xff,0xd0,0x09,0xff,0xc0,0xd5,
+0x04,0x20,0xbf,0xf9,0x18,0x00,0xf0,0x2a,0x4f,0xff,0xff,0x40,0x0e,0xff,0x60,0x02,
+0xff,0xf2,0x07,0xff,0x9f,0xf8,0x01,0xff,0xf2,0x00,0x0e,0xff,0x50,0xbf,0xf1,0xff,
+0xb0,0x4f,0xfe,0x00,0x00,0xbf,0xf8,0x0f,0xfc,0x0c,0xff,0x07,0xff,0xb0,0x00,0x07,
 0xff,0xb2,0xff,0x90,0x8f,0xf3,0xaf,0xf7,0x00,0x00,0x4f,0xfe,0x6f,0xf5,0x04,0xff,
 0x6d,0xac,0x00,0x60,0xff,0xfc,0xff,0x10,0x0f,0xfb,0xc6,0x00,0x10,0x0c,0x11,0x03,
-0x31,0xcf,0xff,0xfd,0x6d,0x0c,0x10,0xf9,0x9c,0x00,0x10,0x90,0xb4,0x05,0x00,0x85,
-0x12,0x21,0xff,0xf6,0x53,0x04,0x11,0xf1,0x33,0x06,0x00,0xd8,0x00,0x20,0xfd,0x00,
-0xcb,0x02,0x00,0x1e,0x01,0x10,0xb0,0xb8,0x00,0xb1,0x90,0xbf,0xff,0x30,0x00,0x0e,
-0xff,0xe1,0x02,0xff,0xfc,0x84,0x12,0x60,0x08,0xff,0xf5,0x01,0xff,0xfc,0x19,0x01,
-0x31,0xd0,0x9f,0xff,0x19,0x0d,0x11,0x8f,0x54,0x03,0x14,0xcf,0xc0,0x0f,0x02,0x3b,
-0x0c,0x20,0x0c,0xff,0xc7,0x11,0x00,0x17,0x05,0x13,0xf8,0x43,0x0b,0x11,0xf2,0x07,
-0x01,0x11,0x8f,0x81,0x01,0x00,0x3c,0x00,0x80,0x50,0x00,0x0a,0xff,0xf4,0x01,0xff,
-0xfe,0x62,0x0f,0x50,0x00,0x07,0xff,0xf8,0x00,0xe2,0x06,0x10,0x0e,0x6e,0x03,0x11,
-0x90,0x7d,0x00,0x30,0xbf,0xff,0x10,0x87,0x01,0x31,0x83,0xff,0xf8,0xba,0x01,0x31,
-0x0a,0xff,0xf1,0x3f,0x03,0x00,0x2c,0x11,0x20,0xaf,0xfe,0xa9,0x01,0x00,0x0b,0x00,
-0x00,0x07,0x02,0x01,0x36,0x03,0x53,0x09,0xff,0xd1,0xff,0xf7,0x71,0x14,0x01,0x97,
-0x01,0x02,0xa0,0x14,0x12,0x01,0x0a,0x04,0x02,0x3e,0x13,0x01,0x94,0x02,0x12,0x30,
-0x94,0x02,0x1f,0xf3,0x0f,0x00,0x0e,0x21,0x2f,0xff,0x31,0x05,0x03,0x07,0x00,0x41,
-0x1e,0xee,0xee,0xee,0x15,0x10,0x00,0x19,0x00,0x12,0xa0,0xa4,0x0b,0x11,0x10,0x59,
-0x00,0x01,0x2d,0x0c,0x12,0x4f,0x46,0x11,0x22,0xef,0xfd,0x1d,0x15,0x12,0xf3,0xb8,
-0x03,0x01,0x58,0x12,0x31,0xef,0xfc,0x00,0x1b,0x0c,0x12,0xf2,0x1c,0x05,0x11,0x60,
-0x14,0x02,0x12,0xfb,0x2b,0x02,0x62,0xfe,0xdd,0xdd,0xdd,0xdb,0x2f,0xb4,0x16,0x03,
-0x07,0x00,0x30,0x9f,0xff,0xf7,0x03,0x00,0x5f,0xfe,0xa4,0x9f,0xfd,0x00,0x03,0x00,
-0x21,0x22,0xfe,0xa4,0x42,0x00,0x21,0xcf,0xfa,0xca,0x00,0x12,0xf1,0x1d,0x09,0x04,
-0xf7,0x0d,0x11,0x04,0x87,0x00,0x11,0x0e,0xae,0x00,0x00,0xa4,0x10,0x00,0x51,0x05,
-0x02,0xb9,0x0c,0x02,0xc7,0x0c,0x10,0x00,0xa0,0x0f,0x01,0xe3,0x0c,0x11,0xd0,0xd4,
-0x02,0x10,0x40,0xe9,0x00,0x0f,0x4a,0x00,0x04,0x10,0xf3,0x50,0x05,0xcf,0x88,0x30,
-0xdf,0xff,0xf3,0xdf,0xff,0xf3,0x8b,0xff,0xf3,0x02,0x03,0x00,0x22,0x11,0x8b,0x3f,
-0x00,0x01,0x44,0x12,0x50,0x78,0x40,0x00,0x00,0x06,0xcd,0x01,0x10,0x0c,0x55,0x01,
-0x10,0x3f,0x25,0x01,0xf0,0x0a,0xaf,0xe6,0xff,0x20,0x01,0xff,0x81,0xff,0x80,0x07,
-0xff,0x20,0xaf,0xe0,0x0d,0xfc,0x00,0x4f,0xf5,0x4f,0xf6,0x00,0x0e,0xfc,0xaa,0x01,
-0x00,0x11,0x7f,0x51,0x06,0x02,0x4f,0x07,0xf0,0x04,0x1a,0xaa,0x50,0x00,0x5f,0xfe,
-0x10,0x00,0x7f,0xfa,0x00,0x00,0x9f,0xf4,0x00,0x05,0xbe,0xfe,0xb4,0xd7,0x00,0x00,
-0x8e,0x02,0xb0,0x08,0xff,0xfa,0x8d,0xff,0xf2,0x00,0xcf,0xf9,0x00,0x1f,0x92,0x01,
-0x00,0x0d,0x14,0x00,0xe6,0x0c,0x51,0xff,0xff,0x90,0x03,0xef,0xfc,0x05,0x60,0xdf,
-0xfd,0x30,0x0d,0xff,0x90,0xdf,0x03,0x20,0xdf,0xf9,0x10,0x01,0x80,0x2f,0xff,0x90,
-0x0e,0xff,0xfa,0xbf,0xff,0x82,0x03,0x01,0xbb,0x06,0x53,0x4b,0xff,0xc6,0x7f,0xfe,
-0x42,0x12,0x0f,0x06,0x00,0x07,0x60,0x5c,0xfe,0xa2,0x00,0xbf,0xfe,0x3b,0x11,0x10,
-0xbf,0x81,0x05,0x81,0xd0,0xbf,0xff,0x20,0x07,0xff,0xf5,0xbf,0xed,0x10,0x20,0xbf,
-0xfb,0x90,0x14,0x20,0xbf,0xfb,0x82,0x12,0x06,0x0c,0x00,0x90,0xef,0xf9,0xbf,0xff,
-0x20,0x06,0xff,0xf5,0xbf,0x7d,0x11,0x40,0xe0,0xbf,0xfd,0xff,0x58,0x12,0xa1,0xf6,
-0x5c,0xfe,0xb3,0x00,0x00,0x03,0xae,0xfe,0xb4,0x82,0x12,0x00,0x2f,0x13,0xa0,0xff,
-0xcf,0xff,0xf4,0x0b,0xff,0xd1,0x01,0xcf,0xfa,0x33,0x04,0x31,0x5e,0xec,0x2f,0xa8,
-0x02,0x11,0x3f,0xb0,0x03,0x13,0x2f,0x00,0x13,0xb0,0x50,0x00,0x39,0x98,0x0b,0xff,
-0xd1,0x00,0xbf,0xfb,0x03,0xb5,0x13,0x12,0xf4,0x3c,0x00,0x03,0x48,0x00,0x01,0x2e,
-0x00,0x16,0x30,0x51,0x13,0x0d,0x0d,0x00,0x70,0x6d,0xfe,0x94,0xff,0xf3,0x00,0xaf,
-0x42,0x07,0x20,0x30,0x5f,0xbe,0x00,0x10,0xf3,0x88,0x14,0x50,0xaf,0xff,0x30,0xff,
-0xf8,0x27,0x00,0x00,0x1c,0x01,0x52,0x3f,0xff,0x33,0xff,0xf2,0x0d,0x00,0x10,0x30,
-0x34,0x00,0x40,0xff,0xf6,0x00,0x03,0x27,0x00,0x30,0xc0,0x00,0x7f,0x34,0x00,0x25,
-0xd9,0xbf,0x41,0x00,0x00,0xfb,0x0f,0x72,0xef,0xf3,0x00,0x01,0x8d,0xff,0xc6,0x8f,
-0x0c,0x10,0xfb,0xfa,0x0a,0xa0,0xcd,0xff,0xf8,0x00,0x8f,0xfe,0x20,0x07,0xff,0xf0,
-0xc2,0x12,0x32,0x0f,0xff,0x30,0x89,0x16,0x02,0xf7,0x02,0xa2,0x51,0xff,0xf9,0x55,
-0x55,0x55,0x51,0x0e,0xff,0xa0,0xbd,0x03,0xb3,0x60,0x00,0x6e,0x20,0x02,0xef,0xff,
-0xec,0xef,0xfd,0x00,0x53,0x0b,0x60,0x01,0x8c,0xff,0xd9,0x20,0x00,0x55,0x00,0x31,
-0x70,0x01,0xdf,0xb1,0x07,0x30,0xec,0x70,0x0b,0xa6,0x02,0x21,0xcf,0xfa,0x8e,0x18,
-0xa0,0xf2,0xaf,0xff,0xff,0xff,0x25,0x8e,0xff,0xd8,0x81,0x12,0x00,0x00,0x18,0x0f,
-0x1f,0x00,0x09,0x00,0x12,0x60,0x05,0xcf,0xfb,0x3b,0xff,0x60,0x58,0x14,0xf0,0x00,
-0xef,0xf6,0x04,0xff,0xff,0xdd,0xff,0xff,0x60,0xbf,0xff,0x30,0x05,0xff,0xf6,0x78,
-0x08,0x50,0x0f,0xff,0x62,0xff,0xf5,0xe8,0x0f,0x00,0xf4,0x00,0x00,0x0d,0x00,0x10,
-0xf4,0x0d,0x00,0x00,0x6f,0x07,0x14,0x0f,0x27,0x00,0x03,0x34,0x00,0x11,0x08,0x57,
-0x07,0x00,0x4e,0x00,0x33,0x3f,0xff,0x60,0x87,0x13,0x40,0x6b,0x10,0x00,0xbf,0xd4,
-0x18,0x62,0xbb,0xef,0xff,0x80,0x01,0xcf,0x05,0x09,0x10,0x6b,0x5e,0x0f,0x11,0xcf,
-0x3a,0x06,0x0f,0x06,0x00,0x07,0x51,0x3b,0xff,0xc4,0x00,0xcf,0x0e,0x02,0xe0,0xcf,
-0xff,0xfc,0xef,0xff,0xc0,0xcf,0xfd,0x10,0x09,0xff,0xf0,0xcf,0xf9,0xbf,0x03,0x4f,
-0xcf,0xf9,0x00,0x03,0x06,0x00,0x19,0xa1,0x3d,0xf7,0x0a,0xff,0xf0,0x8f,0xfd,0x00,
-0x67,0x10,0x11,0x12,0x2f,0x8f,0xfe,0x05,0x00,0x09,0x50,0x00,0x03,0xee,0x60,0x00,
-0x1c,0x07,0x00,0x86,0x06,0x01,0x33,0x00,0x03,0x47,0x12,0x0f,0x04,0x00,0x20,0x00,
-0xa2,0x10,0xb3,0x1d,0xef,0xff,0x80,0x1f,0xff,0xfe,0x10,0x1d,0xfe,0xa2,0x27,0x03,
-0x02,0x6a,0x04,0x0f,0x0d,0x00,0x05,0xf0,0x03,0xcf,0xff,0x40,0xbf,0xfb,0x00,0xaf,
-0xff,0x60,0x0b,0xff,0xb0,0x7f,0xff,0x80,0x00,0xbf,0xfb,0x86,0x06,0x60,0x0b,0xff,
-0xdf,0xff,0xc0,0x00,0xd9,0x07,0x12,0xf4,0xd4,0x03,0x02,0x0d,0x00,0x20,0xff,0x70,
-0x15,0x17,0x90,0xaf,0xff,0x20,0x00,0xbf,0xfb,0x01,0xef,0xfc,0x41,0x00,0x30,0x06,
-0xff,0xf6,0x4e,0x00,0x60,0x0c,0xff,0xf1,0x0b,0xff,0xb0,0xef,0x12,0x2f,0x8f,0xfe,
-0x02,0x00,0x0f,0xf0,0x05,0xbf,0xf8,0x3a,0xef,0xc5,0x01,0x9e,0xfd,0x80,0x0b,0xff,
-0xcf,0xff,0xff,0xf6,0xef,0xff,0xff,0xa0,0xbf,0x77,0x01,0x51,0xff,0xed,0xff,0xff,
-0x2b,0x06,0x03,0x21,0x80,0x04,0xc8,0x03,0x00,0x56,0x13,0x51,0x0f,0xff,0x7b,0xff,
+0x11,0xcf,0x8a,0x00,0x30,0x9f,0xff,0xf9,0x9c,0x00,0x11,0x90,0xb4,0x05,0x51,0x50,
+0x00,0x5f,0xff,0xf6,0x53,0x04,0x41,0xf1,0x00,0x01,0xff,0xb0,0x01,0x30,0xef,0xfd,
+0x00,0xcb,0x02,0x00,0x1e,0x01,0x10,0xb0,0xb8,0x00,0xf0,0x07,0x90,0xbf,0xff,0x30,
+0x00,0x0e,0xff,0xe1,0x02,0xff,0xfc,0x00,0x08,0xff,0xf6,0x00,0x08,0xff,0xf5,0x01,
+0xff,0xfc,0x19,0x01,0x40,0xd0,0x9f,0xff,0x30,0x27,0x00,0x11,0x8f,0x54,0x03,0x60,
+0xcf,0xff,0xff,0xf1,0x00,0x00,0xde,0x04,0x31,0xf7,0x00,0x00,0x72,0x00,0x20,0x10,
+0x00,0x2f,0x01,0x01,0xb4,0x02,0x00,0x26,0x05,0x11,0xf2,0x07,0x01,0x11,0x8f,0x81,
+0x01,0x00,0x3c,0x00,0x70,0x50,0x00,0x0a,0xff,0xf4,0x01,0xff,0x70,0x01,0xb0,0xfb,
+0x00,0x07,0xff,0xf8,0x00,0xdf,0xff,0x20,0x00,0x0e,0x6e,0x03,0x11,0x90,0x7d,0x00,
+0x30,0xbf,0xff,0x10,0x87,0x01,0x31,0x83,0xff,0xf8,0xba,0x01,0x31,0x0a,0xff,0xf1,
+0x3f,0x03,0x31,0x2f,0xff,0x70,0x4d,0x02,0x20,0xaf,0xfe,0x0b,0x00,0x00,0x07,0x02,
+0x01,0x36,0x03,0x31,0x09,0xff,0xd1,0x79,0x00,0x41,0x1f,0xff,0xcf,0xfe,0x97,0x01,
+0x00,0x0b,0x02,0x00,0x2d,0x02,0x01,0x0a,0x04,0x01,0xba,0x00,0x02,0x94,0x02,0x12,
+0x30,0x94,0x02,0x1f,0xf3,0x0f,0x00,0x0e,0x21,0x2f,0xff,0x31,0x05,0x03,0x07,0x00,
+0x40,0x1e,0xee,0xee,0xee,0x55,0x03,0x01,0x19,0x00,0x11,0xa0,0xd3,0x00,0x21,0xfe,
+0x10,0x59,0x00,0x10,0xf4,0x0d,0x00,0x11,0x4f,0xa1,0x05,0x01,0x3d,0x01,0x00,0x04,
+0x06,0x12,0xf3,0xb8,0x03,0x10,0x70,0x82,0x00,0x40,0xef,0xfc,0x00,0x00,0xc2,0x00,
+0x12,0xf2,0x1c,0x05,0x11,0x60,0x14,0x02,0x12,0xfb,0x2b,0x02,0x52,0xfe,0xdd,0xdd,
+0xdd,0xdb,0x62,0x00,0x13,0xfd,0x07,0x00,0x30,0x9f,0xff,0xf7,0x03,0x00,0x5f,0xfe,
+0xa4,0x9f,0xfd,0x00,0x03,0x00,0x21,0x22,0xfe,0xa4,0x42,0x00,0x21,0xcf,0xfa,0xca,
+0x00,0x11,0xf1,0x14,0x01,0x10,0x60,0x82,0x03,0x11,0xfc,0x90,0x01,0x00,0x87,0x00,
+0x11,0x0e,0xae,0x00,0x31,0x8f,0xfe,0x00,0x51,0x05,0x01,0x9e,0x00,0x11,0xb0,0xb1,
+0x00,0x10,0x10,0xc4,0x00,0x20,0xf7,0x00,0x4f,0x01,0x11,0xd0,0xd4,0x02,0x10,0x40,
+0xe9,0x00,0x0f,0x4a,0x00,0x04,0x10,0xf3,0x50,0x05,0xcf,0x88,0x30,0xdf,0xff,0xf3,
+0xdf,0xff,0xf3,0x8b,0xff,0xf3,0x02,0x03,0x00,0x22,0x11,0x8b,0x3f,0x00,0x10,0xdf,
+0x4e,0x00,0x50,0x78,0x40,0x00,0x00,0x06,0xcd,0x01,0x10,0x0c,0x55,0x01,0x10,0x3f,
+0x25,0x01,0xf0,0x0a,0xaf,0xe6,0xff,0x20,0x01,0xff,0x81,0xff,0x80,0x07,0xff,0x20,
+0xaf,0xe0,0x0d,0xfc,0x00,0x4f,0xf5,0x4f,0xf6,0x00,0x0e,0xfc,0xaa,0x01,0x00,0x11,
+0x7f,0x51,0x06,0x02,0x4f,0x07,0xf0,0x04,0x1a,0xaa,0x50,0x00,0x5f,0xfe,0x10,0x00,
+0x7f,0xfa,0x00,0x00,0x9f,0xf4,0x00,0x05,0xbe,0xfe,0xb4,0xd7,0x00,0x00,0x8e,0x02,
+0xd1,0x08,0xff,0xfa,0x8d,0xff,0xf2,0x00,0xcf,0xf9,0x00,0x1f,0xff,0x70,0xba,0x01,
+0xa1,0xf8,0x00,0x01,0x8c,0xef,0xff,0xff,0x90,0x03,0xef,0xfc,0x05,0x60,0xdf,0xfd,
+0x30,0x0d,0xff,0x90,0xdf,0x03,0x20,0xdf,0xf9,0x10,0x01,0x80,0x2f,0xff,0x90,0x0e,
+0xff,0xfa,0xbf,0xff,0x82,0x03,0x01,0xbb,0x06,0x71,0x4b,0xff,0xc6,0x7f,0xfe,0x00,
+0xbf,0xb5,0x01,0x0f,0x06,0x00,0x07,0x30,0x5c,0xfe,0xa2,0xe2,0x08,0x40,0xff,0xff,
+0x30,0xbf,0x81,0x05,0x70,0xd0,0xbf,0xff,0x20,0x07,0xff,0xf5,0x1e,0x00,0x20,0xef,
+0xf8,0x06,0x00,0x30,0xbf,0xfa,0xbf,0xd2,0x00,0x16,0xfb,0x0c,0x00,0xf0,0x0e,0xef,
+0xf9,0xbf,0xff,0x20,0x06,0xff,0xf5,0xbf,0xff,0xfc,0xdf,0xff,0xe0,0xbf,0xfd,0xff,
+0xff,0xff,0x40,0xbf,0xf6,0x5c,0xfe,0xb3,0x00,0x00,0x03,0xae,0xc1,0x00,0x10,0x6f,
+0xc2,0x05,0xc0,0x03,0xff,0xff,0xcf,0xff,0xf4,0x0b,0xff,0xd1,0x01,0xcf,0xfa,0x33,
+0x04,0x31,0x5e,0xec,0x2f,0xa8,0x02,0x11,0x3f,0xb0,0x03,0x02,0x0c,0x00,0xf2,0x03,
+0x0f,0xff,0x50,0x00,0x39,0x98,0x0b,0xff,0xd1,0x00,0xbf,0xfb,0x03,0xff,0xff,0xce,
+0xff,0xf4,0x3c,0x00,0x03,0x48,0x00,0x01,0x2e,0x00,0x11,0x30,0x9f,0x03,0x1f,0xf3,
+0x0d,0x00,0x02,0x70,0x6d,0xfe,0x94,0xff,0xf3,0x00,0xaf,0x42,0x07,0x20,0x30,0x5f,
+0xbe,0x00,0xa0,0xf3,0x0c,0xff,0xe2,0x00,0xaf,0xff,0x30,0xff,0xf8,0x27,0x00,0x00,
+0x1c,0x01,0x52,0x3f,0xff,0x33,0xff,0xf2,0x0d,0x00,0x10,0x30,0x34,0x00,0x40,0xff,
+0xf6,0x00,0x03,0x27,0x00,0x30,0xc0,0x00,0x7f,0x34,0x00,0x24,0xd9,0xbf,0x41,0x00,
+0x00,0x4e,0x00,0xc0,0xa2,0xef,0xf3,0x00,0x01,0x8d,0xff,0xc6,0x00,0x00,0x04,0xef,
+0xf5,0x07,0xf1,0x05,0x01,0xef,0xff,0xcd,0xff,0xf8,0x00,0x8f,0xfe,0x20,0x07,0xff,
+0xf0,0x0e,0xff,0x70,0x00,0x0f,0xff,0x30,0xb9,0x01,0x12,0xf5,0xf7,0x02,0xa2,0x51,
+0xff,0xf9,0x55,0x55,0x55,0x51,0x0e,0xff,0xa0,0xbd,0x03,0xa2,0x60,0x00,0x6e,0x20,
+0x02,0xef,0xff,0xec,0xef,0xfd,0xcf,0x07,0x80,0x50,0x00,0x01,0x8c,0xff,0xd9,0x20,
+0x00,0x55,0x00,0x31,0x70,0x01,0xdf,0xb1,0x07,0x30,0xec,0x70,0x0b,0xa6,0x02,0x20,
+0xcf,0xfa,0x75,0x09,0xc0,0xff,0xf2,0xaf,0xff,0xff,0xff,0x25,0x8e,0xff,0xd8,0x81,
+0x00,0xfb,0x02,0x10,0x0c,0x4a,0x00,0x0f,0x09,0x00,0x11,0xf0,0x0a,0x05,0xcf,0xfb,
+0x3b,0xff,0x60,0x08,0xff,0xff,0xff,0xef,0xf6,0x04,0xff,0xff,0xdd,0xff,0xff,0x60,
+0xbf,0xff,0x30,0x05,0xff,0xf6,0x78,0x08,0x30,0x0f,0xff,0x62,0x20,0x03,0x20,0xff,
+0xf6,0xf4,0x00,0x00,0x0d,0x00,0x10,0xf4,0x0d,0x00,0x00,0x6f,0x07,0x14,0x0f,0x27,
+0x00,0x03,0x34,0x00,0x11,0x08,0x57,0x07,0x00,0x4e,0x00,0x31,0x3f,0xff,0x60,0x5c,
+0x01,0xf2,0x01,0xf4,0x00,0x6b,0x10,0x00,0xbf,0xff,0x10,0x2f,0xff,0xbb,0xef,0xff,
+0x80,0x01,0xcf,0x05,0x09,0x61,0x6b,0xef,0xea,0x40,0x00,0xcf,0x3a,0x06,0x0f,0x06,
+0x00,0x07,0x51,0x3b,0xff,0xc4,0x00,0xcf,0x0e,0x02,0xe0,0xcf,0xff,0xfc,0xef,0xff,
+0xc0,0xcf,0xfd,0x10,0x09,0xff,0xf0,0xcf,0xf9,0xbf,0x03,0x4f,0xcf,0xf9,0x00,0x03,
+0x06,0x00,0x19,0xa0,0x3d,0xf7,0x0a,0xff,0xf0,0x8f,0xfd,0x00,0x67,0x10,0xad,0x04,
+0x3f,0xe0,0x8f,0xfe,0x05,0x00,0x09,0x50,0x00,0x03,0xee,0x60,0x00,0x1c,0x07,0x00,
+0x86,0x06,0x01,0x33,0x00,0x11,0x00,0x36,0x00,0x0f,0x04,0x00,0x22,0xe3,0x0c,0xff,
+0xc0,0x1d,0xef,0xff,0x80,0x1f,0xff,0xfe,0x10,0x1d,0xfe,0xa2,0x27,0x03,0x02,0x6a,
+0x04,0x0f,0x0d,0x00,0x05,0xf0,0x03,0xcf,0xff,0x40,0xbf,0xfb,0x00,0xaf,0xff,0x60,
+0x0b,0xff,0xb0,0x7f,0xff,0x80,0x00,0xbf,0xfb,0x86,0x06,0x60,0x0b,0xff,0xdf,0xff,
+0xc0,0x00,0xd9,0x07,0x12,0xf4,0xd4,0x03,0x02,0x0d,0x00,0xc0,0xff,0x70,0x00,0x0b,
+0xff,0xf4,0xaf,0xff,0x20,0x00,0xbf,0xfb,0x66,0x05,0x60,0x0b,0xff,0xb0,0x06,0xff,
+0xf6,0x4e,0x00,0x30,0x0c,0xff,0xf1,0x4e,0x00,0x5f,0x2f,0xff,0xb0,0x8f,0xfe,0x02,
+0x00,0x0f,0xf0,0x05,0xbf,0xf8,0x3a,0xef,0xc5,0x01,0x9e,0xfd,0x80,0x0b,0xff,0xcf,
+0xff,0xff,0xf6,0xef,0xff,0xff,0xa0,0xbf,0x77,0x01,0x51,0xff,0xed,0xff,0xff,0x2b,
+0x06,0x03,0x21,0x80,0x04,0xc8,0x03,0x91,0x05,0xff,0xf1,0x00,0x0f,0xff,0x7b,0xff,
 0xb0,0x2a,0x05,0x23,0xef,0xf7,0x13,0x00,0x1f,0x0e,0x13,0x00,0x27,0x90,0x70,0xcf,
 0xf7,0x3b,0xef,0xd5,0x00,0xcf,0xfc,0xe3,0x02,0x01,0xec,0x01,0x91,0xd0,0xcf,0xfe,
-0x20,0x09,0xff,0xf1,0xcf,0xfa,0xc2,0x01,0x0f,0x06,0x00,0x1c,0x00,0x4d,0x11,0x10,
-0xc6,0xd9,0x07,0x00,0xd1,0x11,0xf0,0x07,0x02,0xff,0xff,0xde,0xff,0xfb,0x00,0xaf,
-0xfe,0x20,0x08,0xff,0xf3,0x0f,0xff,0x70,0x00,0x0e,0xff,0x82,0xff,0xf3,0x6e,0x01,
-0x00,0x39,0x04,0x50,0x09,0xff,0xc2,0xff,0xf4,0x8e,0x04,0x02,0x1a,0x00,0x12,0x80,
-0x27,0x00,0x03,0x34,0x00,0x11,0x05,0xf2,0x0b,0x03,0x4e,0x00,0x30,0xbf,0xf7,0x6d,
-0xbe,0x01,0x12,0xff,0xd9,0x04,0xac,0xd9,0xaf,0xff,0xd0,0xbf,0xfd,0x00,0x06,0xff,
-0xf4,0xd9,0x04,0x11,0xbf,0xd9,0x04,0x11,0xcf,0x0c,0x00,0x30,0xff,0xf8,0xbf,0x50,
-0x00,0x21,0xf4,0xbf,0xd3,0x00,0x03,0x3c,0x00,0x02,0x21,0x05,0x0f,0x45,0x05,0x0a,
-0xe0,0x00,0x07,0xdf,0xe9,0x1d,0xff,0x30,0x0a,0xff,0xff,0xfd,0xff,0xf3,0x05,0xc8,
-0x04,0x33,0xff,0x30,0xcf,0xc1,0x00,0x00,0x3a,0x19,0x30,0x32,0xff,0xf3,0x75,0x04,
-0x00,0xc1,0x00,0x05,0x0d,0x00,0x00,0xc1,0x00,0x11,0x3f,0x27,0x00,0x15,0x09,0x34,
-0x00,0x00,0x11,0x04,0x00,0x34,0x18,0x3e,0xdf,0xe9,0x4f,0xf7,0x04,0x0e,0x0d,0x00,
-0x00,0x4b,0x09,0xe2,0x6d,0xf7,0xbf,0xfe,0xff,0xf7,0xbf,0xff,0xff,0xf6,0xbf,0xff,
-0x82,0x11,0xd1,0x00,0x0f,0x04,0x00,0x0b,0x80,0x00,0x07,0xcf,0xfe,0xa2,0x00,0x01,
-0xdf,0xbc,0x01,0x70,0x09,0xff,0xe8,0x7d,0xff,0xf1,0x0e,0x43,0x0e,0xb1,0xf5,0x0d,
-0xff,0xb1,0x00,0x01,0x10,0x07,0xff,0xff,0xc8,0x7d,0x0d,0x00,0xd1,0x1d,0x70,0x01,
-0x6a,0xef,0xff,0xe1,0x14,0x43,0xf9,0x09,0x10,0x3f,0x02,0x02,0x90,0xf6,0x0d,0xff,
-0xe8,0x7b,0xff,0xf2,0x02,0xef,0xc6,0x02,0x00,0x48,0x00,0x12,0xa3,0xe4,0x17,0x03,
-0x04,0x00,0x40,0xef,0xff,0xff,0xf8,0x04,0x00,0x48,0x78,0xff,0xfa,0x84,0x18,0x00,
-0x0a,0x04,0x00,0x10,0xf7,0x57,0x09,0x9f,0xd8,0x00,0x7f,0xff,0xfa,0x00,0x07,0xdf,
-0xe8,0x18,0x04,0x1d,0x02,0x32,0x02,0x20,0xaf,0xfe,0x28,0x1a,0x40,0x6f,0xff,0xec,
-0xef,0x81,0x0d,0x00,0x47,0x05,0x80,0x01,0xae,0xfe,0x92,0xff,0xf2,0xaf,0xfd,0xc0,
-0x18,0x00,0xae,0x02,0x00,0x89,0x0d,0x20,0x50,0x04,0x51,0x03,0xe0,0xa0,0x08,0xff,
-0xc0,0x05,0xff,0xe0,0x0d,0xff,0x70,0x00,0xff,0xf3,0x1f,0x77,0x03,0x90,0xf7,0x6f,
-0xfc,0x00,0x00,0x6f,0xfb,0xaf,0xf7,0x1a,0x08,0x21,0xef,0xf2,0x9d,0x03,0x11,0xd0,
-0xf1,0x0f,0x12,0x70,0x83,0x10,0x03,0x04,0x14,0x40,0x8f,0xfb,0x00,0x09,0xc8,0x07,
-0xb0,0xf2,0x4f,0xfe,0x00,0x0d,0xff,0x70,0x04,0xff,0xe0,0x0f,0x18,0x05,0xb0,0xb0,
-0x08,0xff,0xa0,0x0c,0xff,0x40,0x6f,0xff,0xf0,0x0b,0x41,0x05,0xf0,0x09,0x70,0xbf,
-0xff,0xf4,0x0e,0xff,0x20,0x04,0xff,0xb0,0xff,0xaf,0xf9,0x2f,0xfe,0x00,0x01,0xff,
-0xe4,0xff,0x4b,0xfd,0x5f,0xfa,0x55,0x02,0xb1,0xff,0x06,0xff,0xbf,0xf6,0x00,0x00,
-0x8f,0xff,0xfb,0x02,0x4a,0x0a,0x70,0x4f,0xff,0xf6,0x00,0xdf,0xff,0xe0,0x78,0x00,
-0x11,0xf2,0x48,0x11,0x01,0x0a,0x0e,0x01,0x4c,0x0f,0x11,0x09,0x9e,0x05,0x80,0x20,
-0x00,0x5f,0xff,0x50,0x01,0xff,0xf9,0x80,0x00,0x60,0x9f,0xff,0x10,0x03,0xff,0xf6,
-0x2e,0x0a,0x32,0x09,0xff,0xeb,0x35,0x00,0x21,0xff,0xf5,0x8d,0x09,0x11,0xfc,0x02,
-0x09,0x02,0xd5,0x08,0x22,0xff,0xfe,0xc6,0x0b,0x10,0xf7,0x19,0x06,0x30,0xd8,0xff,
-0xf1,0x5b,0x0c,0x00,0x29,0x09,0x20,0xdf,0xfb,0x18,0x0a,0x00,0x6c,0x0c,0x21,0xdf,
-0xfb,0x24,0x16,0x50,0xcf,0xfd,0x07,0xff,0xf2,0x4c,0x08,0x40,0x1f,0xff,0x60,0x05,
-0x59,0x08,0x40,0xfb,0x00,0xaf,0xfc,0x91,0x19,0x00,0x8a,0x02,0x50,0x1f,0xff,0x54,
-0xff,0xf2,0x76,0x1c,0x20,0x8f,0xfc,0x89,0x03,0x10,0xed,0x5c,0x00,0x12,0x0f,0x1b,
-0x0b,0x11,0xaf,0xf6,0x09,0x12,0x05,0x6f,0x00,0x12,0x0f,0xec,0x19,0x11,0xaf,0xf7,
-0x02,0x02,0xca,0x1a,0x11,0x04,0xfc,0x18,0x32,0x7d,0xff,0xf9,0x3f,0x20,0x10,0x10,
-0xa3,0x09,0x01,0xf7,0x1f,0x11,0x0f,0xce,0x02,0x02,0x06,0x00,0x41,0x0b,0xcc,0xcc,
-0xdf,0x9c,0x09,0x13,0xbf,0xda,0x0c,0x01,0xb5,0x00,0x20,0xa0,0x00,0x44,0x10,0x05,
-0x7b,0x0a,0x01,0x7a,0x0a,0x01,0x65,0x0a,0x00,0x56,0x0c,0x41,0xcc,0xcc,0xc4,0x2f,
-0x9e,0x06,0x02,0x06,0x00,0x00,0x27,0x24,0x81,0x00,0x00,0x8f,0xf4,0x00,0x07,0xff,
-0xd2,0x29,0x01,0x66,0x3f,0xfd,0x00,0x00,0x5f,0xfb,0x04,0x00,0x10,0x6f,0x07,0x0d,
-0xb0,0xf7,0x00,0x3a,0xff,0xe1,0x00,0x7f,0xfe,0x20,0x00,0x7f,0x46,0x08,0xa6,0xef,
-0xf4,0x00,0x00,0x7f,0xf9,0x00,0x00,0x5f,0xfa,0x28,0x00,0x20,0x4f,0xfb,0xef,0x1b,
-0x00,0x63,0x00,0x12,0x60,0x34,0x0d,0x10,0x2c,0x5c,0x0a,0x4f,0x20,0xff,0x1f,0xf1,
-0x03,0x00,0x08,0xb0,0x55,0x00,0x09,0x20,0x00,0x00,0x5f,0xf7,0x00,0x00,0x2d,0x37,
-0x00,0x00,0x8e,0x01,0x00,0x39,0x02,0x26,0xcf,0xf4,0x04,0x00,0x60,0xbf,0xf5,0x00,
-0x00,0x8f,0xf9,0xda,0x08,0xfa,0x01,0xa2,0x00,0x03,0xef,0xf5,0x00,0x09,0xff,0xf5,
-0x00,0x5f,0xfd,0x30,0x00,0xaf,0xf6,0x28,0x00,0x21,0xdf,0xf3,0x66,0x1f,0x10,0x07,
-0x2c,0x20,0x52,0xfe,0x20,0x00,0x3f,0xb1,0x19,0x19,0x80,0x01,0xae,0xfc,0x40,0x00,
-0x2a,0xa2,0x0d,0xda,0x09,0xf2,0x07,0x9f,0xf3,0x6f,0xff,0xdf,0xff,0xfd,0xff,0xe0,
-0xaf,0xf2,0x03,0xdf,0xff,0xff,0x50,0x79,0x70,0x00,0x08,0xef,0xd5,0x02,0x10,0x15,
-0x8a,0x25,0x18,0x25,0x0f,0xfb,0x0b,0x00,0x25,0xff,0xfb,0x15,0x00,0x10,0xfe,0x0b,
-0x00,0x60,0x14,0x44,0x44,0x44,0x44,0xff,0x0f,0x20,0x12,0x0e,0xc3,0x17,0x10,0x2e,
-0xde,0x04,0x50,0xbb,0xbb,0xbb,0xbb,0xb7,0x25,0x20,0x11,0x0f,0x85,0x1b,0x01,0x30,
-0x20,0x04,0xf5,0x10,0x24,0x2e,0xfa,0x15,0x00,0x34,0x00,0xbf,0xe0,0x15,0x00,0x40,
-0xaf,0xf3,0x0f,0xf4,0x4a,0x00,0x10,0x10,0xa0,0x20,0x11,0xff,0x41,0x10,0x00,0x0a,
-0x00,0x10,0x07,0x49,0x00,0x44,0xbf,0xf0,0x9f,0xf3,0x7e,0x00,0x05,0x0a,0x00,0x35,
-0x0f,0xff,0xf4,0x93,0x00,0x05,0x0a,0x00,0x25,0x0e,0xf4,0xa8,0x00,0x15,0x11,0x0a,
-0x00,0x14,0xa8,0x09,0x00,0x00,0xc7,0x20,0x03,0xc9,0x18,0x04,0x0a,0x00,0x34,0x0b,
-0xfe,0xff,0x8b,0x00,0x20,0xe2,0xff,0x80,0x00,0x53,0x41,0x00,0x0b,0xfe,0x20,0x80,
-0x00,0x40,0xbf,0xe2,0x00,0x7b,0x80,0x00,0x43,0xff,0x0b,0xfe,0x20,0x6a,0x00,0x24,
-0xaf,0xe2,0x74,0x00,0x24,0xef,0xb0,0x0a,0x00,0x24,0x3f,0xfa,0x0a,0x00,0x51,0x03,
-0xff,0xa0,0x00,0x24,0x10,0x01,0x51,0x00,0x3f,0xfa,0x00,0xef,0x47,0x00,0x43,0x00,
-0x03,0xff,0xa0,0x0f,0x01,0x34,0x00,0x3f,0xf9,0x6e,0x00,0x25,0x03,0xff,0x8c,0x00,
-0x15,0x4f,0x0a,0x00,0x01,0x6e,0x23,0x0c,0xbe,0x00,0x25,0x4e,0x90,0x28,0x00,0x13,
-0x90,0x09,0x00,0x13,0xfa,0x0a,0x00,0x32,0x4f,0xf9,0x04,0x0a,0x00,0x10,0x4f,0xf8,
-0x08,0x12,0x90,0x09,0x00,0x02,0x0a,0x00,0x00,0x09,0x00,0x01,0x0a,0x00,0x01,0x09,
-0x00,0x00,0x0a,0x00,0x10,0x1f,0x19,0x23,0x00,0xa5,0x06,0x10,0x61,0x27,0x19,0x21,
-0x00,0x0e,0xe1,0x03,0x61,0x0b,0xf4,0x00,0x00,0xef,0x10,0xff,0x00,0x31,0x40,0x00,
-0x0e,0x70,0x03,0x0f,0x13,0x00,0x27,0x00,0xee,0x00,0x14,0x10,0x0a,0x18,0x12,0xd0,
-0x4c,0x12,0x01,0x6a,0x24,0x01,0x8c,0x03,0x02,0xe2,0x03,0x0f,0x72,0x00,0x38,0x10,
-0x1e,0xed,0x08,0x00,0x65,0x01,0x10,0x51,0xdf,0x1b,0x00,0x7f,0x00,0x1f,0xf6,0x0f,
-0x01,0x18,0x01,0x09,0x00,0x00,0x0a,0x00,0x33,0xaf,0xf9,0x00,0x0a,0x00,0x14,0xf9,
-0x87,0x01,0x1e,0xe9,0x16,0x1d,0x15,0x02,0x2a,0x1d,0x25,0x0a,0xa0,0x3a,0x1b,0x04,
-0x8b,0x02,0x04,0x9b,0x07,0x01,0xd7,0x01,0x14,0x30,0x6c,0x02,0x02,0x01,0x1b,0x00,
-0x7c,0x00,0x23,0x9f,0xf4,0x59,0x24,0x21,0xf1,0x1f,0x0e,0x01,0x00,0x3a,0x22,0x11,
-0x08,0xd1,0x04,0x01,0xf1,0x22,0x21,0xef,0xd0,0x5a,0x0f,0x12,0xf6,0x04,0x00,0x02,
-0x10,0x00,0x21,0x0e,0xfe,0x3f,0x01,0x11,0x50,0x2c,0x00,0x41,0x00,0x00,0x0e,0xfd,
-0x40,0x00,0x11,0xe0,0x96,0x04,0x11,0x00,0x24,0x23,0x32,0x01,0xff,0xc0,0x68,0x00,
-0x40,0x10,0x09,0xff,0xdc,0x3c,0x1d,0x11,0xcd,0xe4,0x01,0x12,0xff,0x28,0x20,0x14,
-0xaf,0x0a,0x00,0x13,0xfa,0x09,0x1d,0x24,0xcc,0x70,0xe7,0x00,0x23,0xff,0xfc,0x2c,
-0x03,0x30,0xfb,0x46,0xef,0x88,0x11,0xf0,0x16,0x38,0xb5,0x6f,0xe0,0x00,0x5f,0xe0,
-0x00,0x00,0x2b,0xff,0xfa,0x9f,0xb0,0x00,0x3f,0xf0,0x00,0x03,0xef,0xfb,0x60,0xcf,
-0xe1,0x00,0x7f,0xd0,0x00,0x2f,0xfc,0x20,0x00,0xef,0xfe,0x89,0xff,0x50,0x9a,0x22,
-0x11,0x01,0x37,0x12,0x31,0x05,0xff,0x20,0xf5,0x1a,0x41,0x54,0x00,0x0b,0xfa,0xe2,
-0x01,0x50,0xc2,0x5f,0xa0,0x0e,0xf4,0x58,0x05,0x00,0x79,0x1c,0x20,0x0f,0xf2,0xd4,
-0x00,0xe0,0x40,0x00,0x1f,0xf0,0x0f,0xf1,0x00,0x00,0x0f,0xc1,0x00,0x00,0x1f,0xf0,
-0x1e,0x00,0x10,0x28,0xb5,0x00,0x23,0xe0,0x09,0x63,0x01,0x52,0x9f,0x90,0x04,0xff,
-0x20,0xfb,0x11,0x10,0x40,0xf4,0x22,0x00,0x09,0x01,0x50,0xfc,0x00,0x00,0x2e,0xfd,
-0x04,0x16,0x30,0xdf,0xe2,0x00,0x82,0x00,0x31,0x75,0x57,0xbf,0x18,0x25,0x10,0x1a,
-0xc6,0x00,0x11,0xa1,0x37,0x00,0x42,0x27,0xbd,0xcb,0x72,0x41,0x00,0x62,0x59,0x99,
-0x99,0x99,0x81,0x00,0x4c,0x1d,0x00,0x36,0x0c,0x01,0xdc,0x23,0x50,0xb5,0x04,0xff,
-0xff,0xfe,0xf3,0x23,0x20,0x00,0x0a,0xd7,0x1b,0x20,0xf4,0x0d,0x8c,0x01,0xf0,0x07,
-0x21,0xdf,0x60,0x0a,0xff,0x90,0x07,0xf5,0x56,0x00,0x01,0xfd,0x85,0x00,0x00,0xdd,
-0x00,0x00,0x3d,0xff,0x10,0x06,0x9f,0x02,0x10,0x23,0x44,0x23,0x42,0x10,0x00,0x4b,
-0x50,0xba,0x01,0x43,0x75,0x50,0x0d,0xed,0x02,0x1f,0x00,0xa8,0x06,0x04,0xd3,0x03,
-0x33,0xd0,0x06,0x78,0x0b,0x00,0x53,0x84,0x00,0x05,0xcf,0x40,0xe6,0x01,0x21,0xd0,
-0x09,0xc3,0x12,0x00,0xbc,0x0d,0x41,0xa0,0x03,0xa6,0x92,0x0b,0x00,0x53,0x2d,0x42,
-0x10,0x00,0x1b,0xee,0x02,0x50,0xf7,0x00,0x00,0x2f,0xfb,0x9c,0x23,0xe1,0x3c,0x5d,
-0xf3,0x00,0x00,0x06,0x73,0xff,0x66,0x32,0x65,0xef,0xc0,0x30,0x71,0x04,0x42,0x7f,
-0xf8,0xfd,0x6f,0x2f,0x26,0x53,0xc5,0x9f,0xc5,0xff,0x18,0x59,0x02,0x32,0x5b,0x81,
-0xb8,0x09,0x00,0x25,0x2a,0x20,0x74,0x02,0x61,0xef,0xe4,0x6b,0xde,0xda,0x50,0x3c,
-0x1e,0x02,0x92,0x04,0x00,0x34,0x08,0xf1,0x09,0xdf,0xd1,0xbf,0xfa,0x33,0x47,0xcf,
-0xfb,0x10,0x00,0x0c,0xfd,0x10,0x0b,0xff,0x50,0x00,0x05,0xff,0xc0,0x00,0x0e,0xfc,
-0x10,0xfd,0x05,0xb0,0x2e,0xf9,0x00,0x02,0xef,0xd1,0x00,0x09,0xff,0x40,0x00,0x62,
-0x01,0x40,0xaf,0xfd,0x10,0x05,0x44,0x02,0x80,0xaf,0x90,0x00,0xff,0xef,0xd2,0x4f,
-0xfa,0xb5,0x02,0x40,0xe0,0x03,0xfe,0x1d,0x6b,0x18,0x00,0x1d,0x28,0x51,0x04,0xfc,
-0x01,0xdf,0xfb,0x0c,0x02,0x62,0xf3,0x04,0xfd,0x00,0x1b,0xb0,0x0b,0x00,0x24,0x02,
-0xfe,0x63,0x05,0x43,0xf1,0x00,0xef,0x20,0xec,0x02,0x32,0xd0,0x00,0x9f,0x7f,0x04,
-0x00,0x4d,0x00,0x22,0x2f,0xf2,0x4c,0x02,0x00,0x26,0x0b,0x21,0xfd,0x10,0xd4,0x05,
-0x10,0xf8,0xa0,0x02,0x11,0xe4,0xdc,0x02,0x11,0xc0,0xc6,0x26,0x42,0xc7,0x54,0x58,
-0xdf,0x17,0x03,0x10,0x7e,0xbb,0x00,0x13,0x60,0xb9,0x01,0x32,0xcd,0xc9,0x50,0x21,
-0x23,0x62,0x99,0x98,0x88,0x88,0x88,0x85,0x47,0x1d,0x00,0x74,0x07,0x00,0x1a,0x0f,
-0x80,0xee,0xee,0xef,0xf0,0x00,0x00,0xef,0xf0,0xd8,0x07,0x12,0x90,0xc4,0x03,0x00,
-0xbc,0x27,0x10,0x09,0xc9,0x01,0x10,0x06,0x52,0x13,0x10,0xfc,0xf2,0x02,0x00,0x43,
-0x24,0x10,0xfa,0x46,0x02,0x01,0x7c,0x1b,0x51,0x00,0x00,0x2c,0xfc,0x20,0x2c,0x03,
-0x31,0x04,0xef,0x80,0xdb,0x05,0x31,0xb0,0x1f,0xe3,0x69,0x01,0x40,0x6f,0xc0,0x6f,
-0xf4,0x77,0x02,0x51,0xf2,0x3f,0x70,0xdf,0xfd,0xb9,0x00,0x30,0x7f,0x23,0xf5,0x78,
-0x02,0x50,0xcf,0x50,0xad,0x09,0xd0,0xfd,0x27,0xa1,0xbf,0x50,0xb6,0x03,0x00,0xdf,
-0x30,0x00,0x00,0x8f,0x39,0x17,0x00,0x2c,0x10,0x10,0xf6,0x41,0x21,0x01,0xd3,0x0d,
-0x41,0xa5,0x47,0xef,0xe1,0x77,0x26,0x01,0xa0,0x0a,0x00,0x90,0x01,0x23,0x8c,0xdb,
-0xc6,0x00,0x03,0x1e,0x09,0x00,0x01,0x13,0x14,0xf6,0x08,0x00,0x42,0x11,0x10,0xcf,
-0xff,0xaf,0x22,0xa2,0xfa,0x66,0x65,0x55,0x55,0x44,0x44,0x9e,0xf7,0x00,0xff,0x00,
-0x06,0x08,0x00,0x01,0xe9,0x0f,0x02,0x08,0x00,0x90,0xfc,0x00,0x7e,0xe7,0x00,0x22,
-0x22,0x22,0x21,0x08,0x00,0x02,0x20,0x00,0x06,0x10,0x00,0x02,0x20,0x00,0x12,0xe8,
-0x30,0x00,0x22,0x7f,0xe8,0x20,0x00,0x05,0x08,0x00,0xa0,0xeb,0x66,0x66,0x77,0x77,
-0x77,0x77,0xbf,0xbf,0xff,0x97,0x23,0x2a,0xdd,0xda,0x88,0x00,0x01,0x44,0x28,0x35,
-0xbb,0xbb,0xb4,0xd0,0x21,0x04,0xdf,0x1f,0x60,0x5a,0xef,0xff,0xe9,0x20,0x03,0x94,
-0x02,0x01,0xa7,0x07,0x20,0x0f,0x90,0x69,0x09,0xa0,0xeb,0xab,0xef,0xc0,0x0f,0xfe,
-0x40,0x4f,0xff,0xc4,0x1b,0x08,0x52,0x0f,0x7a,0xfa,0xef,0xf9,0xfb,0x01,0x43,0x50,
-0x4e,0xff,0xb0,0x0a,0x00,0x34,0x00,0x8f,0xc3,0x0a,0x00,0x33,0x03,0xcf,0x80,0x0a,
-0x00,0x43,0x00,0x06,0xfd,0x40,0x0a,0x00,0x33,0x02,0xdf,0x50,0x0a,0x00,0x23,0x5f,
-0xc2,0x1e,0x00,0x23,0x09,0xf8,0x32,0x00,0x33,0x02,0xcf,0x40,0x0a,0x00,0x23,0x5f,
-0xff,0x0a,0x00,0x22,0x69,0xfc,0xa2,0x29,0x01,0x21,0x10,0x21,0xfe,0x30,0x0a,0x00,
-0xe2,0xd2,0x00,0x1d,0xff,0xfa,0x52,0x12,0x69,0x40,0x0a,0x00,0x00,0x01,0xbf,0x0a,
-0x20,0x11,0x00,0x16,0x2a,0x13,0xff,0xec,0x06,0x41,0x04,0x8a,0xa9,0x62,0x12,0x18,
-0x01,0xe4,0x09,0xa1,0x5f,0x55,0xff,0xfb,0x55,0x55,0x55,0x55,0xf5,0x5f,0xbc,0x24,
-0xd0,0x01,0x12,0xe5,0x5f,0x00,0xcf,0xf7,0x00,0x04,0xdf,0xff,0xf5,0x5f,0xaa,0x01,
-0x20,0xbf,0xff,0x09,0x00,0x31,0x47,0x73,0x2d,0xd6,0x27,0x00,0xa0,0x13,0x11,0x6e,
-0x09,0x00,0x83,0xef,0xfb,0x00,0x00,0x7c,0xcb,0xf5,0x5f,0x48,0x10,0x10,0xe5,0x2d,
-0x00,0x0c,0x09,0x00,0x05,0x1b,0x00,0x23,0xef,0xfb,0x09,0x00,0x23,0xdf,0xfa,0x09,
-0x00,0x23,0x58,0x83,0x09,0x00,0x24,0x13,0x31,0x2d,0x00,0x05,0x24,0x00,0x14,0xfc,
-0x12,0x00,0x03,0x09,0x00,0x03,0xab,0x00,0x32,0xf5,0x05,0x55,0x01,0x00,0x01,0xc0,
-0x0a,0x42,0x9c,0xee,0xc9,0x40,0xcf,0x00,0x10,0xdf,0x1b,0x07,0x12,0x40,0x60,0x02,
-0x51,0xaf,0x6b,0xd7,0xef,0xf8,0x74,0x02,0x71,0xa1,0x0f,0x6a,0xc0,0x08,0xff,0x80,
-0xff,0x09,0xa1,0x0f,0x6a,0xc0,0x00,0x6f,0xf5,0x00,0x00,0xdf,0x90,0x0b,0x00,0xe0,
-0x08,0xfd,0x00,0x05,0xfe,0x00,0x00,0x1f,0x6a,0xc0,0x00,0x00,0xef,0x50,0xd7,0x2b,
-0x20,0x1f,0xbd,0x16,0x1d,0x33,0xa0,0x0e,0xf3,0x7d,0x25,0x41,0x2f,0xe0,0x0f,0xf1,
-0x76,0x07,0x30,0x50,0x00,0x0f,0x7f,0x05,0xf0,0x1d,0x09,0xf6,0x00,0x6f,0xfa,0x10,
-0x0f,0xf0,0x0e,0xf2,0x00,0xbf,0xcf,0x41,0xfb,0x6f,0xe5,0x1f,0xe0,0x0b,0xf6,0x2d,
-0xf5,0x4f,0xa1,0xdf,0x72,0xbf,0xcf,0xb0,0x06,0xfd,0xee,0x36,0xfb,0x00,0x08,0xfc,
-0x26,0xff,0x60,0x00,0xef,0xd2,0xdd,0x03,0x81,0x3c,0xf9,0xfe,0x00,0x00,0x6f,0xeb,
-0xf6,0xa2,0x05,0x10,0xf6,0x46,0x05,0x11,0x80,0x9c,0x1a,0x01,0xb4,0x1c,0x63,0xfa,
-0x40,0x00,0x04,0xaf,0xfa,0xd5,0x07,0x11,0xee,0xbf,0x0c,0x00,0x40,0x1a,0x44,0xcf,
-0xff,0xfc,0x71,0x6a,0x02,0x13,0x22,0x62,0x06,0x34,0xac,0xb7,0x10,0x53,0x1a,0x03,
-0x9a,0x09,0x42,0x09,0xfe,0x62,0x39,0xf1,0x05,0x23,0x2f,0xf2,0xc8,0x29,0x31,0x00,
-0x7f,0x80,0xb9,0x2b,0xf0,0x00,0x46,0x40,0x00,0x9f,0x40,0x00,0x00,0x0c,0xf3,0x3d,
-0xff,0xfd,0x20,0x8f,0x50,0x6e,0x2c,0x40,0xef,0xff,0xff,0xe1,0x9b,0x2c,0x20,0x3f,
-0xe9,0x71,0x06,0x80,0x0e,0xf9,0x00,0x02,0xdf,0x7c,0xff,0xff,0xb6,0x19,0x41,0xea,
-0xbf,0xfb,0x0b,0x22,0x1b,0x51,0x2b,0xff,0xff,0xfb,0x47,0x37,0x04,0x50,0x2d,0xff,
-0xed,0xff,0xfe,0xf1,0x10,0x32,0x02,0xef,0xa2,0x6f,0x1f,0x33,0x00,0x0b,0xf8,0x3f,
-0x26,0x52,0x40,0x2f,0xd0,0x02,0xef,0x02,0x28,0x32,0x7f,0x60,0x0b,0x90,0x01,0x42,
+0x20,0x09,0xff,0xf1,0xcf,0xfa,0xc2,0x01,0x0f,0x06,0x00,0x1c,0x30,0x00,0x02,0x9d,
+0x73,0x03,0x10,0x05,0xb1,0x0b,0xf0,0x08,0x00,0x02,0xff,0xff,0xde,0xff,0xfb,0x00,
+0xaf,0xfe,0x20,0x08,0xff,0xf3,0x0f,0xff,0x70,0x00,0x0e,0xff,0x82,0xff,0xf3,0x6e,
+0x01,0x00,0x39,0x04,0x50,0x09,0xff,0xc2,0xff,0xf4,0x8e,0x04,0x02,0x1a,0x00,0x12,
+0x80,0x27,0x00,0x03,0x34,0x00,0x11,0x05,0xf2,0x0b,0x03,0x4e,0x00,0x30,0xbf,0xf7,
+0x6d,0xbe,0x01,0x12,0xff,0xd9,0x04,0xac,0xd9,0xaf,0xff,0xd0,0xbf,0xfd,0x00,0x06,
+0xff,0xf4,0xd9,0x04,0x11,0xbf,0xd9,0x04,0x11,0xcf,0x0c,0x00,0x30,0xff,0xf8,0xbf,
+0x50,0x00,0x21,0xf4,0xbf,0xd3,0x00,0x03,0x3c,0x00,0x02,0x21,0x05,0x0f,0x45,0x05,
+0x0a,0xe0,0x00,0x07,0xdf,0xe9,0x1d,0xff,0x30,0x0a,0xff,0xff,0xfd,0xff,0xf3,0x05,
+0xc8,0x04,0x33,0xff,0x30,0xcf,0xc1,0x00,0x70,0x60,0x00,0x3f,0xff,0x32,0xff,0xf3,
+0x75,0x04,0x00,0xc1,0x00,0x05,0x0d,0x00,0x00,0xc1,0x00,0x11,0x3f,0x27,0x00,0x14,
+0x09,0x34,0x00,0x00,0x41,0x00,0x00,0xdf,0x0d,0x4e,0x06,0xdf,0xe9,0x4f,0xf7,0x04,
+0x0e,0x0d,0x00,0x00,0x4b,0x09,0xe2,0x6d,0xf7,0xbf,0xfe,0xff,0xf7,0xbf,0xff,0xff,
+0xf6,0xbf,0xff,0x82,0x11,0xd1,0x00,0x0f,0x04,0x00,0x0b,0x80,0x00,0x07,0xcf,0xfe,
+0xa2,0x00,0x01,0xdf,0xbc,0x01,0x70,0x09,0xff,0xe8,0x7d,0xff,0xf1,0x0e,0x43,0x0e,
+0xb2,0xf5,0x0d,0xff,0xb1,0x00,0x01,0x10,0x07,0xff,0xff,0xc8,0x7d,0x0d,0xa0,0xfd,
+0x20,0x00,0x01,0x6a,0xef,0xff,0xe1,0x14,0x43,0xf9,0x09,0x10,0x3f,0x02,0x02,0x90,
+0xf6,0x0d,0xff,0xe8,0x7b,0xff,0xf2,0x02,0xef,0xc6,0x02,0x00,0x48,0x00,0x55,0xa3,
+0x00,0x00,0xff,0xf5,0x04,0x00,0x40,0xef,0xff,0xff,0xf8,0x04,0x00,0x48,0x78,0xff,
+0xfa,0x84,0x18,0x00,0x0a,0x04,0x00,0x10,0xf7,0x57,0x09,0x9f,0xd8,0x00,0x7f,0xff,
+0xfa,0x00,0x07,0xdf,0xe8,0x18,0x04,0x1d,0x02,0x32,0x02,0xa0,0xaf,0xfe,0x10,0x09,
+0xff,0xf2,0x6f,0xff,0xec,0xef,0x81,0x0d,0xa0,0xff,0xff,0xff,0xf2,0x01,0xae,0xfe,
+0x92,0xff,0xf2,0xf0,0x98,0xaf,0xfd,0x00,0x00,0xbf,0xfc,0x5f,0xff,0x10,0x00,0xff,
+0xf7,0x0f,0xff,0x50,0x04,0xff,0xf1,0x0b,0xff,0xa0,0x08,0xff,0xc0,0x05,0xff,0xe0,
+0x0d,0xff,0x70,0x00,0xff,0xf3,0x1f,0xff,0x20,0x00,0xbf,0xf7,0x6f,0xfc,0x00,0x00,
+0x6f,0xfb,0xaf,0xf7,0x00,0x00,0x1f,0xff,0xef,0xf2,0x00,0x00,0x0b,0xff,0xff,0xd0,
+0x00,0x00,0x06,0xff,0xff,0x70,0x00,0x00,0x01,0xff,0xff,0x20,0x00,0x00,0x00,0xbf,
+0xfd,0x00,0x00,0x8f,0xfb,0x00,0x09,0xff,0x20,0x01,0xff,0xf2,0x4f,0xfe,0x00,0x0d,
+0xff,0x70,0x04,0xff,0xe0,0x0f,0xff,0x10,0x2f,0xff,0xb0,0x08,0xff,0xa0,0x0c,0xff,
+0x40,0x6f,0xff,0xf0,0x0b,0xff,0x60,0x08,0xff,0x70,0xbf,0xff,0xf4,0x0e,0xff,0x20,
+0x04,0xff,0xb0,0xff,0xaf,0xf9,0x2f,0xfe,0x00,0x01,0xff,0xe4,0xff,0x4b,0xfd,0x5f,
+0xfa,0x00,0x00,0xcf,0xfa,0xff,0x06,0xff,0xbf,0xf6,0x00,0x00,0x8f,0xff,0xfb,0x02,
+0xff,0xff,0xf2,0x00,0x00,0x4f,0xff,0xf6,0x00,0xdf,0xff,0xe0,0x78,0x00,0xf0,0x0f,
+0xf2,0x00,0x8f,0xff,0xa0,0x00,0x00,0x0d,0xff,0xd0,0x00,0x4f,0xff,0x60,0x00,0x00,
+0x09,0xff,0x80,0x00,0x0f,0xff,0x20,0x00,0x5f,0xff,0x50,0x01,0xff,0xf9,0x80,0x00,
+0xd2,0x9f,0xff,0x10,0x03,0xff,0xf6,0x2f,0xff,0x70,0x00,0x09,0xff,0xeb,0x35,0x00,
+0xd0,0xff,0xf5,0x00,0x00,0x00,0x7f,0xff,0xfc,0x00,0x00,0x00,0x02,0xff,0x36,0x00,
+0xf0,0x05,0x00,0xaf,0xff,0xfe,0x00,0x00,0x00,0x3f,0xff,0xff,0xf7,0x00,0x00,0x0c,
+0xff,0xd8,0xff,0xf1,0x00,0x05,0x8f,0x00,0xb0,0x90,0x00,0xdf,0xfb,0x00,0x6f,0xff,
+0x30,0x7f,0xff,0x20,0x0a,0x00,0xf0,0x15,0xcf,0xfd,0x00,0x00,0xcf,0xfd,0x07,0xff,
+0xf2,0x00,0x1f,0xff,0x70,0x1f,0xff,0x60,0x05,0xff,0xf2,0x00,0xcf,0xfb,0x00,0xaf,
+0xfc,0x00,0x06,0xff,0xf0,0x0f,0xff,0x70,0x00,0x1f,0xff,0x54,0xa0,0x00,0x90,0xbf,
+0xf9,0x8f,0xfc,0x00,0x00,0x05,0xff,0xed,0x5c,0x00,0x41,0x0f,0xff,0xff,0xf1,0x62,
+0x00,0x20,0xfb,0x00,0x14,0x00,0x01,0x6f,0x00,0x11,0x0f,0x13,0x00,0x50,0x00,0xaf,
+0xfb,0x00,0x00,0x70,0x00,0xe0,0x50,0x00,0x00,0x00,0x04,0xff,0xf0,0x00,0x00,0x00,
+0x7d,0xff,0xf9,0x00,0xc5,0x00,0x91,0xfe,0x10,0x00,0x00,0x00,0x8f,0xea,0x20,0x00,
+0x40,0x00,0x32,0xff,0xff,0xf3,0x06,0x00,0x60,0x0b,0xcc,0xcc,0xdf,0xff,0xd0,0x58,
+0x01,0x00,0x5e,0x01,0x30,0x07,0xff,0xf6,0xb5,0x00,0x00,0x00,0x01,0xd0,0x00,0xdf,
+0xfd,0x00,0x00,0x00,0x0a,0xff,0xf3,0x00,0x00,0x00,0x5f,0x80,0x01,0x31,0x02,0xff,
+0xfb,0x5b,0x00,0x50,0xfd,0xcc,0xcc,0xc4,0x2f,0x3c,0x00,0x12,0xf6,0x06,0x00,0xc1,
+0x00,0x00,0x03,0x90,0x00,0x00,0x8f,0xf4,0x00,0x07,0xff,0xd2,0x29,0x01,0x66,0x3f,
+0xfd,0x00,0x00,0x5f,0xfb,0x04,0x00,0xf6,0x0f,0x6f,0xfa,0x00,0x00,0xaf,0xf7,0x00,
+0x3a,0xff,0xe1,0x00,0x7f,0xfe,0x20,0x00,0x7f,0xff,0x80,0x00,0x03,0xef,0xf4,0x00,
+0x00,0x7f,0xf9,0x00,0x00,0x5f,0xfa,0x28,0x00,0x60,0x4f,0xfb,0x00,0x00,0x2f,0xfe,
+0x63,0x00,0x30,0x60,0x00,0x03,0x51,0x01,0x9f,0x2c,0xf2,0x00,0x00,0x00,0x20,0xff,
+0x1f,0xf1,0x03,0x00,0x08,0xb0,0x55,0x00,0x09,0x20,0x00,0x00,0x5f,0xf7,0x00,0x00,
+0x2d,0x37,0x00,0x00,0x8e,0x01,0x00,0x39,0x02,0x26,0xcf,0xf4,0x04,0x00,0xfa,0x0b,
+0xbf,0xf5,0x00,0x00,0x8f,0xf9,0x00,0x00,0x2f,0xff,0xa2,0x00,0x03,0xef,0xf5,0x00,
+0x09,0xff,0xf5,0x00,0x5f,0xfd,0x30,0x00,0xaf,0xf6,0x28,0x00,0xf1,0x2b,0xdf,0xf3,
+0x00,0x00,0xff,0xf0,0x00,0x07,0xff,0xa0,0x00,0x6f,0xfe,0x20,0x00,0x3f,0xb1,0x00,
+0x00,0x02,0x00,0x00,0x00,0x01,0xae,0xfc,0x40,0x00,0x2a,0xa2,0x0d,0xff,0xff,0xf9,
+0x00,0x9f,0xf3,0x6f,0xff,0xdf,0xff,0xfd,0xff,0xe0,0xaf,0xf2,0x03,0xdf,0xff,0xff,
+0x50,0x79,0x70,0x00,0x08,0xef,0xd5,0x00,0x01,0x00,0x24,0x8a,0x00,0x01,0x00,0x25,
+0x0f,0xfb,0x0b,0x00,0x25,0xff,0xfb,0x15,0x00,0x10,0xfe,0x0b,0x00,0xc0,0x14,0x44,
+0x44,0x44,0x44,0xff,0x2e,0xfb,0x00,0x00,0x0e,0xff,0x01,0x00,0x10,0xf0,0x0b,0x00,
+0xc1,0xff,0xbb,0xbb,0xbb,0xbb,0xb7,0x00,0x2e,0xfb,0x00,0x0f,0xf0,0x2d,0x00,0x00,
+0x0b,0x00,0x23,0xff,0x00,0x0b,0x00,0x14,0xfa,0x15,0x00,0x34,0x00,0xbf,0xe0,0x15,
+0x00,0x40,0xaf,0xf3,0x0f,0xf4,0x4a,0x00,0x51,0x10,0x00,0xaf,0xf3,0x00,0x49,0x00,
+0x10,0xfe,0x0a,0x00,0x10,0x07,0x49,0x00,0x44,0xbf,0xf0,0x9f,0xf3,0x7e,0x00,0x05,
+0x0a,0x00,0x35,0x0f,0xff,0xf4,0x93,0x00,0x05,0x0a,0x00,0x25,0x0e,0xf4,0xa8,0x00,
+0x15,0x11,0x0a,0x00,0x14,0xa8,0x09,0x00,0x24,0x0c,0xff,0x0a,0x00,0x14,0xcf,0x0a,
+0x00,0x34,0x0b,0xfe,0xff,0x8b,0x00,0x20,0xe2,0xff,0x80,0x00,0x53,0x41,0x00,0x0b,
+0xfe,0x20,0x80,0x00,0x40,0xbf,0xe2,0x00,0x7b,0x80,0x00,0x43,0xff,0x0b,0xfe,0x20,
+0x6a,0x00,0x24,0xaf,0xe2,0x74,0x00,0x24,0xef,0xb0,0x0a,0x00,0x24,0x3f,0xfa,0x0a,
+0x00,0x51,0x03,0xff,0xa0,0x00,0x24,0x10,0x01,0x51,0x00,0x3f,0xfa,0x00,0xef,0x47,
+0x00,0x43,0x00,0x03,0xff,0xa0,0x0f,0x01,0x34,0x00,0x3f,0xf9,0x6e,0x00,0x25,0x03,
+0xff,0x8c,0x00,0x15,0x4f,0x0a,0x00,0x3e,0x04,0xfe,0x00,0xbe,0x00,0x25,0x4e,0x90,
+0x28,0x00,0x13,0x90,0x09,0x00,0x13,0xfa,0x0a,0x00,0x52,0x4f,0xf9,0x04,0xff,0x90,
+0x09,0x00,0x11,0x00,0x0a,0x00,0x00,0x09,0x00,0x02,0x0a,0x00,0x00,0x09,0x00,0x01,
+0x0a,0x00,0x01,0x09,0x00,0x00,0x0a,0x00,0x40,0x1f,0xff,0xff,0xe1,0x14,0x03,0x81,
+0xff,0x61,0xef,0xff,0xff,0x40,0x00,0x0e,0xe1,0x03,0x61,0x0b,0xf4,0x00,0x00,0xef,
+0x10,0xff,0x00,0x31,0x40,0x00,0x0e,0x70,0x03,0x0f,0x13,0x00,0x27,0x00,0xee,0x00,
+0x21,0x10,0x00,0x36,0x04,0x01,0xe5,0x04,0x00,0x7d,0x03,0x32,0xff,0xff,0xfd,0x5e,
+0x01,0x12,0xff,0xe2,0x03,0x0f,0x72,0x00,0x38,0x50,0x1e,0xff,0xff,0xf4,0x00,0x65,
+0x01,0x50,0x51,0xff,0xff,0xfe,0x10,0x7f,0x00,0x1f,0xf6,0x0f,0x01,0x18,0x01,0x09,
+0x00,0x00,0x0a,0x00,0x33,0xaf,0xf9,0x00,0x0a,0x00,0x14,0xf9,0x87,0x01,0x2d,0xe9,
+0x00,0x01,0x00,0x24,0x02,0x20,0x0a,0x00,0x24,0x0a,0xa0,0x0a,0x00,0x34,0x3f,0xf3,
+0x00,0x3c,0x02,0x16,0xfb,0xd7,0x01,0x14,0x30,0x6c,0x02,0x33,0xff,0xc0,0x00,0xa6,
+0x01,0x13,0x9f,0x96,0x02,0x32,0xdf,0xf1,0x1f,0x0e,0x01,0x41,0x05,0xff,0x70,0x08,
+0xd1,0x04,0x61,0x00,0x0d,0xfe,0x00,0x00,0xef,0x2c,0x01,0x22,0x6f,0xf6,0x04,0x00,
+0x02,0x10,0x00,0x21,0x0e,0xfe,0x3f,0x01,0x11,0x50,0x2c,0x00,0x41,0x00,0x00,0x0e,
+0xfd,0x40,0x00,0x11,0xe0,0x96,0x04,0x00,0x54,0x00,0x52,0xf8,0x00,0x01,0xff,0xc0,
+0x68,0x00,0x91,0x10,0x09,0xff,0xdc,0xcc,0xcc,0xcc,0xcc,0xcd,0xe4,0x01,0x02,0x01,
+0x00,0x24,0xf1,0xaf,0x0a,0x00,0x03,0x9c,0x02,0x34,0x29,0xcc,0x70,0xe7,0x00,0x23,
+0xff,0xfc,0x2c,0x03,0xf0,0x20,0xfb,0x46,0xef,0x80,0x00,0x00,0x00,0x38,0xb5,0x6f,
+0xe0,0x00,0x5f,0xe0,0x00,0x00,0x2b,0xff,0xfa,0x9f,0xb0,0x00,0x3f,0xf0,0x00,0x03,
+0xef,0xfb,0x60,0xcf,0xe1,0x00,0x7f,0xd0,0x00,0x2f,0xfc,0x20,0x00,0xef,0xfe,0x89,
+0xff,0x50,0x00,0xcf,0xc0,0xaf,0x06,0x60,0xff,0xf8,0x00,0x05,0xff,0x20,0x45,0x00,
+0x51,0xff,0x54,0x00,0x0b,0xfa,0xe2,0x01,0x50,0xc2,0x5f,0xa0,0x0e,0xf4,0x58,0x05,
+0x60,0xf8,0x00,0x4f,0xe0,0x0f,0xf2,0xd4,0x00,0xe0,0x40,0x00,0x1f,0xf0,0x0f,0xf1,
+0x00,0x00,0x0f,0xc1,0x00,0x00,0x1f,0xf0,0x1e,0x00,0x10,0x28,0xb5,0x00,0x23,0xe0,
+0x09,0x63,0x01,0x30,0x9f,0x90,0x04,0xfa,0x06,0x00,0x82,0x05,0x10,0x40,0x5a,0x00,
+0x00,0x09,0x01,0xc0,0xfc,0x00,0x00,0x2e,0xfd,0x30,0x00,0x00,0x03,0xdf,0xe2,0x00,
+0x82,0x00,0x40,0x75,0x57,0xbf,0xfe,0x4c,0x01,0x10,0x1a,0xc6,0x00,0x11,0xa1,0x37,
+0x00,0x42,0x27,0xbd,0xcb,0x72,0x41,0x00,0x51,0x59,0x99,0x99,0x99,0x81,0x0b,0x00,
+0x00,0x07,0x02,0x30,0xff,0xa0,0x10,0xd6,0x04,0x80,0xb5,0x04,0xff,0xff,0xfe,0x01,
+0xec,0x10,0x8c,0x00,0x50,0x50,0x7f,0xff,0xf4,0x0d,0x8c,0x01,0xf0,0x07,0x21,0xdf,
+0x60,0x0a,0xff,0x90,0x07,0xf5,0x56,0x00,0x01,0xfd,0x85,0x00,0x00,0xdd,0x00,0x00,
+0x3d,0xff,0x10,0x06,0x9f,0x02,0x92,0x23,0x00,0x00,0x0d,0xfb,0x10,0x00,0x4b,0x50,
+0xba,0x01,0x42,0x75,0x50,0x0d,0xed,0x52,0x00,0x10,0x01,0xa8,0x06,0x04,0xd3,0x03,
+0x33,0xd0,0x06,0x78,0x0b,0x00,0x53,0x84,0x00,0x05,0xcf,0x40,0xe6,0x01,0x10,0xd0,
+0x43,0x07,0x01,0x4f,0x01,0x51,0xef,0xa0,0x03,0xa6,0x92,0x0b,0x00,0x53,0x2d,0x42,
+0x10,0x00,0x1b,0xee,0x02,0xf1,0x08,0xf7,0x00,0x00,0x2f,0xfb,0x83,0x00,0x00,0x00,
+0x3c,0x5d,0xf3,0x00,0x00,0x06,0x73,0xff,0x66,0x32,0x65,0xef,0xc0,0x30,0x71,0x04,
+0x51,0x7f,0xf8,0xfd,0x6f,0xf2,0xfd,0x00,0x53,0xc5,0x9f,0xc5,0xff,0x18,0x59,0x02,
+0x32,0x5b,0x81,0xb8,0x09,0x00,0x25,0x2a,0x20,0x74,0x02,0x51,0xef,0xe4,0x6b,0xde,
+0xda,0x9f,0x00,0x12,0x1d,0x92,0x04,0x00,0x34,0x08,0xf1,0x09,0xdf,0xd1,0xbf,0xfa,
+0x33,0x47,0xcf,0xfb,0x10,0x00,0x0c,0xfd,0x10,0x0b,0xff,0x50,0x00,0x05,0xff,0xc0,
+0x00,0x0e,0xfc,0x10,0xfd,0x05,0xb0,0x2e,0xf9,0x00,0x02,0xef,0xd1,0x00,0x09,0xff,
+0x40,0x00,0x62,0x01,0x40,0xaf,0xfd,0x10,0x05,0x44,0x02,0x80,0xaf,0x90,0x00,0xff,
+0xef,0xd2,0x4f,0xfa,0xb5,0x02,0x70,0xe0,0x03,0xfe,0x1d,0xfe,0xff,0xb0,0x42,0x05,
+0x61,0xf1,0x04,0xfc,0x01,0xdf,0xfb,0x0c,0x02,0x62,0xf3,0x04,0xfd,0x00,0x1b,0xb0,
+0x0b,0x00,0x24,0x02,0xfe,0x63,0x05,0x43,0xf1,0x00,0xef,0x20,0xec,0x02,0x32,0xd0,
+0x00,0x9f,0x7f,0x04,0x00,0x4d,0x00,0x11,0x2f,0xc0,0x00,0x01,0x63,0x00,0x31,0x09,
+0xfd,0x10,0xd4,0x05,0x10,0xf8,0xa0,0x02,0x11,0xe4,0xdc,0x02,0x00,0xd0,0x01,0x62,
+0x1b,0xff,0xc7,0x54,0x58,0xdf,0x17,0x03,0x10,0x7e,0xbb,0x00,0x13,0x60,0xb9,0x01,
+0x22,0xcd,0xc9,0x70,0x01,0x70,0x09,0x99,0x98,0x88,0x88,0x88,0x85,0x8a,0x07,0x03,
+0x74,0x07,0xb0,0xaf,0xff,0xff,0xee,0xee,0xef,0xf0,0x00,0x00,0xef,0xf0,0xd8,0x07,
+0x13,0x90,0xc4,0x03,0x40,0xef,0x30,0x00,0x09,0xc9,0x01,0x60,0x06,0xfc,0x00,0x00,
+0x0e,0xfc,0xf2,0x02,0x50,0xf6,0x00,0x00,0x0f,0xfa,0x46,0x02,0x10,0xf0,0x80,0x02,
+0x51,0x00,0x00,0x2c,0xfc,0x20,0x2c,0x03,0x31,0x04,0xef,0x80,0xdb,0x05,0x31,0xb0,
+0x1f,0xe3,0x69,0x01,0x40,0x6f,0xc0,0x6f,0xf4,0x77,0x02,0x51,0xf2,0x3f,0x70,0xdf,
+0xfd,0xb9,0x00,0x30,0x7f,0x23,0xf5,0x78,0x02,0xf0,0x08,0xcf,0x50,0xad,0x09,0xd0,
+0xdf,0x40,0x00,0x00,0xbf,0x50,0xb6,0x03,0x00,0xdf,0x30,0x00,0x00,0x8f,0xa0,0x00,
+0x00,0x02,0xf4,0x01,0x50,0x2f,0xf6,0x00,0x00,0x1c,0xa6,0x02,0x80,0x08,0xff,0xa5,
+0x47,0xef,0xe1,0x00,0x00,0x52,0x09,0x22,0xff,0xfd,0xad,0x02,0x23,0x8c,0xdb,0xc6,
+0x00,0x03,0x1e,0x09,0x21,0x00,0x2f,0xb9,0x00,0x02,0x08,0x00,0x32,0x11,0x10,0xcf,
+0x72,0x03,0xb2,0xfc,0xfa,0x66,0x65,0x55,0x55,0x44,0x44,0x9e,0xf7,0x00,0xff,0x00,
+0x05,0x08,0x00,0x00,0xad,0x04,0x13,0xfb,0x08,0x00,0x90,0xfc,0x00,0x7e,0xe7,0x00,
+0x22,0x22,0x22,0x21,0x08,0x00,0x02,0x20,0x00,0x06,0x10,0x00,0x02,0x20,0x00,0x12,
+0xe8,0x30,0x00,0x22,0x7f,0xe8,0x20,0x00,0x05,0x08,0x00,0xfa,0x01,0xeb,0x66,0x66,
+0x77,0x77,0x77,0x77,0xbf,0xbf,0xff,0xef,0xff,0xff,0xfe,0xdd,0xda,0x88,0x00,0x10,
+0x00,0x7e,0x01,0x34,0xbb,0xbb,0xb4,0x46,0x02,0x23,0x01,0x10,0x09,0x00,0x60,0x5a,
+0xef,0xff,0xe9,0x20,0x03,0x94,0x02,0x01,0xa7,0x07,0x20,0x0f,0x90,0x69,0x09,0xa0,
+0xeb,0xab,0xef,0xc0,0x0f,0xfe,0x40,0x4f,0xff,0xc4,0x1b,0x08,0x52,0x0f,0x7a,0xfa,
+0xef,0xf9,0xfb,0x01,0x43,0x50,0x4e,0xff,0xb0,0x0a,0x00,0x34,0x00,0x8f,0xc3,0x0a,
+0x00,0x33,0x03,0xcf,0x80,0x0a,0x00,0x43,0x00,0x06,0xfd,0x40,0x0a,0x00,0x33,0x02,
+0xdf,0x50,0x0a,0x00,0x23,0x5f,0xc2,0x1e,0x00,0x23,0x09,0xf8,0x32,0x00,0x33,0x02,
+0xcf,0x40,0x0a,0x00,0x23,0x5f,0xff,0x0a,0x00,0x43,0x69,0xfc,0xff,0xe1,0xc2,0x07,
+0x12,0x60,0xe3,0x03,0xf1,0x01,0x00,0x0f,0xd2,0x00,0x1d,0xff,0xfa,0x52,0x12,0x69,
+0x40,0x0a,0x00,0x00,0x01,0xbf,0xa0,0x00,0x01,0x28,0x05,0x33,0xdf,0xff,0xff,0xec,
+0x06,0x63,0x04,0x8a,0xa9,0x62,0x00,0x3e,0xd5,0x04,0xc0,0xf3,0x5f,0x55,0xff,0xfb,
+0x55,0x55,0x55,0x55,0xf5,0x5f,0x00,0xb1,0x00,0xd0,0x01,0x12,0xe5,0x5f,0x00,0xcf,
+0xf7,0x00,0x04,0xdf,0xff,0xf5,0x5f,0xaa,0x01,0x20,0xbf,0xff,0x09,0x00,0x41,0x47,
+0x73,0x2d,0xff,0x09,0x00,0x41,0xdf,0xfa,0x00,0x6e,0x09,0x00,0xa1,0xef,0xfb,0x00,
+0x00,0x7c,0xcb,0xf5,0x5f,0x00,0xcf,0xe7,0x00,0x10,0xe5,0x2d,0x00,0x0c,0x09,0x00,
+0x05,0x1b,0x00,0x23,0xef,0xfb,0x09,0x00,0x23,0xdf,0xfa,0x09,0x00,0x23,0x58,0x83,
+0x09,0x00,0x24,0x13,0x31,0x2d,0x00,0x05,0x24,0x00,0x14,0xfc,0x12,0x00,0x03,0x09,
+0x00,0x03,0xab,0x00,0x32,0xf5,0x05,0x55,0x01,0x00,0x01,0xc0,0x0a,0x42,0x9c,0xee,
+0xc9,0x40,0xcf,0x00,0x10,0xdf,0x1b,0x07,0x12,0x40,0x60,0x02,0x51,0xaf,0x6b,0xd7,
+0xef,0xf8,0x74,0x02,0x71,0xa1,0x0f,0x6a,0xc0,0x08,0xff,0x80,0xff,0x09,0xa1,0x0f,
+0x6a,0xc0,0x00,0x6f,0xf5,0x00,0x00,0xdf,0x90,0x0b,0x00,0xf0,0x0f,0x08,0xfd,0x00,
+0x05,0xfe,0x00,0x00,0x1f,0x6a,0xc0,0x00,0x00,0xef,0x50,0x0a,0xf8,0x00,0x00,0x1f,
+0xbd,0xc0,0x00,0x00,0x7f,0xa0,0x0e,0xf3,0x00,0x00,0x0d,0x26,0x01,0x41,0x2f,0xe0,
+0x0f,0xf1,0x76,0x07,0x30,0x50,0x00,0x0f,0x7f,0x05,0xf0,0x1d,0x09,0xf6,0x00,0x6f,
+0xfa,0x10,0x0f,0xf0,0x0e,0xf2,0x00,0xbf,0xcf,0x41,0xfb,0x6f,0xe5,0x1f,0xe0,0x0b,
+0xf6,0x2d,0xf5,0x4f,0xa1,0xdf,0x72,0xbf,0xcf,0xb0,0x06,0xfd,0xee,0x36,0xfb,0x00,
+0x08,0xfc,0x26,0xff,0x60,0x00,0xef,0xd2,0xdd,0x03,0x81,0x3c,0xf9,0xfe,0x00,0x00,
+0x6f,0xeb,0xf6,0xa2,0x05,0x10,0xf6,0x46,0x05,0x20,0x80,0x00,0x8b,0x05,0x10,0xa0,
+0x3c,0x03,0x63,0xfa,0x40,0x00,0x04,0xaf,0xfa,0xd5,0x07,0x32,0xee,0xff,0xff,0x4f,
+0x06,0x54,0x17,0xcf,0xff,0xfc,0x71,0x6a,0x02,0x13,0x22,0x62,0x06,0x33,0xac,0xb7,
+0x10,0x2a,0x04,0x13,0xff,0x9a,0x09,0x42,0x09,0xfe,0x62,0x39,0xf1,0x05,0x00,0x3a,
+0x04,0x21,0x8f,0xb0,0xc7,0x02,0xf0,0x14,0x80,0x00,0x00,0x0e,0xf0,0x00,0x46,0x40,
+0x00,0x9f,0x40,0x00,0x00,0x0c,0xf3,0x3d,0xff,0xfd,0x20,0x8f,0x50,0x00,0x00,0x0d,
+0xf4,0xef,0xff,0xff,0xe1,0x5f,0xc0,0x00,0x00,0x3f,0xe9,0x71,0x06,0x60,0x0e,0xf9,
+0x00,0x02,0xdf,0x7c,0x58,0x03,0x70,0x03,0xff,0xea,0xbf,0xfb,0x0b,0xff,0x14,0x03,
+0x51,0x2b,0xff,0xff,0xfb,0x47,0x37,0x04,0xe0,0x2d,0xff,0xed,0xff,0xfe,0xff,0xff,
+0xff,0xc0,0x02,0xef,0xa2,0x03,0xef,0x27,0x00,0x51,0x00,0x0b,0xf8,0x00,0x4f,0x7c,
+0x01,0x42,0x40,0x2f,0xd0,0x02,0x85,0x09,0x42,0xd0,0x7f,0x60,0x0b,0x90,0x01,0x42,
 0xf4,0xaf,0x20,0x4f,0x0a,0x00,0x43,0xf8,0xcf,0x10,0xaf,0x24,0x07,0x23,0xcf,0xdd,
-0xae,0x01,0x20,0xfb,0xaf,0x71,0x16,0x00,0x01,0x00,0x1a,0xd8,0x00,0x08,0x15,0x40,
-0xa4,0x09,0x06,0x0a,0x0b,0x15,0x9f,0x1a,0x24,0x16,0x09,0x44,0x23,0x24,0x8f,0xd1,
-0x0a,0x00,0x10,0x08,0x36,0x04,0x84,0x12,0x22,0x22,0x11,0x11,0x10,0x8f,0xe2,0x49,
-0x21,0x23,0xff,0xfe,0xb1,0x22,0x00,0x8b,0x00,0x01,0xf4,0x24,0x00,0x01,0x00,0x40,
-0xdc,0x30,0x01,0x22,0x01,0x00,0x00,0x2c,0x00,0x11,0x02,0xba,0x28,0x01,0x97,0x15,
-0x15,0x1d,0x0a,0x00,0x93,0x01,0xcf,0xfc,0xbc,0xcc,0xcd,0xdd,0xee,0xe6,0x32,0x2a,
-0x03,0x60,0x01,0x15,0xc0,0x95,0x08,0x16,0xfc,0x96,0x00,0x15,0xc1,0x81,0x00,0x06,
-0x96,0x00,0x25,0x7e,0x20,0x0f,0x04,0x04,0x09,0x00,0x33,0xcc,0xa7,0x30,0x0a,0x00,
-0x54,0x9a,0xdf,0xfe,0x91,0x00,0x25,0x04,0x12,0xff,0x0b,0x00,0x51,0xcb,0x96,0x10,
-0x18,0xfe,0xf5,0x00,0x62,0x9b,0xdf,0xfb,0x30,0x2c,0xf5,0x91,0x06,0x31,0x7d,0xfb,
-0x10,0xbe,0x05,0x53,0x98,0x40,0x00,0x6e,0xe1,0x49,0x0b,0x23,0x91,0x01,0x48,0x00,
-0x31,0x38,0xef,0x50,0x21,0x01,0x41,0x8b,0xbb,0x94,0x06,0xbd,0x03,0x51,0xef,0x71,
-0x03,0x9f,0xc3,0x93,0x00,0x10,0xf3,0x2c,0x06,0x10,0x50,0xb4,0x0d,0x31,0x70,0x05,
-0x95,0xc3,0x08,0x80,0x4f,0xff,0x10,0x7f,0xff,0x60,0x2f,0xfe,0x25,0x02,0x01,0xb3,
-0x05,0x20,0xff,0x30,0x14,0x00,0x51,0xaf,0xff,0x80,0x2f,0xfe,0x28,0x00,0x50,0x1a,
-0xda,0x00,0x8f,0xf5,0x4b,0x07,0x10,0xf2,0x70,0x07,0x11,0x80,0xf1,0x0d,0x32,0x71,
-0x01,0x7f,0x4c,0x05,0x21,0x28,0xdf,0xf0,0x1b,0x07,0x01,0x00,0x22,0x8f,0xff,0x3d,
-0x14,0x14,0xdf,0x42,0x1d,0xe1,0x31,0x11,0x11,0x44,0xef,0xa0,0x00,0xdf,0x20,0x00,
-0x00,0xf6,0x3f,0xfa,0x08,0x00,0x00,0x1f,0x0a,0x00,0x08,0x00,0x40,0xfa,0x66,0x9f,
-0xf2,0x08,0x00,0x61,0xff,0xff,0x8c,0xf3,0xdf,0x20,0x45,0x09,0x0f,0x08,0x00,0x3f,
-0x20,0xee,0xee,0x0f,0x19,0x13,0xf3,0x62,0x02,0x17,0xe1,0xab,0x00,0x34,0x05,0x76,
-0x30,0x0a,0x00,0x43,0xef,0xef,0xfd,0x20,0x7b,0x25,0x42,0x91,0x00,0x3c,0xf2,0xa1,
-0x01,0x00,0x0a,0x04,0x30,0xcd,0xce,0xb4,0xc1,0x01,0x01,0x9d,0x26,0x71,0xa8,0xdf,
-0x60,0x00,0x00,0x0c,0xa0,0xbc,0x01,0x10,0x08,0xec,0x03,0x03,0x88,0x07,0x41,0xda,
-0x00,0x00,0x3f,0x8c,0x0a,0x60,0x45,0x00,0x7e,0x00,0x00,0xec,0xb2,0x1d,0xf0,0x12,
-0xcf,0xfe,0x00,0x6f,0x00,0x07,0xf2,0x00,0x48,0xcf,0xff,0xff,0xd9,0x00,0x8e,0x00,
-0x0d,0xa0,0x0e,0xff,0xff,0xd9,0x51,0x00,0x00,0xdb,0x00,0x1f,0x40,0x0a,0xc8,0x41,
-0x75,0x51,0x01,0x70,0x30,0x2f,0x20,0x00,0x00,0x02,0xfe,0x43,0x2c,0x33,0xb0,0x2f,
-0x30,0x4b,0x28,0x21,0x06,0xf1,0xc0,0x05,0x00,0xb0,0x03,0x50,0x03,0xf2,0x0b,0xb0,
-0x00,0x76,0x1d,0x00,0x0b,0x00,0x41,0x04,0xf4,0x00,0x01,0x96,0x0d,0x53,0x06,0xf0,
-0x00,0xaf,0x30,0x39,0x0a,0x41,0xa0,0x00,0x1b,0xf9,0xb8,0x00,0x32,0x13,0xce,0x10,
-0xdf,0x07,0x00,0xe9,0x1d,0x00,0x11,0x00,0x10,0x35,0xfb,0x06,0x14,0x52,0xea,0x00,
-0x25,0x4c,0xc1,0x5a,0x26,0x16,0xf2,0x0a,0x00,0x24,0x04,0x95,0x0a,0x00,0x24,0x0a,
-0xf7,0x0a,0x00,0x10,0x0f,0x20,0x00,0x10,0x10,0xd4,0x0f,0x20,0x56,0xb0,0xdd,0x16,
-0xf0,0x09,0x91,0x8f,0xfb,0xdf,0xf2,0x10,0x00,0x0c,0xff,0xdf,0xf1,0xff,0x40,0x0a,
-0xf9,0x00,0x00,0x6f,0xd2,0x01,0x82,0xff,0x00,0x05,0xda,0x01,0x10,0x30,0xb4,0x30,
-0x51,0x09,0xf9,0x00,0x03,0xfc,0x0a,0x2a,0x52,0xcf,0xf3,0x00,0x08,0xf7,0x70,0x2f,
-0x32,0x60,0x00,0x0b,0x43,0x1a,0x14,0xf2,0x1a,0x30,0x00,0x78,0x00,0x24,0x1f,0xc0,
-0x0a,0x00,0x24,0x3f,0xa0,0x0a,0x00,0x24,0x5f,0x80,0x0a,0x00,0x24,0x7f,0x60,0x0a,
-0x00,0x24,0x8f,0x50,0x0a,0x00,0x2a,0x9f,0x40,0xb4,0x00,0x01,0x01,0x00,0xf0,0x08,
-0x7b,0x91,0x00,0xbf,0xff,0xe1,0x4f,0xa0,0x6f,0x97,0xf3,0x00,0xfc,0x5f,0x70,0x2f,
-0xa0,0xdf,0xcf,0xf3,0x02,0xbf,0xd4,0x40,0x03,0x14,0xa7,0xfd,0x0b,0x13,0xf3,0xd8,
-0x01,0x02,0xfe,0x0c,0x11,0x00,0x43,0x2f,0x09,0x01,0x00,0x13,0x0c,0x1a,0x00,0x23,
-0x02,0xff,0x0e,0x07,0x13,0x8f,0xa1,0x0b,0x12,0x0d,0xf2,0x06,0x00,0x07,0x23,0x02,
-0x91,0x2a,0x42,0x9f,0xfb,0x9f,0xfc,0x25,0x07,0x11,0x64,0x91,0x1a,0x10,0x05,0x3c,
-0x13,0x12,0x80,0x6c,0x0c,0x22,0x9f,0xfd,0x69,0x1a,0x10,0x04,0xaf,0x01,0x11,0x07,
-0x27,0x15,0x04,0xfb,0x02,0x12,0xff,0x45,0x20,0x00,0x1a,0x05,0x10,0x09,0xbf,0x1e,
-0x10,0xef,0x2c,0x1d,0x11,0xfc,0x31,0x18,0x10,0x20,0x0c,0x21,0x00,0x21,0x1c,0x11,
-0x0b,0x6b,0x00,0x12,0x0d,0x8d,0x1d,0x46,0x4a,0xaa,0x20,0x00,0x34,0x2b,0x00,0x66,
-0x03,0x13,0x90,0xcd,0x00,0x1f,0xa0,0xbb,0x00,0x8c,0x23,0x6f,0xf9,0x10,0x09,0x03,
-0xb9,0x0d,0x41,0x7f,0xf6,0x3e,0xf9,0x0e,0x2f,0x4f,0x84,0x00,0x28,0x82,0xbb,0x00,
-0x8a,0x52,0x2c,0xfb,0x40,0xaf,0x60,0x7f,0x00,0x01,0x66,0x00,0x51,0x03,0xfd,0x35,
-0xcf,0xf6,0xa1,0x00,0x3f,0x10,0x00,0x10,0x76,0x01,0x8a,0x60,0x01,0xcf,0x60,0x03,
-0xed,0x30,0x40,0x13,0x40,0xfd,0x00,0x9f,0xf8,0x93,0x04,0x4a,0xce,0x60,0x03,0xed,
-0x46,0x2c,0x0f,0x25,0x2a,0x7a,0x00,0x06,0x00,0x23,0x5d,0xe8,0xc4,0x0c,0x22,0x64,
-0xe6,0x96,0x03,0x13,0xe0,0xc4,0x0f,0x33,0x4f,0x31,0xd8,0x3e,0x06,0x1b,0xfb,0x1e,
-0x07,0x0f,0xc4,0x00,0x7e,0x01,0xb9,0x2f,0x03,0x67,0x34,0x14,0x9f,0x0b,0x00,0x00,
-0x16,0x02,0x00,0xfc,0x0f,0x13,0xc1,0x6f,0x34,0x04,0xac,0x0d,0x24,0xff,0x8f,0x86,
-0x10,0x21,0xbf,0xfc,0x93,0x21,0x01,0xac,0x0d,0x12,0xf4,0xe8,0x30,0x01,0xf2,0x29,
-0x12,0x0f,0x2c,0x34,0x00,0xd4,0x30,0x03,0x0b,0x00,0x00,0xee,0x0a,0x10,0x0f,0x4d,
-0x00,0x00,0x44,0x27,0x00,0xb2,0x23,0x14,0x70,0x5d,0x0f,0x03,0xec,0x09,0x02,0x1f,
-0x23,0x11,0x80,0x20,0x0f,0x10,0xfb,0x99,0x02,0x14,0x90,0xe7,0x30,0x61,0x0c,0xff,
-0xec,0xcc,0xcc,0xca,0x3a,0x2d,0x11,0x0b,0xa1,0x1f,0x10,0xbf,0x50,0x00,0x12,0x0a,
-0x67,0x36,0x0f,0x2d,0x2b,0x5e,0x41,0x9e,0xff,0xfa,0x40,0xff,0x02,0x11,0xa1,0x38,
-0x03,0x22,0x7f,0xfc,0x3f,0x01,0x12,0xfe,0x46,0x03,0x11,0xf9,0x07,0x00,0x01,0xcf,
-0x32,0x22,0x6a,0xaa,0x61,0x03,0x01,0xd3,0x00,0x21,0xdf,0xf3,0xc6,0x0e,0x05,0x47,
-0x09,0x0f,0xf7,0x2a,0x53,0x00,0xdf,0x10,0x21,0xaa,0x50,0x23,0x23,0x01,0xcb,0x03,
-0x11,0xd1,0x12,0x12,0x1f,0x10,0x84,0x00,0x5c,0x30,0x2e,0xfd,0x10,0x13,0x26,0x00,
-0x7e,0x00,0xbf,0x3f,0xfa,0x1c,0xfd,0x10,0x00,0x78,0x70,0x00,0x78,0x50,0x84,0x00,
-0x59,0x00,0x80,0x0f,0x80,0xcf,0x60,0x00,0xff,0xf2,0x04,0xff,0xd0,0x0c,0x00,0x2f,
-0xbe,0x60,0x7e,0x00,0x59,0x30,0x5a,0xaa,0x10,0xf5,0x0d,0x00,0x04,0x02,0x33,0x01,
-0xef,0xd0,0x2d,0x03,0x00,0xb5,0x03,0x0f,0x07,0x00,0x22,0x60,0x0a,0xaa,0x50,0x09,
-0xff,0xc0,0xcc,0x01,0x2f,0xcf,0xe2,0x4c,0x00,0x2d,0xf4,0x04,0x00,0x2d,0xfd,0x10,
-0x00,0x2e,0xff,0xfd,0x10,0x3e,0xfb,0x1b,0xfd,0x16,0x87,0x00,0x07,0x85,0x00,0x53,
-0x00,0x01,0x55,0x04,0x0f,0x09,0x00,0x30,0x90,0x7f,0xb0,0x00,0xbf,0x7e,0xff,0x30,
-0x3f,0xfe,0x09,0x00,0x13,0x70,0x69,0x16,0x1f,0x40,0x63,0x00,0x36,0x00,0x93,0x10,
-0x24,0xfe,0xa4,0x2c,0x24,0x10,0xb1,0x08,0x00,0x10,0xee,0x5b,0x0a,0x00,0x78,0x33,
-0x10,0x01,0x96,0x1a,0x00,0x80,0x33,0x30,0x08,0xff,0xf2,0x08,0x00,0x00,0x59,0x29,
-0x02,0x90,0x33,0x00,0x23,0x20,0x00,0x24,0x05,0x23,0xaf,0xfd,0x08,0x00,0x50,0xfe,
-0x02,0x4f,0xff,0x72,0xd0,0x12,0x04,0x20,0x00,0x09,0x30,0x00,0x03,0x40,0x00,0x03,
-0x50,0x00,0x57,0xed,0xef,0xff,0xfd,0x10,0x70,0x00,0x40,0xff,0xfe,0xa5,0x00,0x62,
-0x04,0x33,0xd7,0x14,0xfd,0x29,0x02,0x10,0x80,0x45,0x12,0x32,0x39,0xff,0xb0,0xb4,
-0x0e,0x06,0x72,0x07,0x33,0x07,0xff,0xf5,0x00,0x2b,0x13,0xe0,0x00,0x2b,0x13,0x90,
-0x00,0x2b,0x12,0x30,0x0f,0x00,0x13,0xfc,0x0f,0x00,0x11,0xf6,0x0f,0x00,0x31,0xf9,
-0xff,0xe1,0x0f,0x00,0x31,0x1e,0xff,0xa0,0x00,0x2b,0x31,0x4f,0xff,0x31,0xd3,0x2a,
-0x30,0xbf,0xfd,0x2f,0x0f,0x00,0x31,0x02,0xff,0xf9,0x0f,0x00,0x22,0x07,0xff,0xf1,
-0x2a,0x13,0x0d,0x00,0x2b,0x13,0x4f,0x00,0x2b,0x12,0xaf,0x0f,0x00,0x22,0x01,0xef,
-0x0f,0x00,0x11,0x06,0x82,0x07,0x12,0xe0,0x96,0x18,0x03,0x85,0x09,0x13,0x0c,0xc8,
-0x05,0x38,0x1a,0xa7,0x00,0x31,0x48,0x02,0x35,0x2a,0x12,0x3e,0xde,0x15,0x03,0x34,
-0x2a,0x50,0x0d,0xff,0xf6,0x00,0x2b,0x02,0x17,0x02,0xf3,0x29,0x21,0xaf,0xfe,0xad,
-0x25,0x31,0x3d,0xff,0xb0,0x08,0x28,0x12,0xef,0x25,0x2b,0x12,0x7f,0x25,0x2b,0x13,
-0xf8,0x0f,0x00,0x13,0x7d,0x1e,0x00,0x03,0x2d,0x00,0x12,0x35,0x3c,0x00,0x10,0xe0,
-0x4b,0x00,0x32,0x1b,0xff,0xf6,0x2e,0x2a,0x15,0xfb,0x69,0x00,0x00,0x78,0x00,0x13,
-0xa4,0xe0,0x0a,0x21,0xf3,0x00,0xb8,0x25,0x12,0xf5,0x87,0x0e,0x1f,0xf6,0xa5,0x00,
-0x80,0x33,0x04,0xff,0xb0,0xef,0x16,0x11,0xb0,0xb2,0x00,0x20,0x81,0xdf,0x08,0x00,
-0x5f,0x78,0x50,0x01,0x78,0x40,0xa5,0x00,0x76,0x52,0x01,0xbf,0xc5,0x08,0xf9,0x1d,
-0x19,0x00,0x1e,0x0f,0x31,0x0f,0xf3,0x4b,0x8d,0x06,0x3f,0x21,0x00,0x01,0x4a,0x01,
-0x78,0x50,0x0a,0xf8,0x00,0x2d,0xe4,0x38,0x00,0x10,0xf0,0x47,0x29,0x04,0x0f,0x00,
-0x05,0x01,0x00,0x0f,0xb9,0x2d,0x6b,0xf0,0x0b,0x00,0x71,0x00,0x00,0x05,0x30,0x08,
-0xfd,0x10,0x00,0x5f,0xf3,0x0d,0xff,0xd1,0x05,0xff,0xf9,0x01,0xdf,0xfd,0x6f,0xff,
-0xa0,0x00,0x2e,0xc4,0x00,0x00,0x14,0x3b,0x11,0xa0,0x04,0x02,0x11,0xc0,0x39,0x01,
-0x10,0xfc,0x49,0x29,0x40,0x3e,0xff,0xc0,0x0e,0xdd,0x36,0x70,0xfa,0x05,0xfc,0x00,
-0x00,0x3f,0xd1,0xda,0x11,0x22,0x03,0x10,0xd7,0x02,0x12,0xfd,0xf5,0x00,0x42,0xcf,
-0x50,0x00,0x2d,0x37,0x3a,0x12,0x2f,0xf9,0x33,0xa0,0x0c,0xff,0xf7,0x00,0x2c,0xff,
-0xf7,0x03,0xff,0xf7,0x04,0x19,0x10,0xe0,0x5c,0x2b,0x91,0xbf,0xcf,0xff,0x4b,0xff,
-0xc0,0x00,0x5f,0xd1,0xb9,0x00,0xf0,0x17,0x0e,0xf3,0x0f,0xff,0x9e,0xff,0xa0,0x09,
-0xf9,0x00,0xef,0xf9,0xdf,0xfb,0x03,0xfe,0x10,0x0f,0xff,0x9c,0xff,0xc0,0xcf,0x50,
-0x00,0xff,0xf7,0x8f,0xff,0x8f,0xc0,0x00,0x4f,0xff,0x43,0xff,0xff,0xf2,0x67,0x34,
-0x70,0x0c,0xff,0xfb,0x00,0x1a,0xff,0xf8,0x59,0x09,0x10,0xef,0x67,0x0b,0x11,0xdf,
-0x90,0x39,0x40,0x00,0x6f,0xb6,0xbe,0x6d,0x01,0x24,0x1e,0xf3,0x23,0x1d,0x28,0xff,
-0x80,0x52,0x0e,0x22,0x4f,0xfc,0xa1,0x00,0x14,0xaa,0x3a,0x10,0x0f,0x2e,0x2c,0x66,
-0x05,0x45,0x39,0x32,0x00,0x6f,0xfd,0x51,0x3d,0x11,0xe1,0xa4,0x02,0x2f,0xaa,0x20,
-0x9a,0x00,0x6f,0x12,0x0a,0x53,0x1b,0x12,0xaf,0xb0,0x29,0x20,0xfe,0x36,0x0f,0x00,
-0x5f,0x38,0x82,0x00,0x48,0x71,0x9a,0x00,0x6d,0x20,0x3e,0xe3,0xe7,0x37,0x00,0x02,
-0x40,0x00,0x53,0x38,0x5f,0x3e,0xd3,0x00,0x6e,0xc0,0xc7,0x01,0x6f,0x42,0x01,0xaa,
-0xa5,0x00,0x9e,0x2d,0x02,0x35,0x0c,0x02,0xc8,0x19,0x06,0x7e,0x0a,0x01,0x53,0x2c,
-0x00,0x3d,0x03,0x20,0xf8,0x3f,0x8d,0x02,0x10,0xbf,0x9d,0x13,0x10,0x10,0x97,0x0c,
-0x70,0x02,0xff,0xf7,0x00,0x0a,0xff,0xe0,0x04,0x00,0x00,0x0b,0x00,0x00,0x7a,0x07,
-0x01,0xf4,0x33,0x32,0x9f,0xfd,0x1f,0xd5,0x22,0x11,0xfc,0xc6,0x06,0x13,0x09,0x8c,
-0x18,0x33,0x1f,0xff,0xfd,0xb9,0x0e,0x1f,0x60,0x58,0x2c,0x15,0x03,0x0f,0x00,0x02,
-0xb0,0x09,0x01,0xb4,0x33,0x06,0x0d,0x00,0x42,0xff,0xff,0xec,0x71,0xee,0x09,0x82,
-0xe3,0x07,0xff,0xfb,0xbb,0xdf,0xff,0xe1,0xf2,0x37,0x11,0x77,0xdb,0x33,0x12,0xfb,
-0x89,0x30,0x30,0xd7,0xff,0xf0,0x25,0x08,0x00,0xd8,0x36,0x13,0xaf,0x42,0x35,0x11,
-0xd0,0x34,0x00,0x10,0xc1,0x34,0x00,0x2e,0xa8,0x40,0x5b,0x00,0x02,0x47,0x3f,0x21,
-0xfd,0x91,0x34,0x04,0x00,0xec,0x3c,0x10,0x0c,0x71,0x2a,0x10,0xb0,0x41,0x2d,0x00,
-0xe4,0x35,0x21,0x5f,0xff,0x7c,0x22,0x10,0x6f,0xce,0x07,0x10,0xd0,0x07,0x00,0x30,
-0x0e,0xff,0x60,0x07,0x00,0x11,0x5f,0x7c,0x00,0x00,0x28,0x2c,0x00,0x07,0x00,0x50,
-0x6f,0xff,0x70,0x00,0x6f,0xe7,0x30,0x40,0xf8,0x00,0x6f,0xff,0xf7,0x24,0x60,0x70,
-0x6f,0xff,0x00,0x00,0x1c,0xd0,0x3a,0x10,0x00,0xce,0x2e,0x10,0x6f,0xe0,0x30,0x00,
-0x07,0x00,0x80,0x0a,0xc9,0x9e,0xff,0xf0,0x6f,0xff,0x0e,0xf8,0x05,0x65,0x6f,0xff,
-0x0b,0xef,0xfe,0xa3,0x0c,0x30,0x28,0x8f,0xfc,0x54,0x07,0x26,0x9a,0x90,0x6a,0x05,
-0x44,0x5b,0xef,0xeb,0x40,0xd6,0x27,0xc2,0x8f,0xff,0xa8,0xdf,0xff,0x20,0x0c,0xff,
-0x90,0x01,0xff,0xf7,0xd3,0x0d,0x40,0x80,0x00,0x18,0xce,0xd0,0x21,0x11,0x3e,0x11,
-0x41,0x31,0x0d,0xff,0xd3,0xaa,0x2b,0x21,0xf4,0x00,0xb7,0x2b,0x10,0x50,0xf9,0x0c,
-0x40,0xef,0xff,0xab,0xff,0x88,0x35,0x02,0x8a,0x0d,0x33,0xbf,0xfc,0x67,0xfc,0x3a,
-0x11,0x60,0xd4,0x03,0x11,0x70,0x10,0x01,0x11,0x90,0x75,0x00,0x1f,0x80,0x75,0x00,
-0x4c,0x00,0x71,0x0c,0x00,0x87,0x2f,0x10,0xfe,0xe8,0x22,0x70,0xf8,0x09,0xfe,0x30,
-0x00,0x04,0x43,0x03,0x00,0x0f,0x75,0x00,0x49,0x20,0x09,0xfd,0xef,0x44,0x00,0x84,
-0x2a,0x00,0x15,0x26,0x31,0x53,0xaf,0xfb,0xd4,0x1f,0x1f,0x11,0xea,0x00,0x4b,0x10,
-0x8f,0x54,0x0b,0x00,0x42,0x24,0x21,0x4f,0xfe,0xf7,0x18,0x15,0xbe,0x0f,0x14,0x0f,
-0x7e,0x2d,0x40,0x00,0xda,0x1b,0x11,0xec,0xea,0x2c,0x20,0x93,0xae,0x46,0x00,0x31,
-0xf6,0x07,0xf0,0x52,0x03,0x11,0xe5,0x71,0x00,0x07,0x58,0x12,0x0f,0x7c,0x00,0x41,
-0x00,0xfa,0x40,0x51,0xc6,0x05,0xbe,0xfe,0x92,0x43,0x01,0x00,0x99,0x1c,0x00,0x34,
-0x3f,0xa0,0xfe,0xce,0xff,0xff,0xfe,0xcf,0xff,0xe0,0x0b,0xee,0xb9,0x2a,0x11,0x80,
-0x4a,0x2f,0x00,0x0a,0x04,0x10,0x00,0xbc,0x31,0x23,0x29,0xdf,0x7e,0x19,0x15,0x04,
-0xac,0x20,0xa0,0x0e,0xff,0xe8,0x55,0xaf,0xfe,0x55,0x55,0x55,0x53,0x71,0x00,0x13,
-0x8f,0xbe,0x2d,0xb0,0x50,0x00,0xaf,0xff,0xc1,0x00,0x04,0x50,0x0e,0xff,0xfc,0x63,
-0x1d,0x42,0xcc,0xef,0xd0,0x05,0xab,0x19,0x00,0x54,0x07,0x9f,0x4b,0xef,0xeb,0x50,
-0x04,0xbe,0xfe,0xc8,0x10,0x10,0x2e,0x09,0x2f,0x5f,0xfc,0x10,0x2e,0x03,0x51,0x38,
-0x87,0x0b,0xff,0xc1,0x10,0x2e,0x26,0xfe,0xbe,0x10,0x2e,0x40,0xaf,0xff,0xb4,0x00,
-0x82,0x21,0x10,0x50,0x3f,0x01,0x24,0xcf,0xf3,0x0f,0x1b,0x03,0xa1,0x30,0x30,0x0a,
-0xea,0x20,0xc3,0x00,0x16,0x10,0x9c,0x26,0x01,0x8f,0x25,0x0a,0x38,0x03,0x00,0x33,
-0x43,0x41,0x60,0x00,0x00,0x4e,0x0e,0x09,0x10,0x1e,0x4b,0x04,0x40,0x80,0x08,0xff,
-0xe2,0x6a,0x04,0x01,0xe6,0x3f,0x02,0xaa,0x26,0x22,0xff,0x52,0x22,0x1c,0x92,0x1f,
-0xff,0x95,0x55,0x55,0x55,0x10,0xef,0xfa,0x51,0x12,0x60,0xf6,0x00,0x06,0xe2,0x00,
-0x2e,0x3c,0x01,0x10,0xd0,0x6f,0x02,0x00,0x34,0x01,0x42,0x18,0xcf,0xfd,0x92,0x9a,
-0x0d,0x11,0x50,0x8e,0x02,0x11,0x60,0x93,0x12,0x01,0x6f,0x00,0x1f,0xaa,0x75,0x00,
-0x4d,0x31,0x3e,0xfc,0x10,0xcd,0x3e,0x10,0xfd,0x12,0x43,0x4b,0xf7,0x0a,0xfe,0x20,
-0xad,0x03,0x0f,0x75,0x00,0x41,0xb1,0x9f,0xa0,0x01,0xcf,0x60,0x00,0x0f,0xff,0x10,
-0x5f,0xfc,0x0d,0x00,0x25,0xce,0x60,0xbf,0x1a,0x0f,0x32,0x2f,0x40,0x31,0x09,0xff,
-0xe1,0x72,0x0d,0x63,0x0c,0xff,0x40,0x00,0x1a,0xa8,0x80,0x06,0x01,0x3f,0x42,0x0f,
-0x07,0x00,0x12,0x00,0x45,0x13,0x10,0x1e,0xe0,0x2a,0x53,0x60,0x01,0xaa,0x70,0x00,
-0x79,0x42,0x0f,0x41,0x00,0x16,0x00,0x62,0x07,0x00,0x31,0x47,0xd4,0xfe,0xfc,0x10,
-0x08,0xff,0x50,0xbf,0xd2,0x04,0x42,0x00,0x03,0x42,0x3e,0x18,0x1f,0xf0,0x05,0x00,
-0x2a,0xff,0x00,0x0a,0xf9,0x00,0x1d,0xe4,0x2f,0xff,0x00,0x6f,0xfb,0x0a,0xe8,0x00,
-0x1c,0xe4,0x55,0x00,0x33,0x32,0x00,0x04,0x94,0xf4,0x02,0x40,0xfe,0x60,0x3c,0x10,
-0x96,0x14,0x00,0xd3,0x08,0x21,0x17,0xef,0xb8,0x07,0x11,0x1b,0x69,0x0b,0x30,0x0b,
-0xfa,0x9f,0x4b,0x04,0xb2,0x24,0x00,0xbf,0xfe,0x10,0x00,0x04,0x88,0x64,0xff,0xf5,
-0x4f,0x0b,0x21,0xa0,0x1e,0x4e,0x0b,0x90,0x08,0xff,0xf8,0x11,0x4d,0xff,0xe0,0xdf,
-0xfb,0x79,0x07,0x10,0x0f,0xdc,0x2b,0x40,0xff,0xe0,0xff,0xf6,0x88,0x08,0x30,0x0d,
-0xff,0x90,0x6a,0x05,0x10,0x8f,0x02,0x3c,0x71,0xf3,0x01,0xef,0xff,0xdd,0xff,0xf9,
-0xa9,0x01,0x10,0xfa,0xf7,0x01,0xb1,0xfe,0xb5,0x00,0x00,0x00,0x6e,0xe8,0x22,0xef,
-0x00,0x03,0x94,0x0b,0x86,0x09,0xf9,0x28,0xff,0xd2,0x00,0x01,0x20,0x2c,0x0d,0x0f,
-0x29,0x2e,0x3c,0x01,0x15,0x42,0x01,0xa9,0x1c,0x01,0xaa,0x34,0x02,0xea,0x03,0x26,
-0x6a,0xa2,0x6e,0x03,0x11,0x29,0xf9,0x02,0x11,0x5f,0x6d,0x2f,0x10,0x2f,0x11,0x32,
-0x81,0xb0,0x0a,0xff,0xe2,0x00,0x8f,0xff,0x30,0xc3,0x43,0x10,0xf8,0x66,0x04,0x40,
-0x0b,0xff,0xb3,0xff,0x50,0x1a,0x01,0x86,0x15,0x32,0x0a,0xff,0xb0,0x1a,0x00,0x03,
-0x27,0x00,0x02,0x34,0x00,0x01,0x41,0x00,0x14,0xc1,0x4e,0x00,0x00,0xdd,0x03,0x15,
-0xa0,0xd5,0x44,0x21,0x02,0xff,0x4d,0x1e,0x2f,0x7a,0xa1,0x75,0x00,0x4c,0x11,0x0b,
-0x19,0x16,0x20,0x1c,0xfe,0x5e,0x04,0x30,0x2d,0xfc,0x15,0x76,0x2a,0x4f,0x44,0x00,
-0x02,0x44,0x75,0x00,0x4a,0x53,0x06,0xee,0x82,0x1e,0xf1,0xcc,0x01,0x69,0x00,0x9f,
-0x92,0x7e,0xfd,0x20,0xcd,0x01,0x0f,0x75,0x00,0x43,0x20,0x4e,0xd2,0x86,0x07,0x30,
-0x0a,0xff,0x70,0xd5,0x2b,0x02,0x0d,0x00,0x04,0x6c,0x25,0x0f,0x17,0x30,0x40,0x03,
-0x03,0x20,0x22,0x00,0x01,0xb3,0x19,0x12,0x0e,0xb1,0x05,0x25,0x27,0x60,0x4b,0x20,
-0x02,0x2f,0x24,0x02,0x8f,0x20,0x20,0xc2,0xbb,0x01,0x00,0x15,0xb8,0xff,0x00,0x26,
-0x28,0x60,0x96,0x1b,0x03,0x41,0x00,0x33,0x08,0xfd,0x30,0xad,0x00,0x12,0x84,0x24,
+0xae,0x01,0x51,0xfb,0xaf,0xff,0xfe,0xdd,0x01,0x00,0x1a,0xd8,0x00,0x08,0x15,0x40,
+0xa4,0x09,0x06,0x0a,0x0b,0x24,0x9f,0xb0,0x0a,0x00,0x34,0x09,0xfc,0x10,0x0b,0x00,
+0x24,0x8f,0xd1,0x0a,0x00,0x10,0x08,0x36,0x04,0x82,0x12,0x22,0x22,0x11,0x11,0x10,
+0x8f,0xe2,0x15,0x09,0x00,0x09,0x05,0x13,0x30,0x0a,0x00,0x00,0x1c,0x01,0x22,0x5c,
+0xcc,0x01,0x00,0x40,0xdc,0x30,0x01,0x22,0x01,0x00,0x00,0x2c,0x00,0x23,0x02,0xdf,
+0x1f,0x00,0x35,0xf7,0x00,0x1d,0x0a,0x00,0xd5,0x01,0xcf,0xfc,0xbc,0xcc,0xcd,0xdd,
+0xee,0xe6,0x00,0x00,0x0b,0xfc,0x81,0x00,0x25,0xaf,0xc0,0x95,0x08,0x16,0xfc,0x96,
+0x00,0x15,0xc1,0x81,0x00,0x06,0x96,0x00,0x25,0x7e,0x20,0x0f,0x04,0x04,0x09,0x00,
+0x33,0xcc,0xa7,0x30,0x0a,0x00,0x54,0x9a,0xdf,0xfe,0x91,0x00,0x25,0x04,0x12,0xff,
+0x0b,0x00,0x51,0xcb,0x96,0x10,0x18,0xfe,0xf5,0x00,0x62,0x9b,0xdf,0xfb,0x30,0x2c,
+0xf5,0x91,0x06,0x31,0x7d,0xfb,0x10,0xbe,0x05,0x53,0x98,0x40,0x00,0x6e,0xe1,0x49,
+0x0b,0x23,0x91,0x01,0x48,0x00,0x31,0x38,0xef,0x50,0x21,0x01,0x41,0x8b,0xbb,0x94,
+0x06,0xbd,0x03,0x51,0xef,0x71,0x03,0x9f,0xc3,0x93,0x00,0x10,0xf3,0x2c,0x06,0x10,
+0x50,0xb4,0x0d,0x31,0x70,0x05,0x95,0xc3,0x08,0x80,0x4f,0xff,0x10,0x7f,0xff,0x60,
+0x2f,0xfe,0x25,0x02,0x01,0xb3,0x05,0x20,0xff,0x30,0x14,0x00,0x51,0xaf,0xff,0x80,
+0x2f,0xfe,0x28,0x00,0x50,0x1a,0xda,0x00,0x8f,0xf5,0x4b,0x07,0x10,0xf2,0x70,0x07,
+0x11,0x80,0xf1,0x0d,0x32,0x71,0x01,0x7f,0x4c,0x05,0x45,0x28,0xdf,0xff,0xc7,0xdc,
+0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x90,0x8f,0xff,0xff,0xff,0xff,0xa0,0x00,0x00,
+0xdf,0x08,0x00,0xf2,0x03,0xfb,0x00,0x00,0xdf,0x31,0x11,0x11,0x44,0xef,0xa0,0x00,
+0xdf,0x20,0x00,0x00,0xf6,0x3f,0xfa,0x08,0x00,0x30,0x04,0xff,0x90,0x08,0x00,0x40,
+0xfa,0x66,0x9f,0xf2,0x08,0x00,0x40,0xff,0xff,0x8c,0xf3,0x08,0x00,0x3f,0x00,0x00,
+0x0c,0x08,0x00,0x3f,0x10,0xee,0x01,0x00,0x41,0xef,0xf3,0xaf,0xff,0x01,0x00,0x26,
+0xe1,0x00,0x01,0x00,0x34,0x05,0x76,0x30,0x0a,0x00,0x42,0xef,0xef,0xfd,0x20,0x0b,
+0x00,0x51,0x6f,0x91,0x00,0x3c,0xf2,0x0a,0x00,0xf0,0x09,0x01,0xf8,0x00,0x00,0x00,
+0xcd,0xce,0xb4,0x00,0x00,0x00,0x08,0xe0,0x00,0x00,0x00,0x3f,0xa8,0xdf,0x60,0x00,
+0x00,0x0c,0xa0,0x1b,0x00,0x72,0x00,0x08,0xf3,0x00,0x00,0x0d,0x90,0x33,0x00,0x50,
+0xda,0x00,0x00,0x3f,0xa0,0x09,0x00,0xf0,0x31,0x45,0x00,0x7e,0x00,0x00,0xec,0x00,
+0x00,0x00,0x48,0xcf,0xfe,0x00,0x6f,0x00,0x07,0xf2,0x00,0x48,0xcf,0xff,0xff,0xd9,
+0x00,0x8e,0x00,0x0d,0xa0,0x0e,0xff,0xff,0xd9,0x51,0x00,0x00,0xdb,0x00,0x1f,0x40,
+0x0a,0xc8,0x41,0x75,0x00,0x00,0x00,0xbf,0x30,0x2f,0x20,0x00,0x00,0x02,0xfe,0x10,
+0x00,0x00,0x0d,0xb0,0x2f,0x30,0x00,0x00,0x0b,0x38,0x01,0xf0,0x05,0x06,0xf1,0x0f,
+0x50,0x00,0x00,0x5f,0xff,0xf4,0x00,0x00,0x03,0xf2,0x0b,0xb0,0x00,0x01,0xef,0xff,
+0xfd,0x0b,0x00,0xd3,0x04,0xf4,0x00,0x01,0x44,0x44,0x44,0x10,0x00,0x06,0xf0,0x00,
+0xaf,0xb8,0x00,0x51,0x0e,0xa0,0x00,0x1b,0xf9,0xb8,0x00,0x62,0x13,0xce,0x10,0x00,
+0x00,0x7e,0xe3,0x00,0x10,0xb2,0x11,0x00,0x64,0x35,0x66,0x65,0x55,0x55,0x52,0xea,
+0x00,0x24,0x4c,0xc1,0x0a,0x00,0x26,0x6f,0xf2,0x0a,0x00,0x24,0x04,0x95,0x0a,0x00,
+0x24,0x0a,0xf7,0x0a,0x00,0x10,0x0f,0x20,0x00,0xf0,0x14,0x10,0x00,0x09,0xff,0xfe,
+0x56,0xb0,0x00,0x00,0x9f,0xff,0x91,0x8f,0xfb,0xdf,0xf2,0x10,0x00,0x0c,0xff,0xdf,
+0xf1,0xff,0x40,0x0a,0xf9,0x00,0x00,0x6f,0xd2,0x01,0x82,0xff,0x00,0x05,0xda,0x01,
+0xf0,0x04,0x30,0x00,0x00,0xff,0x30,0x09,0xf9,0x00,0x03,0xfc,0x00,0x00,0x00,0x9f,
+0xfa,0xcf,0xf3,0x00,0x08,0x48,0x00,0x61,0x0a,0xff,0xff,0x60,0x00,0x0b,0x68,0x00,
+0x64,0x7f,0xf2,0x00,0x00,0x0e,0xf0,0x78,0x00,0x24,0x1f,0xc0,0x0a,0x00,0x24,0x3f,
+0xa0,0x0a,0x00,0x24,0x5f,0x80,0x0a,0x00,0x24,0x7f,0x60,0x0a,0x00,0x24,0x8f,0x50,
+0x0a,0x00,0x2a,0x9f,0x40,0xb4,0x00,0x01,0x01,0x00,0xf2,0x0d,0x7b,0x91,0x00,0xbf,
+0xff,0xe1,0x4f,0xa0,0x6f,0x97,0xf3,0x00,0xfc,0x5f,0x70,0x2f,0xa0,0xdf,0xcf,0xf3,
+0x02,0xbf,0xd4,0x00,0x00,0x00,0x9a,0xa7,0x22,0x00,0x33,0x03,0xff,0xf3,0xd8,0x01,
+0x22,0xff,0xd0,0x09,0x00,0x49,0x06,0xff,0x70,0x00,0x01,0x00,0x13,0x0c,0x1a,0x00,
+0x41,0x02,0xff,0xff,0x40,0x09,0x00,0x31,0x8f,0xff,0xfa,0x08,0x00,0x42,0x0d,0xff,
+0xff,0xf0,0x44,0x00,0x21,0xfe,0xff,0x92,0x00,0x40,0x9f,0xfb,0x9f,0xfc,0x08,0x00,
+0x51,0x0f,0xff,0x64,0xff,0xf2,0x54,0x00,0x40,0xf1,0x0e,0xff,0x80,0xc0,0x01,0xb0,
+0xfb,0x00,0x9f,0xfd,0x00,0x00,0x00,0x1f,0xff,0x60,0x04,0xaf,0x01,0x55,0x07,0xff,
+0xf1,0x00,0x0e,0xfb,0x02,0x41,0xff,0x00,0x00,0x3f,0x08,0x00,0x10,0xf6,0x4d,0x01,
+0x71,0xee,0xee,0xef,0xff,0xc0,0x00,0xff,0x29,0x01,0x50,0xff,0x20,0x5f,0xff,0x60,
+0x61,0x00,0x41,0xf8,0x0b,0xff,0xf0,0x72,0x00,0x10,0xe0,0x60,0x00,0x32,0x4a,0xaa,
+0x20,0xd5,0x01,0x03,0xab,0x00,0x33,0x09,0xff,0x90,0xcd,0x00,0x1f,0xa0,0xbb,0x00,
+0x8c,0x22,0x6f,0xf9,0x99,0x00,0x32,0x7f,0xff,0xf9,0x08,0x00,0x21,0xf6,0x3e,0x09,
+0x00,0x5f,0x18,0x84,0x00,0x28,0x82,0xbb,0x00,0x8a,0x52,0x2c,0xfb,0x40,0xaf,0x60,
+0x7f,0x00,0x01,0x66,0x00,0x51,0x03,0xfd,0x35,0xcf,0xf6,0xa1,0x00,0x3f,0x10,0x00,
+0x10,0x76,0x01,0x8a,0x50,0x01,0xcf,0x60,0x03,0xed,0x07,0x04,0x50,0x5f,0xfd,0x00,
+0x9f,0xf8,0x93,0x04,0x59,0xce,0x60,0x03,0xed,0x20,0xb3,0x00,0x22,0xcf,0xfd,0x08,
+0x00,0x10,0x2f,0x6d,0x00,0x00,0xc6,0x04,0x13,0xff,0x4b,0x02,0x10,0xdf,0x6d,0x00,
+0x10,0x00,0x70,0x00,0x22,0xef,0xf6,0x6b,0x02,0x21,0xb9,0xff,0x9c,0x03,0x60,0xff,
+0xf6,0x4f,0xff,0x20,0x00,0x7f,0x04,0x40,0x10,0xef,0xf8,0x00,0x92,0x04,0x20,0xb0,
+0x09,0xf8,0x00,0x70,0x01,0xff,0xf6,0x00,0x4f,0xff,0x40,0xe3,0x01,0x42,0x10,0x00,
+0xef,0xfa,0x31,0x01,0x00,0xf8,0x00,0x12,0x03,0x73,0x04,0xd0,0x60,0x00,0x9f,0xff,
+0xee,0xee,0xee,0xff,0xfc,0x00,0x0f,0xff,0xc0,0x50,0x00,0x41,0xf2,0x05,0xff,0xf6,
+0x61,0x00,0x31,0x80,0xbf,0xff,0x72,0x00,0x10,0xfe,0x06,0x00,0x32,0x5d,0xe8,0x00,
+0x78,0x00,0x22,0x64,0xe6,0x96,0x03,0x22,0xe0,0x0a,0x91,0x00,0x42,0x4f,0x31,0xd8,
+0x00,0x55,0x01,0x13,0xfb,0xbc,0x00,0x1f,0x01,0xc4,0x00,0x85,0x21,0x00,0x1f,0x2e,
+0x00,0x11,0xf2,0xea,0x01,0x04,0x0b,0x00,0x00,0x16,0x02,0x52,0xff,0xdc,0xcc,0xcc,
+0xc1,0xff,0x04,0x01,0x80,0x00,0x01,0x3b,0x00,0x23,0x8f,0xff,0xab,0x05,0x33,0xbf,
+0xfc,0x2f,0x38,0x02,0x63,0x04,0xff,0xf4,0x1f,0xff,0x40,0x3b,0x02,0x20,0xc0,0x0f,
+0x42,0x00,0x10,0x30,0xae,0x00,0x14,0x30,0x0b,0x00,0x40,0xef,0xfb,0x00,0x0f,0x4d,
+0x00,0x72,0x20,0x00,0x07,0xff,0xff,0xee,0xef,0x0f,0x04,0x11,0x1e,0x6b,0x00,0x01,
+0x0b,0x00,0x01,0x62,0x07,0x01,0x51,0x02,0x30,0x01,0xff,0xfb,0x99,0x02,0x11,0x90,
+0xff,0x00,0x10,0xf3,0x0b,0x00,0xa0,0xec,0xcc,0xcc,0xca,0x2f,0xff,0xb0,0x00,0x00,
+0x0b,0x24,0x00,0x20,0xfd,0xbf,0x50,0x00,0x11,0x0a,0x0b,0x00,0x60,0x00,0x01,0x8c,
+0xef,0xea,0x40,0x69,0x00,0x51,0xff,0xff,0xfa,0x00,0x04,0x44,0x00,0x90,0xb0,0x0e,
+0xff,0xe4,0x00,0x2b,0xff,0xf4,0x5f,0x90,0x00,0x30,0xef,0xfa,0xaf,0x6c,0x01,0x32,
+0x9e,0xec,0xdf,0xd8,0x02,0x2e,0xff,0xf9,0x07,0x00,0x01,0x38,0x01,0x00,0xce,0x00,
+0x00,0x2a,0x00,0x31,0x8c,0xca,0x6f,0xaf,0x00,0x92,0xfa,0x0f,0xff,0xd3,0x00,0x1a,
+0xff,0xf5,0x05,0x54,0x00,0x22,0x00,0x6f,0xf9,0x07,0x51,0x02,0x9e,0xff,0xfa,0x40,
+0xff,0x02,0x11,0xa1,0x38,0x03,0x22,0x7f,0xfc,0x3f,0x01,0x12,0xfe,0x46,0x03,0x11,
+0xf9,0x07,0x00,0x10,0xfc,0xd2,0x00,0x22,0x6a,0xaa,0x61,0x03,0x01,0xd3,0x00,0x11,
+0xdf,0xbb,0x05,0x24,0x2e,0xfc,0xc5,0x02,0x11,0x7f,0x56,0x00,0x03,0x06,0x00,0x00,
+0xa1,0x01,0x21,0xed,0x7f,0x8e,0x01,0x0e,0x06,0x00,0x01,0x24,0x00,0x14,0xc0,0x06,
+0x00,0x4f,0xcc,0xcc,0xcc,0x90,0x2a,0x00,0x07,0x47,0xdd,0xdd,0xdd,0xdd,0x5a,0x00,
+0x00,0x16,0x00,0x30,0x1a,0xaa,0x50,0xd3,0x01,0x11,0xfc,0xcb,0x03,0x10,0xd1,0x9e,
+0x01,0x2f,0xfe,0x10,0x84,0x00,0x5c,0x70,0x2e,0xfd,0x10,0x00,0x00,0x03,0xef,0x7e,
+0x00,0xbf,0x3f,0xfa,0x1c,0xfd,0x10,0x00,0x78,0x70,0x00,0x78,0x50,0x84,0x00,0x5a,
+0xb0,0x8f,0xa0,0x00,0xcf,0x60,0x00,0xff,0xf2,0x04,0xff,0xd0,0x0c,0x00,0x2f,0xbe,
+0x60,0x7e,0x00,0x59,0x61,0x5a,0xaa,0x10,0x00,0xcf,0xf9,0x04,0x02,0x33,0x01,0xef,
+0xd0,0x2d,0x03,0x00,0xb5,0x03,0x0f,0x07,0x00,0x22,0x60,0x0a,0xaa,0x50,0x09,0xff,
+0xc0,0xcc,0x01,0x2f,0xcf,0xe2,0x4c,0x00,0x2d,0xf4,0x04,0x00,0x2d,0xfd,0x10,0x00,
+0x2e,0xff,0xfd,0x10,0x3e,0xfb,0x1b,0xfd,0x16,0x87,0x00,0x07,0x85,0x00,0x53,0x00,
+0x01,0x55,0x04,0x0f,0x09,0x00,0x30,0x90,0x7f,0xb0,0x00,0xbf,0x7e,0xff,0x30,0x3f,
+0xfe,0x09,0x00,0x02,0x03,0x08,0x0f,0x5a,0x00,0x34,0x02,0xf7,0x04,0x50,0x2f,0xff,
+0xff,0xfe,0xa4,0x4a,0x05,0x00,0x6a,0x01,0x10,0xb1,0x08,0x00,0x11,0xee,0x5b,0x0a,
+0x70,0x2f,0xff,0x60,0x01,0x8f,0xff,0xa0,0x08,0x00,0x41,0x00,0x08,0xff,0xf2,0x08,
+0x00,0x31,0x01,0xff,0xf8,0x08,0x00,0x41,0x00,0xcf,0xfb,0x3f,0x24,0x05,0x23,0xaf,
+0xfd,0x08,0x00,0x94,0xfe,0x02,0x4f,0xff,0x72,0x20,0x00,0xaf,0xfd,0x20,0x00,0x09,
+0x30,0x00,0x03,0x40,0x00,0x03,0x50,0x00,0x57,0xed,0xef,0xff,0xfd,0x10,0x70,0x00,
+0x40,0xff,0xfe,0xa5,0x00,0x62,0x04,0x32,0xd7,0x14,0xfd,0x29,0x02,0x00,0xf2,0x03,
+0x30,0x0c,0xf6,0x39,0xb0,0x04,0x37,0x00,0x22,0x00,0x72,0x07,0x31,0x07,0xff,0xf5,
+0xb1,0x05,0x30,0x7f,0xff,0xe0,0x71,0x05,0x42,0x67,0xff,0xff,0x90,0x0f,0x00,0x22,
+0xff,0x30,0x0f,0x00,0x13,0xfc,0x0f,0x00,0x11,0xf6,0x0f,0x00,0x31,0xf9,0xff,0xe1,
+0x0f,0x00,0x30,0x1e,0xff,0xa0,0x0f,0x00,0x40,0xf0,0x4f,0xff,0x31,0x0f,0x00,0x40,
+0x00,0xbf,0xfd,0x2f,0x0f,0x00,0x30,0x02,0xff,0xf9,0x0f,0x00,0x00,0x4f,0x05,0x00,
+0x0f,0x00,0x00,0xf9,0x05,0x10,0xf6,0x83,0x02,0x12,0x4f,0x0f,0x00,0x22,0x00,0xaf,
+0x0f,0x00,0x22,0x01,0xef,0x0f,0x00,0x11,0x06,0x82,0x07,0x11,0xe0,0x89,0x00,0x13,
+0x0b,0x85,0x09,0x13,0x0c,0xc8,0x05,0x28,0x1a,0xa7,0x61,0x07,0x81,0x06,0xce,0xfd,
+0xa3,0x00,0x00,0x00,0x3e,0x53,0x05,0x22,0x00,0x3f,0xf2,0x0c,0xa0,0x0d,0xff,0xf6,
+0x00,0x2b,0xff,0xf6,0x04,0xff,0xf6,0xe1,0x05,0x30,0xd0,0xaf,0xfe,0x22,0x09,0x40,
+0xff,0x3d,0xff,0xb0,0xf6,0x04,0x31,0xf6,0xef,0xf9,0x1a,0x08,0x11,0x7f,0x58,0x00,
+0x23,0xff,0xf8,0x0f,0x00,0x13,0x7d,0x1e,0x00,0x03,0x2d,0x00,0x12,0x35,0x3c,0x00,
+0x10,0xe0,0x4b,0x00,0x30,0x1b,0xff,0xf6,0x5a,0x00,0x35,0xef,0xff,0xfb,0x69,0x00,
+0x00,0x78,0x00,0x13,0xa4,0xe0,0x0a,0x11,0xf3,0x2d,0x07,0x21,0xef,0xf5,0x0f,0x00,
+0x2f,0xaf,0xf6,0xa5,0x00,0x80,0x11,0x04,0xdf,0x01,0x00,0x72,0x06,0x11,0xb0,0xb2,
+0x00,0x20,0x81,0xdf,0x08,0x00,0x5f,0x78,0x50,0x01,0x78,0x40,0xa5,0x00,0x76,0x50,
+0x01,0xbf,0xc5,0x08,0xf9,0xd8,0x06,0x91,0xff,0xff,0xff,0x50,0x00,0x00,0x0f,0xf3,
+0x4b,0x8d,0x06,0x3f,0x21,0x00,0x01,0x4a,0x01,0x78,0x50,0x0a,0xf8,0x00,0x2d,0xe4,
+0x38,0x00,0x45,0xf0,0x07,0xff,0xb0,0x0f,0x00,0x05,0x01,0x00,0x41,0x6c,0xef,0xda,
+0x30,0x3e,0x06,0x00,0x22,0x09,0x13,0x03,0x8c,0x07,0x80,0xdf,0xff,0x60,0x02,0xbf,
+0xff,0x60,0x4f,0xac,0x03,0x50,0xdf,0xfd,0x0a,0xff,0xe0,0xdf,0x02,0x31,0xf3,0xdf,
+0xfb,0x08,0x04,0x12,0x6e,0x96,0x00,0x22,0xf7,0xff,0x96,0x00,0x13,0x8e,0x0f,0x00,
+0x03,0x1e,0x00,0x13,0x6a,0x2d,0x00,0x11,0x5f,0x3c,0x00,0x10,0xfe,0x4b,0x00,0x80,
+0x01,0xbf,0xff,0x60,0x03,0xff,0xff,0xfe,0x5a,0x00,0x03,0x69,0x00,0x80,0x00,0x00,
+0x6c,0xef,0xda,0x40,0x00,0x00,0xf0,0x3a,0x00,0x71,0x00,0x00,0x05,0x30,0x08,0xfd,
+0x10,0x00,0x5f,0xf3,0x0d,0xff,0xd1,0x05,0xff,0xf9,0x01,0xdf,0xfd,0x6f,0xff,0xa0,
+0x00,0x2e,0xff,0xff,0xfa,0x00,0x00,0x02,0xef,0xff,0xa0,0x00,0x00,0x04,0xff,0xff,
+0xc0,0x00,0x00,0x3f,0xff,0xff,0xfc,0x00,0x03,0xff,0xfb,0x3e,0xff,0xc0,0x0e,0xff,
+0xb0,0x03,0xff,0xfa,0x05,0xfc,0x00,0x00,0x3f,0xd1,0x00,0x40,0x00,0x00,0x03,0x10,
+0x00,0x01,0x00,0xf0,0x06,0x05,0xfd,0x00,0x00,0x06,0xce,0xfd,0xa4,0xcf,0x50,0x00,
+0x2d,0xff,0xff,0xff,0xff,0xd0,0x00,0x2f,0xff,0xff,0x36,0x00,0xf2,0x5d,0x0c,0xff,
+0xf7,0x00,0x2c,0xff,0xf7,0x03,0xff,0xf7,0x00,0x01,0xff,0xff,0xe0,0x9f,0xff,0x00,
+0x00,0xbf,0xcf,0xff,0x4b,0xff,0xc0,0x00,0x5f,0xd1,0xff,0xf7,0xdf,0xfb,0x00,0x0e,
+0xf3,0x0f,0xff,0x9e,0xff,0xa0,0x09,0xf9,0x00,0xef,0xf9,0xdf,0xfb,0x03,0xfe,0x10,
+0x0f,0xff,0x9c,0xff,0xc0,0xcf,0x50,0x00,0xff,0xf7,0x8f,0xff,0x8f,0xc0,0x00,0x4f,
+0xff,0x43,0xff,0xff,0xf2,0x00,0x0b,0xff,0xe0,0x0c,0xff,0xfb,0x00,0x1a,0xff,0xf8,
+0x00,0x1e,0xff,0xff,0xef,0xff,0xfc,0x00,0x00,0xdf,0xff,0xff,0xff,0xfb,0x10,0x00,
+0x6f,0xb6,0xbe,0xfd,0xa4,0x00,0x00,0x1e,0xf3,0x00,0x01,0x00,0x30,0x2e,0xff,0x80,
+0x07,0x00,0x22,0x03,0xff,0x11,0x00,0x22,0x4f,0xfc,0xa1,0x00,0x34,0xaa,0x30,0x00,
+0x01,0x00,0x7f,0xaf,0xfe,0x00,0x00,0x01,0xff,0xf7,0x07,0x00,0x33,0x00,0xd2,0x00,
+0xf1,0x15,0x02,0xff,0xf6,0x7f,0xff,0x20,0x00,0x05,0xff,0xf4,0x3f,0xff,0xc2,0x00,
+0x3e,0xff,0xe0,0x0a,0xff,0xff,0xee,0xff,0xff,0x60,0x00,0xbf,0xff,0xff,0xff,0xf8,
+0x00,0x00,0x04,0xae,0xff,0xd9,0x7f,0x00,0x30,0x0c,0xff,0xb0,0x07,0x00,0x40,0x6f,
+0xfd,0x10,0x00,0x3d,0x00,0x10,0xe1,0x0d,0x00,0x3f,0x06,0xaa,0x20,0x9a,0x00,0x6f,
+0x31,0x0a,0xff,0x50,0x80,0x00,0x80,0xff,0xf5,0x00,0x00,0x00,0x0b,0xfe,0x36,0x0f,
+0x00,0x5f,0x38,0x82,0x00,0x48,0x71,0x9a,0x00,0x6d,0xff,0x04,0x3e,0xe3,0x00,0x6f,
+0xc0,0x00,0x00,0x9f,0xf9,0x00,0xdf,0xf4,0x00,0x00,0x3e,0xd3,0x00,0x6e,0xc0,0xc7,
+0x01,0x6f,0x31,0x01,0xaa,0xa5,0x82,0x00,0x12,0x9f,0x5c,0x02,0x21,0x3f,0xfd,0x05,
+0x03,0x35,0x0d,0xfe,0x10,0xc9,0x01,0x30,0x0b,0xff,0xf1,0x3d,0x03,0x20,0xf8,0x3f,
+0x8d,0x02,0xf0,0x02,0xbf,0xff,0x10,0xaf,0xff,0x10,0x00,0x3f,0xff,0x80,0x02,0xff,
+0xf7,0x00,0x0a,0xff,0xe0,0x04,0x00,0x00,0x0b,0x00,0x60,0x00,0x2f,0xff,0x60,0x9f,
+0xfe,0x49,0x00,0x40,0xfd,0x1f,0xff,0x70,0x88,0x00,0xa0,0xfc,0xff,0xe0,0x00,0x00,
+0x00,0x09,0xff,0xff,0xf6,0x46,0x00,0x31,0x1f,0xff,0xfd,0x4e,0x00,0x31,0x8f,0xff,
+0x60,0x2a,0x02,0x03,0xd3,0x02,0x3f,0x6f,0xff,0x30,0x0f,0x00,0x0d,0x20,0x7f,0xff,
+0x0b,0x00,0x56,0x07,0xff,0xf0,0x00,0x00,0x0d,0x00,0x60,0xff,0xff,0xec,0x71,0x00,
+0x7f,0x98,0x03,0xa0,0xe3,0x07,0xff,0xfb,0xbb,0xdf,0xff,0xe1,0x7f,0xff,0x30,0x00,
+0x10,0x77,0x27,0x00,0x40,0xbf,0xfb,0x7f,0xff,0x7a,0x00,0x10,0xd7,0x0d,0x00,0x10,
+0xcf,0x0d,0x00,0x51,0x02,0xaf,0xff,0x67,0xff,0xcd,0x03,0x01,0x34,0x00,0x10,0xc1,
+0x34,0x00,0x2e,0xa8,0x40,0x5b,0x00,0x00,0x01,0x00,0x41,0x18,0xdf,0xfd,0x91,0x34,
+0x04,0xf0,0x10,0xff,0xfe,0x20,0x00,0x0c,0xff,0xfc,0xdf,0xff,0xb0,0x00,0x2f,0xff,
+0x70,0x09,0xff,0xf0,0x00,0x5f,0xff,0x00,0x04,0xff,0xf0,0x00,0x6f,0xff,0x00,0x07,
+0xff,0xd0,0x07,0x00,0x30,0x0e,0xff,0x60,0x07,0x00,0x11,0x5f,0x7c,0x00,0x31,0x00,
+0x8f,0xfe,0x07,0x00,0x30,0x6f,0xff,0x70,0x07,0x00,0x30,0x0d,0xff,0xf8,0x07,0x00,
+0xc1,0x01,0xdf,0xff,0x70,0x6f,0xff,0x00,0x00,0x1c,0xff,0xf1,0x6f,0x99,0x01,0x10,
+0xf4,0x07,0x00,0x10,0x03,0x07,0x00,0xf0,0x03,0x0a,0xc9,0x9e,0xff,0xf0,0x6f,0xff,
+0x0e,0xff,0xff,0xff,0x50,0x6f,0xff,0x0b,0xef,0xfe,0xa3,0x40,0x00,0x11,0x20,0x27,
+0x01,0x12,0xfc,0x18,0x02,0x11,0xf6,0x07,0x00,0x35,0x9a,0x90,0x00,0x01,0x00,0x51,
+0x5b,0xef,0xeb,0x40,0x00,0xc7,0x01,0xe1,0x70,0x00,0x8f,0xff,0xa8,0xdf,0xff,0x20,
+0x0c,0xff,0x90,0x01,0xff,0xf7,0xb7,0x01,0xa0,0xff,0x80,0x00,0x18,0xce,0xff,0xff,
+0xf9,0x00,0x3e,0xe7,0x00,0xf0,0x0f,0x90,0x0d,0xff,0xd3,0x00,0xdf,0xf9,0x02,0xff,
+0xf4,0x00,0x0d,0xff,0x90,0x2f,0xff,0x50,0x02,0xff,0xf9,0x00,0xef,0xff,0xab,0xff,
+0xff,0x90,0x05,0xff,0xff,0x1b,0x05,0x41,0x04,0xbf,0xfc,0x67,0xa7,0x01,0x31,0x3f,
+0xff,0x60,0xd4,0x03,0x11,0x70,0x10,0x01,0x11,0x90,0x75,0x00,0x1f,0x80,0x75,0x00,
+0x4c,0x11,0x2e,0x6c,0x02,0xe0,0x4f,0xfe,0xfe,0x20,0x00,0x00,0x5f,0xf8,0x09,0xfe,
+0x30,0x00,0x04,0x43,0x03,0x00,0x0f,0x75,0x00,0x49,0x90,0x09,0xfd,0x60,0x5f,0xc0,
+0x00,0x08,0xff,0xff,0x47,0x00,0xaf,0xdf,0x53,0xaf,0xfb,0x00,0x00,0x02,0x20,0x00,
+0x11,0xea,0x00,0x4b,0xc0,0x8f,0xb0,0x00,0xbf,0x70,0x00,0x0f,0xff,0x20,0x4f,0xfe,
+0x00,0x0d,0x00,0x24,0xbe,0x70,0x6e,0x00,0x40,0x05,0xbe,0xfe,0xb4,0x62,0x03,0x00,
+0x8f,0x00,0xc1,0x08,0xff,0xfa,0x8d,0xff,0xf2,0x00,0xcf,0xf9,0x00,0x1f,0xff,0x21,
+0x00,0xc0,0xdf,0xf8,0x00,0x01,0x8c,0xef,0xff,0xff,0x90,0x03,0xef,0xff,0x75,0x00,
+0x31,0xdf,0xfd,0x30,0x68,0x00,0x11,0x40,0x75,0x00,0xd0,0xf5,0x00,0x2f,0xff,0x90,
+0x0e,0xff,0xfa,0xbf,0xff,0xf9,0x00,0x5f,0x6f,0x00,0x60,0xa0,0x00,0x4b,0xff,0xc6,
+0x7f,0x83,0x03,0x20,0x3c,0xec,0x46,0x03,0x30,0x0f,0x93,0xae,0x46,0x00,0x31,0xf6,
+0x07,0xf0,0x52,0x03,0x11,0xe5,0x71,0x00,0x06,0xd7,0x03,0x0f,0x7c,0x00,0x43,0x82,
+0x05,0xbe,0xff,0xc6,0x05,0xbe,0xfe,0x92,0x43,0x01,0x00,0x3c,0x00,0xf0,0x01,0x30,
+0x07,0xff,0xfe,0xce,0xff,0xff,0xfe,0xcf,0xff,0xe0,0x0b,0xee,0xb0,0x00,0xcf,0x3a,
+0x04,0x11,0xf5,0x0a,0x04,0x00,0x40,0x07,0x30,0xf9,0x00,0x29,0xfc,0x06,0x00,0x2e,
+0x01,0x33,0x04,0xff,0xff,0x0a,0x00,0xa0,0x0e,0xff,0xe8,0x55,0xaf,0xfe,0x55,0x55,
+0x55,0x53,0x71,0x00,0x11,0x8f,0x12,0x03,0xf0,0x06,0x2f,0xff,0x50,0x00,0xaf,0xff,
+0xc1,0x00,0x04,0x50,0x0e,0xff,0xfc,0xcf,0xff,0xff,0xff,0xcc,0xef,0xd0,0x05,0x36,
+0x07,0x20,0xaf,0xff,0x54,0x07,0xe0,0x4b,0xef,0xeb,0x50,0x04,0xbe,0xfe,0xc8,0x10,
+0x00,0x03,0xae,0xfe,0xb4,0x47,0x03,0xf1,0x07,0xff,0xff,0x80,0x03,0xff,0xff,0xcf,
+0xff,0xf4,0x0b,0xff,0xd1,0x01,0xcf,0xfa,0x0f,0xff,0x60,0x00,0x5f,0xfc,0x2f,0x60,
+0x04,0x13,0x3f,0x52,0x00,0x01,0x26,0x01,0xf2,0x02,0xff,0x50,0x00,0x38,0x87,0x0b,
+0xff,0xc1,0x00,0xbf,0xfb,0x03,0xff,0xfe,0xbe,0xff,0xf4,0x3c,0x00,0xb0,0x00,0x03,
+0xaf,0xff,0xb4,0x00,0x00,0x00,0x0e,0xfe,0x50,0x3f,0x01,0x21,0xcf,0xf3,0x25,0x05,
+0x11,0xf6,0x10,0x05,0x10,0xf2,0x66,0x06,0x20,0xea,0x20,0xc3,0x00,0x11,0x10,0xa6,
+0x03,0x11,0xfb,0x51,0x01,0x3c,0xbf,0xf5,0x00,0x38,0x03,0xd0,0x18,0xdf,0xfc,0x60,
+0x00,0x00,0x4e,0xff,0xff,0xff,0xb0,0x00,0x1e,0x4b,0x04,0x40,0x80,0x08,0xff,0xe2,
+0x6a,0x04,0x71,0xef,0xf7,0x00,0x00,0xff,0xf3,0x0f,0xf0,0x00,0x11,0x52,0x06,0x00,
+0xb1,0xf5,0x1f,0xff,0x95,0x55,0x55,0x55,0x10,0xef,0xfa,0x00,0x37,0x05,0x60,0xf6,
+0x00,0x06,0xe2,0x00,0x2e,0x3c,0x01,0x10,0xd0,0x6f,0x02,0x00,0x34,0x01,0x41,0x18,
+0xcf,0xfd,0x92,0x08,0x08,0x01,0xe2,0x06,0x11,0x0d,0xb3,0x03,0x12,0x08,0x23,0x08,
+0x1f,0xaa,0x75,0x00,0x4d,0x20,0x3e,0xfc,0xeb,0x00,0x20,0x5f,0xfe,0xb4,0x03,0x5b,
+0x6f,0xf7,0x0a,0xfe,0x20,0xad,0x03,0x0f,0x75,0x00,0x41,0xb1,0x9f,0xa0,0x01,0xcf,
+0x60,0x00,0x0f,0xff,0x10,0x5f,0xfc,0x0d,0x00,0x24,0xce,0x60,0x6e,0x00,0xf0,0x0c,
+0x01,0x8d,0xff,0xc6,0x00,0x00,0x04,0xef,0xff,0xff,0xfb,0x00,0x01,0xef,0xff,0xcd,
+0xff,0xf8,0x00,0x8f,0xfe,0x20,0x07,0xff,0xf0,0x0e,0xff,0x69,0x03,0x12,0x30,0x68,
+0x00,0x11,0x2f,0x07,0x00,0xa1,0x51,0xff,0xf9,0x55,0x55,0x55,0x51,0x0e,0xff,0xa0,
+0xc3,0x01,0xc1,0xff,0x60,0x00,0x6e,0x20,0x02,0xef,0xff,0xec,0xef,0xfd,0x00,0xdd,
+0x02,0xf3,0x07,0x50,0x00,0x01,0x8c,0xff,0xd9,0x20,0x00,0x09,0xff,0xe1,0x00,0x0b,
+0xff,0x90,0x00,0x0c,0xff,0x40,0x00,0x1a,0xa8,0x80,0x06,0x4f,0x00,0x06,0xff,0xf0,
+0x07,0x00,0x14,0xc2,0x5f,0xff,0x30,0x1e,0xff,0x50,0x09,0xff,0x60,0x01,0xaa,0x70,
+0xc5,0x06,0x1f,0xf0,0x41,0x00,0x18,0x20,0x00,0x04,0x9e,0x0a,0xe2,0x6f,0xfe,0xfc,
+0x10,0x08,0xff,0x50,0xbf,0xd2,0x04,0x42,0x00,0x03,0x42,0xec,0x00,0x01,0x1e,0x00,
+0x0f,0x05,0x00,0x28,0xff,0x00,0x0a,0xf9,0x00,0x1d,0xe4,0x2f,0xff,0x00,0x6f,0xfb,
+0x0a,0xe8,0x00,0x1c,0xe4,0x55,0x00,0x33,0x32,0x00,0x04,0x94,0xf4,0x02,0x80,0xfe,
+0x60,0x3c,0x10,0x00,0x1f,0xff,0xff,0xd3,0x08,0x21,0x17,0xef,0xb8,0x07,0x11,0x1b,
+0x69,0x0b,0x30,0x0b,0xfa,0x9f,0x4b,0x04,0xb2,0x24,0x00,0xbf,0xfe,0x10,0x00,0x04,
+0x88,0x64,0xff,0xf5,0x4f,0x0b,0x21,0xa0,0x1e,0x4e,0x0b,0x90,0x08,0xff,0xf8,0x11,
+0x4d,0xff,0xe0,0xdf,0xfb,0x79,0x07,0x90,0x0f,0xff,0x70,0x00,0x07,0xff,0xe0,0xff,
+0xf6,0x88,0x08,0x30,0x0d,0xff,0x90,0x6a,0x05,0xc1,0x8f,0xff,0x40,0x07,0xff,0xf3,
+0x01,0xef,0xff,0xdd,0xff,0xf9,0xa9,0x01,0x10,0xfa,0xf7,0x01,0xb1,0xfe,0xb5,0x00,
+0x00,0x00,0x6e,0xe8,0x22,0xef,0x00,0x03,0x94,0x0b,0xa4,0x09,0xf9,0x28,0xff,0xd2,
+0x00,0x01,0x20,0x00,0x01,0x1b,0x02,0x80,0xcf,0xf7,0x3b,0xef,0xd5,0x00,0xcf,0xfc,
+0xda,0x01,0xff,0x03,0xcf,0xff,0xfc,0xef,0xff,0xd0,0xcf,0xfe,0x20,0x09,0xff,0xf1,
+0xcf,0xfa,0x00,0x03,0xff,0xf2,0x06,0x00,0x1d,0x22,0x00,0x3f,0x10,0x05,0x12,0x4f,
+0xea,0x03,0x12,0x5f,0xea,0x03,0x26,0x6a,0xa2,0x6e,0x03,0x11,0x29,0xf9,0x02,0x20,
+0x5f,0xff,0xf5,0x00,0xd0,0x2f,0xff,0xfd,0xef,0xff,0xb0,0x0a,0xff,0xe2,0x00,0x8f,
+0xff,0x30,0x34,0x06,0x20,0xef,0xf8,0x66,0x04,0x50,0x0b,0xff,0xb3,0xff,0xf2,0xdb,
+0x00,0x00,0xcf,0x04,0x32,0x0a,0xff,0xb0,0x1a,0x00,0x03,0x27,0x00,0x02,0x34,0x00,
+0x01,0x41,0x00,0x14,0xc1,0x4e,0x00,0x00,0xdd,0x03,0x11,0xa0,0xdd,0x03,0x20,0xc0,
+0x00,0x33,0x08,0x10,0xd1,0x13,0x00,0x2f,0x7a,0xa1,0x75,0x00,0x4c,0x80,0x0b,0xff,
+0x40,0x00,0x00,0x00,0x1c,0xfe,0x5e,0x04,0xbf,0x2d,0xfc,0x15,0xff,0x60,0x00,0x03,
+0x44,0x00,0x02,0x44,0x75,0x00,0x4a,0x53,0x06,0xee,0x82,0x1e,0xf1,0xcc,0x01,0x69,
+0x00,0x9f,0x92,0x7e,0xfd,0x20,0xcd,0x01,0x0f,0x75,0x00,0x43,0x20,0x4e,0xd2,0x86,
+0x07,0x63,0x0a,0xff,0x70,0x0f,0xff,0x20,0x0d,0x00,0x03,0x01,0x00,0x20,0x02,0x9d,
+0x58,0x04,0x11,0x05,0x8f,0x00,0xd0,0x02,0xff,0xff,0xde,0xff,0xfb,0x00,0xaf,0xfe,
+0x20,0x08,0xff,0xf3,0xa2,0x02,0x50,0x0e,0xff,0x82,0xff,0xf3,0x5e,0x0a,0x20,0x3f,
+0xff,0x2e,0x04,0x30,0xc2,0xff,0xf4,0xfb,0x05,0x02,0x1a,0x00,0x12,0x80,0x27,0x00,
+0x03,0x34,0x00,0x01,0x41,0x00,0x12,0x10,0x4e,0x00,0x00,0xc7,0x01,0x21,0xfd,0x20,
+0x24,0x0d,0x01,0xf0,0x04,0x12,0x0e,0xb1,0x05,0x15,0x27,0xcc,0x04,0x02,0xf8,0x06,
+0x21,0xfc,0x4f,0x07,0x00,0x20,0xc2,0xbb,0x01,0x00,0x15,0xb8,0xff,0x00,0x22,0x28,
+0x60,0x34,0x00,0x16,0x70,0x41,0x00,0x33,0x08,0xfd,0x30,0xad,0x00,0x12,0x84,0x24,
 0x0a,0x10,0x30,0x69,0x00,0x28,0xcf,0xb0,0xb7,0x00,0x10,0xfa,0xb7,0x00,0x11,0x9f,
 0xb7,0x00,0x20,0x2f,0xce,0xb7,0x00,0x80,0x09,0xf4,0xaf,0xfa,0x3f,0xff,0x22,0xfc,
 0xb7,0x00,0x30,0xf3,0x9f,0x40,0xb7,0x00,0x20,0x9f,0xc0,0xb7,0x00,0x22,0xff,0xf4,
 0xb7,0x00,0x52,0xce,0xff,0xfb,0x00,0x04,0xb7,0x00,0x20,0x1f,0xed,0xb7,0x00,0x12,
-0x08,0xce,0x06,0x13,0x77,0x07,0x1c,0x21,0xf6,0x00,0xac,0x09,0x11,0x10,0x3c,0x04,
-0x1a,0xa0,0x90,0x02,0x0f,0x52,0x2f,0x3b,0x04,0xe9,0x17,0x31,0x08,0xff,0xb0,0x98,
-0x44,0x0f,0x6c,0x00,0x4a,0x40,0x01,0xcf,0xf4,0x00,0x60,0x15,0x20,0xff,0x50,0xc4,
-0x27,0x50,0x4f,0xf7,0x00,0x01,0x22,0x03,0x00,0x0f,0x6c,0x00,0x41,0x40,0x05,0xed,
-0x10,0x08,0x3e,0x42,0x42,0x60,0x0f,0xff,0x20,0x0c,0x00,0x0f,0x3e,0x01,0x44,0x35,
-0x8f,0xfe,0x10,0xdf,0x08,0x12,0x0c,0xd5,0x4a,0x27,0xaa,0x50,0x4a,0x1c,0x00,0x04,
-0x00,0x10,0x7f,0x66,0x30,0x40,0xf7,0x01,0xff,0xf6,0x13,0x49,0x10,0x0c,0x55,0x03,
-0x10,0xc0,0x8a,0x06,0x01,0xdb,0x10,0x10,0xf5,0xc3,0x1a,0x50,0x0b,0xff,0x98,0xff,
-0xc0,0xf1,0x07,0x10,0xdf,0xfa,0x01,0x02,0xd3,0x2b,0x23,0x0a,0xff,0xfe,0x38,0x01,
-0x0d,0x02,0x02,0xe6,0x2b,0x12,0x0a,0x07,0x10,0x25,0xcf,0xf5,0xc4,0x2c,0x12,0x07,
-0x29,0x4b,0x11,0x9f,0x13,0x10,0x36,0x08,0xfe,0xa2,0x22,0x09,0x0f,0x06,0x00,0x07,
-0x00,0xf1,0x32,0x11,0xaf,0x82,0x1a,0x11,0xaf,0x12,0x38,0x11,0xaf,0x15,0x33,0x11,
-0xaf,0x39,0x33,0x11,0xaf,0x39,0x33,0x11,0xaf,0x12,0x38,0x06,0x0c,0x00,0x23,0xef,
-0xf8,0x24,0x00,0x01,0xe3,0x05,0x03,0x3c,0x00,0x02,0x48,0x00,0x0f,0x6c,0x00,0x0a,
-0x21,0x01,0xcf,0xaa,0x1c,0x20,0x5f,0xfc,0xb9,0x1c,0x09,0xb7,0x1c,0x0f,0xb2,0x30,
-0x62,0x01,0xba,0x2c,0x01,0x8f,0x0a,0x00,0x06,0x0e,0x0a,0x6b,0x20,0x0f,0x4b,0x1d,
-0x85,0x11,0x9f,0x20,0x0b,0x00,0x44,0x0d,0x02,0xdf,0x27,0x0f,0x53,0x0c,0x4b,0x00,
-0xee,0x3a,0x11,0x02,0x04,0x4a,0x52,0x0c,0xfd,0x21,0xaf,0xf0,0x67,0x02,0x12,0xff,
-0x33,0x22,0x3f,0x3a,0xde,0xb4,0x28,0x1f,0x8a,0x31,0x8f,0xe2,0x03,0x7a,0x3d,0x01,
-0xfa,0x23,0x4c,0x02,0xae,0xfd,0x92,0xda,0x01,0x0f,0xcd,0x0f,0x43,0x0f,0xb7,0x1e,
-0x7f,0x03,0xd3,0x2e,0x03,0xe4,0x50,0x01,0x88,0x01,0x14,0x83,0x44,0x2b,0x03,0xf5,
-0x02,0x3f,0x4d,0xfd,0x20,0x40,0x02,0x38,0x00,0xdb,0x2c,0x42,0x4b,0xff,0xc4,0x8f,
-0xdd,0x4d,0x11,0xf8,0x1d,0x27,0x12,0xfd,0x4d,0x03,0x21,0xd3,0x20,0xfa,0x00,0x11,
-0xf9,0xad,0x18,0x00,0x4c,0x2d,0x01,0xfa,0x0b,0x00,0xb5,0x00,0x02,0xdf,0x31,0x02,
-0x04,0x1e,0x07,0x33,0x05,0x0f,0xeb,0x49,0x65,0x04,0x01,0x13,0x22,0x01,0xef,0xd1,
-0x50,0x1a,0x60,0x5e,0x19,0x0f,0xf9,0x3c,0x3c,0x00,0xa0,0x53,0x01,0x06,0x13,0x02,
-0x83,0x2a,0x10,0x53,0x0f,0x00,0x20,0x28,0x84,0x3a,0x15,0x0f,0x06,0x01,0x6d,0x21,
-0x4f,0xfb,0x75,0x08,0x60,0xef,0xc1,0x00,0x00,0x8f,0xf5,0x99,0x1e,0x20,0x44,0x20,
-0x03,0x00,0x0f,0x06,0x01,0x42,0x46,0x03,0xee,0x40,0x00,0xd6,0x06,0x04,0xb9,0x25,
-0x2f,0x12,0x00,0x0c,0x02,0x6f,0x26,0x1d,0xf7,0xda,0x50,0x02,0x6b,0x34,0x2f,0x01,
-0x20,0x0c,0x02,0x44,0x50,0x2e,0xfc,0x10,0xbf,0xf5,0xa4,0x03,0x11,0xcb,0x74,0x02,
-0x12,0x4f,0xf0,0x07,0x3a,0x05,0xdd,0x70,0x06,0x01,0x01,0x2a,0x28,0x00,0x32,0x0a,
-0x02,0x06,0x01,0x10,0xc0,0x06,0x01,0x31,0x19,0xff,0xf6,0x06,0x01,0x21,0xdf,0xfb,
-0x06,0x01,0x2f,0x58,0x87,0x06,0x01,0x15,0x26,0xae,0xec,0x06,0x01,0x00,0x4c,0x01,
-0x08,0x06,0x01,0x15,0xfa,0x06,0x01,0x30,0xcf,0xe2,0x08,0xcd,0x3c,0x31,0xfe,0x9f,
-0xf6,0x30,0x1b,0x01,0xe2,0x21,0x1f,0x53,0x06,0x01,0x43,0x50,0x1d,0xfd,0x10,0x9f,
-0xf6,0x13,0x22,0x11,0xda,0xc2,0x07,0x12,0x1d,0xb5,0x12,0x09,0x38,0x1c,0x0f,0x8c,
-0x4d,0x64,0x03,0x94,0x3b,0x01,0x9c,0x02,0x00,0xd7,0x3b,0x01,0x9e,0x01,0x00,0x75,
-0x40,0x12,0x20,0x11,0x00,0x23,0xaf,0xc0,0x11,0x00,0x23,0xb2,0x00,0xaf,0x40,0x14,
-0x00,0x70,0x40,0x12,0x00,0xb3,0x40,0x23,0x00,0x00,0xb5,0x40,0x00,0x87,0x00,0x02,
-0x5f,0x1a,0x02,0xb9,0x40,0x11,0x30,0xf4,0x0e,0x03,0x11,0x00,0x01,0xbd,0x40,0x01,
-0xac,0x55,0x01,0x11,0x00,0x03,0xc1,0x40,0x23,0x00,0x00,0xc3,0x40,0x06,0x55,0x00,
-0x03,0xc7,0x40,0x0f,0xe6,0x1f,0x78,0x04,0xb5,0x3c,0x52,0x02,0x25,0xff,0xf5,0x20,
-0x21,0x25,0x13,0xff,0x98,0x00,0x15,0xf0,0x1e,0x00,0x03,0x1c,0x01,0x03,0xc6,0x00,
-0x03,0x1a,0x01,0x04,0x19,0x01,0x03,0x18,0x01,0x03,0x17,0x01,0x04,0x16,0x01,0x04,
-0x15,0x01,0x03,0x14,0x01,0x04,0x13,0x01,0x04,0x12,0x01,0x04,0x11,0x01,0x03,0x10,
-0x01,0x11,0x8f,0xb6,0x01,0x23,0x9f,0xff,0xe9,0x46,0x0f,0x55,0x24,0x5c,0x11,0xaf,
-0x7e,0x00,0x12,0x09,0x56,0x33,0x0a,0xdc,0x53,0x0f,0x70,0x42,0x41,0x90,0x48,0x60,
-0x00,0x78,0x30,0x00,0x7f,0xf4,0x05,0xc0,0x59,0x01,0xcf,0x0f,0x4f,0x01,0x8d,0xec,
-0x70,0xf3,0x00,0x5b,0x20,0x9f,0xe1,0x60,0x2e,0x10,0x03,0x21,0x5c,0x00,0x0e,0x04,
-0x15,0xfd,0xd0,0x2e,0x0f,0x1b,0x15,0x4a,0x26,0x0b,0xfa,0x22,0x12,0x12,0x1e,0x65,
-0x08,0x1f,0x20,0x41,0x26,0x5d,0x22,0x0c,0xf9,0x92,0x21,0x11,0xf0,0xaf,0x27,0x12,
-0xfc,0x05,0x0b,0x0f,0xf9,0x00,0x4b,0x0f,0x1c,0x27,0x56,0x21,0x5f,0xf7,0x2d,0x06,
-0x02,0xf9,0x57,0x12,0x93,0x34,0x0d,0x10,0x30,0xe7,0x18,0x23,0xfd,0x30,0x12,0x14,
-0x00,0x8a,0x02,0x10,0xf9,0x17,0x00,0x30,0xde,0xff,0xf6,0xf5,0x11,0x60,0x09,0xff,
-0xd0,0x0d,0xff,0x90,0x48,0x4a,0x00,0xbe,0x02,0x38,0xff,0xf4,0x2f,0xdf,0x00,0x01,
-0x81,0x5a,0x02,0x25,0x0b,0x82,0x05,0x00,0x05,0xff,0xfc,0x53,0x5c,0xf6,0xa6,0x28,
-0x01,0x18,0x1a,0x00,0x30,0x28,0x32,0x01,0x6d,0xff,0xe2,0x55,0x11,0x60,0xd9,0x01,
-0x22,0xf7,0x40,0x20,0x49,0x11,0x10,0x8b,0x34,0xb0,0xc1,0x00,0x00,0xaf,0xf4,0x05,
-0xff,0xa0,0x00,0x0a,0xff,0x7c,0x3d,0x00,0xf5,0x42,0x00,0x2a,0x08,0x1f,0x86,0xde,
-0x03,0x5d,0x20,0xf3,0x06,0x67,0x0f,0x21,0xaf,0xf9,0x07,0x06,0x12,0x9f,0xab,0x00,
-0x2f,0x55,0x30,0xeb,0x02,0x4c,0x01,0x74,0x00,0x01,0xb8,0x40,0x11,0x90,0x33,0x0a,
-0x10,0x63,0x16,0x34,0x10,0x01,0xa1,0x0d,0x07,0x7a,0x00,0x40,0x17,0xce,0xfe,0xb6,
-0xb2,0x3c,0x01,0x67,0x5b,0x02,0x50,0x22,0x00,0xce,0x40,0x00,0x52,0x5e,0x11,0xf7,
-0xaa,0x22,0x10,0x0b,0xd6,0x4a,0x00,0x2b,0x32,0x23,0x87,0x0c,0x1e,0x3b,0x03,0x23,
-0x38,0x00,0x66,0x04,0x00,0x57,0x53,0x21,0xdf,0xfb,0x05,0x0c,0x00,0x1e,0x00,0x41,
-0x69,0x9c,0xff,0xf0,0x2d,0x00,0x00,0x61,0x50,0x11,0xf7,0xad,0x1d,0x30,0x0d,0xff,
-0xf7,0x1e,0x36,0x00,0x5a,0x00,0x10,0xde,0xea,0x03,0x00,0x1f,0x0d,0x00,0x35,0x5f,
-0x50,0x16,0xce,0xfe,0xd9,0x40,0x36,0x21,0x01,0x6f,0x13,0x11,0x3e,0x58,0x1c,0x21,
-0x4f,0xf9,0x58,0x1c,0x18,0x44,0xab,0x18,0x40,0x5c,0xff,0xb3,0xbf,0x27,0x02,0x00,
-0x0b,0x0e,0x10,0x4f,0x9e,0x59,0x40,0xf6,0x0b,0xff,0xf3,0xe4,0x4c,0x22,0xff,0xf9,
-0xc2,0x46,0x11,0x50,0xc2,0x46,0x12,0xf3,0x0d,0x00,0x10,0x40,0xa1,0x36,0x00,0x15,
-0x0b,0x05,0x27,0x00,0x02,0x34,0x00,0x02,0x0a,0x2b,0x10,0x60,0x4e,0x00,0x13,0xff,
-0x82,0x07,0x30,0x40,0x06,0xb1,0x2e,0x1f,0x82,0x02,0xff,0xfb,0xbe,0xff,0xf8,0x00,
-0x1c,0xba,0x08,0x21,0x06,0xbe,0x13,0x07,0x10,0x0d,0xb6,0x61,0x00,0x2f,0x02,0x42,
-0xe2,0x1b,0xfe,0x00,0x5f,0x1e,0x01,0xe1,0x4a,0x4f,0xae,0xec,0x40,0x00,0x3b,0x01,
-0x76,0x50,0x8f,0xe0,0x00,0xef,0x80,0x11,0x60,0x02,0xc6,0x5f,0x01,0xd5,0x10,0x4f,
-0x08,0xde,0xd7,0x00,0x3b,0x01,0x6b,0x42,0x00,0x02,0xde,0x50,0xcd,0x0f,0x13,0xfd,
-0x31,0x15,0x2b,0x80,0x00,0x00,0x0b,0x0f,0x76,0x02,0x70,0x22,0x0a,0xfa,0xd8,0x0e,
-0x11,0xf2,0x53,0x00,0x1d,0xfd,0x82,0x05,0x0f,0x3b,0x01,0x62,0x0f,0xea,0x56,0x6c,
-0x06,0x01,0x00,0x22,0xbf,0xc0,0xa0,0x11,0x03,0x62,0x2f,0x12,0xef,0x19,0x08,0x22,
-0x5f,0xf1,0x27,0x01,0x04,0xd5,0x0e,0x14,0x21,0x17,0x5b,0x01,0x83,0x0e,0x11,0x20,
-0xa7,0x05,0x14,0xe0,0x17,0x3e,0x00,0x37,0x00,0x1c,0xc0,0xd1,0x07,0x0f,0x95,0x4a,
-0x61,0x11,0x00,0x5d,0x3d,0x02,0xc5,0x03,0x11,0xd1,0x1b,0x39,0x20,0xb1,0xbf,0x08,
-0x00,0x07,0x30,0x2d,0x03,0x55,0x22,0x1f,0x01,0xa2,0x57,0x1e,0x03,0xde,0x57,0x03,
-0xed,0x57,0x00,0xf7,0x05,0x3f,0xdf,0xff,0x67,0x4b,0x00,0x21,0x50,0x00,0x01,0x78,
-0x30,0x00,0x76,0x22,0x11,0xe3,0xc4,0x0c,0x86,0xfe,0x30,0x00,0x1d,0xfc,0x10,0x9f,
-0xe3,0x74,0x16,0x0f,0x58,0x4b,0x56,0x01,0x00,0x4f,0x00,0xa0,0x3b,0x04,0x09,0x00,
-0x00,0x96,0x24,0x64,0x11,0x11,0x11,0xef,0xf9,0x10,0x9f,0x40,0x15,0xf0,0x09,0x00,
-0x0e,0x2d,0x00,0x03,0x17,0x20,0x09,0x09,0x00,0x10,0xfe,0xfd,0x58,0x09,0x24,0x00,
-0x0f,0x09,0x00,0x21,0x00,0xf1,0x16,0x00,0xdd,0x0f,0x51,0x8f,0xff,0x22,0x10,0x00,
-0x2f,0x0b,0x15,0x90,0x07,0x00,0x02,0x1c,0x00,0x00,0x07,0x00,0x50,0x19,0xef,0xd8,
-0x00,0x00,0x1d,0x45,0x00,0x6a,0x65,0x00,0x84,0x03,0x30,0xf2,0x00,0x6f,0xe8,0x47,
-0x11,0xf6,0x23,0x00,0x21,0xef,0xf8,0x07,0x00,0x1f,0xdf,0x07,0x00,0x1f,0x50,0x09,
-0xed,0x71,0x4f,0xd7,0x44,0x15,0x55,0xdf,0x63,0x9f,0xfb,0x02,0xf4,0x1a,0x0f,0xd5,
-0x2d,0x38,0x00,0x59,0x2a,0x31,0x07,0xf9,0x0a,0xf4,0x08,0x65,0xf4,0x4b,0xff,0x90,
-0x02,0x20,0xff,0x21,0x0f,0xff,0x1d,0x2d,0x00,0xa9,0x02,0x14,0x88,0xe2,0x5e,0x1f,
-0x00,0x2f,0x2e,0x3e,0x00,0x11,0x15,0x12,0x5b,0x79,0x08,0x06,0x95,0x5e,0x03,0x7f,
-0x00,0x0f,0x09,0x00,0x1e,0xb0,0x48,0x70,0x00,0x78,0x46,0xff,0x50,0x5f,0xf6,0x0d,
-0xff,0x39,0x54,0x2f,0xce,0xc8,0x69,0x01,0x3f,0xa0,0xbf,0xb0,0x02,0xff,0x57,0xff,
-0x40,0x9f,0xf1,0x1d,0x02,0x10,0x37,0x19,0xde,0xc5,0x66,0x01,0x0f,0xb9,0x00,0x21,
-0x00,0x55,0x00,0x0f,0x03,0x00,0x1d,0xf3,0x01,0x0c,0xfc,0x10,0x8f,0xe0,0x00,0xbf,
-0xe3,0x20,0x8f,0xff,0xa0,0x09,0xee,0x80,0x03,0xde,0x61,0x11,0xd0,0x9d,0x4e,0x00,
-0x67,0x4e,0x0f,0x03,0x00,0x0e,0x50,0x09,0xff,0xe0,0x2e,0xf9,0xaa,0x05,0xf2,0x03,
-0xef,0xc3,0x10,0xbf,0xff,0x70,0x2b,0xfe,0x50,0x0a,0xfa,0x03,0xff,0xf2,0x0e,0xfd,
-0x00,0x02,0x30,0x01,0x0f,0x39,0x5c,0x15,0x2f,0x6f,0xff,0x02,0x00,0x05,0x05,0x53,
-0x5c,0x0f,0x09,0x00,0x53,0x01,0x77,0x5c,0x50,0xfc,0x4f,0xff,0x40,0x5f,0x1a,0x56,
-0x50,0xf9,0x4f,0xff,0x40,0x0e,0x31,0x24,0x41,0xf2,0x4f,0xff,0x40,0xc1,0x16,0x10,
-0x50,0x2d,0x00,0x01,0x83,0x5c,0xd0,0x3d,0xf7,0x00,0x0b,0xfb,0x0a,0xff,0xf0,0x05,
-0xff,0xf5,0x8f,0xfd,0x26,0x12,0x54,0x67,0x10,0x00,0x47,0x30,0xd6,0x4f,0x40,0x02,
-0xff,0xf4,0x8f,0x46,0x55,0x1f,0x48,0x0b,0x00,0x29,0x04,0x78,0x12,0x01,0xe7,0x57,
-0x31,0xad,0xff,0xfe,0x1d,0x46,0x10,0x60,0x25,0x54,0x12,0x50,0x39,0x0c,0x13,0xf8,
-0xb2,0x18,0x11,0xf8,0xc0,0x00,0x30,0xf4,0x4f,0xf8,0x00,0x1e,0x18,0x83,0x82,0x15,
-0x15,0x00,0x1b,0x30,0x2f,0x9f,0xfe,0x0f,0x00,0x32,0x02,0x9e,0x5d,0x01,0xe4,0x18,
-0x00,0x23,0x52,0x02,0xa1,0x5d,0x00,0x28,0x18,0x10,0xfe,0x95,0x1a,0x03,0xe1,0x0f,
-0x00,0x30,0x10,0x21,0xd9,0x20,0x5f,0x0e,0x10,0xb0,0xa3,0x22,0xc4,0xfb,0x00,0x08,
-0xff,0x51,0xcf,0xc1,0x15,0x53,0x00,0x05,0x52,0xce,0x17,0x1f,0xf2,0x05,0x00,0x2b,
-0x10,0x04,0x33,0x1b,0x10,0x08,0x6c,0x6c,0x00,0x6e,0x29,0x20,0x0e,0xff,0x5e,0x6a,
-0x00,0x3a,0x1c,0x0f,0x1a,0x5e,0x6d,0x01,0x3e,0x04,0x02,0xbb,0x40,0x03,0xc8,0x08,
-0x12,0xb0,0x33,0x0a,0x19,0xf6,0xaa,0x49,0x02,0xfe,0x6c,0x0f,0xb8,0x51,0x62,0x48,
-0x00,0x00,0x58,0x60,0xde,0x18,0x24,0xb0,0x00,0x2d,0x6a,0x36,0x00,0x04,0xfd,0xb4,
-0x48,0x01,0xc2,0x66,0x41,0xff,0x37,0xff,0xe0,0xde,0x00,0x30,0xfe,0x00,0x6f,0xec,
-0x00,0x83,0xe0,0x1f,0xff,0xf1,0x00,0x7f,0xfe,0x0b,0xca,0x66,0x12,0xfa,0x34,0x01,
-0x14,0x40,0xb0,0x49,0x70,0x7f,0xfe,0x49,0xff,0xf9,0x00,0x07,0x1b,0x30,0x10,0xf4,
-0x41,0x00,0x10,0x4f,0x7f,0x5b,0x70,0xe0,0x00,0x9f,0xff,0xa0,0x7f,0xfe,0x88,0x01,
-0x60,0x50,0x00,0x1a,0xaa,0x40,0x00,0x91,0x1d,0x05,0xf0,0x45,0x26,0x0e,0xfd,0x61,
-0x28,0x0f,0x56,0x5f,0x53,0x50,0x00,0x3a,0xaa,0x20,0x0d,0xdc,0x0e,0x44,0xa0,0x02,
-0xff,0xb0,0x85,0x53,0x2f,0x8f,0xfe,0x07,0x00,0x26,0x0f,0xb7,0x00,0x55,0x13,0x00,
-0xa3,0x1b,0x16,0xf4,0x43,0x4a,0x21,0x6f,0xf0,0xc2,0x01,0x11,0x90,0x50,0x31,0x3f,
-0x10,0x00,0x00,0x93,0x53,0x11,0xc0,0x00,0x00,0x0f,0xf6,0x1f,0xf5,0x4f,0xf2,0xaf,
-0xb0,0x4c,0x20,0x5b,0x5d,0x10,0xfa,0x72,0x00,0x20,0x0e,0xf9,0x06,0x00,0x20,0x1f,
-0xf5,0x06,0x00,0x11,0x7f,0x6c,0x5d,0x2f,0x2b,0x40,0xba,0x00,0x36,0xf1,0x07,0x8f,
-0xfe,0x05,0xff,0x28,0xff,0xe0,0x5f,0xf1,0x8f,0xfe,0x08,0xfd,0x08,0xff,0xe0,0xef,
-0x70,0x8f,0xfe,0x06,0xb0,0x42,0x67,0x00,0x8f,0x00,0x0f,0x09,0x00,0x1f,0x0f,0x87,
-0x00,0x0e,0x11,0x02,0x06,0x00,0x11,0xbf,0xa5,0x03,0x21,0xff,0xf5,0xf6,0x03,0x1f,
-0xc1,0xb7,0x00,0x20,0x0f,0x8a,0x00,0x0d,0xff,0x00,0x7f,0xd1,0x8f,0xfe,0x0f,0xff,
-0x68,0xff,0xe0,0xaf,0xf3,0x8f,0xfe,0x00,0x21,0xb7,0x00,0x0d,0x00,0x64,0x0b,0x05,
-0xe9,0x59,0x0f,0x0d,0x00,0x09,0x22,0xfb,0xcf,0x90,0x70,0x10,0xd0,0x5d,0x0a,0x6f,
-0xfa,0x20,0x00,0x00,0x08,0xaf,0x34,0x00,0x0e,0x00,0xe1,0x0a,0x21,0xc0,0x1f,0x29,
-0x44,0x21,0x01,0xff,0xf1,0x70,0x30,0x01,0xff,0xf4,0xa2,0x6c,0x0d,0x07,0x00,0xce,
-0x10,0x1f,0xff,0xdf,0x17,0xff,0xff,0xda,0xff,0xff,0x60,0x89,0x23,0x00,0x05,0x07,
-0x00,0x01,0x24,0x2a,0x12,0xa6,0x61,0x06,0x09,0xea,0x2f,0x3f,0x0c,0xfe,0x20,0xf9,
-0x36,0x77,0x03,0x43,0x5b,0x02,0xfa,0x23,0x2b,0x2f,0xfd,0xfa,0x23,0x0f,0xd9,0x27,
-0x3a,0x0f,0xec,0x62,0x6f,0x29,0x00,0x00,0x53,0x06,0x23,0x0c,0xfa,0x6b,0x4c,0x0a,
-0x1b,0x0f,0x1f,0xb7,0xd4,0x28,0x40,0x04,0x2d,0x45,0x11,0xf0,0x0e,0x08,0x11,0xe0,
-0x85,0x00,0x12,0xa0,0x87,0x4d,0x00,0x7e,0x02,0x12,0x9a,0x1e,0x08,0x31,0x50,0x4f,
-0xfb,0x08,0x00,0x36,0x8f,0xfa,0x00,0x31,0x1f,0x07,0xe9,0x14,0x0f,0x30,0x02,0x6f,
-0x40,0x05,0xff,0x80,0x2e,0xf4,0x35,0x34,0xf9,0xef,0xc1,0xb9,0x6b,0x3f,0x00,0x35,
-0x50,0x30,0x02,0x43,0x32,0x06,0xff,0x10,0xd6,0x06,0x18,0xf0,0x6a,0x47,0x32,0x01,
-0xff,0x50,0x16,0x01,0x18,0xa0,0x75,0x00,0x00,0xda,0x09,0x13,0xcf,0x8e,0x73,0x00,
-0x78,0x00,0x00,0x55,0x1a,0x00,0x5c,0x55,0x13,0x00,0x80,0x01,0x00,0x4f,0x5b,0x00,
-0x89,0x1c,0x0f,0x0f,0x00,0x20,0x30,0x8f,0xff,0x50,0x47,0x0a,0x31,0x68,0xff,0xfe,
-0x35,0x1c,0x01,0x2d,0x0a,0x10,0x2f,0xad,0x62,0x12,0xf2,0x0f,0x00,0x01,0x15,0x08,
-0x10,0x68,0xf3,0x00,0x01,0x0f,0x00,0x21,0x7f,0xfd,0x0f,0x00,0x31,0xf0,0xcf,0xf8,
-0x0f,0x00,0x31,0x03,0xff,0xf2,0x0f,0x00,0x30,0x09,0xff,0xb2,0x0f,0x00,0x61,0x00,
-0x1e,0xff,0x7f,0xff,0x68,0x84,0x2c,0x01,0x0f,0x00,0x00,0xb7,0x02,0x12,0x68,0xdd,
-0x21,0x01,0x0f,0x00,0x12,0x0a,0x0f,0x00,0x22,0x00,0x1f,0x0f,0x00,0x03,0x94,0x5f,
-0x03,0x0a,0x5f,0x00,0x0f,0x00,0x01,0xca,0x4e,0x32,0xef,0xff,0xe0,0x03,0x48,0x12,
-0xf5,0xe5,0x08,0x70,0xb4,0x00,0xbf,0xf7,0x1a,0xef,0xc5,0x5c,0x72,0x41,0xff,0xff,
-0x50,0xbf,0x3a,0x70,0x20,0xbf,0xfd,0x7a,0x01,0x20,0xbf,0xfa,0x36,0x1b,0x20,0xbf,
-0xfa,0x05,0x33,0x0f,0x06,0x00,0x17,0x01,0x72,0x00,0x14,0xf3,0x20,0x63,0x11,0x0a,
-0xd5,0x55,0x10,0x0c,0xe0,0x23,0x00,0xf9,0x29,0x01,0x0b,0x00,0x26,0xff,0xf5,0x3e,
-0x39,0x0c,0x01,0x00,0x0f,0x99,0x38,0x6c,0x12,0x4f,0x78,0x72,0x15,0xff,0x6f,0x51,
-0x1f,0x00,0x6b,0x2a,0x4a,0x22,0x0b,0xfb,0x52,0x08,0x51,0x8f,0xf3,0x09,0xff,0x10,
-0x2c,0x03,0x02,0xd8,0x40,0x3f,0x9e,0xec,0x60,0x4b,0x3a,0x77,0x30,0x3f,0xf6,0x01,
-0xa7,0x0a,0x12,0xcf,0xb8,0x01,0x3c,0x8d,0xfe,0xb3,0xb4,0x01,0x0f,0xde,0x2c,0x41,
-0x00,0xcc,0x21,0x20,0xdf,0xe2,0xb2,0x03,0x21,0xb0,0xaf,0xbc,0x1e,0x11,0xe1,0x16,
-0x50,0x4f,0x18,0x83,0x08,0x85,0xaf,0x3c,0x78,0x91,0x0e,0xfe,0x17,0xff,0x80,0x00,
-0x09,0xff,0x33,0xad,0x02,0x20,0x70,0xdf,0xdf,0x0b,0x3f,0x70,0x48,0x81,0x1a,0x01,
-0x4a,0x33,0x02,0x8c,0xef,0x7d,0x13,0x24,0x06,0xff,0x01,0x00,0x52,0x06,0xff,0xff,
-0xdc,0xdf,0x43,0x54,0x00,0x5e,0x02,0x71,0x7f,0xff,0x21,0x11,0x11,0x11,0x7f,0x3f,
-0x0d,0x14,0xf1,0xd7,0x0c,0x00,0x5d,0x0f,0x02,0x58,0x73,0x02,0x15,0x00,0x01,0x3f,
-0x27,0x11,0x7f,0x65,0x37,0x23,0xef,0xf8,0x78,0x0d,0x13,0xfd,0x15,0x00,0x00,0xdd,
-0x1a,0x00,0x1b,0x73,0x04,0x3f,0x00,0x14,0xa0,0x3f,0x00,0x24,0x7f,0xfe,0x15,0x00,
-0x00,0x83,0x5a,0x03,0x15,0x00,0x51,0x06,0xff,0xfd,0x98,0x9c,0xe2,0x6c,0x16,0xd0,
-0x93,0x00,0x07,0xa8,0x00,0x00,0x91,0x0e,0x52,0xc7,0x00,0x3b,0xef,0xea,0xa3,0x0e,
-0x20,0xfd,0x8f,0xfb,0x03,0x00,0xfe,0x1b,0x00,0x17,0x38,0x31,0xff,0xff,0x10,0xb4,
-0x74,0x50,0xff,0xc0,0x01,0xef,0xf7,0x3d,0x05,0x00,0x24,0x63,0x31,0x09,0xff,0xa0,
-0x5d,0x30,0x01,0xd1,0x01,0x00,0xf8,0x21,0x12,0x07,0xb3,0x22,0x20,0xff,0xf7,0x71,
-0x0f,0x42,0x75,0x55,0x55,0x53,0x2a,0x00,0x12,0xf7,0xd8,0x04,0x30,0x40,0x05,0xff,
-0x33,0x5d,0x10,0x60,0x7e,0x30,0x00,0xc6,0x00,0x35,0xce,0xff,0x10,0x69,0x00,0x10,
-0xf4,0x7e,0x00,0x51,0xd7,0x00,0x3a,0xef,0xfc,0x98,0x0f,0x00,0x36,0x42,0x04,0x0d,
-0x72,0x23,0x00,0x0a,0x2d,0x30,0x07,0x17,0x13,0x0f,0x3d,0x69,0x66,0x01,0x5a,0x31,
-0x10,0xfc,0x47,0x09,0x15,0x10,0x98,0x3b,0x50,0x0b,0xff,0x86,0xdf,0x70,0xbe,0x5d,
-0x10,0x0b,0xd9,0x08,0x00,0xbf,0x5d,0x01,0xca,0x01,0x00,0x9f,0x0e,0x0f,0x09,0x00,
-0x0d,0x0f,0xc8,0x00,0x66,0x04,0x85,0x54,0x12,0xf6,0x2f,0x28,0x12,0xf5,0x6d,0x14,
-0x12,0xf2,0xfb,0x2e,0x12,0xb0,0x61,0x4c,0x05,0xc3,0x0a,0x00,0x9e,0x5e,0x30,0x0b,
-0xff,0xef,0x22,0x5d,0x00,0x39,0x19,0x3f,0xf8,0x21,0x10,0xdc,0x00,0x11,0x26,0xbf,
-0xfb,0x8e,0x0d,0x00,0x1f,0x73,0x02,0x8b,0x0d,0x23,0x0c,0xf9,0x88,0x0d,0x31,0x02,
-0xef,0xb0,0x1b,0x31,0x41,0x2e,0xfc,0xcf,0xf3,0xf6,0x17,0x02,0xae,0x52,0x2f,0x28,
-0x82,0xe6,0x01,0x6e,0x90,0x4f,0xf9,0x01,0xdf,0xd2,0x03,0xef,0xad,0xfc,0x1f,0x44,
-0x00,0x8a,0x1d,0x36,0x33,0x00,0x00,0xe9,0x01,0x01,0x09,0x01,0x01,0xea,0x01,0x01,
-0x0a,0x01,0x01,0xeb,0x00,0x0f,0x05,0x00,0x15,0x01,0xd4,0x02,0x02,0x37,0x29,0x02,
-0xfa,0x21,0x22,0x4f,0xfb,0x0c,0x5c,0x07,0x8a,0x3a,0x0f,0xa0,0x6b,0x63,0x01,0x6e,
-0x01,0x00,0xe0,0x64,0x03,0xed,0x79,0x10,0x50,0x2d,0x57,0x16,0xa6,0x94,0x0a,0x0f,
-0x6b,0x60,0x39,0x00,0x3b,0x19,0x12,0xe2,0x79,0x57,0x20,0xfe,0x20,0xe2,0x54,0x10,
-0xc1,0xf9,0x5b,0x29,0x06,0x87,0x06,0x0b,0x0f,0x06,0x01,0x64,0x21,0x5f,0xfa,0x82,
-0x0b,0x10,0xef,0x29,0x4f,0x58,0xf5,0x1c,0xfc,0x10,0x01,0x16,0x29,0x0f,0x06,0x01,
-0x3c,0x0f,0xe3,0x00,0x5e,0x12,0xff,0xe9,0x01,0x22,0xcf,0xe6,0x26,0x2d,0x02,0xd9,
-0x09,0x03,0xa2,0x2a,0x12,0x9f,0x24,0x3e,0x21,0x8e,0xa3,0xe8,0x00,0x2f,0xfd,0x92,
-0xe8,0x00,0x04,0x2e,0x11,0x10,0xe8,0x00,0x28,0x13,0x33,0xe8,0x00,0x26,0xd7,0x6b,
-0xe8,0x00,0x40,0xdf,0xff,0xa3,0x00,0xad,0x59,0x10,0x20,0x9b,0x33,0x22,0xff,0xe0,
-0xa7,0x5b,0x01,0xca,0x07,0x01,0xd7,0x12,0x20,0xd8,0x10,0xb6,0x03,0x21,0x60,0x3f,
-0x40,0x58,0x11,0xf9,0xf6,0x1b,0x12,0x0c,0xc7,0x2f,0x3a,0x01,0xcf,0xe2,0x12,0x03,
-0x22,0x81,0x00,0x1b,0x1e,0x31,0x50,0x01,0xef,0x52,0x26,0x30,0x07,0xff,0xf7,0x9c,
-0x0c,0x01,0x29,0x01,0x33,0x7b,0xb9,0x08,0x23,0x80,0x0f,0x29,0x01,0x0f,0x01,0x5c,
-0x13,0x00,0x29,0x01,0x10,0x90,0x29,0x01,0x12,0x0b,0x29,0x01,0x13,0x02,0x29,0x01,
-0x18,0x3d,0x0c,0x02,0xb6,0x01,0xcf,0xd1,0x09,0xff,0x60,0x00,0x1c,0xfe,0xaf,0xf5,
-0x16,0x29,0x1f,0x52,0x12,0x03,0x43,0x0f,0x1e,0x6f,0x6c,0x00,0x92,0x01,0x21,0xfc,
-0x20,0x9e,0x04,0x13,0x7e,0x91,0x0d,0x01,0x4e,0x81,0x05,0x69,0x2e,0x11,0x0c,0xa9,
-0x16,0x22,0x88,0x82,0xde,0x29,0x01,0xff,0x63,0x10,0x0f,0x1c,0x08,0x00,0x42,0x56,
-0x00,0x33,0x01,0x01,0x29,0x64,0x09,0x1b,0x00,0x0c,0x09,0x00,0x12,0x70,0x2d,0x64,
-0x10,0x07,0xc7,0x0b,0x30,0x08,0xff,0xf8,0x69,0x03,0x50,0x20,0x00,0x02,0x7f,0xfd,
-0x4e,0x0b,0x30,0xf0,0x00,0x02,0xaf,0x09,0x20,0x1f,0xd7,0x59,0x42,0x31,0x30,0x6f,
-0xf9,0x81,0x04,0x22,0x9f,0xf8,0x72,0x05,0x12,0xf7,0x6e,0x01,0x07,0x4f,0x0a,0x13,
-0x08,0x26,0x01,0x13,0x8f,0xd7,0x1d,0x00,0x2f,0x30,0x3f,0xee,0xee,0xe5,0x26,0x01,
-0x51,0x02,0x0f,0x00,0x00,0x83,0x00,0x04,0xbd,0x16,0x22,0x0b,0xfb,0x3f,0x07,0x42,
-0xff,0xf5,0x2c,0xc0,0x27,0x7d,0x00,0x05,0x00,0x00,0x19,0x01,0x02,0x05,0x00,0x01,
-0x1a,0x01,0x06,0x19,0x00,0x0f,0x05,0x00,0x03,0x22,0xf7,0x00,0x1e,0x01,0x01,0x4c,
-0x65,0x00,0x4d,0x65,0x0f,0x11,0x02,0x1c,0x11,0x0e,0x41,0x09,0x01,0xf5,0x32,0x00,
-0xa7,0x02,0x5f,0x02,0x27,0xff,0xf4,0x20,0xeb,0x00,0x2c,0x0f,0xe8,0x01,0x0b,0x10,
-0x05,0xbf,0x09,0x10,0x5f,0x94,0x0a,0x48,0x22,0xff,0xf7,0x22,0x2d,0x00,0x10,0x80,
-0xca,0x00,0x30,0xd9,0x00,0x06,0xe8,0x01,0x92,0x06,0xdf,0xe8,0x00,0x05,0xde,0x92,
-0x1d,0xf2,0x23,0x2a,0x00,0x95,0x14,0x41,0xa2,0x7e,0xfe,0x30,0xf9,0x2d,0x1f,0x10,
-0xd2,0x44,0x6e,0x30,0x7e,0xe8,0x12,0x0b,0x08,0x00,0x8b,0x0c,0x3c,0x09,0xf8,0x38,
-0xef,0x3a,0x0f,0x3e,0x36,0x3b,0x03,0xff,0x00,0x03,0x07,0x00,0x09,0x01,0x00,0x0f,
-0xff,0x00,0x64,0x02,0x22,0x0f,0x02,0xff,0x00,0x09,0x15,0x35,0x0f,0xf9,0x00,0x3c,
-0x11,0xf4,0x0a,0x13,0x51,0x0e,0xfb,0x12,0xef,0xa0,0xe1,0x26,0x01,0x18,0x15,0x3f,
-0x4c,0xee,0xa2,0x00,0x01,0x6c,0x00,0x32,0x59,0x21,0x1d,0xfb,0x9b,0x11,0x13,0xf4,
-0x3a,0x80,0x0f,0x06,0x01,0x48,0x41,0x00,0x08,0xed,0x50,0x29,0x5a,0x11,0x46,0x92,
-0x18,0x21,0xba,0x00,0x81,0x07,0x32,0x8d,0x13,0xf4,0xe3,0x04,0x15,0x80,0x44,0x42,
-0x0f,0x0c,0x03,0x65,0x30,0x01,0xae,0xd5,0x8a,0x00,0x30,0xc3,0x6f,0x20,0x0d,0x59,
-0x11,0x3f,0x29,0x62,0x19,0xf8,0xd1,0x5a,0x0f,0x13,0x01,0x3e,0x31,0x0d,0xff,0x25,
-0xb0,0x0e,0x30,0xf5,0x2f,0xfb,0xae,0x00,0xaf,0x80,0xcf,0xd0,0x00,0x00,0x04,0x88,
-0x03,0x88,0x10,0x18,0x04,0x6c,0x00,0xa6,0x50,0x21,0x7f,0xf7,0x2d,0x10,0xcf,0x90,
-0x00,0x3f,0xf6,0x1e,0xfb,0x00,0x00,0x68,0x70,0x48,0x80,0x06,0x01,0x42,0x0f,0xe3,
-0x00,0x48,0x18,0x2f,0xe3,0x00,0x11,0x70,0xe3,0x00,0x11,0xf9,0xe3,0x00,0x02,0x78,
-0x5c,0x22,0x4f,0xf3,0x61,0x0d,0x22,0xf5,0x30,0x65,0x22,0x11,0xe0,0x65,0x07,0x2f,
-0xef,0xb0,0xe1,0x00,0x33,0x10,0xfd,0xe1,0x00,0x41,0xfd,0x82,0xff,0xf2,0xf4,0x48,
-0x01,0xd2,0x56,0x02,0x6e,0x86,0x25,0xf4,0x30,0x6e,0x00,0x12,0x07,0xe3,0x67,0x15,
-0x1d,0x29,0x19,0x02,0x0d,0x0c,0x02,0x29,0x54,0x13,0x1a,0x0b,0x00,0x0b,0x14,0x0c,
-0x03,0x01,0x26,0x01,0x27,0x88,0x31,0xff,0xf7,0x4f,0x23,0x30,0x10,0x50,0x4d,0x30,
-0x01,0x18,0x76,0x10,0xf9,0xa9,0x2d,0x00,0xa1,0x2c,0x30,0xcf,0xff,0xd0,0xd5,0x28,
-0x20,0x9f,0xfc,0x48,0x3a,0x20,0x00,0x0b,0x7e,0x1f,0x20,0xf0,0x04,0xe9,0x03,0xa0,
-0xef,0xf6,0x00,0x2f,0xff,0x20,0x7f,0xf9,0xff,0x80,0x3f,0x6c,0x90,0xef,0xf5,0x0b,
-0xff,0x1f,0xfb,0x04,0xff,0xe0,0x83,0x03,0x60,0xff,0xc0,0xcf,0xf0,0x7f,0xfb,0x39,
-0x8a,0xf0,0x02,0x2f,0xf9,0x08,0xff,0x3a,0xff,0x70,0x00,0x04,0xff,0xe6,0xff,0x50,
-0x4f,0xf6,0xdf,0xf4,0xd7,0x06,0x41,0xcf,0xf1,0x00,0xff,0x7b,0x37,0x00,0xc5,0x76,
-0x11,0x0c,0x76,0x1a,0x10,0x09,0x98,0x17,0x31,0x8f,0xff,0xf9,0x70,0x0a,0x13,0xf5,
-0xa6,0x3a,0x20,0x02,0xff,0x5e,0x7c,0x03,0xe5,0x74,0x15,0xd0,0x40,0x09,0x02,0x50,
-0x0d,0x00,0xf8,0x0c,0x12,0xdf,0xd0,0x08,0x22,0x3e,0xfb,0x50,0x63,0x58,0x00,0x12,
-0x20,0x00,0x12,0x71,0x29,0x0f,0xab,0x6c,0x61,0x00,0x78,0x00,0x22,0xac,0x90,0xc7,
-0x3b,0x21,0xff,0xa0,0xa7,0x00,0x11,0xd4,0x98,0x60,0x5f,0x9b,0xa1,0x02,0xbb,0x60,
-0xb1,0x4a,0x75,0x02,0x01,0x6c,0x00,0x59,0x21,0x11,0xfb,0x51,0x6a,0x30,0x1c,0xfc,
-0x10,0x85,0x1f,0x2f,0x02,0x21,0x83,0x3d,0x6a,0x00,0xe0,0x8c,0x01,0xb3,0x8d,0x02,
-0x5f,0x55,0x10,0x00,0x8c,0x3e,0x16,0xe6,0x85,0x1a,0x0f,0x44,0x78,0x6c,0x01,0x8a,
-0x4c,0x17,0xa4,0x7b,0x37,0x13,0x4f,0xf2,0x29,0x05,0x48,0x61,0x0f,0x67,0x78,0x65,
-0x01,0x51,0x3f,0x14,0x20,0x84,0x18,0x02,0x50,0x3f,0x13,0x3a,0x65,0x34,0x0f,0x72,
-0x6e,0x3f,0x03,0xff,0x1f,0x03,0xc9,0x31,0x01,0x45,0x8d,0x0a,0x48,0x2c,0x0f,0x06,
-0x01,0x66,0x26,0x3d,0xe5,0x27,0x4e,0x2a,0x5f,0xf8,0x80,0x2d,0x0f,0x06,0x01,0x3c,
-0x22,0x0b,0xff,0x5c,0x0d,0x47,0xbf,0xf9,0xff,0x80,0x5b,0x0d,0x2f,0x78,0x50,0x06,
-0x01,0x6d,0x30,0x01,0xdf,0xd1,0x5e,0x50,0x41,0x1c,0xfd,0xaf,0xe3,0xb8,0x38,0x01,
-0x71,0x37,0x1f,0x31,0x06,0x01,0x44,0x40,0x7d,0xff,0xb0,0xbf,0x17,0x44,0x40,0xfc,
-0x98,0xff,0xf1,0x78,0x01,0x00,0x20,0x04,0x1f,0xaf,0x07,0x00,0x16,0xf1,0x07,0x03,
-0xbd,0x91,0x01,0xff,0xff,0xc0,0x5f,0xff,0xff,0x16,0xff,0xff,0xf1,0x2f,0xff,0xfd,
-0x00,0x5d,0xfc,0x20,0x35,0x71,0x03,0x20,0xfe,0x93,0x7e,0x03,0x00,0xa7,0x89,0x30,
-0x02,0x8d,0xff,0x27,0x5b,0x20,0x03,0x8d,0x72,0x24,0x00,0x77,0x17,0xc0,0x00,0x05,
-0xaf,0xff,0xff,0xa2,0xaf,0xff,0xff,0xe8,0x20,0x6f,0xc1,0x89,0x20,0x06,0xfd,0x36,
-0x51,0x12,0x34,0x93,0x02,0x00,0x89,0x0b,0x11,0x5f,0x90,0x8b,0x0a,0xa4,0x44,0x09,
-0xd6,0x1a,0x24,0x7b,0xe8,0x0b,0x00,0x24,0x49,0xdf,0xdd,0x6e,0x11,0x16,0xcb,0x67,
-0x01,0x29,0x26,0x13,0x8c,0xcd,0x17,0x00,0x6b,0x8b,0x04,0xd9,0x17,0x02,0x0f,0x0e,
-0x04,0x0c,0x00,0x03,0x0a,0x00,0x15,0xaf,0x0c,0x00,0x33,0xd8,0x40,0x0f,0x0c,0x00,
-0x42,0xfb,0x62,0x00,0x00,0x0c,0x00,0x22,0xfe,0x94,0x71,0x01,0x12,0x00,0x4b,0x90,
-0x0f,0x0c,0x00,0x2a,0x34,0x3a,0xdf,0xdf,0x0c,0x00,0x14,0x06,0x84,0x00,0x13,0xf0,
-0xc7,0x70,0x34,0x03,0xad,0xfd,0x0c,0x00,0x10,0xfe,0x1c,0x3a,0x03,0x24,0x00,0x00,
-0xfb,0x76,0x02,0x3c,0x00,0x47,0xef,0xea,0x30,0xef,0x2c,0x0d,0x13,0x6f,0xee,0x91,
-0x03,0x8e,0x3a,0x14,0xa3,0x0c,0x01,0x34,0xb7,0x00,0xbf,0xed,0x65,0x43,0x7b,0xfd,
-0x88,0xef,0x66,0x66,0x10,0x88,0x95,0x11,0x10,0xb4,0x29,0x70,0x11,0x5f,0xf6,0x08,
-0x03,0x56,0x69,0x10,0xf5,0x9b,0x42,0x12,0xbf,0x0c,0x00,0x38,0xf4,0x00,0x8f,0x18,
-0x00,0x04,0x4b,0x38,0x10,0x0f,0x8e,0x02,0x30,0x88,0xef,0xa2,0x2d,0x66,0x56,0x3f,
-0xfb,0x88,0xdf,0xf8,0x60,0x00,0x18,0x8f,0x0c,0x00,0x08,0x24,0x00,0x08,0x3c,0x00,
-0x0f,0x6c,0x00,0x14,0x05,0x9c,0x00,0x08,0xb4,0x00,0x08,0xcc,0x00,0x71,0x14,0x44,
-0x44,0x10,0x03,0x44,0x44,0x32,0x71,0x53,0xef,0xff,0xff,0xe0,0x6f,0xde,0x66,0x00,
-0x1f,0x01,0x15,0x8f,0xbb,0x19,0x0f,0x0c,0x00,0x0f,0x73,0x7b,0xbb,0xbb,0x60,0x2a,
-0xbb,0xbb,0x20,0x71,0x06,0x1c,0x21,0x00,0x40,0x8c,0x13,0x4f,0x7a,0x00,0x0f,0x54,
-0x00,0x1d,0x08,0x3c,0x00,0x08,0x54,0x00,0x0f,0xb4,0x00,0x4b,0x27,0xbd,0x20,0x8d,
-0x42,0x06,0x1b,0x14,0x02,0x53,0x80,0x04,0x13,0x70,0x16,0xfd,0x17,0x00,0x27,0xff,
-0xd1,0x17,0x00,0x36,0x10,0x02,0xdb,0x17,0x00,0x34,0x2e,0xff,0xc0,0x17,0x00,0x45,
-0x00,0xdf,0xff,0xfc,0x2e,0x00,0x10,0xdf,0xad,0x03,0x02,0x17,0x00,0x00,0x1b,0x68,
-0x14,0xfc,0x45,0x00,0x00,0xe3,0x13,0x12,0xcc,0x17,0x00,0x04,0x2a,0x6e,0x02,0x5c,
-0x00,0x01,0xfc,0x13,0x04,0x99,0x27,0x15,0x1d,0x17,0x00,0x01,0x19,0x00,0x06,0xb0,
-0x27,0x36,0x1d,0xff,0xd1,0x21,0x3a,0x23,0xcc,0x10,0x09,0x00,0x11,0x41,0xca,0x02,
-0x41,0x30,0x01,0xdf,0xd1,0xd3,0x0a,0x41,0x70,0xcf,0xff,0xd1,0xdb,0x1b,0x10,0x4e,
-0x46,0x00,0x20,0x07,0xff,0x38,0x42,0x60,0xff,0xd1,0x07,0xff,0xff,0xfb,0xea,0x1e,
-0x11,0xd8,0x6a,0x01,0x14,0x4f,0x72,0x01,0x14,0x4f,0x7a,0x01,0x13,0x4f,0xfe,0x1e,
-0x13,0x07,0x7c,0x00,0x13,0x07,0x9c,0x00,0x13,0x07,0xa5,0x00,0x00,0x40,0x00,0x17,
-0x5f,0x48,0x00,0x14,0xd1,0x48,0x00,0x13,0x7a,0x48,0x00,0x22,0xf3,0x0b,0x48,0x00,
-0x1a,0xf4,0x13,0x59,0x17,0xaf,0x80,0x44,0x24,0xef,0xfd,0x75,0x13,0x10,0x60,0x0c,
-0x00,0x21,0x07,0x70,0x25,0x0a,0x10,0xf3,0x0c,0x00,0x12,0x5f,0x61,0x05,0x10,0xfb,
-0x0c,0x00,0x21,0xcf,0xff,0x59,0x66,0x10,0xf6,0x0c,0x00,0x30,0x7f,0xff,0xf7,0x12,
-0x20,0x00,0x30,0x00,0x00,0xab,0x13,0x21,0x20,0x0a,0x44,0x38,0x00,0xd0,0x77,0x00,
-0x43,0x71,0x12,0xe0,0x0c,0x00,0x10,0x1f,0x5d,0x2a,0x11,0x90,0x0c,0x00,0x00,0xb6,
-0x05,0x11,0x8f,0xe3,0x3f,0x11,0xfd,0x7f,0x22,0x31,0x9f,0xff,0x20,0x0c,0x00,0x00,
-0x6c,0x0a,0x02,0x0c,0x00,0x20,0xfc,0x00,0xb3,0x19,0x01,0x24,0x00,0x21,0x37,0x72,
-0x24,0x00,0x14,0x5f,0xfb,0x3b,0x10,0x0a,0x79,0x61,0x13,0xe0,0xf4,0x42,0x00,0x1d,
-0x0b,0x14,0xf8,0x1d,0x6b,0x11,0xa0,0x84,0x00,0x01,0x17,0x01,0x00,0xac,0x6f,0x11,
-0xff,0x50,0x63,0x31,0x9f,0xff,0xf8,0x6d,0x43,0x32,0xe8,0x42,0x24,0x14,0x16,0x01,
-0xc5,0x01,0x02,0x26,0x58,0x03,0x55,0x61,0x04,0x13,0x6d,0x10,0x3b,0x0b,0x00,0x04,
-0x44,0x1f,0x45,0x15,0x89,0x97,0x51,0x59,0x4a,0x37,0x89,0x98,0x40,0x9c,0x06,0x1f,
-0xf0,0x0c,0x00,0x01,0x14,0x4f,0x9c,0x6b,0x31,0x0c,0xc3,0x2c,0xd1,0x34,0x24,0x3c,
-0xc0,0xe4,0x61,0x01,0x6c,0x0e,0x16,0x03,0xf9,0x02,0x26,0x30,0x0a,0x0c,0x00,0x11,
-0xa0,0xe6,0x06,0x22,0x94,0x49,0x37,0x1e,0x22,0xef,0xff,0x0d,0x2f,0x00,0xdf,0x6f,
-0x11,0x1e,0x97,0x00,0x11,0x09,0xf2,0x44,0x22,0x0f,0xff,0x09,0x84,0x2a,0xff,0xf0,
-0x0c,0x00,0x07,0x24,0x00,0x08,0x3c,0x00,0x08,0x54,0x00,0x08,0x6c,0x00,0x08,0x84,
-0x00,0x08,0x9c,0x00,0x09,0xb4,0x00,0x08,0xcc,0x00,0x0f,0xf0,0x00,0x08,0x07,0x14,
-0x01,0x00,0xb9,0x68,0x35,0x10,0x00,0x02,0x34,0x19,0x32,0x5f,0xfe,0x40,0x9d,0x07,
-0x03,0xd1,0x1b,0x24,0x70,0x0e,0xb0,0x01,0x10,0xaf,0x86,0x00,0x33,0xef,0xfe,0x00,
-0x79,0x0c,0x41,0xb3,0xbf,0xff,0xce,0x1b,0x00,0x00,0x7e,0x1e,0x10,0x90,0x29,0x05,
-0x13,0xfe,0x15,0x39,0x42,0x60,0x5d,0x50,0x6f,0x0d,0x06,0xa1,0x08,0xff,0xfe,0x30,
-0x8f,0xff,0x80,0x3e,0xff,0xfe,0x11,0x4f,0x90,0xfd,0x20,0xaf,0xff,0xff,0xa0,0x2d,
-0xff,0xfb,0xce,0x77,0x11,0xfb,0x4e,0x34,0xa1,0xc1,0x0b,0xff,0xfd,0x20,0x4f,0xff,
-0xf8,0x03,0xef,0xc6,0x56,0x44,0x08,0xff,0xfe,0x4e,0xfc,0x41,0x00,0x08,0x00,0x33,
-0xfe,0x4f,0xe3,0x3f,0x16,0x00,0x23,0x00,0x44,0x40,0x41,0x07,0xff,0x06,0x6c,0x27,
-0x01,0x40,0xa2,0x01,0x13,0x80,0x67,0x16,0x33,0xeb,0xbb,0xef,0x56,0x2a,0x10,0x8f,
-0x06,0x01,0x17,0x04,0x1b,0x00,0x3f,0x40,0x00,0x4f,0x1b,0x00,0x0f,0x11,0x7f,0xf1,
-0x1e,0x03,0xe5,0x63,0xa3,0x03,0xbb,0xbb,0xba,0x10,0x00,0x1a,0xbb,0xbb,0xb3,0x75,
-0x2e,0x3e,0xdd,0xdd,0x90,0x59,0x01,0x0f,0x0c,0x00,0x41,0x20,0xad,0xdd,0xd8,0x99,
-0x23,0xdd,0xda,0xad,0x46,0x04,0x81,0x0b,0x04,0x03,0x6d,0x15,0xd1,0xcf,0x04,0x04,
-0xb9,0x04,0x16,0x1d,0xe7,0x04,0x01,0x19,0x00,0x05,0xd0,0x04,0x13,0x1d,0x17,0x00,
-0xd0,0x25,0x55,0x55,0x55,0x11,0xdf,0xfd,0x11,0x55,0x55,0x55,0x52,0xef,0x2c,0x00,
-0x32,0x1d,0xd1,0x1d,0xee,0x05,0x00,0x2d,0x00,0x04,0x56,0x03,0x00,0x13,0x07,0x2f,
-0x9f,0xff,0x01,0x00,0x05,0x35,0x71,0xe7,0x1e,0x0c,0x00,0x43,0xb6,0xfb,0x6f,0xff,
-0x00,0x07,0x03,0xe8,0x04,0x13,0x03,0xf1,0x71,0x12,0xd3,0xb2,0x0b,0x17,0xff,0xeb,
-0x6b,0x05,0x7f,0x75,0x00,0xf9,0x09,0x04,0xfa,0x70,0x01,0xbe,0x53,0x14,0x1e,0xc6,
-0x77,0x41,0x9f,0xfe,0x10,0x00,0x81,0x24,0x03,0x75,0x37,0x00,0x13,0x11,0x05,0x19,
-0x4e,0x23,0xf5,0x01,0x88,0x71,0x02,0xa5,0x46,0x16,0xaf,0x19,0x78,0x34,0x0e,0xff,
-0xaf,0x02,0x04,0x05,0x65,0x00,0x00,0x83,0x04,0x16,0x2f,0xd0,0x00,0x05,0x27,0x04,
-0x0f,0x01,0x00,0x22,0x18,0xdf,0x0d,0x00,0x28,0xd3,0xdf,0x0d,0x00,0x16,0x00,0x71,
-0x43,0x11,0x32,0x06,0x00,0x33,0x67,0x75,0x20,0x79,0x0e,0x10,0x29,0x56,0x01,0x11,
-0x70,0x0c,0x00,0x12,0x08,0x56,0x07,0x50,0x60,0x3f,0xff,0x00,0x01,0xd2,0x95,0x00,
-0x6e,0x40,0x20,0x3f,0xff,0xd4,0x04,0x11,0xb4,0xb1,0x93,0x10,0xdf,0xa2,0x40,0x14,
-0xe4,0x65,0x92,0x14,0x04,0xba,0x01,0x10,0xcf,0x81,0x39,0x11,0xf2,0x4f,0x03,0x00,
-0x45,0x1f,0x35,0x1f,0xff,0x80,0x49,0x19,0x02,0x76,0x85,0x02,0x09,0x03,0x02,0xcf,
-0x3b,0x10,0x01,0xc5,0x07,0x06,0xd9,0x3b,0x0b,0x01,0x00,0x10,0x34,0x1e,0x00,0x02,
-0x0a,0x00,0x14,0x40,0xc1,0x66,0x00,0x5c,0x0f,0x07,0x39,0x03,0x72,0xf1,0xff,0xff,
-0xfd,0xee,0xff,0x60,0xf2,0x93,0x03,0x28,0x08,0x00,0x48,0x02,0x14,0x40,0xe8,0x00,
-0x40,0x4e,0xff,0xfa,0x00,0x2d,0x02,0x40,0xb5,0x00,0x00,0x4b,0xde,0x0e,0x31,0xff,
-0xf3,0xbf,0xcc,0x00,0x00,0x16,0x23,0x34,0xff,0xf3,0x06,0x85,0x03,0x00,0x7c,0x7a,
-0x10,0x17,0x25,0x01,0x13,0xa2,0x88,0x7a,0x22,0x02,0x67,0xdf,0x6d,0x2b,0x23,0x30,
-0x7b,0x41,0x21,0xa7,0x00,0x96,0x37,0x02,0x4a,0x04,0x01,0x0b,0x00,0x52,0xff,0x14,
-0x44,0x44,0xcf,0x2c,0x57,0x0f,0x01,0x00,0x18,0x00,0x7f,0x08,0x03,0x1f,0x3f,0x22,
-0xff,0xff,0x9f,0x0b,0x02,0xd8,0x0c,0x04,0xc3,0x5e,0x05,0xed,0x57,0x1c,0x96,0xf7,
-0x7a,0x25,0xcf,0xff,0x72,0x08,0x00,0x04,0x05,0x31,0x33,0x33,0xcf,0x09,0x00,0x03,
-0xe0,0x4a,0x23,0x4a,0x20,0x8b,0x0b,0x23,0xcf,0xe1,0x09,0x00,0x23,0x3e,0xfa,0x09,
-0x00,0x23,0x06,0xfe,0x09,0x00,0x14,0x05,0x09,0x00,0x24,0x2e,0xfa,0x2d,0x00,0x13,
-0xf2,0x09,0x00,0x53,0x5b,0x30,0x7c,0xcc,0xcc,0xee,0x0b,0x04,0x9c,0x00,0x06,0x9f,
-0x00,0x05,0xa2,0x00,0x06,0xa5,0x00,0x05,0xf7,0x39,0x04,0x01,0x00,0x19,0x30,0xe3,
-0x07,0x19,0xb1,0x53,0x13,0x03,0xea,0x03,0x12,0x1a,0xd9,0x97,0x24,0xd0,0x00,0x4d,
-0x01,0x32,0x06,0x30,0x05,0xf9,0x0d,0x10,0x1c,0xbf,0x28,0x00,0x57,0x79,0x12,0x40,
-0x5c,0x01,0x01,0xd4,0x5a,0x60,0x0c,0xfc,0x01,0x44,0x44,0x4c,0x65,0x04,0x00,0x8a,
-0x9c,0x23,0x4f,0xf3,0x92,0x7b,0x72,0x5a,0x20,0x0c,0xfb,0x00,0xdf,0x8f,0xd6,0x09,
-0x75,0x0c,0xfe,0x20,0x4f,0xf1,0x08,0xfb,0xd8,0x00,0x53,0x00,0xff,0x50,0x5f,0xef,
-0x6f,0x24,0x65,0x6f,0xe0,0x0c,0xf7,0x04,0xff,0x05,0x01,0x43,0x00,0xcf,0x70,0x4f,
-0x0c,0x0a,0x55,0x02,0xef,0xa0,0x0f,0xf5,0x17,0x01,0x73,0xcf,0xe2,0x04,0xff,0x10,
-0x9f,0xbf,0xca,0x38,0x65,0xa2,0x00,0xcf,0xb0,0x0d,0xf8,0xa7,0x01,0x51,0xaf,0xf3,
-0x04,0xff,0x30,0x09,0x01,0x10,0xf0,0x27,0x2a,0x02,0xf0,0x78,0x11,0x05,0x51,0x4c,
-0x11,0xf7,0x36,0x9d,0x03,0xf6,0x0f,0x47,0x53,0x00,0x4f,0xfa,0x20,0x01,0x27,0x6f,
-0xfd,0x93,0x6a,0x37,0x7f,0xfd,0x10,0x0b,0x34,0x18,0xfb,0x25,0x6c,0x00,0xd2,0x75,
-0x1f,0x3d,0xb2,0x03,0x02,0x00,0xaf,0x1f,0x16,0xca,0x5e,0x02,0x15,0xf6,0x50,0x72,
-0x00,0x48,0x0a,0x16,0x04,0x67,0x07,0x02,0x26,0x45,0x12,0x9f,0xbd,0x04,0x10,0x08,
-0xe0,0x0b,0x11,0x04,0xf3,0x0d,0x24,0x42,0x8f,0x2a,0x06,0x04,0xf7,0x0b,0x03,0x36,
-0x00,0x34,0x6b,0xff,0xff,0xe3,0x28,0x13,0xf4,0x87,0x1d,0x11,0x0f,0x2b,0x00,0x23,
-0x0b,0x40,0x0c,0x00,0x1f,0xf4,0xfa,0x05,0x10,0x0f,0x74,0x04,0x03,0x2a,0xfd,0x3d,
-0x71,0x04,0x24,0x0c,0xe3,0x48,0x02,0x14,0xa0,0x1a,0x0c,0x04,0x0a,0x10,0x13,0xf6,
-0x1f,0x05,0x02,0x0f,0x02,0x14,0x01,0x07,0x2a,0x13,0xaf,0x97,0x07,0x13,0x4f,0x6f,
-0x31,0x13,0x1e,0xbc,0x00,0x12,0x0a,0x50,0x2f,0x03,0xec,0x9d,0x00,0xb7,0x80,0x03,
-0x3d,0x05,0x13,0x5f,0x38,0x05,0x04,0x36,0x05,0x14,0xe0,0x34,0x01,0x32,0x2f,0xff,
-0x2d,0xf9,0x00,0x13,0xef,0x50,0x7b,0x32,0x3c,0xff,0x44,0x1c,0x27,0x31,0x8f,0xfc,
-0x07,0x23,0x01,0x50,0x01,0xff,0xf9,0x02,0x7c,0x79,0x00,0x50,0x07,0xff,0xfb,0x40,
-0x6f,0xb0,0x09,0x14,0x0a,0xb0,0x06,0x13,0x08,0x42,0x97,0x00,0x6c,0x0f,0x20,0xda,
-0x40,0x8b,0x04,0x01,0xdb,0x05,0x12,0x0f,0x55,0x48,0x11,0xfb,0xbe,0x00,0x12,0x2d,
-0x36,0x0e,0x12,0x2e,0x03,0x12,0x01,0x76,0x28,0x03,0x85,0xa1,0x13,0xf6,0x18,0x79,
-0x29,0x60,0x6f,0x4a,0x1e,0x1f,0xdf,0x1a,0x04,0x0a,0x13,0x8e,0xe9,0x01,0x13,0x1d,
-0xa4,0x4d,0x24,0x1c,0xff,0x57,0x11,0x02,0x5a,0x00,0x13,0x0a,0x6c,0x12,0x12,0x09,
-0x0f,0x00,0x01,0x52,0x05,0x11,0xf6,0x51,0x03,0x30,0xea,0xbb,0x30,0x64,0x01,0x17,
-0xb4,0x57,0x02,0x15,0xdf,0x44,0x45,0x36,0xdf,0xff,0xe6,0xb6,0x01,0x13,0xfc,0xa6,
-0x03,0x06,0x96,0x7b,0x12,0x0f,0xa3,0x74,0x04,0x15,0x00,0x02,0xd6,0x76,0x03,0xe0,
-0x01,0x16,0xa2,0xd8,0x0f,0x16,0xf8,0xf5,0x01,0x35,0xfe,0x50,0x00,0xb4,0x00,0x16,
-0xb2,0x0a,0x02,0x16,0xf5,0xca,0x00,0x06,0xb6,0x02,0x16,0xfe,0x15,0x00,0x15,0x6f,
-0x7c,0x07,0x14,0x20,0x0a,0x00,0x36,0xe5,0x00,0x0f,0x10,0x09,0x04,0x1d,0x00,0x04,
-0x69,0x00,0x15,0xd4,0x93,0x00,0x14,0x70,0xa8,0x00,0x12,0xfa,0x3a,0x03,0x06,0xcd,
-0x06,0x15,0x0d,0x9a,0x7a,0x4e,0x00,0x3d,0xf9,0x10,0x4b,0x06,0x51,0x19,0xcc,0xcc,
-0xc9,0x10,0x06,0x00,0x11,0x1b,0xf5,0x07,0x14,0x0b,0x50,0x8b,0x16,0xf0,0xc3,0x00,
-0x06,0xcd,0x02,0x0f,0x15,0x00,0x86,0x11,0xfe,0xd0,0x80,0x01,0xce,0x10,0x11,0x5f,
-0x28,0x03,0x01,0x06,0x00,0x41,0x13,0x33,0x33,0x10,0x08,0x06,0x11,0x10,0x50,0x07,
-0x01,0x19,0x0f,0x16,0x06,0x30,0x04,0x1e,0xef,0x8f,0x01,0x0f,0x01,0x00,0x97,0x06,
-0xab,0x09,0x33,0xb1,0x8b,0xbb,0x01,0x00,0x21,0x81,0x04,0xd4,0x01,0x31,0x44,0x3b,
-0xfd,0xd3,0x5c,0x02,0xd8,0x7b,0x03,0xa1,0x9d,0x21,0x00,0x6f,0x32,0x78,0x01,0x0a,
-0x12,0x00,0x21,0x01,0x12,0x6f,0x34,0x03,0x03,0x0f,0x01,0x13,0x70,0x7c,0x02,0x2f,
-0x86,0xff,0x88,0x03,0x10,0x22,0xfd,0x8f,0xd9,0x57,0x12,0x16,0x07,0x00,0x02,0x4b,
-0x00,0x12,0xfb,0x5a,0x00,0x12,0xfa,0x69,0x00,0x12,0xf8,0x78,0x00,0x01,0xf8,0xa1,
-0x01,0x93,0x51,0x00,0x2f,0x88,0x11,0xb5,0xd5,0x0d,0x11,0xba,0xa4,0x00,0x16,0x37,
-0x0d,0x07,0x16,0x5f,0xde,0x2e,0x14,0x4f,0xde,0x52,0x02,0x2d,0x04,0x16,0x30,0x14,
-0x15,0x03,0x8e,0x1a,0x12,0x2e,0x57,0x28,0x06,0x3a,0x0b,0x11,0xfd,0x40,0x53,0x03,
-0x99,0x7c,0x06,0x0b,0x00,0x00,0x0c,0x00,0x16,0x0b,0xcb,0x0a,0x26,0x08,0xff,0x5d,
-0x0d,0x07,0xf1,0x10,0x16,0x0d,0xd3,0x00,0x06,0x63,0x06,0x19,0xfd,0xa7,0x07,0x24,
-0x04,0x44,0x01,0x00,0x27,0x00,0x0b,0x1c,0x0b,0x07,0x45,0x00,0x07,0xea,0x05,0x08,
-0x17,0x00,0x16,0x0e,0xe2,0x03,0x34,0x00,0x4b,0xbb,0x01,0x00,0x17,0x40,0x45,0x49,
-0x02,0xe4,0x29,0x02,0x66,0x47,0x01,0x1d,0x0f,0x00,0x46,0x35,0x0f,0x06,0x00,0x0e,
-0x02,0xf8,0x53,0x03,0xf9,0x52,0x1f,0x0a,0x07,0x00,0x19,0x11,0x80,0x07,0x00,0x02,
-0xfb,0x28,0x14,0xfb,0x7e,0x17,0x25,0x20,0x00,0x25,0x33,0x02,0x9a,0x1a,0x0f,0x5b,
-0x00,0x26,0x0f,0xc3,0x00,0x1f,0x25,0xfa,0x00,0x64,0x4a,0x07,0x09,0x18,0x26,0x03,
-0x43,0x16,0x09,0x16,0xf7,0x2f,0x13,0x15,0xb0,0xed,0x09,0x16,0xfc,0x64,0x12,0x1f,
-0xc0,0x15,0x00,0x1a,0x07,0x06,0x02,0x0f,0x1a,0x0c,0x0c,0xbf,0xd1,0x77,0x77,0x77,
-0x7d,0xff,0xfd,0x77,0x77,0x77,0x71,0x69,0x00,0x21,0x0b,0x15,0x00,0x15,0xaf,0x6b,
-0x76,0x31,0x02,0xab,0xa2,0x37,0x16,0x13,0x77,0x01,0x00,0x28,0x76,0x1d,0xcc,0x08,
-0x1e,0xff,0x01,0x00,0x06,0xbb,0x0d,0x1a,0x80,0xb8,0x05,0x63,0x16,0xad,0xef,0xed,
-0xa6,0x10,0x56,0x00,0x16,0xbf,0xa1,0x78,0x00,0xfc,0x06,0x30,0xe9,0x54,0x59,0x5c,
-0x4f,0x02,0x80,0x07,0x02,0x2f,0x1b,0x00,0x09,0x04,0x10,0x2e,0x28,0x06,0x40,0x14,
-0x20,0x00,0x7f,0x41,0x03,0x10,0x1e,0xbc,0x07,0x91,0x06,0xff,0xc2,0x00,0xbf,0xff,
-0xfe,0x10,0x0b,0xb9,0xa3,0x70,0x5f,0xff,0xe2,0x03,0xff,0xff,0xfb,0x22,0x22,0x01,
-0x62,0x0a,0x10,0xa0,0x43,0x85,0x50,0xef,0xff,0xff,0xc0,0x0d,0xe6,0x0c,0x00,0xc0,
-0x0c,0x10,0xee,0x58,0x03,0x02,0x55,0x0a,0x02,0x69,0x05,0x21,0xe0,0x0c,0x6b,0x03,
-0x02,0x0f,0x33,0x30,0xff,0x30,0x4f,0x5a,0x04,0x80,0x3f,0xff,0xff,0xb0,0x01,0xdf,
-0xff,0xfb,0x7a,0x0f,0x50,0x80,0x0b,0xff,0xff,0xe1,0x4e,0x44,0x70,0xf7,0x00,0x39,
-0xb9,0x30,0x07,0xff,0x38,0x14,0x23,0x02,0xcf,0x2d,0x58,0x22,0xff,0xd2,0x62,0x1b,
-0x44,0xfe,0x95,0x45,0x9e,0xf3,0x11,0x12,0x2a,0x60,0x03,0x13,0x30,0x1b,0x0a,0x51,
-0x6a,0xdf,0xfe,0xda,0x71,0x1e,0x09,0x1a,0xe6,0x6d,0x0c,0x08,0xa0,0x41,0x01,0xe6,
-0x06,0x19,0xfc,0x33,0x47,0x10,0x0a,0x64,0x1f,0x54,0x48,0xce,0xff,0xeb,0x72,0xb0,
-0x40,0x12,0xff,0xe8,0x15,0x13,0xfc,0xe1,0x82,0x10,0xef,0xf1,0x0e,0x21,0x45,0x7d,
-0x5c,0x4f,0x01,0xa9,0x6c,0x04,0x2b,0x05,0x14,0xe4,0x6f,0x7b,0x53,0xf6,0x01,0x76,
-0x20,0x04,0xe9,0x09,0x10,0x10,0x2e,0x0d,0x33,0x1f,0xff,0x90,0xe1,0xa4,0x40,0x6e,
-0x40,0x00,0x2c,0xb0,0x01,0x21,0x80,0x0f,0x0e,0x0f,0x13,0x2f,0x8d,0x4e,0x10,0xff,
-0xd5,0x15,0x10,0x90,0x0b,0x00,0x11,0xb1,0xfd,0x04,0x21,0xf3,0x09,0xda,0x1c,0x10,
-0x9f,0x2e,0x09,0x00,0x7b,0x88,0x20,0x30,0x9f,0x53,0x59,0x11,0x02,0x86,0x05,0x20,
-0x01,0xbf,0xc4,0x51,0x21,0xff,0xf9,0xa4,0x08,0x12,0xf9,0x9e,0x54,0x02,0x12,0x10,
-0x12,0x0a,0x78,0x59,0x23,0x4e,0xff,0x3e,0x59,0x12,0x0b,0x68,0x85,0x12,0x1c,0x58,
-0x26,0x01,0x20,0x00,0x12,0xc2,0x3f,0x01,0x14,0x80,0xdb,0x00,0x30,0xfb,0x64,0x51,
-0xf5,0x09,0x03,0x3c,0x48,0x10,0x9f,0x75,0x11,0x53,0x00,0x02,0xdf,0xff,0xc1,0x59,
-0x0a,0x54,0x9d,0xef,0xfe,0xb1,0x00,0x93,0x0e,0x07,0xd9,0x2d,0x0a,0x3d,0x4f,0x1b,
-0x3e,0x62,0x02,0x13,0x1b,0xc9,0x02,0x00,0xe4,0x1d,0x08,0x59,0x01,0x18,0xfa,0x1d,
-0x05,0x07,0x09,0x0b,0x02,0x68,0x0d,0x03,0x18,0x7a,0x0c,0x32,0x18,0x02,0xa5,0x0a,
-0x26,0xfe,0x10,0xf3,0x0f,0x08,0x63,0x43,0x16,0x02,0xfb,0x75,0x02,0xec,0x03,0x35,
-0xa4,0x44,0xaf,0xf0,0x03,0x11,0x4f,0xcc,0x3e,0x04,0x17,0x06,0x01,0x5b,0x97,0x14,
-0x8f,0x67,0x16,0x01,0x3c,0x01,0x14,0x09,0x9d,0x09,0x11,0x01,0xec,0x0b,0x00,0x6a,
-0xa2,0x02,0x80,0x10,0x04,0xcf,0x08,0x14,0x90,0x4f,0x06,0x11,0xc0,0x44,0xaa,0x02,
-0x3d,0x5c,0x00,0x6d,0x01,0x13,0x0d,0x34,0x06,0x16,0x05,0xfe,0x03,0x13,0xf5,0xb4,
-0x19,0x32,0xfd,0x10,0x2d,0x4d,0x0b,0x04,0x04,0x53,0x12,0x6f,0x67,0x09,0x12,0x1f,
-0x44,0x06,0x02,0x4a,0x04,0x22,0x10,0x0a,0xd7,0x09,0x13,0x26,0x89,0x86,0x09,0xba,
-0x03,0x07,0x5d,0x06,0x0a,0x60,0x06,0x0a,0x63,0x06,0x17,0x69,0x40,0x01,0x16,0xff,
-0x05,0x48,0x00,0x7b,0x59,0x21,0x9b,0xbb,0xb5,0x0a,0x20,0x3b,0xbb,0xcf,0x31,0x01,
-0x7a,0x02,0x23,0x02,0xef,0x9e,0x09,0x02,0xc1,0x03,0x03,0x3d,0x0a,0x12,0xe1,0xec,
-0x11,0x10,0xe3,0xc4,0x01,0x51,0xe2,0x0c,0xff,0xfe,0x20,0xef,0x07,0x10,0x03,0x72,
-0x5c,0x31,0xf3,0x00,0xff,0x5f,0x0c,0x20,0x54,0x09,0x42,0x01,0x2c,0xbe,0x30,0xfa,
-0x01,0x02,0xa7,0x8d,0x04,0x69,0x01,0x31,0xf9,0x04,0x50,0x24,0x00,0x00,0x2f,0x13,
-0x23,0xa0,0x3f,0x3c,0x00,0x30,0x2e,0xff,0xfc,0x18,0x30,0x31,0xff,0xfe,0x30,0x19,
-0x05,0x12,0x01,0xd5,0x13,0x02,0xce,0x01,0x14,0x2e,0x84,0x00,0x00,0xd2,0x86,0x01,
-0xb9,0x03,0x08,0xb4,0x00,0x08,0xcc,0x00,0x0e,0xe4,0x00,0x07,0xfc,0x00,0x07,0x5b,
-0x6d,0x16,0x90,0x34,0x05,0x15,0x90,0x0a,0x00,0x04,0x0b,0x00,0x04,0xc2,0x46,0x00,
-0x0a,0x00,0x13,0xfd,0x0b,0x00,0x11,0xaf,0xd7,0x0c,0x12,0x90,0x0a,0x00,0x23,0x00,
-0x0a,0xea,0x46,0x02,0x23,0x12,0x12,0x90,0x0a,0x00,0x01,0x0b,0x00,0x00,0xf4,0x98,
-0x02,0x0b,0x00,0x12,0x79,0x79,0x02,0x00,0x0b,0x07,0x23,0x0b,0xf9,0xd6,0x02,0x15,
-0xfa,0x80,0x06,0x05,0x13,0x07,0x00,0x08,0x00,0x14,0xbf,0x79,0x00,0x25,0xa0,0x9f,
-0x79,0x00,0x15,0x89,0x79,0x00,0x1f,0xf7,0x79,0x00,0x12,0x15,0xaf,0x79,0x00,0x15,
-0xdf,0x79,0x00,0x05,0xfc,0x02,0x16,0x0a,0x06,0x03,0x16,0x0a,0x10,0x03,0x26,0x0a,
-0xf9,0x76,0x1c,0x04,0x15,0x07,0x19,0xd9,0x9d,0x03,0x33,0x03,0xef,0xfa,0x06,0x12,
-0x22,0x44,0x10,0xcf,0x04,0x14,0xfa,0x76,0x81,0x03,0xde,0x04,0x23,0xfa,0x05,0x29,
-0x89,0x04,0x9a,0x01,0x11,0x05,0x69,0x8c,0x00,0x69,0x12,0x43,0xef,0xfe,0xdf,0xfb,
-0xa5,0x17,0x20,0xef,0xf1,0x1e,0x24,0x42,0x2b,0xff,0x48,0xff,0x8e,0x61,0x00,0x1f,
-0x00,0x65,0x17,0x20,0xbf,0xf4,0x05,0x50,0x1f,0x00,0x04,0x3e,0x63,0x04,0x1f,0x00,
-0x05,0x98,0x2c,0x0f,0x1f,0x00,0x0c,0x65,0xaf,0x70,0xef,0xf1,0x4f,0xc0,0x1f,0x00,
-0x51,0x3f,0xff,0x6e,0xff,0x5f,0x97,0x4b,0x10,0xf7,0xb6,0x00,0x23,0x20,0xcf,0x46,
-0x0e,0x03,0x55,0x09,0x23,0x50,0xbf,0xee,0x14,0x14,0xbf,0x9b,0x8c,0x02,0x0f,0x00,
-0x12,0x04,0x37,0x09,0x00,0x21,0x26,0x29,0xd1,0x00,0x40,0x1b,0x1e,0xd1,0xc0,0x82,
-0x24,0x3d,0xff,0x25,0x05,0x03,0xf4,0x11,0x16,0xf4,0xcb,0x0d,0x04,0x19,0x00,0x08,
-0xef,0x13,0x08,0x92,0x03,0x0f,0xd3,0x0b,0x71,0x0f,0x26,0x10,0x08,0x08,0x97,0x8b,
-0x07,0xd7,0x33,0x01,0x40,0x01,0x17,0xb0,0x54,0x1c,0x16,0xfb,0x17,0x00,0x05,0x19,
-0x00,0x16,0xbf,0x29,0x1c,0x03,0x6e,0x01,0x02,0xbb,0x43,0x07,0x40,0x8b,0x03,0x00,
-0x0d,0x02,0x44,0x7a,0x10,0x22,0xef,0xaf,0x2f,0x22,0x20,0xfe,0x16,0x36,0x00,0xaa,
-0x16,0x10,0x52,0x0c,0x00,0x12,0x25,0xaa,0x16,0x10,0xf9,0x3b,0x8c,0x13,0x9f,0xbd,
-0x04,0x45,0x20,0x01,0x10,0x02,0xd9,0x15,0x3f,0x88,0x88,0x9f,0xaa,0x16,0x23,0x1e,
-0x00,0x01,0x00,0x36,0x0d,0xea,0x63,0xfd,0x38,0x08,0x40,0x09,0x28,0xdf,0xff,0x9b,
-0x8e,0x06,0xaf,0x00,0x14,0x0a,0x01,0x01,0x03,0x4b,0x06,0x05,0xaa,0x04,0x18,0x4f,
-0xac,0x06,0x18,0x9f,0xd6,0x06,0x18,0x6f,0xd9,0x60,0x17,0x6f,0xe7,0x04,0x17,0x0a,
-0x25,0x00,0x16,0x04,0x71,0x2c,0x00,0x81,0x15,0x17,0xf7,0x03,0x1e,0x11,0xfd,0x14,
-0x00,0x12,0x40,0xdb,0x04,0x10,0x30,0x76,0x1f,0x21,0xff,0xa0,0x1f,0x88,0x10,0x70,
-0x00,0x4e,0x41,0xff,0xff,0x70,0x03,0x9d,0x4b,0x02,0x9c,0x5e,0x13,0x6a,0xb9,0x01,
-0x04,0xac,0x0e,0x03,0x7b,0x0b,0x06,0x00,0x10,0x17,0x6f,0x5c,0x06,0x02,0x5a,0x1a,
-0x16,0xe7,0x8c,0x12,0x02,0x7d,0x67,0x01,0xf3,0x23,0x26,0xc9,0x62,0x5f,0x04,0x15,
-0x42,0x0a,0x00,0x12,0xcf,0x9e,0xb1,0x42,0x37,0x73,0x00,0x2e,0x62,0x0d,0x11,0x08,
-0xbd,0x04,0x00,0x8e,0x26,0x00,0xf5,0x00,0x40,0xb0,0xef,0xf4,0x04,0x66,0x6e,0x01,
-0xfd,0x0c,0x10,0xf1,0xd7,0xb0,0x20,0x9f,0xff,0xf6,0x45,0x41,0xfb,0x5b,0xff,0xc0,
-0x15,0x00,0x01,0x72,0x0f,0x21,0xf5,0x9f,0xa4,0x00,0x17,0x08,0x99,0x01,0x26,0x39,
-0xbe,0x8b,0x02,0x11,0x02,0x99,0x57,0x05,0xcd,0x05,0x03,0x75,0x85,0x12,0x4a,0x91,
-0x0e,0x01,0x84,0x00,0x04,0x84,0x07,0x10,0x2e,0x3f,0x00,0x11,0xef,0x17,0x00,0x00,
-0x84,0x00,0x21,0xd0,0x2e,0x17,0x00,0x01,0x84,0x00,0x11,0x02,0x17,0x00,0x02,0x84,
-0x00,0x01,0x17,0x00,0x01,0x84,0x00,0x11,0x00,0x17,0x00,0x02,0xfc,0x0f,0x00,0x17,
-0x00,0x32,0xd0,0x08,0xff,0x70,0x1c,0x30,0xae,0xea,0x20,0x7c,0x0a,0x09,0x7a,0x1f,
-0x35,0xff,0xf0,0x7a,0xd9,0x11,0x11,0x08,0x91,0x00,0x02,0x00,0x1f,0x15,0xfb,0x15,
-0x00,0x51,0xff,0xfa,0x47,0x88,0x40,0x15,0x00,0x30,0x48,0x88,0x7f,0x81,0xa2,0x02,
-0x41,0x04,0x36,0xff,0xff,0x80,0x44,0x0c,0x06,0xf9,0x0d,0x0f,0x15,0x00,0x60,0x40,
-0xfc,0x04,0x78,0x88,0x01,0x00,0x15,0x74,0xf4,0x11,0x2d,0x00,0x0f,0x6b,0x22,0x15,
-0xf0,0xf2,0x03,0x00,0xda,0x00,0x03,0x04,0x11,0x13,0x42,0x0e,0x22,0x02,0xa6,0x0f,
-0x15,0xef,0x0b,0x00,0x30,0x0f,0xff,0xcb,0x6b,0x05,0x35,0xbd,0xff,0xf8,0x4a,0x22,
-0x00,0x7b,0x00,0x04,0x43,0x05,0x14,0xf7,0x15,0x00,0x00,0x2e,0x11,0x06,0x58,0x05,
-0x16,0xf0,0x7b,0x00,0x10,0x54,0x5e,0x00,0x1f,0x45,0xe1,0x04,0x09,0x26,0xfe,0xce,
-0x87,0x0f,0x16,0x08,0xa9,0x0f,0x16,0x0c,0xe3,0x0c,0x15,0x8f,0x95,0x04,0x04,0xdb,
-0x02,0x00,0xff,0x3f,0x04,0x21,0x1c,0x1f,0x57,0x04,0x11,0x11,0x24,0x13,0x33,0x01,
-0x00,0x1e,0x1f,0x65,0x13,0x09,0x8e,0x00,0x06,0x2a,0x00,0x0e,0x19,0x13,0x0a,0x01,
-0x00,0x24,0x57,0x77,0x01,0x00,0x1f,0x5f,0x4a,0x00,0x01,0x24,0xfc,0xee,0x01,0x00,
-0x1f,0xeb,0x49,0x00,0x0c,0x15,0x01,0x73,0x00,0x2f,0x31,0xff,0x7e,0x12,0x0b,0x16,
-0xe1,0x2a,0x00,0x0f,0xfe,0x16,0x07,0x0f,0x44,0x00,0x02,0x26,0xfe,0x2d,0x0c,0x00,
-0x36,0xd2,0x00,0x9f,0x37,0x1b,0x24,0xe4,0x05,0x0c,0x00,0x62,0x50,0x4e,0xff,0x80,
-0x2c,0xff,0x98,0x69,0x10,0x08,0xd8,0x52,0x11,0x8f,0x22,0x00,0x01,0xbf,0x1d,0x20,
-0xf5,0x04,0x21,0x74,0x22,0x40,0x5e,0x45,0x16,0x53,0x1c,0xff,0xff,0xb1,0x09,0x70,
-0x00,0x35,0x20,0x6d,0xd6,0xbd,0x89,0x00,0xcd,0x91,0x05,0x66,0x00,0x2f,0xd9,0x9d,
-0xd8,0x06,0x23,0x12,0x4f,0xd7,0x0a,0x05,0xb0,0x15,0x05,0x46,0x93,0x14,0x0d,0x57,
-0x40,0x04,0xdd,0x04,0x14,0x1f,0x4a,0x84,0x04,0x19,0x00,0x00,0x88,0x01,0x44,0xc8,
-0x88,0x87,0x30,0x47,0x02,0x04,0x2d,0x1c,0x24,0xa0,0x0c,0x37,0x02,0x15,0xef,0xd8,
-0x02,0x03,0xdb,0x06,0x43,0x37,0x88,0x88,0xaf,0x43,0x17,0x14,0x08,0xde,0x05,0x33,
-0xcf,0xff,0xf3,0xc1,0x02,0x14,0xfa,0xe0,0x92,0x03,0x0e,0x43,0x03,0x19,0x0b,0x01,
-0x60,0x9e,0x08,0x84,0x95,0x24,0x3f,0xfb,0x54,0x06,0x13,0x20,0x1f,0x06,0x14,0x70,
-0x51,0x16,0x12,0xd3,0xf0,0x05,0x72,0x78,0x88,0xff,0xef,0xf8,0x88,0x74,0xbe,0x00,
-0x24,0x90,0x9f,0x25,0x20,0x25,0xf9,0x09,0x9c,0x03,0x01,0x92,0x23,0x0c,0xb1,0x03,
-0x15,0xe5,0xc6,0x03,0x70,0xf4,0x07,0x88,0x88,0x88,0x03,0x30,0x15,0x00,0x11,0x07,
-0x98,0x04,0x23,0x40,0x0f,0x9e,0x23,0x11,0x08,0xc0,0x1b,0x12,0x08,0xad,0x23,0x15,
-0x4f,0x15,0x00,0x14,0xfe,0x15,0x00,0x24,0x00,0x00,0x2a,0x00,0x33,0xb8,0x88,0x88,
-0x15,0x00,0x0d,0xe9,0x23,0x0f,0x15,0x00,0x09,0x43,0xf4,0x78,0x88,0x80,0x15,0x00,
-0x06,0x31,0x11,0x15,0xf0,0x1e,0x83,0x01,0x83,0x2b,0x06,0x15,0x00,0x16,0x4f,0xe7,
-0x05,0x16,0x08,0xb2,0x22,0x05,0x52,0x07,0x33,0x01,0x5f,0xff,0xb3,0x21,0x06,0x53,
-0x67,0x15,0x0c,0x32,0x00,0x14,0x0a,0xcd,0x1d,0x04,0xab,0x19,0x03,0x79,0x5f,0x03,
-0xfe,0x1d,0x16,0x0e,0x25,0x1f,0x06,0xce,0x04,0x06,0x32,0x01,0x14,0x01,0x09,0x94,
-0x04,0x86,0x00,0x00,0xa0,0x05,0x16,0x08,0xd8,0x04,0x04,0x74,0x02,0x13,0xd0,0x68,
-0x18,0x03,0x9a,0x10,0x03,0x01,0x00,0x16,0x3d,0x91,0x02,0x16,0xdf,0x2c,0x03,0x23,
-0x78,0x88,0x01,0x00,0x1a,0x72,0xb5,0x03,0x15,0x6f,0xce,0x07,0x16,0x01,0xea,0x8a,
-0x4a,0x03,0xcf,0xc3,0x00,0x9a,0x1a,0x09,0xdd,0x02,0x0e,0x53,0x0a,0xb0,0x10,0x1f,
-0x90,0x09,0xf1,0x01,0xf9,0x00,0x9f,0x10,0x1f,0xcc,0x00,0x9c,0xf8,0x00,0x8f,0x00,
-0x0f,0x80,0x08,0xf0,0x00,0x1b,0x00,0x0b,0x01,0x00,0x92,0xb8,0x8f,0xe8,0x8b,0xfb,
-0x88,0xfe,0x88,0xbf,0xd1,0x0a,0x62,0xcc,0x00,0x4f,0x40,0x0c,0xc0,0x32,0x01,0x00,
-0x09,0x00,0x01,0x12,0x00,0x01,0xc0,0x26,0x00,0x24,0x00,0x00,0x2d,0x00,0x0d,0x42,
-0x00,0x00,0x5a,0x00,0x01,0x75,0x0f,0x21,0xf1,0x01,0x3a,0x17,0x01,0x0a,0x09,0x00,
-0x7e,0x00,0x0c,0x1b,0x00,0x0f,0x26,0x1f,0x1e,0x09,0x01,0x00,0x17,0x3a,0x83,0x11,
-0x17,0x4b,0xff,0x0d,0x17,0x5c,0x64,0x09,0x13,0x6e,0xb9,0x08,0x00,0x4b,0x01,0x02,
-0xcd,0x19,0x02,0x21,0xa7,0x16,0x9f,0x49,0x02,0x00,0x05,0xb3,0x04,0xbc,0x0b,0x13,
-0x04,0x81,0x20,0x01,0xc4,0x29,0x15,0xdf,0xc8,0x01,0x02,0xbf,0x11,0x04,0xd7,0x03,
-0x17,0x0d,0x01,0x1c,0x07,0x77,0x1b,0x01,0xcd,0x2d,0x08,0x3d,0x13,0x55,0x57,0x88,
-0x88,0x88,0x8c,0xc3,0x97,0x03,0x95,0x02,0x18,0xf9,0xd2,0x38,0x18,0xf2,0x0d,0x00,
-0x18,0xa0,0x0d,0x00,0x17,0x30,0x0d,0x00,0x18,0xfc,0x06,0x39,0x18,0xf4,0x0d,0x00,
-0x17,0xd0,0xd0,0x1d,0x07,0xfb,0x10,0x15,0x05,0x57,0x0a,0x01,0x41,0x0a,0x0e,0x40,
-0x01,0x02,0x8b,0x0b,0x43,0x80,0xe4,0x00,0x00,0xe5,0x07,0x14,0x40,0x09,0x00,0x24,
-0xf4,0x00,0xf7,0x07,0x14,0x40,0x09,0x00,0x14,0xf4,0x09,0x00,0x15,0xfe,0xda,0x00,
-0x02,0xf4,0x02,0x3f,0x88,0x88,0x88,0x9b,0x18,0x7c,0x0f,0x99,0x0b,0x02,0x55,0x03,
-0x56,0x77,0x65,0x30,0x76,0x0a,0x11,0x7c,0x29,0x00,0x23,0xc7,0x20,0xf3,0x58,0x04,
-0x50,0x07,0x11,0x50,0x50,0x05,0x09,0x30,0x11,0x00,0x81,0x04,0x72,0xc9,0x65,0x44,
-0x56,0x9c,0xff,0xff,0x0d,0x5a,0x22,0xfd,0x61,0x09,0x15,0x50,0xdf,0xff,0xff,0xc1,
-0xdf,0x73,0x1b,0x04,0x74,0x8e,0x24,0xff,0xfd,0xae,0x0f,0x03,0xdf,0x49,0x20,0x09,
-0xf6,0x3c,0x8e,0x40,0xcd,0xff,0xdc,0x84,0xcd,0x03,0x33,0x90,0x00,0x10,0x89,0x02,
-0x23,0xff,0xe6,0x7e,0x1e,0x19,0x3d,0xdb,0x02,0x10,0x05,0x58,0x02,0x36,0xcc,0xef,
-0xff,0x2c,0x06,0x54,0xc5,0x10,0x00,0x01,0x5c,0x43,0x0c,0x22,0xaf,0xe4,0xb7,0x9a,
-0x13,0xfa,0x08,0x06,0x12,0x10,0xcf,0x02,0x07,0x87,0x46,0x04,0x66,0x6f,0x04,0xb0,
-0x23,0x1a,0xc1,0xec,0x01,0x09,0x17,0x01,0x07,0x8d,0x0c,0x02,0x9d,0x0c,0x06,0xb9,
-0xb4,0x03,0xd6,0x32,0x08,0x70,0x13,0x01,0x96,0x50,0x06,0xcb,0x09,0x02,0x01,0x00,
-0x3a,0x30,0x00,0x6f,0x6b,0x12,0x0a,0x50,0x08,0x34,0x60,0xff,0xfb,0x7f,0x18,0x00,
-0xde,0x09,0x16,0xa1,0xa0,0x0d,0x01,0xcd,0x25,0x0c,0x05,0x06,0x07,0x0f,0x00,0x29,
-0x05,0xbf,0x0f,0x00,0x2f,0x00,0x0f,0x0f,0x00,0x09,0x3d,0x02,0x4f,0xff,0x4b,0x00,
-0x0a,0x31,0x3c,0x16,0xf4,0xb3,0x00,0x3a,0x4a,0xff,0xd7,0x33,0x02,0x29,0x70,0xbf,
-0x0f,0x00,0x37,0x30,0x18,0xbb,0x01,0x00,0x1f,0xa4,0xf0,0x00,0x3b,0x05,0xe5,0x2b,
-0x01,0x96,0x00,0x07,0x0f,0x00,0x29,0x05,0xbf,0x0f,0x00,0x2f,0x00,0x0f,0x0f,0x00,
-0x09,0x29,0x02,0x4f,0x0f,0x00,0x0f,0xf0,0x00,0x88,0x15,0x8f,0xa8,0x0b,0x06,0xe0,
-0x01,0x02,0x7e,0x96,0x05,0xe0,0x01,0x05,0xc6,0x0b,0x0f,0x0f,0x00,0x07,0x29,0x02,
-0x4f,0x0f,0x00,0x0f,0xe0,0x01,0x8b,0x16,0x40,0x96,0x00,0x07,0x0f,0x00,0x04,0xe0,
-0x01,0x17,0x40,0xa0,0x10,0x0f,0x0f,0x00,0x06,0x29,0x02,0x4f,0x0f,0x00,0x0f,0xf0,
-0x00,0x88,0x0a,0x96,0x00,0x17,0xf0,0x43,0x5e,0x19,0xbf,0x0f,0x00,0x09,0x9c,0x11,
-0x0d,0x0f,0x00,0x2d,0x02,0x4f,0xe1,0x00,0x0f,0xf0,0x00,0x37,0x0d,0x9d,0x95,0x12,
-0x00,0x52,0x9c,0x18,0xfe,0x6c,0x1d,0x29,0x27,0x7d,0xfd,0x04,0x1a,0x4f,0x82,0x00,
-0x38,0x0e,0xf5,0x3a,0x3a,0x05,0x57,0x07,0xf6,0x00,0x09,0xda,0x25,0x15,0x17,0xed,
-0x62,0x07,0x43,0xfe,0x50,0x00,0x6f,0x8f,0x05,0x11,0xa4,0x39,0x06,0x33,0x30,0x1e,
-0xe0,0xf3,0x00,0x83,0xfa,0x10,0x0e,0xff,0xff,0xfd,0xbe,0xfe,0x9a,0x00,0x3a,0xff,
-0xff,0x60,0x6d,0x01,0x21,0xfb,0x0a,0x69,0x10,0x22,0x1c,0xf3,0x9d,0x05,0x31,0xd4,
-0x00,0x1c,0x23,0x08,0x21,0x2f,0xa0,0x83,0x00,0x00,0x46,0xbb,0x11,0x63,0xc5,0x05,
-0x1a,0x20,0xd4,0x06,0x38,0xfb,0x00,0x8f,0xaa,0x05,0x48,0x0a,0xf8,0x4b,0xff,0x09,
-0x51,0x1b,0x0b,0xab,0x68,0x29,0x03,0x5c,0x1f,0x00,0x00,0x61,0x11,0x19,0xf5,0x51,
-0x00,0x14,0x11,0xda,0x1b,0x45,0x8c,0xef,0xfe,0xa6,0x31,0x19,0x00,0x2e,0x01,0x12,
-0x0c,0x02,0x08,0x11,0x40,0x3f,0x0b,0x10,0x05,0x86,0x17,0x10,0x02,0x28,0x01,0x10,
-0x05,0x15,0x07,0x00,0x46,0x09,0x00,0xdc,0x0f,0xf0,0x03,0xe0,0x0e,0xff,0xfc,0xff,
-0xf0,0x16,0x07,0xff,0xff,0x21,0xff,0xf8,0x09,0xff,0x01,0xf6,0x07,0x77,0x37,0x80,
-0xd1,0x09,0xf0,0x1f,0x70,0x6f,0xff,0x86,0x8f,0x2e,0x60,0x01,0x70,0x5f,0xff,0xf9,
-0x7f,0x63,0x15,0x00,0x19,0x19,0x10,0xa7,0x35,0x4b,0x00,0x35,0x11,0x20,0xfb,0x7f,
-0xbc,0x01,0x00,0x00,0x07,0x14,0xb7,0x2c,0x20,0xf0,0x0d,0xfa,0x6f,0xff,0xff,0x40,
+0x08,0xce,0x06,0x22,0x77,0x00,0x82,0x0e,0x21,0xf6,0x00,0xac,0x09,0x11,0x10,0x3c,
+0x04,0x1a,0xa0,0x90,0x02,0x21,0xcf,0xf9,0x31,0x03,0x0f,0x06,0x00,0x17,0x01,0x5b,
+0x03,0xf0,0x09,0xaf,0xfe,0x10,0x09,0xff,0xf2,0x6f,0xff,0xec,0xef,0xff,0xf2,0x0d,
+0xff,0xff,0xff,0xff,0xf2,0x01,0xae,0xfe,0x92,0xff,0xf2,0xf3,0x08,0x00,0x00,0x00,
+0xef,0xfa,0x00,0x00,0x00,0x08,0xff,0xb0,0x00,0x00,0x00,0x3f,0xfc,0x00,0x00,0x00,
+0x00,0x7a,0xa1,0x00,0x01,0x00,0x6f,0xcf,0xf9,0x00,0x03,0xff,0xf2,0x06,0x00,0x18,
+0x10,0xfa,0x06,0x00,0xf0,0x1d,0xaf,0xfe,0x10,0x09,0xff,0xf2,0x6f,0xff,0xec,0xef,
+0xff,0xf2,0x0d,0xff,0xff,0xff,0xff,0xf2,0x01,0xae,0xfe,0x92,0xff,0xf2,0x00,0x01,
+0xcf,0xf4,0x00,0x00,0x00,0x2d,0xfd,0xff,0x50,0x00,0x04,0xef,0xa0,0x4f,0xf7,0x00,
+0x01,0x22,0x03,0x00,0x0f,0x6c,0x00,0x41,0xc2,0x05,0xed,0x10,0x08,0xfa,0x00,0x0b,
+0xff,0x60,0x0f,0xff,0x20,0x0c,0x00,0x0f,0xd2,0x00,0x42,0xf4,0x08,0x00,0x00,0x8f,
+0xfe,0x10,0x00,0x00,0x00,0x2f,0xff,0x30,0x00,0x00,0x00,0x0c,0xff,0x40,0x00,0x00,
+0x00,0x03,0xaa,0x50,0x40,0x01,0x30,0x0c,0xff,0xd0,0x04,0x00,0xf1,0x28,0x7f,0xff,
+0x20,0x01,0xff,0xf7,0x01,0xff,0xf6,0x00,0x5f,0xff,0x20,0x0c,0xff,0xb0,0x0a,0xff,
+0xc0,0x00,0x6f,0xff,0x00,0xff,0xf7,0x00,0x01,0xff,0xf5,0x4f,0xff,0x20,0x00,0x0b,
+0xff,0x98,0xff,0xc0,0x00,0x00,0x5f,0xfe,0xdf,0xf6,0x00,0x00,0x00,0xff,0xff,0xff,
+0x10,0x00,0x00,0x0a,0xff,0x93,0x01,0x30,0x5f,0xff,0xf6,0x4a,0x00,0x00,0x13,0x00,
+0x00,0x14,0x00,0x11,0xb0,0xc5,0x00,0x10,0xf5,0x06,0x00,0xf0,0x00,0x4f,0xff,0x00,
+0x00,0x00,0x07,0xdf,0xff,0x90,0x00,0x00,0x00,0x9f,0xff,0xe1,0xc5,0x01,0x20,0xfe,
+0xa2,0x19,0x00,0x2f,0xaf,0xfb,0x06,0x00,0x0b,0x50,0x5c,0xfe,0xa2,0x00,0xaf,0xc6,
+0x00,0xd0,0x30,0xaf,0xff,0xfd,0xef,0xff,0xd0,0xaf,0xfe,0x20,0x08,0xff,0xf4,0x1e,
+0x00,0x20,0xef,0xf8,0x06,0x00,0x40,0xbf,0xfa,0xaf,0xfb,0x28,0x00,0x06,0x0c,0x00,
+0x23,0xef,0xf8,0x24,0x00,0x20,0xff,0xfc,0x30,0x00,0x02,0x3c,0x00,0x02,0x48,0x00,
+0x0f,0x6c,0x00,0x0a,0xf1,0x00,0x01,0xcf,0x60,0x03,0xed,0x20,0x00,0x5f,0xfc,0x00,
+0x9f,0xf8,0x00,0x01,0xce,0x0d,0x00,0x03,0x88,0x01,0x10,0xfd,0x04,0x00,0xf0,0x0f,
+0x07,0xff,0xf2,0x00,0x1f,0xff,0x70,0x1f,0xff,0x60,0x05,0xff,0xf2,0x00,0xcf,0xfb,
+0x00,0xaf,0xfc,0x00,0x06,0xff,0xf0,0x0f,0xff,0x70,0x00,0x1f,0xff,0x54,0x60,0x01,
+0xf0,0x02,0xbf,0xf9,0x8f,0xfc,0x00,0x00,0x05,0xff,0xed,0xff,0x60,0x00,0x00,0x0f,
+0xff,0xff,0xf1,0x5c,0x00,0x30,0xff,0xfb,0x00,0x14,0x00,0x30,0xff,0x60,0x00,0x14,
+0x00,0x16,0xf1,0x70,0x00,0x20,0x0c,0xff,0x7b,0x01,0xe1,0x04,0xff,0xf0,0x00,0x00,
+0x00,0x7d,0xff,0xf9,0x00,0x00,0x00,0x09,0xff,0xa0,0x01,0x22,0x8f,0xea,0x79,0x00,
+0x40,0xef,0xff,0xff,0xff,0x0a,0x00,0x10,0x0e,0xc4,0x01,0x1e,0x00,0x01,0x00,0x03,
+0x9a,0x00,0x11,0x00,0xd3,0x01,0x00,0xad,0x02,0x00,0x1a,0x03,0x21,0xff,0xa0,0x09,
+0x00,0x31,0xdf,0xff,0xff,0x08,0x00,0x51,0x3f,0xff,0xef,0xf6,0x00,0x5b,0x00,0x31,
+0xb9,0xff,0xc0,0x9c,0x01,0x10,0xf6,0xc4,0x01,0x00,0xab,0x01,0xe0,0x10,0xef,0xf8,
+0x00,0x00,0x00,0x0b,0xff,0xb0,0x09,0xff,0xd0,0x00,0x00,0xf1,0x01,0x10,0x4f,0x13,
+0x02,0x31,0x7f,0xff,0x10,0x66,0x03,0x01,0x3b,0x02,0x40,0xff,0xf0,0x00,0x03,0x08,
+0x00,0x00,0xbf,0x00,0xb0,0x9f,0xff,0xee,0xee,0xee,0xff,0xfc,0x00,0x0f,0xff,0xc0,
+0x50,0x00,0x41,0xf2,0x05,0xff,0xf6,0x61,0x00,0x31,0x80,0xbf,0xff,0x72,0x00,0x10,
+0xfe,0xda,0x01,0x30,0xff,0xff,0x80,0x85,0x00,0x2b,0xff,0xf8,0xa9,0x00,0x40,0x05,
+0xbe,0xfe,0xb4,0x6d,0x00,0x80,0xff,0xff,0xf7,0x00,0x08,0xff,0xfa,0x8d,0x42,0x01,
+0x10,0xf9,0x4f,0x01,0x01,0x3b,0x00,0x90,0xf8,0x00,0x01,0x8c,0xef,0xff,0xff,0x90,
+0x03,0xf3,0x00,0xf0,0x10,0xf9,0x00,0xdf,0xfd,0x30,0x0d,0xff,0x90,0x2f,0xff,0x40,
+0x00,0xdf,0xf9,0x02,0xff,0xf5,0x00,0x2f,0xff,0x90,0x0e,0xff,0xfa,0xbf,0xff,0xf9,
+0x00,0x5f,0xff,0xff,0xe2,0x00,0xd0,0x4b,0xff,0xc6,0x7f,0xfe,0x00,0x00,0x00,0x78,
+0x40,0x02,0x88,0x10,0x4b,0x01,0x42,0xfd,0x21,0xaf,0xf0,0x67,0x02,0x21,0xff,0xf7,
+0x70,0x00,0x3a,0x3a,0xde,0xb4,0x81,0x00,0x00,0xde,0x02,0x00,0x01,0x00,0x20,0x02,
+0xff,0xf8,0x02,0x00,0x66,0x01,0x12,0xff,0x67,0x03,0x10,0x0d,0xe5,0x00,0x00,0x0a,
+0x03,0x21,0xff,0xfe,0xa4,0x01,0x61,0x00,0x9f,0xfb,0x9f,0xfc,0x00,0xad,0x01,0x31,
+0x64,0xff,0xf2,0xbc,0x01,0xb0,0xf1,0x0e,0xff,0x80,0x00,0x00,0x00,0xbf,0xfb,0x00,
+0x9f,0x70,0x01,0x40,0x1f,0xff,0x60,0x04,0x70,0x01,0x50,0x07,0xff,0xf1,0x00,0x0e,
+0x70,0x01,0x11,0xdf,0x22,0x01,0x00,0x0c,0x01,0x00,0x01,0x00,0x10,0xf6,0xc8,0x01,
+0x81,0xee,0xee,0xef,0xff,0xc0,0x00,0xff,0xfc,0xef,0x02,0x40,0x20,0x5f,0xff,0x60,
+0x61,0x00,0x41,0xf8,0x0b,0xff,0xf0,0x72,0x00,0x70,0xe0,0x00,0x8f,0xe2,0x03,0xff,
+0x70,0x8d,0x00,0x00,0x0c,0x03,0x4c,0x02,0xae,0xfd,0x92,0xda,0x01,0xf0,0x01,0x5b,
+0xef,0xeb,0x40,0x00,0x00,0xbf,0xff,0xff,0xff,0x70,0x00,0x8f,0xff,0xa8,0xdf,0x8c,
+0x03,0x42,0x90,0x01,0xff,0xf7,0xb3,0x00,0x40,0x80,0x00,0x18,0xce,0x2a,0x01,0x10,
+0x3e,0x71,0x00,0x41,0x90,0x0d,0xff,0xd3,0x2a,0x01,0x21,0xf4,0x00,0x37,0x01,0xc0,
+0x50,0x02,0xff,0xf9,0x00,0xef,0xff,0xab,0xff,0xff,0x90,0x05,0x20,0x00,0x8f,0xfa,
+0x00,0x04,0xbf,0xfc,0x67,0xff,0xe0,0x30,0x02,0x7f,0x00,0x01,0x00,0x22,0x6f,0xf6,
+0x08,0x00,0x11,0x1f,0xb9,0x01,0x00,0x27,0x01,0x13,0x83,0x11,0x00,0x04,0xf5,0x02,
+0x3f,0x4d,0xfd,0x20,0x40,0x02,0x38,0x91,0xfe,0xff,0xb0,0x00,0x4b,0xff,0xc4,0x8f,
+0xfd,0x08,0x01,0x01,0xa8,0x02,0x22,0x0a,0xfd,0x4d,0x03,0x21,0xd3,0x20,0xfa,0x00,
+0x10,0xf9,0x0d,0x00,0x31,0x1a,0xfe,0x70,0x0d,0x00,0x11,0xe1,0x16,0x01,0x21,0xfe,
+0x20,0x68,0x00,0x2a,0xf3,0x00,0x33,0x05,0x10,0x00,0x78,0x00,0x20,0xea,0x40,0x1e,
+0x01,0x01,0x67,0x01,0x01,0xfa,0x00,0xb0,0xb0,0x0e,0xff,0xe4,0x00,0x2b,0xff,0xf4,
+0x5f,0xff,0x40,0xb0,0x06,0x10,0xaf,0x5d,0x00,0x32,0x9e,0xec,0xdf,0x6e,0x02,0x2e,
+0xff,0xf9,0x07,0x00,0x01,0xd5,0x06,0x00,0x60,0x02,0x00,0x2a,0x00,0x50,0x8c,0xca,
+0x6f,0xff,0x30,0x13,0x00,0x82,0x0f,0xff,0xd3,0x00,0x1a,0xff,0xf5,0x05,0x54,0x00,
+0x40,0x00,0x6f,0xff,0xff,0x4a,0x04,0x41,0x02,0x9d,0xff,0xea,0xc0,0x02,0x01,0x26,
+0x00,0x31,0x01,0xef,0xf4,0x69,0x05,0x10,0x60,0xb1,0x00,0x15,0xa7,0x95,0x00,0x20,
+0x03,0xae,0x2d,0x01,0x10,0x6f,0x8d,0x03,0xf2,0x03,0x03,0xff,0xff,0xcf,0xff,0xf4,
+0x0b,0xff,0xd1,0x01,0xcf,0xfa,0x0f,0xff,0x60,0x00,0x5e,0xec,0xfe,0x05,0x35,0x3f,
+0xff,0x20,0x0a,0x06,0xf2,0x03,0x0f,0xff,0x50,0x00,0x39,0x98,0x0b,0xff,0xd1,0x00,
+0xbf,0xfb,0x03,0xff,0xff,0xce,0xff,0xf4,0x3c,0x00,0x03,0x48,0x00,0x20,0x00,0x07,
+0xfe,0x02,0x00,0xe9,0x01,0x11,0xf8,0x32,0x02,0x10,0x53,0x0f,0x00,0x5f,0x28,0x84,
+0x00,0x38,0x82,0x06,0x01,0x6e,0x10,0x4f,0x49,0x05,0xe0,0x06,0xff,0xef,0xc1,0x00,
+0x00,0x8f,0xf5,0x1c,0xfd,0x10,0x00,0x44,0x20,0x03,0x00,0x0f,0x06,0x01,0x42,0x46,
+0x03,0xee,0x40,0x00,0xd6,0x06,0x12,0x06,0x7a,0x02,0x3f,0x00,0x12,0x00,0x0c,0x02,
+0x6f,0x21,0x1d,0xf7,0x9f,0x01,0x11,0xfe,0xaa,0x02,0x11,0xfa,0x8a,0x00,0x1f,0x20,
+0x0c,0x02,0x44,0x50,0x2e,0xfc,0x10,0xbf,0xf5,0xa4,0x03,0x11,0xcb,0x74,0x02,0x12,
+0x4f,0xf0,0x07,0x3a,0x05,0xdd,0x70,0x06,0x01,0x12,0x50,0x06,0x01,0x22,0xfc,0x10,
+0x06,0x01,0x10,0xc0,0x06,0x01,0x31,0x19,0xff,0xf6,0x06,0x01,0x21,0xdf,0xfb,0x06,
+0x01,0x2f,0x58,0x87,0x06,0x01,0x15,0x26,0xae,0xec,0x06,0x01,0x00,0x4c,0x01,0x08,
+0x06,0x01,0x15,0xfa,0x06,0x01,0xa0,0xcf,0xe2,0x08,0xff,0x70,0x00,0x0b,0xfe,0x9f,
+0xf6,0x38,0x00,0x01,0xe4,0x05,0x2f,0x05,0x53,0x06,0x01,0x43,0x30,0x1d,0xfd,0x10,
+0x66,0x00,0x31,0x01,0xdf,0xda,0xc2,0x07,0x31,0x1d,0xff,0xf5,0xf8,0x00,0x26,0x78,
+0x40,0x05,0x01,0x51,0x7f,0xff,0xff,0xfd,0x82,0x07,0x00,0x00,0x0a,0x05,0x30,0x7f,
+0xff,0xee,0x12,0x07,0x90,0x7f,0xff,0x00,0x03,0xcf,0xff,0x40,0x7f,0xff,0x2d,0x05,
+0x30,0xc0,0x7f,0xff,0x46,0x02,0x30,0xf2,0x7f,0xff,0x94,0x06,0x30,0xf6,0x7f,0xff,
+0xfd,0x00,0x12,0xf7,0x07,0x00,0x17,0xf8,0x0e,0x00,0x03,0x1c,0x00,0x03,0x2a,0x00,
+0x02,0x38,0x00,0x11,0x02,0x46,0x00,0x42,0xdd,0xef,0xff,0xf9,0x62,0x00,0x14,0x70,
+0x70,0x00,0x02,0xc2,0x05,0x31,0x30,0xff,0x70,0x48,0x05,0x32,0xf3,0x0f,0xf6,0x11,
+0x00,0x32,0x33,0xff,0x20,0x11,0x00,0x23,0xaf,0xc0,0x11,0x00,0x81,0xb2,0x00,0x00,
+0x6d,0xfe,0x94,0xff,0xf3,0xa1,0x08,0x20,0xff,0xef,0xf5,0x00,0x10,0x5f,0x5f,0x09,
+0x10,0xf3,0x29,0x07,0x50,0xe2,0x00,0xaf,0xff,0x30,0x87,0x00,0x00,0x33,0x00,0x00,
+0x13,0x01,0x10,0x40,0x55,0x00,0x00,0x5b,0x0a,0x04,0x11,0x00,0x10,0x30,0x11,0x00,
+0x00,0x1c,0x06,0x22,0x00,0x03,0x33,0x00,0x32,0xc0,0x00,0x7f,0x44,0x00,0x28,0xd9,
+0xbf,0x55,0x00,0x00,0x66,0x00,0x31,0xa2,0xef,0xf3,0x58,0x01,0x32,0xff,0xfe,0xa4,
+0x08,0x00,0x30,0xff,0xff,0xb1,0x08,0x00,0x40,0xee,0xef,0xff,0xfd,0x08,0x00,0x50,
+0x60,0x01,0x8f,0xff,0xa0,0x08,0x00,0x41,0x00,0x08,0xff,0xf2,0x08,0x00,0x31,0x01,
+0xff,0xf8,0x08,0x00,0x41,0x00,0xcf,0xfb,0x3f,0x53,0x06,0x23,0xaf,0xfd,0x08,0x00,
+0x94,0xfe,0x02,0x4f,0xff,0x72,0x20,0x00,0xaf,0xfd,0x20,0x00,0x09,0x30,0x00,0x03,
+0x40,0x00,0x03,0x50,0x00,0x57,0xed,0xef,0xff,0xfd,0x10,0x70,0x00,0x35,0xff,0xfe,
+0xa5,0x21,0x01,0x00,0x08,0x08,0x51,0x25,0xff,0xf5,0x20,0x00,0x82,0x07,0x13,0xff,
+0x98,0x00,0x15,0xf0,0x1e,0x00,0x03,0x1c,0x01,0x03,0xc6,0x00,0x03,0x1a,0x01,0x04,
+0x19,0x01,0x03,0x18,0x01,0x03,0x17,0x01,0x04,0x16,0x01,0x04,0x15,0x01,0x03,0x14,
+0x01,0x04,0x13,0x01,0x04,0x12,0x01,0x04,0x11,0x01,0x03,0x10,0x01,0x11,0x8f,0xb6,
+0x01,0x02,0x2f,0x09,0x18,0x00,0x37,0x02,0x00,0x01,0x00,0x03,0x06,0x00,0x00,0x3f,
+0x07,0x32,0xed,0x7f,0xff,0x18,0x00,0x0e,0x06,0x00,0x00,0x58,0x03,0x04,0x06,0x00,
+0x4f,0xcc,0xcc,0xcc,0x90,0x2a,0x00,0x07,0x48,0xdd,0xdd,0xdd,0xdd,0x5a,0x00,0x21,
+0x00,0xaf,0x7e,0x00,0x11,0x09,0xac,0x08,0x0a,0x01,0x00,0x80,0x01,0x8d,0xff,0xc6,
+0x00,0x00,0x04,0xef,0x60,0x04,0xf1,0x05,0x01,0xef,0xff,0xcd,0xff,0xf8,0x00,0x8f,
+0xfe,0x20,0x07,0xff,0xf0,0x0e,0xff,0x70,0x00,0x0f,0xff,0x30,0x40,0x00,0x21,0xf5,
+0x2f,0x07,0x00,0x71,0x51,0xff,0xf9,0x55,0x55,0x55,0x51,0x02,0x09,0x00,0xe6,0x08,
+0xb1,0x60,0x00,0x6e,0x20,0x02,0xef,0xff,0xec,0xef,0xfd,0x00,0x88,0x07,0xf0,0x05,
+0x50,0x00,0x01,0x8c,0xff,0xd9,0x20,0x00,0x00,0x48,0x60,0x00,0x78,0x30,0x00,0x7f,
+0xf4,0x05,0xff,0x50,0x26,0x08,0x10,0xfc,0x67,0x00,0x2f,0xec,0x70,0xf3,0x00,0x5b,
+0x51,0x9f,0xe1,0x04,0xff,0x50,0x9c,0x08,0x10,0xe0,0x0e,0x04,0x2c,0xfd,0x91,0x70,
+0x09,0x71,0x18,0xdf,0xfc,0x60,0x00,0x00,0x4e,0x5a,0x04,0x90,0x1e,0xff,0xfc,0xdf,
+0xff,0x80,0x08,0xff,0xe2,0x50,0x00,0x71,0xef,0xf7,0x00,0x00,0xff,0xf3,0x0f,0x47,
+0x00,0x12,0x52,0x00,0x01,0x92,0x1f,0xff,0x95,0x55,0x55,0x55,0x10,0xef,0xfa,0x2a,
+0x09,0xb0,0xf6,0x00,0x06,0xe2,0x00,0x2e,0xff,0xfe,0xce,0xff,0xd0,0x91,0x09,0x00,
+0x0f,0x04,0x21,0x18,0xcf,0xd2,0x09,0x22,0x0b,0xfa,0x95,0x0a,0x00,0xa4,0x0a,0x12,
+0x1e,0x65,0x08,0x1f,0x20,0xec,0x01,0x5c,0x31,0x00,0x0c,0xf9,0xa3,0x05,0x02,0xde,
+0x02,0x22,0x1e,0xfc,0x05,0x0b,0x0f,0xf9,0x00,0x46,0x50,0x18,0xcf,0xfd,0x92,0x00,
+0x20,0x7f,0xff,0x01,0x00,0x04,0x06,0x00,0xae,0xee,0xee,0xee,0xed,0x7f,0xff,0x00,
+0x00,0x00,0x00,0x06,0x00,0x01,0x24,0x00,0x14,0xc0,0x06,0x00,0x4f,0xcc,0xcc,0xcc,
+0x90,0x2a,0x00,0x07,0x47,0xdd,0xdd,0xdd,0xdd,0x5a,0x00,0x00,0x16,0x00,0x20,0x5f,
+0xf7,0x1b,0x00,0x81,0xef,0x80,0x00,0x00,0x00,0x02,0xff,0x93,0x0c,0x00,0xf0,0x05,
+0xff,0x30,0x00,0x00,0x00,0x3c,0xfd,0x30,0x00,0x01,0x8d,0xfe,0xb5,0x00,0x00,0x03,
+0xef,0xff,0xff,0xf9,0x17,0x00,0xf1,0x09,0xde,0xff,0xf6,0x00,0x8f,0xff,0x30,0x09,
+0xff,0xd0,0x0d,0xff,0x90,0x00,0x1f,0xff,0x20,0xff,0xf9,0x55,0x55,0xff,0xf4,0x2f,
+0x4b,0x00,0x11,0x52,0x06,0x00,0x40,0xf5,0x0f,0xff,0x60,0x44,0x00,0xe1,0xcf,0xfd,
+0x00,0x00,0x05,0x00,0x05,0xff,0xfc,0x53,0x5c,0xf6,0x00,0x0a,0x9c,0x00,0xf2,0x01,
+0x00,0x08,0xff,0xff,0xff,0xa1,0x00,0x00,0x01,0x6d,0xff,0x50,0x00,0x00,0x00,0x01,
+0x29,0x00,0x31,0x4f,0xf7,0x40,0x0d,0x00,0xf0,0x0a,0xff,0x10,0x00,0x00,0x00,0x05,
+0xdf,0xc1,0x00,0x00,0xaf,0xf4,0x05,0xff,0xa0,0x00,0x0a,0xff,0x8f,0xf9,0x00,0x00,
+0x00,0xaf,0xff,0x99,0x00,0x33,0x06,0x86,0x00,0x01,0x00,0x0f,0x17,0x01,0x54,0xf2,
+0x00,0xaf,0xf3,0x06,0xff,0x90,0x00,0x00,0xaf,0xf9,0xff,0x70,0x00,0x00,0x00,0x9f,
+0xab,0x00,0x35,0x55,0x30,0x00,0x01,0x00,0xf0,0x06,0x18,0xdf,0xfc,0x60,0x00,0x00,
+0x4e,0xff,0xff,0xff,0xb0,0x00,0x1e,0xff,0xfc,0xdf,0xff,0x80,0x08,0xff,0xe2,0x50,
+0x00,0x78,0xef,0xf7,0x00,0x00,0xff,0xf3,0x0f,0x13,0x01,0x90,0x1f,0xff,0x95,0x55,
+0x55,0x55,0x10,0xef,0xfa,0x39,0x00,0xf0,0x00,0x09,0xff,0xf6,0x00,0x06,0xe2,0x00,
+0x2e,0xff,0xfe,0xce,0xff,0xd0,0x00,0x3e,0x20,0x00,0x60,0x00,0x00,0x18,0xcf,0xfd,
+0x92,0xe7,0x00,0x00,0x74,0x00,0x00,0x07,0x00,0x01,0x08,0x00,0xc7,0x07,0xff,0x63,
+0xef,0xa0,0x00,0x00,0x01,0x78,0x40,0x02,0x88,0x7a,0x00,0x52,0x17,0xce,0xfe,0xb6,
+0x00,0x7b,0x00,0xf0,0x0b,0xfd,0x20,0x00,0x3f,0xff,0xff,0xef,0xff,0xfe,0x00,0x0d,
+0xff,0xf5,0x00,0x08,0xff,0xf7,0x04,0xff,0xf6,0x00,0x00,0x0b,0xff,0xd0,0x9f,0xd8,
+0x00,0x51,0x38,0x87,0x0c,0xff,0xc0,0x33,0x00,0x21,0xdf,0xfb,0x07,0x00,0xf0,0x00,
+0x0e,0xff,0xa0,0x00,0xbf,0xff,0xff,0xf0,0xdf,0xfb,0x00,0x0b,0xff,0xff,0xff,0x1e,
+0x00,0x61,0x69,0x9c,0xff,0xf0,0x9f,0xff,0x04,0x01,0x30,0x04,0xff,0xf7,0x74,0x00,
+0x80,0xf0,0x0d,0xff,0xf7,0x00,0x01,0xbf,0xff,0x5a,0x00,0x41,0xde,0xff,0xff,0xe0,
+0xa3,0x00,0x80,0xff,0xc2,0x00,0x00,0x16,0xce,0xfe,0xd9,0xab,0x01,0xf5,0x08,0x2e,
+0xfd,0x20,0x00,0x00,0x00,0x3e,0xfe,0xfe,0x20,0x00,0x00,0x4f,0xf9,0x09,0xfe,0x30,
+0x00,0x04,0x44,0x00,0x04,0x43,0xa0,0x00,0x40,0x5c,0xff,0xb3,0xbf,0x27,0x02,0xf0,
+0x02,0xff,0xfe,0xff,0x60,0x4f,0xff,0xfd,0xdf,0xff,0xf6,0x0b,0xff,0xf3,0x00,0x5f,
+0xff,0x60,0x44,0x02,0xb2,0xff,0xf6,0x2f,0xff,0x50,0x00,0x0f,0xff,0x62,0xff,0xf3,
+0x0d,0x00,0x95,0x40,0x00,0x0f,0xff,0x60,0xff,0xf8,0x00,0x00,0x27,0x00,0x02,0x34,
+0x00,0x20,0x00,0x8f,0x77,0x00,0x10,0x60,0x4e,0x00,0x20,0xff,0xf6,0x57,0x00,0xf0,
+0x14,0x3f,0xff,0x40,0x06,0xb1,0x00,0x0b,0xff,0xf1,0x02,0xff,0xfb,0xbe,0xff,0xf8,
+0x00,0x1c,0xff,0xff,0xff,0xfa,0x00,0x00,0x06,0xbe,0xfe,0xa4,0x00,0x00,0x00,0x0d,
+0xf9,0x00,0x4f,0xf2,0x2f,0x02,0x30,0xe2,0x1b,0xfe,0xc9,0x02,0x21,0xef,0xff,0xb3,
+0x01,0x5f,0x02,0xae,0xec,0x40,0x00,0x3b,0x01,0x76,0x20,0x8f,0xe0,0x67,0x03,0x60,
+0x04,0xff,0x60,0x6f,0xf4,0x00,0x47,0x00,0x00,0x5b,0x00,0x4f,0x08,0xde,0xd7,0x00,
+0x3b,0x01,0x6b,0x41,0x00,0x02,0xde,0x50,0x7e,0x00,0x21,0x8f,0xfd,0x07,0x00,0x10,
+0x04,0x72,0x03,0x00,0x93,0x03,0x00,0xe7,0x01,0x0f,0x76,0x02,0x76,0x11,0x0a,0x3d,
+0x03,0x31,0x03,0xff,0xf2,0x53,0x00,0x02,0xaa,0x00,0x2f,0x02,0x00,0x3b,0x01,0x6c,
+0xf0,0x03,0x01,0x7c,0xef,0xeb,0x60,0x00,0x00,0x04,0xef,0xff,0xff,0xff,0xd2,0x00,
+0x03,0xff,0xff,0xfe,0xbb,0x00,0x80,0xdf,0xff,0x50,0x00,0x8f,0xff,0x70,0x4f,0x82,
+0x02,0xc1,0xbf,0xfd,0x09,0xff,0xf0,0x00,0x00,0x03,0x88,0x70,0xcf,0xfc,0xa8,0x00,
+0x41,0x0d,0xff,0xb0,0x00,0x64,0x05,0x11,0xfa,0x0e,0x01,0x00,0x0f,0x00,0x00,0x1d,
+0x01,0x70,0xcf,0xfc,0x00,0x06,0x99,0xcf,0xff,0x2d,0x00,0x00,0x0e,0x01,0x31,0x4f,
+0xff,0x70,0x9d,0x04,0xb0,0xdf,0xff,0x70,0x00,0x1b,0xff,0xf0,0x03,0xff,0xff,0xfd,
+0x70,0x01,0x10,0x03,0x69,0x00,0x88,0xfc,0x20,0x00,0x01,0x6c,0xef,0xed,0x94,0x9e,
+0x01,0x12,0xbf,0x72,0x01,0x32,0x0c,0xfb,0x00,0x5d,0x00,0x11,0x70,0x07,0x00,0x22,
+0x5f,0xf1,0x27,0x01,0x13,0xa7,0x26,0x00,0x11,0x21,0x06,0x00,0x30,0x1e,0xf5,0x00,
+0x78,0x02,0x21,0xff,0x20,0xa7,0x05,0x11,0xe0,0x95,0x00,0x12,0xfc,0x37,0x00,0x2b,
+0xc0,0x00,0x01,0x00,0x60,0x05,0xcf,0xfb,0x3b,0xff,0x60,0xb8,0x05,0xf1,0x03,0xef,
+0xf6,0x04,0xff,0xff,0xdd,0xff,0xff,0x60,0xbf,0xff,0x30,0x05,0xff,0xf6,0x0f,0xff,
+0x90,0x50,0x01,0x12,0xf5,0x50,0x01,0x11,0x30,0x0d,0x00,0x30,0xf4,0x00,0x00,0x1a,
+0x00,0x34,0x80,0x00,0x0f,0x27,0x00,0x03,0x34,0x00,0x10,0x08,0x56,0x01,0x10,0xf6,
+0x4e,0x00,0x31,0x3f,0xff,0x60,0xc7,0x01,0xf1,0x0b,0xf4,0x00,0x6b,0x10,0x00,0xbf,
+0xff,0x10,0x2f,0xff,0xbb,0xef,0xff,0x80,0x01,0xcf,0xff,0xff,0xff,0xa0,0x00,0x00,
+0x6b,0xef,0xea,0x40,0xbe,0x03,0x22,0xd1,0x00,0xc5,0x03,0x20,0xd1,0x00,0x7e,0x06,
+0x20,0xb1,0xbf,0x08,0x00,0x53,0x78,0x70,0x00,0x78,0x50,0x99,0x00,0x00,0x24,0x01,
+0x00,0x35,0x06,0x11,0xf6,0xc1,0x05,0x3f,0x1f,0xff,0x67,0x0f,0x00,0x14,0x01,0x01,
+0x00,0x12,0x67,0x07,0x00,0x11,0xf6,0xf7,0x05,0x3f,0xdf,0xff,0x67,0x4b,0x00,0x21,
+0x30,0x00,0x01,0x78,0x93,0x05,0xf3,0x01,0x1c,0xff,0xe3,0x00,0x00,0x01,0xdf,0xda,
+0xfe,0x30,0x00,0x1d,0xfc,0x10,0x9f,0xe3,0x9e,0x00,0x2f,0xcf,0xf9,0x06,0x00,0x0b,
+0xff,0x11,0x3b,0xff,0xc4,0x00,0xcf,0xfd,0xff,0xff,0xff,0x40,0xcf,0xff,0xfc,0xef,
+0xff,0xc0,0xcf,0xfd,0x10,0x09,0xff,0xf0,0xcf,0xf9,0x00,0x04,0xff,0xf2,0xcf,0xf9,
+0x00,0x03,0x06,0x00,0x19,0x30,0x04,0xff,0xf3,0xbb,0x01,0x25,0xf9,0x00,0x09,0x00,
+0xb2,0x05,0xff,0xf4,0x11,0x11,0x11,0xef,0xf9,0x10,0xaf,0xff,0x01,0x00,0x15,0xf0,
+0x09,0x00,0x0e,0x2d,0x00,0x12,0x04,0x1a,0x00,0x09,0x09,0x00,0x59,0xfe,0xdd,0xdd,
+0xdd,0xff,0x24,0x00,0x0f,0x09,0x00,0x21,0x21,0x00,0x6f,0x5d,0x07,0x50,0x12,0x8f,
+0xff,0x22,0x10,0xc8,0x07,0x01,0xd5,0x06,0x03,0x07,0x00,0x02,0x1c,0x00,0x00,0x07,
+0x00,0x30,0x19,0xef,0xd8,0x07,0x00,0x10,0xdf,0x00,0x02,0x10,0x6f,0x84,0x03,0x50,
+0xf2,0x00,0x6f,0xff,0x50,0x52,0x04,0x00,0x23,0x00,0x21,0xef,0xf8,0x07,0x00,0x1f,
+0xdf,0x07,0x00,0x1f,0xf2,0x03,0x09,0xed,0x71,0x4f,0xd7,0xff,0xff,0xff,0xf8,0xdf,
+0x63,0x9f,0xfb,0x02,0x20,0x00,0x01,0x00,0xdd,0x04,0x00,0xa5,0x02,0x3f,0x4f,0xff,
+0x40,0x09,0x00,0x31,0x61,0x01,0xbf,0xc5,0x07,0xf9,0x0a,0xf4,0x08,0x70,0xf4,0x4b,
+0xff,0x90,0x02,0x20,0x00,0xc3,0x08,0x02,0xc1,0x07,0x1f,0xf0,0x05,0x00,0x2a,0x00,
+0xa9,0x02,0x11,0x88,0x8d,0x01,0x05,0x01,0x00,0x0f,0xb4,0x00,0x34,0x00,0x09,0x00,
+0x00,0x71,0x04,0x22,0xff,0x5b,0x79,0x08,0x04,0x01,0x00,0x23,0x6f,0xff,0x7f,0x00,
+0x0f,0x09,0x00,0x1e,0xff,0x02,0x48,0x70,0x00,0x78,0x46,0xff,0x50,0x5f,0xf6,0x0d,
+0xff,0xff,0xfd,0x00,0x08,0xce,0xc8,0x69,0x01,0x3f,0xf7,0x02,0xbf,0xb0,0x02,0xff,
+0x57,0xff,0x40,0x9f,0xf1,0x1d,0xff,0xff,0xf8,0x00,0x19,0xde,0xc5,0x66,0x01,0x0f,
+0xb9,0x00,0x21,0x00,0x55,0x00,0x0f,0x03,0x00,0x1d,0xf1,0x0c,0x0c,0xfc,0x10,0x8f,
+0xe0,0x00,0xbf,0xe3,0x20,0x8f,0xff,0xa0,0x09,0xee,0x80,0x03,0xdf,0x70,0x0a,0xff,
+0xf0,0x08,0xff,0xd0,0x00,0x67,0x10,0x4e,0x05,0x1f,0xe0,0x03,0x00,0x0e,0x50,0x09,
+0xff,0xe0,0x2e,0xf9,0xaa,0x05,0xf2,0x03,0xef,0xc3,0x10,0xbf,0xff,0x70,0x2b,0xfe,
+0x50,0x0a,0xfa,0x03,0xff,0xf2,0x0e,0xfd,0x00,0x02,0x30,0x01,0x3f,0x4f,0xff,0x44,
+0x05,0x00,0x12,0x2f,0x6f,0xff,0x02,0x00,0x05,0x00,0x31,0x01,0x00,0xaf,0x0a,0x1f,
+0xfe,0x09,0x00,0x53,0xf0,0x0d,0x7f,0xff,0x10,0x00,0xbf,0xfc,0x4f,0xff,0x40,0x5f,
+0xff,0x60,0x02,0xff,0xf9,0x4f,0xff,0x40,0x0e,0xff,0xfb,0xaf,0xff,0xf2,0x4f,0xff,
+0x40,0x03,0x4c,0x04,0x10,0x50,0x2d,0x00,0xf1,0x0b,0x18,0xdf,0xfd,0x92,0x00,0x3d,
+0xf7,0x00,0x0b,0xfb,0x0a,0xff,0xf0,0x05,0xff,0xf5,0x8f,0xfd,0x00,0x3f,0xff,0x20,
+0x67,0x10,0x00,0x47,0xd4,0x0a,0x00,0x3b,0x01,0x9f,0x02,0xff,0xf4,0x8f,0xfe,0x00,
+0x2f,0xff,0x48,0x0b,0x00,0x29,0x40,0x00,0x00,0x00,0x2f,0xb8,0x0c,0x10,0x06,0x23,
+0x08,0x61,0xad,0xff,0xfe,0x00,0x00,0x0c,0x04,0x0a,0x32,0xaf,0xfc,0x50,0x39,0x0c,
+0x12,0xf8,0xe5,0x08,0x21,0xff,0xf8,0xc0,0x00,0x20,0xf4,0x4f,0x08,0x00,0x57,0x28,
+0x83,0x00,0x38,0x82,0xf0,0x06,0x42,0x09,0xff,0xe0,0x00,0xdf,0x00,0x0f,0x0f,0x00,
+0x32,0x21,0x13,0x33,0x0f,0x00,0x30,0x07,0xff,0xf1,0x1f,0x09,0x50,0x00,0x4f,0xff,
+0x90,0x05,0xd4,0x03,0x10,0xdf,0x28,0x08,0x11,0x20,0xce,0x07,0x00,0x0a,0x0d,0x50,
+0x01,0x8d,0xff,0xd9,0x20,0x6d,0x07,0x00,0x1b,0x08,0xe2,0x6f,0xfe,0xfb,0x00,0x08,
+0xff,0x51,0xcf,0xc1,0x15,0x53,0x00,0x05,0x52,0x96,0x00,0x01,0xf6,0x08,0x0f,0x05,
+0x00,0x29,0x30,0x04,0xff,0xf1,0x69,0x01,0xf2,0x00,0xf0,0x00,0x0b,0xdf,0xff,0xb0,
+0x00,0x0e,0xff,0xff,0x30,0x00,0x0d,0xfe,0xa2,0xff,0x0c,0x30,0x07,0xff,0xfd,0x4d,
+0x07,0xb0,0x03,0xff,0xfe,0x20,0x7f,0xff,0x00,0x01,0xef,0xff,0x40,0x0f,0x00,0x30,
+0xcf,0xff,0x70,0x1e,0x00,0x30,0x8f,0xff,0xa0,0x6b,0x07,0x30,0x5f,0xff,0xc0,0x2d,
+0x00,0x31,0x2f,0xff,0xe1,0x30,0x00,0x23,0xff,0xf6,0x5f,0x0d,0x10,0xc0,0x0f,0x00,
+0x22,0xff,0xff,0xad,0x08,0xb1,0xf9,0xdf,0xff,0x20,0x00,0x07,0xff,0xfa,0x04,0xff,
+0xfc,0x5a,0x00,0x31,0x0a,0xff,0xf7,0xa7,0x07,0x31,0x1e,0xff,0xf2,0x69,0x00,0x31,
+0x5f,0xff,0xc0,0xb6,0x07,0x51,0xbf,0xff,0x70,0x7f,0xff,0xf2,0x0d,0x11,0x20,0x3e,
+0x04,0x01,0x2d,0x01,0x13,0xfe,0xc8,0x08,0x12,0xb0,0x33,0x0a,0x12,0xf6,0x44,0x04,
+0x03,0x16,0x00,0x21,0x02,0x30,0x1c,0x00,0x01,0xdd,0x08,0x3f,0x0b,0xff,0xb0,0x0d,
+0x00,0x08,0xf0,0x0d,0xcf,0xff,0x40,0xbf,0xfb,0x00,0xaf,0xff,0x60,0x0b,0xff,0xb0,
+0x7f,0xff,0x80,0x00,0xbf,0xfb,0x5f,0xff,0xb0,0x00,0x0b,0xff,0xdf,0xff,0xc0,0x00,
+0xf7,0x04,0x02,0x78,0x0b,0x02,0x0d,0x00,0x00,0xb7,0x00,0xc0,0x0b,0xff,0xf4,0xaf,
+0xff,0x20,0x00,0xbf,0xfb,0x01,0xef,0xfc,0x41,0x00,0x30,0x06,0xff,0xf6,0x4e,0x00,
+0x30,0x0c,0xff,0xf1,0x4e,0x00,0x10,0x2f,0x5f,0x00,0x11,0x58,0xfb,0x0d,0x22,0x0a,
+0xfd,0xd9,0x07,0x01,0x70,0x00,0x21,0x1f,0xf6,0x9e,0x00,0xb0,0xfd,0x00,0x00,0x00,
+0x00,0x00,0x02,0x20,0x00,0x00,0x00,0xf1,0x1d,0x7f,0xfe,0x00,0x02,0xff,0xff,0x37,
+0xff,0xe0,0x00,0xbf,0xff,0x70,0x7f,0xfe,0x00,0x6f,0xff,0xc0,0x07,0xff,0xe0,0x1f,
+0xff,0xf1,0x00,0x7f,0xfe,0x0b,0xff,0xf5,0x00,0x07,0xff,0xff,0xff,0xfa,0x00,0x00,
+0x7f,0xff,0xff,0xff,0x40,0x0d,0x00,0xf4,0x2b,0xfd,0x00,0x00,0x7f,0xfe,0x49,0xff,
+0xf9,0x00,0x07,0xff,0xe0,0x0d,0xff,0xf4,0x00,0x7f,0xfe,0x00,0x4f,0xff,0xe1,0x07,
+0xff,0xe0,0x00,0x9f,0xff,0xa0,0x7f,0xfe,0x00,0x01,0xef,0xff,0x50,0x00,0x1a,0xaa,
+0x40,0x00,0x00,0x00,0xbf,0xfa,0x00,0x00,0x00,0x05,0xff,0xc0,0x00,0x00,0x00,0x0e,
+0xfd,0x10,0x00,0x01,0x00,0x2f,0x7f,0xff,0x06,0x00,0x41,0x40,0xdd,0xdd,0xdd,0xd6,
+0xa6,0x00,0x22,0xff,0xf8,0x06,0x00,0xd0,0x00,0x3a,0xaa,0x20,0x0d,0xff,0x80,0x08,
+0xff,0xa0,0x02,0xff,0xb0,0x23,0x00,0x6f,0x08,0xff,0xe0,0x00,0x8f,0xfe,0x07,0x00,
+0x26,0x0f,0xb7,0x00,0x55,0x03,0x01,0x00,0x20,0x2f,0xf4,0x06,0x00,0x20,0x3f,0xf3,
+0x06,0x00,0x20,0x6f,0xf0,0x06,0x00,0x20,0xcf,0x90,0x06,0x00,0x6f,0x6c,0x10,0x00,
+0x00,0x8f,0xfe,0x02,0x00,0x0f,0xf0,0x02,0x00,0x00,0x0f,0xf6,0x1f,0xf5,0x4f,0xf2,
+0xaf,0xb0,0x4c,0x20,0x7f,0xff,0x00,0x0d,0xfa,0x72,0x00,0x20,0x0e,0xf9,0x06,0x00,
+0x20,0x1f,0xf5,0x06,0x00,0x20,0x7f,0xe0,0x06,0x00,0x2f,0x2b,0x40,0xba,0x00,0x36,
+0xf0,0x07,0x8f,0xfe,0x05,0xff,0x28,0xff,0xe0,0x5f,0xf1,0x8f,0xfe,0x08,0xfd,0x08,
+0xff,0xe0,0xef,0x70,0x8f,0xfe,0x06,0xb0,0x3e,0x01,0x01,0x3f,0x01,0x0f,0x09,0x00,
+0x1f,0x0f,0x87,0x00,0x0e,0x11,0x02,0x06,0x00,0x20,0xbf,0xf2,0x06,0x00,0x11,0xff,
+0xd5,0x00,0x2f,0x8f,0xc1,0xb7,0x00,0x20,0x0f,0x8a,0x00,0x0d,0xff,0x00,0x7f,0xd1,
+0x8f,0xfe,0x0f,0xff,0x68,0xff,0xe0,0xaf,0xf3,0x8f,0xfe,0x00,0x21,0xb7,0x00,0x0d,
+0x30,0x01,0xff,0xf6,0x6a,0x00,0x4f,0x1f,0xff,0x60,0x00,0x0d,0x00,0x0b,0x20,0xfb,
+0xcf,0xdc,0x01,0xdf,0xff,0xff,0xd0,0x00,0x00,0xaf,0xff,0xfa,0x20,0x00,0x00,0x08,
+0xaf,0x34,0x00,0x0e,0x60,0xfe,0xdd,0xdd,0xdd,0xc0,0x1f,0xb9,0x00,0x30,0xfe,0x01,
+0xff,0x01,0x00,0x8d,0xe0,0x01,0xff,0xf4,0x00,0x1f,0xff,0x40,0x07,0x00,0xce,0x10,
+0x1f,0xff,0xdf,0x17,0xff,0xff,0xda,0xff,0xff,0x60,0x89,0x23,0x00,0x05,0x07,0x00,
+0x00,0x5d,0x00,0x21,0xaa,0xa6,0x73,0x02,0x31,0x8f,0xfc,0x00,0x74,0x02,0x02,0xab,
+0x03,0x35,0x0c,0xfe,0x20,0xb2,0x03,0x31,0x07,0xff,0xf5,0x8a,0x00,0x30,0x7f,0xff,
+0xe0,0x8b,0x00,0x42,0x67,0xff,0xff,0x90,0x0f,0x00,0x22,0xff,0x30,0x0f,0x00,0x13,
+0xfc,0x0f,0x00,0x11,0xf6,0x0f,0x00,0x31,0xf9,0xff,0xe1,0x0f,0x00,0x30,0x1e,0xff,
+0xa0,0x0f,0x00,0x60,0xf0,0x4f,0xff,0x31,0xff,0xf6,0xaa,0x01,0x20,0xfd,0x2f,0x0f,
+0x00,0x30,0x02,0xff,0xf9,0x0f,0x00,0x00,0x4e,0x04,0x00,0x0f,0x00,0x31,0x00,0x0d,
+0xff,0x0f,0x00,0x22,0x00,0x4f,0x0f,0x00,0x22,0x00,0xaf,0x0f,0x00,0x22,0x01,0xef,
+0x0f,0x00,0x11,0x06,0x02,0x01,0x21,0xdf,0xfa,0xc3,0x03,0x10,0xb0,0x1b,0x03,0x10,
+0xfd,0x94,0x00,0x24,0x7a,0xa1,0x9e,0x00,0xff,0x0f,0xcf,0xf7,0x3b,0xef,0xd5,0x00,
+0xcf,0xfc,0xff,0xff,0xff,0x50,0xcf,0xff,0xfc,0xef,0xff,0xd0,0xcf,0xfe,0x20,0x09,
+0xff,0xf1,0xcf,0xfa,0x00,0x03,0xff,0xf2,0x06,0x00,0x1d,0x32,0x7f,0xff,0x50,0xe4,
+0x00,0x13,0xfe,0xf3,0x00,0x13,0xf9,0xf3,0x00,0x13,0xf3,0xe4,0x00,0x12,0xc0,0x0f,
+0x00,0x21,0xff,0x60,0x0f,0x00,0x30,0x9f,0xfe,0x10,0x0f,0x00,0x31,0xf1,0xef,0xfa,
+0x0f,0x00,0x31,0x04,0xff,0xf3,0xf3,0x00,0x31,0x0b,0xff,0xd2,0xc6,0x00,0x31,0x2f,
+0xff,0x9f,0xc6,0x00,0x13,0x7f,0xe4,0x00,0x12,0xdf,0xe4,0x00,0x13,0x04,0x0f,0x00,
+0x13,0x0a,0xf3,0x00,0x12,0x1e,0x0f,0x00,0x21,0x00,0x6f,0xe7,0x01,0x03,0x01,0x00,
+0x31,0xbf,0xb0,0x00,0x89,0x01,0x12,0xfa,0x0f,0x00,0x21,0xff,0x70,0x07,0x00,0x21,
+0x5f,0xf1,0x07,0x00,0x2f,0x02,0xb7,0xfb,0x00,0x3f,0x04,0x79,0x00,0x11,0x8f,0x70,
+0x04,0x21,0x9f,0xe0,0x85,0x00,0x10,0xa0,0x6d,0x00,0x01,0x28,0x02,0x20,0x01,0x9a,
+0x11,0x00,0x51,0x09,0xff,0x50,0x4f,0xfb,0x08,0x00,0x22,0x8f,0xfa,0x10,0x00,0x11,
+0xf9,0x35,0x00,0x3f,0x06,0x86,0x00,0x30,0x02,0x76,0xf0,0x01,0x05,0xff,0x80,0x2e,
+0xfd,0x10,0x00,0x5f,0xf9,0xef,0xc1,0x00,0x00,0x04,0xff,0xfb,0x94,0x00,0x2f,0x35,
+0x50,0x30,0x02,0x43,0x32,0x06,0xff,0x10,0xd6,0x06,0x11,0xf0,0x07,0x00,0x12,0x0a,
+0x45,0x03,0x32,0x01,0xff,0x50,0x16,0x01,0x19,0xa0,0x75,0x00,0x50,0x00,0x0c,0xff,
+0xcf,0xff,0x1d,0x01,0x02,0x78,0x00,0x93,0x00,0x0c,0xff,0xe2,0x00,0x9f,0xff,0x10,
+0x00,0x80,0x01,0x7f,0x0c,0xff,0xa0,0x00,0x3f,0xff,0x20,0x0f,0x00,0x21,0x10,0x8f,
+0x71,0x00,0x50,0x2f,0xff,0x68,0xff,0xfe,0xaf,0x01,0x42,0xf6,0x8f,0xff,0xf8,0x0f,
+0x00,0x22,0xff,0xf2,0x0f,0x00,0x22,0xff,0xb0,0x0f,0x00,0x21,0xff,0x50,0x0f,0x00,
+0x21,0x7f,0xfd,0x0f,0x00,0x31,0xf0,0xcf,0xf8,0x0f,0x00,0x31,0x03,0xff,0xf2,0x0f,
+0x00,0x30,0x09,0xff,0xb2,0x0f,0x00,0x40,0x00,0x1e,0xff,0x7f,0x0f,0x00,0x00,0x9e,
+0x04,0x22,0xf6,0x8f,0xb7,0x02,0x00,0x0f,0x00,0x13,0x03,0x0f,0x00,0x12,0x0a,0x0f,
+0x00,0x22,0x00,0x1f,0x0f,0x00,0x22,0x00,0x7f,0xb7,0x02,0x33,0x02,0xff,0xf5,0xe1,
+0x07,0x81,0x30,0x00,0x00,0x00,0x0b,0xef,0xff,0xe0,0xfa,0x00,0x02,0x16,0x00,0xf0,
+0x09,0x0b,0xff,0xb4,0x00,0xbf,0xf7,0x1a,0xef,0xc5,0x00,0xbf,0xfa,0xef,0xff,0xff,
+0x50,0xbf,0xff,0xfd,0xdf,0xff,0xd0,0xbf,0xfd,0x7a,0x01,0x10,0xbf,0xc3,0x00,0x7f,
+0xf3,0xbf,0xfa,0x00,0x02,0xff,0xf4,0x06,0x00,0x17,0x01,0x72,0x00,0x10,0xf3,0x65,
+0x01,0x00,0xbb,0x02,0x40,0x0a,0xdf,0xff,0xd0,0x60,0x01,0x20,0xff,0x40,0x6c,0x00,
+0x11,0xb3,0x0b,0x00,0x01,0x7a,0x00,0x10,0xbf,0xf5,0x00,0x1d,0x00,0x01,0x00,0xc0,
+0x6c,0xef,0xda,0x30,0x00,0x00,0x03,0xef,0xff,0xff,0xff,0xa0,0xd9,0x00,0x10,0xff,
+0x23,0x01,0x80,0xdf,0xff,0x60,0x02,0xbf,0xff,0x60,0x4f,0xd0,0x00,0x50,0xdf,0xfd,
+0x0a,0xff,0xe0,0x5d,0x00,0x40,0xf3,0xdf,0xfb,0x00,0x4d,0x01,0x30,0x6e,0xff,0x90,
+0x87,0x03,0x11,0xf7,0xf1,0x02,0x33,0x0f,0xff,0x8e,0x0f,0x00,0x03,0x1e,0x00,0x13,
+0x6a,0x2d,0x00,0x11,0x5f,0x3c,0x00,0x10,0xfe,0x4b,0x00,0x80,0x01,0xbf,0xff,0x60,
+0x03,0xff,0xff,0xfe,0x5a,0x00,0x03,0x69,0x00,0x01,0x78,0x00,0x21,0x40,0x00,0xbd,
+0x02,0x20,0xff,0xd0,0x08,0x04,0x2b,0xff,0xfc,0x99,0x00,0x70,0x02,0x9d,0xff,0xc6,
+0x00,0x00,0x05,0x1a,0x00,0x00,0x9b,0x09,0xf0,0x02,0xde,0xff,0xfb,0x00,0xaf,0xfe,
+0x20,0x08,0xff,0xf3,0x0f,0xff,0x70,0x00,0x0e,0xff,0x82,0xf3,0x00,0x20,0xbf,0xfb,
+0xfa,0x01,0x30,0x09,0xff,0xc2,0x06,0x01,0x22,0xaf,0xfb,0x1a,0x00,0x12,0x80,0x27,
+0x00,0x03,0x34,0x00,0x01,0x41,0x00,0x13,0x10,0x4e,0x00,0x32,0x00,0x0b,0xfb,0x52,
+0x08,0x51,0x8f,0xf3,0x09,0xff,0x10,0x2c,0x03,0x20,0xff,0x80,0xa7,0x02,0x37,0x9e,
+0xec,0x60,0x7b,0x00,0x82,0x06,0xce,0xfd,0xa3,0x00,0x00,0x00,0x3e,0xf4,0x09,0x10,
+0x3f,0x14,0x01,0xa0,0xfb,0x00,0x0d,0xff,0xf6,0x00,0x2b,0xff,0xf6,0x04,0x87,0x05,
+0x51,0x0d,0xff,0xd0,0xaf,0xfe,0xa8,0x04,0x31,0x3d,0xff,0xb0,0x69,0x02,0x12,0xef,
+0x0d,0x01,0x12,0x7f,0x0d,0x01,0x13,0xf8,0x0f,0x00,0x13,0x7d,0x1e,0x00,0x03,0x2d,
+0x00,0x12,0x35,0x3c,0x00,0x10,0xe0,0x4b,0x00,0x30,0x1b,0xff,0xf6,0x5a,0x00,0x35,
+0xef,0xff,0xfb,0x69,0x00,0x00,0x78,0x00,0x10,0xa4,0x7a,0x06,0x40,0xf6,0x01,0xcf,
+0xb0,0x31,0x02,0x01,0xb8,0x01,0x3c,0x8d,0xfe,0xb3,0xb4,0x01,0x80,0x29,0xdf,0xfc,
+0x60,0x00,0x00,0x5f,0xff,0x85,0x05,0xf0,0x07,0x2f,0xff,0xfd,0xef,0xff,0xb0,0x0a,
+0xff,0xe2,0x00,0x8f,0xff,0x30,0xff,0xf7,0x00,0x00,0xef,0xf8,0x2f,0xff,0x30,0xfb,
+0x01,0x00,0x0e,0x02,0x92,0x9f,0xfc,0x2f,0xff,0x40,0x00,0x0a,0xff,0xb0,0x1a,0x00,
+0x03,0x27,0x00,0x02,0x34,0x00,0x01,0x41,0x00,0x13,0xc1,0x4e,0x00,0x00,0xb4,0x01,
+0x30,0x70,0xdf,0xe2,0xb2,0x03,0x20,0xb0,0xaf,0x4d,0x02,0x30,0xaf,0xe1,0x6f,0x29,
+0x01,0x4f,0x18,0x83,0x08,0x85,0x1a,0x01,0x77,0xa1,0x00,0x0e,0xfe,0x17,0xff,0x80,
+0x00,0x09,0xff,0x33,0xad,0x02,0x9f,0x70,0xdf,0xb0,0x00,0x00,0x58,0x70,0x48,0x81,
+0x1a,0x01,0x4a,0x41,0x02,0x8c,0xef,0xff,0x01,0x00,0x34,0xf0,0x06,0xff,0x01,0x00,
+0x51,0x06,0xff,0xff,0xdc,0xdf,0x0a,0x00,0x10,0xf1,0x5e,0x02,0xd1,0x7f,0xff,0x21,
+0x11,0x11,0x11,0x7f,0xff,0x20,0x00,0x07,0xff,0xf1,0xe5,0x03,0x10,0xb0,0xff,0x03,
+0x10,0x10,0xb1,0x07,0x23,0xf9,0x00,0x15,0x00,0x10,0x0e,0x6b,0x02,0x01,0x6d,0x09,
+0x30,0xd0,0xef,0xf8,0x15,0x00,0x00,0x46,0x0c,0x03,0x15,0x00,0x75,0xcc,0xcc,0xcc,
+0x90,0xdf,0xf8,0x00,0x3f,0x00,0x14,0xa0,0x3f,0x00,0x24,0x7f,0xfe,0x15,0x00,0x34,
+0x01,0xff,0xf9,0x15,0x00,0xb6,0x06,0xff,0xfd,0x98,0x9c,0xff,0xfd,0xdd,0xdd,0xdd,
+0xd0,0x93,0x00,0x07,0xa8,0x00,0xa1,0x00,0x01,0x8d,0xff,0xc7,0x00,0x3b,0xef,0xea,
+0x20,0x70,0x03,0x21,0xfd,0x8f,0xfb,0x03,0xf0,0x05,0xef,0xff,0xde,0xff,0xff,0xff,
+0xec,0xff,0xff,0x10,0x7f,0xff,0x40,0x06,0xff,0xff,0xc0,0x01,0xef,0xf7,0x3d,0x05,
+0x70,0x0c,0xff,0xf4,0x00,0x09,0xff,0xa0,0x82,0x01,0x11,0x9f,0xd1,0x01,0x32,0x0f,
+0xff,0x50,0x9e,0x00,0x20,0xff,0xc0,0x1d,0x01,0x62,0x8f,0xff,0x75,0x55,0x55,0x53,
+0x2a,0x00,0x12,0xf7,0xd8,0x04,0x20,0x40,0x05,0x08,0x08,0x60,0x03,0x60,0x01,0xef,
+0xff,0xdd,0xc6,0x00,0x35,0xce,0xff,0x10,0x69,0x00,0x10,0xf4,0x7e,0x00,0x60,0xd7,
+0x00,0x3a,0xef,0xfc,0x82,0x2d,0x00,0x31,0x5a,0xaa,0x10,0xbd,0x00,0x11,0xf5,0x16,
+0x06,0x02,0xbd,0x07,0x26,0x4f,0xf9,0x52,0x02,0x00,0x11,0x01,0x22,0xda,0x40,0x18,
+0x01,0x00,0x97,0x0b,0x52,0xee,0xef,0xff,0xff,0x70,0xd7,0x06,0x30,0xe0,0x7f,0xff,
+0xec,0x08,0x10,0xf1,0x07,0x00,0x10,0x06,0x92,0x08,0x00,0x66,0x07,0x91,0xf0,0x7f,
+0xff,0x00,0x01,0x6f,0xff,0xa0,0x7f,0xfd,0x09,0x11,0x20,0x07,0x00,0x12,0xb2,0x38,
+0x00,0x20,0x60,0x00,0xe2,0x0b,0x11,0xff,0xd1,0x0b,0x31,0x04,0xff,0xf7,0xeb,0x0a,
+0x32,0xcf,0xfe,0x00,0x4d,0x00,0x10,0x80,0x07,0x00,0x12,0x0b,0x4d,0x00,0x10,0x03,
+0x16,0x06,0x00,0xb0,0x04,0x20,0x7f,0xfc,0x47,0x09,0x62,0x10,0x00,0x06,0xaa,0x20,
+0x00,0x9d,0x05,0x80,0x86,0xdf,0x70,0xbf,0xfe,0xff,0xf7,0x0b,0xd9,0x08,0x41,0xbf,
+0xff,0x82,0x11,0xca,0x01,0x4f,0xbf,0xfb,0x00,0x00,0x09,0x00,0x0d,0x0f,0xc8,0x00,
+0x66,0x03,0x01,0x00,0x11,0x0f,0x20,0x0b,0x00,0xd5,0x0c,0x01,0x62,0x01,0x02,0xc5,
+0x08,0x12,0xaf,0x3b,0x09,0x25,0x4c,0x20,0x4c,0x09,0xff,0x02,0xf8,0x6d,0xf7,0x0b,
+0xff,0xef,0xff,0x70,0xbf,0xff,0xff,0xf6,0x0b,0xff,0xf8,0x21,0x10,0xdc,0x00,0x11,
+0x27,0xbf,0xfb,0x8e,0x0d,0x32,0x03,0xff,0x30,0x8b,0x0d,0x23,0x0c,0xf9,0x88,0x0d,
+0x40,0x02,0xef,0xb0,0x0b,0x6f,0x06,0x50,0x2e,0xfc,0xcf,0xf3,0x00,0x0f,0x00,0x20,
+0xfe,0x30,0x2d,0x00,0x2f,0x28,0x82,0xe6,0x01,0x69,0x50,0x00,0x00,0x03,0xff,0xf8,
+0xf2,0x04,0x4f,0xf9,0x01,0xdf,0xd2,0x03,0xef,0xad,0xfc,0x10,0x00,0x2e,0xff,0xa0,
+0x00,0x00,0x01,0x33,0x00,0x01,0x00,0xff,0x0a,0x0b,0xff,0x86,0xdf,0x70,0x0b,0xff,
+0xef,0xff,0x70,0x0b,0xff,0xff,0xff,0x60,0x0b,0xff,0xf8,0x21,0x10,0x0b,0xff,0xb0,
+0x00,0x00,0x05,0x00,0x14,0x00,0x01,0x00,0x30,0x01,0xff,0xf8,0x07,0x00,0x30,0x0a,
+0xff,0xa0,0x07,0x00,0x21,0x4f,0xfb,0x15,0x00,0x36,0x8a,0x90,0x00,0x01,0x00,0xf0,
+0x1d,0x6b,0xef,0xec,0x70,0x00,0x00,0x3e,0xff,0xff,0xff,0xfe,0x30,0x01,0xef,0xff,
+0xfd,0xff,0xff,0xe1,0x07,0xff,0xf7,0x00,0x06,0xff,0xf9,0x09,0xff,0xe0,0x00,0x00,
+0xcf,0xfc,0x08,0xff,0xf2,0x00,0x00,0x13,0x32,0x02,0xff,0xff,0x82,0x30,0x00,0xa1,
+0x5f,0xff,0xff,0xc7,0x10,0x00,0x00,0x03,0xcf,0xff,0x5b,0x00,0x32,0x03,0x9e,0xff,
+0x6b,0x00,0xf0,0x17,0x4c,0xff,0xf7,0x17,0x77,0x20,0x00,0x00,0xdf,0xfc,0x0f,0xff,
+0x80,0x00,0x00,0xaf,0xfe,0x0c,0xff,0xf5,0x00,0x03,0xff,0xfc,0x03,0xff,0xff,0xfd,
+0xef,0xff,0xf5,0x00,0x4e,0xff,0xff,0xff,0xff,0x80,0x70,0x00,0x20,0xfd,0x93,0x30,
+0x00,0x30,0x7f,0xff,0x20,0x9f,0x00,0x11,0xf4,0xe9,0x00,0x65,0x50,0x00,0x00,0x00,
+0x2a,0xa6,0x94,0x00,0xf0,0x13,0x07,0xcf,0xfe,0xa2,0x00,0x01,0xdf,0xff,0xff,0xff,
+0x50,0x09,0xff,0xe8,0x7d,0xff,0xf1,0x0e,0xff,0x60,0x01,0xff,0xf5,0x0d,0xff,0xb1,
+0x00,0x01,0x10,0x07,0xff,0xff,0xc8,0x40,0x40,0x00,0xf0,0x12,0xff,0xfd,0x20,0x00,
+0x01,0x6a,0xef,0xff,0xe1,0x14,0x43,0x00,0x05,0xff,0xf5,0x3f,0xff,0x10,0x00,0xef,
+0xf6,0x0d,0xff,0xe8,0x7b,0xff,0xf2,0x02,0xef,0xff,0xff,0xff,0x70,0x48,0x00,0x10,
+0xa3,0x05,0x01,0x20,0xdf,0xe2,0x56,0x00,0xff,0x03,0x1d,0xff,0xfe,0x20,0x00,0x00,
+0x02,0xdf,0xc1,0xaf,0xe2,0x00,0x00,0x06,0x87,0x00,0x06,0x86,0x06,0x01,0x6e,0x20,
+0x5f,0xfa,0xee,0x00,0xff,0x01,0xff,0xef,0xb0,0x00,0x00,0x9f,0xf5,0x1c,0xfc,0x10,
+0x01,0x44,0x20,0x00,0x44,0x20,0x06,0x01,0x43,0x0f,0xe3,0x00,0x5e,0x12,0xff,0xe9,
+0x01,0x21,0xcf,0xe6,0xce,0x00,0x10,0x5b,0xe5,0x01,0x00,0xed,0x00,0x10,0x80,0x07,
+0x00,0x30,0x9f,0xff,0x30,0x07,0x00,0x21,0x8e,0xa3,0xe8,0x00,0x2f,0xfd,0x92,0xe8,
+0x00,0x04,0x2e,0x11,0x10,0xe8,0x00,0x28,0x13,0x33,0xe8,0x00,0x26,0xd7,0x6b,0xe8,
+0x00,0x20,0xdf,0xff,0x4f,0x00,0x20,0x2f,0xfb,0x41,0x01,0x30,0x27,0xff,0xe0,0x61,
+0x00,0xf0,0x14,0xdf,0xf1,0x00,0x00,0x00,0x0f,0xff,0xc0,0x00,0x00,0x00,0x0e,0xd8,
+0x10,0x00,0x00,0x09,0xff,0x60,0x3f,0xfd,0x00,0x00,0x00,0xaf,0xf9,0xff,0xd1,0x00,
+0x00,0x00,0x0c,0xff,0xfe,0x10,0x21,0x02,0x2a,0xcf,0xe2,0x12,0x03,0x12,0x81,0x29,
+0x01,0x40,0xff,0x50,0x01,0xef,0xd5,0x00,0x10,0xf3,0x29,0x01,0x31,0x04,0xff,0xfb,
+0x29,0x01,0x21,0x7b,0xb9,0x29,0x01,0x2f,0x00,0x00,0x29,0x01,0x10,0x32,0x1a,0xaa,
+0x40,0x29,0x01,0x10,0x90,0x29,0x01,0x12,0x0b,0x29,0x01,0x13,0x02,0x29,0x01,0x18,
+0x3d,0x0c,0x02,0xff,0x07,0x01,0xcf,0xd1,0x09,0xff,0x60,0x00,0x1c,0xfe,0xaf,0xf5,
+0x00,0x00,0x00,0xbf,0xff,0x40,0x00,0x00,0x00,0x05,0x52,0x12,0x03,0x43,0x21,0x8f,
+0xff,0x01,0x00,0x12,0x68,0x07,0x00,0xd1,0xf6,0x7e,0xee,0xee,0xff,0xfe,0xee,0xee,
+0x50,0x00,0x00,0x6f,0xff,0x7c,0x02,0x12,0x06,0xe0,0x00,0x0f,0x0f,0x00,0x48,0x31,
+0x0f,0xfc,0x20,0x9e,0x04,0x31,0x7e,0xff,0x10,0x10,0x00,0x31,0xbf,0xf4,0x00,0xae,
+0x01,0x11,0xfe,0x07,0x00,0x20,0x0c,0xd9,0x1e,0x00,0x50,0x88,0x82,0x00,0x00,0x0f,
+0x35,0x02,0x22,0xff,0xf5,0x09,0x00,0x50,0xef,0xff,0xff,0xf8,0x0e,0x33,0x01,0x4a,
+0x78,0xff,0xfa,0x84,0x1b,0x00,0x0c,0x09,0x00,0xd0,0x70,0x00,0x00,0xdf,0xff,0xd8,
+0x00,0x07,0xff,0xff,0xa0,0x00,0x08,0x96,0x01,0xf1,0x0c,0x5f,0xfa,0x20,0x00,0x02,
+0x7f,0xfd,0x00,0x00,0x01,0xef,0xf0,0x00,0x02,0xff,0xfa,0x00,0x00,0x1f,0xd7,0x00,
+0x00,0x0b,0xfe,0x30,0x6f,0xf9,0x81,0x04,0x22,0x9f,0xf8,0x72,0x05,0x12,0xf7,0x6e,
+0x01,0x16,0x85,0x0e,0x02,0x13,0x08,0x26,0x01,0x03,0x35,0x01,0x8f,0x67,0xee,0xee,
+0xef,0xff,0xee,0xee,0xe5,0x26,0x01,0x51,0x02,0x0f,0x00,0x00,0x83,0x00,0x50,0x00,
+0x00,0x00,0x09,0xfe,0xa1,0x00,0x00,0xc1,0x05,0x71,0x1f,0xf5,0x00,0xff,0xf5,0x2c,
+0xc0,0xeb,0x00,0x01,0x05,0x00,0x00,0x19,0x01,0x02,0x05,0x00,0x01,0x1a,0x01,0x06,
+0x19,0x00,0x0f,0x05,0x00,0x03,0x22,0xf7,0x00,0x1e,0x01,0x20,0x00,0x7f,0x08,0x01,
+0x3f,0x07,0xdf,0xe8,0x11,0x02,0x1c,0x00,0x84,0x01,0x21,0xf4,0x00,0x77,0x00,0x00,
+0xa7,0x02,0x5f,0x02,0x27,0xff,0xf4,0x20,0xeb,0x00,0x2c,0x0f,0xe8,0x01,0x0b,0xe8,
+0x05,0xff,0xff,0xff,0xfd,0x5f,0xff,0xff,0xff,0xd0,0x22,0xff,0xf7,0x22,0x2d,0x00,
+0x10,0x80,0xca,0x00,0x30,0xd9,0x00,0x06,0xe8,0x01,0xe0,0x06,0xdf,0xe8,0x00,0x05,
+0xde,0x92,0x1d,0xf2,0x00,0x00,0x2f,0xff,0xff,0xaa,0x03,0xb5,0x7f,0xa2,0x7e,0xfe,
+0x30,0x00,0x00,0x12,0x00,0x00,0x10,0xcf,0x01,0x20,0xaf,0xfe,0x76,0x06,0x1f,0xf7,
+0x07,0x00,0x33,0x20,0x9f,0xff,0x06,0x04,0x10,0xf6,0xcb,0x06,0xf1,0x05,0x05,0xff,
+0xf4,0x3f,0xff,0xc2,0x00,0x3e,0xff,0xe0,0x0a,0xff,0xff,0xee,0xff,0xff,0x60,0x00,
+0xbf,0xff,0x10,0x04,0xf4,0x0d,0x04,0xae,0xff,0xd9,0x30,0x00,0x00,0x7e,0xe8,0x12,
+0xff,0x00,0x04,0xff,0xff,0xff,0xfb,0x00,0x09,0xf8,0x38,0xff,0xd2,0x00,0x01,0x20,
+0x00,0x01,0x95,0x00,0x6f,0xcf,0xf9,0x00,0x03,0xff,0xf2,0x06,0x00,0x18,0x10,0xfa,
+0x06,0x00,0xd0,0xaf,0xfe,0x10,0x09,0xff,0xf2,0x6f,0xff,0xec,0xef,0xff,0xf2,0x0d,
+0xb9,0x01,0x74,0xf2,0x01,0xae,0xfe,0x92,0xff,0xf2,0xff,0x00,0x03,0x07,0x00,0x09,
+0x01,0x00,0x0f,0xff,0x00,0x64,0x00,0xc2,0x01,0x13,0xfc,0xff,0x00,0x08,0x01,0x00,
+0x0f,0xf9,0x00,0x3d,0xb0,0xf4,0x00,0x9f,0xe0,0x00,0x00,0x0e,0xfb,0x12,0xef,0xa0,
+0x5c,0x02,0x01,0xf1,0x07,0x4f,0x00,0x4c,0xee,0xa2,0x00,0x01,0x6d,0x50,0x04,0xff,
+0x50,0x1d,0xfb,0xac,0x02,0x00,0x39,0x03,0x4f,0x18,0xdf,0xeb,0x30,0x06,0x01,0x49,
+0x31,0x00,0x08,0xed,0x6b,0x07,0x30,0x7e,0x46,0xf3,0x07,0x00,0x21,0xba,0x00,0x81,
+0x07,0x32,0x8d,0x13,0xf4,0xe3,0x04,0x11,0x80,0x74,0x00,0x1f,0x10,0x0c,0x03,0x68,
+0x30,0x01,0xae,0xd5,0x8a,0x00,0xe1,0xc3,0x6f,0x20,0x00,0x00,0x0c,0xa0,0x3f,0x30,
+0x00,0x00,0x03,0xdf,0xf8,0x10,0x06,0x0f,0x13,0x01,0x46,0x30,0x0d,0xff,0x25,0x03,
+0x0b,0x40,0x7f,0xf5,0x2f,0xfb,0xae,0x00,0xaf,0x80,0xcf,0xd0,0x00,0x00,0x04,0x88,
+0x03,0x88,0x10,0x18,0x04,0x6d,0xff,0x07,0x01,0xef,0xd0,0x7f,0xf7,0x00,0x09,0xff,
+0x33,0xff,0x90,0x00,0x3f,0xf6,0x1e,0xfb,0x00,0x00,0x68,0x70,0x48,0x80,0x06,0x01,
+0x42,0x0f,0xe3,0x00,0x48,0x18,0x2f,0xe3,0x00,0x11,0x70,0xe3,0x00,0x11,0xf9,0xe3,
+0x00,0x21,0xfe,0x40,0x78,0x0c,0x00,0x89,0x02,0x00,0x7e,0x01,0x11,0x30,0x0e,0x00,
+0x02,0x96,0x04,0x3f,0x07,0xef,0xb0,0xe1,0x00,0x33,0x10,0xfd,0xe1,0x00,0x21,0xfd,
+0x82,0x4a,0x06,0x30,0x0d,0xfe,0x30,0x92,0x09,0x11,0xf3,0x6f,0x00,0x25,0xf4,0x30,
+0x6e,0x00,0x00,0x6d,0x00,0x00,0x03,0x0c,0x01,0x11,0x04,0x06,0x0d,0x0c,0x00,0x01,
+0x00,0x33,0x2e,0xfc,0x1a,0x0b,0x00,0x0b,0x14,0x0c,0x01,0xae,0x0a,0x50,0xf0,0x00,
+0x01,0xff,0xf2,0x35,0x07,0xf0,0x1f,0x4f,0xff,0x30,0x00,0x5f,0xff,0x50,0x00,0x2f,
+0xff,0x40,0xff,0xf6,0x00,0x08,0xff,0xf9,0x00,0x05,0xff,0xf0,0x0d,0xff,0x90,0x00,
+0xcf,0xff,0xd0,0x00,0x8f,0xfd,0x00,0x9f,0xfc,0x00,0x0f,0xff,0xff,0x00,0x0b,0xff,
+0x90,0x05,0xff,0xf0,0x04,0xe9,0x03,0xf0,0x08,0xef,0xf6,0x00,0x2f,0xff,0x20,0x7f,
+0xf9,0xff,0x80,0x1f,0xff,0x20,0x00,0xef,0xf5,0x0b,0xff,0x1f,0xfb,0x04,0xff,0xe0,
+0x83,0x03,0xf0,0x0c,0xff,0xc0,0xcf,0xf0,0x7f,0xfb,0x00,0x00,0x7f,0xfb,0x2f,0xf9,
+0x08,0xff,0x3a,0xff,0x70,0x00,0x04,0xff,0xe6,0xff,0x50,0x4f,0xf6,0xdf,0xf4,0xd7,
+0x06,0x60,0xcf,0xf1,0x00,0xff,0xbf,0xff,0x01,0x02,0x70,0xff,0xfd,0x00,0x0c,0xff,
+0xff,0xd0,0xb9,0x0a,0x61,0xff,0x90,0x00,0x8f,0xff,0xf9,0x70,0x0a,0x10,0xf5,0x51,
+0x05,0x11,0x60,0x82,0x0a,0x51,0x10,0x00,0x1f,0xff,0xf2,0x95,0x07,0x15,0xd0,0x40,
+0x09,0x02,0x50,0x0d,0x00,0xf8,0x0c,0x12,0xdf,0xd0,0x08,0x41,0x3e,0xfb,0x04,0xef,
+0x54,0x02,0x20,0x12,0x20,0x03,0x00,0x06,0x01,0x00,0xf0,0x2d,0x8f,0xfb,0x00,0x09,
+0xff,0x20,0x01,0xff,0xf2,0x4f,0xfe,0x00,0x0d,0xff,0x70,0x04,0xff,0xe0,0x0f,0xff,
+0x10,0x2f,0xff,0xb0,0x08,0xff,0xa0,0x0c,0xff,0x40,0x6f,0xff,0xf0,0x0b,0xff,0x60,
+0x08,0xff,0x70,0xbf,0xff,0xf4,0x0e,0xff,0x20,0x04,0xff,0xb0,0xff,0xaf,0xf9,0x2f,
+0xfe,0x00,0x01,0xff,0xe4,0xff,0x4b,0xfd,0xbc,0x0c,0xe0,0xcf,0xfa,0xff,0x06,0xff,
+0xbf,0xf6,0x00,0x00,0x8f,0xff,0xfb,0x02,0xff,0x89,0x00,0x50,0x4f,0xff,0xf6,0x00,
+0xdf,0x73,0x01,0x00,0x97,0x00,0x30,0x8f,0xff,0xa0,0x7b,0x03,0x50,0xd0,0x00,0x4f,
+0xff,0x60,0xc3,0x00,0x32,0x80,0x00,0x0f,0xf7,0x07,0x31,0xac,0x90,0x00,0x77,0x0b,
+0x21,0xff,0xa0,0xa7,0x00,0x20,0xd4,0xef,0x08,0x00,0x65,0x9b,0xa1,0x02,0xbb,0x60,
+0x00,0xfd,0x0e,0x90,0xf1,0x00,0x00,0x04,0xff,0xf8,0x3f,0xff,0x80,0x0f,0x0b,0xf0,
+0x00,0x10,0xaf,0xff,0x10,0x00,0x3f,0xff,0x80,0x02,0xff,0xf7,0x00,0x0a,0xff,0xe0,
+0x04,0x00,0x30,0x02,0xff,0xf7,0xe4,0x06,0x30,0x60,0x9f,0xfe,0x50,0x0c,0x40,0xfd,
+0x1f,0xff,0x70,0x99,0x02,0x10,0xfc,0xef,0x01,0x00,0x2e,0x01,0x30,0xf6,0x00,0x00,
+0x85,0x00,0x12,0xfd,0xe8,0x00,0x22,0xff,0x60,0x6e,0x08,0x13,0xf3,0x7d,0x08,0x1f,
+0x30,0x0f,0x00,0x08,0x50,0x6f,0xff,0x30,0x00,0x00,0xf2,0x0b,0x00,0x00,0x7f,0xf9,
+0x00,0x00,0x00,0x00,0x9f,0xfe,0xfb,0x00,0x00,0x00,0xbf,0xe2,0x1c,0xfc,0x10,0x00,
+0x02,0x20,0x00,0x02,0x21,0x00,0x01,0x00,0x30,0x0c,0xff,0xd0,0x04,0x00,0xf0,0x30,
+0x7f,0xff,0x20,0x01,0xff,0xf7,0x01,0xff,0xf6,0x00,0x5f,0xff,0x20,0x0c,0xff,0xb0,
+0x0a,0xff,0xc0,0x00,0x6f,0xff,0x00,0xff,0xf7,0x00,0x01,0xff,0xf5,0x4f,0xff,0x20,
+0x00,0x0b,0xff,0x98,0xff,0xc0,0x00,0x00,0x5f,0xfe,0xdf,0xf6,0x00,0x00,0x00,0xff,
+0xff,0xff,0x10,0x00,0x00,0x0a,0xff,0xff,0xb0,0x00,0x00,0x00,0x5f,0xff,0xf6,0x4a,
+0x00,0x01,0x13,0x00,0x21,0x00,0x0a,0x13,0x00,0x30,0x00,0xcf,0xf5,0x06,0x00,0x90,
+0x4f,0xff,0x00,0x00,0x00,0x07,0xdf,0xff,0x90,0x81,0x00,0x81,0xff,0xe1,0x00,0x00,
+0x00,0x08,0xfe,0xa2,0x77,0x00,0x41,0x08,0xfa,0x00,0x0c,0x49,0x00,0x41,0xf2,0x04,
+0xff,0xd0,0x0f,0x00,0x34,0x0b,0xe6,0x00,0x01,0x00,0x30,0xbf,0xff,0x10,0x3c,0x00,
+0xf0,0x08,0x83,0xff,0xf8,0x00,0x00,0x0b,0xff,0xf1,0x0a,0xff,0xf1,0x00,0x03,0xff,
+0xf8,0x00,0x2f,0xff,0x70,0x00,0xaf,0xfe,0x00,0x04,0x00,0x00,0x0b,0x00,0xf1,0x06,
+0x02,0xff,0xf6,0x09,0xff,0xe0,0x00,0x00,0x09,0xff,0xd1,0xff,0xf7,0x00,0x00,0x00,
+0x1f,0xff,0xcf,0xfe,0x00,0x69,0x00,0x91,0xff,0x60,0x00,0x00,0x00,0x01,0xff,0xff,
+0xd0,0x6a,0x00,0x02,0x9e,0x00,0x40,0x00,0x6f,0xff,0x30,0x07,0x00,0x3f,0x06,0xff,
+0xf3,0x0f,0x00,0x10,0x56,0x00,0x01,0xaa,0xa4,0x00,0xce,0x00,0x21,0x4f,0xfc,0x15,
+0x00,0x25,0xef,0xd1,0xa3,0x00,0x20,0x2f,0xff,0x01,0x00,0x13,0xfa,0x07,0x00,0x72,
+0x1e,0xee,0xee,0xee,0xef,0xff,0xf5,0x19,0x00,0x10,0xa0,0x07,0x00,0x31,0xdf,0xfe,
+0x10,0x7c,0x00,0x12,0xf4,0x07,0x01,0x11,0x90,0x3f,0x00,0x12,0xfd,0x53,0x00,0x21,
+0xf3,0x00,0x35,0x01,0x10,0x70,0x67,0x00,0x11,0xef,0x5a,0x00,0x30,0x0b,0xff,0xf2,
+0x07,0x00,0x11,0x7f,0xb9,0x00,0x30,0x02,0xff,0xfb,0x0d,0x00,0x72,0x0d,0xff,0xfe,
+0xdd,0xdd,0xdd,0xdb,0x62,0x00,0x12,0xfd,0x07,0x00,0x00,0x41,0x00,0x30,0x8f,0xfe,
+0x20,0x24,0x00,0x11,0xf3,0xbc,0x01,0x64,0x40,0x00,0x00,0x00,0x3a,0xa5,0x95,0x00,
+0x10,0x0f,0x24,0x00,0x12,0xf3,0x06,0x00,0x61,0x0b,0xcc,0xcc,0xdf,0xff,0xd0,0x4d,
+0x01,0x41,0x20,0x00,0x00,0x07,0x05,0x01,0x11,0x3f,0x9c,0x00,0x25,0xdf,0xfd,0x86,
+0x00,0x01,0x85,0x00,0x02,0x70,0x00,0x61,0x0c,0xff,0xfd,0xcc,0xcc,0xc4,0x67,0x00,
+0x12,0xf6,0x06,0x00,0x00,0xc6,0x01,0x01,0xb8,0x00,0x41,0x05,0xff,0xf0,0x00,0xac,
+0x00,0x11,0xc0,0x66,0x00,0x2f,0x02,0x00,0x06,0x01,0x6f,0x21,0x3d,0xe5,0xea,0x01,
+0x11,0xfc,0x44,0x00,0x11,0xf8,0x9e,0x00,0x1f,0x20,0x06,0x01,0x44,0x50,0x0b,0xff,
+0x30,0x6f,0xf9,0x42,0x00,0x31,0xf9,0xff,0x80,0xa5,0x00,0x11,0xf7,0x66,0x00,0x2f,
+0x78,0x50,0x06,0x01,0x6d,0xb0,0x01,0xdf,0xd1,0x0a,0xff,0x50,0x00,0x1c,0xfd,0xaf,
+0xe3,0x9f,0x00,0x10,0xfd,0x01,0x01,0x2f,0x03,0x31,0x06,0x01,0x44,0xc0,0x7d,0xff,
+0xb0,0xbf,0xff,0xfc,0x4f,0xff,0xfc,0x98,0xff,0xf1,0x78,0x01,0x00,0x20,0x04,0x1f,
+0xaf,0x07,0x00,0x16,0xf1,0x07,0x03,0xbd,0x91,0x01,0xff,0xff,0xc0,0x5f,0xff,0xff,
+0x16,0xff,0xff,0xf1,0x2f,0xff,0xfd,0x00,0x5d,0xfc,0x20,0x35,0x71,0x03,0x21,0xfe,
+0x93,0x7e,0x03,0xd0,0xfc,0x61,0x00,0x02,0x8d,0xff,0xff,0xfa,0x40,0x00,0x03,0x8d,
+0xff,0x69,0x04,0xf1,0x0b,0x06,0xff,0xfd,0x00,0x05,0xaf,0xff,0xff,0xa2,0xaf,0xff,
+0xff,0xe8,0x20,0x6f,0xff,0xfb,0x50,0x00,0x06,0xfd,0x71,0x00,0x00,0x00,0x34,0x93,
+0x02,0x00,0x96,0x00,0x20,0xfc,0x5f,0x06,0x00,0x7f,0xc4,0xbb,0xbb,0xbb,0xbb,0xb8,
+0x00,0x01,0x00,0x01,0x34,0x02,0x7b,0xe8,0x0b,0x00,0x42,0x49,0xdf,0xff,0xff,0x0a,
+0x00,0x42,0x16,0xbf,0xff,0xff,0x0c,0x00,0x43,0x03,0x8c,0xff,0xff,0x0c,0x00,0x35,
+0x3a,0xef,0xff,0x0c,0x00,0x26,0xef,0xff,0x0c,0x00,0x03,0x0a,0x00,0x15,0xaf,0x0c,
+0x00,0x33,0xd8,0x40,0x0f,0x0c,0x00,0x42,0xfb,0x62,0x00,0x00,0x0c,0x00,0x44,0xfe,
+0x94,0x00,0x00,0x0c,0x00,0x2f,0xf0,0x00,0x0c,0x00,0x2b,0x34,0x3a,0xdf,0xdf,0x0c,
+0x00,0x13,0x06,0x84,0x00,0x00,0x0c,0x00,0x10,0x0e,0x0c,0x00,0x34,0x03,0xad,0xfd,
+0x0c,0x00,0x44,0xfe,0x6f,0xff,0xff,0x24,0x00,0x21,0xf6,0xef,0x0c,0x00,0x00,0xc5,
+0x00,0x50,0xea,0x30,0xef,0xff,0xff,0x14,0x05,0x03,0xd4,0x04,0x02,0x0a,0x05,0x01,
+0xec,0x00,0x34,0xae,0xfe,0xa3,0x0c,0x01,0x32,0xb7,0x00,0xbf,0xd7,0x00,0x53,0xf4,
+0x00,0x7b,0xfd,0x88,0xef,0x00,0xb0,0xfb,0x88,0xdf,0xff,0xff,0xff,0xb4,0x44,0x44,
+0x44,0x44,0x57,0x01,0x41,0xf9,0x00,0xcf,0x80,0x9a,0x00,0x62,0xf5,0x00,0x9f,0xf8,
+0x00,0xbf,0x0c,0x00,0x38,0xf4,0x00,0x8f,0x18,0x00,0x44,0xff,0xff,0xff,0x80,0x6b,
+0x02,0xd6,0xfd,0x88,0xef,0xa2,0x22,0x22,0x22,0x22,0x3f,0xfb,0x88,0xdf,0xf8,0x60,
+0x00,0x18,0x8f,0x0c,0x00,0x08,0x24,0x00,0x08,0x3c,0x00,0x0f,0x6c,0x00,0x14,0x05,
+0x9c,0x00,0x08,0xb4,0x00,0x08,0xcc,0x00,0x61,0x14,0x44,0x44,0x10,0x03,0x44,0x01,
+0x00,0x62,0x41,0xef,0xff,0xff,0xe0,0x6f,0x1a,0x00,0x10,0xfe,0x1f,0x01,0x14,0x8f,
+0xd5,0x01,0x0f,0x0c,0x00,0x10,0x61,0x7b,0xbb,0xbb,0x60,0x2a,0xbb,0x01,0x00,0x17,
+0xb7,0x4f,0x02,0x00,0x6a,0x00,0x23,0xb0,0x4f,0x7a,0x00,0x0f,0x54,0x00,0x1d,0x08,
+0x3c,0x00,0x08,0x54,0x00,0x0f,0xb4,0x00,0x4b,0x14,0xbd,0x15,0x05,0x00,0xd4,0x03,
+0x15,0xe2,0x0c,0x00,0x36,0xcf,0xff,0xfd,0x17,0x00,0x26,0xff,0xfd,0x17,0x00,0x27,
+0xff,0xd1,0x17,0x00,0x36,0x10,0x02,0xdb,0x17,0x00,0x34,0x2e,0xff,0xc0,0x17,0x00,
+0x45,0x00,0xdf,0xff,0xfc,0x2e,0x00,0x10,0xdf,0xad,0x03,0x02,0x17,0x00,0x54,0x00,
+0x1d,0xff,0xff,0xfc,0x45,0x00,0x52,0x01,0xdf,0xff,0xff,0xcc,0x17,0x00,0x01,0x19,
+0x00,0x14,0xff,0x5c,0x00,0x00,0x19,0x00,0x03,0x17,0x00,0x02,0x19,0x00,0x04,0x73,
+0x00,0x25,0x01,0xdf,0x17,0x00,0x00,0x19,0x00,0x06,0x6b,0x07,0x33,0x01,0xcc,0x10,
+0x09,0x00,0x11,0x41,0xca,0x02,0x50,0x30,0x01,0xdf,0xd1,0x00,0xc7,0x04,0x40,0x70,
+0xcf,0xff,0xd1,0x08,0x00,0x50,0xff,0x4e,0xff,0xff,0xd1,0x08,0x00,0x60,0xf6,0x4f,
+0xff,0xff,0xd1,0x07,0x62,0x01,0x41,0x4f,0xff,0xff,0xd8,0x6a,0x01,0x14,0x4f,0x72,
+0x01,0x14,0x4f,0x7a,0x01,0x10,0x4f,0xa6,0x00,0x01,0x40,0x00,0x02,0x7c,0x00,0x13,
+0x07,0x9c,0x00,0x13,0x07,0xa5,0x00,0x00,0x40,0x00,0x17,0x5f,0x48,0x00,0x14,0xd1,
+0x48,0x00,0x13,0x7a,0x48,0x00,0x22,0xf3,0x0b,0x48,0x00,0x38,0xf4,0x00,0x01,0xca,
+0x01,0x26,0xaf,0xf8,0x0c,0x00,0x14,0xef,0x54,0x01,0x20,0x08,0x60,0x0c,0x00,0x11,
+0x07,0xdf,0x05,0x20,0xcf,0xf3,0x0c,0x00,0x12,0x5f,0x61,0x05,0x10,0xfb,0x0c,0x00,
+0x30,0xcf,0xff,0xb0,0xaf,0x08,0x10,0xf6,0x0c,0x00,0x71,0x7f,0xff,0xf7,0x00,0x03,
+0xff,0xff,0x30,0x00,0x72,0x08,0xff,0xff,0x20,0x0a,0xff,0xf9,0x48,0x00,0x62,0xbf,
+0xff,0x90,0x1f,0xff,0xe0,0x0c,0x00,0x61,0x1f,0xff,0xf0,0x5f,0xff,0x90,0x0c,0x00,
+0x00,0xb6,0x05,0x32,0x8f,0xff,0x40,0x0c,0x00,0x62,0x06,0xff,0xf6,0x9f,0xff,0x20,
+0x0c,0x00,0x32,0x04,0xff,0xf8,0x0c,0x00,0x10,0xfc,0x0c,0x00,0x11,0xf7,0x24,0x00,
+0x21,0x37,0x72,0x24,0x00,0x12,0x5f,0x74,0x03,0x00,0x3c,0x00,0x23,0xf4,0x1f,0x27,
+0x04,0x00,0x54,0x00,0x33,0x0b,0xff,0xf8,0xc4,0x00,0x21,0xff,0xa0,0x84,0x00,0x02,
+0x17,0x01,0x31,0x20,0x00,0xaf,0x19,0x00,0x40,0x01,0x9f,0xff,0xf8,0x84,0x06,0x51,
+0xff,0xe8,0x42,0x24,0x9e,0xf3,0x09,0x23,0x01,0xdf,0xcb,0x02,0x02,0xf2,0x09,0x01,
+0x01,0x00,0x11,0x90,0x42,0x00,0x10,0x3b,0x0b,0x00,0x13,0xb3,0xfe,0x00,0x44,0x15,
+0x89,0x97,0x51,0x13,0x01,0x47,0x04,0x89,0x98,0x40,0x9c,0x06,0x1e,0xf0,0x0c,0x00,
+0x01,0x65,0x01,0x12,0xf4,0x7f,0x02,0x20,0xc3,0x2c,0x48,0x00,0x55,0xc2,0x3c,0xc0,
+0x00,0x00,0xee,0x02,0x36,0xf8,0x00,0x03,0xf9,0x02,0x26,0x30,0x0a,0x0c,0x00,0x11,
+0xa0,0xe6,0x06,0x21,0x94,0x49,0x11,0x03,0x20,0x06,0xef,0x45,0x00,0x00,0x4b,0x00,
+0x41,0xfe,0x60,0x00,0x1e,0x97,0x00,0x41,0x09,0xff,0xff,0xe1,0x69,0x00,0x10,0x40,
+0x12,0x01,0x2a,0xff,0xf0,0x0c,0x00,0x07,0x24,0x00,0x08,0x3c,0x00,0x08,0x54,0x00,
+0x08,0x6c,0x00,0x08,0x84,0x00,0x08,0x9c,0x00,0x09,0xb4,0x00,0x08,0xcc,0x00,0x0f,
+0xf0,0x00,0x08,0x08,0x14,0x01,0x74,0x00,0x00,0x13,0x10,0x00,0x02,0x44,0xb1,0x03,
+0x32,0x5f,0xfe,0x40,0x9d,0x07,0x02,0x0c,0x08,0x34,0xff,0x70,0x0e,0xb0,0x01,0x10,
+0xaf,0x86,0x00,0x22,0xef,0xfe,0x12,0x03,0x62,0xcf,0xff,0xb3,0xbf,0xff,0xce,0x1b,
+0x00,0x40,0x03,0xef,0xff,0x90,0x29,0x05,0x12,0xfe,0xc9,0x0a,0x52,0xff,0x60,0x5d,
+0x50,0x6f,0x0d,0x06,0x81,0x08,0xff,0xfe,0x30,0x8f,0xff,0x80,0x3e,0x1b,0x00,0x90,
+0x1b,0xff,0xfd,0x20,0xaf,0xff,0xff,0xa0,0x2d,0xcf,0x02,0xf1,0x02,0x2d,0xff,0xfb,
+0x01,0xcf,0xff,0xff,0xff,0xc1,0x0b,0xff,0xfd,0x20,0x4f,0xff,0xf8,0x03,0x5a,0x05,
+0x81,0xe3,0x08,0xff,0xfe,0x4e,0xff,0xf5,0x05,0xdc,0x00,0x00,0x08,0x00,0x44,0xfe,
+0x4f,0xe3,0x08,0xea,0x00,0x54,0x03,0xef,0x40,0x41,0x07,0xf8,0x00,0x37,0xf7,0x01,
+0x40,0xa2,0x01,0x00,0x5e,0x02,0x00,0x28,0x00,0x42,0xeb,0xbb,0xef,0xff,0x53,0x02,
+0x10,0x8f,0x06,0x01,0x17,0x04,0x1b,0x00,0x3f,0x40,0x00,0x4f,0x1b,0x00,0x0e,0x00,
+0xf0,0x00,0x11,0xf3,0xed,0x01,0x10,0x70,0xd7,0x00,0x83,0xbb,0xbb,0xba,0x10,0x00,
+0x1a,0xbb,0xbb,0x56,0x02,0x4e,0x09,0xdd,0xdd,0x90,0x59,0x01,0x0f,0x0c,0x00,0x41,
+0x81,0xad,0xdd,0xdf,0xff,0xff,0xfd,0xdd,0xda,0xc4,0x09,0x15,0xff,0x81,0x0b,0x03,
+0xcf,0x04,0x25,0xff,0xd1,0xcf,0x04,0x04,0xb9,0x04,0x16,0x1d,0xe7,0x04,0x01,0x19,
+0x00,0x05,0xd0,0x04,0x13,0x1d,0x17,0x00,0xd0,0x25,0x55,0x55,0x55,0x11,0xdf,0xfd,
+0x11,0x55,0x55,0x55,0x52,0xef,0x2c,0x00,0x32,0x1d,0xd1,0x1d,0xee,0x05,0x00,0x2d,
+0x00,0x04,0x56,0x03,0x00,0x13,0x07,0x2f,0x9f,0xff,0x01,0x00,0x05,0x35,0x71,0xe7,
+0x1e,0x0c,0x00,0x43,0xb6,0xfb,0x6f,0xff,0x00,0x07,0x03,0xe8,0x04,0x22,0x03,0xcf,
+0x0b,0x00,0x12,0xd3,0xb2,0x0b,0x03,0x19,0x00,0x14,0xe1,0x39,0x02,0x02,0xc4,0x02,
+0x01,0xee,0x09,0x13,0x40,0xa7,0x02,0x10,0x50,0x03,0x03,0x03,0x52,0x01,0x55,0x9f,
+0xfe,0x10,0x00,0x0a,0x40,0x08,0x45,0xef,0xfa,0x00,0x05,0xc5,0x02,0x64,0x04,0xff,
+0xf5,0x01,0xef,0xf9,0x25,0x01,0x55,0x09,0xff,0xe1,0xaf,0xfe,0xba,0x02,0x34,0x0e,
+0xff,0xaf,0x02,0x04,0x05,0x65,0x00,0x00,0x83,0x04,0x16,0x2f,0xd0,0x00,0x05,0x27,
+0x04,0x0f,0x01,0x00,0x22,0x18,0xdf,0x0d,0x00,0x14,0xd3,0x0e,0x00,0x50,0xff,0xff,
+0xff,0xff,0xd3,0x15,0x00,0x01,0x00,0x21,0x03,0x32,0x06,0x00,0xf1,0x01,0x67,0x75,
+0x20,0x00,0x00,0x4f,0xff,0x00,0x00,0x00,0x29,0xff,0xff,0xff,0xfd,0x70,0x0c,0x00,
+0x20,0x08,0xff,0x01,0x00,0xf0,0x11,0xfe,0x60,0x3f,0xff,0x00,0x01,0xcf,0xff,0xff,
+0xfe,0xef,0xff,0xff,0xfb,0x3f,0xff,0x00,0x0d,0xff,0xff,0xb4,0x00,0x00,0x5b,0xff,
+0xff,0xdf,0xff,0x00,0xaf,0xff,0xe4,0x40,0x00,0x81,0x4d,0xff,0xff,0xff,0x04,0xff,
+0xfd,0x10,0x53,0x00,0xf4,0x04,0xcf,0xff,0xff,0x0c,0xff,0xf2,0x00,0x00,0x00,0x06,
+0xff,0xee,0xef,0xff,0xff,0x1f,0xff,0x80,0x00,0x4c,0x00,0x20,0x5f,0xff,0x23,0x00,
+0x11,0x07,0x0c,0x00,0x20,0x04,0x43,0x2d,0x00,0x7f,0x01,0x44,0x44,0x44,0x44,0x43,
+0x00,0x01,0x00,0x04,0x10,0x34,0x1e,0x00,0x02,0x0a,0x00,0x11,0x40,0x35,0x00,0x10,
+0x70,0x33,0x00,0x21,0xff,0xf5,0x0c,0x00,0x02,0x57,0x00,0xf1,0x02,0xf1,0xff,0xff,
+0xfd,0xee,0xff,0x60,0x00,0x00,0x00,0x2f,0xff,0xb0,0xff,0xff,0xfb,0x00,0x56,0x00,
+0x20,0xdf,0xff,0x30,0x00,0x10,0xd3,0x0c,0x00,0xf2,0x04,0x4e,0xff,0xfa,0x00,0xff,
+0xfe,0xff,0xff,0xb5,0x00,0x00,0x4b,0xff,0xff,0xd0,0x00,0xff,0xf3,0xbf,0xcc,0x00,
+0x74,0xfc,0x10,0x00,0xff,0xf3,0x06,0xff,0x4c,0x00,0xa1,0xff,0xf4,0x00,0x17,0xdf,
+0xff,0xff,0xff,0xa2,0x00,0x0c,0x00,0x50,0x00,0x02,0x67,0x76,0x30,0x40,0x00,0x2a,
+0x23,0x30,0x94,0x00,0x20,0x01,0xa7,0x06,0x00,0x40,0x1c,0xff,0x00,0x00,0x16,0x01,
+0x01,0x0b,0x00,0x9f,0xff,0x14,0x44,0x44,0xcf,0xff,0xff,0xef,0xff,0x01,0x00,0x1b,
+0x50,0x7b,0xbb,0xbb,0xff,0xff,0x42,0x00,0x11,0x5f,0x06,0x00,0x11,0x05,0x06,0x00,
+0x21,0x00,0x5f,0x06,0x00,0x21,0x05,0xfd,0x6d,0x00,0x02,0x52,0x01,0x13,0x96,0x7b,
+0x00,0x11,0x0c,0x1b,0x00,0x01,0x63,0x01,0x04,0x11,0x00,0x00,0x09,0x00,0x41,0x13,
+0x33,0x33,0xcf,0x09,0x00,0x11,0xdf,0x57,0x00,0x42,0x00,0x4a,0x20,0xff,0x09,0x00,
+0x23,0xcf,0xe1,0x09,0x00,0x23,0x3e,0xfa,0x09,0x00,0x23,0x06,0xfe,0x09,0x00,0x14,
+0x05,0x09,0x00,0x24,0x2e,0xfa,0x2d,0x00,0x13,0xf2,0x09,0x00,0x52,0x5b,0x30,0x7c,
+0xcc,0xcc,0x99,0x00,0x05,0x9c,0x00,0x06,0x9f,0x00,0x05,0xa2,0x00,0x05,0xa5,0x00,
+0x00,0x01,0x00,0x19,0x21,0x23,0x01,0x09,0x32,0x01,0x27,0xaf,0xb1,0x0d,0x00,0x32,
+0x07,0xff,0xd1,0x09,0x00,0x21,0x1a,0x70,0x21,0x02,0x24,0xd0,0x00,0x4d,0x01,0x52,
+0x06,0x30,0x05,0xff,0xa0,0x0d,0x00,0x82,0xf0,0x00,0x03,0xff,0x70,0x08,0xff,0x40,
+0x5c,0x01,0x00,0xe6,0x00,0xf2,0x03,0x70,0x0c,0xfc,0x01,0x44,0x44,0x4c,0xff,0xff,
+0xf0,0x00,0x00,0x0a,0xff,0x30,0x4f,0xf3,0xef,0xab,0x00,0x71,0x5a,0x20,0x0c,0xfb,
+0x00,0xdf,0x8f,0x0d,0x00,0x85,0xf0,0x0c,0xfe,0x20,0x4f,0xf1,0x08,0xfb,0xd8,0x00,
+0x52,0x00,0xff,0x50,0x5f,0xef,0x1b,0x00,0x75,0x00,0x6f,0xe0,0x0c,0xf7,0x04,0xff,
+0x05,0x01,0x52,0x00,0xcf,0x70,0x4f,0xff,0x1b,0x00,0x55,0x02,0xef,0xa0,0x0f,0xf5,
+0x17,0x01,0x72,0xcf,0xe2,0x04,0xff,0x10,0x9f,0xbf,0x1b,0x00,0x75,0x04,0xa2,0x00,
+0xcf,0xb0,0x0d,0xf8,0xa7,0x01,0x50,0xaf,0xf3,0x04,0xff,0x30,0x09,0x01,0x00,0x87,
+0x00,0x54,0xcf,0xf7,0x00,0xcf,0xc0,0x17,0x01,0x51,0x3f,0xf7,0x00,0x6f,0xf4,0x25,
+0x01,0x00,0x1b,0x00,0x47,0x53,0x00,0x4f,0xfa,0x20,0x01,0x23,0x6f,0xfd,0x39,0x02,
+0x00,0x05,0x00,0x36,0x7f,0xfd,0x10,0x0e,0x01,0x47,0x09,0xfb,0x10,0x00,0x8b,0x03,
+0x46,0x00,0x00,0x00,0x3d,0x1e,0x02,0x26,0xd3,0xdf,0x0c,0x00,0x46,0xfd,0xff,0xff,
+0xca,0x5e,0x02,0x35,0xf6,0x00,0x1d,0x0c,0x00,0x35,0xc0,0x00,0x04,0x0c,0x00,0x30,
+0xa0,0x00,0x02,0x07,0x00,0x10,0x9f,0x05,0x00,0x11,0xe1,0x72,0x03,0x11,0xf4,0x1d,
+0x00,0x20,0xfc,0x42,0x22,0x01,0x34,0x40,0x00,0x4f,0x29,0x00,0x23,0xf4,0x00,0x36,
+0x00,0x21,0x6b,0xff,0x66,0x01,0x11,0x4f,0x14,0x00,0x11,0xbf,0xc2,0x00,0x11,0x0f,
+0x2b,0x00,0x23,0x0b,0x40,0x0c,0x00,0x01,0x14,0x00,0x03,0x0c,0x00,0x1f,0xf0,0x0c,
+0x00,0x04,0x07,0x01,0x00,0x08,0xb4,0x00,0x08,0xcc,0x00,0x00,0xac,0x02,0x14,0xe3,
+0x48,0x02,0x12,0xa0,0x09,0x00,0x13,0xbf,0x47,0x02,0x32,0x2f,0xff,0xf6,0x0e,0x01,
+0x00,0x9e,0x03,0x01,0xe0,0x03,0x31,0xff,0xff,0x50,0x3a,0x02,0x43,0xff,0xff,0xfe,
+0x00,0x9f,0x00,0x53,0xf8,0x00,0x00,0x00,0x1e,0xbc,0x00,0x11,0x0a,0x54,0x00,0x32,
+0xe0,0x00,0x05,0x5d,0x00,0x23,0x90,0x00,0x76,0x00,0x22,0x20,0x5f,0x08,0x00,0x23,
+0xf9,0x0a,0x77,0x00,0x14,0xe0,0x34,0x01,0x32,0x2f,0xff,0x2d,0xf9,0x00,0x31,0xef,
+0xf1,0xaf,0x09,0x00,0x31,0x3c,0xff,0x44,0x08,0x00,0x41,0xf1,0x8f,0xfc,0x07,0x23,
+0x01,0x50,0x01,0xff,0xf9,0x02,0x7c,0x79,0x00,0x83,0x07,0xff,0xfb,0x40,0x6f,0xff,
+0xff,0xb0,0x66,0x00,0x13,0xd1,0xbb,0x04,0x90,0xb0,0x00,0x00,0x00,0x02,0x8d,0xff,
+0xda,0x40,0x8b,0x04,0x00,0x95,0x00,0x21,0x04,0x0f,0xa5,0x00,0x21,0x1d,0xfb,0xbe,
+0x00,0x30,0x2d,0xff,0xff,0x84,0x04,0x11,0x2e,0x9e,0x01,0x31,0x00,0x3f,0xff,0x0f,
+0x00,0x12,0x4f,0xad,0x01,0x02,0x96,0x00,0x22,0x60,0x6f,0xbc,0x01,0x1d,0x8f,0x29,
+0x01,0x1e,0xff,0x01,0x00,0x13,0x8e,0xe9,0x01,0x03,0xe8,0x01,0x23,0x60,0x1c,0xf8,
+0x01,0x12,0x0b,0x0f,0x00,0x02,0x9c,0x00,0x11,0xf6,0x33,0x01,0x01,0x78,0x00,0x11,
+0x07,0x0f,0x00,0x00,0x51,0x03,0x30,0xea,0xbb,0x30,0x64,0x01,0x17,0xb4,0x57,0x02,
+0x24,0xdf,0x91,0x0b,0x00,0x36,0xdf,0xff,0xe6,0xb6,0x01,0x13,0xfc,0xa6,0x03,0x00,
+0x43,0x00,0x16,0xa1,0xcb,0x01,0x15,0xf7,0x15,0x00,0x36,0xff,0xfd,0x40,0xe0,0x01,
+0x14,0xa2,0x15,0x00,0x01,0x8b,0x01,0x04,0xf5,0x01,0x35,0xfe,0x50,0x00,0xb4,0x00,
+0x16,0xb2,0x0a,0x02,0x16,0xf5,0xca,0x00,0x06,0xb6,0x02,0x16,0xfe,0x15,0x00,0x14,
+0x6f,0x09,0x00,0x24,0xfb,0x20,0x0a,0x00,0x15,0xe5,0x54,0x00,0x00,0x8b,0x05,0x03,
+0x1d,0x00,0x04,0x69,0x00,0x15,0xd4,0x93,0x00,0x14,0x70,0xa8,0x00,0x24,0xfa,0x10,
+0xa8,0x00,0x12,0xd3,0xc7,0x00,0x43,0x0d,0xff,0xfe,0x60,0xdd,0x00,0x3e,0x3d,0xf9,
+0x10,0x4b,0x06,0x51,0x19,0xcc,0xcc,0xc9,0x10,0x06,0x00,0x10,0x1b,0x5c,0x00,0x01,
+0x4b,0x01,0x12,0xfb,0x1d,0x04,0x05,0x98,0x00,0x06,0xcd,0x02,0x0f,0x15,0x00,0x86,
+0x20,0xfe,0xff,0x15,0x03,0x10,0x0e,0x06,0x00,0x11,0x5f,0x28,0x03,0x01,0x06,0x00,
+0x41,0x13,0x33,0x33,0x10,0x08,0x06,0x33,0x10,0x01,0x44,0x01,0x00,0x26,0x41,0x06,
+0x30,0x04,0x1e,0xef,0x8f,0x01,0x0f,0x01,0x00,0x97,0x15,0xbf,0x0a,0x00,0x33,0xb1,
+0x8b,0xbb,0x01,0x00,0x21,0x81,0x04,0xd4,0x01,0x42,0x44,0x3b,0xfd,0x10,0xa3,0x06,
+0x50,0xfd,0x20,0x00,0x00,0x06,0x15,0x01,0x31,0x30,0x00,0x00,0x5e,0x02,0x11,0x40,
+0x0f,0x00,0x00,0x21,0x01,0x12,0x6f,0x34,0x03,0x03,0x0f,0x01,0x13,0x70,0x7c,0x02,
+0x2f,0x86,0xff,0x88,0x03,0x10,0x12,0xfd,0xad,0x03,0x22,0xfc,0x16,0x07,0x00,0x02,
+0x4b,0x00,0x12,0xfb,0x5a,0x00,0x12,0xfa,0x69,0x00,0x12,0xf8,0x78,0x00,0x20,0xf7,
+0x00,0x0f,0x00,0x12,0xef,0x84,0x03,0x20,0xf4,0xb5,0x9d,0x00,0x21,0x3b,0xba,0xa4,
+0x00,0x16,0x37,0x0d,0x07,0x12,0x5f,0xd7,0x04,0x03,0xd3,0x04,0x13,0x40,0x0b,0x00,
+0x00,0x2d,0x04,0x13,0x30,0x0a,0x05,0x00,0xc2,0x00,0x11,0x20,0x0b,0x00,0x25,0x2e,
+0xff,0x0c,0x00,0x12,0x1d,0x8c,0x00,0x12,0x10,0xf0,0x07,0x02,0x8a,0x00,0x05,0x0b,
+0x00,0x00,0x0c,0x00,0x15,0x0b,0x4f,0x03,0x03,0x67,0x09,0x02,0xa6,0x03,0x06,0xc8,
+0x00,0x26,0xf0,0x0d,0xd3,0x00,0x06,0x63,0x06,0x19,0xfd,0xa7,0x07,0x24,0x04,0x44,
+0x01,0x00,0x06,0x50,0x00,0x28,0xff,0xfb,0x45,0x00,0x07,0xea,0x05,0x08,0x17,0x00,
+0x16,0x0e,0xe2,0x03,0x34,0x00,0x4b,0xbb,0x01,0x00,0x02,0xde,0x00,0x12,0x20,0x02,
+0x08,0x12,0xb0,0xce,0x05,0x11,0x80,0x06,0x00,0x11,0xf8,0x06,0x00,0x1f,0xfa,0x06,
+0x00,0x0e,0x32,0x8f,0xff,0xfa,0x38,0x0a,0x00,0x2f,0x06,0x1f,0x0a,0x07,0x00,0x19,
+0x11,0x80,0x07,0x00,0x20,0xf8,0x00,0x07,0x00,0x02,0x10,0x0a,0x14,0x02,0x8b,0x00,
+0x31,0xbf,0xa0,0x00,0x5b,0x00,0x1f,0xa0,0x5b,0x00,0x28,0x0f,0xc3,0x00,0x1f,0x01,
+0x0e,0x08,0x24,0x0b,0xfa,0x8b,0x00,0x04,0x99,0x05,0x16,0x43,0x16,0x09,0x02,0x76,
+0x05,0x01,0x15,0x07,0x15,0xb0,0xed,0x09,0x25,0xfc,0x00,0xef,0x09,0x1f,0xc0,0x15,
+0x00,0x1a,0x07,0x06,0x02,0x0e,0xd8,0x02,0x09,0xf5,0x02,0xbf,0xd1,0x77,0x77,0x77,
+0x7d,0xff,0xfd,0x77,0x77,0x77,0x71,0x69,0x00,0x21,0x0b,0x15,0x00,0x14,0xaf,0xdb,
+0x07,0x40,0x00,0x02,0xab,0xa2,0x07,0x00,0x23,0x16,0x77,0x01,0x00,0x28,0x76,0x1d,
+0xcc,0x08,0x0e,0x01,0x00,0x02,0xb5,0x08,0x05,0xd7,0x0b,0x07,0x01,0x00,0x63,0x16,
+0xad,0xef,0xed,0xa6,0x10,0x56,0x00,0x12,0xbf,0x6a,0x06,0x04,0x2f,0x08,0x72,0xe9,
+0x54,0x59,0xef,0xff,0xf9,0x00,0x80,0x07,0x51,0x90,0x00,0x00,0x00,0x9f,0x09,0x04,
+0x10,0x2e,0x28,0x06,0x40,0x14,0x20,0x00,0x7f,0x41,0x03,0x10,0x1e,0xbc,0x07,0xc0,
+0x06,0xff,0xc2,0x00,0xbf,0xff,0xfe,0x10,0x0b,0xff,0xff,0xf3,0x88,0x03,0x60,0xe2,
+0x03,0xff,0xff,0xfb,0x06,0x5f,0x08,0x00,0x62,0x0a,0xa0,0xa0,0x0e,0xff,0xff,0xf5,
+0xef,0xff,0xff,0xc0,0x0d,0xe6,0x0c,0x00,0xc0,0x0c,0x10,0xee,0x58,0x03,0x02,0x55,
+0x0a,0x02,0x69,0x05,0x21,0xe0,0x0c,0x6b,0x03,0x90,0xef,0xff,0xff,0x50,0xbf,0xff,
+0xff,0x30,0x4f,0x5a,0x04,0xe0,0x3f,0xff,0xff,0xb0,0x01,0xdf,0xff,0xfb,0x00,0x7f,
+0xff,0xff,0x80,0x0b,0x73,0x09,0xf2,0x03,0x02,0xef,0xff,0xf7,0x00,0x39,0xb9,0x30,
+0x07,0xff,0xff,0xe2,0x00,0x00,0x02,0xcf,0xff,0xf9,0xa8,0x00,0x21,0xd2,0x00,0x9c,
+0x00,0x42,0xfe,0x95,0x45,0x9e,0xa8,0x00,0x32,0x00,0x00,0x2a,0x60,0x03,0x13,0x30,
+0x1b,0x0a,0x51,0x6a,0xdf,0xfe,0xda,0x71,0x1e,0x09,0x1a,0xe6,0x6d,0x0c,0x29,0xff,
+0xf9,0x10,0x00,0x48,0x0d,0xff,0xfc,0x20,0x10,0x00,0xa1,0x0a,0xff,0xfe,0x40,0x00,
+0x48,0xce,0xff,0xeb,0x72,0x10,0x00,0x00,0x8c,0x04,0x21,0x88,0xef,0x17,0x04,0x12,
+0x40,0x64,0x02,0x00,0x0d,0x00,0x62,0xb6,0x45,0x7d,0xff,0xff,0xb1,0x50,0x00,0x14,
+0xbf,0x2b,0x05,0x01,0xb8,0x0d,0x00,0xa3,0x02,0x53,0xf6,0x01,0x76,0x20,0x04,0xe9,
+0x09,0x10,0x10,0x2e,0x0d,0x41,0x1f,0xff,0x90,0x08,0x28,0x01,0x50,0x00,0x6e,0x40,
+0x00,0x2c,0xb0,0x01,0x50,0x80,0x0f,0xff,0xff,0xe1,0x9f,0x04,0x12,0x70,0x72,0x08,
+0x20,0x00,0xbf,0xc7,0x00,0x10,0x09,0x55,0x00,0x00,0xfd,0x04,0x10,0xf3,0x15,0x00,
+0x30,0x10,0x00,0x9f,0x2e,0x09,0x91,0x03,0xdf,0xff,0xff,0x30,0x9f,0xff,0xff,0xf1,
+0x8c,0x0a,0x10,0x40,0x71,0x00,0x51,0xf4,0x0b,0xff,0xff,0xf9,0xa4,0x08,0x10,0xf9,
+0x01,0x0b,0x00,0x94,0x02,0x12,0xfd,0x4e,0x03,0x11,0xf1,0x9f,0x0d,0x00,0xba,0x09,
+0x11,0x00,0xc6,0x04,0x12,0xc0,0xf2,0x0b,0x01,0x1b,0x05,0x00,0x20,0x00,0x12,0xc2,
+0x3f,0x01,0x14,0x80,0xdb,0x00,0x54,0xfb,0x64,0x51,0x00,0x05,0x10,0x00,0x10,0x01,
+0x33,0x02,0x63,0xe3,0x00,0x02,0xdf,0xff,0xc1,0x59,0x0a,0x54,0x9d,0xef,0xfe,0xb1,
+0x00,0x93,0x0e,0x05,0x01,0x00,0x39,0x7f,0xff,0xf6,0x10,0x00,0x18,0x3e,0x62,0x02,
+0x50,0x00,0x00,0x00,0x1b,0xc0,0x11,0x00,0x01,0x00,0x46,0x1c,0xfc,0x10,0x00,0x01,
+0x00,0x37,0x0a,0xff,0xfa,0x0e,0x00,0x47,0x04,0xff,0xff,0xf4,0x0f,0x00,0x46,0xdf,
+0xff,0xff,0xd0,0x0e,0x00,0x55,0x6f,0xff,0xff,0xff,0x60,0x0e,0x00,0x55,0x1e,0xff,
+0xff,0xff,0xfe,0x4a,0x00,0x64,0x09,0xff,0xff,0xff,0xff,0xf9,0x0e,0x00,0x20,0x02,
+0xff,0x01,0x00,0x14,0xf2,0x0f,0x00,0x73,0xbf,0xff,0xa4,0x44,0xaf,0xff,0xb0,0x0e,
+0x00,0x82,0x4f,0xff,0xf7,0x00,0x07,0xff,0xff,0x40,0x0e,0x00,0x81,0x0d,0xff,0xff,
+0x80,0x00,0x8f,0xff,0xfd,0x0e,0x00,0x00,0x18,0x00,0x10,0xf9,0x4c,0x00,0x11,0xf7,
+0x0e,0x00,0xa1,0x01,0xff,0xff,0xff,0xa0,0x00,0xaf,0xff,0xff,0xf1,0x0f,0x00,0xa0,
+0x9f,0xff,0xff,0xfb,0x00,0x0b,0xff,0xff,0xff,0x90,0x0e,0x00,0xf0,0x04,0x3f,0xff,
+0xff,0xff,0xc0,0x00,0xcf,0xff,0xff,0xff,0x30,0x00,0x00,0x00,0x0c,0xff,0xff,0xff,
+0xfd,0x4d,0x00,0x61,0xff,0xfc,0x00,0x00,0x00,0x05,0x80,0x00,0x10,0xdf,0x05,0x00,
+0x50,0xf5,0x00,0x00,0x00,0xef,0x1d,0x00,0x20,0x10,0x2d,0x0f,0x00,0x51,0xe0,0x00,
+0x00,0x7f,0xff,0xc8,0x00,0x10,0x6f,0x07,0x00,0x30,0x70,0x00,0x1f,0x07,0x00,0x31,
+0xf8,0x00,0x08,0x32,0x00,0x31,0x10,0x0a,0xff,0x34,0x00,0x11,0x26,0x07,0x00,0x38,
+0xfa,0x00,0xff,0x01,0x00,0x28,0xf0,0x0d,0x0e,0x00,0x38,0xfd,0x00,0x3d,0x0e,0x00,
+0x15,0x30,0x18,0x01,0x17,0x69,0x40,0x01,0x27,0xff,0xc0,0x0c,0x00,0x50,0xfc,0x00,
+0x9b,0xbb,0xbb,0x28,0x00,0xc0,0x3b,0xbb,0xff,0xff,0xc0,0xff,0xff,0xff,0xf3,0x00,
+0x00,0x02,0x9b,0x00,0x10,0xfb,0x4a,0x01,0x11,0x20,0x51,0x01,0x20,0xff,0xfe,0x05,
+0x00,0x21,0xe1,0x01,0xbb,0x00,0xf0,0x09,0xe3,0x00,0x00,0x3e,0xff,0xe2,0x0c,0xff,
+0xfe,0x20,0xff,0xfe,0x30,0x00,0x00,0x03,0xff,0x30,0xaf,0xff,0xf3,0x00,0xff,0xe3,
+0x4e,0x00,0x20,0x54,0x09,0x42,0x01,0x12,0xbe,0x77,0x00,0x34,0x7f,0xff,0xf6,0x66,
+0x00,0x10,0x06,0xd4,0x00,0x05,0x69,0x01,0x32,0xf9,0x04,0x50,0x24,0x00,0x53,0x03,
+0xff,0xff,0xa0,0x3f,0x3c,0x00,0xa0,0x2e,0xff,0xfc,0x02,0xef,0xfe,0x30,0xff,0xfe,
+0x30,0x65,0x00,0x31,0xd1,0x01,0xef,0x6c,0x00,0x02,0xce,0x01,0x14,0x2e,0x84,0x00,
+0x10,0xe2,0x34,0x00,0x00,0x9c,0x00,0x08,0xb4,0x00,0x08,0xcc,0x00,0x0e,0xe4,0x00,
+0x07,0xfc,0x00,0x15,0x20,0x12,0x00,0x25,0xaf,0x90,0x0a,0x00,0x25,0xff,0x90,0x0a,
+0x00,0x04,0x0b,0x00,0x13,0xaf,0xcd,0x01,0x00,0x0a,0x00,0x13,0xfd,0x0b,0x00,0x41,
+0xaf,0xff,0xf9,0x0a,0x0b,0x00,0x00,0x0a,0x00,0x12,0x00,0x0b,0x00,0x00,0x0a,0x00,
+0x02,0x0b,0x00,0x01,0x0a,0x00,0x01,0x0b,0x00,0x11,0x9f,0x6f,0x02,0x00,0x0b,0x00,
+0x33,0x79,0xff,0xf9,0xcb,0x02,0x33,0xf8,0x0b,0xf9,0xd6,0x02,0x34,0xfa,0x00,0x02,
+0x8c,0x02,0x06,0x8f,0x00,0x34,0x20,0x00,0xbf,0x79,0x00,0x25,0xa0,0x9f,0x79,0x00,
+0x15,0x89,0x79,0x00,0x1f,0xf7,0x79,0x00,0x12,0x15,0xaf,0x79,0x00,0x15,0xdf,0x79,
+0x00,0x05,0xfc,0x02,0x16,0x0a,0x06,0x03,0x16,0x0a,0x10,0x03,0x15,0x0a,0x0a,0x00,
+0x05,0x97,0x00,0x38,0x03,0xd9,0x00,0x01,0x00,0x70,0x03,0xef,0xfa,0x00,0x00,0x34,
+0x44,0x01,0x00,0x11,0x10,0x0f,0x00,0x42,0xff,0xfa,0x00,0x7f,0x5c,0x02,0x02,0x0f,
+0x00,0x32,0xff,0xfa,0x05,0x0f,0x00,0x14,0xf1,0x9a,0x01,0xf1,0x01,0x05,0xbb,0xbb,
+0xbb,0xbb,0xbf,0xff,0x10,0x00,0x00,0xef,0xfe,0xdf,0xfb,0xff,0xf8,0x48,0x00,0x92,
+0xef,0xf1,0x00,0x00,0x0d,0xfe,0x2b,0xff,0x48,0xaa,0x03,0x10,0x0e,0x1f,0x00,0x65,
+0x17,0x20,0xbf,0xf4,0x05,0x50,0x1f,0x00,0x34,0x00,0x00,0x0b,0x7d,0x03,0x00,0x1f,
+0x00,0x00,0xa0,0x03,0x04,0xf4,0x03,0x0f,0x1f,0x00,0x0a,0x65,0xaf,0x70,0xef,0xf1,
+0x4f,0xc0,0x1f,0x00,0x50,0x3f,0xff,0x6e,0xff,0x5f,0x66,0x00,0x20,0xbf,0xf7,0xb6,
+0x00,0x21,0x20,0xcf,0x4e,0x02,0x00,0x1f,0x00,0x01,0x01,0x00,0x21,0x50,0xbf,0x0f,
+0x00,0x00,0xfd,0x03,0x01,0x54,0x02,0x22,0x00,0xbf,0x0f,0x00,0x21,0x04,0xbb,0x01,
+0x00,0x59,0x60,0x00,0xbf,0xff,0xd1,0x02,0x01,0x1a,0xbf,0x0f,0x00,0x10,0x00,0x65,
+0x00,0x01,0x63,0x03,0x15,0x40,0x8c,0x04,0x05,0x9d,0x04,0x26,0xff,0xff,0x19,0x00,
+0x07,0x86,0x03,0x18,0xd3,0x92,0x03,0x1f,0xff,0x01,0x00,0x70,0x17,0xdf,0x90,0x00,
+0x17,0x3d,0xa8,0x00,0x02,0x15,0x02,0x17,0xa0,0xfd,0x00,0x15,0xfb,0x0b,0x00,0x25,
+0x0b,0xff,0x2a,0x05,0x00,0x34,0x01,0x16,0xfb,0x17,0x00,0x05,0x19,0x00,0x11,0xbf,
+0x00,0x02,0x06,0x17,0x00,0x03,0x19,0x00,0x23,0xbf,0xff,0xb7,0x04,0x03,0xf3,0x04,
+0x01,0x77,0x01,0x00,0x73,0x02,0x63,0x22,0x2f,0xff,0xff,0xf2,0x22,0x06,0x03,0x6f,
+0x0f,0xff,0xff,0xf0,0x00,0x00,0x0c,0x00,0x2b,0x40,0x25,0x55,0x55,0x52,0x0c,0x00,
+0x00,0x08,0x00,0x93,0xef,0xff,0xff,0xf9,0x0c,0xff,0xff,0xc0,0x9f,0xbd,0x04,0x44,
+0x20,0x01,0x10,0x02,0xe9,0x00,0x4f,0xf9,0x88,0x88,0x9f,0x1c,0x01,0x05,0x35,0x71,
+0xe7,0x1e,0x0c,0x00,0x43,0xb6,0xfb,0x6f,0xff,0xbe,0x00,0x06,0xdb,0x00,0x0c,0x01,
+0x00,0x47,0x0d,0xea,0x63,0x00,0xe7,0x04,0x27,0xff,0x80,0xa6,0x06,0x16,0xff,0xf4,
+0x04,0x06,0xaf,0x00,0x14,0x0a,0x01,0x01,0x03,0x4b,0x06,0x05,0xaa,0x04,0x18,0x4f,
+0xac,0x06,0x18,0x9f,0xd6,0x06,0x17,0x6f,0xb6,0x06,0x27,0x00,0x6f,0xe7,0x04,0x17,
+0x0a,0x25,0x00,0x11,0x04,0x47,0x06,0x03,0x58,0x00,0x36,0xdf,0xff,0xf7,0xc6,0x01,
+0x02,0xc7,0x06,0x22,0x01,0x40,0xdb,0x04,0x00,0x38,0x05,0x61,0x3a,0xff,0xa0,0x00,
+0x01,0xbf,0x95,0x05,0x70,0x05,0xcf,0xff,0xff,0x70,0x03,0xdf,0xd3,0x06,0x11,0x00,
+0x4b,0x06,0x13,0x6a,0xb9,0x01,0x13,0xef,0xf7,0x00,0x13,0xa0,0xb4,0x00,0x02,0x99,
+0x06,0x03,0x71,0x07,0x04,0x5c,0x06,0x11,0x03,0x0c,0x00,0x15,0xe7,0x88,0x01,0x24,
+0xff,0xfc,0x90,0x00,0x46,0x8f,0xfe,0xc9,0x62,0x5f,0x04,0x15,0x42,0x0a,0x00,0x30,
+0xcf,0xff,0xc2,0x08,0x00,0x41,0x37,0x73,0x00,0x2e,0x60,0x06,0x21,0x00,0x08,0xbd,
+0x04,0x31,0xcf,0xff,0xa0,0xf5,0x00,0x80,0xb0,0xef,0xf4,0x04,0xff,0xe0,0x00,0x09,
+0x6f,0x01,0x51,0xff,0xf1,0x01,0xff,0xf0,0x15,0x00,0x71,0x00,0xcf,0xfb,0x5b,0xff,
+0xc0,0x09,0x84,0x01,0x10,0x5f,0x0b,0x07,0x11,0x9f,0xa4,0x00,0x17,0x08,0x99,0x01,
+0x26,0x39,0xbe,0x8b,0x02,0x00,0xc0,0x06,0x16,0xfb,0xd7,0x05,0x12,0xf5,0x15,0x00,
+0x11,0x4a,0x01,0x04,0x02,0x84,0x00,0x04,0x84,0x07,0x10,0x2e,0x3f,0x00,0x11,0xef,
+0x17,0x00,0x00,0x84,0x00,0x21,0xd0,0x2e,0x17,0x00,0x01,0x84,0x00,0x11,0x02,0x17,
+0x00,0x02,0x84,0x00,0x01,0x17,0x00,0x01,0x84,0x00,0x11,0x00,0x17,0x00,0x11,0x5f,
+0x4a,0x00,0x00,0x17,0x00,0x31,0xd0,0x08,0xff,0xe4,0x04,0x87,0x01,0xae,0xea,0x20,
+0x00,0x39,0xb9,0x30,0x3d,0x03,0x00,0xf4,0x01,0x14,0x7a,0x18,0x01,0x34,0xff,0x08,
+0xfb,0x17,0x04,0x35,0xf0,0x8f,0xfb,0x15,0x00,0x51,0xff,0xfa,0x47,0x88,0x40,0x15,
+0x00,0x63,0x48,0x88,0x7f,0xff,0xf8,0x0f,0x41,0x04,0x35,0xff,0xff,0x80,0x77,0x02,
+0x25,0xf8,0x0f,0x0b,0x00,0x0f,0x15,0x00,0x60,0x40,0xfc,0x04,0x78,0x88,0x01,0x00,
+0x56,0x74,0xff,0xff,0xfa,0x10,0xe7,0x01,0x03,0x02,0x06,0x04,0x84,0x08,0x05,0xf2,
+0x03,0x10,0xfb,0x0b,0x01,0x11,0x44,0x01,0x00,0x12,0x42,0x10,0x03,0x02,0xc9,0x08,
+0x25,0x00,0xef,0x0b,0x00,0x30,0x0f,0xff,0xcb,0x6b,0x05,0x43,0xbd,0xff,0xf8,0x00,
+0x14,0x03,0x10,0x0f,0x7b,0x00,0x04,0x43,0x05,0x15,0xf7,0x15,0x00,0x36,0xff,0xef,
+0xff,0x58,0x05,0x16,0xf0,0x7b,0x00,0x10,0x54,0x5e,0x00,0x1f,0x45,0xe1,0x04,0x09,
+0x35,0xfe,0xce,0xff,0x6f,0x00,0x14,0x08,0xc9,0x00,0x02,0x8e,0x09,0x12,0xff,0xa3,
+0x03,0x15,0x8f,0x95,0x04,0x04,0xdb,0x02,0x25,0xf2,0x00,0x20,0x04,0x2b,0xf7,0x57,
+0x50,0x00,0x06,0x05,0x04,0x33,0xb1,0x8b,0xbb,0x01,0x00,0x34,0x81,0x13,0x33,0x01,
+0x00,0x16,0x1f,0x79,0x00,0x0f,0x8e,0x00,0x02,0x06,0x2a,0x00,0x2f,0x10,0x00,0x01,
+0x00,0x0b,0x24,0x57,0x77,0x01,0x00,0x1f,0x5f,0x4a,0x00,0x01,0x24,0xfc,0xee,0x01,
+0x00,0x1f,0xeb,0x49,0x00,0x0c,0x15,0x01,0x73,0x00,0x16,0x31,0x3f,0x00,0x1f,0xef,
+0x54,0x00,0x01,0x16,0xe1,0x2a,0x00,0x08,0x0c,0x06,0x1e,0xdf,0xb4,0x06,0x0c,0x44,
+0x00,0x26,0xfe,0x2d,0x0c,0x00,0x35,0xd2,0x00,0x9f,0x5e,0x05,0x34,0x00,0xe4,0x05,
+0x0c,0x00,0x52,0x50,0x4e,0xff,0x80,0x2c,0x0b,0x00,0x71,0xc2,0x08,0xff,0xff,0xfc,
+0x20,0x8f,0x22,0x00,0x20,0x01,0xcf,0x7f,0x03,0x71,0x04,0xef,0xff,0xff,0xfe,0x40,
+0x5e,0x1e,0x00,0x63,0x90,0x1c,0xff,0xff,0xb1,0x09,0x70,0x00,0x44,0x20,0x6d,0xd6,
+0x02,0x80,0x00,0x14,0xf6,0x70,0x04,0x00,0x01,0x00,0x2f,0xd9,0x9d,0xd8,0x06,0x23,
+0x12,0x4f,0xd7,0x0a,0x02,0x0f,0x0c,0x13,0x60,0x9c,0x03,0x12,0xf1,0xe7,0x0b,0x02,
+0x4e,0x05,0x04,0xdd,0x04,0x13,0x1f,0x21,0x0c,0x14,0x03,0x19,0x00,0x00,0x88,0x01,
+0x54,0xc8,0x88,0x87,0x30,0x08,0xf5,0x02,0x13,0xaf,0x16,0x05,0x14,0x0c,0x37,0x02,
+0x15,0xef,0xd8,0x02,0x03,0xdb,0x06,0x42,0x37,0x88,0x88,0xaf,0x69,0x04,0x24,0x00,
+0x08,0xde,0x05,0x33,0xcf,0xff,0xf3,0xc1,0x02,0x23,0xfa,0x00,0x38,0x05,0x13,0x10,
+0x25,0x0b,0x13,0x70,0x32,0x07,0x03,0xd3,0x0c,0x04,0x4d,0x08,0x24,0x3f,0xfb,0x54,
+0x06,0x13,0x20,0x1f,0x06,0x13,0x70,0x94,0x09,0x22,0xdf,0xd3,0xf0,0x05,0x72,0x78,
+0x88,0xff,0xef,0xf8,0x88,0x74,0xbe,0x00,0x20,0x90,0x9f,0x24,0x03,0x00,0x85,0x00,
+0x25,0xf9,0x09,0x9c,0x03,0x12,0xfe,0x39,0x03,0x0a,0xb1,0x03,0x15,0xe5,0xc6,0x03,
+0x70,0xf4,0x07,0x88,0x88,0x88,0x03,0x30,0x15,0x00,0x11,0x07,0x98,0x04,0x20,0x40,
+0x0f,0x06,0x00,0x01,0x98,0x04,0x11,0x40,0x06,0x00,0x01,0x0f,0x00,0x15,0x4f,0x15,
+0x00,0x14,0xfe,0x15,0x00,0x24,0x00,0x00,0x2a,0x00,0x33,0xb8,0x88,0x88,0x15,0x00,
+0x03,0x0b,0x04,0x03,0x5a,0x03,0x0f,0x15,0x00,0x0c,0x43,0xf4,0x78,0x88,0x80,0x15,
+0x00,0x02,0x27,0x01,0x04,0xe4,0x03,0x06,0x15,0x00,0x16,0x07,0x15,0x00,0x16,0x4f,
+0xe7,0x05,0x26,0x08,0xf8,0xe3,0x0b,0x14,0xf0,0xed,0x02,0x53,0x5f,0xff,0x51,0x00,
+0x00,0x70,0x01,0x03,0x72,0x0a,0x15,0x0c,0x32,0x00,0x24,0x0a,0xff,0x05,0x0e,0x12,
+0x04,0x52,0x00,0x13,0xf3,0xe3,0x0b,0x02,0xe6,0x0b,0x14,0x0e,0x39,0x0d,0x08,0xce,
+0x04,0x06,0x32,0x01,0x25,0x01,0xff,0xe0,0x0a,0x24,0x4f,0xff,0xe1,0x09,0x16,0x08,
+0xd8,0x04,0x04,0x74,0x02,0x35,0xd0,0x00,0x5f,0xf5,0x02,0x15,0x3f,0xee,0x00,0x16,
+0x3d,0x91,0x02,0x16,0xdf,0x2c,0x03,0x23,0x78,0x88,0x01,0x00,0x1a,0x72,0xb5,0x03,
+0x14,0x6f,0xce,0x07,0x00,0x76,0x00,0x14,0xe1,0x83,0x0b,0x60,0xcf,0xc3,0x00,0x00,
+0x00,0x00,0x26,0x3d,0xff,0x01,0x00,0x38,0xfd,0x3d,0xff,0x0e,0x00,0x1a,0xff,0x01,
+0x00,0xfc,0x09,0x10,0x1f,0x90,0x09,0xf1,0x01,0xf9,0x00,0x9f,0x10,0x1f,0xff,0xff,
+0xf0,0x00,0xf8,0x00,0x8f,0x00,0x0f,0x80,0x08,0xf0,0x00,0x1b,0x00,0x0b,0x01,0x00,
+0x90,0xb8,0x8f,0xe8,0x8b,0xfb,0x88,0xfe,0x88,0xbf,0x0d,0x00,0x91,0xf4,0x00,0xcc,
+0x00,0x4f,0x40,0x0c,0xc0,0x04,0x1b,0x00,0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x0d,
+0x00,0x01,0x24,0x00,0x00,0x2d,0x00,0x0d,0x42,0x00,0x00,0x5a,0x00,0x00,0x01,0x00,
+0x90,0x09,0xf1,0x01,0xff,0xff,0xff,0x00,0x0f,0x80,0x0e,0x00,0x00,0x7e,0x00,0x0c,
+0x1b,0x00,0x08,0x01,0x00,0x18,0xdf,0x0d,0x00,0x28,0xd3,0xdf,0x0d,0x00,0x1f,0x00,
+0x01,0x00,0x03,0x35,0x3a,0xfc,0x20,0x0c,0x00,0x44,0x4b,0xff,0xff,0xc0,0x0c,0x00,
+0x20,0x5c,0xff,0xef,0x00,0x02,0x01,0x00,0x10,0x6e,0x41,0x00,0x11,0xa0,0x0b,0x00,
+0x21,0x01,0x8e,0x4e,0x00,0x10,0x30,0x0c,0x00,0x31,0x02,0x9f,0xff,0xc3,0x00,0x00,
+0x0c,0x00,0x42,0x03,0xaf,0xff,0xff,0xeb,0x00,0x42,0x00,0x00,0x04,0xcf,0x74,0x00,
+0x00,0x4d,0x00,0x15,0x06,0x84,0x00,0x44,0x50,0x00,0x03,0xef,0x0c,0x00,0x45,0xfe,
+0x00,0x00,0x0d,0x9a,0x00,0x45,0xf6,0x00,0x00,0x0f,0x0d,0x00,0x45,0xe0,0x00,0x00,
+0x09,0x0d,0x00,0x00,0xf3,0x00,0x51,0x57,0x88,0x88,0x88,0x8c,0x89,0x01,0x03,0x8d,
+0x00,0x67,0x08,0xff,0xff,0xff,0xf9,0x00,0x0d,0x00,0x18,0xf2,0x0d,0x00,0x18,0xa0,
+0x0d,0x00,0x17,0x30,0x0d,0x00,0x27,0xfc,0x00,0x0d,0x00,0x18,0xf4,0x0d,0x00,0x15,
+0xd0,0x0d,0x00,0x45,0x07,0xff,0xff,0x60,0x0d,0x00,0x37,0x05,0xff,0xfe,0x27,0x01,
+0x2e,0x9f,0xd3,0x3b,0x01,0x11,0xbf,0xa4,0x00,0x32,0xe4,0x00,0x00,0xad,0x00,0x24,
+0xff,0x40,0x09,0x00,0x14,0xf4,0x09,0x00,0x24,0xff,0x40,0x09,0x00,0x14,0xf4,0x09,
+0x00,0x15,0xfe,0xda,0x00,0x01,0x09,0x00,0x5f,0xf8,0x88,0x88,0x88,0xff,0x01,0x00,
+0x73,0x01,0xcf,0x00,0x04,0xd0,0x01,0x0c,0x01,0x00,0x45,0x03,0x56,0x77,0x65,0x4f,
+0x01,0x21,0x02,0x7c,0x29,0x00,0x22,0xc7,0x20,0x29,0x01,0x04,0xef,0x01,0x20,0xfc,
+0x50,0x29,0x00,0x16,0xdf,0x4b,0x03,0xc0,0x30,0x00,0x00,0x8f,0xff,0xff,0xff,0xc9,
+0x65,0x44,0x56,0x9c,0xec,0x00,0x61,0x00,0x1c,0xff,0xff,0xfd,0x61,0x35,0x00,0x94,
+0x16,0xdf,0xff,0xff,0xc1,0xdf,0xff,0xfe,0x50,0x6e,0x01,0x65,0xef,0xff,0xfd,0x9f,
+0xff,0x90,0x70,0x00,0xf3,0x05,0x09,0xff,0xf9,0x09,0xf6,0x00,0x00,0x00,0x48,0xcd,
+0xff,0xdc,0x84,0x00,0x00,0x00,0x6f,0x90,0x00,0x10,0x89,0x02,0x50,0xff,0xe6,0x00,
+0x00,0x01,0x24,0x00,0x19,0x3d,0xdb,0x02,0x10,0x05,0x58,0x02,0x21,0xcc,0xef,0x6a,
+0x02,0x02,0xd9,0x01,0x72,0xc5,0x10,0x00,0x01,0x5c,0xff,0xff,0x39,0x03,0x21,0xaf,
+0xe4,0x07,0x00,0x22,0x4e,0xfa,0x60,0x00,0x22,0x06,0x10,0xcf,0x02,0x16,0x60,0xe3,
+0x00,0x19,0x22,0xf1,0x00,0x3a,0x1d,0xff,0xc1,0xec,0x01,0x09,0x17,0x01,0x00,0x92,
+0x03,0x07,0x01,0x00,0x38,0xdf,0xff,0xfd,0x0f,0x00,0x38,0x5f,0xff,0xf5,0x0f,0x00,
+0x42,0x04,0xaa,0x40,0x00,0x6e,0x00,0x17,0x44,0x01,0x00,0x39,0x30,0x00,0x6f,0x78,
+0x04,0x29,0x00,0xef,0x8e,0x01,0x45,0x60,0xff,0xfb,0xbb,0x01,0x00,0x35,0xbd,0xff,
+0xa1,0x8d,0x03,0x01,0xdc,0x00,0x45,0xfe,0xff,0xf0,0x8f,0x2b,0x00,0x00,0xeb,0x02,
+0x07,0x0f,0x00,0x29,0x05,0xbf,0x0f,0x00,0x2f,0x00,0x0f,0x0f,0x00,0x09,0x3d,0x02,
+0x4f,0xff,0x4b,0x00,0x07,0x69,0x00,0x00,0xd2,0x03,0x06,0xb3,0x00,0x3a,0x4a,0xff,
+0xd7,0x33,0x02,0x29,0x70,0xbf,0x0f,0x00,0x37,0x30,0x18,0xbb,0x01,0x00,0x1f,0xa4,
+0xf0,0x00,0x3b,0x15,0xbf,0x61,0x04,0x01,0xa5,0x00,0x06,0x0f,0x00,0x29,0x05,0xbf,
+0x0f,0x00,0x2f,0x00,0x0f,0x0f,0x00,0x09,0x29,0x02,0x4f,0x0f,0x00,0x0f,0xf0,0x00,
+0x88,0x01,0x95,0x01,0x14,0xf0,0x96,0x00,0x07,0x0f,0x00,0x06,0xe0,0x01,0x02,0x33,
+0x00,0x1f,0x0f,0x0f,0x00,0x09,0x29,0x02,0x4f,0x0f,0x00,0x0f,0xe0,0x01,0x8b,0x16,
+0x40,0x96,0x00,0x07,0x0f,0x00,0x29,0x05,0xbf,0x0f,0x00,0x2f,0x00,0x0f,0x0f,0x00,
+0x09,0x29,0x02,0x4f,0x0f,0x00,0x0f,0xf0,0x00,0x88,0x0a,0x96,0x00,0x07,0x0f,0x00,
+0x01,0xf0,0x00,0x07,0x3f,0x04,0x1f,0x0f,0x0f,0x00,0x09,0x2d,0x02,0x4f,0xe1,0x00,
+0x0f,0xf0,0x00,0x37,0x04,0x01,0x00,0x1a,0x01,0x0c,0x06,0x37,0x2d,0xfe,0x30,0x0e,
+0x00,0x29,0x27,0x7d,0xfd,0x04,0x1a,0x4f,0x82,0x00,0x38,0x0e,0xf5,0x3a,0x3a,0x05,
+0x54,0x07,0xf6,0x00,0x09,0xda,0xbb,0x00,0x47,0x00,0x00,0x00,0xed,0x62,0x07,0x43,
+0xfe,0x50,0x00,0x6f,0x8f,0x05,0x11,0xa4,0x39,0x06,0x33,0x30,0x1e,0xe0,0xf3,0x00,
+0x83,0xfa,0x10,0x0e,0xff,0xff,0xfd,0xbe,0xfe,0x9a,0x00,0x3a,0xff,0xff,0x60,0x6d,
+0x01,0x30,0xfb,0x0a,0xff,0x73,0x05,0x22,0x1c,0xf3,0x9d,0x05,0x31,0xd4,0x00,0x1c,
+0x23,0x08,0x21,0x2f,0xa0,0x83,0x00,0x51,0x70,0x00,0x00,0x04,0x63,0xc5,0x05,0x1a,
+0x20,0xd4,0x06,0x38,0xfb,0x00,0x8f,0xaa,0x05,0x38,0x0a,0xf8,0x4b,0x01,0x08,0x22,
+0x00,0x0b,0x9d,0x08,0x06,0x30,0x00,0x18,0x5c,0x1f,0x00,0x00,0xb3,0x00,0x0a,0xe8,
+0x05,0x33,0x00,0x11,0x10,0xda,0x00,0x63,0x8c,0xef,0xfe,0xa6,0x00,0x00,0xcb,0x08,
+0x00,0x2e,0x01,0x12,0x0c,0x02,0x08,0x30,0x40,0x00,0x0a,0xa1,0x05,0x50,0xff,0xff,
+0xfe,0x10,0x02,0x28,0x01,0x10,0x05,0x15,0x07,0x10,0x9f,0x96,0x05,0xf0,0x2f,0x06,
+0xff,0xff,0xe0,0x0e,0xff,0xfc,0xff,0xf0,0x16,0x07,0xff,0xff,0x21,0xff,0xf8,0x09,
+0xff,0x01,0xf6,0x07,0xff,0xf5,0x4f,0xff,0xd1,0x09,0xf0,0x1f,0x70,0x6f,0xff,0x86,
+0xff,0xff,0xd1,0x07,0x01,0x70,0x5f,0xff,0xf9,0x7f,0xff,0xff,0xd1,0x00,0x00,0x3f,
+0xff,0xff,0xa7,0xff,0xff,0xff,0xc1,0x00,0x2e,0xff,0xff,0xfb,0x7f,0xbc,0x01,0x00,
+0x00,0x07,0x10,0xb7,0x64,0x00,0x00,0x4c,0x00,0xf0,0x0d,0xfa,0x6f,0xff,0xff,0x40,
 0x30,0x03,0x07,0xff,0xff,0xa4,0xff,0xff,0x40,0x4e,0x01,0xe2,0x08,0xff,0xf8,0x2f,
-0xff,0x70,0x4f,0xf0,0x1f,0x90,0x2f,0x3d,0x01,0x50,0x7f,0xff,0x01,0xb0,0x2e,0x8f,
-0xbf,0x12,0xff,0x8f,0x11,0x01,0xb7,0x01,0x00,0x09,0x00,0x11,0x90,0x5d,0x61,0x10,
-0x2e,0x56,0x09,0x00,0xa0,0x18,0x12,0x3e,0xa6,0x19,0x15,0xaf,0x4c,0x23,0x24,0x28,
-0xce,0x76,0xbb,0x40,0x1a,0xcc,0xcc,0xca,0x8d,0x48,0x30,0x44,0x44,0x49,0x92,0x09,
-0x3f,0x44,0x44,0x42,0x56,0x08,0x02,0x15,0x9b,0x50,0x02,0x1d,0x80,0x89,0x42,0x00,
-0xfe,0x00,0x06,0x3a,0x2c,0x09,0x15,0x00,0x60,0x66,0xff,0xd1,0xdf,0xf6,0x6f,0x15,
-0x00,0x61,0xf4,0x4f,0xfc,0x0c,0xff,0x44,0x15,0x00,0x6f,0x44,0xff,0xc0,0xcf,0xf4,
-0x4f,0x15,0x00,0x45,0x61,0xf6,0x6f,0xfd,0x1d,0xff,0x66,0x32,0x6d,0x04,0x1f,0x03,
-0x15,0x05,0x04,0x24,0x05,0x96,0x0a,0x07,0xc2,0x1c,0x2f,0x6e,0xe5,0x98,0x1b,0x03,
-0x17,0x7f,0x37,0x02,0x17,0x1f,0x36,0x5e,0x26,0x50,0x3f,0x9a,0x33,0x35,0x7f,0xb0,
-0x3f,0xb8,0x14,0x20,0x7f,0xff,0x0d,0x00,0x14,0x60,0x3c,0x00,0x13,0xb0,0xe3,0x7b,
-0x01,0x88,0x00,0x36,0xb0,0x3f,0x70,0xc6,0x67,0x27,0xb0,0x10,0xd2,0x67,0x17,0x50,
-0x0c,0x00,0x1f,0x70,0x0c,0x00,0x2e,0x17,0x5f,0x0c,0x00,0x17,0x08,0x0c,0x00,0x02,
-0xfb,0x01,0x17,0x70,0x9f,0x16,0x17,0x70,0x91,0x15,0x17,0x70,0x37,0x27,0x15,0x70,
-0x2b,0x09,0x3e,0xdb,0xa8,0x50,0x49,0x11,0x09,0xf4,0x1e,0x00,0x16,0x03,0x13,0x80,
-0xd8,0x4e,0x06,0xfd,0x0d,0x18,0x03,0x0e,0x11,0x02,0x1d,0x00,0x00,0xb7,0x52,0x12,
-0xfc,0xaf,0xa4,0x10,0xef,0x83,0x02,0x00,0xd4,0x2e,0x11,0x8f,0x04,0x2a,0x02,0x60,
-0x0c,0x21,0x6f,0xf6,0x9b,0x0e,0x01,0x3a,0x00,0x00,0x27,0x68,0x02,0xf2,0x1b,0x14,
-0x3f,0x0d,0x74,0x02,0x33,0x13,0x1a,0xdf,0xfc,0x10,0x0b,0x0f,0x00,0x0b,0x2d,0x00,
-0x29,0x03,0xff,0x4b,0x00,0x0b,0x69,0x00,0x02,0x87,0x00,0x10,0xf8,0x87,0x00,0x00,
-0x3e,0x01,0x0c,0xa5,0x00,0x0c,0xc3,0x00,0x0b,0xe1,0x00,0x0b,0xff,0x00,0x14,0x07,
-0x09,0x00,0x13,0x7f,0x21,0x00,0x14,0x07,0x39,0x00,0xa3,0x7f,0xf4,0x08,0xf0,0x0e,
-0x90,0x0f,0xff,0x07,0xff,0x09,0x00,0x14,0x7f,0x09,0x00,0x16,0xff,0x09,0x00,0x6f,
-0xfa,0x8c,0xf8,0x8f,0xc8,0x8f,0x2c,0x0c,0x63,0x14,0xef,0xc7,0x00,0x14,0x8f,0xde,
-0x00,0x26,0x08,0xef,0xd7,0x01,0x0c,0x07,0x1b,0x01,0xfa,0x05,0x18,0xf1,0x38,0x2b,
-0x12,0x10,0x21,0x2a,0x04,0x9f,0xb2,0x13,0x1c,0x5f,0x17,0x00,0x1a,0x3d,0x13,0x1d,
-0x06,0x0c,0x00,0xf3,0x3b,0x35,0x2d,0xff,0xf9,0x19,0x00,0x41,0x2e,0xff,0xff,0xa2,
-0x8d,0x9c,0x47,0x2b,0xff,0xf1,0x3e,0x8b,0x00,0x18,0x1d,0x34,0x0f,0x08,0x0f,0x01,
-0x00,0x5b,0x04,0x22,0xd9,0x99,0x01,0x00,0x15,0x60,0x8f,0x97,0x03,0x1b,0x10,0x17,
-0x90,0xae,0x0b,0x08,0x36,0x78,0x2f,0x4a,0x20,0xb8,0x02,0x02,0x1f,0xf5,0x1c,0x14,
-0x07,0x04,0x57,0x00,0x17,0xea,0x14,0x00,0x7b,0xf7,0xf5,0x00,0xfc,0xef,0x00,0xef,
-0x03,0x01,0x08,0x13,0x0c,0x3f,0x07,0x00,0x04,0x19,0x00,0x02,0x2f,0xcb,0x00,0x01,
-0x00,0x18,0x1f,0xd2,0x21,0x00,0x0d,0x03,0x94,0x00,0xb2,0xf1,0x00,0xfc,0x00,0x00,
-0xea,0xfd,0xf2,0xf9,0x00,0xe4,0x9f,0x00,0x7f,0xfe,0x00,0x00,0xfd,0xfe,0xf7,0xfa,
-0x9e,0x00,0x01,0x10,0xfb,0x2c,0x00,0x0c,0xa1,0x6f,0x06,0x1d,0x00,0x0b,0x0a,0x00,
-0x19,0xfe,0x1f,0x00,0x06,0x08,0x08,0x00,0xab,0xa6,0x00,0x72,0x0f,0x6c,0xf0,0x00,
-0xfc,0x00,0xfc,0xf8,0x6b,0x54,0x1d,0xfa,0x0f,0x01,0x04,0x09,0x00,0x21,0xfc,0xfd,
-0x37,0x00,0x29,0xfd,0xfb,0x33,0x00,0x75,0xcd,0x00,0x00,0x00,0xdc,0x00,0xd9,0x27,
-0x00,0xae,0xfa,0xfc,0x00,0x00,0xfc,0xfb,0x00,0x00,0xfc,0xfc,0xa8,0x0e,0x03,0x9c,
-0x00,0x2f,0x03,0xfb,0x19,0x01,0x0a,0x1f,0xfc,0x5e,0x01,0x10,0x1b,0xe1,0xaa,0x00,
-0x12,0xfb,0x5a,0x00,0x25,0xfc,0xf9,0x3e,0x10,0x14,0xca,0xbf,0x00,0x97,0xf4,0x00,
-0x00,0xda,0xfc,0xd9,0xef,0x00,0xcc,0x0c,0x01,0x19,0xe9,0x45,0x01,0x10,0xb4,0x32,
-0x05,0x31,0x00,0xde,0x00,0x02,0x87,0x51,0x00,0xf9,0x00,0xfe,0xfe,0x3d,0x01,0x12,
-0x03,0x07,0x03,0x2d,0xc8,0x00,0x22,0x01,0x4f,0xfb,0xfc,0x00,0xf9,0xa3,0x00,0x0e,
-0x10,0xf7,0xc9,0x00,0x1f,0xf7,0xb1,0x02,0x06,0xb1,0xd0,0xcd,0x00,0x00,0xea,0xfb,
-0xd8,0xfd,0x03,0x00,0x03,0x69,0x00,0xf2,0x02,0xe1,0xef,0x00,0xef,0xd9,0xf4,0xf2,
-0x00,0xf4,0xf1,0xf7,0xf2,0xf5,0x00,0xdd,0xf0,0xee,0x7c,0x01,0x66,0xd8,0xe3,0x00,
-0x00,0xf2,0xfe,0x43,0x01,0xa7,0xf7,0xf8,0x00,0x00,0xf7,0xfa,0x00,0x00,0xfb,0xfe,
-0x9b,0x01,0x61,0x03,0x00,0xe5,0xf5,0x00,0x00,0x15,0x4c,0x03,0xdd,0x03,0x23,0xfa,
-0xfa,0x8a,0x01,0x04,0x78,0x01,0x03,0x01,0x00,0x14,0xe3,0x1f,0x02,0x15,0x03,0x38,
-0x01,0x10,0xfc,0x38,0x01,0x17,0xfa,0xdf,0x00,0xf6,0x15,0x04,0xf7,0xd5,0xe4,0x00,
-0x00,0xe4,0xfb,0xee,0xfd,0x03,0xee,0x03,0x03,0x02,0x03,0x00,0x03,0xf4,0xf4,0xfc,
-0xf9,0xf4,0xf9,0xf5,0xfc,0xf9,0xfc,0x00,0xfc,0xfa,0x04,0xee,0xf4,0xf4,0xf8,0x47,
-0x04,0x1a,0xfb,0xba,0x01,0x01,0x4e,0x00,0x1e,0xfb,0xe1,0x01,0x00,0x80,0x02,0x09,
-0x88,0x0f,0x0e,0x9d,0x02,0x0f,0x1d,0x00,0x0f,0x0f,0x38,0x02,0x0a,0x4f,0xfe,0x00,
-0xfd,0xfd,0xf9,0x02,0x01,0x0f,0x75,0x00,0x23,0x07,0x73,0x01,0x0e,0x0e,0x04,0x19,
-0x03,0xa4,0x02,0x13,0x04,0xc8,0x03,0x0f,0x01,0x00,0x27,0x0e,0xf2,0x02,0x1f,0xf0,
-0xb9,0x00,0x0b,0x26,0xfc,0xfd,0x52,0x03,0x1c,0xe0,0x9f,0x02,0x20,0xfc,0x04,0x9e,
-0x02,0x10,0x09,0x58,0x02,0x0f,0x01,0x00,0x0c,0x1e,0xfa,0xa0,0x03,0x1c,0xe1,0x6c,
-0x00,0x2f,0xfe,0x02,0x29,0x01,0x01,0x1f,0xe9,0xea,0x00,0x27,0x0e,0x3a,0x03,0x0f,
-0x2d,0x02,0x1b,0x1f,0xfc,0x22,0x04,0x09,0x03,0xba,0xcd,0x21,0x02,0x03,0x98,0x01,
-0x2d,0x04,0x05,0x21,0x00,0xf0,0x00,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,
-0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x81,0xd3,0x82,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,
-0x19,0x3a,0x0b,0x70,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0xac,0x22,0xff,0x00,0x1f,
-0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x73,0x00,
-0x04,0x11,0x06,0x01,0x00,0xd0,0x00,0x08,0x0a,0x0a,0x0a,0x0a,0x0c,0x0c,0x0c,0x0c,
-0x09,0x0c,0x09,0x01,0x00,0x40,0x00,0x00,0x0d,0x0d,0x07,0xd7,0x21,0x00,0x1a,0x01,
-0x00,0x62,0x00,0x1c,0x1d,0x1d,0x1d,0x1d,0x77,0x0a,0x10,0x21,0x01,0x00,0x02,0x3d,
-0x00,0x50,0x24,0x1b,0x24,0x06,0x1a,0x02,0x00,0x22,0x08,0x1c,0x02,0x00,0x64,0x09,
-0x00,0x09,0x00,0x0a,0x1d,0x02,0x00,0x05,0x07,0x3c,0x44,0x1f,0x00,0x00,0x0c,0x02,
-0x00,0x00,0xcd,0x19,0x53,0x00,0x0e,0x00,0x00,0x0f,0x02,0x00,0x00,0x1f,0x00,0x00,
-0x02,0x00,0x50,0x1f,0x00,0x00,0x09,0x21,0x02,0x00,0x01,0x30,0x13,0x16,0x22,0x34,
-0x13,0x11,0x13,0x02,0x00,0x17,0x0d,0x02,0x00,0x70,0x15,0x00,0x17,0x24,0x17,0x18,
-0x27,0x02,0x00,0x0f,0xb7,0x02,0x28,0x07,0x72,0x01,0x20,0x03,0x02,0x6d,0x01,0x4a,
-0x06,0x07,0x06,0x08,0x1f,0x00,0x00,0xce,0x00,0x20,0x00,0x0b,0x9f,0x0a,0x00,0xc1,
-0x00,0x01,0x08,0x00,0xd0,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,
-0x00,0x15,0x6e,0x14,0x62,0x00,0x17,0x17,0x17,0x18,0x17,0x3b,0x2f,0xd1,0x19,0x1a,
-0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x70,0xab,0x1e,0x00,0x01,
-0x00,0x11,0x0a,0x01,0x00,0x27,0x24,0x0b,0x0e,0x0e,0x00,0x01,0x00,0xa1,0x00,0x0b,
-0x0f,0x0f,0x0f,0x0f,0x13,0x00,0x00,0x16,0x01,0x00,0x20,0x25,0x17,0x01,0x00,0x02,
-0x57,0x00,0x02,0x83,0x01,0xa0,0x26,0x1e,0x1e,0x1e,0x1e,0x1f,0x00,0x1f,0x0a,0x16,
-0x02,0x00,0x22,0x0b,0x17,0x02,0x00,0x20,0x00,0x17,0x11,0x70,0x04,0x02,0x00,0x05,
-0x16,0x00,0x1b,0x00,0x2d,0x80,0x0c,0xe5,0x2f,0x00,0x02,0x00,0x51,0x19,0x00,0x00,
-0x0b,0x1a,0x02,0x00,0x13,0x17,0x22,0x21,0x12,0x1c,0x02,0x00,0x30,0x0e,0x00,0x0e,
-0x7a,0x0b,0x16,0x1e,0x02,0x00,0x70,0x11,0x00,0x13,0x1f,0x13,0x14,0x22,0x02,0x00,
-0x1f,0x00,0x74,0x01,0x26,0x50,0x00,0x00,0x00,0x00,0x00,
+0xff,0x70,0x4f,0xf0,0x1f,0x90,0x2f,0x3d,0x01,0x80,0x7f,0xff,0x01,0xb0,0x2e,0xff,
+0xf3,0x0a,0xad,0x01,0x00,0x43,0x00,0x01,0xb7,0x01,0x00,0x09,0x00,0x20,0x90,0x00,
+0x7e,0x02,0x10,0x2e,0x56,0x09,0x80,0x01,0xdf,0xff,0xff,0x3e,0xff,0xff,0xf7,0x3d,
+0x07,0x22,0xff,0xff,0x09,0x00,0x61,0x00,0x28,0xce,0xff,0xec,0x82,0xe5,0x00,0xb0,
+0x1a,0xcc,0xcc,0xca,0x10,0x00,0x00,0x02,0x44,0x44,0x49,0x92,0x09,0x3f,0x44,0x44,
+0x42,0x56,0x08,0x02,0x15,0x9b,0x50,0x02,0x1a,0x80,0x98,0x02,0x02,0xff,0x08,0x25,
+0x00,0x8f,0xed,0x09,0x09,0x15,0x00,0x60,0x66,0xff,0xd1,0xdf,0xf6,0x6f,0x15,0x00,
+0x61,0xf4,0x4f,0xfc,0x0c,0xff,0x44,0x15,0x00,0x6f,0x44,0xff,0xc0,0xcf,0xf4,0x4f,
+0x15,0x00,0x45,0xa5,0xf6,0x6f,0xfd,0x1d,0xff,0x66,0xff,0xf8,0x00,0x7f,0x1f,0x03,
+0x14,0x05,0x0a,0x00,0x15,0xf5,0x96,0x0a,0x16,0xf9,0xc6,0x00,0x26,0x6e,0xe5,0x0c,
+0x00,0x17,0x7f,0x2a,0x02,0x17,0x7f,0x37,0x02,0x00,0x1a,0x0c,0x04,0x25,0x02,0x22,
+0x50,0x3f,0xe1,0x0a,0x01,0x24,0x00,0x21,0xb0,0x3f,0x07,0x0b,0x02,0x30,0x00,0x00,
+0x0d,0x00,0x13,0x60,0x3c,0x00,0x00,0x0d,0x00,0x13,0x70,0x0c,0x00,0x00,0x0d,0x00,
+0x06,0x0c,0x00,0x36,0xff,0xb0,0x10,0x0c,0x00,0x27,0xff,0x50,0x0c,0x00,0x1f,0x70,
+0x0c,0x00,0x2e,0x17,0x5f,0x0c,0x00,0x17,0x08,0x0c,0x00,0x27,0x00,0xaf,0x0c,0x00,
+0x17,0x0b,0x0c,0x00,0x27,0x00,0xdf,0x0c,0x00,0x17,0x0f,0x0c,0x00,0x5e,0x00,0xbf,
+0xdb,0xa8,0x50,0x6d,0x0c,0x03,0x1a,0x03,0x15,0xbf,0x03,0x0c,0x00,0x0f,0x02,0x36,
+0x3e,0xff,0xff,0xf5,0x01,0x07,0x20,0x0c,0x01,0x1b,0x01,0x01,0x1d,0x00,0x41,0xcf,
+0xff,0xff,0xfc,0xb7,0x08,0x01,0x1d,0x00,0x60,0xf7,0x06,0xff,0xff,0x60,0x8f,0x0f,
+0x00,0x12,0x3e,0x60,0x0c,0x20,0x6f,0xf6,0x5b,0x03,0x32,0xff,0x03,0xef,0x49,0x0c,
+0x21,0x06,0x60,0x95,0x05,0x13,0x3f,0x83,0x05,0x36,0x00,0x00,0x06,0x15,0x0d,0x00,
+0x94,0x01,0x1e,0x6f,0x0f,0x00,0x0c,0x2d,0x00,0x29,0x03,0xff,0x4b,0x00,0x0b,0x69,
+0x00,0x02,0x87,0x00,0x10,0xf8,0x87,0x00,0x00,0x3e,0x01,0x0c,0xa5,0x00,0x0c,0xc3,
+0x00,0x0b,0xe1,0x00,0x0b,0xff,0x00,0x14,0x07,0x09,0x00,0x13,0x7f,0x21,0x00,0x14,
+0x07,0x39,0x00,0xa3,0x7f,0xf4,0x08,0xf0,0x0e,0x90,0x0f,0xff,0x07,0xff,0x09,0x00,
+0x14,0x7f,0x09,0x00,0x16,0xff,0x09,0x00,0x6f,0xfa,0x8c,0xf8,0x8f,0xc8,0x8f,0x2c,
+0x0c,0x63,0x14,0xef,0xc7,0x00,0x14,0x8f,0xde,0x00,0x90,0x08,0xef,0xff,0xff,0xff,
+0xff,0xff,0xfe,0x80,0x16,0x00,0x01,0x00,0x17,0x02,0x0c,0x00,0x27,0x07,0xf1,0x0c,
+0x00,0x52,0xff,0x10,0x00,0x00,0x03,0x0c,0x00,0x72,0x06,0xff,0xf1,0x00,0x00,0x1c,
+0xf7,0x0d,0x00,0x71,0xaf,0xff,0x10,0x00,0x1d,0xff,0x90,0x0c,0x00,0x75,0x0a,0xff,
+0xf1,0x00,0x2d,0xff,0xf9,0x19,0x00,0x50,0x2e,0xff,0xff,0xa2,0x22,0x01,0x00,0x56,
+0x2b,0xff,0xf1,0x3e,0xff,0x01,0x00,0x17,0x1d,0x0c,0x00,0x27,0xf1,0x8f,0x0d,0x00,
+0x62,0x00,0x8f,0xff,0xff,0xd9,0x99,0x01,0x00,0x56,0x60,0x00,0x7f,0xff,0xf9,0x81,
+0x00,0x36,0x6f,0xff,0x90,0x0d,0x00,0x27,0x5f,0xf8,0xa7,0x00,0xa0,0x4a,0x20,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -1518,11 +1898,28 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 8226, .range_length = 55425, .glyph_id_start = 308, .list_length = 62, .type = 3, .unicode_list = 2960, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[57679] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 3496, .size = 4064, .comp_size = 2905 },
+{ .bitmap_start = 4064, .comp_offset = 6401, .size = 4054, .comp_size = 2626 },
+{ .bitmap_start = 8118, .comp_offset = 9027, .size = 3982, .comp_size = 2804 },
+{ .bitmap_start = 12100, .comp_offset = 11831, .size = 4087, .comp_size = 1759 },
+{ .bitmap_start = 16187, .comp_offset = 13590, .size = 4045, .comp_size = 2037 },
+{ .bitmap_start = 20232, .comp_offset = 15627, .size = 4008, .comp_size = 1957 },
+{ .bitmap_start = 24240, .comp_offset = 17584, .size = 4013, .comp_size = 1879 },
+{ .bitmap_start = 28253, .comp_offset = 19463, .size = 4054, .comp_size = 1897 },
+{ .bitmap_start = 32307, .comp_offset = 21360, .size = 3990, .comp_size = 1658 },
+{ .bitmap_start = 36297, .comp_offset = 23018, .size = 3808, .comp_size = 1833 },
+{ .bitmap_start = 40105, .comp_offset = 24851, .size = 3854, .comp_size = 1907 },
+{ .bitmap_start = 43959, .comp_offset = 26758, .size = 3877, .comp_size = 1820 },
+{ .bitmap_start = 47836, .comp_offset = 28578, .size = 3931, .comp_size = 1458 },
+{ .bitmap_start = 51767, .comp_offset = 30036, .size = 200, .comp_size = 115 },
+};
+
+static uint8_t etxUncompBuf[5712] __SDRAMFONTS;
 
 const etxLz4Font lv_font_en_bold_STD = {
-.uncomp_size = 57351,
-.comp_size = 24075,
+.uncomp_size = 5384,
+.comp_size = 3496,
 .line_height = 29,
 .base_line = 6,
 .subpx = 0,
@@ -1535,12 +1932,13 @@ const etxLz4Font lv_font_en_bold_STD = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 39,
-.glyph_bitmap = 3084,
-.class_pair_values = 55051,
-.left_class_mapping = 56611,
-.right_class_mapping = 56981,
+.class_pair_values = 3084,
+.left_class_mapping = 4644,
+.right_class_mapping = 5014,
+.block_num = 14,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 57679,
+.lvglFontBufSize = 5712,
 };
@@ -130,1736 +130,2689 @@ static const uint8_t lz4FontData[] ={
 0xb1,0xc8,0x04,0x31,0xed,0xe6,0x21,0xd0,0x03,0xb1,0x39,0xe9,0xb1,0x1d,0x1e,0x2b,
 0x00,0x00,0xbe,0xeb,0x11,0xc8,0x00,0x31,0x10,0xee,0x71,0xc8,0x00,0x22,0x9c,0xef,
 0x10,0x00,0x22,0xee,0xf1,0x10,0x00,0x22,0x7a,0xf3,0x10,0x00,0x22,0xcc,0xf5,0x10,
-0x00,0xf0,0x27,0x58,0xf7,0x71,0x0c,0x0e,0x25,0x02,0x00,0x0e,0xff,0xff,0xff,0x40,
-0xdf,0xff,0xff,0xf3,0x0d,0xff,0xff,0xff,0x30,0xcf,0xff,0xff,0xf2,0x0c,0xff,0xff,
-0xff,0x20,0xbf,0xff,0xff,0xf1,0x0b,0xff,0xff,0xff,0x10,0xaf,0xff,0xff,0xf0,0x0a,
-0xff,0xff,0xff,0x00,0x9f,0xff,0xff,0xf0,0x09,0x09,0x00,0xf6,0x2c,0x8f,0xff,0xff,
-0xe0,0x08,0xff,0xff,0xfe,0x00,0x7f,0xff,0xff,0xd0,0x07,0xff,0xff,0xfc,0x00,0x6f,
-0xff,0xff,0xc0,0x05,0xff,0xff,0xfb,0x00,0x5f,0xff,0xff,0xb0,0x04,0xff,0xff,0xfa,
-0x00,0x4f,0xff,0xff,0xa0,0x03,0xff,0xff,0xf9,0x00,0x3f,0xff,0xff,0x90,0x02,0xff,
-0xff,0xf8,0x00,0x1d,0xdd,0xdd,0x60,0x00,0x01,0x00,0x71,0x21,0x00,0x00,0x08,0xff,
-0xfc,0x20,0x48,0x00,0xe0,0xff,0xff,0xff,0xf5,0x1f,0xff,0xff,0xff,0x70,0xef,0xff,
-0xff,0xf5,0x06,0x51,0x00,0xfb,0x02,0x06,0xdf,0xe9,0x10,0x8f,0xff,0xf3,0x00,0xdf,
-0xff,0xd8,0xff,0xff,0x30,0x0d,0xff,0xfd,0x0d,0x00,0xf2,0x29,0xf1,0x00,0xdf,0xff,
-0xb8,0xff,0xff,0x00,0x0d,0xff,0xfa,0x8f,0xff,0xe0,0x00,0xdf,0xff,0x88,0xff,0xfd,
-0x00,0x0d,0xff,0xf7,0x8f,0xff,0xb0,0x00,0xdf,0xff,0x58,0xff,0xfa,0x00,0x0d,0xff,
-0xf4,0x8f,0xff,0x80,0x00,0xdf,0xff,0x28,0xff,0xf6,0x00,0x0d,0xff,0xf1,0x7f,0xff,
-0x50,0x00,0xdf,0xfe,0x7c,0x00,0x72,0xff,0xff,0x50,0x00,0x2f,0xff,0xf2,0x0d,0x00,
-0x72,0x1f,0xff,0xf2,0x00,0x04,0xff,0xff,0x0d,0x00,0x01,0x09,0x00,0x32,0x7f,0xff,
-0xc0,0x0e,0x00,0x00,0x09,0x00,0x32,0x0a,0xff,0xfa,0x0d,0x00,0x82,0x0a,0xff,0xf9,
-0x00,0x00,0xdf,0xff,0x70,0x0e,0x00,0x00,0x09,0x00,0x32,0x0f,0xff,0xf4,0x0d,0x00,
-0x00,0x09,0x00,0x41,0x02,0xff,0xff,0x10,0x0d,0x00,0x01,0x09,0x00,0x32,0x5f,0xff,
-0xf0,0x1b,0x00,0x30,0x5f,0xff,0xe0,0xe8,0x00,0xf6,0x04,0x00,0x00,0x00,0x01,0x11,
-0x11,0x18,0xff,0xfc,0x11,0x11,0xbf,0xff,0xa1,0x11,0x10,0x00,0xbf,0xff,0x01,0x00,
-0x27,0xa0,0x0b,0x0d,0x00,0x1f,0xfa,0x1b,0x00,0x09,0xa2,0x00,0x00,0x06,0xff,0xfd,
-0x00,0x00,0x9f,0xff,0xb0,0x5e,0x00,0x72,0x9f,0xff,0xa0,0x00,0x0c,0xff,0xf8,0x0d,
-0x00,0x30,0x0c,0xff,0xf7,0xdb,0x00,0x14,0x40,0xe4,0x00,0x52,0x40,0x00,0x2f,0xff,
-0xf1,0x0d,0x00,0x00,0x09,0x00,0x23,0x05,0xff,0xfe,0x00,0x01,0x09,0x00,0x11,0x8f,
-0x43,0x00,0x17,0x8f,0x5e,0x00,0x27,0xe0,0x08,0x0d,0x00,0x1f,0xfe,0x1b,0x00,0x09,
-0xc0,0x01,0x11,0x14,0xff,0xff,0x11,0x11,0x7f,0xff,0xd1,0x11,0x11,0x51,0x00,0x54,
-0x6f,0xff,0xd0,0x00,0x09,0x27,0x01,0x82,0x09,0xff,0xfb,0x00,0x00,0xcf,0xff,0x80,
-0x0e,0x00,0x00,0x09,0x00,0x32,0x0f,0xff,0xf5,0x0d,0x00,0x81,0x0e,0xff,0xf5,0x00,
-0x01,0xff,0xff,0x20,0x0d,0x00,0x01,0x09,0x00,0x14,0x4f,0x27,0x01,0x00,0x09,0x00,
-0x32,0x07,0xff,0xfd,0x0d,0x00,0x01,0x09,0x00,0x38,0xaf,0xff,0xa0,0xe4,0x00,0x14,
-0xf7,0xe4,0x00,0x12,0xf8,0xbf,0x01,0x24,0x00,0x00,0x39,0x00,0x1f,0x70,0x0c,0x00,
-0x24,0x62,0x03,0x8b,0xef,0xff,0xea,0x60,0x0b,0x00,0x11,0xcf,0xd9,0x00,0x12,0x70,
-0xcd,0x00,0x01,0x01,0x00,0x11,0xfc,0x6c,0x01,0x03,0x01,0x00,0x10,0xc0,0x42,0x01,
-0x03,0x01,0x00,0x10,0xf8,0x9b,0x00,0x50,0xff,0xff,0xc8,0x7a,0xff,0x1d,0x03,0xd0,
-0x01,0xff,0xff,0xff,0xf6,0x00,0x00,0x2e,0xff,0xff,0xff,0x80,0x05,0xb0,0x01,0x01,
-0x43,0x02,0x01,0x16,0x03,0x21,0xff,0x50,0x27,0x02,0x30,0xff,0xf0,0x08,0x58,0x03,
-0x01,0xc9,0x00,0x30,0xff,0xf2,0x07,0x6d,0x03,0x02,0x79,0x01,0x10,0xf4,0x5f,0x00,
-0x12,0x90,0x19,0x02,0x44,0x10,0x02,0xff,0xff,0x4d,0x02,0x01,0x35,0x00,0x24,0xff,
-0x81,0xb0,0x00,0x00,0x99,0x00,0x14,0x81,0x82,0x02,0x00,0x01,0x00,0x12,0xa3,0x0d,
-0x00,0x02,0x26,0x02,0x11,0xc3,0x0c,0x00,0x03,0x9f,0x01,0x11,0x91,0x0d,0x00,0x11,
-0x3c,0x0c,0x00,0x12,0xfd,0x66,0x01,0x11,0x3b,0x0d,0x00,0x12,0xe1,0x33,0x00,0x23,
-0x28,0xef,0xd9,0x00,0x10,0x00,0xdd,0x00,0x26,0xef,0xff,0x48,0x01,0x12,0x1c,0xe5,
-0x00,0x04,0x99,0x01,0x81,0xff,0xf1,0xbe,0xee,0xee,0xd0,0x00,0x00,0xeb,0x00,0x32,
-0xf3,0xbf,0xff,0xa6,0x01,0x00,0xb4,0x00,0x12,0xaf,0xa7,0x00,0x00,0x0c,0x00,0x32,
-0xf3,0x6f,0xff,0xf4,0x01,0x00,0x33,0x04,0x12,0x2f,0x4d,0x00,0x10,0x06,0x2d,0x02,
-0x10,0x0b,0xab,0x02,0x30,0x41,0x13,0x9f,0xdf,0x00,0x16,0x03,0x38,0x02,0x34,0x20,
-0x00,0x7f,0x0b,0x00,0x15,0xf7,0xb3,0x00,0x02,0x02,0x01,0x12,0x5e,0x0b,0x00,0x11,
-0xe6,0x80,0x00,0x10,0x6b,0x0b,0x00,0x14,0xc7,0xa5,0x01,0x11,0xdf,0x3b,0x01,0x04,
-0x4d,0x02,0x1f,0x00,0x0c,0x00,0x16,0x57,0x01,0x7c,0xef,0xec,0x82,0x6f,0x04,0x01,
-0x63,0x00,0x15,0x80,0x0f,0x00,0x11,0x05,0x71,0x00,0x15,0xf9,0x10,0x00,0x12,0x1e,
-0x82,0x00,0x00,0x9b,0x01,0x12,0x20,0x06,0x02,0x40,0xfc,0x20,0x19,0xff,0x24,0x03,
-0x31,0x03,0xfc,0x50,0x08,0x01,0x10,0xf1,0x5c,0x00,0x61,0xe0,0x00,0x00,0x0d,0xff,
-0xf6,0x7e,0x01,0x10,0xc0,0x05,0x01,0x10,0xf0,0x05,0x00,0x11,0xd0,0x77,0x00,0x10,
-0xb0,0x2f,0x04,0x32,0xf0,0x00,0x03,0xec,0x01,0x05,0x20,0x00,0x03,0x9e,0x03,0x05,
-0x40,0x00,0x33,0x7f,0xff,0xd0,0x60,0x00,0x63,0x30,0x2a,0xff,0xff,0xb0,0x02,0xb0,
-0x03,0x13,0x0e,0x80,0x00,0x13,0x0c,0x94,0x00,0x13,0x04,0x6c,0x02,0x32,0x6f,0xff,
-0xe0,0xa1,0x00,0x20,0x4e,0xff,0x20,0x05,0x15,0x02,0xdf,0x03,0x74,0x00,0x6a,0xde,
-0xdb,0x71,0x00,0x0b,0x76,0x03,0x03,0x01,0x00,0x14,0x6f,0xeb,0x01,0x05,0xcb,0x01,
-0x18,0x50,0x10,0x00,0x39,0x0b,0xff,0xfb,0x2f,0x00,0x84,0x5f,0xff,0xf1,0x00,0x4a,
-0xdf,0xfd,0xa4,0x2f,0x00,0x40,0xef,0xff,0x60,0x1b,0x68,0x00,0x14,0xb1,0x70,0x02,
-0x34,0xfc,0x00,0xcf,0x0d,0x03,0x01,0x8c,0x02,0x13,0xf2,0xb7,0x01,0x02,0x44,0x03,
-0xb2,0xef,0xff,0x70,0x0f,0xff,0xff,0x50,0x06,0xff,0xff,0xe0,0xfa,0x03,0x30,0xfc,
-0x00,0x4f,0xdc,0x01,0x00,0xac,0x05,0x01,0x2f,0x00,0x30,0xf3,0x00,0x6f,0x66,0x05,
-0x32,0x3f,0xff,0xf5,0xd7,0x02,0x11,0x80,0x23,0x01,0x21,0x00,0x2f,0x10,0x00,0x10,
-0x09,0xe6,0x03,0x07,0x10,0x00,0x10,0x3f,0x36,0x00,0x07,0x30,0x00,0x10,0xdf,0x1b,
-0x02,0x01,0x50,0x00,0x10,0x7f,0x1a,0x00,0x31,0x01,0x9f,0xfe,0x6a,0x05,0x41,0xff,
-0x60,0x04,0xef,0x70,0x00,0x21,0x02,0xb4,0x45,0x00,0x1a,0xff,0xd9,0x01,0x17,0xdf,
-0xb0,0x00,0x00,0x01,0x00,0x08,0xd0,0x00,0x01,0x01,0x00,0x06,0xf0,0x00,0x46,0x28,
-0xce,0xff,0xda,0x92,0x06,0x11,0x09,0x03,0x04,0x14,0x40,0x0b,0x01,0x14,0xdf,0xa9,
-0x02,0x03,0x77,0x04,0x02,0x01,0x00,0x14,0x50,0x67,0x01,0x03,0x18,0x05,0x05,0x74,
-0x00,0x34,0xfc,0x99,0xef,0xc1,0x03,0x11,0x02,0x90,0x00,0x11,0x0c,0x2a,0x04,0x01,
-0xca,0x01,0x00,0x6f,0x05,0x14,0x03,0x6d,0x02,0x20,0x06,0xff,0x84,0x01,0x17,0x01,
-0x1e,0x00,0x11,0xfc,0x06,0x00,0x15,0xf5,0x3c,0x00,0x33,0x20,0x00,0x1d,0x71,0x03,
-0x01,0x5a,0x00,0x34,0xb0,0x03,0xdf,0x70,0x01,0x00,0x78,0x00,0x21,0xf7,0x9f,0x41,
-0x00,0x08,0x96,0x00,0x14,0xb0,0x2c,0x03,0x04,0xa0,0x04,0x14,0x00,0xbe,0x06,0x07,
-0xd1,0x00,0x20,0x00,0x02,0xca,0x01,0x03,0xf3,0x06,0x03,0x58,0x04,0x01,0x70,0x05,
-0x35,0xbd,0xdd,0xdb,0xea,0x04,0x10,0xb0,0x5c,0x05,0x15,0xfd,0xe0,0x00,0x10,0xfa,
-0xa8,0x00,0x11,0xfc,0x95,0x00,0x20,0xe2,0x4f,0xd6,0x00,0x01,0xda,0x07,0x10,0x0a,
-0xa8,0x02,0x10,0x05,0x1d,0x01,0x10,0x09,0x21,0x01,0x11,0x0f,0xc2,0x00,0x00,0x6c,
-0x00,0x61,0x6f,0xff,0xff,0xf3,0x00,0x3f,0x82,0x00,0x14,0x08,0x20,0x01,0x12,0x4f,
-0x91,0x00,0x13,0xaf,0xa6,0x01,0x12,0x3f,0x33,0x04,0x13,0x0b,0x11,0x04,0x22,0x2f,
-0xff,0x0e,0x06,0x12,0xdf,0xb8,0x00,0x00,0x81,0x08,0x61,0xd2,0x00,0x00,0x02,0xbf,
-0xff,0x01,0x01,0x10,0x07,0x25,0x00,0x34,0xb8,0x79,0xcf,0xd6,0x00,0x17,0xef,0x85,
-0x06,0x10,0x50,0x26,0x02,0x05,0x01,0x00,0x00,0xd8,0x00,0x14,0x03,0x1f,0x00,0x55,
-0xef,0xff,0xff,0xfd,0x10,0x1a,0x02,0x23,0xc4,0x1d,0x22,0x01,0x61,0x16,0xad,0xef,
-0xfe,0xc9,0x61,0xcd,0x00,0x47,0xf8,0x8f,0xff,0xf7,0x03,0x00,0x20,0xf6,0x8f,0x2b,
-0x08,0xa1,0xf3,0x8f,0xff,0xf2,0x8f,0xff,0xf1,0x8f,0xff,0xf0,0x03,0x00,0x25,0xd0,
-0x8f,0x11,0x05,0x02,0x63,0x05,0x11,0xc0,0x45,0x01,0x11,0xdf,0xda,0x02,0x32,0x3e,
-0xff,0xf8,0x70,0x01,0x12,0xfc,0x3b,0x04,0x11,0xc1,0xf2,0x03,0x12,0xfd,0xdf,0x01,
-0x12,0xf2,0x14,0x00,0x11,0x70,0x26,0x05,0x12,0xfd,0x86,0x03,0x21,0xf6,0x00,0xcf,
-0x00,0x12,0xe0,0xea,0x03,0x12,0x90,0x80,0x01,0x11,0x40,0x14,0x06,0x12,0xfe,0xe8,
-0x01,0x12,0xfa,0x29,0x00,0x12,0xf7,0x9c,0x04,0x12,0xf4,0xd5,0x05,0x12,0xf1,0x2c,
-0x01,0x00,0x0d,0x02,0x15,0x0d,0x3e,0x00,0x12,0xc0,0x07,0x03,0x16,0xb0,0x07,0x00,
-0x11,0x1f,0x78,0x06,0x0b,0x07,0x00,0x06,0x23,0x00,0x12,0xc0,0x38,0x00,0x12,0xd0,
-0x32,0x02,0x12,0xe0,0x49,0x06,0x12,0xf0,0x92,0x00,0x26,0xf2,0x00,0x7e,0x02,0x03,
-0x3c,0x02,0x12,0xbf,0x3f,0x03,0x12,0x7f,0xd0,0x08,0x12,0x1f,0xf5,0x02,0x12,0x0c,
-0x4e,0x00,0x13,0x05,0x43,0x02,0x12,0xdf,0x2b,0x00,0x12,0x5f,0xbf,0x01,0x12,0x0c,
-0x72,0x00,0x12,0x02,0xe8,0x00,0x00,0x3a,0x00,0x12,0x30,0x65,0x00,0x17,0xf4,0x50,
-0x00,0x32,0x0b,0xff,0xf6,0x96,0x02,0x12,0xf1,0x8f,0x02,0x05,0x93,0x07,0x23,0x0d,
-0x70,0x92,0x05,0x13,0xc1,0xd8,0x06,0x22,0xe2,0x00,0xf0,0x00,0x00,0x08,0x00,0x00,
-0x0c,0x03,0x31,0xd1,0x00,0x00,0x62,0x07,0x13,0xa0,0xb8,0x02,0x12,0x50,0x51,0x05,
-0x13,0xfe,0xe2,0x04,0x13,0xf8,0xbe,0x03,0x12,0xf1,0xe9,0x08,0x02,0x0c,0x04,0x12,
-0xcf,0x1f,0x00,0x13,0x07,0x84,0x00,0x13,0x2f,0x3e,0x00,0x33,0xdf,0xff,0xfe,0x49,
-0x07,0x13,0xf3,0xaa,0x00,0x12,0x70,0x01,0x01,0x13,0xfa,0x26,0x00,0x12,0xd0,0x09,
-0x01,0x12,0xff,0xd6,0x09,0x02,0x54,0x00,0x12,0xef,0xe6,0x00,0x13,0x0d,0x35,0x00,
-0x12,0xdf,0xba,0x01,0x13,0x0d,0x5b,0x00,0x12,0xdf,0xee,0x00,0x13,0x0e,0x1e,0x00,
-0x03,0x2d,0x00,0x12,0x0f,0x62,0x01,0x22,0x01,0xff,0x71,0x00,0x12,0x3f,0x86,0x01,
-0x13,0x05,0x06,0x04,0x12,0x8f,0xc5,0x00,0x13,0x0b,0x61,0x00,0x12,0xff,0xf9,0x08,
-0x12,0x3f,0xbc,0x00,0x13,0x08,0x64,0x01,0x12,0xef,0x38,0x01,0x15,0x4f,0x2c,0x00,
-0x17,0xd0,0xac,0x01,0x33,0xdf,0xff,0xfc,0x49,0x00,0x12,0x20,0x88,0x01,0x12,0x60,
-0x1f,0x04,0x12,0x90,0x8b,0x00,0x14,0xa0,0x39,0x09,0x01,0xa7,0x02,0x12,0x60,0x56,
-0x09,0x15,0x10,0xcd,0x02,0x13,0x2f,0x8c,0x01,0x01,0xe0,0x01,0x03,0x9d,0x09,0x02,
-0xc6,0x0a,0x05,0x0b,0x00,0x14,0xf3,0x0b,0x00,0x12,0x0e,0x8e,0x00,0x50,0x01,0x81,
-0x00,0x00,0x0d,0x0b,0x00,0xf2,0x0a,0x04,0x10,0x06,0xff,0xb4,0x00,0x0c,0xff,0xf1,
-0x00,0x17,0xdf,0x60,0x0b,0xff,0xff,0xe7,0x1b,0xff,0xf0,0x3a,0xff,0xff,0xb0,0x0f,
-0x37,0x09,0x00,0xbb,0x03,0x15,0x2c,0x98,0x03,0x42,0xf4,0x00,0x16,0xae,0x35,0x0a,
-0x10,0xa6,0x7e,0x00,0x10,0x39,0xda,0x07,0x15,0x30,0xcc,0x08,0x16,0x60,0xa8,0x04,
-0x14,0xf3,0x0e,0x05,0x42,0x8c,0xff,0xfe,0x10,0x91,0x07,0x23,0xfd,0x03,0xdb,0x04,
-0x51,0xcf,0xff,0xf4,0x00,0x8f,0xe7,0x01,0x10,0x09,0xda,0x00,0x11,0x0e,0x11,0x01,
-0x10,0x07,0x28,0x00,0x12,0x05,0x44,0x00,0x20,0x2c,0xf5,0x38,0x02,0x11,0xd3,0x43,
-0x00,0x00,0x10,0x00,0x2e,0x19,0x00,0x01,0x00,0x17,0x2f,0x60,0x09,0x0f,0x0c,0x00,
-0x49,0x16,0xaf,0x95,0x04,0x1f,0xfb,0x0c,0x00,0x29,0xcf,0x12,0x22,0x22,0x22,0x4f,
-0xff,0xff,0xf6,0x22,0x22,0x22,0x21,0xc0,0x00,0x59,0x01,0x70,0x04,0x00,0x5d,0x0a,
-0x0d,0x09,0x00,0x30,0xfe,0x00,0x0d,0xc6,0x02,0x00,0xc3,0x02,0x00,0xbd,0x04,0x50,
-0x0a,0xff,0xff,0xd0,0x01,0x8e,0x02,0x50,0x9f,0xff,0xfb,0x00,0x0d,0x88,0x02,0x20,
-0x06,0xef,0xdb,0x01,0x50,0x30,0x00,0x00,0x37,0x77,0x01,0x00,0x22,0x76,0x6f,0x12,
-0x02,0x0f,0x07,0x00,0x09,0x30,0x00,0x01,0x33,0xd6,0x01,0x30,0xfe,0x40,0x08,0x0a,
-0x06,0x50,0xef,0xff,0xff,0xf8,0x0f,0x13,0x0a,0xd4,0xdf,0xff,0xff,0xf7,0x05,0xff,
-0xff,0xfe,0x10,0x04,0xcf,0xe9,0x10,0x87,0x02,0x24,0xff,0x20,0xe6,0x06,0x14,0xc0,
-0x19,0x0c,0x1f,0xf7,0x1c,0x00,0x12,0x14,0x10,0x5c,0x02,0x0f,0x1c,0x00,0x4a,0x1f,
-0xf6,0x1c,0x00,0x3e,0x1f,0xaf,0x1c,0x00,0x01,0x1b,0xb0,0x1c,0x00,0x1f,0x0f,0x1c,
-0x00,0x2d,0x36,0x01,0x88,0x88,0x05,0x09,0x62,0x04,0x9c,0xef,0xed,0xb7,0x20,0x90,
-0x05,0x11,0xef,0x03,0x08,0x17,0x10,0xd5,0x02,0x15,0xe3,0x84,0x0c,0x02,0xd2,0x0c,
-0x03,0x07,0x09,0x00,0x9a,0x04,0x11,0x01,0xac,0x07,0x11,0x9d,0xaa,0x07,0x12,0x07,
-0xc7,0x07,0x22,0x7f,0xff,0x33,0x02,0x22,0xff,0x20,0x8d,0x07,0x22,0x50,0x1f,0x67,
-0x05,0x10,0x02,0x27,0x0d,0x15,0x5f,0xc8,0x04,0x00,0x6a,0x07,0x02,0x63,0x04,0x00,
-0x69,0x10,0x13,0x9f,0x13,0x05,0x00,0x14,0x00,0x16,0xaf,0x78,0x0c,0x04,0x84,0x0c,
-0x00,0x55,0x00,0x2f,0xf4,0xcf,0x0c,0x00,0x34,0x08,0x54,0x00,0x08,0x6c,0x00,0x04,
-0x84,0x00,0x00,0xb0,0x0d,0x00,0x10,0x00,0x04,0x9c,0x00,0x13,0x5f,0xe0,0x06,0x00,
-0xb4,0x00,0x08,0xcc,0x00,0x08,0xe4,0x00,0x12,0x06,0xfc,0x00,0x11,0x6f,0x27,0x0f,
-0x00,0x42,0x01,0x22,0xa8,0x9d,0xbe,0x08,0x16,0x5f,0x2c,0x01,0x09,0x44,0x01,0x22,
-0x00,0x9f,0x0b,0x00,0x1c,0xf3,0x74,0x01,0x00,0x8c,0x01,0x35,0xfd,0xb7,0x20,0x9b,
-0x01,0x23,0x17,0xcc,0x1e,0x0d,0x10,0xfc,0x1c,0x00,0x11,0xaf,0x7c,0x08,0x11,0x39,
-0xd1,0x0d,0x22,0x02,0x8e,0x4d,0x03,0x2f,0x1f,0xff,0x08,0x00,0x06,0x20,0xc7,0x2f,
-0x08,0x00,0x21,0xfb,0x61,0xae,0x09,0x33,0x05,0x00,0x00,0xb6,0x09,0x0f,0x08,0x00,
-0xa6,0x62,0x01,0x6a,0xdf,0xfe,0xdb,0x83,0x19,0x01,0x12,0x19,0xf0,0x0e,0x15,0x50,
-0x26,0x0d,0x03,0x55,0x0e,0x15,0x5f,0x44,0x11,0x08,0x2c,0x0a,0x11,0x50,0x93,0x02,
-0x31,0xfd,0x98,0xae,0xff,0x0a,0x12,0x06,0xbf,0x0f,0x11,0x0a,0x43,0x0a,0x12,0xcf,
-0x7f,0x09,0x10,0x0d,0x9a,0x06,0x12,0x1f,0xb9,0x07,0x00,0xc9,0x01,0x23,0xf8,0x03,
-0x51,0x00,0x01,0x08,0x00,0x13,0x5f,0x15,0x0c,0x01,0xe8,0x0a,0x34,0x11,0x11,0x11,
-0x4d,0x0e,0x05,0x68,0x0d,0x13,0xbf,0x3e,0x02,0x03,0x25,0x00,0x27,0xfc,0x00,0xad,
-0x0b,0x17,0x40,0x6c,0x0c,0x14,0xb0,0x88,0x0f,0x07,0x97,0x0b,0x10,0x04,0x09,0x13,
-0x07,0x0c,0x00,0x17,0xf8,0xda,0x0b,0x17,0xfa,0x0c,0x00,0x14,0xfc,0x0c,0x00,0x16,
-0xef,0x0c,0x00,0x1b,0x02,0x0c,0x00,0x2e,0xfd,0x10,0x0c,0x00,0x2f,0x01,0xdf,0x0c,
-0x00,0x07,0x23,0xfe,0x20,0x0c,0x00,0x10,0xcf,0xb6,0x02,0x11,0x88,0x01,0x00,0x27,
-0x50,0x9f,0x92,0x06,0x17,0x0a,0x70,0x0b,0x2f,0xb0,0xaf,0x19,0x00,0x11,0x02,0xc5,
-0x02,0x32,0xfe,0xdb,0x73,0x5a,0x00,0x12,0x6e,0xa9,0x01,0x14,0x40,0x65,0x00,0x03,
-0x9c,0x01,0x01,0x27,0x03,0x04,0x7f,0x0c,0x15,0xcf,0x3e,0x00,0x11,0x70,0xc1,0x01,
-0x21,0xfc,0x98,0x40,0x08,0x01,0x3e,0x01,0x12,0xc2,0x2d,0x01,0x20,0xf5,0x00,0xa1,
-0x10,0x03,0xf6,0x10,0x53,0x80,0x0b,0xbb,0xbb,0xb8,0xc0,0x06,0x15,0xf9,0xeb,0x0c,
-0x03,0xb1,0x01,0x03,0xe4,0x0e,0x06,0xed,0x08,0x00,0x0c,0x0c,0x04,0x17,0x01,0x14,
-0x6e,0x81,0x08,0x18,0x0c,0xd3,0x0e,0x02,0x09,0x12,0x16,0x60,0x5f,0x0d,0x04,0x23,
-0x01,0x17,0xcf,0x25,0x00,0x03,0x32,0x00,0x02,0xa0,0x12,0x48,0x45,0x55,0x68,0xcf,
-0x70,0x00,0x13,0x4f,0xd8,0x03,0x04,0x7d,0x00,0x06,0xa1,0x0f,0x15,0xef,0xd7,0x0d,
-0x02,0x72,0x02,0x05,0x90,0x09,0x00,0x69,0x04,0x13,0x7f,0xfa,0x01,0x00,0x19,0x00,
-0x14,0x25,0xd2,0x0e,0x00,0x32,0x00,0x04,0x24,0x0d,0x10,0x6f,0xb0,0x02,0x00,0xa8,
-0x01,0x03,0x79,0x05,0x11,0x70,0xb4,0x0d,0x31,0xc9,0x89,0xdf,0xe0,0x11,0x04,0xa1,
-0x0e,0x01,0xed,0x00,0x17,0x1d,0xac,0x12,0x01,0xdb,0x11,0x05,0xcb,0x0e,0x12,0x06,
-0x6c,0x01,0x12,0xa2,0x78,0x00,0x68,0x48,0xce,0xff,0xed,0xa6,0x10,0x3c,0x11,0x06,
-0x0d,0x0a,0x27,0x07,0xff,0x0d,0x00,0x18,0x2f,0x0d,0x00,0x17,0xbf,0x0d,0x00,0x27,
-0x05,0xff,0x0d,0x00,0x18,0x1e,0x0d,0x00,0x17,0xaf,0x0d,0x00,0x27,0x04,0xff,0x0d,
-0x00,0x17,0x0d,0x0d,0x00,0x00,0x6f,0x05,0x04,0x75,0x00,0x00,0xd9,0x02,0x23,0xfb,
-0x6f,0x0d,0x00,0x00,0xd0,0x00,0x15,0xf2,0x0d,0x00,0x00,0xa7,0x0b,0x04,0x0d,0x00,
-0x13,0x02,0x6f,0x16,0x13,0xf5,0xac,0x08,0x15,0xf3,0x0d,0x00,0x10,0x6f,0x35,0x01,
-0x03,0x0d,0x00,0x23,0x01,0xef,0xc7,0x0e,0x15,0xf5,0x89,0x0c,0x03,0x0d,0x00,0x00,
-0x98,0x16,0x05,0x0d,0x00,0x11,0xef,0x6d,0x0a,0x02,0x0d,0x00,0x12,0x09,0x13,0x00,
-0x02,0x0d,0x00,0x08,0x5c,0x0e,0x28,0xf3,0xaf,0x0d,0x00,0x18,0x9f,0x0d,0x00,0x18,
-0x8f,0x0d,0x00,0x18,0x7f,0x0d,0x00,0x02,0x03,0x09,0x75,0x77,0xbf,0xff,0xff,0xfa,
-0x77,0x71,0x9d,0x11,0x06,0x45,0x01,0x0f,0x0d,0x00,0x36,0x06,0xf9,0x01,0x37,0x60,
-0x00,0x0e,0x0c,0x00,0x17,0x0f,0x0c,0x00,0x17,0x1f,0x0c,0x00,0x16,0x3f,0x0c,0x00,
-0x00,0x9e,0x02,0x21,0xfb,0xbb,0x01,0x00,0x10,0x40,0x64,0x01,0x17,0xc0,0x90,0x02,
-0x17,0xa0,0xee,0x01,0x17,0x70,0x5c,0x11,0x05,0xe7,0x04,0x08,0xe6,0x02,0x00,0xb3,
-0x02,0x43,0xad,0xff,0xec,0x83,0x7b,0x03,0x01,0x64,0x02,0x14,0xb2,0xf7,0x01,0x11,
-0xff,0xb3,0x02,0x17,0x06,0xab,0x0f,0x06,0x4d,0x16,0x11,0xfc,0x0c,0x00,0x32,0xb5,
-0x32,0x48,0x8c,0x14,0x3b,0x04,0x7b,0xe5,0x8c,0x14,0x27,0x02,0xff,0x34,0x03,0x17,
-0xaf,0xaf,0x0a,0x17,0x6f,0xd6,0x03,0x16,0x4f,0xa8,0x11,0x03,0x7f,0x10,0x06,0x18,
-0x00,0x00,0xdc,0x07,0x03,0x43,0x02,0x22,0xf6,0x5f,0x1c,0x00,0x00,0xe7,0x02,0x20,
-0xf3,0x2f,0x5e,0x0a,0x02,0xa3,0x00,0x31,0xe0,0x0c,0xff,0xc2,0x0f,0x10,0x3e,0xc6,
-0x03,0x11,0x04,0xc8,0x08,0x12,0x8b,0x9f,0x10,0x17,0xaf,0x48,0x03,0x17,0x0c,0xa5,
+0x00,0x89,0x58,0xf7,0x71,0x0c,0x0e,0x25,0x02,0x00,0x01,0x00,0x2f,0xef,0x00,0x01,
+0x00,0x05,0x13,0xf5,0x08,0x00,0x17,0xde,0x14,0x00,0xbf,0xf2,0xef,0x00,0xfa,0xe6,
+0x00,0xe6,0x00,0x00,0x00,0x03,0x34,0x00,0x02,0x4f,0x06,0x0b,0x00,0x06,0x18,0x00,
+0x01,0x2f,0xaf,0x00,0x01,0x00,0x17,0x1f,0xb9,0x20,0x00,0x0c,0x03,0x90,0x00,0xb2,
+0xe9,0x00,0xfa,0x00,0x00,0xde,0xfb,0xea,0xf5,0x00,0xd5,0x9b,0x00,0x8e,0xfd,0x00,
+0x00,0xfb,0xfd,0xf2,0xf7,0x00,0x9a,0x00,0x6f,0xf8,0x00,0xf9,0x00,0x00,0xf0,0x4e,
+0x00,0x03,0x17,0xf9,0x26,0x00,0x01,0x01,0x00,0x19,0xfd,0x1f,0x00,0x14,0xfb,0x09,
+0x00,0x30,0xdd,0x00,0x00,0x71,0x00,0x8b,0x00,0xe8,0x00,0xfa,0x00,0xfa,0xf4,0xf9,
+0x46,0x00,0x1c,0xf7,0x08,0x01,0x05,0x40,0x00,0x11,0xfb,0x43,0x00,0x37,0xfb,0xf9,
+0xfa,0x1e,0x00,0x75,0xb2,0x00,0x00,0x00,0xc9,0x00,0xc5,0x26,0x00,0x62,0xf6,0xfa,
+0x00,0x00,0xfa,0xf9,0x04,0x00,0x0a,0x01,0x00,0x13,0x05,0x98,0x00,0x2f,0x05,0xf8,
+0x12,0x01,0x09,0x1f,0xfa,0x55,0x01,0x0f,0x1b,0xd1,0xa5,0x00,0x12,0xf9,0x58,0x00,
+0x33,0xf9,0xf5,0xee,0x11,0x00,0x14,0xae,0x72,0x00,0x96,0xee,0x00,0x00,0xc5,0xf9,
+0xc5,0xe5,0x00,0xb0,0x2d,0x00,0x37,0xfc,0xdd,0xf1,0x3b,0x00,0x71,0x8d,0x00,0x00,
+0x00,0xcd,0x00,0xcb,0x0c,0x00,0xe0,0xf1,0x00,0xf6,0x00,0xfd,0xfc,0x00,0x00,0xfc,
+0x00,0x00,0x04,0x00,0x04,0x12,0x00,0x1d,0xab,0x1a,0x01,0x4f,0xf8,0xfa,0x00,0xf6,
+0x9f,0x00,0x0d,0x10,0xf2,0x26,0x01,0x1e,0xf2,0x19,0x00,0x02,0x9f,0x02,0xc0,0xb6,
+0xb2,0x00,0x00,0xde,0xf8,0xc2,0xfb,0x05,0x00,0x05,0x04,0x13,0x01,0xf1,0x02,0xd0,
+0xe7,0x00,0xe7,0xc5,0xed,0xea,0x00,0xed,0xe9,0xf3,0xea,0xef,0x00,0xca,0xe8,0xe5,
+0x72,0x01,0x66,0xc3,0xd3,0x00,0x00,0xeb,0xfc,0x3b,0x01,0xa3,0xf3,0xf3,0x00,0x00,
+0xf3,0xf7,0x00,0x00,0xf8,0xfd,0x49,0x01,0x10,0x00,0xa5,0x00,0x51,0xd7,0xef,0x00,
+0x00,0xf4,0x0a,0x00,0x01,0x01,0x00,0x73,0x03,0xf7,0xf7,0x00,0x00,0xf7,0xfa,0xe9,
+0x01,0x15,0x04,0x3e,0x00,0x14,0xd3,0x1b,0x02,0x15,0x04,0x30,0x01,0x10,0xfa,0x6a,
+0x01,0x16,0xf7,0xd9,0x00,0xf5,0x14,0x06,0xf2,0xbe,0xd5,0x00,0x00,0xd5,0xf8,0xe5,
+0xfb,0x05,0xe5,0x05,0x05,0x04,0x05,0x00,0x05,0xee,0xed,0xfa,0xf5,0xed,0xf5,0xef,
+0xfa,0xf5,0xfa,0x00,0xf9,0xf7,0x05,0xe5,0xee,0xee,0x2d,0x00,0x2a,0x04,0xf9,0xaf,
+0x01,0x10,0xfa,0x14,0x02,0x1e,0xf8,0xd5,0x01,0x17,0xfb,0x72,0x02,0x0e,0x1c,0x00,
+0x0f,0x01,0x00,0x08,0x05,0xf8,0x00,0x0f,0x29,0x02,0x0a,0x4e,0xfd,0x00,0xfc,0xfc,
+0xe5,0x02,0x0f,0x55,0x00,0x0f,0x0f,0x1d,0x00,0x0a,0x3e,0x05,0x00,0x06,0xb7,0x02,
+0x1a,0xf9,0xc5,0x02,0x00,0xaf,0x03,0x0f,0x01,0x00,0x26,0x0d,0xdf,0x02,0x1f,0xe7,
+0x98,0x00,0x0b,0x25,0xfa,0xfb,0x77,0x00,0x1c,0xcf,0x8e,0x02,0x20,0xfb,0x06,0x8d,
+0x02,0x4f,0x0e,0x00,0x05,0x05,0x75,0x00,0x0c,0x0a,0xd2,0x03,0x00,0x06,0x02,0x1c,
+0xd0,0x69,0x00,0x3e,0xfc,0x04,0x00,0x22,0x01,0x1f,0xdd,0xe4,0x00,0x26,0x1e,0xf5,
+0x26,0x00,0x0f,0x1f,0x02,0x18,0x1f,0xfa,0x07,0x04,0x08,0x21,0x01,0x00,0xf5,0x05,
+0x31,0x02,0x03,0x00,0xa7,0x03,0x1e,0x05,0xb7,0x05,0xf1,0x0b,0x07,0x08,0x09,0x0a,
+0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,
+0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,0xf1,0x0c,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,
+0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,
+0x25,0x26,0x24,0x27,0x28,0x3f,0x00,0x01,0x01,0x00,0xd0,0x00,0x08,0x0a,0x0a,0x0a,
+0x0a,0x0c,0x0c,0x0c,0x0c,0x09,0x0c,0x09,0x01,0x00,0xa1,0x00,0x00,0x0d,0x0d,0x0d,
+0x0d,0x17,0x00,0x00,0x1a,0x01,0x00,0x61,0x00,0x1c,0x1d,0x1d,0x1d,0x1d,0x50,0x00,
+0x20,0x1f,0x21,0x01,0x00,0x02,0x7c,0x00,0x50,0x24,0x1b,0x24,0x06,0x1a,0x02,0x00,
+0x22,0x08,0x1c,0x02,0x00,0x64,0x09,0x00,0x09,0x00,0x0a,0x1d,0x02,0x00,0x04,0xa3,
+0x00,0x55,0x0c,0x1f,0x00,0x00,0x0c,0x02,0x00,0x83,0x00,0x00,0x0d,0x00,0x0e,0x00,
+0x00,0x0f,0x02,0x00,0x00,0x1f,0x00,0x00,0x02,0x00,0x80,0x1f,0x00,0x00,0x09,0x21,
+0x09,0x21,0x09,0x5b,0x00,0x11,0x22,0x02,0x00,0x03,0x01,0x00,0x11,0x13,0x02,0x00,
+0x17,0x0d,0x02,0x00,0x70,0x15,0x00,0x17,0x24,0x17,0x18,0x27,0x02,0x00,0x04,0x21,
+0x01,0x20,0x03,0x02,0x1c,0x01,0x4a,0x06,0x07,0x06,0x08,0x1f,0x01,0x00,0x90,0x00,
+0x10,0x00,0x32,0x10,0x10,0x0b,0x83,0x00,0x01,0x08,0x00,0xf1,0x08,0x0b,0x00,0x0d,
+0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,
+0x17,0x17,0x18,0x17,0x2e,0x00,0xf1,0x05,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,
+0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x00,0x00,0x0a,0x01,0x00,0x26,0x24,
+0x0b,0x53,0x00,0x10,0x0b,0x01,0x00,0xa1,0x00,0x0b,0x0f,0x0f,0x0f,0x0f,0x13,0x00,
+0x00,0x16,0x01,0x00,0x20,0x25,0x17,0x01,0x00,0x02,0x44,0x00,0x02,0x32,0x01,0xa0,
+0x26,0x1e,0x1e,0x1e,0x1e,0x1f,0x00,0x1f,0x0a,0x16,0x02,0x00,0x22,0x0b,0x17,0x02,
+0x00,0x10,0x00,0x24,0x00,0x14,0x17,0x02,0x00,0x05,0x16,0x00,0x0b,0x01,0x00,0x1b,
+0x0c,0x10,0x00,0x10,0x19,0x02,0x00,0x51,0x19,0x00,0x00,0x0b,0x1a,0x02,0x00,0x03,
+0x30,0x00,0x22,0x0d,0x1c,0x02,0x00,0x10,0x0e,0x4f,0x01,0x36,0x00,0x0f,0x1e,0x02,
+0x00,0xc0,0x11,0x00,0x13,0x1f,0x13,0x14,0x22,0x14,0x22,0x14,0x22,0x00,0xf0,0x1f,
+0x0e,0xff,0xff,0xff,0x40,0xdf,0xff,0xff,0xf3,0x0d,0xff,0xff,0xff,0x30,0xcf,0xff,
+0xff,0xf2,0x0c,0xff,0xff,0xff,0x20,0xbf,0xff,0xff,0xf1,0x0b,0xff,0xff,0xff,0x10,
+0xaf,0xff,0xff,0xf0,0x0a,0xff,0xff,0xff,0x00,0x9f,0xff,0xff,0xf0,0x09,0x09,0x00,
+0xf6,0x2c,0x8f,0xff,0xff,0xe0,0x08,0xff,0xff,0xfe,0x00,0x7f,0xff,0xff,0xd0,0x07,
+0xff,0xff,0xfc,0x00,0x6f,0xff,0xff,0xc0,0x05,0xff,0xff,0xfb,0x00,0x5f,0xff,0xff,
+0xb0,0x04,0xff,0xff,0xfa,0x00,0x4f,0xff,0xff,0xa0,0x03,0xff,0xff,0xf9,0x00,0x3f,
+0xff,0xff,0x90,0x02,0xff,0xff,0xf8,0x00,0x1d,0xdd,0xdd,0x60,0x00,0x01,0x00,0x71,
+0x21,0x00,0x00,0x08,0xff,0xfc,0x20,0x48,0x00,0xe0,0xff,0xff,0xff,0xf5,0x1f,0xff,
+0xff,0xff,0x70,0xef,0xff,0xff,0xf5,0x06,0x51,0x00,0xfb,0x02,0x06,0xdf,0xe9,0x10,
+0x8f,0xff,0xf3,0x00,0xdf,0xff,0xd8,0xff,0xff,0x30,0x0d,0xff,0xfd,0x0d,0x00,0xf2,
+0x29,0xf1,0x00,0xdf,0xff,0xb8,0xff,0xff,0x00,0x0d,0xff,0xfa,0x8f,0xff,0xe0,0x00,
+0xdf,0xff,0x88,0xff,0xfd,0x00,0x0d,0xff,0xf7,0x8f,0xff,0xb0,0x00,0xdf,0xff,0x58,
+0xff,0xfa,0x00,0x0d,0xff,0xf4,0x8f,0xff,0x80,0x00,0xdf,0xff,0x28,0xff,0xf6,0x00,
+0x0d,0xff,0xf1,0x7f,0xff,0x50,0x00,0xdf,0xfe,0x7c,0x00,0x72,0xff,0xff,0x50,0x00,
+0x2f,0xff,0xf2,0x0d,0x00,0x72,0x1f,0xff,0xf2,0x00,0x04,0xff,0xff,0x0d,0x00,0x01,
+0x09,0x00,0x32,0x7f,0xff,0xc0,0x0e,0x00,0x00,0x09,0x00,0x32,0x0a,0xff,0xfa,0x0d,
+0x00,0x82,0x0a,0xff,0xf9,0x00,0x00,0xdf,0xff,0x70,0x0e,0x00,0x00,0x09,0x00,0x32,
+0x0f,0xff,0xf4,0x0d,0x00,0x00,0x09,0x00,0x41,0x02,0xff,0xff,0x10,0x0d,0x00,0x01,
+0x09,0x00,0x32,0x5f,0xff,0xf0,0x1b,0x00,0x30,0x5f,0xff,0xe0,0xe8,0x00,0xf6,0x04,
+0x00,0x00,0x00,0x01,0x11,0x11,0x18,0xff,0xfc,0x11,0x11,0xbf,0xff,0xa1,0x11,0x10,
+0x00,0xbf,0xff,0x01,0x00,0x27,0xa0,0x0b,0x0d,0x00,0x1f,0xfa,0x1b,0x00,0x09,0xa2,
+0x00,0x00,0x06,0xff,0xfd,0x00,0x00,0x9f,0xff,0xb0,0x5e,0x00,0x72,0x9f,0xff,0xa0,
+0x00,0x0c,0xff,0xf8,0x0d,0x00,0x30,0x0c,0xff,0xf7,0xdb,0x00,0x14,0x40,0xe4,0x00,
+0x52,0x40,0x00,0x2f,0xff,0xf1,0x0d,0x00,0x00,0x09,0x00,0x23,0x05,0xff,0xfe,0x00,
+0x01,0x09,0x00,0x11,0x8f,0x43,0x00,0x17,0x8f,0x5e,0x00,0x27,0xe0,0x08,0x0d,0x00,
+0x1f,0xfe,0x1b,0x00,0x09,0xc0,0x01,0x11,0x14,0xff,0xff,0x11,0x11,0x7f,0xff,0xd1,
+0x11,0x11,0x51,0x00,0x54,0x6f,0xff,0xd0,0x00,0x09,0x27,0x01,0x82,0x09,0xff,0xfb,
+0x00,0x00,0xcf,0xff,0x80,0x0e,0x00,0x00,0x09,0x00,0x32,0x0f,0xff,0xf5,0x0d,0x00,
+0x81,0x0e,0xff,0xf5,0x00,0x01,0xff,0xff,0x20,0x0d,0x00,0x01,0x09,0x00,0x14,0x4f,
+0x27,0x01,0x00,0x09,0x00,0x32,0x07,0xff,0xfd,0x0d,0x00,0x01,0x09,0x00,0x38,0xaf,
+0xff,0xa0,0xe4,0x00,0x14,0xf7,0xe4,0x00,0x12,0xf8,0xbf,0x01,0x24,0x00,0x00,0x39,
+0x00,0x1f,0x70,0x0c,0x00,0x24,0x62,0x03,0x8b,0xef,0xff,0xea,0x60,0x0b,0x00,0x11,
+0xcf,0xd9,0x00,0x12,0x70,0xcd,0x00,0x01,0x01,0x00,0x11,0xfc,0x6c,0x01,0x03,0x01,
+0x00,0x10,0xc0,0x42,0x01,0x03,0x01,0x00,0x10,0xf8,0x9b,0x00,0x50,0xff,0xff,0xc8,
+0x7a,0xff,0x1d,0x03,0xd0,0x01,0xff,0xff,0xff,0xf6,0x00,0x00,0x2e,0xff,0xff,0xff,
+0x80,0x05,0xb0,0x01,0x01,0x43,0x02,0x01,0x16,0x03,0x21,0xff,0x50,0x27,0x02,0x30,
+0xff,0xf0,0x08,0x58,0x03,0x01,0xc9,0x00,0x30,0xff,0xf2,0x07,0x6d,0x03,0x02,0x79,
+0x01,0x10,0xf4,0x5f,0x00,0x12,0x90,0x19,0x02,0x44,0x10,0x02,0xff,0xff,0x4d,0x02,
+0x01,0x35,0x00,0x24,0xff,0x81,0xb0,0x00,0x00,0x99,0x00,0x14,0x81,0x82,0x02,0x00,
+0x01,0x00,0x12,0xa3,0x0d,0x00,0x02,0x26,0x02,0x11,0xc3,0x0c,0x00,0x03,0x9f,0x01,
+0x11,0x91,0x0d,0x00,0x11,0x3c,0x0c,0x00,0x12,0xfd,0x66,0x01,0x11,0x3b,0x0d,0x00,
+0x12,0xe1,0x33,0x00,0x23,0x28,0xef,0xd9,0x00,0x10,0x00,0xdd,0x00,0x26,0xef,0xff,
+0x48,0x01,0x12,0x1c,0xe5,0x00,0x04,0x99,0x01,0x81,0xff,0xf1,0xbe,0xee,0xee,0xd0,
+0x00,0x00,0xeb,0x00,0x32,0xf3,0xbf,0xff,0xa6,0x01,0x00,0xb4,0x00,0x12,0xaf,0xa7,
+0x00,0x00,0x0c,0x00,0x32,0xf3,0x6f,0xff,0xf4,0x01,0x00,0x33,0x04,0x12,0x2f,0x4d,
+0x00,0x10,0x06,0x2d,0x02,0x10,0x0b,0xab,0x02,0x30,0x41,0x13,0x9f,0xdf,0x00,0x16,
+0x03,0x38,0x02,0x34,0x20,0x00,0x7f,0x0b,0x00,0x15,0xf7,0xb3,0x00,0x02,0x02,0x01,
+0x12,0x5e,0x0b,0x00,0x11,0xe6,0x80,0x00,0x10,0x6b,0x0b,0x00,0x14,0xc7,0xa5,0x01,
+0x11,0xdf,0x3b,0x01,0x04,0x4d,0x02,0x1f,0x00,0x0c,0x00,0x16,0x57,0x01,0x7c,0xef,
+0xec,0x82,0x6f,0x04,0x01,0x63,0x00,0x15,0x80,0x0f,0x00,0x11,0x05,0x71,0x00,0x15,
+0xf9,0x10,0x00,0x12,0x1e,0x82,0x00,0x00,0x9b,0x01,0x12,0x20,0x06,0x02,0x40,0xfc,
+0x20,0x19,0xff,0x24,0x03,0x31,0x03,0xfc,0x50,0x08,0x01,0x10,0xf1,0x5c,0x00,0x61,
+0xe0,0x00,0x00,0x0d,0xff,0xf6,0x7e,0x01,0x10,0xc0,0x05,0x01,0x10,0xf0,0x05,0x00,
+0x11,0xd0,0x77,0x00,0x10,0xb0,0x2f,0x04,0x32,0xf0,0x00,0x03,0xec,0x01,0x05,0x20,
+0x00,0x03,0x9e,0x03,0x05,0x40,0x00,0x33,0x7f,0xff,0xd0,0x60,0x00,0x63,0x30,0x2a,
+0xff,0xff,0xb0,0x02,0xb0,0x03,0x13,0x0e,0x80,0x00,0x13,0x0c,0x94,0x00,0x13,0x04,
+0x6c,0x02,0x32,0x6f,0xff,0xe0,0xa1,0x00,0x20,0x4e,0xff,0x20,0x05,0x15,0x02,0xdf,
+0x03,0x74,0x00,0x6a,0xde,0xdb,0x71,0x00,0x0b,0x76,0x03,0x03,0x01,0x00,0x14,0x6f,
+0xeb,0x01,0x05,0xcb,0x01,0x18,0x50,0x10,0x00,0x39,0x0b,0xff,0xfb,0x2f,0x00,0x84,
+0x5f,0xff,0xf1,0x00,0x4a,0xdf,0xfd,0xa4,0x2f,0x00,0x40,0xef,0xff,0x60,0x1b,0x68,
+0x00,0x14,0xb1,0x70,0x02,0x34,0xfc,0x00,0xcf,0x0d,0x03,0x01,0x8c,0x02,0x13,0xf2,
+0xb7,0x01,0x02,0x44,0x03,0xb2,0xef,0xff,0x70,0x0f,0xff,0xff,0x50,0x06,0xff,0xff,
+0xe0,0xfa,0x03,0x30,0xfc,0x00,0x4f,0xdc,0x01,0x00,0xac,0x05,0x01,0x2f,0x00,0x30,
+0xf3,0x00,0x6f,0x66,0x05,0x32,0x3f,0xff,0xf5,0xd7,0x02,0x11,0x80,0x23,0x01,0x21,
+0x00,0x2f,0x10,0x00,0x10,0x09,0xe6,0x03,0x07,0x10,0x00,0x10,0x3f,0x36,0x00,0x07,
+0x30,0x00,0x10,0xdf,0x1b,0x02,0x01,0x50,0x00,0x10,0x7f,0x1a,0x00,0x31,0x01,0x9f,
+0xfe,0x6a,0x05,0x41,0xff,0x60,0x04,0xef,0x70,0x00,0x21,0x02,0xb4,0x45,0x00,0x1a,
+0xff,0xd9,0x01,0x17,0xdf,0xb0,0x00,0x00,0x01,0x00,0x08,0xd0,0x00,0x01,0x01,0x00,
+0x06,0xf0,0x00,0x46,0x28,0xce,0xff,0xda,0x92,0x06,0x11,0x09,0x03,0x04,0x14,0x40,
+0x0b,0x01,0x14,0xdf,0xa9,0x02,0x03,0x77,0x04,0x02,0x01,0x00,0x14,0x50,0x67,0x01,
+0x03,0x18,0x05,0x05,0x74,0x00,0x34,0xfc,0x99,0xef,0xc1,0x03,0x11,0x02,0x90,0x00,
+0x11,0x0c,0x2a,0x04,0x01,0xca,0x01,0x00,0x6f,0x05,0x14,0x03,0x6d,0x02,0x20,0x06,
+0xff,0x84,0x01,0x17,0x01,0x1e,0x00,0x11,0xfc,0x06,0x00,0x15,0xf5,0x3c,0x00,0x33,
+0x20,0x00,0x1d,0x71,0x03,0x01,0x5a,0x00,0x34,0xb0,0x03,0xdf,0x70,0x01,0x00,0x78,
+0x00,0x21,0xf7,0x9f,0x41,0x00,0x08,0x96,0x00,0x14,0xb0,0x2c,0x03,0x04,0xa0,0x04,
+0x14,0x00,0xbe,0x06,0x07,0xd1,0x00,0x20,0x00,0x02,0xca,0x01,0x03,0xf3,0x06,0x03,
+0x58,0x04,0x01,0x70,0x05,0x35,0xbd,0xdd,0xdb,0xea,0x04,0x10,0xb0,0x5c,0x05,0x15,
+0xfd,0xe0,0x00,0x10,0xfa,0xa8,0x00,0x11,0xfc,0x95,0x00,0x20,0xe2,0x4f,0xd6,0x00,
+0x01,0xda,0x07,0x10,0x0a,0xa8,0x02,0x10,0x05,0x1d,0x01,0x10,0x09,0x21,0x01,0x11,
+0x0f,0xc2,0x00,0x00,0x6c,0x00,0x61,0x6f,0xff,0xff,0xf3,0x00,0x3f,0x82,0x00,0x14,
+0x08,0x20,0x01,0x12,0x4f,0x91,0x00,0x13,0xaf,0xa6,0x01,0x12,0x3f,0x33,0x04,0x13,
+0x0b,0x11,0x04,0x22,0x2f,0xff,0x0e,0x06,0x12,0xdf,0xb8,0x00,0x00,0x81,0x08,0x61,
+0xd2,0x00,0x00,0x02,0xbf,0xff,0x01,0x01,0x10,0x07,0x25,0x00,0x34,0xb8,0x79,0xcf,
+0xd6,0x00,0x17,0xef,0x85,0x06,0x10,0x50,0x26,0x02,0x05,0x01,0x00,0x00,0xd8,0x00,
+0x14,0x03,0x1f,0x00,0x55,0xef,0xff,0xff,0xfd,0x10,0x1a,0x02,0x23,0xc4,0x1d,0x22,
+0x01,0x61,0x16,0xad,0xef,0xfe,0xc9,0x61,0xcd,0x00,0x47,0xf8,0x8f,0xff,0xf7,0x03,
+0x00,0x20,0xf6,0x8f,0x2b,0x08,0xa1,0xf3,0x8f,0xff,0xf2,0x8f,0xff,0xf1,0x8f,0xff,
+0xf0,0x03,0x00,0x25,0xd0,0x8f,0x11,0x05,0x02,0x63,0x05,0x11,0xc0,0x45,0x01,0x11,
+0xdf,0xda,0x02,0x32,0x3e,0xff,0xf8,0x70,0x01,0x12,0xfc,0x3b,0x04,0x11,0xc1,0xf2,
+0x03,0x12,0xfd,0xdf,0x01,0x12,0xf2,0x14,0x00,0x11,0x70,0x26,0x05,0x12,0xfd,0x86,
+0x03,0x21,0xf6,0x00,0xcf,0x00,0x12,0xe0,0xea,0x03,0x12,0x90,0x80,0x01,0x11,0x40,
+0x14,0x06,0x12,0xfe,0xe8,0x01,0x12,0xfa,0x29,0x00,0x12,0xf7,0x9c,0x04,0x12,0xf4,
+0xd5,0x05,0x12,0xf1,0x2c,0x01,0x00,0x0d,0x02,0x15,0x0d,0x3e,0x00,0x12,0xc0,0x07,
+0x03,0x16,0xb0,0x07,0x00,0x11,0x1f,0x78,0x06,0x0b,0x07,0x00,0x06,0x23,0x00,0x12,
+0xc0,0x38,0x00,0x12,0xd0,0x32,0x02,0x12,0xe0,0x49,0x06,0x12,0xf0,0x92,0x00,0x26,
+0xf2,0x00,0x7e,0x02,0x03,0x3c,0x02,0x12,0xbf,0x3f,0x03,0x12,0x7f,0xd0,0x08,0x12,
+0x1f,0xf5,0x02,0x12,0x0c,0x4e,0x00,0x13,0x05,0x43,0x02,0x12,0xdf,0x2b,0x00,0x12,
+0x5f,0xbf,0x01,0x12,0x0c,0x72,0x00,0x12,0x02,0xe8,0x00,0x00,0x3a,0x00,0x12,0x30,
+0x65,0x00,0x17,0xf4,0x50,0x00,0x32,0x0b,0xff,0xf6,0x96,0x02,0x12,0xf1,0x8f,0x02,
+0x05,0x93,0x07,0x23,0x0d,0x70,0x92,0x05,0x13,0xc1,0xd8,0x06,0x22,0xe2,0x00,0xf0,
+0x00,0x00,0x08,0x00,0x00,0x0c,0x03,0x31,0xd1,0x00,0x00,0x62,0x07,0x13,0xa0,0xb8,
+0x02,0x12,0x50,0x51,0x05,0x13,0xfe,0xe2,0x04,0x13,0xf8,0xbe,0x03,0x12,0xf1,0xe9,
+0x08,0x02,0x0c,0x04,0x12,0xcf,0x1f,0x00,0x13,0x07,0x84,0x00,0x13,0x2f,0x3e,0x00,
+0x33,0xdf,0xff,0xfe,0x49,0x07,0x13,0xf3,0xaa,0x00,0x12,0x70,0x01,0x01,0x13,0xfa,
+0x26,0x00,0x12,0xd0,0x09,0x01,0x12,0xff,0xd6,0x09,0x02,0x54,0x00,0x12,0xef,0xe6,
+0x00,0x13,0x0d,0x35,0x00,0x12,0xdf,0xba,0x01,0x13,0x0d,0x5b,0x00,0x12,0xdf,0xee,
+0x00,0x13,0x0e,0x1e,0x00,0x03,0x2d,0x00,0x12,0x0f,0x62,0x01,0x22,0x01,0xff,0x71,
+0x00,0x12,0x3f,0x86,0x01,0x13,0x05,0x06,0x04,0x12,0x8f,0xc5,0x00,0x13,0x0b,0x61,
+0x00,0x12,0xff,0xf9,0x08,0x12,0x3f,0xbc,0x00,0x13,0x08,0x64,0x01,0x12,0xef,0x38,
+0x01,0x15,0x4f,0x2c,0x00,0x17,0xd0,0xac,0x01,0x33,0xdf,0xff,0xfc,0x49,0x00,0x12,
+0x20,0x88,0x01,0x12,0x60,0x1f,0x04,0x12,0x90,0x8b,0x00,0x14,0xa0,0x39,0x09,0x01,
+0xa7,0x02,0x12,0x60,0x56,0x09,0x15,0x10,0xcd,0x02,0x13,0x2f,0x8c,0x01,0x01,0xe0,
+0x01,0x03,0x9d,0x09,0x02,0xc6,0x0a,0x05,0x0b,0x00,0x14,0xf3,0x0b,0x00,0x12,0x0e,
+0x8e,0x00,0x50,0x01,0x81,0x00,0x00,0x0d,0x0b,0x00,0xf2,0x0a,0x04,0x10,0x06,0xff,
+0xb4,0x00,0x0c,0xff,0xf1,0x00,0x17,0xdf,0x60,0x0b,0xff,0xff,0xe7,0x1b,0xff,0xf0,
+0x3a,0xff,0xff,0xb0,0x0f,0x37,0x09,0x00,0xbb,0x03,0x15,0x2c,0x98,0x03,0x42,0xf4,
+0x00,0x16,0xae,0x35,0x0a,0x10,0xa6,0x7e,0x00,0x10,0x39,0xda,0x07,0x15,0x30,0xcc,
+0x08,0x16,0x60,0xa8,0x04,0x14,0xf3,0x0e,0x05,0x42,0x8c,0xff,0xfe,0x10,0x91,0x07,
+0x23,0xfd,0x03,0xdb,0x04,0x51,0xcf,0xff,0xf4,0x00,0x8f,0xe7,0x01,0x10,0x09,0xda,
+0x00,0x11,0x0e,0x11,0x01,0x10,0x07,0x28,0x00,0x12,0x05,0x44,0x00,0x20,0x2c,0xf5,
+0x38,0x02,0x11,0xd3,0x43,0x00,0x00,0x10,0x00,0x2e,0x19,0x00,0x01,0x00,0x17,0x2f,
+0x60,0x09,0x0f,0x0c,0x00,0x49,0x16,0xaf,0x95,0x04,0x1f,0xfb,0x0c,0x00,0x29,0xcf,
+0x12,0x22,0x22,0x22,0x4f,0xff,0xff,0xf6,0x22,0x22,0x22,0x21,0xc0,0x00,0x59,0x01,
+0x70,0x04,0x00,0x5d,0x0a,0x0d,0x09,0x00,0x30,0xfe,0x00,0x0d,0xc6,0x02,0x00,0xc3,
+0x02,0x00,0xbd,0x04,0x50,0x0a,0xff,0xff,0xd0,0x01,0x8e,0x02,0x50,0x9f,0xff,0xfb,
+0x00,0x0d,0x88,0x02,0x20,0x06,0xef,0xdb,0x01,0x50,0x30,0x00,0x00,0x37,0x77,0x01,
+0x00,0x22,0x76,0x6f,0x12,0x02,0x0f,0x07,0x00,0x09,0x30,0x00,0x01,0x33,0xd6,0x01,
+0x30,0xfe,0x40,0x08,0x0a,0x06,0x50,0xef,0xff,0xff,0xf8,0x0f,0x13,0x0a,0xd0,0xdf,
+0xff,0xff,0xf7,0x05,0xff,0xff,0xfe,0x10,0x04,0xcf,0xe9,0x10,0x11,0x00,0x01,0x00,
+0x41,0x0e,0xff,0xff,0x20,0x09,0x00,0x42,0x03,0xff,0xff,0xc0,0x13,0x00,0x3f,0x9f,
+0xff,0xf7,0x1c,0x00,0x12,0x11,0x10,0x09,0x00,0x1f,0x04,0x1c,0x00,0x4c,0x1f,0xf6,
+0x1c,0x00,0x3e,0x1f,0xaf,0x1c,0x00,0x01,0x1b,0xb0,0x1c,0x00,0x1f,0x0f,0x1c,0x00,
+0x2d,0x54,0x01,0x88,0x88,0x60,0x00,0x01,0x00,0x52,0x04,0x9c,0xef,0xed,0xb7,0x4c,
+0x01,0x82,0x05,0xef,0xff,0xff,0xff,0xff,0xfa,0x10,0x36,0x00,0x01,0x01,0x00,0x63,
+0xe3,0x00,0x00,0x00,0x0a,0xff,0x01,0x00,0x44,0x30,0x00,0x00,0x6f,0x0c,0x00,0x30,
+0xd0,0x00,0x01,0x07,0x00,0xf1,0x06,0xb8,0x9d,0xff,0xff,0xff,0xf8,0x00,0x07,0xff,
+0xff,0xff,0xd2,0x00,0x00,0x7f,0xff,0xff,0xfe,0x00,0x0d,0xff,0x9c,0x01,0xf0,0x06,
+0x09,0xff,0xff,0xff,0x50,0x1f,0xff,0xff,0xfa,0x00,0x00,0x00,0x02,0xff,0xff,0xff,
+0xa0,0x5f,0xff,0xff,0xf5,0x5a,0x00,0x83,0xdf,0xff,0xff,0xd0,0x8f,0xff,0xff,0xf2,
+0x66,0x00,0x50,0xf0,0x9f,0xff,0xff,0xf1,0x0c,0x00,0x00,0x14,0x00,0x00,0x10,0x00,
+0x03,0x0c,0x00,0x22,0xf3,0xbf,0x0c,0x00,0x00,0x55,0x00,0x2f,0xf4,0xcf,0x0c,0x00,
+0x34,0x08,0x54,0x00,0x08,0x6c,0x00,0x04,0x84,0x00,0x40,0x9f,0xff,0xff,0xf2,0x10,
+0x00,0x04,0x9c,0x00,0x44,0x5f,0xff,0xff,0xf6,0xb4,0x00,0x08,0xcc,0x00,0x08,0xe4,
+0x00,0x12,0x06,0xfc,0x00,0x10,0x6f,0xfc,0x00,0x10,0x01,0x42,0x01,0x12,0xa8,0x14,
+0x01,0x26,0x00,0x5f,0x2c,0x01,0x09,0x44,0x01,0x22,0x00,0x9f,0x0b,0x00,0x1c,0xf3,
+0x74,0x01,0x00,0x8c,0x01,0x35,0xfd,0xb7,0x20,0x9b,0x01,0x21,0x17,0xcc,0x07,0x00,
+0x30,0x6b,0xff,0xfc,0x1c,0x00,0x20,0xaf,0xff,0x08,0x00,0x10,0x39,0x30,0x00,0x31,
+0xfc,0x02,0x8e,0x42,0x00,0x3f,0xfc,0x1f,0xff,0x08,0x00,0x06,0x20,0xc7,0x2f,0x08,
+0x00,0x20,0xfb,0x61,0xf7,0x01,0x22,0xfc,0x05,0xff,0x01,0x2f,0xfc,0x00,0x08,0x00,
+0xa7,0x62,0x01,0x6a,0xdf,0xfe,0xdb,0x83,0x19,0x01,0x11,0x19,0xe6,0x00,0x20,0xfd,
+0x50,0x0c,0x00,0x13,0x4e,0x59,0x01,0x27,0x90,0x00,0x72,0x01,0x54,0xa0,0x00,0x00,
+0x3f,0xff,0x01,0x00,0x11,0x50,0x93,0x02,0x30,0xfd,0x98,0xae,0x06,0x00,0x10,0x00,
+0xaf,0x01,0x12,0xf6,0x91,0x01,0x41,0xf2,0x00,0xcf,0xff,0xe1,0x03,0x00,0x20,0x00,
+0x20,0x60,0x1f,0xc1,0x01,0x11,0x00,0xc9,0x01,0x23,0xf8,0x03,0x51,0x00,0x01,0x08,
+0x00,0x22,0x5f,0xff,0x06,0x04,0x10,0x3f,0xd6,0x01,0x31,0x11,0x11,0x11,0xb7,0x01,
+0x01,0x58,0x00,0x03,0x01,0x00,0x13,0xbf,0x3e,0x02,0x03,0x25,0x00,0x14,0xfc,0x0c,
+0x00,0x53,0x0c,0xff,0xff,0xff,0x40,0x0c,0x00,0x25,0x09,0xff,0x91,0x03,0x01,0x83,
+0x00,0x14,0xf2,0x7f,0x03,0x13,0xff,0x17,0x03,0x03,0x0c,0x00,0x13,0xf8,0x0c,0x00,
+0x10,0x03,0x16,0x02,0x07,0x0c,0x00,0x14,0xfc,0x0c,0x00,0x16,0xef,0x0c,0x00,0x1b,
+0x02,0x0c,0x00,0x2e,0xfd,0x10,0x0c,0x00,0x2f,0x01,0xdf,0x0c,0x00,0x07,0x23,0xfe,
+0x20,0x0c,0x00,0x10,0xcf,0xb6,0x02,0x11,0x88,0x01,0x00,0x35,0x50,0x9f,0xff,0x01,
+0x00,0x15,0xfb,0xb6,0x02,0x00,0xbd,0x00,0x1f,0xaf,0x19,0x00,0x11,0x02,0xc5,0x02,
+0x32,0xfe,0xdb,0x73,0x5a,0x00,0x12,0x6e,0xa9,0x01,0x14,0x40,0x65,0x00,0x03,0x9c,
+0x01,0x25,0x01,0xef,0x3d,0x00,0x35,0x00,0x00,0xcf,0x3e,0x00,0x11,0x70,0xc1,0x01,
+0x11,0xfc,0xa9,0x01,0x11,0xff,0x3e,0x01,0x12,0xc2,0x2d,0x01,0x32,0xf5,0x00,0xff,
+0x63,0x01,0x90,0x08,0xff,0xff,0xff,0x80,0x0b,0xbb,0xbb,0xb8,0x5d,0x00,0x54,0x2f,
+0xff,0xff,0xf9,0x00,0xff,0x00,0x03,0xb1,0x01,0x01,0x01,0x00,0x04,0xb6,0x03,0x00,
+0x01,0x00,0x44,0x1d,0xff,0xff,0xff,0x17,0x01,0x10,0x6e,0xe7,0x01,0x04,0x99,0x01,
+0x01,0x70,0x00,0x23,0x00,0x00,0x80,0x00,0x25,0xfe,0x60,0xb2,0x01,0x05,0x23,0x01,
+0x17,0xcf,0x25,0x00,0x14,0x0c,0xbc,0x00,0x00,0x01,0x00,0x48,0x45,0x55,0x68,0xcf,
+0x70,0x00,0x13,0x4f,0xd8,0x03,0x04,0x7d,0x00,0x15,0xfa,0xc2,0x03,0x13,0xef,0x64,
+0x04,0x13,0x00,0x47,0x05,0x03,0x5a,0x00,0x02,0x69,0x04,0x13,0x7f,0xfa,0x01,0x00,
+0x19,0x00,0x10,0x25,0xd9,0x00,0x04,0x32,0x00,0x22,0x2f,0xff,0xde,0x06,0x10,0x6f,
+0xb0,0x02,0x00,0xa8,0x01,0x03,0x79,0x05,0x20,0x70,0x06,0x84,0x00,0x74,0xc9,0x89,
+0xdf,0xff,0xff,0xff,0xe1,0x93,0x00,0x02,0xcf,0x02,0x14,0x1d,0x0c,0x00,0x00,0x40,
+0x02,0x13,0x1c,0x0c,0x00,0x11,0xf7,0x6d,0x02,0x02,0x6c,0x01,0x12,0xa2,0x78,0x00,
+0x55,0x48,0xce,0xff,0xed,0xa6,0x86,0x00,0x01,0xe4,0x00,0x04,0x7e,0x02,0x01,0xc5,
+0x05,0x05,0x0d,0x00,0x18,0x2f,0x0d,0x00,0x17,0xbf,0x0d,0x00,0x27,0x05,0xff,0x0d,
+0x00,0x18,0x1e,0x0d,0x00,0x17,0xaf,0x0d,0x00,0x27,0x04,0xff,0x0d,0x00,0x17,0x0d,
+0x0d,0x00,0x00,0x6f,0x05,0x04,0x75,0x00,0x00,0xd9,0x02,0x23,0xfb,0x6f,0x0d,0x00,
+0x00,0xd0,0x00,0x14,0xf2,0x0d,0x00,0x00,0xa1,0x05,0x14,0x70,0x0d,0x00,0x10,0x02,
+0xe6,0x02,0x04,0x0d,0x00,0x10,0x0b,0x38,0x05,0x04,0x0d,0x00,0x10,0x6f,0x35,0x01,
+0x02,0x0d,0x00,0x00,0x54,0x02,0x23,0xfd,0x00,0x0d,0x00,0x00,0x53,0x01,0x15,0xf4,
+0x0d,0x00,0x11,0x4f,0xb8,0x01,0x03,0x0d,0x00,0x44,0xef,0xff,0xfe,0x10,0x0d,0x00,
+0x12,0x09,0x13,0x00,0x02,0x0d,0x00,0x17,0x3f,0xd3,0x02,0x28,0xf3,0xaf,0x0d,0x00,
+0x18,0x9f,0x0d,0x00,0x18,0x8f,0x0d,0x00,0x18,0x7f,0x0d,0x00,0x21,0x37,0x77,0x01,
+0x00,0x63,0xbf,0xff,0xff,0xfa,0x77,0x71,0x13,0x01,0x05,0xd0,0x00,0x0f,0x0d,0x00,
+0x39,0x06,0xf9,0x01,0x37,0x60,0x00,0x0e,0x0c,0x00,0x17,0x0f,0x0c,0x00,0x17,0x1f,
+0x0c,0x00,0x16,0x3f,0x0c,0x00,0x00,0x9e,0x02,0x21,0xfb,0xbb,0x01,0x00,0x10,0x40,
+0x64,0x01,0x17,0xc0,0x90,0x02,0x17,0xa0,0xee,0x01,0x14,0x70,0x0c,0x00,0x17,0xdf,
+0xe7,0x04,0x08,0xe6,0x02,0x00,0xb3,0x02,0x43,0xad,0xff,0xec,0x83,0x7b,0x03,0x01,
+0x64,0x02,0x14,0xb2,0xf7,0x01,0x11,0xff,0xb3,0x02,0x15,0x06,0x77,0x00,0x11,0xf2,
+0xb8,0x03,0x03,0x9b,0x06,0x01,0x0c,0x00,0x41,0xb5,0x32,0x48,0xef,0x42,0x05,0x33,
+0x04,0x7b,0xe5,0xb1,0x02,0x17,0xc0,0xca,0x03,0x26,0xf0,0x00,0x53,0x02,0x17,0xf4,
+0xfe,0x00,0x17,0xf6,0x72,0x03,0x17,0xf7,0x72,0x05,0x18,0xf8,0x18,0x00,0x00,0xdc,
+0x07,0x03,0x43,0x02,0x22,0xf6,0x5f,0x1c,0x00,0x00,0xe7,0x02,0x31,0xf3,0x2f,0xff,
+0xfb,0x01,0x00,0xa3,0x00,0x10,0xe0,0x43,0x01,0x40,0xc1,0x00,0x00,0x3e,0xc6,0x03,
+0x11,0x04,0xc8,0x08,0x21,0x8b,0xff,0x75,0x03,0x17,0xaf,0x48,0x03,0x17,0x0c,0xa5,
 0x04,0x04,0x19,0x00,0x11,0xfa,0x03,0x03,0x16,0xdf,0x7f,0x06,0x75,0x00,0x03,0x8c,
 0xef,0xfe,0xc9,0x40,0xa4,0x01,0x43,0x59,0xce,0xef,0xb0,0xaa,0x05,0x15,0xbf,0xf3,
-0x05,0x26,0x01,0xbf,0xb5,0x11,0x16,0x5f,0xc1,0x11,0x17,0x07,0xcd,0x11,0x11,0x6f,
-0x53,0x00,0x24,0xba,0x70,0xd5,0x11,0x16,0xa4,0x3b,0x03,0x16,0xc2,0xdd,0x11,0x17,
-0xfa,0x59,0x04,0x17,0xd0,0x91,0x03,0x43,0x30,0x01,0x56,0x75,0x81,0x0f,0x31,0xfc,
-0x05,0xcf,0xd8,0x16,0x00,0x1b,0x02,0x23,0xf8,0xbf,0xd0,0x04,0x06,0x03,0x02,0x37,
-0xd1,0x00,0x5f,0xae,0x05,0x07,0xce,0x02,0x01,0xf9,0x05,0x40,0xfb,0x41,0x03,0xaf,
-0x8c,0x01,0x12,0x9f,0x2a,0x05,0x13,0x07,0x0c,0x03,0x04,0x44,0x01,0x23,0xf6,0xaf,
-0xb9,0x06,0x00,0xe5,0x04,0x03,0x0c,0x00,0x00,0x6b,0x02,0x10,0xfb,0xcf,0x04,0x04,
-0xac,0x07,0x03,0x40,0x09,0x00,0x80,0x00,0x14,0xfd,0xbf,0x02,0x00,0x18,0x00,0x03,
-0xa8,0x01,0x00,0x5a,0x04,0x22,0xfa,0x0f,0x6c,0x07,0x00,0x80,0x00,0x22,0xf7,0x0a,
-0x65,0x05,0x10,0x02,0x29,0x02,0x12,0x03,0xce,0x04,0x11,0x2d,0x10,0x02,0x00,0x8a,
-0x00,0x22,0xd9,0x8b,0xa4,0x15,0x14,0x1e,0xa7,0x00,0x14,0xf9,0xf5,0x12,0x03,0x33,
-0x02,0x16,0x2e,0x79,0x06,0x03,0xdc,0x18,0x03,0xcb,0x05,0x52,0x01,0x6a,0xde,0xfe,
-0xd9,0x70,0x11,0x06,0x01,0x00,0x17,0x89,0x0c,0x00,0x1f,0xf8,0x19,0x00,0x12,0x23,
-0x34,0x88,0x01,0x00,0x17,0xdf,0x2e,0x03,0x17,0x1f,0x96,0x03,0x01,0xce,0x1a,0x07,
-0x97,0x01,0x17,0x70,0x8c,0x13,0x16,0xf1,0x52,0x0f,0x06,0xab,0x06,0x13,0x05,0xde,
-0x05,0x05,0xee,0x13,0x07,0xbd,0x02,0x17,0xf4,0x3b,0x08,0x27,0xfd,0x00,0xff,0x07,
-0x17,0x60,0x9d,0x03,0x17,0xf0,0xa4,0x05,0x18,0xf8,0xcc,0x14,0x17,0x10,0xcf,0x17,
-0x05,0xce,0x03,0x04,0x8f,0x01,0x08,0x53,0x09,0x04,0x7d,0x02,0x17,0x50,0xb8,0x00,
-0x17,0xe0,0x68,0x03,0x15,0xf7,0xa9,0x11,0x07,0x56,0x00,0x18,0x05,0xf3,0x06,0x17,
-0xcf,0x59,0x14,0x16,0x4f,0x9f,0x14,0x01,0xe7,0x13,0x17,0x40,0xb8,0x00,0x17,0xd0,
-0xca,0x03,0x17,0xf6,0xb8,0x00,0x18,0xfe,0xb8,0x00,0x16,0x80,0xf2,0x0a,0x42,0xad,
-0xef,0xfe,0xc8,0x40,0x00,0x25,0x1a,0xff,0xcd,0x01,0x26,0x04,0xef,0xe5,0x01,0x17,
-0x4f,0x95,0x03,0x16,0xdf,0x5d,0x18,0x01,0x6d,0x04,0x21,0xa8,0x9c,0xac,0x1a,0x12,
-0x0b,0xdd,0x03,0x10,0x5f,0x8b,0x00,0x00,0x20,0x05,0x03,0x1a,0x14,0x00,0xb9,0x16,
-0x13,0xfd,0x9b,0x06,0x13,0x80,0x0a,0x01,0x10,0x03,0x0c,0x00,0x12,0x0d,0x8f,0x00,
-0x10,0x06,0x11,0x01,0x12,0x08,0x8d,0x02,0x00,0xf8,0x00,0x01,0xa6,0x08,0x30,0xf8,
-0x20,0x04,0x9a,0x0e,0x07,0x1f,0x06,0x16,0xa0,0x90,0x00,0x17,0xf9,0x1a,0x08,0x10,
-0x50,0x78,0x01,0x15,0xaf,0x90,0x07,0x06,0xb1,0x02,0x21,0x80,0x00,0xc3,0x07,0x01,
-0x9c,0x00,0x11,0xf7,0x89,0x00,0x12,0xa0,0x9c,0x00,0x22,0x20,0x1f,0x84,0x00,0x01,
-0x58,0x01,0x16,0x6f,0x1d,0x0d,0x27,0xf0,0xaf,0x8d,0x0c,0x08,0x89,0x19,0x16,0xbf,
-0x18,0x00,0x23,0xf4,0xaf,0x30,0x00,0x12,0xcf,0x48,0x08,0x13,0xfc,0xd8,0x00,0x01,
-0x3b,0x08,0x12,0xa0,0xd9,0x04,0x30,0xb0,0x0c,0xff,0x78,0x00,0x11,0x8c,0x9e,0x00,
-0x18,0x03,0xa3,0x09,0x16,0x6f,0x0d,0x04,0x05,0xa6,0x05,0x10,0xfc,0xe7,0x01,0x26,
-0x2a,0xff,0x15,0x1b,0x01,0x8c,0x01,0x23,0xc9,0x50,0xfc,0x01,0x47,0xad,0xff,0xed,
-0x94,0x45,0x1a,0x27,0xff,0xd4,0x91,0x1a,0x01,0xc0,0x01,0x16,0x0c,0xa0,0x03,0x06,
-0xce,0x1c,0x12,0x60,0x2e,0x08,0x21,0xa8,0xaf,0xbf,0x09,0x11,0x0d,0x98,0x01,0x23,
-0x01,0xcf,0x4f,0x10,0x13,0xfe,0x04,0x19,0x00,0xd0,0x00,0x14,0xf6,0x80,0x01,0x15,
-0xcf,0x45,0x13,0x23,0xff,0x90,0xe4,0x04,0x00,0x9d,0x02,0x13,0xc0,0x21,0x06,0x00,
-0xf0,0x00,0x14,0xe0,0x57,0x02,0x00,0x1c,0x01,0x00,0x30,0x01,0x04,0x0c,0x00,0x13,
-0xbf,0xea,0x02,0x00,0x0c,0x00,0x12,0x8f,0x2e,0x02,0x10,0x01,0x14,0x01,0x12,0x3f,
-0xd4,0x01,0x10,0x2d,0x0c,0x00,0x10,0x0d,0x02,0x01,0x30,0x53,0x59,0xff,0x0c,0x00,
-0x17,0x05,0xee,0x1c,0x07,0x26,0x04,0x13,0xd0,0xad,0x0d,0x12,0xfd,0x4b,0x01,0x01,
-0xe4,0x07,0x12,0xa1,0x43,0x00,0x67,0x01,0x6b,0xdf,0xfd,0x93,0x03,0x08,0x07,0x13,
-0x09,0x38,0x14,0x0c,0x8f,0x0a,0x07,0x1f,0x03,0x16,0x2c,0x8d,0x03,0x23,0x39,0xff,
-0x4f,0x03,0x35,0x0a,0xbc,0xdf,0x12,0x09,0x17,0x0e,0x8c,0x0a,0x17,0x0e,0x82,0x18,
-0x15,0x0e,0x3a,0x0b,0x02,0x0c,0x00,0x24,0xfd,0x60,0x4b,0x04,0x23,0xed,0xa7,0x7f,
-0x00,0x30,0x5c,0xfe,0x91,0x4a,0x02,0x20,0xd0,0x0e,0x6b,0x01,0x00,0x7c,0x01,0x10,
-0x0f,0x49,0x00,0x01,0x8c,0x05,0x8f,0x9f,0xff,0xd3,0x00,0x00,0x03,0x20,0x00,0x01,
-0x00,0x1b,0x21,0x01,0x32,0x9b,0x11,0x20,0x30,0x08,0xa8,0x00,0x00,0x8a,0x00,0x13,
-0x0f,0x88,0x01,0x20,0xf6,0x06,0x3c,0x03,0x01,0x9b,0x11,0x31,0x09,0xef,0xd6,0xe0,
-0x00,0x11,0x80,0x70,0x02,0x10,0x07,0xb6,0x05,0x11,0x05,0xdf,0x01,0x10,0xef,0x94,
-0x03,0x11,0x2c,0xcb,0x0e,0x3f,0x23,0x10,0x00,0x01,0x00,0x2a,0x42,0x03,0x33,0x33,
-0x10,0x1c,0x15,0x0e,0x05,0x00,0x33,0x70,0x00,0x3f,0xc9,0x08,0x10,0x40,0x16,0x03,
-0x00,0x33,0x03,0x30,0xfb,0x00,0x03,0x3b,0x05,0x10,0x0a,0x81,0x00,0x10,0x3f,0x5d,
-0x05,0x11,0x4e,0x51,0x02,0x2f,0x7e,0x70,0x62,0x00,0x08,0x14,0x96,0x0a,0x00,0x14,
-0x5c,0xb2,0x05,0x23,0x17,0xef,0x7a,0x01,0x24,0x03,0xaf,0x90,0x01,0x14,0x5c,0x8f,
-0x01,0x23,0x17,0xef,0xa5,0x01,0x13,0x03,0xe3,0x03,0x33,0xe4,0x00,0x5c,0x11,0x08,
-0x13,0x40,0x61,0x0b,0x23,0xfb,0x60,0xf9,0x02,0x23,0xfd,0x71,0x08,0x05,0x24,0xfe,
-0x83,0x25,0x03,0x25,0xfb,0x10,0x1d,0x05,0x27,0xff,0xb5,0x3a,0x03,0x13,0xa4,0x6e,
-0x00,0x00,0x2d,0x00,0x62,0x93,0x00,0x00,0x00,0x18,0xef,0x0c,0x00,0x00,0xc6,0x1c,
-0x16,0x6d,0x4c,0x04,0x26,0x03,0xaf,0x23,0x02,0x26,0x18,0xef,0xa4,0x1a,0x15,0x6c,
-0x9f,0x0c,0x00,0x23,0x00,0x05,0xb5,0x05,0x26,0x18,0xef,0xf9,0x00,0x34,0x54,0x79,
-0x99,0x01,0x00,0x26,0x91,0xdf,0x91,0x09,0x0f,0x0b,0x00,0x19,0x0f,0xb9,0x01,0x19,
-0x0f,0x6e,0x00,0x2f,0x16,0x2b,0x4b,0x09,0x37,0x3f,0xfd,0x71,0xe4,0x09,0x16,0x92,
-0x0b,0x00,0x26,0xff,0xc5,0x0b,0x00,0x35,0xff,0xe7,0x10,0x0b,0x00,0x36,0xff,0xfa,
-0x30,0xfe,0x0c,0x20,0xfc,0x60,0xf0,0x1b,0x16,0xdf,0x51,0x01,0x12,0x03,0x34,0x11,
-0x02,0x1a,0x1c,0x35,0x49,0xef,0xff,0x83,0x16,0x25,0x05,0xaf,0x0b,0x00,0x01,0x8f,
-0x11,0x25,0xf3,0x00,0x22,0x00,0x10,0xf3,0x91,0x0a,0x14,0x8e,0xae,0x11,0x23,0x17,
-0xdf,0x20,0x05,0x23,0x01,0x6c,0x4c,0x05,0x14,0x50,0x25,0x20,0x24,0xf9,0x20,0x84,
-0x00,0x15,0xd6,0x8f,0x00,0x14,0xb4,0xa5,0x00,0x24,0xfe,0x82,0xb0,0x00,0x24,0xfd,
-0x60,0xc6,0x00,0x15,0xfa,0x4b,0x0b,0x17,0x28,0x2d,0x03,0x00,0xb6,0x08,0x36,0xff,
-0xec,0x84,0xcd,0x08,0x01,0x69,0x05,0x15,0x2d,0x4b,0x06,0x25,0x01,0xdf,0xf2,0x06,
-0x16,0x0a,0x66,0x1f,0x10,0x2f,0x8b,0x00,0x20,0x9b,0xef,0xac,0x03,0x11,0x8f,0x7b,
-0x0b,0x10,0x0a,0xd3,0x04,0x14,0xcf,0xf1,0x0c,0x04,0x26,0x05,0x00,0x75,0x02,0x42,
-0xf2,0x56,0x66,0x66,0xdd,0x1e,0x05,0x9d,0x08,0x04,0x43,0x05,0x02,0x0e,0x07,0x16,
-0xa0,0x37,0x0f,0x15,0x40,0x1d,0x10,0x16,0xfb,0x15,0x00,0x15,0xd1,0x62,0x10,0x03,
-0x3e,0x10,0x03,0xc2,0x1b,0x03,0x99,0x06,0x25,0xfd,0x10,0x82,0x08,0x16,0xd1,0xed,
-0x10,0x15,0x20,0x02,0x0f,0x16,0xf9,0xe0,0x08,0x16,0xf5,0x64,0x08,0x14,0xf3,0x01,
-0x11,0x3f,0x55,0x55,0x50,0x61,0x02,0x0b,0x36,0x02,0x30,0x00,0x27,0x20,0x16,0x80,
-0x86,0x0e,0x16,0xf8,0xbd,0x08,0x16,0xfe,0xf9,0x08,0x1e,0xff,0x16,0x00,0x16,0x0d,
-0x88,0x08,0x39,0x01,0xae,0xfd,0x6e,0x00,0x69,0x36,0x9b,0xcd,0xcb,0xa8,0x51,0x6f,
-0x00,0x26,0x28,0xef,0x4c,0x02,0x04,0x82,0x00,0x05,0x23,0x0c,0x28,0xe7,0x00,0x4c,
-0x09,0x04,0x48,0x07,0x17,0x20,0x86,0x1e,0x65,0xd8,0x52,0x10,0x01,0x36,0xae,0x30,
-0x06,0x00,0x9b,0x02,0x22,0xfc,0x40,0x16,0x01,0x14,0xdf,0x60,0x01,0x17,0x0d,0x4c,
-0x0a,0x13,0x8f,0x0a,0x19,0x15,0x0b,0x53,0x01,0x02,0x38,0x20,0x03,0x64,0x00,0x27,
-0xd1,0x00,0xe9,0x1d,0x12,0xf5,0x2c,0x0d,0x08,0x9f,0x03,0x11,0xbf,0xc5,0x09,0x13,
-0xbf,0x50,0x00,0x23,0x01,0x21,0x4f,0x0d,0x01,0x39,0x1d,0x11,0xfb,0xde,0x02,0x41,
-0xbf,0xff,0xfe,0xa4,0x89,0x01,0x11,0xfb,0x8e,0x01,0x13,0x20,0xa0,0x06,0x21,0xff,
-0xfc,0xbf,0x02,0x10,0xf1,0xb8,0x01,0x16,0xb0,0x65,0x09,0x10,0x30,0x3e,0x02,0x31,
-0x40,0x00,0x6f,0x97,0x0a,0x15,0x3f,0xb5,0x14,0x72,0x0a,0xff,0xf8,0x00,0x0b,0xff,
-0xfe,0xbc,0x00,0x31,0xe6,0x20,0x1b,0x48,0x00,0x41,0x7f,0xff,0xb0,0x00,0x3e,0x02,
-0x11,0x08,0x7c,0x22,0x30,0xaf,0xff,0xf0,0xda,0x08,0x51,0xfd,0x00,0x4f,0xff,0xf5,
+0x05,0x24,0x01,0xbf,0x47,0x00,0x04,0xa4,0x06,0x14,0xb0,0x71,0x03,0x04,0x0c,0x00,
+0x11,0x6f,0x53,0x00,0x23,0xba,0x70,0xef,0x05,0x25,0xff,0xa4,0x3b,0x03,0x00,0x05,
+0x05,0x04,0x14,0x03,0x17,0xfa,0x59,0x04,0x17,0xd0,0x91,0x03,0x52,0x30,0x01,0x56,
+0x75,0x30,0xf8,0x02,0x71,0xfc,0x05,0xcf,0xff,0xff,0xfe,0x70,0x43,0x0a,0x23,0xf8,
+0xbf,0xd0,0x04,0x06,0x03,0x02,0x37,0xd1,0x00,0x5f,0xae,0x05,0x07,0xce,0x02,0x01,
+0xf9,0x05,0x40,0xfb,0x41,0x03,0xaf,0x8c,0x01,0x12,0x9f,0x2a,0x05,0x13,0x07,0x0c,
+0x03,0x04,0x44,0x01,0x23,0xf6,0xaf,0xb9,0x06,0x00,0xe5,0x04,0x03,0x0c,0x00,0x00,
+0x6b,0x02,0x10,0xfb,0xcf,0x04,0x04,0xac,0x07,0x03,0x40,0x09,0x00,0x80,0x00,0x14,
+0xfd,0xbf,0x02,0x00,0x18,0x00,0x03,0xa8,0x01,0x00,0x5a,0x04,0x22,0xfa,0x0f,0x6c,
+0x07,0x00,0x80,0x00,0x22,0xf7,0x0a,0x65,0x05,0x10,0x02,0x29,0x02,0x12,0x03,0xce,
+0x04,0x11,0x2d,0x10,0x02,0x00,0x8a,0x00,0x31,0xd9,0x8b,0xff,0x45,0x07,0x14,0x1e,
+0xa7,0x00,0x13,0xf9,0x20,0x01,0x13,0xff,0x33,0x02,0x16,0x2e,0x79,0x06,0x01,0x4f,
+0x00,0x05,0xcb,0x05,0x50,0x01,0x6a,0xde,0xfe,0xd9,0x98,0x01,0x08,0xbf,0x03,0x17,
+0x89,0x0c,0x00,0x1f,0xf8,0x19,0x00,0x12,0x23,0x34,0x88,0x01,0x00,0x17,0xdf,0x2e,
+0x03,0x17,0x1f,0x96,0x03,0x13,0x08,0xcb,0x00,0x04,0x97,0x01,0x05,0x3b,0x03,0x17,
+0x7f,0x16,0x08,0x17,0x0e,0xab,0x06,0x13,0x05,0xde,0x05,0x04,0x60,0x03,0x17,0xb0,
+0xbd,0x02,0x17,0xf4,0x3b,0x08,0x27,0xfd,0x00,0xff,0x07,0x17,0x60,0x9d,0x03,0x17,
+0xf0,0xa4,0x05,0x05,0xfa,0x02,0x17,0x09,0x5e,0x06,0x27,0x01,0xff,0xce,0x03,0x04,
+0x8f,0x01,0x08,0x53,0x09,0x04,0x7d,0x02,0x17,0x50,0xb8,0x00,0x17,0xe0,0x68,0x03,
+0x05,0x5c,0x03,0x17,0x0d,0x56,0x00,0x18,0x05,0xf3,0x06,0x16,0xcf,0xc2,0x08,0x24,
+0x00,0x4f,0x7f,0x01,0x02,0x9f,0x05,0x27,0xff,0x40,0xb8,0x00,0x17,0xd0,0xca,0x03,
+0x17,0xf6,0xb8,0x00,0x18,0xfe,0xb8,0x00,0x16,0x80,0xf2,0x0a,0x42,0xad,0xef,0xfe,
+0xc8,0x40,0x00,0x25,0x1a,0xff,0xcd,0x01,0x26,0x04,0xef,0xe5,0x01,0x17,0x4f,0x95,
+0x03,0x25,0xdf,0xff,0xe9,0x06,0x01,0x6d,0x04,0x20,0xa8,0x9c,0x32,0x00,0x01,0x84,
+0x00,0x12,0xc1,0x69,0x03,0x22,0x40,0x0e,0xc1,0x00,0x10,0x09,0x64,0x02,0x12,0x0f,
+0x54,0x01,0x10,0x04,0x72,0x00,0x03,0x0a,0x01,0x10,0x03,0x0c,0x00,0x12,0x0d,0x8f,
+0x00,0x10,0x06,0x11,0x01,0x12,0x08,0x8d,0x02,0x00,0xf8,0x00,0x01,0xa6,0x08,0x41,
+0xf8,0x20,0x04,0xdf,0x10,0x01,0x17,0x3f,0x5b,0x0a,0x04,0x90,0x00,0x17,0xf9,0x1a,
+0x08,0x10,0x50,0x78,0x01,0x15,0xaf,0x90,0x07,0x06,0xb1,0x02,0x21,0x80,0x00,0xc3,
+0x07,0x01,0x9c,0x00,0x11,0xf7,0x89,0x00,0x12,0xa0,0x9c,0x00,0x22,0x20,0x1f,0x84,
+0x00,0x01,0x58,0x01,0x16,0x6f,0x1d,0x0d,0x27,0xf0,0xaf,0x8d,0x0c,0x16,0xbf,0xa5,
+0x0c,0x26,0xf4,0xbf,0x18,0x00,0x23,0xf4,0xaf,0x30,0x00,0x12,0xcf,0x48,0x08,0x13,
+0xfc,0xd8,0x00,0x01,0x3b,0x08,0x12,0xa0,0xd9,0x04,0x30,0xb0,0x0c,0xff,0x78,0x00,
+0x11,0x8c,0x9e,0x00,0x18,0x03,0xa3,0x09,0x16,0x6f,0x0d,0x04,0x05,0xa6,0x05,0x10,
+0xfc,0xe7,0x01,0x12,0x2a,0x74,0x01,0x15,0x70,0x8c,0x01,0x50,0xc9,0x50,0x00,0x00,
+0x00,0x91,0x00,0x00,0x00,0x05,0xad,0xff,0xed,0x94,0x00,0x01,0x00,0x71,0x06,0xef,
+0xff,0xff,0xff,0xff,0xd4,0x0c,0x00,0x21,0xbf,0xff,0x01,0x00,0x62,0x80,0x00,0x00,
+0x00,0x0c,0xff,0x01,0x00,0x16,0xf9,0x17,0x00,0x50,0xff,0xff,0x60,0x00,0x05,0x07,
+0x00,0xf0,0x00,0xa8,0xaf,0xff,0xff,0xff,0xf1,0x00,0x0d,0xff,0xff,0xff,0xc1,0x00,
+0x01,0xcf,0x25,0x00,0xf0,0x01,0x4f,0xff,0xff,0xfe,0x00,0x00,0x00,0x0e,0xff,0xff,
+0xff,0x00,0x9f,0xff,0xff,0xf6,0x59,0x00,0xf0,0x05,0xff,0xff,0xff,0x50,0xcf,0xff,
+0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xff,0xff,0x90,0xef,0xff,0xff,0xd0,0x66,0x00,
+0x80,0xef,0xff,0xff,0xc0,0xff,0xff,0xff,0xc0,0x0c,0x00,0x52,0xcf,0xff,0xff,0xe0,
+0xff,0x18,0x00,0x00,0x67,0x00,0x22,0xf0,0xdf,0x30,0x00,0x01,0x0c,0x00,0x44,0xbf,
+0xff,0xff,0xf3,0x0c,0x00,0x43,0x8f,0xff,0xff,0xfb,0x48,0x00,0x90,0xf0,0x3f,0xff,
+0xff,0xff,0x70,0x00,0x00,0x2d,0x0c,0x00,0x00,0x84,0x00,0x40,0xfb,0x53,0x59,0xff,
+0x0c,0x00,0x25,0x05,0xff,0x01,0x00,0x35,0xe0,0x00,0x9f,0x0c,0x00,0x31,0xd0,0x00,
+0x0a,0x08,0x00,0x80,0xfd,0xff,0xff,0xff,0xa0,0x00,0x00,0x7f,0x0c,0x00,0x12,0xa1,
+0x43,0x00,0xb2,0x01,0x6b,0xdf,0xfd,0x93,0x03,0xff,0xff,0xff,0x30,0x00,0x01,0x00,
+0x10,0x09,0xc0,0x00,0x03,0x01,0x00,0x12,0x2f,0xfd,0x00,0x13,0x00,0xa7,0x00,0x13,
+0xf2,0x0b,0x00,0x12,0x2c,0x47,0x00,0x00,0x01,0x00,0x10,0x39,0x4b,0x00,0x70,0x10,
+0x00,0x00,0x00,0x0a,0xbc,0xdf,0x0b,0x00,0x23,0xf5,0x00,0x03,0x01,0x02,0x5e,0x00,
+0x04,0x0c,0x00,0x25,0xf7,0x00,0x0c,0x00,0x25,0xfd,0x40,0x0c,0x00,0x33,0xfd,0x60,
+0x00,0x0c,0x00,0x23,0xed,0xa7,0x7f,0x00,0x90,0x5c,0xfe,0x91,0x00,0x5f,0xff,0xff,
+0xd0,0x0e,0x6b,0x01,0x00,0x7c,0x01,0x10,0x0f,0x49,0x00,0x10,0x9f,0x7c,0x00,0x8f,
+0x9f,0xff,0xd3,0x00,0x00,0x03,0x20,0x00,0x01,0x00,0x1b,0x20,0x01,0x32,0xd3,0x00,
+0x30,0xfe,0x30,0x08,0xa8,0x00,0x00,0x8a,0x00,0x13,0x0f,0x88,0x01,0xe1,0xf6,0x06,
+0xff,0xff,0xfd,0x00,0x04,0xcf,0xe9,0x10,0x00,0x09,0xef,0xd6,0xe0,0x00,0x20,0x80,
+0x04,0x44,0x01,0x60,0x07,0xff,0xff,0xff,0xf2,0x05,0xdf,0x01,0x00,0xa7,0x01,0xbf,
+0xb0,0x00,0x2c,0xff,0xfa,0x10,0x00,0x00,0x23,0x10,0x00,0x01,0x00,0x2a,0x60,0x03,
+0x33,0x33,0x10,0x00,0x3f,0x59,0x02,0x0e,0x05,0x00,0x10,0x70,0x05,0x00,0x10,0x60,
+0xf8,0x00,0x30,0x40,0x00,0x8f,0x7e,0x01,0x80,0xdf,0xff,0xfb,0x00,0x03,0xff,0xff,
+0xf4,0xb7,0x01,0x10,0xb0,0x1d,0x00,0x31,0x20,0x00,0x4e,0x51,0x02,0x2f,0x7e,0x70,
+0x62,0x00,0x08,0x14,0x96,0x0a,0x00,0x23,0x5c,0xff,0x27,0x00,0x23,0x17,0xef,0x7a,
+0x01,0x24,0x03,0xaf,0x90,0x01,0x14,0x5c,0x8f,0x01,0x23,0x17,0xef,0xa5,0x01,0x22,
+0x03,0xaf,0xaf,0x01,0x32,0xe4,0x00,0x5c,0x09,0x00,0x32,0xfa,0x40,0x06,0x1c,0x00,
+0x23,0xfb,0x60,0xf9,0x02,0xb4,0xfd,0x71,0x00,0x00,0x00,0x0b,0xff,0xff,0xff,0xfe,
+0x83,0x25,0x03,0x12,0xfb,0x10,0x01,0x10,0x0b,0x1f,0x00,0x17,0xb5,0x3a,0x03,0x13,
+0xa4,0x6e,0x00,0x00,0x2d,0x00,0x62,0x93,0x00,0x00,0x00,0x18,0xef,0x0c,0x00,0x52,
+0x82,0x00,0x00,0x00,0x6d,0x60,0x00,0x16,0xf6,0x23,0x00,0x24,0x70,0x00,0x23,0x00,
+0x12,0xf7,0xb2,0x00,0x14,0x6c,0x15,0x00,0x01,0x23,0x00,0x03,0x15,0x00,0x00,0x23,
+0x00,0x06,0xf9,0x00,0x34,0x54,0x79,0x99,0x01,0x00,0x25,0x91,0xdf,0xe3,0x02,0x1f,
+0xf2,0x0b,0x00,0x19,0x0f,0xb9,0x01,0x19,0x0f,0x6e,0x00,0x2f,0x25,0x2b,0x40,0x4d,
+0x00,0x35,0x3f,0xfd,0x71,0x0b,0x00,0x36,0xff,0xff,0x92,0x0b,0x00,0x26,0xff,0xc5,
+0x0b,0x00,0x35,0xff,0xe7,0x10,0x0b,0x00,0x20,0xff,0xfa,0x19,0x03,0x12,0x1c,0x4a,
+0x00,0x10,0xfc,0x30,0x03,0x26,0x28,0xdf,0x51,0x01,0x22,0x03,0x8e,0x19,0x00,0x10,
+0xb1,0x30,0x00,0x11,0x49,0x6a,0x01,0x11,0xf3,0x47,0x00,0x25,0x05,0xaf,0x0b,0x00,
+0x34,0x00,0x05,0xef,0x0b,0x00,0x23,0x49,0xef,0x16,0x00,0x33,0x02,0x8e,0xff,0x2c,
+0x00,0x13,0x17,0x4e,0x00,0x42,0x70,0x01,0x6c,0xff,0xf4,0x01,0x33,0x50,0x00,0x2f,
+0xf7,0x04,0x14,0x20,0x84,0x00,0x15,0xd6,0x8f,0x00,0x14,0xb4,0xa5,0x00,0x24,0xfe,
+0x82,0xb0,0x00,0x24,0xfd,0x60,0xc6,0x00,0x24,0xfa,0x30,0xdc,0x00,0x28,0x28,0x10,
+0x82,0x03,0x51,0x6a,0xde,0xff,0xec,0x84,0x0b,0x00,0x24,0x8f,0xff,0x69,0x05,0x24,
+0x2d,0xff,0x68,0x05,0x14,0x01,0x2a,0x01,0x35,0xf7,0x00,0x0a,0x34,0x01,0x20,0x20,
+0x2f,0x8b,0x00,0x20,0x9b,0xef,0xac,0x03,0x51,0x8f,0xff,0xff,0xfe,0x30,0x1c,0x00,
+0x22,0xe0,0xcf,0x61,0x04,0x15,0xef,0x26,0x05,0x00,0x75,0x02,0x90,0xf2,0x56,0x66,
+0x66,0x50,0x00,0x00,0x00,0xaf,0xb2,0x03,0x02,0x01,0x00,0x03,0x43,0x05,0x00,0x22,
+0x01,0x06,0xab,0x04,0x42,0x1d,0xff,0xff,0xff,0x8a,0x01,0x00,0xb0,0x05,0x16,0xfb,
+0x15,0x00,0x11,0xd1,0x0a,0x00,0x52,0x02,0xef,0xff,0xff,0xfe,0x5e,0x04,0x00,0x52,
+0x05,0x11,0xd2,0x20,0x00,0x00,0x44,0x05,0x22,0xfd,0x10,0x35,0x00,0x05,0x2a,0x00,
+0x01,0xd7,0x05,0x03,0x88,0x04,0x16,0x0a,0x22,0x05,0x13,0x0c,0xfe,0x04,0x02,0x41,
+0x00,0x13,0xf3,0x0b,0x00,0x4f,0x04,0x55,0x55,0x50,0x61,0x02,0x0b,0x25,0x02,0x30,
+0xc2,0x03,0x33,0xdf,0xff,0x80,0x0b,0x00,0x43,0x1e,0xff,0xff,0xf8,0x0b,0x00,0x12,
+0x6f,0x58,0x06,0x04,0x40,0x01,0x0e,0x16,0x00,0x12,0x0d,0x53,0x03,0x01,0xa5,0x00,
+0x29,0xae,0xfd,0x6e,0x00,0x69,0x36,0x9b,0xcd,0xcb,0xa8,0x51,0x6f,0x00,0x26,0x28,
+0xef,0x4c,0x02,0x04,0x82,0x00,0x14,0xaf,0x78,0x01,0x15,0xe7,0x14,0x00,0x16,0x07,
+0x4a,0x06,0x14,0xfc,0x74,0x05,0xa5,0x1b,0xff,0xff,0xff,0xd8,0x52,0x10,0x01,0x36,
+0xae,0x30,0x06,0x00,0x9b,0x02,0x22,0xfc,0x40,0x16,0x01,0x14,0xdf,0x60,0x01,0x15,
+0x0d,0x0a,0x01,0x00,0xb3,0x00,0x23,0xfe,0x10,0x29,0x04,0x03,0x53,0x01,0x01,0xbd,
+0x00,0x13,0xfc,0x64,0x00,0x16,0xd1,0x86,0x00,0x11,0x7f,0x35,0x00,0x1a,0x02,0x9f,
+0x03,0x31,0xbf,0xff,0xe0,0x06,0x00,0x12,0xf5,0xdf,0x00,0x22,0x21,0x00,0x23,0x00,
+0x10,0x50,0x7a,0x02,0x11,0xfb,0xde,0x02,0x41,0xbf,0xff,0xfe,0xa4,0x89,0x01,0x11,
+0xfb,0x8e,0x01,0x13,0x20,0xa0,0x06,0x21,0xff,0xfc,0xbf,0x02,0x30,0xf1,0x00,0x01,
+0x43,0x05,0x32,0x00,0x00,0x4f,0xcc,0x00,0x10,0x30,0x3e,0x02,0x55,0x40,0x00,0x6f,
+0xff,0xf4,0x62,0x03,0x20,0xff,0xf3,0x39,0x00,0x52,0xf8,0x00,0x0b,0xff,0xfe,0xbc,
+0x00,0x31,0xe6,0x20,0x1b,0x48,0x00,0x41,0x7f,0xff,0xb0,0x00,0x3e,0x02,0x70,0x08,
+0xff,0xff,0xe1,0x00,0x00,0xaf,0x54,0x02,0x71,0x05,0xff,0xfd,0x00,0x4f,0xff,0xf5,
 0x0f,0x02,0x11,0xf3,0xf4,0x01,0x01,0x48,0x00,0x23,0xe0,0x07,0x32,0x00,0x11,0xfa,
 0x7e,0x02,0x11,0xd0,0x79,0x02,0x02,0x32,0x00,0x11,0x0d,0x16,0x01,0x31,0x0f,0xff,
-0xfc,0x50,0x07,0x20,0xf0,0x0c,0xb1,0x09,0x12,0x02,0xa0,0x02,0x01,0x5d,0x00,0x00,
-0x29,0x00,0x10,0xdf,0x0a,0x08,0x13,0x6f,0x23,0x00,0x11,0xf9,0x52,0x00,0x41,0xf0,
-0x0e,0xff,0xfa,0x8d,0x07,0x11,0x90,0x23,0x00,0x12,0x80,0x7b,0x00,0x01,0x32,0x00,
-0x11,0xbf,0x18,0x05,0x11,0x5f,0xf5,0x01,0x10,0x7f,0xb3,0x1a,0x11,0xf9,0x89,0x00,
-0x11,0x60,0x99,0x02,0x12,0x50,0xcd,0x00,0x01,0x29,0x00,0x11,0xdf,0x23,0x00,0x02,
-0xc8,0x20,0x10,0xef,0x39,0x0a,0x11,0xfb,0x29,0x00,0x02,0x0d,0x0a,0x10,0x20,0x14,
-0x01,0x50,0xf1,0x00,0xcf,0xff,0xc0,0x52,0x00,0x14,0xfb,0x16,0x1d,0x00,0x8c,0x21,
-0x01,0x0a,0x01,0x10,0x07,0xe1,0x00,0x20,0x02,0xef,0xbe,0x00,0x10,0x06,0x38,0x01,
-0x31,0x8f,0xff,0xf2,0x11,0x08,0x21,0xf7,0x58,0x5b,0x09,0x10,0x06,0x9a,0x00,0x11,
-0x05,0x70,0x00,0x14,0xbf,0xb1,0x1e,0x11,0xdf,0x28,0x01,0x10,0x1f,0xb9,0x00,0x11,
-0x02,0x14,0x00,0x11,0x56,0x06,0x00,0x11,0xe2,0x14,0x01,0x12,0xf1,0xe9,0x13,0x34,
-0xfe,0x50,0x07,0xb2,0x04,0x11,0x07,0xd7,0x00,0xb3,0x01,0x8d,0xff,0xc7,0x10,0x00,
-0x03,0xad,0xfe,0xd9,0x30,0x88,0x0c,0x0e,0x6a,0x07,0x18,0x9f,0x0c,0x21,0x06,0x12,
-0x0c,0x1d,0xf9,0x15,0x00,0x18,0x06,0xaa,0x12,0x07,0xa6,0x12,0x23,0xfd,0x40,0xea,
-0x02,0x18,0x00,0xd6,0x0b,0x20,0xd7,0x20,0x13,0x00,0x15,0x7c,0x7d,0x0c,0x02,0x81,
-0x04,0x47,0xec,0xba,0xab,0xcf,0x17,0x10,0x03,0xcf,0x16,0x08,0x48,0x21,0x00,0x7e,
-0x00,0x16,0x8e,0x11,0x0a,0x16,0x00,0x2b,0x00,0x02,0x27,0x1c,0x2a,0xb6,0x10,0xaa,
-0x00,0x4b,0x45,0x67,0x76,0x52,0x94,0x00,0x1b,0x5f,0xbe,0x00,0x16,0x0b,0x88,0x21,
-0x05,0x6e,0x04,0x09,0xf6,0x22,0x15,0x6f,0x12,0x0e,0x07,0x36,0x21,0x17,0xf1,0xc4,
-0x03,0x07,0xda,0x13,0x06,0x6c,0x05,0x05,0x71,0x0d,0x04,0x89,0x09,0x16,0xf3,0x25,
-0x19,0x06,0x64,0x16,0x05,0xcf,0x0c,0x17,0xd9,0xf9,0x0d,0x00,0x8a,0x01,0x27,0xf7,
-0x3f,0xca,0x03,0x13,0x06,0xdd,0x1a,0x17,0xb0,0x12,0x0a,0x27,0xd0,0x08,0x4e,0x0d,
-0x10,0x2f,0x22,0x01,0x16,0x3f,0x27,0x01,0x01,0x0e,0x1b,0x01,0x68,0x18,0x08,0xe2,
-0x0f,0x16,0x08,0x3c,0x04,0x14,0x4f,0x87,0x0c,0x16,0xf9,0x7f,0x01,0x11,0x20,0xbe,
-0x05,0x15,0xe0,0x05,0x01,0x12,0xd0,0x48,0x00,0x18,0x50,0xc8,0x0d,0x14,0x2f,0x0b,
-0x01,0x16,0x0c,0x7a,0x21,0x14,0xf1,0x05,0x01,0x00,0x0c,0x12,0x14,0xbe,0x0b,0x01,
-0x07,0x0d,0x10,0x17,0xfd,0x9a,0x0a,0x05,0x0b,0x01,0x05,0xdd,0x11,0x04,0x0b,0x01,
-0x19,0xaf,0x23,0x28,0x17,0x00,0x81,0x12,0x02,0xdd,0x0a,0x15,0x06,0x01,0x0e,0x15,
-0x08,0xeb,0x15,0x16,0xf7,0x5f,0x14,0x15,0x10,0x0d,0x22,0x02,0x96,0x00,0x11,0xf7,
-0x27,0x00,0x16,0xc0,0x10,0x01,0x10,0xd0,0x05,0x01,0x17,0xf7,0x91,0x14,0x26,0x30,
-0x4f,0x3c,0x0f,0x00,0x32,0x00,0x27,0xf9,0x0a,0x39,0x12,0x10,0x07,0x16,0x02,0x03,
-0x8d,0x00,0x20,0xdc,0x96,0x68,0x01,0x06,0xf4,0x0c,0x17,0x30,0x0d,0x00,0x02,0x4f,
-0x28,0x16,0xff,0xd0,0x0d,0x09,0xb5,0x00,0x00,0xb0,0x03,0x32,0xbb,0xbb,0xcd,0xd3,
-0x00,0x03,0x36,0x02,0x01,0xd5,0x02,0x14,0x30,0x43,0x02,0x01,0xb6,0x2a,0x04,0x0d,
-0x00,0x10,0x09,0x0b,0x01,0x04,0x0d,0x00,0x18,0x06,0x0d,0x00,0x10,0x07,0xb1,0x07,
-0x04,0x0d,0x00,0x01,0x41,0x23,0x04,0x0d,0x00,0x16,0x4f,0x5b,0x00,0x24,0x01,0x39,
-0x75,0x00,0x06,0x2f,0x0e,0x06,0x0c,0x00,0x18,0xe6,0xa9,0x00,0x18,0x71,0x0d,0x00,
-0x28,0xfe,0x50,0x34,0x00,0x20,0xf7,0x00,0x3a,0x09,0x58,0x11,0x11,0x11,0x25,0xcf,
-0xa9,0x00,0x10,0x0a,0x75,0x01,0x04,0x0d,0x00,0x01,0xe3,0x27,0x04,0x06,0x03,0x00,
-0x89,0x01,0x15,0xf4,0x0d,0x00,0x00,0x9b,0x0f,0x08,0x0d,0x00,0x15,0xf5,0x0d,0x00,
-0x17,0xef,0x27,0x00,0x01,0xea,0x0b,0x03,0x0d,0x00,0x20,0x01,0x8f,0x9e,0x01,0x00,
-0x71,0x09,0x41,0xaa,0xaa,0xaa,0xcf,0x4c,0x03,0x09,0x0b,0x02,0x09,0x39,0x02,0x27,
-0xff,0xff,0x15,0x14,0x06,0x0c,0x00,0x15,0x80,0xd0,0x00,0x24,0xee,0xc8,0xbc,0x03,
-0x08,0x3b,0x18,0x22,0x00,0x07,0x4b,0x04,0x14,0xc5,0xee,0x07,0x07,0xbe,0x09,0x15,
-0x5f,0x46,0x00,0x19,0x20,0x97,0x02,0x13,0xe2,0x78,0x0f,0x23,0xfe,0xde,0x13,0x26,
-0x10,0xaf,0x0f,0x24,0x44,0x00,0x00,0x15,0xdf,0x04,0x0f,0x14,0xf9,0x40,0x04,0x15,
-0xd0,0x3b,0x02,0x10,0x01,0xd9,0x00,0x14,0x0f,0x69,0x03,0x00,0xc5,0x08,0x25,0xf7,
-0x4f,0x0d,0x04,0x00,0xe9,0x12,0x15,0x8f,0x74,0x03,0x57,0x2c,0xcc,0xcc,0xca,0xbf,
-0xc9,0x10,0x01,0x85,0x02,0x28,0xf4,0x00,0xff,0x11,0x06,0x34,0x04,0x01,0x95,0x01,
-0x0f,0x0e,0x00,0x21,0x0a,0x46,0x00,0x0a,0x62,0x00,0x0a,0x7e,0x00,0x15,0x8f,0xf9,
-0x08,0x55,0x29,0x99,0x99,0x97,0x4f,0xde,0x11,0x00,0xb6,0x00,0x14,0x1f,0x2b,0x03,
-0x00,0xd2,0x00,0x24,0xf8,0x0a,0xdb,0x09,0x10,0x01,0x94,0x01,0x14,0x03,0xa0,0x05,
-0x02,0x4a,0x05,0x12,0xcf,0x63,0x2a,0x01,0xd7,0x14,0x12,0x70,0xd2,0x0a,0x23,0xed,
-0xcd,0x07,0x04,0x19,0x05,0x5e,0x01,0x16,0x00,0xf2,0x16,0x18,0x30,0xee,0x05,0x17,
-0xc2,0x97,0x1b,0x24,0xff,0xc6,0xe1,0x05,0x05,0xce,0x01,0x02,0x18,0x00,0x24,0xeb,
-0x84,0x85,0x12,0x02,0xbc,0x01,0x28,0x71,0x00,0xa4,0x03,0x19,0xe5,0x41,0x04,0x00,
-0x99,0x06,0x09,0x57,0x1a,0x00,0x1b,0x00,0x33,0xcb,0xbb,0xde,0x63,0x10,0x02,0x88,
-0x02,0x21,0x03,0x9f,0x3e,0x03,0x13,0x0f,0x57,0x05,0x11,0x3e,0xcd,0x00,0x16,0xff,
-0x17,0x24,0x24,0xff,0x70,0x1b,0x00,0x02,0x9a,0x1e,0x09,0xd8,0x02,0x05,0x1b,0x00,
-0x18,0x09,0xa9,0x03,0x00,0x3b,0x01,0x15,0xfc,0x1b,0x00,0x13,0x02,0x53,0x04,0x24,
-0xf1,0x00,0xf9,0x03,0x15,0x0f,0xc3,0x05,0x09,0x50,0x03,0x00,0x17,0x00,0x18,0x2f,
-0x1b,0x00,0x19,0xf2,0x1b,0x00,0x14,0x1f,0x1b,0x00,0x01,0x90,0x10,0x05,0x1b,0x00,
-0x18,0x2f,0x51,0x00,0x22,0x06,0xff,0xe7,0x10,0x14,0xf1,0xb4,0x01,0x15,0xf9,0x1b,
-0x00,0x18,0x0f,0x3e,0x04,0x01,0xe7,0x04,0x04,0x1b,0x00,0x01,0xdb,0x26,0x04,0xd8,
-0x00,0x01,0x32,0x08,0x13,0x10,0x1b,0x00,0x12,0x29,0x6f,0x07,0x01,0xe4,0x05,0x22,
-0xbc,0xef,0xe9,0x04,0x07,0xa0,0x05,0x18,0xc0,0x5f,0x01,0x29,0xb0,0x00,0x3c,0x18,
-0x06,0x1b,0x00,0x25,0xf8,0x10,0x95,0x01,0x22,0xfe,0xb9,0x16,0x08,0x07,0xdb,0x03,
-0x17,0xef,0xda,0x03,0x0f,0x17,0x00,0x13,0x12,0xcb,0x7b,0x18,0x17,0xba,0x8e,0x07,
-0x17,0x0f,0x14,0x07,0x0f,0x17,0x00,0x2a,0x11,0x98,0xa6,0x15,0x27,0x85,0x00,0xa3,
-0x06,0x06,0xd5,0x00,0x1f,0xf9,0x17,0x00,0x14,0x0f,0x8a,0x00,0x32,0x0f,0x17,0x00,
-0x0f,0x03,0x83,0x19,0x2e,0xbb,0xaf,0x42,0x01,0x0f,0x59,0x01,0x1f,0x26,0x4f,0xff,
-0x7c,0x25,0x0f,0x17,0x00,0x13,0x03,0x87,0x01,0x1f,0xb3,0xe6,0x00,0x53,0x1f,0x60,
-0x87,0x01,0x1f,0x07,0x17,0x00,0x0f,0xa1,0x00,0x49,0x0f,0x17,0x00,0x2f,0x02,0x55,
-0x30,0x44,0xdf,0xff,0xec,0x96,0x12,0x00,0x03,0xb7,0x11,0x16,0xa3,0x81,0x2b,0x05,
-0xa2,0x2b,0x09,0x84,0x15,0x03,0x84,0x0a,0x05,0x34,0x15,0x01,0xe0,0x06,0x22,0xdb,
-0xce,0x42,0x27,0x01,0x8b,0x09,0x51,0xe6,0x10,0x00,0x02,0x9f,0x06,0x09,0x14,0x1f,
-0x4e,0x0f,0x10,0x5f,0x78,0x05,0x01,0x89,0x07,0x05,0x25,0x04,0x00,0x39,0x00,0x15,
-0xf8,0xd5,0x0a,0x16,0xc0,0x52,0x09,0x58,0x0c,0xee,0xee,0xed,0x05,0x82,0x17,0x01,
-0x56,0x00,0x19,0xfa,0xea,0x0b,0x07,0x7a,0x17,0x0b,0x5a,0x06,0x12,0x0c,0x0a,0x04,
-0x21,0x01,0x33,0x01,0x00,0x13,0x30,0x4c,0x10,0x03,0x39,0x16,0x16,0x0c,0xfa,0x2f,
-0x00,0xd0,0x04,0x00,0x19,0x1a,0x06,0x1d,0x00,0x12,0x0b,0x3a,0x00,0x04,0x1d,0x00,
-0x03,0x3e,0x1a,0x03,0x1d,0x00,0x16,0x08,0x62,0x10,0x12,0xff,0x5f,0x23,0x16,0xfe,
-0x55,0x01,0x16,0x01,0x73,0x0b,0x04,0xab,0x15,0x15,0xa0,0x1d,0x00,0x01,0x7a,0x06,
-0x15,0x40,0x1d,0x00,0x14,0x01,0x83,0x06,0x01,0x1d,0x01,0x02,0x81,0x0f,0x13,0x92,
-0x71,0x20,0x12,0xf0,0xf0,0x0b,0x31,0xfe,0xcb,0xbd,0x74,0x00,0x07,0x8c,0x17,0x02,
-0xec,0x04,0x18,0x2d,0xfd,0x09,0x04,0x69,0x18,0x02,0x55,0x09,0x00,0x84,0x08,0x19,
-0xbf,0xc6,0x06,0x00,0x45,0x2c,0x15,0xff,0x4f,0x0a,0x15,0xf1,0x79,0x12,0x1f,0xfd,
-0x0e,0x00,0x98,0x03,0x89,0x03,0x12,0xcf,0x0e,0x00,0x07,0xe6,0x0b,0x0f,0x0e,0x00,
-0x28,0x0e,0x0a,0x01,0x0f,0x0e,0x00,0xaa,0x00,0x4a,0x09,0x0f,0x04,0x00,0x71,0x07,
-0xf1,0x14,0x1f,0xfd,0x0c,0x00,0xf5,0x44,0x07,0x77,0x77,0x77,0x0c,0x00,0x04,0x7d,
-0x05,0x00,0xa7,0x09,0x01,0xc6,0x38,0x03,0x07,0x05,0x13,0x0b,0x59,0x24,0x12,0xff,
-0xac,0x18,0x00,0x49,0x01,0x10,0x3d,0xe2,0x01,0x11,0x01,0x09,0x0c,0x12,0xbd,0xb2,
-0x0e,0x04,0xbd,0x0a,0x00,0x66,0x13,0x18,0x0b,0xda,0x0e,0x15,0xaf,0xa0,0x0c,0x04,
-0xdd,0x1f,0x03,0x1a,0x05,0x68,0x04,0x8c,0xef,0xff,0xda,0x61,0xfc,0x03,0x18,0x8f,
-0xdd,0x09,0x11,0x04,0x79,0x10,0x04,0x0e,0x00,0x18,0x2e,0x8d,0x09,0x01,0x55,0x0b,
-0x14,0xb0,0x0e,0x00,0x12,0x0a,0x4d,0x0b,0x03,0x0e,0x00,0x12,0x6f,0xc2,0x05,0x03,
-0xc5,0x0a,0x03,0x85,0x34,0x02,0x0e,0x00,0x13,0x1e,0x2d,0x06,0x02,0x0e,0x00,0x04,
-0x42,0x20,0x01,0x0e,0x00,0x14,0x08,0x98,0x0f,0x01,0x0e,0x00,0x14,0x4f,0x06,0x06,
-0x01,0xe6,0x00,0x14,0xef,0x1d,0x05,0x00,0x0e,0x00,0x15,0x0c,0x7e,0x11,0x00,0x0e,
-0x00,0x15,0x8f,0x7a,0x20,0x00,0x2d,0x0b,0x06,0xe7,0x10,0x07,0x69,0x0b,0x07,0xd7,
-0x09,0x19,0x50,0x0e,0x00,0x19,0xe1,0x0e,0x00,0x1a,0xfa,0x01,0x0a,0x15,0x40,0x0e,
-0x00,0x14,0xaf,0x2b,0x00,0x01,0x26,0x00,0x14,0x08,0x67,0x0d,0x02,0x6f,0x05,0x13,
-0xdf,0x2b,0x00,0x02,0x91,0x0d,0x13,0x3f,0xbb,0x11,0x02,0xe0,0x00,0x13,0x09,0x2b,
-0x00,0x03,0x18,0x01,0x18,0xef,0x0a,0x01,0x22,0x00,0x4f,0xbd,0x06,0x07,0x42,0x01,
-0x05,0xf9,0x0b,0x02,0x41,0x26,0x15,0x30,0x6c,0x01,0x11,0x6f,0x2b,0x00,0x04,0x0e,
-0x00,0x19,0x0b,0x3c,0x08,0x28,0x02,0xff,0x14,0x0f,0x23,0x00,0x7f,0xba,0x0e,0x15,
-0xf1,0xe7,0x06,0x1f,0xf8,0x66,0x08,0x8e,0x0f,0x17,0x00,0x91,0x04,0xd3,0x0a,0x07,
-0x64,0x0c,0x17,0xf0,0x33,0x06,0x0f,0x17,0x00,0x14,0x18,0xf6,0xc9,0x34,0x19,0xff,
-0xd8,0x35,0x17,0xdf,0x56,0x38,0x07,0xc5,0x13,0x08,0xca,0x13,0x07,0xb3,0x3a,0x18,
-0xd0,0x7a,0x26,0x08,0xcd,0x13,0x19,0x3f,0x08,0x12,0x1a,0x00,0x20,0x22,0x15,0xfe,
-0x81,0x0f,0x0a,0xe6,0x02,0x06,0x63,0x10,0x12,0xbf,0x05,0x14,0x00,0x8f,0x02,0x12,
-0xfb,0x12,0x00,0x12,0x7f,0x81,0x13,0x00,0x10,0x01,0x12,0xe7,0x12,0x00,0x12,0x79,
-0x08,0x14,0x00,0xa4,0x04,0x12,0x98,0x12,0x00,0x12,0x83,0x3d,0x03,0x00,0xd0,0x03,
-0x13,0x38,0xe7,0x0a,0x10,0xdf,0x3e,0x01,0x00,0xb0,0x04,0x23,0xfd,0x09,0x8b,0x08,
-0x14,0x8f,0x38,0x09,0x23,0xf7,0x0a,0x12,0x00,0x11,0x2f,0xba,0x03,0x00,0x18,0x27,
-0x03,0xae,0x04,0x00,0xd3,0x1f,0x11,0xf1,0xf3,0x08,0x23,0xc0,0x0b,0xc8,0x0d,0x00,
-0x30,0x00,0x01,0x2f,0x01,0x23,0x60,0x0c,0x12,0x00,0x01,0xc1,0x35,0x00,0x2f,0x01,
-0x04,0xfe,0x00,0x10,0xd0,0x78,0x00,0x31,0x20,0x02,0xff,0x22,0x3d,0x02,0xef,0x1e,
-0x00,0x9c,0x00,0x20,0x80,0x08,0x6b,0x0a,0x14,0x0e,0x12,0x00,0x12,0x0f,0x49,0x1e,
-0x14,0xe0,0x0b,0x0e,0x10,0xf0,0x9e,0x03,0x10,0xf3,0xcb,0x3d,0x05,0x12,0x00,0x00,
-0x08,0x01,0x20,0xf9,0x9f,0x79,0x03,0x03,0x12,0x00,0x11,0xf1,0x50,0x27,0x01,0x79,
-0x27,0x15,0x1f,0x12,0x00,0x13,0x8f,0xfe,0x15,0x06,0x12,0x00,0x13,0x2f,0x08,0x00,
-0x06,0x12,0x00,0x13,0x0c,0x84,0x0e,0x06,0x12,0x00,0x13,0x06,0x7c,0x0e,0x06,0x12,
-0x00,0x12,0x01,0xbd,0x09,0x07,0x12,0x00,0x10,0x00,0x5c,0x27,0x0a,0x12,0x00,0x12,
-0x5f,0x1e,0x11,0x07,0x12,0x00,0x12,0x0f,0x90,0x01,0x07,0x12,0x00,0x02,0x18,0x18,
-0x04,0x12,0x00,0x16,0xf6,0xa8,0x2b,0x02,0x0a,0x06,0x07,0x0e,0x00,0x29,0xff,0x90,
-0x0e,0x00,0x19,0xf3,0x0e,0x00,0x19,0xfd,0x0e,0x00,0x29,0xff,0x70,0x0e,0x00,0x19,
-0xf1,0x0e,0x00,0x19,0xfa,0x0e,0x00,0x29,0xff,0x40,0x0e,0x00,0x19,0xd0,0x0e,0x00,
-0x19,0xf8,0x0e,0x00,0x25,0xff,0x20,0x0e,0x00,0x12,0xf7,0xb8,0x05,0x03,0x0e,0x00,
-0x12,0xf1,0x82,0x0b,0x04,0x0e,0x00,0x02,0x42,0x23,0x04,0x0e,0x00,0x14,0x08,0x69,
-0x37,0x14,0xfc,0x89,0x1f,0x16,0xf2,0x0e,0x00,0x00,0x2a,0x07,0x06,0x0e,0x00,0x01,
-0x9e,0x0b,0x05,0x0e,0x00,0x10,0x02,0xb9,0x05,0x05,0x0e,0x00,0x00,0x46,0x02,0x16,
-0xf9,0x0e,0x00,0x12,0x0d,0xdd,0x02,0x03,0x0e,0x00,0x13,0x04,0x8f,0x03,0x03,0xec,
-0x00,0x19,0xaf,0x0e,0x00,0x19,0x1f,0x0e,0x00,0x19,0x06,0x0e,0x00,0x03,0x4f,0x3a,
-0x07,0x24,0x01,0x07,0x0e,0x00,0x19,0x09,0x0e,0x00,0x28,0x01,0xef,0x0e,0x00,0x29,
-0x00,0x6f,0x0e,0x00,0x19,0x0c,0x0e,0x00,0x19,0x02,0x0e,0x00,0x23,0x00,0x8f,0x29,
-0x04,0x65,0x02,0x7a,0xde,0xff,0xdb,0x72,0xb6,0x17,0x17,0xcf,0x42,0x14,0x05,0x9e,
-0x23,0x03,0x1b,0x3a,0x17,0x2d,0x96,0x14,0x08,0x92,0x2c,0x01,0xe7,0x12,0x16,0x0c,
-0x71,0x0f,0x13,0xfd,0x8e,0x04,0x42,0xf8,0x20,0x00,0x27,0x23,0x02,0x23,0x01,0xff,
-0xfd,0x1c,0x15,0x1d,0xdc,0x28,0x14,0xf2,0xbf,0x00,0x11,0xf9,0x51,0x03,0x15,0x80,
-0xc0,0x00,0x25,0x00,0x3f,0x27,0x05,0x01,0xaf,0x08,0x15,0x7f,0x99,0x18,0x01,0x3a,
-0x16,0x04,0x5c,0x27,0x02,0x35,0x01,0x16,0xb0,0x8e,0x2b,0x10,0x03,0x94,0x03,0x06,
-0x09,0x14,0x01,0x15,0x29,0x06,0x26,0x14,0x1a,0x01,0x0f,0x00,0x04,0x8c,0x12,0x0e,
-0x0f,0x00,0x05,0x2d,0x00,0x0b,0x4b,0x00,0x1a,0xdf,0x69,0x00,0x0a,0x87,0x00,0x1b,
-0xc0,0xa5,0x00,0x0a,0xc3,0x00,0x16,0x50,0xe1,0x00,0x00,0x8f,0x0e,0x0a,0xff,0x00,
-0x16,0xfa,0x1d,0x01,0x12,0x1c,0x41,0x03,0x10,0x7f,0xcb,0x02,0x42,0x10,0x00,0x16,
-0xef,0xa1,0x09,0x16,0x0c,0x9f,0x15,0x29,0xfe,0x10,0x77,0x01,0x19,0xf3,0x95,0x01,
-0x29,0xff,0x30,0xb3,0x01,0x19,0xc2,0xd1,0x01,0x15,0xd5,0xc8,0x19,0x58,0x7a,0xdf,
-0xff,0xeb,0x83,0x97,0x08,0x39,0xfd,0xb8,0x30,0x48,0x14,0x19,0xd6,0xb3,0x12,0x28,
-0xfc,0x10,0x04,0x13,0x28,0xfe,0x20,0xce,0x12,0x02,0x3a,0x13,0x42,0xcc,0xcc,0xcc,
-0xcd,0xc2,0x03,0x04,0x6a,0x08,0x14,0x7f,0x1f,0x16,0x14,0x10,0xeb,0x2d,0x18,0x90,
-0xa6,0x13,0x19,0xfd,0x2d,0x14,0x1f,0xf0,0x12,0x14,0x1e,0x18,0x05,0x36,0x00,0x00,
-0x0f,0x01,0x14,0xfb,0x51,0x00,0x23,0x05,0xef,0xd7,0x23,0x11,0xfc,0xbc,0x0d,0x00,
-0x3a,0x04,0x08,0x61,0x19,0x1a,0xf4,0xb8,0x18,0x07,0x1b,0x00,0x27,0xe4,0x00,0x67,
-0x17,0x15,0x81,0x0e,0x01,0x3b,0xfe,0xdb,0x84,0xc3,0x07,0x0c,0xcc,0x10,0x0f,0x1b,
-0x00,0x74,0x01,0x01,0x00,0x37,0x27,0xbd,0xff,0x0b,0x33,0x03,0xf9,0x01,0x18,0xc4,
-0xe2,0x3d,0x15,0xff,0x58,0x23,0x18,0x2e,0x0f,0x18,0x07,0x0f,0x00,0x02,0x10,0x00,
-0x1a,0x0d,0xcc,0x03,0x01,0x25,0x08,0x42,0x72,0x00,0x02,0x7f,0x7d,0x05,0x14,0x01,
-0x39,0x41,0x12,0x2d,0xc8,0x02,0x14,0x8f,0x61,0x08,0x11,0x2f,0xe7,0x02,0x15,0x0e,
-0x5e,0x08,0x01,0x42,0x16,0x16,0x04,0x9d,0x2c,0x01,0x83,0x01,0x06,0x52,0x11,0x11,
-0x0a,0x9a,0x30,0x06,0x8c,0x08,0x01,0x44,0x03,0x06,0xbc,0x17,0x14,0x04,0xbf,0x01,
-0x16,0x20,0xce,0x1a,0x07,0xf7,0x17,0x01,0x3c,0x02,0x07,0x06,0x01,0x13,0x1f,0x1f,
-0x00,0x17,0xf1,0xc3,0x03,0x0f,0x3e,0x00,0x0c,0x16,0x0d,0x7a,0x29,0x01,0xbf,0x18,
-0x15,0xbf,0x3b,0x1b,0x10,0x07,0x5b,0x04,0x16,0x08,0x80,0x32,0x01,0xee,0x03,0x15,
-0x4f,0x1e,0x21,0x01,0x5e,0x16,0x06,0x6a,0x1b,0x01,0xd0,0x41,0x0c,0xd5,0x04,0x01,
-0x72,0x00,0x14,0xd1,0xc6,0x31,0x12,0x10,0x27,0x01,0x04,0xd7,0x03,0x14,0x80,0x9e,
-0x09,0x24,0xed,0xef,0xe0,0x06,0x00,0x0b,0x1f,0x08,0x44,0x0c,0x06,0x10,0x00,0x17,
-0xd2,0x11,0x2d,0x07,0x8f,0x41,0x18,0x4c,0x87,0x28,0x00,0x31,0x00,0x44,0x7b,0xdf,
-0xfe,0xdf,0x9d,0x05,0x26,0x00,0x00,0xb2,0x05,0x1a,0x60,0x07,0x1e,0x08,0xc2,0x12,
-0x16,0x08,0x75,0x22,0x04,0xb1,0x2a,0x19,0xc1,0x3c,0x22,0x2a,0xdf,0xa0,0x6b,0x1e,
-0x15,0x70,0x29,0x03,0x39,0xed,0xa7,0x20,0x37,0x04,0x19,0xc4,0x37,0x04,0x19,0xfa,
-0xdb,0x1c,0x19,0xfc,0x05,0x17,0x13,0xfa,0x9a,0x18,0x25,0xbb,0xce,0xee,0x1a,0x14,
-0xf1,0x5f,0x44,0x15,0xa0,0xd2,0x01,0x18,0xcf,0xd0,0x01,0x19,0x02,0x52,0x04,0x18,
-0x0d,0xdd,0x17,0x00,0xb6,0x01,0x15,0xf5,0x1b,0x00,0x19,0x0b,0x1b,0x00,0x1c,0xef,
-0x88,0x04,0x18,0x00,0x79,0x0e,0x04,0x6c,0x00,0x2a,0x03,0x8f,0x75,0x1b,0x00,0x63,
-0x01,0x19,0x0f,0x4a,0x19,0x09,0x78,0x14,0x0e,0xf3,0x00,0x05,0x96,0x08,0x02,0xd8,
-0x00,0x13,0xbc,0x65,0x00,0x02,0x07,0x00,0x12,0x0e,0x24,0x09,0x03,0x6c,0x00,0x12,
-0x6f,0x92,0x02,0x03,0x22,0x00,0x15,0xdf,0x29,0x01,0x12,0x10,0xd7,0x04,0x05,0xe3,
-0x0e,0x01,0xe4,0x00,0x15,0xb0,0xe6,0x03,0x19,0x4f,0xbc,0x0d,0x01,0x5f,0x24,0x04,
-0x1b,0x00,0x14,0x04,0xd9,0x04,0x05,0xc9,0x0d,0x15,0xc0,0xf3,0x00,0x18,0x3f,0x6c,
-0x0f,0x28,0x00,0xbf,0x7b,0x05,0x14,0x03,0x4d,0x29,0x35,0x16,0xac,0xef,0x00,0x08,
-0x03,0xc9,0x13,0x02,0x71,0x23,0x05,0x2e,0x25,0x13,0xb1,0xb8,0x07,0x05,0x01,0x2b,
-0x18,0x0c,0x15,0x19,0x11,0x06,0x32,0x00,0x22,0xaa,0xcf,0x5a,0x02,0x02,0x10,0x1b,
-0x02,0xf2,0x2a,0x23,0x00,0x2f,0x1e,0x0f,0x01,0xa3,0x2e,0x01,0xcf,0x03,0x05,0x21,
-0x07,0x05,0x01,0x2d,0x00,0x5e,0x31,0x14,0x03,0x9d,0x20,0x69,0x01,0x55,0x55,0x55,
-0x40,0x0f,0x36,0x20,0x15,0x9f,0xbf,0x45,0x04,0xb6,0x20,0x29,0xfc,0x61,0x62,0x20,
-0x29,0xfc,0x61,0x70,0x20,0x29,0xfb,0x40,0x47,0x16,0x14,0xd4,0xb2,0x28,0x08,0xfd,
-0x04,0x28,0x03,0xaf,0xfd,0x45,0x02,0xcd,0x26,0x05,0xc3,0x34,0x00,0xf2,0x23,0x08,
-0x3d,0x21,0x19,0x3d,0x6a,0x1c,0x00,0x08,0x01,0x15,0x75,0x18,0x04,0x00,0x5f,0x30,
-0x05,0xf9,0x1c,0x10,0x04,0xac,0x2b,0x05,0x2d,0x00,0x00,0xd8,0x00,0x14,0x0c,0x30,
-0x1d,0x10,0x0c,0x6e,0x02,0x13,0x6f,0x8f,0x00,0x11,0x2b,0x52,0x0b,0x10,0xcf,0xaa,
+0xfc,0x50,0x07,0x41,0xf0,0x0c,0xff,0xfd,0xc2,0x00,0x00,0xa0,0x02,0x01,0x5d,0x00,
+0x00,0x29,0x00,0x10,0xdf,0x0a,0x08,0x13,0x6f,0x23,0x00,0x11,0xf9,0x52,0x00,0x41,
+0xf0,0x0e,0xff,0xfa,0x8d,0x07,0x11,0x90,0x23,0x00,0x12,0x80,0x7b,0x00,0x01,0x32,
+0x00,0x11,0xbf,0x18,0x05,0x10,0x5f,0xf5,0x01,0x00,0xa4,0x00,0x31,0x0f,0xff,0xf9,
+0x89,0x00,0x11,0x60,0x99,0x02,0x12,0x50,0xcd,0x00,0x01,0x29,0x00,0x11,0xdf,0x23,
+0x00,0x10,0x8f,0x8c,0x02,0x00,0xf6,0x00,0x31,0x0e,0xff,0xfb,0x29,0x00,0x11,0x70,
+0x95,0x00,0x10,0x20,0x14,0x01,0x30,0xf1,0x00,0xcf,0x7b,0x00,0x10,0xbf,0x1a,0x00,
+0x11,0x05,0x7a,0x01,0x32,0x0b,0xff,0xfa,0x0a,0x01,0x10,0x07,0xe1,0x00,0x20,0x02,
+0xef,0xbe,0x00,0x10,0x06,0x38,0x01,0x31,0x8f,0xff,0xf2,0x11,0x08,0x20,0xf7,0x58,
+0x5d,0x01,0x20,0x10,0x06,0x9a,0x00,0x11,0x05,0x70,0x00,0x02,0xf9,0x05,0x41,0xef,
+0xff,0xff,0xdf,0x28,0x01,0x10,0x1f,0xb9,0x00,0x11,0x02,0x14,0x00,0x11,0x56,0x06,
+0x00,0x10,0xe2,0x14,0x01,0x00,0x9c,0x03,0x10,0x03,0x63,0x03,0x24,0x50,0x07,0xb2,
+0x04,0x11,0x07,0xd7,0x00,0xa1,0x01,0x8d,0xff,0xc7,0x10,0x00,0x03,0xad,0xfe,0xd9,
+0x52,0x02,0x3e,0x1f,0xff,0xff,0x6a,0x07,0x3e,0x9f,0xff,0xfc,0xd9,0x07,0x07,0x9c,
+0x08,0x04,0x01,0x00,0x00,0xaa,0x00,0x1d,0xfa,0x15,0x00,0x15,0x0a,0x75,0x08,0x25,
+0x00,0x02,0x15,0x00,0x00,0xb9,0x06,0x20,0xd7,0x20,0x13,0x00,0x28,0x7c,0xf0,0x2a,
+0x00,0x66,0xff,0xff,0xec,0xba,0xab,0xcf,0x0f,0x09,0x02,0x40,0x05,0x04,0xa2,0x04,
+0x06,0x7e,0x00,0x16,0x8e,0x11,0x0a,0x16,0x00,0x2b,0x00,0x11,0xae,0x13,0x00,0x2a,
+0xb6,0x10,0xaa,0x00,0x4b,0x45,0x67,0x76,0x52,0x94,0x00,0x1b,0x5f,0xbe,0x00,0x11,
+0x0b,0xb2,0x09,0x09,0xde,0x00,0x01,0x5c,0x01,0x07,0x33,0x03,0x05,0xb4,0x04,0x04,
+0x6e,0x04,0x06,0xf0,0x04,0x02,0x15,0x03,0x06,0x3b,0x07,0x05,0x6c,0x05,0x16,0xfd,
+0x10,0x00,0x14,0x0e,0xec,0x02,0x04,0x99,0x04,0x02,0xbf,0x00,0x14,0x90,0x11,0x00,
+0x00,0x40,0x05,0x16,0xd9,0x55,0x04,0x01,0x8a,0x01,0x27,0xf7,0x3f,0xca,0x03,0x01,
+0xf6,0x04,0x01,0x12,0x09,0x06,0x12,0x0a,0x11,0xd0,0x57,0x09,0x06,0x2e,0x0a,0x36,
+0xf7,0x00,0x3f,0x27,0x01,0x11,0x08,0x27,0x05,0x13,0xdf,0xdb,0x0a,0x02,0xb8,0x05,
+0x36,0xd0,0x00,0x08,0x3c,0x04,0x11,0x4f,0x2c,0x00,0x15,0x3f,0x0b,0x01,0x12,0x0a,
+0x58,0x05,0x14,0xdf,0x0b,0x01,0x12,0x01,0x17,0x0b,0x15,0x08,0x0b,0x01,0x12,0x6f,
+0x5d,0x00,0x14,0x2f,0x0b,0x01,0x13,0x0c,0x89,0x05,0x13,0xdf,0x0b,0x01,0x10,0x02,
+0x25,0x01,0x44,0xbb,0xbb,0xbb,0xbe,0x0b,0x01,0x16,0x8f,0xc6,0x04,0x17,0xfd,0x9a,
+0x0a,0x05,0x0b,0x01,0x03,0x05,0x01,0x06,0x0b,0x01,0x17,0xaf,0x10,0x00,0x00,0x0b,
+0x01,0x18,0x0f,0x21,0x00,0x12,0xf5,0x05,0x01,0x15,0xd0,0xde,0x00,0x11,0xb0,0x05,
+0x01,0x15,0xf7,0xff,0x00,0x21,0xff,0x10,0x06,0x00,0x15,0x20,0x86,0x06,0x11,0xf7,
+0x27,0x00,0x16,0xc0,0x10,0x01,0x36,0xd0,0x00,0xef,0x21,0x01,0x10,0x2f,0x0b,0x01,
+0x16,0x4f,0x31,0x00,0x00,0x32,0x00,0x26,0xf9,0x0a,0x31,0x00,0x01,0x85,0x05,0x13,
+0xe0,0x8d,0x00,0x20,0xdc,0x96,0x68,0x01,0x05,0x8c,0x00,0x27,0xfb,0x30,0x0d,0x00,
+0x27,0xff,0xf8,0x0d,0x00,0x00,0xfb,0x03,0x09,0xb5,0x00,0x00,0xb0,0x03,0x32,0xbb,
+0xbb,0xcd,0xd3,0x00,0x03,0x36,0x02,0x01,0xd5,0x02,0x14,0x30,0x43,0x02,0x10,0x1f,
+0x30,0x01,0x04,0x0d,0x00,0x10,0x09,0x0b,0x01,0x04,0x0d,0x00,0x18,0x06,0x0d,0x00,
+0x10,0x07,0xb1,0x07,0x04,0x0d,0x00,0x10,0x0a,0x4f,0x07,0x04,0x0d,0x00,0x16,0x4f,
+0x5b,0x00,0x24,0x01,0x39,0x75,0x00,0x15,0xff,0xe4,0x07,0x06,0x0c,0x00,0x18,0xe6,
+0xa9,0x00,0x18,0x71,0x0d,0x00,0x28,0xfe,0x50,0x34,0x00,0x20,0xf7,0x00,0x3a,0x09,
+0x58,0x11,0x11,0x11,0x25,0xcf,0xa9,0x00,0x10,0x0a,0x75,0x01,0x04,0x0d,0x00,0x10,
+0x01,0x09,0x00,0x04,0x06,0x03,0x00,0x89,0x01,0x14,0xf4,0x0d,0x00,0x00,0xc7,0x01,
+0x18,0xf6,0x0d,0x00,0x15,0xf5,0x0d,0x00,0x17,0xef,0x27,0x00,0x01,0xea,0x0b,0x03,
+0x0d,0x00,0x20,0x01,0x8f,0x9e,0x01,0x00,0x71,0x09,0x41,0xaa,0xaa,0xaa,0xcf,0x4c,
+0x03,0x09,0x0b,0x02,0x09,0x39,0x02,0x07,0x19,0x00,0x26,0x30,0x00,0x0c,0x00,0x15,
+0x80,0xd0,0x00,0x60,0xee,0xc8,0x50,0x00,0x00,0x00,0xb2,0x00,0x00,0x00,0x00,0x04,
+0x9c,0xef,0xfe,0xdb,0x73,0x00,0x01,0x00,0x30,0x07,0xef,0xff,0x01,0x00,0x11,0xc5,
+0x0d,0x00,0x32,0x03,0xdf,0xff,0x01,0x00,0x10,0xb1,0x0e,0x00,0x23,0x5f,0xff,0x01,
+0x00,0x65,0xfe,0x20,0x00,0x00,0x04,0xff,0x01,0x00,0x41,0xe2,0x00,0x00,0x1e,0x17,
+0x00,0x10,0xde,0x06,0x00,0xb0,0xfc,0x00,0x00,0xaf,0xff,0xff,0xff,0xc4,0x00,0x00,
+0x15,0x3e,0x00,0x60,0x50,0x03,0xff,0xff,0xff,0xf9,0x3f,0x00,0xa0,0x0b,0xff,0xff,
+0xff,0xd0,0x0a,0xff,0xff,0xff,0xc0,0x0e,0x00,0xa1,0x01,0xff,0xff,0xff,0xf2,0x0f,
+0xff,0xff,0xff,0x30,0x6a,0x00,0xa3,0x9f,0xff,0xff,0xf7,0x4f,0xff,0xff,0xfd,0x00,
+0x00,0x6a,0x00,0x23,0xfa,0x8f,0x37,0x00,0xb5,0x00,0x00,0x2c,0xcc,0xcc,0xca,0xbf,
+0xff,0xff,0xf6,0x00,0x01,0x00,0x46,0xdf,0xff,0xff,0xf4,0x0e,0x00,0x46,0xef,0xff,
+0xff,0xf3,0x0e,0x00,0x00,0x58,0x00,0x0f,0x0e,0x00,0x21,0x0a,0x46,0x00,0x0a,0x62,
+0x00,0x0a,0x7e,0x00,0x42,0x8f,0xff,0xff,0xf8,0x0a,0x00,0x51,0x29,0x99,0x99,0x97,
+0x4f,0xf3,0x00,0x04,0xb6,0x00,0x54,0x1f,0xff,0xff,0xff,0x20,0xd2,0x00,0x10,0xf8,
+0xee,0x00,0x14,0xa0,0xee,0x00,0x10,0xf3,0x0a,0x01,0x14,0xf7,0x0a,0x01,0xa0,0xe0,
+0x00,0xcf,0xff,0xff,0xff,0xa3,0x00,0x00,0x05,0x26,0x01,0x30,0x70,0x00,0x2f,0x3c,
+0x01,0x41,0xed,0xcd,0xff,0xff,0x05,0x01,0x19,0x05,0x5e,0x01,0x25,0x00,0x7f,0x0e,
+0x00,0x00,0x2e,0x01,0x23,0x05,0xef,0x0d,0x00,0x11,0xc2,0x69,0x00,0x12,0x19,0x0d,
+0x00,0x13,0xc6,0x9e,0x00,0x15,0x05,0xce,0x01,0x02,0x18,0x00,0x21,0xeb,0x84,0x17,
+0x00,0x14,0x0f,0xbc,0x01,0x15,0x71,0x1b,0x00,0x00,0x01,0x00,0x17,0xe5,0x1b,0x00,
+0x38,0xff,0xff,0xfa,0x1b,0x00,0x22,0xff,0xfb,0x1b,0x00,0x21,0xcb,0xbb,0xd8,0x01,
+0x11,0xf9,0x1b,0x00,0x91,0xf1,0x00,0x00,0x03,0x9f,0xff,0xff,0xff,0xf5,0x1b,0x00,
+0x51,0x10,0x00,0x00,0x00,0x3e,0xcd,0x00,0x02,0x1b,0x00,0x11,0x00,0xc7,0x00,0x14,
+0x70,0x1b,0x00,0x00,0xb8,0x00,0x15,0xfe,0x1b,0x00,0x00,0x62,0x01,0x15,0xf4,0x1b,
+0x00,0x54,0x09,0xff,0xff,0xff,0x80,0x1b,0x00,0x00,0x3b,0x01,0x15,0xfc,0x1b,0x00,
+0x10,0x02,0x52,0x00,0x05,0x1b,0x00,0x00,0x52,0x01,0x05,0x1b,0x00,0x01,0x4d,0x00,
+0x05,0x1b,0x00,0x00,0x17,0x00,0x18,0x2f,0x1b,0x00,0x19,0xf2,0x1b,0x00,0x14,0x1f,
+0x1b,0x00,0x00,0x7e,0x01,0x15,0xf0,0x1b,0x00,0x18,0x2f,0x51,0x00,0x10,0x06,0x90,
+0x02,0x04,0x1b,0x00,0x00,0xb4,0x01,0x15,0xf9,0x1b,0x00,0x00,0x09,0x00,0x14,0x40,
+0x1b,0x00,0x10,0x07,0x94,0x00,0x04,0x1b,0x00,0x00,0xa1,0x00,0x14,0xf8,0xd8,0x00,
+0x63,0x03,0xef,0xff,0xff,0xfe,0x10,0x1b,0x00,0x10,0x29,0x2a,0x01,0x20,0x60,0x00,
+0x3d,0x01,0x21,0xbb,0xbc,0xa7,0x01,0x17,0xa0,0x5f,0x01,0x28,0xff,0xc0,0x5f,0x01,
+0x18,0xb0,0x7a,0x01,0x17,0x60,0x7a,0x01,0x25,0xf8,0x10,0x95,0x01,0x34,0xfe,0xb9,
+0x40,0xdc,0x00,0x04,0x01,0x00,0x16,0xef,0x0b,0x00,0x1f,0xfe,0x17,0x00,0x13,0x21,
+0xcb,0xbb,0x01,0x00,0x15,0xba,0xe7,0x00,0x15,0x00,0xbd,0x01,0x04,0x53,0x01,0x0f,
+0x17,0x00,0x26,0x20,0x98,0x88,0x01,0x00,0x17,0x85,0xa1,0x00,0x16,0x90,0xd5,0x00,
+0x1f,0xf9,0x17,0x00,0x14,0x0f,0x8a,0x00,0x32,0x0f,0x17,0x00,0x0f,0x22,0xfb,0xbb,
+0x01,0x00,0x1e,0xaf,0x42,0x01,0x0f,0x59,0x01,0x1f,0x16,0x4f,0x0b,0x00,0x1f,0xf4,
+0x17,0x00,0x13,0x03,0x87,0x01,0x1f,0xb3,0xe6,0x00,0x53,0x1f,0x60,0x87,0x01,0x1f,
+0x07,0x17,0x00,0x0f,0xa1,0x00,0x49,0x0f,0x17,0x00,0x2f,0x01,0x9b,0x06,0x54,0x8b,
+0xdf,0xff,0xec,0x96,0x12,0x00,0x12,0x6d,0xbc,0x00,0x21,0xa3,0x00,0x40,0x04,0x14,
+0xcf,0x49,0x03,0x01,0x29,0x00,0x08,0xd0,0x04,0x26,0x00,0x02,0xf4,0x00,0x00,0x5e,
+0x06,0x01,0xe0,0x06,0x21,0xdb,0xce,0xaf,0x01,0x01,0xd9,0x05,0x60,0xff,0xe6,0x10,
+0x00,0x02,0x9f,0xaa,0x06,0x01,0x79,0x04,0x14,0xd1,0xf8,0x06,0x25,0x30,0x07,0x2e,
+0x06,0x10,0x9f,0x3b,0x00,0x14,0xdf,0x04,0x06,0x10,0x02,0xd7,0x03,0x15,0x2f,0xf6,
+0x05,0x51,0x0c,0xee,0xee,0xed,0x05,0x3f,0x00,0x08,0x2f,0x06,0x16,0xfa,0x0e,0x00,
+0x10,0x0a,0xf8,0x04,0x0f,0x5a,0x06,0x05,0x12,0x0c,0x0a,0x04,0x21,0x01,0x33,0x01,
+0x00,0x20,0x30,0xcf,0x68,0x05,0x32,0x00,0x00,0x6f,0xb0,0x00,0x10,0x0c,0x4e,0x07,
+0x02,0xb2,0x04,0x00,0xd0,0x04,0x12,0xcf,0x3a,0x00,0x03,0x1d,0x00,0x12,0x0b,0x3a,
+0x00,0x04,0x1d,0x00,0x12,0xaf,0x9f,0x00,0x03,0x1d,0x00,0x14,0x08,0x87,0x06,0x01,
+0x52,0x01,0x20,0xf0,0x5f,0x96,0x05,0x05,0x55,0x01,0x01,0x9b,0x06,0x06,0x1d,0x00,
+0x15,0x0d,0x2c,0x00,0x00,0x1d,0x00,0x01,0x7a,0x06,0x15,0x40,0x1d,0x00,0x14,0x01,
+0x83,0x06,0x01,0x1d,0x01,0x01,0x15,0x05,0x60,0xff,0x92,0x00,0x00,0x00,0x6e,0x1d,
+0x00,0x21,0x00,0x0c,0x24,0x03,0x21,0xcb,0xbd,0x74,0x00,0x03,0x14,0x08,0x06,0xec,
+0x04,0x16,0x2d,0x0e,0x00,0x00,0x60,0x00,0x15,0x1a,0x55,0x03,0x11,0x50,0x84,0x08,
+0x1a,0xbf,0xc6,0x06,0x79,0x16,0xad,0xef,0xff,0xdc,0x96,0x10,0x04,0x02,0x4f,0x3f,
+0xff,0xff,0xfd,0x0e,0x00,0x98,0x03,0x89,0x03,0x12,0xcf,0x0e,0x00,0x06,0x01,0x00,
+0x0f,0x0e,0x00,0x29,0x0e,0x0a,0x01,0x0f,0x0e,0x00,0xaa,0x00,0x4a,0x09,0x0f,0x04,
+0x00,0x71,0x26,0x00,0x00,0x94,0x00,0x0f,0x0c,0x00,0xf5,0x44,0x07,0x77,0x77,0x77,
+0x0c,0x00,0x04,0x7d,0x05,0x00,0xa7,0x09,0x13,0x0e,0x12,0x04,0x00,0x07,0x05,0x12,
+0x0b,0xcd,0x03,0x00,0x17,0x04,0x22,0xf6,0x06,0x71,0x05,0x10,0x3d,0xe2,0x01,0x11,
+0x01,0x09,0x0c,0x11,0xbd,0x5a,0x06,0x06,0xbd,0x0a,0x44,0xfe,0x10,0x00,0x0b,0x0c,
+0x00,0x00,0x72,0x04,0x13,0xaf,0x17,0x00,0x23,0x30,0x00,0x06,0x0b,0x04,0x1a,0x05,
+0x68,0x04,0x8c,0xef,0xff,0xda,0x61,0xfc,0x03,0x18,0x8f,0xdd,0x09,0x01,0x7b,0x0c,
+0x14,0x50,0x0e,0x00,0x18,0x2e,0x8d,0x09,0x01,0x55,0x0b,0x14,0xb0,0x0e,0x00,0x12,
+0x0a,0x4d,0x0b,0x03,0x0e,0x00,0x12,0x6f,0xc2,0x05,0x03,0xc5,0x0a,0x12,0xff,0xc7,
+0x00,0x02,0x0e,0x00,0x13,0x1e,0x2d,0x06,0x02,0x0e,0x00,0x12,0xbf,0xb1,0x04,0x02,
+0x0e,0x00,0x12,0x08,0x44,0x00,0x03,0x0e,0x00,0x14,0x4f,0x06,0x06,0x01,0xe6,0x00,
+0x14,0xef,0x1d,0x05,0x00,0x0e,0x00,0x14,0x0c,0xde,0x0b,0x01,0x0e,0x00,0x13,0x8f,
+0x44,0x00,0x01,0x0e,0x00,0x25,0xf5,0xff,0x5c,0x01,0x07,0x69,0x0b,0x07,0xd7,0x09,
+0x19,0x50,0x0e,0x00,0x19,0xe1,0x0e,0x00,0x1a,0xfa,0x01,0x0a,0x15,0x40,0x0e,0x00,
+0x14,0xaf,0x2b,0x00,0x01,0x26,0x00,0x14,0x08,0x67,0x0d,0x02,0x6f,0x05,0x13,0xdf,
+0x2b,0x00,0x02,0x91,0x0d,0x11,0x3f,0xa4,0x0b,0x04,0xe0,0x00,0x13,0x09,0x2b,0x00,
+0x03,0x18,0x01,0x18,0xef,0x0a,0x01,0x22,0x00,0x4f,0xbd,0x06,0x07,0x42,0x01,0x15,
+0xf9,0x0e,0x00,0x01,0xf1,0x00,0x15,0x30,0x6c,0x01,0x11,0x6f,0x2b,0x00,0x04,0x0e,
+0x00,0x19,0x0b,0x3c,0x08,0x11,0x02,0x2a,0x06,0x05,0xc0,0x01,0x10,0x7f,0x2b,0x00,
+0x05,0x0e,0x00,0x50,0x0c,0xff,0xff,0xff,0xf8,0x52,0xff,0xff,0xff,0xf1,0x00,0x01,
+0x00,0x53,0x0f,0xff,0xff,0xff,0x10,0x0c,0x00,0x0f,0x17,0x00,0xff,0x1c,0x22,0xfb,
+0xbb,0x01,0x00,0x25,0x0f,0xff,0x01,0x00,0x26,0xf0,0xff,0x01,0x00,0x0f,0x17,0x00,
+0x14,0x23,0xf6,0x00,0x01,0x00,0x14,0x7f,0x17,0x00,0x14,0xfc,0x12,0x00,0x15,0xdf,
+0x2a,0x00,0x12,0x20,0x11,0x00,0x16,0x02,0x3c,0x00,0x12,0x70,0x12,0x00,0x16,0x08,
+0x12,0x00,0x12,0xd0,0x12,0x00,0x16,0x0d,0x12,0x00,0x12,0xf3,0x12,0x00,0x16,0x3f,
+0x12,0x00,0x12,0xf8,0x12,0x00,0x16,0x9f,0x12,0x00,0x12,0xfe,0x12,0x00,0x17,0xef,
+0xa2,0x00,0x10,0x40,0x11,0x00,0x15,0x04,0x0f,0x00,0x40,0xbf,0xff,0xff,0x90,0x12,
+0x00,0x42,0x0a,0xff,0xff,0xfb,0x12,0x00,0x43,0x7f,0xff,0xff,0xe0,0x10,0x01,0x12,
+0xe7,0x12,0x00,0x40,0x79,0xff,0xff,0xf5,0x12,0x00,0x42,0x5f,0xff,0xff,0x98,0x12,
+0x00,0x40,0x83,0xff,0xff,0xfa,0x12,0x00,0x42,0xbf,0xff,0xff,0x38,0x12,0x00,0x21,
+0x90,0xdf,0x3e,0x01,0x52,0x01,0xff,0xff,0xfd,0x09,0x12,0x00,0xc3,0xa0,0x8f,0xff,
+0xff,0x60,0x00,0x00,0x06,0xff,0xff,0xf7,0x0a,0x12,0x00,0xb2,0x2f,0xff,0xff,0xb0,
+0x00,0x00,0x0c,0xff,0xff,0xf2,0x0b,0x12,0x00,0x21,0xb0,0x0c,0x80,0x01,0x43,0x1f,
+0xff,0xff,0xc0,0x12,0x00,0x10,0xc0,0x30,0x00,0x01,0x2f,0x01,0x23,0x60,0x0c,0x12,
+0x00,0x10,0x01,0x35,0x01,0x00,0x2f,0x01,0x04,0xfe,0x00,0x10,0xd0,0x78,0x00,0x20,
+0x20,0x02,0x84,0x00,0x03,0x12,0x00,0x10,0xe0,0x9c,0x00,0x73,0x80,0x08,0xff,0xff,
+0xf4,0x00,0x0e,0x12,0x00,0x00,0xc0,0x00,0x23,0xd0,0x0e,0x09,0x00,0x01,0x90,0x01,
+0x60,0x00,0x09,0xff,0xff,0xf3,0x3f,0xf0,0x00,0x04,0x12,0x00,0x00,0x08,0x01,0x54,
+0xf9,0x9f,0xff,0xff,0x30,0x12,0x00,0x10,0xf1,0x2c,0x01,0x41,0xfe,0xef,0xff,0xfd,
+0x94,0x00,0x03,0x12,0x00,0x10,0x8f,0x08,0x00,0x18,0xf7,0x12,0x00,0x13,0x2f,0x08,
+0x00,0x06,0x12,0x00,0x11,0x0c,0xaa,0x00,0x08,0x12,0x00,0x10,0x06,0x08,0x00,0x18,
+0x60,0x12,0x00,0x10,0x01,0x08,0x00,0x18,0x00,0x12,0x00,0x00,0xc8,0x00,0x1a,0xfa,
+0x12,0x00,0x10,0x5f,0xc4,0x00,0x09,0x12,0x00,0x12,0x0f,0x90,0x01,0x07,0x12,0x00,
+0x12,0x09,0xb4,0x01,0x03,0x12,0x00,0x15,0xf6,0x08,0x02,0x10,0xfc,0xf2,0x01,0x18,
+0x10,0x0e,0x00,0x29,0xff,0x90,0x0e,0x00,0x19,0xf3,0x0e,0x00,0x19,0xfd,0x0e,0x00,
+0x29,0xff,0x70,0x0e,0x00,0x19,0xf1,0x0e,0x00,0x19,0xfa,0x0e,0x00,0x29,0xff,0x40,
+0x0e,0x00,0x19,0xd0,0x0e,0x00,0x19,0xf8,0x0e,0x00,0x25,0xff,0x20,0x0e,0x00,0x10,
+0xf7,0xf0,0x01,0x05,0x0e,0x00,0x21,0xf1,0xcf,0x55,0x02,0x04,0x0e,0x00,0x11,0x2f,
+0xac,0x02,0x04,0x0e,0x00,0x00,0xf8,0x02,0x15,0x80,0x0e,0x00,0x00,0xbf,0x02,0x16,
+0xf2,0x0e,0x00,0x10,0x5f,0x0f,0x02,0x05,0x0e,0x00,0x10,0x0b,0x66,0x01,0x05,0x0e,
+0x00,0x00,0x43,0x03,0x15,0xe1,0x0e,0x00,0x00,0x46,0x02,0x16,0xf9,0x0e,0x00,0x12,
+0x0d,0xdd,0x02,0x03,0x0e,0x00,0x13,0x04,0x8f,0x03,0x03,0xec,0x00,0x19,0xaf,0x0e,
+0x00,0x19,0x1f,0x0e,0x00,0x19,0x06,0x0e,0x00,0x29,0x00,0xcf,0x0e,0x00,0x19,0x3f,
+0x0e,0x00,0x19,0x09,0x0e,0x00,0x28,0x01,0xef,0x0e,0x00,0x29,0x00,0x6f,0x0e,0x00,
+0x19,0x0c,0x0e,0x00,0x19,0x02,0x0e,0x00,0x23,0x00,0x8f,0x29,0x04,0x64,0x02,0x7a,
+0xde,0xff,0xdb,0x72,0x33,0x04,0x21,0x04,0xcf,0x8a,0x00,0x12,0xc5,0x0e,0x00,0x23,
+0x01,0xaf,0x64,0x01,0x11,0xb1,0x0f,0x00,0x15,0x2d,0xf5,0x03,0x14,0x30,0x7b,0x00,
+0x02,0x01,0x00,0x23,0xe2,0x00,0xa0,0x02,0x24,0xff,0xef,0xf7,0x01,0x10,0x7f,0xa9,
+0x01,0x32,0x20,0x00,0x27,0x23,0x02,0x10,0x01,0x35,0x00,0x00,0x85,0x04,0x20,0x1d,
+0xff,0x6a,0x01,0x11,0x08,0x06,0x00,0x03,0x44,0x00,0x11,0xf9,0x51,0x03,0x15,0x80,
+0xc0,0x00,0x25,0x00,0x3f,0x27,0x05,0x10,0x0e,0x0a,0x02,0x64,0x7f,0xff,0xff,0xfb,
+0x00,0x00,0xfb,0x00,0x25,0x90,0xaf,0x86,0x04,0x10,0x06,0xef,0x01,0x02,0xe5,0x01,
+0x00,0x01,0x00,0x10,0x03,0x94,0x03,0x15,0xef,0xb6,0x04,0x13,0x02,0x21,0x05,0x13,
+0xf2,0xcb,0x00,0x0a,0x0f,0x00,0x01,0x97,0x05,0x0e,0x0f,0x00,0x08,0x2d,0x00,0x0b,
+0x4b,0x00,0x1a,0xdf,0x69,0x00,0x0a,0x87,0x00,0x1b,0xc0,0xa5,0x00,0x0a,0xc3,0x00,
+0x16,0x50,0xe1,0x00,0x10,0x5f,0xe1,0x00,0x09,0xff,0x00,0x16,0xfa,0x1d,0x01,0x12,
+0x1c,0x41,0x03,0x10,0x7f,0xcb,0x02,0x40,0x10,0x00,0x16,0xef,0xd1,0x04,0x03,0x59,
+0x01,0x33,0xfe,0xde,0xff,0x7b,0x03,0x07,0x77,0x01,0x19,0xf3,0x95,0x01,0x29,0xff,
+0x30,0xb3,0x01,0x19,0xc2,0xd1,0x01,0x14,0xd5,0xe1,0x01,0x64,0x02,0x7a,0xdf,0xff,
+0xeb,0x83,0xf4,0x00,0x01,0xae,0x01,0x10,0xb8,0x39,0x00,0x06,0x57,0x06,0x16,0xd6,
+0x1b,0x00,0x00,0x32,0x02,0x17,0x10,0x1b,0x00,0x00,0xa7,0x00,0x17,0xff,0x0e,0x00,
+0x10,0x10,0x1b,0x00,0x42,0xcc,0xcc,0xcc,0xcd,0xc2,0x03,0x03,0x5d,0x02,0x20,0x01,
+0x7f,0xe0,0x00,0x05,0xed,0x06,0x10,0x4f,0x11,0x01,0x04,0x78,0x02,0x00,0x3b,0x06,
+0x15,0xfd,0x1b,0x00,0x04,0xa4,0x01,0x15,0xf1,0x1f,0x07,0x15,0x2f,0x39,0x01,0x00,
+0x44,0x00,0x09,0x1b,0x00,0x14,0x1f,0x1b,0x00,0x18,0x05,0x36,0x00,0x00,0x0f,0x01,
+0x14,0xfb,0x51,0x00,0x20,0x05,0xef,0xac,0x03,0x00,0xb6,0x00,0x41,0xbb,0xbb,0xbb,
+0xcf,0x3a,0x04,0x17,0x0f,0xb0,0x00,0x18,0xf4,0xbd,0x00,0x18,0xf5,0xd8,0x00,0x17,
+0xe4,0xf3,0x00,0x25,0xfe,0x81,0x0e,0x01,0x3b,0xfe,0xdb,0x84,0xc3,0x07,0x0a,0xc5,
+0x07,0x0f,0x1b,0x00,0x76,0x01,0x01,0x00,0x6b,0x27,0xbd,0xff,0xfd,0xb7,0x20,0xca,
+0x03,0x13,0xc4,0x0f,0x00,0x13,0x1b,0xde,0x00,0x12,0xfb,0x35,0x00,0x17,0x2e,0xd2,
+0x01,0x08,0x0f,0x00,0x02,0x10,0x00,0x1a,0x0d,0xcc,0x03,0x01,0x25,0x08,0x31,0x72,
+0x00,0x02,0xd4,0x03,0x02,0x1e,0x03,0x23,0xfd,0x20,0x7b,0x02,0x12,0xf2,0xbe,0x06,
+0x01,0x46,0x00,0x11,0x2f,0xe7,0x02,0x15,0x0e,0x5e,0x08,0x10,0x7f,0x73,0x05,0x11,
+0x04,0x07,0x07,0x04,0xc1,0x00,0x33,0xf4,0x00,0x8f,0xec,0x05,0x01,0x11,0x08,0x36,
+0xff,0x80,0x0b,0x8c,0x08,0x01,0x44,0x03,0x12,0xdf,0x9e,0x06,0x03,0x42,0x08,0x26,
+0xd0,0x0f,0xbd,0x08,0x00,0x5e,0x00,0x01,0x16,0x02,0x07,0x95,0x03,0x07,0x06,0x01,
+0x13,0x1f,0x1f,0x00,0x17,0xf1,0xc3,0x03,0x0f,0x3e,0x00,0x0c,0x14,0x0d,0xad,0x08,
+0x01,0xa5,0x02,0x10,0xfd,0x2c,0x07,0x12,0xf7,0x0f,0x00,0x10,0x07,0x5b,0x04,0x12,
+0x08,0x4f,0x06,0x12,0x00,0xbc,0x05,0x11,0xf8,0xc9,0x02,0x06,0x7d,0x01,0x10,0x40,
+0x35,0x06,0x15,0xf7,0x02,0x04,0x1c,0xe0,0xd5,0x04,0x01,0x72,0x00,0x10,0xd1,0x0f,
+0x00,0x12,0xcf,0xa5,0x00,0x17,0x8f,0xd7,0x03,0x14,0x80,0x9e,0x09,0x24,0xed,0xef,
+0xe0,0x06,0x16,0x02,0xd8,0x03,0x29,0xe1,0x00,0x10,0x00,0x12,0xd2,0xd1,0x00,0x13,
+0xbf,0x0f,0x00,0x13,0xf9,0xd2,0x01,0x16,0x4c,0xa2,0x03,0x02,0xd3,0x00,0x44,0x7b,
+0xdf,0xfe,0xdf,0x9d,0x05,0x26,0x00,0x00,0xb2,0x05,0x16,0x60,0x10,0x00,0x25,0x0b,
+0xff,0x8a,0x04,0x05,0xff,0x09,0x16,0xd1,0x43,0x02,0x00,0x5b,0x03,0x18,0xc1,0x53,
+0x02,0x39,0x02,0xdf,0xa0,0x63,0x02,0x25,0x01,0x70,0x29,0x03,0x39,0xed,0xa7,0x20,
+0x37,0x04,0x19,0xc4,0x37,0x04,0x18,0xfa,0x1b,0x00,0x00,0x69,0x06,0x18,0xff,0x1c,
+0x00,0x00,0x1b,0x00,0x42,0xcb,0xbb,0xbb,0xce,0xc5,0x04,0x03,0xb5,0x01,0x20,0x03,
+0xcf,0xf0,0x04,0x05,0xd2,0x01,0x18,0xcf,0xd0,0x01,0x19,0x02,0x52,0x04,0x01,0xb8,
+0x01,0x04,0xeb,0x01,0x00,0xb6,0x01,0x15,0xf5,0x1b,0x00,0x19,0x0b,0x1b,0x00,0x1c,
+0xef,0x88,0x04,0x05,0x51,0x00,0x17,0x2e,0x6c,0x00,0x24,0x03,0x8f,0x87,0x00,0x15,
+0xff,0x63,0x01,0x07,0xbd,0x00,0x18,0xfb,0xbd,0x00,0x1e,0xf9,0xf3,0x00,0x07,0x1b,
+0x0b,0x02,0xd8,0x00,0x13,0xbc,0x65,0x00,0x02,0x07,0x00,0x12,0x0e,0x24,0x09,0x03,
+0x6c,0x00,0x12,0x6f,0x92,0x02,0x03,0x22,0x00,0x15,0xdf,0x29,0x01,0x12,0x10,0xd7,
+0x04,0x15,0xf2,0x1b,0x00,0x11,0x0d,0x7d,0x02,0x04,0xbd,0x00,0x11,0x4f,0xdf,0x05,
+0x07,0x1f,0x08,0x15,0xfb,0x1b,0x00,0x14,0x04,0xd9,0x04,0x14,0xf1,0x00,0x01,0x15,
+0xc0,0xf3,0x00,0x10,0x3f,0x7d,0x06,0x08,0x29,0x01,0x06,0x7b,0x05,0x23,0x03,0xff,
+0xd0,0x06,0x35,0x16,0xac,0xef,0x00,0x08,0x22,0x04,0xbf,0xaf,0x01,0x14,0x40,0x9f,
+0x03,0x05,0xfd,0x07,0x15,0x1d,0xe8,0x00,0x14,0xd1,0xeb,0x07,0x02,0x3b,0x0b,0x02,
+0xbb,0x08,0x32,0xfc,0xaa,0xcf,0x5a,0x02,0x12,0xdf,0xcf,0x03,0x10,0x06,0xbd,0x02,
+0x01,0x02,0x03,0x13,0x50,0x6c,0x00,0x11,0xf6,0xcf,0x03,0x05,0x21,0x07,0x13,0x4f,
+0x30,0x07,0x00,0x11,0x07,0x11,0xfb,0x51,0x07,0x01,0x5f,0x02,0x55,0x55,0x55,0x55,
+0x40,0x0f,0x55,0x0a,0x04,0x6b,0x0c,0x15,0xc3,0x7f,0x02,0x01,0x6c,0x00,0x26,0x61,
+0x00,0x21,0x04,0x06,0x0f,0x00,0x13,0x04,0xae,0x01,0x12,0x40,0xb9,0x02,0x12,0xcf,
+0x0f,0x00,0x12,0xd4,0x1d,0x00,0x19,0x5c,0xfd,0x04,0x22,0x03,0xaf,0xf9,0x06,0x13,
+0x20,0xf5,0x02,0x11,0xaf,0x0e,0x00,0x14,0x10,0x04,0x03,0x17,0xbf,0x65,0x03,0x37,
+0x00,0x00,0x3d,0x26,0x08,0x02,0x08,0x01,0x14,0x75,0x18,0x04,0x00,0xb2,0x04,0x11,
+0xfa,0x3a,0x04,0x04,0x81,0x00,0x15,0xc1,0x2d,0x00,0x00,0xd8,0x00,0x12,0x0c,0xb2,
+0x0b,0x02,0x31,0x01,0x23,0xa0,0x6f,0x8f,0x00,0x11,0x2b,0x52,0x0b,0x10,0xcf,0xaa,
 0x03,0x21,0xba,0x9a,0x05,0x04,0x08,0xfc,0x03,0x28,0xff,0x60,0x0e,0x00,0x17,0x90,
-0xd1,0x07,0x02,0x27,0x05,0x13,0x3a,0x44,0x03,0x03,0x1f,0x48,0x30,0x59,0xce,0xff,
-0xb0,0x41,0x05,0xab,0x0b,0x04,0xb3,0x01,0x09,0x0e,0x00,0x1f,0xfb,0x1d,0x00,0x18,
-0x11,0xb0,0x93,0x0e,0x12,0xef,0x43,0x07,0x2d,0xbb,0xb8,0x95,0x37,0x03,0x0a,0x1f,
-0x0a,0xf7,0x16,0x0f,0x1d,0x00,0xff,0x5e,0x05,0xb7,0x1e,0x10,0x02,0xbc,0x08,0x05,
-0xd1,0x21,0x00,0xe3,0x0c,0x0f,0x1b,0x00,0xff,0x05,0x10,0x03,0x48,0x07,0x05,0xe5,
-0x10,0x13,0x4f,0xf8,0x3b,0x14,0x10,0xec,0x07,0x12,0xa0,0xb2,0x30,0x02,0x93,0x05,
-0x15,0xf6,0xca,0x07,0x14,0x8f,0x2b,0x2a,0x13,0xf6,0xc5,0x28,0x12,0xb0,0xc6,0x0d,
-0x02,0x27,0x19,0x16,0xf3,0x5c,0x2a,0x01,0xff,0x05,0x06,0xb8,0x03,0x18,0xf9,0xb0,
-0x07,0x18,0xf7,0xe5,0x1a,0x13,0xa2,0x43,0x0c,0x63,0x7b,0xde,0xff,0xec,0x95,0x10,
-0x16,0x0e,0x16,0x10,0xee,0x01,0x26,0xf1,0x4f,0xb1,0x07,0x10,0x1f,0x71,0x00,0x16,
-0x0e,0x85,0x08,0x10,0x5f,0x4f,0x05,0x16,0x09,0x4f,0x09,0x10,0xaf,0x3b,0x04,0x16,
-0x04,0x13,0x4b,0x02,0x77,0x07,0x02,0x7d,0x08,0x05,0x19,0x06,0x00,0x41,0x05,0x15,
-0xfe,0xec,0x07,0x12,0xe0,0x14,0x06,0x14,0x30,0x46,0x07,0x12,0x90,0x07,0x00,0x15,
-0x70,0x2e,0x24,0x16,0x00,0x51,0x24,0x12,0x7f,0x39,0x00,0x17,0x02,0x76,0x06,0x14,
-0xf8,0x22,0x01,0x04,0x16,0x21,0x07,0x64,0x35,0x05,0x39,0x1b,0x01,0x6a,0x09,0x07,
-0x2c,0x1b,0x03,0xc5,0x02,0x14,0x0e,0x8c,0x09,0x12,0x07,0x78,0x00,0x05,0x9b,0x01,
-0x12,0x01,0x98,0x00,0x15,0x8f,0x7d,0x09,0x00,0x74,0x2b,0x06,0x74,0x25,0x03,0x96,
-0x25,0x16,0x02,0xb7,0x24,0x01,0x05,0x32,0x16,0x07,0x28,0x01,0x01,0x80,0x4f,0x16,
-0x0b,0x48,0x01,0x13,0x05,0x47,0x3f,0x05,0xcf,0x26,0x08,0x4b,0x3f,0x04,0xa7,0x3e,
-0x04,0xcb,0x3e,0x04,0x46,0x34,0x17,0xef,0x00,0x34,0x12,0x0e,0x29,0x0f,0x19,0x40,
-0xf5,0x48,0x07,0xba,0x26,0x1b,0x04,0x17,0x4b,0x02,0xfe,0x12,0x18,0xf4,0x50,0x28,
-0x0a,0x6f,0x27,0x1a,0x3f,0x0a,0x27,0x02,0x60,0x0b,0x1a,0x30,0x87,0x09,0x18,0xfd,
-0x77,0x09,0x06,0x6b,0x13,0x14,0x1f,0x79,0x00,0x03,0x3f,0x01,0x00,0x6c,0x00,0x27,
-0xf1,0x0d,0xfc,0x07,0x14,0x50,0x43,0x01,0x13,0x09,0xb3,0x00,0x13,0x08,0x6c,0x00,
-0x10,0x04,0xf7,0x00,0x13,0x06,0xde,0x01,0x13,0x0b,0x9e,0x01,0x13,0x07,0x20,0x4b,
-0x04,0xf6,0x46,0x05,0x29,0x16,0x01,0x5e,0x08,0x13,0xe0,0xac,0x00,0x13,0xf4,0xa4,
-0x00,0x05,0xa8,0x3d,0x16,0x7f,0xe1,0x08,0x12,0xfc,0x5a,0x33,0x03,0x80,0x02,0x15,
-0xfb,0x4e,0x38,0x03,0x60,0x38,0x01,0x0b,0x01,0x05,0x79,0x39,0x02,0x01,0x40,0x14,
-0x02,0x9f,0x0e,0x14,0x9f,0x26,0x11,0x05,0x26,0x23,0x12,0x60,0xa0,0x32,0x04,0x17,
-0x32,0x11,0x09,0xa8,0x1f,0x12,0xa0,0xb3,0x01,0x02,0x59,0x0b,0x10,0x30,0x30,0x00,
-0x10,0xba,0x24,0x00,0x16,0x02,0xf6,0x36,0x01,0xae,0x39,0x21,0x76,0xff,0xb0,0x4f,
-0x02,0x4a,0x01,0x00,0xf5,0x00,0x00,0x84,0x00,0x10,0x32,0x78,0x00,0x00,0x03,0x01,
-0x03,0x4a,0x02,0x11,0xc0,0xf2,0x30,0x30,0xef,0xff,0xf9,0x03,0x01,0x04,0x0e,0x46,
-0x51,0xf0,0x00,0xcf,0xff,0xfb,0x73,0x47,0x00,0xf2,0x37,0x03,0x03,0x02,0x10,0xf2,
-0xdb,0x47,0x00,0xea,0x00,0x05,0xac,0x36,0x00,0x08,0x00,0x00,0x27,0x31,0x00,0xe2,
-0x00,0x22,0x40,0x4f,0x90,0x02,0x00,0x8e,0x00,0x50,0xf8,0x07,0xff,0xff,0xf0,0x0c,
-0x01,0x25,0x70,0x7f,0xd5,0x4b,0x30,0xff,0xfc,0x0b,0x6d,0x00,0x12,0x0b,0xdd,0x3d,
-0x14,0xa0,0x17,0x0c,0x10,0x0e,0x05,0x03,0x12,0x07,0x3f,0x10,0x14,0x70,0xdb,0x01,
-0x00,0xd6,0x48,0x00,0x92,0x04,0x15,0xf3,0x06,0x02,0x02,0x27,0x15,0x01,0x09,0x00,
-0x15,0xf9,0x66,0x0c,0x14,0xbf,0xcd,0x15,0x17,0xbf,0xd6,0x15,0x14,0x8f,0x6c,0x0a,
-0x17,0x7f,0x90,0x15,0x14,0x4f,0x80,0x02,0x17,0x4f,0x36,0x3c,0x17,0x1f,0xdf,0x13,
-0x05,0x4c,0x03,0x14,0x0d,0x05,0x38,0x17,0x0c,0xa3,0x02,0x14,0x09,0x9f,0x02,0x16,
-0x08,0xb1,0x3d,0x02,0xd8,0x09,0x14,0x50,0xee,0x02,0x17,0x60,0x41,0x16,0x01,0x67,
-0x03,0x08,0xc2,0x02,0x00,0x3c,0x3f,0x05,0xff,0x3d,0x07,0x1d,0x1f,0x19,0xf9,0x69,
-0x12,0x15,0x0e,0x1c,0x09,0x22,0x09,0xff,0xba,0x44,0x03,0x09,0x0e,0x14,0x2f,0x71,
-0x15,0x24,0xff,0x30,0xf7,0x00,0x11,0x40,0x15,0x00,0x16,0xc0,0xd5,0x3f,0x13,0x09,
-0xe1,0x00,0x12,0x0c,0x45,0x00,0x13,0x01,0x73,0x00,0x13,0x5f,0x65,0x04,0x12,0x6f,
-0xac,0x00,0x13,0xdf,0x2d,0x03,0x11,0x0c,0xdc,0x00,0x14,0x06,0x0c,0x01,0x02,0xbc,
-0x25,0x06,0x4a,0x05,0x10,0x9f,0xbb,0x10,0x15,0x7f,0x1c,0x0e,0x10,0x1f,0x49,0x50,
-0x06,0x4d,0x01,0x10,0x07,0x72,0x00,0x07,0xc0,0x03,0x1a,0xdf,0x88,0x2b,0x1a,0x4f,
-0x64,0x17,0x1a,0x0a,0xf7,0x2a,0x1b,0x01,0xf5,0x2a,0x15,0x8f,0x31,0x01,0x06,0xf0,
-0x3d,0x1a,0x30,0x48,0x04,0x19,0xc0,0x16,0x04,0x0c,0xd0,0x17,0x19,0xfe,0x59,0x00,
-0x05,0x5b,0x00,0x01,0xdc,0x19,0x06,0x9a,0x0a,0x01,0xb0,0x35,0x06,0xdb,0x40,0x01,
-0x08,0x01,0x14,0x6f,0x9c,0x1a,0x02,0xbf,0x41,0x14,0x0d,0xd3,0x00,0x11,0x1e,0x6f,
-0x01,0x05,0x39,0x41,0x12,0x9f,0x37,0x04,0x12,0xcf,0x0f,0x01,0x16,0x03,0xd4,0x03,
-0x03,0x49,0x17,0x23,0xff,0xf3,0x6f,0x00,0x12,0xf5,0x67,0x01,0x03,0xc4,0x4a,0x04,
-0xba,0x43,0x14,0x10,0xe6,0x00,0x25,0x80,0x09,0x43,0x01,0x10,0x1e,0x99,0x00,0x04,
-0xb7,0x1a,0x02,0x51,0x01,0x10,0xfb,0xd6,0x01,0x07,0xbf,0x41,0x19,0x2f,0x27,0x40,
-0x25,0xd0,0x0a,0x2d,0x00,0x01,0xb3,0x0c,0x15,0x02,0xc6,0x02,0x14,0xbf,0x94,0x28,
-0x14,0xfc,0x7f,0x02,0x12,0xf4,0x31,0x02,0x13,0x40,0x48,0x02,0x16,0xc0,0x28,0x42,
-0x12,0x1f,0x5c,0x01,0x13,0x01,0x17,0x01,0x03,0xd0,0x36,0x04,0x71,0x10,0x04,0xcf,
-0x13,0x02,0xf8,0x07,0x14,0x07,0x0d,0x02,0x15,0x08,0xb4,0x10,0x15,0x20,0x37,0x10,
-0x07,0x91,0x40,0x10,0x7f,0x3a,0x02,0x14,0xdf,0x68,0x01,0x00,0x28,0x00,0x11,0xfe,
-0x58,0x05,0x06,0x2b,0x02,0x17,0x5b,0x60,0x2b,0x11,0xef,0x35,0x11,0x18,0xf9,0x54,
-0x2d,0x0a,0xd2,0x3a,0x08,0x7e,0x0f,0x2a,0x06,0xff,0x1c,0x02,0x19,0xdf,0x97,0x4e,
-0x01,0xdb,0x02,0x1a,0xf1,0x33,0x06,0x1d,0x80,0x6d,0x22,0x0f,0x0f,0x00,0x95,0x18,
-0x4f,0x63,0x0c,0x19,0x54,0xf4,0x2c,0x0f,0x1b,0x00,0x14,0x33,0xfe,0x13,0xbb,0x01,
-0x00,0x18,0xdf,0xba,0x2e,0x18,0x0e,0xb8,0x3b,0x18,0x0a,0x76,0x07,0x18,0x05,0x93,
-0x07,0x01,0x98,0x3a,0x08,0xb8,0x23,0x19,0xfd,0x00,0x50,0x18,0x30,0xc3,0x41,0x06,
-0x73,0x4d,0x08,0x9d,0x03,0x05,0x14,0x0a,0x04,0xc3,0x02,0x18,0xf6,0xfe,0x07,0x18,
-0xfb,0xe2,0x03,0x28,0xfe,0x10,0xc4,0x01,0x18,0x40,0x3d,0x53,0x18,0x90,0x89,0x11,
-0x18,0xd0,0x0c,0x33,0x1e,0xf3,0xfc,0x07,0x03,0x15,0x02,0x19,0xfd,0x4d,0x04,0x18,
-0x20,0x42,0x43,0x18,0x70,0x07,0x01,0x18,0xc0,0x07,0x01,0x18,0xf1,0x07,0x01,0x14,
-0xfe,0x3b,0x01,0x28,0x71,0xef,0xf9,0x0d,0x09,0x7a,0x01,0x2f,0xb4,0xff,0x1b,0x00,
-0x14,0x11,0x3f,0xf0,0x04,0x01,0x0c,0x00,0x0f,0x0b,0x00,0x01,0x21,0xb4,0x43,0x70,
-0x2f,0x02,0x0e,0x46,0x0f,0x0b,0x00,0xab,0x3f,0xfb,0x44,0x33,0xe7,0x00,0x06,0x01,
-0x92,0x43,0x1e,0xf1,0xff,0x3d,0x16,0x1f,0xb0,0x01,0x16,0x0a,0xfd,0x01,0x07,0x33,
-0x04,0x08,0xe0,0x44,0x16,0x8f,0x46,0x02,0x16,0x2f,0x53,0x06,0x16,0x0c,0xe6,0x01,
-0x17,0x06,0xf5,0x03,0x07,0xdc,0x02,0x07,0xe3,0x41,0x16,0x4f,0xa0,0x26,0x07,0x79,
-0x3e,0x07,0x1d,0x0b,0x17,0x01,0x1a,0x02,0x04,0xee,0x3b,0x0a,0x20,0x32,0x16,0x0f,
-0x65,0x06,0x16,0x09,0x5b,0x03,0x17,0x03,0x7d,0x47,0x16,0xdf,0xeb,0x00,0x1e,0x7f,
-0xeb,0x00,0x03,0xce,0x02,0x1e,0x30,0xf3,0x3e,0x07,0xeb,0x00,0x16,0x9f,0x7f,0x0b,
-0x0f,0xeb,0x00,0x0e,0x1f,0x01,0xeb,0x00,0x0e,0x16,0x0e,0xeb,0x00,0x1a,0x08,0x9d,
-0x08,0x04,0xeb,0x00,0x41,0x68,0x88,0x88,0x70,0x37,0x09,0x11,0x7b,0x83,0x0d,0x0c,
-0x0b,0x00,0x21,0x72,0x44,0x6f,0x0c,0x14,0x05,0x42,0x47,0x0f,0x0b,0x00,0xa9,0x2e,
-0x24,0x48,0xe7,0x00,0x09,0x0b,0x00,0x02,0x74,0x01,0x14,0x20,0xe2,0x01,0x16,0xf9,
-0x30,0x28,0x05,0xa6,0x06,0x05,0xe3,0x47,0x15,0xfd,0x76,0x29,0x03,0xd1,0x4b,0x15,
-0xfc,0x2f,0x53,0x01,0x3a,0x35,0x00,0x5b,0x02,0x12,0xa0,0x39,0x3b,0x41,0xdf,0xff,
-0xf4,0x04,0xc5,0x04,0x32,0x4f,0xff,0xfd,0x86,0x36,0x21,0x0b,0xff,0xbc,0x56,0x30,
-0xfb,0x00,0x01,0x2c,0x05,0x10,0x01,0x36,0x02,0x10,0x8f,0x1b,0x05,0x00,0x18,0x00,
-0x02,0x90,0x50,0x42,0x5f,0xff,0xfe,0x05,0x78,0x00,0x62,0xef,0xff,0xf5,0xcf,0xff,
-0xf9,0x92,0x00,0x25,0xc0,0x55,0x01,0x00,0x26,0x51,0xff,0xa3,0x47,0x0f,0x0b,0x00,
-0x19,0x42,0x35,0x55,0x55,0x53,0x82,0x0f,0x00,0xe5,0x54,0x02,0x09,0x02,0x15,0x04,
-0x57,0x29,0x21,0xfe,0x10,0x29,0x02,0x16,0xfa,0x70,0x53,0x12,0x0b,0x63,0x02,0x00,
-0x70,0x2f,0x27,0xc8,0x30,0x0a,0x21,0x23,0xfc,0x30,0x16,0x2e,0x04,0x8b,0x09,0x17,
-0x2f,0xe7,0x23,0x16,0xdf,0xa1,0x17,0x10,0x05,0xa6,0x05,0x34,0x21,0x26,0xef,0x57,
-0x3a,0x13,0x50,0xd1,0x0e,0x45,0x0b,0xee,0xee,0xee,0x3d,0x0d,0x07,0x9f,0x0e,0x19,
-0x00,0x82,0x34,0x44,0x00,0x37,0xad,0xef,0xbc,0x1e,0x16,0x5d,0xa4,0x21,0x17,0x0b,
-0xb0,0x21,0x16,0xcf,0x0c,0x00,0x10,0x07,0x6c,0x00,0x12,0x30,0x3c,0x00,0x12,0x0e,
-0x6a,0x03,0x01,0x0c,0x00,0x03,0x27,0x56,0x01,0x0c,0x00,0x03,0xc0,0x49,0x01,0x0c,
-0x00,0x03,0x8f,0x04,0x01,0x5d,0x03,0x03,0x9e,0x14,0x13,0xaf,0x3d,0x41,0x41,0xff,
-0xd6,0x44,0x8e,0x54,0x00,0x17,0x0b,0x72,0x5a,0x18,0x02,0xbb,0x21,0x15,0x4f,0x2d,
-0x2d,0x13,0x60,0x42,0x32,0x11,0x73,0xd2,0x03,0x00,0xd0,0x40,0x21,0xeb,0x71,0xf6,
-0x42,0x08,0x56,0x46,0x0f,0x0c,0x00,0x5e,0x43,0x6b,0xef,0xec,0x83,0x0c,0x00,0x11,
-0x4e,0x67,0x40,0x01,0x0c,0x00,0x23,0xfb,0xff,0xc3,0x15,0x17,0x6f,0xcf,0x22,0x17,
-0x6f,0x9d,0x11,0x01,0x0c,0x00,0x21,0xb9,0x9d,0x72,0x09,0x12,0x6f,0x37,0x00,0x22,
-0x5f,0xff,0x31,0x49,0x14,0xfc,0xc4,0x1d,0x04,0x6c,0x00,0x00,0xb7,0x04,0x04,0x0c,
-0x00,0x12,0xaf,0xc2,0x5b,0x04,0xb2,0x55,0x14,0xf5,0x0c,0x00,0x1a,0x5f,0x0c,0x00,
-0x1f,0xf6,0x0c,0x00,0x0d,0x08,0x3c,0x00,0x17,0x9f,0x54,0x00,0x03,0x6c,0x00,0x08,
-0x84,0x00,0x23,0xff,0xa0,0xdd,0x07,0x15,0x6f,0xa1,0x43,0x2d,0xff,0x10,0xcc,0x00,
-0x06,0xe4,0x00,0x13,0xf8,0xb8,0x1b,0x00,0x0c,0x00,0x26,0xd0,0x6f,0x14,0x01,0x66,
-0xc0,0x01,0x7c,0xef,0xed,0x93,0x1c,0x1a,0x03,0x72,0x47,0x16,0x2a,0x10,0x1e,0x16,
-0x4f,0xae,0x12,0x16,0x5f,0xc7,0x12,0x16,0x2f,0x2f,0x1d,0x11,0x0c,0x5c,0x4c,0x10,
-0xbf,0x6a,0x00,0x12,0x03,0x4f,0x09,0x10,0x3e,0x80,0x02,0x03,0x99,0x44,0x00,0x8b,
-0x37,0x00,0x11,0x0b,0x03,0xfa,0x0d,0x13,0xa2,0xe5,0x06,0x47,0x08,0xdd,0xdd,0xd9,
-0x6d,0x48,0x17,0x05,0x14,0x0a,0x07,0x9b,0x49,0x17,0x06,0xc6,0x09,0x1a,0x5f,0xd0,
-0x4d,0x1b,0x70,0x1e,0x42,0x55,0x13,0x33,0x33,0x20,0xef,0x93,0x57,0x13,0xfb,0x6f,
-0x03,0x14,0x01,0x68,0x1f,0x11,0x40,0xed,0x17,0x11,0xf5,0x32,0x03,0x21,0xc8,0x8b,
-0x9a,0x0c,0x17,0x02,0xc9,0x4e,0x17,0x05,0x4c,0x17,0x17,0x05,0x45,0x0d,0x26,0x02,
-0xaf,0x2e,0x42,0x00,0x3b,0x1d,0x13,0xec,0xad,0x43,0x0f,0xd7,0x02,0x63,0x00,0x68,
-0x5b,0x23,0xfe,0xb6,0x0c,0x00,0x11,0x09,0x93,0x1e,0x02,0x0c,0x00,0x14,0xcf,0x44,
-0x25,0x19,0xf6,0xbe,0x4c,0x17,0x6f,0x0c,0x00,0x10,0xff,0xf5,0x47,0x24,0x9b,0xff,
-0xc8,0x29,0x12,0xf7,0xed,0x1d,0x23,0xf6,0x0c,0xe9,0x00,0x00,0x6c,0x2e,0x04,0xf7,
-0x19,0x00,0x54,0x00,0x04,0xde,0x38,0x17,0x6f,0xed,0x49,0x17,0x6f,0xab,0x02,0x03,
-0x0c,0x00,0x1f,0xf5,0x0c,0x00,0x01,0x17,0x5f,0x24,0x00,0x04,0xe4,0x01,0x0c,0x54,
-0x00,0x01,0x7b,0x2e,0x03,0x0c,0x00,0x13,0x0b,0xd6,0x07,0x00,0x84,0x00,0x12,0x05,
-0x52,0x05,0x11,0x1a,0x07,0x00,0x10,0xef,0xb4,0x00,0x1e,0x8a,0xcc,0x00,0x06,0x98,
-0x04,0x05,0xfc,0x00,0x00,0x95,0x4a,0x03,0x9f,0x05,0x25,0xe5,0x0e,0x2c,0x01,0x33,
-0xc7,0x10,0x0c,0x8c,0x00,0x43,0x5a,0xde,0xfe,0xda,0x04,0x1a,0x16,0x7e,0x28,0x19,
-0x16,0x1c,0x1d,0x1d,0x05,0xa6,0x15,0x17,0xd0,0xbb,0x1a,0x12,0xfa,0xfa,0x0b,0x34,
-0xea,0x89,0xdf,0xcc,0x1d,0x13,0xf8,0x52,0x22,0x13,0x06,0xc8,0x02,0x00,0x28,0x12,
-0x13,0x0b,0xb0,0x05,0x00,0xf8,0x55,0x07,0x5d,0x51,0x10,0xf7,0x5c,0x16,0x52,0xaa,
-0xaa,0xaa,0xaa,0xaf,0xff,0x23,0x05,0x55,0x00,0x1e,0x4f,0x44,0x0b,0x06,0x35,0x0b,
-0x03,0x0c,0x00,0x17,0x2f,0x53,0x30,0x07,0x7c,0x09,0x06,0x2e,0x0d,0x12,0x01,0xc1,
-0x09,0x02,0xd9,0x59,0x03,0x3c,0x23,0x10,0x50,0x54,0x1b,0x01,0xb6,0x26,0x00,0x97,
-0x51,0x11,0x9b,0x2b,0x00,0x17,0x0b,0x8c,0x45,0x06,0x8a,0x16,0x16,0x40,0xba,0x1b,
-0x16,0xe3,0x27,0x1e,0x03,0x52,0x0c,0x54,0x37,0xbd,0xff,0xfd,0xa5,0x71,0x00,0x44,
-0x25,0x78,0x76,0x30,0x9b,0x16,0x14,0xf3,0x23,0x20,0x14,0xf2,0x7f,0x24,0x14,0xf2,
-0xa4,0x3f,0x14,0xf2,0xba,0x0e,0x12,0xf2,0x9e,0x0f,0x22,0xa3,0x10,0xc8,0x1c,0x05,
-0x40,0x4a,0x24,0xf5,0x00,0x6f,0x47,0x08,0x09,0x00,0x14,0x5f,0x90,0x00,0x0f,0x09,
-0x00,0x11,0x0e,0x3f,0x00,0x0f,0x09,0x00,0x9a,0x61,0x00,0x16,0xbd,0xff,0xda,0x50,
-0x93,0x65,0x02,0xfb,0x1c,0x21,0xfd,0x38,0x0c,0x00,0x14,0x9f,0xd7,0x25,0x19,0xfc,
-0xcf,0x4d,0x17,0x3f,0x0c,0x00,0x10,0xdf,0x13,0x02,0x01,0x07,0x1c,0x22,0xfc,0x03,
-0xa2,0x1c,0x10,0x05,0xc8,0x11,0x04,0x6b,0x39,0x13,0x4f,0xb5,0x2d,0x13,0x30,0x7d,
-0x15,0x04,0x75,0x0b,0x03,0x1e,0x4c,0x14,0xfa,0x0c,0x00,0x04,0x8d,0x03,0x00,0x0c,
-0x00,0x04,0xa5,0x03,0x0c,0x0c,0x00,0x08,0x24,0x00,0x04,0x15,0x3d,0x03,0x54,0x00,
-0x05,0x36,0x54,0x03,0xa6,0x55,0x01,0x0c,0x00,0x04,0x58,0x11,0x13,0x3f,0x9c,0x00,
-0x12,0xfa,0xc7,0x49,0x02,0xee,0x60,0x02,0x39,0x03,0x0a,0xcc,0x00,0x18,0x07,0xf1,
-0x1f,0x14,0x8f,0x26,0x0d,0x13,0xfc,0x98,0x23,0x23,0xfa,0x0f,0xe8,0x06,0x48,0xbd,
-0xff,0xd9,0x30,0x57,0x4b,0x02,0x3d,0x04,0x13,0x02,0x60,0x0c,0x00,0xab,0x02,0x23,
-0x7e,0x20,0xb4,0x0f,0x00,0x31,0x66,0x13,0xf6,0xce,0x03,0x10,0xe0,0x22,0x03,0x32,
-0xe8,0x65,0x6a,0xe3,0x03,0x17,0x7f,0x78,0x3d,0x17,0x6f,0x88,0x26,0x27,0x05,0xef,
-0x16,0x21,0x16,0x19,0x11,0x4b,0x01,0xc1,0x08,0x02,0x29,0x4b,0x16,0x9f,0x07,0x0d,
-0x17,0x09,0xfd,0x0f,0x0f,0x17,0x00,0x4e,0x42,0x49,0xdf,0xfe,0xb6,0x17,0x00,0x22,
-0x31,0xbf,0xa8,0x21,0x00,0x16,0x0d,0x12,0xef,0x02,0x03,0x17,0x09,0x52,0x2b,0x16,
-0x9f,0x05,0x05,0x01,0x17,0x00,0x34,0xea,0x9a,0xdf,0x62,0x4e,0x12,0x70,0x59,0x01,
-0x13,0x09,0xe7,0x04,0x12,0xdf,0x6c,0x51,0x13,0xf3,0xc0,0x0a,0x13,0x49,0x73,0x00,
-0x00,0x6e,0x08,0x03,0x17,0x00,0x00,0xce,0x04,0x13,0x59,0x17,0x00,0x1f,0x6f,0x17,
-0x00,0x91,0x41,0x00,0x9d,0xfd,0x60,0x2d,0x49,0x00,0x40,0x05,0x01,0xf7,0x55,0x00,
-0xb9,0x21,0x00,0xea,0x00,0x4b,0x80,0x01,0x9e,0xfe,0xa0,0x48,0x01,0x47,0x02,0x03,
-0xf3,0x20,0x0f,0x09,0x00,0x56,0x00,0x59,0x02,0x23,0xef,0xc5,0xbe,0x09,0x14,0x60,
-0xff,0x23,0x01,0x81,0x01,0x15,0xf0,0x0e,0x00,0x11,0x01,0x1c,0x00,0x00,0xef,0x06,
-0x1f,0xd6,0x9a,0x45,0x06,0x03,0x4d,0x00,0x0f,0x07,0x00,0xa9,0x03,0x4b,0x1a,0x01,
-0xd4,0x1b,0x33,0x13,0x12,0x7f,0x2b,0x2b,0x00,0x6e,0x08,0x12,0x3f,0x66,0x07,0x12,
-0x3f,0x30,0x0d,0x12,0x3f,0xf1,0x02,0x12,0x3f,0x80,0x67,0x4b,0x03,0x67,0x76,0x30,
-0x06,0x09,0x18,0x06,0x3b,0x14,0x0f,0x19,0x00,0x58,0x10,0x3f,0x18,0x08,0x03,0x19,
-0x00,0x11,0x2e,0x43,0x04,0x02,0x19,0x00,0x11,0x0d,0x15,0x07,0x15,0x06,0x69,0x07,
-0x13,0xf5,0x32,0x00,0x25,0x08,0xff,0x2a,0x08,0x23,0x60,0x06,0xc3,0x18,0x00,0x19,
-0x00,0x17,0x03,0x0e,0x69,0x11,0x62,0x56,0x3c,0x03,0x19,0x00,0x03,0x59,0x17,0x01,
-0x19,0x00,0x05,0x74,0x32,0x17,0x6f,0xd2,0x21,0x18,0x06,0xd7,0x25,0x17,0x6f,0xda,
-0x29,0x18,0x06,0x99,0x2f,0x16,0x6f,0x1c,0x4f,0x02,0x19,0x00,0x16,0xef,0x34,0x03,
-0x44,0xff,0xd1,0xaf,0xff,0x58,0x63,0x24,0xff,0xd1,0xec,0x14,0x01,0xaf,0x00,0x12,
-0x06,0x4d,0x00,0x06,0xc8,0x00,0x14,0xd0,0xfa,0x00,0x02,0xeb,0x14,0x03,0xfa,0x00,
-0x02,0x0d,0x19,0x03,0x13,0x01,0x00,0xa9,0x65,0x04,0x19,0x00,0x02,0x3b,0x19,0x03,
-0x19,0x00,0x10,0x09,0x8e,0x03,0x04,0x45,0x01,0x14,0x1e,0x14,0x03,0x0f,0x04,0x00,
-0x79,0x10,0x6f,0x83,0x03,0x53,0x49,0xde,0xfe,0xc7,0x10,0x94,0x07,0x01,0xc8,0x00,
-0x22,0x02,0xbf,0x0b,0x0c,0x21,0x7f,0xff,0x4f,0x4f,0x15,0x6f,0x76,0x05,0x22,0x50,
-0xaf,0xd3,0x24,0x16,0x06,0x7d,0x05,0x03,0x6e,0x23,0x01,0xae,0x23,0x0a,0x01,0x00,
-0x11,0x16,0xd1,0x02,0x21,0x9a,0xef,0x27,0x00,0x32,0xa9,0xae,0xff,0x1b,0x0b,0x00,
-0x63,0x0b,0x16,0x9f,0xfd,0x54,0x16,0xa6,0x7f,0x34,0x12,0xfa,0xdb,0x06,0x13,0xfd,
-0x3d,0x01,0x04,0x4b,0x0a,0x00,0xa7,0x3a,0x03,0x43,0x01,0x03,0x0f,0x54,0x12,0x0d,
-0x16,0x66,0x05,0xc0,0x0f,0x03,0x64,0x1f,0x0f,0x25,0x00,0xff,0x03,0x10,0x8f,0xc2,
-0x02,0x02,0xe1,0x01,0x00,0x8a,0x03,0x02,0xe7,0x25,0x11,0x60,0x8a,0x09,0x03,0xa7,
-0x1b,0x07,0xd2,0x32,0x26,0x10,0x8f,0x36,0x0f,0x11,0x08,0x49,0x07,0x32,0x99,0xdf,
-0xff,0x4b,0x5f,0x22,0xff,0x90,0xf5,0x02,0x16,0x08,0x25,0x0d,0x26,0xf3,0x8f,0x49,
-0x07,0x17,0x48,0x91,0x06,0x16,0x8f,0xa8,0x06,0x1f,0x58,0x17,0x00,0x99,0x03,0x01,
-0x5e,0x28,0xda,0x61,0xea,0x33,0x22,0xf9,0x10,0x9a,0x67,0x06,0xc7,0x2f,0x17,0x3f,
-0x39,0x0c,0x17,0x1e,0x06,0x2c,0x11,0x0a,0x0b,0x53,0x11,0xae,0x10,0x1c,0x12,0x02,
-0xa0,0x04,0x11,0x08,0x04,0x10,0x12,0x9f,0xdb,0x02,0x01,0x97,0x53,0x04,0x89,0x15,
-0x00,0xf4,0x0d,0x05,0x7f,0x15,0x00,0x34,0x11,0x03,0xd2,0x68,0x01,0x95,0x00,0x14,
-0x66,0x77,0x05,0x00,0x15,0x00,0x17,0x7f,0x94,0x1d,0x14,0x86,0x04,0x10,0x00,0x42,
-0x20,0x04,0xaa,0x0a,0x00,0x02,0x10,0x14,0x74,0x0d,0x16,0x00,0x14,0x02,0x04,0xca,
-0x21,0x01,0xa6,0x20,0x16,0xdf,0x6e,0x66,0x26,0xf0,0x09,0xa9,0x0d,0x13,0xfb,0x7c,
-0x2c,0x03,0xf3,0x3c,0x00,0xc5,0x03,0x21,0xe9,0x89,0x35,0x09,0x07,0x30,0x2f,0x17,
-0xf2,0x50,0x3e,0x17,0xf4,0x62,0x2b,0x24,0xe3,0x00,0xa0,0x45,0x04,0x1d,0x6e,0x00,
-0xc2,0x3c,0x23,0xed,0xb6,0xc2,0x05,0x35,0xe0,0x01,0x7c,0x74,0x12,0x26,0xf0,0x7f,
-0x60,0x11,0x1e,0xfa,0x74,0x12,0x17,0xc0,0x0c,0x00,0x12,0xf7,0x0c,0x00,0x25,0xa9,
-0xae,0xc0,0x11,0x03,0x73,0x02,0x26,0x60,0x6f,0x41,0x01,0x26,0xc0,0x6f,0x4d,0x23,
-0x05,0x74,0x12,0x12,0xbf,0xd6,0x5b,0x14,0xf6,0x63,0x0c,0x07,0x99,0x0f,0x0e,0x74,
-0x12,0x0e,0xbd,0x0f,0x1e,0xf5,0x3c,0x00,0x02,0x5e,0x53,0x0b,0x6c,0x00,0x14,0xfb,
-0x65,0x48,0x03,0x9c,0x00,0x01,0x30,0x1e,0x11,0x6f,0xf6,0x01,0x24,0x9d,0xff,0x41,
-0x1e,0x0e,0x70,0x10,0x34,0xb0,0x00,0x6f,0x7c,0x33,0x12,0xfc,0x7c,0x00,0x13,0x5e,
-0x53,0x11,0x01,0x60,0x00,0x12,0x7b,0x51,0x6e,0x0f,0x24,0x14,0x65,0x04,0x1d,0x10,
-0x16,0x0a,0x49,0x11,0x11,0xf7,0x29,0x10,0x03,0x21,0x0f,0x1c,0x9e,0x49,0x11,0x16,
-0x7f,0x0c,0x00,0x21,0x01,0xff,0x95,0x10,0x17,0xef,0x49,0x11,0x18,0x09,0x49,0x11,
-0x1b,0xaf,0x49,0x11,0x1f,0x3f,0x49,0x11,0x37,0x1f,0xf8,0x49,0x11,0x15,0x16,0xbf,
-0x49,0x11,0x17,0x09,0x49,0x11,0x1f,0xef,0x49,0x11,0x11,0x16,0xcf,0x14,0x01,0x27,
-0xe5,0x6f,0x49,0x11,0x0f,0xd0,0x15,0x69,0x10,0x6f,0x99,0x40,0x11,0x8d,0xea,0x05,
-0x52,0x14,0xff,0xff,0xfe,0x6f,0x70,0x3b,0x13,0xe6,0x86,0x04,0x03,0xd1,0x00,0x09,
-0x0f,0x00,0x30,0xec,0xbb,0xb6,0x77,0x03,0x13,0x30,0xec,0x5f,0x06,0xd6,0x09,0x03,
-0x5b,0x00,0x0f,0x0f,0x00,0x5e,0x00,0x47,0x01,0x14,0xbe,0x23,0x60,0x24,0x2c,0xff,
-0x9c,0x64,0x16,0x06,0x85,0x11,0x15,0x5f,0xa2,0x33,0x24,0x01,0xef,0x8a,0x44,0x01,
-0xfc,0x72,0x11,0xb2,0x92,0x14,0x22,0xf5,0x0b,0x06,0x12,0x00,0x18,0x04,0x12,0x0d,
-0x1c,0x04,0x03,0x8b,0x0f,0x10,0xfd,0xa6,0x04,0x46,0x22,0x22,0x21,0x0a,0xc9,0x31,
-0x11,0x03,0xc8,0x06,0x17,0x63,0x87,0x39,0x26,0xfa,0x50,0xe2,0x6f,0x01,0xeb,0x0e,
-0x17,0x4d,0xe0,0x5b,0x26,0x4a,0xef,0x30,0x5d,0x36,0x02,0x6a,0xef,0x14,0x1f,0x10,
-0x05,0x7c,0x2e,0x42,0x57,0x77,0x77,0x50,0xcb,0x09,0x22,0xfd,0x9f,0x61,0x15,0x00,
-0x8b,0x00,0x03,0xe0,0x00,0x13,0x0e,0xd7,0x47,0x11,0x81,0x6b,0x6e,0x25,0xf8,0x07,
-0xd5,0x40,0x36,0xf2,0x00,0xaf,0xad,0x2c,0x16,0x09,0x66,0x02,0x03,0x79,0x00,0x11,
-0xfb,0x6a,0x1a,0x23,0x38,0xce,0x22,0x30,0x10,0x00,0x22,0x63,0x03,0x77,0x04,0x1f,
-0xb0,0x08,0x00,0x17,0x16,0xcf,0x2a,0x43,0x0f,0x08,0x00,0x0a,0x0e,0x58,0x00,0x0f,
-0x08,0x00,0x44,0x04,0xf8,0x0c,0x05,0x45,0x32,0x00,0x4d,0x01,0x26,0xba,0xb3,0xc4,
-0x61,0x04,0x7c,0x25,0x14,0x0b,0x84,0x25,0x04,0x03,0x62,0x53,0x04,0xad,0xff,0xec,
-0x92,0xee,0x0e,0x17,0x07,0xee,0x0e,0x07,0xa6,0x0f,0x0f,0x17,0x00,0x87,0x16,0x8f,
-0x17,0x00,0x13,0x58,0xaf,0x07,0x03,0xcc,0x18,0x13,0xf9,0xd5,0x0a,0x12,0x54,0x55,
-0x02,0x23,0x1a,0xff,0x88,0x31,0x37,0xfb,0x99,0xbf,0x5c,0x0b,0x01,0x0d,0x01,0x07,
-0xe0,0x74,0x02,0x9f,0x51,0x03,0xd1,0x62,0x02,0x24,0x03,0x11,0x72,0x58,0x00,0x72,
-0x01,0x7b,0xef,0xfd,0xb6,0x10,0x0f,0x73,0x00,0x14,0xf8,0x43,0x2f,0x04,0x1c,0x66,
-0x00,0xf1,0x5a,0x04,0xe1,0x1e,0x13,0xdf,0xc0,0x39,0x13,0x50,0x7f,0x0e,0x03,0x7a,
-0x66,0x02,0x90,0x03,0x02,0x29,0x18,0x02,0x74,0x1b,0x02,0x33,0x69,0x11,0x0f,0x0b,
-0x03,0x14,0x3f,0x0c,0x50,0x11,0xf6,0xda,0x02,0x11,0xfb,0x1f,0x07,0x03,0x50,0x3f,
-0x01,0x6e,0x02,0x12,0xc0,0x5c,0x03,0x23,0x40,0x01,0xd7,0x03,0x13,0xef,0xac,0x76,
-0x12,0x10,0x7e,0x00,0x35,0xc0,0x09,0xff,0x6a,0x6e,0x23,0xf1,0x0e,0x4a,0x13,0x12,
-0x0e,0xca,0x24,0x04,0x98,0x39,0x14,0xfa,0x1f,0x62,0x00,0xce,0x72,0x16,0xbf,0x00,
-0x74,0x18,0xff,0x58,0x4c,0x07,0x28,0x74,0x06,0xf3,0x51,0x17,0x0e,0x37,0x58,0x17,
-0x09,0x15,0x26,0x18,0x04,0x75,0x51,0x17,0xff,0xff,0x21,0x03,0xf1,0x0d,0x09,0xda,
-0x61,0x12,0x3f,0xdd,0x03,0x11,0x0f,0x26,0x00,0x13,0x01,0x0a,0x37,0x11,0x80,0x45,
-0x00,0x02,0xd1,0x53,0x01,0x15,0x3d,0x13,0xfb,0xd0,0x00,0x03,0x87,0x5f,0x02,0xc2,
-0x28,0x03,0xb0,0x1c,0x11,0xbf,0x8f,0x7a,0x00,0xf4,0x00,0x12,0x01,0xbc,0x02,0x01,
-0x70,0x17,0x14,0x0f,0x1a,0x64,0x23,0xff,0x90,0x7b,0x73,0x01,0xdc,0x00,0x12,0x0b,
-0x9e,0x26,0x10,0x5f,0x41,0x00,0x15,0x07,0x27,0x33,0x13,0xf2,0x69,0x1d,0x10,0x3f,
-0x17,0x00,0x12,0x3f,0xbf,0x00,0x11,0xcf,0x52,0x01,0x00,0x58,0x00,0x12,0x08,0x99,
-0x04,0x12,0x0f,0x0b,0x54,0x00,0x58,0x00,0x10,0xcf,0xb6,0x3b,0x22,0xf0,0x02,0x02,
-0x05,0x00,0xc3,0x64,0x11,0x1f,0x35,0x29,0x24,0x40,0x5f,0xbd,0x54,0x92,0xfb,0x05,
-0xff,0xff,0xb0,0x9f,0xff,0xf9,0x09,0x64,0x04,0x11,0x0f,0x7c,0x39,0x10,0xf7,0x7a,
-0x1e,0x11,0xcf,0x0f,0x01,0x00,0x8d,0x00,0x51,0x1e,0xff,0xff,0x20,0x0f,0x3d,0x38,
-0x12,0xe0,0xac,0x02,0x12,0xf8,0x52,0x28,0x16,0xfa,0x58,0x3c,0x00,0x02,0x2a,0x16,
-0x06,0xc9,0x27,0x03,0xf2,0x0a,0x15,0x1f,0x78,0x01,0x22,0x0b,0xff,0xbf,0x11,0x01,
-0x42,0x35,0x05,0x19,0x24,0x18,0xfa,0x14,0x29,0x13,0x03,0x3e,0x00,0x15,0x3f,0xfe,
-0x23,0x17,0x0f,0x86,0x41,0x17,0x20,0xb0,0x26,0x07,0x8a,0x24,0x02,0x60,0x26,0x08,
-0xe4,0x66,0x12,0x4f,0x52,0x03,0x16,0x01,0x3f,0x06,0x06,0xb6,0x28,0x04,0xe7,0x0c,
-0x00,0x67,0x03,0x01,0x8e,0x36,0x03,0xef,0x47,0x02,0xfc,0x5d,0x02,0x0c,0x52,0x02,
-0x20,0x00,0x11,0x03,0x57,0x11,0x01,0x34,0x1c,0x03,0x6c,0x2d,0x13,0x01,0xe2,0x26,
-0x01,0xc6,0x4e,0x04,0x66,0x37,0x00,0x08,0x00,0x05,0x54,0x39,0x00,0xbd,0x15,0x04,
-0x5a,0x0b,0x18,0x06,0x9c,0x75,0x1b,0x0c,0xe7,0x3d,0x06,0x9d,0x15,0x08,0xb1,0x28,
-0x18,0x02,0x47,0x75,0x17,0x6f,0x9c,0x28,0x17,0x1e,0x62,0x18,0x17,0x08,0x02,0x5b,
-0x18,0x02,0x02,0x68,0x17,0xaf,0x1d,0x40,0x12,0x4f,0x66,0x06,0x14,0xfc,0x7c,0x00,
-0x26,0x50,0xcf,0x53,0x07,0x14,0xc0,0x0e,0x34,0x01,0xff,0x15,0x03,0x46,0x2e,0x02,
-0xcc,0x27,0x02,0xc9,0x00,0x03,0xa6,0x4f,0x14,0x9f,0x66,0x75,0x17,0x90,0xa2,0x4f,
-0x13,0xf1,0xab,0x04,0x26,0xc0,0xcf,0x54,0x09,0x13,0xfd,0x25,0x01,0x02,0x4c,0x00,
-0x04,0xf7,0x2f,0x01,0xa5,0x00,0x03,0xc1,0x49,0x14,0x4f,0xe5,0x6a,0x14,0xb0,0x5d,
-0x61,0x12,0x1f,0x10,0x03,0x02,0xf9,0x27,0x14,0xbf,0x75,0x28,0x13,0xfd,0xb0,0x52,
-0x02,0x46,0x2d,0x04,0x9c,0x2d,0x02,0xaf,0x2e,0x02,0x07,0x00,0x16,0x0f,0xa0,0x60,
-0x12,0x70,0xa2,0x21,0x03,0xa4,0x14,0x16,0xaf,0xbe,0x6d,0x10,0xf1,0x59,0x07,0x04,
-0x1a,0x1d,0x14,0x53,0xe0,0x03,0x12,0x0f,0x36,0x51,0x15,0xf1,0xde,0x03,0x04,0x84,
-0x01,0x18,0x05,0x7f,0x2a,0x18,0x0f,0x52,0x28,0x26,0xaf,0xff,0xb4,0x55,0x18,0x04,
-0xa4,0x2a,0x08,0xf1,0x2b,0x05,0xa6,0x2d,0x1b,0x00,0xcb,0x2b,0x28,0x00,0x0e,0x27,
-0x26,0x07,0x30,0x77,0x05,0x56,0x2e,0x04,0x9d,0x17,0x17,0xf0,0x04,0x27,0x18,0xfb,
-0xf6,0x26,0x17,0x50,0x99,0x26,0x13,0xf0,0xbc,0x23,0x25,0x24,0xaf,0xe9,0x02,0x16,
-0x03,0x96,0x3c,0x03,0x56,0x02,0x17,0xb0,0x19,0x00,0x17,0xe1,0x1c,0x2f,0x17,0xe3,
-0xff,0x62,0x15,0xa1,0x25,0x4c,0x3a,0x67,0x75,0x10,0x3b,0x29,0x01,0xa5,0x02,0x0f,
-0x0b,0x00,0x18,0x21,0xf2,0x07,0xe1,0x4e,0x15,0xcf,0xd0,0x00,0x03,0x9a,0x39,0x05,
-0x77,0x2a,0x0c,0x57,0x27,0x16,0x03,0x06,0x03,0x16,0x1e,0xaf,0x00,0x15,0xbf,0xd3,
-0x27,0x1a,0x06,0x15,0x43,0x16,0x80,0xd9,0x78,0x06,0xdf,0x21,0x17,0xe1,0xad,0x31,
-0x05,0x06,0x03,0x0f,0x75,0x00,0x09,0x10,0x04,0x6f,0x03,0x01,0xa9,0x00,0x26,0x86,
-0x1e,0x41,0x19,0x1f,0x4f,0x0b,0x00,0x18,0x02,0xdc,0x00,0x13,0x50,0xdf,0x1f,0x03,
-0x92,0x2b,0x15,0xf6,0x01,0x2f,0x01,0x04,0x02,0x16,0xf9,0x2e,0x65,0x12,0x0c,0x10,
-0x06,0x16,0x02,0xbd,0x6d,0x12,0xa0,0x77,0x06,0x03,0x84,0x7b,0x01,0x22,0x02,0x16,
-0x0b,0x8d,0x0e,0x0f,0x0f,0x00,0x0b,0x03,0xf8,0x76,0x01,0x57,0x0a,0x03,0x5c,0x03,
-0x00,0xf1,0x80,0x02,0x07,0x3e,0x12,0xf6,0xf4,0x00,0x16,0xfb,0x26,0x29,0x04,0xd7,
-0x65,0x03,0x8a,0x01,0x13,0x0e,0x1d,0x01,0x14,0x03,0xe9,0x25,0x02,0x9b,0x06,0x01,
-0xd2,0x03,0x17,0x10,0x40,0x76,0x03,0x69,0x00,0x0f,0x96,0x00,0x13,0x03,0xc3,0x00,
-0x16,0x09,0xa1,0x1e,0x17,0xa0,0xf0,0x00,0x16,0x0d,0x43,0x0f,0x13,0xe2,0x3d,0x00,
-0x14,0xe6,0x6f,0x58,0x02,0x3e,0x00,0x02,0x95,0x07,0x14,0x5d,0x15,0x02,0x20,0x70,
-0x00,0x5b,0x06,0x1f,0xf2,0x05,0x00,0x4c,0x53,0xbb,0xbb,0x10,0x00,0x50,0x5c,0x02,
-0x23,0xf9,0x20,0x09,0x08,0x13,0x70,0x2b,0x01,0x17,0x90,0x51,0x33,0x04,0x1e,0x5e,
-0x16,0x0a,0x90,0x77,0x17,0xf0,0x63,0x77,0x16,0x0a,0x66,0x22,0x12,0x70,0xb4,0x03,
-0x13,0xf8,0x70,0x02,0x1f,0x80,0x0f,0x00,0x0e,0x13,0x07,0x53,0x00,0x16,0x4f,0xe3,
-0x77,0x17,0x50,0x64,0x27,0x13,0x0d,0xd6,0x14,0x13,0x1c,0x1c,0x03,0x00,0x8e,0x21,
-0x04,0x35,0x57,0x02,0x42,0x07,0x12,0xfb,0x7f,0x05,0x15,0x82,0x1c,0x19,0x25,0x00,
-0x4f,0x94,0x07,0x04,0x90,0x06,0x1f,0x90,0x96,0x00,0x16,0x12,0x9f,0x0f,0x00,0x04,
-0xd2,0x00,0x03,0x00,0x5e,0x12,0x1f,0xf0,0x00,0x03,0xd0,0x25,0x16,0x04,0xb6,0x34,
-0x00,0x2c,0x00,0x06,0x9a,0x00,0x11,0x80,0xc9,0x00,0x12,0xfb,0x7f,0x04,0x15,0x82,
-0x09,0x2c,0x39,0x58,0x87,0x30,0x77,0x33,0x11,0xe5,0x1f,0x3a,0x22,0xcc,0xc7,0x04,
-0x07,0x03,0x98,0x11,0x25,0x80,0x0a,0x44,0x1c,0x12,0xef,0xba,0x3a,0x02,0x73,0x0e,
-0x00,0xc9,0x45,0x04,0xd7,0x35,0x10,0xc9,0x47,0x5a,0x63,0x1f,0xff,0xff,0xe4,0x02,
-0x9f,0x63,0x14,0x11,0x04,0x1d,0x04,0x03,0x41,0x25,0x03,0x6f,0x5d,0x12,0x3e,0x04,
-0x05,0x12,0x07,0xf7,0x00,0x12,0x1b,0x6c,0x7c,0x41,0x01,0x11,0x10,0x00,0x18,0x0c,
-0x21,0xfe,0xc7,0x09,0x00,0x45,0x4b,0xef,0xd9,0x10,0x64,0x2f,0x02,0x72,0x07,0xc0,
-0x04,0xff,0xff,0xa8,0xcf,0xff,0xd0,0x0b,0xff,0xf4,0x00,0x09,0x7b,0x20,0x00,0x13,
-0x33,0x20,0xf8,0x0f,0xd2,0x01,0x50,0xdf,0xf9,0x0f,0xff,0x90,0x0e,0x00,0x30,0x0b,
+0xd1,0x07,0x02,0x27,0x05,0x13,0x3a,0x44,0x03,0x12,0x20,0x11,0x01,0x90,0x59,0xce,
+0xff,0xfe,0xc9,0x61,0x00,0x00,0x00,0x28,0x1f,0xff,0x01,0x00,0x19,0xb1,0x0e,0x00,
+0x1f,0xfb,0x1d,0x00,0x18,0x20,0xb0,0xbb,0x01,0x00,0x40,0xef,0xff,0xff,0xfc,0x08,
+0x00,0x20,0xb8,0x00,0x01,0x00,0x65,0x0c,0xff,0xff,0xff,0x40,0x00,0x01,0x00,0x46,
+0xcf,0xff,0xff,0xf4,0x0e,0x00,0x0f,0x1d,0x00,0xff,0x62,0x41,0x4f,0xff,0xff,0xfc,
+0x09,0x00,0x91,0x02,0xff,0xff,0xff,0xe4,0xff,0xff,0xff,0xc0,0x0e,0x00,0x4f,0x2f,
+0xff,0xff,0xfe,0x1b,0x00,0xff,0x05,0x95,0x03,0xff,0xff,0xff,0xd2,0xff,0xff,0xff,
+0xd0,0x40,0x01,0x00,0xf7,0x02,0x10,0x10,0x0d,0x00,0x91,0x07,0xff,0xff,0xff,0xa0,
+0xdf,0xff,0xff,0xf7,0x1b,0x00,0x90,0xdf,0xff,0xff,0xf6,0x08,0xff,0xff,0xff,0xf2,
+0x0d,0x00,0xe0,0x8f,0xff,0xff,0xff,0x20,0x2f,0xff,0xff,0xff,0xf6,0x00,0x00,0x02,
+0xaf,0x1e,0x03,0x20,0x00,0xaf,0x25,0x03,0x20,0xcb,0xbd,0x06,0x00,0x45,0xf3,0x00,
+0x01,0xdf,0x38,0x03,0x54,0xf8,0x00,0x00,0x02,0xef,0x0d,0x00,0x63,0xf9,0x00,0x00,
+0x00,0x01,0xbf,0x0d,0x00,0x02,0x58,0x00,0x12,0x6d,0x0d,0x00,0x22,0xa2,0x00,0x8f,
+0x00,0x50,0x7b,0xde,0xff,0xec,0x95,0x7f,0x00,0x14,0xaf,0x87,0x00,0x02,0xee,0x01,
+0x62,0xf1,0x4f,0xff,0xff,0xff,0x60,0x10,0x00,0x10,0x1f,0x71,0x00,0x11,0x0e,0x76,
+0x00,0x01,0x01,0x00,0xa2,0x5f,0xff,0xff,0xff,0x50,0x09,0xff,0xff,0xff,0xf0,0x10,
+0x00,0x00,0x3b,0x00,0x35,0x00,0x04,0xff,0x32,0x02,0x72,0xff,0xff,0xff,0xfa,0x00,
+0x00,0xef,0x7f,0x00,0x14,0x00,0x1a,0x00,0x41,0x9f,0xff,0xff,0xfe,0x10,0x00,0x00,
+0xd6,0x00,0x80,0xe0,0x00,0x00,0x3f,0xff,0xff,0xff,0x30,0x10,0x00,0x52,0x0d,0xff,
+0xff,0xff,0x90,0x07,0x00,0x13,0x70,0x30,0x01,0x00,0x19,0x00,0x14,0x08,0x41,0x01,
+0x12,0x7f,0x39,0x00,0x10,0x02,0x96,0x00,0x03,0x7e,0x02,0x14,0xf8,0x22,0x01,0x00,
+0xe0,0x00,0x01,0x02,0x01,0x01,0x28,0x00,0x00,0x77,0x00,0x24,0x00,0x05,0x5e,0x01,
+0x10,0x2f,0x97,0x00,0x77,0x00,0x00,0x0a,0xff,0xff,0xff,0x80,0xc5,0x02,0x10,0x0e,
+0x4c,0x01,0x04,0x70,0x01,0x17,0x90,0xc4,0x02,0x12,0x01,0x98,0x00,0x14,0x8f,0x2a,
+0x01,0x21,0x00,0xbf,0x7e,0x01,0x13,0xdf,0x77,0x00,0x30,0x00,0x00,0x6f,0x1a,0x00,
+0x15,0x02,0xd8,0x01,0x20,0x00,0x1f,0x3a,0x00,0x16,0x07,0x28,0x01,0x10,0x0b,0x43,
+0x01,0x16,0x0b,0x48,0x01,0x10,0x05,0x28,0x01,0x44,0x1f,0xff,0xff,0xfb,0x38,0x03,
+0x00,0xe1,0x01,0x65,0x5f,0xff,0xff,0xf5,0x00,0x00,0x39,0x01,0x25,0xf0,0xaf,0x47,
+0x01,0x01,0x8b,0x00,0x53,0xf4,0xef,0xff,0xff,0xa0,0x10,0x00,0x00,0xab,0x00,0x18,
+0xfc,0x7a,0x03,0x00,0x74,0x01,0x04,0x46,0x01,0x04,0x5a,0x01,0x04,0x66,0x01,0x01,
+0x01,0x00,0x01,0xf9,0x01,0x07,0xb8,0x03,0x22,0x9f,0xff,0xd4,0x00,0x04,0x01,0x00,
+0x22,0x3f,0xff,0xf4,0x00,0x04,0x01,0x00,0x24,0x0d,0xff,0x85,0x01,0x15,0x00,0x9b,
+0x01,0x16,0xfd,0x0f,0x00,0x01,0xed,0x00,0x15,0xf8,0xed,0x00,0x14,0xfe,0xc5,0x00,
+0x13,0x20,0x6c,0x00,0x23,0xf1,0x0d,0xed,0x00,0x10,0x04,0xea,0x00,0x04,0x43,0x01,
+0x13,0x09,0xb3,0x00,0x13,0x08,0x6c,0x00,0x10,0x04,0xf7,0x00,0x13,0x06,0xde,0x01,
+0x13,0x0b,0x9e,0x01,0x10,0x07,0x10,0x00,0x13,0x02,0x54,0x02,0x13,0x0f,0xdb,0x01,
+0x11,0x0a,0x8e,0x00,0x03,0xb3,0x00,0x13,0x3f,0xcb,0x00,0x11,0x0d,0xc7,0x01,0x12,
+0xbf,0x22,0x00,0x13,0x7f,0x91,0x00,0x11,0x0f,0xb5,0x01,0x12,0x8f,0x22,0x00,0x10,
+0xaf,0x3e,0x06,0x02,0x32,0x00,0x11,0xf8,0x45,0x01,0x14,0xf7,0x0b,0x01,0x02,0xb5,
+0x01,0x11,0xf5,0xbe,0x00,0x12,0xfa,0xcf,0x00,0x01,0xf0,0x00,0x11,0x9f,0x4e,0x00,
+0x11,0x0d,0xed,0x00,0x11,0x05,0x15,0x00,0x11,0x60,0x58,0x02,0x12,0xe0,0x64,0x01,
+0x01,0x06,0x00,0x11,0xfe,0x89,0x01,0x11,0xff,0x06,0x00,0x10,0x06,0x37,0x00,0x00,
+0x30,0x00,0x10,0xba,0x24,0x00,0x12,0x02,0xcc,0x00,0x10,0x02,0x37,0x00,0x00,0x5a,
+0x00,0x10,0x76,0x4e,0x00,0x13,0x05,0x4a,0x01,0x00,0xf5,0x00,0x00,0x84,0x00,0x10,
+0x32,0x78,0x00,0x00,0x03,0x01,0x03,0x4a,0x02,0x10,0xc0,0xae,0x00,0x63,0x00,0xef,
+0xff,0xf9,0x00,0x0b,0x71,0x02,0x10,0x8f,0xfa,0x01,0x93,0xcf,0xff,0xfb,0x00,0xbf,
+0xff,0xfc,0x00,0x0e,0x69,0x01,0x10,0x4f,0x74,0x02,0x30,0xff,0xff,0xf8,0xea,0x00,
+0x23,0x00,0x1f,0x2c,0x02,0x00,0x08,0x00,0x40,0x03,0xff,0xff,0xf4,0xe2,0x00,0x22,
+0x40,0x4f,0x90,0x02,0x00,0x8e,0x00,0x50,0xf8,0x07,0xff,0xff,0xf0,0x0c,0x01,0x22,
+0x70,0x7f,0xe7,0x01,0x00,0xb8,0x00,0x50,0xfc,0x0b,0xff,0xff,0xc0,0x65,0x00,0x23,
+0xb0,0xaf,0x4b,0x02,0x00,0xbe,0x00,0x10,0x0e,0x05,0x03,0x00,0x2f,0x00,0x13,0xdf,
+0x66,0x03,0x00,0xbe,0x00,0x40,0x4f,0xff,0xff,0x40,0x92,0x04,0x14,0xf3,0x06,0x02,
+0x00,0xbe,0x00,0x31,0xbf,0xff,0xff,0x09,0x00,0x13,0xf9,0xbc,0x00,0x01,0xbe,0x00,
+0x02,0xb3,0x00,0x05,0x09,0x00,0x03,0x93,0x04,0x23,0xff,0xf8,0x93,0x01,0x04,0x25,
+0x02,0x14,0x4f,0x80,0x02,0x01,0x09,0x00,0x16,0xf5,0x3f,0x04,0x01,0xb3,0x00,0x14,
+0x0f,0x09,0x00,0x04,0x7a,0x02,0x13,0xc0,0x96,0x03,0x27,0xff,0xe0,0xe0,0x02,0x13,
+0x90,0x3b,0x02,0x04,0x07,0x03,0x23,0x06,0xff,0x5d,0x02,0x13,0x04,0xa8,0x01,0x04,
+0xbe,0x00,0x02,0x67,0x03,0x08,0xc2,0x02,0x14,0xef,0xbe,0x02,0x15,0xcf,0xbc,0x00,
+0x01,0xb5,0x00,0x14,0xf9,0xb2,0x00,0x13,0xfc,0x56,0x03,0x25,0xff,0xf2,0x70,0x00,
+0x22,0xf7,0x05,0xaf,0x04,0x03,0x31,0x04,0x34,0xd0,0x00,0xbf,0x51,0x00,0x11,0xbf,
+0xc8,0x02,0x13,0x2f,0xa8,0x00,0x12,0x03,0x27,0x00,0x13,0x09,0xe1,0x00,0x12,0x0c,
+0x45,0x00,0x13,0x01,0x73,0x00,0x13,0x5f,0x65,0x04,0x12,0x6f,0xac,0x00,0x13,0xdf,
+0x2d,0x03,0x11,0x0c,0xdc,0x00,0x14,0x06,0x0c,0x01,0x11,0x03,0x86,0x05,0x06,0x4a,
+0x05,0x00,0x13,0x05,0x24,0x10,0x7f,0x51,0x03,0x01,0x29,0x01,0x16,0x81,0x4d,0x01,
+0x10,0x07,0x72,0x00,0x07,0xc0,0x03,0x03,0xe4,0x05,0x16,0x60,0x2d,0x04,0x06,0x8e,
+0x01,0x02,0x3c,0x03,0x03,0x09,0x05,0x04,0xcd,0x04,0x08,0xeb,0x03,0x15,0x8f,0x31,
+0x01,0x05,0xb3,0x05,0x2a,0xff,0x30,0x48,0x04,0x19,0xc0,0x16,0x04,0x24,0xff,0xf6,
+0x0f,0x00,0x19,0x7f,0x76,0x04,0x13,0x01,0x4e,0x06,0x16,0x90,0x77,0x00,0x15,0xf9,
+0x51,0x01,0x01,0xb5,0x03,0x25,0x70,0xef,0x97,0x00,0x01,0x08,0x01,0x03,0x14,0x01,
+0x02,0xca,0x01,0x34,0xf6,0x00,0x0d,0xd3,0x00,0x11,0x1e,0x6f,0x01,0x14,0x04,0xf1,
+0x00,0x12,0x9f,0x37,0x04,0x12,0xcf,0x0f,0x01,0x16,0x03,0xd4,0x03,0x22,0xff,0xb0,
+0x49,0x01,0x13,0xf3,0x6f,0x00,0x12,0xf5,0x67,0x01,0x13,0xa0,0x07,0x02,0x11,0xfe,
+0x85,0x01,0x24,0xff,0x10,0xe6,0x00,0x25,0x80,0x09,0x43,0x01,0x10,0x1e,0x99,0x00,
+0x15,0x3f,0x43,0x01,0x10,0x07,0x54,0x00,0x00,0xd6,0x01,0x06,0xf6,0x00,0x24,0xf5,
+0x2f,0x76,0x06,0x01,0x63,0x00,0x25,0xd0,0x0a,0x2d,0x00,0x10,0x3f,0xb6,0x00,0x15,
+0x02,0xc6,0x02,0x11,0xbf,0xd4,0x00,0x13,0xaf,0xda,0x00,0x12,0x02,0x06,0x02,0x13,
+0x2f,0xea,0x04,0x12,0x09,0x3e,0x01,0x13,0x09,0xd9,0x01,0x12,0x1f,0x5c,0x01,0x13,
+0x01,0x17,0x01,0x13,0x8f,0x02,0x06,0x12,0x8f,0x68,0x02,0x13,0xef,0xa6,0x01,0x02,
+0xf8,0x07,0x14,0x07,0x0d,0x02,0x11,0x08,0x42,0x02,0x05,0x9d,0x06,0x11,0x01,0x5f,
+0x07,0x14,0x5f,0x9b,0x02,0x00,0x85,0x01,0x10,0xf7,0x4f,0x01,0x15,0xf2,0x1a,0x06,
+0x11,0xfe,0x58,0x05,0x06,0x2b,0x02,0x15,0x5b,0x48,0x02,0x01,0x64,0x00,0x05,0x7f,
+0x07,0x03,0x96,0x02,0x05,0x7a,0x03,0x02,0x01,0x03,0x03,0x14,0x07,0x05,0x61,0x03,
+0x07,0x1c,0x02,0x16,0xdf,0x83,0x02,0x04,0xee,0x07,0x1a,0xf1,0x33,0x06,0x1a,0x80,
+0x1a,0x0a,0x1f,0x60,0x0f,0x00,0x97,0x18,0x4f,0x63,0x0c,0x18,0x54,0x0d,0x00,0x1f,
+0xf5,0x1b,0x00,0x14,0x33,0xfe,0x13,0xbb,0x01,0x00,0x14,0xdf,0xd8,0x02,0x04,0x54,
+0x01,0x18,0xa0,0x8c,0x03,0x05,0x76,0x07,0x18,0x05,0x93,0x07,0x28,0x01,0xef,0x5c,
+0x01,0x18,0xbf,0x6e,0x07,0x18,0x7f,0x92,0x03,0x06,0x97,0x02,0x03,0x73,0x01,0x18,
+0xc0,0xa3,0x07,0x18,0xf2,0xb9,0x03,0x18,0xf6,0xfe,0x07,0x18,0xfb,0xe2,0x03,0x28,
+0xfe,0x10,0xc4,0x01,0x05,0x46,0x08,0x18,0x1e,0x19,0x04,0x04,0x90,0x07,0x05,0x47,
+0x02,0x1e,0xf3,0xfc,0x07,0x03,0x15,0x02,0x19,0xfd,0x4d,0x04,0x27,0x20,0x00,0x88,
+0x04,0x18,0x70,0x07,0x01,0x18,0xc0,0x07,0x01,0x18,0xf1,0x07,0x01,0x14,0xfe,0x3b,
+0x01,0x28,0x71,0xef,0xf9,0x0d,0x09,0x7a,0x01,0x2f,0xb4,0xff,0x1b,0x00,0x14,0x11,
+0x3f,0xf0,0x04,0x01,0x0c,0x00,0x0f,0x0b,0x00,0x01,0x30,0xb4,0x43,0x3f,0x02,0x03,
+0x11,0x03,0xed,0x00,0x0f,0x0b,0x00,0xab,0x3f,0xfb,0x44,0x33,0xe7,0x00,0x03,0x50,
+0xff,0xff,0xff,0xff,0xff,0x52,0xcf,0xff,0xff,0xf1,0x00,0x01,0x00,0x43,0x6f,0xff,
+0xff,0xf7,0x0b,0x00,0x43,0x1f,0xff,0xff,0xfd,0x0b,0x00,0x52,0x0a,0xff,0xff,0xff,
+0x40,0x0b,0x00,0x53,0x04,0xff,0xff,0xff,0xa0,0x17,0x00,0x43,0xef,0xff,0xff,0xf0,
+0x0b,0x00,0x43,0x8f,0xff,0xff,0xf6,0x0b,0x00,0x43,0x2f,0xff,0xff,0xfc,0x0b,0x00,
+0x52,0x0c,0xff,0xff,0xff,0x20,0x0b,0x00,0x53,0x06,0xff,0xff,0xff,0x80,0x17,0x00,
+0x43,0xff,0xff,0xff,0xe0,0x0b,0x00,0x43,0xaf,0xff,0xff,0xf4,0x0b,0x00,0x43,0x4f,
+0xff,0xff,0xfa,0x0b,0x00,0x52,0x0d,0xff,0xff,0xff,0x10,0x0b,0x00,0x52,0x07,0xff,
+0xff,0xff,0x60,0x0b,0x00,0x53,0x01,0xff,0xff,0xff,0xc0,0x22,0x00,0x43,0xbf,0xff,
+0xff,0xf3,0x0b,0x00,0x43,0x5f,0xff,0xff,0xf9,0x0b,0x00,0x43,0x0f,0xff,0xff,0xfe,
+0x0b,0x00,0x52,0x09,0xff,0xff,0xff,0x50,0x0b,0x00,0x53,0x03,0xff,0xff,0xff,0xb0,
+0x17,0x00,0x16,0xdf,0xeb,0x00,0x1f,0x7f,0xeb,0x00,0x02,0x52,0x0b,0xff,0xff,0xff,
+0x30,0x0b,0x00,0x5e,0x05,0xff,0xff,0xff,0x90,0xeb,0x00,0x4f,0x9f,0xff,0xff,0xf5,
+0xeb,0x00,0x15,0x1f,0x01,0xeb,0x00,0x0e,0x16,0x0e,0xeb,0x00,0x16,0x08,0xeb,0x00,
+0x17,0x02,0xeb,0x00,0xa0,0x68,0x88,0x88,0x70,0xbf,0xff,0xff,0xff,0xff,0x7b,0x05,
+0x00,0x1c,0xf7,0x0b,0x00,0x30,0x72,0x44,0x8f,0xc9,0x00,0x00,0xad,0x00,0x3f,0x70,
+0x00,0x5f,0x0b,0x00,0xab,0x2e,0x24,0x48,0xe7,0x00,0x09,0x0b,0x00,0x02,0x74,0x01,
+0x14,0x20,0xe2,0x01,0x15,0xf9,0x50,0x02,0x14,0xf0,0xbe,0x02,0x24,0xff,0x60,0x8e,
+0x01,0x14,0xfd,0xfc,0x01,0x22,0xff,0xf3,0x7f,0x01,0x11,0xfc,0xba,0x02,0x00,0xed,
+0x01,0x10,0x1f,0x74,0x01,0x00,0x5b,0x02,0x41,0xa0,0xaf,0xff,0xf7,0x16,0x02,0x50,
+0xf4,0x04,0xff,0xff,0xd0,0x99,0x01,0x30,0xfd,0x00,0x0d,0xec,0x02,0x10,0x0b,0xc3,
+0x01,0x30,0x7f,0xff,0xfb,0xc2,0x01,0x30,0xf2,0x00,0x01,0x36,0x02,0x41,0x8f,0xff,
+0xfb,0x00,0x18,0x00,0x11,0x0e,0x5a,0x02,0x42,0x5f,0xff,0xfe,0x05,0x78,0x00,0x62,
+0xef,0xff,0xf5,0xcf,0xff,0xf9,0x92,0x00,0x25,0xc0,0x55,0x01,0x00,0x25,0x51,0xff,
+0x01,0x00,0x1f,0xf6,0x0b,0x00,0x19,0x80,0x35,0x55,0x55,0x53,0x00,0x00,0x02,0xef,
+0x79,0x00,0x01,0xc0,0x00,0x12,0xc0,0x76,0x03,0x11,0x60,0x5a,0x02,0x21,0xfe,0x10,
+0x29,0x02,0x12,0xfa,0x96,0x03,0x12,0xf4,0xb2,0x02,0x10,0xe0,0xae,0x02,0x55,0x9c,
+0xef,0xfe,0xc8,0x30,0x49,0x02,0x40,0xff,0xff,0xfc,0x30,0x00,0x01,0x13,0xef,0x56,
+0x00,0x02,0x3a,0x01,0x02,0x01,0x00,0x11,0x50,0x08,0x03,0x02,0x01,0x00,0x11,0xe1,
+0x7f,0x01,0x40,0xf8,0x21,0x26,0xef,0x5f,0x01,0x12,0x0a,0x1e,0x00,0x10,0x4f,0xd8,
+0x02,0x43,0x0b,0xee,0xee,0xee,0x8c,0x03,0x17,0x00,0x1d,0x03,0x17,0x10,0x14,0x04,
+0x00,0x89,0x01,0x21,0x37,0xad,0x63,0x00,0x00,0x0c,0x00,0x14,0x5d,0x55,0x00,0x11,
+0x20,0x2a,0x00,0x04,0x0c,0x00,0x16,0xcf,0x0c,0x00,0x10,0x07,0x6c,0x00,0x12,0x30,
+0x3c,0x00,0x12,0x0e,0x6a,0x03,0x01,0x0c,0x00,0x15,0x3f,0xd2,0x00,0x32,0xff,0x20,
+0x5f,0xae,0x00,0x01,0x0c,0x00,0x03,0x8f,0x04,0x01,0x5d,0x03,0x12,0x4f,0xd3,0x01,
+0x10,0xaf,0x0c,0x00,0x71,0x1f,0xff,0xff,0xff,0xd6,0x44,0x8e,0x54,0x00,0x26,0x0b,
+0xff,0x60,0x00,0x16,0x02,0x0c,0x00,0x31,0x40,0x00,0x4f,0x08,0x00,0x11,0xfe,0x3b,
+0x01,0x11,0x03,0xf1,0x00,0x12,0x73,0xd2,0x03,0x50,0x05,0xad,0xff,0xeb,0x71,0xd3,
+0x03,0x26,0xe0,0x6f,0xb7,0x04,0x1f,0x00,0x0c,0x00,0x5e,0x43,0x6b,0xef,0xec,0x83,
+0x0c,0x00,0x10,0x4e,0x9e,0x00,0x11,0xa1,0x0c,0x00,0x11,0xfb,0xb6,0x00,0x45,0xfd,
+0x10,0x00,0x6f,0xcb,0x00,0x17,0xd0,0x0c,0x00,0x12,0xf8,0x0c,0x00,0x30,0xb9,0x9d,
+0xff,0x8c,0x01,0x12,0x6f,0x37,0x00,0x10,0x5f,0x42,0x03,0x12,0x6f,0x8d,0x04,0x10,
+0x06,0x32,0x02,0x04,0x6c,0x00,0x00,0xb7,0x04,0x03,0x0c,0x00,0x00,0x39,0x01,0x13,
+0xf3,0x0c,0x00,0x00,0xfc,0x04,0x14,0xf5,0x0c,0x00,0x1a,0x5f,0x0c,0x00,0x1f,0xf6,
+0x0c,0x00,0x0d,0x08,0x3c,0x00,0x17,0x9f,0x54,0x00,0x03,0x6c,0x00,0x08,0x84,0x00,
+0x00,0x70,0x03,0x13,0x4f,0x9c,0x00,0x45,0xff,0xff,0xa8,0x9c,0xb4,0x00,0x09,0xcc,
+0x00,0x06,0xe4,0x00,0x12,0xf8,0xb2,0x01,0x10,0x20,0x0c,0x00,0x26,0xd0,0x6f,0x14,
+0x01,0x63,0xc0,0x01,0x7c,0xef,0xed,0x93,0x1b,0x05,0x42,0x7b,0xdf,0xfe,0xc9,0x8d,
+0x06,0x11,0x2a,0x2f,0x00,0x13,0xd5,0x52,0x05,0x22,0xff,0xff,0x11,0x04,0x15,0x5f,
+0x5e,0x00,0x06,0xf2,0x02,0x11,0xf4,0x43,0x02,0x30,0xfc,0x98,0xbf,0x6a,0x00,0x21,
+0x03,0xff,0x39,0x03,0x10,0x3e,0x80,0x02,0x12,0xaf,0xbd,0x00,0x52,0x3f,0xff,0xff,
+0xf7,0x0e,0x3d,0x06,0x00,0xaf,0x02,0x13,0xa2,0xe5,0x06,0x56,0x08,0xdd,0xdd,0xd9,
+0x4f,0x27,0x06,0x16,0x05,0xa1,0x05,0x26,0x00,0x6f,0x06,0x06,0x16,0x06,0x6b,0x06,
+0x01,0x4d,0x01,0x16,0x00,0x2a,0x07,0x16,0x70,0x29,0x06,0x01,0xac,0x04,0x40,0x13,
+0x33,0x33,0x20,0x78,0x02,0x02,0xe0,0x02,0x13,0xfb,0x6f,0x03,0x10,0x01,0x97,0x02,
+0x11,0x3f,0xb4,0x02,0x20,0x02,0xcf,0x41,0x00,0x00,0x32,0x03,0x20,0xc8,0x8b,0x0b,
+0x01,0x01,0x0a,0x06,0x04,0xb6,0x03,0x14,0x05,0x0b,0x00,0x00,0xc4,0x02,0x06,0x0b,
+0x00,0x31,0x00,0x02,0xaf,0x33,0x02,0x02,0x15,0x01,0x66,0x27,0xbd,0xff,0xec,0x94,
+0x00,0x01,0x00,0x0f,0xe3,0x02,0x60,0x43,0x28,0xce,0xfe,0xb6,0x0c,0x00,0x10,0x09,
+0x9a,0x00,0x12,0xe4,0x0c,0x00,0x02,0x08,0x04,0x10,0xbf,0x0c,0x00,0x16,0x0c,0xef,
+0x04,0x27,0x00,0x6f,0x0c,0x00,0x00,0x06,0x00,0x21,0xd9,0x9b,0x0c,0x00,0x12,0x06,
+0xf0,0x05,0x10,0x1b,0x0c,0x00,0x12,0x0c,0xe9,0x00,0x00,0x42,0x00,0x23,0xf6,0x0f,
+0x84,0x04,0x00,0x54,0x00,0x44,0x2f,0xff,0xff,0xfb,0x78,0x00,0x11,0x5f,0xf2,0x01,
+0x02,0x0c,0x00,0x04,0x94,0x00,0x03,0x0c,0x00,0x1f,0xf5,0x0c,0x00,0x01,0x17,0x5f,
+0x24,0x00,0x04,0xe4,0x01,0x0c,0x54,0x00,0x00,0x6c,0x00,0x04,0x0c,0x00,0x13,0x0b,
+0xd6,0x07,0x00,0x84,0x00,0x12,0x05,0x52,0x05,0x11,0x1a,0x07,0x00,0x10,0xef,0xb4,
+0x00,0x1e,0x8a,0xcc,0x00,0x06,0x98,0x04,0x05,0xfc,0x00,0x11,0x7f,0x0c,0x00,0x01,
+0x9f,0x05,0x25,0xe5,0x0e,0x2c,0x01,0x33,0xc7,0x10,0x0c,0x8c,0x00,0x52,0x5a,0xde,
+0xfe,0xda,0x61,0x4b,0x01,0x34,0x7e,0xff,0xff,0x40,0x02,0x22,0x1c,0xff,0xd0,0x05,
+0x55,0x10,0x00,0x00,0x01,0xdf,0x2f,0x03,0x06,0x44,0x01,0x11,0xfa,0x94,0x03,0x41,
+0xff,0xea,0x89,0xdf,0x43,0x02,0x11,0xef,0x09,0x01,0x10,0x06,0xf5,0x08,0x12,0x06,
+0xc8,0x02,0x00,0x9e,0x09,0x22,0xf0,0x0b,0xb0,0x05,0x00,0x8b,0x02,0x22,0xf4,0x0f,
+0xb8,0x08,0x00,0x30,0x09,0xe6,0xf7,0x2f,0xff,0xff,0xfe,0xaa,0xaa,0xaa,0xaa,0xaf,
+0xff,0xff,0xf9,0x3f,0x3f,0x05,0x26,0xfa,0x4f,0x0c,0x00,0x18,0xfb,0x0c,0x00,0x17,
+0x3f,0x0c,0x00,0x16,0x2f,0xc8,0x08,0x08,0x7c,0x09,0x24,0x00,0x0c,0x29,0x03,0x12,
+0x01,0xc1,0x09,0x10,0xe2,0x0c,0x00,0x21,0x1d,0x90,0xe9,0x02,0x72,0xfe,0x50,0x00,
+0x00,0x06,0xef,0xf7,0xb4,0x00,0x31,0xfd,0x98,0x9b,0x2b,0x00,0x06,0x2c,0x01,0x16,
+0xe0,0xe4,0x00,0x00,0x73,0x0a,0x13,0x0a,0x0b,0x00,0x10,0xe3,0x42,0x00,0x14,0x4c,
+0xd8,0x03,0x10,0x00,0x78,0x06,0x44,0xbd,0xff,0xfd,0xa5,0x71,0x00,0x31,0x25,0x78,
+0x76,0xfb,0x06,0x13,0x6d,0xee,0x07,0x00,0x36,0x02,0x00,0x3f,0x07,0x02,0x78,0x01,
+0x12,0xf2,0x86,0x00,0x01,0x09,0x00,0x14,0x0e,0x09,0x00,0x00,0xc8,0x00,0x32,0xa3,
+0x10,0x10,0x74,0x05,0x04,0xc4,0x0a,0x14,0xf5,0x09,0x00,0x18,0xf4,0x09,0x00,0x14,
+0x5f,0x90,0x00,0x0f,0x09,0x00,0x11,0x0e,0x3f,0x00,0x0f,0x09,0x00,0x9a,0x71,0x00,
+0x16,0xbd,0xff,0xda,0x50,0x06,0x21,0x02,0x20,0x06,0xef,0xa3,0x01,0x11,0x38,0x0c,
+0x00,0x12,0x9f,0x84,0x02,0x00,0x0c,0x00,0x15,0x08,0xad,0x01,0x37,0xfc,0x00,0x3f,
+0x0c,0x00,0x10,0xdf,0x13,0x02,0x20,0x9a,0xdf,0x0c,0x00,0x10,0x03,0x0b,0x00,0x83,
+0x10,0x00,0x05,0xef,0xff,0xff,0xfc,0x0a,0xcc,0x0a,0x00,0x55,0x08,0x13,0x0e,0x5e,
+0x0b,0x00,0x81,0x02,0x04,0x75,0x0b,0x00,0x0c,0x00,0x03,0x00,0x08,0x01,0x0c,0x00,
+0x04,0x8d,0x03,0x00,0x0c,0x00,0x04,0xa5,0x03,0x0c,0x0c,0x00,0x08,0x24,0x00,0x13,
+0x3f,0x5c,0x05,0x03,0x54,0x00,0x14,0xfc,0x0c,0x00,0x13,0x0d,0xf1,0x02,0x00,0x0c,
+0x00,0x13,0x09,0x03,0x0c,0x12,0x3f,0x9c,0x00,0x00,0x6d,0x00,0x20,0x04,0xef,0x2c,
+0x00,0x15,0xcf,0x39,0x03,0x0a,0xcc,0x00,0x17,0x07,0x0c,0x00,0x21,0x00,0x8f,0x09,
+0x00,0x11,0xcf,0x0c,0x00,0x20,0x05,0xef,0x3f,0x00,0x13,0x0f,0xe8,0x06,0x56,0xbd,
+0xff,0xd9,0x30,0x0f,0x05,0x0c,0x12,0x00,0x3d,0x04,0x13,0x02,0x60,0x0c,0x00,0xab,
+0x02,0x20,0x7e,0x20,0x07,0x03,0x10,0xef,0x5f,0x01,0x33,0x02,0xff,0xf6,0xce,0x03,
+0x10,0xe0,0x22,0x03,0x32,0xe8,0x65,0x6a,0xe3,0x03,0x14,0x7f,0x6b,0x00,0x26,0xfd,
+0x00,0x41,0x04,0x13,0xe2,0x6b,0x00,0x03,0xf9,0x03,0x22,0x00,0x19,0x1b,0x07,0x01,
+0x7f,0x06,0x00,0xc1,0x08,0x33,0xfe,0xc8,0x40,0x80,0x07,0x07,0xf1,0x0c,0x03,0xb9,
+0x0c,0x0f,0x17,0x00,0x4f,0x42,0x49,0xdf,0xfe,0xb6,0x17,0x00,0x20,0x31,0xbf,0x97,
+0x00,0x11,0x30,0x16,0x0d,0x12,0xef,0x02,0x03,0x15,0x09,0x3c,0x01,0x36,0xfe,0x00,
+0x9f,0x05,0x05,0x01,0x17,0x00,0x11,0xea,0x20,0x02,0x22,0xc0,0x9f,0xdc,0x04,0x00,
+0x59,0x01,0x12,0x09,0xe7,0x04,0x00,0x3e,0x02,0x13,0xf3,0x73,0x00,0x00,0x61,0x02,
+0x13,0x49,0x73,0x00,0x00,0x6e,0x08,0x03,0x17,0x00,0x00,0xce,0x04,0x13,0x59,0x17,
+0x00,0x1f,0x6f,0x17,0x00,0x91,0x40,0x00,0x9d,0xfd,0x60,0x62,0x02,0x10,0x80,0x40,
+0x05,0x10,0x06,0x77,0x04,0x00,0x09,0x00,0x00,0xea,0x00,0x69,0x80,0x01,0x9e,0xfe,
+0x70,0x00,0x01,0x00,0x01,0x47,0x02,0x00,0x1c,0x01,0x0f,0x09,0x00,0x54,0x50,0x00,
+0xff,0xff,0xff,0xc0,0xf5,0x0d,0x00,0x00,0x00,0x19,0xef,0xc5,0x00,0x00,0x00,0x00,
+0xef,0xff,0xff,0x60,0x00,0x00,0x06,0xff,0xff,0xff,0xe0,0x00,0x00,0x08,0xff,0xff,
+0xff,0xf0,0x0e,0x00,0x12,0x01,0x1c,0x00,0x5f,0x00,0x1a,0xff,0xd6,0x00,0x01,0x00,
+0x05,0x4f,0xff,0xff,0xff,0xc0,0x07,0x00,0xac,0xf0,0x06,0x02,0xff,0xff,0xff,0xb0,
+0x00,0x00,0x07,0xff,0xff,0xff,0x90,0x13,0x12,0x7f,0xff,0xff,0xff,0x60,0x3f,0xff,
+0x01,0x00,0x11,0x10,0x07,0x00,0x21,0xfa,0x00,0x07,0x00,0x11,0xe1,0x07,0x00,0x21,
+0xfe,0x30,0x07,0x00,0xe4,0x91,0x00,0x00,0x03,0x67,0x76,0x30,0x00,0x00,0x00,0x6f,
+0xff,0xff,0xf6,0x0c,0x01,0x10,0x06,0x3b,0x00,0x04,0x0d,0x00,0x0f,0x19,0x00,0x58,
+0x00,0x92,0x00,0x13,0xd0,0x19,0x00,0x53,0x2e,0xff,0xff,0xff,0xe2,0x19,0x00,0x53,
+0x0d,0xff,0xff,0xff,0xf3,0x32,0x00,0x53,0x0b,0xff,0xff,0xff,0xf5,0x32,0x00,0x00,
+0xe6,0x01,0x13,0xf8,0x4b,0x00,0x11,0x06,0xe2,0x00,0x02,0x19,0x00,0x53,0x03,0xff,
+0xff,0xff,0xfc,0x64,0x00,0x63,0x62,0xef,0xff,0xff,0xfe,0x10,0x19,0x00,0x53,0xcf,
+0xff,0xff,0xff,0x20,0x19,0x00,0x53,0xef,0xff,0xff,0xff,0x40,0x7d,0x00,0x00,0x01,
+0x00,0x13,0x70,0x96,0x00,0x00,0x01,0x00,0x27,0xf9,0x00,0x19,0x00,0x17,0xf3,0x19,
+0x00,0x27,0xff,0xd0,0x19,0x00,0x24,0xff,0x80,0x19,0x00,0x00,0x4c,0x00,0x13,0x30,
+0x19,0x00,0x53,0xd1,0xaf,0xff,0xff,0xfd,0x19,0x00,0x10,0xd1,0x7a,0x02,0x14,0xf8,
+0xe1,0x00,0x12,0x06,0x4d,0x00,0x06,0xc8,0x00,0x14,0xd0,0xfa,0x00,0x11,0x2f,0x80,
+0x00,0x03,0xfa,0x00,0x11,0x7f,0xa5,0x00,0x03,0x13,0x01,0x10,0xdf,0xca,0x00,0x03,
+0x19,0x00,0x00,0xd7,0x00,0x14,0xf7,0x19,0x00,0x54,0x09,0xff,0xff,0xff,0xf2,0x45,
+0x01,0x10,0x1e,0x01,0x02,0x4f,0x0f,0xff,0xff,0xfc,0x04,0x00,0x79,0x10,0x6f,0x83,
+0x03,0xc1,0x49,0xde,0xfe,0xc7,0x10,0x00,0x00,0x16,0xbd,0xff,0xda,0x50,0xc8,0x00,
+0x20,0x02,0xbf,0x31,0x01,0x11,0x50,0xe6,0x00,0x20,0xff,0xc1,0xce,0x00,0x31,0xf5,
+0xef,0xff,0x13,0x00,0x11,0xaf,0x07,0x00,0x13,0xd1,0x6a,0x01,0x00,0xa4,0x02,0x12,
+0xaf,0x08,0x00,0x3c,0xa0,0x6f,0xff,0x01,0x00,0x11,0x16,0xd1,0x02,0x21,0x9a,0xef,
+0x27,0x00,0x70,0xa9,0xae,0xff,0xff,0xff,0xf6,0x6f,0xf7,0x02,0x32,0x00,0x00,0x9f,
+0x14,0x02,0x52,0x0c,0xff,0xff,0xff,0xa6,0x10,0x03,0x12,0x00,0x1a,0x02,0x00,0x65,
+0x01,0x13,0xfd,0x3d,0x01,0x12,0x0b,0x08,0x02,0x00,0x1a,0x00,0x13,0xe6,0x43,0x01,
+0x52,0xaf,0xff,0xff,0xf2,0x00,0x6b,0x02,0x03,0x25,0x00,0x12,0x0a,0x25,0x00,0x00,
+0x83,0x01,0x1f,0xf6,0x25,0x00,0xff,0x03,0x10,0x8f,0xc2,0x02,0x02,0xe1,0x01,0x10,
+0x08,0xda,0x01,0x21,0xcf,0xff,0x24,0x00,0x42,0x8f,0xff,0xff,0xf4,0xa6,0x01,0x26,
+0x60,0x08,0xb2,0x01,0x25,0x10,0x8f,0x0b,0x00,0x11,0xf8,0x17,0x00,0x30,0xea,0x99,
+0xdf,0x03,0x03,0x12,0x8f,0xb7,0x01,0x00,0x0f,0x02,0x12,0x08,0x0b,0x00,0x62,0x00,
+0xcf,0xff,0xff,0xf3,0x8f,0x78,0x03,0x00,0x13,0x00,0x16,0x48,0x5d,0x03,0x13,0xf5,
+0x17,0x00,0x00,0x24,0x02,0x1f,0x58,0x17,0x00,0x99,0x92,0x00,0x00,0x00,0x01,0x6a,
+0xdf,0xfe,0xda,0x61,0xf0,0x04,0x12,0x08,0x66,0x04,0x10,0x10,0x0c,0x00,0x13,0x3e,
+0xed,0x02,0x00,0x2b,0x00,0x02,0xaf,0x05,0x02,0x99,0x04,0x15,0x1e,0x07,0x03,0x11,
+0x20,0x88,0x01,0x20,0xfe,0xa8,0xe7,0x02,0x11,0xfb,0xe6,0x05,0x12,0xf9,0x43,0x00,
+0x10,0xf4,0xee,0x02,0x13,0xfa,0x0d,0x04,0x50,0xa0,0x0e,0xff,0xff,0xff,0x52,0x00,
+0x10,0x0f,0x8c,0x01,0x03,0x19,0x06,0x00,0xaf,0x01,0x22,0xf3,0x4f,0x84,0x04,0x01,
+0x95,0x00,0x14,0x66,0x77,0x05,0x00,0x15,0x00,0x12,0x7f,0x9a,0x00,0x01,0x59,0x04,
+0x11,0x86,0x96,0x03,0x02,0x84,0x00,0x23,0xf8,0x5f,0xa9,0x05,0x53,0x04,0xff,0xff,
+0xff,0x74,0xe9,0x04,0x01,0x79,0x04,0x10,0x1f,0x82,0x00,0x03,0x19,0x02,0x53,0x30,
+0xdf,0xff,0xff,0xf1,0x7a,0x07,0x11,0xf0,0x82,0x00,0x40,0x00,0x00,0x00,0x8f,0x21,
+0x00,0x12,0x2f,0x33,0x00,0x11,0x7f,0xc9,0x00,0x00,0xc5,0x03,0x31,0xe9,0x89,0xdf,
+0x91,0x00,0x24,0x01,0xef,0xd5,0x00,0x12,0xf2,0x76,0x00,0x21,0xff,0xff,0xc7,0x00,
+0x33,0x00,0x00,0x02,0x1a,0x00,0x20,0xe3,0x00,0x2b,0x01,0x02,0x2c,0x02,0x12,0x91,
+0x2d,0x01,0x53,0x16,0xad,0xef,0xed,0xb6,0xc2,0x05,0x62,0xe0,0x01,0x7c,0xef,0xec,
+0x83,0x0c,0x00,0x11,0xf0,0x43,0x04,0x11,0xa1,0x0c,0x00,0x11,0xfa,0x31,0x00,0x36,
+0xfd,0x10,0x00,0x2b,0x04,0x17,0xc0,0x0c,0x00,0x12,0xf7,0x0c,0x00,0x21,0xa9,0xae,
+0x8a,0x02,0x16,0x6f,0x73,0x02,0x26,0x60,0x6f,0x41,0x01,0x13,0xc0,0xf5,0x02,0x10,
+0x01,0x3c,0x08,0x04,0xab,0x06,0x44,0xbf,0xff,0xff,0xf2,0x0c,0x00,0x00,0xd9,0x02,
+0x04,0x0c,0x00,0x00,0xd5,0x01,0x04,0x0c,0x00,0x00,0x2e,0x01,0x07,0x18,0x00,0x1e,
+0xf6,0x24,0x00,0x0a,0x3c,0x00,0x16,0xcf,0x54,0x00,0x04,0x6c,0x00,0x13,0xfb,0x15,
+0x02,0x13,0xb0,0x9c,0x00,0x10,0x6f,0x8e,0x01,0x11,0x6f,0xf6,0x01,0x10,0x9d,0x06,
+0x00,0x07,0xcc,0x00,0x17,0xf6,0x0c,0x00,0x10,0xb0,0x0c,0x00,0x11,0xfc,0x0b,0x00,
+0x12,0xfc,0x7c,0x00,0x25,0x5e,0xff,0x41,0x00,0x6b,0xf6,0x00,0x7b,0xef,0xec,0x82,
+0x77,0x07,0x0f,0x0c,0x00,0x58,0x00,0x01,0x00,0x61,0x28,0xce,0xfe,0xc7,0x10,0x0a,
+0x14,0x00,0x11,0x09,0x89,0x01,0x10,0x0c,0x0c,0x00,0x21,0x01,0xdf,0xb3,0x00,0x10,
+0x9e,0x0c,0x00,0x17,0x0c,0xd9,0x00,0x16,0x7f,0x0c,0x00,0x10,0x01,0x06,0x00,0x30,
+0xd9,0x8a,0xef,0x0c,0x00,0x11,0x06,0xc2,0x01,0x01,0x41,0x00,0x22,0xf6,0x0c,0x24,
+0x04,0x00,0x56,0x02,0x10,0xf6,0xe9,0x02,0x04,0xda,0x07,0x13,0x3f,0x99,0x02,0x00,
+0x0c,0x00,0x13,0x5f,0xf0,0x02,0x1e,0x6f,0x98,0x01,0x1f,0xf5,0x0c,0x00,0x01,0x17,
+0x5f,0x24,0x00,0x17,0x4f,0x3c,0x00,0x17,0x2f,0x54,0x00,0x00,0x6c,0x00,0x04,0x0c,
+0x00,0x12,0x0b,0x12,0x03,0x00,0x1c,0x02,0x35,0xf6,0x05,0xff,0xdd,0x00,0x36,0xf6,
+0x00,0xef,0xb4,0x00,0x09,0xb1,0x01,0x17,0x0b,0x0c,0x00,0x21,0x00,0xcf,0x09,0x00,
+0x16,0xcf,0x14,0x01,0x13,0xe5,0xa4,0x00,0x01,0x2c,0x01,0x0f,0xac,0x01,0x65,0x03,
+0x14,0x01,0x31,0xf0,0x01,0x8d,0xea,0x05,0x40,0x14,0xff,0xff,0xfe,0x23,0x01,0x03,
+0x21,0x07,0x12,0xff,0x0f,0x00,0x1c,0xff,0x0f,0x00,0x30,0xec,0xbb,0xb6,0x77,0x03,
+0x11,0x30,0x40,0x00,0x17,0xfd,0xd6,0x09,0x03,0x5b,0x00,0x0f,0x0f,0x00,0x5e,0x00,
+0x47,0x01,0x41,0xbe,0xff,0xed,0xa6,0x5a,0x05,0x21,0x2c,0xff,0x26,0x08,0x16,0x10,
+0xbe,0x09,0x11,0xe3,0xad,0x03,0x02,0x01,0x00,0x11,0x30,0x8d,0x04,0x11,0xfe,0xd5,
+0x09,0x00,0x33,0x0b,0x30,0xb2,0x00,0x05,0x5b,0x0a,0x10,0x0b,0x6e,0x03,0x02,0x54,
+0x04,0x12,0x0d,0x1c,0x04,0x00,0xcc,0x08,0x12,0x0d,0xdf,0x00,0x40,0x02,0x22,0x22,
+0x21,0xfb,0x04,0x12,0xc4,0x6b,0x00,0x11,0x03,0xc8,0x06,0x11,0x63,0x0c,0x00,0x12,
+0x9f,0x6d,0x00,0x13,0x50,0x4d,0x04,0x00,0x5b,0x00,0x00,0x91,0x00,0x12,0x4d,0x0c,
+0x00,0x01,0x48,0x02,0x23,0x4a,0xef,0xb5,0x03,0x00,0x4a,0x00,0x22,0x6a,0xef,0xfa,
+0x04,0x00,0x01,0x00,0x92,0x05,0xdf,0xff,0xff,0xfa,0x57,0x77,0x77,0x50,0xcb,0x09,
+0x21,0xfd,0x9f,0xb6,0x0c,0x10,0x00,0x8b,0x00,0x03,0xe0,0x00,0x12,0x0e,0x54,0x09,
+0x30,0xff,0x81,0x00,0x40,0x09,0x21,0xf8,0x07,0xee,0x04,0x02,0x48,0x05,0x03,0x25,
+0x09,0x00,0x00,0x01,0x16,0x09,0x66,0x02,0x03,0x79,0x00,0x20,0xfb,0x20,0x60,0x00,
+0x51,0x38,0xce,0xff,0xed,0xa7,0x0a,0x00,0x43,0x88,0x88,0x88,0x50,0x77,0x04,0x1f,
+0xb0,0x08,0x00,0x17,0x12,0xcf,0x57,0x00,0x1f,0xf0,0x08,0x00,0x0d,0x0e,0x58,0x00,
+0x0f,0x08,0x00,0x44,0x14,0x00,0xdf,0x06,0x12,0xff,0x8e,0x08,0x01,0x7a,0x03,0x21,
+0xba,0xb3,0x17,0x04,0x01,0xd9,0x03,0x13,0x4f,0x08,0x00,0x13,0x0b,0x08,0x00,0x23,
+0x00,0xbf,0x08,0x00,0x62,0x04,0xad,0xff,0xec,0x92,0x9f,0xa5,0x07,0x00,0x46,0x01,
+0x13,0x59,0xa5,0x07,0x00,0x0b,0x07,0x0f,0x17,0x00,0x8e,0x16,0x8f,0x17,0x00,0x13,
+0x58,0xaf,0x07,0x12,0x7f,0x64,0x06,0x13,0xf9,0xd5,0x0a,0x12,0x54,0x55,0x02,0x10,
+0x1a,0xee,0x00,0x10,0x0f,0x00,0x02,0x27,0x99,0xbf,0x5c,0x0b,0x01,0x0d,0x01,0x16,
+0x03,0x94,0x09,0x34,0x50,0x07,0xff,0x8d,0x04,0x13,0xf5,0x24,0x03,0x11,0x72,0x58,
+0x00,0xa0,0x01,0x7b,0xef,0xfd,0xb6,0x10,0x0f,0xff,0xff,0xf5,0xf0,0x01,0x8f,0xff,
+0xff,0xf8,0x00,0x00,0x00,0x00,0x5f,0xff,0xff,0xfb,0x3f,0xff,0xff,0xfc,0x0c,0x00,
+0xf1,0x21,0x9f,0xff,0xff,0xf6,0x0d,0xff,0xff,0xff,0x10,0x00,0x00,0x00,0xdf,0xff,
+0xff,0xf1,0x08,0xff,0xff,0xff,0x50,0x00,0x00,0x02,0xff,0xff,0xff,0xb0,0x03,0xff,
+0xff,0xff,0x90,0x00,0x00,0x06,0xff,0xff,0xff,0x60,0x00,0xef,0xff,0xff,0xe0,0x00,
+0x00,0x0b,0x2b,0x00,0xf1,0x01,0x8f,0xff,0xff,0xf2,0x00,0x00,0x0f,0xff,0xff,0xfb,
+0x00,0x00,0x3f,0xff,0xff,0xf7,0x06,0x00,0x40,0xf6,0x00,0x00,0x0e,0x12,0x00,0x00,
+0x1e,0x00,0xf0,0x00,0xf1,0x00,0x00,0x09,0xff,0xff,0xff,0x00,0x00,0xcf,0xff,0xff,
+0xc0,0x00,0x00,0x49,0x00,0x21,0x40,0x01,0x47,0x00,0x10,0x00,0x49,0x00,0x22,0x80,
+0x05,0x72,0x00,0x00,0x7e,0x00,0x23,0xc0,0x09,0x8a,0x00,0x51,0x4f,0xff,0xff,0xf1,
+0x0e,0x4d,0x00,0x01,0x49,0x00,0x21,0xf5,0x2f,0x47,0x00,0x01,0x49,0x00,0x21,0xfa,
+0x7f,0x47,0x00,0xc1,0x00,0x00,0x04,0xff,0xff,0xfe,0xbf,0xff,0xff,0x70,0x00,0x00,
+0x49,0x00,0x00,0x01,0x00,0x23,0x20,0x00,0xc7,0x00,0x03,0x47,0x00,0x01,0x49,0x00,
+0x03,0x47,0x00,0x01,0x49,0x00,0x01,0xac,0x00,0x03,0x49,0x00,0x03,0x47,0x00,0x01,
+0x49,0x00,0x04,0x47,0x00,0x26,0x00,0x00,0x47,0x00,0x85,0x00,0x00,0xaf,0xff,0xff,
+0xfd,0x00,0x00,0x49,0x00,0x00,0x47,0x00,0x00,0xdd,0x00,0x20,0xf4,0x00,0xf0,0x00,
+0x00,0x26,0x00,0x01,0xc7,0x00,0x41,0xff,0xff,0xff,0x80,0x45,0x00,0x12,0xf7,0x4f,
+0x01,0x21,0xf2,0x0b,0xfa,0x00,0x21,0x00,0x9f,0x61,0x00,0x61,0x08,0xff,0xff,0xfe,
+0x00,0x7f,0x30,0x01,0x11,0x0d,0x06,0x01,0x61,0x00,0xbf,0xff,0xff,0xa0,0x03,0xf4,
+0x00,0x00,0x3f,0x00,0x11,0xf5,0x98,0x00,0x31,0xf6,0x00,0x0f,0x58,0x00,0x11,0x6f,
+0x66,0x01,0x11,0x02,0x84,0x00,0x01,0xdc,0x00,0x00,0x64,0x01,0x11,0xfe,0x57,0x00,
+0x31,0xe0,0x00,0x07,0x58,0x00,0x01,0xc5,0x00,0x00,0x57,0x00,0x11,0xfa,0x8d,0x00,
+0x32,0xe0,0x00,0x3f,0xbf,0x00,0x11,0xcf,0x52,0x01,0x00,0x58,0x00,0x30,0x08,0xff,
+0xff,0x2a,0x00,0x11,0x0f,0xed,0x00,0x10,0x0b,0x58,0x00,0x71,0xcf,0xff,0xf7,0xff,
+0xff,0xf0,0x02,0x4b,0x00,0x00,0x8d,0x00,0xc1,0x70,0x1f,0xff,0xff,0x0e,0xff,0xff,
+0x40,0x5f,0xff,0xff,0xa0,0x92,0x01,0x91,0xfb,0x05,0xff,0xff,0xb0,0x9f,0xff,0xf9,
+0x09,0xbb,0x01,0x00,0x3b,0x00,0x91,0xe0,0xaf,0xff,0xf7,0x04,0xff,0xff,0xd0,0xcf,
+0x0f,0x01,0x00,0x8d,0x00,0x81,0x1e,0xff,0xff,0x20,0x0f,0xff,0xff,0x2f,0xcc,0x00,
+0x00,0x8d,0x00,0x81,0xf8,0xff,0xff,0xd0,0x00,0xbf,0xff,0xfa,0x8b,0x00,0x01,0x8d,
+0x00,0x31,0xef,0xff,0xf9,0x22,0x02,0x02,0xdd,0x01,0x11,0x00,0x0a,0x00,0x35,0x40,
+0x00,0x1f,0x78,0x01,0x10,0x0b,0x0a,0x00,0x11,0xf0,0x5d,0x02,0x01,0x8b,0x00,0x01,
+0x8d,0x00,0x21,0xff,0xfa,0x26,0x01,0x01,0x8b,0x00,0x02,0x1f,0x02,0x21,0xff,0x60,
+0x4e,0x00,0x01,0x8b,0x00,0x01,0x8d,0x00,0x01,0xfd,0x01,0x15,0xef,0x9a,0x01,0x12,
+0xbf,0xdf,0x01,0x22,0x0a,0xff,0x8b,0x00,0x02,0x3f,0x00,0x12,0x80,0x7e,0x01,0x15,
+0xfa,0xaf,0x01,0x23,0xf3,0x00,0xa1,0x01,0x04,0xd9,0x01,0x01,0x72,0x00,0x12,0x0c,
+0x8b,0x00,0x12,0x0d,0xdb,0x02,0x00,0x4b,0x00,0x10,0xf7,0x37,0x00,0x12,0xfe,0x34,
+0x00,0x11,0xfe,0xa6,0x02,0x14,0xf7,0x20,0x00,0x00,0x8d,0x00,0x11,0xe1,0xd2,0x00,
+0x12,0xc0,0x6f,0x00,0x32,0x80,0x01,0xef,0x59,0x00,0x10,0x1f,0x8d,0x00,0x13,0x8f,
+0x6f,0x00,0x00,0x08,0x00,0x13,0x2f,0xc6,0x02,0x00,0xa7,0x00,0x13,0xfc,0x8f,0x00,
+0x03,0x0c,0x01,0x02,0xa5,0x00,0x00,0x7a,0x00,0x05,0xd4,0x00,0x02,0xb5,0x01,0x16,
+0xfc,0x68,0x02,0x32,0xff,0xff,0x30,0x0c,0x00,0x20,0x02,0xff,0x6e,0x03,0x03,0x19,
+0x00,0x15,0x6f,0x28,0x01,0x53,0x00,0x00,0x1e,0xff,0xff,0xb3,0x03,0x03,0x2f,0x01,
+0x26,0xff,0xf2,0x31,0x00,0x03,0x3d,0x01,0x02,0x4a,0x00,0x00,0x74,0x01,0x03,0xcf,
+0x00,0x13,0x6f,0x65,0x00,0x10,0x0c,0xcf,0x00,0x12,0xcf,0x7e,0x00,0x01,0xcf,0x00,
+0x13,0x03,0x97,0x00,0x10,0xef,0x1f,0x02,0x12,0x0a,0xb0,0x00,0x11,0x8f,0x60,0x02,
+0x02,0xc9,0x00,0x01,0xe0,0x00,0x01,0xc4,0x02,0x11,0xfa,0x1f,0x00,0x12,0x90,0x4c,
+0x01,0x23,0xf3,0x03,0x8d,0x01,0x10,0x07,0x45,0x00,0x12,0xcf,0x91,0x00,0x00,0xa7,
+0x00,0x13,0xfd,0x25,0x01,0x02,0x4c,0x00,0x13,0x1f,0x0d,0x01,0x01,0xa5,0x00,0x12,
+0xbf,0x77,0x00,0x10,0x4f,0x4d,0x03,0x12,0x06,0xdd,0x00,0x11,0x09,0x71,0x00,0x12,
+0x1f,0x10,0x03,0x11,0xdf,0xca,0x00,0x11,0xbf,0x00,0x03,0x11,0x2f,0x72,0x03,0x11,
+0x06,0x71,0x00,0x12,0x07,0x96,0x03,0x11,0x1f,0x03,0x01,0x12,0xbf,0xef,0x00,0x01,
+0x07,0x00,0x12,0x0f,0xd5,0x00,0x10,0x05,0x20,0x00,0x13,0x05,0xbb,0x03,0x01,0x14,
+0x00,0x13,0xaf,0x14,0x01,0x12,0xaf,0x3e,0x04,0x23,0xfc,0x00,0x26,0x00,0x13,0x53,
+0xe0,0x03,0x00,0x26,0x00,0x12,0xfa,0x92,0x04,0x03,0xde,0x03,0x04,0x84,0x01,0x26,
+0x05,0xff,0xb6,0x02,0x01,0x71,0x02,0x04,0x25,0x00,0x02,0x52,0x01,0x17,0xfb,0x29,
+0x04,0x04,0x50,0x02,0x17,0x0f,0x25,0x00,0x26,0x00,0xaf,0x25,0x00,0x27,0x00,0x04,
+0x25,0x00,0x27,0x00,0x0e,0x25,0x00,0x26,0x00,0x9f,0x25,0x00,0x01,0x26,0x00,0x14,
+0x50,0x0d,0x00,0x11,0x2f,0x16,0x03,0x05,0xdc,0x01,0x05,0x25,0x00,0x27,0x00,0xef,
+0x25,0x00,0x15,0x8f,0x25,0x00,0x35,0x01,0x24,0xaf,0xe9,0x02,0x27,0x03,0xff,0x3d,
+0x02,0x17,0x3f,0x3d,0x02,0x21,0x03,0xff,0xbd,0x02,0x06,0x19,0x00,0x26,0xe3,0x00,
+0x19,0x00,0x24,0xa1,0x00,0x0d,0x00,0x21,0x67,0x75,0xb6,0x02,0x05,0x20,0x05,0x02,
+0xa5,0x02,0x0f,0x0b,0x00,0x18,0x30,0xf2,0x07,0x88,0x01,0x00,0x15,0xcf,0xd0,0x00,
+0x00,0x23,0x03,0x25,0xf9,0x00,0xf3,0x02,0x15,0xd0,0xbe,0x00,0x03,0xbe,0x03,0x16,
+0x03,0x06,0x03,0x15,0x1e,0xaf,0x00,0x00,0xda,0x01,0x34,0xfe,0x10,0x00,0x35,0x03,
+0x16,0xf3,0xb7,0x00,0x12,0x80,0x0b,0x00,0x15,0xdf,0x2f,0x03,0x16,0x0a,0xd8,0x00,
+0x15,0x5f,0x75,0x00,0x2f,0x02,0xff,0x75,0x00,0x0b,0x10,0x04,0x6f,0x03,0x01,0xa9,
+0x00,0x25,0x86,0x1e,0xbb,0x00,0x2f,0xfc,0x4f,0x0b,0x00,0x18,0x02,0xdc,0x00,0x02,
+0x6e,0x00,0x12,0x2a,0xeb,0x03,0x12,0x8f,0xc8,0x00,0x12,0xbf,0xfa,0x02,0x12,0xaf,
+0x82,0x00,0x12,0x4f,0x21,0x06,0x12,0x0c,0x10,0x06,0x03,0x74,0x05,0x00,0x23,0x03,
+0x12,0xa0,0x77,0x06,0x13,0xf8,0x30,0x02,0x12,0x60,0x10,0x05,0x04,0x42,0x00,0x0f,
+0x0f,0x00,0x0b,0x12,0x50,0x52,0x00,0x13,0xf4,0x56,0x05,0x11,0x10,0x3a,0x05,0x00,
+0xe6,0x00,0x21,0x01,0x7f,0x25,0x00,0x13,0x0c,0x80,0x02,0x12,0xef,0x07,0x00,0x13,
+0x0e,0x0d,0x01,0x03,0x8a,0x01,0x13,0x0e,0x1d,0x01,0x23,0x03,0xaf,0x43,0x00,0x02,
+0x9b,0x06,0x01,0xd2,0x03,0x12,0x10,0x0d,0x05,0x17,0xf4,0x69,0x00,0x0f,0x96,0x00,
+0x13,0x03,0xc3,0x00,0x13,0x09,0x18,0x07,0x03,0xe1,0x00,0x04,0xf0,0x00,0x12,0x0d,
+0x26,0x00,0x00,0xa2,0x01,0x13,0xe2,0x3d,0x00,0x10,0xe6,0x08,0x00,0x13,0xcf,0x9c,
+0x01,0x13,0xaf,0x95,0x07,0x14,0x5d,0x15,0x02,0x20,0x70,0x00,0x5b,0x06,0x1f,0xf2,
+0x05,0x00,0x4c,0x53,0xbb,0xbb,0x10,0x00,0x50,0x5c,0x02,0x23,0xf9,0x20,0x09,0x08,
+0x13,0x70,0x2b,0x01,0x14,0x90,0xbf,0x04,0x03,0x85,0x02,0x12,0x20,0x10,0x00,0x18,
+0xfa,0xa2,0x03,0x12,0xdf,0x6c,0x03,0x13,0x0a,0xdf,0x00,0x12,0x9f,0x3e,0x00,0x13,
+0x08,0xd7,0x01,0x12,0x8f,0x3d,0x00,0x0f,0x0f,0x00,0x0b,0x13,0x07,0x53,0x00,0x13,
+0x4f,0x0b,0x01,0x03,0xc4,0x02,0x13,0x08,0x36,0x04,0x22,0x0d,0xff,0x20,0x00,0x13,
+0x1c,0x1c,0x03,0x12,0x0a,0xd3,0x01,0x12,0x0a,0x0f,0x00,0x12,0x0b,0xe9,0x01,0x00,
+0x1c,0x05,0x12,0x82,0xb6,0x00,0x12,0x60,0x4b,0x00,0x03,0x94,0x07,0x04,0x90,0x06,
+0x1f,0x90,0x96,0x00,0x16,0x12,0x9f,0x0f,0x00,0x04,0xd2,0x00,0x12,0xdf,0x3e,0x06,
+0x12,0x1f,0xf0,0x00,0x02,0x67,0x08,0x01,0x3e,0x03,0x16,0x30,0x67,0x07,0x06,0x9a,
+0x00,0x11,0x80,0xc9,0x00,0x12,0xfb,0x7f,0x04,0x14,0x82,0x49,0x04,0x33,0x01,0x58,
+0x87,0x91,0x04,0x03,0xd8,0x00,0x10,0xe5,0x09,0x00,0x32,0x5c,0xcc,0xc7,0x04,0x07,
+0x12,0xfa,0x77,0x01,0x22,0x80,0x0a,0x59,0x03,0x10,0x10,0xc7,0x00,0x22,0xf6,0x04,
+0x67,0x03,0x20,0xfd,0x30,0x91,0x00,0x23,0x30,0xbf,0x76,0x03,0xb2,0xc9,0xdf,0xff,
+0xff,0xe0,0x1f,0xff,0xff,0xe4,0x02,0x9f,0x11,0x00,0x21,0xf8,0x04,0x1d,0x04,0x02,
+0x98,0x03,0x31,0xfe,0x00,0x6f,0x98,0x03,0x12,0x3e,0x04,0x05,0x12,0x07,0xf7,0x00,
+0x10,0x1b,0x1a,0x00,0x51,0x40,0x00,0x01,0x11,0x10,0xf9,0x03,0x31,0xad,0xfe,0xc7,
+0x09,0x00,0x42,0x4b,0xef,0xd9,0x10,0x47,0x01,0x14,0xf5,0x72,0x07,0xf0,0x00,0x04,
+0xff,0xff,0xa8,0xcf,0xff,0xd0,0x0b,0xff,0xf4,0x00,0x09,0xff,0xf4,0x0f,0xc1,0x02,
+0x30,0xff,0xf8,0x0f,0xd2,0x01,0x50,0xdf,0xf9,0x0f,0xff,0x90,0x0e,0x00,0x30,0x0b,
 0xff,0xf3,0x1c,0x00,0x11,0x05,0x2a,0x00,0x12,0xe0,0x38,0x00,0x14,0x40,0x46,0x00,
-0x00,0x54,0x00,0x15,0x20,0x53,0x3b,0x0c,0x0a,0x5c,0x09,0x46,0x1b,0x07,0x85,0x29,
-0x05,0xe4,0x3a,0x0a,0x01,0x7f,0x18,0x2e,0x52,0x6d,0x03,0xfd,0x04,0x09,0x42,0x7f,
-0x03,0x30,0x6e,0x0a,0x41,0x23,0x1f,0x40,0xc0,0x64,0x1a,0x0f,0xb1,0x5c,0xff,0xff,
-0x1a,0x05,0xe2,0x01,0x0c,0xdb,0x02,0x05,0x5d,0x80,0x0e,0x75,0x2c,0x04,0xb7,0x02,
-0x1b,0xf7,0xfa,0x02,0x09,0x74,0x02,0x1b,0x07,0xde,0x5f,0x19,0x02,0x24,0x81,0x02,
-0xbe,0x7e,0x1f,0x10,0xd6,0x02,0xff,0xff,0x4e,0x39,0x78,0x88,0x30,0x71,0x43,0x1a,
-0xcf,0x49,0x05,0x19,0x02,0xfe,0x32,0x04,0xab,0x2c,0x18,0x60,0xef,0x01,0x2a,0xf7,
-0x2d,0x65,0x34,0x36,0xf5,0x00,0x1c,0x00,0x02,0x11,0x07,0x6d,0x0b,0x1c,0x0b,0xaf,
-0x05,0x1f,0x00,0xd6,0x02,0xff,0xff,0x4c,0x20,0x01,0x32,0xae,0x00,0x26,0x44,0x40,
-0x6e,0x86,0x20,0xfe,0x71,0x20,0x01,0x08,0x1a,0x35,0x35,0xf9,0x55,0xcf,0x3a,0x00,
-0x1b,0x0b,0x10,0x65,0x16,0x02,0x84,0x54,0x04,0x86,0x32,0x38,0xd3,0x03,0x9f,0x54,
-0x6e,0x00,0x21,0x0a,0x5f,0x19,0xdf,0xea,0x20,0x00,0xd6,0x02,0xff,0xff,0x59,0x87,
-0x4c,0xec,0x40,0x00,0x00,0x01,0x9e,0xd8,0x5d,0x08,0x01,0x47,0x3b,0x16,0xfa,0xeb,
-0x31,0x02,0x07,0x15,0x07,0x89,0x11,0x36,0xa0,0x00,0x03,0x9d,0x01,0x11,0x04,0xae,
-0x08,0x16,0x0d,0xbe,0x01,0x30,0x05,0xdf,0xd5,0x31,0x26,0x2f,0xee,0x91,0xc5,0x02,
-0x28,0x09,0x72,0x74,0x04,0xbd,0x10,0x08,0x10,0x00,0x2a,0x1f,0xff,0x15,0x09,0x18,
-0x06,0xd5,0x13,0x05,0x7c,0x50,0x19,0x10,0x13,0x84,0x09,0x37,0x09,0x18,0x08,0x2d,
-0x54,0x06,0xe0,0x16,0x1a,0x30,0x34,0x89,0x07,0x4b,0x03,0x16,0x0a,0x5e,0x1a,0x05,
-0x43,0x02,0x17,0x73,0x4b,0x03,0x00,0x43,0x02,0x12,0xf2,0x93,0x17,0x07,0xc9,0x75,
-0x16,0x8f,0x39,0x01,0x01,0xf8,0x3f,0x17,0x03,0x4b,0x03,0x01,0xd8,0x17,0x03,0x1f,
-0x1b,0x04,0x37,0x77,0x08,0xb6,0x75,0x02,0x45,0x30,0x04,0x91,0x7e,0x05,0x41,0x22,
-0x03,0xb5,0x74,0x06,0xbb,0x36,0x05,0xbc,0x2c,0x16,0x06,0x5a,0x40,0x18,0xb0,0x8d,
-0x72,0x05,0x53,0x37,0x00,0x05,0x01,0x03,0x18,0x47,0x1b,0xf7,0x37,0x55,0x05,0x71,
-0x73,0x09,0x88,0x4f,0x2a,0x4f,0xff,0xac,0x5e,0x08,0xfe,0x7d,0x04,0xce,0x57,0x09,
-0xa8,0x89,0x03,0xcd,0x1c,0x05,0xb8,0x3c,0x15,0x0c,0xf0,0x00,0x15,0x02,0x78,0x52,
-0x16,0xf2,0xe9,0x37,0x15,0x70,0x57,0x3f,0x02,0x32,0x00,0x17,0xfd,0x77,0x4d,0x01,
-0x2c,0x00,0x27,0xf3,0x04,0xb1,0x3a,0x01,0xeb,0x43,0x04,0x45,0x3d,0x07,0xdc,0x43,
-0x01,0x42,0x08,0x3b,0xbe,0xfd,0x70,0x05,0x0b,0x09,0x13,0x4c,0x49,0x04,0xff,0xe6,
-0x5a,0xe5,0x89,0x48,0xbf,0xf2,0x00,0x0a,0xbd,0x42,0x68,0x0e,0xfc,0x00,0x00,0x4f,
-0xf6,0xd7,0x28,0x39,0xc0,0x00,0x04,0x07,0x3c,0x00,0x25,0x7a,0x18,0xf3,0x2e,0x0e,
-0x39,0xfd,0x54,0x9f,0x59,0x0b,0x00,0xc1,0x00,0x09,0xbc,0x05,0x3f,0x4b,0xef,0xd8,
-0x69,0x0b,0xff,0xff,0x4f,0x08,0x46,0x81,0x07,0x64,0x0b,0x07,0xbd,0x67,0x07,0x16,
-0x00,0x1e,0x0d,0x16,0x00,0x07,0x94,0x29,0x0a,0x16,0x00,0x1e,0xef,0x16,0x00,0x05,
-0x31,0x04,0x12,0xb9,0xea,0x73,0x17,0x20,0x8d,0x05,0x0a,0xe3,0x49,0x03,0xb7,0x0e,
-0x1b,0xfc,0xae,0x02,0x02,0x8b,0x01,0x1b,0xd6,0x0f,0x6e,0x02,0xe2,0x01,0x1c,0x55,
-0xd1,0x11,0x01,0xf6,0x5d,0x08,0x49,0x35,0x06,0x3e,0x4a,0x1a,0x04,0x46,0x40,0x02,
-0xb1,0x01,0x2c,0xc0,0x03,0x35,0x06,0x01,0x61,0x4f,0x10,0x02,0x5a,0x22,0x01,0xaf,
-0x00,0x14,0x30,0xef,0x00,0x00,0x8b,0x88,0x09,0xf6,0x66,0x04,0x58,0x41,0x0c,0x16,
-0x00,0x03,0x5f,0x41,0x0b,0x16,0x00,0x03,0xa1,0x41,0x0b,0x16,0x00,0x03,0xa8,0x41,
-0x0a,0x16,0x00,0x01,0xc3,0x04,0x0b,0x66,0x7b,0x03,0x14,0x5e,0x3e,0xdd,0xdd,0xdd,
-0x5e,0x47,0x04,0x12,0x5b,0x09,0xf9,0x06,0x0e,0x16,0x00,0x2e,0x04,0xff,0x16,0x00,
-0x09,0xd0,0x4e,0x07,0x03,0x04,0x1e,0x5f,0x16,0x00,0x05,0xb3,0x4f,0x03,0x6b,0x7a,
-0x1d,0x00,0x9e,0x84,0x07,0x00,0x30,0x07,0x9c,0x40,0x00,0x86,0x1b,0x12,0x88,0xe3,
-0x17,0x25,0x00,0x8f,0xb0,0x03,0x16,0x8f,0x14,0x34,0x16,0x01,0x8e,0x04,0x16,0x7f,
-0x16,0x00,0x16,0x09,0x61,0x04,0x19,0x6f,0x40,0x34,0x2d,0xff,0xb0,0x16,0x00,0x16,
-0xaf,0x07,0x04,0x08,0xae,0x7e,0x0f,0x22,0x6c,0xff,0xc0,0x00,0xaa,0x1b,0x18,0x73,
-0x12,0x03,0x0b,0x58,0x4a,0x16,0x60,0x1c,0x00,0x19,0xcf,0xeb,0x09,0x1a,0x01,0xce,
-0x12,0x18,0xdf,0x18,0x0a,0x18,0x06,0xdb,0x06,0x19,0x05,0x82,0x42,0x0a,0x11,0x67,
-0x15,0x04,0x45,0x51,0x01,0x0e,0x00,0x04,0x3d,0x3d,0x66,0x00,0x03,0x55,0x55,0x55,
-0x30,0x2f,0x16,0x05,0x82,0x05,0x08,0xdc,0x87,0x1a,0x4f,0xfc,0x25,0x17,0xf1,0x71,
-0x01,0x17,0xa0,0xfc,0x04,0x16,0x40,0x97,0x01,0x1f,0xfe,0xf2,0x07,0x08,0x0f,0x56,
-0x6b,0xff,0x75,0x05,0x86,0x78,0x26,0x55,0x20,0x63,0x05,0x16,0xd1,0x67,0x03,0x18,
-0xe1,0xb4,0x0b,0x0d,0x51,0x8f,0x19,0x0c,0x11,0x3c,0x1e,0xf7,0x7b,0x75,0x0f,0xfa,
-0x01,0xff,0x8d,0x46,0x02,0x88,0x87,0x10,0x1a,0x04,0x17,0xfd,0x81,0x4f,0x03,0xeb,
-0x7a,0x15,0x07,0x68,0x2e,0x00,0x58,0x1b,0x22,0xe3,0x6f,0xe3,0x04,0x01,0xad,0x79,
-0x02,0xdc,0x95,0x11,0x0c,0x72,0x58,0x1c,0x2e,0xef,0x08,0x0f,0xfa,0x01,0xff,0x8d,
-0x20,0x8d,0xeb,0x2c,0x4c,0x21,0xce,0xd5,0xb2,0x05,0x02,0x71,0x7a,0x11,0xf5,0x69,
-0x00,0x11,0xf5,0xea,0x03,0x13,0xb0,0x3b,0x1e,0x02,0x31,0x22,0x13,0x09,0x78,0x52,
-0x00,0xe3,0x01,0x30,0x08,0xef,0xb2,0x3c,0x11,0x2f,0xfd,0x60,0xee,0x01,0x10,0x1f,
-0x0f,0xeb,0x6f,0x29,0x17,0xfc,0xe6,0x00,0x0f,0x42,0x01,0x3d,0x13,0xf9,0xf8,0x8d,
-0x0f,0xa6,0x6f,0x92,0x16,0xbb,0xf7,0x02,0x0f,0x3c,0x03,0x23,0x52,0xe0,0x25,0x55,
-0x55,0x54,0x46,0x3f,0x12,0xf4,0x35,0x31,0x02,0x7f,0x7c,0x03,0x5b,0x28,0x00,0xeb,
-0x07,0x02,0xfa,0x3c,0x00,0xef,0x01,0x17,0xf7,0x66,0x98,0x08,0x18,0x9a,0x05,0xc7,
-0x25,0x1f,0xf8,0x0d,0x00,0xbf,0x11,0x03,0xfd,0x06,0x01,0x19,0x64,0x04,0x3a,0x12,
-0x11,0x6f,0x2c,0x01,0x14,0x1f,0x10,0x2c,0x15,0xf7,0xd5,0x98,0x1e,0xef,0x40,0x7c,
-0x0f,0x15,0x01,0xc3,0x15,0x08,0x6a,0x0e,0x35,0x17,0x88,0x72,0x18,0x0a,0x15,0xe2,
-0x22,0x14,0x15,0xe3,0x73,0x0c,0x12,0xf4,0x02,0x0b,0x10,0x44,0x2d,0x01,0x00,0xea,
-0x9b,0xa0,0x30,0x03,0xef,0xff,0xf6,0x00,0xaf,0xff,0xfd,0x20,0x74,0x02,0x1e,0xf7,
-0x25,0x04,0x0e,0x5a,0x02,0x0a,0xb8,0x0b,0x0f,0x13,0x00,0xff,0x1c,0x30,0x07,0xde,
-0xb3,0x95,0x5c,0x60,0xed,0x70,0x7f,0xff,0xfe,0x10,0x22,0x27,0x23,0xf7,0xdf,0x19,
-0x3a,0x15,0xfd,0x09,0x00,0x10,0x7f,0xe6,0x03,0x00,0x78,0x9d,0x30,0x07,0xdf,0xc3,
-0x3c,0xa3,0x2f,0xfe,0x70,0x94,0x01,0x13,0x0f,0x09,0x00,0xff,0x17,0x17,0x4f,0x53,
-0x61,0x08,0xa7,0x10,0x18,0xd5,0x53,0x17,0x04,0x9f,0x4a,0x08,0x9d,0x0f,0x1b,0x60,
-0x5e,0x51,0x02,0xa9,0x9d,0x00,0xe5,0x07,0x15,0xcd,0x9d,0x6e,0x03,0xc3,0x0e,0x13,
-0x4b,0xd9,0x17,0x13,0x04,0xa4,0x0f,0x04,0xbe,0x3c,0x04,0xe2,0x0e,0x03,0xc5,0x10,
-0x14,0x04,0xc3,0x0f,0x1b,0x0b,0xa8,0x59,0x02,0xff,0x62,0x05,0x1f,0x00,0x03,0x6e,
-0x21,0x05,0x1f,0x00,0x02,0x94,0x8e,0x06,0x1f,0x00,0x00,0x17,0x5a,0x61,0x25,0x55,
-0x7f,0xff,0xff,0xfd,0xa6,0x21,0x00,0x5e,0x00,0x17,0xb7,0x3b,0x0a,0x00,0x64,0x69,
-0x16,0x7f,0x10,0x17,0x10,0x04,0x2f,0x81,0x07,0x1f,0x00,0x00,0x2d,0x10,0x07,0x1f,
-0x00,0x11,0x05,0x57,0x00,0x06,0x5d,0x00,0x02,0x3d,0x2c,0x05,0x7c,0x00,0x01,0xc3,
-0x5b,0x07,0x1f,0x00,0x11,0xaf,0x73,0x05,0x05,0x1f,0x00,0x02,0xf6,0x70,0x05,0x1f,
-0x00,0x03,0x92,0x64,0x05,0x1f,0x00,0x12,0xcf,0xdb,0x42,0x07,0xf8,0x5a,0x26,0xff,
-0x30,0x1f,0x00,0x12,0x6f,0x6f,0x11,0x03,0x1f,0x00,0x01,0x22,0x61,0x13,0xf2,0xc3,
-0x2c,0x03,0x64,0x66,0x1a,0xf6,0x93,0x01,0x1a,0xf8,0x93,0x01,0x1a,0xf7,0xb2,0x01,
-0x19,0xd3,0xd1,0x01,0x27,0xfd,0x60,0xf0,0x01,0x05,0xa6,0x11,0x00,0x59,0x0b,0x02,
-0x33,0x1d,0x14,0x30,0xa8,0x11,0x10,0xd6,0x34,0x00,0x15,0xc0,0xef,0x12,0x59,0xe8,
-0x56,0xef,0xff,0x90,0x6e,0x14,0x18,0x40,0xbd,0x14,0x04,0x92,0x01,0x35,0xfb,0x20,
-0x4b,0x8e,0x0d,0x10,0x0c,0x00,0x11,0x3f,0x3a,0xef,0xe8,0x50,0x1a,0x1b,0x0f,0xfe,
-0x6b,0xff,0xcd,0x1a,0xaf,0x6a,0x0f,0x1a,0x0b,0x97,0x5c,0x08,0x6c,0x18,0x0b,0x35,
-0x88,0x06,0x87,0xa5,0x09,0x05,0x28,0x1a,0xc0,0x8b,0x1c,0x18,0xf6,0x4b,0x02,0x3f,
-0x35,0x55,0x54,0x76,0x02,0x15,0x0f,0x94,0x6c,0xff,0xe8,0x17,0x00,0xc0,0x00,0x09,
-0xb5,0x1e,0x08,0x79,0x27,0x14,0xaf,0x49,0x0a,0x05,0x3d,0x05,0x08,0x8f,0x1c,0x0a,
-0x05,0x28,0x19,0x9f,0x33,0x19,0x1a,0x03,0xc2,0x02,0x1b,0x03,0x41,0x28,0x0f,0x94,
-0x02,0xff,0xff,0x0a,0x28,0x02,0xdf,0x74,0x02,0x29,0x00,0x3e,0x68,0x6b,0x19,0x04,
-0x00,0x62,0x00,0x9e,0x01,0x16,0x9f,0xd1,0x12,0x00,0x34,0x74,0x01,0xd3,0x0c,0x03,
-0x91,0x02,0x00,0xc4,0x00,0x15,0x2d,0xdd,0x1f,0x9f,0x88,0x88,0x71,0x00,0x00,0x01,
-0x78,0x88,0x82,0xee,0x21,0x21,0x0f,0x94,0x02,0xff,0xec,0x30,0x3b,0xfe,0xb5,0xe5,
-0x09,0x16,0xf5,0xcb,0x00,0x3c,0xe7,0x20,0x5f,0xb5,0x77,0x1a,0xe0,0x0e,0x1d,0x14,
-0x70,0x24,0x01,0x26,0xa5,0x6b,0x73,0x1c,0x10,0x03,0xf6,0x01,0x15,0x3b,0x4a,0x1a,
-0x30,0x01,0x44,0x43,0x76,0x53,0x09,0x88,0x2a,0x0f,0x94,0x02,0xff,0xff,0x16,0x20,
-0x2b,0xfe,0x97,0x00,0x34,0x7d,0xfb,0x20,0x75,0x1d,0x14,0xf9,0xde,0x90,0x03,0x26,
-0x05,0x03,0x53,0x3c,0x0e,0x0f,0x00,0x00,0x6d,0x0a,0x11,0xf9,0xca,0x0d,0x03,0x32,
-0x1a,0x21,0x2a,0xed,0x4b,0x00,0x2f,0xeb,0x20,0x85,0x02,0xff,0xff,0x1f,0x03,0xd2,
-0x09,0x10,0x30,0xe6,0x0c,0x12,0x80,0x99,0x0c,0x01,0x66,0xb4,0x03,0x80,0x0e,0x01,
-0x11,0x68,0x13,0x70,0x6e,0xae,0x16,0x3f,0xd2,0x3d,0x12,0x80,0x08,0x5d,0x01,0x07,
-0x9c,0x02,0xa8,0x47,0x12,0x2e,0x51,0x0e,0x00,0x0c,0x00,0x00,0x59,0x56,0x07,0x0a,
-0xb8,0x16,0xc0,0xbf,0x21,0x16,0xc0,0xcb,0x21,0x05,0xad,0xaa,0x05,0x01,0x1d,0x16,
-0x1d,0xde,0x23,0x16,0x1d,0xa6,0x0f,0x16,0x1d,0xda,0x00,0x16,0x1c,0xe6,0x00,0x10,
-0x0c,0x73,0x02,0x11,0xbf,0x87,0x02,0x01,0x0b,0x00,0x01,0xba,0x29,0x01,0xa8,0x5b,
-0x12,0xe2,0xc6,0x29,0x13,0x22,0x94,0x02,0x12,0xcf,0x6e,0x4e,0x12,0xe2,0x2b,0x0e,
-0x33,0xf7,0x00,0x03,0x3f,0x3b,0x62,0xcf,0xf7,0x00,0x00,0x03,0xe3,0xeb,0x01,0x04,
-0x19,0xb6,0x0e,0xc1,0x92,0x09,0x54,0x1f,0x00,0x0c,0xba,0x04,0x44,0x97,0x00,0x41,
-0x01,0x34,0x4f,0xff,0xe0,0x87,0xa1,0x00,0x5f,0x01,0x12,0xbf,0x34,0x01,0x19,0x9f,
-0xf3,0x1b,0x1a,0x1c,0xda,0x10,0x19,0xdf,0xb9,0x01,0x12,0x0a,0x9e,0x8e,0x04,0xd7,
-0x01,0x10,0x5f,0xed,0x18,0x15,0x30,0xf5,0x01,0x17,0xdf,0x1d,0x29,0x16,0xf3,0xa1,
-0x63,0x11,0xdf,0x8a,0x06,0x03,0x8f,0x82,0x03,0x45,0x54,0x14,0x20,0x3c,0x22,0x11,
-0x2f,0x8c,0x18,0x12,0x70,0xfd,0x9c,0x00,0x09,0x01,0x10,0xa7,0x8b,0x01,0x06,0x74,
-0x6c,0x13,0x13,0xb8,0x02,0x11,0xf7,0x97,0x02,0x11,0xf6,0xd7,0x5e,0x03,0xd0,0x21,
-0x31,0x9f,0xff,0xc0,0x05,0x22,0x02,0x4e,0x03,0x01,0x73,0xb6,0x00,0xff,0x02,0x02,
-0x0f,0x00,0x10,0x0d,0xea,0x02,0x15,0xdf,0x0f,0x00,0x37,0x7f,0xff,0xe0,0x0f,0x00,
-0x02,0x12,0xb6,0x12,0xef,0x52,0xab,0x13,0xf6,0x11,0xb6,0x12,0xff,0x6d,0xab,0x00,
-0x94,0x3f,0x04,0xde,0x73,0x00,0x87,0x00,0x00,0xe0,0xb5,0x02,0x3f,0x03,0x10,0xf0,
-0xa5,0x00,0x15,0x08,0x94,0x46,0x21,0xc0,0x1f,0xd5,0x4c,0x13,0xf3,0x47,0x04,0x25,
-0x80,0x0b,0x15,0x27,0x01,0x83,0x6d,0x15,0x05,0x52,0x01,0x00,0x65,0x86,0x02,0x06,
-0x01,0x03,0x88,0xa5,0x00,0xbe,0x00,0x12,0x4f,0x6b,0x04,0x12,0x05,0xc5,0x4a,0x03,
-0x78,0xb5,0x15,0xdd,0x39,0x02,0x18,0xbf,0x45,0x27,0x08,0x42,0x22,0x19,0x50,0xc5,
-0x04,0x13,0xd3,0x72,0xb6,0x17,0xaf,0x7e,0x97,0x37,0x2f,0xff,0xf3,0x33,0x99,0x29,
-0x00,0xbf,0x0b,0x32,0x1b,0x04,0x0c,0x38,0x06,0x29,0x67,0x05,0x08,0x04,0x18,0x60,
-0x2f,0x10,0x28,0xfe,0x10,0x46,0x25,0x19,0xfa,0x45,0x38,0x19,0xf4,0x42,0x38,0x0a,
-0xb1,0x25,0x1f,0x80,0x18,0x10,0x1a,0x0f,0xf0,0x70,0xff,0xb9,0x06,0xd2,0x01,0x06,
-0x3b,0x02,0x04,0x75,0x58,0x05,0x3d,0x18,0x06,0x8f,0xb7,0x09,0x08,0x29,0x18,0xcf,
-0xd3,0x28,0x18,0x6f,0xfa,0x24,0x03,0xce,0xb5,0x05,0x18,0x38,0x1f,0x40,0x52,0x02,
-0xff,0xde,0x18,0x1c,0x46,0x2b,0x18,0x1d,0x36,0x02,0x1b,0x3e,0xbd,0x6d,0x15,0x9e,
-0x45,0x02,0x00,0x10,0xb6,0x05,0x2c,0x37,0x10,0x7f,0x41,0x00,0x04,0x29,0x37,0x20,
-0x18,0x88,0x86,0x37,0x2a,0x07,0x88,0x8c,0x37,0x0f,0x52,0x02,0xff,0xd9,0x40,0x01,
-0xae,0xea,0x10,0xbc,0x29,0x13,0xc4,0x78,0x04,0x00,0xc4,0x5c,0x03,0x9b,0x0a,0x14,
-0x2f,0x14,0x46,0x15,0x80,0x03,0x17,0x13,0x0b,0x37,0x0b,0x11,0x0c,0xe7,0x00,0x13,
-0x5f,0xb5,0x0a,0x11,0x19,0xc9,0x33,0x2f,0x5d,0xec,0x08,0x3f,0x18,0x1f,0x04,0x37,
-0x02,0xff,0x12,0x0a,0x1b,0x00,0x00,0xec,0x2e,0x1c,0x2f,0x83,0x7b,0x15,0xf1,0x82,
-0x1c,0x05,0xde,0x76,0x01,0x1b,0x2b,0x04,0x75,0x45,0x01,0x4d,0x02,0x13,0x02,0x19,
-0x04,0x11,0x2a,0x7f,0x0a,0x21,0x0a,0xff,0x35,0x24,0x12,0xdf,0x61,0x09,0x18,0x1d,
-0x5e,0x9a,0x07,0x1e,0x81,0x04,0xc5,0x41,0x07,0xbe,0x59,0x17,0xdf,0x90,0x7b,0x00,
-0x61,0x61,0x39,0xef,0xfe,0xc9,0x11,0xa1,0x4a,0x45,0x55,0x55,0x52,0xe2,0x01,0x19,
-0xd1,0xb1,0x2b,0x07,0x42,0x09,0x08,0x25,0x29,0x03,0xe9,0x00,0x19,0x40,0xa2,0x32,
-0x1a,0xf5,0xc1,0x32,0x1e,0x70,0xae,0x9e,0x0f,0x01,0x00,0x0d,0x0f,0x87,0x71,0xff,
-0xec,0x08,0x4e,0x31,0x04,0xba,0x67,0x0f,0x19,0x00,0x27,0x01,0x7f,0x95,0x18,0x73,
-0x06,0x34,0x28,0xfd,0x50,0xff,0x32,0x18,0xb1,0x1f,0x34,0x18,0xd1,0x18,0x33,0x10,
-0xc0,0x19,0x00,0x53,0x88,0x88,0x88,0x9d,0xff,0xb8,0x74,0x13,0xe0,0xb3,0xac,0x14,
-0xfe,0x64,0x00,0x01,0x63,0x02,0x04,0x7d,0x00,0x12,0x07,0x82,0x0f,0x14,0xfe,0x9a,
-0x02,0x14,0xf9,0x19,0x00,0x00,0x27,0x02,0x1e,0xae,0x19,0x00,0x02,0x32,0x00,0x23,
-0x8e,0xff,0xfd,0xbe,0x16,0xef,0x4b,0x00,0x01,0xf2,0x30,0x00,0x7d,0x00,0x44,0x77,
-0x77,0x77,0x9c,0x7d,0x00,0x05,0xc9,0x37,0x18,0x0e,0x97,0x2f,0x06,0x19,0x00,0x16,
-0xc2,0xc8,0x00,0x25,0xfe,0x70,0xe1,0x00,0x2e,0xdc,0x84,0x45,0x01,0x0f,0x5e,0x01,
-0x36,0x01,0x18,0x0d,0x47,0x67,0x64,0x10,0x00,0x18,0xb1,0x28,0xfc,0x50,0x08,0x84,
-0x02,0x35,0xa5,0x18,0x1d,0x32,0x84,0x17,0xcf,0xfe,0x1f,0x18,0x07,0x22,0x22,0x00,
-0xbf,0x00,0x23,0xb3,0x02,0xc9,0x20,0x02,0x87,0x31,0x01,0xb0,0x0e,0x05,0x02,0x39,
-0x02,0xe6,0x79,0x03,0xe1,0xa6,0x02,0x85,0x04,0x03,0x56,0xac,0x02,0xb2,0x79,0x03,
-0xf0,0xa6,0x02,0x49,0x36,0x02,0x0d,0x00,0x03,0x34,0x34,0x02,0x0d,0x00,0x15,0x0b,
-0x69,0x36,0x15,0xf0,0x80,0x36,0x02,0x0d,0x00,0x03,0xf8,0x4c,0x02,0x0d,0x00,0x03,
-0x9e,0xac,0x14,0xdf,0xb7,0x53,0x15,0xa0,0x1a,0x00,0x03,0xcf,0x05,0x05,0x27,0x00,
-0x18,0xf4,0x41,0x00,0x27,0xfe,0x30,0x5b,0x00,0x24,0xff,0xe3,0x0d,0x00,0x12,0x08,
-0x51,0x11,0x03,0x9c,0x00,0x02,0x91,0xa8,0x03,0x0d,0x00,0x11,0x09,0x80,0x10,0x16,
-0xdf,0xba,0xba,0x01,0x4d,0x08,0x15,0xf0,0x94,0x9f,0x05,0xc0,0xa7,0x00,0xd0,0x0f,
-0x05,0x0d,0x00,0x00,0xb9,0x00,0x05,0x0d,0x00,0x00,0xba,0x7a,0x05,0x0d,0x00,0x13,
-0x5f,0x1a,0x00,0x22,0x01,0x71,0x52,0x08,0x10,0xf6,0x0d,0x00,0x50,0x04,0xff,0xc9,
-0x88,0xbf,0x1e,0x04,0x04,0xbe,0xc8,0x14,0xff,0x68,0x00,0x03,0xc0,0x3e,0x02,0x82,
-0x00,0x14,0x0e,0x07,0x56,0x13,0xdf,0x6c,0xae,0x01,0x1f,0x56,0x10,0xdf,0x4d,0xad,
-0x54,0x8b,0xde,0xff,0xed,0xa7,0xc8,0x7b,0x17,0xe1,0xaf,0x04,0x18,0xf9,0x0d,0x0d,
-0x17,0x30,0xf7,0x1c,0x17,0xd0,0x7b,0x0f,0x09,0x25,0x74,0x17,0x20,0xa4,0x1f,0x17,
-0xc0,0x09,0x0d,0x0f,0x56,0x2d,0x0d,0x0f,0x01,0x6f,0xff,0x23,0x18,0x00,0xce,0x36,
-0x05,0x03,0xa2,0x0e,0xc2,0x6c,0x05,0x5e,0x7c,0x0b,0x2f,0xb6,0x17,0x03,0x15,0x33,
-0x17,0x0d,0x10,0x08,0x4f,0x15,0x55,0x55,0x10,0xb0,0x01,0xff,0x46,0x17,0x09,0x13,
-0x07,0x03,0x2f,0x14,0x05,0xce,0x14,0x14,0x80,0xdf,0xbb,0x11,0xfb,0x84,0x18,0x03,
-0x48,0xc5,0x12,0x1c,0xb1,0x01,0x22,0x03,0xef,0xcd,0xcc,0x01,0x2f,0x5d,0x20,0x99,
-0x99,0xe3,0xb5,0x2e,0x99,0x99,0xad,0x30,0x0f,0xb0,0x01,0xff,0x3c,0x40,0x01,0x9e,
-0xfd,0x81,0xf1,0x00,0x13,0xb0,0x4f,0x36,0x57,0x93,0x02,0xcf,0xff,0x90,0x6e,0x16,
-0x16,0x40,0xec,0x26,0x11,0xfd,0x02,0x01,0x33,0xfd,0x55,0x8f,0x83,0x16,0x10,0x0d,
-0x04,0x0e,0x12,0x8e,0x20,0x07,0x02,0x74,0x44,0x1e,0x24,0x43,0x1a,0x0f,0xb0,0x01,
-0xff,0x3e,0x30,0x8e,0xfb,0x20,0xc1,0x8b,0x24,0xd6,0x00,0xef,0x1b,0x14,0x2f,0x79,
-0x08,0x02,0x11,0x32,0x1a,0xc0,0x0c,0x00,0x08,0x24,0x00,0x22,0x00,0x7d,0x4c,0x32,
-0x1f,0xd6,0xf8,0x04,0xff,0x44,0x4d,0x06,0xcf,0xfc,0x50,0x93,0x81,0x00,0x45,0x01,
-0x24,0xc5,0x6d,0xa7,0x06,0x63,0x0f,0xfd,0x00,0x01,0xef,0xe0,0x9b,0x17,0x57,0xf7,
-0x00,0x00,0x9f,0xf1,0x0c,0x00,0x04,0xff,0xd3,0x45,0xfc,0x00,0x00,0xef,0x2f,0x82,
-0x25,0xb4,0x5c,0x05,0x0d,0x17,0xcf,0xf6,0x17,0x28,0x07,0xcf,0xf6,0xaf,0x0f,0x6c,
-0x03,0xff,0x46,0x00,0x62,0x9d,0x10,0xfe,0x93,0xcf,0x34,0x05,0x9d,0xef,0x99,0xc0,
-0x13,0x6e,0xf0,0x12,0x15,0x6e,0xdc,0x0e,0x04,0x3c,0xc2,0x13,0xfc,0xf3,0x12,0x17,
-0xc1,0x08,0x73,0x07,0xd2,0xa6,0x08,0xa0,0x41,0x03,0x3c,0x00,0x15,0x2f,0xf5,0x75,
-0x04,0xe6,0x6f,0x13,0x10,0xac,0xc6,0x13,0x2e,0x03,0x11,0x01,0x3a,0x30,0x03,0xea,
-0x3e,0x13,0x5f,0xc2,0x0f,0x1a,0xcf,0x1b,0xd3,0x13,0xf2,0x6b,0x0b,0x07,0xcc,0x35,
-0x23,0xfd,0x00,0x85,0x5c,0x00,0xe5,0x01,0x40,0x68,0x9a,0xaa,0xaa,0x60,0x00,0x41,
-0xaa,0xaa,0xaa,0xac,0x56,0x01,0x1c,0x03,0x8a,0x00,0x1a,0xf4,0x34,0x45,0x02,0x07,
-0x02,0x1d,0x0c,0x13,0x00,0x3e,0xf5,0x08,0xff,0x27,0x00,0x01,0x41,0x9a,0x13,0x10,
-0xfa,0x5d,0x06,0x71,0x18,0x1a,0x20,0x47,0x7d,0x16,0x06,0xa1,0x59,0x2b,0xff,0x50,
-0xa0,0x62,0x05,0xea,0x2c,0x33,0x01,0x00,0x05,0xe2,0x00,0x13,0x7f,0x77,0x62,0x51,
-0x00,0x4a,0xf2,0x00,0x1f,0xdd,0x3d,0x12,0x27,0x51,0x01,0x69,0xd9,0x78,0x8b,0xef,
-0xff,0x80,0x91,0xd6,0x03,0x2f,0x1d,0x05,0xf8,0x5e,0x16,0xec,0xae,0x1b,0x14,0x05,
-0xd6,0x91,0x25,0x0a,0xff,0x58,0x54,0x23,0x03,0xdf,0x5d,0x0e,0x26,0x05,0xdf,0x11,
-0xb5,0x22,0x49,0xce,0x64,0x0e,0x35,0x00,0x48,0xcd,0xc0,0xb8,0x0d,0xc8,0x77,0x17,
-0xd4,0x4e,0x2e,0x1f,0xf8,0xc8,0x77,0x3c,0x3f,0xee,0xee,0xea,0xc8,0x77,0x3a,0x00,
-0xc2,0xd5,0x03,0x03,0x0e,0x04,0xc8,0x77,0x13,0x40,0xdf,0x56,0x12,0x3f,0x9e,0x01,
-0x14,0xbf,0xc8,0x77,0x3f,0xa7,0x69,0xef,0xc8,0x77,0x06,0x1e,0xa0,0xc8,0x77,0x05,
-0x5a,0xc0,0x00,0x9a,0x21,0x16,0x94,0xfb,0x03,0x17,0x80,0x69,0x0f,0x13,0xe6,0x0b,
-0x00,0x2a,0x1a,0xcf,0xd0,0xcb,0x16,0xb0,0x24,0x00,0x05,0x03,0x3f,0x06,0xe7,0xc1,
-0x17,0x06,0xfd,0x48,0x06,0xa3,0x47,0x01,0x08,0xb2,0x14,0x10,0xf6,0x00,0x25,0xec,
-0x82,0x86,0x12,0x08,0x1d,0xc2,0x1e,0xf6,0xc6,0xc4,0x02,0x61,0x01,0x17,0xb0,0xa8,
-0x18,0x17,0xf5,0xa2,0x82,0x06,0x0a,0x14,0x01,0x43,0x9c,0x0f,0xce,0x1a,0x18,0x0f,
-0x03,0x77,0xff,0x27,0x01,0x6b,0xb8,0x07,0x2e,0x46,0x17,0xf3,0xf6,0x1e,0x16,0x40,
-0x24,0x02,0x1e,0xf6,0xe8,0xc3,0x05,0xa6,0xd0,0x03,0x75,0x0f,0x15,0xb0,0x56,0x77,
-0x3f,0x55,0x55,0x00,0xb0,0x01,0xff,0x46,0x16,0x0b,0x96,0x01,0x17,0x01,0xdd,0x42,
-0x06,0xe6,0x96,0x00,0x3e,0x08,0x13,0xfa,0x95,0xbc,0x00,0x17,0x05,0x13,0x80,0xe0,
-0x1b,0x11,0x05,0x03,0x6a,0x02,0x71,0x80,0x41,0x19,0x99,0x99,0x40,0xcb,0x0d,0x0e,
-0x99,0x19,0x0f,0xb0,0x01,0xff,0x3b,0x26,0x01,0x9e,0x44,0x1b,0x01,0x1c,0x8d,0x00,
-0x91,0x01,0x11,0x30,0x38,0x11,0x11,0xf3,0x79,0x08,0x1a,0x90,0x0c,0x00,0x08,0x24,
-0x00,0x03,0x3c,0x00,0x2f,0xce,0xc4,0x98,0x01,0xff,0x40,0x03,0x36,0x6f,0x03,0x76,
-0xc4,0x03,0x35,0xc5,0x12,0x1d,0x27,0x00,0x12,0x2e,0x02,0x05,0x03,0x88,0xd5,0x12,
-0x5f,0x50,0x01,0x0e,0xa0,0x23,0x03,0x09,0x16,0x03,0x50,0x4f,0x0f,0x0d,0x00,0x88,
-0x02,0xb2,0x07,0x11,0x1e,0xcc,0x09,0x11,0x0a,0xea,0x05,0x03,0x2d,0x32,0x02,0xa4,
-0xc9,0x14,0x8f,0xfd,0x27,0x1e,0x80,0x67,0x07,0x0f,0xe7,0x00,0x99,0x02,0x4c,0x08,
-0x03,0x90,0x30,0x14,0x2e,0x97,0x14,0x14,0x4f,0x71,0x28,0x13,0x5f,0x8f,0x30,0x00,
-0x42,0x02,0x20,0x50,0x3e,0xf4,0x00,0x00,0x66,0x3d,0x00,0xf4,0x01,0x50,0x70,0x28,
-0x88,0x88,0x20,0xa2,0x3d,0x1e,0x88,0x23,0x11,0x0e,0x0b,0x01,0x05,0xb2,0x1c,0x0f,
-0x13,0x00,0xd4,0x30,0x02,0xbe,0xe9,0x0b,0x08,0x22,0xdf,0xc3,0x79,0xda,0x12,0x07,
-0x9e,0x95,0x02,0x24,0x68,0x00,0xa2,0x72,0x01,0x29,0x00,0x24,0xf7,0x0d,0xf3,0xc4,
-0x23,0x10,0x1a,0xb2,0x2c,0x1f,0x30,0x43,0x01,0xf6,0x00,0x01,0x00,0x28,0x56,0x20,
-0x3e,0x1d,0x16,0xe8,0xa0,0xa0,0x02,0x7a,0x21,0x24,0x06,0xa0,0xa5,0x66,0x54,0xf9,
-0x10,0x2c,0xff,0x50,0x1c,0x39,0x12,0xfe,0xf3,0xdb,0x19,0x04,0x23,0xc0,0x18,0x5a,
-0xa7,0x68,0x27,0x02,0xaf,0xc7,0x1d,0x02,0xee,0x0e,0x18,0x50,0x50,0xbd,0x04,0x43,
-0x63,0x26,0xd9,0xff,0xc1,0x3c,0x25,0x90,0x08,0xd2,0x1e,0x28,0x9d,0x30,0x8e,0x65,
-0x06,0xcd,0x1e,0x44,0x00,0x00,0x12,0x20,0xe3,0x74,0x67,0x01,0x7c,0xff,0xff,0xfc,
-0x62,0x67,0xdd,0x21,0xff,0xde,0x5d,0x03,0x17,0x09,0x03,0x2b,0x17,0x08,0xe2,0x43,
-0x18,0x04,0x35,0x9e,0x10,0xcf,0xb7,0x14,0x21,0x00,0x15,0x75,0x0d,0x01,0x4e,0x1f,
-0x03,0x42,0x0c,0x05,0xd0,0xb1,0x00,0xce,0x0f,0x16,0xbf,0xf9,0xcb,0x11,0xfe,0xd9,
-0xc7,0x04,0x19,0x00,0x04,0x4c,0x0c,0x00,0xdb,0x54,0x05,0x2c,0x7f,0x03,0x9d,0xba,
-0x14,0xd0,0xc9,0xca,0x04,0xe9,0x10,0x13,0x07,0x6f,0x6d,0x05,0x0f,0xc9,0x13,0x05,
-0xe6,0x0e,0x01,0x6a,0x74,0x12,0x0e,0xfe,0x0f,0x11,0x6f,0xbb,0x00,0x01,0xf7,0x52,
-0x01,0xf9,0x06,0x17,0x90,0x45,0x2a,0x17,0xd0,0x2a,0x07,0x17,0xe2,0x28,0x23,0x17,
-0xc2,0x5d,0x10,0x25,0x70,0x00,0x70,0xd5,0x14,0xa6,0x86,0x2d,0x11,0xeb,0x9e,0xbf,
-0x12,0x40,0x82,0x00,0x34,0xd6,0x10,0x5f,0x40,0x3e,0x04,0x98,0x15,0x15,0xcf,0x84,
-0x1c,0x00,0x78,0xc0,0x24,0x46,0xbf,0x4b,0x3d,0x11,0xfc,0x6f,0x32,0x00,0xbc,0x01,
-0x30,0x14,0x44,0x20,0x33,0xb3,0x0f,0x87,0x09,0x13,0x0f,0xfd,0x77,0xff,0x1b,0x18,
-0xbf,0x22,0x1c,0x18,0xcf,0xa3,0x94,0x18,0xdf,0x23,0x1c,0x08,0x7f,0xcd,0x18,0x03,
-0x88,0x29,0x18,0x04,0x20,0x55,0x17,0x06,0x7c,0x22,0x00,0xed,0x4b,0x0f,0x18,0x27,
-0x0e,0x0f,0x7a,0x78,0xff,0x30,0x1d,0x00,0x55,0x10,0x18,0x02,0x3c,0x24,0x17,0xbf,
-0x04,0x3b,0x17,0x5f,0xde,0x01,0x17,0x1e,0xde,0x10,0x03,0xad,0xd3,0x04,0xdc,0x01,
-0x1e,0xf7,0x8b,0x3d,0x0f,0xc2,0x01,0xff,0x4e,0x00,0x37,0x3a,0x18,0xd2,0xac,0x61,
-0x18,0xe2,0x32,0x3a,0x15,0xe3,0x5d,0x03,0x14,0xf9,0xb6,0x01,0x12,0x07,0xa5,0x55,
-0x14,0xf4,0x31,0x4d,0x00,0x35,0x00,0x10,0xf5,0x3c,0x00,0x8e,0x99,0x99,0x92,0x00,
-0x00,0x02,0x99,0x99,0x1d,0x5c,0x0f,0xc2,0x01,0xff,0x4c,0x10,0x4b,0x65,0x39,0x15,
-0x0b,0x1f,0xd5,0x32,0xfd,0x61,0x05,0x24,0x05,0x17,0x4f,0x60,0x39,0x04,0x5a,0x0e,
-0x03,0x5e,0x7b,0x14,0x94,0x5b,0x39,0x00,0xb3,0x43,0x00,0xbc,0x23,0x1e,0xf8,0x56,
-0x39,0x0f,0xc2,0x01,0xff,0x58,0x02,0x93,0x38,0x11,0x8e,0x93,0x38,0x13,0x1e,0xbf,
-0x18,0x13,0xfe,0x6f,0xa7,0x04,0x96,0x1c,0x24,0x00,0x5f,0x79,0x24,0x11,0x50,0x8a,
-0x15,0x15,0xf8,0xb6,0x38,0x31,0x02,0xbe,0xd7,0x24,0x49,0x1f,0xb2,0xef,0x06,0xff,
-0x54,0x18,0x10,0x45,0x4a,0x27,0xf9,0x10,0xc6,0x1b,0x05,0x31,0x23,0x09,0x04,0xee,
-0x17,0x3f,0x7e,0x18,0x07,0x0c,0xbd,0x05,0x9b,0x6e,0x03,0x45,0x07,0x2f,0xdf,0xd8,
-0x74,0x03,0x17,0x18,0x08,0xba,0x5f,0x08,0xbb,0xda,0x1f,0x98,0x19,0x00,0x12,0x26,
-0x36,0x66,0x01,0x00,0x1f,0x30,0x35,0x02,0x0c,0x09,0xdb,0x0a,0x18,0x91,0xa4,0x2b,
-0x1e,0xc0,0x97,0x0c,0x07,0xb3,0xa9,0x0c,0x7e,0x24,0x28,0x00,0xaf,0xa4,0x35,0x3c,
-0x7d,0xfd,0x80,0xf4,0x2b,0x08,0xd4,0xe6,0x17,0x90,0xcd,0x35,0x13,0xf2,0x84,0x01,
-0x58,0xff,0xed,0xa6,0xff,0xfb,0x94,0x5a,0x08,0x89,0x1d,0x2a,0xf3,0x00,0xcf,0x01,
-0x09,0xe8,0x01,0x11,0xaf,0x49,0x13,0x11,0xef,0x01,0x02,0x11,0x2f,0x4f,0x0b,0x15,
-0x0e,0xcf,0x8a,0x12,0xa0,0x35,0x0d,0x00,0x22,0x37,0x01,0xf7,0xb4,0x13,0xfd,0x6e,
-0xd5,0x01,0x09,0xeb,0x10,0x5a,0x29,0xd8,0x03,0xf5,0x2b,0x15,0xd0,0x36,0x7f,0x40,
-0x07,0xff,0xf5,0x05,0x9e,0x29,0x01,0xd7,0x01,0x21,0xef,0xfd,0xb0,0x02,0x01,0xcf,
-0x0a,0x34,0x7f,0xff,0x50,0xc9,0x02,0x41,0x60,0x0e,0xff,0xd0,0xeb,0x5e,0x11,0x4f,
-0x96,0x7c,0x02,0x46,0x7a,0x10,0x61,0x5b,0x0c,0x22,0xef,0xfd,0x31,0x98,0x11,0x0e,
-0x29,0x84,0x15,0x50,0x2b,0xd5,0x04,0x27,0x5f,0x22,0xb0,0x02,0x83,0x1b,0x16,0x07,
-0x5f,0x1c,0x01,0xeb,0x80,0x18,0xfc,0xf0,0xbe,0x17,0x20,0xaa,0x03,0x17,0x50,0xc3,
-0x03,0x16,0x40,0xee,0x38,0x22,0xf9,0x10,0x76,0x09,0x53,0x9a,0xde,0xfe,0xdb,0x61,
-0xd9,0x0e,0x17,0xe0,0xe3,0x2d,0x1f,0xf7,0x75,0xef,0x03,0x17,0x0c,0x14,0x1b,0x17,
-0x1d,0x6b,0x0b,0x17,0x1e,0xac,0x02,0x08,0x21,0x60,0x17,0x4f,0x15,0x28,0x17,0x5f,
-0xe1,0x34,0x01,0xab,0x32,0x05,0x5e,0x2e,0x1f,0x53,0x62,0x02,0x08,0x0f,0x75,0x7c,
-0xff,0x19,0x08,0x7c,0x63,0x0c,0xba,0x5a,0x16,0x0c,0x7f,0x46,0x17,0x07,0x03,0xe2,
-0x07,0x82,0x03,0x16,0xbf,0x93,0x01,0x03,0x66,0xea,0x03,0x5f,0x46,0x1f,0x30,0x9e,
-0x01,0xff,0x38,0x16,0x3e,0x04,0x48,0x16,0x5f,0x86,0x01,0x15,0x7f,0xf2,0xb0,0x00,
-0xd6,0x14,0x03,0x1b,0x03,0x10,0x01,0xa9,0x6f,0x01,0xea,0x14,0x00,0x81,0x0b,0x11,
-0xfb,0x6f,0x03,0x10,0x80,0x9b,0x1b,0x12,0x54,0xbf,0x0e,0x0e,0x5c,0x64,0x0f,0x9e,
-0x01,0xff,0x2c,0x31,0x03,0xcf,0xd7,0x31,0x20,0x14,0xa1,0x9e,0xef,0x00,0xf7,0xea,
-0x04,0x08,0x78,0x01,0xc2,0x06,0x11,0x07,0x11,0x12,0x14,0x0f,0x17,0x55,0x20,0x70,
-0x00,0xe1,0x53,0x00,0xc4,0x44,0x10,0xed,0x12,0x05,0x3f,0x8d,0xea,0x10,0xc3,0x04,
-0xff,0x37,0x08,0x66,0x06,0x04,0x3c,0xf7,0x04,0x07,0x31,0x17,0xb0,0x31,0x08,0x17,
-0xc0,0x67,0x06,0x17,0xd1,0x85,0x30,0x17,0xe2,0x09,0x09,0x17,0xf3,0xc6,0x34,0x1f,
-0x52,0x2f,0x03,0x0b,0x0f,0x71,0x7d,0xff,0xbd,0x04,0xc1,0xe9,0x0f,0x0c,0x00,0x62,
-0x03,0xe4,0x9d,0x00,0x0c,0x00,0x04,0xe4,0x9d,0x00,0x95,0x51,0x04,0x70,0x8b,0x17,
-0x5f,0x7b,0x6b,0x17,0x5f,0xed,0x39,0x17,0x5f,0xe4,0x9d,0x16,0x5f,0x8a,0xde,0x26,
-0x70,0x5f,0xec,0x8a,0x14,0xc0,0x6c,0x00,0x03,0x4b,0xc9,0x14,0xf7,0x47,0x0d,0x04,
-0x0c,0x00,0x00,0xa4,0x03,0x04,0x0c,0x00,0x00,0x29,0x0d,0x07,0x0c,0x00,0x1f,0xf7,
-0x0c,0x00,0x01,0x17,0x6f,0x24,0x00,0x17,0x8f,0x3c,0x00,0x00,0xd9,0x17,0x0b,0x6c,
-0x00,0x08,0x84,0x00,0x04,0xd1,0xe0,0x27,0x60,0x5f,0xe4,0x9d,0x17,0x5f,0x57,0x18,
-0x17,0x5f,0xa5,0x27,0x0b,0xfc,0x00,0x02,0x14,0x01,0x16,0x90,0x2c,0x01,0x1f,0x82,
-0xb0,0x01,0x67,0x00,0xe1,0x3a,0x20,0xfd,0x50,0x30,0x3b,0x25,0xe9,0x00,0xaf,0xf5,
-0x02,0xa7,0xf5,0x05,0x00,0x6f,0x18,0xf0,0xfc,0x6e,0x08,0xf8,0x6e,0x24,0xa0,0x00,
-0xe3,0x1f,0x02,0x3a,0x1b,0x0f,0x5b,0x04,0xff,0xd5,0x08,0xab,0x36,0x1b,0x50,0x60,
-0x6b,0x1c,0xf5,0xbb,0xc4,0x0e,0x21,0x00,0x0e,0x01,0x00,0x0f,0xf2,0x73,0xff,0xff,
-0x54,0x05,0x8b,0x2a,0x08,0x47,0xc7,0x0b,0x0c,0x00,0x05,0x06,0x6d,0x0e,0xbb,0x73,
-0x0f,0x0f,0x2f,0xff,0x48,0x00,0xec,0xa9,0x46,0x70,0x00,0x00,0x04,0xc4,0x22,0x11,
-0x0c,0xe4,0x00,0x16,0xaf,0x26,0x14,0x13,0x9f,0x5c,0xc7,0x17,0x10,0x25,0x7b,0x27,
-0x10,0x3c,0x03,0x0b,0x2b,0x0c,0xff,0x98,0x03,0x1a,0x1d,0x8b,0xb1,0x03,0xf2,0xd0,
-0x18,0xe4,0x62,0x4e,0x4f,0x8b,0xdd,0xca,0x50,0x6e,0x04,0xff,0xff,0x4b,0x11,0xb0,
-0xbb,0x00,0x02,0x40,0x0a,0x11,0xf1,0x09,0xe5,0x03,0x27,0xfe,0x21,0x40,0x15,0x57,
-0x51,0x05,0xa7,0x14,0x05,0xe3,0xd8,0x05,0x2b,0x16,0x15,0x5e,0x69,0x5e,0x00,0x5e,
-0xef,0x3f,0xcd,0xdc,0x94,0x86,0x04,0xff,0x52,0x0f,0xe1,0x03,0xff,0xff,0x17,0x03,
-0x87,0xbd,0x08,0x27,0x5f,0x1b,0xf7,0x04,0x48,0x1b,0xe2,0x38,0x28,0x1b,0xf2,0x69,
-0x4a,0x1c,0xfb,0x94,0xe4,0x09,0xcd,0x81,0x00,0xc4,0x0e,0x2b,0x65,0x80,0x56,0x48,
-0x09,0xd7,0x5f,0x2b,0x0e,0xff,0x9b,0x5f,0x1c,0x3f,0x01,0x76,0x45,0x19,0xdf,0xfd,
-0x81,0x0e,0x04,0x17,0x40,0x0e,0x04,0x27,0xfd,0x40,0x0e,0x04,0x18,0xf8,0x0e,0x04,
-0x17,0x70,0x0e,0x04,0x12,0xf1,0x0e,0x04,0x21,0x31,0x26,0x5c,0x2d,0x12,0x0a,0xa9,
-0x0c,0x01,0x79,0x03,0x0f,0x0e,0x04,0x14,0x3f,0x27,0xac,0xee,0x0e,0x04,0x0c,0x1a,
-0xbf,0x0e,0x04,0x26,0xf9,0x41,0x0e,0x04,0x1f,0x40,0x0e,0x04,0x3b,0x28,0x30,0x02,
-0xa9,0x7b,0x03,0xde,0x7c,0x01,0x5a,0x0e,0x21,0x03,0xdf,0x12,0x01,0x02,0x3f,0x02,
-0x00,0x0e,0x04,0x10,0x60,0x45,0x34,0x16,0x91,0x5b,0x3e,0x16,0xa0,0x88,0x03,0x08,
-0x77,0xf9,0x17,0xd0,0x85,0x0d,0x17,0x80,0xb2,0x1c,0x17,0x70,0x0c,0x00,0x28,0xe5,
-0x59,0x29,0xe9,0x04,0x82,0xfa,0x08,0xca,0x01,0x17,0x5f,0x00,0x0e,0x35,0x02,0xae,
-0xff,0xf3,0x53,0x08,0x8b,0x73,0x0b,0x28,0x1c,0x09,0x1d,0xf6,0x0a,0x1c,0x0e,0x29,
-0x00,0x0e,0x88,0x02,0x18,0x8f,0x11,0x02,0x19,0x03,0xa7,0x04,0x02,0xe6,0x4a,0x0f,
-0x01,0x00,0x1e,0x0f,0xa9,0xe2,0xff,0xc6,0x05,0x74,0x04,0x1e,0xfc,0xad,0x61,0x16,
-0x0b,0xa8,0x19,0x1a,0x05,0x30,0xbe,0x1e,0x40,0x9f,0x61,0x01,0xa9,0xf0,0x0f,0x98,
-0x61,0x15,0x0f,0xd1,0xb0,0xff,0x1b,0x01,0x4c,0xeb,0x0e,0xd3,0xde,0x05,0xbf,0xbe,
-0x17,0xb0,0xe0,0x8a,0x15,0xaf,0x50,0xcc,0x12,0x1d,0x03,0xcd,0x05,0xbe,0xee,0x10,
-0xfa,0xef,0x00,0x02,0xcf,0x01,0x41,0x06,0x88,0x88,0x60,0x73,0x0d,0x1f,0x60,0x06,
-0x04,0xff,0xfa,0x16,0x2d,0xc5,0x81,0x16,0x3e,0xf9,0x03,0x16,0x4f,0xa1,0x1d,0x02,
-0x18,0x63,0x14,0x40,0xc4,0x20,0x02,0x2e,0x16,0x02,0x8d,0x32,0x11,0x3e,0x03,0x03,
-0x10,0x39,0x1b,0x7f,0x00,0xea,0x00,0x0e,0xfd,0x81,0x0f,0x06,0x04,0xff,0x30,0x28,
-0x01,0xae,0x9a,0x32,0x19,0x0c,0xc3,0x91,0x0a,0x1a,0x8f,0x19,0x4f,0x02,0x4f,0x19,
-0x1f,0x9f,0x02,0x1a,0x06,0x2a,0x0a,0x3f,0x15,0x62,0x00,0x0c,0x08,0xff,0xfd,0x37,
-0x06,0xdf,0xd6,0x2c,0x02,0x1e,0xf6,0x4b,0x6c,0x09,0xea,0x4e,0x04,0x2c,0xc7,0x02,
-0x98,0x30,0x06,0x1a,0x53,0x1e,0x46,0x36,0x55,0x0f,0x06,0x04,0xff,0x30,0x00,0x82,
-0x41,0x00,0x07,0x00,0x24,0x11,0x11,0xc6,0xeb,0x17,0xf4,0x96,0x75,0x10,0xaf,0xf4,
-0x83,0x13,0xef,0x1f,0x03,0x00,0x32,0x02,0x13,0xf5,0x0f,0x3a,0x03,0x03,0x01,0x07,
-0xb6,0x09,0x19,0x1d,0x8b,0x19,0x29,0x02,0xef,0x49,0x0c,0x19,0x3f,0xbb,0x02,0x4f,
-0x03,0xbb,0xbb,0x60,0x14,0x04,0x17,0x1a,0x74,0x14,0x04,0x1a,0xd7,0x14,0x04,0x1a,
-0xd4,0xde,0x82,0x19,0x50,0x14,0x04,0x19,0xf4,0x14,0x04,0x24,0xfe,0x10,0x14,0x04,
-0x01,0xb2,0x71,0x15,0x90,0x14,0x04,0x01,0xa6,0xb1,0x06,0x90,0x0f,0x00,0x5b,0x58,
-0x06,0x14,0x04,0x00,0xd0,0x6f,0x06,0x14,0x04,0x00,0x02,0x26,0x19,0x8f,0xd4,0x11,
-0x0f,0x14,0x04,0x83,0x46,0x3d,0xdd,0xdd,0xda,0x14,0x04,0x19,0x6f,0x14,0x04,0x13,
-0xaf,0x1c,0xdf,0x15,0xa0,0x46,0xd5,0x05,0x14,0x04,0x02,0xff,0x36,0x03,0x14,0x04,
-0x12,0x16,0x58,0x92,0x07,0x14,0x04,0x1e,0xfc,0x14,0x04,0x09,0x24,0xd8,0x05,0x14,
-0x04,0x18,0xb1,0x14,0x04,0x17,0xc5,0x14,0x04,0x27,0xda,0x73,0xcd,0x42,0x02,0x8f,
-0x9a,0x10,0x3e,0x0c,0x00,0x02,0xf4,0x0b,0x00,0x79,0x02,0x14,0x90,0x27,0x6b,0x11,
-0x2e,0xdd,0xf5,0x15,0x30,0x5d,0x02,0x04,0x3d,0x08,0x17,0x1d,0x19,0x8a,0x4f,0x1a,
-0xbb,0xba,0x10,0x14,0x04,0xff,0x3f,0x11,0x48,0xc1,0x7f,0x13,0x38,0xea,0x5c,0x01,
-0xe0,0x96,0x16,0x4f,0xb2,0xa1,0x35,0xfd,0x10,0x4f,0xa2,0x10,0x11,0x9f,0xca,0xb0,
-0x07,0x83,0x8d,0x07,0xf4,0x03,0x18,0x7f,0x0e,0x6d,0x00,0xe5,0xc1,0x0f,0xb5,0x67,
-0x1d,0x0f,0xee,0xf0,0xff,0xb9,0x08,0xea,0xab,0x00,0x1b,0x00,0x0f,0x10,0x00,0x0c,
-0x19,0xfe,0x10,0x00,0x39,0x1f,0xff,0xfc,0x10,0x00,0x39,0x4f,0xff,0xf8,0x10,0x00,
-0x39,0x9f,0xff,0xf2,0x10,0x00,0x07,0x8b,0x12,0x12,0x6f,0x25,0x5e,0x18,0x30,0x10,
-0x00,0x3a,0x01,0xaf,0xf9,0x90,0x00,0x3a,0x03,0x90,0x00,0x6b,0xbf,0x2a,0x00,0x00,
-0x6f,0xbf,0x06,0x9d,0x20,0x05,0x6e,0x05,0x08,0x2e,0xae,0x0a,0x75,0x89,0x02,0x10,
-0x00,0x07,0x7f,0xbf,0x07,0x32,0x48,0x14,0x1b,0x10,0x00,0x08,0x87,0xbf,0x08,0xab,
-0x7f,0x04,0x70,0x00,0x08,0xf2,0xad,0x03,0x60,0x02,0x05,0x0e,0xae,0x0f,0x08,0x00,
-0x04,0x1f,0xf5,0x10,0x00,0x09,0x08,0x5a,0xae,0x08,0x1e,0xa8,0x0f,0x70,0x00,0x05,
-0x08,0x66,0xae,0x04,0x2b,0x0a,0x17,0x80,0xb0,0x00,0x09,0xb7,0xbf,0x04,0xfa,0x59,
-0x2f,0xd9,0x8a,0x10,0x01,0x07,0x1b,0x0b,0x10,0x00,0x09,0xc7,0xbf,0x2b,0x00,0x00,
-0xcb,0xbf,0x1c,0x00,0xcf,0xbf,0x0f,0x0d,0x7b,0xff,0xfe,0x0e,0xe5,0xb1,0x09,0x0e,
-0x00,0x00,0x35,0x57,0x10,0x9f,0x3f,0x98,0x19,0x50,0x4c,0x00,0x1f,0xf1,0x0e,0x00,
-0x1c,0x0e,0x62,0x00,0x0e,0x0e,0x00,0x0d,0x3b,0x04,0x0a,0x39,0x04,0x09,0x37,0x04,
-0x0a,0x35,0x04,0x0a,0x23,0x03,0x09,0x31,0x04,0x0a,0x2f,0x04,0x0a,0x2d,0x04,0x0a,
-0x2b,0x04,0x0a,0xb9,0x03,0x0a,0x27,0x04,0x0a,0x25,0x04,0x0a,0x13,0x04,0x0a,0x0e,
-0x00,0x0a,0x1f,0x04,0x0a,0x1d,0x04,0x0a,0x62,0x00,0x0a,0x19,0x04,0x0a,0x17,0x04,
-0x0b,0x15,0x04,0x0a,0x13,0x04,0x0a,0xee,0x00,0x0b,0x0f,0x04,0x0a,0x0d,0x04,0x0b,
-0x0b,0x04,0x08,0x09,0x04,0x08,0x59,0x23,0x16,0x2f,0xb3,0x8f,0x0f,0x17,0x00,0x04,
-0x0e,0x6e,0x08,0x0f,0x47,0x88,0xff,0x91,0x17,0x04,0xe4,0x04,0x0f,0x0c,0x00,0x0d,
-0x1e,0xfd,0xe3,0x27,0x0f,0xba,0x4b,0xff,0x48,0x01,0xb2,0xb3,0x53,0x06,0x88,0x87,
-0x00,0x00,0x92,0x09,0x04,0x92,0xad,0x10,0xf2,0x41,0x04,0x12,0xfb,0xfb,0x04,0x32,
-0xd4,0x11,0x6f,0x94,0x00,0x17,0x2f,0x08,0x99,0x15,0x5f,0x2e,0x0e,0x02,0x3a,0xe1,
-0x24,0xff,0xc2,0x10,0x0e,0x3f,0xed,0xc9,0x40,0x92,0x03,0xff,0x93,0x10,0x80,0x58,
-0x00,0x15,0xfd,0xa9,0x1e,0x01,0xef,0x01,0x00,0x8a,0x10,0x36,0xfb,0x30,0x16,0x62,
-0x0a,0x18,0xff,0xcd,0xe3,0x05,0xaf,0x0f,0x17,0x6f,0xf1,0x01,0x49,0x00,0x6a,0xcd,
-0xdc,0xd3,0x7d,0x0f,0xc4,0x52,0xff,0x47,0x27,0x26,0x51,0x2d,0x35,0x08,0x3d,0x3a,
-0x1e,0xf1,0x52,0x6f,0x00,0x79,0x00,0x1d,0xf3,0xde,0xa6,0x00,0x61,0x64,0x2f,0xea,
-0x10,0x3c,0x07,0xff,0x9c,0x01,0x80,0x49,0x18,0xe8,0x75,0x15,0x08,0x44,0x95,0x17,
-0xf1,0x60,0x17,0x17,0xf2,0xa6,0x11,0x16,0xe0,0x75,0x23,0x16,0xfe,0x8f,0x05,0x2f,
-0x36,0x51,0x54,0x07,0xff,0x4f,0x0f,0xae,0x96,0xff,0x7b,0x16,0x3e,0x77,0x25,0x16,
-0x2f,0x1b,0x05,0x19,0x0b,0x4b,0x42,0x16,0xe0,0x49,0x05,0x18,0xfc,0x5d,0xa9,0x17,
-0x48,0x50,0xee,0x17,0xf6,0xce,0x32,0x16,0x90,0x5d,0x4b,0x05,0x30,0x00,0x45,0x8d,
-0xff,0xd9,0x20,0x32,0x03,0x03,0x5c,0x00,0x14,0x6e,0x47,0x6a,0x05,0x49,0x6e,0x13,
-0xfb,0x37,0x00,0x04,0x77,0x13,0x17,0x0b,0x3c,0x0f,0x15,0x5f,0x5f,0x41,0x35,0x20,
-0x00,0xef,0x8f,0xb8,0x23,0x90,0x05,0x9f,0x0f,0x13,0xbf,0xcc,0x18,0x13,0x40,0x57,
-0xb8,0x04,0x9d,0x16,0x16,0x0f,0xce,0x43,0x00,0x0c,0x00,0x27,0xf8,0x3f,0xa1,0x42,
-0x1f,0x4f,0x3e,0x03,0x13,0x22,0xfd,0xaa,0x01,0x00,0x18,0xa7,0x49,0xe5,0x07,0x63,
-0xda,0x02,0x13,0x7c,0x01,0xdb,0x09,0x25,0x20,0x00,0x54,0x18,0x22,0x6f,0xd1,0x56,
-0x4e,0x40,0xb4,0x00,0x01,0x5c,0x08,0x01,0x15,0x2f,0x8d,0x01,0x17,0xb0,0x4e,0x18,
-0x02,0x25,0x71,0x05,0x2f,0x04,0x26,0x03,0xcf,0xdb,0xc8,0x02,0x7e,0xeb,0x23,0xff,
-0xb2,0x4e,0x01,0x17,0x49,0x86,0x0f,0x17,0x0d,0xf7,0x40,0x17,0x5f,0xc3,0x22,0x16,
-0x9f,0xbb,0x1e,0x00,0xb0,0xd8,0x27,0x11,0x40,0xa3,0x16,0x17,0xf0,0xe1,0x28,0x08,
-0x98,0xcd,0x04,0x55,0x00,0x00,0x8f,0x01,0x15,0xb3,0x3e,0x00,0x21,0x23,0x30,0x40,
-0x11,0x00,0xfe,0x0a,0x00,0x06,0x00,0x11,0x70,0x55,0x01,0x13,0x70,0x33,0xd8,0x00,
-0x36,0x02,0x22,0x70,0x0b,0xe4,0x03,0x00,0xb0,0x18,0x14,0x8b,0x99,0xef,0x13,0x2d,
-0x5f,0x5f,0x04,0x05,0x05,0x16,0xa0,0x5f,0x04,0x1f,0x90,0x54,0x07,0xff,0x9c,0x14,
-0x1d,0x9b,0x02,0x11,0xa0,0x92,0x03,0x14,0xfc,0xe4,0x5b,0x00,0xd7,0x01,0x10,0xc1,
-0xff,0xf9,0x04,0x25,0x25,0x05,0x41,0x02,0x18,0x0b,0x07,0x19,0x08,0x5d,0x29,0x4f,
-0x08,0xbb,0xbb,0x30,0xfe,0x0a,0xff,0x53,0x19,0x04,0xbe,0xa8,0x16,0x06,0x8b,0x03,
-0x04,0x3b,0x2b,0x17,0xd1,0x0e,0x4f,0x16,0xe9,0x5c,0x2d,0x00,0x83,0x9a,0x15,0x06,
-0xae,0x38,0x10,0x1c,0x37,0x00,0x04,0x78,0x4d,0x00,0xd9,0x26,0x00,0xd3,0x7d,0x01,
-0x06,0x00,0x0f,0x01,0x00,0x1d,0x64,0x03,0x8b,0xdf,0xff,0xec,0x96,0x98,0x02,0x03,
-0x62,0x76,0x19,0xa3,0x94,0xf0,0x02,0xc8,0x00,0x19,0x03,0xa6,0xa1,0x1a,0x02,0x2f,
-0xa8,0x11,0xdf,0x5c,0x71,0x13,0xce,0xd8,0x1e,0x10,0x8f,0x04,0xc5,0x41,0x10,0x00,
-0x02,0x9f,0xff,0x01,0x14,0x1f,0xd5,0x00,0x13,0x5f,0x5a,0xb6,0x06,0x7b,0xa2,0x10,
-0xf9,0x39,0x00,0x16,0xf8,0x0d,0xdf,0x06,0xb9,0x2e,0x4a,0x0c,0xee,0xee,0xed,0xca,
-0x9f,0x0a,0x08,0x28,0x06,0xaf,0xeb,0x0e,0x6c,0x1e,0x05,0xd6,0x01,0x21,0x01,0x33,
-0x01,0x00,0x13,0x30,0x7b,0x5d,0x03,0xe8,0x13,0x12,0x0c,0x03,0x03,0x16,0x06,0x99,
-0xc3,0x07,0x05,0x14,0x01,0x3f,0x8f,0x06,0x1d,0x00,0x03,0x61,0x82,0x03,0x1d,0x00,
-0x05,0x0b,0x55,0x05,0x24,0x3d,0x16,0xfe,0xdb,0x03,0x07,0xcf,0x49,0x04,0xac,0xf5,
-0x15,0xa0,0x1d,0x00,0x03,0x7f,0x4a,0x04,0x1d,0x00,0x06,0x18,0x2d,0x01,0xed,0x3b,
-0x01,0xf8,0x01,0x13,0x92,0x6d,0x07,0x13,0xf0,0x6c,0x82,0x23,0xcb,0xbd,0x37,0x14,
-0x18,0x1e,0xee,0xf0,0x08,0x6b,0x82,0x01,0x60,0x00,0x15,0x1a,0x0f,0x04,0x17,0x50,
-0x12,0xf3,0x04,0xec,0x22,0x00,0xb0,0x4a,0x25,0xff,0xdc,0xdf,0x01,0x17,0x08,0xb4,
-0x2d,0x06,0x3c,0x83,0x02,0xd4,0x02,0x14,0x90,0x99,0x56,0x13,0xfc,0x14,0xac,0x00,
-0x6a,0x00,0x10,0xb0,0x20,0xea,0x02,0x8a,0x1b,0x10,0xf9,0xb2,0x01,0x18,0xfc,0x55,
-0x6c,0x0f,0x4d,0x29,0x16,0x0f,0x6e,0xd6,0xff,0x9b,0x01,0x20,0x0a,0x11,0xf1,0x2c,
-0x02,0x14,0x50,0x6a,0x03,0x01,0xf6,0xec,0x15,0xf4,0x2e,0x1f,0x35,0x50,0x01,0x9f,
-0x18,0x1d,0x00,0xbb,0xe9,0x06,0x13,0x20,0x17,0x03,0xbf,0xc7,0x05,0x42,0x04,0x06,
-0xa7,0x03,0x4e,0x4a,0xdf,0xfe,0xc8,0x20,0x87,0x0f,0xa6,0x04,0xff,0xfc,0x01,0xda,
-0x03,0x12,0x0d,0x2b,0x09,0x31,0xef,0xff,0xf1,0x01,0x03,0x03,0x2b,0x0b,0x35,0x30,
-0x03,0xcf,0x43,0xbe,0x05,0xb6,0xc3,0x18,0x06,0xa4,0x40,0x14,0x5e,0x79,0x21,0x00,
-0x01,0x00,0x20,0x6b,0xef,0xc0,0xd8,0x1f,0x00,0xa6,0x04,0xff,0xc6,0x00,0x26,0x53,
-0x18,0xfc,0xa4,0x17,0x19,0xaf,0x36,0x36,0x19,0x1f,0x0a,0x27,0x18,0x02,0x78,0xeb,
-0x0c,0x3d,0x34,0x2a,0x00,0x4e,0xa3,0x36,0x12,0x15,0xaf,0xcc,0x0f,0x4c,0x09,0xff,
-0xff,0x0d,0x38,0x02,0xbe,0xea,0xc5,0x78,0x17,0xd0,0x37,0x3f,0x17,0xf4,0xc2,0x14,
-0x17,0xf6,0xf2,0x14,0x2d,0xf2,0x00,0x88,0x09,0x00,0x81,0x69,0x2f,0x52,0x00,0xa6,
-0x04,0xff,0xca,0x0f,0x15,0x04,0xff,0xdb,0x0d,0x12,0x06,0x39,0x88,0x88,0x40,0x15,
-0x24,0x1a,0xf9,0x09,0x3d,0x19,0x80,0x07,0x3d,0x08,0xe4,0x3c,0x1a,0x09,0x67,0xb3,
-0x19,0xcf,0x35,0x22,0x19,0x2f,0x96,0xa5,0x1a,0x08,0x2e,0x3d,0x19,0xef,0x5f,0x3d,
-0x2a,0x01,0x9f,0xfa,0xc4,0x19,0x22,0xd2,0x57,0x18,0xa6,0xd3,0x01,0x17,0xd5,0xa8,
-0x00,0x17,0xfd,0x4f,0x00,0x17,0xf6,0x58,0x3b,0x17,0xf1,0xac,0x10,0x17,0xd0,0xac,
-0x00,0x17,0xa0,0x1e,0x3d,0x17,0x90,0x26,0x02,0x1f,0x80,0x0c,0x00,0x0d,0x0e,0x01,
-0x00,0x0f,0xa5,0x09,0xff,0xbd,0x07,0x73,0xad,0x02,0x95,0x16,0x06,0x35,0x33,0x07,
-0x78,0xad,0x04,0xaf,0x2f,0x16,0xe3,0xd4,0x02,0x25,0xe3,0x5f,0x03,0x03,0x00,0x5d,
-0xa7,0x12,0x04,0x59,0x60,0x07,0x82,0xad,0x1f,0x60,0x44,0x25,0x1c,0x16,0xf1,0x6e,
-0xb6,0x0f,0x0e,0x00,0x98,0x03,0x28,0x16,0x00,0x75,0x91,0x09,0xae,0x75,0x0f,0x0e,
-0x00,0x29,0x0e,0x0a,0x01,0x0f,0x0e,0x00,0xaa,0x0a,0x57,0x15,0x07,0x54,0x15,0x16,
-0x08,0x51,0x15,0x07,0x4e,0x15,0x12,0x0b,0x42,0xe1,0x12,0xe3,0xef,0x02,0x13,0xb1,
-0x48,0x15,0x0f,0x45,0x15,0x0f,0x0f,0x7d,0xe7,0x5a,0x07,0x17,0x00,0x20,0x04,0x9d,
-0xaa,0x41,0x01,0x17,0x00,0x12,0x1b,0x24,0x03,0x00,0x17,0x00,0x13,0x5e,0x03,0x32,
-0x16,0x9f,0x91,0x16,0x17,0x09,0x5b,0x2c,0x11,0x9f,0xf6,0xe1,0x23,0xad,0xff,0x5f,
-0x04,0x13,0xf7,0x4a,0x34,0x00,0x46,0x38,0x03,0x19,0x1b,0x13,0x39,0x73,0x00,0x00,
-0x8f,0x68,0x1e,0x9f,0x15,0x56,0x1f,0x6f,0x94,0xe7,0x9c,0x24,0x50,0x00,0x65,0xe8,
-0x06,0x1b,0x75,0x15,0x9f,0xe7,0x0d,0x12,0x0d,0x35,0x00,0x0f,0x23,0x00,0x20,0x1c,
-0x04,0x27,0x79,0x2c,0xf1,0x4f,0x12,0x00,0x1f,0x14,0x23,0x00,0x0f,0x20,0x10,0x11,
-0xea,0x08,0x11,0x11,0x01,0x00,0x00,0x31,0x34,0x2f,0x41,0x10,0xaf,0x00,0x26,0x12,
-0xfd,0x11,0x04,0x16,0xbf,0x23,0x00,0x0a,0x50,0x46,0x19,0x9f,0x12,0x00,0x0f,0x23,
-0x00,0x28,0x0f,0x3b,0x01,0x2e,0x0f,0x23,0x00,0xaf,0x07,0x18,0x6e,0x1f,0x00,0x0e,
-0x00,0x0a,0x16,0x4f,0x63,0x60,0x0f,0x0e,0x00,0x1a,0x20,0x15,0x55,0xc8,0x03,0x06,
-0xf8,0x86,0x0f,0x70,0x00,0x0e,0x54,0x05,0xbe,0xfe,0xd9,0x40,0x0e,0x00,0x22,0x04,
-0xdf,0xca,0x08,0x02,0x0e,0x00,0x13,0x5f,0xb9,0x8a,0x08,0xff,0xbd,0x1a,0xfa,0x0d,
-0xbe,0x13,0x10,0x0e,0x00,0x23,0xda,0x9a,0xb4,0x1b,0x12,0x0d,0x27,0x4e,0x03,0x22,
-0xd1,0x03,0xf6,0x00,0x29,0x02,0xff,0xad,0x71,0x02,0x57,0x88,0x15,0x0d,0xd2,0x98,
-0x0b,0x0e,0x00,0x1f,0xf1,0x0e,0x00,0xc1,0x10,0x23,0x97,0x08,0x40,0x44,0x43,0x00,
-0x3c,0xe6,0x2f,0x12,0x04,0x97,0x09,0x64,0xfe,0x85,0x6e,0xff,0xf9,0x0e,0x7c,0x37,
-0x14,0x6f,0x1d,0x20,0x50,0xaf,0xff,0xb1,0x04,0xbf,0x44,0x44,0x10,0xcf,0x17,0x7e,
-0x4f,0xad,0xfe,0x81,0x00,0x6d,0xae,0xff,0x3c,0x31,0x02,0xae,0xea,0x3f,0xd9,0x12,
-0x50,0x0d,0xc0,0x31,0x0d,0xff,0xf4,0xd2,0x63,0x27,0xe7,0x5b,0x34,0x6f,0x60,0xb0,
-0x0e,0xff,0xfc,0x56,0xdf,0xbb,0x04,0x13,0x01,0x49,0xdd,0x10,0xf6,0x3b,0x9d,0x00,
-0xb7,0x6f,0x3f,0xb4,0x00,0x00,0x2c,0x74,0xfe,0x06,0x1f,0x37,0x1f,0xf2,0x09,0x00,
-0x08,0x0e,0x80,0x66,0x0f,0xd0,0x02,0xff,0x32,0x04,0x50,0x0d,0x14,0xb7,0xed,0x11,
-0x04,0x11,0x00,0x17,0xb6,0xb3,0x05,0x0f,0x01,0x00,0x0e,0x05,0xda,0x01,0x04,0xd9,
-0x01,0x0f,0x11,0x00,0xb7,0xa3,0x08,0x88,0x86,0x00,0x00,0x00,0x58,0x88,0x80,0x0f,
-0x39,0x78,0x11,0xf0,0x4a,0x25,0x12,0x03,0x84,0xe4,0x30,0xe5,0x11,0x5e,0x47,0x01,
-0x14,0xef,0x61,0xcd,0x14,0x3f,0x4d,0x3f,0x24,0x02,0xcf,0xf0,0x82,0x5f,0x04,0x9c,
-0xdd,0xc9,0x40,0xad,0x02,0xff,0x36,0x11,0xf6,0xf7,0x11,0x13,0xa5,0x9e,0x5e,0x20,
-0xf8,0x1f,0x60,0xe5,0x00,0x2d,0xd7,0x12,0x9f,0xf8,0x1d,0x13,0xc0,0x21,0x35,0x13,
-0xe2,0x55,0x0a,0x11,0xc1,0x16,0x35,0x3f,0xff,0xd9,0x40,0xbe,0x02,0xe5,0x03,0x3a,
-0x01,0x01,0xee,0x40,0x0f,0x0b,0x00,0x98,0x01,0x88,0x15,0x01,0x41,0x7d,0x10,0x3f,
-0x1b,0x3f,0x11,0x0d,0xe3,0x86,0x01,0x1a,0x13,0x32,0x6f,0xff,0xfa,0x1a,0x45,0x31,
-0x58,0x10,0x4f,0x6a,0x03,0x11,0xdf,0xdf,0xcc,0x02,0x35,0xa5,0x20,0x8d,0xff,0xf8,
-0xca,0x00,0x02,0xf5,0x01,0x03,0xf5,0x02,0x67,0x3a,0x02,0x8c,0x3a,0x02,0x72,0x3a,
-0x10,0xdf,0x16,0x00,0x0e,0x08,0xf5,0x05,0x0c,0xf5,0x02,0x4a,0x93,0x0f,0x0b,0x00,
-0x71,0x10,0xbf,0xb5,0x79,0x01,0xf8,0x50,0x01,0xb1,0x52,0x02,0xbb,0x81,0x31,0xef,
-0xff,0xf3,0x2d,0x1c,0x21,0xb4,0x66,0x27,0x2a,0x11,0xc0,0x14,0x2a,0x02,0x58,0xf2,
-0x50,0x00,0x04,0xbe,0xfe,0xb5,0xbe,0x19,0x00,0x36,0x0f,0x10,0x70,0xde,0x19,0x12,
-0x7f,0x16,0x6c,0x10,0xf4,0x0e,0x1a,0x08,0x1e,0x1a,0x04,0xfe,0x42,0x0f,0x04,0x00,
-0x71,0x7f,0xdf,0xff,0xff,0xed,0xff,0xff,0xfe,0x07,0x00,0x41,0x06,0xe1,0x43,0x03,
-0xcd,0x18,0x19,0xd8,0x42,0x18,0x00,0xa9,0x11,0x0f,0x23,0x00,0xff,0x63,0x47,0x07,
-0x77,0x77,0x77,0x1f,0x46,0x15,0xf8,0x0c,0x15,0x10,0x05,0x90,0x43,0x05,0xc8,0x9a,
-0x13,0x40,0x32,0x1a,0x02,0x23,0x00,0x15,0xbf,0x10,0xf4,0x21,0xff,0x68,0x23,0x00,
-0x12,0x06,0xa7,0x1a,0x10,0x3d,0x3c,0x00,0x02,0x23,0x00,0x11,0x1f,0xc6,0x9e,0x10,
-0xdf,0xa1,0x1a,0x0a,0xdb,0x08,0x00,0x98,0x07,0x03,0x8c,0x00,0x15,0xbf,0x64,0x10,
-0x04,0x5a,0x06,0x15,0xaf,0x62,0x72,0x04,0xaf,0x00,0x02,0x31,0x55,0x07,0x83,0xbd,
-0x00,0x31,0x8c,0x12,0xff,0x5e,0x2a,0x11,0x9d,0x64,0x3d,0x32,0x3b,0xee,0xb2,0x5f,
-0x04,0x24,0x00,0x3f,0x5f,0xf9,0x01,0x9f,0x1a,0x24,0x96,0xff,0xfb,0x97,0x01,0xf8,
-0x29,0x03,0xf6,0x3e,0x01,0x73,0x04,0x01,0x5f,0x2e,0x03,0x78,0x04,0x3f,0x4c,0xff,
-0xc3,0xbb,0xc1,0x10,0x12,0xfc,0xbc,0x39,0x24,0x80,0xff,0xd7,0x83,0x1f,0xf8,0x15,
-0x00,0xe9,0x06,0xcb,0x40,0x1a,0x80,0xb5,0xe9,0x09,0x48,0xee,0x04,0xd4,0x86,0x24,
-0x22,0x13,0xb7,0xc2,0x07,0x6e,0xd3,0x15,0x8f,0x75,0x49,0x16,0x08,0x2d,0x64,0x14,
-0x8f,0xb1,0x10,0x01,0x15,0x00,0x03,0xe4,0x8a,0x38,0x14,0x67,0x75,0x2d,0x05,0x08,
-0x66,0x56,0x0d,0xf4,0xb7,0x16,0x0b,0xa2,0xe7,0x03,0xaf,0x28,0x16,0xbf,0xbd,0x21,
-0x00,0x07,0x95,0x15,0x0a,0xfe,0x15,0x02,0x0a,0x95,0x14,0x8f,0xde,0x53,0x11,0x06,
-0x28,0x2f,0x3f,0x05,0x88,0x88,0x07,0x5f,0x1b,0x08,0x62,0x03,0x0f,0x0f,0x00,0xff,
-0x3b,0x07,0x98,0x04,0x17,0xfd,0x1f,0x2f,0x12,0x5f,0xb1,0x1a,0x08,0x93,0x04,0x03,
-0xf7,0x01,0x00,0xe6,0x2e,0x03,0x0c,0x31,0x08,0x8e,0x04,0x04,0x68,0x58,0x25,0xfc,
-0xbd,0xc7,0x2a,0x07,0x89,0x04,0x09,0xe2,0x43,0x03,0x57,0x17,0x06,0x84,0x04,0x05,
-0x5b,0xf0,0x08,0x4d,0x05,0x06,0x7f,0x04,0x03,0x55,0x02,0x03,0x41,0x02,0x14,0x3e,
-0xdd,0x49,0x13,0x4f,0xb8,0x1a,0x00,0x09,0x0b,0x11,0xaf,0x0a,0x00,0x00,0x1f,0x52,
-0x12,0x6f,0xd5,0x04,0x21,0xfe,0x30,0x57,0x68,0x7f,0x4b,0xbb,0xba,0x20,0x00,0x00,
-0x3a,0x04,0x4a,0x0f,0x17,0x7f,0x4b,0x7b,0x2f,0xff,0x40,0x13,0x00,0xdf,0x06,0x8c,
-0x5d,0x05,0xfc,0x37,0x13,0x0e,0xab,0x64,0x35,0x10,0x2b,0xff,0x10,0xe8,0x02,0x7f,
-0x04,0x18,0x0b,0x85,0xac,0x02,0x4b,0x00,0x15,0x0d,0xd3,0x30,0x14,0xef,0xd7,0xa2,
-0x4b,0x02,0x57,0x76,0x40,0xf6,0x1b,0x18,0x8f,0xc3,0x48,0x14,0x04,0x75,0x91,0x14,
-0xf1,0x81,0x86,0x28,0xf8,0x00,0xcd,0xbc,0x14,0xb0,0x0e,0x00,0x01,0xc0,0xd1,0x05,
-0x46,0x00,0x12,0x6f,0x6f,0x06,0x03,0xab,0x49,0x03,0x80,0x00,0x02,0x0e,0x00,0x13,
-0x1e,0xc5,0x21,0x02,0x0e,0x00,0x16,0xbf,0x55,0xfb,0x11,0xf1,0xe0,0x00,0x15,0xfd,
-0x8c,0x00,0x14,0x4f,0x59,0x11,0x00,0x0e,0x00,0x15,0x01,0x60,0xfd,0x00,0x0e,0x00,
-0x15,0x0c,0xbb,0x8f,0x03,0x64,0x07,0x03,0xd2,0x1a,0x00,0x46,0x05,0x06,0x51,0x40,
-0x0a,0x25,0x10,0x19,0xff,0x77,0x68,0x06,0xdd,0x60,0x08,0x0e,0x00,0x1a,0xfa,0xb4,
-0x33,0x15,0x40,0x0e,0x00,0x14,0xaf,0x2b,0x00,0x01,0x26,0x00,0x14,0x08,0x72,0x4e,
-0x02,0x07,0x21,0x13,0xdf,0x2b,0x00,0x02,0x64,0x1e,0x16,0x3f,0x06,0xd8,0x03,0x84,
-0xf0,0x16,0xf9,0x5e,0x01,0x18,0xef,0x0a,0x01,0x22,0x00,0x4f,0x00,0x06,0x07,0x42,
-0x01,0x05,0xdf,0x4a,0x02,0x8b,0x77,0x15,0x30,0x6c,0x01,0x11,0x6f,0x2b,0x00,0x04,
-0x0e,0x00,0x19,0x0b,0x6a,0xc8,0x11,0x02,0x36,0x08,0x08,0x1c,0xa5,0x29,0xff,0xd0,
-0x2b,0xbe,0x02,0xa5,0x7c,0x09,0xd3,0x57,0x19,0x02,0xcf,0x22,0x19,0x02,0xf8,0x5b,
-0x19,0x03,0x00,0x28,0x19,0x05,0x63,0x06,0x0a,0x41,0x21,0x19,0x0d,0xd8,0xa0,0x19,
-0x5f,0x29,0x28,0x19,0xbf,0x0b,0x5f,0x29,0x07,0xef,0x34,0x33,0x1f,0x14,0xf6,0xff,
-0x47,0x0f,0x19,0x00,0x1f,0x10,0x3f,0x31,0x01,0x03,0x19,0x00,0x11,0x2e,0xa1,0x0f,
-0x02,0x19,0x00,0x11,0x0d,0x07,0x05,0x06,0x60,0xff,0x13,0xf5,0x32,0x00,0x25,0x08,
-0xff,0x8d,0x33,0x14,0x60,0x5d,0x48,0x12,0x6f,0xba,0xb1,0x23,0xff,0xfc,0x64,0x00,
-0x11,0x62,0x90,0x4b,0x03,0x19,0x00,0x13,0xcf,0xc1,0x20,0x00,0x19,0x00,0x05,0xc8,
-0x02,0x18,0x6f,0x6a,0xa6,0x17,0xff,0x59,0xdb,0x17,0x6f,0x81,0x05,0x18,0x06,0x89,
-0xda,0x16,0x6f,0xb7,0xa6,0x02,0x19,0x00,0x16,0xef,0xdf,0x1b,0x36,0xff,0xd1,0xaf,
-0x33,0xf7,0x35,0xd1,0x01,0xef,0x2c,0x24,0x14,0xf6,0xda,0xec,0x06,0xc8,0x00,0x17,
-0xd0,0x15,0x46,0x24,0xff,0x70,0x13,0x01,0x11,0x7f,0xa5,0x00,0x03,0x13,0x01,0x01,
-0xeb,0x38,0x03,0x19,0x00,0x02,0x02,0x38,0x03,0x19,0x00,0x01,0xd0,0x0d,0x04,0x45,
-0x01,0x1a,0x1e,0xcb,0xbd,0x05,0x3e,0x02,0x17,0xb0,0xc0,0x06,0x18,0xfb,0x94,0x5e,
-0x17,0xa0,0x2c,0x02,0x18,0xf8,0x54,0x02,0x1f,0x40,0xbe,0x23,0x02,0x1a,0x2f,0x6b,
-0xdc,0x06,0x1f,0x06,0x18,0x6e,0x3a,0x63,0x26,0x08,0xa0,0xb8,0x20,0x14,0xd0,0xcb,
-0xea,0x03,0x95,0x96,0x11,0x08,0xd9,0x06,0x02,0x19,0x00,0x02,0x87,0x04,0x03,0x19,
-0x00,0x02,0x27,0x87,0x02,0x19,0x00,0x11,0x8f,0x07,0x00,0x02,0x19,0x00,0x03,0x4e,
-0x38,0x01,0x12,0x00,0x03,0x66,0x04,0x01,0x19,0x00,0x13,0x07,0xdc,0x01,0x10,0xff,
-0xb1,0x0e,0x03,0x1f,0x1a,0x01,0x19,0x00,0x04,0x82,0xee,0x08,0x08,0x25,0x18,0x0f,
-0x5d,0x04,0x08,0xde,0x6c,0x16,0x0f,0x3b,0x25,0x06,0x32,0x00,0x18,0x60,0xfd,0x4e,
-0x03,0xc8,0x96,0x23,0xe8,0x8a,0x70,0x00,0x01,0x64,0x00,0x04,0xef,0x04,0x01,0x96,
-0x00,0x12,0x2f,0xa2,0x00,0x02,0xaf,0x00,0x15,0x7f,0x42,0x04,0x14,0xd0,0xac,0x3a,
-0x02,0x19,0x00,0x03,0x74,0x05,0x06,0x92,0x63,0x01,0x1d,0x4e,0x15,0xfd,0xea,0xeb,
-0x06,0x7c,0xc3,0x01,0xa2,0x74,0x14,0xfd,0x0d,0xb4,0x12,0xf2,0xf1,0xd1,0x1d,0x10,
-0x22,0xb2,0x17,0x01,0xec,0x01,0x16,0xbf,0x9a,0x22,0x16,0x5f,0x77,0x35,0x19,0x1e,
-0x8c,0x1f,0x16,0xf4,0x0f,0x02,0x1f,0xf6,0x70,0x22,0x16,0x0f,0x32,0xcd,0x4e,0x0f,
-0x17,0x00,0xc7,0x04,0x24,0x39,0x17,0x0f,0x06,0xd9,0x07,0xa8,0x1e,0x0f,0x17,0x00,
-0x10,0x05,0x51,0xec,0x03,0xb2,0x28,0x02,0x4c,0x63,0x12,0x01,0x29,0x0a,0x03,0x5e,
-0xf6,0x12,0x5f,0x05,0x02,0x11,0xef,0xe8,0x09,0x1c,0x09,0xcf,0x64,0x06,0x1f,0x0e,
-0x0f,0x07,0x00,0xe3,0x0f,0xc9,0x02,0xff,0x77,0x0e,0xa9,0x6d,0x0e,0x5d,0x3e,0x17,
-0x05,0x7e,0x29,0x07,0x8e,0x06,0x19,0x07,0x4d,0xa4,0x16,0xf2,0x06,0x31,0x17,0xfd,
-0xc8,0x06,0x16,0x70,0xae,0x06,0x16,0xe0,0x39,0x00,0x16,0xf6,0x2d,0x2a,0x16,0x99,
-0x0d,0x03,0x0f,0x04,0x00,0x79,0x17,0x00,0x05,0x41,0x03,0x04,0x00,0xa1,0xc0,0x02,
-0xff,0xff,0xa0,0x05,0xff,0xff,0x70,0x0a,0x9a,0xb9,0x70,0xfb,0x00,0x8f,0xff,0xf3,
-0x00,0x5d,0xc7,0x06,0x14,0x7c,0xa6,0x01,0x01,0xe0,0x15,0x03,0xa6,0x01,0x37,0xbf,
-0xff,0xf4,0x17,0x00,0x14,0x30,0x17,0x00,0x01,0x07,0x37,0x02,0x17,0x00,0x01,0x62,
-0x48,0x02,0x17,0x00,0x02,0x73,0x48,0x13,0xff,0x82,0xaa,0x14,0xf2,0x17,0x00,0x16,
-0x2f,0x12,0x0b,0x45,0x01,0x9f,0xfe,0x10,0x02,0x02,0x2f,0x2b,0x30,0xd1,0x02,0xff,
-0x05,0x01,0xbb,0x01,0x12,0x09,0x88,0x0d,0x10,0xc0,0x0a,0x48,0x01,0x11,0x00,0x12,
-0x0a,0x19,0x56,0x00,0x8f,0x17,0x11,0xf2,0x11,0x00,0x12,0x0e,0xe7,0x56,0x00,0xd2,
-0x01,0x11,0x90,0x11,0x00,0x42,0x9f,0xff,0xf3,0x00,0xae,0xba,0x11,0xfa,0x8b,0x02,
-0x42,0x01,0x8f,0xff,0x20,0xc2,0x17,0x24,0x2a,0x40,0xb4,0x04,0x06,0xfd,0xfe,0x0f,
-0x11,0x00,0xb9,0x0f,0x01,0x02,0x71,0x34,0x07,0xdf,0xc5,0x17,0x00,0x02,0x10,0x09,
-0x02,0x17,0x00,0x02,0x24,0x0a,0x01,0x17,0x00,0x02,0xe5,0x2c,0x02,0x17,0x00,0x15,
-0xdf,0x2c,0x03,0x00,0x8d,0x13,0x14,0xc0,0x17,0x00,0x3f,0x01,0x56,0x40,0xb9,0x02,
-0xad,0x0f,0x0f,0x02,0x65,0x21,0x46,0x40,0x11,0x00,0x00,0x7c,0x60,0x04,0xdc,0x79,
-0x13,0xa0,0xa1,0xb0,0x23,0xfe,0x0f,0xe7,0x2e,0x10,0xd0,0x11,0x00,0x41,0x07,0xff,
-0xff,0xf7,0x11,0x00,0x00,0xe0,0x60,0x0f,0xb9,0x02,0x6c,0x28,0x00,0x02,0x69,0x32,
-0x0f,0x0d,0x00,0x75,0x17,0x03,0xa6,0x90,0x28,0x6a,0xfe,0xc2,0x70,0x1e,0xfe,0x0d,
-0x00,0x21,0x03,0x8d,0x0d,0x00,0x16,0xe8,0xb1,0xe2,0x27,0xfc,0x72,0xbe,0xe2,0x04,
-0x5b,0x00,0x09,0x0d,0x00,0x2f,0x4a,0x53,0xdd,0x00,0x65,0x03,0xe5,0x02,0x18,0xb8,
-0x46,0x34,0x1f,0xfc,0x0d,0x00,0x22,0x03,0x37,0xb1,0x0f,0x07,0x00,0x46,0x11,0x04,
-0x07,0x00,0x13,0xba,0x7b,0xa4,0x04,0x07,0x00,0x21,0x04,0xaf,0x6d,0x01,0x01,0x2b,
-0x29,0x12,0xc4,0x32,0x29,0x14,0x90,0x07,0x00,0x2f,0x39,0x33,0x93,0x00,0x4c,0x05,
-0x07,0x00,0x0e,0x9f,0x6e,0x02,0xda,0xb7,0x1e,0x20,0xa7,0x94,0x04,0xd7,0x10,0x18,
-0x40,0x7c,0xd0,0x19,0xf6,0xc4,0x18,0x18,0x70,0x34,0x10,0x19,0xf9,0x8b,0x3a,0x1f,
-0xb0,0xd7,0xd2,0xff,0xee,0x02,0xe1,0x14,0x16,0xfb,0x64,0x02,0x1e,0xfd,0xb2,0xc2,
-0x16,0x05,0xa4,0x73,0x17,0x01,0xdb,0x64,0x16,0xaf,0xd0,0x47,0x1e,0x4f,0x91,0x6e,
-0x0f,0x99,0x98,0xff,0x30,0x0f,0x7a,0x03,0xff,0xd0,0x0f,0x01,0x00,0x08,0x19,0x07,
-0x27,0x18,0x19,0x07,0xdc,0x78,0x08,0x54,0x0f,0x0c,0xaf,0x39,0x19,0x0b,0x92,0xf2,
-0x19,0x0f,0x6a,0x00,0x19,0x6f,0x3b,0x14,0x19,0xdf,0xb1,0xd6,0x1a,0x8f,0x3c,0xf9,
-0x1f,0xa8,0x48,0x9c,0xff,0x22,0x0f,0xe4,0x21,0x09,0x07,0x50,0x07,0x16,0xe0,0x17,
-0x00,0x17,0xfd,0x3b,0x09,0x05,0x8b,0x07,0x07,0xca,0x63,0x17,0x09,0x1f,0x1a,0x16,
-0xef,0x1c,0x18,0x16,0x7f,0xe8,0x3f,0x27,0x04,0xdf,0x40,0x42,0x24,0x6c,0x10,0x22,
-0x02,0x01,0x9d,0x1a,0x11,0x06,0x32,0xd3,0x04,0xf6,0x07,0x02,0x57,0x68,0x03,0x66,
-0x68,0x14,0x09,0x5c,0x04,0x00,0x72,0x08,0x17,0xf9,0x83,0xd3,0x19,0x3f,0xb0,0x6a,
-0x04,0x6b,0x1c,0x06,0x1d,0x00,0x19,0xf4,0x62,0x3c,0x1f,0x30,0x3f,0x08,0xff,0xec,
-0x02,0xf3,0x68,0x16,0x9f,0x1c,0xa6,0x15,0x9f,0x09,0x94,0x14,0x90,0xbf,0x72,0x01,
-0xb0,0x6a,0x03,0xf0,0x20,0x1b,0x2d,0xb0,0x6a,0x1e,0x10,0xb0,0x6a,0x0f,0xd8,0xa0,
-0xff,0x39,0x19,0xcf,0x48,0x31,0x0a,0x0e,0x00,0x19,0xdf,0x78,0xe6,0x18,0xef,0xe5,
-0x15,0x1c,0x01,0x27,0x50,0x09,0x20,0xc1,0x0f,0xa1,0x1e,0x07,0x1a,0x18,0xbc,0x1c,
-0x2c,0x29,0x10,0xff,0x2e,0x61,0xfd,0x00,0x04,0x9d,0xef,0xec,0x92,0x04,0x08,0xbc,
-0x01,0x02,0x0e,0x00,0x15,0x4f,0xf8,0x62,0x19,0x08,0x34,0x36,0x19,0x08,0x5f,0xc4,
-0x08,0xc6,0x01,0x02,0x0e,0x00,0x02,0x09,0xd3,0x04,0xe5,0xbe,0x15,0x90,0x1a,0x0d,
-0x17,0x08,0x63,0x3a,0x06,0x0e,0x00,0x02,0xa8,0x05,0x0f,0x0e,0x00,0xcb,0x06,0xc0,
-0x05,0x13,0x4f,0x72,0x05,0x09,0x0e,0x00,0x29,0xff,0x80,0x0e,0x00,0x19,0xf2,0x0e,
-0x00,0x19,0xfb,0x0e,0x00,0x29,0xff,0x50,0x0e,0x00,0x19,0xe0,0x0e,0x00,0x19,0xf8,
-0x0e,0x00,0x29,0xff,0x20,0x0e,0x00,0x19,0xb0,0x0e,0x00,0x16,0xf5,0x0e,0x00,0x15,
-0xfc,0xa7,0x67,0x10,0xfc,0xef,0x05,0x14,0xff,0x31,0x29,0x13,0xfc,0x79,0x22,0x16,
-0xf2,0x0e,0x00,0x02,0xe8,0xfa,0x04,0x0e,0x00,0x14,0x05,0x53,0x7e,0x02,0x84,0x04,
-0x10,0xbf,0x8f,0x00,0x05,0x0e,0x00,0x00,0xe2,0xa5,0x06,0x0e,0x00,0x13,0x08,0xae,
-0x7e,0x03,0xae,0x04,0x00,0xb4,0x81,0x06,0x0e,0x00,0x00,0x24,0x47,0x05,0x0e,0x00,
-0x00,0x9d,0x05,0x25,0xfd,0x5f,0x0e,0x00,0x13,0x02,0xcd,0x40,0x15,0xff,0xde,0xc1,
-0x07,0xf4,0x04,0x19,0x0e,0x0e,0x00,0x1f,0x05,0x72,0x05,0x09,0x1f,0x2f,0x72,0x05,
-0x08,0x1a,0x00,0x72,0x05,0x1f,0x5f,0x72,0x05,0x08,0x1a,0x03,0x72,0x05,0x19,0x9f,
-0x37,0x0a,0x19,0x4f,0x69,0x7e,0x03,0x34,0x8f,0x0e,0x4e,0x45,0x04,0x88,0x81,0x03,
-0xb2,0x07,0x3a,0x54,0x5c,0xff,0xba,0xb1,0x06,0xbe,0x11,0x18,0x08,0x4b,0x8d,0x02,
-0xb5,0x00,0x19,0xfb,0xfb,0x7a,0x08,0x68,0x43,0x07,0xb1,0x43,0x44,0x02,0x56,0x77,
-0x52,0x32,0x5d,0x10,0x17,0x95,0x66,0x02,0xcd,0xb6,0x12,0x7f,0xb7,0x44,0x12,0x7f,
-0x69,0x45,0x04,0x96,0x93,0x13,0x9f,0x1b,0x27,0x16,0x7f,0x99,0x05,0x11,0x07,0x6a,
-0x00,0x01,0xd3,0x03,0x22,0xe0,0x7f,0x10,0x02,0x00,0x87,0x06,0x13,0x27,0xf1,0x07,
-0x00,0x86,0x07,0x03,0xa0,0x9d,0x00,0x2a,0x00,0x16,0x67,0x9c,0x6a,0x13,0xf7,0x17,
-0x00,0x00,0x28,0x07,0x16,0x87,0x17,0x00,0x1f,0xf8,0x17,0x00,0x8e,0x1d,0x00,0xe2,
-0x2a,0x08,0x17,0x00,0x17,0x06,0xe6,0x70,0x05,0x80,0xb5,0x38,0x22,0x12,0x9f,0xf0,
-0xcb,0x04,0xa2,0x05,0x16,0x8f,0x4d,0xdd,0x17,0x09,0x4a,0xfe,0x01,0x23,0xaa,0x06,
-0xac,0x01,0x14,0xc4,0x5c,0x4c,0x3a,0x77,0x65,0x10,0x39,0xf7,0x1f,0xb0,0x0f,0x00,
-0x19,0x0a,0x3a,0x83,0x0f,0xf2,0xda,0xff,0xff,0x21,0x17,0x8f,0x48,0x02,0x18,0x08,
-0x21,0x28,0x08,0x19,0x00,0x04,0x5f,0x46,0x0e,0xa2,0xcb,0x0f,0xc9,0xa5,0xff,0x59,
-0x38,0x7f,0xff,0xf5,0x5f,0x26,0x01,0xe5,0x1f,0x06,0x1a,0x2f,0x10,0x1f,0x0a,0x00,
-0x15,0x6f,0x99,0x0e,0x12,0x09,0x89,0x03,0x1a,0xfb,0xb0,0x92,0x19,0xd1,0x0e,0x8e,
-0x07,0x08,0xf9,0x5f,0x39,0xce,0xff,0xd9,0x30,0x3d,0x04,0xff,0xff,0x23,0x11,0xf4,
-0x93,0x02,0x15,0x90,0x58,0x7f,0x02,0xcc,0x60,0x00,0x8e,0x02,0x33,0x82,0x02,0x8f,
-0xa0,0x16,0x18,0x9f,0xaa,0x06,0x27,0xcf,0xff,0x6e,0x60,0x18,0x9f,0xed,0x8b,0x5f,
-0x17,0xbd,0xed,0xb7,0x20,0x56,0x04,0xff,0x5f,0x01,0xf8,0x00,0x00,0x9f,0xa4,0x04,
-0x49,0x04,0x12,0x2f,0x6d,0x7c,0x15,0xfa,0x39,0x04,0x38,0xfd,0x00,0x0d,0x4e,0xbe,
-0x11,0xf2,0x57,0x79,0x05,0xd4,0x1a,0x00,0x7c,0x4d,0x15,0xe2,0xa8,0x48,0x35,0xf9,
-0x00,0x2f,0x83,0x04,0x01,0x2e,0x3a,0x16,0xdf,0x9b,0x12,0x25,0x11,0x11,0xb9,0x7d,
-0x0f,0x19,0xe6,0xff,0xff,0x0f,0x01,0x4a,0x22,0x03,0x93,0x02,0x01,0xf2,0xea,0x04,
-0x1e,0x6a,0x00,0xc9,0xd6,0x03,0xac,0xbe,0x00,0xcc,0x87,0x22,0x10,0x0b,0x2a,0x0d,
-0x00,0x70,0x04,0x13,0x40,0x7a,0xe3,0x00,0x4a,0x03,0x23,0x80,0x03,0xcb,0x00,0x12,
-0x04,0x1b,0x21,0x24,0xf4,0x00,0x36,0x80,0x03,0x41,0x80,0x0f,0x56,0x04,0xff,0x4f,
-0x3b,0x04,0x8b,0xef,0x4b,0xc4,0x05,0x14,0x81,0x09,0x15,0x00,0x2e,0x05,0xef,0x75,
-0xc4,0x08,0x21,0x91,0x05,0x15,0x00,0x2e,0x07,0xff,0x15,0x00,0x02,0x02,0x20,0x47,
-0xb9,0x88,0x88,0x9f,0x47,0x66,0x23,0x00,0xef,0x3b,0x01,0x17,0x0e,0xc4,0x90,0x05,
-0xca,0x63,0x08,0x15,0x00,0x14,0x0d,0x46,0x17,0x08,0x15,0x00,0x18,0x3f,0x67,0x78,
-0x1c,0x20,0x5c,0x31,0x08,0x15,0x00,0x05,0x96,0x4d,0x08,0x15,0x00,0x02,0x2d,0x48,
-0x0e,0x15,0x00,0x17,0xf0,0xef,0x92,0x02,0x63,0x0b,0x1f,0xcf,0x15,0x00,0x4d,0x04,
-0xfc,0x66,0x09,0x15,0x00,0x0e,0x93,0x00,0x0e,0xbd,0x00,0x0e,0xe7,0x00,0x0f,0x11,
-0x01,0x13,0x0e,0x3b,0x01,0x0e,0x65,0x01,0x0f,0x8f,0x01,0x08,0x0e,0xb9,0x01,0x05,
-0x5b,0x37,0x47,0xa8,0x77,0x88,0x8f,0x0a,0xfc,0x0e,0x0d,0x02,0x01,0x20,0x36,0x1e,
-0x7f,0x15,0x00,0x02,0x38,0x53,0x0d,0x15,0x00,0x0e,0x8b,0x02,0x1f,0xff,0xb5,0x02,
-0x01,0x13,0xff,0xc6,0xc6,0x01,0x89,0x06,0x67,0x03,0x8c,0xef,0xfd,0xb7,0x20,0x20,
-0x38,0x46,0xfb,0x20,0x00,0x2b,0x00,0x03,0x14,0x0a,0xe8,0x30,0x13,0x5f,0x1e,0xc7,
-0x08,0x44,0x79,0x16,0xbf,0x2b,0x31,0x1d,0x09,0x8f,0x00,0x12,0xc0,0x54,0x18,0x23,
-0xb8,0x9c,0xff,0x45,0x03,0x0c,0x67,0x11,0xcf,0x35,0xba,0x23,0x04,0xef,0x6e,0x03,
-0x13,0x6f,0xb1,0x03,0x13,0xfe,0xf4,0x7b,0x04,0x9f,0x4c,0x13,0xf0,0xff,0x9f,0x01,
-0x54,0x10,0x13,0xfb,0x0c,0x04,0x13,0x40,0x07,0xa0,0x05,0x63,0x91,0x00,0x03,0xc4,
-0x04,0x9f,0xb9,0x01,0x33,0x18,0x40,0xaa,0xaa,0xaa,0xab,0x39,0x00,0x07,0xa3,0x25,
-0x05,0xfc,0x11,0x08,0xaf,0x25,0x05,0xe6,0x15,0x04,0x7a,0x10,0x0f,0x29,0x00,0x0e,
-0x04,0x4f,0x96,0x08,0xf9,0xad,0x04,0x22,0x93,0x01,0x55,0x93,0x0c,0x0c,0x5b,0x17,
-0xaf,0x50,0x94,0x13,0x03,0x50,0x32,0x18,0x3f,0x19,0x0a,0x12,0x0c,0x31,0x0a,0x15,
-0x3e,0x09,0x82,0x13,0x28,0x5f,0xe4,0x33,0xfa,0x88,0xbf,0xfa,0x02,0x21,0x87,0x8a,
-0x38,0x1d,0x1d,0x9f,0x5d,0x01,0x16,0x40,0xab,0x9f,0x18,0xfb,0x4e,0x59,0x13,0xaf,
-0xcf,0x7b,0x05,0xaa,0x77,0x15,0x60,0x79,0x3e,0x14,0xb3,0xae,0x06,0x24,0xe8,0x10,
-0x30,0xba,0x20,0xc7,0x30,0xa7,0x72,0x56,0xbd,0xef,0xed,0xb7,0x40,0x82,0xb6,0x2e,
-0x55,0x53,0x05,0x24,0x04,0xaf,0x00,0x1e,0x30,0x04,0x24,0x03,0x59,0x07,0x1e,0x60,
-0x03,0x24,0x03,0xe7,0x02,0x1f,0x90,0x02,0x24,0x1e,0x06,0x66,0x7e,0x06,0x96,0x01,
-0x19,0xc4,0x8f,0x01,0x19,0xfa,0xb1,0x01,0x19,0xfc,0xaa,0x01,0x13,0xfa,0x72,0x82,
-0x22,0xbb,0xce,0x4f,0x02,0x04,0x64,0x81,0x10,0xcf,0x23,0x06,0x05,0x25,0x29,0x00,
-0x0e,0x00,0x09,0x84,0x37,0x15,0xf2,0x1b,0x00,0x18,0x0d,0xb5,0x81,0x01,0xfb,0xc8,
-0x05,0x1b,0x00,0x19,0x0b,0x1b,0x00,0x18,0xef,0x36,0x00,0x18,0x4f,0x51,0x00,0x17,
-0x2e,0x6c,0x00,0x24,0x03,0x8f,0x87,0x00,0x06,0xe8,0x5a,0x19,0x0f,0x22,0x83,0x09,
-0x02,0x5b,0x0e,0xf3,0x00,0x05,0x01,0x17,0x02,0xd8,0x00,0x35,0xbc,0xff,0xff,0xe8,
-0xe6,0x02,0x55,0x04,0x15,0x90,0xfd,0x29,0x12,0x6f,0x63,0x04,0x03,0x22,0x00,0x15,
-0xdf,0x29,0x01,0x03,0x57,0xb3,0x05,0xd5,0x39,0x01,0xe4,0x00,0x15,0xb0,0x33,0x2a,
-0x19,0x4f,0xae,0x38,0x00,0x67,0x40,0x05,0x1b,0x00,0x11,0x04,0x21,0x07,0x08,0xbb,
-0x38,0x15,0xc0,0xf3,0x00,0x01,0xe5,0xb1,0x08,0x29,0x01,0x15,0xfd,0x1b,0x00,0x05,
-0x13,0xb1,0x13,0x5f,0x79,0x1b,0x02,0xec,0xc1,0x06,0x00,0x54,0x14,0x03,0x41,0x02,
-0x13,0xdf,0xf8,0x07,0x03,0xfd,0xe9,0x01,0xa8,0x0b,0x0f,0x5f,0xc9,0x09,0x10,0x6f,
-0xf6,0x5a,0x42,0x8d,0xff,0xf0,0x06,0x90,0x52,0x14,0xfe,0x86,0x18,0x24,0xe0,0x06,
-0x3e,0x07,0x03,0x6a,0x37,0x0b,0x11,0x00,0x44,0xec,0xbb,0xb0,0x06,0x39,0x49,0x04,
-0x31,0xca,0x05,0x50,0x38,0x04,0xf8,0x05,0x0f,0x11,0x00,0x6d,0x0f,0xfd,0x02,0xff,
-0xbd,0x0f,0x01,0x00,0x08,0x18,0x1f,0xdc,0x1c,0x19,0x01,0xd0,0x3b,0x07,0x6c,0x85,
-0x0c,0xcf,0x3b,0x09,0x04,0x1d,0x19,0x0a,0x13,0xea,0x09,0x5c,0x05,0x18,0x8f,0xad,
-0x8a,0x29,0x05,0xdf,0x6a,0x4d,0x18,0x7c,0xc4,0x05,0x44,0x00,0x18,0xdf,0xff,0x4a,
-0x03,0x00,0x08,0x00,0x13,0x5f,0x08,0x00,0x1f,0xff,0x08,0x00,0x05,0x34,0xfe,0xcb,
-0xbb,0x47,0x03,0x04,0x9f,0x9b,0x04,0xbe,0x02,0x0f,0x08,0x00,0x6d,0x0f,0x30,0x34,
-0x06,0x39,0x5f,0xff,0xf9,0x29,0x34,0x04,0x81,0x5e,0x00,0x62,0x31,0x02,0xcb,0x02,
-0x18,0xe0,0x1b,0x34,0x04,0x77,0x1e,0x05,0x14,0x34,0x13,0x19,0xc3,0x06,0x11,0x78,
-0xb1,0x4d,0x12,0x68,0xe8,0x5b,0x0a,0xe7,0x22,0x00,0xd8,0x22,0x06,0x34,0x97,0x0a,
-0xe6,0x22,0x19,0x03,0x31,0xa7,0x0a,0xe5,0x22,0x05,0x07,0x05,0x0e,0xe4,0x22,0x0f,
-0x21,0x07,0xff,0xd1,0x14,0x2e,0x0c,0xad,0x23,0x80,0x2e,0xdd,0xf0,0x32,0x70,0x00,
-0x1d,0x46,0xef,0x11,0x60,0xbe,0x11,0x03,0x1d,0x07,0x15,0x1c,0x34,0x02,0x15,0x0c,
-0xce,0x43,0x3f,0x09,0xbb,0xbb,0x56,0x14,0x0e,0x04,0x2c,0x07,0x15,0x00,0x2d,0x07,
-0x05,0x2e,0x07,0x15,0x00,0x1e,0x07,0x05,0x30,0x07,0x0b,0x13,0x00,0x00,0x32,0x07,
-0x15,0x00,0x33,0x07,0x06,0x65,0xd1,0x06,0x6f,0x03,0x05,0x2e,0x0d,0x0f,0x13,0x00,
-0x7c,0x0e,0x70,0xb1,0x09,0x71,0xb1,0x0a,0x72,0xb1,0x09,0x73,0xb1,0x09,0x74,0xb1,
-0x09,0x75,0xb1,0x0a,0x76,0xb1,0x0f,0x77,0xb1,0x0f,0x03,0x3c,0x10,0x25,0xac,0xef,
-0xef,0x13,0x03,0x51,0x63,0x02,0xca,0x69,0x16,0x0a,0x8c,0xe3,0x06,0x2d,0xe2,0x01,
-0x7c,0x00,0x18,0x0c,0x42,0x0d,0x21,0x06,0xff,0xd5,0x0c,0x03,0x5e,0x6e,0x02,0x1f,
-0x94,0x02,0x10,0x62,0x01,0x88,0x0c,0x13,0x50,0x49,0x02,0x28,0xf6,0x04,0xf7,0x7f,
-0x15,0x90,0xae,0x1f,0x00,0xa9,0x1f,0x14,0x03,0x87,0x0c,0x01,0x20,0x3c,0x19,0x0f,
-0x51,0xa0,0x00,0x58,0x0c,0x19,0xc3,0x06,0xa3,0x29,0xfc,0x61,0xb2,0xa2,0x29,0xfc,
-0x61,0xeb,0x89,0x29,0xfb,0x40,0xcf,0x65,0x12,0xd4,0x1d,0x00,0x00,0xe6,0x1f,0x06,
-0x77,0x19,0x03,0x30,0xd6,0x14,0xfd,0x5f,0x9c,0x13,0xaf,0x21,0xaf,0x03,0x0f,0x00,
-0x19,0xbf,0x6f,0x1b,0x19,0x3d,0x7f,0x55,0x00,0x08,0x01,0x15,0x75,0x0b,0x1e,0x12,
-0x7f,0xf2,0x74,0x0a,0x41,0xe8,0x15,0xf2,0xd8,0x00,0x14,0x0c,0xe3,0x0d,0x10,0x0c,
-0x4b,0x04,0x13,0x6f,0x8f,0x00,0x11,0x2b,0xd7,0x23,0x10,0xcf,0xc6,0x02,0x21,0xba,
-0x9a,0xcf,0x0e,0x07,0x6a,0xea,0x00,0x20,0x02,0x07,0x0e,0x00,0x17,0x90,0xc0,0x13,
-0x02,0x2a,0x02,0x28,0x3a,0xff,0x34,0xe8,0x7e,0x01,0x59,0xce,0xff,0xfe,0xc9,0x61,
-0xe9,0x20,0x01,0x74,0x01,0x1d,0xc0,0x83,0xb8,0x15,0x7f,0x2f,0x02,0x07,0x82,0xb8,
-0x16,0x0b,0xc5,0x28,0x07,0x81,0xb8,0x1f,0x35,0x1e,0xba,0x09,0x00,0x0a,0x0e,0x23,
-0xbe,0xff,0x42,0xd8,0x14,0x2c,0x99,0xe2,0x05,0x4e,0x42,0x17,0xe3,0x6b,0x93,0x34,
-0x30,0x01,0xef,0x38,0x77,0x21,0xd0,0x07,0x9f,0x79,0x10,0x05,0x58,0x04,0x12,0x0b,
-0x99,0x12,0x12,0x6f,0x68,0xe9,0x16,0xfa,0x8a,0x63,0x01,0x3f,0x82,0x46,0x22,0x22,
-0x21,0x0a,0xa9,0x1f,0x11,0x03,0xe5,0x24,0x26,0x63,0x00,0xd2,0x18,0x25,0xfa,0x50,
-0x40,0x82,0x02,0x40,0x0e,0x16,0x4d,0x60,0x0e,0x27,0x00,0x4a,0xf9,0x70,0x36,0x02,
-0x6a,0xef,0xf4,0xbd,0x10,0x05,0x4d,0x05,0x42,0x57,0x77,0x77,0x50,0xed,0x0b,0x22,
-0xfd,0x9f,0x77,0x02,0x00,0x8b,0x00,0x03,0xa3,0x03,0x13,0x0e,0xa1,0x8f,0x44,0x81,
-0x00,0x02,0xbf,0x8b,0x21,0x12,0xfd,0x8d,0x13,0x16,0xaf,0xa1,0x01,0x17,0x09,0x95,
-0x88,0x02,0x79,0x00,0x02,0xb5,0xf8,0x26,0x38,0xce,0x7a,0x8c,0x00,0xe6,0x00,0x1e,
-0xa0,0x0a,0xf3,0x05,0x9a,0x20,0x16,0xc1,0xa0,0x0f,0x15,0xda,0xd1,0x03,0x00,0x4b,
-0x76,0x14,0x07,0xa3,0x01,0x10,0x2d,0x41,0x00,0x13,0x05,0xf0,0x13,0x11,0x05,0xc0,
-0x2a,0x0e,0x57,0x76,0x0f,0xde,0x03,0xff,0xd9,0x06,0xc4,0xba,0x07,0x09,0xec,0x15,
-0x5f,0x41,0x2a,0x11,0x07,0x5a,0xa4,0x23,0xe3,0x00,0x16,0x9d,0x14,0x5f,0xda,0xa8,
-0x13,0xd2,0x54,0x63,0x11,0x49,0x1a,0x9d,0x1e,0x39,0x20,0x9d,0x0f,0xde,0x03,0xff,
-0x22,0x0f,0x57,0x03,0xff,0xac,0x00,0xb6,0x64,0x06,0x35,0x07,0x19,0x07,0x97,0x0e,
-0x09,0xfb,0xcc,0x29,0x09,0xbe,0xce,0x9e,0x19,0x0d,0x7e,0xa9,0x18,0xbf,0xac,0xb1,
-0x17,0x5f,0x17,0x42,0x03,0x37,0x6a,0x0e,0x26,0xda,0x02,0x38,0x87,0x16,0x20,0x46,
-0x0f,0x2f,0xec,0x94,0x70,0x03,0x54,0x17,0x22,0x70,0x03,0x17,0x04,0x70,0x03,0x16,
-0xaf,0x70,0x03,0x17,0x0a,0x70,0x03,0x17,0x5e,0x70,0x03,0x17,0x5b,0xfc,0x26,0x26,
-0x04,0x7b,0x60,0x27,0x01,0xaf,0x02,0x5e,0xfa,0x46,0x66,0x66,0x40,0x70,0x03,0x03,
-0xfe,0x31,0x13,0x0d,0x97,0xf3,0x11,0x70,0x90,0x01,0x02,0x70,0x03,0x24,0xdc,0xdf,
-0x72,0xb7,0x0f,0x70,0x03,0x0e,0x34,0xcf,0xff,0xff,0x70,0x03,0x16,0x3f,0x19,0x32,
-0x16,0x6f,0x29,0x9a,0x16,0xaf,0x4f,0x0b,0x10,0x23,0x58,0x29,0x06,0x07,0x0b,0x1e,
-0xf2,0x12,0x0b,0x15,0x5f,0x38,0x2a,0x16,0x0f,0x8d,0x07,0x16,0x0f,0x9d,0x01,0x16,
-0x0f,0x7f,0x8a,0x38,0x0d,0xdb,0x83,0x67,0x48,0x13,0x1d,0x45,0x00,0x01,0x28,0x09,
-0x05,0x9c,0xfa,0x00,0x53,0xf1,0x06,0x85,0xdd,0x11,0x1d,0x95,0x01,0x16,0xf6,0x71,
-0x3a,0x07,0xd5,0x74,0x19,0x2e,0x16,0xf0,0x19,0x3f,0xcc,0x25,0x3f,0x5d,0xee,0xea,
-0xc7,0x07,0x16,0x19,0x84,0x70,0x04,0x29,0xfe,0x70,0x70,0x04,0x19,0xe4,0x70,0x04,
-0x19,0xf5,0x70,0x04,0x14,0xf3,0x70,0x04,0x12,0xbe,0xe0,0x2a,0x03,0x70,0x04,0x01,
-0x4e,0x0f,0x14,0x40,0x70,0x04,0x00,0x5d,0x03,0x15,0xf9,0x70,0x04,0x01,0xb9,0xe0,
-0x05,0x70,0x04,0x59,0x16,0x66,0x66,0x64,0x03,0x7c,0xac,0x0f,0x70,0x04,0x81,0x4f,
-0x14,0x44,0x44,0x42,0x70,0x04,0x04,0x00,0x85,0x03,0x06,0x26,0xf5,0x05,0xc4,0x02,
-0x00,0x70,0x04,0x14,0x0b,0x4d,0x07,0x01,0x70,0x04,0x13,0x4f,0x1b,0x1f,0x02,0x70,
-0x04,0x01,0x6a,0x01,0x04,0x70,0x04,0x08,0x03,0xe3,0x18,0x60,0x0e,0x00,0x18,0x90,
-0xc6,0x67,0x16,0x70,0x37,0x9c,0x05,0xd9,0xf3,0x06,0xc7,0x07,0x02,0x17,0xd9,0x01,
-0x28,0x3a,0x13,0x04,0xed,0xb0,0x13,0xf4,0xd5,0xfc,0x33,0xaf,0xff,0xfe,0x2e,0xb1,
-0x14,0xfd,0x02,0x0a,0x16,0x2e,0xf2,0x00,0x26,0x02,0xef,0x33,0x0a,0x3e,0x1b,0xbb,
-0xb9,0xff,0x09,0x0f,0xc7,0x07,0xff,0x1f,0x19,0x1f,0xad,0x1a,0x19,0xb1,0x0e,0x00,
-0x1f,0xfb,0x1d,0x00,0x18,0x11,0xb0,0x19,0x1d,0x00,0x23,0x70,0x02,0xe7,0x3f,0x04,
-0x4b,0x02,0x07,0x1a,0x18,0x08,0x36,0xe2,0x0f,0x1d,0x00,0xff,0x69,0x02,0x42,0x5e,
-0x08,0x95,0x7a,0x19,0xd8,0x86,0x52,0x09,0x1b,0x3a,0x1a,0x3b,0x20,0x17,0x19,0x2f,
-0x7e,0x3a,0x19,0x05,0x17,0x08,0x19,0x59,0xc3,0xa2,0x03,0x01,0x51,0x07,0xbb,0x11,
-0x18,0xe2,0x9b,0x3a,0x09,0x93,0x68,0x16,0x47,0x63,0x0f,0x13,0x88,0x0c,0x59,0x04,
-0x3f,0x22,0x14,0x01,0x1d,0x03,0x0f,0x11,0x00,0x0d,0x04,0xe8,0x05,0x04,0x6d,0x1d,
-0x1f,0xf0,0x11,0x00,0x07,0x0e,0x55,0x00,0x0f,0x11,0x00,0x4b,0x08,0xa5,0x1e,0x14,
-0xf2,0x74,0x20,0x33,0xfb,0xab,0x30,0x78,0x08,0x14,0xf5,0x10,0x06,0x13,0x50,0x4d,
-0x56,0x17,0xf5,0x16,0x87,0x00,0xbb,0x07,0x22,0xfc,0x92,0xd4,0x10,0x15,0xfa,0xdc,
-0x01,0x01,0x84,0x01,0x14,0x9b,0x67,0x05,0x14,0x01,0x77,0xe5,0x13,0x0c,0xfd,0x07,
-0x13,0x06,0xe7,0x05,0x13,0x4f,0x96,0x05,0x05,0x1c,0xf3,0x13,0x3f,0x3e,0x05,0x42,
-0x02,0xfe,0xc9,0x30,0x09,0x73,0x86,0x88,0x84,0x00,0x00,0x01,0x78,0x88,0x87,0x88,
-0x27,0x00,0x08,0xda,0x14,0x30,0x12,0x0a,0x35,0xf5,0x01,0xcf,0x94,0x58,0x11,0x07,
-0xb5,0xf3,0x18,0xfe,0x42,0x21,0x07,0xd3,0x09,0x18,0x07,0x97,0x06,0x01,0x0f,0x00,
-0x06,0x0e,0x00,0x00,0xb8,0x0f,0x1f,0x87,0x70,0x0d,0x10,0x0f,0x8c,0x04,0xff,0xe1,
-0x07,0x5e,0x1b,0x08,0x0a,0x00,0x15,0xfd,0x70,0x04,0x1d,0xfb,0x50,0x1b,0x17,0x9f,
-0x9d,0x28,0x12,0xc0,0x32,0x04,0x10,0x07,0x63,0x00,0x01,0x70,0x03,0x01,0x42,0x1b,
-0x02,0x7a,0x03,0x27,0x07,0xc0,0x84,0x03,0x0f,0x0a,0x00,0x0b,0x04,0x23,0x04,0x0f,
-0x0a,0x00,0x17,0x0e,0x5a,0x00,0x0f,0x0a,0x00,0x5e,0x06,0xcc,0x48,0x07,0x01,0xa7,
-0x10,0xef,0xaa,0x09,0x15,0xb3,0xd4,0x0c,0x15,0xf5,0xdf,0x6f,0x15,0xf5,0x76,0x5c,
-0x05,0x8f,0xfc,0x03,0x0a,0x00,0x5f,0x04,0xad,0xff,0xec,0x92,0x7d,0x03,0xa0,0x17,
-0xcf,0x78,0x0a,0x06,0x00,0x06,0x1f,0xf9,0x1d,0x00,0x10,0x20,0x35,0x55,0x68,0x23,
-0x3f,0x85,0x55,0x20,0x7d,0x03,0xe8,0x10,0x08,0x99,0x27,0x0f,0xd9,0x06,0x22,0x0f,
-0x61,0x07,0x0f,0x06,0x27,0x03,0x0f,0x44,0x00,0x03,0x00,0x0c,0x46,0x00,0x4d,0x2d,
-0x24,0x55,0x53,0x00,0x0f,0x14,0xbb,0x4c,0x02,0x0d,0x11,0x00,0x0f,0x72,0x07,0x19,
-0x18,0x00,0x4c,0x26,0x18,0x20,0x0f,0x03,0x14,0x0a,0x61,0x07,0x05,0x0c,0x03,0x02,
-0x29,0xcc,0x07,0x09,0x03,0x00,0x0a,0x88,0x21,0xc9,0x20,0xdd,0x6f,0x11,0xfc,0xa7,
-0x59,0x14,0x70,0x29,0x0d,0x55,0xe8,0x20,0x3e,0xff,0xf5,0x16,0x3f,0x05,0x4c,0xb8,
-0x18,0x9f,0x63,0x02,0x54,0x0e,0xff,0xfb,0x56,0xaf,0x43,0x0d,0x10,0x01,0x65,0x08,
-0x14,0x2a,0xbc,0xc5,0x20,0x04,0x44,0x41,0x07,0x1f,0x33,0x79,0xa9,0x17,0x07,0x44,
-0xa3,0x01,0xcf,0x1d,0x15,0xe4,0xe9,0x03,0x00,0xe6,0x25,0x0f,0x1b,0x00,0xff,0x05,
-0x10,0x03,0xf2,0x28,0x05,0x74,0x0a,0x13,0x4f,0x73,0x11,0x15,0x10,0xce,0xa3,0x05,
-0xee,0x3a,0x00,0xaf,0xac,0x05,0x69,0x2e,0x10,0x8f,0x29,0x02,0x03,0x88,0x94,0x01,
-0xdd,0xa9,0x12,0xb0,0x38,0x05,0x02,0x89,0x7f,0x18,0xf3,0xdf,0x0e,0x27,0xf8,0x00,
-0x5d,0x13,0x17,0xf9,0xe2,0xe1,0x28,0xff,0xf7,0x47,0x81,0x13,0xa2,0x07,0x0e,0x62,
-0x7b,0xde,0xff,0xec,0x95,0x10,0xfd,0x08,0x21,0xcf,0xeb,0x05,0x28,0x12,0x20,0x8c,
-0x2d,0x56,0xd6,0x10,0x6f,0xff,0xf1,0x58,0xaa,0x1a,0xfc,0xab,0xc7,0x54,0x3f,0xff,
-0xf8,0x46,0xcf,0x7a,0xaa,0x11,0xfb,0xb7,0x8f,0x1e,0x70,0xe5,0xe1,0x0f,0x78,0xd1,
-0xff,0x38,0x09,0x05,0xf9,0x06,0x0b,0x10,0x05,0xfe,0x11,0x0e,0x1b,0x00,0x0e,0xba,
-0xbb,0x0f,0xd5,0x03,0xff,0xe1,0x17,0x0a,0xcc,0x22,0x16,0xaf,0x88,0x42,0x08,0x17,
-0x00,0x04,0x20,0x06,0x0e,0x58,0x82,0x0f,0xbe,0x03,0xff,0x3c,0x16,0x80,0x88,0x27,
-0x37,0x3f,0xff,0xfc,0xcd,0xc1,0x54,0xef,0xff,0xf9,0x10,0x05,0x2c,0x84,0x12,0x07,
-0x85,0x35,0x28,0xfd,0x00,0x61,0xab,0x17,0x30,0x65,0x33,0x05,0x25,0xb1,0x5f,0x02,
-0x8c,0xef,0xfd,0xa4,0xd9,0x03,0xff,0xea,0x10,0x30,0xeb,0x15,0x11,0xf7,0x70,0x00,
-0x14,0xf8,0xd4,0x9c,0x10,0x03,0xb6,0x37,0x12,0x29,0x3c,0x19,0x17,0x0b,0x22,0x89,
-0x16,0x1d,0xcb,0x15,0x02,0xd3,0x3c,0x15,0xf8,0xdc,0xca,0x2f,0xdb,0x71,0xf0,0x03,
-0xff,0x41,0x00,0x50,0x48,0x10,0xdf,0x4f,0x09,0x07,0x55,0x1a,0x16,0x80,0x99,0x1c,
-0x25,0x95,0x6d,0x83,0x14,0x10,0x05,0xb8,0xd2,0x15,0xfc,0xeb,0x31,0x46,0xf4,0x00,
-0x00,0xcf,0xb6,0xfa,0x45,0x60,0x00,0x0e,0xfd,0x82,0x10,0x36,0xfe,0x40,0x2a,0x44,
-0x00,0x19,0x6f,0xe2,0x07,0x19,0x4c,0xbf,0x05,0x2f,0x01,0x32,0xb9,0x0b,0xff,0xdb,
-0x00,0xc2,0x1a,0x37,0xef,0xe9,0x10,0xfe,0xfc,0x14,0x30,0xa0,0x12,0x34,0x75,0x8f,
-0xfe,0x3b,0x06,0x43,0x50,0x00,0x7f,0xf6,0x0a,0x1f,0x35,0xf0,0x00,0x01,0x71,0x10,
-0x43,0x00,0x00,0x1f,0xf9,0xe0,0x03,0x32,0xf4,0x00,0x07,0xa0,0x1d,0x00,0xd1,0x88,
-0x14,0x47,0x34,0xbe,0x17,0x05,0x72,0x47,0x4f,0x03,0xae,0xfe,0x92,0x2d,0x04,0x13,
-0x1f,0x09,0x22,0x04,0x99,0x1a,0x9f,0x22,0x04,0x07,0x39,0x04,0x04,0xb7,0x47,0x13,
-0x56,0x40,0x0f,0x00,0x9a,0x2c,0x21,0x4f,0xff,0xc6,0x13,0x14,0xaf,0x7e,0xfe,0x21,
-0xb9,0x9b,0x22,0x04,0x17,0x0a,0x22,0x04,0x17,0x3f,0xda,0x1d,0x15,0x7f,0x6a,0x49,
-0x12,0x50,0x05,0x2b,0x21,0xf7,0x2f,0x58,0x00,0x68,0x17,0xbe,0xff,0xdb,0x61,0x00,
-0x1c,0xcb,0x15,0x80,0x88,0xed,0x00,0xb9,0x3b,0x44,0x01,0xef,0xff,0xfc,0x4b,0x01,
-0x10,0xe1,0x5d,0x3e,0x04,0xe5,0x2b,0x10,0xf4,0x2a,0x6f,0x13,0x20,0x6b,0x02,0x36,
-0xf7,0x00,0x4f,0xd2,0xba,0x11,0xfb,0x67,0x3e,0x04,0xa5,0x14,0x25,0x10,0x0b,0xae,
-0x2a,0x00,0xd0,0x3b,0x0e,0x51,0x3e,0x0f,0x13,0x04,0xff,0xcc,0x00,0xd3,0x95,0x03,
-0x26,0x53,0x01,0xbc,0x1e,0x03,0xd5,0xa0,0x12,0x0d,0x1c,0xe5,0x03,0xb9,0x46,0x23,
-0xfe,0x10,0xe3,0xc9,0x10,0x02,0x7a,0x00,0x03,0xf0,0x73,0x00,0x38,0x02,0x04,0x9b,
-0xcc,0x12,0x5f,0x55,0x02,0x1f,0x30,0x16,0x3e,0x13,0x07,0x49,0x03,0x1f,0x50,0x0c,
-0x00,0xa1,0x1a,0x8f,0x0c,0x00,0x14,0xf5,0x0c,0x00,0x07,0x2c,0x08,0x18,0x50,0xff,
-0x03,0x08,0x2d,0x08,0x08,0x00,0x04,0x08,0x2e,0x08,0x09,0x01,0x04,0x08,0x2f,0x08,
-0x07,0x02,0x04,0x0f,0x7b,0x03,0xff,0x17,0x1f,0x3f,0x7b,0x03,0x14,0x18,0xb0,0x7b,
-0x03,0x28,0xf8,0x09,0x7b,0x03,0x18,0x30,0x7b,0x03,0x18,0xd0,0x7b,0x03,0x18,0xf5,
-0x7b,0x03,0x18,0xfa,0x7b,0x03,0x18,0xfc,0x7b,0x03,0x18,0xfa,0x7b,0x03,0x16,0xd4,
-0x7b,0x03,0x08,0x41,0x2c,0x19,0x06,0xa5,0x26,0x39,0xcf,0xff,0xf3,0xb5,0x5e,0x18,
-0x20,0xe4,0x1e,0x38,0xfb,0x46,0x60,0x06,0x17,0x19,0xfc,0x33,0xd2,0x19,0xf0,0xb4,
-0x23,0x06,0x38,0x00,0x20,0x5b,0xef,0x90,0xf5,0x0f,0x92,0x0b,0xfd,0x15,0x9f,0x92,
-0x0b,0x25,0xfe,0x52,0x92,0x0b,0x10,0xa6,0x77,0x17,0x16,0xf5,0xa9,0xcf,0x1e,0xb2,
-0x4a,0x93,0x17,0x07,0x1d,0x25,0x07,0x83,0xd1,0x17,0x0f,0x8b,0x5a,0x56,0xff,0xff,
-0xfa,0x47,0x50,0xa8,0x3f,0x04,0x30,0x28,0x03,0x70,0x6f,0x05,0xaa,0x1a,0x05,0xc9,
-0x58,0x36,0xff,0xea,0x40,0x64,0x1e,0x1e,0x88,0x1e,0xb1,0x00,0x6a,0x02,0x0d,0x8d,
-0x3a,0x1e,0x2e,0xe6,0x37,0x03,0xd7,0x3e,0x1d,0x60,0x60,0xd8,0x2a,0x62,0xef,0x4c,
-0xd2,0x01,0x06,0x1f,0x03,0xfd,0xe6,0x08,0xb6,0x37,0x00,0x0c,0x0a,0x1f,0xbf,0x8f,
-0x4c,0x26,0x0d,0xf8,0x1e,0x02,0x4f,0x0a,0x07,0xb7,0x18,0x14,0xf1,0x29,0xaa,0x04,
-0x63,0xd0,0x14,0x01,0x4f,0x8f,0x13,0x40,0xb2,0x10,0x04,0xda,0x1f,0x14,0xa0,0x1a,
-0x50,0x04,0x73,0x21,0x01,0x90,0x3f,0x13,0x02,0x1d,0x19,0x17,0x0f,0xf6,0x74,0x01,
-0x18,0x35,0x13,0xe0,0xee,0x34,0x15,0xf4,0x44,0xd2,0x03,0x75,0x41,0x16,0x7f,0x9b,
-0x35,0x14,0xfc,0x20,0x55,0x05,0x2f,0xdf,0x00,0xec,0x43,0x05,0x72,0x7b,0x01,0x3b,
-0x01,0x05,0x64,0x54,0x12,0x1f,0xd5,0x03,0x04,0x51,0x11,0x14,0x9f,0xb3,0x58,0x05,
-0x12,0xc7,0x02,0x8a,0x81,0x12,0xe0,0xbd,0x0a,0x01,0x06,0x00,0x14,0xfe,0x9c,0x67,
-0x12,0xa0,0x88,0x25,0x01,0xde,0x81,0x14,0xba,0x24,0xdc,0x12,0x70,0x4e,0x00,0x10,
-0x60,0x5a,0x00,0x14,0x76,0x0a,0xd3,0x03,0xb4,0x6a,0x01,0x74,0x63,0x10,0x32,0x78,
-0x00,0x00,0x03,0x01,0x04,0xeb,0xed,0x00,0xae,0x00,0x00,0xef,0x11,0x05,0xe6,0xee,
-0x01,0x82,0xdf,0x51,0xcf,0xff,0xfb,0x00,0xbf,0xb0,0x69,0x05,0x95,0x54,0x50,0xf2,
-0x00,0xff,0xff,0xf8,0xea,0x00,0x05,0xbd,0x02,0x12,0x1f,0xf3,0x02,0x10,0xf4,0xe2,
-0x00,0x14,0x40,0xf2,0xb1,0x12,0x0d,0x50,0x25,0x10,0xf0,0x0c,0x01,0x13,0x70,0xf4,
-0xaf,0x00,0xb8,0x00,0x20,0xfc,0x0b,0x6d,0x00,0x00,0x81,0xa4,0x04,0x75,0xc7,0x00,
-0xbe,0x00,0x11,0x0e,0xd3,0x7e,0x02,0x0b,0x47,0x14,0x70,0x60,0x05,0x13,0x4f,0x21,
-0x86,0x15,0xf3,0x67,0x12,0x02,0x86,0x41,0x01,0x09,0x00,0x15,0xf9,0xd3,0x02,0x14,
-0xbf,0x07,0x05,0x05,0x09,0x00,0x04,0xf9,0x4e,0x14,0xf8,0x63,0x51,0x17,0xf8,0xcf,
-0x8d,0x19,0xf4,0xcf,0x1d,0x03,0xb5,0x1d,0x1b,0xf1,0xe4,0xe0,0x14,0x0d,0xa6,0x16,
-0x26,0x0c,0xff,0xad,0x28,0x14,0x09,0xab,0x1a,0x17,0x08,0xb4,0x51,0x14,0x06,0x05,
-0x1b,0x08,0x0a,0xe1,0x15,0x02,0xe2,0x1a,0x1a,0xff,0x71,0xd0,0x15,0xfd,0x5a,0x1d,
-0x07,0xfc,0x2b,0x1f,0xf9,0xbb,0x5e,0x01,0x1c,0x2d,0xbf,0xc2,0x1a,0x3e,0x88,0x1c,
-0x03,0x4d,0x17,0x1a,0x50,0x74,0x7a,0x19,0x7e,0x90,0x03,0x00,0x09,0x28,0x17,0x2d,
-0x77,0x03,0x20,0x01,0xbf,0xd8,0x95,0x17,0x0b,0x0e,0x06,0x1e,0x15,0x8c,0xea,0x0f,
-0x41,0x7d,0x1f,0x12,0xf4,0x3d,0x01,0x12,0x20,0x61,0x03,0x12,0x60,0x4f,0x10,0x01,
-0xd9,0x09,0x01,0xa5,0x00,0x13,0xf2,0x91,0x71,0x11,0x9f,0x52,0x01,0x10,0x08,0xa9,
-0x03,0x14,0x7f,0x8a,0x8e,0x12,0xff,0x02,0x01,0x22,0xa0,0x03,0x42,0x6a,0x02,0x96,
-0x01,0x01,0x89,0xbb,0x02,0xa5,0xe9,0x11,0x6f,0x72,0x01,0x14,0x02,0x6c,0xd5,0x32,
-0x70,0x00,0x0b,0xb3,0x37,0x10,0x5f,0x41,0x00,0x15,0x07,0x2f,0x39,0x01,0xf7,0x49,
-0x02,0xe8,0xe3,0x32,0xe0,0x00,0x3f,0x3d,0x29,0x11,0xcf,0x0b,0x01,0x00,0x58,0x00,
-0x03,0xa9,0x7e,0x11,0x0f,0x6a,0x07,0x01,0x7b,0x2b,0x10,0xcf,0x91,0x5c,0x22,0xf0,
-0x02,0x34,0x04,0x00,0x89,0x38,0x11,0x1f,0x83,0x02,0x12,0x40,0x75,0xab,0x00,0x69,
-0xd4,0x73,0x05,0xff,0xff,0xb0,0x9f,0xff,0xf9,0xa6,0x0a,0x11,0x0f,0x96,0x49,0x00,
-0x68,0x42,0x21,0xd0,0xcf,0x60,0x04,0x00,0x8d,0x00,0x11,0x1e,0x86,0x6e,0x00,0x50,
-0xc3,0x12,0xe0,0x32,0x04,0x10,0xf8,0x3c,0x04,0x36,0xbf,0xff,0xfa,0x33,0x5d,0x00,
-0x50,0x03,0x16,0x06,0xfd,0x55,0x03,0xcd,0x42,0x15,0x1f,0x1d,0x58,0x13,0x0b,0xe4,
-0x1d,0x15,0xdf,0x4b,0x58,0x12,0x7f,0xc2,0x05,0x06,0x62,0x02,0x13,0x03,0x3e,0x00,
-0x15,0x3f,0xee,0x5d,0x17,0x0f,0xa1,0x79,0x14,0x20,0x44,0x02,0x13,0xfc,0xa0,0x04,
-0x19,0xe0,0x11,0x89,0x15,0x5f,0x0f,0x06,0x12,0x4f,0xd8,0x06,0x16,0x01,0xa4,0x02,
-0x03,0x72,0x00,0x18,0x0c,0x5f,0x2f,0x3a,0x38,0x88,0x81,0x1f,0x77,0x08,0x81,0x24,
-0x18,0x4f,0x7c,0x50,0x02,0xef,0x02,0x18,0xfd,0xaa,0xe7,0x16,0x69,0x1f,0x00,0x10,
-0x05,0xc8,0x01,0x15,0x9f,0x1f,0x00,0x10,0x6f,0xa8,0x02,0x15,0x08,0x1f,0x00,0x20,
-0x77,0x77,0x55,0xbf,0x3f,0x57,0x77,0x74,0x5d,0x02,0x0e,0x06,0xb8,0x06,0x10,0x04,
-0x1b,0x02,0x02,0x05,0x78,0x05,0x36,0xc8,0x06,0xf0,0x00,0x01,0x7b,0x3a,0x18,0x02,
-0x99,0x21,0x02,0x8e,0xcd,0x17,0xfc,0xab,0xf3,0x04,0xcb,0x44,0x12,0x09,0xda,0x03,
-0x04,0x9e,0x99,0x03,0x9a,0xd6,0x01,0x97,0xcd,0x07,0x7b,0xef,0x03,0xff,0x36,0x04,
-0xa9,0x4b,0x02,0xc2,0x09,0x05,0x7c,0x35,0x15,0x08,0x60,0x83,0x15,0x20,0xd4,0x4b,
-0x07,0x6d,0x01,0x10,0x7f,0xfc,0x02,0x02,0xea,0xe5,0x04,0x6a,0xcc,0x01,0x66,0x06,
-0x06,0xe7,0x25,0x17,0x5b,0x33,0x09,0x11,0xef,0x56,0x17,0x18,0xf9,0x5c,0x09,0x07,
-0x92,0x9b,0x1a,0x0e,0x01,0x19,0x16,0x06,0x3d,0x1f,0x05,0xa2,0xe4,0x1a,0xf8,0x14,
-0x04,0x19,0xf1,0x67,0x30,0x2d,0xff,0x80,0xe0,0x9d,0x0f,0x0f,0x00,0x99,0x08,0x57,
-0xda,0x17,0x08,0xed,0x36,0x01,0xd3,0x0c,0x06,0xec,0x36,0x18,0xc8,0xeb,0x36,0x04,
-0xea,0x36,0x11,0x4e,0x1e,0xd9,0x03,0xba,0xfa,0x01,0xef,0x69,0x1e,0x01,0xd2,0xd5,
-0x0f,0xef,0xe7,0xff,0xd8,0x20,0x08,0xde,0x8d,0x10,0x35,0x3c,0xec,0x50,0x4a,0xca,
-0x01,0x1c,0x04,0x15,0xf5,0x00,0x26,0x17,0x50,0xa0,0x00,0x0b,0x0f,0x00,0x10,0x9f,
-0xd0,0x45,0x15,0x03,0x2d,0x00,0x30,0x08,0xef,0xb2,0xda,0x16,0x1f,0xfd,0x79,0xd6,
-0x1e,0x0f,0xd1,0x04,0xff,0xf0,0x19,0x00,0xb6,0x7c,0x03,0x6a,0x52,0x08,0xf1,0x32,
-0x18,0xd0,0xf1,0x2d,0x18,0xe1,0x7e,0x07,0x18,0xe2,0xa9,0x0f,0x18,0xf3,0xd0,0x16,
-0x18,0xf5,0xb4,0x07,0x1f,0xf7,0x61,0x19,0x10,0x06,0x01,0x00,0x19,0x54,0x87,0xe0,
-0x0f,0x1b,0x00,0x14,0x33,0xfe,0x13,0xbb,0x01,0x00,0x18,0xdf,0xeb,0x03,0x18,0x0e,
-0x69,0x10,0x18,0x0a,0xe6,0x33,0x18,0x05,0x2f,0xfb,0x04,0xf3,0x7f,0x15,0x00,0x29,
-0x42,0x08,0xc3,0x0a,0x06,0x77,0x4b,0x18,0x2f,0xd4,0x40,0x18,0x0d,0x55,0x1a,0x18,
-0x08,0x15,0x38,0x19,0x04,0x48,0xe0,0x08,0x30,0x59,0x00,0x42,0x01,0x18,0xfe,0xa3,
-0x08,0x06,0x41,0x0b,0x18,0x1e,0x76,0x34,0x09,0x69,0x2f,0x18,0x07,0xcc,0xe2,0x19,
-0x02,0x8e,0x02,0x18,0xdf,0xab,0x00,0x1c,0x8f,0xe1,0x4e,0x18,0x70,0x07,0x01,0x18,
-0xc0,0x07,0x01,0x19,0xf1,0x1b,0xa1,0x04,0x3b,0x01,0x28,0x71,0xef,0x02,0x2a,0x09,
-0x7a,0x01,0x2f,0xb4,0xff,0x1b,0x00,0x14,0x0c,0x6a,0x38,0x16,0x05,0x82,0x01,0x07,
-0xd0,0xf9,0x15,0x9f,0xdf,0x00,0x16,0x03,0x11,0x01,0x16,0x0d,0x51,0x02,0x16,0x8f,
-0x75,0x01,0x0f,0xca,0xf9,0x0a,0x16,0x0e,0x45,0xc7,0x0f,0x0b,0x00,0x18,0x21,0xf2,
-0x07,0xc4,0x50,0x04,0x7e,0x80,0x04,0x9a,0x55,0x06,0xf7,0x04,0x0c,0x50,0x01,0x16,
-0x03,0xd1,0x01,0x16,0x1e,0x1e,0x03,0x15,0xbf,0xbb,0x00,0x16,0x06,0xa2,0x01,0x16,
-0x3f,0x10,0x04,0x06,0xf3,0xba,0x16,0x0a,0x1d,0x06,0x15,0x5f,0x75,0x00,0x2f,0x02,
-0xff,0x75,0x00,0x0b,0x10,0x04,0x3c,0x0e,0x01,0xa9,0x00,0x26,0x86,0x1e,0x4b,0x46,
-0x1f,0x4f,0x0b,0x00,0x18,0x1e,0x00,0xc6,0xbe,0x18,0xbf,0xad,0xe9,0x18,0x7f,0xf6,
-0x36,0x19,0x0b,0x34,0x13,0x18,0x9f,0x4f,0x13,0x07,0xb8,0x57,0x01,0x65,0x55,0x1e,
-0xe9,0x23,0x25,0x0f,0xde,0x03,0xff,0xd9,0x37,0x09,0xef,0xc3,0x4c,0x01,0x07,0xf5,
-0xfb,0x16,0x80,0xf2,0x08,0x04,0x96,0x01,0x07,0x9a,0x50,0x16,0x4f,0x44,0x02,0x2e,
-0x01,0x56,0x15,0x5e,0x0f,0xde,0x03,0xff,0x22,0x11,0x17,0xf6,0xa9,0x13,0x07,0x39,
-0x43,0x10,0x7f,0x7b,0x00,0x14,0x0c,0xab,0x00,0x00,0x0e,0x00,0x14,0x1c,0x87,0x0a,
-0x00,0x0e,0x00,0x16,0x6c,0x5e,0x05,0x16,0x7f,0x8c,0xc8,0x04,0x01,0x87,0x08,0x49,
-0x17,0x05,0x0d,0x00,0x00,0x1e,0x99,0x1f,0x71,0xde,0x03,0xff,0xda,0x01,0x43,0x02,
-0x02,0x1e,0x36,0x01,0x31,0x11,0x11,0x1c,0x71,0x56,0x00,0x90,0x00,0x22,0x51,0xcf,
-0x81,0xa9,0x02,0xc3,0x3b,0x15,0xa0,0x82,0x17,0x16,0xf9,0xa2,0x17,0x14,0x70,0xd0,
-0x3d,0x2f,0x66,0x64,0xde,0x03,0xff,0x33,0x52,0x00,0x04,0x67,0x76,0x41,0x70,0x3d,
-0x12,0xfc,0x95,0x0c,0x12,0xfa,0xba,0x0c,0x22,0xf8,0x01,0xd6,0x1e,0x12,0x08,0x4b,
-0x03,0x10,0x0d,0x5a,0x1b,0x23,0x10,0x20,0x06,0x10,0x03,0x81,0xbe,0x12,0x3f,0x6a,
-0x02,0x1f,0x4f,0x07,0x00,0xa9,0x09,0x01,0x00,0x1f,0xef,0x48,0x02,0x06,0x04,0x6b,
-0x0c,0x17,0xde,0x14,0x00,0x70,0xf2,0xef,0x00,0xfa,0xe6,0x00,0xe6,0xff,0x01,0x0f,
-0x34,0x00,0x02,0x4f,0x06,0x0b,0x00,0x06,0x18,0x00,0x01,0x1f,0xaf,0xd7,0x08,0x18,
-0x0f,0xa9,0x3e,0x0d,0x03,0x90,0x00,0xb2,0xe9,0x00,0xfa,0x00,0x00,0xde,0xfb,0xea,
-0xf5,0x00,0xd5,0x9b,0x00,0x8e,0xfd,0x00,0x00,0xfb,0xfd,0xf2,0xf7,0x00,0x9a,0x00,
-0x5f,0xf8,0x00,0xf9,0x00,0x00,0x82,0x85,0x04,0x06,0x95,0x1a,0x03,0x1b,0x01,0x0a,
-0xf9,0xcf,0x05,0xa6,0x04,0x40,0xdd,0x00,0x00,0x00,0x01,0x02,0x6c,0xe8,0x00,0xfa,
-0x00,0xfa,0xf4,0xcb,0x1a,0x1c,0xf7,0x08,0x01,0x05,0x40,0x00,0x11,0xfb,0x43,0x00,
-0x28,0xfb,0xf9,0xac,0x52,0x00,0x53,0x10,0x35,0xc9,0x00,0xc5,0x26,0x00,0x62,0xf6,
-0xfa,0x00,0x00,0xfa,0xf9,0x04,0x00,0x0b,0x1e,0xf1,0x03,0x98,0x00,0x2f,0x05,0xf8,
-0x12,0x01,0x09,0x0f,0x72,0xa0,0x10,0x1b,0xd1,0xa5,0x00,0x12,0xf9,0x58,0x00,0x33,
-0xf9,0xf5,0xee,0x11,0x00,0x14,0xae,0x72,0x00,0x87,0xee,0x00,0x00,0xc5,0xf9,0xc5,
-0xe5,0x00,0x3b,0x1e,0x28,0xfc,0xdd,0xe8,0x70,0x71,0x8d,0x00,0x00,0x00,0xcd,0x00,
-0xcb,0x0c,0x00,0x80,0xf1,0x00,0xf6,0x00,0xfd,0xfc,0x00,0x00,0x81,0x96,0x20,0x00,
-0x04,0x12,0x00,0x1d,0xab,0x1a,0x01,0x4f,0xf8,0xfa,0x00,0xf6,0x9f,0x00,0x0d,0x10,
-0xf2,0x26,0x01,0x0e,0xb1,0xa2,0x03,0x9f,0x02,0xc0,0xb6,0xb2,0x00,0x00,0xde,0xf8,
-0xc2,0xfb,0x05,0x00,0x05,0x04,0x13,0x01,0xf1,0x02,0xd0,0xe7,0x00,0xe7,0xc5,0xed,
-0xea,0x00,0xed,0xe9,0xf3,0xea,0xef,0x00,0xca,0xe8,0xe5,0x72,0x01,0x66,0xc3,0xd3,
-0x00,0x00,0xeb,0xfc,0x3b,0x01,0xa3,0xf3,0xf3,0x00,0x00,0xf3,0xf7,0x00,0x00,0xf8,
-0xfd,0x49,0x01,0x10,0x00,0xa5,0x00,0x51,0xd7,0xef,0x00,0x00,0xf4,0x0a,0x00,0x02,
-0xc6,0x04,0x63,0xf7,0xf7,0x00,0x00,0xf7,0xfa,0xe9,0x01,0x15,0x04,0x3e,0x00,0x14,
-0xd3,0x1b,0x02,0x15,0x04,0x30,0x01,0x10,0xfa,0x6a,0x01,0x16,0xf7,0xd9,0x00,0xf6,
-0x14,0x06,0xf2,0xbe,0xd5,0x00,0x00,0xd5,0xf8,0xe5,0xfb,0x05,0xe5,0x05,0x05,0x04,
-0x05,0x00,0x05,0xee,0xed,0xfa,0xf5,0xed,0xf5,0xef,0xfa,0xf5,0xfa,0x00,0xf9,0xf7,
-0x05,0xe5,0xee,0xee,0xdc,0x0b,0x1a,0xf9,0xaf,0x01,0x10,0xfa,0x14,0x02,0x1e,0xf8,
-0xd5,0x01,0x17,0xfb,0x72,0x02,0x0e,0x1c,0x00,0x0f,0x01,0x00,0x08,0x05,0xf8,0x00,
-0x0f,0x29,0x02,0x0a,0x4e,0xfd,0x00,0xfc,0xfc,0xe5,0x02,0x0f,0x55,0x00,0x0f,0x0f,
-0x1d,0x00,0x0a,0x1e,0x05,0xf3,0x03,0x17,0x05,0x57,0x03,0x03,0x7c,0x01,0x1f,0xe9,
-0xf2,0x1d,0x27,0x0d,0xdf,0x02,0x1f,0xe7,0x98,0x00,0x0b,0x25,0xfa,0xfb,0x77,0x00,
-0x1c,0xcf,0x8e,0x02,0x20,0xfb,0x06,0x8d,0x02,0x4f,0x0e,0x00,0x05,0x05,0x75,0x00,
-0x0c,0x0a,0xd2,0x03,0x00,0x06,0x02,0x1c,0xd0,0x69,0x00,0x3e,0xfc,0x04,0x00,0x22,
-0x01,0x1f,0xdd,0xe4,0x00,0x26,0x0e,0x6b,0xfc,0x0f,0x1f,0x02,0x19,0x1f,0xfa,0x07,
-0x04,0x08,0x12,0x01,0x34,0xb2,0x31,0x02,0x03,0x00,0xa7,0x03,0x1e,0x05,0xb7,0x05,
-0xf2,0x0b,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,
-0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0xad,0x2d,0xf1,0x0b,
-0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,
-0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x3f,0x00,0x01,0x01,0x00,0xd0,
-0x00,0x08,0x0a,0x0a,0x0a,0x0a,0x0c,0x0c,0x0c,0x0c,0x09,0x0c,0x09,0x01,0x00,0xa1,
-0x00,0x00,0x0d,0x0d,0x0d,0x0d,0x17,0x00,0x00,0x1a,0x01,0x00,0x62,0x00,0x1c,0x1d,
-0x1d,0x1d,0x1d,0x8a,0x1d,0x10,0x21,0x01,0x00,0x02,0x7c,0x00,0x50,0x24,0x1b,0x24,
-0x06,0x1a,0x02,0x00,0x22,0x08,0x1c,0x02,0x00,0x64,0x09,0x00,0x09,0x00,0x0a,0x1d,
-0x02,0x00,0x05,0x5c,0x13,0x44,0x1f,0x00,0x00,0x0c,0x02,0x00,0x00,0x6a,0x0a,0x53,
-0x00,0x0e,0x00,0x00,0x0f,0x02,0x00,0x00,0x1f,0x00,0x00,0x02,0x00,0x50,0x1f,0x00,
-0x00,0x09,0x21,0x02,0x00,0x01,0x29,0xb5,0x16,0x22,0x2d,0xb5,0x11,0x13,0x02,0x00,
-0x17,0x0d,0x02,0x00,0x70,0x15,0x00,0x17,0x24,0x17,0x18,0x27,0x02,0x00,0x04,0x21,
-0x01,0x20,0x03,0x02,0x1c,0x01,0x4c,0x06,0x07,0x06,0x08,0x48,0x2a,0x40,0x00,0x0a,
-0x00,0x0b,0x82,0x0a,0x00,0x83,0x00,0x01,0x08,0x00,0xd0,0x0b,0x00,0x0d,0x0e,0x0f,
-0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x9c,0x09,0x62,0x00,0x17,0x17,0x17,0x18,
-0x17,0x57,0x57,0xf1,0x04,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,
-0x1f,0x22,0x00,0x00,0x23,0x00,0x00,0x0a,0x01,0x00,0x27,0x24,0x0b,0x62,0x7c,0x00,
-0x01,0x00,0xa1,0x00,0x0b,0x0f,0x0f,0x0f,0x0f,0x13,0x00,0x00,0x16,0x01,0x00,0x20,
-0x25,0x17,0x01,0x00,0x02,0x44,0x00,0x02,0x32,0x01,0xa0,0x26,0x1e,0x1e,0x1e,0x1e,
-0x1f,0x00,0x1f,0x0a,0x16,0x02,0x00,0x22,0x0b,0x17,0x02,0x00,0x20,0x00,0x17,0x7f,
-0x69,0x04,0x02,0x00,0x05,0x16,0x00,0x0b,0x01,0x00,0x1b,0x0c,0x10,0x00,0x10,0x19,
-0x02,0x00,0x51,0x19,0x00,0x00,0x0b,0x1a,0x02,0x00,0x13,0x17,0xb1,0x0b,0x12,0x1c,
-0x02,0x00,0x30,0x0e,0x00,0x0e,0x0e,0x18,0x16,0x1e,0x02,0x00,0xc0,0x11,0x00,0x13,
-0x1f,0x13,0x14,0x22,0x14,0x22,0x14,0x22,0x00,
+0x00,0x54,0x00,0x11,0x20,0xf1,0x00,0x57,0x55,0x55,0x55,0x40,0x00,0x01,0x00,0x17,
+0x0b,0x52,0x0a,0x05,0x95,0x04,0x18,0x20,0x11,0x00,0x18,0x1d,0xe7,0x05,0x00,0x01,
+0x00,0x12,0x2e,0x53,0x00,0x06,0x01,0x00,0x16,0x3f,0xbf,0x05,0x05,0xd4,0x08,0x19,
+0xa0,0x11,0x00,0x13,0x6f,0xea,0x07,0x0f,0x01,0x00,0x16,0x15,0x5f,0x25,0x05,0x06,
+0xa7,0x00,0x17,0xe0,0x10,0x00,0x28,0x01,0xff,0x96,0x06,0x03,0x81,0x08,0x1b,0xfb,
+0xc7,0x00,0x06,0xd0,0x06,0x04,0x7d,0x08,0x07,0xea,0x00,0x00,0x72,0x05,0x06,0x35,
+0x0b,0x04,0x54,0x06,0x28,0xf3,0x00,0xf7,0x06,0x02,0x4f,0x08,0x06,0x3a,0x07,0x16,
+0xd9,0xe5,0x08,0x01,0x79,0x02,0x27,0xf7,0x3f,0x0b,0x01,0x01,0x89,0x03,0x16,0xef,
+0x13,0x09,0x01,0x42,0x04,0x14,0x08,0x6d,0x09,0x02,0x9a,0x03,0x13,0xf7,0x79,0x0c,
+0x05,0x70,0x02,0x10,0x20,0xc7,0x02,0x16,0xd0,0x44,0x07,0x11,0xd0,0x16,0x00,0x18,
+0x30,0xca,0x0b,0x15,0x3f,0x0b,0x01,0x12,0x0a,0x9b,0x01,0x14,0xdf,0x0b,0x01,0x12,
+0x01,0x40,0x06,0x03,0xfd,0x0c,0x02,0x05,0x01,0x12,0xf7,0x69,0x00,0x19,0xfb,0xcc,
+0x01,0x00,0x23,0x0d,0x04,0x05,0x01,0x54,0xfb,0xbb,0xbb,0xbb,0xbe,0x0b,0x01,0x01,
+0x05,0x01,0x03,0xd0,0x02,0x0a,0x59,0x07,0x02,0x0b,0x01,0x03,0x05,0x01,0x06,0x0b,
+0x01,0x17,0xaf,0x10,0x00,0x15,0xfe,0x82,0x08,0x03,0x01,0x00,0x12,0xf5,0x05,0x01,
+0x15,0xd0,0xde,0x00,0x14,0xb0,0xa5,0x0a,0x24,0x00,0x00,0xaf,0x09,0x16,0x2f,0x5f,
+0x02,0x10,0xdf,0x1b,0x00,0x16,0x08,0xde,0x0c,0x11,0x08,0x3c,0x00,0x16,0xef,0x21,
+0x01,0x10,0x2f,0x0b,0x01,0x16,0x4f,0x90,0x02,0x00,0x32,0x00,0x26,0xf9,0x0a,0x31,
+0x00,0x60,0x00,0x07,0xff,0xff,0xff,0xe0,0x13,0x00,0x01,0x00,0x67,0x02,0x55,0x55,
+0x55,0x40,0x00,0x01,0x00,0x48,0xef,0xff,0xff,0xf4,0x10,0x00,0x48,0x9f,0xff,0xff,
+0xf5,0x10,0x00,0x48,0x3f,0xff,0xff,0xf7,0x10,0x00,0x48,0x0c,0xff,0xff,0xf9,0x10,
+0x00,0x48,0x07,0xff,0xff,0xfa,0x10,0x00,0x58,0x02,0xff,0xff,0xfc,0x00,0x01,0x00,
+0x5f,0xbf,0xff,0xfd,0x10,0x00,0x01,0x00,0x19,0x1b,0x5f,0x62,0x00,0x57,0x0b,0xff,
+0xff,0xff,0xe0,0x10,0x00,0x67,0x01,0xff,0xff,0xff,0xff,0x50,0x11,0x00,0x5a,0x6f,
+0xff,0xff,0xff,0xfb,0xa3,0x00,0x38,0xff,0xff,0xf1,0x93,0x00,0x00,0x01,0x00,0x16,
+0x70,0x11,0x00,0x10,0x8f,0x10,0x00,0x16,0xfd,0x10,0x00,0x11,0x0e,0x21,0x00,0x15,
+0xf3,0x10,0x00,0x21,0x04,0xff,0x01,0x00,0x15,0x90,0x11,0x00,0x75,0xaf,0xff,0xff,
+0xd9,0xff,0xff,0xfe,0x10,0x00,0x57,0x1f,0xff,0xff,0xf7,0x3f,0x29,0x01,0x94,0x06,
+0xff,0xff,0xff,0x20,0xef,0xff,0xff,0xb0,0x11,0x00,0x84,0xcf,0xff,0xff,0xd0,0x08,
+0xff,0xff,0xff,0xfa,0x00,0x10,0x2f,0x46,0x01,0x07,0x4b,0x01,0x10,0x08,0x31,0x00,
+0x56,0x00,0xdf,0xff,0xff,0xd0,0x87,0x01,0x11,0xd0,0x16,0x00,0x12,0x30,0x10,0x00,
+0x11,0x4f,0x2c,0x00,0x15,0x3f,0x0b,0x01,0x11,0x0a,0x31,0x00,0x00,0x32,0x00,0x15,
+0xe0,0x05,0x01,0x12,0xd0,0x48,0x00,0x14,0x50,0x05,0x01,0x12,0xf7,0x69,0x00,0x15,
+0xfb,0x05,0x01,0x21,0x20,0x00,0x32,0x00,0x14,0xf1,0x05,0x01,0x54,0xfb,0xbb,0xbb,
+0xbb,0xbe,0x0b,0x01,0x25,0x8f,0xff,0x01,0x00,0x16,0xfd,0x05,0x01,0x15,0xff,0x0b,
+0x01,0x03,0x05,0x01,0x06,0x0b,0x01,0x17,0xaf,0x10,0x00,0x00,0x0b,0x01,0x18,0x0f,
+0x21,0x00,0x12,0xf5,0x05,0x01,0x15,0xd0,0xde,0x00,0x11,0xb0,0x05,0x01,0x14,0xf7,
+0xff,0x00,0x00,0x0b,0x01,0x13,0x2f,0x93,0x00,0x02,0x96,0x00,0x11,0xf7,0x27,0x00,
+0x16,0xc0,0x10,0x01,0x36,0xd0,0x00,0xef,0x21,0x01,0x10,0x2f,0x0b,0x01,0x16,0x4f,
+0x31,0x00,0x00,0x32,0x00,0x26,0xf9,0x0a,0x31,0x00,0x27,0x00,0x07,0x16,0x02,0x48,
+0x78,0x88,0x30,0x00,0x21,0x02,0x48,0xcf,0xff,0xff,0x40,0x93,0x02,0x1a,0xdf,0x31,
+0x02,0x20,0x03,0xef,0xb2,0x00,0x18,0x60,0xef,0x01,0x57,0xf7,0x2d,0xff,0xff,0x80,
+0xce,0x01,0x35,0xf5,0x00,0x1c,0x00,0x02,0x00,0x6b,0x00,0x11,0xe3,0x87,0x02,0x1e,
+0xa0,0xc8,0x02,0x0f,0xd6,0x02,0xff,0xff,0x48,0x20,0x01,0x32,0xae,0x00,0x15,0x44,
+0xc8,0x02,0x40,0x1b,0xff,0xfe,0x71,0x20,0x01,0x04,0x10,0x00,0x75,0x1e,0xff,0xff,
+0xff,0xf9,0x55,0xcf,0x3a,0x00,0x13,0x0b,0xb3,0x00,0x18,0xf7,0x1f,0x02,0x00,0xd4,
+0x00,0x04,0xad,0x01,0x56,0x7f,0xff,0xd3,0x03,0x9f,0x8b,0x01,0xbf,0x00,0x09,0xff,
+0xf6,0x00,0x00,0x19,0xdf,0xea,0x20,0x00,0xd6,0x02,0xff,0xff,0x59,0x87,0x4c,0xec,
+0x40,0x00,0x00,0x01,0x9e,0xd8,0x5d,0x08,0x10,0x40,0x7c,0x00,0x04,0x42,0x08,0x11,
+0x0a,0x4d,0x08,0x16,0x3f,0x12,0x02,0x10,0xaf,0x75,0x05,0x16,0x03,0x9d,0x01,0x11,
+0x04,0xae,0x08,0x16,0x0d,0xbe,0x01,0x9f,0x05,0xdf,0xd5,0x00,0x00,0x00,0x1a,0xee,
+0x91,0xc5,0x02,0x28,0x19,0x05,0x40,0x02,0x01,0xb3,0x08,0x07,0x40,0x02,0x02,0x43,
+0x02,0x09,0x15,0x09,0x00,0x3e,0x01,0x06,0x40,0x02,0x02,0x43,0x02,0x06,0x40,0x02,
+0x03,0x12,0x01,0x08,0x37,0x09,0x11,0x08,0x78,0x01,0x19,0xd0,0x76,0x09,0x07,0x8b,
+0x03,0x01,0x43,0x02,0x17,0xff,0x4b,0x03,0x00,0x09,0x01,0x27,0xfd,0x9f,0x4b,0x03,
+0x00,0x43,0x02,0x17,0x73,0x4b,0x03,0x00,0x43,0x02,0x27,0xf2,0x0e,0x4b,0x03,0x10,
+0x0c,0x1a,0x02,0x16,0x8f,0x39,0x01,0x10,0x02,0x3b,0x02,0x16,0x03,0x4b,0x03,0x00,
+0x1c,0x00,0x10,0xf2,0x39,0x01,0x16,0xfd,0x48,0x03,0x11,0xfd,0x16,0x00,0x16,0xf3,
+0x48,0x03,0x11,0x70,0x6b,0x01,0x15,0x90,0x7b,0x01,0x11,0xf2,0x6b,0x01,0x15,0xfe,
+0x05,0x01,0x12,0xfd,0x48,0x00,0x15,0xf5,0x05,0x01,0x12,0x70,0x69,0x00,0x14,0xb0,
+0x05,0x01,0x21,0xf2,0x00,0x32,0x00,0x24,0xff,0x10,0x05,0x01,0x44,0xbb,0xbb,0xbb,
+0xbb,0x2a,0x02,0x17,0x08,0x83,0x02,0x16,0xd0,0x05,0x01,0x15,0xff,0x0b,0x01,0x17,
+0x4f,0x10,0x00,0x13,0xf9,0x48,0x03,0x05,0x01,0x00,0x00,0x0b,0x01,0x18,0xff,0x01,
+0x00,0x11,0x50,0x05,0x01,0x15,0xfd,0xde,0x00,0x12,0xfb,0x48,0x03,0x15,0x70,0xff,
+0x00,0x11,0xf1,0x06,0x00,0x00,0x93,0x00,0x03,0x96,0x00,0x10,0x70,0x27,0x00,0x16,
+0xfc,0x10,0x01,0x11,0xfd,0x48,0x03,0x16,0x70,0x31,0x01,0x26,0xf3,0x04,0x31,0x00,
+0x01,0x32,0x00,0x27,0x90,0xaf,0xce,0x0a,0x16,0x7f,0x16,0x02,0x4b,0x03,0xbe,0xfd,
+0x70,0x05,0x0b,0x47,0xff,0xd1,0x00,0x00,0x95,0x04,0x48,0xe6,0x5a,0xff,0xc0,0x52,
+0x02,0x57,0xf2,0x00,0x0a,0xff,0x30,0xc6,0x04,0x57,0xfc,0x00,0x00,0x4f,0xf6,0x21,
+0x00,0x68,0xff,0xc0,0x00,0x04,0xff,0x60,0x18,0x05,0x47,0x20,0x00,0xaf,0xf3,0x21,
+0x00,0x49,0x4f,0xfd,0x54,0x9f,0x59,0x0b,0x00,0xc1,0x00,0x09,0xbc,0x05,0x3f,0x4b,
+0xef,0xd8,0x69,0x0b,0xff,0xff,0x43,0x50,0x07,0xff,0xff,0xff,0xe0,0x14,0x00,0x01,
+0x00,0x26,0xcf,0xff,0x01,0x00,0x14,0x40,0x15,0x00,0x2f,0x05,0xff,0x16,0x00,0x01,
+0x1f,0x0d,0x16,0x00,0x02,0x1f,0x6f,0x16,0x00,0x02,0x1f,0xef,0x16,0x00,0x01,0x12,
+0x08,0x0f,0x00,0x21,0xb9,0x99,0x01,0x00,0x13,0x20,0x16,0x00,0x1b,0x1f,0x3b,0x00,
+0x02,0x01,0x00,0x89,0x9f,0xff,0xff,0xfc,0xff,0xff,0xff,0x50,0x15,0x00,0x99,0x02,
+0xff,0xff,0xff,0xd6,0xff,0xff,0xff,0x60,0x16,0x00,0x99,0x0a,0xff,0xff,0xff,0x55,
+0xff,0xff,0xff,0x70,0x16,0x00,0x5c,0x3f,0xff,0xff,0xfd,0x04,0x16,0x00,0x00,0xef,
+0x00,0x10,0xf4,0x16,0x00,0x18,0x80,0x15,0x00,0x00,0x11,0x00,0x68,0xc0,0x03,0xff,
+0xff,0xff,0x90,0x16,0x00,0x10,0x0d,0x95,0x00,0x00,0x72,0x00,0x11,0xd9,0xaf,0x00,
+0x15,0x30,0xef,0x00,0x35,0xfc,0x00,0x01,0xdb,0x00,0x15,0x60,0xef,0x00,0x1d,0xf3,
+0x16,0x00,0x7b,0x07,0xff,0xff,0xff,0xb0,0x00,0x00,0x16,0x00,0x00,0xef,0x00,0x1d,
+0x30,0x16,0x00,0x5c,0x8f,0xff,0xff,0xfb,0x00,0x16,0x00,0x00,0x7d,0x00,0x12,0xf3,
+0x5e,0x00,0x1a,0xe0,0xef,0x00,0x59,0xfd,0xdd,0xdd,0xdd,0xff,0x16,0x00,0x16,0x3f,
+0x6f,0x01,0x16,0xf0,0x16,0x00,0x1e,0xbf,0x16,0x00,0x02,0xef,0x00,0x0e,0x16,0x00,
+0x17,0x0c,0x16,0x00,0x15,0xf1,0x16,0x00,0x1f,0x5f,0x16,0x00,0x02,0x44,0xdf,0xff,
+0xff,0xfa,0xa6,0x01,0x14,0xf2,0x15,0x00,0x24,0x06,0xff,0x0d,0x00,0x12,0x9f,0xb7,
+0x00,0x01,0x01,0x00,0x54,0x0e,0xff,0xff,0xff,0xa0,0xe3,0x00,0x21,0xfa,0x88,0x01,
+0x00,0x32,0x86,0x00,0x8f,0x05,0x01,0x02,0x16,0x00,0x03,0x01,0x00,0x20,0xfb,0x01,
+0x05,0x00,0x02,0x36,0x00,0x16,0x7f,0x16,0x00,0x13,0x09,0x05,0x01,0x09,0x6b,0x02,
+0x22,0xfb,0x2f,0x5c,0x01,0x0b,0x16,0x00,0x15,0xaf,0x57,0x00,0x07,0xb9,0x00,0x11,
+0xfb,0xf4,0x00,0x53,0x9c,0xef,0xfe,0xdb,0x73,0x94,0x00,0x12,0x07,0x9e,0x02,0x11,
+0xc5,0x0d,0x00,0x23,0x03,0xdf,0x28,0x00,0x19,0xb1,0x37,0x00,0x29,0xfe,0x20,0x29,
+0x01,0x41,0xe2,0x00,0x00,0x1e,0x17,0x00,0x30,0xde,0xff,0xff,0x02,0x02,0x10,0x00,
+0x6b,0x00,0x50,0xc4,0x00,0x00,0x15,0xdf,0xa5,0x02,0x00,0x3c,0x02,0x10,0xf9,0x3f,
+0x00,0x60,0x0b,0xff,0xff,0xff,0xd0,0x0a,0x4f,0x02,0x00,0x0e,0x00,0x10,0x01,0x12,
+0x01,0x14,0x0f,0x94,0x00,0x00,0x17,0x01,0x55,0xf7,0x4f,0xff,0xff,0xfd,0xa1,0x00,
+0x23,0xfa,0x8f,0x37,0x00,0xb8,0x00,0x00,0x2c,0xcc,0xcc,0xca,0xbf,0xff,0xff,0xf6,
+0x00,0x64,0x01,0x16,0xf4,0x0e,0x00,0x17,0xef,0x53,0x01,0x01,0x27,0x02,0x1f,0xf2,
+0x0e,0x00,0x21,0x0a,0x46,0x00,0x0a,0x62,0x00,0x09,0x7e,0x00,0x00,0x97,0x01,0x12,
+0xf8,0x0a,0x00,0x51,0x29,0x99,0x99,0x97,0x4f,0xf3,0x00,0x04,0xb6,0x00,0x00,0xc2,
+0x02,0x14,0x20,0xd2,0x00,0x24,0xf8,0x0a,0xe1,0x01,0x10,0x01,0xa9,0x01,0x00,0x0a,
+0x01,0x14,0xf7,0x0a,0x01,0x11,0xe0,0x5e,0x04,0x51,0xa3,0x00,0x00,0x05,0xdf,0x89,
+0x03,0x10,0x2f,0x3c,0x01,0x30,0xed,0xcd,0xff,0xc1,0x02,0x09,0x65,0x04,0x19,0xe2,
+0xf3,0x01,0x10,0x30,0x82,0x04,0x04,0x41,0x04,0x11,0xc2,0x69,0x00,0x12,0x19,0x0d,
+0x00,0x14,0xc6,0xa0,0x04,0x58,0x9f,0xff,0xff,0xfb,0x73,0x12,0x03,0x1a,0x90,0xb8,
+0x03,0x16,0x60,0x1c,0x00,0x46,0xcf,0xff,0xff,0xf5,0x1d,0x00,0x15,0x01,0xca,0x00,
+0x03,0x03,0x01,0x16,0xfe,0x0d,0x00,0x15,0x06,0x9c,0x01,0x03,0x03,0x05,0x19,0xf8,
+0x0e,0x00,0x18,0xd0,0x41,0x03,0x26,0xfb,0x10,0x0e,0x00,0x23,0xfe,0xc8,0x74,0x02,
+0x53,0x03,0x55,0x55,0x55,0x30,0x16,0x00,0x15,0x2e,0x25,0x01,0x01,0x9c,0x03,0x05,
+0x75,0x00,0x17,0x4f,0x67,0x01,0x17,0x6f,0x54,0x03,0x14,0x8f,0x27,0x03,0x02,0x57,
+0x01,0x16,0x40,0x97,0x01,0x07,0xa2,0x00,0x0d,0x01,0x00,0x07,0x9e,0x03,0x07,0x72,
+0x05,0x1f,0xfe,0x17,0x00,0x13,0x21,0xcb,0xbb,0x01,0x00,0x17,0xba,0xdb,0x03,0x00,
+0xad,0x02,0x04,0xda,0x00,0x0f,0x17,0x00,0x2a,0x11,0x98,0xe9,0x03,0x17,0x85,0xa1,
+0x00,0x25,0x90,0x0f,0x0b,0x00,0x1f,0xf9,0x17,0x00,0x14,0x0f,0x8a,0x00,0x32,0x0f,
+0x17,0x00,0x0f,0x22,0xfb,0xbb,0x01,0x00,0x1f,0xaf,0x42,0x01,0x1e,0x04,0x17,0x00,
+0x03,0x09,0x02,0x46,0x55,0x55,0x55,0x20,0x63,0x05,0x16,0xd1,0x67,0x03,0x16,0xe1,
+0xe5,0x01,0x04,0x8e,0x03,0x16,0x2f,0x7d,0x03,0x16,0x0c,0xa2,0x02,0x13,0x06,0x3e,
+0x03,0x02,0xaa,0x02,0x1f,0xf9,0xfa,0x01,0xff,0x94,0x46,0x02,0x88,0x87,0x10,0x1a,
+0x04,0x26,0xfd,0x10,0x33,0x04,0x25,0xfe,0x20,0x09,0x08,0x21,0xff,0xfe,0x1a,0x04,
+0x51,0x09,0xff,0xff,0xe3,0x6f,0xe3,0x04,0x00,0x22,0x05,0x10,0xd2,0x0f,0x04,0x11,
+0x40,0x02,0x02,0x11,0xc1,0x33,0x04,0x0a,0xef,0x08,0x0f,0xfa,0x01,0xff,0x8d,0x81,
+0x8d,0xeb,0x20,0x00,0x00,0x03,0xce,0xd5,0xb2,0x05,0x11,0xfd,0xaf,0x09,0x11,0xf5,
+0x69,0x00,0x11,0xf5,0xea,0x03,0x02,0xfb,0x09,0x31,0x50,0x00,0x08,0x83,0x08,0x11,
+0x09,0xae,0x09,0x11,0x3f,0xe3,0x01,0x9f,0x08,0xef,0xb2,0x00,0x00,0x00,0x4c,0xfd,
+0x60,0xee,0x01,0x10,0x1f,0x0f,0xa1,0x00,0x26,0x00,0xa8,0x08,0x07,0xe6,0x00,0x0f,
+0x42,0x01,0x3d,0x12,0xf9,0xcc,0x09,0x1f,0x50,0xe3,0x01,0x1f,0x07,0x17,0x00,0x0f,
+0xe3,0x01,0x49,0x08,0x17,0x00,0x16,0xbb,0xf7,0x02,0x0f,0x3c,0x03,0x23,0x82,0xe0,
+0x25,0x55,0x55,0x54,0x00,0x00,0x01,0x34,0x09,0x21,0x02,0xef,0x0f,0x08,0x12,0x03,
+0x49,0x0c,0x12,0x04,0xeb,0x07,0x12,0x06,0xe6,0x07,0x12,0x08,0xc3,0x05,0x18,0x09,
+0x30,0x0b,0x06,0xff,0x0c,0x14,0x80,0x5b,0x09,0x0f,0x0d,0x00,0xbd,0x11,0x03,0xfd,
+0x06,0x21,0x02,0xff,0xed,0x06,0x11,0xcf,0xe8,0x06,0x11,0x6f,0x2c,0x01,0x11,0x1f,
+0x10,0x03,0x11,0x0b,0x16,0x01,0x12,0x05,0xd4,0x06,0x13,0xef,0x3e,0x0c,0x1c,0x00,
+0x70,0x0a,0x0f,0x22,0x01,0xbf,0x50,0xff,0xff,0x80,0x00,0x00,0x71,0x00,0x00,0x00,
+0x17,0x88,0x72,0x00,0x01,0x00,0x41,0x2e,0xff,0xff,0xe2,0x09,0x00,0x50,0x4f,0xff,
+0xff,0xff,0xe3,0x09,0x00,0xff,0x16,0x5f,0xff,0xff,0xff,0xff,0xf4,0x00,0x00,0x00,
+0x7f,0xff,0xff,0x44,0xff,0xff,0xf5,0x00,0x00,0x9f,0xff,0xfe,0x30,0x03,0xef,0xff,
+0xf6,0x00,0xaf,0xff,0xfd,0x20,0x00,0x01,0xdf,0xff,0xf7,0x00,0x01,0x00,0x0b,0x51,
+0x08,0xff,0xff,0xff,0x80,0x0a,0x00,0x4f,0x8f,0xff,0xff,0xf8,0x13,0x00,0xff,0x21,
+0xf5,0x0c,0x07,0xde,0xb3,0x00,0x00,0x00,0x2b,0xed,0x70,0x7f,0xff,0xfe,0x10,0x00,
+0x01,0xef,0xff,0xf7,0xdf,0xff,0xff,0x70,0x00,0x06,0xff,0xff,0xfd,0x09,0x00,0xff,
+0x03,0x7f,0xff,0xff,0x20,0x00,0x01,0xff,0xff,0xf7,0x07,0xdf,0xc3,0x00,0x00,0x00,
+0x3c,0xfe,0x70,0x94,0x01,0x13,0x0f,0x09,0x00,0xff,0x17,0x20,0x4f,0xff,0x01,0x00,
+0x32,0xed,0xa7,0x20,0x41,0x01,0x23,0x04,0xff,0x01,0x00,0x25,0xd5,0x00,0x31,0x03,
+0x01,0x01,0x00,0x29,0xfc,0x30,0x1f,0x00,0x39,0xff,0xff,0x60,0x1f,0x00,0x00,0xb0,
+0x01,0x02,0x1f,0x00,0x31,0xfb,0xbb,0xcd,0x10,0x00,0x12,0x50,0x1f,0x00,0x50,0xfc,
+0x00,0x00,0x00,0x4b,0x10,0x00,0x12,0x10,0x1f,0x00,0x30,0xc0,0x00,0x00,0xd9,0x01,
+0x26,0xff,0xfa,0x1f,0x00,0x01,0x10,0x00,0x16,0xf2,0x1f,0x00,0x66,0x00,0x0b,0xff,
+0xff,0xff,0x90,0x1f,0x00,0x01,0x66,0x00,0x07,0x1f,0x00,0x21,0x00,0xef,0xbb,0x03,
+0x05,0x1f,0x00,0x11,0x0a,0x7e,0x00,0x05,0x1f,0x00,0x00,0xd3,0x03,0xa2,0xfa,0x25,
+0x55,0x7f,0xff,0xff,0xfd,0x55,0x55,0x40,0x5e,0x00,0x13,0xb7,0xa5,0x00,0x12,0xfe,
+0xfb,0x03,0x23,0xfc,0x7f,0x10,0x00,0x12,0xe0,0x57,0x00,0x17,0xd7,0x1f,0x00,0x12,
+0x4f,0x76,0x02,0x04,0x1f,0x00,0x11,0x05,0x57,0x00,0x06,0x5d,0x00,0x11,0x6f,0x76,
+0x00,0x05,0x7c,0x00,0x57,0x07,0xff,0xff,0xff,0xa0,0x1f,0x00,0x47,0xaf,0xff,0xff,
+0xf7,0x1f,0x00,0x56,0x0e,0xff,0xff,0xff,0x40,0x1f,0x00,0x00,0x09,0x00,0x17,0xf0,
+0x1f,0x00,0x11,0xcf,0x08,0x01,0x05,0x1f,0x00,0x00,0x77,0x00,0x15,0x30,0x1f,0x00,
+0x00,0x6b,0x00,0x25,0xff,0xb0,0x1f,0x00,0x22,0x04,0xbf,0x26,0x01,0x00,0x1f,0x00,
+0x40,0xfe,0xbb,0xbb,0xcf,0xa0,0x00,0x1a,0xf6,0x93,0x01,0x1a,0xf8,0x93,0x01,0x1a,
+0xf7,0xb2,0x01,0x19,0xd3,0xd1,0x01,0x27,0xfd,0x60,0xf0,0x01,0x35,0xfe,0xdb,0x73,
+0x43,0x03,0x20,0x02,0x32,0x17,0x00,0x21,0x44,0x30,0x0d,0x00,0x40,0x03,0xdf,0xff,
+0xd6,0x34,0x00,0x02,0xdd,0x00,0x94,0x3f,0xff,0xff,0xff,0xe8,0x56,0xef,0xff,0x90,
+0x86,0x01,0x01,0x01,0x00,0x10,0x40,0x0d,0x00,0x14,0x05,0x27,0x02,0x03,0x92,0x01,
+0x20,0xfb,0x20,0xf5,0x01,0x11,0xd1,0x0e,0x00,0x9f,0x0c,0xff,0xf3,0x00,0x00,0x3a,
+0xef,0xe8,0x00,0x01,0x00,0x1a,0x03,0xdf,0x00,0x02,0x77,0x00,0x10,0xfc,0xa5,0x00,
+0x18,0x10,0x0e,0x00,0x29,0xff,0x90,0x0e,0x00,0x19,0xf3,0x0e,0x00,0x19,0xfd,0x0e,
+0x00,0x29,0xff,0x70,0x0e,0x00,0x19,0xf1,0x0e,0x00,0x19,0xfa,0x0e,0x00,0x29,0xff,
+0x40,0x0e,0x00,0x19,0xd0,0x0e,0x00,0x19,0xf8,0x0e,0x00,0x25,0xff,0x20,0x0e,0x00,
+0x12,0xf7,0xa9,0x01,0x03,0x0e,0x00,0x21,0xf1,0xcf,0x50,0x06,0x04,0x0e,0x00,0x11,
+0x2f,0x57,0x02,0x04,0x0e,0x00,0x02,0x78,0x03,0x04,0x0e,0x00,0x00,0x44,0x01,0x16,
+0xf2,0x0e,0x00,0x00,0x9a,0x02,0x06,0x0e,0x00,0x10,0x0b,0x65,0x03,0x05,0x0e,0x00,
+0x55,0x02,0xff,0xff,0xff,0xe1,0x0e,0x00,0x00,0x2b,0x02,0x16,0xf9,0x0e,0x00,0x55,
+0x0d,0xff,0xff,0xff,0x7f,0x0e,0x00,0x13,0x04,0x8b,0x01,0x03,0xec,0x00,0x19,0xaf,
+0x0e,0x00,0x19,0x1f,0x0e,0x00,0x19,0x06,0x0e,0x00,0x29,0x00,0xcf,0x0e,0x00,0x19,
+0x3f,0x0e,0x00,0x19,0x09,0x0e,0x00,0x28,0x01,0xef,0x0e,0x00,0x29,0x00,0x6f,0x0e,
+0x00,0x19,0x0c,0x0e,0x00,0x19,0x02,0x0e,0x00,0x00,0xfd,0x05,0x12,0xfc,0x96,0x00,
+0x17,0xf9,0xee,0x01,0x12,0x0b,0xfb,0x02,0x05,0x01,0x00,0x12,0xdf,0x7d,0x01,0x04,
+0x01,0x00,0x14,0x1e,0x45,0x06,0x15,0x00,0x53,0x00,0x03,0xb1,0x04,0x04,0xd5,0x02,
+0x17,0xc0,0x0f,0x00,0x15,0x05,0x3b,0x02,0x02,0x01,0x00,0x3f,0x35,0x55,0x54,0x76,
+0x02,0x15,0x64,0x02,0x7a,0xde,0xff,0xdb,0x72,0x0e,0x00,0x21,0x04,0xcf,0x20,0x01,
+0x12,0xc5,0x0e,0x00,0x23,0x01,0xaf,0xfa,0x01,0x11,0xb1,0x0f,0x00,0x24,0x2d,0xff,
+0x36,0x04,0x14,0x30,0x11,0x01,0x02,0x01,0x00,0x13,0xe2,0x03,0x01,0x34,0xff,0xff,
+0xef,0x8d,0x02,0x10,0x7f,0x3f,0x02,0x32,0x20,0x00,0x27,0xb9,0x02,0x10,0x01,0x35,
+0x00,0x00,0xc0,0x00,0x11,0x1d,0xd3,0x03,0x13,0x08,0xd9,0x03,0x01,0x44,0x00,0x11,
+0xf9,0x34,0x04,0x15,0x80,0x56,0x01,0x01,0x86,0x01,0x16,0x10,0x4d,0x04,0x64,0x7f,
+0xff,0xff,0xfb,0x00,0x00,0x91,0x01,0x25,0x90,0xaf,0x19,0x01,0x10,0x06,0x85,0x02,
+0x02,0x7b,0x02,0x01,0xba,0x03,0x00,0xbf,0x04,0x14,0xef,0x19,0x03,0x01,0x32,0x01,
+0x13,0xf0,0x68,0x00,0x00,0x6a,0x00,0x0a,0x0f,0x00,0x10,0x00,0x9f,0x01,0x0e,0x0f,
+0x00,0x08,0x2d,0x00,0x0b,0x4b,0x00,0x1a,0xdf,0x69,0x00,0x0a,0x87,0x00,0x1b,0xc0,
+0xa5,0x00,0x0a,0xc3,0x00,0x16,0x50,0xe1,0x00,0x00,0x86,0x09,0x0a,0xff,0x00,0x16,
+0xfa,0x1d,0x01,0x12,0x1c,0xd7,0x03,0x10,0x7f,0x61,0x03,0x41,0x10,0x00,0x16,0xef,
+0x6a,0x05,0x02,0x59,0x01,0x33,0xfe,0xde,0xff,0x11,0x04,0x07,0x77,0x01,0x19,0xf3,
+0x95,0x01,0x29,0xff,0x30,0xb3,0x01,0x19,0xc2,0xd1,0x01,0x16,0xd5,0xef,0x01,0x48,
+0xdf,0xff,0xeb,0x83,0x01,0x02,0x28,0x06,0xff,0x4c,0x02,0x00,0x2f,0x03,0x26,0xfd,
+0x10,0x0f,0x00,0x14,0xaf,0x49,0x0a,0x05,0x3d,0x05,0x07,0xb5,0x02,0x12,0x0e,0x52,
+0x0a,0x04,0x01,0x00,0x13,0x9f,0x24,0x07,0x05,0x27,0x01,0x08,0xc2,0x02,0x11,0x03,
+0x9b,0x06,0x0f,0x94,0x02,0xff,0xff,0x14,0x28,0x02,0xdf,0x74,0x02,0x23,0x00,0x3e,
+0xdd,0x01,0x07,0xb0,0x09,0x05,0x76,0x02,0x00,0x9e,0x01,0x12,0x9f,0x7b,0x09,0x03,
+0xe5,0x09,0x11,0xf4,0xd3,0x0c,0x04,0x91,0x02,0x20,0xfe,0x20,0x8d,0x00,0x12,0x70,
+0x57,0x00,0x9f,0x88,0x88,0x71,0x00,0x00,0x01,0x78,0x88,0x82,0x98,0x07,0x1b,0x0f,
+0x94,0x02,0xff,0xe9,0x50,0x00,0x00,0x00,0x00,0x00,0xd1,0x00,0x00,0x00,0x00,0x3b,
+0xfe,0xb5,0x00,0x00,0x0a,0xff,0xf5,0x00,0x01,0x00,0x92,0x06,0xff,0xff,0xff,0xe7,
+0x20,0x5f,0xff,0xf3,0x0f,0x00,0x22,0x3f,0xff,0x01,0x00,0x12,0xe0,0x0f,0x00,0x13,
+0xbf,0x0f,0x00,0x11,0x70,0x0e,0x00,0x92,0x01,0xff,0xff,0xa5,0x6b,0xff,0xff,0xff,
+0xfb,0x1d,0x00,0xa2,0x03,0xff,0xfd,0x00,0x00,0x3b,0xff,0xff,0x90,0x00,0x1e,0x00,
+0x8f,0x44,0x43,0x00,0x00,0x00,0x13,0x30,0x00,0x01,0x00,0x22,0x64,0x02,0x7a,0xde,
+0xff,0xdb,0x72,0x0e,0x00,0x21,0x04,0xcf,0x77,0x00,0x13,0xc5,0x5a,0x00,0x13,0xaf,
+0x87,0x00,0x11,0xb1,0x0f,0x00,0x23,0x2d,0xff,0x01,0x00,0x20,0xfe,0x30,0x1d,0x00,
+0x24,0xef,0xff,0x01,0x00,0x51,0xe2,0x00,0x00,0x00,0x0c,0x0a,0x00,0x00,0x14,0x00,
+0x00,0x9e,0x00,0xb0,0x00,0x7f,0xff,0xff,0xff,0xf8,0x20,0x00,0x27,0xff,0xff,0xa8,
+0x00,0x10,0x01,0x35,0x00,0xb1,0x20,0x00,0x00,0x00,0x1d,0xff,0xff,0xff,0xf2,0x00,
+0x08,0x06,0x00,0x03,0x44,0x00,0x71,0xf9,0x00,0x0e,0xff,0xff,0xff,0x80,0x62,0x00,
+0x41,0x6f,0xff,0xff,0xff,0x0b,0x01,0x11,0x10,0x0f,0x00,0x00,0x19,0x00,0x25,0x40,
+0x7f,0xf8,0x00,0x10,0x09,0x4c,0x00,0x46,0xaf,0xff,0xff,0xf8,0x42,0x01,0x34,0xb0,
+0xcf,0xff,0x51,0x01,0x10,0x03,0x3e,0x01,0x24,0xef,0xff,0x51,0x01,0x54,0x02,0xff,
+0xff,0xff,0xf0,0x68,0x00,0x01,0x43,0x01,0x08,0x0f,0x00,0x5e,0x00,0xff,0xff,0xff,
+0xf1,0x0f,0x00,0x08,0x2d,0x00,0x0b,0x4b,0x00,0x1a,0xdf,0x69,0x00,0x0a,0x87,0x00,
+0x1b,0xc0,0xa5,0x00,0x0a,0xc3,0x00,0x16,0x50,0xe1,0x00,0x10,0x5f,0xe1,0x00,0x09,
+0xff,0x00,0x16,0xfa,0x1d,0x01,0x21,0x1c,0xff,0x73,0x00,0x00,0x3b,0x01,0x40,0xf7,
+0x10,0x00,0x16,0x4c,0x01,0x13,0xa0,0x59,0x01,0x21,0xfe,0xde,0x06,0x00,0x19,0x10,
+0x77,0x01,0x19,0xf3,0x95,0x01,0x29,0xff,0x30,0xb3,0x01,0x19,0xc2,0xd1,0x01,0x16,
+0xd5,0xef,0x01,0x44,0xdf,0xff,0xeb,0x83,0x0e,0x00,0x20,0x2b,0xfe,0x97,0x00,0x32,
+0x7d,0xfb,0x20,0x0f,0x00,0x40,0xef,0xff,0xf9,0x00,0x9e,0x00,0x12,0xe1,0x3b,0x00,
+0x00,0xac,0x00,0x00,0xc1,0x00,0x1f,0xf6,0x0f,0x00,0x01,0x20,0x00,0xdf,0x2d,0x00,
+0x14,0x07,0x2d,0x00,0x31,0x00,0x2a,0xed,0x4b,0x00,0x2f,0xeb,0x20,0x85,0x02,0xff,
+0xff,0x1f,0x12,0x40,0x07,0x00,0x00,0x39,0x00,0x12,0x8f,0xa0,0x00,0x72,0x4f,0xc0,
+0x00,0x00,0x8f,0xff,0x70,0x17,0x05,0x31,0xc0,0x00,0x8f,0x07,0x05,0x00,0x92,0x01,
+0x10,0xc0,0xd3,0x00,0x12,0x60,0x2d,0x05,0x21,0x80,0x6f,0x0c,0x00,0x10,0x3e,0x80,
+0x01,0x01,0xae,0x00,0x21,0x60,0x2e,0x0b,0x00,0x01,0x0c,0x00,0x12,0x7e,0x0b,0x00,
+0x22,0x00,0x8f,0x87,0x00,0x25,0xc0,0x00,0x0c,0x00,0x25,0xc0,0x00,0x0c,0x00,0x12,
+0xc0,0x79,0x00,0x52,0x9f,0xff,0xff,0xff,0xd1,0x0b,0x00,0x20,0x1d,0xff,0xec,0x01,
+0x06,0x0b,0x00,0x02,0x0c,0x00,0x16,0x1d,0xda,0x00,0x16,0x1c,0xe6,0x00,0x10,0x0c,
+0x73,0x02,0x11,0xbf,0x87,0x02,0x11,0x0c,0x7e,0x02,0x10,0xbf,0x41,0x01,0x12,0x0b,
+0x89,0x02,0x00,0x0c,0x00,0x13,0x22,0x94,0x02,0x51,0xcf,0xff,0xff,0xf6,0x03,0x0b,
+0x00,0x00,0x0c,0x00,0x61,0xf7,0x00,0x03,0xff,0xe3,0x00,0x0c,0x00,0x52,0xf7,0x00,
+0x00,0x03,0xe3,0xeb,0x01,0x1e,0xc7,0x19,0x03,0x04,0xd8,0x01,0x18,0xfe,0x0f,0x00,
+0x32,0x0d,0xff,0xf7,0x31,0x00,0x20,0x6a,0xde,0x41,0x01,0x12,0x4f,0x2f,0x06,0x22,
+0x03,0xbf,0x5f,0x01,0x12,0xbf,0x34,0x01,0x15,0x9f,0x22,0x03,0x17,0x00,0xb3,0x00,
+0x12,0xff,0x3b,0x00,0x19,0xdf,0xb9,0x01,0x11,0x0a,0x0a,0x00,0x14,0xee,0xd7,0x01,
+0x00,0x19,0x02,0x25,0xf9,0x30,0xf5,0x01,0x13,0xdf,0xf6,0x00,0x11,0x4f,0x2e,0x00,
+0x54,0x05,0xff,0xff,0xff,0xf4,0x43,0x00,0x32,0xfb,0x00,0x0b,0x24,0x00,0x21,0x00,
+0x07,0x43,0x00,0x23,0x20,0x0f,0x2c,0x00,0x30,0x2f,0xff,0xfe,0xb7,0x06,0x13,0x4f,
+0x7e,0x00,0x30,0xbf,0xff,0xa7,0x8b,0x01,0x10,0x7f,0x63,0x02,0x10,0x00,0x43,0x00,
+0x13,0x13,0xb8,0x02,0x11,0xf7,0x97,0x02,0x20,0xf6,0x00,0xd6,0x02,0x12,0xbf,0x54,
+0x04,0x40,0x9f,0xff,0xc0,0x00,0x95,0x02,0x02,0x4e,0x03,0x10,0x03,0x50,0x00,0x00,
+0xff,0x02,0x02,0x0f,0x00,0x10,0x0d,0xea,0x02,0x15,0xdf,0x0f,0x00,0x36,0x7f,0xff,
+0xe0,0x0f,0x00,0x00,0xbd,0x02,0x21,0x50,0x00,0x2d,0x00,0x01,0x4b,0x00,0x11,0x0b,
+0x07,0x03,0x00,0x4b,0x00,0x01,0x69,0x00,0x33,0x5f,0xff,0xf1,0x5d,0x03,0x01,0x87,
+0x00,0x32,0xef,0xff,0x70,0x3f,0x03,0x10,0xf0,0xa5,0x00,0x34,0x08,0xff,0xfd,0x3f,
+0x03,0x73,0x1f,0xff,0xff,0xff,0x6f,0xff,0xf3,0x47,0x04,0x32,0x80,0x0b,0xff,0x37,
+0x04,0x02,0x6f,0x02,0x25,0x30,0x05,0x52,0x01,0x11,0xcf,0x5d,0x04,0x00,0x06,0x01,
+0x13,0xf5,0x43,0x01,0x11,0xf6,0x24,0x01,0x00,0x6b,0x04,0x22,0x05,0xdf,0x59,0x02,
+0x11,0x09,0x2e,0x00,0x15,0xdd,0x39,0x02,0x04,0xd0,0x07,0x03,0xc0,0x03,0x15,0x7f,
+0x0f,0x00,0x19,0x50,0xc5,0x04,0x12,0xd3,0xbd,0x03,0x12,0xfc,0x40,0x03,0x31,0xe7,
+0x00,0x00,0x52,0x01,0x10,0xf3,0xef,0x01,0x24,0xec,0x84,0x1a,0x08,0x16,0xa0,0x11,
+0x02,0x00,0x95,0x05,0x0a,0x71,0x05,0x13,0x07,0xfa,0x02,0x06,0x08,0x04,0x15,0x60,
+0x0e,0x00,0x12,0x0b,0xe6,0x01,0x03,0x01,0x00,0x12,0x0c,0x94,0x01,0x15,0x00,0xfb,
+0x02,0x16,0xf4,0x0e,0x00,0x15,0x2e,0x89,0x08,0x03,0x9c,0x08,0x16,0x80,0x0e,0x00,
+0x3f,0x35,0x55,0x54,0xcf,0x05,0x0c,0x00,0x0d,0x01,0x15,0xfc,0xb5,0x04,0x15,0xe4,
+0x6b,0x03,0x4f,0x2f,0xff,0xff,0xfe,0x1b,0x00,0xff,0x05,0x00,0x90,0x02,0x55,0xd2,
+0xff,0xff,0xff,0xd0,0x40,0x01,0x14,0x1f,0xbe,0x05,0x10,0x07,0x69,0x03,0x13,0xdf,
+0xbf,0x03,0x00,0x77,0x02,0x15,0xf6,0xbb,0x05,0x10,0x8f,0x7a,0x03,0x12,0x2f,0x81,
+0x02,0x21,0x02,0xaf,0xfa,0x01,0x01,0x3a,0x02,0x22,0xcb,0xbd,0xe1,0x03,0x15,0x01,
+0xee,0x03,0x00,0x3e,0x03,0x15,0x02,0x67,0x02,0x10,0xf9,0x75,0x02,0x18,0xbf,0x17,
+0x04,0x22,0x00,0x6d,0x0d,0x00,0x13,0xa2,0x5e,0x06,0x69,0x7b,0xde,0xff,0xec,0x95,
+0x10,0xd2,0x01,0x26,0xfe,0x10,0x86,0x04,0x07,0x76,0x02,0x15,0x08,0x33,0x05,0x03,
+0xe2,0x00,0x15,0x50,0x35,0x00,0x14,0xcf,0xc0,0x0a,0x03,0x56,0x07,0x15,0x90,0x0d,
+0x00,0x27,0x1f,0xff,0xc6,0x02,0x4f,0x02,0x55,0x55,0x40,0x52,0x02,0xff,0xde,0x17,
+0x1c,0x35,0x02,0x28,0x00,0x1d,0x36,0x02,0x26,0x3e,0xff,0xb4,0x04,0x00,0xb7,0x00,
+0x14,0x9e,0x45,0x02,0x00,0x9e,0x06,0x24,0x60,0x2d,0x8b,0x04,0x10,0x7f,0x41,0x00,
+0x13,0x1c,0x54,0x02,0x9e,0x18,0x88,0x88,0x30,0x00,0x00,0x07,0x88,0x88,0x04,0x0d,
+0x0f,0x52,0x02,0xff,0xcd,0x50,0x95,0x10,0x00,0x00,0x00,0xc0,0x00,0x00,0x01,0xae,
+0xea,0x10,0x00,0x00,0x05,0xdf,0xc4,0x00,0x01,0x00,0x90,0xcf,0xff,0xfc,0x00,0x00,
+0x05,0xff,0xff,0xf3,0x0d,0x00,0xf0,0x08,0x2f,0xff,0xff,0xf2,0x00,0x00,0xbf,0xff,
+0xff,0x80,0x00,0x00,0x00,0x02,0xff,0xff,0xff,0x20,0x00,0x0b,0xff,0xff,0xf8,0x1b,
+0x00,0xa0,0x0c,0xff,0xff,0xc0,0x00,0x00,0x5f,0xff,0xff,0x30,0x0e,0x00,0xaf,0x19,
+0xee,0x91,0x00,0x00,0x00,0x5d,0xec,0x40,0x00,0x01,0x00,0x16,0x21,0x04,0xff,0x42,
+0x00,0x02,0x66,0x00,0x30,0xfe,0x4f,0xff,0x78,0x00,0x03,0x66,0x00,0x1f,0xe4,0x1b,
+0x00,0xff,0x05,0x85,0x3f,0xff,0xff,0xfd,0x2f,0xff,0xff,0xfd,0x40,0x01,0x51,0xc1,
+0xff,0xff,0xff,0xf1,0x0e,0x00,0x90,0x7f,0xff,0xff,0xfa,0x0d,0xff,0xff,0xff,0x70,
+0x0d,0x00,0x00,0x09,0x00,0x21,0x60,0x8f,0xaf,0x01,0x90,0x00,0x00,0x08,0xff,0xff,
+0xff,0xf2,0x02,0xff,0x13,0x00,0x90,0x00,0x00,0x2a,0xff,0xff,0xff,0xfb,0x00,0x0a,
+0x0e,0x00,0x50,0xfc,0xbb,0xdf,0xff,0xff,0xbf,0x01,0x24,0x1d,0xff,0x01,0x00,0x00,
+0xe7,0x01,0x15,0x2e,0x0d,0x00,0x54,0x90,0x00,0x00,0x00,0x1b,0x0d,0x00,0x01,0x58,
+0x00,0x21,0x06,0xdf,0x0c,0x00,0x22,0xfa,0x20,0xc2,0x01,0x68,0x37,0xbd,0xef,0xfe,
+0xc9,0x51,0xd4,0x01,0x4a,0x45,0x55,0x55,0x52,0xe2,0x01,0x15,0xd1,0x0f,0x00,0x00,
+0x96,0x00,0x26,0xfe,0x10,0x0f,0x00,0x11,0x8f,0x5c,0x02,0x04,0x01,0x00,0x00,0xa1,
+0x00,0x06,0x3d,0x02,0x00,0x5e,0x02,0x17,0xf5,0x58,0x00,0x13,0x6f,0x81,0x00,0x02,
+0x01,0x00,0x4f,0x01,0xff,0xff,0xf9,0x62,0x02,0x10,0x00,0xb8,0x02,0x16,0xff,0x8a,
+0x00,0x24,0xf5,0x2f,0xc7,0x00,0x00,0x5e,0x00,0x20,0xff,0xd0,0x05,0x01,0x14,0xe0,
+0x57,0x01,0x44,0xff,0x50,0x02,0xff,0x73,0x00,0x11,0xbf,0x7d,0x01,0x13,0xaf,0x83,
+0x01,0x00,0x18,0x00,0x11,0xf4,0x96,0x01,0x01,0xa0,0x00,0x12,0x09,0x8d,0x01,0x00,
+0x07,0x00,0x61,0xb0,0x00,0x00,0x00,0x1f,0xff,0x01,0x03,0x10,0x01,0x64,0x01,0x02,
+0xd4,0x00,0x13,0xfb,0xdc,0x00,0x53,0xfa,0x00,0x00,0x00,0xef,0x47,0x03,0x00,0x26,
+0x00,0x33,0x10,0x00,0x07,0x34,0x00,0x21,0x00,0x08,0x6a,0x01,0x13,0x0e,0xa0,0x01,
+0x01,0x3d,0x00,0x32,0xf0,0x00,0x5f,0x33,0x00,0x02,0xcb,0x01,0x34,0xf7,0x00,0xdf,
+0x1e,0x01,0x00,0x28,0x00,0x10,0xfe,0xc0,0x00,0x12,0xa0,0x0f,0x00,0x00,0x46,0x00,
+0x14,0x5b,0x3b,0x00,0x02,0x64,0x00,0x16,0xef,0x10,0x01,0x00,0x2a,0x01,0x05,0x14,
+0x02,0x02,0x3d,0x00,0x02,0xd7,0x01,0x02,0x01,0x00,0x11,0x06,0x0f,0x00,0x06,0x85,
+0x01,0x00,0xd0,0x01,0x16,0xf8,0x31,0x01,0x18,0x5f,0x3b,0x00,0x02,0x47,0x02,0x19,
+0x80,0x94,0x01,0x2f,0xff,0x60,0x0f,0x00,0x97,0x14,0xef,0xdf,0x01,0x03,0x44,0x01,
+0x05,0x23,0x00,0x0f,0x19,0x00,0x22,0x00,0x01,0x00,0x24,0xdb,0x73,0x52,0x01,0x00,
+0x01,0x00,0x24,0xfd,0x50,0x19,0x00,0x00,0x01,0x00,0x16,0xb1,0x19,0x00,0x00,0xf5,
+0x02,0x16,0xef,0x0d,0x00,0x10,0xc0,0x19,0x00,0x41,0x88,0x88,0x88,0x9d,0x47,0x03,
+0x03,0x64,0x00,0x54,0x04,0xef,0xff,0xff,0xfe,0x64,0x00,0x01,0x63,0x02,0x04,0x7d,
+0x00,0x00,0xe0,0x01,0x13,0x7e,0x7d,0x00,0x00,0x9a,0x02,0x14,0xf9,0x19,0x00,0x00,
+0x27,0x02,0x1e,0xae,0x19,0x00,0x02,0x32,0x00,0x13,0x8e,0x19,0x00,0x26,0x01,0xef,
+0x4b,0x00,0x10,0x03,0xde,0x01,0x00,0x7d,0x00,0x44,0x77,0x77,0x77,0x9c,0x7d,0x00,
+0x04,0x01,0x00,0x17,0xd0,0xaf,0x00,0x17,0xe2,0xaf,0x00,0x16,0xc2,0xc8,0x00,0x25,
+0xfe,0x70,0xe1,0x00,0x2e,0xdc,0x84,0x45,0x01,0x0f,0x5e,0x01,0x36,0x00,0x01,0x00,
+0x34,0x35,0x67,0x64,0x96,0x02,0x20,0x03,0xbf,0x9d,0x04,0x12,0x50,0xea,0x03,0x21,
+0xbf,0xff,0xab,0x04,0x01,0xed,0x02,0x04,0xa8,0x04,0x12,0xe1,0xa7,0x06,0x12,0xff,
+0x1b,0x00,0x03,0x01,0x01,0x02,0x01,0x00,0x12,0x60,0xa0,0x01,0x32,0xb3,0x02,0x6f,
+0x6c,0x03,0x11,0x4f,0x2d,0x05,0x11,0x03,0x61,0x03,0x00,0x95,0x03,0x12,0xf5,0xdf,
+0x03,0x11,0xf1,0xdf,0x03,0x15,0xf1,0x85,0x04,0x11,0xcf,0x20,0x00,0x21,0x00,0x9f,
+0x14,0x00,0x12,0xdf,0x0d,0x00,0x11,0xdf,0xaf,0x00,0x02,0x0d,0x00,0x12,0x03,0x0e,
+0x05,0x02,0x0d,0x00,0x12,0x0b,0x7d,0x03,0x02,0x0d,0x00,0x12,0x3f,0x7b,0x03,0x02,
+0x0d,0x00,0x12,0xaf,0xb4,0x03,0x01,0x0d,0x00,0x00,0xef,0x00,0x14,0xd0,0x0d,0x00,
+0x13,0x01,0xbf,0x03,0x02,0x1a,0x00,0x03,0xcf,0x05,0x05,0x27,0x00,0x18,0xf4,0x41,
+0x00,0x27,0xfe,0x30,0x5b,0x00,0x24,0xff,0xe3,0x0d,0x00,0x21,0x08,0xff,0x80,0x04,
+0x03,0x9c,0x00,0x20,0xaf,0xff,0x59,0x04,0x03,0x0d,0x00,0x20,0x09,0xff,0x58,0x05,
+0x03,0x0d,0x00,0x20,0x00,0x7f,0x6b,0x00,0x04,0x0d,0x00,0x10,0x07,0x97,0x04,0x04,
+0x0d,0x00,0x00,0x36,0x00,0x15,0xf7,0x0d,0x00,0x00,0xb9,0x00,0x04,0x0d,0x00,0x00,
+0xa0,0x04,0x15,0xfa,0x0d,0x00,0x13,0x5f,0x1a,0x00,0x90,0x01,0x71,0x00,0x00,0x02,
+0xef,0xff,0xff,0xf6,0x0d,0x00,0x50,0x04,0xff,0xc9,0x88,0xbf,0x1e,0x04,0x00,0x0d,
+0x00,0x01,0x8d,0x00,0x04,0x68,0x00,0x00,0x0f,0x01,0x05,0x82,0x00,0x03,0x3c,0x02,
+0x11,0xe3,0x9c,0x00,0x12,0x2f,0x2d,0x06,0x11,0x10,0x0d,0x00,0x73,0x05,0x8b,0xde,
+0xff,0xed,0xa7,0x10,0x8c,0x05,0x17,0xe1,0xaf,0x04,0x05,0xbb,0x04,0x23,0x08,0xff,
+0x4d,0x08,0x03,0xad,0x00,0x14,0xd0,0x0c,0x00,0x18,0x0b,0xa5,0x04,0x16,0xdf,0xfb,
+0x04,0x24,0x00,0x1e,0x19,0x07,0x00,0x45,0x03,0x3f,0x55,0x55,0x50,0x10,0x06,0x0c,
+0x64,0x05,0x9c,0xef,0xfe,0xc8,0x30,0x6c,0x00,0x00,0x3d,0x02,0x10,0x30,0x70,0x02,
+0x03,0xe4,0x02,0x12,0xf6,0x7c,0x07,0x02,0x01,0x00,0x12,0x50,0x1c,0x05,0x03,0x70,
+0x02,0x10,0x05,0x27,0x05,0x30,0x21,0x26,0xef,0x99,0x05,0x12,0x0a,0x1e,0x00,0x01,
+0xa2,0x07,0x43,0x0b,0xee,0xee,0xee,0x28,0x05,0x07,0xac,0x00,0x05,0x60,0x05,0x13,
+0x0a,0xa7,0x05,0x21,0x37,0xad,0x63,0x00,0x00,0x0c,0x00,0x14,0x5d,0x55,0x00,0x01,
+0x49,0x09,0x05,0x0c,0x00,0x16,0xcf,0x0c,0x00,0x10,0x07,0x6c,0x00,0x12,0x30,0x3c,
+0x00,0x12,0x0e,0x12,0x01,0x01,0x0c,0x00,0x12,0x3f,0x20,0x06,0x01,0x0c,0x00,0x12,
+0x5f,0xae,0x00,0x01,0x0c,0x00,0x10,0x6f,0x95,0x00,0x02,0xf8,0x04,0x12,0x20,0xef,
+0x02,0x01,0x1f,0x02,0x10,0x20,0x74,0x06,0x31,0xd6,0x44,0x8e,0x54,0x00,0x26,0x0b,
+0xff,0x60,0x00,0x16,0x02,0x0c,0x00,0x32,0x40,0x00,0x4f,0xbc,0x01,0x01,0x3a,0x03,
+0x11,0x03,0xf1,0x00,0x12,0x73,0xeb,0x02,0x57,0x05,0xad,0xff,0xeb,0x71,0xb3,0x03,
+0x03,0xe8,0x06,0x04,0x9b,0x01,0x17,0xf5,0xe2,0x07,0x16,0x70,0xd4,0x03,0x05,0xa6,
+0x01,0x15,0x9f,0xaf,0x06,0x00,0x3c,0x03,0x17,0xfc,0x51,0x06,0x05,0x10,0x08,0x4f,
+0x15,0x55,0x55,0x10,0xb0,0x01,0xff,0x46,0x17,0x09,0x13,0x07,0x00,0xf6,0x03,0x03,
+0x0b,0x00,0x16,0x1c,0x0c,0x08,0x52,0x01,0xdf,0xff,0xfb,0xdf,0x7b,0x03,0x00,0xf2,
+0x09,0x22,0xa0,0x1c,0xb1,0x01,0x20,0x03,0xef,0xc4,0x01,0x11,0xaf,0xc5,0x08,0x9e,
+0x08,0x99,0x99,0x60,0x00,0x00,0x07,0x99,0x99,0x57,0x03,0x0f,0xb0,0x01,0xff,0x3c,
+0x40,0x01,0x9e,0xfd,0x81,0xf1,0x00,0x22,0xb0,0x00,0x7e,0x0b,0x31,0x93,0x02,0xcf,
+0x7c,0x0b,0x15,0xdf,0x47,0x00,0x24,0x00,0x05,0x74,0x08,0x01,0x02,0x01,0x31,0xfd,
+0x55,0x8f,0x01,0x06,0x00,0x1a,0x01,0x42,0xf3,0x00,0x01,0x8e,0x20,0x07,0x20,0x04,
+0x44,0xa0,0x0a,0x15,0x24,0x1d,0x05,0x0f,0xb0,0x01,0xff,0x40,0x50,0x00,0xef,0xff,
+0xff,0xe0,0xfa,0x14,0x00,0x00,0x8e,0xfb,0x20,0x00,0x00,0x03,0xcf,0xd6,0x00,0x00,
+0x00,0x08,0xff,0xff,0xe1,0x00,0x00,0x2f,0xff,0xff,0x60,0x00,0x00,0x0e,0xff,0xff,
+0xf5,0x00,0x00,0x8f,0xff,0xff,0xc0,0x0c,0x00,0x08,0x24,0x00,0x30,0x00,0x7d,0xeb,
+0x3c,0x00,0x3f,0xce,0xd6,0x00,0x01,0x00,0x09,0x81,0x05,0x9c,0xef,0xfe,0xc8,0x30,
+0x00,0x00,0x61,0x00,0x00,0x01,0x00,0x10,0xfc,0x0d,0x00,0x31,0x03,0xef,0xff,0x01,
+0x00,0x21,0xf6,0x00,0x4e,0x00,0x02,0x01,0x00,0x44,0x50,0x00,0x00,0xdf,0x0c,0x00,
+0xf2,0x00,0xe1,0x00,0x05,0xff,0xff,0xff,0xf8,0x21,0x26,0xef,0xff,0xff,0xf7,0x00,
+0x0a,0x1e,0x00,0xf4,0x01,0x4f,0xff,0xff,0xfc,0x00,0x0b,0xee,0xee,0xee,0x00,0x00,
+0x00,0x0d,0xff,0xff,0xff,0x64,0x00,0x53,0x0b,0xff,0xff,0xff,0x10,0x0c,0x00,0x00,
+0x2b,0x00,0x61,0x20,0x00,0x00,0x00,0x37,0xad,0x63,0x00,0x00,0x0c,0x00,0x14,0x5d,
+0x55,0x00,0x11,0x20,0x2a,0x00,0x04,0x0c,0x00,0x16,0xcf,0x0c,0x00,0x10,0x07,0x6c,
+0x00,0x12,0x30,0x3c,0x00,0x53,0x0e,0xff,0xff,0xff,0x30,0x48,0x00,0x44,0x3f,0xff,
+0xff,0xfa,0x54,0x00,0x12,0x5f,0xae,0x00,0x01,0x0c,0x00,0x10,0x6f,0x95,0x00,0x30,
+0x00,0x00,0x0c,0x0c,0x00,0x80,0x4f,0xff,0xff,0xfd,0x00,0x00,0x00,0xaf,0x0c,0x00,
+0x71,0x1f,0xff,0xff,0xff,0xd6,0x44,0x8e,0x54,0x00,0x26,0x0b,0xff,0x60,0x00,0x16,
+0x02,0x0c,0x00,0x31,0x40,0x00,0x4f,0x08,0x00,0x20,0xfe,0xff,0x45,0x01,0x11,0x03,
+0xf1,0x00,0xf0,0x02,0x73,0xff,0xff,0xff,0x90,0x00,0x00,0x05,0xad,0xff,0xeb,0x71,
+0x00,0xef,0xff,0xff,0xe0,0xc9,0x00,0x44,0x06,0xcf,0xfc,0x50,0xe1,0x00,0x63,0xbf,
+0xff,0xff,0xf9,0x00,0x00,0x45,0x01,0x42,0xc5,0x6d,0xff,0x70,0x0c,0x00,0x62,0x0f,
+0xfd,0x00,0x01,0xef,0xe0,0x0c,0x00,0x67,0x3f,0xf7,0x00,0x00,0x9f,0xf1,0x0c,0x00,
+0x12,0xf2,0x0c,0x00,0x44,0x1f,0xfc,0x00,0x00,0x24,0x00,0x63,0x09,0xff,0xb4,0x5c,
+0xff,0x80,0x49,0x00,0x12,0xcf,0xdc,0x00,0x01,0x01,0x00,0x4e,0x07,0xcf,0xfc,0x60,
+0xc6,0x01,0x0f,0xd4,0x01,0xff,0x3f,0xd2,0x04,0x8c,0xef,0xfe,0xda,0x60,0x00,0x00,
+0x05,0x9d,0xef,0xed,0xa6,0xdd,0x00,0x11,0x6e,0x39,0x00,0x13,0xf8,0x08,0x00,0x00,
+0x9c,0x01,0x13,0x01,0xc4,0x00,0x22,0xfc,0xbf,0x08,0x00,0x6a,0xc1,0x00,0x00,0x01,
+0xdf,0xff,0x01,0x00,0x12,0xc0,0x9c,0x00,0x09,0x01,0x00,0x11,0x80,0x75,0x01,0x22,
+0xfc,0x98,0x37,0x00,0x30,0xea,0x89,0xdf,0x41,0x01,0x00,0x05,0x01,0x52,0xd2,0x00,
+0x00,0x2e,0xff,0x8e,0x00,0x10,0x8f,0x6b,0x00,0xc2,0x9f,0xff,0xff,0xf3,0x00,0x00,
+0x00,0x5f,0xff,0xff,0xff,0xb0,0x08,0x02,0x13,0xc0,0x68,0x01,0x50,0x01,0xff,0xff,
+0xff,0xf2,0x0f,0x02,0x07,0x88,0x01,0x12,0x0f,0x0b,0x01,0x22,0x00,0x5f,0x1b,0x00,
+0x50,0x03,0x68,0x9a,0xaa,0xaa,0x60,0x00,0x41,0xaa,0xaa,0xaa,0xac,0x56,0x01,0x1c,
+0x03,0x8a,0x00,0x11,0xf4,0x50,0x01,0x0a,0x01,0x00,0x2d,0x50,0x0c,0x13,0x00,0x3e,
+0xf5,0x08,0xff,0x27,0x00,0x00,0x05,0x00,0x20,0x83,0x10,0x75,0x00,0x13,0xfb,0x81,
+0x00,0x00,0x5b,0x01,0x10,0xfe,0xfd,0x01,0x13,0xff,0x18,0x03,0x00,0x1b,0x03,0x42,
+0xff,0xff,0xff,0x70,0x9c,0x00,0x14,0xff,0x24,0x03,0x12,0x6f,0xcb,0x01,0x10,0x00,
+0x87,0x01,0x11,0x10,0xcd,0x00,0x23,0x00,0x05,0xe2,0x00,0x50,0x7f,0xff,0xff,0xff,
+0xfd,0xa2,0x02,0x30,0x4a,0xf2,0x00,0xce,0x01,0x32,0xa3,0x00,0x27,0x51,0x01,0x8c,
+0xd9,0x78,0x8b,0xef,0xff,0x80,0x00,0xbf,0x87,0x00,0x34,0xfe,0x00,0x03,0x0b,0x00,
+0x15,0xec,0xaf,0x00,0x23,0x00,0x05,0x0a,0x00,0x14,0xd2,0xdf,0x00,0x23,0xfd,0x30,
+0xec,0x01,0x42,0xfe,0x70,0x00,0x05,0x52,0x00,0x01,0x0c,0x05,0x50,0x49,0xce,0xff,
+0xdc,0x84,0x09,0x00,0x52,0x48,0xcd,0xff,0xed,0xa7,0x28,0x03,0x61,0x02,0x7b,0xdf,
+0xfe,0xc9,0x40,0x0b,0x00,0x11,0x2a,0x2a,0x00,0x13,0xd4,0xdc,0x00,0x02,0xff,0x01,
+0x02,0x8f,0x01,0x03,0x0c,0x00,0x16,0x2f,0x4a,0x01,0x15,0x0c,0xd3,0x01,0x21,0xd0,
+0x03,0x11,0x00,0x20,0x00,0x3e,0x75,0x01,0x12,0xaf,0xed,0x00,0x50,0x3f,0xff,0xff,
+0xf7,0x0e,0xaf,0x00,0x02,0xc7,0x01,0x50,0xa2,0xff,0xff,0xff,0xa0,0x94,0x03,0x42,
+0xee,0xee,0xea,0x4f,0xce,0x02,0x01,0xae,0x03,0x01,0x96,0x02,0x05,0x26,0x01,0x17,
+0xf5,0x45,0x01,0x04,0x3d,0x01,0x16,0x5f,0x17,0x00,0x13,0x04,0x5c,0x01,0x12,0x00,
+0xc6,0x03,0x11,0xf9,0x4b,0x01,0x72,0x11,0x11,0x10,0xef,0xff,0xff,0xd0,0x2b,0x03,
+0x21,0xfb,0x0a,0xf3,0x02,0x10,0x00,0xd6,0x02,0x22,0x90,0x3f,0x9e,0x01,0x10,0xbf,
+0x41,0x00,0x00,0xb9,0x02,0x30,0xa7,0x69,0xef,0x91,0x00,0x16,0x02,0xd3,0x01,0x05,
+0x38,0x01,0x00,0x9c,0x00,0x04,0x0c,0x00,0x10,0x90,0x13,0x01,0x11,0xaf,0x45,0x01,
+0x02,0x84,0x00,0x56,0x27,0xff,0xff,0xff,0x94,0xfb,0x03,0x04,0xa5,0x04,0x00,0x64,
+0x00,0x13,0xe6,0x0b,0x00,0x21,0x1a,0xcf,0x01,0x01,0x05,0x9b,0x00,0x16,0xb0,0x24,
+0x00,0x14,0xfd,0x0b,0x00,0x15,0x7f,0xcd,0x02,0x00,0xdf,0x00,0x16,0xf7,0xf6,0x00,
+0x16,0xfd,0xf6,0x00,0x24,0xfa,0x10,0xf6,0x00,0x22,0xec,0x82,0xfe,0x04,0x16,0xff,
+0x03,0x03,0x23,0x00,0x9f,0x48,0x02,0x04,0x78,0x04,0x26,0x10,0x00,0x30,0x05,0x05,
+0x72,0x00,0x16,0x1d,0x30,0x01,0x33,0x00,0x01,0xef,0x71,0x02,0x01,0x7a,0x05,0x02,
+0xdb,0x00,0x02,0xf3,0x01,0x3f,0x55,0x55,0x40,0x4a,0x05,0x0d,0x52,0x5a,0xde,0xfe,
+0xda,0x61,0x0b,0x00,0x34,0x7e,0xff,0xff,0x7b,0x01,0x13,0x1c,0x02,0x04,0x16,0x10,
+0xfb,0x03,0x00,0x7d,0x01,0x05,0x44,0x03,0x12,0xfa,0xd4,0x02,0x02,0xe4,0x03,0x10,
+0x40,0x24,0x01,0x12,0xf8,0xf1,0x00,0x22,0xb0,0x06,0x03,0x02,0x00,0xe9,0x03,0x22,
+0xf0,0x0b,0x36,0x05,0x00,0x2b,0x01,0x20,0xf4,0x0f,0x66,0x05,0x02,0x32,0x03,0xe6,
+0xf7,0x2f,0xff,0xff,0xfe,0xaa,0xaa,0xaa,0xaa,0xaf,0xff,0xff,0xf9,0x3f,0xf5,0x02,
+0x26,0xfa,0x4f,0x0c,0x00,0x18,0xfb,0x0c,0x00,0x17,0x3f,0x0c,0x00,0x17,0x2f,0x35,
+0x06,0x13,0x0f,0x7a,0x02,0x13,0x00,0x36,0x05,0x12,0x60,0x76,0x03,0x01,0x4f,0x01,
+0x11,0xe2,0x26,0x01,0x11,0x90,0x52,0x04,0x73,0xfe,0x50,0x00,0x00,0x06,0xef,0xf7,
+0x88,0x03,0x21,0x98,0x9b,0x2b,0x00,0x06,0x4a,0x05,0x17,0xe0,0xdf,0x04,0x25,0x40,
+0x00,0x3c,0x04,0x10,0xe3,0x42,0x00,0x15,0x4c,0x1f,0x03,0x00,0xfe,0x05,0x45,0xbd,
+0xff,0xfd,0xa5,0x3a,0x01,0x03,0x79,0x02,0x01,0x01,0x00,0x12,0xdf,0xd2,0x04,0x04,
+0xcc,0x01,0x16,0x40,0x24,0x02,0x17,0xf6,0x42,0x07,0x16,0x70,0x10,0x03,0x14,0xf9,
+0x17,0x00,0x17,0x1e,0xd5,0x01,0x4f,0x25,0x55,0x55,0x00,0xb0,0x01,0xff,0x46,0x16,
+0x0b,0x96,0x01,0x26,0x01,0xcf,0x3d,0x03,0x24,0x2d,0xff,0x9c,0x04,0x00,0x3e,0x08,
+0x44,0xfa,0xef,0xff,0xf7,0xf3,0x05,0x22,0x80,0x2d,0x05,0x04,0x10,0x05,0xc4,0x01,
+0x21,0x01,0xcf,0xb2,0x01,0x9e,0x19,0x99,0x99,0x40,0x00,0x00,0x08,0x99,0x99,0x57,
+0x03,0x0f,0xb0,0x01,0xff,0x3b,0x92,0x01,0x9e,0xea,0x10,0x00,0x00,0x05,0xdf,0xc4,
+0xb9,0x01,0x11,0xc0,0x91,0x01,0x20,0x30,0x00,0x3c,0x07,0x11,0xf3,0x79,0x08,0x1a,
+0x90,0x0c,0x00,0x08,0x24,0x00,0x03,0x3c,0x00,0x2f,0xce,0xc4,0x98,0x01,0xff,0x40,
+0x12,0x09,0xe4,0x00,0x12,0x0b,0x30,0x00,0x12,0x0c,0xd4,0x06,0x12,0x1d,0x27,0x00,
+0x12,0x2e,0x02,0x05,0x12,0x3f,0xc9,0x06,0x12,0x5f,0x50,0x01,0x3c,0x35,0x55,0x54,
+0x78,0x01,0x11,0xdf,0x45,0x09,0x12,0x0d,0xc2,0x00,0x0f,0x0d,0x00,0x88,0x02,0xb2,
+0x07,0x11,0x1e,0xcc,0x09,0x11,0x0a,0xea,0x05,0x12,0x04,0xc3,0x0b,0x11,0xdf,0xb5,
+0x08,0x11,0x8f,0x76,0x01,0x11,0x3f,0x23,0x04,0x0e,0x67,0x07,0x0f,0xe7,0x00,0x93,
+0x50,0xff,0xfe,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x1d,0xff,0xfe,0x30,0x00,0x01,
+0x00,0x41,0x2e,0xff,0xff,0xff,0x0a,0x00,0xf0,0x0d,0x4f,0xff,0xff,0xff,0xff,0x40,
+0x00,0x00,0x00,0x5f,0xff,0xff,0x9f,0xff,0xff,0x50,0x00,0x00,0x7f,0xff,0xff,0x50,
+0x3e,0xff,0xff,0x60,0x00,0x9f,0x2d,0x00,0xb1,0x1d,0xff,0xff,0x70,0x28,0x88,0x88,
+0x20,0x00,0x00,0x17,0x06,0x00,0x0f,0x01,0x00,0x0a,0x41,0xdf,0xff,0xff,0xe0,0x09,
+0x00,0x4f,0x0d,0xff,0xff,0xfe,0x13,0x00,0xd4,0xf1,0x08,0x02,0xbe,0xe9,0x00,0x00,
+0x00,0x07,0xdf,0xc3,0x00,0xdf,0xff,0xfa,0x00,0x00,0x07,0xff,0xff,0xf1,0x4f,0xff,
+0xff,0xf0,0x29,0x00,0x41,0x74,0xff,0xff,0xff,0x29,0x00,0x51,0xf7,0x0d,0xff,0xff,
+0xa0,0x5b,0x01,0xaf,0x10,0x1a,0xed,0x80,0x00,0x00,0x00,0x7d,0xeb,0x30,0x43,0x01,
+0xf6,0x00,0x01,0x00,0x17,0x56,0x5b,0x02,0x35,0x0d,0xff,0xe8,0x0e,0x00,0x90,0x04,
+0xff,0xff,0xff,0xa2,0x00,0x00,0x06,0xa0,0x0d,0x00,0x70,0xaf,0xff,0xff,0xff,0xf9,
+0x10,0x2c,0xa5,0x02,0x20,0x00,0x1f,0xb8,0x02,0x43,0xfe,0x9f,0xff,0xfe,0x25,0x00,
+0x00,0x01,0x00,0x11,0xfc,0x37,0x00,0x11,0x5a,0x0c,0x00,0x12,0xf6,0x40,0x00,0x20,
+0x02,0xaf,0x0d,0x00,0x12,0x80,0x0d,0x00,0x20,0x01,0xcf,0x0d,0x00,0x11,0x50,0x0c,
+0x00,0x21,0x05,0xef,0x27,0x00,0x01,0x32,0x00,0x40,0x09,0xff,0xff,0xd9,0x3f,0x00,
+0x12,0x00,0x11,0x03,0x61,0x90,0x08,0xff,0xff,0xff,0xf5,0x0d,0x00,0x84,0x9d,0x30,
+0x00,0x0c,0xff,0xff,0xff,0xd0,0x8f,0x00,0x13,0x2f,0x2d,0x03,0x90,0x00,0x00,0x12,
+0x20,0x00,0x9f,0xff,0xff,0xfa,0x56,0x00,0x61,0x7c,0xff,0xff,0xfc,0x62,0xff,0xf4,
+0x01,0x11,0x07,0x55,0x00,0x11,0xde,0x5d,0x03,0x24,0x09,0xff,0x01,0x00,0x45,0xf7,
+0x00,0x08,0xff,0x01,0x00,0x26,0x90,0x04,0x0c,0x00,0x20,0xfb,0x00,0x92,0x00,0x40,
+0x93,0x00,0x15,0xbf,0x65,0x00,0x13,0x3f,0x9d,0x00,0x40,0x6f,0xff,0xff,0xfd,0x31,
+0x00,0x01,0xf4,0x00,0x80,0xef,0xff,0xff,0xe0,0xbf,0xff,0xff,0xf3,0x0c,0x00,0x51,
+0x0e,0xff,0xff,0xfe,0x0e,0x53,0x02,0x03,0x19,0x00,0x43,0xff,0xff,0xff,0xc0,0x19,
+0x00,0x24,0xfd,0x0f,0xc1,0x00,0x43,0xff,0xff,0xff,0xb0,0xb4,0x00,0x00,0xb0,0x00,
+0x23,0xf8,0x0d,0x32,0x00,0x10,0x07,0x5f,0x00,0x12,0xaf,0xda,0x00,0x00,0x83,0x01,
+0x32,0xf0,0x05,0xff,0x88,0x01,0x10,0x6f,0xc8,0x00,0x00,0x58,0x00,0x11,0xc1,0x0c,
+0x00,0x21,0xff,0x30,0x06,0x00,0x30,0xfb,0x89,0xdf,0xae,0x00,0x33,0x00,0x00,0xbf,
+0xae,0x00,0x00,0x52,0x00,0x23,0x01,0xdf,0x0c,0x00,0x10,0xe2,0xf9,0x00,0x03,0x1a,
+0x00,0x11,0xc2,0x77,0x00,0x11,0x6e,0x0c,0x00,0x13,0x70,0xb7,0x01,0x43,0x9c,0xef,
+0xfd,0xa6,0x0b,0x00,0x30,0xcf,0xeb,0x50,0x45,0x00,0x12,0x40,0x82,0x00,0x56,0xd6,
+0x10,0x5f,0xff,0xf2,0xb3,0x01,0x53,0xfd,0x00,0x00,0x00,0xcf,0x0c,0x00,0x10,0x60,
+0xb0,0x00,0x30,0xf9,0x46,0xbf,0xc1,0x00,0x30,0x00,0x00,0x04,0xcf,0x00,0x12,0x3b,
+0xbc,0x01,0x8f,0x14,0x44,0x20,0x00,0x00,0x01,0x33,0x00,0x01,0x00,0x12,0x10,0x8f,
+0xaa,0x00,0x51,0x49,0xde,0xfe,0xc7,0x10,0x77,0x01,0x21,0x02,0xcf,0x5c,0x00,0x00,
+0x17,0x00,0x13,0xf4,0x68,0x00,0x07,0x8e,0x01,0x25,0x10,0x8f,0x0b,0x00,0x11,0xf8,
+0x17,0x00,0x30,0xea,0x99,0xdf,0xeb,0x00,0x11,0x8f,0xfc,0x00,0x00,0xb1,0x03,0x22,
+0xff,0x08,0x0b,0x00,0x00,0xa7,0x00,0x22,0xf3,0x8f,0x8a,0x01,0x00,0x13,0x00,0x12,
+0x48,0x42,0x05,0x00,0x2c,0x01,0x13,0xf5,0x17,0x00,0x5f,0x06,0xff,0xff,0xff,0x58,
+0x17,0x00,0x99,0x01,0xdd,0x01,0x15,0xf8,0x3a,0x01,0x13,0xcf,0x68,0x02,0x01,0x2c,
+0x03,0x13,0xdf,0x5c,0x02,0x01,0x46,0x03,0x15,0xef,0xda,0x01,0x34,0x00,0x00,0x03,
+0x37,0x03,0x03,0xa0,0x03,0x15,0xfb,0x40,0x00,0x14,0x06,0x37,0x03,0x01,0x1a,0x00,
+0x3f,0x55,0x55,0x30,0xab,0x01,0x0d,0x62,0x01,0x6a,0xdf,0xfe,0xda,0x61,0x0c,0x00,
+0x02,0x95,0x01,0x20,0xf9,0x10,0x0c,0x00,0x12,0x3e,0x92,0x01,0x01,0xac,0x06,0x13,
+0x3f,0xa0,0x01,0x00,0x41,0x02,0x14,0x1e,0x0c,0x00,0x40,0xfe,0x20,0x00,0x0a,0x07,
+0x00,0x21,0xa8,0xae,0x46,0x03,0x10,0x02,0x3a,0x00,0x02,0x43,0x00,0x14,0xf4,0x97,
+0x03,0x10,0x09,0x42,0x03,0x00,0xd6,0x02,0x00,0x52,0x00,0x10,0x0f,0x09,0x02,0x03,
+0x2e,0x03,0x00,0x47,0x04,0x23,0xf3,0x4f,0xf8,0x00,0x00,0x12,0x01,0x12,0x66,0x7c,
+0x02,0x01,0x0c,0x07,0x23,0xf8,0x7f,0xc4,0x00,0x00,0xe6,0x00,0x13,0x86,0x2e,0x04,
+0x00,0x84,0x00,0x23,0xf8,0x5f,0x54,0x04,0x00,0xba,0x02,0x13,0x74,0x54,0x04,0x00,
+0x45,0x01,0x23,0xf6,0x1f,0x03,0x01,0x10,0x0a,0x59,0x01,0x43,0xdf,0xff,0xff,0xf1,
+0x9e,0x03,0x11,0xf0,0x82,0x00,0x02,0x91,0x02,0x11,0xfb,0x3a,0x04,0x12,0x80,0x51,
+0x02,0x11,0x40,0xc9,0x04,0x31,0xe9,0x89,0xdf,0x91,0x00,0x24,0x01,0xef,0xd5,0x00,
+0x12,0xf2,0x76,0x00,0x01,0x01,0x00,0x13,0xf4,0x76,0x01,0x00,0x01,0x00,0x11,0xe3,
+0x2b,0x01,0x02,0xa9,0x02,0x12,0x91,0x2d,0x01,0x65,0x16,0xad,0xef,0xed,0xb6,0x10,
+0x48,0x01,0x26,0x07,0xff,0xad,0x01,0x00,0xe7,0x00,0x14,0xd1,0x19,0x00,0x12,0xbf,
+0xaa,0x03,0x01,0x01,0x00,0x17,0x5f,0xde,0x01,0x12,0x1e,0x62,0x00,0x13,0x00,0xfe,
+0x04,0x17,0xf5,0xdc,0x01,0x15,0xf7,0x56,0x00,0x4f,0x35,0x55,0x54,0x00,0xc2,0x01,
+0xff,0x54,0x45,0x02,0xdf,0xff,0xd2,0x83,0x01,0x16,0xef,0xb4,0x01,0x15,0x04,0x3d,
+0x00,0x01,0xe8,0x00,0x13,0xf9,0xb6,0x01,0x00,0xf0,0x01,0x23,0xf4,0x04,0x0d,0x00,
+0x10,0x09,0x22,0x00,0x21,0x03,0xef,0xf4,0x00,0xae,0x03,0x99,0x99,0x92,0x00,0x00,
+0x02,0x99,0x99,0x91,0x2b,0x05,0x0f,0xc2,0x01,0xff,0x4b,0x61,0x4b,0xfe,0xb5,0x00,
+0x00,0x0b,0x91,0x01,0x00,0x5f,0x00,0x32,0xfd,0x61,0x05,0x24,0x05,0x01,0x5e,0x0b,
+0x03,0x67,0x07,0x00,0x49,0x08,0x04,0x9a,0x08,0x51,0x01,0xff,0xff,0x94,0x6b,0x37,
+0x01,0x01,0x25,0x00,0x42,0xc0,0x00,0x03,0xbf,0x0c,0x01,0x7e,0x01,0x44,0x43,0x00,
+0x00,0x00,0x13,0x3a,0x05,0x0f,0xc2,0x01,0xff,0x4d,0x20,0x2b,0xfe,0x8a,0x00,0x32,
+0x8e,0xfb,0x20,0x1d,0x05,0x10,0x90,0x70,0x00,0x51,0xfe,0x10,0x00,0x00,0x05,0x3d,
+0x09,0x12,0x0e,0xcf,0x00,0x11,0x5f,0xe4,0x09,0x10,0xef,0xcf,0x00,0x00,0x71,0x00,
+0x11,0xf8,0x2c,0x01,0x11,0xe1,0x04,0x0c,0x10,0xd7,0x96,0x03,0x2f,0xde,0xb2,0xa9,
+0x01,0xff,0x49,0x50,0xb6,0x10,0x00,0x00,0x00,0x11,0x00,0x01,0x00,0x25,0x10,0x00,
+0x01,0x00,0x35,0x08,0xff,0xf9,0x0e,0x00,0x44,0x0b,0xff,0xff,0xfc,0x0c,0x00,0x54,
+0x02,0xff,0xff,0xff,0xf4,0x0d,0x00,0x53,0x3f,0xff,0xff,0xff,0x50,0x0c,0x00,0x54,
+0x01,0xff,0xff,0xff,0xf3,0x19,0x00,0x45,0x0a,0xff,0xff,0xfb,0x4b,0x00,0x4f,0x07,
+0xdf,0xd8,0x00,0x01,0x00,0x16,0x26,0x08,0xff,0x01,0x00,0x27,0xf9,0x8f,0x0d,0x00,
+0x1f,0x98,0x19,0x00,0x12,0x26,0x36,0x66,0x01,0x00,0x1f,0x30,0x6a,0x00,0x0b,0x17,
+0x01,0x0c,0x00,0x35,0x8f,0xff,0x91,0x0c,0x00,0x44,0xbf,0xff,0xff,0xc0,0x0c,0x00,
+0x53,0x2f,0xff,0xff,0xff,0x40,0x0c,0x00,0x54,0x03,0xff,0xff,0xff,0xf5,0x19,0x00,
+0x45,0x1f,0xff,0xff,0xff,0x60,0x00,0x45,0xaf,0xff,0xff,0xb0,0x3f,0x00,0x3a,0x7d,
+0xfd,0x80,0x68,0x00,0x46,0xbf,0xff,0x10,0x00,0x50,0x00,0x15,0x90,0x0c,0x00,0x31,
+0x09,0xff,0xf2,0x08,0x00,0x53,0x16,0xad,0xff,0xed,0xa6,0x2f,0x01,0x03,0xd8,0x00,
+0x10,0x30,0x6f,0x00,0x12,0xef,0x0c,0x00,0x13,0xf3,0x7b,0x00,0x22,0xff,0xff,0x7a,
+0x01,0x24,0x01,0xef,0x0d,0x00,0x11,0xf2,0x7a,0x00,0x30,0xff,0xea,0x89,0x12,0x00,
+0x11,0xc0,0xac,0x00,0x40,0x90,0x00,0x0e,0xff,0xb3,0x00,0x70,0x09,0xff,0xff,0xff,
+0xa0,0x00,0x07,0x0c,0x00,0xf1,0x00,0xfa,0x00,0xef,0xff,0xff,0xf1,0x00,0x00,0xef,
+0xfd,0xff,0xff,0xff,0xf0,0x2f,0xcb,0x01,0xf0,0x04,0x7f,0xff,0x5a,0xff,0xff,0xff,
+0x34,0xff,0xff,0xff,0x80,0x00,0x0e,0xff,0xd0,0x6f,0xff,0xff,0xf6,0x04,0x00,0x91,
+0x00,0x07,0xff,0xf5,0x05,0xff,0xff,0xff,0x77,0xd7,0x01,0x20,0xef,0xfd,0xe0,0x01,
+0x20,0xf8,0x6f,0xf6,0x00,0x30,0x7f,0xff,0x50,0x84,0x00,0xf1,0x11,0x86,0xff,0xff,
+0xff,0x60,0x0e,0xff,0xd0,0x00,0x4f,0xff,0xff,0xf7,0x4f,0xff,0xff,0xf8,0x07,0xff,
+0xf5,0x00,0x06,0xff,0xff,0xff,0x61,0xff,0xff,0xff,0xb0,0xef,0xfd,0x91,0x00,0x10,
+0xf4,0x83,0x00,0x31,0x8f,0xff,0x50,0x8b,0x00,0x20,0x00,0x9f,0x84,0x00,0x11,0xd0,
+0xd7,0x01,0x31,0xb0,0x02,0xff,0x43,0x01,0x11,0x07,0xc9,0x00,0x10,0x0a,0x0d,0x00,
+0x31,0xa8,0x9d,0xff,0x91,0x00,0x15,0x1e,0xc2,0x01,0x12,0x20,0x56,0x02,0x23,0xff,
+0xff,0x5b,0x02,0x12,0x3e,0x0b,0x00,0x11,0xfe,0x86,0x01,0x12,0xdf,0xe5,0x01,0x01,
+0x50,0x01,0x71,0x5f,0xff,0x9a,0xde,0xfe,0xdb,0x61,0x37,0x01,0x35,0x0d,0xff,0xe0,
+0x57,0x01,0x36,0x04,0xff,0xf7,0x7c,0x01,0x26,0xcf,0xff,0x0c,0x00,0x53,0x0c,0xff,
+0xff,0xff,0x70,0x0c,0x00,0x12,0x1d,0x6a,0x00,0x01,0x01,0x00,0x17,0x1e,0xac,0x02,
+0x16,0x3f,0xe3,0x01,0x00,0xe4,0x00,0x14,0xe1,0x0c,0x00,0x10,0x5f,0x4f,0x01,0x03,
+0x01,0x00,0x16,0x7f,0x13,0x02,0x4f,0x00,0x45,0x55,0x53,0x62,0x02,0x08,0x12,0x9f,
+0xbe,0x01,0x00,0xf0,0x00,0x12,0x59,0xd6,0x01,0x00,0x3d,0x00,0x1f,0xf5,0x17,0x00,
+0x8e,0x16,0x8f,0x17,0x00,0x13,0x58,0x87,0x01,0x00,0x17,0x00,0x42,0x6f,0xff,0xff,
+0xf9,0x0e,0x04,0x22,0xff,0x54,0x8c,0x02,0x10,0x1a,0xd0,0x01,0x71,0x0f,0xff,0xff,
+0xff,0xfb,0x99,0xbf,0xb1,0x01,0x15,0xaf,0xc8,0x01,0x26,0xf5,0x03,0x96,0x03,0x22,
+0x50,0x07,0x08,0x00,0x23,0xcf,0xff,0x2f,0x02,0x31,0xff,0xff,0x72,0x58,0x00,0x75,
+0x01,0x7b,0xef,0xfd,0xb6,0x10,0x0f,0x75,0x01,0x16,0x8f,0x8b,0x01,0x15,0x3f,0x74,
+0x04,0x00,0xb9,0x01,0x12,0xfd,0x43,0x03,0x00,0x93,0x00,0x26,0xfe,0x20,0x70,0x04,
+0x16,0x30,0xb3,0x03,0x16,0x40,0xaa,0x01,0x14,0x60,0xb1,0x03,0x3f,0x55,0x55,0x30,
+0x9e,0x01,0xff,0x38,0x15,0x3e,0x85,0x01,0x26,0x00,0x5f,0x86,0x01,0x10,0x7f,0x9c,
+0x03,0x13,0x30,0x50,0x01,0x13,0xfe,0x1b,0x03,0x61,0x01,0xbf,0xff,0xfd,0x10,0x3e,
+0x89,0x01,0x20,0x02,0xdf,0xd2,0x01,0x10,0x1d,0x69,0x04,0x40,0x00,0x25,0x55,0x54,
+0xa0,0x03,0x27,0x55,0x55,0x67,0x06,0x0f,0x9e,0x01,0xff,0x33,0x30,0x03,0xcf,0xd7,
+0x3a,0x07,0x21,0xee,0xa1,0x16,0x03,0x11,0xf7,0x7f,0x07,0x10,0xd0,0x78,0x00,0x00,
+0x06,0x00,0x00,0xc2,0x06,0x00,0x8f,0x00,0x41,0xfd,0x00,0x00,0x0f,0x79,0x00,0x11,
+0x1f,0x07,0x05,0x10,0xaf,0x11,0x00,0x30,0x00,0x3b,0xed,0x12,0x05,0x3f,0x8d,0xea,
+0x10,0xc3,0x04,0xff,0x37,0x08,0x66,0x06,0x00,0x28,0x00,0x04,0xf0,0x07,0x00,0xb7,
+0x07,0x17,0xb0,0x31,0x08,0x17,0xc0,0x67,0x06,0x13,0xd1,0x0c,0x00,0x00,0x32,0x07,
+0x17,0xe2,0x09,0x09,0x26,0xf3,0x00,0x68,0x06,0x1f,0x52,0x2f,0x03,0x0b,0x40,0xcf,
+0xff,0xff,0xf8,0x08,0x00,0x62,0x6f,0xff,0xff,0xfd,0x06,0xff,0x5f,0x00,0x10,0x0a,
+0xe0,0x07,0x00,0xa9,0x08,0x00,0xde,0x01,0x01,0x30,0x08,0x10,0xbf,0xe5,0x07,0x01,
+0x73,0x00,0x11,0xfd,0x9d,0x00,0x10,0xb0,0x86,0x08,0x00,0x9c,0x03,0x00,0x26,0x00,
+0x02,0x60,0x07,0x11,0xf2,0x4e,0x05,0x11,0xf4,0xfb,0x08,0x14,0xfd,0xc3,0x00,0x11,
+0x07,0xd5,0x00,0x00,0x26,0x00,0x11,0xfe,0x1f,0x00,0x23,0xf2,0x00,0x07,0x00,0x12,
+0x0f,0xa6,0x05,0x10,0x05,0x20,0x00,0x13,0x05,0xfa,0x00,0x01,0x14,0x00,0x12,0xaf,
+0x25,0x00,0x00,0x08,0x00,0x23,0xf1,0x0e,0xcb,0x05,0x00,0x21,0x00,0x13,0x53,0x1f,
+0x01,0x00,0x26,0x00,0x21,0xfa,0x8f,0x99,0x08,0x02,0x26,0x00,0x14,0xfd,0xf0,0x05,
+0x12,0x05,0x69,0x01,0x02,0xc5,0x05,0x11,0x0f,0x0c,0x00,0x15,0xf1,0x36,0x01,0x05,
+0x20,0x06,0x17,0x04,0x25,0x00,0x02,0x26,0x00,0x16,0xf1,0x5c,0x01,0x05,0x45,0x06,
+0x17,0x04,0x25,0x00,0x01,0x8f,0x08,0x17,0xf1,0xd8,0x02,0x27,0xfb,0x00,0x26,0x00,
+0x17,0x50,0xf2,0x09,0x17,0xf0,0x83,0x01,0x06,0xc6,0x0a,0x17,0xef,0x25,0x00,0x15,
+0x8f,0x25,0x00,0x30,0x01,0x24,0xaf,0x63,0x09,0x05,0x21,0x0a,0x05,0x94,0x06,0x01,
+0xc5,0x08,0x17,0xb0,0x19,0x00,0x17,0xe1,0x34,0x0b,0x17,0xe3,0x53,0x0a,0x24,0xa1,
+0x00,0x0d,0x00,0x37,0x67,0x75,0x10,0x70,0x08,0x1f,0xf7,0x0c,0x00,0x66,0x43,0x6b,
+0xef,0xec,0x83,0x0c,0x00,0x21,0x4e,0xff,0xa2,0x00,0x00,0x0c,0x00,0x10,0xfc,0xde,
+0x00,0x00,0x04,0x06,0x15,0x5f,0x15,0x03,0x17,0xd0,0x0c,0x00,0x12,0xf8,0x0c,0x00,
+0x30,0xb9,0x9d,0xff,0x71,0x02,0x11,0x5f,0x80,0x0a,0x01,0x1e,0x06,0x22,0x70,0x5f,
+0x46,0x01,0x10,0x08,0x96,0x02,0x04,0x6c,0x00,0x00,0x8b,0x0a,0x03,0x0c,0x00,0x00,
+0xb1,0x01,0x14,0xf3,0x0c,0x00,0x00,0xa4,0x03,0x03,0x0c,0x00,0x00,0x50,0x00,0x17,
+0xf6,0x0c,0x00,0x1f,0xf7,0x0c,0x00,0x01,0x17,0x6f,0x24,0x00,0x17,0x8f,0x3c,0x00,
+0x17,0xbf,0x54,0x00,0x03,0x6c,0x00,0x08,0x84,0x00,0x00,0x9c,0x00,0x10,0x5f,0x1b,
+0x02,0x11,0x5f,0x85,0x0a,0x15,0x9c,0xb4,0x00,0x02,0x01,0x00,0x17,0xf7,0xd8,0x00,
+0x1c,0xc0,0xfc,0x00,0x02,0x14,0x01,0x16,0x90,0x2c,0x01,0x1f,0x82,0xb0,0x01,0x68,
+0xa3,0x00,0x00,0x5d,0xfd,0x50,0x00,0x00,0x01,0xae,0xe9,0x4b,0x04,0x10,0x40,0xc5,
+0x03,0x12,0xfa,0xfd,0x03,0x11,0xfa,0x6d,0x02,0x12,0xf0,0x63,0x01,0x11,0xa0,0x6d,
+0x02,0x02,0xee,0x02,0x10,0xf4,0x32,0x0b,0x01,0xd1,0x0a,0x9f,0x05,0xce,0xc4,0x00,
+0x00,0x00,0x1a,0xed,0x80,0x5b,0x04,0xff,0xd3,0x50,0x00,0x00,0x00,0x00,0x00,0x62,
+0x00,0x00,0x00,0x00,0xcf,0xff,0x01,0x00,0x22,0x50,0x00,0x01,0x00,0x13,0x0d,0x10,
+0x00,0x23,0xf5,0x00,0x01,0x00,0x1f,0xdf,0x21,0x00,0x0d,0x0f,0x01,0x00,0x31,0x48,
+0x5f,0xff,0xff,0xf9,0x10,0x00,0x57,0x0b,0xff,0xff,0xff,0xe0,0x10,0x00,0x18,0x01,
+0x82,0x00,0x00,0x01,0x00,0x57,0x6f,0xff,0xff,0xff,0xfb,0x10,0x00,0x10,0x0c,0x21,
+0x00,0x16,0xf1,0x10,0x00,0x11,0x02,0xa4,0x00,0x16,0x70,0x11,0x00,0x10,0x8f,0x10,
+0x00,0x16,0xfd,0x10,0x00,0x11,0x0e,0x21,0x00,0x15,0xf3,0x10,0x00,0x12,0x04,0xd6,
+0x00,0x15,0x90,0x11,0x00,0x75,0xaf,0xff,0xff,0xd9,0xff,0xff,0xfe,0x10,0x00,0x57,
+0x1f,0xff,0xff,0xf7,0x3f,0xf7,0x00,0x93,0x06,0xff,0xff,0xff,0x20,0xef,0xff,0xff,
+0xb0,0x11,0x00,0x00,0x4a,0x01,0x63,0xd0,0x08,0xff,0xff,0xff,0x10,0x10,0x00,0x60,
+0x2f,0xff,0xff,0xf7,0x00,0x3f,0x05,0x00,0x02,0x01,0x00,0x10,0x08,0x31,0x00,0x00,
+0x4f,0x01,0x13,0xd0,0x11,0x00,0x10,0xef,0x0b,0x00,0x00,0x16,0x00,0x12,0x30,0x10,
+0x00,0x11,0x4f,0x2c,0x00,0x15,0x3f,0x0b,0x01,0x11,0x0a,0x31,0x00,0x00,0x32,0x00,
+0x15,0xe0,0x05,0x01,0x12,0xd0,0x48,0x00,0x14,0x50,0x05,0x01,0x12,0xf7,0x69,0x00,
+0x15,0xfb,0x05,0x01,0x12,0x20,0xb3,0x01,0x14,0xf1,0x05,0x01,0x54,0xfb,0xbb,0xbb,
+0xbb,0xbe,0x0b,0x01,0x25,0x8f,0xff,0x01,0x00,0x16,0xfd,0x05,0x01,0x15,0xff,0x0b,
+0x01,0x03,0x05,0x01,0x06,0x0b,0x01,0x17,0xaf,0x10,0x00,0x00,0x0b,0x01,0x18,0x0f,
+0x21,0x00,0x12,0xf5,0x05,0x01,0x15,0xd0,0xde,0x00,0x11,0xb0,0x05,0x01,0x15,0xf7,
+0xff,0x00,0x21,0xff,0x10,0x06,0x00,0x15,0x20,0x49,0x02,0x11,0xf7,0x27,0x00,0x16,
+0xc0,0x10,0x01,0x36,0xd0,0x00,0xef,0x21,0x01,0x10,0x2f,0x0b,0x01,0x16,0x4f,0x31,
+0x00,0x00,0x32,0x00,0x26,0xf9,0x0a,0x31,0x00,0x21,0x00,0x07,0x16,0x02,0x14,0x02,
+0x80,0x00,0x05,0xe7,0x01,0x0e,0x0c,0x00,0x17,0x01,0x0c,0x00,0x0f,0x01,0x00,0x1f,
+0x65,0x05,0x9c,0xef,0xfe,0xc8,0x30,0xa5,0x00,0x30,0xff,0xff,0xfc,0x0d,0x00,0x22,
+0x03,0xef,0x53,0x00,0x13,0xf6,0xab,0x00,0x04,0x16,0x03,0x14,0xdf,0x0c,0x00,0x91,
+0xe1,0x00,0x05,0xff,0xff,0xff,0xf8,0x21,0x26,0xd4,0x00,0x11,0x0a,0x1e,0x00,0x00,
+0xd5,0x01,0x63,0xfc,0x00,0x0b,0xee,0xee,0xee,0x3b,0x03,0x08,0xe2,0x02,0x29,0x10,
+0x00,0xe9,0x01,0x31,0x00,0x37,0xad,0x63,0x00,0x00,0x0c,0x00,0x14,0x5d,0x55,0x00,
+0x11,0x20,0x2a,0x00,0x04,0x0c,0x00,0x16,0xcf,0x0c,0x00,0x10,0x07,0x6c,0x00,0x12,
+0x30,0x3c,0x00,0x12,0x0e,0x45,0x02,0x01,0x0c,0x00,0x44,0x3f,0xff,0xff,0xfa,0x54,
+0x00,0x12,0x5f,0xae,0x00,0x01,0x0c,0x00,0x03,0x2d,0x02,0x01,0x24,0x02,0x12,0x4f,
+0x00,0x02,0x10,0xaf,0x0c,0x00,0x71,0x1f,0xff,0xff,0xff,0xd6,0x44,0x8e,0x54,0x00,
+0x26,0x0b,0xff,0x60,0x00,0x16,0x02,0x0c,0x00,0x32,0x40,0x00,0x4f,0x02,0x02,0x61,
+0xff,0xff,0xff,0x60,0x00,0x03,0xf1,0x00,0x12,0x73,0x22,0x02,0x73,0x05,0xad,0xff,
+0xeb,0x71,0x00,0xef,0xa3,0x02,0x96,0x68,0x88,0x70,0x00,0x00,0x04,0x88,0x88,0x20,
+0x96,0x03,0x10,0x10,0x67,0x00,0x14,0xf4,0xf6,0x00,0x31,0x9f,0xff,0xf7,0x4a,0x03,
+0x16,0x10,0x76,0x03,0x36,0xf7,0x10,0x3c,0xe2,0x01,0x02,0xc8,0x03,0x08,0x98,0x03,
+0x15,0x1d,0x74,0x01,0x03,0x01,0x00,0x10,0x1a,0x10,0x00,0x27,0xe4,0x00,0xeb,0x03,
+0x4f,0x8b,0xdd,0xca,0x50,0x6e,0x04,0xff,0xff,0x4b,0x11,0xb0,0xbb,0x00,0x00,0x13,
+0x00,0x01,0xea,0x00,0x12,0x3f,0xce,0x00,0x61,0xbf,0xff,0xfc,0x40,0x15,0xef,0x3e,
+0x01,0x00,0x46,0x01,0x05,0x12,0x02,0x14,0x07,0x34,0x03,0x00,0x01,0x00,0x10,0x5e,
+0x0b,0x00,0x13,0xd3,0x51,0x00,0x4f,0x59,0xcd,0xdc,0x94,0x86,0x04,0xff,0x52,0x0f,
+0xe1,0x03,0xff,0xff,0x17,0x1b,0x08,0x16,0x02,0x16,0x05,0x3c,0x00,0x04,0xc4,0x01,
+0x19,0xe2,0x92,0x03,0x39,0xdf,0xff,0xf2,0x10,0x00,0x19,0x4f,0x34,0x02,0x01,0xbf,
+0x00,0x19,0xa0,0x11,0x00,0x5a,0x7f,0xff,0xff,0x65,0x80,0x52,0x00,0x05,0x9f,0x01,
+0x05,0x37,0x02,0x07,0xdc,0x06,0x02,0x4a,0x04,0x18,0x90,0x11,0x00,0x45,0x19,0xdf,
+0xfd,0x81,0x0e,0x04,0x17,0x40,0x0e,0x04,0x27,0xfd,0x40,0x0e,0x04,0x18,0xf8,0x0e,
+0x04,0x17,0x70,0x0e,0x04,0x12,0xf1,0x0e,0x04,0x10,0x31,0x0e,0x04,0x11,0xf8,0x03,
+0x02,0x11,0x60,0x1a,0x02,0x1f,0xfd,0x0e,0x04,0x15,0x3f,0x27,0xac,0xee,0x0e,0x04,
+0x0c,0x1a,0xbf,0x0e,0x04,0x26,0xf9,0x41,0x0e,0x04,0x1f,0x40,0x0e,0x04,0x3b,0x17,
+0x30,0x0e,0x04,0x13,0x50,0x0e,0x04,0x52,0xf9,0xff,0xff,0xff,0x80,0x0e,0x04,0x22,
+0xfd,0x40,0x3f,0x02,0x00,0x0e,0x04,0x63,0x60,0x00,0xef,0xff,0xfd,0x91,0xcc,0x00,
+0x17,0x1c,0x98,0x01,0x16,0xaf,0x1a,0x04,0x16,0x02,0x3c,0x03,0x20,0x00,0x08,0x46,
+0x00,0x06,0xfb,0x00,0x17,0x70,0x0c,0x00,0x27,0xe5,0x59,0x11,0x06,0x04,0x20,0x01,
+0x18,0x01,0xca,0x01,0x12,0x5f,0x57,0x01,0x02,0x55,0x00,0x34,0xae,0xff,0xc7,0x3d,
+0x00,0x58,0x03,0x55,0x55,0x55,0x30,0xf2,0x03,0x28,0xff,0x30,0x10,0x04,0x19,0xf4,
+0x18,0x02,0x18,0x50,0x15,0x02,0x19,0xf7,0x6a,0x04,0x06,0x11,0x02,0x19,0x03,0xa7,
+0x04,0x17,0x0c,0x39,0x09,0x0f,0x01,0x00,0x18,0x64,0x04,0x9c,0xef,0xfe,0xdb,0x73,
+0xd5,0x00,0x02,0x42,0x02,0x12,0xc5,0x5f,0x00,0x04,0x38,0x02,0x14,0xb1,0xd7,0x00,
+0x02,0xab,0x03,0x18,0x20,0xcc,0x03,0x00,0x15,0x03,0x11,0x1e,0x17,0x00,0x11,0xde,
+0x96,0x06,0x02,0xb4,0x01,0x50,0xc4,0x00,0x00,0x15,0xdf,0xc7,0x00,0x10,0x03,0x95,
+0x01,0x04,0x4e,0x02,0x15,0xd0,0x70,0x03,0x00,0x31,0x01,0x25,0xf2,0x0f,0x03,0x01,
+0x43,0x9f,0xff,0xff,0xf7,0xf2,0x01,0x02,0x6a,0x00,0x25,0xfa,0x8f,0xa9,0x04,0x59,
+0x2c,0xcc,0xcc,0xca,0xbf,0x18,0x03,0x18,0xdf,0x2d,0x01,0x28,0x00,0xef,0x69,0x05,
+0x10,0x00,0x58,0x00,0x0f,0x0e,0x00,0x21,0x0a,0x46,0x00,0x0a,0x62,0x00,0x0a,0x7e,
+0x00,0x11,0x8f,0x60,0x03,0x00,0x01,0x00,0x41,0x29,0x99,0x99,0x97,0x4b,0x07,0x05,
+0xb6,0x00,0x14,0x1f,0x60,0x04,0x00,0xd2,0x00,0x10,0xf8,0xee,0x00,0x14,0xa0,0xee,
+0x00,0x10,0xf3,0x0a,0x01,0x16,0xf7,0x7f,0x06,0x00,0x36,0x07,0x51,0xa3,0x00,0x00,
+0x05,0xdf,0xa3,0x03,0x01,0xae,0x03,0x23,0xed,0xcd,0x3c,0x05,0x19,0x05,0x5e,0x01,
+0x26,0x00,0x7f,0xf3,0x02,0x00,0xfb,0x03,0x13,0xef,0x0d,0x00,0x12,0xc2,0x12,0x04,
+0x02,0x0d,0x00,0x17,0xc6,0x27,0x08,0x60,0xdb,0x73,0x00,0x00,0x00,0x00,0x11,0x00,
+0x01,0x00,0x52,0x7f,0xff,0xff,0xfc,0x00,0x01,0x00,0x52,0x1f,0xff,0xff,0xfd,0x10,
+0x0b,0x00,0x52,0x0b,0xff,0xff,0xfe,0x20,0x0b,0x00,0x53,0x05,0xff,0xff,0xff,0x30,
+0x22,0x00,0x43,0xef,0xff,0xff,0x40,0x0b,0x00,0x43,0x9f,0xff,0xff,0x60,0x0b,0x00,
+0x43,0x3f,0xff,0xff,0x70,0x0b,0x00,0x5f,0x03,0x55,0x55,0x40,0x00,0x01,0x00,0x0a,
+0x52,0x02,0x7b,0xdf,0xfe,0xc9,0x24,0x00,0x20,0x2a,0xff,0x01,0x00,0x10,0xd5,0x0b,
+0x00,0x21,0x4f,0xff,0x01,0x00,0x62,0xf9,0x00,0x00,0x00,0x5f,0xff,0x01,0x00,0x53,
+0xf8,0x00,0x00,0x2f,0xff,0x01,0x00,0xe1,0xf4,0x00,0x0c,0xff,0xff,0xff,0xfc,0x98,
+0xbf,0xff,0xff,0xff,0xd0,0x03,0x11,0x00,0x20,0x00,0x3e,0x98,0x00,0x42,0xaf,0xff,
+0xff,0xf6,0x82,0x00,0x50,0xf7,0x0e,0xff,0xff,0xfe,0x4b,0x00,0xf6,0x05,0xcf,0xff,
+0xff,0xa2,0xff,0xff,0xff,0xa0,0x00,0x00,0x00,0x08,0xdd,0xdd,0xd9,0x4f,0xff,0xff,
+0xf7,0x00,0xca,0x00,0x04,0xb4,0x00,0x43,0x6f,0xff,0xff,0xf5,0x0b,0x00,0x53,0x06,
+0xff,0xff,0xff,0x50,0x0c,0x00,0x16,0x5f,0x17,0x00,0x26,0x04,0xff,0xd7,0x00,0x12,
+0x2f,0x9b,0x00,0xf2,0x02,0x00,0x13,0x33,0x33,0x20,0xef,0xff,0xff,0xe0,0x00,0x00,
+0x00,0x0a,0xff,0xff,0xfb,0x0a,0x3a,0x00,0x70,0x01,0xff,0xff,0xff,0x90,0x3f,0xff,
+0x1c,0x01,0x50,0x02,0xcf,0xff,0xff,0xf5,0x83,0x00,0x40,0xff,0xc8,0x8b,0xff,0x91,
+0x00,0x13,0x02,0xc3,0x00,0x00,0x29,0x00,0x14,0x05,0x0b,0x00,0x25,0x90,0x00,0x0c,
+0x00,0x10,0x90,0x13,0x01,0x10,0xaf,0x0a,0x00,0x12,0xfd,0x15,0x01,0x66,0x27,0xbd,
+0xff,0xec,0x94,0x00,0x9b,0x00,0x16,0x90,0x3b,0x01,0x45,0x8f,0xff,0xff,0xfa,0x0d,
+0x00,0x10,0x0a,0x34,0x00,0x14,0xb0,0x0e,0x00,0x63,0xbf,0xff,0xfd,0xaf,0xff,0xfc,
+0xbd,0x01,0x82,0x1d,0xff,0xff,0xb0,0x08,0xff,0xff,0xd1,0x70,0x01,0x10,0xef,0x35,
+0x00,0x13,0x6f,0xcf,0x01,0x71,0x06,0x88,0x88,0x60,0x00,0x00,0x04,0x06,0x00,0x0f,
+0x01,0x00,0x1b,0x63,0x04,0x9c,0xef,0xfe,0xdb,0x73,0x0d,0x00,0x21,0x07,0xef,0xbd,
+0x00,0x12,0xc5,0xf4,0x01,0x13,0xdf,0xcc,0x00,0x27,0xb1,0x00,0xbf,0x01,0x01,0x71,
+0x00,0x25,0x04,0xff,0x01,0x00,0x41,0xe2,0x00,0x00,0x1e,0x17,0x00,0x31,0xde,0xff,
+0xff,0x73,0x02,0x00,0xf5,0x00,0x50,0xc4,0x00,0x00,0x15,0xdf,0x1c,0x01,0x23,0x03,
+0xff,0x62,0x01,0x10,0x0b,0xe2,0x01,0x00,0xdc,0x00,0x32,0xc0,0x00,0x00,0x5a,0x01,
+0x24,0xf2,0x0f,0x81,0x02,0x00,0x74,0x02,0x55,0xf7,0x4f,0xff,0xff,0xfd,0xac,0x01,
+0x23,0xfa,0x8f,0x37,0x00,0x72,0x00,0x00,0x2c,0xcc,0xcc,0xca,0xbf,0x0e,0x02,0x03,
+0x01,0x00,0x11,0xdf,0x27,0x02,0x16,0x00,0xbb,0x02,0x16,0xf3,0x0e,0x00,0x00,0x58,
+0x00,0x0f,0x0e,0x00,0x21,0x0a,0x46,0x00,0x0a,0x62,0x00,0x0a,0x7e,0x00,0x11,0x8f,
+0xc2,0x02,0x00,0x01,0x00,0x55,0x29,0x99,0x99,0x97,0x4f,0x66,0x03,0x00,0xb6,0x00,
+0x54,0x1f,0xff,0xff,0xff,0x20,0xd2,0x00,0x23,0xf8,0x0a,0xae,0x02,0x01,0xee,0x00,
+0x10,0xf3,0x0a,0x01,0x14,0xf7,0x0a,0x01,0x11,0xe0,0x4b,0x02,0x51,0xa3,0x00,0x00,
+0x05,0xdf,0x8e,0x02,0x01,0x11,0x03,0x21,0xed,0xcd,0x2f,0x02,0x06,0x44,0x02,0x02,
+0x5e,0x01,0x25,0x00,0x7f,0x0e,0x00,0x10,0x30,0xed,0x02,0x13,0xef,0x0d,0x00,0x11,
+0xc2,0x69,0x00,0x12,0x19,0x0d,0x00,0x14,0xc6,0x0b,0x03,0x08,0xce,0x01,0x53,0x00,
+0x2d,0xff,0xfd,0x20,0x0b,0x00,0x16,0x3e,0xf9,0x03,0x10,0x4f,0xae,0x01,0x14,0x30,
+0x2e,0x03,0x12,0x9f,0xfb,0x03,0x00,0x66,0x00,0x22,0x40,0x4f,0x0c,0x00,0x10,0x9f,
+0x1f,0x00,0x11,0x3e,0x03,0x03,0x41,0x39,0x99,0x99,0x20,0xea,0x00,0x1e,0x10,0x4e,
+0x02,0x0f,0x06,0x04,0xff,0x2f,0x45,0x01,0xae,0xeb,0x30,0x3b,0x01,0x00,0x04,0x01,
+0x16,0xe1,0x0e,0x00,0x16,0x3f,0xd9,0x00,0x02,0x41,0x01,0x16,0xf8,0x0e,0x00,0x19,
+0x1f,0x9f,0x02,0x0a,0x4c,0x04,0x3e,0x00,0x15,0x62,0x02,0x04,0x0f,0x06,0x04,0xff,
+0xec,0x37,0x06,0xdf,0xd6,0x2c,0x02,0x17,0xf6,0xdf,0x00,0x13,0xd0,0x0b,0x00,0x04,
+0x5d,0x03,0x21,0x00,0x00,0xb9,0x01,0x14,0xa0,0xa0,0x02,0x35,0xdf,0xff,0xd1,0xf2,
+0x00,0x1e,0x46,0x00,0x08,0x0f,0x06,0x04,0xff,0x31,0x30,0x01,0x11,0x11,0x07,0x00,
+0x21,0x11,0x11,0x60,0x05,0x11,0x09,0xf5,0x00,0x12,0x2e,0xf1,0x01,0x01,0x8b,0x01,
+0x33,0x40,0x02,0xef,0x1f,0x03,0x00,0x32,0x02,0x25,0xf5,0x2e,0xa1,0x02,0x00,0x80,
+0x00,0x06,0xb6,0x09,0x00,0x1b,0x08,0x06,0xd6,0x00,0x00,0x1c,0x08,0x06,0xef,0x00,
+0x01,0x3a,0x01,0x07,0xbb,0x02,0x4f,0x03,0xbb,0xbb,0x60,0x14,0x04,0x17,0x1a,0x74,
+0x14,0x04,0x1a,0xd7,0x14,0x04,0x19,0xd4,0x14,0x04,0x29,0xff,0x50,0x14,0x04,0x19,
+0xf4,0x14,0x04,0x24,0xfe,0x10,0x14,0x04,0x20,0x04,0xbf,0x14,0x01,0x05,0x14,0x04,
+0x55,0x08,0xff,0xff,0xff,0xf0,0x14,0x04,0x00,0x97,0x02,0x15,0xf6,0x14,0x04,0x00,
+0xf6,0x02,0x15,0xf9,0x14,0x04,0x00,0xc9,0x00,0x16,0xfc,0x14,0x04,0x0e,0x96,0x03,
+0x0f,0x14,0x04,0x75,0x46,0x3d,0xdd,0xdd,0xda,0x14,0x04,0x18,0x6f,0x14,0x04,0x00,
+0x05,0x01,0x15,0xf7,0x14,0x04,0x10,0x02,0x6c,0x00,0x05,0x14,0x04,0x10,0x0c,0xfa,
+0x02,0x04,0x14,0x04,0x11,0x16,0x3a,0x05,0x08,0x14,0x04,0x1e,0xfc,0x14,0x04,0x08,
+0x8e,0x05,0x06,0x14,0x04,0x18,0xb1,0x14,0x04,0x17,0xc5,0x14,0x04,0x24,0xda,0x73,
+0x47,0x01,0x11,0x90,0x9d,0x04,0x11,0x70,0x62,0x03,0x13,0x90,0xf4,0x0b,0x00,0x79,
+0x02,0x22,0x90,0x9f,0x39,0x02,0x00,0x0c,0x00,0x14,0xdf,0x85,0x01,0x14,0x1d,0x62,
+0x00,0x02,0x0c,0x00,0x05,0x54,0x08,0x4f,0x1a,0xbb,0xba,0x10,0x14,0x04,0xff,0x3a,
+0x50,0xec,0x94,0x00,0x00,0x00,0xf0,0x09,0x48,0x88,0x87,0x10,0x00,0x00,0x38,0x88,
+0x88,0x30,0x00,0x00,0x00,0x00,0xbf,0xff,0xfd,0x10,0x00,0x4f,0xff,0xff,0xa0,0x00,
+0x01,0x00,0x91,0xaf,0xff,0xfd,0x10,0x4f,0xff,0xff,0x80,0x00,0x01,0x00,0x82,0x9f,
+0xff,0xfd,0x6f,0xff,0xff,0x70,0x00,0x01,0x00,0x73,0x8f,0xff,0xff,0xff,0xff,0x50,
+0x00,0x01,0x00,0x64,0x7f,0xff,0xff,0xfe,0x30,0x00,0x01,0x00,0x5f,0x5f,0xff,0xfe,
+0x20,0x00,0x01,0x00,0x1b,0x11,0xff,0x01,0x00,0x21,0xeb,0x84,0x0d,0x00,0x22,0x0f,
+0xff,0x01,0x00,0x25,0xfe,0x71,0x1b,0x00,0x00,0x01,0x00,0x17,0xe5,0x1b,0x00,0x38,
+0xff,0xff,0xfa,0x1b,0x00,0x22,0xff,0xfb,0x1b,0x00,0x30,0xcb,0xbb,0xde,0x0e,0x00,
+0x11,0xf9,0x1b,0x00,0x91,0xf1,0x00,0x00,0x03,0x9f,0xff,0xff,0xff,0xf5,0x1b,0x00,
+0x93,0x10,0x00,0x00,0x00,0x3e,0xff,0xff,0xff,0xe0,0x1b,0x00,0x74,0x00,0x00,0x2f,
+0xff,0xff,0xff,0x70,0x1b,0x00,0x01,0xc3,0x00,0x05,0x1b,0x00,0x55,0x00,0xef,0xff,
+0xff,0xf4,0x1b,0x00,0x55,0x09,0xff,0xff,0xff,0x80,0x1b,0x00,0x45,0x5f,0xff,0xff,
+0xfc,0x1b,0x00,0x10,0x02,0x52,0x00,0x05,0x1b,0x00,0x45,0x1f,0xff,0xff,0xff,0x1b,
+0x00,0x01,0x4d,0x00,0x05,0x1b,0x00,0x00,0x17,0x00,0x18,0x2f,0x1b,0x00,0x19,0xf2,
+0x1b,0x00,0x14,0x1f,0x1b,0x00,0x55,0x01,0xff,0xff,0xff,0xf0,0x1b,0x00,0x18,0x2f,
+0x51,0x00,0x55,0x06,0xff,0xff,0xff,0xc0,0x1b,0x00,0x45,0x9f,0xff,0xff,0xf9,0x1b,
+0x00,0x00,0x09,0x00,0x14,0x40,0x1b,0x00,0x10,0x07,0x94,0x00,0x04,0x1b,0x00,0x00,
+0xa1,0x00,0x14,0xf8,0xd8,0x00,0x63,0x03,0xef,0xff,0xff,0xfe,0x10,0x1b,0x00,0x10,
+0x29,0x2a,0x01,0x20,0x60,0x00,0x3d,0x01,0x30,0xbb,0xbc,0xef,0x0d,0x00,0x17,0xa0,
+0x5f,0x01,0x28,0xff,0xc0,0x5f,0x01,0x18,0xb0,0x7a,0x01,0x17,0x60,0x7a,0x01,0x25,
+0xf8,0x10,0x95,0x01,0x39,0xfe,0xb9,0x40,0xd3,0x01,0x40,0x6f,0xff,0xff,0xf6,0x1b,
+0x00,0x0f,0x10,0x00,0x0c,0x19,0xfe,0x10,0x00,0x39,0x1f,0xff,0xfc,0x10,0x00,0x39,
+0x4f,0xff,0xf8,0x10,0x00,0x39,0x9f,0xff,0xf2,0x10,0x00,0x01,0xa8,0x00,0x06,0x10,
+0x00,0x48,0x08,0xff,0xff,0x30,0x10,0x00,0x3a,0x01,0xaf,0xf9,0x90,0x00,0x20,0x03,
+0x90,0x0b,0x00,0x42,0x28,0xce,0xfe,0xb6,0x10,0x00,0x14,0x00,0xe0,0x01,0x26,0xff,
+0xe4,0x10,0x00,0x11,0xcf,0xd0,0x00,0x14,0xbf,0x10,0x00,0x15,0x0c,0xfa,0x00,0x14,
+0xf6,0x49,0x00,0x09,0x10,0x00,0x00,0x0a,0x00,0x25,0xd9,0x9b,0x10,0x00,0x00,0xa7,
+0x01,0x44,0xf7,0x00,0x00,0x1b,0x10,0x00,0x00,0x3f,0x00,0x12,0x90,0x56,0x00,0x14,
+0xf6,0xac,0x01,0x14,0x10,0x90,0x00,0x02,0xe4,0x01,0x15,0xfb,0xa0,0x00,0x02,0x60,
+0x02,0x18,0xf8,0x10,0x00,0x1e,0x6f,0x08,0x00,0x1f,0xf5,0x10,0x00,0x09,0x1b,0x5f,
+0x30,0x00,0x11,0x4f,0x8f,0x00,0x0f,0x70,0x00,0x07,0x00,0x90,0x00,0x08,0x10,0x00,
+0x10,0x0b,0xee,0x02,0x07,0xb0,0x00,0x12,0x05,0xc9,0x00,0x15,0x1a,0xf0,0x00,0x10,
+0xef,0xf0,0x00,0x1f,0x8a,0x10,0x01,0x07,0x1b,0x0b,0x10,0x00,0x03,0x50,0x01,0x15,
+0x7f,0x10,0x00,0x11,0x08,0xce,0x03,0x15,0x0e,0x10,0x00,0x00,0x90,0x01,0x35,0xc7,
+0x10,0x0c,0x10,0x00,0x11,0x4f,0x30,0x00,0x23,0xed,0xa7,0x45,0x04,0x14,0x04,0x4f,
+0x00,0x17,0xd5,0x1f,0x00,0x00,0x01,0x00,0x29,0xfc,0x30,0x1f,0x00,0x02,0x9a,0x02,
+0x06,0x1f,0x00,0x02,0xad,0x04,0x11,0x04,0xe1,0x02,0x24,0xcd,0xff,0xb0,0x04,0x21,
+0x4f,0xff,0x63,0x02,0x22,0x4b,0xff,0x87,0x01,0x12,0x04,0xeb,0x02,0x01,0xb6,0x01,
+0x16,0xfa,0x1f,0x00,0x01,0x10,0x00,0x16,0xf2,0x1f,0x00,0x01,0xd5,0x00,0x16,0x90,
+0x1f,0x00,0x01,0x66,0x00,0x07,0x1f,0x00,0x01,0x31,0x04,0x07,0x1f,0x00,0x11,0x0a,
+0x7e,0x00,0x05,0x1f,0x00,0x00,0x5e,0x04,0xa2,0xfa,0x25,0x55,0x7f,0xff,0xff,0xfd,
+0x55,0x55,0x40,0x5e,0x00,0x14,0xb7,0xe6,0x04,0x03,0x54,0x04,0x13,0x7f,0x10,0x00,
+0x12,0xe0,0x57,0x00,0x16,0xd7,0x1f,0x00,0x00,0x57,0x00,0x17,0xfd,0x1f,0x00,0x11,
+0x05,0x57,0x00,0x06,0x5d,0x00,0x11,0x6f,0x76,0x00,0x05,0x7c,0x00,0x11,0x07,0xcb,
+0x03,0x06,0x1f,0x00,0x11,0xaf,0x01,0x02,0x05,0x1f,0x00,0x10,0x0e,0x2c,0x04,0x06,
+0x1f,0x00,0x10,0x04,0x71,0x04,0x07,0x1f,0x00,0x11,0xcf,0x08,0x01,0x05,0x1f,0x00,
+0x00,0x77,0x00,0x16,0x30,0x1f,0x00,0x12,0x6f,0x0d,0x04,0x03,0x1f,0x00,0x22,0x04,
+0xbf,0x26,0x01,0x00,0x1f,0x00,0x44,0xfe,0xbb,0xbb,0xcf,0xf4,0x01,0x07,0x93,0x01,
+0x1a,0xf8,0x93,0x01,0x1a,0xf7,0xb2,0x01,0x19,0xd3,0xd1,0x01,0x27,0xfd,0x60,0xf0,
+0x01,0x3e,0xfe,0xdb,0x73,0x4f,0x04,0x0f,0x0e,0x00,0x01,0x30,0x15,0x55,0x55,0x0c,
+0x05,0x29,0x55,0x50,0x4c,0x00,0x1f,0xf1,0x0e,0x00,0x1c,0x0e,0x62,0x00,0x0e,0x0e,
+0x00,0x0d,0x3b,0x04,0x0a,0x39,0x04,0x09,0x37,0x04,0x0a,0x35,0x04,0x0a,0x23,0x03,
+0x09,0x31,0x04,0x0a,0x2f,0x04,0x0a,0x2d,0x04,0x0a,0x2b,0x04,0x0a,0xb9,0x03,0x0a,
+0x27,0x04,0x0a,0x25,0x04,0x0a,0x13,0x04,0x0a,0x0e,0x00,0x0a,0x1f,0x04,0x0a,0x1d,
+0x04,0x0a,0x62,0x00,0x0a,0x19,0x04,0x0a,0x17,0x04,0x0b,0x15,0x04,0x0a,0x13,0x04,
+0x0a,0xee,0x00,0x0b,0x0f,0x04,0x0a,0x0d,0x04,0x0b,0x0b,0x04,0x08,0x09,0x04,0x14,
+0x02,0x37,0x00,0x03,0x08,0x07,0x12,0xff,0xa9,0x02,0x0f,0x17,0x00,0x04,0x0f,0x6e,
+0x08,0x20,0x01,0x01,0x00,0x16,0xef,0x0b,0x00,0x1f,0xfe,0x17,0x00,0x13,0x21,0xcb,
+0xbb,0x01,0x00,0x17,0xba,0x3b,0x02,0x06,0xf4,0x07,0x2f,0x00,0x00,0x17,0x00,0x2a,
+0x20,0x98,0x88,0x01,0x00,0x17,0x85,0xa1,0x00,0x16,0x90,0x78,0x07,0x1f,0xf9,0x17,
+0x00,0x14,0x0f,0x8a,0x00,0x32,0x0f,0x17,0x00,0x0f,0x22,0xfb,0xbb,0x01,0x00,0x1f,
+0xaf,0x42,0x01,0x1e,0x05,0xda,0x04,0x17,0x04,0xe4,0x04,0x0f,0x0c,0x00,0x0d,0x2f,
+0xfd,0x00,0x01,0x00,0x22,0x52,0x5a,0xde,0xfe,0xda,0x61,0x0b,0x00,0x15,0x7e,0x14,
+0x06,0x23,0x00,0x1c,0x41,0x06,0x53,0x10,0x00,0x00,0x01,0xdf,0x61,0x00,0x17,0xd0,
+0xb5,0x03,0x12,0xfa,0xf9,0x04,0x31,0xea,0x89,0xdf,0x2d,0x05,0x11,0xef,0x6c,0x03,
+0x10,0x06,0xfc,0x04,0x11,0x06,0x5d,0x05,0x01,0x00,0x0b,0x10,0xf0,0xda,0x02,0x12,
+0x20,0x87,0x02,0x00,0x2d,0x0a,0x13,0xfc,0x25,0x01,0xe6,0xf7,0x2f,0xff,0xff,0xfe,
+0xaa,0xaa,0xaa,0xaa,0xaf,0xff,0xff,0xf9,0x3f,0xf0,0x00,0x27,0xfa,0x4f,0xb0,0x0a,
+0x08,0x0c,0x00,0x17,0x3f,0x0c,0x00,0x12,0x2f,0x87,0x06,0x04,0x71,0x01,0x05,0x1e,
+0x09,0x14,0x0c,0xdf,0x06,0x12,0x01,0xe1,0x05,0x10,0xe2,0x0c,0x00,0x21,0x1d,0x90,
+0x30,0x0a,0x72,0xfe,0x50,0x00,0x00,0x06,0xef,0xf7,0xb4,0x00,0x31,0xfd,0x98,0x9b,
+0x2b,0x00,0x06,0x77,0x03,0x16,0xe0,0xe4,0x00,0x22,0xff,0x40,0x9b,0x06,0x00,0x01,
+0x00,0x10,0xe3,0x42,0x00,0x16,0x4c,0xa5,0x05,0x71,0x00,0x00,0x37,0xbd,0xff,0xfd,
+0xa5,0x64,0x00,0x20,0x88,0x88,0x53,0x00,0x43,0x88,0x87,0x00,0x00,0x92,0x09,0x00,
+0x78,0x06,0x00,0xe7,0x03,0x10,0xf2,0x41,0x04,0x12,0xfb,0xfb,0x04,0x32,0xd4,0x11,
+0x6f,0x94,0x00,0x15,0x2f,0x41,0x01,0x01,0x5f,0x04,0x04,0x9e,0x00,0x20,0x00,0x3d,
+0x0b,0x00,0x12,0xc2,0x5c,0x00,0x5f,0x05,0x9c,0xed,0xc9,0x40,0x92,0x03,0xff,0x93,
+0x10,0x80,0x58,0x00,0x12,0xfd,0x81,0x05,0x14,0xd0,0xef,0x01,0x66,0x00,0xdf,0xff,
+0xfb,0x30,0x16,0x62,0x0a,0x05,0xf0,0x01,0x01,0x03,0x07,0x04,0xf0,0x0d,0x17,0x6f,
+0xf1,0x01,0x5f,0x00,0x6a,0xcd,0xdc,0x83,0xaa,0x03,0xff,0x49,0x50,0xfd,0xa5,0x00,
+0x00,0x00,0x10,0x00,0x01,0x00,0x34,0x26,0x51,0x00,0x01,0x00,0x34,0x9f,0xff,0xf5,
+0x0b,0x00,0x43,0x4f,0xff,0xff,0xf1,0x0b,0x00,0x53,0x08,0xff,0xff,0xff,0x40,0x0c,
+0x00,0x43,0x7f,0xff,0xff,0xf3,0x0b,0x00,0x44,0x02,0xff,0xff,0xfc,0x2e,0x00,0x5f,
+0x03,0xbf,0xea,0x10,0x00,0x01,0x00,0x12,0x16,0xff,0x01,0x00,0x16,0xef,0x0b,0x00,
+0x1f,0xfe,0x17,0x00,0x13,0x21,0xcb,0xbb,0x01,0x00,0x26,0xba,0xff,0x9d,0x00,0x44,
+0x0f,0xff,0xff,0xff,0x7b,0x00,0x0f,0x17,0x00,0x2a,0x20,0x98,0x88,0x01,0x00,0x17,
+0x85,0xa1,0x00,0x25,0x90,0x0f,0x0b,0x00,0x1f,0xf9,0x17,0x00,0x14,0x0f,0x8a,0x00,
+0x32,0x0f,0x17,0x00,0x0f,0x22,0xfb,0xbb,0x01,0x00,0x1f,0xaf,0x42,0x01,0x1e,0x04,
+0x17,0x00,0x00,0x49,0x00,0x35,0x04,0xcf,0xe8,0x97,0x01,0x46,0x3f,0xff,0xff,0xa0,
+0x06,0x02,0x05,0x78,0x00,0x66,0x00,0xaf,0xff,0xff,0xf2,0x00,0xfc,0x01,0x14,0xe0,
+0x0c,0x00,0x45,0x0b,0xff,0xfe,0x40,0x3d,0x00,0x3f,0x36,0x51,0x00,0x01,0x00,0x19,
+0x52,0x5a,0xde,0xfe,0xda,0x61,0x0b,0x00,0x11,0x7e,0x8e,0x00,0x10,0x70,0x0b,0x00,
+0x12,0x1c,0x9a,0x00,0x63,0xfc,0x10,0x00,0x00,0x01,0xdf,0xa7,0x00,0x44,0xd0,0x00,
+0x00,0x0c,0xb3,0x00,0x11,0xfa,0x81,0x00,0x41,0xff,0xea,0x89,0xdf,0x8f,0x02,0xd2,
+0xef,0xff,0xff,0xf8,0x00,0x00,0x06,0xff,0xff,0xff,0xb0,0x06,0xff,0xbd,0x00,0xf2,
+0x02,0x8f,0xff,0xff,0xf0,0x0b,0xff,0xff,0xff,0x20,0x00,0x00,0x00,0x2f,0xff,0xff,
+0xf4,0x0f,0xa1,0x02,0x00,0x3d,0x01,0xe6,0xf7,0x2f,0xff,0xff,0xfe,0xaa,0xaa,0xaa,
+0xaa,0xaf,0xff,0xff,0xf9,0x3f,0x08,0x01,0x26,0xfa,0x4f,0x0c,0x00,0x18,0xfb,0x0c,
+0x00,0x17,0x3f,0x0c,0x00,0x11,0x2f,0x7d,0x00,0x05,0x89,0x01,0x14,0xfe,0x0c,0x00,
+0x00,0x9b,0x00,0x10,0x60,0x09,0x00,0x80,0x01,0x00,0x00,0x07,0xff,0xff,0xff,0xe2,
+0x0c,0x00,0x40,0x1d,0x90,0x00,0x01,0x61,0x01,0x62,0x50,0x00,0x00,0x06,0xef,0xf7,
+0xb4,0x00,0x31,0xfd,0x98,0x9b,0x2b,0x00,0x15,0x0b,0x54,0x00,0x16,0xe0,0xe4,0x00,
+0x00,0x5b,0x03,0x13,0x0a,0x0b,0x00,0x10,0xe3,0x42,0x00,0x11,0x4c,0x0b,0x00,0x12,
+0xf8,0x64,0x00,0x5f,0x37,0xbd,0xff,0xfd,0xa5,0x37,0x03,0xff,0x7c,0x63,0x00,0x00,
+0x3e,0xff,0xff,0x80,0x56,0x00,0x15,0x2f,0x1b,0x05,0x00,0xde,0x01,0x13,0x50,0x0b,
+0x00,0x17,0x01,0x2a,0x03,0x16,0x4f,0x26,0x05,0x65,0x04,0xff,0xff,0xf7,0x48,0x20,
+0x39,0x00,0x23,0xff,0xf6,0x18,0x00,0x10,0xcf,0x08,0x01,0x03,0x3a,0x00,0x17,0xdf,
+0x56,0x05,0x45,0x8d,0xff,0xd9,0x20,0x32,0x03,0x03,0x5c,0x00,0x11,0x6e,0x88,0x00,
+0x01,0x32,0x03,0x13,0x1b,0xa0,0x02,0x17,0x00,0x32,0x03,0x25,0xc0,0x00,0x66,0x02,
+0x00,0x43,0x02,0x11,0x5f,0x32,0x03,0x11,0xef,0x15,0x03,0x11,0xef,0xc7,0x02,0x10,
+0x08,0x6c,0x00,0x12,0x05,0x2a,0x00,0x62,0x00,0xbf,0xff,0xff,0xf0,0x0a,0xde,0x05,
+0x00,0xf1,0x05,0x22,0xf3,0x0e,0xe3,0x00,0x00,0x38,0x01,0x22,0xf6,0x1f,0x5a,0x00,
+0x00,0x0c,0x00,0x17,0xf8,0x0e,0x03,0x2f,0xf9,0x4f,0x3e,0x03,0x13,0x22,0xfd,0xaa,
+0x01,0x00,0x14,0xa7,0x48,0x00,0x00,0x01,0x00,0x17,0x0d,0x90,0x01,0x14,0x09,0xf5,
+0x00,0x80,0x05,0x20,0x00,0x03,0xff,0xff,0xff,0xf7,0x0c,0x00,0x21,0x6f,0xd1,0x95,
+0x00,0x50,0xff,0xb4,0x00,0x01,0x5c,0x08,0x01,0x15,0x2f,0x8d,0x01,0x35,0xb0,0x00,
+0x05,0x60,0x00,0x12,0xc0,0xd9,0x00,0x04,0x2f,0x04,0x22,0x03,0xcf,0x0c,0x00,0x11,
+0x80,0x4e,0x00,0x10,0xbf,0x0b,0x00,0x13,0xb2,0x4e,0x01,0x16,0x49,0x65,0x01,0x25,
+0x00,0x0d,0xab,0x01,0x00,0x3f,0x00,0x17,0xfa,0xf5,0x06,0x26,0xf7,0x00,0xef,0x04,
+0x23,0xfc,0x11,0x25,0x00,0x00,0x4f,0x04,0x26,0xff,0xf0,0x1f,0x05,0x05,0xf8,0x06,
+0x17,0x09,0xba,0x01,0x00,0x8f,0x01,0x15,0xb3,0x3e,0x00,0x20,0x23,0x30,0x06,0x00,
+0x41,0x07,0x88,0x88,0x50,0x06,0x00,0x11,0x70,0x55,0x01,0x10,0x70,0xde,0x03,0x12,
+0xf4,0x36,0x02,0x23,0x70,0x0b,0xe4,0x03,0x71,0x2e,0xff,0xff,0x8b,0xff,0xff,0xd2,
+0x36,0x00,0x10,0x2d,0xb1,0x00,0x34,0xc1,0x00,0x00,0x05,0x05,0x16,0xa0,0x5f,0x04,
+0x1f,0x90,0x54,0x07,0xff,0x9c,0x14,0x1d,0x9b,0x02,0x11,0xa0,0x92,0x03,0x10,0xfc,
+0xb3,0x02,0x13,0xf9,0xd7,0x01,0x24,0xc1,0x5f,0x35,0x04,0x35,0xbf,0xff,0xfd,0x41,
+0x02,0x01,0xac,0x03,0x16,0x50,0x6c,0x07,0x24,0xf4,0x00,0x74,0x09,0x3f,0xbb,0xbb,
+0x30,0x54,0x07,0xff,0x4e,0x04,0x94,0x05,0x16,0xb0,0x47,0x01,0x16,0x06,0x8b,0x03,
+0x12,0x00,0x81,0x00,0x36,0xff,0xd1,0x00,0xf8,0x03,0x13,0xe9,0x91,0x00,0x02,0xba,
+0x01,0x23,0xd2,0x06,0x5e,0x00,0x02,0xe1,0x01,0x24,0x00,0x04,0xc0,0x01,0x11,0x04,
+0xfc,0x03,0x11,0x03,0x06,0x00,0x0f,0x01,0x00,0x1d,0x64,0x03,0x8b,0xdf,0xff,0xec,
+0x96,0x98,0x02,0x12,0x6d,0xc4,0x00,0x12,0xa3,0x71,0x0b,0x16,0xcf,0xd9,0x05,0x11,
+0x00,0x34,0x05,0x06,0x01,0x06,0x16,0x02,0xa2,0x05,0x00,0x72,0x02,0x01,0x09,0x01,
+0x20,0xdb,0xce,0x06,0x00,0x12,0xf4,0xca,0x04,0x51,0xe6,0x10,0x00,0x02,0x9f,0xff,
+0x01,0x14,0x1f,0xd5,0x00,0x00,0x44,0x05,0x34,0x30,0x07,0xff,0xe2,0x09,0x10,0x9f,
+0x3b,0x00,0x14,0xdf,0x26,0x01,0x10,0x02,0x68,0x05,0x12,0x2f,0xfa,0x01,0x00,0x98,
+0x01,0x42,0xee,0xee,0xed,0x05,0x3e,0x02,0x16,0x00,0x20,0x05,0x06,0x45,0x05,0x01,
+0x6f,0x01,0x16,0x80,0x0f,0x00,0x17,0xbf,0x24,0x05,0x05,0xd6,0x01,0x21,0x01,0x33,
+0x01,0x00,0x31,0x30,0xcf,0xff,0x68,0x0c,0x12,0x6f,0xb0,0x00,0x12,0x0c,0x03,0x03,
+0x12,0x06,0x0e,0x00,0x22,0xf0,0xcf,0x3a,0x00,0x03,0x1d,0x00,0x12,0x0b,0x3a,0x00,
+0x04,0x1d,0x00,0x12,0xaf,0x9f,0x00,0x03,0x1d,0x00,0x16,0x08,0x2e,0x05,0x00,0x1d,
+0x00,0x15,0x5f,0x48,0x02,0x00,0xdb,0x03,0x16,0x01,0xb3,0x05,0x00,0x1d,0x00,0x15,
+0x0d,0x2c,0x00,0x00,0x1d,0x00,0x01,0x43,0x02,0x15,0x40,0x1d,0x00,0x10,0x01,0x4e,
+0x00,0x01,0x70,0x03,0x00,0x1d,0x01,0x02,0xf8,0x01,0x13,0x92,0x6d,0x07,0x12,0xf0,
+0x2f,0x03,0x31,0xfe,0xcb,0xbd,0x74,0x00,0x37,0x00,0x00,0x1e,0xff,0x03,0x13,0xb0,
+0xbf,0x05,0x02,0x01,0x00,0x00,0x60,0x00,0x15,0x1a,0x0f,0x04,0x11,0x50,0x0b,0x02,
+0x12,0xbf,0x0e,0x00,0x13,0xc6,0x0a,0x01,0x76,0x16,0xad,0xef,0xff,0xdc,0x96,0x10,
+0x5a,0x0d,0x17,0x70,0x6a,0x0b,0x16,0xf8,0x5c,0x02,0x04,0xfc,0x05,0x74,0x01,0xcf,
+0xff,0xfc,0xcf,0xff,0xfa,0x29,0x06,0x22,0xb0,0x0b,0xaf,0x02,0x20,0x03,0xef,0xe7,
+0x01,0x11,0x9f,0x8c,0x03,0x71,0x08,0x99,0x99,0x60,0x00,0x00,0x07,0x06,0x00,0x0f,
+0x01,0x00,0x13,0x61,0x16,0xbd,0xff,0xda,0x50,0x06,0xca,0x03,0x20,0x06,0xef,0x4c,
+0x03,0x11,0x38,0x0c,0x00,0x12,0x9f,0x2d,0x04,0x00,0x0c,0x00,0x15,0x08,0xd4,0x00,
+0x37,0xfc,0x00,0x3f,0x0c,0x00,0x10,0xdf,0x6f,0x02,0x20,0x9a,0xdf,0x0c,0x00,0x10,
+0x03,0x0b,0x00,0x82,0x10,0x00,0x05,0xef,0xff,0xff,0xfc,0x0a,0x50,0x08,0x00,0xef,
+0x06,0x23,0xfc,0x0e,0x4b,0x01,0x00,0x2a,0x04,0x53,0x1f,0xff,0xff,0xfd,0x00,0x0c,
+0x00,0x13,0x3f,0x2f,0x02,0x00,0x0c,0x00,0x13,0x4f,0xef,0x07,0x00,0x0c,0x00,0x13,
+0x5f,0x2a,0x02,0x0c,0x0c,0x00,0x08,0x24,0x00,0x13,0x3f,0x48,0x05,0x03,0x54,0x00,
+0x14,0xfc,0x0c,0x00,0x13,0x0d,0xa0,0x02,0x00,0x0c,0x00,0x22,0x09,0xff,0x1b,0x01,
+0x12,0x3f,0x9c,0x00,0x00,0x6d,0x00,0x20,0x04,0xef,0x2c,0x00,0x15,0xcf,0xe2,0x04,
+0x0a,0xcc,0x00,0x17,0x07,0x0c,0x00,0x21,0x00,0x8f,0x09,0x00,0x11,0xcf,0x0c,0x00,
+0x20,0x05,0xef,0x3f,0x00,0x03,0xea,0x04,0x67,0x06,0xbd,0xff,0xd9,0x30,0x0f,0x95,
+0x09,0x11,0x2f,0x71,0x03,0x13,0x02,0x12,0x0d,0x00,0xb4,0x01,0x20,0x7e,0x20,0xa9,
+0x01,0x10,0xef,0x6b,0x03,0x33,0x02,0xff,0xf6,0x77,0x05,0x10,0xe0,0x37,0x02,0x32,
+0xe8,0x65,0x6a,0x8c,0x05,0x14,0x7f,0x6b,0x00,0x15,0xfd,0xbd,0x02,0x01,0x4b,0x04,
+0x26,0x05,0xef,0xa2,0x05,0x22,0x00,0x19,0x38,0x02,0x02,0xc7,0x01,0x90,0x05,0xad,
+0xff,0xfe,0xc8,0x40,0x00,0x00,0x00,0xd0,0x00,0x00,0x00,0xcf,0xff,0xf1,0x00,0x00,
+0x08,0xff,0xff,0x50,0x00,0x01,0x00,0x40,0x0a,0xff,0xff,0x60,0x14,0x00,0x21,0xf4,
+0x00,0x01,0x00,0x92,0x5f,0xff,0xfe,0x50,0x01,0x9f,0xff,0xff,0x00,0x01,0x00,0x82,
+0xdf,0xff,0xff,0xfe,0xff,0xff,0xff,0x70,0x0e,0x00,0x30,0x03,0xef,0xff,0x01,0x00,
+0x13,0xb0,0x1d,0x00,0x20,0x02,0xcf,0x0e,0x00,0x24,0x80,0x00,0x01,0x00,0x6f,0x4a,
+0xdf,0xfe,0xc8,0x20,0x00,0x01,0x00,0x20,0x73,0x03,0x8b,0xdf,0xff,0xec,0x96,0x10,
+0x0e,0x00,0x21,0x6d,0xff,0x01,0x00,0x16,0xa3,0x64,0x00,0x00,0x01,0x00,0x11,0xf8,
+0x29,0x00,0x14,0xff,0x01,0x00,0x10,0xfb,0x1c,0x00,0x15,0xff,0x01,0x00,0x12,0xf9,
+0xac,0x00,0x70,0xff,0xff,0xdb,0xce,0xff,0xff,0xff,0xcd,0x00,0xf2,0x04,0x8f,0xff,
+0xff,0xff,0xe6,0x10,0x00,0x02,0x9f,0xff,0xff,0xff,0xd0,0x00,0x1f,0xff,0xff,0xff,
+0xd1,0xe0,0x00,0x81,0xff,0xff,0x30,0x07,0xff,0xff,0xff,0xf2,0x5f,0x00,0x10,0x9f,
+0x3b,0x00,0x13,0xdf,0x5e,0x00,0x01,0x51,0x00,0x52,0xc0,0x2f,0xff,0xff,0xff,0xc6,
+0x00,0x51,0x0c,0xee,0xee,0xed,0x05,0x3f,0x00,0x04,0x01,0x00,0x00,0x56,0x00,0x16,
+0xfa,0x0e,0x00,0x19,0x0a,0xff,0x00,0x56,0x00,0xbf,0xff,0xff,0xf6,0x0e,0x00,0x21,
+0x0c,0xff,0x5a,0x01,0x21,0x01,0x33,0x01,0x00,0x92,0x30,0xcf,0xff,0xff,0xf5,0x00,
+0x00,0x00,0x6f,0xb0,0x00,0x21,0x0c,0xff,0x80,0x01,0x12,0x06,0x0e,0x00,0x22,0xf0,
+0xcf,0x3a,0x00,0x03,0x1d,0x00,0x12,0x0b,0x3a,0x00,0x04,0x1d,0x00,0x12,0xaf,0x9f,
+0x00,0x03,0x1d,0x00,0x52,0x08,0xff,0xff,0xff,0xa0,0x62,0x00,0x00,0x1d,0x00,0x42,
+0x5f,0xff,0xff,0xfe,0x0e,0x00,0x96,0x0f,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0xf3,
+0x1d,0x00,0x15,0x0d,0x2c,0x00,0x00,0x1d,0x00,0x65,0x00,0x7f,0xff,0xff,0xff,0x40,
+0x1d,0x00,0x20,0x01,0xff,0x0b,0x01,0x00,0x0e,0x00,0x10,0x1f,0x1d,0x00,0x10,0x07,
+0x0f,0x00,0x50,0x92,0x00,0x00,0x00,0x6e,0x1d,0x00,0x01,0xbe,0x00,0x41,0xff,0xfe,
+0xcb,0xbd,0x74,0x00,0x36,0x00,0x00,0x1e,0x6b,0x01,0x00,0xff,0x01,0x16,0x2d,0x0e,
+0x00,0x00,0x60,0x00,0x14,0x1a,0x0d,0x00,0x11,0xfe,0x54,0x02,0x22,0x04,0xbf,0x0e,
+0x00,0x13,0xc6,0x0a,0x01,0x73,0x16,0xad,0xef,0xff,0xdc,0x96,0x10,0x7a,0x00,0x60,
+0xc0,0x00,0x00,0x0d,0xff,0xff,0x0e,0x00,0x10,0xef,0x89,0x02,0x12,0x2f,0x6c,0x02,
+0x62,0xaf,0xff,0xfc,0x30,0x03,0xcf,0x5d,0x01,0x00,0x82,0x01,0x04,0xa2,0x01,0x03,
+0x05,0x01,0x11,0x60,0x3d,0x00,0x10,0x5e,0x0b,0x00,0x13,0xe5,0x56,0x00,0x4f,0x6b,
+0xef,0xfe,0xb6,0x64,0x02,0x18,0xc0,0x16,0xbd,0xff,0xda,0x50,0x06,0xff,0xff,0xfc,
+0x00,0x00,0x06,0xc7,0x02,0x21,0xfd,0x38,0x0c,0x00,0x11,0x9f,0x5f,0x00,0x10,0xfc,
+0x0c,0x00,0x15,0x08,0xd4,0x00,0x37,0xfc,0x00,0x3f,0x0c,0x00,0x10,0xdf,0x6f,0x02,
+0x20,0x9a,0xdf,0x0c,0x00,0x10,0x03,0x0b,0x00,0x91,0x10,0x00,0x05,0xef,0xff,0xff,
+0xfc,0x0a,0xff,0xcc,0x00,0x62,0x00,0x4f,0xff,0xff,0xfc,0x0e,0x4b,0x01,0x00,0x67,
+0x01,0x63,0xfc,0x1f,0xff,0xff,0xfd,0x00,0x0c,0x00,0x13,0x3f,0x2f,0x02,0x00,0x0c,
+0x00,0x44,0x4f,0xff,0xff,0xf7,0x0c,0x00,0x13,0x5f,0x2a,0x02,0x0c,0x0c,0x00,0x08,
+0x24,0x00,0x12,0x3f,0xd6,0x02,0x04,0x54,0x00,0x14,0xfc,0x0c,0x00,0x13,0x0d,0xa0,
+0x02,0x00,0x0c,0x00,0x13,0x09,0x8e,0x03,0x12,0x3f,0x9c,0x00,0x00,0x6d,0x00,0x20,
+0x04,0xef,0x2c,0x00,0x00,0x36,0x03,0x3d,0xea,0x89,0xdf,0xcc,0x00,0x17,0x07,0x0c,
+0x00,0x21,0x00,0x8f,0x09,0x00,0x11,0xcf,0x0c,0x00,0x20,0x05,0xef,0x3f,0x00,0x12,
+0x0f,0x68,0x00,0x63,0x06,0xbd,0xff,0xd9,0x30,0x0f,0x74,0x00,0x02,0x92,0x01,0x00,
+0x71,0x03,0x11,0x02,0x0c,0x00,0x11,0x7f,0x8f,0x02,0x10,0x7e,0x83,0x00,0x20,0x01,
+0xef,0x6b,0x03,0x11,0x02,0xc0,0x00,0x50,0x1c,0xff,0xff,0xff,0xe0,0x37,0x02,0x41,
+0xe8,0x65,0x6a,0xff,0x33,0x04,0x14,0x7f,0x6b,0x00,0x15,0xfd,0xbd,0x02,0x33,0xff,
+0xff,0xe2,0x6b,0x00,0x00,0x82,0x00,0x00,0x04,0x02,0x12,0x19,0x38,0x02,0x02,0xe0,
+0x01,0x65,0x05,0xad,0xff,0xfe,0xc8,0x40,0xb3,0x01,0x37,0x8e,0xfc,0x40,0xc1,0x01,
+0x13,0xaf,0xae,0x02,0x02,0x01,0x00,0x13,0x1f,0x1e,0x01,0x15,0x00,0xb9,0x03,0x16,
+0xa0,0x0f,0x00,0x13,0x0e,0x47,0x01,0x03,0x01,0x00,0x38,0x4e,0xff,0xfb,0x0a,0x02,
+0x2e,0x15,0x63,0xa4,0x04,0x0f,0xa6,0x04,0xff,0xfc,0x00,0x65,0x01,0x25,0xbe,0xea,
+0xcb,0x06,0x17,0x1e,0x5d,0x01,0x24,0x5f,0xff,0x2a,0x07,0x01,0x0a,0x03,0x05,0x4a,
+0x01,0x14,0x3f,0xac,0x01,0x11,0x00,0x5c,0x07,0x15,0x70,0x61,0x01,0x3f,0x25,0x52,
+0x00,0xa6,0x04,0xff,0xca,0x0f,0x15,0x04,0xff,0xdb,0x0d,0x12,0x06,0x28,0x88,0x88,
+0xa2,0x06,0x18,0x6f,0x93,0x06,0x29,0x00,0x06,0x61,0x01,0x28,0x00,0x7f,0x61,0x01,
+0x48,0x00,0x09,0xff,0xff,0x3a,0x00,0x37,0xcf,0xff,0xf0,0x0e,0x00,0x18,0x2f,0xa9,
+0x01,0x29,0x00,0x08,0xf8,0x06,0x28,0x00,0xef,0xe9,0x06,0x49,0x00,0x01,0x9f,0xe1,
+0x92,0x00,0x28,0x22,0x00,0x1d,0x00,0x18,0xa6,0xd3,0x01,0x17,0xd5,0xa8,0x00,0x17,
+0xfd,0x4f,0x00,0x04,0x97,0x00,0x00,0xa2,0x02,0x14,0xf1,0x0c,0x00,0x17,0x07,0x3b,
+0x02,0x17,0x09,0x5c,0x07,0x47,0x0b,0xff,0xff,0x90,0x26,0x02,0x1f,0x80,0x0c,0x00,
+0x0d,0x0e,0x01,0x00,0x0f,0xff,0x04,0xff,0xb3,0x50,0xc8,0x40,0x00,0x00,0x00,0x10,
+0x00,0x01,0x00,0x55,0x02,0x88,0x87,0x10,0x00,0x01,0x00,0x45,0x3e,0xff,0xff,0xd1,
+0x0d,0x00,0x64,0x05,0xff,0xff,0xff,0xfe,0x20,0x0e,0x00,0x63,0x7f,0xff,0xff,0xff,
+0xff,0xe3,0x0d,0x00,0x82,0x08,0xff,0xff,0xe3,0x5f,0xff,0xff,0x40,0x0e,0x00,0x81,
+0xaf,0xff,0xfd,0x20,0x04,0xef,0xff,0xf5,0x0d,0x00,0xbf,0x0c,0xff,0xff,0xc1,0x00,
+0x00,0x2e,0xff,0xff,0x60,0x00,0x01,0x00,0x18,0x42,0xff,0xff,0xff,0xf1,0x0a,0x00,
+0x4f,0x3f,0xff,0xff,0xfd,0x0e,0x00,0x98,0x21,0xfb,0xbb,0x01,0x00,0x12,0xcf,0x0e,
+0x00,0x06,0x01,0x00,0x0f,0x0e,0x00,0x29,0x0e,0x0a,0x01,0x0f,0x0e,0x00,0xaa,0x73,
+0x00,0x00,0x00,0x04,0xff,0xff,0xb0,0xea,0x01,0x21,0x06,0xff,0x21,0x02,0x03,0x46,
+0x02,0x04,0x70,0x02,0x70,0x09,0xff,0xff,0xe9,0xff,0xff,0xe2,0x0b,0x00,0x52,0x0b,
+0xff,0xff,0xd1,0x06,0x6b,0x02,0x40,0x1c,0xff,0xff,0xb1,0x3c,0x00,0xa1,0xf4,0x00,
+0x00,0x04,0x88,0x88,0x70,0x00,0x00,0x03,0x06,0x00,0x0e,0x01,0x00,0x03,0x43,0x00,
+0x23,0xff,0x30,0x0c,0x00,0x4f,0x9f,0xff,0xff,0xf3,0x17,0x00,0x55,0x52,0x04,0x9d,
+0xff,0xeb,0x60,0x17,0x00,0x12,0x1b,0x24,0x03,0x00,0x17,0x00,0x11,0x5e,0xce,0x01,
+0x35,0xf4,0x00,0x9f,0xda,0x01,0x26,0xe0,0x09,0xe6,0x01,0x20,0x60,0x9f,0x5c,0x03,
+0x60,0xa9,0xad,0xff,0xff,0xff,0xfc,0x17,0x00,0x12,0xf7,0x0d,0x01,0x21,0xf0,0x9f,
+0x0b,0x00,0x63,0x00,0x0d,0xff,0xff,0xff,0x39,0x73,0x00,0x43,0x8f,0xff,0xff,0xf4,
+0x73,0x00,0x53,0x07,0xff,0xff,0xff,0x59,0x17,0x00,0x43,0x6f,0xff,0xff,0xf5,0x17,
+0x00,0x1f,0x06,0x17,0x00,0x91,0x11,0x50,0x16,0x01,0x03,0xbd,0x01,0x12,0xdf,0x18,
+0x00,0x03,0xee,0x00,0x03,0xf1,0x00,0x2f,0x30,0x00,0x23,0x00,0x21,0x2b,0x04,0xff,
+0x01,0x00,0x2c,0xf1,0x4f,0x12,0x00,0x1f,0x14,0x23,0x00,0x0f,0x71,0x10,0x11,0xaf,
+0xff,0xff,0xf8,0x11,0x01,0x00,0x6f,0x1d,0xff,0xff,0xff,0x41,0x10,0xaf,0x00,0x26,
+0x12,0xfd,0x11,0x04,0x16,0xbf,0x23,0x00,0x06,0x01,0x00,0x03,0x23,0x00,0x07,0x01,
+0x00,0x0f,0x23,0x00,0x28,0x0f,0x3b,0x01,0x2e,0x0f,0x23,0x00,0xaf,0x00,0x08,0x00,
+0x16,0xfe,0x02,0x04,0x0f,0x0e,0x00,0x07,0x04,0xf1,0x01,0x1f,0xf2,0x0e,0x00,0x1c,
+0x20,0x15,0x55,0xc8,0x03,0x3f,0x55,0x55,0x50,0x62,0x00,0x0e,0x03,0x0e,0x00,0x54,
+0x05,0xbe,0xfe,0xd9,0x40,0x0e,0x00,0x20,0x04,0xdf,0x21,0x06,0x13,0x10,0x0e,0x00,
+0x24,0x5f,0xff,0xef,0x04,0x15,0x0d,0xcb,0x01,0x19,0xfa,0x0e,0x00,0x23,0xff,0x10,
+0x0e,0x00,0x32,0xda,0x9a,0xff,0xfd,0x00,0x00,0x0e,0x00,0x11,0xe4,0x08,0x05,0x25,
+0xff,0xb0,0xf6,0x00,0x10,0x02,0x4d,0x04,0x05,0x7e,0x00,0x00,0x1d,0x01,0x16,0xf0,
+0x0e,0x00,0x1c,0xbf,0x0e,0x00,0x1f,0xf1,0x0e,0x00,0xc1,0x10,0x23,0x97,0x08,0xc0,
+0x44,0x43,0x00,0x3c,0xff,0xfd,0x60,0x00,0x04,0xff,0xfc,0x03,0x4f,0x05,0x53,0x85,
+0x6e,0xff,0xf9,0x0e,0x4a,0x01,0x23,0xf4,0x6f,0x09,0x00,0xff,0x03,0xc0,0xaf,0xff,
+0xb1,0x04,0xbf,0xff,0xff,0xfd,0x10,0xcf,0xff,0x30,0x00,0x03,0xad,0xfe,0x81,0x89,
+0x08,0x0b,0x00,0x87,0x05,0x1f,0x80,0x09,0x00,0xff,0x1a,0x40,0x02,0xae,0xea,0x20,
+0x9b,0x03,0x21,0x50,0x04,0x11,0x00,0xe3,0x0d,0xff,0xf4,0x01,0xef,0xff,0xff,0xff,
+0xe7,0x5b,0xff,0xff,0x10,0x8f,0x85,0x01,0x60,0xb0,0x0e,0xff,0xfc,0x56,0xdf,0xbb,
+0x04,0x40,0x01,0xff,0xff,0x10,0xd3,0x06,0xaf,0xf6,0x00,0x3f,0xff,0xc0,0x00,0x00,
+0x3b,0xff,0xb4,0x1b,0x0a,0x0e,0x11,0xdf,0xee,0x02,0x09,0x6f,0x03,0x0f,0x13,0x00,
+0xce,0x14,0x0f,0x86,0x04,0x0f,0x09,0x00,0x08,0x0e,0x59,0x0b,0x0f,0xd0,0x02,0xff,
+0x32,0x13,0x7f,0x5f,0x01,0x13,0xb7,0x08,0x00,0x14,0xfb,0x11,0x00,0x17,0xb6,0xb3,
+0x05,0x0f,0x01,0x00,0x0e,0x05,0xda,0x01,0x04,0xd9,0x01,0x0f,0x11,0x00,0xb7,0xc1,
+0x08,0x88,0x86,0x00,0x00,0x00,0x58,0x88,0x80,0x0f,0xff,0xfe,0x15,0x00,0x20,0xf0,
+0x0d,0x09,0x0e,0xa0,0x03,0xff,0xff,0xd0,0x07,0xff,0xff,0xe5,0x11,0x5e,0x47,0x01,
+0x11,0xef,0x2b,0x01,0x43,0xfe,0x10,0x00,0x3f,0x07,0x0b,0x30,0x00,0x02,0xcf,0xdd,
+0x0c,0x10,0x30,0x0c,0x0c,0x4f,0x9c,0xdd,0xc9,0x40,0xad,0x02,0xff,0x2f,0x50,0xff,
+0xff,0x80,0x00,0x00,0xf0,0x16,0x7f,0xff,0xf6,0x00,0x00,0x03,0xff,0xff,0xa5,0xff,
+0xff,0xa0,0x00,0x00,0x7f,0xff,0xf8,0x1f,0xff,0xff,0x81,0x00,0x6f,0xff,0xff,0x40,
+0x9f,0xff,0xff,0xfe,0xff,0xff,0xff,0xc0,0x00,0xcf,0xff,0x01,0x00,0x40,0xe2,0x00,
+0x00,0x9f,0x08,0x00,0xaf,0xc1,0x00,0x00,0x00,0x28,0xce,0xff,0xd9,0x40,0x00,0x01,
+0x00,0x09,0x41,0x0d,0xff,0xff,0xfe,0x09,0x00,0x4f,0xdf,0xff,0xff,0xe0,0x11,0x00,
+0xbc,0xaf,0x08,0xff,0xff,0xff,0x80,0x00,0x8f,0xff,0xff,0xf8,0x0b,0x00,0x99,0x10,
+0xaf,0x0b,0x00,0x90,0x5f,0xff,0xff,0x70,0x00,0x3f,0xff,0xfe,0x30,0xd5,0x00,0x30,
+0x30,0x00,0x03,0xdf,0x01,0xf0,0x02,0x00,0x6f,0xff,0xfa,0x00,0x00,0x06,0xff,0xff,
+0xf6,0x58,0x10,0x4f,0xff,0xff,0xff,0xf4,0xe8,0x00,0xf0,0x06,0xff,0x70,0x03,0xef,
+0xff,0xff,0xfa,0x00,0x01,0x8d,0xff,0xd8,0x10,0x00,0x00,0x9d,0xfd,0x60,0x00,0x00,
+0xcf,0x47,0x00,0x00,0x22,0x00,0x00,0x2d,0x00,0x22,0xff,0xf2,0x0b,0x00,0x20,0x00,
+0xdf,0x16,0x00,0x4e,0x01,0x9e,0xfe,0x70,0x05,0x02,0x61,0x0f,0xff,0xff,0xfc,0x00,
+0x00,0x44,0x02,0x0f,0x0b,0x00,0x71,0xf0,0x12,0xbf,0xff,0xfc,0x20,0x00,0xaf,0xff,
+0xf9,0x00,0x00,0x4f,0xff,0xfb,0x00,0x00,0x0b,0xff,0xff,0x40,0x00,0x00,0xef,0xff,
+0xf3,0x00,0x00,0x0e,0xff,0xff,0xb4,0x66,0x00,0xbf,0x26,0x00,0x20,0x05,0xff,0xd6,
+0x00,0x11,0x09,0xe1,0x00,0xf8,0x12,0x04,0xbe,0xfe,0xb5,0x00,0x00,0x25,0x52,0x00,
+0x07,0xff,0xff,0x70,0x3f,0xff,0xff,0xf2,0x7f,0xff,0xff,0xf6,0x6f,0xff,0xff,0xf4,
+0x1e,0xff,0xff,0xd0,0x02,0xbe,0xea,0x20,0xed,0x00,0x00,0x6b,0x01,0x0f,0x04,0x00,
+0x71,0x7f,0xdf,0xff,0xff,0xed,0xff,0xff,0xfe,0x07,0x00,0x41,0x01,0x4e,0x02,0x03,
+0x01,0x00,0x00,0x3c,0x02,0x21,0xff,0xd8,0x5a,0x02,0x04,0x01,0x00,0x4f,0x3f,0xff,
+0xff,0xfd,0x23,0x00,0xff,0x63,0x43,0x07,0x77,0x77,0x77,0x23,0x00,0x11,0xfc,0x23,
+0x00,0x00,0xf0,0x02,0x40,0xf1,0x00,0x00,0x00,0xcd,0x02,0x11,0xc8,0x23,0x00,0x21,
+0x0e,0xff,0xee,0x02,0x00,0xc3,0x05,0x12,0xf9,0x23,0x00,0x20,0xbf,0xff,0xf7,0x03,
+0x61,0x00,0x2f,0xff,0xff,0xff,0x68,0x23,0x00,0x21,0x06,0xff,0x18,0x00,0x10,0x3d,
+0x3c,0x00,0x02,0x23,0x00,0x10,0x1f,0x0c,0x03,0x10,0xcb,0x0e,0x04,0x11,0xf9,0x44,
+0x04,0x00,0x20,0x06,0x03,0x01,0x00,0x23,0xfe,0x10,0x8c,0x00,0x14,0xbf,0x12,0x00,
+0x23,0x30,0x08,0xaf,0x00,0x13,0xaf,0x22,0x00,0x24,0x30,0x00,0xaf,0x00,0x32,0x5d,
+0xff,0xff,0x5c,0x00,0x14,0x08,0xd2,0x00,0x83,0x04,0x8c,0xef,0xff,0xda,0x61,0x00,
+0x00,0x5a,0x04,0x42,0x00,0x3b,0xee,0xb2,0x5f,0x04,0x10,0x00,0x67,0x03,0x02,0x59,
+0x04,0x51,0x0a,0xff,0xff,0xff,0x96,0x88,0x03,0x00,0x1b,0x00,0x11,0xfb,0x15,0x00,
+0x00,0xb5,0x03,0x21,0xff,0x90,0x73,0x04,0x00,0x7f,0x04,0x13,0xf3,0x78,0x04,0x3f,
+0x4c,0xff,0xc3,0x8e,0x06,0x0a,0x05,0x8c,0x04,0x10,0x04,0x81,0x00,0x01,0x0d,0x04,
+0x00,0x3f,0x00,0x1f,0xf8,0x15,0x00,0xe9,0x02,0x17,0x01,0x15,0x04,0x64,0x02,0x00,
+0x15,0x00,0x12,0xf7,0x0a,0x00,0x00,0x0a,0x02,0x11,0x60,0x0b,0x00,0x00,0x7a,0x01,
+0x10,0xf5,0x08,0x00,0x20,0x22,0x13,0xd7,0x01,0x13,0x10,0xfe,0x06,0x33,0xff,0xff,
+0xd0,0xf3,0x04,0x03,0x1f,0x00,0x01,0x15,0x00,0x24,0xfb,0x00,0x15,0x00,0x24,0xfb,
+0x10,0x15,0x00,0x12,0xe6,0x47,0x00,0x38,0x14,0x67,0x75,0x2d,0x05,0x18,0x08,0xd9,
+0x02,0x01,0x32,0x02,0x16,0xf9,0x0e,0x00,0x10,0x0b,0x4c,0x00,0x14,0xa0,0x0e,0x00,
+0x74,0x01,0xcf,0xff,0xfc,0xbf,0xff,0xfb,0x0f,0x00,0x52,0x2e,0xff,0xff,0xa0,0x0a,
+0x85,0x08,0x00,0x03,0x03,0x30,0xef,0xff,0xf8,0x72,0x00,0x22,0xfd,0x10,0xb8,0x00,
+0x61,0x88,0x88,0x50,0x00,0x00,0x05,0x06,0x00,0x0f,0x01,0x00,0x20,0x00,0x62,0x03,
+0x0f,0x0f,0x00,0xff,0x3b,0x07,0x98,0x04,0x12,0xfd,0x83,0x03,0x01,0x42,0x02,0x11,
+0x5f,0x8f,0x02,0x09,0x93,0x04,0x02,0xf7,0x01,0x00,0xf6,0x01,0x30,0x01,0xff,0xff,
+0x92,0x0a,0x09,0x8e,0x04,0x12,0x00,0x17,0x00,0x40,0xff,0xfc,0xbd,0xff,0xff,0x03,
+0x29,0x00,0x00,0x89,0x04,0x05,0x34,0x02,0x00,0x01,0x00,0x15,0xf3,0x52,0x02,0x03,
+0x84,0x04,0x01,0x01,0x00,0x10,0x05,0xc4,0x04,0x07,0x74,0x02,0x06,0x7f,0x04,0x03,
+0x55,0x02,0x03,0x41,0x02,0x53,0x3e,0xff,0xff,0xfd,0x20,0x0c,0x03,0x50,0xff,0xfe,
+0x20,0x00,0x00,0x09,0x0b,0x10,0xaf,0x0a,0x00,0x00,0x71,0x00,0x22,0x40,0x6f,0xd5,
+0x04,0x20,0xfe,0x30,0x20,0x00,0xbf,0x40,0x4b,0xbb,0xba,0x20,0x00,0x00,0x3a,0xbb,
+0xba,0x10,0x58,0x02,0x0c,0x10,0x7f,0x54,0x09,0x10,0x00,0x10,0x01,0x03,0xf2,0x00,
+0x0f,0x13,0x00,0xdc,0x10,0x08,0x1e,0x06,0x04,0x97,0x01,0x11,0xf2,0x09,0x00,0x11,
+0x0e,0xcd,0x05,0x42,0x00,0x02,0x10,0x2b,0x91,0x04,0x02,0xb1,0x01,0x14,0xf7,0xca,
+0x01,0x13,0xfe,0x7b,0x04,0x02,0x4b,0x00,0x10,0x0d,0x09,0x00,0x01,0xd3,0x03,0x00,
+0x93,0x0a,0x01,0xa0,0x01,0x33,0x02,0x57,0x76,0x80,0x0c,0x03,0x20,0x02,0x02,0x78,
+0x04,0x14,0xf2,0x0e,0x00,0x11,0x04,0x33,0x00,0x04,0x0e,0x00,0x11,0x2e,0x4c,0x02,
+0x04,0x0e,0x00,0x00,0x58,0x00,0x14,0xb0,0x0e,0x00,0x00,0x65,0x06,0x15,0xfd,0x46,
+0x00,0x12,0x6f,0x6f,0x06,0x02,0x0e,0x00,0x13,0x03,0x80,0x00,0x02,0x0e,0x00,0x12,
+0x1e,0x90,0x02,0x03,0x0e,0x00,0x11,0xbf,0x44,0x00,0x03,0x0e,0x00,0x12,0x08,0x44,
+0x00,0x03,0x0e,0x00,0x12,0x4f,0x44,0x00,0x02,0x0e,0x00,0x24,0x01,0xef,0x0f,0x01,
+0x00,0x0e,0x00,0x24,0x0c,0xff,0x63,0x05,0x03,0x64,0x07,0x24,0xff,0xb0,0x0e,0x00,
+0x25,0xf5,0xff,0x42,0x03,0x03,0xca,0x02,0x19,0xfa,0x0e,0x00,0x29,0xff,0x50,0x0e,
+0x00,0x19,0xe1,0x0e,0x00,0x19,0xfa,0x0e,0x00,0x05,0x70,0x00,0x00,0xbb,0x02,0x03,
+0x2b,0x00,0x01,0x26,0x00,0x23,0x08,0xff,0x68,0x05,0x11,0xff,0x7a,0x00,0x13,0xdf,
+0x2b,0x00,0x00,0x59,0x03,0x01,0xa4,0x03,0x25,0xff,0xe0,0xe0,0x00,0x13,0x09,0x2b,
+0x00,0x03,0x18,0x01,0x18,0xef,0x0a,0x01,0x22,0x00,0x4f,0x00,0x06,0x07,0x42,0x01,
+0x15,0xf9,0x0e,0x00,0x01,0xf1,0x00,0x15,0x30,0x6c,0x01,0x11,0x6f,0x2b,0x00,0x04,
+0x0e,0x00,0x11,0x0b,0x2b,0x00,0x04,0x0e,0x00,0x11,0x02,0x36,0x08,0x05,0xc0,0x01,
+0x10,0x7f,0x2b,0x00,0x05,0x0e,0x00,0x23,0x0c,0xff,0xa3,0x06,0x33,0x01,0x88,0x88,
+0x8b,0x06,0x03,0x34,0x00,0x19,0xd0,0x0e,0x00,0x28,0xc0,0x00,0x10,0x09,0x05,0x36,
+0x06,0x01,0xfb,0x08,0x19,0x80,0x71,0x06,0x18,0x30,0x9d,0x0e,0x17,0xfe,0x9f,0x03,
+0x37,0x5f,0xff,0xf7,0x0e,0x00,0x37,0xbf,0xff,0xe0,0x0e,0x00,0x38,0x07,0xef,0x30,
+0xca,0x03,0x90,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x53,0x6f,0xff,0xff,
+0xf6,0x00,0x01,0x00,0x54,0x06,0xff,0xff,0xff,0x60,0x0d,0x00,0x0f,0x19,0x00,0x58,
+0x53,0x3f,0xff,0xff,0xff,0xd0,0x19,0x00,0x53,0x2e,0xff,0xff,0xff,0xe2,0x19,0x00,
+0x53,0x0d,0xff,0xff,0xff,0xf3,0x32,0x00,0x53,0x0b,0xff,0xff,0xff,0xf5,0x32,0x00,
+0x53,0x08,0xff,0xff,0xff,0xf8,0x4b,0x00,0x00,0x05,0x00,0x13,0xfa,0x4b,0x00,0x53,
+0x03,0xff,0xff,0xff,0xfc,0x64,0x00,0x63,0x62,0xef,0xff,0xff,0xfe,0x10,0x19,0x00,
+0x53,0xcf,0xff,0xff,0xff,0x20,0x19,0x00,0x53,0xef,0xff,0xff,0xff,0x40,0x7d,0x00,
+0x00,0x01,0x00,0x13,0x70,0x96,0x00,0x00,0x01,0x00,0x27,0xf9,0x00,0x19,0x00,0x17,
+0xf3,0x19,0x00,0x27,0xff,0xd0,0x19,0x00,0x24,0xff,0x80,0x19,0x00,0x00,0x4c,0x00,
+0x13,0x30,0x19,0x00,0x53,0xd1,0xaf,0xff,0xff,0xfd,0x19,0x00,0x31,0xd1,0x01,0xef,
+0xa2,0x00,0x02,0xaf,0x00,0x12,0x06,0x4d,0x00,0x06,0xc8,0x00,0x14,0xd0,0xfa,0x00,
+0x11,0x2f,0x80,0x00,0x03,0xfa,0x00,0x11,0x7f,0xa5,0x00,0x03,0x13,0x01,0x10,0xdf,
+0xca,0x00,0x03,0x19,0x00,0x00,0xd7,0x00,0x14,0xf7,0x19,0x00,0x54,0x09,0xff,0xff,
+0xff,0xf2,0x45,0x01,0x6a,0x1e,0xff,0xff,0xff,0xc0,0x00,0x01,0x00,0x00,0x2f,0x00,
+0x15,0xb0,0x0d,0x00,0x35,0x3f,0xff,0xfb,0x0c,0x00,0x45,0x04,0xff,0xff,0xa0,0x0d,
+0x00,0x35,0x5f,0xff,0xf8,0x0c,0x00,0x13,0x08,0x12,0x01,0x01,0x01,0x00,0x35,0xcf,
+0xff,0xf0,0x0c,0x00,0x35,0x2f,0xff,0xf9,0x0c,0x00,0x45,0x0a,0xff,0xff,0x10,0x0d,
+0x00,0x12,0x6e,0x37,0x01,0x03,0x3f,0x00,0x04,0x56,0x00,0x03,0x28,0x01,0x10,0x0d,
+0x93,0x01,0x12,0x0f,0x0e,0x01,0x20,0x08,0xff,0x87,0x01,0x02,0x19,0x00,0x20,0x03,
+0xff,0x7b,0x01,0x02,0x19,0x00,0x00,0xe1,0x00,0x23,0xff,0x90,0x32,0x00,0x11,0x8f,
+0x07,0x00,0x02,0x19,0x00,0x12,0x3f,0x2d,0x01,0x01,0x12,0x00,0x11,0x0c,0xf9,0x00,
+0x02,0x19,0x00,0x13,0x07,0xdc,0x01,0x00,0x19,0x00,0x10,0x02,0x49,0x00,0x13,0x10,
+0x19,0x00,0x00,0xdc,0x01,0x12,0x50,0x19,0x00,0x01,0x01,0x00,0x00,0x8d,0x00,0x13,
+0x0f,0x0c,0x00,0x26,0xe1,0x00,0x19,0x00,0x27,0xf5,0x00,0x19,0x00,0x27,0xb0,0x00,
+0x32,0x00,0x17,0x60,0x19,0x00,0x22,0xff,0x20,0x19,0x00,0x23,0xe8,0x8a,0x70,0x00,
+0x01,0x64,0x00,0x03,0x89,0x00,0x02,0x96,0x00,0x12,0x2f,0xa2,0x00,0x02,0xaf,0x00,
+0x12,0x7f,0xc2,0x00,0x02,0x06,0x00,0x11,0xcf,0xd4,0x00,0x02,0x19,0x00,0x02,0xed,
+0x00,0x03,0x19,0x00,0x02,0x06,0x01,0x03,0xfa,0x00,0x01,0x1f,0x01,0x04,0x2c,0x01,
+0x10,0x3f,0x9a,0x00,0x03,0x19,0x00,0x20,0x00,0x9f,0xdc,0x01,0x63,0x00,0x00,0x04,
+0x55,0x55,0x55,0x6b,0x01,0x25,0x07,0xff,0xcd,0x01,0x17,0x01,0xec,0x01,0x45,0xbf,
+0xff,0xff,0xd1,0xc8,0x01,0x23,0xff,0xe2,0x0b,0x00,0x13,0x1e,0xb4,0x02,0x02,0x26,
+0x02,0x16,0xf4,0x0f,0x02,0x2f,0xf6,0x00,0x01,0x00,0x0a,0x00,0x8c,0x00,0x13,0xf1,
+0x0b,0x00,0x12,0x0f,0x5a,0x01,0x0f,0x17,0x00,0xff,0x21,0x22,0xfb,0xbb,0x01,0x00,
+0x25,0x0f,0xff,0x01,0x00,0x26,0xf0,0xff,0x01,0x00,0x0f,0x17,0x00,0x10,0xa2,0x00,
+0x00,0x01,0x55,0x55,0x55,0x40,0x00,0x00,0x0c,0x95,0x02,0x11,0x6f,0x75,0x02,0x11,
+0x01,0x55,0x02,0x00,0x38,0x04,0x12,0xfb,0xef,0x01,0x00,0x05,0x02,0x41,0xef,0xff,
+0xfd,0x10,0xe6,0x01,0x1d,0xe2,0xcd,0x01,0x15,0x0f,0xb8,0x02,0x0f,0x07,0x00,0xdf,
+0x0f,0xc9,0x02,0xff,0x77,0x0e,0x01,0x00,0x05,0xaf,0x04,0x14,0xfa,0x0b,0x00,0x11,
+0x05,0xd8,0x02,0x0d,0x8e,0x06,0x17,0x07,0x20,0x08,0x34,0xaf,0xff,0xf2,0x0b,0x00,
+0x37,0x0e,0xff,0xfd,0xc8,0x06,0x16,0x70,0xae,0x06,0x16,0xe0,0x39,0x00,0x06,0xe8,
+0x04,0x26,0x01,0x99,0x0d,0x03,0x0f,0x04,0x00,0x79,0x25,0x00,0x00,0xcd,0x05,0x13,
+0xe0,0x04,0x00,0xf0,0x07,0xc0,0x02,0xff,0xff,0xa0,0x05,0xff,0xff,0x70,0x0a,0xff,
+0xff,0x20,0x0f,0xff,0xfb,0x00,0x8f,0xff,0xf3,0x00,0x5d,0xc7,0x06,0x14,0x7c,0xa6,
+0x01,0x10,0x0b,0x4a,0x06,0x03,0xa6,0x01,0x37,0xbf,0xff,0xf4,0x17,0x00,0x14,0x30,
+0x17,0x00,0x34,0xcf,0xff,0xf1,0x17,0x00,0x34,0x0f,0xff,0xfd,0xd4,0x01,0x11,0x04,
+0xac,0x08,0x02,0x17,0x00,0x01,0x4c,0x01,0x02,0x17,0x00,0x02,0xd7,0x07,0x01,0x17,
+0x00,0x45,0x01,0x9f,0xfe,0x10,0x02,0x02,0x2f,0x2b,0x30,0xd1,0x02,0xff,0x05,0x00,
+0xbb,0x01,0x00,0x6e,0x05,0x11,0x50,0x84,0x07,0x11,0x9f,0xb2,0x07,0x10,0xfc,0x12,
+0x09,0x11,0x40,0x11,0x00,0x31,0xbf,0xff,0xf2,0x11,0x00,0x52,0x0e,0xff,0xfe,0x00,
+0xff,0xd2,0x01,0x11,0x90,0x11,0x00,0x31,0x9f,0xff,0xf3,0x11,0x00,0x31,0x1f,0xff,
+0xfa,0x8b,0x02,0x51,0x01,0x8f,0xff,0x20,0x00,0x33,0x00,0x35,0x2a,0x40,0x00,0x10,
+0x02,0x04,0xd9,0x07,0x0f,0x11,0x00,0xb9,0x0f,0x01,0x02,0x71,0x34,0x07,0xdf,0xc5,
+0x17,0x00,0x02,0x10,0x09,0x02,0x17,0x00,0x02,0x24,0x0a,0x01,0x17,0x00,0x11,0x1f,
+0xb7,0x00,0x02,0x17,0x00,0x16,0xdf,0x2c,0x03,0x44,0x03,0xef,0xff,0xc0,0x17,0x00,
+0x3f,0x01,0x56,0x40,0xb9,0x02,0xad,0x0f,0x0f,0x02,0x65,0x21,0x46,0x40,0x11,0x00,
+0x41,0x01,0xdf,0xff,0xd1,0x11,0x00,0x40,0xaf,0xff,0xff,0xa0,0x11,0x00,0x40,0x0e,
+0xff,0xff,0xfe,0x11,0x00,0x00,0x73,0x01,0x10,0xd0,0x11,0x00,0x51,0x07,0xff,0xff,
+0xf7,0x0f,0xf1,0x0c,0x2f,0xdf,0xd6,0xb9,0x02,0x68,0x50,0xc0,0x00,0x00,0x00,0x00,
+0x73,0x00,0x02,0xff,0xff,0xff,0xd0,0x00,0x01,0x00,0x0f,0x0d,0x00,0x75,0x16,0x03,
+0x0d,0x00,0x36,0xd1,0x6a,0xfe,0x0d,0x00,0x3e,0xff,0xff,0xfe,0x0d,0x00,0x21,0x03,
+0x8d,0x0d,0x00,0x11,0xe8,0x0d,0x00,0x10,0x5f,0x0b,0x00,0x36,0xfc,0x72,0x00,0x0d,
+0x00,0x04,0x5b,0x00,0x09,0x0d,0x00,0x2f,0x4a,0x53,0xdd,0x00,0x65,0x21,0xfb,0xbb,
+0x01,0x00,0x13,0xb8,0xc3,0x00,0x11,0xff,0xb0,0x00,0x0f,0x0d,0x00,0x22,0x6f,0x03,
+0xff,0xff,0xff,0x90,0x00,0x07,0x00,0x47,0x11,0x04,0x07,0x00,0x21,0xba,0xfe,0x07,
+0x00,0x14,0xff,0x07,0x00,0x21,0x04,0xaf,0x6d,0x01,0x10,0x4f,0x06,0x00,0x21,0xc4,
+0x00,0x07,0x00,0x14,0x90,0x07,0x00,0x2f,0x39,0x33,0x93,0x00,0x4c,0x05,0x07,0x00,
+0x12,0x00,0xfa,0x01,0x54,0x55,0x55,0x55,0x30,0x00,0x01,0x00,0x55,0x2f,0xff,0xff,
+0xfe,0x20,0x0e,0x00,0x45,0xcf,0xff,0xff,0xf3,0x0d,0x00,0x55,0x06,0xff,0xff,0xff,
+0x40,0x0e,0x00,0x55,0x1e,0xff,0xff,0xf6,0x00,0x01,0x00,0x45,0xaf,0xff,0xff,0x70,
+0x0d,0x00,0x46,0x04,0xff,0xff,0xf9,0x1b,0x00,0x5f,0x0e,0xff,0xff,0xb0,0x00,0x01,
+0x00,0x0d,0x15,0xff,0x4e,0x00,0x40,0x3f,0xff,0xff,0xfc,0x23,0x01,0x18,0x10,0x0e,
+0x00,0x29,0xff,0x90,0x0e,0x00,0x19,0xf3,0x0e,0x00,0x19,0xfd,0x0e,0x00,0x29,0xff,
+0x70,0x0e,0x00,0x19,0xf1,0x0e,0x00,0x19,0xfa,0x0e,0x00,0x29,0xff,0x40,0x0e,0x00,
+0x19,0xd0,0x0e,0x00,0x19,0xf8,0x0e,0x00,0x25,0xff,0x20,0x0e,0x00,0x21,0xf7,0xff,
+0xd1,0x00,0x03,0x0e,0x00,0x56,0xf1,0xcf,0xff,0xff,0xf5,0x0e,0x00,0x00,0x3f,0x01,
+0x06,0x0e,0x00,0x55,0x08,0xff,0xff,0xff,0x80,0x0e,0x00,0x56,0x00,0xef,0xff,0xff,
+0xf2,0x0e,0x00,0x10,0x5f,0x7f,0x02,0x05,0x0e,0x00,0x55,0x0b,0xff,0xff,0xff,0x60,
+0x0e,0x00,0x00,0xa3,0x02,0x15,0xe1,0x0e,0x00,0x56,0x00,0x7f,0xff,0xff,0xf9,0x0e,
+0x00,0x55,0x0d,0xff,0xff,0xff,0x7f,0x0e,0x00,0x13,0x04,0xca,0x02,0x03,0xec,0x00,
+0x19,0xaf,0x0e,0x00,0x19,0x1f,0x0e,0x00,0x19,0x06,0x0e,0x00,0x29,0x00,0xcf,0x0e,
+0x00,0x19,0x3f,0x0e,0x00,0x19,0x09,0x0e,0x00,0x28,0x01,0xef,0x0e,0x00,0x29,0x00,
+0x6f,0x0e,0x00,0x19,0x0c,0x0e,0x00,0x19,0x02,0x0e,0x00,0x20,0x00,0x8f,0xe5,0x00,
+0x00,0x01,0x00,0x00,0xc4,0x00,0x16,0xfb,0x64,0x02,0x13,0xfd,0x0b,0x00,0x15,0x0b,
+0xea,0x01,0x22,0x00,0x05,0x66,0x01,0x04,0x70,0x00,0x16,0x40,0x5a,0x02,0x13,0x50,
+0x0b,0x00,0x15,0x4f,0x65,0x02,0x00,0xb5,0x02,0x1f,0x40,0x4f,0x02,0x08,0x10,0x8f,
+0xce,0x01,0x60,0x49,0xde,0xfe,0xc7,0x10,0x00,0x84,0x01,0x11,0x02,0xeb,0x00,0x10,
+0x60,0x17,0x00,0x12,0xf4,0x2f,0x01,0x26,0x60,0x08,0x05,0x04,0x25,0x10,0x8f,0x0b,
+0x00,0x11,0xf8,0x17,0x00,0x30,0xea,0x99,0xdf,0x0f,0x02,0x11,0x8f,0x78,0x02,0x00,
+0xb9,0x00,0x23,0xff,0x08,0x83,0x02,0x00,0x10,0x03,0x12,0x8f,0x80,0x02,0x00,0x13,
+0x00,0x52,0x48,0xff,0xff,0xff,0x30,0x11,0x01,0x13,0xf5,0x17,0x00,0x00,0x64,0x01,
+0x1f,0x58,0x17,0x00,0x99,0x0f,0x7a,0x03,0xff,0xd0,0x0f,0x01,0x00,0x08,0x10,0x07,
+0x26,0x01,0x08,0x0e,0x00,0x19,0x70,0x0e,0x00,0x16,0x60,0x0e,0x00,0x18,0x09,0xfc,
+0x05,0x00,0x34,0x01,0x16,0x10,0x0e,0x00,0x19,0x0f,0x6a,0x00,0x18,0x6f,0x18,0x06,
+0x49,0x00,0xdf,0xff,0xd0,0x98,0x03,0x08,0xb6,0x03,0x2f,0x02,0xa8,0xaf,0x03,0xff,
+0x20,0x0e,0xcd,0x01,0x07,0x87,0x01,0x17,0xff,0x50,0x07,0x16,0xe0,0x17,0x00,0x17,
+0xfd,0x3b,0x09,0x25,0xb0,0x00,0x4d,0x05,0x17,0xf8,0xdc,0x01,0x05,0x01,0x08,0x54,
+0xef,0xff,0xc0,0x00,0x00,0xb2,0x05,0x15,0xf4,0xd2,0x07,0x26,0xdf,0xfb,0x68,0x00,
+0x24,0x6c,0x10,0x22,0x02,0x96,0x88,0x88,0x60,0x00,0x00,0x06,0x88,0x88,0x71,0xf6,
+0x07,0x13,0x9f,0x44,0x02,0x00,0xd6,0x02,0x24,0x90,0x09,0x5c,0x04,0x00,0x72,0x08,
+0x26,0xf9,0x9f,0xca,0x05,0x01,0xf3,0x02,0x15,0xf5,0x82,0x08,0x04,0x12,0x04,0x05,
+0x1d,0x00,0x16,0xf4,0x6e,0x00,0x4f,0x03,0x88,0x88,0x30,0x3f,0x08,0xff,0xec,0x11,
+0x4f,0xa5,0x04,0x11,0x9f,0x8f,0x04,0x10,0x3f,0x0c,0x00,0x03,0x49,0x02,0x53,0x3e,
+0xff,0xff,0x90,0x9f,0x39,0x02,0x62,0x2e,0xff,0xff,0xdf,0xff,0xfe,0x29,0x02,0x26,
+0x2d,0xff,0xc4,0x0a,0x44,0x1d,0xff,0xff,0xfd,0xaf,0x02,0x4e,0x1a,0xbb,0xba,0x10,
+0x4a,0x02,0x0f,0x3f,0x08,0xff,0x28,0x50,0x00,0x6f,0xff,0xff,0xf5,0x56,0x00,0xcf,
+0xff,0xf2,0x00,0x01,0x00,0x0a,0x0e,0x00,0x37,0xdf,0xff,0xf1,0x0e,0x00,0x36,0xef,
+0xff,0xf0,0x0d,0x00,0x46,0x01,0xff,0xff,0xb0,0x0e,0x00,0x46,0x06,0xff,0xff,0x60,
+0x0e,0x00,0x37,0x0c,0xff,0xfe,0x37,0x00,0x37,0x5f,0xff,0xf7,0x0e,0x00,0x47,0x18,
+0xff,0xc0,0x00,0x01,0x00,0x38,0x29,0x10,0x00,0x01,0x00,0xa3,0x08,0xff,0xff,0xfd,
+0x00,0x04,0x9d,0xef,0xec,0x71,0x0e,0x00,0x52,0xff,0x02,0xcf,0xff,0xff,0x5d,0x00,
+0x00,0x0e,0x00,0x20,0x4f,0xff,0x01,0x00,0x13,0xf6,0x0e,0x00,0x03,0x01,0x00,0x19,
+0x10,0x0e,0x00,0x13,0x80,0x0e,0x00,0x72,0xea,0x99,0xdf,0xff,0xff,0xff,0xd0,0x0e,
+0x00,0x82,0xf9,0x00,0x00,0x07,0xff,0xff,0xff,0xf0,0x0e,0x00,0x11,0x90,0xe9,0x00,
+0x22,0xff,0xf3,0x0e,0x00,0x86,0x30,0x00,0x00,0x00,0x8f,0xff,0xff,0xf4,0x0e,0x00,
+0x4f,0x6f,0xff,0xff,0xf5,0x0e,0x00,0xcd,0x11,0xff,0x12,0x00,0x00,0x01,0x00,0x89,
+0x4f,0xff,0xff,0xfc,0xff,0xff,0xff,0xfe,0x0e,0x00,0x29,0xff,0x80,0x0e,0x00,0x19,
+0xf2,0x0e,0x00,0x19,0xfb,0x0e,0x00,0x29,0xff,0x50,0x0e,0x00,0x19,0xe0,0x0e,0x00,
+0x19,0xf8,0x0e,0x00,0x29,0xff,0x20,0x0e,0x00,0x19,0xb0,0x0e,0x00,0x16,0xf5,0x0e,
+0x00,0x12,0xfc,0x8f,0x00,0x03,0x0e,0x00,0x12,0xf3,0x8f,0x00,0x03,0x0e,0x00,0x21,
+0xf1,0x8f,0x8f,0x00,0x04,0x0e,0x00,0x11,0x0e,0x8f,0x00,0x04,0x0e,0x00,0x11,0x05,
+0x8f,0x00,0x04,0x0e,0x00,0x20,0x00,0xbf,0x8f,0x00,0x05,0x0e,0x00,0x10,0x2f,0x8f,
+0x00,0x05,0x0e,0x00,0x10,0x08,0x8f,0x00,0x04,0x0e,0x00,0x00,0xdd,0x02,0x26,0xff,
+0xb0,0x0e,0x00,0x46,0x5f,0xff,0xff,0xf4,0x0e,0x00,0x55,0x0b,0xff,0xff,0xfd,0x5f,
+0x0e,0x00,0x55,0x02,0xff,0xff,0xff,0xcf,0x0e,0x00,0x00,0x3b,0x02,0x16,0xff,0x0e,
+0x00,0x19,0x0e,0x0e,0x00,0x19,0x05,0x0e,0x00,0x29,0x00,0xcf,0x0e,0x00,0x19,0x2f,
+0x0e,0x00,0x19,0x09,0x0e,0x00,0x29,0x00,0xef,0x0e,0x00,0x19,0x5f,0x0e,0x00,0x19,
+0x0c,0x0e,0x00,0x19,0x03,0x0e,0x00,0x56,0x00,0x9f,0xff,0xff,0xfc,0x50,0x03,0x14,
+0x4f,0xad,0x01,0x04,0x47,0x00,0x06,0x0e,0x00,0x00,0xb9,0x00,0x18,0xfa,0xeb,0x03,
+0x05,0xa7,0x03,0x30,0x03,0x54,0x5c,0x76,0x01,0x03,0x0e,0x00,0x11,0x07,0xc4,0x00,
+0x16,0xd0,0xa1,0x03,0x03,0x8f,0x03,0x05,0xb5,0x00,0x05,0x53,0x00,0x10,0x0a,0x0e,
+0x00,0x13,0xa0,0x0e,0x00,0x00,0x35,0x01,0x25,0xff,0xd5,0x5f,0x00,0x80,0x02,0x56,
+0x77,0x52,0x00,0x00,0x00,0x7f,0x91,0x01,0x51,0x17,0xce,0xfe,0xc7,0x10,0x58,0x00,
+0x20,0x00,0x7f,0x79,0x02,0x10,0x50,0x07,0x00,0x22,0xf0,0xaf,0x4c,0x02,0x00,0x17,
+0x00,0x11,0x9f,0x0b,0x00,0x35,0xfe,0x10,0x7f,0xd5,0x03,0x21,0xf8,0x07,0x6a,0x00,
+0x01,0xd3,0x03,0x21,0xe0,0x7f,0x10,0x02,0x00,0xc6,0x02,0x62,0xff,0x27,0xff,0xff,
+0xff,0x70,0x5a,0x01,0x22,0xf5,0x7f,0x43,0x02,0x00,0x2a,0x00,0x12,0x67,0x96,0x02,
+0x00,0xff,0x00,0x13,0xf7,0x17,0x00,0x56,0x04,0xff,0xff,0xff,0x87,0x17,0x00,0x1f,
+0xf8,0x17,0x00,0x8e,0x03,0x39,0x01,0x15,0x04,0x8c,0x03,0x09,0x17,0x00,0x13,0x06,
+0xf9,0x00,0x03,0x57,0x02,0x11,0xf4,0x09,0x00,0x32,0x22,0x12,0x9f,0x0f,0x05,0x04,
+0xb6,0x01,0x14,0xb0,0xe9,0x01,0x04,0x22,0x00,0x01,0xb1,0x01,0x12,0xf9,0x37,0x00,
+0x16,0xaf,0x0b,0x00,0x00,0xac,0x01,0x13,0xc4,0x4e,0x00,0x33,0x15,0x77,0x65,0x94,
+0x05,0x04,0x7f,0x01,0x1f,0xb0,0x0f,0x00,0x19,0x2f,0xa0,0x00,0x01,0x00,0x2f,0x74,
+0x02,0x7a,0xde,0xff,0xdb,0x72,0x00,0x02,0x01,0x11,0xcf,0x59,0x00,0x13,0xc5,0x78,
+0x06,0x13,0xaf,0x69,0x00,0x11,0xb1,0x0f,0x00,0x14,0x2d,0x22,0x02,0x20,0xfe,0x30,
+0x1d,0x00,0x15,0xef,0x32,0x02,0x13,0xe2,0x29,0x03,0x21,0xff,0xff,0x14,0x00,0x13,
+0xfd,0xa3,0x00,0x51,0xf8,0x20,0x00,0x27,0xff,0x03,0x06,0x10,0x01,0x35,0x00,0x00,
+0x90,0x04,0x11,0x1d,0xe0,0x04,0x14,0x08,0xe6,0x04,0x20,0x01,0xef,0x17,0x01,0x15,
+0x0e,0x77,0x01,0x10,0x6f,0xa8,0x02,0x14,0x3f,0x58,0x01,0x01,0x19,0x00,0x25,0x40,
+0x7f,0xf6,0x02,0x10,0x09,0x4c,0x00,0x15,0xaf,0x98,0x01,0x10,0x06,0x11,0x01,0x15,
+0xcf,0x5b,0x05,0x10,0x03,0xaf,0x02,0x15,0xef,0x4c,0x03,0x10,0x02,0x83,0x06,0x05,
+0x4e,0x05,0x2a,0x00,0x01,0x0f,0x00,0x10,0x00,0xc5,0x03,0x0e,0x0f,0x00,0x08,0x2d,
+0x00,0x0b,0x4b,0x00,0x1a,0xdf,0x69,0x00,0x0a,0x87,0x00,0x1b,0xc0,0xa5,0x00,0x0a,
+0xc3,0x00,0x16,0x50,0xe1,0x00,0x00,0x5d,0x04,0x0a,0xff,0x00,0x16,0xfa,0x1d,0x01,
+0x12,0x1c,0x0a,0x04,0x00,0x3b,0x01,0x52,0xf7,0x10,0x00,0x16,0xef,0xe2,0x01,0x11,
+0x0c,0x72,0x01,0x12,0xde,0xa6,0x03,0x09,0x77,0x01,0x19,0xf3,0x95,0x01,0x29,0xff,
+0x30,0xb3,0x01,0x19,0xc2,0xd1,0x01,0x16,0xd5,0xef,0x01,0x46,0xdf,0xff,0xeb,0x83,
+0x96,0x04,0x05,0x48,0x02,0x04,0xd6,0x07,0x1c,0xfa,0x19,0x00,0x13,0x07,0x0c,0x00,
+0x1f,0xf9,0x61,0x02,0x24,0x68,0x01,0x6a,0xdf,0xfe,0xda,0x61,0xd2,0x04,0x11,0xf9,
+0x1b,0x01,0x17,0x3e,0x4c,0x02,0x14,0x3f,0xc4,0x00,0x45,0x40,0x00,0x00,0x1e,0x66,
+0x02,0x11,0x20,0xe6,0x04,0x31,0xfe,0xa8,0xae,0xf9,0x04,0x12,0x02,0x84,0x00,0x11,
+0x08,0x60,0x03,0x12,0x9f,0xa9,0x00,0x10,0x09,0xa4,0x00,0x13,0x0e,0x6d,0x01,0x10,
+0x0f,0xc2,0x08,0x00,0x8d,0x01,0x03,0x71,0x03,0x14,0xf3,0xc3,0x03,0x00,0xa2,0x01,
+0x14,0x66,0x4a,0x05,0x07,0x06,0x04,0x01,0xca,0x01,0x13,0x86,0x55,0x07,0x00,0x84,
+0x00,0x22,0xf8,0x5f,0xf0,0x08,0x01,0x09,0x04,0x13,0x74,0xb5,0x01,0x00,0x95,0x02,
+0x23,0xf6,0x1f,0xe0,0x01,0x10,0x0a,0x68,0x01,0x12,0xdf,0x01,0x06,0x00,0x38,0x06,
+0x11,0xf0,0x82,0x00,0x02,0x32,0x01,0x11,0xfb,0x66,0x06,0x12,0x80,0xc1,0x01,0x11,
+0x40,0xf3,0x03,0x31,0xe9,0x89,0xdf,0x91,0x00,0x06,0xb5,0x01,0x12,0xf2,0x76,0x00,
+0x14,0xff,0x27,0x04,0x13,0x02,0x1a,0x00,0x11,0xe3,0x2b,0x01,0x02,0x78,0x01,0x12,
+0x91,0x2d,0x01,0x55,0x16,0xad,0xef,0xed,0xb6,0x1f,0x04,0x11,0xf5,0x96,0x00,0x14,
+0xa0,0x5d,0x06,0x11,0xfa,0x0a,0x01,0x03,0xad,0x04,0x10,0x1f,0x0a,0x00,0x13,0x6f,
+0x02,0x02,0x02,0x16,0x01,0x17,0xef,0x2c,0x06,0x02,0x03,0x02,0x14,0xd1,0x0f,0x00,
+0x11,0x1a,0xdf,0x05,0x06,0x0c,0x0a,0x5f,0x39,0xce,0xff,0xd9,0x30,0x3d,0x04,0xff,
+0xff,0x23,0x11,0xf4,0x93,0x02,0x12,0x90,0xc7,0x00,0x10,0x90,0x0f,0x09,0x13,0xf7,
+0x8e,0x02,0x32,0x82,0x02,0x8f,0x80,0x0a,0x28,0x00,0x9f,0xaa,0x06,0x02,0x4f,0x00,
+0x15,0xc1,0x3d,0x09,0x02,0x3d,0x00,0x00,0x01,0x00,0x5f,0x17,0xbd,0xed,0xb7,0x20,
+0x56,0x04,0xff,0x57,0x50,0xb6,0x10,0x00,0x00,0x00,0x10,0x00,0x01,0x00,0xa1,0x08,
+0xff,0xff,0xf5,0x00,0x7f,0xff,0xff,0x80,0x00,0x01,0x00,0x92,0x2f,0xff,0xff,0x90,
+0x03,0xff,0xff,0xfa,0x00,0x01,0x00,0x82,0xcf,0xff,0xfd,0x00,0x0d,0xff,0xff,0xc0,
+0x0e,0x00,0x92,0x06,0xff,0xff,0xf2,0x00,0xaf,0xff,0xfd,0x10,0x0f,0x00,0x83,0x1e,
+0xff,0xff,0x50,0x06,0xff,0xff,0xe2,0x2c,0x00,0x30,0x9f,0xff,0xf9,0x3f,0x00,0x12,
+0x30,0x0e,0x00,0x10,0x03,0x36,0x00,0x43,0xdf,0xff,0xf4,0x00,0x01,0x00,0x20,0x11,
+0x11,0x04,0x00,0x2f,0x10,0x00,0x01,0x00,0x12,0x64,0x02,0x7a,0xde,0xff,0xdb,0x72,
+0x0e,0x00,0x30,0x04,0xcf,0xff,0x01,0x00,0x12,0xc5,0x0e,0x00,0x32,0x01,0xaf,0xff,
+0x01,0x00,0x11,0xb1,0x0f,0x00,0x23,0x2d,0xff,0x01,0x00,0x20,0xfe,0x30,0x1d,0x00,
+0x14,0xef,0x0f,0x00,0x01,0x97,0x00,0x11,0x0c,0x0a,0x00,0x01,0x14,0x00,0x30,0xfd,
+0x00,0x00,0xe7,0x00,0x50,0xff,0xf8,0x20,0x00,0x27,0x10,0x00,0x30,0x90,0x00,0x01,
+0x35,0x00,0x60,0x20,0x00,0x00,0x00,0x1d,0xff,0xd8,0x00,0x11,0x08,0x06,0x00,0x03,
+0x44,0x00,0x44,0xf9,0x00,0x0e,0xff,0x14,0x01,0x92,0x6f,0xff,0xff,0xff,0x00,0x3f,
+0xff,0xff,0xff,0xbd,0x00,0x00,0x19,0x00,0x52,0x40,0x7f,0xff,0xff,0xfb,0x8f,0x00,
+0x10,0x09,0x4c,0x00,0x45,0xaf,0xff,0xff,0xf8,0x23,0x01,0x30,0xff,0xb0,0xcf,0x54,
+0x01,0x04,0x06,0x01,0x63,0xff,0xe0,0xef,0xff,0xff,0xf3,0xd8,0x00,0x43,0xff,0xff,
+0xff,0xf0,0x68,0x00,0x00,0x6a,0x00,0x0a,0x0f,0x00,0x5e,0x00,0xff,0xff,0xff,0xf1,
+0x0f,0x00,0x08,0x2d,0x00,0x0b,0x4b,0x00,0x1a,0xdf,0x69,0x00,0x0a,0x87,0x00,0x1b,
+0xc0,0xa5,0x00,0x0a,0xc3,0x00,0x16,0x50,0xe1,0x00,0x10,0x5f,0xe1,0x00,0x09,0xff,
+0x00,0x16,0xfa,0x1d,0x01,0x21,0x1c,0xff,0x73,0x00,0x00,0x3b,0x01,0x40,0xf7,0x10,
+0x00,0x16,0x4c,0x01,0x13,0xa0,0x59,0x01,0x21,0xfe,0xde,0x06,0x00,0x19,0x10,0x77,
+0x01,0x19,0xf3,0x95,0x01,0x29,0xff,0x30,0xb3,0x01,0x19,0xc2,0xd1,0x01,0x16,0xd5,
+0xef,0x01,0x44,0xdf,0xff,0xeb,0x83,0xfe,0x01,0x00,0xae,0x00,0x14,0xf4,0x93,0x02,
+0x10,0x03,0xd3,0x00,0x11,0x3f,0x74,0x00,0x00,0x8e,0x02,0x10,0xfc,0x75,0x02,0x12,
+0xb0,0x96,0x01,0x60,0xfe,0x10,0x0b,0xff,0xff,0xd0,0x0c,0x00,0x80,0x1f,0xff,0xff,
+0x40,0x07,0xff,0xff,0xe1,0x0c,0x00,0x53,0x0a,0xff,0xff,0x80,0x03,0xcb,0x00,0x54,
+0x04,0xff,0xff,0xc0,0x01,0x84,0x02,0x00,0x7d,0x02,0x3f,0x01,0x11,0x11,0x7a,0x02,
+0x0c,0x73,0x01,0x6a,0xdf,0xfe,0xda,0x61,0x00,0x1b,0x03,0x00,0x01,0x00,0x11,0xf9,
+0x34,0x01,0x17,0x3e,0x65,0x02,0x14,0x3f,0xdd,0x00,0x11,0x40,0x04,0x03,0x03,0x1a,
+0x00,0x30,0x20,0x00,0x0a,0x07,0x00,0x30,0xa8,0xae,0xff,0x77,0x01,0x10,0x02,0x3a,
+0x00,0x02,0x43,0x00,0x32,0xf4,0x00,0x9f,0x51,0x03,0x10,0x09,0x3c,0x01,0x13,0x0e,
+0x86,0x01,0x63,0x0f,0xff,0xff,0xff,0x02,0xff,0x5b,0x03,0x53,0xaf,0xff,0xff,0xf3,
+0x4f,0xbd,0x01,0x00,0xbb,0x01,0x50,0x66,0xff,0xff,0xff,0x60,0x0d,0x00,0x00,0x15,
+0x00,0x13,0x7f,0xe5,0x01,0x00,0xe3,0x01,0x10,0x86,0xba,0x01,0x12,0x00,0x84,0x00,
+0x53,0xf8,0x5f,0xff,0xff,0xf6,0xe7,0x00,0x23,0xff,0x74,0xce,0x01,0x00,0xae,0x02,
+0x23,0xf6,0x1f,0xf9,0x01,0x10,0x0a,0x81,0x01,0x40,0xdf,0xff,0xff,0xf1,0x0d,0x00,
+0x62,0xef,0xff,0xff,0xf0,0x09,0xff,0x4a,0x01,0x10,0x8f,0x21,0x00,0x12,0x2f,0x33,
+0x00,0x11,0x7f,0xc9,0x00,0x00,0xa2,0x01,0x31,0xe9,0x89,0xdf,0x91,0x00,0x06,0xce,
+0x01,0x12,0xf2,0x76,0x00,0x01,0x01,0x00,0x10,0xf4,0xa9,0x01,0x03,0x1a,0x00,0x11,
+0xe3,0x2b,0x01,0x11,0x8f,0x0c,0x00,0x12,0x91,0x2d,0x01,0x64,0x16,0xad,0xef,0xed,
+0xb6,0x10,0xb2,0x03,0x16,0x8b,0x11,0x02,0x01,0x1d,0x01,0x4a,0x00,0x00,0x00,0x07,
+0x13,0x00,0x01,0x15,0x00,0x3e,0x05,0xef,0xff,0x15,0x00,0x2e,0x8f,0xff,0x15,0x00,
+0x3e,0x07,0xff,0xff,0x15,0x00,0x10,0x4f,0x07,0x00,0x91,0xb9,0x88,0x88,0x9f,0xff,
+0xff,0xff,0xcb,0xbb,0x01,0x00,0x33,0xba,0x00,0xef,0x3b,0x01,0x00,0x68,0x01,0x13,
+0x20,0x8f,0x00,0x13,0x07,0x0f,0x04,0x09,0x15,0x00,0x12,0x0d,0xc1,0x01,0x09,0x15,
+0x00,0x00,0x57,0x01,0x2c,0xfc,0x00,0x15,0x00,0x00,0x53,0x01,0x0d,0x15,0x00,0x14,
+0x9f,0x8a,0x03,0x08,0x15,0x00,0x13,0xbf,0x6c,0x01,0x0c,0x15,0x00,0x15,0xf0,0x15,
+0x00,0x02,0x01,0x00,0x3f,0xfa,0x00,0xcf,0x15,0x00,0x4d,0x20,0x98,0x88,0x01,0x00,
+0x1a,0x85,0x15,0x00,0x0e,0x93,0x00,0x0e,0xbd,0x00,0x0e,0xe7,0x00,0x0f,0x11,0x01,
+0x13,0x0e,0x3b,0x01,0x0e,0x65,0x01,0x0f,0x8f,0x01,0x08,0x0e,0xb9,0x01,0x02,0x00,
+0x03,0x00,0x53,0x03,0x20,0x77,0x88,0x14,0x02,0x14,0xbb,0xe3,0x01,0x2e,0x07,0xff,
+0x01,0x00,0x02,0xc8,0x02,0x0d,0x15,0x00,0x3e,0x04,0xef,0xff,0x15,0x00,0x0e,0x8b,
+0x02,0x1e,0xff,0xb5,0x02,0x03,0x15,0x00,0x22,0x49,0xce,0x89,0x06,0x52,0x03,0x8c,
+0xef,0xfd,0xb7,0x97,0x00,0x30,0x05,0xdf,0xff,0xe3,0x03,0x36,0x20,0x00,0x2b,0x00,
+0x03,0x13,0x0a,0x33,0x00,0x22,0x60,0x5f,0x08,0x00,0x14,0xd2,0x7d,0x06,0x00,0x01,
+0x00,0x13,0xbf,0x08,0x00,0x12,0xe1,0x03,0x04,0x0a,0x01,0x00,0x11,0xc0,0xbf,0x03,
+0x32,0xff,0xb8,0x9c,0x0f,0x00,0x11,0xfb,0x84,0x03,0x10,0x40,0xb7,0x01,0x23,0xfc,
+0x20,0xbf,0x00,0x11,0xe3,0x72,0x01,0x01,0xb1,0x03,0x00,0x6d,0x05,0x13,0x04,0x67,
+0x05,0x00,0x9c,0x01,0x10,0xf0,0x0c,0x01,0x51,0x70,0x00,0x00,0x00,0x0b,0x76,0x04,
+0x02,0x1d,0x00,0x23,0x40,0xbf,0x00,0x05,0x12,0x5f,0x53,0x01,0x00,0x39,0x00,0x10,
+0xf6,0x57,0x01,0x04,0x38,0x06,0x50,0xfc,0xaa,0xaa,0xaa,0xab,0x39,0x00,0x04,0x80,
+0x04,0x16,0x0f,0x90,0x00,0x24,0xf8,0x0f,0xc8,0x01,0x07,0xa5,0x00,0x10,0x80,0xd6,
+0x06,0x0f,0x29,0x00,0x12,0x43,0xef,0xff,0xff,0xe0,0x48,0x08,0x02,0xf9,0x01,0x03,
+0x9c,0x00,0x10,0x10,0x39,0x01,0x15,0xff,0xa0,0x06,0x01,0xaf,0x01,0x13,0xf6,0xfb,
+0x04,0x02,0x32,0x00,0x03,0xe2,0x04,0x14,0xe1,0x61,0x05,0x13,0x90,0x15,0x00,0x00,
+0x47,0x01,0x14,0xc1,0x81,0x05,0x00,0x15,0x00,0x22,0x28,0xf6,0x18,0x02,0x33,0xfa,
+0x88,0xbf,0xfa,0x02,0x30,0x87,0x8a,0xdf,0x09,0x06,0x1d,0x9f,0x5d,0x01,0x10,0x40,
+0x34,0x06,0x03,0x59,0x01,0x14,0xff,0x09,0x00,0x03,0x75,0x00,0x00,0xd1,0x06,0x14,
+0x04,0x4c,0x04,0x00,0x26,0x01,0x11,0x5d,0x0b,0x00,0x14,0xb3,0xae,0x06,0x21,0xe8,
+0x10,0x15,0x02,0x40,0x9c,0xef,0xfd,0xc7,0xf5,0x05,0x64,0x26,0xbd,0xef,0xed,0xb7,
+0x40,0xbe,0x00,0x45,0x35,0x55,0x55,0x53,0x34,0x06,0x13,0x2f,0x2b,0x07,0x05,0xaf,
+0x00,0x14,0x30,0x0d,0x00,0x17,0x06,0x06,0x01,0x01,0x57,0x05,0x15,0x60,0x35,0x00,
+0x12,0xaf,0xb8,0x01,0x05,0xe7,0x02,0x04,0xef,0x00,0x01,0x01,0x03,0x1f,0xb0,0x22,
+0x09,0x0e,0x03,0xb9,0x00,0x39,0xed,0xa7,0x20,0x96,0x01,0x19,0xc4,0x8f,0x01,0x19,
+0xfa,0xb1,0x01,0x19,0xfc,0xaa,0x01,0x32,0xfa,0x00,0x0f,0x37,0x05,0x12,0xce,0x4f,
+0x02,0x12,0xff,0xfe,0x03,0x20,0x03,0xcf,0x23,0x06,0x14,0x0f,0x2b,0x08,0x00,0x0e,
+0x00,0x04,0x1b,0x00,0x01,0x3b,0x02,0x15,0xf2,0x1b,0x00,0x01,0xdb,0x03,0x04,0x1b,
+0x00,0x00,0x3d,0x04,0x15,0xf5,0x1b,0x00,0x19,0x0b,0x1b,0x00,0x18,0xef,0x36,0x00,
+0x18,0x4f,0x51,0x00,0x17,0x2e,0x6c,0x00,0x24,0x03,0x8f,0x87,0x00,0x04,0x01,0x00,
+0x18,0xf9,0xbd,0x00,0x18,0xfb,0xbd,0x00,0x1f,0xf9,0xf3,0x00,0x06,0x00,0x5f,0x02,
+0x02,0xd8,0x00,0x13,0xbc,0x65,0x00,0x02,0x07,0x00,0x12,0x0e,0x3c,0x02,0x03,0x6c,
+0x00,0x12,0x6f,0x63,0x04,0x03,0x22,0x00,0x15,0xdf,0x29,0x01,0x12,0x10,0xa4,0x02,
+0x15,0xf2,0x1b,0x00,0x11,0x0d,0xf8,0x02,0x04,0xbd,0x00,0x11,0x4f,0xdb,0x01,0x04,
+0xbd,0x00,0x10,0xcf,0x95,0x00,0x04,0x1b,0x00,0x11,0x04,0x21,0x07,0x04,0x1b,0x00,
+0x10,0x0b,0x58,0x03,0x05,0xf3,0x00,0x10,0x3f,0xb4,0x07,0x08,0x29,0x01,0x15,0xfd,
+0x1b,0x00,0x00,0xf1,0x02,0x13,0xf5,0xaa,0x03,0x01,0x56,0x0b,0x12,0x1e,0xe3,0x03,
+0x23,0x00,0x09,0x46,0x02,0x14,0x03,0x41,0x02,0x13,0xdf,0xf8,0x07,0x13,0x8f,0x37,
+0x02,0x13,0x2f,0x32,0x02,0x4e,0x02,0x55,0x55,0x40,0x20,0x02,0x01,0xe3,0x00,0x50,
+0xf0,0x01,0x8d,0xff,0xf0,0x82,0x02,0x40,0x14,0xff,0xff,0xfe,0x11,0x00,0x10,0xf5,
+0x6b,0x03,0x14,0x06,0x3e,0x07,0x00,0x05,0x01,0x0e,0x11,0x00,0x40,0xec,0xbb,0xb0,
+0x06,0x2e,0x0b,0x12,0x30,0x44,0x00,0x14,0xfd,0xc6,0x02,0x18,0x60,0xf8,0x05,0x0f,
+0x11,0x00,0x6d,0x0f,0xfd,0x02,0xff,0xbd,0x0f,0x01,0x00,0x08,0x37,0x1f,0xff,0xfe,
+0x9c,0x0b,0x03,0xef,0x0b,0x04,0x1b,0x00,0x16,0xfc,0x0d,0x00,0x13,0x03,0x22,0x0c,
+0x13,0x00,0xd1,0x0c,0x16,0xf7,0x0d,0x00,0x17,0x0a,0x4f,0x08,0x29,0x00,0x00,0x5c,
+0x05,0x14,0x8f,0x4d,0x0d,0x02,0xd7,0x07,0x18,0xfa,0x7a,0x00,0x90,0x7c,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x06,0xff,0xff,0xff,0x00,0x18,0xdf,0xff,0x08,
+0x00,0x40,0x14,0xff,0xff,0xfe,0x08,0x00,0x13,0x5f,0x08,0x00,0x1f,0xff,0x08,0x00,
+0x05,0x30,0xfe,0xcb,0xbb,0x08,0x00,0x40,0xfd,0x30,0x00,0x00,0x08,0x00,0x22,0xd0,
+0x00,0x08,0x00,0x1f,0x60,0x08,0x00,0x70,0x0d,0x01,0x00,0x33,0x5f,0xff,0xfa,0x08,
+0x00,0x13,0xf9,0x08,0x00,0x11,0xf8,0x08,0x00,0x31,0x7f,0xff,0xf6,0x08,0x00,0x31,
+0x9f,0xff,0xf3,0x08,0x00,0x30,0xef,0xff,0xe0,0x07,0x00,0x40,0x04,0xff,0xff,0x70,
+0x08,0x00,0x31,0x0c,0xff,0xfe,0x17,0x00,0x13,0x07,0x27,0x00,0x32,0x00,0x19,0x90,
+0x08,0x00,0xa2,0x78,0x88,0x86,0x00,0x00,0x00,0x68,0x88,0x87,0x10,0x2e,0x00,0x10,
+0xf9,0x43,0x00,0x02,0x34,0x00,0x10,0x03,0x0e,0x00,0x14,0x9f,0x88,0x00,0x00,0x0e,
+0x00,0x54,0x9f,0xff,0xff,0x50,0x00,0x0e,0x00,0x15,0xff,0x0d,0x00,0x02,0x0e,0x00,
+0x27,0x40,0x00,0x0e,0x00,0x25,0x40,0x00,0x0e,0x00,0x4f,0x88,0x88,0x30,0x00,0x01,
+0x00,0x0d,0x12,0xff,0x01,0x00,0x84,0xed,0xa7,0x20,0x00,0x00,0x00,0x0f,0xff,0x01,
+0x00,0x15,0xc4,0x1b,0x00,0x00,0x01,0x00,0x18,0xfa,0x1b,0x00,0x28,0xff,0xfc,0x1b,
+0x00,0x21,0xff,0xfa,0x1b,0x00,0x40,0xcb,0xbb,0xbb,0xce,0x0e,0x00,0x10,0xf3,0x1b,
+0x00,0x10,0xf1,0x7d,0x00,0x50,0xcf,0xff,0xff,0xff,0xa0,0x1b,0x00,0x10,0x10,0x67,
+0x00,0x00,0x0e,0x00,0x04,0x1b,0x00,0x65,0x00,0x02,0xff,0xff,0xff,0xf2,0x1b,0x00,
+0x10,0x0d,0xb5,0x00,0x04,0x1b,0x00,0x55,0x00,0xbf,0xff,0xff,0xf5,0x1b,0x00,0x19,
+0x0b,0x1b,0x00,0x18,0xef,0x36,0x00,0x18,0x4f,0x51,0x00,0x17,0x2e,0x6c,0x00,0x24,
+0x03,0x8f,0x87,0x00,0x04,0x01,0x00,0x18,0xf9,0xbd,0x00,0x18,0xfb,0xbd,0x00,0x1f,
+0xf9,0xf3,0x00,0x06,0x00,0xdb,0x01,0x02,0xd8,0x00,0x13,0xbc,0x65,0x00,0x02,0x07,
+0x00,0x73,0x0e,0xff,0xff,0xff,0x90,0x00,0x00,0x6c,0x00,0x64,0x6f,0xff,0xff,0xff,
+0x20,0x00,0x87,0x00,0x14,0xdf,0x29,0x01,0x00,0x1b,0x00,0x10,0x05,0xe4,0x00,0x05,
+0x1b,0x00,0x00,0xe4,0x00,0x14,0xb0,0x1b,0x00,0x01,0xbc,0x00,0x15,0x30,0xbd,0x00,
+0x10,0xcf,0x95,0x00,0x03,0x1b,0x00,0x00,0x08,0x02,0x25,0xff,0xf4,0x1b,0x00,0x00,
+0x00,0x01,0x15,0xc0,0xf3,0x00,0x10,0x3f,0xf8,0x01,0x08,0x29,0x01,0x15,0xfd,0x1b,
+0x00,0x00,0xf9,0x01,0x50,0xf5,0x2e,0xff,0xff,0xa0,0x8f,0x02,0x30,0xff,0x80,0x2e,
+0x6e,0x00,0x10,0x7f,0x4d,0x02,0x50,0x1d,0xff,0xff,0xb0,0x7f,0x49,0x02,0x00,0x0a,
+0x00,0x12,0xdf,0x38,0x02,0x15,0x1c,0x34,0x02,0x42,0x0c,0xff,0xff,0xfe,0x23,0x02,
+0x4f,0x09,0xbb,0xbb,0x20,0x2b,0x02,0x0c,0x00,0xee,0x00,0x64,0xf0,0x01,0x8d,0xff,
+0xf0,0x00,0xe3,0x03,0x01,0x13,0x00,0x64,0xf5,0xff,0xff,0xff,0xe0,0x00,0xd6,0x03,
+0x02,0x14,0x01,0x0f,0x13,0x00,0x01,0x44,0xec,0xbb,0xb0,0x00,0xec,0x03,0x01,0x13,
+0x00,0x38,0xfd,0x00,0x00,0x6f,0x03,0x00,0x13,0x00,0x1f,0xf6,0x13,0x00,0x81,0x23,
+0x00,0x00,0x2b,0x01,0x02,0x9c,0x03,0x04,0x1d,0x00,0x14,0x90,0x0d,0x00,0x20,0x01,
+0xef,0x6e,0x01,0x04,0x01,0x00,0x44,0xaf,0xff,0xff,0xc0,0x0d,0x00,0x00,0xe9,0x01,
+0x14,0xd1,0x0d,0x00,0x00,0x3b,0x02,0x15,0xe2,0x0d,0x00,0x10,0x08,0xa4,0x02,0x05,
+0x01,0x00,0x4f,0x45,0x55,0x52,0x00,0x01,0x00,0x10,0x62,0x16,0xac,0xef,0xff,0xdb,
+0x72,0x0c,0x00,0x22,0x04,0xbf,0x8c,0x03,0x01,0xc8,0x01,0x14,0x0a,0xb7,0x02,0x21,
+0xb1,0x00,0xe9,0x01,0x03,0x01,0x00,0x12,0xd1,0xb7,0x00,0x03,0x01,0x00,0x12,0xc0,
+0x92,0x01,0x30,0xfc,0xaa,0xcf,0x07,0x00,0x32,0x80,0x00,0xdf,0xd2,0x00,0x20,0x06,
+0xef,0x4a,0x03,0x13,0x2f,0x54,0x04,0x00,0x49,0x02,0x23,0xf6,0x04,0x8b,0x05,0x20,
+0x00,0x09,0xe8,0x00,0x11,0x4f,0x35,0x03,0x01,0xf1,0x04,0x31,0xff,0xfb,0x03,0xdb,
+0x01,0x00,0xf6,0x00,0x58,0x55,0x55,0x55,0x40,0x0f,0x08,0x01,0x00,0xb1,0x04,0x25,
+0xff,0xc3,0x16,0x01,0x01,0x6c,0x00,0x23,0x61,0x00,0xae,0x00,0x18,0xff,0x0f,0x00,
+0x13,0x04,0x8b,0x03,0x02,0xab,0x04,0x22,0x02,0xcf,0x0f,0x00,0x12,0xd4,0x1d,0x00,
+0x13,0x5c,0x1d,0x00,0x12,0x10,0xc4,0x04,0x11,0xaf,0x0e,0x00,0x13,0xfd,0x9d,0x02,
+0x21,0x05,0xaf,0x0e,0x00,0x23,0x10,0x00,0x0f,0x00,0x12,0xbf,0xc5,0x03,0x03,0x01,
+0x00,0x12,0x3d,0x74,0x03,0x03,0x01,0x00,0x00,0x08,0x01,0x23,0x75,0xff,0x9c,0x01,
+0x00,0x0e,0x03,0x24,0xfa,0x4f,0x75,0x02,0x00,0x81,0x00,0x15,0xc1,0x2d,0x00,0x00,
+0xd8,0x00,0x11,0x0c,0x21,0x01,0x03,0xe8,0x01,0x23,0xa0,0x6f,0x8f,0x00,0x10,0x2b,
+0x0e,0x01,0x01,0xbc,0x04,0x50,0xfe,0xba,0x9a,0xdf,0xff,0x29,0x01,0x26,0x02,0xef,
+0x52,0x01,0x17,0x60,0x0e,0x00,0x00,0x08,0x01,0x12,0x01,0xad,0x00,0x04,0x2a,0x02,
+0x13,0x3a,0x21,0x05,0x12,0x20,0x11,0x01,0x65,0x59,0xce,0xff,0xfe,0xc9,0x61,0x9f,
+0x00,0x11,0x8f,0x2e,0x04,0x04,0xbd,0x03,0x15,0xc0,0x66,0x02,0x04,0xdd,0x00,0x15,
+0x7f,0x2f,0x02,0x11,0x01,0x2f,0x04,0x13,0x00,0x11,0x04,0x15,0xf4,0x8f,0x06,0x05,
+0xa0,0x02,0x3f,0x35,0x55,0x53,0x38,0x02,0x0a,0x51,0x28,0xbe,0xff,0xed,0xa6,0x57,
+0x00,0x12,0x2c,0x92,0x00,0x24,0x10,0x00,0x9e,0x03,0x21,0xff,0xe3,0x4a,0x00,0x02,
+0x01,0x00,0x30,0x30,0x01,0xef,0xeb,0x00,0x10,0xff,0xff,0x01,0x51,0x07,0xff,0xff,
+0xff,0xb2,0xc6,0x04,0x21,0xf5,0x0b,0xc5,0x03,0x00,0x1b,0x03,0x21,0xfa,0x0d,0xb5,
+0x00,0x00,0xae,0x04,0x22,0xfc,0x0d,0x4d,0x01,0x53,0x02,0x22,0x22,0x21,0x0a,0x3e,
+0x05,0x04,0x90,0x06,0x24,0xea,0x63,0x10,0x02,0x00,0x6d,0x00,0x13,0x50,0x49,0x02,
+0x00,0x5b,0x00,0x00,0xb2,0x00,0x15,0x4d,0x89,0x05,0x32,0x00,0x00,0x4a,0x40,0x01,
+0x11,0xb0,0x08,0x02,0x35,0x6a,0xef,0xff,0xdf,0x00,0x10,0x05,0x4d,0x05,0x30,0x57,
+0x77,0x77,0x3d,0x00,0x52,0x1e,0xff,0xff,0xfd,0x9f,0x77,0x02,0x00,0x8b,0x00,0x02,
+0xa3,0x03,0x00,0x4f,0x03,0x10,0xfc,0x80,0x02,0x81,0x81,0x00,0x02,0xbf,0xff,0xff,
+0xf8,0x07,0x19,0x02,0x11,0xff,0xd5,0x01,0x16,0xaf,0xa1,0x01,0x13,0x09,0x0a,0x00,
+0x15,0xf6,0x79,0x00,0x11,0xfb,0x8f,0x01,0x23,0x38,0xce,0xf3,0x06,0x01,0x6d,0x00,
+0x01,0x39,0x05,0x03,0x01,0x00,0x15,0x07,0x33,0x02,0x04,0xb8,0x00,0x25,0xc1,0x00,
+0x7d,0x01,0x14,0xda,0xd1,0x03,0x00,0x45,0x05,0x24,0xc1,0x07,0xa3,0x01,0x10,0x2d,
+0x41,0x00,0x10,0x05,0x4d,0x01,0x00,0x4e,0x00,0x31,0x88,0x88,0x60,0x7d,0x07,0x1e,
+0x70,0xd4,0x03,0x0f,0xde,0x03,0xff,0xd5,0x15,0x3e,0xc5,0x00,0x25,0x04,0xff,0x32,
+0x02,0x10,0x5f,0x69,0x00,0x13,0x20,0x63,0x02,0x13,0xf9,0x2d,0x02,0x50,0x9f,0xff,
+0xfe,0x30,0x5f,0xdf,0x03,0x00,0xe6,0x01,0x31,0xd2,0x00,0x04,0x01,0x03,0x94,0x49,
+0x99,0x99,0x10,0x00,0x00,0x39,0x99,0x99,0x0a,0x01,0x0f,0xde,0x03,0xff,0x2a,0x0f,
+0x57,0x03,0xff,0xad,0x36,0xff,0xff,0xff,0x35,0x07,0x18,0x07,0x6a,0x09,0x22,0x00,
+0xbf,0xa7,0x0b,0x03,0xaa,0x05,0x18,0xbe,0x0e,0x00,0x00,0x71,0x0b,0x19,0xe0,0x2a,
+0x00,0x08,0xc8,0x0d,0x28,0xff,0xf0,0x31,0x0d,0x15,0xfa,0x1a,0x00,0x14,0x3f,0xa1,
+0x03,0x03,0xa5,0x0c,0x16,0xfc,0x13,0x0b,0x80,0x1f,0xec,0x94,0x00,0x00,0x00,0x00,
+0x00,0xf0,0x00,0x00,0x00,0x00,0x28,0xbe,0xff,0xed,0xa6,0x10,0x00,0x00,0x00,0x00,
+0x2c,0xff,0x01,0x00,0x62,0xfa,0x10,0x00,0x00,0x06,0xff,0x01,0x00,0x53,0xe3,0x00,
+0x00,0x5f,0xff,0x01,0x00,0x70,0x30,0x01,0xef,0xff,0xff,0xff,0xfe,0x0b,0x00,0xf1,
+0x24,0xd0,0x07,0xff,0xff,0xff,0xb2,0x00,0x05,0xff,0xff,0xff,0xf5,0x0b,0xff,0xff,
+0xfe,0x00,0x00,0x00,0x6f,0xff,0xff,0xfa,0x0d,0xff,0xff,0xfa,0x00,0x00,0x00,0x0f,
+0xff,0xff,0xfc,0x0d,0xff,0xff,0xfd,0x00,0x00,0x00,0x02,0x22,0x22,0x22,0x0a,0xff,
+0xff,0xff,0xc4,0x00,0x01,0x00,0x10,0x04,0x3d,0x00,0x21,0xea,0x63,0x0c,0x00,0x12,
+0xaf,0x6d,0x00,0x52,0x50,0x00,0x00,0x00,0x0a,0x61,0x00,0x62,0xfe,0x60,0x00,0x00,
+0x00,0x5e,0x0c,0x00,0x10,0xfb,0x23,0x00,0x12,0x5b,0x0c,0x00,0x11,0xb0,0x3b,0x00,
+0x10,0x7b,0x0b,0x00,0x12,0xf4,0x48,0x00,0xf0,0x08,0x06,0xef,0xff,0xff,0xfa,0x46,
+0x66,0x66,0x40,0x00,0x00,0x00,0x1e,0xff,0xff,0xfd,0x9f,0xff,0xff,0xe0,0x00,0x00,
+0x00,0x8b,0x00,0xf0,0x08,0x6f,0xff,0xff,0xf5,0x00,0x00,0x00,0x0d,0xff,0xff,0xfc,
+0x1f,0xff,0xff,0xff,0x70,0x00,0x01,0xaf,0xff,0xff,0xf8,0x07,0x3d,0x00,0x84,0xdc,
+0xdf,0xff,0xff,0xff,0xf2,0x00,0xbf,0xd1,0x00,0x33,0x60,0x00,0x09,0x0a,0x00,0x52,
+0xf6,0x00,0x00,0x00,0x4d,0x78,0x00,0x10,0x20,0x60,0x00,0x62,0x38,0xcf,0xff,0xff,
+0xa7,0x20,0x6c,0x00,0x32,0x3f,0xff,0xfd,0x09,0x00,0x01,0xe4,0x00,0x35,0xc5,0x00,
+0x00,0xbe,0x00,0x12,0x60,0x0b,0x00,0x53,0x23,0x7f,0xff,0xff,0xf0,0x17,0x00,0x10,
+0x08,0x61,0x00,0x05,0x0b,0x00,0x12,0xf3,0x0b,0x00,0x00,0x43,0x01,0x12,0xf1,0x0a,
+0x00,0x14,0x0f,0xcf,0x00,0x01,0x0b,0x00,0x25,0xfe,0x20,0x0b,0x00,0x13,0xc2,0x2b,
+0x00,0x32,0x0d,0xdb,0x83,0x09,0x00,0x11,0x09,0xed,0x00,0x13,0x1d,0x45,0x00,0x10,
+0x0b,0x0e,0x00,0x14,0x1d,0x00,0x01,0x52,0x0c,0xff,0xff,0xf5,0x1d,0xe8,0x00,0x11,
+0x00,0x24,0x00,0x12,0xfe,0xc3,0x00,0x12,0x00,0x0f,0x01,0x34,0xff,0xff,0xf7,0xb2,
+0x00,0x53,0x2e,0xff,0xff,0xff,0xf8,0x0d,0x00,0x00,0xcb,0x00,0x35,0xff,0xf9,0x00,
+0x01,0x00,0x4f,0x5d,0xee,0xea,0x00,0x01,0x00,0x10,0x63,0x16,0xac,0xef,0xff,0xdb,
+0x84,0xc0,0x01,0x12,0xbf,0xa9,0x01,0x26,0x70,0x00,0xb6,0x01,0x32,0xff,0xff,0xe4,
+0x85,0x00,0x03,0x01,0x00,0x11,0xf5,0xa0,0x00,0x04,0x01,0x00,0x12,0xf3,0x4b,0x02,
+0x31,0xfc,0xaa,0xbe,0x38,0x02,0x21,0x00,0xdf,0x94,0x01,0xc0,0x00,0x03,0xcf,0xff,
+0xff,0xff,0x40,0x2f,0xff,0xff,0xff,0x50,0x4b,0x00,0x51,0xcf,0xff,0xff,0xf9,0x04,
+0x20,0x00,0x21,0x00,0x00,0x56,0x02,0x23,0xb0,0x4f,0x03,0x02,0x72,0x00,0x16,0x66,
+0x66,0x64,0x03,0xff,0xe0,0x01,0x06,0x44,0x01,0x15,0x90,0x0e,0x00,0x54,0x9f,0xff,
+0xff,0xff,0xc3,0x0d,0x00,0x11,0x01,0x6c,0x00,0x27,0x61,0x00,0x6e,0x02,0x05,0x0f,
+0x00,0x13,0x04,0x59,0x02,0x11,0x40,0x0e,0x00,0x22,0x02,0xcf,0x0f,0x00,0x12,0xd4,
+0x1d,0x00,0x13,0x5c,0x1d,0x00,0x11,0x10,0x0e,0x00,0x12,0x03,0x9c,0x02,0x13,0xfd,
+0x9f,0x01,0x21,0x05,0xaf,0x0e,0x00,0x23,0x10,0x00,0x0f,0x00,0x28,0xbf,0xff,0x48,
+0x01,0x10,0x3d,0x55,0x02,0x44,0x14,0x44,0x44,0x42,0x8d,0x01,0x25,0xff,0x75,0xe5,
+0x01,0x52,0x7f,0xff,0xff,0xfa,0x3f,0x20,0x03,0x02,0x81,0x00,0x14,0xc0,0xc4,0x02,
+0x00,0x14,0x02,0x63,0xfb,0x0b,0xff,0xff,0xff,0xd1,0xd1,0x01,0xb1,0xff,0xa0,0x4f,
+0xff,0xff,0xff,0xd5,0x00,0x00,0x00,0x2b,0x91,0x02,0x01,0x6a,0x01,0x30,0xba,0x9a,
+0xdf,0x07,0x00,0x36,0x00,0x01,0xdf,0x52,0x01,0x18,0x60,0x0e,0x00,0x13,0x90,0x02,
+0x01,0x01,0x01,0x00,0x01,0x96,0x01,0x22,0x2a,0xff,0x58,0x03,0x03,0xbc,0x00,0x63,
+0x59,0xce,0xff,0xfe,0xc9,0x61,0x71,0x00,0x11,0x70,0xb8,0x02,0x10,0x50,0x8a,0x00,
+0x10,0xf7,0xbf,0x01,0x12,0xf4,0x14,0x02,0x50,0x80,0xaf,0xff,0xfe,0x30,0xf7,0x00,
+0x65,0xef,0xff,0xfd,0xff,0xff,0xe2,0x39,0x02,0x03,0xf2,0x00,0x53,0x02,0xef,0xff,
+0xff,0xc1,0xed,0x00,0x4f,0x1b,0xbb,0xb9,0x00,0x01,0x00,0x14,0x0f,0x57,0x04,0x4c,
+0x17,0x21,0x57,0x04,0x17,0x03,0x57,0x04,0x16,0x9f,0x57,0x04,0x17,0x09,0x57,0x04,
+0x17,0x4d,0x57,0x04,0x26,0x4a,0xef,0x57,0x04,0x36,0x02,0x6a,0xef,0x57,0x04,0x9f,
+0x05,0xdf,0xff,0xff,0xfa,0x57,0x77,0x77,0x50,0x57,0x04,0x02,0x00,0x62,0x03,0x40,
+0x0e,0xff,0xff,0xfc,0x80,0x02,0x44,0x81,0x00,0x02,0xbf,0x57,0x04,0x21,0xfd,0xff,
+0x57,0x04,0x1f,0xaf,0x57,0x04,0x10,0x30,0xce,0xff,0xed,0x57,0x04,0x28,0x1f,0xff,
+0x01,0x00,0x19,0xb1,0x0e,0x00,0x1f,0xfb,0x1d,0x00,0x18,0x20,0xb0,0xbb,0x01,0x00,
+0x40,0xef,0xff,0xff,0xfc,0x08,0x00,0x24,0xb8,0x00,0x4b,0x02,0x16,0x40,0x86,0x01,
+0x15,0xcf,0xdd,0x00,0x0f,0x1d,0x00,0xff,0x6b,0x46,0x00,0xef,0xff,0xf3,0x0e,0x00,
+0x00,0x01,0x02,0x16,0xd8,0x0e,0x00,0x10,0x05,0xa6,0x04,0x07,0x1e,0x00,0x15,0x3b,
+0xdb,0x05,0x01,0x01,0x00,0x49,0x2f,0xff,0xff,0x80,0x2d,0x00,0x16,0xf8,0x0e,0x00,
+0x14,0x59,0x42,0x05,0x13,0x00,0x26,0x06,0x02,0x43,0x05,0x05,0xa4,0x06,0x02,0xcd,
+0x03,0x03,0x51,0x06,0x27,0xfe,0x81,0x56,0x00,0x25,0x47,0x53,0x0b,0x00,0x43,0x88,
+0x88,0x88,0x50,0x96,0x00,0x14,0xfb,0x46,0x05,0x1f,0xb0,0x11,0x00,0x11,0x04,0xe8,
+0x05,0x13,0x00,0x4d,0x05,0x1f,0xf0,0x11,0x00,0x07,0x0e,0x55,0x00,0x0f,0x11,0x00,
+0x4b,0x14,0x0f,0x53,0x01,0x13,0xff,0x92,0x07,0x10,0x0e,0x3f,0x03,0x23,0xab,0x30,
+0x78,0x08,0x14,0xf5,0x10,0x06,0x12,0x50,0x36,0x01,0x01,0x71,0x01,0x13,0x0b,0x11,
+0x00,0x00,0xbb,0x07,0x20,0xfc,0x92,0x35,0x00,0x35,0x8f,0xff,0xfa,0xdc,0x01,0x01,
+0x84,0x01,0x14,0x9b,0x67,0x05,0x23,0x01,0xef,0x17,0x08,0x13,0x0c,0xfd,0x07,0x13,
+0x06,0xe7,0x05,0x13,0x4f,0x96,0x05,0x00,0x5f,0x00,0x13,0xe1,0x75,0x07,0x11,0xc1,
+0x6a,0x04,0x31,0xfe,0xc9,0x30,0x08,0x00,0x94,0x88,0x88,0x84,0x00,0x00,0x01,0x78,
+0x88,0x87,0x27,0x08,0x71,0xf5,0x00,0x01,0xcf,0xff,0xff,0x30,0x0f,0x00,0x62,0x07,
+0xff,0xff,0xf5,0x01,0xcf,0x90,0x05,0x02,0x0f,0x00,0x25,0xf6,0xdf,0x28,0x08,0x00,
+0x0f,0x00,0x06,0x36,0x08,0x02,0x0f,0x00,0x05,0x97,0x06,0x01,0x0f,0x00,0x27,0xfd,
+0x10,0x2a,0x02,0x3f,0x88,0x87,0x10,0xa7,0x05,0x0f,0x0f,0x8c,0x04,0xff,0xe1,0x23,
+0x00,0x1f,0x92,0x08,0x0a,0x0a,0x00,0x15,0xfd,0x70,0x04,0x15,0xfb,0xb8,0x0a,0x15,
+0xf7,0x66,0x09,0x04,0xd7,0x0a,0x32,0xff,0xff,0xc0,0x32,0x04,0x10,0x07,0x63,0x00,
+0x01,0x70,0x03,0x34,0x05,0xdf,0xfa,0x7a,0x03,0x27,0x07,0xc0,0x84,0x03,0x0f,0x0a,
+0x00,0x0b,0x04,0x23,0x04,0x0f,0x0a,0x00,0x17,0x0e,0x5a,0x00,0x0f,0x0a,0x00,0x5e,
+0x21,0x00,0xff,0x00,0x01,0x07,0x59,0x04,0x00,0xdc,0x05,0x00,0xaa,0x09,0x15,0xb3,
+0xd4,0x0c,0x14,0xf5,0x07,0x04,0x24,0xff,0xf5,0x95,0x05,0x03,0xd0,0x05,0x15,0xbf,
+0x0a,0x00,0x5f,0x04,0xad,0xff,0xec,0x92,0x7d,0x03,0xa0,0x17,0xcf,0x78,0x0a,0x06,
+0x00,0x06,0x1f,0xf9,0x1d,0x00,0x10,0x9f,0x35,0x55,0x5d,0xff,0xff,0xff,0x85,0x55,
+0x20,0x7d,0x03,0xe1,0x50,0x00,0x00,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x08,0x88,
+0x88,0x85,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0xff,0xb0,0x09,0x00,0x4f,0x1f,0xff,
+0xff,0xfb,0x11,0x00,0x12,0x21,0xcf,0xff,0x01,0x00,0x32,0xf0,0x0c,0xff,0x01,0x00,
+0x0f,0x11,0x00,0x07,0x0f,0x44,0x00,0x06,0xa3,0x03,0x55,0x55,0xff,0xff,0xff,0xc5,
+0x55,0x53,0xbf,0x33,0x00,0x13,0xbb,0x08,0x00,0x1d,0xfb,0x11,0x00,0x0f,0x99,0x00,
+0x18,0x60,0x00,0x00,0xff,0xff,0xff,0xc0,0x08,0x00,0x50,0x0f,0xff,0xff,0xff,0x20,
+0x09,0x00,0x91,0xef,0xff,0xff,0xff,0xba,0xb3,0x00,0x00,0x0a,0x4d,0x00,0x40,0x50,
+0x00,0x00,0x4f,0x08,0x00,0x53,0xf5,0x00,0x00,0x00,0xbf,0x11,0x00,0x23,0x00,0xbf,
+0x11,0x00,0x50,0x00,0x4a,0xdf,0xfe,0xc9,0x35,0x00,0x90,0x02,0xae,0xfc,0x60,0x00,
+0x00,0x7f,0xff,0x70,0x15,0x00,0x72,0x04,0xff,0xff,0xff,0xe8,0x20,0x3e,0x22,0x00,
+0x23,0x01,0xef,0x96,0x00,0x10,0x10,0x0e,0x00,0x13,0x9f,0x0d,0x00,0x10,0x90,0x0d,
+0x00,0x93,0x0e,0xff,0xfb,0x56,0xaf,0xff,0xff,0xff,0xd1,0x99,0x00,0x71,0x00,0x00,
+0x2a,0xff,0xff,0xa1,0x00,0x43,0x00,0x8f,0x44,0x30,0x00,0x00,0x00,0x33,0x10,0x00,
+0x01,0x00,0x17,0x00,0xa7,0x00,0x11,0xfc,0x09,0x00,0x54,0x02,0xff,0xff,0xff,0xe4,
+0xd7,0x00,0x5f,0x00,0x2f,0xff,0xff,0xfe,0x1b,0x00,0xff,0x05,0x95,0x03,0xff,0xff,
+0xff,0xd2,0xff,0xff,0xff,0xd0,0x40,0x01,0x14,0x1f,0xa9,0x01,0x91,0x07,0xff,0xff,
+0xff,0xa0,0xdf,0xff,0xff,0xf7,0x1b,0x00,0x90,0xdf,0xff,0xff,0xf6,0x08,0xff,0xff,
+0xff,0xf2,0x0d,0x00,0x10,0x8f,0x29,0x02,0x91,0x2f,0xff,0xff,0xff,0xf6,0x00,0x00,
+0x02,0xaf,0x50,0x02,0x10,0xaf,0xd4,0x01,0x20,0xcb,0xbd,0x06,0x00,0x54,0xf3,0x00,
+0x01,0xdf,0xff,0x01,0x00,0x54,0xf8,0x00,0x00,0x02,0xef,0x0d,0x00,0x10,0xf9,0xe6,
+0x01,0x04,0xac,0x02,0x02,0x58,0x00,0x12,0x6d,0x0d,0x00,0x22,0xa2,0x00,0x8f,0x00,
+0x52,0x7b,0xde,0xff,0xec,0x95,0xf4,0x01,0x70,0x05,0xcf,0xeb,0x40,0x00,0x00,0xcf,
+0x92,0x02,0x00,0x79,0x00,0x83,0xd6,0x10,0x6f,0xff,0xf1,0x00,0x00,0x05,0x3e,0x00,
+0x12,0xfc,0x94,0x00,0x04,0xa1,0x02,0x52,0x3f,0xff,0xf8,0x46,0xcf,0x56,0x02,0x10,
+0x05,0xd6,0x02,0x21,0x4c,0xff,0x89,0x02,0x7f,0x14,0x44,0x20,0x00,0x00,0x01,0x33,
+0x3e,0x02,0x13,0x10,0x9f,0xbb,0x00,0x02,0xf8,0x00,0x60,0x59,0xff,0xff,0xff,0x30,
+0x00,0xcf,0x02,0x2f,0xff,0xf5,0x17,0x00,0x8e,0x16,0x8f,0x17,0x00,0x13,0x58,0x9e,
+0x03,0x00,0x17,0x00,0x12,0x6f,0x70,0x01,0xc0,0x0b,0xff,0xff,0xff,0x54,0xff,0xff,
+0xff,0xf4,0x00,0x00,0x1a,0xb4,0x03,0x10,0x0f,0x1f,0x04,0x12,0x99,0xc8,0x03,0x15,
+0xaf,0xa7,0x01,0x10,0xf5,0x09,0x02,0x04,0x4f,0x01,0x12,0x07,0x08,0x00,0x10,0xcf,
+0xe2,0x03,0x11,0x06,0x0b,0x00,0x11,0x72,0x58,0x00,0x71,0x01,0x7b,0xef,0xfd,0xb6,
+0x10,0x0f,0xf9,0x03,0x04,0x88,0x01,0x11,0xfd,0x3b,0x01,0x13,0x5f,0x0e,0x00,0x01,
+0x47,0x02,0x0f,0x1b,0x00,0x03,0x1e,0xc0,0xc9,0x03,0x0f,0xd5,0x03,0xff,0xe0,0x16,
+0x0a,0x41,0x00,0x14,0x00,0x7d,0x02,0x1a,0x80,0x17,0x00,0x16,0x9f,0x17,0x00,0x0e,
+0x01,0x00,0x0f,0xbe,0x03,0xff,0x39,0x10,0x80,0x01,0x08,0x02,0x30,0x02,0x40,0x3f,
+0xff,0xfc,0x00,0x2b,0x00,0x22,0xa0,0x00,0xfd,0x07,0x40,0xf9,0x10,0x05,0xef,0x06,
+0x02,0x03,0x97,0x00,0x14,0xef,0xcb,0x03,0x01,0x8e,0x00,0x03,0xbb,0x00,0x12,0x00,
+0x96,0x05,0x33,0xff,0xfd,0x20,0x80,0x01,0x5f,0x02,0x8c,0xef,0xfd,0xa4,0xd9,0x03,
+0xff,0xe9,0x00,0x16,0x02,0x31,0x6f,0xff,0xf7,0x70,0x00,0x11,0xf8,0x2b,0x02,0x11,
+0x50,0xb1,0x00,0x66,0xf8,0x20,0x29,0xff,0xff,0xf1,0x3d,0x02,0x10,0xf8,0x2f,0x00,
+0x14,0x1d,0xa6,0x0a,0x12,0x00,0xd8,0x02,0x23,0xff,0xf8,0x45,0x02,0x4f,0x8b,0xdd,
+0xdb,0x71,0xf0,0x03,0xff,0x40,0x00,0x01,0x00,0x45,0x18,0xdf,0xeb,0x40,0x3d,0x01,
+0x18,0x2e,0x61,0x05,0x41,0x0d,0xff,0x95,0x6d,0x88,0x00,0x02,0xbd,0x07,0x44,0x80,
+0x00,0x1f,0xfc,0x1b,0x00,0x63,0x7f,0xf4,0x00,0x00,0xcf,0xe0,0x0d,0x00,0x64,0x06,
+0xff,0x60,0x00,0x0e,0xfd,0x1b,0x00,0x46,0x1f,0xfe,0x40,0x2a,0x44,0x00,0x19,0x6f,
+0xe2,0x07,0x19,0x4c,0xbf,0x05,0x2f,0x01,0x32,0x0b,0x04,0xff,0xd5,0x50,0x95,0x10,
+0x00,0x00,0x00,0x92,0x00,0x00,0x00,0x00,0x2a,0xef,0xe9,0x10,0x00,0x01,0x00,0x52,
+0x4f,0xff,0xff,0xfe,0x30,0x0b,0x00,0x52,0x1f,0xff,0x75,0x8f,0xfe,0x0b,0x00,0x62,
+0x08,0xff,0x50,0x00,0x7f,0xf6,0x0c,0x00,0x61,0xbf,0xf0,0x00,0x01,0xff,0x90,0x0b,
+0x00,0x62,0x0c,0xff,0x00,0x00,0x1f,0xf9,0x17,0x00,0x61,0x9f,0xf4,0x00,0x07,0xff,
+0x60,0x0b,0x00,0x62,0x02,0xff,0xf6,0x47,0xff,0xe1,0x17,0x00,0x53,0x05,0xff,0xff,
+0xff,0xf3,0x5c,0x00,0x5f,0x03,0xae,0xfe,0x92,0x00,0x01,0x00,0x12,0x40,0x09,0xff,
+0xff,0xff,0x86,0x00,0x52,0x7f,0xff,0xff,0xf5,0x9f,0x41,0x00,0x5f,0x07,0xff,0xff,
+0xff,0x59,0x17,0x00,0x8d,0x17,0x58,0x17,0x00,0x43,0x8f,0xff,0xff,0xf5,0x17,0x00,
+0x31,0x56,0xff,0xff,0x32,0x01,0xf0,0x07,0xbf,0xff,0xff,0xf5,0x4f,0xff,0xff,0xff,
+0x40,0x00,0x01,0xaf,0xff,0xff,0xff,0x50,0xff,0xff,0xff,0xff,0xb9,0x9b,0x06,0x00,
+0x35,0xf5,0x0a,0xff,0x01,0x00,0x25,0x50,0x3f,0x0b,0x00,0x31,0xf5,0x00,0x7f,0x08,
+0x00,0x10,0xfc,0x17,0x00,0x20,0x00,0x6f,0x0b,0x00,0x21,0xf7,0x2f,0x58,0x00,0x60,
+0x17,0xbe,0xff,0xdb,0x61,0x00,0x17,0x00,0x00,0x31,0x01,0x00,0x1b,0x00,0x51,0x80,
+0x04,0xff,0xff,0xfb,0x0d,0x00,0x84,0x1e,0xff,0xff,0xb0,0x01,0xef,0xff,0xfc,0x4b,
+0x01,0x61,0xe1,0x00,0xcf,0xff,0xfd,0x10,0x82,0x01,0x81,0xff,0xff,0xf4,0x00,0x8f,
+0xff,0xfe,0x20,0x1b,0x00,0x52,0xdf,0xff,0xf7,0x00,0x4f,0xb1,0x00,0x00,0xb3,0x00,
+0x10,0xfb,0x39,0x00,0x13,0x50,0xfb,0x01,0x62,0xfe,0x10,0x0b,0xff,0xff,0x70,0x8e,
+0x01,0x31,0x11,0x11,0x10,0x04,0x00,0x0f,0x01,0x00,0x09,0x00,0x49,0x00,0x13,0xfc,
+0xfe,0x01,0x71,0xff,0xff,0xe4,0xff,0xff,0xff,0xc0,0x0e,0x00,0x4f,0x2f,0xff,0xff,
+0xfe,0x1b,0x00,0xff,0x04,0x00,0x8d,0x01,0x65,0xff,0xd2,0xff,0xff,0xff,0xd0,0x40,
+0x01,0x63,0x1f,0xff,0xff,0xff,0x10,0x00,0x35,0x02,0x53,0xa0,0xdf,0xff,0xff,0xf7,
+0xa8,0x01,0x70,0xff,0xf6,0x08,0xff,0xff,0xff,0xf2,0x0d,0x00,0xd0,0x8f,0xff,0xff,
+0xff,0x20,0x2f,0xff,0xff,0xff,0xf6,0x00,0x00,0x02,0x46,0x02,0x30,0xb0,0x00,0xaf,
+0x18,0x02,0x31,0xcb,0xbd,0xff,0x6b,0x03,0x25,0x01,0xdf,0x3e,0x02,0x54,0xf8,0x00,
+0x00,0x02,0xef,0x0d,0x00,0x00,0xa7,0x03,0x23,0x01,0xbf,0x0d,0x00,0x02,0x58,0x00,
+0x12,0x6d,0x0d,0x00,0x13,0xa2,0x9e,0x03,0x53,0x7b,0xde,0xff,0xec,0x95,0xe6,0x01,
+0x00,0x54,0x00,0x21,0x30,0x09,0x65,0x00,0x20,0x00,0x04,0x30,0x00,0xf2,0x00,0x5f,
+0xff,0xff,0x80,0x00,0x00,0x00,0x0d,0xff,0xff,0xb0,0x02,0xff,0xff,0xfa,0x8a,0x00,
+0x32,0xfe,0x10,0x0c,0xda,0x00,0x10,0x02,0x7a,0x00,0x12,0x8f,0x65,0x02,0x00,0x38,
+0x02,0x40,0x04,0xff,0xff,0xe2,0x23,0x00,0x12,0x5f,0x55,0x02,0x14,0x30,0x46,0x02,
+0x3f,0x01,0x11,0x11,0x43,0x02,0x08,0x07,0x49,0x03,0x1f,0x50,0x0c,0x00,0xa1,0x1a,
+0x8f,0x0c,0x00,0x14,0xf5,0x0c,0x00,0x12,0x6f,0x7e,0x01,0x10,0x0b,0x0c,0x00,0x08,
+0xff,0x03,0x71,0x0f,0xff,0xff,0xff,0xfb,0x99,0xbf,0xf4,0x03,0x08,0x00,0x04,0x17,
+0x03,0x0c,0x00,0x09,0x01,0x04,0x11,0x06,0x0c,0x00,0x12,0x72,0xf6,0x03,0x06,0x02,
+0x04,0x0f,0x7b,0x03,0xff,0x17,0x1f,0x3f,0x7b,0x03,0x14,0x18,0xb0,0x7b,0x03,0x28,
+0xf8,0x09,0x7b,0x03,0x18,0x30,0x7b,0x03,0x18,0xd0,0x7b,0x03,0x18,0xf5,0x7b,0x03,
+0x18,0xfa,0x7b,0x03,0x18,0xfc,0x7b,0x03,0x18,0xfa,0x7b,0x03,0x15,0xd4,0x7b,0x03,
+0x00,0xf1,0x03,0x05,0x09,0x03,0x10,0x06,0xd6,0x03,0x05,0x01,0x00,0x36,0xcf,0xff,
+0xf3,0x0d,0x00,0x46,0x0e,0xff,0xff,0x20,0x0e,0x00,0x42,0xef,0xff,0xfb,0x46,0x74,
+0x07,0x01,0x8e,0x07,0x04,0xdf,0x00,0x03,0x12,0x06,0x28,0xff,0xf0,0x5b,0x03,0x07,
+0x38,0x00,0x49,0x5b,0xef,0xeb,0x50,0x6f,0x03,0x1f,0x59,0x70,0x07,0x99,0x1a,0x8f,
+0x70,0x07,0x13,0x50,0x17,0x00,0x07,0x66,0x03,0x20,0x54,0xff,0xe8,0x06,0x20,0x00,
+0x1a,0x96,0x01,0x08,0x65,0x03,0x16,0xaf,0x59,0x07,0x08,0x64,0x03,0x12,0x07,0x08,
+0x00,0x10,0x9f,0xc4,0x01,0x01,0x63,0x03,0x21,0xfe,0x52,0x58,0x00,0x72,0x01,0x7b,
+0xef,0xfd,0xa6,0x00,0x1f,0xca,0x03,0x00,0x01,0x00,0x46,0x1c,0xff,0xff,0xb2,0x6d,
+0x01,0x13,0x80,0x0b,0x00,0x12,0x07,0xdd,0x07,0x03,0x30,0x02,0x14,0xf2,0x0b,0x00,
+0x35,0x0f,0xff,0xff,0x33,0x07,0x52,0xff,0xff,0xfa,0x47,0x50,0x0b,0x00,0x15,0x0d,
+0x04,0x02,0x01,0xb7,0x00,0x03,0x83,0x02,0x01,0x1c,0x08,0x14,0xff,0x2f,0x00,0x45,
+0x6c,0xff,0xea,0x40,0xad,0x01,0x3d,0x07,0x88,0x83,0x2a,0x05,0x00,0x6a,0x02,0x1c,
+0x40,0x15,0x00,0x11,0x2e,0x85,0x02,0x0a,0x01,0x00,0x11,0x04,0x85,0x02,0x19,0x60,
+0x15,0x00,0x00,0xcc,0x05,0x23,0x62,0xef,0xe1,0x02,0x05,0x66,0x00,0x00,0x3c,0x00,
+0x16,0x1d,0xd5,0x00,0x13,0x00,0xe2,0x05,0x10,0x30,0x9a,0x00,0x2f,0xf9,0x00,0x01,
+0x00,0x30,0x00,0x49,0x01,0x02,0x4f,0x0a,0x04,0x8c,0x02,0x53,0xef,0xff,0xff,0xf1,
+0x0d,0x78,0x03,0x13,0x04,0xca,0x01,0x72,0x01,0xff,0xff,0xff,0xe0,0x09,0xff,0xdf,
+0x00,0x13,0x08,0x38,0x09,0x10,0x04,0x1e,0x03,0x00,0x9a,0x01,0x13,0x70,0xe1,0x01,
+0x13,0xd0,0x00,0x02,0x32,0x70,0x02,0xff,0x2b,0x03,0x00,0xe6,0x01,0x51,0xf1,0x00,
+0x00,0x00,0x0a,0x28,0x02,0x00,0x44,0x00,0x42,0x00,0x00,0x00,0x3f,0x07,0x02,0x01,
+0x73,0x01,0x01,0x61,0x01,0x13,0xf1,0x74,0x01,0x12,0xf8,0x32,0x00,0x11,0xfc,0xd3,
+0x03,0x12,0xf4,0xee,0x06,0x01,0x3c,0x09,0x11,0x3f,0x1c,0x00,0x12,0x4f,0xfe,0x03,
+0x01,0x3b,0x01,0x02,0x4a,0x03,0x11,0xf5,0xbe,0x00,0x12,0xfa,0x54,0x04,0x01,0x8a,
+0x02,0x10,0x9f,0x4e,0x00,0x00,0x5a,0x00,0x12,0xfd,0xe4,0x0a,0x01,0x65,0x01,0x11,
+0xcf,0x78,0x00,0x00,0xbe,0x00,0x01,0x06,0x00,0x11,0xfe,0xd4,0x03,0x02,0xda,0x03,
+0x10,0x06,0x37,0x00,0x00,0x30,0x00,0x10,0xba,0x24,0x00,0x12,0x02,0xcc,0x00,0x10,
+0x02,0x37,0x00,0x00,0x5a,0x00,0x10,0x76,0x4e,0x00,0x13,0x05,0xe4,0x02,0x00,0xf5,
+0x00,0x00,0x84,0x00,0x10,0x32,0x78,0x00,0x00,0x03,0x01,0x03,0x1f,0x02,0x10,0xc0,
+0xae,0x00,0x63,0x00,0xef,0xff,0xf9,0x00,0x0b,0xe9,0x03,0x10,0x8f,0xe3,0x03,0x70,
+0xcf,0xff,0xfb,0x00,0xbf,0xff,0xfc,0x1a,0x04,0x13,0xf8,0xce,0x04,0x50,0xf2,0x00,
+0xff,0xff,0xf8,0xea,0x00,0x05,0xbd,0x02,0x12,0x1f,0xf3,0x02,0x10,0xf4,0xe2,0x00,
+0x22,0x40,0x4f,0x0a,0x01,0x00,0x8e,0x00,0x50,0xf8,0x07,0xff,0xff,0xf0,0x0c,0x01,
+0x22,0x70,0x7f,0x34,0x01,0x00,0xb8,0x00,0x50,0xfc,0x0b,0xff,0xff,0xc0,0x65,0x00,
+0x23,0xb0,0xaf,0x96,0x04,0x00,0xbe,0x00,0x10,0x0e,0x1d,0x02,0x00,0x2f,0x00,0x13,
+0xdf,0x19,0x0a,0x00,0xbe,0x00,0x40,0x4f,0xff,0xff,0x40,0x4e,0x05,0x13,0xf3,0xbc,
+0x00,0x01,0xbe,0x00,0x31,0xbf,0xff,0xff,0x09,0x00,0x15,0xf9,0xd3,0x02,0x14,0xbf,
+0x07,0x05,0x05,0x09,0x00,0x03,0x4f,0x05,0x01,0xb3,0x00,0x14,0x7f,0x09,0x00,0x02,
+0xbe,0x00,0x02,0x93,0x01,0x12,0x4f,0x54,0x05,0x04,0x3a,0x02,0x02,0xb3,0x00,0x14,
+0x0f,0x09,0x00,0x03,0xd6,0x01,0x23,0xff,0xc0,0xf8,0x04,0x26,0xff,0xe0,0x39,0x0c,
+0x23,0xff,0x90,0x3b,0x02,0x25,0xff,0xa0,0x4f,0x05,0x02,0x5d,0x02,0x17,0x04,0x0d,
+0x03,0x24,0x02,0xff,0xf2,0x05,0x15,0xff,0xbc,0x00,0x01,0xf4,0x01,0x13,0xfd,0x75,
+0x05,0x06,0x8f,0x03,0x12,0xbf,0x5a,0x04,0x01,0xb2,0x00,0x17,0xfc,0xd1,0x02,0x14,
+0x2d,0x49,0x0b,0x04,0x01,0x00,0x13,0x3e,0xb8,0x02,0x08,0x6a,0x03,0x04,0x53,0x0b,
+0x05,0xf2,0x03,0x19,0x7e,0x90,0x03,0x56,0xaf,0xff,0xfe,0x30,0x2d,0x77,0x03,0x00,
+0x28,0x06,0x47,0xfc,0x10,0x00,0x0b,0x0e,0x06,0x30,0x15,0x55,0x54,0xbb,0x00,0x3f,
+0x55,0x55,0x10,0x79,0x03,0x25,0x12,0x3f,0x52,0x01,0x11,0x0f,0x77,0x03,0x10,0x01,
+0x03,0x01,0x11,0xff,0x72,0x00,0x01,0xd9,0x09,0x01,0xa5,0x00,0x22,0xf2,0x0b,0x00,
+0x03,0x11,0x9f,0x52,0x01,0x10,0x08,0xa9,0x03,0x02,0x10,0x02,0x02,0x3b,0x03,0x00,
+0x02,0x01,0x21,0xa0,0x03,0x30,0x01,0x12,0x01,0x96,0x01,0x10,0x0e,0x05,0x07,0x11,
+0x0f,0x58,0x00,0x11,0x6f,0x72,0x01,0x11,0x02,0xd5,0x03,0x10,0xbf,0x1b,0x02,0x10,
+0x0b,0x42,0x05,0x01,0x57,0x00,0x10,0xe0,0x30,0x02,0x12,0xfb,0x62,0x01,0x10,0xf2,
+0x57,0x00,0x11,0xfa,0x8d,0x00,0x10,0xe0,0x9a,0x03,0x00,0x2a,0x00,0x11,0xcf,0x0b,
+0x01,0x00,0x58,0x00,0x21,0x08,0xff,0x82,0x03,0x11,0x0f,0x6a,0x07,0x10,0x0b,0x58,
+0x00,0x71,0xcf,0xff,0xf7,0xff,0xff,0xf0,0x02,0x34,0x04,0x00,0x8d,0x00,0x21,0x70,
+0x1f,0x83,0x02,0x20,0x40,0x5f,0x1b,0x01,0x00,0x73,0x02,0x82,0xfb,0x05,0xff,0xff,
+0xb0,0x9f,0xff,0xf9,0xa6,0x0a,0x00,0x3b,0x00,0x91,0xe0,0xaf,0xff,0xf7,0x04,0xff,
+0xff,0xd0,0xcf,0x60,0x04,0x00,0x8d,0x00,0x81,0x1e,0xff,0xff,0x20,0x0f,0xff,0xff,
+0x2f,0x20,0x02,0x00,0x8d,0x00,0x10,0xf8,0x3c,0x04,0x32,0xbf,0xff,0xfa,0x84,0x05,
+0x00,0x88,0x00,0x00,0x50,0x03,0x14,0x06,0xc1,0x03,0x01,0xab,0x00,0x00,0xc4,0x01,
+0x12,0x1f,0xb3,0x00,0x03,0x6f,0x04,0x00,0x49,0x07,0x12,0xdf,0xd6,0x00,0x03,0xaf,
+0x02,0x18,0xfa,0x62,0x02,0x13,0x03,0x3e,0x00,0x12,0x3f,0x1b,0x08,0x07,0x8f,0x04,
+0x15,0xef,0x77,0x07,0x12,0xbf,0x3b,0x02,0x15,0x0a,0xab,0x02,0x22,0x08,0xff,0xf6,
+0x01,0x15,0x5f,0x0f,0x06,0x12,0x4f,0xd8,0x06,0x16,0x01,0xa4,0x02,0x03,0x72,0x00,
+0x70,0x0c,0xff,0xff,0xf2,0x00,0x00,0x00,0x11,0x00,0x01,0x00,0x46,0x38,0x88,0x81,
+0x00,0x01,0x00,0x56,0x03,0xff,0xff,0xfd,0x10,0x0f,0x00,0x55,0x4f,0xff,0xff,0xff,
+0xd1,0x0e,0x00,0x38,0x04,0xff,0xff,0x1f,0x00,0x46,0x5f,0xff,0xff,0x69,0x1f,0x00,
+0x65,0x05,0xff,0xff,0xf5,0x00,0x9f,0x1f,0x00,0x65,0x6f,0xff,0xff,0x50,0x00,0x08,
+0x1f,0x00,0xaf,0x77,0x77,0x73,0x00,0x00,0x00,0x57,0x77,0x74,0x00,0x01,0x00,0x0d,
+0x46,0xbf,0xff,0xff,0xff,0x6f,0x00,0x61,0xf5,0x2f,0xff,0xff,0xff,0x70,0x0f,0x00,
+0xa1,0x0c,0xff,0xff,0xff,0xd0,0x0a,0xff,0xff,0xff,0xe0,0x0f,0x00,0x60,0x3f,0xff,
+0xff,0xff,0x50,0x02,0x23,0x00,0x04,0x37,0x00,0x41,0xfc,0x00,0x00,0xaf,0x06,0x00,
+0x20,0x00,0x00,0x18,0x00,0x30,0xf4,0x00,0x00,0x3d,0x00,0x92,0x40,0x00,0x00,0x00,
+0x09,0xff,0xff,0xff,0xc0,0x07,0x00,0xf2,0x09,0xb0,0x00,0x00,0x00,0x1f,0xff,0xff,
+0xff,0x30,0x00,0x00,0x01,0xff,0xff,0xff,0xf2,0x00,0x00,0x00,0x8f,0xff,0xff,0xfb,
+0x00,0x08,0x00,0x93,0xfa,0x00,0x00,0x00,0xef,0xff,0xff,0xf3,0x00,0x26,0x00,0x33,
+0x10,0x00,0x07,0x34,0x00,0x00,0xcc,0x00,0xa2,0xff,0x80,0x00,0x0e,0xff,0xff,0xff,
+0x20,0x00,0x00,0x3d,0x00,0x10,0xf0,0x03,0x01,0x12,0xfa,0xad,0x00,0x62,0x7f,0xff,
+0xff,0xf7,0x00,0xdf,0x51,0x00,0x20,0x00,0x00,0x28,0x00,0x10,0xfe,0xc0,0x00,0x12,
+0xa0,0x0f,0x00,0x00,0x46,0x00,0x14,0x5b,0x3b,0x00,0x02,0x64,0x00,0x64,0xef,0xff,
+0xff,0xf9,0x00,0x00,0x2d,0x01,0x00,0x01,0x00,0x35,0xf1,0x00,0x00,0x3d,0x00,0x01,
+0x6d,0x00,0x03,0x01,0x00,0x11,0x06,0x0f,0x00,0x05,0x96,0x01,0x00,0x66,0x00,0x26,
+0xff,0xf8,0x31,0x01,0x18,0x5f,0x3b,0x00,0x38,0x00,0x00,0x0d,0x3b,0x00,0x02,0x36,
+0x01,0x1f,0x60,0x0f,0x00,0x9b,0x15,0x06,0x37,0x01,0x02,0x76,0x01,0x13,0xc1,0x0c,
+0x00,0x26,0x0a,0xff,0x8e,0x02,0x71,0x1c,0xff,0xff,0xc8,0xff,0xff,0xe2,0x0c,0x00,
+0x80,0x2d,0xff,0xff,0xa0,0x05,0xff,0xff,0xe3,0x0c,0x00,0x10,0x4e,0xfd,0x00,0x21,
+0x03,0xef,0x15,0x02,0x30,0x03,0x55,0x55,0xe6,0x01,0x4f,0x55,0x55,0x40,0x00,0x01,
+0x00,0x13,0x12,0xcf,0x58,0x01,0x00,0x8f,0x01,0x22,0xfd,0x06,0x33,0x02,0x01,0x75,
+0x00,0x23,0x80,0x1f,0x80,0x01,0x00,0x31,0x02,0x00,0x6a,0x02,0x12,0xf6,0x1b,0x03,
+0x32,0xfd,0x00,0x06,0x1e,0x02,0x11,0x09,0x74,0x01,0x12,0x1f,0xba,0x02,0x02,0x05,
+0x02,0x14,0xbf,0x81,0x02,0x12,0xfd,0xc1,0x01,0x11,0x90,0x04,0x02,0x11,0x70,0x57,
+0x02,0x11,0xfe,0x1f,0x00,0x23,0xf2,0x00,0x07,0x00,0x12,0x0f,0xb5,0x02,0x10,0x05,
+0x20,0x00,0x13,0x05,0xef,0x02,0x01,0x14,0x00,0x12,0xaf,0x4f,0x02,0x00,0x08,0x00,
+0x23,0xf1,0x0e,0xda,0x02,0x00,0x21,0x00,0x13,0x53,0x14,0x03,0x00,0x26,0x00,0x23,
+0xfa,0x8f,0xfe,0x01,0x00,0x26,0x00,0x13,0xfd,0x25,0x00,0x01,0x26,0x00,0x05,0x54,
+0x01,0x18,0x0f,0x5e,0x02,0x10,0xaf,0x0c,0x00,0x17,0xfb,0xd0,0x03,0x04,0x79,0x01,
+0x18,0x0f,0x83,0x02,0x16,0xaf,0x25,0x00,0x02,0x26,0x00,0x17,0x60,0x9b,0x02,0x05,
+0x6d,0x02,0x16,0x9f,0x25,0x00,0x01,0x26,0x00,0x14,0x50,0x0d,0x00,0x10,0x2f,0x1c,
+0x03,0x06,0xc2,0x01,0x15,0xfb,0x62,0x01,0x17,0xef,0x25,0x00,0x15,0x8f,0x25,0x00,
+0x34,0x01,0x24,0xaf,0x48,0x03,0x00,0x81,0x04,0x02,0x9e,0x03,0x04,0xe4,0x03,0x27,
+0xff,0xb0,0x19,0x00,0x26,0xe1,0x00,0x19,0x00,0x26,0xe3,0x00,0x19,0x00,0x15,0xa1,
+0xc0,0x04,0x37,0x67,0x75,0x10,0xd2,0x01,0x94,0x08,0xde,0xa2,0x00,0x00,0x00,0x3c,
+0xec,0x50,0xb1,0x00,0x11,0xfd,0x1c,0x04,0x12,0xf5,0x0f,0x00,0x13,0xff,0xa4,0x04,
+0x1e,0xfb,0x0f,0x00,0x01,0x2d,0x00,0x45,0xfe,0x10,0x00,0x03,0x2d,0x00,0x9f,0x08,
+0xef,0xb2,0x00,0x00,0x00,0x4c,0xfd,0x60,0x4d,0x02,0x14,0x0f,0xd1,0x04,0xff,0xf9,
+0x00,0xfb,0x01,0x48,0x55,0x55,0x55,0x10,0x00,0x01,0x03,0xd6,0x02,0x02,0x78,0x01,
+0x36,0xd0,0x00,0x00,0x79,0x03,0x18,0xe1,0x7e,0x07,0x27,0xe2,0x00,0x44,0x01,0x15,
+0xf3,0x0d,0x00,0x15,0x09,0x97,0x02,0x02,0x01,0x03,0x1f,0xf7,0x85,0x02,0x0d,0x27,
+0x4f,0xff,0x01,0x00,0x18,0x54,0x0d,0x00,0x1f,0xf5,0x1b,0x00,0x14,0x33,0xfe,0x13,
+0xbb,0x01,0x00,0x18,0xdf,0xeb,0x03,0x27,0x0e,0xff,0xae,0x05,0x06,0xcd,0x02,0x03,
+0x84,0x04,0x15,0xf4,0xe6,0x00,0x18,0xef,0xe3,0x01,0x11,0xbf,0x17,0x05,0x15,0x00,
+0x69,0x02,0x04,0xf0,0x03,0x02,0xe1,0x02,0x18,0x70,0xfa,0x01,0x18,0xc0,0x0a,0x06,
+0x18,0xf2,0x6e,0x04,0x18,0xf6,0x56,0x04,0x18,0xfb,0x42,0x01,0x28,0xfe,0x10,0x4b,
+0x02,0x05,0xfe,0x05,0x11,0x1e,0x87,0x05,0x03,0x01,0x00,0x18,0x0b,0x77,0x01,0x27,
+0x07,0xff,0x5d,0x01,0x19,0x02,0x8e,0x02,0x18,0xdf,0xab,0x00,0x17,0x8f,0xf2,0x02,
+0x01,0x53,0x01,0x18,0x70,0x07,0x01,0x18,0xc0,0x07,0x01,0x18,0xf1,0x07,0x01,0x14,
+0xfe,0x3b,0x01,0x27,0x71,0xef,0x52,0x01,0x19,0xfb,0x7a,0x01,0x2f,0xb4,0xff,0x1b,
+0x00,0x14,0x05,0x43,0x01,0x16,0xf8,0x61,0x00,0x15,0xa0,0xe2,0x00,0x16,0xfb,0x9c,
+0x05,0x15,0xd0,0x1f,0x02,0x04,0x11,0x01,0x16,0x0d,0x51,0x02,0x16,0x8f,0x75,0x01,
+0x3f,0x45,0x55,0x53,0x39,0x02,0x07,0x15,0x0e,0x79,0x00,0x1f,0xf6,0x0b,0x00,0x18,
+0x30,0xf2,0x07,0x88,0x01,0x00,0x15,0xcf,0x2a,0x02,0x16,0x01,0x1e,0x04,0x01,0xf7,
+0x04,0x0c,0x50,0x01,0x16,0x03,0xd1,0x01,0x16,0x1e,0x1e,0x03,0x15,0xbf,0xbb,0x00,
+0x16,0x06,0xa2,0x01,0x16,0x3f,0x10,0x04,0x14,0xdf,0xf0,0x06,0x01,0x73,0x01,0x16,
+0xe1,0xf4,0x01,0x15,0x50,0xca,0x01,0x0f,0x75,0x00,0x09,0x00,0x46,0x02,0x11,0xfc,
+0xa9,0x00,0x25,0x86,0x1e,0xbb,0x00,0x2f,0xfc,0x4f,0x0b,0x00,0x18,0x02,0x52,0x00,
+0x29,0x36,0x51,0xef,0x05,0x28,0xe4,0x00,0xdc,0x02,0x28,0xe0,0x00,0x73,0x02,0x27,
+0x20,0x00,0x3d,0x07,0x18,0xf0,0xc3,0x03,0x17,0xfa,0x2d,0x04,0x2e,0xcf,0xe9,0x63,
+0x06,0x0f,0xde,0x03,0xff,0xd9,0x37,0x09,0xef,0xc3,0x4c,0x01,0x16,0x20,0x28,0x06,
+0x16,0x80,0xf2,0x08,0x16,0xa0,0x1e,0x01,0x15,0x60,0xb3,0x00,0x15,0xfa,0x91,0x01,
+0x2e,0x56,0x30,0x39,0x02,0x0f,0xde,0x03,0xff,0x1a,0x50,0xff,0xff,0xff,0xff,0xfc,
+0xf4,0x0b,0x00,0x00,0x17,0x88,0x88,0x40,0x00,0x00,0x07,0x88,0x88,0x70,0x00,0x00,
+0x00,0x00,0x7f,0xff,0xff,0x50,0x00,0x0c,0xff,0xff,0xf3,0x00,0x0e,0x00,0x54,0x1c,
+0xff,0xff,0xe3,0x00,0x0e,0x00,0x55,0x6c,0xff,0xff,0xe2,0x00,0x0e,0x00,0x06,0x0d,
+0x00,0x77,0x00,0x6f,0xff,0xff,0xff,0xd1,0x00,0x0e,0x00,0x06,0x0d,0x00,0x5f,0x00,
+0x58,0x88,0x71,0x00,0x01,0x00,0x0c,0x27,0x4f,0xff,0x01,0x00,0x18,0x54,0x0d,0x00,
+0x1f,0xf5,0x1b,0x00,0x14,0x33,0xfe,0x13,0xbb,0x01,0x00,0x20,0xdf,0xff,0xc4,0x00,
+0x03,0x01,0x00,0x54,0x0e,0xff,0xff,0xff,0xa0,0x0d,0x00,0x54,0x0a,0xff,0xff,0xff,
+0xe0,0x0d,0x00,0x54,0x05,0xff,0xff,0xff,0xf4,0x0d,0x00,0x55,0x01,0xef,0xff,0xff,
+0xf8,0x8e,0x00,0x67,0xbf,0xff,0xff,0xfd,0x00,0x00,0xe8,0x00,0x14,0x30,0x0d,0x00,
+0x54,0x2f,0xff,0xff,0xff,0x70,0x0d,0x00,0x54,0x0d,0xff,0xff,0xff,0xc0,0x0d,0x00,
+0x54,0x08,0xff,0xff,0xff,0xf2,0x0d,0x00,0x55,0x04,0xff,0xff,0xff,0xf6,0x42,0x00,
+0x45,0xef,0xff,0xff,0xfb,0x0d,0x00,0x54,0xaf,0xff,0xff,0xfe,0x10,0x0d,0x00,0x54,
+0x5f,0xff,0xff,0xff,0x40,0x0d,0x00,0x54,0x1e,0xff,0xff,0xff,0x90,0x0d,0x00,0x54,
+0x0b,0xff,0xff,0xff,0xd0,0x0d,0x00,0x23,0x07,0xff,0x91,0x01,0x00,0x01,0x00,0x28,
+0x02,0xff,0xab,0x00,0x18,0xdf,0xab,0x00,0x58,0x8f,0xff,0xff,0xff,0x20,0x53,0x01,
+0x18,0x70,0x07,0x01,0x18,0xc0,0x07,0x01,0x18,0xf1,0x07,0x01,0x14,0xfe,0x3b,0x01,
+0x27,0x71,0xef,0x52,0x01,0x19,0xfb,0x7a,0x01,0x2f,0xb4,0xff,0x1b,0x00,0x14,0x02,
+0x43,0x02,0x50,0x01,0xcf,0xff,0xfe,0x30,0x5d,0x00,0x62,0xf5,0x00,0x1c,0xff,0xff,
+0xd2,0x90,0x00,0x40,0x51,0xcf,0xff,0xfc,0xfc,0x00,0x44,0x03,0xef,0xff,0xfd,0x97,
+0x01,0x53,0x2e,0xff,0xff,0xff,0xf9,0x85,0x01,0x16,0xdf,0xb2,0x00,0x4f,0x16,0x66,
+0x64,0x00,0x01,0x00,0x11,0x15,0x0e,0x79,0x00,0x1f,0xf6,0x0b,0x00,0x18,0x30,0xf2,
+0x07,0x88,0x01,0x00,0x15,0xcf,0x2a,0x02,0x25,0x01,0xef,0x86,0x00,0x16,0x0c,0x7a,
+0x01,0x06,0x50,0x01,0x16,0x03,0xd1,0x01,0x00,0xa7,0x01,0x15,0xb0,0x28,0x02,0x03,
+0xcc,0x01,0x16,0x06,0xa2,0x01,0x55,0x3f,0xff,0xff,0xff,0x80,0x9d,0x01,0x16,0xfc,
+0x73,0x01,0x16,0xe1,0xf4,0x01,0x15,0x50,0xca,0x01,0x0f,0x75,0x00,0x09,0x00,0x46,
+0x02,0x11,0xfc,0xa9,0x00,0x25,0x86,0x1e,0xbb,0x00,0x2f,0xfc,0x4f,0x0b,0x00,0x18,
+0x00,0x45,0x00,0x61,0x67,0x76,0x41,0x00,0x00,0x2a,0x0e,0x00,0x10,0x06,0x15,0x00,
+0x11,0xfa,0xac,0x03,0x31,0xff,0xf8,0x01,0x23,0x00,0x22,0xf7,0x08,0x4b,0x03,0x00,
+0xcc,0x02,0x81,0xd4,0x10,0x20,0x1f,0xff,0xff,0xff,0x10,0xe7,0x02,0x12,0xfa,0xcb,
+0x00,0x12,0xf8,0xba,0x01,0x0f,0x07,0x00,0xa2,0x50,0xff,0xf8,0x00,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -1868,11 +2821,48 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 192, .range_length = 192, .glyph_id_start = 97, .list_length = 0, .type = 2, .unicode_list = 0, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[133757] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 2990, .size = 3744, .comp_size = 2062 },
+{ .bitmap_start = 3744, .comp_offset = 5052, .size = 3982, .comp_size = 1701 },
+{ .bitmap_start = 7726, .comp_offset = 6753, .size = 3686, .comp_size = 1913 },
+{ .bitmap_start = 11412, .comp_offset = 8666, .size = 3706, .comp_size = 1199 },
+{ .bitmap_start = 15118, .comp_offset = 9865, .size = 3986, .comp_size = 1630 },
+{ .bitmap_start = 19104, .comp_offset = 11495, .size = 3953, .comp_size = 1486 },
+{ .bitmap_start = 23057, .comp_offset = 12981, .size = 4090, .comp_size = 1679 },
+{ .bitmap_start = 27147, .comp_offset = 14660, .size = 3936, .comp_size = 1432 },
+{ .bitmap_start = 31083, .comp_offset = 16092, .size = 3616, .comp_size = 1836 },
+{ .bitmap_start = 34699, .comp_offset = 17928, .size = 3647, .comp_size = 853 },
+{ .bitmap_start = 38346, .comp_offset = 18781, .size = 3949, .comp_size = 991 },
+{ .bitmap_start = 42295, .comp_offset = 19772, .size = 3928, .comp_size = 1054 },
+{ .bitmap_start = 46223, .comp_offset = 20826, .size = 3933, .comp_size = 1137 },
+{ .bitmap_start = 50156, .comp_offset = 21963, .size = 3888, .comp_size = 1271 },
+{ .bitmap_start = 54044, .comp_offset = 23234, .size = 3969, .comp_size = 1316 },
+{ .bitmap_start = 58013, .comp_offset = 24550, .size = 3779, .comp_size = 1091 },
+{ .bitmap_start = 61792, .comp_offset = 25641, .size = 4074, .comp_size = 1206 },
+{ .bitmap_start = 65866, .comp_offset = 26847, .size = 4047, .comp_size = 1103 },
+{ .bitmap_start = 69913, .comp_offset = 27950, .size = 3518, .comp_size = 968 },
+{ .bitmap_start = 73431, .comp_offset = 28918, .size = 4030, .comp_size = 1276 },
+{ .bitmap_start = 77461, .comp_offset = 30194, .size = 4004, .comp_size = 1365 },
+{ .bitmap_start = 81465, .comp_offset = 31559, .size = 3659, .comp_size = 920 },
+{ .bitmap_start = 85124, .comp_offset = 32479, .size = 4034, .comp_size = 725 },
+{ .bitmap_start = 89158, .comp_offset = 33204, .size = 3894, .comp_size = 1144 },
+{ .bitmap_start = 93052, .comp_offset = 34348, .size = 3856, .comp_size = 916 },
+{ .bitmap_start = 96908, .comp_offset = 35264, .size = 3835, .comp_size = 749 },
+{ .bitmap_start = 100743, .comp_offset = 36013, .size = 3725, .comp_size = 1133 },
+{ .bitmap_start = 104468, .comp_offset = 37146, .size = 3878, .comp_size = 1516 },
+{ .bitmap_start = 108346, .comp_offset = 38662, .size = 3814, .comp_size = 1227 },
+{ .bitmap_start = 112160, .comp_offset = 39889, .size = 3947, .comp_size = 1225 },
+{ .bitmap_start = 116107, .comp_offset = 41114, .size = 3876, .comp_size = 729 },
+{ .bitmap_start = 119983, .comp_offset = 41843, .size = 4010, .comp_size = 1605 },
+{ .bitmap_start = 123993, .comp_offset = 43448, .size = 3873, .comp_size = 1048 },
+{ .bitmap_start = 127866, .comp_offset = 44496, .size = 1249, .comp_size = 479 },
+};
+
+static uint8_t etxUncompBuf[4642] __SDRAMFONTS;
 
 const etxLz4Font lv_font_en_bold_XL = {
-.uncomp_size = 133525,
-.comp_size = 29721,
+.uncomp_size = 4410,
+.comp_size = 2990,
 .line_height = 58,
 .base_line = 12,
 .subpx = 0,
@@ -1885,12 +2875,13 @@ const etxLz4Font lv_font_en_bold_XL = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 38,
-.glyph_bitmap = 2312,
-.class_pair_values = 131427,
-.left_class_mapping = 132947,
-.right_class_mapping = 133236,
+.class_pair_values = 2312,
+.left_class_mapping = 3832,
+.right_class_mapping = 4121,
+.block_num = 34,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 133757,
+.lvglFontBufSize = 4642,
 };
@@ -44,1710 +44,2165 @@ static const uint8_t lz4FontData[] ={
 0xe5,0xbf,0x51,0x36,0x31,0x50,0x00,0xf1,0x1a,0xc4,0x11,0x36,0x2e,0x48,0x05,0xec,
 0x70,0xcb,0x41,0x36,0x2e,0x48,0x03,0xec,0xe8,0xd1,0x01,0x23,0x1d,0x34,0x05,0x00,
 0xda,0xd4,0x61,0x31,0x2c,0x35,0x02,0xff,0x68,0xd9,0x71,0x20,0x1f,0x41,0x00,0xff,
-0x58,0xdd,0x38,0x00,0xf1,0x44,0xff,0xea,0xe1,0x81,0x30,0x30,0x33,0x00,0x00,0xb2,
+0x58,0xdd,0x38,0x00,0xf8,0x43,0xff,0xea,0xe1,0x81,0x30,0x30,0x33,0x00,0x00,0xb2,
 0xe6,0x91,0x46,0x45,0x33,0x01,0x00,0x92,0xed,0xe1,0x30,0x31,0x34,0x00,0x00,0x8c,
 0xf2,0x31,0x30,0x31,0x48,0x00,0xeb,0x70,0xf9,0xe1,0x30,0x2b,0x34,0x03,0x00,0xce,
 0xfd,0xb1,0x1f,0x1d,0x5e,0x02,0xee,0x21,0x03,0x52,0x18,0x09,0x52,0x08,0xf3,0x92,
 0x04,0xb2,0x1f,0x1d,0x5e,0x01,0xee,0xe5,0x09,0x42,0x3e,0x36,0x16,0x04,0x12,0x37,
-0x0c,0x42,0x25,0x1b,0x1a,0x05,0x2c,0x08,0x99,0x01,0x00,0x31,0x95,0x0d,0xff,0x01,
-0x00,0x2a,0xf8,0x0c,0x08,0x00,0x2a,0xf7,0x0b,0x08,0x00,0x22,0xf6,0x0a,0x08,0x00,
-0x2a,0xf5,0x09,0x08,0x00,0x2a,0xf4,0x08,0x08,0x00,0x2a,0xf3,0x07,0x08,0x00,0x2a,
-0xf2,0x06,0x08,0x00,0x2a,0xf1,0x05,0x08,0x00,0x2b,0xf0,0x04,0x08,0x00,0x12,0x03,
-0x08,0x00,0x14,0xe0,0x08,0x00,0x12,0x02,0x08,0x00,0x2a,0xd0,0x01,0x08,0x00,0x2a,
-0xc0,0x00,0x08,0x00,0x1b,0xb0,0x08,0x00,0x39,0xa0,0x00,0xef,0x08,0x00,0x39,0x90,
-0x00,0xdf,0x08,0x00,0x39,0x80,0x00,0xcf,0x08,0x00,0x31,0x70,0x00,0xbf,0x08,0x00,
-0x39,0x60,0x00,0xaf,0x08,0x00,0x39,0x50,0x00,0x9f,0x08,0x00,0x39,0x40,0x00,0x8f,
-0x08,0x00,0x39,0x30,0x00,0x7f,0x08,0x00,0x39,0x20,0x00,0x6f,0x08,0x00,0x39,0x10,
-0x00,0x5f,0x08,0x00,0x33,0x00,0x00,0x4f,0x08,0x00,0x0f,0x01,0x00,0x27,0x30,0x35,
-0x54,0x20,0x07,0x00,0x80,0x7e,0xff,0xff,0xfd,0x50,0x00,0x00,0x1c,0x4f,0x00,0x23,
-0xfa,0x00,0xc8,0x00,0x23,0x90,0x06,0x80,0x01,0x03,0xd8,0x01,0x22,0xf9,0x1f,0x08,
-0x00,0x22,0xfd,0x2f,0x08,0x00,0x14,0xfe,0x08,0x00,0x12,0x0f,0x08,0x00,0x14,0xfc,
-0xe8,0x01,0x04,0x70,0x01,0x05,0xe0,0x00,0x01,0xc1,0x01,0xf0,0x03,0xe4,0x00,0x00,
-0x00,0x18,0xce,0xfe,0xb7,0x00,0x00,0xee,0xee,0xee,0xee,0xe6,0x00,0x00,0x0a,0x08,
-0x00,0x12,0xaf,0x32,0x01,0x01,0x33,0x01,0x11,0xfb,0x3e,0x00,0x21,0x00,0x00,0x48,
-0x00,0x1f,0xbf,0x19,0x00,0x23,0x12,0x60,0x19,0x00,0x11,0xf9,0x49,0x02,0x03,0x19,
-0x00,0x12,0x8f,0x56,0x01,0x01,0x19,0x00,0x11,0xf6,0x32,0x02,0x03,0x19,0x00,0x13,
-0x5f,0x3f,0x01,0x10,0xbf,0xe6,0x00,0x02,0xb3,0x00,0x02,0x19,0x00,0x10,0x2f,0xcf,
-0x00,0x03,0x19,0x00,0x12,0xf0,0x0c,0x02,0x02,0x19,0x00,0x10,0x0f,0x5c,0x00,0x03,
-0x19,0x00,0x12,0xd0,0xf5,0x01,0x01,0x19,0x00,0x20,0xfc,0x0f,0x5c,0x00,0x03,0x19,
-0x00,0x12,0xa0,0xe6,0x01,0x01,0x19,0x00,0x20,0xf9,0x0f,0x5c,0x00,0x03,0x19,0x00,
-0x12,0x70,0xbf,0x01,0x01,0x19,0x00,0x20,0xf6,0x0f,0x5c,0x00,0x03,0x19,0x00,0x10,
-0x40,0x47,0x01,0x12,0x00,0x19,0x00,0x20,0xf3,0x0f,0x5c,0x00,0x03,0x19,0x00,0x10,
-0x10,0xe5,0x00,0x03,0x19,0x00,0x21,0xf0,0x0f,0x85,0x02,0x01,0x19,0x00,0x16,0xfe,
-0xc3,0x01,0x60,0x06,0x88,0x88,0x88,0x86,0x00,0x5d,0x01,0x49,0x88,0x88,0x88,0x83,
-0xde,0x01,0x11,0xef,0xa6,0x02,0x32,0x00,0x00,0x04,0x87,0x01,0x07,0x01,0x00,0x12,
-0x1f,0x38,0x01,0x11,0x00,0x6b,0x02,0x18,0xf1,0x1a,0x00,0x05,0x2c,0x00,0x1d,0x0a,
-0x5c,0x02,0x05,0x2c,0x00,0x11,0xdf,0x2e,0x03,0x07,0x01,0x00,0x23,0x09,0xff,0x93,
-0x00,0x04,0x20,0x01,0x06,0x01,0x00,0x12,0xcf,0x3e,0x01,0x23,0x00,0x02,0x9e,0x01,
-0x06,0x01,0x00,0x05,0x2c,0x00,0x13,0x5f,0x23,0x01,0x05,0x01,0x00,0x05,0x2c,0x00,
-0x13,0x08,0x31,0x01,0x06,0x01,0x00,0x05,0x2c,0x00,0x12,0xbf,0xaf,0x01,0x06,0x01,
-0x00,0x14,0x07,0xb0,0x00,0x13,0x0d,0x34,0x01,0x06,0x01,0x00,0x13,0xaf,0x52,0x01,
-0x13,0x00,0xb2,0x01,0x06,0x01,0x00,0x05,0x2c,0x00,0x10,0x3f,0x89,0x04,0x09,0x35,
-0x00,0x04,0x2c,0x00,0x12,0x06,0x84,0x03,0x07,0x01,0x00,0x05,0x2c,0x00,0x13,0x9f,
-0xc3,0x01,0x05,0x01,0x00,0x14,0x05,0x2c,0x00,0x10,0x0b,0x28,0x03,0x09,0x4f,0x00,
-0x14,0x8f,0x2c,0x00,0x13,0xef,0xc6,0x01,0x05,0x01,0x00,0x01,0x40,0x02,0x09,0x95,
-0x01,0x09,0xc1,0x01,0x1f,0xa0,0xc1,0x01,0x0f,0x17,0xf2,0x02,0x01,0x0f,0x01,0x00,
-0x01,0x13,0x50,0x52,0x04,0x0e,0x01,0x00,0x1f,0xf5,0x35,0x00,0x8d,0x20,0x01,0x33,
-0x01,0x00,0x00,0xed,0x01,0x50,0xe3,0x33,0x33,0x33,0x34,0x15,0x00,0x11,0xa3,0x13,
-0x00,0x1f,0x10,0xc1,0x01,0x1b,0x18,0x30,0x1a,0x00,0x14,0x2f,0x2c,0x00,0x1f,0x8f,
-0xc1,0x01,0x02,0x1f,0x30,0xc1,0x01,0x20,0x14,0xfd,0x95,0x01,0x19,0xf8,0x35,0x00,
-0x13,0xdf,0xfe,0x02,0x13,0x03,0x13,0x04,0x0a,0xfe,0x02,0x01,0x2c,0x00,0x16,0x6f,
-0xc1,0x01,0x02,0x01,0x00,0x05,0x2c,0x00,0x1d,0x09,0x82,0x03,0x14,0x6f,0xfe,0x02,
-0x14,0xcf,0xd2,0x02,0x04,0x01,0x00,0x14,0x08,0x2c,0x00,0x12,0x0e,0xc3,0x05,0x07,
-0x01,0x00,0x13,0xbf,0x2c,0x00,0x13,0x01,0x39,0x05,0x01,0x62,0x03,0x10,0x22,0x01,
-0x00,0x10,0x2e,0x3d,0x01,0x00,0x09,0x00,0x10,0x5f,0x91,0x04,0x00,0x09,0x00,0x3e,
-0x21,0x00,0x00,0xa6,0x01,0x04,0x1f,0x07,0x1f,0x0f,0x1a,0x00,0x04,0x1f,0xfc,0x35,
-0x00,0x8e,0x19,0x00,0x2a,0x03,0x0f,0xbf,0x04,0x02,0x1f,0xff,0xbf,0x04,0x07,0x1f,
-0xc0,0xbf,0x04,0x21,0x1f,0x70,0xbf,0x04,0x06,0x1f,0xf4,0xbf,0x04,0x07,0x1f,0x10,
-0xbf,0x04,0x06,0x1f,0xe0,0xbf,0x04,0x21,0x1f,0x90,0xfe,0x02,0x06,0x1f,0xf6,0xfe,
-0x02,0x3b,0x1f,0xfe,0xfe,0x02,0x6c,0x1f,0x09,0xfe,0x02,0x07,0x41,0x58,0x88,0x88,
-0x88,0xf5,0x02,0x49,0x88,0x88,0x88,0x88,0x43,0x05,0x04,0x3a,0x03,0x5e,0xee,0xee,
-0xee,0xd0,0x00,0x01,0x00,0x19,0x9f,0x66,0x07,0x09,0x6b,0x00,0x1f,0xe0,0x2f,0x00,
-0xa2,0x30,0x02,0x58,0xae,0x76,0x01,0x1b,0x62,0x16,0x00,0x23,0x8d,0xff,0xc7,0x09,
-0x18,0x82,0x17,0x00,0x16,0x3b,0x40,0x03,0x16,0xfb,0x3e,0x02,0x28,0x01,0xaf,0x59,
-0x03,0x15,0x90,0x34,0x08,0x19,0xef,0x71,0x03,0x18,0xd3,0x4f,0x02,0x07,0x01,0x00,
-0x1f,0xf4,0x17,0x00,0x03,0x03,0x3d,0x03,0x1d,0x04,0xb9,0x03,0x11,0xe1,0x73,0x00,
-0x1e,0xef,0xeb,0x03,0x04,0x7c,0x07,0x0b,0x01,0x00,0x13,0x60,0xdd,0x02,0x0b,0x01,
-0x00,0x14,0xfe,0xcd,0x08,0x00,0xd5,0x02,0x53,0x73,0x10,0x13,0x8e,0xff,0xa8,0x0a,
-0x03,0x26,0x03,0x04,0x0f,0x03,0x23,0x1a,0xff,0x18,0x0c,0x02,0xa7,0x03,0x05,0x52,
-0x03,0x04,0x3c,0x00,0x12,0x30,0x67,0x02,0x05,0x22,0x04,0x04,0xef,0x0c,0x04,0x30,
-0x0b,0x04,0x25,0x08,0x14,0x4f,0x47,0x00,0x17,0x0e,0xaf,0x00,0x03,0x0e,0x03,0x01,
-0xa7,0x02,0x09,0x46,0x00,0x14,0x00,0xee,0x0c,0x01,0x40,0x03,0x06,0xa2,0x05,0x04,
-0x84,0x00,0x26,0x50,0x01,0xae,0x00,0x05,0x5d,0x04,0x00,0x0f,0x00,0x03,0x2f,0x00,
-0x04,0x10,0x04,0x05,0x0f,0x00,0x03,0xb5,0x01,0x08,0x08,0x04,0x00,0xa5,0x00,0x13,
-0x0e,0x15,0x0d,0x04,0xb3,0x01,0x11,0x55,0x01,0x00,0x13,0x20,0xac,0x0c,0x0a,0xdb,
-0x04,0x06,0x96,0x00,0x19,0xfe,0xf9,0x08,0x06,0xdd,0x00,0x1c,0xfd,0x18,0x00,0x13,
-0xef,0x30,0x00,0x1e,0x50,0x47,0x00,0x01,0x01,0x00,0x1a,0xb3,0x18,0x00,0x14,0x1f,
-0x18,0x00,0x19,0xfa,0x9b,0x04,0x07,0x09,0x08,0x1d,0xc5,0x87,0x05,0x03,0x62,0x00,
+0x0c,0x42,0x25,0x1b,0x1a,0x05,0x2c,0x00,0x01,0x00,0x2f,0xee,0x00,0x01,0x00,0x02,
+0x13,0xf5,0x08,0x00,0x17,0xdd,0x14,0x00,0xbe,0xf1,0xef,0x00,0xfa,0xe5,0x00,0xe5,
+0x00,0x00,0x00,0x03,0x31,0x00,0x4d,0x06,0x0b,0x00,0x06,0x15,0x00,0x2f,0xad,0x00,
+0x01,0x00,0x14,0x1f,0xb7,0x1d,0x00,0x09,0x03,0x84,0x00,0xb1,0xe8,0x00,0xfa,0x00,
+0x00,0xdd,0xfb,0xe9,0xf5,0x00,0xd4,0x10,0x00,0xaa,0xf2,0xfc,0x00,0x00,0xfb,0xfd,
+0xf1,0xf6,0x00,0x04,0x2f,0x00,0x7e,0xf8,0x00,0xf9,0x00,0x00,0xf0,0x00,0x01,0x00,
+0x1c,0xf8,0x0a,0x00,0x19,0xfc,0x1f,0x00,0x11,0xfb,0x06,0x00,0x30,0xdc,0x00,0x00,
+0x68,0x00,0x8f,0x00,0xe7,0x00,0xfa,0x00,0xfa,0xf3,0xf9,0x98,0x00,0x09,0x05,0xf0,
+0x00,0x21,0xfa,0xfb,0x33,0x00,0x34,0xfb,0xf8,0xfa,0x12,0x00,0x75,0xb0,0x00,0x00,
+0x00,0xc8,0x00,0xc3,0x23,0x00,0x9a,0xf6,0xfa,0x00,0x00,0xfa,0xf8,0x00,0x00,0xfa,
+0x51,0x00,0x13,0x05,0x8c,0x00,0x2f,0x05,0xf8,0x65,0x00,0x06,0x1f,0xfa,0x3a,0x01,
+0x0c,0x5a,0xd0,0x00,0x00,0x00,0xf7,0xe5,0x00,0x00,0x4d,0x00,0x21,0xf9,0xf4,0xd9,
+0x01,0x14,0xac,0xab,0x00,0x96,0xed,0x00,0x00,0xc4,0xf9,0xc4,0xe5,0x00,0xae,0x2a,
+0x00,0x34,0xfc,0xdc,0xf1,0x0b,0x00,0x72,0x8a,0x00,0x00,0x00,0xcc,0x00,0xca,0xe6,
+0x01,0x51,0x00,0xf5,0x00,0xfd,0xfc,0x1d,0x01,0x1c,0x04,0x5b,0x01,0x00,0xca,0x00,
+0x5f,0x00,0xf8,0xfa,0x00,0xf6,0x93,0x00,0x0a,0x10,0xf1,0xb5,0x00,0x1c,0xf2,0x16,
+0x00,0x01,0x90,0x00,0xc0,0xb4,0xb0,0x00,0x00,0xdd,0xf8,0xc1,0xfb,0x05,0x00,0x05,
+0x04,0xfe,0x00,0xd2,0xcf,0xe6,0x00,0xe6,0xc3,0xed,0xea,0x00,0xed,0xe8,0xf2,0xe9,
+0xee,0x54,0x01,0x66,0xc1,0xd2,0x00,0x00,0xea,0xfc,0x23,0x01,0xa3,0xf3,0xf3,0x00,
+0x00,0xf3,0xf7,0x00,0x00,0xf8,0xfd,0x73,0x01,0x94,0x04,0x00,0xd6,0xee,0x00,0x00,
+0xf3,0x00,0x00,0x9e,0x00,0x73,0x04,0xf6,0xf7,0x00,0x00,0xf7,0xfa,0x2c,0x01,0x03,
+0x15,0x00,0x10,0xd2,0x05,0x01,0x07,0x10,0x00,0x12,0xf8,0x1f,0x00,0x13,0xfa,0x2c,
+0x01,0xf6,0x11,0xf7,0x06,0xf2,0xbc,0xd4,0x00,0x00,0xd4,0xf8,0xe4,0xfb,0x05,0xe4,
+0x05,0x05,0x04,0x05,0x00,0x05,0xee,0xed,0xfa,0xf4,0xed,0xf4,0xef,0xfa,0xf5,0xfa,
+0x00,0xf9,0xf7,0xcc,0x02,0x2a,0x04,0xf8,0x8e,0x01,0x01,0x46,0x00,0x1b,0xf8,0xb1,
+0x01,0x14,0xfb,0x3f,0x02,0x0c,0x01,0x00,0x1f,0xfb,0x29,0x01,0x09,0x1b,0xfc,0x97,
+0x02,0x1e,0x00,0x01,0x00,0x40,0xfd,0x00,0xfc,0xfc,0x06,0x00,0x0f,0x01,0x00,0x0e,
+0x1f,0xfc,0x1d,0x00,0x0f,0x1e,0x05,0xa2,0x03,0x39,0x05,0x00,0xf9,0xd1,0x02,0x2f,
+0xe9,0x00,0x01,0x00,0x23,0x0a,0xa6,0x02,0x1f,0xe6,0x8c,0x00,0x0b,0x22,0xfa,0xfb,
+0xfa,0x02,0x1b,0xcd,0x1a,0x00,0x30,0xf7,0xfa,0x06,0x78,0x04,0x4f,0x0f,0x00,0x05,
+0x05,0x41,0x00,0x09,0x07,0xee,0x02,0x00,0xdc,0x01,0x1c,0xcf,0x60,0x00,0x2c,0xfc,
+0x04,0x0d,0x01,0x1f,0xdc,0xd2,0x00,0x23,0x1e,0xf4,0x23,0x00,0x0f,0xf5,0x01,0x12,
+0x1f,0xfa,0xb6,0x03,0x05,0x30,0x01,0x00,0x02,0x07,0x00,0x31,0x02,0x03,0x00,0x5c,
+0x03,0x1e,0x05,0x52,0x04,0xf1,0x0b,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,
+0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,
+0x19,0x20,0x00,0xf7,0x0c,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,
+0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,
+0x61,0x00,0x20,0x03,0x02,0x5c,0x00,0x4b,0x06,0x07,0x06,0x08,0x5f,0x00,0x70,0x09,
+0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xf2,0x07,0x0b,
+0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x00,0x00,0x00,0x16,
+0x00,0x17,0x17,0x17,0x18,0x1e,0x09,0xf0,0x04,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,
+0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x00,0x00,0x21,0x08,0x99,0x01,
+0x00,0x31,0x95,0x0d,0xff,0x01,0x00,0x2a,0xf8,0x0c,0x08,0x00,0x2a,0xf7,0x0b,0x08,
+0x00,0x22,0xf6,0x0a,0x08,0x00,0x2a,0xf5,0x09,0x08,0x00,0x2a,0xf4,0x08,0x08,0x00,
+0x2a,0xf3,0x07,0x08,0x00,0x2a,0xf2,0x06,0x08,0x00,0x2a,0xf1,0x05,0x08,0x00,0x2b,
+0xf0,0x04,0x08,0x00,0x12,0x03,0x08,0x00,0x14,0xe0,0x08,0x00,0x12,0x02,0x08,0x00,
+0x2a,0xd0,0x01,0x08,0x00,0x2a,0xc0,0x00,0x08,0x00,0x1b,0xb0,0x08,0x00,0x39,0xa0,
+0x00,0xef,0x08,0x00,0x39,0x90,0x00,0xdf,0x08,0x00,0x39,0x80,0x00,0xcf,0x08,0x00,
+0x31,0x70,0x00,0xbf,0x08,0x00,0x39,0x60,0x00,0xaf,0x08,0x00,0x39,0x50,0x00,0x9f,
+0x08,0x00,0x39,0x40,0x00,0x8f,0x08,0x00,0x39,0x30,0x00,0x7f,0x08,0x00,0x39,0x20,
+0x00,0x6f,0x08,0x00,0x39,0x10,0x00,0x5f,0x08,0x00,0x33,0x00,0x00,0x4f,0x08,0x00,
+0x0f,0x01,0x00,0x27,0x30,0x35,0x54,0x20,0x07,0x00,0x80,0x7e,0xff,0xff,0xfd,0x50,
+0x00,0x00,0x1c,0x4f,0x00,0x23,0xfa,0x00,0xc8,0x00,0x23,0x90,0x06,0x80,0x01,0x03,
+0xd8,0x01,0x22,0xf9,0x1f,0x08,0x00,0x22,0xfd,0x2f,0x08,0x00,0x14,0xfe,0x08,0x00,
+0x12,0x0f,0x08,0x00,0x14,0xfc,0xe8,0x01,0x04,0x70,0x01,0x05,0xe0,0x00,0x01,0xc1,
+0x01,0xf0,0x03,0xe4,0x00,0x00,0x00,0x18,0xce,0xfe,0xb7,0x00,0x00,0xee,0xee,0xee,
+0xee,0xe6,0x00,0x00,0x0a,0x08,0x00,0x12,0xaf,0x32,0x01,0x01,0x33,0x01,0x11,0xfb,
+0x3e,0x00,0x21,0x00,0x00,0x48,0x00,0x1f,0xbf,0x19,0x00,0x23,0x12,0x60,0x19,0x00,
+0x11,0xf9,0x49,0x02,0x03,0x19,0x00,0x12,0x8f,0x56,0x01,0x01,0x19,0x00,0x11,0xf6,
+0x32,0x02,0x03,0x19,0x00,0x13,0x5f,0x3f,0x01,0x10,0xbf,0xe6,0x00,0x02,0xb3,0x00,
+0x02,0x19,0x00,0x10,0x2f,0xcf,0x00,0x03,0x19,0x00,0x12,0xf0,0x0c,0x02,0x02,0x19,
+0x00,0x10,0x0f,0x5c,0x00,0x03,0x19,0x00,0x12,0xd0,0xf5,0x01,0x01,0x19,0x00,0x20,
+0xfc,0x0f,0x5c,0x00,0x03,0x19,0x00,0x12,0xa0,0xe6,0x01,0x01,0x19,0x00,0x20,0xf9,
+0x0f,0x5c,0x00,0x03,0x19,0x00,0x12,0x70,0xbf,0x01,0x01,0x19,0x00,0x20,0xf6,0x0f,
+0x5c,0x00,0x03,0x19,0x00,0x10,0x40,0x47,0x01,0x12,0x00,0x19,0x00,0x20,0xf3,0x0f,
+0x5c,0x00,0x03,0x19,0x00,0x10,0x10,0xe5,0x00,0x03,0x19,0x00,0x21,0xf0,0x0f,0x85,
+0x02,0x01,0x19,0x00,0x16,0xfe,0xc3,0x01,0x60,0x06,0x88,0x88,0x88,0x86,0x00,0x5d,
+0x01,0x49,0x88,0x88,0x88,0x83,0xde,0x01,0x11,0xef,0xa6,0x02,0x32,0x00,0x00,0x04,
+0x87,0x01,0x07,0x01,0x00,0x12,0x1f,0x38,0x01,0x11,0x00,0x6b,0x02,0x18,0xf1,0x1a,
+0x00,0x05,0x2c,0x00,0x1d,0x0a,0x5c,0x02,0x05,0x2c,0x00,0x11,0xdf,0x2e,0x03,0x07,
+0x01,0x00,0x23,0x09,0xff,0x93,0x00,0x04,0x20,0x01,0x06,0x01,0x00,0x12,0xcf,0x3e,
+0x01,0x23,0x00,0x02,0x9e,0x01,0x06,0x01,0x00,0x05,0x2c,0x00,0x13,0x5f,0x23,0x01,
+0x05,0x01,0x00,0x05,0x2c,0x00,0x13,0x08,0x31,0x01,0x06,0x01,0x00,0x05,0x2c,0x00,
+0x12,0xbf,0xaf,0x01,0x06,0x01,0x00,0x14,0x07,0xb0,0x00,0x13,0x0d,0x34,0x01,0x06,
+0x01,0x00,0x13,0xaf,0x52,0x01,0x13,0x00,0xb2,0x01,0x06,0x01,0x00,0x05,0x2c,0x00,
+0x10,0x3f,0x89,0x04,0x09,0x35,0x00,0x04,0x2c,0x00,0x12,0x06,0x84,0x03,0x07,0x01,
+0x00,0x05,0x2c,0x00,0x13,0x9f,0xc3,0x01,0x05,0x01,0x00,0x14,0x05,0x2c,0x00,0x10,
+0x0b,0x28,0x03,0x09,0x4f,0x00,0x14,0x8f,0x2c,0x00,0x13,0xef,0xc6,0x01,0x05,0x01,
+0x00,0x01,0x40,0x02,0x09,0x95,0x01,0x09,0xc1,0x01,0x1f,0xa0,0xc1,0x01,0x0f,0x17,
+0xf2,0x02,0x01,0x0f,0x01,0x00,0x01,0x13,0x50,0x52,0x04,0x0e,0x01,0x00,0x1f,0xf5,
+0x35,0x00,0x8d,0x20,0x01,0x33,0x01,0x00,0x00,0xed,0x01,0x50,0xe3,0x33,0x33,0x33,
+0x34,0x15,0x00,0x11,0xa3,0x13,0x00,0x1f,0x10,0xc1,0x01,0x1b,0x18,0x30,0x1a,0x00,
+0x14,0x2f,0x2c,0x00,0x1f,0x8f,0xc1,0x01,0x02,0x1f,0x30,0xc1,0x01,0x20,0x14,0xfd,
+0x95,0x01,0x19,0xf8,0x35,0x00,0x13,0xdf,0xfe,0x02,0x13,0x03,0x13,0x04,0x0a,0xfe,
+0x02,0x01,0x2c,0x00,0x16,0x6f,0xc1,0x01,0x02,0x01,0x00,0x05,0x2c,0x00,0x1d,0x09,
+0x82,0x03,0x14,0x6f,0xfe,0x02,0x14,0xcf,0xd2,0x02,0x04,0x01,0x00,0x14,0x08,0x2c,
+0x00,0x12,0x0e,0xc3,0x05,0x07,0x01,0x00,0x13,0xbf,0x2c,0x00,0x13,0x01,0x39,0x05,
+0x01,0x62,0x03,0x10,0x22,0x01,0x00,0x10,0x2e,0x3d,0x01,0x00,0x09,0x00,0x10,0x5f,
+0x91,0x04,0x00,0x09,0x00,0x3e,0x21,0x00,0x00,0xa6,0x01,0x04,0x1f,0x07,0x1f,0x0f,
+0x1a,0x00,0x04,0x1f,0xfc,0x35,0x00,0x8e,0x19,0x00,0x2a,0x03,0x0f,0xbf,0x04,0x02,
+0x1f,0xff,0xbf,0x04,0x07,0x1f,0xc0,0xbf,0x04,0x21,0x1f,0x70,0xbf,0x04,0x06,0x1f,
+0xf4,0xbf,0x04,0x07,0x1f,0x10,0xbf,0x04,0x06,0x1f,0xe0,0xbf,0x04,0x21,0x1f,0x90,
+0xfe,0x02,0x06,0x1f,0xf6,0xfe,0x02,0x3b,0x1f,0xfe,0xfe,0x02,0x6c,0x1f,0x09,0xfe,
+0x02,0x07,0x41,0x58,0x88,0x88,0x88,0xf5,0x02,0xe0,0x88,0x88,0x88,0x88,0x40,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x6e,0x08,0xee,0xee,
+0xee,0xd0,0x00,0x01,0x00,0x5e,0x9f,0xff,0xff,0xfe,0x00,0x01,0x00,0x5f,0x09,0xff,
+0xff,0xff,0xe0,0x2f,0x00,0xa2,0x8b,0x02,0x58,0xae,0xff,0xff,0xff,0xf8,0x62,0x16,
+0x00,0x22,0x8d,0xff,0x01,0x00,0x28,0xfe,0x82,0x17,0x00,0x25,0x3b,0xff,0x01,0x00,
+0x25,0xfb,0x30,0x16,0x00,0x37,0x01,0xaf,0xff,0x01,0x00,0x14,0x90,0x17,0x00,0x38,
+0x04,0xef,0xff,0x01,0x00,0x13,0xd3,0x17,0x00,0x2a,0x05,0xff,0x01,0x00,0x1f,0xf4,
+0x17,0x00,0x03,0x22,0xff,0xf3,0x45,0x00,0x1c,0xff,0x01,0x00,0x11,0xe1,0x73,0x00,
+0x1d,0xef,0x18,0x00,0x13,0xc0,0xe3,0x00,0x0c,0x01,0x00,0x5e,0x60,0x00,0x00,0x00,
+0x2f,0x17,0x00,0x00,0x0a,0x01,0x13,0x0a,0x0c,0x00,0x53,0xfd,0x73,0x10,0x13,0x8e,
+0x0c,0x00,0x43,0xf7,0x00,0x00,0x00,0x0b,0x00,0x10,0xf6,0x52,0x00,0x13,0x1a,0x0d,
+0x00,0x42,0xd0,0x00,0x00,0x5f,0x0a,0x00,0x37,0xf5,0x00,0x00,0x3c,0x00,0x32,0x30,
+0x00,0x09,0x09,0x00,0x12,0xf9,0xc8,0x00,0x12,0x0d,0x0e,0x00,0x42,0xf8,0x00,0x00,
+0xcf,0x0a,0x00,0x12,0x20,0x18,0x00,0x14,0x4f,0x47,0x00,0x16,0x0e,0xaf,0x00,0x00,
+0x01,0x00,0x12,0xdf,0x0f,0x00,0x04,0x75,0x00,0x14,0xf9,0x80,0x02,0x04,0x05,0x01,
+0x12,0x1f,0x09,0x00,0x13,0x70,0x18,0x00,0x03,0x84,0x00,0x26,0x50,0x01,0xae,0x00,
+0x01,0xb0,0x01,0x04,0x0f,0x00,0x03,0x2f,0x00,0x13,0x80,0x18,0x00,0x05,0x0f,0x00,
+0x03,0xb5,0x01,0x04,0x9c,0x01,0x04,0xa5,0x00,0x03,0x8d,0x00,0x14,0xf0,0xb3,0x01,
+0x11,0x55,0x01,0x00,0x36,0x20,0x00,0xbf,0x3c,0x01,0x08,0x01,0x00,0x13,0x08,0x3c,
+0x01,0x1b,0x20,0x18,0x00,0x13,0x4f,0x48,0x01,0x0c,0x18,0x00,0x13,0xef,0x30,0x00,
+0x1e,0x50,0x47,0x00,0x01,0x01,0x00,0x1a,0xb3,0x18,0x00,0x14,0x1f,0x18,0x00,0x29,
+0xfa,0x30,0x18,0x00,0x15,0x7f,0xb6,0x01,0x19,0xc5,0x18,0x00,0x16,0xcf,0xce,0x01,
 0x17,0x81,0x17,0x00,0x08,0x1d,0x02,0x27,0xfa,0x20,0xd5,0x02,0x08,0x35,0x02,0x1e,
-0xb3,0x18,0x00,0x0c,0x31,0x00,0x16,0x01,0x60,0x00,0x0a,0x63,0x05,0x1e,0x8f,0xd8,
-0x02,0x01,0x01,0x00,0x18,0x2c,0x18,0x00,0x17,0xf6,0x3e,0x0b,0x17,0xdf,0x18,0x00,
-0x08,0x4a,0x06,0x1f,0x5c,0x18,0x00,0x04,0x17,0x03,0x52,0x03,0x09,0x3d,0x05,0x2c,
-0x18,0xef,0x38,0x03,0x03,0x01,0x00,0x15,0x4b,0x18,0x00,0x1a,0xe0,0xc9,0x03,0x1e,
-0x9f,0xc0,0x00,0x01,0x01,0x00,0x17,0x2b,0x08,0x03,0x08,0x01,0x00,0x1e,0x06,0xbf,
-0x00,0x09,0x89,0x03,0x1e,0xb0,0x30,0x00,0x0e,0x70,0x0e,0x06,0x08,0x03,0x30,0xf3,
-0x7b,0xbb,0x01,0x00,0x1c,0xba,0xcc,0x01,0x1b,0x5a,0xad,0x00,0x13,0x03,0xc1,0x02,
-0x03,0xaf,0x00,0x0c,0x13,0x02,0x13,0x88,0xe5,0x0f,0x1a,0x00,0xc1,0x02,0x12,0xf9,
-0x04,0x0f,0x06,0x46,0x06,0x03,0xee,0x07,0x13,0x83,0xcc,0x01,0x1b,0x00,0x1f,0x03,
-0x13,0x0f,0x1c,0x10,0x08,0x3c,0x06,0x00,0xe7,0x02,0x1a,0xcf,0x23,0x01,0x13,0x0c,
-0xbc,0x00,0x15,0x08,0xe4,0x03,0x09,0xa3,0x04,0x14,0x00,0xe3,0x0e,0x18,0x30,0xbb,
-0x00,0x25,0xff,0xc0,0x90,0x02,0x18,0x80,0x78,0x0b,0x16,0xf7,0xdb,0x04,0x54,0xea,
-0x53,0x21,0x35,0x9e,0x0d,0x00,0x14,0x10,0x67,0x00,0x0a,0x01,0x00,0x1e,0xa0,0xae,
-0x04,0x04,0xb3,0x00,0x0e,0x10,0x0b,0x02,0xa6,0x01,0x09,0x7f,0x05,0x07,0xf9,0x00,
-0x1f,0xbf,0xf4,0x08,0x04,0x0c,0x25,0x05,0x1a,0xfb,0x0e,0x01,0x0d,0x79,0x02,0x19,
-0x1a,0x17,0x00,0x1f,0xc3,0xa6,0x02,0x02,0x18,0xfc,0x45,0x07,0x24,0x16,0xbf,0x16,
-0x00,0x1a,0x72,0x15,0x02,0x20,0x03,0x68,0x0a,0x03,0x2e,0x86,0x30,0x6f,0x07,0x0f,
-0xb3,0x06,0x04,0x1e,0x8f,0xe2,0x06,0x0f,0x2f,0x00,0x91,0x6e,0x37,0xab,0xdd,0xcb,
-0x95,0x10,0x5f,0x11,0x09,0xc5,0x03,0x1e,0xc4,0x1f,0x00,0x09,0xee,0x04,0x0d,0x4e,
-0x05,0x06,0xb9,0x0b,0x0b,0xf6,0x02,0x08,0xfc,0x04,0x07,0x6b,0x04,0x1f,0x70,0x3e,
-0x00,0x0a,0x0b,0x3b,0x0e,0x0b,0x6a,0x05,0x00,0xdf,0x02,0x0e,0xc1,0x00,0x1f,0x1f,
-0x20,0x02,0x01,0x29,0x04,0x20,0xae,0x0a,0x57,0xff,0xa4,0x10,0x26,0xdf,0x55,0x06,
-0x48,0x01,0xef,0xa1,0x00,0xec,0x06,0x14,0x50,0x86,0x00,0x14,0x50,0x8e,0x02,0x27,
-0xf8,0x10,0x5e,0x00,0x14,0x70,0xc1,0x05,0x15,0xf9,0x57,0x0f,0x26,0xfe,0x70,0x7f,
-0x03,0x15,0xe0,0x68,0x00,0x15,0xd0,0x67,0x04,0x03,0xa9,0x00,0x15,0x7f,0xf9,0x02,
-0x15,0x2f,0x43,0x04,0x16,0x07,0x69,0x00,0x16,0x08,0xe2,0x03,0x05,0x9e,0x00,0x17,
-0x01,0xd2,0x04,0x15,0x8f,0x4f,0x07,0x15,0x0f,0xa1,0x0b,0x16,0xbf,0x74,0x04,0x16,
-0x08,0x52,0x01,0x05,0x43,0x04,0x17,0x4f,0x06,0x01,0x1e,0x8f,0x3f,0x00,0x17,0x0e,
-0x30,0x0b,0x1e,0x08,0x3f,0x00,0x18,0x08,0x84,0x01,0x0b,0x3f,0x00,0x04,0xb4,0x04,
-0x18,0xa0,0x5a,0x01,0x15,0x90,0xcb,0x04,0x13,0xf0,0xfd,0x06,0x18,0xf1,0x42,0x0c,
-0x15,0xfe,0xc5,0x03,0x13,0xfe,0x08,0x00,0x19,0xf6,0x00,0x05,0x14,0xf5,0x97,0x05,
-0x00,0xf2,0x00,0x17,0x1e,0x03,0x0d,0x03,0x16,0x00,0x14,0xf3,0x33,0x0b,0x13,0xf7,
-0xde,0x08,0x1a,0x30,0xf1,0x06,0x43,0xf7,0x10,0x00,0x3b,0xba,0x04,0x19,0x04,0xe9,
-0x09,0x13,0x00,0x8d,0x08,0x15,0xed,0xc2,0x04,0x1a,0xdf,0x13,0x03,0x18,0x08,0x37,
-0x02,0x12,0xf2,0xaa,0x01,0x1e,0xf5,0x2c,0x06,0x04,0xd2,0x08,0x1c,0x2f,0xec,0x0c,
-0x19,0x2e,0x26,0x07,0x1d,0x0b,0x7b,0x11,0x18,0x2d,0x94,0x02,0x1e,0x05,0xfb,0x02,
-0x14,0x09,0x1f,0x00,0x13,0xe4,0x94,0x08,0x1b,0xd0,0xee,0x0a,0x12,0xaf,0xf1,0x02,
-0x13,0x70,0x1d,0x05,0x1c,0xf4,0xf8,0x02,0x64,0x15,0x9c,0xdf,0xfe,0xdb,0x73,0x53,
-0x0d,0x1f,0xfa,0x3a,0x15,0x07,0x1e,0x0c,0x38,0x03,0x0d,0x2d,0x07,0x1e,0x60,0x1f,
-0x00,0x08,0x48,0x01,0x1f,0xc0,0x5e,0x00,0x07,0x1c,0xaf,0x17,0x0d,0x0e,0x86,0x09,
-0x0a,0x6b,0x0d,0x0d,0x92,0x07,0x0e,0xc0,0x04,0x0a,0xa5,0x01,0x0e,0x0b,0x0d,0x09,
-0x43,0x02,0x01,0xb3,0x13,0x5d,0x6a,0xce,0xff,0xec,0xa6,0x9c,0x04,0x04,0x8f,0x02,
-0x03,0xd3,0x08,0x0c,0xdd,0x04,0x12,0x6f,0xdb,0x01,0x24,0x02,0xcf,0x74,0x06,0x0a,
-0x25,0x01,0x12,0x1e,0x2b,0x03,0x16,0x05,0x7d,0x04,0x1d,0x40,0xc1,0x01,0x19,0x30,
-0x24,0x0c,0x1c,0x40,0x1e,0x0e,0x15,0x90,0x89,0x07,0x1c,0xff,0x21,0x02,0x12,0xdf,
-0x37,0x0c,0x1e,0xdf,0xf4,0x06,0x05,0x39,0x04,0x14,0xf5,0xfc,0x04,0x2c,0xfe,0xef,
-0x5e,0x09,0x12,0x1f,0x2f,0x00,0x00,0x2b,0x0b,0x00,0x10,0x17,0x2a,0x17,0xef,0x07,
-0x09,0x03,0x8f,0x02,0x14,0x04,0x61,0x07,0x02,0x4e,0x0a,0x19,0x10,0x3e,0x0f,0x13,
-0x80,0x43,0x03,0x14,0x10,0x49,0x09,0x19,0xf5,0x23,0x0b,0x13,0xd0,0x46,0x00,0x15,
-0x80,0x7d,0x08,0x18,0x80,0x7a,0x03,0x13,0xf4,0xc3,0x00,0x1b,0xf4,0xe7,0x04,0x03,
-0xea,0x04,0x23,0xfa,0x00,0x9d,0x00,0x15,0x20,0x70,0x00,0x18,0xb0,0xc9,0x08,0x13,
-0x10,0x66,0x00,0x15,0xf1,0x25,0x02,0x1c,0xfb,0x8f,0x02,0x15,0x0e,0xb3,0x00,0x17,
-0x04,0x83,0x02,0x24,0x01,0xef,0x0c,0x00,0x0a,0x3f,0x00,0x17,0xfc,0x8f,0x02,0x2e,
-0xf3,0x00,0x3f,0x00,0x16,0xb0,0x8f,0x02,0x15,0xf9,0xe4,0x00,0x15,0xf2,0xa8,0x04,
-0x1c,0xfb,0x8f,0x02,0x15,0x0d,0xd0,0x01,0x06,0xe7,0x04,0x08,0xba,0x05,0x01,0xbb,
-0x17,0x05,0x72,0x00,0x1a,0xf8,0x8f,0x02,0x03,0xb9,0x02,0x15,0xf2,0x41,0x06,0x02,
+0xb3,0x18,0x00,0x0c,0x31,0x00,0x28,0x01,0xcf,0x31,0x02,0x16,0x80,0x31,0x00,0x1e,
+0x8f,0xd8,0x02,0x01,0x01,0x00,0x18,0x2c,0x18,0x00,0x16,0xf6,0x18,0x00,0x27,0x04,
+0xdf,0x18,0x00,0x17,0xf9,0xaa,0x00,0x1f,0x5c,0x18,0x00,0x04,0x17,0x03,0x52,0x03,
+0x18,0xf8,0xf2,0x00,0x2c,0x18,0xef,0x38,0x03,0x03,0x01,0x00,0x15,0x4b,0x18,0x00,
+0x1a,0xe0,0xc9,0x03,0x1e,0x9f,0xc0,0x00,0x01,0x01,0x00,0x17,0x2b,0x08,0x03,0x08,
+0x01,0x00,0x1e,0x06,0xbf,0x00,0x09,0x89,0x03,0x1f,0xb0,0x30,0x00,0x04,0x0c,0x58,
+0x04,0x13,0x0d,0xc1,0x02,0x20,0x7b,0xbb,0x01,0x00,0x1c,0xba,0xcc,0x01,0x1b,0x5a,
+0xad,0x00,0x13,0x03,0xc1,0x02,0x03,0xaf,0x00,0x0c,0x13,0x02,0x12,0x88,0x07,0x00,
+0x2a,0xf2,0x00,0xc1,0x02,0x23,0xf9,0x6f,0x0f,0x03,0x04,0x17,0x00,0x12,0x0f,0x10,
+0x00,0x13,0x83,0xcc,0x01,0x1b,0x00,0x1f,0x03,0x03,0x1f,0x00,0x14,0xf1,0x18,0x00,
+0x13,0x6f,0xe7,0x02,0x1a,0xcf,0x23,0x01,0x13,0x0c,0xbc,0x00,0x15,0x08,0xe4,0x03,
+0x09,0xa3,0x04,0x04,0x4f,0x04,0x27,0xfe,0x30,0xbb,0x00,0x00,0xd2,0x03,0x18,0xcf,
+0x6b,0x01,0x15,0x07,0x51,0x04,0x05,0xdb,0x04,0x54,0xea,0x53,0x21,0x35,0x9e,0x0d,
+0x00,0x14,0x10,0x67,0x00,0x0a,0x01,0x00,0x1e,0xa0,0xae,0x04,0x04,0xb3,0x00,0x06,
+0x07,0x03,0x0a,0x65,0x02,0x09,0x7f,0x05,0x07,0xf9,0x00,0x1c,0xbf,0x17,0x00,0x15,
+0xfc,0x08,0x06,0x09,0x01,0x00,0x1a,0xfb,0x0e,0x01,0x0d,0x79,0x02,0x19,0x1a,0x17,
+0x00,0x1f,0xc3,0xa6,0x02,0x02,0x27,0xfc,0x40,0xfc,0x01,0x24,0x16,0xbf,0x16,0x00,
+0x1a,0x72,0x15,0x02,0x20,0x03,0x68,0x0a,0x03,0x2d,0x86,0x30,0x86,0x06,0x1f,0x08,
+0xb3,0x06,0x04,0x1e,0x8f,0xe2,0x06,0x0f,0x2f,0x00,0x87,0x50,0x00,0x00,0x00,0x00,
+0x00,0x10,0x00,0x01,0x00,0x7f,0x37,0xab,0xdd,0xcb,0x95,0x10,0x00,0x01,0x00,0x04,
+0x30,0x18,0xef,0xff,0x01,0x00,0x1f,0xc4,0x1f,0x00,0x04,0x22,0x7f,0xff,0x01,0x00,
+0x2f,0xfd,0x20,0x1f,0x00,0x02,0x24,0xbf,0xff,0x01,0x00,0x2e,0x50,0x00,0x01,0x00,
+0x35,0x01,0xdf,0xff,0x01,0x00,0x1f,0x70,0x3e,0x00,0x0a,0x3f,0xff,0xff,0x40,0x7c,
+0x00,0x07,0x00,0x01,0x00,0x1e,0xfe,0xc1,0x00,0x27,0x1f,0xff,0x01,0x00,0x13,0xf8,
+0x15,0x00,0x15,0x04,0xa8,0x00,0x11,0x07,0x18,0x00,0x31,0xa4,0x10,0x26,0x85,0x00,
+0x13,0xf0,0x92,0x00,0x24,0xef,0xa1,0x20,0x00,0x14,0xdf,0xb6,0x00,0x17,0xbf,0xbf,
+0x00,0x47,0x9f,0xff,0xf8,0x10,0x5e,0x00,0x10,0x70,0x33,0x00,0x00,0x21,0x01,0x12,
+0xf9,0x15,0x00,0x42,0x3f,0xff,0xff,0xfe,0xc9,0x00,0x10,0x05,0x1f,0x00,0x15,0xe0,
+0x68,0x00,0x11,0xd0,0x15,0x00,0x16,0x0d,0xa9,0x00,0x00,0xbc,0x00,0x11,0xfa,0x0a,
+0x00,0x10,0x2f,0x20,0x00,0x06,0x92,0x00,0x02,0x69,0x00,0x10,0x08,0x0b,0x00,0x11,
+0x80,0x0b,0x00,0x05,0x9e,0x00,0x10,0x01,0x0a,0x00,0x12,0xb0,0x69,0x00,0x51,0x8f,
+0xff,0xff,0xff,0xf7,0x0a,0x00,0x10,0x0f,0x16,0x00,0x14,0x10,0x2e,0x01,0x26,0xf2,
+0x00,0x3f,0x00,0x15,0x70,0x3f,0x00,0x10,0xf1,0x09,0x00,0x17,0x4f,0x06,0x01,0x1e,
+0x8f,0x3f,0x00,0x10,0x0e,0xc5,0x01,0x1f,0x00,0x3f,0x00,0x06,0x18,0x08,0x84,0x01,
+0x0a,0x3f,0x00,0x00,0xbd,0x00,0x10,0x02,0x08,0x00,0x18,0xa0,0x5a,0x01,0x24,0x90,
+0x00,0x17,0x00,0x00,0xbd,0x00,0x14,0xcf,0x86,0x00,0x00,0x01,0x00,0x10,0x5f,0x07,
+0x01,0x01,0x0a,0x00,0x13,0x6f,0x0a,0x00,0x00,0x08,0x00,0x14,0xf6,0x1f,0x00,0x01,
+0x35,0x00,0x14,0xf5,0x30,0x01,0x00,0xf2,0x00,0x55,0x1e,0xff,0xff,0xff,0xfc,0xd8,
+0x01,0x01,0x16,0x00,0x62,0xf3,0x00,0x00,0x00,0x09,0xff,0x88,0x00,0x10,0x0a,0x08,
+0x00,0x15,0x30,0x20,0x00,0x11,0x8f,0x17,0x00,0x42,0x10,0x00,0x3b,0xff,0xdc,0x00,
+0x15,0x04,0x8f,0x00,0x02,0xe3,0x01,0x02,0x11,0x02,0x33,0xed,0xff,0xff,0xb4,0x00,
+0x14,0xdf,0xaa,0x01,0x07,0xfd,0x00,0x04,0x01,0x00,0x12,0xf2,0xaa,0x01,0x17,0xf5,
+0x57,0x02,0x17,0x0d,0x1f,0x00,0x12,0xf7,0xbf,0x01,0x18,0xfb,0x77,0x02,0x15,0x2e,
+0x1f,0x00,0x00,0x16,0x02,0x10,0x0b,0x08,0x00,0x09,0x1c,0x03,0x18,0x2d,0x94,0x02,
+0x1e,0x05,0xfb,0x02,0x14,0x09,0x1f,0x00,0x55,0xe4,0x00,0x00,0x00,0xef,0x3c,0x02,
+0x15,0x00,0x1f,0x01,0x12,0xaf,0xf1,0x02,0x11,0x70,0x8f,0x02,0x3c,0xff,0xff,0xf4,
+0xf8,0x02,0x63,0x15,0x9c,0xdf,0xfe,0xdb,0x73,0x8f,0x02,0x03,0x65,0x02,0x0f,0x01,
+0x00,0x02,0x1e,0x0c,0x38,0x03,0x08,0x01,0x00,0x10,0x06,0x67,0x00,0x1e,0x60,0x1f,
+0x00,0x08,0x48,0x01,0x1f,0xc0,0x5e,0x00,0x07,0x16,0xaf,0x8f,0x02,0x0e,0x01,0x00,
+0x0a,0x8f,0x02,0x0e,0x01,0x00,0x02,0x2b,0x03,0x0f,0x1f,0x00,0x07,0x1e,0x08,0x13,
+0x04,0x09,0x24,0x01,0x04,0x2b,0x03,0x6d,0x02,0x6a,0xce,0xff,0xec,0xa6,0x9c,0x04,
+0x04,0x8f,0x02,0x2f,0x5c,0xff,0xdd,0x04,0x02,0x12,0x6f,0xdb,0x01,0x23,0x02,0xcf,
+0x8a,0x01,0x1a,0xfb,0x25,0x01,0x12,0x1e,0x2b,0x03,0x16,0x05,0x7d,0x04,0x1d,0x40,
+0xc1,0x01,0x17,0x30,0x1f,0x00,0x0a,0xaa,0x00,0x12,0x03,0x8f,0x02,0x18,0x03,0x67,
+0x02,0x08,0xa1,0x00,0x00,0x8f,0x02,0x13,0xe1,0x7f,0x04,0x04,0x80,0x00,0x0b,0xf5,
+0x04,0x14,0xf5,0xfc,0x04,0x12,0xfe,0x9d,0x05,0x1a,0xf4,0xf5,0x04,0x12,0xfb,0xce,
+0x03,0x67,0xff,0xfd,0x50,0x00,0x17,0xef,0x35,0x04,0x15,0x00,0x8f,0x02,0x23,0x04,
+0xff,0x52,0x03,0x25,0x02,0xef,0x3f,0x04,0x05,0xb6,0x04,0x13,0x80,0x43,0x03,0x10,
+0x10,0x2f,0x05,0x19,0xff,0xfe,0x02,0x03,0x8f,0x02,0x15,0x0b,0x9e,0x04,0x16,0x0c,
+0xa8,0x04,0x03,0x7a,0x03,0x13,0xf4,0xc3,0x00,0x1b,0xf4,0xe7,0x04,0x03,0xea,0x04,
+0x13,0xfa,0x6b,0x04,0x02,0xf3,0x00,0x18,0x05,0x9e,0x00,0x14,0x0c,0x75,0x00,0x15,
+0xef,0x2d,0x04,0x17,0x4f,0xfd,0x00,0x05,0x8f,0x02,0x15,0x0e,0xb3,0x00,0x17,0x04,
+0x83,0x02,0x24,0x01,0xef,0x0c,0x00,0x0a,0x3f,0x00,0x17,0xfc,0x8f,0x02,0x2e,0xf3,
+0x00,0x3f,0x00,0x16,0xb0,0x8f,0x02,0x15,0xf9,0xe4,0x00,0x15,0xf2,0xa8,0x04,0x1c,
+0xfb,0x8f,0x02,0x15,0x0d,0xd0,0x01,0x06,0xe7,0x04,0x08,0xba,0x05,0x15,0xbf,0x49,
+0x00,0x15,0xaf,0xe2,0x02,0x05,0x8f,0x02,0x03,0xb9,0x02,0x15,0xf2,0x41,0x06,0x02,
 0x34,0x00,0x16,0x4e,0x2b,0x03,0x10,0x3f,0x16,0x00,0x14,0xd1,0xaa,0x01,0x15,0xf0,
-0x51,0x05,0x18,0xf7,0xa5,0x0c,0x48,0xe6,0x00,0x00,0x4c,0x18,0x02,0x49,0x01,0x9f,
-0xfd,0x00,0x40,0x15,0x1b,0xdd,0x77,0x02,0x2e,0x2a,0x30,0xbd,0x04,0x0e,0x1e,0x0b,
-0x04,0x7f,0x00,0x03,0x01,0x00,0x1e,0xe2,0x59,0x03,0x08,0x76,0x09,0x09,0x30,0x12,
-0x08,0xdb,0x05,0x06,0xbe,0x04,0x0e,0x01,0x00,0x05,0xfd,0x04,0x1f,0xc2,0xb9,0x03,
-0x03,0x22,0x05,0xdf,0x8b,0x09,0x1f,0x50,0xda,0x03,0x05,0x6b,0x26,0xad,0xef,0xfe,
-0xca,0x62,0x14,0x00,0x6f,0x9c,0xde,0xff,0xec,0xa7,0x30,0xc5,0x04,0x03,0x03,0x48,
-0x03,0x1f,0xe8,0xe8,0x04,0x01,0x1f,0x6e,0x7e,0x08,0x08,0x17,0x02,0x50,0x0d,0x0d,
-0xad,0x00,0x18,0x03,0x85,0x0d,0x1c,0xe3,0x1d,0x00,0x0e,0x1a,0x10,0x0e,0xef,0x0d,
-0x08,0x20,0x10,0x0e,0xf1,0x08,0x0e,0xa1,0x01,0x0e,0xf2,0x0a,0x0a,0x52,0x09,0x1b,
-0x0e,0x1d,0x00,0x1d,0xfd,0x15,0x13,0x0e,0xc7,0x10,0x0a,0x75,0x00,0x4b,0xd6,0x10,
-0x13,0x9f,0x15,0x11,0x28,0x00,0x00,0xa3,0x0f,0x1d,0x3e,0x59,0x00,0x15,0x04,0x44,
-0x07,0x04,0x3a,0x02,0x1b,0xf0,0x70,0x13,0x04,0x8a,0x03,0x1c,0x9f,0xe7,0x04,0x17,
-0x0a,0xfb,0x0b,0x1d,0x04,0x29,0x01,0x17,0xbf,0x95,0x01,0x18,0x1f,0xd6,0x0c,0x06,
-0xf1,0x0c,0x17,0xf5,0xcd,0x07,0x1d,0xf2,0x67,0x0f,0x17,0x50,0xce,0x02,0x0b,0xe9,
-0x13,0x04,0x95,0x03,0x14,0x07,0x2a,0x11,0x09,0xb2,0x06,0x04,0x50,0x04,0x1c,0xdf,
-0xe6,0x0e,0x17,0x07,0xaa,0x05,0x1d,0x7f,0xd5,0x05,0x02,0x54,0x10,0x05,0x4c,0x15,
-0x0b,0xb5,0x07,0x06,0x10,0x0e,0x1e,0x7f,0xaf,0x0e,0x14,0x0a,0xec,0x01,0x29,0x01,
-0xbf,0xec,0x15,0x09,0x91,0x03,0x39,0x50,0x05,0xef,0xde,0x0d,0x0a,0xbb,0x01,0x17,
-0x3a,0x3e,0x12,0x0e,0x88,0x02,0x0c,0xeb,0x12,0x09,0x77,0x00,0x0e,0x1d,0x00,0x0e,
-0x3c,0x0b,0x1e,0x80,0x79,0x0b,0x0e,0x86,0x02,0x0e,0xe9,0x10,0x0f,0x15,0x0c,0x02,
-0x1e,0x02,0x43,0x10,0x0e,0x6c,0x11,0x0c,0x09,0x16,0x0b,0x1d,0x00,0x0f,0x99,0x04,
-0x01,0x1f,0x1b,0x49,0x0c,0x09,0x1c,0x3e,0xaf,0x00,0x20,0x07,0xaa,0x01,0x00,0x1b,
-0x80,0xb3,0x04,0x04,0x5e,0x01,0x16,0xcf,0x87,0x01,0x1d,0x6f,0x63,0x0c,0x16,0x0d,
-0x9a,0x03,0x1e,0x6f,0x71,0x03,0x15,0xef,0x97,0x05,0x1e,0x5f,0xb6,0x0e,0x15,0x0f,
-0x6b,0x01,0x28,0x3f,0xff,0xbf,0x07,0x25,0xff,0xf9,0xae,0x01,0x16,0xf8,0xa4,0x05,
-0x27,0xfc,0x13,0x37,0x0f,0x14,0x6f,0xe0,0x01,0x13,0x08,0x6e,0x00,0x26,0x10,0x05,
-0xcb,0x03,0x14,0x0a,0x09,0x00,0x15,0x01,0xa9,0x00,0x16,0x07,0xc0,0x0a,0x14,0xef,
-0xb8,0x02,0x15,0x7f,0x25,0x02,0x15,0x09,0x7e,0x04,0x14,0x4f,0xb6,0x03,0x25,0x0d,
-0xff,0xb7,0x02,0x14,0x0b,0x23,0x10,0x14,0x0a,0xbb,0x00,0x05,0xb1,0x13,0x07,0x42,
-0x06,0x15,0xa1,0x1c,0x02,0x17,0x5f,0x1a,0x03,0x13,0x1e,0x1e,0x00,0x14,0xdf,0x93,
-0x00,0x18,0x08,0xb4,0x13,0x1c,0x3f,0xd4,0x14,0x09,0x41,0x11,0x1b,0x5f,0x91,0x02,
-0x19,0x0a,0xef,0x13,0x1b,0x7f,0x54,0x05,0x14,0xaf,0x99,0x10,0x0c,0x26,0x10,0x16,
-0xfd,0x44,0x0b,0x1e,0xf4,0x57,0x05,0x16,0x60,0x4b,0x00,0x1a,0x90,0xd5,0x14,0x03,
-0xfe,0x00,0x15,0x05,0xf2,0x10,0x0b,0xb0,0x05,0x17,0xf5,0x18,0x03,0x1c,0xfb,0x63,
-0x03,0x18,0xfb,0x4a,0x00,0x1c,0xf9,0x62,0x13,0x18,0x10,0x63,0x11,0x2a,0xfb,0x10,
-0xeb,0x12,0x1a,0xe1,0x71,0x03,0x5b,0x95,0x10,0x00,0x14,0x8c,0x29,0x16,0x0e,0x2a,
-0x16,0x08,0x21,0x06,0x1f,0x01,0x50,0x1a,0x05,0x18,0x80,0xf3,0x12,0x0e,0x6b,0x16,
-0x09,0x6d,0x0c,0x0c,0x01,0x00,0x27,0x40,0x00,0x0a,0x02,0x0d,0x01,0x00,0x1e,0x30,
-0x42,0x04,0x0c,0x28,0x03,0x0c,0x2b,0x1d,0x28,0xd4,0x8f,0xd7,0x11,0x18,0x03,0xdf,
-0x0a,0x00,0xcc,0x0c,0x19,0xaf,0x59,0x01,0x17,0x6d,0x1d,0x00,0x16,0xd6,0x53,0x04,
-0x13,0xf9,0x77,0x06,0x14,0xae,0x1c,0x00,0x27,0xd8,0x30,0x46,0x10,0x14,0xf7,0x95,
-0x01,0x7b,0x69,0xbd,0xef,0xff,0xfe,0xca,0x75,0xf2,0x07,0x11,0x0f,0x92,0x0f,0x06,
-0xee,0x21,0x0f,0x0b,0x00,0x08,0x21,0xfd,0x0f,0x7b,0x01,0x01,0x91,0x00,0x24,0x0f,
-0xff,0x0f,0x21,0x01,0x08,0x21,0x02,0x01,0x21,0x21,0xf6,0x0f,0x4c,0x04,0x01,0x64,
-0x02,0x11,0x0f,0x11,0x01,0x01,0x6d,0x03,0x02,0x4d,0x0f,0x14,0xff,0xe9,0x20,0x21,
-0xfe,0x00,0x55,0x02,0x11,0x0f,0xf6,0x00,0x01,0xaf,0x01,0x11,0x0f,0xf4,0x06,0x0e,
-0x71,0x05,0x08,0xb1,0x08,0x28,0xe7,0x00,0xa4,0x15,0x19,0xd0,0x00,0x08,0x18,0x20,
-0xac,0x06,0x19,0xf8,0x72,0x05,0x19,0xe0,0x7f,0x05,0x18,0x40,0x0d,0x00,0x19,0xf9,
-0x07,0x03,0x17,0x50,0x9e,0x07,0x27,0xfe,0x30,0x7b,0x03,0x04,0x0d,0x00,0x18,0x2f,
-0x69,0x06,0x18,0x0c,0x34,0x00,0x18,0x06,0x0f,0x06,0x19,0x02,0x1a,0x18,0x18,0xbf,
-0x88,0x07,0x18,0x4f,0x72,0x11,0x18,0x0c,0x9f,0x11,0x19,0x05,0xa3,0x05,0x18,0xdf,
-0x56,0x15,0x1d,0x5f,0x35,0x00,0x04,0x84,0x03,0x16,0x03,0x66,0x08,0x04,0x0c,0x03,
-0x18,0xf4,0xd5,0x01,0x19,0xfe,0xe7,0x08,0x18,0xa0,0xce,0x07,0x19,0xf5,0x6b,0x15,
-0x09,0x28,0x00,0x18,0xb0,0x50,0x00,0x19,0xf7,0x20,0x0b,0x18,0x30,0x2a,0x10,0x18,
-0xf0,0xa0,0x00,0x19,0xfd,0xa5,0x0f,0x18,0xa0,0x66,0x01,0x19,0xf7,0x6b,0x00,0x2e,
-0x40,0x00,0xa0,0x08,0x0a,0xed,0x24,0x19,0x07,0x54,0x16,0x18,0x9f,0xfb,0x07,0x19,
-0x0a,0xa1,0x00,0x09,0xc4,0x01,0x19,0x0e,0x92,0x07,0x1e,0xff,0x79,0x00,0x18,0x70,
-0x79,0x00,0x19,0xf6,0xcf,0x07,0x18,0x50,0xb9,0x01,0x28,0xf5,0x00,0xee,0x01,0x18,
-0x40,0x6a,0x01,0x19,0xf4,0x7c,0x08,0x1f,0x40,0x36,0x00,0x07,0x1e,0x50,0x6c,0x00,
-0x0b,0x87,0x00,0x0a,0xa2,0x00,0x0a,0xbd,0x00,0x09,0x63,0x09,0x1e,0x0b,0xe4,0x01,
-0x1e,0xfc,0x29,0x01,0x05,0x26,0x06,0x09,0x4e,0x08,0x19,0xf1,0x7a,0x00,0x18,0x30,
-0x37,0x01,0x19,0xf6,0xb0,0x01,0x18,0x90,0x4a,0x0b,0x19,0xfc,0x44,0x00,0x19,0xf0,
-0xa3,0x00,0x18,0x30,0x44,0x02,0x1e,0xf6,0x5f,0x02,0x05,0x53,0x01,0x09,0x89,0x09,
-0x19,0xf4,0x66,0x18,0x18,0x90,0x29,0x00,0x05,0x36,0x0b,0x09,0x28,0x03,0x19,0x04,
-0x29,0x00,0x19,0x0d,0xe2,0x18,0x19,0x6f,0x29,0x0a,0x18,0xef,0x54,0x0a,0x19,0x08,
-0x7f,0x0a,0x02,0xeb,0x0f,0x09,0x37,0x00,0x19,0xf5,0xc4,0x14,0x1e,0xe1,0x6e,0x00,
-0x05,0x12,0x01,0x19,0x50,0x7c,0x00,0x18,0x20,0xa8,0x02,0x19,0xfd,0xc8,0x0b,0x19,
-0xfb,0xc1,0x00,0x19,0xfb,0xc1,0x15,0x28,0xfc,0x10,0x9b,0x1a,0x19,0xfb,0xa9,0x1a,
-0x18,0x50,0x0e,0x00,0x18,0xf0,0xf9,0x15,0x19,0xfa,0x79,0x0b,0x07,0x4d,0x0b,0x19,
-0x5e,0xa1,0x16,0x29,0x19,0xf8,0x3f,0x0a,0x4a,0x10,0x00,0x00,0x01,0xc5,0x12,0x1a,
-0xc3,0x19,0x20,0x19,0xa1,0x82,0x0c,0x29,0xfe,0x40,0x59,0x11,0x1c,0xf7,0x86,0x11,
-0x08,0x0d,0x01,0x1a,0xfa,0x4c,0x0d,0x19,0xa0,0x6e,0x01,0x1a,0xf9,0x86,0x0d,0x19,
-0x60,0xeb,0x01,0x19,0xf4,0x19,0x0b,0x29,0xfe,0x10,0xc7,0x03,0x19,0xa0,0x8d,0x01,
-0x1a,0xf6,0xd9,0x0b,0x19,0x10,0x65,0x00,0x19,0xa0,0xef,0x01,0x2e,0xf3,0x00,0xaf,
-0x02,0x05,0xa3,0x04,0x19,0x60,0x95,0x02,0x19,0xd0,0x39,0x00,0x19,0xf5,0x8f,0x00,
-0x1a,0xfc,0xd4,0x0b,0x1f,0x40,0x71,0x03,0x02,0x19,0x05,0x49,0x03,0x0a,0xd1,0x03,
-0x08,0x10,0x0b,0x05,0x3e,0x09,0x19,0x20,0x09,0x04,0x19,0x70,0x9c,0x00,0x19,0xb0,
-0x00,0x01,0x19,0xf0,0xc7,0x03,0x19,0xf4,0x3a,0x09,0x05,0x56,0x01,0x0a,0xfa,0x0c,
-0x02,0xd1,0x07,0x0a,0x97,0x0d,0x19,0x30,0x56,0x0e,0x19,0x60,0x8e,0x01,0x19,0x90,
-0x60,0x05,0x19,0xb0,0x9b,0x00,0x19,0xd0,0xfe,0x00,0x19,0xf0,0x2b,0x04,0x19,0xf1,
-0xb7,0x00,0x19,0xf3,0x0e,0x00,0x1e,0xf5,0x6e,0x0e,0x05,0x0e,0x00,0x19,0xf6,0x44,
-0x01,0x1e,0xf7,0x5d,0x0e,0x05,0xfd,0x00,0x0f,0x0e,0x00,0x17,0x1f,0xf7,0x54,0x00,
-0x08,0x1e,0xf6,0x7e,0x00,0x0d,0xa8,0x00,0x0a,0xc4,0x00,0x19,0x0e,0x78,0x06,0x19,
-0x0f,0xfc,0x00,0x19,0x1f,0x50,0x05,0x19,0x3f,0xc7,0x07,0x19,0x5f,0x50,0x01,0x19,
-0x7f,0x6c,0x01,0x19,0x9f,0x88,0x01,0x19,0xbf,0xa4,0x01,0x09,0x1b,0x10,0x19,0x02,
-0xdc,0x01,0x19,0x05,0xa7,0x00,0x19,0x09,0x79,0x01,0x19,0x0c,0xa3,0x01,0x19,0x0f,
-0x1f,0x06,0x1e,0x5f,0x8a,0x05,0x19,0xfd,0xe7,0x02,0x05,0xd3,0x19,0x09,0xec,0x00,
-0x19,0x09,0xd0,0x00,0x19,0x0e,0xe6,0x04,0x19,0x5f,0x62,0x05,0x19,0xcf,0x35,0x0a,
-0x09,0x23,0x01,0x19,0x0a,0xd6,0x02,0x19,0x3f,0x37,0x00,0x18,0xbf,0xcf,0x00,0x1e,
-0x05,0x6e,0x00,0x0a,0xb3,0x00,0x19,0xf8,0x29,0x04,0x19,0xc0,0x75,0x01,0x18,0x20,
-0x29,0x05,0x19,0xf6,0x3f,0x18,0x18,0x90,0xdb,0x00,0x19,0xfb,0x20,0x01,0x18,0xd0,
-0xa4,0x00,0x28,0xfd,0x10,0x05,0x01,0x18,0xc1,0xa9,0x15,0x19,0xfb,0x4c,0x23,0x18,
-0x80,0x53,0x10,0x18,0xd3,0x69,0x17,0x19,0xe7,0x34,0x10,0x0f,0xab,0x17,0x05,0x1f,
-0xfd,0x2a,0x14,0x01,0x1e,0xfc,0x15,0x00,0x0c,0xf9,0x25,0x07,0xf7,0x15,0x0d,0x61,
-0x10,0x0d,0x02,0x10,0x05,0x53,0x25,0x0c,0x15,0x00,0x0a,0x53,0x2a,0x03,0x6a,0x01,
-0x1e,0xf7,0x34,0x18,0x0e,0x0a,0x20,0x01,0x63,0x02,0x1c,0xf5,0xe0,0x00,0x19,0x0b,
-0x04,0x13,0x34,0x4f,0xd6,0x10,0x51,0x01,0x12,0xf3,0xd6,0x01,0x10,0xb4,0x34,0x01,
-0x23,0xfa,0x30,0x4f,0x02,0x12,0xf2,0x08,0x1d,0x11,0xf9,0x57,0x01,0x13,0xfd,0x85,
-0x0f,0x12,0xf1,0xc8,0x20,0x13,0xfe,0x3a,0x02,0x31,0x93,0x00,0x08,0x40,0x02,0x21,
-0x01,0x7e,0x03,0x02,0x03,0x58,0x0d,0x21,0xc6,0x07,0xcd,0x2f,0x12,0xaf,0xd4,0x01,
-0x14,0x0e,0x69,0x1e,0x00,0xbd,0x00,0x13,0xdf,0x54,0x20,0x09,0x14,0x0f,0x04,0xe0,
-0x0e,0x09,0xb4,0x21,0x04,0x2e,0x1a,0x1d,0x27,0x23,0x1f,0x01,0x43,0x01,0x2b,0x59,
-0xef,0xfa,0x13,0x11,0x94,0x55,0x02,0x18,0x7b,0x14,0x00,0x24,0xb6,0x20,0xb0,0x02,
-0x15,0x9e,0x3b,0x0d,0x1d,0x40,0xb7,0x15,0x2e,0xfa,0x61,0xaa,0x14,0x0b,0x51,0x01,
-0x1a,0x0b,0x65,0x20,0x0a,0x62,0x22,0x1e,0xe1,0x73,0x14,0x0a,0x24,0x02,0x01,0x92,
-0x05,0x1b,0x6d,0x53,0x12,0x10,0xdf,0x25,0x00,0x0b,0x68,0x18,0x12,0x0a,0xd2,0x03,
-0x19,0xaf,0x35,0x14,0x12,0x7f,0x94,0x03,0x18,0x1f,0x05,0x03,0x13,0x04,0x17,0x04,
-0x18,0x06,0x28,0x03,0x14,0x2e,0x0a,0x05,0x17,0xcf,0xc6,0x03,0x19,0xcf,0x7c,0x11,
-0x16,0xf4,0x67,0x00,0x15,0xfe,0x36,0x04,0x02,0xb9,0x07,0x16,0x09,0x8b,0x00,0x16,
-0xef,0xff,0x04,0x15,0x4e,0x2d,0x07,0x17,0x5f,0xdd,0x16,0x14,0xaf,0xc2,0x07,0x17,
-0x0b,0x25,0x1a,0x35,0x05,0xef,0xf6,0x08,0x05,0x06,0x92,0x13,0x24,0x1a,0xc0,0xc7,
-0x00,0x2e,0xd2,0x00,0x01,0x00,0x1f,0x07,0xec,0x30,0x13,0x1e,0x05,0x91,0x13,0x0f,
-0x18,0x00,0xff,0x83,0x22,0x15,0x55,0x01,0x00,0x12,0x58,0x18,0x00,0x13,0xa5,0x0f,
-0x00,0x1a,0x52,0x15,0x14,0x06,0x47,0x1e,0x0f,0x18,0x00,0xf5,0x0f,0xe8,0x02,0xfe,
-0x0f,0x18,0x00,0xa6,0x14,0x07,0x50,0x09,0x02,0x44,0x0a,0x0f,0x11,0x00,0x39,0x13,
-0xe0,0x72,0x06,0x17,0xfc,0x87,0x11,0x13,0xbf,0x3f,0x02,0x13,0x0e,0xe4,0x0c,0x05,
-0xbb,0x11,0x13,0x5f,0x19,0x06,0x13,0x0b,0xcb,0x0a,0x14,0x01,0x43,0x00,0x13,0x7f,
-0x9e,0x09,0x13,0x0e,0x88,0x0d,0x05,0xdc,0x12,0x18,0xef,0x21,0x00,0x13,0xf5,0x2f,
-0x0b,0x10,0xfa,0x65,0x1d,0x04,0x07,0x09,0x14,0x19,0x2b,0x06,0x24,0x02,0xaf,0x33,
-0x0f,0x11,0x3a,0x08,0x00,0x09,0xd5,0x14,0x19,0x8d,0xbd,0x07,0x0f,0x1b,0x00,0x66,
-0x00,0x94,0x01,0x34,0x47,0x87,0x40,0x65,0x0e,0x00,0x74,0x09,0x13,0x1c,0x9c,0x19,
-0x13,0x0c,0xb6,0x0b,0x14,0x05,0x7e,0x03,0x13,0xbf,0x94,0x08,0x04,0x87,0x30,0x14,
-0x11,0x90,0x08,0x14,0x0f,0xa8,0x20,0x13,0xef,0x94,0x17,0x14,0x09,0xaf,0x15,0x14,
-0x2f,0x2f,0x16,0x19,0x6f,0x0f,0x18,0x00,0x75,0x07,0x5b,0x17,0xce,0xfe,0xc8,0x10,
-0x98,0x29,0x00,0xc2,0x2e,0x1d,0x84,0x7a,0x29,0x1c,0xf4,0x2f,0x0a,0x0a,0xa3,0x26,
-0x1d,0x7f,0x31,0x15,0x1c,0xdf,0x84,0x08,0x1d,0x02,0x1e,0x2a,0x1d,0x08,0x64,0x1a,
-0x05,0x38,0x24,0x0e,0x6b,0x00,0x0a,0xcb,0x08,0x1e,0x80,0x6b,0x00,0x0c,0x57,0x1b,
-0x0e,0x6b,0x00,0x1e,0xf8,0x6b,0x00,0x0d,0xc8,0x1b,0x1e,0xd0,0x6b,0x00,0x0d,0x81,
-0x2c,0x0d,0x6b,0x00,0x1e,0xfd,0x6b,0x00,0x0d,0xf9,0x1d,0x1f,0xf2,0x6b,0x00,0x0b,
-0x1e,0x9f,0x6b,0x00,0x0c,0x76,0x22,0x0e,0x6b,0x00,0x04,0x5e,0x25,0x0f,0x6b,0x00,
-0x09,0x1e,0x4f,0x6b,0x00,0x0d,0x83,0x1b,0x0d,0x6b,0x00,0x1f,0x04,0x6b,0x00,0x27,
-0x1f,0xc0,0x6b,0x00,0x21,0x1d,0xfc,0xf7,0x1c,0x1d,0xf7,0x18,0x18,0x1f,0xf1,0x6b,
-0x00,0x0b,0x1d,0xaf,0x6b,0x00,0x09,0xbe,0x11,0x05,0x03,0x05,0x0e,0x6b,0x00,0x1e,
-0xf6,0x6b,0x00,0x0d,0x30,0x21,0x0e,0x6b,0x00,0x1f,0x60,0x6b,0x00,0x0f,0x1f,0xfb,
-0x6b,0x00,0x22,0x1f,0xb0,0x6b,0x00,0x2e,0x1f,0x0b,0x6b,0x00,0x22,0x08,0x44,0x29,
-0x07,0x63,0x12,0x0d,0x6f,0x26,0x0e,0x6b,0x00,0x1d,0xf5,0x97,0x1e,0x1d,0xf0,0x15,
-0x21,0x1f,0xa0,0x6b,0x00,0x21,0x1f,0xfa,0x6b,0x00,0x2f,0x1f,0xcf,0x6b,0x00,0x21,
-0x1d,0x0c,0xf2,0x04,0x0e,0x6b,0x00,0x1d,0x7f,0x6b,0x00,0x05,0x5a,0x0a,0x6b,0x9b,
-0xde,0xff,0xfe,0xdb,0x85,0x58,0x05,0x14,0x17,0xf3,0x05,0x28,0xc7,0x10,0x8e,0x00,
-0x07,0x47,0x0e,0x17,0x81,0xd4,0x01,0x08,0x31,0x0e,0x1e,0xe5,0x78,0x28,0x0a,0x9a,
-0x13,0x1e,0x0b,0x7f,0x2d,0x0e,0x1b,0x1c,0x05,0xe3,0x00,0x1d,0x09,0xb6,0x0e,0x0e,
-0x81,0x22,0x06,0x08,0x14,0x1e,0x01,0x19,0x33,0x1f,0xe0,0xef,0x1c,0x04,0x17,0x80,
-0x19,0x33,0x56,0xe8,0x32,0x02,0x48,0xef,0x5b,0x1d,0x18,0x09,0xef,0x1c,0x16,0x9f,
-0x77,0x00,0x09,0x15,0x21,0x15,0x7f,0x5f,0x00,0x19,0x5f,0xfe,0x1d,0x14,0xaf,0x17,
-0x20,0x19,0x0a,0x6e,0x2f,0x15,0x01,0xd6,0x00,0x0a,0x0f,0x01,0x14,0x09,0x94,0x1e,
-0x1a,0x3f,0x08,0x0f,0x04,0x0f,0x00,0x1b,0x07,0x2a,0x30,0x19,0xef,0x5a,0x07,0x1c,
-0xfb,0xf4,0x21,0x1b,0x0d,0x38,0x09,0x13,0x7f,0x92,0x07,0x0b,0x05,0x21,0x04,0x1e,
-0x40,0x1b,0x2f,0x7d,0x0f,0x03,0x76,0x00,0x1b,0x24,0x70,0x30,0x13,0x01,0x63,0x01,
-0x19,0x5f,0xca,0x1e,0x05,0x64,0x1e,0x2b,0x56,0xff,0xab,0x23,0x03,0xff,0x07,0x1b,
-0x7f,0xce,0x30,0x03,0xf5,0x07,0x1f,0x77,0x2f,0x00,0x03,0x2f,0xf8,0x8f,0x2f,0x00,
-0x03,0x1f,0x98,0x2f,0x00,0x03,0x1f,0xf9,0x2f,0x00,0xff,0x1f,0x1f,0x88,0x78,0x01,
-0x04,0x0f,0xa7,0x01,0x04,0x1f,0x76,0xd6,0x01,0x04,0x0f,0x05,0x02,0x04,0x1b,0x53,
-0x34,0x02,0x13,0x02,0x34,0x02,0x05,0xd0,0x09,0x0a,0x63,0x02,0x1b,0x20,0x68,0x33,
-0x04,0x92,0x02,0x0c,0xc1,0x02,0x13,0x8f,0xc1,0x02,0x1a,0xaf,0xf0,0x02,0x13,0x0b,
-0xf0,0x02,0x1b,0x07,0xa5,0x00,0x04,0x1f,0x03,0x1a,0x3f,0x76,0x00,0x05,0x0f,0x00,
-0x19,0xef,0x1a,0x33,0x05,0x4c,0x22,0x0a,0xac,0x03,0x06,0x26,0x00,0x17,0x4f,0x90,
-0x26,0x05,0x0b,0x04,0x15,0x50,0xda,0x35,0x18,0x60,0x67,0x22,0x16,0xf0,0xa3,0x20,
-0x17,0x80,0x21,0x04,0x17,0xf9,0x8c,0x21,0x57,0xd7,0x30,0x01,0x37,0xdf,0xa2,0x2b,
-0x1e,0x7f,0x97,0x04,0x17,0x90,0x39,0x36,0x0c,0xd7,0x27,0x1e,0x04,0x0c,0x3e,0x0e,
-0x61,0x2e,0x07,0x5d,0x04,0x1e,0x0a,0xea,0x32,0x0e,0x18,0x00,0x07,0x64,0x08,0x1e,
-0x08,0x81,0x05,0x0e,0xcb,0x38,0x1f,0xf6,0x0f,0x06,0x03,0x28,0x91,0x00,0x02,0x33,
-0x14,0xcf,0xf1,0x00,0x1b,0x10,0x6d,0x06,0x10,0x8b,0x6d,0x06,0x1f,0x95,0xdb,0x31,
-0x03,0x3a,0x03,0x9c,0x60,0x84,0x39,0x17,0xf8,0x6b,0x00,0x19,0x6c,0x71,0x0a,0x19,
-0x5b,0xb6,0x0a,0x19,0x49,0x34,0x02,0x28,0x28,0xef,0x29,0x06,0x28,0x17,0xdf,0xf1,
-0x05,0x28,0x05,0xbf,0x48,0x06,0x28,0x04,0xaf,0x10,0x06,0x29,0x03,0x9e,0x67,0x06,
-0x1a,0x1d,0x25,0x01,0x1b,0x82,0x86,0x06,0x1f,0x2f,0x1f,0x00,0x31,0x28,0xfe,0x9f,
-0x1f,0x00,0x37,0xfd,0x83,0x00,0x1f,0x00,0x00,0x3d,0x34,0x15,0x0f,0x1f,0x00,0x27,
-0xfb,0x61,0xb1,0x03,0x38,0x2f,0xfa,0x50,0xa9,0x03,0x2b,0x81,0x40,0xd7,0x38,0x0a,
-0xc8,0x03,0x2f,0x80,0x00,0x1f,0x00,0xff,0xff,0xbf,0x8c,0x03,0x69,0xcd,0xef,0xfe,
-0xec,0xb9,0x63,0xa4,0x39,0x14,0xae,0xfe,0x25,0x19,0xa4,0x18,0x00,0x17,0x6d,0x18,
-0x26,0x07,0x62,0x04,0x0a,0xa1,0x3d,0x1e,0xd4,0xc8,0x2a,0x0b,0x86,0x00,0x1e,0x2d,
-0x4e,0x05,0x0c,0x0c,0x2a,0x09,0x19,0x00,0x07,0xb7,0x33,0x09,0x4b,0x00,0x2e,0x1d,
-0xff,0xbc,0x0a,0x0e,0xfe,0x26,0x0e,0x40,0x28,0x0d,0xab,0x2d,0x14,0xef,0xbe,0x0a,
-0x47,0x41,0x01,0x25,0xaf,0xcc,0x05,0x18,0x6f,0xb8,0x2a,0x16,0x3d,0xb8,0x29,0x19,
-0x0e,0x3c,0x32,0x15,0x1c,0x26,0x00,0x1a,0x04,0x79,0x2b,0x15,0x2f,0xc6,0x00,0x19,
-0x9f,0xfe,0x06,0x06,0xf2,0x0a,0x1a,0x0e,0xeb,0x07,0x14,0x01,0x19,0x3a,0x1b,0x02,
-0x5d,0x32,0x14,0x0c,0x56,0x07,0x1b,0x5f,0x4e,0x2c,0x13,0x9f,0x03,0x07,0x1b,0x08,
-0x34,0x08,0x04,0xdd,0x4a,0x0a,0xc7,0x29,0x06,0xd3,0x00,0x2b,0x20,0x0a,0xef,0x07,
-0x14,0x06,0x62,0x00,0x11,0x7a,0x80,0x2b,0x1c,0xa9,0x42,0x1a,0x0d,0x64,0x06,0x03,
-0x38,0x08,0x0e,0x66,0x34,0x0e,0x43,0x2c,0x0a,0x72,0x3e,0x0e,0x06,0x1c,0x0d,0x9f,
-0x2e,0x08,0xc2,0x2e,0x0d,0xb4,0x1c,0x04,0xcb,0x13,0x1e,0x40,0xfb,0x2c,0x0e,0xdf,
-0x2d,0x07,0xb3,0x08,0x1e,0xf5,0x5a,0x3c,0x0e,0xd5,0x2d,0x0a,0x92,0x3f,0x0b,0x09,
-0x1a,0x0e,0x91,0x2d,0x09,0xd2,0x3c,0x1e,0xd0,0x6d,0x30,0x0e,0x8e,0x31,0x07,0x5b,
-0x0d,0x1f,0xf7,0x73,0x39,0x04,0x1e,0xfb,0xb6,0x2d,0x03,0x59,0x2c,0x0e,0x84,0x39,
-0x0d,0xa3,0x34,0x08,0x18,0x00,0x1e,0x40,0xf7,0x35,0x0e,0x8e,0x3f,0x07,0x25,0x1c,
-0x1e,0x80,0x4c,0x2e,0x0e,0xf1,0x00,0x07,0x17,0x03,0x1e,0xa0,0x62,0x32,0x0e,0xbd,
-0x32,0x06,0xd6,0x3f,0x0d,0x2c,0x02,0x1e,0x3f,0x18,0x00,0x09,0xf0,0x03,0x1f,0xd1,
-0x18,0x00,0x14,0x1e,0x1d,0x7d,0x2e,0x0f,0x18,0x00,0x0a,0x1e,0x0c,0x99,0x01,0x09,
-0x39,0x0f,0x1e,0xf4,0x11,0x02,0x0e,0x18,0x00,0x07,0x52,0x0f,0x1e,0xf5,0x0e,0x2f,
-0x0e,0xfb,0x3e,0x09,0xca,0x3d,0x0e,0xa3,0x17,0x0d,0x3d,0x14,0x0e,0xa6,0x0a,0x05,
-0x38,0x0a,0x1f,0x03,0x37,0x2c,0x05,0x1f,0x5f,0x31,0x00,0x04,0x1f,0x05,0x31,0x00,
-0xb0,0x05,0x52,0x34,0x01,0x66,0x11,0x1b,0x97,0xdc,0x02,0x06,0x73,0x0a,0x2e,0xb6,
-0x10,0xb4,0x34,0x02,0x92,0x04,0x1e,0x20,0x48,0x41,0x0b,0x77,0x01,0x0b,0xdd,0x10,
-0x1b,0xe3,0x48,0x02,0x0b,0xaa,0x30,0x2e,0x01,0xdf,0x45,0x0c,0x0f,0x97,0x06,0x04,
-0x1e,0x40,0x47,0x3f,0x05,0x8d,0x0c,0x0e,0x06,0x2e,0x07,0x8b,0x37,0x0e,0xde,0x2d,
-0x05,0xae,0x03,0x57,0xfc,0x63,0x10,0x12,0x6a,0xee,0x3f,0x13,0xef,0x26,0x04,0x18,
-0x30,0xe0,0x2e,0x1c,0xf1,0x70,0x41,0x14,0xaf,0x4f,0x01,0x1a,0x09,0x8d,0x34,0x14,
-0x0c,0x79,0x00,0x04,0xb4,0x40,0x0a,0xc5,0x04,0x14,0xfe,0x3b,0x08,0x1b,0xd0,0x95,
-0x04,0x0d,0x53,0x08,0x13,0x8f,0x94,0x04,0x1b,0x1f,0xf3,0x31,0x1e,0x5f,0x55,0x05,
-0x08,0x1d,0x04,0x1f,0x40,0x18,0x00,0x15,0x0f,0x48,0x00,0x05,0x1b,0x7f,0x4d,0x0f,
-0x0a,0x0d,0x05,0x1f,0xfd,0xa7,0x06,0x15,0x05,0x39,0x07,0x0e,0x2a,0x23,0x0e,0xe4,
-0x05,0x06,0x04,0x02,0x0c,0xa7,0x00,0x1c,0x5e,0xfa,0x0d,0x01,0x01,0x00,0x2d,0x24,
-0x8d,0xc2,0x04,0x2e,0x09,0xff,0x6d,0x3a,0x0d,0x18,0x00,0x1e,0xe3,0x83,0x3c,0x0c,
-0xc4,0x33,0x1a,0x09,0xfb,0x41,0x0e,0x18,0x00,0x0b,0x4b,0x3b,0x07,0x18,0x00,0x1e,
-0xa3,0x18,0x00,0x0c,0xa2,0x41,0x0b,0x90,0x00,0x1f,0x90,0x18,0x00,0x04,0x1e,0xfd,
-0xc0,0x00,0x0c,0x82,0x05,0x65,0x06,0xaa,0xaa,0xaa,0xab,0xce,0x31,0x00,0x0b,0xaf,
-0x01,0x2e,0x14,0xbf,0x5b,0x06,0x09,0xf3,0x37,0x1f,0xf4,0x87,0x08,0x04,0x1e,0xfc,
-0x26,0x08,0x0f,0x70,0x02,0x0b,0x1e,0x90,0x0e,0x08,0x0e,0x3e,0x08,0x09,0x57,0x14,
-0x0f,0xb5,0x05,0x03,0x1e,0xf3,0xb7,0x08,0x0e,0xa9,0x00,0x07,0xc6,0x11,0x21,0xf5,
-0x9a,0x60,0x09,0x1c,0xa5,0x26,0x08,0x1d,0xf5,0x2b,0x10,0x03,0x18,0x00,0x1b,0xef,
-0xc0,0x02,0x04,0xd1,0x47,0x0a,0x16,0x48,0x05,0xc0,0x00,0x1b,0xf1,0x6b,0x0a,0x04,
-0x30,0x03,0x19,0xe0,0x75,0x48,0x06,0xac,0x46,0x2a,0xa0,0x1f,0xb4,0x0a,0x14,0x2d,
-0x0f,0x00,0x14,0x0b,0x8b,0x04,0x19,0x10,0xab,0x32,0x06,0x95,0x06,0x45,0xfa,0x62,
-0x00,0x01,0xec,0x15,0x06,0xa7,0x48,0x0d,0x6f,0x44,0x1f,0x3f,0xe2,0x32,0x04,0x1f,
-0x07,0xf8,0x04,0x04,0x0e,0x87,0x44,0x03,0x22,0x08,0x0e,0xf3,0x32,0x03,0xde,0x2c,
-0x1e,0x9f,0x7c,0x33,0x09,0x53,0x46,0x0d,0xc4,0x20,0x1a,0x2b,0x66,0x0c,0x1e,0x20,
-0x98,0x4a,0x09,0x99,0x4a,0x00,0x0b,0x11,0x2e,0xdf,0xff,0xc7,0x17,0x01,0x01,0x04,
-0x7f,0x58,0xac,0xef,0xff,0xfe,0xdc,0xa7,0xf1,0x3e,0x04,0x21,0x2b,0xbb,0x01,0x00,
-0x1f,0x80,0x3f,0x0b,0x05,0x1e,0xfb,0x48,0x24,0x0e,0x02,0x3c,0x0a,0x37,0x0a,0x1e,
-0xfb,0x90,0x4b,0x0f,0x33,0x00,0x05,0x1e,0x4f,0xa5,0x3e,0x0b,0x6c,0x3c,0x1e,0xb0,
-0xc9,0x37,0x0e,0x33,0x00,0x0a,0x1d,0x38,0x1e,0xb0,0x54,0x38,0x0e,0x33,0x00,0x0a,
-0x84,0x37,0x0b,0x33,0x00,0x1e,0x1e,0x3e,0x3f,0x0d,0x31,0x0e,0x1e,0xb0,0x0a,0x09,
-0x0e,0x33,0x00,0x0a,0xe1,0x13,0x1e,0xb0,0xd5,0x0a,0x0e,0x33,0x00,0x0a,0x90,0x02,
-0x1e,0xb0,0x17,0x0a,0x0e,0x33,0x00,0x0a,0xaa,0x02,0x1d,0xb0,0x54,0x1a,0x2e,0xfc,
-0xdf,0x33,0x00,0x02,0xc8,0x04,0x1e,0x3d,0x33,0x00,0x03,0xc6,0x2b,0x0e,0x33,0x00,
-0x12,0x1e,0xa7,0x03,0x1d,0x0d,0x33,0x00,0x13,0x09,0xb8,0x03,0x0d,0x33,0x00,0x13,
-0x03,0x11,0x00,0x0e,0x33,0x00,0x13,0xdf,0x0b,0x07,0x0d,0x33,0x00,0x04,0x36,0x2c,
-0x0d,0x33,0x00,0x14,0x2f,0x67,0x03,0x0c,0x33,0x00,0x14,0x0b,0xe6,0x04,0x0c,0x33,
-0x00,0x15,0x06,0x3c,0x09,0x0b,0x33,0x00,0x24,0x01,0xef,0x86,0x1f,0x0c,0x33,0x00,
-0x15,0xaf,0x2b,0x07,0x0b,0x33,0x00,0x15,0x4f,0xb3,0x04,0x0b,0x33,0x00,0x16,0x0d,
-0x4d,0x16,0x0a,0x33,0x00,0x16,0x08,0x15,0x0a,0x0a,0x33,0x00,0x17,0x02,0x0f,0x06,
-0x0a,0x33,0x00,0x16,0xcf,0x30,0x05,0x0a,0x33,0x00,0x05,0x1f,0x21,0x0c,0x33,0x00,
-0x17,0x1f,0x12,0x06,0x09,0x33,0x00,0x18,0x0b,0xe3,0x05,0x08,0x33,0x00,0x18,0x05,
-0xc5,0x05,0x09,0x33,0x00,0x18,0xef,0x7f,0x30,0x08,0x33,0x00,0x18,0x9f,0x93,0x0d,
-0x08,0x33,0x00,0x0e,0x38,0x05,0x03,0xc6,0x04,0x1f,0x0d,0xfb,0x37,0x05,0x3f,0x75,
-0xff,0xff,0xd5,0x25,0x1b,0x3f,0xff,0xff,0x74,0x33,0x00,0x06,0x1f,0x3f,0x1a,0x00,
-0x05,0x1f,0x72,0x33,0x00,0x06,0x1f,0x1f,0x1a,0x00,0x05,0x1f,0x70,0x33,0x00,0x06,
-0x1f,0x0e,0x33,0x00,0x06,0x1f,0xdf,0x33,0x00,0x05,0x0e,0xca,0x04,0x0e,0x30,0x41,
-0x0e,0xfe,0x01,0x0f,0x33,0x00,0xff,0x3a,0x2d,0x26,0x66,0x01,0x00,0x1d,0x50,0xcf,
-0x4e,0x07,0x4f,0x09,0x1f,0x9f,0x18,0x00,0x04,0x1f,0xbf,0x18,0x00,0x04,0x1f,0xdf,
-0x18,0x00,0x04,0x0f,0xd7,0x13,0x04,0x1f,0x01,0x18,0x00,0x04,0x1f,0x02,0x18,0x00,
-0x04,0x1f,0x04,0x18,0x00,0x04,0x1f,0x06,0x18,0x00,0x04,0x1f,0x08,0x18,0x00,0x04,
-0x0f,0x67,0x14,0x05,0x1e,0x0c,0xfb,0x0b,0x07,0x46,0x01,0x0e,0x59,0x47,0x1e,0x0f,
-0x2d,0x10,0x07,0x7f,0x04,0x1f,0xf4,0x09,0x44,0x04,0x1e,0xf2,0x61,0x13,0x0a,0x94,
-0x4e,0x0b,0x88,0x07,0x1e,0xf0,0x87,0x4c,0x0e,0xf1,0x0a,0x07,0xa7,0x05,0x1e,0xb0,
-0x3d,0x40,0x0e,0x39,0x0b,0x07,0x83,0x07,0x0e,0xdc,0x3f,0x0f,0xf0,0x13,0x04,0x14,
-0x01,0x32,0x0d,0x7b,0x37,0xac,0xef,0xff,0xec,0xa7,0x40,0x09,0x0b,0x2b,0x21,0x8d,
-0x97,0x0c,0x03,0x11,0x09,0x1c,0xaf,0x97,0x0c,0x1e,0x07,0xf2,0x1b,0x0e,0xe8,0x20,
-0x07,0x27,0x0a,0x1e,0x0a,0xae,0x01,0x1c,0xd1,0xf7,0x07,0x08,0x31,0x40,0x1f,0x0e,
-0xd5,0x3d,0x04,0x1f,0x0f,0x9e,0x10,0x04,0x1f,0x2f,0x70,0x3d,0x04,0x04,0x49,0x05,
-0x48,0xd9,0x65,0x45,0x69,0x43,0x1b,0x26,0x29,0xdf,0xe7,0x00,0x36,0x03,0xbf,0xff,
-0x67,0x0c,0x35,0x01,0x59,0xdf,0xc7,0x2e,0x19,0x05,0xff,0x10,0x39,0x01,0x59,0xdd,
-0x08,0x38,0x0e,0xad,0x03,0x05,0xad,0x02,0x0e,0xa6,0x01,0x0f,0x36,0x15,0x0b,0x1f,
-0x70,0xa3,0x4d,0x04,0x1e,0xa0,0x0c,0x04,0x0e,0xf8,0x15,0x07,0x5f,0x01,0x1f,0xe0,
-0x40,0x0d,0x15,0x09,0x7e,0x40,0x0e,0x6d,0x09,0x1f,0xf1,0x30,0x00,0x04,0x1f,0xf1,
-0x60,0x00,0x15,0x04,0xe1,0x16,0x1b,0x0f,0xf4,0x14,0x13,0x0d,0xa8,0x00,0x1b,0x0e,
-0x08,0x0e,0x1a,0x0f,0xf8,0x21,0x1b,0xd0,0x40,0x0d,0x2b,0x80,0x0a,0x62,0x17,0x13,
-0xbf,0xdf,0x02,0x1a,0x06,0xb9,0x0d,0x14,0x03,0xfd,0x22,0x1a,0x02,0x58,0x0d,0x15,
-0x0c,0xb0,0x01,0x19,0xcf,0x39,0x0e,0x05,0x90,0x11,0x0a,0x6d,0x18,0x16,0x2b,0x74,
-0x23,0x14,0x0e,0x4c,0x02,0x47,0x84,0x10,0x02,0x4a,0x40,0x02,0x1f,0x05,0x70,0x02,
-0x01,0x0f,0x57,0x05,0x04,0x1a,0xf5,0x77,0x0b,0x0a,0x2a,0x10,0x1e,0x03,0x00,0x03,
-0x0e,0x2a,0x0b,0x08,0x46,0x32,0x09,0x63,0x47,0x08,0xc6,0x0f,0x1e,0x1b,0x5e,0x00,
-0x09,0x0f,0x11,0x0c,0xd8,0x24,0x36,0x00,0x00,0x7d,0x17,0x00,0x19,0xe7,0x59,0x0d,
-0x24,0x4a,0xef,0xd0,0x13,0x0c,0x56,0x17,0x3e,0x79,0xcd,0xef,0x70,0x0d,0x06,0x5e,
-0x04,0x3e,0x23,0x34,0x41,0x15,0x00,0x2e,0x58,0xbd,0x62,0x05,0x05,0xd5,0x0d,0x0c,
-0x18,0x00,0x1e,0x6c,0xbf,0x15,0x09,0x92,0x48,0x0a,0x18,0x00,0x1e,0x4d,0xd0,0x1f,
-0x0b,0x86,0x04,0x08,0x18,0x00,0x08,0x5d,0x41,0x1e,0xf6,0xaa,0x0d,0x0c,0x18,0x00,
-0x1e,0x05,0x09,0x56,0x0e,0x70,0x48,0x1e,0xf6,0x4d,0x48,0x0b,0x18,0x00,0x16,0x2f,
-0xd8,0x0c,0x2d,0x85,0x31,0x24,0x11,0x00,0x6b,0x51,0x0f,0x87,0x0d,0x03,0x1e,0x81,
-0x4f,0x0e,0x0e,0x74,0x49,0x05,0x47,0x00,0x1e,0xf8,0xef,0x16,0x0e,0x6f,0x18,0x06,
-0x88,0x02,0x0d,0x8f,0x01,0x0b,0xfc,0x43,0x0b,0xba,0x04,0x1f,0xfd,0x81,0x11,0x15,
-0x1f,0x0b,0xb9,0x04,0x04,0x1e,0x1f,0x11,0x12,0x07,0x4c,0x01,0x12,0xfd,0x5b,0x16,
-0x3a,0xee,0xda,0x84,0x07,0x07,0x15,0xf7,0xa4,0x02,0x04,0x4c,0x58,0x13,0xef,0x77,
-0x00,0x1a,0x6e,0x40,0x10,0x13,0x02,0xb1,0x03,0x1b,0x2c,0x81,0x01,0x13,0x06,0x7d,
-0x13,0x0c,0x32,0x27,0x03,0xd0,0x04,0x0d,0x8a,0x16,0x1f,0x0b,0x0e,0x0b,0x02,0x0b,
-0x1f,0x4c,0x07,0x6e,0x45,0x0f,0x98,0x5e,0x02,0x1b,0xfd,0x27,0x48,0x07,0x49,0x00,
-0x0e,0xa7,0x06,0x09,0x36,0x27,0x00,0x13,0x33,0x45,0x20,0x02,0x49,0xef,0x6e,0x0b,
-0x19,0x4f,0x98,0x22,0x15,0x1a,0x61,0x00,0x1a,0x4f,0x4d,0x4c,0x14,0x7f,0xa1,0x16,
-0x1a,0x4f,0x3e,0x1b,0x14,0x08,0xf3,0x00,0x0b,0x80,0x12,0x04,0x35,0x02,0x2b,0xc0,
-0x5f,0x8f,0x0a,0x13,0x4f,0x91,0x00,0x1b,0x5f,0xb0,0x06,0x04,0x08,0x58,0x0c,0x18,
-0x00,0x13,0x07,0x6c,0x01,0x0c,0x30,0x16,0x13,0x04,0xc1,0x00,0x0d,0x48,0x16,0x03,
-0xf9,0x15,0x0b,0xd8,0x24,0x05,0xab,0x24,0x04,0xd6,0x49,0x0b,0xde,0x02,0x2c,0xfa,
-0x1f,0xcd,0x02,0x03,0x2e,0x0b,0x1c,0x0f,0x40,0x07,0x03,0x30,0x00,0x1c,0x0d,0xce,
-0x02,0x12,0xef,0x78,0x00,0x1c,0x0a,0x40,0x07,0x03,0xfb,0x01,0x0c,0x80,0x25,0x04,
-0x00,0x14,0x0c,0x50,0x14,0x05,0xa1,0x16,0x0b,0xc1,0x16,0x14,0x0d,0x40,0x00,0x1a,
-0xbf,0x09,0x17,0x14,0x4f,0x70,0x00,0x1f,0x5f,0x5b,0x47,0x02,0x14,0x70,0x60,0x06,
-0x1a,0xf4,0xb0,0x01,0x17,0x20,0x0a,0x00,0x07,0x72,0x04,0x16,0xfb,0x6f,0x0b,0x18,
-0xf6,0xe7,0x04,0x17,0xf4,0x03,0x02,0x57,0xd7,0x31,0x01,0x38,0xef,0xb9,0x13,0x1f,
-0x0d,0xa6,0x46,0x04,0x0e,0xc7,0x1a,0x03,0xce,0x00,0x1e,0x7f,0xff,0x0b,0x0e,0xda,
-0x09,0x08,0x16,0x41,0x1e,0xaf,0xf3,0x5d,0x0e,0x31,0x00,0x08,0x6f,0x5c,0x0a,0xb0,
-0x4d,0x1e,0xc1,0x5a,0x4e,0x0c,0xa1,0x04,0x07,0x49,0x1a,0x19,0xf8,0xa8,0x06,0x05,
-0xfa,0x24,0x1c,0xc7,0x7a,0x18,0x7f,0x47,0xac,0xef,0xff,0xed,0xb8,0x51,0x39,0x38,
-0x0e,0x0e,0x91,0x03,0x0a,0x53,0x2a,0x0f,0x19,0x00,0xad,0x2f,0xa0,0x2f,0xaa,0x48,
-0x05,0x1f,0x2f,0x52,0x63,0x0b,0x0d,0xa4,0x05,0x2e,0xf5,0x00,0xd6,0x0a,0x0e,0x75,
-0x0a,0x08,0x1d,0x06,0x1e,0x70,0x59,0x55,0x0e,0x27,0x1a,0x0d,0x27,0x4e,0x0f,0x41,
-0x1a,0x01,0x1e,0xf3,0x65,0x27,0x0e,0x01,0x21,0x09,0x3f,0x07,0x1e,0x50,0xea,0x01,
-0x0e,0x8b,0x1a,0x08,0xc1,0x15,0x1e,0xf7,0xc8,0x55,0x0e,0xf4,0x0a,0x09,0x05,0x04,
-0x0e,0x8c,0x0d,0x1e,0x0e,0x12,0x20,0x08,0x42,0x01,0x1f,0xfb,0xf5,0x0f,0x05,0x1f,
-0xf4,0x42,0x01,0x05,0x1e,0xd0,0x42,0x01,0x0e,0xd6,0x07,0x09,0x6a,0x04,0x0f,0x42,
-0x01,0x05,0x1e,0xf8,0x71,0x4e,0x0c,0x8d,0x5d,0x0b,0x42,0x01,0x1e,0xa0,0x38,0x5a,
-0x0e,0x71,0x5a,0x0a,0xdd,0x2a,0x0f,0x85,0x0e,0x04,0x0e,0x5d,0x0f,0x0c,0x0e,0x2e,
-0x0c,0x42,0x01,0x1f,0x80,0x60,0x53,0x05,0x1e,0x10,0x42,0x01,0x0e,0xf0,0x0f,0x08,
-0xc2,0x05,0x1e,0xf3,0x42,0x01,0x0e,0x3a,0x02,0x0a,0x52,0x50,0x0e,0x42,0x01,0x0e,
-0x63,0x5f,0x0a,0xaf,0x61,0x0e,0x16,0x0d,0x0e,0x3a,0x02,0x08,0x42,0x01,0x1e,0x90,
-0x42,0x01,0x0e,0x1f,0x09,0x08,0x63,0x03,0x1e,0xfc,0x42,0x01,0x0e,0x0f,0x50,0x09,
-0x42,0x01,0x1e,0xe0,0x02,0x24,0x0e,0x95,0x03,0x09,0x8c,0x06,0x1e,0x10,0x42,0x01,
-0x0e,0x95,0x03,0x08,0xe4,0x09,0x1e,0xf2,0x42,0x01,0x0e,0xdd,0x12,0x09,0x23,0x06,
-0x1e,0x40,0x42,0x01,0x0e,0x3a,0x02,0x08,0x42,0x01,0x0f,0x97,0x11,0x05,0x0f,0x50,
-0x11,0x06,0x2e,0xff,0x80,0x7b,0x0f,0x0e,0x95,0x03,0x08,0xa0,0x1a,0x1e,0xfb,0x70,
-0x13,0x0e,0x44,0x1c,0x09,0x42,0x01,0x1e,0xd0,0xd9,0x51,0x0e,0x95,0x03,0x08,0x42,
-0x01,0x1e,0xfe,0x42,0x01,0x0e,0xb4,0x0b,0x09,0x8f,0x06,0x0e,0x3a,0x02,0x21,0x48,
-0x88,0x01,0x00,0x0f,0x76,0x5a,0x03,0x11,0x36,0x96,0x21,0x1b,0x96,0x3e,0x02,0x05,
-0xc5,0x0d,0x2f,0xea,0x40,0x95,0x21,0x04,0x1f,0xd6,0xf5,0x62,0x04,0x2e,0xfc,0x30,
-0x5b,0x55,0x09,0xe2,0x00,0x1e,0x8f,0xfc,0x11,0x0e,0x83,0x14,0x05,0x18,0x00,0x1e,
-0x5f,0x63,0x4f,0x0f,0x7b,0x07,0x04,0x04,0x5f,0x6d,0x0e,0x94,0x06,0x0e,0xb0,0x08,
-0x03,0xa3,0x01,0x14,0xbf,0xc1,0x0e,0x46,0x31,0x01,0x37,0xef,0x29,0x12,0x18,0x1f,
-0x82,0x00,0x15,0x9f,0x14,0x33,0x19,0x05,0x6d,0x25,0x15,0x8f,0x66,0x02,0x19,0x9f,
-0x15,0x04,0x14,0xcf,0x02,0x05,0x19,0x0c,0x66,0x03,0x15,0x04,0xae,0x02,0x19,0xef,
-0x6d,0x05,0x05,0x7f,0x65,0x04,0xc6,0x10,0x0a,0xf6,0x02,0x04,0x49,0x06,0x1c,0xf9,
-0x4c,0x11,0x0b,0xe6,0x65,0x05,0x44,0x21,0x0a,0x1d,0x02,0x1b,0x07,0x5e,0x00,0x1c,
-0x90,0x1b,0x28,0x19,0xcf,0x23,0x04,0x05,0x1a,0x28,0x0b,0x9b,0x11,0x14,0xef,0x84,
-0x00,0x19,0x4f,0xcb,0x01,0x06,0xd1,0x0b,0x09,0xe9,0x0d,0x04,0xa8,0x11,0x05,0xae,
-0x00,0x18,0xfa,0xbb,0x00,0x16,0xf8,0xf5,0x00,0x17,0xfa,0xae,0x03,0x17,0xfe,0x51,
-0x00,0x58,0xfe,0x83,0x10,0x13,0x7e,0x85,0x11,0x1e,0x9f,0x31,0x14,0x0e,0xdf,0x62,
-0x07,0x3e,0x01,0x1e,0xbf,0x17,0x00,0x0e,0x64,0x02,0x07,0xf0,0x03,0x19,0x4d,0x82,
-0x0d,0x1e,0x40,0x79,0x59,0x09,0xdc,0x05,0x1a,0x02,0x30,0x1f,0x1b,0xb2,0x07,0x65,
-0x0b,0x6e,0x55,0x0f,0xbd,0x35,0x04,0x1e,0x09,0x42,0x0b,0x0f,0xab,0x6f,0x04,0x17,
-0xf7,0xf9,0x16,0x57,0xfc,0x62,0x10,0x13,0x7c,0xc1,0x02,0x17,0xef,0xb9,0x2b,0x04,
-0xcc,0x2b,0x15,0xe0,0xe8,0x00,0x19,0xc1,0xc4,0x66,0x14,0x80,0x05,0x02,0x1a,0xe1,
-0x96,0x1e,0x2a,0x10,0x06,0x0f,0x06,0x14,0x05,0xd9,0x02,0x1a,0xcf,0x60,0x05,0x04,
-0x3f,0x14,0x0f,0x37,0x24,0x04,0x1b,0x03,0xfa,0x04,0x04,0x44,0x07,0x0c,0x7d,0x07,
-0x03,0xba,0x03,0x1f,0x67,0x5a,0x33,0x04,0x0f,0xb8,0x33,0x0b,0x1b,0xf1,0x60,0x09,
-0x04,0xb8,0x33,0x0c,0xbd,0x35,0x1b,0x86,0x5e,0x07,0x1a,0x07,0x53,0x0e,0x0c,0x0b,
-0x25,0x2f,0x52,0xff,0x2b,0x33,0x02,0x2a,0xf2,0x0e,0x07,0x63,0x14,0x0d,0xab,0x02,
-0x19,0xaf,0xef,0x0a,0x14,0x0a,0x2f,0x0b,0x04,0xa6,0x01,0x0a,0xc9,0x25,0x16,0xf5,
-0x47,0x0d,0x56,0xb6,0x21,0x00,0x26,0xaf,0xf1,0x13,0x1f,0x6f,0x31,0x10,0x04,0x1f,
-0xcf,0x9f,0x18,0x03,0x1f,0x03,0x47,0x10,0x03,0x0f,0xfe,0x18,0x01,0x1e,0xf7,0x4c,
-0x02,0x06,0x46,0x04,0x1e,0x07,0x92,0x02,0x0e,0xae,0x6b,0x07,0x11,0x02,0x1a,0x01,
-0x7f,0x03,0x25,0xb1,0x00,0x01,0x5d,0x0f,0x74,0x21,0x04,0x25,0x01,0x7c,0x4c,0x03,
-0x1a,0x82,0x16,0x0b,0x7d,0x47,0xac,0xdf,0xff,0xff,0xec,0xa8,0x5b,0x0d,0x00,0x14,
-0x33,0x2c,0xed,0xb8,0xff,0x13,0x23,0x17,0xcf,0x5c,0x00,0x09,0x57,0x09,0x07,0x72,
-0x33,0x1e,0xe5,0x86,0x68,0x07,0x81,0x01,0x1e,0x00,0xd9,0x14,0x1e,0x60,0xc9,0x2e,
-0x09,0x18,0x05,0x1e,0x2e,0x9c,0x06,0x0e,0x80,0x15,0x05,0xfd,0x02,0x1e,0x0c,0x2e,
-0x28,0x0e,0xdb,0x03,0x05,0x41,0x02,0x1f,0x03,0x35,0x23,0x04,0x04,0xee,0x01,0x46,
-0xc6,0x20,0x13,0x7d,0xa9,0x2e,0x05,0xa6,0x11,0x17,0x60,0xb2,0x01,0x16,0xb0,0xe2,
-0x06,0x18,0x40,0x5d,0x21,0x15,0x30,0x5d,0x00,0x18,0x60,0x0c,0x01,0x15,0xf9,0x9d,
-0x03,0x19,0xb0,0xe0,0x05,0x14,0xe0,0x92,0x02,0x1b,0xf2,0xbe,0x0a,0x0c,0xbd,0x2e,
-0x13,0xcf,0x47,0x00,0x0b,0x01,0x2e,0x04,0x82,0x0b,0x0c,0xd9,0x17,0x13,0x2f,0x89,
-0x07,0x0c,0xf4,0x0a,0x03,0x4f,0x02,0x0c,0xbf,0x1c,0x13,0x0c,0x4c,0x01,0x0c,0x86,
-0x0b,0x12,0xaf,0x10,0x00,0x0c,0xe7,0x17,0x13,0x09,0x80,0x04,0x0c,0xff,0x08,0x12,
-0x8f,0x6e,0x00,0x0c,0x2f,0x00,0x04,0xfb,0x06,0x0a,0xee,0x36,0x05,0x2a,0x07,0x0c,
-0x2d,0x18,0x04,0x2f,0x00,0x03,0x3b,0x06,0x0c,0x2f,0x00,0x1f,0x19,0xcc,0x11,0x03,
-0x2b,0xf1,0x6f,0x76,0x00,0x03,0x2f,0x00,0x1a,0x13,0xf0,0x58,0x05,0x5c,0x37,0x1b,
-0x0f,0x38,0x67,0x04,0xf3,0x19,0x19,0xbf,0x71,0x0c,0x14,0x02,0x11,0x42,0x19,0x05,
-0x85,0x27,0x05,0xbd,0x17,0x28,0x00,0x0f,0x00,0x03,0x16,0x06,0x0a,0x14,0x17,0x8f,
-0x27,0x06,0x06,0xa0,0x17,0x0f,0xcc,0x58,0x04,0x1f,0xe0,0x79,0x75,0x03,0x1e,0xfc,
-0x58,0x1b,0x04,0xb7,0x01,0x0e,0xce,0x31,0x02,0x53,0x04,0x1f,0x4f,0xc7,0x04,0x03,
-0x09,0x18,0x00,0x17,0xfd,0xae,0x0e,0x17,0x3e,0x6e,0x00,0x17,0x1d,0x29,0x01,0x17,
-0x1a,0x92,0x04,0x08,0x8a,0x0c,0x05,0x64,0x1b,0x39,0xa2,0x00,0x2f,0xa1,0x02,0x21,
-0x27,0xcf,0x75,0x4b,0x3b,0x20,0x00,0x06,0xa0,0x0c,0x55,0x02,0x46,0x66,0x53,0x10,
-0x09,0x08,0x1e,0xf2,0x09,0x0c,0x0e,0x5b,0x0b,0x06,0xa2,0x08,0x1e,0x80,0xcc,0x0f,
-0x0e,0x46,0x00,0x05,0x96,0x08,0x1f,0xfc,0x2e,0x31,0x14,0x1f,0x3f,0x01,0x0c,0x03,
-0x1e,0x5f,0xad,0x0c,0x07,0xf2,0x08,0x1b,0xfc,0xb9,0x0d,0x1f,0xef,0xe1,0x30,0x01,
-0x2d,0x15,0xaf,0xde,0x29,0x5b,0x57,0x77,0x88,0xab,0xef,0xef,0x5a,0x0d,0xb1,0x04,
-0x1e,0xe2,0x5d,0x5e,0x0a,0xbc,0x0c,0x1e,0x0c,0xde,0x60,0x0d,0x2f,0x00,0x1e,0xf4,
-0x86,0x25,0x0c,0xb9,0x2f,0x1e,0xcf,0x3c,0x06,0x0a,0x2f,0x00,0x0a,0x1d,0x70,0x15,
-0xcf,0x57,0x1a,0x0f,0xfb,0x2f,0x02,0x1b,0xfd,0x85,0x0e,0x03,0xc2,0x0a,0x1e,0x82,
-0xaa,0x0f,0x1c,0xee,0xd6,0x0c,0x00,0x3d,0x45,0x24,0xc7,0x10,0xd5,0x1a,0x16,0x50,
-0x77,0x54,0x04,0xb9,0x04,0x14,0x09,0x97,0x05,0x04,0x81,0x03,0x1b,0x1f,0xb4,0x45,
-0x24,0xf2,0x0f,0xd9,0x03,0x13,0xdf,0xcf,0x01,0x14,0x07,0x71,0x07,0x14,0x0d,0x2e,
-0x09,0x14,0x1d,0x50,0x2b,0x10,0x09,0x1f,0x03,0x26,0x10,0x00,0x2b,0x46,0x0f,0x01,
-0x00,0xb2,0x07,0xf7,0x46,0x24,0xf8,0x00,0xee,0x00,0x15,0x10,0xf7,0x46,0x14,0x06,
-0x10,0x01,0x13,0xcf,0x21,0x01,0x1c,0x0f,0x43,0x01,0x14,0x1f,0x43,0x01,0x04,0x65,
-0x01,0x1b,0x0a,0xf7,0x46,0x13,0x30,0x98,0x01,0x13,0x70,0x1e,0x03,0x17,0x60,0xba,
-0x01,0x00,0xb1,0x0e,0x22,0x87,0x51,0xe5,0x06,0x13,0xef,0xe3,0x2a,0x14,0x0b,0x68,
-0x5b,0x14,0x09,0x2c,0x16,0x15,0x03,0x5f,0x07,0x14,0x9f,0x1b,0x05,0x2a,0x0d,0xff,
-0xff,0x3c,0x25,0xff,0xf5,0x9f,0x1d,0x16,0x50,0x7f,0x05,0x15,0x07,0x9c,0x09,0x15,
-0x0e,0x50,0x07,0x15,0x3f,0xd2,0x12,0x16,0x3e,0x00,0x5e,0x5f,0xbe,0xff,0xd9,0x20,
-0x00,0x01,0x00,0xe7,0x11,0x38,0x51,0x10,0x05,0x7d,0x06,0x15,0xf0,0xee,0x0f,0x0f,
-0x13,0x00,0x3c,0x06,0x4f,0x64,0x04,0x9d,0x4a,0x07,0x75,0x5a,0x05,0x8c,0x5a,0x05,
-0xa3,0x5a,0x15,0x03,0x35,0x06,0x14,0x8f,0x9c,0x06,0x1a,0x0d,0x1c,0x00,0x18,0xc0,
-0xc4,0x5c,0x14,0x2f,0xe0,0x0c,0x14,0x0a,0x53,0x09,0x15,0x02,0xec,0x01,0x14,0xbf,
-0x2a,0x0d,0x15,0x2f,0x0b,0x0b,0x15,0x19,0x52,0x0c,0x25,0x01,0x9f,0x91,0x0f,0x25,
-0x2a,0xf9,0x74,0x06,0x0f,0x42,0x01,0x1a,0x2e,0x01,0x7c,0x14,0x00,0x1e,0x29,0x7a,
-0x13,0x2d,0x05,0xbf,0xa7,0x06,0x2e,0x01,0x7e,0xa3,0x13,0x1e,0x39,0xd0,0x06,0x2d,
-0x05,0xcf,0xcc,0x13,0x2e,0x01,0x7e,0x54,0x12,0x1e,0x3a,0x35,0x74,0x29,0x05,0xcf,
-0x95,0x20,0x08,0x3a,0x00,0x08,0x29,0x00,0x1c,0x3a,0xbe,0x20,0x08,0x3a,0x00,0x05,
-0x29,0x00,0x2e,0x01,0x8e,0xe7,0x20,0x1b,0x3a,0x06,0x0b,0x1c,0x40,0x3a,0x00,0x3d,
-0xff,0xfc,0x61,0x3a,0x00,0x2d,0xfd,0x72,0x3a,0x00,0x2e,0xfe,0x93,0x67,0x12,0x1e,
-0xa4,0xe3,0x0c,0x1e,0xb6,0x61,0x65,0x2d,0xd7,0x10,0x21,0x2c,0x2d,0xe8,0x30,0x3e,
-0x37,0x2d,0xfa,0x40,0x34,0x15,0x0a,0x44,0x69,0x03,0x29,0x00,0x03,0x8b,0x3e,0x0b,
-0x52,0x00,0x2e,0xf9,0x40,0xdc,0x65,0x08,0x67,0x00,0x08,0xa4,0x00,0x2d,0xd7,0x20,
-0x05,0x66,0x00,0x12,0x0c,0x1a,0x10,0xff,0x08,0x02,0x01,0x00,0x14,0xb5,0x2d,0x02,
-0x0e,0xf8,0x00,0x0a,0xe4,0x61,0x04,0x21,0x01,0x3a,0x00,0x04,0xbf,0x4a,0x01,0x1e,
-0x82,0x41,0x00,0x0e,0x25,0x62,0x08,0xec,0x01,0x2e,0x04,0xbf,0xec,0x01,0x06,0x65,
-0x40,0x0a,0x3e,0x02,0x1e,0x6d,0x29,0x00,0x08,0x41,0x00,0x18,0xe0,0xc6,0x21,0x04,
-0x1d,0x78,0x0e,0xab,0x3c,0x0c,0xe2,0x02,0x2e,0x03,0xaf,0xb2,0x09,0x03,0x47,0x73,
-0x0d,0x34,0x03,0x1e,0x6c,0x36,0x15,0x01,0x41,0x00,0x2e,0xe0,0x00,0x88,0x73,0x1f,
-0xee,0x9c,0x03,0x01,0x2f,0x40,0xaf,0x01,0x0b,0x01,0x05,0xc2,0x23,0x09,0x16,0x09,
-0x0f,0x2b,0x00,0xae,0x3e,0x41,0x22,0x22,0x01,0x00,0x0f,0xdc,0x06,0x9a,0x1f,0x12,
-0xc2,0x00,0x01,0x1f,0x0a,0xae,0x01,0xc3,0x0f,0x2b,0x00,0x03,0x2f,0x5a,0x30,0x56,
-0x6e,0x01,0x0f,0xf0,0x6d,0x01,0x1a,0x6f,0x28,0x7b,0x06,0xa9,0x17,0x1f,0xa4,0x35,
-0x1b,0x02,0x1e,0xd6,0x4a,0x1b,0x0a,0x90,0x39,0x08,0x61,0x20,0x1f,0x40,0x43,0x32,
-0x01,0x2f,0xfd,0x71,0x58,0x32,0x02,0x1f,0x93,0x12,0x25,0x02,0x1e,0xc5,0x27,0x25,
-0x08,0x66,0x6e,0x19,0x6f,0x36,0x06,0x1e,0x30,0x66,0x18,0x02,0x49,0x5a,0x08,0x7d,
-0x45,0x09,0xc3,0x7e,0x2a,0x02,0x7d,0x38,0x01,0x13,0xb4,0xcd,0x08,0x0a,0xf8,0x12,
-0x03,0x1c,0x06,0x19,0x04,0x0b,0x45,0x05,0xf4,0x00,0x1e,0x4a,0xa9,0x25,0x0a,0x54,
-0x45,0x07,0x76,0x14,0x2e,0x01,0x6c,0xfd,0x2e,0x09,0x8f,0x45,0x1e,0xf7,0x70,0x7f,
-0x0c,0x13,0x1c,0x1e,0x3b,0x15,0x00,0x05,0x18,0x13,0x08,0x15,0x00,0x1e,0x6b,0x54,
-0x00,0x2e,0x05,0xaf,0x7e,0x00,0x2d,0x39,0xef,0x93,0x00,0x2e,0x02,0x8e,0xa5,0x2f,
-0x2e,0x17,0xdf,0xe3,0x16,0x1a,0x6b,0x3d,0x01,0x1a,0x92,0x62,0x00,0x05,0x7d,0x01,
-0x2d,0x39,0xef,0xdd,0x07,0x0c,0x1f,0x42,0x2e,0xe8,0x10,0xb9,0x01,0x2e,0xc5,0x00,
-0xce,0x01,0x1e,0xa3,0xf8,0x01,0x2e,0xfe,0x71,0x22,0x02,0x2e,0xfc,0x50,0x37,0x02,
-0x08,0xa3,0x02,0x1e,0x6f,0x89,0x47,0x05,0x15,0x00,0x1e,0xb4,0xca,0x02,0x2e,0xfe,
-0x82,0xf4,0x02,0x2e,0xfd,0x60,0x09,0x03,0x2e,0xfa,0x40,0x33,0x03,0x2e,0xe8,0x10,
-0x5d,0x03,0x2e,0xc5,0x00,0x01,0x00,0x1f,0x33,0xd2,0x04,0x0b,0x2e,0x11,0x10,0x7f,
-0x76,0x00,0x57,0x01,0x3e,0xec,0x95,0x10,0x62,0x48,0x0a,0xda,0x00,0x08,0xe3,0x18,
-0x1e,0x91,0xe6,0x43,0x06,0x35,0x15,0x1e,0x08,0x1b,0x16,0x0e,0x6a,0x2d,0x08,0xa2,
-0x19,0x0a,0x2c,0x00,0x1e,0x06,0xaa,0x2a,0x0e,0xd0,0x2f,0x02,0x9e,0x07,0x1f,0xaf,
-0xcd,0x26,0x14,0x15,0xfe,0x6a,0x00,0x26,0xfe,0x73,0x01,0x1a,0x27,0xf4,0x00,0xd0,
-0x6d,0x05,0xa1,0x00,0x28,0x90,0x3f,0xb7,0x00,0x13,0x0b,0x80,0x02,0x19,0x06,0x13,
-0x1e,0x13,0x2f,0xfc,0x0d,0x19,0x9f,0xfc,0x15,0x03,0xaa,0x03,0x19,0x2b,0xbc,0x14,
-0x13,0x07,0x6c,0x00,0x19,0xdf,0xf3,0x18,0x03,0x9c,0x11,0x19,0x4d,0x46,0x11,0x04,
-0xde,0x25,0x20,0x01,0x11,0x01,0x00,0x1f,0x10,0xf4,0x3c,0x09,0x1e,0x06,0x47,0x20,
-0x0c,0x9f,0x6d,0x0b,0x7a,0x1f,0x1f,0xd0,0x40,0x00,0x01,0x1e,0xf8,0x4d,0x38,0x0d,
-0x94,0x1e,0x1e,0xbf,0x3e,0x1f,0x05,0x6a,0x00,0x1e,0xf3,0xec,0x1e,0x0c,0xf5,0x20,
-0x1e,0x8f,0xf0,0x7b,0x06,0x76,0x1b,0x1f,0x30,0x8a,0x42,0x0e,0x1e,0xaf,0x87,0x42,
-0x06,0x15,0x00,0x1f,0x90,0x99,0x42,0x0e,0x1f,0x3f,0x15,0x00,0x01,0x1e,0x0d,0x54,
-0x00,0x0b,0x5d,0x4c,0x0c,0xa6,0x1f,0x1e,0x70,0x59,0x13,0x0c,0x2f,0x21,0x0d,0xc3,
-0x27,0x0b,0x4a,0x72,0x0d,0x4e,0x1f,0x1e,0xf9,0x5b,0x23,0x0e,0x6b,0x21,0x1e,0x7f,
-0xda,0x13,0x04,0x60,0x03,0x1e,0xfa,0xcd,0x20,0x0e,0x48,0x21,0x1e,0x0a,0x03,0x14,
-0x0c,0x59,0x6c,0x19,0x00,0x9f,0x83,0x1f,0x51,0x85,0x09,0x7f,0x2e,0x35,0x65,0x84,
-0x08,0x00,0xa2,0x11,0x1f,0xe6,0xbf,0x20,0x02,0x1e,0xfb,0xd4,0x20,0x0e,0x2d,0x01,
-0x1e,0x05,0x4c,0x21,0x0f,0xea,0x02,0x05,0x1e,0x0f,0x3c,0x31,0x06,0x8e,0x04,0x1f,
-0xf0,0x2b,0x00,0x0f,0x04,0x43,0x02,0x0a,0x23,0x0c,0x0a,0xd7,0x85,0x0c,0xe6,0x18,
-0x0f,0x1a,0x09,0x01,0x0e,0x27,0x06,0x0e,0xdb,0x21,0x01,0xee,0x90,0x0d,0x74,0x28,
-0x08,0x25,0x1b,0x8f,0x9b,0xde,0xff,0xff,0xee,0xcb,0x97,0x41,0x71,0x01,0x0a,0x16,
-0x5a,0xa3,0x07,0x2e,0xea,0x61,0x26,0x00,0x0d,0x79,0x0d,0x0e,0x93,0x2f,0x0e,0x59,
-0x16,0x0e,0x74,0x09,0x0f,0x27,0x00,0x0c,0x0e,0x6e,0x7c,0x0d,0x0c,0x55,0x0e,0xac,
-0x1b,0x05,0xe9,0x00,0x0e,0xef,0x30,0x01,0x04,0x73,0x0c,0x28,0x00,0x15,0x4e,0x1b,
-0x00,0x4e,0xec,0xbb,0xbb,0xcd,0xe5,0x1b,0x0b,0x40,0x33,0x13,0xfd,0xf6,0x15,0x2f,
-0x25,0x9d,0xfd,0x45,0x03,0x1d,0xaf,0xf0,0x0f,0x04,0x50,0x09,0x1e,0x50,0x70,0x16,
-0x0a,0x02,0x0b,0x03,0xef,0x82,0x1e,0xf5,0x80,0x16,0x1e,0xe6,0xf5,0x40,0x0a,0x0f,
-0x06,0x17,0x0b,0x93,0x3f,0x0d,0xe3,0x05,0x1c,0xe2,0x75,0x05,0x1e,0x70,0x6e,0x75,
-0x0a,0x0f,0x18,0x1e,0x07,0x25,0x79,0x08,0xd7,0x42,0x19,0x70,0x5b,0x05,0x0d,0xad,
-0x87,0x05,0xec,0x44,0x19,0xf2,0x55,0x06,0x0e,0x03,0x76,0x04,0x1b,0x00,0x18,0xfb,
-0x12,0x03,0x0e,0x4f,0x00,0x06,0x03,0x07,0x17,0x40,0x0c,0x00,0x1f,0xf3,0x66,0x7e,
-0x08,0x03,0x82,0x05,0x0a,0xad,0x00,0x0e,0x5c,0x26,0x03,0xbc,0x01,0x0c,0xc6,0x58,
-0x68,0x48,0xcd,0xff,0xed,0xc9,0x63,0xea,0x05,0x16,0xfa,0x46,0x07,0x15,0xf1,0x85,
-0x01,0x1a,0x8e,0x1e,0x09,0x05,0x0b,0x7d,0x04,0xf5,0x64,0x0c,0x33,0x09,0x03,0xcc,
-0x02,0x06,0x3f,0x80,0x18,0xef,0x74,0x10,0x1d,0x3e,0xcc,0x02,0x04,0x1d,0x7d,0x18,
-0x06,0x15,0x02,0x1e,0x06,0xcc,0x02,0x13,0x8f,0x96,0x00,0x18,0x0d,0x27,0x06,0x1e,
-0x8f,0x7e,0x09,0x13,0x3f,0x06,0x06,0x17,0x3f,0x36,0x04,0x1e,0x07,0x6e,0x03,0x05,
-0xcd,0x8c,0x17,0x9f,0xc8,0x04,0x1e,0x5f,0x6b,0x3b,0x05,0x7e,0x93,0x07,0x4c,0x83,
-0x13,0x02,0x32,0x04,0x36,0x75,0x56,0x9d,0xb5,0x00,0x17,0x06,0xd3,0x81,0x18,0xf2,
-0xfe,0x02,0x14,0xe6,0xb7,0x1e,0x16,0xf4,0x3d,0x00,0x37,0x40,0x00,0x09,0xc7,0x00,
-0x15,0x6f,0xa6,0x37,0x08,0x3e,0x00,0x07,0xab,0x3e,0x17,0x80,0x60,0x02,0x15,0xc0,
-0x5e,0x01,0x16,0xf1,0xe2,0x01,0x36,0x90,0x00,0x2f,0x39,0x02,0x1b,0x08,0xeb,0x74,
-0x16,0xf0,0xf4,0x05,0x12,0xb0,0x6c,0x00,0x07,0xc1,0x1b,0x16,0xf6,0x33,0x00,0x16,
-0xe0,0x3d,0x03,0x36,0xc0,0x00,0x9f,0x2d,0x02,0x16,0x7f,0xab,0x00,0x17,0x0a,0xb6,
-0x00,0x11,0x7f,0x0b,0x00,0x16,0xdf,0x04,0x0d,0x07,0x94,0x66,0x17,0x0b,0x5e,0x06,
-0x11,0x7f,0x83,0x00,0x06,0x01,0x01,0x02,0xfc,0x09,0x07,0xa0,0x08,0x16,0xa0,0x06,
-0x01,0x26,0xf0,0x02,0xd9,0x00,0x08,0xfa,0x6e,0x17,0x0e,0x86,0x08,0x15,0x5f,0xd5,
-0x1d,0x16,0xe0,0x1c,0x00,0x17,0xf5,0x98,0x06,0x17,0x70,0x28,0x00,0x16,0x07,0x28,
-0x03,0x17,0x3f,0x0c,0x01,0x1b,0x1f,0x81,0x25,0x26,0xf0,0x09,0x89,0x00,0x17,0x7f,
-0x5b,0x03,0x07,0x56,0x01,0x02,0xa0,0x00,0x1b,0x0a,0x38,0x25,0x17,0x90,0xab,0x03,
-0x17,0x30,0x28,0x00,0x16,0x0c,0x89,0x00,0x1c,0xef,0xed,0x25,0x16,0x20,0x18,0x01,
-0x02,0xf0,0x40,0x16,0x60,0x69,0x07,0x08,0x90,0x0f,0x07,0xe4,0x02,0x25,0xd0,0x0e,
-0x89,0x00,0x18,0x03,0x14,0x1f,0x01,0x00,0x03,0x07,0x93,0x05,0x16,0xc0,0x28,0x00,
-0x18,0x06,0xa1,0x07,0x05,0x21,0x62,0x03,0xb8,0x00,0x12,0x90,0x1b,0x76,0x05,0xfb,
-0x01,0x08,0x1c,0x00,0x17,0xfc,0x3a,0x04,0x16,0x70,0x28,0x00,0x18,0x09,0x28,0x00,
-0x17,0xcf,0x4b,0x04,0x01,0xf5,0x05,0x1a,0x0f,0x7c,0x77,0x17,0xfc,0x12,0x08,0x17,
-0xf9,0x30,0x2e,0x16,0x20,0x28,0x00,0x18,0x0b,0x28,0x00,0x07,0x39,0x04,0x02,0x6a,
-0x96,0x1a,0x0e,0xea,0x77,0x04,0x78,0x00,0x07,0xe3,0x09,0x11,0x0c,0x83,0x00,0x15,
-0x0e,0x73,0x06,0x17,0x0a,0x28,0x00,0x08,0xb4,0x69,0x11,0x1f,0x33,0x00,0x1b,0x0d,
-0x58,0x78,0x07,0x34,0x0a,0x16,0xf4,0x73,0x01,0x12,0xf2,0x6e,0x00,0x16,0x70,0x0a,
-0x07,0x16,0x30,0x07,0x02,0x18,0xf2,0xb0,0x04,0x06,0x08,0x02,0x17,0x06,0x6c,0x06,
-0x16,0xaf,0x28,0x00,0x03,0x14,0x82,0x15,0x08,0x09,0x03,0x16,0x03,0xe0,0x0a,0x08,
-0x56,0x7e,0x12,0x0e,0x5f,0x04,0x16,0x06,0xd0,0x02,0x06,0xc8,0x0a,0x17,0x2e,0x87,
-0x04,0x13,0x9f,0x6a,0x56,0x06,0x20,0x03,0x05,0x4f,0x42,0x17,0x03,0x39,0x28,0x13,
-0x07,0x48,0x00,0x16,0x01,0xda,0x00,0x12,0x5f,0x1d,0x05,0x37,0x30,0x03,0x9f,0x56,
-0x20,0x14,0x8f,0x10,0x01,0x19,0xef,0x11,0x05,0x0a,0xb8,0x0e,0x35,0x31,0x02,0x6d,
-0x34,0x06,0x15,0xbf,0x5e,0x01,0x0e,0x6a,0x96,0x08,0x1f,0x39,0x16,0x7f,0xe2,0x02,
-0x07,0xff,0x10,0x1d,0x98,0xa3,0x79,0x07,0x9f,0x05,0x17,0x3f,0x37,0x21,0x1c,0xef,
-0x3a,0x25,0x16,0x0e,0x72,0x04,0x17,0x06,0x8c,0x1f,0x1c,0x3f,0xe2,0x84,0x17,0x09,
-0xcb,0x01,0x16,0x7f,0x8e,0x17,0x1c,0x04,0x2a,0x81,0x17,0x04,0x56,0x04,0x26,0x04,
-0xef,0xcc,0x53,0x04,0x69,0x26,0x1e,0xe6,0x5e,0x63,0x03,0xb3,0x09,0x03,0x34,0x1f,
-0x18,0x5c,0x40,0x18,0x0b,0x2f,0x04,0x64,0x00,0x02,0x68,0x98,0x75,0x20,0xcd,0x49,
-0x4b,0x78,0x98,0x75,0x30,0x2f,0x21,0x0e,0x4f,0x2d,0x0e,0x79,0x2d,0x0e,0xc2,0x30,
-0x0f,0xe5,0x86,0x07,0x0f,0xe6,0x86,0x09,0x0e,0x25,0x75,0x0e,0x01,0x00,0x0e,0x3e,
-0x0f,0x0e,0xdb,0x5f,0x0e,0x54,0x2d,0x0f,0x51,0x00,0x14,0x02,0x70,0x02,0x0e,0x54,
-0x6c,0x0f,0x10,0x30,0x04,0x1f,0x70,0xf2,0x00,0x0e,0x03,0xe8,0x02,0x0b,0xce,0x0d,
-0x0e,0x33,0x0d,0x13,0x2e,0xc4,0x0a,0x18,0x61,0x76,0x0a,0x2e,0x9f,0xd0,0xcf,0x18,
-0x05,0x65,0x3b,0x14,0x30,0xc0,0x01,0x2e,0x6a,0xef,0xfb,0x2d,0x08,0xb4,0x23,0x7e,
-0xca,0x86,0x55,0x44,0x56,0x68,0xbd,0x8f,0x33,0x0e,0x8d,0x0b,0x0f,0x4e,0x80,0x12,
-0x0f,0x18,0x83,0x05,0x0f,0x16,0x2e,0x02,0x0b,0x10,0x25,0x09,0x01,0x00,0x1f,0x5d,
-0x76,0x4f,0x04,0x0d,0x01,0x00,0x1c,0x5c,0x27,0x00,0x1e,0xd5,0x6f,0x01,0x0d,0xe6,
-0x14,0x0d,0xe5,0x13,0x09,0x47,0x01,0x16,0x7c,0x26,0x00,0x1f,0xe9,0x56,0x0f,0x0a,
-0x50,0x02,0x57,0xab,0xde,0xff,0xbf,0x50,0x1f,0x41,0x26,0x00,0x0a,0x0e,0x6a,0x2f,
-0x0e,0x7d,0x0c,0x0f,0x24,0x03,0x09,0x0b,0x21,0x26,0x0e,0x3f,0x8a,0x0e,0xe3,0x91,
-0x0e,0xd4,0x49,0x0f,0xc7,0x89,0x09,0x1d,0x2f,0xda,0x5c,0x0e,0xfb,0x3b,0x0e,0x26,
-0x31,0x0e,0x7a,0x3c,0x0e,0xc5,0x8a,0x0c,0xa5,0x49,0x0e,0x67,0x03,0x0b,0xf9,0x2c,
-0x0f,0xc8,0x8a,0x04,0x0e,0xbe,0x8e,0x0e,0x0e,0x87,0x0e,0x77,0x02,0x0e,0x0c,0x54,
-0x0f,0x82,0x0c,0x05,0x1f,0x01,0xa2,0x83,0x08,0x0d,0x84,0x1d,0x0f,0x46,0x8b,0x05,
-0x0f,0x53,0x83,0x09,0x1e,0x03,0x0f,0x88,0x0e,0xf6,0x4b,0x0e,0x13,0x03,0x0d,0x0d,
-0x14,0x0e,0x5c,0x36,0x0a,0x19,0x11,0x1e,0xb3,0x53,0x32,0x09,0x66,0x02,0x2e,0xf5,
-0x0d,0x19,0x34,0x09,0x09,0x33,0x2e,0x10,0x8f,0xe6,0x03,0x08,0x66,0x02,0x2e,0xb0,
+0x51,0x05,0x17,0xf7,0x82,0x01,0x58,0xff,0xe6,0x00,0x00,0x4c,0x18,0x02,0x39,0x01,
+0x9f,0xfd,0xd5,0x06,0x2b,0xff,0xdd,0x77,0x02,0x2e,0x2a,0x30,0xbd,0x04,0x08,0x17,
+0x02,0x05,0x01,0x00,0x17,0x3f,0x1f,0x00,0x2e,0xe2,0x00,0x01,0x00,0x16,0x6f,0x1f,
+0x00,0x1e,0xf3,0x79,0x03,0x02,0x33,0x01,0x06,0xbe,0x04,0x0e,0x01,0x00,0x05,0xfd,
+0x04,0x1f,0xc2,0xb9,0x03,0x03,0x12,0x05,0xf7,0x02,0x2f,0xfc,0x50,0xda,0x03,0x05,
+0xb0,0x26,0xad,0xef,0xfe,0xca,0x62,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x01,0x00,
+0x8f,0x26,0x9c,0xde,0xff,0xec,0xa7,0x30,0x00,0x01,0x00,0x01,0x31,0x06,0xdf,0xff,
+0x01,0x00,0x3e,0xe8,0x10,0x00,0x01,0x00,0x24,0x6e,0xff,0x01,0x00,0x1d,0x70,0x1c,
+0x00,0x35,0x02,0xcf,0xff,0x01,0x00,0x1c,0xc2,0x1d,0x00,0x36,0x03,0xef,0xff,0x01,
+0x00,0x1c,0xe3,0x1d,0x00,0x18,0xff,0x01,0x00,0x1a,0xf3,0x1d,0x00,0x29,0x01,0xef,
+0x1e,0x00,0x1a,0xe1,0x1e,0x00,0x29,0xbf,0xff,0x01,0x00,0x19,0xb0,0x1d,0x00,0x2a,
+0x6f,0xff,0x01,0x00,0x18,0x50,0x1d,0x00,0x1b,0x0e,0x1d,0x00,0x18,0xfd,0x1d,0x00,
+0x2b,0x05,0xff,0x01,0x00,0x2e,0xf4,0x00,0x75,0x00,0x42,0xd6,0x10,0x13,0x9f,0x0a,
+0x00,0x17,0x90,0x1d,0x00,0x12,0x1f,0x13,0x00,0x5d,0x80,0x00,0x00,0x00,0x3e,0x59,
+0x00,0x12,0x04,0x1d,0x00,0x10,0xa0,0x0c,0x00,0x11,0x3f,0x0b,0x00,0x17,0xf0,0x1e,
+0x00,0x11,0x8f,0x12,0x00,0x11,0xf1,0x0c,0x00,0x02,0x5a,0x00,0x16,0x20,0x1d,0x00,
+0x11,0x0a,0x11,0x00,0x17,0xfa,0x47,0x00,0x1d,0xf3,0x93,0x00,0x17,0x70,0x82,0x00,
+0x07,0xde,0x01,0x11,0x0c,0x11,0x00,0x12,0xf5,0x4f,0x01,0x01,0x0c,0x00,0x17,0xf2,
+0x3b,0x00,0x17,0xcf,0x1c,0x01,0x02,0x94,0x00,0x07,0x1d,0x00,0x11,0x0b,0x11,0x00,
+0x11,0xf8,0x0c,0x00,0x11,0x07,0x0c,0x00,0x17,0xd0,0x1e,0x00,0x11,0xaf,0x12,0x00,
+0x11,0xc0,0x0c,0x00,0x01,0x37,0x02,0x17,0xf9,0x1d,0x00,0x26,0x07,0xff,0xc3,0x00,
+0x11,0x7f,0x0b,0x00,0x17,0x40,0x1e,0x00,0x25,0x4f,0xff,0x30,0x00,0x1d,0x5f,0x58,
+0x00,0x25,0x00,0xff,0xa6,0x00,0x02,0x3a,0x00,0x18,0xf6,0x1d,0x00,0x14,0x0a,0xec,
+0x01,0x12,0x01,0xf6,0x00,0x19,0xfc,0xf5,0x01,0x13,0x3f,0xec,0x01,0x3c,0x05,0xef,
+0xff,0x08,0x01,0x06,0xbb,0x01,0x13,0x3a,0xd7,0x01,0x1f,0x60,0x88,0x02,0x08,0x09,
+0xd6,0x01,0x06,0x77,0x00,0x0e,0x1d,0x00,0x08,0xf7,0x01,0x06,0xfd,0x01,0x09,0x01,
+0x00,0x1e,0x7f,0x86,0x02,0x0d,0x82,0x01,0x01,0x2c,0x02,0x1e,0x20,0x57,0x03,0x05,
+0x1d,0x00,0x2e,0xf9,0x00,0x01,0x00,0x14,0x08,0x1d,0x00,0x1f,0xf5,0x1d,0x00,0x09,
+0x2e,0xe2,0x00,0x01,0x00,0x1f,0x1b,0xcb,0x03,0x08,0x2c,0x00,0x3e,0xaf,0x00,0x20,
+0x07,0xaa,0x01,0x00,0x26,0x80,0x00,0xb0,0x01,0x08,0x5e,0x01,0x16,0xcf,0x87,0x01,
+0x08,0x74,0x03,0x11,0xfe,0x43,0x04,0x16,0x0d,0x9a,0x03,0x1e,0x6f,0x71,0x03,0x01,
+0xa6,0x01,0x1c,0xfb,0x57,0x00,0x03,0x13,0x00,0x15,0x0f,0x6b,0x01,0x13,0x3f,0x52,
+0x00,0x16,0xef,0x0b,0x01,0x15,0x03,0x9b,0x02,0x22,0x0d,0xff,0x08,0x02,0x13,0x13,
+0x3c,0x00,0x15,0xf6,0x6b,0x00,0x15,0x60,0x05,0x01,0x36,0xfd,0x10,0x05,0xcb,0x03,
+0x14,0x0a,0x09,0x00,0x15,0x01,0xa9,0x00,0x25,0x07,0xff,0x74,0x02,0x14,0xef,0xb8,
+0x02,0x15,0x7f,0x25,0x02,0x15,0x09,0x7e,0x04,0x14,0x4f,0xb6,0x03,0x03,0x75,0x00,
+0x14,0xd0,0x25,0x03,0x00,0x09,0x03,0x14,0x0a,0xbb,0x00,0x03,0xb5,0x01,0x26,0xf7,
+0x00,0x9e,0x00,0x25,0xff,0xa1,0x1c,0x02,0x17,0x5f,0x1a,0x03,0x13,0x1e,0x1e,0x00,
+0x14,0xdf,0x93,0x00,0x03,0xb0,0x00,0x18,0xf0,0xcd,0x02,0x03,0xa6,0x00,0x05,0x17,
+0x04,0x03,0xa2,0x03,0x1b,0x5f,0x91,0x02,0x18,0x0a,0x3b,0x00,0x09,0x74,0x02,0x15,
+0xf3,0xad,0x03,0x13,0xff,0xd7,0x05,0x1a,0x9f,0x89,0x01,0x1a,0x09,0xe7,0x04,0x07,
+0x57,0x05,0x16,0x60,0x4b,0x00,0x04,0xf4,0x02,0x15,0xdf,0x1d,0x00,0x17,0xd0,0x2c,
+0x05,0x1c,0x10,0xb0,0x05,0x17,0xf5,0x18,0x03,0x1c,0xfb,0x63,0x03,0x18,0xfb,0x4a,
+0x00,0x04,0xda,0x02,0x28,0x2c,0xff,0x4c,0x00,0x14,0x07,0x2b,0x00,0x11,0x10,0x08,
+0x03,0x1a,0x9f,0x03,0x06,0x05,0x71,0x03,0x56,0x95,0x10,0x00,0x14,0x8c,0xb0,0x00,
+0x1c,0xc0,0xdf,0x00,0x0e,0x21,0x06,0x1e,0x01,0x1d,0x00,0x07,0xb8,0x03,0x1e,0x06,
+0x1e,0x00,0x07,0x2d,0x04,0x1f,0x09,0x1e,0x00,0x05,0x27,0x40,0x00,0x0a,0x02,0x0d,
+0x01,0x00,0x1e,0x30,0x42,0x04,0x0c,0x28,0x03,0x1b,0x07,0x16,0x00,0x37,0xd4,0x8f,
+0xff,0xdf,0x04,0x29,0x03,0xdf,0x32,0x00,0x39,0x70,0x00,0xaf,0x59,0x01,0x17,0x6d,
+0x1d,0x00,0x16,0xd6,0x53,0x04,0x13,0xf9,0x77,0x06,0x14,0xae,0x1c,0x00,0x20,0xd8,
+0x30,0x00,0x01,0x17,0xdf,0x9f,0x02,0x00,0x5c,0x00,0x7b,0x69,0xbd,0xef,0xff,0xfe,
+0xca,0x75,0xf2,0x07,0x01,0x7e,0x03,0x11,0xe0,0x6f,0x00,0x0f,0x0b,0x00,0x0d,0x21,
+0xfd,0x0f,0x7b,0x01,0x01,0x91,0x00,0x11,0x0f,0xe2,0x06,0x01,0x7e,0x00,0x11,0x0f,
+0x5f,0x04,0x01,0x93,0x03,0x11,0x0f,0x4c,0x04,0x01,0x64,0x02,0x11,0x0f,0x11,0x01,
+0x01,0x6d,0x03,0x11,0x0f,0xed,0x01,0x01,0xb5,0x02,0x11,0x0f,0xe2,0x02,0x01,0x55,
+0x02,0x11,0x0f,0xf6,0x00,0x01,0xaf,0x01,0x11,0x0f,0xf4,0x06,0x0e,0x71,0x05,0x08,
+0xb1,0x08,0x17,0xe7,0x0d,0x00,0x39,0x2c,0xff,0xd0,0x00,0x08,0x18,0x20,0xac,0x06,
+0x19,0xf8,0x72,0x05,0x19,0xe0,0x7f,0x05,0x18,0x40,0x0d,0x00,0x19,0xf9,0x07,0x03,
+0x17,0x50,0x9e,0x07,0x27,0xfe,0x30,0x7b,0x03,0x04,0x0d,0x00,0x18,0x2f,0x69,0x06,
+0x18,0x0c,0x34,0x00,0x18,0x06,0x0f,0x06,0x17,0x02,0xa0,0x02,0x03,0x5c,0x00,0x18,
+0xf2,0x0e,0x07,0x18,0xf8,0xaf,0x07,0x28,0xfe,0x10,0x8a,0x08,0x18,0x70,0x7a,0x03,
+0x04,0xb9,0x00,0x1d,0x5f,0x35,0x00,0x04,0x84,0x03,0x16,0x03,0x66,0x08,0x04,0x0c,
+0x03,0x18,0xf4,0xd5,0x01,0x19,0xfe,0xe7,0x08,0x18,0xa0,0xce,0x07,0x18,0xf5,0x28,
+0x00,0x19,0xff,0x28,0x00,0x18,0xb0,0x50,0x00,0x04,0x3c,0x02,0x18,0x0d,0xfc,0x00,
+0x19,0x01,0xd3,0x08,0x18,0x5f,0xfe,0x08,0x19,0x09,0x6b,0x00,0x18,0xcf,0x43,0x00,
+0x18,0x0f,0x1d,0x08,0x0a,0xa0,0x08,0x02,0x6e,0x05,0x09,0x51,0x08,0x18,0xe0,0x86,
+0x00,0x19,0xfc,0x9c,0x07,0x1f,0xb0,0xc4,0x01,0x01,0x19,0x0e,0x92,0x07,0x1e,0xff,
+0x79,0x00,0x18,0x70,0x79,0x00,0x19,0xf6,0xcf,0x07,0x18,0x50,0xb9,0x01,0x28,0xf5,
+0x00,0xee,0x01,0x18,0x40,0x6a,0x01,0x19,0xf4,0x7c,0x08,0x1f,0x40,0x36,0x00,0x07,
+0x1e,0x50,0x6c,0x00,0x0b,0x87,0x00,0x0a,0xa2,0x00,0x0a,0xbd,0x00,0x09,0x63,0x09,
+0x1e,0x0b,0xe4,0x01,0x1e,0xfc,0x29,0x01,0x05,0x26,0x06,0x09,0x4e,0x08,0x19,0xf1,
+0x7a,0x00,0x18,0x30,0x37,0x01,0x19,0xf6,0xb0,0x01,0x18,0x90,0x4a,0x0b,0x19,0xfc,
+0x44,0x00,0x19,0xf0,0xa3,0x00,0x18,0x30,0x44,0x02,0x1e,0xf6,0x5f,0x02,0x05,0x53,
+0x01,0x09,0x89,0x09,0x14,0xf4,0xc3,0x03,0x09,0x6d,0x00,0x19,0x1f,0x36,0x0b,0x09,
+0x28,0x03,0x19,0x04,0x29,0x00,0x18,0x0d,0xcc,0x02,0x29,0x00,0x6f,0x29,0x0a,0x18,
+0xef,0x54,0x0a,0x19,0x08,0x7f,0x0a,0x19,0x0e,0x60,0x00,0x19,0x6f,0x3e,0x09,0x18,
+0xdf,0x64,0x0c,0x0a,0x6e,0x00,0x19,0x09,0xbe,0x09,0x02,0x7c,0x00,0x18,0x20,0xa8,
+0x02,0x19,0xfd,0xc8,0x0b,0x19,0xfb,0xc1,0x00,0x04,0x0e,0x00,0x02,0x7b,0x05,0x23,
+0xfc,0x10,0x4a,0x01,0x06,0xfe,0x08,0x05,0x0e,0x00,0x18,0x50,0x0e,0x00,0x27,0xf0,
+0x00,0x38,0x00,0x19,0xfa,0x79,0x0b,0x07,0x4d,0x0b,0x37,0x5e,0xff,0xe0,0x03,0x05,
+0x26,0x19,0xf8,0x0c,0x00,0x50,0x00,0x00,0x02,0x10,0x00,0x38,0x00,0x01,0x00,0x01,
+0x00,0x28,0x0c,0xc3,0x0e,0x00,0x37,0x2f,0xff,0xa1,0x0e,0x00,0x46,0x8f,0xff,0xfe,
+0x40,0x0e,0x00,0x45,0xdf,0xff,0xff,0xf7,0x0d,0x00,0x64,0x03,0xff,0xff,0xff,0xff,
+0x90,0x0e,0x00,0x10,0x09,0x0e,0x00,0x14,0xfa,0x0e,0x00,0x20,0x0e,0xff,0x01,0x00,
+0x13,0xa0,0x0e,0x00,0x11,0x08,0x0e,0x00,0x14,0xf9,0x1d,0x00,0x11,0x6f,0x0f,0x00,
+0x13,0x60,0x0e,0x00,0x11,0x06,0x0e,0x00,0x14,0xf4,0x1d,0x00,0x10,0x7f,0x0e,0x00,
+0x23,0xfe,0x10,0x0e,0x00,0x19,0x0a,0x48,0x00,0x20,0x00,0xdf,0x0e,0x00,0x14,0xf6,
+0x0e,0x00,0x11,0x3f,0x1d,0x00,0x19,0x10,0x65,0x00,0x05,0x2b,0x00,0x10,0xef,0x0e,
+0x00,0x19,0xf3,0x73,0x00,0x14,0xfc,0x0e,0x00,0x19,0x0d,0x81,0x00,0x11,0x05,0x0e,
+0x00,0x19,0xd0,0x39,0x00,0x19,0xf5,0x8f,0x00,0x05,0x39,0x00,0x11,0x1f,0x2b,0x00,
+0x04,0x11,0x01,0x19,0x0b,0x72,0x00,0x02,0x47,0x00,0x13,0xf1,0x0e,0x00,0x29,0x01,
+0xff,0xab,0x00,0x19,0xcf,0x47,0x00,0x11,0x7f,0x1d,0x00,0x15,0x20,0x71,0x01,0x00,
+0x01,0x00,0x19,0x70,0x9c,0x00,0x19,0xb0,0x00,0x01,0x13,0xf0,0x0e,0x00,0x19,0x07,
+0x2b,0x01,0x1a,0x03,0x56,0x01,0x19,0xff,0x63,0x00,0x11,0xdf,0x0f,0x00,0x04,0x0e,
+0x00,0x11,0xaf,0x0e,0x00,0x15,0x30,0xd4,0x01,0x08,0xff,0x00,0x28,0x6f,0xff,0xc8,
+0x01,0x19,0x4f,0x7f,0x00,0x19,0x2f,0x1b,0x01,0x19,0x1f,0x8d,0x00,0x19,0x0f,0xf0,
+0x00,0x02,0xb7,0x00,0x19,0xf3,0x0e,0x00,0x14,0xf5,0x60,0x02,0x1e,0xff,0x0e,0x00,
+0x19,0xf6,0x44,0x01,0x19,0xf7,0x0e,0x00,0x19,0xf8,0xfd,0x00,0x0f,0x0e,0x00,0x17,
+0x1f,0xf7,0x54,0x00,0x08,0x1e,0xf6,0x7e,0x00,0x0d,0xa8,0x00,0x0a,0xc4,0x00,0x02,
+0xc3,0x02,0x19,0xf2,0xee,0x00,0x19,0xf0,0x0a,0x01,0x19,0xe0,0x88,0x02,0x13,0xc0,
+0x0e,0x00,0x19,0x5f,0x50,0x01,0x19,0x7f,0x6c,0x01,0x19,0x9f,0x88,0x01,0x19,0xbf,
+0xa4,0x01,0x01,0x0d,0x00,0x13,0xfd,0x0d,0x00,0x19,0x02,0xdc,0x01,0x19,0x05,0xa7,
+0x00,0x19,0x09,0x79,0x01,0x19,0x0c,0xa3,0x01,0x02,0xa7,0x00,0x19,0x80,0x8b,0x00,
+0x18,0x30,0x05,0x02,0x19,0xfd,0xe7,0x02,0x04,0x40,0x01,0x19,0x04,0xec,0x00,0x19,
+0x09,0xd0,0x00,0x02,0x08,0x01,0x18,0x50,0x53,0x00,0x19,0xfe,0xd7,0x02,0x19,0xf7,
+0x90,0x02,0x19,0xf0,0x93,0x01,0x18,0x70,0x23,0x01,0x05,0x37,0x00,0x18,0xbf,0xcf,
+0x00,0x1e,0x05,0x6e,0x00,0x0a,0xb3,0x00,0x19,0xf8,0x29,0x04,0x19,0xc0,0x75,0x01,
+0x13,0x20,0x2f,0x01,0x18,0xef,0xd6,0x01,0x18,0x2e,0x82,0x01,0x02,0xdb,0x00,0x19,
+0xfb,0x20,0x01,0x18,0xd0,0xa4,0x00,0x28,0xfd,0x10,0x05,0x01,0x27,0xc1,0x00,0x21,
+0x01,0x16,0xfb,0xfa,0x04,0x16,0x9f,0x56,0x01,0x01,0x7d,0x00,0x17,0xd3,0x24,0x05,
+0x28,0x0d,0xe7,0x40,0x05,0x19,0x03,0x5c,0x05,0x07,0x57,0x03,0x05,0x7b,0x01,0x08,
+0xc0,0x04,0x1e,0xfc,0x15,0x00,0x09,0x78,0x00,0x06,0x88,0x03,0x1c,0xfa,0x15,0x00,
+0x18,0x1f,0xfe,0x03,0x17,0x00,0xe1,0x00,0x1e,0xf8,0x15,0x00,0x08,0xb8,0x05,0x07,
+0x6a,0x01,0x0d,0x15,0x00,0x18,0x0d,0xb5,0x04,0x17,0x00,0x63,0x02,0x1c,0xf5,0xe0,
+0x00,0x18,0x0b,0xb5,0x05,0x44,0x00,0x4f,0xd6,0x10,0x51,0x01,0x12,0xf3,0xd6,0x01,
+0x10,0xb4,0x34,0x01,0x23,0xfa,0x30,0x4f,0x02,0x01,0x5b,0x02,0x31,0x18,0xef,0xf9,
+0x57,0x01,0x22,0xfd,0x60,0xae,0x05,0x00,0xc3,0x02,0x10,0x4b,0x17,0x02,0x02,0x3a,
+0x02,0x31,0x93,0x00,0x08,0x40,0x02,0x21,0x01,0x7e,0x03,0x02,0x02,0x86,0x02,0x30,
+0xff,0xc6,0x07,0x15,0x00,0x22,0x04,0xaf,0xd4,0x01,0x01,0x1f,0x02,0x00,0x37,0x01,
+0x00,0xbd,0x00,0x22,0xdf,0xff,0x87,0x03,0x2e,0x3f,0xff,0x01,0x00,0x3e,0xf3,0x8f,
+0xff,0x01,0x00,0x3d,0xf8,0x27,0xbf,0x15,0x00,0x00,0x43,0x01,0x2a,0x59,0xef,0x13,
+0x00,0x21,0xfd,0x94,0x55,0x02,0x18,0x7b,0x14,0x00,0x24,0xb6,0x20,0xb0,0x02,0x14,
+0x9e,0x13,0x00,0x17,0xd8,0x1a,0x07,0x03,0x6c,0x03,0x28,0xfa,0x61,0x39,0x01,0x2a,
+0x01,0xef,0x06,0x06,0x07,0x90,0x04,0x06,0xe4,0x02,0x07,0x93,0x05,0x37,0xff,0xff,
+0xe1,0x14,0x00,0x02,0x19,0x03,0x0b,0x24,0x02,0x01,0x92,0x05,0x18,0x6d,0xe5,0x03,
+0x03,0xed,0x05,0x29,0xfc,0x04,0xb8,0x06,0x02,0xdc,0x02,0x12,0xf2,0x42,0x03,0x19,
+0x20,0x79,0x06,0x38,0x70,0x00,0x1f,0x05,0x03,0x13,0x04,0x17,0x04,0x18,0x06,0x28,
+0x03,0x14,0x2e,0x0a,0x05,0x17,0xcf,0xc6,0x03,0x14,0xcf,0x57,0x03,0x16,0x3f,0x87,
+0x06,0x15,0x0a,0xd9,0x03,0x16,0x09,0xb9,0x07,0x16,0x09,0x8b,0x00,0x16,0xef,0xff,
+0x04,0x15,0x4e,0x2d,0x07,0x00,0x2c,0x01,0x16,0xe4,0xe3,0x03,0x14,0x10,0x18,0x01,
+0x24,0xfb,0x10,0xfb,0x00,0x25,0xef,0xf6,0x08,0x05,0x15,0x60,0xd3,0x00,0x24,0x1a,
+0xc0,0xc7,0x00,0x2e,0xd2,0x00,0x01,0x00,0x2f,0x07,0x00,0x01,0x00,0x12,0x03,0x56,
+0x01,0x1f,0x80,0x18,0x00,0xff,0x8e,0x22,0x15,0x55,0x01,0x00,0x12,0x58,0x18,0x00,
+0x13,0xa5,0x0f,0x00,0x2e,0x52,0x5f,0xd8,0x03,0x01,0x85,0x06,0x0f,0x18,0x00,0xf5,
+0x0f,0xe8,0x02,0xfe,0x0f,0x18,0x00,0xa6,0x14,0x07,0x50,0x09,0x02,0x44,0x0a,0x0f,
+0x11,0x00,0x39,0x13,0xe0,0x72,0x06,0x14,0xfc,0xed,0x09,0x13,0xa0,0x95,0x09,0x14,
+0xf7,0x82,0x09,0x34,0x40,0x00,0x01,0x3b,0x00,0x13,0x5f,0x19,0x06,0x13,0x0b,0xcb,
+0x0a,0x14,0x01,0x43,0x00,0x13,0x7f,0x9e,0x09,0x13,0x0e,0x88,0x0d,0x14,0x06,0xc2,
+0x00,0x18,0xef,0x21,0x00,0x12,0xf5,0x2f,0x0b,0x00,0xc0,0x08,0x24,0x01,0x9f,0x07,
+0x09,0x14,0x19,0x2b,0x06,0x33,0x02,0xaf,0xfe,0x9e,0x06,0x26,0x3a,0x20,0xb8,0x0c,
+0x03,0x01,0x00,0x19,0x8d,0xbd,0x07,0x0f,0x1b,0x00,0x66,0x00,0x94,0x01,0x34,0x47,
+0x87,0x40,0x65,0x0e,0x00,0x74,0x09,0x11,0x1c,0x35,0x07,0x33,0x20,0x00,0x0c,0xb6,
+0x0b,0x14,0x05,0x7e,0x03,0x13,0xbf,0x94,0x08,0x13,0x0f,0x3c,0x00,0x14,0x11,0x90,
+0x08,0x04,0x11,0x00,0x13,0x20,0x6c,0x08,0x13,0xf0,0xe0,0x08,0x12,0xfb,0x65,0x0d,
+0x00,0x72,0x01,0x14,0x6f,0x6e,0x00,0x14,0x5f,0x75,0x07,0x70,0x17,0xce,0xfe,0xc8,
+0x10,0x00,0x00,0x17,0x00,0x01,0x00,0x68,0x04,0x88,0x88,0x88,0x88,0x84,0x12,0x00,
+0x68,0x0d,0xff,0xff,0xff,0xff,0xf4,0x12,0x00,0x10,0x2f,0x12,0x00,0x18,0xe0,0x12,
+0x00,0x10,0x7f,0x12,0x00,0x18,0x90,0x12,0x00,0x10,0xdf,0x12,0x00,0x17,0x30,0x11,
+0x00,0x10,0x02,0x11,0x00,0x18,0xfe,0x23,0x00,0x10,0x08,0x12,0x00,0x1d,0xf9,0x6b,
+0x00,0x1f,0xf3,0x6b,0x00,0x0b,0x10,0x8f,0x12,0x00,0x1f,0x80,0x6b,0x00,0x0a,0x1f,
+0x03,0x6b,0x00,0x03,0x1f,0xf8,0x6b,0x00,0x0b,0x10,0x3f,0x12,0x00,0x1f,0xd0,0x6b,
+0x00,0x0b,0x1f,0xef,0x6b,0x00,0x02,0x1f,0xfd,0x6b,0x00,0x0b,0x10,0x0e,0x12,0x00,
+0x1f,0xf2,0x6b,0x00,0x0b,0x1f,0x9f,0x6b,0x00,0x03,0x1f,0x20,0x6b,0x00,0x0a,0x10,
+0x09,0x12,0x00,0x1f,0xf7,0x6b,0x00,0x0b,0x1f,0x4f,0x6b,0x00,0x03,0x1f,0x70,0x6b,
+0x00,0x0a,0x1f,0x04,0x6b,0x00,0x27,0x1f,0xc0,0x6b,0x00,0x21,0x18,0xfc,0x23,0x00,
+0x1d,0x0a,0x6b,0x00,0x10,0x0f,0x12,0x00,0x1f,0xf1,0x6b,0x00,0x0b,0x1d,0xaf,0x6b,
+0x00,0x10,0xff,0x01,0x00,0x17,0x10,0x11,0x00,0x1f,0x05,0x6b,0x00,0x03,0x1f,0xf6,
+0x6b,0x00,0x0b,0x1f,0x5f,0x6b,0x00,0x03,0x1f,0x60,0x6b,0x00,0x0f,0x1f,0xfb,0x6b,
+0x00,0x22,0x1f,0xb0,0x6b,0x00,0x2e,0x1f,0x0b,0x6b,0x00,0x22,0x10,0xbf,0x12,0x00,
+0x17,0x50,0x11,0x00,0x11,0x01,0x6b,0x00,0x08,0x23,0x00,0x1f,0x06,0x6b,0x00,0x03,
+0x18,0xf5,0x12,0x00,0x10,0x1f,0x12,0x00,0x18,0xf0,0x12,0x00,0x10,0x6f,0x12,0x00,
+0x1f,0xa0,0x6b,0x00,0x21,0x1f,0xfa,0x6b,0x00,0x2f,0x1f,0xcf,0x6b,0x00,0x21,0x1d,
+0x0c,0xf2,0x04,0x0e,0x6b,0x00,0x1d,0x7f,0x6b,0x00,0x04,0x01,0x00,0x8a,0x15,0x9b,
+0xde,0xff,0xfe,0xdb,0x85,0x10,0x16,0x00,0x32,0x17,0xdf,0xff,0x01,0x00,0x28,0xc7,
+0x10,0x8e,0x00,0x25,0x8f,0xff,0x01,0x00,0x17,0x81,0xd4,0x01,0x26,0xef,0xff,0x01,
+0x00,0x1a,0xe5,0x85,0x03,0x05,0x01,0x00,0x19,0xf9,0x1a,0x01,0x06,0x01,0x00,0x1f,
+0xfb,0x17,0x00,0x03,0x04,0xe3,0x00,0x0a,0x45,0x00,0x05,0xac,0x04,0x1c,0x05,0x17,
+0x00,0x02,0x01,0x01,0x2d,0x01,0xef,0x18,0x00,0x15,0xe0,0xda,0x03,0x0a,0x01,0x00,
+0x13,0x80,0xaf,0x05,0x00,0x01,0x00,0x44,0xe8,0x32,0x02,0x48,0x3a,0x00,0x16,0x10,
+0x74,0x00,0x17,0x80,0x3b,0x00,0x14,0xf8,0xcd,0x02,0x04,0xe1,0x02,0x15,0x7f,0x5f,
+0x00,0x12,0x5f,0x0a,0x00,0x17,0x90,0x04,0x03,0x00,0xc5,0x01,0x01,0x43,0x03,0x05,
+0xc8,0x02,0x15,0x01,0xd6,0x00,0x0a,0x0f,0x01,0x03,0x6c,0x00,0x12,0xf0,0x65,0x05,
+0x06,0xae,0x05,0x04,0x0f,0x00,0x17,0x07,0xc6,0x00,0x04,0x92,0x04,0x00,0x70,0x04,
+0x19,0xbf,0x3d,0x01,0x04,0x6d,0x00,0x27,0xb0,0x0d,0xba,0x00,0x06,0xa6,0x00,0x13,
+0xfd,0x75,0x00,0x18,0xf5,0x86,0x03,0x00,0x76,0x00,0x1a,0x2f,0x75,0x00,0x04,0x76,
+0x00,0x39,0x24,0xff,0xff,0x2f,0x05,0x13,0x01,0x63,0x01,0x2a,0x5f,0xff,0xd0,0x03,
+0x12,0x1f,0x10,0x00,0x14,0x56,0xc4,0x00,0x09,0xf6,0x03,0x23,0xff,0xf7,0x23,0x01,
+0x0a,0xd8,0x03,0x3f,0xff,0xff,0x77,0x2f,0x00,0x03,0x2f,0xf8,0x8f,0x2f,0x00,0x03,
+0x1f,0x98,0x2f,0x00,0x03,0x1f,0xf9,0x2f,0x00,0xff,0x1f,0x1f,0x88,0x78,0x01,0x04,
+0x0f,0xa7,0x01,0x04,0x1f,0x76,0xd6,0x01,0x04,0x0f,0x05,0x02,0x04,0x1b,0x53,0x34,
+0x02,0x13,0x02,0x34,0x02,0x03,0x63,0x02,0x1b,0x40,0x63,0x02,0x12,0x20,0x07,0x00,
+0x1c,0xf6,0x92,0x02,0x0c,0xc1,0x02,0x13,0x8f,0xc1,0x02,0x1a,0xaf,0xf0,0x02,0x13,
+0x0b,0xf0,0x02,0x1b,0x07,0xa5,0x00,0x04,0x1f,0x03,0x1a,0x3f,0x76,0x00,0x05,0x0f,
+0x00,0x28,0xef,0xff,0x3f,0x05,0x14,0x08,0x3e,0x00,0x0a,0xac,0x03,0x06,0x26,0x00,
+0x12,0x4f,0x18,0x00,0x17,0xa0,0x20,0x08,0x01,0xa0,0x05,0x18,0xef,0x0a,0x04,0x15,
+0x5f,0x84,0x00,0x18,0x07,0x39,0x04,0x16,0x7f,0xe9,0x03,0x13,0x1f,0x18,0x00,0x44,
+0xd7,0x30,0x01,0x37,0x59,0x05,0x16,0x20,0x23,0x00,0x08,0x01,0x00,0x01,0x46,0x04,
+0x0e,0xc6,0x04,0x15,0xe1,0x7d,0x08,0x09,0x01,0x00,0x18,0xf5,0xc7,0x00,0x0d,0x6c,
+0x05,0x2e,0x0a,0xff,0x6b,0x05,0x0e,0x18,0x00,0x06,0x64,0x08,0x1e,0x08,0x81,0x05,
+0x02,0xf5,0x08,0x08,0x90,0x00,0x1f,0xf6,0x0f,0x06,0x03,0x18,0x91,0x3e,0x06,0x24,
+0x16,0xcf,0xf1,0x00,0x1b,0x10,0x6d,0x06,0x10,0x8b,0x6d,0x06,0x18,0x95,0x52,0x09,
+0x07,0x32,0x0a,0x28,0x9c,0x60,0x81,0x0b,0x18,0x8d,0x97,0x0a,0x29,0x01,0x6c,0x71,
+0x0a,0x19,0x5b,0xb6,0x0a,0x19,0x49,0x34,0x02,0x28,0x28,0xef,0x29,0x06,0x28,0x17,
+0xdf,0xf1,0x05,0x28,0x05,0xbf,0x48,0x06,0x28,0x04,0xaf,0x10,0x06,0x29,0x03,0x9e,
+0x67,0x06,0x1a,0x1d,0x25,0x01,0x1b,0x82,0x86,0x06,0x1f,0x2f,0x1f,0x00,0x31,0x28,
+0xfe,0x9f,0x1f,0x00,0x37,0xfd,0x83,0x00,0x1f,0x00,0x24,0xfc,0x72,0x8a,0x03,0x00,
+0x1f,0x00,0x27,0xfb,0x61,0xb1,0x03,0x38,0x2f,0xfa,0x50,0xa9,0x03,0x2a,0x81,0x40,
+0xd0,0x03,0x0b,0xc8,0x03,0x2f,0x80,0x00,0x1f,0x00,0xff,0xff,0xb2,0x50,0xff,0xff,
+0xff,0xff,0x80,0x13,0x00,0x01,0x00,0x9a,0x03,0x69,0xcd,0xef,0xfe,0xec,0xb9,0x63,
+0x00,0x01,0x00,0x32,0x04,0xae,0xff,0x01,0x00,0x29,0xfe,0xa4,0x18,0x00,0x25,0x6d,
+0xff,0x01,0x00,0x27,0xfe,0x60,0x2f,0x00,0x27,0xef,0xff,0x01,0x00,0x15,0xd4,0x18,
+0x00,0x29,0x0a,0xff,0x01,0x00,0x14,0xf8,0x18,0x00,0x2a,0x2d,0xff,0x01,0x00,0x13,
+0xfb,0x18,0x00,0x2f,0x3e,0xff,0x19,0x00,0x03,0x1c,0x2e,0x18,0x00,0x03,0x4b,0x00,
+0x2d,0x1d,0xff,0x01,0x00,0x1e,0xf4,0x78,0x00,0x02,0x01,0x00,0x7e,0xd0,0x00,0x00,
+0x00,0x05,0xff,0xff,0x01,0x00,0x44,0x50,0x00,0x00,0x00,0xc0,0x00,0x53,0xe8,0x41,
+0x01,0x25,0xaf,0x0c,0x00,0x53,0xfc,0x00,0x00,0x00,0x6f,0x0c,0x00,0x10,0x70,0x56,
+0x00,0x13,0x3d,0x0d,0x00,0x43,0xf2,0x00,0x00,0x0e,0x0b,0x00,0x11,0x40,0x87,0x00,
+0x15,0x1c,0x26,0x00,0x16,0x04,0x54,0x00,0x00,0x01,0x00,0x15,0x2f,0xc6,0x00,0x12,
+0x9f,0x0a,0x00,0x13,0xa0,0xe9,0x00,0x12,0x7f,0x0f,0x00,0x14,0xe0,0x49,0x00,0x13,
+0xf2,0x18,0x00,0x13,0x01,0x40,0x00,0x2a,0x00,0x02,0x19,0x01,0x22,0x00,0x0c,0x10,
+0x00,0x32,0xf1,0x00,0x5f,0x09,0x00,0x05,0x7d,0x01,0x03,0x59,0x00,0x2a,0x20,0x08,
+0x49,0x00,0x22,0x00,0x07,0x10,0x00,0x14,0xf3,0x21,0x00,0x05,0x94,0x01,0x13,0x6f,
+0x31,0x00,0x03,0x24,0x01,0x14,0xf0,0x18,0x00,0x14,0x06,0x62,0x00,0x20,0x7a,0xaa,
+0x01,0x00,0x15,0xa9,0x31,0x00,0x1b,0x8f,0x41,0x00,0x04,0x01,0x00,0x12,0x0b,0x18,
+0x00,0x1d,0xc0,0x19,0x00,0x02,0x18,0x00,0x1d,0xf9,0x18,0x00,0x19,0x5f,0x1c,0x01,
+0x06,0x01,0x00,0x1b,0x0c,0x8a,0x00,0x05,0x56,0x02,0x0b,0x04,0x01,0x05,0x01,0x00,
+0x18,0xdf,0x7d,0x01,0x07,0x01,0x00,0x16,0x7f,0xea,0x01,0x09,0x01,0x00,0x12,0x3f,
+0x18,0x00,0x1c,0xf5,0x18,0x00,0x16,0x0d,0xe9,0x01,0x09,0x01,0x00,0x04,0x3f,0x02,
+0x1b,0x30,0x18,0x00,0x13,0x07,0x18,0x00,0x1f,0x90,0xa9,0x00,0x03,0x0d,0x79,0x00,
+0x24,0x03,0xff,0x85,0x01,0x0a,0x01,0x00,0x13,0x01,0x6f,0x02,0x1c,0xf7,0x18,0x00,
+0x1f,0xdf,0xf2,0x00,0x04,0x12,0xcf,0x18,0x00,0x2b,0xfd,0x10,0x18,0x00,0x23,0xbf,
+0xff,0xcd,0x01,0x0f,0x18,0x00,0x04,0x0c,0x22,0x01,0x2b,0xaf,0xff,0x3e,0x02,0x0a,
+0xe3,0x01,0x2e,0xff,0x80,0x51,0x01,0x0e,0xf1,0x00,0x07,0x17,0x03,0x1f,0xa0,0xe2,
+0x01,0x03,0x2b,0xff,0xb0,0x18,0x00,0x2f,0x4f,0xff,0x2c,0x02,0x03,0x1e,0x3f,0x18,
+0x00,0x09,0xf0,0x03,0x1f,0xd1,0x18,0x00,0x14,0x04,0x08,0x04,0x1f,0xe2,0x18,0x00,
+0x14,0x1f,0x0c,0x99,0x01,0x04,0x18,0x0b,0x45,0x04,0x0e,0x11,0x02,0x0d,0x18,0x00,
+0x2f,0x09,0xff,0x5a,0x02,0x03,0x13,0x08,0x18,0x00,0x1f,0xf6,0x41,0x02,0x04,0x0c,
+0xf9,0x01,0x1c,0x05,0x21,0x05,0x0b,0x59,0x02,0x0b,0x01,0x00,0x2e,0xf6,0x03,0x18,
+0x00,0x02,0xd8,0x01,0x1f,0x5f,0x31,0x00,0x04,0x1f,0x05,0x31,0x00,0xb0,0x04,0x15,
+0x01,0x8b,0x26,0x9b,0xde,0xff,0xfe,0xdb,0x97,0x40,0x6c,0x03,0x14,0x9e,0x29,0x00,
+0x28,0xb6,0x10,0x5a,0x01,0x16,0xdf,0x42,0x00,0x26,0xf9,0x20,0x59,0x01,0x1e,0xdf,
+0x98,0x06,0x07,0x4e,0x05,0x04,0x01,0x00,0x1b,0xe3,0x48,0x02,0x09,0x34,0x06,0x06,
+0xb0,0x03,0x06,0x01,0x00,0x1e,0xf5,0x97,0x06,0x07,0x8a,0x03,0x1e,0xbf,0x18,0x00,
+0x16,0xe1,0x7a,0x05,0x09,0x01,0x00,0x26,0xfa,0x00,0x65,0x06,0x09,0x01,0x00,0x16,
+0x30,0xae,0x03,0x66,0xfc,0x63,0x10,0x12,0x6a,0xff,0x8b,0x03,0x13,0xef,0x26,0x04,
+0x01,0xb7,0x04,0x24,0x2c,0xff,0xd0,0x05,0x1a,0x04,0x95,0x03,0x14,0xaf,0x4f,0x01,
+0x13,0x09,0x2f,0x00,0x0a,0x14,0x03,0x14,0xfa,0x09,0x00,0x1a,0xf3,0xc5,0x04,0x3b,
+0xfe,0x00,0x0f,0xe5,0x04,0x03,0x95,0x04,0x04,0x18,0x00,0x1b,0x80,0x4d,0x04,0x27,
+0x20,0x1f,0x3b,0x07,0x07,0x1d,0x04,0x0c,0x55,0x05,0x04,0x1d,0x04,0x1f,0x40,0x18,
+0x00,0x15,0x0e,0x48,0x00,0x09,0xad,0x04,0x0c,0x24,0x05,0x03,0x76,0x01,0x1f,0xfd,
+0xa7,0x06,0x15,0x1e,0x07,0x1b,0x04,0x08,0xcc,0x07,0x1f,0xd0,0xb4,0x05,0x04,0x0c,
+0xa7,0x00,0x16,0x5e,0xc8,0x01,0x07,0x01,0x00,0x2d,0x24,0x8d,0xc2,0x04,0x04,0x44,
+0x04,0x0c,0xca,0x05,0x1e,0x09,0x89,0x02,0x0d,0x18,0x00,0x2e,0xfd,0x20,0x18,0x00,
+0x0c,0x98,0x05,0x07,0x18,0x00,0x2f,0xc4,0x00,0x18,0x00,0x03,0x1f,0xa3,0x18,0x00,
+0x04,0x2e,0xff,0xc3,0x18,0x00,0x0d,0x11,0x06,0x09,0x18,0x00,0x1e,0xfd,0xc0,0x00,
+0x0c,0x82,0x05,0x65,0x06,0xaa,0xaa,0xaa,0xab,0xce,0x31,0x00,0x0b,0xaf,0x01,0x2f,
+0x14,0xbf,0x5b,0x06,0x04,0x2e,0x02,0xcf,0x83,0x05,0x08,0xb4,0x05,0x1e,0xfc,0x26,
+0x08,0x0f,0x70,0x02,0x0b,0x1e,0x90,0x0e,0x08,0x0e,0x3e,0x08,0x07,0xc9,0x00,0x0d,
+0x9f,0x08,0x1e,0x05,0x29,0x02,0x08,0xb5,0x05,0x0d,0xa9,0x00,0x13,0x02,0x23,0x04,
+0x11,0x9a,0x60,0x09,0x1c,0xa5,0x26,0x08,0x1c,0xf5,0x31,0x02,0x13,0x04,0x18,0x00,
+0x1b,0xef,0xc0,0x02,0x13,0x08,0x78,0x00,0x1b,0xcf,0x32,0x02,0x13,0x0d,0xf1,0x03,
+0x0b,0x6b,0x0a,0x04,0x30,0x03,0x2a,0xe0,0x5f,0xac,0x06,0x23,0x02,0xef,0x28,0x00,
+0x1a,0x1f,0xb4,0x0a,0x14,0x2d,0x0f,0x00,0x14,0x0b,0x8b,0x04,0x28,0x10,0x00,0xa5,
+0x04,0x06,0x95,0x06,0x66,0xfa,0x62,0x00,0x01,0x48,0xef,0x44,0x05,0x1f,0xcf,0xb0,
+0x04,0x01,0x16,0xf1,0xe6,0x07,0x0a,0xe7,0x05,0x06,0x0e,0x07,0x0c,0xf8,0x04,0x2e,
+0x00,0xaf,0x18,0x00,0x18,0xc0,0x9f,0x07,0x06,0x01,0x00,0x2e,0xfc,0x10,0xb7,0x05,
+0x07,0xec,0x04,0x0c,0x5a,0x05,0x05,0x78,0x07,0x1a,0x2b,0x66,0x0c,0x06,0xb6,0x02,
+0x18,0x3b,0x17,0x00,0x08,0x3b,0x02,0x15,0x28,0xec,0x05,0x2a,0xc7,0x10,0x01,0x04,
+0xf0,0x01,0x58,0xac,0xef,0xff,0xfe,0xdc,0xa7,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x19,0x00,0x01,0x00,0x21,0x2b,0xbb,0x01,0x00,0x2c,0x80,0x00,0x01,0x00,
+0x21,0x0b,0xff,0x01,0x00,0x1d,0xfb,0x19,0x00,0x22,0x05,0xff,0x01,0x00,0x1c,0xb0,
+0x19,0x00,0x2f,0x01,0xef,0x33,0x00,0x05,0x1f,0x9f,0x33,0x00,0x05,0x2f,0x4f,0xff,
+0x33,0x00,0x04,0x2f,0x0d,0xff,0x33,0x00,0x04,0x2f,0x08,0xff,0x33,0x00,0x04,0x2f,
+0x02,0xff,0x33,0x00,0x05,0x1f,0xcf,0x33,0x00,0x05,0x1f,0x6f,0x33,0x00,0x05,0x2f,
+0x1e,0xff,0x33,0x00,0x04,0x2f,0x0a,0xff,0x33,0x00,0x04,0x2f,0x04,0xff,0x33,0x00,
+0x05,0x1f,0xef,0x33,0x00,0x05,0x1f,0x8f,0x33,0x00,0x05,0x2f,0x3f,0xff,0x33,0x00,
+0x04,0x2f,0x0c,0xff,0x33,0x00,0x04,0x2f,0x07,0xff,0x33,0x00,0x04,0x11,0x01,0x12,
+0x00,0x2e,0xfc,0xdf,0x33,0x00,0x11,0xbf,0x13,0x00,0x1e,0x3d,0x33,0x00,0x11,0x5f,
+0x12,0x00,0x1e,0x90,0x33,0x00,0x02,0x15,0x01,0x2d,0xe0,0x0d,0x33,0x00,0x11,0x09,
+0x11,0x00,0x2d,0xf5,0x00,0x33,0x00,0x13,0x03,0x11,0x00,0x0e,0x33,0x00,0x02,0x2b,
+0x00,0x1e,0x10,0x33,0x00,0x11,0x7f,0x11,0x00,0x1e,0x60,0x33,0x00,0x11,0x2f,0x10,
+0x00,0x2d,0xc0,0x00,0x33,0x00,0x02,0xa8,0x02,0x2d,0xf3,0x00,0x33,0x00,0x11,0x06,
+0x0f,0x00,0x2d,0xf8,0x00,0x33,0x00,0x02,0xa8,0x02,0x2e,0xfe,0x00,0x33,0x00,0x11,
+0xaf,0x0f,0x00,0x1e,0x40,0x33,0x00,0x02,0xa8,0x02,0x1e,0xa0,0x33,0x00,0x02,0x0f,
+0x00,0x2d,0xf1,0x00,0x33,0x00,0x02,0xa8,0x02,0x2d,0xf6,0x00,0x33,0x00,0x12,0x02,
+0x93,0x01,0x1e,0x00,0x33,0x00,0x02,0xa8,0x02,0x1e,0x20,0x33,0x00,0x02,0xa8,0x02,
+0x1e,0x80,0x33,0x00,0x11,0x1f,0x0d,0x00,0x2d,0xd0,0x00,0x33,0x00,0x02,0x15,0x01,
+0x2d,0xf4,0x00,0x33,0x00,0x02,0xbd,0x03,0x2e,0xfa,0x00,0x33,0x00,0x02,0x15,0x01,
+0x1e,0x10,0x33,0x00,0x13,0x9f,0x93,0x01,0x0d,0x33,0x00,0x08,0xa8,0x02,0x08,0x01,
+0x00,0x15,0xf7,0xbd,0x03,0x0c,0x01,0x00,0x2f,0x75,0xff,0x33,0x00,0x05,0x1f,0x5f,
+0x1a,0x00,0x05,0x1f,0x74,0x33,0x00,0x06,0x1f,0x3f,0x1a,0x00,0x05,0x1f,0x72,0x33,
+0x00,0x06,0x1f,0x1f,0x1a,0x00,0x05,0x1f,0x70,0x33,0x00,0x06,0x1f,0x0e,0x33,0x00,
+0x06,0x1f,0xdf,0x33,0x00,0x05,0x0e,0xca,0x04,0x0e,0xfb,0x04,0x0e,0xfe,0x01,0x0f,
+0x33,0x00,0xff,0x3a,0x2d,0x26,0x66,0x01,0x00,0x1b,0x50,0x73,0x05,0x04,0x01,0x00,
+0x18,0xd0,0xa0,0x06,0x0c,0x18,0x00,0x1f,0xbf,0x18,0x00,0x04,0x1f,0xdf,0x18,0x00,
+0x04,0x1f,0xff,0x18,0x00,0x03,0x1f,0x01,0x18,0x00,0x04,0x1f,0x02,0x18,0x00,0x04,
+0x1f,0x04,0x18,0x00,0x04,0x1f,0x06,0x18,0x00,0x04,0x1f,0x08,0x18,0x00,0x04,0x1f,
+0x0a,0x18,0x00,0x04,0x18,0x0c,0x05,0x04,0x0d,0x46,0x01,0x1d,0xf8,0x18,0x00,0x16,
+0x0f,0xcc,0x04,0x09,0x01,0x00,0x18,0x1f,0x66,0x04,0x0d,0xc1,0x06,0x1d,0xf2,0x18,
+0x00,0x16,0x5f,0x2d,0x05,0x1e,0x00,0x88,0x07,0x1d,0xf0,0x18,0x00,0x17,0x8f,0xdf,
+0x04,0x08,0x01,0x00,0x1e,0xaf,0x20,0x02,0x07,0x41,0x05,0x1d,0x90,0x18,0x00,0x12,
+0xef,0xb1,0x03,0x0d,0x18,0x00,0x02,0x12,0x01,0x1d,0x50,0xc8,0x08,0x13,0xff,0x07,
+0x06,0x7a,0x37,0xac,0xef,0xff,0xec,0xa7,0x40,0xcf,0x06,0x33,0xff,0x21,0x8d,0x4b,
+0x01,0x1a,0xa3,0x11,0x09,0x15,0xaf,0x64,0x01,0x2e,0xc3,0x00,0x96,0x07,0x07,0x9b,
+0x00,0x1d,0x09,0x18,0x00,0x3f,0xfc,0x10,0x00,0xaf,0x01,0x03,0x1c,0xd1,0xf7,0x07,
+0x03,0x01,0x00,0x10,0xfd,0x18,0x00,0x0e,0x9b,0x04,0x02,0x15,0x01,0x1e,0x0f,0x18,
+0x00,0x01,0xbd,0x01,0x1e,0x2f,0x18,0x00,0x01,0xf1,0x05,0x04,0x49,0x05,0x44,0xd9,
+0x65,0x45,0x69,0xda,0x02,0x00,0x6e,0x06,0x26,0x29,0xdf,0xe7,0x00,0x14,0x03,0x0b,
+0x03,0x10,0xf0,0x21,0x01,0x5a,0x59,0xdf,0xff,0xff,0xe4,0x0e,0x0a,0x12,0xf6,0x3b,
+0x01,0x3a,0x59,0xdd,0x20,0xdb,0x09,0x0d,0xad,0x03,0x04,0xad,0x02,0x0f,0xa6,0x01,
+0x04,0x15,0xff,0x6f,0x01,0x0a,0x13,0x08,0x0e,0xbf,0x01,0x03,0xcd,0x05,0x1e,0xa0,
+0x0c,0x04,0x04,0x2b,0x08,0x0f,0xbc,0x09,0x02,0x1c,0xe0,0x18,0x00,0x16,0x09,0xd9,
+0x00,0x0e,0xa9,0x00,0x0e,0x18,0x00,0x04,0xd7,0x01,0x1f,0xf1,0x30,0x00,0x04,0x1f,
+0xf1,0x60,0x00,0x15,0x13,0x0a,0x18,0x00,0x03,0xaf,0x01,0x1b,0x60,0xc0,0x00,0x28,
+0xe0,0x0e,0x34,0x02,0x06,0xd7,0x01,0x3a,0xb0,0x0d,0xff,0x17,0x03,0x13,0x5f,0xb1,
+0x01,0x2a,0x0a,0xff,0x77,0x03,0x13,0xbf,0xdf,0x02,0x03,0x36,0x04,0x1a,0xfa,0xc6,
+0x02,0x24,0xff,0x10,0x7e,0x04,0x19,0x50,0x5d,0x0a,0x15,0xfb,0x30,0x0b,0x18,0xf3,
+0x6d,0x03,0x26,0xff,0xf6,0x2f,0x0b,0x11,0x70,0x38,0x0c,0x15,0xff,0x4f,0x01,0x14,
+0x0e,0x4c,0x02,0x47,0x84,0x10,0x02,0x4a,0x40,0x02,0x1f,0x05,0x70,0x02,0x01,0x0f,
+0x57,0x05,0x04,0x1a,0xf5,0x77,0x0b,0x05,0x01,0x00,0x18,0xa0,0xb3,0x00,0x0b,0x00,
+0x03,0x1e,0x00,0x82,0x08,0x13,0xe1,0xe4,0x00,0x1b,0xef,0x2f,0x00,0x13,0x10,0xfd,
+0x00,0x1e,0x1b,0x5e,0x00,0x02,0x01,0x00,0x18,0x5e,0x17,0x00,0x17,0xe5,0xa6,0x01,
+0x16,0x7d,0x17,0x00,0x28,0xe7,0x10,0xbf,0x01,0x14,0x4a,0x64,0x00,0x1b,0xb6,0xd8,
+0x01,0xf0,0x01,0x03,0x79,0xcd,0xef,0xfe,0xdc,0xa7,0x40,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x1a,0x00,0x01,0x00,0x6c,0x01,0x23,0x34,0x41,0x00,0x00,0x15,0x00,
+0x6c,0x58,0xbd,0xff,0xff,0xff,0xf6,0x17,0x00,0x5e,0x28,0xdf,0xff,0xff,0xff,0x18,
+0x00,0x11,0x6c,0x16,0x00,0x0d,0x18,0x00,0x2f,0x6e,0xff,0x18,0x00,0x02,0x2f,0x4d,
+0xff,0x18,0x00,0x02,0x2f,0x09,0xff,0x18,0x00,0x02,0x2f,0x03,0xdf,0x18,0x00,0x03,
+0x2f,0x4f,0xff,0x18,0x00,0x02,0x2f,0x05,0xff,0x18,0x00,0x03,0x1e,0x6f,0x18,0x00,
+0x0d,0x2f,0x00,0x07,0x18,0x00,0x15,0x2f,0x14,0x00,0x37,0xfb,0x85,0x31,0x76,0x00,
+0x05,0x8d,0x00,0x19,0xa4,0xd3,0x00,0x14,0x0a,0x17,0x00,0x1a,0x81,0x02,0x01,0x04,
+0xa5,0x00,0x1b,0xc2,0x31,0x01,0x03,0x47,0x00,0x1b,0xf8,0x17,0x00,0x13,0x07,0x2f,
+0x00,0x1b,0x60,0x18,0x00,0x1e,0x1e,0x5f,0x01,0x01,0x01,0x00,0x12,0x7f,0x18,0x00,
+0x1c,0x90,0x18,0x00,0x11,0xef,0x17,0x00,0x1c,0xfd,0x17,0x00,0x03,0xed,0x00,0x1c,
+0xf3,0x18,0x00,0x12,0x0b,0x18,0x00,0x1c,0xa0,0x18,0x00,0x12,0x1f,0x18,0x00,0x1c,
+0x30,0x18,0x00,0x15,0x6f,0x5f,0x00,0x64,0x26,0x9b,0xde,0xee,0xda,0x84,0x18,0x00,
+0x11,0xaf,0x18,0x00,0x42,0xf7,0x00,0x00,0x7d,0x39,0x00,0x28,0xfa,0x30,0x8f,0x00,
+0x16,0xf3,0x10,0x02,0x20,0xfb,0x20,0x17,0x00,0x12,0x02,0x0d,0x00,0x2b,0xe0,0x2c,
+0x81,0x01,0x12,0x06,0x0c,0x00,0x18,0xc4,0x9a,0x01,0x52,0x80,0x00,0x00,0x00,0x08,
+0x0b,0x00,0x18,0xdf,0x18,0x00,0x16,0xf8,0xbf,0x00,0x0a,0x01,0x00,0x4e,0x70,0x00,
+0x00,0x0d,0x18,0x00,0x01,0xfd,0x00,0x1f,0x0f,0x18,0x00,0x01,0x15,0xfd,0xef,0x00,
+0x0d,0x49,0x00,0x1f,0x2f,0x18,0x00,0x02,0x35,0xf0,0x00,0x3f,0x0c,0x00,0x53,0xa5,
+0x20,0x02,0x49,0xef,0x0c,0x00,0x16,0xf7,0x9a,0x02,0x10,0x91,0xce,0x00,0x15,0x1a,
+0x61,0x00,0x04,0x18,0x00,0x19,0xe4,0xbd,0x01,0x49,0xff,0x30,0x4f,0xff,0x68,0x01,
+0x14,0x08,0xf3,0x00,0x12,0x5f,0x08,0x00,0x1b,0xf5,0x35,0x02,0x13,0xc0,0x18,0x00,
+0x1b,0xb0,0x65,0x02,0x13,0xf0,0x18,0x00,0x14,0x40,0x18,0x00,0x13,0x0d,0xf2,0x00,
+0x0c,0x18,0x00,0x13,0x07,0x6c,0x01,0x1b,0x4f,0x18,0x00,0x13,0x04,0xc1,0x00,0x0c,
+0x18,0x00,0x12,0x00,0x10,0x00,0x2c,0xf9,0x3f,0x18,0x00,0x12,0xef,0xe6,0x01,0x03,
+0x18,0x00,0x1b,0x50,0xde,0x02,0x2c,0xfa,0x1f,0xcd,0x02,0x12,0xdf,0xfd,0x01,0x15,
+0x0f,0xa2,0x01,0x0a,0x30,0x00,0x1c,0x0d,0xce,0x02,0x12,0xef,0x78,0x00,0x13,0x0a,
+0xf8,0x00,0x0b,0x90,0x00,0x24,0xf8,0x07,0x89,0x01,0x0a,0xc0,0x00,0x13,0xf5,0x08,
+0x00,0x1b,0xf4,0xf0,0x00,0x14,0xf3,0xc8,0x00,0x0b,0x20,0x01,0x32,0xf0,0x00,0xbf,
+0x09,0x00,0x1a,0x10,0x50,0x01,0x3a,0xc0,0x00,0x5f,0x91,0x00,0x14,0xdf,0xb8,0x00,
+0x19,0x0e,0x61,0x00,0x04,0xb0,0x01,0x17,0x20,0x0a,0x00,0x07,0x72,0x04,0x48,0xfb,
+0x00,0x00,0x01,0xde,0x02,0x04,0xe7,0x04,0x17,0xf4,0x03,0x02,0x66,0xd7,0x31,0x01,
+0x38,0xef,0xff,0xe7,0x00,0x0e,0xba,0x02,0x02,0x1e,0x02,0x1e,0x03,0x17,0x00,0x19,
+0xf9,0x4c,0x02,0x06,0x01,0x00,0x1c,0xd0,0x54,0x05,0x02,0x01,0x00,0x28,0xfe,0x20,
+0xab,0x03,0x09,0x17,0x03,0x0e,0x31,0x00,0x06,0x2f,0x00,0x0b,0x40,0x05,0x25,0xff,
+0xc1,0x8c,0x01,0x2e,0x02,0xcf,0x70,0x05,0x02,0x6d,0x04,0x16,0xdf,0xa5,0x03,0x18,
+0x10,0x3e,0x04,0x14,0x04,0x7c,0x00,0x2b,0xc7,0x10,0x58,0x04,0x8f,0x47,0xac,0xef,
+0xff,0xed,0xb8,0x51,0x00,0x01,0x00,0x0d,0x0e,0x91,0x03,0x03,0xca,0x01,0x0f,0x19,
+0x00,0xb4,0x1f,0xa0,0x19,0x00,0x05,0x1f,0x30,0x19,0x00,0x04,0x1e,0xfc,0x24,0x01,
+0x1a,0x6f,0x3c,0x04,0x0c,0x1c,0x06,0x2f,0xe0,0x00,0x1d,0x06,0x04,0x1d,0x70,0x19,
+0x00,0x1a,0x0c,0x1e,0x03,0x0c,0xdd,0x06,0x1e,0xf9,0x63,0x00,0x1e,0xbf,0x67,0x06,
+0x02,0xcb,0x07,0x0c,0xc9,0x03,0x0b,0x3f,0x07,0x1f,0x50,0xea,0x01,0x04,0x1e,0xfd,
+0x63,0x00,0x14,0x9f,0x6b,0x06,0x0c,0xb8,0x08,0x02,0x4a,0x00,0x1d,0xf1,0x19,0x00,
+0x1f,0x07,0x2b,0x07,0x04,0x28,0x00,0x0e,0xb4,0x03,0x0e,0x42,0x01,0x1e,0xfb,0x7c,
+0x00,0x1a,0xdf,0x5f,0x04,0x0c,0x42,0x01,0x1e,0xd0,0x42,0x01,0x0e,0xd6,0x07,0x09,
+0x6a,0x04,0x0f,0x42,0x01,0x05,0x0c,0x1f,0x08,0x05,0x33,0x07,0x1e,0xf2,0x42,0x01,
+0x0e,0xc3,0x07,0x09,0xc4,0x07,0x1d,0x40,0x19,0x00,0x1f,0x8f,0x5b,0x01,0x05,0x0e,
+0x6c,0x08,0x09,0x42,0x01,0x1f,0xe0,0x42,0x01,0x05,0x1e,0x80,0x42,0x01,0x0e,0x3a,
+0x02,0x09,0xf1,0x05,0x0d,0x18,0x00,0x1e,0x04,0xa1,0x08,0x09,0x42,0x01,0x0e,0x3a,
+0x02,0x0d,0x7c,0x06,0x0a,0x42,0x01,0x1f,0xfe,0x42,0x01,0x05,0x0e,0x3a,0x02,0x1e,
+0x09,0x3a,0x02,0x09,0x42,0x01,0x1e,0x90,0x42,0x01,0x0e,0x1f,0x09,0x08,0x63,0x03,
+0x1e,0xfc,0x42,0x01,0x0b,0xd1,0x07,0x0c,0x42,0x01,0x0e,0x5b,0x01,0x1f,0x5f,0x95,
+0x03,0x05,0x1e,0xdf,0x5b,0x01,0x08,0x42,0x01,0x0e,0x95,0x03,0x1e,0x0b,0x3a,0x02,
+0x09,0x42,0x01,0x1d,0xb0,0x19,0x00,0x1e,0xaf,0x3a,0x02,0x08,0x42,0x01,0x1e,0xfd,
+0x42,0x01,0x0e,0x3a,0x02,0x09,0x42,0x01,0x1e,0xf0,0x42,0x01,0x0e,0x3a,0x02,0x08,
+0x42,0x01,0x0e,0x95,0x03,0x03,0x1b,0x0a,0x0e,0x95,0x03,0x1b,0x0d,0xf4,0x07,0x0c,
+0x42,0x01,0x0e,0x95,0x03,0x1e,0xcf,0x95,0x03,0x08,0x42,0x01,0x1e,0xfe,0x42,0x01,
+0x0e,0xb4,0x0b,0x09,0x8f,0x06,0x0e,0x3a,0x02,0x21,0x48,0x88,0x01,0x00,0x05,0x63,
+0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x01,0x00,0x99,0x36,0x9b,0xde,0xff,
+0xfe,0xdb,0x96,0x30,0x00,0x01,0x00,0x32,0x4a,0xef,0xff,0x01,0x00,0x27,0xea,0x40,
+0x16,0x00,0x35,0x05,0xdf,0xff,0x01,0x00,0x16,0xd6,0x17,0x00,0x27,0x2c,0xff,0x01,
+0x00,0x15,0xfc,0x4a,0x00,0x29,0x6f,0xff,0x01,0x00,0x13,0x60,0x17,0x00,0x2a,0x8f,
+0xff,0x01,0x00,0x1e,0x90,0x17,0x00,0x07,0x18,0x00,0x1c,0x5f,0x17,0x00,0x02,0x48,
+0x00,0x2d,0x2f,0xff,0x01,0x00,0x5e,0x20,0x00,0x00,0x00,0x0b,0x17,0x00,0x6e,0xfc,
+0x00,0x00,0x00,0x03,0xff,0x01,0x00,0x53,0xf4,0x00,0x00,0x00,0xbf,0x0c,0x00,0x44,
+0xe7,0x31,0x01,0x37,0xf1,0x00,0x48,0xb0,0x00,0x00,0x1f,0x82,0x00,0x13,0x9f,0x0d,
+0x00,0x33,0x10,0x00,0x05,0x0a,0x00,0x18,0x80,0xb0,0x00,0x15,0xf6,0x22,0x00,0x12,
+0xc0,0xc8,0x00,0x12,0xcf,0x0e,0x00,0x32,0xa0,0x00,0x0c,0x09,0x00,0x12,0xf5,0x17,
+0x00,0x12,0x04,0x0e,0x00,0x33,0xfd,0x00,0x00,0x69,0x00,0x03,0x0e,0x01,0x12,0x0e,
+0x0e,0x00,0x35,0xf0,0x00,0x0f,0x7f,0x00,0x01,0x01,0x00,0x13,0xaf,0x26,0x00,0x12,
+0x01,0x08,0x00,0x13,0xf9,0x17,0x00,0x12,0x08,0x0f,0x00,0x14,0xf1,0xa4,0x00,0x13,
+0x80,0x18,0x00,0x14,0x7f,0xa5,0x00,0x02,0x08,0x00,0x13,0xf8,0x17,0x00,0x1b,0x07,
+0x5e,0x00,0x1a,0x90,0x84,0x01,0x04,0xae,0x00,0x13,0xfc,0x17,0x00,0x14,0x0b,0xca,
+0x00,0x14,0x09,0x38,0x00,0x02,0x01,0x00,0x14,0xef,0x84,0x00,0x19,0x4f,0xcb,0x01,
+0x03,0x9c,0x01,0x14,0x40,0x21,0x00,0x12,0xfd,0x17,0x00,0x12,0x0d,0x17,0x00,0x15,
+0xe0,0xae,0x00,0x18,0xfa,0xbb,0x00,0x16,0xf8,0xf5,0x00,0x01,0x18,0x00,0x03,0x6b,
+0x00,0x17,0xfe,0x51,0x00,0x53,0xfe,0x83,0x10,0x13,0x7e,0x6d,0x01,0x18,0x50,0x84,
+0x01,0x0c,0x1d,0x02,0x1c,0xbf,0x17,0x00,0x03,0x3e,0x01,0x1e,0xbf,0x17,0x00,0x0e,
+0x64,0x02,0x06,0x3d,0x01,0x28,0x00,0x4d,0x16,0x00,0x16,0xfd,0xf2,0x02,0x09,0x7d,
+0x02,0x14,0x50,0x16,0x00,0x29,0x02,0xcf,0x46,0x00,0x13,0xb2,0x17,0x00,0x1b,0x06,
+0x75,0x00,0x03,0xf9,0x01,0x1c,0x09,0xa4,0x00,0x1e,0xf8,0x17,0x00,0x06,0xe3,0x01,
+0x1e,0x07,0xa9,0x02,0x16,0xf7,0x3e,0x02,0x67,0xff,0xfc,0x62,0x10,0x13,0x7c,0xc1,
+0x02,0x03,0x4c,0x02,0x11,0xd4,0x62,0x02,0x15,0xef,0x78,0x01,0x03,0xe8,0x00,0x11,
+0xc1,0x6a,0x00,0x24,0x01,0xcf,0xee,0x00,0x03,0x05,0x02,0x22,0xe1,0x00,0x18,0x00,
+0x13,0xef,0x34,0x02,0x19,0x06,0xb0,0x00,0x24,0x00,0x05,0xd9,0x02,0x18,0xcf,0xd5,
+0x01,0x05,0xd7,0x01,0x2b,0xc0,0x0f,0x3d,0x01,0x03,0x6d,0x00,0x16,0x03,0x96,0x00,
+0x08,0xf1,0x02,0x24,0xf3,0x6f,0x9a,0x02,0x03,0x01,0x00,0x03,0xba,0x03,0x1a,0x67,
+0x62,0x02,0x23,0x00,0x00,0xed,0x00,0x19,0x8f,0x1e,0x03,0x14,0x00,0xb4,0x00,0x14,
+0x88,0xf8,0x02,0x13,0x00,0xbd,0x00,0x03,0x4c,0x01,0x03,0xf8,0x02,0x05,0x74,0x04,
+0x12,0x3f,0x10,0x00,0x16,0x86,0x3b,0x01,0x08,0x08,0x03,0x13,0xf7,0xc0,0x02,0x39,
+0xd0,0x00,0x00,0xad,0x03,0x25,0x52,0xff,0xca,0x02,0x08,0x46,0x00,0x23,0xf2,0x0e,
+0x90,0x02,0x19,0x10,0x02,0x01,0x14,0xfe,0x9d,0x03,0x03,0x37,0x03,0x23,0x0a,0xff,
+0xf3,0x03,0x14,0x04,0x42,0x02,0x18,0x30,0x16,0x05,0x34,0xf5,0x00,0x0d,0xcb,0x01,
+0x65,0xb6,0x21,0x00,0x26,0xaf,0xff,0xf1,0x02,0x0b,0x21,0x05,0x02,0x01,0x00,0x15,
+0x70,0x96,0x00,0x09,0x01,0x00,0x1f,0xd0,0xc6,0x04,0x03,0x1e,0xf3,0x79,0x02,0x05,
+0xf9,0x00,0x1e,0x07,0x63,0x02,0x08,0x0d,0x01,0x0c,0x92,0x02,0x05,0x41,0x02,0x0b,
+0xc1,0x02,0x2a,0x00,0x01,0x7f,0x03,0x15,0xb1,0x9c,0x01,0x17,0x2a,0x16,0x00,0x17,
+0xfb,0x41,0x06,0x25,0x01,0x7c,0x4c,0x03,0x19,0x82,0x56,0x06,0xab,0x01,0x47,0xac,
+0xdf,0xff,0xff,0xec,0xa8,0x51,0x00,0x01,0x00,0x7b,0x15,0x8b,0xde,0xff,0xed,0xb8,
+0x41,0x16,0x00,0x23,0x17,0xcf,0x5c,0x00,0x19,0x50,0x45,0x00,0x06,0xc6,0x03,0x17,
+0xe5,0x17,0x00,0x18,0x06,0xc3,0x03,0x06,0x8d,0x00,0x1f,0x1b,0x84,0x06,0x02,0x2f,
+0x00,0x2d,0x84,0x06,0x02,0x2f,0x00,0x2e,0x9c,0x06,0x03,0x1c,0x1e,0x32,0x01,0x02,
+0xfd,0x02,0x1d,0x0c,0x61,0x01,0x1e,0x40,0xdb,0x03,0x05,0x41,0x02,0x0e,0xbf,0x01,
+0x02,0x01,0x05,0x04,0xee,0x01,0x53,0xc6,0x20,0x13,0x7d,0xff,0x79,0x02,0x15,0x00,
+0x6b,0x05,0x01,0xb3,0x00,0x16,0x07,0xc8,0x04,0x18,0x0b,0x6a,0x00,0x04,0x71,0x02,
+0x15,0x30,0x5d,0x00,0x18,0x60,0x0c,0x01,0x15,0xf9,0x9d,0x03,0x19,0xb0,0xe0,0x05,
+0x14,0xe0,0x92,0x02,0x1a,0xf2,0xf0,0x02,0x23,0x50,0x02,0x70,0x01,0x0a,0x1f,0x03,
+0x14,0xf9,0x08,0x05,0x1a,0x50,0x4e,0x03,0x15,0xe0,0x8d,0x06,0x0a,0xdb,0x03,0x26,
+0x20,0xbf,0xd2,0x05,0x07,0xdb,0x03,0x2a,0xf5,0x0d,0x8d,0x05,0x04,0x3f,0x01,0x27,
+0x80,0xdf,0x25,0x06,0x06,0xfb,0x06,0x2a,0xfa,0x0e,0x9b,0x01,0x04,0x57,0x01,0x1a,
+0xc0,0xe2,0x06,0x04,0xe3,0x00,0x1c,0xfe,0x2f,0x00,0x04,0xfb,0x06,0x1b,0xef,0x5e,
+0x00,0x03,0x32,0x04,0x1b,0x0d,0x0a,0x04,0x04,0x2f,0x00,0x03,0x3b,0x06,0x0c,0x2f,
+0x00,0x1b,0x19,0xde,0x04,0x13,0x07,0xfb,0x00,0x1b,0x6f,0x76,0x00,0x03,0x2f,0x00,
+0x15,0x13,0x35,0x08,0x09,0x23,0x04,0x2a,0xf1,0x0f,0xbd,0x00,0x04,0xc0,0x01,0x04,
+0xb1,0x06,0x13,0xf3,0x61,0x06,0x13,0xef,0x8d,0x00,0x04,0x72,0x08,0x11,0xe2,0x17,
+0x00,0x24,0x03,0xef,0x2f,0x00,0x18,0x0f,0x00,0x03,0x05,0xf9,0x02,0x37,0xf0,0x00,
+0x8f,0x27,0x06,0x04,0x4c,0x02,0x06,0x44,0x08,0x0b,0x01,0x00,0x1e,0xe0,0x6d,0x06,
+0x03,0xd5,0x04,0x0e,0xd8,0x02,0x02,0xb7,0x01,0x0c,0x1e,0x03,0x04,0x53,0x04,0x1f,
+0x4f,0xc7,0x04,0x03,0x09,0x18,0x00,0x26,0xfd,0xdf,0x41,0x01,0x17,0x3e,0x6e,0x00,
+0x17,0x1d,0x29,0x01,0x17,0x1a,0x92,0x04,0x05,0xcc,0x06,0x00,0xf9,0x00,0x04,0xd0,
+0x07,0x39,0xa2,0x00,0x2f,0xa1,0x02,0x11,0x27,0xa1,0x02,0x24,0xd8,0x20,0x04,0x01,
+0x15,0x70,0xa3,0x07,0x45,0x46,0x66,0x53,0x10,0x09,0x08,0x1c,0xf2,0x6f,0x04,0x1b,
+0x1f,0xa1,0x02,0x0a,0x5d,0x09,0x05,0xda,0x06,0x0a,0x6c,0x06,0x0d,0x46,0x00,0x19,
+0x9f,0x3c,0x09,0x0c,0x35,0x08,0x1b,0x50,0x17,0x00,0x1b,0x3f,0x71,0x02,0x0a,0x2e,
+0x00,0x1f,0xf6,0x5c,0x00,0x02,0x0c,0x5d,0x00,0x25,0x07,0xef,0xf1,0x03,0x08,0x3d,
+0x05,0x1c,0xaf,0xc7,0x04,0x56,0x00,0x57,0x77,0x88,0xab,0xce,0x05,0x1b,0xc0,0x72,
+0x03,0x09,0x56,0x02,0x08,0x83,0x04,0x0a,0xe4,0x02,0x2e,0x00,0x0c,0x17,0x00,0x0d,
+0x2f,0x00,0x07,0x17,0x00,0x1e,0x0c,0x5c,0x00,0x0c,0x2f,0x00,0x06,0x3c,0x06,0x08,
+0x2f,0x00,0x19,0xfe,0x2c,0x01,0x05,0x2f,0x00,0x19,0xe7,0xfc,0x00,0x14,0x0c,0x49,
+0x02,0x1a,0x70,0x14,0x01,0x03,0xc2,0x0a,0x0a,0x69,0x06,0x01,0x2f,0x00,0x1d,0xee,
+0xd6,0x0c,0x40,0x17,0xce,0xfe,0xc7,0x17,0x02,0x13,0x5e,0xa1,0x01,0x13,0x6f,0x34,
+0x05,0x04,0xb9,0x04,0x14,0x09,0x97,0x05,0x04,0x81,0x03,0x04,0x0a,0x0c,0x14,0x11,
+0x99,0x05,0x14,0x0f,0xd9,0x03,0x13,0xdf,0xcf,0x01,0x14,0x07,0x71,0x07,0x14,0x0d,
+0x2e,0x09,0x11,0x1d,0x08,0x00,0x12,0x20,0xb1,0x04,0x11,0xf9,0xd9,0x02,0x4f,0x47,
+0x87,0x40,0x00,0x01,0x00,0xb5,0x03,0xcc,0x00,0x13,0x08,0xc7,0x04,0x02,0xee,0x00,
+0x13,0x10,0x9f,0x01,0x14,0xfd,0x8a,0x03,0x14,0xf7,0xc7,0x01,0x2c,0xd0,0x0f,0x43,
+0x01,0x14,0x1f,0x43,0x01,0x04,0x65,0x01,0x14,0x0a,0x76,0x06,0x14,0x2f,0xdd,0x02,
+0x14,0x6f,0xce,0x03,0x14,0x5f,0xd4,0x06,0x70,0x17,0xce,0xfe,0xc7,0x10,0x00,0x00,
+0x80,0x00,0x00,0x00,0x00,0x36,0x87,0x51,0x00,0x01,0x00,0xf1,0x05,0x06,0xef,0xff,
+0xff,0xfa,0x10,0x00,0x00,0x00,0x0b,0xff,0xff,0xff,0xff,0xfe,0x30,0x00,0x00,0x09,
+0xff,0x0a,0x00,0x41,0x20,0x00,0x03,0xff,0x01,0x00,0x42,0xfa,0x00,0x00,0x9f,0x0a,
+0x00,0x42,0xf0,0x00,0x0d,0xff,0x01,0x00,0x32,0x40,0x00,0xef,0x09,0x00,0x33,0xf5,
+0x00,0x0e,0x13,0x00,0x32,0x50,0x00,0xbf,0x09,0x00,0x42,0xf3,0x00,0x07,0xff,0x43,
+0x00,0x14,0x00,0x1d,0x00,0x41,0x60,0x00,0x00,0x3f,0x09,0x00,0x50,0xa0,0x00,0x00,
+0x00,0x3e,0x09,0x00,0x11,0x80,0x7c,0x00,0x5f,0xbe,0xff,0xd9,0x20,0x00,0x01,0x00,
+0xe7,0x20,0x38,0x88,0x01,0x00,0x00,0x09,0x01,0x03,0x5f,0x01,0x31,0x00,0x00,0x6f,
+0x0a,0x00,0x0f,0x13,0x00,0x3c,0x02,0x90,0x01,0x50,0xd0,0x00,0x00,0x00,0x8f,0x09,
+0x00,0x24,0xfc,0x00,0xe5,0x01,0x50,0x90,0x00,0x00,0x00,0xcf,0x09,0x00,0x51,0xf6,
+0x00,0x00,0x00,0x0f,0x13,0x00,0x23,0x30,0x00,0xf8,0x01,0x14,0xe0,0x2f,0x00,0x5a,
+0xf9,0x00,0x00,0x00,0x0d,0x1c,0x00,0x52,0xc0,0x00,0x00,0x00,0xaf,0xff,0x01,0x30,
+0x00,0x00,0x2f,0x09,0x00,0x53,0xfd,0x00,0x00,0x00,0x0a,0x1b,0x02,0x25,0x00,0x02,
+0xec,0x01,0x01,0x13,0x02,0x14,0xe1,0x25,0x00,0x10,0xf5,0xf5,0x00,0x51,0x19,0xff,
+0xff,0xff,0xf7,0xff,0x00,0x43,0x01,0x9f,0xff,0xf9,0x0a,0x01,0x24,0x2a,0xf9,0x14,
+0x01,0x1f,0x02,0x42,0x01,0x1a,0x2e,0x01,0x7c,0x14,0x00,0x3c,0x29,0xff,0xe0,0x13,
+0x00,0x4c,0x05,0xbf,0xff,0xfe,0x3a,0x00,0x3c,0x7e,0xff,0xff,0x29,0x00,0x13,0x39,
+0xb6,0x02,0x08,0x3a,0x00,0x15,0xcf,0x0d,0x01,0x09,0x3a,0x00,0x0b,0x29,0x00,0x23,
+0x3a,0xff,0x01,0x00,0x1c,0xe0,0x3a,0x00,0x08,0x29,0x00,0x04,0x3a,0x00,0x08,0x29,
+0x00,0x05,0x3a,0x00,0x06,0x29,0x00,0x06,0x3a,0x00,0x05,0x29,0x00,0x4c,0x01,0x8e,
+0xff,0xff,0x29,0x00,0x08,0x3a,0x00,0x00,0xa7,0x03,0x1c,0x40,0x3a,0x00,0x3d,0xff,
+0xfc,0x61,0x3a,0x00,0x2d,0xfd,0x72,0x3a,0x00,0x35,0xfe,0x93,0x00,0x2d,0x02,0x04,
+0x01,0x00,0x11,0xa4,0x89,0x00,0x18,0x07,0x13,0x00,0x13,0xb6,0xb1,0x00,0x16,0x7f,
+0x13,0x00,0x10,0xd7,0x38,0x04,0x0a,0x29,0x00,0x25,0xe8,0x30,0x01,0x01,0x17,0x7f,
+0x99,0x00,0x1a,0x00,0x29,0x00,0x28,0xfc,0x50,0x64,0x01,0x13,0x7f,0x28,0x00,0x08,
+0x15,0x00,0x05,0x52,0x00,0x2d,0xf9,0x40,0x29,0x00,0x09,0x67,0x00,0x08,0xa4,0x00,
+0x2e,0xd7,0x20,0xa4,0x00,0x32,0xff,0xff,0xc6,0xa6,0x00,0x29,0x03,0xbf,0xe2,0x00,
+0x14,0xb5,0x2d,0x02,0x1e,0xff,0xf8,0x00,0x3e,0x00,0x6d,0xff,0x21,0x01,0x3a,0x00,
+0x04,0xbf,0x4a,0x01,0x1f,0x82,0x41,0x00,0x01,0x1e,0xfb,0x41,0x00,0x05,0xec,0x01,
+0x09,0x41,0x00,0x05,0x15,0x02,0x2e,0x28,0xef,0x15,0x02,0x08,0x41,0x00,0x07,0x67,
+0x02,0x2e,0x04,0xbf,0x29,0x00,0x06,0x41,0x00,0x0a,0xb9,0x02,0x1d,0x6d,0x29,0x00,
+0x00,0x04,0x01,0x01,0xb5,0x03,0x0c,0x0b,0x03,0x10,0x18,0x41,0x00,0x0d,0x34,0x03,
+0x1e,0x6c,0x29,0x00,0x01,0x41,0x00,0x1e,0xe0,0x72,0x03,0x2f,0x18,0xee,0x9c,0x03,
+0x01,0x11,0x40,0x6d,0x00,0x0c,0x01,0x00,0x1f,0x4a,0x15,0x00,0x01,0x1f,0xf4,0x2b,
+0x00,0xae,0x3e,0x41,0x22,0x22,0x01,0x00,0x0f,0xdc,0x06,0x9a,0x1f,0x12,0xc2,0x00,
+0x01,0x1f,0x0a,0xae,0x01,0xc3,0x0f,0x2b,0x00,0x03,0x3e,0x5a,0x30,0x00,0x01,0x00,
+0x1a,0x6f,0xac,0x04,0x03,0x15,0x00,0x3e,0xff,0xfe,0x81,0x15,0x00,0x06,0x40,0x04,
+0x0a,0x15,0x00,0x2e,0xff,0xd6,0x15,0x00,0x00,0xda,0x04,0x1d,0x20,0x15,0x00,0x00,
+0x41,0x04,0x1d,0x40,0x15,0x00,0x00,0x6d,0x04,0x1d,0x71,0x15,0x00,0x00,0x01,0x00,
+0x1f,0x93,0x15,0x00,0x01,0x2e,0xff,0xc5,0x15,0x00,0x00,0x33,0x05,0x1d,0x10,0x15,
+0x00,0x00,0x75,0x05,0x1d,0x30,0x15,0x00,0x00,0x6f,0x00,0x11,0x60,0x15,0x00,0x2a,
+0x16,0xcf,0x08,0x05,0x12,0x82,0xa2,0x07,0x1a,0x7d,0x38,0x01,0x13,0xb4,0xcd,0x08,
+0x07,0xc8,0x04,0x06,0x1c,0x06,0x29,0x04,0x9e,0x16,0x00,0x04,0xf4,0x00,0x0a,0x81,
+0x01,0x16,0xf6,0xa7,0x07,0x06,0x01,0x00,0x15,0xf7,0x36,0x07,0x1d,0x6c,0x15,0x00,
+0x00,0x01,0x00,0x2d,0x17,0xdf,0x15,0x00,0x00,0x9d,0x00,0x1d,0x8d,0x15,0x00,0x00,
+0x01,0x00,0x2e,0x3b,0xff,0x15,0x00,0x2e,0x17,0xcf,0x15,0x00,0x1e,0x6b,0x54,0x00,
+0x2e,0x05,0xaf,0x7e,0x00,0x2d,0x39,0xef,0x93,0x00,0x19,0x02,0x68,0x07,0x1b,0xf7,
+0xa3,0x00,0x01,0x01,0x00,0x19,0xb2,0x62,0x00,0x02,0x01,0x00,0x1a,0x92,0x62,0x00,
+0x05,0x7d,0x01,0x2d,0x39,0xef,0xdd,0x07,0x02,0x39,0x0b,0x0c,0xd1,0x01,0x0a,0xb9,
+0x01,0x2e,0xc5,0x00,0xce,0x01,0x1e,0xa3,0xf8,0x01,0x2e,0xfe,0x71,0x22,0x02,0x2e,
+0xfc,0x50,0x37,0x02,0x08,0xa3,0x02,0x1c,0x6f,0xf5,0x07,0x07,0x15,0x00,0x1e,0xb4,
+0xca,0x02,0x2e,0xfe,0x82,0xf4,0x02,0x2e,0xfd,0x60,0x09,0x03,0x2e,0xfa,0x40,0x33,
+0x03,0x2e,0xe8,0x10,0x5d,0x03,0x2e,0xc5,0x00,0x01,0x00,0x1b,0x33,0x10,0x00,0x50,
+0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x3b,0x11,0x10,0x00,0x01,0x00,0x88,
+0x15,0x9c,0xef,0xff,0xff,0xff,0xec,0x95,0x19,0x00,0x33,0x16,0xcf,0xff,0x01,0x00,
+0x16,0xd7,0x17,0x00,0x26,0x8f,0xff,0x01,0x00,0x13,0x91,0x14,0x00,0x37,0x04,0xef,
+0xff,0x01,0x00,0x12,0xe5,0x15,0x00,0x29,0x08,0xff,0x01,0x00,0x11,0xf9,0x15,0x00,
+0x2a,0x0a,0xff,0x01,0x00,0x10,0xfa,0x15,0x00,0x3e,0x09,0xff,0xff,0x2c,0x00,0x2c,
+0x06,0xff,0x01,0x00,0x5d,0xf5,0x00,0x00,0x01,0xff,0x01,0x00,0x4e,0xe0,0x00,0x00,
+0xaf,0x16,0x00,0x3e,0x70,0x00,0x2f,0x15,0x00,0x15,0xfe,0x6a,0x00,0x53,0xfe,0x73,
+0x10,0x13,0x7e,0x0c,0x00,0x37,0xf4,0x00,0xef,0xa2,0x00,0x04,0xa1,0x00,0x28,0x90,
+0x3f,0xb7,0x00,0x12,0x0b,0x0d,0x00,0x23,0xfd,0x06,0x08,0x00,0x02,0xe2,0x00,0x03,
+0x63,0x00,0x22,0xf0,0x9f,0x08,0x00,0x12,0x60,0x16,0x00,0x12,0xbf,0x0e,0x00,0x12,
+0x2b,0x07,0x00,0x12,0xf1,0x15,0x00,0x13,0x07,0x6c,0x00,0x18,0xdf,0x40,0x00,0x22,
+0x00,0x5f,0x16,0x00,0x12,0x4d,0x07,0x00,0x13,0xc0,0x4d,0x01,0x03,0xee,0x00,0x20,
+0x01,0x11,0x01,0x00,0x04,0x79,0x01,0x12,0x4f,0x16,0x00,0x19,0x40,0xb5,0x01,0x03,
+0x8f,0x00,0x1a,0xf3,0xcb,0x01,0x03,0x8f,0x00,0x0a,0x15,0x00,0x12,0x0e,0x15,0x00,
+0x1f,0xd0,0x40,0x00,0x01,0x19,0xf8,0x15,0x00,0x13,0x01,0x0f,0x01,0x19,0x20,0x16,
+0x00,0x03,0xd6,0x00,0x1e,0xb0,0x6a,0x00,0x0c,0x80,0x00,0x17,0x8f,0xda,0x01,0x0c,
+0x15,0x00,0x3e,0xfe,0x10,0x00,0x3f,0x00,0x28,0xff,0x30,0x15,0x00,0x29,0xaf,0xff,
+0x4e,0x01,0x0a,0x15,0x00,0x1f,0x80,0x15,0x00,0x01,0x18,0x90,0x15,0x00,0x1f,0x7f,
+0x15,0x00,0x01,0x1f,0x3f,0x15,0x00,0x01,0x1e,0x0d,0x54,0x00,0x05,0xa8,0x01,0x0a,
+0x15,0x00,0x04,0x21,0x02,0x19,0x70,0x15,0x00,0x1e,0x5f,0x54,0x00,0x05,0x3f,0x02,
+0x1a,0xc0,0x7d,0x01,0x02,0x15,0x00,0x1a,0xf2,0x15,0x00,0x17,0x2f,0x60,0x02,0x05,
+0x01,0x00,0x1e,0x05,0x12,0x01,0x05,0xd5,0x00,0x1a,0xd0,0x15,0x00,0x1e,0x08,0x67,
+0x01,0x05,0x15,0x01,0x0a,0xaa,0x00,0x03,0x96,0x00,0x1b,0xf6,0x2b,0x00,0x02,0xd3,
+0x01,0x1a,0x50,0x15,0x00,0x20,0x04,0x55,0x01,0x00,0x2f,0x51,0x00,0x01,0x00,0x7e,
+0x3d,0x35,0x65,0x30,0x14,0x00,0x5c,0x06,0xef,0xff,0xff,0xe6,0x15,0x00,0x01,0xac,
+0x03,0x1e,0xfb,0x15,0x00,0x0e,0x2d,0x01,0x14,0x05,0x01,0x04,0x0f,0xea,0x02,0x0f,
+0x2e,0x0f,0xff,0x55,0x03,0x05,0x8e,0x04,0x1f,0xf0,0x2b,0x00,0x0f,0x04,0x43,0x02,
+0x19,0xe0,0x15,0x00,0x18,0x09,0x64,0x04,0x0b,0x19,0x02,0x0b,0x80,0x03,0x2e,0x00,
+0x6f,0x16,0x03,0x04,0x16,0x00,0x1c,0x60,0x03,0x01,0xe0,0x18,0xce,0xfe,0xc7,0x10,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0xbf,0x01,0x47,
+0x9b,0xde,0xff,0xff,0xee,0xcb,0x97,0x41,0x00,0x01,0x00,0x09,0x34,0x5a,0xdf,0xff,
+0x01,0x00,0x2f,0xea,0x61,0x26,0x00,0x06,0x38,0x04,0xbf,0xff,0x01,0x00,0x1f,0xb6,
+0x27,0x00,0x04,0x3a,0x07,0xef,0xff,0x01,0x00,0x2f,0xe8,0x10,0x27,0x00,0x12,0x4e,
+0xff,0xff,0xf8,0x00,0x01,0x00,0x3e,0x05,0xef,0xff,0x01,0x00,0x2d,0xe5,0x00,0xe9,
+0x00,0x0a,0x9c,0x00,0x04,0x01,0x00,0x1c,0xa1,0x28,0x00,0x15,0x4e,0x1b,0x00,0x45,
+0xec,0xbb,0xbb,0xcd,0x0d,0x00,0x2a,0xfd,0x30,0x27,0x00,0x14,0x08,0x18,0x00,0x12,
+0x96,0x19,0x00,0x23,0x25,0x9d,0x11,0x00,0x1a,0xf4,0x28,0x00,0x13,0xaf,0xe2,0x00,
+0x06,0x3f,0x00,0x22,0x17,0xcf,0x13,0x00,0x18,0x50,0x27,0x00,0x12,0x0c,0x14,0x00,
+0x18,0xd6,0x14,0x00,0x12,0x03,0x3c,0x00,0x18,0xf5,0x14,0x00,0x02,0x3c,0x00,0x1a,
+0xe6,0x64,0x00,0x12,0x02,0x16,0x00,0x16,0x40,0x12,0x00,0x11,0x0b,0x11,0x00,0x1c,
+0xfa,0x57,0x01,0x11,0x06,0x17,0x00,0x16,0xe2,0x11,0x00,0x11,0x9f,0x11,0x00,0x1d,
+0x70,0x2d,0x01,0x10,0x3e,0x17,0x00,0x16,0xfc,0x8a,0x01,0x01,0x27,0x00,0x2e,0xe3,
+0x00,0x55,0x01,0x19,0xdf,0x40,0x00,0x10,0x3f,0x0e,0x00,0x3e,0xfe,0x20,0x00,0x01,
+0x00,0x10,0x1d,0x1a,0x00,0x14,0xf2,0x36,0x00,0x1b,0xef,0x87,0x00,0x07,0x51,0x00,
+0x00,0x1b,0x00,0x13,0xfb,0x0d,0x00,0x1e,0x09,0x4f,0x00,0x05,0x01,0x00,0x17,0x4f,
+0xf2,0x00,0x01,0x0c,0x00,0x1e,0xf3,0x6c,0x02,0x05,0xa8,0x01,0x12,0xc0,0x0c,0x00,
+0x1f,0xdf,0xed,0x00,0x03,0x06,0x1d,0x00,0x16,0xf4,0x26,0x01,0x16,0xfb,0x1a,0x00,
+0x64,0x48,0xcd,0xff,0xed,0xc9,0x63,0x0e,0x00,0x10,0x5f,0x59,0x01,0x01,0x0a,0x00,
+0x10,0x0e,0x28,0x00,0x15,0xf1,0x85,0x01,0x12,0x8e,0xc3,0x01,0x27,0xd7,0x10,0xd2,
+0x01,0x01,0x0c,0x00,0x19,0x7f,0x77,0x00,0x1b,0x8f,0xcc,0x02,0x15,0x05,0x1e,0x00,
+0x10,0xef,0xee,0x00,0x09,0x82,0x01,0x09,0xcc,0x02,0x13,0xef,0xc9,0x00,0x18,0x06,
+0x15,0x02,0x1e,0x06,0xcc,0x02,0x13,0x8f,0x96,0x00,0x10,0x0d,0x13,0x00,0x1c,0xd0,
+0x76,0x00,0x00,0x01,0x00,0x15,0xf9,0xad,0x01,0x14,0xf6,0xb5,0x01,0x18,0x60,0xe9,
+0x01,0x0a,0xa2,0x00,0x13,0x0e,0xf1,0x00,0x01,0x2c,0x02,0x07,0x05,0x01,0x06,0x01,
+0x00,0x15,0xf7,0xae,0x01,0x13,0xfe,0xa8,0x00,0x13,0xf9,0x14,0x01,0x03,0x32,0x04,
+0x36,0x75,0x56,0x9d,0xb5,0x00,0x12,0x06,0x19,0x01,0x17,0x04,0x12,0x02,0x15,0x0c,
+0xd6,0x02,0x16,0x03,0x43,0x03,0x12,0x02,0xe2,0x01,0x17,0x09,0xc7,0x00,0x11,0x6f,
+0x97,0x02,0x00,0x55,0x01,0x08,0x3e,0x00,0x02,0xc0,0x00,0x01,0xef,0x00,0x17,0x80,
+0x60,0x02,0x15,0xc0,0x5e,0x01,0x16,0xf1,0xe2,0x01,0x36,0x90,0x00,0x2f,0x39,0x02,
+0x11,0x08,0x60,0x02,0x15,0x10,0xf9,0x00,0x12,0xf0,0x28,0x00,0x00,0x29,0x04,0x36,
+0xb0,0x00,0x6f,0xef,0x00,0x23,0x1f,0xff,0x2b,0x01,0x03,0x33,0x00,0x16,0xe0,0x3d,
+0x03,0x36,0xc0,0x00,0x9f,0x2d,0x02,0x16,0x7f,0xab,0x00,0x17,0x0a,0xb6,0x00,0x11,
+0x7f,0x0b,0x00,0x15,0xdf,0x29,0x01,0x26,0x00,0xef,0x72,0x01,0x01,0xa9,0x03,0x16,
+0xb0,0x28,0x00,0x26,0xf0,0x00,0x01,0x01,0x26,0x04,0xff,0x83,0x00,0x01,0xde,0x00,
+0x16,0xa0,0x06,0x01,0x26,0xf0,0x02,0xd9,0x00,0x25,0x09,0xff,0x93,0x02,0x02,0x94,
+0x02,0x16,0x90,0xa5,0x01,0x26,0xf0,0x05,0xb1,0x00,0x17,0x0e,0x39,0x02,0x17,0x0f,
+0x94,0x02,0x01,0x28,0x00,0x16,0x07,0x28,0x03,0x17,0x3f,0x0c,0x01,0x17,0x1f,0x1d,
+0x02,0x01,0x28,0x00,0x16,0x09,0x89,0x00,0x17,0x7f,0x5b,0x03,0x07,0x56,0x01,0x02,
+0xa0,0x00,0x16,0x0a,0x89,0x00,0x17,0xbf,0x94,0x00,0x01,0xab,0x03,0x17,0x30,0x28,
+0x00,0x16,0x0c,0x89,0x00,0x1b,0xef,0x6c,0x00,0x26,0xff,0x20,0x18,0x01,0x25,0xe0,
+0x0d,0x1d,0x00,0x2b,0x01,0xff,0x44,0x00,0x17,0xff,0xe4,0x02,0x25,0xd0,0x0e,0x89,
+0x00,0x25,0x03,0xff,0x82,0x03,0x03,0x00,0x03,0x07,0x93,0x05,0x16,0xc0,0x28,0x00,
+0x02,0x43,0x03,0x07,0x11,0x05,0x26,0xfd,0x00,0x08,0x02,0x25,0x90,0x0f,0x6d,0x00,
+0x2b,0x08,0xff,0x1c,0x00,0x17,0xfc,0x3a,0x04,0x16,0x70,0x28,0x00,0x18,0x09,0x28,
+0x00,0x17,0xcf,0x4b,0x04,0x01,0xf5,0x05,0x06,0x28,0x00,0x18,0x0a,0x64,0x05,0x07,
+0x35,0x03,0x11,0x03,0xfb,0x00,0x06,0x28,0x00,0x18,0x0b,0x28,0x00,0x07,0x39,0x04,
+0x11,0x07,0xb7,0x00,0x06,0xc8,0x00,0x18,0x0b,0x78,0x00,0x06,0xb2,0x02,0x21,0x00,
+0x0c,0x83,0x00,0x15,0x0e,0x73,0x06,0x17,0x0a,0x28,0x00,0x17,0x04,0x13,0x02,0x11,
+0x1f,0x33,0x00,0x06,0x68,0x01,0x17,0x09,0x18,0x01,0x17,0x0a,0xda,0x06,0x11,0x6f,
+0x7a,0x03,0x15,0x0b,0xb8,0x01,0x17,0x08,0x90,0x01,0x17,0x2f,0x97,0x03,0x02,0xb0,
+0x04,0x06,0x08,0x02,0x17,0x06,0x6c,0x06,0x16,0xaf,0x28,0x00,0x12,0x06,0x71,0x00,
+0x15,0x08,0x09,0x03,0x02,0xb8,0x01,0x16,0xd0,0x02,0x03,0x15,0xf3,0xbe,0x02,0x13,
+0xfe,0x2f,0x00,0x15,0xe0,0xe4,0x00,0x02,0xe5,0x00,0x17,0x2e,0x87,0x04,0x12,0x9f,
+0x22,0x01,0x16,0x04,0x20,0x03,0x14,0xaf,0x1e,0x07,0x22,0x03,0xef,0xb3,0x07,0x05,
+0x3e,0x01,0x13,0xe0,0x4e,0x02,0x17,0xf4,0xd5,0x04,0x32,0xf9,0x30,0x03,0x16,0x07,
+0x02,0xac,0x00,0x14,0x8f,0x10,0x01,0x19,0xef,0x11,0x05,0x09,0x01,0x00,0x45,0xfa,
+0x31,0x02,0x6d,0x34,0x06,0x15,0xbf,0x5e,0x01,0x0a,0x4d,0x05,0x07,0x01,0x00,0x15,
+0xe1,0x3e,0x03,0x16,0x20,0x98,0x06,0x02,0x01,0x00,0x18,0x98,0x28,0x00,0x2a,0x30,
+0x00,0x9f,0x05,0x15,0x3f,0x1a,0x00,0x27,0xfc,0x00,0xf5,0x08,0x16,0xf5,0x96,0x00,
+0x1b,0xd0,0x15,0x06,0x17,0xc0,0x34,0x00,0x26,0xfe,0x40,0x2e,0x04,0x17,0xf4,0xb1,
+0x04,0x02,0xb9,0x00,0x15,0x04,0x28,0x00,0x17,0xc2,0x1b,0x02,0x13,0xfa,0x0c,0x00,
+0x12,0xef,0x42,0x00,0x00,0x87,0x00,0x3a,0x2c,0xff,0xff,0x84,0x08,0x17,0xdf,0x8f,
+0x03,0x01,0xb3,0x09,0x12,0xfd,0xe4,0x01,0x11,0x5c,0x27,0x00,0x15,0xb5,0x47,0x07,
+0x08,0x2f,0x04,0x54,0x00,0x02,0x68,0x98,0x75,0xd9,0x07,0x47,0x14,0x78,0x98,0x75,
+0x5e,0x09,0x07,0x6e,0x05,0x0f,0x01,0x00,0x0a,0x02,0xa0,0x02,0x0e,0x1e,0x08,0x0d,
+0x53,0x08,0x03,0x0a,0x01,0x0f,0x01,0x00,0x0e,0x1b,0x8f,0xf8,0x07,0x0f,0x01,0x00,
+0x05,0x02,0x00,0x02,0x1f,0xa0,0x28,0x00,0x0e,0x2f,0x04,0xff,0x51,0x00,0x14,0x02,
+0x70,0x02,0x1f,0xd2,0x28,0x00,0x0e,0x16,0x0c,0x97,0x02,0x0f,0xf2,0x00,0x0b,0x03,
+0xe8,0x02,0x1a,0x50,0x17,0x00,0x1d,0x30,0x29,0x00,0x13,0x2e,0xc4,0x0a,0x18,0x61,
+0x76,0x0a,0x2d,0x9f,0xd0,0x28,0x00,0x24,0x03,0xef,0xd2,0x0b,0x14,0x30,0xc0,0x01,
+0x26,0x6a,0xef,0xfb,0x08,0x0c,0x51,0x00,0x00,0x01,0x00,0x7d,0xca,0x86,0x55,0x44,
+0x56,0x68,0xbd,0xc1,0x0a,0x0f,0x8d,0x0b,0x08,0x1f,0xf9,0xbf,0x09,0x05,0x0b,0x01,
+0x00,0x1e,0xfd,0xf4,0x00,0x06,0x97,0x02,0x08,0x01,0x00,0x0f,0x56,0x0c,0x02,0x1e,
+0x5d,0x28,0x00,0x1f,0x40,0x46,0x01,0x02,0x1c,0x5c,0x27,0x00,0x1f,0xd5,0x6f,0x01,
+0x04,0x1a,0x39,0x81,0x0c,0x1f,0xb4,0x98,0x01,0x06,0x26,0x03,0x7c,0x26,0x00,0x2f,
+0xe9,0x51,0xc2,0x01,0x09,0x89,0x02,0x57,0xab,0xde,0xff,0xff,0xfe,0xdb,0x96,0x0d,
+0x50,0x00,0x00,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x21,0x02,0x88,0x01,0x00,0x2f,
+0x60,0x00,0x01,0x00,0x05,0x21,0xaf,0xff,0x01,0x00,0x1f,0x20,0x20,0x00,0x05,0x12,
+0x0f,0x20,0x00,0x1f,0xf8,0x20,0x00,0x05,0x22,0x06,0xff,0x01,0x00,0x1f,0xe0,0x21,
+0x00,0x05,0x13,0xcf,0x21,0x00,0x1f,0x40,0x20,0x00,0x04,0x13,0x2f,0x20,0x00,0x1f,
+0xfa,0x20,0x00,0x04,0x23,0x07,0xff,0x01,0x00,0x1f,0xf0,0x21,0x00,0x04,0x14,0xdf,
+0x21,0x00,0x0f,0xe5,0x00,0x04,0x14,0x3f,0x20,0x00,0x1f,0xfb,0x20,0x00,0x03,0x24,
+0x09,0xff,0x01,0x00,0x1f,0xf2,0x21,0x00,0x03,0x15,0xff,0x01,0x00,0x1f,0x70,0x20,
+0x00,0x02,0x15,0x5f,0x20,0x00,0x1f,0xfd,0x20,0x00,0x02,0x16,0x0b,0x41,0x00,0x1f,
+0xf3,0x20,0x00,0x01,0x26,0x01,0xff,0x01,0x00,0x1f,0x90,0x21,0x00,0x01,0x17,0x7f,
+0x21,0x00,0x0f,0x20,0x00,0x01,0x17,0x0d,0x20,0x00,0x2e,0xf5,0x00,0x01,0x00,0x27,
+0x03,0xff,0x01,0x00,0x2e,0xb0,0x00,0x01,0x00,0x18,0x9f,0x21,0x00,0x1e,0x10,0x20,
+0x00,0x12,0x0e,0x1a,0x00,0x02,0x27,0x00,0x1e,0xf7,0x20,0x00,0x12,0x05,0x20,0x00,
+0x12,0xb3,0x07,0x00,0x1f,0xd0,0x66,0x02,0x05,0x13,0xf5,0xa9,0x00,0x1d,0x30,0x20,
+0x00,0x13,0x1f,0x7b,0x00,0x11,0x8f,0x07,0x00,0x1f,0xf9,0x66,0x02,0x05,0x2e,0xb0,
 0x03,0x6d,0x02,0x08,0x66,0x02,0x14,0xf6,0x0b,0x01,0x1e,0x50,0x66,0x02,0x03,0xdc,
-0x00,0x1f,0x8f,0xec,0x42,0x0a,0x14,0xb0,0x2c,0x01,0x0d,0xb9,0x04,0x05,0x27,0x73,
-0x1e,0x0d,0x0b,0x02,0x07,0x70,0x15,0x1e,0x10,0x40,0x36,0x0b,0x00,0x86,0x2e,0x00,
-0x03,0x0b,0x02,0x0a,0x5e,0x36,0x0d,0xef,0x3b,0x0c,0x34,0x36,0x1e,0x8f,0x2e,0x28,
-0x05,0xfa,0x05,0x17,0xb0,0x08,0x50,0x0e,0x9e,0x34,0x0e,0xe8,0x4a,0x0d,0x73,0x15,
-0x1c,0x10,0x0c,0x00,0x0e,0xba,0x47,0x06,0x1b,0x95,0x1e,0x00,0x66,0x02,0x1e,0xf6,
-0x03,0x51,0x0a,0x66,0x02,0x1f,0x10,0x24,0x36,0x05,0x18,0x0f,0x0c,0x15,0x1e,0x03,
-0xf1,0x05,0x05,0x08,0x30,0x0b,0xd5,0x31,0x0c,0x8a,0x13,0x08,0xd0,0x0b,0x09,0x78,
-0x04,0x19,0x1f,0x6d,0x15,0x1d,0x02,0x78,0x04,0x04,0x00,0x3e,0x0b,0x07,0x51,0x0e,
-0x5d,0x36,0x0a,0x32,0x01,0x1c,0x60,0x6b,0x04,0x22,0xe7,0x77,0x01,0x00,0x1c,0x79,
-0x34,0x29,0x0e,0x88,0x83,0x0b,0x78,0x04,0x1f,0xef,0xe3,0x83,0x08,0x0e,0x7d,0x34,
-0x0e,0xd9,0x20,0x0f,0xcb,0x83,0x05,0x1e,0xf4,0x6b,0x04,0x0e,0x60,0x43,0x0e,0x30,
-0x3d,0x0e,0x16,0x04,0x0e,0x8a,0x2b,0x0a,0x79,0x1c,0x0e,0x29,0x49,0x0b,0xf4,0x29,
-0x0e,0xf4,0x76,0x0a,0xb1,0x54,0x0e,0xc6,0x4b,0x0a,0x6b,0x10,0x0e,0xc9,0x58,0x0b,
-0xf3,0x21,0x1e,0xaf,0x52,0x17,0x18,0x03,0x83,0x06,0x1e,0x1f,0xbb,0x02,0x04,0xea,
-0x01,0x18,0xfa,0xd1,0x06,0x1e,0x20,0x1c,0x03,0x02,0x83,0x06,0x1e,0xcf,0xb3,0x17,
-0x09,0xee,0x2e,0x1e,0x2f,0x36,0x1d,0x09,0x21,0x5c,0x0a,0x0d,0x3f,0x0b,0x62,0x00,
-0x16,0xf2,0x05,0x02,0x1e,0xc0,0x35,0x51,0x02,0x0b,0x02,0x1f,0x4f,0xbe,0x4c,0x09,
-0x16,0xfe,0x93,0x1a,0x1e,0x20,0x54,0x38,0x02,0x0b,0x02,0x0f,0x2c,0x5b,0x03,0x15,
-0x02,0x0b,0x02,0x1e,0x6f,0x0b,0x3a,0x08,0x67,0x06,0x2e,0x00,0x0b,0x2a,0x06,0x08,
-0x3d,0x02,0x2e,0xf6,0x01,0x8d,0x5b,0x09,0x62,0x00,0x2e,0xc0,0x7f,0x6c,0x3a,0x09,
-0x5e,0x02,0x36,0x20,0x67,0x77,0x01,0x00,0x4f,0x76,0x65,0x43,0x10,0x01,0x8d,0x06,
-0x06,0x81,0x1c,0x0e,0x3b,0x03,0x2f,0xc7,0x10,0x52,0x02,0x06,0x1f,0xa2,0x6e,0x03,
-0x06,0x1f,0xf9,0x85,0x02,0x06,0x2f,0xfe,0x30,0xa1,0x03,0x06,0x1f,0x40,0xb8,0x02,
-0x06,0x05,0x8b,0x36,0x0e,0x82,0x31,0x0f,0x33,0x00,0x05,0x1f,0xfb,0x07,0x04,0x06,
-0x1f,0xf4,0x1e,0x03,0x06,0x19,0xc0,0x19,0x3a,0x36,0x01,0x24,0x6a,0x56,0x03,0x0b,
-0x18,0x60,0x05,0xe2,0x03,0x1d,0xf7,0x4c,0x3a,0x14,0x2e,0x4d,0x00,0x0c,0x33,0x00,
-0x05,0x43,0x09,0x0e,0x7f,0x3a,0x13,0x9f,0x24,0x05,0x0d,0x33,0x00,0x1b,0x04,0x4c,
-0x72,0x1c,0x20,0xe7,0x05,0x2d,0xf3,0x0e,0x75,0x09,0x04,0xfd,0x8c,0x0d,0x33,0x00,
-0x1a,0x0d,0xff,0x34,0x1e,0xf2,0x92,0x05,0x0e,0x66,0x00,0x0a,0x9c,0x49,0x1c,0xf2,
-0xab,0x03,0x1f,0xfb,0xcc,0x00,0x06,0x1d,0x60,0x33,0x00,0x05,0xc8,0x3a,0x0e,0x32,
-0x01,0x03,0x34,0x02,0x0e,0x65,0x01,0x04,0xe5,0x01,0x09,0x33,0x00,0x26,0x13,0x69,
-0xbc,0x37,0x0e,0xcb,0x01,0x09,0x9b,0x74,0x0e,0x61,0x38,0x0f,0x64,0x02,0x05,0x1e,
-0x60,0x97,0x02,0x06,0x4c,0x46,0x0f,0x33,0x00,0x01,0x1e,0xe4,0xfd,0x02,0x08,0xc3,
-0x22,0x0f,0x66,0x00,0x03,0x1f,0xb2,0xfd,0x02,0x06,0x1f,0xf5,0xfd,0x02,0x06,0x1f,
-0xf6,0xca,0x02,0x06,0x05,0xec,0x2c,0x21,0xf5,0x33,0x01,0x00,0x15,0x34,0xcf,0x4c,
-0x0e,0x65,0x01,0x14,0x5d,0xb9,0x0a,0x0d,0x98,0x01,0x2e,0x1b,0xff,0x31,0x02,0x09,
-0x67,0x5d,0x1e,0xfa,0x31,0x02,0x04,0x18,0x6a,0x0e,0xb5,0x1e,0x03,0x12,0x00,0x1d,
-0x4e,0x33,0x00,0x13,0x0a,0x31,0x03,0x0e,0x33,0x00,0x03,0x29,0x05,0x1d,0xae,0x33,
-0x00,0x13,0x05,0x83,0x01,0x0e,0x33,0x00,0x03,0xbd,0x05,0x1f,0xce,0x33,0x00,0x05,
-0x1f,0xfc,0x66,0x00,0x06,0x1f,0xbe,0x99,0x00,0x05,0x1d,0xfa,0x33,0x00,0x04,0x81,
-0x05,0x1d,0x8e,0x33,0x00,0x04,0x25,0x3c,0x0d,0x33,0x00,0x04,0x5a,0x08,0x1c,0x3e,
-0x33,0x00,0x14,0x6f,0x5e,0x07,0x0b,0x33,0x00,0x05,0xc9,0x1b,0x23,0xf9,0x0e,0x54,
-0x00,0x02,0xfe,0x7a,0x26,0x67,0xae,0xfd,0x04,0x1f,0xef,0xaf,0x04,0x05,0x0e,0xc8,
-0x04,0x0b,0x5c,0x21,0x0e,0x99,0x36,0x0e,0x33,0x00,0x0b,0xc0,0x3c,0x0e,0xd1,0x45,
-0x0e,0x33,0x00,0x04,0x63,0x4c,0x2f,0xef,0xff,0x2a,0x5f,0x19,0x1e,0xd5,0x30,0x03,
-0x07,0xdc,0x25,0x1e,0x0e,0x18,0x00,0x1e,0x83,0x93,0x06,0x0f,0xab,0x0f,0x06,0x51,
-0x03,0x56,0x78,0x98,0x87,0x1c,0x34,0x0d,0x1d,0x12,0x13,0x9c,0x39,0x00,0x2f,0xb7,
-0x20,0x50,0x10,0x08,0x09,0x9a,0x11,0x0b,0x04,0x39,0x0b,0x77,0x4b,0x0c,0xc4,0x46,
-0x17,0x60,0x9b,0x07,0x0c,0x29,0x53,0x07,0x0d,0x99,0x0e,0x16,0x3a,0x1e,0xd2,0xcf,
-0x58,0x0c,0x5e,0x91,0x0f,0x4b,0x0a,0x03,0x1e,0xf3,0x9a,0x3c,0x0c,0xdc,0x9d,0x0e,
-0xca,0x45,0x0b,0xaf,0x93,0x0e,0x5c,0x3a,0x09,0xdc,0x00,0x78,0xfc,0x74,0x10,0x01,
-0x23,0x6a,0xef,0xb8,0x0a,0x1a,0x2f,0x9e,0x5b,0x27,0x06,0xdf,0x6d,0x0f,0x1b,0xaf,
-0x4d,0x3d,0x16,0x09,0x94,0x0b,0x0e,0x75,0x65,0x06,0x77,0x72,0x1d,0x0b,0x18,0x93,
-0x15,0x0c,0x80,0x09,0x1d,0x1f,0xbb,0x0c,0x06,0x81,0x0a,0x1e,0x7f,0x5f,0x0e,0x29,
-0xaf,0xff,0xa5,0xb1,0x09,0x4b,0x22,0x1a,0x4f,0x11,0xb2,0x09,0xd3,0x09,0x04,0x39,
-0xa2,0x1e,0x06,0x9a,0x35,0x04,0x8d,0x00,0x3e,0xf4,0x0a,0xff,0xbe,0x11,0x1a,0x09,
-0x30,0x57,0x2e,0xf3,0x00,0x6d,0x11,0x14,0xf9,0xaa,0x24,0x09,0xa9,0x02,0x11,0xaa,
-0x01,0x00,0x1c,0xa7,0xb3,0x3c,0x0e,0x02,0x0a,0x0f,0x64,0x10,0x02,0x1e,0x00,0x77,
-0x96,0x0d,0xba,0x0d,0x0e,0x60,0x11,0x0e,0x90,0x42,0x0e,0xfc,0x11,0x0e,0x76,0xa0,
-0x08,0x7e,0x03,0x0f,0x1c,0x00,0x09,0x1f,0x40,0xef,0x11,0x08,0x0f,0x1c,0x00,0x8e,
-0x0e,0xc4,0x00,0x0f,0xfc,0x00,0x13,0x1f,0xdf,0x50,0x01,0x08,0x1f,0xcf,0x88,0x01,
-0x08,0x1e,0xaf,0x94,0x44,0x0c,0x57,0x06,0x0f,0xf1,0x16,0x02,0x1e,0x6f,0xa3,0x46,
-0x0c,0x59,0x0a,0x0e,0x3d,0x14,0x06,0xa9,0x0d,0x19,0xf1,0x69,0x12,0x11,0xdd,0x01,
-0x00,0x2e,0xd8,0x0e,0xe2,0x10,0x04,0xd8,0x02,0x3e,0xf8,0x0a,0xff,0x45,0x12,0x1a,
-0x0b,0x2b,0x66,0x09,0x9d,0x11,0x04,0x08,0x03,0x1e,0x01,0x5e,0x26,0x04,0xa0,0x00,
-0x16,0xf0,0x45,0x43,0x0d,0xf4,0x00,0x3e,0xd0,0x00,0x6f,0x3e,0x14,0x14,0xef,0x2c,
-0x01,0x1d,0x1f,0x9d,0x03,0x06,0xc1,0xa5,0x09,0xd2,0x76,0x09,0xb4,0xa8,0x06,0xc2,
-0x07,0x1c,0xf8,0x50,0x0b,0x17,0xf7,0xaf,0x13,0x1b,0xb1,0xba,0x1f,0x18,0xf1,0x1a,
-0x3e,0x11,0x93,0xb4,0x03,0x18,0x8e,0xbb,0x14,0x16,0x06,0x1d,0x1a,0x3b,0xa9,0x9a,
-0xbc,0xb6,0x14,0x0e,0xde,0x2d,0x06,0x1e,0x04,0x1f,0x0d,0x96,0x10,0x08,0x1f,0x02,
-0x49,0x0a,0x02,0x0e,0x21,0x5f,0x0d,0x81,0x14,0x2e,0x03,0xef,0x37,0x00,0x0d,0x70,
-0x69,0x0e,0x7c,0x15,0x0e,0x44,0x10,0x09,0xe9,0x88,0x1a,0x03,0x69,0x2d,0x1a,0xe7,
-0x52,0x07,0x18,0xcf,0x57,0x2d,0x1e,0x00,0x60,0xac,0x03,0x11,0x01,0x2e,0x93,0x00,
-0x92,0x79,0x76,0x8a,0xce,0xef,0xff,0xed,0xca,0x74,0x17,0x07,0x07,0xa4,0x0e,0x3f,
-0x66,0x43,0x00,0xa6,0x9b,0x07,0x2e,0xeb,0x73,0x64,0x60,0x0b,0x08,0x2e,0x0e,0x47,
-0x08,0x09,0xbf,0x2e,0x0e,0x29,0x01,0x1e,0xc3,0x35,0x00,0x0c,0x00,0x25,0x0f,0xb0,
-0x08,0x01,0x0f,0x63,0x11,0x08,0x1f,0x40,0x80,0x12,0x07,0x0f,0xe6,0x08,0x04,0x09,
-0x95,0x22,0x0f,0x0d,0x6f,0x03,0x1f,0x0e,0xea,0x11,0x07,0x07,0x4e,0x0a,0x38,0x02,
-0x47,0xbf,0x04,0x08,0x0a,0xb4,0x0b,0x27,0x06,0xef,0x99,0x0f,0x0b,0x83,0x0a,0x16,
-0x7f,0xa5,0x02,0x0c,0xe9,0x0b,0x16,0x3e,0xa6,0x42,0x0e,0xe7,0x0e,0x04,0xd7,0x00,
-0x0e,0xe8,0x0e,0x0c,0x54,0x0a,0x1c,0x20,0x74,0x02,0x1e,0xf5,0x35,0x00,0x05,0x7f,
-0x52,0x0e,0x35,0x00,0x1e,0x05,0x85,0x0f,0x0b,0xef,0x01,0x0e,0x86,0x0f,0x05,0x6b,
-0x00,0x0e,0x87,0x0f,0x06,0x12,0x58,0x0e,0x35,0x00,0x13,0x0f,0xa0,0x00,0x0e,0x35,
-0x00,0x05,0x5d,0x07,0x0e,0x35,0x00,0x1e,0x08,0x27,0x0d,0x0b,0xb6,0x05,0x1e,0xd0,
-0x35,0x00,0x04,0x85,0x00,0x0e,0x35,0x00,0x05,0x29,0x0f,0x0e,0x35,0x00,0x04,0xd0,
-0x04,0x1e,0x1e,0x35,0x00,0x13,0x0f,0x13,0x00,0x1e,0xef,0xe3,0x08,0x0e,0x94,0x0c,
-0x0b,0x35,0x00,0x1f,0xf4,0x35,0x00,0x07,0x1f,0x4e,0x35,0x00,0x3b,0x1f,0xf3,0x35,
-0x00,0x07,0x1e,0x2e,0x35,0x00,0x04,0xbc,0x06,0x0f,0x3e,0x01,0x1a,0x1e,0x4f,0x9b,
-0x0e,0x0b,0xec,0x37,0x0e,0x35,0x00,0x05,0x3e,0x0a,0x0e,0x35,0x00,0x13,0x0d,0xf4,
-0x06,0x0e,0x35,0x00,0x1e,0x01,0x38,0x0f,0x0b,0xf7,0x01,0x1e,0xf0,0x35,0x00,0x1b,
-0x0c,0x8b,0x3e,0x1d,0x20,0xd3,0x00,0x1e,0x50,0x35,0x00,0x1e,0xaf,0xd5,0x0f,0x0a,
-0x6b,0x03,0x0e,0x3b,0x11,0x05,0x6d,0x06,0x1d,0x20,0x35,0x00,0x15,0x0a,0x42,0x06,
-0x0c,0x35,0x00,0x07,0x3c,0x54,0x0b,0x35,0x00,0x16,0x1b,0x5b,0x06,0x0b,0x35,0x00,
-0x17,0x5e,0x23,0x0c,0x09,0x35,0x00,0x18,0x17,0x52,0x1c,0x04,0xa8,0x03,0x00,0x9a,
-0x60,0x29,0x8a,0xdf,0x30,0x17,0x1f,0xef,0xaa,0x0c,0x06,0x1f,0x0e,0xd4,0x21,0x07,
-0x0f,0x35,0x00,0x02,0x1f,0xe2,0x62,0x05,0x06,0x1f,0xd1,0x97,0x05,0x06,0x1e,0xb1,
-0xcc,0x05,0x0a,0x2a,0x07,0x1e,0xef,0x4a,0x43,0x1f,0x20,0x36,0x06,0x05,0x1e,0xd5,
-0x6b,0x06,0x0c,0xea,0x46,0x1b,0x0e,0x4c,0x00,0x1f,0x71,0xd5,0x06,0x02,0x2a,0xfe,
-0xdc,0x4f,0x6f,0x08,0xc9,0x15,0x06,0x01,0x00,0x2f,0x75,0xef,0xae,0x53,0x03,0x0f,
-0x17,0x00,0xda,0x0e,0x99,0xb2,0x0f,0x17,0x00,0xff,0x4c,0x0c,0x73,0x1b,0x0f,0x17,
-0x00,0xda,0x27,0x31,0x11,0x01,0x00,0x1f,0x10,0x6d,0x02,0xfe,0x0f,0x17,0x00,0x6c,
-0x1a,0x76,0x02,0x67,0x2f,0x65,0xef,0xb9,0x14,0x03,0x0f,0x17,0x00,0xd3,0x0f,0x33,
-0x06,0x03,0x1f,0x3e,0x14,0x1e,0x03,0x0f,0x44,0x00,0x03,0x1f,0x8e,0x2d,0x00,0xbe,
-0x1f,0x20,0x91,0x23,0x02,0x0c,0xb1,0x24,0x0f,0x2d,0x00,0xff,0x46,0x19,0xf8,0x9f,
-0x03,0x1f,0x10,0x6c,0x05,0x04,0x1f,0x0e,0xec,0x0e,0x03,0x0f,0x2d,0x00,0xbe,0x0f,
-0x76,0x02,0xff,0x56,0x0f,0x2d,0x00,0xf4,0x09,0x01,0x00,0x6f,0x13,0x45,0x56,0x55,
-0x42,0x10,0x4b,0x2d,0x02,0x22,0x8b,0xef,0x6f,0x13,0x1e,0x84,0x1b,0x00,0x1d,0x9e,
-0xad,0x46,0x0e,0x74,0x67,0x0a,0xcd,0x3f,0x0e,0x4b,0x14,0x0a,0x53,0x37,0x0d,0xf9,
-0x1a,0x07,0x30,0x1b,0x1f,0x1c,0x8c,0x1c,0x01,0x0e,0xd8,0x14,0x09,0x58,0x22,0x0e,
-0x9c,0x82,0x0a,0x3a,0x00,0x1f,0x1e,0xca,0x1c,0x05,0x0f,0xf5,0x25,0x06,0x1f,0xfa,
-0x61,0x30,0x09,0x1a,0xf5,0x17,0x2a,0x69,0xc7,0x41,0x00,0x12,0x47,0xbf,0x22,0x63,
-0x1a,0xcf,0x47,0x55,0x18,0x29,0x0d,0x14,0x1b,0x5f,0x6c,0x2a,0x14,0x03,0x30,0x7c,
-0x07,0xbe,0x0f,0x1c,0xe3,0xca,0xbe,0x16,0xf4,0x0f,0x13,0x1d,0xf3,0x3b,0x10,0x15,
-0x90,0xa6,0x12,0x1e,0xf7,0xda,0xbf,0x05,0x4f,0x11,0x1e,0xfd,0x97,0x11,0x05,0x22,
-0x4d,0x09,0x08,0x19,0x05,0x61,0x3f,0x1e,0xcf,0xac,0x1a,0x05,0x8b,0x4d,0x1e,0x0f,
-0x85,0x24,0x05,0x9a,0x7c,0x1e,0x04,0x43,0x25,0x06,0xa7,0x7c,0x05,0xf9,0x17,0x08,
-0x3d,0x16,0x11,0x44,0x01,0x00,0x2f,0x40,0x0c,0xa8,0x2e,0x07,0x0b,0xa1,0x8a,0x0e,
-0x68,0x2d,0x0f,0x21,0x2c,0x06,0x1e,0x03,0xad,0x2e,0x0e,0xd1,0x20,0x0f,0x9d,0x2d,
-0x08,0x1f,0xfe,0xd4,0xbb,0x09,0x0e,0x98,0x19,0x07,0x71,0x12,0x0f,0x05,0x31,0x07,
-0x0f,0xe5,0x1b,0x04,0x1e,0x09,0x6b,0x2d,0x0d,0x97,0x01,0x1e,0xb0,0x4b,0x28,0x05,
-0xd0,0x54,0x0a,0x62,0x75,0x04,0xd8,0x18,0x0f,0x39,0x00,0x42,0x1f,0x18,0x39,0x00,
-0x09,0x0a,0x1d,0x01,0x0a,0x39,0x00,0x1a,0x16,0x8e,0x02,0x0a,0x39,0x00,0x19,0x6f,
-0xd2,0x1a,0x0a,0x39,0x00,0x1a,0x14,0xc4,0x2d,0x0a,0x39,0x00,0x19,0x2f,0x14,0x05,
-0x12,0x05,0x6b,0x08,0x04,0xf9,0x01,0x0e,0x86,0xb1,0x06,0x00,0x1e,0x06,0xde,0xc3,
-0x0e,0x9b,0x14,0x1e,0x10,0x0e,0x29,0x0d,0x39,0x1e,0x0a,0x57,0x02,0x04,0x14,0x00,
-0x1e,0x2f,0x07,0x54,0x05,0x39,0x00,0x0e,0xa2,0x28,0x07,0x39,0x00,0x1e,0x09,0x47,
-0x1b,0x06,0x39,0x00,0x0f,0x6b,0x70,0x01,0x05,0x86,0x00,0x1e,0xdf,0xd5,0x1b,0x05,
-0x39,0x00,0x1e,0x07,0xc7,0x53,0x06,0x39,0x00,0x1e,0x1f,0xcd,0x83,0x06,0x56,0xc1,
-0x1c,0x8f,0xb4,0x20,0x2d,0x00,0x04,0xf8,0x13,0x06,0x05,0x04,0x16,0x08,0x4b,0x1b,
-0x1b,0x05,0x16,0x06,0x06,0x4c,0x1b,0x18,0x10,0x74,0x05,0x69,0xfd,0xa7,0x65,0x66,
-0x79,0xbf,0x15,0xc1,0x1f,0x1d,0x45,0x2b,0x09,0x0f,0x0d,0x77,0x05,0x1f,0xd0,0xe0,
-0x2b,0x08,0x1d,0xe2,0xd9,0x6d,0x0d,0x8c,0x21,0x0f,0x1d,0x00,0x02,0x1e,0xb1,0xfa,
-0x32,0x0e,0x7a,0x5a,0x1e,0x07,0x04,0x29,0x1c,0x10,0x87,0xbc,0x0a,0x66,0x47,0x07,
-0x20,0x50,0x09,0x1e,0x4e,0x0c,0x11,0x40,0x06,0x24,0x01,0x1e,0xa5,0xbb,0x04,0x30,
-0x25,0x8b,0xcd,0x51,0x1b,0x16,0x87,0x14,0x23,0x12,0xab,0xe1,0x7c,0x0a,0x14,0x69,
-0x02,0x14,0x00,0x1f,0xb7,0x1b,0x08,0x01,0x04,0x2f,0x71,0x0f,0x1c,0x00,0xff,0xff,
-0xce,0x0e,0xdd,0x09,0x0f,0x1c,0x00,0xff,0x10,0x18,0x86,0xb0,0x0f,0x1f,0x6a,0x28,
-0x04,0xff,0xff,0xd5,0x0f,0x1c,0x00,0x3a,0x12,0x0b,0x78,0x07,0x2a,0xb0,0x0f,0xfb,
-0x78,0x1f,0xf0,0x08,0x00,0xff,0xfe,0x0f,0x88,0x5b,0x03,0x1c,0x88,0x79,0x28,0x0b,
-0xda,0x7a,0x0c,0x6f,0x20,0x1f,0xa0,0x2f,0x00,0xff,0xff,0xff,0xff,0x29,0x1b,0xa1,
-0x16,0x3f,0x1a,0x07,0x01,0xe0,0x1b,0xf1,0x7a,0x12,0x1b,0x80,0x9c,0x10,0x1a,0x0c,
-0x23,0x25,0x1b,0xf6,0x5a,0x10,0x1b,0x30,0xf6,0x2b,0x13,0x6f,0x56,0x00,0x04,0xe3,
-0x10,0x0a,0x86,0x6b,0x14,0xfd,0xbe,0x0f,0x1b,0xf9,0xaf,0x7a,0x09,0xe6,0x78,0x07,
-0xb4,0xc1,0x18,0x0b,0x1b,0x56,0x16,0x2a,0xee,0x66,0x05,0x05,0x10,0x47,0xc8,0x76,
-0x68,0xcf,0xa0,0x29,0x1f,0xdf,0x6e,0x24,0x03,0x1f,0x05,0x52,0x3c,0x04,0x1f,0x0b,
-0x2a,0x31,0x04,0x1f,0x1e,0x2b,0x16,0x04,0x1f,0x2e,0x33,0x99,0x14,0x1e,0xfa,0xe7,
-0x16,0x0e,0xdb,0x6c,0x0e,0x55,0xc7,0x09,0x99,0x9e,0x09,0x0a,0x5a,0x2a,0x06,0xbf,
-0x1e,0x5e,0x06,0xfd,0x0f,0x38,0x79,0xbd,0xef,0x58,0x4d,0x0e,0x21,0x10,0x33,0x06,
-0xbb,0xbb,0x16,0x8d,0x0e,0xcd,0x08,0x15,0x3f,0x43,0x17,0x0e,0x20,0x35,0x1c,0xef,
-0x70,0x34,0x1e,0x20,0xae,0x41,0x1f,0x70,0x05,0x2a,0x06,0x07,0xa3,0x39,0x1d,0x20,
-0x57,0x8c,0x0e,0x72,0x2a,0x06,0x72,0x01,0x1e,0x20,0x1c,0x00,0x17,0xcf,0x4c,0x17,
-0x0b,0x1c,0x00,0x18,0x09,0x69,0x2d,0x0b,0x1c,0x00,0x18,0x5f,0xa4,0x01,0x0a,0x1c,
-0x00,0x19,0x02,0x3c,0x26,0x0a,0x1c,0x00,0x19,0x0d,0x6d,0x3d,0x0a,0x1c,0x00,0x19,
-0xaf,0xd6,0x17,0x09,0x1c,0x00,0x1a,0x06,0xf3,0x2d,0x09,0x1c,0x00,0x1a,0x3f,0x2e,
-0x02,0x09,0x88,0x3a,0x1a,0xef,0xed,0x81,0x08,0x1c,0x00,0x1b,0x0b,0x2f,0x34,0x08,
-0x1c,0x00,0x1b,0x8f,0xcd,0x5a,0x07,0x1c,0x00,0x1c,0x04,0x29,0x43,0x07,0x1c,0x00,
-0x1c,0x1e,0xf5,0x79,0x07,0x1c,0x00,0x1c,0xcf,0xbd,0xb4,0x06,0x1c,0x00,0x1c,0x09,
-0xb9,0x34,0x07,0x1c,0x00,0x1d,0x5f,0xc0,0x7b,0x05,0x1c,0x00,0x1e,0x02,0xb3,0x43,
-0x05,0x1c,0x00,0x1e,0x0c,0x7f,0x7a,0x05,0x1c,0x00,0x0e,0x47,0xb5,0x05,0x1c,0x00,
-0x1d,0x04,0x8a,0x00,0x06,0x1c,0x00,0x1e,0x1e,0x4a,0x7c,0x05,0x1c,0x00,0x0e,0xea,
-0x92,0x05,0x1c,0x00,0x1e,0x27,0x09,0x7b,0x05,0x1c,0x00,0x1e,0x5f,0xf7,0x44,0x05,
-0x1c,0x00,0x1f,0xef,0xb1,0x44,0x01,0x0c,0xac,0x83,0x0f,0x65,0x25,0x09,0x1f,0x80,
-0x1c,0x00,0x08,0x1f,0xf3,0x1c,0x00,0x08,0x1f,0xfd,0xb9,0x25,0x09,0x1f,0x80,0x1c,
-0x00,0x08,0x0e,0x48,0x3c,0x0e,0x07,0x7c,0x0e,0x0d,0x26,0x09,0x59,0x30,0x1f,0xef,
-0x9a,0x41,0x12,0x1d,0xfc,0x55,0x00,0x1e,0xef,0x6b,0x8c,0x1d,0x60,0x1c,0x00,0x15,
-0xf9,0x2a,0x03,0x1d,0xf1,0x1c,0x00,0x3c,0xa0,0x00,0x09,0xa4,0x46,0x17,0xef,0x11,
-0x00,0x1b,0xef,0x55,0x00,0x08,0x12,0x7f,0x1b,0x5f,0x4f,0x02,0x17,0xef,0x1b,0x1c,
-0x1b,0x0a,0xb2,0x05,0x17,0xef,0x18,0x04,0x1b,0x01,0x46,0x74,0x09,0x79,0xca,0x1f,
-0x6f,0xb8,0x03,0x07,0x2a,0x00,0x0c,0x55,0x00,0x09,0x1c,0x00,0x1e,0x02,0x4e,0x30,
-0x0a,0xa4,0x4f,0x06,0x1b,0x19,0x0e,0x98,0x04,0x06,0x3b,0x07,0x0a,0x1c,0x00,0x19,
-0x03,0x55,0x00,0x0b,0x08,0x05,0x18,0x9f,0x3e,0x17,0x0b,0x1c,0x00,0x18,0x0e,0x55,
+0x00,0x1f,0x8f,0x0b,0x02,0x03,0x14,0x08,0x1d,0x01,0x03,0x62,0x00,0x1c,0xf1,0x21,
+0x00,0x13,0xef,0x61,0x00,0x04,0x62,0x00,0x0c,0x0b,0x02,0x15,0x4f,0x3d,0x01,0x1f,
+0x8f,0x0b,0x02,0x02,0x15,0x0a,0x7e,0x01,0x1e,0x03,0x0b,0x02,0x06,0x66,0x02,0x16,
+0xf6,0xcf,0x01,0x0b,0x0b,0x02,0x16,0x6f,0x9e,0x01,0x02,0x62,0x00,0x1a,0xfe,0x20,
+0x00,0x16,0x0c,0xdf,0x01,0x1f,0x03,0x0b,0x02,0x01,0x16,0x02,0x61,0x00,0x04,0x62,
+0x00,0x0a,0x0b,0x02,0x17,0x8f,0xff,0x01,0x1e,0x8f,0x0b,0x02,0x09,0x35,0x00,0x2e,
+0x03,0xff,0x0b,0x02,0x17,0x03,0x61,0x00,0x2e,0x00,0x0d,0x0b,0x02,0x04,0x66,0x02,
+0x18,0x10,0x6e,0x00,0x1e,0x30,0x6b,0x04,0x18,0xc0,0x4e,0x00,0x1e,0xf9,0x66,0x02,
+0x19,0xf6,0x8f,0x00,0x08,0x0b,0x02,0x19,0xbf,0xb6,0x00,0x1d,0x8f,0x78,0x04,0x18,
+0x1f,0x61,0x00,0x04,0x11,0x01,0x1d,0xfa,0x6b,0x04,0x1a,0xf6,0xf1,0x00,0x1d,0xf1,
+0x6b,0x04,0x1a,0x10,0x32,0x01,0x1c,0x60,0x6b,0x04,0x22,0xe7,0x77,0x01,0x00,0x12,
+0x79,0x0f,0x00,0x1e,0xfc,0x6b,0x04,0x0a,0x01,0x00,0x1b,0xf2,0x66,0x02,0x0d,0x01,
+0x00,0x1e,0x80,0x6b,0x04,0x09,0x01,0x00,0x1e,0xfe,0x6b,0x04,0x0a,0x01,0x00,0x1e,
+0xf4,0x6b,0x04,0x0a,0x01,0x00,0x1e,0xa0,0x6b,0x04,0x0a,0x01,0x00,0x19,0x10,0x66,
+0x02,0x0e,0x01,0x00,0x19,0xf6,0x55,0x01,0x0e,0x01,0x00,0x04,0x76,0x01,0x1f,0x8f,
+0x21,0x00,0x06,0x18,0x20,0x6b,0x04,0x0e,0x01,0x00,0x03,0x83,0x06,0x2f,0x04,0xff,
+0x01,0x00,0x06,0x18,0xe0,0xd1,0x06,0x1e,0xc0,0x00,0x05,0x02,0x0b,0x02,0x1e,0x1f,
+0xbb,0x02,0x04,0xea,0x01,0x18,0xfa,0xd1,0x06,0x1e,0x20,0x1c,0x03,0x02,0x83,0x06,
+0x1e,0xcf,0x61,0x00,0x05,0x62,0x00,0x16,0x60,0x6b,0x04,0x1e,0xf7,0xa3,0x05,0x02,
+0x0b,0x02,0x1e,0x08,0x61,0x00,0x06,0x62,0x00,0x16,0xf2,0x05,0x02,0x1e,0xc0,0xbf,
+0x03,0x02,0x0b,0x02,0x1e,0x4f,0x61,0x00,0x06,0x62,0x00,0x15,0xfe,0x6b,0x04,0x0c,
+0xd4,0x07,0x15,0x8f,0x0b,0x02,0x0a,0x92,0x01,0x0c,0x62,0x00,0x3e,0xa0,0x00,0x6f,
+0x61,0x00,0x08,0x67,0x06,0x2e,0x00,0x0b,0x2a,0x06,0x08,0x3d,0x02,0x2e,0xf6,0x01,
+0x61,0x00,0x09,0x62,0x00,0x2e,0xc0,0x7f,0x61,0x00,0x09,0x5e,0x02,0x36,0x20,0x67,
+0x77,0x01,0x00,0x36,0x76,0x65,0x43,0x69,0x00,0x0c,0x1f,0x02,0x3f,0xec,0x95,0x10,
+0x3b,0x03,0x06,0x2f,0xc7,0x10,0x52,0x02,0x06,0x1f,0xa2,0x6e,0x03,0x06,0x1f,0xf9,
+0x85,0x02,0x06,0x2f,0xfe,0x30,0xa1,0x03,0x06,0x1f,0x40,0xb8,0x02,0x06,0x1f,0x40,
+0x33,0x00,0x05,0x2f,0xfe,0x10,0x33,0x00,0x05,0x1f,0xfb,0x07,0x04,0x06,0x1e,0xf4,
+0x1e,0x03,0x05,0x6a,0x01,0x17,0xef,0xf4,0x01,0x36,0x01,0x24,0x6a,0x56,0x03,0x1b,
+0x0e,0x64,0x04,0x24,0x7f,0xff,0x7d,0x01,0x1b,0xef,0x27,0x02,0x14,0x2e,0x4d,0x00,
+0x0c,0x33,0x00,0x05,0x43,0x09,0x0d,0x33,0x00,0x04,0xd4,0x05,0x1d,0xf1,0x33,0x00,
+0x14,0x04,0x80,0x00,0x0d,0x33,0x00,0x13,0x0f,0x00,0x07,0x0d,0x33,0x00,0x04,0x5e,
+0x00,0x1d,0x30,0x33,0x00,0x13,0x0d,0x2b,0x00,0x0e,0x33,0x00,0x04,0x92,0x05,0x0f,
+0x66,0x00,0x05,0x1d,0xe0,0x33,0x00,0x14,0x03,0x66,0x01,0x0f,0xcc,0x00,0x05,0x1d,
+0x60,0x33,0x00,0x14,0x2f,0x09,0x06,0x0e,0x32,0x01,0x03,0x34,0x02,0x0e,0x65,0x01,
+0x04,0xe5,0x01,0x09,0x33,0x00,0x24,0x13,0x69,0x97,0x01,0x1f,0x50,0xcb,0x01,0x05,
+0x1f,0x80,0xfe,0x01,0x05,0x1f,0x90,0x64,0x02,0x05,0x1f,0x60,0x97,0x02,0x04,0x2f,
+0xfb,0x20,0xca,0x02,0x04,0x1f,0xe4,0xfd,0x02,0x06,0x2f,0xfa,0x30,0x82,0x05,0x06,
+0x1f,0xb2,0xfd,0x02,0x06,0x1f,0xf5,0xfd,0x02,0x06,0x1f,0xf6,0xca,0x02,0x06,0x14,
+0xf5,0x33,0x00,0x21,0xf5,0x33,0x01,0x00,0x24,0x34,0x69,0xc6,0x0b,0x0e,0x65,0x01,
+0x14,0x5d,0xb9,0x0a,0x0d,0x98,0x01,0x2f,0x1b,0xff,0x31,0x02,0x05,0x13,0x1d,0xd0,
+0x00,0x0e,0x31,0x02,0x13,0x5f,0xca,0x05,0x0d,0x33,0x00,0x04,0x78,0x00,0x1d,0x4e,
+0x33,0x00,0x13,0x0a,0x31,0x03,0x0e,0x33,0x00,0x03,0x29,0x05,0x1d,0xae,0x33,0x00,
+0x13,0x05,0x83,0x01,0x0e,0x33,0x00,0x03,0xbd,0x05,0x1f,0xce,0x33,0x00,0x05,0x1f,
+0xfc,0x66,0x00,0x06,0x1f,0xbe,0x99,0x00,0x05,0x1d,0xfa,0x33,0x00,0x04,0x81,0x05,
+0x1d,0x8e,0x33,0x00,0x13,0x8f,0x9a,0x01,0x0d,0x33,0x00,0x04,0x5a,0x08,0x1c,0x3e,
+0x33,0x00,0x14,0x6f,0x5e,0x07,0x0b,0x33,0x00,0x24,0x04,0xbf,0x32,0x05,0x13,0x0e,
+0x54,0x00,0x11,0x55,0x01,0x00,0x26,0x67,0xae,0xfd,0x04,0x0e,0xfe,0x01,0x0a,0x62,
+0x04,0x0e,0xe2,0x04,0x0f,0x31,0x02,0x05,0x1f,0xfa,0x64,0x02,0x05,0x1f,0xfd,0x61,
+0x05,0x06,0x1f,0x20,0x33,0x00,0x04,0x2f,0xfd,0x10,0x33,0x00,0x04,0x1f,0xfa,0xfd,
+0x02,0x05,0x1f,0xd5,0x30,0x03,0x04,0x2f,0xfd,0x60,0x2d,0x06,0x03,0x2f,0xfd,0x83,
+0x93,0x06,0x01,0xc0,0xfe,0xdb,0x97,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x16,0x00,0x01,0x00,0x8e,0x03,0x56,0x78,0x98,0x87,0x53,0x10,0x00,0x01,0x00,0x31,
+0x04,0x9c,0xff,0x01,0x00,0x3c,0xfe,0xb7,0x20,0x1b,0x00,0x34,0x39,0xef,0xff,0x01,
+0x00,0x2a,0xfd,0x61,0x1b,0x00,0x28,0x2a,0xff,0x01,0x00,0x18,0x81,0x1b,0x00,0x29,
+0x09,0xff,0x01,0x00,0x26,0xfe,0x60,0x1b,0x00,0x3a,0x02,0xdf,0xff,0x01,0x00,0x16,
+0xfb,0x92,0x00,0x2c,0x6f,0xff,0x01,0x00,0x14,0xd2,0x1b,0x00,0x2e,0x07,0xff,0x01,
+0x00,0x13,0x30,0x1c,0x00,0x2e,0x7f,0xff,0x01,0x00,0x12,0xf3,0x1b,0x00,0x1d,0x06,
+0x1b,0x00,0x00,0x8f,0x00,0x02,0x72,0x00,0x2f,0x2f,0xff,0x01,0x00,0x01,0x11,0xc0,
+0x1c,0x00,0x1f,0xdf,0x1c,0x00,0x02,0x19,0xf7,0xdc,0x00,0x65,0xfc,0x74,0x10,0x01,
+0x23,0x6a,0x20,0x01,0x17,0x10,0x53,0x00,0x22,0xfb,0x20,0x7e,0x00,0x04,0x47,0x00,
+0x53,0x90,0x00,0x00,0x00,0xaf,0x0c,0x00,0x1b,0x50,0x24,0x01,0x49,0xf2,0x00,0x00,
+0x03,0xb5,0x00,0x00,0x01,0x00,0x12,0x9f,0x11,0x00,0x4b,0xf8,0x00,0x00,0x0b,0x37,
+0x00,0x33,0x00,0x00,0x0c,0xc6,0x00,0x32,0x00,0x00,0x1f,0x0a,0x00,0x17,0xf9,0xe4,
+0x01,0x03,0x2e,0x00,0x14,0x40,0x15,0x01,0x17,0xf1,0x96,0x01,0x14,0xaf,0x8d,0x00,
+0x03,0x97,0x00,0x17,0x80,0x1c,0x00,0x12,0x4f,0x13,0x00,0x23,0xe0,0x02,0x41,0x00,
+0x08,0x09,0x02,0x13,0x0f,0x4b,0x00,0x13,0x06,0xf8,0x00,0x08,0xea,0x01,0x03,0x8d,
+0x00,0x25,0xf4,0x0a,0xb1,0x00,0x0d,0x06,0x02,0x2c,0xf7,0x0e,0xde,0x00,0x06,0xd0,
+0x01,0x13,0xf9,0x32,0x01,0x28,0xf0,0x00,0xa9,0x02,0x11,0xaa,0x01,0x00,0x13,0xa7,
+0x94,0x00,0x1e,0xd0,0xb2,0x02,0x05,0xf4,0x01,0x1f,0xb0,0x1c,0x00,0x01,0x16,0x9f,
+0x75,0x01,0x0d,0x01,0x00,0x12,0xbf,0x1c,0x00,0x1f,0x70,0x1c,0x00,0x01,0x12,0xcf,
+0x1c,0x00,0x1f,0x60,0x1c,0x00,0x01,0x1c,0xdf,0x86,0x01,0x07,0x01,0x00,0x1f,0xef,
+0x1c,0x00,0x0f,0x1f,0x40,0x1c,0x00,0x01,0x1f,0xff,0x1c,0x00,0x94,0x0e,0xc4,0x00,
+0x0f,0xfc,0x00,0x13,0x1f,0xdf,0x50,0x01,0x08,0x1f,0xcf,0x88,0x01,0x08,0x1e,0xaf,
+0x9f,0x02,0x05,0x01,0x00,0x12,0x8f,0x1c,0x00,0x1f,0xa0,0x1c,0x00,0x01,0x18,0x6f,
+0xc2,0x03,0x0b,0x01,0x00,0x13,0x3f,0xe0,0x02,0x0f,0x1c,0x00,0x01,0x1e,0x1f,0x2b,
+0x03,0x31,0x00,0x05,0xdd,0x01,0x00,0x13,0xd8,0xbc,0x02,0x2e,0xf5,0x00,0xd8,0x02,
+0x2d,0xf8,0x0a,0x7f,0x03,0x05,0xaf,0x03,0x23,0xf6,0x05,0x34,0x05,0x08,0x1c,0x00,
+0x04,0x08,0x03,0x1b,0x01,0xc0,0x04,0x07,0xa0,0x00,0x14,0xf0,0x19,0x01,0x1e,0xa0,
+0xf4,0x00,0x14,0xd0,0xe1,0x00,0x1e,0xf2,0x80,0x01,0x3d,0x80,0x00,0x1f,0x9d,0x03,
+0x15,0x08,0x67,0x00,0x2c,0x09,0xff,0x52,0x01,0x15,0x4f,0x9f,0x00,0x2b,0x01,0xff,
+0xba,0x03,0x17,0x04,0xed,0x04,0x13,0x9f,0x0c,0x00,0x1a,0xb1,0x8a,0x00,0x01,0x2b,
+0x01,0x14,0x1e,0xf9,0x04,0x11,0x93,0xb4,0x03,0x14,0x8e,0x0f,0x00,0x19,0x70,0x77,
+0x05,0x46,0xfc,0xa9,0x9a,0xbc,0x42,0x06,0x08,0xdf,0x01,0x0f,0xb1,0x05,0x02,0x1e,
+0x0d,0x1c,0x00,0x05,0xb8,0x00,0x3e,0x02,0xef,0xff,0x01,0x00,0x1a,0xfa,0x40,0x01,
+0x09,0x01,0x00,0x14,0xb0,0x50,0x04,0x1e,0xef,0x37,0x00,0x05,0x0a,0x01,0x1d,0x1d,
+0x1c,0x00,0x1d,0x70,0x7a,0x01,0x05,0x01,0x00,0x18,0xd3,0xa6,0x04,0x19,0xcf,0x1b,
+0x00,0x1a,0xe7,0x52,0x07,0x08,0x1d,0x00,0x1b,0xd7,0x70,0x02,0x25,0x02,0x8d,0x11,
+0x01,0x1e,0x93,0x8e,0x02,0x86,0x15,0x8a,0xce,0xef,0xff,0xed,0xca,0x74,0x17,0x07,
+0x25,0x67,0x77,0x01,0x00,0x3e,0x66,0x43,0x00,0x52,0x02,0x04,0x01,0x00,0x2e,0xeb,
+0x73,0x19,0x02,0x05,0xf4,0x06,0x1e,0x82,0x35,0x00,0x05,0x82,0x07,0x05,0xda,0x03,
+0x0e,0x29,0x01,0x1f,0xc3,0x35,0x00,0x05,0x06,0x32,0x02,0x1e,0xef,0x1b,0x00,0x2f,
+0xfd,0x20,0x35,0x00,0x05,0x04,0x47,0x04,0x0e,0xcc,0x01,0x04,0x2a,0x04,0x0e,0x35,
+0x00,0x05,0x95,0x01,0x0e,0x35,0x00,0x04,0x7c,0x04,0x0e,0x35,0x00,0x05,0xc6,0x06,
+0x16,0xef,0x0b,0x00,0x38,0x02,0x47,0xbf,0x04,0x08,0x19,0x0e,0x4f,0x03,0x14,0x06,
+0x5e,0x00,0x1a,0xf9,0x35,0x00,0x08,0x62,0x08,0x1c,0xf3,0x35,0x00,0x45,0x00,0x00,
+0x3e,0xff,0xa6,0x06,0x1b,0xef,0x3b,0x07,0x15,0x2e,0xd7,0x00,0x0c,0x35,0x00,0x04,
+0xaf,0x02,0x1e,0xfd,0x35,0x00,0x04,0x74,0x02,0x1e,0xf5,0x35,0x00,0x04,0x51,0x05,
+0x1e,0xc0,0x35,0x00,0x14,0x05,0xf1,0x00,0x0e,0x35,0x00,0x14,0x0e,0xcf,0x03,0x0d,
+0x35,0x00,0x04,0x6b,0x00,0x1e,0xc0,0x35,0x00,0x14,0x03,0xd5,0x08,0x0e,0x35,0x00,
+0x13,0x0f,0xa0,0x00,0x0e,0x35,0x00,0x05,0x5d,0x07,0x0e,0x35,0x00,0x13,0x08,0x77,
+0x03,0x0e,0x35,0x00,0x04,0xd5,0x04,0x1e,0xd0,0x35,0x00,0x04,0x85,0x00,0x0e,0x35,
+0x00,0x04,0x69,0x09,0x1e,0xf1,0x35,0x00,0x04,0xd0,0x04,0x1e,0x1e,0x35,0x00,0x13,
+0x0f,0x13,0x00,0x0e,0x35,0x00,0x04,0xff,0x06,0x1f,0x3e,0x35,0x00,0x06,0x1f,0xf4,
+0x35,0x00,0x07,0x1f,0x4e,0x35,0x00,0x3b,0x1f,0xf3,0x35,0x00,0x07,0x1e,0x2e,0x35,
+0x00,0x04,0xbc,0x06,0x0f,0x3e,0x01,0x1a,0x13,0x4f,0x6d,0x06,0x0e,0x35,0x00,0x13,
+0x07,0xb6,0x05,0x0e,0x35,0x00,0x05,0x3e,0x0a,0x0e,0x35,0x00,0x13,0x0d,0xf4,0x06,
+0x0e,0x35,0x00,0x05,0xea,0x06,0x0e,0x35,0x00,0x13,0x6f,0x84,0x00,0x0e,0x35,0x00,
+0x14,0x0c,0xa3,0x05,0x0d,0x35,0x00,0x14,0x03,0xf2,0x03,0x0e,0x35,0x00,0x14,0xaf,
+0x99,0x06,0x0d,0x35,0x00,0x14,0x3f,0xd6,0x03,0x0d,0x35,0x00,0x15,0x0d,0x26,0x04,
+0x0c,0x35,0x00,0x15,0x0a,0x42,0x06,0x0c,0x35,0x00,0x04,0x4b,0x07,0x1d,0xf4,0xba,
+0x03,0x16,0x1b,0x5b,0x06,0x0b,0x35,0x00,0x17,0x5e,0x23,0x0c,0x09,0x35,0x00,0x27,
+0x17,0xdf,0xfa,0x04,0x04,0xa8,0x03,0x56,0x66,0x66,0x66,0x66,0x8a,0x80,0x0c,0x1f,
+0xa0,0xf8,0x04,0x06,0x1f,0xc0,0xf8,0x04,0x06,0x1f,0xe1,0x2d,0x05,0x06,0x1f,0xe2,
+0x62,0x05,0x06,0x1f,0xd1,0x97,0x05,0x06,0x1e,0xb1,0xcc,0x05,0x0a,0x2a,0x07,0x0e,
+0x35,0x00,0x2f,0xfc,0x20,0x36,0x06,0x05,0x1f,0xd5,0x6b,0x06,0x05,0x2f,0xfb,0x50,
+0xa0,0x06,0x04,0x2f,0xfc,0x71,0xd5,0x06,0x02,0x34,0xfe,0xdc,0x97,0xb7,0x06,0x50,
+0x00,0x00,0x00,0x00,0x00,0x2f,0x67,0x77,0x01,0x00,0x01,0x3f,0x75,0xef,0xff,0x01,
+0x00,0x01,0x1f,0xfc,0x17,0x00,0xda,0x2a,0x20,0x00,0x01,0x00,0x0f,0x17,0x00,0xff,
+0x4e,0x09,0x01,0x00,0x1f,0xf2,0x17,0x00,0xdc,0x27,0x31,0x11,0x01,0x00,0x1f,0x10,
+0x6d,0x02,0xfe,0x0f,0x17,0x00,0x6c,0x29,0x76,0x66,0x01,0x00,0x1f,0x65,0x39,0x04,
+0x03,0x1f,0xfd,0x17,0x00,0xd3,0x0f,0x33,0x06,0x03,0x1f,0x3e,0x2d,0x00,0x02,0x1f,
+0xf8,0x44,0x00,0x03,0x1f,0x8e,0x2d,0x00,0xbe,0x0b,0x39,0x02,0x15,0x0e,0xe0,0x03,
+0x0e,0x66,0x02,0x0f,0x2d,0x00,0xff,0x41,0x19,0xf8,0x9f,0x03,0x1f,0x10,0x6c,0x05,
+0x04,0x1f,0x0e,0xc1,0x01,0x01,0x1f,0x20,0x2d,0x00,0xbf,0x0f,0x76,0x02,0xff,0x56,
+0x0f,0x2d,0x00,0xf0,0x50,0x00,0x00,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x8e,0x13,
+0x45,0x56,0x55,0x42,0x10,0x00,0x00,0x01,0x00,0x40,0x04,0x8b,0xef,0xff,0x01,0x00,
+0x2e,0xeb,0x84,0x1b,0x00,0x25,0x9e,0xff,0x01,0x00,0x1b,0xb5,0x1c,0x00,0x27,0x4d,
+0xff,0x01,0x00,0x28,0xfe,0x71,0x1b,0x00,0x39,0x03,0xcf,0xff,0x01,0x00,0x17,0xe6,
+0x1c,0x00,0x2b,0x07,0xff,0x01,0x00,0x16,0xfb,0x95,0x00,0x2c,0x1c,0xff,0x01,0x00,
+0x24,0xfe,0x20,0x1c,0x00,0x2e,0x1d,0xff,0x1d,0x00,0x13,0x30,0x1c,0x00,0x1e,0x2e,
+0x1c,0x00,0x05,0x3a,0x00,0x3e,0x1e,0xff,0xff,0x01,0x00,0x12,0xfd,0x74,0x00,0x2f,
+0x0b,0xff,0x01,0x00,0x01,0x1e,0xfa,0xa8,0x00,0x06,0x01,0x00,0x11,0xf5,0xe0,0x00,
+0x05,0x0f,0x00,0x64,0xc7,0x41,0x00,0x12,0x47,0xbf,0x0e,0x00,0x10,0xd0,0x1d,0x00,
+0x14,0xcf,0xd8,0x00,0x02,0x9e,0x00,0x14,0x29,0x1d,0x00,0x58,0x60,0x00,0x00,0x00,
+0x5f,0x46,0x00,0x00,0x49,0x00,0x13,0xef,0x90,0x00,0x43,0x00,0x00,0x00,0x0d,0x1c,
+0x00,0x14,0xe3,0xf2,0x00,0x13,0x02,0x1d,0x00,0x43,0xf4,0x00,0x00,0x05,0x1c,0x00,
+0x16,0xf3,0x63,0x01,0x03,0x12,0x00,0x33,0x90,0x00,0x00,0x7f,0x00,0x16,0xf7,0x64,
+0x01,0x13,0x08,0x03,0x01,0x36,0x00,0x00,0x1f,0x60,0x00,0x04,0x01,0x00,0x14,0x0f,
+0x4b,0x00,0x04,0xe2,0x00,0x17,0x40,0x1d,0x00,0x14,0x9f,0xac,0x00,0x17,0xcf,0xd2,
+0x00,0x0a,0x73,0x00,0x3d,0xfa,0x00,0x0f,0x71,0x00,0x05,0x56,0x00,0x23,0xd0,0x04,
+0x55,0x00,0x05,0xb8,0x01,0x07,0x13,0x01,0x2e,0x00,0x8f,0x55,0x00,0x31,0x00,0x02,
+0x44,0x01,0x00,0x22,0x40,0x0c,0x1c,0x00,0x2f,0xf9,0x00,0x01,0x00,0x01,0x16,0xef,
+0x43,0x01,0x0d,0x01,0x00,0x1c,0x0f,0x1b,0x01,0x0e,0xb3,0x00,0x1e,0xff,0xf8,0x02,
+0x06,0x8d,0x01,0x1f,0xf0,0x1c,0x00,0x01,0x15,0x06,0x42,0x01,0x1e,0x00,0x01,0x00,
+0x12,0x7f,0x1d,0x00,0x1e,0xc0,0x1c,0x00,0x05,0x37,0x02,0x1f,0xfc,0x39,0x00,0x02,
+0x03,0x00,0x01,0x1f,0xb0,0x1c,0x00,0x01,0x13,0x09,0x36,0x02,0x0f,0x39,0x00,0x02,
+0x19,0x9f,0x39,0x00,0x19,0x0c,0x92,0x02,0x1a,0x19,0x39,0x00,0x09,0x7b,0x03,0x1f,
+0xf1,0x39,0x00,0x42,0x1f,0x18,0x39,0x00,0x09,0x0a,0x1d,0x01,0x0a,0x39,0x00,0x1a,
+0x16,0x8e,0x02,0x0a,0x39,0x00,0x12,0x6f,0x08,0x00,0x1f,0xe0,0x39,0x00,0x01,0x13,
+0x14,0x08,0x00,0x0f,0x39,0x00,0x02,0x12,0x2f,0x08,0x00,0x12,0xf2,0x1c,0x00,0x21,
+0x05,0x66,0x01,0x00,0x04,0xf9,0x01,0x03,0x08,0x00,0x2e,0x50,0x00,0x32,0x02,0x13,
+0xf1,0x72,0x03,0x19,0xf8,0x6b,0x01,0x04,0x39,0x00,0x1e,0xaf,0xe5,0x01,0x05,0x39,
+0x00,0x1e,0x06,0x57,0x02,0x06,0x39,0x00,0x03,0x8f,0x00,0x1f,0xf6,0x39,0x00,0x01,
+0x2e,0x00,0xef,0x56,0x00,0x05,0x39,0x00,0x13,0x09,0x09,0x00,0x1f,0x30,0x39,0x00,
+0x01,0x2e,0x4f,0xff,0x1f,0x02,0x05,0x86,0x00,0x1a,0xdf,0x56,0x04,0x09,0x39,0x00,
+0x04,0xe6,0x03,0x1f,0xe2,0x39,0x00,0x01,0x13,0x1f,0x0a,0x00,0x1e,0xd1,0x39,0x00,
+0x05,0xae,0x02,0x26,0xff,0xd2,0x0f,0x06,0x06,0xf8,0x00,0x2b,0xef,0xff,0x05,0x04,
+0x25,0x08,0xff,0x39,0x00,0x1b,0x05,0x16,0x06,0x36,0x03,0x8e,0xff,0x39,0x00,0x16,
+0x0b,0x85,0x05,0x56,0xa7,0x65,0x66,0x79,0xbf,0xc8,0x01,0x0f,0xe5,0x05,0x03,0x06,
+0x6a,0x01,0x1e,0x3f,0x1c,0x00,0x06,0x4f,0x04,0x1e,0x5f,0x1c,0x00,0x06,0xf6,0x00,
+0x1e,0x4f,0x1c,0x00,0x06,0xd8,0x00,0x0f,0x1d,0x00,0x02,0x13,0xb1,0xd6,0x00,0x1e,
+0x2c,0x1c,0x00,0x06,0x86,0x04,0x0e,0x23,0x06,0x26,0xf9,0x10,0xd8,0x04,0x1b,0xaf,
+0x1c,0x00,0x18,0x92,0xbb,0x01,0x19,0x29,0x1b,0x00,0x1b,0xc6,0xef,0x03,0x16,0x5a,
+0x24,0x01,0x1e,0xa5,0xbb,0x04,0x95,0x25,0x8b,0xcd,0xef,0xff,0xed,0xca,0x87,0x41,
+0x12,0x00,0x21,0xab,0xbb,0x01,0x00,0x19,0x10,0xbb,0x07,0x02,0x14,0x00,0x2e,0xb7,
+0xef,0x90,0x05,0x04,0xde,0x04,0x1f,0xfa,0x1c,0x00,0xff,0xff,0xce,0x0e,0xdd,0x09,
+0x0f,0x1c,0x00,0xff,0x10,0x27,0x86,0x66,0x01,0x00,0x1f,0x6a,0x28,0x04,0xff,0xff,
+0xd5,0x0f,0x1c,0x00,0x35,0x50,0xff,0xff,0xff,0xff,0xfa,0x21,0x0b,0xbb,0x01,0x00,
+0x31,0xb0,0x0f,0xff,0x01,0x00,0x1f,0xf0,0x08,0x00,0xff,0xff,0x07,0x1b,0x00,0x01,
+0x00,0x21,0x38,0x88,0x01,0x00,0x1b,0x50,0x17,0x00,0x12,0x06,0x2f,0x00,0x1c,0xfa,
+0x2f,0x00,0x12,0x6f,0x18,0x00,0x1f,0xa0,0x2f,0x00,0xff,0xff,0xff,0xff,0x29,0x22,
+0xa1,0xff,0x01,0x00,0x04,0x17,0x00,0x12,0x07,0x0f,0x00,0x22,0xf9,0x1f,0x08,0x00,
+0x14,0xf1,0x18,0x00,0x12,0x9f,0x10,0x00,0x13,0x80,0x2f,0x00,0x13,0x30,0x17,0x00,
+0x12,0x0c,0x0f,0x00,0x23,0xf6,0x0e,0x08,0x00,0x04,0x2f,0x00,0x04,0x27,0x00,0x1a,
+0xcf,0x95,0x00,0x13,0x6f,0x56,0x00,0x13,0x09,0x20,0x00,0x12,0x10,0x17,0x00,0x12,
+0x0d,0x0e,0x00,0x33,0xfd,0x00,0x5f,0x7e,0x00,0x02,0x17,0x00,0x23,0x08,0xff,0x75,
+0x00,0x28,0x01,0xff,0x5f,0x00,0x13,0x07,0x0e,0x00,0x43,0xf2,0x00,0x0b,0xff,0x30,
+0x00,0x53,0x20,0x00,0x00,0x00,0x2a,0x0d,0x00,0x24,0xfc,0x00,0x47,0x00,0x64,0xff,
+0xff,0xc8,0x76,0x68,0xcf,0x0c,0x00,0x5e,0x40,0x00,0x00,0xdf,0xff,0x01,0x00,0x4d,
+0xc0,0x00,0x00,0x05,0x17,0x00,0x00,0x5d,0x00,0x3e,0x00,0x00,0x0b,0x17,0x00,0x10,
+0xf7,0x81,0x00,0x1d,0x1e,0x17,0x00,0x02,0x5e,0x01,0x1c,0x2e,0x17,0x00,0x2e,0xfb,
+0x00,0x18,0x00,0x07,0x8c,0x01,0x1e,0x1c,0x5c,0x00,0x09,0xe1,0x00,0x02,0x01,0x00,
+0x15,0xc2,0xb3,0x01,0x26,0x01,0x8f,0x16,0x00,0x28,0xfc,0x50,0xe4,0x01,0x13,0xbf,
+0x16,0x00,0x2a,0xfe,0x93,0xe5,0x01,0xf0,0x01,0x04,0x79,0xbd,0xef,0xff,0xed,0xc9,
+0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xab,0xbb,0x01,0x00,0x25,0x10,
+0x00,0x01,0x00,0x23,0x06,0xbb,0x01,0x00,0x31,0x80,0xef,0xff,0x01,0x00,0x16,0x20,
+0x1c,0x00,0x22,0x3f,0xff,0x01,0x00,0x2d,0xfe,0x20,0x1c,0x00,0x23,0x01,0xef,0x1c,
+0x00,0x2d,0xf4,0x00,0x1c,0x00,0x23,0x0b,0xff,0x01,0x00,0x1e,0x70,0x1c,0x00,0x13,
+0x8f,0x1b,0x00,0x2d,0xfb,0x00,0x1c,0x00,0x14,0x04,0x37,0x00,0x1e,0xd0,0x1c,0x00,
+0x14,0x1e,0x1c,0x00,0x1e,0x20,0x1c,0x00,0x13,0xcf,0x1b,0x00,0x2d,0xf5,0x00,0x1c,
+0x00,0x14,0x09,0x37,0x00,0x1e,0x80,0x1c,0x00,0x16,0x5f,0x8a,0x00,0x0c,0x1c,0x00,
+0x14,0x02,0x37,0x00,0x1e,0xd1,0x1c,0x00,0x17,0x0d,0x8a,0x00,0x0c,0x1c,0x00,0x17,
+0xaf,0x8a,0x00,0x0b,0x1c,0x00,0x18,0x06,0x8a,0x00,0x0b,0x1c,0x00,0x18,0x3f,0x8a,
+0x00,0x0a,0x1c,0x00,0x05,0x67,0x01,0x1e,0xe1,0x1c,0x00,0x05,0x67,0x01,0x1e,0x30,
+0x1c,0x00,0x04,0x67,0x01,0x2d,0xf6,0x00,0x1c,0x00,0x05,0x67,0x01,0x1e,0x90,0x1c,
+0x00,0x04,0x67,0x01,0x2e,0xfc,0x00,0x1c,0x00,0x1a,0xcf,0x8a,0x00,0x08,0x1c,0x00,
+0x1b,0x09,0x8a,0x00,0x08,0x1c,0x00,0x1b,0x5f,0x8a,0x00,0x07,0x1c,0x00,0x1c,0x02,
+0x8a,0x00,0x07,0x1c,0x00,0x1c,0x0c,0x8a,0x00,0x07,0x1c,0x00,0x1c,0x8f,0x8a,0x00,
+0x06,0x1c,0x00,0x1d,0x04,0x8a,0x00,0x06,0x1c,0x00,0x1d,0x1e,0x8a,0x00,0x06,0x1c,
+0x00,0x13,0xbf,0x1c,0x00,0x1e,0xa0,0x1c,0x00,0x1e,0x27,0x8a,0x00,0x05,0x1c,0x00,
+0x04,0xdd,0x00,0x2e,0xf2,0x00,0x1c,0x00,0x04,0xba,0x01,0x1e,0xf3,0x1c,0x00,0x05,
+0x01,0x00,0x1f,0xfd,0x1c,0x00,0x08,0x2f,0xff,0x80,0x1c,0x00,0x08,0x1f,0xf3,0x1c,
+0x00,0x08,0x1e,0xfd,0x1c,0x00,0x0e,0x55,0x00,0x0e,0x1c,0x00,0x09,0xc6,0x00,0x0d,
+0x1c,0x00,0x0e,0x88,0x01,0x07,0x01,0x00,0x1e,0x70,0x1c,0x00,0x0e,0x55,0x00,0x07,
+0x1c,0x00,0x1d,0xfc,0x55,0x00,0x16,0xef,0x4c,0x00,0x13,0xdf,0x09,0x00,0x1d,0x60,
+0x1c,0x00,0x15,0xf9,0x2a,0x03,0x1d,0xf1,0x1c,0x00,0x15,0xa0,0x85,0x02,0x1c,0xfb,
+0x1c,0x00,0x17,0xfb,0x0c,0x00,0x1b,0x60,0x1c,0x00,0x17,0xc0,0x09,0x04,0x1a,0xe1,
+0x1c,0x00,0x10,0xfd,0x25,0x05,0x13,0x0a,0x1c,0x00,0x1a,0xfa,0x1c,0x00,0x11,0xd1,
+0x9c,0x03,0x04,0x7c,0x00,0x19,0x50,0x1c,0x00,0x02,0x7a,0x02,0x1f,0x6f,0xb8,0x03,
+0x07,0x05,0xdc,0x02,0x1e,0xfa,0x1c,0x00,0x06,0x14,0x03,0x2e,0x40,0x00,0x60,0x04,
+0x13,0x7f,0x1c,0x00,0x2f,0xe0,0x00,0x98,0x04,0x07,0x2e,0xf9,0x00,0x1c,0x00,0x19,
+0x03,0x55,0x00,0x0b,0x08,0x05,0x16,0x9f,0x76,0x05,0x0d,0x1c,0x00,0x18,0x0e,0x55,
 0x00,0x0b,0x1c,0x00,0x18,0x05,0x6b,0x03,0x0c,0x94,0x05,0x17,0xaf,0x55,0x00,0x0c,
-0x1c,0x00,0x17,0x1f,0x67,0x31,0x0c,0x1c,0x00,0x17,0x06,0x55,0x00,0x0d,0x3c,0x06,
-0x1e,0xcf,0x20,0x06,0x0d,0x04,0x49,0x1e,0xf7,0x1c,0x00,0x06,0xdf,0x4a,0x0e,0x10,
-0x2d,0x06,0x13,0x08,0x0e,0x7c,0x30,0x06,0x99,0x05,0x0e,0x63,0x30,0x07,0xf4,0x04,
-0x0e,0x1c,0x07,0x06,0x5f,0x02,0x1e,0xb0,0x1c,0x00,0x06,0x11,0x05,0x12,0x78,0xe9,
-0x0d,0x1f,0x10,0xf5,0x21,0xff,0xfe,0x0f,0x2d,0x00,0xff,0xff,0xe0,0x1a,0xf7,0xbc,
-0x2b,0x1e,0x60,0x9e,0x18,0x07,0xef,0x33,0x0c,0xe9,0x84,0x0f,0x2d,0x00,0xb7,0x24,
-0x00,0xab,0x8b,0x0d,0x1d,0x60,0x4d,0x22,0x04,0x1a,0x00,0x2e,0xba,0xef,0x11,0xe2,
-0x0b,0x05,0x5f,0x05,0x2d,0xd1,0x1e,0xff,0x0b,0x23,0x1e,0x5f,0x24,0x00,0x1e,0xf9,
-0xa5,0x3c,0x0d,0x24,0x00,0x1e,0xfe,0x6f,0x4f,0x0d,0x24,0x00,0x0c,0x46,0x3d,0x1e,
-0x06,0x24,0x00,0x0d,0x9c,0x10,0x1e,0x0b,0x24,0x00,0x0d,0x11,0x15,0x1e,0x1f,0x24,
-0x00,0x0d,0xa3,0x4f,0x1e,0x6f,0x24,0x00,0x0d,0x41,0x23,0x1e,0xcf,0x24,0x00,0x0c,
-0xb9,0x21,0x2e,0x02,0xff,0x24,0x00,0x0c,0x6d,0x24,0x1e,0x07,0x24,0x00,0x0d,0xc8,
-0x21,0x1e,0x0d,0x24,0x00,0x0d,0x87,0x3d,0x1e,0x2f,0x24,0x00,0x0d,0x4b,0x25,0x1e,
-0x8f,0x24,0x00,0x0e,0x35,0x0c,0x0e,0x24,0x00,0x0e,0x30,0x37,0x0e,0x24,0x00,0x0c,
-0x0c,0x0c,0x1e,0x09,0x24,0x00,0x1c,0xdf,0xa3,0x25,0x17,0x0e,0x0f,0xde,0x03,0x24,
-0x00,0x1c,0xda,0x67,0x02,0x02,0x44,0x21,0x18,0x9d,0x24,0x00,0x1c,0xd4,0x67,0x02,
-0x17,0xaf,0x92,0x38,0x13,0xfe,0x33,0x88,0x05,0xa6,0x9a,0x09,0x27,0xc7,0x18,0x0f,
-0x24,0x00,0x14,0xf0,0x4a,0xf3,0x09,0x80,0x0a,0x1a,0xf8,0x24,0x00,0x06,0xd9,0x73,
-0x07,0xef,0x36,0x1a,0xf2,0x24,0x00,0x1a,0x0d,0x67,0x02,0x12,0x0f,0xc1,0x01,0x18,
-0x1f,0x24,0x00,0x2a,0xf1,0x08,0x67,0x02,0x03,0x0a,0x62,0x19,0x2f,0x24,0x00,0x2e,
-0x02,0xff,0xf0,0xcb,0x29,0xff,0x10,0x24,0x00,0x39,0xf2,0x00,0xcf,0x24,0xd3,0x03,
-0x32,0x00,0x18,0x3f,0x24,0x00,0x1a,0xf3,0x68,0x62,0x13,0x06,0x7a,0x00,0x1a,0x4f,
-0xb8,0xdc,0x1e,0x1f,0x86,0x25,0x1c,0xf0,0x24,0x00,0x18,0x0b,0x67,0x02,0x13,0x2f,
-0x0a,0x01,0x18,0x5f,0x24,0x00,0x38,0xf5,0x00,0x05,0x67,0x02,0x19,0x7f,0x93,0xbc,
-0x15,0xfe,0xa1,0x51,0x08,0x9d,0x0d,0x19,0xdf,0xd9,0x7e,0x06,0x24,0x00,0x02,0xc6,
-0x01,0x07,0x6d,0x8f,0x1b,0xf8,0x6c,0xdd,0x14,0xf7,0x0e,0x02,0x16,0x80,0x84,0x0b,
-0x15,0xf3,0x7a,0x51,0x29,0xef,0xff,0x57,0xbe,0x01,0x67,0x02,0x05,0x0b,0x00,0x1b,
-0x9f,0x24,0x00,0x05,0x3d,0x00,0x04,0x93,0x0b,0x1b,0x70,0x24,0x00,0x18,0xf9,0x17,
-0xd6,0x24,0x00,0x9f,0x74,0x01,0x18,0xaf,0x24,0x00,0x17,0xfa,0xcd,0x00,0x03,0x38,
-0x03,0x04,0xf7,0xf3,0x05,0x24,0x00,0x18,0xfb,0xb4,0xd8,0x15,0x04,0x2e,0x10,0x0d,
-0x24,0x00,0x1a,0x1f,0x7b,0xd5,0x15,0xf1,0x60,0x04,0x16,0xfe,0xa0,0x87,0x14,0x0c,
-0xa7,0x05,0x15,0x0f,0x94,0x02,0x18,0xdf,0x24,0x00,0x17,0xfd,0xed,0x01,0x25,0x00,
-0x5f,0x49,0x0e,0x0d,0x24,0x00,0x14,0x01,0xbe,0x00,0x1a,0xaf,0xbd,0x00,0x04,0x24,
-0x00,0x16,0xfe,0x54,0x03,0x26,0x00,0x00,0x6c,0x03,0x0a,0xf0,0x03,0x06,0xfd,0x05,
-0x03,0x23,0x95,0x1e,0xf3,0x24,0x00,0x06,0x83,0x01,0x2c,0xb0,0x0b,0xe7,0x99,0x08,
-0x24,0x00,0x03,0x9a,0xca,0x15,0x1f,0xdd,0x01,0x1a,0x01,0x24,0x00,0x06,0x19,0x7f,
-0x26,0xf6,0x6f,0xa2,0x3e,0x0e,0x24,0x00,0x03,0x84,0x01,0x06,0x35,0xcd,0x0b,0x24,
-0x00,0x09,0xc9,0x12,0x04,0xb8,0x11,0x1e,0x03,0x24,0x00,0x08,0x4c,0x05,0x1f,0xf1,
-0x24,0x00,0x05,0x1b,0x0c,0x3e,0x41,0x0e,0x24,0x00,0x09,0xdc,0x05,0x1f,0x50,0x24,
-0x00,0x05,0x1b,0x01,0x48,0x56,0x0e,0x24,0x00,0x08,0xac,0x84,0x1f,0xfa,0x24,0x00,
-0x07,0x1a,0x5f,0x59,0x52,0x0e,0x24,0x00,0x08,0xd3,0x07,0x1f,0xe0,0x24,0x00,0x07,
-0x1a,0x0a,0xce,0x05,0x0f,0x24,0x00,0x02,0x0b,0x16,0x13,0x0e,0x24,0x00,0x08,0xf7,
-0x10,0x1f,0x00,0x24,0x00,0x08,0x19,0x9f,0xa6,0x06,0x0e,0x24,0x00,0x07,0x35,0x0f,
-0x1f,0xf1,0x24,0x00,0x09,0x0a,0xb7,0x98,0x0e,0x24,0x00,0x07,0x8e,0x01,0x1e,0x60,
-0x24,0x00,0x0d,0xa9,0x15,0x1f,0x10,0x24,0x00,0x09,0x2e,0x00,0xcf,0x12,0x98,0x0d,
-0x24,0x00,0x09,0x0e,0xd2,0x0e,0x24,0x00,0x06,0x8a,0x08,0x1b,0xe0,0x24,0x00,0x03,
-0xb4,0x09,0x2e,0x40,0x00,0x72,0x27,0x2e,0xb6,0xef,0xe6,0x2c,0x05,0xc7,0x81,0x0e,
-0x76,0xae,0x0d,0x1c,0x00,0x09,0x2e,0x0b,0x0c,0x1c,0x00,0x1f,0xb0,0x1c,0x00,0x08,
-0x1f,0xf4,0x1c,0x00,0x08,0x1f,0xfd,0x1c,0x00,0x08,0x08,0x11,0x08,0x0d,0x1c,0x00,
-0x1f,0xf2,0x1c,0x00,0x08,0x1f,0xfb,0x1c,0x00,0x08,0x07,0x72,0x2b,0x0e,0x1c,0x00,
-0x1f,0xe0,0x1c,0x00,0x08,0x1f,0xf8,0x1c,0x00,0x08,0x0d,0x31,0x12,0x1e,0xf9,0x8c,
-0x09,0x0f,0x1c,0x00,0x02,0x1f,0xf5,0x1c,0x00,0x08,0x1e,0xfe,0x1c,0x00,0x0e,0x56,
-0x5a,0x0f,0x1c,0x00,0x01,0x1f,0xf3,0x1c,0x00,0x08,0x1f,0xfc,0x1c,0x00,0x08,0x0a,
-0xf3,0x07,0x0b,0x1c,0x00,0x1f,0xe1,0x1c,0x00,0x08,0x1e,0xf9,0x1c,0x00,0x0c,0x3d,
-0x4c,0x0b,0x1c,0x00,0x09,0xd0,0x8a,0x0b,0x1c,0x00,0x18,0x2c,0x17,0x17,0x0b,0x1c,
-0x00,0x18,0x23,0x59,0x4c,0x0b,0x1c,0x00,0x18,0x20,0x8f,0x4a,0x0c,0x1c,0x00,0x17,
-0x1e,0x1b,0x01,0x0c,0x1c,0x00,0x08,0xd3,0x6f,0x0c,0x1c,0x00,0x08,0x40,0x49,0x0d,
-0x1c,0x00,0x07,0x5b,0x04,0x0d,0x1c,0x00,0x05,0xe8,0x7f,0x0e,0x1c,0x00,0x08,0xe9,
-0x49,0x0e,0x1c,0x00,0x06,0xc6,0x8d,0x0e,0x1c,0x00,0x04,0xd6,0xfe,0x0e,0x1c,0x00,
-0x06,0x2e,0x0c,0x1e,0x10,0x1c,0x00,0x07,0xce,0x49,0x0e,0x1c,0x00,0x06,0xe3,0x95,
-0x1e,0x06,0x1c,0x00,0x05,0x5e,0x49,0x0e,0x1c,0x00,0x06,0x86,0x44,0x0f,0x1c,0x00,
-0x01,0x04,0xfc,0x2e,0x0e,0x1c,0x00,0x05,0x00,0x15,0x1e,0xfb,0x1c,0x00,0x06,0x00,
-0x15,0x1e,0x46,0x1c,0x00,0x05,0x12,0x2d,0x1e,0xe7,0x1c,0x00,0x05,0xbc,0x0d,0x1e,
-0xfe,0x1c,0x00,0x0c,0xc3,0x58,0x1e,0xf9,0xc5,0x16,0x0e,0x1c,0x00,0x0e,0x76,0xe5,
-0x0c,0x1c,0x00,0x1f,0x04,0x1c,0x00,0x08,0x09,0x7b,0x49,0x1e,0xf9,0xb8,0x05,0x0e,
-0x1c,0x00,0x0e,0x6a,0x1d,0x0d,0x1c,0x00,0x08,0x2e,0x1e,0x0d,0x1c,0x00,0x1f,0x4f,
-0x1c,0x00,0x08,0x1f,0x0a,0x1c,0x00,0x08,0x1f,0x01,0x1c,0x00,0x08,0x07,0xc8,0x0e,
-0x1e,0xf9,0xc1,0x55,0x0f,0x1c,0x00,0x08,0x1e,0x03,0x1c,0x00,0x0e,0x9a,0x5e,0x0f,
-0x1c,0x00,0x01,0x1f,0x1e,0x1c,0x00,0x08,0x1e,0x06,0x1c,0x00,0x0e,0x4e,0x0f,0x0f,
-0x1c,0x00,0x01,0x1f,0x3f,0x1c,0x00,0x08,0x1e,0x09,0x1c,0x00,0x0d,0x53,0x1e,0x0e,
-0x1c,0x00,0x06,0x1b,0x01,0x0e,0x1c,0x00,0x06,0xdc,0x09,0x09,0x6b,0xf3,0x5e,0x57,
-0x9a,0xaa,0xa9,0x76,0xea,0xe6,0x05,0x62,0x86,0x00,0x9b,0x05,0x2e,0x83,0x00,0xef,
-0x33,0x07,0x94,0xe3,0x1c,0x71,0x1d,0x00,0x1e,0x7e,0x25,0x6f,0x0e,0x4b,0x9e,0x0e,
-0xff,0x84,0x0e,0x60,0x63,0x09,0x08,0x11,0x1e,0x1c,0x1c,0x52,0x0e,0x35,0xb5,0x0e,
-0x7f,0xb0,0x0e,0x25,0x31,0x0a,0x1e,0x00,0x1f,0x1d,0x27,0x5d,0x09,0x1f,0x0b,0x40,
-0x31,0x07,0x0f,0xf1,0x36,0x06,0x1b,0xa0,0x6b,0x02,0x5b,0xb6,0x31,0x00,0x13,0x6a,
-0xe6,0x07,0x19,0xcf,0xff,0x30,0x29,0x01,0x7f,0x5a,0x07,0x1b,0x5f,0xa3,0x00,0x18,
-0x2c,0x4a,0x01,0x1c,0x0d,0x81,0x32,0x2d,0x0b,0xff,0xed,0x05,0x2d,0xff,0xe1,0xe7,
-0x5a,0x16,0x90,0xa7,0x03,0x1e,0xf3,0xd7,0x02,0x08,0x25,0x47,0x0c,0x4b,0x02,0x00,
-0xf0,0x06,0x0b,0x86,0x22,0x0a,0x8b,0x4a,0x1e,0x00,0x50,0x62,0x07,0xda,0x5c,0x1e,
-0x3f,0xe8,0x14,0x04,0xaf,0x0b,0x15,0xf6,0x7c,0xe4,0x0e,0x58,0x13,0x00,0x47,0x01,
-0x0b,0x97,0xf4,0x08,0x4d,0x1b,0x15,0xfe,0x61,0x49,0x0f,0x04,0x13,0x01,0x2f,0xf3,
-0x03,0xe8,0x72,0x09,0x1f,0x50,0x8f,0x94,0x02,0x1a,0x0a,0xd1,0x9c,0x1f,0xfb,0x75,
-0x50,0x03,0x1f,0xaf,0x59,0x52,0x01,0x04,0xa7,0x07,0x1e,0x0c,0x6b,0x5c,0x07,0x58,
-0x53,0x1f,0xcf,0x52,0xe7,0x09,0x1e,0x0d,0xaf,0x13,0x07,0xc5,0x77,0x0e,0x63,0x51,
-0x07,0x3c,0x06,0x1e,0x1f,0xe9,0x71,0x06,0x0a,0x01,0x1e,0xf2,0x74,0x14,0x07,0x5c,
-0x05,0x1f,0x2f,0x3b,0x00,0x45,0x1f,0xef,0x3b,0x00,0x09,0x1f,0x1d,0xec,0x00,0x0a,
-0x1f,0xdf,0x27,0x01,0x09,0x0f,0x62,0x01,0x0a,0x2e,0xf0,0xbf,0x36,0x52,0x06,0x31,
-0x02,0x1e,0x08,0xd8,0x01,0x07,0x45,0x54,0x1e,0x6f,0x13,0x02,0x06,0x03,0x75,0x0e,
-0x4e,0x02,0x08,0xc0,0x52,0x1e,0x1f,0x43,0x16,0x06,0xff,0x4b,0x06,0xb0,0x9e,0x0e,
-0x64,0x39,0x05,0xc0,0x36,0x1e,0xfc,0x6b,0x02,0x07,0xfa,0x9e,0x09,0x3a,0x03,0x05,
-0x81,0x37,0x1e,0x01,0xfc,0x20,0x07,0xfb,0x55,0x04,0x74,0x08,0x0e,0x57,0x03,0x07,
-0xb0,0xc8,0x1e,0xf7,0x7e,0x01,0x07,0xf9,0x4e,0x1e,0xf2,0x2b,0x5f,0x16,0x30,0xa1,
-0x05,0x1d,0xc0,0xe8,0x15,0x17,0xc0,0x41,0x08,0x1c,0xa0,0x95,0x4e,0x18,0xf5,0xa2,
-0x10,0x1b,0xa0,0x24,0x04,0x19,0xfc,0xa0,0x15,0x1b,0xd4,0x75,0xf7,0x19,0x30,0x63,
-0x07,0x21,0xfc,0x51,0x14,0x6a,0x0a,0x6b,0x05,0x16,0x0a,0x8b,0x06,0x3c,0xba,0xaa,
-0xcf,0x19,0x0c,0x1f,0x0d,0x6d,0x52,0x08,0x0e,0x23,0x37,0x0a,0x1a,0x01,0x1f,0x4f,
-0x18,0x6a,0x0a,0x1f,0x4f,0x35,0x6a,0x0a,0x1f,0x4e,0x2f,0x76,0x0a,0x1e,0x1c,0x2a,
-0x5d,0x0f,0xf3,0x3d,0x08,0x1a,0xb1,0xfa,0x03,0x1e,0xbf,0x42,0x07,0x0e,0xd6,0x86,
-0x0e,0xc2,0x75,0x0b,0xa0,0x92,0x1e,0xe9,0xf6,0x07,0x03,0x00,0xa0,0x38,0xfe,0xdb,
-0x86,0x38,0x08,0x27,0x78,0x88,0x01,0x00,0x4f,0x87,0x66,0x52,0x00,0x49,0x52,0x07,
-0x2f,0xda,0x61,0xe1,0x22,0x07,0x2e,0xfc,0x60,0x49,0x52,0x0b,0x1b,0x01,0x1f,0xef,
-0x97,0x3e,0x01,0x0f,0x14,0x52,0x08,0x1f,0xb1,0x14,0x52,0x07,0x1f,0xe3,0x14,0x52,
-0x07,0x1f,0xe3,0xfe,0x64,0x07,0x1e,0xe2,0x16,0x64,0x0e,0x6d,0x27,0x0e,0x30,0x5f,
-0x0f,0x4b,0x64,0x07,0x1b,0x40,0xd2,0x1b,0x26,0x13,0x7b,0xf1,0x0e,0x0c,0x03,0x1c,
-0x2f,0x03,0xbf,0x2b,0x28,0x07,0x1e,0x8f,0x9a,0x5e,0x0c,0x1b,0x00,0x1e,0x10,0xf3,
-0x09,0x1e,0xbf,0x98,0x4f,0x0c,0x82,0x63,0x0e,0x35,0x00,0x04,0x51,0x7e,0x0f,0xaa,
-0x51,0x07,0x1e,0xf1,0x35,0x00,0x1f,0x02,0x40,0x51,0x22,0x03,0x13,0x00,0x1e,0x5e,
-0x35,0x00,0x04,0x11,0x07,0x0f,0x75,0x51,0x34,0x1e,0x04,0x40,0x51,0x0c,0x70,0x65,
-0x0e,0x35,0x00,0x1e,0x1f,0x0b,0x51,0x0b,0x9e,0x0b,0x0e,0x0b,0x51,0x14,0x07,0xc3,
-0x01,0x0d,0x35,0x00,0x05,0xe0,0x7f,0x0c,0xdd,0x01,0x06,0x60,0x8a,0x14,0x80,0x04,
-0x46,0x02,0x88,0x48,0x27,0x89,0xae,0xaf,0x15,0x1f,0xef,0x59,0xb2,0x06,0x0f,0x7c,
-0x02,0x05,0x1e,0xfc,0xb1,0x02,0x0f,0xb0,0x5e,0x0d,0x08,0x4f,0x24,0x0e,0x1a,0x00,
-0x0f,0xe5,0x5e,0x05,0x0f,0xad,0x64,0x06,0x1f,0xfa,0xba,0x03,0x06,0x1e,0xd4,0xef,
-0x03,0x09,0x49,0xfd,0x0e,0x35,0x00,0x05,0x05,0x50,0x0b,0xea,0x5e,0x3e,0xcb,0x96,
-0x30,0x53,0x1f,0x0f,0xcc,0x9e,0x16,0x0f,0x35,0x00,0xff,0xff,0x38,0x0a,0x10,0x80,
-0x5f,0x79,0xaa,0xaa,0x97,0x53,0x3e,0x90,0x04,0x0e,0x55,0x0f,0x0e,0x58,0xae,0x0e,
-0x33,0x5a,0x0c,0x56,0x0f,0x1e,0xe7,0x28,0x7e,0x0e,0x4e,0x08,0x0e,0x0c,0x6c,0x0e,
-0x36,0x0a,0x0e,0x8f,0x61,0x05,0xbc,0x53,0x0e,0x29,0x46,0x0b,0x18,0x41,0x0f,0x90,
-0x5b,0x01,0x1d,0xfe,0xfd,0x58,0x0e,0x9f,0xf6,0x0d,0x92,0x42,0x0c,0x05,0x16,0x1f,
-0x08,0x9c,0x6c,0x0a,0x15,0x4f,0x60,0x04,0x5b,0x63,0x10,0x01,0x36,0xbf,0x79,0x6c,
-0x19,0xdf,0xf1,0xa8,0x05,0x0a,0x30,0x0a,0x05,0x77,0x14,0xfd,0x18,0x19,0x09,0x45,
-0x2b,0x1e,0x1e,0x34,0x96,0x07,0x7f,0x17,0x1c,0x8f,0xad,0x0e,0x09,0x27,0xf0,0x0e,
-0x37,0x0b,0x16,0x2f,0x85,0x0b,0x1e,0x04,0x78,0x01,0x16,0x08,0x5f,0x0d,0x0f,0xae,
-0x0b,0x01,0x04,0xe8,0xbe,0x0f,0x45,0x6c,0x03,0x06,0xdb,0x61,0x1e,0x5f,0x33,0x21,
-0x04,0x32,0x00,0x1c,0xf5,0x06,0x45,0x09,0xdf,0x07,0x1f,0xf9,0x9e,0x5f,0x03,0x14,
-0x07,0xe5,0x00,0x1e,0x01,0x97,0x46,0x07,0xcb,0x15,0x1e,0x04,0x13,0x0d,0x07,0x43,
-0x60,0x0e,0x27,0x62,0x08,0x5d,0x61,0x0e,0x5a,0x82,0x08,0x5d,0x58,0x1e,0x0b,0xe3,
-0x0d,0x07,0xa8,0x0d,0x1e,0x0d,0x32,0x98,0x07,0x41,0x5a,0x0e,0xab,0x5f,0x08,0x4b,
-0xc0,0x0e,0x32,0x10,0x08,0x3d,0x0e,0x0f,0x15,0x47,0x03,0x1f,0x3f,0x1e,0x00,0x30,
-0x0e,0x21,0x0e,0x08,0xfe,0x1b,0x0f,0x1e,0x00,0x0b,0x0f,0x96,0x00,0x47,0x0a,0x40,
-0xad,0x0c,0xad,0x10,0x1f,0x0d,0x4a,0x01,0x0a,0x0e,0x87,0x0f,0x08,0xe5,0x47,0x0f,
-0x15,0x61,0x01,0x06,0x4c,0xcc,0x0f,0x60,0x11,0x03,0x04,0xbb,0x0f,0x1e,0x05,0x48,
-0x25,0x07,0xcd,0x48,0x0e,0x9b,0x64,0x08,0x62,0x5a,0x0a,0x9f,0xd7,0x0b,0x82,0x0e,
-0x05,0x63,0x00,0x1f,0xa0,0x43,0x48,0x03,0x1e,0x6f,0x54,0x25,0x05,0x92,0x4f,0x05,
-0xcb,0x03,0x1e,0xf6,0x2b,0x01,0x07,0x64,0xbe,0x09,0xc6,0x12,0x06,0x0e,0x4a,0x0e,
-0x50,0xb2,0x08,0x0f,0x04,0x1e,0x01,0xa3,0x31,0x17,0x0d,0xe6,0x00,0x0a,0xc5,0xf4,
-0x07,0x48,0x01,0x18,0xfb,0xd0,0x1f,0x1c,0x90,0x77,0x13,0x19,0xf3,0x43,0x16,0x0c,
-0x8f,0x6d,0x0a,0xe4,0xf5,0x1b,0xc3,0x5d,0xc2,0x1a,0x20,0x7d,0x18,0x19,0xb5,0xf9,
-0x8d,0x1c,0xf8,0x6c,0x48,0x09,0x72,0x0f,0x1e,0xd0,0x92,0xfc,0x0e,0xad,0x67,0x0e,
-0x3f,0x46,0x0e,0x9a,0xd8,0x0f,0x38,0x31,0x07,0x1f,0x5f,0x5b,0xbd,0x0a,0x1f,0x05,
-0x7c,0x46,0x08,0x0e,0x9c,0x46,0x0c,0x86,0x02,0x1e,0x9f,0xd4,0x46,0x0f,0xa3,0x4d,
-0x08,0x0b,0x8c,0xfa,0x0b,0x6d,0x86,0x0d,0x13,0x75,0x1e,0x7c,0x5e,0xa1,0x09,0x43,
-0xc6,0x6b,0x8a,0xce,0xff,0xff,0xec,0xac,0x23,0xc4,0x0e,0x3c,0x77,0x0e,0x21,0xfe,
-0x0e,0x49,0x28,0x0f,0xf6,0x4b,0x03,0x1f,0x3e,0xd9,0x7a,0x09,0x05,0x29,0xa5,0x0f,
-0x3d,0x00,0x04,0x1e,0x0a,0x04,0xcc,0x0e,0xfb,0x03,0x0e,0x04,0x66,0x08,0xb0,0x7d,
-0x0e,0x17,0xaa,0x07,0x8f,0xa2,0x0e,0x57,0x85,0x08,0x19,0x06,0x0c,0x3a,0xcd,0x09,
-0xb0,0x06,0x0e,0x2b,0x01,0x08,0xa5,0x03,0x1f,0xa0,0x9a,0x7c,0x0a,0x0e,0x38,0x5c,
-0x3f,0x66,0x54,0x31,0x16,0x34,0x08,0x2e,0xeb,0x84,0xc1,0x33,0x0a,0xee,0x8f,0x0f,
-0xbf,0x6b,0x0a,0x0e,0x27,0x0d,0x07,0xcc,0x87,0x1f,0xef,0x8a,0x12,0x07,0x1f,0xef,
-0x68,0x18,0x07,0x0e,0x1b,0x00,0x0c,0xab,0x37,0x0e,0x3e,0xa8,0x0f,0x2b,0x6f,0x08,
-0x0f,0x33,0x0e,0x07,0x0e,0xca,0x6c,0x0e,0x48,0x70,0x03,0x3c,0x04,0x37,0x12,0x47,
-0xcf,0x67,0x24,0x0b,0x34,0x0b,0x05,0xe5,0x10,0x1e,0xf6,0x4f,0x0b,0x1e,0x08,0xf4,
-0x38,0x0d,0xfc,0x02,0x0e,0x1b,0x00,0x05,0x31,0x05,0x1f,0x30,0x16,0x63,0x07,0x2e,
-0x60,0x00,0xbb,0x0b,0x05,0xbe,0x00,0x0f,0x38,0x11,0x06,0x1e,0x90,0x32,0x63,0x06,
-0xb1,0x1e,0x0e,0x1b,0x00,0x1f,0x7f,0x1b,0x00,0x07,0x1f,0x6f,0x51,0x00,0x07,0x1f,
-0x7f,0x87,0x00,0x07,0x1e,0x9f,0x1e,0x3a,0x0d,0x8e,0x6a,0x0e,0x91,0x6f,0x0f,0xc4,
-0x33,0x07,0x1f,0x09,0x44,0x01,0x07,0x15,0x3f,0xb2,0x0f,0x0d,0x89,0x1d,0x1e,0xef,
-0xf0,0x60,0x0b,0x75,0x0c,0x1d,0xe0,0x1b,0x00,0x17,0x4b,0x4e,0x04,0x03,0x1b,0x00,
-0x12,0x87,0xd4,0x10,0x18,0xbf,0x9e,0x2b,0x0f,0x52,0x02,0x04,0x1f,0xf3,0x1b,0x00,
-0x07,0x1e,0x70,0x1b,0x00,0x0e,0x7b,0x35,0x0e,0x38,0x0c,0x0f,0x1b,0x00,0x05,0x1e,
-0xf6,0x60,0x03,0x0a,0x05,0x0d,0x0f,0xcc,0x03,0x01,0x0a,0xc7,0x36,0x0e,0x70,0x68,
-0x0e,0x1b,0x00,0x0d,0x5b,0xdc,0x0e,0x35,0x16,0x0f,0x87,0x00,0x04,0x1e,0x10,0x79,
-0x0e,0x1a,0x06,0x42,0x06,0x0e,0xa5,0x20,0x09,0xf4,0x84,0x0c,0x48,0x27,0x0e,0x4c,
-0x37,0x08,0x41,0x03,0x0d,0x1b,0x00,0x0a,0x88,0xcf,0x0a,0xe6,0x01,0x09,0x13,0xbe,
-0x0a,0x1b,0x00,0x1e,0x4f,0xdb,0x17,0x04,0x1b,0x00,0x1e,0x0c,0x63,0x37,0x0c,0x7f,
-0x37,0x1e,0xc0,0x6c,0x0f,0x04,0x93,0x03,0x1e,0xf5,0x1b,0x00,0x07,0x4b,0x67,0x0d,
-0x1b,0x00,0x1e,0x0a,0x2f,0xd7,0x1b,0x20,0xcc,0x0c,0x0e,0x7a,0x37,0x08,0xdf,0xbe,
-0x0d,0x1b,0x00,0x07,0xd6,0x0d,0x0c,0x1b,0x00,0x16,0x09,0xa4,0x02,0x0e,0xce,0x20,
-0x0e,0x2a,0x03,0x0e,0xea,0x6f,0x0d,0x1b,0x00,0x05,0x2f,0xa2,0x0f,0xac,0x37,0x07,
-0x1f,0x80,0x02,0x04,0x07,0x0e,0x0b,0x65,0x07,0x95,0xde,0x0e,0x1b,0x00,0x1f,0x0e,
-0xa8,0x37,0x07,0x1f,0x07,0x2e,0x16,0x07,0x22,0x00,0xaa,0x01,0x00,0x09,0x69,0x07,
-0x4f,0x22,0x34,0x32,0x10,0x22,0x82,0x01,0x21,0x69,0xce,0x3c,0x01,0x3e,0xb9,0x51,
-0x00,0x08,0xd3,0x0b,0x26,0x18,0x0e,0xbc,0xd9,0x09,0x2d,0x50,0x0d,0x68,0x8f,0x1e,
-0x81,0xf6,0xaa,0x0d,0x2e,0x09,0x1e,0x4f,0x3c,0x0a,0x0e,0x78,0x72,0x0b,0xeb,0x0a,
-0x1f,0x5f,0xae,0x18,0x06,0x1f,0x3f,0xc8,0x0a,0x06,0x1f,0x0d,0x7b,0x7d,0x06,0x1f,
-0x07,0xb1,0x7c,0x06,0x06,0xf0,0x22,0x67,0xa6,0x31,0x00,0x12,0x58,0xdf,0x2e,0x32,
-0x06,0x47,0x79,0x09,0x47,0x58,0x1e,0xfd,0x0d,0x20,0x15,0x09,0x41,0x05,0x0d,0x58,
-0x0c,0x05,0xb3,0x16,0x04,0xd2,0x00,0x1e,0xf4,0xcf,0x7b,0x1d,0x07,0xc9,0x0c,0x05,
-0x5f,0x10,0x04,0xd6,0x42,0x0e,0xed,0x0f,0x04,0xb3,0x76,0x0e,0x02,0x6f,0x06,0xc0,
-0x06,0x0d,0xd2,0x06,0x1e,0x08,0x11,0x7f,0x11,0xee,0x01,0x00,0x1e,0xe8,0xb7,0x72,
-0x0d,0xe0,0x1c,0x1f,0xa0,0xd3,0x56,0x06,0x0f,0x32,0x70,0x01,0x1e,0xbf,0x5b,0x91,
-0x0c,0x48,0x41,0x1e,0xe7,0xe7,0x82,0x0e,0xa7,0x59,0x0e,0x45,0x02,0x1e,0xfa,0xaa,
-0xd8,0x06,0x51,0x85,0x1f,0x40,0x3a,0x84,0x04,0x0c,0x33,0xa1,0x0b,0x45,0x13,0x09,
-0x95,0x1b,0x0b,0x60,0x13,0x1e,0xc6,0xb0,0x0b,0x05,0xa7,0x00,0x1f,0x70,0xc8,0x0c,
-0x07,0x1e,0xe5,0x83,0x5a,0x0e,0xea,0x13,0x0e,0x9b,0x02,0x1e,0x70,0xe8,0xe1,0x0e,
-0x96,0x23,0x0d,0x2e,0x9b,0x19,0xc1,0x49,0xb5,0x0e,0x96,0x7f,0x0e,0x1f,0x9c,0x0e,
-0xe0,0x57,0x09,0x1c,0x00,0x1b,0x70,0xb3,0x0b,0x1e,0x7d,0x3e,0x84,0x0b,0xa2,0x92,
-0x0f,0xe1,0x85,0x02,0x1e,0x29,0x79,0x85,0x0d,0xd9,0x0d,0x1f,0x70,0x3d,0x02,0x06,
-0x1f,0xfd,0xdc,0x72,0x07,0x22,0xf1,0x57,0x39,0x0c,0x1e,0x20,0x58,0x02,0x1e,0x4b,
-0x36,0x10,0x04,0xfe,0x45,0x1e,0xaf,0x72,0x00,0x03,0x13,0x00,0x1e,0x89,0xc2,0x00,
-0x04,0x31,0x13,0x0a,0xf0,0x57,0x08,0x8e,0x0a,0x1e,0x93,0xcd,0x41,0x04,0xd0,0x22,
-0x1e,0x0f,0xea,0x0e,0x04,0x4f,0x11,0x1d,0xaf,0xa9,0x0e,0x04,0x1b,0x04,0x1d,0x04,
-0x21,0x2d,0x14,0x1e,0x74,0x01,0x1c,0x0d,0x0a,0x0e,0x15,0x2d,0x48,0x07,0x1a,0x5f,
-0x27,0x78,0x05,0x36,0x02,0x08,0x66,0xd3,0x67,0xfc,0x96,0x43,0x33,0x45,0x8c,0xc3,
-0x01,0x1f,0x02,0x54,0x1d,0x06,0x0e,0x0b,0x10,0x06,0x1a,0x04,0x1f,0x08,0x6b,0x5c,
-0x07,0x1f,0x07,0xd1,0x81,0x07,0x0e,0x0c,0x78,0x06,0xe7,0x8e,0x1e,0xdf,0x58,0x10,
-0x0e,0x04,0x72,0x0d,0x05,0x72,0x1e,0x19,0x35,0x03,0x0e,0xaa,0x02,0x0e,0x27,0xc6,
-0x16,0x04,0x02,0x01,0x2f,0xd9,0x40,0x03,0x97,0x02,0x45,0xed,0xca,0x75,0x10,0x9a,
-0x03,0x1f,0x77,0x01,0x00,0x07,0x1e,0x32,0xa1,0x52,0x06,0xc1,0x00,0x0e,0xc3,0xbe,
-0x0e,0x10,0xcf,0x0f,0x39,0x00,0xe6,0x0d,0x8b,0x17,0x1f,0xf9,0x82,0x5c,0x09,0x0e,
-0x4b,0x78,0x0f,0x39,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x0c,0x03,0x72,0xc0,0x18,
-0x40,0xed,0xab,0x02,0x13,0x00,0x1e,0x69,0x08,0x28,0x04,0x8b,0x83,0x0e,0x60,0x0d,
-0x04,0x4f,0x09,0x1f,0xc9,0x35,0x00,0xff,0xff,0xff,0xff,0x63,0x1e,0xfb,0x14,0xc6,
-0x04,0x22,0x13,0x1e,0xb7,0xf0,0x04,0x13,0x07,0xb2,0x0e,0x1f,0x7f,0xb8,0x80,0x06,
-0x1e,0x95,0x46,0x0f,0x04,0xe7,0x21,0x0a,0x05,0x3d,0x09,0xa7,0x31,0x0e,0x80,0x30,
-0x13,0x2f,0xde,0x12,0x1d,0x0d,0xd4,0x0e,0x05,0xda,0x18,0x1c,0x9f,0xe6,0x0f,0x14,
-0x01,0x63,0x10,0x0e,0xf0,0xea,0x04,0x1e,0x2b,0x05,0xfa,0x14,0x1d,0xa0,0x53,0x2b,
-0x2b,0x00,0x8f,0x5c,0x54,0x15,0xaf,0x2b,0x00,0x1a,0x01,0x6f,0xab,0x17,0x17,0xc7,
-0x50,0x16,0x08,0x9e,0xa4,0x48,0x86,0x66,0x79,0xdf,0x96,0x10,0x1f,0x0d,0xae,0x65,
-0x1d,0x1e,0x50,0x9f,0x14,0x09,0x00,0x18,0x1f,0x8f,0x62,0x91,0x07,0x0e,0x1b,0x00,
-0x0c,0x5f,0x56,0x0e,0x13,0x26,0x06,0x31,0xee,0x0b,0xa9,0x9b,0x0e,0x03,0xa5,0x0a,
-0xda,0x35,0x08,0x9e,0x26,0x0b,0x67,0xaf,0x06,0x14,0x6d,0x2d,0xfe,0xa5,0x13,0x16,
-0x8c,0x58,0xac,0xee,0xff,0xfe,0xec,0xb8,0x52,0x3f,0x07,0x1c,0x87,0xf6,0xd4,0x03,
-0x80,0x2e,0x1e,0x25,0xb3,0x47,0x09,0x4d,0x67,0x0f,0x0a,0x14,0x04,0x05,0xa5,0xec,
-0x1e,0xaf,0xd2,0x11,0x07,0x69,0x17,0x2f,0x60,0x04,0x27,0x12,0x02,0x15,0x06,0x7b,
-0x10,0x1e,0x0e,0x26,0x1f,0x06,0x4a,0x02,0x1a,0xfb,0x9f,0x21,0x0d,0x9e,0x14,0x15,
-0x50,0x1b,0x12,0x1e,0xf0,0xa4,0x22,0x01,0x15,0x00,0x06,0x97,0xb9,0x0e,0xd0,0x13,
-0x05,0xf6,0xa2,0x0b,0xa8,0x08,0x07,0x34,0x00,0x1e,0x03,0xf4,0x48,0x05,0x14,0x00,
-0x1d,0xf0,0xe9,0x19,0x09,0x26,0x02,0x17,0xf9,0x0c,0x00,0x08,0xd9,0x01,0x06,0x3c,
-0xba,0x07,0x55,0x91,0x0e,0x7e,0x23,0x18,0xe0,0x2c,0x00,0x1e,0x10,0x8f,0x38,0x09,
-0xb5,0x91,0x0e,0xd9,0x48,0x18,0x30,0x92,0x19,0x1d,0xb0,0x65,0x16,0x19,0xe0,0x3a,
-0x1a,0x0d,0x8c,0x15,0x19,0xf8,0xdc,0x18,0x1d,0xf4,0x16,0x04,0x19,0x30,0xab,0x00,
-0x0d,0x45,0x55,0x1c,0xd0,0x56,0x89,0x0a,0x58,0x1a,0x0b,0x24,0x18,0x05,0x1a,0x02,
-0x0b,0x5d,0x93,0x1c,0x01,0x03,0x12,0x0b,0xbd,0x93,0x0c,0xf3,0xe7,0x0c,0xd8,0x27,
-0x1a,0x6f,0x0a,0x05,0x0d,0x32,0x6b,0x0b,0x79,0x02,0x1b,0xbf,0x8b,0x01,0x1a,0x0b,
-0x38,0x14,0x05,0x63,0x37,0x0e,0xbc,0x6d,0x0b,0x98,0x6a,0x0f,0xff,0x87,0x02,0x0d,
-0x39,0x28,0x0a,0xd5,0x25,0x0e,0x69,0x27,0x09,0xaa,0x89,0x0e,0x31,0x35,0x0a,0x6f,
-0x1a,0x0e,0xc3,0x87,0x18,0x09,0x0d,0x01,0x0a,0x3d,0xca,0x0a,0x0f,0xd4,0x08,0x6f,
-0xf2,0x0e,0x5f,0x00,0x1e,0x10,0xdf,0x5b,0x08,0x5f,0x00,0x17,0xf5,0x29,0x01,0x1e,
-0xf4,0x15,0x27,0x02,0x33,0x00,0x0e,0x82,0x26,0x05,0x48,0x46,0x0e,0x89,0xe9,0x0a,
-0xdd,0xe8,0x06,0x6a,0x00,0x1e,0xf4,0x74,0x27,0x08,0x5c,0x59,0x0b,0xe0,0x26,0x06,
-0x7a,0xaf,0x07,0x2a,0x00,0x0d,0x5f,0x00,0x1f,0xf2,0xe7,0xeb,0x05,0x15,0x2f,0x1a,
-0x02,0x0b,0xb6,0xc8,0x0c,0x21,0xe1,0x0b,0x38,0xcb,0x0c,0x28,0xcb,0x1e,0x06,0x22,
-0x17,0x07,0x5f,0x00,0x1e,0x50,0x94,0xec,0x0a,0x29,0xc5,0x0d,0x53,0xd6,0x09,0xc9,
-0x02,0x2e,0xe0,0x04,0x80,0x17,0x09,0xe1,0xd8,0x0e,0x52,0xc2,0x09,0x87,0xd1,0x1e,
-0x0e,0x9e,0x24,0x08,0x5f,0x00,0x1f,0xd3,0x3a,0xd0,0x0c,0x1f,0x9f,0x2c,0x70,0x05,
-0x1e,0xbf,0x2d,0x26,0x0e,0x9c,0x05,0x0e,0x99,0x4c,0x0d,0x4d,0x4e,0x0e,0x8a,0x70,
-0x0d,0x70,0x3f,0x1f,0x50,0xce,0x9c,0x06,0x0e,0x57,0x71,0x0e,0x5f,0x00,0x1f,0xfa,
-0x29,0x8b,0x08,0x0e,0x7d,0x25,0x0d,0x0b,0x40,0x1f,0xf0,0x3c,0xa2,0x07,0x0f,0xfa,
-0x0e,0x07,0x1f,0x9f,0x95,0xa0,0x0b,0x1e,0x03,0xa0,0x44,0x0e,0x5f,0x00,0x0e,0x5e,
-0x00,0x0e,0xb8,0x4d,0x1f,0x30,0xa1,0xa0,0x03,0x0e,0x5e,0x00,0x0e,0xa5,0x1b,0x0f,
-0x31,0xa0,0x08,0x1f,0x8f,0x5e,0x00,0x0a,0x09,0x01,0x20,0x0c,0x67,0x08,0x16,0x50,
-0x1e,0x03,0x01,0x10,0x00,0x16,0x80,0x53,0x01,0x02,0x21,0x00,0x1d,0x83,0x5a,0xef,
-0x1e,0x1f,0x41,0xc4,0x08,0x7c,0x96,0x1b,0xf0,0x8a,0x05,0x1c,0xf8,0x26,0x01,0x2c,
-0xf0,0x0b,0xdd,0x03,0x0c,0x40,0x9e,0x13,0x2f,0x05,0x05,0x0b,0x3c,0x9c,0x06,0x2e,
-0x74,0x0c,0xff,0xb1,0x0d,0x89,0xd2,0x0c,0x11,0x01,0x14,0x8f,0x3b,0x02,0x0b,0x9c,
-0x06,0x0a,0x52,0xc9,0x06,0x26,0x03,0x14,0x20,0x48,0x09,0x0d,0x19,0x20,0x0d,0x2a,
-0x05,0x04,0xe3,0xf7,0x0b,0xe9,0x07,0x1a,0xe0,0x38,0x08,0x1d,0xfa,0x33,0xc6,0x1b,
-0x0e,0x6c,0x03,0x15,0x04,0x1a,0x06,0x1a,0x2f,0xbe,0x04,0x1b,0x2f,0x68,0x29,0x1c,
-0x07,0xa1,0x89,0x1b,0xb0,0xec,0x0a,0x1b,0xf9,0x63,0xe1,0x07,0x13,0xca,0x0a,0x4d,
-0x03,0x1d,0xfc,0x34,0xe2,0x0b,0xde,0xe1,0x1b,0xdf,0x22,0xa1,0x06,0x61,0xd0,0x04,
-0x21,0xb5,0x0c,0xc4,0x42,0x1d,0x40,0x2a,0xd5,0x0e,0x76,0xad,0x08,0x3e,0x05,0x04,
-0xf0,0xf8,0x0c,0xdf,0xe6,0x1c,0x08,0x33,0x1d,0x03,0xde,0x4d,0x0b,0x0b,0x00,0x08,
-0xa2,0x2b,0x18,0xe0,0x24,0x02,0x1d,0xfb,0x13,0xd6,0x1c,0x0f,0xf4,0x40,0x07,0x8a,
-0x07,0x18,0x2f,0xbd,0x00,0x1b,0x4f,0x35,0x25,0x17,0x02,0xea,0x06,0x18,0x0e,0xbd,
-0x00,0x1b,0x7f,0xb3,0x04,0x17,0x05,0x01,0x03,0x09,0xe6,0xde,0x1b,0xbf,0xaa,0x51,
-0x17,0x08,0xe5,0x07,0x18,0x07,0x5f,0x03,0x0c,0x10,0x25,0x17,0x0b,0x84,0x07,0x17,
-0x04,0x5e,0x00,0x17,0x02,0x6a,0x45,0x17,0x50,0x98,0x00,0x17,0x50,0x8d,0x01,0x07,
-0x69,0x47,0x16,0xba,0x50,0x02,0x1e,0x1f,0x45,0x25,0x16,0xf6,0x2c,0x02,0x16,0x76,
-0x98,0x00,0x18,0x4f,0x65,0x01,0x1c,0x9f,0xc7,0x9b,0x16,0x32,0x8c,0x00,0x18,0x7f,
-0xb7,0x01,0x16,0x6f,0x58,0x02,0x17,0x1f,0xde,0x9a,0x19,0xf3,0xb1,0xdf,0x07,0x72,
-0x01,0x05,0xc5,0x03,0x12,0xfc,0x1f,0x00,0x1d,0xf7,0xf3,0xd8,0x16,0x0f,0xb1,0x00,
-0x12,0x9f,0x49,0x02,0x15,0x6f,0x70,0x00,0x09,0x71,0x04,0x16,0x0b,0x03,0x01,0x12,
-0xcf,0x40,0x00,0x14,0x2f,0xc2,0x00,0x19,0x03,0xc3,0x04,0x07,0x01,0xca,0x03,0x40,
-0x00,0x14,0x0e,0x63,0x00,0x19,0x06,0xf4,0x08,0x15,0x04,0x81,0x02,0x13,0x04,0x18,
-0x01,0x14,0x0b,0x2d,0x04,0x19,0x09,0x37,0x04,0x15,0x01,0x81,0x02,0x13,0x07,0x5b,
-0x00,0x14,0x07,0x48,0x00,0x1a,0x0c,0x1e,0x04,0x14,0xdf,0x5f,0x03,0x13,0x0b,0x71,
-0x02,0x05,0x76,0xab,0x1a,0x0f,0x30,0x09,0x14,0xaf,0x04,0x01,0x14,0x0f,0x0e,0x02,
-0x04,0x3a,0x00,0x0a,0x1d,0xcb,0x03,0x72,0x01,0x13,0xf7,0x73,0x03,0x14,0xfd,0x6e,
-0x02,0x14,0xf4,0x70,0x04,0x1a,0xf7,0x55,0x05,0x13,0xfa,0x32,0x00,0x14,0xf9,0xba,
-0x01,0x14,0xf8,0x1d,0x05,0x1a,0xf4,0x8b,0x07,0x17,0xfd,0x43,0xc5,0x13,0x3f,0xd5,
-0x01,0x1a,0xbf,0xe1,0x05,0x19,0x0b,0x65,0x29,0x15,0xf1,0x3b,0x00,0x04,0x1d,0x05,
-0x1b,0xd0,0xd8,0x09,0x2b,0x30,0x01,0x84,0xe9,0x2b,0x30,0x01,0x64,0x0a,0x13,0x04,
-0x5f,0x03,0x15,0x05,0x17,0x00,0x12,0x08,0x11,0x00,0x1b,0x04,0xa7,0x05,0x13,0x01,
-0x5f,0x03,0x15,0x09,0xf4,0x01,0x19,0x04,0x76,0x31,0x1b,0x20,0x14,0x0a,0x26,0xd0,
-0x0c,0x55,0x03,0x02,0xac,0x01,0x1c,0x0a,0x5c,0x0b,0x17,0xaf,0x4d,0x32,0x16,0xfe,
-0x4a,0x04,0x2c,0xf2,0x0d,0xf3,0x08,0x12,0x6f,0x5f,0x03,0x16,0x4f,0xf9,0x03,0x11,
-0x8f,0x29,0x01,0x1c,0x0f,0xa4,0x07,0x12,0x3f,0x5f,0x03,0x16,0x8f,0x4b,0x04,0x17,
-0x4f,0xdb,0xe0,0x1c,0xf4,0xfd,0x08,0x26,0xf9,0xbf,0x9d,0x04,0x11,0x1f,0x83,0x01,
-0x1c,0x6f,0x8d,0x09,0x17,0x0c,0x2d,0x61,0x17,0xe0,0xbb,0x05,0x1c,0xaf,0xe0,0x07,
-0x1d,0x08,0x0b,0x11,0x1e,0x09,0x93,0x2f,0x0c,0x44,0x49,0x1d,0x60,0xaa,0x09,0x1e,
-0x60,0x51,0xa7,0x06,0x5e,0x01,0x0e,0x12,0x00,0x0c,0x02,0x24,0x1e,0xfe,0x14,0x24,
-0x0f,0xd4,0x09,0x03,0x1d,0xfb,0x87,0x09,0x1e,0xfb,0xce,0x57,0x08,0xce,0x02,0x1e,
-0x5f,0x9c,0x11,0x0a,0xaa,0x26,0x1d,0xf3,0xeb,0x49,0x1e,0xf4,0x6f,0x0a,0x08,0xce,
-0x02,0x1e,0x0e,0xfd,0x0a,0x0a,0x5f,0x06,0x1d,0xb0,0xcc,0x49,0x1e,0xd0,0xd2,0x47,
-0x08,0x18,0x0c,0x1e,0x06,0xe5,0x58,0x0a,0x60,0x01,0x05,0xd5,0xab,0x0e,0x97,0x0b,
-0x0a,0x60,0x01,0x0e,0x8c,0x2f,0x1f,0x30,0x8d,0x89,0x02,0x1e,0xfc,0x5b,0x01,0x0f,
-0x46,0x0b,0x03,0x1d,0xf8,0x5b,0x01,0x1e,0xfb,0x40,0x59,0x0a,0x35,0x01,0x1e,0x2f,
-0x84,0x0a,0x08,0x72,0x01,0x1d,0xf0,0x0c,0x0b,0x1e,0xf4,0xe1,0x0b,0x0a,0x53,0x11,
-0x08,0xd0,0x47,0x0e,0x72,0x01,0x07,0xbd,0x0d,0x1e,0x07,0xc1,0xff,0x0b,0x59,0x38,
-0x0f,0x38,0x27,0x0b,0x1e,0x05,0xae,0x11,0x0b,0x70,0x01,0x13,0x2b,0x4d,0x5b,0x09,
-0x39,0x00,0x13,0x9b,0x15,0x00,0x2e,0x30,0xcf,0x79,0x0c,0x05,0x81,0x02,0x2e,0xc0,
-0x02,0x12,0x5b,0x05,0xb0,0x0b,0x15,0xf3,0x76,0x03,0x1e,0xf7,0x63,0x13,0x16,0xf9,
-0x6c,0x24,0x1e,0xe0,0xcb,0x01,0x16,0x10,0x84,0x01,0x1d,0x80,0xe8,0x0b,0x17,0x70,
-0x54,0x03,0x1c,0x10,0xda,0x13,0x08,0x43,0xef,0x1e,0xf9,0xcc,0x8f,0x07,0xc2,0x02,
-0x1b,0xf2,0x80,0x02,0x19,0xfb,0x48,0x00,0x1b,0xb0,0x34,0x02,0x1e,0x20,0x6b,0x0c,
-0x06,0xff,0x01,0x19,0x80,0xbe,0x00,0x1e,0xfc,0x0b,0x0b,0x07,0x87,0x01,0x08,0x66,
-0xb5,0x06,0xd6,0x0a,0x19,0x0c,0xe5,0x01,0x1b,0xcf,0xd1,0x02,0x18,0x2f,0xb1,0x01,
-0x1c,0x5f,0x05,0x03,0x17,0x9f,0x83,0x01,0x1c,0x0d,0xe4,0x04,0x17,0x01,0x59,0x53,
-0x1d,0x07,0x73,0x02,0x17,0x06,0x12,0x00,0x0e,0x82,0x53,0x07,0x9f,0xbe,0x1e,0x8f,
-0x4f,0x15,0x1d,0x4f,0x2d,0x7d,0x1e,0x40,0x6c,0x03,0x15,0xfa,0x7c,0x01,0x0d,0x9a,
-0xf6,0x00,0x83,0x01,0x1e,0x02,0x87,0x15,0x06,0xda,0x02,0x2e,0xb0,0xaf,0x74,0x03,
-0x06,0x61,0x03,0x1e,0x7f,0x43,0x38,0x0e,0xc7,0x2b,0x1f,0x50,0x05,0x10,0x08,0x0f,
-0xad,0xa6,0x05,0x0e,0x2b,0x5e,0x0d,0x5c,0x3d,0x0d,0xe8,0x0e,0x1e,0x1e,0xee,0xac,
-0x0e,0xc1,0x05,0x0f,0x5f,0xe0,0x0b,0x0e,0x01,0x9d,0x0b,0xac,0x5c,0x1f,0xf4,0xaf,
-0x35,0x07,0x0f,0x94,0x10,0x03,0x1e,0x1f,0xa0,0x06,0x0e,0x0c,0x01,0x0e,0xae,0x81,
-0x0a,0x05,0x0c,0x1f,0x40,0x1c,0xae,0x09,0x1f,0xfd,0x9e,0x36,0x09,0x0f,0x32,0xe4,
-0x01,0x0e,0xfe,0x5d,0x0e,0xd0,0x2a,0x0e,0xfc,0x2b,0x0d,0x86,0x2d,0x1e,0x30,0xe5,
-0xa7,0x0e,0xa1,0xe5,0x0f,0x77,0xec,0x0d,0x0f,0x8d,0x31,0x01,0x1e,0xe1,0xb9,0x10,
-0x0e,0xcc,0x37,0x0b,0x95,0x03,0x1e,0x6f,0x65,0x01,0x06,0xfd,0x03,0x1a,0xa0,0x47,
-0xdb,0x0a,0x92,0x00,0x2e,0xf2,0x01,0x44,0x38,0x05,0x10,0x02,0x15,0xf9,0x08,0x03,
-0x1d,0xe0,0xb8,0xaf,0x00,0x64,0x02,0x1e,0x1e,0x01,0x19,0x16,0x1f,0x64,0x02,0x1d,
-0x7f,0x95,0x00,0x17,0x0a,0x4e,0x00,0x0d,0xac,0xfb,0x17,0x04,0x1e,0x01,0x0a,0xa9,
-0x04,0x07,0x92,0x00,0x1e,0xfd,0xa9,0x04,0x07,0xdd,0x02,0x18,0x40,0x38,0x02,0x1b,
-0x70,0x18,0x03,0x19,0xc0,0x73,0x02,0x1c,0x10,0xc6,0x2e,0x08,0xea,0x02,0x2e,0xfa,
-0x00,0x0f,0x00,0x06,0xbe,0x00,0x1a,0xf3,0x56,0x40,0x1a,0x20,0xf9,0x00,0x19,0xc0,
-0x92,0x00,0x0b,0x09,0xe0,0x0a,0x75,0x9a,0x1b,0xf1,0x93,0x02,0x01,0xd2,0x55,0x1e,
-0x08,0x79,0x70,0x06,0xf1,0x03,0x0e,0xeb,0x06,0x17,0x0e,0xbe,0x04,0x1d,0xbf,0xc4,
-0x08,0x16,0x5f,0x95,0x00,0x1e,0x5f,0xe0,0x03,0x06,0x56,0x07,0x1e,0x0d,0xe0,0x03,
-0x2b,0x04,0xff,0xab,0x2f,0x09,0x40,0x02,0x14,0x0b,0x8c,0x08,0x1e,0x01,0x10,0x03,
-0x06,0x29,0x03,0x2e,0xf2,0xaf,0x4b,0x03,0x06,0xcf,0x06,0x22,0xb0,0x68,0xe0,0x12,
-0x1f,0x85,0xdb,0xb3,0x01,0x3e,0x88,0x70,0x6f,0x5d,0x05,0x07,0x2c,0x97,0x1e,0x0d,
-0xb0,0x09,0x06,0x84,0x01,0x2e,0x20,0x05,0xcd,0x04,0x08,0x92,0xc5,0x2e,0xdf,0xff,
-0xf3,0x02,0x06,0x48,0x01,0x1e,0x5f,0xef,0x00,0x07,0x7c,0x12,0x0e,0xd8,0x1a,0x06,
-0xce,0x32,0x0e,0x9c,0xfe,0x0b,0x97,0x1a,0x1e,0xcf,0x66,0x9b,0x07,0x0b,0x02,0x1c,
-0x4f,0xda,0x05,0x18,0x04,0x46,0x02,0x1c,0x0c,0xdb,0x05,0x09,0x11,0x00,0x0d,0xf7,
-0x41,0x19,0x3f,0xb9,0x06,0x1b,0xbf,0xc7,0x03,0x05,0xc2,0x98,0x0e,0x7e,0x1a,0x09,
-0x95,0xad,0x08,0x56,0x56,0x0b,0x86,0x06,0x1b,0x10,0x27,0x99,0x09,0x83,0x01,0x1b,
-0xf8,0xe3,0x05,0x0a,0x27,0xaf,0x1b,0xe0,0xa5,0x00,0x1f,0xf4,0x60,0xc6,0x03,0x18,
-0x0a,0x23,0x04,0x0d,0xf5,0x87,0x09,0xa2,0x3f,0x05,0x78,0x9c,0x0e,0xdb,0x51,0x07,
-0x4d,0x40,0x0e,0xc4,0xe5,0x0e,0x8a,0xa3,0x08,0x74,0xa1,0x0e,0x1f,0xe6,0x08,0x79,
-0x00,0x08,0x7f,0x32,0x1e,0x00,0x4a,0x39,0x05,0x65,0x00,0x1e,0xd0,0xa3,0x02,0x07,
-0xaf,0xc9,0x09,0x1f,0x08,0x05,0x3d,0x1a,0x1f,0x01,0xdd,0x06,0x01,0x05,0x15,0x00,
-0x1e,0x09,0x33,0x41,0x07,0x1a,0xb2,0x1e,0x1f,0xc9,0x07,0x06,0x79,0x00,0x1e,0xb0,
-0x40,0x3d,0x08,0x57,0x1a,0x0e,0xcb,0xe8,0x08,0x6b,0x15,0x0e,0x05,0x08,0x0e,0x3e,
-0x58,0x1e,0xc0,0xf9,0x17,0x0f,0x71,0xb8,0x09,0x1f,0x07,0xd7,0xec,0x0b,0x1f,0xef,
-0x65,0xb6,0x0a,0x1f,0x6f,0x00,0xb6,0x0a,0x1e,0x0e,0xad,0x07,0x0e,0x25,0x08,0x0f,
-0xd6,0x89,0x05,0x1f,0xdf,0xdc,0xb6,0x0a,0x1f,0x6f,0x24,0x08,0x06,0x0e,0x8f,0x74,
-0x0e,0x88,0x19,0x0f,0x1a,0xb8,0x0a,0x1f,0xdf,0xb5,0xb7,0x0a,0x05,0xb2,0x51,0x0f,
-0x1e,0x00,0xff,0xff,0xc9,0x1f,0x37,0x80,0x32,0x05,0x1e,0x74,0xab,0x49,0x05,0x87,
-0x03,0x1f,0x8f,0x3b,0x85,0x06,0x0f,0x35,0x00,0x8b,0x2f,0xf9,0x08,0x39,0xb6,0x07,
-0x0f,0x35,0x00,0x06,0x1e,0x60,0x35,0x00,0x0e,0x06,0x05,0x0b,0xbd,0x0d,0x1e,0xe1,
-0x6a,0x04,0x0e,0x06,0x09,0x0e,0x06,0x24,0x0e,0x95,0x0d,0x0e,0xc1,0xce,0x0a,0x67,
-0x0b,0x1f,0x40,0x22,0x0e,0x06,0x0e,0xd5,0x2c,0x0e,0xa7,0x09,0x0c,0xa6,0x0d,0x1f,
-0xf3,0x35,0x0e,0x06,0x1f,0xf8,0x96,0x05,0x06,0x1f,0xfc,0x8e,0xbd,0x07,0x1e,0x20,
-0x5a,0xc0,0x0e,0x14,0x0f,0x0e,0x6e,0x56,0x0e,0x54,0x01,0x0f,0xa4,0x05,0x05,0x1e,
-0xdf,0x14,0xef,0x0e,0x4d,0x47,0x0f,0x54,0x01,0x1e,0x0e,0x70,0x1f,0x05,0x0c,0xe9,
-0x0e,0x54,0x01,0x0e,0xf1,0x01,0x0e,0x5e,0x41,0x0e,0x54,0x01,0x0f,0x3c,0x1f,0x05,
-0x1f,0x6f,0x66,0x0f,0x06,0x1e,0x2f,0x5c,0x07,0x0e,0x40,0x14,0x0e,0xd5,0xc0,0x0f,
-0x54,0x01,0x26,0x0e,0x10,0x46,0x0e,0xbe,0xe3,0x0d,0x3d,0x10,0x1e,0x20,0x54,0x01,
-0x0e,0x80,0x21,0x0d,0x88,0xa3,0x0f,0x54,0x01,0x1f,0x1f,0xf5,0x54,0x01,0x06,0x0e,
-0x45,0x03,0x07,0x47,0xb5,0x0e,0x54,0x01,0x0e,0x45,0x03,0x0e,0x5d,0x5d,0x0e,0x54,
-0x01,0x0f,0xb9,0x11,0x0b,0x0e,0x45,0x03,0x0e,0x91,0xfc,0x0f,0x54,0x01,0x32,0x1e,
-0x70,0x54,0x01,0x0e,0xf1,0x01,0x0b,0x54,0x01,0x2b,0xf8,0x66,0x01,0x00,0x1e,0x62,
-0xce,0xbb,0x05,0xf9,0x04,0x1f,0xbf,0xa8,0xbb,0x06,0x1f,0x6f,0x35,0x00,0x06,0x05,
-0x9d,0xb6,0x0e,0x35,0x00,0x1f,0x9f,0x35,0x00,0xa5,0x26,0x60,0x6f,0xbf,0x97,0x06,
-0xec,0x19,0x0f,0x15,0x00,0x48,0x46,0xa8,0x88,0x88,0x76,0x4d,0x02,0x15,0x6f,0xfa,
-0x03,0x1f,0x06,0x15,0x00,0xff,0xff,0xe9,0x4f,0xfa,0x88,0x88,0x87,0x87,0x03,0x56,
-0x1f,0x78,0xa9,0x2e,0x01,0x1f,0x09,0x76,0x51,0x09,0x1f,0x90,0xf1,0x05,0x02,0x0f,
-0xa1,0xf8,0x11,0x1e,0x1f,0x07,0x07,0x08,0x97,0x25,0x1e,0x00,0xc5,0x05,0x1f,0xf8,
-0xdf,0xf8,0x11,0x1e,0x9f,0xdb,0x06,0x0e,0xae,0xc2,0x09,0xed,0x06,0x1f,0xf1,0x8b,
-0x08,0x02,0x1e,0x60,0x14,0x11,0x0d,0xaf,0x06,0x1e,0x0a,0x4d,0x08,0x0e,0x50,0x2b,
-0x0e,0x71,0x2b,0x0d,0x55,0x07,0x0e,0x39,0x62,0x0f,0x1a,0x01,0x07,0x1e,0x10,0x1a,
-0x01,0x0d,0xb5,0x08,0x04,0x89,0x9b,0x0e,0x1a,0x01,0x0d,0x49,0x09,0x06,0x5c,0xe9,
-0x0e,0x5b,0x10,0x0c,0x62,0x29,0x1f,0x7f,0x1a,0x01,0x17,0x1f,0x0b,0x1a,0x01,0x09,
-0x1f,0x80,0x1a,0x01,0x17,0x1f,0xf4,0x1a,0x01,0x02,0x1e,0xa0,0x87,0x55,0x0d,0x1a,
-0x01,0x1f,0x06,0x1a,0x01,0x18,0x1e,0xaf,0x1a,0x01,0x0e,0xf4,0xfa,0x0f,0x1a,0x01,
-0x10,0x1f,0x50,0x1a,0x01,0x01,0x1f,0xfb,0x1a,0x01,0x11,0x1f,0x5f,0x1a,0x01,0x17,
-0x0e,0x90,0x2d,0x0c,0xf0,0x2d,0x0f,0xd0,0xfb,0x0c,0x1e,0x06,0x3d,0x0c,0x0d,0xdf,
-0xc5,0x0f,0x1a,0x01,0x20,0x0f,0x8f,0x03,0x03,0x1f,0x8f,0xe9,0x65,0x08,0x1f,0xfb,
-0x8f,0x03,0x18,0x0b,0xf4,0x09,0x0e,0x2f,0x0c,0x0f,0x1a,0x01,0x23,0x0e,0xa9,0x04,
-0x0f,0x1a,0x01,0x15,0x0f,0xa9,0x04,0x2e,0x0e,0x62,0xc7,0x0f,0x1a,0x01,0x31,0x0e,
-0xd2,0x15,0x07,0xa9,0x04,0x1f,0xf3,0xa9,0x04,0x17,0x1f,0xff,0xa9,0x04,0x18,0x0f,
-0x1a,0x01,0x04,0x16,0x6f,0xb4,0x63,0x06,0x47,0x1d,0x0f,0x15,0x00,0x41,0x46,0x38,
-0x88,0x88,0x8d,0xd8,0x03,0x06,0xd4,0x2f,0x1f,0x0b,0x15,0x00,0xff,0xff,0xe9,0x43,
-0xd3,0x88,0x88,0x88,0x84,0x33,0x0f,0x87,0x03,0x56,0x07,0x5c,0x67,0x1e,0x87,0x16,
-0x05,0x0a,0x03,0x06,0x1e,0x0b,0xe2,0x08,0x1e,0x2f,0x18,0x07,0x1e,0x8f,0x4e,0x05,
-0x0e,0x13,0x07,0x1e,0x05,0xbe,0x12,0x1e,0x0c,0x0f,0x10,0x1e,0x2f,0xf9,0x11,0x1e,
-0x9f,0xe3,0x22,0x0e,0x89,0x27,0x1e,0x06,0xb3,0x27,0x1e,0x0c,0x85,0x1a,0x0e,0x8f,
-0x28,0x02,0x5e,0x00,0x19,0x99,0x60,0x00,0x01,0x21,0x00,0x18,0x33,0x60,0x00,0x12,
-0x06,0x39,0x01,0x17,0xdf,0x60,0x00,0x12,0x0d,0xb6,0x08,0x07,0xeb,0xda,0x02,0x5e,
-0x00,0x12,0xf1,0x88,0x06,0x17,0xf3,0x98,0x07,0x12,0xb0,0x47,0x01,0x17,0xfa,0xf9,
-0x05,0x13,0x50,0x0f,0x01,0x06,0x74,0xdb,0x05,0xd7,0x51,0x15,0x70,0x5e,0x00,0x14,
-0xf9,0x5b,0x01,0x19,0xd0,0xdd,0xdd,0x15,0x2f,0x3d,0x07,0x19,0xaf,0xbe,0x2b,0x15,
-0xfa,0x5e,0x00,0x15,0x60,0x11,0x01,0x14,0x10,0x2d,0x07,0x15,0x10,0x1d,0x00,0x13,
-0x70,0xe9,0x06,0x16,0xfa,0xa1,0x00,0x13,0xe0,0x5e,0x00,0x02,0x92,0x07,0x04,0x0b,
-0x00,0x1b,0xbf,0x32,0xdb,0x13,0xfb,0x41,0x00,0x17,0x80,0x6a,0x06,0x2d,0x10,0x08,
-0x54,0x74,0x02,0x4b,0x66,0x18,0xfc,0xf4,0x09,0x28,0xe0,0x5f,0xaf,0x07,0x11,0x5f,
-0xa2,0x06,0x18,0xbf,0x2a,0x07,0x11,0x0f,0x60,0x00,0x1f,0xaa,0x01,0x00,0x01,0x0e,
-0xf7,0x16,0x07,0x9e,0x8c,0x0a,0x01,0x00,0x1f,0xcf,0x2b,0x00,0x98,0x22,0xc0,0x2a,
-0xdf,0x00,0x1e,0xa4,0x09,0x1f,0x09,0x83,0xc0,0x17,0xcf,0xd9,0x09,0x03,0xf6,0x61,
-0x18,0xfc,0x6b,0x14,0x18,0xf7,0x1e,0x0c,0x1b,0xf2,0x26,0x2f,0x06,0x76,0x03,0x17,
-0x50,0x38,0x09,0x03,0x69,0x14,0x18,0x09,0x51,0x0c,0x18,0x0b,0x92,0x09,0x18,0x0c,
-0x7c,0x0b,0x18,0x1d,0xf1,0x0a,0x1a,0x2e,0x3f,0x68,0x01,0x42,0x3d,0x2b,0xca,0x74,
-0xbc,0x73,0x1d,0xdf,0x56,0xb7,0x06,0x51,0xeb,0x0b,0x92,0xc5,0x1e,0x1b,0x8e,0x5a,
-0x0e,0x2d,0x4d,0x1f,0xf6,0x0d,0x4d,0x04,0x1e,0x70,0x62,0x64,0x06,0x2f,0x00,0x1e,
-0x7f,0x05,0x5e,0x0e,0x0d,0xfe,0x0a,0xfd,0x2e,0x0d,0x46,0x00,0x14,0x5f,0xfe,0x50,
-0x37,0x32,0x13,0x5a,0x3d,0x05,0x17,0xcf,0xe9,0x64,0x15,0x2d,0x5d,0x00,0x09,0x59,
-0xc1,0x15,0x01,0x1b,0xc1,0x0a,0xf9,0x0d,0x14,0x5f,0x90,0x04,0x0a,0xc4,0xfd,0x05,
-0xa9,0x35,0x19,0x09,0x82,0x0a,0x14,0x0a,0x25,0x00,0x12,0x03,0x75,0xc8,0x1c,0x50,
-0x6f,0x34,0x0e,0xd4,0x0a,0x0f,0x17,0x00,0x06,0x1f,0xf4,0x17,0x00,0x23,0x4d,0x25,
-0x7a,0xcd,0xef,0xf0,0x27,0x2e,0x05,0xae,0x78,0xd1,0x03,0x16,0xf2,0x0d,0x17,0x00,
-0x1e,0x08,0xa6,0xd1,0x0e,0xfa,0x65,0x04,0x17,0x00,0x1f,0x4f,0xd4,0xd1,0x02,0x1f,
-0x04,0xeb,0xd1,0x03,0x07,0xe1,0x28,0x26,0xee,0xee,0xcc,0x18,0x04,0x14,0x16,0x28,
-0xd8,0x42,0xcf,0x00,0x19,0x04,0x03,0xba,0x05,0x17,0x00,0x19,0x0b,0xf4,0x5e,0x05,
-0x17,0x00,0x19,0x1f,0xe0,0x17,0x05,0x17,0x00,0x19,0x5f,0xc9,0x0b,0x05,0x17,0x00,
-0x0a,0x47,0xd4,0x05,0x17,0x00,0x19,0xaf,0x6e,0x07,0x05,0x17,0x00,0x03,0x39,0xfb,
-0x0f,0x17,0x00,0x1a,0x1a,0xff,0xd5,0x0e,0x14,0xf4,0xe5,0x00,0x0a,0x5c,0xeb,0x1a,
-0xf4,0x83,0x42,0x2b,0x2c,0xff,0xb8,0x00,0x01,0x05,0x04,0x16,0x28,0x42,0x01,0x14,
-0x1f,0x90,0x03,0x37,0x97,0x67,0x9d,0xc9,0x50,0x1f,0x0b,0xae,0x5a,0x03,0x1f,0x03,
-0xcb,0x4e,0x04,0x1f,0xaf,0xda,0x50,0x03,0x1f,0x1d,0x1c,0x5e,0x03,0x0a,0x58,0x54,
-0x06,0x25,0x08,0x18,0x2e,0xdc,0x01,0x15,0x8f,0xb3,0x0d,0x27,0x01,0xcf,0x41,0xae,
-0x16,0x4f,0xf5,0x00,0x2d,0x07,0xef,0x01,0x6f,0x02,0xbc,0x35,0x15,0xdf,0xfa,0xd0,
-0x03,0x35,0x97,0x12,0xa1,0x9a,0x06,0x6d,0x7a,0xce,0xff,0xfe,0xc9,0x50,0xb3,0xbb,
-0x1f,0x75,0x52,0x3c,0x03,0x1f,0xfc,0x17,0x00,0xff,0xbd,0x6c,0x26,0xac,0xef,0xfe,
-0xdb,0x84,0x17,0x00,0x23,0x4b,0xff,0xe8,0xe0,0x09,0x17,0x00,0x15,0x1b,0xc1,0x1f,
-0x17,0x10,0x17,0x00,0x07,0xcc,0xef,0x17,0xe4,0x17,0x00,0x1b,0x4f,0x9b,0x33,0x03,
-0x62,0x86,0x0c,0x49,0x06,0x1f,0xcf,0x8b,0xc4,0x03,0x1f,0xcf,0x63,0x54,0x03,0x1f,
-0xcf,0x3b,0x03,0x03,0x1f,0xcf,0xe5,0x71,0x03,0x1f,0xcf,0x32,0x72,0x03,0x06,0xa5,
-0xf0,0x5b,0x42,0x12,0x48,0xdf,0xff,0x50,0x04,0x28,0xff,0xd4,0x68,0x07,0x1b,0xfb,
-0xde,0x2f,0x14,0x2f,0xd3,0x27,0x0a,0x59,0xb0,0x14,0x04,0xe9,0x00,0x1a,0xcf,0x12,
-0x11,0x04,0x60,0x67,0x1e,0xcf,0x22,0x30,0x06,0x7e,0x78,0x1b,0xfc,0x58,0x13,0x1b,
-0xf1,0x17,0x00,0x04,0x0b,0xf0,0x0b,0x17,0x00,0x04,0x83,0xd9,0x0c,0xe3,0x01,0x03,
-0xbb,0x01,0x0c,0x17,0x00,0x03,0x47,0x88,0x0c,0x17,0x00,0x03,0x10,0x00,0x0c,0x17,
-0x00,0x03,0x8e,0x0d,0x1e,0xcf,0xab,0x33,0x0f,0x17,0x00,0x07,0x1f,0xfe,0x17,0x00,
-0x2b,0x0e,0x73,0x00,0x0f,0x17,0x00,0x09,0x1f,0xdf,0xb8,0x00,0x03,0x03,0xe5,0x88,
-0x0f,0x14,0x01,0x13,0x1e,0x02,0x42,0x01,0x07,0xfc,0x01,0x1b,0xf5,0x17,0x00,0x04,
-0x2a,0x17,0x0b,0x17,0x00,0x1a,0x0f,0x4a,0x7a,0x1b,0x30,0x1c,0x6b,0x0a,0x28,0x02,
-0x1b,0x02,0x28,0x02,0x1a,0xfb,0x78,0x76,0x28,0x10,0xcf,0xcc,0x56,0x04,0xfe,0x56,
-0x16,0xfc,0xb2,0x02,0x55,0xb6,0x20,0x00,0x25,0xbf,0x8f,0x06,0x1f,0xcf,0x05,0xd9,
-0x03,0x1f,0xcf,0xb2,0x48,0x03,0x1f,0xcf,0xdb,0x6d,0x03,0x1f,0xcf,0x15,0x5d,0x03,
-0x0e,0xaf,0x03,0x07,0xcc,0x42,0x1c,0xe4,0x71,0x48,0x12,0xcf,0x68,0x06,0x1b,0x5f,
-0xbb,0x48,0x12,0xcf,0xfe,0x02,0x2a,0x04,0xef,0x82,0x0a,0x13,0xcf,0x21,0x00,0x19,
-0x1b,0xaa,0xd4,0x03,0x17,0x00,0x15,0x70,0x7e,0x04,0x0d,0xca,0x5b,0x7b,0x16,0xac,
-0xef,0xff,0xeb,0x95,0x10,0x47,0xae,0x7a,0x9b,0xde,0xff,0xfe,0xdb,0x85,0x10,0x98,
-0x48,0x1e,0xdf,0x9e,0x5b,0x09,0xcb,0xae,0x1e,0x80,0xde,0x7e,0x09,0xa2,0x6f,0x1e,
-0x1c,0x54,0x49,0x0e,0x36,0xf6,0x1e,0xfa,0x16,0x00,0x06,0x17,0x00,0x1f,0x1e,0xee,
-0x58,0x02,0x1e,0x0c,0x57,0x63,0x0f,0x39,0x59,0x03,0x1f,0xd0,0x4b,0xdb,0x03,0x16,
-0x60,0xc6,0x09,0x37,0xc6,0x31,0x12,0x7b,0x0b,0x17,0x3f,0x18,0x4a,0x15,0x02,0xf6,
-0x08,0x19,0x0a,0x28,0xb6,0x04,0xce,0x6d,0x0b,0x46,0x6e,0x04,0xe9,0x44,0x0a,0x8d,
-0x15,0x13,0x04,0x8d,0x04,0x1a,0x0b,0x2e,0x18,0x04,0xc2,0xdf,0x0b,0x74,0x19,0x12,
-0x8f,0xde,0x01,0x06,0xf5,0x44,0x08,0xac,0x09,0x1b,0x75,0xb8,0x10,0x12,0x3f,0x77,
-0x03,0x1e,0x8f,0xd1,0xe0,0x06,0x67,0x03,0x1f,0xd0,0xc9,0x06,0x12,0x0e,0xc8,0xde,
-0x07,0xd2,0x00,0x1f,0xfa,0xe6,0x2a,0x03,0x1e,0xa0,0x39,0x2b,0x0f,0x2d,0x00,0x17,
-0x0e,0x5a,0x00,0x0e,0x87,0x00,0x0b,0xbb,0x04,0x1f,0xfc,0xe1,0x00,0x13,0x0f,0x0e,
-0x01,0x03,0x1f,0x05,0xfe,0x45,0x0c,0x03,0x6e,0x0e,0x11,0x99,0x01,0x00,0x1b,0x40,
-0x95,0x01,0x12,0x4f,0x68,0x01,0x1a,0x0a,0xbc,0x17,0x13,0x08,0x3c,0x00,0x0b,0x25,
-0x1c,0x19,0xdf,0x05,0xcf,0x29,0xfe,0x10,0xa1,0x17,0x04,0xb5,0x00,0x19,0xfc,0x2c,
-0x12,0x15,0xb0,0xe5,0x63,0x1a,0x30,0x9a,0x80,0x14,0xbf,0xa7,0x6c,0x34,0x20,0x01,
-0x37,0x8a,0x03,0x0e,0x62,0x0e,0x03,0x6d,0x02,0x1f,0x09,0xc9,0xdd,0x03,0x1f,0x0d,
-0xc4,0xde,0x03,0x1f,0x2e,0xf7,0x61,0x13,0x1f,0xfa,0xb1,0x03,0x09,0x05,0x9b,0x0e,
-0x0e,0xfc,0xb3,0x0e,0x4f,0x5c,0x09,0x38,0x04,0x2e,0xfe,0x60,0x65,0x04,0x0d,0x53,
-0xba,0x01,0x92,0x04,0x1e,0xda,0x86,0xba,0x09,0x5f,0x0b,0x1f,0x76,0x5f,0x0b,0xff,
-0xc1,0x6b,0x48,0xbd,0xef,0xfe,0xca,0x61,0x17,0x00,0x04,0xf4,0xf1,0x1a,0xa3,0x17,
-0x00,0x16,0x8f,0xa6,0x0d,0x07,0x17,0x00,0x17,0x2d,0xc8,0x6e,0x06,0x17,0x00,0x18,
-0x04,0x2f,0x06,0x06,0x17,0x00,0x1e,0x4f,0xf6,0x94,0x1f,0xfc,0x36,0x06,0x03,0x1f,
-0xfc,0xe3,0x50,0x03,0x1f,0xfc,0xa9,0x50,0x03,0x1f,0xfc,0xff,0x5f,0x03,0x1d,0xfc,
-0x8c,0xfb,0x03,0x17,0x00,0x14,0x2f,0x84,0x00,0x46,0x94,0x31,0x24,0x7d,0x17,0x00,
-0x18,0x9f,0x88,0x27,0x15,0x5e,0x17,0x00,0x09,0x8b,0x12,0x14,0x01,0xe3,0x08,0x0b,
-0x95,0x33,0x13,0x1e,0x17,0x00,0x1a,0x09,0x54,0x32,0x04,0x3f,0x53,0x0c,0x71,0x74,
-0x03,0x0d,0x0a,0x1b,0x1f,0xd9,0x1e,0x0a,0x8a,0x0c,0x1b,0xb0,0x17,0x00,0x0c,0x25,
-0x21,0x19,0xcf,0x9b,0x53,0x1b,0x30,0x17,0x00,0x1b,0xaf,0x9f,0x05,0x09,0x38,0x0b,
-0x1c,0xfe,0x17,0x00,0x08,0x8e,0x14,0x0d,0x17,0x00,0x1c,0xfb,0x17,0x00,0x1f,0xef,
-0x17,0x00,0x09,0x1f,0xfa,0x45,0x00,0x03,0x1f,0xfa,0x5c,0x00,0x14,0x1f,0xcf,0x17,
-0x00,0x03,0x0c,0x9b,0x06,0x0f,0xe6,0x00,0x0b,0x0c,0x0e,0xe6,0x03,0x17,0x00,0x1b,
-0x5f,0xff,0x1d,0x03,0x17,0x00,0x0c,0x57,0x23,0x03,0x17,0x00,0x04,0x29,0x0b,0x0b,
-0x17,0x00,0x04,0xaa,0xd8,0x0b,0xcc,0x01,0x1a,0x08,0x94,0x21,0x13,0x04,0x0f,0x00,
-0x0b,0x04,0x49,0x1b,0x1e,0xeb,0xee,0x19,0xf4,0x87,0x65,0x15,0xfc,0xeb,0x14,0x18,
-0x70,0x19,0x6d,0x15,0xfc,0xdf,0x11,0x56,0xfd,0x73,0x10,0x13,0x7c,0xb2,0x02,0x1f,
-0x09,0xe0,0x02,0x03,0x1f,0x01,0x15,0x79,0x04,0x1f,0x7f,0x17,0x00,0x03,0x1f,0x0c,
-0x17,0x00,0x03,0x0a,0x80,0x73,0x06,0x3e,0x34,0x09,0xd1,0x06,0x15,0x3f,0x17,0x00,
-0x08,0x1d,0xd5,0x26,0xe3,0x0d,0x0c,0x01,0x17,0x1c,0x22,0x04,0x17,0x0b,0x23,0x01,
-0x16,0x7f,0x50,0x04,0x18,0x09,0x0b,0x17,0x06,0x7e,0x04,0x19,0x08,0x51,0x01,0x10,
-0x38,0xac,0x04,0x2e,0x51,0x00,0x80,0x4b,0x7b,0x59,0xcd,0xef,0xff,0xec,0xa7,0x30,
-0x16,0x00,0x1e,0x7d,0x5e,0x67,0x0a,0x6b,0xdc,0x1e,0xc4,0x89,0x3b,0x0b,0x60,0xf8,
-0x2e,0x02,0xdf,0xf5,0xc0,0x0e,0xd0,0xe5,0x04,0x4e,0x02,0x1e,0x05,0xa0,0xd4,0x0e,
-0xfe,0xe5,0x0e,0x69,0xa8,0x0b,0xcb,0x1b,0x1e,0xcf,0x74,0x64,0x0f,0x9a,0xdc,0x04,
-0x17,0xf2,0x15,0x39,0x56,0xfb,0x62,0x11,0x25,0x9f,0x37,0x2e,0x18,0x09,0x12,0x08,
-0x15,0x19,0xd4,0x37,0x0a,0xe5,0xe4,0x15,0x07,0x4c,0x08,0x19,0x7f,0xfe,0x69,0x05,
-0xee,0x09,0x1f,0x0d,0xec,0x43,0x02,0x1c,0x20,0x2e,0x21,0x13,0x9f,0xda,0x04,0x1a,
-0x7f,0x5c,0x03,0x13,0x05,0x8e,0x00,0x1b,0x0b,0xe3,0x04,0x13,0x1f,0xed,0x00,0x0c,
-0x03,0x25,0x0a,0xe6,0x78,0x1b,0x70,0xd6,0x0a,0x13,0x14,0x0c,0x01,0x14,0x44,0x01,
-0x00,0x03,0xcc,0x99,0x0f,0x1b,0x2c,0x04,0x1f,0x47,0x99,0x72,0x04,0x1f,0x8f,0xa8,
-0x2b,0x1a,0x2f,0xf6,0x9f,0x2f,0x00,0x32,0x1f,0x68,0x2f,0x00,0x04,0x0f,0x8d,0x00,
-0x04,0x1f,0x66,0xd9,0x2d,0x04,0x1e,0x4f,0xdc,0x2e,0x0a,0x02,0x4d,0x0f,0x0f,0x0c,
-0x02,0x1e,0xf1,0xeb,0x4f,0x0f,0x5f,0x51,0x09,0x08,0xb6,0x24,0x17,0x50,0xf6,0x01,
-0x17,0xfb,0x36,0x25,0x17,0xb0,0x47,0x00,0x17,0xf9,0x19,0x23,0x1e,0x90,0x57,0x3d,
-0x32,0x00,0x01,0xaf,0x6b,0x00,0x1a,0x0c,0xf5,0x70,0x01,0xe6,0x58,0x17,0x60,0x06,
-0x0b,0x00,0xe2,0x17,0x04,0x84,0x7d,0x1e,0x40,0x44,0x77,0x05,0xe1,0x06,0x1f,0xdf,
-0x53,0x74,0x03,0x0f,0x42,0x7e,0x01,0x1f,0xc0,0x23,0x1a,0x03,0x1d,0xe1,0x5f,0xee,
-0x07,0x04,0x8e,0x0d,0x48,0x00,0x16,0xc1,0xc7,0x00,0x0f,0xe6,0x58,0x02,0x1e,0x5d,
-0x75,0x82,0x09,0xb1,0xdf,0x00,0x01,0x00,0x19,0xc5,0xcc,0x6a,0x1f,0xef,0x37,0x87,
-0x04,0x11,0x36,0x16,0x10,0x1f,0x96,0x57,0x38,0x02,0x0a,0x36,0x9f,0x75,0x6a,0xce,
-0xff,0xff,0xfd,0xb8,0x51,0x6d,0x13,0x0b,0x98,0x32,0x05,0x4f,0x17,0x1c,0xf6,0xe3,
-0x6b,0x1c,0xf5,0x51,0x7f,0x1c,0xf5,0xf5,0x00,0x1c,0xf5,0xeb,0x88,0x1c,0xf5,0x1f,
-0x05,0x1c,0xf5,0xcb,0x42,0x1c,0xf4,0xb8,0x1b,0x1c,0xf4,0xd0,0x52,0x18,0xf4,0x61,
-0x30,0x57,0xf9,0x41,0x00,0x12,0x41,0x54,0x00,0x2e,0xfb,0x10,0x4e,0x3c,0x0b,0x5c,
-0xe7,0x0e,0x80,0x26,0x0b,0x25,0x13,0x0c,0x0c,0x03,0x1f,0xf8,0x11,0x00,0x37,0x1c,
-0xaf,0x0c,0x19,0x0f,0x11,0x00,0x86,0x0e,0xff,0x00,0x0f,0x11,0x00,0xff,0xff,0x99,
-0x0e,0xe7,0x04,0x07,0xee,0x04,0x50,0xdf,0xff,0xff,0xec,0x84,0x36,0x00,0x10,0x22,
-0x01,0x00,0x19,0x21,0xc7,0xf6,0x00,0xb0,0x70,0x17,0xcf,0xc5,0x51,0x16,0xdf,0xad,
-0x70,0x16,0x0e,0x18,0x03,0x18,0x08,0x28,0x03,0x06,0xeb,0x0b,0x18,0x0b,0xf5,0x09,
-0x15,0x2f,0x2f,0x00,0x0a,0xed,0x45,0x05,0x2f,0x00,0x1f,0x0b,0x1b,0x1d,0x03,0x1f,
-0x07,0x53,0x5f,0x03,0x1f,0x03,0x5b,0x78,0x04,0x0e,0xea,0x16,0x08,0x4c,0x73,0x0c,
-0x2f,0x00,0x25,0x0d,0xff,0x3a,0x15,0x35,0x01,0x36,0xcf,0x2f,0x00,0x19,0x05,0x53,
-0x5f,0x15,0x3d,0x2f,0x00,0x1f,0xbf,0x64,0xcb,0x02,0x2a,0x90,0x1f,0x21,0x13,0x04,
-0xbe,0x95,0x1b,0x06,0x90,0x36,0x13,0x2f,0x2f,0x00,0x0c,0x80,0xc7,0x0a,0x33,0xe9,
-0x1b,0xf4,0x46,0x18,0x1c,0x91,0xbc,0x25,0x03,0x2f,0x00,0x1b,0x4f,0x8e,0x14,0x03,
-0x2f,0x00,0x1c,0x96,0xed,0x2b,0x03,0x2f,0x00,0x0c,0x5c,0xf3,0x03,0x2f,0x00,0x1c,
-0x99,0xc5,0x08,0x03,0x2f,0x00,0x03,0xea,0x00,0x0c,0x62,0x2e,0x1c,0x9b,0xf4,0x2b,
-0x09,0x46,0x19,0x1c,0xfd,0x2f,0x00,0x1c,0x9c,0x72,0x06,0x09,0x5e,0x00,0x1f,0xfc,
-0x5e,0x00,0x04,0x1c,0xd0,0x2f,0x00,0x1b,0xaf,0x52,0x0f,0x0a,0xbc,0x00,0x1c,0xf0,
-0x2f,0x00,0x1b,0x7f,0xc4,0x2c,0x0a,0x1a,0x01,0x1c,0xf5,0x2f,0x00,0x0c,0xcb,0x5b,
-0x04,0x25,0x56,0x0c,0xbc,0x42,0x03,0x2f,0x00,0x0b,0xb5,0x0b,0x05,0x2f,0x00,0x0c,
-0x8a,0x5d,0x03,0x2f,0x00,0x1f,0x04,0x05,0x02,0x04,0x1e,0x0f,0x34,0x02,0x08,0x77,
-0x06,0x1b,0xfc,0x63,0x02,0x19,0x03,0x92,0x02,0x15,0x4d,0x92,0x02,0x17,0x0c,0xc1,
-0x02,0x16,0x37,0xc1,0x02,0x0f,0xa4,0x62,0x03,0x1f,0xf9,0xd2,0xe3,0x04,0x1f,0x90,
-0x0a,0x82,0x03,0x1f,0xf9,0xda,0x71,0x04,0x1f,0x90,0xd7,0x71,0x03,0x1e,0xf9,0xcd,
-0xf4,0x0b,0x07,0x53,0x03,0x3a,0x01,0x07,0x51,0x07,0x17,0x05,0xd2,0x0e,0x06,0x9d,
-0x57,0x08,0x3a,0x91,0x1a,0xa1,0x84,0x08,0x15,0x3a,0x95,0xee,0x0b,0x24,0x5d,0x66,
-0x59,0xbe,0xff,0xfe,0xc9,0x61,0xc1,0x1b,0x0e,0x29,0xaa,0x0e,0xdd,0x0b,0x0f,0x06,
-0x34,0x06,0x09,0x2f,0x2e,0x2f,0x03,0xd2,0x20,0xcd,0x03,0x2e,0xdf,0xe3,0x81,0x60,
-0x01,0xd1,0x08,0x1c,0xf6,0x59,0x89,0x12,0x20,0x0a,0x17,0x2d,0xfc,0x30,0x58,0x48,
-0x02,0x0f,0x02,0x20,0xc6,0x20,0xca,0x1a,0x17,0xdf,0xfe,0x19,0x13,0x0d,0xca,0xf2,
-0x29,0xaa,0xac,0x93,0xa0,0x1f,0x09,0x39,0xe3,0x03,0x0e,0xa6,0x01,0x0b,0xfc,0x0b,
-0x0b,0x02,0x4b,0x1f,0x4f,0xa3,0x64,0x04,0x1e,0x3e,0x6c,0x64,0x0e,0xa9,0x79,0x07,
-0x69,0x64,0x2e,0x05,0xdf,0xf5,0x79,0x0d,0xb5,0x0b,0x18,0xa2,0x97,0x33,0x15,0x9d,
-0xb6,0x1c,0x1b,0x10,0x71,0x7a,0x00,0xd6,0xb9,0x3b,0xb9,0x74,0x00,0x4b,0x73,0x0c,
-0x74,0x10,0x0e,0x21,0x3e,0x0a,0x58,0x5f,0x0f,0x2d,0x00,0xff,0x9a,0x7b,0x02,0x6a,
-0xde,0xff,0xfd,0xb8,0x50,0x2d,0x00,0x17,0x5c,0x76,0xf2,0x05,0x2d,0x00,0x06,0xd3,
-0x85,0x17,0x91,0x2d,0x00,0x19,0x07,0x5d,0x0e,0x04,0x2d,0x00,0x1a,0x09,0x02,0x8d,
-0x03,0x2d,0x00,0x1a,0x6a,0x49,0x1d,0x04,0x99,0xa7,0x0b,0x05,0x03,0x1f,0x2f,0x0f,
-0x87,0x02,0x1f,0x02,0x33,0x91,0x03,0x0e,0x2d,0x00,0x06,0x44,0xab,0x0d,0xd4,0x1a,
-0x15,0x2f,0x26,0x03,0x44,0x53,0x12,0x35,0x8e,0xd3,0x03,0x19,0x02,0x69,0x03,0x14,
-0x08,0x8c,0x54,0x0a,0xc9,0x3e,0x04,0x17,0x00,0x1a,0x22,0x4a,0x06,0x04,0xfa,0x89,
-0x1a,0x2f,0x5b,0x15,0x19,0x7f,0x52,0x75,0x1a,0xf6,0x77,0x01,0x1b,0xf8,0x95,0x01,
-0x13,0x0f,0xa3,0x03,0x0b,0xc2,0x01,0x03,0x66,0x16,0x0b,0x2d,0x00,0x13,0x0d,0xf5,
-0xf3,0x0f,0x69,0x17,0x02,0x1f,0xfb,0x2d,0x00,0xff,0xff,0xa8,0x15,0xb0,0x60,0x88,
-0x54,0x02,0x9d,0xff,0xfe,0xb4,0xb5,0x1e,0x33,0xb0,0x00,0x06,0x77,0x07,0x04,0x31,
-0x15,0x13,0x7f,0xfc,0x0a,0x13,0xbf,0x1e,0x16,0x13,0xdf,0xb0,0x0b,0x04,0xae,0x9f,
-0x1a,0xbf,0xee,0xd3,0x14,0xd0,0xd4,0x5e,0x14,0x04,0xb0,0x13,0x14,0x4e,0xea,0x03,
-0x5f,0x6b,0xef,0xfd,0x92,0x00,0x01,0x00,0x16,0x12,0x01,0xa1,0xe1,0x05,0xf1,0x08,
-0x0f,0x08,0x00,0xff,0x7e,0x03,0x62,0x05,0x49,0x8c,0xef,0xec,0x81,0x27,0x0a,0x18,
-0x60,0x42,0x20,0x19,0xf7,0x29,0x0a,0x1a,0x20,0xe5,0xf3,0x0c,0x41,0x6b,0x18,0x01,
-0x95,0x5a,0x09,0x0d,0x00,0x0a,0x68,0x6b,0x09,0x2a,0x8f,0x18,0x4f,0xe1,0x0d,0x19,
-0x09,0x00,0x10,0x18,0x8f,0x90,0x16,0x5c,0x03,0xae,0xff,0xfe,0x92,0x5b,0x8b,0x0f,
-0x01,0x00,0x32,0x21,0x0c,0xcc,0x01,0x00,0x18,0x60,0x5b,0x06,0x1f,0x80,0x0d,0x00,
-0xff,0xff,0x98,0x09,0xcf,0x03,0x18,0x2f,0xc4,0x19,0x18,0x4f,0x0d,0x00,0x17,0x9f,
-0x67,0x25,0x18,0x02,0xc5,0x32,0x14,0x2d,0xa8,0x11,0x5c,0x47,0x54,0x33,0x5a,0xff,
-0x6e,0x1e,0x06,0xfe,0x36,0x04,0x71,0x11,0x18,0x7f,0x2c,0x59,0x18,0x7f,0xd0,0x0d,
-0x18,0x7f,0x9a,0x1c,0x18,0x7f,0x9f,0x4c,0x18,0x7f,0x77,0x90,0x18,0x7f,0xb8,0x4c,
-0x18,0x7f,0x90,0xde,0x13,0x7f,0xcc,0x2c,0x11,0x10,0x22,0x29,0x00,0xf7,0x18,0x2e,
-0xca,0x72,0xc8,0x2f,0x0f,0xcc,0x22,0x10,0x0f,0x18,0x00,0xff,0xc6,0x05,0xf4,0xe9,
-0x0a,0x18,0x00,0x15,0x2f,0x82,0x10,0x09,0x18,0x00,0x2b,0x01,0xef,0x3f,0x2f,0x1a,
-0xfc,0x32,0x3a,0x1b,0xf6,0x60,0x00,0x16,0xaf,0xd5,0x0c,0x08,0x18,0x00,0x17,0x08,
-0xba,0x1c,0x08,0x18,0x00,0x08,0x0f,0x11,0x07,0x18,0x00,0x18,0x03,0x03,0xfc,0x07,
-0x18,0x00,0x18,0x2e,0xf3,0x3a,0x07,0x18,0x00,0x18,0xdf,0x1f,0x0d,0x06,0x18,0x00,
-0x19,0x0b,0xac,0x1b,0x06,0x18,0x00,0x2e,0x9f,0xff,0x38,0x38,0x16,0xfc,0xa6,0x1d,
-0x1b,0xfa,0x38,0x01,0x1a,0x4f,0x1c,0x3b,0x1b,0xcf,0x16,0x25,0x2a,0xfd,0x10,0x18,
-0x00,0x1b,0x1e,0x83,0x9b,0x1b,0xcf,0xb6,0x2d,0x1a,0x30,0x18,0x00,0x1c,0x09,0x47,
-0x5c,0x0a,0x4e,0x23,0x0c,0xab,0x72,0x1d,0xfd,0x05,0x55,0x1f,0xcf,0x18,0x5f,0x04,
-0x1e,0xcf,0x1b,0xe2,0x0e,0x18,0x00,0x1e,0xf8,0x54,0xbc,0x0e,0xa9,0xc4,0x0f,0x60,
-0x00,0x10,0x2e,0xff,0xf7,0x18,0x00,0x0e,0xda,0xca,0x0e,0x49,0x00,0x0e,0x18,0x00,
-0x1f,0xf7,0x7d,0x9c,0x05,0x0a,0x38,0x01,0x0e,0x78,0x5f,0x1b,0xcf,0x5c,0x3a,0x1b,
-0xf8,0x18,0x00,0x19,0xfa,0xc8,0x74,0x06,0x18,0x00,0x1b,0xa0,0x64,0x6e,0x15,0xcf,
-0x61,0x01,0x19,0x7f,0x49,0x00,0x1e,0xcf,0xca,0x5a,0x08,0x98,0x01,0x07,0xb7,0x02,
-0x1c,0xd0,0x78,0x03,0x06,0x3e,0x8e,0x0a,0x18,0x00,0x18,0x0e,0x49,0x00,0x07,0x18,
-0x00,0x09,0x07,0x79,0x08,0x30,0x03,0x08,0x55,0x61,0x08,0x18,0x00,0x17,0x1e,0x49,
-0x00,0x08,0x18,0x00,0x17,0x06,0x49,0x00,0x09,0xa8,0x03,0x1c,0xbf,0xad,0x2f,0x1d,
-0xfc,0x9c,0x50,0x09,0x18,0x00,0x07,0xc8,0x64,0x0a,0x38,0x04,0x1b,0xdf,0x3f,0x88,
-0x1b,0xfc,0x40,0x3e,0x1b,0x30,0x18,0x00,0x1b,0x09,0x78,0x33,0x0c,0x9d,0xcb,0x1c,
-0xf8,0x18,0x00,0x1a,0x4f,0x7d,0xcf,0x1c,0xfc,0x21,0x4f,0x13,0xd0,0x2f,0x14,0x13,
-0x31,0x40,0x00,0x13,0x1f,0x6b,0x8e,0x0f,0x0f,0x00,0xff,0xfa,0x12,0x80,0x48,0x0f,
-0x05,0x96,0x2b,0x25,0xda,0x72,0x44,0x32,0x15,0x9c,0xdf,0x26,0x15,0x0c,0xf7,0x17,
-0x19,0x3a,0x4f,0x23,0x27,0x05,0xcf,0x81,0x8e,0x13,0xcf,0x90,0x0d,0x29,0x02,0xbf,
-0xd1,0xd0,0x18,0x4d,0xe9,0xa9,0x13,0x0c,0xed,0x23,0x1a,0x06,0xa6,0x21,0x07,0xe8,
-0x21,0x05,0x1e,0x07,0x2a,0xf2,0x09,0xfb,0x31,0x19,0xbf,0x81,0x17,0x03,0x49,0x00,
-0x1a,0x39,0x62,0x23,0x1e,0xbf,0xc8,0x33,0x0c,0x3b,0x3f,0x2a,0xa0,0xaf,0xb9,0x7c,
-0x0e,0x84,0x28,0x06,0x46,0xb7,0x05,0xc2,0x19,0x0e,0x3e,0x1d,0x0e,0xe2,0x14,0x0f,
-0x49,0x00,0x02,0x0c,0xf0,0x14,0x0f,0x49,0x00,0x10,0x25,0xfc,0x0c,0xdb,0x18,0x47,
-0x63,0x21,0x25,0x9e,0x87,0x00,0x25,0x52,0x12,0x2d,0xa2,0x14,0xf0,0x49,0x00,0x1a,
-0xb2,0x2f,0x65,0x18,0x91,0xb0,0x18,0x19,0x4c,0xc6,0x18,0x07,0xad,0xd1,0x07,0xce,
-0x04,0x1a,0xf7,0xb8,0xd3,0x0b,0x92,0x9d,0x19,0x8f,0xb0,0x1c,0x1a,0xe1,0x36,0x06,
-0x1a,0xe0,0xc5,0x48,0x1f,0xcf,0x02,0xa3,0x01,0x1a,0xf7,0x52,0x15,0x1a,0xcc,0xe0,
-0x06,0x1e,0x6f,0xbe,0x06,0x0d,0xc0,0x36,0x0b,0x91,0x3e,0x13,0x0b,0x02,0x1a,0x0a,
-0x49,0x00,0x09,0xe5,0x0f,0x05,0xc7,0xbf,0x1e,0xcf,0x18,0x2b,0x0f,0x49,0x00,0xff,
-0x39,0x1f,0x40,0x49,0x00,0x10,0x1f,0xf4,0x49,0x00,0xff,0xff,0xfc,0x02,0x6a,0x07,
-0x01,0x6e,0x0c,0x62,0x15,0x9b,0xef,0xff,0xed,0xa7,0xe6,0x43,0x06,0x8f,0x74,0x17,
-0xbf,0xf5,0xb0,0x14,0x1f,0x76,0x00,0x15,0x3c,0xa8,0x0c,0x15,0x40,0x2d,0x00,0x39,
-0xd0,0x00,0x7f,0xd3,0x1e,0x03,0xd4,0xc6,0x09,0xc7,0x20,0x14,0x60,0x2d,0x00,0x19,
-0xf0,0x16,0x07,0x05,0x22,0x20,0x09,0x08,0x07,0x06,0x30,0xa7,0x0b,0xb1,0x41,0x1f,
-0x1f,0x19,0x3e,0x02,0x1f,0x01,0x21,0xa3,0x03,0x1f,0x1f,0x5e,0x21,0x02,0x07,0x1a,
-0x98,0x44,0x32,0x12,0x48,0xef,0x44,0x00,0x19,0x1f,0xf7,0x2e,0x04,0xd0,0x00,0x1a,
-0x11,0xeb,0x0c,0x13,0x6f,0x91,0x04,0x1f,0x1f,0xb8,0x0c,0x02,0x2e,0x61,0xff,0x2b,
-0x06,0x06,0xda,0x08,0x1a,0x70,0xbf,0x0f,0x1b,0x91,0x44,0x0d,0x03,0x7e,0x00,0x0b,
-0x2d,0x00,0x19,0x0e,0x2d,0xdb,0x1b,0xf7,0x2b,0x19,0x0b,0x2d,0x00,0x13,0x0d,0x67,
-0xa3,0x0f,0x2d,0x00,0xff,0xff,0xa8,0x05,0x81,0x22,0x11,0x69,0xcb,0x32,0x1f,0x40,
-0x0d,0xf4,0x05,0x1a,0xfb,0xd2,0x53,0x1f,0x4c,0xc8,0xad,0x03,0x28,0x02,0xcf,0x52,
-0x04,0x1e,0x40,0x3b,0x6f,0x0b,0xee,0x34,0x1e,0x0a,0xf4,0x2e,0x0e,0xb5,0xbc,0x0e,
-0x21,0x32,0x0d,0x19,0x00,0x1f,0x07,0xb4,0x62,0x04,0x1f,0x04,0x8a,0xa7,0x05,0x0e,
-0x1e,0xde,0x02,0x8c,0x11,0x15,0x7f,0x79,0x0b,0x37,0x11,0x35,0xaf,0x60,0x24,0x18,
-0x0e,0xd0,0x0c,0x16,0x1b,0x93,0x0c,0x19,0x06,0x31,0x61,0x16,0x07,0x7c,0x00,0x19,
-0xdf,0xf5,0x26,0x06,0xdd,0x6a,0x1a,0x3f,0x49,0x0b,0x14,0x0d,0x96,0x01,0x0b,0x2e,
-0x0b,0x06,0xe2,0x49,0x0c,0xed,0x56,0x04,0xe3,0x55,0x0c,0x4f,0x59,0x04,0xb2,0x53,
-0x1c,0x04,0x75,0x22,0x04,0x75,0x7e,0x1f,0x7f,0xd4,0x2e,0x03,0x2c,0xfb,0x09,0x2d,
-0x28,0x13,0x0c,0x9f,0x05,0x1c,0xbf,0x7b,0x4f,0x03,0x9f,0x7d,0x1c,0x0c,0xec,0x12,
-0x19,0x08,0xf9,0xba,0x1d,0xfb,0x15,0x26,0x1c,0x1e,0x1f,0x3e,0x19,0x06,0x85,0xb5,
-0x1d,0xfa,0xe3,0x54,0x1c,0x2e,0x31,0x00,0x04,0xbe,0x7e,0x0f,0x62,0x00,0x05,0x1f,
-0x1c,0x93,0x00,0x05,0x0d,0xf1,0x83,0x03,0xd5,0x01,0x0f,0xf5,0x00,0x06,0x0c,0x23,
-0x29,0x04,0x26,0x01,0x1c,0x04,0x24,0x29,0x1a,0x2f,0xed,0x1c,0x1c,0xa0,0x11,0x43,
-0x0d,0x72,0x56,0x13,0xcf,0x5a,0x00,0x1b,0x09,0xa1,0x01,0x14,0x3f,0xd1,0x07,0x1a,
-0x4f,0x1b,0x02,0x1c,0x0b,0x55,0xa1,0x1c,0xa0,0x99,0xbe,0x06,0x41,0xa1,0x08,0x32,
-0x28,0x16,0xc0,0x9c,0x35,0x1c,0xb1,0x22,0x76,0x14,0x8f,0x72,0x07,0x48,0x52,0x00,
-0x14,0x9e,0x1f,0x6b,0x1f,0xef,0xf5,0x32,0x04,0x0e,0x41,0x03,0x0b,0x93,0x23,0x0d,
-0xb4,0x14,0x1f,0x0b,0xa3,0x03,0x04,0x0e,0x19,0x00,0x1e,0xe2,0xed,0x03,0x0a,0x18,
-0xc0,0x1e,0x07,0xb4,0x9d,0x0e,0xeb,0x9a,0x0a,0x3e,0xba,0x07,0x6d,0xa1,0x1a,0xe8,
-0xb0,0x9a,0x05,0xce,0x03,0x1c,0x60,0xcf,0x62,0x66,0x7a,0xce,0xef,0xff,0xec,0xa8,
-0x5a,0xf1,0x09,0x44,0x43,0x06,0xf0,0x47,0x12,0x8b,0x3b,0xe1,0x05,0x83,0x4e,0x09,
-0xf0,0x47,0x16,0xe0,0xef,0xbb,0x08,0xf0,0x47,0x2f,0xf0,0x03,0xf0,0x47,0x02,0x1f,
-0xf1,0xf0,0x47,0x03,0x1f,0xf6,0xf0,0x47,0x28,0x1f,0xe1,0x17,0x00,0x03,0x1e,0xfa,
-0xf8,0x2d,0x09,0x79,0x14,0x0d,0xc3,0x01,0x05,0x17,0x00,0x46,0xb7,0x42,0x13,0x59,
-0x7c,0x11,0x09,0x6d,0x10,0x1c,0x09,0x16,0x11,0x1a,0xf9,0xbf,0x6c,0x04,0x17,0x00,
-0x0b,0xfd,0x04,0x1b,0x40,0xcb,0x04,0x13,0xef,0x0d,0x06,0x0b,0xbb,0x14,0x04,0x26,
-0x22,0x0f,0x3b,0x46,0x03,0x1e,0xf0,0xe9,0x14,0x0b,0xea,0x3d,0x09,0xf4,0x5a,0x0f,
-0xc5,0x46,0x03,0x1f,0xf8,0x07,0x48,0x1a,0x1f,0xfb,0x07,0x48,0x14,0x0e,0x1e,0x48,
-0x0f,0xab,0x47,0x20,0x1f,0xcf,0x17,0x00,0x1a,0x0f,0xd9,0x47,0x04,0x0e,0x90,0x11,
-0x07,0x67,0x0c,0x1e,0xf9,0x1b,0x49,0x0e,0x14,0x01,0x06,0xc5,0x5f,0x0f,0x77,0x49,
-0x03,0x1f,0xf3,0x9e,0x01,0x13,0x13,0x6f,0x57,0x02,0x0b,0xfa,0x01,0x13,0xdf,0x49,
-0x04,0x0a,0x28,0x02,0x1b,0x07,0x49,0xe6,0x1a,0xf9,0xc8,0x68,0x0a,0x84,0x02,0x15,
-0x07,0xa3,0x19,0x05,0xb2,0x02,0x17,0xa5,0x41,0x43,0x1f,0xf1,0xef,0x30,0x05,0x0f,
-0x17,0x00,0x02,0x04,0xef,0x1b,0x0d,0x6c,0x19,0x1f,0xcf,0xea,0xa4,0x03,0x1f,0xcf,
-0x0b,0x38,0x03,0x1f,0xcf,0x08,0xaa,0x03,0x0a,0x43,0x3f,0x0c,0x8a,0x18,0x1b,0x05,
-0x09,0x38,0x04,0x42,0x01,0x05,0xea,0xaf,0x0b,0x18,0x19,0x19,0x4c,0xde,0x04,0x0e,
-0x9c,0x4c,0x0f,0x20,0x43,0xff,0xa8,0x07,0x19,0x43,0x2c,0xda,0x62,0x8c,0x34,0x03,
-0xae,0x07,0x41,0xb4,0x00,0x00,0x01,0x88,0x06,0x1a,0xb8,0x58,0x7a,0x36,0xb1,0x00,
-0x05,0x55,0x00,0x17,0x3d,0x91,0x2e,0x15,0x07,0x17,0x00,0x18,0x05,0x18,0x39,0x15,
-0x0a,0x17,0x00,0x09,0x00,0x34,0x14,0x3d,0x17,0x00,0x0a,0x45,0x34,0x05,0x81,0x3f,
-0x1f,0x0e,0xaf,0x3f,0x03,0x1f,0x9f,0x17,0x00,0x02,0x1f,0x03,0x0b,0x40,0x03,0x1f,
-0x0b,0x17,0x00,0x03,0x15,0x3f,0x19,0x43,0x36,0x21,0x13,0x6b,0x17,0x00,0x18,0xaf,
-0x33,0x0c,0x1e,0x2b,0x19,0x43,0x09,0x5d,0x6a,0x1f,0x05,0x62,0x76,0x02,0x2a,0xfc,
-0x0a,0xbe,0x39,0x1a,0x01,0x15,0xbf,0x0c,0x5b,0x1e,0x06,0x4b,0x75,0x0e,0x19,0x43,
-0x0e,0xa9,0x41,0x0c,0x0a,0x62,0x0a,0x19,0x43,0x1f,0x20,0x19,0x43,0x19,0x1f,0xfd,
-0x19,0x43,0x31,0x1f,0xfa,0x19,0x43,0x48,0x0d,0x8a,0x00,0x0c,0x5e,0x0b,0x0a,0xfd,
-0x00,0x0f,0x19,0x43,0x69,0x03,0x17,0x00,0x0b,0x9e,0xc9,0x1b,0x02,0x19,0x43,0x1b,
-0x70,0xd8,0x92,0x0a,0xca,0x6e,0x05,0xe0,0x7c,0x08,0x9e,0x81,0x05,0x98,0x05,0x09,
-0x19,0x43,0x2f,0x02,0x5b,0x19,0x43,0x62,0x06,0xc1,0x0b,0x0e,0xd1,0x32,0x0d,0x19,
-0x43,0x08,0x0c,0x09,0x17,0x2c,0x24,0x1b,0x0f,0x69,0x47,0x02,0x19,0xc2,0xa5,0x04,
-0x04,0x19,0x43,0x1c,0xc5,0xbc,0x04,0x14,0x38,0xac,0x04,0x0f,0x91,0x49,0xff,0xaa,
-0x06,0x95,0x16,0x43,0x49,0xce,0xff,0xdb,0xba,0xaa,0x03,0x9f,0xae,0x13,0xfe,0xb1,
-0x0c,0x03,0xf4,0x10,0x13,0xdc,0xd7,0x04,0x18,0x1d,0x8f,0x0a,0x38,0xf3,0x0c,0xff,
-0x1d,0x00,0x28,0x49,0xff,0x1d,0x00,0x29,0xf9,0xff,0xf8,0x1b,0x04,0x9c,0x02,0x0a,
-0x2b,0x09,0x0f,0x1d,0x00,0x0a,0x1a,0xbc,0xc1,0x54,0x0e,0x1d,0x00,0x05,0xa8,0x9a,
-0x25,0x67,0x97,0xce,0x22,0x08,0xb4,0x1e,0x04,0xa9,0x50,0x0a,0x26,0x7d,0x0b,0xa3,
-0x95,0x0a,0x83,0x05,0x0b,0xe3,0x10,0x0a,0x40,0x01,0x0f,0x1d,0x00,0xff,0xb0,0x09,
-0x5c,0x37,0x0b,0x78,0x5e,0x2e,0x39,0xef,0x29,0x10,0x09,0x76,0x5e,0x05,0xcc,0x2e,
-0x1e,0x1a,0xe4,0xc9,0x0a,0x72,0x05,0x06,0x4a,0x07,0x1e,0x4f,0xe3,0x10,0x0e,0x0a,
-0x44,0x02,0x87,0x26,0x1f,0x1e,0x58,0x11,0x02,0x1e,0xbf,0x9e,0x0c,0x07,0x9d,0x11,
-0x36,0xec,0xbc,0xef,0xcb,0x0c,0x16,0x0b,0xf7,0xaf,0x05,0x98,0xc7,0x14,0x80,0xad,
-0x06,0x18,0xd1,0x49,0x4c,0x1a,0xe0,0x48,0x91,0x05,0xc8,0xd7,0x07,0x15,0x90,0x07,
-0x24,0x69,0x1e,0xbf,0x18,0x92,0x05,0x02,0x10,0x1b,0xf4,0x1f,0x52,0x19,0xcf,0xcd,
-0x14,0x04,0x5c,0x2b,0x1e,0xaf,0xa0,0x74,0x06,0x74,0x06,0x1e,0xc1,0xbe,0x76,0x0e,
-0xbd,0xb0,0x17,0x0e,0xdc,0x55,0x0f,0xa2,0x8b,0x01,0x3e,0xfe,0xb7,0x40,0x92,0x85,
-0x01,0x1d,0xf4,0x1e,0x30,0x42,0xb3,0x08,0x44,0xf3,0x0b,0xa1,0x16,0x1f,0xc5,0x65,
-0x9e,0x03,0x18,0xc3,0x0e,0xbc,0x0d,0xf9,0x86,0x1f,0x09,0x40,0x51,0x03,0x1e,0x29,
-0xc6,0x12,0x0e,0x76,0xb0,0x15,0xf7,0x94,0x02,0x05,0x5e,0xcb,0x0b,0xf8,0xd5,0x2f,
-0x7b,0xef,0xad,0x85,0x02,0x2f,0x03,0x7d,0x76,0x86,0x03,0x1e,0x3a,0x3f,0xe5,0x07,
-0x19,0x22,0x30,0xf8,0x13,0x33,0x01,0x00,0x1b,0x31,0x86,0x6a,0x0b,0xd8,0x95,0x18,
-0x9f,0x8a,0x09,0x0b,0x98,0x90,0x2a,0xfd,0x1f,0xce,0x09,0x19,0x6f,0x6d,0x4e,0x19,
-0x80,0x42,0x00,0x1a,0xfa,0xa9,0x6b,0x04,0x89,0x3c,0x19,0x02,0x9f,0x4c,0x14,0x1d,
-0x7e,0x02,0x17,0xbf,0x28,0xcf,0x15,0x28,0x10,0x27,0x05,0x27,0x38,0x36,0xdc,0xbb,
-0xce,0x3a,0x13,0x0e,0xf8,0x17,0x06,0x29,0x91,0x0d,0x88,0x0f,0x1f,0x0c,0x9a,0xa0,
-0x03,0x0e,0xf6,0xbe,0x0e,0xe0,0x14,0x05,0x82,0x4b,0x1e,0x3c,0xc8,0x18,0x0e,0xd7,
-0x3b,0x0e,0x4c,0x04,0x2d,0xfc,0x71,0x78,0x04,0x46,0xfd,0xca,0x74,0x10,0xac,0x02,
-0x03,0x93,0x97,0x0e,0x23,0x3a,0x0e,0x49,0x3a,0x0f,0x1f,0x00,0x87,0x1b,0x08,0x10,
-0x25,0x0b,0x66,0x4a,0x1f,0x18,0x1f,0x00,0x68,0x1f,0x10,0x55,0x01,0xa6,0x0f,0x1f,
-0x00,0xd1,0x1b,0x70,0xa2,0x14,0x0c,0x2f,0x5c,0x0d,0xf0,0xbe,0x0a,0x11,0x83,0x4b,
-0xc6,0x43,0x44,0x64,0xca,0x03,0x1a,0x90,0x3f,0x18,0x1b,0xf9,0xf7,0x56,0x1a,0x90,
-0x2b,0x2d,0x0c,0x72,0x41,0x09,0x19,0x87,0x04,0x90,0x00,0x1e,0x1e,0x14,0x40,0x09,
-0xaf,0x00,0x1b,0x1c,0x16,0x04,0x1b,0x05,0x6a,0x2d,0x00,0xa2,0x13,0x4c,0xff,0xed,
-0xb8,0x51,0x14,0x01,0x1e,0x0e,0x9b,0x39,0x07,0x7c,0x16,0x0f,0x2d,0x00,0xff,0xff,
-0xa8,0x0c,0x70,0x20,0x03,0x2d,0x00,0x0b,0x9d,0x44,0x04,0xe9,0x9c,0x0b,0xb7,0x31,
-0x03,0x2d,0x00,0x0b,0x00,0x04,0x04,0x28,0x77,0x19,0xdf,0x32,0x12,0x13,0x0c,0xbd,
-0x08,0x0a,0xe6,0x13,0x2a,0x0b,0xff,0x99,0x88,0x28,0xfc,0x10,0x8a,0x2c,0x15,0xfb,
-0x7c,0x0b,0x26,0x84,0x10,0xd7,0x62,0x3f,0xff,0xb0,0x0f,0x8b,0xc4,0x03,0x1f,0x9f,
-0x15,0x83,0x02,0x1f,0x03,0x2d,0x00,0x03,0x1f,0x0b,0x42,0x83,0x03,0x0e,0x15,0x41,
-0x08,0xb6,0xc9,0x09,0x7e,0xe1,0x1a,0xb0,0x16,0x54,0x2b,0xe2,0x4f,0xb1,0xea,0x02,
-0x30,0x0b,0x16,0x03,0x3d,0x19,0x17,0x3d,0x8b,0x0a,0x07,0x46,0x9a,0x25,0x06,0xcf,
-0xba,0xb7,0x06,0x63,0x26,0x04,0x89,0x04,0x01,0x7b,0x26,0x03,0xfb,0x0f,0x1b,0x3f,
-0x68,0x05,0x04,0x13,0xb0,0x0c,0x48,0xd0,0x04,0x66,0x13,0x0c,0xad,0x20,0x04,0x33,
-0x15,0x1b,0x03,0xb2,0x51,0x1b,0x5f,0x34,0xc4,0x0b,0x85,0x1f,0x1c,0x40,0x14,0x75,
-0x05,0xc8,0x67,0x1a,0x3f,0x42,0x3c,0x05,0x68,0x05,0x1e,0x0d,0xbe,0xde,0x08,0xaf,
-0xaa,0x19,0xf1,0xfc,0x01,0x15,0xe0,0x63,0x0d,0x1c,0xf5,0xe5,0x9e,0x0a,0x9b,0x5e,
-0x07,0x18,0x2b,0x18,0x8f,0xf4,0x20,0x07,0x0d,0x00,0x18,0x3f,0x3d,0x21,0x16,0xdf,
-0xf7,0x05,0x17,0x0d,0xc1,0x06,0x08,0x9f,0x9d,0x17,0x08,0x70,0x01,0x17,0x05,0x5e,
-0x01,0x17,0x03,0x78,0x20,0x18,0x0a,0x2f,0x06,0x1d,0xdf,0x8b,0x9e,0x1c,0x30,0x13,
-0x71,0x18,0x2f,0x9c,0x00,0x16,0x3f,0xed,0x02,0x18,0x7f,0x67,0x06,0x16,0x0d,0xf0,
-0x08,0x18,0xbf,0xca,0x2b,0x16,0x08,0xa5,0x03,0x0f,0xbc,0x2d,0x01,0x15,0xa0,0x4e,
-0x0e,0x19,0x80,0xa4,0x1b,0x16,0xe0,0xe4,0x9b,0x09,0xaf,0x0d,0x05,0x34,0xcc,0x1a,
-0xfe,0xcb,0x07,0x14,0xf7,0x0d,0x02,0x1a,0xf8,0xef,0x5f,0x15,0xfb,0x5e,0x9b,0x0b,
-0x64,0x02,0x2b,0x00,0x00,0xe3,0x9a,0x1a,0x02,0x76,0xd8,0x1b,0x80,0xec,0x1c,0x2c,
-0x90,0x03,0xc7,0x22,0x13,0x7f,0xe9,0x32,0x0c,0xea,0x21,0x18,0x2f,0x93,0x61,0x1c,
-0xf8,0x80,0x60,0x2c,0xf6,0x0f,0xdf,0x48,0x12,0x07,0x13,0x02,0x1c,0x4f,0x71,0x60,
-0x03,0x93,0x9f,0x1d,0x9f,0xb1,0x79,0x1e,0xdf,0xb7,0x93,0x0c,0x33,0x6e,0x1e,0xfd,
-0x08,0xf2,0x0e,0x80,0x4e,0x1e,0x0d,0x97,0xfd,0x0c,0xff,0x20,0x1e,0xd0,0xce,0x95,
-0x0e,0x40,0x7a,0x07,0xd1,0x08,0x1e,0x20,0x49,0x8d,0x0e,0x26,0x78,0x06,0x91,0x00,
-0x1e,0xf8,0x74,0x94,0x0e,0x4a,0x61,0x07,0x91,0x00,0x1e,0xd0,0x5f,0x96,0x0e,0x9a,
-0x85,0x0e,0xcc,0x92,0x0c,0x91,0x00,0x0d,0xfe,0x85,0x0e,0x29,0xd2,0x09,0x91,0x00,
-0x1e,0xf2,0x4c,0x87,0x0a,0x8f,0x00,0x19,0x9f,0x3f,0x00,0x18,0x0d,0xe1,0x01,0x03,
-0x3d,0x03,0x09,0xd4,0x70,0x04,0x69,0x72,0x0a,0x36,0x58,0x04,0x4a,0x2b,0x07,0xd8,
-0x0e,0x1a,0xfc,0xb9,0x63,0x2e,0x00,0xcf,0x6e,0x04,0x19,0xf1,0xaa,0x00,0x29,0x20,
-0x08,0xd9,0x04,0x09,0x24,0x1a,0x04,0x7f,0x03,0x18,0x4f,0x7b,0x01,0x18,0x4f,0x90,
-0x04,0x05,0xd1,0x9f,0x08,0xad,0x00,0x09,0xd3,0x6f,0x14,0x05,0xce,0x03,0x18,0x0c,
-0xad,0x00,0x18,0xdf,0x8c,0x02,0x14,0x9f,0x33,0x01,0x17,0x8f,0xa0,0x00,0x1e,0x2f,
-0xa5,0xaa,0x15,0xfe,0xfa,0x03,0x1e,0x50,0x9f,0x88,0x05,0x1d,0x04,0x08,0x03,0x9f,
-0x09,0xec,0x94,0x1b,0x2f,0xad,0x22,0x18,0xb0,0x83,0x55,0x17,0xf5,0x5b,0x11,0x14,
-0x20,0xf3,0x03,0x19,0xfe,0x99,0x27,0x16,0xa0,0xac,0x00,0x15,0xd0,0x08,0x01,0x18,
-0xf2,0xdc,0x1c,0x16,0xfe,0xac,0x00,0x1a,0xf9,0x4d,0x01,0x19,0x0d,0x85,0x75,0x06,
-0x18,0x00,0x15,0x0c,0xad,0x00,0x19,0x02,0xa4,0x11,0x16,0x3f,0x0a,0x01,0x15,0x8f,
-0xe5,0x00,0x18,0x7f,0x30,0x19,0x16,0x06,0x98,0x02,0x1c,0x04,0x8e,0x91,0x03,0x3b,
-0x00,0x16,0x9f,0xb5,0x05,0x15,0x0f,0xad,0x00,0x09,0x53,0x10,0x17,0x0d,0x74,0x06,
-0x14,0xbf,0x15,0x00,0x11,0x4f,0x06,0x05,0x04,0xc5,0x00,0x1b,0xff,0xb5,0x75,0x23,
-0xff,0xf9,0xe1,0x01,0x23,0xfa,0x5f,0xe5,0x01,0x17,0x3f,0xda,0x02,0x14,0x3f,0xad,
-0x00,0x16,0xdf,0xf3,0x2c,0x38,0x20,0x00,0x06,0x7d,0x0c,0x04,0xad,0x00,0x16,0x2f,
-0x89,0x34,0x05,0x54,0x6f,0x17,0x50,0xa7,0x02,0x37,0xf2,0x00,0x07,0x7f,0x3f,0x13,
-0xc0,0xac,0x00,0x18,0xf1,0x97,0x03,0x12,0x60,0xb5,0x00,0x28,0x70,0x02,0x68,0xf2,
-0x09,0x2b,0xf0,0x03,0x29,0xab,0x38,0xf2,0x00,0x0d,0xc0,0xf4,0x19,0x90,0x64,0xf5,
-0x18,0x04,0x45,0xa7,0x29,0x90,0x07,0x8c,0x12,0x17,0xbf,0xe9,0xb2,0x38,0x90,0x00,
-0x04,0xb9,0x2e,0x18,0x10,0xd9,0x03,0x28,0xf3,0x0e,0x2b,0xa3,0x03,0xb0,0xa1,0x19,
-0xd0,0x37,0x27,0x14,0x62,0xa5,0x01,0x01,0x3f,0x00,0x1a,0x71,0xce,0x04,0x07,0xf5,
-0x50,0x13,0xa0,0xdc,0x01,0x29,0xfb,0x4f,0x71,0x08,0x02,0x15,0x01,0x14,0xcb,0xc3,
-0x02,0x11,0x1f,0x3f,0x00,0x0a,0x4e,0x13,0x07,0xce,0x05,0x05,0x70,0x3d,0x1e,0xef,
-0x6b,0xa8,0x06,0x36,0x03,0x1e,0x07,0x9f,0x05,0x07,0x38,0x1f,0x08,0x96,0xa6,0x09,
-0x38,0x73,0x1a,0xaf,0xbd,0x05,0x1f,0xef,0x9b,0x78,0x09,0x1a,0xe0,0x6f,0x14,0x1e,
-0xc0,0xd2,0x05,0x1a,0xf9,0xec,0x14,0x1e,0xf8,0xfb,0x92,0x03,0x04,0x01,0x0e,0x43,
-0x93,0x06,0x65,0x2b,0x1e,0xf0,0x0f,0x00,0x0f,0x5d,0xa0,0x03,0x1e,0x6f,0x6a,0x93,
-0x1a,0x02,0x47,0x79,0x1e,0x01,0x23,0x06,0x0c,0xb0,0x98,0x1e,0x0c,0x0d,0x9c,0x06,
-0x83,0x1d,0x0a,0x8c,0x01,0x0e,0x3d,0x5c,0x04,0x43,0x10,0x0e,0xe0,0xb1,0x06,0x74,
-0xb5,0x0d,0x14,0xd5,0x0e,0x66,0x7a,0x0f,0x3a,0x83,0x07,0x09,0xad,0x09,0x0a,0xb4,
-0xa7,0x0a,0x15,0x01,0x0b,0xa6,0x54,0x2e,0xfb,0x00,0x29,0x07,0x0b,0xdf,0x00,0x1e,
-0x70,0xe2,0x16,0x1a,0xb0,0xdf,0x00,0x1b,0xf3,0x9f,0x40,0x1a,0x00,0x10,0x00,0x1c,
-0x10,0x39,0x07,0x15,0x04,0x96,0x08,0x1f,0x7f,0xf7,0xa9,0x02,0x15,0xa0,0x0a,0x00,
-0x1c,0x90,0xba,0xb1,0x19,0x04,0xb3,0x07,0x07,0x00,0x97,0x09,0x9e,0xb1,0x08,0x58,
-0x1f,0x08,0x5f,0x01,0x18,0x01,0x59,0x15,0x08,0x89,0xf0,0x18,0xaf,0xb8,0xd5,0x07,
-0x5c,0xe7,0x09,0x5c,0xe9,0x07,0x2d,0xf0,0x19,0x0b,0x5b,0x11,0x06,0xc3,0x64,0x1a,
-0x04,0x1d,0x54,0x04,0xed,0xd7,0x0d,0x0a,0xda,0x04,0x40,0xef,0x05,0x4e,0x28,0x0c,
-0xff,0xd9,0x0c,0x54,0x56,0x1a,0x08,0x39,0x91,0x1c,0xfb,0x85,0x8c,0x2f,0xf4,0xff,
-0xc2,0xed,0x07,0x0b,0xd8,0x02,0x1c,0xdf,0x9e,0x69,0x0e,0xbd,0x61,0x0a,0x15,0x50,
-0x1e,0x0a,0xad,0x96,0x0d,0x32,0x0a,0x0a,0x93,0x83,0x1e,0x8f,0x4f,0x9e,0x0c,0xd9,
-0x96,0x1e,0xf1,0x97,0x96,0x0f,0xec,0x09,0x0a,0x1f,0xfe,0x96,0x9e,0x05,0x1e,0x50,
-0x91,0xaf,0x0e,0xd7,0x50,0x08,0xf7,0x00,0x1e,0xe1,0xc7,0x97,0x0e,0x79,0x82,0x09,
-0xe9,0x1a,0x1e,0x20,0x8f,0xa0,0x0f,0x3d,0x03,0x06,0x0e,0x6f,0x78,0x1e,0xcf,0xef,
-0x40,0x0e,0x31,0xa1,0x1e,0x70,0x70,0x0b,0x0c,0x76,0x60,0x1e,0x07,0x08,0xe7,0x09,
-0xbc,0x04,0x1c,0x6f,0x12,0x55,0x04,0xd5,0x02,0x1e,0x9f,0x1e,0x7e,0x02,0x04,0x9f,
-0x0b,0xf6,0xea,0x05,0xcb,0x56,0x1a,0x07,0x73,0x01,0x15,0x06,0xd5,0x02,0x05,0x0f,
-0x30,0x0c,0xba,0x9a,0x0a,0x25,0xdd,0x1c,0x8f,0x0a,0x80,0x03,0x06,0x02,0x16,0x2f,
-0x77,0x09,0x18,0x03,0x37,0x02,0x08,0x91,0x6c,0x08,0xb2,0xe9,0x06,0x28,0x04,0x06,
-0x7d,0x0b,0x1a,0xf6,0x28,0x04,0x06,0xc1,0x01,0x1d,0xe0,0xe2,0xb5,0x15,0xef,0xfb,
-0x02,0x1e,0x1e,0x0c,0xae,0x08,0xaa,0xf3,0x2a,0xfe,0x00,0xab,0x11,0x06,0xdb,0x71,
-0x0c,0xb1,0x9b,0x1b,0xbf,0xc7,0x01,0x13,0xaf,0x10,0x00,0x03,0xd4,0x9d,0x1b,0x60,
-0xc4,0xb0,0x2c,0x87,0x08,0x12,0x06,0x04,0x53,0x2a,0x0c,0xde,0xeb,0x1b,0x1f,0x97,
-0x2f,0x1c,0x90,0x5e,0xdb,0x0b,0x94,0x01,0x06,0xe9,0x9b,0x0b,0x3f,0x06,0x06,0x84,
-0xdd,0x1e,0xcf,0x03,0x70,0x01,0x8a,0x00,0x0b,0x3c,0xde,0x06,0x7c,0xc1,0x19,0x1f,
-0x3e,0x01,0x16,0x0d,0xa2,0x00,0x09,0x87,0x79,0x16,0x02,0x89,0x00,0x04,0x13,0x8c,
-0x09,0x49,0x03,0x17,0x90,0x6f,0x2b,0x09,0x93,0x2b,0x09,0x5a,0x11,0x0b,0x08,0xb6,
-0x18,0x05,0xd5,0x02,0x08,0x7d,0x88,0x08,0x21,0x89,0x09,0xf3,0x57,0x1d,0xaf,0x8d,
-0x08,0x1b,0xfd,0xce,0xb0,0x05,0xb7,0x01,0x18,0x70,0x2c,0x06,0x19,0xc0,0xef,0xb5,
-0x07,0x08,0x06,0x0b,0xae,0x46,0x09,0x9d,0x11,0x0a,0xb3,0x34,0x06,0x4f,0x70,0x1a,
-0x06,0xcc,0x04,0x06,0x91,0x11,0x19,0xaf,0x63,0x01,0x15,0x03,0xb9,0x00,0x1f,0x0f,
-0xca,0x50,0x02,0x15,0x80,0xa1,0x71,0x0a,0x41,0x05,0x14,0xfd,0x9d,0x00,0x1b,0xfb,
-0x65,0x04,0x03,0xdb,0x0a,0x07,0xa5,0x55,0x1a,0x0d,0xc1,0xdd,0x06,0xf9,0x07,0x04,
-0x26,0xaf,0x1b,0x7f,0x51,0x27,0x04,0x7b,0x39,0x1c,0x0c,0x46,0x05,0x19,0x0c,0x1d,
-0xbe,0x0d,0x55,0x09,0x2c,0xf9,0x5f,0x15,0x33,0x13,0x01,0xe1,0x22,0x0d,0x40,0x88,
-0x1e,0x0b,0x69,0x06,0x0e,0x9b,0x06,0x1e,0xf9,0x8e,0xa0,0x0e,0x89,0x88,0x1e,0x0a,
-0x49,0x00,0x0d,0x44,0x05,0x0a,0xff,0x89,0x0f,0x9a,0x06,0x05,0x1e,0x0a,0xf3,0xa5,
-0x0c,0x78,0x1f,0x1e,0xf8,0x8c,0x9d,0x0e,0x27,0x10,0x08,0x08,0x06,0x1e,0xd0,0x9a,
-0x06,0x0e,0x28,0x10,0x08,0x4a,0x00,0x1e,0x20,0xcb,0x94,0x0e,0x2f,0x94,0x07,0x4a,
-0x00,0x0d,0x71,0x10,0x0d,0x84,0xa9,0x0f,0x69,0x96,0x0d,0x0e,0x5f,0xdf,0x0f,0xac,
-0x8c,0x09,0x06,0x6d,0x06,0x1e,0xb0,0xac,0x95,0x0e,0xf9,0x95,0x08,0x31,0x00,0x0f,
-0x74,0x95,0x05,0x0e,0xb2,0x97,0x1f,0x3f,0x49,0x00,0x04,0x1e,0x09,0x49,0x00,0x09,
-0x7a,0xaf,0x0e,0xbb,0x95,0x0e,0xdf,0x97,0x07,0x1c,0x02,0x1f,0xfe,0x6d,0xc6,0x12,
-0x4e,0x01,0x33,0x34,0x6a,0x60,0xe4,0x09,0x1e,0x08,0x1e,0xfb,0xc1,0x9f,0x0e,0x32,
-0x8b,0x08,0x31,0x00,0x1e,0xc0,0x31,0x00,0x0e,0xb3,0x5c,0x07,0x31,0x00,0x1e,0xf8,
-0xce,0x12,0x0e,0x3c,0x99,0x07,0x31,0x00,0x1e,0xfc,0xba,0x99,0x0b,0x38,0x66,0x0a,
-0x31,0x00,0x1f,0xf7,0xb3,0x01,0x04,0x1d,0x91,0x22,0x01,0x6f,0x15,0x8c,0xde,0xff,
-0xec,0x85,0x3c,0x52,0x13,0x1f,0xdf,0x7e,0x3d,0x01,0x1f,0x0d,0x85,0xdd,0x01,0x0f,
-0x2b,0x00,0x83,0x2f,0x70,0x0d,0x0f,0x19,0x02,0x1f,0xdf,0x59,0xe7,0x08,0x0f,0xaa,
-0x9b,0x07,0x1e,0xcf,0x6a,0x01,0x06,0xcf,0x67,0x0f,0xfe,0x9a,0x0f,0x1e,0x2e,0xb2,
-0x04,0x0f,0xab,0x9b,0x04,0x1f,0x09,0xe1,0xaf,0x09,0x1e,0xd1,0x97,0x0a,0x0f,0xa9,
-0x00,0x04,0x1f,0xf6,0x00,0x9d,0x0f,0x1e,0x5f,0x0c,0x15,0x0e,0x05,0x9b,0x09,0xa9,
-0x00,0x1f,0x60,0xa9,0x00,0x16,0x1f,0xd0,0xa9,0x00,0x0f,0x1f,0xdf,0xa9,0x00,0x40,
-0x1f,0x0d,0xa9,0x00,0x33,0x1f,0xf2,0xa9,0x00,0x0f,0x05,0x8b,0xad,0x0f,0x5c,0x9c,
-0x0e,0x0e,0xab,0x9d,0x0f,0xcb,0xc4,0x04,0x1e,0xf9,0xb9,0x73,0x06,0x00,0xc6,0x0b,
-0x2b,0x00,0x0f,0x47,0x6d,0x02,0x1f,0x98,0x2b,0x00,0x83,0x0f,0x46,0x59,0x07,0x2a,
-0x6c,0xa0,0x38,0x26,0x0a,0xa7,0xf3,0x1a,0xf5,0xfd,0x06,0x1a,0xb0,0xf5,0x7b,0x19,
-0x10,0x5a,0x03,0x1a,0xf6,0x68,0x03,0x1b,0xb0,0x78,0x72,0x08,0xb5,0x08,0x19,0xe4,
-0xfb,0x0c,0x19,0xc1,0xc2,0x07,0x0a,0x1d,0x48,0x19,0xf2,0xad,0x01,0x1a,0xf8,0xf3,
-0x09,0x19,0x10,0x83,0x05,0x19,0xb0,0x19,0x09,0x0b,0xe8,0x41,0x19,0x30,0x0a,0x0c,
-0x1a,0xf1,0x48,0x00,0x0a,0xe5,0x02,0x19,0xe0,0x9f,0x02,0x1a,0xfd,0x59,0x02,0x19,
-0xc0,0xb6,0x0d,0x1f,0xfc,0x1d,0x00,0x77,0x1a,0x07,0x07,0x05,0x19,0x8f,0x6f,0x03,
-0x1a,0x0a,0x03,0x07,0x19,0xef,0x95,0x0a,0x19,0x3f,0x13,0x01,0x1e,0x0a,0x71,0x86,
-0x0c,0xad,0x86,0x19,0xf0,0x24,0xe1,0x02,0x69,0x01,0x19,0x9d,0x37,0x07,0x29,0x0c,
-0xff,0x81,0x05,0x19,0xcf,0x5b,0xed,0x1a,0x0c,0x23,0xe6,0x19,0xcf,0x3d,0x02,0x1a,
-0x0c,0xc5,0x89,0x19,0xcf,0x4e,0x08,0x1a,0x0c,0x29,0x40,0x19,0xcf,0x0b,0x08,0x1a,
-0x0c,0x14,0x11,0x2b,0x01,0x38,0x80,0x0f,0x1a,0x9f,0xb1,0x08,0x1a,0x8f,0x21,0x09,
-0x19,0xdf,0x43,0x02,0x1a,0x05,0x60,0x02,0x1e,0x0f,0x5f,0x32,0x06,0x32,0x06,0x09,
-0x02,0x8b,0x0c,0x8c,0x02,0x04,0x2d,0x5d,0x0f,0x44,0x02,0x93,0x0b,0xf2,0x02,0x19,
-0x3f,0x0f,0x03,0x0b,0xbf,0x14,0x0b,0x42,0x1d,0x19,0xcf,0xf4,0x05,0x1a,0x08,0xf7,
-0x00,0x1a,0x3f,0x7f,0x0d,0x19,0xef,0x40,0x01,0x1a,0x07,0xab,0x07,0x1a,0x1f,0x3b,
-0x00,0x1a,0x7f,0xc0,0x04,0x19,0xcf,0x84,0x09,0x2e,0x02,0xff,0xd9,0xbb,0x0d,0x0f,
-0x46,0x05,0xe1,0x5b,0x19,0xef,0x85,0x00,0x2a,0x01,0xbf,0xe5,0x09,0x1a,0x5e,0xb3,
-0x06,0x2a,0x06,0xdf,0x44,0x13,0x2c,0x4a,0xfb,0x33,0x6c,0x00,0xd8,0x2c,0x14,0x2e,
-0xe3,0xf5,0x1f,0x5e,0x09,0x00,0xff,0x51,0x0c,0xbb,0x06,0x2a,0xea,0x50,0xa1,0x08,
-0x2a,0xe8,0x10,0x89,0x0e,0x07,0xc5,0xcb,0x0a,0x47,0xde,0x19,0x5f,0x53,0x02,0x08,
-0x1b,0x78,0x0d,0xe1,0x9a,0x1a,0x3e,0x63,0x08,0x1a,0x08,0x87,0x08,0x1f,0x04,0xeb,
-0xc1,0x02,0x1a,0xa0,0x2d,0x00,0x19,0x10,0xdc,0x17,0x1a,0xf8,0xd9,0x02,0x0b,0x4f,
-0xc2,0x1a,0x20,0xa6,0x20,0x0a,0x92,0x09,0x1e,0x90,0xc3,0x03,0x06,0xec,0x0a,0x1e,
-0xe0,0xd2,0x06,0x06,0xf9,0x08,0x1a,0xf0,0x66,0x00,0x1e,0x10,0x0c,0x07,0x0f,0x1d,
-0x00,0x73,0x06,0x53,0x1d,0x0e,0xba,0x07,0x09,0x59,0x1d,0x05,0xfd,0x09,0x1a,0x90,
-0x45,0x04,0x0e,0x47,0x0f,0x07,0x36,0x04,0x1a,0xe1,0x18,0x04,0x1a,0xd2,0x59,0x0b,
-0x2a,0xf8,0x20,0x2b,0x0a,0x29,0xed,0x50,0x03,0x11,0x0a,0x90,0x4a,0x04,0x55,0x04,
-0x1a,0x4e,0x92,0x0c,0x1a,0x19,0x72,0x04,0x18,0x4e,0x1d,0x00,0x15,0x01,0x95,0x18,
-0x08,0x29,0x32,0x1a,0xf7,0x09,0x75,0x19,0x70,0xbb,0x30,0x18,0xf7,0xe6,0x0a,0x2c,
-0xc6,0x21,0x82,0xc3,0x06,0x4f,0x09,0x19,0x30,0x4e,0x01,0x19,0x80,0xdc,0x05,0x19,
-0xf0,0xd8,0x07,0x1f,0xfa,0xb0,0x05,0x03,0x0b,0xcd,0x05,0x0a,0x8d,0x02,0x0f,0x27,
-0x02,0x7e,0x0a,0x1d,0x00,0x1f,0x02,0xf2,0x02,0x09,0x1a,0x04,0x18,0x02,0x0a,0xef,
-0x06,0x1f,0x08,0x13,0x01,0x0f,0x19,0xf2,0x74,0x03,0x1a,0xfe,0x2e,0x08,0x0a,0x69,
-0x01,0x19,0xf1,0xff,0x0a,0x04,0x56,0x00,0x19,0x1d,0x4c,0x01,0x18,0x4e,0x04,0x02,
-0x1a,0x02,0x61,0xcd,0x1a,0x1f,0x0d,0x0b,0x19,0xcf,0x6d,0x0e,0x1a,0x06,0xd0,0xef,
-0x1a,0x1f,0xb3,0x0e,0x14,0xbf,0x18,0x88,0x04,0x2c,0x00,0x18,0xb3,0x57,0x23,0x19,
-0xd7,0xf6,0x0c,0x1f,0x20,0x05,0x0c,0x01,0x03,0xdd,0x72,0x0e,0x50,0xa7,0x4d,0xad,
-0xff,0xff,0xfd,0xf4,0xd0,0x07,0xed,0x77,0x16,0xf8,0xe5,0xdf,0x00,0x57,0x85,0x18,
-0x92,0xbd,0x7c,0x2c,0xe5,0x00,0x8b,0x23,0x1d,0x4f,0xb8,0x1a,0x13,0x0f,0x65,0x01,
-0x1e,0x03,0x97,0xf0,0x03,0x08,0x97,0x09,0x13,0x35,0x17,0xe3,0x10,0x05,0x1b,0xf0,
-0xbd,0x31,0x07,0x25,0xc5,0x1b,0xc0,0xfb,0x6d,0x16,0xf7,0x01,0x03,0x1c,0x90,0xf7,
-0x0d,0x15,0xc2,0x60,0x05,0x1d,0x50,0x0e,0x73,0x34,0xb6,0x34,0x7d,0x7a,0x02,0x0e,
-0x21,0x70,0x05,0x78,0x10,0x03,0x9c,0x3f,0x3c,0x10,0x38,0xef,0x4b,0x32,0x15,0x04,
-0x7e,0x00,0x1c,0x08,0x98,0x5b,0x16,0x08,0xbf,0x04,0x1b,0x3e,0xe2,0x45,0x16,0x0a,
-0xed,0x02,0x2a,0x01,0xcf,0x53,0x34,0x1d,0x0d,0x6d,0x95,0x05,0x42,0x0f,0x18,0x0e,
-0xf2,0x04,0x19,0x9f,0xcf,0xf8,0x1e,0x0f,0xca,0x02,0x04,0x82,0x47,0x19,0x0f,0x14,
-0x09,0x18,0x2c,0xe4,0x12,0x10,0x03,0x24,0x34,0x06,0xda,0x0f,0x1c,0x5c,0x6a,0x7a,
-0x08,0xad,0x95,0x56,0xbd,0xff,0xfe,0xb8,0x30,0x96,0x34,0x49,0x8c,0xdf,0xec,0x94,
-0x2c,0x4c,0x29,0xfe,0x60,0xb2,0x0f,0x19,0xc1,0xdc,0x00,0x19,0xe2,0xc7,0x1b,0x19,
-0xe1,0x0e,0x21,0x19,0xc0,0xb3,0x35,0x11,0x70,0x01,0x01,0x41,0xfe,0x62,0x01,0x5c,
-0x8d,0x03,0x13,0x04,0x46,0x0c,0x14,0x09,0xad,0xe7,0x01,0x45,0x0a,0x14,0x0b,0xca,
-0xb7,0x14,0x50,0x0f,0x04,0x15,0x00,0x11,0x04,0x12,0xdf,0x61,0xd3,0x15,0xfd,0x12,
-0x05,0x14,0x20,0x7f,0x10,0x00,0x74,0x00,0x10,0xf2,0x0e,0x01,0x05,0x14,0x06,0x23,
+0x1c,0x00,0x13,0x1f,0x1c,0x00,0x2e,0xf8,0x00,0x1c,0x00,0x17,0x06,0x55,0x00,0x0d,
+0x3c,0x06,0x1f,0xcf,0x20,0x06,0x07,0x23,0x00,0x2f,0x1c,0x00,0x2e,0xf7,0x00,0x1c,
+0x00,0x16,0x08,0xb3,0x05,0x0e,0xe4,0x06,0x15,0xdf,0x0a,0x02,0x0f,0x00,0x07,0x07,
+0x1e,0xf7,0x1c,0x00,0x06,0xf4,0x04,0x0e,0x1c,0x07,0x06,0x5f,0x02,0x1e,0xb0,0x1c,
+0x00,0x06,0x11,0x05,0x21,0x78,0x88,0x01,0x00,0x07,0x8c,0x07,0x07,0x73,0x01,0x09,
+0x52,0x04,0x0e,0x29,0x01,0x0f,0x2d,0x00,0xff,0xff,0xff,0xff,0xbe,0x29,0xf7,0x66,
+0x01,0x00,0x1e,0x60,0x45,0x08,0x00,0x01,0x00,0x1f,0x0e,0x16,0x00,0x02,0x1f,0xf0,
+0x2d,0x00,0xb3,0x50,0xff,0xff,0xff,0xff,0x00,0x23,0xab,0xbb,0x01,0x00,0x2b,0x60,
+0x00,0x01,0x00,0x14,0x07,0x1a,0x00,0x33,0xba,0xef,0xff,0x01,0x00,0x1c,0xe0,0x24,
+0x00,0x14,0x0f,0x1a,0x00,0x15,0xfe,0x24,0x00,0x1c,0xf3,0x24,0x00,0x1e,0x5f,0x24,
+0x00,0x1c,0xf9,0x24,0x00,0x1e,0xaf,0x24,0x00,0x1b,0xfe,0x23,0x00,0x2e,0x01,0xff,
+0x24,0x00,0x2a,0xff,0x40,0x24,0x00,0x1f,0x06,0x24,0x00,0x01,0x1a,0xa0,0x24,0x00,
+0x1f,0x0b,0x24,0x00,0x01,0x1a,0xf0,0x24,0x00,0x1f,0x1f,0x24,0x00,0x01,0x1a,0xf5,
+0x24,0x00,0x1f,0x6f,0x24,0x00,0x01,0x1a,0xfb,0x24,0x00,0x1f,0xcf,0x24,0x00,0x01,
+0x28,0xff,0x10,0x23,0x00,0x2f,0x02,0xff,0x24,0x00,0x02,0x19,0x60,0x8a,0x01,0x0f,
+0x24,0x00,0x03,0x18,0xc0,0x24,0x00,0x1f,0x0d,0x24,0x00,0x03,0x18,0xf1,0x24,0x00,
+0x1f,0x2f,0x24,0x00,0x03,0x18,0xf7,0x24,0x00,0x1f,0x8f,0x24,0x00,0x03,0x18,0xfd,
+0x24,0x00,0x1f,0xef,0x24,0x00,0x03,0x26,0xff,0x20,0x23,0x00,0x2f,0x03,0xff,0x24,
+0x00,0x04,0x16,0x80,0x24,0x00,0x1e,0x09,0x24,0x00,0x11,0xdf,0x06,0x00,0x16,0xd0,
+0x24,0x00,0x11,0x0e,0x11,0x00,0x18,0xed,0x24,0x00,0x1c,0xda,0x67,0x02,0x11,0x4f,
+0x11,0x00,0x18,0x9d,0x24,0x00,0x1c,0xd4,0x67,0x02,0x02,0x61,0x02,0x18,0x3e,0x24,
+0x00,0x2b,0xe0,0xef,0x67,0x02,0x02,0xe9,0x00,0x18,0x0f,0x24,0x00,0x2a,0xf0,0x9f,
+0x67,0x02,0x11,0x05,0x0f,0x00,0x1a,0xf8,0x24,0x00,0x1a,0x3f,0x67,0x02,0x11,0x0a,
+0x0f,0x00,0x1a,0xf2,0x24,0x00,0x1a,0x0d,0x67,0x02,0x12,0x0f,0xc1,0x01,0x18,0x1f,
+0x24,0x00,0x2a,0xf1,0x08,0x67,0x02,0x12,0x6f,0x09,0x02,0x19,0x2f,0x24,0x00,0x1a,
+0x02,0x67,0x02,0x12,0xbf,0x51,0x02,0x09,0x24,0x00,0x38,0xf2,0x00,0xcf,0x67,0x02,
+0x13,0x01,0x32,0x00,0x18,0x3f,0x24,0x00,0x14,0xf3,0x5e,0x00,0x08,0x38,0x03,0x38,
+0xf5,0x00,0x4f,0x24,0x00,0x13,0xf4,0x07,0x03,0x12,0xb0,0x24,0x00,0x13,0x0c,0xc2,
+0x00,0x0b,0x24,0x00,0x18,0x0b,0x67,0x02,0x13,0x2f,0x0a,0x01,0x18,0x5f,0x24,0x00,
+0x38,0xf5,0x00,0x05,0x67,0x02,0x13,0x7f,0x52,0x01,0x18,0x6f,0x24,0x00,0x13,0xf6,
+0x7e,0x01,0x12,0xfc,0x24,0x00,0x13,0xdf,0x9a,0x01,0x0c,0x24,0x00,0x16,0xaf,0x67,
+0x02,0x12,0x02,0x8a,0x01,0x04,0x50,0x00,0x24,0xfe,0xef,0x64,0x00,0x16,0x4f,0x67,
+0x02,0x14,0x08,0x2a,0x02,0x18,0x8f,0x24,0x00,0x14,0xf8,0x56,0x02,0x01,0x67,0x02,
+0x05,0x0b,0x00,0x1b,0x9f,0x24,0x00,0x16,0x08,0x67,0x02,0x02,0x3b,0x01,0x1b,0x70,
+0x24,0x00,0x14,0xf9,0xe6,0x02,0x10,0xf8,0x24,0x00,0x14,0x9f,0x74,0x01,0x18,0xaf,
+0x24,0x00,0x17,0xfa,0xcd,0x00,0x03,0x38,0x03,0x15,0xfc,0xb7,0x01,0x03,0x24,0x00,
+0x17,0xfb,0x15,0x01,0x24,0x00,0x04,0xeb,0x00,0x0e,0x24,0x00,0x02,0x8e,0x01,0x14,
+0x90,0x61,0x02,0x15,0xf1,0x60,0x04,0x25,0xfe,0xef,0x3c,0x01,0x14,0x0c,0xa7,0x05,
+0x15,0x0f,0x94,0x02,0x18,0xdf,0x24,0x00,0x17,0xfd,0xed,0x01,0x03,0xa6,0x01,0x1f,
+0x50,0x24,0x00,0x01,0x14,0x01,0xbe,0x00,0x1a,0xaf,0xbd,0x00,0x04,0x24,0x00,0x16,
+0xfe,0x54,0x03,0x26,0x00,0x00,0x6c,0x03,0x0a,0xf0,0x03,0x06,0xfd,0x05,0x26,0x50,
+0x06,0x4d,0x01,0x0e,0x24,0x00,0x12,0x0e,0x67,0x02,0x16,0x0b,0x95,0x01,0x0e,0x24,
+0x00,0x12,0x09,0xf4,0x00,0x15,0x1f,0xdd,0x01,0x1a,0x01,0x24,0x00,0x15,0x10,0x74,
+0x04,0x25,0xf6,0x6f,0x25,0x02,0x1e,0x02,0x24,0x00,0x03,0x84,0x01,0x15,0xcf,0x6d,
+0x02,0x0b,0x24,0x00,0x1b,0x20,0x04,0x05,0x17,0xf6,0xcd,0x04,0x09,0x24,0x00,0x1b,
+0x2f,0x64,0x05,0x0e,0x24,0x00,0x04,0x8e,0x01,0x06,0x45,0x03,0x0e,0x24,0x00,0x09,
+0xdc,0x05,0x1f,0x50,0x24,0x00,0x05,0x16,0x01,0x24,0x00,0x1f,0x00,0x24,0x00,0x05,
+0x03,0x30,0x02,0x03,0x74,0x02,0x0e,0x24,0x00,0x0a,0x8b,0x07,0x1f,0xf4,0x24,0x00,
+0x07,0x1a,0x0f,0xed,0x07,0x0f,0x24,0x00,0x02,0x1a,0x0a,0xce,0x05,0x0f,0x24,0x00,
+0x02,0x14,0x04,0x24,0x00,0x1f,0x30,0x24,0x00,0x07,0x29,0x00,0xef,0x5e,0x06,0x0f,
+0x24,0x00,0x03,0x19,0x9f,0xa6,0x06,0x0f,0x24,0x00,0x03,0x19,0x3f,0xee,0x06,0x0e,
+0x24,0x00,0x07,0x22,0x07,0x1f,0xc0,0x24,0x00,0x09,0x19,0x07,0x7e,0x07,0x0e,0x24,
+0x00,0x07,0x32,0x02,0x1f,0x10,0x24,0x00,0x09,0x26,0x00,0xcf,0x8a,0x01,0x0e,0x24,
+0x00,0x08,0xe1,0x05,0x1f,0xf5,0x24,0x00,0x0b,0x18,0x1f,0x77,0x09,0x80,0x03,0xff,
+0xff,0xff,0xff,0xff,0xff,0xfe,0x21,0xab,0xbb,0x01,0x00,0x27,0x40,0x00,0x01,0x00,
+0x12,0x04,0x14,0x00,0x31,0xb6,0xef,0xff,0x01,0x00,0x18,0xd0,0x1c,0x00,0x12,0x06,
+0x14,0x00,0x13,0xf9,0x1c,0x00,0x1f,0xf7,0x1c,0x00,0x08,0x2f,0xff,0x20,0x1c,0x00,
+0x08,0x1f,0xb0,0x1c,0x00,0x08,0x1f,0xf4,0x1c,0x00,0x08,0x1f,0xfd,0x1c,0x00,0x08,
+0x2f,0xff,0x80,0x1c,0x00,0x08,0x1f,0xf2,0x1c,0x00,0x08,0x1f,0xfb,0x1c,0x00,0x08,
+0x2f,0xff,0x50,0x1c,0x00,0x08,0x1f,0xe0,0x1c,0x00,0x08,0x1f,0xf8,0x1c,0x00,0x08,
+0x2f,0xff,0x20,0x1c,0x00,0x08,0x1f,0xc0,0x1c,0x00,0x08,0x1f,0xf5,0x1c,0x00,0x08,
+0x1f,0xfe,0x1c,0x00,0x08,0x2f,0xff,0x90,0x1c,0x00,0x08,0x1f,0xf3,0x1c,0x00,0x08,
+0x1f,0xfc,0x1c,0x00,0x08,0x2f,0xff,0x60,0x1c,0x00,0x08,0x1f,0xe1,0x1c,0x00,0x08,
+0x1f,0xf9,0x1c,0x00,0x08,0x2f,0xff,0x30,0x1c,0x00,0x01,0x18,0x9f,0x1b,0x01,0x0b,
+0x1c,0x00,0x12,0x2c,0x07,0x00,0x1f,0xf6,0x1c,0x00,0x01,0x13,0x23,0x1b,0x01,0x2e,
+0x10,0x00,0x1c,0x00,0x27,0x20,0x9f,0x1b,0x01,0x0c,0x1c,0x00,0x17,0x1e,0x1b,0x01,
+0x0c,0x1c,0x00,0x17,0x06,0x8b,0x02,0x0c,0x1c,0x00,0x22,0x00,0xcf,0x09,0x00,0x1f,
+0x70,0x1c,0x00,0x01,0x12,0x3f,0x09,0x00,0x1f,0xf1,0x1c,0x00,0x01,0x12,0x09,0x09,
+0x00,0x1f,0xfa,0x1c,0x00,0x01,0x13,0x00,0x0a,0x00,0x1f,0x40,0x1c,0x00,0x01,0x15,
+0x5f,0xa6,0x03,0x0e,0x1c,0x00,0x15,0x0c,0xa6,0x03,0x0e,0x1c,0x00,0x13,0x02,0x70,
+0x01,0x2e,0x10,0x00,0x1c,0x00,0x22,0x00,0x8f,0x0b,0x00,0x1f,0xa0,0x1c,0x00,0x01,
+0x14,0x0e,0xa6,0x03,0x1e,0x06,0x1c,0x00,0x14,0x05,0x1b,0x01,0x1e,0x06,0x1c,0x00,
+0x23,0x00,0xbf,0x1b,0x01,0x0f,0x1c,0x00,0x01,0x13,0x2f,0xa6,0x03,0x0f,0x1c,0x00,
+0x01,0x13,0x08,0xa6,0x03,0x0f,0x1c,0x00,0x01,0x22,0x00,0xdf,0x0d,0x00,0x1f,0x46,
+0x1c,0x00,0x01,0x12,0x4f,0x0d,0x00,0x1f,0xe7,0x1c,0x00,0x01,0x13,0x0b,0x1a,0x02,
+0x0e,0x1c,0x00,0x06,0x1b,0x01,0x0f,0x1c,0x00,0x01,0x2f,0x00,0x7f,0x1c,0x00,0x08,
+0x1f,0x0d,0x1c,0x00,0x08,0x1f,0x04,0x1c,0x00,0x08,0x2f,0x00,0xaf,0x1c,0x00,0x08,
+0x1f,0x1f,0x1c,0x00,0x08,0x1f,0x07,0x1c,0x00,0x08,0x2f,0x00,0xdf,0x1c,0x00,0x08,
+0x1f,0x4f,0x1c,0x00,0x08,0x1f,0x0a,0x1c,0x00,0x08,0x1f,0x01,0x1c,0x00,0x08,0x2f,
+0x00,0x6f,0x1c,0x00,0x08,0x1f,0x0d,0x1c,0x00,0x08,0x1f,0x03,0x1c,0x00,0x08,0x2f,
+0x00,0x9f,0x1c,0x00,0x08,0x1f,0x1e,0x1c,0x00,0x08,0x1f,0x06,0x1c,0x00,0x08,0x2f,
+0x00,0xcf,0x1c,0x00,0x08,0x1f,0x3f,0x1c,0x00,0x08,0x1f,0x09,0x1c,0x00,0x08,0x2e,
+0x01,0xef,0x1c,0x00,0x0c,0x1b,0x01,0x0f,0x1c,0x00,0x02,0x19,0x0c,0x16,0x05,0x02,
+0x12,0x01,0x52,0x57,0x9a,0xaa,0xa9,0x76,0x0b,0x05,0x0c,0x01,0x00,0x23,0x27,0xcf,
+0x9b,0x05,0x1e,0x83,0x1c,0x00,0x25,0x06,0xcf,0x4b,0x01,0x2c,0xfd,0x71,0x1d,0x00,
+0x18,0x7e,0x82,0x02,0x1a,0xf8,0x1c,0x00,0x29,0x03,0xdf,0xf4,0x02,0x16,0xfe,0xf6,
+0x06,0x06,0x81,0x03,0x06,0x01,0x00,0x17,0xa0,0x1d,0x00,0x2c,0x1c,0xff,0x01,0x00,
+0x16,0xd2,0x1d,0x00,0x2d,0x1d,0xff,0x01,0x00,0x1e,0xe3,0x1d,0x00,0x0e,0x1e,0x00,
+0x0e,0x1d,0x00,0x09,0xc5,0x07,0x1e,0x0b,0x1d,0x00,0x06,0xa9,0x08,0x08,0x14,0x03,
+0x0d,0xb4,0x00,0x06,0x6b,0x02,0x5b,0xb6,0x31,0x00,0x13,0x6a,0xe6,0x07,0x05,0x17,
+0x02,0x11,0x10,0xd1,0x01,0x19,0x7f,0x5a,0x07,0x1b,0x5f,0xa3,0x00,0x18,0x2c,0x4a,
+0x01,0x04,0xdf,0x02,0x2b,0xd1,0x00,0xa3,0x00,0x17,0xf1,0x8b,0x02,0x1c,0xe1,0xf3,
+0x01,0x26,0xff,0x90,0xa7,0x03,0x1e,0xf3,0xd7,0x02,0x06,0x8d,0x02,0x1e,0xf9,0x4b,
+0x02,0x16,0xf6,0x8e,0x02,0x17,0x10,0x1e,0x00,0x15,0xdf,0x2a,0x07,0x0b,0xfa,0x07,
+0x08,0x14,0x03,0x05,0x8b,0x06,0x18,0xf2,0xe7,0x01,0x14,0x0f,0x59,0x00,0x1e,0x08,
+0x6c,0x09,0x05,0xa3,0x04,0x3d,0xa0,0x00,0xcf,0x6d,0x09,0x05,0xf8,0x05,0x3e,0xfe,
+0x00,0x0f,0xc3,0x09,0x05,0xc2,0x04,0x14,0xf3,0x7d,0x01,0x0a,0x7b,0x02,0x13,0xef,
+0x82,0x01,0x1e,0x5f,0x6f,0x0a,0x05,0x8c,0x04,0x2d,0xf8,0x07,0xaa,0x09,0x17,0x00,
+0xa7,0x06,0x1e,0xaf,0xeb,0x00,0x05,0xed,0x00,0x2e,0xfd,0x0c,0xab,0x0a,0x06,0x01,
+0x05,0x29,0xe0,0xcf,0xcb,0x08,0x0b,0x91,0x04,0x1b,0x0d,0x76,0x09,0x27,0x00,0x00,
+0xac,0x06,0x2c,0xf0,0xef,0x21,0x0a,0x08,0x3c,0x06,0x1e,0x1f,0x09,0x01,0x06,0x0a,
+0x01,0x13,0xf2,0x25,0x00,0x09,0x77,0x0b,0x05,0x5c,0x05,0x1f,0x2f,0x3b,0x00,0x45,
+0x1f,0xef,0x3b,0x00,0x09,0x1f,0x1d,0xec,0x00,0x0a,0x1f,0xdf,0x27,0x01,0x09,0x0f,
+0x62,0x01,0x0a,0x2e,0xf0,0xbf,0x30,0x02,0x06,0x31,0x02,0x1e,0x08,0xd8,0x01,0x06,
+0x64,0x07,0x2e,0xb0,0x6f,0x13,0x02,0x05,0xf6,0x02,0x1f,0xf9,0x4e,0x02,0x03,0x04,
+0x80,0x09,0x04,0x74,0x02,0x09,0x1d,0x00,0x05,0x9e,0x02,0x16,0xdf,0xa6,0x09,0x0d,
+0xce,0x00,0x2a,0x10,0x09,0xfb,0x0a,0x09,0x6b,0x02,0x14,0xc0,0x07,0x04,0x09,0x3a,
+0x03,0x14,0x0d,0x0a,0x04,0x1e,0x01,0x8a,0x0c,0x05,0x58,0x00,0x15,0x40,0x74,0x08,
+0x0e,0x57,0x03,0x00,0x4a,0x0c,0x1e,0x5f,0x46,0x01,0x16,0x2f,0xfe,0x03,0x1d,0xef,
+0x77,0x00,0x16,0x0c,0x31,0x0b,0x1c,0x08,0x3b,0x0c,0x27,0x00,0x07,0x12,0x00,0x1c,
+0x1f,0xb6,0x05,0x18,0x05,0x4e,0x0c,0x1b,0x8f,0x1e,0x00,0x19,0x06,0xfa,0x0b,0x04,
+0x9c,0x0b,0x12,0xd4,0x1d,0x00,0x19,0x1a,0xa6,0x0b,0x15,0x06,0x26,0x0c,0x10,0x51,
+0xe8,0x00,0x1a,0x9f,0x6b,0x05,0x16,0x0a,0x8b,0x06,0x3c,0xba,0xaa,0xcf,0x19,0x0c,
+0x09,0x2b,0x09,0x0d,0x8b,0x0c,0x1f,0x3f,0x1d,0x00,0x01,0x1e,0xf7,0xbd,0x08,0x0d,
+0x54,0x0c,0x0e,0x1e,0x00,0x0b,0x3f,0x05,0x1d,0x4e,0x1d,0x00,0x1f,0xf8,0xcd,0x06,
+0x09,0x18,0xe4,0xac,0x01,0x0c,0x5a,0x06,0x1a,0xb1,0xfa,0x03,0x1e,0xbf,0x42,0x07,
+0x07,0x01,0x00,0x17,0x3a,0x1d,0x00,0x1d,0xd6,0xb9,0x07,0x24,0x01,0x7c,0x1c,0x00,
+0x1f,0xe9,0xf6,0x07,0x02,0x73,0x47,0xac,0xef,0xff,0xfe,0xdb,0x86,0x38,0x08,0x50,
+0x00,0x00,0x00,0x00,0x00,0x27,0x78,0x88,0x01,0x00,0x45,0x87,0x66,0x52,0x00,0x01,
+0x00,0x2b,0x0e,0xff,0x01,0x00,0x24,0xda,0x61,0x1b,0x00,0x2c,0xef,0xff,0x01,0x00,
+0x2e,0xfc,0x60,0x35,0x00,0x04,0x01,0x00,0x1e,0xf8,0x35,0x00,0x04,0x01,0x00,0x2e,
+0xfe,0x60,0x35,0x00,0x04,0x01,0x00,0x1e,0xb1,0x35,0x00,0x04,0x01,0x00,0x1e,0xe3,
+0x35,0x00,0x08,0x1b,0x00,0x1f,0xef,0x1b,0x00,0x03,0x1f,0xe2,0x35,0x00,0x06,0x2f,
+0xff,0xd0,0x35,0x00,0x06,0x2f,0xff,0x90,0x35,0x00,0x06,0x24,0xff,0x40,0x35,0x00,
+0x12,0x20,0xe2,0x00,0x25,0x13,0x7b,0x0f,0x01,0x04,0x35,0x00,0x14,0xf2,0x33,0x01,
+0x23,0x03,0xbf,0x1b,0x00,0x1a,0xf4,0x35,0x00,0x00,0x01,0x00,0x13,0x8f,0x1b,0x00,
+0x1c,0xb0,0x35,0x00,0x06,0x1b,0x00,0x1d,0x10,0x35,0x00,0x13,0x00,0x51,0x00,0x1e,
+0xf6,0x35,0x00,0x13,0x02,0x35,0x00,0x1e,0xa0,0x35,0x00,0x12,0x0b,0x12,0x00,0x1e,
+0xfd,0x35,0x00,0x22,0x00,0x6f,0x13,0x00,0x1e,0xf1,0x35,0x00,0x04,0x50,0x00,0x1e,
+0x3e,0x35,0x00,0x13,0x0f,0xd5,0x00,0x0e,0x35,0x00,0x04,0xe7,0x00,0x1e,0x5e,0x35,
+0x00,0x12,0x0d,0x13,0x00,0x2e,0xf5,0xef,0x35,0x00,0x03,0x6a,0x00,0x1f,0x4e,0x6a,
+0x00,0x19,0x13,0x04,0x35,0x00,0x1e,0x2e,0x35,0x00,0x03,0x3f,0x01,0x1e,0xf0,0x35,
+0x00,0x13,0x1f,0xa9,0x01,0x0e,0x09,0x01,0x14,0x09,0xf9,0x01,0x0d,0x35,0x00,0x14,
+0x07,0xc3,0x01,0x0d,0x35,0x00,0x14,0x09,0xd0,0x02,0x0c,0xdd,0x01,0x24,0x01,0x7e,
+0x13,0x02,0x23,0x80,0x0e,0x0e,0x03,0x11,0x77,0x01,0x00,0x25,0x89,0xae,0x47,0x02,
+0x1f,0xf1,0x7c,0x02,0x06,0x1f,0xf7,0x7c,0x02,0x06,0x1f,0xfc,0xb1,0x02,0x06,0x2f,
+0xfe,0x20,0x35,0x00,0x06,0x1f,0x30,0x35,0x00,0x06,0x1f,0x30,0x1b,0x03,0x05,0x2f,
+0xfd,0x30,0x50,0x03,0x05,0x1f,0xfa,0xba,0x03,0x06,0x1f,0xd4,0xef,0x03,0x05,0x2f,
+0xfc,0x40,0x24,0x04,0x04,0x2f,0xfc,0x71,0x59,0x04,0x02,0x4b,0xfe,0xcb,0x96,0x30,
+0x8e,0x04,0x2e,0xf2,0x00,0x01,0x00,0x0e,0x47,0x02,0x0f,0x35,0x00,0xff,0xff,0x3a,
+0x50,0x00,0x00,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x7f,0x35,0x79,0xaa,0xaa,0x97,
+0x53,0x00,0x01,0x00,0x02,0x31,0x38,0xcf,0xff,0x01,0x00,0x3e,0xfc,0x83,0x00,0x01,
+0x00,0x25,0x7d,0xff,0x01,0x00,0x1d,0xd7,0x1d,0x00,0x27,0x7e,0xff,0x01,0x00,0x1b,
+0xe7,0x1d,0x00,0x29,0x4e,0xff,0x01,0x00,0x19,0xe4,0x1d,0x00,0x2b,0x09,0xff,0x01,
+0x00,0x17,0x80,0x1d,0x00,0x2c,0x02,0xdf,0x1e,0x00,0x26,0xfc,0x20,0x1e,0x00,0x2d,
+0x2e,0xff,0x01,0x00,0x16,0xe2,0x3b,0x00,0x1e,0xef,0x1e,0x00,0x2e,0xfe,0x20,0x3b,
+0x00,0x07,0x01,0x00,0x14,0xe1,0x1e,0x00,0x03,0x07,0x01,0x0b,0x7a,0x00,0x03,0x1d,
+0x00,0x1e,0x08,0x1d,0x00,0x07,0xb7,0x00,0x14,0x4f,0x10,0x00,0x64,0xfa,0x63,0x10,
+0x01,0x36,0xbf,0x0e,0x00,0x12,0xf4,0x1e,0x00,0x04,0xcf,0x00,0x20,0xf8,0x10,0x0e,
+0x00,0x23,0x01,0x8f,0x0f,0x00,0x11,0xfd,0x1d,0x00,0x14,0x07,0x0e,0x00,0x1b,0x20,
+0xfd,0x00,0x10,0x60,0x0e,0x00,0x13,0x1e,0x0d,0x00,0x14,0xc0,0xa5,0x00,0x13,0x0c,
+0x11,0x00,0x10,0xe0,0x0d,0x00,0x18,0x8f,0x49,0x00,0x01,0x5c,0x00,0x03,0x3d,0x00,
+0x10,0xf7,0x0d,0x00,0x03,0x0b,0x01,0x16,0xf2,0x3b,0x01,0x13,0x2f,0x11,0x01,0x4e,
+0x00,0x00,0x00,0x04,0x78,0x01,0x04,0xe3,0x00,0x46,0x40,0x00,0x00,0x0b,0x29,0x00,
+0x05,0x01,0x00,0x03,0x4f,0x00,0x47,0xa0,0x00,0x00,0x1f,0x65,0x00,0x04,0x01,0x00,
+0x12,0x7f,0x14,0x00,0x45,0xf1,0x00,0x00,0x5f,0x0a,0x00,0x06,0x01,0x00,0x03,0x32,
+0x00,0x42,0xf5,0x00,0x00,0x9f,0x0a,0x00,0x18,0xb0,0x1e,0x00,0x03,0x6e,0x00,0x15,
+0xf9,0x2a,0x01,0x18,0x60,0x1e,0x00,0x14,0x07,0xe5,0x00,0x13,0x01,0xa0,0x00,0x28,
+0x20,0x00,0x2c,0x02,0x03,0x15,0x00,0x14,0x10,0xd1,0x00,0x0a,0x85,0x02,0x04,0xd3,
+0x00,0x1a,0x06,0xce,0x01,0x0a,0xf2,0x01,0x25,0x60,0x09,0x81,0x00,0x08,0x01,0x00,
+0x12,0xaf,0x16,0x00,0x2e,0x90,0x0b,0xef,0x00,0x06,0xf1,0x00,0x22,0xb0,0x0d,0x08,
+0x00,0x1a,0xf6,0x1e,0x00,0x12,0x6f,0x16,0x00,0x25,0xd0,0x0e,0xf9,0x00,0x08,0x01,
+0x00,0x13,0x5f,0xc4,0x01,0x19,0x0f,0x27,0x02,0x29,0x00,0x00,0x4d,0x02,0x13,0xf0,
+0x1e,0x00,0x1a,0xf3,0x1e,0x00,0x1f,0x3f,0x1e,0x00,0x30,0x1f,0x1f,0x1e,0x00,0x09,
+0x1f,0xf1,0x1e,0x00,0x0b,0x0f,0x96,0x00,0x47,0x1f,0x0e,0x0e,0x01,0x09,0x2f,0xe0,
+0x0d,0x4a,0x01,0x0a,0x1f,0x0c,0xa4,0x01,0x09,0x2f,0xc0,0x0a,0xe0,0x01,0x02,0x13,
+0x9f,0xd1,0x02,0x03,0x61,0x02,0x1a,0xfb,0x1e,0x00,0x13,0xbf,0x20,0x03,0x1e,0x05,
+0x0b,0x03,0x06,0x0d,0x03,0x2f,0x60,0x02,0x94,0x02,0x01,0x04,0xa9,0x02,0x14,0x30,
+0x7f,0x02,0x09,0xd0,0x02,0x15,0x05,0xa9,0x02,0x15,0xbf,0x52,0x03,0x0d,0x19,0x05,
+0x15,0xfb,0x43,0x02,0x18,0xf0,0x1e,0x00,0x13,0x0e,0x49,0x04,0x05,0xcb,0x03,0x1e,
+0xf6,0x2b,0x01,0x00,0x5f,0x01,0x1c,0x0d,0x19,0x04,0x06,0xed,0x02,0x16,0xd0,0x73,
+0x04,0x07,0x97,0x00,0x07,0x0f,0x04,0x1c,0x01,0x18,0x05,0x05,0x4f,0x00,0x26,0xff,
+0x20,0x16,0x03,0x1d,0xfb,0x48,0x01,0x17,0xfb,0x62,0x04,0x24,0xff,0x90,0x1d,0x00,
+0x27,0x06,0xff,0xf4,0x01,0x04,0xf6,0x05,0x1b,0xf9,0xa1,0x01,0x28,0xff,0xb0,0x37,
+0x01,0x22,0xff,0xc3,0x1d,0x00,0x29,0x2b,0xff,0x5d,0x01,0x14,0x7f,0x0f,0x00,0x10,
+0xb5,0x0e,0x00,0x24,0x4a,0xff,0x55,0x05,0x09,0x18,0x05,0x00,0xf5,0x00,0x26,0xba,
+0xaa,0xca,0x05,0x13,0xd0,0x92,0x01,0x0e,0x17,0x06,0x02,0xa1,0x01,0x0b,0xbf,0x05,
+0x08,0x01,0x00,0x1c,0xf5,0xb1,0x01,0x09,0x01,0x00,0x1c,0x70,0x83,0x02,0x08,0x01,
+0x00,0x07,0x87,0x02,0x0e,0x3d,0x00,0x09,0x0e,0x02,0x1c,0x2c,0x1d,0x00,0x1e,0xfb,
+0xa3,0x02,0x08,0x01,0x00,0x18,0xb1,0x1e,0x00,0x1c,0x03,0xb2,0x06,0x19,0xfd,0x87,
+0x02,0x2e,0x04,0xbf,0xd2,0x00,0x08,0x3a,0x05,0x1b,0x7c,0x1f,0x00,0x1a,0x90,0xe3,
+0x02,0x75,0x14,0x8a,0xce,0xff,0xff,0xec,0xac,0x09,0x07,0x1e,0x10,0x3c,0x08,0x07,
+0xa1,0x00,0x1f,0xe3,0x1e,0x00,0x01,0x1e,0x06,0xf4,0x00,0x08,0x01,0x00,0x2c,0x3e,
+0xff,0x10,0x02,0x09,0x46,0x03,0x1f,0xcf,0x3d,0x00,0x0a,0x2e,0x0a,0xff,0xf3,0x03,
+0x0e,0xfb,0x03,0x1f,0x50,0x1e,0x00,0x03,0x2e,0x04,0xef,0x6a,0x04,0x07,0x01,0x00,
+0x19,0x2d,0x36,0x08,0x0c,0x01,0x00,0x00,0x03,0x03,0x1e,0xd1,0x1d,0x00,0x06,0xb0,
+0x06,0x0e,0x2b,0x01,0x08,0xa5,0x03,0x09,0xef,0x03,0x0d,0xf5,0x00,0x50,0x00,0x00,
+0x00,0x00,0x00,0x27,0x67,0x77,0x01,0x00,0x46,0x66,0x54,0x31,0x00,0x01,0x00,0x2a,
+0xef,0xff,0x01,0x00,0x2e,0xeb,0x84,0x1b,0x00,0x05,0x01,0x00,0x2f,0xfa,0x40,0x1b,
+0x00,0x06,0x3e,0xff,0xfd,0x60,0x1b,0x00,0x05,0x1c,0x00,0x1f,0x30,0x1b,0x00,0x06,
+0x2f,0xff,0xf7,0x1b,0x00,0x07,0x2f,0xff,0xa0,0x1b,0x00,0x07,0x1f,0xfb,0x1b,0x00,
+0x07,0x2f,0xff,0x90,0x1b,0x00,0x07,0x1f,0xf5,0x1b,0x00,0x07,0x2f,0xfe,0x10,0x1b,
+0x00,0x06,0x25,0xff,0x80,0x1b,0x00,0x11,0x20,0xaf,0x00,0x34,0x12,0x47,0xcf,0x1b,
+0x00,0x1b,0xf1,0x1b,0x00,0x43,0x00,0x00,0x03,0xbf,0x1b,0x00,0x1d,0xf6,0x1b,0x00,
+0x26,0x00,0x08,0xbf,0x00,0x0c,0x1b,0x00,0x23,0x00,0x9f,0x1c,0x00,0x1e,0x00,0x1b,
+0x00,0x13,0x0d,0x1b,0x00,0x1e,0x30,0x1b,0x00,0x13,0x05,0x1b,0x00,0x1e,0x60,0x1b,
+0x00,0x15,0x00,0xbe,0x00,0x0e,0x1b,0x00,0x14,0xbf,0x2b,0x01,0x0e,0x1b,0x00,0x14,
+0x8f,0x7d,0x01,0x0e,0x1b,0x00,0x1f,0x7f,0x1b,0x00,0x07,0x1f,0x6f,0x51,0x00,0x07,
+0x1e,0x7f,0x87,0x00,0x0b,0xf4,0x00,0x2e,0x70,0x00,0x1b,0x00,0x12,0xdf,0x12,0x00,
+0x1e,0x50,0x1b,0x00,0x24,0x01,0xff,0x12,0x00,0x0d,0x1b,0x00,0x1f,0x09,0x44,0x01,
+0x07,0x13,0x3f,0xc4,0x02,0x0e,0x1b,0x00,0x13,0x01,0x11,0x00,0x1e,0xf4,0x1b,0x00,
+0x13,0x4e,0x50,0x00,0x1d,0xe0,0x1b,0x00,0x25,0x4b,0xff,0x79,0x01,0x04,0x1b,0x00,
+0x11,0x87,0x60,0x03,0x25,0x89,0xbf,0xf7,0x02,0x0f,0x6d,0x02,0x07,0x1f,0xf3,0x1b,
+0x00,0x07,0x1f,0x70,0x1b,0x00,0x06,0x1f,0xf9,0xf4,0x02,0x07,0x1f,0x80,0x1b,0x00,
+0x06,0x1f,0xf6,0x60,0x03,0x06,0x2f,0xfc,0x20,0xcc,0x03,0x06,0x1f,0x50,0xcc,0x03,
+0x06,0x1f,0xb0,0x02,0x04,0x07,0x1e,0xf1,0x1b,0x00,0x09,0xba,0x00,0x0f,0x87,0x00,
+0x04,0x19,0x10,0x1b,0x00,0x01,0x94,0x00,0x17,0x06,0xc9,0x03,0x0b,0x1b,0x00,0x04,
+0x17,0x02,0x2e,0xf2,0x00,0x1b,0x00,0x15,0x5f,0xe2,0x01,0x0d,0x1b,0x00,0x06,0x41,
+0x03,0x0d,0x1b,0x00,0x19,0x04,0xda,0x00,0x0a,0xe6,0x01,0x16,0xcf,0xae,0x01,0x0c,
+0x1b,0x00,0x13,0x4f,0x45,0x01,0x1e,0x00,0x1b,0x00,0x13,0x0c,0x52,0x00,0x1e,0x40,
+0x1b,0x00,0x13,0x03,0x1b,0x00,0x1e,0xc0,0x1b,0x00,0x26,0x00,0xbf,0xa3,0x04,0x0c,
+0x1b,0x00,0x16,0x3f,0x51,0x02,0x0c,0x1b,0x00,0x24,0x0a,0xff,0x28,0x03,0x0d,0x1b,
+0x00,0x13,0x02,0x1b,0x00,0x2e,0xd0,0x00,0xd9,0x02,0x16,0xaf,0x1e,0x02,0x0c,0x1b,
+0x00,0x13,0x2f,0x10,0x05,0x1e,0x00,0x1b,0x00,0x16,0x09,0xa4,0x02,0x0d,0x45,0x03,
+0x0e,0x2a,0x03,0x0c,0xe6,0x03,0x2e,0xf8,0x00,0x1b,0x00,0x15,0x1f,0x06,0x02,0x0d,
+0x1b,0x00,0x1e,0x08,0xbf,0x04,0x0c,0x6d,0x00,0x1f,0xf1,0x6e,0x04,0x07,0x2e,0xf9,
+0x00,0x1b,0x00,0x14,0x0e,0x39,0x04,0x0e,0x1b,0x00,0x14,0x07,0x73,0x06,0x0e,0x1b,
+0x00,0x22,0x00,0xaa,0x01,0x00,0x27,0xa0,0x00,0x01,0x00,0x5e,0x22,0x34,0x32,0x10,
+0x00,0x01,0x00,0x31,0x02,0x69,0xce,0x3c,0x01,0x2b,0xb9,0x51,0x19,0x00,0x26,0x03,
+0x9e,0x78,0x03,0x19,0x60,0x1a,0x00,0x19,0x6d,0x29,0x03,0x07,0x55,0x00,0x1b,0x05,
+0x2e,0x03,0x15,0x81,0x1a,0x00,0x1c,0x1b,0x44,0x03,0x14,0xe3,0x1a,0x00,0x1e,0x4f,
+0x60,0x07,0x0a,0xa0,0x05,0x08,0x01,0x00,0x28,0xf8,0x00,0x37,0x03,0x0e,0x1b,0x00,
+0x04,0x77,0x02,0x0e,0x43,0x07,0x2e,0x00,0x0d,0x86,0x04,0x03,0x95,0x03,0x1e,0x07,
+0xd6,0x04,0x03,0xf1,0x02,0x15,0x01,0x0d,0x00,0x76,0xa6,0x31,0x00,0x12,0x58,0xdf,
+0xff,0x27,0x03,0x1a,0x7f,0xad,0x00,0x16,0x4d,0x41,0x05,0x04,0x69,0x00,0x1b,0xd1,
+0x82,0x02,0x15,0xf3,0x4f,0x00,0x1c,0xe1,0x9d,0x02,0x14,0x90,0xd2,0x00,0x1c,0xf4,
+0x40,0x07,0x37,0xfe,0x00,0x07,0x49,0x03,0x09,0xfe,0x00,0x14,0xf1,0xa5,0x02,0x1d,
+0x80,0x3f,0x07,0x29,0x40,0x0a,0x4a,0x01,0x00,0x01,0x00,0x14,0x0b,0x3e,0x03,0x05,
+0xc0,0x06,0x0d,0xd2,0x06,0x19,0x08,0x8d,0x04,0x01,0x63,0x02,0x11,0xee,0x01,0x00,
+0x3a,0xe8,0x00,0x7f,0x30,0x05,0x08,0x26,0x02,0x08,0xf9,0x08,0x0a,0x01,0x00,0x2d,
+0x0f,0xff,0xa0,0x00,0x0b,0xcc,0x07,0x2d,0xff,0xa1,0x1a,0x00,0x14,0x04,0x64,0x01,
+0x1d,0xe7,0x1b,0x00,0x15,0x0d,0xf8,0x08,0x1c,0x71,0x1b,0x00,0x1e,0x4f,0xf1,0x09,
+0x0b,0x37,0x04,0x00,0x01,0x00,0x1b,0xe9,0x1c,0x00,0x18,0xdf,0x29,0x0a,0x19,0x50,
+0x15,0x03,0x09,0xc9,0x02,0x2f,0xe9,0x30,0x1b,0x00,0x06,0x27,0xff,0xc6,0x1b,0x00,
+0x2a,0x01,0xcf,0x9f,0x09,0x2d,0x70,0x00,0x65,0x01,0x04,0x01,0x00,0x17,0xe5,0x1b,
+0x00,0x1e,0x4d,0xe5,0x06,0x0c,0xe4,0x03,0x08,0x6a,0x07,0x04,0x6d,0x00,0x1e,0x8f,
+0x7a,0x0a,0x04,0x01,0x00,0x29,0x17,0xdf,0x1b,0x00,0x18,0xc1,0xdb,0x00,0x1c,0x4a,
+0xe5,0x02,0x07,0x53,0x00,0x1e,0x6c,0x38,0x07,0x0e,0x1c,0x00,0x0a,0x87,0x00,0x01,
+0x1c,0x00,0x1d,0x7d,0x1c,0x07,0x06,0x20,0x02,0x15,0xaf,0x62,0x01,0x0d,0xd1,0x01,
+0x18,0x29,0x86,0x03,0x0b,0x37,0x00,0x1e,0xcf,0x6b,0x00,0x0b,0x3d,0x02,0x07,0x12,
+0x03,0x0c,0xd2,0x01,0x22,0xf1,0x57,0x39,0x0c,0x1e,0x20,0x58,0x02,0x18,0x4b,0x64,
+0x08,0x09,0x64,0x05,0x2e,0xf6,0xaf,0x72,0x00,0x03,0x13,0x00,0x1e,0x89,0xc2,0x00,
+0x13,0x09,0xfe,0x04,0x15,0x6f,0x44,0x06,0x0c,0x8e,0x0a,0x19,0x93,0xc1,0x07,0x08,
+0xfa,0x06,0x27,0xf8,0x0f,0x12,0x0c,0x0a,0x68,0x08,0x27,0x60,0xaf,0xb3,0x04,0x09,
+0xef,0x03,0x3c,0xf4,0x04,0xff,0x24,0x04,0x14,0x1e,0x74,0x01,0x2b,0x0d,0xff,0xf0,
+0x03,0x15,0x2d,0x48,0x07,0x14,0x5f,0x99,0x04,0x1a,0x61,0x36,0x02,0x14,0xf8,0x2b,
+0x08,0x00,0x72,0x02,0x57,0x96,0x43,0x33,0x45,0x8c,0xc3,0x01,0x2f,0x02,0xff,0xa7,
+0x0c,0x06,0x04,0xbd,0x0b,0x0e,0x4a,0x09,0x05,0xfe,0x06,0x0e,0x7d,0x05,0x0e,0x63,
+0x05,0x06,0xb2,0x05,0x2f,0x06,0xff,0x7d,0x09,0x06,0x2e,0x03,0xdf,0x1c,0x06,0x0b,
+0x65,0x01,0x06,0x01,0x00,0x15,0xd3,0x17,0x01,0x1e,0x19,0x35,0x03,0x0e,0xaa,0x02,
+0x01,0x63,0x04,0x19,0x10,0x7a,0x04,0x06,0x02,0x01,0x1c,0xd9,0x45,0x04,0xf0,0x03,
+0x01,0x47,0x9b,0xde,0xff,0xff,0xed,0xca,0x75,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x2f,0x07,0x77,0x01,0x00,0x07,0x2f,0x32,0xff,0x01,0x00,0x07,0x2f,0xf7,
+0x2f,0x1d,0x00,0x08,0x1f,0x72,0x39,0x00,0xed,0x15,0x00,0x01,0x00,0x12,0x08,0x12,
+0x00,0x2f,0xf9,0x00,0x01,0x00,0x01,0x12,0x8f,0x1d,0x00,0x1e,0x90,0x1c,0x00,0x0f,
+0x39,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x0b,0x21,0x48,0x88,0x01,0x00,0x17,0x40,
+0x13,0x00,0x12,0x28,0x13,0x00,0x12,0x69,0x2d,0x00,0x17,0xf8,0x1a,0x00,0x12,0x05,
+0x13,0x00,0x22,0xfc,0x9f,0x08,0x00,0x17,0x80,0x1b,0x00,0x12,0x5f,0x13,0x00,0x1f,
+0xc9,0x35,0x00,0xff,0xff,0xff,0xff,0x63,0x2e,0xfb,0x8f,0x35,0x00,0x12,0x6f,0x13,
+0x00,0x1e,0xb7,0xf0,0x04,0x12,0x07,0x13,0x00,0x22,0xfa,0x7f,0x08,0x00,0x1e,0xa0,
+0x3a,0x05,0x12,0x95,0x07,0x00,0x17,0xfd,0x1a,0x00,0x13,0x0b,0x86,0x0b,0x12,0x3f,
+0x08,0x00,0x17,0xf1,0x1b,0x00,0x12,0xef,0x13,0x00,0x13,0x50,0xa9,0x0b,0x07,0x48,
+0x05,0x03,0xec,0x0b,0x23,0xf3,0x0d,0xa7,0x00,0x06,0x1a,0x00,0x13,0x09,0x2d,0x00,
+0x13,0x00,0xef,0x00,0x15,0xf2,0x1a,0x00,0x13,0x01,0x1a,0x00,0x23,0xb0,0x04,0x09,
+0x00,0x15,0xd0,0x1b,0x00,0x12,0xbf,0x11,0x00,0x4b,0xf6,0x00,0x0e,0xff,0xbb,0x00,
+0x13,0x8f,0x11,0x00,0x15,0x10,0x0a,0x00,0x13,0xc2,0x1a,0x00,0x15,0xaf,0x2b,0x00,
+0x14,0x01,0x4a,0x0c,0x20,0xf9,0x20,0x19,0x00,0x33,0x17,0xef,0xff,0x9e,0x00,0x04,
+0x15,0x06,0x00,0x01,0x00,0x54,0xea,0x86,0x66,0x79,0xdf,0x0d,0x00,0x5e,0xfa,0x00,
+0x00,0x00,0x0d,0x8e,0x0c,0x02,0x69,0x00,0x3f,0x00,0x00,0x3f,0x1a,0x00,0x02,0x17,
+0x50,0x7d,0x01,0x0a,0x01,0x00,0x19,0x90,0xab,0x00,0x08,0x01,0x00,0x1a,0xa0,0xc6,
+0x00,0x0e,0x1a,0x00,0x0e,0x51,0x00,0x06,0xec,0x01,0x1b,0x3d,0x19,0x00,0x26,0xfe,
+0x40,0xea,0x01,0x04,0xe4,0x00,0x0e,0x3a,0x02,0x28,0x00,0x7e,0x33,0x00,0x19,0x81,
+0x24,0x07,0x25,0x04,0x9e,0x19,0x00,0x1c,0xa5,0x40,0x07,0xf0,0x03,0x02,0x58,0xac,
+0xee,0xff,0xfe,0xec,0xb8,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,
+0x48,0x88,0x01,0x00,0x2a,0x87,0x00,0x01,0x00,0x22,0x28,0x88,0x01,0x00,0x22,0x25,
+0xff,0x01,0x00,0x1a,0xf3,0x1f,0x00,0x13,0x08,0x17,0x00,0x23,0xf1,0x0f,0x09,0x00,
+0x1a,0x80,0x20,0x00,0x12,0xdf,0x16,0x00,0x32,0xfb,0x00,0xaf,0x09,0x00,0x1a,0xfd,
+0x1f,0x00,0x13,0x1f,0x36,0x00,0x23,0x60,0x04,0x09,0x00,0x19,0xf2,0x1f,0x00,0x14,
+0x06,0x5e,0x00,0x24,0x00,0x0e,0x29,0x00,0x09,0x20,0x00,0x14,0xbf,0x5e,0x00,0x25,
+0x00,0x9f,0x0a,0x00,0x07,0x01,0x00,0x04,0x94,0x00,0x24,0x50,0x00,0x5f,0x00,0x18,
+0xf0,0x1f,0x00,0x16,0x05,0x15,0x00,0x15,0x0e,0x2a,0x00,0x07,0x01,0x00,0x03,0x54,
+0x00,0x16,0xfa,0x0b,0x00,0x18,0xf9,0x1f,0x00,0x07,0x34,0x00,0x13,0x03,0x0b,0x00,
+0x17,0xe0,0x1f,0x00,0x17,0x03,0x73,0x00,0x13,0x0d,0x0c,0x00,0x17,0x30,0x20,0x00,
+0x17,0x8f,0x53,0x00,0x03,0x0c,0x00,0x17,0xf8,0x1f,0x00,0x04,0x33,0x00,0x53,0x40,
+0x00,0x00,0x00,0x02,0x0c,0x00,0x16,0xc0,0x1f,0x00,0x18,0x01,0x72,0x00,0x04,0x2c,
+0x00,0x16,0x10,0x20,0x00,0x18,0x6f,0xb1,0x00,0x12,0x7f,0x0d,0x00,0x16,0xf6,0x1f,
+0x00,0x18,0x0b,0x91,0x00,0x04,0x5f,0x00,0x16,0xb0,0x20,0x00,0x09,0xd0,0x00,0x13,
+0x0c,0x0e,0x00,0x06,0x1f,0x00,0x19,0x4f,0xb0,0x00,0x03,0x5f,0x00,0x15,0xf4,0x1f,
+0x00,0x19,0x09,0xef,0x00,0x04,0xab,0x00,0x15,0x90,0x20,0x00,0x12,0xef,0x11,0x00,
+0x28,0xd0,0x00,0x5f,0x00,0x15,0xfe,0x1f,0x00,0x12,0x3f,0x11,0x00,0x1a,0xf7,0xcb,
+0x00,0x1c,0xf2,0x73,0x02,0x1a,0x20,0x0a,0x01,0x14,0x70,0x20,0x00,0x1a,0xcf,0x2d,
+0x01,0x03,0xeb,0x00,0x1b,0xfc,0x73,0x02,0x1b,0xf7,0x2a,0x01,0x1b,0xf1,0x73,0x02,
+0x1b,0x10,0x0b,0x01,0x1a,0x60,0x73,0x02,0x1b,0xc0,0x4a,0x01,0x1a,0xfa,0x73,0x02,
+0x06,0x6b,0x01,0x19,0x5f,0x79,0x02,0x1d,0x04,0xaa,0x01,0x07,0xe7,0x01,0x06,0x68,
+0x02,0x06,0x8a,0x01,0x19,0x0a,0x79,0x02,0x03,0x73,0x02,0x1d,0xf5,0x8a,0x01,0x19,
+0xd0,0x73,0x02,0x2c,0x00,0x00,0x6b,0x01,0x18,0x20,0x73,0x02,0x2c,0xa0,0x00,0xaa,
+0x01,0x18,0xf7,0x89,0x01,0x2d,0xf5,0x00,0x5f,0x00,0x18,0xc0,0x69,0x01,0x1e,0x00,
+0x5f,0x00,0x17,0x10,0x49,0x01,0x2d,0xa0,0x00,0x5f,0x00,0x17,0xf5,0x29,0x01,0x18,
+0xf4,0x3f,0x00,0x17,0x3f,0x33,0x00,0x0c,0x06,0x02,0x06,0x5f,0x00,0x17,0xfe,0x8a,
+0x00,0x1e,0x90,0x7d,0x04,0x01,0x93,0x04,0x1e,0x09,0x5e,0x00,0x05,0x5f,0x00,0x1a,
+0x80,0x4a,0x00,0x0c,0x9d,0x04,0x1a,0xfd,0x2a,0x00,0x0c,0x5f,0x00,0x00,0x79,0x02,
+0x1f,0x07,0xfc,0x04,0x02,0x15,0x2f,0x1a,0x02,0x1e,0xcf,0xdc,0x04,0x05,0x5f,0x00,
+0x15,0xfb,0x73,0x02,0x0b,0x1b,0x05,0x14,0x07,0x1a,0x02,0x1e,0x06,0xfb,0x04,0x07,
+0x5f,0x00,0x3e,0x50,0x00,0xbf,0x5e,0x00,0x06,0xe8,0x02,0x3b,0xf9,0x00,0x0f,0x00,
+0x03,0x0a,0xc9,0x02,0x2e,0xe0,0x04,0x5e,0x00,0x08,0x08,0x03,0x2a,0x30,0x9f,0x1f,
+0x03,0x0b,0x5c,0x05,0x2e,0xf8,0x0e,0x78,0x05,0x08,0x5f,0x00,0x1a,0xd3,0x3e,0x03,
+0x0d,0x5f,0x00,0x1e,0x9f,0x97,0x05,0x09,0x48,0x03,0x0e,0x5e,0x00,0x0a,0x9c,0x05,
+0x0e,0x5e,0x00,0x0a,0xdb,0x05,0x0f,0x5e,0x00,0x04,0x04,0x6f,0x06,0x0e,0xd5,0x05,
+0x0e,0x5f,0x00,0x09,0x14,0x06,0x0e,0x5f,0x00,0x2f,0xfa,0x00,0x5f,0x00,0x0b,0x0e,
+0x5e,0x00,0x06,0xe7,0x03,0x0e,0x5e,0x00,0x0a,0x3b,0x06,0x0b,0x52,0x06,0x0c,0x7a,
+0x06,0x06,0x18,0x04,0x0a,0x01,0x00,0x04,0xe8,0x03,0x0a,0x71,0x06,0x0e,0x5f,0x00,
+0x0e,0x5e,0x00,0x09,0x7b,0x06,0x0a,0x90,0x06,0x0e,0x5f,0x00,0x0e,0x5e,0x00,0x0a,
+0x9b,0x06,0x2f,0xf8,0x00,0x5f,0x00,0x0b,0x0f,0x5e,0x00,0x03,0x05,0x6f,0x06,0x13,
+0xd0,0x10,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x21,0x28,0x88,0x01,0x00,0x24,0x50,
+0x00,0x01,0x00,0x11,0x07,0x10,0x00,0x15,0x80,0x10,0x00,0x12,0x04,0x21,0x00,0x31,
+0x83,0x2f,0xff,0x01,0x00,0x15,0xd0,0x19,0x00,0x11,0x1f,0x10,0x00,0x15,0xf4,0x10,
+0x00,0x12,0x0c,0x21,0x00,0x22,0xf3,0x0e,0x08,0x00,0x15,0xf0,0x19,0x00,0x11,0x5f,
+0x10,0x00,0x15,0xf8,0x10,0x00,0x04,0x21,0x00,0x13,0x0b,0x31,0x00,0x05,0x19,0x00,
+0x11,0x8f,0x10,0x00,0x15,0xfb,0x10,0x00,0x03,0x73,0x00,0x22,0xc0,0x07,0x08,0x00,
+0x15,0xf6,0x19,0x00,0x12,0xcf,0x11,0x00,0x0b,0x62,0x00,0x32,0xff,0x90,0x04,0x08,
+0x00,0x15,0xf9,0x19,0x00,0x12,0xff,0x01,0x00,0x1a,0x30,0x62,0x00,0x23,0xff,0x50,
+0x19,0x00,0x14,0xfc,0x18,0x00,0x13,0x03,0x29,0x00,0x14,0x60,0x11,0x00,0x12,0xbf,
+0x10,0x00,0x3a,0x20,0x00,0xdf,0x6b,0x00,0x13,0x07,0x29,0x00,0x14,0xa0,0x11,0x00,
+0x11,0xef,0x0f,0x00,0x44,0xfe,0x00,0x00,0x9f,0x32,0x00,0x02,0x01,0x00,0x13,0x0b,
+0x29,0x00,0x13,0xe0,0x10,0x00,0x12,0x01,0x0f,0x00,0x15,0xfa,0xad,0x00,0x1a,0x50,
+0x0e,0x01,0x24,0xff,0xf1,0x70,0x01,0x02,0x0f,0x00,0x15,0xf7,0xff,0x00,0x1a,0x80,
+0x0e,0x01,0x2a,0xff,0xf5,0x8b,0x00,0x15,0xf3,0x43,0x00,0x13,0xb0,0x19,0x00,0x2a,
+0x6f,0xff,0x07,0x01,0x15,0x0a,0x91,0x01,0x1a,0x0b,0x94,0x00,0x2a,0xaf,0xff,0x07,
+0x01,0x13,0x0d,0x70,0x01,0x05,0x5c,0x00,0x04,0x94,0x00,0x03,0x05,0x01,0x05,0x07,
+0x01,0x13,0x0f,0x70,0x01,0x05,0xae,0x00,0x18,0xf5,0xe5,0x00,0x00,0x01,0x00,0x12,
+0x40,0x11,0x00,0x16,0x3f,0xec,0x00,0x18,0xff,0x06,0x02,0x15,0x05,0x29,0x00,0x19,
+0x70,0xb4,0x00,0x15,0x20,0x6d,0x00,0x03,0x06,0x02,0x15,0x08,0x29,0x00,0x03,0xde,
+0x00,0x14,0x9f,0x70,0x01,0x09,0x0b,0x00,0x05,0x7e,0x02,0x06,0xde,0x00,0x16,0xcf,
+0x47,0x00,0x03,0x5d,0x00,0x17,0x10,0xbc,0x00,0x00,0x01,0x00,0x18,0xf2,0x24,0x02,
+0x17,0xf7,0x63,0x01,0x02,0xbd,0x00,0x15,0x4f,0x29,0x00,0x02,0x79,0x02,0x26,0x02,
+0xff,0xf1,0x02,0x18,0x0e,0xbd,0x00,0x15,0x7f,0x29,0x00,0x18,0xfa,0xdd,0x00,0x17,
+0xf0,0x07,0x02,0x17,0xa0,0x55,0x02,0x00,0x01,0x00,0x18,0xfd,0xdd,0x00,0x17,0xc0,
+0xce,0x01,0x18,0xd0,0xb7,0x02,0x05,0xb5,0x00,0x15,0x0b,0x70,0x01,0x05,0x72,0x01,
+0x16,0xf0,0x93,0x00,0x16,0xfe,0x50,0x02,0x17,0x0e,0x5c,0x02,0x17,0x01,0x5f,0x03,
+0x11,0x06,0x0b,0x00,0x16,0xba,0x50,0x02,0x18,0x1f,0xae,0x02,0x16,0xdf,0xe6,0x00,
+0x02,0x2c,0x02,0x16,0x76,0x98,0x00,0x18,0x4f,0x65,0x01,0x16,0x9f,0x58,0x02,0x02,
+0x6a,0x00,0x16,0x32,0x8c,0x00,0x18,0x7f,0xb7,0x01,0x16,0x6f,0x58,0x02,0x02,0x6a,
+0x00,0x02,0x28,0x03,0x16,0xf3,0x76,0x02,0x19,0xf7,0xd5,0x02,0x05,0xc5,0x03,0x35,
+0xfc,0x00,0xaf,0x1e,0x00,0x18,0xdf,0x61,0x04,0x16,0x0f,0xb1,0x00,0x12,0x9f,0x49,
+0x02,0x15,0x6f,0x70,0x00,0x09,0x71,0x04,0x16,0x0b,0x03,0x01,0x12,0xcf,0x40,0x00,
+0x14,0x2f,0xc2,0x00,0x19,0x03,0xc3,0x04,0x16,0x08,0x5f,0x03,0x03,0x40,0x00,0x14,
+0x0e,0x63,0x00,0x17,0x06,0x70,0x01,0x05,0x72,0x01,0x14,0xb0,0x0a,0x00,0x34,0xc0,
+0x00,0x0b,0x2d,0x04,0x19,0x09,0x37,0x04,0x15,0x01,0x81,0x02,0x13,0x07,0x5b,0x00,
+0x14,0x07,0x48,0x00,0x1a,0x0c,0x1e,0x04,0x14,0xdf,0x5f,0x03,0x13,0x0b,0x71,0x02,
+0x14,0x03,0x9a,0x00,0x18,0x0f,0x70,0x01,0x04,0x2d,0x01,0x13,0xf4,0x18,0x00,0x00,
+0x0e,0x02,0x04,0x3a,0x00,0x1a,0x2f,0x2d,0x05,0x14,0x6f,0x56,0x01,0x14,0x3f,0x60,
+0x02,0x13,0xbf,0x3a,0x00,0x18,0x5f,0x70,0x01,0x04,0x38,0x00,0x13,0xfa,0x32,0x00,
+0x14,0xf9,0xba,0x01,0x14,0xf8,0x1d,0x05,0x05,0xd1,0x05,0x14,0x0f,0xaa,0x02,0x14,
+0xaf,0xe2,0x03,0x13,0x3f,0xd5,0x01,0x1a,0xbf,0xe1,0x05,0x14,0x0b,0xc4,0x01,0x14,
+0xef,0x34,0x04,0x18,0x0f,0x11,0x00,0x06,0x33,0x06,0x13,0x08,0x8e,0x05,0x15,0x01,
+0x17,0x00,0x18,0x0c,0x11,0x00,0x04,0x70,0x01,0x05,0x72,0x01,0x25,0x70,0x05,0x17,
+0x00,0x12,0x08,0x11,0x00,0x1b,0x04,0xa7,0x05,0x13,0x01,0x5f,0x03,0x15,0x09,0xf4,
+0x01,0x12,0x04,0x11,0x00,0x1a,0x07,0x70,0x01,0x04,0x72,0x01,0x26,0xd0,0x0c,0x55,
+0x03,0x02,0xac,0x01,0x1b,0x0a,0x4b,0x06,0x03,0x72,0x01,0x26,0xf0,0x0f,0x87,0x01,
+0x11,0xcf,0x2d,0x04,0x1b,0x0d,0x9d,0x06,0x03,0x72,0x01,0x26,0xf3,0x4f,0xf9,0x03,
+0x11,0x8f,0x29,0x01,0x1b,0x0f,0xef,0x06,0x03,0x05,0x05,0x26,0xf6,0x8f,0x4b,0x04,
+0x11,0x4f,0x7b,0x01,0x1b,0x3f,0x41,0x07,0x03,0x37,0x01,0x26,0xf9,0xbf,0x9d,0x04,
+0x11,0x1f,0x83,0x01,0x19,0x6f,0x8d,0x05,0x05,0x37,0x01,0x17,0xfc,0xef,0x04,0x02,
+0x9e,0x00,0x1b,0xaf,0xa3,0x07,0x07,0x3f,0x05,0x04,0x84,0x04,0x03,0xb2,0x02,0x0a,
+0x70,0x01,0x05,0x72,0x01,0x07,0x5e,0x01,0x1d,0x05,0x12,0x00,0x0b,0xe3,0x05,0x04,
+0x5e,0x01,0x0e,0x12,0x00,0x0b,0x35,0x06,0x2d,0xff,0xfe,0x12,0x00,0x07,0x70,0x01,
+0x06,0x87,0x06,0x06,0x5e,0x01,0x1d,0x9f,0x12,0x00,0x09,0xd9,0x06,0x06,0xce,0x02,
+0x03,0x4c,0x07,0x0a,0x70,0x01,0x05,0x77,0x06,0x07,0x5d,0x08,0x03,0xf0,0x04,0x0a,
+0x70,0x01,0x08,0x0d,0x06,0x1b,0xf0,0x8f,0x07,0x09,0x70,0x01,0x08,0x5f,0x06,0x1a,
+0xb0,0x56,0x07,0x0a,0x70,0x01,0x08,0x72,0x01,0x03,0xda,0x06,0x04,0x4d,0x04,0x08,
+0x35,0x08,0x0a,0x60,0x01,0x04,0x9e,0x08,0x1e,0x02,0x70,0x01,0x0a,0x60,0x01,0x1a,
+0x00,0x75,0x08,0x08,0xd9,0x08,0x09,0x17,0x00,0x1e,0xfc,0x5b,0x01,0x2e,0x00,0x00,
+0x72,0x01,0x08,0x35,0x01,0x1e,0x6f,0x70,0x01,0x08,0x17,0x00,0x1c,0xf4,0x94,0x09,
+0x0a,0x70,0x01,0x06,0x72,0x01,0x1c,0xf0,0xe6,0x09,0x0a,0x70,0x01,0x06,0x72,0x01,
+0x2b,0xc0,0x00,0x3f,0x04,0x0a,0x70,0x01,0x06,0x72,0x01,0x16,0x80,0x9a,0x0a,0x0e,
+0x70,0x01,0x08,0x72,0x01,0x2c,0x40,0x00,0xce,0x09,0x09,0x70,0x01,0x06,0x72,0x01,
+0x16,0x10,0x13,0x00,0x06,0x70,0x01,0x50,0x00,0x00,0x00,0x00,0x00,0x22,0x2b,0xbb,
+0x01,0x00,0x27,0xa0,0x00,0x01,0x00,0x13,0x9b,0x15,0x00,0x32,0x30,0xcf,0xff,0x01,
+0x00,0x17,0x50,0x1d,0x00,0x13,0x5f,0x14,0x00,0x23,0xc0,0x02,0x09,0x00,0x17,0xfe,
+0x1d,0x00,0x13,0x0d,0x14,0x00,0x33,0xf3,0x00,0x09,0x0a,0x00,0x16,0xf7,0x1d,0x00,
+0x13,0x06,0x13,0x00,0x43,0xf9,0x00,0x00,0x1e,0x0b,0x00,0x16,0xe0,0x1e,0x00,0x13,
+0xef,0x13,0x00,0x43,0x10,0x00,0x00,0x6f,0x0b,0x00,0x15,0x80,0x1d,0x00,0x13,0x8f,
+0x12,0x00,0x56,0x70,0x00,0x00,0x00,0xdf,0x29,0x00,0x02,0x01,0x00,0x13,0x1f,0x11,
+0x00,0x56,0xd0,0x00,0x00,0x00,0x04,0x64,0x00,0x02,0x01,0x00,0x04,0x88,0x00,0x10,
+0xf4,0x0d,0x00,0x13,0x0a,0x0d,0x00,0x13,0xf2,0x1d,0x00,0x04,0xc3,0x00,0x19,0xfb,
+0x48,0x00,0x13,0xb0,0x1e,0x00,0x13,0xaf,0x10,0x00,0x19,0x20,0x83,0x00,0x12,0x30,
+0x1d,0x00,0x1a,0x3f,0xa4,0x00,0x03,0xbe,0x00,0x12,0xfc,0x0e,0x00,0x1a,0x0b,0xdf,
+0x00,0x18,0x05,0x84,0x00,0x05,0xa3,0x00,0x13,0xf5,0x67,0x00,0x17,0x0c,0xbf,0x00,
+0x39,0x00,0x00,0xcf,0x49,0x00,0x33,0x00,0x00,0x2f,0x1e,0x00,0x18,0x60,0x7c,0x01,
+0x14,0x30,0x1e,0x00,0x17,0x9f,0x83,0x01,0x04,0x7c,0x01,0x14,0x90,0x1d,0x00,0x26,
+0x01,0xef,0x83,0x01,0x13,0x07,0x1d,0x00,0x1d,0xf1,0x8e,0x01,0x16,0xf1,0xbe,0x00,
+0x1e,0xf7,0xc9,0x01,0x15,0x80,0xf9,0x00,0x17,0xfd,0xe7,0x01,0x15,0x4f,0x83,0x01,
+0x04,0x34,0x01,0x17,0x40,0x1e,0x00,0x03,0x38,0x01,0x3b,0xfa,0x00,0x09,0x51,0x01,
+0x01,0x95,0x00,0x04,0x83,0x01,0x1b,0x02,0x8c,0x01,0x01,0x01,0x00,0x14,0x08,0x32,
+0x00,0x03,0x44,0x00,0x28,0xf8,0x00,0x01,0x00,0x13,0x0e,0x1e,0x00,0x1e,0x7f,0x79,
+0x02,0x07,0x1d,0x01,0x0e,0xb4,0x02,0x00,0x01,0x00,0x19,0xbf,0x1d,0x00,0x1a,0xc0,
+0x1d,0x00,0x19,0x02,0x1d,0x00,0x1a,0xf3,0x1d,0x00,0x05,0xc7,0x00,0x0a,0x59,0x02,
+0x04,0x01,0x00,0x18,0x1e,0x1e,0x00,0x1c,0x10,0x1e,0x00,0x17,0x6f,0x1d,0x00,0x1c,
+0x70,0x1d,0x00,0x05,0xcb,0x02,0x05,0xfe,0x01,0x08,0x01,0x00,0x16,0x03,0x1d,0x00,
+0x1d,0xf4,0x1d,0x00,0x05,0xcb,0x02,0x04,0xbd,0x02,0x0a,0x01,0x00,0x04,0x97,0x01,
+0x04,0xbd,0x02,0x0e,0x0c,0x01,0x0e,0x07,0x01,0x0b,0xdc,0x01,0x0a,0xd4,0x01,0x0b,
+0x17,0x02,0x0a,0x0f,0x02,0x0b,0x52,0x02,0x0a,0x4a,0x02,0x0b,0x8d,0x02,0x0a,0x85,
+0x02,0x0b,0xc8,0x02,0x01,0x01,0x00,0x09,0x8b,0x04,0x08,0x6b,0x03,0x0a,0xfb,0x02,
+0x0b,0x3e,0x03,0x0a,0x36,0x03,0x1a,0x00,0x79,0x03,0x02,0x01,0x00,0x1b,0xf6,0x1e,
+0x00,0x19,0xef,0x1e,0x00,0x1a,0xe1,0x1d,0x00,0x04,0xef,0x03,0x0c,0x55,0x03,0x09,
+0x95,0x03,0x1e,0x6f,0x65,0x01,0x06,0xfd,0x03,0x2e,0xa0,0xaf,0x95,0x00,0x05,0x92,
+0x00,0x2b,0xf2,0x01,0x06,0x04,0x08,0x10,0x02,0x3e,0xf9,0x00,0x08,0x20,0x05,0x25,
+0x00,0x7f,0x64,0x02,0x1d,0x1e,0x20,0x05,0x26,0x00,0x1f,0x64,0x02,0x1d,0x7f,0x95,
+0x00,0x17,0x0a,0x4e,0x00,0x1c,0xef,0x35,0x02,0x17,0x04,0x1e,0x01,0x0a,0xa9,0x04,
+0x07,0x92,0x00,0x1e,0xfd,0xa9,0x04,0x07,0xdd,0x02,0x18,0x40,0x38,0x02,0x1b,0x70,
+0x18,0x03,0x19,0xc0,0x73,0x02,0x1a,0x10,0x53,0x03,0x19,0xf3,0xea,0x02,0x2f,0xfa,
+0x00,0x0f,0x00,0x01,0x1a,0x0a,0x97,0x03,0x1a,0xcf,0xdf,0x00,0x19,0x1f,0x67,0x00,
+0x1b,0x6f,0xaf,0x01,0x18,0x8f,0x3e,0x05,0x1b,0x0e,0x7f,0x02,0x04,0x93,0x02,0x27,
+0xfe,0x10,0x7a,0x04,0x05,0xba,0x02,0x17,0x07,0xf1,0x03,0x0e,0xeb,0x06,0x17,0x0e,
+0xbe,0x04,0x18,0xbf,0x65,0x00,0x0a,0x24,0x07,0x06,0x0b,0x00,0x07,0xe0,0x03,0x06,
+0x56,0x07,0x1e,0x0d,0xe0,0x03,0x15,0x04,0x6b,0x00,0x1e,0x07,0xd5,0x02,0x05,0x5c,
+0x02,0x2e,0xf8,0x01,0x10,0x03,0x06,0x29,0x03,0x2f,0xf2,0xaf,0x4b,0x03,0x01,0x90,
+0xaf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb0,0x21,0x68,0x88,0x01,0x00,0x28,0x85,
+0x00,0x01,0x00,0x22,0x02,0x88,0x01,0x00,0x31,0x70,0x6f,0xff,0x01,0x00,0x19,0xfe,
+0x1e,0x00,0x22,0x0a,0xff,0x01,0x00,0x23,0xb0,0x0d,0x09,0x00,0x18,0x60,0x1e,0x00,
+0x13,0x1f,0x15,0x00,0x23,0x20,0x05,0x09,0x00,0x18,0xd0,0x1e,0x00,0x12,0x8f,0x14,
+0x00,0x42,0xfa,0x00,0x00,0xdf,0x0a,0x00,0x18,0xf5,0x1e,0x00,0x03,0x32,0x00,0x42,
+0xf2,0x00,0x00,0x5f,0x0a,0x00,0x17,0xfc,0x1d,0x00,0x13,0x07,0x1e,0x00,0x34,0xa0,
+0x00,0x00,0x79,0x00,0x16,0x30,0x1e,0x00,0x14,0x0e,0x77,0x00,0x34,0x00,0x00,0x05,
+0xa0,0x00,0x06,0x1e,0x00,0x03,0xc8,0x00,0x10,0xf9,0x0c,0x00,0x15,0xcf,0x65,0x00,
+0x04,0x01,0x00,0x03,0x8b,0x00,0x10,0xf1,0x0c,0x00,0x17,0x4f,0x2a,0x00,0x01,0x01,
+0x00,0x13,0x04,0x4e,0x00,0x10,0x90,0x0d,0x00,0x13,0x0c,0x0d,0x00,0x14,0x10,0x1e,
+0x00,0x09,0x11,0x00,0x04,0x2b,0x00,0x14,0x80,0x1e,0x00,0x12,0x3f,0x10,0x00,0x12,
+0xf8,0x0e,0x00,0x12,0xbf,0x0e,0x00,0x14,0xe0,0x1e,0x00,0x17,0xaf,0x77,0x00,0x05,
+0x2c,0x00,0x14,0xf7,0x83,0x01,0x0a,0x4c,0x00,0x1a,0x0b,0x89,0x01,0x1a,0x09,0x88,
+0x00,0x13,0x03,0x0f,0x00,0x19,0x50,0x83,0x01,0x03,0x77,0x00,0x05,0x79,0x00,0x19,
+0xc0,0x83,0x01,0x1b,0xe0,0xa5,0x00,0x12,0xf4,0x0e,0x00,0x12,0xef,0x0e,0x00,0x1b,
+0x70,0xed,0x01,0x11,0xfb,0x0d,0x00,0x1c,0x06,0x0f,0x02,0x16,0x02,0x76,0x01,0x05,
+0x83,0x01,0x16,0xf7,0x59,0x01,0x15,0xaf,0xb2,0x01,0x05,0xd2,0x01,0x16,0xe0,0x1e,
+0x00,0x17,0x2f,0x00,0x01,0x1d,0xcf,0x4a,0x02,0x16,0x09,0xc5,0x00,0x1e,0x04,0x86,
+0x02,0x04,0x79,0x00,0x06,0x1b,0x01,0x18,0xf6,0x49,0x02,0x15,0x9f,0xc6,0x00,0x2e,
+0x2f,0xff,0x85,0x02,0x15,0x1f,0x8b,0x00,0x19,0xaf,0x38,0x01,0x09,0x79,0x00,0x32,
+0xf5,0x00,0x01,0x09,0x00,0x19,0xfd,0xfd,0x02,0x05,0x15,0x00,0x1e,0x09,0xc0,0x02,
+0x06,0x5d,0x01,0x2e,0x40,0x1f,0x77,0x00,0x06,0x79,0x00,0x2d,0xb0,0x7f,0x77,0x00,
+0x00,0x01,0x00,0x12,0x08,0x16,0x00,0x2d,0xf3,0xef,0xfb,0x02,0x07,0x9a,0x01,0x19,
+0xfe,0xae,0x01,0x06,0x01,0x00,0x03,0x53,0x00,0x09,0xea,0x01,0x0e,0x1e,0x03,0x02,
+0x9d,0x00,0x0c,0x1e,0x00,0x04,0x5a,0x03,0x0e,0x77,0x00,0x08,0x13,0x02,0x01,0x9c,
+0x00,0x0e,0x1e,0x00,0x03,0x5b,0x03,0x0b,0x71,0x03,0x1e,0x00,0x79,0x00,0x1e,0x30,
+0x1e,0x00,0x03,0x50,0x02,0x05,0x60,0x02,0x0b,0x01,0x00,0x1f,0xdf,0x77,0x00,0x08,
+0x07,0x79,0x00,0x1e,0xa0,0x1e,0x00,0x06,0x23,0x04,0x2e,0xff,0x20,0x1e,0x00,0x06,
+0x23,0x04,0x1e,0xfa,0x1d,0x00,0x07,0x79,0x00,0x1e,0xf2,0x1e,0x00,0x07,0xe4,0x01,
+0x1f,0xc0,0x1e,0x00,0xff,0xff,0xca,0x2f,0x37,0x77,0x01,0x00,0x04,0x3f,0x74,0x08,
+0xff,0x01,0x00,0x05,0x2f,0xa0,0x8f,0x1a,0x00,0x05,0x1f,0xfa,0x35,0x00,0x8b,0x1f,
+0xf9,0x35,0x00,0x07,0x1f,0x20,0x35,0x00,0x06,0x1f,0x60,0x35,0x00,0x06,0x0e,0x06,
+0x05,0x04,0x9f,0x07,0x1e,0xe1,0x6a,0x04,0x0e,0x06,0x09,0x0b,0xc3,0x06,0x0e,0xa2,
+0x04,0x04,0xa3,0x08,0x2d,0xfe,0x10,0x1a,0x00,0x1e,0x1e,0xe2,0x05,0x0b,0xb4,0x09,
+0x1e,0x90,0x0b,0x05,0x0e,0xa7,0x09,0x04,0xeb,0x06,0x1f,0xef,0x7e,0x05,0x06,0x1b,
+0xbf,0x62,0x08,0x0d,0x96,0x05,0x1e,0xfc,0x1a,0x00,0x1e,0x2f,0x91,0x05,0x0b,0x45,
+0x09,0x2e,0x70,0x00,0x9a,0x06,0x0e,0xba,0x02,0x0a,0x54,0x01,0x1f,0xf2,0x54,0x01,
+0x06,0x1f,0xf6,0x54,0x01,0x06,0x1f,0xfb,0x54,0x01,0x21,0x1f,0x50,0x54,0x01,0x06,
+0x1e,0xa0,0x54,0x01,0x0e,0xf1,0x01,0x0b,0x54,0x01,0x1f,0xf4,0x54,0x01,0x06,0x1f,
+0xf9,0x54,0x01,0x06,0x1f,0xfd,0x54,0x01,0x07,0x1e,0x30,0x54,0x01,0x0c,0x8c,0x0a,
+0x0c,0x67,0x08,0x0f,0x54,0x01,0x22,0x1f,0xf7,0x54,0x01,0x06,0x1f,0xfc,0x54,0x01,
+0x06,0x2e,0xff,0x20,0x54,0x01,0x0e,0x39,0x0c,0x0c,0x5c,0x0c,0x0f,0x54,0x01,0x20,
+0x1f,0xf5,0x54,0x01,0x06,0x1e,0xfa,0x1a,0x00,0x1e,0x7f,0xf1,0x01,0x0b,0x54,0x01,
+0x1e,0x40,0x54,0x01,0x0e,0x45,0x03,0x0b,0x54,0x01,0x1e,0xd0,0x54,0x01,0x0e,0xc3,
+0x08,0x0b,0x54,0x01,0x1f,0xf8,0x54,0x01,0x3b,0x1e,0x70,0x54,0x01,0x0e,0xf1,0x01,
+0x0b,0x54,0x01,0x2b,0xf8,0x66,0x01,0x00,0x3f,0x62,0x01,0xff,0xf9,0x04,0x06,0x1f,
+0xbf,0x1a,0x00,0x05,0x2f,0xf6,0x6f,0x35,0x00,0x06,0x2f,0x69,0xff,0x35,0x00,0x06,
+0x1f,0x9f,0x35,0x00,0xa1,0x50,0xff,0xff,0xff,0xff,0x60,0x24,0x6f,0xff,0x01,0x00,
+0x15,0xe6,0x0a,0x00,0x1f,0xfe,0x15,0x00,0x48,0x42,0xa8,0x88,0x88,0x76,0x0a,0x00,
+0x43,0xf3,0x00,0x00,0x00,0x15,0x00,0x4f,0x30,0x00,0x00,0x06,0x15,0x00,0xff,0xff,
+0xe9,0x4f,0xfa,0x88,0x88,0x87,0x87,0x03,0x56,0x20,0x78,0x88,0x01,0x00,0x29,0x87,
+0x00,0x01,0x00,0x16,0x09,0x9e,0x00,0x07,0x01,0x00,0x12,0x3f,0x16,0x00,0x1a,0x90,
+0x16,0x00,0x12,0xdf,0x16,0x00,0x0a,0x15,0x00,0x12,0x07,0x15,0x00,0x1a,0xf5,0x16,
+0x00,0x12,0x1f,0x16,0x00,0x1a,0xb0,0x16,0x00,0x12,0xbf,0x16,0x00,0x19,0x20,0x15,
+0x00,0x12,0x05,0x15,0x00,0x1a,0xf8,0x2b,0x00,0x12,0x0e,0x16,0x00,0x1a,0xe0,0x16,
+0x00,0x12,0x9f,0x16,0x00,0x19,0x40,0x15,0x00,0x13,0x02,0x4c,0x01,0x0a,0x2b,0x00,
+0x12,0x0c,0x16,0x00,0x1a,0xf1,0x16,0x00,0x03,0x19,0x01,0x19,0x60,0x15,0x00,0x12,
+0x01,0x15,0x00,0x1a,0xfc,0x2b,0x00,0x12,0x0a,0x16,0x00,0x1a,0xf2,0x16,0x00,0x1f,
+0x4f,0x1a,0x01,0x02,0x12,0xef,0x62,0x01,0x0a,0x15,0x00,0x1f,0x08,0x1a,0x01,0x02,
+0x1f,0x2f,0x1a,0x01,0x09,0x1f,0x10,0x1a,0x01,0x01,0x1a,0xf7,0x2b,0x00,0x12,0x0f,
+0x16,0x00,0x1f,0xd0,0x1a,0x01,0x02,0x19,0x30,0x15,0x00,0x1f,0x03,0x1a,0x01,0x02,
+0x12,0x0d,0x16,0x00,0x1a,0xf0,0x16,0x00,0x1f,0x7f,0x1a,0x01,0x17,0x1f,0x0b,0x1a,
+0x01,0x09,0x1f,0x80,0x1a,0x01,0x17,0x1f,0xf4,0x1a,0x01,0x02,0x1a,0xa0,0x16,0x00,
+0x1f,0xcf,0x1a,0x01,0x01,0x1f,0x06,0x1a,0x01,0x18,0x1f,0xaf,0x1a,0x01,0x01,0x12,
+0x04,0x15,0x00,0x1f,0xf9,0x1a,0x01,0x18,0x1f,0x50,0x1a,0x01,0x01,0x1f,0xfb,0x1a,
+0x01,0x11,0x1f,0x5f,0x1a,0x01,0x17,0x1e,0x09,0x1a,0x01,0x06,0x8f,0x03,0x1e,0xa0,
+0x8f,0x03,0x0f,0x1a,0x01,0x05,0x1f,0xf6,0x8f,0x03,0x02,0x1f,0xc0,0x1a,0x01,0x26,
+0x0f,0x8f,0x03,0x03,0x1e,0x8f,0x1a,0x01,0x05,0x8f,0x03,0x1f,0xfb,0x8f,0x03,0x18,
+0x1a,0x70,0x16,0x00,0x02,0x15,0x00,0x1f,0xfd,0x1a,0x01,0x2e,0x0e,0xa9,0x04,0x0f,
+0x1a,0x01,0x15,0x0f,0xa9,0x04,0x2e,0x1e,0x8f,0xa9,0x04,0x0f,0x1a,0x01,0x30,0x1e,
+0x01,0x1a,0x01,0x06,0xa9,0x04,0x1f,0xf3,0xa9,0x04,0x17,0x1f,0xff,0xa9,0x04,0x18,
+0x0f,0x1a,0x01,0x04,0x06,0x62,0x06,0x15,0xd6,0x0a,0x00,0x1f,0xfd,0x15,0x00,0x41,
+0x46,0x38,0x88,0x88,0x8d,0xd8,0x03,0x15,0xbf,0x01,0x01,0x1f,0x0b,0x15,0x00,0xff,
+0xff,0xe9,0x5f,0xd3,0x88,0x88,0x88,0xdf,0x72,0x03,0x47,0x0c,0x15,0x00,0x50,0xff,
+0xff,0xff,0xff,0xfd,0x12,0x00,0x01,0x00,0x68,0x78,0x88,0x88,0x88,0x87,0x00,0x01,
+0x00,0x20,0x05,0xff,0x01,0x00,0x18,0x50,0x13,0x00,0x11,0x0b,0x13,0x00,0x18,0xb0,
+0x13,0x00,0x11,0x2f,0x13,0x00,0x18,0xf2,0x13,0x00,0x11,0x8f,0x13,0x00,0x18,0xf8,
+0x13,0x00,0x11,0xef,0x13,0x00,0x1d,0xfe,0x5e,0x00,0x09,0x60,0x00,0x13,0x0c,0x13,
+0x00,0x1c,0xc0,0x5e,0x00,0x09,0x60,0x00,0x13,0x9f,0x13,0x00,0x16,0xf9,0x13,0x00,
+0x14,0xff,0x01,0x00,0x05,0x12,0x00,0x15,0x06,0x13,0x00,0x1c,0x60,0x5e,0x00,0x07,
+0x60,0x00,0x15,0x3f,0x13,0x00,0x19,0xf3,0x5e,0x00,0x19,0x99,0x60,0x00,0x01,0x21,
+0x00,0x18,0x33,0x60,0x00,0x01,0x5e,0x00,0x37,0xfd,0x00,0xdf,0x60,0x00,0x10,0x0d,
+0x0c,0x00,0x30,0xf7,0x00,0x7f,0x07,0x00,0x17,0xd0,0x5e,0x00,0x37,0xf1,0x00,0x1f,
+0x60,0x00,0x12,0xaf,0x3f,0x01,0x01,0x47,0x01,0x11,0xfa,0x12,0x00,0x13,0x01,0x05,
+0x01,0x02,0x0f,0x01,0x10,0x10,0x13,0x00,0x14,0x07,0x2b,0x01,0x01,0x35,0x01,0x15,
+0x70,0x5e,0x00,0x14,0xf9,0x5b,0x01,0x01,0x60,0x00,0x14,0x4f,0x57,0x00,0x01,0x23,
+0x01,0x15,0xf4,0x5e,0x00,0x14,0xd0,0xeb,0x00,0x15,0xfa,0x5e,0x00,0x15,0x60,0x11,
+0x01,0x13,0x10,0x5e,0x00,0x24,0xff,0x10,0x1d,0x00,0x00,0x60,0x00,0x16,0x0e,0x8f,
+0x00,0x01,0x43,0x00,0x13,0xe0,0x5e,0x00,0x01,0x55,0x00,0x05,0x0b,0x00,0x13,0xbf,
+0x1b,0x00,0x13,0x00,0x31,0x00,0x13,0xfb,0x41,0x00,0x11,0x80,0x13,0x00,0x12,0x08,
+0x57,0x00,0x02,0x07,0x00,0x11,0x20,0x13,0x00,0x12,0x02,0x1f,0x00,0x01,0x2d,0x00,
+0x13,0xfc,0x3a,0x01,0x11,0xcf,0x45,0x00,0x10,0x5f,0x06,0x00,0x13,0xf6,0x13,0x00,
+0x01,0x0d,0x00,0x22,0xf5,0xbf,0x2d,0x01,0x02,0x01,0x00,0x11,0x0f,0x60,0x00,0x1f,
+0xaa,0x01,0x00,0x01,0x02,0x5c,0x02,0x0b,0x01,0x00,0x2f,0xfc,0xff,0x01,0x00,0x01,
+0x1f,0xcf,0x2b,0x00,0x98,0x22,0xc0,0x2a,0xdf,0x00,0x17,0xa4,0x41,0x03,0x26,0xff,
+0xe0,0x93,0x01,0x04,0x67,0x01,0x03,0x53,0x00,0x11,0x30,0x3b,0x02,0x26,0xdf,0xff,
+0x5b,0x01,0x12,0x01,0x62,0x03,0x11,0xf7,0x0d,0x00,0x18,0x03,0x35,0x03,0x27,0x04,
+0xff,0xb5,0x03,0x18,0x05,0x75,0x03,0x12,0x07,0x95,0x03,0x11,0x10,0x0d,0x00,0x26,
+0x09,0xff,0x06,0x02,0x03,0xe8,0x03,0x18,0xf4,0x39,0x03,0x03,0xd5,0x02,0x17,0x1d,
+0x8d,0x00,0x26,0x00,0x2e,0xee,0x01,0x00,0x83,0x00,0x89,0x58,0xac,0xee,0xff,0xfe,
+0xca,0x74,0x00,0x01,0x00,0x23,0x27,0xdf,0xe3,0x00,0x18,0xfb,0x4a,0x04,0x16,0x3b,
+0xfb,0x00,0x25,0xfe,0x60,0x16,0x00,0x18,0x1b,0x13,0x01,0x2d,0xfd,0x30,0xcc,0x03,
+0x18,0xff,0x38,0x02,0x0c,0x0a,0x02,0x17,0x70,0xc7,0x00,0x0d,0x2f,0x00,0x1d,0x7f,
+0x72,0x01,0x16,0x30,0x28,0x01,0x08,0x01,0x00,0x05,0x3f,0x03,0x0e,0x46,0x00,0x13,
+0x5f,0x0c,0x00,0x44,0xc6,0x32,0x13,0x5a,0xa4,0x00,0x06,0x93,0x01,0x10,0xe4,0x67,
+0x00,0x15,0x2d,0x5d,0x00,0x28,0x01,0xff,0xaa,0x01,0x14,0xef,0xc4,0x01,0x27,0x05,
+0xff,0xa7,0x01,0x04,0x52,0x00,0x13,0xc0,0x3e,0x03,0x04,0x00,0x03,0x12,0x0e,0x0e,
+0x00,0x38,0xf0,0x00,0x09,0x08,0x02,0x24,0x00,0x0a,0x25,0x00,0x21,0x03,0x55,0x01,
+0x00,0x03,0x50,0x01,0x1b,0x07,0xc2,0x04,0x0a,0x60,0x05,0x0f,0x17,0x00,0x04,0x1f,
+0xf4,0x17,0x00,0x23,0x33,0x25,0x7a,0xcd,0xcb,0x00,0x07,0x17,0x00,0x2a,0x05,0xae,
+0x2c,0x01,0x02,0x17,0x00,0x3e,0x18,0xef,0xff,0x17,0x00,0x04,0xe9,0x00,0x0b,0x17,
+0x00,0x2e,0x02,0xdf,0x17,0x00,0x04,0x7a,0x04,0x0d,0x17,0x00,0x03,0xd0,0x02,0x0c,
+0x17,0x00,0x16,0x1e,0x0e,0x00,0x35,0xee,0xee,0xef,0x17,0x00,0x13,0xbf,0x14,0x00,
+0x28,0xd8,0x42,0xcf,0x00,0x04,0x44,0x00,0x1a,0xd5,0xe6,0x00,0x13,0x0b,0xa3,0x03,
+0x1a,0x10,0x17,0x00,0x12,0x1f,0x09,0x00,0x1b,0xe1,0x14,0x01,0x18,0x5f,0x78,0x02,
+0x06,0x17,0x00,0x03,0x98,0x02,0x1b,0x10,0x17,0x00,0x15,0xaf,0x31,0x02,0x09,0x17,
+0x00,0x17,0xcf,0xc4,0x03,0x0f,0x17,0x00,0x15,0x04,0x87,0x06,0x14,0x0d,0x17,0x00,
+0x19,0xbf,0xeb,0x06,0x14,0xbf,0x17,0x00,0x18,0x9f,0x07,0x04,0x2b,0x2c,0xff,0xb8,
+0x00,0x01,0x05,0x04,0x16,0x28,0x42,0x01,0x14,0x1f,0x90,0x03,0x35,0x97,0x67,0x9d,
+0x4b,0x01,0x14,0xf5,0x14,0x01,0x0c,0x0f,0x03,0x0e,0x3b,0x03,0x02,0xd7,0x02,0x1e,
+0xaf,0x17,0x00,0x00,0xb9,0x06,0x1d,0x1d,0x17,0x00,0x00,0x41,0x06,0x29,0x00,0x02,
+0x25,0x02,0x06,0x25,0x08,0x18,0x2e,0xdc,0x01,0x24,0x8f,0xff,0x67,0x04,0x26,0x01,
+0xcf,0x36,0x04,0x26,0x30,0x4f,0xf5,0x00,0x15,0x07,0x47,0x00,0x37,0x90,0x00,0x0e,
+0xe4,0x07,0x13,0x07,0x58,0x02,0x51,0xa2,0x00,0x00,0x06,0xbb,0x01,0x00,0x12,0xa1,
+0x9a,0x06,0x58,0x7a,0xce,0xff,0xfe,0xc9,0x90,0x04,0x20,0x67,0x77,0x01,0x00,0x1b,
+0x75,0xff,0x02,0x0b,0x87,0x01,0x0f,0x17,0x00,0xff,0xb6,0x6c,0x26,0xac,0xef,0xfe,
+0xdb,0x84,0x17,0x00,0x13,0x4b,0xad,0x02,0x19,0x30,0x17,0x00,0x05,0x93,0x06,0x27,
+0xfa,0x10,0x17,0x00,0x16,0x04,0xb8,0x02,0x17,0xe4,0x17,0x00,0x08,0xb1,0x04,0x15,
+0x60,0x17,0x00,0x1c,0xfe,0x49,0x06,0x0f,0x18,0x08,0x01,0x1f,0x40,0x17,0x00,0x03,
+0x1f,0xf1,0x17,0x00,0x03,0x1e,0xfb,0x17,0x00,0x03,0x46,0x00,0x0f,0x17,0x00,0x02,
+0x16,0xd0,0x17,0x00,0x6b,0xd7,0x42,0x12,0x48,0xdf,0xff,0x50,0x04,0x28,0xff,0xd4,
+0x68,0x07,0x14,0xfb,0x17,0x00,0x1a,0xfc,0x84,0x0b,0x38,0x10,0xcf,0xff,0x0a,0x08,
+0x14,0x04,0xe9,0x00,0x15,0xcf,0xc2,0x00,0x08,0xa0,0x0b,0x1b,0xa0,0x87,0x01,0x13,
+0x2f,0xcc,0x06,0x0b,0x17,0x00,0x13,0x0b,0xe8,0x00,0x0b,0x17,0x00,0x13,0x07,0xa2,
+0x00,0x0b,0x17,0x00,0x13,0x03,0x68,0x04,0x0c,0xe3,0x01,0x03,0xbb,0x01,0x0c,0x17,
+0x00,0x12,0xef,0xba,0x01,0x0c,0x17,0x00,0x03,0x10,0x00,0x0c,0x17,0x00,0x12,0xbf,
+0xa2,0x05,0x0c,0x17,0x00,0x1f,0xaf,0x17,0x00,0x09,0x1f,0xfe,0x17,0x00,0x2b,0x0e,
+0x73,0x00,0x0f,0x17,0x00,0x09,0x1e,0xdf,0xb8,0x00,0x06,0xe6,0x00,0x1f,0xfb,0x14,
+0x01,0x13,0x1e,0x02,0x42,0x01,0x07,0xfc,0x01,0x1b,0xf5,0x17,0x00,0x13,0x0a,0x42,
+0x06,0x0b,0x17,0x00,0x19,0x0f,0xcc,0x01,0x02,0xe4,0x08,0x06,0x65,0x09,0x1a,0xb0,
+0x28,0x02,0x1b,0x02,0x28,0x02,0x12,0xfb,0x17,0x00,0x1b,0x1c,0x56,0x02,0x21,0xff,
+0xd3,0xe1,0x01,0x14,0xdf,0x7b,0x02,0x05,0xb2,0x02,0x55,0xb6,0x20,0x00,0x25,0xbf,
+0x8f,0x06,0x0f,0xe0,0x02,0x02,0x1f,0xe0,0x17,0x00,0x03,0x1f,0x50,0x17,0x00,0x02,
+0x1f,0xfc,0x3c,0x03,0x03,0x1e,0xf2,0xaf,0x03,0x03,0xc7,0x03,0x12,0xcf,0xe8,0x03,
+0x08,0x16,0x00,0x15,0xf8,0x46,0x02,0x27,0xc0,0x5f,0x17,0x00,0x15,0x80,0x17,0x00,
+0x17,0xa0,0x22,0x04,0x16,0xf6,0x74,0x02,0x16,0x80,0x50,0x04,0x26,0xfb,0x20,0x17,
+0x00,0x15,0x70,0x7e,0x04,0x2b,0xfa,0x40,0xb6,0x04,0xd0,0x16,0xac,0xef,0xff,0xeb,
+0x95,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x01,0x00,0x98,0x25,0x9b,0xde,
+0xff,0xfe,0xdb,0x85,0x10,0x00,0x01,0x00,0x32,0x28,0xdf,0xff,0x01,0x00,0x17,0xc6,
+0x15,0x00,0x35,0x02,0xaf,0xff,0x01,0x00,0x15,0x80,0x16,0x00,0x27,0x08,0xff,0x01,
+0x00,0x14,0xe4,0x16,0x00,0x28,0x1c,0xff,0x01,0x00,0x13,0xf8,0x16,0x00,0x29,0x3e,
+0xff,0x01,0x00,0x1e,0xfa,0x16,0x00,0x06,0x17,0x00,0x1b,0x1e,0x16,0x00,0x02,0x45,
+0x00,0x2c,0x0c,0xff,0x01,0x00,0x1c,0xf3,0x84,0x00,0x02,0x01,0x00,0x5e,0xd0,0x00,
+0x00,0x02,0xff,0x01,0x00,0x44,0x60,0x00,0x00,0xbf,0xdb,0x00,0x33,0x31,0x12,0x5a,
+0x0b,0x00,0x42,0xfd,0x00,0x00,0x3f,0x0a,0x00,0x20,0xfe,0x40,0xe9,0x00,0x03,0x23,
+0x00,0x33,0xf4,0x00,0x0a,0x20,0x00,0x02,0x1e,0x01,0x03,0x00,0x01,0x23,0x90,0x01,
+0x37,0x00,0x12,0x20,0xc0,0x00,0x13,0xdf,0x44,0x00,0x12,0x6f,0x16,0x00,0x12,0x70,
+0x16,0x00,0x12,0x04,0x0e,0x00,0x22,0xf1,0x0b,0x08,0x00,0x13,0xf0,0x03,0x01,0x12,
+0x0d,0x0f,0x00,0x19,0x30,0x02,0x01,0x31,0x00,0x00,0x8f,0x0f,0x00,0x25,0xf6,0x2f,
+0xa6,0x00,0x01,0x01,0x00,0x12,0x05,0x0f,0x00,0x12,0x75,0x07,0x00,0x14,0xf2,0x2d,
+0x00,0x02,0xac,0x00,0x22,0xf7,0x8f,0x17,0x00,0x1a,0x00,0x01,0x00,0x15,0x0a,0x00,
+0x01,0x09,0x01,0x00,0x11,0xcf,0x16,0x00,0x1b,0xfc,0x16,0x00,0x03,0x8e,0x00,0x1b,
+0xb0,0x17,0x00,0x1a,0xdf,0x9d,0x00,0x03,0x01,0x00,0x12,0x0e,0x2d,0x00,0x1b,0xa0,
+0x17,0x00,0x1f,0xef,0x2d,0x00,0x19,0x0e,0x5a,0x00,0x0f,0x87,0x00,0x08,0x1e,0xbf,
+0xb4,0x00,0x0f,0xe1,0x00,0x07,0x0e,0x0e,0x01,0x07,0x42,0x01,0x1b,0xf2,0x17,0x00,
+0x03,0x68,0x01,0x13,0x50,0x0f,0x00,0x21,0x01,0x99,0x01,0x00,0x1b,0x40,0x95,0x01,
+0x12,0x4f,0x68,0x01,0x03,0x71,0x00,0x1a,0xe0,0xf1,0x02,0x2a,0x50,0x6f,0xac,0x01,
+0x12,0xdf,0x8e,0x02,0x13,0x01,0x48,0x02,0x03,0x50,0x03,0x03,0x25,0x00,0x04,0xb5,
+0x00,0x18,0xfc,0xc1,0x01,0x24,0xff,0xb0,0x09,0x00,0x27,0xfd,0x30,0x2c,0x00,0x16,
+0xf6,0xa3,0x02,0x64,0xb5,0x20,0x01,0x37,0xdf,0xff,0xd9,0x00,0x1e,0x03,0xd0,0x02,
+0x00,0x6d,0x02,0x1e,0x09,0x16,0x00,0x16,0xe0,0x54,0x01,0x07,0x01,0x00,0x10,0xf4,
+0x65,0x00,0x1e,0x2e,0x57,0x03,0x07,0x92,0x00,0x0f,0x9b,0x03,0x0c,0x04,0x1a,0x01,
+0x19,0x2d,0x16,0x00,0x1f,0xf7,0x0b,0x04,0x02,0x1f,0xd3,0x38,0x04,0x01,0x2f,0xfe,
+0x60,0x65,0x04,0x01,0x1a,0xb5,0x9d,0x01,0x01,0x92,0x04,0x3f,0xda,0x84,0x00,0x01,
+0x00,0x04,0x20,0x67,0x77,0x01,0x00,0x2f,0x76,0x00,0xe1,0x02,0x12,0x0f,0x17,0x00,
+0xff,0x9b,0x6b,0x48,0xbd,0xef,0xfe,0xca,0x61,0x17,0x00,0x22,0x02,0x8e,0x25,0x02,
+0x1a,0xa3,0x17,0x00,0x14,0x8f,0x53,0x02,0x18,0x90,0x17,0x00,0x06,0x99,0x02,0x26,
+0xfd,0x20,0x17,0x00,0x18,0x04,0x2f,0x06,0x06,0x17,0x00,0x17,0x4f,0x17,0x00,0x24,
+0xfe,0xef,0x17,0x00,0x0f,0x36,0x06,0x01,0x1e,0xfc,0x4f,0x03,0x03,0x17,0x00,0x1f,
+0x8f,0x17,0x00,0x02,0x0e,0x44,0x00,0x01,0x17,0x00,0x1f,0x0a,0x17,0x00,0x03,0x14,
+0x2f,0x84,0x00,0x46,0x94,0x31,0x24,0x7d,0x17,0x00,0x14,0x9f,0xe1,0x00,0x00,0xd9,
+0x00,0x15,0x5e,0x17,0x00,0x15,0xff,0x26,0x04,0x00,0xb9,0x04,0x13,0xdf,0x17,0x00,
+0x1a,0x04,0x98,0x07,0x13,0x1e,0x17,0x00,0x13,0x09,0x5a,0x00,0x0a,0x0e,0x05,0x28,
+0xfc,0x0d,0x44,0x00,0x05,0xbc,0x04,0x2a,0xfc,0x1f,0xab,0x06,0x04,0x59,0x01,0x1b,
+0x4f,0x9e,0x05,0x03,0x17,0x00,0x0b,0x00,0x05,0x04,0x17,0x00,0x13,0x9f,0xe1,0x06,
+0x0b,0x17,0x00,0x03,0x04,0x04,0x0c,0xfa,0x01,0x19,0xcf,0xa0,0x00,0x05,0x17,0x00,
+0x1b,0xdf,0x2f,0x02,0x09,0x17,0x00,0x1c,0xfb,0x17,0x00,0x1f,0xef,0x17,0x00,0x09,
+0x1f,0xfa,0x45,0x00,0x03,0x1f,0xfa,0x5c,0x00,0x14,0x1f,0xcf,0x17,0x00,0x03,0x0c,
+0x9b,0x06,0x0f,0xe6,0x00,0x0b,0x03,0x26,0x02,0x1b,0x10,0x17,0x00,0x12,0x5f,0x17,
+0x00,0x1b,0x40,0x17,0x00,0x17,0x3f,0xf8,0x01,0x07,0x17,0x00,0x1a,0x0f,0x87,0x06,
+0x04,0x17,0x00,0x17,0x0c,0xdd,0x05,0x07,0xcc,0x01,0x19,0x08,0x71,0x06,0x04,0x03,
+0x03,0x26,0xfc,0x03,0x08,0x09,0x08,0x28,0x02,0x28,0x00,0xef,0x46,0x00,0x24,0x01,
+0xcf,0x17,0x00,0x27,0x7f,0xff,0xd4,0x08,0x15,0x4e,0x84,0x02,0x14,0x1f,0x65,0x03,
+0x46,0x73,0x10,0x13,0x7c,0xb2,0x02,0x1f,0x09,0xe0,0x02,0x03,0x1f,0x01,0x17,0x00,
+0x03,0x05,0x5d,0x00,0x0b,0x17,0x00,0x1f,0x0c,0x17,0x00,0x03,0x28,0x01,0xef,0x11,
+0x00,0x05,0xaf,0x03,0x0a,0xd1,0x06,0x15,0x3f,0x17,0x00,0x17,0x03,0x2f,0x00,0x26,
+0xe3,0x0d,0x0c,0x01,0x17,0x1c,0x22,0x04,0x17,0x0b,0x23,0x01,0x16,0x7f,0x50,0x04,
+0x17,0x09,0x17,0x00,0x16,0x01,0x7e,0x04,0x19,0x08,0x51,0x01,0x10,0x38,0xac,0x04,
+0xb0,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x01,0x00,
+0x99,0x02,0x59,0xcd,0xef,0xff,0xec,0xa7,0x30,0x00,0x01,0x00,0x32,0x02,0x7d,0xff,
+0x01,0x00,0x28,0xfa,0x40,0x17,0x00,0x25,0x2a,0xff,0x01,0x00,0x17,0xc4,0x17,0x00,
+0x26,0x8f,0xff,0x01,0x00,0x25,0xfa,0x10,0x44,0x00,0x27,0xdf,0xff,0x01,0x00,0x14,
+0xfe,0x62,0x00,0x2a,0x04,0xff,0x01,0x00,0x03,0x61,0x00,0x2e,0x05,0xff,0x18,0x00,
+0x0d,0x2e,0x00,0x00,0x01,0x00,0x10,0x20,0x17,0x00,0x2c,0x01,0xef,0x17,0x00,0x11,
+0xfd,0x2f,0x00,0x1d,0xcf,0x2f,0x00,0x10,0xf8,0x17,0x00,0x2d,0x7f,0xff,0x01,0x00,
+0x53,0xf2,0x00,0x00,0x00,0x1f,0x0c,0x00,0x53,0xfb,0x62,0x11,0x25,0x9f,0x0c,0x00,
+0x43,0xa0,0x00,0x00,0x09,0x0b,0x00,0x10,0xd3,0x3b,0x00,0x13,0x19,0x0d,0x00,0x33,
+0x10,0x00,0x01,0x0a,0x00,0x11,0xc0,0x6a,0x00,0x12,0x07,0x0d,0x00,0x15,0xf7,0x5d,
+0x00,0x12,0xd1,0xc8,0x00,0x12,0x0a,0x0e,0x00,0x32,0xd0,0x00,0x0d,0x09,0x00,0x13,
+0xf3,0xf7,0x00,0x13,0x1f,0xbe,0x00,0x13,0x02,0x73,0x00,0x04,0x26,0x01,0x02,0x78,
+0x00,0x39,0xf6,0x00,0x7f,0x0e,0x01,0x04,0x0f,0x01,0x22,0xa0,0x0b,0x08,0x00,0x29,
+0xf0,0x00,0x47,0x00,0x23,0xfd,0x00,0x6d,0x01,0x05,0x83,0x01,0x03,0x27,0x00,0x03,
+0x66,0x00,0x14,0x70,0x17,0x00,0x12,0x0e,0x10,0x00,0x13,0x14,0x0c,0x01,0x14,0x44,
+0x01,0x00,0x12,0xef,0x9c,0x00,0x2f,0x6f,0xff,0x01,0x00,0x02,0x1f,0x47,0x17,0x00,
+0x03,0x2f,0xf5,0x8f,0x18,0x00,0x03,0x1f,0x69,0x17,0x00,0x03,0x2f,0xf6,0x9f,0x2f,
+0x00,0x32,0x1f,0x68,0x2f,0x00,0x04,0x0f,0x8d,0x00,0x04,0x1a,0x66,0x77,0x01,0x05,
+0x01,0x00,0x12,0x4f,0x18,0x00,0x1b,0x60,0x17,0x00,0x1c,0x01,0x49,0x01,0x0a,0x39,
+0x01,0x1c,0xf1,0x18,0x00,0x1b,0xaf,0x61,0x01,0x03,0x01,0x00,0x15,0x06,0x26,0x02,
+0x05,0x01,0x00,0x17,0x50,0xf6,0x01,0x16,0xfb,0x17,0x00,0x27,0x5f,0xb0,0x47,0x00,
+0x15,0xf9,0x17,0x00,0x8a,0x6f,0xff,0x90,0x00,0x00,0x00,0x03,0xff,0x8f,0x00,0x22,
+0x01,0xaf,0x6b,0x00,0x14,0x0c,0xe5,0x02,0x11,0x50,0x17,0x00,0x23,0x17,0xef,0xca,
+0x00,0x14,0x3f,0xf6,0x00,0x65,0xd8,0x42,0x00,0x01,0x36,0xbf,0x42,0x02,0x0f,0x4b,
+0x01,0x01,0x00,0x80,0x03,0x1e,0xdf,0x17,0x00,0x5d,0xfe,0x10,0x00,0x00,0x02,0x4e,
+0x03,0x02,0xe6,0x02,0x1e,0x03,0x17,0x00,0x2f,0xe1,0x00,0x18,0x00,0x02,0x12,0xd2,
+0xf2,0x03,0x0c,0x48,0x00,0x16,0xc1,0xc7,0x00,0x08,0x01,0x00,0x14,0x80,0xf6,0x00,
+0x18,0x5d,0x16,0x00,0x26,0xfc,0x40,0x4f,0x01,0x07,0xa9,0x00,0x18,0xc5,0x68,0x01,
+0x14,0x4a,0x62,0x00,0x1b,0xe9,0xb1,0x04,0x71,0x36,0x9b,0xde,0xff,0xfe,0xdb,0x96,
+0x1d,0x04,0x0c,0x01,0x00,0x19,0x10,0xda,0x04,0x74,0x6a,0xce,0xff,0xff,0xfd,0xb8,
+0x51,0x10,0x00,0x23,0x07,0xdf,0x50,0x02,0x04,0x10,0x00,0x29,0xef,0xff,0x11,0x00,
+0x25,0x01,0xcf,0xff,0x02,0x02,0x11,0x00,0x16,0x2e,0x10,0x03,0x0c,0xf5,0x00,0x02,
+0x11,0x00,0x2b,0x0d,0xff,0x11,0x00,0x1b,0x8f,0x11,0x00,0x17,0x02,0xf5,0x00,0x10,
+0xf4,0x11,0x00,0x1c,0x09,0x11,0x00,0x1c,0x0f,0x11,0x00,0x23,0x4f,0xff,0x31,0x02,
+0x47,0x41,0x00,0x12,0x41,0x54,0x00,0x15,0xfb,0xdc,0x00,0x18,0xbf,0x9d,0x04,0x00,
+0x01,0x00,0x03,0x97,0x00,0x06,0x28,0x01,0x08,0x28,0x05,0x07,0x11,0x00,0x1c,0xf9,
+0x0c,0x03,0x1f,0xf8,0x11,0x00,0x37,0x0b,0xf8,0x01,0x1f,0xf9,0x11,0x00,0x87,0x0e,
+0xff,0x00,0x0f,0x11,0x00,0xff,0xff,0x91,0x50,0x00,0x00,0x00,0x00,0x00,0x15,0x00,
+0x01,0x00,0x2e,0x10,0x00,0x01,0x00,0xc0,0x02,0x6a,0xdf,0xff,0xff,0xec,0x84,0x00,
+0x00,0x00,0x01,0x22,0x01,0x00,0x12,0x21,0x17,0x00,0x21,0x5c,0xff,0x01,0x00,0x51,
+0xfe,0x70,0x00,0x00,0xcf,0x0a,0x00,0x10,0x90,0x16,0x00,0x33,0x04,0xdf,0xff,0x01,
+0x00,0x31,0xe5,0x00,0x0e,0x08,0x00,0x10,0xf9,0x17,0x00,0x14,0x08,0x16,0x00,0x00,
+0x10,0x00,0x15,0xff,0x2f,0x00,0x26,0x0b,0xff,0x01,0x00,0x25,0xfa,0x2f,0x2f,0x00,
+0x27,0x0c,0xff,0x01,0x00,0x15,0xfc,0x2f,0x00,0x08,0x2e,0x00,0x06,0x4e,0x00,0x2e,
+0x00,0x07,0x17,0x00,0x00,0x2f,0x00,0x2f,0x03,0xff,0x2f,0x00,0x03,0x1f,0xcf,0x2f,
+0x00,0x03,0x1f,0x5f,0x2f,0x00,0x03,0x14,0x0d,0x0b,0x00,0x55,0xc6,0x31,0x01,0x36,
+0xcf,0x2f,0x00,0x23,0x05,0xff,0xfe,0x00,0x10,0x40,0xde,0x00,0x15,0x3d,0x2f,0x00,
+0x12,0xbf,0x09,0x00,0x12,0xfd,0x48,0x01,0x14,0x0b,0x2f,0x00,0x13,0x1f,0x2e,0x00,
+0x03,0x5f,0x01,0x13,0x0c,0x2f,0x00,0x13,0x06,0x20,0x00,0x13,0x40,0x6a,0x01,0x13,
+0x2f,0x2f,0x00,0x12,0xaf,0x08,0x00,0x14,0xc0,0x82,0x01,0x03,0x2f,0x00,0x12,0x0e,
+0x08,0x00,0x14,0xf4,0x17,0x00,0x12,0x0f,0x10,0x00,0x13,0x91,0x46,0x00,0x1b,0x00,
+0x2f,0x00,0x12,0x4f,0x08,0x00,0x1b,0xa0,0x2f,0x00,0x12,0x96,0x07,0x00,0x1c,0xf6,
+0x2f,0x00,0x12,0x8f,0x08,0x00,0x1b,0x30,0x2f,0x00,0x12,0x99,0x07,0x00,0x1c,0xf1,
+0x2f,0x00,0x1b,0xbf,0x75,0x00,0x03,0x2f,0x00,0x12,0x9b,0x07,0x00,0x1c,0xe0,0x2f,
+0x00,0x12,0xcf,0x18,0x01,0x0c,0x2f,0x00,0x1b,0x9c,0xea,0x00,0x0a,0x5e,0x00,0x1f,
+0xfc,0x5e,0x00,0x04,0x1c,0xd0,0x2f,0x00,0x12,0xaf,0x5f,0x01,0x1f,0x00,0xbc,0x00,
+0x03,0x1c,0xf0,0x2f,0x00,0x12,0x7f,0x08,0x00,0x1f,0x20,0x1a,0x01,0x03,0x1c,0xf5,
+0x2f,0x00,0x12,0x3f,0x08,0x00,0x1b,0x80,0x2f,0x00,0x13,0x90,0xd5,0x01,0x0c,0x2f,
+0x00,0x03,0x33,0x02,0x1c,0xf3,0x2f,0x00,0x12,0x9f,0x08,0x00,0x1b,0xb0,0x2f,0x00,
+0x1f,0x04,0x05,0x02,0x04,0x1f,0x0f,0x34,0x02,0x03,0x23,0x00,0xaf,0x17,0x03,0x0b,
+0x63,0x02,0x19,0x03,0x92,0x02,0x15,0x4d,0x92,0x02,0x17,0x0c,0xc1,0x02,0x26,0x37,
+0xcf,0xf0,0x02,0x1f,0x3f,0x1f,0x03,0x04,0x1f,0xaf,0x1f,0x03,0x03,0x2f,0x01,0xef,
+0x2f,0x00,0x03,0x1f,0x05,0x2f,0x00,0x03,0x08,0xf1,0x03,0x08,0x2f,0x00,0x2f,0x00,
+0x09,0x2f,0x00,0x03,0x09,0x30,0x00,0x16,0xf3,0x2f,0x00,0x08,0x60,0x00,0x14,0xe3,
+0x49,0x01,0x01,0x95,0x04,0x14,0xbf,0x17,0x00,0x14,0xa1,0x49,0x01,0x02,0x28,0x01,
+0x13,0x3a,0x4e,0x04,0x3a,0x30,0x00,0x1f,0xb7,0x01,0x92,0x59,0xbe,0xff,0xfe,0xc9,
+0x61,0x00,0x00,0x02,0x17,0x00,0x1c,0xf7,0xe7,0x04,0x03,0x01,0x04,0x1b,0x60,0x17,
+0x00,0x1b,0x09,0xce,0x01,0x04,0x01,0x00,0x16,0xef,0x00,0x03,0x26,0x03,0xd2,0x17,
+0x00,0x17,0x7f,0xd1,0x02,0x25,0xdf,0xe3,0x17,0x00,0x17,0x3f,0x75,0x00,0x16,0xaf,
+0x7c,0x03,0x26,0x2e,0xff,0x8a,0x02,0x59,0x6f,0xff,0xff,0xfc,0x30,0x8b,0x00,0x24,
+0xff,0xc0,0x0f,0x02,0x10,0xc6,0x21,0x00,0x36,0x16,0xdf,0xff,0x8c,0x00,0x03,0x65,
+0x02,0x35,0xec,0xaa,0xac,0x99,0x01,0x1f,0xfb,0x5f,0x01,0x04,0x1e,0x20,0xa6,0x01,
+0x04,0xe9,0x00,0x0e,0x05,0x02,0x02,0x5e,0x01,0x1f,0x4f,0x17,0x00,0x03,0x2c,0x00,
+0x3e,0x17,0x00,0x03,0x5d,0x01,0x1a,0x1b,0x16,0x00,0x14,0xfe,0xcc,0x02,0x29,0x05,
+0xdf,0x00,0x02,0x06,0x5e,0x06,0x17,0x5d,0x17,0x00,0x17,0xa2,0x56,0x01,0x24,0x03,
+0x9d,0x16,0x00,0x2a,0xb6,0x10,0x85,0x06,0x75,0x69,0xbd,0xef,0xff,0xed,0xb9,0x74,
+0x11,0x00,0x21,0x07,0x77,0x01,0x00,0x1b,0x30,0xac,0x06,0x0c,0xdd,0x04,0x09,0x54,
+0x03,0x1f,0x60,0x2d,0x00,0xff,0x9c,0x7b,0x02,0x6a,0xde,0xff,0xfd,0xb8,0x50,0x2d,
+0x00,0x15,0x5c,0xe1,0x03,0x07,0x2d,0x00,0x15,0x03,0xda,0x04,0x17,0x91,0x2d,0x00,
+0x07,0x1a,0x08,0x16,0xd2,0x2d,0x00,0x08,0x24,0x03,0x15,0xe2,0x2d,0x00,0x18,0x6a,
+0xaa,0x02,0x14,0xd0,0x2d,0x00,0x1b,0xfe,0x05,0x03,0x1f,0x2f,0xef,0x04,0x01,0x2f,
+0x30,0x02,0x16,0x00,0x01,0x1f,0xfa,0x2d,0x00,0x03,0x1f,0xf1,0x2d,0x00,0x02,0x35,
+0xff,0x70,0x2f,0x26,0x03,0x44,0x53,0x12,0x35,0x8e,0xd3,0x03,0x19,0x02,0x69,0x03,
+0x04,0x25,0x05,0x29,0xf0,0x2f,0x34,0x06,0x04,0x17,0x00,0x1a,0x22,0x4a,0x06,0x13,
+0x0d,0xcf,0x06,0x04,0x51,0x06,0x0a,0xa2,0x04,0x1a,0x72,0x95,0x01,0x03,0x69,0x00,
+0x1b,0xf8,0x95,0x01,0x13,0x0f,0xa3,0x03,0x0b,0xc2,0x01,0x18,0xef,0xb2,0x09,0x05,
+0x2d,0x00,0x03,0x71,0x00,0x1b,0xb2,0x2d,0x00,0x12,0xdf,0xcb,0x00,0x0f,0x2d,0x00,
+0xff,0xff,0xa8,0x10,0xb0,0xfa,0x0c,0x02,0x25,0x03,0x42,0x9d,0xff,0xfe,0xb4,0xab,
+0x07,0x00,0x17,0x00,0x13,0x06,0x77,0x07,0x13,0x1f,0xc3,0x03,0x13,0x7f,0xfc,0x0a,
+0x03,0x9b,0x08,0x23,0xf2,0xdf,0xb0,0x0b,0x13,0xdf,0xb7,0x07,0x13,0xbf,0x02,0x04,
+0x13,0x6f,0x65,0x04,0x03,0xd0,0x0b,0x23,0x50,0x04,0x30,0x04,0x24,0x00,0x4e,0xea,
+0x03,0x5f,0x6b,0xef,0xfd,0x92,0x00,0x01,0x00,0x16,0x21,0x01,0x11,0x01,0x00,0x05,
+0xf1,0x08,0x0f,0x08,0x00,0xff,0x79,0x50,0xff,0xff,0xff,0xff,0x80,0x11,0x00,0x01,
+0x00,0x63,0x02,0x8c,0xef,0xec,0x81,0x00,0x01,0x00,0x62,0x7f,0xff,0xff,0xff,0xff,
+0x60,0x0c,0x00,0x20,0x08,0xff,0x01,0x00,0x12,0xf7,0x0d,0x00,0x21,0x3f,0xff,0x01,
+0x00,0x11,0x20,0x0d,0x00,0x12,0xaf,0x0d,0x00,0x11,0x90,0x0d,0x00,0x12,0xff,0x01,
+0x00,0x10,0xe0,0x0c,0x00,0x13,0x01,0x0d,0x00,0x1d,0xf0,0x0d,0x00,0x09,0x27,0x00,
+0x22,0x00,0xbf,0x0d,0x00,0x11,0xa0,0x0d,0x00,0x12,0x4f,0x0d,0x00,0x11,0x30,0x0d,
+0x00,0x11,0x09,0x0c,0x00,0x13,0xf8,0x8f,0x00,0x10,0x8f,0x0d,0x00,0x13,0x70,0x0d,
+0x00,0x65,0x03,0xae,0xff,0xfe,0x92,0x00,0x01,0x00,0x2f,0x01,0x00,0x01,0x00,0x36,
+0x21,0x0c,0xcc,0x01,0x00,0x02,0xf8,0x00,0x12,0x0f,0x8f,0x00,0x1f,0x80,0x0d,0x00,
+0xff,0xff,0x98,0x18,0x1f,0x0d,0x00,0x36,0x2f,0xff,0xff,0x34,0x03,0x18,0x4f,0x0d,
+0x00,0x12,0x9f,0x0d,0x00,0x11,0x50,0xf4,0x03,0x17,0xff,0x74,0x03,0x13,0x2d,0x0d,
+0x00,0x53,0x00,0x47,0x54,0x33,0x5a,0x0c,0x00,0x12,0xfc,0x0a,0x04,0x13,0xff,0x03,
+0x04,0x07,0x0d,0x00,0x18,0xf1,0x0d,0x00,0x18,0xa0,0x0d,0x00,0x17,0x20,0x0d,0x00,
+0x27,0xf8,0x00,0x0d,0x00,0x17,0xb0,0x0d,0x00,0x27,0xfc,0x10,0x0d,0x00,0x26,0xb0,
+0x00,0x0d,0x00,0x26,0xe6,0x00,0x0d,0x00,0x20,0xd7,0x10,0x0d,0x00,0x72,0x16,0x9b,
+0xde,0xff,0xfe,0xca,0x72,0xa3,0x03,0x20,0x67,0x77,0x01,0x00,0x1d,0x75,0xbb,0x03,
+0x13,0xcf,0xaf,0x00,0x0f,0x18,0x00,0xff,0xd5,0x12,0x11,0x01,0x00,0x1b,0x10,0x18,
+0x00,0x13,0x2f,0x45,0x02,0x1a,0xf3,0x18,0x00,0x23,0x01,0xef,0x18,0x00,0x1a,0x40,
+0x18,0x00,0x13,0x0c,0x17,0x00,0x1b,0xf6,0x60,0x00,0x25,0xaf,0xff,0x4b,0x03,0x08,
+0x18,0x00,0x13,0x08,0x17,0x00,0x1b,0xfa,0x90,0x00,0x13,0x5f,0x18,0x00,0x1a,0xc0,
+0x18,0x00,0x13,0x03,0x17,0x00,0x2a,0xfe,0x10,0x18,0x00,0x13,0x2e,0x18,0x00,0x1b,
+0xf2,0xd8,0x00,0x15,0xdf,0xa5,0x00,0x09,0x18,0x00,0x16,0x0b,0xa5,0x00,0x09,0x18,
+0x00,0x16,0x9f,0xa5,0x00,0x08,0x18,0x00,0x17,0x06,0xa5,0x00,0x08,0x18,0x00,0x17,
+0x4f,0xa5,0x00,0x07,0x18,0x00,0x04,0x02,0x04,0x2a,0xfd,0x10,0x18,0x00,0x13,0x1e,
+0x18,0x00,0x1b,0xe2,0x80,0x01,0x18,0xcf,0x32,0x04,0x06,0x18,0x00,0x13,0x09,0x17,
+0x00,0x1b,0xf5,0xb0,0x01,0x04,0x1b,0x01,0x1a,0x70,0x18,0x00,0x1a,0xfd,0xa5,0x00,
+0x05,0x18,0x00,0x1a,0xff,0xa5,0x00,0x0c,0x18,0x00,0x2e,0xfd,0x10,0x18,0x00,0x08,
+0x27,0x08,0x0d,0x48,0x00,0x1f,0x20,0x60,0x00,0x1b,0x2e,0xff,0xf7,0x18,0x00,0x0b,
+0x49,0x00,0x0b,0x18,0x00,0x1f,0xc0,0x18,0x00,0x04,0x1e,0xf7,0x18,0x00,0x0e,0x38,
+0x01,0x08,0x01,0x00,0x1c,0xd0,0x18,0x00,0x1a,0xcf,0xdb,0x00,0x14,0xcf,0x32,0x01,
+0x1a,0x0b,0x49,0x00,0x14,0xcf,0x82,0x05,0x1a,0x02,0x49,0x00,0x15,0xcf,0x61,0x01,
+0x19,0x7f,0x49,0x00,0x15,0xcf,0x72,0x09,0x19,0x0d,0x49,0x00,0x03,0x98,0x01,0x07,
+0xb7,0x02,0x1c,0xd0,0x78,0x03,0x18,0x9f,0x49,0x00,0x07,0x18,0x00,0x18,0x0e,0x49,
+0x00,0x07,0x18,0x00,0x18,0x04,0x49,0x00,0x08,0x30,0x03,0x17,0xaf,0x49,0x00,0x08,
+0x18,0x00,0x17,0x1e,0x49,0x00,0x08,0x18,0x00,0x17,0x06,0x49,0x00,0x09,0xa8,0x03,
+0x16,0xbf,0x49,0x00,0x09,0x18,0x00,0x16,0x2f,0x49,0x00,0x09,0x18,0x00,0x16,0x07,
+0x49,0x00,0x0a,0x38,0x04,0x15,0xdf,0x49,0x00,0x0a,0x18,0x00,0x15,0x3f,0x49,0x00,
+0x0a,0x18,0x00,0x15,0x09,0x49,0x00,0x0b,0x98,0x04,0x14,0xef,0x49,0x00,0x0b,0x18,
+0x00,0x14,0x4f,0x49,0x00,0x0b,0x18,0x00,0x14,0x0a,0x49,0x00,0x21,0x07,0x77,0x01,
+0x00,0x13,0x31,0x40,0x00,0x03,0xcc,0x07,0x1f,0x81,0x0f,0x00,0xff,0xf6,0x50,0xff,
+0xff,0xff,0xff,0x80,0x20,0x01,0x11,0x01,0x00,0x10,0x00,0x01,0x00,0x73,0x48,0xbd,
+0xef,0xfe,0xda,0x72,0x00,0x01,0x00,0x70,0x16,0x9c,0xef,0xff,0xec,0xa7,0x30,0x0b,
+0x00,0x21,0x0c,0xff,0x01,0x00,0x42,0x00,0x00,0x00,0x3a,0x0a,0x00,0x21,0xfd,0x50,
+0x23,0x00,0x22,0x05,0xcf,0x0f,0x00,0x10,0xe7,0x0d,0x00,0x02,0x0c,0x00,0x53,0xf0,
+0x00,0x02,0xbf,0xff,0x01,0x00,0x10,0xc2,0x17,0x00,0x14,0x4d,0x0e,0x00,0x25,0xfe,
+0x50,0x49,0x00,0x35,0x10,0x06,0xff,0x01,0x00,0x56,0xf4,0x00,0x00,0x00,0x8f,0x0f,
+0x00,0x14,0x80,0x49,0x00,0x36,0xf2,0x09,0xff,0x01,0x00,0x58,0xf3,0x00,0x00,0xbf,
+0xff,0x25,0x00,0x03,0x49,0x00,0x27,0x39,0xff,0x01,0x00,0x19,0xe1,0x24,0x00,0x23,
+0xff,0x50,0x49,0x00,0x28,0xfc,0xff,0x01,0x00,0x29,0xa0,0xaf,0x0f,0x00,0x13,0x10,
+0x49,0x00,0x0a,0x01,0x00,0x19,0x9f,0x0e,0x00,0x13,0xf9,0x49,0x00,0x0f,0x01,0x00,
+0x0a,0x1e,0xf1,0x49,0x00,0x0e,0x01,0x00,0x1f,0x70,0x49,0x00,0x10,0x15,0xfc,0x49,
+0x00,0x57,0xfb,0x63,0x21,0x25,0x9e,0x87,0x00,0x34,0x52,0x12,0x36,0xe1,0x00,0x14,
+0xf0,0x49,0x00,0x10,0xb2,0x63,0x01,0x15,0x0a,0x24,0x00,0x10,0x91,0x0f,0x00,0x13,
+0x3e,0x0d,0x00,0x13,0x4c,0x08,0x00,0x11,0x90,0xac,0x01,0x15,0x0b,0x85,0x00,0x01,
+0x0f,0x00,0x12,0x2f,0x0d,0x00,0x23,0xf7,0xcf,0x17,0x01,0x18,0x00,0x16,0x00,0x03,
+0x33,0x00,0x04,0x98,0x01,0x14,0x9c,0x60,0x01,0x02,0x01,0x00,0x03,0x33,0x00,0x12,
+0xe0,0x0e,0x00,0x13,0x02,0xad,0x00,0x03,0x6d,0x01,0x03,0x24,0x00,0x13,0x08,0x5f,
+0x00,0x03,0x0f,0x00,0x12,0x0f,0x0f,0x00,0x12,0xcc,0x07,0x00,0x13,0xc0,0x16,0x00,
+0x12,0x6f,0x0f,0x00,0x19,0x30,0x58,0x00,0x1a,0xfd,0x49,0x00,0x15,0x05,0x01,0x02,
+0x08,0xc6,0x00,0x1a,0xec,0x49,0x00,0x1a,0x4f,0x49,0x00,0x12,0xbf,0x70,0x02,0x0a,
+0x49,0x00,0x1f,0x04,0x49,0x00,0xff,0x3d,0x1f,0x40,0x49,0x00,0x10,0x1f,0xf4,0x49,
+0x00,0xff,0xff,0xfc,0x02,0x6a,0x07,0x10,0x10,0x12,0x00,0x52,0x15,0x9b,0xef,0xff,
+0xed,0x5c,0x07,0x12,0x01,0x2c,0x00,0x43,0xb0,0x00,0x00,0x04,0xde,0x05,0x10,0xd6,
+0x17,0x00,0x14,0x1f,0x76,0x00,0x14,0x3c,0xb8,0x05,0x25,0xfd,0x40,0x2d,0x00,0x36,
+0xd0,0x00,0x7f,0x18,0x06,0x14,0x60,0x2d,0x00,0x28,0xfe,0x00,0xdc,0x06,0x14,0x60,
+0x2d,0x00,0x19,0xf0,0x16,0x07,0x13,0x30,0x2d,0x00,0x19,0xff,0x08,0x07,0x14,0xfd,
+0x2d,0x00,0x0a,0x01,0x00,0x14,0xf6,0x2d,0x00,0x0a,0x01,0x00,0x1e,0xd0,0x2d,0x00,
+0x01,0x5b,0x00,0x0f,0x2d,0x00,0x02,0x16,0xf9,0x2d,0x00,0x54,0xa6,0x32,0x12,0x48,
+0xef,0x44,0x00,0x04,0x2d,0x00,0x11,0xfa,0x11,0x01,0x04,0xd0,0x00,0x29,0x11,0xff,
+0x39,0x06,0x13,0x6f,0x91,0x04,0x03,0x2d,0x00,0x1a,0xf8,0x82,0x06,0x2f,0x61,0xff,
+0x2b,0x06,0x01,0x28,0xf8,0x1f,0xe8,0x06,0x05,0xd4,0x06,0x1a,0x91,0x92,0x06,0x13,
+0x00,0x7e,0x00,0x0b,0x2d,0x00,0x12,0x0e,0x0f,0x00,0x1b,0xa1,0x2d,0x00,0x12,0xdf,
+0xe4,0x06,0x0b,0x2d,0x00,0x12,0x0d,0x0f,0x00,0x1f,0xb1,0x2d,0x00,0xff,0xff,0xa3,
+0x50,0xff,0xff,0xff,0xff,0xfb,0x13,0x00,0x01,0x00,0x9a,0x03,0x69,0xcd,0xef,0xff,
+0xec,0xa7,0x40,0x00,0x01,0x00,0x32,0x04,0x9e,0xff,0x01,0x00,0x29,0xfb,0x50,0x18,
+0x00,0x25,0x4c,0xff,0x01,0x00,0x17,0xe7,0x17,0x00,0x36,0x02,0xcf,0xff,0x01,0x00,
+0x16,0xfd,0x4d,0x00,0x29,0x06,0xff,0x01,0x00,0x14,0x90,0x18,0x00,0x2a,0x0a,0xff,
+0x01,0x00,0x13,0xc1,0x18,0x00,0x2b,0x0b,0xff,0x01,0x00,0x1e,0xd1,0x30,0x00,0x08,
+0x19,0x00,0x2d,0x07,0xff,0x01,0x00,0x11,0xb0,0xbf,0x00,0x1e,0xff,0x01,0x00,0x10,
+0x70,0x19,0x00,0x2e,0xdf,0xff,0x01,0x00,0x54,0x20,0x00,0x00,0x00,0x7f,0xef,0x00,
+0x44,0x63,0x11,0x35,0xaf,0x0c,0x00,0x43,0x00,0x00,0x00,0x0e,0x0c,0x00,0x10,0xc2,
+0x3d,0x00,0x13,0x1b,0x0d,0x00,0x16,0xf3,0xd9,0x00,0x19,0xa0,0x87,0x00,0x15,0xb0,
+0x61,0x00,0x12,0xb0,0xb8,0x00,0x13,0x09,0x19,0x00,0x32,0x10,0x00,0x3f,0x09,0x00,
+0x13,0xe1,0xe9,0x00,0x12,0x0d,0x0f,0x00,0x34,0xf7,0x00,0x08,0x09,0x00,0x03,0x01,
+0x00,0x12,0x5f,0x10,0x00,0x34,0xc0,0x00,0xcf,0x3a,0x00,0x03,0x01,0x00,0x13,0xdf,
+0x10,0x00,0x19,0x1f,0x61,0x00,0x14,0x00,0x41,0x00,0x13,0xf5,0xf3,0x00,0x15,0xf6,
+0x7c,0x01,0x12,0x2f,0x11,0x00,0x13,0x80,0xdb,0x00,0x15,0x30,0x19,0x00,0x03,0xde,
+0x00,0x03,0x9c,0x00,0x15,0xf0,0x18,0x00,0x12,0x0c,0x11,0x00,0x21,0xd0,0xbf,0x07,
+0x00,0x16,0xfe,0xde,0x01,0x12,0x9f,0x11,0x00,0x14,0x0c,0x9b,0x00,0x0b,0x7b,0x00,
+0x25,0xf0,0xdf,0x2f,0x01,0x03,0x01,0x00,0x03,0x73,0x00,0x18,0x1e,0x24,0x01,0x07,
+0x0f,0x02,0x21,0xf1,0xef,0x07,0x00,0x16,0xfa,0x31,0x00,0x12,0x6f,0x19,0x00,0x1c,
+0x2e,0x31,0x00,0x13,0x07,0x31,0x00,0x0f,0x62,0x00,0x05,0x1f,0x1c,0x93,0x00,0x05,
+0x12,0xbf,0x8a,0x02,0x06,0x31,0x00,0x03,0xd5,0x01,0x0f,0xf5,0x00,0x06,0x16,0x7f,
+0x0c,0x02,0x09,0x26,0x01,0x13,0x04,0x5f,0x01,0x0d,0x57,0x01,0x1b,0x1f,0xac,0x00,
+0x14,0x06,0x29,0x00,0x03,0xa9,0x01,0x05,0x31,0x00,0x13,0xcf,0x5a,0x00,0x1b,0x09,
+0xa1,0x01,0x13,0x3f,0x7a,0x00,0x2a,0x00,0x4f,0x1b,0x02,0x03,0x04,0x03,0x49,0xf8,
+0x00,0x00,0xef,0x63,0x00,0x15,0x06,0xaf,0x02,0x23,0x08,0xff,0x84,0x00,0x01,0x18,
+0x00,0x25,0x05,0xff,0x05,0x01,0x13,0x1f,0x0b,0x00,0x18,0xb1,0x7c,0x02,0x53,0xf4,
+0x00,0x00,0x00,0x8f,0x0c,0x00,0x44,0xfa,0x52,0x00,0x14,0xda,0x03,0x35,0xfc,0x00,
+0x00,0x63,0x00,0x09,0x01,0x00,0x1e,0x30,0x41,0x03,0x06,0x6f,0x00,0x1e,0x08,0x18,
+0x00,0x1e,0xc0,0xbb,0x03,0x08,0xbc,0x03,0x0d,0x19,0x00,0x1e,0xe2,0xed,0x03,0x08,
+0x30,0x00,0x0d,0xd6,0x03,0x06,0x0f,0x02,0x18,0x03,0xbf,0x03,0x18,0xfe,0x9a,0x04,
+0x16,0x6d,0x18,0x00,0x29,0xe8,0x10,0xc9,0x04,0x05,0xce,0x03,0x1b,0x60,0xe3,0x04,
+0x9e,0x03,0x7a,0xce,0xef,0xff,0xec,0xa8,0x41,0x00,0x01,0x00,0x63,0x16,0xac,0xef,
+0xfe,0xdb,0x84,0x0d,0x00,0x20,0x8b,0xbb,0x01,0x00,0x42,0x80,0x00,0x00,0x3b,0x49,
+0x00,0x27,0xf9,0x30,0xd7,0x01,0x44,0xe0,0x00,0x1a,0xff,0x5c,0x01,0x16,0x10,0x17,
+0x00,0x26,0xf0,0x03,0x59,0x01,0x16,0xe4,0x17,0x00,0x27,0xf1,0x4f,0xc0,0x00,0x15,
+0x60,0x17,0x00,0x18,0xf6,0xee,0x00,0x16,0xf6,0x33,0x02,0x09,0x01,0x00,0x1f,0x40,
+0x17,0x00,0x03,0x1f,0xe1,0x17,0x00,0x03,0x1e,0xfa,0x17,0x00,0x03,0xdc,0x01,0x0f,
+0x17,0x00,0x02,0x16,0xc0,0x17,0x00,0x55,0xb7,0x42,0x13,0x59,0xff,0xe9,0x04,0x04,
+0x17,0x00,0x18,0xb2,0x52,0x02,0x14,0xf9,0x17,0x00,0x19,0xf9,0xbe,0x03,0x14,0xff,
+0x17,0x00,0x0b,0xfd,0x04,0x1b,0x40,0xcb,0x04,0x13,0xef,0x0d,0x06,0x16,0xcf,0x87,
+0x02,0x07,0x46,0x00,0x1b,0xd0,0x17,0x00,0x13,0x0f,0xb2,0x03,0x0b,0x17,0x00,0x13,
+0x0a,0xa2,0x00,0x0b,0x17,0x00,0x13,0x06,0x45,0x01,0x0b,0x17,0x00,0x13,0x02,0x54,
+0x03,0x0b,0x17,0x00,0x13,0x00,0xc7,0x00,0x0c,0x17,0x00,0x12,0xef,0x32,0x02,0x0c,
+0x17,0x00,0x03,0x10,0x00,0x0f,0x17,0x00,0x14,0x03,0x83,0x04,0x0f,0x17,0x00,0x14,
+0x1f,0xcf,0x17,0x00,0x1a,0x1e,0xdf,0x73,0x00,0x07,0xb4,0x04,0x0b,0x17,0x00,0x1f,
+0x01,0xe6,0x00,0x03,0x1e,0x03,0x14,0x01,0x07,0x7d,0x03,0x1b,0xf5,0x17,0x00,0x1e,
+0x0b,0x70,0x01,0x0e,0x9e,0x01,0x0c,0xcc,0x01,0x1b,0xc0,0xfa,0x01,0x13,0xdf,0x49,
+0x04,0x0a,0x28,0x02,0x14,0x07,0x9c,0x02,0x0a,0x56,0x02,0x13,0x4f,0xe7,0x03,0x0a,
+0x84,0x02,0x04,0x2d,0x00,0x16,0xf8,0xb2,0x02,0x44,0xa5,0x20,0x01,0x37,0x19,0x04,
+0x1f,0xf1,0xe0,0x02,0x03,0x1f,0x90,0x17,0x00,0x03,0x1f,0x10,0x17,0x00,0x02,0x1f,
+0xf7,0x3c,0x03,0x03,0x1f,0xc0,0x17,0x00,0x02,0x2f,0xfe,0x10,0x17,0x00,0x02,0x16,
+0xf3,0x18,0x02,0x1b,0x6f,0x5b,0x05,0x03,0x17,0x00,0x16,0x05,0x16,0x00,0x17,0xd2,
+0x46,0x02,0x35,0x00,0x2c,0xff,0xe2,0x00,0x08,0x17,0x00,0x29,0x00,0x4c,0xde,0x04,
+0x06,0x70,0x01,0x18,0x26,0xac,0x04,0x0c,0x11,0x02,0x0f,0x17,0x00,0xff,0x8e,0x50,
+0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x01,0x00,0x7a,0x48,0xbd,0xef,0xfe,0xda,0x62,
+0x00,0x01,0x00,0x31,0x02,0x9e,0xff,0x01,0x00,0x50,0xb4,0x00,0x00,0x01,0xbb,0x01,
+0x00,0x11,0xb8,0x17,0x00,0x23,0x9f,0xff,0x01,0x00,0x31,0xb1,0x00,0x05,0x08,0x00,
+0x10,0xfc,0x16,0x00,0x24,0x3d,0xff,0x01,0x00,0x35,0xfe,0x40,0x07,0x17,0x00,0x26,
+0x05,0xff,0x01,0x00,0x25,0xf4,0x0a,0x17,0x00,0x27,0x5f,0xff,0x01,0x00,0x14,0x3d,
+0x17,0x00,0x28,0x03,0xff,0x01,0x00,0x14,0xef,0x17,0x00,0x2e,0x0e,0xff,0x01,0x00,
+0x17,0xfc,0x87,0x00,0x09,0x17,0x00,0x0a,0x44,0x00,0x05,0x17,0x00,0x1f,0x0b,0x17,
+0x00,0x03,0x14,0x3f,0xb3,0x00,0x46,0x94,0x21,0x13,0x6b,0x17,0x00,0x13,0xaf,0x0a,
+0x00,0x10,0x90,0xd9,0x00,0x15,0x2b,0x17,0x00,0x03,0x09,0x00,0x28,0xf6,0x00,0x07,
+0x01,0x14,0xfc,0xe3,0x00,0x12,0x80,0x17,0x00,0x13,0x0b,0x17,0x00,0x12,0x0a,0x08,
+0x00,0x13,0xfd,0x4c,0x01,0x13,0x01,0x17,0x00,0x03,0xcd,0x00,0x14,0xf5,0x64,0x01,
+0x12,0xcf,0x17,0x00,0x12,0x1f,0x17,0x00,0x1b,0xe0,0x17,0x00,0x17,0x4f,0x88,0x00,
+0x07,0x17,0x00,0x12,0x7f,0x17,0x00,0x1b,0x50,0x17,0x00,0x03,0x92,0x00,0x1b,0x20,
+0x17,0x00,0x03,0xce,0x00,0x1b,0x00,0x17,0x00,0x19,0xcf,0xa0,0x00,0x05,0x17,0x00,
+0x16,0xdf,0xd3,0x01,0x0e,0x17,0x00,0x1c,0xfb,0x17,0x00,0x02,0xa5,0x01,0x1f,0xfa,
+0x17,0x00,0x14,0x1e,0xdf,0x17,0x00,0x0e,0x5c,0x00,0x0b,0xa1,0x00,0x0d,0x8a,0x00,
+0x1e,0xbf,0xb8,0x00,0x07,0xfd,0x00,0x0c,0x17,0x00,0x12,0x8f,0x17,0x00,0x1b,0x10,
+0x17,0x00,0x03,0x81,0x02,0x1b,0x40,0x17,0x00,0x1f,0x3f,0x70,0x01,0x03,0x1f,0x0f,
+0x9e,0x01,0x03,0x13,0x0c,0xd8,0x02,0x0b,0x17,0x00,0x1a,0x08,0xfa,0x01,0x13,0x02,
+0xfa,0x01,0x04,0x9a,0x02,0x1a,0x70,0x28,0x02,0x29,0x00,0xef,0x46,0x00,0x14,0xaf,
+0x17,0x00,0x18,0x8f,0x2f,0x00,0x15,0x2c,0x84,0x02,0x23,0x1f,0xff,0x5e,0x00,0x46,
+0x73,0x10,0x02,0x5b,0xb2,0x02,0x1f,0x09,0xe0,0x02,0x03,0x03,0x76,0x02,0x0d,0x3c,
+0x03,0x1f,0x7f,0x17,0x00,0x03,0x1f,0x0c,0x17,0x00,0x03,0x2f,0x01,0xef,0x17,0x00,
+0x02,0x05,0x3e,0x03,0x0b,0x17,0x00,0x17,0x03,0x2f,0x00,0x17,0xf6,0xc5,0x01,0x16,
+0x2c,0x17,0x00,0x18,0x50,0xdc,0x01,0x14,0x8f,0x16,0x00,0x28,0xc2,0x00,0x17,0x00,
+0x22,0x01,0x8e,0x16,0x00,0x3a,0xc5,0x00,0x00,0x0a,0x02,0x14,0x38,0xac,0x04,0x0c,
+0x21,0x02,0x0a,0x87,0x01,0x0f,0x17,0x00,0xff,0x8c,0x20,0x01,0x11,0x01,0x00,0x00,
+0x97,0x03,0x54,0x49,0xce,0xff,0xdb,0x6c,0xbd,0x03,0x20,0x05,0xef,0x8e,0x05,0x02,
+0x24,0x00,0x31,0xf1,0x00,0x1b,0x08,0x00,0x13,0xdc,0xd7,0x04,0x12,0x1d,0xf9,0x02,
+0x02,0x1d,0x00,0x38,0xf3,0x0c,0xff,0x1d,0x00,0x28,0x49,0xff,0x1d,0x00,0x13,0xf9,
+0x51,0x02,0x1a,0xcc,0x9c,0x02,0x19,0xcf,0x0f,0x00,0x0f,0x1d,0x00,0x0a,0x19,0xbc,
+0x0e,0x00,0x1f,0xfb,0x1d,0x00,0x05,0x54,0xea,0x86,0x66,0x67,0x97,0x1d,0x00,0x46,
+0xfa,0x30,0x00,0x00,0x44,0x03,0x18,0xe4,0xef,0x00,0x22,0xff,0xf2,0x0e,0x00,0x1a,
+0x0c,0xfe,0x05,0x0a,0x83,0x05,0x03,0x1d,0x00,0x1e,0xc0,0x40,0x01,0x0f,0x1d,0x00,
+0xff,0xb3,0x04,0x0f,0x06,0x79,0x69,0xbd,0xef,0xff,0xed,0xca,0x74,0x15,0x00,0x24,
+0x39,0xef,0x6a,0x02,0x16,0x60,0x15,0x00,0x26,0x3b,0xff,0x53,0x09,0x14,0x81,0x15,
+0x00,0x18,0x1a,0x89,0x02,0x13,0xfe,0x2e,0x00,0x08,0x72,0x05,0x06,0x4a,0x07,0x1b,
+0x4f,0x9c,0x05,0x11,0xd1,0x2b,0x00,0x0c,0xb2,0x05,0x10,0xfd,0x84,0x03,0x1d,0x1e,
+0xc9,0x05,0x00,0xb6,0x00,0x1d,0xbf,0x16,0x00,0x44,0xf7,0x00,0x00,0x04,0x0c,0x00,
+0x25,0xec,0xbc,0x76,0x00,0x14,0x10,0xce,0x06,0x65,0xfe,0x71,0x00,0x00,0x01,0x7e,
+0x11,0x09,0x17,0x1f,0x79,0x00,0x24,0x01,0xdf,0x45,0x07,0x18,0x6f,0x93,0x07,0x03,
+0x7a,0x00,0x13,0xf3,0x4f,0x09,0x12,0xf9,0xbb,0x00,0x14,0x07,0x6a,0x09,0x18,0xbf,
+0x30,0x03,0x23,0x01,0xff,0x24,0x00,0x19,0xcf,0x78,0x07,0x04,0x6d,0x08,0x14,0xcf,
+0xa3,0x00,0x01,0x01,0x00,0x20,0x67,0x77,0x01,0x00,0x13,0x75,0x51,0x07,0x2a,0xfe,
+0x10,0x86,0x01,0x03,0x74,0x06,0x1a,0xc1,0x16,0x00,0x16,0x4f,0xc6,0x00,0x07,0x01,
+0x00,0x05,0x80,0x0a,0x27,0xb6,0x20,0x16,0x00,0x16,0x08,0x86,0x01,0x15,0xb7,0x47,
+0x08,0x0a,0x2b,0x07,0x2b,0xc8,0x30,0x59,0x00,0x03,0x30,0x00,0x13,0x93,0x16,0x00,
+0x1a,0x06,0x5d,0x01,0x13,0xc5,0x17,0x00,0x1a,0x6f,0x17,0x00,0x12,0xc3,0x16,0x00,
+0x1b,0x04,0x85,0x07,0x03,0x47,0x08,0x0b,0xf9,0x07,0x04,0x5c,0x09,0x1a,0x29,0x17,
+0x00,0x13,0xa0,0x17,0x00,0x2b,0x17,0xdf,0xce,0x01,0x03,0x94,0x02,0x18,0x7b,0x17,
+0x00,0x06,0xe6,0x00,0x26,0x03,0x7b,0x75,0x00,0x17,0x90,0xfc,0x00,0x24,0x03,0x7d,
+0x16,0x00,0x19,0xf1,0x2a,0x01,0x2b,0x3a,0xff,0xde,0x0a,0x02,0x01,0x00,0x12,0x3e,
+0x16,0x00,0x30,0xf8,0x13,0x33,0x01,0x00,0x1a,0x31,0x18,0x09,0x22,0xfb,0x5f,0x1d,
+0x00,0x04,0x2d,0x00,0x18,0x9f,0x8a,0x09,0x29,0xfb,0x00,0x14,0x01,0x2a,0xfd,0x1f,
+0xce,0x09,0x12,0x6f,0x2c,0x00,0x19,0x0d,0x81,0x0b,0x03,0x42,0x00,0x29,0xfa,0x09,
+0x58,0x09,0x13,0x02,0xf3,0x00,0x13,0x02,0xa3,0x00,0x02,0x3a,0x03,0x14,0x1d,0x7e,
+0x02,0x13,0xbf,0x06,0x06,0x53,0x51,0x00,0x00,0x00,0x28,0x23,0x00,0x34,0xd0,0x00,
+0x2f,0xe7,0x00,0x45,0xdc,0xbb,0xce,0xff,0x39,0x00,0x1e,0x07,0xf7,0x08,0x1e,0xfd,
+0x2e,0x03,0x01,0x57,0x00,0x0e,0x53,0x09,0x03,0xb6,0x0b,0x0c,0x2d,0x00,0x1b,0xf5,
+0x54,0x02,0x02,0x29,0x02,0x03,0x40,0x02,0x19,0x3c,0x16,0x00,0x05,0x89,0x01,0x17,
+0x5d,0x15,0x00,0x2e,0xa2,0x00,0x4c,0x04,0x2d,0xfc,0x71,0x78,0x04,0xa0,0xfd,0xca,
+0x74,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x00,0x00,0x01,0x88,0x01,0x00,
+0x23,0x83,0x00,0x01,0x00,0x21,0x2f,0xff,0x01,0x00,0x13,0x60,0x0f,0x00,0x12,0x02,
+0x0f,0x00,0x1f,0xf6,0x1f,0x00,0x8c,0x29,0x08,0xff,0x01,0x00,0x2a,0xf1,0x8f,0x10,
+0x00,0x1f,0x18,0x1f,0x00,0x68,0x1f,0x10,0x55,0x01,0xa6,0x0f,0x1f,0x00,0xd1,0x13,
+0x70,0x0f,0x00,0x12,0x01,0x0f,0x00,0x14,0xf9,0x1f,0x00,0x12,0x0f,0x10,0x00,0x14,
+0xe0,0x10,0x00,0x03,0xcd,0x01,0x13,0x80,0x0f,0x00,0x13,0x0d,0x10,0x00,0x40,0xc6,
+0x43,0x44,0x64,0x10,0x00,0x16,0xbf,0xf0,0x01,0x56,0x90,0x00,0x00,0x00,0x07,0x0f,
+0x00,0x01,0x52,0x00,0x1a,0x3f,0x1f,0x00,0x2a,0x00,0xcf,0x1f,0x00,0x1b,0x05,0x1f,
+0x00,0x1a,0x0c,0x1f,0x00,0x2a,0x00,0x1e,0x1f,0x00,0x2a,0x00,0x3e,0x1f,0x00,0x2a,
+0x00,0x1c,0x1f,0x00,0x23,0x00,0x05,0x60,0x00,0x14,0xf8,0xbe,0x00,0x7c,0x26,0xac,
+0xef,0xff,0xed,0xb8,0x51,0x14,0x01,0x12,0x0e,0x0f,0x00,0x1b,0xb2,0x1b,0x01,0x11,
+0xef,0x0f,0x00,0x1f,0xfb,0x2d,0x00,0xff,0xff,0xa8,0x12,0xb1,0x07,0x00,0x1b,0xf7,
+0x2d,0x00,0x1a,0x1f,0xc3,0x03,0x03,0x2d,0x00,0x12,0xb0,0x07,0x00,0x1b,0xfa,0x2d,
+0x00,0x0b,0x00,0x04,0x13,0x2f,0x2d,0x00,0x12,0xdf,0x08,0x00,0x37,0x40,0x00,0x00,
+0xa8,0x03,0x22,0xfb,0x0a,0x08,0x00,0x12,0xfd,0x16,0x00,0x23,0x0b,0xff,0x2d,0x00,
+0x12,0x7f,0x08,0x00,0x20,0xfc,0x10,0x16,0x00,0x23,0x4d,0xff,0x2d,0x00,0x14,0x03,
+0xad,0x03,0x64,0x84,0x10,0x12,0x48,0xdf,0xff,0x2d,0x00,0x1a,0x0f,0x36,0x06,0x03,
+0x2d,0x00,0x2f,0x00,0x9f,0x17,0x00,0x01,0x2f,0xb0,0x03,0x2d,0x00,0x03,0x1f,0x0b,
+0x2d,0x00,0x02,0x04,0xbd,0x00,0x0b,0x2d,0x00,0x28,0x00,0x6f,0x10,0x00,0x14,0xe7,
+0x2d,0x00,0x18,0x00,0xbf,0x06,0x24,0xe2,0x4f,0x2d,0x00,0x26,0x00,0x7f,0x16,0x00,
+0x25,0xc1,0x03,0x2d,0x00,0x25,0x00,0x3d,0x16,0x00,0x35,0x70,0x00,0x2f,0x2d,0x00,
+0x33,0x00,0x06,0xcf,0x57,0x00,0x14,0x10,0x5a,0x05,0x16,0xb0,0x89,0x04,0x20,0xa7,
+0x30,0x71,0x05,0x10,0x11,0x01,0x00,0x2b,0x10,0x3f,0x68,0x05,0x13,0x08,0xd9,0x04,
+0x03,0x9e,0x01,0x39,0xf2,0x00,0x00,0x6b,0x01,0x2b,0xf4,0x08,0xdc,0x01,0x13,0x1f,
+0x40,0x00,0x15,0x03,0xd7,0x00,0x02,0x01,0x00,0x14,0x5f,0x11,0x05,0x12,0xef,0x09,
+0x00,0x04,0x18,0x00,0x14,0xaf,0xc1,0x01,0x19,0x8f,0xca,0x01,0x03,0x27,0x00,0x15,
+0xfe,0xab,0x05,0x19,0x80,0x36,0x06,0x15,0xf9,0xf2,0x05,0x12,0xd0,0x18,0x00,0x03,
+0xe1,0x05,0x15,0xf3,0xb1,0x00,0x18,0xf1,0xfc,0x01,0x00,0xcf,0x00,0x03,0x91,0x00,
+0x19,0xf5,0x4f,0x06,0x00,0xa0,0x05,0x18,0xdf,0x70,0x02,0x12,0x4f,0x18,0x00,0x00,
+0x11,0x01,0x14,0x8f,0x82,0x00,0x1a,0x00,0x0d,0x00,0x16,0x3f,0x23,0x00,0x04,0x3d,
+0x00,0x17,0xf9,0x83,0x06,0x17,0x70,0xbe,0x06,0x17,0xf3,0x42,0x01,0x17,0xb0,0x59,
+0x06,0x01,0x5e,0x01,0x03,0x91,0x00,0x10,0xf0,0x0c,0x00,0x18,0x0a,0x2f,0x06,0x12,
+0xdf,0x5a,0x01,0x07,0x14,0x03,0x17,0x30,0x84,0x00,0x16,0xf8,0xff,0x02,0x03,0x9c,
+0x00,0x16,0x3f,0xed,0x02,0x18,0x7f,0x67,0x06,0x16,0x0d,0xf0,0x08,0x16,0xbf,0x8f,
+0x00,0x05,0x91,0x00,0x15,0x60,0x46,0x07,0x19,0xe0,0x5c,0x01,0x4a,0xa0,0x00,0x00,
+0x04,0x9a,0x03,0x14,0xdf,0x26,0x00,0x18,0x08,0x8f,0x00,0x04,0x91,0x00,0x14,0xf3,
+0x6a,0x00,0x1a,0xfe,0xcb,0x07,0x14,0xf7,0x0d,0x02,0x05,0xf6,0x06,0x1a,0x0d,0xea,
+0x02,0x1b,0xf3,0x64,0x02,0x04,0x0d,0x02,0x2a,0xd0,0x00,0x23,0x08,0x39,0x40,0x00,
+0xef,0x8f,0x00,0x04,0x91,0x00,0x2a,0x90,0x03,0x8f,0x00,0x04,0xff,0x00,0x28,0xd0,
+0x07,0xfe,0x03,0x06,0x91,0x00,0x2a,0xf1,0x0b,0x8f,0x00,0x04,0x91,0x00,0x2a,0xf6,
+0x0f,0x8f,0x00,0x04,0x4e,0x02,0x2a,0xfa,0x4f,0x8f,0x00,0x04,0x91,0x00,0x2b,0xfe,
+0x9f,0x8f,0x00,0x04,0x91,0x00,0x0c,0x8f,0x00,0x09,0xa5,0x03,0x07,0x8f,0x00,0x05,
+0xbf,0x04,0x0b,0x8f,0x00,0x06,0xc7,0x08,0x08,0x6a,0x03,0x07,0xdf,0x02,0x0b,0x8f,
+0x00,0x05,0x22,0x01,0x0c,0x8f,0x00,0x08,0xd1,0x08,0x19,0x20,0x18,0x00,0x1e,0x7f,
+0x8f,0x00,0x0a,0x91,0x00,0x1a,0xf8,0x18,0x00,0x1e,0x0c,0x8f,0x00,0x0a,0x91,0x00,
+0x1a,0xd0,0x18,0x00,0x1e,0x02,0x8f,0x00,0x0a,0x91,0x00,0x1b,0x20,0x18,0x00,0x1e,
+0x7f,0x8f,0x00,0x08,0x48,0x04,0x1c,0xf7,0x18,0x00,0x1e,0x0c,0x8f,0x00,0x08,0x91,
+0x00,0x90,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x9f,0xff,0x01,0x00,
+0x22,0xf7,0x00,0x01,0x00,0x10,0x0d,0x0d,0x00,0x13,0xf3,0x0d,0x00,0x11,0x2f,0x1b,
+0x00,0x31,0xfe,0x04,0xff,0x01,0x00,0x12,0xb0,0x15,0x00,0x11,0x02,0x0d,0x00,0x12,
+0x80,0x0d,0x00,0x12,0x05,0x1b,0x00,0x22,0xa0,0x1f,0x2a,0x00,0x03,0x38,0x00,0x10,
+0x6f,0x0d,0x00,0x13,0xfc,0x0d,0x00,0x11,0x8f,0x1b,0x00,0x31,0xf6,0x00,0xcf,0x08,
+0x00,0x12,0xf1,0x15,0x00,0x18,0x0b,0x0d,0x00,0x12,0x0c,0x45,0x00,0x22,0x20,0x08,
+0x08,0x00,0x12,0x40,0x16,0x00,0x02,0x0d,0x00,0x18,0x50,0x0d,0x00,0x31,0xe0,0x00,
+0x4f,0x08,0x00,0x12,0xf8,0x15,0x00,0x02,0x0d,0x00,0x17,0xfa,0xac,0x00,0x00,0x0d,
+0x00,0x08,0xad,0x00,0x14,0x09,0x38,0x00,0x07,0xac,0x00,0x38,0x60,0x00,0x0c,0xad,
+0x00,0x12,0xdf,0x16,0x00,0x11,0x30,0x0d,0x00,0x02,0x0c,0x01,0x14,0xf2,0xb5,0x00,
+0x17,0xf1,0x5a,0x00,0x03,0x22,0x01,0x05,0x3c,0x00,0x17,0x04,0xa0,0x00,0x22,0x07,
+0xff,0x01,0x00,0x17,0xc0,0xac,0x00,0x47,0xa0,0x00,0x00,0x0f,0xad,0x00,0x13,0xbf,
+0x23,0x00,0x16,0x10,0x52,0x00,0x56,0xf6,0x00,0x00,0x00,0xcf,0xad,0x00,0x13,0x0f,
+0x22,0x00,0x10,0xf5,0x0d,0x00,0x13,0x06,0x13,0x01,0x36,0x00,0x00,0x08,0xad,0x00,
+0x03,0x73,0x00,0x01,0x5c,0x00,0x04,0xac,0x00,0x15,0xd0,0x08,0x01,0x16,0xf2,0x15,
+0x00,0x03,0x30,0x00,0x02,0xac,0x00,0x1a,0xf9,0x4d,0x01,0x14,0x0d,0x45,0x00,0x1a,
+0xf3,0x18,0x00,0x15,0x0c,0xad,0x00,0x24,0x02,0xff,0x01,0x00,0x56,0x70,0x00,0x00,
+0x00,0x3f,0x0a,0x01,0x15,0x8f,0xe5,0x00,0x14,0x7f,0x22,0x00,0x15,0xfc,0xac,0x00,
+0x17,0xfd,0xa2,0x00,0x05,0xe1,0x01,0x04,0x3b,0x00,0x02,0x97,0x00,0x16,0x90,0xe7,
+0x00,0x15,0xf2,0x7c,0x00,0x03,0x80,0x00,0x16,0x0d,0xfc,0x00,0x03,0x2c,0x01,0x13,
+0x50,0xd9,0x00,0x14,0xfb,0xc5,0x00,0x07,0x41,0x01,0x14,0x07,0xda,0x00,0x11,0x09,
+0xf5,0x01,0x13,0x5f,0xe5,0x01,0x15,0x3f,0x13,0x01,0x04,0x0c,0x00,0x13,0xc0,0xe1,
+0x01,0x13,0x61,0x4f,0x01,0x16,0x06,0x13,0x01,0x04,0x51,0x00,0x03,0x8f,0x01,0x23,
+0xf1,0x0c,0xe5,0x01,0x17,0xaf,0x78,0x02,0x13,0x0b,0xad,0x00,0x12,0x07,0xec,0x00,
+0x12,0x7f,0x53,0x00,0x18,0x0d,0xbd,0x02,0x13,0x7f,0x55,0x02,0x11,0xbf,0x31,0x01,
+0x13,0x02,0x53,0x00,0x06,0x13,0x01,0x33,0x00,0x00,0x03,0x74,0x00,0x12,0x0f,0x4c,
+0x00,0x12,0x0d,0xe9,0x00,0x16,0x4f,0x13,0x01,0x04,0x15,0x01,0x23,0xc0,0x04,0xbb,
+0x01,0x11,0x9f,0x1b,0x00,0x17,0x07,0x13,0x01,0x04,0x15,0x01,0x03,0x1b,0x00,0x13,
+0x00,0x2a,0x00,0x16,0xaf,0x13,0x01,0x04,0x15,0x01,0x20,0xf3,0x0e,0x06,0x00,0x23,
+0xf4,0x00,0x6f,0x00,0x17,0x0d,0x13,0x01,0x04,0x15,0x01,0x14,0x62,0xa5,0x01,0x01,
+0x3f,0x00,0x18,0x71,0x53,0x03,0x03,0xba,0x00,0x23,0xf9,0x7f,0x67,0x02,0x11,0x06,
+0x82,0x01,0x18,0x4f,0x98,0x03,0x03,0x15,0x01,0x14,0xcb,0xc3,0x02,0x11,0x1f,0x3f,
+0x00,0x08,0x13,0x01,0x07,0x20,0x02,0x02,0x9d,0x00,0x01,0xe6,0x02,0x18,0xef,0x15,
+0x04,0x03,0x15,0x01,0x05,0x51,0x02,0x16,0x07,0x0f,0x00,0x14,0x80,0x23,0x00,0x15,
+0x0e,0x13,0x00,0x17,0xf7,0x87,0x03,0x02,0xdd,0x00,0x03,0x01,0x00,0x15,0xaf,0x14,
+0x00,0x10,0x20,0x0f,0x00,0x15,0xef,0x0f,0x00,0x05,0x22,0x00,0x15,0x06,0x13,0x00,
+0x17,0xe0,0x11,0x04,0x05,0xac,0x03,0x09,0x59,0x00,0x17,0xf9,0x56,0x04,0x08,0x13,
+0x01,0x07,0x59,0x00,0x17,0x40,0x39,0x02,0x07,0x13,0x01,0x34,0x00,0x00,0x0a,0x13,
+0x00,0x1e,0xf0,0x0f,0x00,0x08,0x16,0x05,0x00,0x4f,0x01,0x0a,0x0f,0x00,0x05,0x13,
+0x01,0x07,0x7a,0x03,0x11,0x60,0x0f,0x00,0x1d,0x01,0x13,0x01,0x06,0x15,0x01,0x0a,
+0x3b,0x05,0x07,0x13,0x01,0x05,0x15,0x01,0x1b,0xfc,0x8c,0x01,0x2d,0x00,0x00,0x15,
+0x01,0x1a,0x70,0x77,0x00,0x06,0x13,0x01,0x05,0x15,0x01,0x1a,0xf3,0x77,0x00,0x07,
+0x13,0x01,0x04,0x15,0x01,0x14,0xfe,0x0f,0x00,0x18,0x9f,0x49,0x05,0x09,0x15,0x01,
+0x13,0x90,0x0f,0x00,0x1d,0x04,0x13,0x01,0x04,0x06,0x01,0x05,0xbf,0x00,0x18,0x0f,
+0x22,0x01,0x09,0x9e,0x00,0x0b,0xdf,0x00,0x03,0xbb,0x00,0x08,0x9e,0x00,0x1a,0xb0,
+0xdf,0x00,0x14,0xf3,0x0f,0x00,0x12,0x11,0x01,0x00,0x1a,0x00,0x10,0x00,0x38,0x10,
+0x00,0x1f,0xd8,0x05,0x06,0x5e,0x05,0x39,0x30,0x00,0x7f,0x63,0x01,0x04,0x22,0x06,
+0x15,0xa0,0x0a,0x00,0x19,0x90,0xc1,0x01,0x16,0xf1,0x3b,0x00,0x18,0x20,0x2c,0x01,
+0x16,0xf7,0x06,0x05,0x02,0xa3,0x06,0x03,0xdf,0x06,0x1c,0xfd,0x5f,0x01,0x27,0x01,
+0xff,0x4b,0x06,0x17,0x9f,0x8b,0x01,0x17,0xaf,0xcb,0x06,0x26,0x01,0xef,0x72,0x02,
+0x26,0x3f,0xff,0xf1,0x05,0x26,0x00,0x06,0x56,0x00,0x18,0x0b,0xc7,0x02,0x04,0xe9,
+0x05,0x15,0xf6,0x9f,0x00,0x28,0xfe,0x10,0x37,0x07,0x00,0x10,0x03,0x18,0xdf,0x6e,
+0x02,0x05,0xa4,0x06,0x14,0x70,0xda,0x00,0x1b,0xd0,0x97,0x02,0x2b,0x10,0x0e,0x6d,
+0x02,0x13,0x08,0x71,0x00,0x2b,0x08,0xff,0xb7,0x01,0x13,0x1e,0x29,0x00,0x09,0x18,
+0x01,0x08,0xf5,0x02,0x0d,0xd8,0x02,0x03,0x8b,0x00,0x08,0xb0,0x07,0x09,0x96,0x01,
+0x05,0x32,0x07,0x0d,0x71,0x03,0x0a,0x43,0x03,0x08,0x28,0x04,0x0a,0x8d,0x02,0x03,
+0xbf,0x06,0x06,0x41,0x07,0x0e,0xde,0x03,0x06,0xc1,0x04,0x0b,0x3c,0x04,0x09,0xf8,
+0x02,0x06,0x76,0x03,0x06,0xfd,0x02,0x09,0x60,0x05,0x06,0xb7,0x08,0x0d,0xc6,0x00,
+0x08,0xc2,0x00,0x09,0xf7,0x00,0x1a,0xe1,0x18,0x00,0x06,0x41,0x05,0x04,0x3d,0x03,
+0x09,0x59,0x01,0x0a,0x55,0x01,0x09,0xd8,0x04,0x0e,0x3d,0x03,0x0e,0x37,0x05,0x05,
+0x79,0x08,0x0a,0xe8,0x01,0x00,0x01,0x00,0x01,0x4b,0x07,0x08,0x00,0x08,0x08,0x18,
+0x0a,0x09,0xd5,0x05,0x08,0x75,0x06,0x0a,0x42,0x05,0x08,0xd5,0x02,0x1a,0x6f,0x48,
+0x04,0x06,0xd5,0x02,0x1b,0x9f,0x74,0x04,0x04,0xd5,0x02,0x2a,0x01,0xef,0x42,0x01,
+0x14,0x0c,0x5a,0x00,0x1a,0x07,0x73,0x01,0x15,0x06,0xd5,0x02,0x1a,0x0d,0xc8,0x03,
+0x15,0xef,0xbc,0x00,0x19,0x5f,0xd5,0x01,0x16,0x8f,0xed,0x00,0x18,0xbf,0x06,0x02,
+0x16,0x2f,0x77,0x09,0x18,0x03,0x37,0x02,0x17,0x0a,0x5c,0x02,0x17,0x09,0x0c,0x00,
+0x18,0x04,0x25,0x00,0x17,0x1f,0xd7,0x01,0x06,0x28,0x04,0x06,0xc1,0x01,0x19,0xe0,
+0x28,0x04,0x07,0x9f,0x00,0x15,0x80,0xcc,0x01,0x19,0xf8,0x4a,0x0b,0x24,0xff,0x20,
+0x6d,0x00,0x1a,0xfe,0x01,0x01,0x15,0xfb,0xcc,0x01,0x1a,0x60,0x32,0x01,0x14,0xf4,
+0xcf,0x00,0x17,0xd0,0x63,0x01,0x50,0xff,0xff,0xff,0xff,0xd0,0x21,0x68,0x88,0x01,
+0x00,0x23,0x60,0x00,0x01,0x00,0x12,0x04,0x10,0x00,0x32,0x87,0x08,0xff,0x01,0x00,
+0x14,0x00,0x01,0x00,0x12,0xcf,0x10,0x00,0x22,0xb0,0x2f,0x08,0x00,0x14,0xf4,0x18,
+0x00,0x12,0x1f,0x10,0x00,0x32,0xf5,0x00,0xdf,0x09,0x00,0x13,0x90,0x18,0x00,0x14,
+0x05,0x41,0x00,0x12,0x07,0x08,0x00,0x14,0xfe,0x31,0x00,0x12,0xaf,0x10,0x00,0x23,
+0xa0,0x00,0x4a,0x00,0x13,0xf3,0x18,0x00,0x15,0x0f,0x59,0x00,0x03,0x6b,0x00,0x13,
+0x70,0x92,0x00,0x05,0x8a,0x00,0x12,0x06,0x09,0x00,0x13,0xfc,0x31,0x00,0x15,0x8f,
+0x71,0x00,0x03,0x84,0x00,0x12,0xf1,0x18,0x00,0x16,0x0d,0xa2,0x00,0x12,0xbf,0x0b,
+0x00,0x02,0xde,0x00,0x16,0x02,0x89,0x00,0x03,0x4a,0x00,0x12,0xfa,0x31,0x00,0x16,
+0x7f,0xba,0x00,0x03,0x85,0x00,0x11,0xf0,0x18,0x00,0x17,0x0b,0xa1,0x00,0x03,0xb6,
+0x00,0x11,0x40,0x19,0x00,0x07,0xd2,0x00,0x03,0xe7,0x00,0x11,0xf9,0x18,0x00,0x12,
+0x5f,0x0d,0x00,0x17,0x80,0xcf,0x00,0x10,0xd0,0x0c,0x00,0x18,0x09,0xea,0x00,0x03,
+0x4a,0x00,0x10,0x20,0x0c,0x00,0x11,0xef,0x0b,0x00,0x18,0xfd,0xe8,0x00,0x10,0xf7,
+0x0c,0x00,0x18,0x3f,0x02,0x01,0x12,0x0e,0x0d,0x00,0x43,0xc0,0x00,0x00,0x00,0x96,
+0x01,0x12,0xf2,0xb8,0x00,0x12,0x9f,0x0e,0x00,0x15,0x10,0x9e,0x01,0x03,0x1a,0x01,
+0x14,0x03,0x93,0x01,0x05,0x1a,0x01,0x28,0x70,0x00,0x4a,0x00,0x15,0xa0,0x01,0x01,
+0x19,0xf1,0x4b,0x01,0x15,0xfe,0x9e,0x00,0x29,0xfc,0x00,0x4a,0x00,0x15,0xf3,0xcf,
+0x00,0x04,0x28,0x02,0x14,0x0d,0xea,0x00,0x1a,0x04,0x49,0x00,0x03,0x4a,0x00,0x14,
+0xfd,0x9d,0x00,0x14,0xfb,0x18,0x00,0x14,0x02,0xba,0x00,0x1a,0x0d,0x49,0x00,0x05,
+0x10,0x00,0x18,0x02,0x7a,0x01,0x06,0x96,0x01,0x13,0xfb,0x08,0x00,0x15,0xfa,0x18,
+0x00,0x13,0x01,0x29,0x00,0x12,0x0c,0x08,0x00,0x15,0x50,0x19,0x00,0x04,0x11,0x00,
+0x0c,0x49,0x00,0x22,0x00,0x6f,0xa3,0x01,0x1b,0x5f,0x49,0x00,0x04,0x4a,0x00,0x18,
+0xea,0xdb,0x01,0x08,0xf9,0x01,0x02,0x01,0x00,0x2c,0xe0,0x00,0x4a,0x00,0x08,0xf3,
+0x01,0x27,0x00,0x00,0x12,0x02,0x0d,0x49,0x00,0x2f,0x00,0x0a,0x49,0x00,0x04,0x2e,
+0x00,0x5f,0x49,0x00,0x0d,0x4a,0x00,0x2f,0x30,0x00,0x4a,0x00,0x03,0x19,0xd0,0x31,
+0x00,0x15,0x4f,0x18,0x00,0x19,0xf8,0x18,0x00,0x03,0x5d,0x02,0x05,0x6c,0x02,0x05,
+0x01,0x00,0x1f,0x09,0x49,0x00,0x04,0x04,0x76,0x02,0x03,0x84,0x02,0x0e,0x4a,0x00,
+0x0c,0x49,0x00,0x04,0x8f,0x02,0x02,0x9c,0x02,0x0e,0x4a,0x00,0x0e,0x49,0x00,0x04,
+0x25,0x04,0x01,0xb4,0x02,0x0e,0x4a,0x00,0x0e,0x49,0x00,0x04,0x25,0x04,0x1c,0xf6,
+0x18,0x00,0x04,0x25,0x04,0x0c,0x49,0x00,0x04,0x6f,0x04,0x2e,0xb0,0x00,0x4a,0x00,
+0x04,0x15,0x03,0x0e,0x31,0x00,0x08,0xe9,0x04,0x0b,0xac,0x00,0x1d,0xa0,0x18,0x00,
+0x1f,0x3f,0x49,0x00,0x04,0x1e,0x09,0x49,0x00,0x08,0x67,0x02,0x0e,0x49,0x00,0x1a,
+0x9f,0x4a,0x05,0x0b,0x1c,0x02,0x1d,0xfe,0x18,0x00,0x06,0xf1,0x04,0x07,0x5d,0x00,
+0x49,0x33,0x34,0x6a,0xef,0x16,0x04,0x09,0x3f,0x03,0x09,0x84,0x03,0x08,0xef,0x00,
+0x0c,0xa9,0x02,0x08,0x31,0x00,0x1e,0xc0,0x31,0x00,0x09,0xaa,0x05,0x0c,0x31,0x00,
+0x1e,0xf8,0x51,0x01,0x0e,0x79,0x00,0x07,0x31,0x00,0x1e,0xfc,0x82,0x01,0x02,0x30,
+0x00,0x1e,0x10,0x31,0x00,0x0e,0x46,0x02,0x06,0x31,0x00,0x1d,0x91,0x22,0x01,0x7f,
+0x15,0x8c,0xde,0xff,0xec,0x85,0x00,0x01,0x00,0x12,0x2e,0xdf,0xff,0x01,0x00,0x3e,
+0xd0,0x0d,0xff,0x01,0x00,0x1f,0xfd,0x2b,0x00,0x83,0x1f,0x70,0x2b,0x00,0x01,0x1f,
+0xb0,0x2b,0x00,0x01,0x19,0xe1,0x31,0x02,0x1e,0xef,0xcd,0x01,0x05,0x4e,0x03,0x1e,
+0xf7,0x70,0x02,0x0c,0xc7,0x01,0x13,0x4f,0xfd,0x06,0x09,0xac,0x01,0x1f,0x2e,0xb2,
+0x04,0x01,0x14,0x0c,0xa9,0x00,0x0e,0x7d,0x04,0x0b,0x0e,0x03,0x04,0x2c,0x08,0x18,
+0xd1,0x15,0x00,0x2f,0x02,0xff,0xa9,0x00,0x08,0x1e,0xf6,0x49,0x03,0x09,0xdb,0x05,
+0x06,0x62,0x05,0x1e,0xfd,0x4f,0x04,0x0f,0xa9,0x00,0x05,0x1f,0x60,0xa9,0x00,0x16,
+0x1f,0xd0,0xa9,0x00,0x0f,0x1f,0xdf,0xa9,0x00,0x40,0x1f,0x0d,0xa9,0x00,0x33,0x1f,
+0xf2,0xa9,0x00,0x0f,0x1f,0xaf,0xa9,0x00,0x01,0x1f,0x6f,0xa9,0x00,0x09,0x1e,0x20,
+0xa9,0x00,0x0a,0x01,0x00,0x18,0xf9,0x0c,0x07,0x05,0x01,0x00,0x2f,0x95,0xff,0x2b,
+0x00,0x01,0x1f,0x8f,0x16,0x00,0x01,0x1f,0x98,0x2b,0x00,0x7e,0x50,0xff,0xff,0xff,
+0xff,0xf9,0x1f,0x00,0x01,0x00,0x05,0x37,0x01,0x6c,0xa0,0x0e,0x00,0x36,0x3a,0xff,
+0xff,0x0d,0x00,0x55,0x02,0xbf,0xff,0xff,0xf5,0x0e,0x00,0x64,0x08,0xff,0xff,0xff,
+0xff,0xb0,0x0e,0x00,0x20,0x1c,0xff,0x01,0x00,0x13,0x10,0x0e,0x00,0x11,0x2e,0x0e,
+0x00,0x19,0xf6,0x0e,0x00,0x04,0x2c,0x00,0x12,0x1e,0x0e,0x00,0x12,0xfc,0x0e,0x00,
+0x12,0x0b,0x0e,0x00,0x12,0xe4,0x0e,0x00,0x12,0x06,0x0e,0x00,0x13,0xc1,0x39,0x00,
+0x11,0xef,0x0e,0x00,0x13,0xc0,0x0e,0x00,0x11,0x6f,0x0e,0x00,0x13,0xf2,0x0e,0x00,
+0x11,0x0d,0x0e,0x00,0x13,0xf8,0x0e,0x00,0x29,0x03,0xff,0x80,0x00,0x18,0x7f,0x71,
+0x00,0x03,0x64,0x00,0x14,0xf7,0xab,0x00,0x02,0x2b,0x00,0x13,0x30,0x0e,0x00,0x11,
+0x1f,0x0e,0x00,0x1a,0xf1,0x48,0x00,0x04,0x2b,0x00,0x11,0x5f,0x0e,0x00,0x13,0xe0,
+0x0e,0x00,0x11,0x05,0x0e,0x00,0x29,0xfd,0x00,0x90,0x00,0x28,0xc0,0x00,0xbb,0x00,
+0x1f,0xfc,0x1d,0x00,0x77,0x11,0x07,0x0e,0x00,0x14,0xfb,0x1d,0x00,0x11,0x8f,0x0f,
+0x00,0x04,0xdc,0x01,0x19,0x0a,0x3e,0x01,0x03,0x69,0x01,0x13,0x50,0x0e,0x00,0x19,
+0x3f,0x13,0x01,0x19,0x0a,0xf6,0x00,0x12,0x05,0x21,0x01,0x19,0x70,0x0e,0x00,0x12,
+0xf0,0x0e,0x00,0x27,0x4b,0xff,0x69,0x01,0x28,0x9d,0xff,0xe8,0x01,0x13,0x0c,0x0e,
+0x00,0x12,0xfe,0xa2,0x01,0x13,0xcf,0x0e,0x00,0x18,0x20,0x1d,0x00,0x13,0xfc,0xbe,
+0x01,0x19,0xcf,0x3d,0x02,0x12,0x0c,0x7f,0x00,0x04,0xaf,0x01,0x03,0x3a,0x00,0x29,
+0x90,0x00,0x57,0x00,0x19,0xc1,0x1d,0x00,0x29,0xff,0xc0,0x1d,0x00,0x03,0xf5,0x00,
+0x49,0x01,0x38,0xef,0xff,0xe7,0x00,0x12,0x9f,0x84,0x00,0x0a,0x21,0x01,0x05,0xe0,
+0x02,0x19,0xdf,0x43,0x02,0x1a,0x05,0x60,0x02,0x11,0x0f,0x0e,0x00,0x29,0xf4,0x00,
+0x95,0x00,0x13,0x70,0x0e,0x00,0x11,0x09,0x0e,0x00,0x2e,0xfa,0x00,0x8c,0x02,0x05,
+0xb3,0x01,0x1f,0xfb,0x44,0x02,0x94,0x0b,0xf2,0x02,0x19,0x3f,0x0f,0x03,0x1a,0x02,
+0x2c,0x03,0x02,0x14,0x01,0x1a,0xf3,0x14,0x01,0x18,0x60,0x2d,0x04,0x06,0xf7,0x00,
+0x0a,0x62,0x02,0x29,0x00,0xef,0x40,0x01,0x18,0x07,0x2a,0x02,0x04,0xa1,0x03,0x1a,
+0xfb,0x4f,0x01,0x1a,0xf9,0x67,0x00,0x29,0xfb,0x10,0x93,0x00,0x04,0x1f,0x02,0x19,
+0x04,0x6b,0x04,0x0b,0xbc,0x02,0x39,0x00,0x03,0xef,0x85,0x00,0x28,0x01,0xbf,0x08,
+0x01,0x37,0x00,0x00,0x5e,0xbf,0x00,0x00,0x28,0x01,0x38,0xdf,0xff,0xf1,0x28,0x05,
+0x2a,0x4a,0xfb,0x38,0x05,0x70,0x10,0x00,0x67,0x77,0x77,0x77,0x2e,0x43,0x02,0x00,
+0x58,0x00,0x1f,0x5e,0x09,0x00,0xff,0x51,0x0c,0xbb,0x06,0x14,0xea,0xda,0x03,0x03,
+0xbc,0x05,0x14,0xe8,0x43,0x02,0x03,0xc6,0x04,0x38,0x81,0x00,0x00,0x04,0x06,0x17,
+0xe5,0x2b,0x00,0x08,0x53,0x02,0x19,0x0b,0x35,0x02,0x1a,0x01,0x44,0x02,0x29,0x3e,
+0xff,0xde,0x03,0x29,0x08,0xff,0xad,0x04,0x03,0x71,0x02,0x1a,0xf1,0x0f,0x00,0x1a,
+0xa0,0x2d,0x00,0x04,0x96,0x00,0x1a,0x0e,0x84,0x05,0x19,0x7f,0x5d,0x03,0x03,0x77,
+0x00,0x19,0x20,0xee,0x06,0x29,0xf6,0x00,0xbb,0x04,0x1f,0x90,0xc3,0x03,0x03,0x19,
+0x4f,0x49,0x00,0x0b,0xd2,0x06,0x18,0x2f,0xb1,0x05,0x04,0x66,0x00,0x1e,0x10,0x0c,
+0x07,0x0f,0x1d,0x00,0x73,0x19,0x0f,0xf3,0x07,0x0b,0xba,0x07,0x1a,0x0d,0xb1,0x05,
+0x19,0xaf,0x14,0x01,0x03,0x45,0x04,0x0a,0xf7,0x00,0x1a,0xf5,0x36,0x04,0x1a,0xe1,
+0x18,0x04,0x29,0xd2,0x00,0x55,0x06,0x28,0xf8,0x20,0x3b,0x00,0x47,0xff,0xff,0xed,
+0x50,0x13,0x08,0x05,0x4f,0x08,0x29,0x6f,0xff,0x55,0x04,0x29,0x4e,0xff,0x6c,0x08,
+0x1a,0x19,0x72,0x04,0x18,0x4e,0x1d,0x00,0x28,0x01,0xbf,0x1d,0x00,0x28,0x03,0xef,
+0x3a,0x00,0x28,0x02,0xef,0x57,0x00,0x29,0x01,0xef,0x74,0x00,0x12,0xaf,0x0d,0x00,
+0x27,0xc6,0x21,0x4b,0x05,0x29,0xff,0x50,0x4f,0x09,0x19,0x30,0x4e,0x01,0x19,0x80,
+0xdc,0x05,0x19,0xf0,0xd8,0x07,0x1f,0xfa,0xb0,0x05,0x03,0x0b,0xcd,0x05,0x0a,0x8d,
+0x02,0x0f,0x27,0x02,0x7e,0x0a,0x1d,0x00,0x1f,0x02,0xf2,0x02,0x09,0x1a,0x04,0x18,
+0x02,0x0a,0xef,0x06,0x1f,0x08,0x13,0x01,0x0f,0x19,0xf2,0x74,0x03,0x1a,0xfe,0x2e,
+0x08,0x0a,0x69,0x01,0x19,0xf1,0xff,0x0a,0x04,0x56,0x00,0x19,0x1d,0x4c,0x01,0x18,
+0x4e,0x04,0x02,0x38,0x02,0xcf,0xff,0x8f,0x00,0x1a,0x1f,0x0d,0x0b,0x02,0x1d,0x00,
+0x19,0xd1,0x80,0x00,0x28,0xb1,0x00,0x02,0x01,0x15,0x70,0xd1,0x04,0x44,0xbf,0xff,
+0xff,0xfb,0xae,0x01,0x01,0x2c,0x00,0x17,0xb3,0x19,0x05,0x38,0x1f,0xd7,0x20,0x28,
+0x05,0x1f,0x20,0x05,0x0c,0x01,0x1f,0x21,0x1e,0x0c,0x04,0x6f,0x05,0xad,0xff,0xff,
+0xfd,0xa5,0x1a,0x00,0x01,0x22,0x07,0xef,0x36,0x03,0x15,0x10,0x11,0x00,0x50,0x99,
+0x99,0x99,0x99,0x92,0xd7,0x00,0x02,0x1d,0x01,0x07,0x71,0x05,0x14,0x0d,0x5d,0x02,
+0x2a,0x4f,0xff,0xa4,0x09,0x03,0x66,0x01,0x15,0xf2,0xb7,0x04,0x01,0x7f,0x08,0x17,
+0x20,0x35,0x08,0x15,0xf1,0x41,0x0c,0x01,0x01,0x00,0x17,0xe3,0x10,0x05,0x11,0xf0,
+0xf8,0x00,0x06,0x01,0x00,0x16,0x50,0x2a,0x02,0x14,0xc0,0xe4,0x03,0x08,0x49,0x03,
+0x13,0x0a,0x31,0x04,0x29,0x0d,0xff,0x01,0x00,0x15,0xc2,0x60,0x05,0x15,0x50,0xed,
+0x03,0x04,0x01,0x00,0x34,0xb6,0x34,0x7d,0x7a,0x02,0x03,0x86,0x03,0x0d,0x01,0x00,
+0x14,0xfb,0x2e,0x03,0x4a,0xb4,0x10,0x38,0xef,0x1b,0x00,0x35,0xf5,0x00,0x04,0x7e,
+0x00,0x1a,0x08,0x1b,0x00,0x36,0xd0,0x00,0x08,0xbf,0x04,0x19,0x3e,0x1b,0x00,0x36,
+0x40,0x00,0x0a,0xed,0x02,0x14,0x01,0xe3,0x0a,0x03,0x53,0x02,0x17,0x0d,0x5b,0x02,
+0x19,0x0b,0x50,0x00,0x02,0x5f,0x06,0x19,0xf5,0x31,0x06,0x04,0x74,0x0b,0x1e,0x0f,
+0xca,0x02,0x00,0x01,0x00,0x14,0xe2,0x80,0x01,0x05,0xe9,0x08,0x36,0x2c,0xff,0xff,
+0x60,0x09,0x65,0x03,0x33,0x33,0x33,0x33,0x30,0xf1,0x01,0x12,0x5c,0x76,0x06,0x1f,
+0x40,0x0d,0x02,0x01,0x56,0x27,0xbd,0xff,0xfe,0xb8,0x2b,0x00,0x54,0x03,0x8c,0xdf,
+0xec,0x94,0x0d,0x00,0x11,0x4c,0x86,0x00,0x28,0x60,0x00,0xcc,0x04,0x19,0xc1,0xdc,
+0x00,0x18,0xe2,0xcc,0x0b,0x01,0xa6,0x05,0x06,0x6d,0x01,0x18,0xc0,0x35,0x02,0x21,
+0xff,0x70,0x01,0x01,0x41,0xfe,0x62,0x01,0x5c,0x8d,0x03,0x13,0x04,0x46,0x0c,0x11,
+0x09,0x2c,0x07,0x13,0x9f,0x45,0x0a,0x10,0x0b,0x7f,0x0b,0x14,0x0d,0x11,0x02,0x10,
+0x2f,0x1b,0x04,0x04,0x11,0x04,0x00,0xb8,0x03,0x24,0xf1,0x0f,0xe2,0x0a,0x10,0x0a,
+0x98,0x03,0x02,0x3d,0x01,0x02,0x74,0x00,0x10,0xf2,0x0e,0x01,0x05,0x14,0x06,0x23,
 0x10,0xdf,0xf3,0x0b,0x10,0x01,0x3f,0x00,0x14,0x0a,0x29,0x00,0x10,0x9f,0x7b,0x07,
-0x17,0x5f,0x5f,0x62,0x02,0xde,0xee,0x41,0xd6,0x10,0x04,0xbf,0x4b,0x01,0x19,0x06,
-0xe8,0x27,0x19,0x0c,0x23,0x44,0x19,0x1d,0xed,0x16,0x19,0x2d,0xe3,0x14,0x19,0x0b,
-0xfe,0x02,0x29,0x05,0xdf,0xc4,0x0e,0x4e,0x48,0xce,0xfe,0xda,0xb0,0xad,0x1f,0xee,
-0xb5,0x03,0x03,0x04,0x05,0x02,0x17,0xdd,0x14,0x00,0x70,0xf1,0xef,0x00,0xfa,0xe5,
-0x00,0xe5,0x9d,0x01,0x1e,0x00,0xb6,0xb4,0x3d,0x0b,0x00,0x06,0x15,0x00,0x1f,0xad,
-0xdf,0x66,0x15,0x1f,0xb7,0x1d,0x00,0x09,0x03,0x84,0x00,0xa2,0xe8,0x00,0xfa,0x00,
-0x00,0xdd,0xfb,0xe9,0xf5,0x00,0x39,0xff,0xaa,0xf2,0xfc,0x00,0x00,0xfb,0xfd,0xf1,
-0xf6,0x00,0x04,0x2f,0x00,0x5f,0xf8,0x00,0xf9,0x00,0x00,0xea,0xcd,0x01,0x1c,0xf8,
-0x0a,0x00,0x0a,0x9f,0x15,0x02,0x9d,0x0b,0x40,0xdc,0x00,0x00,0x00,0x1d,0x03,0x7f,
-0xe7,0x00,0xfa,0x00,0xfa,0xf3,0xf9,0x98,0x00,0x09,0x05,0xf0,0x00,0x21,0xfa,0xfb,
-0x33,0x00,0x25,0xfb,0xf8,0x07,0x06,0x00,0xd8,0x01,0x35,0xc8,0x00,0xc3,0x23,0x00,
-0xaa,0xf6,0xfa,0x00,0x00,0xfa,0xf8,0x00,0x00,0xfa,0xf9,0x1b,0x05,0x03,0x8c,0x00,
-0x1e,0x05,0xbe,0xcd,0x05,0x5c,0x00,0x0f,0x3a,0x01,0x0c,0x00,0x50,0x02,0x1a,0xf7,
-0xe5,0x00,0x00,0x4d,0x00,0x21,0xf9,0xf4,0xd9,0x01,0x14,0xac,0xab,0x00,0x96,0xed,
-0x00,0x00,0xc4,0xf9,0xc4,0xe5,0x00,0xae,0x2a,0x00,0x25,0xfc,0xdc,0xb4,0x03,0x72,
-0x8a,0x00,0x00,0x00,0xcc,0x00,0xca,0xe6,0x01,0x51,0x00,0xf5,0x00,0xfd,0xfc,0x1d,
-0x01,0x1c,0x04,0x5b,0x01,0x00,0xca,0x00,0x5f,0x00,0xf8,0xfa,0x00,0xf6,0x93,0x00,
-0x0a,0x10,0xf1,0xb5,0x00,0x1f,0xf2,0x69,0x02,0x02,0xc0,0xb4,0xb0,0x00,0x00,0xdd,
-0xf8,0xc1,0xfb,0x05,0x00,0x05,0x04,0xfe,0x00,0xd2,0xcf,0xe6,0x00,0xe6,0xc3,0xed,
-0xea,0x00,0xed,0xe8,0xf2,0xe9,0xee,0x54,0x01,0x66,0xc1,0xd2,0x00,0x00,0xea,0xfc,
-0x23,0x01,0xa3,0xf3,0xf3,0x00,0x00,0xf3,0xf7,0x00,0x00,0xf8,0xfd,0x73,0x01,0x71,
-0x04,0x00,0xd6,0xee,0x00,0x00,0xf3,0x0a,0x00,0x02,0xa0,0x07,0x63,0xf6,0xf7,0x00,
-0x00,0xf7,0xfa,0x2c,0x01,0x03,0x15,0x00,0x10,0xd2,0x05,0x01,0x07,0x10,0x00,0x12,
-0xf8,0x1f,0x00,0x13,0xfa,0x2c,0x01,0xf6,0x12,0xf7,0x06,0xf2,0xbc,0xd4,0x00,0x00,
-0xd4,0xf8,0xe4,0xfb,0x05,0xe4,0x05,0x05,0x04,0x05,0x00,0x05,0xee,0xed,0xfa,0xf4,
-0xed,0xf4,0xef,0xfa,0xf5,0xfa,0x00,0xf9,0xf7,0x06,0xae,0x20,0x1a,0xf8,0x8e,0x01,
-0x01,0x46,0x00,0x3c,0xf8,0xf8,0x00,0x3c,0x02,0x0e,0xad,0xb7,0x06,0x55,0x02,0x0e,
-0x01,0x00,0x07,0x80,0x02,0x1f,0xf8,0x23,0x00,0x09,0x6e,0xfd,0x00,0xfc,0xfc,0x00,
-0x00,0x7b,0xe9,0x0e,0x4c,0x00,0x0f,0x1d,0x00,0x0f,0x1e,0x05,0xa2,0x03,0x39,0x05,
-0x00,0xf9,0xd1,0x02,0x1f,0xe9,0x9f,0x6a,0x24,0x0a,0xa6,0x02,0x1f,0xe6,0x8c,0x00,
-0x0b,0x22,0xfa,0xfb,0xfa,0x02,0x1b,0xcd,0x1a,0x00,0x30,0xf7,0xfa,0x06,0x78,0x04,
-0x4f,0x0f,0x00,0x05,0x05,0x41,0x00,0x09,0x17,0xf7,0x4a,0x22,0x00,0xf5,0x05,0x0c,
-0x60,0x00,0x2c,0xfc,0x04,0x0d,0x01,0x1f,0xdc,0xd2,0x00,0x23,0x0e,0xad,0xf7,0x0f,
-0xf5,0x01,0x13,0x1e,0xfa,0xb6,0x03,0x04,0x10,0x6c,0x11,0x02,0xb4,0x09,0x21,0x03,
-0x00,0x5c,0x03,0x1e,0x05,0x52,0x04,0xf2,0x0b,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,
-0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,
-0x17,0x18,0x19,0x30,0x3e,0x70,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x82,0x09,0xf7,
-0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,
-0x61,0x00,0x20,0x03,0x02,0x5c,0x00,0x4c,0x06,0x07,0x06,0x08,0xb8,0x1b,0x60,0x00,
-0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xd0,0x0b,0x00,0x0d,
-0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0xaf,0x4e,0x62,0x00,0x17,0x17,
-0x17,0x18,0x17,0x89,0x0c,0xf0,0x03,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,
-0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x00,0x00,
+0x13,0x5f,0xe3,0x0b,0x11,0x7f,0x95,0x00,0x00,0xf8,0x01,0x41,0xd6,0x10,0x04,0xbf,
+0x4b,0x01,0x16,0x06,0xaf,0x00,0x17,0xf8,0x95,0x0c,0x01,0x9c,0x00,0x03,0x0d,0x04,
+0x03,0x10,0x04,0x16,0x2d,0xf3,0x01,0x06,0xcf,0x01,0x03,0xfe,0x02,0x29,0x05,0xdf,
+0xc4,0x0e,0x90,0x48,0xce,0xfe,0xda,0x50,0x00,0x00,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -1755,11 +2210,56 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 176, .range_length = 1, .glyph_id_start = 96, .list_length = 0, .type = 2, .unicode_list = 0, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[137120] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 1420, .size = 2740, .comp_size = 844 },
+{ .bitmap_start = 2740, .comp_offset = 2264, .size = 2115, .comp_size = 649 },
+{ .bitmap_start = 4855, .comp_offset = 2913, .size = 2237, .comp_size = 859 },
+{ .bitmap_start = 7092, .comp_offset = 3772, .size = 3575, .comp_size = 1199 },
+{ .bitmap_start = 10667, .comp_offset = 4971, .size = 4016, .comp_size = 1032 },
+{ .bitmap_start = 14683, .comp_offset = 6003, .size = 4089, .comp_size = 848 },
+{ .bitmap_start = 18772, .comp_offset = 6851, .size = 3419, .comp_size = 975 },
+{ .bitmap_start = 22191, .comp_offset = 7826, .size = 3440, .comp_size = 881 },
+{ .bitmap_start = 25631, .comp_offset = 8707, .size = 3454, .comp_size = 916 },
+{ .bitmap_start = 29085, .comp_offset = 9623, .size = 3765, .comp_size = 1273 },
+{ .bitmap_start = 32850, .comp_offset = 10896, .size = 3293, .comp_size = 853 },
+{ .bitmap_start = 36143, .comp_offset = 11749, .size = 1527, .comp_size = 468 },
+{ .bitmap_start = 37670, .comp_offset = 12217, .size = 3520, .comp_size = 1229 },
+{ .bitmap_start = 41190, .comp_offset = 13446, .size = 4003, .comp_size = 1066 },
+{ .bitmap_start = 45193, .comp_offset = 14512, .size = 3817, .comp_size = 1045 },
+{ .bitmap_start = 49010, .comp_offset = 15557, .size = 3140, .comp_size = 133 },
+{ .bitmap_start = 52150, .comp_offset = 15690, .size = 3956, .comp_size = 689 },
+{ .bitmap_start = 56106, .comp_offset = 16379, .size = 2197, .comp_size = 270 },
+{ .bitmap_start = 58303, .comp_offset = 16649, .size = 3485, .comp_size = 576 },
+{ .bitmap_start = 61788, .comp_offset = 17225, .size = 2484, .comp_size = 749 },
+{ .bitmap_start = 64272, .comp_offset = 17974, .size = 4027, .comp_size = 1023 },
+{ .bitmap_start = 68299, .comp_offset = 18997, .size = 1829, .comp_size = 353 },
+{ .bitmap_start = 70128, .comp_offset = 19350, .size = 2490, .comp_size = 749 },
+{ .bitmap_start = 72618, .comp_offset = 20099, .size = 3745, .comp_size = 1039 },
+{ .bitmap_start = 76363, .comp_offset = 21138, .size = 3822, .comp_size = 349 },
+{ .bitmap_start = 80185, .comp_offset = 21487, .size = 2174, .comp_size = 634 },
+{ .bitmap_start = 82359, .comp_offset = 22121, .size = 2829, .comp_size = 1012 },
+{ .bitmap_start = 85188, .comp_offset = 23133, .size = 2036, .comp_size = 652 },
+{ .bitmap_start = 87224, .comp_offset = 23785, .size = 3899, .comp_size = 754 },
+{ .bitmap_start = 91123, .comp_offset = 24539, .size = 3629, .comp_size = 425 },
+{ .bitmap_start = 94752, .comp_offset = 24964, .size = 4011, .comp_size = 1172 },
+{ .bitmap_start = 98763, .comp_offset = 26136, .size = 2895, .comp_size = 820 },
+{ .bitmap_start = 101658, .comp_offset = 26956, .size = 2504, .comp_size = 594 },
+{ .bitmap_start = 104162, .comp_offset = 27550, .size = 3935, .comp_size = 879 },
+{ .bitmap_start = 108097, .comp_offset = 28429, .size = 3496, .comp_size = 631 },
+{ .bitmap_start = 111593, .comp_offset = 29060, .size = 3068, .comp_size = 530 },
+{ .bitmap_start = 114661, .comp_offset = 29590, .size = 2955, .comp_size = 847 },
+{ .bitmap_start = 117616, .comp_offset = 30437, .size = 3576, .comp_size = 979 },
+{ .bitmap_start = 121192, .comp_offset = 31416, .size = 3402, .comp_size = 755 },
+{ .bitmap_start = 124594, .comp_offset = 32171, .size = 3034, .comp_size = 1105 },
+{ .bitmap_start = 127628, .comp_offset = 33276, .size = 2882, .comp_size = 758 },
+{ .bitmap_start = 130510, .comp_offset = 34034, .size = 4040, .comp_size = 1178 },
+};
+
+static uint8_t etxUncompBuf[2570] __SDRAMFONTS;
 
 const etxLz4Font lv_font_en_bold_XXL = {
-.uncomp_size = 136920,
-.comp_size = 27929,
+.uncomp_size = 2370,
+.comp_size = 1420,
 .line_height = 102,
 .base_line = 22,
 .subpx = 0,
@@ -1772,12 +2272,13 @@ const etxLz4Font lv_font_en_bold_XXL = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 35,
-.glyph_bitmap = 776,
-.class_pair_values = 135326,
-.left_class_mapping = 136726,
-.right_class_mapping = 136823,
+.class_pair_values = 776,
+.left_class_mapping = 2176,
+.right_class_mapping = 2273,
+.block_num = 42,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 137120,
+.lvglFontBufSize = 2570,
 };
@@ -86,514 +86,522 @@ static const uint8_t lz4FontData[] ={
 0x00,0x7d,0x08,0x00,0x13,0xca,0x08,0x00,0x22,0x17,0x21,0x08,0x00,0x13,0x64,0x08,
 0x00,0x22,0xb1,0x21,0xa8,0x00,0xa2,0x0f,0x22,0x60,0x0b,0x0b,0x0e,0x00,0xfe,0x5c,
 0x22,0x60,0x00,0x22,0xb0,0x22,0xa8,0x00,0xa2,0x12,0x23,0x40,0x10,0x11,0x0a,0x00,
-0x00,0x67,0x23,0x60,0x00,0x60,0xad,0x23,0x10,0x0d,0x0e,0x09,0x60,0x06,0xf0,0xff,
-0x40,0x2e,0x1a,0x71,0x1c,0x0d,0xea,0x14,0xea,0x17,0xea,0x18,0xea,0x19,0xea,0x1d,
-0xea,0x1f,0xea,0x21,0xea,0x25,0xea,0x28,0xea,0x2d,0xea,0x32,0xea,0x33,0xea,0x34,
-0xea,0x4a,0xea,0x4f,0xea,0x54,0xea,0x57,0xea,0x58,0xea,0x59,0xea,0x5d,0xea,0x5e,
-0xea,0x5f,0xea,0x60,0xea,0x73,0xea,0x74,0xea,0x7a,0xea,0x7c,0xea,0x7d,0xea,0x80,
-0xea,0x83,0xea,0x84,0xea,0x85,0xea,0x87,0xea,0x9f,0xea,0xa1,0xea,0xd0,0xea,0xd1,
-0xea,0xd3,0xea,0xd5,0xea,0xec,0xea,0xf3,0xea,0xf6,0xea,0xff,0xea,0x28,0xeb,0x30,
-0xeb,0x67,0xeb,0xf7,0xeb,0x4c,0xec,0x4d,0xec,0x4e,0xec,0x4f,0xec,0x50,0xec,0x93,
-0xec,0x9f,0xec,0xf9,0xec,0x10,0xed,0x66,0xef,0xce,0xf1,0xae,0xf2,0xe4,0xe4,0xe4,
-0xe3,0xe3,0xd3,0x82,0x30,0xd4,0x2c,0x67,0x2b,0x66,0x29,0x65,0x01,0x00,0x00,0x09,
-0x50,0xe0,0x00,0x0d,0x13,0xa0,0x0a,0xef,0xef,0xec,0x00,0x3a,0x0a,0x40,0x00,0x77,
-0x0d,0x00,0x3d,0xfe,0xdf,0xd4,0x00,0xd1,0x3a,0x00,0x00,0xe0,0x68,0x00,0x02,0xc0,
-0x95,0x00,0x00,0x0a,0x40,0x00,0x05,0xda,0x20,0x08,0xd7,0xae,0x10,0xe4,0x00,0xc6,
-0x0d,0x70,0x03,0x20,0x5f,0xa4,0x00,0x00,0x28,0xeb,0x00,0x00,0x01,0xd7,0x3f,0x00,
-0x09,0x80,0xd9,0x46,0xf4,0x01,0x9f,0xb4,0x00,0x00,0xc2,0x00,0x0a,0xcb,0x00,0x00,
-0x04,0xa0,0x86,0x09,0x10,0x4a,0x08,0x64,0x90,0x00,0x8c,0xa1,0xc0,0x00,0x00,0x00,
-0xa4,0x00,0x00,0x00,0x4a,0x3b,0xb4,0x00,0x1c,0x1c,0x21,0xd0,0x09,0x50,0xc2,0x0d,
-0x00,0x00,0x04,0xcc,0x50,0x00,0xbf,0xd4,0x00,0x00,0x7c,0x06,0xd0,0x00,0x08,0xb0,
-0x7b,0x00,0x00,0x1e,0xbc,0x10,0x00,0x03,0xef,0x40,0x22,0x01,0xf4,0x4e,0x2a,0x60,
-0x5d,0x00,0x7d,0xe2,0x01,0xf3,0x01,0xee,0x00,0x04,0xcd,0xd8,0xc9,0x00,0x59,0x58,
-0x58,0x00,0x00,0x02,0x00,0x02,0xd1,0x00,0xd3,0x00,0x6b,0x00,0x0c,0x60,0x00,0xf2,
-0x00,0x1f,0x00,0x02,0xf0,0x00,0x1f,0x20,0x00,0xe3,0x00,0x09,0x80,0x00,0x2d,0x8a,
-0x07,0xf0,0x0e,0x00,0xa1,0x20,0x00,0x88,0x00,0x0c,0x40,0x05,0xd0,0x00,0xe3,0x00,
-0xb6,0x00,0x98,0x00,0x99,0x00,0xa8,0x00,0xc5,0x01,0xf1,0x07,0x90,0x2d,0x10,0x83,
-0x82,0x00,0xf2,0x12,0x42,0xa4,0x31,0x6d,0xfe,0xc3,0x04,0xdc,0x00,0x0e,0x2a,0x70,
-0x01,0x01,0x10,0x00,0x0a,0x20,0x00,0x00,0xe4,0x00,0x00,0x0e,0x40,0x07,0xff,0xff,
-0xfc,0x12,0x2e,0x52,0x10,0x0e,0x00,0xf0,0x30,0x00,0x3f,0x4d,0x96,0x00,0xbf,0xf5,
-0x04,0x00,0xe3,0x00,0x03,0xc0,0x00,0x96,0x00,0x0e,0x00,0x06,0xa0,0x00,0xc3,0x00,
-0x2d,0x00,0x08,0x70,0x00,0xe1,0x00,0x5b,0x00,0x0b,0x50,0x00,0x02,0xcf,0xd5,0x00,
-0xc8,0x04,0xf2,0x2f,0x00,0x0b,0x63,0xe0,0x00,0xa8,0x4e,0x00,0x09,0x93,0xe0,0x00,
-0xa8,0x2f,0x00,0x0b,0x60,0xc8,0x03,0xf1,0x1c,0x00,0x77,0x04,0xa9,0xdc,0xca,0x10,
-0x8a,0x00,0x02,0x00,0xf0,0x19,0x04,0xcf,0xd6,0x01,0xf5,0x04,0xf3,0x4a,0x00,0x0d,
-0x50,0x00,0x01,0xf1,0x00,0x00,0xc7,0x00,0x00,0xba,0x00,0x00,0xaa,0x00,0x00,0x9b,
-0x00,0x00,0x3f,0xff,0xff,0xc0,0x04,0xcf,0xd4,0x01,0xf5,0x04,0xf1,0x26,0x80,0x00,
-0xf0,0x25,0x05,0xe1,0x00,0x8f,0xf5,0x00,0x00,0x04,0xf3,0x25,0x00,0x0c,0x62,0xf3,
-0x03,0xf3,0x05,0xdf,0xd5,0x00,0x00,0x00,0xdb,0x00,0x00,0x08,0xfb,0x00,0x00,0x3e,
-0x8b,0x00,0x00,0xc5,0x7b,0x00,0x07,0xa0,0x7b,0x00,0x2e,0x10,0x7b,0x00,0x9f,0xff,
-0xff,0xf0,0x00,0x00,0x7b,0x00,0x04,0x00,0xf1,0x50,0x04,0xff,0xff,0x80,0x6c,0x11,
-0x10,0x07,0x90,0x00,0x00,0x9d,0xdd,0x70,0x05,0x72,0x4e,0x60,0x00,0x00,0x7b,0x07,
-0x10,0x07,0xb0,0xb9,0x01,0xd6,0x01,0xae,0xe8,0x00,0x00,0x3b,0xf5,0x00,0x3f,0x71,
-0x00,0x0b,0x70,0x00,0x00,0xf9,0xee,0x70,0x2f,0x90,0x3e,0x52,0xf0,0x00,0x99,0x0f,
-0x20,0x08,0x90,0xab,0x02,0xe4,0x00,0xae,0xe6,0x00,0x7f,0xff,0xff,0xb0,0x00,0x00,
-0xc5,0x00,0x00,0x3d,0x00,0x00,0x0b,0x60,0x00,0x03,0xe0,0x00,0x00,0xa8,0x00,0x00,
-0x2f,0x10,0x00,0x09,0x90,0x00,0x01,0xf2,0x00,0xf6,0x00,0xf1,0x30,0xd8,0x04,0xf2,
-0x0f,0x20,0x0d,0x50,0xc8,0x04,0xe1,0x02,0xff,0xf6,0x00,0xe6,0x03,0xe3,0x3e,0x00,
-0x0a,0x81,0xf5,0x02,0xe5,0x04,0xcf,0xe7,0x00,0x03,0xcf,0xc2,0x00,0xe6,0x07,0xe0,
-0x4e,0x00,0x0d,0x44,0xd0,0x00,0xb6,0x1f,0x60,0x5f,0x60,0x4d,0xf9,0xd5,0x00,0x00,
-0x1f,0x10,0x00,0x3c,0x90,0x01,0xfd,0x70,0x00,0x0e,0x30,0x50,0x5b,0x09,0x51,0x40,
-0x1e,0x30,0x2e,0x10,0x0b,0x00,0xf0,0x11,0x01,0x90,0x2f,0x06,0xb0,0x41,0x00,0x00,
-0x00,0x68,0x01,0x8e,0xc4,0x6e,0x92,0x00,0x4d,0xc5,0x00,0x00,0x4c,0xe6,0x00,0x00,
-0x36,0x0e,0xee,0xee,0x30,0x11,0x11,0x10,0x24,0x00,0xf0,0x33,0xee,0xee,0xe3,0x01,
-0x11,0x11,0x00,0x2a,0x30,0x00,0x00,0x7d,0xc5,0x00,0x00,0x04,0xae,0x20,0x02,0x8e,
-0xa1,0x1b,0xf9,0x20,0x01,0x71,0x00,0x00,0x08,0xee,0xa0,0x5e,0x21,0xd7,0x12,0x00,
-0x99,0x00,0x02,0xe4,0x00,0x1e,0x70,0x00,0x9a,0x00,0x00,0x43,0x00,0x00,0x21,0x00,
-0x00,0xa7,0x00,0x00,0x03,0xbd,0xdc,0x70,0x00,0x00,0x6b,0x20,0x00,0x7b,0xc7,0x01,
-0xf1,0x1a,0x00,0x07,0x60,0x0a,0x30,0x2b,0xd9,0x00,0xb0,0x0e,0x00,0xd4,0x0e,0x00,
-0xc0,0x2b,0x04,0xb0,0x0e,0x00,0xc0,0x3a,0x07,0x80,0x1c,0x00,0xc0,0x2b,0x06,0x90,
-0x6c,0x04,0x90,0x0e,0x01,0xcb,0x5b,0xca,0x10,0x09,0x60,0x97,0x00,0xf0,0x21,0xd6,
-0x00,0x02,0x00,0x00,0x00,0x18,0xcc,0xda,0x00,0x00,0x00,0x07,0xf0,0x00,0x00,0x00,
-0xdc,0x50,0x00,0x00,0x4b,0x4c,0x00,0x00,0x0a,0x50,0xd2,0x00,0x01,0xd0,0x07,0x80,
-0x00,0x7f,0xee,0xee,0x00,0x0d,0x31,0x11,0xb5,0x03,0xe0,0x00,0x06,0xb0,0xa9,0xe5,
-0x00,0xf0,0x21,0xef,0xff,0xc3,0x0e,0x40,0x18,0xe0,0xe4,0x00,0x2f,0x1e,0x40,0x09,
-0xc0,0xef,0xff,0xf4,0x0e,0x40,0x05,0xf1,0xe4,0x00,0x0e,0x5e,0x40,0x05,0xf2,0xef,
-0xff,0xd4,0x00,0x00,0x7d,0xfd,0x60,0x08,0xe4,0x04,0xe5,0x0f,0x40,0x00,0x7b,0x3f,
-0x00,0x00,0x00,0x04,0x00,0xf2,0x27,0x2f,0x00,0x00,0x00,0x0f,0x40,0x00,0x7a,0x07,
-0xd3,0x03,0xe5,0x00,0x7e,0xfd,0x60,0xef,0xfe,0x91,0x0e,0x40,0x2a,0xd0,0xe4,0x00,
-0x0d,0x6e,0x40,0x00,0x8a,0xe4,0x00,0x07,0xbe,0x40,0x00,0x9a,0xe4,0x00,0x0d,0x7e,
-0x40,0x2a,0xd0,0xef,0xfe,0x91,0x00,0xef,0xff,0xfe,0xe4,0x00,0x00,0x03,0x00,0x37,
-0xef,0xff,0xf4,0x0c,0x00,0x47,0xff,0xef,0xff,0xfc,0x0f,0x00,0x15,0xf2,0x0c,0x00,
-0x20,0xe4,0x00,0x7a,0x00,0xb0,0x70,0x07,0xd4,0x03,0xd8,0x0f,0x40,0x00,0x36,0x2f,
-0x10,0x7a,0x00,0xf8,0x07,0x7f,0xfe,0x2f,0x10,0x00,0x5e,0x0e,0x50,0x00,0x5e,0x06,
-0xe4,0x01,0xad,0x00,0x6d,0xfe,0xa2,0xe4,0x00,0x00,0xf2,0x04,0x00,0x4c,0xef,0xff,
-0xff,0xf2,0x14,0x00,0x14,0xd6,0x01,0x00,0x10,0x00,0x79,0x03,0x2a,0x01,0xf2,0x07,
-0x00,0xf8,0x20,0x55,0x00,0x1f,0x26,0xe2,0x09,0xd0,0x08,0xef,0xb2,0x00,0xe4,0x00,
-0x2e,0x60,0xe4,0x01,0xd7,0x00,0xe4,0x1d,0x90,0x00,0xe5,0xca,0x00,0x00,0xee,0xfa,
-0x00,0x00,0xeb,0x2e,0x60,0x00,0xe4,0x04,0xf3,0x00,0xe4,0x00,0x7e,0x10,0xe4,0x00,
-0x0a,0xb0,0xa1,0x00,0x08,0x03,0x00,0xf0,0x22,0xef,0xff,0xfa,0xed,0x00,0x00,0x08,
-0xf4,0xef,0x40,0x00,0x0e,0xf4,0xeb,0xa0,0x00,0x5d,0xd4,0xe5,0xf1,0x00,0xc6,0xe4,
-0xe4,0xa7,0x02,0xf0,0xe4,0xe4,0x4e,0x09,0x90,0xf4,0xe4,0x0d,0x5e,0x20,0xf4,0xe4,
-0x06,0xfc,0x00,0xf4,0xe4,0x00,0xf5,0x00,0xf4,0xea,0xad,0x00,0xf0,0x27,0x40,0x00,
-0xf2,0xeb,0xe1,0x00,0xf2,0xe4,0xba,0x00,0xf2,0xe4,0x1f,0x50,0xf2,0xe4,0x06,0xe1,
-0xf2,0xe4,0x00,0xba,0xf2,0xe4,0x00,0x1f,0xf2,0xe4,0x00,0x06,0xf2,0x00,0x6d,0xfd,
-0x60,0x00,0x7e,0x41,0x5e,0x60,0x0f,0x50,0x00,0x6e,0x02,0xf0,0x00,0x01,0xf1,0x3f,
-0x00,0x00,0x0f,0x22,0x09,0x00,0x91,0x0f,0x50,0x00,0x5e,0x00,0x7e,0x41,0x4e,0x60,
-0x24,0x00,0xf3,0x04,0xef,0xff,0xd7,0x0e,0x40,0x03,0xe6,0xe4,0x00,0x08,0xae,0x40,
-0x02,0xd7,0xef,0xff,0xd8,0x0e,0x40,0x23,0x04,0x01,0x49,0x01,0x00,0x4a,0x01,0xf0,
-0x05,0x50,0x00,0x8e,0x41,0x5f,0x50,0x0f,0x40,0x00,0x7d,0x03,0xf0,0x00,0x02,0xf0,
-0x4e,0x00,0x00,0x1f,0x13,0x09,0x00,0xc0,0x0f,0x40,0x00,0x6d,0x00,0x8d,0x41,0x5e,
-0x50,0x00,0x7d,0xff,0xf1,0x04,0x10,0x1c,0x05,0x00,0xf0,0x21,0x03,0x00,0xff,0xff,
-0xc4,0x0f,0x40,0x06,0xf2,0xf4,0x00,0x0e,0x5f,0x40,0x06,0xf2,0xff,0xff,0xe3,0x0f,
-0x40,0x4e,0x00,0xf4,0x00,0xc8,0x0f,0x40,0x04,0xf1,0xf4,0x00,0x0c,0x80,0x02,0xbf,
-0xfa,0x10,0x0e,0x81,0x19,0xd0,0x2f,0x10,0x00,0xb1,0x0c,0xb3,0x62,0x00,0xf1,0x07,
-0xe8,0x00,0x00,0x00,0x2b,0xd0,0x48,0x00,0x00,0xf2,0x2f,0x60,0x07,0xf0,0x03,0xbf,
-0xfb,0x30,0xbf,0xff,0xff,0xf7,0xb6,0x03,0x0f,0x04,0x00,0x07,0x00,0x65,0x03,0x1f,
-0xa9,0x04,0x00,0x01,0xf0,0x1b,0x0f,0x20,0x00,0xb7,0x0b,0xb2,0x05,0xf2,0x01,0x9e,
-0xfc,0x40,0xaa,0x00,0x00,0x6e,0x04,0xf0,0x00,0x0c,0x80,0x0d,0x50,0x01,0xf2,0x00,
-0x8b,0x00,0x7c,0x00,0x01,0xf1,0x0c,0x60,0x00,0x0b,0x62,0xf0,0x00,0x00,0x5b,0x7a,
-0x6b,0x03,0x50,0x30,0x00,0x00,0x09,0xd0,0x4b,0x04,0x20,0x0d,0x70,0x24,0x01,0xf5,
-0x5e,0x1f,0xc0,0x05,0xe0,0x0f,0x30,0x6b,0xf1,0x08,0xa0,0x0b,0x60,0xb6,0xb5,0x0c,
-0x60,0x07,0xa0,0xf1,0x6a,0x0f,0x20,0x03,0xe4,0xc0,0x1e,0x4e,0x00,0x00,0xfa,0x70,
-0x0d,0xaa,0x00,0x00,0xcf,0x20,0x08,0xf6,0x00,0x00,0x8e,0x00,0x03,0xf2,0x00,0x3f,
-0x30,0x01,0xe6,0x09,0xc0,0x0a,0xb0,0x00,0xe6,0x4f,0x20,0x00,0x4f,0xd7,0x00,0x00,
-0x0c,0xf0,0x00,0x00,0x5f,0xd7,0x00,0x01,0xe6,0x4f,0x20,0x0a,0xc0,0x09,0xc0,0x4f,
-0x20,0x01,0xe7,0xab,0x00,0x00,0xe6,0x1f,0x40,0x07,0xd0,0x07,0xc0,0x1e,0x40,0x00,
-0xe4,0x8b,0x00,0x00,0x5d,0xe2,0x00,0x00,0x0d,0x90,0x00,0x00,0x0b,0x80,0x04,0x00,
-0xf0,0x08,0x6f,0xff,0xff,0xf1,0x00,0x00,0x0b,0xa0,0x00,0x00,0x7d,0x00,0x00,0x03,
-0xf3,0x00,0x00,0x0d,0x70,0x00,0x00,0x9c,0x00,0x17,0x05,0x40,0x00,0x1e,0x50,0x00,
-0xa7,0x04,0x5f,0xf4,0x1f,0xf4,0x1f,0x10,0x02,0x00,0x02,0xf0,0x00,0xf4,0x89,0x00,
-0x00,0x2e,0x00,0x00,0x0c,0x50,0x00,0x06,0xb0,0x00,0x00,0xf1,0x0a,0x04,0x00,0xcf,
-0x04,0xca,0x0d,0x40,0x00,0x07,0xa0,0x00,0x01,0xf1,0xef,0x70,0xb7,0x0b,0x03,0x00,
-0xf1,0x22,0xef,0x70,0x00,0x61,0x00,0x2f,0x80,0x08,0x9e,0x00,0xe1,0xa5,0x6b,0x04,
-0xc0,0xef,0xff,0xfc,0x4f,0x20,0x06,0xb0,0x02,0xcf,0xd4,0x00,0xf5,0x06,0xf0,0x02,
-0x00,0x1f,0x10,0x4b,0xdd,0xf2,0x2f,0x30,0x1f,0x23,0xf3,0x17,0xf2,0x08,0xee,0x7d,
-0x30,0x1f,0x10,0xbf,0x05,0x00,0x07,0x00,0xe0,0xf8,0xee,0x70,0x1f,0x80,0x3f,0x41,
-0xf1,0x00,0x99,0x1f,0x10,0x07,0xa1,0x07,0x00,0x60,0x80,0x3f,0x41,0xf7,0xee,0x70,
-0x3c,0x00,0xf0,0x02,0xe7,0x04,0xf1,0x4e,0x00,0x05,0x26,0xc0,0x00,0x00,0x4e,0x00,
-0x03,0x10,0xe6,0x03,0xe2,0x15,0x00,0x10,0x00,0xba,0x06,0x20,0x00,0xc6,0x07,0x00,
-0xd0,0x3c,0xfa,0xd6,0x0e,0x80,0x4f,0x64,0xe0,0x00,0xc6,0x5c,0x00,0x0c,0x07,0x00,
-0xd0,0x0e,0x60,0x3f,0x60,0x3c,0xeb,0xc6,0x02,0xbf,0xd3,0x00,0xd7,0x05,0x43,0x05,
-0x60,0x46,0xff,0xff,0xf6,0x4d,0x00,0xea,0x0d,0xf6,0x05,0x91,0x02,0xbf,0xe7,0x00,
-0x00,0x9d,0x60,0x5d,0x20,0x08,0xa0,0x09,0xff,0xe1,0x08,0xa0,0x00,0x8a,0x00,0x05,
-0x00,0xf0,0x02,0x03,0xcf,0xac,0x60,0xe7,0x04,0xf6,0x4e,0x00,0x0c,0x65,0xd0,0x00,
-0xc6,0x4e,0x00,0x0c,0x0e,0x00,0xe7,0x03,0xcf,0xad,0x60,0x00,0x00,0xd5,0x0c,0x30,
-0x6f,0x10,0x4d,0xfc,0x40,0xb4,0x00,0xe6,0xf7,0xde,0x70,0x1f,0x90,0x4f,0x21,0xf1,
-0x00,0xe4,0x1f,0x10,0x0e,0x41,0x07,0x00,0x64,0x0e,0x20,0x30,0x0f,0x20,0xf2,0x03,
-0x00,0x6a,0x01,0xe1,0x00,0x40,0x01,0xf1,0x02,0x00,0x47,0x04,0xf0,0x5f,0x80,0x49,
-0x00,0xf7,0x09,0xf1,0x09,0xc0,0x1f,0x18,0xd1,0x01,0xf8,0xe1,0x00,0x1f,0xfe,0x10,
-0x01,0xf3,0xab,0x00,0x1f,0x10,0xd7,0x01,0xf1,0x03,0xf3,0x46,0x00,0x00,0x03,0x00,
-0xfc,0x07,0x2f,0x7e,0xf7,0x5e,0xfa,0x02,0xf8,0x04,0xfb,0x12,0xe5,0x2f,0x10,0x0e,
-0x40,0x0a,0x82,0xf1,0x00,0xe4,0x00,0xa8,0x0b,0x00,0x89,0x80,0x1f,0x6d,0xe7,0x01,
-0xf9,0x04,0xf2,0x94,0x00,0x00,0x07,0x00,0xf5,0x23,0x40,0x02,0xbf,0xd5,0x00,0xd8,
-0x03,0xe4,0x4e,0x00,0x08,0xa6,0xc0,0x00,0x6c,0x4e,0x00,0x08,0xb0,0xd7,0x03,0xe5,
-0x02,0xbf,0xd6,0x00,0x1f,0x8d,0xe7,0x01,0xf6,0x02,0xf4,0x1f,0x10,0x09,0x91,0xf1,
-0x00,0x8a,0x1f,0x10,0x0a,0x91,0xf7,0x03,0xf3,0x1f,0x9e,0xe7,0xa0,0x00,0x54,0x00,
-0x00,0x03,0xcf,0xbc,0x1a,0x01,0x13,0xc0,0x1a,0x01,0x54,0x03,0xf6,0x03,0xcf,0xbd,
-0x84,0x01,0x01,0x07,0x00,0xa4,0x01,0xf9,0xf3,0x1f,0x81,0x01,0xf1,0x00,0x1f,0x10,
-0x05,0x00,0xf2,0x12,0x05,0xdf,0xc3,0x00,0xf4,0x08,0xd0,0x0f,0x60,0x01,0x00,0x3b,
-0xeb,0x30,0x12,0x00,0x7e,0x03,0xf3,0x05,0xe0,0x06,0xdf,0xd4,0x00,0x05,0x30,0x0b,
-0x70,0xdf,0xfb,0x0b,0x70,0x02,0x00,0xb3,0x0a,0x90,0x04,0xeb,0x2f,0x00,0x0e,0x42,
-0xf0,0x00,0xe4,0x07,0x00,0xf0,0x63,0x1f,0x00,0x0e,0x40,0xf6,0x06,0xf4,0x05,0xee,
-0x9e,0x40,0x99,0x00,0x4e,0x04,0xe0,0x0a,0x80,0x0e,0x30,0xe2,0x00,0x89,0x4d,0x00,
-0x03,0xe9,0x70,0x00,0x0d,0xf2,0x00,0x00,0x7c,0x00,0x00,0x99,0x00,0xc7,0x00,0xd5,
-0x4d,0x01,0xfc,0x01,0xf0,0x0f,0x15,0x9e,0x15,0xc0,0x0b,0x5a,0x49,0x69,0x70,0x07,
-0xae,0x04,0xbd,0x20,0x02,0xfa,0x00,0xee,0x00,0x00,0xe5,0x00,0xa9,0x00,0x5e,0x10,
-0x9c,0x00,0xb9,0x3f,0x20,0x01,0xed,0x70,0x00,0x09,0xf0,0x00,0x02,0xfc,0x80,0x00,
-0xb8,0x2f,0x30,0x6e,0x00,0x8c,0x00,0xb9,0x00,0x6d,0x5e,0x00,0xb7,0x0f,0x40,0xf2,
-0x0a,0x95,0xd0,0x04,0xea,0x70,0x00,0xef,0x20,0x16,0x03,0xb1,0x97,0x00,0x03,0xe1,
-0x00,0x6e,0x60,0x00,0x6f,0xff,0xfd,0x1f,0x03,0x50,0x0c,0x90,0x00,0x08,0xd0,0x8f,
-0x03,0x30,0x01,0xe6,0x00,0x4b,0x03,0xf0,0x05,0x00,0x00,0x08,0x10,0x0b,0x80,0x02,
-0xf0,0x00,0x3e,0x00,0x04,0xe0,0x00,0x9b,0x00,0x9f,0x30,0x00,0x8b,0x0a,0x00,0x40,
-0x3e,0x00,0x02,0xf0,0x6e,0x03,0x36,0x08,0x10,0xe1,0x01,0x00,0xf5,0x18,0x72,0x00,
-0x3e,0x20,0x0a,0x80,0x08,0x90,0x08,0xa0,0x05,0xd1,0x00,0xcf,0x05,0xd1,0x08,0xa0,
-0x08,0x90,0x0a,0x80,0x3e,0x20,0x73,0x00,0x03,0xdc,0x20,0x0d,0x00,0xe5,0x6e,0x25,
-0xb0,0x1c,0x00,0x6f,0xe3,0x2c,0x11,0x00,0x05,0x00,0x10,0x4f,0xca,0x07,0xf0,0x10,
+0x00,0x67,0x23,0x60,0x00,0x60,0xad,0x23,0x10,0x0d,0x0e,0x09,0x60,0x06,0xf8,0x6e,
+0x2e,0x1a,0x71,0x1c,0x0d,0xea,0x14,0xea,0x17,0xea,0x18,0xea,0x19,0xea,0x1d,0xea,
+0x1f,0xea,0x21,0xea,0x25,0xea,0x28,0xea,0x2d,0xea,0x32,0xea,0x33,0xea,0x34,0xea,
+0x4a,0xea,0x4f,0xea,0x54,0xea,0x57,0xea,0x58,0xea,0x59,0xea,0x5d,0xea,0x5e,0xea,
+0x5f,0xea,0x60,0xea,0x73,0xea,0x74,0xea,0x7a,0xea,0x7c,0xea,0x7d,0xea,0x80,0xea,
+0x83,0xea,0x84,0xea,0x85,0xea,0x87,0xea,0x9f,0xea,0xa1,0xea,0xd0,0xea,0xd1,0xea,
+0xd3,0xea,0xd5,0xea,0xec,0xea,0xf3,0xea,0xf6,0xea,0xff,0xea,0x28,0xeb,0x30,0xeb,
+0x67,0xeb,0xf7,0xeb,0x4c,0xec,0x4d,0xec,0x4e,0xec,0x4f,0xec,0x50,0xec,0x93,0xec,
+0x9f,0xec,0xf9,0xec,0x10,0xed,0x66,0xef,0xce,0xf1,0xae,0xf2,0x00,0x01,0x00,0x2f,
+0xfc,0x00,0x01,0x00,0x03,0x13,0xf5,0x08,0x00,0x17,0xf4,0x14,0x00,0xce,0xfb,0xfa,
+0x00,0xfe,0xfa,0x00,0xf8,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x4e,0x02,0x02,0x00,
+0x02,0x16,0x00,0x2f,0xef,0x00,0x01,0x00,0x15,0x1f,0xe9,0x1e,0x00,0x0a,0x03,0x88,
+0x00,0xb1,0xfa,0x00,0xff,0x00,0x00,0xf3,0xfe,0xf7,0xf9,0x00,0xf6,0x11,0x00,0x00,
+0x0f,0x00,0x4d,0xfe,0xff,0xfb,0xfd,0x92,0x00,0x30,0xfd,0x00,0xfe,0x2e,0x00,0x1e,
+0x00,0x01,0x00,0x1c,0xfd,0x0a,0x00,0x19,0xff,0x1f,0x00,0x12,0xfe,0x07,0x00,0x13,
+0xf6,0x0b,0x00,0x00,0x48,0x00,0x3f,0xfe,0xfc,0xfe,0x9c,0x00,0x0a,0x15,0x02,0x3c,
+0x00,0x11,0xfe,0x34,0x00,0x26,0xfe,0xfd,0x30,0x00,0x11,0xe8,0x04,0x01,0x15,0xe5,
+0x24,0x00,0x20,0xfd,0xfe,0x20,0x00,0x01,0x2b,0x00,0x0d,0x44,0x00,0x10,0xfd,0x08,
+0x00,0x1f,0xfd,0x68,0x00,0x07,0x1f,0xfe,0x43,0x01,0x0d,0x19,0xfa,0xdf,0x00,0x01,
+0xbd,0x00,0x10,0xfd,0x38,0x00,0x12,0xfc,0x09,0x01,0x14,0xde,0x6c,0x00,0x97,0xf9,
+0x00,0x00,0xe4,0xfb,0xee,0xf1,0x00,0xe8,0x08,0x02,0x25,0xf2,0xf7,0x0c,0x00,0x73,
+0xdf,0x00,0x00,0x00,0xf2,0x00,0xec,0x43,0x00,0x41,0xfd,0x00,0xff,0xff,0x25,0x01,
+0x1f,0x01,0xe0,0x01,0x01,0x10,0xfc,0xd2,0x00,0x1f,0xfc,0x97,0x00,0x0b,0x10,0xf8,
+0xba,0x00,0x1e,0xfb,0x3b,0x00,0x00,0x05,0x00,0x93,0xea,0xe8,0x00,0x00,0xf8,0xfd,
+0xe8,0xfe,0x02,0x40,0x02,0xd3,0xf5,0xf6,0x00,0xf5,0xf6,0xf8,0xf4,0x00,0xf6,0xf9,
+0xfa,0xf8,0xfa,0x1a,0x01,0x66,0xe9,0xfc,0x00,0x00,0xf8,0xff,0x2b,0x01,0xa4,0xfb,
+0xfc,0x00,0x00,0xfb,0xfd,0x00,0x00,0xfd,0xff,0x7d,0x01,0x42,0x02,0x00,0xf4,0xfa,
+0x51,0x00,0x03,0x08,0x02,0x33,0x01,0xfd,0xfd,0x6c,0x01,0x17,0x00,0xaf,0x02,0x14,
+0xfb,0x20,0x01,0x15,0x01,0x01,0x02,0x02,0xb0,0x01,0x04,0x30,0x01,0xf0,0x0a,0x02,
+0xfb,0xeb,0xfb,0x00,0x00,0xf6,0xfd,0xf6,0xfe,0x02,0xf6,0x02,0x02,0x01,0x02,0x00,
+0x02,0xf9,0xf9,0xfe,0xfc,0xf9,0xfc,0xfa,0x03,0x02,0x36,0xfe,0xfd,0x02,0xc5,0x00,
+0x2a,0x01,0xfd,0x99,0x01,0x02,0x48,0x00,0x1e,0xfd,0xb2,0x01,0x0f,0xb5,0x01,0x04,
+0x1e,0xf9,0x31,0x01,0x0d,0xe9,0x01,0x1f,0xfd,0x24,0x00,0x09,0x12,0xff,0x43,0x02,
+0x1f,0xff,0x5a,0x03,0x10,0x1f,0xff,0x1d,0x00,0x10,0x1e,0x02,0xdd,0x01,0x19,0x02,
+0xbc,0x00,0x16,0x02,0x14,0x04,0x0f,0x01,0x00,0x1e,0x0b,0x04,0x01,0x1f,0xf2,0x2c,
+0x00,0x0b,0x23,0xfe,0xfe,0xd7,0x01,0x1c,0xf4,0x31,0x02,0x11,0xfe,0x93,0x00,0x10,
+0x05,0x2b,0x02,0x0f,0x6f,0x00,0x15,0x2e,0x02,0x00,0xb8,0x00,0x3d,0xfe,0xff,0x01,
+0x97,0x01,0x1f,0xf3,0xd8,0x00,0x24,0x1f,0xfe,0x24,0x00,0x26,0x0f,0x3d,0x00,0x07,
+0x13,0x01,0xd5,0x02,0x00,0x8c,0x0c,0x4d,0x04,0x00,0x04,0x05,0x21,0x00,0x30,0x06,
+0x07,0x08,0xc0,0x07,0xf1,0x05,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,
+0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,0xff,0x0d,0x1a,0x1b,
+0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,
+0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x00,0x01,0x00,0x5e,0x02,0xce,0x00,
+0x20,0x03,0x02,0xc9,0x00,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,
+0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xf1,0x08,0x0b,0x00,0x0d,
+0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,
+0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,
+0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x8f,0x00,0x1e,0x1f,0x24,0xc8,0x00,
+0x25,0x50,0x00,0x00,0x00,0x00,0x00,0xf0,0xe4,0xe4,0xe4,0xe4,0xe3,0xe3,0xd3,0x82,
+0x30,0xd4,0x2c,0x67,0x2b,0x66,0x29,0x65,0x01,0x00,0x00,0x09,0x50,0xe0,0x00,0x0d,
+0x13,0xa0,0x0a,0xef,0xef,0xec,0x00,0x3a,0x0a,0x40,0x00,0x77,0x0d,0x00,0x3d,0xfe,
+0xdf,0xd4,0x00,0xd1,0x3a,0x00,0x00,0xe0,0x68,0x00,0x02,0xc0,0x95,0x00,0x00,0x0a,
+0x40,0x00,0x05,0xda,0x20,0x08,0xd7,0xae,0x10,0xe4,0x00,0xc6,0x0d,0x70,0x03,0x20,
+0x5f,0xa4,0x00,0x00,0x28,0xeb,0x00,0x00,0x01,0xd7,0x3f,0x00,0x09,0x80,0xd9,0x46,
+0xf4,0x01,0x9f,0xb4,0x00,0x00,0xc2,0x00,0x0a,0xcb,0x00,0x00,0x04,0xa0,0x86,0x09,
+0x10,0x4a,0x08,0x64,0x90,0x00,0x8c,0xa1,0xc0,0x00,0x00,0x00,0xa4,0x00,0x00,0x00,
+0x4a,0x3b,0xb4,0x00,0x1c,0x1c,0x21,0xd0,0x09,0x50,0xc2,0x0d,0x00,0x00,0x04,0xcc,
+0x50,0x00,0xbf,0xd4,0x00,0x00,0x7c,0x06,0xd0,0x00,0x08,0xb0,0x7b,0x00,0x00,0x1e,
+0xbc,0x10,0x00,0x03,0xef,0x40,0x22,0x01,0xf4,0x4e,0x2a,0x60,0x5d,0x00,0x7d,0xe2,
+0x01,0xf3,0x01,0xee,0x00,0x04,0xcd,0xd8,0xc9,0x00,0x59,0x58,0x58,0x00,0x00,0x02,
+0x00,0x02,0xd1,0x00,0xd3,0x00,0x6b,0x00,0x0c,0x60,0x00,0xf2,0x00,0x1f,0x00,0x02,
+0xf0,0x00,0x1f,0x20,0x00,0xe3,0x00,0x09,0x80,0x00,0x2d,0x00,0x00,0x88,0x00,0x00,
+0xa1,0x20,0x00,0x88,0x00,0x0c,0x40,0x05,0xd0,0x00,0xe3,0x00,0xb6,0x00,0x98,0x00,
+0x99,0x00,0xa8,0x00,0xc5,0x01,0xf1,0x07,0x90,0x2d,0x10,0x83,0x82,0x00,0xf2,0x12,
+0x42,0xa4,0x31,0x6d,0xfe,0xc3,0x04,0xdc,0x00,0x0e,0x2a,0x70,0x01,0x01,0x10,0x00,
+0x0a,0x20,0x00,0x00,0xe4,0x00,0x00,0x0e,0x40,0x07,0xff,0xff,0xfc,0x12,0x2e,0x52,
+0x10,0x0e,0x00,0xf0,0x30,0x00,0x3f,0x4d,0x96,0x00,0xbf,0xf5,0x04,0x00,0xe3,0x00,
+0x03,0xc0,0x00,0x96,0x00,0x0e,0x00,0x06,0xa0,0x00,0xc3,0x00,0x2d,0x00,0x08,0x70,
+0x00,0xe1,0x00,0x5b,0x00,0x0b,0x50,0x00,0x02,0xcf,0xd5,0x00,0xc8,0x04,0xf2,0x2f,
+0x00,0x0b,0x63,0xe0,0x00,0xa8,0x4e,0x00,0x09,0x93,0xe0,0x00,0xa8,0x2f,0x00,0x0b,
+0x60,0xc8,0x03,0xf1,0x1c,0x00,0x77,0x04,0xa9,0xdc,0xca,0x10,0x8a,0x00,0x02,0x00,
+0xf0,0x19,0x04,0xcf,0xd6,0x01,0xf5,0x04,0xf3,0x4a,0x00,0x0d,0x50,0x00,0x01,0xf1,
+0x00,0x00,0xc7,0x00,0x00,0xba,0x00,0x00,0xaa,0x00,0x00,0x9b,0x00,0x00,0x3f,0xff,
+0xff,0xc0,0x04,0xcf,0xd4,0x01,0xf5,0x04,0xf1,0x26,0x80,0x00,0xf0,0x25,0x05,0xe1,
+0x00,0x8f,0xf5,0x00,0x00,0x04,0xf3,0x25,0x00,0x0c,0x62,0xf3,0x03,0xf3,0x05,0xdf,
+0xd5,0x00,0x00,0x00,0xdb,0x00,0x00,0x08,0xfb,0x00,0x00,0x3e,0x8b,0x00,0x00,0xc5,
+0x7b,0x00,0x07,0xa0,0x7b,0x00,0x2e,0x10,0x7b,0x00,0x9f,0xff,0xff,0xf0,0x00,0x00,
+0x7b,0x00,0x04,0x00,0xf1,0x50,0x04,0xff,0xff,0x80,0x6c,0x11,0x10,0x07,0x90,0x00,
+0x00,0x9d,0xdd,0x70,0x05,0x72,0x4e,0x60,0x00,0x00,0x7b,0x07,0x10,0x07,0xb0,0xb9,
+0x01,0xd6,0x01,0xae,0xe8,0x00,0x00,0x3b,0xf5,0x00,0x3f,0x71,0x00,0x0b,0x70,0x00,
+0x00,0xf9,0xee,0x70,0x2f,0x90,0x3e,0x52,0xf0,0x00,0x99,0x0f,0x20,0x08,0x90,0xab,
+0x02,0xe4,0x00,0xae,0xe6,0x00,0x7f,0xff,0xff,0xb0,0x00,0x00,0xc5,0x00,0x00,0x3d,
+0x00,0x00,0x0b,0x60,0x00,0x03,0xe0,0x00,0x00,0xa8,0x00,0x00,0x2f,0x10,0x00,0x09,
+0x90,0x00,0x01,0xf2,0x00,0xf6,0x00,0xf0,0x31,0xd8,0x04,0xf2,0x0f,0x20,0x0d,0x50,
+0xc8,0x04,0xe1,0x02,0xff,0xf6,0x00,0xe6,0x03,0xe3,0x3e,0x00,0x0a,0x81,0xf5,0x02,
+0xe5,0x04,0xcf,0xe7,0x00,0x03,0xcf,0xc2,0x00,0xe6,0x07,0xe0,0x4e,0x00,0x0d,0x44,
+0xd0,0x00,0xb6,0x1f,0x60,0x5f,0x60,0x4d,0xf9,0xd5,0x00,0x00,0x1f,0x10,0x00,0x3c,
+0x90,0x01,0xfd,0x70,0x00,0x0e,0x30,0x50,0x00,0x01,0x00,0x51,0x40,0x1e,0x30,0x2e,
+0x10,0x0b,0x00,0xf0,0x11,0x01,0x90,0x2f,0x06,0xb0,0x41,0x00,0x00,0x00,0x68,0x01,
+0x8e,0xc4,0x6e,0x92,0x00,0x4d,0xc5,0x00,0x00,0x4c,0xe6,0x00,0x00,0x36,0x0e,0xee,
+0xee,0x30,0x11,0x11,0x10,0x24,0x00,0xf0,0x33,0xee,0xee,0xe3,0x01,0x11,0x11,0x00,
+0x2a,0x30,0x00,0x00,0x7d,0xc5,0x00,0x00,0x04,0xae,0x20,0x02,0x8e,0xa1,0x1b,0xf9,
+0x20,0x01,0x71,0x00,0x00,0x08,0xee,0xa0,0x5e,0x21,0xd7,0x12,0x00,0x99,0x00,0x02,
+0xe4,0x00,0x1e,0x70,0x00,0x9a,0x00,0x00,0x43,0x00,0x00,0x21,0x00,0x00,0xa7,0x00,
+0x00,0x03,0xbd,0xdc,0x70,0x00,0x00,0x6b,0x20,0x00,0x7b,0xc7,0x01,0xf1,0x1a,0x00,
+0x07,0x60,0x0a,0x30,0x2b,0xd9,0x00,0xb0,0x0e,0x00,0xd4,0x0e,0x00,0xc0,0x2b,0x04,
+0xb0,0x0e,0x00,0xc0,0x3a,0x07,0x80,0x1c,0x00,0xc0,0x2b,0x06,0x90,0x6c,0x04,0x90,
+0x0e,0x01,0xcb,0x5b,0xca,0x10,0x09,0x60,0x97,0x00,0xf0,0x21,0xd6,0x00,0x02,0x00,
+0x00,0x00,0x18,0xcc,0xda,0x00,0x00,0x00,0x07,0xf0,0x00,0x00,0x00,0xdc,0x50,0x00,
+0x00,0x4b,0x4c,0x00,0x00,0x0a,0x50,0xd2,0x00,0x01,0xd0,0x07,0x80,0x00,0x7f,0xee,
+0xee,0x00,0x0d,0x31,0x11,0xb5,0x03,0xe0,0x00,0x06,0xb0,0xa9,0xe5,0x00,0xf0,0x21,
+0xef,0xff,0xc3,0x0e,0x40,0x18,0xe0,0xe4,0x00,0x2f,0x1e,0x40,0x09,0xc0,0xef,0xff,
+0xf4,0x0e,0x40,0x05,0xf1,0xe4,0x00,0x0e,0x5e,0x40,0x05,0xf2,0xef,0xff,0xd4,0x00,
+0x00,0x7d,0xfd,0x60,0x08,0xe4,0x04,0xe5,0x0f,0x40,0x00,0x7b,0x3f,0x00,0x00,0x00,
+0x04,0x00,0xf2,0x27,0x2f,0x00,0x00,0x00,0x0f,0x40,0x00,0x7a,0x07,0xd3,0x03,0xe5,
+0x00,0x7e,0xfd,0x60,0xef,0xfe,0x91,0x0e,0x40,0x2a,0xd0,0xe4,0x00,0x0d,0x6e,0x40,
+0x00,0x8a,0xe4,0x00,0x07,0xbe,0x40,0x00,0x9a,0xe4,0x00,0x0d,0x7e,0x40,0x2a,0xd0,
+0xef,0xfe,0x91,0x00,0xef,0xff,0xfe,0xe4,0x00,0x00,0x03,0x00,0x37,0xef,0xff,0xf4,
+0x0c,0x00,0x47,0xff,0xef,0xff,0xfc,0x0f,0x00,0x15,0xf2,0x0c,0x00,0x20,0xe4,0x00,
+0x7a,0x00,0xb0,0x70,0x07,0xd4,0x03,0xd8,0x0f,0x40,0x00,0x36,0x2f,0x10,0x7a,0x00,
+0xf8,0x07,0x7f,0xfe,0x2f,0x10,0x00,0x5e,0x0e,0x50,0x00,0x5e,0x06,0xe4,0x01,0xad,
+0x00,0x6d,0xfe,0xa2,0xe4,0x00,0x00,0xf2,0x04,0x00,0x4c,0xef,0xff,0xff,0xf2,0x14,
+0x00,0x14,0xd6,0x01,0x00,0x10,0x00,0x79,0x03,0x2a,0x01,0xf2,0x07,0x00,0xf8,0x20,
+0x55,0x00,0x1f,0x26,0xe2,0x09,0xd0,0x08,0xef,0xb2,0x00,0xe4,0x00,0x2e,0x60,0xe4,
+0x01,0xd7,0x00,0xe4,0x1d,0x90,0x00,0xe5,0xca,0x00,0x00,0xee,0xfa,0x00,0x00,0xeb,
+0x2e,0x60,0x00,0xe4,0x04,0xf3,0x00,0xe4,0x00,0x7e,0x10,0xe4,0x00,0x0a,0xb0,0xa1,
+0x00,0x08,0x03,0x00,0xf0,0x22,0xef,0xff,0xfa,0xed,0x00,0x00,0x08,0xf4,0xef,0x40,
+0x00,0x0e,0xf4,0xeb,0xa0,0x00,0x5d,0xd4,0xe5,0xf1,0x00,0xc6,0xe4,0xe4,0xa7,0x02,
+0xf0,0xe4,0xe4,0x4e,0x09,0x90,0xf4,0xe4,0x0d,0x5e,0x20,0xf4,0xe4,0x06,0xfc,0x00,
+0xf4,0xe4,0x00,0xf5,0x00,0xf4,0xea,0xad,0x00,0xf0,0x27,0x40,0x00,0xf2,0xeb,0xe1,
+0x00,0xf2,0xe4,0xba,0x00,0xf2,0xe4,0x1f,0x50,0xf2,0xe4,0x06,0xe1,0xf2,0xe4,0x00,
+0xba,0xf2,0xe4,0x00,0x1f,0xf2,0xe4,0x00,0x06,0xf2,0x00,0x6d,0xfd,0x60,0x00,0x7e,
+0x41,0x5e,0x60,0x0f,0x50,0x00,0x6e,0x02,0xf0,0x00,0x01,0xf1,0x3f,0x00,0x00,0x0f,
+0x22,0x09,0x00,0x91,0x0f,0x50,0x00,0x5e,0x00,0x7e,0x41,0x4e,0x60,0x24,0x00,0xf3,
+0x04,0xef,0xff,0xd7,0x0e,0x40,0x03,0xe6,0xe4,0x00,0x08,0xae,0x40,0x02,0xd7,0xef,
+0xff,0xd8,0x0e,0x40,0x23,0x04,0x01,0x49,0x01,0x00,0x4a,0x01,0xf0,0x05,0x50,0x00,
+0x8e,0x41,0x5f,0x50,0x0f,0x40,0x00,0x7d,0x03,0xf0,0x00,0x02,0xf0,0x4e,0x00,0x00,
+0x1f,0x13,0x09,0x00,0xc0,0x0f,0x40,0x00,0x6d,0x00,0x8d,0x41,0x5e,0x50,0x00,0x7d,
+0xff,0xf1,0x04,0x10,0x1c,0x05,0x00,0xf0,0x21,0x03,0x00,0xff,0xff,0xc4,0x0f,0x40,
+0x06,0xf2,0xf4,0x00,0x0e,0x5f,0x40,0x06,0xf2,0xff,0xff,0xe3,0x0f,0x40,0x4e,0x00,
+0xf4,0x00,0xc8,0x0f,0x40,0x04,0xf1,0xf4,0x00,0x0c,0x80,0x02,0xbf,0xfa,0x10,0x0e,
+0x81,0x19,0xd0,0x2f,0x10,0x00,0xb1,0x0c,0xb3,0x62,0x00,0xf1,0x07,0xe8,0x00,0x00,
+0x00,0x2b,0xd0,0x48,0x00,0x00,0xf2,0x2f,0x60,0x07,0xf0,0x03,0xbf,0xfb,0x30,0xbf,
+0xff,0xff,0xf7,0xb6,0x03,0x0f,0x04,0x00,0x07,0x00,0x65,0x03,0x1f,0xa9,0x04,0x00,
+0x01,0xf0,0x1b,0x0f,0x20,0x00,0xb7,0x0b,0xb2,0x05,0xf2,0x01,0x9e,0xfc,0x40,0xaa,
+0x00,0x00,0x6e,0x04,0xf0,0x00,0x0c,0x80,0x0d,0x50,0x01,0xf2,0x00,0x8b,0x00,0x7c,
+0x00,0x01,0xf1,0x0c,0x60,0x00,0x0b,0x62,0xf0,0x00,0x00,0x5b,0x7a,0x6b,0x03,0x50,
+0x30,0x00,0x00,0x09,0xd0,0x4b,0x04,0x20,0x0d,0x70,0x24,0x01,0xf5,0x5e,0x1f,0xc0,
+0x05,0xe0,0x0f,0x30,0x6b,0xf1,0x08,0xa0,0x0b,0x60,0xb6,0xb5,0x0c,0x60,0x07,0xa0,
+0xf1,0x6a,0x0f,0x20,0x03,0xe4,0xc0,0x1e,0x4e,0x00,0x00,0xfa,0x70,0x0d,0xaa,0x00,
+0x00,0xcf,0x20,0x08,0xf6,0x00,0x00,0x8e,0x00,0x03,0xf2,0x00,0x3f,0x30,0x01,0xe6,
+0x09,0xc0,0x0a,0xb0,0x00,0xe6,0x4f,0x20,0x00,0x4f,0xd7,0x00,0x00,0x0c,0xf0,0x00,
+0x00,0x5f,0xd7,0x00,0x01,0xe6,0x4f,0x20,0x0a,0xc0,0x09,0xc0,0x4f,0x20,0x01,0xe7,
+0xab,0x00,0x00,0xe6,0x1f,0x40,0x07,0xd0,0x07,0xc0,0x1e,0x40,0x00,0xe4,0x8b,0x00,
+0x00,0x5d,0xe2,0x00,0x00,0x0d,0x90,0x00,0x00,0x0b,0x80,0x04,0x00,0xf0,0x08,0x6f,
+0xff,0xff,0xf1,0x00,0x00,0x0b,0xa0,0x00,0x00,0x7d,0x00,0x00,0x03,0xf3,0x00,0x00,
+0x0d,0x70,0x00,0x00,0x9c,0x00,0x17,0x05,0x40,0x00,0x1e,0x50,0x00,0xa7,0x04,0x5f,
+0xf4,0x1f,0xf4,0x1f,0x10,0x02,0x00,0x02,0xf0,0x00,0xf4,0x89,0x00,0x00,0x2e,0x00,
+0x00,0x0c,0x50,0x00,0x06,0xb0,0x00,0x00,0xf1,0x0a,0x04,0x00,0xcf,0x04,0xca,0x0d,
+0x40,0x00,0x07,0xa0,0x00,0x01,0xf1,0xef,0x70,0xb7,0x0b,0x03,0x00,0xf1,0x22,0xef,
+0x70,0x00,0x61,0x00,0x2f,0x80,0x08,0x9e,0x00,0xe1,0xa5,0x6b,0x04,0xc0,0xef,0xff,
+0xfc,0x4f,0x20,0x06,0xb0,0x02,0xcf,0xd4,0x00,0xf5,0x06,0xf0,0x02,0x00,0x1f,0x10,
+0x4b,0xdd,0xf2,0x2f,0x30,0x1f,0x23,0xf3,0x17,0xf2,0x08,0xee,0x7d,0x30,0x1f,0x10,
+0xbf,0x05,0x00,0x07,0x00,0xe0,0xf8,0xee,0x70,0x1f,0x80,0x3f,0x41,0xf1,0x00,0x99,
+0x1f,0x10,0x07,0xa1,0x07,0x00,0x60,0x80,0x3f,0x41,0xf7,0xee,0x70,0x3c,0x00,0xf0,
+0x02,0xe7,0x04,0xf1,0x4e,0x00,0x05,0x26,0xc0,0x00,0x00,0x4e,0x00,0x03,0x10,0xe6,
+0x03,0xe2,0x15,0x00,0x10,0x00,0xba,0x06,0x20,0x00,0xc6,0x07,0x00,0xd0,0x3c,0xfa,
+0xd6,0x0e,0x80,0x4f,0x64,0xe0,0x00,0xc6,0x5c,0x00,0x0c,0x07,0x00,0xd0,0x0e,0x60,
+0x3f,0x60,0x3c,0xeb,0xc6,0x02,0xbf,0xd3,0x00,0xd7,0x05,0x43,0x05,0xf6,0x0f,0x46,
+0xff,0xff,0xf6,0x4d,0x00,0x00,0x00,0xd7,0x01,0x91,0x02,0xbf,0xe7,0x00,0x00,0x9d,
+0x60,0x5d,0x20,0x08,0xa0,0x09,0xff,0xe1,0x08,0xa0,0x00,0x8a,0x00,0x05,0x00,0xf0,
+0x02,0x03,0xcf,0xac,0x60,0xe7,0x04,0xf6,0x4e,0x00,0x0c,0x65,0xd0,0x00,0xc6,0x4e,
+0x00,0x0c,0x0e,0x00,0xe7,0x03,0xcf,0xad,0x60,0x00,0x00,0xd5,0x0c,0x30,0x6f,0x10,
+0x4d,0xfc,0x40,0xb4,0x00,0xe6,0xf7,0xde,0x70,0x1f,0x90,0x4f,0x21,0xf1,0x00,0xe4,
+0x1f,0x10,0x0e,0x41,0x07,0x00,0x64,0x0e,0x20,0x30,0x0f,0x20,0xf2,0x03,0x00,0x6a,
+0x01,0xe1,0x00,0x40,0x01,0xf1,0x02,0x00,0x47,0x04,0xf0,0x5f,0x80,0x49,0x00,0xf7,
+0x09,0xf1,0x09,0xc0,0x1f,0x18,0xd1,0x01,0xf8,0xe1,0x00,0x1f,0xfe,0x10,0x01,0xf3,
+0xab,0x00,0x1f,0x10,0xd7,0x01,0xf1,0x03,0xf3,0x46,0x00,0x00,0x03,0x00,0xfc,0x07,
+0x2f,0x7e,0xf7,0x5e,0xfa,0x02,0xf8,0x04,0xfb,0x12,0xe5,0x2f,0x10,0x0e,0x40,0x0a,
+0x82,0xf1,0x00,0xe4,0x00,0xa8,0x0b,0x00,0x89,0x80,0x1f,0x6d,0xe7,0x01,0xf9,0x04,
+0xf2,0x94,0x00,0x00,0x07,0x00,0xf5,0x23,0x40,0x02,0xbf,0xd5,0x00,0xd8,0x03,0xe4,
+0x4e,0x00,0x08,0xa6,0xc0,0x00,0x6c,0x4e,0x00,0x08,0xb0,0xd7,0x03,0xe5,0x02,0xbf,
+0xd6,0x00,0x1f,0x8d,0xe7,0x01,0xf6,0x02,0xf4,0x1f,0x10,0x09,0x91,0xf1,0x00,0x8a,
+0x1f,0x10,0x0a,0x91,0xf7,0x03,0xf3,0x1f,0x9e,0xe7,0xa0,0x00,0x54,0x00,0x00,0x03,
+0xcf,0xbc,0x1a,0x01,0x13,0xc0,0x1a,0x01,0x54,0x03,0xf6,0x03,0xcf,0xbd,0x84,0x01,
+0x01,0x07,0x00,0xa4,0x01,0xf9,0xf3,0x1f,0x81,0x01,0xf1,0x00,0x1f,0x10,0x05,0x00,
+0xf2,0x12,0x05,0xdf,0xc3,0x00,0xf4,0x08,0xd0,0x0f,0x60,0x01,0x00,0x3b,0xeb,0x30,
+0x12,0x00,0x7e,0x03,0xf3,0x05,0xe0,0x06,0xdf,0xd4,0x00,0x05,0x30,0x0b,0x70,0xdf,
+0xfb,0x0b,0x70,0x02,0x00,0xb3,0x0a,0x90,0x04,0xeb,0x2f,0x00,0x0e,0x42,0xf0,0x00,
+0xe4,0x07,0x00,0xf0,0x63,0x1f,0x00,0x0e,0x40,0xf6,0x06,0xf4,0x05,0xee,0x9e,0x40,
+0x99,0x00,0x4e,0x04,0xe0,0x0a,0x80,0x0e,0x30,0xe2,0x00,0x89,0x4d,0x00,0x03,0xe9,
+0x70,0x00,0x0d,0xf2,0x00,0x00,0x7c,0x00,0x00,0x99,0x00,0xc7,0x00,0xd5,0x4d,0x01,
+0xfc,0x01,0xf0,0x0f,0x15,0x9e,0x15,0xc0,0x0b,0x5a,0x49,0x69,0x70,0x07,0xae,0x04,
+0xbd,0x20,0x02,0xfa,0x00,0xee,0x00,0x00,0xe5,0x00,0xa9,0x00,0x5e,0x10,0x9c,0x00,
+0xb9,0x3f,0x20,0x01,0xed,0x70,0x00,0x09,0xf0,0x00,0x02,0xfc,0x80,0x00,0xb8,0x2f,
+0x30,0x6e,0x00,0x8c,0x00,0xb9,0x00,0x6d,0x5e,0x00,0xb7,0x0f,0x40,0xf2,0x0a,0x95,
+0xd0,0x04,0xea,0x70,0x00,0xef,0x20,0x16,0x03,0xb1,0x97,0x00,0x03,0xe1,0x00,0x6e,
+0x60,0x00,0x6f,0xff,0xfd,0x1f,0x03,0x50,0x0c,0x90,0x00,0x08,0xd0,0x8f,0x03,0x30,
+0x01,0xe6,0x00,0x4b,0x03,0xf0,0x05,0x00,0x00,0x08,0x10,0x0b,0x80,0x02,0xf0,0x00,
+0x3e,0x00,0x04,0xe0,0x00,0x9b,0x00,0x9f,0x30,0x00,0x8b,0x0a,0x00,0x40,0x3e,0x00,
+0x02,0xf0,0x6e,0x03,0x36,0x08,0x10,0xe1,0x01,0x00,0xf3,0x19,0x72,0x00,0x3e,0x20,
+0x0a,0x80,0x08,0x90,0x08,0xa0,0x05,0xd1,0x00,0xcf,0x05,0xd1,0x08,0xa0,0x08,0x90,
+0x0a,0x80,0x3e,0x20,0x73,0x00,0x03,0xdc,0x20,0x0d,0x00,0xe5,0x6e,0x25,0xb0,0x1c,
+0x00,0x6f,0xe3,0x00,0x01,0x00,0x10,0x30,0x05,0x00,0x10,0x4f,0xca,0x07,0xf0,0x10,
 0x04,0xee,0x40,0x0c,0xff,0xff,0xfc,0x3e,0x40,0xe4,0x22,0x22,0x00,0x4e,0x3e,0x20,
 0x00,0x00,0x00,0x8d,0xe3,0x11,0x11,0x00,0x3e,0x4d,0xff,0xff,0xfb,0x3e,0x40,0x21,
 0x00,0x10,0x50,0x2c,0x00,0x10,0x60,0x5e,0x07,0x15,0x40,0x3c,0x00,0x10,0x5f,0x0b,
-0x00,0x20,0x4e,0xe4,0x05,0x00,0x11,0x3c,0x3f,0x00,0x50,0x02,0x22,0x24,0xed,0x80,
-0x1e,0x0b,0xd1,0x4e,0x30,0x01,0x11,0x13,0xe0,0x4e,0x3b,0xff,0xff,0xfd,0x00,0x5e,
-0x7b,0x05,0x21,0x6f,0x40,0x3c,0x08,0x01,0x79,0x00,0x20,0x2b,0x20,0x24,0x00,0xf0,
-0x0d,0xee,0x20,0x00,0x00,0x2e,0xa0,0xae,0x20,0x00,0x1d,0xa0,0x00,0xad,0x10,0x1d,
-0xd4,0x00,0x04,0xdd,0x13,0xcc,0xf2,0x02,0xfc,0xc3,0x00,0x0f,0x20,0x5a,0x07,0x43,
-0xf2,0x02,0xf0,0x00,0x0b,0x00,0x80,0xf3,0x13,0xf0,0x00,0x00,0x0d,0xff,0xfd,0x84,
-0x03,0x20,0xff,0xfc,0x11,0x00,0x3d,0x23,0xf0,0x00,0x27,0x00,0xf0,0x0a,0x33,0xf2,
-0x02,0xf3,0x30,0x3f,0xfd,0x10,0x1d,0xff,0x30,0x6e,0x30,0x00,0x3e,0x60,0x00,0x5e,
-0x40,0x4e,0x50,0x00,0x00,0x4e,0x8e,0x76,0x00,0x26,0x3c,0x30,0x25,0x12,0x11,0xa0,
-0x91,0x00,0x00,0xd2,0x00,0xf0,0x5c,0x0e,0xfe,0x00,0x00,0x00,0x06,0xf4,0xf6,0x00,
-0x00,0x00,0xe9,0x09,0xe0,0x00,0x00,0x7f,0x10,0x1f,0x70,0x00,0x1f,0x80,0x00,0x8f,
-0x10,0x08,0xe0,0x00,0x00,0xe8,0x01,0xfc,0x88,0x88,0x8c,0xf1,0x9f,0xff,0xff,0xff,
-0xff,0x90,0x00,0x00,0x00,0x3b,0xc5,0x00,0x00,0x02,0x1e,0x86,0xf2,0x00,0x4d,0xf7,
-0xf0,0x0d,0x50,0x4f,0x60,0x7f,0xb9,0xf1,0x0e,0x60,0x09,0xff,0xe6,0x04,0xe0,0x00,
-0xcf,0xa1,0xd4,0x5c,0x00,0x0e,0x60,0x0c,0x63,0xe0,0x01,0x20,0x00,0xe4,0x0e,0x60,
-0x00,0x00,0x6e,0x00,0x4f,0x70,0x00,0x7f,0x50,0x00,0x4d,0xfe,0xfd,0x40,0x00,0x00,
-0x02,0x42,0x3b,0x01,0x01,0x13,0x09,0xf0,0x06,0xbf,0xff,0x72,0x00,0x08,0xc1,0xdf,
-0xc3,0xf5,0x04,0x98,0x02,0xe2,0x07,0xb4,0x5d,0x00,0x01,0x00,0x1b,0x4d,0x5f,0x00,
-0xf0,0x12,0xbe,0x68,0x00,0x00,0x00,0x09,0x6a,0xd0,0x00,0x00,0x00,0xb9,0x1a,0xa0,
-0x00,0x00,0x9d,0x00,0x88,0xc4,0x25,0xb9,0x60,0x00,0x69,0xe9,0xf6,0x70,0x00,0x00,
-0x05,0x25,0x00,0x69,0x12,0xf0,0x19,0x32,0x00,0x00,0x01,0xee,0xef,0xef,0xd5,0x00,
-0x0d,0x90,0xbc,0x10,0x5f,0x70,0x0b,0xc1,0x0b,0xd0,0x03,0xf3,0x07,0xfd,0x1a,0xc0,
-0x00,0x99,0x0b,0x7a,0xfc,0x10,0x00,0x5c,0x0b,0x60,0x61,0x00,0x00,0x5c,0x08,0xe4,
-0x00,0xf3,0x04,0x89,0x01,0xf4,0x00,0x00,0x02,0xf3,0x00,0x6f,0x60,0x00,0x5e,0x70,
-0x00,0x04,0xdf,0xef,0xd5,0x00,0x8a,0x00,0xf0,0x2a,0x0c,0xee,0xee,0xee,0x10,0x01,
-0xfa,0x66,0x6b,0xb0,0x00,0x6f,0x10,0x00,0xd5,0x00,0x0b,0xb0,0x00,0x5e,0x00,0x00,
-0x7e,0x00,0x6d,0x40,0x00,0x2d,0xf3,0x7b,0x10,0x00,0x0d,0x8b,0x3d,0xd0,0x00,0x03,
-0xf0,0xd4,0x8e,0x30,0x00,0x3f,0x15,0x10,0xf3,0x00,0x00,0xd8,0x00,0x8d,0x00,0x00,
-0x02,0xdf,0xfd,0xba,0x01,0x20,0x33,0x00,0xa8,0x00,0xf0,0x24,0xaa,0x60,0x00,0x00,
-0xef,0xfa,0x10,0xcb,0xbb,0xba,0xaa,0xbc,0x00,0x00,0x00,0x0b,0xc0,0x5f,0xff,0xd0,
-0xbc,0x00,0x22,0x21,0x0c,0xc0,0x13,0x33,0x20,0xcc,0x05,0xee,0xec,0x0c,0xb0,0x00,
-0x00,0x00,0xc9,0xcb,0xde,0xed,0xb9,0x00,0x0e,0xff,0xa0,0x00,0x00,0x56,0x63,0x38,
-0x00,0xf0,0x08,0x57,0x62,0x04,0x00,0x06,0xef,0xff,0xf1,0xad,0x47,0xfb,0x30,0x24,
-0x0a,0x39,0xfa,0x00,0x00,0x00,0xa2,0x03,0xc5,0x00,0xce,0x0b,0xf0,0x0f,0xc8,0x00,
-0x00,0xa2,0x00,0x98,0x00,0x00,0x0a,0x22,0xc6,0x00,0x00,0x00,0xa7,0xcf,0xb0,0x00,
-0x00,0x0a,0xa0,0x5f,0xc5,0x23,0x50,0x20,0x00,0x4d,0xff,0xff,0x90,0x07,0xf0,0x19,
-0x54,0x00,0x89,0x99,0x99,0x99,0x8c,0x2f,0xd1,0x11,0x2b,0xb0,0x65,0x06,0xef,0xfb,
-0x0b,0x93,0xdf,0xff,0xb0,0xfd,0x00,0x69,0xdb,0x02,0x20,0x00,0x0b,0xb0,0xeb,0x00,
-0x00,0xbb,0x0f,0xd0,0x00,0x0b,0xb0,0x76,0x09,0x00,0x81,0xe0,0x00,0x0b,0xea,0xff,
-0xaa,0xaa,0xe0,0xf2,0x01,0xf0,0x2b,0x18,0xde,0xd8,0x10,0x00,0x3e,0xad,0x6a,0xbe,
-0x30,0x1e,0x70,0xc5,0x70,0x7e,0x18,0xb0,0x0c,0x57,0x00,0xb8,0xc5,0x00,0xbd,0x60,
-0x05,0xce,0x30,0x24,0x06,0x90,0x2e,0xd4,0x4b,0xe3,0xe7,0xc7,0xd9,0xcb,0x8b,0x04,
-0xc6,0xd9,0x2f,0xa9,0x00,0x00,0xbf,0x20,0x5f,0x71,0x01,0x7e,0x50,0x00,0x3b,0xff,
-0xfb,0x37,0x02,0x10,0x20,0x8f,0x0a,0x70,0x80,0x00,0x00,0x03,0xe6,0x4b,0xb0,0x93,
-0x06,0xf2,0x22,0x0f,0x12,0x62,0x0a,0x60,0x00,0xe7,0xff,0xf4,0x6d,0x10,0x6d,0xbf,
-0xff,0xb0,0x9f,0xef,0x7a,0xff,0xfa,0x07,0xe9,0xcf,0xff,0xfe,0x23,0xe1,0x4f,0xff,
-0xff,0xe1,0x96,0x1e,0xff,0xff,0xff,0x8c,0x38,0xff,0xff,0xff,0xfb,0xcf,0xfd,0xdd,
-0xdd,0xdd,0x90,0x11,0x77,0x02,0x20,0x61,0x00,0x6b,0x03,0x11,0xd2,0x06,0x00,0xf1,
-0x05,0xe3,0x00,0x02,0x43,0x33,0x37,0xe3,0x00,0xaf,0xff,0xff,0xff,0xf4,0x03,0x66,
-0x66,0x66,0x66,0x60,0x09,0x67,0x02,0x90,0x08,0xf9,0x88,0x88,0x95,0x00,0x07,0xd1,
-0x00,0x99,0x02,0x01,0x06,0x00,0x25,0x05,0x90,0xb9,0x02,0x20,0x68,0x50,0xc1,0x01,
-0xf0,0x24,0x48,0xc9,0x10,0x00,0x00,0x8c,0xa4,0x4c,0x30,0x00,0x03,0x22,0x8b,0x20,
-0x00,0x00,0x5a,0xc5,0x10,0x00,0x06,0x86,0x97,0x30,0x00,0x1c,0xb0,0x10,0xab,0x00,
-0x0a,0xf2,0x7f,0x82,0xf9,0x00,0xaf,0x29,0xfa,0x1f,0x90,0x01,0xda,0x04,0x09,0xd1,
-0x00,0x01,0x8b,0x9a,0x81,0x76,0x02,0xfa,0x0a,0xfd,0x10,0x0d,0x63,0x36,0x9d,0x10,
-0xd3,0x00,0xb0,0xbd,0x0d,0x30,0x0a,0xc9,0xe3,0xd3,0x00,0x00,0x0d,0x3d,0x30,0x00,
-0x00,0xd3,0x09,0x00,0x91,0x40,0x00,0x00,0xd3,0xcf,0xff,0xff,0xff,0x20,0x72,0x00,
-0x20,0x03,0x53,0x06,0x00,0xf0,0x2b,0xa9,0x6a,0x90,0x00,0x00,0x06,0x70,0x00,0x8d,
-0xc7,0x00,0x0a,0x10,0x00,0x00,0x09,0x40,0x1d,0x10,0x00,0x47,0x33,0x90,0xa3,0x38,
-0xcf,0xda,0x33,0x80,0xc0,0x68,0x58,0x00,0x04,0xb0,0xb0,0x00,0x4f,0x90,0x00,0xa2,
-0xa1,0x00,0xdf,0xf3,0x00,0x83,0x2c,0x20,0x00,0x00,0x01,0xc0,0x02,0xbb,0xbb,0xbb,
-0xbb,0x3f,0x01,0x11,0x4d,0xf2,0x00,0xf0,0x1b,0xf0,0x87,0x00,0x00,0x00,0x7f,0x2f,
-0x40,0x19,0xd8,0x6e,0xae,0x30,0x0a,0xb3,0x7b,0x60,0xd4,0x01,0xf1,0x00,0x9b,0x4f,
-0x20,0x5b,0x00,0x01,0xbf,0x60,0x08,0x70,0x00,0x04,0xf0,0x00,0xa5,0x00,0x00,0x4f,
-0x00,0x0c,0x30,0x0b,0x00,0x10,0xe2,0x0b,0x00,0x02,0x01,0x00,0x70,0x08,0xd7,0x01,
-0xc0,0xd0,0x09,0xd7,0x68,0x08,0xf2,0x16,0xa8,0x02,0xf4,0x00,0xc6,0x00,0xae,0x10,
-0xf3,0x06,0xdb,0xb8,0xc0,0x0d,0x51,0xee,0x20,0x1f,0x20,0x4f,0x20,0x4e,0x00,0x09,
-0xd0,0x7c,0x00,0x00,0xda,0x3f,0xff,0xd5,0x00,0x01,0x11,0x6f,0x20,0x1d,0x06,0x06,
-0x5d,0x09,0xf0,0x01,0x01,0x11,0x1b,0x80,0x7f,0xff,0xff,0xf5,0x2f,0xe2,0x00,0x01,
-0xaa,0x00,0x00,0x3e,0xf1,0x0a,0xf0,0x04,0x06,0xee,0x60,0x1f,0x38,0x90,0x5e,0x05,
-0xd0,0x8a,0x01,0xf0,0xbf,0xff,0xff,0xd0,0x11,0x15,0xe1,0xec,0x07,0x00,0x5a,0x05,
-0x09,0x07,0x00,0xfc,0x01,0x0f,0xff,0xfc,0x30,0x01,0x11,0x2a,0xd0,0x00,0x00,0x01,
-0xf2,0x0e,0x40,0x00,0xf3,0x04,0x00,0x13,0xe4,0x01,0x00,0xe2,0x88,0x20,0x04,0xbf,
-0xd0,0x03,0xd6,0x00,0x98,0x00,0x0a,0x80,0x00,0xa8,0x05,0x00,0xf6,0x03,0xef,0xff,
-0xd5,0x0e,0x51,0x16,0xf3,0xe4,0x00,0x0c,0x7e,0x40,0x00,0xa8,0xe4,0x00,0x0a,0x8e,
-0x07,0x00,0xf0,0x0d,0xf3,0x0c,0xfb,0x1f,0x30,0x20,0xc8,0xf3,0x00,0x08,0xbf,0x30,
-0x00,0x7c,0xf3,0x00,0x08,0xbd,0x50,0x00,0xb9,0x9d,0x32,0x7f,0x30,0x9e,0xfd,0x40,
-0x50,0x00,0xa1,0x10,0xcf,0xfe,0xa1,0x01,0x13,0xc9,0x00,0x00,0x5d,0x89,0x00,0x0c,
-0x03,0x00,0x80,0x7f,0xfd,0x70,0x00,0x11,0x4d,0x80,0x00,0xb5,0x03,0xf0,0x00,0x01,
-0xf0,0x00,0x00,0x1f,0x00,0x00,0x05,0xe0,0x01,0x14,0xd8,0x07,0xff,0xd7,0x4a,0x0f,
-0x20,0x09,0x90,0xab,0x06,0xc1,0x00,0x09,0xff,0xfe,0x70,0x01,0x11,0x5f,0x20,0x00,
-0x00,0xf3,0x08,0x0e,0x80,0x0a,0xa0,0x00,0x09,0xe1,0x00,0x5d,0xd2,0x18,0x01,0x00,
-0x01,0x00,0x00,0x21,0x0b,0x32,0x51,0x14,0xe7,0xa8,0x0c,0xf5,0x21,0x6c,0xe4,0x00,
-0x06,0xce,0x40,0x00,0x6c,0xe5,0x11,0x17,0xce,0xff,0xff,0xfc,0x5e,0x18,0xfe,0x80,
-0x0b,0xed,0x33,0xe7,0x03,0xf3,0x00,0x7c,0x05,0xd0,0x00,0x5d,0x0a,0x80,0x00,0x4e,
-0x0e,0x50,0x00,0x4e,0x2f,0x10,0x11,0x5e,0x6d,0x00,0xff,0xfe,0xe4,0x01,0x00,0x70,
-0x3f,0xe5,0x00,0x18,0xd0,0x00,0x3f,0x90,0x06,0xf0,0x48,0x2f,0x00,0x02,0xf0,0x01,
+0x00,0x20,0x4e,0xe4,0x05,0x00,0x11,0x3c,0x3f,0x00,0xf1,0x07,0x02,0x22,0x24,0xed,
+0x80,0x00,0x00,0x00,0x2e,0x4e,0x30,0x01,0x11,0x13,0xe0,0x4e,0x3b,0xff,0xff,0xfd,
+0x00,0x5e,0x7b,0x05,0x21,0x6f,0x40,0x3c,0x08,0x01,0x79,0x00,0x20,0x2b,0x20,0x24,
+0x00,0xf0,0x0d,0xee,0x20,0x00,0x00,0x2e,0xa0,0xae,0x20,0x00,0x1d,0xa0,0x00,0xad,
+0x10,0x1d,0xd4,0x00,0x04,0xdd,0x13,0xcc,0xf2,0x02,0xfc,0xc3,0x00,0x0f,0x20,0x5a,
+0x07,0x43,0xf2,0x02,0xf0,0x00,0x0b,0x00,0x80,0xf3,0x13,0xf0,0x00,0x00,0x0d,0xff,
+0xfd,0x84,0x03,0x20,0xff,0xfc,0x11,0x00,0x3d,0x23,0xf0,0x00,0x27,0x00,0xf0,0x0a,
+0x33,0xf2,0x02,0xf3,0x30,0x3f,0xfd,0x10,0x1d,0xff,0x30,0x6e,0x30,0x00,0x3e,0x60,
+0x00,0x5e,0x40,0x4e,0x50,0x00,0x00,0x4e,0x8e,0x76,0x00,0x35,0x3c,0x30,0x00,0x01,
+0x00,0x11,0xa0,0x91,0x00,0x00,0xd2,0x00,0xf0,0x5c,0x0e,0xfe,0x00,0x00,0x00,0x06,
+0xf4,0xf6,0x00,0x00,0x00,0xe9,0x09,0xe0,0x00,0x00,0x7f,0x10,0x1f,0x70,0x00,0x1f,
+0x80,0x00,0x8f,0x10,0x08,0xe0,0x00,0x00,0xe8,0x01,0xfc,0x88,0x88,0x8c,0xf1,0x9f,
+0xff,0xff,0xff,0xff,0x90,0x00,0x00,0x00,0x3b,0xc5,0x00,0x00,0x02,0x1e,0x86,0xf2,
+0x00,0x4d,0xf7,0xf0,0x0d,0x50,0x4f,0x60,0x7f,0xb9,0xf1,0x0e,0x60,0x09,0xff,0xe6,
+0x04,0xe0,0x00,0xcf,0xa1,0xd4,0x5c,0x00,0x0e,0x60,0x0c,0x63,0xe0,0x01,0x20,0x00,
+0xe4,0x0e,0x60,0x00,0x00,0x6e,0x00,0x4f,0x70,0x00,0x7f,0x50,0x00,0x4d,0xfe,0xfd,
+0x40,0x00,0x00,0x02,0x42,0x3b,0x01,0x01,0x13,0x09,0xf0,0x06,0xbf,0xff,0x72,0x00,
+0x08,0xc1,0xdf,0xc3,0xf5,0x04,0x98,0x02,0xe2,0x07,0xb4,0x5d,0x00,0x01,0x00,0x1b,
+0x4d,0x5f,0x00,0xf0,0x3e,0xbe,0x68,0x00,0x00,0x00,0x09,0x6a,0xd0,0x00,0x00,0x00,
+0xb9,0x1a,0xa0,0x00,0x00,0x9d,0x00,0x88,0xc4,0x25,0xb9,0x60,0x00,0x69,0xe9,0xf6,
+0x70,0x00,0x00,0x05,0x25,0x00,0x00,0x00,0x28,0x01,0x32,0x00,0x00,0x01,0xee,0xef,
+0xef,0xd5,0x00,0x0d,0x90,0xbc,0x10,0x5f,0x70,0x0b,0xc1,0x0b,0xd0,0x03,0xf3,0x07,
+0xfd,0x1a,0xc0,0x00,0x99,0x0b,0x7a,0xfc,0x10,0x00,0x5c,0x0b,0x60,0x61,0x00,0x00,
+0x5c,0x08,0xe4,0x00,0xf3,0x04,0x89,0x01,0xf4,0x00,0x00,0x02,0xf3,0x00,0x6f,0x60,
+0x00,0x5e,0x70,0x00,0x04,0xdf,0xef,0xd5,0x00,0x8a,0x00,0xf0,0x2a,0x0c,0xee,0xee,
+0xee,0x10,0x01,0xfa,0x66,0x6b,0xb0,0x00,0x6f,0x10,0x00,0xd5,0x00,0x0b,0xb0,0x00,
+0x5e,0x00,0x00,0x7e,0x00,0x6d,0x40,0x00,0x2d,0xf3,0x7b,0x10,0x00,0x0d,0x8b,0x3d,
+0xd0,0x00,0x03,0xf0,0xd4,0x8e,0x30,0x00,0x3f,0x15,0x10,0xf3,0x00,0x00,0xd8,0x00,
+0x8d,0x00,0x00,0x02,0xdf,0xfd,0xba,0x01,0x20,0x33,0x00,0xa8,0x00,0xf0,0x24,0xaa,
+0x60,0x00,0x00,0xef,0xfa,0x10,0xcb,0xbb,0xba,0xaa,0xbc,0x00,0x00,0x00,0x0b,0xc0,
+0x5f,0xff,0xd0,0xbc,0x00,0x22,0x21,0x0c,0xc0,0x13,0x33,0x20,0xcc,0x05,0xee,0xec,
+0x0c,0xb0,0x00,0x00,0x00,0xc9,0xcb,0xde,0xed,0xb9,0x00,0x0e,0xff,0xa0,0x00,0x00,
+0x56,0x63,0x38,0x00,0xf0,0x08,0x57,0x62,0x04,0x00,0x06,0xef,0xff,0xf1,0xad,0x47,
+0xfb,0x30,0x24,0x0a,0x39,0xfa,0x00,0x00,0x00,0xa2,0x03,0xc5,0x00,0xce,0x0b,0xf0,
+0x0f,0xc8,0x00,0x00,0xa2,0x00,0x98,0x00,0x00,0x0a,0x22,0xc6,0x00,0x00,0x00,0xa7,
+0xcf,0xb0,0x00,0x00,0x0a,0xa0,0x5f,0xc5,0x23,0x50,0x20,0x00,0x4d,0xff,0xff,0x90,
+0x07,0xf0,0x19,0x54,0x00,0x89,0x99,0x99,0x99,0x8c,0x2f,0xd1,0x11,0x2b,0xb0,0x65,
+0x06,0xef,0xfb,0x0b,0x93,0xdf,0xff,0xb0,0xfd,0x00,0x69,0xdb,0x02,0x20,0x00,0x0b,
+0xb0,0xeb,0x00,0x00,0xbb,0x0f,0xd0,0x00,0x0b,0xb0,0x76,0x09,0x00,0x81,0xe0,0x00,
+0x0b,0xea,0xff,0xaa,0xaa,0xe0,0xf2,0x01,0xf0,0x2b,0x18,0xde,0xd8,0x10,0x00,0x3e,
+0xad,0x6a,0xbe,0x30,0x1e,0x70,0xc5,0x70,0x7e,0x18,0xb0,0x0c,0x57,0x00,0xb8,0xc5,
+0x00,0xbd,0x60,0x05,0xce,0x30,0x24,0x06,0x90,0x2e,0xd4,0x4b,0xe3,0xe7,0xc7,0xd9,
+0xcb,0x8b,0x04,0xc6,0xd9,0x2f,0xa9,0x00,0x00,0xbf,0x20,0x5f,0x71,0x01,0x7e,0x50,
+0x00,0x3b,0xff,0xfb,0x37,0x02,0x10,0x20,0x8f,0x0a,0x70,0x80,0x00,0x00,0x03,0xe6,
+0x4b,0xb0,0x93,0x06,0xf2,0x22,0x0f,0x12,0x62,0x0a,0x60,0x00,0xe7,0xff,0xf4,0x6d,
+0x10,0x6d,0xbf,0xff,0xb0,0x9f,0xef,0x7a,0xff,0xfa,0x07,0xe9,0xcf,0xff,0xfe,0x23,
+0xe1,0x4f,0xff,0xff,0xe1,0x96,0x1e,0xff,0xff,0xff,0x8c,0x38,0xff,0xff,0xff,0xfb,
+0xcf,0xfd,0xdd,0xdd,0xdd,0x90,0x11,0x77,0x02,0x20,0x61,0x00,0x6b,0x03,0x11,0xd2,
+0x06,0x00,0xf1,0x05,0xe3,0x00,0x02,0x43,0x33,0x37,0xe3,0x00,0xaf,0xff,0xff,0xff,
+0xf4,0x03,0x66,0x66,0x66,0x66,0x60,0x09,0x67,0x02,0x90,0x08,0xf9,0x88,0x88,0x95,
+0x00,0x07,0xd1,0x00,0x99,0x02,0x01,0x06,0x00,0x25,0x05,0x90,0xb9,0x02,0x20,0x68,
+0x50,0xc1,0x01,0xf0,0x24,0x48,0xc9,0x10,0x00,0x00,0x8c,0xa4,0x4c,0x30,0x00,0x03,
+0x22,0x8b,0x20,0x00,0x00,0x5a,0xc5,0x10,0x00,0x06,0x86,0x97,0x30,0x00,0x1c,0xb0,
+0x10,0xab,0x00,0x0a,0xf2,0x7f,0x82,0xf9,0x00,0xaf,0x29,0xfa,0x1f,0x90,0x01,0xda,
+0x04,0x09,0xd1,0x00,0x01,0x8b,0x9a,0x81,0x76,0x02,0xfa,0x0a,0xfd,0x10,0x0d,0x63,
+0x36,0x9d,0x10,0xd3,0x00,0xb0,0xbd,0x0d,0x30,0x0a,0xc9,0xe3,0xd3,0x00,0x00,0x0d,
+0x3d,0x30,0x00,0x00,0xd3,0x09,0x00,0x91,0x40,0x00,0x00,0xd3,0xcf,0xff,0xff,0xff,
+0x20,0x72,0x00,0x20,0x03,0x53,0x06,0x00,0xf0,0x2b,0xa9,0x6a,0x90,0x00,0x00,0x06,
+0x70,0x00,0x8d,0xc7,0x00,0x0a,0x10,0x00,0x00,0x09,0x40,0x1d,0x10,0x00,0x47,0x33,
+0x90,0xa3,0x38,0xcf,0xda,0x33,0x80,0xc0,0x68,0x58,0x00,0x04,0xb0,0xb0,0x00,0x4f,
+0x90,0x00,0xa2,0xa1,0x00,0xdf,0xf3,0x00,0x83,0x2c,0x20,0x00,0x00,0x01,0xc0,0x02,
+0xbb,0xbb,0xbb,0xbb,0x3f,0x01,0x11,0x4d,0xf2,0x00,0xf0,0x1b,0xf0,0x87,0x00,0x00,
+0x00,0x7f,0x2f,0x40,0x19,0xd8,0x6e,0xae,0x30,0x0a,0xb3,0x7b,0x60,0xd4,0x01,0xf1,
+0x00,0x9b,0x4f,0x20,0x5b,0x00,0x01,0xbf,0x60,0x08,0x70,0x00,0x04,0xf0,0x00,0xa5,
+0x00,0x00,0x4f,0x00,0x0c,0x30,0x0b,0x00,0x10,0xe2,0x0b,0x00,0x02,0x01,0x00,0x70,
+0x08,0xd7,0x01,0xc0,0xd0,0x09,0xd7,0x68,0x08,0xf2,0x16,0xa8,0x02,0xf4,0x00,0xc6,
+0x00,0xae,0x10,0xf3,0x06,0xdb,0xb8,0xc0,0x0d,0x51,0xee,0x20,0x1f,0x20,0x4f,0x20,
+0x4e,0x00,0x09,0xd0,0x7c,0x00,0x00,0xda,0x3f,0xff,0xd5,0x00,0x01,0x11,0x6f,0x20,
+0x1d,0x06,0x06,0x5d,0x09,0xf0,0x01,0x01,0x11,0x1b,0x80,0x7f,0xff,0xff,0xf5,0x2f,
+0xe2,0x00,0x01,0xaa,0x00,0x00,0x3e,0xf1,0x0a,0xf0,0x04,0x06,0xee,0x60,0x1f,0x38,
+0x90,0x5e,0x05,0xd0,0x8a,0x01,0xf0,0xbf,0xff,0xff,0xd0,0x11,0x15,0xe1,0xec,0x07,
+0x00,0x5a,0x05,0x09,0x07,0x00,0xfc,0x01,0x0f,0xff,0xfc,0x30,0x01,0x11,0x2a,0xd0,
+0x00,0x00,0x01,0xf2,0x0e,0x40,0x00,0xf3,0x04,0x00,0x13,0xe4,0x01,0x00,0xe2,0x88,
+0x20,0x04,0xbf,0xd0,0x03,0xd6,0x00,0x98,0x00,0x0a,0x80,0x00,0xa8,0x05,0x00,0xf6,
+0x03,0xef,0xff,0xd5,0x0e,0x51,0x16,0xf3,0xe4,0x00,0x0c,0x7e,0x40,0x00,0xa8,0xe4,
+0x00,0x0a,0x8e,0x07,0x00,0xf0,0x12,0xf3,0x0c,0xfb,0x1f,0x30,0x20,0xc8,0xf3,0x00,
+0x08,0xbf,0x30,0x00,0x7c,0xf3,0x00,0x08,0xbd,0x50,0x00,0xb9,0x9d,0x32,0x7f,0x30,
+0x9e,0xfd,0x40,0xe4,0xe4,0xe4,0xe4,0x10,0xce,0xcf,0xfe,0xa1,0x01,0x13,0xc9,0x00,
+0x00,0x5d,0x00,0x00,0x4e,0x03,0x00,0xf0,0x33,0x7f,0xfd,0x70,0x00,0x11,0x4d,0x80,
+0x00,0x00,0x5e,0x00,0x00,0x01,0xf0,0x00,0x00,0x1f,0x00,0x00,0x05,0xe0,0x01,0x14,
+0xd8,0x07,0xff,0xd7,0x00,0x88,0x00,0x00,0x09,0x90,0x00,0x00,0x99,0x00,0x00,0x09,
+0xff,0xfe,0x70,0x01,0x11,0x5f,0x20,0x00,0x00,0xf3,0x00,0x00,0x2f,0x10,0x00,0x0a,
+0xa0,0x00,0x09,0xe1,0x00,0x5d,0xd2,0x00,0x0b,0x70,0x00,0x01,0x00,0xf5,0x2e,0xef,
+0xff,0xd8,0x0e,0x51,0x14,0xe7,0xe4,0x00,0x07,0xbe,0x40,0x00,0x6c,0xe4,0x00,0x06,
+0xce,0x40,0x00,0x6c,0xe5,0x11,0x17,0xce,0xff,0xff,0xfc,0x5e,0x18,0xfe,0x80,0x0b,
+0xed,0x33,0xe7,0x03,0xf3,0x00,0x7c,0x05,0xd0,0x00,0x5d,0x0a,0x80,0x00,0x4e,0x0e,
+0x50,0x00,0x4e,0x2f,0x10,0x11,0x5e,0x6d,0x00,0xff,0xfe,0xe4,0x01,0x00,0xfe,0x57,
+0x3f,0xe5,0x00,0x18,0xd0,0x00,0x3f,0x00,0x02,0xf0,0x00,0x2f,0x00,0x02,0xf0,0x01,
 0x3f,0x08,0xff,0xf0,0xaf,0xff,0xfe,0x90,0x0c,0x61,0x14,0xe7,0x0f,0x20,0x00,0x8b,
 0x2f,0x10,0x00,0x7c,0x2f,0x20,0x00,0x8b,0x0f,0x50,0x00,0xb9,0x0a,0xd4,0x26,0xf2,
 0x00,0x9e,0xfc,0x40,0x2f,0x20,0x05,0xe0,0xc7,0x00,0x5d,0x06,0xd0,0x07,0xc0,0x1f,
 0x20,0x99,0x00,0xb8,0x0e,0x50,0x05,0xd8,0xd0,0x24,0x7f,0xe2,0x0b,0xec,0x70,0x00,
 0x2f,0xff,0xfb,0x20,0x2f,0x11,0x2b,0xc0,0x2f,0x00,0x03,0xf0,0x2f,0xf8,0x01,0xf0,
-0x02,0x21,0x0e,0x08,0x0e,0x04,0x00,0xf4,0x22,0x1f,0xff,0xea,0x10,0x1f,0x21,0x3b,
-0xb0,0x1f,0x10,0x02,0xf1,0x1f,0xf9,0x00,0xf3,0x02,0x21,0x00,0xf2,0x00,0x00,0x03,
-0xf0,0x01,0x11,0x3c,0x90,0x0f,0xff,0xd8,0x00,0x9c,0x00,0x0f,0x20,0xe5,0x02,0xf1,
-0x05,0xe0,0x5e,0x00,0x0f,0x6e,0x60,0x00,0xea,0x40,0x07,0x0c,0x06,0x07,0x00,0xf0,
-0x05,0x9d,0x00,0x0f,0x40,0xd9,0x00,0xf2,0x02,0xf4,0x4f,0x00,0x06,0xee,0x60,0x00,
-0x0a,0xc0,0x00,0x00,0x1e,0x32,0x01,0xf4,0x10,0x37,0xff,0xff,0xf8,0x3f,0xff,0xfc,
-0x30,0x11,0x11,0x9c,0x07,0x20,0x04,0xe0,0xe4,0x00,0x6c,0x0e,0x40,0x0c,0x70,0xe4,
-0x09,0xd0,0x0e,0x4d,0xd2,0x00,0xe4,0x70,0x42,0x00,0x01,0xa4,0x01,0x1e,0xd9,0xa4,
-0x01,0xf0,0x1d,0x99,0x00,0xc6,0x05,0xe6,0xd0,0x0e,0x40,0x7c,0x3f,0x00,0xf3,0x09,
-0xa0,0xf3,0x6f,0x00,0xb8,0x0d,0xfe,0x50,0x0d,0x50,0xa9,0x00,0x03,0xf1,0x07,0xc3,
-0x47,0xe8,0x00,0x4f,0xfe,0xb5,0x00,0x8f,0xff,0xfe,0x91,0x06,0xd1,0x13,0xc9,0x5c,
-0x01,0xf0,0x17,0x05,0xd0,0x00,0x3e,0x05,0xd0,0x00,0x3f,0x05,0xc0,0x00,0x3f,0x1a,
-0xa0,0x00,0x3f,0x9d,0x30,0x00,0x3f,0x0e,0x80,0xf5,0x1f,0x24,0xf0,0x5c,0x07,0x90,
-0x86,0x0b,0x40,0x08,0xa1,0x1f,0xf7,0x0c,0xe3,0xfa,0x03,0xf1,0x00,0xc5,0x00,0x00,
-0x05,0xae,0x82,0x00,0x00,0x09,0xf3,0x02,0x8d,0xb4,0x02,0xe7,0x61,0x0f,0x42,0x02,
-0xff,0xff,0xf2,0x29,0x03,0x01,0x0f,0x00,0xa0,0x16,0xaf,0xf0,0x00,0x00,0x03,0x7c,
-0xff,0xff,0xf0,0x67,0x05,0x00,0x07,0x00,0x50,0x0b,0xff,0xff,0xfe,0xac,0x07,0x00,
-0x90,0xd8,0x30,0x09,0xf0,0x00,0x0b,0xf1,0x00,0x00,0x07,0x00,0x1b,0xe0,0x07,0x00,
-0x80,0x3d,0xff,0xf0,0x03,0x6c,0xe0,0x00,0xcf,0xbd,0x01,0x80,0xe0,0x00,0x5f,0xff,
-0x80,0xdf,0xff,0xd0,0x8c,0x0f,0x21,0x2a,0xda,0x09,0x04,0xf0,0x3c,0x80,0x9c,0xcc,
-0xcc,0xcc,0x40,0x8f,0xdf,0xb7,0x77,0x77,0xfe,0xdf,0xd0,0xc7,0x00,0x00,0x0d,0x50,
-0xde,0x8e,0x70,0x00,0x00,0xdb,0x8e,0xe5,0xdb,0x77,0x77,0x7f,0x95,0xed,0x1c,0xeb,
-0xbb,0xbb,0xf6,0x1d,0xfc,0xf7,0x00,0x00,0x0d,0xdc,0xfd,0x0c,0x70,0x00,0x00,0xd5,
-0x0d,0xfa,0xe9,0x33,0x33,0x3e,0xca,0xfc,0x3d,0xff,0xff,0xff,0xf8,0x3c,0x35,0x52,
-0x05,0x55,0x55,0x55,0x3f,0xff,0xc6,0xff,0x01,0x00,0x20,0xfc,0x6f,0x05,0x00,0xcf,
-0xee,0x94,0xee,0xee,0xee,0xec,0x34,0x42,0x04,0x44,0x44,0x44,0x1a,0x00,0x14,0x30,
-0xfd,0xff,0xa4,0x06,0x00,0x01,0xf0,0x00,0x21,0x29,0x10,0x8a,0x13,0x11,0xfc,0x06,
-0x00,0x31,0xff,0x90,0x50,0x06,0x00,0x20,0xaf,0xc0,0x06,0x00,0xa0,0x0c,0xff,0xc0,
-0x2e,0xff,0x90,0x00,0x1c,0xff,0xce,0xb9,0x07,0x12,0x1c,0xbf,0x07,0x21,0x1c,0xff,
-0x4a,0x05,0x14,0x0b,0x50,0x05,0xf1,0x1d,0x09,0xf5,0x00,0x06,0xf8,0xdf,0xf5,0x06,
-0xff,0xc2,0xef,0xf9,0xff,0xd1,0x02,0xef,0xff,0xd1,0x00,0x08,0xff,0xf7,0x00,0x06,
-0xff,0xff,0xf5,0x06,0xff,0xe4,0xef,0xf5,0xef,0xe1,0x02,0xef,0xd4,0xa1,0x00,0x02,
-0xb4,0x00,0x00,0x02,0xf0,0x10,0xf0,0x1e,0x20,0xbf,0x40,0x30,0x00,0x01,0xcf,0x1b,
-0xf4,0x7f,0x80,0x00,0xbf,0xd0,0xbf,0x45,0xff,0x40,0x4f,0xe1,0x0b,0xf4,0x07,0xfd,
-0x09,0xf8,0x00,0xbf,0x40,0x0e,0xf2,0xcf,0x40,0x0b,0xf4,0x00,0xbf,0x4b,0xf4,0x00,
-0x9e,0x30,0x0b,0xf4,0x9f,0x08,0x09,0x20,0xff,0x23,0x47,0x05,0xf0,0x05,0x8f,0xc0,
-0x0a,0xfe,0x40,0x01,0x8f,0xf4,0x00,0x0c,0xff,0xed,0xff,0xf6,0x00,0x00,0x07,0xef,
-0xff,0xc3,0x4f,0x00,0x11,0x12,0xc0,0x00,0x00,0xf0,0x10,0x00,0x2b,0x00,0x10,0xf3,
-0xc2,0x01,0xc1,0x3f,0xff,0x70,0x11,0x00,0x7f,0xbf,0xff,0xff,0xce,0xb0,0x1f,0xf5,
-0x00,0xf1,0x14,0x53,0xff,0xff,0x82,0x5f,0xff,0xf7,0x03,0xff,0xc0,0x00,0x7f,0xf8,
-0x00,0x3f,0xfa,0x00,0x06,0xff,0x70,0x2c,0xff,0xf4,0x01,0xdf,0xfe,0x42,0xff,0xff,
-0xfe,0xff,0xff,0xf6,0x0a,0xff,0x10,0x01,0xa1,0x05,0x07,0xff,0xfa,0x13,0x20,0x00,
-0x00,0x0f,0xff,0x63,0x09,0x12,0x46,0xab,0x11,0x40,0x25,0x00,0x36,0x20,0xb8,0x09,
-0x30,0xfc,0x1a,0xf6,0x7d,0x05,0xf0,0x15,0xe9,0xfe,0xcf,0x60,0x00,0x00,0xaf,0xc3,
-0x64,0xff,0xf6,0x00,0x01,0xcf,0xa3,0xef,0xa3,0xdf,0x90,0x03,0xef,0x75,0xff,0xff,
-0xc3,0xcf,0xb0,0xdf,0x48,0xff,0xff,0xff,0xe3,0x9f,0x72,0x27,0x4f,0x00,0xe0,0xf2,
-0x50,0x00,0x9f,0xff,0xcb,0xef,0xff,0x30,0x00,0x09,0xff,0xf1,0x07,0x9a,0x00,0xb1,
-0x9f,0xff,0x10,0x7f,0xff,0x30,0x00,0x07,0xff,0xe0,0x06,0x6e,0x02,0x21,0x04,0x54,
-0x60,0x00,0x21,0x1f,0xff,0xc3,0x00,0x3d,0x2f,0xff,0x20,0x07,0x00,0x50,0x47,0x8f,
-0xff,0x87,0x40,0x39,0x00,0x01,0x7c,0x01,0x40,0x0a,0xff,0xff,0xfa,0x1c,0x00,0x10,
-0xaf,0x09,0x08,0xf2,0x03,0x46,0x66,0x3a,0xfa,0x36,0x66,0x50,0xff,0xff,0xf4,0x54,
-0xff,0xff,0xf2,0xff,0xff,0xff,0xcf,0x07,0x00,0x60,0xff,0xf3,0xb8,0xf2,0x9b,0xbb,
-0x01,0x00,0xa1,0xa0,0x00,0x08,0xaa,0xaa,0xaa,0xa4,0x00,0x00,0x08,0x8f,0x00,0x30,
-0x00,0x03,0xfb,0x58,0x00,0x40,0xd0,0x00,0xdf,0x10,0xb9,0x09,0x21,0x80,0x8f,0xe7,
-0x11,0xf1,0x03,0xbf,0x3f,0xfe,0xee,0x40,0x00,0x9e,0xee,0xf9,0xff,0xff,0xfc,0x44,
-0x5f,0xff,0xff,0xaf,0xff,0x01,0x00,0x22,0xfa,0xff,0x01,0x00,0x12,0x9a,0x07,0x00,
-0x11,0xf5,0x19,0x03,0xf0,0x0f,0x07,0x90,0x00,0x6d,0xff,0xfb,0x40,0xcf,0x00,0xbf,
-0xfd,0xbd,0xff,0xac,0xf0,0xbf,0xd3,0x00,0x03,0xcf,0xff,0x4f,0xd1,0x00,0x07,0xaa,
-0xff,0xf9,0xf5,0x00,0x86,0x07,0x43,0x01,0x00,0x00,0x00,0xb3,0x12,0x21,0x00,0x00,
-0xae,0x00,0xf3,0x0e,0x4f,0x9f,0xff,0xab,0x70,0x00,0x0d,0xf4,0xff,0xfb,0x20,0x00,
-0x3c,0xfb,0x0f,0xcb,0xff,0xca,0xcf,0xfc,0x10,0xfc,0x05,0xcf,0xff,0xd7,0x00,0x09,
-0x70,0xbd,0x01,0xe4,0x05,0x20,0x00,0x06,0xf7,0x01,0x16,0xff,0x8f,0xff,0xff,0xf8,
-0xff,0xff,0x07,0x00,0xe0,0x8a,0xcc,0xef,0xf8,0x00,0x02,0xef,0x80,0x00,0x02,0xe7,
-0x00,0x00,0x01,0x2f,0x01,0x10,0x20,0xb8,0x00,0x60,0x70,0x00,0x01,0x16,0xff,0x80,
-0xee,0x11,0x70,0x82,0xb1,0xff,0xff,0xff,0x80,0xc9,0x05,0x00,0xa0,0x9b,0xff,0xff,
-0xff,0x82,0xf3,0xbd,0xdf,0xff,0x80,0x3f,0x15,0x00,0x35,0x02,0x32,0x3e,0x70,0x00,
-0x36,0x00,0x07,0x01,0x00,0x22,0x04,0xc2,0x6d,0x00,0xa0,0x0b,0xe1,0x00,0x00,0x06,
-0xf7,0x00,0xb7,0x0c,0xb0,0x4b,0x00,0xb0,0x05,0xf5,0x2f,0x3f,0xff,0xff,0xf8,0x2c,
-0x17,0xd0,0xb8,0x4b,0x00,0xb1,0xba,0x2f,0x18,0xbf,0xff,0xff,0xf8,0x09,0xb1,0xf2,
-0x7b,0x55,0x00,0x30,0x5e,0x0a,0x9a,0x89,0x00,0x30,0x2e,0x80,0xe4,0x8d,0x00,0x40,
-0x0c,0xa0,0x8d,0x00,0x91,0x00,0x31,0x10,0x7f,0x30,0x5f,0x00,0x24,0x4f,0x40,0x36,
-0x04,0x11,0x9f,0x29,0x01,0x40,0x9f,0xf9,0xbf,0xff,0xaa,0x03,0x30,0x00,0xdf,0xff,
-0x4d,0x00,0x90,0x0d,0xff,0xf8,0xaf,0xff,0xff,0x9b,0xff,0xf8,0x1d,0x01,0x80,0x6d,
-0xf8,0x00,0x00,0xcf,0xff,0x40,0x17,0xc9,0x01,0x11,0xa0,0xc8,0x01,0x72,0xfd,0xaa,
-0xaa,0xaa,0xaa,0xad,0xfa,0x72,0x01,0x02,0xd8,0x0b,0x00,0x51,0x0b,0x50,0x0c,0xfb,
-0x00,0x00,0x03,0x31,0x02,0xf0,0x39,0xdf,0xff,0xc0,0x00,0x8f,0xff,0xff,0x70,0x2f,
-0xff,0xff,0xff,0x2a,0xff,0xff,0xff,0xf9,0xef,0xef,0xff,0xff,0xdf,0xb7,0xff,0xff,
-0xfe,0xce,0x2d,0xff,0xff,0xb5,0xfc,0x36,0xff,0xf3,0x07,0xff,0xff,0xf6,0x00,0x02,
-0x89,0x72,0x00,0x06,0x40,0x00,0x02,0x42,0xfa,0x00,0x03,0xef,0x2f,0xa0,0x04,0xff,
-0xf2,0xfa,0x05,0xff,0xff,0x2f,0xa6,0xff,0xff,0xf2,0xfe,0xff,0xff,0xff,0x2f,0xff,
-0x01,0xf0,0x04,0xfc,0xdf,0xff,0xff,0x2f,0xa1,0xdf,0xff,0xf2,0xfa,0x01,0xcf,0xff,
-0x2f,0xa0,0x00,0xbf,0xf2,0xf9,0x52,0x10,0x00,0x01,0x00,0x12,0x24,0xc9,0x06,0x12,
-0xc3,0xb5,0x01,0x11,0x91,0x06,0x00,0x21,0xff,0x70,0x06,0x00,0x31,0xfd,0x40,0x00,
-0x9d,0x00,0x21,0x10,0xff,0x44,0x02,0x11,0xff,0x61,0x02,0x00,0x05,0x00,0x21,0xfe,
-0x50,0xe1,0x00,0x00,0x1e,0x00,0x10,0xb2,0x2a,0x00,0x10,0xd4,0x36,0x00,0x10,0xf7,
-0x42,0x00,0x11,0x48,0xd4,0x01,0xff,0x03,0x26,0x66,0x10,0x16,0x66,0x30,0xef,0xff,
-0xc0,0xaf,0xff,0xf1,0xff,0xff,0xe0,0xbf,0xff,0xf2,0x06,0x00,0x19,0xb0,0xd0,0xbf,
-0xff,0xf2,0xaf,0xff,0x80,0x6e,0xff,0xc0,0x26,0xd6,0x09,0x30,0x50,0xef,0xff,0xe2,
-0x09,0x01,0x7e,0x00,0x1f,0xf6,0x06,0x00,0x1c,0x11,0xf5,0xd2,0x02,0xf3,0x09,0xd1,
-0x05,0x00,0x00,0x06,0x45,0xfb,0x00,0x01,0xfc,0x6f,0xfc,0x10,0x1f,0xc6,0xff,0xfd,
-0x11,0xfc,0x6f,0xff,0xfd,0x3f,0xc6,0x12,0x05,0x00,0x1d,0x05,0xf4,0x05,0xfa,0xfc,
-0x6f,0xff,0xf7,0x1f,0xc6,0xff,0xf6,0x01,0xfc,0x6f,0xf5,0x00,0x1f,0xc3,0xe4,0x00,
-0x00,0xfb,0x3a,0x02,0x21,0x52,0x00,0xb0,0x01,0x30,0xe2,0x00,0x00,0x8d,0x03,0x00,
-0x51,0x0a,0x20,0x8f,0xff,0x07,0x00,0x00,0x3b,0x00,0x30,0xc0,0x00,0x5f,0x62,0x00,
-0x21,0xb0,0x0e,0x6f,0x00,0x90,0x40,0x8e,0xee,0xee,0xee,0xee,0xc1,0x02,0x44,0x01,
-0x00,0x12,0x00,0x82,0x00,0x11,0x0f,0x07,0x00,0x30,0x60,0xcf,0xff,0x1e,0x04,0x02,
-0x63,0x06,0xd1,0x0b,0xf2,0x00,0x00,0xbf,0xf2,0x00,0x0b,0xff,0x30,0x00,0xbf,0xf3,
-0x07,0x00,0xb4,0x2f,0xf9,0x00,0x00,0x06,0xff,0x80,0x00,0x00,0x6f,0xf8,0x09,0x00,
-0x50,0xf4,0x00,0x00,0x05,0xb0,0xc4,0x02,0x10,0x1e,0x54,0x07,0x62,0xfc,0x00,0x00,
-0x02,0xef,0xc0,0xab,0x05,0x01,0x09,0x00,0x20,0x7f,0xf4,0xc8,0x04,0x31,0x00,0x6f,
-0xf7,0x07,0x00,0x51,0x2f,0xf7,0x00,0x00,0x0a,0x93,0x08,0x11,0x17,0x94,0x02,0x2f,
-0x8f,0xe0,0x06,0x00,0x01,0x15,0xdf,0xc1,0x01,0x8f,0xff,0xf5,0x36,0x66,0xbf,0xf6,
-0x66,0x50,0x2a,0x00,0x01,0x20,0x4d,0x90,0x67,0x0d,0x39,0x11,0x11,0x11,0x30,0x00,
-0xc0,0x35,0x55,0x55,0x55,0x55,0x40,0x00,0x00,0x5a,0xcd,0xc8,0x20,0xc7,0x0c,0xf3,
-0x33,0xd7,0x69,0xff,0x90,0x00,0x04,0xff,0xa0,0x01,0x02,0xef,0xc1,0x02,0xff,0xf1,
-0x02,0xfc,0x16,0xff,0xb0,0xcf,0xfb,0x05,0xaf,0xf9,0x1f,0xff,0x6d,0xff,0xb1,0xff,
-0xff,0xb1,0xff,0xf7,0x4f,0xfe,0x0b,0xff,0xf5,0x5f,0xfc,0x00,0x6f,0xf9,0x08,0xa5,
-0x1d,0xfd,0x20,0x00,0x5e,0xfb,0x53,0x6e,0xfb,0x10,0x00,0x00,0x07,0xce,0xfe,0xa4,
-0x00,0x00,0x32,0x5e,0x01,0x23,0x0e,0xf5,0x09,0x00,0xe0,0x3e,0xf9,0x05,0xac,0xdb,
-0x71,0x00,0x00,0x00,0x1b,0xff,0xfd,0x76,0xaf,0x4e,0x02,0xf0,0x21,0x08,0xff,0x31,
-0x30,0x4f,0xfa,0x00,0x00,0x32,0x04,0xef,0xbf,0xc0,0x9f,0xf8,0x00,0x0e,0xf5,0x02,
-0xcf,0xff,0x64,0xff,0xf3,0x01,0xff,0xf6,0x00,0x9f,0xf8,0x4f,0xff,0x40,0x06,0xff,
-0xc0,0x00,0x6f,0xeb,0xff,0xa0,0x00,0x09,0xff,0x60,0x00,0x3e,0xff,0xe5,0x16,0x40,
-0xff,0xa4,0x30,0x1b,0x65,0x00,0x73,0x02,0x8d,0xff,0x80,0x08,0xfe,0x30,0xfc,0x03,
-0x22,0xef,0x20,0x09,0x00,0x11,0x02,0x19,0x04,0x03,0xb7,0x03,0x22,0x0d,0xf8,0x08,
-0x00,0x12,0x7f,0x75,0x05,0x21,0x01,0xff,0x99,0x03,0x00,0x69,0x05,0x20,0xf4,0x00,
-0x9f,0x16,0x21,0xf5,0x1a,0x25,0x07,0xf0,0x06,0xcf,0xf4,0x0a,0xff,0x60,0x00,0x00,
-0x05,0xff,0xf5,0x0a,0xff,0xe1,0x00,0x00,0x0e,0xff,0xf6,0x0b,0xff,0xf9,0x04,0x02,
-0xf2,0x07,0xfd,0x8f,0xff,0xff,0x20,0x02,0xff,0xff,0xf3,0x09,0xff,0xff,0xb0,0x0a,
-0xff,0xff,0xf7,0x1c,0xff,0xff,0xf4,0x0e,0x34,0x05,0x40,0xf8,0x04,0x9a,0xaa,0x01,
-0x00,0x11,0x91,0x5a,0x00,0x02,0x2d,0x0a,0x60,0x3f,0xa0,0xef,0xfa,0x00,0x05,0x66,
-0x05,0xf0,0x02,0xf9,0x04,0xff,0xff,0xfb,0x11,0x3f,0xa4,0xff,0x84,0xfc,0x00,0x00,
-0x33,0xff,0x90,0x19,0xd5,0x01,0xd0,0xa2,0x01,0x70,0x00,0x02,0xef,0xa4,0xf6,0x3f,
-0xa0,0xef,0xff,0xb0,0x8d,0x05,0x00,0xdd,0x00,0x20,0xff,0xfb,0x51,0x05,0x21,0x14,
-0xfc,0x41,0x00,0x15,0x19,0xd6,0x04,0x20,0x5f,0xa0,0xcd,0x04,0x01,0x11,0x06,0xf0,
-0x09,0x5f,0xfa,0xff,0xa0,0x00,0x05,0xff,0x90,0x3f,0xfa,0x00,0x4f,0xf9,0x00,0x03,
-0xff,0xa0,0xbf,0x90,0x00,0x00,0x3f,0xf1,0x15,0x7a,0x0c,0x21,0x30,0x01,0x9f,0x04,
-0xf0,0x08,0x9f,0x50,0x00,0x00,0x1d,0xe1,0x8f,0xf5,0x00,0x01,0xdf,0xd0,0x08,0xff,
-0x50,0x1d,0xfd,0x10,0x00,0x8f,0xf6,0xdf,0xd1,0x61,0x01,0x20,0xfd,0x10,0xf8,0x01,
-0x02,0x25,0x0d,0x10,0x10,0x7d,0x15,0x13,0x10,0x14,0x01,0x20,0xfd,0x18,0xe2,0x03,
-0x00,0x55,0x11,0xf0,0x01,0x4a,0xaa,0xaa,0xfb,0x00,0x0c,0xda,0xf7,0xf4,0x00,0x00,
-0x0e,0xb0,0x00,0x00,0x9f,0x8b,0x0d,0x63,0xeb,0x00,0x00,0x09,0xf1,0x00,0x11,0x00,
-0xc0,0x10,0x00,0x02,0xe6,0xeb,0x9d,0x00,0x09,0xf9,0x99,0x99,0x4d,0x44,0x01,0x52,
-0x7f,0xff,0xff,0xfb,0x1d,0x4c,0x01,0x10,0x00,0x9a,0x10,0x05,0x01,0x00,0x40,0x6b,
-0xcc,0xc7,0x00,0x60,0x07,0x42,0xff,0xf8,0x22,0x22,0x54,0x04,0x00,0xb8,0x06,0x0f,
-0x01,0x00,0x11,0x05,0x26,0x05,0x22,0x00,0x30,0xd1,0x0c,0x02,0xbb,0x01,0x10,0x8f,
-0x2a,0x03,0x00,0xe2,0x06,0x11,0xf8,0xc7,0x01,0x01,0xb8,0x04,0x5f,0x69,0x9f,0xff,
-0x99,0x60,0x52,0x07,0x03,0x50,0x46,0x66,0x2f,0xff,0x26,0x36,0x07,0x30,0x46,0x76,
-0x4f,0x69,0x04,0x2e,0xfc,0xbc,0x36,0x07,0x14,0x00,0x9e,0x0f,0x22,0x00,0x01,0x70,
-0x07,0x31,0x07,0xff,0xff,0xa7,0x02,0x02,0x32,0x09,0x12,0x0c,0x15,0x00,0x32,0x00,
-0xbf,0xf6,0x07,0x00,0x00,0x05,0x01,0x01,0xb1,0x03,0xf0,0x04,0x01,0x50,0x00,0x4f,
-0xfd,0x00,0x03,0xaf,0xf8,0x07,0xff,0xf2,0x00,0x0e,0xff,0xff,0xef,0xfe,0x30,0x37,
-0x0a,0x21,0xff,0xc2,0xa0,0x00,0x01,0x36,0x10,0x21,0x98,0x62,0x67,0x01,0x10,0x84,
-0xc5,0x01,0xf1,0x05,0x8f,0xff,0x60,0x00,0xaf,0xf3,0xec,0x2e,0xc0,0x1c,0xff,0xa0,
-0xde,0x9f,0xd1,0xdf,0xfa,0x00,0x3e,0xff,0x80,0x02,0x11,0x2d,0x61,0x00,0x10,0x1c,
-0x4e,0x05,0x10,0x2d,0x38,0x04,0xf0,0x10,0x00,0xcf,0xaf,0xd2,0xef,0xf6,0x00,0xfb,
-0x0d,0xd0,0x2e,0xff,0x60,0xbf,0xef,0x80,0x02,0xef,0xf3,0x19,0xc8,0x00,0x00,0x16,
-0x40,0x00,0x02,0x66,0x66,0x12,0x00,0x64,0x00,0xf1,0x01,0x3f,0x40,0x00,0x0c,0xff,
-0xff,0x3f,0xf2,0xdf,0x6c,0xff,0xff,0x53,0x31,0xff,0x7c,0xfe,0x04,0x0f,0x06,0x00,
-0x0b,0x10,0x7b,0xd3,0x03,0x71,0xff,0xc2,0x33,0x33,0x33,0x20,0xff,0xa9,0x0e,0xc2,
-0x8a,0xaa,0xaa,0xa9,0x00,0x00,0x49,0x99,0x99,0x99,0x60,0x00,0xc4,0x06,0x10,0xfa,
-0x02,0x01,0x20,0x80,0xfa,0x1c,0x06,0x11,0xf3,0x06,0x00,0x72,0xf5,0xfe,0xaa,0xaa,
-0xaa,0xff,0xf5,0x0f,0x04,0x40,0xff,0xff,0x80,0x4f,0x06,0x00,0x20,0x10,0x0c,0x06,
-0x00,0x20,0x50,0x1e,0x06,0x00,0x51,0xfb,0xef,0xff,0xf5,0x9f,0x70,0x05,0x74,0xcd,
-0xdd,0xdd,0xdd,0xdd,0xd4,0xef,0x3d,0x08,0x05,0x01,0x00,0x7f,0xbc,0xcc,0xcc,0xcc,
-0xcc,0xc3,0xff,0x18,0x00,0x10,0x10,0x6b,0x12,0x00,0x22,0xcb,0x6f,0xfe,0x01,0x02,
-0x5e,0x07,0x11,0x95,0x0e,0x00,0x70,0x65,0xf9,0x3d,0xff,0xff,0xfd,0x39,0x03,0x00,
-0x20,0xf9,0x3d,0x10,0x00,0x11,0xa4,0x17,0x00,0x2c,0xb7,0xbf,0x2b,0x02,0x80,0x55,
-0x55,0x20,0x00,0x03,0xff,0xff,0x90,0x72,0x03,0x10,0x40,0x84,0x01,0x00,0xda,0x03,
-0x40,0xfc,0x44,0x40,0x0c,0xd2,0x0b,0x12,0x0e,0xa0,0x07,0x20,0xff,0xfe,0x45,0x02,
-0x10,0xf6,0xc9,0x01,0x10,0xc0,0xc3,0x06,0x50,0x30,0x00,0x00,0x03,0xfa,0xf4,0x01,
-0x10,0xf1,0x3e,0x03,0x14,0x50,0x9f,0x00,0xb0,0x35,0x6e,0xf7,0x54,0x00,0x00,0xff,
-0xf9,0x8f,0xff,0x10,0x1d,0x01,0x00,0x06,0x00,0xb0,0xfa,0x24,0x44,0x01,0x00,0xff,
-0xf4,0xef,0xff,0x3e,0x20,0x9b,0x06,0x20,0x3f,0xe2,0x06,0x00,0x21,0x43,0x31,0xa7,
-0x06,0x18,0xf6,0x06,0x00,0x40,0x23,0x30,0xff,0xff,0xb2,0x0a,0x02,0x06,0x00,0x40,
-0x7a,0xaa,0xaa,0xa2,0x15,0x19,0x01,0xfa,0x09,0x20,0x70,0x00,0xc9,0x0a,0x21,0xfa,
-0x10,0x50,0x06,0x40,0xd0,0x00,0x01,0xff,0xe6,0x18,0x10,0x04,0xf4,0x10,0x21,0x00,
-0x07,0x92,0x0a,0x01,0xcf,0x10,0x20,0x00,0x0d,0x06,0x00,0x20,0x30,0x7f,0x06,0x00,
-0x12,0xd0,0x0b,0x07,0x20,0x13,0x33,0xb9,0x01,0x41,0x00,0x00,0xcf,0xf2,0xc4,0x0b,
-0x51,0x50,0x00,0x00,0x5a,0xaa,0x01,0x00,0x12,0x2f,0x03,0x01,0xf0,0x1a,0xf9,0xfa,
-0x0d,0x01,0xb0,0xd0,0xa2,0x0f,0xaf,0xeb,0xfb,0xcf,0xbf,0xbe,0xcb,0xfa,0xff,0xe1,
-0x98,0x1c,0x1c,0x15,0xff,0xaf,0xfd,0x08,0x70,0xb0,0xb0,0x3f,0xfa,0xff,0xdf,0xdd,
-0xdd,0xdd,0xfd,0xdf,0xaf,0xa0,0xd0,0x34,0x12,0xa8,0xfa,0xfe,0xaf,0xaa,0xaa,0xaa,
-0xeb,0xaf,0x9a,0xff,0x80,0x01,0x00,0x93,0x1c,0x00,0x9e,0x00,0x10,0xd0,0x09,0x03,
-0x11,0x8f,0x31,0x14,0x70,0x29,0xff,0xff,0xff,0x50,0x00,0x03,0x69,0x01,0x41,0xe0,
+0x02,0x21,0x01,0xf1,0x00,0x00,0x04,0x00,0xf7,0x29,0x1f,0xff,0xea,0x10,0x1f,0x21,
+0x3b,0xb0,0x1f,0x10,0x02,0xf1,0x1f,0xf9,0x00,0xf3,0x02,0x21,0x00,0xf2,0x00,0x00,
+0x03,0xf0,0x01,0x11,0x3c,0x90,0x0f,0xff,0xd8,0x00,0x9c,0x00,0x0f,0x20,0xe5,0x02,
+0xf1,0x05,0xe0,0x5e,0x00,0x0f,0x6e,0x60,0x00,0xea,0x40,0x00,0x0e,0x40,0x00,0x00,
+0xe4,0x00,0x07,0x00,0xf0,0x05,0x9d,0x00,0x0f,0x40,0xd9,0x00,0xf2,0x02,0xf4,0x4f,
+0x00,0x06,0xee,0x60,0x00,0x0a,0xc0,0x00,0x00,0x1e,0x32,0x01,0xf4,0x10,0x37,0xff,
+0xff,0xf8,0x3f,0xff,0xfc,0x30,0x11,0x11,0x9c,0x07,0x20,0x04,0xe0,0xe4,0x00,0x6c,
+0x0e,0x40,0x0c,0x70,0xe4,0x09,0xd0,0x0e,0x4d,0xd2,0x00,0xe4,0x70,0x42,0x00,0x01,
+0xa4,0x01,0x1e,0xd9,0xa4,0x01,0xf0,0x1d,0x99,0x00,0xc6,0x05,0xe6,0xd0,0x0e,0x40,
+0x7c,0x3f,0x00,0xf3,0x09,0xa0,0xf3,0x6f,0x00,0xb8,0x0d,0xfe,0x50,0x0d,0x50,0xa9,
+0x00,0x03,0xf1,0x07,0xc3,0x47,0xe8,0x00,0x4f,0xfe,0xb5,0x00,0x8f,0xff,0xfe,0x91,
+0x06,0xd1,0x13,0xc9,0x5c,0x01,0xf0,0x2c,0x05,0xd0,0x00,0x3e,0x05,0xd0,0x00,0x3f,
+0x05,0xc0,0x00,0x3f,0x1a,0xa0,0x00,0x3f,0x9d,0x30,0x00,0x3f,0x0e,0x80,0xf5,0x1f,
+0x24,0xf0,0x5c,0x07,0x90,0x86,0x0b,0x40,0x08,0xa1,0x1f,0xf7,0x0c,0xe3,0x00,0x00,
+0x00,0x02,0xc5,0x00,0x00,0x05,0xae,0x82,0x00,0x00,0x09,0xf3,0x02,0x8d,0xb4,0x02,
+0xe7,0x10,0x00,0x15,0x00,0x41,0xff,0xff,0xf2,0x00,0x01,0x00,0x01,0x0f,0x00,0xe0,
+0x16,0xaf,0xf0,0x00,0x00,0x03,0x7c,0xff,0xff,0xf0,0x00,0x06,0xef,0xff,0x07,0x00,
+0x50,0x0b,0xff,0xff,0xfe,0xac,0x07,0x00,0x90,0xd8,0x30,0x09,0xf0,0x00,0x0b,0xf1,
+0x00,0x00,0x07,0x00,0x1b,0xe0,0x07,0x00,0x80,0x3d,0xff,0xf0,0x03,0x6c,0xe0,0x00,
+0xcf,0xbd,0x01,0xf0,0x00,0xe0,0x00,0x5f,0xff,0x80,0xdf,0xff,0xd0,0x00,0x00,0x21,
+0x00,0x2a,0xda,0x20,0x57,0x00,0xf0,0x3c,0x80,0x9c,0xcc,0xcc,0xcc,0x40,0x8f,0xdf,
+0xb7,0x77,0x77,0xfe,0xdf,0xd0,0xc7,0x00,0x00,0x0d,0x50,0xde,0x8e,0x70,0x00,0x00,
+0xdb,0x8e,0xe5,0xdb,0x77,0x77,0x7f,0x95,0xed,0x1c,0xeb,0xbb,0xbb,0xf6,0x1d,0xfc,
+0xf7,0x00,0x00,0x0d,0xdc,0xfd,0x0c,0x70,0x00,0x00,0xd5,0x0d,0xfa,0xe9,0x33,0x33,
+0x3e,0xca,0xfc,0x3d,0xff,0xff,0xff,0xf8,0x3c,0x35,0x52,0x05,0x55,0x55,0x55,0x3f,
+0xff,0xc6,0xff,0x01,0x00,0x20,0xfc,0x6f,0x05,0x00,0xcf,0xee,0x94,0xee,0xee,0xee,
+0xec,0x34,0x42,0x04,0x44,0x44,0x44,0x1a,0x00,0x14,0x30,0xfd,0xff,0xa4,0x06,0x00,
+0x01,0xf0,0x00,0x11,0x29,0xf1,0x00,0x21,0x2e,0xfc,0x06,0x00,0x31,0xff,0x90,0x50,
+0x06,0x00,0x20,0xaf,0xc0,0x06,0x00,0xf0,0x01,0x0c,0xff,0xc0,0x2e,0xff,0x90,0x00,
+0x1c,0xff,0xce,0xff,0x90,0x00,0x00,0x1c,0xff,0x06,0x00,0x21,0x00,0x1c,0x06,0x00,
+0x42,0x00,0x0b,0x90,0x00,0x01,0x00,0xf0,0x1e,0x09,0xf5,0x00,0x06,0xf8,0xdf,0xf5,
+0x06,0xff,0xc2,0xef,0xf9,0xff,0xd1,0x02,0xef,0xff,0xd1,0x00,0x08,0xff,0xf7,0x00,
+0x06,0xff,0xff,0xf5,0x06,0xff,0xe4,0xef,0xf5,0xef,0xe1,0x02,0xef,0xd4,0xa1,0x00,
+0x02,0xb4,0x00,0x00,0x02,0x50,0x31,0x00,0xf0,0x3c,0x20,0xbf,0x40,0x30,0x00,0x01,
+0xcf,0x1b,0xf4,0x7f,0x80,0x00,0xbf,0xd0,0xbf,0x45,0xff,0x40,0x4f,0xe1,0x0b,0xf4,
+0x07,0xfd,0x09,0xf8,0x00,0xbf,0x40,0x0e,0xf2,0xcf,0x40,0x0b,0xf4,0x00,0xbf,0x4b,
+0xf4,0x00,0x9e,0x30,0x0b,0xf4,0x9f,0x80,0x00,0x00,0x00,0xff,0x23,0xff,0x20,0x00,
+0x00,0x8f,0xc0,0x0a,0xfe,0x40,0x01,0x8f,0xf4,0x00,0x0c,0xff,0xed,0xff,0xf6,0x00,
+0x00,0x07,0xef,0xff,0xc3,0x4f,0x00,0x21,0x12,0x10,0x87,0x00,0x11,0x21,0x06,0x00,
+0x20,0xff,0xf3,0xc2,0x01,0xc1,0x3f,0xff,0x70,0x11,0x00,0x7f,0xbf,0xff,0xff,0xce,
+0xb0,0x1f,0xf5,0x00,0xf1,0x14,0x53,0xff,0xff,0x82,0x5f,0xff,0xf7,0x03,0xff,0xc0,
+0x00,0x7f,0xf8,0x00,0x3f,0xfa,0x00,0x06,0xff,0x70,0x2c,0xff,0xf4,0x01,0xdf,0xfe,
+0x42,0xff,0xff,0xfe,0xff,0xff,0xf6,0x0a,0xff,0x10,0x01,0xb0,0x05,0x07,0xff,0xfa,
+0x13,0x20,0x00,0x00,0x0f,0xff,0x40,0x4e,0x00,0x21,0x46,0x50,0x55,0x00,0x30,0x25,
+0x00,0x36,0xbe,0x01,0xf0,0x1d,0x4f,0xfc,0x1a,0xf6,0x00,0x00,0x00,0x7f,0xe9,0xfe,
+0xcf,0x60,0x00,0x00,0xaf,0xc3,0x64,0xff,0xf6,0x00,0x01,0xcf,0xa3,0xef,0xa3,0xdf,
+0x90,0x03,0xef,0x75,0xff,0xff,0xc3,0xcf,0xb0,0xdf,0x48,0xff,0xff,0xff,0xe3,0x9f,
+0x72,0x27,0x4f,0x00,0xe0,0xf2,0x50,0x00,0x9f,0xff,0xcb,0xef,0xff,0x30,0x00,0x09,
+0xff,0xf1,0x07,0x9a,0x00,0xb1,0x9f,0xff,0x10,0x7f,0xff,0x30,0x00,0x07,0xff,0xe0,
+0x06,0x6e,0x02,0x21,0x04,0x54,0x60,0x00,0x21,0x1f,0xff,0xc3,0x00,0x3d,0x2f,0xff,
+0x20,0x07,0x00,0x50,0x47,0x8f,0xff,0x87,0x40,0x39,0x00,0x01,0x7c,0x01,0x40,0x0a,
+0xff,0xff,0xfa,0x1c,0x00,0xf2,0x08,0xaf,0xff,0xa0,0x00,0x00,0x46,0x66,0x3a,0xfa,
+0x36,0x66,0x50,0xff,0xff,0xf4,0x54,0xff,0xff,0xf2,0xff,0xff,0xff,0xcf,0x07,0x00,
+0x60,0xff,0xf3,0xb8,0xf2,0x9b,0xbb,0x01,0x00,0xa1,0xa0,0x00,0x08,0xaa,0xaa,0xaa,
+0xa4,0x00,0x00,0x08,0x8f,0x00,0x30,0x00,0x03,0xfb,0x58,0x00,0x30,0xd0,0x00,0xdf,
+0x6f,0x00,0x40,0x6f,0x80,0x8f,0x60,0x4c,0x00,0xf1,0x03,0xbf,0x3f,0xfe,0xee,0x40,
+0x00,0x9e,0xee,0xf9,0xff,0xff,0xfc,0x44,0x5f,0xff,0xff,0xaf,0xff,0x01,0x00,0x22,
+0xfa,0xff,0x01,0x00,0x12,0x9a,0x07,0x00,0x11,0xf5,0x19,0x03,0xf0,0x0e,0x07,0x90,
+0x00,0x6d,0xff,0xfb,0x40,0xcf,0x00,0xbf,0xfd,0xbd,0xff,0xac,0xf0,0xbf,0xd3,0x00,
+0x03,0xcf,0xff,0x4f,0xd1,0x00,0x07,0xaa,0xff,0xf9,0xf5,0x97,0x00,0x82,0xff,0x01,
+0x00,0x00,0x00,0x11,0x11,0x10,0x1a,0x02,0x01,0xae,0x00,0xf3,0x0e,0x4f,0x9f,0xff,
+0xab,0x70,0x00,0x0d,0xf4,0xff,0xfb,0x20,0x00,0x3c,0xfb,0x0f,0xcb,0xff,0xca,0xcf,
+0xfc,0x10,0xfc,0x05,0xcf,0xff,0xd7,0x00,0x09,0x70,0xbd,0x01,0xe4,0x05,0x20,0x00,
+0x06,0xf7,0x01,0x16,0xff,0x8f,0xff,0xff,0xf8,0xff,0xff,0x07,0x00,0xe0,0x8a,0xcc,
+0xef,0xf8,0x00,0x02,0xef,0x80,0x00,0x02,0xe7,0x00,0x00,0x01,0x2f,0x01,0x10,0x20,
+0xb8,0x00,0xf0,0x02,0x70,0x00,0x01,0x16,0xff,0x80,0x00,0xef,0xff,0xff,0x82,0xb1,
+0xff,0xff,0xff,0x80,0xc9,0x05,0x00,0xe0,0x9b,0xff,0xff,0xff,0x82,0xf3,0xbd,0xdf,
+0xff,0x80,0x10,0x00,0x03,0xef,0x35,0x02,0x32,0x3e,0x70,0x00,0x36,0x00,0x07,0x01,
+0x00,0x22,0x04,0xc2,0x6d,0x00,0xa0,0x0b,0xe1,0x00,0x00,0x06,0xf7,0x00,0xb7,0x0c,
+0xb0,0x4b,0x00,0xb0,0x05,0xf5,0x2f,0x3f,0xff,0xff,0xf8,0x2c,0x17,0xd0,0xb8,0x4b,
+0x00,0xb1,0xba,0x2f,0x18,0xbf,0xff,0xff,0xf8,0x09,0xb1,0xf2,0x7b,0x55,0x00,0x30,
+0x5e,0x0a,0x9a,0x89,0x00,0x30,0x2e,0x80,0xe4,0x8d,0x00,0x40,0x0c,0xa0,0x8d,0x00,
+0x91,0x00,0x31,0x10,0x7f,0x30,0x5f,0x00,0x24,0x4f,0x40,0x36,0x04,0x11,0x9f,0x29,
+0x01,0x40,0x9f,0xf9,0xbf,0xff,0xaa,0x03,0x30,0x00,0xdf,0xff,0x4d,0x00,0x90,0x0d,
+0xff,0xf8,0xaf,0xff,0xff,0x9b,0xff,0xf8,0x1d,0x01,0x80,0x6d,0xf8,0x00,0x00,0xcf,
+0xff,0x40,0x17,0xc9,0x01,0x11,0xa0,0xc8,0x01,0x61,0xfd,0xaa,0xaa,0xaa,0xaa,0xad,
+0x6c,0x01,0x00,0x2c,0x01,0x10,0x40,0xe0,0x00,0x80,0x50,0x00,0x00,0x0c,0xfb,0x00,
+0x00,0x03,0x31,0x02,0xf0,0x39,0xdf,0xff,0xc0,0x00,0x8f,0xff,0xff,0x70,0x2f,0xff,
+0xff,0xff,0x2a,0xff,0xff,0xff,0xf9,0xef,0xef,0xff,0xff,0xdf,0xb7,0xff,0xff,0xfe,
+0xce,0x2d,0xff,0xff,0xb5,0xfc,0x36,0xff,0xf3,0x07,0xff,0xff,0xf6,0x00,0x02,0x89,
+0x72,0x00,0x06,0x40,0x00,0x02,0x42,0xfa,0x00,0x03,0xef,0x2f,0xa0,0x04,0xff,0xf2,
+0xfa,0x05,0xff,0xff,0x2f,0xa6,0xff,0xff,0xf2,0xfe,0xff,0xff,0xff,0x2f,0xff,0x01,
+0xf1,0x07,0xfc,0xdf,0xff,0xff,0x2f,0xa1,0xdf,0xff,0xf2,0xfa,0x01,0xcf,0xff,0x2f,
+0xa0,0x00,0xbf,0xf2,0xf9,0x00,0x00,0x9c,0xbd,0x00,0x12,0x24,0xc9,0x06,0x12,0xc3,
+0xb5,0x01,0x11,0x91,0x06,0x00,0x21,0xff,0x70,0x06,0x00,0x31,0xfd,0x40,0x00,0x9d,
+0x00,0x21,0x10,0xff,0x44,0x02,0x11,0xff,0x61,0x02,0x00,0x05,0x00,0x21,0xfe,0x50,
+0xe1,0x00,0x00,0x1e,0x00,0x10,0xb2,0x2a,0x00,0x10,0xd4,0x36,0x00,0x10,0xf7,0x42,
+0x00,0x11,0x48,0xd4,0x01,0xff,0x03,0x26,0x66,0x10,0x16,0x66,0x30,0xef,0xff,0xc0,
+0xaf,0xff,0xf1,0xff,0xff,0xe0,0xbf,0xff,0xf2,0x06,0x00,0x19,0xf0,0x02,0xd0,0xbf,
+0xff,0xf2,0xaf,0xff,0x80,0x6e,0xff,0xc0,0x26,0x66,0x66,0x66,0x66,0x50,0xef,0x6d,
+0x00,0x11,0xf4,0x7e,0x00,0x1f,0xf6,0x06,0x00,0x1c,0x11,0xf5,0xd2,0x02,0xf3,0x09,
+0xd1,0x05,0x00,0x00,0x06,0x45,0xfb,0x00,0x01,0xfc,0x6f,0xfc,0x10,0x1f,0xc6,0xff,
+0xfd,0x11,0xfc,0x6f,0xff,0xfd,0x3f,0xc6,0x12,0x05,0x00,0x1d,0x05,0xf4,0x05,0xfa,
+0xfc,0x6f,0xff,0xf7,0x1f,0xc6,0xff,0xf6,0x01,0xfc,0x6f,0xf5,0x00,0x1f,0xc3,0xe4,
+0x00,0x00,0xfb,0x3a,0x02,0x21,0x52,0x00,0xb0,0x01,0x30,0xe2,0x00,0x00,0x8d,0x03,
+0x60,0xd1,0x00,0x00,0x00,0x8f,0xff,0x07,0x00,0x00,0x3b,0x00,0x30,0xc0,0x00,0x5f,
+0x62,0x00,0x21,0xb0,0x0e,0x6f,0x00,0x90,0x40,0x8e,0xee,0xee,0xee,0xee,0xc1,0x02,
+0x44,0x01,0x00,0x12,0x00,0x82,0x00,0x11,0x0f,0x07,0x00,0x30,0x60,0xcf,0xff,0x1e,
+0x04,0x02,0x63,0x06,0xd1,0x0b,0xf2,0x00,0x00,0xbf,0xf2,0x00,0x0b,0xff,0x30,0x00,
+0xbf,0xf3,0x07,0x00,0xb4,0x2f,0xf9,0x00,0x00,0x06,0xff,0x80,0x00,0x00,0x6f,0xf8,
+0x09,0x00,0x50,0xf4,0x00,0x00,0x05,0xb0,0xc4,0x02,0x10,0x1e,0x54,0x07,0x62,0xfc,
+0x00,0x00,0x02,0xef,0xc0,0xab,0x05,0x01,0x09,0x00,0x20,0x7f,0xf4,0xc8,0x04,0x31,
+0x00,0x6f,0xf7,0x07,0x00,0x51,0x2f,0xf7,0x00,0x00,0x0a,0x93,0x08,0x11,0x17,0x94,
+0x02,0x2f,0x8f,0xe0,0x06,0x00,0x01,0x15,0xdf,0xc1,0x01,0x8f,0xff,0xf5,0x36,0x66,
+0xbf,0xf6,0x66,0x50,0x2a,0x00,0x01,0x99,0x4d,0x90,0x00,0x00,0x01,0x11,0x11,0x11,
+0x11,0x30,0x00,0xf3,0x43,0x35,0x55,0x55,0x55,0x55,0x40,0x00,0x00,0x5a,0xcd,0xc8,
+0x20,0x00,0x00,0x02,0xdf,0xd7,0x69,0xff,0x90,0x00,0x04,0xff,0xa0,0x01,0x02,0xef,
+0xc1,0x02,0xff,0xf1,0x02,0xfc,0x16,0xff,0xb0,0xcf,0xfb,0x05,0xaf,0xf9,0x1f,0xff,
+0x6d,0xff,0xb1,0xff,0xff,0xb1,0xff,0xf7,0x4f,0xfe,0x0b,0xff,0xf5,0x5f,0xfc,0x00,
+0x6f,0xf9,0x08,0xa5,0x1d,0xfd,0x20,0x00,0x5e,0xfb,0x53,0x6e,0xfb,0x10,0x00,0x00,
+0x07,0xce,0xfe,0xa4,0x00,0x00,0x32,0x5e,0x01,0x23,0x0e,0xf5,0x09,0x00,0xe0,0x3e,
+0xf9,0x05,0xac,0xdb,0x71,0x00,0x00,0x00,0x1b,0xff,0xfd,0x76,0xaf,0x4e,0x02,0xf0,
+0x29,0x08,0xff,0x31,0x30,0x4f,0xfa,0x00,0x00,0x32,0x04,0xef,0xbf,0xc0,0x9f,0xf8,
+0x00,0x0e,0xf5,0x02,0xcf,0xff,0x64,0xff,0xf3,0x01,0xff,0xf6,0x00,0x9f,0xf8,0x4f,
+0xff,0x40,0x06,0xff,0xc0,0x00,0x6f,0xeb,0xff,0xa0,0x00,0x09,0xff,0x60,0x00,0x3e,
+0xff,0xc0,0x00,0x00,0x07,0xff,0xa4,0x30,0x1b,0x65,0x00,0x73,0x02,0x8d,0xff,0x80,
+0x08,0xfe,0x30,0xfc,0x03,0x22,0xef,0x20,0x09,0x00,0x11,0x02,0x19,0x04,0x03,0xb7,
+0x03,0x22,0x0d,0xf8,0x08,0x00,0x12,0x7f,0x75,0x05,0x21,0x01,0xff,0x99,0x03,0x00,
+0x69,0x05,0x10,0xf4,0x08,0x00,0x31,0x3f,0xf5,0x1a,0x25,0x07,0xf0,0x06,0xcf,0xf4,
+0x0a,0xff,0x60,0x00,0x00,0x05,0xff,0xf5,0x0a,0xff,0xe1,0x00,0x00,0x0e,0xff,0xf6,
+0x0b,0xff,0xf9,0x04,0x02,0xf2,0x07,0xfd,0x8f,0xff,0xff,0x20,0x02,0xff,0xff,0xf3,
+0x09,0xff,0xff,0xb0,0x0a,0xff,0xff,0xf7,0x1c,0xff,0xff,0xf4,0x0e,0x34,0x05,0x40,
+0xf8,0x04,0x9a,0xaa,0x01,0x00,0x11,0x91,0x5a,0x00,0x02,0x2d,0x0a,0x60,0x3f,0xa0,
+0xef,0xfa,0x00,0x05,0x66,0x05,0xf0,0x02,0xf9,0x04,0xff,0xff,0xfb,0x11,0x3f,0xa4,
+0xff,0x84,0xfc,0x00,0x00,0x33,0xff,0x90,0x19,0xd5,0x01,0xd0,0xa2,0x01,0x70,0x00,
+0x02,0xef,0xa4,0xf6,0x3f,0xa0,0xef,0xff,0xb0,0x8d,0x05,0x00,0xdd,0x00,0x20,0xff,
+0xfb,0x51,0x05,0x21,0x14,0xfc,0x41,0x00,0x15,0x19,0xd6,0x04,0x20,0x5f,0xa0,0xcd,
+0x04,0x01,0x11,0x06,0xf1,0x0f,0x5f,0xfa,0xff,0xa0,0x00,0x05,0xff,0x90,0x3f,0xfa,
+0x00,0x4f,0xf9,0x00,0x03,0xff,0xa0,0xbf,0x90,0x00,0x00,0x3f,0xf1,0x15,0x00,0x00,
+0x00,0x03,0x30,0x01,0x9f,0x04,0xf0,0x08,0x9f,0x50,0x00,0x00,0x1d,0xe1,0x8f,0xf5,
+0x00,0x01,0xdf,0xd0,0x08,0xff,0x50,0x1d,0xfd,0x10,0x00,0x8f,0xf6,0xdf,0xd1,0x61,
+0x01,0x20,0xfd,0x10,0xf8,0x01,0x11,0xd1,0x89,0x05,0x00,0x0b,0x00,0x23,0x7d,0x10,
+0x14,0x01,0x21,0xfd,0x18,0xe2,0x03,0xf3,0x0e,0x6f,0xff,0xfd,0x4a,0xaa,0xaa,0xfb,
+0x00,0x0c,0xda,0xf7,0xf4,0x00,0x00,0x0e,0xb0,0x00,0x00,0x9f,0x11,0x00,0x00,0x00,
+0xeb,0x00,0x00,0x09,0xf1,0x00,0x11,0x00,0xc0,0x10,0x00,0x02,0xe6,0xeb,0x9d,0x00,
+0x09,0xf9,0x99,0x99,0x4d,0x44,0x01,0x72,0x7f,0xff,0xff,0xfb,0x1d,0xff,0xa0,0x49,
+0x00,0x26,0x1d,0xa0,0x83,0x05,0x40,0x6b,0xcc,0xc7,0x00,0x60,0x07,0x42,0xff,0xf8,
+0x22,0x22,0x54,0x04,0x00,0xb8,0x06,0x0f,0x01,0x00,0x11,0x05,0x26,0x05,0x12,0x00,
+0xd2,0x01,0x12,0x08,0xbb,0x01,0x10,0x8f,0x2a,0x03,0x00,0xe2,0x06,0x11,0xf8,0xc7,
+0x01,0x01,0xb8,0x04,0x5f,0x69,0x9f,0xff,0x99,0x60,0x52,0x07,0x03,0x50,0x46,0x66,
+0x2f,0xff,0x26,0x36,0x07,0x30,0x46,0x76,0x4f,0x69,0x04,0x2e,0xfc,0xbc,0x36,0x07,
+0x00,0x01,0x00,0x22,0x33,0x00,0x10,0x02,0x01,0x70,0x07,0x31,0x07,0xff,0xff,0xa7,
+0x02,0x02,0x32,0x09,0x12,0x0c,0x15,0x00,0x32,0x00,0xbf,0xf6,0x07,0x00,0x00,0x05,
+0x01,0x01,0xb1,0x03,0xf0,0x04,0x01,0x50,0x00,0x4f,0xfd,0x00,0x03,0xaf,0xf8,0x07,
+0xff,0xf2,0x00,0x0e,0xff,0xff,0xef,0xfe,0x30,0x37,0x0a,0x21,0xff,0xc2,0xa0,0x00,
+0x10,0xd5,0x7c,0x02,0x21,0x98,0x62,0x67,0x01,0x10,0x84,0xc5,0x01,0xf1,0x05,0x8f,
+0xff,0x60,0x00,0xaf,0xf3,0xec,0x2e,0xc0,0x1c,0xff,0xa0,0xde,0x9f,0xd1,0xdf,0xfa,
+0x00,0x3e,0xff,0x80,0x02,0x11,0x2d,0x61,0x00,0x10,0x1c,0x4e,0x05,0x10,0x2d,0x38,
+0x04,0xf0,0x10,0x00,0xcf,0xaf,0xd2,0xef,0xf6,0x00,0xfb,0x0d,0xd0,0x2e,0xff,0x60,
+0xbf,0xef,0x80,0x02,0xef,0xf3,0x19,0xc8,0x00,0x00,0x16,0x40,0x00,0x02,0x66,0x66,
+0x12,0x00,0x64,0x00,0xf1,0x01,0x3f,0x40,0x00,0x0c,0xff,0xff,0x3f,0xf2,0xdf,0x6c,
+0xff,0xff,0x53,0x31,0xff,0x7c,0xfe,0x04,0x0f,0x06,0x00,0x0b,0x10,0x7b,0xd3,0x03,
+0x60,0xff,0xc2,0x33,0x33,0x33,0x20,0x00,0x01,0xe2,0x20,0x00,0x8a,0xaa,0xaa,0xa9,
+0x00,0x00,0x49,0x99,0x99,0x99,0x60,0x00,0xc4,0x06,0x10,0xfa,0x02,0x01,0x20,0x80,
+0xfa,0x1c,0x06,0x11,0xf3,0x06,0x00,0x72,0xf5,0xfe,0xaa,0xaa,0xaa,0xff,0xf5,0x0f,
+0x04,0x40,0xff,0xff,0x80,0x4f,0x06,0x00,0x20,0x10,0x0c,0x06,0x00,0x20,0x50,0x1e,
+0x06,0x00,0x51,0xfb,0xef,0xff,0xf5,0x9f,0x70,0x05,0x74,0xcd,0xdd,0xdd,0xdd,0xdd,
+0xd4,0xef,0x3d,0x08,0x05,0x01,0x00,0x7f,0xbc,0xcc,0xcc,0xcc,0xcc,0xc3,0xff,0x18,
+0x00,0x10,0x10,0x6b,0x12,0x00,0x22,0xcb,0x6f,0xfe,0x01,0x02,0x5e,0x07,0x11,0x95,
+0x0e,0x00,0x70,0x65,0xf9,0x3d,0xff,0xff,0xfd,0x39,0x03,0x00,0x20,0xf9,0x3d,0x10,
+0x00,0x11,0xa4,0x17,0x00,0x2c,0xb7,0xbf,0x2b,0x02,0x80,0x55,0x55,0x20,0x00,0x03,
+0xff,0xff,0x90,0x72,0x03,0x10,0x40,0x84,0x01,0x00,0xda,0x03,0x40,0xfc,0x44,0x40,
+0x0c,0xd2,0x0b,0x12,0x0e,0xa0,0x07,0x20,0xff,0xfe,0x45,0x02,0x10,0xf6,0xc9,0x01,
+0x10,0xc0,0xc3,0x06,0x50,0x30,0x00,0x00,0x03,0xfa,0xf4,0x01,0x10,0xf1,0x3e,0x03,
+0x14,0x50,0x9f,0x00,0xb0,0x35,0x6e,0xf7,0x54,0x00,0x00,0xff,0xf9,0x8f,0xff,0x10,
+0x1d,0x01,0x00,0x06,0x00,0xb0,0xfa,0x24,0x44,0x01,0x00,0xff,0xf4,0xef,0xff,0x3e,
+0x20,0x9b,0x06,0x20,0x3f,0xe2,0x06,0x00,0x21,0x43,0x31,0xa7,0x06,0x18,0xf6,0x06,
+0x00,0x40,0x23,0x30,0xff,0xff,0xb2,0x0a,0x02,0x06,0x00,0x72,0x7a,0xaa,0xaa,0xa2,
+0x00,0x00,0x03,0xfa,0x09,0x20,0x70,0x00,0xc9,0x0a,0x21,0xfa,0x10,0x50,0x06,0x10,
+0xd0,0x80,0x04,0xa1,0xff,0xf7,0x00,0x04,0xff,0xff,0xff,0xfb,0x00,0x07,0x92,0x0a,
+0x10,0x09,0x6d,0x00,0x20,0x00,0x0d,0x06,0x00,0x20,0x30,0x7f,0x06,0x00,0x12,0xd0,
+0x0b,0x07,0x20,0x13,0x33,0xb9,0x01,0x41,0x00,0x00,0xcf,0xf2,0xc4,0x0b,0x51,0x50,
+0x00,0x00,0x5a,0xaa,0x01,0x00,0x12,0x2f,0x03,0x01,0xf8,0x28,0xf9,0xfa,0x0d,0x01,
+0xb0,0xd0,0xa2,0x0f,0xaf,0xeb,0xfb,0xcf,0xbf,0xbe,0xcb,0xfa,0xff,0xe1,0x98,0x1c,
+0x1c,0x15,0xff,0xaf,0xfd,0x08,0x70,0xb0,0xb0,0x3f,0xfa,0xff,0xdf,0xdd,0xdd,0xdd,
+0xfd,0xdf,0xaf,0xa0,0xd0,0x00,0x00,0x0a,0x20,0xfa,0xfe,0xaf,0xaa,0xaa,0xaa,0xeb,
+0xaf,0x9a,0xff,0x80,0x01,0x31,0x41,0x00,0x00,0x9e,0x00,0x10,0xd0,0x09,0x03,0x30,
+0x8f,0xff,0xfc,0x68,0x00,0x60,0xff,0xff,0xff,0x50,0x00,0x03,0x69,0x01,0x41,0xe0,
 0x00,0x3c,0xff,0xae,0x00,0x00,0xdd,0x06,0x00,0x45,0x01,0x12,0x9e,0x10,0x08,0x00,
-0x8f,0x04,0x00,0xbb,0x18,0x00,0x9c,0x04,0x12,0xf9,0xa9,0x04,0x02,0x7f,0x03,0x13,
+0x8f,0x04,0x31,0xff,0xf1,0x00,0x9c,0x04,0x12,0xf9,0xa9,0x04,0x02,0x7f,0x03,0x13,
 0x05,0x0f,0x04,0x22,0x4f,0xf3,0x5f,0x00,0x70,0x76,0x00,0x00,0x00,0x34,0x44,0x43,
 0x4f,0x01,0x20,0xfb,0x8a,0x05,0x00,0xc1,0x8f,0xa0,0xff,0xff,0xfb,0x7f,0xf8,0xff,
 0xff,0xfc,0x11,0x11,0xaa,0x0c,0x0f,0x05,0x00,0x10,0x50,0xbd,0xdd,0xdd,0xdd,0xd8,
-0x9f,0x01,0x11,0x54,0xb5,0x04,0xf0,0x21,0x6c,0xff,0xff,0xff,0xd8,0x10,0x00,0x04,
-0xef,0xff,0xdb,0xbc,0xff,0xff,0x70,0x08,0xff,0xd6,0x10,0x00,0x00,0x4b,0xff,0xb0,
-0xbf,0x70,0x00,0x13,0x32,0x00,0x05,0xed,0x10,0x30,0x06,0xdf,0xff,0xfe,0x80,0x01,
-0x10,0x00,0x0b,0xff,0xfc,0xce,0xff,0xd2,0x2f,0x14,0x50,0x60,0x00,0x04,0xde,0x10,
-0x23,0x05,0x22,0x03,0x40,0xfc,0x0d,0x11,0x04,0xc6,0x00,0x00,0x8b,0x09,0x22,0xfa,
-0x00,0x06,0x04,0x10,0xac,0x72,0x04,0x03,0x19,0x0b,0x31,0xd2,0x0f,0xea,0x68,0x01,
-0xc1,0xcf,0x90,0xfa,0x48,0x88,0x88,0x88,0x88,0x65,0xff,0x1f,0xa9,0x3d,0x0c,0x32,
-0x1a,0xf1,0xfa,0xfa,0x02,0xc0,0xaf,0x1f,0xa5,0x99,0x99,0x99,0x99,0x98,0x5f,0xf1,
-0xfd,0x99,0x01,0x00,0x33,0x9b,0xfa,0x0b,0x98,0x02,0x06,0x3d,0x15,0x0f,0x4d,0x00,
-0x03,0x22,0x30,0x05,0x4d,0x00,0x23,0xf7,0x00,0x4d,0x00,0x22,0x70,0x01,0x4d,0x00,
+0xf0,0x33,0x00,0x00,0x00,0x35,0x54,0x10,0x00,0x00,0x00,0x00,0x6c,0xff,0xff,0xff,
+0xd8,0x10,0x00,0x04,0xef,0xff,0xdb,0xbc,0xff,0xff,0x70,0x08,0xff,0xd6,0x10,0x00,
+0x00,0x4b,0xff,0xb0,0xbf,0x70,0x00,0x13,0x32,0x00,0x05,0xed,0x10,0x30,0x06,0xdf,
+0xff,0xfe,0x80,0x01,0x10,0x00,0x0b,0xff,0xfc,0xce,0xff,0xd2,0x00,0x00,0x00,0xbe,
+0x60,0x00,0x04,0xde,0x3d,0x00,0x41,0x10,0x03,0x40,0x00,0x45,0x00,0x41,0x04,0xff,
+0x80,0x00,0x01,0x00,0x22,0x6f,0xfa,0x08,0x00,0x81,0x01,0xac,0x30,0x00,0x00,0x00,
+0xaf,0xff,0x01,0x00,0x40,0xd2,0x0f,0xea,0xaa,0x01,0x00,0xc0,0xcf,0x90,0xfa,0x48,
+0x88,0x88,0x88,0x88,0x65,0xff,0x1f,0xa9,0x18,0x00,0x50,0xfd,0x1a,0xf1,0xfa,0x9f,
+0x09,0x00,0xd0,0xd1,0xaf,0x1f,0xa5,0x99,0x99,0x99,0x99,0x98,0x5f,0xf1,0xfd,0x99,
+0x01,0x00,0x42,0x9b,0xfa,0x0b,0xff,0x01,0x00,0x12,0x30,0x50,0x00,0x0f,0x4d,0x00,
+0x06,0x22,0x30,0x05,0x4d,0x00,0x23,0xf7,0x00,0x4d,0x00,0x22,0x70,0x01,0x4d,0x00,
 0x2f,0x94,0x00,0x4d,0x00,0x1e,0x22,0x00,0x00,0x4d,0x00,0x23,0xf0,0x00,0x4d,0x00,
 0x22,0x00,0x00,0x4d,0x00,0x2f,0x90,0x00,0x4d,0x00,0x1d,0x23,0x85,0x00,0x4d,0x00,
 0x22,0xa0,0x00,0x4d,0x00,0x23,0xfa,0x00,0x4d,0x00,0x2f,0x60,0x00,0x4d,0x00,0x1d,
-0x22,0x00,0x00,0x4d,0x00,0x01,0x0c,0x02,0x00,0x4d,0x00,0x02,0x62,0x01,0x13,0xaf,
-0x11,0x00,0x0f,0x4d,0x00,0x09,0x00,0x01,0x00,0x23,0x5c,0x50,0x95,0x02,0x12,0xfc,
-0x58,0x13,0x11,0xd0,0x11,0x00,0x31,0x64,0x00,0xa5,0x56,0x09,0xf0,0x04,0xbf,0xf6,
-0x4e,0x21,0x11,0x11,0x17,0xd3,0x0f,0xff,0xec,0xce,0xec,0xcc,0xcc,0xef,0xe1,0x7f,
-0xe3,0x16,0x21,0x20,0x06,0x80,0xd9,0x01,0x32,0x97,0x0a,0xa6,0x44,0x00,0x14,0xcc,
-0x98,0x06,0x29,0x2f,0xfa,0x5c,0x00,0x20,0x01,0x10,0x89,0x00,0xf0,0x38,0xff,0xe8,
-0x00,0x00,0xdf,0xf8,0xcf,0xf8,0x00,0x7f,0xff,0x81,0xdf,0xf1,0x0c,0xfa,0xf8,0x52,
-0xdf,0x60,0xff,0x64,0x78,0x3a,0xf8,0x0f,0xff,0x50,0x08,0xff,0xa1,0xff,0xff,0x12,
-0xff,0xfa,0x0f,0xff,0x41,0x15,0xff,0xa0,0xef,0x46,0x88,0x48,0xf8,0x0b,0xfc,0xf8,
-0x42,0xef,0x50,0x5f,0xff,0x82,0xef,0xf1,0x00,0xaf,0xfa,0xef,0xf6,0x00,0x00,0x5a,
-0xdc,0xa4,0x00,0x00,0x01,0xa7,0x15,0x62,0x78,0x8b,0xff,0xfe,0x88,0x82,0x53,0x03,
-0x71,0x12,0x22,0x22,0x22,0x22,0x20,0x3f,0x9d,0x14,0xbf,0x3f,0xfc,0xfc,0xfe,0xdf,
-0x90,0x3f,0xd5,0xf4,0xeb,0x7f,0x06,0x00,0x07,0x61,0xe6,0xf5,0xec,0x8f,0x90,0x2f,
-0x54,0x03,0x52,0x07,0x9a,0xaa,0xaa,0xa9,0x95,0x07,0x12,0x14,0xf7,0x00,0x22,0xef,
-0xa0,0x89,0x06,0x10,0xf9,0x0d,0x00,0x30,0xc3,0xdf,0xff,0x3b,0x09,0x30,0xfd,0x3d,
-0xf5,0x1a,0x00,0x40,0xff,0xd3,0x50,0x00,0x49,0x06,0x02,0x0d,0x00,0x21,0xff,0x60,
-0x0d,0x00,0x15,0xf6,0x0d,0x00,0x11,0x0b,0x0d,0x00,0x00,0x51,0x04,0x11,0x60,0x88,
-0x07,0x11,0xf6,0x4b,0x07,0x13,0x86,0x66,0x01,0x10,0x8b,0x73,0x05,0x14,0xb6,0xb8,
-0x01,0xf0,0x0d,0xf2,0x00,0xbf,0xff,0xf8,0xbf,0xf6,0xef,0xff,0x40,0xbf,0xff,0xff,
-0x10,0xa4,0x09,0xff,0xf4,0xaf,0xff,0xff,0xfd,0x10,0x07,0xff,0xff,0x4d,0xff,0x21,
-0x09,0xf3,0x07,0xbf,0xff,0xf4,0x1d,0xff,0xff,0xf4,0x06,0x10,0xbf,0xff,0x40,0x1d,
-0xff,0xff,0x47,0xfd,0x2b,0xff,0xf4,0x00,0x1d,0xb7,0x01,0x00,0x2f,0x10,0x01,0xcf,
-0x06,0x50,0x08,0x99,0x99,0x70,0x00,0x52,0x0d,0x60,0x0a,0xd0,0xd0,0xd0,0xeb,0x9f,
-0x05,0x00,0x60,0xff,0xd1,0xd1,0xd1,0xeb,0xff,0xe6,0x04,0x0f,0x05,0x00,0x0b,0x10,
-0xef,0xc6,0x05,0x52,0x5c,0xdd,0xdd,0xdd,0xb2,0x9f,0x00,0x11,0xb0,0x37,0x05,0x20,
-0x0b,0xf0,0x70,0x08,0xa2,0x00,0x0f,0xf0,0x0a,0xff,0x21,0x11,0x11,0x1f,0xf0,0xad,
-0x00,0x12,0xf0,0x22,0x06,0x21,0xd0,0x08,0x4d,0x0f,0x00,0x84,0x18,0x02,0xd5,0x01,
-0x1d,0x00,0x01,0x00,0x02,0x3b,0x02,0x0e,0x01,0x00,0x04,0x8f,0x06,0x17,0xf4,0x14,
-0x00,0x7e,0xfb,0xfa,0x00,0xfe,0xfa,0x00,0xf8,0x49,0x00,0x02,0x4b,0x0a,0x3e,0x02,
-0x00,0x02,0x16,0x00,0x2f,0xef,0x00,0x01,0x00,0x15,0x1f,0xe9,0x1e,0x00,0x0a,0x03,
-0x88,0x00,0xa2,0xfa,0x00,0xff,0x00,0x00,0xf3,0xfe,0xf7,0xf9,0x00,0x70,0x08,0x00,
-0x0f,0x00,0x4d,0xfe,0xff,0xfb,0xfd,0x92,0x00,0x5a,0xfd,0x00,0xfe,0x00,0x00,0xd3,
-0x02,0x05,0x1a,0x00,0x0b,0x0a,0x00,0x19,0xff,0x1f,0x00,0x12,0xfe,0x07,0x00,0x13,
-0xf6,0x0b,0x00,0x00,0x48,0x00,0x3f,0xfe,0xfc,0xfe,0x9c,0x00,0x0a,0x15,0x02,0x3c,
-0x00,0x11,0xfe,0x34,0x00,0x26,0xfe,0xfd,0x30,0x00,0x11,0xe8,0x04,0x01,0x15,0xe5,
-0x24,0x00,0x20,0xfd,0xfe,0x20,0x00,0x01,0x2b,0x00,0x0d,0x44,0x00,0x10,0xfd,0x08,
-0x00,0x1f,0xfd,0x68,0x00,0x07,0x1f,0xfe,0x43,0x01,0x0d,0x19,0xfa,0xdf,0x00,0x01,
-0xbd,0x00,0x10,0xfd,0x38,0x00,0x12,0xfc,0x09,0x01,0x14,0xde,0x6c,0x00,0x97,0xf9,
-0x00,0x00,0xe4,0xfb,0xee,0xf1,0x00,0xe8,0x08,0x02,0x25,0xf2,0xf7,0x0c,0x00,0x10,
-0xdf,0x03,0x1b,0x23,0x00,0xec,0x43,0x00,0x20,0xfd,0x00,0x2f,0x05,0x00,0x32,0x05,
-0x0f,0xe0,0x01,0x01,0x10,0xfc,0xd2,0x00,0x1f,0xfc,0x97,0x00,0x0b,0x37,0xf8,0x00,
-0xfe,0x3e,0x0e,0x0a,0x7b,0x02,0x93,0xea,0xe8,0x00,0x00,0xf8,0xfd,0xe8,0xfe,0x02,
-0x40,0x02,0xd3,0xf5,0xf6,0x00,0xf5,0xf6,0xf8,0xf4,0x00,0xf6,0xf9,0xfa,0xf8,0xfa,
-0x1a,0x01,0x66,0xe9,0xfc,0x00,0x00,0xf8,0xff,0x2b,0x01,0xa4,0xfb,0xfc,0x00,0x00,
-0xfb,0xfd,0x00,0x00,0xfd,0xff,0x7d,0x01,0x42,0x02,0x00,0xf4,0xfa,0x51,0x00,0x13,
-0x01,0xbf,0x04,0x23,0xfd,0xfd,0x6c,0x01,0x08,0xf8,0x02,0x14,0xfb,0x20,0x01,0x15,
-0x01,0x01,0x02,0x02,0xb0,0x01,0x04,0x30,0x01,0xf0,0x0a,0x02,0xfb,0xeb,0xfb,0x00,
-0x00,0xf6,0xfd,0xf6,0xfe,0x02,0xf6,0x02,0x02,0x01,0x02,0x00,0x02,0xf9,0xf9,0xfe,
-0xfc,0xf9,0xfc,0xfa,0x03,0x02,0x46,0xfe,0xfd,0x02,0xfb,0x20,0x05,0x1a,0xfd,0x99,
-0x01,0x02,0x48,0x00,0x1e,0xfd,0xb2,0x01,0x0f,0xb5,0x01,0x04,0x1e,0xf9,0x31,0x01,
-0x0d,0xe9,0x01,0x1f,0xfd,0x24,0x00,0x09,0x12,0xff,0x43,0x02,0x1f,0xff,0x5a,0x03,
-0x10,0x1f,0xff,0x1d,0x00,0x10,0x1e,0x02,0xdd,0x01,0x19,0x02,0xbc,0x00,0x16,0x02,
-0x14,0x04,0x0f,0x01,0x00,0x1e,0x0b,0x04,0x01,0x1f,0xf2,0x2c,0x00,0x0b,0x23,0xfe,
-0xfe,0xd7,0x01,0x1c,0xf4,0x31,0x02,0x11,0xfe,0x93,0x00,0x10,0x05,0x2b,0x02,0x0f,
-0x6f,0x00,0x15,0x2e,0x02,0x00,0xb8,0x00,0x3d,0xfe,0xff,0x01,0x97,0x01,0x1f,0xf3,
-0xd8,0x00,0x24,0x1f,0xfe,0x24,0x00,0x26,0x0f,0x3d,0x00,0x07,0x13,0x01,0xd5,0x02,
-0x10,0x03,0x80,0x09,0x3d,0x00,0x04,0x05,0x21,0x00,0x30,0x06,0x07,0x08,0xac,0x2b,
-0xf2,0x05,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,
-0x14,0x15,0x16,0x17,0x18,0x19,0x4a,0x08,0x70,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,
-0x67,0x1c,0xff,0x01,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,
-0x24,0x27,0x28,0x00,0x01,0x00,0x5e,0x02,0xce,0x00,0x20,0x03,0x02,0xc9,0x00,0x4b,
-0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,
-0x21,0x0c,0x00,0x08,0x00,0xd0,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,
-0x00,0x00,0x15,0x7f,0x18,0x62,0x00,0x17,0x17,0x17,0x18,0x17,0xf2,0x0f,0xff,0x01,
-0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,
-0x8f,0x00,0x1e,0x1f,0x24,0xc8,0x00,0x25,0x50,0x00,0x00,0x00,0x00,0x00,
+0x22,0x00,0x00,0x4d,0x00,0x00,0x4b,0x00,0x01,0x4d,0x00,0x02,0x62,0x01,0x13,0xaf,
+0x11,0x00,0x0f,0x4d,0x00,0x09,0x00,0x01,0x00,0x21,0x5c,0x50,0x07,0x00,0x31,0x07,
+0xef,0xfc,0x08,0x00,0x21,0x03,0xd0,0x11,0x00,0x30,0x64,0x00,0xa5,0xc1,0x01,0xf0,
+0x0b,0x00,0xbf,0xf6,0x4e,0x21,0x11,0x11,0x17,0xd3,0x0f,0xff,0xec,0xce,0xec,0xcc,
+0xcc,0xef,0xe1,0x7f,0xe3,0x00,0x2d,0x00,0x00,0x06,0x80,0xd9,0x01,0x32,0x97,0x0a,
+0xa6,0x44,0x00,0x32,0xcc,0xff,0xa0,0x09,0x00,0x29,0x2f,0xfa,0x5c,0x00,0x20,0x01,
+0x10,0x89,0x00,0xf1,0x42,0xff,0xe8,0x00,0x00,0xdf,0xf8,0xcf,0xf8,0x00,0x7f,0xff,
+0x81,0xdf,0xf1,0x0c,0xfa,0xf8,0x52,0xdf,0x60,0xff,0x64,0x78,0x3a,0xf8,0x0f,0xff,
+0x50,0x08,0xff,0xa1,0xff,0xff,0x12,0xff,0xfa,0x0f,0xff,0x41,0x15,0xff,0xa0,0xef,
+0x46,0x88,0x48,0xf8,0x0b,0xfc,0xf8,0x42,0xef,0x50,0x5f,0xff,0x82,0xef,0xf1,0x00,
+0xaf,0xfa,0xef,0xf6,0x00,0x00,0x5a,0xdc,0xa4,0x00,0x00,0x01,0x56,0x63,0x00,0x00,
+0x78,0x8b,0xff,0xfe,0x88,0x82,0xc6,0x00,0x80,0xf5,0x12,0x22,0x22,0x22,0x22,0x20,
+0x3f,0x0c,0x00,0xcf,0x90,0x3f,0xfc,0xfc,0xfe,0xdf,0x90,0x3f,0xd5,0xf4,0xeb,0x7f,
+0x06,0x00,0x07,0x60,0xe6,0xf5,0xec,0x8f,0x90,0x2f,0x30,0x00,0x71,0x80,0x07,0x9a,
+0xaa,0xaa,0xa9,0x10,0xa4,0x00,0x12,0x14,0xf7,0x00,0x11,0xef,0xc2,0x00,0x30,0x0c,
+0xff,0xf9,0x0d,0x00,0xa0,0xc3,0xdf,0xff,0x00,0x00,0x00,0x3e,0xfd,0x3d,0xf5,0x1a,
+0x00,0x82,0xff,0xd3,0x50,0x00,0x00,0x3e,0xff,0xff,0x0d,0x00,0x21,0xff,0x60,0x0d,
+0x00,0x15,0xf6,0x0d,0x00,0x11,0x0b,0x0d,0x00,0x21,0x00,0x0d,0x0d,0x00,0x21,0x00,
+0x0f,0x0d,0x00,0x33,0x00,0x08,0x86,0x66,0x01,0x64,0x8b,0xcc,0xcc,0xcc,0xcc,0xb6,
+0xb8,0x01,0xf4,0x27,0xf2,0x00,0xbf,0xff,0xf8,0xbf,0xf6,0xef,0xff,0x40,0xbf,0xff,
+0xff,0x10,0xa4,0x09,0xff,0xf4,0xaf,0xff,0xff,0xfd,0x10,0x07,0xff,0xff,0x4d,0xff,
+0xff,0xff,0xf4,0x00,0xbf,0xff,0xf4,0x1d,0xff,0xff,0xf4,0x06,0x10,0xbf,0xff,0x40,
+0x1d,0xff,0xff,0x47,0xfd,0x2b,0xff,0xf4,0x00,0x1d,0xb7,0x01,0x11,0x1c,0x08,0x00,
+0xf0,0x02,0xa0,0x00,0x08,0x99,0x99,0x70,0x00,0xbf,0xff,0xff,0xf8,0x0a,0xd0,0xd0,
+0xd0,0xeb,0x9f,0x05,0x00,0x50,0xff,0xd1,0xd1,0xd1,0xeb,0x1e,0x00,0x1f,0xfb,0x05,
+0x00,0x0b,0xa2,0xef,0xff,0xff,0xff,0xfa,0x5c,0xdd,0xdd,0xdd,0xb2,0x9f,0x00,0xf2,
+0x07,0xb0,0x00,0x03,0x00,0x00,0x00,0x0b,0xf0,0x00,0x9f,0x10,0x00,0x00,0x0f,0xf0,
+0x0a,0xff,0x21,0x11,0x11,0x1f,0xf0,0xad,0x00,0x21,0xf0,0x9f,0x07,0x00,0x32,0xd0,
+0x08,0xff,0x2a,0x01,0x12,0x7f,0x07,0x00,0x60,0x01,0x00,0x00,0x00,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -605,11 +613,17 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 1524, .range_length = 62127, .glyph_id_start = 143, .list_length = 63, .type = 3, .unicode_list = 1648, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[13150] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 2119, .size = 4068, .comp_size = 3617 },
+{ .bitmap_start = 4068, .comp_offset = 5736, .size = 4070, .comp_size = 3176 },
+{ .bitmap_start = 8138, .comp_offset = 8912, .size = 1058, .comp_size = 687 },
+};
+
+static uint8_t etxUncompBuf[3954] __SDRAMFONTS;
 
 const etxLz4Font lv_font_he_XXS = {
-.uncomp_size = 12822,
-.comp_size = 9470,
+.uncomp_size = 3626,
+.comp_size = 2119,
 .line_height = 15,
 .base_line = 3,
 .subpx = 0,
@@ -622,12 +636,13 @@ const etxLz4Font lv_font_he_XXS = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 36,
-.glyph_bitmap = 1774,
-.class_pair_values = 10970,
-.left_class_mapping = 12410,
-.right_class_mapping = 12616,
+.class_pair_values = 1774,
+.left_class_mapping = 3214,
+.right_class_mapping = 3420,
+.block_num = 3,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 13150,
+.lvglFontBufSize = 3954,
 };
@@ -92,7 +92,7 @@ static const uint8_t lz4FontData[] ={
 0x08,0x00,0x22,0x5d,0x6d,0x08,0x00,0xf2,0x03,0x4d,0x6e,0x00,0x1e,0x1f,0x14,0x00,
 0xff,0x83,0x6f,0x00,0x15,0x13,0x18,0x01,0xfd,0x67,0x70,0x60,0x00,0x21,0x63,0x71,
 0xa8,0x00,0xb2,0xfc,0x9c,0x72,0x00,0x1e,0x1e,0x12,0x00,0x00,0xaa,0x73,0x60,0x00,
-0xf0,0xe0,0x82,0x74,0x20,0x18,0x19,0x10,0x00,0x01,0x00,0x00,0x2e,0x1a,0x71,0x1c,
+0xf8,0x78,0x82,0x74,0x20,0x18,0x19,0x10,0x00,0x01,0x00,0x00,0x2e,0x1a,0x71,0x1c,
 0x0d,0xea,0x14,0xea,0x17,0xea,0x18,0xea,0x19,0xea,0x1d,0xea,0x1f,0xea,0x21,0xea,
 0x25,0xea,0x28,0xea,0x2d,0xea,0x32,0xea,0x33,0xea,0x34,0xea,0x4a,0xea,0x4f,0xea,
 0x54,0xea,0x57,0xea,0x58,0xea,0x59,0xea,0x5d,0xea,0x5e,0xea,0x5f,0xea,0x60,0xea,
@@ -100,1026 +100,1123 @@ static const uint8_t lz4FontData[] ={
 0x85,0xea,0x87,0xea,0x9f,0xea,0xa1,0xea,0xd0,0xea,0xd1,0xea,0xd3,0xea,0xd5,0xea,
 0xec,0xea,0xf3,0xea,0xf6,0xea,0xff,0xea,0x28,0xeb,0x30,0xeb,0x67,0xeb,0xf7,0xeb,
 0x4c,0xec,0x4d,0xec,0x4e,0xec,0x4f,0xec,0x50,0xec,0x93,0xec,0x9f,0xec,0xf9,0xec,
-0x10,0xed,0x66,0xef,0xce,0xf1,0xae,0xf2,0x7f,0xff,0x16,0xff,0xf1,0x6f,0xff,0x05,
-0xff,0xf0,0x5f,0xff,0x04,0xff,0xf0,0x3f,0xfe,0x03,0xff,0xe0,0x2f,0xfd,0x02,0xff,
-0xd0,0x1f,0xfc,0x01,0xee,0xb0,0x00,0x00,0x00,0x58,0x30,0x5f,0xff,0x17,0xff,0xf2,
-0x1c,0xf9,0x00,0x4f,0xf2,0x6f,0xe4,0xff,0x16,0xfe,0x4f,0xf0,0x6f,0xd4,0xff,0x06,
-0xfb,0x4f,0xd0,0x6f,0xa4,0xfb,0x06,0xf8,0x17,0x50,0x37,0x30,0x00,0x00,0x08,0xf9,
-0x01,0xff,0x00,0x00,0x00,0x0b,0xf7,0x04,0xfd,0x00,0x00,0x00,0x0d,0xf4,0x07,0xfb,
-0x00,0x00,0x00,0x0f,0xf1,0x0a,0xf8,0x00,0x00,0x11,0x4f,0xe1,0x1c,0xf6,0x10,0x06,
-0xff,0x01,0x00,0x13,0xfd,0x07,0x00,0xf1,0x07,0x00,0x00,0xcf,0x60,0x5f,0xc0,0x00,
-0x00,0x00,0xff,0x30,0x8f,0x90,0x00,0x00,0x02,0xff,0x00,0xbf,0x60,0x00,0x4f,0x1c,
-0x00,0x13,0xf0,0x07,0x00,0x00,0x4c,0x00,0x17,0xfe,0x4c,0x00,0xf0,0x02,0xf2,0x09,
-0xf8,0x00,0x00,0x00,0x2f,0xf0,0x0c,0xf6,0x00,0x00,0x00,0x5f,0xc0,0x0f,0xf3,0x99,
-0x07,0x20,0x02,0x30,0x06,0x00,0x25,0x0a,0xf3,0x06,0x00,0xc0,0x03,0x8e,0xfa,0x40,
-0x00,0x00,0xaf,0xff,0xff,0xfc,0x10,0x09,0x47,0x00,0xd0,0xb0,0x1f,0xff,0xb1,0x19,
-0xff,0xf3,0x3f,0xff,0x30,0x00,0xef,0xf8,0x06,0x00,0x40,0x9c,0xc7,0x1f,0xff,0xd6,
-0x00,0x51,0x09,0xff,0xfe,0x71,0x00,0x2a,0x00,0xf0,0x0d,0x81,0x00,0x00,0x05,0xdf,
-0xff,0xfe,0x30,0x00,0x00,0x04,0xbf,0xff,0xe0,0x00,0x00,0x00,0x05,0xff,0xf6,0xce,
-0xe7,0x00,0x00,0xdf,0xf9,0xcf,0xfb,0x06,0x00,0x70,0x7f,0xff,0x81,0x18,0xff,0xf6,
-0x1e,0x4e,0x00,0xf3,0x03,0xe0,0x02,0xdf,0xff,0xff,0xfd,0x20,0x00,0x04,0x9f,0xf9,
-0x50,0x00,0x00,0x00,0x0e,0xf0,0x00,0x06,0x00,0x40,0x05,0xcf,0xea,0x20,0x0c,0x00,
-0x40,0x6f,0xff,0xff,0xe1,0x08,0x00,0xf2,0x07,0xcf,0xa0,0x2e,0xf6,0x00,0x4f,0x70,
-0x00,0xef,0x50,0x0b,0xf8,0x00,0xef,0x30,0x00,0xcf,0xa0,0x1e,0xf6,0x09,0xf8,0x20,
-0x00,0x22,0x3f,0xd0,0x30,0x00,0x21,0xdf,0x40,0x5c,0x08,0x22,0x08,0xfa,0x64,0x08,
-0x22,0x3f,0xe1,0x08,0x00,0xf0,0x06,0xdf,0x52,0xbe,0xeb,0x20,0x00,0x00,0x07,0xfb,
-0x2f,0xff,0xff,0xf2,0x00,0x00,0x2f,0xf1,0x9f,0xd1,0x1e,0xf8,0x30,0x01,0x81,0xbf,
-0x80,0x09,0xfa,0x00,0x07,0xfc,0x00,0x08,0x00,0xb1,0x0d,0xf2,0x00,0x9f,0xd1,0x1d,
-0xf8,0x00,0x00,0x30,0x00,0x28,0x00,0x00,0x0c,0x01,0x01,0x38,0x00,0x31,0x7d,0xff,
-0xc4,0x0d,0x01,0x40,0xff,0xff,0xff,0x60,0x29,0x01,0xc0,0xff,0xdd,0xff,0xf1,0x00,
-0x00,0x00,0x9f,0xf9,0x00,0xbf,0xf4,0xf0,0x00,0x30,0xf5,0x00,0x9f,0x28,0x01,0xd0,
-0x7f,0xfb,0x04,0xff,0xd0,0x00,0x00,0x00,0x1f,0xff,0xcf,0xfe,0x30,0xe9,0x08,0x30,
-0xff,0xff,0xc2,0x38,0x00,0xf1,0x2a,0x1b,0xff,0xff,0x30,0x02,0x66,0x20,0x01,0xdf,
-0xff,0xff,0xe2,0x08,0xff,0x60,0x0a,0xff,0xd2,0xef,0xfd,0x1b,0xff,0x40,0x0f,0xff,
-0x50,0x2f,0xff,0xcf,0xff,0x10,0x2f,0xff,0x40,0x04,0xff,0xff,0xfb,0x00,0x0f,0xff,
-0xa0,0x00,0x6f,0xff,0xf3,0x00,0x09,0xff,0xfc,0x8a,0xff,0xff,0xf5,0x00,0x00,0xcf,
-0xb5,0x01,0xf2,0x08,0x30,0x00,0x06,0xcf,0xfe,0xc8,0x2c,0xff,0xe2,0x4f,0xf3,0x4f,
-0xf3,0x4f,0xf2,0x4f,0xf1,0x4f,0xf0,0x4f,0xf0,0x28,0x70,0xd9,0x00,0xf0,0x38,0x97,
-0x00,0x00,0xcf,0xd0,0x00,0xaf,0xf3,0x00,0x4f,0xf6,0x00,0x0d,0xfd,0x00,0x04,0xff,
-0x60,0x00,0xaf,0xf1,0x00,0x0f,0xfd,0x00,0x02,0xff,0x90,0x00,0x5f,0xf8,0x00,0x07,
-0xff,0x60,0x00,0x8f,0xf5,0x00,0x08,0xff,0x50,0x00,0x7f,0xf6,0x00,0x06,0xff,0x70,
-0x00,0x4f,0xf8,0x00,0x00,0xff,0xc0,0x00,0x0c,0xff,0x00,0x00,0x6f,0xf4,0x00,0x01,
-0xff,0xa0,0x00,0x07,0xff,0x30,0x3c,0x00,0xa0,0x00,0x2e,0xfb,0x00,0x00,0x2d,0x90,
-0x00,0x00,0x01,0x59,0x00,0x21,0x1d,0x30,0x20,0x00,0xd0,0x00,0x0b,0xff,0x20,0x00,
-0x01,0xef,0xc0,0x00,0x00,0x6f,0xf6,0x00,0x58,0x00,0xf0,0x03,0x00,0x0a,0xff,0x30,
-0x00,0x07,0xff,0x80,0x00,0x03,0xff,0xc0,0x00,0x01,0xff,0xf0,0x00,0x00,0x04,0x00,
-0x00,0x0f,0x01,0x21,0xef,0xf1,0x0c,0x00,0x00,0x14,0x00,0xf1,0x00,0x02,0xff,0xd0,
-0x00,0x05,0xff,0x90,0x00,0x09,0xff,0x50,0x00,0x0d,0xfe,0x00,0x74,0x00,0x60,0xcf,
-0xe1,0x00,0x07,0xff,0x50,0x94,0x00,0x61,0x00,0x3f,0x80,0x00,0x00,0x02,0xbf,0x00,
-0x10,0x8f,0x36,0x02,0x20,0x07,0xfa,0x0f,0x00,0xa0,0x7f,0x90,0x01,0x04,0xfc,0x56,
-0xf8,0x39,0xf4,0x8f,0xf5,0x00,0xa0,0x90,0x16,0xbf,0xff,0xc8,0x30,0x00,0x08,0xff,
-0xf6,0x3b,0x02,0xd0,0x6f,0xf3,0x00,0x02,0xff,0x70,0x9f,0xe1,0x00,0x1b,0xd0,0x01,
-0xec,0xdd,0x03,0x11,0x02,0xe5,0x01,0x62,0x88,0x10,0x00,0x00,0x00,0x01,0xa9,0x01,
-0x3a,0x1f,0xff,0x20,0x0d,0x00,0x11,0x05,0x3d,0x01,0x21,0xf5,0x5f,0x07,0x00,0x12,
-0x55,0x0d,0x00,0x6f,0x01,0x11,0x2f,0xff,0x31,0x11,0x34,0x00,0x06,0x00,0x6b,0x00,
-0xe0,0x70,0x5f,0xf7,0x05,0xff,0x70,0x7f,0xf5,0x0b,0xff,0x02,0xff,0x80,0x3d,0x4e,
-0x03,0xf0,0x06,0x8b,0xbb,0xbb,0xab,0xff,0xff,0xfe,0xbf,0xff,0xff,0xe0,0x06,0x94,
-0x05,0xff,0xf2,0x7f,0xff,0x31,0xcf,0xa0,0x31,0x00,0x10,0xf7,0x9c,0x02,0x00,0x3c,
-0x00,0x20,0xbf,0xc0,0x46,0x00,0x40,0x70,0x00,0x00,0x06,0x44,0x00,0x25,0x0b,0xfc,
-0x1d,0x00,0x10,0xf1,0xb6,0x02,0x00,0x1d,0x00,0x00,0x37,0x02,0x70,0x07,0xff,0x10,
-0x00,0x00,0x0c,0xfb,0x1d,0x00,0x10,0xf6,0x2d,0x02,0x01,0x1d,0x00,0x10,0xb0,0xa8,
-0x03,0x04,0x1d,0x00,0x20,0x0d,0xfb,0x0e,0x01,0x10,0x83,0x8e,0x00,0xf0,0x1b,0x18,
-0xdf,0xfc,0x70,0x00,0x02,0xef,0xff,0xff,0xfc,0x00,0x0d,0xff,0xfd,0xef,0xff,0x90,
-0x5f,0xff,0x40,0x08,0xff,0xf1,0x9f,0xfc,0x00,0x00,0xff,0xf5,0xcf,0xf9,0x00,0x00,
-0xcf,0xf8,0xdf,0xf8,0x00,0x00,0xbf,0xf9,0xef,0x06,0x00,0x18,0xfa,0x06,0x00,0x02,
-0x18,0x00,0x00,0x24,0x00,0x22,0xdf,0xf8,0x30,0x00,0x11,0x4f,0x3c,0x00,0x02,0x48,
-0x00,0x02,0x54,0x00,0x01,0x60,0x00,0x00,0xfc,0x00,0x61,0x7c,0x60,0x01,0x6b,0xff,
-0xf6,0xd9,0x02,0xc0,0xff,0xff,0xff,0xf6,0x0f,0xc7,0x2f,0xff,0x60,0x10,0x00,0xff,
-0xec,0x01,0x00,0x97,0x00,0x0f,0x09,0x00,0x19,0x60,0x02,0x9d,0xff,0xd8,0x10,0x00,
-0x8c,0x04,0xf0,0x00,0xfe,0x20,0x04,0xff,0xff,0xce,0xff,0xfc,0x00,0xcf,0xfd,0x20,
-0x0a,0xff,0xf2,0x1d,0x00,0x81,0x3f,0xff,0x41,0x88,0x82,0x00,0x02,0xff,0x55,0x04,
-0x30,0x7f,0xfe,0x00,0x76,0x04,0x20,0xff,0x70,0x68,0x02,0x01,0x32,0x03,0x31,0x0c,
-0xff,0xe2,0x06,0x00,0x15,0xf3,0x06,0x00,0x35,0x0b,0xff,0xf4,0x06,0x00,0x81,0x0a,
-0xff,0xfe,0xcc,0xcc,0xcc,0xa0,0xdf,0xe6,0x04,0x11,0x0d,0xcb,0x01,0x60,0xd0,0x00,
-0x04,0xae,0xfe,0xc7,0x72,0x04,0x00,0x3c,0x04,0x12,0x07,0x6f,0x00,0x10,0xdf,0xa0,
-0x04,0x80,0xf2,0x08,0x99,0x30,0x00,0x1f,0xff,0x40,0xb8,0x04,0x11,0xff,0xbe,0x04,
-0x21,0xcf,0xfc,0x8b,0x03,0x21,0xfc,0x10,0x2b,0x04,0x91,0x50,0x00,0x00,0x04,0xab,
-0xdf,0xff,0x90,0x00,0xc9,0x03,0x01,0xeb,0x04,0xd1,0xef,0xf8,0x2c,0xcc,0x20,0x00,
-0x0d,0xff,0x81,0xff,0xfb,0x00,0x06,0x0e,0x01,0x51,0xce,0xff,0xfe,0x00,0x0b,0xca,
-0x00,0x51,0x00,0x05,0xbe,0xff,0xc7,0xac,0x02,0x12,0x09,0xbd,0x00,0x12,0x3f,0x07,
-0x00,0x11,0xdf,0x07,0x00,0x21,0x08,0xff,0x07,0x00,0x21,0x2f,0xfe,0x07,0x00,0x40,
-0xcf,0xf5,0xff,0xf3,0xcb,0x01,0x10,0x73,0x07,0x00,0x21,0x2f,0xfc,0x7f,0x00,0x20,
-0xcf,0xf3,0x07,0x00,0x30,0x06,0xff,0x80,0x07,0x00,0x72,0x1f,0xff,0xcb,0xbc,0xff,
-0xfc,0xb1,0x94,0x02,0x22,0xf1,0x3f,0x07,0x00,0x05,0xa9,0x00,0x1e,0x00,0x07,0x00,
-0x01,0xda,0x05,0x21,0xf3,0x08,0x06,0x00,0x81,0x0a,0xff,0xed,0xdd,0xdd,0xd2,0x0c,
-0xff,0x25,0x05,0x01,0xb9,0x00,0x40,0x0f,0xff,0x36,0x87,0xec,0x00,0x41,0xff,0xff,
-0xfb,0x10,0x4d,0x00,0x71,0xc0,0x18,0xcc,0x30,0x2b,0xff,0xf4,0xd4,0x00,0x20,0xf9,
-0x00,0x9a,0x02,0x20,0xfb,0x00,0xa0,0x04,0x20,0xfb,0xaf,0x75,0x05,0xf1,0x00,0xfa,
-0x7f,0xff,0x40,0x06,0xff,0xf5,0x0e,0xff,0xfd,0xdf,0xff,0xd0,0x03,0xef,0xde,0x00,
-0x40,0x17,0xcf,0xfd,0x81,0xaa,0x04,0x81,0xbe,0xf5,0x00,0x00,0x04,0xef,0xff,0xf5,
-0x23,0x01,0x91,0xd4,0x00,0x03,0xff,0xfb,0x30,0x00,0x00,0x0d,0x26,0x01,0xd0,0x4f,
-0xff,0x27,0xab,0x81,0x00,0x8f,0xfd,0xef,0xff,0xff,0x40,0xbf,0x66,0x00,0xd0,0xe1,
-0xcf,0xff,0x81,0x19,0xff,0xf7,0xdf,0xfa,0x00,0x00,0xcf,0xfc,0x68,0x02,0x40,0x8f,
-0xfe,0xbf,0xfa,0x06,0x00,0xf0,0x03,0x8f,0xfe,0x00,0x00,0xbf,0xfc,0x3f,0xff,0x70,
-0x05,0xff,0xf7,0x0a,0xff,0xfe,0xdf,0xff,0xe0,0xc3,0x04,0x10,0xfe,0xc1,0x04,0x23,
-0xfd,0x81,0x8a,0x06,0x11,0xc4,0x06,0x00,0x80,0xfc,0x3c,0xcc,0xcc,0xcc,0xcf,0xff,
-0x80,0x62,0x05,0x01,0x02,0x01,0x32,0x00,0x9f,0xfa,0x85,0x03,0x11,0x30,0x56,0x01,
-0x30,0xc0,0x00,0x00,0xb9,0x02,0x06,0x2d,0x02,0x11,0x0e,0x2d,0x02,0x10,0x06,0x6c,
-0x04,0x00,0x3f,0x06,0x02,0xbd,0x01,0x11,0x20,0x2e,0x02,0x11,0xb0,0x2c,0x01,0x11,
-0xf4,0xef,0x00,0x12,0xfd,0x59,0x02,0x10,0x60,0x07,0x00,0x42,0x3a,0xef,0xfd,0x81,
-0x8f,0x02,0xf0,0x00,0x30,0x2f,0xff,0xfc,0xdf,0xff,0xd0,0x6f,0xff,0x30,0x07,0xff,
-0xf3,0x7f,0xfe,0x87,0x02,0x10,0x3f,0x0c,0x00,0x20,0xf0,0x0a,0x18,0x00,0x30,0x60,
-0x00,0x9f,0x6e,0x05,0x11,0x07,0x6c,0x05,0x80,0x3f,0xff,0x71,0x1a,0xff,0xe0,0xaf,
-0xfb,0xd7,0x02,0x10,0xdf,0xb6,0x04,0x30,0xf9,0xdf,0xfa,0x4d,0x01,0x70,0xaf,0xff,
-0x30,0x06,0xff,0xf6,0x3f,0x3b,0x01,0x12,0xe0,0x54,0x00,0x50,0x00,0x3a,0xdf,0xfd,
-0x81,0x49,0x03,0x30,0xeb,0x30,0x00,0x4d,0x01,0x30,0xf7,0x00,0x1e,0x61,0x03,0xf0,
-0x00,0x40,0x7f,0xff,0x40,0x0b,0xff,0xd0,0xcf,0xfa,0x00,0x02,0xff,0xf2,0xef,0xf7,
-0x48,0x00,0x80,0xff,0xf7,0x00,0x00,0xef,0xf7,0xdf,0xfb,0x69,0x02,0x10,0x8f,0x60,
-0x00,0x11,0xf7,0xf8,0x06,0xd1,0xf6,0x03,0xef,0xff,0xfc,0xff,0xf4,0x00,0x06,0x98,
-0x43,0xff,0xf0,0xec,0x02,0xa0,0xa0,0x00,0x00,0x03,0xbf,0xff,0x20,0x00,0x6d,0xff,
-0x33,0x00,0x11,0x7f,0x6d,0x06,0xe2,0x7f,0xec,0x71,0x00,0x00,0x1c,0xf9,0x07,0xff,
-0xf3,0x5f,0xff,0x20,0x69,0xde,0x06,0x04,0x01,0x00,0xfd,0x08,0x69,0x40,0x5f,0xff,
-0x27,0xff,0xf3,0x1c,0xfa,0x00,0x02,0xdf,0x70,0x0a,0xff,0xf0,0x08,0xff,0xe0,0x00,
-0x79,0x20,0x00,0x01,0x00,0xf2,0x07,0x01,0xee,0xa0,0x01,0xff,0xc0,0x01,0xff,0xb0,
-0x03,0xff,0x90,0x07,0xff,0x50,0x0d,0xfd,0x00,0x1d,0xf3,0x00,0x00,0x29,0x00,0x50,
-0x17,0x90,0x00,0x00,0x03,0xf0,0x00,0xf0,0x03,0x5c,0xff,0xff,0xb0,0x17,0xef,0xff,
-0xff,0xb4,0x4f,0xff,0xff,0xd7,0x10,0x05,0xff,0xfa,0x30,0x63,0x01,0x20,0xfc,0x61,
-0xfe,0x06,0x30,0xff,0xfb,0x50,0xc8,0x07,0x00,0x6b,0x01,0x21,0x29,0xff,0x53,0x02,
-0x21,0x7d,0xb0,0x1e,0x07,0x11,0x6f,0xc2,0x02,0x02,0x06,0x00,0x68,0x5c,0xcc,0xcc,
-0xcc,0xcc,0xc0,0x78,0x00,0x02,0x12,0x00,0x08,0x24,0x00,0x21,0x88,0x10,0x49,0x03,
-0x10,0xa4,0xf1,0x01,0xe0,0xff,0xfd,0x60,0x00,0x03,0xaf,0xff,0xff,0xf9,0x20,0x00,
-0x05,0xbf,0xff,0xe0,0x01,0xf1,0x05,0x18,0xff,0xf9,0x00,0x00,0x5b,0xff,0xff,0x90,
-0x4a,0xff,0xff,0xfe,0x82,0x9f,0xff,0xff,0xd6,0x00,0x09,0x88,0x00,0x34,0x9e,0x81,
-0x00,0x32,0x06,0x20,0x00,0x29,0x77,0x01,0x10,0x04,0x83,0x01,0x20,0x10,0x0e,0x71,
-0x01,0x20,0xa0,0x5f,0x52,0x07,0x51,0xf0,0x4b,0xba,0x00,0x05,0x4a,0x02,0x11,0x08,
-0x6f,0x08,0x10,0x3f,0x50,0x00,0x11,0x04,0xac,0x00,0x11,0x2f,0x22,0x02,0x21,0xaf,
-0xfc,0x3a,0x02,0x01,0x27,0x02,0x26,0xab,0xb0,0xa4,0x00,0x21,0x39,0x50,0x03,0x06,
-0x11,0xf5,0x45,0x02,0x11,0xf7,0x8a,0x02,0x11,0xc1,0x19,0x00,0x51,0x04,0x9d,0xff,
-0xec,0x82,0x0a,0x00,0x10,0x2c,0xbb,0x00,0x02,0x73,0x02,0xb1,0xfe,0x72,0x00,0x03,
-0x8f,0xfd,0x10,0x00,0x00,0x4f,0xfb,0x25,0x07,0x42,0xfb,0x00,0x00,0x1e,0x6b,0x08,
-0xe0,0x1e,0xf5,0x00,0x08,0xfe,0x10,0x00,0x6d,0xfe,0xa2,0x00,0x6f,0xc0,0x00,0x87,
-0x07,0xf0,0x51,0xff,0xff,0xf1,0x01,0xff,0x10,0x5f,0xf1,0x00,0x7f,0xf7,0x16,0xff,
-0x00,0x0c,0xf5,0x09,0xfb,0x00,0x1f,0xf9,0x00,0x6f,0xf0,0x00,0xaf,0x70,0xcf,0x80,
-0x06,0xff,0x20,0x07,0xfe,0x00,0x09,0xf7,0x0e,0xf6,0x00,0xaf,0xe0,0x00,0x9f,0xc0,
-0x00,0x9f,0x70,0xff,0x50,0x0d,0xfb,0x00,0x0a,0xfb,0x00,0x0b,0xf6,0x0f,0xf5,0x00,
-0xef,0xb0,0x00,0xcf,0x90,0x00,0xef,0x30,0xef,0x60,0x0d,0xfd,0x00,0x1f,0xf8,0x00,
-0x4f,0xe0,0x0c,0xf8,0x00,0xaf,0xf7,0x3c,0xff,0xc0,0x1d,0xf7,0x00,0x9f,0xd0,0x02,
-0xff,0xff,0xfa,0x33,0x08,0xd5,0x03,0xff,0x30,0x04,0xdf,0xd5,0x06,0xdf,0xd7,0x00,
-0x00,0x0c,0xfd,0xd4,0x00,0x34,0x3f,0xfc,0x10,0x0b,0x00,0x61,0x6f,0xff,0x94,0x21,
-0x24,0x86,0x0b,0x00,0x11,0x4d,0xbb,0x09,0x01,0x0b,0x00,0x24,0x05,0xad,0xdc,0x00,
-0x23,0x00,0xcf,0x37,0x00,0x12,0x2f,0x42,0x03,0x00,0xd2,0x04,0x22,0xa0,0x00,0xe1,
-0x04,0x22,0xff,0x00,0xf0,0x04,0x22,0xef,0xf6,0xff,0x04,0x13,0xb9,0x97,0x03,0x41,
-0xf6,0x4f,0xff,0x20,0x80,0x03,0x31,0x10,0xef,0xf8,0xb8,0x02,0x40,0xb0,0x09,0xff,
-0xd0,0x45,0x01,0x50,0xf6,0x00,0x4f,0xff,0x40,0xb9,0x02,0x40,0x10,0x00,0xef,0xfa,
-0x3f,0x04,0x02,0x74,0x0a,0x11,0x03,0x08,0x00,0x01,0x68,0x03,0x90,0xee,0xee,0xee,
-0xff,0xfc,0x00,0x0f,0xff,0xc0,0x50,0x00,0x41,0xf2,0x05,0xff,0xf6,0x61,0x00,0x31,
-0x80,0xbf,0xff,0x72,0x00,0x10,0xfe,0xf4,0x02,0x31,0xff,0xd9,0x30,0x07,0x00,0x80,
-0xff,0xf8,0x00,0x7f,0xff,0xee,0xef,0xff,0x52,0x03,0x00,0xc8,0x00,0x30,0xa0,0x7f,
-0xff,0xee,0x03,0x12,0xc0,0x07,0x00,0x00,0x0e,0x00,0x41,0x01,0x7f,0xff,0x40,0x2a,
-0x00,0x12,0xf7,0x31,0x00,0xb0,0xd4,0x00,0x7f,0xff,0x98,0x89,0xdf,0xff,0x50,0x7f,
-0xff,0x96,0x00,0x30,0xe0,0x7f,0xff,0x32,0x04,0x17,0xf2,0x07,0x00,0xb1,0x2e,0xff,
-0xf0,0x7f,0xff,0xdd,0xde,0xff,0xff,0x90,0x7f,0x86,0x04,0x01,0x38,0x00,0xb0,0xeb,
-0x60,0x00,0x00,0x01,0x8c,0xef,0xea,0x40,0x00,0x00,0x99,0x05,0x10,0xfa,0x5d,0x02,
-0x00,0x2a,0x01,0x80,0x0e,0xff,0xe4,0x00,0x2b,0xff,0xf4,0x5f,0xd3,0x00,0x30,0xef,
-0xfa,0xaf,0x28,0x01,0x32,0x9e,0xec,0xdf,0xee,0x01,0x2e,0xff,0xf9,0x07,0x00,0x01,
-0xf4,0x00,0x04,0x85,0x04,0x50,0x8c,0xca,0x6f,0xff,0x30,0x13,0x00,0x92,0x0f,0xff,
-0xd3,0x00,0x1a,0xff,0xf5,0x05,0xff,0x7e,0x01,0x20,0x6f,0xff,0xb7,0x01,0x00,0x2c,
-0x07,0x20,0xea,0x40,0x7e,0x00,0x32,0xfd,0x82,0x00,0xbd,0x00,0x10,0x60,0xee,0x00,
-0x02,0xf5,0x00,0x32,0x00,0x03,0xcf,0xf5,0x00,0x37,0x0d,0xff,0xc0,0xbd,0x00,0x50,
-0x02,0xff,0xf6,0x7f,0xff,0x6e,0x00,0x12,0xf7,0x07,0x00,0x17,0xf8,0x0e,0x00,0x03,
-0x1c,0x00,0x03,0x2a,0x00,0x02,0x38,0x00,0x11,0x02,0x46,0x00,0x42,0xdd,0xef,0xff,
-0xf9,0x62,0x00,0x19,0x70,0x70,0x00,0x13,0xff,0x06,0x00,0x00,0x93,0x01,0x21,0xed,
-0x7f,0x80,0x01,0x0f,0x06,0x00,0x01,0x00,0x55,0x06,0x04,0x06,0x00,0x4f,0xcc,0xcc,
-0xcc,0x90,0x2a,0x00,0x07,0x4a,0xdd,0xdd,0xdd,0xdd,0x5a,0x00,0x00,0x4d,0x01,0x03,
-0x06,0x00,0x00,0x66,0x00,0x1f,0xe8,0x3c,0x00,0x0a,0x1a,0xa0,0x6c,0x00,0x0f,0x2a,
-0x00,0x05,0x0b,0x06,0x00,0x00,0xc2,0x08,0x31,0xef,0xeb,0x60,0xbc,0x06,0x30,0xff,
-0xff,0xd2,0x6b,0x02,0xd0,0xfe,0xff,0xff,0xe0,0x00,0xdf,0xff,0x50,0x00,0x8f,0xff,
-0x70,0x4f,0x42,0x05,0x30,0xbf,0xfd,0x09,0x60,0x05,0x40,0x03,0x88,0x70,0xcf,0x04,
-0x04,0x00,0x1f,0x01,0x14,0xb0,0xb0,0x01,0x00,0xe4,0x07,0x00,0x0f,0x00,0xb1,0xbf,
-0xff,0xff,0xf0,0xcf,0xfc,0x00,0x06,0x99,0xcf,0xff,0x2d,0x00,0x10,0x07,0x32,0x0d,
-0x11,0x70,0x65,0x00,0x90,0xdf,0xff,0x70,0x00,0x1b,0xff,0xf0,0x03,0xff,0x6d,0x04,
-0x11,0xfe,0xeb,0x05,0x93,0xff,0xfc,0x20,0x00,0x01,0x6c,0xef,0xed,0x94,0x86,0x00,
-0x51,0x1f,0xff,0x67,0xff,0xf0,0x01,0x03,0x0f,0x0f,0x00,0x14,0x11,0xff,0x00,0x06,
-0x12,0x7f,0x08,0x00,0x8f,0x67,0xff,0xfd,0xdd,0xdd,0xdd,0xff,0xf6,0x4b,0x00,0x21,
-0x6f,0x60,0x4f,0xff,0x44,0xff,0xf4,0x05,0x00,0x12,0x11,0x40,0xdc,0x04,0x1f,0xfe,
-0x06,0x00,0x29,0x20,0x13,0x33,0x06,0x00,0x00,0xdf,0x03,0xe1,0xbf,0xfd,0x4f,0xff,
-0x90,0x05,0xff,0xf9,0x0d,0xff,0xff,0xef,0xff,0xf2,0x14,0x01,0x61,0x50,0x00,0x18,
-0xdf,0xfd,0x92,0x11,0x01,0x41,0x07,0xff,0xfd,0x07,0xf8,0x03,0x20,0xfe,0x20,0xa7,
-0x03,0x30,0xef,0xff,0x40,0x0f,0x00,0x11,0xcf,0x82,0x02,0x20,0x00,0x8f,0x72,0x0c,
-0x00,0x18,0x0f,0x10,0xc0,0x3e,0x01,0x31,0x2f,0xff,0xe1,0x30,0x00,0x23,0xff,0xf6,
-0x6f,0x02,0x22,0xc0,0x00,0x8a,0x07,0x01,0x7d,0x01,0xb1,0xf9,0xdf,0xff,0x20,0x00,
-0x07,0xff,0xfa,0x04,0xff,0xfc,0x6b,0x01,0x40,0x0a,0xff,0xf7,0x00,0x4b,0x00,0x31,
-0x1e,0xff,0xf2,0x69,0x00,0x40,0x5f,0xff,0xc0,0x07,0x11,0x01,0x50,0xbf,0xff,0x70,
-0x7f,0xff,0x18,0x01,0x2e,0xff,0x20,0x3b,0x02,0x0f,0x06,0x00,0x30,0x00,0xa1,0x02,
-0x12,0xd6,0x95,0x04,0x04,0x06,0x00,0x11,0xf4,0xd4,0x0e,0x22,0xff,0x77,0x2f,0x05,
-0x10,0xaf,0x87,0x03,0x11,0xff,0x93,0x09,0x00,0x13,0x00,0x11,0xf5,0x71,0x0a,0x30,
-0xf7,0x7f,0xfe,0x6a,0x02,0xf1,0x34,0xbf,0xfe,0xff,0x77,0xff,0xbe,0xff,0x10,0x00,
-0x1f,0xfd,0xcf,0xf7,0x7f,0xfc,0x8f,0xf6,0x00,0x07,0xff,0x8c,0xff,0x77,0xff,0xd2,
-0xff,0xc0,0x00,0xcf,0xf2,0xdf,0xf7,0x7f,0xfd,0x0c,0xff,0x20,0x2f,0xfc,0x0e,0xff,
-0x77,0xff,0xe0,0x7f,0xf7,0x08,0xff,0x60,0xef,0xf7,0x7f,0xff,0x01,0xff,0xd0,0xdf,
-0xf1,0x0f,0xff,0x77,0xff,0xf0,0x0b,0xff,0x6f,0xfb,0xe6,0x03,0x00,0x9e,0x04,0x11,
-0x50,0x13,0x00,0x20,0x00,0xff,0x04,0x00,0x11,0xf7,0x11,0x01,0x22,0xf9,0x00,0x13,
-0x00,0x33,0x4f,0xff,0x30,0x0c,0x04,0x40,0xef,0xe0,0x00,0x0f,0x10,0x01,0x12,0x50,
-0x30,0x02,0x13,0xfe,0x30,0x02,0x13,0xf9,0x7b,0x02,0x12,0xf3,0x0f,0x00,0x23,0xff,
-0xc0,0x8a,0x02,0x11,0x60,0x0f,0x00,0x30,0x9f,0xfe,0x10,0x0f,0x00,0x31,0xf1,0xef,
-0xfa,0x0f,0x00,0x31,0x04,0xff,0xf3,0x6c,0x02,0x31,0x0b,0xff,0xd2,0x6c,0x02,0x31,
-0x2f,0xff,0x9f,0x7b,0x02,0x11,0x7f,0xb7,0x02,0x01,0x1d,0x06,0x00,0x0f,0x00,0x13,
-0x04,0x0f,0x00,0x22,0x0a,0xff,0x99,0x02,0x13,0x1e,0x99,0x02,0x10,0x6f,0x78,0x03,
-0x52,0x6c,0xef,0xda,0x30,0x00,0x30,0x03,0x33,0xa0,0x00,0x03,0x00,0x05,0x71,0xdf,
-0xff,0x60,0x02,0xbf,0xff,0x60,0x99,0x03,0x50,0xdf,0xfd,0x0a,0xff,0xe0,0x2a,0x01,
-0x22,0xf3,0xdf,0xa8,0x07,0x31,0x6e,0xff,0x90,0xd2,0x04,0x21,0xff,0xf9,0x4a,0x01,
-0x13,0x8e,0x0f,0x00,0x03,0x1e,0x00,0x13,0x6a,0x2d,0x00,0x11,0x5f,0x3c,0x00,0x10,
-0xfe,0x4b,0x00,0x42,0x01,0xbf,0xff,0x60,0xf3,0x03,0x14,0xb0,0x69,0x00,0x01,0x78,
-0x00,0x12,0x40,0x4c,0x02,0x11,0xda,0x63,0x05,0x00,0xd3,0x05,0x00,0x81,0x04,0x21,
-0xff,0xff,0xbe,0x04,0x12,0x2d,0x24,0x05,0x19,0x03,0x47,0x05,0x12,0x01,0x07,0x00,
-0x32,0x1b,0xff,0xf4,0x20,0x06,0x12,0xc0,0x20,0x06,0x11,0x10,0x20,0x06,0x14,0x50,
-0x6c,0x04,0x0f,0x07,0x00,0x0f,0x00,0xc0,0x0d,0x44,0xce,0xfd,0xa3,0x00,0xf8,0x00,
-0x00,0xde,0x06,0x02,0xf2,0x05,0x02,0xf9,0x00,0x40,0x50,0x05,0xff,0xf5,0x81,0x04,
-0x13,0xd0,0xfa,0x00,0x40,0xf2,0x0d,0xff,0xa0,0xbe,0x05,0x40,0xf5,0x0f,0xff,0x90,
-0x86,0x00,0x41,0xf7,0x0f,0xff,0x80,0x95,0x00,0x04,0x10,0x00,0x04,0x20,0x00,0x04,
-0x30,0x00,0x00,0x33,0x07,0x00,0x40,0x00,0x04,0x50,0x00,0x20,0x00,0x3f,0x82,0x03,
-0x13,0xfa,0x70,0x00,0x10,0xd0,0xd1,0x09,0x33,0xce,0xff,0xff,0xfe,0x10,0x32,0xaf,
-0xff,0xd2,0x93,0x00,0x03,0xd3,0x07,0x29,0x00,0x48,0x17,0x01,0x13,0xf9,0x61,0x07,
-0x01,0x3c,0x03,0x12,0x4f,0x30,0x07,0x37,0x08,0xff,0xf1,0x49,0x06,0x30,0x09,0xff,
-0xf0,0xc1,0x03,0x01,0x7d,0x07,0x01,0x0e,0x0d,0x01,0x07,0x00,0x12,0xb2,0x38,0x00,
-0x10,0x60,0xf4,0x00,0x30,0x0d,0xff,0xe0,0x07,0x00,0x31,0x04,0xff,0xf7,0x02,0x01,
-0x32,0xcf,0xfe,0x00,0x4d,0x00,0x12,0x80,0x84,0x07,0x12,0xf1,0x6b,0x01,0xa1,0xf8,
-0x00,0x00,0x6b,0xef,0xec,0x70,0x00,0x00,0x3e,0x3b,0x0b,0xf0,0x02,0x01,0xef,0xff,
-0xfd,0xff,0xff,0xe1,0x07,0xff,0xf7,0x00,0x06,0xff,0xf9,0x09,0xff,0xe0,0x49,0x0c,
-0x10,0x08,0x87,0x0f,0x62,0x13,0x32,0x02,0xff,0xff,0x82,0xde,0x0b,0x40,0xff,0xc7,
-0x10,0x00,0x0b,0x07,0x20,0xff,0xf8,0x4f,0x01,0x13,0x9e,0xbc,0x08,0xa1,0x4c,0xff,
-0xf7,0x17,0x77,0x20,0x00,0x00,0xdf,0xfc,0x2b,0x01,0x92,0xaf,0xfe,0x0c,0xff,0xf5,
-0x00,0x03,0xff,0xfc,0xa0,0x05,0x30,0xf5,0x00,0x4e,0xa2,0x00,0x10,0x80,0x70,0x00,
-0x42,0xfd,0x93,0x00,0x8f,0x62,0x05,0x13,0x68,0x71,0x05,0x80,0x7e,0xee,0xee,0xff,
-0xfe,0xee,0xee,0x50,0xa1,0x02,0x11,0x20,0x8a,0x1a,0x02,0xfb,0x0f,0x0f,0x0f,0x00,
-0x46,0x21,0xaf,0xfe,0xc5,0x01,0x0f,0x07,0x00,0x33,0x14,0x9f,0xe8,0x07,0x00,0xdc,
-0x10,0xa0,0xf4,0x3f,0xff,0xc2,0x00,0x3e,0xff,0xe0,0x0a,0xff,0x36,0x08,0x10,0x60,
-0xc1,0x06,0x00,0x28,0x01,0x20,0x04,0xae,0x3f,0x09,0x30,0xcf,0xff,0x20,0xf5,0x01,
-0x10,0xf6,0x87,0x03,0x00,0x85,0x01,0x01,0x9d,0x13,0x60,0x1f,0xff,0xb0,0x0b,0xff,
-0xf0,0x59,0x01,0x11,0x60,0x85,0x02,0x31,0xaf,0xff,0x10,0xb9,0x08,0x21,0xef,0xfa,
-0xa8,0x00,0x40,0x03,0xff,0xf5,0x00,0x45,0x04,0x30,0x08,0xff,0xf0,0x6e,0x0d,0x11,
-0x80,0x79,0x02,0x60,0x09,0xff,0xc0,0x2f,0xff,0x40,0x49,0x0b,0x12,0xf1,0x87,0x0d,
-0x41,0xef,0xf6,0xbf,0xf9,0x0c,0x06,0x14,0xfc,0x0d,0x0f,0x01,0x6e,0x0b,0x00,0xeb,
-0x09,0x13,0x80,0x3e,0x0a,0x21,0x30,0x00,0xd5,0x0d,0x13,0xfd,0x14,0x03,0x00,0x57,
-0x11,0x60,0x0f,0xff,0x74,0xff,0xf3,0x00,0x76,0x00,0x40,0x02,0xff,0xf4,0x0f,0x92,
-0x12,0x00,0x9d,0x12,0x10,0xff,0xc8,0x0d,0xa1,0x0c,0xff,0xfd,0x00,0x08,0xff,0xd0,
-0x09,0xff,0xc0,0xd5,0x04,0x50,0xbf,0xf9,0x00,0x5f,0xff,0x2a,0x0e,0xb0,0x40,0x0e,
-0xff,0x60,0x02,0xff,0xf2,0x07,0xff,0x9f,0xf8,0xa0,0x11,0x80,0x0e,0xff,0x50,0xbf,
-0xf1,0xff,0xb0,0x4f,0x61,0x0e,0xf0,0x0c,0xf8,0x0f,0xfc,0x0c,0xff,0x07,0xff,0xb0,
-0x00,0x07,0xff,0xb2,0xff,0x90,0x8f,0xf3,0xaf,0xf7,0x00,0x00,0x4f,0xfe,0x6f,0xf5,
-0x04,0xff,0x6d,0xac,0x00,0x60,0xff,0xfc,0xff,0x10,0x0f,0xfb,0xc6,0x00,0x10,0x0c,
-0x11,0x03,0x31,0xcf,0xff,0xfd,0x6d,0x0c,0x10,0xf9,0x9c,0x00,0x10,0x90,0xb4,0x05,
-0x00,0x85,0x12,0x21,0xff,0xf6,0x53,0x04,0x11,0xf1,0x33,0x06,0x00,0xd8,0x00,0x20,
-0xfd,0x00,0xcb,0x02,0x00,0x1e,0x01,0x10,0xb0,0xb8,0x00,0xb1,0x90,0xbf,0xff,0x30,
-0x00,0x0e,0xff,0xe1,0x02,0xff,0xfc,0x84,0x12,0x60,0x08,0xff,0xf5,0x01,0xff,0xfc,
-0x19,0x01,0x31,0xd0,0x9f,0xff,0x19,0x0d,0x11,0x8f,0x54,0x03,0x14,0xcf,0xc0,0x0f,
-0x02,0x3b,0x0c,0x20,0x0c,0xff,0xc7,0x11,0x00,0x17,0x05,0x13,0xf8,0x43,0x0b,0x11,
-0xf2,0x07,0x01,0x11,0x8f,0x81,0x01,0x00,0x3c,0x00,0x80,0x50,0x00,0x0a,0xff,0xf4,
-0x01,0xff,0xfe,0x62,0x0f,0x50,0x00,0x07,0xff,0xf8,0x00,0xe2,0x06,0x10,0x0e,0x6e,
-0x03,0x11,0x90,0x7d,0x00,0x30,0xbf,0xff,0x10,0x87,0x01,0x31,0x83,0xff,0xf8,0xba,
-0x01,0x31,0x0a,0xff,0xf1,0x3f,0x03,0x00,0x2c,0x11,0x20,0xaf,0xfe,0xa9,0x01,0x00,
-0x0b,0x00,0x00,0x07,0x02,0x01,0x36,0x03,0x53,0x09,0xff,0xd1,0xff,0xf7,0x71,0x14,
-0x01,0x97,0x01,0x02,0xa0,0x14,0x12,0x01,0x0a,0x04,0x02,0x3e,0x13,0x01,0x94,0x02,
-0x12,0x30,0x94,0x02,0x1f,0xf3,0x0f,0x00,0x0e,0x21,0x2f,0xff,0x31,0x05,0x03,0x07,
-0x00,0x41,0x1e,0xee,0xee,0xee,0x15,0x10,0x00,0x19,0x00,0x12,0xa0,0xa4,0x0b,0x11,
-0x10,0x59,0x00,0x01,0x2d,0x0c,0x12,0x4f,0x46,0x11,0x22,0xef,0xfd,0x1d,0x15,0x12,
-0xf3,0xb8,0x03,0x01,0x58,0x12,0x31,0xef,0xfc,0x00,0x1b,0x0c,0x12,0xf2,0x1c,0x05,
-0x11,0x60,0x14,0x02,0x12,0xfb,0x2b,0x02,0x62,0xfe,0xdd,0xdd,0xdd,0xdb,0x2f,0xb4,
-0x16,0x03,0x07,0x00,0x30,0x9f,0xff,0xf7,0x03,0x00,0x5f,0xfe,0xa4,0x9f,0xfd,0x00,
-0x03,0x00,0x21,0x22,0xfe,0xa4,0x42,0x00,0x21,0xcf,0xfa,0xca,0x00,0x12,0xf1,0x1d,
-0x09,0x04,0xf7,0x0d,0x11,0x04,0x87,0x00,0x11,0x0e,0xae,0x00,0x00,0xa4,0x10,0x00,
-0x51,0x05,0x02,0xb9,0x0c,0x02,0xc7,0x0c,0x10,0x00,0xa0,0x0f,0x01,0xe3,0x0c,0x11,
-0xd0,0xd4,0x02,0x10,0x40,0xe9,0x00,0x0f,0x4a,0x00,0x04,0x10,0xf3,0x50,0x05,0xcf,
-0x88,0x30,0xdf,0xff,0xf3,0xdf,0xff,0xf3,0x8b,0xff,0xf3,0x02,0x03,0x00,0x22,0x11,
-0x8b,0x3f,0x00,0x01,0x44,0x12,0x50,0x78,0x40,0x00,0x00,0x06,0xcd,0x01,0x10,0x0c,
-0x55,0x01,0x10,0x3f,0x25,0x01,0xf0,0x0a,0xaf,0xe6,0xff,0x20,0x01,0xff,0x81,0xff,
-0x80,0x07,0xff,0x20,0xaf,0xe0,0x0d,0xfc,0x00,0x4f,0xf5,0x4f,0xf6,0x00,0x0e,0xfc,
-0xaa,0x01,0x00,0x11,0x7f,0x51,0x06,0x02,0x4f,0x07,0xf0,0x04,0x1a,0xaa,0x50,0x00,
-0x5f,0xfe,0x10,0x00,0x7f,0xfa,0x00,0x00,0x9f,0xf4,0x00,0x05,0xbe,0xfe,0xb4,0xd7,
-0x00,0x00,0x8e,0x02,0xb0,0x08,0xff,0xfa,0x8d,0xff,0xf2,0x00,0xcf,0xf9,0x00,0x1f,
-0x92,0x01,0x00,0x0d,0x14,0x00,0xe6,0x0c,0x51,0xff,0xff,0x90,0x03,0xef,0xfc,0x05,
-0x60,0xdf,0xfd,0x30,0x0d,0xff,0x90,0xdf,0x03,0x20,0xdf,0xf9,0x10,0x01,0x80,0x2f,
-0xff,0x90,0x0e,0xff,0xfa,0xbf,0xff,0x82,0x03,0x01,0xbb,0x06,0x53,0x4b,0xff,0xc6,
-0x7f,0xfe,0x42,0x12,0x0f,0x06,0x00,0x07,0x60,0x5c,0xfe,0xa2,0x00,0xbf,0xfe,0x3b,
-0x11,0x10,0xbf,0x81,0x05,0x81,0xd0,0xbf,0xff,0x20,0x07,0xff,0xf5,0xbf,0xed,0x10,
-0x20,0xbf,0xfb,0x90,0x14,0x20,0xbf,0xfb,0x82,0x12,0x06,0x0c,0x00,0x90,0xef,0xf9,
-0xbf,0xff,0x20,0x06,0xff,0xf5,0xbf,0x7d,0x11,0x40,0xe0,0xbf,0xfd,0xff,0x58,0x12,
-0xa1,0xf6,0x5c,0xfe,0xb3,0x00,0x00,0x03,0xae,0xfe,0xb4,0x82,0x12,0x00,0x2f,0x13,
-0xa0,0xff,0xcf,0xff,0xf4,0x0b,0xff,0xd1,0x01,0xcf,0xfa,0x33,0x04,0x31,0x5e,0xec,
-0x2f,0xa8,0x02,0x11,0x3f,0xb0,0x03,0x13,0x2f,0x00,0x13,0xb0,0x50,0x00,0x39,0x98,
-0x0b,0xff,0xd1,0x00,0xbf,0xfb,0x03,0xb5,0x13,0x12,0xf4,0x3c,0x00,0x03,0x48,0x00,
-0x01,0x2e,0x00,0x16,0x30,0x51,0x13,0x0d,0x0d,0x00,0x70,0x6d,0xfe,0x94,0xff,0xf3,
-0x00,0xaf,0x42,0x07,0x20,0x30,0x5f,0xbe,0x00,0x10,0xf3,0x88,0x14,0x50,0xaf,0xff,
-0x30,0xff,0xf8,0x27,0x00,0x00,0x1c,0x01,0x52,0x3f,0xff,0x33,0xff,0xf2,0x0d,0x00,
-0x10,0x30,0x34,0x00,0x40,0xff,0xf6,0x00,0x03,0x27,0x00,0x30,0xc0,0x00,0x7f,0x34,
-0x00,0x25,0xd9,0xbf,0x41,0x00,0x00,0xfb,0x0f,0x72,0xef,0xf3,0x00,0x01,0x8d,0xff,
-0xc6,0x8f,0x0c,0x10,0xfb,0xfa,0x0a,0xa0,0xcd,0xff,0xf8,0x00,0x8f,0xfe,0x20,0x07,
-0xff,0xf0,0xc2,0x12,0x32,0x0f,0xff,0x30,0x89,0x16,0x02,0xf7,0x02,0xa2,0x51,0xff,
-0xf9,0x55,0x55,0x55,0x51,0x0e,0xff,0xa0,0xbd,0x03,0xb3,0x60,0x00,0x6e,0x20,0x02,
-0xef,0xff,0xec,0xef,0xfd,0x00,0x53,0x0b,0x60,0x01,0x8c,0xff,0xd9,0x20,0x00,0x55,
-0x00,0x31,0x70,0x01,0xdf,0xb1,0x07,0x30,0xec,0x70,0x0b,0xa6,0x02,0x21,0xcf,0xfa,
-0x8e,0x18,0xa0,0xf2,0xaf,0xff,0xff,0xff,0x25,0x8e,0xff,0xd8,0x81,0x12,0x00,0x00,
-0x18,0x0f,0x1f,0x00,0x09,0x00,0x12,0x60,0x05,0xcf,0xfb,0x3b,0xff,0x60,0x58,0x14,
-0xf0,0x00,0xef,0xf6,0x04,0xff,0xff,0xdd,0xff,0xff,0x60,0xbf,0xff,0x30,0x05,0xff,
-0xf6,0x78,0x08,0x50,0x0f,0xff,0x62,0xff,0xf5,0xe8,0x0f,0x00,0xf4,0x00,0x00,0x0d,
-0x00,0x10,0xf4,0x0d,0x00,0x00,0x6f,0x07,0x14,0x0f,0x27,0x00,0x03,0x34,0x00,0x11,
-0x08,0x57,0x07,0x00,0x4e,0x00,0x33,0x3f,0xff,0x60,0x87,0x13,0x40,0x6b,0x10,0x00,
-0xbf,0xd4,0x18,0x62,0xbb,0xef,0xff,0x80,0x01,0xcf,0x05,0x09,0x10,0x6b,0x5e,0x0f,
-0x11,0xcf,0x3a,0x06,0x0f,0x06,0x00,0x07,0x51,0x3b,0xff,0xc4,0x00,0xcf,0x0e,0x02,
-0xe0,0xcf,0xff,0xfc,0xef,0xff,0xc0,0xcf,0xfd,0x10,0x09,0xff,0xf0,0xcf,0xf9,0xbf,
-0x03,0x4f,0xcf,0xf9,0x00,0x03,0x06,0x00,0x19,0xa1,0x3d,0xf7,0x0a,0xff,0xf0,0x8f,
-0xfd,0x00,0x67,0x10,0x11,0x12,0x2f,0x8f,0xfe,0x05,0x00,0x09,0x50,0x00,0x03,0xee,
-0x60,0x00,0x1c,0x07,0x00,0x86,0x06,0x01,0x33,0x00,0x03,0x47,0x12,0x0f,0x04,0x00,
-0x20,0x00,0xa2,0x10,0xb3,0x1d,0xef,0xff,0x80,0x1f,0xff,0xfe,0x10,0x1d,0xfe,0xa2,
-0x27,0x03,0x02,0x6a,0x04,0x0f,0x0d,0x00,0x05,0xf0,0x03,0xcf,0xff,0x40,0xbf,0xfb,
-0x00,0xaf,0xff,0x60,0x0b,0xff,0xb0,0x7f,0xff,0x80,0x00,0xbf,0xfb,0x86,0x06,0x60,
-0x0b,0xff,0xdf,0xff,0xc0,0x00,0xd9,0x07,0x12,0xf4,0xd4,0x03,0x02,0x0d,0x00,0x20,
-0xff,0x70,0x15,0x17,0x90,0xaf,0xff,0x20,0x00,0xbf,0xfb,0x01,0xef,0xfc,0x41,0x00,
-0x30,0x06,0xff,0xf6,0x4e,0x00,0x60,0x0c,0xff,0xf1,0x0b,0xff,0xb0,0xef,0x12,0x2f,
-0x8f,0xfe,0x02,0x00,0x0f,0xf0,0x05,0xbf,0xf8,0x3a,0xef,0xc5,0x01,0x9e,0xfd,0x80,
-0x0b,0xff,0xcf,0xff,0xff,0xf6,0xef,0xff,0xff,0xa0,0xbf,0x77,0x01,0x51,0xff,0xed,
-0xff,0xff,0x2b,0x06,0x03,0x21,0x80,0x04,0xc8,0x03,0x00,0x56,0x13,0x51,0x0f,0xff,
-0x7b,0xff,0xb0,0x2a,0x05,0x23,0xef,0xf7,0x13,0x00,0x1f,0x0e,0x13,0x00,0x27,0x90,
-0x70,0xcf,0xf7,0x3b,0xef,0xd5,0x00,0xcf,0xfc,0xe3,0x02,0x01,0xec,0x01,0x91,0xd0,
-0xcf,0xfe,0x20,0x09,0xff,0xf1,0xcf,0xfa,0xc2,0x01,0x0f,0x06,0x00,0x1c,0x00,0x4d,
-0x11,0x10,0xc6,0xd9,0x07,0x00,0xd1,0x11,0xf0,0x07,0x02,0xff,0xff,0xde,0xff,0xfb,
-0x00,0xaf,0xfe,0x20,0x08,0xff,0xf3,0x0f,0xff,0x70,0x00,0x0e,0xff,0x82,0xff,0xf3,
-0x6e,0x01,0x00,0x39,0x04,0x50,0x09,0xff,0xc2,0xff,0xf4,0x8e,0x04,0x02,0x1a,0x00,
-0x12,0x80,0x27,0x00,0x03,0x34,0x00,0x11,0x05,0xf2,0x0b,0x03,0x4e,0x00,0x30,0xbf,
-0xf7,0x6d,0xbe,0x01,0x12,0xff,0xd9,0x04,0xac,0xd9,0xaf,0xff,0xd0,0xbf,0xfd,0x00,
-0x06,0xff,0xf4,0xd9,0x04,0x11,0xbf,0xd9,0x04,0x11,0xcf,0x0c,0x00,0x30,0xff,0xf8,
-0xbf,0x50,0x00,0x21,0xf4,0xbf,0xd3,0x00,0x03,0x3c,0x00,0x02,0x21,0x05,0x0f,0x45,
-0x05,0x0a,0xe0,0x00,0x07,0xdf,0xe9,0x1d,0xff,0x30,0x0a,0xff,0xff,0xfd,0xff,0xf3,
-0x05,0xc8,0x04,0x33,0xff,0x30,0xcf,0xc1,0x00,0x00,0x3a,0x19,0x30,0x32,0xff,0xf3,
-0x75,0x04,0x00,0xc1,0x00,0x05,0x0d,0x00,0x00,0xc1,0x00,0x11,0x3f,0x27,0x00,0x15,
-0x09,0x34,0x00,0x00,0x11,0x04,0x00,0x34,0x18,0x3e,0xdf,0xe9,0x4f,0xf7,0x04,0x0e,
-0x0d,0x00,0x00,0x4b,0x09,0xe2,0x6d,0xf7,0xbf,0xfe,0xff,0xf7,0xbf,0xff,0xff,0xf6,
-0xbf,0xff,0x82,0x11,0xd1,0x00,0x0f,0x04,0x00,0x0b,0x80,0x00,0x07,0xcf,0xfe,0xa2,
-0x00,0x01,0xdf,0xbc,0x01,0x70,0x09,0xff,0xe8,0x7d,0xff,0xf1,0x0e,0x43,0x0e,0xb1,
-0xf5,0x0d,0xff,0xb1,0x00,0x01,0x10,0x07,0xff,0xff,0xc8,0x7d,0x0d,0x00,0xd1,0x1d,
-0x70,0x01,0x6a,0xef,0xff,0xe1,0x14,0x43,0xf9,0x09,0x10,0x3f,0x02,0x02,0x90,0xf6,
-0x0d,0xff,0xe8,0x7b,0xff,0xf2,0x02,0xef,0xc6,0x02,0x00,0x48,0x00,0x12,0xa3,0xe4,
-0x17,0x03,0x04,0x00,0x40,0xef,0xff,0xff,0xf8,0x04,0x00,0x48,0x78,0xff,0xfa,0x84,
-0x18,0x00,0x0a,0x04,0x00,0x10,0xf7,0x57,0x09,0x9f,0xd8,0x00,0x7f,0xff,0xfa,0x00,
-0x07,0xdf,0xe8,0x18,0x04,0x1d,0x02,0x32,0x02,0x20,0xaf,0xfe,0x28,0x1a,0x40,0x6f,
-0xff,0xec,0xef,0x81,0x0d,0x00,0x47,0x05,0x80,0x01,0xae,0xfe,0x92,0xff,0xf2,0xaf,
-0xfd,0xc0,0x18,0x00,0xae,0x02,0x00,0x89,0x0d,0x20,0x50,0x04,0x51,0x03,0xe0,0xa0,
-0x08,0xff,0xc0,0x05,0xff,0xe0,0x0d,0xff,0x70,0x00,0xff,0xf3,0x1f,0x77,0x03,0x90,
-0xf7,0x6f,0xfc,0x00,0x00,0x6f,0xfb,0xaf,0xf7,0x1a,0x08,0x21,0xef,0xf2,0x9d,0x03,
-0x11,0xd0,0xf1,0x0f,0x12,0x70,0x83,0x10,0x03,0x04,0x14,0x40,0x8f,0xfb,0x00,0x09,
-0xc8,0x07,0xb0,0xf2,0x4f,0xfe,0x00,0x0d,0xff,0x70,0x04,0xff,0xe0,0x0f,0x18,0x05,
-0xb0,0xb0,0x08,0xff,0xa0,0x0c,0xff,0x40,0x6f,0xff,0xf0,0x0b,0x41,0x05,0xf0,0x09,
+0x10,0xed,0x66,0xef,0xce,0xf1,0xae,0xf2,0x00,0x01,0x00,0x2f,0xf5,0x00,0x01,0x00,
+0x03,0x13,0xf9,0x08,0x00,0x17,0xea,0x14,0x00,0xce,0xf7,0xf5,0x00,0xfc,0xef,0x00,
+0xef,0x00,0x00,0x00,0x02,0x00,0x01,0x00,0x4e,0x04,0x07,0x00,0x04,0x16,0x00,0x2f,
+0xcb,0x00,0x01,0x00,0x15,0x1f,0xd2,0x1e,0x00,0x0a,0x03,0x88,0x00,0xb2,0xf1,0x00,
+0xfc,0x00,0x00,0xea,0xfd,0xf2,0xf9,0x00,0xe4,0x93,0x00,0x7d,0xfe,0x00,0x00,0xfd,
+0xfe,0xf7,0xfa,0x92,0x00,0x10,0xfb,0x29,0x00,0x1f,0xf6,0x4a,0x00,0x01,0x1c,0xfb,
+0x0a,0x00,0x19,0xfe,0x1f,0x00,0x12,0xfd,0x07,0x00,0x30,0xe9,0x00,0x00,0x42,0x00,
+0x8f,0x00,0xf0,0x00,0xfc,0x00,0xfc,0xf8,0xfc,0x9c,0x00,0x0a,0x05,0xf7,0x00,0x21,
+0xfc,0xfd,0x34,0x00,0x26,0xfd,0xfb,0x30,0x00,0x75,0xcd,0x00,0x00,0x00,0xdc,0x00,
+0xd9,0x24,0x00,0x9b,0xfa,0xfc,0x00,0x00,0xfc,0xfb,0x00,0x00,0xfc,0x53,0x00,0x13,
+0x03,0x90,0x00,0x2f,0x03,0xfb,0x68,0x00,0x07,0x1f,0xfc,0x43,0x01,0x0d,0x10,0xe1,
+0x61,0x00,0x0a,0xeb,0x00,0x10,0xfb,0x38,0x00,0x21,0xf9,0xf4,0x0f,0x00,0x14,0xca,
+0xb0,0x00,0x97,0xf4,0x00,0x00,0xda,0xfc,0xd9,0xef,0x00,0xcc,0xf7,0x00,0x16,0xe9,
+0x2d,0x01,0x71,0xb4,0x00,0x00,0x00,0xdf,0x00,0xde,0x0c,0x00,0x61,0xf6,0x00,0xf9,
+0x00,0xfe,0xfe,0x25,0x01,0x3e,0x03,0x00,0x03,0x73,0x00,0x6f,0xfa,0x00,0xfb,0xfc,
+0x00,0xf9,0x97,0x00,0x0b,0x10,0xf7,0xba,0x00,0x1d,0xf7,0x17,0x00,0x01,0x7b,0x02,
+0xb1,0xd0,0xcd,0x00,0x00,0xea,0xfb,0xd8,0xfd,0x03,0x00,0x03,0x60,0x00,0xd3,0xe1,
+0xef,0x00,0xef,0xd9,0xf4,0xf2,0x00,0xf4,0xf1,0xf7,0xf2,0xf5,0x5e,0x01,0x66,0xd8,
+0xe3,0x00,0x00,0xf2,0xfe,0x2b,0x01,0xa4,0xf7,0xf8,0x00,0x00,0xf7,0xfa,0x00,0x00,
+0xfb,0xfe,0x7d,0x01,0x73,0x03,0x00,0xe5,0xf5,0x00,0x00,0xf8,0x48,0x01,0x00,0xa1,
+0x02,0x23,0xfa,0xfa,0x6c,0x01,0x16,0x00,0x15,0x00,0x24,0x00,0xe3,0xf5,0x01,0x15,
+0x03,0x20,0x01,0x10,0xfc,0x20,0x01,0x14,0xfa,0xcd,0x00,0xf5,0x12,0x04,0xf7,0xd5,
+0xe4,0x00,0x00,0xe4,0xfb,0xee,0xfd,0x03,0xee,0x03,0x03,0x02,0x03,0x00,0x03,0xf4,
+0xf4,0xfc,0xf9,0xf4,0xf9,0xf5,0xfc,0xf9,0xfc,0x00,0xfc,0xfa,0x04,0xf8,0x85,0x00,
+0x2a,0x02,0xfb,0x99,0x01,0x01,0x48,0x00,0x1c,0xfb,0xbd,0x01,0x15,0xfd,0x50,0x02,
+0x0c,0x01,0x00,0x0e,0x17,0x00,0x0e,0x1d,0x00,0x0f,0x0b,0x02,0x08,0x00,0x91,0x01,
+0x2d,0xfd,0xfd,0xbd,0x02,0x0f,0x6c,0x00,0x20,0x14,0xfe,0x80,0x02,0x0d,0xbd,0x03,
+0x19,0x03,0x71,0x02,0x10,0x04,0x7d,0x03,0x0f,0x01,0x00,0x24,0x0b,0xb9,0x02,0x1f,
+0xf0,0xad,0x00,0x0b,0x23,0xfc,0xfd,0xa2,0x01,0x1c,0xe0,0x6c,0x02,0x20,0xfc,0x04,
+0x6b,0x02,0x3e,0x09,0x00,0x03,0x89,0x02,0x0a,0x94,0x02,0x0a,0x58,0x03,0x1c,0xe1,
+0x63,0x00,0x2d,0xfe,0x02,0x14,0x01,0x1f,0xe9,0xd8,0x00,0x24,0x0e,0xfb,0x02,0x0f,
+0x03,0x02,0x15,0x1f,0xfc,0xd1,0x03,0x06,0x12,0x01,0xce,0x04,0x21,0x02,0x03,0x77,
+0x01,0x2d,0x04,0x05,0x21,0x00,0xf0,0x00,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,
+0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x0c,0x08,0x81,0x13,0x0d,0x14,0x15,0x16,0x17,
+0x18,0x19,0x20,0x00,0xff,0x0d,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,
+0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,
+0x28,0x00,0x01,0x00,0x5e,0x02,0xce,0x00,0x20,0x03,0x02,0xc9,0x00,0x4b,0x06,0x07,
+0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,
+0x00,0x08,0x00,0xf1,0x08,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,
+0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,
+0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,
+0x23,0x8f,0x00,0x1e,0x1f,0x24,0xc8,0x00,0x25,0x50,0x00,0x00,0x00,0x00,0x00,0xf0,
+0x5a,0x7f,0xff,0x16,0xff,0xf1,0x6f,0xff,0x05,0xff,0xf0,0x5f,0xff,0x04,0xff,0xf0,
+0x3f,0xfe,0x03,0xff,0xe0,0x2f,0xfd,0x02,0xff,0xd0,0x1f,0xfc,0x01,0xee,0xb0,0x00,
+0x00,0x00,0x58,0x30,0x5f,0xff,0x17,0xff,0xf2,0x1c,0xf9,0x00,0x4f,0xf2,0x6f,0xe4,
+0xff,0x16,0xfe,0x4f,0xf0,0x6f,0xd4,0xff,0x06,0xfb,0x4f,0xd0,0x6f,0xa4,0xfb,0x06,
+0xf8,0x17,0x50,0x37,0x30,0x00,0x00,0x08,0xf9,0x01,0xff,0x00,0x00,0x00,0x0b,0xf7,
+0x04,0xfd,0x00,0x00,0x00,0x0d,0xf4,0x07,0xfb,0x00,0x00,0x00,0x0f,0xf1,0x0a,0xf8,
+0x00,0x00,0x11,0x4f,0xe1,0x1c,0xf6,0x10,0x06,0xff,0x01,0x00,0x13,0xfd,0x07,0x00,
+0xf1,0x07,0x00,0x00,0xcf,0x60,0x5f,0xc0,0x00,0x00,0x00,0xff,0x30,0x8f,0x90,0x00,
+0x00,0x02,0xff,0x00,0xbf,0x60,0x00,0x4f,0x1c,0x00,0x13,0xf0,0x07,0x00,0x00,0x4c,
+0x00,0x17,0xfe,0x4c,0x00,0xf0,0x08,0xf2,0x09,0xf8,0x00,0x00,0x00,0x2f,0xf0,0x0c,
+0xf6,0x00,0x00,0x00,0x5f,0xc0,0x0f,0xf3,0x00,0x00,0x00,0x00,0x02,0x30,0x06,0x00,
+0x25,0x0a,0xf3,0x06,0x00,0xc0,0x03,0x8e,0xfa,0x40,0x00,0x00,0xaf,0xff,0xff,0xfc,
+0x10,0x09,0x47,0x00,0xd0,0xb0,0x1f,0xff,0xb1,0x19,0xff,0xf3,0x3f,0xff,0x30,0x00,
+0xef,0xf8,0x06,0x00,0x40,0x9c,0xc7,0x1f,0xff,0xd6,0x00,0x51,0x09,0xff,0xfe,0x71,
+0x00,0x2a,0x00,0xf0,0x0d,0x81,0x00,0x00,0x05,0xdf,0xff,0xfe,0x30,0x00,0x00,0x04,
+0xbf,0xff,0xe0,0x00,0x00,0x00,0x05,0xff,0xf6,0xce,0xe7,0x00,0x00,0xdf,0xf9,0xcf,
+0xfb,0x06,0x00,0x70,0x7f,0xff,0x81,0x18,0xff,0xf6,0x1e,0x4e,0x00,0xf3,0x03,0xe0,
+0x02,0xdf,0xff,0xff,0xfd,0x20,0x00,0x04,0x9f,0xf9,0x50,0x00,0x00,0x00,0x0e,0xf0,
+0x00,0x06,0x00,0x40,0x05,0xcf,0xea,0x20,0x0c,0x00,0x40,0x6f,0xff,0xff,0xe1,0x08,
+0x00,0xf2,0x07,0xcf,0xa0,0x2e,0xf6,0x00,0x4f,0x70,0x00,0xef,0x50,0x0b,0xf8,0x00,
+0xef,0x30,0x00,0xcf,0xa0,0x1e,0xf6,0x09,0xf8,0x20,0x00,0x22,0x3f,0xd0,0x30,0x00,
+0x30,0xdf,0x40,0x00,0x01,0x00,0x31,0x08,0xfa,0x00,0x01,0x00,0x22,0x3f,0xe1,0x08,
+0x00,0xf0,0x06,0xdf,0x52,0xbe,0xeb,0x20,0x00,0x00,0x07,0xfb,0x2f,0xff,0xff,0xf2,
+0x00,0x00,0x2f,0xf1,0x9f,0xd1,0x1e,0xf8,0x30,0x01,0x81,0xbf,0x80,0x09,0xfa,0x00,
+0x07,0xfc,0x00,0x08,0x00,0xb1,0x0d,0xf2,0x00,0x9f,0xd1,0x1d,0xf8,0x00,0x00,0x30,
+0x00,0x28,0x00,0x00,0x0c,0x01,0x01,0x38,0x00,0x31,0x7d,0xff,0xc4,0x0d,0x01,0x40,
+0xff,0xff,0xff,0x60,0x29,0x01,0xc0,0xff,0xdd,0xff,0xf1,0x00,0x00,0x00,0x9f,0xf9,
+0x00,0xbf,0xf4,0xf0,0x00,0x30,0xf5,0x00,0x9f,0x28,0x01,0xc0,0x7f,0xfb,0x04,0xff,
+0xd0,0x00,0x00,0x00,0x1f,0xff,0xcf,0xfe,0x44,0x01,0x40,0x06,0xff,0xff,0xc2,0x38,
+0x00,0xf1,0x2a,0x1b,0xff,0xff,0x30,0x02,0x66,0x20,0x01,0xdf,0xff,0xff,0xe2,0x08,
+0xff,0x60,0x0a,0xff,0xd2,0xef,0xfd,0x1b,0xff,0x40,0x0f,0xff,0x50,0x2f,0xff,0xcf,
+0xff,0x10,0x2f,0xff,0x40,0x04,0xff,0xff,0xfb,0x00,0x0f,0xff,0xa0,0x00,0x6f,0xff,
+0xf3,0x00,0x09,0xff,0xfc,0x8a,0xff,0xff,0xf5,0x00,0x00,0xcf,0xb5,0x01,0xf2,0x08,
+0x30,0x00,0x06,0xcf,0xfe,0xc8,0x2c,0xff,0xe2,0x4f,0xf3,0x4f,0xf3,0x4f,0xf2,0x4f,
+0xf1,0x4f,0xf0,0x4f,0xf0,0x28,0x70,0xd9,0x00,0xf0,0x38,0x97,0x00,0x00,0xcf,0xd0,
+0x00,0xaf,0xf3,0x00,0x4f,0xf6,0x00,0x0d,0xfd,0x00,0x04,0xff,0x60,0x00,0xaf,0xf1,
+0x00,0x0f,0xfd,0x00,0x02,0xff,0x90,0x00,0x5f,0xf8,0x00,0x07,0xff,0x60,0x00,0x8f,
+0xf5,0x00,0x08,0xff,0x50,0x00,0x7f,0xf6,0x00,0x06,0xff,0x70,0x00,0x4f,0xf8,0x00,
+0x00,0xff,0xc0,0x00,0x0c,0xff,0x00,0x00,0x6f,0xf4,0x00,0x01,0xff,0xa0,0x00,0x07,
+0xff,0x30,0x3c,0x00,0xa0,0x00,0x2e,0xfb,0x00,0x00,0x2d,0x90,0x00,0x00,0x01,0x59,
+0x00,0x21,0x1d,0x30,0x20,0x00,0xd0,0x00,0x0b,0xff,0x20,0x00,0x01,0xef,0xc0,0x00,
+0x00,0x6f,0xf6,0x00,0x58,0x00,0xf0,0x03,0x00,0x0a,0xff,0x30,0x00,0x07,0xff,0x80,
+0x00,0x03,0xff,0xc0,0x00,0x01,0xff,0xf0,0x00,0x00,0x04,0x00,0x00,0x0f,0x01,0x21,
+0xef,0xf1,0x0c,0x00,0x00,0x14,0x00,0xf1,0x00,0x02,0xff,0xd0,0x00,0x05,0xff,0x90,
+0x00,0x09,0xff,0x50,0x00,0x0d,0xfe,0x00,0x74,0x00,0x60,0xcf,0xe1,0x00,0x07,0xff,
+0x50,0x94,0x00,0x61,0x00,0x3f,0x80,0x00,0x00,0x02,0xbf,0x00,0x10,0x8f,0x36,0x02,
+0x20,0x07,0xfa,0x0f,0x00,0xa0,0x7f,0x90,0x01,0x04,0xfc,0x56,0xf8,0x39,0xf4,0x8f,
+0xf5,0x00,0xa0,0x90,0x16,0xbf,0xff,0xc8,0x30,0x00,0x08,0xff,0xf6,0x3b,0x02,0xf2,
+0x01,0x6f,0xf3,0x00,0x02,0xff,0x70,0x9f,0xe1,0x00,0x1b,0xd0,0x01,0xec,0x10,0x00,
+0x01,0x3e,0x00,0x72,0x08,0x88,0x10,0x00,0x00,0x00,0x01,0xa9,0x01,0x3a,0x1f,0xff,
+0x20,0x0d,0x00,0x11,0x05,0x3d,0x01,0x21,0xf5,0x5f,0x07,0x00,0x12,0x55,0x0d,0x00,
+0x6f,0x01,0x11,0x2f,0xff,0x31,0x11,0x34,0x00,0x06,0x00,0x6b,0x00,0xe0,0x70,0x5f,
+0xf7,0x05,0xff,0x70,0x7f,0xf5,0x0b,0xff,0x02,0xff,0x80,0x3d,0x4e,0x03,0xf0,0x06,
+0x8b,0xbb,0xbb,0xab,0xff,0xff,0xfe,0xbf,0xff,0xff,0xe0,0x06,0x94,0x05,0xff,0xf2,
+0x7f,0xff,0x31,0xcf,0xa0,0x31,0x00,0x10,0xf7,0x9c,0x02,0x00,0x3c,0x00,0x20,0xbf,
+0xc0,0x46,0x00,0x40,0x70,0x00,0x00,0x06,0x44,0x00,0x25,0x0b,0xfc,0x1d,0x00,0x10,
+0xf1,0xb6,0x02,0x00,0x1d,0x00,0x00,0x37,0x02,0x70,0x07,0xff,0x10,0x00,0x00,0x0c,
+0xfb,0x1d,0x00,0x10,0xf6,0x2d,0x02,0x01,0x1d,0x00,0x10,0xb0,0xa8,0x03,0x04,0x1d,
+0x00,0x20,0x0d,0xfb,0x0e,0x01,0x10,0x83,0x8e,0x00,0xf0,0x1b,0x18,0xdf,0xfc,0x70,
+0x00,0x02,0xef,0xff,0xff,0xfc,0x00,0x0d,0xff,0xfd,0xef,0xff,0x90,0x5f,0xff,0x40,
+0x08,0xff,0xf1,0x9f,0xfc,0x00,0x00,0xff,0xf5,0xcf,0xf9,0x00,0x00,0xcf,0xf8,0xdf,
+0xf8,0x00,0x00,0xbf,0xf9,0xef,0x06,0x00,0x18,0xfa,0x06,0x00,0x02,0x18,0x00,0x00,
+0x24,0x00,0x22,0xdf,0xf8,0x30,0x00,0x11,0x4f,0x3c,0x00,0x02,0x48,0x00,0x02,0x54,
+0x00,0x01,0x60,0x00,0x00,0xfc,0x00,0x61,0x7c,0x60,0x01,0x6b,0xff,0xf6,0xd9,0x02,
+0xc0,0xff,0xff,0xff,0xf6,0x0f,0xc7,0x2f,0xff,0x60,0x10,0x00,0xff,0xec,0x01,0x00,
+0x97,0x00,0x0f,0x09,0x00,0x19,0x60,0x02,0x9d,0xff,0xd8,0x10,0x00,0x8c,0x04,0xf0,
+0x00,0xfe,0x20,0x04,0xff,0xff,0xce,0xff,0xfc,0x00,0xcf,0xfd,0x20,0x0a,0xff,0xf2,
+0x1d,0x00,0x81,0x3f,0xff,0x41,0x88,0x82,0x00,0x02,0xff,0x55,0x04,0x30,0x7f,0xfe,
+0x00,0x76,0x04,0x20,0xff,0x70,0x68,0x02,0x01,0x32,0x03,0x31,0x0c,0xff,0xe2,0x06,
+0x00,0x15,0xf3,0x06,0x00,0x35,0x0b,0xff,0xf4,0x06,0x00,0x81,0x0a,0xff,0xfe,0xcc,
+0xcc,0xcc,0xa0,0xdf,0xe6,0x04,0x11,0x0d,0xcb,0x01,0x60,0xd0,0x00,0x04,0xae,0xfe,
+0xc7,0x72,0x04,0x00,0x3c,0x04,0x12,0x07,0x6f,0x00,0x10,0xdf,0xa0,0x04,0x80,0xf2,
+0x08,0x99,0x30,0x00,0x1f,0xff,0x40,0xb8,0x04,0x11,0xff,0xbe,0x04,0x21,0xcf,0xfc,
+0x8b,0x03,0x21,0xfc,0x10,0x2b,0x04,0x91,0x50,0x00,0x00,0x04,0xab,0xdf,0xff,0x90,
+0x00,0xc9,0x03,0x01,0xeb,0x04,0xd1,0xef,0xf8,0x2c,0xcc,0x20,0x00,0x0d,0xff,0x81,
+0xff,0xfb,0x00,0x06,0x0e,0x01,0x51,0xce,0xff,0xfe,0x00,0x0b,0xca,0x00,0x51,0x00,
+0x05,0xbe,0xff,0xc7,0xac,0x02,0x12,0x09,0xbd,0x00,0x12,0x3f,0x07,0x00,0x11,0xdf,
+0x07,0x00,0x21,0x08,0xff,0x07,0x00,0x21,0x2f,0xfe,0x07,0x00,0x40,0xcf,0xf5,0xff,
+0xf3,0xcb,0x01,0x10,0x73,0x07,0x00,0x21,0x2f,0xfc,0x7f,0x00,0x20,0xcf,0xf3,0x07,
+0x00,0x30,0x06,0xff,0x80,0x07,0x00,0x72,0x1f,0xff,0xcb,0xbc,0xff,0xfc,0xb1,0x94,
+0x02,0x22,0xf1,0x3f,0x07,0x00,0x05,0xa9,0x00,0x1e,0x00,0x07,0x00,0x01,0xda,0x05,
+0x21,0xf3,0x08,0x06,0x00,0x81,0x0a,0xff,0xed,0xdd,0xdd,0xd2,0x0c,0xff,0x25,0x05,
+0x01,0xb9,0x00,0x40,0x0f,0xff,0x36,0x87,0xec,0x00,0x41,0xff,0xff,0xfb,0x10,0x4d,
+0x00,0x71,0xc0,0x18,0xcc,0x30,0x2b,0xff,0xf4,0xd4,0x00,0x20,0xf9,0x00,0x9a,0x02,
+0x20,0xfb,0x00,0xa0,0x04,0x20,0xfb,0xaf,0x75,0x05,0xf1,0x00,0xfa,0x7f,0xff,0x40,
+0x06,0xff,0xf5,0x0e,0xff,0xfd,0xdf,0xff,0xd0,0x03,0xef,0xde,0x00,0x40,0x17,0xcf,
+0xfd,0x81,0xaa,0x04,0x81,0xbe,0xf5,0x00,0x00,0x04,0xef,0xff,0xf5,0x23,0x01,0x91,
+0xd4,0x00,0x03,0xff,0xfb,0x30,0x00,0x00,0x0d,0x26,0x01,0xd0,0x4f,0xff,0x27,0xab,
+0x81,0x00,0x8f,0xfd,0xef,0xff,0xff,0x40,0xbf,0x66,0x00,0xd0,0xe1,0xcf,0xff,0x81,
+0x19,0xff,0xf7,0xdf,0xfa,0x00,0x00,0xcf,0xfc,0x68,0x02,0x40,0x8f,0xfe,0xbf,0xfa,
+0x06,0x00,0xf0,0x03,0x8f,0xfe,0x00,0x00,0xbf,0xfc,0x3f,0xff,0x70,0x05,0xff,0xf7,
+0x0a,0xff,0xfe,0xdf,0xff,0xe0,0xc3,0x04,0x10,0xfe,0xc1,0x04,0x23,0xfd,0x81,0x8a,
+0x06,0x11,0xc4,0x06,0x00,0x80,0xfc,0x3c,0xcc,0xcc,0xcc,0xcf,0xff,0x80,0x62,0x05,
+0x01,0x02,0x01,0x32,0x00,0x9f,0xfa,0x85,0x03,0x11,0x30,0x56,0x01,0x30,0xc0,0x00,
+0x00,0xb9,0x02,0x06,0x2d,0x02,0x11,0x0e,0x2d,0x02,0x10,0x06,0x6c,0x04,0x00,0x3f,
+0x06,0x02,0xbd,0x01,0x11,0x20,0x2e,0x02,0x11,0xb0,0x2c,0x01,0x11,0xf4,0xef,0x00,
+0x12,0xfd,0x59,0x02,0x10,0x60,0x07,0x00,0x42,0x3a,0xef,0xfd,0x81,0x8f,0x02,0xf0,
+0x00,0x30,0x2f,0xff,0xfc,0xdf,0xff,0xd0,0x6f,0xff,0x30,0x07,0xff,0xf3,0x7f,0xfe,
+0x87,0x02,0x10,0x3f,0x0c,0x00,0x20,0xf0,0x0a,0x18,0x00,0x30,0x60,0x00,0x9f,0x6e,
+0x05,0x11,0x07,0x6c,0x05,0x80,0x3f,0xff,0x71,0x1a,0xff,0xe0,0xaf,0xfb,0xd7,0x02,
+0x10,0xdf,0xb6,0x04,0x30,0xf9,0xdf,0xfa,0x4d,0x01,0x70,0xaf,0xff,0x30,0x06,0xff,
+0xf6,0x3f,0x3b,0x01,0x12,0xe0,0x54,0x00,0x50,0x00,0x3a,0xdf,0xfd,0x81,0x49,0x03,
+0x30,0xeb,0x30,0x00,0x4d,0x01,0x30,0xf7,0x00,0x1e,0x61,0x03,0xf0,0x00,0x40,0x7f,
+0xff,0x40,0x0b,0xff,0xd0,0xcf,0xfa,0x00,0x02,0xff,0xf2,0xef,0xf7,0x48,0x00,0x80,
+0xff,0xf7,0x00,0x00,0xef,0xf7,0xdf,0xfb,0x69,0x02,0x10,0x8f,0x60,0x00,0x11,0xf7,
+0xf8,0x06,0xd1,0xf6,0x03,0xef,0xff,0xfc,0xff,0xf4,0x00,0x06,0x98,0x43,0xff,0xf0,
+0xec,0x02,0xa0,0xa0,0x00,0x00,0x03,0xbf,0xff,0x20,0x00,0x6d,0xff,0x33,0x00,0x11,
+0x7f,0x6d,0x06,0xe2,0x7f,0xec,0x71,0x00,0x00,0x1c,0xf9,0x07,0xff,0xf3,0x5f,0xff,
+0x20,0x69,0xde,0x06,0x04,0x01,0x00,0xfd,0x08,0x69,0x40,0x5f,0xff,0x27,0xff,0xf3,
+0x1c,0xfa,0x00,0x02,0xdf,0x70,0x0a,0xff,0xf0,0x08,0xff,0xe0,0x00,0x79,0x20,0x00,
+0x01,0x00,0xf2,0x07,0x01,0xee,0xa0,0x01,0xff,0xc0,0x01,0xff,0xb0,0x03,0xff,0x90,
+0x07,0xff,0x50,0x0d,0xfd,0x00,0x1d,0xf3,0x00,0x00,0x29,0x00,0x50,0x17,0x90,0x00,
+0x00,0x03,0xf0,0x00,0xf0,0x03,0x5c,0xff,0xff,0xb0,0x17,0xef,0xff,0xff,0xb4,0x4f,
+0xff,0xff,0xd7,0x10,0x05,0xff,0xfa,0x30,0x63,0x01,0x20,0xfc,0x61,0xfe,0x06,0x30,
+0xff,0xfb,0x50,0xc8,0x07,0x00,0x6b,0x01,0x21,0x29,0xff,0x53,0x02,0x21,0x7d,0xb0,
+0x1e,0x07,0x11,0x6f,0xc2,0x02,0x02,0x06,0x00,0x68,0x5c,0xcc,0xcc,0xcc,0xcc,0xc0,
+0x78,0x00,0x02,0x12,0x00,0x08,0x24,0x00,0x21,0x88,0x10,0x49,0x03,0x10,0xa4,0xf1,
+0x01,0xe0,0xff,0xfd,0x60,0x00,0x03,0xaf,0xff,0xff,0xf9,0x20,0x00,0x05,0xbf,0xff,
+0xe0,0x01,0xf1,0x05,0x18,0xff,0xf9,0x00,0x00,0x5b,0xff,0xff,0x90,0x4a,0xff,0xff,
+0xfe,0x82,0x9f,0xff,0xff,0xd6,0x00,0x09,0x88,0x00,0x34,0x9e,0x81,0x00,0x32,0x06,
+0x20,0x00,0x29,0x77,0x01,0x10,0x04,0x83,0x01,0x20,0x10,0x0e,0x71,0x01,0x20,0xa0,
+0x5f,0x52,0x07,0x51,0xf0,0x4b,0xba,0x00,0x05,0x4a,0x02,0x11,0x08,0x6f,0x08,0x10,
+0x3f,0x50,0x00,0x11,0x04,0xac,0x00,0x11,0x2f,0x22,0x02,0x21,0xaf,0xfc,0x3a,0x02,
+0x01,0x27,0x02,0x26,0xab,0xb0,0xa4,0x00,0x21,0x39,0x50,0x03,0x06,0x11,0xf5,0x45,
+0x02,0x11,0xf7,0x8a,0x02,0x11,0xc1,0x19,0x00,0x51,0x04,0x9d,0xff,0xec,0x82,0x0a,
+0x00,0x10,0x2c,0xbb,0x00,0x02,0x73,0x02,0xb1,0xfe,0x72,0x00,0x03,0x8f,0xfd,0x10,
+0x00,0x00,0x4f,0xfb,0x25,0x07,0x42,0xfb,0x00,0x00,0x1e,0x6b,0x08,0xe0,0x1e,0xf5,
+0x00,0x08,0xfe,0x10,0x00,0x6d,0xfe,0xa2,0x00,0x6f,0xc0,0x00,0x87,0x07,0xf0,0x51,
+0xff,0xff,0xf1,0x01,0xff,0x10,0x5f,0xf1,0x00,0x7f,0xf7,0x16,0xff,0x00,0x0c,0xf5,
+0x09,0xfb,0x00,0x1f,0xf9,0x00,0x6f,0xf0,0x00,0xaf,0x70,0xcf,0x80,0x06,0xff,0x20,
+0x07,0xfe,0x00,0x09,0xf7,0x0e,0xf6,0x00,0xaf,0xe0,0x00,0x9f,0xc0,0x00,0x9f,0x70,
+0xff,0x50,0x0d,0xfb,0x00,0x0a,0xfb,0x00,0x0b,0xf6,0x0f,0xf5,0x00,0xef,0xb0,0x00,
+0xcf,0x90,0x00,0xef,0x30,0xef,0x60,0x0d,0xfd,0x00,0x1f,0xf8,0x00,0x4f,0xe0,0x0c,
+0xf8,0x00,0xaf,0xf7,0x3c,0xff,0xc0,0x1d,0xf7,0x00,0x9f,0xd0,0x02,0xff,0xff,0xfa,
+0x33,0x08,0xd5,0x03,0xff,0x30,0x04,0xdf,0xd5,0x06,0xdf,0xd7,0x00,0x00,0x0c,0xfd,
+0xd4,0x00,0x34,0x3f,0xfc,0x10,0x0b,0x00,0x61,0x6f,0xff,0x94,0x21,0x24,0x86,0x0b,
+0x00,0x11,0x4d,0xbb,0x09,0x01,0x0b,0x00,0x24,0x05,0xad,0xdc,0x00,0x23,0x00,0xcf,
+0x37,0x00,0x12,0x2f,0x42,0x03,0x00,0xd2,0x04,0x22,0xa0,0x00,0xe1,0x04,0x22,0xff,
+0x00,0xf0,0x04,0x22,0xef,0xf6,0xff,0x04,0x13,0xb9,0x97,0x03,0x41,0xf6,0x4f,0xff,
+0x20,0x80,0x03,0x31,0x10,0xef,0xf8,0xb8,0x02,0x40,0xb0,0x09,0xff,0xd0,0x45,0x01,
+0x50,0xf6,0x00,0x4f,0xff,0x40,0xb9,0x02,0x40,0x10,0x00,0xef,0xfa,0x3f,0x04,0x02,
+0x74,0x0a,0x11,0x03,0x08,0x00,0x01,0x68,0x03,0x90,0xee,0xee,0xee,0xff,0xfc,0x00,
+0x0f,0xff,0xc0,0x50,0x00,0x41,0xf2,0x05,0xff,0xf6,0x61,0x00,0x31,0x80,0xbf,0xff,
+0x72,0x00,0x10,0xfe,0xf4,0x02,0x31,0xff,0xd9,0x30,0x07,0x00,0x80,0xff,0xf8,0x00,
+0x7f,0xff,0xee,0xef,0xff,0x52,0x03,0x00,0xc8,0x00,0x30,0xa0,0x7f,0xff,0xee,0x03,
+0x12,0xc0,0x07,0x00,0x00,0x0e,0x00,0x41,0x01,0x7f,0xff,0x40,0x2a,0x00,0x12,0xf7,
+0x31,0x00,0xb0,0xd4,0x00,0x7f,0xff,0x98,0x89,0xdf,0xff,0x50,0x7f,0xff,0x96,0x00,
+0x30,0xe0,0x7f,0xff,0x32,0x04,0x17,0xf2,0x07,0x00,0xb1,0x2e,0xff,0xf0,0x7f,0xff,
+0xdd,0xde,0xff,0xff,0x90,0x7f,0x86,0x04,0x01,0x38,0x00,0xb0,0xeb,0x60,0x00,0x00,
+0x01,0x8c,0xef,0xea,0x40,0x00,0x00,0x99,0x05,0x10,0xfa,0x5d,0x02,0x00,0x2a,0x01,
+0x80,0x0e,0xff,0xe4,0x00,0x2b,0xff,0xf4,0x5f,0xd3,0x00,0x30,0xef,0xfa,0xaf,0x28,
+0x01,0x32,0x9e,0xec,0xdf,0xee,0x01,0x2e,0xff,0xf9,0x07,0x00,0x01,0xf4,0x00,0x04,
+0x85,0x04,0x50,0x8c,0xca,0x6f,0xff,0x30,0x13,0x00,0x92,0x0f,0xff,0xd3,0x00,0x1a,
+0xff,0xf5,0x05,0xff,0x7e,0x01,0x20,0x6f,0xff,0xb7,0x01,0x00,0x2c,0x07,0x20,0xea,
+0x40,0x7e,0x00,0x32,0xfd,0x82,0x00,0xbd,0x00,0x10,0x60,0xee,0x00,0x02,0xf5,0x00,
+0x32,0x00,0x03,0xcf,0xf5,0x00,0x37,0x0d,0xff,0xc0,0xbd,0x00,0x50,0x02,0xff,0xf6,
+0x7f,0xff,0x6e,0x00,0x12,0xf7,0x07,0x00,0x17,0xf8,0x0e,0x00,0x03,0x1c,0x00,0x03,
+0x2a,0x00,0x02,0x38,0x00,0x11,0x02,0x46,0x00,0x42,0xdd,0xef,0xff,0xf9,0x62,0x00,
+0x19,0x70,0x70,0x00,0x13,0xff,0x06,0x00,0x00,0x93,0x01,0x21,0xed,0x7f,0x80,0x01,
+0x0f,0x06,0x00,0x01,0x00,0x55,0x06,0x04,0x06,0x00,0x4f,0xcc,0xcc,0xcc,0x90,0x2a,
+0x00,0x07,0x4a,0xdd,0xdd,0xdd,0xdd,0x5a,0x00,0x00,0x4d,0x01,0x03,0x06,0x00,0x00,
+0x66,0x00,0x1f,0xe8,0x3c,0x00,0x0a,0x1a,0xa0,0x6c,0x00,0x0f,0x2a,0x00,0x05,0x0b,
+0x06,0x00,0x00,0xc2,0x08,0x31,0xef,0xeb,0x60,0xbc,0x06,0x30,0xff,0xff,0xd2,0x6b,
+0x02,0xd0,0xfe,0xff,0xff,0xe0,0x00,0xdf,0xff,0x50,0x00,0x8f,0xff,0x70,0x4f,0x42,
+0x05,0x30,0xbf,0xfd,0x09,0x60,0x05,0x40,0x03,0x88,0x70,0xcf,0x04,0x04,0x00,0x1f,
+0x01,0x14,0xb0,0xb0,0x01,0x00,0xe4,0x07,0x00,0x0f,0x00,0xb1,0xbf,0xff,0xff,0xf0,
+0xcf,0xfc,0x00,0x06,0x99,0xcf,0xff,0x2d,0x00,0x10,0x07,0x32,0x0d,0x11,0x70,0x65,
+0x00,0x90,0xdf,0xff,0x70,0x00,0x1b,0xff,0xf0,0x03,0xff,0x6d,0x04,0x11,0xfe,0xeb,
+0x05,0x93,0xff,0xfc,0x20,0x00,0x01,0x6c,0xef,0xed,0x94,0x86,0x00,0x51,0x1f,0xff,
+0x67,0xff,0xf0,0x01,0x03,0x0f,0x0f,0x00,0x14,0x11,0xff,0x00,0x06,0x12,0x7f,0x08,
+0x00,0x8f,0x67,0xff,0xfd,0xdd,0xdd,0xdd,0xff,0xf6,0x4b,0x00,0x21,0x6f,0x60,0x4f,
+0xff,0x44,0xff,0xf4,0x05,0x00,0x12,0x11,0x40,0xdc,0x04,0x1f,0xfe,0x06,0x00,0x29,
+0x20,0x13,0x33,0x06,0x00,0x00,0xdf,0x03,0xe1,0xbf,0xfd,0x4f,0xff,0x90,0x05,0xff,
+0xf9,0x0d,0xff,0xff,0xef,0xff,0xf2,0x14,0x01,0x61,0x50,0x00,0x18,0xdf,0xfd,0x92,
+0x11,0x01,0x41,0x07,0xff,0xfd,0x07,0xf8,0x03,0x20,0xfe,0x20,0xa7,0x03,0x30,0xef,
+0xff,0x40,0x0f,0x00,0x11,0xcf,0x82,0x02,0x20,0x00,0x8f,0x72,0x0c,0x00,0x18,0x0f,
+0x10,0xc0,0x3e,0x01,0x31,0x2f,0xff,0xe1,0x30,0x00,0x23,0xff,0xf6,0x6f,0x02,0x22,
+0xc0,0x00,0x8a,0x07,0x01,0x7d,0x01,0xb1,0xf9,0xdf,0xff,0x20,0x00,0x07,0xff,0xfa,
+0x04,0xff,0xfc,0x6b,0x01,0x40,0x0a,0xff,0xf7,0x00,0x4b,0x00,0x31,0x1e,0xff,0xf2,
+0x69,0x00,0x40,0x5f,0xff,0xc0,0x07,0x11,0x01,0x50,0xbf,0xff,0x70,0x7f,0xff,0x18,
+0x01,0x2e,0xff,0x20,0x3b,0x02,0x0f,0x06,0x00,0x30,0x00,0xa1,0x02,0x12,0xd6,0x95,
+0x04,0x60,0x7f,0xff,0xff,0xff,0xff,0xf8,0xf1,0x0b,0x7f,0xff,0xf4,0x00,0x00,0x00,
+0x05,0xff,0xff,0x77,0xff,0xff,0xa0,0x00,0x00,0x00,0xaf,0xff,0xf7,0x7f,0xff,0xff,
+0x00,0x00,0x00,0x0f,0x13,0x00,0xf0,0x42,0xf5,0x00,0x00,0x06,0xff,0xff,0xf7,0x7f,
+0xfe,0xff,0xb0,0x00,0x00,0xbf,0xfe,0xff,0x77,0xff,0xbe,0xff,0x10,0x00,0x1f,0xfd,
+0xcf,0xf7,0x7f,0xfc,0x8f,0xf6,0x00,0x07,0xff,0x8c,0xff,0x77,0xff,0xd2,0xff,0xc0,
+0x00,0xcf,0xf2,0xdf,0xf7,0x7f,0xfd,0x0c,0xff,0x20,0x2f,0xfc,0x0e,0xff,0x77,0xff,
+0xe0,0x7f,0xf7,0x08,0xff,0x60,0xef,0xf7,0x7f,0xff,0x01,0xff,0xd0,0xdf,0xf1,0x0f,
+0xff,0x77,0xff,0xf0,0x0b,0xff,0x6f,0xfb,0x00,0x5f,0x00,0x51,0x00,0x5f,0xff,0xff,
+0x50,0x13,0x00,0x42,0x00,0xff,0xff,0xf0,0x13,0x00,0x42,0x0a,0xff,0xf9,0x00,0x13,
+0x00,0x32,0x4f,0xff,0x30,0x13,0x00,0xf2,0x0a,0x00,0xef,0xe0,0x00,0x0f,0xff,0x70,
+0x7f,0xff,0x50,0x00,0x00,0x1f,0xff,0x67,0xff,0xfe,0x00,0x00,0x01,0xff,0xf6,0x7f,
+0xff,0xf9,0x0f,0x00,0x22,0xff,0xf3,0x0f,0x00,0x22,0xff,0xc0,0x0f,0x00,0x21,0xff,
+0x60,0x0f,0x00,0x30,0x9f,0xfe,0x10,0x0f,0x00,0x31,0xf1,0xef,0xfa,0x0f,0x00,0x60,
+0x04,0xff,0xf3,0x1f,0xff,0x67,0x7d,0x00,0x10,0xd2,0x0f,0x00,0x40,0x00,0x2f,0xff,
+0x9f,0x0f,0x00,0x31,0x00,0x7f,0xff,0x0f,0x00,0x31,0x00,0xdf,0xff,0x0f,0x00,0x13,
+0x04,0x0f,0x00,0x12,0x0a,0x0f,0x00,0x22,0x00,0x1e,0x0f,0x00,0xf0,0x00,0x00,0x6f,
+0xff,0x60,0x00,0x00,0x6c,0xef,0xda,0x30,0x00,0x00,0x03,0xef,0xff,0x23,0x01,0x20,
+0x03,0xff,0x01,0x00,0xa0,0xb0,0x00,0xdf,0xff,0x60,0x02,0xbf,0xff,0x60,0x4f,0x21,
+0x00,0x50,0xdf,0xfd,0x0a,0xff,0xe0,0x2a,0x01,0xf1,0x03,0xf3,0xdf,0xfb,0x00,0x00,
+0x00,0x2f,0xff,0x6e,0xff,0x90,0x00,0x00,0x00,0xff,0xf7,0xff,0xf9,0x4a,0x01,0x13,
+0x8e,0x0f,0x00,0x03,0x1e,0x00,0x13,0x6a,0x2d,0x00,0x11,0x5f,0x3c,0x00,0x10,0xfe,
+0x4b,0x00,0x80,0x01,0xbf,0xff,0x60,0x03,0xff,0xff,0xfe,0x5a,0x00,0x03,0x69,0x00,
+0x01,0x78,0x00,0x20,0x40,0x00,0xaa,0x00,0x31,0xff,0xda,0x40,0x07,0x00,0xa0,0xff,
+0xfa,0x00,0x7f,0xff,0xee,0xee,0xff,0xff,0x90,0x9d,0x00,0x30,0x2d,0xff,0xf2,0x07,
+0x00,0x12,0x03,0x2d,0x01,0x30,0x00,0xff,0xf8,0x07,0x00,0x12,0x01,0x07,0x00,0xa1,
+0x1b,0xff,0xf4,0x7f,0xff,0xdd,0xde,0xff,0xff,0xc0,0x38,0x00,0x20,0xfc,0x10,0x07,
+0x00,0x31,0xeb,0x50,0x00,0x2a,0x00,0x1f,0x00,0x07,0x00,0x11,0x85,0x00,0x00,0x07,
+0xce,0xfd,0xa3,0x00,0x00,0x8f,0x00,0x10,0x3f,0x49,0x00,0x23,0xfb,0x00,0xf9,0x00,
+0x20,0x50,0x05,0x1c,0x02,0x33,0x0d,0xff,0xd0,0xfa,0x00,0x20,0xf2,0x0d,0x24,0x00,
+0x60,0x02,0xff,0xf5,0x0f,0xff,0x90,0x86,0x00,0x41,0xf7,0x0f,0xff,0x80,0x95,0x00,
+0x04,0x10,0x00,0x04,0x20,0x00,0x04,0x30,0x00,0x31,0x05,0xff,0xf6,0x40,0x00,0x04,
+0x50,0x00,0x00,0x60,0x00,0x33,0xef,0xff,0xfa,0x70,0x00,0x70,0xd0,0x00,0x00,0x00,
+0x17,0xce,0xff,0x10,0x00,0x11,0x00,0x96,0x02,0x12,0xd2,0x93,0x00,0x22,0xff,0xa0,
+0x11,0x00,0x19,0x48,0x17,0x01,0x10,0xf9,0x17,0x01,0x40,0xef,0xff,0xff,0x70,0xbc,
+0x00,0x30,0x4f,0xff,0xe0,0x07,0x00,0x30,0x08,0xff,0xf1,0x07,0x00,0x12,0x06,0x25,
+0x01,0xa1,0x09,0xff,0xf0,0x7f,0xff,0x00,0x01,0x6f,0xff,0xa0,0x31,0x00,0x21,0xfe,
+0x20,0x07,0x00,0x12,0xb2,0x38,0x00,0x10,0x60,0xf4,0x00,0x30,0x0d,0xff,0xe0,0x07,
+0x00,0x31,0x04,0xff,0xf7,0x02,0x01,0x32,0xcf,0xfe,0x00,0x4d,0x00,0x10,0x80,0x07,
+0x00,0x32,0x0b,0xff,0xf1,0x6b,0x01,0xa0,0xf8,0x00,0x00,0x6b,0xef,0xec,0x70,0x00,
+0x00,0x3e,0x46,0x00,0xf0,0x01,0x30,0x01,0xef,0xff,0xfd,0xff,0xff,0xe1,0x07,0xff,
+0xf7,0x00,0x06,0xff,0xf9,0x09,0xdb,0x00,0xd0,0xcf,0xfc,0x08,0xff,0xf2,0x00,0x00,
+0x13,0x32,0x02,0xff,0xff,0x82,0xab,0x00,0xc0,0x5f,0xff,0xff,0xc7,0x10,0x00,0x00,
+0x03,0xcf,0xff,0xff,0xf8,0x4f,0x01,0x40,0x9e,0xff,0xff,0xb0,0x18,0x00,0xa1,0x4c,
+0xff,0xf7,0x17,0x77,0x20,0x00,0x00,0xdf,0xfc,0x2b,0x01,0xf0,0x03,0xaf,0xfe,0x0c,
+0xff,0xf5,0x00,0x03,0xff,0xfc,0x03,0xff,0xff,0xfd,0xef,0xff,0xf5,0x00,0x4e,0xa2,
+0x00,0x10,0x80,0x70,0x00,0x51,0xfd,0x93,0x00,0x8f,0xff,0x01,0x00,0x12,0x68,0x07,
+0x00,0x90,0xf6,0x7e,0xee,0xee,0xff,0xfe,0xee,0xee,0x50,0xa1,0x02,0x31,0x20,0x00,
+0x00,0xe7,0x00,0x01,0x18,0x01,0x0f,0x0f,0x00,0x45,0x21,0xaf,0xfe,0xc5,0x01,0x0f,
+0x07,0x00,0x33,0x50,0x9f,0xff,0x00,0x00,0x02,0x61,0x03,0xf1,0x07,0x20,0x00,0x05,
+0xff,0xf4,0x3f,0xff,0xc2,0x00,0x3e,0xff,0xe0,0x0a,0xff,0xff,0xee,0xff,0xff,0x60,
+0x00,0xbf,0xff,0x28,0x01,0x90,0x04,0xae,0xff,0xd9,0x30,0x00,0xcf,0xff,0x20,0xf5,
+0x01,0x10,0xf6,0x87,0x03,0x00,0x85,0x01,0x30,0x1f,0xff,0xb0,0xfd,0x03,0x40,0xb0,
+0x0b,0xff,0xf0,0x59,0x01,0x11,0x60,0x85,0x02,0x40,0xaf,0xff,0x10,0x00,0x69,0x03,
+0x21,0xef,0xfa,0xa8,0x00,0x40,0x03,0xff,0xf5,0x00,0x45,0x04,0x10,0x08,0x24,0x00,
+0x31,0x0e,0xff,0x80,0x79,0x02,0xd0,0x09,0xff,0xc0,0x2f,0xff,0x40,0x00,0x00,0x04,
+0xff,0xf1,0x7f,0xfe,0xd7,0x00,0x40,0xef,0xf6,0xbf,0xf9,0x08,0x00,0x61,0x9f,0xfc,
+0xff,0xf3,0x00,0x00,0xde,0x02,0x10,0xe0,0x08,0x00,0x11,0x0d,0x74,0x01,0x00,0x3f,
+0x02,0x40,0xff,0x30,0x00,0x00,0xa8,0x00,0x13,0xfd,0x14,0x03,0xa0,0x1f,0xff,0x20,
+0x00,0x0f,0xff,0x74,0xff,0xf3,0x00,0x76,0x00,0xf1,0x0c,0x02,0xff,0xf4,0x0f,0xff,
+0x60,0x00,0x8f,0xff,0x90,0x00,0x5f,0xff,0x00,0xdf,0xf9,0x00,0x0c,0xff,0xfd,0x00,
+0x08,0xff,0xd0,0x09,0xff,0xc0,0xd5,0x04,0x20,0xbf,0xf9,0x18,0x00,0xf0,0x2a,0x4f,
+0xff,0xff,0x40,0x0e,0xff,0x60,0x02,0xff,0xf2,0x07,0xff,0x9f,0xf8,0x01,0xff,0xf2,
+0x00,0x0e,0xff,0x50,0xbf,0xf1,0xff,0xb0,0x4f,0xfe,0x00,0x00,0xbf,0xf8,0x0f,0xfc,
+0x0c,0xff,0x07,0xff,0xb0,0x00,0x07,0xff,0xb2,0xff,0x90,0x8f,0xf3,0xaf,0xf7,0x00,
+0x00,0x4f,0xfe,0x6f,0xf5,0x04,0xff,0x6d,0xac,0x00,0x60,0xff,0xfc,0xff,0x10,0x0f,
+0xfb,0xc6,0x00,0x10,0x0c,0x11,0x03,0x11,0xcf,0x8a,0x00,0x30,0x9f,0xff,0xf9,0x9c,
+0x00,0x11,0x90,0xb4,0x05,0x51,0x50,0x00,0x5f,0xff,0xf6,0x53,0x04,0x41,0xf1,0x00,
+0x01,0xff,0xb0,0x01,0x30,0xef,0xfd,0x00,0xcb,0x02,0x00,0x1e,0x01,0x10,0xb0,0xb8,
+0x00,0xf0,0x07,0x90,0xbf,0xff,0x30,0x00,0x0e,0xff,0xe1,0x02,0xff,0xfc,0x00,0x08,
+0xff,0xf6,0x00,0x08,0xff,0xf5,0x01,0xff,0xfc,0x19,0x01,0x40,0xd0,0x9f,0xff,0x30,
+0x27,0x00,0x11,0x8f,0x54,0x03,0x60,0xcf,0xff,0xff,0xf1,0x00,0x00,0xde,0x04,0x31,
+0xf7,0x00,0x00,0x72,0x00,0x20,0x10,0x00,0x2f,0x01,0x01,0xb4,0x02,0x00,0x26,0x05,
+0x11,0xf2,0x07,0x01,0x11,0x8f,0x81,0x01,0x00,0x3c,0x00,0x70,0x50,0x00,0x0a,0xff,
+0xf4,0x01,0xff,0x70,0x01,0xb0,0xfb,0x00,0x07,0xff,0xf8,0x00,0xdf,0xff,0x20,0x00,
+0x0e,0x6e,0x03,0x11,0x90,0x7d,0x00,0x30,0xbf,0xff,0x10,0x87,0x01,0x31,0x83,0xff,
+0xf8,0xba,0x01,0x31,0x0a,0xff,0xf1,0x3f,0x03,0x31,0x2f,0xff,0x70,0x4d,0x02,0x20,
+0xaf,0xfe,0x0b,0x00,0x00,0x07,0x02,0x01,0x36,0x03,0x31,0x09,0xff,0xd1,0x79,0x00,
+0x41,0x1f,0xff,0xcf,0xfe,0x97,0x01,0x00,0x0b,0x02,0x00,0x2d,0x02,0x01,0x0a,0x04,
+0x01,0xba,0x00,0x02,0x94,0x02,0x12,0x30,0x94,0x02,0x1f,0xf3,0x0f,0x00,0x0e,0x21,
+0x2f,0xff,0x31,0x05,0x03,0x07,0x00,0x40,0x1e,0xee,0xee,0xee,0x55,0x03,0x01,0x19,
+0x00,0x11,0xa0,0xd3,0x00,0x21,0xfe,0x10,0x59,0x00,0x10,0xf4,0x0d,0x00,0x11,0x4f,
+0xa1,0x05,0x01,0x3d,0x01,0x00,0x04,0x06,0x12,0xf3,0xb8,0x03,0x10,0x70,0x82,0x00,
+0x40,0xef,0xfc,0x00,0x00,0xc2,0x00,0x12,0xf2,0x1c,0x05,0x11,0x60,0x14,0x02,0x12,
+0xfb,0x2b,0x02,0x52,0xfe,0xdd,0xdd,0xdd,0xdb,0x62,0x00,0x13,0xfd,0x07,0x00,0x30,
+0x9f,0xff,0xf7,0x03,0x00,0x5f,0xfe,0xa4,0x9f,0xfd,0x00,0x03,0x00,0x21,0x22,0xfe,
+0xa4,0x42,0x00,0x21,0xcf,0xfa,0xca,0x00,0x11,0xf1,0x14,0x01,0x10,0x60,0x82,0x03,
+0x11,0xfc,0x90,0x01,0x00,0x87,0x00,0x11,0x0e,0xae,0x00,0x31,0x8f,0xfe,0x00,0x51,
+0x05,0x01,0x9e,0x00,0x11,0xb0,0xb1,0x00,0x10,0x10,0xc4,0x00,0x20,0xf7,0x00,0x4f,
+0x01,0x11,0xd0,0xd4,0x02,0x10,0x40,0xe9,0x00,0x0f,0x4a,0x00,0x04,0x10,0xf3,0x50,
+0x05,0xcf,0x88,0x30,0xdf,0xff,0xf3,0xdf,0xff,0xf3,0x8b,0xff,0xf3,0x02,0x03,0x00,
+0x22,0x11,0x8b,0x3f,0x00,0x10,0xdf,0x4e,0x00,0x50,0x78,0x40,0x00,0x00,0x06,0xcd,
+0x01,0x10,0x0c,0x55,0x01,0x10,0x3f,0x25,0x01,0xf0,0x0a,0xaf,0xe6,0xff,0x20,0x01,
+0xff,0x81,0xff,0x80,0x07,0xff,0x20,0xaf,0xe0,0x0d,0xfc,0x00,0x4f,0xf5,0x4f,0xf6,
+0x00,0x0e,0xfc,0xaa,0x01,0x00,0x11,0x7f,0x51,0x06,0x02,0x4f,0x07,0xf0,0x04,0x1a,
+0xaa,0x50,0x00,0x5f,0xfe,0x10,0x00,0x7f,0xfa,0x00,0x00,0x9f,0xf4,0x00,0x05,0xbe,
+0xfe,0xb4,0xd7,0x00,0x00,0x8e,0x02,0xd1,0x08,0xff,0xfa,0x8d,0xff,0xf2,0x00,0xcf,
+0xf9,0x00,0x1f,0xff,0x70,0xba,0x01,0xa1,0xf8,0x00,0x01,0x8c,0xef,0xff,0xff,0x90,
+0x03,0xef,0xfc,0x05,0x60,0xdf,0xfd,0x30,0x0d,0xff,0x90,0xdf,0x03,0x20,0xdf,0xf9,
+0x10,0x01,0x80,0x2f,0xff,0x90,0x0e,0xff,0xfa,0xbf,0xff,0x82,0x03,0x01,0xbb,0x06,
+0x71,0x4b,0xff,0xc6,0x7f,0xfe,0x00,0xbf,0xb5,0x01,0x0f,0x06,0x00,0x07,0x30,0x5c,
+0xfe,0xa2,0xe2,0x08,0x40,0xff,0xff,0x30,0xbf,0x81,0x05,0x70,0xd0,0xbf,0xff,0x20,
+0x07,0xff,0xf5,0x1e,0x00,0x20,0xef,0xf8,0x06,0x00,0x30,0xbf,0xfa,0xbf,0xd2,0x00,
+0x16,0xfb,0x0c,0x00,0xf0,0x0e,0xef,0xf9,0xbf,0xff,0x20,0x06,0xff,0xf5,0xbf,0xff,
+0xfc,0xdf,0xff,0xe0,0xbf,0xfd,0xff,0xff,0xff,0x40,0xbf,0xf6,0x5c,0xfe,0xb3,0x00,
+0x00,0x03,0xae,0xc1,0x00,0x10,0x6f,0xc2,0x05,0xc0,0x03,0xff,0xff,0xcf,0xff,0xf4,
+0x0b,0xff,0xd1,0x01,0xcf,0xfa,0x33,0x04,0x31,0x5e,0xec,0x2f,0xa8,0x02,0x11,0x3f,
+0xb0,0x03,0x02,0x0c,0x00,0xf2,0x03,0x0f,0xff,0x50,0x00,0x39,0x98,0x0b,0xff,0xd1,
+0x00,0xbf,0xfb,0x03,0xff,0xff,0xce,0xff,0xf4,0x3c,0x00,0x03,0x48,0x00,0x01,0x2e,
+0x00,0x11,0x30,0x9f,0x03,0x1f,0xf3,0x0d,0x00,0x02,0x70,0x6d,0xfe,0x94,0xff,0xf3,
+0x00,0xaf,0x42,0x07,0x20,0x30,0x5f,0xbe,0x00,0xa0,0xf3,0x0c,0xff,0xe2,0x00,0xaf,
+0xff,0x30,0xff,0xf8,0x27,0x00,0x00,0x1c,0x01,0x52,0x3f,0xff,0x33,0xff,0xf2,0x0d,
+0x00,0x10,0x30,0x34,0x00,0x40,0xff,0xf6,0x00,0x03,0x27,0x00,0x30,0xc0,0x00,0x7f,
+0x34,0x00,0x24,0xd9,0xbf,0x41,0x00,0x00,0x4e,0x00,0xc0,0xa2,0xef,0xf3,0x00,0x01,
+0x8d,0xff,0xc6,0x00,0x00,0x04,0xef,0xf5,0x07,0xf1,0x05,0x01,0xef,0xff,0xcd,0xff,
+0xf8,0x00,0x8f,0xfe,0x20,0x07,0xff,0xf0,0x0e,0xff,0x70,0x00,0x0f,0xff,0x30,0xb9,
+0x01,0x12,0xf5,0xf7,0x02,0xa2,0x51,0xff,0xf9,0x55,0x55,0x55,0x51,0x0e,0xff,0xa0,
+0xbd,0x03,0xa2,0x60,0x00,0x6e,0x20,0x02,0xef,0xff,0xec,0xef,0xfd,0xcf,0x07,0x80,
+0x50,0x00,0x01,0x8c,0xff,0xd9,0x20,0x00,0x55,0x00,0x31,0x70,0x01,0xdf,0xb1,0x07,
+0x30,0xec,0x70,0x0b,0xa6,0x02,0x20,0xcf,0xfa,0x75,0x09,0xc0,0xff,0xf2,0xaf,0xff,
+0xff,0xff,0x25,0x8e,0xff,0xd8,0x81,0x00,0xfb,0x02,0x10,0x0c,0x4a,0x00,0x0f,0x09,
+0x00,0x11,0xf0,0x0a,0x05,0xcf,0xfb,0x3b,0xff,0x60,0x08,0xff,0xff,0xff,0xef,0xf6,
+0x04,0xff,0xff,0xdd,0xff,0xff,0x60,0xbf,0xff,0x30,0x05,0xff,0xf6,0x78,0x08,0x30,
+0x0f,0xff,0x62,0x20,0x03,0x20,0xff,0xf6,0xf4,0x00,0x00,0x0d,0x00,0x10,0xf4,0x0d,
+0x00,0x00,0x6f,0x07,0x14,0x0f,0x27,0x00,0x03,0x34,0x00,0x11,0x08,0x57,0x07,0x00,
+0x4e,0x00,0x31,0x3f,0xff,0x60,0x5c,0x01,0xf2,0x01,0xf4,0x00,0x6b,0x10,0x00,0xbf,
+0xff,0x10,0x2f,0xff,0xbb,0xef,0xff,0x80,0x01,0xcf,0x05,0x09,0x61,0x6b,0xef,0xea,
+0x40,0x00,0xcf,0x3a,0x06,0x0f,0x06,0x00,0x07,0x51,0x3b,0xff,0xc4,0x00,0xcf,0x0e,
+0x02,0xe0,0xcf,0xff,0xfc,0xef,0xff,0xc0,0xcf,0xfd,0x10,0x09,0xff,0xf0,0xcf,0xf9,
+0xbf,0x03,0x4f,0xcf,0xf9,0x00,0x03,0x06,0x00,0x19,0xa0,0x3d,0xf7,0x0a,0xff,0xf0,
+0x8f,0xfd,0x00,0x67,0x10,0xad,0x04,0x3f,0xe0,0x8f,0xfe,0x05,0x00,0x09,0x50,0x00,
+0x03,0xee,0x60,0x00,0x1c,0x07,0x00,0x86,0x06,0x01,0x33,0x00,0x11,0x00,0x36,0x00,
+0x0f,0x04,0x00,0x22,0xe3,0x0c,0xff,0xc0,0x1d,0xef,0xff,0x80,0x1f,0xff,0xfe,0x10,
+0x1d,0xfe,0xa2,0x27,0x03,0x02,0x6a,0x04,0x0f,0x0d,0x00,0x05,0xf0,0x03,0xcf,0xff,
+0x40,0xbf,0xfb,0x00,0xaf,0xff,0x60,0x0b,0xff,0xb0,0x7f,0xff,0x80,0x00,0xbf,0xfb,
+0x86,0x06,0x60,0x0b,0xff,0xdf,0xff,0xc0,0x00,0xd9,0x07,0x12,0xf4,0xd4,0x03,0x02,
+0x0d,0x00,0xc0,0xff,0x70,0x00,0x0b,0xff,0xf4,0xaf,0xff,0x20,0x00,0xbf,0xfb,0x66,
+0x05,0x60,0x0b,0xff,0xb0,0x06,0xff,0xf6,0x4e,0x00,0x30,0x0c,0xff,0xf1,0x4e,0x00,
+0x5f,0x2f,0xff,0xb0,0x8f,0xfe,0x02,0x00,0x0f,0xf0,0x05,0xbf,0xf8,0x3a,0xef,0xc5,
+0x01,0x9e,0xfd,0x80,0x0b,0xff,0xcf,0xff,0xff,0xf6,0xef,0xff,0xff,0xa0,0xbf,0x77,
+0x01,0x51,0xff,0xed,0xff,0xff,0x2b,0x06,0x03,0x21,0x80,0x04,0xc8,0x03,0x91,0x05,
+0xff,0xf1,0x00,0x0f,0xff,0x7b,0xff,0xb0,0x2a,0x05,0x23,0xef,0xf7,0x13,0x00,0x1f,
+0x0e,0x13,0x00,0x27,0x90,0x70,0xcf,0xf7,0x3b,0xef,0xd5,0x00,0xcf,0xfc,0xe3,0x02,
+0x01,0xec,0x01,0x91,0xd0,0xcf,0xfe,0x20,0x09,0xff,0xf1,0xcf,0xfa,0xc2,0x01,0x0f,
+0x06,0x00,0x1c,0x30,0x00,0x02,0x9d,0x73,0x03,0x10,0x05,0xb1,0x0b,0xf0,0x08,0x00,
+0x02,0xff,0xff,0xde,0xff,0xfb,0x00,0xaf,0xfe,0x20,0x08,0xff,0xf3,0x0f,0xff,0x70,
+0x00,0x0e,0xff,0x82,0xff,0xf3,0x6e,0x01,0x00,0x39,0x04,0x50,0x09,0xff,0xc2,0xff,
+0xf4,0x8e,0x04,0x02,0x1a,0x00,0x12,0x80,0x27,0x00,0x03,0x34,0x00,0x11,0x05,0xf2,
+0x0b,0x03,0x4e,0x00,0x30,0xbf,0xf7,0x6d,0xbe,0x01,0x12,0xff,0xd9,0x04,0xac,0xd9,
+0xaf,0xff,0xd0,0xbf,0xfd,0x00,0x06,0xff,0xf4,0xd9,0x04,0x11,0xbf,0xd9,0x04,0x11,
+0xcf,0x0c,0x00,0x30,0xff,0xf8,0xbf,0x50,0x00,0x21,0xf4,0xbf,0xd3,0x00,0x03,0x3c,
+0x00,0x02,0x21,0x05,0x0f,0x45,0x05,0x0a,0xe0,0x00,0x07,0xdf,0xe9,0x1d,0xff,0x30,
+0x0a,0xff,0xff,0xfd,0xff,0xf3,0x05,0xc8,0x04,0x33,0xff,0x30,0xcf,0xc1,0x00,0x70,
+0x60,0x00,0x3f,0xff,0x32,0xff,0xf3,0x75,0x04,0x00,0xc1,0x00,0x05,0x0d,0x00,0x00,
+0xc1,0x00,0x11,0x3f,0x27,0x00,0x14,0x09,0x34,0x00,0x00,0x41,0x00,0x00,0xdf,0x0d,
+0x4e,0x06,0xdf,0xe9,0x4f,0xf7,0x04,0x0e,0x0d,0x00,0x00,0x4b,0x09,0xe2,0x6d,0xf7,
+0xbf,0xfe,0xff,0xf7,0xbf,0xff,0xff,0xf6,0xbf,0xff,0x82,0x11,0xd1,0x00,0x0f,0x04,
+0x00,0x0b,0x80,0x00,0x07,0xcf,0xfe,0xa2,0x00,0x01,0xdf,0xbc,0x01,0x70,0x09,0xff,
+0xe8,0x7d,0xff,0xf1,0x0e,0x43,0x0e,0xb2,0xf5,0x0d,0xff,0xb1,0x00,0x01,0x10,0x07,
+0xff,0xff,0xc8,0x7d,0x0d,0xa0,0xfd,0x20,0x00,0x01,0x6a,0xef,0xff,0xe1,0x14,0x43,
+0xf9,0x09,0x10,0x3f,0x02,0x02,0x90,0xf6,0x0d,0xff,0xe8,0x7b,0xff,0xf2,0x02,0xef,
+0xc6,0x02,0x00,0x48,0x00,0x55,0xa3,0x00,0x00,0xff,0xf5,0x04,0x00,0x40,0xef,0xff,
+0xff,0xf8,0x04,0x00,0x48,0x78,0xff,0xfa,0x84,0x18,0x00,0x0a,0x04,0x00,0x10,0xf7,
+0x57,0x09,0x9f,0xd8,0x00,0x7f,0xff,0xfa,0x00,0x07,0xdf,0xe8,0x18,0x04,0x1d,0x02,
+0x32,0x02,0xa0,0xaf,0xfe,0x10,0x09,0xff,0xf2,0x6f,0xff,0xec,0xef,0x81,0x0d,0xa0,
+0xff,0xff,0xff,0xf2,0x01,0xae,0xfe,0x92,0xff,0xf2,0xf0,0x98,0xaf,0xfd,0x00,0x00,
+0xbf,0xfc,0x5f,0xff,0x10,0x00,0xff,0xf7,0x0f,0xff,0x50,0x04,0xff,0xf1,0x0b,0xff,
+0xa0,0x08,0xff,0xc0,0x05,0xff,0xe0,0x0d,0xff,0x70,0x00,0xff,0xf3,0x1f,0xff,0x20,
+0x00,0xbf,0xf7,0x6f,0xfc,0x00,0x00,0x6f,0xfb,0xaf,0xf7,0x00,0x00,0x1f,0xff,0xef,
+0xf2,0x00,0x00,0x0b,0xff,0xff,0xd0,0x00,0x00,0x06,0xff,0xff,0x70,0x00,0x00,0x01,
+0xff,0xff,0x20,0x00,0x00,0x00,0xbf,0xfd,0x00,0x00,0x8f,0xfb,0x00,0x09,0xff,0x20,
+0x01,0xff,0xf2,0x4f,0xfe,0x00,0x0d,0xff,0x70,0x04,0xff,0xe0,0x0f,0xff,0x10,0x2f,
+0xff,0xb0,0x08,0xff,0xa0,0x0c,0xff,0x40,0x6f,0xff,0xf0,0x0b,0xff,0x60,0x08,0xff,
 0x70,0xbf,0xff,0xf4,0x0e,0xff,0x20,0x04,0xff,0xb0,0xff,0xaf,0xf9,0x2f,0xfe,0x00,
-0x01,0xff,0xe4,0xff,0x4b,0xfd,0x5f,0xfa,0x55,0x02,0xb1,0xff,0x06,0xff,0xbf,0xf6,
-0x00,0x00,0x8f,0xff,0xfb,0x02,0x4a,0x0a,0x70,0x4f,0xff,0xf6,0x00,0xdf,0xff,0xe0,
-0x78,0x00,0x11,0xf2,0x48,0x11,0x01,0x0a,0x0e,0x01,0x4c,0x0f,0x11,0x09,0x9e,0x05,
-0x80,0x20,0x00,0x5f,0xff,0x50,0x01,0xff,0xf9,0x80,0x00,0x60,0x9f,0xff,0x10,0x03,
-0xff,0xf6,0x2e,0x0a,0x32,0x09,0xff,0xeb,0x35,0x00,0x21,0xff,0xf5,0x8d,0x09,0x11,
-0xfc,0x02,0x09,0x02,0xd5,0x08,0x22,0xff,0xfe,0xc6,0x0b,0x10,0xf7,0x19,0x06,0x30,
-0xd8,0xff,0xf1,0x5b,0x0c,0x00,0x29,0x09,0x20,0xdf,0xfb,0x18,0x0a,0x00,0x6c,0x0c,
-0x21,0xdf,0xfb,0x24,0x16,0x50,0xcf,0xfd,0x07,0xff,0xf2,0x4c,0x08,0x40,0x1f,0xff,
-0x60,0x05,0x59,0x08,0x40,0xfb,0x00,0xaf,0xfc,0x91,0x19,0x00,0x8a,0x02,0x50,0x1f,
-0xff,0x54,0xff,0xf2,0x76,0x1c,0x20,0x8f,0xfc,0x89,0x03,0x10,0xed,0x5c,0x00,0x12,
-0x0f,0x1b,0x0b,0x11,0xaf,0xf6,0x09,0x12,0x05,0x6f,0x00,0x12,0x0f,0xec,0x19,0x11,
-0xaf,0xf7,0x02,0x02,0xca,0x1a,0x11,0x04,0xfc,0x18,0x32,0x7d,0xff,0xf9,0x3f,0x20,
-0x10,0x10,0xa3,0x09,0x01,0xf7,0x1f,0x11,0x0f,0xce,0x02,0x02,0x06,0x00,0x41,0x0b,
-0xcc,0xcc,0xdf,0x9c,0x09,0x13,0xbf,0xda,0x0c,0x01,0xb5,0x00,0x20,0xa0,0x00,0x44,
-0x10,0x05,0x7b,0x0a,0x01,0x7a,0x0a,0x01,0x65,0x0a,0x00,0x56,0x0c,0x41,0xcc,0xcc,
-0xc4,0x2f,0x9e,0x06,0x12,0x2f,0xa4,0x06,0xb1,0x00,0x03,0x90,0x00,0x00,0x8f,0xf4,
-0x00,0x07,0xff,0xd2,0x29,0x01,0x66,0x3f,0xfd,0x00,0x00,0x5f,0xfb,0x04,0x00,0x10,
-0x6f,0x07,0x0d,0xb0,0xf7,0x00,0x3a,0xff,0xe1,0x00,0x7f,0xfe,0x20,0x00,0x7f,0x46,
-0x08,0xa6,0xef,0xf4,0x00,0x00,0x7f,0xf9,0x00,0x00,0x5f,0xfa,0x28,0x00,0x20,0x4f,
-0xfb,0xef,0x1b,0x00,0x63,0x00,0x12,0x60,0x34,0x0d,0x10,0x2c,0x5c,0x0a,0x4f,0x20,
-0xff,0x1f,0xf1,0x03,0x00,0x08,0xb0,0x55,0x00,0x09,0x20,0x00,0x00,0x5f,0xf7,0x00,
-0x00,0x2d,0x37,0x00,0x00,0x8e,0x01,0x00,0x39,0x02,0x26,0xcf,0xf4,0x04,0x00,0x60,
-0xbf,0xf5,0x00,0x00,0x8f,0xf9,0xda,0x08,0xfa,0x01,0xa2,0x00,0x03,0xef,0xf5,0x00,
-0x09,0xff,0xf5,0x00,0x5f,0xfd,0x30,0x00,0xaf,0xf6,0x28,0x00,0x21,0xdf,0xf3,0x66,
-0x1f,0x10,0x07,0x2c,0x20,0x52,0xfe,0x20,0x00,0x3f,0xb1,0x19,0x19,0x80,0x01,0xae,
-0xfc,0x40,0x00,0x2a,0xa2,0x0d,0xda,0x09,0xf2,0x07,0x9f,0xf3,0x6f,0xff,0xdf,0xff,
-0xfd,0xff,0xe0,0xaf,0xf2,0x03,0xdf,0xff,0xff,0x50,0x79,0x70,0x00,0x08,0xef,0xd5,
-0x02,0x10,0x15,0x8a,0x25,0x18,0x25,0x0f,0xfb,0x0b,0x00,0x25,0xff,0xfb,0x15,0x00,
-0x10,0xfe,0x0b,0x00,0x60,0x14,0x44,0x44,0x44,0x44,0xff,0x0f,0x20,0x12,0x0e,0xc3,
-0x17,0x10,0x2e,0xde,0x04,0x50,0xbb,0xbb,0xbb,0xbb,0xb7,0x25,0x20,0x11,0x0f,0x85,
-0x1b,0x01,0x30,0x20,0x04,0xf5,0x10,0x24,0x2e,0xfa,0x15,0x00,0x34,0x00,0xbf,0xe0,
-0x15,0x00,0x40,0xaf,0xf3,0x0f,0xf4,0x4a,0x00,0x10,0x10,0xa0,0x20,0x11,0xff,0x41,
-0x10,0x00,0x0a,0x00,0x10,0x07,0x49,0x00,0x44,0xbf,0xf0,0x9f,0xf3,0x7e,0x00,0x05,
-0x0a,0x00,0x35,0x0f,0xff,0xf4,0x93,0x00,0x05,0x0a,0x00,0x25,0x0e,0xf4,0xa8,0x00,
-0x15,0x11,0x0a,0x00,0x14,0xa8,0x09,0x00,0x00,0xc7,0x20,0x03,0xc9,0x18,0x04,0x0a,
-0x00,0x34,0x0b,0xfe,0xff,0x8b,0x00,0x20,0xe2,0xff,0x80,0x00,0x53,0x41,0x00,0x0b,
-0xfe,0x20,0x80,0x00,0x40,0xbf,0xe2,0x00,0x7b,0x80,0x00,0x43,0xff,0x0b,0xfe,0x20,
-0x6a,0x00,0x24,0xaf,0xe2,0x74,0x00,0x24,0xef,0xb0,0x0a,0x00,0x24,0x3f,0xfa,0x0a,
-0x00,0x51,0x03,0xff,0xa0,0x00,0x24,0x10,0x01,0x51,0x00,0x3f,0xfa,0x00,0xef,0x47,
-0x00,0x43,0x00,0x03,0xff,0xa0,0x0f,0x01,0x34,0x00,0x3f,0xf9,0x6e,0x00,0x25,0x03,
-0xff,0x8c,0x00,0x15,0x4f,0x0a,0x00,0x01,0x6e,0x23,0x0c,0xbe,0x00,0x25,0x4e,0x90,
-0x28,0x00,0x13,0x90,0x09,0x00,0x13,0xfa,0x0a,0x00,0x32,0x4f,0xf9,0x04,0x0a,0x00,
-0x10,0x4f,0xf8,0x08,0x12,0x90,0x09,0x00,0x02,0x0a,0x00,0x00,0x09,0x00,0x01,0x0a,
-0x00,0x01,0x09,0x00,0x00,0x0a,0x00,0x10,0x1f,0x19,0x23,0x00,0xa5,0x06,0x10,0x61,
-0x27,0x19,0x21,0x00,0x0e,0xe1,0x03,0x61,0x0b,0xf4,0x00,0x00,0xef,0x10,0xff,0x00,
-0x31,0x40,0x00,0x0e,0x70,0x03,0x0f,0x13,0x00,0x27,0x00,0xee,0x00,0x14,0x10,0x0a,
-0x18,0x12,0xd0,0x4c,0x12,0x01,0x6a,0x24,0x01,0x8c,0x03,0x02,0xe2,0x03,0x0f,0x72,
-0x00,0x38,0x10,0x1e,0xed,0x08,0x00,0x65,0x01,0x10,0x51,0xdf,0x1b,0x00,0x7f,0x00,
+0x01,0xff,0xe4,0xff,0x4b,0xfd,0x5f,0xfa,0x00,0x00,0xcf,0xfa,0xff,0x06,0xff,0xbf,
+0xf6,0x00,0x00,0x8f,0xff,0xfb,0x02,0xff,0xff,0xf2,0x00,0x00,0x4f,0xff,0xf6,0x00,
+0xdf,0xff,0xe0,0x78,0x00,0xf0,0x0f,0xf2,0x00,0x8f,0xff,0xa0,0x00,0x00,0x0d,0xff,
+0xd0,0x00,0x4f,0xff,0x60,0x00,0x00,0x09,0xff,0x80,0x00,0x0f,0xff,0x20,0x00,0x5f,
+0xff,0x50,0x01,0xff,0xf9,0x80,0x00,0xd2,0x9f,0xff,0x10,0x03,0xff,0xf6,0x2f,0xff,
+0x70,0x00,0x09,0xff,0xeb,0x35,0x00,0xd0,0xff,0xf5,0x00,0x00,0x00,0x7f,0xff,0xfc,
+0x00,0x00,0x00,0x02,0xff,0x36,0x00,0xf0,0x05,0x00,0xaf,0xff,0xfe,0x00,0x00,0x00,
+0x3f,0xff,0xff,0xf7,0x00,0x00,0x0c,0xff,0xd8,0xff,0xf1,0x00,0x05,0x8f,0x00,0xb0,
+0x90,0x00,0xdf,0xfb,0x00,0x6f,0xff,0x30,0x7f,0xff,0x20,0x0a,0x00,0xf0,0x15,0xcf,
+0xfd,0x00,0x00,0xcf,0xfd,0x07,0xff,0xf2,0x00,0x1f,0xff,0x70,0x1f,0xff,0x60,0x05,
+0xff,0xf2,0x00,0xcf,0xfb,0x00,0xaf,0xfc,0x00,0x06,0xff,0xf0,0x0f,0xff,0x70,0x00,
+0x1f,0xff,0x54,0xa0,0x00,0x90,0xbf,0xf9,0x8f,0xfc,0x00,0x00,0x05,0xff,0xed,0x5c,
+0x00,0x41,0x0f,0xff,0xff,0xf1,0x62,0x00,0x20,0xfb,0x00,0x14,0x00,0x01,0x6f,0x00,
+0x11,0x0f,0x13,0x00,0x50,0x00,0xaf,0xfb,0x00,0x00,0x70,0x00,0xe0,0x50,0x00,0x00,
+0x00,0x04,0xff,0xf0,0x00,0x00,0x00,0x7d,0xff,0xf9,0x00,0xc5,0x00,0x91,0xfe,0x10,
+0x00,0x00,0x00,0x8f,0xea,0x20,0x00,0x40,0x00,0x32,0xff,0xff,0xf3,0x06,0x00,0x60,
+0x0b,0xcc,0xcc,0xdf,0xff,0xd0,0x58,0x01,0x00,0x5e,0x01,0x30,0x07,0xff,0xf6,0xb5,
+0x00,0x00,0x00,0x01,0xd0,0x00,0xdf,0xfd,0x00,0x00,0x00,0x0a,0xff,0xf3,0x00,0x00,
+0x00,0x5f,0x80,0x01,0x31,0x02,0xff,0xfb,0x5b,0x00,0x50,0xfd,0xcc,0xcc,0xc4,0x2f,
+0x3c,0x00,0x12,0xf6,0x06,0x00,0xc1,0x00,0x00,0x03,0x90,0x00,0x00,0x8f,0xf4,0x00,
+0x07,0xff,0xd2,0x29,0x01,0x66,0x3f,0xfd,0x00,0x00,0x5f,0xfb,0x04,0x00,0xf6,0x0f,
+0x6f,0xfa,0x00,0x00,0xaf,0xf7,0x00,0x3a,0xff,0xe1,0x00,0x7f,0xfe,0x20,0x00,0x7f,
+0xff,0x80,0x00,0x03,0xef,0xf4,0x00,0x00,0x7f,0xf9,0x00,0x00,0x5f,0xfa,0x28,0x00,
+0x60,0x4f,0xfb,0x00,0x00,0x2f,0xfe,0x63,0x00,0x30,0x60,0x00,0x03,0x51,0x01,0x9f,
+0x2c,0xf2,0x00,0x00,0x00,0x20,0xff,0x1f,0xf1,0x03,0x00,0x08,0xb0,0x55,0x00,0x09,
+0x20,0x00,0x00,0x5f,0xf7,0x00,0x00,0x2d,0x37,0x00,0x00,0x8e,0x01,0x00,0x39,0x02,
+0x26,0xcf,0xf4,0x04,0x00,0xfa,0x0b,0xbf,0xf5,0x00,0x00,0x8f,0xf9,0x00,0x00,0x2f,
+0xff,0xa2,0x00,0x03,0xef,0xf5,0x00,0x09,0xff,0xf5,0x00,0x5f,0xfd,0x30,0x00,0xaf,
+0xf6,0x28,0x00,0xf1,0x2b,0xdf,0xf3,0x00,0x00,0xff,0xf0,0x00,0x07,0xff,0xa0,0x00,
+0x6f,0xfe,0x20,0x00,0x3f,0xb1,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0xae,0xfc,0x40,
+0x00,0x2a,0xa2,0x0d,0xff,0xff,0xf9,0x00,0x9f,0xf3,0x6f,0xff,0xdf,0xff,0xfd,0xff,
+0xe0,0xaf,0xf2,0x03,0xdf,0xff,0xff,0x50,0x79,0x70,0x00,0x08,0xef,0xd5,0x00,0x01,
+0x00,0x24,0x8a,0x00,0x01,0x00,0x25,0x0f,0xfb,0x0b,0x00,0x25,0xff,0xfb,0x15,0x00,
+0x10,0xfe,0x0b,0x00,0xc0,0x14,0x44,0x44,0x44,0x44,0xff,0x2e,0xfb,0x00,0x00,0x0e,
+0xff,0x01,0x00,0x10,0xf0,0x0b,0x00,0xc1,0xff,0xbb,0xbb,0xbb,0xbb,0xb7,0x00,0x2e,
+0xfb,0x00,0x0f,0xf0,0x2d,0x00,0x00,0x0b,0x00,0x23,0xff,0x00,0x0b,0x00,0x14,0xfa,
+0x15,0x00,0x34,0x00,0xbf,0xe0,0x15,0x00,0x40,0xaf,0xf3,0x0f,0xf4,0x4a,0x00,0x51,
+0x10,0x00,0xaf,0xf3,0x00,0x49,0x00,0x10,0xfe,0x0a,0x00,0x10,0x07,0x49,0x00,0x44,
+0xbf,0xf0,0x9f,0xf3,0x7e,0x00,0x05,0x0a,0x00,0x35,0x0f,0xff,0xf4,0x93,0x00,0x05,
+0x0a,0x00,0x25,0x0e,0xf4,0xa8,0x00,0x15,0x11,0x0a,0x00,0x14,0xa8,0x09,0x00,0x24,
+0x0c,0xff,0x0a,0x00,0x14,0xcf,0x0a,0x00,0x34,0x0b,0xfe,0xff,0x8b,0x00,0x20,0xe2,
+0xff,0x80,0x00,0x53,0x41,0x00,0x0b,0xfe,0x20,0x80,0x00,0x40,0xbf,0xe2,0x00,0x7b,
+0x80,0x00,0x43,0xff,0x0b,0xfe,0x20,0x6a,0x00,0x24,0xaf,0xe2,0x74,0x00,0x24,0xef,
+0xb0,0x0a,0x00,0x24,0x3f,0xfa,0x0a,0x00,0x51,0x03,0xff,0xa0,0x00,0x24,0x10,0x01,
+0x51,0x00,0x3f,0xfa,0x00,0xef,0x47,0x00,0x43,0x00,0x03,0xff,0xa0,0x0f,0x01,0x34,
+0x00,0x3f,0xf9,0x6e,0x00,0x25,0x03,0xff,0x8c,0x00,0x15,0x4f,0x0a,0x00,0x3e,0x04,
+0xfe,0x00,0xbe,0x00,0x25,0x4e,0x90,0x28,0x00,0x13,0x90,0x09,0x00,0x13,0xfa,0x0a,
+0x00,0x52,0x4f,0xf9,0x04,0xff,0x90,0x09,0x00,0x11,0x00,0x0a,0x00,0x00,0x09,0x00,
+0x02,0x0a,0x00,0x00,0x09,0x00,0x01,0x0a,0x00,0x01,0x09,0x00,0x00,0x0a,0x00,0x40,
+0x1f,0xff,0xff,0xe1,0x14,0x03,0x81,0xff,0x61,0xef,0xff,0xff,0x40,0x00,0x0e,0xe1,
+0x03,0x61,0x0b,0xf4,0x00,0x00,0xef,0x10,0xff,0x00,0x31,0x40,0x00,0x0e,0x70,0x03,
+0x0f,0x13,0x00,0x27,0x00,0xee,0x00,0x21,0x10,0x00,0x36,0x04,0x01,0xe5,0x04,0x00,
+0x7d,0x03,0x32,0xff,0xff,0xfd,0x5e,0x01,0x12,0xff,0xe2,0x03,0x0f,0x72,0x00,0x38,
+0x50,0x1e,0xff,0xff,0xf4,0x00,0x65,0x01,0x50,0x51,0xff,0xff,0xfe,0x10,0x7f,0x00,
 0x1f,0xf6,0x0f,0x01,0x18,0x01,0x09,0x00,0x00,0x0a,0x00,0x33,0xaf,0xf9,0x00,0x0a,
-0x00,0x14,0xf9,0x87,0x01,0x1e,0xe9,0x16,0x1d,0x15,0x02,0x2a,0x1d,0x25,0x0a,0xa0,
-0x3a,0x1b,0x04,0x8b,0x02,0x04,0x9b,0x07,0x01,0xd7,0x01,0x14,0x30,0x6c,0x02,0x02,
-0x01,0x1b,0x00,0x7c,0x00,0x23,0x9f,0xf4,0x59,0x24,0x21,0xf1,0x1f,0x0e,0x01,0x00,
-0x3a,0x22,0x11,0x08,0xd1,0x04,0x01,0xf1,0x22,0x21,0xef,0xd0,0x5a,0x0f,0x12,0xf6,
-0x04,0x00,0x02,0x10,0x00,0x21,0x0e,0xfe,0x3f,0x01,0x11,0x50,0x2c,0x00,0x41,0x00,
-0x00,0x0e,0xfd,0x40,0x00,0x11,0xe0,0x96,0x04,0x11,0x00,0x24,0x23,0x32,0x01,0xff,
-0xc0,0x68,0x00,0x40,0x10,0x09,0xff,0xdc,0x3c,0x1d,0x11,0xcd,0xe4,0x01,0x12,0xff,
-0x28,0x20,0x14,0xaf,0x0a,0x00,0x13,0xfa,0x09,0x1d,0x24,0xcc,0x70,0xe7,0x00,0x23,
-0xff,0xfc,0x2c,0x03,0x30,0xfb,0x46,0xef,0x88,0x11,0xf0,0x16,0x38,0xb5,0x6f,0xe0,
-0x00,0x5f,0xe0,0x00,0x00,0x2b,0xff,0xfa,0x9f,0xb0,0x00,0x3f,0xf0,0x00,0x03,0xef,
-0xfb,0x60,0xcf,0xe1,0x00,0x7f,0xd0,0x00,0x2f,0xfc,0x20,0x00,0xef,0xfe,0x89,0xff,
-0x50,0x9a,0x22,0x11,0x01,0x37,0x12,0x31,0x05,0xff,0x20,0xf5,0x1a,0x41,0x54,0x00,
-0x0b,0xfa,0xe2,0x01,0x50,0xc2,0x5f,0xa0,0x0e,0xf4,0x58,0x05,0x00,0x79,0x1c,0x20,
-0x0f,0xf2,0xd4,0x00,0xe0,0x40,0x00,0x1f,0xf0,0x0f,0xf1,0x00,0x00,0x0f,0xc1,0x00,
-0x00,0x1f,0xf0,0x1e,0x00,0x10,0x28,0xb5,0x00,0x23,0xe0,0x09,0x63,0x01,0x52,0x9f,
-0x90,0x04,0xff,0x20,0xfb,0x11,0x10,0x40,0xf4,0x22,0x00,0x09,0x01,0x50,0xfc,0x00,
-0x00,0x2e,0xfd,0x04,0x16,0x30,0xdf,0xe2,0x00,0x82,0x00,0x31,0x75,0x57,0xbf,0x18,
-0x25,0x10,0x1a,0xc6,0x00,0x11,0xa1,0x37,0x00,0x42,0x27,0xbd,0xcb,0x72,0x41,0x00,
-0x62,0x59,0x99,0x99,0x99,0x81,0x00,0x4c,0x1d,0x00,0x36,0x0c,0x01,0xdc,0x23,0x50,
-0xb5,0x04,0xff,0xff,0xfe,0xf3,0x23,0x20,0x00,0x0a,0xd7,0x1b,0x20,0xf4,0x0d,0x8c,
-0x01,0xf0,0x07,0x21,0xdf,0x60,0x0a,0xff,0x90,0x07,0xf5,0x56,0x00,0x01,0xfd,0x85,
-0x00,0x00,0xdd,0x00,0x00,0x3d,0xff,0x10,0x06,0x9f,0x02,0x10,0x23,0x44,0x23,0x42,
-0x10,0x00,0x4b,0x50,0xba,0x01,0x43,0x75,0x50,0x0d,0xed,0x02,0x1f,0x00,0xa8,0x06,
-0x04,0xd3,0x03,0x33,0xd0,0x06,0x78,0x0b,0x00,0x53,0x84,0x00,0x05,0xcf,0x40,0xe6,
-0x01,0x21,0xd0,0x09,0xc3,0x12,0x00,0xbc,0x0d,0x41,0xa0,0x03,0xa6,0x92,0x0b,0x00,
-0x53,0x2d,0x42,0x10,0x00,0x1b,0xee,0x02,0x50,0xf7,0x00,0x00,0x2f,0xfb,0x9c,0x23,
-0xe1,0x3c,0x5d,0xf3,0x00,0x00,0x06,0x73,0xff,0x66,0x32,0x65,0xef,0xc0,0x30,0x71,
-0x04,0x42,0x7f,0xf8,0xfd,0x6f,0x2f,0x26,0x53,0xc5,0x9f,0xc5,0xff,0x18,0x59,0x02,
-0x32,0x5b,0x81,0xb8,0x09,0x00,0x25,0x2a,0x20,0x74,0x02,0x61,0xef,0xe4,0x6b,0xde,
-0xda,0x50,0x3c,0x1e,0x02,0x92,0x04,0x00,0x34,0x08,0xf1,0x09,0xdf,0xd1,0xbf,0xfa,
-0x33,0x47,0xcf,0xfb,0x10,0x00,0x0c,0xfd,0x10,0x0b,0xff,0x50,0x00,0x05,0xff,0xc0,
-0x00,0x0e,0xfc,0x10,0xfd,0x05,0xb0,0x2e,0xf9,0x00,0x02,0xef,0xd1,0x00,0x09,0xff,
-0x40,0x00,0x62,0x01,0x40,0xaf,0xfd,0x10,0x05,0x44,0x02,0x80,0xaf,0x90,0x00,0xff,
-0xef,0xd2,0x4f,0xfa,0xb5,0x02,0x40,0xe0,0x03,0xfe,0x1d,0x6b,0x18,0x00,0x1d,0x28,
-0x51,0x04,0xfc,0x01,0xdf,0xfb,0x0c,0x02,0x62,0xf3,0x04,0xfd,0x00,0x1b,0xb0,0x0b,
-0x00,0x24,0x02,0xfe,0x63,0x05,0x43,0xf1,0x00,0xef,0x20,0xec,0x02,0x32,0xd0,0x00,
-0x9f,0x7f,0x04,0x00,0x4d,0x00,0x22,0x2f,0xf2,0x4c,0x02,0x00,0x26,0x0b,0x21,0xfd,
-0x10,0xd4,0x05,0x10,0xf8,0xa0,0x02,0x11,0xe4,0xdc,0x02,0x11,0xc0,0xc6,0x26,0x42,
-0xc7,0x54,0x58,0xdf,0x17,0x03,0x10,0x7e,0xbb,0x00,0x13,0x60,0xb9,0x01,0x32,0xcd,
-0xc9,0x50,0x21,0x23,0x62,0x99,0x98,0x88,0x88,0x88,0x85,0x47,0x1d,0x00,0x74,0x07,
-0x00,0x1a,0x0f,0x80,0xee,0xee,0xef,0xf0,0x00,0x00,0xef,0xf0,0xd8,0x07,0x12,0x90,
-0xc4,0x03,0x00,0xbc,0x27,0x10,0x09,0xc9,0x01,0x10,0x06,0x52,0x13,0x10,0xfc,0xf2,
-0x02,0x00,0x43,0x24,0x10,0xfa,0x46,0x02,0x01,0x7c,0x1b,0x51,0x00,0x00,0x2c,0xfc,
-0x20,0x2c,0x03,0x31,0x04,0xef,0x80,0xdb,0x05,0x31,0xb0,0x1f,0xe3,0x69,0x01,0x40,
-0x6f,0xc0,0x6f,0xf4,0x77,0x02,0x51,0xf2,0x3f,0x70,0xdf,0xfd,0xb9,0x00,0x30,0x7f,
-0x23,0xf5,0x78,0x02,0x50,0xcf,0x50,0xad,0x09,0xd0,0xfd,0x27,0xa1,0xbf,0x50,0xb6,
-0x03,0x00,0xdf,0x30,0x00,0x00,0x8f,0x39,0x17,0x00,0x2c,0x10,0x10,0xf6,0x41,0x21,
-0x01,0xd3,0x0d,0x41,0xa5,0x47,0xef,0xe1,0x77,0x26,0x01,0xa0,0x0a,0x00,0x90,0x01,
-0x23,0x8c,0xdb,0xc6,0x00,0x03,0x1e,0x09,0x00,0x01,0x13,0x14,0xf6,0x08,0x00,0x42,
-0x11,0x10,0xcf,0xff,0xaf,0x22,0xa2,0xfa,0x66,0x65,0x55,0x55,0x44,0x44,0x9e,0xf7,
-0x00,0xff,0x00,0x06,0x08,0x00,0x01,0xe9,0x0f,0x02,0x08,0x00,0x90,0xfc,0x00,0x7e,
-0xe7,0x00,0x22,0x22,0x22,0x21,0x08,0x00,0x02,0x20,0x00,0x06,0x10,0x00,0x02,0x20,
-0x00,0x12,0xe8,0x30,0x00,0x22,0x7f,0xe8,0x20,0x00,0x05,0x08,0x00,0xa0,0xeb,0x66,
-0x66,0x77,0x77,0x77,0x77,0xbf,0xbf,0xff,0x97,0x23,0x2a,0xdd,0xda,0x88,0x00,0x01,
-0x44,0x28,0x35,0xbb,0xbb,0xb4,0xd0,0x21,0x04,0xdf,0x1f,0x60,0x5a,0xef,0xff,0xe9,
-0x20,0x03,0x94,0x02,0x01,0xa7,0x07,0x20,0x0f,0x90,0x69,0x09,0xa0,0xeb,0xab,0xef,
-0xc0,0x0f,0xfe,0x40,0x4f,0xff,0xc4,0x1b,0x08,0x52,0x0f,0x7a,0xfa,0xef,0xf9,0xfb,
-0x01,0x43,0x50,0x4e,0xff,0xb0,0x0a,0x00,0x34,0x00,0x8f,0xc3,0x0a,0x00,0x33,0x03,
-0xcf,0x80,0x0a,0x00,0x43,0x00,0x06,0xfd,0x40,0x0a,0x00,0x33,0x02,0xdf,0x50,0x0a,
-0x00,0x23,0x5f,0xc2,0x1e,0x00,0x23,0x09,0xf8,0x32,0x00,0x33,0x02,0xcf,0x40,0x0a,
-0x00,0x23,0x5f,0xff,0x0a,0x00,0x22,0x69,0xfc,0xa2,0x29,0x01,0x21,0x10,0x21,0xfe,
-0x30,0x0a,0x00,0xe2,0xd2,0x00,0x1d,0xff,0xfa,0x52,0x12,0x69,0x40,0x0a,0x00,0x00,
-0x01,0xbf,0x0a,0x20,0x11,0x00,0x16,0x2a,0x13,0xff,0xec,0x06,0x41,0x04,0x8a,0xa9,
-0x62,0x12,0x18,0x01,0xe4,0x09,0xa1,0x5f,0x55,0xff,0xfb,0x55,0x55,0x55,0x55,0xf5,
-0x5f,0xbc,0x24,0xd0,0x01,0x12,0xe5,0x5f,0x00,0xcf,0xf7,0x00,0x04,0xdf,0xff,0xf5,
-0x5f,0xaa,0x01,0x20,0xbf,0xff,0x09,0x00,0x31,0x47,0x73,0x2d,0xd6,0x27,0x00,0xa0,
-0x13,0x11,0x6e,0x09,0x00,0x83,0xef,0xfb,0x00,0x00,0x7c,0xcb,0xf5,0x5f,0x48,0x10,
+0x00,0x14,0xf9,0x87,0x01,0x2d,0xe9,0x00,0x01,0x00,0x24,0x02,0x20,0x0a,0x00,0x24,
+0x0a,0xa0,0x0a,0x00,0x34,0x3f,0xf3,0x00,0x3c,0x02,0x16,0xfb,0xd7,0x01,0x14,0x30,
+0x6c,0x02,0x33,0xff,0xc0,0x00,0xa6,0x01,0x13,0x9f,0x96,0x02,0x32,0xdf,0xf1,0x1f,
+0x0e,0x01,0x41,0x05,0xff,0x70,0x08,0xd1,0x04,0x61,0x00,0x0d,0xfe,0x00,0x00,0xef,
+0x2c,0x01,0x22,0x6f,0xf6,0x04,0x00,0x02,0x10,0x00,0x21,0x0e,0xfe,0x3f,0x01,0x11,
+0x50,0x2c,0x00,0x41,0x00,0x00,0x0e,0xfd,0x40,0x00,0x11,0xe0,0x96,0x04,0x00,0x54,
+0x00,0x52,0xf8,0x00,0x01,0xff,0xc0,0x68,0x00,0x91,0x10,0x09,0xff,0xdc,0xcc,0xcc,
+0xcc,0xcc,0xcd,0xe4,0x01,0x02,0x01,0x00,0x24,0xf1,0xaf,0x0a,0x00,0x03,0x9c,0x02,
+0x34,0x29,0xcc,0x70,0xe7,0x00,0x23,0xff,0xfc,0x2c,0x03,0xf0,0x20,0xfb,0x46,0xef,
+0x80,0x00,0x00,0x00,0x38,0xb5,0x6f,0xe0,0x00,0x5f,0xe0,0x00,0x00,0x2b,0xff,0xfa,
+0x9f,0xb0,0x00,0x3f,0xf0,0x00,0x03,0xef,0xfb,0x60,0xcf,0xe1,0x00,0x7f,0xd0,0x00,
+0x2f,0xfc,0x20,0x00,0xef,0xfe,0x89,0xff,0x50,0x00,0xcf,0xc0,0xaf,0x06,0x60,0xff,
+0xf8,0x00,0x05,0xff,0x20,0x45,0x00,0x51,0xff,0x54,0x00,0x0b,0xfa,0xe2,0x01,0x50,
+0xc2,0x5f,0xa0,0x0e,0xf4,0x58,0x05,0x60,0xf8,0x00,0x4f,0xe0,0x0f,0xf2,0xd4,0x00,
+0xe0,0x40,0x00,0x1f,0xf0,0x0f,0xf1,0x00,0x00,0x0f,0xc1,0x00,0x00,0x1f,0xf0,0x1e,
+0x00,0x10,0x28,0xb5,0x00,0x23,0xe0,0x09,0x63,0x01,0x30,0x9f,0x90,0x04,0xfa,0x06,
+0x00,0x82,0x05,0x10,0x40,0x5a,0x00,0x00,0x09,0x01,0xc0,0xfc,0x00,0x00,0x2e,0xfd,
+0x30,0x00,0x00,0x03,0xdf,0xe2,0x00,0x82,0x00,0x40,0x75,0x57,0xbf,0xfe,0x4c,0x01,
+0x10,0x1a,0xc6,0x00,0x11,0xa1,0x37,0x00,0x42,0x27,0xbd,0xcb,0x72,0x41,0x00,0x51,
+0x59,0x99,0x99,0x99,0x81,0x0b,0x00,0x00,0x07,0x02,0x30,0xff,0xa0,0x10,0xd6,0x04,
+0x80,0xb5,0x04,0xff,0xff,0xfe,0x01,0xec,0x10,0x8c,0x00,0x50,0x50,0x7f,0xff,0xf4,
+0x0d,0x8c,0x01,0xf0,0x07,0x21,0xdf,0x60,0x0a,0xff,0x90,0x07,0xf5,0x56,0x00,0x01,
+0xfd,0x85,0x00,0x00,0xdd,0x00,0x00,0x3d,0xff,0x10,0x06,0x9f,0x02,0x92,0x23,0x00,
+0x00,0x0d,0xfb,0x10,0x00,0x4b,0x50,0xba,0x01,0x42,0x75,0x50,0x0d,0xed,0x52,0x00,
+0x10,0x01,0xa8,0x06,0x04,0xd3,0x03,0x33,0xd0,0x06,0x78,0x0b,0x00,0x53,0x84,0x00,
+0x05,0xcf,0x40,0xe6,0x01,0x10,0xd0,0x43,0x07,0x01,0x4f,0x01,0x51,0xef,0xa0,0x03,
+0xa6,0x92,0x0b,0x00,0x53,0x2d,0x42,0x10,0x00,0x1b,0xee,0x02,0xf1,0x08,0xf7,0x00,
+0x00,0x2f,0xfb,0x83,0x00,0x00,0x00,0x3c,0x5d,0xf3,0x00,0x00,0x06,0x73,0xff,0x66,
+0x32,0x65,0xef,0xc0,0x30,0x71,0x04,0x51,0x7f,0xf8,0xfd,0x6f,0xf2,0xfd,0x00,0x53,
+0xc5,0x9f,0xc5,0xff,0x18,0x59,0x02,0x32,0x5b,0x81,0xb8,0x09,0x00,0x25,0x2a,0x20,
+0x74,0x02,0x51,0xef,0xe4,0x6b,0xde,0xda,0x9f,0x00,0x12,0x1d,0x92,0x04,0x00,0x34,
+0x08,0xf1,0x09,0xdf,0xd1,0xbf,0xfa,0x33,0x47,0xcf,0xfb,0x10,0x00,0x0c,0xfd,0x10,
+0x0b,0xff,0x50,0x00,0x05,0xff,0xc0,0x00,0x0e,0xfc,0x10,0xfd,0x05,0xb0,0x2e,0xf9,
+0x00,0x02,0xef,0xd1,0x00,0x09,0xff,0x40,0x00,0x62,0x01,0x40,0xaf,0xfd,0x10,0x05,
+0x44,0x02,0x80,0xaf,0x90,0x00,0xff,0xef,0xd2,0x4f,0xfa,0xb5,0x02,0x70,0xe0,0x03,
+0xfe,0x1d,0xfe,0xff,0xb0,0x42,0x05,0x61,0xf1,0x04,0xfc,0x01,0xdf,0xfb,0x0c,0x02,
+0x62,0xf3,0x04,0xfd,0x00,0x1b,0xb0,0x0b,0x00,0x24,0x02,0xfe,0x63,0x05,0x43,0xf1,
+0x00,0xef,0x20,0xec,0x02,0x32,0xd0,0x00,0x9f,0x7f,0x04,0x00,0x4d,0x00,0x11,0x2f,
+0xc0,0x00,0x01,0x63,0x00,0x31,0x09,0xfd,0x10,0xd4,0x05,0x10,0xf8,0xa0,0x02,0x11,
+0xe4,0xdc,0x02,0x00,0xd0,0x01,0x62,0x1b,0xff,0xc7,0x54,0x58,0xdf,0x17,0x03,0x10,
+0x7e,0xbb,0x00,0x13,0x60,0xb9,0x01,0x22,0xcd,0xc9,0x70,0x01,0x70,0x09,0x99,0x98,
+0x88,0x88,0x88,0x85,0x8a,0x07,0x03,0x74,0x07,0xb0,0xaf,0xff,0xff,0xee,0xee,0xef,
+0xf0,0x00,0x00,0xef,0xf0,0xd8,0x07,0x13,0x90,0xc4,0x03,0x40,0xef,0x30,0x00,0x09,
+0xc9,0x01,0x60,0x06,0xfc,0x00,0x00,0x0e,0xfc,0xf2,0x02,0x50,0xf6,0x00,0x00,0x0f,
+0xfa,0x46,0x02,0x10,0xf0,0x80,0x02,0x51,0x00,0x00,0x2c,0xfc,0x20,0x2c,0x03,0x31,
+0x04,0xef,0x80,0xdb,0x05,0x31,0xb0,0x1f,0xe3,0x69,0x01,0x40,0x6f,0xc0,0x6f,0xf4,
+0x77,0x02,0x51,0xf2,0x3f,0x70,0xdf,0xfd,0xb9,0x00,0x30,0x7f,0x23,0xf5,0x78,0x02,
+0xf0,0x08,0xcf,0x50,0xad,0x09,0xd0,0xdf,0x40,0x00,0x00,0xbf,0x50,0xb6,0x03,0x00,
+0xdf,0x30,0x00,0x00,0x8f,0xa0,0x00,0x00,0x02,0xf4,0x01,0x50,0x2f,0xf6,0x00,0x00,
+0x1c,0xa6,0x02,0x80,0x08,0xff,0xa5,0x47,0xef,0xe1,0x00,0x00,0x52,0x09,0x22,0xff,
+0xfd,0xad,0x02,0x23,0x8c,0xdb,0xc6,0x00,0x03,0x1e,0x09,0x21,0x00,0x2f,0xb9,0x00,
+0x02,0x08,0x00,0x32,0x11,0x10,0xcf,0x72,0x03,0xb2,0xfc,0xfa,0x66,0x65,0x55,0x55,
+0x44,0x44,0x9e,0xf7,0x00,0xff,0x00,0x05,0x08,0x00,0x00,0xad,0x04,0x13,0xfb,0x08,
+0x00,0x90,0xfc,0x00,0x7e,0xe7,0x00,0x22,0x22,0x22,0x21,0x08,0x00,0x02,0x20,0x00,
+0x06,0x10,0x00,0x02,0x20,0x00,0x12,0xe8,0x30,0x00,0x22,0x7f,0xe8,0x20,0x00,0x05,
+0x08,0x00,0xfa,0x01,0xeb,0x66,0x66,0x77,0x77,0x77,0x77,0xbf,0xbf,0xff,0xef,0xff,
+0xff,0xfe,0xdd,0xda,0x88,0x00,0x10,0x00,0x7e,0x01,0x34,0xbb,0xbb,0xb4,0x46,0x02,
+0x23,0x01,0x10,0x09,0x00,0x60,0x5a,0xef,0xff,0xe9,0x20,0x03,0x94,0x02,0x01,0xa7,
+0x07,0x20,0x0f,0x90,0x69,0x09,0xa0,0xeb,0xab,0xef,0xc0,0x0f,0xfe,0x40,0x4f,0xff,
+0xc4,0x1b,0x08,0x52,0x0f,0x7a,0xfa,0xef,0xf9,0xfb,0x01,0x43,0x50,0x4e,0xff,0xb0,
+0x0a,0x00,0x34,0x00,0x8f,0xc3,0x0a,0x00,0x33,0x03,0xcf,0x80,0x0a,0x00,0x43,0x00,
+0x06,0xfd,0x40,0x0a,0x00,0x33,0x02,0xdf,0x50,0x0a,0x00,0x23,0x5f,0xc2,0x1e,0x00,
+0x23,0x09,0xf8,0x32,0x00,0x33,0x02,0xcf,0x40,0x0a,0x00,0x23,0x5f,0xff,0x0a,0x00,
+0x43,0x69,0xfc,0xff,0xe1,0xc2,0x07,0x12,0x60,0xe3,0x03,0xf1,0x01,0x00,0x0f,0xd2,
+0x00,0x1d,0xff,0xfa,0x52,0x12,0x69,0x40,0x0a,0x00,0x00,0x01,0xbf,0xa0,0x00,0x01,
+0x28,0x05,0x33,0xdf,0xff,0xff,0xec,0x06,0x63,0x04,0x8a,0xa9,0x62,0x00,0x3e,0xd5,
+0x04,0xc0,0xf3,0x5f,0x55,0xff,0xfb,0x55,0x55,0x55,0x55,0xf5,0x5f,0x00,0xb1,0x00,
+0xd0,0x01,0x12,0xe5,0x5f,0x00,0xcf,0xf7,0x00,0x04,0xdf,0xff,0xf5,0x5f,0xaa,0x01,
+0x20,0xbf,0xff,0x09,0x00,0x41,0x47,0x73,0x2d,0xff,0x09,0x00,0x41,0xdf,0xfa,0x00,
+0x6e,0x09,0x00,0xa1,0xef,0xfb,0x00,0x00,0x7c,0xcb,0xf5,0x5f,0x00,0xcf,0xe7,0x00,
 0x10,0xe5,0x2d,0x00,0x0c,0x09,0x00,0x05,0x1b,0x00,0x23,0xef,0xfb,0x09,0x00,0x23,
 0xdf,0xfa,0x09,0x00,0x23,0x58,0x83,0x09,0x00,0x24,0x13,0x31,0x2d,0x00,0x05,0x24,
 0x00,0x14,0xfc,0x12,0x00,0x03,0x09,0x00,0x03,0xab,0x00,0x32,0xf5,0x05,0x55,0x01,
 0x00,0x01,0xc0,0x0a,0x42,0x9c,0xee,0xc9,0x40,0xcf,0x00,0x10,0xdf,0x1b,0x07,0x12,
 0x40,0x60,0x02,0x51,0xaf,0x6b,0xd7,0xef,0xf8,0x74,0x02,0x71,0xa1,0x0f,0x6a,0xc0,
 0x08,0xff,0x80,0xff,0x09,0xa1,0x0f,0x6a,0xc0,0x00,0x6f,0xf5,0x00,0x00,0xdf,0x90,
-0x0b,0x00,0xe0,0x08,0xfd,0x00,0x05,0xfe,0x00,0x00,0x1f,0x6a,0xc0,0x00,0x00,0xef,
-0x50,0xd7,0x2b,0x20,0x1f,0xbd,0x16,0x1d,0x33,0xa0,0x0e,0xf3,0x7d,0x25,0x41,0x2f,
-0xe0,0x0f,0xf1,0x76,0x07,0x30,0x50,0x00,0x0f,0x7f,0x05,0xf0,0x1d,0x09,0xf6,0x00,
-0x6f,0xfa,0x10,0x0f,0xf0,0x0e,0xf2,0x00,0xbf,0xcf,0x41,0xfb,0x6f,0xe5,0x1f,0xe0,
-0x0b,0xf6,0x2d,0xf5,0x4f,0xa1,0xdf,0x72,0xbf,0xcf,0xb0,0x06,0xfd,0xee,0x36,0xfb,
-0x00,0x08,0xfc,0x26,0xff,0x60,0x00,0xef,0xd2,0xdd,0x03,0x81,0x3c,0xf9,0xfe,0x00,
-0x00,0x6f,0xeb,0xf6,0xa2,0x05,0x10,0xf6,0x46,0x05,0x11,0x80,0x9c,0x1a,0x01,0xb4,
-0x1c,0x63,0xfa,0x40,0x00,0x04,0xaf,0xfa,0xd5,0x07,0x11,0xee,0xbf,0x0c,0x00,0x40,
-0x1a,0x44,0xcf,0xff,0xfc,0x71,0x6a,0x02,0x13,0x22,0x62,0x06,0x34,0xac,0xb7,0x10,
-0x53,0x1a,0x03,0x9a,0x09,0x42,0x09,0xfe,0x62,0x39,0xf1,0x05,0x23,0x2f,0xf2,0xc8,
-0x29,0x31,0x00,0x7f,0x80,0xb9,0x2b,0xf0,0x00,0x46,0x40,0x00,0x9f,0x40,0x00,0x00,
-0x0c,0xf3,0x3d,0xff,0xfd,0x20,0x8f,0x50,0x6e,0x2c,0x40,0xef,0xff,0xff,0xe1,0x9b,
-0x2c,0x20,0x3f,0xe9,0x71,0x06,0x80,0x0e,0xf9,0x00,0x02,0xdf,0x7c,0xff,0xff,0xb6,
-0x19,0x41,0xea,0xbf,0xfb,0x0b,0x22,0x1b,0x51,0x2b,0xff,0xff,0xfb,0x47,0x37,0x04,
-0x50,0x2d,0xff,0xed,0xff,0xfe,0xf1,0x10,0x32,0x02,0xef,0xa2,0x6f,0x1f,0x33,0x00,
-0x0b,0xf8,0x3f,0x26,0x52,0x40,0x2f,0xd0,0x02,0xef,0x02,0x28,0x32,0x7f,0x60,0x0b,
-0x90,0x01,0x42,0xf4,0xaf,0x20,0x4f,0x0a,0x00,0x43,0xf8,0xcf,0x10,0xaf,0x24,0x07,
-0x23,0xcf,0xdd,0xae,0x01,0x20,0xfb,0xaf,0x71,0x16,0x00,0x01,0x00,0x1a,0xd8,0x00,
-0x08,0x15,0x40,0xa4,0x09,0x06,0x0a,0x0b,0x15,0x9f,0x1a,0x24,0x16,0x09,0x44,0x23,
-0x24,0x8f,0xd1,0x0a,0x00,0x10,0x08,0x36,0x04,0x84,0x12,0x22,0x22,0x11,0x11,0x10,
-0x8f,0xe2,0x49,0x21,0x23,0xff,0xfe,0xb1,0x22,0x00,0x8b,0x00,0x01,0xf4,0x24,0x00,
-0x01,0x00,0x40,0xdc,0x30,0x01,0x22,0x01,0x00,0x00,0x2c,0x00,0x11,0x02,0xba,0x28,
-0x01,0x97,0x15,0x15,0x1d,0x0a,0x00,0x93,0x01,0xcf,0xfc,0xbc,0xcc,0xcd,0xdd,0xee,
-0xe6,0x32,0x2a,0x03,0x60,0x01,0x15,0xc0,0x95,0x08,0x16,0xfc,0x96,0x00,0x15,0xc1,
-0x81,0x00,0x06,0x96,0x00,0x25,0x7e,0x20,0x0f,0x04,0x04,0x09,0x00,0x33,0xcc,0xa7,
-0x30,0x0a,0x00,0x54,0x9a,0xdf,0xfe,0x91,0x00,0x25,0x04,0x12,0xff,0x0b,0x00,0x51,
-0xcb,0x96,0x10,0x18,0xfe,0xf5,0x00,0x62,0x9b,0xdf,0xfb,0x30,0x2c,0xf5,0x91,0x06,
-0x31,0x7d,0xfb,0x10,0xbe,0x05,0x53,0x98,0x40,0x00,0x6e,0xe1,0x49,0x0b,0x23,0x91,
-0x01,0x48,0x00,0x31,0x38,0xef,0x50,0x21,0x01,0x41,0x8b,0xbb,0x94,0x06,0xbd,0x03,
-0x51,0xef,0x71,0x03,0x9f,0xc3,0x93,0x00,0x10,0xf3,0x2c,0x06,0x10,0x50,0xb4,0x0d,
-0x31,0x70,0x05,0x95,0xc3,0x08,0x80,0x4f,0xff,0x10,0x7f,0xff,0x60,0x2f,0xfe,0x25,
-0x02,0x01,0xb3,0x05,0x20,0xff,0x30,0x14,0x00,0x51,0xaf,0xff,0x80,0x2f,0xfe,0x28,
-0x00,0x50,0x1a,0xda,0x00,0x8f,0xf5,0x4b,0x07,0x10,0xf2,0x70,0x07,0x11,0x80,0xf1,
-0x0d,0x32,0x71,0x01,0x7f,0x4c,0x05,0x21,0x28,0xdf,0xf0,0x1b,0x07,0x01,0x00,0x22,
-0x8f,0xff,0x3d,0x14,0x14,0xdf,0x42,0x1d,0xe1,0x31,0x11,0x11,0x44,0xef,0xa0,0x00,
-0xdf,0x20,0x00,0x00,0xf6,0x3f,0xfa,0x08,0x00,0x00,0x1f,0x0a,0x00,0x08,0x00,0x40,
-0xfa,0x66,0x9f,0xf2,0x08,0x00,0x61,0xff,0xff,0x8c,0xf3,0xdf,0x20,0x45,0x09,0x0f,
-0x08,0x00,0x3f,0x20,0xee,0xee,0x0f,0x19,0x13,0xf3,0x62,0x02,0x17,0xe1,0xab,0x00,
-0x34,0x05,0x76,0x30,0x0a,0x00,0x43,0xef,0xef,0xfd,0x20,0x7b,0x25,0x42,0x91,0x00,
-0x3c,0xf2,0xa1,0x01,0x00,0x0a,0x04,0x30,0xcd,0xce,0xb4,0xc1,0x01,0x01,0x9d,0x26,
-0x71,0xa8,0xdf,0x60,0x00,0x00,0x0c,0xa0,0xbc,0x01,0x10,0x08,0xec,0x03,0x03,0x88,
-0x07,0x41,0xda,0x00,0x00,0x3f,0x8c,0x0a,0x60,0x45,0x00,0x7e,0x00,0x00,0xec,0xb2,
-0x1d,0xf0,0x12,0xcf,0xfe,0x00,0x6f,0x00,0x07,0xf2,0x00,0x48,0xcf,0xff,0xff,0xd9,
-0x00,0x8e,0x00,0x0d,0xa0,0x0e,0xff,0xff,0xd9,0x51,0x00,0x00,0xdb,0x00,0x1f,0x40,
-0x0a,0xc8,0x41,0x75,0x51,0x01,0x70,0x30,0x2f,0x20,0x00,0x00,0x02,0xfe,0x43,0x2c,
-0x33,0xb0,0x2f,0x30,0x4b,0x28,0x21,0x06,0xf1,0xc0,0x05,0x00,0xb0,0x03,0x50,0x03,
-0xf2,0x0b,0xb0,0x00,0x76,0x1d,0x00,0x0b,0x00,0x41,0x04,0xf4,0x00,0x01,0x96,0x0d,
-0x53,0x06,0xf0,0x00,0xaf,0x30,0x39,0x0a,0x41,0xa0,0x00,0x1b,0xf9,0xb8,0x00,0x32,
-0x13,0xce,0x10,0xdf,0x07,0x00,0xe9,0x1d,0x00,0x11,0x00,0x10,0x35,0xfb,0x06,0x14,
-0x52,0xea,0x00,0x25,0x4c,0xc1,0x5a,0x26,0x16,0xf2,0x0a,0x00,0x24,0x04,0x95,0x0a,
-0x00,0x24,0x0a,0xf7,0x0a,0x00,0x10,0x0f,0x20,0x00,0x10,0x10,0xd4,0x0f,0x20,0x56,
-0xb0,0xdd,0x16,0xf0,0x09,0x91,0x8f,0xfb,0xdf,0xf2,0x10,0x00,0x0c,0xff,0xdf,0xf1,
-0xff,0x40,0x0a,0xf9,0x00,0x00,0x6f,0xd2,0x01,0x82,0xff,0x00,0x05,0xda,0x01,0x10,
-0x30,0xb4,0x30,0x51,0x09,0xf9,0x00,0x03,0xfc,0x0a,0x2a,0x52,0xcf,0xf3,0x00,0x08,
-0xf7,0x70,0x2f,0x32,0x60,0x00,0x0b,0x43,0x1a,0x14,0xf2,0x1a,0x30,0x00,0x78,0x00,
+0x0b,0x00,0xf0,0x0f,0x08,0xfd,0x00,0x05,0xfe,0x00,0x00,0x1f,0x6a,0xc0,0x00,0x00,
+0xef,0x50,0x0a,0xf8,0x00,0x00,0x1f,0xbd,0xc0,0x00,0x00,0x7f,0xa0,0x0e,0xf3,0x00,
+0x00,0x0d,0x26,0x01,0x41,0x2f,0xe0,0x0f,0xf1,0x76,0x07,0x30,0x50,0x00,0x0f,0x7f,
+0x05,0xf0,0x1d,0x09,0xf6,0x00,0x6f,0xfa,0x10,0x0f,0xf0,0x0e,0xf2,0x00,0xbf,0xcf,
+0x41,0xfb,0x6f,0xe5,0x1f,0xe0,0x0b,0xf6,0x2d,0xf5,0x4f,0xa1,0xdf,0x72,0xbf,0xcf,
+0xb0,0x06,0xfd,0xee,0x36,0xfb,0x00,0x08,0xfc,0x26,0xff,0x60,0x00,0xef,0xd2,0xdd,
+0x03,0x81,0x3c,0xf9,0xfe,0x00,0x00,0x6f,0xeb,0xf6,0xa2,0x05,0x10,0xf6,0x46,0x05,
+0x20,0x80,0x00,0x8b,0x05,0x10,0xa0,0x3c,0x03,0x63,0xfa,0x40,0x00,0x04,0xaf,0xfa,
+0xd5,0x07,0x32,0xee,0xff,0xff,0x4f,0x06,0x54,0x17,0xcf,0xff,0xfc,0x71,0x6a,0x02,
+0x13,0x22,0x62,0x06,0x33,0xac,0xb7,0x10,0x2a,0x04,0x13,0xff,0x9a,0x09,0x42,0x09,
+0xfe,0x62,0x39,0xf1,0x05,0x00,0x3a,0x04,0x21,0x8f,0xb0,0xc7,0x02,0xf0,0x14,0x80,
+0x00,0x00,0x0e,0xf0,0x00,0x46,0x40,0x00,0x9f,0x40,0x00,0x00,0x0c,0xf3,0x3d,0xff,
+0xfd,0x20,0x8f,0x50,0x00,0x00,0x0d,0xf4,0xef,0xff,0xff,0xe1,0x5f,0xc0,0x00,0x00,
+0x3f,0xe9,0x71,0x06,0x60,0x0e,0xf9,0x00,0x02,0xdf,0x7c,0x58,0x03,0x70,0x03,0xff,
+0xea,0xbf,0xfb,0x0b,0xff,0x14,0x03,0x51,0x2b,0xff,0xff,0xfb,0x47,0x37,0x04,0xe0,
+0x2d,0xff,0xed,0xff,0xfe,0xff,0xff,0xff,0xc0,0x02,0xef,0xa2,0x03,0xef,0x27,0x00,
+0x51,0x00,0x0b,0xf8,0x00,0x4f,0x7c,0x01,0x42,0x40,0x2f,0xd0,0x02,0x85,0x09,0x42,
+0xd0,0x7f,0x60,0x0b,0x90,0x01,0x42,0xf4,0xaf,0x20,0x4f,0x0a,0x00,0x43,0xf8,0xcf,
+0x10,0xaf,0x24,0x07,0x23,0xcf,0xdd,0xae,0x01,0x51,0xfb,0xaf,0xff,0xfe,0xdd,0x01,
+0x00,0x1a,0xd8,0x00,0x08,0x15,0x40,0xa4,0x09,0x06,0x0a,0x0b,0x24,0x9f,0xb0,0x0a,
+0x00,0x34,0x09,0xfc,0x10,0x0b,0x00,0x24,0x8f,0xd1,0x0a,0x00,0x10,0x08,0x36,0x04,
+0x82,0x12,0x22,0x22,0x11,0x11,0x10,0x8f,0xe2,0x15,0x09,0x00,0x09,0x05,0x13,0x30,
+0x0a,0x00,0x00,0x1c,0x01,0x22,0x5c,0xcc,0x01,0x00,0x40,0xdc,0x30,0x01,0x22,0x01,
+0x00,0x00,0x2c,0x00,0x23,0x02,0xdf,0x1f,0x00,0x35,0xf7,0x00,0x1d,0x0a,0x00,0xd5,
+0x01,0xcf,0xfc,0xbc,0xcc,0xcd,0xdd,0xee,0xe6,0x00,0x00,0x0b,0xfc,0x81,0x00,0x25,
+0xaf,0xc0,0x95,0x08,0x16,0xfc,0x96,0x00,0x15,0xc1,0x81,0x00,0x06,0x96,0x00,0x25,
+0x7e,0x20,0x0f,0x04,0x04,0x09,0x00,0x33,0xcc,0xa7,0x30,0x0a,0x00,0x54,0x9a,0xdf,
+0xfe,0x91,0x00,0x25,0x04,0x12,0xff,0x0b,0x00,0x51,0xcb,0x96,0x10,0x18,0xfe,0xf5,
+0x00,0x62,0x9b,0xdf,0xfb,0x30,0x2c,0xf5,0x91,0x06,0x31,0x7d,0xfb,0x10,0xbe,0x05,
+0x53,0x98,0x40,0x00,0x6e,0xe1,0x49,0x0b,0x23,0x91,0x01,0x48,0x00,0x31,0x38,0xef,
+0x50,0x21,0x01,0x41,0x8b,0xbb,0x94,0x06,0xbd,0x03,0x51,0xef,0x71,0x03,0x9f,0xc3,
+0x93,0x00,0x10,0xf3,0x2c,0x06,0x10,0x50,0xb4,0x0d,0x31,0x70,0x05,0x95,0xc3,0x08,
+0x80,0x4f,0xff,0x10,0x7f,0xff,0x60,0x2f,0xfe,0x25,0x02,0x01,0xb3,0x05,0x20,0xff,
+0x30,0x14,0x00,0x51,0xaf,0xff,0x80,0x2f,0xfe,0x28,0x00,0x50,0x1a,0xda,0x00,0x8f,
+0xf5,0x4b,0x07,0x10,0xf2,0x70,0x07,0x11,0x80,0xf1,0x0d,0x32,0x71,0x01,0x7f,0x4c,
+0x05,0x45,0x28,0xdf,0xff,0xc7,0xdc,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x90,0x8f,
+0xff,0xff,0xff,0xff,0xa0,0x00,0x00,0xdf,0x08,0x00,0xf2,0x03,0xfb,0x00,0x00,0xdf,
+0x31,0x11,0x11,0x44,0xef,0xa0,0x00,0xdf,0x20,0x00,0x00,0xf6,0x3f,0xfa,0x08,0x00,
+0x30,0x04,0xff,0x90,0x08,0x00,0x40,0xfa,0x66,0x9f,0xf2,0x08,0x00,0x40,0xff,0xff,
+0x8c,0xf3,0x08,0x00,0x3f,0x00,0x00,0x0c,0x08,0x00,0x3f,0x10,0xee,0x01,0x00,0x41,
+0xef,0xf3,0xaf,0xff,0x01,0x00,0x26,0xe1,0x00,0x01,0x00,0x34,0x05,0x76,0x30,0x0a,
+0x00,0x42,0xef,0xef,0xfd,0x20,0x0b,0x00,0x51,0x6f,0x91,0x00,0x3c,0xf2,0x0a,0x00,
+0xf0,0x09,0x01,0xf8,0x00,0x00,0x00,0xcd,0xce,0xb4,0x00,0x00,0x00,0x08,0xe0,0x00,
+0x00,0x00,0x3f,0xa8,0xdf,0x60,0x00,0x00,0x0c,0xa0,0x1b,0x00,0x72,0x00,0x08,0xf3,
+0x00,0x00,0x0d,0x90,0x33,0x00,0x50,0xda,0x00,0x00,0x3f,0xa0,0x09,0x00,0xf0,0x31,
+0x45,0x00,0x7e,0x00,0x00,0xec,0x00,0x00,0x00,0x48,0xcf,0xfe,0x00,0x6f,0x00,0x07,
+0xf2,0x00,0x48,0xcf,0xff,0xff,0xd9,0x00,0x8e,0x00,0x0d,0xa0,0x0e,0xff,0xff,0xd9,
+0x51,0x00,0x00,0xdb,0x00,0x1f,0x40,0x0a,0xc8,0x41,0x75,0x00,0x00,0x00,0xbf,0x30,
+0x2f,0x20,0x00,0x00,0x02,0xfe,0x10,0x00,0x00,0x0d,0xb0,0x2f,0x30,0x00,0x00,0x0b,
+0x38,0x01,0xf0,0x05,0x06,0xf1,0x0f,0x50,0x00,0x00,0x5f,0xff,0xf4,0x00,0x00,0x03,
+0xf2,0x0b,0xb0,0x00,0x01,0xef,0xff,0xfd,0x0b,0x00,0xd3,0x04,0xf4,0x00,0x01,0x44,
+0x44,0x44,0x10,0x00,0x06,0xf0,0x00,0xaf,0xb8,0x00,0x51,0x0e,0xa0,0x00,0x1b,0xf9,
+0xb8,0x00,0x62,0x13,0xce,0x10,0x00,0x00,0x7e,0xe3,0x00,0x10,0xb2,0x11,0x00,0x64,
+0x35,0x66,0x65,0x55,0x55,0x52,0xea,0x00,0x24,0x4c,0xc1,0x0a,0x00,0x26,0x6f,0xf2,
+0x0a,0x00,0x24,0x04,0x95,0x0a,0x00,0x24,0x0a,0xf7,0x0a,0x00,0x10,0x0f,0x20,0x00,
+0xf0,0x14,0x10,0x00,0x09,0xff,0xfe,0x56,0xb0,0x00,0x00,0x9f,0xff,0x91,0x8f,0xfb,
+0xdf,0xf2,0x10,0x00,0x0c,0xff,0xdf,0xf1,0xff,0x40,0x0a,0xf9,0x00,0x00,0x6f,0xd2,
+0x01,0x82,0xff,0x00,0x05,0xda,0x01,0xf0,0x04,0x30,0x00,0x00,0xff,0x30,0x09,0xf9,
+0x00,0x03,0xfc,0x00,0x00,0x00,0x9f,0xfa,0xcf,0xf3,0x00,0x08,0x48,0x00,0x61,0x0a,
+0xff,0xff,0x60,0x00,0x0b,0x68,0x00,0x64,0x7f,0xf2,0x00,0x00,0x0e,0xf0,0x78,0x00,
 0x24,0x1f,0xc0,0x0a,0x00,0x24,0x3f,0xa0,0x0a,0x00,0x24,0x5f,0x80,0x0a,0x00,0x24,
 0x7f,0x60,0x0a,0x00,0x24,0x8f,0x50,0x0a,0x00,0x2a,0x9f,0x40,0xb4,0x00,0x01,0x01,
-0x00,0xf0,0x07,0x7b,0x91,0x00,0xbf,0xff,0xe1,0x4f,0xa0,0x6f,0x97,0xf3,0x00,0xfc,
-0x5f,0x70,0x2f,0xa0,0xdf,0xcf,0xf3,0x02,0xbf,0xfe,0x2a,0x12,0xfa,0x17,0x2e,0x30,
-0x7f,0xff,0x50,0xa0,0x2a,0x00,0x8a,0x1b,0x01,0xa9,0x10,0x00,0x71,0x15,0x01,0x69,
-0x0a,0x60,0x6f,0xff,0x70,0x09,0xff,0x90,0xf4,0x11,0x21,0xf3,0x1f,0x19,0x18,0x30,
-0xef,0xfd,0xbf,0x84,0x19,0x50,0xf8,0x2f,0xff,0xff,0xd1,0xdd,0x0f,0x60,0x06,0xff,
-0xfd,0x10,0x00,0x02,0xd2,0x1c,0x21,0xfe,0x10,0x40,0x09,0xd0,0x1e,0xff,0xb0,0x00,
-0x08,0xff,0xa0,0x00,0x05,0xff,0xf7,0x00,0x0b,0x6b,0x05,0x61,0xaf,0xff,0x20,0x0e,
-0xff,0x40,0xc3,0x11,0x01,0x7b,0x2e,0x95,0x03,0xff,0xf9,0x07,0xff,0xff,0xfe,0xd9,
-0x20,0x11,0x26,0x52,0x06,0xdd,0xdd,0xdf,0xff,0x64,0x05,0x13,0x05,0xca,0x0c,0x02,
-0x1a,0x2b,0x00,0xf0,0x1c,0x03,0xb6,0x0a,0x13,0xf0,0xe7,0x18,0x0f,0x0f,0x00,0x0c,
-0x83,0x0d,0xdd,0xdd,0xdd,0xde,0xff,0xfd,0x60,0x27,0x05,0x12,0x0f,0x08,0x00,0x51,
-0x80,0x02,0xff,0xfd,0x50,0x63,0x08,0x41,0x60,0x00,0x01,0xdd,0xd7,0x0d,0x02,0xa2,
-0x2d,0x11,0x0a,0x0c,0x06,0x00,0xef,0x10,0x02,0xe3,0x2f,0x10,0x05,0x0f,0x1d,0x10,
-0x1d,0x9c,0x05,0xe0,0x0b,0xff,0xfc,0xff,0xa0,0x02,0xff,0xf3,0x4f,0xfd,0x00,0x7f,
-0xfb,0x00,0x21,0x13,0x60,0x70,0x0d,0xff,0x50,0xef,0xf4,0xfb,0x00,0x00,0x85,0x0b,
-0x22,0xc0,0x8f,0x23,0x07,0x03,0x07,0x00,0x10,0x6d,0xda,0x24,0x21,0xfe,0xd4,0xda,
-0x04,0x2f,0xf8,0x00,0x07,0x00,0x3a,0x12,0x3f,0x9b,0x21,0x03,0x60,0x21,0x10,0x2d,
-0xe0,0x00,0x02,0xc1,0x0b,0x12,0x1b,0x93,0x1e,0x13,0x01,0x91,0x1f,0x50,0xef,0xf3,
-0x0d,0xdd,0x20,0xfa,0x29,0x10,0x0f,0x73,0x0a,0x2f,0xdf,0xf5,0x07,0x00,0x1e,0x2f,
-0xff,0xf3,0x02,0x00,0x09,0x11,0x5a,0xbf,0x1b,0x20,0xe9,0x40,0x7a,0x1a,0x30,0xe9,
-0x21,0x7c,0x24,0x01,0x20,0x02,0xdf,0x91,0x1f,0x50,0xfc,0x74,0x00,0x3f,0xfe,0x1c,
-0x00,0x10,0xb0,0x19,0x32,0x00,0x64,0x07,0x0f,0x09,0x00,0x06,0x00,0x44,0x06,0x22,
-0xc8,0x20,0x95,0x01,0x30,0x50,0xff,0xfe,0xf6,0x01,0x10,0x1f,0xf7,0x31,0x40,0xff,
-0xf7,0xff,0xf3,0x8d,0x01,0x20,0xbf,0xff,0x8d,0x31,0x20,0xfd,0xff,0x74,0x05,0x00,
-0x6b,0x1a,0x00,0x00,0x02,0x0f,0x0d,0x00,0x1a,0xe0,0xe0,0x1f,0xff,0x10,0x1b,0xef,
-0xe9,0x10,0x01,0xff,0xf1,0x02,0xff,0xff,0xeb,0x23,0xb0,0x10,0x2f,0xef,0xff,0xf8,
-0x01,0xff,0xf1,0x01,0x30,0x0b,0x80,0x02,0x10,0x10,0x29,0x04,0x40,0x01,0xff,0xf1,
-0x00,0xb6,0x2c,0x01,0x0f,0x00,0x30,0x1f,0xff,0x31,0x0f,0x00,0x13,0x01,0x0f,0x00,
-0x30,0x2f,0xff,0x20,0x50,0x01,0x10,0x05,0xc8,0x1a,0x10,0x60,0x26,0x15,0x64,0x00,
-0xaf,0xfe,0x40,0x00,0x8f,0x7f,0x23,0x11,0xd0,0xb5,0x25,0x00,0x6f,0x22,0x21,0x03,
-0x9d,0x51,0x29,0x0a,0x25,0x01,0x72,0xab,0xb2,0x8f,0xff,0xff,0xed,0x82,0xd3,0x05,
-0x42,0x60,0x7d,0xdd,0xdd,0x19,0x1f,0x12,0x05,0x36,0x1f,0x21,0x8f,0xfb,0x39,0x1e,
-0x16,0xfd,0xd9,0x02,0x0f,0x06,0x00,0x37,0x71,0x1f,0xff,0xff,0xea,0x50,0x00,0x1f,
-0xdb,0x17,0x32,0x0d,0xdd,0xde,0x45,0x22,0x03,0x23,0x2f,0x02,0x47,0x2e,0x17,0x7f,
+0x00,0xf0,0x8c,0x7b,0x91,0x00,0xbf,0xff,0xe1,0x4f,0xa0,0x6f,0x97,0xf3,0x00,0xfc,
+0x5f,0x70,0x2f,0xa0,0xdf,0xcf,0xf3,0x02,0xbf,0xd4,0x00,0x03,0xff,0xfa,0x00,0x00,
+0x01,0xff,0xf2,0x00,0x7f,0xff,0x50,0x00,0x02,0xff,0xf1,0x00,0x0b,0xff,0xf1,0x00,
+0x04,0xff,0xf0,0x00,0x01,0xef,0xfc,0x00,0x06,0xff,0xd0,0x00,0x00,0x6f,0xff,0x70,
+0x09,0xff,0x90,0x00,0x06,0xff,0xff,0xf3,0x1f,0xff,0x30,0x00,0x3f,0xff,0xef,0xfd,
+0xbf,0xfa,0x00,0x00,0x9f,0xf8,0x2f,0xff,0xff,0xd1,0x00,0x00,0xef,0xf2,0x06,0xff,
+0xfd,0x10,0x00,0x02,0xff,0xf0,0x00,0xbf,0xfe,0x10,0x00,0x05,0xff,0xc0,0x00,0x1e,
+0xff,0xb0,0x00,0x08,0xff,0xa0,0x00,0x05,0xff,0xf7,0x00,0x0b,0xff,0x70,0x00,0x00,
+0xaf,0xff,0x20,0x0e,0xff,0x40,0x00,0x00,0x0d,0xff,0xd0,0x1f,0xff,0x20,0x00,0x00,
+0x03,0xff,0xf9,0x07,0xff,0xff,0xfe,0xd9,0x20,0x00,0x00,0x7f,0xff,0xff,0xfa,0x00,
+0x71,0x06,0xdd,0xdd,0xdf,0xff,0xff,0x20,0x57,0x02,0x21,0xff,0xf9,0xb2,0x00,0x31,
+0x08,0xff,0xc0,0x08,0x00,0x21,0x4f,0xfe,0x07,0x00,0x31,0x03,0xff,0xf0,0x08,0x00,
+0x2f,0x3f,0xff,0x0f,0x00,0x0c,0x82,0x0d,0xdd,0xdd,0xdd,0xde,0xff,0xfd,0x60,0xd8,
+0x01,0x22,0xf8,0x0f,0x08,0x00,0x80,0x80,0x02,0xff,0xfd,0x50,0x00,0x00,0x2f,0x6d,
+0x00,0x20,0x01,0xdd,0x1e,0x02,0x40,0x00,0x02,0xff,0xf3,0x79,0x01,0x00,0xa1,0x00,
+0x30,0x00,0x5f,0xfb,0xa1,0x02,0x00,0x45,0x00,0xf1,0x13,0x05,0xbf,0xff,0x30,0x00,
+0x1d,0xff,0xff,0xf6,0x00,0x0b,0xff,0xfc,0xff,0xa0,0x02,0xff,0xf3,0x4f,0xfd,0x00,
+0x7f,0xfb,0x00,0xff,0xf1,0x0b,0xff,0x70,0x0d,0xff,0x50,0xef,0xf4,0xfb,0x00,0x51,
+0x10,0x06,0xff,0xc0,0x8f,0x5a,0x00,0x13,0xf5,0x07,0x00,0x70,0x6d,0xdd,0xdd,0xdd,
+0xff,0xfe,0xd4,0x86,0x00,0x3f,0xaf,0xf8,0x00,0x07,0x00,0x3a,0x82,0x3f,0xff,0xff,
+0xff,0xeb,0x50,0x00,0x3f,0x1e,0x04,0x10,0x2d,0xe0,0x00,0x11,0xff,0x03,0x02,0x41,
+0x1b,0xff,0xe0,0x00,0xb9,0x00,0x02,0xed,0x01,0xff,0x01,0xef,0xf3,0x0d,0xdd,0x20,
+0x00,0x00,0xdf,0xf4,0x0f,0xff,0x30,0x00,0x00,0xdf,0xf5,0x07,0x00,0x1e,0x2f,0xff,
+0xf3,0x02,0x00,0x09,0xf0,0x00,0x5a,0x40,0x00,0x00,0x06,0xff,0xe9,0x40,0x00,0x6f,
+0xff,0xff,0xe9,0x21,0x7c,0x24,0x01,0xb0,0x02,0xdf,0xff,0x60,0x00,0xbf,0xfc,0x74,
+0x00,0x3f,0xfe,0x1c,0x00,0x20,0xb0,0x00,0x2b,0x01,0x2f,0x00,0x07,0x09,0x00,0x07,
+0x62,0xff,0xff,0xff,0xfe,0xc8,0x20,0x95,0x01,0x30,0x50,0xff,0xfe,0xf6,0x01,0x00,
+0x56,0x02,0x50,0x06,0xff,0xf7,0xff,0xf3,0x8d,0x01,0x10,0xbf,0x89,0x00,0x20,0x6f,
+0xfd,0x0d,0x00,0x50,0x04,0xff,0xef,0xff,0x30,0x00,0x02,0x0f,0x0d,0x00,0x1a,0xf0,
+0x0e,0xe0,0x1f,0xff,0x10,0x1b,0xef,0xe9,0x10,0x01,0xff,0xf1,0x02,0xff,0xff,0xfe,
+0x10,0x1f,0xff,0x10,0x2f,0xef,0xff,0xf8,0x01,0xff,0xf1,0x01,0x30,0x0b,0x80,0x02,
+0x10,0x10,0x29,0x04,0x30,0x01,0xff,0xf1,0x01,0x02,0x11,0xf2,0x0f,0x00,0x30,0x1f,
+0xff,0x31,0x0f,0x00,0x13,0x01,0x0f,0x00,0x50,0x2f,0xff,0x20,0xff,0xf2,0x88,0x02,
+0xf0,0x0a,0xf0,0x0e,0xff,0x60,0x00,0x00,0xbf,0xfc,0x00,0xaf,0xfe,0x40,0x00,0x8f,
+0xff,0x60,0x03,0xff,0xff,0xfe,0xff,0xff,0xd0,0x00,0x07,0xbd,0x00,0xaa,0xd2,0x00,
+0x00,0x03,0x9d,0xff,0xeb,0x60,0x00,0x00,0x25,0x01,0x91,0xab,0xb2,0x8f,0xff,0xff,
+0xed,0x82,0x00,0x8f,0xd9,0x02,0x61,0x7d,0xdd,0xdd,0xff,0xff,0xf2,0xd6,0x02,0x01,
+0x2e,0x04,0x30,0x8f,0xfb,0x00,0x6e,0x02,0x16,0xfd,0xd9,0x02,0x0f,0x06,0x00,0x37,
+0xd0,0x1f,0xff,0xff,0xea,0x50,0x00,0x1f,0xff,0xff,0xff,0xfc,0x10,0x0d,0x23,0x02,
+0x70,0xb0,0x00,0x00,0x00,0x2b,0xff,0xf4,0x1e,0x00,0x21,0xdf,0xf9,0x5a,0x04,0x07,
 0x78,0x00,0x26,0x3f,0xff,0x0c,0x00,0x24,0x7f,0xfd,0x24,0x00,0x00,0x30,0x00,0x02,
-0x3c,0x00,0x11,0x1f,0x6c,0x02,0x11,0x1f,0x43,0x23,0x36,0x02,0x22,0x00,0xbe,0x2e,
-0x3f,0x2f,0xff,0x10,0x0d,0x00,0x06,0x00,0xa7,0x02,0x12,0x02,0x70,0x03,0x02,0xa6,
-0x02,0x11,0x20,0x68,0x0d,0x12,0xf7,0x35,0x1f,0x12,0x80,0x89,0x17,0x02,0xe4,0x2e,
-0x15,0x50,0x74,0x1e,0x00,0x83,0x04,0x00,0x8b,0x0e,0x00,0xd4,0x05,0x10,0x19,0xdd,
-0x11,0x50,0x03,0x9f,0xff,0xff,0x40,0x75,0x11,0x11,0xfd,0xe0,0x05,0x01,0x3e,0x00,
-0x26,0xbd,0x70,0xff,0x07,0x21,0xff,0xff,0xea,0x00,0x12,0xff,0x0f,0x03,0x21,0xff,
-0xfe,0x0f,0x03,0x00,0xfe,0x01,0x51,0x1c,0xff,0xf0,0xff,0xf3,0xd9,0x03,0x01,0xdb,
-0x03,0x21,0xef,0xf4,0x07,0x00,0x2f,0xdf,0xf5,0x07,0x00,0x11,0x10,0xfe,0xbf,0x03,
-0x13,0xf5,0xf6,0x0a,0x14,0xff,0xbb,0x1c,0x10,0x50,0x3d,0x32,0x00,0x4c,0x19,0x01,
-0xd4,0x0c,0x10,0x01,0xbe,0x02,0x00,0x7b,0x03,0x40,0x7f,0xff,0xfe,0x20,0xa7,0x24,
-0x11,0x0d,0x63,0x26,0x30,0xf3,0x00,0x0a,0x6c,0x01,0x21,0xdf,0xf6,0xa6,0x1d,0x00,
-0x3f,0x0f,0x22,0x4f,0xff,0x47,0x0f,0x22,0x8f,0xfc,0xf2,0x00,0x21,0xdf,0xf7,0x08,
-0x00,0x31,0x01,0xff,0xf4,0x08,0x00,0x31,0x05,0xff,0xf0,0x08,0x00,0x00,0x85,0x1b,
-0x80,0xdd,0xdd,0xff,0xf8,0x0d,0xff,0x80,0x00,0xac,0x04,0x00,0xcb,0x31,0x00,0x08,
-0x00,0x2f,0xff,0xf3,0x02,0x00,0x13,0x40,0x07,0xff,0xfc,0x60,0x42,0x05,0x50,0x70,
-0x06,0xde,0xff,0xff,0x64,0x02,0x13,0xf3,0x5a,0x01,0x20,0xcf,0xf6,0x39,0x01,0x00,
-0xbd,0x02,0x1e,0xf6,0x09,0x00,0x54,0x2d,0xdd,0xdf,0xff,0x62,0x2f,0x16,0x11,0x60,
-0xad,0x2e,0x43,0xda,0x50,0x00,0x6f,0x4f,0x01,0x31,0x5d,0xef,0xfe,0x36,0x2c,0x10,
-0x00,0xf7,0x11,0x10,0x3d,0x7d,0x27,0x11,0xf0,0xed,0x1c,0x00,0xca,0x15,0x00,0x1c,
-0x1d,0x31,0x05,0xff,0xe0,0x1d,0x23,0x01,0x1c,0x06,0x01,0x08,0x00,0x11,0xe0,0xc0,
-0x30,0x12,0x04,0x43,0x03,0x20,0xf3,0x01,0xc4,0x0d,0x01,0x04,0x29,0x00,0x7d,0x22,
-0x00,0xb4,0x12,0x00,0x1e,0x31,0x22,0xfe,0x10,0xe0,0x31,0x11,0xe3,0xd6,0x2e,0x23,
-0xfe,0xb7,0x9c,0x1d,0x21,0xaf,0xf9,0xe7,0x30,0x20,0xaf,0xf9,0x96,0x2e,0x00,0x29,
-0x01,0x30,0xbf,0xfa,0x00,0x0a,0x0d,0x20,0x5f,0xff,0x94,0x01,0x10,0x00,0x80,0x03,
-0x01,0x25,0x36,0x21,0xb0,0x03,0x64,0x29,0x40,0xf1,0x07,0xff,0xc0,0x68,0x01,0x11,
-0x0e,0x33,0x29,0x22,0xfc,0xaf,0xae,0x03,0x00,0x61,0x0a,0x20,0x24,0x7f,0xef,0x02,
-0x11,0x8f,0x32,0x12,0x00,0x07,0x00,0x82,0xfc,0x50,0x00,0x00,0x8f,0xed,0xb7,0x30,
-0xcf,0x13,0x18,0xfe,0x1e,0x27,0x20,0xdd,0xde,0x07,0x26,0x10,0xfb,0xdd,0x00,0x31,
-0xe0,0x7f,0xfb,0x32,0x21,0x30,0x7f,0xfb,0x00,0xc7,0x03,0x01,0x07,0x00,0x10,0xef,
-0x17,0x27,0x11,0x70,0x07,0x00,0x26,0xff,0x90,0x07,0x00,0x02,0x60,0x05,0x0f,0x07,
-0x00,0x2d,0x10,0x5f,0xf4,0x2d,0x12,0x20,0x35,0x10,0x00,0xe6,0x00,0x00,0xff,0x04,
-0xa1,0x40,0x5f,0xfe,0x00,0x00,0x4e,0xff,0xc0,0x5f,0xfe,0x7d,0x24,0x10,0x5f,0x92,
-0x03,0x00,0xfa,0x27,0x21,0xdd,0x90,0x31,0x00,0x00,0x49,0x28,0x11,0xf5,0x07,0x00,
-0x02,0x46,0x00,0x12,0x01,0xd0,0x1a,0x01,0xbc,0x24,0x00,0xdd,0x00,0x20,0xa0,0x2d,
-0x3b,0x07,0x31,0xfe,0x20,0x3f,0x5f,0x01,0x00,0x24,0x06,0x30,0xfe,0xb7,0x00,0x12,
-0x19,0x60,0x00,0x0a,0xff,0x90,0xef,0xfa,0x3e,0x35,0x70,0x05,0xff,0xf4,0x00,0x0d,
-0xff,0x60,0x4d,0x1f,0x10,0xef,0xfd,0x20,0x10,0x40,0x72,0x05,0x20,0xaf,0xfa,0x86,
-0x02,0x51,0x05,0xff,0xe1,0xdf,0xfa,0x12,0x10,0x00,0xab,0x03,0x00,0xe0,0x0b,0x00,
-0xd9,0x0e,0x11,0xb6,0x66,0x03,0x12,0xf1,0xe6,0x0e,0x1f,0x10,0x0d,0x00,0x23,0x30,
-0x8f,0xff,0x40,0xab,0x01,0x10,0x0c,0x3d,0x0a,0x20,0xef,0xf5,0xac,0x18,0x00,0xcb,
-0x01,0x11,0x5f,0xeb,0x24,0x02,0x11,0x2f,0x10,0xf0,0xda,0x26,0x12,0x0c,0x39,0x28,
-0x12,0xef,0xed,0x18,0x02,0x44,0x38,0x12,0xbf,0x4d,0x00,0x12,0x1e,0x01,0x08,0x12,
-0x04,0x61,0x24,0x00,0x51,0x00,0x20,0x0c,0xdd,0xec,0x00,0x22,0xe1,0x0f,0x9e,0x03,
-0x03,0x07,0x00,0x10,0x9f,0x8b,0x0e,0x32,0x92,0x00,0x9f,0x34,0x0d,0x11,0x7d,0x77,
-0x04,0x12,0xe0,0x23,0x01,0x25,0xf3,0x00,0x5c,0x33,0x00,0x50,0x02,0x30,0x06,0x77,
-0x10,0x24,0x07,0x00,0xec,0x06,0x41,0x01,0xff,0xf1,0x0f,0xdd,0x37,0x10,0xc0,0x07,
-0x00,0x30,0x1e,0xff,0x70,0x07,0x00,0x20,0xcf,0xfe,0xb6,0x20,0x81,0x1b,0xff,0xf5,
-0x00,0x0f,0xff,0x33,0xef,0xc4,0x20,0x31,0x36,0xff,0xf7,0x7c,0x34,0x20,0xfe,0x40,
+0x3c,0x00,0x10,0x1f,0x6c,0x02,0x00,0x4e,0x00,0x60,0xda,0x40,0x00,0x02,0x22,0x00,
+0x30,0x03,0x00,0x25,0x01,0x00,0x1f,0x01,0x1f,0x10,0x0d,0x00,0x06,0x00,0xa7,0x02,
+0x12,0x02,0x70,0x03,0x02,0xa6,0x02,0x00,0xd2,0x03,0x12,0x04,0xfb,0x00,0x12,0x0a,
+0xb3,0x02,0x21,0xbf,0xf8,0x85,0x05,0x10,0xff,0xaf,0x04,0x11,0x06,0x38,0x00,0x01,
+0x83,0x04,0x30,0x00,0x04,0xef,0xd4,0x05,0x80,0x19,0xff,0xff,0x40,0x00,0x03,0x9f,
+0xff,0x2e,0x04,0x31,0xbf,0xff,0xfd,0xe0,0x05,0x01,0x3e,0x00,0x21,0xbd,0x70,0xe9,
+0x02,0x01,0xe7,0x02,0x21,0xff,0xff,0xea,0x00,0x12,0xff,0x0f,0x03,0x21,0xff,0xfe,
+0x0f,0x03,0x00,0xfe,0x01,0x51,0x1c,0xff,0xf0,0xff,0xf3,0xd9,0x03,0x01,0xdb,0x03,
+0x21,0xef,0xf4,0x07,0x00,0x2f,0xdf,0xf5,0x07,0x00,0x11,0x10,0xfe,0xbf,0x03,0x12,
+0xf5,0x2d,0x04,0x04,0x07,0x00,0xf0,0x02,0x2f,0xff,0x50,0x18,0xdf,0xfc,0x70,0x00,
+0x09,0xff,0xc2,0xef,0xff,0xff,0xfc,0x00,0x01,0xbe,0x02,0x00,0x7b,0x03,0xf0,0x02,
+0x7f,0xff,0xfe,0x20,0x0a,0xff,0xe0,0x00,0x0d,0xff,0xf3,0x00,0x01,0xff,0xf3,0x00,
+0x0a,0x6c,0x01,0x40,0xdf,0xf6,0x00,0x0f,0xd7,0x00,0x61,0xbf,0xf7,0x00,0x4f,0xff,
+0x00,0x08,0x00,0x22,0x8f,0xfc,0xf2,0x00,0x21,0xdf,0xf7,0x08,0x00,0x31,0x01,0xff,
+0xf4,0x08,0x00,0x31,0x05,0xff,0xf0,0x08,0x00,0xc0,0x09,0xff,0xc0,0x00,0xdd,0xdd,
+0xff,0xf8,0x0d,0xff,0x80,0x00,0xac,0x04,0x31,0x1f,0xff,0x40,0x08,0x00,0x2f,0xff,
+0xf3,0x02,0x00,0x13,0x40,0x07,0xff,0xfc,0x60,0x42,0x05,0x50,0x70,0x06,0xde,0xff,
+0xff,0x64,0x02,0x13,0xf3,0x5a,0x01,0x20,0xcf,0xf6,0x39,0x01,0x00,0xbd,0x02,0x1e,
+0xf6,0x09,0x00,0xa0,0x2d,0xdd,0xdf,0xff,0x62,0xff,0xff,0xff,0xf6,0x2f,0xa2,0x02,
+0x10,0x6f,0xea,0x00,0x43,0xda,0x50,0x00,0x6f,0x4f,0x01,0x21,0x5d,0xef,0x50,0x01,
+0xc0,0x90,0x00,0x9f,0xf4,0x00,0x00,0x3d,0xff,0xf0,0x00,0xff,0xf0,0xa3,0x01,0x21,
+0xf4,0x03,0x6b,0x04,0x31,0xff,0xf6,0x05,0x08,0x00,0x21,0xef,0xf6,0x1c,0x06,0x01,
+0x08,0x00,0x01,0x18,0x00,0x22,0xf5,0x04,0x43,0x03,0x40,0xf3,0x01,0xff,0xf6,0xef,
+0x03,0xf0,0x04,0xf0,0x00,0xcf,0xff,0x50,0x00,0x5f,0xff,0x90,0x00,0x4f,0xff,0xfe,
+0xdf,0xff,0xfe,0x10,0x00,0x06,0x60,0x00,0xb0,0xe3,0x00,0x00,0x00,0x29,0xdf,0xfe,
+0xb7,0x00,0x00,0x0c,0xb8,0x07,0x50,0xaf,0xf9,0x06,0xff,0xf0,0x07,0x00,0x31,0x01,
+0xff,0xf5,0x29,0x01,0x00,0x5a,0x06,0x50,0xcf,0xf7,0x00,0x5f,0xff,0x94,0x01,0x10,
+0x00,0x80,0x03,0x60,0xff,0xf3,0x00,0x09,0xff,0xb0,0xe0,0x05,0x60,0x03,0xff,0xf1,
+0x07,0xff,0xc0,0x68,0x01,0x10,0x0e,0xb4,0x05,0x32,0x7f,0xfc,0xaf,0xae,0x03,0x60,
+0xff,0xf7,0x00,0x01,0x24,0x7f,0xef,0x02,0x00,0x74,0x03,0x20,0xfa,0x00,0x07,0x00,
+0x91,0xfc,0x50,0x00,0x00,0x8f,0xed,0xb7,0x30,0x00,0x62,0x06,0x32,0xfe,0xda,0x40,
+0x69,0x06,0x40,0xfa,0x00,0x7f,0xff,0xde,0x00,0x30,0x70,0x7f,0xfb,0xdd,0x00,0x30,
+0xe0,0x7f,0xfb,0x9f,0x02,0x40,0xf2,0x7f,0xfb,0x00,0xc7,0x03,0x21,0x7f,0xfb,0x35,
+0x02,0x41,0x7f,0xff,0xdd,0x70,0x07,0x00,0x26,0xff,0x90,0x07,0x00,0x02,0x60,0x05,
+0x0f,0x07,0x00,0x2d,0x80,0x5f,0xff,0xff,0xff,0xd9,0x20,0x00,0x5f,0x8c,0x00,0x00,
+0xe6,0x00,0x00,0xff,0x04,0xa0,0x40,0x5f,0xfe,0x00,0x00,0x4e,0xff,0xc0,0x5f,0xfe,
+0x8c,0x00,0x31,0xf1,0x5f,0xfe,0x8c,0x00,0x42,0x5f,0xff,0xdd,0x90,0x31,0x00,0x41,
+0xb0,0x00,0xdf,0xf5,0x07,0x00,0x02,0x46,0x00,0x00,0x6f,0x02,0x01,0x1e,0x07,0x21,
+0xf0,0x00,0xdd,0x00,0x20,0xa0,0x2d,0x3b,0x07,0x31,0xfe,0x20,0x3f,0x5f,0x01,0x00,
+0x24,0x06,0x20,0xfe,0xb7,0x84,0x08,0x60,0x10,0x00,0x0a,0xff,0x90,0xef,0x4f,0x01,
+0xf0,0x03,0xf8,0x05,0xff,0xf4,0x00,0x0d,0xff,0x60,0x0b,0xff,0xd0,0x00,0xef,0xf5,
+0x00,0x2f,0xff,0x40,0x72,0x05,0x20,0xaf,0xfa,0x86,0x02,0x61,0x05,0xff,0xe1,0xdf,
+0xfa,0x00,0x35,0x04,0x01,0x53,0x0a,0x71,0xfe,0x30,0x00,0x00,0x0f,0xff,0xb6,0x66,
+0x03,0x01,0xd4,0x03,0x3f,0x0f,0xff,0x10,0x0d,0x00,0x23,0x30,0x8f,0xff,0x40,0xab,
+0x01,0x10,0x0c,0x3d,0x0a,0x60,0xef,0xf5,0x02,0xff,0xfb,0x00,0xcb,0x01,0xa1,0x5f,
+0xff,0x60,0x02,0xff,0xf2,0x00,0x09,0xff,0xf2,0x04,0x03,0x20,0xdf,0xfc,0x07,0x02,
+0x00,0x54,0x08,0x30,0xff,0x20,0x00,0x58,0x05,0x11,0xc2,0x23,0x04,0x02,0x4d,0x00,
+0x12,0x1e,0x01,0x08,0x21,0x04,0xff,0x08,0x07,0x00,0x51,0x00,0x20,0x0c,0xdd,0xec,
+0x00,0x22,0xe1,0x0f,0x9e,0x03,0x03,0x07,0x00,0x81,0x9f,0xff,0xff,0xff,0xfd,0x92,
+0x00,0x9f,0x0e,0x00,0x21,0x40,0x7d,0x77,0x04,0x12,0xe0,0x23,0x01,0x11,0xf3,0x2f,
+0x04,0x00,0x5b,0x02,0x01,0xe4,0x03,0x30,0x06,0x77,0x10,0x24,0x07,0x00,0xec,0x06,
+0x30,0x01,0xff,0xf1,0x07,0x00,0x30,0x07,0xff,0xc0,0x07,0x00,0x30,0x1e,0xff,0x70,
+0x07,0x00,0xf0,0x08,0xcf,0xfe,0x00,0x0f,0xff,0x30,0x1b,0xff,0xf5,0x00,0x0f,0xff,
+0x33,0xef,0xff,0x70,0x00,0x0f,0xff,0x36,0xff,0xf7,0x00,0x07,0x00,0x20,0xfe,0x40,
 0x07,0x00,0x10,0x35,0x85,0x04,0x01,0x2b,0x07,0x0f,0x07,0x00,0x04,0x00,0xfb,0x05,
-0x1c,0x92,0xfb,0x05,0x03,0xc1,0x00,0x2f,0x8f,0xfc,0xfb,0x05,0x29,0x00,0x56,0x1c,
-0x20,0xaf,0xf9,0xde,0x03,0x40,0xff,0xf4,0x00,0x0b,0x30,0x04,0x10,0xf3,0x1e,0x03,
-0x20,0xcf,0xf6,0x83,0x05,0x40,0xbf,0xf9,0x00,0x0d,0xc4,0x1b,0x10,0xf0,0x34,0x09,
-0x00,0x66,0x01,0x10,0xfe,0x42,0x03,0xc0,0x3f,0xff,0x10,0x07,0xff,0xc0,0x02,0xff,
-0xf2,0x1b,0xff,0xd0,0x74,0x34,0x20,0x0f,0xff,0xe0,0x24,0x30,0x0c,0xff,0x70,0xcb,
-0x25,0x11,0xe6,0x78,0x18,0x40,0x09,0xff,0xe8,0x40,0xe2,0x09,0x50,0x10,0x00,0x6f,
-0xfd,0x00,0x34,0x30,0x10,0xb0,0x4a,0x09,0x00,0x81,0x05,0x10,0xf3,0xd4,0x00,0x11,
-0xdd,0xec,0x33,0x03,0x97,0x0c,0x12,0xc4,0x9e,0x36,0x22,0xdb,0x96,0x95,0x22,0x02,
-0x4e,0x30,0x22,0x2f,0xff,0x5d,0x30,0x41,0x2d,0xdf,0xff,0xed,0x95,0x08,0x00,0xae,
-0x35,0x00,0x96,0x08,0x00,0x08,0x00,0x11,0x02,0xce,0x26,0x11,0x30,0x00,0x03,0x11,
-0x0e,0x61,0x08,0x04,0x08,0x00,0x15,0xf5,0x08,0x00,0x03,0x79,0x08,0x01,0x93,0x38,
-0x00,0x08,0x00,0x21,0x8f,0xff,0xab,0x01,0x31,0x3e,0xff,0xfc,0x08,0x00,0x32,0x4f,
-0xff,0xf4,0x08,0x00,0x31,0xeb,0x40,0x00,0x20,0x00,0xf0,0x08,0x67,0x71,0x04,0x77,
-0x30,0x1f,0xff,0x00,0xdf,0xf3,0x04,0xff,0xa0,0x0f,0xfd,0x00,0x8f,0xf4,0x04,0xff,
-0x80,0x0b,0xfe,0x35,0x0b,0x40,0xff,0x80,0x0b,0xfc,0xa2,0x0f,0xf1,0x0f,0xef,0x60,
-0x06,0xfc,0x00,0x2f,0xf1,0x00,0x03,0xbd,0x91,0x01,0xff,0xff,0xc0,0x5f,0xff,0xff,
-0x16,0xff,0xff,0xf1,0x2f,0xff,0xfd,0x00,0x5d,0xfc,0x20,0x35,0x00,0x26,0x20,0xfe,
-0x93,0x0d,0x26,0x00,0xf2,0x33,0x91,0x02,0x8d,0xff,0xff,0xfa,0x40,0x00,0x03,0x8d,
-0xf1,0x16,0xf0,0x00,0x06,0xff,0xfd,0x00,0x05,0xaf,0xff,0xff,0xa2,0xaf,0xff,0xff,
-0xe8,0x20,0x6f,0x0c,0x34,0x20,0x06,0xfd,0x22,0x10,0x12,0x34,0x9a,0x0a,0x00,0xec,
-0x00,0x11,0x5f,0x0d,0x01,0x00,0x13,0x19,0x03,0xf3,0x14,0x0c,0x6c,0x17,0x24,0x7b,
-0xe8,0x0b,0x00,0x24,0x49,0xdf,0x28,0x19,0x11,0x16,0x16,0x12,0x01,0xaa,0x0a,0x12,
-0x8c,0x5d,0x06,0x01,0xb6,0x35,0x15,0xff,0x0c,0x00,0x26,0xef,0xff,0x0c,0x00,0x03,
-0x0a,0x00,0x15,0xaf,0x0c,0x00,0x33,0xd8,0x40,0x0f,0x0c,0x00,0x42,0xfb,0x62,0x00,
-0x00,0x0c,0x00,0x22,0xfe,0x94,0x78,0x02,0x12,0x00,0x96,0x3a,0x0f,0x0c,0x00,0x2a,
-0x34,0x3a,0xdf,0xdf,0x0c,0x00,0x14,0x06,0x84,0x00,0x13,0xf0,0x12,0x1b,0x34,0x03,
-0xad,0xfd,0x0c,0x00,0x10,0xfe,0x24,0x06,0x03,0x24,0x00,0x00,0x46,0x21,0x02,0x3c,
-0x00,0x53,0xef,0xea,0x30,0xef,0xff,0x73,0x03,0x12,0x00,0xd2,0x24,0x03,0x68,0x14,
-0x00,0x9c,0x24,0x14,0xa3,0x0c,0x01,0x34,0xb7,0x00,0xbf,0x38,0x10,0x43,0x7b,0xfd,
-0x88,0xef,0xb1,0x10,0x10,0x88,0x5b,0x02,0x10,0xb4,0x74,0x1a,0x11,0x5f,0xaa,0x25,
-0x03,0xa1,0x13,0x62,0xf5,0x00,0x9f,0xf8,0x00,0xbf,0x0c,0x00,0x38,0xf4,0x00,0x8f,
-0x18,0x00,0x02,0xf3,0x2a,0x02,0x34,0x1d,0x40,0xfd,0x88,0xef,0xa2,0x78,0x10,0x56,
-0x3f,0xfb,0x88,0xdf,0xf8,0x60,0x00,0x18,0x8f,0x0c,0x00,0x08,0x24,0x00,0x08,0x3c,
-0x00,0x0f,0x6c,0x00,0x14,0x05,0x9c,0x00,0x08,0xb4,0x00,0x08,0xcc,0x00,0x71,0x14,
-0x44,0x44,0x10,0x03,0x44,0x44,0x7d,0x1b,0x53,0xef,0xff,0xff,0xe0,0x6f,0x29,0x11,
-0x00,0x1f,0x01,0x14,0x8f,0xd5,0x01,0x0f,0x0c,0x00,0x10,0x73,0x7b,0xbb,0xbb,0x60,
-0x2a,0xbb,0xbb,0x6b,0x1b,0x06,0x01,0x00,0x00,0x8b,0x36,0x13,0x4f,0x7a,0x00,0x0f,
-0x54,0x00,0x1d,0x08,0x3c,0x00,0x08,0x54,0x00,0x0f,0xb4,0x00,0x4b,0x16,0xbd,0x97,
-0x37,0x02,0xec,0x3a,0x04,0xb5,0x1c,0x16,0xfd,0x17,0x00,0x06,0x0c,0x00,0x11,0xcf,
-0x46,0x0e,0x05,0x17,0x00,0x36,0x10,0x02,0xdb,0x17,0x00,0x34,0x2e,0xff,0xc0,0x17,
-0x00,0x45,0x00,0xdf,0xff,0xfc,0x2e,0x00,0x10,0xdf,0xad,0x03,0x02,0x17,0x00,0x00,
-0xab,0x0d,0x14,0xfc,0x45,0x00,0x00,0xab,0x21,0x12,0xcc,0x17,0x00,0x04,0x75,0x18,
-0x12,0xd1,0x96,0x10,0x01,0xb0,0x14,0x03,0x74,0x11,0x15,0x1d,0x17,0x00,0x01,0x19,
-0x00,0x04,0x17,0x00,0x00,0x19,0x00,0x16,0xd1,0x48,0x38,0x23,0xcc,0x10,0x09,0x00,
-0x11,0x41,0xca,0x02,0x41,0x30,0x01,0xdf,0xd1,0x3e,0x14,0x41,0x70,0xcf,0xff,0xd1,
-0xab,0x06,0x10,0x4e,0x46,0x00,0x20,0x07,0xff,0x23,0x36,0x60,0xff,0xd1,0x07,0xff,
-0xff,0xfb,0xb7,0x13,0x11,0xd8,0x6a,0x01,0x14,0x4f,0x72,0x01,0x14,0x4f,0x7a,0x01,
-0x13,0x4f,0xb8,0x1a,0x13,0x07,0x7c,0x00,0x13,0x07,0x9c,0x00,0x13,0x07,0xa5,0x00,
+0x1c,0x92,0xfb,0x05,0x03,0xc1,0x00,0x2f,0x8f,0xfc,0xfb,0x05,0x29,0x60,0x3f,0xff,
+0x10,0x00,0xaf,0xf9,0xde,0x03,0x40,0xff,0xf4,0x00,0x0b,0x30,0x04,0x10,0xf3,0x1e,
+0x03,0x20,0xcf,0xf6,0x83,0x05,0x90,0xbf,0xf9,0x00,0x0d,0xff,0x50,0x04,0xff,0xf0,
+0x34,0x09,0x00,0x66,0x01,0x10,0xfe,0x42,0x03,0xf0,0x18,0x3f,0xff,0x10,0x07,0xff,
+0xc0,0x02,0xff,0xf2,0x1b,0xff,0xd0,0x00,0x9f,0xfa,0x00,0x0f,0xff,0xef,0xff,0xf5,
+0x00,0x0c,0xff,0x70,0x00,0xcf,0xff,0xff,0xe6,0x00,0x00,0xff,0xf4,0x00,0x09,0xff,
+0xe8,0x40,0xe2,0x09,0x30,0x10,0x00,0x6f,0x98,0x00,0x30,0x2e,0xff,0xb0,0x4a,0x09,
+0x00,0x81,0x05,0x10,0xf3,0xd4,0x00,0x20,0xdd,0xef,0xa7,0x02,0x03,0x97,0x0c,0x11,
+0xc4,0xc4,0x05,0x43,0xfe,0xdb,0x96,0x20,0xeb,0x05,0x00,0xfd,0x06,0x00,0x08,0x00,
+0x00,0x1a,0x05,0x41,0x2d,0xdf,0xff,0xed,0x95,0x08,0x31,0x0e,0xff,0x30,0x96,0x08,
+0x00,0x08,0x00,0x00,0xea,0x01,0x00,0x08,0x00,0x00,0xba,0x02,0x11,0x0e,0x61,0x08,
+0x04,0x08,0x00,0x15,0xf5,0x08,0x00,0x13,0x0f,0x08,0x00,0x00,0x18,0x0a,0x00,0x08,
+0x00,0x21,0x8f,0xff,0xab,0x01,0x31,0x3e,0xff,0xfc,0x08,0x00,0x32,0x4f,0xff,0xf4,
+0x08,0x00,0x31,0xeb,0x40,0x00,0x20,0x00,0xf0,0x08,0x67,0x71,0x04,0x77,0x30,0x1f,
+0xff,0x00,0xdf,0xf3,0x04,0xff,0xa0,0x0f,0xfd,0x00,0x8f,0xf4,0x04,0xff,0x80,0x0b,
+0xfe,0x35,0x0b,0xf0,0x18,0xff,0x80,0x0b,0xfc,0x00,0x2f,0xf2,0x00,0xef,0x60,0x06,
+0xfc,0x00,0x2f,0xf1,0x00,0x03,0xbd,0x91,0x01,0xff,0xff,0xc0,0x5f,0xff,0xff,0x16,
+0xff,0xff,0xf1,0x2f,0xff,0xfd,0x00,0x5d,0xfc,0x20,0x35,0x00,0x78,0x06,0x30,0xfe,
+0x93,0x00,0xf7,0x00,0xd0,0xfc,0x61,0x00,0x02,0x8d,0xff,0xff,0xfa,0x40,0x00,0x03,
+0x8d,0xff,0x6e,0x02,0xf2,0x0b,0x06,0xff,0xfd,0x00,0x05,0xaf,0xff,0xff,0xa2,0xaf,
+0xff,0xff,0xe8,0x20,0x6f,0xff,0xfb,0x50,0x00,0x06,0xfd,0x71,0x00,0x00,0x00,0x34,
+0x9a,0x0a,0x00,0xec,0x00,0x11,0x5f,0x0d,0x01,0x6f,0xbb,0xbb,0xbb,0xbb,0xb8,0x00,
+0x01,0x00,0x01,0x34,0x02,0x7b,0xe8,0x0b,0x00,0x42,0x49,0xdf,0xff,0xff,0x0a,0x00,
+0x20,0x16,0xbf,0x36,0x00,0x01,0xaa,0x0a,0x33,0x8c,0xff,0xff,0x0c,0x00,0x35,0x3a,
+0xef,0xff,0x0c,0x00,0x26,0xef,0xff,0x0c,0x00,0x03,0x0a,0x00,0x15,0xaf,0x0c,0x00,
+0x33,0xd8,0x40,0x0f,0x0c,0x00,0x42,0xfb,0x62,0x00,0x00,0x0c,0x00,0x44,0xfe,0x94,
+0x00,0x00,0x0c,0x00,0x2f,0xf0,0x00,0x0c,0x00,0x2b,0x34,0x3a,0xdf,0xdf,0x0c,0x00,
+0x01,0xa6,0x05,0x03,0x0c,0x00,0x10,0x0e,0x0c,0x00,0x34,0x03,0xad,0xfd,0x0c,0x00,
+0x10,0xfe,0x24,0x06,0x03,0x24,0x00,0x21,0xf6,0xef,0x0c,0x00,0x00,0xc5,0x00,0x20,
+0xea,0x30,0x0c,0x00,0x14,0xe0,0x22,0x0d,0x01,0xd0,0x0b,0x12,0x00,0x96,0x0b,0x34,
+0xae,0xfe,0xa3,0x0c,0x01,0x32,0xb7,0x00,0xbf,0xd7,0x00,0x53,0xf4,0x00,0x7b,0xfd,
+0x88,0xef,0x00,0x20,0xfb,0x88,0x5b,0x02,0x50,0xb4,0x44,0x44,0x44,0x44,0x57,0x01,
+0x41,0xf9,0x00,0xcf,0x80,0x9a,0x00,0x62,0xf5,0x00,0x9f,0xf8,0x00,0xbf,0x0c,0x00,
+0x38,0xf4,0x00,0x8f,0x18,0x00,0x13,0xff,0xfb,0x0a,0x10,0x0f,0xf7,0x03,0xc6,0x88,
+0xef,0xa2,0x22,0x22,0x22,0x22,0x3f,0xfb,0x88,0xdf,0xf8,0x60,0x00,0x18,0x8f,0x0c,
+0x00,0x08,0x24,0x00,0x08,0x3c,0x00,0x0f,0x6c,0x00,0x14,0x05,0x9c,0x00,0x08,0xb4,
+0x00,0x03,0xcc,0x00,0x50,0xff,0xff,0xf4,0x00,0x7b,0x61,0x14,0x44,0x44,0x10,0x03,
+0x44,0x01,0x00,0x71,0x41,0xef,0xff,0xff,0xe0,0x6f,0xff,0x01,0x00,0x75,0xfe,0xff,
+0xff,0xff,0xf0,0x8f,0xff,0x01,0x00,0x0f,0x0c,0x00,0x0e,0x61,0x7b,0xbb,0xbb,0x60,
+0x2a,0xbb,0x01,0x00,0x27,0xb7,0x00,0x01,0x00,0x52,0xbf,0xff,0xff,0xb0,0x4f,0x23,
+0x00,0x1f,0xfb,0x54,0x00,0x1d,0x08,0x3c,0x00,0x08,0x54,0x00,0x0f,0xb4,0x00,0x4b,
+0x25,0xbd,0x20,0x0b,0x00,0x35,0x0c,0xff,0xe2,0x0c,0x00,0x36,0xcf,0xff,0xfd,0x17,
+0x00,0x26,0xff,0xfd,0x17,0x00,0x27,0xff,0xd1,0x17,0x00,0x36,0x10,0x02,0xdb,0x17,
+0x00,0x34,0x2e,0xff,0xc0,0x17,0x00,0x45,0x00,0xdf,0xff,0xfc,0x2e,0x00,0x43,0xdf,
+0xff,0xff,0xc0,0x17,0x00,0x54,0x00,0x1d,0xff,0xff,0xfc,0x45,0x00,0x52,0x01,0xdf,
+0xff,0xff,0xcc,0x17,0x00,0x01,0x19,0x00,0x14,0xff,0x5c,0x00,0x00,0x19,0x00,0x03,
+0x17,0x00,0x02,0x19,0x00,0x04,0x73,0x00,0x25,0x01,0xdf,0x17,0x00,0x00,0x19,0x00,
+0x15,0xd1,0xae,0x00,0x33,0x01,0xcc,0x10,0x09,0x00,0x10,0x41,0x06,0x00,0x40,0x03,
+0x30,0x01,0xdf,0x1d,0x00,0x60,0x07,0xff,0x70,0xcf,0xff,0xd1,0x08,0x00,0x50,0xff,
+0x4e,0xff,0xff,0xd1,0x08,0x00,0x60,0xf6,0x4f,0xff,0xff,0xd1,0x07,0x62,0x01,0x41,
+0x4f,0xff,0xff,0xd8,0x6a,0x01,0x14,0x4f,0x72,0x01,0x14,0x4f,0x7a,0x01,0x10,0x4f,
+0xa6,0x00,0x01,0x40,0x00,0x02,0x7c,0x00,0x13,0x07,0x9c,0x00,0x13,0x07,0xa5,0x00,
 0x00,0x40,0x00,0x17,0x5f,0x48,0x00,0x14,0xd1,0x48,0x00,0x13,0x7a,0x48,0x00,0x22,
-0xf3,0x0b,0x48,0x00,0x16,0xf4,0x03,0x13,0x07,0x24,0x0e,0x16,0x00,0x9c,0x2a,0x00,
-0xf9,0x06,0x10,0x60,0x0c,0x00,0x11,0x07,0x9d,0x2a,0x20,0xcf,0xf3,0x0c,0x00,0x12,
-0x5f,0x2a,0x20,0x10,0xfb,0x0c,0x00,0x21,0xcf,0xff,0xa4,0x10,0x10,0xf6,0x0c,0x00,
-0x30,0x7f,0xff,0xf7,0xf5,0x1b,0x00,0x30,0x00,0x00,0x34,0x2c,0x21,0x20,0x0a,0x26,
-0x2d,0x00,0x1b,0x22,0x00,0x8e,0x1b,0x12,0xe0,0x0c,0x00,0x10,0x1f,0xc2,0x32,0x11,
-0x90,0x0c,0x00,0x00,0x7f,0x20,0x00,0xd9,0x07,0x00,0x0c,0x00,0x00,0x3f,0x3c,0x31,
-0x9f,0xff,0x20,0x0c,0x00,0x00,0xe4,0x06,0x02,0x0c,0x00,0x11,0xfc,0xf0,0x0b,0x01,
-0x24,0x00,0x21,0x37,0x72,0x24,0x00,0x13,0x5f,0x6c,0x1a,0x00,0x0e,0x2c,0x14,0x1f,
-0x27,0x04,0x10,0x1f,0x13,0x22,0x14,0xf8,0x68,0x15,0x11,0xa0,0x84,0x00,0x01,0x17,
-0x01,0x00,0xf7,0x19,0x01,0x19,0x00,0x41,0x01,0x9f,0xff,0xf8,0x6d,0x2d,0x32,0xe8,
-0x42,0x24,0x11,0x2f,0x01,0xc5,0x01,0x01,0x01,0x3c,0x03,0xa0,0x40,0x05,0x5e,0x17,
-0x10,0x3b,0x0b,0x00,0x13,0xb3,0xfe,0x00,0x45,0x15,0x89,0x97,0x51,0xef,0x14,0x35,
-0x89,0x98,0x40,0xf0,0x1f,0x03,0x96,0x17,0x0c,0x0c,0x00,0x14,0x4f,0xe7,0x15,0x21,
-0x0c,0xc3,0xfe,0x38,0x33,0xc2,0x3c,0xc0,0x91,0x13,0x02,0x9a,0x37,0x16,0x03,0xf9,
-0x02,0x26,0x30,0x0a,0x0c,0x00,0x11,0xa0,0x7f,0x08,0x21,0x94,0x49,0x11,0x03,0x21,
-0x06,0xef,0x45,0x00,0x11,0x4f,0x2a,0x1a,0x11,0x1e,0x97,0x00,0x11,0x09,0x37,0x13,
-0x22,0x0f,0xff,0x54,0x2e,0x2a,0xff,0xf0,0x0c,0x00,0x07,0x24,0x00,0x08,0x3c,0x00,
-0x08,0x54,0x00,0x08,0x6c,0x00,0x08,0x84,0x00,0x08,0x9c,0x00,0x09,0xb4,0x00,0x08,
-0xcc,0x00,0x0f,0xf0,0x00,0x08,0x07,0x14,0x01,0x00,0x04,0x13,0x44,0x10,0x00,0x02,
-0x44,0xb1,0x03,0x32,0x5f,0xfe,0x40,0x66,0x22,0x03,0x07,0x1f,0x24,0x70,0x0e,0xb0,
-0x01,0x10,0xaf,0x86,0x00,0x22,0xef,0xfe,0x12,0x03,0x62,0xcf,0xff,0xb3,0xbf,0xff,
-0xce,0x1b,0x00,0x20,0x03,0xef,0x2b,0x0c,0x00,0x6f,0x20,0x02,0x05,0x42,0x42,0x60,
-0x5d,0x50,0x6f,0x0d,0x06,0xa1,0x08,0xff,0xfe,0x30,0x8f,0xff,0x80,0x3e,0xff,0xfe,
-0xa9,0x10,0x90,0xfd,0x20,0xaf,0xff,0xff,0xa0,0x2d,0xff,0xfb,0x19,0x22,0x11,0xfb,
-0x2e,0x29,0xa1,0xc1,0x0b,0xff,0xfd,0x20,0x4f,0xff,0xf8,0x03,0xef,0xbc,0x0a,0x44,
-0x08,0xff,0xfe,0x4e,0x3e,0x38,0x00,0x08,0x00,0x44,0xfe,0x4f,0xe3,0x08,0xea,0x00,
-0x64,0x03,0xef,0x40,0x41,0x07,0xff,0x51,0x16,0x27,0x01,0x40,0xa2,0x01,0x12,0x80,
-0x8c,0x2f,0x53,0xff,0xeb,0xbb,0xef,0xff,0x6a,0x09,0x00,0x06,0x01,0x17,0x04,0x1b,
-0x00,0x3f,0x40,0x00,0x4f,0x1b,0x00,0x0f,0x21,0x7f,0xff,0x6f,0x26,0x02,0x1c,0x18,
-0xa3,0x03,0xbb,0xbb,0xba,0x10,0x00,0x1a,0xbb,0xbb,0xb3,0x23,0x17,0x3e,0xdd,0xdd,
-0x90,0x59,0x01,0x0f,0x0c,0x00,0x41,0x20,0xad,0xdd,0x23,0x44,0x00,0x17,0x1b,0x03,
-0x78,0x09,0x03,0x2c,0x05,0x03,0x4e,0x17,0x15,0xd1,0xcf,0x04,0x04,0xb9,0x04,0x16,
-0x1d,0xe7,0x04,0x01,0x19,0x00,0x05,0xd0,0x04,0x13,0x1d,0x17,0x00,0xd0,0x25,0x55,
-0x55,0x55,0x11,0xdf,0xfd,0x11,0x55,0x55,0x55,0x52,0xef,0x2c,0x00,0x32,0x1d,0xd1,
-0x1d,0xee,0x05,0x00,0x2d,0x00,0x04,0x56,0x03,0x00,0x13,0x07,0x2f,0x9f,0xff,0x01,
-0x00,0x05,0x35,0x71,0xe7,0x1e,0x0c,0x00,0x43,0xb6,0xfb,0x6f,0xff,0x00,0x07,0x03,
-0xe8,0x04,0x13,0x03,0x3c,0x1c,0x21,0xd3,0x00,0x10,0x2f,0x17,0xff,0x36,0x16,0x05,
-0xca,0x1f,0x00,0xbd,0x14,0x04,0x45,0x1b,0x10,0x4f,0xa4,0x0e,0x14,0x1e,0x11,0x22,
-0x41,0x9f,0xfe,0x10,0x00,0xf4,0x33,0x04,0xaa,0x38,0x00,0xb0,0x0c,0x04,0xef,0x1f,
-0x23,0xf5,0x01,0xd3,0x1b,0x01,0x43,0x17,0x26,0xe1,0xaf,0x64,0x22,0x34,0x0e,0xff,
-0xaf,0x02,0x04,0x05,0x65,0x00,0x00,0x83,0x04,0x16,0x2f,0xd0,0x00,0x05,0x27,0x04,
-0x0f,0x01,0x00,0x22,0x18,0xdf,0x0d,0x00,0x28,0xd3,0xdf,0x0d,0x00,0x06,0x40,0x03,
-0x21,0x03,0x32,0x06,0x00,0x33,0x67,0x75,0x20,0x0b,0x23,0x10,0x29,0x56,0x01,0x11,
-0x70,0x0c,0x00,0x12,0x08,0x56,0x07,0x50,0x60,0x3f,0xff,0x00,0x01,0x1d,0x40,0x00,
-0x10,0x1d,0x20,0x3f,0xff,0xd4,0x04,0x11,0xb4,0xfc,0x3d,0x64,0xdf,0xff,0x00,0xaf,
-0xff,0xe4,0xb0,0x3c,0x13,0x04,0xba,0x01,0x00,0xcd,0x06,0x11,0x0c,0x39,0x0c,0x11,
-0x06,0xb3,0x34,0x15,0x1f,0xac,0x02,0x22,0xff,0xff,0xc1,0x2f,0x02,0x09,0x03,0x21,
-0x04,0x43,0x6e,0x01,0x00,0xc5,0x07,0x2f,0x43,0x00,0x01,0x00,0x04,0x10,0x34,0x1e,
-0x00,0x02,0x0a,0x00,0x23,0x40,0xff,0x6b,0x38,0x00,0x02,0x3e,0x07,0x39,0x03,0x72,
-0xf1,0xff,0xff,0xfd,0xee,0xff,0x60,0x3d,0x3e,0x03,0x28,0x08,0x00,0x48,0x02,0x14,
-0x40,0xe8,0x00,0x40,0x4e,0xff,0xfa,0x00,0x2d,0x02,0x40,0xb5,0x00,0x00,0x4b,0xfe,
-0x12,0x31,0xff,0xf3,0xbf,0xcc,0x00,0x00,0x41,0x2a,0x34,0xff,0xf3,0x06,0x85,0x03,
-0x00,0x4f,0x0c,0x10,0x17,0x25,0x01,0x13,0xa2,0xd3,0x24,0x22,0x02,0x67,0x2a,0x18,
-0x2b,0x23,0x30,0xa2,0x3f,0x30,0xa7,0x00,0x00,0xab,0x11,0x02,0x4a,0x04,0x01,0x0b,
-0x00,0x50,0xff,0x14,0x44,0x44,0xcf,0x5a,0x2e,0x0f,0x01,0x00,0x1a,0x00,0x7f,0x08,
-0x01,0xad,0x0a,0x00,0x50,0x0f,0x02,0x9f,0x0b,0x02,0x96,0x31,0x01,0xac,0x0b,0x02,
-0xc7,0x04,0x02,0x52,0x01,0x1c,0x96,0x42,0x25,0x25,0xcf,0xff,0x72,0x08,0x00,0x04,
-0x05,0x55,0x33,0x33,0xcf,0xff,0xff,0x70,0x03,0x33,0x00,0x4a,0x20,0x8b,0x0b,0x23,
-0xcf,0xe1,0x09,0x00,0x23,0x3e,0xfa,0x09,0x00,0x23,0x06,0xfe,0x09,0x00,0x14,0x05,
-0x09,0x00,0x24,0x2e,0xfa,0x2d,0x00,0x13,0xf2,0x09,0x00,0x53,0x5b,0x30,0x7c,0xcc,
-0xcc,0xee,0x0b,0x04,0x9c,0x00,0x06,0x9f,0x00,0x05,0xa2,0x00,0x05,0xa5,0x00,0x00,
-0x01,0x00,0x19,0x21,0x23,0x01,0x19,0x30,0xe3,0x07,0x17,0xb1,0x0d,0x00,0x14,0x07,
-0xea,0x03,0x12,0x1a,0x24,0x42,0x24,0xd0,0x00,0x4d,0x01,0x32,0x06,0x30,0x05,0x5c,
-0x2f,0x10,0x1c,0x2b,0x11,0x00,0xa2,0x23,0x12,0x40,0x5c,0x01,0x10,0x00,0xf3,0x0d,
-0x60,0x0c,0xfc,0x01,0x44,0x44,0x4c,0x65,0x04,0x00,0xd5,0x46,0x23,0x4f,0xf3,0xdd,
-0x25,0x72,0x5a,0x20,0x0c,0xfb,0x00,0xdf,0x8f,0xd6,0x09,0x75,0x0c,0xfe,0x20,0x4f,
-0xf1,0x08,0xfb,0xd8,0x00,0x53,0x00,0xff,0x50,0x5f,0xef,0xd8,0x3e,0x65,0x6f,0xe0,
-0x0c,0xf7,0x04,0xff,0x05,0x01,0x43,0x00,0xcf,0x70,0x4f,0x0c,0x0a,0x55,0x02,0xef,
-0xa0,0x0f,0xf5,0x17,0x01,0x72,0xcf,0xe2,0x04,0xff,0x10,0x9f,0xbf,0x1b,0x00,0x75,
-0x04,0xa2,0x00,0xcf,0xb0,0x0d,0xf8,0xa7,0x01,0x51,0xaf,0xf3,0x04,0xff,0x30,0x09,
-0x01,0x11,0xf0,0xe6,0x11,0x24,0xcf,0xc0,0x17,0x01,0x41,0x3f,0xf7,0x00,0x6f,0xf4,
-0x03,0x01,0x16,0x10,0x47,0x53,0x00,0x4f,0xfa,0x20,0x01,0x27,0x6f,0xfd,0xfc,0x1b,
-0x27,0x7f,0xfd,0x3a,0x1b,0x28,0x09,0xfb,0x47,0x1b,0x00,0x1d,0x20,0x1f,0x3d,0xb2,
-0x03,0x02,0x00,0x83,0x37,0x16,0xca,0x5e,0x02,0x15,0xf6,0x9b,0x1c,0x00,0x48,0x0a,
-0x26,0x04,0xff,0xa3,0x04,0x01,0xbc,0x14,0x12,0x9f,0xbd,0x04,0x10,0x08,0xe0,0x0b,
-0x11,0x04,0xf3,0x0d,0x24,0x42,0x8f,0x2a,0x06,0x04,0xf7,0x0b,0x03,0x36,0x00,0x11,
-0x6b,0xd3,0x07,0x01,0x19,0x00,0x12,0xf4,0x20,0x49,0x21,0x00,0x0f,0x2b,0x00,0x23,
-0x0b,0x40,0x0c,0x00,0x1f,0xf4,0xfa,0x05,0x10,0x0f,0x74,0x04,0x03,0x2a,0xfd,0x3d,
-0x71,0x04,0x24,0x0c,0xe3,0x48,0x02,0x14,0xa0,0x1a,0x0c,0x04,0xcf,0x40,0x13,0xf6,
-0x1f,0x05,0x02,0x0f,0x02,0x11,0x01,0x4f,0x31,0x02,0x17,0x05,0x13,0xfe,0x16,0x08,
-0x01,0xe3,0x06,0x13,0x1e,0xbc,0x00,0x02,0x15,0x05,0x13,0xe0,0x37,0x48,0x00,0x02,
-0x2b,0x03,0x3d,0x05,0x13,0x5f,0x38,0x05,0x04,0x36,0x05,0x14,0xe0,0x34,0x01,0x32,
-0x2f,0xff,0x2d,0xf9,0x00,0x13,0xef,0x9b,0x25,0x32,0x3c,0xff,0x44,0xaa,0x25,0x31,
-0x8f,0xfc,0x07,0x23,0x01,0x50,0x01,0xff,0xf9,0x02,0x7c,0x79,0x00,0x50,0x07,0xff,
-0xfb,0x40,0x6f,0xb0,0x09,0x14,0x0a,0xb0,0x06,0x13,0x08,0x8d,0x41,0x00,0x6c,0x0f,
-0x20,0xda,0x40,0x8b,0x04,0x01,0xdb,0x05,0x00,0x2c,0x15,0x00,0x57,0x42,0x01,0xbe,
-0x00,0x12,0x2d,0x36,0x0e,0x12,0x2e,0x4c,0x23,0x01,0xcc,0x12,0x03,0xd0,0x4b,0x13,
-0xf6,0x63,0x23,0x22,0x60,0x6f,0xbc,0x01,0x1e,0x8f,0x9d,0x05,0x0e,0x01,0x00,0x13,
-0x8e,0xe9,0x01,0x13,0x1d,0x8f,0x41,0x13,0x1c,0xf8,0x01,0x13,0x0b,0x9e,0x41,0x13,
-0x0a,0xb5,0x23,0x12,0x09,0x0f,0x00,0x01,0x52,0x05,0x11,0xf6,0x51,0x03,0x30,0xea,
-0xbb,0x30,0x64,0x01,0x17,0xb4,0x57,0x02,0x15,0xdf,0x5f,0x1e,0x36,0xdf,0xff,0xe6,
-0xb6,0x01,0x13,0xfc,0xa6,0x03,0x06,0xe1,0x25,0x12,0x0f,0xd7,0x13,0x04,0x15,0x00,
-0x02,0x21,0x21,0x03,0xe0,0x01,0x16,0xa2,0xd8,0x0f,0x16,0xf8,0xf5,0x01,0x13,0xfe,
-0xc6,0x16,0x01,0x82,0x1c,0x06,0x0a,0x02,0x16,0xf5,0xca,0x00,0x06,0xb6,0x02,0x16,
-0xfe,0x15,0x00,0x15,0x6f,0x7c,0x07,0x14,0x20,0x0a,0x00,0x36,0xe5,0x00,0x0f,0x10,
-0x09,0x04,0x1d,0x00,0x04,0x69,0x00,0x15,0xd4,0x93,0x00,0x14,0x70,0xa8,0x00,0x12,
-0xfa,0x3a,0x03,0x06,0xcd,0x06,0x15,0x0d,0xe5,0x24,0x4e,0x00,0x3d,0xf9,0x10,0x4b,
-0x06,0x51,0x19,0xcc,0xcc,0xc9,0x10,0x06,0x00,0x11,0x1b,0xf5,0x07,0x14,0x0b,0x9b,
-0x35,0x16,0xf0,0xc3,0x00,0x06,0xcd,0x02,0x0f,0x15,0x00,0x86,0x11,0xfe,0x1b,0x2b,
-0x01,0xce,0x10,0x11,0x5f,0x28,0x03,0x01,0x06,0x00,0x41,0x13,0x33,0x33,0x10,0x08,
-0x06,0x11,0x10,0x50,0x07,0x01,0x19,0x0f,0x16,0x06,0x30,0x04,0x1e,0xef,0x8f,0x01,
-0x0f,0x01,0x00,0x97,0x06,0xab,0x09,0x33,0xb1,0x8b,0xbb,0x01,0x00,0x21,0x81,0x04,
-0xd4,0x01,0x21,0x44,0x3b,0x4e,0x05,0x12,0x5f,0x23,0x26,0x03,0xec,0x47,0x02,0x0a,
-0x18,0x22,0x40,0x00,0x00,0x01,0x04,0x19,0x18,0x13,0x60,0x0f,0x01,0x13,0x70,0x7c,
-0x02,0x2f,0x86,0xff,0x88,0x03,0x10,0x22,0xfd,0x8f,0x1f,0x14,0x13,0x16,0x26,0x14,
-0x12,0x6f,0x30,0x0a,0x13,0x06,0xda,0x29,0x12,0x6f,0x0d,0x03,0x13,0x06,0x36,0x03,
-0x11,0x6f,0x7e,0x45,0x00,0x7a,0x32,0x11,0xb5,0xd5,0x0d,0x11,0xba,0xa4,0x00,0x15,
-0x37,0x0d,0x07,0x00,0xf1,0x2f,0x07,0xb5,0x0d,0x14,0x40,0xc8,0x2a,0x15,0xff,0xb6,
-0x2a,0x12,0x2f,0xc7,0x4a,0x01,0xd2,0x27,0x02,0xc5,0x3d,0x06,0x3a,0x0b,0x01,0xea,
-0x00,0x13,0x0c,0xe4,0x26,0x06,0x0b,0x00,0x00,0x0c,0x00,0x16,0x0b,0xcb,0x0a,0x26,
-0x08,0xff,0x5d,0x0d,0x07,0xf1,0x10,0x16,0x0d,0xd3,0x00,0x06,0x63,0x06,0x19,0xfd,
-0xa7,0x07,0x24,0x04,0x44,0x01,0x00,0x27,0x00,0x0b,0x1c,0x0b,0x07,0x45,0x00,0x07,
-0xea,0x05,0x08,0x17,0x00,0x16,0x0e,0xe2,0x03,0x34,0x00,0x4b,0xbb,0x01,0x00,0x02,
-0xde,0x00,0x12,0x20,0x02,0x08,0x12,0xb0,0xce,0x05,0x11,0x80,0x06,0x00,0x11,0xf8,
-0x06,0x00,0x1f,0xfa,0x06,0x00,0x0e,0x36,0x8f,0xff,0xfa,0xe4,0x46,0x1f,0x0a,0x07,
-0x00,0x19,0x22,0x80,0x00,0x10,0x2b,0x00,0x07,0x00,0x12,0xfb,0xd4,0x14,0x04,0x8b,
-0x00,0x22,0xbf,0xa0,0x46,0x0d,0x1f,0xa0,0x5b,0x00,0x28,0x0f,0xc3,0x00,0x1f,0x11,
-0xfa,0x42,0x2d,0x14,0xfa,0x8b,0x00,0x04,0x99,0x05,0x16,0x43,0x16,0x09,0x16,0xf7,
-0x2f,0x13,0x15,0xb0,0xed,0x09,0x16,0xfc,0x64,0x12,0x1f,0xc0,0x15,0x00,0x1a,0x07,
-0x06,0x02,0x0f,0x1a,0x0c,0x0c,0xbf,0xd1,0x77,0x77,0x77,0x7d,0xff,0xfd,0x77,0x77,
-0x77,0x71,0x69,0x00,0x21,0x0a,0x15,0x00,0x00,0x0a,0x11,0x04,0x45,0x16,0x21,0xab,
-0xa2,0x37,0x16,0x13,0x77,0x01,0x00,0x28,0x76,0x1d,0xcc,0x08,0x1e,0xff,0x01,0x00,
-0x06,0xbb,0x0d,0x1a,0x80,0xb8,0x05,0x63,0x16,0xad,0xef,0xed,0xa6,0x10,0x56,0x00,
-0x16,0xbf,0xec,0x22,0x00,0xfc,0x06,0x42,0xe9,0x54,0x59,0xef,0x6e,0x21,0x12,0x2d,
-0x49,0x0d,0x11,0x9f,0x09,0x04,0x10,0x2e,0x28,0x06,0x21,0x14,0x20,0xe6,0x1c,0x20,
-0x00,0x1e,0xbc,0x07,0x91,0x06,0xff,0xc2,0x00,0xbf,0xff,0xfe,0x10,0x0b,0x04,0x4e,
-0x80,0x5f,0xff,0xe2,0x03,0xff,0xff,0xfb,0x06,0x5f,0x08,0x00,0x62,0x0a,0x10,0xa0,
-0x8e,0x2f,0x50,0xef,0xff,0xff,0xc0,0x0d,0xe6,0x0c,0x00,0xc0,0x0c,0x10,0xee,0x58,
-0x03,0x02,0x55,0x0a,0x02,0x69,0x05,0x20,0xe0,0x0c,0x6b,0x03,0x00,0xe6,0x16,0x60,
-0x50,0xbf,0xff,0xff,0x30,0x4f,0x5a,0x04,0x80,0x3f,0xff,0xff,0xb0,0x01,0xdf,0xff,
-0xfb,0x7a,0x0f,0x50,0x80,0x0b,0xff,0xff,0xe1,0x05,0x50,0x70,0xf7,0x00,0x39,0xb9,
-0x30,0x07,0xff,0x38,0x14,0x23,0x02,0xcf,0x2a,0x33,0x22,0xff,0xd2,0x34,0x3a,0x44,
-0xfe,0x95,0x45,0x9e,0xf3,0x11,0x12,0x2a,0x60,0x03,0x13,0x30,0x1b,0x0a,0x51,0x6a,
-0xdf,0xfe,0xda,0x71,0x1e,0x09,0x1a,0xe6,0x6d,0x0c,0x05,0x17,0x2f,0x04,0xe6,0x06,
-0x18,0xfc,0x35,0x4c,0x00,0xd1,0x18,0x62,0x40,0x00,0x48,0xce,0xff,0xeb,0x9a,0x2d,
-0x00,0x8c,0x04,0x02,0xe8,0x15,0x13,0xfc,0x2c,0x2d,0x10,0xef,0xf1,0x0e,0x52,0x45,
-0x7d,0xff,0xff,0xb1,0x50,0x00,0x14,0xbf,0x2b,0x05,0x14,0xe4,0xba,0x25,0x53,0xf6,
-0x01,0x76,0x20,0x04,0xe9,0x09,0x10,0x10,0x2e,0x0d,0x33,0x1f,0xff,0x90,0x2c,0x4f,
-0x40,0x6e,0x40,0x00,0x2c,0xb0,0x01,0x21,0x80,0x0f,0x0e,0x0f,0x02,0xa1,0x34,0x00,
-0xff,0x03,0x21,0xbf,0xff,0x32,0x52,0x21,0xff,0xb1,0xfd,0x04,0x21,0xf3,0x09,0x7b,
-0x30,0x10,0x9f,0x2e,0x09,0x00,0xc6,0x32,0x20,0x30,0x9f,0x6e,0x30,0x11,0x02,0x86,
-0x05,0x20,0x01,0xbf,0x1a,0x3c,0x00,0xc6,0x00,0x12,0x07,0x99,0x4b,0x10,0x7f,0x94,
-0x02,0x02,0x0a,0x34,0x01,0x6e,0x1b,0x13,0x4e,0xf7,0x0e,0x22,0x00,0x0b,0xb3,0x2f,
-0x11,0x1c,0x37,0x00,0x02,0x20,0x00,0x12,0xc2,0x3f,0x01,0x14,0x80,0xdb,0x00,0x54,
-0xfb,0x64,0x51,0x00,0x05,0x10,0x00,0x20,0x01,0x9f,0x31,0x1c,0x00,0xc2,0x21,0x13,
-0xc1,0x59,0x0a,0x40,0x9d,0xef,0xfe,0xb1,0x85,0x02,0x03,0xdb,0x00,0x05,0x08,0x12,
-0x19,0xf6,0x10,0x00,0x1b,0x3e,0x62,0x02,0x13,0x1b,0xc9,0x02,0x39,0x1c,0xfc,0x10,
-0x59,0x01,0x18,0xfa,0x1d,0x05,0x07,0x09,0x0b,0x02,0x68,0x0d,0x02,0xb9,0x0c,0x0d,
-0x32,0x18,0x02,0xa5,0x0a,0x26,0xfe,0x10,0xf3,0x0f,0x04,0x90,0x4c,0x02,0x82,0x20,
-0x01,0xc2,0x36,0x06,0xec,0x03,0x35,0xa4,0x44,0xaf,0xf0,0x03,0x11,0x4f,0x31,0x47,
-0x04,0x17,0x06,0x01,0xa6,0x41,0x14,0x8f,0x67,0x16,0x01,0x3c,0x01,0x14,0x09,0x9d,
-0x09,0x11,0x01,0xec,0x0b,0x00,0xb5,0x4c,0x02,0x80,0x10,0x04,0xcf,0x08,0x13,0x90,
-0x4f,0x06,0x00,0xad,0x46,0x03,0x55,0x06,0x11,0x0c,0xf3,0x05,0x13,0x0d,0x34,0x06,
-0x16,0x05,0xfe,0x03,0x13,0xf5,0xb4,0x19,0x32,0xfd,0x10,0x2d,0x4d,0x0b,0x04,0xca,
-0x24,0x12,0x6f,0x67,0x09,0x12,0x1f,0x44,0x06,0x02,0x4a,0x04,0x22,0x10,0x0a,0xd7,
-0x09,0x13,0x26,0xd4,0x30,0x09,0xba,0x03,0x07,0x5d,0x06,0x0a,0x60,0x06,0x0a,0x63,
-0x06,0x17,0x69,0x40,0x01,0x27,0xff,0xc0,0x0c,0x00,0x41,0xfc,0x00,0x9b,0xbb,0xb5,
-0x0a,0x51,0x3b,0xbb,0xff,0xff,0xc0,0x17,0x39,0x01,0x4e,0x53,0x01,0x9e,0x09,0x02,
-0xc1,0x03,0x03,0x3d,0x0a,0x12,0xe1,0xec,0x11,0x10,0xe3,0xc4,0x01,0x50,0xe2,0x0c,
-0xff,0xfe,0x20,0xef,0x07,0x00,0x58,0x4d,0x51,0xaf,0xff,0xf3,0x00,0xff,0x5f,0x0c,
-0x20,0x54,0x09,0x42,0x01,0x2c,0xbe,0x30,0xfa,0x01,0x02,0xf2,0x37,0x04,0x69,0x01,
-0x31,0xf9,0x04,0x50,0x24,0x00,0x00,0x2f,0x13,0x23,0xa0,0x3f,0x3c,0x00,0xa1,0x2e,
-0xff,0xfc,0x02,0xef,0xfe,0x30,0xff,0xfe,0x30,0x19,0x05,0x12,0x01,0xd5,0x13,0x02,
-0xce,0x01,0x14,0x2e,0x84,0x00,0x00,0x1d,0x31,0x01,0xb9,0x03,0x08,0xb4,0x00,0x08,
-0xcc,0x00,0x0e,0xe4,0x00,0x07,0xfc,0x00,0x16,0x20,0x15,0x0f,0x16,0x90,0x34,0x05,
-0x25,0x90,0x00,0xa4,0x14,0x16,0x90,0xae,0x14,0x13,0x90,0x0a,0x00,0x13,0xfd,0x0b,
-0x00,0x11,0xaf,0xd7,0x0c,0x12,0x90,0x0a,0x00,0x12,0x00,0x0b,0x00,0x13,0xaf,0x23,
-0x12,0x12,0x90,0x0a,0x00,0x01,0x0b,0x00,0x00,0x3f,0x43,0x02,0x0b,0x00,0x12,0x79,
-0x79,0x02,0x00,0x0b,0x07,0x23,0x0b,0xf9,0xd6,0x02,0x15,0xfa,0x80,0x06,0x05,0x13,
-0x07,0x00,0x08,0x00,0x14,0xbf,0x79,0x00,0x25,0xa0,0x9f,0x79,0x00,0x15,0x89,0x79,
-0x00,0x1f,0xf7,0x79,0x00,0x12,0x15,0xaf,0x79,0x00,0x15,0xdf,0x79,0x00,0x05,0xfc,
-0x02,0x16,0x0a,0x06,0x03,0x16,0x0a,0x10,0x03,0x26,0x0a,0xf9,0x76,0x1c,0x04,0x15,
-0x07,0x19,0xd9,0x9d,0x03,0x33,0x03,0xef,0xfa,0x06,0x12,0x22,0x44,0x10,0xcf,0x04,
-0x14,0xfa,0xc1,0x2b,0x03,0xde,0x04,0x23,0xfa,0x05,0x74,0x33,0x04,0x9a,0x01,0x11,
-0x05,0xb4,0x36,0x10,0xff,0x2b,0x1f,0x33,0xfe,0xdf,0xfb,0xa5,0x17,0x20,0xef,0xf1,
-0x19,0x33,0x32,0x2b,0xff,0x48,0xaa,0x03,0x10,0x0e,0x1f,0x00,0x65,0x17,0x20,0xbf,
-0xf4,0x05,0x50,0x1f,0x00,0x00,0x82,0x04,0x14,0x40,0x9b,0x13,0x02,0xea,0x34,0x04,
-0xf4,0x03,0x0f,0x1f,0x00,0x0a,0x65,0xaf,0x70,0xef,0xf1,0x4f,0xc0,0x1f,0x00,0x51,
-0x3f,0xff,0x6e,0xff,0x5f,0xa9,0x22,0x10,0xf7,0xb6,0x00,0x23,0x20,0xcf,0x46,0x0e,
-0x03,0x55,0x09,0x23,0x50,0xbf,0xee,0x14,0x14,0xbf,0xe6,0x36,0x02,0x0f,0x00,0x12,
-0x04,0x37,0x09,0x00,0x1e,0x46,0x29,0xd1,0x00,0x40,0x1b,0x1e,0xd1,0x0b,0x2d,0x24,
-0x3d,0xff,0x25,0x05,0x03,0xf4,0x11,0x16,0xf4,0xcb,0x0d,0x04,0x19,0x00,0x08,0xef,
-0x13,0x08,0x92,0x03,0x0f,0xd3,0x0b,0x71,0x0f,0x26,0x10,0x08,0x08,0xe2,0x35,0x07,
-0xda,0x35,0x01,0x40,0x01,0x17,0xb0,0x54,0x1c,0x16,0xfb,0x17,0x00,0x05,0x19,0x00,
-0x16,0xbf,0x29,0x1c,0x03,0x6e,0x01,0x02,0xbe,0x3f,0x07,0x8b,0x35,0x14,0xef,0xaa,
-0x0a,0x00,0x73,0x02,0x10,0x22,0x3a,0x5a,0x2f,0x22,0x20,0xfe,0x16,0x36,0x00,0xaa,
-0x16,0x10,0x52,0x0c,0x00,0x12,0x25,0xaa,0x16,0x10,0xf9,0x86,0x36,0x13,0x9f,0xbd,
-0x04,0x45,0x20,0x01,0x10,0x02,0xd9,0x15,0x3f,0x88,0x88,0x9f,0xaa,0x16,0x23,0x1e,
-0x00,0x01,0x00,0x36,0x0d,0xea,0x63,0xaf,0x63,0x08,0x40,0x09,0x28,0xdf,0xff,0xe6,
-0x38,0x06,0xaf,0x00,0x14,0x0a,0x01,0x01,0x03,0x4b,0x06,0x05,0xaa,0x04,0x18,0x4f,
-0xac,0x06,0x18,0x9f,0xd6,0x06,0x17,0x6f,0xb6,0x06,0x00,0x78,0x20,0x07,0x27,0x07,
-0x06,0x25,0x00,0x16,0x04,0x45,0x1f,0x00,0x81,0x15,0x17,0xf7,0x03,0x1e,0x11,0xfd,
-0x14,0x00,0x12,0x40,0xdb,0x04,0x10,0x30,0x76,0x1f,0x21,0xff,0xa0,0x6a,0x32,0x10,
-0x70,0xe0,0x42,0x30,0xff,0xff,0x70,0x37,0x08,0x13,0xa0,0x87,0x52,0x13,0x6a,0xb9,
-0x01,0x04,0xac,0x0e,0x03,0x7b,0x0b,0x06,0x00,0x10,0x17,0x6f,0x5c,0x06,0x02,0x5a,
-0x1a,0x16,0xe7,0x8c,0x12,0x24,0xfc,0x60,0x94,0x2e,0x36,0xfe,0xc9,0x62,0x5f,0x04,
-0x15,0x42,0x0a,0x00,0x12,0xcf,0xa5,0x23,0x42,0x37,0x73,0x00,0x2e,0x62,0x0d,0x11,
-0x08,0xbd,0x04,0x31,0xcf,0xff,0xa0,0xf5,0x00,0x60,0xb0,0xef,0xf4,0x04,0xff,0xe0,
-0x6d,0x07,0x00,0x34,0x2b,0x00,0x53,0x2b,0x20,0x9f,0xff,0xf9,0x41,0x51,0xfb,0x5b,
-0xff,0xc0,0x09,0x84,0x01,0x13,0x5f,0xb6,0x23,0x15,0xb0,0x69,0x0b,0x11,0xfb,0x9e,
-0x54,0x16,0xbe,0x8b,0x02,0x11,0x02,0x3b,0x34,0x05,0xcd,0x05,0x03,0xc0,0x2f,0x12,
-0x4a,0x91,0x0e,0x01,0x84,0x00,0x04,0x84,0x07,0x10,0x2e,0x3f,0x00,0x11,0xef,0x17,
+0xf3,0x0b,0x48,0x00,0x38,0xf4,0x00,0x01,0xca,0x01,0x26,0xaf,0xf8,0x0c,0x00,0x14,
+0xef,0x54,0x01,0x20,0x08,0x60,0x0c,0x00,0x20,0x07,0x70,0xbe,0x00,0x20,0xcf,0xf3,
+0x0c,0x00,0x21,0x5f,0xfb,0x48,0x01,0x10,0xfb,0x0c,0x00,0x80,0xcf,0xff,0xb0,0x00,
+0x00,0x9f,0xff,0xf6,0x0c,0x00,0x71,0x7f,0xff,0xf7,0x00,0x03,0xff,0xff,0x30,0x00,
+0x72,0x08,0xff,0xff,0x20,0x0a,0xff,0xf9,0x48,0x00,0x62,0xbf,0xff,0x90,0x1f,0xff,
+0xe0,0x0c,0x00,0x62,0x1f,0xff,0xf0,0x5f,0xff,0x90,0x0c,0x00,0x62,0x0a,0xff,0xf3,
+0x8f,0xff,0x40,0x0c,0x00,0x62,0x06,0xff,0xf6,0x9f,0xff,0x20,0x0c,0x00,0x32,0x04,
+0xff,0xf8,0x0c,0x00,0x10,0xfc,0x0c,0x00,0x11,0xf7,0x24,0x00,0x21,0x37,0x72,0x24,
+0x00,0x32,0x5f,0xff,0x80,0x97,0x00,0x31,0x0a,0xff,0xf4,0x54,0x00,0x21,0x00,0x00,
+0x54,0x00,0x33,0x0b,0xff,0xf8,0xc4,0x00,0x21,0xff,0xa0,0x84,0x00,0x02,0x17,0x01,
+0x31,0x20,0x00,0xaf,0x19,0x00,0x20,0x01,0x9f,0x07,0x00,0xa3,0x0d,0xff,0xff,0xe8,
+0x42,0x24,0x9e,0xff,0xff,0xb0,0xc5,0x01,0x00,0x51,0x01,0x11,0x10,0x4d,0x00,0x01,
+0x01,0x00,0x11,0x90,0x42,0x00,0x10,0x3b,0x0b,0x00,0x13,0xb3,0xfe,0x00,0x44,0x15,
+0x89,0x97,0x51,0x13,0x01,0x44,0x04,0x89,0x98,0x40,0x0c,0x00,0x4e,0x0f,0xff,0xff,
+0xf0,0x0c,0x00,0x01,0x65,0x01,0x12,0xf4,0x7f,0x02,0x20,0xc3,0x2c,0x48,0x00,0x55,
+0xc2,0x3c,0xc0,0x00,0x00,0xee,0x02,0x36,0xf8,0x00,0x03,0xf9,0x02,0x26,0x30,0x0a,
+0x0c,0x00,0x20,0xa0,0x0f,0x06,0x00,0x21,0x94,0x49,0x11,0x03,0x20,0x06,0xef,0x45,
+0x00,0x00,0x4b,0x00,0x41,0xfe,0x60,0x00,0x1e,0x97,0x00,0x41,0x09,0xff,0xff,0xe1,
+0x69,0x00,0x10,0x40,0x12,0x01,0x2a,0xff,0xf0,0x0c,0x00,0x07,0x24,0x00,0x08,0x3c,
+0x00,0x08,0x54,0x00,0x08,0x6c,0x00,0x08,0x84,0x00,0x08,0x9c,0x00,0x09,0xb4,0x00,
+0x08,0xcc,0x00,0x0f,0xf0,0x00,0x08,0x08,0x14,0x01,0x74,0x00,0x00,0x13,0x10,0x00,
+0x02,0x44,0xb1,0x03,0x54,0x5f,0xfe,0x40,0x00,0xdf,0x46,0x02,0x54,0x7f,0xff,0xff,
+0x70,0x0e,0xb0,0x01,0x10,0xaf,0x86,0x00,0x22,0xef,0xfe,0x12,0x03,0x62,0xcf,0xff,
+0xb3,0xbf,0xff,0xce,0x1b,0x00,0x81,0x03,0xef,0xff,0x90,0x00,0x9f,0xff,0xff,0x1b,
+0x00,0x81,0x06,0xff,0xff,0x60,0x5d,0x50,0x6f,0xff,0x1b,0x00,0x81,0x08,0xff,0xfe,
+0x30,0x8f,0xff,0x80,0x3e,0x1b,0x00,0x90,0x1b,0xff,0xfd,0x20,0xaf,0xff,0xff,0xa0,
+0x2d,0xcf,0x02,0xf0,0x03,0x2d,0xff,0xfb,0x01,0xcf,0xff,0xff,0xff,0xc1,0x0b,0xff,
+0xfd,0x20,0x4f,0xff,0xf8,0x03,0xef,0xc4,0x00,0x81,0xe3,0x08,0xff,0xfe,0x4e,0xff,
+0xf5,0x05,0xdc,0x00,0x00,0x08,0x00,0x44,0xfe,0x4f,0xe3,0x08,0xea,0x00,0x54,0x03,
+0xef,0x40,0x41,0x07,0xf8,0x00,0x37,0xf7,0x01,0x40,0xa2,0x01,0x00,0x5e,0x02,0x00,
+0x28,0x00,0x42,0xeb,0xbb,0xef,0xff,0x53,0x02,0x10,0x8f,0x06,0x01,0x17,0x04,0x1b,
+0x00,0x3f,0x40,0x00,0x4f,0x1b,0x00,0x0e,0x00,0xf0,0x00,0x11,0xf3,0xed,0x01,0x10,
+0x70,0xd7,0x00,0x83,0xbb,0xbb,0xba,0x10,0x00,0x1a,0xbb,0xbb,0x56,0x02,0x4e,0x09,
+0xdd,0xdd,0x90,0x59,0x01,0x0f,0x0c,0x00,0x41,0x80,0xad,0xdd,0xdf,0xff,0xff,0xfd,
+0xdd,0xda,0x0c,0x00,0x03,0xf1,0x02,0x16,0xfd,0xcf,0x04,0x25,0xff,0xd1,0xcf,0x04,
+0x04,0xb9,0x04,0x16,0x1d,0xe7,0x04,0x01,0x19,0x00,0x05,0xd0,0x04,0x13,0x1d,0x17,
+0x00,0xd0,0x25,0x55,0x55,0x55,0x11,0xdf,0xfd,0x11,0x55,0x55,0x55,0x52,0xef,0x2c,
+0x00,0x32,0x1d,0xd1,0x1d,0xee,0x05,0x00,0x2d,0x00,0x25,0x01,0xdf,0x5b,0x02,0x3f,
+0xf9,0x9f,0xff,0x01,0x00,0x05,0x35,0x71,0xe7,0x1e,0x0c,0x00,0x55,0xb6,0xfb,0x6f,
+0xff,0xbf,0x1b,0x00,0x00,0xd1,0x01,0x22,0x03,0xcf,0x0b,0x00,0x11,0xd3,0x84,0x00,
+0x13,0xef,0x19,0x00,0x14,0xe1,0x39,0x02,0x02,0xc4,0x02,0x00,0x60,0x02,0x23,0xff,
+0x40,0xa7,0x02,0x10,0x50,0x03,0x03,0x03,0x52,0x01,0x74,0x9f,0xfe,0x10,0x00,0x0a,
+0xff,0xe0,0xc6,0x04,0x35,0xfa,0x00,0x05,0xc5,0x02,0x64,0x04,0xff,0xf5,0x01,0xef,
+0xf9,0x25,0x01,0x55,0x09,0xff,0xe1,0xaf,0xfe,0xba,0x02,0x34,0x0e,0xff,0xaf,0x02,
+0x04,0x05,0x65,0x00,0x00,0x83,0x04,0x16,0x2f,0xd0,0x00,0x05,0x27,0x04,0x0f,0x01,
+0x00,0x22,0x18,0xdf,0x0d,0x00,0x28,0xd3,0xdf,0x0d,0x00,0x06,0x40,0x03,0x21,0x03,
+0x32,0x06,0x00,0x30,0x67,0x75,0x20,0xd7,0x00,0x40,0x00,0x00,0x00,0x29,0x56,0x01,
+0x11,0x70,0x0c,0x00,0x12,0x08,0x56,0x07,0x40,0x60,0x3f,0xff,0x00,0xf0,0x02,0x70,
+0xfe,0xef,0xff,0xff,0xfb,0x3f,0xff,0xd4,0x04,0x40,0xb4,0x00,0x00,0x5b,0x61,0x00,
+0x40,0x00,0xaf,0xff,0xe4,0x40,0x00,0x53,0x4d,0xff,0xff,0xff,0x04,0xba,0x01,0x00,
+0xcd,0x06,0x31,0x0c,0xff,0xf2,0x4f,0x03,0x55,0xee,0xef,0xff,0xff,0x1f,0xac,0x02,
+0x64,0xff,0xff,0x5f,0xff,0x10,0x00,0x35,0x06,0x21,0x04,0x43,0x6e,0x01,0x00,0xc5,
+0x07,0x2f,0x43,0x00,0x01,0x00,0x04,0x10,0x34,0x1e,0x00,0x02,0x0a,0x00,0x11,0x40,
+0x35,0x00,0x01,0x14,0x06,0x27,0xff,0xf5,0x39,0x03,0x51,0xf1,0xff,0xff,0xfd,0xee,
+0x7e,0x05,0x33,0x2f,0xff,0xb0,0x28,0x08,0x00,0x48,0x02,0x14,0x40,0xe8,0x00,0x40,
+0x4e,0xff,0xfa,0x00,0x2d,0x02,0xb2,0xb5,0x00,0x00,0x4b,0xff,0xff,0xd0,0x00,0xff,
+0xf3,0xbf,0xcc,0x00,0x65,0xfc,0x10,0x00,0xff,0xf3,0x06,0x85,0x03,0x40,0xff,0xf4,
+0x00,0x17,0x25,0x01,0x21,0xa2,0x00,0x0c,0x00,0x50,0x00,0x02,0x67,0x76,0x30,0x40,
+0x00,0x2a,0x23,0x30,0x94,0x00,0x20,0x01,0xa7,0x06,0x00,0x22,0x1c,0xff,0x4a,0x04,
+0x01,0x0b,0x00,0x8f,0xff,0x14,0x44,0x44,0xcf,0xff,0xff,0xef,0xa1,0x01,0x1b,0x00,
+0x7f,0x08,0x31,0xff,0xff,0xff,0x58,0x02,0x00,0x06,0x00,0x31,0x05,0xff,0xff,0xc5,
+0x04,0x01,0x06,0x00,0x12,0x05,0xc7,0x04,0x02,0x52,0x01,0x15,0x96,0x61,0x08,0x05,
+0x75,0x08,0x05,0x72,0x08,0x00,0x04,0x05,0x55,0x33,0x33,0xcf,0xff,0xff,0x70,0x03,
+0x42,0x00,0x4a,0x20,0xff,0x09,0x00,0x23,0xcf,0xe1,0x09,0x00,0x23,0x3e,0xfa,0x09,
+0x00,0x23,0x06,0xfe,0x09,0x00,0x14,0x05,0x09,0x00,0x24,0x2e,0xfa,0x2d,0x00,0x13,
+0xf2,0x09,0x00,0x52,0x5b,0x30,0x7c,0xcc,0xcc,0x99,0x00,0x05,0x9c,0x00,0x06,0x9f,
+0x00,0x05,0xa2,0x00,0x05,0xa5,0x00,0x00,0x01,0x00,0x19,0x21,0x23,0x01,0x19,0x30,
+0xe3,0x07,0x17,0xb1,0x0d,0x00,0x14,0x07,0xea,0x03,0x21,0x1a,0x70,0x21,0x02,0x24,
+0xd0,0x00,0x4d,0x01,0x52,0x06,0x30,0x05,0xff,0xa0,0x0d,0x00,0x82,0xf0,0x00,0x03,
+0xff,0x70,0x08,0xff,0x40,0x5c,0x01,0x00,0xe6,0x00,0x71,0x70,0x0c,0xfc,0x01,0x44,
+0x44,0x4c,0x65,0x04,0x62,0x0a,0xff,0x30,0x4f,0xf3,0xef,0xab,0x00,0x72,0x5a,0x20,
+0x0c,0xfb,0x00,0xdf,0x8f,0xd6,0x09,0x75,0x0c,0xfe,0x20,0x4f,0xf1,0x08,0xfb,0xd8,
+0x00,0x52,0x00,0xff,0x50,0x5f,0xef,0x1b,0x00,0x75,0x00,0x6f,0xe0,0x0c,0xf7,0x04,
+0xff,0x05,0x01,0x43,0x00,0xcf,0x70,0x4f,0x0c,0x0a,0x55,0x02,0xef,0xa0,0x0f,0xf5,
+0x17,0x01,0x72,0xcf,0xe2,0x04,0xff,0x10,0x9f,0xbf,0x1b,0x00,0x75,0x04,0xa2,0x00,
+0xcf,0xb0,0x0d,0xf8,0xa7,0x01,0x50,0xaf,0xf3,0x04,0xff,0x30,0x09,0x01,0x00,0x87,
+0x00,0x54,0xcf,0xf7,0x00,0xcf,0xc0,0x17,0x01,0x51,0x3f,0xf7,0x00,0x6f,0xf4,0x25,
+0x01,0x00,0x1b,0x00,0x47,0x53,0x00,0x4f,0xfa,0x20,0x01,0x23,0x6f,0xfd,0x39,0x02,
+0x01,0xa6,0x05,0x05,0xaf,0x09,0x00,0x11,0x04,0x01,0x0b,0x08,0x05,0x8b,0x03,0x4f,
+0x00,0x00,0x00,0x3d,0xb2,0x03,0x03,0x46,0xfd,0xff,0xff,0xca,0x5e,0x02,0x35,0xf6,
+0x00,0x1d,0x0c,0x00,0x11,0xc0,0x0e,0x06,0x04,0xa3,0x04,0x10,0x02,0x07,0x00,0x12,
+0x9f,0xbd,0x04,0x00,0x72,0x03,0x11,0xf4,0x1d,0x00,0x34,0xfc,0x42,0x8f,0x2a,0x06,
+0x02,0x01,0x00,0x23,0xf4,0x00,0x36,0x00,0x21,0x6b,0xff,0x66,0x01,0x11,0x4f,0x14,
+0x00,0x22,0xbf,0xf4,0xca,0x05,0x00,0x14,0x00,0x23,0x0b,0x40,0x0c,0x00,0x1f,0xf4,
+0xfa,0x05,0x10,0x0f,0x74,0x04,0x03,0x2a,0xfd,0x3d,0x71,0x04,0x24,0x0c,0xe3,0x48,
+0x02,0x14,0xa0,0x1a,0x0c,0x02,0x08,0x00,0x33,0x2f,0xff,0xf6,0x1f,0x05,0x02,0x0f,
+0x02,0x53,0x01,0xff,0xff,0xff,0x50,0x7c,0x05,0x13,0xfe,0x16,0x08,0x01,0xe3,0x06,
+0x13,0x1e,0xbc,0x00,0x02,0x15,0x05,0x34,0xe0,0x00,0x05,0x44,0x09,0x13,0xdf,0x3d,
+0x05,0x13,0x5f,0x38,0x05,0x04,0x36,0x05,0x14,0xe0,0x34,0x01,0x32,0x2f,0xff,0x2d,
+0xf9,0x00,0x22,0xef,0xf1,0x6c,0x05,0x31,0x3c,0xff,0x44,0x08,0x00,0x41,0xf1,0x8f,
+0xfc,0x07,0x23,0x01,0x50,0x01,0xff,0xf9,0x02,0x7c,0x79,0x00,0x50,0x07,0xff,0xfb,
+0x40,0x6f,0xb0,0x09,0x14,0x0a,0xb0,0x06,0x00,0xbb,0x04,0x00,0xc0,0x09,0x60,0x00,
+0x02,0x8d,0xff,0xda,0x40,0x8b,0x04,0x01,0xdb,0x05,0x11,0x0f,0xa5,0x00,0x21,0x1d,
+0xfb,0xbe,0x00,0x21,0x2d,0xff,0x02,0x0a,0x11,0x2e,0x9e,0x01,0x31,0x00,0x3f,0xff,
+0x0f,0x00,0x12,0x4f,0xad,0x01,0x02,0x96,0x00,0x22,0x60,0x6f,0xbc,0x01,0x1e,0x8f,
+0x9d,0x05,0x0e,0x01,0x00,0x13,0x8e,0xe9,0x01,0x03,0xe8,0x01,0x23,0x60,0x1c,0xf8,
+0x01,0x12,0x0b,0x0f,0x00,0x02,0x9c,0x00,0x11,0xf6,0x33,0x01,0x01,0x78,0x00,0x11,
+0x07,0x0f,0x00,0x00,0x51,0x03,0x30,0xea,0xbb,0x30,0x64,0x01,0x17,0xb4,0x57,0x02,
+0x24,0xdf,0x91,0x0b,0x00,0x36,0xdf,0xff,0xe6,0xb6,0x01,0x13,0xfc,0xa6,0x03,0x00,
+0x43,0x00,0x16,0xa1,0xcb,0x01,0x15,0xf7,0x15,0x00,0x36,0xff,0xfd,0x40,0xe0,0x01,
+0x01,0x16,0x05,0x05,0xb7,0x09,0x04,0xf5,0x01,0x35,0xfe,0x50,0x00,0xb4,0x00,0x16,
+0xb2,0x0a,0x02,0x16,0xf5,0xca,0x00,0x06,0xb6,0x02,0x16,0xfe,0x15,0x00,0x15,0x6f,
+0x7c,0x07,0x14,0x20,0x0a,0x00,0x36,0xe5,0x00,0x0f,0x10,0x09,0x04,0x1d,0x00,0x04,
+0x69,0x00,0x15,0xd4,0x93,0x00,0x14,0x70,0xa8,0x00,0x12,0xfa,0x3a,0x03,0x06,0xcd,
+0x06,0x10,0x0d,0xbb,0x0a,0x02,0x01,0x00,0x3e,0x3d,0xf9,0x10,0x4b,0x06,0x51,0x19,
+0xcc,0xcc,0xc9,0x10,0x06,0x00,0x11,0x1b,0xf5,0x07,0x13,0x0b,0x91,0x0e,0x26,0xff,
+0xf0,0xc3,0x00,0x06,0xcd,0x02,0x0f,0x15,0x00,0x86,0x20,0xfe,0xff,0x15,0x03,0x10,
+0x0e,0x06,0x00,0x11,0x5f,0x28,0x03,0x01,0x06,0x00,0xa0,0x13,0x33,0x33,0x10,0x00,
+0x00,0x13,0x33,0x33,0x10,0x23,0x01,0x44,0x01,0x00,0x34,0x41,0x06,0xff,0x01,0x00,
+0x25,0xf6,0xef,0x0b,0x00,0x2f,0xef,0xff,0x01,0x00,0x9e,0x15,0xbf,0x0a,0x00,0x33,
+0xb1,0x8b,0xbb,0x01,0x00,0x30,0x81,0x04,0x00,0x01,0x00,0xe0,0x44,0x3b,0xfd,0x10,
+0x00,0x00,0x00,0x5f,0xff,0xff,0xfd,0x20,0x00,0x00,0xf1,0x00,0x50,0xfe,0x30,0x00,
+0x00,0x6f,0x2c,0x00,0x22,0x40,0x00,0x00,0x01,0x12,0x50,0x0f,0x00,0x23,0xff,0x60,
+0x0f,0x01,0x22,0x70,0x6f,0x08,0x00,0x13,0x86,0x54,0x00,0x1f,0xdf,0x7b,0x00,0x09,
+0x21,0xfd,0x8f,0x07,0x00,0x22,0xfc,0x16,0x07,0x00,0x02,0x4b,0x00,0x12,0xfb,0x5a,
+0x00,0x12,0xfa,0x69,0x00,0x12,0xf8,0x78,0x00,0x20,0xf7,0x00,0x0f,0x00,0x30,0xef,
+0xf6,0x00,0x0f,0x00,0x20,0xf4,0xb5,0x9d,0x00,0x21,0x3b,0xba,0xa4,0x00,0x34,0x37,
+0x30,0x00,0x01,0x00,0x34,0x5f,0xff,0x50,0x0b,0x00,0x10,0x4f,0xa2,0x00,0x02,0x01,
+0x00,0x43,0x3f,0xff,0xff,0xff,0x24,0x00,0x10,0x2f,0xc2,0x00,0x11,0x20,0x0b,0x00,
+0x25,0x2e,0xff,0x0c,0x00,0x12,0x1d,0x8c,0x00,0x00,0xea,0x00,0x23,0x0c,0xff,0x8a,
+0x00,0x05,0x0b,0x00,0x00,0x0c,0x00,0x14,0x0b,0xb0,0x00,0x35,0xfb,0x00,0x08,0xbc,
+0x00,0x26,0xf8,0x00,0xc8,0x00,0x26,0xf0,0x0d,0xd3,0x00,0x25,0x00,0x3d,0x0b,0x00,
+0x27,0x30,0x00,0x01,0x00,0x24,0x04,0x44,0x01,0x00,0x06,0x50,0x00,0x28,0xff,0xfb,
+0x45,0x00,0x16,0x0f,0x0c,0x00,0x08,0x17,0x00,0x15,0x0e,0x0b,0x00,0x44,0xfe,0x00,
+0x4b,0xbb,0x01,0x00,0x02,0xde,0x00,0x02,0xcc,0x00,0x21,0xaf,0xb0,0x06,0x00,0x21,
+0xff,0x80,0x06,0x00,0x11,0xf8,0x06,0x00,0x1f,0xfa,0x06,0x00,0x0e,0x10,0x8f,0x06,
+0x00,0x00,0xd1,0x00,0x5f,0xa0,0x00,0x00,0x00,0x0a,0x07,0x00,0x19,0x11,0x80,0x07,
+0x00,0x20,0xf8,0x00,0x07,0x00,0x11,0xfb,0x82,0x00,0x14,0x02,0x8b,0x00,0x31,0xbf,
+0xa0,0x00,0x5b,0x00,0x1f,0xa0,0x5b,0x00,0x28,0x0f,0xc3,0x00,0x1f,0x10,0xfa,0x75,
+0x00,0x24,0x0b,0xfa,0x8b,0x00,0x03,0x01,0x00,0x24,0x03,0x43,0x0a,0x00,0x11,0x07,
+0x40,0x02,0x02,0xa1,0x00,0x11,0xff,0x2d,0x01,0x01,0xe1,0x01,0x14,0xfc,0x15,0x00,
+0x3f,0xcf,0xff,0xc0,0x15,0x00,0x1a,0x07,0x06,0x02,0x0e,0xd8,0x02,0x09,0xf5,0x02,
+0xbf,0xd1,0x77,0x77,0x77,0x7d,0xff,0xfd,0x77,0x77,0x77,0x71,0x69,0x00,0x21,0x0b,
+0x15,0x00,0x11,0xaf,0x27,0x01,0x01,0xe6,0x00,0x20,0xab,0xa2,0x07,0x00,0x23,0x16,
+0x77,0x01,0x00,0x26,0x76,0x1d,0x82,0x02,0x0f,0x93,0x00,0x02,0x15,0x9f,0x0a,0x00,
+0x29,0x80,0x00,0x01,0x00,0x63,0x16,0xad,0xef,0xed,0xa6,0x10,0x56,0x00,0x02,0x0c,
+0x04,0x11,0xb2,0x0d,0x00,0x90,0x09,0xff,0xff,0xe9,0x54,0x59,0xef,0xff,0xf9,0x0d,
+0x00,0x80,0x2d,0xff,0xff,0x90,0x00,0x00,0x00,0x9f,0x09,0x04,0x00,0x3c,0x03,0x60,
+0x70,0x00,0x14,0x20,0x00,0x7f,0x41,0x03,0xf0,0x02,0x1e,0xff,0xff,0xb0,0x00,0x06,
+0xff,0xc2,0x00,0xbf,0xff,0xfe,0x10,0x0b,0xff,0xff,0xf3,0x88,0x03,0x60,0xe2,0x03,
+0xff,0xff,0xfb,0x06,0xb2,0x02,0xf0,0x00,0x00,0x1c,0xff,0xff,0xa0,0x0e,0xff,0xff,
+0xf5,0xef,0xff,0xff,0xc0,0x0d,0xcf,0x13,0x00,0x40,0xcf,0xff,0xff,0xee,0x58,0x03,
+0x01,0xde,0x02,0x91,0x0c,0xff,0xff,0xfe,0x5f,0xff,0xff,0xe0,0x0c,0x6b,0x03,0x90,
+0xef,0xff,0xff,0x50,0xbf,0xff,0xff,0x30,0x4f,0x5a,0x04,0xf2,0x15,0x3f,0xff,0xff,
+0xb0,0x01,0xdf,0xff,0xfb,0x00,0x7f,0xff,0xff,0x80,0x0b,0xff,0xff,0xe1,0x00,0x02,
+0xef,0xff,0xf7,0x00,0x39,0xb9,0x30,0x07,0xff,0xff,0xe2,0x00,0x00,0x02,0xcf,0xff,
+0xf9,0xa8,0x00,0x21,0xd2,0x00,0x9c,0x00,0x42,0xfe,0x95,0x45,0x9e,0xa8,0x00,0x32,
+0x00,0x00,0x2a,0x60,0x03,0x03,0x83,0x03,0x51,0x01,0x6a,0xdf,0xfe,0xda,0x82,0x01,
+0x29,0x05,0xe6,0xfe,0x00,0x39,0x01,0xff,0xf9,0x10,0x00,0x48,0x0d,0xff,0xfc,0x20,
+0x10,0x00,0xa1,0x0a,0xff,0xfe,0x40,0x00,0x48,0xce,0xff,0xeb,0x72,0x10,0x00,0x00,
+0x8c,0x04,0x21,0x88,0xef,0x17,0x04,0x12,0x40,0x64,0x02,0x00,0x0d,0x00,0x62,0xb6,
+0x45,0x7d,0xff,0xff,0xb1,0x50,0x00,0x14,0xbf,0x2b,0x05,0x32,0xe4,0x00,0x00,0x0b,
+0x03,0x80,0xf6,0x01,0x76,0x20,0x04,0xff,0xff,0xf4,0x0e,0x00,0x91,0x10,0x00,0x4e,
+0xff,0xfa,0x1f,0xff,0x90,0x08,0x28,0x01,0x50,0x00,0x6e,0x40,0x00,0x2c,0xb0,0x01,
+0x50,0x80,0x0f,0xff,0xff,0xe1,0x9f,0x04,0x31,0x70,0x00,0x09,0xff,0x03,0x10,0xbf,
+0xc7,0x00,0x10,0x09,0x55,0x00,0x00,0xfd,0x04,0x10,0xf3,0x15,0x00,0xf0,0x03,0x10,
+0x00,0x9f,0xff,0xff,0xd1,0x00,0x03,0xdf,0xff,0xff,0x30,0x9f,0xff,0xff,0xf1,0x00,
+0x02,0x86,0x05,0x00,0x71,0x00,0x50,0xf4,0x0b,0xff,0xff,0xf9,0xe5,0x02,0x01,0xcc,
+0x00,0x10,0x7f,0x94,0x02,0x12,0xfd,0x4e,0x03,0x50,0xf1,0x00,0x00,0x00,0x4e,0x51,
+0x00,0x21,0x20,0x00,0xc6,0x04,0x00,0x53,0x02,0x11,0x1c,0x37,0x00,0x02,0x20,0x00,
+0x12,0xc2,0x3f,0x01,0x14,0x80,0xdb,0x00,0x54,0xfb,0x64,0x51,0x00,0x05,0x10,0x00,
+0x10,0x01,0x33,0x02,0x62,0xe3,0x00,0x02,0xdf,0xff,0xc1,0xcb,0x00,0x50,0x05,0x9d,
+0xef,0xfe,0xb1,0x85,0x02,0x19,0xe4,0x33,0x01,0x39,0x7f,0xff,0xf6,0x10,0x00,0x1b,
+0x3e,0x62,0x02,0x13,0x1b,0xc9,0x02,0x39,0x1c,0xfc,0x10,0x59,0x01,0x18,0xfa,0x1d,
+0x05,0x03,0x20,0x01,0x03,0x01,0x00,0x46,0xdf,0xff,0xff,0xd0,0x0e,0x00,0x10,0x6f,
+0x5f,0x06,0x05,0x0e,0x00,0x10,0x1e,0x09,0x05,0x05,0x4a,0x00,0x01,0x2f,0x01,0x05,
+0xc3,0x01,0x11,0x02,0xf5,0x01,0x16,0xf2,0xec,0x03,0x55,0xa4,0x44,0xaf,0xff,0xb0,
+0x13,0x06,0x35,0xf7,0x00,0x07,0x17,0x06,0x10,0x0d,0xe7,0x00,0x11,0x8f,0x29,0x01,
+0x13,0x00,0x3c,0x01,0x12,0x09,0x67,0x06,0x00,0x15,0x02,0x00,0x90,0x04,0x12,0xaf,
+0x40,0x01,0x10,0x00,0x78,0x01,0x11,0xfb,0xb4,0x05,0x14,0x90,0x4f,0x06,0x33,0xc0,
+0x00,0xcf,0x55,0x06,0x11,0x0c,0xf3,0x05,0x13,0x0d,0x34,0x06,0x16,0x05,0xfe,0x03,
+0x51,0xf5,0x00,0x00,0x00,0xef,0x57,0x06,0x10,0x2d,0x0f,0x00,0x10,0xe0,0x28,0x01,
+0x01,0xc8,0x00,0x11,0x6f,0x26,0x07,0x22,0x00,0x1f,0x44,0x06,0x02,0x4a,0x04,0x31,
+0x10,0x0a,0xff,0x34,0x00,0x22,0x26,0xff,0xfa,0x06,0x09,0xba,0x03,0x07,0x5d,0x06,
+0x0a,0x60,0x06,0x0a,0x63,0x06,0x17,0x69,0x40,0x01,0x27,0xff,0xc0,0x0c,0x00,0x60,
+0xfc,0x00,0x9b,0xbb,0xbb,0x30,0x31,0x07,0x51,0xbb,0xff,0xff,0xc0,0xff,0x7a,0x02,
+0x20,0x02,0xef,0x1d,0x03,0x02,0x02,0x07,0x11,0x1e,0x5b,0x06,0x00,0x05,0x00,0x21,
+0xe1,0x01,0xbb,0x00,0x10,0xe3,0xc4,0x01,0x51,0xe2,0x0c,0xff,0xfe,0x20,0xef,0x07,
+0x90,0x03,0xff,0x30,0xaf,0xff,0xf3,0x00,0xff,0xe3,0x4e,0x00,0x20,0x54,0x09,0x42,
+0x01,0x2c,0xbe,0x30,0xfa,0x01,0x10,0x06,0xd4,0x00,0x05,0x69,0x01,0x32,0xf9,0x04,
+0x50,0x24,0x00,0x53,0x03,0xff,0xff,0xa0,0x3f,0x3c,0x00,0xa1,0x2e,0xff,0xfc,0x02,
+0xef,0xfe,0x30,0xff,0xfe,0x30,0x19,0x05,0x21,0x01,0xef,0x6c,0x00,0x02,0xce,0x01,
+0x14,0x2e,0x84,0x00,0x10,0xe2,0x34,0x00,0x00,0x9c,0x00,0x08,0xb4,0x00,0x08,0xcc,
+0x00,0x0e,0xe4,0x00,0x07,0xfc,0x00,0x06,0xbb,0x03,0x26,0xaf,0x90,0x34,0x05,0x15,
+0x90,0x0a,0x00,0x25,0xff,0x90,0x0a,0x00,0x03,0x0b,0x00,0x10,0xaf,0x7f,0x03,0x12,
+0x90,0x0a,0x00,0x21,0xf9,0x0a,0x0b,0x00,0x00,0x0a,0x00,0x12,0x00,0x0b,0x00,0x00,
+0x0a,0x00,0x02,0x0b,0x00,0x01,0x0a,0x00,0x01,0x0b,0x00,0x33,0x9f,0xff,0xf9,0x3e,
+0x03,0x12,0x79,0x79,0x02,0x00,0x0b,0x07,0x23,0x0b,0xf9,0xd6,0x02,0x15,0xfa,0x80,
+0x06,0x05,0x13,0x07,0x00,0x08,0x00,0x14,0xbf,0x79,0x00,0x25,0xa0,0x9f,0x79,0x00,
+0x15,0x89,0x79,0x00,0x1f,0xf7,0x79,0x00,0x12,0x15,0xaf,0x79,0x00,0x15,0xdf,0x79,
+0x00,0x05,0xfc,0x02,0x16,0x0a,0x06,0x03,0x16,0x0a,0x10,0x03,0x16,0x0a,0xdd,0x04,
+0x14,0x02,0x15,0x07,0x19,0xd9,0x9d,0x03,0x61,0x03,0xef,0xfa,0x00,0x00,0x34,0x97,
+0x08,0x12,0x10,0xcf,0x04,0x33,0xfa,0x00,0x7f,0x84,0x08,0x02,0xde,0x04,0x22,0xfa,
+0x05,0x0f,0x00,0x14,0xf1,0x9a,0x01,0x10,0x05,0x7f,0x08,0x92,0xbf,0xff,0x10,0x00,
+0x00,0xef,0xfe,0xdf,0xfb,0x07,0x08,0xa2,0x00,0xef,0xf1,0x00,0x00,0x0d,0xfe,0x2b,
+0xff,0x48,0xaa,0x03,0x10,0x0e,0x1f,0x00,0x65,0x17,0x20,0xbf,0xf4,0x05,0x50,0x1f,
+0x00,0x00,0x82,0x04,0x03,0x7d,0x03,0x00,0x1f,0x00,0x00,0xa0,0x03,0x04,0xf4,0x03,
+0x0f,0x1f,0x00,0x0a,0x65,0xaf,0x70,0xef,0xf1,0x4f,0xc0,0x1f,0x00,0x50,0x3f,0xff,
+0x6e,0xff,0x5f,0x66,0x00,0x20,0xbf,0xf7,0xb6,0x00,0x21,0x20,0xcf,0x4e,0x02,0x05,
+0xa5,0x09,0x22,0x50,0xbf,0x0f,0x00,0x23,0x00,0xbf,0x33,0x09,0x12,0xbf,0x0f,0x00,
+0x12,0x04,0x37,0x09,0x59,0x60,0x00,0xbf,0xff,0xd1,0x02,0x01,0x2a,0xbf,0xd1,0x10,
+0x07,0x00,0x65,0x00,0x12,0x3d,0xe2,0x0a,0x04,0x8c,0x04,0x05,0x9d,0x04,0x26,0xff,
+0xff,0x19,0x00,0x07,0x86,0x03,0x18,0xd3,0x92,0x03,0x0f,0xd3,0x0b,0x71,0x17,0xdf,
+0x90,0x00,0x17,0x3d,0xa8,0x00,0x02,0x15,0x02,0x17,0xa0,0xfd,0x00,0x02,0xbf,0x09,
+0x02,0x7e,0x01,0x05,0x2a,0x05,0x00,0x34,0x01,0x16,0xfb,0x17,0x00,0x05,0x19,0x00,
+0x12,0xbf,0xb3,0x0a,0x05,0x17,0x00,0x03,0x19,0x00,0x03,0x41,0x0c,0x11,0xfa,0xca,
+0x01,0x04,0xaa,0x0a,0x00,0x73,0x02,0x63,0x22,0x2f,0xff,0xff,0xf2,0x22,0x06,0x03,
+0x6f,0x0f,0xff,0xff,0xf0,0x00,0x00,0x0c,0x00,0x2b,0x40,0x25,0x55,0x55,0x52,0x0c,
+0x00,0x00,0x08,0x00,0x93,0xef,0xff,0xff,0xf9,0x0c,0xff,0xff,0xc0,0x9f,0xbd,0x04,
+0x44,0x20,0x01,0x10,0x02,0xe9,0x00,0x4f,0xf9,0x88,0x88,0x9f,0x1c,0x01,0x05,0x35,
+0x71,0xe7,0x1e,0x0c,0x00,0x37,0xb6,0xfb,0x6f,0xff,0x0c,0x16,0xff,0x0d,0x01,0x09,
+0x13,0x08,0x37,0xea,0x63,0x00,0xe7,0x04,0x06,0xde,0x06,0x00,0x66,0x01,0x07,0x70,
+0x0c,0x05,0xaf,0x00,0x14,0x0a,0x01,0x01,0x03,0x4b,0x06,0x05,0xaa,0x04,0x18,0x4f,
+0xac,0x06,0x18,0x9f,0xd6,0x06,0x17,0x6f,0xb6,0x06,0x27,0x00,0x6f,0xe7,0x04,0x17,
+0x0a,0x25,0x00,0x11,0x04,0x47,0x06,0x03,0x58,0x00,0x36,0xdf,0xff,0xf7,0xc6,0x01,
+0x02,0xc7,0x06,0x22,0x01,0x40,0xdb,0x04,0x00,0x38,0x05,0x30,0x3a,0xff,0xa0,0x1b,
+0x08,0x00,0x95,0x05,0x71,0x05,0xcf,0xff,0xff,0x70,0x03,0xdf,0x63,0x0b,0x01,0x4b,
+0x06,0x13,0x6a,0xb9,0x01,0x04,0xac,0x0e,0x03,0x7b,0x0b,0x02,0xbf,0x0d,0x04,0x71,
+0x07,0x04,0x5c,0x06,0x11,0x03,0x0c,0x00,0x15,0xe7,0x88,0x01,0x24,0xff,0xfc,0x90,
+0x00,0xc0,0x8f,0xfe,0xc9,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x00,
+0x02,0x42,0x00,0x01,0x00,0x40,0x02,0xcf,0xff,0xc2,0x08,0x00,0xf1,0x1a,0x37,0x73,
+0x00,0x2e,0xff,0xff,0xfe,0x20,0x00,0x00,0x08,0xff,0xff,0x90,0xaf,0xff,0xcf,0xff,
+0xa0,0x00,0x00,0x9f,0xff,0xff,0xb0,0xef,0xf4,0x04,0xff,0xe0,0x00,0x09,0xff,0xff,
+0xfb,0x00,0xff,0xf1,0x01,0xff,0xf0,0x15,0x00,0x61,0x00,0xcf,0xfb,0x5b,0xff,0xc0,
+0x15,0x00,0x61,0x00,0x5f,0xff,0xff,0xff,0xf5,0x15,0x00,0x00,0x3b,0x00,0x00,0x01,
+0x00,0x10,0xfb,0x51,0x00,0x20,0x39,0xbe,0x0b,0x00,0x12,0xb0,0x65,0x00,0x12,0xef,
+0x15,0x00,0x00,0x01,0x00,0x42,0xaf,0xff,0xff,0xf5,0x15,0x00,0x10,0x4a,0x21,0x00,
+0x12,0x50,0x84,0x00,0x22,0xff,0xff,0x17,0x00,0x10,0x2e,0x3f,0x00,0x11,0xef,0x17,
 0x00,0x00,0x84,0x00,0x21,0xd0,0x2e,0x17,0x00,0x01,0x84,0x00,0x11,0x02,0x17,0x00,
-0x02,0x84,0x00,0x01,0x17,0x00,0x01,0x84,0x00,0x11,0x00,0x17,0x00,0x02,0xfc,0x0f,
-0x00,0x17,0x00,0x32,0xd0,0x08,0xff,0x70,0x1c,0x30,0xae,0xea,0x20,0x7c,0x0a,0x09,
-0x7a,0x1f,0x35,0xff,0xf0,0x7a,0xd9,0x11,0x11,0x08,0x91,0x00,0x02,0x00,0x1f,0x15,
-0xfb,0x15,0x00,0x51,0xff,0xfa,0x47,0x88,0x40,0x15,0x00,0x33,0x48,0x88,0x7f,0x6e,
-0x2c,0x10,0x40,0x27,0x00,0x16,0x80,0x44,0x0c,0x06,0xf9,0x0d,0x0f,0x15,0x00,0x60,
-0x40,0xfc,0x04,0x78,0x88,0x01,0x00,0x15,0x74,0xf4,0x11,0x2d,0x00,0x0f,0x6b,0x22,
-0x15,0xf0,0xf2,0x03,0x01,0x08,0x2d,0x02,0xc8,0x0e,0x13,0x42,0x0e,0x22,0x02,0xa6,
-0x0f,0x15,0xef,0x0b,0x00,0x30,0x0f,0xff,0xcb,0x6b,0x05,0x35,0xbd,0xff,0xf8,0x4a,
-0x22,0x00,0x7b,0x00,0x04,0x43,0x05,0x14,0xf7,0x15,0x00,0x00,0x2e,0x11,0x06,0x58,
-0x05,0x16,0xf0,0x7b,0x00,0x10,0x54,0x5e,0x00,0x1f,0x45,0xe1,0x04,0x09,0x26,0xfe,
-0xce,0x87,0x0f,0x16,0x08,0xa9,0x0f,0x16,0x0c,0xe3,0x0c,0x15,0x8f,0x95,0x04,0x03,
-0xdb,0x02,0x00,0x1d,0x43,0x05,0x21,0x1c,0x1f,0x57,0x04,0x11,0x11,0x24,0x13,0x33,
-0x01,0x00,0x1e,0x1f,0x65,0x13,0x09,0x8e,0x00,0x06,0x2a,0x00,0x0e,0x19,0x13,0x0a,
-0x01,0x00,0x24,0x57,0x77,0x01,0x00,0x1f,0x5f,0x4a,0x00,0x01,0x24,0xfc,0xee,0x01,
-0x00,0x1f,0xeb,0x49,0x00,0x0c,0x15,0x01,0x73,0x00,0x2f,0x31,0xff,0x7e,0x12,0x0b,
-0x16,0xe1,0x2a,0x00,0x0f,0xfe,0x16,0x07,0x0f,0x44,0x00,0x02,0x26,0xfe,0x2d,0x0c,
-0x00,0x36,0xd2,0x00,0x9f,0x37,0x1b,0x24,0xe4,0x05,0x0c,0x00,0x52,0x50,0x4e,0xff,
-0x80,0x2c,0x0b,0x00,0x20,0xc2,0x08,0x0d,0x54,0x11,0x8f,0x22,0x00,0x01,0xbf,0x1d,
-0x20,0xf5,0x04,0xc1,0x37,0x22,0x40,0x5e,0x45,0x16,0x53,0x1c,0xff,0xff,0xb1,0x09,
-0x70,0x00,0x35,0x20,0x6d,0xd6,0x08,0x34,0x00,0x18,0x3c,0x05,0x66,0x00,0x2f,0xd9,
-0x9d,0xd8,0x06,0x23,0x12,0x4f,0xd7,0x0a,0x05,0xb0,0x15,0x05,0x91,0x3d,0x04,0x9a,
-0x0b,0x14,0x00,0xdd,0x04,0x13,0x1f,0x21,0x0c,0x14,0x03,0x19,0x00,0x00,0x88,0x01,
-0x44,0xc8,0x88,0x87,0x30,0x47,0x02,0x04,0x2d,0x1c,0x24,0xa0,0x0c,0x37,0x02,0x15,
-0xef,0xd8,0x02,0x03,0xdb,0x06,0x43,0x37,0x88,0x88,0xaf,0x43,0x17,0x14,0x08,0xde,
-0x05,0x33,0xcf,0xff,0xf3,0xc1,0x02,0x14,0xfa,0x2b,0x3d,0x13,0x10,0x25,0x0b,0x13,
-0x70,0x32,0x07,0x1a,0xd0,0xcf,0x3f,0x24,0x3f,0xfb,0x54,0x06,0x13,0x20,0x1f,0x06,
-0x14,0x70,0x51,0x16,0x12,0xd3,0xf0,0x05,0x72,0x78,0x88,0xff,0xef,0xf8,0x88,0x74,
-0xbe,0x00,0x24,0x90,0x9f,0x25,0x20,0x25,0xf9,0x09,0x9c,0x03,0x01,0x92,0x23,0x0c,
-0xb1,0x03,0x15,0xe5,0xc6,0x03,0x70,0xf4,0x07,0x88,0x88,0x88,0x03,0x30,0x15,0x00,
-0x11,0x07,0x98,0x04,0x23,0x40,0x0f,0x9e,0x23,0x11,0x08,0xc0,0x1b,0x12,0x08,0xad,
-0x23,0x15,0x4f,0x15,0x00,0x14,0xfe,0x15,0x00,0x24,0x00,0x00,0x2a,0x00,0x33,0xb8,
-0x88,0x88,0x15,0x00,0x0d,0xe9,0x23,0x0f,0x15,0x00,0x09,0x43,0xf4,0x78,0x88,0x80,
-0x15,0x00,0x06,0x31,0x11,0x01,0xfa,0x3a,0x05,0x15,0x00,0x16,0x07,0x15,0x00,0x16,
-0x4f,0xe7,0x05,0x16,0x08,0xb2,0x22,0x05,0x52,0x07,0x54,0x01,0x5f,0xff,0x51,0x00,
-0x93,0x59,0x03,0x72,0x0a,0x15,0x0c,0x32,0x00,0x14,0x0a,0xcd,0x1d,0x04,0xab,0x19,
-0x16,0xf3,0xf3,0x1d,0x14,0x90,0xb8,0x41,0x29,0xff,0xfd,0xce,0x04,0x06,0x32,0x01,
-0x14,0x01,0x54,0x3e,0x04,0x86,0x00,0x00,0xa0,0x05,0x16,0x08,0xd8,0x04,0x04,0x74,
-0x02,0x13,0xd0,0x68,0x18,0x03,0x9a,0x10,0x03,0x01,0x00,0x16,0x3d,0x91,0x02,0x16,
-0xdf,0x2c,0x03,0x23,0x78,0x88,0x01,0x00,0x1a,0x72,0xb5,0x03,0x15,0x6f,0xce,0x07,
-0x16,0x01,0x35,0x35,0x4a,0x03,0xcf,0xc3,0x00,0x9a,0x1a,0x09,0xdd,0x02,0x0e,0x53,
-0x0a,0xb0,0x10,0x1f,0x90,0x09,0xf1,0x01,0xf9,0x00,0x9f,0x10,0x1f,0xcc,0x00,0x9c,
-0xf8,0x00,0x8f,0x00,0x0f,0x80,0x08,0xf0,0x00,0x1b,0x00,0x0b,0x01,0x00,0x92,0xb8,
-0x8f,0xe8,0x8b,0xfb,0x88,0xfe,0x88,0xbf,0xd1,0x0a,0x62,0xcc,0x00,0x4f,0x40,0x0c,
-0xc0,0x32,0x01,0x00,0x09,0x00,0x01,0x12,0x00,0x01,0xc0,0x26,0x00,0x24,0x00,0x00,
-0x2d,0x00,0x0d,0x42,0x00,0x00,0x5a,0x00,0x01,0x75,0x0f,0x21,0xf1,0x01,0x3a,0x17,
-0x01,0x0a,0x09,0x00,0x7e,0x00,0x0c,0x1b,0x00,0x0f,0x26,0x1f,0x1e,0x09,0x01,0x00,
-0x17,0x3a,0x83,0x11,0x17,0x4b,0xff,0x0d,0x17,0x5c,0x64,0x09,0x13,0x6e,0xb9,0x08,
-0x00,0x4b,0x01,0x02,0xcd,0x19,0x02,0x6c,0x51,0x16,0x9f,0x49,0x02,0x00,0x50,0x5d,
-0x04,0xbc,0x0b,0x13,0x04,0x81,0x20,0x01,0xc4,0x29,0x15,0xdf,0xc8,0x01,0x02,0xbf,
-0x11,0x04,0xd7,0x03,0x17,0x0d,0x01,0x1c,0x07,0x77,0x1b,0x01,0x5c,0x50,0x08,0x3d,
-0x13,0x55,0x57,0x88,0x88,0x88,0x8c,0x0e,0x42,0x03,0x95,0x02,0x27,0xf9,0x00,0x0d,
-0x00,0x18,0xf2,0x0d,0x00,0x18,0xa0,0x0d,0x00,0x17,0x30,0x0d,0x00,0x06,0xe6,0x09,
-0x18,0x08,0xff,0x10,0x18,0x08,0xfd,0x10,0x18,0x07,0xfb,0x10,0x15,0x05,0x57,0x0a,
-0x01,0x41,0x0a,0x0e,0x40,0x01,0x02,0x8b,0x0b,0x43,0x80,0xe4,0x00,0x00,0xe5,0x07,
-0x14,0x40,0x09,0x00,0x24,0xf4,0x00,0xf7,0x07,0x14,0x40,0x09,0x00,0x14,0xf4,0x09,
-0x00,0x15,0xfe,0xda,0x00,0x02,0xf4,0x02,0x3f,0x88,0x88,0x88,0x9b,0x18,0x7c,0x0f,
-0x99,0x0b,0x02,0x55,0x03,0x56,0x77,0x65,0x30,0x76,0x0a,0x11,0x7c,0x29,0x00,0x22,
-0xc7,0x20,0x29,0x01,0x14,0xcf,0x50,0x07,0x11,0x50,0x50,0x05,0x09,0x30,0x11,0x00,
-0x81,0x04,0x50,0xc9,0x65,0x44,0x56,0x9c,0xe0,0x03,0x00,0x0f,0x13,0x22,0xfd,0x61,
-0x09,0x15,0x50,0xdf,0xff,0xff,0xc1,0xdf,0x73,0x1b,0x04,0xbf,0x38,0x24,0xff,0xfd,
-0xae,0x0f,0x02,0x6b,0x12,0x30,0xf9,0x09,0xf6,0x87,0x38,0x40,0xcd,0xff,0xdc,0x84,
-0xcd,0x03,0x33,0x90,0x00,0x10,0x89,0x02,0x23,0xff,0xe6,0x7e,0x1e,0x19,0x3d,0xdb,
-0x02,0x10,0x05,0x58,0x02,0x36,0xcc,0xef,0xff,0x2c,0x06,0x54,0xc5,0x10,0x00,0x01,
-0x5c,0x43,0x0c,0x22,0xaf,0xe4,0x02,0x45,0x13,0xfa,0x08,0x06,0x12,0x10,0xcf,0x02,
-0x06,0xf0,0x01,0x04,0x73,0x3c,0x05,0xb0,0x23,0x1a,0xc1,0xec,0x01,0x09,0x17,0x01,
-0x07,0x8d,0x0c,0x02,0x9d,0x0c,0x06,0x04,0x5f,0x01,0xe6,0x06,0x19,0xf5,0x8d,0x18,
-0x23,0xaa,0x40,0x88,0x04,0x17,0x44,0x01,0x00,0x3a,0x30,0x00,0x6f,0x6b,0x12,0x0a,
-0x50,0x08,0x34,0x60,0xff,0xfb,0x7f,0x18,0x00,0xde,0x09,0x16,0xa1,0xa0,0x0d,0x01,
-0xcd,0x25,0x0c,0x05,0x06,0x07,0x0f,0x00,0x29,0x05,0xbf,0x0f,0x00,0x2f,0x00,0x0f,
-0x0f,0x00,0x09,0x2d,0x02,0x4f,0x50,0x06,0x08,0x69,0x00,0x00,0xd2,0x03,0x06,0xb3,
-0x00,0x3a,0x4a,0xff,0xd7,0x33,0x02,0x29,0x70,0xbf,0x0f,0x00,0x37,0x30,0x18,0xbb,
-0x01,0x00,0x1f,0xa4,0xf0,0x00,0x3b,0x05,0xe5,0x2b,0x01,0x96,0x00,0x07,0x0f,0x00,
-0x29,0x05,0xbf,0x0f,0x00,0x2f,0x00,0x0f,0x0f,0x00,0x09,0x29,0x02,0x4f,0x0f,0x00,
-0x0f,0xf0,0x00,0x88,0x15,0x8f,0xa8,0x0b,0x06,0xe0,0x01,0x02,0xc9,0x40,0x05,0xe0,
-0x01,0x05,0xc6,0x0b,0x0f,0x0f,0x00,0x07,0x29,0x02,0x4f,0x0f,0x00,0x0f,0xe0,0x01,
-0x8b,0x16,0x40,0x96,0x00,0x07,0x0f,0x00,0x04,0xe0,0x01,0x17,0x40,0xa0,0x10,0x0f,
-0x0f,0x00,0x06,0x29,0x02,0x4f,0x0f,0x00,0x0f,0xf0,0x00,0x88,0x0a,0x96,0x00,0x17,
-0xf0,0xd4,0x3d,0x19,0xbf,0x0f,0x00,0x09,0x9c,0x11,0x0d,0x0f,0x00,0x2d,0x02,0x4f,
-0xe1,0x00,0x0f,0xf0,0x00,0x37,0x0d,0xe8,0x3f,0x12,0x00,0x9d,0x46,0x18,0xfe,0x6c,
-0x1d,0x29,0x27,0x7d,0xfd,0x04,0x1a,0x4f,0x82,0x00,0x38,0x0e,0xf5,0x3a,0x3a,0x05,
-0x57,0x07,0xf6,0x00,0x09,0xda,0x25,0x15,0x17,0xed,0x62,0x07,0x43,0xfe,0x50,0x00,
-0x6f,0x8f,0x05,0x11,0xa4,0x39,0x06,0x33,0x30,0x1e,0xe0,0xf3,0x00,0x83,0xfa,0x10,
-0x0e,0xff,0xff,0xfd,0xbe,0xfe,0x9a,0x00,0x3a,0xff,0xff,0x60,0x6d,0x01,0x21,0xfb,
-0x0a,0x69,0x10,0x13,0x1c,0x63,0x34,0x31,0xd4,0x00,0x1c,0x23,0x08,0x21,0x2f,0xa0,
-0x83,0x00,0x00,0x91,0x65,0x11,0x63,0xc5,0x05,0x1a,0x20,0xd4,0x06,0x38,0xfb,0x00,
-0x8f,0xaa,0x05,0x38,0x0a,0xf8,0x4b,0x01,0x08,0x01,0x85,0x0f,0x18,0xf6,0x30,0x00,
-0x19,0x5c,0x1f,0x00,0x00,0x61,0x11,0x19,0xf5,0x51,0x00,0x14,0x11,0xda,0x1b,0x45,
-0x8c,0xef,0xfe,0xa6,0x31,0x19,0x00,0x2e,0x01,0x12,0x0c,0x02,0x08,0x11,0x40,0x3f,
-0x0b,0x10,0x05,0x86,0x17,0x10,0x02,0x28,0x01,0x10,0x05,0x15,0x07,0x00,0x46,0x09,
-0x00,0xdc,0x0f,0xf0,0x03,0xe0,0x0e,0xff,0xfc,0xff,0xf0,0x16,0x07,0xff,0xff,0x21,
-0xff,0xf8,0x09,0xff,0x01,0xf6,0x07,0x41,0x6b,0x80,0xd1,0x09,0xf0,0x1f,0x70,0x6f,
-0xff,0x86,0x8f,0x2e,0x60,0x01,0x70,0x5f,0xff,0xf9,0x7f,0x63,0x15,0x00,0x19,0x19,
-0x10,0xa7,0xb5,0x2b,0x00,0x35,0x11,0x20,0xfb,0x7f,0xbc,0x01,0x00,0x00,0x07,0x14,
-0xb7,0x2c,0x20,0xf0,0x0d,0xfa,0x6f,0xff,0xff,0x40,0x30,0x03,0x07,0xff,0xff,0xa4,
-0xff,0xff,0x40,0x4e,0x01,0xe2,0x08,0xff,0xf8,0x2f,0xff,0x70,0x4f,0xf0,0x1f,0x90,
-0x2f,0x3d,0x01,0x50,0x7f,0xff,0x01,0xb0,0x2e,0xda,0x69,0x12,0xff,0x8f,0x11,0x01,
-0xb7,0x01,0x00,0x09,0x00,0x11,0x90,0x92,0x62,0x10,0x2e,0x56,0x09,0x00,0xa0,0x18,
-0x12,0x3e,0xa6,0x19,0x15,0xaf,0x4c,0x23,0x24,0x28,0xce,0xc1,0x65,0xb0,0x1a,0xcc,
-0xcc,0xca,0x10,0x00,0x00,0x02,0x44,0x44,0x49,0x92,0x09,0x3f,0x44,0x44,0x42,0x56,
-0x08,0x02,0x15,0x9b,0x50,0x02,0x1a,0x80,0x98,0x02,0x03,0xf3,0x0b,0x06,0x3a,0x2c,
-0x09,0x15,0x00,0x60,0x66,0xff,0xd1,0xdf,0xf6,0x6f,0x15,0x00,0x61,0xf4,0x4f,0xfc,
-0x0c,0xff,0x44,0x15,0x00,0x6f,0x44,0xff,0xc0,0xcf,0xf4,0x4f,0x15,0x00,0x45,0x61,
-0xf6,0x6f,0xfd,0x1d,0xff,0x66,0x09,0x65,0x04,0x1f,0x03,0x15,0x05,0x04,0x24,0x05,
-0x96,0x0a,0x07,0xc2,0x1c,0x2f,0x6e,0xe5,0x98,0x1b,0x03,0x17,0x7f,0x37,0x02,0x00,
-0x1a,0x0c,0x04,0x25,0x02,0x26,0x50,0x3f,0x9a,0x33,0x20,0x7f,0xb0,0x1c,0x38,0x04,
-0x30,0x00,0x24,0xb0,0x3f,0x5a,0x02,0x00,0x3a,0x39,0x01,0x43,0x68,0x03,0xfb,0x4c,
-0x26,0xb0,0x3f,0x0c,0x00,0x24,0xff,0xb0,0xe5,0x0e,0x04,0x7b,0x13,0x04,0x0c,0x00,
-0x1f,0x70,0x0c,0x00,0x2e,0x17,0x5f,0x0c,0x00,0x17,0x08,0x0c,0x00,0x02,0xfb,0x01,
-0x17,0x70,0x9f,0x16,0x17,0x70,0x91,0x15,0x17,0x70,0x37,0x27,0x15,0x70,0x2b,0x09,
-0x3e,0xdb,0xa8,0x50,0x49,0x11,0x09,0xf4,0x1e,0x00,0x16,0x03,0x22,0x80,0x00,0x96,
-0x5f,0x06,0xfd,0x0d,0x18,0x03,0x0e,0x11,0x02,0x1d,0x00,0x00,0x23,0x56,0x12,0xfc,
-0xfa,0x4e,0x10,0xef,0x83,0x02,0x00,0xd4,0x2e,0x11,0x8f,0x04,0x2a,0x02,0x60,0x0c,
-0x21,0x6f,0xf6,0x9b,0x0e,0x22,0x03,0xef,0x49,0x0c,0x12,0x06,0xf2,0x1b,0x14,0x3f,
-0xf8,0x67,0x02,0x33,0x13,0x1a,0xdf,0xfc,0x10,0x0b,0x0f,0x00,0x0b,0x2d,0x00,0x29,
-0x03,0xff,0x4b,0x00,0x0b,0x69,0x00,0x02,0x87,0x00,0x10,0xf8,0x87,0x00,0x00,0x3e,
-0x01,0x0c,0xa5,0x00,0x0c,0xc3,0x00,0x0b,0xe1,0x00,0x0b,0xff,0x00,0x14,0x07,0x09,
-0x00,0x13,0x7f,0x21,0x00,0x14,0x07,0x39,0x00,0xa3,0x7f,0xf4,0x08,0xf0,0x0e,0x90,
-0x0f,0xff,0x07,0xff,0x09,0x00,0x14,0x7f,0x09,0x00,0x16,0xff,0x09,0x00,0x6f,0xfa,
-0x8c,0xf8,0x8f,0xc8,0x8f,0x2c,0x0c,0x63,0x14,0xef,0xc7,0x00,0x14,0x8f,0xde,0x00,
-0x26,0x08,0xef,0xd7,0x01,0x0c,0x07,0x1b,0x01,0xfa,0x05,0x18,0xf1,0x38,0x2b,0x12,
-0x10,0x21,0x2a,0x04,0x76,0x3e,0x13,0x1c,0x5f,0x17,0x00,0x44,0x3c,0x13,0x1d,0x06,
-0x0c,0x00,0x82,0x5e,0x35,0x2d,0xff,0xf9,0x19,0x00,0x41,0x2e,0xff,0xff,0xa2,0xd8,
-0x46,0x47,0x2b,0xff,0xf1,0x3e,0x8b,0x00,0x18,0x1d,0x34,0x0f,0x08,0x0f,0x01,0x00,
-0x5b,0x04,0x22,0xd9,0x99,0x01,0x00,0x10,0x60,0xd4,0x65,0x08,0x1b,0x10,0x17,0x90,
-0xae,0x0b,0x17,0xf8,0xa7,0x00,0x2f,0x4a,0x20,0xb8,0x02,0x02,0x1f,0xf5,0xd0,0x02,
-0x04,0x04,0x54,0x00,0x17,0xea,0x14,0x00,0x7b,0xf7,0xf5,0x00,0xfc,0xef,0x00,0xef,
-0x00,0x01,0x05,0x0d,0x0c,0x3e,0x07,0x00,0x04,0x16,0x00,0x2f,0xcb,0x00,0x01,0x00,
-0x15,0x1f,0xd2,0x1e,0x00,0x0a,0x03,0x88,0x00,0xb2,0xf1,0x00,0xfc,0x00,0x00,0xea,
-0xfd,0xf2,0xf9,0x00,0xe4,0x93,0x00,0x7d,0xfe,0x00,0x00,0xfd,0xfe,0xf7,0xfa,0x92,
-0x00,0x10,0xfb,0x29,0x00,0x0a,0x52,0x20,0x05,0x1a,0x00,0x0b,0x0a,0x00,0x19,0xfe,
-0x1f,0x00,0x03,0xf3,0x07,0x00,0xde,0x50,0x00,0x5a,0x0f,0x7f,0xf0,0x00,0xfc,0x00,
-0xfc,0xf8,0xfc,0x9c,0x00,0x0a,0x05,0xf7,0x00,0x21,0xfc,0xfd,0x34,0x00,0x26,0xfd,
-0xfb,0x30,0x00,0x75,0xcd,0x00,0x00,0x00,0xdc,0x00,0xd9,0x24,0x00,0xab,0xfa,0xfc,
-0x00,0x00,0xfc,0xfb,0x00,0x00,0xfc,0xfc,0x87,0x0e,0x03,0x90,0x00,0x2f,0x03,0xfb,
-0x68,0x00,0x07,0x1f,0xfc,0x43,0x01,0x0d,0x10,0xe1,0x61,0x00,0x0a,0xeb,0x00,0x10,
-0xfb,0x38,0x00,0x12,0xf9,0x17,0x10,0x14,0xca,0xb0,0x00,0x97,0xf4,0x00,0x00,0xda,
-0xfc,0xd9,0xef,0x00,0xcc,0xf7,0x00,0x16,0xe9,0x2d,0x01,0x10,0xb4,0x05,0x05,0x21,
-0x00,0xde,0x0c,0x00,0x61,0xf6,0x00,0xf9,0x00,0xfe,0xfe,0x25,0x01,0x3e,0x03,0x00,
-0x03,0x73,0x00,0x6f,0xfa,0x00,0xfb,0xfc,0x00,0xf9,0x97,0x00,0x0b,0x10,0xf7,0xba,
-0x00,0x1f,0xf7,0x7b,0x02,0x03,0xb1,0xd0,0xcd,0x00,0x00,0xea,0xfb,0xd8,0xfd,0x03,
-0x00,0x03,0x60,0x00,0xd3,0xe1,0xef,0x00,0xef,0xd9,0xf4,0xf2,0x00,0xf4,0xf1,0xf7,
-0xf2,0xf5,0x5e,0x01,0x66,0xd8,0xe3,0x00,0x00,0xf2,0xfe,0x2b,0x01,0xa4,0xf7,0xf8,
-0x00,0x00,0xf7,0xfa,0x00,0x00,0xfb,0xfe,0x7d,0x01,0x61,0x03,0x00,0xe5,0xf5,0x00,
-0x00,0xd6,0x64,0x03,0xa1,0x03,0x23,0xfa,0xfa,0x6c,0x01,0x16,0x00,0x15,0x00,0x24,
-0x00,0xe3,0xf5,0x01,0x15,0x03,0x20,0x01,0x10,0xfc,0x20,0x01,0x14,0xfa,0xcd,0x00,
-0xf6,0x12,0x04,0xf7,0xd5,0xe4,0x00,0x00,0xe4,0xfb,0xee,0xfd,0x03,0xee,0x03,0x03,
-0x02,0x03,0x00,0x03,0xf4,0xf4,0xfc,0xf9,0xf4,0xf9,0xf5,0xfc,0xf9,0xfc,0x00,0xfc,
-0xfa,0x04,0xf8,0x02,0x04,0x1a,0xfb,0x99,0x01,0x01,0x48,0x00,0x1c,0xfb,0xbd,0x01,
-0x15,0xfd,0x50,0x02,0x0c,0x01,0x00,0x0e,0x17,0x00,0x0e,0x1d,0x00,0x0f,0x0b,0x02,
-0x08,0x00,0x91,0x01,0x2d,0xfd,0xfd,0xbd,0x02,0x0f,0x6c,0x00,0x20,0x14,0xfe,0x80,
-0x02,0x1d,0x04,0x1a,0x11,0x09,0x71,0x02,0x10,0x04,0x7d,0x03,0x0f,0x01,0x00,0x24,
-0x0b,0xb9,0x02,0x1f,0xf0,0xad,0x00,0x0b,0x23,0xfc,0xfd,0xa2,0x01,0x1c,0xe0,0x6c,
-0x02,0x20,0xfc,0x04,0x6b,0x02,0x3e,0x09,0x00,0x03,0x89,0x02,0x0a,0x94,0x02,0x0a,
-0x58,0x03,0x1c,0xe1,0x63,0x00,0x2d,0xfe,0x02,0x14,0x01,0x1f,0xe9,0xd8,0x00,0x24,
-0x0e,0xfb,0x02,0x0f,0x03,0x02,0x15,0x1f,0xfc,0xd1,0x03,0x06,0x03,0x8d,0x77,0x21,
-0x02,0x03,0x77,0x01,0x2d,0x04,0x05,0x21,0x00,0xf0,0x00,0x06,0x07,0x08,0x09,0x0a,
-0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x56,0x7d,0x82,0x13,0x0d,0x14,
-0x15,0x16,0x17,0x18,0x19,0xc2,0x0a,0x70,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x34,
-0x22,0xe0,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,
-0x62,0x54,0x0f,0x01,0x00,0x5c,0x02,0xce,0x00,0x20,0x03,0x02,0xc9,0x00,0x4b,0x06,
-0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,
-0x0c,0x00,0x08,0x00,0xd0,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,
-0x00,0x15,0x52,0x13,0x62,0x00,0x17,0x17,0x17,0x18,0x17,0x1f,0x2e,0xd1,0x19,0x1a,
-0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x9f,0x54,0x0f,0x01,0x00,
-0x1c,0x1f,0x24,0xc8,0x00,0x25,0x50,0x00,0x00,0x00,0x00,0x00,
+0x02,0x84,0x00,0x01,0x17,0x00,0x01,0x84,0x00,0x11,0x00,0x17,0x00,0x11,0x5f,0x4a,
+0x00,0x00,0x17,0x00,0xf5,0x02,0xd0,0x08,0xff,0xff,0xf8,0x00,0x00,0x00,0x01,0xae,
+0xea,0x20,0x00,0x39,0xb9,0x30,0x00,0x01,0x00,0x60,0xbf,0xff,0xff,0xff,0xf0,0x7a,
+0x0a,0x00,0x10,0x0f,0x6e,0x00,0x11,0x08,0x91,0x00,0x10,0xff,0x15,0x00,0x25,0x8f,
+0xfb,0x15,0x00,0x51,0xff,0xfa,0x47,0x88,0x40,0x15,0x00,0x51,0x48,0x88,0x7f,0xff,
+0xf8,0x15,0x00,0x10,0x40,0x27,0x00,0x24,0x80,0xff,0x01,0x00,0x25,0xf8,0x0f,0x0b,
+0x00,0x0f,0x15,0x00,0x60,0x40,0xfc,0x04,0x78,0x88,0x01,0x00,0x52,0x74,0xff,0xff,
+0xfa,0x10,0xd9,0x00,0x04,0x27,0x00,0x03,0xcf,0x00,0x00,0xbd,0x00,0x36,0x00,0x00,
+0x0b,0x8b,0x01,0x21,0x01,0x44,0x01,0x00,0x44,0x42,0x00,0x00,0x06,0x5a,0x00,0x35,
+0x00,0x00,0xef,0x0b,0x00,0xd3,0x0f,0xff,0xcb,0xbb,0xbb,0xbb,0xbb,0xbd,0xff,0xf8,
+0x00,0xff,0xf0,0x51,0x00,0x20,0xf8,0x0f,0x4e,0x00,0x01,0x51,0x00,0x15,0xf7,0x15,
+0x00,0x25,0xff,0xef,0x15,0x00,0x01,0x63,0x00,0x04,0x7b,0x00,0x10,0x54,0x5e,0x00,
+0x2f,0x45,0xff,0x01,0x00,0x08,0x35,0xfe,0xce,0xff,0x6f,0x00,0x14,0x08,0xc9,0x00,
+0x34,0x00,0x00,0x0c,0xde,0x00,0x32,0x00,0x00,0x8f,0x0a,0x00,0x43,0xfa,0x00,0x00,
+0x0a,0x15,0x00,0x34,0xf2,0x00,0x02,0x35,0x00,0x2b,0xf7,0x57,0x50,0x00,0x15,0xbf,
+0x0a,0x00,0x33,0xb1,0x8b,0xbb,0x01,0x00,0x34,0x81,0x13,0x33,0x01,0x00,0x16,0x1f,
+0x79,0x00,0x0f,0x8e,0x00,0x02,0x06,0x2a,0x00,0x2f,0x10,0x00,0x01,0x00,0x0b,0x24,
+0x57,0x77,0x01,0x00,0x1f,0x5f,0x4a,0x00,0x01,0x24,0xfc,0xee,0x01,0x00,0x1f,0xeb,
+0x49,0x00,0x0c,0x15,0x01,0x73,0x00,0x16,0x31,0x3f,0x00,0x1f,0xef,0x54,0x00,0x01,
+0x16,0xe1,0x2a,0x00,0x16,0x3d,0x16,0x00,0x26,0xd3,0xdf,0x0c,0x00,0x18,0xfd,0x2f,
+0x00,0x17,0xef,0xd8,0x00,0x16,0x2d,0x0c,0x00,0x34,0xd2,0x00,0x9f,0x0b,0x00,0x44,
+0xf9,0x00,0xe4,0x05,0x0c,0x00,0x52,0x50,0x4e,0xff,0x80,0x2c,0x0b,0x00,0x71,0xc2,
+0x08,0xff,0xff,0xfc,0x20,0x8f,0x22,0x00,0x20,0x01,0xcf,0x7f,0x03,0x71,0x04,0xef,
+0xff,0xff,0xfe,0x40,0x5e,0x1e,0x00,0x63,0x90,0x1c,0xff,0xff,0xb1,0x09,0x70,0x00,
+0x44,0x20,0x6d,0xd6,0x02,0x80,0x00,0x45,0xf6,0x00,0x00,0x6f,0x66,0x00,0x3f,0xd9,
+0x9d,0xff,0x01,0x00,0x09,0x08,0xb4,0x00,0x08,0xcc,0x00,0x91,0x00,0x4f,0xff,0xff,
+0xff,0xf3,0x00,0x00,0x00,0x61,0x00,0x13,0x60,0x9c,0x03,0x52,0xf1,0x00,0x00,0x00,
+0x0d,0x19,0x02,0x02,0x63,0x02,0x51,0x70,0x00,0x00,0x00,0x1f,0x0a,0x02,0x34,0x00,
+0x00,0x03,0x19,0x00,0x00,0x88,0x01,0x54,0xc8,0x88,0x87,0x30,0x08,0xf5,0x02,0x12,
+0xaf,0x08,0x00,0x24,0xa0,0x0c,0x37,0x02,0x15,0xef,0xd8,0x02,0x01,0x15,0x01,0x62,
+0x00,0x00,0x37,0x88,0x88,0xaf,0x69,0x04,0x00,0x7d,0x02,0x11,0xc0,0x90,0x01,0x32,
+0xcf,0xff,0xf3,0xc1,0x02,0x00,0x73,0x02,0x02,0x60,0x00,0x02,0x0c,0x02,0x11,0x7f,
+0x77,0x00,0x00,0x40,0x03,0x13,0xd0,0xed,0x02,0x12,0xf4,0x08,0x00,0x13,0x3f,0xc1,
+0x04,0x32,0x06,0xff,0x20,0x09,0x00,0x32,0x4f,0x70,0x00,0x3b,0x00,0x21,0xdf,0xd3,
+0x08,0x00,0x82,0x04,0x78,0x88,0xff,0xef,0xf8,0x88,0x74,0xbe,0x00,0x20,0x90,0x9f,
+0x24,0x03,0x00,0x85,0x00,0x25,0xf9,0x09,0x9c,0x03,0x12,0xfe,0x39,0x03,0x0a,0xb1,
+0x03,0x15,0xe5,0xc6,0x03,0x70,0xf4,0x07,0x88,0x88,0x88,0x03,0x30,0x15,0x00,0x11,
+0x07,0x98,0x04,0x20,0x40,0x0f,0x06,0x00,0x01,0x98,0x04,0x11,0x40,0x06,0x00,0x01,
+0x0f,0x00,0x15,0x4f,0x15,0x00,0x14,0xfe,0x15,0x00,0x24,0x00,0x00,0x2a,0x00,0x33,
+0xb8,0x88,0x88,0x15,0x00,0x03,0x0b,0x04,0x03,0x5a,0x03,0x0f,0x15,0x00,0x0c,0x43,
+0xf4,0x78,0x88,0x80,0x15,0x00,0x02,0x27,0x01,0x04,0xe4,0x03,0x06,0x15,0x00,0x16,
+0x07,0x15,0x00,0x16,0x4f,0xe7,0x05,0x25,0x08,0xf8,0xe4,0x02,0x24,0xff,0xf0,0xed,
+0x02,0x32,0x5f,0xff,0x51,0x0a,0x00,0x00,0x49,0x00,0x02,0x21,0x00,0x15,0x0c,0x32,
+0x00,0x12,0x0a,0x96,0x02,0x00,0x32,0x01,0x02,0x52,0x00,0x12,0xf3,0x16,0x06,0x01,
+0x77,0x02,0x33,0x00,0x00,0x0e,0x31,0x02,0x09,0xce,0x04,0x06,0x32,0x01,0x13,0x01,
+0x0a,0x00,0x14,0xf1,0x86,0x00,0x00,0xa0,0x05,0x16,0x08,0xd8,0x04,0x04,0x74,0x02,
+0x35,0xd0,0x00,0x5f,0xf5,0x02,0x15,0x3f,0xee,0x00,0x16,0x3d,0x91,0x02,0x16,0xdf,
+0x2c,0x03,0x23,0x78,0x88,0x01,0x00,0x1a,0x72,0xb5,0x03,0x12,0x6f,0x9d,0x02,0x11,
+0x00,0x76,0x00,0x23,0xe1,0x00,0xef,0x01,0x20,0xcf,0xc3,0x07,0x00,0x2e,0x3d,0xff,
+0xdd,0x02,0x0e,0x9f,0x03,0x00,0x01,0x00,0xb0,0x10,0x1f,0x90,0x09,0xf1,0x01,0xf9,
+0x00,0x9f,0x10,0x1f,0xcc,0x00,0x9c,0xf8,0x00,0x8f,0x00,0x0f,0x80,0x08,0xf0,0x00,
+0x1b,0x00,0x0b,0x01,0x00,0x91,0xb8,0x8f,0xe8,0x8b,0xfb,0x88,0xfe,0x88,0xbf,0x9f,
+0x01,0x72,0x00,0xcc,0x00,0x4f,0x40,0x0c,0xc0,0x32,0x01,0x00,0x09,0x00,0x01,0x12,
+0x00,0x01,0x54,0x01,0x00,0x24,0x00,0x00,0x2d,0x00,0x0d,0x42,0x00,0x00,0x5a,0x00,
+0x10,0x00,0x66,0x03,0x20,0xf1,0x01,0x3b,0x01,0x20,0x0f,0x80,0x0e,0x00,0x00,0x7e,
+0x00,0x0c,0x1b,0x00,0x0e,0xb4,0x03,0x0e,0x76,0x04,0x00,0xb7,0x03,0x0f,0x01,0x00,
+0x03,0x35,0x3a,0xfc,0x20,0x0c,0x00,0x13,0x4b,0x60,0x03,0x00,0x01,0x00,0x35,0x5c,
+0xff,0xff,0x12,0x02,0x11,0x6e,0xa3,0x03,0x02,0x4b,0x01,0x11,0x8e,0x4e,0x00,0x11,
+0x30,0x03,0x08,0x16,0x9f,0x49,0x02,0x23,0x03,0xaf,0x8a,0x02,0x00,0x19,0x02,0x02,
+0x11,0x08,0x01,0x4d,0x00,0x25,0x06,0xdf,0xc8,0x01,0x35,0x00,0x03,0xef,0xec,0x04,
+0x02,0x2c,0x04,0x05,0x94,0x04,0x06,0x2b,0x07,0x13,0xe0,0x57,0x04,0x04,0x5a,0x06,
+0x61,0x00,0x57,0x88,0x88,0x88,0x8c,0x89,0x01,0x16,0x00,0x95,0x02,0x27,0xf9,0x00,
+0x0d,0x00,0x18,0xf2,0x0d,0x00,0x18,0xa0,0x0d,0x00,0x17,0x30,0x0d,0x00,0x27,0xfc,
+0x00,0x0d,0x00,0x18,0xf4,0x0d,0x00,0x03,0x2a,0x04,0x02,0x24,0x03,0x15,0x60,0x0d,
+0x00,0x37,0x05,0xff,0xfe,0x27,0x01,0x2e,0x9f,0xd3,0x3b,0x01,0x11,0xbf,0xa4,0x00,
+0x33,0xe4,0x00,0x00,0xe5,0x07,0x14,0x40,0x09,0x00,0x24,0xf4,0x00,0xf7,0x07,0x14,
+0x40,0x09,0x00,0x14,0xf4,0x09,0x00,0x15,0xfe,0xda,0x00,0x02,0xf4,0x02,0x11,0x88,
+0xf2,0x03,0x0f,0x01,0x00,0x71,0x27,0xbf,0xff,0x00,0x0a,0x0c,0x01,0x00,0x55,0x03,
+0x56,0x77,0x65,0x30,0x76,0x0a,0x11,0x7c,0x29,0x00,0x22,0xc7,0x20,0x29,0x01,0x14,
+0xcf,0x50,0x07,0x11,0x50,0x50,0x05,0x06,0x4b,0x03,0x12,0x30,0x81,0x04,0x51,0xc9,
+0x65,0x44,0x56,0x9c,0xe0,0x03,0x51,0x1c,0xff,0xff,0xfd,0x61,0x35,0x00,0x94,0x16,
+0xdf,0xff,0xff,0xc1,0xdf,0xff,0xfe,0x50,0x6e,0x01,0x65,0xef,0xff,0xfd,0x9f,0xff,
+0x90,0x70,0x00,0xd0,0x09,0xff,0xf9,0x09,0xf6,0x00,0x00,0x00,0x48,0xcd,0xff,0xdc,
+0x84,0xcd,0x03,0x33,0x90,0x00,0x10,0x89,0x02,0x58,0xff,0xe6,0x00,0x00,0x01,0xc5,
+0x03,0x12,0xd3,0xb0,0x01,0x00,0x58,0x02,0x36,0xcc,0xef,0xff,0x2c,0x06,0x51,0xc5,
+0x10,0x00,0x01,0x5c,0x6c,0x01,0x00,0xa3,0x04,0x11,0xe4,0x07,0x00,0x23,0x4e,0xfa,
+0x08,0x06,0x12,0x10,0xcf,0x02,0x16,0x60,0xe3,0x00,0x19,0x22,0xf1,0x00,0x3a,0x1d,
+0xff,0xc1,0xec,0x01,0x09,0x17,0x01,0x02,0x54,0x05,0x05,0x01,0x00,0x38,0xdf,0xff,
+0xfd,0x0f,0x00,0x38,0x5f,0xff,0xf5,0x0f,0x00,0x33,0x04,0xaa,0x40,0x88,0x04,0x17,
+0x44,0x01,0x00,0x17,0x30,0x8a,0x07,0x01,0x32,0x05,0x0a,0x50,0x08,0x34,0x60,0xff,
+0xfb,0x1c,0x09,0x00,0xde,0x09,0x15,0xa1,0x8d,0x03,0x01,0xdc,0x00,0x1c,0xfe,0x05,
+0x06,0x07,0x0f,0x00,0x29,0x05,0xbf,0x0f,0x00,0x2f,0x00,0x0f,0x0f,0x00,0x09,0x2d,
+0x02,0x4f,0x50,0x06,0x08,0x69,0x00,0x00,0xd2,0x03,0x06,0xb3,0x00,0x3a,0x4a,0xff,
+0xd7,0x33,0x02,0x29,0x70,0xbf,0x0f,0x00,0x37,0x30,0x18,0xbb,0x01,0x00,0x1f,0xa4,
+0xf0,0x00,0x3b,0x15,0xbf,0x61,0x04,0x01,0xa5,0x00,0x06,0x0f,0x00,0x29,0x05,0xbf,
+0x0f,0x00,0x2f,0x00,0x0f,0x0f,0x00,0x09,0x29,0x02,0x4f,0x0f,0x00,0x0f,0xf0,0x00,
+0x88,0x15,0x8f,0xa8,0x0b,0x06,0xe0,0x01,0x01,0x0f,0x00,0x06,0xe0,0x01,0x05,0xc6,
+0x0b,0x0f,0x0f,0x00,0x07,0x29,0x02,0x4f,0x0f,0x00,0x0f,0xe0,0x01,0x8b,0x16,0x40,
+0x96,0x00,0x07,0x0f,0x00,0x29,0x05,0xbf,0x0f,0x00,0x2f,0x00,0x0f,0x0f,0x00,0x09,
+0x29,0x02,0x4f,0x0f,0x00,0x0f,0xf0,0x00,0x36,0x50,0xbb,0xbb,0xbb,0xa4,0x00,0x27,
+0x01,0x44,0x01,0x00,0x47,0x30,0x00,0x6f,0xff,0x01,0x00,0x48,0xfd,0x00,0xef,0xff,
+0x01,0x00,0x45,0x60,0xff,0xfb,0xbb,0x01,0x00,0x65,0xbd,0xff,0xa1,0xff,0xf0,0x00,
+0x01,0x00,0x3a,0x08,0xff,0xfe,0x0f,0x00,0x18,0xff,0x0f,0x00,0x29,0x05,0xbf,0x0f,
+0x00,0x2f,0x00,0x0f,0x0f,0x00,0x09,0x3e,0x02,0x4f,0xff,0x4b,0x00,0x09,0x0f,0x00,
+0x16,0xf4,0xb3,0x00,0x49,0x4a,0xff,0xd7,0xff,0x01,0x00,0x29,0x70,0xbf,0x0f,0x00,
+0x37,0x30,0x18,0xbb,0x01,0x00,0x15,0xa4,0x47,0x00,0x29,0x01,0x00,0x01,0x00,0x37,
+0x2d,0xfe,0x30,0x0e,0x00,0x47,0x27,0x7d,0xff,0xfd,0x0f,0x00,0x1a,0x4f,0x82,0x00,
+0x56,0x0e,0xf5,0x3a,0xff,0xfb,0x0f,0x00,0x54,0x07,0xf6,0x00,0x09,0xda,0xbb,0x00,
+0x46,0x00,0x00,0x00,0xed,0x1b,0x00,0x62,0x9f,0xfe,0x50,0x00,0x6f,0x60,0x0c,0x00,
+0x93,0xa4,0x00,0x00,0x8f,0xff,0xff,0x30,0x1e,0xe0,0xf3,0x00,0x83,0xfa,0x10,0x0e,
+0xff,0xff,0xfd,0xbe,0xfe,0x9a,0x00,0x3a,0xff,0xff,0x60,0x6d,0x01,0x91,0xfb,0x0a,
+0xff,0xff,0xf5,0x00,0x00,0x1c,0xf3,0x2f,0x00,0xb1,0xff,0xd4,0x00,0x1c,0xff,0xf9,
+0x00,0x00,0x00,0x2f,0xa0,0x83,0x00,0x50,0x70,0x00,0x00,0x04,0x63,0x0a,0x00,0x29,
+0xbf,0x20,0xc8,0x00,0x66,0x03,0xfb,0x00,0x8f,0xff,0xf5,0x10,0x00,0x66,0x0a,0xf8,
+0x4b,0xff,0xff,0x60,0x10,0x00,0x58,0x0b,0xff,0xff,0xff,0xf6,0x30,0x00,0x18,0x5c,
+0x1f,0x00,0x00,0xb3,0x00,0x29,0xff,0xf5,0x51,0x00,0x23,0x11,0x10,0xda,0x00,0x40,
+0x8c,0xef,0xfe,0xa6,0x09,0x00,0x10,0x09,0x9d,0x00,0x00,0x2e,0x01,0xf0,0x04,0x0c,
+0xff,0xff,0xf4,0xff,0xff,0xff,0x40,0x00,0x0a,0xff,0xff,0xff,0x05,0xff,0xff,0xfe,
+0x10,0x02,0x28,0x01,0xf0,0x39,0x05,0xff,0xff,0xf8,0x00,0x9f,0xff,0xff,0xff,0x00,
+0x06,0xff,0xff,0xe0,0x0e,0xff,0xfc,0xff,0xf0,0x16,0x07,0xff,0xff,0x21,0xff,0xf8,
+0x09,0xff,0x01,0xf6,0x07,0xff,0xf5,0x4f,0xff,0xd1,0x09,0xf0,0x1f,0x70,0x6f,0xff,
+0x86,0xff,0xff,0xd1,0x07,0x01,0x70,0x5f,0xff,0xf9,0x7f,0xff,0xff,0xd1,0x00,0x00,
+0x3f,0xff,0xff,0xa7,0xff,0xff,0xff,0xc1,0x00,0x2e,0xff,0xff,0xfb,0x7f,0xbc,0x01,
+0x50,0x05,0xff,0xff,0xff,0xb7,0x64,0x00,0x00,0x4c,0x00,0xf0,0x0d,0xfa,0x6f,0xff,
+0xff,0x40,0x30,0x03,0x07,0xff,0xff,0xa4,0xff,0xff,0x40,0x4e,0x01,0xe2,0x08,0xff,
+0xf8,0x2f,0xff,0x70,0x4f,0xf0,0x1f,0x90,0x2f,0x3d,0x01,0x80,0x7f,0xff,0x01,0xb0,
+0x2e,0xff,0xf3,0x0a,0xad,0x01,0x00,0x43,0x00,0x01,0xb7,0x01,0x00,0x09,0x00,0x20,
+0x90,0x00,0x7e,0x02,0xf2,0x04,0x2e,0xff,0xff,0xf2,0x00,0x01,0xdf,0xff,0xff,0x3e,
+0xff,0xff,0xf7,0x00,0x00,0x00,0xaf,0xff,0xff,0x09,0x00,0x61,0x00,0x28,0xce,0xff,
+0xec,0x82,0xe5,0x00,0xff,0x04,0x1a,0xcc,0xcc,0xca,0x10,0x00,0x00,0x02,0x44,0x44,
+0x49,0xff,0xff,0xff,0xf9,0x44,0x44,0x42,0xff,0x01,0x00,0x01,0x15,0x9b,0x50,0x02,
+0x1a,0x80,0x98,0x02,0x01,0x01,0x00,0x34,0xf8,0x00,0x8f,0x0b,0x00,0x19,0x80,0x15,
+0x00,0x60,0x66,0xff,0xd1,0xdf,0xf6,0x6f,0x15,0x00,0x61,0xf4,0x4f,0xfc,0x0c,0xff,
+0x44,0x15,0x00,0x6f,0x44,0xff,0xc0,0xcf,0xf4,0x4f,0x15,0x00,0x45,0xa5,0xf6,0x6f,
+0xfd,0x1d,0xff,0x66,0xff,0xf8,0x00,0x7f,0x1f,0x03,0x14,0x05,0x0a,0x00,0x12,0xf5,
+0xcb,0x01,0x00,0xe9,0x00,0x06,0xc6,0x00,0x26,0x6e,0xe5,0x0c,0x00,0x17,0x7f,0x2a,
+0x02,0x17,0x7f,0x37,0x02,0x35,0x1f,0xff,0xff,0x25,0x02,0x63,0x50,0x3f,0xff,0xff,
+0xff,0xe0,0x24,0x00,0x54,0xb0,0x3f,0xff,0xff,0xfe,0x30,0x00,0x00,0x0d,0x00,0x13,
+0x60,0x3c,0x00,0x00,0x0d,0x00,0x13,0x70,0x0c,0x00,0x00,0x0d,0x00,0x06,0x0c,0x00,
+0x36,0xff,0xb0,0x10,0x0c,0x00,0x27,0xff,0x50,0x0c,0x00,0x1f,0x70,0x0c,0x00,0x2e,
+0x17,0x5f,0x0c,0x00,0x17,0x08,0x0c,0x00,0x27,0x00,0xaf,0x0c,0x00,0x17,0x0b,0x0c,
+0x00,0x27,0x00,0xdf,0x0c,0x00,0x17,0x0f,0x0c,0x00,0x5a,0x00,0xbf,0xdb,0xa8,0x50,
+0x31,0x04,0x07,0xaf,0x04,0x05,0x71,0x04,0x10,0xfe,0x0f,0x02,0x36,0x3e,0xff,0xff,
+0xf5,0x01,0x27,0x00,0x03,0xd5,0x03,0x13,0xfe,0x1d,0x00,0x40,0xcf,0xff,0xff,0xfc,
+0x08,0x00,0x02,0x1d,0x00,0x50,0xf7,0x06,0xff,0xff,0x60,0x32,0x02,0x02,0x1d,0x00,
+0x40,0xc0,0x00,0x6f,0xf6,0x5b,0x03,0x12,0xff,0x3a,0x00,0x41,0xf6,0x00,0x06,0x60,
+0x95,0x05,0x13,0x3f,0x83,0x05,0x30,0x00,0x00,0x06,0x08,0x00,0x00,0xaa,0x00,0x02,
+0xcb,0x03,0x1e,0x6f,0x0f,0x00,0x0c,0x2d,0x00,0x29,0x03,0xff,0x4b,0x00,0x0b,0x69,
+0x00,0x02,0x87,0x00,0x10,0xf8,0x87,0x00,0x00,0x3e,0x01,0x0c,0xa5,0x00,0x0c,0xc3,
+0x00,0x0b,0xe1,0x00,0x0b,0xff,0x00,0x14,0x07,0x09,0x00,0x13,0x7f,0x21,0x00,0x14,
+0x07,0x39,0x00,0xa3,0x7f,0xf4,0x08,0xf0,0x0e,0x90,0x0f,0xff,0x07,0xff,0x09,0x00,
+0x14,0x7f,0x09,0x00,0x16,0xff,0x09,0x00,0x7f,0xfa,0x8c,0xf8,0x8f,0xc8,0x8f,0xff,
+0x01,0x00,0x62,0x14,0xef,0xc7,0x00,0x14,0x8f,0xde,0x00,0x26,0x08,0xef,0xd7,0x01,
+0x17,0x00,0xe2,0x05,0x05,0xfa,0x05,0x17,0xf1,0x0c,0x00,0x52,0xff,0x10,0x00,0x00,
+0x03,0x0c,0x00,0x74,0x06,0xff,0xf1,0x00,0x00,0x1c,0xf7,0x6d,0x02,0x52,0x10,0x00,
+0x1d,0xff,0x90,0x8e,0x05,0x65,0xff,0xf1,0x00,0x2d,0xff,0xf9,0x19,0x00,0x50,0x2e,
+0xff,0xff,0xa2,0x22,0x01,0x00,0x47,0x2b,0xff,0xf1,0x3e,0x8b,0x00,0x17,0x1d,0x0c,
+0x00,0x18,0xf1,0x0f,0x01,0x00,0x5b,0x04,0x22,0xd9,0x99,0x01,0x00,0x38,0x60,0x00,
+0x7f,0xba,0x03,0x13,0x6f,0x64,0x00,0x02,0xfb,0x02,0x17,0xf8,0xa7,0x00,0xa0,0x4a,
+0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -1131,11 +1228,22 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 1524, .range_length = 62127, .glyph_id_start = 143, .list_length = 63, .type = 3, .unicode_list = 1648, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[33980] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 2239, .size = 4064, .comp_size = 2905 },
+{ .bitmap_start = 4064, .comp_offset = 5144, .size = 4054, .comp_size = 2626 },
+{ .bitmap_start = 8118, .comp_offset = 7770, .size = 3982, .comp_size = 2804 },
+{ .bitmap_start = 12100, .comp_offset = 10574, .size = 4027, .comp_size = 2540 },
+{ .bitmap_start = 16127, .comp_offset = 13114, .size = 4047, .comp_size = 1995 },
+{ .bitmap_start = 20174, .comp_offset = 15109, .size = 3862, .comp_size = 1785 },
+{ .bitmap_start = 24036, .comp_offset = 16894, .size = 3961, .comp_size = 1585 },
+{ .bitmap_start = 27997, .comp_offset = 18479, .size = 2029, .comp_size = 954 },
+};
+
+static uint8_t etxUncompBuf[3954] __SDRAMFONTS;
 
 const etxLz4Font lv_font_he_bold_STD = {
-.uncomp_size = 33652,
-.comp_size = 17884,
+.uncomp_size = 3626,
+.comp_size = 2239,
 .line_height = 28,
 .base_line = 6,
 .subpx = 0,
@@ -1148,12 +1256,13 @@ const etxLz4Font lv_font_he_bold_STD = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 36,
-.glyph_bitmap = 1774,
-.class_pair_values = 31800,
-.left_class_mapping = 33240,
-.right_class_mapping = 33446,
+.class_pair_values = 1774,
+.left_class_mapping = 3214,
+.right_class_mapping = 3420,
+.block_num = 8,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 33980,
+.lvglFontBufSize = 3954,
 };
@@ -76,1414 +76,1708 @@ static const uint8_t lz4FontData[] ={
 0x1b,0x1a,0x00,0x00,0x9a,0xea,0x80,0x1d,0x1b,0x24,0x03,0xf6,0x80,0xec,0xe0,0x1b,
 0x88,0x02,0xf2,0x13,0xb8,0xed,0x00,0x28,0x22,0x1a,0x03,0x00,0x72,0xef,0x80,0x28,
 0x26,0x24,0x03,0xf6,0x1e,0xf2,0x00,0x23,0x21,0x1a,0x00,0x00,0xcb,0xf3,0x00,0x29,
-0x23,0x1a,0x03,0x00,0x92,0xf5,0xd0,0x00,0x40,0xd7,0xf6,0x80,0x1a,0x30,0x00,0xf0,
-0x37,0x0f,0xf8,0x00,0x29,0x25,0x1a,0x03,0x00,0xf0,0xf9,0x00,0x1c,0x1a,0x1a,0xff,
-0x00,0x42,0xfb,0xb0,0x1a,0x19,0x21,0x01,0x00,0x0e,0xff,0xff,0xff,0x40,0xdf,0xff,
-0xff,0xf3,0x0d,0xff,0xff,0xff,0x30,0xcf,0xff,0xff,0xf2,0x0c,0xff,0xff,0xff,0x20,
-0xbf,0xff,0xff,0xf1,0x0b,0xff,0xff,0xff,0x10,0xaf,0xff,0xff,0xf0,0x0a,0xff,0xff,
-0xff,0x00,0x9f,0xff,0xff,0xf0,0x09,0x09,0x00,0xf6,0x2c,0x8f,0xff,0xff,0xe0,0x08,
-0xff,0xff,0xfe,0x00,0x7f,0xff,0xff,0xd0,0x07,0xff,0xff,0xfc,0x00,0x6f,0xff,0xff,
-0xc0,0x05,0xff,0xff,0xfb,0x00,0x5f,0xff,0xff,0xb0,0x04,0xff,0xff,0xfa,0x00,0x4f,
-0xff,0xff,0xa0,0x03,0xff,0xff,0xf9,0x00,0x3f,0xff,0xff,0x90,0x02,0xff,0xff,0xf8,
-0x00,0x1d,0xdd,0xdd,0x60,0x00,0x01,0x00,0x71,0x21,0x00,0x00,0x08,0xff,0xfc,0x20,
-0x48,0x00,0xe0,0xff,0xff,0xff,0xf5,0x1f,0xff,0xff,0xff,0x70,0xef,0xff,0xff,0xf5,
-0x06,0x51,0x00,0xfb,0x02,0x06,0xdf,0xe9,0x10,0x8f,0xff,0xf3,0x00,0xdf,0xff,0xd8,
-0xff,0xff,0x30,0x0d,0xff,0xfd,0x0d,0x00,0xf2,0x29,0xf1,0x00,0xdf,0xff,0xb8,0xff,
-0xff,0x00,0x0d,0xff,0xfa,0x8f,0xff,0xe0,0x00,0xdf,0xff,0x88,0xff,0xfd,0x00,0x0d,
-0xff,0xf7,0x8f,0xff,0xb0,0x00,0xdf,0xff,0x58,0xff,0xfa,0x00,0x0d,0xff,0xf4,0x8f,
-0xff,0x80,0x00,0xdf,0xff,0x28,0xff,0xf6,0x00,0x0d,0xff,0xf1,0x7f,0xff,0x50,0x00,
-0xdf,0xfe,0x7c,0x00,0x72,0xff,0xff,0x50,0x00,0x2f,0xff,0xf2,0x0d,0x00,0x72,0x1f,
-0xff,0xf2,0x00,0x04,0xff,0xff,0x0d,0x00,0x01,0x09,0x00,0x32,0x7f,0xff,0xc0,0x0e,
-0x00,0x00,0x09,0x00,0x32,0x0a,0xff,0xfa,0x0d,0x00,0x82,0x0a,0xff,0xf9,0x00,0x00,
-0xdf,0xff,0x70,0x0e,0x00,0x00,0x09,0x00,0x32,0x0f,0xff,0xf4,0x0d,0x00,0x00,0x09,
-0x00,0x41,0x02,0xff,0xff,0x10,0x0d,0x00,0x01,0x09,0x00,0x32,0x5f,0xff,0xf0,0x1b,
-0x00,0x30,0x5f,0xff,0xe0,0xe8,0x00,0xf6,0x04,0x00,0x00,0x00,0x01,0x11,0x11,0x18,
-0xff,0xfc,0x11,0x11,0xbf,0xff,0xa1,0x11,0x10,0x00,0xbf,0xff,0x01,0x00,0x27,0xa0,
-0x0b,0x0d,0x00,0x1f,0xfa,0x1b,0x00,0x09,0xa2,0x00,0x00,0x06,0xff,0xfd,0x00,0x00,
-0x9f,0xff,0xb0,0x5e,0x00,0x72,0x9f,0xff,0xa0,0x00,0x0c,0xff,0xf8,0x0d,0x00,0x30,
-0x0c,0xff,0xf7,0xdb,0x00,0x14,0x40,0xe4,0x00,0x52,0x40,0x00,0x2f,0xff,0xf1,0x0d,
-0x00,0x00,0x09,0x00,0x23,0x05,0xff,0xfe,0x00,0x01,0x09,0x00,0x11,0x8f,0x43,0x00,
-0x17,0x8f,0x5e,0x00,0x27,0xe0,0x08,0x0d,0x00,0x1f,0xfe,0x1b,0x00,0x09,0xc0,0x01,
-0x11,0x14,0xff,0xff,0x11,0x11,0x7f,0xff,0xd1,0x11,0x11,0x51,0x00,0x54,0x6f,0xff,
-0xd0,0x00,0x09,0x27,0x01,0x82,0x09,0xff,0xfb,0x00,0x00,0xcf,0xff,0x80,0x0e,0x00,
-0x00,0x09,0x00,0x32,0x0f,0xff,0xf5,0x0d,0x00,0x81,0x0e,0xff,0xf5,0x00,0x01,0xff,
-0xff,0x20,0x0d,0x00,0x01,0x09,0x00,0x14,0x4f,0x27,0x01,0x00,0x09,0x00,0x32,0x07,
-0xff,0xfd,0x0d,0x00,0x01,0x09,0x00,0x38,0xaf,0xff,0xa0,0xe4,0x00,0x14,0xf7,0xe4,
-0x00,0x12,0xf8,0xbf,0x01,0x24,0x00,0x00,0x39,0x00,0x1f,0x70,0x0c,0x00,0x24,0x62,
-0x03,0x8b,0xef,0xff,0xea,0x60,0x0b,0x00,0x11,0xcf,0xd9,0x00,0x12,0x70,0xcd,0x00,
-0x01,0x01,0x00,0x11,0xfc,0x6c,0x01,0x03,0x01,0x00,0x10,0xc0,0x42,0x01,0x03,0x01,
-0x00,0x10,0xf8,0x9b,0x00,0x50,0xff,0xff,0xc8,0x7a,0xff,0x1d,0x03,0xd0,0x01,0xff,
-0xff,0xff,0xf6,0x00,0x00,0x2e,0xff,0xff,0xff,0x80,0x05,0xb0,0x01,0x01,0x43,0x02,
-0x01,0x16,0x03,0x21,0xff,0x50,0x27,0x02,0x30,0xff,0xf0,0x08,0x58,0x03,0x01,0xc9,
-0x00,0x30,0xff,0xf2,0x07,0x6d,0x03,0x02,0x79,0x01,0x10,0xf4,0x5f,0x00,0x12,0x90,
-0x19,0x02,0x44,0x10,0x02,0xff,0xff,0x4d,0x02,0x01,0x35,0x00,0x24,0xff,0x81,0xb0,
-0x00,0x00,0x99,0x00,0x14,0x81,0x82,0x02,0x00,0x01,0x00,0x12,0xa3,0x0d,0x00,0x02,
-0x26,0x02,0x11,0xc3,0x0c,0x00,0x03,0x9f,0x01,0x11,0x91,0x0d,0x00,0x11,0x3c,0x0c,
-0x00,0x12,0xfd,0x66,0x01,0x11,0x3b,0x0d,0x00,0x12,0xe1,0x33,0x00,0x23,0x28,0xef,
-0xd9,0x00,0x10,0x00,0xdd,0x00,0x26,0xef,0xff,0x48,0x01,0x12,0x1c,0xe5,0x00,0x04,
-0x99,0x01,0x81,0xff,0xf1,0xbe,0xee,0xee,0xd0,0x00,0x00,0xeb,0x00,0x32,0xf3,0xbf,
-0xff,0xa6,0x01,0x00,0xb4,0x00,0x12,0xaf,0xa7,0x00,0x00,0x0c,0x00,0x32,0xf3,0x6f,
-0xff,0xf4,0x01,0x00,0x33,0x04,0x12,0x2f,0x4d,0x00,0x10,0x06,0x2d,0x02,0x10,0x0b,
-0xab,0x02,0x30,0x41,0x13,0x9f,0xdf,0x00,0x16,0x03,0x38,0x02,0x34,0x20,0x00,0x7f,
-0x0b,0x00,0x15,0xf7,0xb3,0x00,0x02,0x02,0x01,0x12,0x5e,0x0b,0x00,0x11,0xe6,0x80,
-0x00,0x10,0x6b,0x0b,0x00,0x14,0xc7,0xa5,0x01,0x11,0xdf,0x3b,0x01,0x04,0x4d,0x02,
-0x1f,0x00,0x0c,0x00,0x16,0x57,0x01,0x7c,0xef,0xec,0x82,0x6f,0x04,0x01,0x63,0x00,
-0x15,0x80,0x0f,0x00,0x11,0x05,0x71,0x00,0x15,0xf9,0x10,0x00,0x12,0x1e,0x82,0x00,
-0x00,0x9b,0x01,0x12,0x20,0x06,0x02,0x40,0xfc,0x20,0x19,0xff,0x24,0x03,0x31,0x03,
-0xfc,0x50,0x08,0x01,0x10,0xf1,0x5c,0x00,0x61,0xe0,0x00,0x00,0x0d,0xff,0xf6,0x7e,
-0x01,0x10,0xc0,0x05,0x01,0x10,0xf0,0x05,0x00,0x11,0xd0,0x77,0x00,0x10,0xb0,0x2f,
-0x04,0x32,0xf0,0x00,0x03,0xec,0x01,0x05,0x20,0x00,0x03,0x9e,0x03,0x05,0x40,0x00,
-0x33,0x7f,0xff,0xd0,0x60,0x00,0x63,0x30,0x2a,0xff,0xff,0xb0,0x02,0xb0,0x03,0x13,
-0x0e,0x80,0x00,0x13,0x0c,0x94,0x00,0x13,0x04,0x6c,0x02,0x32,0x6f,0xff,0xe0,0xa1,
-0x00,0x20,0x4e,0xff,0x20,0x05,0x15,0x02,0xdf,0x03,0x74,0x00,0x6a,0xde,0xdb,0x71,
-0x00,0x0b,0x76,0x03,0x03,0x01,0x00,0x14,0x6f,0xeb,0x01,0x05,0xcb,0x01,0x18,0x50,
-0x10,0x00,0x39,0x0b,0xff,0xfb,0x2f,0x00,0x84,0x5f,0xff,0xf1,0x00,0x4a,0xdf,0xfd,
-0xa4,0x2f,0x00,0x40,0xef,0xff,0x60,0x1b,0x68,0x00,0x14,0xb1,0x70,0x02,0x34,0xfc,
-0x00,0xcf,0x0d,0x03,0x01,0x8c,0x02,0x13,0xf2,0xb7,0x01,0x02,0x44,0x03,0xb2,0xef,
-0xff,0x70,0x0f,0xff,0xff,0x50,0x06,0xff,0xff,0xe0,0xfa,0x03,0x30,0xfc,0x00,0x4f,
-0xdc,0x01,0x00,0xac,0x05,0x01,0x2f,0x00,0x30,0xf3,0x00,0x6f,0x66,0x05,0x32,0x3f,
-0xff,0xf5,0xd7,0x02,0x11,0x80,0x23,0x01,0x21,0x00,0x2f,0x10,0x00,0x10,0x09,0xe6,
-0x03,0x07,0x10,0x00,0x10,0x3f,0x36,0x00,0x07,0x30,0x00,0x10,0xdf,0x1b,0x02,0x01,
-0x50,0x00,0x10,0x7f,0x1a,0x00,0x31,0x01,0x9f,0xfe,0x6a,0x05,0x41,0xff,0x60,0x04,
-0xef,0x70,0x00,0x21,0x02,0xb4,0x45,0x00,0x1a,0xff,0xd9,0x01,0x17,0xdf,0xb0,0x00,
-0x00,0x01,0x00,0x08,0xd0,0x00,0x01,0x01,0x00,0x06,0xf0,0x00,0x46,0x28,0xce,0xff,
-0xda,0x92,0x06,0x11,0x09,0x03,0x04,0x14,0x40,0x0b,0x01,0x14,0xdf,0xa9,0x02,0x03,
-0x77,0x04,0x02,0x01,0x00,0x14,0x50,0x67,0x01,0x03,0x18,0x05,0x05,0x74,0x00,0x34,
-0xfc,0x99,0xef,0xc1,0x03,0x11,0x02,0x90,0x00,0x11,0x0c,0x2a,0x04,0x01,0xca,0x01,
-0x00,0x6f,0x05,0x14,0x03,0x6d,0x02,0x20,0x06,0xff,0x84,0x01,0x17,0x01,0x1e,0x00,
-0x11,0xfc,0x06,0x00,0x15,0xf5,0x3c,0x00,0x33,0x20,0x00,0x1d,0x71,0x03,0x01,0x5a,
-0x00,0x34,0xb0,0x03,0xdf,0x70,0x01,0x00,0x78,0x00,0x21,0xf7,0x9f,0x41,0x00,0x08,
-0x96,0x00,0x14,0xb0,0x2c,0x03,0x04,0xa0,0x04,0x14,0x00,0xbe,0x06,0x07,0xd1,0x00,
-0x20,0x00,0x02,0xca,0x01,0x03,0xf3,0x06,0x03,0x58,0x04,0x01,0x70,0x05,0x35,0xbd,
-0xdd,0xdb,0xea,0x04,0x10,0xb0,0x5c,0x05,0x15,0xfd,0xe0,0x00,0x10,0xfa,0xa8,0x00,
-0x11,0xfc,0x95,0x00,0x20,0xe2,0x4f,0xd6,0x00,0x01,0xda,0x07,0x10,0x0a,0xa8,0x02,
-0x10,0x05,0x1d,0x01,0x10,0x09,0x21,0x01,0x11,0x0f,0xc2,0x00,0x00,0x6c,0x00,0x61,
-0x6f,0xff,0xff,0xf3,0x00,0x3f,0x82,0x00,0x14,0x08,0x20,0x01,0x12,0x4f,0x91,0x00,
-0x13,0xaf,0xa6,0x01,0x12,0x3f,0x33,0x04,0x13,0x0b,0x11,0x04,0x22,0x2f,0xff,0x0e,
-0x06,0x12,0xdf,0xb8,0x00,0x00,0x81,0x08,0x61,0xd2,0x00,0x00,0x02,0xbf,0xff,0x01,
-0x01,0x10,0x07,0x25,0x00,0x34,0xb8,0x79,0xcf,0xd6,0x00,0x17,0xef,0x85,0x06,0x10,
-0x50,0x26,0x02,0x05,0x01,0x00,0x00,0xd8,0x00,0x14,0x03,0x1f,0x00,0x55,0xef,0xff,
-0xff,0xfd,0x10,0x1a,0x02,0x23,0xc4,0x1d,0x22,0x01,0x61,0x16,0xad,0xef,0xfe,0xc9,
-0x61,0xcd,0x00,0x47,0xf8,0x8f,0xff,0xf7,0x03,0x00,0x20,0xf6,0x8f,0x2b,0x08,0xa1,
-0xf3,0x8f,0xff,0xf2,0x8f,0xff,0xf1,0x8f,0xff,0xf0,0x03,0x00,0x25,0xd0,0x8f,0x11,
-0x05,0x02,0x63,0x05,0x11,0xc0,0x45,0x01,0x11,0xdf,0xda,0x02,0x32,0x3e,0xff,0xf8,
-0x70,0x01,0x12,0xfc,0x3b,0x04,0x11,0xc1,0xf2,0x03,0x12,0xfd,0xdf,0x01,0x12,0xf2,
-0x14,0x00,0x11,0x70,0x26,0x05,0x12,0xfd,0x86,0x03,0x21,0xf6,0x00,0xcf,0x00,0x12,
-0xe0,0xea,0x03,0x12,0x90,0x80,0x01,0x11,0x40,0x14,0x06,0x12,0xfe,0xe8,0x01,0x12,
-0xfa,0x29,0x00,0x12,0xf7,0x9c,0x04,0x12,0xf4,0xd5,0x05,0x12,0xf1,0x2c,0x01,0x00,
-0x0d,0x02,0x15,0x0d,0x3e,0x00,0x12,0xc0,0x07,0x03,0x16,0xb0,0x07,0x00,0x11,0x1f,
-0x78,0x06,0x0b,0x07,0x00,0x06,0x23,0x00,0x12,0xc0,0x38,0x00,0x12,0xd0,0x32,0x02,
-0x12,0xe0,0x49,0x06,0x12,0xf0,0x92,0x00,0x26,0xf2,0x00,0x7e,0x02,0x03,0x3c,0x02,
-0x12,0xbf,0x3f,0x03,0x12,0x7f,0xd0,0x08,0x12,0x1f,0xf5,0x02,0x12,0x0c,0x4e,0x00,
-0x13,0x05,0x43,0x02,0x12,0xdf,0x2b,0x00,0x12,0x5f,0xbf,0x01,0x12,0x0c,0x72,0x00,
-0x12,0x02,0xe8,0x00,0x00,0x3a,0x00,0x12,0x30,0x65,0x00,0x17,0xf4,0x50,0x00,0x32,
-0x0b,0xff,0xf6,0x96,0x02,0x12,0xf1,0x8f,0x02,0x05,0x93,0x07,0x23,0x0d,0x70,0x92,
-0x05,0x13,0xc1,0xd8,0x06,0x22,0xe2,0x00,0xf0,0x00,0x00,0x08,0x00,0x00,0x0c,0x03,
-0x31,0xd1,0x00,0x00,0x62,0x07,0x13,0xa0,0xb8,0x02,0x12,0x50,0x51,0x05,0x13,0xfe,
-0xe2,0x04,0x13,0xf8,0xbe,0x03,0x12,0xf1,0xe9,0x08,0x02,0x0c,0x04,0x12,0xcf,0x1f,
-0x00,0x13,0x07,0x84,0x00,0x13,0x2f,0x3e,0x00,0x33,0xdf,0xff,0xfe,0x49,0x07,0x13,
-0xf3,0xaa,0x00,0x12,0x70,0x01,0x01,0x13,0xfa,0x26,0x00,0x12,0xd0,0x09,0x01,0x12,
-0xff,0xd6,0x09,0x02,0x54,0x00,0x12,0xef,0xe6,0x00,0x13,0x0d,0x35,0x00,0x12,0xdf,
-0xba,0x01,0x13,0x0d,0x5b,0x00,0x12,0xdf,0xee,0x00,0x13,0x0e,0x1e,0x00,0x03,0x2d,
-0x00,0x12,0x0f,0x62,0x01,0x22,0x01,0xff,0x71,0x00,0x12,0x3f,0x86,0x01,0x13,0x05,
-0x06,0x04,0x12,0x8f,0xc5,0x00,0x13,0x0b,0x61,0x00,0x12,0xff,0xf9,0x08,0x12,0x3f,
-0xbc,0x00,0x13,0x08,0x64,0x01,0x12,0xef,0x38,0x01,0x15,0x4f,0x2c,0x00,0x17,0xd0,
-0xac,0x01,0x33,0xdf,0xff,0xfc,0x49,0x00,0x12,0x20,0x88,0x01,0x12,0x60,0x1f,0x04,
-0x12,0x90,0x8b,0x00,0x14,0xa0,0x39,0x09,0x01,0xa7,0x02,0x12,0x60,0x56,0x09,0x15,
-0x10,0xcd,0x02,0x13,0x2f,0x8c,0x01,0x01,0xe0,0x01,0x03,0x9d,0x09,0x02,0xc6,0x0a,
-0x05,0x0b,0x00,0x14,0xf3,0x0b,0x00,0x12,0x0e,0x8e,0x00,0x50,0x01,0x81,0x00,0x00,
-0x0d,0x0b,0x00,0xf2,0x0a,0x04,0x10,0x06,0xff,0xb4,0x00,0x0c,0xff,0xf1,0x00,0x17,
-0xdf,0x60,0x0b,0xff,0xff,0xe7,0x1b,0xff,0xf0,0x3a,0xff,0xff,0xb0,0x0f,0x37,0x09,
-0x00,0xbb,0x03,0x15,0x2c,0x98,0x03,0x42,0xf4,0x00,0x16,0xae,0x35,0x0a,0x10,0xa6,
-0x7e,0x00,0x10,0x39,0xda,0x07,0x15,0x30,0xcc,0x08,0x16,0x60,0xa8,0x04,0x14,0xf3,
-0x0e,0x05,0x42,0x8c,0xff,0xfe,0x10,0x91,0x07,0x23,0xfd,0x03,0xdb,0x04,0x51,0xcf,
-0xff,0xf4,0x00,0x8f,0xe7,0x01,0x10,0x09,0xda,0x00,0x11,0x0e,0x11,0x01,0x10,0x07,
-0x28,0x00,0x12,0x05,0x44,0x00,0x20,0x2c,0xf5,0x38,0x02,0x11,0xd3,0x43,0x00,0x00,
-0x10,0x00,0x2e,0x19,0x00,0x01,0x00,0x17,0x2f,0x60,0x09,0x0f,0x0c,0x00,0x49,0x16,
-0xaf,0x95,0x04,0x1f,0xfb,0x0c,0x00,0x29,0xcf,0x12,0x22,0x22,0x22,0x4f,0xff,0xff,
-0xf6,0x22,0x22,0x22,0x21,0xc0,0x00,0x59,0x01,0x70,0x04,0x00,0x5d,0x0a,0x0d,0x09,
-0x00,0x30,0xfe,0x00,0x0d,0xc6,0x02,0x00,0xc3,0x02,0x00,0xbd,0x04,0x50,0x0a,0xff,
-0xff,0xd0,0x01,0x8e,0x02,0x50,0x9f,0xff,0xfb,0x00,0x0d,0x88,0x02,0x20,0x06,0xef,
-0xdb,0x01,0x50,0x30,0x00,0x00,0x37,0x77,0x01,0x00,0x22,0x76,0x6f,0x12,0x02,0x0f,
-0x07,0x00,0x09,0x30,0x00,0x01,0x33,0xd6,0x01,0x30,0xfe,0x40,0x08,0x0a,0x06,0x50,
-0xef,0xff,0xff,0xf8,0x0f,0x13,0x0a,0xd4,0xdf,0xff,0xff,0xf7,0x05,0xff,0xff,0xfe,
-0x10,0x04,0xcf,0xe9,0x10,0x87,0x02,0x24,0xff,0x20,0xe6,0x06,0x14,0xc0,0x19,0x0c,
-0x1f,0xf7,0x1c,0x00,0x12,0x14,0x10,0x5c,0x02,0x0f,0x1c,0x00,0x4a,0x1f,0xf6,0x1c,
-0x00,0x3e,0x1f,0xaf,0x1c,0x00,0x01,0x1b,0xb0,0x1c,0x00,0x1f,0x0f,0x1c,0x00,0x2d,
-0x36,0x01,0x88,0x88,0x05,0x09,0x62,0x04,0x9c,0xef,0xed,0xb7,0x20,0x90,0x05,0x11,
-0xef,0x03,0x08,0x17,0x10,0xd5,0x02,0x15,0xe3,0x84,0x0c,0x02,0xd2,0x0c,0x03,0x07,
-0x09,0x00,0x9a,0x04,0x11,0x01,0xac,0x07,0x11,0x9d,0xaa,0x07,0x12,0x07,0xc7,0x07,
-0x22,0x7f,0xff,0x33,0x02,0x22,0xff,0x20,0x8d,0x07,0x22,0x50,0x1f,0x67,0x05,0x10,
-0x02,0x27,0x0d,0x15,0x5f,0xc8,0x04,0x00,0x6a,0x07,0x02,0x63,0x04,0x00,0x69,0x10,
-0x13,0x9f,0x13,0x05,0x00,0x14,0x00,0x16,0xaf,0x78,0x0c,0x04,0x84,0x0c,0x00,0x55,
-0x00,0x2f,0xf4,0xcf,0x0c,0x00,0x34,0x08,0x54,0x00,0x08,0x6c,0x00,0x04,0x84,0x00,
-0x00,0xb0,0x0d,0x00,0x10,0x00,0x04,0x9c,0x00,0x13,0x5f,0xe0,0x06,0x00,0xb4,0x00,
-0x08,0xcc,0x00,0x08,0xe4,0x00,0x12,0x06,0xfc,0x00,0x11,0x6f,0x27,0x0f,0x00,0x42,
-0x01,0x22,0xa8,0x9d,0xbe,0x08,0x16,0x5f,0x2c,0x01,0x09,0x44,0x01,0x22,0x00,0x9f,
-0x0b,0x00,0x1c,0xf3,0x74,0x01,0x00,0x8c,0x01,0x35,0xfd,0xb7,0x20,0x9b,0x01,0x23,
-0x17,0xcc,0x1e,0x0d,0x10,0xfc,0x1c,0x00,0x11,0xaf,0x7c,0x08,0x11,0x39,0xd1,0x0d,
-0x22,0x02,0x8e,0x4d,0x03,0x2f,0x1f,0xff,0x08,0x00,0x06,0x20,0xc7,0x2f,0x08,0x00,
-0x21,0xfb,0x61,0xae,0x09,0x33,0x05,0x00,0x00,0xb6,0x09,0x0f,0x08,0x00,0xa6,0x62,
-0x01,0x6a,0xdf,0xfe,0xdb,0x83,0x19,0x01,0x12,0x19,0xf0,0x0e,0x15,0x50,0x26,0x0d,
-0x03,0x55,0x0e,0x15,0x5f,0x44,0x11,0x08,0x2c,0x0a,0x11,0x50,0x93,0x02,0x31,0xfd,
-0x98,0xae,0xff,0x0a,0x12,0x06,0xbf,0x0f,0x11,0x0a,0x43,0x0a,0x12,0xcf,0x7f,0x09,
-0x10,0x0d,0x9a,0x06,0x12,0x1f,0xb9,0x07,0x00,0xc9,0x01,0x23,0xf8,0x03,0x51,0x00,
-0x01,0x08,0x00,0x13,0x5f,0x15,0x0c,0x01,0xe8,0x0a,0x34,0x11,0x11,0x11,0x4d,0x0e,
-0x05,0x68,0x0d,0x13,0xbf,0x3e,0x02,0x03,0x25,0x00,0x27,0xfc,0x00,0xad,0x0b,0x17,
-0x40,0x6c,0x0c,0x14,0xb0,0x88,0x0f,0x07,0x97,0x0b,0x10,0x04,0x09,0x13,0x07,0x0c,
-0x00,0x17,0xf8,0xda,0x0b,0x17,0xfa,0x0c,0x00,0x14,0xfc,0x0c,0x00,0x16,0xef,0x0c,
-0x00,0x1b,0x02,0x0c,0x00,0x2e,0xfd,0x10,0x0c,0x00,0x2f,0x01,0xdf,0x0c,0x00,0x07,
-0x23,0xfe,0x20,0x0c,0x00,0x10,0xcf,0xb6,0x02,0x11,0x88,0x01,0x00,0x27,0x50,0x9f,
-0x92,0x06,0x17,0x0a,0x70,0x0b,0x2f,0xb0,0xaf,0x19,0x00,0x11,0x02,0xc5,0x02,0x32,
-0xfe,0xdb,0x73,0x5a,0x00,0x12,0x6e,0xa9,0x01,0x14,0x40,0x65,0x00,0x03,0x9c,0x01,
-0x01,0x27,0x03,0x04,0x7f,0x0c,0x15,0xcf,0x3e,0x00,0x11,0x70,0xc1,0x01,0x21,0xfc,
-0x98,0x40,0x08,0x01,0x3e,0x01,0x12,0xc2,0x2d,0x01,0x20,0xf5,0x00,0xa1,0x10,0x03,
-0xf6,0x10,0x53,0x80,0x0b,0xbb,0xbb,0xb8,0xc0,0x06,0x15,0xf9,0xeb,0x0c,0x03,0xb1,
-0x01,0x03,0xe4,0x0e,0x06,0xed,0x08,0x00,0x0c,0x0c,0x04,0x17,0x01,0x14,0x6e,0x81,
-0x08,0x18,0x0c,0xd3,0x0e,0x02,0x09,0x12,0x16,0x60,0x5f,0x0d,0x04,0x23,0x01,0x17,
-0xcf,0x25,0x00,0x03,0x32,0x00,0x02,0xa0,0x12,0x48,0x45,0x55,0x68,0xcf,0x70,0x00,
-0x13,0x4f,0xd8,0x03,0x04,0x7d,0x00,0x06,0xa1,0x0f,0x15,0xef,0xd7,0x0d,0x02,0x72,
-0x02,0x05,0x90,0x09,0x00,0x69,0x04,0x13,0x7f,0xfa,0x01,0x00,0x19,0x00,0x14,0x25,
-0xd2,0x0e,0x00,0x32,0x00,0x04,0x24,0x0d,0x10,0x6f,0xb0,0x02,0x00,0xa8,0x01,0x03,
-0x79,0x05,0x11,0x70,0xb4,0x0d,0x31,0xc9,0x89,0xdf,0xe0,0x11,0x04,0xa1,0x0e,0x01,
-0xed,0x00,0x17,0x1d,0xac,0x12,0x01,0xdb,0x11,0x05,0xcb,0x0e,0x12,0x06,0x6c,0x01,
-0x12,0xa2,0x78,0x00,0x68,0x48,0xce,0xff,0xed,0xa6,0x10,0x3c,0x11,0x06,0x0d,0x0a,
-0x27,0x07,0xff,0x0d,0x00,0x18,0x2f,0x0d,0x00,0x17,0xbf,0x0d,0x00,0x27,0x05,0xff,
+0x23,0x1a,0x03,0x00,0x92,0xf5,0xd0,0x00,0x40,0xd7,0xf6,0x80,0x1a,0x30,0x00,0xf9,
+0x09,0x0f,0xf8,0x00,0x29,0x25,0x1a,0x03,0x00,0xf0,0xf9,0x00,0x1c,0x1a,0x1a,0xff,
+0x00,0x42,0xfb,0xb0,0x1a,0x19,0x21,0x01,0x00,0x01,0x00,0x2f,0xef,0x00,0x01,0x00,
+0x2c,0x13,0xf5,0x08,0x00,0x17,0xde,0x14,0x00,0xbf,0xf2,0xef,0x00,0xfa,0xe6,0x00,
+0xe6,0x00,0x00,0x00,0x03,0x5b,0x00,0x29,0x4f,0x06,0x0b,0x00,0x06,0x3f,0x00,0x28,
+0x2f,0xaf,0x00,0x01,0x00,0x3e,0x1f,0xb9,0x47,0x00,0x33,0x03,0x2c,0x01,0xb2,0xe9,
+0x00,0xfa,0x00,0x00,0xde,0xfb,0xea,0xf5,0x00,0xd5,0x37,0x01,0x7f,0xfd,0x00,0x00,
+0xfb,0xfd,0xf2,0xf7,0x36,0x01,0x27,0x6f,0xf8,0x00,0xf9,0x00,0x00,0xf0,0x9c,0x00,
+0x2a,0x17,0xf9,0x4d,0x00,0x01,0x01,0x00,0x19,0xfd,0x1f,0x00,0x1f,0xfb,0x4f,0x00,
+0x1c,0x30,0xdd,0x00,0x00,0xe6,0x00,0x8f,0x00,0xe8,0x00,0xfa,0x00,0xfa,0xf4,0xf9,
+0x40,0x01,0x33,0x15,0x06,0x8e,0x00,0x11,0xfb,0x91,0x00,0x3f,0xfb,0xf9,0xfa,0x45,
+0x00,0x1f,0x75,0xb2,0x00,0x00,0x00,0xc9,0x00,0xc5,0x4d,0x00,0x62,0xf6,0xfa,0x00,
+0x00,0xfa,0xf9,0x04,0x00,0x0f,0x01,0x00,0x22,0x13,0x05,0x34,0x01,0x2f,0x05,0xf8,
+0xe3,0x00,0x30,0x1f,0xfa,0xb4,0x02,0x36,0x5a,0xd1,0x00,0x00,0x00,0xf7,0xe1,0x01,
+0x10,0xf8,0x07,0x00,0x2f,0xf5,0xee,0x48,0x00,0x1b,0x14,0xae,0xe7,0x00,0x96,0xee,
+0x00,0x00,0xc5,0xf9,0xc5,0xe5,0x00,0xb0,0x1c,0x00,0x3f,0xfc,0xdd,0xf1,0x99,0x00,
+0x1f,0x71,0x8d,0x00,0x00,0x00,0xcd,0x00,0xcb,0x0c,0x00,0xef,0xf1,0x00,0xf6,0x00,
+0xfd,0xfc,0x00,0x00,0xfc,0x00,0x00,0x04,0x00,0x04,0xee,0x00,0x28,0x6f,0xf7,0x00,
+0xf8,0xfa,0x00,0xf6,0x3b,0x01,0x34,0x10,0xf2,0x5e,0x02,0x1f,0xf2,0x40,0x00,0x27,
+0x01,0x5d,0x05,0xc0,0xb6,0xb2,0x00,0x00,0xde,0xf8,0xc2,0xfb,0x05,0x00,0x05,0x04,
+0x24,0x02,0xdf,0xd0,0xe7,0x00,0xe7,0xc5,0xed,0xea,0x00,0xed,0xe9,0xf3,0xea,0xef,
+0xf8,0x02,0x1d,0x66,0xc3,0xd3,0x00,0x00,0xeb,0xfc,0x73,0x02,0xa3,0xf3,0xf3,0x00,
+0x00,0xf3,0xf7,0x00,0x00,0xf8,0xfd,0x81,0x02,0x0f,0x01,0x00,0x17,0x94,0x04,0x00,
+0xd7,0xef,0x00,0x00,0xf4,0x00,0x00,0x70,0x01,0x73,0x03,0xf7,0xf7,0x00,0x00,0xf7,
+0xfa,0xe4,0x03,0x0f,0x85,0x01,0x1e,0x14,0xd3,0x3d,0x04,0x15,0x04,0x68,0x02,0x10,
+0xfa,0xc9,0x02,0x1f,0xf7,0xc3,0x01,0x1e,0xff,0x11,0x06,0xf2,0xbe,0xd5,0x00,0x00,
+0xd5,0xf8,0xe5,0xfb,0x05,0xe5,0x05,0x05,0x04,0x05,0x00,0x05,0xee,0xed,0xfa,0xf5,
+0xed,0xf5,0xef,0xfa,0xf5,0xfa,0x00,0xf9,0xf7,0x05,0x8a,0x01,0x20,0x2a,0x04,0xf9,
+0x5c,0x03,0x10,0xfa,0x36,0x04,0x1f,0xf8,0xa9,0x03,0x26,0x1e,0xfb,0x09,0x05,0x0f,
+0x43,0x00,0x20,0x0f,0x01,0x00,0x07,0x1f,0xfc,0xf8,0x05,0x1e,0x0f,0x01,0x00,0x08,
+0x3f,0xfd,0x00,0xfc,0x50,0x00,0x1a,0x1f,0xfd,0x32,0x07,0x39,0x1f,0xfc,0xe7,0x00,
+0x39,0x1e,0x05,0x10,0x08,0x17,0x05,0xb1,0x06,0x0f,0x02,0x03,0x1b,0x1f,0xe9,0x1f,
+0x08,0x3f,0x0f,0xc4,0x05,0x34,0x1f,0xe7,0x34,0x01,0x0b,0x2f,0xfa,0xfb,0x96,0x06,
+0x1d,0x1c,0xcf,0x62,0x03,0x20,0xfb,0x06,0x24,0x05,0x4f,0x0e,0x00,0x05,0x05,0xea,
+0x00,0x33,0x0f,0xe4,0x03,0x1e,0x04,0x28,0x04,0x1c,0xd0,0xde,0x00,0x2f,0xfc,0x04,
+0x16,0x02,0x1e,0x09,0x6c,0x08,0x0f,0xce,0x01,0x4a,0x1e,0xf5,0x4d,0x00,0x0f,0x41,
+0x04,0x66,0x03,0xc5,0x04,0x0f,0x01,0x00,0x4c,0xfa,0x01,0x16,0x00,0x00,0x07,0x00,
+0xf8,0xf8,0xf1,0xe3,0xea,0xf1,0x00,0xd3,0xf1,0x00,0x07,0x69,0x04,0x04,0x41,0x05,
+0x1f,0x07,0x4c,0x00,0x12,0x50,0xea,0x00,0xf1,0xf8,0xf1,0x36,0x00,0x6e,0xf1,0xf1,
+0xf8,0xf1,0xea,0xf1,0x32,0x08,0x0f,0x8f,0x05,0x19,0xfe,0x02,0xe3,0xf8,0xea,0xf8,
+0xf1,0x00,0xf1,0x00,0xea,0xea,0xea,0xf1,0xea,0xea,0x00,0xf1,0x00,0x4c,0x00,0x2f,
+0xf8,0xea,0x4d,0x00,0x15,0x20,0xdb,0xf1,0x82,0x08,0x15,0xf8,0x81,0x00,0x10,0xf8,
+0x59,0x00,0x10,0xe2,0x66,0x00,0x50,0xea,0xf1,0xe3,0x00,0xea,0xbb,0x00,0x01,0xc0,
+0x00,0x1f,0xea,0x52,0x00,0x14,0x13,0x07,0x07,0x00,0x06,0x52,0x00,0x35,0x07,0x00,
+0x0f,0x19,0x00,0x1f,0x07,0x83,0x01,0x1b,0x11,0x07,0x90,0x00,0x21,0x0f,0x0f,0x0a,
+0x00,0x08,0x3c,0x00,0x0f,0xbe,0x06,0x20,0x11,0xf1,0xe7,0x00,0x40,0xf1,0xea,0xea,
+0xf1,0x8e,0x01,0x0f,0x1d,0x02,0x2f,0x00,0x86,0x00,0x8a,0x0f,0x0f,0xf8,0x00,0x0f,
+0x07,0x00,0x07,0x0b,0x02,0x0f,0x04,0x0b,0x2b,0x1f,0x0f,0xc4,0x02,0x39,0x1e,0x07,
+0x66,0x02,0x0f,0x9f,0x00,0x17,0x33,0xf1,0xf8,0xf8,0x29,0x01,0x00,0x33,0x01,0x02,
+0x38,0x00,0x1f,0xf1,0xe1,0x00,0x25,0x70,0xcd,0xdb,0xf8,0xf8,0xdb,0xf8,0xf8,0x55,
+0x00,0x20,0xf8,0xea,0x5c,0x00,0x03,0x7c,0x02,0x05,0x55,0x00,0x0f,0xdb,0x01,0x18,
+0x00,0x3e,0x00,0x10,0xf8,0x51,0x03,0x00,0x09,0x00,0x33,0xea,0xf1,0xf8,0x9c,0x03,
+0x18,0x07,0x01,0x03,0x2f,0x00,0xf8,0x02,0x03,0x17,0x11,0x0f,0x1d,0x02,0x12,0x00,
+0xec,0x02,0x11,0xf8,0xed,0x00,0xb0,0xe3,0x00,0x00,0xea,0xdb,0xe2,0x00,0xdb,0xf8,
+0xea,0xdb,0xfd,0x02,0x01,0x51,0x00,0x0f,0x35,0x02,0x11,0x34,0xd4,0xe2,0x00,0x5f,
+0x02,0x10,0xea,0x4c,0x00,0x00,0x71,0x02,0xc4,0xdb,0xdb,0xf8,0xe3,0xea,0xdb,0xe3,
+0xea,0xdb,0xea,0xea,0xdb,0xee,0x00,0x2f,0xea,0xe3,0xe7,0x00,0x11,0x14,0xe2,0x7f,
+0x03,0x21,0xea,0xf8,0x99,0x03,0x06,0xcc,0x02,0x0f,0x23,0x0f,0x24,0x02,0xca,0x01,
+0x1c,0xea,0x42,0x00,0x1f,0xf8,0xb7,0x02,0x2d,0x18,0x16,0xfb,0x03,0x0f,0xb5,0x02,
+0x3c,0x0f,0xe7,0x03,0x1c,0x30,0xf8,0xea,0xf1,0x13,0x02,0x6e,0xf1,0xc5,0x00,0x00,
+0xe2,0xd4,0xb6,0x04,0x0f,0x4e,0x00,0x1c,0x14,0xf1,0x4a,0x05,0x25,0xf8,0xf1,0xfd,
+0x02,0x1f,0x07,0x81,0x01,0x23,0x34,0xf1,0xf1,0xf1,0x61,0x02,0x34,0x00,0xea,0xf8,
+0xc9,0x01,0x0e,0x4d,0x00,0x0f,0x3b,0x01,0x36,0x1f,0xf1,0xfa,0x00,0x2a,0x11,0x00,
+0xad,0x03,0x02,0xf2,0x00,0x10,0xf8,0x09,0x01,0x0f,0x54,0x03,0x19,0x0c,0x29,0x07,
+0x21,0xf8,0xf8,0x04,0x00,0x10,0xf8,0xa0,0x01,0x01,0xb4,0x03,0x0f,0x70,0x02,0x28,
+0x13,0xea,0xdc,0x00,0x01,0xe6,0x03,0x0f,0x34,0x01,0x38,0x01,0xd9,0x01,0x0f,0x53,
+0x00,0x27,0x05,0x44,0x03,0x12,0xf8,0xf6,0x00,0x0e,0x31,0x04,0x0f,0x93,0x00,0x1c,
+0x02,0x90,0x00,0x03,0xea,0x00,0x0f,0xce,0x01,0x28,0x26,0xf8,0xf1,0x90,0x00,0x01,
+0xc5,0x02,0x04,0x81,0x01,0x0f,0x36,0x01,0x2d,0x16,0xf8,0x6a,0x05,0x1f,0xf8,0x34,
+0x01,0x27,0x1a,0xf8,0xb4,0x05,0x0f,0xe7,0x00,0x27,0x18,0xf8,0x87,0x01,0x00,0x4d,
+0x00,0x0f,0xd6,0x04,0x2c,0x17,0xf8,0x02,0x03,0x10,0xf1,0x02,0x03,0x0e,0x56,0x06,
+0x0f,0x4f,0x03,0x22,0x01,0x09,0x03,0x0f,0x4d,0x00,0x26,0x0b,0x87,0x0a,0x04,0x9e,
+0x00,0x1f,0x00,0xe7,0x00,0x28,0x07,0xcb,0x01,0x1f,0x0f,0x49,0x00,0x2a,0x00,0xde,
+0x03,0x12,0x07,0x37,0x01,0x8f,0x00,0xf8,0xf1,0x07,0x00,0xf8,0x07,0x00,0x34,0x01,
+0x26,0x02,0x31,0x04,0x02,0xeb,0x07,0x03,0xde,0x01,0x0f,0x7c,0x08,0x26,0x02,0x9b,
+0x00,0x05,0x47,0x03,0x01,0xcc,0x0b,0x1f,0xf1,0x1b,0x02,0x25,0x0f,0xed,0x09,0x3a,
+0x0f,0xd4,0x0a,0x2c,0x0f,0x73,0x09,0x0c,0x03,0x04,0x00,0x0f,0xcf,0x01,0x26,0x08,
+0x02,0x03,0x05,0xe5,0x03,0x0f,0xce,0x01,0x26,0x02,0xfe,0x05,0x05,0x4c,0x07,0x03,
+0x52,0x0a,0x30,0x01,0x00,0x02,0x13,0x00,0x31,0x02,0x03,0x00,0xff,0x14,0x1e,0x05,
+0xf9,0x13,0xf1,0x0b,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,
+0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,
+0xf0,0x0c,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,
+0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x1f,0x00,0xf5,
+0x2f,0x29,0x2a,0x2b,0x2c,0x2d,0x00,0x2e,0x2f,0x00,0x00,0x30,0x31,0x32,0x00,0x33,
+0x00,0x34,0x35,0x36,0x37,0x38,0x39,0x3a,0x00,0x00,0x3b,0x00,0x3c,0x3d,0x3e,0x00,
+0x3f,0x40,0x41,0x42,0x43,0x44,0x45,0x46,0x00,0x00,0x47,0x48,0x49,0x00,0x4a,0x00,
+0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x51,0x00,0x00,0x52,0x00,0x00,0x53,0x54,0x55,0xa1,
+0x00,0x20,0x03,0x02,0x9c,0x00,0x4b,0x06,0x07,0x06,0x08,0x9f,0x00,0x70,0x09,0x00,
+0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xd1,0x0b,0x00,0x0d,
+0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x1c,0x09,0x51,0x17,0x17,0x17,
+0x18,0x17,0x2e,0x00,0xf0,0x1c,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,
+0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x00,0x00,0x24,0x00,0x00,0x00,0x25,0x00,0x26,
+0x27,0x00,0x00,0x00,0x28,0x29,0x00,0x2a,0x2b,0x00,0x2c,0x2d,0x2e,0x2f,0x30,0x00,
+0x31,0x2f,0x00,0x33,0x32,0x00,0x33,0xb0,0x00,0x64,0x3b,0x36,0x37,0x3c,0x3d,0x3e,
+0xae,0x00,0xc0,0x47,0x37,0x48,0x37,0x41,0x49,0x4a,0x4a,0x4b,0x4c,0x4d,0x00,0xf0,
+0x1f,0x0e,0xff,0xff,0xff,0x40,0xdf,0xff,0xff,0xf3,0x0d,0xff,0xff,0xff,0x30,0xcf,
+0xff,0xff,0xf2,0x0c,0xff,0xff,0xff,0x20,0xbf,0xff,0xff,0xf1,0x0b,0xff,0xff,0xff,
+0x10,0xaf,0xff,0xff,0xf0,0x0a,0xff,0xff,0xff,0x00,0x9f,0xff,0xff,0xf0,0x09,0x09,
+0x00,0xf6,0x2c,0x8f,0xff,0xff,0xe0,0x08,0xff,0xff,0xfe,0x00,0x7f,0xff,0xff,0xd0,
+0x07,0xff,0xff,0xfc,0x00,0x6f,0xff,0xff,0xc0,0x05,0xff,0xff,0xfb,0x00,0x5f,0xff,
+0xff,0xb0,0x04,0xff,0xff,0xfa,0x00,0x4f,0xff,0xff,0xa0,0x03,0xff,0xff,0xf9,0x00,
+0x3f,0xff,0xff,0x90,0x02,0xff,0xff,0xf8,0x00,0x1d,0xdd,0xdd,0x60,0x00,0x01,0x00,
+0x71,0x21,0x00,0x00,0x08,0xff,0xfc,0x20,0x48,0x00,0xe0,0xff,0xff,0xff,0xf5,0x1f,
+0xff,0xff,0xff,0x70,0xef,0xff,0xff,0xf5,0x06,0x51,0x00,0xfb,0x02,0x06,0xdf,0xe9,
+0x10,0x8f,0xff,0xf3,0x00,0xdf,0xff,0xd8,0xff,0xff,0x30,0x0d,0xff,0xfd,0x0d,0x00,
+0xf2,0x29,0xf1,0x00,0xdf,0xff,0xb8,0xff,0xff,0x00,0x0d,0xff,0xfa,0x8f,0xff,0xe0,
+0x00,0xdf,0xff,0x88,0xff,0xfd,0x00,0x0d,0xff,0xf7,0x8f,0xff,0xb0,0x00,0xdf,0xff,
+0x58,0xff,0xfa,0x00,0x0d,0xff,0xf4,0x8f,0xff,0x80,0x00,0xdf,0xff,0x28,0xff,0xf6,
+0x00,0x0d,0xff,0xf1,0x7f,0xff,0x50,0x00,0xdf,0xfe,0x7c,0x00,0x72,0xff,0xff,0x50,
+0x00,0x2f,0xff,0xf2,0x0d,0x00,0x72,0x1f,0xff,0xf2,0x00,0x04,0xff,0xff,0x0d,0x00,
+0x01,0x09,0x00,0x32,0x7f,0xff,0xc0,0x0e,0x00,0x00,0x09,0x00,0x32,0x0a,0xff,0xfa,
+0x0d,0x00,0x82,0x0a,0xff,0xf9,0x00,0x00,0xdf,0xff,0x70,0x0e,0x00,0x00,0x09,0x00,
+0x32,0x0f,0xff,0xf4,0x0d,0x00,0x00,0x09,0x00,0x41,0x02,0xff,0xff,0x10,0x0d,0x00,
+0x01,0x09,0x00,0x32,0x5f,0xff,0xf0,0x1b,0x00,0x30,0x5f,0xff,0xe0,0xe8,0x00,0xf6,
+0x04,0x00,0x00,0x00,0x01,0x11,0x11,0x18,0xff,0xfc,0x11,0x11,0xbf,0xff,0xa1,0x11,
+0x10,0x00,0xbf,0xff,0x01,0x00,0x27,0xa0,0x0b,0x0d,0x00,0x1f,0xfa,0x1b,0x00,0x09,
+0xa2,0x00,0x00,0x06,0xff,0xfd,0x00,0x00,0x9f,0xff,0xb0,0x5e,0x00,0x72,0x9f,0xff,
+0xa0,0x00,0x0c,0xff,0xf8,0x0d,0x00,0x30,0x0c,0xff,0xf7,0xdb,0x00,0x14,0x40,0xe4,
+0x00,0x52,0x40,0x00,0x2f,0xff,0xf1,0x0d,0x00,0x00,0x09,0x00,0x23,0x05,0xff,0xfe,
+0x00,0x01,0x09,0x00,0x11,0x8f,0x43,0x00,0x17,0x8f,0x5e,0x00,0x27,0xe0,0x08,0x0d,
+0x00,0x1f,0xfe,0x1b,0x00,0x09,0xc0,0x01,0x11,0x14,0xff,0xff,0x11,0x11,0x7f,0xff,
+0xd1,0x11,0x11,0x51,0x00,0x54,0x6f,0xff,0xd0,0x00,0x09,0x27,0x01,0x82,0x09,0xff,
+0xfb,0x00,0x00,0xcf,0xff,0x80,0x0e,0x00,0x00,0x09,0x00,0x32,0x0f,0xff,0xf5,0x0d,
+0x00,0x81,0x0e,0xff,0xf5,0x00,0x01,0xff,0xff,0x20,0x0d,0x00,0x01,0x09,0x00,0x14,
+0x4f,0x27,0x01,0x00,0x09,0x00,0x32,0x07,0xff,0xfd,0x0d,0x00,0x01,0x09,0x00,0x38,
+0xaf,0xff,0xa0,0xe4,0x00,0x14,0xf7,0xe4,0x00,0x12,0xf8,0xbf,0x01,0x24,0x00,0x00,
+0x39,0x00,0x1f,0x70,0x0c,0x00,0x24,0x62,0x03,0x8b,0xef,0xff,0xea,0x60,0x0b,0x00,
+0x11,0xcf,0xd9,0x00,0x12,0x70,0xcd,0x00,0x01,0x01,0x00,0x11,0xfc,0x6c,0x01,0x03,
+0x01,0x00,0x10,0xc0,0x42,0x01,0x03,0x01,0x00,0x10,0xf8,0x9b,0x00,0x50,0xff,0xff,
+0xc8,0x7a,0xff,0x1d,0x03,0xd0,0x01,0xff,0xff,0xff,0xf6,0x00,0x00,0x2e,0xff,0xff,
+0xff,0x80,0x05,0xb0,0x01,0x01,0x43,0x02,0x01,0x16,0x03,0x21,0xff,0x50,0x27,0x02,
+0x30,0xff,0xf0,0x08,0x58,0x03,0x01,0xc9,0x00,0x30,0xff,0xf2,0x07,0x6d,0x03,0x02,
+0x79,0x01,0x10,0xf4,0x5f,0x00,0x12,0x90,0x19,0x02,0x44,0x10,0x02,0xff,0xff,0x4d,
+0x02,0x01,0x35,0x00,0x24,0xff,0x81,0xb0,0x00,0x00,0x99,0x00,0x14,0x81,0x82,0x02,
+0x00,0x01,0x00,0x12,0xa3,0x0d,0x00,0x02,0x26,0x02,0x11,0xc3,0x0c,0x00,0x03,0x9f,
+0x01,0x11,0x91,0x0d,0x00,0x11,0x3c,0x0c,0x00,0x12,0xfd,0x66,0x01,0x11,0x3b,0x0d,
+0x00,0x12,0xe1,0x33,0x00,0x23,0x28,0xef,0xd9,0x00,0x10,0x00,0xdd,0x00,0x26,0xef,
+0xff,0x48,0x01,0x12,0x1c,0xe5,0x00,0x04,0x99,0x01,0x81,0xff,0xf1,0xbe,0xee,0xee,
+0xd0,0x00,0x00,0xeb,0x00,0x32,0xf3,0xbf,0xff,0xa6,0x01,0x00,0xb4,0x00,0x12,0xaf,
+0xa7,0x00,0x00,0x0c,0x00,0x32,0xf3,0x6f,0xff,0xf4,0x01,0x00,0x33,0x04,0x12,0x2f,
+0x4d,0x00,0x10,0x06,0x2d,0x02,0x10,0x0b,0xab,0x02,0x30,0x41,0x13,0x9f,0xdf,0x00,
+0x16,0x03,0x38,0x02,0x34,0x20,0x00,0x7f,0x0b,0x00,0x15,0xf7,0xb3,0x00,0x02,0x02,
+0x01,0x12,0x5e,0x0b,0x00,0x11,0xe6,0x80,0x00,0x10,0x6b,0x0b,0x00,0x14,0xc7,0xa5,
+0x01,0x11,0xdf,0x3b,0x01,0x04,0x4d,0x02,0x1f,0x00,0x0c,0x00,0x16,0x57,0x01,0x7c,
+0xef,0xec,0x82,0x6f,0x04,0x01,0x63,0x00,0x15,0x80,0x0f,0x00,0x11,0x05,0x71,0x00,
+0x15,0xf9,0x10,0x00,0x12,0x1e,0x82,0x00,0x00,0x9b,0x01,0x12,0x20,0x06,0x02,0x40,
+0xfc,0x20,0x19,0xff,0x24,0x03,0x31,0x03,0xfc,0x50,0x08,0x01,0x10,0xf1,0x5c,0x00,
+0x61,0xe0,0x00,0x00,0x0d,0xff,0xf6,0x7e,0x01,0x10,0xc0,0x05,0x01,0x10,0xf0,0x05,
+0x00,0x11,0xd0,0x77,0x00,0x10,0xb0,0x2f,0x04,0x32,0xf0,0x00,0x03,0xec,0x01,0x05,
+0x20,0x00,0x03,0x9e,0x03,0x05,0x40,0x00,0x33,0x7f,0xff,0xd0,0x60,0x00,0x63,0x30,
+0x2a,0xff,0xff,0xb0,0x02,0xb0,0x03,0x13,0x0e,0x80,0x00,0x13,0x0c,0x94,0x00,0x13,
+0x04,0x6c,0x02,0x32,0x6f,0xff,0xe0,0xa1,0x00,0x20,0x4e,0xff,0x20,0x05,0x15,0x02,
+0xdf,0x03,0x74,0x00,0x6a,0xde,0xdb,0x71,0x00,0x0b,0x76,0x03,0x03,0x01,0x00,0x14,
+0x6f,0xeb,0x01,0x05,0xcb,0x01,0x18,0x50,0x10,0x00,0x39,0x0b,0xff,0xfb,0x2f,0x00,
+0x84,0x5f,0xff,0xf1,0x00,0x4a,0xdf,0xfd,0xa4,0x2f,0x00,0x40,0xef,0xff,0x60,0x1b,
+0x68,0x00,0x14,0xb1,0x70,0x02,0x34,0xfc,0x00,0xcf,0x0d,0x03,0x01,0x8c,0x02,0x13,
+0xf2,0xb7,0x01,0x02,0x44,0x03,0xb2,0xef,0xff,0x70,0x0f,0xff,0xff,0x50,0x06,0xff,
+0xff,0xe0,0xfa,0x03,0x30,0xfc,0x00,0x4f,0xdc,0x01,0x00,0xac,0x05,0x01,0x2f,0x00,
+0x30,0xf3,0x00,0x6f,0x66,0x05,0x32,0x3f,0xff,0xf5,0xd7,0x02,0x11,0x80,0x23,0x01,
+0x21,0x00,0x2f,0x10,0x00,0x10,0x09,0xe6,0x03,0x07,0x10,0x00,0x10,0x3f,0x36,0x00,
+0x07,0x30,0x00,0x10,0xdf,0x1b,0x02,0x01,0x50,0x00,0x10,0x7f,0x1a,0x00,0x31,0x01,
+0x9f,0xfe,0x6a,0x05,0x41,0xff,0x60,0x04,0xef,0x70,0x00,0x21,0x02,0xb4,0x45,0x00,
+0x1a,0xff,0xd9,0x01,0x17,0xdf,0xb0,0x00,0x00,0x01,0x00,0x08,0xd0,0x00,0x01,0x01,
+0x00,0x06,0xf0,0x00,0x46,0x28,0xce,0xff,0xda,0x92,0x06,0x11,0x09,0x03,0x04,0x14,
+0x40,0x0b,0x01,0x14,0xdf,0xa9,0x02,0x03,0x77,0x04,0x02,0x01,0x00,0x14,0x50,0x67,
+0x01,0x03,0x18,0x05,0x05,0x74,0x00,0x34,0xfc,0x99,0xef,0xc1,0x03,0x11,0x02,0x90,
+0x00,0x11,0x0c,0x2a,0x04,0x01,0xca,0x01,0x00,0x6f,0x05,0x14,0x03,0x6d,0x02,0x20,
+0x06,0xff,0x84,0x01,0x17,0x01,0x1e,0x00,0x11,0xfc,0x06,0x00,0x15,0xf5,0x3c,0x00,
+0x33,0x20,0x00,0x1d,0x71,0x03,0x01,0x5a,0x00,0x34,0xb0,0x03,0xdf,0x70,0x01,0x00,
+0x78,0x00,0x21,0xf7,0x9f,0x41,0x00,0x08,0x96,0x00,0x14,0xb0,0x2c,0x03,0x04,0xa0,
+0x04,0x14,0x00,0xbe,0x06,0x07,0xd1,0x00,0x20,0x00,0x02,0xca,0x01,0x03,0xf3,0x06,
+0x03,0x58,0x04,0x01,0x70,0x05,0x35,0xbd,0xdd,0xdb,0xea,0x04,0x10,0xb0,0x5c,0x05,
+0x15,0xfd,0xe0,0x00,0x10,0xfa,0xa8,0x00,0x11,0xfc,0x95,0x00,0x20,0xe2,0x4f,0xd6,
+0x00,0x01,0xda,0x07,0x10,0x0a,0xa8,0x02,0x10,0x05,0x1d,0x01,0x10,0x09,0x21,0x01,
+0x11,0x0f,0xc2,0x00,0x00,0x6c,0x00,0x61,0x6f,0xff,0xff,0xf3,0x00,0x3f,0x82,0x00,
+0x14,0x08,0x20,0x01,0x12,0x4f,0x91,0x00,0x13,0xaf,0xa6,0x01,0x12,0x3f,0x33,0x04,
+0x13,0x0b,0x11,0x04,0x22,0x2f,0xff,0x0e,0x06,0x12,0xdf,0xb8,0x00,0x00,0x81,0x08,
+0x61,0xd2,0x00,0x00,0x02,0xbf,0xff,0x01,0x01,0x10,0x07,0x25,0x00,0x34,0xb8,0x79,
+0xcf,0xd6,0x00,0x17,0xef,0x85,0x06,0x10,0x50,0x26,0x02,0x05,0x01,0x00,0x00,0xd8,
+0x00,0x14,0x03,0x1f,0x00,0x55,0xef,0xff,0xff,0xfd,0x10,0x1a,0x02,0x23,0xc4,0x1d,
+0x22,0x01,0x61,0x16,0xad,0xef,0xfe,0xc9,0x61,0xcd,0x00,0x47,0xf8,0x8f,0xff,0xf7,
+0x03,0x00,0x20,0xf6,0x8f,0x2b,0x08,0xa1,0xf3,0x8f,0xff,0xf2,0x8f,0xff,0xf1,0x8f,
+0xff,0xf0,0x03,0x00,0x25,0xd0,0x8f,0x11,0x05,0x02,0x63,0x05,0x11,0xc0,0x45,0x01,
+0x11,0xdf,0xda,0x02,0x32,0x3e,0xff,0xf8,0x70,0x01,0x12,0xfc,0x3b,0x04,0x11,0xc1,
+0xf2,0x03,0x12,0xfd,0xdf,0x01,0x12,0xf2,0x14,0x00,0x11,0x70,0x26,0x05,0x12,0xfd,
+0x86,0x03,0x21,0xf6,0x00,0xcf,0x00,0x12,0xe0,0xea,0x03,0x12,0x90,0x80,0x01,0x11,
+0x40,0x14,0x06,0x12,0xfe,0xe8,0x01,0x12,0xfa,0x29,0x00,0x12,0xf7,0x9c,0x04,0x12,
+0xf4,0xd5,0x05,0x12,0xf1,0x2c,0x01,0x00,0x0d,0x02,0x15,0x0d,0x3e,0x00,0x12,0xc0,
+0x07,0x03,0x16,0xb0,0x07,0x00,0x11,0x1f,0x78,0x06,0x0b,0x07,0x00,0x06,0x23,0x00,
+0x12,0xc0,0x38,0x00,0x12,0xd0,0x32,0x02,0x12,0xe0,0x49,0x06,0x12,0xf0,0x92,0x00,
+0x26,0xf2,0x00,0x7e,0x02,0x03,0x3c,0x02,0x12,0xbf,0x3f,0x03,0x12,0x7f,0xd0,0x08,
+0x12,0x1f,0xf5,0x02,0x12,0x0c,0x4e,0x00,0x13,0x05,0x43,0x02,0x12,0xdf,0x2b,0x00,
+0x12,0x5f,0xbf,0x01,0x12,0x0c,0x72,0x00,0x12,0x02,0xe8,0x00,0x00,0x3a,0x00,0x12,
+0x30,0x65,0x00,0x17,0xf4,0x50,0x00,0x32,0x0b,0xff,0xf6,0x96,0x02,0x12,0xf1,0x8f,
+0x02,0x05,0x93,0x07,0x23,0x0d,0x70,0x92,0x05,0x13,0xc1,0xd8,0x06,0x22,0xe2,0x00,
+0xf0,0x00,0x00,0x08,0x00,0x00,0x0c,0x03,0x31,0xd1,0x00,0x00,0x62,0x07,0x13,0xa0,
+0xb8,0x02,0x12,0x50,0x51,0x05,0x13,0xfe,0xe2,0x04,0x13,0xf8,0xbe,0x03,0x12,0xf1,
+0xe9,0x08,0x02,0x0c,0x04,0x12,0xcf,0x1f,0x00,0x13,0x07,0x84,0x00,0x13,0x2f,0x3e,
+0x00,0x33,0xdf,0xff,0xfe,0x49,0x07,0x13,0xf3,0xaa,0x00,0x12,0x70,0x01,0x01,0x13,
+0xfa,0x26,0x00,0x12,0xd0,0x09,0x01,0x12,0xff,0xd6,0x09,0x02,0x54,0x00,0x12,0xef,
+0xe6,0x00,0x13,0x0d,0x35,0x00,0x12,0xdf,0xba,0x01,0x13,0x0d,0x5b,0x00,0x12,0xdf,
+0xee,0x00,0x13,0x0e,0x1e,0x00,0x03,0x2d,0x00,0x12,0x0f,0x62,0x01,0x22,0x01,0xff,
+0x71,0x00,0x12,0x3f,0x86,0x01,0x13,0x05,0x06,0x04,0x12,0x8f,0xc5,0x00,0x13,0x0b,
+0x61,0x00,0x12,0xff,0xf9,0x08,0x12,0x3f,0xbc,0x00,0x13,0x08,0x64,0x01,0x12,0xef,
+0x38,0x01,0x15,0x4f,0x2c,0x00,0x17,0xd0,0xac,0x01,0x33,0xdf,0xff,0xfc,0x49,0x00,
+0x12,0x20,0x88,0x01,0x12,0x60,0x1f,0x04,0x12,0x90,0x8b,0x00,0x14,0xa0,0x39,0x09,
+0x01,0xa7,0x02,0x12,0x60,0x56,0x09,0x15,0x10,0xcd,0x02,0x13,0x2f,0x8c,0x01,0x01,
+0xe0,0x01,0x03,0x9d,0x09,0x02,0xc6,0x0a,0x05,0x0b,0x00,0x14,0xf3,0x0b,0x00,0x12,
+0x0e,0x8e,0x00,0x50,0x01,0x81,0x00,0x00,0x0d,0x0b,0x00,0xf2,0x0a,0x04,0x10,0x06,
+0xff,0xb4,0x00,0x0c,0xff,0xf1,0x00,0x17,0xdf,0x60,0x0b,0xff,0xff,0xe7,0x1b,0xff,
+0xf0,0x3a,0xff,0xff,0xb0,0x0f,0x37,0x09,0x00,0xbb,0x03,0x15,0x2c,0x98,0x03,0x42,
+0xf4,0x00,0x16,0xae,0x35,0x0a,0x10,0xa6,0x7e,0x00,0x10,0x39,0xda,0x07,0x15,0x30,
+0xcc,0x08,0x16,0x60,0xa8,0x04,0x14,0xf3,0x0e,0x05,0x42,0x8c,0xff,0xfe,0x10,0x91,
+0x07,0x23,0xfd,0x03,0xdb,0x04,0x51,0xcf,0xff,0xf4,0x00,0x8f,0xe7,0x01,0x10,0x09,
+0xda,0x00,0x11,0x0e,0x11,0x01,0x10,0x07,0x28,0x00,0x12,0x05,0x44,0x00,0x20,0x2c,
+0xf5,0x38,0x02,0x11,0xd3,0x43,0x00,0x00,0x10,0x00,0x2e,0x19,0x00,0x01,0x00,0x17,
+0x2f,0x60,0x09,0x0f,0x0c,0x00,0x49,0x16,0xaf,0x95,0x04,0x1f,0xfb,0x0c,0x00,0x29,
+0xcf,0x12,0x22,0x22,0x22,0x4f,0xff,0xff,0xf6,0x22,0x22,0x22,0x21,0xc0,0x00,0x59,
+0x01,0x70,0x04,0x00,0x5d,0x0a,0x0d,0x09,0x00,0x30,0xfe,0x00,0x0d,0xc6,0x02,0x00,
+0xc3,0x02,0x00,0xbd,0x04,0x50,0x0a,0xff,0xff,0xd0,0x01,0x8e,0x02,0x50,0x9f,0xff,
+0xfb,0x00,0x0d,0x88,0x02,0x20,0x06,0xef,0xdb,0x01,0x50,0x30,0x00,0x00,0x37,0x77,
+0x01,0x00,0x22,0x76,0x6f,0x12,0x02,0x0f,0x07,0x00,0x09,0x30,0x00,0x01,0x33,0xd6,
+0x01,0x30,0xfe,0x40,0x08,0x0a,0x06,0x50,0xef,0xff,0xff,0xf8,0x0f,0x13,0x0a,0xd0,
+0xdf,0xff,0xff,0xf7,0x05,0xff,0xff,0xfe,0x10,0x04,0xcf,0xe9,0x10,0x11,0x00,0x01,
+0x00,0x41,0x0e,0xff,0xff,0x20,0x09,0x00,0x42,0x03,0xff,0xff,0xc0,0x13,0x00,0x3f,
+0x9f,0xff,0xf7,0x1c,0x00,0x12,0x11,0x10,0x09,0x00,0x1f,0x04,0x1c,0x00,0x4c,0x1f,
+0xf6,0x1c,0x00,0x3e,0x1f,0xaf,0x1c,0x00,0x01,0x1b,0xb0,0x1c,0x00,0x1f,0x0f,0x1c,
+0x00,0x2d,0x54,0x01,0x88,0x88,0x60,0x00,0x01,0x00,0x52,0x04,0x9c,0xef,0xed,0xb7,
+0x4c,0x01,0x82,0x05,0xef,0xff,0xff,0xff,0xff,0xfa,0x10,0x36,0x00,0x01,0x01,0x00,
+0x63,0xe3,0x00,0x00,0x00,0x0a,0xff,0x01,0x00,0x44,0x30,0x00,0x00,0x6f,0x0c,0x00,
+0x30,0xd0,0x00,0x01,0x07,0x00,0xf1,0x06,0xb8,0x9d,0xff,0xff,0xff,0xf8,0x00,0x07,
+0xff,0xff,0xff,0xd2,0x00,0x00,0x7f,0xff,0xff,0xfe,0x00,0x0d,0xff,0x9c,0x01,0xf0,
+0x06,0x09,0xff,0xff,0xff,0x50,0x1f,0xff,0xff,0xfa,0x00,0x00,0x00,0x02,0xff,0xff,
+0xff,0xa0,0x5f,0xff,0xff,0xf5,0x5a,0x00,0x83,0xdf,0xff,0xff,0xd0,0x8f,0xff,0xff,
+0xf2,0x66,0x00,0x50,0xf0,0x9f,0xff,0xff,0xf1,0x0c,0x00,0x00,0x14,0x00,0x00,0x10,
+0x00,0x03,0x0c,0x00,0x22,0xf3,0xbf,0x0c,0x00,0x00,0x55,0x00,0x2f,0xf4,0xcf,0x0c,
+0x00,0x34,0x08,0x54,0x00,0x08,0x6c,0x00,0x04,0x84,0x00,0x40,0x9f,0xff,0xff,0xf2,
+0x10,0x00,0x04,0x9c,0x00,0x44,0x5f,0xff,0xff,0xf6,0xb4,0x00,0x08,0xcc,0x00,0x08,
+0xe4,0x00,0x12,0x06,0xfc,0x00,0x10,0x6f,0xfc,0x00,0x10,0x01,0x42,0x01,0x12,0xa8,
+0x14,0x01,0x26,0x00,0x5f,0x2c,0x01,0x09,0x44,0x01,0x22,0x00,0x9f,0x0b,0x00,0x1c,
+0xf3,0x74,0x01,0x00,0x8c,0x01,0x35,0xfd,0xb7,0x20,0x9b,0x01,0x21,0x17,0xcc,0x07,
+0x00,0x30,0x6b,0xff,0xfc,0x1c,0x00,0x20,0xaf,0xff,0x08,0x00,0x10,0x39,0x30,0x00,
+0x31,0xfc,0x02,0x8e,0x42,0x00,0x3f,0xfc,0x1f,0xff,0x08,0x00,0x06,0x20,0xc7,0x2f,
+0x08,0x00,0x20,0xfb,0x61,0xf7,0x01,0x22,0xfc,0x05,0xff,0x01,0x2f,0xfc,0x00,0x08,
+0x00,0xa7,0x62,0x01,0x6a,0xdf,0xfe,0xdb,0x83,0x19,0x01,0x11,0x19,0xe6,0x00,0x20,
+0xfd,0x50,0x0c,0x00,0x13,0x4e,0x59,0x01,0x27,0x90,0x00,0x72,0x01,0x54,0xa0,0x00,
+0x00,0x3f,0xff,0x01,0x00,0x11,0x50,0x93,0x02,0x30,0xfd,0x98,0xae,0x06,0x00,0x10,
+0x00,0xaf,0x01,0x12,0xf6,0x91,0x01,0x41,0xf2,0x00,0xcf,0xff,0xe1,0x03,0x00,0x20,
+0x00,0x20,0x60,0x1f,0xc1,0x01,0x11,0x00,0xc9,0x01,0x23,0xf8,0x03,0x51,0x00,0x01,
+0x08,0x00,0x22,0x5f,0xff,0x06,0x04,0x10,0x3f,0xd6,0x01,0x31,0x11,0x11,0x11,0xb7,
+0x01,0x01,0x58,0x00,0x03,0x01,0x00,0x13,0xbf,0x3e,0x02,0x03,0x25,0x00,0x14,0xfc,
+0x0c,0x00,0x53,0x0c,0xff,0xff,0xff,0x40,0x0c,0x00,0x25,0x09,0xff,0x91,0x03,0x01,
+0x83,0x00,0x14,0xf2,0x7f,0x03,0x13,0xff,0x17,0x03,0x03,0x0c,0x00,0x13,0xf8,0x0c,
+0x00,0x10,0x03,0x16,0x02,0x07,0x0c,0x00,0x14,0xfc,0x0c,0x00,0x16,0xef,0x0c,0x00,
+0x1b,0x02,0x0c,0x00,0x2e,0xfd,0x10,0x0c,0x00,0x2f,0x01,0xdf,0x0c,0x00,0x07,0x23,
+0xfe,0x20,0x0c,0x00,0x10,0xcf,0xb6,0x02,0x11,0x88,0x01,0x00,0x35,0x50,0x9f,0xff,
+0x01,0x00,0x15,0xfb,0xb6,0x02,0x00,0xbd,0x00,0x1f,0xaf,0x19,0x00,0x11,0x02,0xc5,
+0x02,0x32,0xfe,0xdb,0x73,0x5a,0x00,0x12,0x6e,0xa9,0x01,0x14,0x40,0x65,0x00,0x03,
+0x9c,0x01,0x25,0x01,0xef,0x3d,0x00,0x35,0x00,0x00,0xcf,0x3e,0x00,0x11,0x70,0xc1,
+0x01,0x11,0xfc,0xa9,0x01,0x11,0xff,0x3e,0x01,0x12,0xc2,0x2d,0x01,0x32,0xf5,0x00,
+0xff,0x63,0x01,0x90,0x08,0xff,0xff,0xff,0x80,0x0b,0xbb,0xbb,0xb8,0x5d,0x00,0x54,
+0x2f,0xff,0xff,0xf9,0x00,0xff,0x00,0x03,0xb1,0x01,0x01,0x01,0x00,0x04,0xb6,0x03,
+0x00,0x01,0x00,0x44,0x1d,0xff,0xff,0xff,0x17,0x01,0x10,0x6e,0xe7,0x01,0x04,0x99,
+0x01,0x01,0x70,0x00,0x23,0x00,0x00,0x80,0x00,0x25,0xfe,0x60,0xb2,0x01,0x05,0x23,
+0x01,0x17,0xcf,0x25,0x00,0x14,0x0c,0xbc,0x00,0x00,0x01,0x00,0x48,0x45,0x55,0x68,
+0xcf,0x70,0x00,0x13,0x4f,0xd8,0x03,0x04,0x7d,0x00,0x15,0xfa,0xc2,0x03,0x13,0xef,
+0x64,0x04,0x13,0x00,0x47,0x05,0x03,0x5a,0x00,0x02,0x69,0x04,0x13,0x7f,0xfa,0x01,
+0x00,0x19,0x00,0x10,0x25,0xd9,0x00,0x04,0x32,0x00,0x22,0x2f,0xff,0xde,0x06,0x10,
+0x6f,0xb0,0x02,0x00,0xa8,0x01,0x03,0x79,0x05,0x20,0x70,0x06,0x84,0x00,0x74,0xc9,
+0x89,0xdf,0xff,0xff,0xff,0xe1,0x93,0x00,0x02,0xcf,0x02,0x14,0x1d,0x0c,0x00,0x00,
+0x40,0x02,0x13,0x1c,0x0c,0x00,0x11,0xf7,0x6d,0x02,0x02,0x6c,0x01,0x12,0xa2,0x78,
+0x00,0x55,0x48,0xce,0xff,0xed,0xa6,0x86,0x00,0x01,0xe4,0x00,0x04,0x7e,0x02,0x01,
+0xc5,0x05,0x05,0x0d,0x00,0x18,0x2f,0x0d,0x00,0x17,0xbf,0x0d,0x00,0x27,0x05,0xff,
 0x0d,0x00,0x18,0x1e,0x0d,0x00,0x17,0xaf,0x0d,0x00,0x27,0x04,0xff,0x0d,0x00,0x17,
 0x0d,0x0d,0x00,0x00,0x6f,0x05,0x04,0x75,0x00,0x00,0xd9,0x02,0x23,0xfb,0x6f,0x0d,
-0x00,0x00,0xd0,0x00,0x15,0xf2,0x0d,0x00,0x00,0xa7,0x0b,0x04,0x0d,0x00,0x13,0x02,
-0x6f,0x16,0x13,0xf5,0xac,0x08,0x15,0xf3,0x0d,0x00,0x10,0x6f,0x35,0x01,0x03,0x0d,
-0x00,0x23,0x01,0xef,0xc7,0x0e,0x15,0xf5,0x89,0x0c,0x03,0x0d,0x00,0x00,0x98,0x16,
-0x05,0x0d,0x00,0x11,0xef,0x6d,0x0a,0x02,0x0d,0x00,0x12,0x09,0x13,0x00,0x02,0x0d,
-0x00,0x08,0x5c,0x0e,0x28,0xf3,0xaf,0x0d,0x00,0x18,0x9f,0x0d,0x00,0x18,0x8f,0x0d,
-0x00,0x18,0x7f,0x0d,0x00,0x02,0x03,0x09,0x75,0x77,0xbf,0xff,0xff,0xfa,0x77,0x71,
-0x9d,0x11,0x06,0x45,0x01,0x0f,0x0d,0x00,0x36,0x06,0xf9,0x01,0x37,0x60,0x00,0x0e,
-0x0c,0x00,0x17,0x0f,0x0c,0x00,0x17,0x1f,0x0c,0x00,0x16,0x3f,0x0c,0x00,0x00,0x9e,
-0x02,0x21,0xfb,0xbb,0x01,0x00,0x10,0x40,0x64,0x01,0x17,0xc0,0x90,0x02,0x17,0xa0,
-0xee,0x01,0x17,0x70,0x5c,0x11,0x05,0xe7,0x04,0x08,0xe6,0x02,0x00,0xb3,0x02,0x43,
-0xad,0xff,0xec,0x83,0x7b,0x03,0x01,0x64,0x02,0x14,0xb2,0xf7,0x01,0x11,0xff,0xb3,
-0x02,0x17,0x06,0xab,0x0f,0x06,0x4d,0x16,0x11,0xfc,0x0c,0x00,0x32,0xb5,0x32,0x48,
-0x8c,0x14,0x3b,0x04,0x7b,0xe5,0x8c,0x14,0x27,0x02,0xff,0x34,0x03,0x17,0xaf,0xaf,
-0x0a,0x17,0x6f,0xd6,0x03,0x16,0x4f,0xa8,0x11,0x03,0x7f,0x10,0x06,0x18,0x00,0x00,
-0xdc,0x07,0x03,0x43,0x02,0x22,0xf6,0x5f,0x1c,0x00,0x00,0xe7,0x02,0x20,0xf3,0x2f,
-0x5e,0x0a,0x02,0xa3,0x00,0x31,0xe0,0x0c,0xff,0xc2,0x0f,0x10,0x3e,0xc6,0x03,0x11,
-0x04,0xc8,0x08,0x12,0x8b,0x9f,0x10,0x17,0xaf,0x48,0x03,0x17,0x0c,0xa5,0x04,0x04,
-0x19,0x00,0x11,0xfa,0x03,0x03,0x16,0xdf,0x7f,0x06,0x75,0x00,0x03,0x8c,0xef,0xfe,
-0xc9,0x40,0xa4,0x01,0x43,0x59,0xce,0xef,0xb0,0xaa,0x05,0x15,0xbf,0xf3,0x05,0x26,
-0x01,0xbf,0xb5,0x11,0x16,0x5f,0xc1,0x11,0x17,0x07,0xcd,0x11,0x11,0x6f,0x53,0x00,
-0x24,0xba,0x70,0xd5,0x11,0x16,0xa4,0x3b,0x03,0x16,0xc2,0xdd,0x11,0x17,0xfa,0x59,
-0x04,0x17,0xd0,0x91,0x03,0x43,0x30,0x01,0x56,0x75,0x81,0x0f,0x31,0xfc,0x05,0xcf,
-0xd8,0x16,0x00,0x1b,0x02,0x23,0xf8,0xbf,0xd0,0x04,0x06,0x03,0x02,0x37,0xd1,0x00,
-0x5f,0xae,0x05,0x07,0xce,0x02,0x01,0xf9,0x05,0x40,0xfb,0x41,0x03,0xaf,0x8c,0x01,
-0x12,0x9f,0x2a,0x05,0x13,0x07,0x0c,0x03,0x04,0x44,0x01,0x23,0xf6,0xaf,0xb9,0x06,
-0x00,0xe5,0x04,0x03,0x0c,0x00,0x00,0x6b,0x02,0x10,0xfb,0xcf,0x04,0x04,0xac,0x07,
-0x03,0x40,0x09,0x00,0x80,0x00,0x14,0xfd,0xbf,0x02,0x00,0x18,0x00,0x03,0xa8,0x01,
-0x00,0x5a,0x04,0x22,0xfa,0x0f,0x6c,0x07,0x00,0x80,0x00,0x22,0xf7,0x0a,0x65,0x05,
-0x10,0x02,0x29,0x02,0x12,0x03,0xce,0x04,0x11,0x2d,0x10,0x02,0x00,0x8a,0x00,0x22,
-0xd9,0x8b,0xa4,0x15,0x14,0x1e,0xa7,0x00,0x14,0xf9,0xf5,0x12,0x03,0x33,0x02,0x16,
-0x2e,0x79,0x06,0x03,0xdc,0x18,0x03,0xcb,0x05,0x52,0x01,0x6a,0xde,0xfe,0xd9,0x70,
-0x11,0x06,0x01,0x00,0x17,0x89,0x0c,0x00,0x1f,0xf8,0x19,0x00,0x12,0x23,0x34,0x88,
-0x01,0x00,0x17,0xdf,0x2e,0x03,0x17,0x1f,0x96,0x03,0x01,0xce,0x1a,0x07,0x97,0x01,
-0x17,0x70,0x8c,0x13,0x16,0xf1,0x52,0x0f,0x06,0xab,0x06,0x13,0x05,0xde,0x05,0x05,
-0xee,0x13,0x07,0xbd,0x02,0x17,0xf4,0x3b,0x08,0x27,0xfd,0x00,0xff,0x07,0x17,0x60,
-0x9d,0x03,0x17,0xf0,0xa4,0x05,0x18,0xf8,0xcc,0x14,0x17,0x10,0xcf,0x17,0x05,0xce,
-0x03,0x04,0x8f,0x01,0x08,0x53,0x09,0x04,0x7d,0x02,0x17,0x50,0xb8,0x00,0x17,0xe0,
-0x68,0x03,0x15,0xf7,0xa9,0x11,0x07,0x56,0x00,0x18,0x05,0xf3,0x06,0x17,0xcf,0x59,
-0x14,0x16,0x4f,0x9f,0x14,0x01,0xe7,0x13,0x17,0x40,0xb8,0x00,0x17,0xd0,0xca,0x03,
-0x17,0xf6,0xb8,0x00,0x18,0xfe,0xb8,0x00,0x16,0x80,0xf2,0x0a,0x42,0xad,0xef,0xfe,
-0xc8,0x40,0x00,0x25,0x1a,0xff,0xcd,0x01,0x26,0x04,0xef,0xe5,0x01,0x17,0x4f,0x95,
-0x03,0x16,0xdf,0x5d,0x18,0x01,0x6d,0x04,0x21,0xa8,0x9c,0xac,0x1a,0x12,0x0b,0xdd,
-0x03,0x10,0x5f,0x8b,0x00,0x00,0x20,0x05,0x03,0x1a,0x14,0x00,0xb9,0x16,0x13,0xfd,
-0x9b,0x06,0x13,0x80,0x0a,0x01,0x10,0x03,0x0c,0x00,0x12,0x0d,0x8f,0x00,0x10,0x06,
-0x11,0x01,0x12,0x08,0x8d,0x02,0x00,0xf8,0x00,0x01,0xa6,0x08,0x30,0xf8,0x20,0x04,
-0x9a,0x0e,0x07,0x1f,0x06,0x16,0xa0,0x90,0x00,0x17,0xf9,0x1a,0x08,0x10,0x50,0x78,
-0x01,0x15,0xaf,0x90,0x07,0x06,0xb1,0x02,0x21,0x80,0x00,0xc3,0x07,0x01,0x9c,0x00,
-0x11,0xf7,0x89,0x00,0x12,0xa0,0x9c,0x00,0x22,0x20,0x1f,0x84,0x00,0x01,0x58,0x01,
-0x16,0x6f,0x1d,0x0d,0x27,0xf0,0xaf,0x8d,0x0c,0x08,0x89,0x19,0x16,0xbf,0x18,0x00,
-0x23,0xf4,0xaf,0x30,0x00,0x12,0xcf,0x48,0x08,0x13,0xfc,0xd8,0x00,0x01,0x3b,0x08,
-0x12,0xa0,0xd9,0x04,0x30,0xb0,0x0c,0xff,0x78,0x00,0x11,0x8c,0x9e,0x00,0x18,0x03,
-0xa3,0x09,0x16,0x6f,0x0d,0x04,0x05,0xa6,0x05,0x10,0xfc,0xe7,0x01,0x26,0x2a,0xff,
-0x15,0x1b,0x01,0x8c,0x01,0x23,0xc9,0x50,0xfc,0x01,0x47,0xad,0xff,0xed,0x94,0x45,
-0x1a,0x27,0xff,0xd4,0x91,0x1a,0x01,0xc0,0x01,0x16,0x0c,0xa0,0x03,0x06,0xce,0x1c,
-0x12,0x60,0x2e,0x08,0x21,0xa8,0xaf,0xbf,0x09,0x11,0x0d,0x98,0x01,0x23,0x01,0xcf,
-0x4f,0x10,0x13,0xfe,0x04,0x19,0x00,0xd0,0x00,0x14,0xf6,0x80,0x01,0x15,0xcf,0x45,
-0x13,0x23,0xff,0x90,0xe4,0x04,0x00,0x9d,0x02,0x13,0xc0,0x21,0x06,0x00,0xf0,0x00,
-0x14,0xe0,0x57,0x02,0x00,0x1c,0x01,0x00,0x30,0x01,0x04,0x0c,0x00,0x13,0xbf,0xea,
-0x02,0x00,0x0c,0x00,0x12,0x8f,0x2e,0x02,0x10,0x01,0x14,0x01,0x12,0x3f,0xd4,0x01,
-0x10,0x2d,0x0c,0x00,0x10,0x0d,0x02,0x01,0x30,0x53,0x59,0xff,0x0c,0x00,0x17,0x05,
-0xee,0x1c,0x07,0x26,0x04,0x13,0xd0,0xad,0x0d,0x12,0xfd,0x4b,0x01,0x01,0xe4,0x07,
-0x12,0xa1,0x43,0x00,0x67,0x01,0x6b,0xdf,0xfd,0x93,0x03,0x08,0x07,0x13,0x09,0x38,
-0x14,0x0c,0x8f,0x0a,0x07,0x1f,0x03,0x16,0x2c,0x8d,0x03,0x23,0x39,0xff,0x4f,0x03,
-0x35,0x0a,0xbc,0xdf,0x12,0x09,0x17,0x0e,0x8c,0x0a,0x17,0x0e,0x82,0x18,0x15,0x0e,
-0x3a,0x0b,0x02,0x0c,0x00,0x24,0xfd,0x60,0x4b,0x04,0x23,0xed,0xa7,0x7f,0x00,0x30,
-0x5c,0xfe,0x91,0x4a,0x02,0x20,0xd0,0x0e,0x6b,0x01,0x00,0x7c,0x01,0x10,0x0f,0x49,
-0x00,0x01,0x8c,0x05,0x8f,0x9f,0xff,0xd3,0x00,0x00,0x03,0x20,0x00,0x01,0x00,0x1b,
-0x21,0x01,0x32,0x9b,0x11,0x20,0x30,0x08,0xa8,0x00,0x00,0x8a,0x00,0x13,0x0f,0x88,
-0x01,0x20,0xf6,0x06,0x3c,0x03,0x01,0x9b,0x11,0x31,0x09,0xef,0xd6,0xe0,0x00,0x11,
-0x80,0x70,0x02,0x10,0x07,0xb6,0x05,0x11,0x05,0xdf,0x01,0x10,0xef,0x94,0x03,0x11,
-0x2c,0xcb,0x0e,0x3f,0x23,0x10,0x00,0x01,0x00,0x2a,0x42,0x03,0x33,0x33,0x10,0x1c,
-0x15,0x0e,0x05,0x00,0x33,0x70,0x00,0x3f,0xc9,0x08,0x10,0x40,0x16,0x03,0x00,0x33,
-0x03,0x30,0xfb,0x00,0x03,0x3b,0x05,0x10,0x0a,0x81,0x00,0x10,0x3f,0x5d,0x05,0x11,
-0x4e,0x51,0x02,0x2f,0x7e,0x70,0x62,0x00,0x08,0x14,0x96,0x0a,0x00,0x14,0x5c,0xb2,
-0x05,0x23,0x17,0xef,0x7a,0x01,0x24,0x03,0xaf,0x90,0x01,0x14,0x5c,0x8f,0x01,0x23,
-0x17,0xef,0xa5,0x01,0x13,0x03,0xe3,0x03,0x33,0xe4,0x00,0x5c,0x11,0x08,0x13,0x40,
-0x61,0x0b,0x23,0xfb,0x60,0xf9,0x02,0x23,0xfd,0x71,0x08,0x05,0x24,0xfe,0x83,0x25,
-0x03,0x25,0xfb,0x10,0x1d,0x05,0x27,0xff,0xb5,0x3a,0x03,0x13,0xa4,0x6e,0x00,0x00,
-0x2d,0x00,0x62,0x93,0x00,0x00,0x00,0x18,0xef,0x0c,0x00,0x00,0xc6,0x1c,0x16,0x6d,
-0x4c,0x04,0x26,0x03,0xaf,0x23,0x02,0x26,0x18,0xef,0xa4,0x1a,0x15,0x6c,0x9f,0x0c,
-0x00,0x23,0x00,0x05,0xb5,0x05,0x26,0x18,0xef,0xf9,0x00,0x34,0x54,0x79,0x99,0x01,
-0x00,0x26,0x91,0xdf,0x91,0x09,0x0f,0x0b,0x00,0x19,0x0f,0xb9,0x01,0x19,0x0f,0x6e,
-0x00,0x2f,0x16,0x2b,0x4b,0x09,0x37,0x3f,0xfd,0x71,0xe4,0x09,0x16,0x92,0x0b,0x00,
-0x26,0xff,0xc5,0x0b,0x00,0x35,0xff,0xe7,0x10,0x0b,0x00,0x36,0xff,0xfa,0x30,0xfe,
-0x0c,0x20,0xfc,0x60,0xf0,0x1b,0x16,0xdf,0x51,0x01,0x12,0x03,0x34,0x11,0x02,0x1a,
-0x1c,0x35,0x49,0xef,0xff,0x83,0x16,0x25,0x05,0xaf,0x0b,0x00,0x01,0x8f,0x11,0x25,
-0xf3,0x00,0x22,0x00,0x10,0xf3,0x91,0x0a,0x14,0x8e,0xae,0x11,0x23,0x17,0xdf,0x20,
-0x05,0x23,0x01,0x6c,0x4c,0x05,0x14,0x50,0x25,0x20,0x24,0xf9,0x20,0x84,0x00,0x15,
-0xd6,0x8f,0x00,0x14,0xb4,0xa5,0x00,0x24,0xfe,0x82,0xb0,0x00,0x24,0xfd,0x60,0xc6,
-0x00,0x15,0xfa,0x4b,0x0b,0x17,0x28,0x2d,0x03,0x00,0xb6,0x08,0x36,0xff,0xec,0x84,
-0xcd,0x08,0x01,0x69,0x05,0x15,0x2d,0x4b,0x06,0x25,0x01,0xdf,0xf2,0x06,0x16,0x0a,
-0x66,0x1f,0x10,0x2f,0x8b,0x00,0x20,0x9b,0xef,0xac,0x03,0x11,0x8f,0x7b,0x0b,0x10,
-0x0a,0xd3,0x04,0x14,0xcf,0xf1,0x0c,0x04,0x26,0x05,0x00,0x75,0x02,0x42,0xf2,0x56,
-0x66,0x66,0xdd,0x1e,0x05,0x9d,0x08,0x04,0x43,0x05,0x02,0x0e,0x07,0x16,0xa0,0x37,
-0x0f,0x15,0x40,0x1d,0x10,0x16,0xfb,0x15,0x00,0x15,0xd1,0x62,0x10,0x03,0x3e,0x10,
-0x03,0xc2,0x1b,0x03,0x99,0x06,0x25,0xfd,0x10,0x82,0x08,0x16,0xd1,0xed,0x10,0x15,
-0x20,0x02,0x0f,0x16,0xf9,0xe0,0x08,0x16,0xf5,0x64,0x08,0x14,0xf3,0x01,0x11,0x3f,
-0x55,0x55,0x50,0x61,0x02,0x0b,0x36,0x02,0x30,0x00,0x27,0x20,0x16,0x80,0x86,0x0e,
-0x16,0xf8,0xbd,0x08,0x16,0xfe,0xf9,0x08,0x1e,0xff,0x16,0x00,0x16,0x0d,0x88,0x08,
-0x39,0x01,0xae,0xfd,0x6e,0x00,0x69,0x36,0x9b,0xcd,0xcb,0xa8,0x51,0x6f,0x00,0x26,
-0x28,0xef,0x4c,0x02,0x04,0x82,0x00,0x05,0x23,0x0c,0x28,0xe7,0x00,0x4c,0x09,0x04,
-0x48,0x07,0x17,0x20,0x86,0x1e,0x65,0xd8,0x52,0x10,0x01,0x36,0xae,0x30,0x06,0x00,
-0x9b,0x02,0x22,0xfc,0x40,0x16,0x01,0x14,0xdf,0x60,0x01,0x17,0x0d,0x4c,0x0a,0x13,
-0x8f,0x0a,0x19,0x15,0x0b,0x53,0x01,0x02,0x38,0x20,0x03,0x64,0x00,0x27,0xd1,0x00,
-0xe9,0x1d,0x12,0xf5,0x2c,0x0d,0x08,0x9f,0x03,0x11,0xbf,0xc5,0x09,0x13,0xbf,0x50,
-0x00,0x23,0x01,0x21,0x4f,0x0d,0x01,0x39,0x1d,0x11,0xfb,0xde,0x02,0x41,0xbf,0xff,
-0xfe,0xa4,0x89,0x01,0x11,0xfb,0x8e,0x01,0x13,0x20,0xa0,0x06,0x21,0xff,0xfc,0xbf,
-0x02,0x10,0xf1,0xb8,0x01,0x16,0xb0,0x65,0x09,0x10,0x30,0x3e,0x02,0x31,0x40,0x00,
-0x6f,0x97,0x0a,0x15,0x3f,0xb5,0x14,0x72,0x0a,0xff,0xf8,0x00,0x0b,0xff,0xfe,0xbc,
-0x00,0x31,0xe6,0x20,0x1b,0x48,0x00,0x41,0x7f,0xff,0xb0,0x00,0x3e,0x02,0x11,0x08,
-0x7c,0x22,0x30,0xaf,0xff,0xf0,0xda,0x08,0x51,0xfd,0x00,0x4f,0xff,0xf5,0x0f,0x02,
-0x11,0xf3,0xf4,0x01,0x01,0x48,0x00,0x23,0xe0,0x07,0x32,0x00,0x11,0xfa,0x7e,0x02,
-0x11,0xd0,0x79,0x02,0x02,0x32,0x00,0x11,0x0d,0x16,0x01,0x31,0x0f,0xff,0xfc,0x50,
-0x07,0x20,0xf0,0x0c,0xb1,0x09,0x12,0x02,0xa0,0x02,0x01,0x5d,0x00,0x00,0x29,0x00,
-0x10,0xdf,0x0a,0x08,0x13,0x6f,0x23,0x00,0x11,0xf9,0x52,0x00,0x41,0xf0,0x0e,0xff,
-0xfa,0x8d,0x07,0x11,0x90,0x23,0x00,0x12,0x80,0x7b,0x00,0x01,0x32,0x00,0x11,0xbf,
-0x18,0x05,0x11,0x5f,0xf5,0x01,0x10,0x7f,0xb3,0x1a,0x11,0xf9,0x89,0x00,0x11,0x60,
-0x99,0x02,0x12,0x50,0xcd,0x00,0x01,0x29,0x00,0x11,0xdf,0x23,0x00,0x02,0xc8,0x20,
-0x10,0xef,0x39,0x0a,0x11,0xfb,0x29,0x00,0x02,0x0d,0x0a,0x10,0x20,0x14,0x01,0x50,
-0xf1,0x00,0xcf,0xff,0xc0,0x52,0x00,0x14,0xfb,0x16,0x1d,0x00,0x8c,0x21,0x01,0x0a,
-0x01,0x10,0x07,0xe1,0x00,0x20,0x02,0xef,0xbe,0x00,0x10,0x06,0x38,0x01,0x31,0x8f,
-0xff,0xf2,0x11,0x08,0x21,0xf7,0x58,0x5b,0x09,0x10,0x06,0x9a,0x00,0x11,0x05,0x70,
-0x00,0x14,0xbf,0xb1,0x1e,0x11,0xdf,0x28,0x01,0x10,0x1f,0xb9,0x00,0x11,0x02,0x14,
-0x00,0x11,0x56,0x06,0x00,0x11,0xe2,0x14,0x01,0x12,0xf1,0xe9,0x13,0x34,0xfe,0x50,
-0x07,0xb2,0x04,0x11,0x07,0xd7,0x00,0xb3,0x01,0x8d,0xff,0xc7,0x10,0x00,0x03,0xad,
-0xfe,0xd9,0x30,0x88,0x0c,0x0e,0x6a,0x07,0x18,0x9f,0x0c,0x21,0x06,0x12,0x0c,0x1d,
-0xf9,0x15,0x00,0x18,0x06,0xaa,0x12,0x07,0xa6,0x12,0x23,0xfd,0x40,0xea,0x02,0x18,
-0x00,0xd6,0x0b,0x20,0xd7,0x20,0x13,0x00,0x15,0x7c,0x7d,0x0c,0x02,0x81,0x04,0x47,
-0xec,0xba,0xab,0xcf,0x17,0x10,0x03,0xcf,0x16,0x08,0x48,0x21,0x00,0x7e,0x00,0x16,
-0x8e,0x11,0x0a,0x16,0x00,0x2b,0x00,0x02,0x27,0x1c,0x2a,0xb6,0x10,0xaa,0x00,0x4b,
-0x45,0x67,0x76,0x52,0x94,0x00,0x1b,0x5f,0xbe,0x00,0x16,0x0b,0x88,0x21,0x05,0x6e,
-0x04,0x09,0xf6,0x22,0x15,0x6f,0x12,0x0e,0x07,0x36,0x21,0x17,0xf1,0xc4,0x03,0x07,
-0xda,0x13,0x06,0x6c,0x05,0x05,0x71,0x0d,0x04,0x89,0x09,0x16,0xf3,0x25,0x19,0x06,
-0x64,0x16,0x05,0xcf,0x0c,0x17,0xd9,0xf9,0x0d,0x00,0x8a,0x01,0x27,0xf7,0x3f,0xca,
-0x03,0x13,0x06,0xdd,0x1a,0x17,0xb0,0x12,0x0a,0x27,0xd0,0x08,0x4e,0x0d,0x10,0x2f,
-0x22,0x01,0x16,0x3f,0x27,0x01,0x01,0x0e,0x1b,0x01,0x68,0x18,0x08,0xe2,0x0f,0x16,
-0x08,0x3c,0x04,0x14,0x4f,0x87,0x0c,0x16,0xf9,0x7f,0x01,0x11,0x20,0xbe,0x05,0x15,
-0xe0,0x05,0x01,0x12,0xd0,0x48,0x00,0x18,0x50,0xc8,0x0d,0x14,0x2f,0x0b,0x01,0x16,
-0x0c,0x7a,0x21,0x14,0xf1,0x05,0x01,0x00,0x0c,0x12,0x14,0xbe,0x0b,0x01,0x07,0x0d,
-0x10,0x17,0xfd,0x9a,0x0a,0x05,0x0b,0x01,0x05,0xdd,0x11,0x04,0x0b,0x01,0x19,0xaf,
-0x23,0x28,0x17,0x00,0x81,0x12,0x02,0xdd,0x0a,0x15,0x06,0x01,0x0e,0x15,0x08,0xeb,
-0x15,0x16,0xf7,0x5f,0x14,0x15,0x10,0x0d,0x22,0x02,0x96,0x00,0x11,0xf7,0x27,0x00,
-0x16,0xc0,0x10,0x01,0x10,0xd0,0x05,0x01,0x17,0xf7,0x91,0x14,0x26,0x30,0x4f,0x3c,
-0x0f,0x00,0x32,0x00,0x27,0xf9,0x0a,0x39,0x12,0x10,0x07,0x16,0x02,0x03,0x8d,0x00,
-0x20,0xdc,0x96,0x68,0x01,0x06,0xf4,0x0c,0x17,0x30,0x0d,0x00,0x02,0x4f,0x28,0x16,
-0xff,0xd0,0x0d,0x09,0xb5,0x00,0x00,0xb0,0x03,0x32,0xbb,0xbb,0xcd,0xd3,0x00,0x03,
-0x36,0x02,0x01,0xd5,0x02,0x14,0x30,0x43,0x02,0x01,0xb6,0x2a,0x04,0x0d,0x00,0x10,
-0x09,0x0b,0x01,0x04,0x0d,0x00,0x18,0x06,0x0d,0x00,0x10,0x07,0xb1,0x07,0x04,0x0d,
-0x00,0x01,0x41,0x23,0x04,0x0d,0x00,0x16,0x4f,0x5b,0x00,0x24,0x01,0x39,0x75,0x00,
-0x06,0x2f,0x0e,0x06,0x0c,0x00,0x18,0xe6,0xa9,0x00,0x18,0x71,0x0d,0x00,0x28,0xfe,
-0x50,0x34,0x00,0x20,0xf7,0x00,0x3a,0x09,0x58,0x11,0x11,0x11,0x25,0xcf,0xa9,0x00,
-0x10,0x0a,0x75,0x01,0x04,0x0d,0x00,0x01,0xe3,0x27,0x04,0x06,0x03,0x00,0x89,0x01,
-0x15,0xf4,0x0d,0x00,0x00,0x9b,0x0f,0x08,0x0d,0x00,0x15,0xf5,0x0d,0x00,0x17,0xef,
-0x27,0x00,0x01,0xea,0x0b,0x03,0x0d,0x00,0x20,0x01,0x8f,0x9e,0x01,0x00,0x71,0x09,
-0x41,0xaa,0xaa,0xaa,0xcf,0x4c,0x03,0x09,0x0b,0x02,0x09,0x39,0x02,0x27,0xff,0xff,
-0x15,0x14,0x06,0x0c,0x00,0x15,0x80,0xd0,0x00,0x24,0xee,0xc8,0xbc,0x03,0x08,0x3b,
-0x18,0x22,0x00,0x07,0x4b,0x04,0x14,0xc5,0xee,0x07,0x07,0xbe,0x09,0x15,0x5f,0x46,
-0x00,0x19,0x20,0x97,0x02,0x13,0xe2,0x78,0x0f,0x23,0xfe,0xde,0x13,0x26,0x10,0xaf,
-0x0f,0x24,0x44,0x00,0x00,0x15,0xdf,0x04,0x0f,0x14,0xf9,0x40,0x04,0x15,0xd0,0x3b,
-0x02,0x10,0x01,0xd9,0x00,0x14,0x0f,0x69,0x03,0x00,0xc5,0x08,0x25,0xf7,0x4f,0x0d,
-0x04,0x00,0xe9,0x12,0x15,0x8f,0x74,0x03,0x57,0x2c,0xcc,0xcc,0xca,0xbf,0xc9,0x10,
-0x01,0x85,0x02,0x28,0xf4,0x00,0xff,0x11,0x06,0x34,0x04,0x01,0x95,0x01,0x0f,0x0e,
-0x00,0x21,0x0a,0x46,0x00,0x0a,0x62,0x00,0x0a,0x7e,0x00,0x15,0x8f,0xf9,0x08,0x55,
-0x29,0x99,0x99,0x97,0x4f,0xde,0x11,0x00,0xb6,0x00,0x14,0x1f,0x2b,0x03,0x00,0xd2,
-0x00,0x24,0xf8,0x0a,0xdb,0x09,0x10,0x01,0x94,0x01,0x14,0x03,0xa0,0x05,0x02,0x4a,
-0x05,0x12,0xcf,0x63,0x2a,0x01,0xd7,0x14,0x12,0x70,0xd2,0x0a,0x23,0xed,0xcd,0x07,
-0x04,0x19,0x05,0x5e,0x01,0x16,0x00,0xf2,0x16,0x18,0x30,0xee,0x05,0x17,0xc2,0x97,
-0x1b,0x24,0xff,0xc6,0xe1,0x05,0x05,0xce,0x01,0x02,0x18,0x00,0x24,0xeb,0x84,0x85,
-0x12,0x02,0xbc,0x01,0x28,0x71,0x00,0xa4,0x03,0x19,0xe5,0x41,0x04,0x00,0x99,0x06,
-0x09,0x57,0x1a,0x00,0x1b,0x00,0x33,0xcb,0xbb,0xde,0x63,0x10,0x02,0x88,0x02,0x21,
-0x03,0x9f,0x3e,0x03,0x13,0x0f,0x57,0x05,0x11,0x3e,0xcd,0x00,0x16,0xff,0x17,0x24,
-0x24,0xff,0x70,0x1b,0x00,0x02,0x9a,0x1e,0x09,0xd8,0x02,0x05,0x1b,0x00,0x18,0x09,
-0xa9,0x03,0x00,0x3b,0x01,0x15,0xfc,0x1b,0x00,0x13,0x02,0x53,0x04,0x24,0xf1,0x00,
-0xf9,0x03,0x15,0x0f,0xc3,0x05,0x09,0x50,0x03,0x00,0x17,0x00,0x18,0x2f,0x1b,0x00,
-0x19,0xf2,0x1b,0x00,0x14,0x1f,0x1b,0x00,0x01,0x90,0x10,0x05,0x1b,0x00,0x18,0x2f,
-0x51,0x00,0x22,0x06,0xff,0xe7,0x10,0x14,0xf1,0xb4,0x01,0x15,0xf9,0x1b,0x00,0x18,
-0x0f,0x3e,0x04,0x01,0xe7,0x04,0x04,0x1b,0x00,0x01,0xdb,0x26,0x04,0xd8,0x00,0x01,
-0x32,0x08,0x13,0x10,0x1b,0x00,0x12,0x29,0x6f,0x07,0x01,0xe4,0x05,0x22,0xbc,0xef,
-0xe9,0x04,0x07,0xa0,0x05,0x18,0xc0,0x5f,0x01,0x29,0xb0,0x00,0x3c,0x18,0x06,0x1b,
-0x00,0x25,0xf8,0x10,0x95,0x01,0x22,0xfe,0xb9,0x16,0x08,0x07,0xdb,0x03,0x17,0xef,
-0xda,0x03,0x0f,0x17,0x00,0x13,0x12,0xcb,0x7b,0x18,0x17,0xba,0x8e,0x07,0x17,0x0f,
-0x14,0x07,0x0f,0x17,0x00,0x2a,0x11,0x98,0xa6,0x15,0x27,0x85,0x00,0xa3,0x06,0x06,
-0xd5,0x00,0x1f,0xf9,0x17,0x00,0x14,0x0f,0x8a,0x00,0x32,0x0f,0x17,0x00,0x0f,0x03,
-0x83,0x19,0x2e,0xbb,0xaf,0x42,0x01,0x0f,0x59,0x01,0x1f,0x26,0x4f,0xff,0x7c,0x25,
-0x0f,0x17,0x00,0x13,0x03,0x87,0x01,0x1f,0xb3,0xe6,0x00,0x53,0x1f,0x60,0x87,0x01,
-0x1f,0x07,0x17,0x00,0x0f,0xa1,0x00,0x49,0x0f,0x17,0x00,0x2f,0x02,0x55,0x30,0x44,
-0xdf,0xff,0xec,0x96,0x12,0x00,0x03,0xb7,0x11,0x16,0xa3,0x81,0x2b,0x05,0xa2,0x2b,
-0x09,0x84,0x15,0x03,0x84,0x0a,0x05,0x34,0x15,0x01,0xe0,0x06,0x22,0xdb,0xce,0x42,
-0x27,0x01,0x8b,0x09,0x51,0xe6,0x10,0x00,0x02,0x9f,0x06,0x09,0x14,0x1f,0x4e,0x0f,
-0x10,0x5f,0x78,0x05,0x01,0x89,0x07,0x05,0x25,0x04,0x00,0x39,0x00,0x15,0xf8,0xd5,
-0x0a,0x16,0xc0,0x52,0x09,0x58,0x0c,0xee,0xee,0xed,0x05,0x82,0x17,0x01,0x56,0x00,
-0x19,0xfa,0xea,0x0b,0x07,0x7a,0x17,0x0b,0x5a,0x06,0x12,0x0c,0x0a,0x04,0x21,0x01,
-0x33,0x01,0x00,0x13,0x30,0x4c,0x10,0x03,0x39,0x16,0x16,0x0c,0xfa,0x2f,0x00,0xd0,
-0x04,0x00,0x19,0x1a,0x06,0x1d,0x00,0x12,0x0b,0x3a,0x00,0x04,0x1d,0x00,0x03,0x3e,
-0x1a,0x03,0x1d,0x00,0x16,0x08,0x62,0x10,0x12,0xff,0x5f,0x23,0x16,0xfe,0x55,0x01,
-0x16,0x01,0x73,0x0b,0x04,0xab,0x15,0x15,0xa0,0x1d,0x00,0x01,0x7a,0x06,0x15,0x40,
-0x1d,0x00,0x14,0x01,0x83,0x06,0x01,0x1d,0x01,0x02,0x81,0x0f,0x13,0x92,0x71,0x20,
-0x12,0xf0,0xf0,0x0b,0x31,0xfe,0xcb,0xbd,0x74,0x00,0x07,0x8c,0x17,0x02,0xec,0x04,
-0x18,0x2d,0xfd,0x09,0x04,0x69,0x18,0x02,0x55,0x09,0x00,0x84,0x08,0x19,0xbf,0xc6,
-0x06,0x00,0x45,0x2c,0x15,0xff,0x4f,0x0a,0x15,0xf1,0x79,0x12,0x1f,0xfd,0x0e,0x00,
-0x98,0x03,0x89,0x03,0x12,0xcf,0x0e,0x00,0x07,0xe6,0x0b,0x0f,0x0e,0x00,0x28,0x0e,
-0x0a,0x01,0x0f,0x0e,0x00,0xaa,0x00,0x4a,0x09,0x0f,0x04,0x00,0x71,0x07,0xf1,0x14,
-0x1f,0xfd,0x0c,0x00,0xf5,0x44,0x07,0x77,0x77,0x77,0x0c,0x00,0x04,0x7d,0x05,0x00,
-0xa7,0x09,0x01,0xc6,0x38,0x03,0x07,0x05,0x13,0x0b,0x59,0x24,0x12,0xff,0xac,0x18,
-0x00,0x49,0x01,0x10,0x3d,0xe2,0x01,0x11,0x01,0x09,0x0c,0x12,0xbd,0xb2,0x0e,0x04,
-0xbd,0x0a,0x00,0x66,0x13,0x18,0x0b,0xda,0x0e,0x15,0xaf,0xa0,0x0c,0x04,0xdd,0x1f,
-0x03,0x1a,0x05,0x68,0x04,0x8c,0xef,0xff,0xda,0x61,0xfc,0x03,0x18,0x8f,0xdd,0x09,
-0x11,0x04,0x79,0x10,0x04,0x0e,0x00,0x18,0x2e,0x8d,0x09,0x01,0x55,0x0b,0x14,0xb0,
-0x0e,0x00,0x12,0x0a,0x4d,0x0b,0x03,0x0e,0x00,0x12,0x6f,0xc2,0x05,0x03,0xc5,0x0a,
-0x03,0x85,0x34,0x02,0x0e,0x00,0x13,0x1e,0x2d,0x06,0x02,0x0e,0x00,0x04,0x42,0x20,
-0x01,0x0e,0x00,0x14,0x08,0x98,0x0f,0x01,0x0e,0x00,0x14,0x4f,0x06,0x06,0x01,0xe6,
-0x00,0x14,0xef,0x1d,0x05,0x00,0x0e,0x00,0x15,0x0c,0x7e,0x11,0x00,0x0e,0x00,0x15,
-0x8f,0x7a,0x20,0x00,0x2d,0x0b,0x06,0xe7,0x10,0x07,0x69,0x0b,0x07,0xd7,0x09,0x19,
-0x50,0x0e,0x00,0x19,0xe1,0x0e,0x00,0x1a,0xfa,0x01,0x0a,0x15,0x40,0x0e,0x00,0x14,
-0xaf,0x2b,0x00,0x01,0x26,0x00,0x14,0x08,0x67,0x0d,0x02,0x6f,0x05,0x13,0xdf,0x2b,
-0x00,0x02,0x91,0x0d,0x13,0x3f,0xbb,0x11,0x02,0xe0,0x00,0x13,0x09,0x2b,0x00,0x03,
-0x18,0x01,0x18,0xef,0x0a,0x01,0x22,0x00,0x4f,0xbd,0x06,0x07,0x42,0x01,0x05,0xf9,
-0x0b,0x02,0x41,0x26,0x15,0x30,0x6c,0x01,0x11,0x6f,0x2b,0x00,0x04,0x0e,0x00,0x19,
-0x0b,0x3c,0x08,0x28,0x02,0xff,0x14,0x0f,0x23,0x00,0x7f,0xba,0x0e,0x15,0xf1,0xe7,
-0x06,0x1f,0xf8,0x66,0x08,0x8e,0x0f,0x17,0x00,0x91,0x04,0xd3,0x0a,0x07,0x64,0x0c,
-0x17,0xf0,0x33,0x06,0x0f,0x17,0x00,0x14,0x18,0xf6,0xc9,0x34,0x19,0xff,0xd8,0x35,
-0x17,0xdf,0x56,0x38,0x07,0xc5,0x13,0x08,0xca,0x13,0x07,0xb3,0x3a,0x18,0xd0,0x7a,
-0x26,0x08,0xcd,0x13,0x19,0x3f,0x08,0x12,0x1a,0x00,0x20,0x22,0x15,0xfe,0x81,0x0f,
-0x0a,0xe6,0x02,0x06,0x63,0x10,0x12,0xbf,0x05,0x14,0x00,0x8f,0x02,0x12,0xfb,0x12,
-0x00,0x12,0x7f,0x81,0x13,0x00,0x10,0x01,0x12,0xe7,0x12,0x00,0x12,0x79,0x08,0x14,
-0x00,0xa4,0x04,0x12,0x98,0x12,0x00,0x12,0x83,0x3d,0x03,0x00,0xd0,0x03,0x13,0x38,
-0xe7,0x0a,0x10,0xdf,0x3e,0x01,0x00,0xb0,0x04,0x23,0xfd,0x09,0x8b,0x08,0x14,0x8f,
-0x38,0x09,0x23,0xf7,0x0a,0x12,0x00,0x11,0x2f,0xba,0x03,0x00,0x18,0x27,0x03,0xae,
-0x04,0x00,0xd3,0x1f,0x11,0xf1,0xf3,0x08,0x23,0xc0,0x0b,0xc8,0x0d,0x00,0x30,0x00,
-0x01,0x2f,0x01,0x23,0x60,0x0c,0x12,0x00,0x01,0xc1,0x35,0x00,0x2f,0x01,0x04,0xfe,
-0x00,0x10,0xd0,0x78,0x00,0x31,0x20,0x02,0xff,0x22,0x3d,0x02,0xef,0x1e,0x00,0x9c,
-0x00,0x20,0x80,0x08,0x6b,0x0a,0x14,0x0e,0x12,0x00,0x12,0x0f,0x49,0x1e,0x14,0xe0,
-0x0b,0x0e,0x10,0xf0,0x9e,0x03,0x10,0xf3,0xcb,0x3d,0x05,0x12,0x00,0x00,0x08,0x01,
-0x20,0xf9,0x9f,0x79,0x03,0x03,0x12,0x00,0x11,0xf1,0x50,0x27,0x01,0x79,0x27,0x15,
-0x1f,0x12,0x00,0x13,0x8f,0xfe,0x15,0x06,0x12,0x00,0x13,0x2f,0x08,0x00,0x06,0x12,
-0x00,0x13,0x0c,0x84,0x0e,0x06,0x12,0x00,0x13,0x06,0x7c,0x0e,0x06,0x12,0x00,0x12,
-0x01,0xbd,0x09,0x07,0x12,0x00,0x10,0x00,0x5c,0x27,0x0a,0x12,0x00,0x12,0x5f,0x1e,
-0x11,0x07,0x12,0x00,0x12,0x0f,0x90,0x01,0x07,0x12,0x00,0x02,0x18,0x18,0x04,0x12,
-0x00,0x16,0xf6,0xa8,0x2b,0x02,0x0a,0x06,0x07,0x0e,0x00,0x29,0xff,0x90,0x0e,0x00,
-0x19,0xf3,0x0e,0x00,0x19,0xfd,0x0e,0x00,0x29,0xff,0x70,0x0e,0x00,0x19,0xf1,0x0e,
-0x00,0x19,0xfa,0x0e,0x00,0x29,0xff,0x40,0x0e,0x00,0x19,0xd0,0x0e,0x00,0x19,0xf8,
-0x0e,0x00,0x25,0xff,0x20,0x0e,0x00,0x12,0xf7,0xb8,0x05,0x03,0x0e,0x00,0x12,0xf1,
-0x82,0x0b,0x04,0x0e,0x00,0x02,0x42,0x23,0x04,0x0e,0x00,0x14,0x08,0x69,0x37,0x14,
-0xfc,0x89,0x1f,0x16,0xf2,0x0e,0x00,0x00,0x2a,0x07,0x06,0x0e,0x00,0x01,0x9e,0x0b,
-0x05,0x0e,0x00,0x10,0x02,0xb9,0x05,0x05,0x0e,0x00,0x00,0x46,0x02,0x16,0xf9,0x0e,
-0x00,0x12,0x0d,0xdd,0x02,0x03,0x0e,0x00,0x13,0x04,0x8f,0x03,0x03,0xec,0x00,0x19,
-0xaf,0x0e,0x00,0x19,0x1f,0x0e,0x00,0x19,0x06,0x0e,0x00,0x03,0x4f,0x3a,0x07,0x24,
-0x01,0x07,0x0e,0x00,0x19,0x09,0x0e,0x00,0x28,0x01,0xef,0x0e,0x00,0x29,0x00,0x6f,
-0x0e,0x00,0x19,0x0c,0x0e,0x00,0x19,0x02,0x0e,0x00,0x23,0x00,0x8f,0x29,0x04,0x65,
-0x02,0x7a,0xde,0xff,0xdb,0x72,0xb6,0x17,0x17,0xcf,0x42,0x14,0x05,0x9e,0x23,0x03,
-0x1b,0x3a,0x17,0x2d,0x96,0x14,0x08,0x92,0x2c,0x01,0xe7,0x12,0x16,0x0c,0x71,0x0f,
-0x13,0xfd,0x8e,0x04,0x42,0xf8,0x20,0x00,0x27,0x23,0x02,0x23,0x01,0xff,0xfd,0x1c,
-0x15,0x1d,0xdc,0x28,0x14,0xf2,0xbf,0x00,0x11,0xf9,0x51,0x03,0x15,0x80,0xc0,0x00,
-0x25,0x00,0x3f,0x27,0x05,0x01,0xaf,0x08,0x15,0x7f,0x99,0x18,0x01,0x3a,0x16,0x04,
-0x5c,0x27,0x02,0x35,0x01,0x16,0xb0,0x8e,0x2b,0x10,0x03,0x94,0x03,0x06,0x09,0x14,
-0x01,0x15,0x29,0x06,0x26,0x14,0x1a,0x01,0x0f,0x00,0x04,0x8c,0x12,0x0e,0x0f,0x00,
-0x05,0x2d,0x00,0x0b,0x4b,0x00,0x1a,0xdf,0x69,0x00,0x0a,0x87,0x00,0x1b,0xc0,0xa5,
-0x00,0x0a,0xc3,0x00,0x16,0x50,0xe1,0x00,0x00,0x8f,0x0e,0x0a,0xff,0x00,0x16,0xfa,
-0x1d,0x01,0x12,0x1c,0x41,0x03,0x10,0x7f,0xcb,0x02,0x42,0x10,0x00,0x16,0xef,0xa1,
-0x09,0x16,0x0c,0x9f,0x15,0x29,0xfe,0x10,0x77,0x01,0x19,0xf3,0x95,0x01,0x29,0xff,
-0x30,0xb3,0x01,0x19,0xc2,0xd1,0x01,0x15,0xd5,0xc8,0x19,0x58,0x7a,0xdf,0xff,0xeb,
-0x83,0x97,0x08,0x39,0xfd,0xb8,0x30,0x48,0x14,0x19,0xd6,0xb3,0x12,0x28,0xfc,0x10,
-0x04,0x13,0x28,0xfe,0x20,0xce,0x12,0x02,0x3a,0x13,0x42,0xcc,0xcc,0xcc,0xcd,0xc2,
-0x03,0x04,0x6a,0x08,0x14,0x7f,0x1f,0x16,0x14,0x10,0xeb,0x2d,0x18,0x90,0xa6,0x13,
-0x19,0xfd,0x2d,0x14,0x1f,0xf0,0x12,0x14,0x1e,0x18,0x05,0x36,0x00,0x00,0x0f,0x01,
-0x14,0xfb,0x51,0x00,0x23,0x05,0xef,0xd7,0x23,0x11,0xfc,0xbc,0x0d,0x00,0x3a,0x04,
-0x08,0x61,0x19,0x1a,0xf4,0xb8,0x18,0x07,0x1b,0x00,0x27,0xe4,0x00,0x67,0x17,0x15,
-0x81,0x0e,0x01,0x3b,0xfe,0xdb,0x84,0xc3,0x07,0x0c,0xcc,0x10,0x0f,0x1b,0x00,0x74,
-0x01,0x01,0x00,0x37,0x27,0xbd,0xff,0x0b,0x33,0x03,0xf9,0x01,0x18,0xc4,0xe2,0x3d,
-0x15,0xff,0x58,0x23,0x18,0x2e,0x0f,0x18,0x07,0x0f,0x00,0x02,0x10,0x00,0x1a,0x0d,
-0xcc,0x03,0x01,0x25,0x08,0x42,0x72,0x00,0x02,0x7f,0x7d,0x05,0x14,0x01,0x39,0x41,
-0x12,0x2d,0xc8,0x02,0x14,0x8f,0x61,0x08,0x11,0x2f,0xe7,0x02,0x15,0x0e,0x5e,0x08,
-0x01,0x42,0x16,0x16,0x04,0x9d,0x2c,0x01,0x83,0x01,0x06,0x52,0x11,0x11,0x0a,0x9a,
-0x30,0x06,0x8c,0x08,0x01,0x44,0x03,0x06,0xbc,0x17,0x14,0x04,0xbf,0x01,0x16,0x20,
-0xce,0x1a,0x07,0xf7,0x17,0x01,0x3c,0x02,0x07,0x06,0x01,0x13,0x1f,0x1f,0x00,0x17,
-0xf1,0xc3,0x03,0x0f,0x3e,0x00,0x0c,0x16,0x0d,0x7a,0x29,0x01,0xbf,0x18,0x15,0xbf,
-0x3b,0x1b,0x10,0x07,0x5b,0x04,0x16,0x08,0x80,0x32,0x01,0xee,0x03,0x15,0x4f,0x1e,
-0x21,0x01,0x5e,0x16,0x06,0x6a,0x1b,0x01,0xd0,0x41,0x0c,0xd5,0x04,0x01,0x72,0x00,
-0x14,0xd1,0xc6,0x31,0x12,0x10,0x27,0x01,0x04,0xd7,0x03,0x14,0x80,0x9e,0x09,0x24,
-0xed,0xef,0xe0,0x06,0x00,0x0b,0x1f,0x08,0x44,0x0c,0x06,0x10,0x00,0x17,0xd2,0x11,
-0x2d,0x07,0x8f,0x41,0x18,0x4c,0x87,0x28,0x00,0x31,0x00,0x44,0x7b,0xdf,0xfe,0xdf,
-0x9d,0x05,0x26,0x00,0x00,0xb2,0x05,0x1a,0x60,0x07,0x1e,0x08,0xc2,0x12,0x16,0x08,
-0x75,0x22,0x04,0xb1,0x2a,0x19,0xc1,0x3c,0x22,0x2a,0xdf,0xa0,0x6b,0x1e,0x15,0x70,
-0x29,0x03,0x39,0xed,0xa7,0x20,0x37,0x04,0x19,0xc4,0x37,0x04,0x19,0xfa,0xdb,0x1c,
-0x19,0xfc,0x05,0x17,0x13,0xfa,0x9a,0x18,0x25,0xbb,0xce,0xee,0x1a,0x14,0xf1,0x5f,
-0x44,0x15,0xa0,0xd2,0x01,0x18,0xcf,0xd0,0x01,0x19,0x02,0x52,0x04,0x18,0x0d,0xdd,
-0x17,0x00,0xb6,0x01,0x15,0xf5,0x1b,0x00,0x19,0x0b,0x1b,0x00,0x1c,0xef,0x88,0x04,
-0x18,0x00,0x79,0x0e,0x04,0x6c,0x00,0x2a,0x03,0x8f,0x75,0x1b,0x00,0x63,0x01,0x19,
-0x0f,0x4a,0x19,0x09,0x78,0x14,0x0e,0xf3,0x00,0x05,0x96,0x08,0x02,0xd8,0x00,0x13,
-0xbc,0x65,0x00,0x02,0x07,0x00,0x12,0x0e,0x24,0x09,0x03,0x6c,0x00,0x12,0x6f,0x92,
-0x02,0x03,0x22,0x00,0x15,0xdf,0x29,0x01,0x12,0x10,0xd7,0x04,0x05,0xe3,0x0e,0x01,
-0xe4,0x00,0x15,0xb0,0xe6,0x03,0x19,0x4f,0xbc,0x0d,0x01,0x5f,0x24,0x04,0x1b,0x00,
-0x14,0x04,0xd9,0x04,0x05,0xc9,0x0d,0x15,0xc0,0xf3,0x00,0x18,0x3f,0x6c,0x0f,0x28,
-0x00,0xbf,0x7b,0x05,0x14,0x03,0x4d,0x29,0x35,0x16,0xac,0xef,0x00,0x08,0x03,0xc9,
-0x13,0x02,0x71,0x23,0x05,0x2e,0x25,0x13,0xb1,0xb8,0x07,0x05,0x01,0x2b,0x18,0x0c,
-0x15,0x19,0x11,0x06,0x32,0x00,0x22,0xaa,0xcf,0x5a,0x02,0x02,0x10,0x1b,0x02,0xf2,
-0x2a,0x23,0x00,0x2f,0x1e,0x0f,0x01,0xa3,0x2e,0x01,0xcf,0x03,0x05,0x21,0x07,0x05,
-0x01,0x2d,0x00,0x5e,0x31,0x14,0x03,0x9d,0x20,0x69,0x01,0x55,0x55,0x55,0x40,0x0f,
-0x36,0x20,0x15,0x9f,0xbf,0x45,0x04,0xb6,0x20,0x29,0xfc,0x61,0x62,0x20,0x29,0xfc,
-0x61,0x70,0x20,0x29,0xfb,0x40,0x47,0x16,0x14,0xd4,0xb2,0x28,0x08,0xfd,0x04,0x28,
-0x03,0xaf,0xfd,0x45,0x02,0xcd,0x26,0x05,0xc3,0x34,0x00,0xf2,0x23,0x08,0x3d,0x21,
-0x19,0x3d,0x6a,0x1c,0x00,0x08,0x01,0x15,0x75,0x18,0x04,0x00,0x5f,0x30,0x05,0xf9,
-0x1c,0x10,0x04,0xac,0x2b,0x05,0x2d,0x00,0x00,0xd8,0x00,0x14,0x0c,0x30,0x1d,0x10,
-0x0c,0x6e,0x02,0x13,0x6f,0x8f,0x00,0x11,0x2b,0x52,0x0b,0x10,0xcf,0xaa,0x03,0x21,
-0xba,0x9a,0x05,0x04,0x08,0xfc,0x03,0x28,0xff,0x60,0x0e,0x00,0x17,0x90,0xd1,0x07,
-0x02,0x27,0x05,0x13,0x3a,0x44,0x03,0x03,0x1f,0x48,0x30,0x59,0xce,0xff,0xb0,0x41,
-0x05,0xab,0x0b,0x04,0xb3,0x01,0x09,0x0e,0x00,0x1f,0xfb,0x1d,0x00,0x18,0x11,0xb0,
-0x93,0x0e,0x12,0xef,0x43,0x07,0x2d,0xbb,0xb8,0x95,0x37,0x03,0x0a,0x1f,0x0a,0xf7,
-0x16,0x0f,0x1d,0x00,0xff,0x5e,0x05,0xb7,0x1e,0x10,0x02,0xbc,0x08,0x05,0xd1,0x21,
-0x00,0xe3,0x0c,0x0f,0x1b,0x00,0xff,0x05,0x10,0x03,0x48,0x07,0x05,0xe5,0x10,0x13,
-0x4f,0xf8,0x3b,0x14,0x10,0xec,0x07,0x12,0xa0,0xb2,0x30,0x02,0x93,0x05,0x15,0xf6,
-0xca,0x07,0x14,0x8f,0x2b,0x2a,0x13,0xf6,0xc5,0x28,0x12,0xb0,0xc6,0x0d,0x02,0x27,
-0x19,0x16,0xf3,0x5c,0x2a,0x01,0xff,0x05,0x06,0xb8,0x03,0x18,0xf9,0xb0,0x07,0x18,
-0xf7,0xe5,0x1a,0x13,0xa2,0x43,0x0c,0x63,0x7b,0xde,0xff,0xec,0x95,0x10,0x16,0x0e,
-0x16,0x10,0xee,0x01,0x26,0xf1,0x4f,0xb1,0x07,0x10,0x1f,0x71,0x00,0x16,0x0e,0x85,
-0x08,0x10,0x5f,0x4f,0x05,0x16,0x09,0x4f,0x09,0x10,0xaf,0x3b,0x04,0x16,0x04,0x13,
-0x4b,0x02,0x77,0x07,0x02,0x7d,0x08,0x05,0x19,0x06,0x00,0x41,0x05,0x15,0xfe,0xec,
-0x07,0x12,0xe0,0x14,0x06,0x14,0x30,0x46,0x07,0x12,0x90,0x07,0x00,0x15,0x70,0x2e,
-0x24,0x16,0x00,0x51,0x24,0x12,0x7f,0x39,0x00,0x17,0x02,0x76,0x06,0x14,0xf8,0x22,
-0x01,0x04,0x16,0x21,0x07,0x64,0x35,0x05,0x39,0x1b,0x01,0x6a,0x09,0x07,0x2c,0x1b,
-0x03,0xc5,0x02,0x14,0x0e,0x8c,0x09,0x12,0x07,0x78,0x00,0x05,0x9b,0x01,0x12,0x01,
-0x98,0x00,0x15,0x8f,0x7d,0x09,0x00,0x74,0x2b,0x06,0x74,0x25,0x03,0x96,0x25,0x16,
-0x02,0xb7,0x24,0x01,0x05,0x32,0x16,0x07,0x28,0x01,0x01,0x80,0x4f,0x16,0x0b,0x48,
-0x01,0x13,0x05,0x47,0x3f,0x05,0xcf,0x26,0x08,0x4b,0x3f,0x04,0xa7,0x3e,0x04,0xcb,
-0x3e,0x04,0x46,0x34,0x17,0xef,0x00,0x34,0x12,0x0e,0x29,0x0f,0x19,0x40,0xf5,0x48,
-0x07,0xba,0x26,0x1b,0x04,0x17,0x4b,0x02,0xfe,0x12,0x18,0xf4,0x50,0x28,0x0a,0x6f,
-0x27,0x1a,0x3f,0x0a,0x27,0x02,0x60,0x0b,0x1a,0x30,0x87,0x09,0x18,0xfd,0x77,0x09,
-0x06,0x6b,0x13,0x14,0x1f,0x79,0x00,0x03,0x3f,0x01,0x00,0x6c,0x00,0x27,0xf1,0x0d,
-0xfc,0x07,0x14,0x50,0x43,0x01,0x13,0x09,0xb3,0x00,0x13,0x08,0x6c,0x00,0x10,0x04,
-0xf7,0x00,0x13,0x06,0xde,0x01,0x13,0x0b,0x9e,0x01,0x13,0x07,0x20,0x4b,0x04,0xf6,
-0x46,0x05,0x29,0x16,0x01,0x5e,0x08,0x13,0xe0,0xac,0x00,0x13,0xf4,0xa4,0x00,0x05,
-0xa8,0x3d,0x16,0x7f,0xe1,0x08,0x12,0xfc,0x5a,0x33,0x03,0x80,0x02,0x15,0xfb,0x4e,
-0x38,0x03,0x60,0x38,0x01,0x0b,0x01,0x05,0x79,0x39,0x02,0x01,0x40,0x14,0x02,0x9f,
-0x0e,0x14,0x9f,0x26,0x11,0x05,0x26,0x23,0x12,0x60,0xa0,0x32,0x04,0x17,0x32,0x11,
-0x09,0xa8,0x1f,0x12,0xa0,0xb3,0x01,0x02,0x59,0x0b,0x10,0x30,0x30,0x00,0x10,0xba,
-0x24,0x00,0x16,0x02,0xf6,0x36,0x01,0xae,0x39,0x21,0x76,0xff,0xb0,0x4f,0x02,0x4a,
-0x01,0x00,0xf5,0x00,0x00,0x84,0x00,0x10,0x32,0x78,0x00,0x00,0x03,0x01,0x03,0x4a,
-0x02,0x11,0xc0,0xf2,0x30,0x30,0xef,0xff,0xf9,0x03,0x01,0x04,0x0e,0x46,0x51,0xf0,
-0x00,0xcf,0xff,0xfb,0x73,0x47,0x00,0xf2,0x37,0x03,0x03,0x02,0x10,0xf2,0xdb,0x47,
-0x00,0xea,0x00,0x05,0xac,0x36,0x00,0x08,0x00,0x00,0x27,0x31,0x00,0xe2,0x00,0x22,
-0x40,0x4f,0x90,0x02,0x00,0x8e,0x00,0x50,0xf8,0x07,0xff,0xff,0xf0,0x0c,0x01,0x25,
-0x70,0x7f,0xd5,0x4b,0x30,0xff,0xfc,0x0b,0x6d,0x00,0x12,0x0b,0xdd,0x3d,0x14,0xa0,
-0x17,0x0c,0x10,0x0e,0x05,0x03,0x12,0x07,0x3f,0x10,0x14,0x70,0xdb,0x01,0x00,0xd6,
-0x48,0x00,0x92,0x04,0x15,0xf3,0x06,0x02,0x02,0x27,0x15,0x01,0x09,0x00,0x15,0xf9,
-0x66,0x0c,0x14,0xbf,0xcd,0x15,0x17,0xbf,0xd6,0x15,0x14,0x8f,0x6c,0x0a,0x17,0x7f,
-0x90,0x15,0x14,0x4f,0x80,0x02,0x17,0x4f,0x36,0x3c,0x17,0x1f,0xdf,0x13,0x05,0x4c,
-0x03,0x14,0x0d,0x05,0x38,0x17,0x0c,0xa3,0x02,0x14,0x09,0x9f,0x02,0x16,0x08,0xb1,
-0x3d,0x02,0xd8,0x09,0x14,0x50,0xee,0x02,0x17,0x60,0x41,0x16,0x01,0x67,0x03,0x08,
-0xc2,0x02,0x00,0x3c,0x3f,0x05,0xff,0x3d,0x07,0x1d,0x1f,0x19,0xf9,0x69,0x12,0x15,
-0x0e,0x1c,0x09,0x22,0x09,0xff,0xba,0x44,0x03,0x09,0x0e,0x14,0x2f,0x71,0x15,0x24,
-0xff,0x30,0xf7,0x00,0x11,0x40,0x15,0x00,0x16,0xc0,0xd5,0x3f,0x13,0x09,0xe1,0x00,
-0x12,0x0c,0x45,0x00,0x13,0x01,0x73,0x00,0x13,0x5f,0x65,0x04,0x12,0x6f,0xac,0x00,
-0x13,0xdf,0x2d,0x03,0x11,0x0c,0xdc,0x00,0x14,0x06,0x0c,0x01,0x02,0xbc,0x25,0x06,
-0x4a,0x05,0x10,0x9f,0xbb,0x10,0x15,0x7f,0x1c,0x0e,0x10,0x1f,0x49,0x50,0x06,0x4d,
-0x01,0x10,0x07,0x72,0x00,0x07,0xc0,0x03,0x1a,0xdf,0x88,0x2b,0x1a,0x4f,0x64,0x17,
-0x1a,0x0a,0xf7,0x2a,0x1b,0x01,0xf5,0x2a,0x15,0x8f,0x31,0x01,0x06,0xf0,0x3d,0x1a,
-0x30,0x48,0x04,0x19,0xc0,0x16,0x04,0x0c,0xd0,0x17,0x19,0xfe,0x59,0x00,0x05,0x5b,
-0x00,0x01,0xdc,0x19,0x06,0x9a,0x0a,0x01,0xb0,0x35,0x06,0xdb,0x40,0x01,0x08,0x01,
-0x14,0x6f,0x9c,0x1a,0x02,0xbf,0x41,0x14,0x0d,0xd3,0x00,0x11,0x1e,0x6f,0x01,0x05,
-0x39,0x41,0x12,0x9f,0x37,0x04,0x12,0xcf,0x0f,0x01,0x16,0x03,0xd4,0x03,0x03,0x49,
-0x17,0x23,0xff,0xf3,0x6f,0x00,0x12,0xf5,0x67,0x01,0x03,0xc4,0x4a,0x04,0xba,0x43,
-0x14,0x10,0xe6,0x00,0x25,0x80,0x09,0x43,0x01,0x10,0x1e,0x99,0x00,0x04,0xb7,0x1a,
-0x02,0x51,0x01,0x10,0xfb,0xd6,0x01,0x07,0xbf,0x41,0x19,0x2f,0x27,0x40,0x25,0xd0,
-0x0a,0x2d,0x00,0x01,0xb3,0x0c,0x15,0x02,0xc6,0x02,0x14,0xbf,0x94,0x28,0x14,0xfc,
-0x7f,0x02,0x12,0xf4,0x31,0x02,0x13,0x40,0x48,0x02,0x16,0xc0,0x28,0x42,0x12,0x1f,
-0x5c,0x01,0x13,0x01,0x17,0x01,0x03,0xd0,0x36,0x04,0x71,0x10,0x04,0xcf,0x13,0x02,
-0xf8,0x07,0x14,0x07,0x0d,0x02,0x15,0x08,0xb4,0x10,0x15,0x20,0x37,0x10,0x07,0x91,
-0x40,0x10,0x7f,0x3a,0x02,0x14,0xdf,0x68,0x01,0x00,0x28,0x00,0x11,0xfe,0x58,0x05,
-0x06,0x2b,0x02,0x17,0x5b,0x60,0x2b,0x11,0xef,0x35,0x11,0x18,0xf9,0x54,0x2d,0x0a,
-0xd2,0x3a,0x08,0x7e,0x0f,0x2a,0x06,0xff,0x1c,0x02,0x19,0xdf,0x97,0x4e,0x01,0xdb,
-0x02,0x1a,0xf1,0x33,0x06,0x1d,0x80,0x6d,0x22,0x0f,0x0f,0x00,0x95,0x18,0x4f,0x63,
-0x0c,0x19,0x54,0xf4,0x2c,0x0f,0x1b,0x00,0x14,0x33,0xfe,0x13,0xbb,0x01,0x00,0x18,
-0xdf,0xba,0x2e,0x18,0x0e,0xb8,0x3b,0x18,0x0a,0x76,0x07,0x18,0x05,0x93,0x07,0x01,
-0x98,0x3a,0x08,0xb8,0x23,0x19,0xfd,0x00,0x50,0x18,0x30,0xc3,0x41,0x06,0x73,0x4d,
-0x08,0x9d,0x03,0x05,0x14,0x0a,0x04,0xc3,0x02,0x18,0xf6,0xfe,0x07,0x18,0xfb,0xe2,
-0x03,0x28,0xfe,0x10,0xc4,0x01,0x18,0x40,0x3d,0x53,0x18,0x90,0x89,0x11,0x18,0xd0,
-0x0c,0x33,0x1e,0xf3,0xfc,0x07,0x03,0x15,0x02,0x19,0xfd,0x4d,0x04,0x18,0x20,0x42,
-0x43,0x18,0x70,0x07,0x01,0x18,0xc0,0x07,0x01,0x18,0xf1,0x07,0x01,0x14,0xfe,0x3b,
-0x01,0x28,0x71,0xef,0xf9,0x0d,0x09,0x7a,0x01,0x2f,0xb4,0xff,0x1b,0x00,0x14,0x11,
-0x3f,0xf0,0x04,0x01,0x0c,0x00,0x0f,0x0b,0x00,0x01,0x21,0xb4,0x43,0x70,0x2f,0x02,
-0x0e,0x46,0x0f,0x0b,0x00,0xab,0x3f,0xfb,0x44,0x33,0xe7,0x00,0x06,0x01,0x92,0x43,
-0x1e,0xf1,0xff,0x3d,0x16,0x1f,0xb0,0x01,0x16,0x0a,0xfd,0x01,0x07,0x33,0x04,0x08,
-0xe0,0x44,0x16,0x8f,0x46,0x02,0x16,0x2f,0x53,0x06,0x16,0x0c,0xe6,0x01,0x17,0x06,
-0xf5,0x03,0x07,0xdc,0x02,0x07,0xe3,0x41,0x16,0x4f,0xa0,0x26,0x07,0x79,0x3e,0x07,
-0x1d,0x0b,0x17,0x01,0x1a,0x02,0x04,0xee,0x3b,0x0a,0x20,0x32,0x16,0x0f,0x65,0x06,
-0x16,0x09,0x5b,0x03,0x17,0x03,0x7d,0x47,0x16,0xdf,0xeb,0x00,0x1e,0x7f,0xeb,0x00,
-0x03,0xce,0x02,0x1e,0x30,0xf3,0x3e,0x07,0xeb,0x00,0x16,0x9f,0x7f,0x0b,0x0f,0xeb,
-0x00,0x0e,0x1f,0x01,0xeb,0x00,0x0e,0x16,0x0e,0xeb,0x00,0x1a,0x08,0x9d,0x08,0x04,
-0xeb,0x00,0x41,0x68,0x88,0x88,0x70,0x37,0x09,0x11,0x7b,0x83,0x0d,0x0c,0x0b,0x00,
-0x21,0x72,0x44,0x6f,0x0c,0x14,0x05,0x42,0x47,0x0f,0x0b,0x00,0xa9,0x2e,0x24,0x48,
-0xe7,0x00,0x09,0x0b,0x00,0x02,0x74,0x01,0x14,0x20,0xe2,0x01,0x16,0xf9,0x30,0x28,
-0x05,0xa6,0x06,0x05,0xe3,0x47,0x15,0xfd,0x76,0x29,0x03,0xd1,0x4b,0x15,0xfc,0x2f,
-0x53,0x01,0x3a,0x35,0x00,0x5b,0x02,0x12,0xa0,0x39,0x3b,0x41,0xdf,0xff,0xf4,0x04,
-0xc5,0x04,0x32,0x4f,0xff,0xfd,0x86,0x36,0x21,0x0b,0xff,0xbc,0x56,0x30,0xfb,0x00,
-0x01,0x2c,0x05,0x10,0x01,0x36,0x02,0x10,0x8f,0x1b,0x05,0x00,0x18,0x00,0x02,0x90,
-0x50,0x42,0x5f,0xff,0xfe,0x05,0x78,0x00,0x62,0xef,0xff,0xf5,0xcf,0xff,0xf9,0x92,
-0x00,0x25,0xc0,0x55,0x01,0x00,0x26,0x51,0xff,0xa3,0x47,0x0f,0x0b,0x00,0x19,0x42,
-0x35,0x55,0x55,0x53,0x82,0x0f,0x00,0xe5,0x54,0x02,0x09,0x02,0x15,0x04,0x57,0x29,
-0x21,0xfe,0x10,0x29,0x02,0x16,0xfa,0x70,0x53,0x12,0x0b,0x63,0x02,0x00,0x70,0x2f,
-0x27,0xc8,0x30,0x0a,0x21,0x23,0xfc,0x30,0x16,0x2e,0x04,0x8b,0x09,0x17,0x2f,0xe7,
-0x23,0x16,0xdf,0xa1,0x17,0x10,0x05,0xa6,0x05,0x34,0x21,0x26,0xef,0x57,0x3a,0x13,
-0x50,0xd1,0x0e,0x45,0x0b,0xee,0xee,0xee,0x3d,0x0d,0x07,0x9f,0x0e,0x19,0x00,0x82,
-0x34,0x44,0x00,0x37,0xad,0xef,0xbc,0x1e,0x16,0x5d,0xa4,0x21,0x17,0x0b,0xb0,0x21,
-0x16,0xcf,0x0c,0x00,0x10,0x07,0x6c,0x00,0x12,0x30,0x3c,0x00,0x12,0x0e,0x6a,0x03,
-0x01,0x0c,0x00,0x03,0x27,0x56,0x01,0x0c,0x00,0x03,0xc0,0x49,0x01,0x0c,0x00,0x03,
-0x8f,0x04,0x01,0x5d,0x03,0x03,0x9e,0x14,0x13,0xaf,0x3d,0x41,0x41,0xff,0xd6,0x44,
-0x8e,0x54,0x00,0x17,0x0b,0x72,0x5a,0x18,0x02,0xbb,0x21,0x15,0x4f,0x2d,0x2d,0x13,
-0x60,0x42,0x32,0x11,0x73,0xd2,0x03,0x00,0xd0,0x40,0x21,0xeb,0x71,0xf6,0x42,0x08,
-0x56,0x46,0x0f,0x0c,0x00,0x5e,0x43,0x6b,0xef,0xec,0x83,0x0c,0x00,0x11,0x4e,0x67,
-0x40,0x01,0x0c,0x00,0x23,0xfb,0xff,0xc3,0x15,0x17,0x6f,0xcf,0x22,0x17,0x6f,0x9d,
-0x11,0x01,0x0c,0x00,0x21,0xb9,0x9d,0x72,0x09,0x12,0x6f,0x37,0x00,0x22,0x5f,0xff,
-0x31,0x49,0x14,0xfc,0xc4,0x1d,0x04,0x6c,0x00,0x00,0xb7,0x04,0x04,0x0c,0x00,0x12,
-0xaf,0xc2,0x5b,0x04,0xb2,0x55,0x14,0xf5,0x0c,0x00,0x1a,0x5f,0x0c,0x00,0x1f,0xf6,
-0x0c,0x00,0x0d,0x08,0x3c,0x00,0x17,0x9f,0x54,0x00,0x03,0x6c,0x00,0x08,0x84,0x00,
-0x23,0xff,0xa0,0xdd,0x07,0x15,0x6f,0xa1,0x43,0x2d,0xff,0x10,0xcc,0x00,0x06,0xe4,
-0x00,0x13,0xf8,0xb8,0x1b,0x00,0x0c,0x00,0x26,0xd0,0x6f,0x14,0x01,0x66,0xc0,0x01,
-0x7c,0xef,0xed,0x93,0x1c,0x1a,0x03,0x72,0x47,0x16,0x2a,0x10,0x1e,0x16,0x4f,0xae,
-0x12,0x16,0x5f,0xc7,0x12,0x16,0x2f,0x2f,0x1d,0x11,0x0c,0x5c,0x4c,0x10,0xbf,0x6a,
-0x00,0x12,0x03,0x4f,0x09,0x10,0x3e,0x80,0x02,0x03,0x99,0x44,0x00,0x8b,0x37,0x00,
-0x11,0x0b,0x03,0xfa,0x0d,0x13,0xa2,0xe5,0x06,0x47,0x08,0xdd,0xdd,0xd9,0x6d,0x48,
-0x17,0x05,0x14,0x0a,0x07,0x9b,0x49,0x17,0x06,0xc6,0x09,0x1a,0x5f,0xd0,0x4d,0x1b,
-0x70,0x1e,0x42,0x55,0x13,0x33,0x33,0x20,0xef,0x93,0x57,0x13,0xfb,0x6f,0x03,0x14,
-0x01,0x68,0x1f,0x11,0x40,0xed,0x17,0x11,0xf5,0x32,0x03,0x21,0xc8,0x8b,0x9a,0x0c,
-0x17,0x02,0xc9,0x4e,0x17,0x05,0x4c,0x17,0x17,0x05,0x45,0x0d,0x26,0x02,0xaf,0x2e,
-0x42,0x00,0x3b,0x1d,0x13,0xec,0xad,0x43,0x0f,0xd7,0x02,0x63,0x00,0x68,0x5b,0x23,
-0xfe,0xb6,0x0c,0x00,0x11,0x09,0x93,0x1e,0x02,0x0c,0x00,0x14,0xcf,0x44,0x25,0x19,
-0xf6,0xbe,0x4c,0x17,0x6f,0x0c,0x00,0x10,0xff,0xf5,0x47,0x24,0x9b,0xff,0xc8,0x29,
-0x12,0xf7,0xed,0x1d,0x23,0xf6,0x0c,0xe9,0x00,0x00,0x6c,0x2e,0x04,0xf7,0x19,0x00,
-0x54,0x00,0x04,0xde,0x38,0x17,0x6f,0xed,0x49,0x17,0x6f,0xab,0x02,0x03,0x0c,0x00,
-0x1f,0xf5,0x0c,0x00,0x01,0x17,0x5f,0x24,0x00,0x04,0xe4,0x01,0x0c,0x54,0x00,0x01,
-0x7b,0x2e,0x03,0x0c,0x00,0x13,0x0b,0xd6,0x07,0x00,0x84,0x00,0x12,0x05,0x52,0x05,
-0x11,0x1a,0x07,0x00,0x10,0xef,0xb4,0x00,0x1e,0x8a,0xcc,0x00,0x06,0x98,0x04,0x05,
-0xfc,0x00,0x00,0x95,0x4a,0x03,0x9f,0x05,0x25,0xe5,0x0e,0x2c,0x01,0x33,0xc7,0x10,
-0x0c,0x8c,0x00,0x43,0x5a,0xde,0xfe,0xda,0x04,0x1a,0x16,0x7e,0x28,0x19,0x16,0x1c,
-0x1d,0x1d,0x05,0xa6,0x15,0x17,0xd0,0xbb,0x1a,0x12,0xfa,0xfa,0x0b,0x34,0xea,0x89,
-0xdf,0xcc,0x1d,0x13,0xf8,0x52,0x22,0x13,0x06,0xc8,0x02,0x00,0x28,0x12,0x13,0x0b,
-0xb0,0x05,0x00,0xf8,0x55,0x07,0x5d,0x51,0x10,0xf7,0x5c,0x16,0x52,0xaa,0xaa,0xaa,
-0xaa,0xaf,0xff,0x23,0x05,0x55,0x00,0x1e,0x4f,0x44,0x0b,0x06,0x35,0x0b,0x03,0x0c,
-0x00,0x17,0x2f,0x53,0x30,0x07,0x7c,0x09,0x06,0x2e,0x0d,0x12,0x01,0xc1,0x09,0x02,
-0xd9,0x59,0x03,0x3c,0x23,0x10,0x50,0x54,0x1b,0x01,0xb6,0x26,0x00,0x97,0x51,0x11,
-0x9b,0x2b,0x00,0x17,0x0b,0x8c,0x45,0x06,0x8a,0x16,0x16,0x40,0xba,0x1b,0x16,0xe3,
-0x27,0x1e,0x03,0x52,0x0c,0x54,0x37,0xbd,0xff,0xfd,0xa5,0x71,0x00,0x44,0x25,0x78,
-0x76,0x30,0x9b,0x16,0x14,0xf3,0x23,0x20,0x14,0xf2,0x7f,0x24,0x14,0xf2,0xa4,0x3f,
-0x14,0xf2,0xba,0x0e,0x12,0xf2,0x9e,0x0f,0x22,0xa3,0x10,0xc8,0x1c,0x05,0x40,0x4a,
-0x24,0xf5,0x00,0x6f,0x47,0x08,0x09,0x00,0x14,0x5f,0x90,0x00,0x0f,0x09,0x00,0x11,
-0x0e,0x3f,0x00,0x0f,0x09,0x00,0x9a,0x61,0x00,0x16,0xbd,0xff,0xda,0x50,0x93,0x65,
-0x02,0xfb,0x1c,0x21,0xfd,0x38,0x0c,0x00,0x14,0x9f,0xd7,0x25,0x19,0xfc,0xcf,0x4d,
-0x17,0x3f,0x0c,0x00,0x10,0xdf,0x13,0x02,0x01,0x07,0x1c,0x22,0xfc,0x03,0xa2,0x1c,
-0x10,0x05,0xc8,0x11,0x04,0x6b,0x39,0x13,0x4f,0xb5,0x2d,0x13,0x30,0x7d,0x15,0x04,
-0x75,0x0b,0x03,0x1e,0x4c,0x14,0xfa,0x0c,0x00,0x04,0x8d,0x03,0x00,0x0c,0x00,0x04,
-0xa5,0x03,0x0c,0x0c,0x00,0x08,0x24,0x00,0x04,0x15,0x3d,0x03,0x54,0x00,0x05,0x36,
-0x54,0x03,0xa6,0x55,0x01,0x0c,0x00,0x04,0x58,0x11,0x13,0x3f,0x9c,0x00,0x12,0xfa,
-0xc7,0x49,0x02,0xee,0x60,0x02,0x39,0x03,0x0a,0xcc,0x00,0x18,0x07,0xf1,0x1f,0x14,
-0x8f,0x26,0x0d,0x13,0xfc,0x98,0x23,0x23,0xfa,0x0f,0xe8,0x06,0x48,0xbd,0xff,0xd9,
-0x30,0x57,0x4b,0x02,0x3d,0x04,0x13,0x02,0x60,0x0c,0x00,0xab,0x02,0x23,0x7e,0x20,
-0xb4,0x0f,0x00,0x31,0x66,0x13,0xf6,0xce,0x03,0x10,0xe0,0x22,0x03,0x32,0xe8,0x65,
-0x6a,0xe3,0x03,0x17,0x7f,0x78,0x3d,0x17,0x6f,0x88,0x26,0x27,0x05,0xef,0x16,0x21,
-0x16,0x19,0x11,0x4b,0x01,0xc1,0x08,0x02,0x29,0x4b,0x16,0x9f,0x07,0x0d,0x17,0x09,
-0xfd,0x0f,0x0f,0x17,0x00,0x4e,0x42,0x49,0xdf,0xfe,0xb6,0x17,0x00,0x22,0x31,0xbf,
-0xa8,0x21,0x00,0x16,0x0d,0x12,0xef,0x02,0x03,0x17,0x09,0x52,0x2b,0x16,0x9f,0x05,
-0x05,0x01,0x17,0x00,0x34,0xea,0x9a,0xdf,0x62,0x4e,0x12,0x70,0x59,0x01,0x13,0x09,
-0xe7,0x04,0x12,0xdf,0x6c,0x51,0x13,0xf3,0xc0,0x0a,0x13,0x49,0x73,0x00,0x00,0x6e,
-0x08,0x03,0x17,0x00,0x00,0xce,0x04,0x13,0x59,0x17,0x00,0x1f,0x6f,0x17,0x00,0x91,
-0x41,0x00,0x9d,0xfd,0x60,0x2d,0x49,0x00,0x40,0x05,0x01,0xf7,0x55,0x00,0xb9,0x21,
-0x00,0xea,0x00,0x4b,0x80,0x01,0x9e,0xfe,0xa0,0x48,0x01,0x47,0x02,0x03,0xf3,0x20,
-0x0f,0x09,0x00,0x56,0x00,0x59,0x02,0x23,0xef,0xc5,0xbe,0x09,0x14,0x60,0xff,0x23,
-0x01,0x81,0x01,0x15,0xf0,0x0e,0x00,0x11,0x01,0x1c,0x00,0x00,0xef,0x06,0x1f,0xd6,
-0x9a,0x45,0x06,0x03,0x4d,0x00,0x0f,0x07,0x00,0xa9,0x03,0x4b,0x1a,0x01,0xd4,0x1b,
-0x33,0x13,0x12,0x7f,0x2b,0x2b,0x00,0x6e,0x08,0x12,0x3f,0x66,0x07,0x12,0x3f,0x30,
-0x0d,0x12,0x3f,0xf1,0x02,0x12,0x3f,0x80,0x67,0x4b,0x03,0x67,0x76,0x30,0x06,0x09,
-0x18,0x06,0x3b,0x14,0x0f,0x19,0x00,0x58,0x10,0x3f,0x18,0x08,0x03,0x19,0x00,0x11,
-0x2e,0x43,0x04,0x02,0x19,0x00,0x11,0x0d,0x15,0x07,0x15,0x06,0x69,0x07,0x13,0xf5,
-0x32,0x00,0x25,0x08,0xff,0x2a,0x08,0x23,0x60,0x06,0xc3,0x18,0x00,0x19,0x00,0x17,
-0x03,0x0e,0x69,0x11,0x62,0x56,0x3c,0x03,0x19,0x00,0x03,0x59,0x17,0x01,0x19,0x00,
-0x05,0x74,0x32,0x17,0x6f,0xd2,0x21,0x18,0x06,0xd7,0x25,0x17,0x6f,0xda,0x29,0x18,
-0x06,0x99,0x2f,0x16,0x6f,0x1c,0x4f,0x02,0x19,0x00,0x16,0xef,0x34,0x03,0x44,0xff,
-0xd1,0xaf,0xff,0x58,0x63,0x24,0xff,0xd1,0xec,0x14,0x01,0xaf,0x00,0x12,0x06,0x4d,
-0x00,0x06,0xc8,0x00,0x14,0xd0,0xfa,0x00,0x02,0xeb,0x14,0x03,0xfa,0x00,0x02,0x0d,
-0x19,0x03,0x13,0x01,0x00,0xa9,0x65,0x04,0x19,0x00,0x02,0x3b,0x19,0x03,0x19,0x00,
-0x10,0x09,0x8e,0x03,0x04,0x45,0x01,0x14,0x1e,0x14,0x03,0x0f,0x04,0x00,0x79,0x10,
-0x6f,0x83,0x03,0x53,0x49,0xde,0xfe,0xc7,0x10,0x94,0x07,0x01,0xc8,0x00,0x22,0x02,
-0xbf,0x0b,0x0c,0x21,0x7f,0xff,0x4f,0x4f,0x15,0x6f,0x76,0x05,0x22,0x50,0xaf,0xd3,
-0x24,0x16,0x06,0x7d,0x05,0x03,0x6e,0x23,0x01,0xae,0x23,0x0a,0x01,0x00,0x11,0x16,
-0xd1,0x02,0x21,0x9a,0xef,0x27,0x00,0x32,0xa9,0xae,0xff,0x1b,0x0b,0x00,0x63,0x0b,
-0x16,0x9f,0xfd,0x54,0x16,0xa6,0x7f,0x34,0x12,0xfa,0xdb,0x06,0x13,0xfd,0x3d,0x01,
-0x04,0x4b,0x0a,0x00,0xa7,0x3a,0x03,0x43,0x01,0x03,0x0f,0x54,0x12,0x0d,0x16,0x66,
-0x05,0xc0,0x0f,0x03,0x64,0x1f,0x0f,0x25,0x00,0xff,0x03,0x10,0x8f,0xc2,0x02,0x02,
-0xe1,0x01,0x00,0x8a,0x03,0x02,0xe7,0x25,0x11,0x60,0x8a,0x09,0x03,0xa7,0x1b,0x07,
-0xd2,0x32,0x26,0x10,0x8f,0x36,0x0f,0x11,0x08,0x49,0x07,0x32,0x99,0xdf,0xff,0x4b,
-0x5f,0x22,0xff,0x90,0xf5,0x02,0x16,0x08,0x25,0x0d,0x26,0xf3,0x8f,0x49,0x07,0x17,
-0x48,0x91,0x06,0x16,0x8f,0xa8,0x06,0x1f,0x58,0x17,0x00,0x99,0x03,0x01,0x5e,0x28,
-0xda,0x61,0xea,0x33,0x22,0xf9,0x10,0x9a,0x67,0x06,0xc7,0x2f,0x17,0x3f,0x39,0x0c,
-0x17,0x1e,0x06,0x2c,0x11,0x0a,0x0b,0x53,0x11,0xae,0x10,0x1c,0x12,0x02,0xa0,0x04,
-0x11,0x08,0x04,0x10,0x12,0x9f,0xdb,0x02,0x01,0x97,0x53,0x04,0x89,0x15,0x00,0xf4,
-0x0d,0x05,0x7f,0x15,0x00,0x34,0x11,0x03,0xd2,0x68,0x01,0x95,0x00,0x14,0x66,0x77,
-0x05,0x00,0x15,0x00,0x17,0x7f,0x94,0x1d,0x14,0x86,0x04,0x10,0x00,0x42,0x20,0x04,
-0xaa,0x0a,0x00,0x02,0x10,0x14,0x74,0x0d,0x16,0x00,0x14,0x02,0x04,0xca,0x21,0x01,
-0xa6,0x20,0x16,0xdf,0x6e,0x66,0x26,0xf0,0x09,0xa9,0x0d,0x13,0xfb,0x7c,0x2c,0x03,
-0xf3,0x3c,0x00,0xc5,0x03,0x21,0xe9,0x89,0x35,0x09,0x07,0x30,0x2f,0x17,0xf2,0x50,
-0x3e,0x17,0xf4,0x62,0x2b,0x24,0xe3,0x00,0xa0,0x45,0x04,0x1d,0x6e,0x00,0xc2,0x3c,
-0x23,0xed,0xb6,0xc2,0x05,0x35,0xe0,0x01,0x7c,0x74,0x12,0x26,0xf0,0x7f,0x60,0x11,
-0x1e,0xfa,0x74,0x12,0x17,0xc0,0x0c,0x00,0x12,0xf7,0x0c,0x00,0x25,0xa9,0xae,0xc0,
-0x11,0x03,0x73,0x02,0x26,0x60,0x6f,0x41,0x01,0x26,0xc0,0x6f,0x4d,0x23,0x05,0x74,
-0x12,0x12,0xbf,0xd6,0x5b,0x14,0xf6,0x63,0x0c,0x07,0x99,0x0f,0x0e,0x74,0x12,0x0e,
-0xbd,0x0f,0x1e,0xf5,0x3c,0x00,0x02,0x5e,0x53,0x0b,0x6c,0x00,0x14,0xfb,0x65,0x48,
-0x03,0x9c,0x00,0x01,0x30,0x1e,0x11,0x6f,0xf6,0x01,0x24,0x9d,0xff,0x41,0x1e,0x0e,
-0x70,0x10,0x34,0xb0,0x00,0x6f,0x7c,0x33,0x12,0xfc,0x7c,0x00,0x13,0x5e,0x53,0x11,
-0x01,0x60,0x00,0x12,0x7b,0x51,0x6e,0x0f,0x24,0x14,0x65,0x04,0x1d,0x10,0x16,0x0a,
-0x49,0x11,0x11,0xf7,0x29,0x10,0x03,0x21,0x0f,0x1c,0x9e,0x49,0x11,0x16,0x7f,0x0c,
-0x00,0x21,0x01,0xff,0x95,0x10,0x17,0xef,0x49,0x11,0x18,0x09,0x49,0x11,0x1b,0xaf,
-0x49,0x11,0x1f,0x3f,0x49,0x11,0x37,0x1f,0xf8,0x49,0x11,0x15,0x16,0xbf,0x49,0x11,
-0x17,0x09,0x49,0x11,0x1f,0xef,0x49,0x11,0x11,0x16,0xcf,0x14,0x01,0x27,0xe5,0x6f,
-0x49,0x11,0x0f,0xd0,0x15,0x69,0x10,0x6f,0x99,0x40,0x11,0x8d,0xea,0x05,0x52,0x14,
-0xff,0xff,0xfe,0x6f,0x70,0x3b,0x13,0xe6,0x86,0x04,0x03,0xd1,0x00,0x09,0x0f,0x00,
-0x30,0xec,0xbb,0xb6,0x77,0x03,0x13,0x30,0xec,0x5f,0x06,0xd6,0x09,0x03,0x5b,0x00,
-0x0f,0x0f,0x00,0x5e,0x00,0x47,0x01,0x14,0xbe,0x23,0x60,0x24,0x2c,0xff,0x9c,0x64,
-0x16,0x06,0x85,0x11,0x15,0x5f,0xa2,0x33,0x24,0x01,0xef,0x8a,0x44,0x01,0xfc,0x72,
-0x11,0xb2,0x92,0x14,0x22,0xf5,0x0b,0x06,0x12,0x00,0x18,0x04,0x12,0x0d,0x1c,0x04,
-0x03,0x8b,0x0f,0x10,0xfd,0xa6,0x04,0x46,0x22,0x22,0x21,0x0a,0xc9,0x31,0x11,0x03,
-0xc8,0x06,0x17,0x63,0x87,0x39,0x26,0xfa,0x50,0xe2,0x6f,0x01,0xeb,0x0e,0x17,0x4d,
-0xe0,0x5b,0x26,0x4a,0xef,0x30,0x5d,0x36,0x02,0x6a,0xef,0x14,0x1f,0x10,0x05,0x7c,
-0x2e,0x42,0x57,0x77,0x77,0x50,0xcb,0x09,0x22,0xfd,0x9f,0x61,0x15,0x00,0x8b,0x00,
-0x03,0xe0,0x00,0x13,0x0e,0xd7,0x47,0x11,0x81,0x6b,0x6e,0x25,0xf8,0x07,0xd5,0x40,
-0x36,0xf2,0x00,0xaf,0xad,0x2c,0x16,0x09,0x66,0x02,0x03,0x79,0x00,0x11,0xfb,0x6a,
-0x1a,0x23,0x38,0xce,0x22,0x30,0x10,0x00,0x22,0x63,0x03,0x77,0x04,0x1f,0xb0,0x08,
-0x00,0x17,0x16,0xcf,0x2a,0x43,0x0f,0x08,0x00,0x0a,0x0e,0x58,0x00,0x0f,0x08,0x00,
-0x44,0x04,0xf8,0x0c,0x05,0x45,0x32,0x00,0x4d,0x01,0x26,0xba,0xb3,0xc4,0x61,0x04,
-0x7c,0x25,0x14,0x0b,0x84,0x25,0x04,0x03,0x62,0x53,0x04,0xad,0xff,0xec,0x92,0xee,
-0x0e,0x17,0x07,0xee,0x0e,0x07,0xa6,0x0f,0x0f,0x17,0x00,0x87,0x16,0x8f,0x17,0x00,
-0x13,0x58,0xaf,0x07,0x03,0xcc,0x18,0x13,0xf9,0xd5,0x0a,0x12,0x54,0x55,0x02,0x23,
-0x1a,0xff,0x88,0x31,0x37,0xfb,0x99,0xbf,0x5c,0x0b,0x01,0x0d,0x01,0x07,0xe0,0x74,
-0x02,0x9f,0x51,0x03,0xd1,0x62,0x02,0x24,0x03,0x11,0x72,0x58,0x00,0x72,0x01,0x7b,
-0xef,0xfd,0xb6,0x10,0x0f,0x73,0x00,0x14,0xf8,0x43,0x2f,0x04,0x1c,0x66,0x00,0xf1,
-0x5a,0x04,0xe1,0x1e,0x13,0xdf,0xc0,0x39,0x13,0x50,0x7f,0x0e,0x03,0x7a,0x66,0x02,
-0x90,0x03,0x02,0x29,0x18,0x02,0x74,0x1b,0x02,0x33,0x69,0x11,0x0f,0x0b,0x03,0x14,
-0x3f,0x0c,0x50,0x11,0xf6,0xda,0x02,0x11,0xfb,0x1f,0x07,0x03,0x50,0x3f,0x01,0x6e,
-0x02,0x12,0xc0,0x5c,0x03,0x23,0x40,0x01,0xd7,0x03,0x13,0xef,0xac,0x76,0x12,0x10,
-0x7e,0x00,0x35,0xc0,0x09,0xff,0x6a,0x6e,0x23,0xf1,0x0e,0x4a,0x13,0x12,0x0e,0xca,
-0x24,0x04,0x98,0x39,0x14,0xfa,0x1f,0x62,0x00,0xce,0x72,0x16,0xbf,0x00,0x74,0x18,
-0xff,0x58,0x4c,0x07,0x28,0x74,0x06,0xf3,0x51,0x17,0x0e,0x37,0x58,0x17,0x09,0x15,
-0x26,0x18,0x04,0x75,0x51,0x17,0xff,0xff,0x21,0x03,0xf1,0x0d,0x09,0xda,0x61,0x12,
-0x3f,0xdd,0x03,0x11,0x0f,0x26,0x00,0x13,0x01,0x0a,0x37,0x11,0x80,0x45,0x00,0x02,
-0xd1,0x53,0x01,0x15,0x3d,0x13,0xfb,0xd0,0x00,0x03,0x87,0x5f,0x02,0xc2,0x28,0x03,
-0xb0,0x1c,0x11,0xbf,0x8f,0x7a,0x00,0xf4,0x00,0x12,0x01,0xbc,0x02,0x01,0x70,0x17,
-0x14,0x0f,0x1a,0x64,0x23,0xff,0x90,0x7b,0x73,0x01,0xdc,0x00,0x12,0x0b,0x9e,0x26,
-0x10,0x5f,0x41,0x00,0x15,0x07,0x27,0x33,0x13,0xf2,0x69,0x1d,0x10,0x3f,0x17,0x00,
-0x12,0x3f,0xbf,0x00,0x11,0xcf,0x52,0x01,0x00,0x58,0x00,0x12,0x08,0x99,0x04,0x12,
-0x0f,0x0b,0x54,0x00,0x58,0x00,0x10,0xcf,0xb6,0x3b,0x22,0xf0,0x02,0x02,0x05,0x00,
-0xc3,0x64,0x11,0x1f,0x35,0x29,0x24,0x40,0x5f,0xbd,0x54,0x92,0xfb,0x05,0xff,0xff,
-0xb0,0x9f,0xff,0xf9,0x09,0x64,0x04,0x11,0x0f,0x7c,0x39,0x10,0xf7,0x7a,0x1e,0x11,
-0xcf,0x0f,0x01,0x00,0x8d,0x00,0x51,0x1e,0xff,0xff,0x20,0x0f,0x3d,0x38,0x12,0xe0,
-0xac,0x02,0x12,0xf8,0x52,0x28,0x16,0xfa,0x58,0x3c,0x00,0x02,0x2a,0x16,0x06,0xc9,
-0x27,0x03,0xf2,0x0a,0x15,0x1f,0x78,0x01,0x22,0x0b,0xff,0xbf,0x11,0x01,0x42,0x35,
-0x05,0x19,0x24,0x18,0xfa,0x14,0x29,0x13,0x03,0x3e,0x00,0x15,0x3f,0xfe,0x23,0x17,
-0x0f,0x86,0x41,0x17,0x20,0xb0,0x26,0x07,0x8a,0x24,0x02,0x60,0x26,0x08,0xe4,0x66,
-0x12,0x4f,0x52,0x03,0x16,0x01,0x3f,0x06,0x06,0xb6,0x28,0x04,0xe7,0x0c,0x00,0x67,
-0x03,0x01,0x8e,0x36,0x03,0xef,0x47,0x02,0xfc,0x5d,0x02,0x0c,0x52,0x02,0x20,0x00,
-0x11,0x03,0x57,0x11,0x01,0x34,0x1c,0x03,0x6c,0x2d,0x13,0x01,0xe2,0x26,0x01,0xc6,
-0x4e,0x04,0x66,0x37,0x00,0x08,0x00,0x05,0x54,0x39,0x00,0xbd,0x15,0x04,0x5a,0x0b,
-0x18,0x06,0x9c,0x75,0x1b,0x0c,0xe7,0x3d,0x06,0x9d,0x15,0x08,0xb1,0x28,0x18,0x02,
-0x47,0x75,0x17,0x6f,0x9c,0x28,0x17,0x1e,0x62,0x18,0x17,0x08,0x02,0x5b,0x18,0x02,
-0x02,0x68,0x17,0xaf,0x1d,0x40,0x12,0x4f,0x66,0x06,0x14,0xfc,0x7c,0x00,0x26,0x50,
-0xcf,0x53,0x07,0x14,0xc0,0x0e,0x34,0x01,0xff,0x15,0x03,0x46,0x2e,0x02,0xcc,0x27,
-0x02,0xc9,0x00,0x03,0xa6,0x4f,0x14,0x9f,0x66,0x75,0x17,0x90,0xa2,0x4f,0x13,0xf1,
-0xab,0x04,0x26,0xc0,0xcf,0x54,0x09,0x13,0xfd,0x25,0x01,0x02,0x4c,0x00,0x04,0xf7,
-0x2f,0x01,0xa5,0x00,0x03,0xc1,0x49,0x14,0x4f,0xe5,0x6a,0x14,0xb0,0x5d,0x61,0x12,
-0x1f,0x10,0x03,0x02,0xf9,0x27,0x14,0xbf,0x75,0x28,0x13,0xfd,0xb0,0x52,0x02,0x46,
-0x2d,0x04,0x9c,0x2d,0x02,0xaf,0x2e,0x02,0x07,0x00,0x16,0x0f,0xa0,0x60,0x12,0x70,
-0xa2,0x21,0x03,0xa4,0x14,0x16,0xaf,0xbe,0x6d,0x10,0xf1,0x59,0x07,0x04,0x1a,0x1d,
-0x14,0x53,0xe0,0x03,0x12,0x0f,0x36,0x51,0x15,0xf1,0xde,0x03,0x04,0x84,0x01,0x18,
-0x05,0x7f,0x2a,0x18,0x0f,0x52,0x28,0x26,0xaf,0xff,0xb4,0x55,0x18,0x04,0xa4,0x2a,
-0x08,0xf1,0x2b,0x05,0xa6,0x2d,0x1b,0x00,0xcb,0x2b,0x28,0x00,0x0e,0x27,0x26,0x07,
-0x30,0x77,0x05,0x56,0x2e,0x04,0x9d,0x17,0x17,0xf0,0x04,0x27,0x18,0xfb,0xf6,0x26,
-0x17,0x50,0x99,0x26,0x13,0xf0,0xbc,0x23,0x25,0x24,0xaf,0xe9,0x02,0x16,0x03,0x96,
-0x3c,0x03,0x56,0x02,0x17,0xb0,0x19,0x00,0x17,0xe1,0x1c,0x2f,0x17,0xe3,0xff,0x62,
-0x15,0xa1,0x25,0x4c,0x3a,0x67,0x75,0x10,0x3b,0x29,0x01,0xa5,0x02,0x0f,0x0b,0x00,
-0x18,0x21,0xf2,0x07,0xe1,0x4e,0x15,0xcf,0xd0,0x00,0x03,0x9a,0x39,0x05,0x77,0x2a,
-0x0c,0x57,0x27,0x16,0x03,0x06,0x03,0x16,0x1e,0xaf,0x00,0x15,0xbf,0xd3,0x27,0x1a,
-0x06,0x15,0x43,0x16,0x80,0xd9,0x78,0x06,0xdf,0x21,0x17,0xe1,0xad,0x31,0x05,0x06,
-0x03,0x0f,0x75,0x00,0x09,0x10,0x04,0x6f,0x03,0x01,0xa9,0x00,0x26,0x86,0x1e,0x41,
-0x19,0x1f,0x4f,0x0b,0x00,0x18,0x02,0xdc,0x00,0x13,0x50,0xdf,0x1f,0x03,0x92,0x2b,
-0x15,0xf6,0x01,0x2f,0x01,0x04,0x02,0x16,0xf9,0x2e,0x65,0x12,0x0c,0x10,0x06,0x16,
-0x02,0xbd,0x6d,0x12,0xa0,0x77,0x06,0x03,0x84,0x7b,0x01,0x22,0x02,0x16,0x0b,0x8d,
-0x0e,0x0f,0x0f,0x00,0x0b,0x03,0xf8,0x76,0x01,0x57,0x0a,0x03,0x5c,0x03,0x00,0xf1,
-0x80,0x02,0x07,0x3e,0x12,0xf6,0xf4,0x00,0x16,0xfb,0x26,0x29,0x04,0xd7,0x65,0x03,
-0x8a,0x01,0x13,0x0e,0x1d,0x01,0x14,0x03,0xe9,0x25,0x02,0x9b,0x06,0x01,0xd2,0x03,
-0x17,0x10,0x40,0x76,0x03,0x69,0x00,0x0f,0x96,0x00,0x13,0x03,0xc3,0x00,0x16,0x09,
-0xa1,0x1e,0x17,0xa0,0xf0,0x00,0x16,0x0d,0x43,0x0f,0x13,0xe2,0x3d,0x00,0x14,0xe6,
-0x6f,0x58,0x02,0x3e,0x00,0x02,0x95,0x07,0x14,0x5d,0x15,0x02,0x20,0x70,0x00,0x5b,
-0x06,0x1f,0xf2,0x05,0x00,0x4c,0x53,0xbb,0xbb,0x10,0x00,0x50,0x5c,0x02,0x23,0xf9,
-0x20,0x09,0x08,0x13,0x70,0x2b,0x01,0x17,0x90,0x51,0x33,0x04,0x1e,0x5e,0x16,0x0a,
-0x90,0x77,0x17,0xf0,0x63,0x77,0x16,0x0a,0x66,0x22,0x12,0x70,0xb4,0x03,0x13,0xf8,
-0x70,0x02,0x1f,0x80,0x0f,0x00,0x0e,0x13,0x07,0x53,0x00,0x16,0x4f,0xe3,0x77,0x17,
-0x50,0x64,0x27,0x13,0x0d,0xd6,0x14,0x13,0x1c,0x1c,0x03,0x00,0x8e,0x21,0x04,0x35,
-0x57,0x02,0x42,0x07,0x12,0xfb,0x7f,0x05,0x15,0x82,0x1c,0x19,0x25,0x00,0x4f,0x94,
-0x07,0x04,0x90,0x06,0x1f,0x90,0x96,0x00,0x16,0x12,0x9f,0x0f,0x00,0x04,0xd2,0x00,
-0x03,0x00,0x5e,0x12,0x1f,0xf0,0x00,0x03,0xd0,0x25,0x16,0x04,0xb6,0x34,0x00,0x2c,
-0x00,0x06,0x9a,0x00,0x11,0x80,0xc9,0x00,0x12,0xfb,0x7f,0x04,0x15,0x82,0x09,0x2c,
-0x39,0x58,0x87,0x30,0x77,0x33,0x11,0xe5,0x1f,0x3a,0x22,0xcc,0xc7,0x04,0x07,0x03,
-0x98,0x11,0x25,0x80,0x0a,0x44,0x1c,0x12,0xef,0xba,0x3a,0x02,0x73,0x0e,0x00,0xc9,
-0x45,0x04,0xd7,0x35,0x10,0xc9,0x47,0x5a,0x63,0x1f,0xff,0xff,0xe4,0x02,0x9f,0x63,
-0x14,0x11,0x04,0x1d,0x04,0x03,0x41,0x25,0x03,0x6f,0x5d,0x12,0x3e,0x04,0x05,0x12,
-0x07,0xf7,0x00,0x12,0x1b,0x6c,0x7c,0x41,0x01,0x11,0x10,0x00,0x18,0x0c,0x21,0xfe,
-0xc7,0x09,0x00,0x45,0x4b,0xef,0xd9,0x10,0x64,0x2f,0x02,0x72,0x07,0xc0,0x04,0xff,
-0xff,0xa8,0xcf,0xff,0xd0,0x0b,0xff,0xf4,0x00,0x09,0x7b,0x20,0x00,0x13,0x33,0x20,
-0xf8,0x0f,0xd2,0x01,0x50,0xdf,0xf9,0x0f,0xff,0x90,0x0e,0x00,0x30,0x0b,0xff,0xf3,
-0x1c,0x00,0x11,0x05,0x2a,0x00,0x12,0xe0,0x38,0x00,0x14,0x40,0x46,0x00,0x00,0x54,
-0x00,0x07,0x96,0x2e,0x08,0x7d,0x34,0x02,0x2d,0x81,0x0a,0xc0,0x5c,0x08,0x33,0x6d,
-0x03,0x1d,0x09,0x1a,0xa0,0x1c,0x5c,0x08,0xaa,0x2e,0x00,0xb6,0x7d,0x08,0x74,0x11,
-0x12,0x02,0x45,0x1e,0x18,0xc0,0x54,0x2d,0x27,0x70,0xcf,0xac,0x2c,0x12,0x0d,0xd4,
-0x81,0x17,0xf7,0x9f,0x69,0x15,0xfc,0x48,0x7a,0x05,0xad,0x02,0x16,0xdf,0x30,0x1d,
-0x10,0x0e,0x2f,0x07,0x16,0x07,0xa4,0x2a,0x11,0x05,0xe6,0x04,0x19,0x2f,0x18,0x2a,
-0x11,0x70,0xb3,0x03,0x15,0x50,0x8d,0x2a,0x16,0xf1,0x66,0x02,0x01,0x25,0x03,0x15,
-0xfc,0x17,0x00,0x03,0xde,0x03,0x12,0x70,0x07,0x00,0x14,0x60,0xd8,0x06,0x16,0xf1,
-0x28,0x00,0x01,0x0c,0x02,0x13,0xfc,0x49,0x00,0x1b,0xf2,0x3d,0x49,0x05,0xb8,0x46,
-0x09,0xeb,0x5b,0x1b,0x09,0xeb,0x5b,0x09,0x03,0x49,0x09,0x5a,0x73,0x03,0x6f,0x01,
-0x00,0x5b,0x0f,0x02,0x1c,0x52,0x02,0x09,0x12,0x16,0x01,0x97,0x01,0x14,0xef,0x6f,
-0x6f,0x18,0xf4,0x9a,0x6a,0x16,0x0c,0xa7,0x01,0x00,0xe4,0x78,0x09,0xb1,0x71,0x13,
-0xef,0xda,0x34,0x17,0xf4,0x6d,0x1e,0x14,0x20,0x8d,0x25,0x04,0x15,0x0c,0x18,0x04,
-0xf9,0x01,0x00,0x1d,0x5d,0x17,0x9f,0x13,0x2f,0x01,0x9f,0x1e,0x06,0x66,0x28,0x01,
-0x0f,0x01,0x0f,0x0f,0x00,0x2c,0x14,0xf7,0xc6,0x29,0x1a,0x50,0xee,0x6a,0x1f,0x00,
-0x0f,0x00,0x4c,0x04,0xad,0x43,0x2a,0x83,0x00,0x96,0x00,0x1a,0xd5,0x0f,0x00,0x2a,
-0xff,0xa0,0x0f,0x00,0x1a,0xfa,0x0f,0x00,0x20,0xff,0x60,0x86,0x0a,0x00,0xbf,0x00,
-0x33,0x56,0x8c,0xff,0x0e,0x64,0x16,0xf2,0x91,0x68,0x17,0xf4,0x78,0x00,0x00,0x41,
-0x54,0x07,0x0f,0x00,0x00,0xb9,0x11,0x07,0x0f,0x00,0x00,0xb4,0x0e,0x0f,0x0f,0x00,
-0x07,0x1a,0x7f,0x2d,0x00,0x00,0x42,0x2a,0x06,0x0f,0x00,0x13,0x3c,0xb8,0x48,0x71,
-0xf7,0x66,0x66,0x66,0x66,0x67,0x9c,0xb5,0x00,0x29,0xcf,0xff,0x73,0x45,0x09,0x0f,
-0x00,0x19,0xf3,0xc3,0x00,0x28,0xfd,0x30,0x0f,0x00,0x28,0xfe,0x70,0x1d,0x01,0x27,
-0xc9,0x50,0x1d,0x01,0x4a,0xfe,0xda,0x73,0x00,0x2c,0x01,0x1b,0xe7,0x3b,0x01,0x1a,
-0xd2,0x0f,0x00,0x2a,0xfe,0x10,0x2c,0x01,0x11,0xb0,0x8c,0x3c,0x64,0x22,0x22,0x22,
-0x23,0x46,0xbf,0x16,0x76,0x15,0xf2,0xaf,0x0a,0x17,0xf6,0xa4,0x01,0x01,0x3a,0x43,
-0x06,0x0f,0x00,0x01,0x38,0x10,0x09,0x0f,0x00,0x17,0xf7,0x0f,0x00,0x13,0x9f,0xd2,
-0x00,0x17,0xf2,0x0d,0x6d,0x04,0x0f,0x00,0x21,0x13,0x8f,0xea,0x05,0x1a,0xcf,0x30,
-0x5f,0x17,0xcf,0xcf,0x01,0x18,0x20,0x0f,0x00,0x2b,0xfe,0x73,0xd2,0x00,0x1b,0xd6,
-0x0d,0x02,0x11,0xc1,0xf4,0x19,0x10,0x22,0xc4,0x00,0x11,0x6a,0xd4,0x03,0x06,0x87,
-0x00,0x10,0x2d,0x4d,0x06,0x1a,0xcf,0x0e,0x48,0x07,0xb3,0x01,0x1a,0xaf,0x0d,0x02,
-0x00,0xe7,0x08,0x07,0x0f,0x00,0x19,0x8f,0xd1,0x01,0x01,0x35,0x16,0x0a,0x4b,0x00,
-0x1a,0xf4,0x69,0x00,0x13,0xf0,0x4a,0x01,0x31,0x22,0x33,0x6a,0x3a,0x04,0x0f,0xef,
-0x01,0x25,0x18,0xfd,0xef,0x01,0x02,0xf0,0x6a,0x17,0xcf,0xfb,0x46,0x0f,0x0c,0x00,
-0x20,0x22,0xf7,0x66,0x01,0x00,0x18,0x61,0x72,0x03,0x0f,0x0c,0x00,0xff,0x26,0x0a,
-0x38,0x4f,0x17,0xf0,0x26,0x76,0x09,0x11,0x00,0x1c,0xdf,0x11,0x00,0x1b,0xff,0x11,
-0x00,0x1c,0x01,0x11,0x00,0x12,0x04,0x83,0x49,0x06,0x6c,0x31,0x12,0x06,0xac,0x07,
-0x06,0xf6,0x70,0x03,0x0e,0x3b,0x06,0x11,0x00,0x15,0x0a,0x57,0x3a,0x15,0xf0,0xd1,
-0x07,0x19,0xfa,0x11,0x00,0x12,0x0f,0x82,0x09,0x06,0x11,0x00,0x12,0x1f,0xf0,0x07,
-0x06,0x11,0x00,0x03,0xc6,0x10,0x06,0x11,0x00,0x15,0x7f,0x31,0x69,0x06,0x9f,0x3e,
-0x19,0xd0,0x11,0x00,0x03,0xb9,0x71,0x05,0x11,0x00,0x16,0x01,0xd4,0x18,0x16,0xf0,
-0xb9,0x3d,0x08,0x11,0x00,0x04,0xa2,0x71,0x05,0x11,0x00,0x00,0x21,0x73,0x09,0xd3,
-0x71,0x04,0x24,0x2c,0x05,0x11,0x00,0x04,0x60,0x1c,0x05,0x11,0x00,0x08,0xef,0x6e,
-0x09,0xd9,0x32,0x04,0x11,0x00,0x14,0x09,0x14,0x0f,0x04,0x11,0x00,0x05,0x1a,0x40,
-0x07,0x4a,0x70,0x17,0xfa,0x4a,0x72,0x20,0x6c,0xcc,0x6f,0x03,0x22,0xcc,0xcc,0x76,
-0x01,0x4b,0xfc,0xcc,0xc3,0x9f,0x2a,0x20,0x1f,0xf5,0x11,0x00,0x34,0x18,0x40,0xaa,
-0x0a,0x0f,0x11,0x00,0x87,0x09,0xa3,0x04,0x1f,0x30,0x0e,0x00,0x28,0x24,0xf7,0x66,
+0x00,0x00,0xd0,0x00,0x14,0xf2,0x0d,0x00,0x00,0xa1,0x05,0x14,0x70,0x0d,0x00,0x10,
+0x02,0xe6,0x02,0x04,0x0d,0x00,0x10,0x0b,0x38,0x05,0x04,0x0d,0x00,0x10,0x6f,0x35,
+0x01,0x02,0x0d,0x00,0x00,0x54,0x02,0x23,0xfd,0x00,0x0d,0x00,0x00,0x53,0x01,0x15,
+0xf4,0x0d,0x00,0x11,0x4f,0xb8,0x01,0x03,0x0d,0x00,0x44,0xef,0xff,0xfe,0x10,0x0d,
+0x00,0x12,0x09,0x13,0x00,0x02,0x0d,0x00,0x17,0x3f,0xd3,0x02,0x28,0xf3,0xaf,0x0d,
+0x00,0x18,0x9f,0x0d,0x00,0x18,0x8f,0x0d,0x00,0x18,0x7f,0x0d,0x00,0x21,0x37,0x77,
+0x01,0x00,0x63,0xbf,0xff,0xff,0xfa,0x77,0x71,0x13,0x01,0x05,0xd0,0x00,0x0f,0x0d,
+0x00,0x39,0x06,0xf9,0x01,0x37,0x60,0x00,0x0e,0x0c,0x00,0x17,0x0f,0x0c,0x00,0x17,
+0x1f,0x0c,0x00,0x16,0x3f,0x0c,0x00,0x00,0x9e,0x02,0x21,0xfb,0xbb,0x01,0x00,0x10,
+0x40,0x64,0x01,0x17,0xc0,0x90,0x02,0x17,0xa0,0xee,0x01,0x14,0x70,0x0c,0x00,0x17,
+0xdf,0xe7,0x04,0x08,0xe6,0x02,0x00,0xb3,0x02,0x43,0xad,0xff,0xec,0x83,0x7b,0x03,
+0x01,0x64,0x02,0x14,0xb2,0xf7,0x01,0x11,0xff,0xb3,0x02,0x15,0x06,0x77,0x00,0x11,
+0xf2,0xb8,0x03,0x03,0x9b,0x06,0x01,0x0c,0x00,0x41,0xb5,0x32,0x48,0xef,0x42,0x05,
+0x33,0x04,0x7b,0xe5,0xb1,0x02,0x17,0xc0,0xca,0x03,0x26,0xf0,0x00,0x53,0x02,0x17,
+0xf4,0xfe,0x00,0x17,0xf6,0x72,0x03,0x17,0xf7,0x72,0x05,0x18,0xf8,0x18,0x00,0x00,
+0xdc,0x07,0x03,0x43,0x02,0x22,0xf6,0x5f,0x1c,0x00,0x00,0xe7,0x02,0x31,0xf3,0x2f,
+0xff,0xfb,0x01,0x00,0xa3,0x00,0x10,0xe0,0x43,0x01,0x40,0xc1,0x00,0x00,0x3e,0xc6,
+0x03,0x11,0x04,0xc8,0x08,0x21,0x8b,0xff,0x75,0x03,0x17,0xaf,0x48,0x03,0x17,0x0c,
+0xa5,0x04,0x04,0x19,0x00,0x11,0xfa,0x03,0x03,0x16,0xdf,0x7f,0x06,0x75,0x00,0x03,
+0x8c,0xef,0xfe,0xc9,0x40,0xa4,0x01,0x43,0x59,0xce,0xef,0xb0,0xaa,0x05,0x15,0xbf,
+0xf3,0x05,0x24,0x01,0xbf,0x47,0x00,0x04,0xa4,0x06,0x14,0xb0,0x71,0x03,0x04,0x0c,
+0x00,0x11,0x6f,0x53,0x00,0x23,0xba,0x70,0xef,0x05,0x25,0xff,0xa4,0x3b,0x03,0x00,
+0x05,0x05,0x04,0x14,0x03,0x17,0xfa,0x59,0x04,0x17,0xd0,0x91,0x03,0x52,0x30,0x01,
+0x56,0x75,0x30,0xf8,0x02,0x71,0xfc,0x05,0xcf,0xff,0xff,0xfe,0x70,0x43,0x0a,0x23,
+0xf8,0xbf,0xd0,0x04,0x06,0x03,0x02,0x37,0xd1,0x00,0x5f,0xae,0x05,0x07,0xce,0x02,
+0x01,0xf9,0x05,0x40,0xfb,0x41,0x03,0xaf,0x8c,0x01,0x12,0x9f,0x2a,0x05,0x13,0x07,
+0x0c,0x03,0x04,0x44,0x01,0x23,0xf6,0xaf,0xb9,0x06,0x00,0xe5,0x04,0x03,0x0c,0x00,
+0x00,0x6b,0x02,0x10,0xfb,0xcf,0x04,0x04,0xac,0x07,0x03,0x40,0x09,0x00,0x80,0x00,
+0x14,0xfd,0xbf,0x02,0x00,0x18,0x00,0x03,0xa8,0x01,0x00,0x5a,0x04,0x22,0xfa,0x0f,
+0x6c,0x07,0x00,0x80,0x00,0x22,0xf7,0x0a,0x65,0x05,0x10,0x02,0x29,0x02,0x12,0x03,
+0xce,0x04,0x11,0x2d,0x10,0x02,0x00,0x8a,0x00,0x31,0xd9,0x8b,0xff,0x45,0x07,0x14,
+0x1e,0xa7,0x00,0x13,0xf9,0x20,0x01,0x13,0xff,0x33,0x02,0x16,0x2e,0x79,0x06,0x01,
+0x4f,0x00,0x05,0xcb,0x05,0x50,0x01,0x6a,0xde,0xfe,0xd9,0x98,0x01,0x08,0xbf,0x03,
+0x17,0x89,0x0c,0x00,0x1f,0xf8,0x19,0x00,0x12,0x23,0x34,0x88,0x01,0x00,0x17,0xdf,
+0x2e,0x03,0x17,0x1f,0x96,0x03,0x13,0x08,0xcb,0x00,0x04,0x97,0x01,0x05,0x3b,0x03,
+0x17,0x7f,0x16,0x08,0x17,0x0e,0xab,0x06,0x13,0x05,0xde,0x05,0x04,0x60,0x03,0x17,
+0xb0,0xbd,0x02,0x17,0xf4,0x3b,0x08,0x27,0xfd,0x00,0xff,0x07,0x17,0x60,0x9d,0x03,
+0x17,0xf0,0xa4,0x05,0x05,0xfa,0x02,0x17,0x09,0x5e,0x06,0x27,0x01,0xff,0xce,0x03,
+0x04,0x8f,0x01,0x08,0x53,0x09,0x04,0x7d,0x02,0x17,0x50,0xb8,0x00,0x17,0xe0,0x68,
+0x03,0x05,0x5c,0x03,0x17,0x0d,0x56,0x00,0x18,0x05,0xf3,0x06,0x16,0xcf,0xc2,0x08,
+0x24,0x00,0x4f,0x7f,0x01,0x02,0x9f,0x05,0x27,0xff,0x40,0xb8,0x00,0x17,0xd0,0xca,
+0x03,0x17,0xf6,0xb8,0x00,0x18,0xfe,0xb8,0x00,0x16,0x80,0xf2,0x0a,0x42,0xad,0xef,
+0xfe,0xc8,0x40,0x00,0x25,0x1a,0xff,0xcd,0x01,0x26,0x04,0xef,0xe5,0x01,0x17,0x4f,
+0x95,0x03,0x25,0xdf,0xff,0xe9,0x06,0x01,0x6d,0x04,0x20,0xa8,0x9c,0x32,0x00,0x01,
+0x84,0x00,0x12,0xc1,0x69,0x03,0x22,0x40,0x0e,0xc1,0x00,0x10,0x09,0x64,0x02,0x12,
+0x0f,0x54,0x01,0x10,0x04,0x72,0x00,0x03,0x0a,0x01,0x10,0x03,0x0c,0x00,0x12,0x0d,
+0x8f,0x00,0x10,0x06,0x11,0x01,0x12,0x08,0x8d,0x02,0x00,0xf8,0x00,0x01,0xa6,0x08,
+0x41,0xf8,0x20,0x04,0xdf,0x10,0x01,0x17,0x3f,0x5b,0x0a,0x04,0x90,0x00,0x17,0xf9,
+0x1a,0x08,0x10,0x50,0x78,0x01,0x15,0xaf,0x90,0x07,0x06,0xb1,0x02,0x21,0x80,0x00,
+0xc3,0x07,0x01,0x9c,0x00,0x11,0xf7,0x89,0x00,0x12,0xa0,0x9c,0x00,0x22,0x20,0x1f,
+0x84,0x00,0x01,0x58,0x01,0x16,0x6f,0x1d,0x0d,0x27,0xf0,0xaf,0x8d,0x0c,0x16,0xbf,
+0xa5,0x0c,0x26,0xf4,0xbf,0x18,0x00,0x23,0xf4,0xaf,0x30,0x00,0x12,0xcf,0x48,0x08,
+0x13,0xfc,0xd8,0x00,0x01,0x3b,0x08,0x12,0xa0,0xd9,0x04,0x30,0xb0,0x0c,0xff,0x78,
+0x00,0x11,0x8c,0x9e,0x00,0x18,0x03,0xa3,0x09,0x16,0x6f,0x0d,0x04,0x05,0xa6,0x05,
+0x10,0xfc,0xe7,0x01,0x12,0x2a,0x74,0x01,0x15,0x70,0x8c,0x01,0x50,0xc9,0x50,0x00,
+0x00,0x00,0x91,0x00,0x00,0x00,0x05,0xad,0xff,0xed,0x94,0x00,0x01,0x00,0x71,0x06,
+0xef,0xff,0xff,0xff,0xff,0xd4,0x0c,0x00,0x21,0xbf,0xff,0x01,0x00,0x62,0x80,0x00,
+0x00,0x00,0x0c,0xff,0x01,0x00,0x16,0xf9,0x17,0x00,0x50,0xff,0xff,0x60,0x00,0x05,
+0x07,0x00,0xf0,0x00,0xa8,0xaf,0xff,0xff,0xff,0xf1,0x00,0x0d,0xff,0xff,0xff,0xc1,
+0x00,0x01,0xcf,0x25,0x00,0xf0,0x01,0x4f,0xff,0xff,0xfe,0x00,0x00,0x00,0x0e,0xff,
+0xff,0xff,0x00,0x9f,0xff,0xff,0xf6,0x59,0x00,0xf0,0x05,0xff,0xff,0xff,0x50,0xcf,
+0xff,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xff,0xff,0x90,0xef,0xff,0xff,0xd0,0x66,
+0x00,0x80,0xef,0xff,0xff,0xc0,0xff,0xff,0xff,0xc0,0x0c,0x00,0x52,0xcf,0xff,0xff,
+0xe0,0xff,0x18,0x00,0x00,0x67,0x00,0x22,0xf0,0xdf,0x30,0x00,0x01,0x0c,0x00,0x44,
+0xbf,0xff,0xff,0xf3,0x0c,0x00,0x43,0x8f,0xff,0xff,0xfb,0x48,0x00,0x90,0xf0,0x3f,
+0xff,0xff,0xff,0x70,0x00,0x00,0x2d,0x0c,0x00,0x00,0x84,0x00,0x40,0xfb,0x53,0x59,
+0xff,0x0c,0x00,0x25,0x05,0xff,0x01,0x00,0x35,0xe0,0x00,0x9f,0x0c,0x00,0x31,0xd0,
+0x00,0x0a,0x08,0x00,0x80,0xfd,0xff,0xff,0xff,0xa0,0x00,0x00,0x7f,0x0c,0x00,0x12,
+0xa1,0x43,0x00,0xb2,0x01,0x6b,0xdf,0xfd,0x93,0x03,0xff,0xff,0xff,0x30,0x00,0x01,
+0x00,0x10,0x09,0xc0,0x00,0x03,0x01,0x00,0x12,0x2f,0xfd,0x00,0x13,0x00,0xa7,0x00,
+0x13,0xf2,0x0b,0x00,0x12,0x2c,0x47,0x00,0x00,0x01,0x00,0x10,0x39,0x4b,0x00,0x70,
+0x10,0x00,0x00,0x00,0x0a,0xbc,0xdf,0x0b,0x00,0x23,0xf5,0x00,0x03,0x01,0x02,0x5e,
+0x00,0x04,0x0c,0x00,0x25,0xf7,0x00,0x0c,0x00,0x25,0xfd,0x40,0x0c,0x00,0x33,0xfd,
+0x60,0x00,0x0c,0x00,0x23,0xed,0xa7,0x7f,0x00,0x90,0x5c,0xfe,0x91,0x00,0x5f,0xff,
+0xff,0xd0,0x0e,0x6b,0x01,0x00,0x7c,0x01,0x10,0x0f,0x49,0x00,0x10,0x9f,0x7c,0x00,
+0x8f,0x9f,0xff,0xd3,0x00,0x00,0x03,0x20,0x00,0x01,0x00,0x1b,0x20,0x01,0x32,0xd3,
+0x00,0x30,0xfe,0x30,0x08,0xa8,0x00,0x00,0x8a,0x00,0x13,0x0f,0x88,0x01,0xe1,0xf6,
+0x06,0xff,0xff,0xfd,0x00,0x04,0xcf,0xe9,0x10,0x00,0x09,0xef,0xd6,0xe0,0x00,0x20,
+0x80,0x04,0x44,0x01,0x60,0x07,0xff,0xff,0xff,0xf2,0x05,0xdf,0x01,0x00,0xa7,0x01,
+0xbf,0xb0,0x00,0x2c,0xff,0xfa,0x10,0x00,0x00,0x23,0x10,0x00,0x01,0x00,0x2a,0x60,
+0x03,0x33,0x33,0x10,0x00,0x3f,0x59,0x02,0x0e,0x05,0x00,0x10,0x70,0x05,0x00,0x10,
+0x60,0xf8,0x00,0x30,0x40,0x00,0x8f,0x7e,0x01,0x80,0xdf,0xff,0xfb,0x00,0x03,0xff,
+0xff,0xf4,0xb7,0x01,0x10,0xb0,0x1d,0x00,0x31,0x20,0x00,0x4e,0x51,0x02,0x2f,0x7e,
+0x70,0x62,0x00,0x08,0x14,0x96,0x0a,0x00,0x23,0x5c,0xff,0x27,0x00,0x23,0x17,0xef,
+0x7a,0x01,0x24,0x03,0xaf,0x90,0x01,0x14,0x5c,0x8f,0x01,0x23,0x17,0xef,0xa5,0x01,
+0x22,0x03,0xaf,0xaf,0x01,0x32,0xe4,0x00,0x5c,0x09,0x00,0x32,0xfa,0x40,0x06,0x1c,
+0x00,0x23,0xfb,0x60,0xf9,0x02,0xb4,0xfd,0x71,0x00,0x00,0x00,0x0b,0xff,0xff,0xff,
+0xfe,0x83,0x25,0x03,0x12,0xfb,0x10,0x01,0x10,0x0b,0x1f,0x00,0x17,0xb5,0x3a,0x03,
+0x13,0xa4,0x6e,0x00,0x00,0x2d,0x00,0x62,0x93,0x00,0x00,0x00,0x18,0xef,0x0c,0x00,
+0x52,0x82,0x00,0x00,0x00,0x6d,0x60,0x00,0x16,0xf6,0x23,0x00,0x24,0x70,0x00,0x23,
+0x00,0x12,0xf7,0xb2,0x00,0x14,0x6c,0x15,0x00,0x01,0x23,0x00,0x03,0x15,0x00,0x00,
+0x23,0x00,0x06,0xf9,0x00,0x34,0x54,0x79,0x99,0x01,0x00,0x25,0x91,0xdf,0xe3,0x02,
+0x1f,0xf2,0x0b,0x00,0x19,0x0f,0xb9,0x01,0x19,0x0f,0x6e,0x00,0x2f,0x25,0x2b,0x40,
+0x4d,0x00,0x35,0x3f,0xfd,0x71,0x0b,0x00,0x36,0xff,0xff,0x92,0x0b,0x00,0x26,0xff,
+0xc5,0x0b,0x00,0x35,0xff,0xe7,0x10,0x0b,0x00,0x20,0xff,0xfa,0x19,0x03,0x12,0x1c,
+0x4a,0x00,0x10,0xfc,0x30,0x03,0x26,0x28,0xdf,0x51,0x01,0x22,0x03,0x8e,0x19,0x00,
+0x10,0xb1,0x30,0x00,0x11,0x49,0x6a,0x01,0x11,0xf3,0x47,0x00,0x25,0x05,0xaf,0x0b,
+0x00,0x34,0x00,0x05,0xef,0x0b,0x00,0x23,0x49,0xef,0x16,0x00,0x33,0x02,0x8e,0xff,
+0x2c,0x00,0x13,0x17,0x4e,0x00,0x42,0x70,0x01,0x6c,0xff,0xf4,0x01,0x33,0x50,0x00,
+0x2f,0xf7,0x04,0x14,0x20,0x84,0x00,0x15,0xd6,0x8f,0x00,0x14,0xb4,0xa5,0x00,0x24,
+0xfe,0x82,0xb0,0x00,0x24,0xfd,0x60,0xc6,0x00,0x24,0xfa,0x30,0xdc,0x00,0x28,0x28,
+0x10,0x82,0x03,0x51,0x6a,0xde,0xff,0xec,0x84,0x0b,0x00,0x24,0x8f,0xff,0x69,0x05,
+0x24,0x2d,0xff,0x68,0x05,0x14,0x01,0x2a,0x01,0x35,0xf7,0x00,0x0a,0x34,0x01,0x20,
+0x20,0x2f,0x8b,0x00,0x20,0x9b,0xef,0xac,0x03,0x51,0x8f,0xff,0xff,0xfe,0x30,0x1c,
+0x00,0x22,0xe0,0xcf,0x61,0x04,0x15,0xef,0x26,0x05,0x00,0x75,0x02,0x90,0xf2,0x56,
+0x66,0x66,0x50,0x00,0x00,0x00,0xaf,0xb2,0x03,0x02,0x01,0x00,0x03,0x43,0x05,0x00,
+0x22,0x01,0x06,0xab,0x04,0x42,0x1d,0xff,0xff,0xff,0x8a,0x01,0x00,0xb0,0x05,0x16,
+0xfb,0x15,0x00,0x11,0xd1,0x0a,0x00,0x52,0x02,0xef,0xff,0xff,0xfe,0x5e,0x04,0x00,
+0x52,0x05,0x11,0xd2,0x20,0x00,0x00,0x44,0x05,0x22,0xfd,0x10,0x35,0x00,0x05,0x2a,
+0x00,0x01,0xd7,0x05,0x03,0x88,0x04,0x16,0x0a,0x22,0x05,0x13,0x0c,0xfe,0x04,0x02,
+0x41,0x00,0x13,0xf3,0x0b,0x00,0x4f,0x04,0x55,0x55,0x50,0x61,0x02,0x0b,0x25,0x02,
+0x30,0xc2,0x03,0x33,0xdf,0xff,0x80,0x0b,0x00,0x43,0x1e,0xff,0xff,0xf8,0x0b,0x00,
+0x12,0x6f,0x58,0x06,0x04,0x40,0x01,0x0e,0x16,0x00,0x12,0x0d,0x53,0x03,0x01,0xa5,
+0x00,0x29,0xae,0xfd,0x6e,0x00,0x69,0x36,0x9b,0xcd,0xcb,0xa8,0x51,0x6f,0x00,0x26,
+0x28,0xef,0x4c,0x02,0x04,0x82,0x00,0x14,0xaf,0x78,0x01,0x15,0xe7,0x14,0x00,0x16,
+0x07,0x4a,0x06,0x14,0xfc,0x74,0x05,0xa5,0x1b,0xff,0xff,0xff,0xd8,0x52,0x10,0x01,
+0x36,0xae,0x30,0x06,0x00,0x9b,0x02,0x22,0xfc,0x40,0x16,0x01,0x14,0xdf,0x60,0x01,
+0x15,0x0d,0x0a,0x01,0x00,0xb3,0x00,0x23,0xfe,0x10,0x29,0x04,0x03,0x53,0x01,0x01,
+0xbd,0x00,0x13,0xfc,0x64,0x00,0x16,0xd1,0x86,0x00,0x11,0x7f,0x35,0x00,0x1a,0x02,
+0x9f,0x03,0x31,0xbf,0xff,0xe0,0x06,0x00,0x12,0xf5,0xdf,0x00,0x22,0x21,0x00,0x23,
+0x00,0x10,0x50,0x7a,0x02,0x11,0xfb,0xde,0x02,0x41,0xbf,0xff,0xfe,0xa4,0x89,0x01,
+0x11,0xfb,0x8e,0x01,0x13,0x20,0xa0,0x06,0x21,0xff,0xfc,0xbf,0x02,0x30,0xf1,0x00,
+0x01,0x43,0x05,0x32,0x00,0x00,0x4f,0xcc,0x00,0x10,0x30,0x3e,0x02,0x55,0x40,0x00,
+0x6f,0xff,0xf4,0x62,0x03,0x20,0xff,0xf3,0x39,0x00,0x52,0xf8,0x00,0x0b,0xff,0xfe,
+0xbc,0x00,0x31,0xe6,0x20,0x1b,0x48,0x00,0x41,0x7f,0xff,0xb0,0x00,0x3e,0x02,0x70,
+0x08,0xff,0xff,0xe1,0x00,0x00,0xaf,0x54,0x02,0x71,0x05,0xff,0xfd,0x00,0x4f,0xff,
+0xf5,0x0f,0x02,0x11,0xf3,0xf4,0x01,0x01,0x48,0x00,0x23,0xe0,0x07,0x32,0x00,0x11,
+0xfa,0x7e,0x02,0x11,0xd0,0x79,0x02,0x02,0x32,0x00,0x11,0x0d,0x16,0x01,0x31,0x0f,
+0xff,0xfc,0x50,0x07,0x41,0xf0,0x0c,0xff,0xfd,0xc2,0x00,0x00,0xa0,0x02,0x01,0x5d,
+0x00,0x00,0x29,0x00,0x10,0xdf,0x0a,0x08,0x13,0x6f,0x23,0x00,0x11,0xf9,0x52,0x00,
+0x41,0xf0,0x0e,0xff,0xfa,0x8d,0x07,0x11,0x90,0x23,0x00,0x12,0x80,0x7b,0x00,0x01,
+0x32,0x00,0x11,0xbf,0x18,0x05,0x10,0x5f,0xf5,0x01,0x00,0xa4,0x00,0x31,0x0f,0xff,
+0xf9,0x89,0x00,0x11,0x60,0x99,0x02,0x12,0x50,0xcd,0x00,0x01,0x29,0x00,0x11,0xdf,
+0x23,0x00,0x10,0x8f,0x8c,0x02,0x00,0xf6,0x00,0x31,0x0e,0xff,0xfb,0x29,0x00,0x11,
+0x70,0x95,0x00,0x10,0x20,0x14,0x01,0x30,0xf1,0x00,0xcf,0x7b,0x00,0x10,0xbf,0x1a,
+0x00,0x11,0x05,0x7a,0x01,0x32,0x0b,0xff,0xfa,0x0a,0x01,0x10,0x07,0xe1,0x00,0x20,
+0x02,0xef,0xbe,0x00,0x10,0x06,0x38,0x01,0x31,0x8f,0xff,0xf2,0x11,0x08,0x20,0xf7,
+0x58,0x5d,0x01,0x20,0x10,0x06,0x9a,0x00,0x11,0x05,0x70,0x00,0x02,0xf9,0x05,0x41,
+0xef,0xff,0xff,0xdf,0x28,0x01,0x10,0x1f,0xb9,0x00,0x11,0x02,0x14,0x00,0x11,0x56,
+0x06,0x00,0x10,0xe2,0x14,0x01,0x00,0x9c,0x03,0x10,0x03,0x63,0x03,0x24,0x50,0x07,
+0xb2,0x04,0x11,0x07,0xd7,0x00,0xa1,0x01,0x8d,0xff,0xc7,0x10,0x00,0x03,0xad,0xfe,
+0xd9,0x52,0x02,0x3e,0x1f,0xff,0xff,0x6a,0x07,0x3e,0x9f,0xff,0xfc,0xd9,0x07,0x07,
+0x9c,0x08,0x04,0x01,0x00,0x00,0xaa,0x00,0x1d,0xfa,0x15,0x00,0x15,0x0a,0x75,0x08,
+0x25,0x00,0x02,0x15,0x00,0x00,0xb9,0x06,0x20,0xd7,0x20,0x13,0x00,0x28,0x7c,0xf0,
+0x2a,0x00,0x66,0xff,0xff,0xec,0xba,0xab,0xcf,0x0f,0x09,0x02,0x40,0x05,0x04,0xa2,
+0x04,0x06,0x7e,0x00,0x16,0x8e,0x11,0x0a,0x16,0x00,0x2b,0x00,0x11,0xae,0x13,0x00,
+0x2a,0xb6,0x10,0xaa,0x00,0x4b,0x45,0x67,0x76,0x52,0x94,0x00,0x1b,0x5f,0xbe,0x00,
+0x11,0x0b,0xb2,0x09,0x09,0xde,0x00,0x01,0x5c,0x01,0x07,0x33,0x03,0x05,0xb4,0x04,
+0x04,0x6e,0x04,0x06,0xf0,0x04,0x02,0x15,0x03,0x06,0x3b,0x07,0x05,0x6c,0x05,0x16,
+0xfd,0x10,0x00,0x14,0x0e,0xec,0x02,0x04,0x99,0x04,0x02,0xbf,0x00,0x14,0x90,0x11,
+0x00,0x00,0x40,0x05,0x16,0xd9,0x55,0x04,0x01,0x8a,0x01,0x27,0xf7,0x3f,0xca,0x03,
+0x01,0xf6,0x04,0x01,0x12,0x09,0x06,0x12,0x0a,0x11,0xd0,0x57,0x09,0x06,0x2e,0x0a,
+0x36,0xf7,0x00,0x3f,0x27,0x01,0x11,0x08,0x27,0x05,0x13,0xdf,0xdb,0x0a,0x02,0xb8,
+0x05,0x36,0xd0,0x00,0x08,0x3c,0x04,0x11,0x4f,0x2c,0x00,0x15,0x3f,0x0b,0x01,0x12,
+0x0a,0x58,0x05,0x14,0xdf,0x0b,0x01,0x12,0x01,0x17,0x0b,0x15,0x08,0x0b,0x01,0x12,
+0x6f,0x5d,0x00,0x14,0x2f,0x0b,0x01,0x13,0x0c,0x89,0x05,0x13,0xdf,0x0b,0x01,0x10,
+0x02,0x25,0x01,0x44,0xbb,0xbb,0xbb,0xbe,0x0b,0x01,0x16,0x8f,0xc6,0x04,0x17,0xfd,
+0x9a,0x0a,0x05,0x0b,0x01,0x03,0x05,0x01,0x06,0x0b,0x01,0x17,0xaf,0x10,0x00,0x00,
+0x0b,0x01,0x18,0x0f,0x21,0x00,0x12,0xf5,0x05,0x01,0x15,0xd0,0xde,0x00,0x11,0xb0,
+0x05,0x01,0x15,0xf7,0xff,0x00,0x21,0xff,0x10,0x06,0x00,0x15,0x20,0x86,0x06,0x11,
+0xf7,0x27,0x00,0x16,0xc0,0x10,0x01,0x36,0xd0,0x00,0xef,0x21,0x01,0x10,0x2f,0x0b,
+0x01,0x16,0x4f,0x31,0x00,0x00,0x32,0x00,0x26,0xf9,0x0a,0x31,0x00,0x01,0x85,0x05,
+0x13,0xe0,0x8d,0x00,0x20,0xdc,0x96,0x68,0x01,0x05,0x8c,0x00,0x27,0xfb,0x30,0x0d,
+0x00,0x27,0xff,0xf8,0x0d,0x00,0x00,0xfb,0x03,0x09,0xb5,0x00,0x00,0xb0,0x03,0x32,
+0xbb,0xbb,0xcd,0xd3,0x00,0x03,0x36,0x02,0x01,0xd5,0x02,0x14,0x30,0x43,0x02,0x10,
+0x1f,0x30,0x01,0x04,0x0d,0x00,0x10,0x09,0x0b,0x01,0x04,0x0d,0x00,0x18,0x06,0x0d,
+0x00,0x10,0x07,0xb1,0x07,0x04,0x0d,0x00,0x10,0x0a,0x4f,0x07,0x04,0x0d,0x00,0x16,
+0x4f,0x5b,0x00,0x24,0x01,0x39,0x75,0x00,0x15,0xff,0xe4,0x07,0x06,0x0c,0x00,0x18,
+0xe6,0xa9,0x00,0x18,0x71,0x0d,0x00,0x28,0xfe,0x50,0x34,0x00,0x20,0xf7,0x00,0x3a,
+0x09,0x58,0x11,0x11,0x11,0x25,0xcf,0xa9,0x00,0x10,0x0a,0x75,0x01,0x04,0x0d,0x00,
+0x10,0x01,0x09,0x00,0x04,0x06,0x03,0x00,0x89,0x01,0x14,0xf4,0x0d,0x00,0x00,0xc7,
+0x01,0x18,0xf6,0x0d,0x00,0x15,0xf5,0x0d,0x00,0x17,0xef,0x27,0x00,0x01,0xea,0x0b,
+0x03,0x0d,0x00,0x20,0x01,0x8f,0x9e,0x01,0x00,0x71,0x09,0x41,0xaa,0xaa,0xaa,0xcf,
+0x4c,0x03,0x09,0x0b,0x02,0x09,0x39,0x02,0x07,0x19,0x00,0x26,0x30,0x00,0x0c,0x00,
+0x15,0x80,0xd0,0x00,0x60,0xee,0xc8,0x50,0x00,0x00,0x00,0xb2,0x00,0x00,0x00,0x00,
+0x04,0x9c,0xef,0xfe,0xdb,0x73,0x00,0x01,0x00,0x30,0x07,0xef,0xff,0x01,0x00,0x11,
+0xc5,0x0d,0x00,0x32,0x03,0xdf,0xff,0x01,0x00,0x10,0xb1,0x0e,0x00,0x23,0x5f,0xff,
+0x01,0x00,0x65,0xfe,0x20,0x00,0x00,0x04,0xff,0x01,0x00,0x41,0xe2,0x00,0x00,0x1e,
+0x17,0x00,0x10,0xde,0x06,0x00,0xb0,0xfc,0x00,0x00,0xaf,0xff,0xff,0xff,0xc4,0x00,
+0x00,0x15,0x3e,0x00,0x60,0x50,0x03,0xff,0xff,0xff,0xf9,0x3f,0x00,0xa0,0x0b,0xff,
+0xff,0xff,0xd0,0x0a,0xff,0xff,0xff,0xc0,0x0e,0x00,0xa1,0x01,0xff,0xff,0xff,0xf2,
+0x0f,0xff,0xff,0xff,0x30,0x6a,0x00,0xa3,0x9f,0xff,0xff,0xf7,0x4f,0xff,0xff,0xfd,
+0x00,0x00,0x6a,0x00,0x23,0xfa,0x8f,0x37,0x00,0xb5,0x00,0x00,0x2c,0xcc,0xcc,0xca,
+0xbf,0xff,0xff,0xf6,0x00,0x01,0x00,0x46,0xdf,0xff,0xff,0xf4,0x0e,0x00,0x46,0xef,
+0xff,0xff,0xf3,0x0e,0x00,0x00,0x58,0x00,0x0f,0x0e,0x00,0x21,0x0a,0x46,0x00,0x0a,
+0x62,0x00,0x0a,0x7e,0x00,0x42,0x8f,0xff,0xff,0xf8,0x0a,0x00,0x51,0x29,0x99,0x99,
+0x97,0x4f,0xf3,0x00,0x04,0xb6,0x00,0x54,0x1f,0xff,0xff,0xff,0x20,0xd2,0x00,0x10,
+0xf8,0xee,0x00,0x14,0xa0,0xee,0x00,0x10,0xf3,0x0a,0x01,0x14,0xf7,0x0a,0x01,0xa0,
+0xe0,0x00,0xcf,0xff,0xff,0xff,0xa3,0x00,0x00,0x05,0x26,0x01,0x30,0x70,0x00,0x2f,
+0x3c,0x01,0x41,0xed,0xcd,0xff,0xff,0x05,0x01,0x19,0x05,0x5e,0x01,0x25,0x00,0x7f,
+0x0e,0x00,0x00,0x2e,0x01,0x23,0x05,0xef,0x0d,0x00,0x11,0xc2,0x69,0x00,0x12,0x19,
+0x0d,0x00,0x13,0xc6,0x9e,0x00,0x15,0x05,0xce,0x01,0x02,0x18,0x00,0x21,0xeb,0x84,
+0x17,0x00,0x14,0x0f,0xbc,0x01,0x15,0x71,0x1b,0x00,0x00,0x01,0x00,0x17,0xe5,0x1b,
+0x00,0x38,0xff,0xff,0xfa,0x1b,0x00,0x22,0xff,0xfb,0x1b,0x00,0x21,0xcb,0xbb,0xd8,
+0x01,0x11,0xf9,0x1b,0x00,0x91,0xf1,0x00,0x00,0x03,0x9f,0xff,0xff,0xff,0xf5,0x1b,
+0x00,0x51,0x10,0x00,0x00,0x00,0x3e,0xcd,0x00,0x02,0x1b,0x00,0x11,0x00,0xc7,0x00,
+0x14,0x70,0x1b,0x00,0x00,0xb8,0x00,0x15,0xfe,0x1b,0x00,0x00,0x62,0x01,0x15,0xf4,
+0x1b,0x00,0x54,0x09,0xff,0xff,0xff,0x80,0x1b,0x00,0x00,0x3b,0x01,0x15,0xfc,0x1b,
+0x00,0x10,0x02,0x52,0x00,0x05,0x1b,0x00,0x00,0x52,0x01,0x05,0x1b,0x00,0x01,0x4d,
+0x00,0x05,0x1b,0x00,0x00,0x17,0x00,0x18,0x2f,0x1b,0x00,0x19,0xf2,0x1b,0x00,0x14,
+0x1f,0x1b,0x00,0x00,0x7e,0x01,0x15,0xf0,0x1b,0x00,0x18,0x2f,0x51,0x00,0x10,0x06,
+0x90,0x02,0x04,0x1b,0x00,0x00,0xb4,0x01,0x15,0xf9,0x1b,0x00,0x00,0x09,0x00,0x14,
+0x40,0x1b,0x00,0x10,0x07,0x94,0x00,0x04,0x1b,0x00,0x00,0xa1,0x00,0x14,0xf8,0xd8,
+0x00,0x63,0x03,0xef,0xff,0xff,0xfe,0x10,0x1b,0x00,0x10,0x29,0x2a,0x01,0x20,0x60,
+0x00,0x3d,0x01,0x21,0xbb,0xbc,0xa7,0x01,0x17,0xa0,0x5f,0x01,0x28,0xff,0xc0,0x5f,
+0x01,0x18,0xb0,0x7a,0x01,0x17,0x60,0x7a,0x01,0x25,0xf8,0x10,0x95,0x01,0x34,0xfe,
+0xb9,0x40,0xdc,0x00,0x04,0x01,0x00,0x16,0xef,0x0b,0x00,0x1f,0xfe,0x17,0x00,0x13,
+0x21,0xcb,0xbb,0x01,0x00,0x15,0xba,0xe7,0x00,0x15,0x00,0xbd,0x01,0x04,0x53,0x01,
+0x0f,0x17,0x00,0x26,0x20,0x98,0x88,0x01,0x00,0x17,0x85,0xa1,0x00,0x16,0x90,0xd5,
+0x00,0x1f,0xf9,0x17,0x00,0x14,0x0f,0x8a,0x00,0x32,0x0f,0x17,0x00,0x0f,0x22,0xfb,
+0xbb,0x01,0x00,0x1e,0xaf,0x42,0x01,0x0f,0x59,0x01,0x1f,0x16,0x4f,0x0b,0x00,0x1f,
+0xf4,0x17,0x00,0x13,0x03,0x87,0x01,0x1f,0xb3,0xe6,0x00,0x53,0x1f,0x60,0x87,0x01,
+0x1f,0x07,0x17,0x00,0x0f,0xa1,0x00,0x49,0x0f,0x17,0x00,0x2f,0x01,0x9b,0x06,0x54,
+0x8b,0xdf,0xff,0xec,0x96,0x12,0x00,0x12,0x6d,0xbc,0x00,0x21,0xa3,0x00,0x40,0x04,
+0x14,0xcf,0x49,0x03,0x01,0x29,0x00,0x08,0xd0,0x04,0x26,0x00,0x02,0xf4,0x00,0x00,
+0x5e,0x06,0x01,0xe0,0x06,0x21,0xdb,0xce,0xaf,0x01,0x01,0xd9,0x05,0x60,0xff,0xe6,
+0x10,0x00,0x02,0x9f,0xaa,0x06,0x01,0x79,0x04,0x14,0xd1,0xf8,0x06,0x25,0x30,0x07,
+0x2e,0x06,0x10,0x9f,0x3b,0x00,0x14,0xdf,0x04,0x06,0x10,0x02,0xd7,0x03,0x15,0x2f,
+0xf6,0x05,0x51,0x0c,0xee,0xee,0xed,0x05,0x3f,0x00,0x08,0x2f,0x06,0x16,0xfa,0x0e,
+0x00,0x10,0x0a,0xf8,0x04,0x0f,0x5a,0x06,0x05,0x12,0x0c,0x0a,0x04,0x21,0x01,0x33,
+0x01,0x00,0x20,0x30,0xcf,0x68,0x05,0x32,0x00,0x00,0x6f,0xb0,0x00,0x10,0x0c,0x4e,
+0x07,0x02,0xb2,0x04,0x00,0xd0,0x04,0x12,0xcf,0x3a,0x00,0x03,0x1d,0x00,0x12,0x0b,
+0x3a,0x00,0x04,0x1d,0x00,0x12,0xaf,0x9f,0x00,0x03,0x1d,0x00,0x14,0x08,0x87,0x06,
+0x01,0x52,0x01,0x20,0xf0,0x5f,0x96,0x05,0x05,0x55,0x01,0x01,0x9b,0x06,0x06,0x1d,
+0x00,0x15,0x0d,0x2c,0x00,0x00,0x1d,0x00,0x01,0x7a,0x06,0x15,0x40,0x1d,0x00,0x14,
+0x01,0x83,0x06,0x01,0x1d,0x01,0x01,0x15,0x05,0x60,0xff,0x92,0x00,0x00,0x00,0x6e,
+0x1d,0x00,0x21,0x00,0x0c,0x24,0x03,0x21,0xcb,0xbd,0x74,0x00,0x03,0x14,0x08,0x06,
+0xec,0x04,0x16,0x2d,0x0e,0x00,0x00,0x60,0x00,0x15,0x1a,0x55,0x03,0x11,0x50,0x84,
+0x08,0x1a,0xbf,0xc6,0x06,0x79,0x16,0xad,0xef,0xff,0xdc,0x96,0x10,0x04,0x02,0x4f,
+0x3f,0xff,0xff,0xfd,0x0e,0x00,0x98,0x03,0x89,0x03,0x12,0xcf,0x0e,0x00,0x06,0x01,
+0x00,0x0f,0x0e,0x00,0x29,0x0e,0x0a,0x01,0x0f,0x0e,0x00,0xaa,0x00,0x4a,0x09,0x0f,
+0x04,0x00,0x71,0x26,0x00,0x00,0x94,0x00,0x0f,0x0c,0x00,0xf5,0x44,0x07,0x77,0x77,
+0x77,0x0c,0x00,0x04,0x7d,0x05,0x00,0xa7,0x09,0x13,0x0e,0x12,0x04,0x00,0x07,0x05,
+0x12,0x0b,0xcd,0x03,0x00,0x17,0x04,0x22,0xf6,0x06,0x71,0x05,0x10,0x3d,0xe2,0x01,
+0x11,0x01,0x09,0x0c,0x11,0xbd,0x5a,0x06,0x06,0xbd,0x0a,0x44,0xfe,0x10,0x00,0x0b,
+0x0c,0x00,0x00,0x72,0x04,0x13,0xaf,0x17,0x00,0x23,0x30,0x00,0x06,0x0b,0x04,0x1a,
+0x05,0x68,0x04,0x8c,0xef,0xff,0xda,0x61,0xfc,0x03,0x18,0x8f,0xdd,0x09,0x01,0x7b,
+0x0c,0x14,0x50,0x0e,0x00,0x18,0x2e,0x8d,0x09,0x01,0x55,0x0b,0x14,0xb0,0x0e,0x00,
+0x12,0x0a,0x4d,0x0b,0x03,0x0e,0x00,0x12,0x6f,0xc2,0x05,0x03,0xc5,0x0a,0x12,0xff,
+0xc7,0x00,0x02,0x0e,0x00,0x13,0x1e,0x2d,0x06,0x02,0x0e,0x00,0x12,0xbf,0xb1,0x04,
+0x02,0x0e,0x00,0x12,0x08,0x44,0x00,0x03,0x0e,0x00,0x14,0x4f,0x06,0x06,0x01,0xe6,
+0x00,0x14,0xef,0x1d,0x05,0x00,0x0e,0x00,0x14,0x0c,0xde,0x0b,0x01,0x0e,0x00,0x13,
+0x8f,0x44,0x00,0x01,0x0e,0x00,0x25,0xf5,0xff,0x5c,0x01,0x07,0x69,0x0b,0x07,0xd7,
+0x09,0x19,0x50,0x0e,0x00,0x19,0xe1,0x0e,0x00,0x1a,0xfa,0x01,0x0a,0x15,0x40,0x0e,
+0x00,0x14,0xaf,0x2b,0x00,0x01,0x26,0x00,0x14,0x08,0x67,0x0d,0x02,0x6f,0x05,0x13,
+0xdf,0x2b,0x00,0x02,0x91,0x0d,0x11,0x3f,0xa4,0x0b,0x04,0xe0,0x00,0x13,0x09,0x2b,
+0x00,0x03,0x18,0x01,0x18,0xef,0x0a,0x01,0x22,0x00,0x4f,0xbd,0x06,0x07,0x42,0x01,
+0x15,0xf9,0x0e,0x00,0x01,0xf1,0x00,0x15,0x30,0x6c,0x01,0x11,0x6f,0x2b,0x00,0x04,
+0x0e,0x00,0x19,0x0b,0x3c,0x08,0x11,0x02,0x2a,0x06,0x05,0xc0,0x01,0x10,0x7f,0x2b,
+0x00,0x05,0x0e,0x00,0x50,0x0c,0xff,0xff,0xff,0xf8,0x52,0xff,0xff,0xff,0xf1,0x00,
+0x01,0x00,0x53,0x0f,0xff,0xff,0xff,0x10,0x0c,0x00,0x0f,0x17,0x00,0xff,0x1c,0x22,
+0xfb,0xbb,0x01,0x00,0x25,0x0f,0xff,0x01,0x00,0x26,0xf0,0xff,0x01,0x00,0x0f,0x17,
+0x00,0x14,0x23,0xf6,0x00,0x01,0x00,0x14,0x7f,0x17,0x00,0x14,0xfc,0x12,0x00,0x15,
+0xdf,0x2a,0x00,0x12,0x20,0x11,0x00,0x16,0x02,0x3c,0x00,0x12,0x70,0x12,0x00,0x16,
+0x08,0x12,0x00,0x12,0xd0,0x12,0x00,0x16,0x0d,0x12,0x00,0x12,0xf3,0x12,0x00,0x16,
+0x3f,0x12,0x00,0x12,0xf8,0x12,0x00,0x16,0x9f,0x12,0x00,0x12,0xfe,0x12,0x00,0x17,
+0xef,0xa2,0x00,0x10,0x40,0x11,0x00,0x15,0x04,0x0f,0x00,0x40,0xbf,0xff,0xff,0x90,
+0x12,0x00,0x42,0x0a,0xff,0xff,0xfb,0x12,0x00,0x43,0x7f,0xff,0xff,0xe0,0x10,0x01,
+0x12,0xe7,0x12,0x00,0x40,0x79,0xff,0xff,0xf5,0x12,0x00,0x42,0x5f,0xff,0xff,0x98,
+0x12,0x00,0x40,0x83,0xff,0xff,0xfa,0x12,0x00,0x42,0xbf,0xff,0xff,0x38,0x12,0x00,
+0x21,0x90,0xdf,0x3e,0x01,0x52,0x01,0xff,0xff,0xfd,0x09,0x12,0x00,0xc3,0xa0,0x8f,
+0xff,0xff,0x60,0x00,0x00,0x06,0xff,0xff,0xf7,0x0a,0x12,0x00,0xb2,0x2f,0xff,0xff,
+0xb0,0x00,0x00,0x0c,0xff,0xff,0xf2,0x0b,0x12,0x00,0x21,0xb0,0x0c,0x80,0x01,0x43,
+0x1f,0xff,0xff,0xc0,0x12,0x00,0x10,0xc0,0x30,0x00,0x01,0x2f,0x01,0x23,0x60,0x0c,
+0x12,0x00,0x10,0x01,0x35,0x01,0x00,0x2f,0x01,0x04,0xfe,0x00,0x10,0xd0,0x78,0x00,
+0x20,0x20,0x02,0x84,0x00,0x03,0x12,0x00,0x10,0xe0,0x9c,0x00,0x73,0x80,0x08,0xff,
+0xff,0xf4,0x00,0x0e,0x12,0x00,0x00,0xc0,0x00,0x23,0xd0,0x0e,0x09,0x00,0x01,0x90,
+0x01,0x60,0x00,0x09,0xff,0xff,0xf3,0x3f,0xf0,0x00,0x04,0x12,0x00,0x00,0x08,0x01,
+0x54,0xf9,0x9f,0xff,0xff,0x30,0x12,0x00,0x10,0xf1,0x2c,0x01,0x41,0xfe,0xef,0xff,
+0xfd,0x94,0x00,0x03,0x12,0x00,0x10,0x8f,0x08,0x00,0x18,0xf7,0x12,0x00,0x13,0x2f,
+0x08,0x00,0x06,0x12,0x00,0x11,0x0c,0xaa,0x00,0x08,0x12,0x00,0x10,0x06,0x08,0x00,
+0x18,0x60,0x12,0x00,0x10,0x01,0x08,0x00,0x18,0x00,0x12,0x00,0x00,0xc8,0x00,0x1a,
+0xfa,0x12,0x00,0x10,0x5f,0xc4,0x00,0x09,0x12,0x00,0x12,0x0f,0x90,0x01,0x07,0x12,
+0x00,0x12,0x09,0xb4,0x01,0x03,0x12,0x00,0x15,0xf6,0x08,0x02,0x10,0xfc,0xf2,0x01,
+0x18,0x10,0x0e,0x00,0x29,0xff,0x90,0x0e,0x00,0x19,0xf3,0x0e,0x00,0x19,0xfd,0x0e,
+0x00,0x29,0xff,0x70,0x0e,0x00,0x19,0xf1,0x0e,0x00,0x19,0xfa,0x0e,0x00,0x29,0xff,
+0x40,0x0e,0x00,0x19,0xd0,0x0e,0x00,0x19,0xf8,0x0e,0x00,0x25,0xff,0x20,0x0e,0x00,
+0x10,0xf7,0xf0,0x01,0x05,0x0e,0x00,0x21,0xf1,0xcf,0x55,0x02,0x04,0x0e,0x00,0x11,
+0x2f,0xac,0x02,0x04,0x0e,0x00,0x00,0xf8,0x02,0x15,0x80,0x0e,0x00,0x00,0xbf,0x02,
+0x16,0xf2,0x0e,0x00,0x10,0x5f,0x0f,0x02,0x05,0x0e,0x00,0x10,0x0b,0x66,0x01,0x05,
+0x0e,0x00,0x00,0x43,0x03,0x15,0xe1,0x0e,0x00,0x00,0x46,0x02,0x16,0xf9,0x0e,0x00,
+0x12,0x0d,0xdd,0x02,0x03,0x0e,0x00,0x13,0x04,0x8f,0x03,0x03,0xec,0x00,0x19,0xaf,
+0x0e,0x00,0x19,0x1f,0x0e,0x00,0x19,0x06,0x0e,0x00,0x29,0x00,0xcf,0x0e,0x00,0x19,
+0x3f,0x0e,0x00,0x19,0x09,0x0e,0x00,0x28,0x01,0xef,0x0e,0x00,0x29,0x00,0x6f,0x0e,
+0x00,0x19,0x0c,0x0e,0x00,0x19,0x02,0x0e,0x00,0x23,0x00,0x8f,0x29,0x04,0x64,0x02,
+0x7a,0xde,0xff,0xdb,0x72,0x33,0x04,0x21,0x04,0xcf,0x8a,0x00,0x12,0xc5,0x0e,0x00,
+0x23,0x01,0xaf,0x64,0x01,0x11,0xb1,0x0f,0x00,0x15,0x2d,0xf5,0x03,0x14,0x30,0x7b,
+0x00,0x02,0x01,0x00,0x23,0xe2,0x00,0xa0,0x02,0x24,0xff,0xef,0xf7,0x01,0x10,0x7f,
+0xa9,0x01,0x32,0x20,0x00,0x27,0x23,0x02,0x10,0x01,0x35,0x00,0x00,0x85,0x04,0x20,
+0x1d,0xff,0x6a,0x01,0x11,0x08,0x06,0x00,0x03,0x44,0x00,0x11,0xf9,0x51,0x03,0x15,
+0x80,0xc0,0x00,0x25,0x00,0x3f,0x27,0x05,0x10,0x0e,0x0a,0x02,0x64,0x7f,0xff,0xff,
+0xfb,0x00,0x00,0xfb,0x00,0x25,0x90,0xaf,0x86,0x04,0x10,0x06,0xef,0x01,0x02,0xe5,
+0x01,0x00,0x01,0x00,0x10,0x03,0x94,0x03,0x15,0xef,0xb6,0x04,0x13,0x02,0x21,0x05,
+0x13,0xf2,0xcb,0x00,0x0a,0x0f,0x00,0x01,0x97,0x05,0x0e,0x0f,0x00,0x08,0x2d,0x00,
+0x0b,0x4b,0x00,0x1a,0xdf,0x69,0x00,0x0a,0x87,0x00,0x1b,0xc0,0xa5,0x00,0x0a,0xc3,
+0x00,0x16,0x50,0xe1,0x00,0x10,0x5f,0xe1,0x00,0x09,0xff,0x00,0x16,0xfa,0x1d,0x01,
+0x12,0x1c,0x41,0x03,0x10,0x7f,0xcb,0x02,0x40,0x10,0x00,0x16,0xef,0xd1,0x04,0x03,
+0x59,0x01,0x33,0xfe,0xde,0xff,0x7b,0x03,0x07,0x77,0x01,0x19,0xf3,0x95,0x01,0x29,
+0xff,0x30,0xb3,0x01,0x19,0xc2,0xd1,0x01,0x14,0xd5,0xe1,0x01,0x64,0x02,0x7a,0xdf,
+0xff,0xeb,0x83,0xf4,0x00,0x01,0xae,0x01,0x10,0xb8,0x39,0x00,0x06,0x57,0x06,0x16,
+0xd6,0x1b,0x00,0x00,0x32,0x02,0x17,0x10,0x1b,0x00,0x00,0xa7,0x00,0x17,0xff,0x0e,
+0x00,0x10,0x10,0x1b,0x00,0x42,0xcc,0xcc,0xcc,0xcd,0xc2,0x03,0x03,0x5d,0x02,0x20,
+0x01,0x7f,0xe0,0x00,0x05,0xed,0x06,0x10,0x4f,0x11,0x01,0x04,0x78,0x02,0x00,0x3b,
+0x06,0x15,0xfd,0x1b,0x00,0x04,0xa4,0x01,0x15,0xf1,0x1f,0x07,0x15,0x2f,0x39,0x01,
+0x00,0x44,0x00,0x09,0x1b,0x00,0x14,0x1f,0x1b,0x00,0x18,0x05,0x36,0x00,0x00,0x0f,
+0x01,0x14,0xfb,0x51,0x00,0x20,0x05,0xef,0xac,0x03,0x00,0xb6,0x00,0x41,0xbb,0xbb,
+0xbb,0xcf,0x3a,0x04,0x17,0x0f,0xb0,0x00,0x18,0xf4,0xbd,0x00,0x18,0xf5,0xd8,0x00,
+0x17,0xe4,0xf3,0x00,0x25,0xfe,0x81,0x0e,0x01,0x3b,0xfe,0xdb,0x84,0xc3,0x07,0x0a,
+0xc5,0x07,0x0f,0x1b,0x00,0x76,0x01,0x01,0x00,0x6b,0x27,0xbd,0xff,0xfd,0xb7,0x20,
+0xca,0x03,0x13,0xc4,0x0f,0x00,0x13,0x1b,0xde,0x00,0x12,0xfb,0x35,0x00,0x17,0x2e,
+0xd2,0x01,0x08,0x0f,0x00,0x02,0x10,0x00,0x1a,0x0d,0xcc,0x03,0x01,0x25,0x08,0x31,
+0x72,0x00,0x02,0xd4,0x03,0x02,0x1e,0x03,0x23,0xfd,0x20,0x7b,0x02,0x12,0xf2,0xbe,
+0x06,0x01,0x46,0x00,0x11,0x2f,0xe7,0x02,0x15,0x0e,0x5e,0x08,0x10,0x7f,0x73,0x05,
+0x11,0x04,0x07,0x07,0x04,0xc1,0x00,0x33,0xf4,0x00,0x8f,0xec,0x05,0x01,0x11,0x08,
+0x36,0xff,0x80,0x0b,0x8c,0x08,0x01,0x44,0x03,0x12,0xdf,0x9e,0x06,0x03,0x42,0x08,
+0x26,0xd0,0x0f,0xbd,0x08,0x00,0x5e,0x00,0x01,0x16,0x02,0x07,0x95,0x03,0x07,0x06,
+0x01,0x13,0x1f,0x1f,0x00,0x17,0xf1,0xc3,0x03,0x0f,0x3e,0x00,0x0c,0x14,0x0d,0xad,
+0x08,0x01,0xa5,0x02,0x10,0xfd,0x2c,0x07,0x12,0xf7,0x0f,0x00,0x10,0x07,0x5b,0x04,
+0x12,0x08,0x4f,0x06,0x12,0x00,0xbc,0x05,0x11,0xf8,0xc9,0x02,0x06,0x7d,0x01,0x10,
+0x40,0x35,0x06,0x15,0xf7,0x02,0x04,0x1c,0xe0,0xd5,0x04,0x01,0x72,0x00,0x10,0xd1,
+0x0f,0x00,0x12,0xcf,0xa5,0x00,0x17,0x8f,0xd7,0x03,0x14,0x80,0x9e,0x09,0x24,0xed,
+0xef,0xe0,0x06,0x16,0x02,0xd8,0x03,0x29,0xe1,0x00,0x10,0x00,0x12,0xd2,0xd1,0x00,
+0x13,0xbf,0x0f,0x00,0x13,0xf9,0xd2,0x01,0x16,0x4c,0xa2,0x03,0x02,0xd3,0x00,0x44,
+0x7b,0xdf,0xfe,0xdf,0x9d,0x05,0x26,0x00,0x00,0xb2,0x05,0x16,0x60,0x10,0x00,0x25,
+0x0b,0xff,0x8a,0x04,0x05,0xff,0x09,0x16,0xd1,0x43,0x02,0x00,0x5b,0x03,0x18,0xc1,
+0x53,0x02,0x39,0x02,0xdf,0xa0,0x63,0x02,0x25,0x01,0x70,0x29,0x03,0x39,0xed,0xa7,
+0x20,0x37,0x04,0x19,0xc4,0x37,0x04,0x18,0xfa,0x1b,0x00,0x00,0x69,0x06,0x18,0xff,
+0x1c,0x00,0x00,0x1b,0x00,0x42,0xcb,0xbb,0xbb,0xce,0xc5,0x04,0x03,0xb5,0x01,0x20,
+0x03,0xcf,0xf0,0x04,0x05,0xd2,0x01,0x18,0xcf,0xd0,0x01,0x19,0x02,0x52,0x04,0x01,
+0xb8,0x01,0x04,0xeb,0x01,0x00,0xb6,0x01,0x15,0xf5,0x1b,0x00,0x19,0x0b,0x1b,0x00,
+0x1c,0xef,0x88,0x04,0x05,0x51,0x00,0x17,0x2e,0x6c,0x00,0x24,0x03,0x8f,0x87,0x00,
+0x15,0xff,0x63,0x01,0x07,0xbd,0x00,0x18,0xfb,0xbd,0x00,0x1e,0xf9,0xf3,0x00,0x07,
+0x1b,0x0b,0x02,0xd8,0x00,0x13,0xbc,0x65,0x00,0x02,0x07,0x00,0x12,0x0e,0x24,0x09,
+0x03,0x6c,0x00,0x12,0x6f,0x92,0x02,0x03,0x22,0x00,0x15,0xdf,0x29,0x01,0x12,0x10,
+0xd7,0x04,0x15,0xf2,0x1b,0x00,0x11,0x0d,0x7d,0x02,0x04,0xbd,0x00,0x11,0x4f,0xdf,
+0x05,0x07,0x1f,0x08,0x15,0xfb,0x1b,0x00,0x14,0x04,0xd9,0x04,0x14,0xf1,0x00,0x01,
+0x15,0xc0,0xf3,0x00,0x10,0x3f,0x7d,0x06,0x08,0x29,0x01,0x06,0x7b,0x05,0x23,0x03,
+0xff,0xd0,0x06,0x35,0x16,0xac,0xef,0x00,0x08,0x22,0x04,0xbf,0xaf,0x01,0x14,0x40,
+0x9f,0x03,0x05,0xfd,0x07,0x15,0x1d,0xe8,0x00,0x14,0xd1,0xeb,0x07,0x02,0x3b,0x0b,
+0x02,0xbb,0x08,0x32,0xfc,0xaa,0xcf,0x5a,0x02,0x12,0xdf,0xcf,0x03,0x10,0x06,0xbd,
+0x02,0x01,0x02,0x03,0x13,0x50,0x6c,0x00,0x11,0xf6,0xcf,0x03,0x05,0x21,0x07,0x13,
+0x4f,0x30,0x07,0x00,0x11,0x07,0x11,0xfb,0x51,0x07,0x01,0x5f,0x02,0x55,0x55,0x55,
+0x55,0x40,0x0f,0x55,0x0a,0x04,0x6b,0x0c,0x15,0xc3,0x7f,0x02,0x01,0x6c,0x00,0x26,
+0x61,0x00,0x21,0x04,0x06,0x0f,0x00,0x13,0x04,0xae,0x01,0x12,0x40,0xb9,0x02,0x12,
+0xcf,0x0f,0x00,0x12,0xd4,0x1d,0x00,0x19,0x5c,0xfd,0x04,0x22,0x03,0xaf,0xf9,0x06,
+0x13,0x20,0xf5,0x02,0x11,0xaf,0x0e,0x00,0x14,0x10,0x04,0x03,0x17,0xbf,0x65,0x03,
+0x37,0x00,0x00,0x3d,0x26,0x08,0x02,0x08,0x01,0x14,0x75,0x18,0x04,0x00,0xb2,0x04,
+0x11,0xfa,0x3a,0x04,0x04,0x81,0x00,0x15,0xc1,0x2d,0x00,0x00,0xd8,0x00,0x12,0x0c,
+0xb2,0x0b,0x02,0x31,0x01,0x23,0xa0,0x6f,0x8f,0x00,0x11,0x2b,0x52,0x0b,0x10,0xcf,
+0xaa,0x03,0x21,0xba,0x9a,0x05,0x04,0x08,0xfc,0x03,0x28,0xff,0x60,0x0e,0x00,0x17,
+0x90,0xd1,0x07,0x02,0x27,0x05,0x13,0x3a,0x44,0x03,0x12,0x20,0x11,0x01,0x90,0x59,
+0xce,0xff,0xfe,0xc9,0x61,0x00,0x00,0x00,0x28,0x1f,0xff,0x01,0x00,0x19,0xb1,0x0e,
+0x00,0x1f,0xfb,0x1d,0x00,0x18,0x20,0xb0,0xbb,0x01,0x00,0x40,0xef,0xff,0xff,0xfc,
+0x08,0x00,0x20,0xb8,0x00,0x01,0x00,0x65,0x0c,0xff,0xff,0xff,0x40,0x00,0x01,0x00,
+0x46,0xcf,0xff,0xff,0xf4,0x0e,0x00,0x0f,0x1d,0x00,0xff,0x62,0x41,0x4f,0xff,0xff,
+0xfc,0x09,0x00,0x91,0x02,0xff,0xff,0xff,0xe4,0xff,0xff,0xff,0xc0,0x0e,0x00,0x4f,
+0x2f,0xff,0xff,0xfe,0x1b,0x00,0xff,0x05,0x95,0x03,0xff,0xff,0xff,0xd2,0xff,0xff,
+0xff,0xd0,0x40,0x01,0x00,0xf7,0x02,0x10,0x10,0x0d,0x00,0x91,0x07,0xff,0xff,0xff,
+0xa0,0xdf,0xff,0xff,0xf7,0x1b,0x00,0x90,0xdf,0xff,0xff,0xf6,0x08,0xff,0xff,0xff,
+0xf2,0x0d,0x00,0xe0,0x8f,0xff,0xff,0xff,0x20,0x2f,0xff,0xff,0xff,0xf6,0x00,0x00,
+0x02,0xaf,0x1e,0x03,0x20,0x00,0xaf,0x25,0x03,0x20,0xcb,0xbd,0x06,0x00,0x45,0xf3,
+0x00,0x01,0xdf,0x38,0x03,0x54,0xf8,0x00,0x00,0x02,0xef,0x0d,0x00,0x63,0xf9,0x00,
+0x00,0x00,0x01,0xbf,0x0d,0x00,0x02,0x58,0x00,0x12,0x6d,0x0d,0x00,0x22,0xa2,0x00,
+0x8f,0x00,0x50,0x7b,0xde,0xff,0xec,0x95,0x7f,0x00,0x14,0xaf,0x87,0x00,0x02,0xee,
+0x01,0x62,0xf1,0x4f,0xff,0xff,0xff,0x60,0x10,0x00,0x10,0x1f,0x71,0x00,0x11,0x0e,
+0x76,0x00,0x01,0x01,0x00,0xa2,0x5f,0xff,0xff,0xff,0x50,0x09,0xff,0xff,0xff,0xf0,
+0x10,0x00,0x00,0x3b,0x00,0x35,0x00,0x04,0xff,0x32,0x02,0x72,0xff,0xff,0xff,0xfa,
+0x00,0x00,0xef,0x7f,0x00,0x14,0x00,0x1a,0x00,0x41,0x9f,0xff,0xff,0xfe,0x10,0x00,
+0x00,0xd6,0x00,0x80,0xe0,0x00,0x00,0x3f,0xff,0xff,0xff,0x30,0x10,0x00,0x52,0x0d,
+0xff,0xff,0xff,0x90,0x07,0x00,0x13,0x70,0x30,0x01,0x00,0x19,0x00,0x14,0x08,0x41,
+0x01,0x12,0x7f,0x39,0x00,0x10,0x02,0x96,0x00,0x03,0x7e,0x02,0x14,0xf8,0x22,0x01,
+0x00,0xe0,0x00,0x01,0x02,0x01,0x01,0x28,0x00,0x00,0x77,0x00,0x24,0x00,0x05,0x5e,
+0x01,0x10,0x2f,0x97,0x00,0x77,0x00,0x00,0x0a,0xff,0xff,0xff,0x80,0xc5,0x02,0x10,
+0x0e,0x4c,0x01,0x04,0x70,0x01,0x17,0x90,0xc4,0x02,0x12,0x01,0x98,0x00,0x14,0x8f,
+0x2a,0x01,0x21,0x00,0xbf,0x7e,0x01,0x13,0xdf,0x77,0x00,0x30,0x00,0x00,0x6f,0x1a,
+0x00,0x15,0x02,0xd8,0x01,0x20,0x00,0x1f,0x3a,0x00,0x16,0x07,0x28,0x01,0x10,0x0b,
+0x43,0x01,0x16,0x0b,0x48,0x01,0x10,0x05,0x28,0x01,0x44,0x1f,0xff,0xff,0xfb,0x38,
+0x03,0x00,0xe1,0x01,0x65,0x5f,0xff,0xff,0xf5,0x00,0x00,0x39,0x01,0x25,0xf0,0xaf,
+0x47,0x01,0x01,0x8b,0x00,0x53,0xf4,0xef,0xff,0xff,0xa0,0x10,0x00,0x00,0xab,0x00,
+0x18,0xfc,0x7a,0x03,0x00,0x74,0x01,0x04,0x46,0x01,0x04,0x5a,0x01,0x04,0x66,0x01,
+0x01,0x01,0x00,0x01,0xf9,0x01,0x07,0xb8,0x03,0x22,0x9f,0xff,0xd4,0x00,0x04,0x01,
+0x00,0x22,0x3f,0xff,0xf4,0x00,0x04,0x01,0x00,0x24,0x0d,0xff,0x85,0x01,0x15,0x00,
+0x9b,0x01,0x16,0xfd,0x0f,0x00,0x01,0xed,0x00,0x15,0xf8,0xed,0x00,0x14,0xfe,0xc5,
+0x00,0x13,0x20,0x6c,0x00,0x23,0xf1,0x0d,0xed,0x00,0x10,0x04,0xea,0x00,0x04,0x43,
+0x01,0x13,0x09,0xb3,0x00,0x13,0x08,0x6c,0x00,0x10,0x04,0xf7,0x00,0x13,0x06,0xde,
+0x01,0x13,0x0b,0x9e,0x01,0x10,0x07,0x10,0x00,0x13,0x02,0x54,0x02,0x13,0x0f,0xdb,
+0x01,0x11,0x0a,0x8e,0x00,0x03,0xb3,0x00,0x13,0x3f,0xcb,0x00,0x11,0x0d,0xc7,0x01,
+0x12,0xbf,0x22,0x00,0x13,0x7f,0x91,0x00,0x11,0x0f,0xb5,0x01,0x12,0x8f,0x22,0x00,
+0x10,0xaf,0x3e,0x06,0x02,0x32,0x00,0x11,0xf8,0x45,0x01,0x14,0xf7,0x0b,0x01,0x02,
+0xb5,0x01,0x11,0xf5,0xbe,0x00,0x12,0xfa,0xcf,0x00,0x01,0xf0,0x00,0x11,0x9f,0x4e,
+0x00,0x11,0x0d,0xed,0x00,0x11,0x05,0x15,0x00,0x11,0x60,0x58,0x02,0x12,0xe0,0x64,
+0x01,0x01,0x06,0x00,0x11,0xfe,0x89,0x01,0x11,0xff,0x06,0x00,0x10,0x06,0x37,0x00,
+0x00,0x30,0x00,0x10,0xba,0x24,0x00,0x12,0x02,0xcc,0x00,0x10,0x02,0x37,0x00,0x00,
+0x5a,0x00,0x10,0x76,0x4e,0x00,0x13,0x05,0x4a,0x01,0x00,0xf5,0x00,0x00,0x84,0x00,
+0x10,0x32,0x78,0x00,0x00,0x03,0x01,0x03,0x4a,0x02,0x10,0xc0,0xae,0x00,0x63,0x00,
+0xef,0xff,0xf9,0x00,0x0b,0x71,0x02,0x10,0x8f,0xfa,0x01,0x93,0xcf,0xff,0xfb,0x00,
+0xbf,0xff,0xfc,0x00,0x0e,0x69,0x01,0x10,0x4f,0x74,0x02,0x30,0xff,0xff,0xf8,0xea,
+0x00,0x23,0x00,0x1f,0x2c,0x02,0x00,0x08,0x00,0x40,0x03,0xff,0xff,0xf4,0xe2,0x00,
+0x22,0x40,0x4f,0x90,0x02,0x00,0x8e,0x00,0x50,0xf8,0x07,0xff,0xff,0xf0,0x0c,0x01,
+0x22,0x70,0x7f,0xe7,0x01,0x00,0xb8,0x00,0x50,0xfc,0x0b,0xff,0xff,0xc0,0x65,0x00,
+0x23,0xb0,0xaf,0x4b,0x02,0x00,0xbe,0x00,0x10,0x0e,0x05,0x03,0x00,0x2f,0x00,0x13,
+0xdf,0x66,0x03,0x00,0xbe,0x00,0x40,0x4f,0xff,0xff,0x40,0x92,0x04,0x14,0xf3,0x06,
+0x02,0x00,0xbe,0x00,0x31,0xbf,0xff,0xff,0x09,0x00,0x13,0xf9,0xbc,0x00,0x01,0xbe,
+0x00,0x02,0xb3,0x00,0x05,0x09,0x00,0x03,0x93,0x04,0x23,0xff,0xf8,0x93,0x01,0x04,
+0x25,0x02,0x14,0x4f,0x80,0x02,0x01,0x09,0x00,0x16,0xf5,0x3f,0x04,0x01,0xb3,0x00,
+0x14,0x0f,0x09,0x00,0x04,0x7a,0x02,0x13,0xc0,0x96,0x03,0x27,0xff,0xe0,0xe0,0x02,
+0x13,0x90,0x3b,0x02,0x04,0x07,0x03,0x23,0x06,0xff,0x5d,0x02,0x13,0x04,0xa8,0x01,
+0x04,0xbe,0x00,0x02,0x67,0x03,0x08,0xc2,0x02,0x14,0xef,0xbe,0x02,0x15,0xcf,0xbc,
+0x00,0x01,0xb5,0x00,0x14,0xf9,0xb2,0x00,0x13,0xfc,0x56,0x03,0x25,0xff,0xf2,0x70,
+0x00,0x22,0xf7,0x05,0xaf,0x04,0x03,0x31,0x04,0x34,0xd0,0x00,0xbf,0x51,0x00,0x11,
+0xbf,0xc8,0x02,0x13,0x2f,0xa8,0x00,0x12,0x03,0x27,0x00,0x13,0x09,0xe1,0x00,0x12,
+0x0c,0x45,0x00,0x13,0x01,0x73,0x00,0x13,0x5f,0x65,0x04,0x12,0x6f,0xac,0x00,0x13,
+0xdf,0x2d,0x03,0x11,0x0c,0xdc,0x00,0x14,0x06,0x0c,0x01,0x11,0x03,0x86,0x05,0x06,
+0x4a,0x05,0x00,0x13,0x05,0x24,0x10,0x7f,0x51,0x03,0x01,0x29,0x01,0x16,0x81,0x4d,
+0x01,0x10,0x07,0x72,0x00,0x07,0xc0,0x03,0x03,0xe4,0x05,0x16,0x60,0x2d,0x04,0x06,
+0x8e,0x01,0x02,0x3c,0x03,0x03,0x09,0x05,0x04,0xcd,0x04,0x08,0xeb,0x03,0x15,0x8f,
+0x31,0x01,0x05,0xb3,0x05,0x2a,0xff,0x30,0x48,0x04,0x19,0xc0,0x16,0x04,0x24,0xff,
+0xf6,0x0f,0x00,0x19,0x7f,0x76,0x04,0x13,0x01,0x4e,0x06,0x16,0x90,0x77,0x00,0x15,
+0xf9,0x51,0x01,0x01,0xb5,0x03,0x25,0x70,0xef,0x97,0x00,0x01,0x08,0x01,0x03,0x14,
+0x01,0x02,0xca,0x01,0x34,0xf6,0x00,0x0d,0xd3,0x00,0x11,0x1e,0x6f,0x01,0x14,0x04,
+0xf1,0x00,0x12,0x9f,0x37,0x04,0x12,0xcf,0x0f,0x01,0x16,0x03,0xd4,0x03,0x22,0xff,
+0xb0,0x49,0x01,0x13,0xf3,0x6f,0x00,0x12,0xf5,0x67,0x01,0x13,0xa0,0x07,0x02,0x11,
+0xfe,0x85,0x01,0x24,0xff,0x10,0xe6,0x00,0x25,0x80,0x09,0x43,0x01,0x10,0x1e,0x99,
+0x00,0x15,0x3f,0x43,0x01,0x10,0x07,0x54,0x00,0x00,0xd6,0x01,0x06,0xf6,0x00,0x24,
+0xf5,0x2f,0x76,0x06,0x01,0x63,0x00,0x25,0xd0,0x0a,0x2d,0x00,0x10,0x3f,0xb6,0x00,
+0x15,0x02,0xc6,0x02,0x11,0xbf,0xd4,0x00,0x13,0xaf,0xda,0x00,0x12,0x02,0x06,0x02,
+0x13,0x2f,0xea,0x04,0x12,0x09,0x3e,0x01,0x13,0x09,0xd9,0x01,0x12,0x1f,0x5c,0x01,
+0x13,0x01,0x17,0x01,0x13,0x8f,0x02,0x06,0x12,0x8f,0x68,0x02,0x13,0xef,0xa6,0x01,
+0x02,0xf8,0x07,0x14,0x07,0x0d,0x02,0x11,0x08,0x42,0x02,0x05,0x9d,0x06,0x11,0x01,
+0x5f,0x07,0x14,0x5f,0x9b,0x02,0x00,0x85,0x01,0x10,0xf7,0x4f,0x01,0x15,0xf2,0x1a,
+0x06,0x11,0xfe,0x58,0x05,0x06,0x2b,0x02,0x15,0x5b,0x48,0x02,0x01,0x64,0x00,0x05,
+0x7f,0x07,0x03,0x96,0x02,0x05,0x7a,0x03,0x02,0x01,0x03,0x03,0x14,0x07,0x05,0x61,
+0x03,0x07,0x1c,0x02,0x16,0xdf,0x83,0x02,0x04,0xee,0x07,0x1a,0xf1,0x33,0x06,0x1a,
+0x80,0x1a,0x0a,0x1f,0x60,0x0f,0x00,0x97,0x18,0x4f,0x63,0x0c,0x18,0x54,0x0d,0x00,
+0x1f,0xf5,0x1b,0x00,0x14,0x33,0xfe,0x13,0xbb,0x01,0x00,0x14,0xdf,0xd8,0x02,0x04,
+0x54,0x01,0x18,0xa0,0x8c,0x03,0x05,0x76,0x07,0x18,0x05,0x93,0x07,0x28,0x01,0xef,
+0x5c,0x01,0x18,0xbf,0x6e,0x07,0x18,0x7f,0x92,0x03,0x06,0x97,0x02,0x03,0x73,0x01,
+0x18,0xc0,0xa3,0x07,0x18,0xf2,0xb9,0x03,0x18,0xf6,0xfe,0x07,0x18,0xfb,0xe2,0x03,
+0x28,0xfe,0x10,0xc4,0x01,0x05,0x46,0x08,0x18,0x1e,0x19,0x04,0x04,0x90,0x07,0x05,
+0x47,0x02,0x1e,0xf3,0xfc,0x07,0x03,0x15,0x02,0x19,0xfd,0x4d,0x04,0x27,0x20,0x00,
+0x88,0x04,0x18,0x70,0x07,0x01,0x18,0xc0,0x07,0x01,0x18,0xf1,0x07,0x01,0x14,0xfe,
+0x3b,0x01,0x28,0x71,0xef,0xf9,0x0d,0x09,0x7a,0x01,0x2f,0xb4,0xff,0x1b,0x00,0x14,
+0x11,0x3f,0xf0,0x04,0x01,0x0c,0x00,0x0f,0x0b,0x00,0x01,0x30,0xb4,0x43,0x3f,0x02,
+0x03,0x11,0x03,0xed,0x00,0x0f,0x0b,0x00,0xab,0x3f,0xfb,0x44,0x33,0xe7,0x00,0x03,
+0x50,0xff,0xff,0xff,0xff,0xff,0x52,0xcf,0xff,0xff,0xf1,0x00,0x01,0x00,0x43,0x6f,
+0xff,0xff,0xf7,0x0b,0x00,0x43,0x1f,0xff,0xff,0xfd,0x0b,0x00,0x52,0x0a,0xff,0xff,
+0xff,0x40,0x0b,0x00,0x53,0x04,0xff,0xff,0xff,0xa0,0x17,0x00,0x43,0xef,0xff,0xff,
+0xf0,0x0b,0x00,0x43,0x8f,0xff,0xff,0xf6,0x0b,0x00,0x43,0x2f,0xff,0xff,0xfc,0x0b,
+0x00,0x52,0x0c,0xff,0xff,0xff,0x20,0x0b,0x00,0x53,0x06,0xff,0xff,0xff,0x80,0x17,
+0x00,0x43,0xff,0xff,0xff,0xe0,0x0b,0x00,0x43,0xaf,0xff,0xff,0xf4,0x0b,0x00,0x43,
+0x4f,0xff,0xff,0xfa,0x0b,0x00,0x52,0x0d,0xff,0xff,0xff,0x10,0x0b,0x00,0x52,0x07,
+0xff,0xff,0xff,0x60,0x0b,0x00,0x53,0x01,0xff,0xff,0xff,0xc0,0x22,0x00,0x43,0xbf,
+0xff,0xff,0xf3,0x0b,0x00,0x43,0x5f,0xff,0xff,0xf9,0x0b,0x00,0x43,0x0f,0xff,0xff,
+0xfe,0x0b,0x00,0x52,0x09,0xff,0xff,0xff,0x50,0x0b,0x00,0x53,0x03,0xff,0xff,0xff,
+0xb0,0x17,0x00,0x16,0xdf,0xeb,0x00,0x1f,0x7f,0xeb,0x00,0x02,0x52,0x0b,0xff,0xff,
+0xff,0x30,0x0b,0x00,0x5e,0x05,0xff,0xff,0xff,0x90,0xeb,0x00,0x4f,0x9f,0xff,0xff,
+0xf5,0xeb,0x00,0x15,0x1f,0x01,0xeb,0x00,0x0e,0x16,0x0e,0xeb,0x00,0x16,0x08,0xeb,
+0x00,0x17,0x02,0xeb,0x00,0xa0,0x68,0x88,0x88,0x70,0xbf,0xff,0xff,0xff,0xff,0x7b,
+0x05,0x00,0x1c,0xf7,0x0b,0x00,0x30,0x72,0x44,0x8f,0xc9,0x00,0x00,0xad,0x00,0x3f,
+0x70,0x00,0x5f,0x0b,0x00,0xab,0x2e,0x24,0x48,0xe7,0x00,0x09,0x0b,0x00,0x02,0x74,
+0x01,0x14,0x20,0xe2,0x01,0x15,0xf9,0x50,0x02,0x14,0xf0,0xbe,0x02,0x24,0xff,0x60,
+0x8e,0x01,0x14,0xfd,0xfc,0x01,0x22,0xff,0xf3,0x7f,0x01,0x11,0xfc,0xba,0x02,0x00,
+0xed,0x01,0x10,0x1f,0x74,0x01,0x00,0x5b,0x02,0x41,0xa0,0xaf,0xff,0xf7,0x16,0x02,
+0x50,0xf4,0x04,0xff,0xff,0xd0,0x99,0x01,0x30,0xfd,0x00,0x0d,0xec,0x02,0x10,0x0b,
+0xc3,0x01,0x30,0x7f,0xff,0xfb,0xc2,0x01,0x30,0xf2,0x00,0x01,0x36,0x02,0x41,0x8f,
+0xff,0xfb,0x00,0x18,0x00,0x11,0x0e,0x5a,0x02,0x42,0x5f,0xff,0xfe,0x05,0x78,0x00,
+0x62,0xef,0xff,0xf5,0xcf,0xff,0xf9,0x92,0x00,0x25,0xc0,0x55,0x01,0x00,0x25,0x51,
+0xff,0x01,0x00,0x1f,0xf6,0x0b,0x00,0x19,0x80,0x35,0x55,0x55,0x53,0x00,0x00,0x02,
+0xef,0x79,0x00,0x01,0xc0,0x00,0x12,0xc0,0x76,0x03,0x11,0x60,0x5a,0x02,0x21,0xfe,
+0x10,0x29,0x02,0x12,0xfa,0x96,0x03,0x12,0xf4,0xb2,0x02,0x10,0xe0,0xae,0x02,0x55,
+0x9c,0xef,0xfe,0xc8,0x30,0x49,0x02,0x40,0xff,0xff,0xfc,0x30,0x00,0x01,0x13,0xef,
+0x56,0x00,0x02,0x3a,0x01,0x02,0x01,0x00,0x11,0x50,0x08,0x03,0x02,0x01,0x00,0x11,
+0xe1,0x7f,0x01,0x40,0xf8,0x21,0x26,0xef,0x5f,0x01,0x12,0x0a,0x1e,0x00,0x10,0x4f,
+0xd8,0x02,0x43,0x0b,0xee,0xee,0xee,0x8c,0x03,0x17,0x00,0x1d,0x03,0x17,0x10,0x14,
+0x04,0x00,0x89,0x01,0x21,0x37,0xad,0x63,0x00,0x00,0x0c,0x00,0x14,0x5d,0x55,0x00,
+0x11,0x20,0x2a,0x00,0x04,0x0c,0x00,0x16,0xcf,0x0c,0x00,0x10,0x07,0x6c,0x00,0x12,
+0x30,0x3c,0x00,0x12,0x0e,0x6a,0x03,0x01,0x0c,0x00,0x15,0x3f,0xd2,0x00,0x32,0xff,
+0x20,0x5f,0xae,0x00,0x01,0x0c,0x00,0x03,0x8f,0x04,0x01,0x5d,0x03,0x12,0x4f,0xd3,
+0x01,0x10,0xaf,0x0c,0x00,0x71,0x1f,0xff,0xff,0xff,0xd6,0x44,0x8e,0x54,0x00,0x26,
+0x0b,0xff,0x60,0x00,0x16,0x02,0x0c,0x00,0x31,0x40,0x00,0x4f,0x08,0x00,0x11,0xfe,
+0x3b,0x01,0x11,0x03,0xf1,0x00,0x12,0x73,0xd2,0x03,0x50,0x05,0xad,0xff,0xeb,0x71,
+0xd3,0x03,0x26,0xe0,0x6f,0xb7,0x04,0x1f,0x00,0x0c,0x00,0x5e,0x43,0x6b,0xef,0xec,
+0x83,0x0c,0x00,0x10,0x4e,0x9e,0x00,0x11,0xa1,0x0c,0x00,0x11,0xfb,0xb6,0x00,0x45,
+0xfd,0x10,0x00,0x6f,0xcb,0x00,0x17,0xd0,0x0c,0x00,0x12,0xf8,0x0c,0x00,0x30,0xb9,
+0x9d,0xff,0x8c,0x01,0x12,0x6f,0x37,0x00,0x10,0x5f,0x42,0x03,0x12,0x6f,0x8d,0x04,
+0x10,0x06,0x32,0x02,0x04,0x6c,0x00,0x00,0xb7,0x04,0x03,0x0c,0x00,0x00,0x39,0x01,
+0x13,0xf3,0x0c,0x00,0x00,0xfc,0x04,0x14,0xf5,0x0c,0x00,0x1a,0x5f,0x0c,0x00,0x1f,
+0xf6,0x0c,0x00,0x0d,0x08,0x3c,0x00,0x17,0x9f,0x54,0x00,0x03,0x6c,0x00,0x08,0x84,
+0x00,0x00,0x70,0x03,0x13,0x4f,0x9c,0x00,0x45,0xff,0xff,0xa8,0x9c,0xb4,0x00,0x09,
+0xcc,0x00,0x06,0xe4,0x00,0x12,0xf8,0xb2,0x01,0x10,0x20,0x0c,0x00,0x26,0xd0,0x6f,
+0x14,0x01,0x63,0xc0,0x01,0x7c,0xef,0xed,0x93,0x1b,0x05,0x42,0x7b,0xdf,0xfe,0xc9,
+0x8d,0x06,0x11,0x2a,0x2f,0x00,0x13,0xd5,0x52,0x05,0x22,0xff,0xff,0x11,0x04,0x15,
+0x5f,0x5e,0x00,0x06,0xf2,0x02,0x11,0xf4,0x43,0x02,0x30,0xfc,0x98,0xbf,0x6a,0x00,
+0x21,0x03,0xff,0x39,0x03,0x10,0x3e,0x80,0x02,0x12,0xaf,0xbd,0x00,0x52,0x3f,0xff,
+0xff,0xf7,0x0e,0x3d,0x06,0x00,0xaf,0x02,0x13,0xa2,0xe5,0x06,0x56,0x08,0xdd,0xdd,
+0xd9,0x4f,0x27,0x06,0x16,0x05,0xa1,0x05,0x26,0x00,0x6f,0x06,0x06,0x16,0x06,0x6b,
+0x06,0x01,0x4d,0x01,0x16,0x00,0x2a,0x07,0x16,0x70,0x29,0x06,0x01,0xac,0x04,0x40,
+0x13,0x33,0x33,0x20,0x78,0x02,0x02,0xe0,0x02,0x13,0xfb,0x6f,0x03,0x10,0x01,0x97,
+0x02,0x11,0x3f,0xb4,0x02,0x20,0x02,0xcf,0x41,0x00,0x00,0x32,0x03,0x20,0xc8,0x8b,
+0x0b,0x01,0x01,0x0a,0x06,0x04,0xb6,0x03,0x14,0x05,0x0b,0x00,0x00,0xc4,0x02,0x06,
+0x0b,0x00,0x31,0x00,0x02,0xaf,0x33,0x02,0x02,0x15,0x01,0x66,0x27,0xbd,0xff,0xec,
+0x94,0x00,0x01,0x00,0x0f,0xe3,0x02,0x60,0x43,0x28,0xce,0xfe,0xb6,0x0c,0x00,0x10,
+0x09,0x9a,0x00,0x12,0xe4,0x0c,0x00,0x02,0x08,0x04,0x10,0xbf,0x0c,0x00,0x16,0x0c,
+0xef,0x04,0x27,0x00,0x6f,0x0c,0x00,0x00,0x06,0x00,0x21,0xd9,0x9b,0x0c,0x00,0x12,
+0x06,0xf0,0x05,0x10,0x1b,0x0c,0x00,0x12,0x0c,0xe9,0x00,0x00,0x42,0x00,0x23,0xf6,
+0x0f,0x84,0x04,0x00,0x54,0x00,0x44,0x2f,0xff,0xff,0xfb,0x78,0x00,0x11,0x5f,0xf2,
+0x01,0x02,0x0c,0x00,0x04,0x94,0x00,0x03,0x0c,0x00,0x1f,0xf5,0x0c,0x00,0x01,0x17,
+0x5f,0x24,0x00,0x04,0xe4,0x01,0x0c,0x54,0x00,0x00,0x6c,0x00,0x04,0x0c,0x00,0x13,
+0x0b,0xd6,0x07,0x00,0x84,0x00,0x12,0x05,0x52,0x05,0x11,0x1a,0x07,0x00,0x10,0xef,
+0xb4,0x00,0x1e,0x8a,0xcc,0x00,0x06,0x98,0x04,0x05,0xfc,0x00,0x11,0x7f,0x0c,0x00,
+0x01,0x9f,0x05,0x25,0xe5,0x0e,0x2c,0x01,0x33,0xc7,0x10,0x0c,0x8c,0x00,0x52,0x5a,
+0xde,0xfe,0xda,0x61,0x4b,0x01,0x34,0x7e,0xff,0xff,0x40,0x02,0x22,0x1c,0xff,0xd0,
+0x05,0x55,0x10,0x00,0x00,0x01,0xdf,0x2f,0x03,0x06,0x44,0x01,0x11,0xfa,0x94,0x03,
+0x41,0xff,0xea,0x89,0xdf,0x43,0x02,0x11,0xef,0x09,0x01,0x10,0x06,0xf5,0x08,0x12,
+0x06,0xc8,0x02,0x00,0x9e,0x09,0x22,0xf0,0x0b,0xb0,0x05,0x00,0x8b,0x02,0x22,0xf4,
+0x0f,0xb8,0x08,0x00,0x30,0x09,0xe6,0xf7,0x2f,0xff,0xff,0xfe,0xaa,0xaa,0xaa,0xaa,
+0xaf,0xff,0xff,0xf9,0x3f,0x3f,0x05,0x26,0xfa,0x4f,0x0c,0x00,0x18,0xfb,0x0c,0x00,
+0x17,0x3f,0x0c,0x00,0x16,0x2f,0xc8,0x08,0x08,0x7c,0x09,0x24,0x00,0x0c,0x29,0x03,
+0x12,0x01,0xc1,0x09,0x10,0xe2,0x0c,0x00,0x21,0x1d,0x90,0xe9,0x02,0x72,0xfe,0x50,
+0x00,0x00,0x06,0xef,0xf7,0xb4,0x00,0x31,0xfd,0x98,0x9b,0x2b,0x00,0x06,0x2c,0x01,
+0x16,0xe0,0xe4,0x00,0x00,0x73,0x0a,0x13,0x0a,0x0b,0x00,0x10,0xe3,0x42,0x00,0x14,
+0x4c,0xd8,0x03,0x10,0x00,0x78,0x06,0x44,0xbd,0xff,0xfd,0xa5,0x71,0x00,0x31,0x25,
+0x78,0x76,0xfb,0x06,0x13,0x6d,0xee,0x07,0x00,0x36,0x02,0x00,0x3f,0x07,0x02,0x78,
+0x01,0x12,0xf2,0x86,0x00,0x01,0x09,0x00,0x14,0x0e,0x09,0x00,0x00,0xc8,0x00,0x32,
+0xa3,0x10,0x10,0x74,0x05,0x04,0xc4,0x0a,0x14,0xf5,0x09,0x00,0x18,0xf4,0x09,0x00,
+0x14,0x5f,0x90,0x00,0x0f,0x09,0x00,0x11,0x0e,0x3f,0x00,0x0f,0x09,0x00,0x9a,0x71,
+0x00,0x16,0xbd,0xff,0xda,0x50,0x06,0x21,0x02,0x20,0x06,0xef,0xa3,0x01,0x11,0x38,
+0x0c,0x00,0x12,0x9f,0x84,0x02,0x00,0x0c,0x00,0x15,0x08,0xad,0x01,0x37,0xfc,0x00,
+0x3f,0x0c,0x00,0x10,0xdf,0x13,0x02,0x20,0x9a,0xdf,0x0c,0x00,0x10,0x03,0x0b,0x00,
+0x83,0x10,0x00,0x05,0xef,0xff,0xff,0xfc,0x0a,0xcc,0x0a,0x00,0x55,0x08,0x13,0x0e,
+0x5e,0x0b,0x00,0x81,0x02,0x04,0x75,0x0b,0x00,0x0c,0x00,0x03,0x00,0x08,0x01,0x0c,
+0x00,0x04,0x8d,0x03,0x00,0x0c,0x00,0x04,0xa5,0x03,0x0c,0x0c,0x00,0x08,0x24,0x00,
+0x13,0x3f,0x5c,0x05,0x03,0x54,0x00,0x14,0xfc,0x0c,0x00,0x13,0x0d,0xf1,0x02,0x00,
+0x0c,0x00,0x13,0x09,0x03,0x0c,0x12,0x3f,0x9c,0x00,0x00,0x6d,0x00,0x20,0x04,0xef,
+0x2c,0x00,0x15,0xcf,0x39,0x03,0x0a,0xcc,0x00,0x17,0x07,0x0c,0x00,0x21,0x00,0x8f,
+0x09,0x00,0x11,0xcf,0x0c,0x00,0x20,0x05,0xef,0x3f,0x00,0x13,0x0f,0xe8,0x06,0x56,
+0xbd,0xff,0xd9,0x30,0x0f,0x05,0x0c,0x12,0x00,0x3d,0x04,0x13,0x02,0x60,0x0c,0x00,
+0xab,0x02,0x20,0x7e,0x20,0x07,0x03,0x10,0xef,0x5f,0x01,0x33,0x02,0xff,0xf6,0xce,
+0x03,0x10,0xe0,0x22,0x03,0x32,0xe8,0x65,0x6a,0xe3,0x03,0x14,0x7f,0x6b,0x00,0x26,
+0xfd,0x00,0x41,0x04,0x13,0xe2,0x6b,0x00,0x03,0xf9,0x03,0x22,0x00,0x19,0x1b,0x07,
+0x01,0x7f,0x06,0x00,0xc1,0x08,0x33,0xfe,0xc8,0x40,0x80,0x07,0x07,0xf1,0x0c,0x03,
+0xb9,0x0c,0x0f,0x17,0x00,0x4f,0x42,0x49,0xdf,0xfe,0xb6,0x17,0x00,0x20,0x31,0xbf,
+0x97,0x00,0x11,0x30,0x16,0x0d,0x12,0xef,0x02,0x03,0x15,0x09,0x3c,0x01,0x36,0xfe,
+0x00,0x9f,0x05,0x05,0x01,0x17,0x00,0x11,0xea,0x20,0x02,0x22,0xc0,0x9f,0xdc,0x04,
+0x00,0x59,0x01,0x12,0x09,0xe7,0x04,0x00,0x3e,0x02,0x13,0xf3,0x73,0x00,0x00,0x61,
+0x02,0x13,0x49,0x73,0x00,0x00,0x6e,0x08,0x03,0x17,0x00,0x00,0xce,0x04,0x13,0x59,
+0x17,0x00,0x1f,0x6f,0x17,0x00,0x91,0x40,0x00,0x9d,0xfd,0x60,0x62,0x02,0x10,0x80,
+0x40,0x05,0x10,0x06,0x77,0x04,0x00,0x09,0x00,0x00,0xea,0x00,0x69,0x80,0x01,0x9e,
+0xfe,0x70,0x00,0x01,0x00,0x01,0x47,0x02,0x00,0x1c,0x01,0x0f,0x09,0x00,0x54,0x50,
+0x00,0xff,0xff,0xff,0xc0,0xf5,0x0d,0x00,0x00,0x00,0x19,0xef,0xc5,0x00,0x00,0x00,
+0x00,0xef,0xff,0xff,0x60,0x00,0x00,0x06,0xff,0xff,0xff,0xe0,0x00,0x00,0x08,0xff,
+0xff,0xff,0xf0,0x0e,0x00,0x12,0x01,0x1c,0x00,0x5f,0x00,0x1a,0xff,0xd6,0x00,0x01,
+0x00,0x05,0x4f,0xff,0xff,0xff,0xc0,0x07,0x00,0xac,0xf0,0x06,0x02,0xff,0xff,0xff,
+0xb0,0x00,0x00,0x07,0xff,0xff,0xff,0x90,0x13,0x12,0x7f,0xff,0xff,0xff,0x60,0x3f,
+0xff,0x01,0x00,0x11,0x10,0x07,0x00,0x21,0xfa,0x00,0x07,0x00,0x11,0xe1,0x07,0x00,
+0x21,0xfe,0x30,0x07,0x00,0xe4,0x91,0x00,0x00,0x03,0x67,0x76,0x30,0x00,0x00,0x00,
+0x6f,0xff,0xff,0xf6,0x0c,0x01,0x10,0x06,0x3b,0x00,0x04,0x0d,0x00,0x0f,0x19,0x00,
+0x58,0x00,0x92,0x00,0x13,0xd0,0x19,0x00,0x53,0x2e,0xff,0xff,0xff,0xe2,0x19,0x00,
+0x53,0x0d,0xff,0xff,0xff,0xf3,0x32,0x00,0x53,0x0b,0xff,0xff,0xff,0xf5,0x32,0x00,
+0x00,0xe6,0x01,0x13,0xf8,0x4b,0x00,0x11,0x06,0xe2,0x00,0x02,0x19,0x00,0x53,0x03,
+0xff,0xff,0xff,0xfc,0x64,0x00,0x63,0x62,0xef,0xff,0xff,0xfe,0x10,0x19,0x00,0x53,
+0xcf,0xff,0xff,0xff,0x20,0x19,0x00,0x53,0xef,0xff,0xff,0xff,0x40,0x7d,0x00,0x00,
+0x01,0x00,0x13,0x70,0x96,0x00,0x00,0x01,0x00,0x27,0xf9,0x00,0x19,0x00,0x17,0xf3,
+0x19,0x00,0x27,0xff,0xd0,0x19,0x00,0x24,0xff,0x80,0x19,0x00,0x00,0x4c,0x00,0x13,
+0x30,0x19,0x00,0x53,0xd1,0xaf,0xff,0xff,0xfd,0x19,0x00,0x10,0xd1,0x7a,0x02,0x14,
+0xf8,0xe1,0x00,0x12,0x06,0x4d,0x00,0x06,0xc8,0x00,0x14,0xd0,0xfa,0x00,0x11,0x2f,
+0x80,0x00,0x03,0xfa,0x00,0x11,0x7f,0xa5,0x00,0x03,0x13,0x01,0x10,0xdf,0xca,0x00,
+0x03,0x19,0x00,0x00,0xd7,0x00,0x14,0xf7,0x19,0x00,0x54,0x09,0xff,0xff,0xff,0xf2,
+0x45,0x01,0x10,0x1e,0x01,0x02,0x4f,0x0f,0xff,0xff,0xfc,0x04,0x00,0x79,0x10,0x6f,
+0x83,0x03,0xc1,0x49,0xde,0xfe,0xc7,0x10,0x00,0x00,0x16,0xbd,0xff,0xda,0x50,0xc8,
+0x00,0x20,0x02,0xbf,0x31,0x01,0x11,0x50,0xe6,0x00,0x20,0xff,0xc1,0xce,0x00,0x31,
+0xf5,0xef,0xff,0x13,0x00,0x11,0xaf,0x07,0x00,0x13,0xd1,0x6a,0x01,0x00,0xa4,0x02,
+0x12,0xaf,0x08,0x00,0x3c,0xa0,0x6f,0xff,0x01,0x00,0x11,0x16,0xd1,0x02,0x21,0x9a,
+0xef,0x27,0x00,0x70,0xa9,0xae,0xff,0xff,0xff,0xf6,0x6f,0xf7,0x02,0x32,0x00,0x00,
+0x9f,0x14,0x02,0x52,0x0c,0xff,0xff,0xff,0xa6,0x10,0x03,0x12,0x00,0x1a,0x02,0x00,
+0x65,0x01,0x13,0xfd,0x3d,0x01,0x12,0x0b,0x08,0x02,0x00,0x1a,0x00,0x13,0xe6,0x43,
+0x01,0x52,0xaf,0xff,0xff,0xf2,0x00,0x6b,0x02,0x03,0x25,0x00,0x12,0x0a,0x25,0x00,
+0x00,0x83,0x01,0x1f,0xf6,0x25,0x00,0xff,0x03,0x10,0x8f,0xc2,0x02,0x02,0xe1,0x01,
+0x10,0x08,0xda,0x01,0x21,0xcf,0xff,0x24,0x00,0x42,0x8f,0xff,0xff,0xf4,0xa6,0x01,
+0x26,0x60,0x08,0xb2,0x01,0x25,0x10,0x8f,0x0b,0x00,0x11,0xf8,0x17,0x00,0x30,0xea,
+0x99,0xdf,0x03,0x03,0x12,0x8f,0xb7,0x01,0x00,0x0f,0x02,0x12,0x08,0x0b,0x00,0x62,
+0x00,0xcf,0xff,0xff,0xf3,0x8f,0x78,0x03,0x00,0x13,0x00,0x16,0x48,0x5d,0x03,0x13,
+0xf5,0x17,0x00,0x00,0x24,0x02,0x1f,0x58,0x17,0x00,0x99,0x92,0x00,0x00,0x00,0x01,
+0x6a,0xdf,0xfe,0xda,0x61,0xf0,0x04,0x12,0x08,0x66,0x04,0x10,0x10,0x0c,0x00,0x13,
+0x3e,0xed,0x02,0x00,0x2b,0x00,0x02,0xaf,0x05,0x02,0x99,0x04,0x15,0x1e,0x07,0x03,
+0x11,0x20,0x88,0x01,0x20,0xfe,0xa8,0xe7,0x02,0x11,0xfb,0xe6,0x05,0x12,0xf9,0x43,
+0x00,0x10,0xf4,0xee,0x02,0x13,0xfa,0x0d,0x04,0x50,0xa0,0x0e,0xff,0xff,0xff,0x52,
+0x00,0x10,0x0f,0x8c,0x01,0x03,0x19,0x06,0x00,0xaf,0x01,0x22,0xf3,0x4f,0x84,0x04,
+0x01,0x95,0x00,0x14,0x66,0x77,0x05,0x00,0x15,0x00,0x12,0x7f,0x9a,0x00,0x01,0x59,
+0x04,0x11,0x86,0x96,0x03,0x02,0x84,0x00,0x23,0xf8,0x5f,0xa9,0x05,0x53,0x04,0xff,
+0xff,0xff,0x74,0xe9,0x04,0x01,0x79,0x04,0x10,0x1f,0x82,0x00,0x03,0x19,0x02,0x53,
+0x30,0xdf,0xff,0xff,0xf1,0x7a,0x07,0x11,0xf0,0x82,0x00,0x40,0x00,0x00,0x00,0x8f,
+0x21,0x00,0x12,0x2f,0x33,0x00,0x11,0x7f,0xc9,0x00,0x00,0xc5,0x03,0x31,0xe9,0x89,
+0xdf,0x91,0x00,0x24,0x01,0xef,0xd5,0x00,0x12,0xf2,0x76,0x00,0x21,0xff,0xff,0xc7,
+0x00,0x33,0x00,0x00,0x02,0x1a,0x00,0x20,0xe3,0x00,0x2b,0x01,0x02,0x2c,0x02,0x12,
+0x91,0x2d,0x01,0x53,0x16,0xad,0xef,0xed,0xb6,0xc2,0x05,0x62,0xe0,0x01,0x7c,0xef,
+0xec,0x83,0x0c,0x00,0x11,0xf0,0x43,0x04,0x11,0xa1,0x0c,0x00,0x11,0xfa,0x31,0x00,
+0x36,0xfd,0x10,0x00,0x2b,0x04,0x17,0xc0,0x0c,0x00,0x12,0xf7,0x0c,0x00,0x21,0xa9,
+0xae,0x8a,0x02,0x16,0x6f,0x73,0x02,0x26,0x60,0x6f,0x41,0x01,0x13,0xc0,0xf5,0x02,
+0x10,0x01,0x3c,0x08,0x04,0xab,0x06,0x44,0xbf,0xff,0xff,0xf2,0x0c,0x00,0x00,0xd9,
+0x02,0x04,0x0c,0x00,0x00,0xd5,0x01,0x04,0x0c,0x00,0x00,0x2e,0x01,0x07,0x18,0x00,
+0x1e,0xf6,0x24,0x00,0x0a,0x3c,0x00,0x16,0xcf,0x54,0x00,0x04,0x6c,0x00,0x13,0xfb,
+0x15,0x02,0x13,0xb0,0x9c,0x00,0x10,0x6f,0x8e,0x01,0x11,0x6f,0xf6,0x01,0x10,0x9d,
+0x06,0x00,0x07,0xcc,0x00,0x17,0xf6,0x0c,0x00,0x10,0xb0,0x0c,0x00,0x11,0xfc,0x0b,
+0x00,0x12,0xfc,0x7c,0x00,0x25,0x5e,0xff,0x41,0x00,0x6b,0xf6,0x00,0x7b,0xef,0xec,
+0x82,0x77,0x07,0x0f,0x0c,0x00,0x58,0x00,0x01,0x00,0x61,0x28,0xce,0xfe,0xc7,0x10,
+0x0a,0x14,0x00,0x11,0x09,0x89,0x01,0x10,0x0c,0x0c,0x00,0x21,0x01,0xdf,0xb3,0x00,
+0x10,0x9e,0x0c,0x00,0x17,0x0c,0xd9,0x00,0x16,0x7f,0x0c,0x00,0x10,0x01,0x06,0x00,
+0x30,0xd9,0x8a,0xef,0x0c,0x00,0x11,0x06,0xc2,0x01,0x01,0x41,0x00,0x22,0xf6,0x0c,
+0x24,0x04,0x00,0x56,0x02,0x10,0xf6,0xe9,0x02,0x04,0xda,0x07,0x13,0x3f,0x99,0x02,
+0x00,0x0c,0x00,0x13,0x5f,0xf0,0x02,0x1e,0x6f,0x98,0x01,0x1f,0xf5,0x0c,0x00,0x01,
+0x17,0x5f,0x24,0x00,0x17,0x4f,0x3c,0x00,0x17,0x2f,0x54,0x00,0x00,0x6c,0x00,0x04,
+0x0c,0x00,0x12,0x0b,0x12,0x03,0x00,0x1c,0x02,0x35,0xf6,0x05,0xff,0xdd,0x00,0x36,
+0xf6,0x00,0xef,0xb4,0x00,0x09,0xb1,0x01,0x17,0x0b,0x0c,0x00,0x21,0x00,0xcf,0x09,
+0x00,0x16,0xcf,0x14,0x01,0x13,0xe5,0xa4,0x00,0x01,0x2c,0x01,0x0f,0xac,0x01,0x65,
+0x03,0x14,0x01,0x31,0xf0,0x01,0x8d,0xea,0x05,0x40,0x14,0xff,0xff,0xfe,0x23,0x01,
+0x03,0x21,0x07,0x12,0xff,0x0f,0x00,0x1c,0xff,0x0f,0x00,0x30,0xec,0xbb,0xb6,0x77,
+0x03,0x11,0x30,0x40,0x00,0x17,0xfd,0xd6,0x09,0x03,0x5b,0x00,0x0f,0x0f,0x00,0x5e,
+0x00,0x47,0x01,0x41,0xbe,0xff,0xed,0xa6,0x5a,0x05,0x21,0x2c,0xff,0x26,0x08,0x16,
+0x10,0xbe,0x09,0x11,0xe3,0xad,0x03,0x02,0x01,0x00,0x11,0x30,0x8d,0x04,0x11,0xfe,
+0xd5,0x09,0x00,0x33,0x0b,0x30,0xb2,0x00,0x05,0x5b,0x0a,0x10,0x0b,0x6e,0x03,0x02,
+0x54,0x04,0x12,0x0d,0x1c,0x04,0x00,0xcc,0x08,0x12,0x0d,0xdf,0x00,0x40,0x02,0x22,
+0x22,0x21,0xfb,0x04,0x12,0xc4,0x6b,0x00,0x11,0x03,0xc8,0x06,0x11,0x63,0x0c,0x00,
+0x12,0x9f,0x6d,0x00,0x13,0x50,0x4d,0x04,0x00,0x5b,0x00,0x00,0x91,0x00,0x12,0x4d,
+0x0c,0x00,0x01,0x48,0x02,0x23,0x4a,0xef,0xb5,0x03,0x00,0x4a,0x00,0x22,0x6a,0xef,
+0xfa,0x04,0x00,0x01,0x00,0x92,0x05,0xdf,0xff,0xff,0xfa,0x57,0x77,0x77,0x50,0xcb,
+0x09,0x21,0xfd,0x9f,0xb6,0x0c,0x10,0x00,0x8b,0x00,0x03,0xe0,0x00,0x12,0x0e,0x54,
+0x09,0x30,0xff,0x81,0x00,0x40,0x09,0x21,0xf8,0x07,0xee,0x04,0x02,0x48,0x05,0x03,
+0x25,0x09,0x00,0x00,0x01,0x16,0x09,0x66,0x02,0x03,0x79,0x00,0x20,0xfb,0x20,0x60,
+0x00,0x51,0x38,0xce,0xff,0xed,0xa7,0x0a,0x00,0x43,0x88,0x88,0x88,0x50,0x77,0x04,
+0x1f,0xb0,0x08,0x00,0x17,0x12,0xcf,0x57,0x00,0x1f,0xf0,0x08,0x00,0x0d,0x0e,0x58,
+0x00,0x0f,0x08,0x00,0x44,0x14,0x00,0xdf,0x06,0x12,0xff,0x8e,0x08,0x01,0x7a,0x03,
+0x21,0xba,0xb3,0x17,0x04,0x01,0xd9,0x03,0x13,0x4f,0x08,0x00,0x13,0x0b,0x08,0x00,
+0x23,0x00,0xbf,0x08,0x00,0x62,0x04,0xad,0xff,0xec,0x92,0x9f,0xa5,0x07,0x00,0x46,
+0x01,0x13,0x59,0xa5,0x07,0x00,0x0b,0x07,0x0f,0x17,0x00,0x8e,0x16,0x8f,0x17,0x00,
+0x13,0x58,0xaf,0x07,0x12,0x7f,0x64,0x06,0x13,0xf9,0xd5,0x0a,0x12,0x54,0x55,0x02,
+0x10,0x1a,0xee,0x00,0x10,0x0f,0x00,0x02,0x27,0x99,0xbf,0x5c,0x0b,0x01,0x0d,0x01,
+0x16,0x03,0x94,0x09,0x34,0x50,0x07,0xff,0x8d,0x04,0x13,0xf5,0x24,0x03,0x11,0x72,
+0x58,0x00,0xa0,0x01,0x7b,0xef,0xfd,0xb6,0x10,0x0f,0xff,0xff,0xf5,0xf0,0x01,0x8f,
+0xff,0xff,0xf8,0x00,0x00,0x00,0x00,0x5f,0xff,0xff,0xfb,0x3f,0xff,0xff,0xfc,0x0c,
+0x00,0xf1,0x21,0x9f,0xff,0xff,0xf6,0x0d,0xff,0xff,0xff,0x10,0x00,0x00,0x00,0xdf,
+0xff,0xff,0xf1,0x08,0xff,0xff,0xff,0x50,0x00,0x00,0x02,0xff,0xff,0xff,0xb0,0x03,
+0xff,0xff,0xff,0x90,0x00,0x00,0x06,0xff,0xff,0xff,0x60,0x00,0xef,0xff,0xff,0xe0,
+0x00,0x00,0x0b,0x2b,0x00,0xf1,0x01,0x8f,0xff,0xff,0xf2,0x00,0x00,0x0f,0xff,0xff,
+0xfb,0x00,0x00,0x3f,0xff,0xff,0xf7,0x06,0x00,0x40,0xf6,0x00,0x00,0x0e,0x12,0x00,
+0x00,0x1e,0x00,0xf0,0x00,0xf1,0x00,0x00,0x09,0xff,0xff,0xff,0x00,0x00,0xcf,0xff,
+0xff,0xc0,0x00,0x00,0x49,0x00,0x21,0x40,0x01,0x47,0x00,0x10,0x00,0x49,0x00,0x22,
+0x80,0x05,0x72,0x00,0x00,0x7e,0x00,0x23,0xc0,0x09,0x8a,0x00,0x51,0x4f,0xff,0xff,
+0xf1,0x0e,0x4d,0x00,0x01,0x49,0x00,0x21,0xf5,0x2f,0x47,0x00,0x01,0x49,0x00,0x21,
+0xfa,0x7f,0x47,0x00,0xc1,0x00,0x00,0x04,0xff,0xff,0xfe,0xbf,0xff,0xff,0x70,0x00,
+0x00,0x49,0x00,0x00,0x01,0x00,0x23,0x20,0x00,0xc7,0x00,0x03,0x47,0x00,0x01,0x49,
+0x00,0x03,0x47,0x00,0x01,0x49,0x00,0x01,0xac,0x00,0x03,0x49,0x00,0x03,0x47,0x00,
+0x01,0x49,0x00,0x04,0x47,0x00,0x26,0x00,0x00,0x47,0x00,0x85,0x00,0x00,0xaf,0xff,
+0xff,0xfd,0x00,0x00,0x49,0x00,0x00,0x47,0x00,0x00,0xdd,0x00,0x20,0xf4,0x00,0xf0,
+0x00,0x00,0x26,0x00,0x01,0xc7,0x00,0x41,0xff,0xff,0xff,0x80,0x45,0x00,0x12,0xf7,
+0x4f,0x01,0x21,0xf2,0x0b,0xfa,0x00,0x21,0x00,0x9f,0x61,0x00,0x61,0x08,0xff,0xff,
+0xfe,0x00,0x7f,0x30,0x01,0x11,0x0d,0x06,0x01,0x61,0x00,0xbf,0xff,0xff,0xa0,0x03,
+0xf4,0x00,0x00,0x3f,0x00,0x11,0xf5,0x98,0x00,0x31,0xf6,0x00,0x0f,0x58,0x00,0x11,
+0x6f,0x66,0x01,0x11,0x02,0x84,0x00,0x01,0xdc,0x00,0x00,0x64,0x01,0x11,0xfe,0x57,
+0x00,0x31,0xe0,0x00,0x07,0x58,0x00,0x01,0xc5,0x00,0x00,0x57,0x00,0x11,0xfa,0x8d,
+0x00,0x32,0xe0,0x00,0x3f,0xbf,0x00,0x11,0xcf,0x52,0x01,0x00,0x58,0x00,0x30,0x08,
+0xff,0xff,0x2a,0x00,0x11,0x0f,0xed,0x00,0x10,0x0b,0x58,0x00,0x71,0xcf,0xff,0xf7,
+0xff,0xff,0xf0,0x02,0x4b,0x00,0x00,0x8d,0x00,0xc1,0x70,0x1f,0xff,0xff,0x0e,0xff,
+0xff,0x40,0x5f,0xff,0xff,0xa0,0x92,0x01,0x91,0xfb,0x05,0xff,0xff,0xb0,0x9f,0xff,
+0xf9,0x09,0xbb,0x01,0x00,0x3b,0x00,0x91,0xe0,0xaf,0xff,0xf7,0x04,0xff,0xff,0xd0,
+0xcf,0x0f,0x01,0x00,0x8d,0x00,0x81,0x1e,0xff,0xff,0x20,0x0f,0xff,0xff,0x2f,0xcc,
+0x00,0x00,0x8d,0x00,0x81,0xf8,0xff,0xff,0xd0,0x00,0xbf,0xff,0xfa,0x8b,0x00,0x01,
+0x8d,0x00,0x31,0xef,0xff,0xf9,0x22,0x02,0x02,0xdd,0x01,0x11,0x00,0x0a,0x00,0x35,
+0x40,0x00,0x1f,0x78,0x01,0x10,0x0b,0x0a,0x00,0x11,0xf0,0x5d,0x02,0x01,0x8b,0x00,
+0x01,0x8d,0x00,0x21,0xff,0xfa,0x26,0x01,0x01,0x8b,0x00,0x02,0x1f,0x02,0x21,0xff,
+0x60,0x4e,0x00,0x01,0x8b,0x00,0x01,0x8d,0x00,0x01,0xfd,0x01,0x15,0xef,0x9a,0x01,
+0x12,0xbf,0xdf,0x01,0x22,0x0a,0xff,0x8b,0x00,0x02,0x3f,0x00,0x12,0x80,0x7e,0x01,
+0x15,0xfa,0xaf,0x01,0x23,0xf3,0x00,0xa1,0x01,0x04,0xd9,0x01,0x01,0x72,0x00,0x12,
+0x0c,0x8b,0x00,0x12,0x0d,0xdb,0x02,0x00,0x4b,0x00,0x10,0xf7,0x37,0x00,0x12,0xfe,
+0x34,0x00,0x11,0xfe,0xa6,0x02,0x14,0xf7,0x20,0x00,0x00,0x8d,0x00,0x11,0xe1,0xd2,
+0x00,0x12,0xc0,0x6f,0x00,0x32,0x80,0x01,0xef,0x59,0x00,0x10,0x1f,0x8d,0x00,0x13,
+0x8f,0x6f,0x00,0x00,0x08,0x00,0x13,0x2f,0xc6,0x02,0x00,0xa7,0x00,0x13,0xfc,0x8f,
+0x00,0x03,0x0c,0x01,0x02,0xa5,0x00,0x00,0x7a,0x00,0x05,0xd4,0x00,0x02,0xb5,0x01,
+0x16,0xfc,0x68,0x02,0x32,0xff,0xff,0x30,0x0c,0x00,0x20,0x02,0xff,0x6e,0x03,0x03,
+0x19,0x00,0x15,0x6f,0x28,0x01,0x53,0x00,0x00,0x1e,0xff,0xff,0xb3,0x03,0x03,0x2f,
+0x01,0x26,0xff,0xf2,0x31,0x00,0x03,0x3d,0x01,0x02,0x4a,0x00,0x00,0x74,0x01,0x03,
+0xcf,0x00,0x13,0x6f,0x65,0x00,0x10,0x0c,0xcf,0x00,0x12,0xcf,0x7e,0x00,0x01,0xcf,
+0x00,0x13,0x03,0x97,0x00,0x10,0xef,0x1f,0x02,0x12,0x0a,0xb0,0x00,0x11,0x8f,0x60,
+0x02,0x02,0xc9,0x00,0x01,0xe0,0x00,0x01,0xc4,0x02,0x11,0xfa,0x1f,0x00,0x12,0x90,
+0x4c,0x01,0x23,0xf3,0x03,0x8d,0x01,0x10,0x07,0x45,0x00,0x12,0xcf,0x91,0x00,0x00,
+0xa7,0x00,0x13,0xfd,0x25,0x01,0x02,0x4c,0x00,0x13,0x1f,0x0d,0x01,0x01,0xa5,0x00,
+0x12,0xbf,0x77,0x00,0x10,0x4f,0x4d,0x03,0x12,0x06,0xdd,0x00,0x11,0x09,0x71,0x00,
+0x12,0x1f,0x10,0x03,0x11,0xdf,0xca,0x00,0x11,0xbf,0x00,0x03,0x11,0x2f,0x72,0x03,
+0x11,0x06,0x71,0x00,0x12,0x07,0x96,0x03,0x11,0x1f,0x03,0x01,0x12,0xbf,0xef,0x00,
+0x01,0x07,0x00,0x12,0x0f,0xd5,0x00,0x10,0x05,0x20,0x00,0x13,0x05,0xbb,0x03,0x01,
+0x14,0x00,0x13,0xaf,0x14,0x01,0x12,0xaf,0x3e,0x04,0x23,0xfc,0x00,0x26,0x00,0x13,
+0x53,0xe0,0x03,0x00,0x26,0x00,0x12,0xfa,0x92,0x04,0x03,0xde,0x03,0x04,0x84,0x01,
+0x26,0x05,0xff,0xb6,0x02,0x01,0x71,0x02,0x04,0x25,0x00,0x02,0x52,0x01,0x17,0xfb,
+0x29,0x04,0x04,0x50,0x02,0x17,0x0f,0x25,0x00,0x26,0x00,0xaf,0x25,0x00,0x27,0x00,
+0x04,0x25,0x00,0x27,0x00,0x0e,0x25,0x00,0x26,0x00,0x9f,0x25,0x00,0x01,0x26,0x00,
+0x14,0x50,0x0d,0x00,0x11,0x2f,0x16,0x03,0x05,0xdc,0x01,0x05,0x25,0x00,0x27,0x00,
+0xef,0x25,0x00,0x15,0x8f,0x25,0x00,0x35,0x01,0x24,0xaf,0xe9,0x02,0x27,0x03,0xff,
+0x3d,0x02,0x17,0x3f,0x3d,0x02,0x21,0x03,0xff,0xbd,0x02,0x06,0x19,0x00,0x26,0xe3,
+0x00,0x19,0x00,0x24,0xa1,0x00,0x0d,0x00,0x21,0x67,0x75,0xb6,0x02,0x05,0x20,0x05,
+0x02,0xa5,0x02,0x0f,0x0b,0x00,0x18,0x30,0xf2,0x07,0x88,0x01,0x00,0x15,0xcf,0xd0,
+0x00,0x00,0x23,0x03,0x25,0xf9,0x00,0xf3,0x02,0x15,0xd0,0xbe,0x00,0x03,0xbe,0x03,
+0x16,0x03,0x06,0x03,0x15,0x1e,0xaf,0x00,0x00,0xda,0x01,0x34,0xfe,0x10,0x00,0x35,
+0x03,0x16,0xf3,0xb7,0x00,0x12,0x80,0x0b,0x00,0x15,0xdf,0x2f,0x03,0x16,0x0a,0xd8,
+0x00,0x15,0x5f,0x75,0x00,0x2f,0x02,0xff,0x75,0x00,0x0b,0x10,0x04,0x6f,0x03,0x01,
+0xa9,0x00,0x25,0x86,0x1e,0xbb,0x00,0x2f,0xfc,0x4f,0x0b,0x00,0x18,0x02,0xdc,0x00,
+0x02,0x6e,0x00,0x12,0x2a,0xeb,0x03,0x12,0x8f,0xc8,0x00,0x12,0xbf,0xfa,0x02,0x12,
+0xaf,0x82,0x00,0x12,0x4f,0x21,0x06,0x12,0x0c,0x10,0x06,0x03,0x74,0x05,0x00,0x23,
+0x03,0x12,0xa0,0x77,0x06,0x13,0xf8,0x30,0x02,0x12,0x60,0x10,0x05,0x04,0x42,0x00,
+0x0f,0x0f,0x00,0x0b,0x12,0x50,0x52,0x00,0x13,0xf4,0x56,0x05,0x11,0x10,0x3a,0x05,
+0x00,0xe6,0x00,0x21,0x01,0x7f,0x25,0x00,0x13,0x0c,0x80,0x02,0x12,0xef,0x07,0x00,
+0x13,0x0e,0x0d,0x01,0x03,0x8a,0x01,0x13,0x0e,0x1d,0x01,0x23,0x03,0xaf,0x43,0x00,
+0x02,0x9b,0x06,0x01,0xd2,0x03,0x12,0x10,0x0d,0x05,0x17,0xf4,0x69,0x00,0x0f,0x96,
+0x00,0x13,0x03,0xc3,0x00,0x13,0x09,0x18,0x07,0x03,0xe1,0x00,0x04,0xf0,0x00,0x12,
+0x0d,0x26,0x00,0x00,0xa2,0x01,0x13,0xe2,0x3d,0x00,0x10,0xe6,0x08,0x00,0x13,0xcf,
+0x9c,0x01,0x13,0xaf,0x95,0x07,0x14,0x5d,0x15,0x02,0x20,0x70,0x00,0x5b,0x06,0x1f,
+0xf2,0x05,0x00,0x4c,0x53,0xbb,0xbb,0x10,0x00,0x50,0x5c,0x02,0x23,0xf9,0x20,0x09,
+0x08,0x13,0x70,0x2b,0x01,0x14,0x90,0xbf,0x04,0x03,0x85,0x02,0x12,0x20,0x10,0x00,
+0x18,0xfa,0xa2,0x03,0x12,0xdf,0x6c,0x03,0x13,0x0a,0xdf,0x00,0x12,0x9f,0x3e,0x00,
+0x13,0x08,0xd7,0x01,0x12,0x8f,0x3d,0x00,0x0f,0x0f,0x00,0x0b,0x13,0x07,0x53,0x00,
+0x13,0x4f,0x0b,0x01,0x03,0xc4,0x02,0x13,0x08,0x36,0x04,0x22,0x0d,0xff,0x20,0x00,
+0x13,0x1c,0x1c,0x03,0x12,0x0a,0xd3,0x01,0x12,0x0a,0x0f,0x00,0x12,0x0b,0xe9,0x01,
+0x00,0x1c,0x05,0x12,0x82,0xb6,0x00,0x12,0x60,0x4b,0x00,0x03,0x94,0x07,0x04,0x90,
+0x06,0x1f,0x90,0x96,0x00,0x16,0x12,0x9f,0x0f,0x00,0x04,0xd2,0x00,0x12,0xdf,0x3e,
+0x06,0x12,0x1f,0xf0,0x00,0x02,0x67,0x08,0x01,0x3e,0x03,0x16,0x30,0x67,0x07,0x06,
+0x9a,0x00,0x11,0x80,0xc9,0x00,0x12,0xfb,0x7f,0x04,0x14,0x82,0x49,0x04,0x33,0x01,
+0x58,0x87,0x91,0x04,0x03,0xd8,0x00,0x10,0xe5,0x09,0x00,0x32,0x5c,0xcc,0xc7,0x04,
+0x07,0x12,0xfa,0x77,0x01,0x22,0x80,0x0a,0x59,0x03,0x10,0x10,0xc7,0x00,0x22,0xf6,
+0x04,0x67,0x03,0x20,0xfd,0x30,0x91,0x00,0x23,0x30,0xbf,0x76,0x03,0xb2,0xc9,0xdf,
+0xff,0xff,0xe0,0x1f,0xff,0xff,0xe4,0x02,0x9f,0x11,0x00,0x21,0xf8,0x04,0x1d,0x04,
+0x02,0x98,0x03,0x31,0xfe,0x00,0x6f,0x98,0x03,0x12,0x3e,0x04,0x05,0x12,0x07,0xf7,
+0x00,0x10,0x1b,0x1a,0x00,0x51,0x40,0x00,0x01,0x11,0x10,0xf9,0x03,0x31,0xad,0xfe,
+0xc7,0x09,0x00,0x42,0x4b,0xef,0xd9,0x10,0x47,0x01,0x14,0xf5,0x72,0x07,0xf0,0x00,
+0x04,0xff,0xff,0xa8,0xcf,0xff,0xd0,0x0b,0xff,0xf4,0x00,0x09,0xff,0xf4,0x0f,0xc1,
+0x02,0x30,0xff,0xf8,0x0f,0xd2,0x01,0x50,0xdf,0xf9,0x0f,0xff,0x90,0x0e,0x00,0x30,
+0x0b,0xff,0xf3,0x1c,0x00,0x11,0x05,0x2a,0x00,0x12,0xe0,0x38,0x00,0x14,0x40,0x46,
+0x00,0x00,0x54,0x00,0x16,0x20,0xaa,0x05,0x01,0x7e,0x00,0x07,0x30,0x0a,0x05,0xbb,
+0x07,0x04,0xb6,0x04,0x27,0xff,0xf5,0x11,0x00,0x07,0xb6,0x07,0x05,0xec,0x07,0x03,
+0x43,0x08,0x04,0xc7,0x04,0x15,0xf8,0x29,0x05,0x02,0x5a,0x03,0x25,0xfc,0x1f,0xb4,
+0x0a,0x03,0xc8,0x09,0x16,0xcf,0xad,0x0a,0x20,0x00,0x0d,0x8c,0x05,0x05,0xed,0x0a,
+0x01,0x68,0x05,0x35,0xfc,0x00,0x2f,0x0c,0x05,0x03,0xad,0x02,0x03,0xc1,0x02,0x03,
+0xf0,0x05,0x35,0xf2,0x00,0x07,0x38,0x05,0x21,0x00,0x05,0xe6,0x04,0x03,0xe0,0x09,
+0x03,0xe3,0x03,0x11,0x70,0xb3,0x03,0x03,0x33,0x03,0x11,0x1f,0xcc,0x06,0x04,0x66,
+0x02,0x01,0x25,0x03,0x15,0xfc,0x17,0x00,0x03,0xde,0x03,0x12,0x70,0x07,0x00,0x14,
+0x60,0xd8,0x06,0x16,0xf1,0x28,0x00,0x01,0x0c,0x02,0x13,0xfc,0x49,0x00,0x14,0xf2,
+0xd6,0x05,0x04,0x01,0x00,0x15,0x70,0xc1,0x06,0x03,0x0a,0x02,0x05,0xa7,0x0b,0x03,
+0x01,0x00,0x16,0xf3,0xe8,0x0b,0x02,0x01,0x00,0x13,0x90,0x02,0x06,0x04,0x01,0x00,
+0x12,0xfe,0x9e,0x04,0x21,0xfe,0x33,0x01,0x00,0x11,0x6f,0x6f,0x01,0x16,0x01,0x97,
+0x01,0x11,0xef,0x6f,0x01,0x13,0x6f,0xec,0x04,0x02,0x5c,0x00,0x36,0x10,0x00,0x0c,
+0xa7,0x01,0x10,0x4f,0x6f,0x01,0x17,0x02,0xc8,0x01,0x10,0xef,0x6f,0x01,0x15,0x8f,
+0x31,0x00,0x01,0x32,0x00,0x27,0x20,0x0e,0xd8,0x01,0x00,0x15,0x0c,0x17,0x04,0xf9,
+0x01,0x00,0x32,0x00,0x26,0xd0,0x9f,0x31,0x00,0x01,0x32,0x00,0x26,0x30,0xcf,0xa4,
+0x00,0x00,0x0f,0x01,0x0f,0x0f,0x00,0x2c,0x23,0xf7,0x55,0x01,0x00,0x11,0x50,0x0f,
+0x00,0x17,0xf2,0x53,0x02,0x0f,0x0f,0x00,0x4a,0x03,0x64,0x01,0x3a,0xdb,0x83,0x00,
+0x96,0x00,0x1a,0xd5,0x0f,0x00,0x2a,0xff,0xa0,0x0f,0x00,0x1a,0xfa,0x0f,0x00,0x20,
+0xff,0x60,0x86,0x0a,0x00,0xbf,0x00,0x21,0x56,0x8c,0x1b,0x0b,0x06,0x69,0x00,0x56,
+0x2c,0xff,0xff,0xff,0xf4,0x78,0x00,0x00,0x1c,0x02,0x16,0xf8,0x0f,0x00,0x00,0xb9,
+0x01,0x17,0xfa,0x0f,0x00,0x00,0xb4,0x0e,0x0f,0x0f,0x00,0x07,0x19,0x7f,0x2d,0x00,
+0x00,0x97,0x01,0x16,0xf7,0x0f,0x00,0x10,0x3c,0x4c,0x01,0x00,0x4a,0x01,0x61,0x66,
+0x66,0x66,0x66,0x67,0x9c,0xb5,0x00,0x09,0xa5,0x00,0x29,0xfe,0x10,0x0f,0x00,0x19,
+0xf3,0xc3,0x00,0x28,0xfd,0x30,0x0f,0x00,0x28,0xfe,0x70,0x1d,0x01,0x50,0xc9,0x50,
+0x00,0x00,0x00,0x22,0xcf,0xff,0x01,0x00,0x95,0xfe,0xda,0x73,0x00,0x00,0x00,0x00,
+0xcf,0xff,0x01,0x00,0x1a,0xe7,0x0f,0x00,0x2a,0xff,0xd2,0x0f,0x00,0x29,0xfe,0x10,
+0x0f,0x00,0x20,0xff,0xb0,0x0f,0x00,0xd0,0xf4,0x22,0x22,0x22,0x23,0x46,0xbf,0xff,
+0xff,0xff,0xf2,0x00,0xcf,0x05,0x00,0x00,0x01,0x00,0x56,0x05,0xff,0xff,0xff,0xf6,
+0x0f,0x00,0x57,0x00,0xaf,0xff,0xff,0xf8,0x0f,0x00,0x4a,0x6f,0xff,0xff,0xf9,0x0f,
+0x00,0x17,0xf7,0x0f,0x00,0x46,0x9f,0xff,0xff,0xf3,0x0f,0x00,0x55,0x03,0xff,0xff,
+0xff,0xd0,0x0f,0x00,0x69,0x13,0x8f,0xff,0xff,0xff,0x30,0x87,0x00,0x19,0xf5,0xa5,
+0x00,0x28,0xfa,0x20,0x0f,0x00,0x2b,0xfe,0x73,0xd2,0x00,0x2a,0xd6,0x00,0xc3,0x00,
+0x10,0xc1,0x0f,0x00,0x20,0xf3,0x22,0xc4,0x00,0x57,0x6a,0xff,0xff,0xff,0xfd,0x87,
+0x00,0x56,0x2d,0xff,0xff,0xff,0x80,0x0f,0x00,0x56,0x01,0xff,0xff,0xff,0xf0,0x0f,
+0x00,0x00,0xd3,0x00,0x17,0xf4,0x0f,0x00,0x47,0x7f,0xff,0xff,0xf6,0x0f,0x00,0x4a,
+0x8f,0xff,0xff,0xf7,0x2d,0x00,0x1a,0xf6,0x4b,0x00,0x1a,0xf4,0x69,0x00,0x13,0xf0,
+0x4a,0x01,0x30,0x22,0x33,0x6a,0x97,0x00,0x39,0x90,0xcf,0xff,0x78,0x01,0x09,0x0f,
+0x00,0x19,0xf3,0xc3,0x00,0x19,0xfd,0x0e,0x01,0x27,0xfd,0x70,0xe1,0x00,0x3a,0xed,
+0xa7,0x30,0xff,0x00,0x1f,0xf4,0x0c,0x00,0x20,0x22,0xf7,0x66,0x01,0x00,0x17,0x61,
+0xcf,0x00,0x1f,0x00,0x0c,0x00,0xff,0x26,0x04,0xe0,0x02,0x02,0x01,0x00,0x13,0xf0,
+0x11,0x00,0x1c,0xbf,0x11,0x00,0x1c,0xdf,0x11,0x00,0x1b,0xff,0x11,0x00,0x1c,0x01,
+0x11,0x00,0x85,0x04,0xff,0xff,0xff,0xcc,0xcc,0xcc,0xef,0x11,0x00,0x51,0x06,0xff,
+0xff,0xff,0x10,0x5b,0x00,0x03,0x11,0x00,0x58,0x08,0xff,0xff,0xff,0x00,0x11,0x00,
+0x49,0x0a,0xff,0xff,0xfc,0x11,0x00,0x49,0x0c,0xff,0xff,0xfa,0x11,0x00,0x10,0x0f,
+0xb6,0x03,0x08,0x11,0x00,0x10,0x1f,0xd6,0x03,0x08,0x11,0x00,0x10,0x4f,0x8e,0x02,
+0x08,0x11,0x00,0x12,0x7f,0x0a,0x00,0x06,0x11,0x00,0x10,0xaf,0xbe,0x03,0x08,0x11,
+0x00,0x10,0xdf,0x38,0x04,0x07,0x11,0x00,0x10,0x01,0x67,0x03,0x08,0x11,0x00,0x00,
+0x3c,0x04,0x18,0x50,0x11,0x00,0x12,0x09,0xcb,0x00,0x06,0x11,0x00,0x10,0x0e,0xa9,
+0x03,0x08,0x11,0x00,0x10,0x2f,0x50,0x04,0x08,0x11,0x00,0x11,0x7f,0x17,0x04,0x07,
+0x11,0x00,0x13,0xdf,0x09,0x00,0x04,0x11,0x00,0x11,0x03,0xbf,0x04,0x07,0x11,0x00,
+0x00,0x65,0x00,0x18,0x60,0x11,0x00,0x13,0x1f,0x76,0x00,0x05,0x11,0x00,0x12,0x8f,
+0x1f,0x01,0x04,0x11,0x00,0x20,0x6c,0xcc,0x6f,0x03,0x22,0xcc,0xcc,0x76,0x01,0x35,
+0xfc,0xcc,0xc3,0xd7,0x01,0x04,0x98,0x04,0x0f,0x11,0x00,0x34,0x15,0x40,0x39,0x02,
+0x1f,0x08,0x11,0x00,0x89,0x09,0xa3,0x04,0x1f,0x30,0x0e,0x00,0x28,0x24,0xf7,0x66,
 0x01,0x00,0x1a,0x10,0x3b,0x03,0x0f,0x0e,0x00,0x44,0x05,0x70,0x00,0x19,0x40,0x58,
 0x05,0x1f,0xc0,0x0e,0x00,0x29,0x0e,0xb6,0x00,0x0f,0xc4,0x00,0x54,0x29,0x66,0x60,
-0x50,0x01,0x1f,0xf2,0x0e,0x00,0x25,0x01,0x17,0x07,0x09,0x1f,0x75,0x01,0x00,0x13,
-0x05,0x9a,0x74,0x04,0xf8,0x7f,0x15,0x5f,0x98,0x3d,0x17,0x70,0x2d,0x00,0x03,0x11,
-0x20,0x16,0x0e,0x39,0x17,0x17,0xf1,0x63,0x03,0x16,0x5f,0xfa,0x1e,0x15,0x10,0xa7,
-0x33,0x04,0x61,0x13,0x04,0x2d,0x00,0x04,0x80,0x00,0x12,0x02,0x72,0x00,0x03,0x2d,
-0x00,0x03,0x71,0x18,0x03,0x25,0x66,0x04,0x2d,0x00,0x05,0x1e,0x41,0x03,0x43,0x81,
-0x02,0x2d,0x00,0x03,0x22,0x30,0x06,0x5c,0x7e,0x01,0x2d,0x00,0x17,0x04,0xbe,0x14,
-0x14,0x9f,0x59,0x74,0x37,0x10,0x01,0xef,0x06,0x13,0x01,0x3f,0x34,0x01,0x2d,0x00,
-0x08,0x7c,0x75,0x10,0x04,0x23,0x24,0x01,0x2d,0x00,0x06,0xe6,0x4f,0x03,0x57,0x05,
-0x13,0xd3,0xfe,0x80,0x2a,0xfe,0x10,0x63,0x4b,0x08,0x92,0x4f,0x0d,0x21,0x55,0x0a,
-0x8e,0x64,0x0a,0xf6,0x4b,0x05,0x86,0x3a,0x09,0x4b,0x0c,0x05,0xa7,0x0d,0x20,0x46,
-0x9d,0x13,0x32,0x17,0x3b,0x09,0x18,0x02,0x5b,0x38,0x01,0xb4,0x00,0x05,0xb7,0x68,
-0x04,0xb3,0x37,0x02,0x0e,0x01,0x07,0x7b,0x37,0x00,0x2e,0x32,0x03,0x0e,0x01,0x07,
-0x65,0x37,0x11,0x1e,0xc0,0x00,0x02,0x2d,0x00,0x15,0x08,0x70,0x18,0x03,0xda,0x01,
-0x15,0x9f,0xc5,0x4a,0x15,0x10,0xfc,0x50,0x08,0x95,0x01,0x18,0xfa,0x14,0x7d,0x15,
-0x9f,0xd7,0x4a,0x14,0xf3,0x19,0x64,0x06,0xef,0x01,0x04,0x21,0x44,0x07,0x84,0x5a,
-0x16,0xf1,0xf7,0x2e,0x04,0x6d,0x4d,0x04,0x49,0x02,0x11,0x3f,0x95,0x00,0x01,0xf8,
-0x4b,0x08,0x76,0x02,0x02,0x56,0x40,0x04,0x64,0x14,0x17,0x09,0xd4,0x63,0x11,0xf2,
-0xd8,0x0e,0x18,0x10,0x2d,0x00,0x01,0xc1,0x2c,0x05,0x39,0x3d,0x05,0xd0,0x02,0x15,
-0x1f,0x1f,0x02,0x4a,0x15,0x67,0x77,0x53,0xb8,0x6e,0x12,0xb6,0x9a,0x06,0x17,0x9f,
-0xdf,0x5e,0x06,0xd7,0x45,0x19,0x90,0xa6,0x4d,0x03,0x5b,0x70,0x03,0xfb,0x4a,0x11,
-0x30,0xdd,0x07,0x13,0x81,0x3f,0x40,0x05,0xa3,0x3e,0x14,0x05,0x9a,0x43,0x14,0x60,
-0xa5,0x02,0x05,0x68,0x12,0x11,0x00,0x83,0x44,0x34,0x03,0x7a,0xe6,0x37,0x02,0x06,
-0xe9,0x3b,0x07,0x1b,0x0e,0x02,0x49,0x46,0x14,0xf2,0x0c,0x00,0x16,0x48,0xdf,0x69,
-0x19,0x0f,0x34,0x6c,0x01,0x0d,0x00,0x17,0xb3,0x1d,0x50,0x15,0xfe,0x0a,0x72,0x08,
-0x31,0x4a,0x29,0x00,0x0f,0xce,0x40,0x39,0x55,0x67,0x9c,0x09,0x6c,0x29,0x01,0x9f,
-0xe9,0x0f,0x11,0x9f,0x60,0x00,0x16,0x01,0xa1,0x70,0x55,0xb0,0x00,0x5b,0xf9,0x00,
-0x8a,0x07,0x14,0x4a,0x99,0x00,0x00,0x63,0x00,0x15,0xda,0x5f,0x03,0x12,0x2f,0x60,
-0x2e,0x05,0xf6,0x57,0x32,0xff,0x90,0xbf,0xeb,0x7c,0x01,0x24,0x1c,0x21,0xf3,0x02,
-0xb7,0x16,0x44,0x86,0x67,0xaf,0xff,0x68,0x28,0x06,0xf6,0x36,0x19,0x07,0x46,0x58,
-0x17,0x05,0xea,0x0a,0x06,0x13,0x6d,0x13,0xe7,0xf9,0x02,0x23,0x8b,0xde,0xbb,0x52,
-0x06,0x71,0x7d,0x00,0x8a,0x01,0x15,0x4d,0xef,0x02,0x10,0x5f,0xc8,0x0a,0x05,0x1d,
-0x00,0x28,0x0d,0xff,0x1d,0x00,0x28,0x07,0xff,0x1d,0x00,0x29,0x01,0xef,0x1d,0x00,
-0x19,0x9f,0x1d,0x00,0x02,0x8e,0x03,0x16,0x4d,0x4d,0x7f,0x06,0x1d,0x00,0x00,0x7e,
-0x03,0x25,0xfd,0xbf,0x1d,0x00,0x00,0x80,0x00,0x16,0x4b,0x1d,0x00,0x12,0x6f,0x9f,
-0x54,0x03,0x1d,0x00,0x12,0x0e,0x33,0x96,0x03,0x1d,0x00,0x13,0x07,0x88,0x62,0x15,
-0x4d,0x0b,0x10,0x25,0x10,0x0d,0x1d,0x00,0x04,0x0e,0x11,0x14,0x4d,0xc1,0x56,0x25,
-0xd0,0x00,0x1d,0x00,0x11,0x0b,0x14,0x00,0x04,0x1d,0x00,0x02,0x19,0x8f,0x05,0x1d,
-0x00,0x02,0x42,0x11,0x04,0x1d,0x00,0x02,0xf8,0x14,0x04,0x1d,0x00,0x14,0x0e,0x9c,
-0x03,0x00,0x1d,0x00,0x13,0xf4,0x63,0x13,0x03,0x1d,0x00,0x13,0x42,0x47,0x05,0x02,
-0x1d,0x00,0x13,0xf3,0x40,0x15,0x03,0x1d,0x00,0x00,0x57,0x36,0x06,0x1d,0x00,0x13,
-0xfe,0x43,0x10,0x03,0x1d,0x00,0x04,0x73,0x04,0x02,0x1d,0x00,0x04,0x98,0x04,0x05,
+0x50,0x01,0x1f,0xf2,0x0e,0x00,0x25,0x01,0x17,0x07,0x08,0x7d,0x03,0x00,0xf6,0x02,
+0x13,0xf4,0x8d,0x07,0x02,0xc4,0x04,0x10,0xf1,0x08,0x00,0x11,0x5f,0x15,0x03,0x00,
+0x25,0x00,0x17,0x70,0x2d,0x00,0x12,0x0e,0x08,0x00,0x03,0x07,0x00,0x04,0x2d,0x00,
+0x04,0x63,0x03,0x02,0x34,0x00,0x04,0x2d,0x00,0x11,0x03,0x34,0x01,0x04,0x61,0x00,
+0x05,0x2d,0x00,0x04,0x80,0x00,0x12,0x02,0x72,0x00,0x03,0x2d,0x00,0x13,0x6f,0xe9,
+0x03,0x22,0x00,0x07,0x36,0x04,0x01,0x2d,0x00,0x00,0xab,0x03,0x12,0xfe,0x0b,0x01,
+0x53,0x0d,0xff,0xff,0xff,0x20,0x2d,0x00,0x12,0x0a,0x48,0x04,0x00,0x01,0x00,0x11,
+0x3f,0xeb,0x04,0x01,0x2d,0x00,0x14,0x04,0xf9,0x03,0x02,0x6b,0x00,0x12,0xf7,0x2d,
+0x00,0x23,0x01,0xef,0xd0,0x00,0x00,0x01,0x00,0x10,0xef,0x00,0x01,0x01,0x2d,0x00,
+0x12,0xaf,0xf0,0x04,0x05,0x62,0x05,0x11,0xd1,0x2d,0x00,0x48,0x7f,0xff,0xff,0xfb,
+0xfb,0x02,0x71,0xff,0xd3,0x9f,0xff,0xff,0xf2,0x8f,0x20,0x09,0x04,0x01,0x00,0x18,
+0x0b,0xd5,0x02,0x06,0xab,0x01,0x16,0xef,0x16,0x00,0x16,0xf6,0x16,0x00,0x17,0x8f,
+0x2d,0x00,0x15,0xe1,0x16,0x00,0x18,0x2f,0x91,0x01,0x14,0x90,0x16,0x00,0x00,0xd6,
+0x00,0x71,0x46,0x9d,0xff,0xff,0xff,0xa8,0x3b,0xec,0x00,0x06,0x9d,0x00,0x12,0xa0,
+0xb4,0x00,0x17,0x2f,0x9e,0x00,0x10,0xdf,0x11,0x00,0x02,0x0e,0x01,0x13,0x9f,0x12,
+0x05,0x02,0x6f,0x09,0x13,0xf8,0x0e,0x01,0x00,0x7d,0x05,0x12,0xe0,0x16,0x00,0x11,
+0x1e,0xc0,0x00,0x02,0x2d,0x00,0x13,0x08,0xd0,0x01,0x05,0xda,0x01,0x02,0x68,0x01,
+0x04,0xd0,0x01,0x01,0xb4,0x01,0x18,0xe0,0x95,0x01,0x14,0xfa,0x89,0x02,0x16,0xf5,
+0xc2,0x01,0x13,0xdf,0xc2,0x01,0x12,0x5f,0x68,0x06,0x03,0x2d,0x00,0x13,0x05,0x42,
+0x02,0x00,0x4c,0x00,0x16,0x40,0x2d,0x00,0x12,0x0c,0x1c,0x02,0x13,0x08,0x9e,0x01,
+0x04,0x49,0x02,0x11,0x3f,0x95,0x00,0x11,0x02,0x92,0x02,0x07,0x76,0x02,0x11,0xbf,
+0x07,0x02,0x13,0xaf,0x78,0x00,0x04,0x2d,0x00,0x02,0x27,0x00,0x14,0x4f,0xa5,0x00,
+0x04,0x2d,0x00,0x10,0x09,0x54,0x00,0x13,0x0d,0x66,0x06,0x06,0xd0,0x02,0x15,0x1f,
+0x1f,0x02,0x44,0x15,0x67,0x77,0x53,0x32,0x01,0x11,0x28,0xa2,0x01,0x12,0xb6,0x9a,
+0x06,0x13,0x9f,0x7f,0x09,0x10,0x50,0x5d,0x00,0x17,0xef,0x8b,0x01,0x05,0x0d,0x00,
+0x00,0x55,0x00,0x10,0x01,0xae,0x07,0x32,0xfc,0xaa,0xcf,0xeb,0x01,0x00,0x34,0x00,
+0x12,0x81,0xa0,0x02,0x11,0xfa,0xc3,0x01,0x13,0x40,0xd3,0x06,0x15,0xe0,0x62,0x06,
+0x00,0x8c,0x00,0x00,0x2c,0x01,0x14,0xd0,0x21,0x07,0x54,0xf0,0x00,0x03,0x7a,0xe6,
+0x37,0x02,0x15,0xfd,0x01,0x02,0x18,0x01,0xf8,0x01,0x26,0x01,0xbf,0xf4,0x03,0x30,
+0x01,0x48,0xef,0xba,0x02,0x04,0xa4,0x07,0x15,0xff,0x0d,0x00,0x02,0x28,0x08,0x26,
+0xb3,0x00,0x1b,0x00,0x24,0xfe,0x71,0x41,0x00,0x05,0x1e,0x0b,0x06,0x36,0x00,0x22,
+0xff,0x60,0x0e,0x00,0x46,0x55,0x67,0x9c,0xff,0x2d,0x03,0x03,0xf9,0x00,0x17,0x10,
+0xb0,0x08,0x00,0x60,0x00,0x25,0x01,0x10,0x95,0x00,0x55,0xb0,0x00,0x5b,0xf9,0x00,
+0x8a,0x07,0x14,0x4a,0x99,0x00,0x00,0x63,0x00,0x14,0xda,0x5f,0x03,0x00,0xfc,0x00,
+0x24,0xfc,0x3f,0xc2,0x00,0x10,0x0a,0x09,0x00,0x00,0xe7,0x08,0x50,0xb2,0x00,0x00,
+0x00,0x1a,0xc4,0x0a,0x10,0x02,0x72,0x00,0x50,0xfb,0x86,0x67,0xaf,0xff,0x1f,0x02,
+0x17,0x06,0xeb,0x02,0x36,0x20,0x00,0x07,0x0d,0x00,0x12,0x40,0x3d,0x01,0x03,0xea,
+0x0a,0x00,0x80,0x00,0x16,0x8e,0xab,0x0c,0x00,0xf9,0x02,0x62,0x8b,0xde,0xff,0xfd,
+0xb8,0x30,0x6f,0x02,0x15,0x50,0x10,0x05,0x25,0xff,0x4d,0xef,0x02,0x10,0x5f,0xc8,
+0x0a,0x05,0x1d,0x00,0x28,0x0d,0xff,0x1d,0x00,0x28,0x07,0xff,0x1d,0x00,0x29,0x01,
+0xef,0x1d,0x00,0x19,0x9f,0x1d,0x00,0x28,0x2f,0xff,0x1d,0x00,0x27,0x0b,0xff,0x1d,
+0x00,0x00,0x7e,0x03,0x25,0xfd,0xbf,0x1d,0x00,0x00,0x80,0x00,0x15,0x4b,0x1d,0x00,
+0x00,0x1e,0x03,0x24,0xb0,0xcf,0x1d,0x00,0x00,0x31,0x01,0x25,0xf2,0x0c,0x1d,0x00,
+0x10,0x07,0xc8,0x02,0x14,0xdf,0x1d,0x00,0x10,0x01,0x76,0x01,0x15,0x0d,0x1d,0x00,
+0x10,0x9f,0x7a,0x03,0x05,0x1d,0x00,0x10,0x3f,0x30,0x02,0x05,0x1d,0x00,0x11,0x0b,
+0x14,0x00,0x04,0x1d,0x00,0x11,0x04,0x62,0x03,0x05,0x1d,0x00,0x11,0xdf,0x73,0x04,
+0x04,0x1d,0x00,0x10,0x6f,0x1a,0x04,0x05,0x1d,0x00,0x14,0x0e,0x9c,0x03,0x00,0x1d,
+0x00,0x22,0xf4,0x08,0xe1,0x09,0x03,0x1d,0x00,0x13,0x42,0x47,0x05,0x02,0x1d,0x00,
+0x22,0xf3,0xaf,0x20,0x02,0x03,0x1d,0x00,0x13,0x6f,0xb0,0x02,0x02,0x1d,0x00,0x12,
+0xfe,0xac,0x05,0x04,0x1d,0x00,0x04,0x73,0x04,0x02,0x1d,0x00,0x04,0x98,0x04,0x05,
 0x1d,0x00,0x19,0x90,0x1d,0x00,0x28,0xf1,0x00,0x1d,0x00,0x28,0xf7,0x00,0x1d,0x00,
-0x29,0xfd,0x00,0x1d,0x00,0x03,0xd1,0x01,0x02,0xf3,0x13,0x14,0x1f,0xc0,0x8b,0x04,
-0x0a,0x47,0x03,0xf9,0x8d,0x04,0x5c,0x4d,0x02,0xc1,0x27,0x14,0xf9,0x00,0x0a,0x22,
-0x20,0x00,0xeb,0x76,0x03,0x5a,0x8c,0x25,0x61,0x02,0xb6,0x7f,0x1a,0x05,0xd9,0x5a,
-0x17,0x06,0x00,0x26,0x10,0x00,0x2a,0x70,0x00,0x92,0x02,0x16,0x70,0x86,0x03,0x3f,
-0x34,0x54,0x30,0xc0,0x75,0x0f,0x06,0x8d,0x72,0x19,0x0c,0x70,0x02,0x29,0x05,0xff,
-0x8d,0x02,0x19,0xdf,0x1d,0x00,0x19,0x7f,0x1d,0x00,0x19,0x1e,0x70,0x02,0x19,0x09,
-0x70,0x02,0x29,0x02,0xff,0x1d,0x00,0x18,0xbf,0x1d,0x00,0x00,0xf2,0x04,0x16,0xdb,
-0x1d,0x00,0x00,0x5e,0x02,0x06,0x8d,0x02,0x00,0x43,0x91,0x06,0x70,0x02,0x01,0x72,
-0x8d,0x05,0x8d,0x02,0x00,0x80,0x00,0x16,0x90,0x70,0x02,0x01,0x26,0x13,0x05,0x70,
-0x02,0x01,0x37,0x17,0x05,0x1d,0x00,0x11,0x03,0x9b,0x01,0x05,0x1d,0x00,0x01,0x88,
-0x17,0x05,0x1d,0x00,0x11,0x4f,0x59,0x01,0x04,0x1d,0x00,0x02,0x96,0x74,0x04,0x1d,
-0x00,0x03,0x2b,0x71,0x04,0x1d,0x00,0x11,0xef,0x58,0x04,0x03,0x1d,0x00,0x13,0x40,
-0xe9,0x15,0x03,0x8d,0x02,0x03,0xd8,0x13,0x03,0x1d,0x00,0x16,0x3a,0xef,0x15,0x11,
-0x4d,0x04,0x2a,0x17,0xfd,0x19,0x02,0x01,0x30,0x72,0x08,0x70,0x02,0x19,0xb0,0x70,
-0x02,0x19,0xf2,0x70,0x02,0x29,0xf9,0x00,0x1d,0x00,0x19,0x10,0x1d,0x00,0x19,0x70,
-0x1d,0x00,0x19,0xd0,0x8d,0x02,0x06,0x85,0x83,0x05,0xad,0x0f,0x01,0x8e,0x08,0x05,
-0xb0,0x3e,0x18,0xcf,0xa9,0x10,0x01,0x9b,0x08,0x04,0x1b,0x00,0x14,0x1f,0xaa,0x1d,
-0x15,0xf2,0x03,0x40,0x03,0x1b,0x00,0x03,0x1a,0x3f,0x03,0x1b,0x00,0x11,0xef,0xf1,
-0x07,0x15,0x0c,0xcc,0x1c,0x15,0xf4,0xdd,0x09,0x03,0xd7,0x33,0x02,0x1b,0x00,0x13,
-0x0d,0x5c,0x08,0x01,0x1b,0x00,0x04,0x9f,0x3f,0x01,0x1b,0x00,0x03,0x48,0x97,0x02,
-0x1b,0x00,0x05,0x5d,0x51,0x00,0x1b,0x00,0x15,0x37,0x09,0x01,0x16,0xcf,0xed,0x28,
-0x06,0xfb,0x36,0x19,0x70,0x37,0x13,0x18,0x20,0x1b,0x00,0x14,0xfb,0x1b,0x00,0x24,
-0xfc,0x94,0x2e,0x7d,0x14,0x0c,0xc0,0x97,0x13,0xe1,0x1b,0x00,0x14,0xf1,0xc1,0x4b,
-0x02,0x1b,0x00,0x11,0x00,0x10,0x9b,0x04,0x1b,0x00,0x02,0x4b,0x1d,0x04,0x1b,0x00,
-0x04,0x51,0x55,0x02,0x1b,0x00,0x03,0xcc,0x07,0x03,0x1b,0x00,0x06,0xdf,0x70,0x14,
-0xf1,0x26,0x59,0x04,0x1b,0x00,0x03,0xf5,0x1e,0x16,0xcf,0x78,0x4c,0x15,0xf9,0x1b,
-0x00,0x14,0x03,0x06,0x11,0x05,0xe1,0x07,0x28,0xc0,0x0c,0xd8,0x07,0x28,0x70,0xcf,
-0xb6,0x60,0x1b,0x10,0x7a,0x09,0x1a,0x70,0x72,0x71,0x19,0xf7,0x62,0x68,0x02,0x1f,
-0x00,0x1a,0x5f,0x1f,0x00,0x1b,0x07,0x1f,0x00,0x13,0xaf,0xfa,0x0d,0x17,0xcf,0x64,
-0x3d,0x03,0x46,0x00,0x17,0x70,0xf2,0x40,0x03,0xa6,0x72,0x04,0x9f,0x0a,0x03,0x1f,
-0x00,0x05,0x7b,0x0e,0x15,0x3f,0x92,0x21,0x17,0xf9,0x1f,0x00,0x17,0x08,0x6b,0x16,
-0x17,0xf7,0xfc,0x40,0x16,0x03,0x61,0x7f,0x17,0x20,0x1f,0x00,0x17,0xff,0xd1,0x0e,
-0x14,0x70,0xa0,0x1e,0x05,0x1f,0x00,0x14,0x05,0x6c,0x00,0x03,0x1f,0x00,0x02,0x59,
-0x35,0x05,0x1f,0x00,0x05,0x23,0x0b,0x03,0x1f,0x00,0x17,0xdf,0xbb,0x5d,0x13,0xf7,
-0x4d,0x57,0x06,0x1f,0x00,0x05,0x5f,0x02,0x03,0x1f,0x00,0x05,0xdf,0x6f,0x02,0x1f,
-0x00,0x01,0x0c,0x8a,0x06,0x1f,0x00,0x28,0x03,0xff,0xc2,0x13,0x17,0x70,0x6f,0x45,
-0x00,0x1f,0x00,0x25,0x11,0x9f,0x3a,0x1d,0x00,0x1f,0x00,0x29,0x7d,0xff,0xc6,0x48,
-0x26,0xf7,0xdf,0xaf,0x1e,0x05,0x1f,0x00,0x1a,0x30,0x1f,0x00,0x1a,0x70,0x1f,0x00,
-0x15,0x80,0x68,0x15,0x00,0x79,0x13,0x27,0xc9,0x20,0x4c,0x1e,0x27,0x70,0xcf,0x13,
-0x8a,0x22,0x9f,0xff,0x89,0x15,0x05,0x24,0x17,0x14,0xef,0x11,0x00,0x26,0xff,0x40,
-0x97,0x1e,0x26,0xfc,0xcf,0xb8,0x06,0x16,0x08,0x11,0x00,0x16,0xe0,0x44,0x08,0x26,
-0xfc,0xcf,0x43,0x06,0x14,0x2f,0x11,0x00,0x02,0xeb,0x93,0x00,0x67,0x01,0x12,0xfd,
-0x11,0x00,0x15,0x9f,0x13,0x4b,0x12,0xfa,0x11,0x00,0x12,0x5f,0xc8,0x00,0x00,0xe7,
-0x94,0x02,0x11,0x00,0x15,0x3d,0xcf,0x1b,0x12,0xe4,0x11,0x00,0x11,0x49,0x65,0x01,
-0x00,0xe2,0x07,0x12,0x95,0x11,0x00,0x11,0x54,0x1a,0x01,0x00,0xb2,0x02,0x12,0x55,
-0x11,0x00,0x15,0x50,0x38,0x02,0x13,0x05,0x11,0x00,0x02,0x37,0x94,0x34,0xaf,0xff,
-0xfb,0x11,0x00,0x02,0x91,0x94,0x02,0x26,0x2a,0x01,0x11,0x00,0x40,0x2f,0xff,0xff,
-0x60,0xc1,0x01,0x14,0xf1,0x11,0x00,0x01,0xa5,0x94,0x00,0x76,0x41,0x04,0x11,0x00,
-0x10,0x07,0x33,0x03,0x12,0x0e,0xb2,0x20,0x01,0x11,0x00,0x01,0xa3,0x94,0x00,0x16,
-0x7e,0x04,0x11,0x00,0x01,0x7a,0x95,0x00,0xa7,0x95,0x04,0x11,0x00,0x00,0x77,0x79,
-0x45,0x00,0xdf,0xff,0xf7,0x11,0x00,0x00,0x2f,0x00,0x10,0x21,0xaf,0x00,0x05,0x11,
-0x00,0x11,0x0d,0xa1,0x4d,0x16,0xd0,0x11,0x00,0x11,0x08,0xc7,0x4d,0x16,0x80,0x11,
-0x00,0x11,0x03,0x4e,0x08,0x16,0x30,0x11,0x00,0x22,0x00,0xef,0x9e,0x01,0x06,0x11,
-0x00,0x03,0x5a,0x31,0x06,0x11,0x00,0x12,0x3f,0x7b,0x01,0x06,0x11,0x00,0x12,0x0e,
-0x9d,0x01,0x06,0x11,0x00,0x01,0x5f,0x56,0x08,0x11,0x00,0x15,0x04,0x4d,0x0a,0x03,
-0x11,0x00,0x00,0x81,0x61,0x19,0x00,0x11,0x00,0x36,0xaf,0xff,0xf9,0x11,0x00,0x16,
-0xf2,0x44,0x45,0x16,0x7c,0x69,0x0d,0x00,0xf9,0x44,0x0f,0x1d,0x00,0x90,0x07,0xbe,
-0x04,0x0a,0xdd,0x18,0x0f,0x1d,0x00,0x1c,0x21,0xfc,0xcc,0x01,0x00,0x1e,0xcd,0x05,
-0x01,0x0f,0x22,0x01,0xa9,0x13,0x70,0xd9,0x09,0x29,0x46,0x77,0x31,0x79,0x04,0x57,
-0x79,0x05,0x11,0x00,0x17,0x6d,0x8a,0x84,0x09,0x95,0x6e,0x01,0x2a,0x5e,0x07,0x22,
-0x44,0x05,0xcf,0x0f,0x18,0x03,0x41,0x01,0x14,0xf6,0x53,0x0c,0x58,0xfb,0x62,0x10,
-0x02,0x5a,0x32,0x69,0x15,0xd4,0x4e,0x00,0x12,0xd0,0xcc,0x02,0x16,0xd1,0x08,0x16,
-0x19,0x70,0xb9,0x49,0x02,0xcb,0x4e,0x07,0x2e,0x10,0x02,0x81,0x41,0x1b,0x5f,0x31,
-0x3e,0x28,0x90,0x09,0x2b,0x0e,0x13,0x6f,0xc6,0x5c,0x28,0xf5,0x00,0x1a,0x8a,0x18,
-0x0e,0x37,0x4a,0x01,0x0d,0x00,0x08,0x30,0x8a,0x01,0xfb,0x05,0x04,0x6b,0x2e,0x06,
-0x76,0x56,0x09,0x23,0x00,0x13,0xcf,0xfd,0x73,0x09,0x8e,0x4c,0x18,0x40,0x3a,0x11,
-0x01,0x5f,0x4d,0x09,0xaf,0x56,0x13,0x1f,0xa8,0x84,0x18,0xf8,0x47,0x11,0x16,0xd0,
-0xe0,0x78,0x04,0x8d,0x6f,0x17,0x1f,0x35,0x00,0x11,0x0f,0x96,0x06,0x02,0x34,0x3c,
-0x07,0xb4,0x54,0x16,0x05,0x42,0x23,0x12,0x04,0x98,0x07,0x28,0x0c,0xff,0xe6,0x54,
-0x13,0xfe,0x9f,0x1d,0x24,0xfc,0x40,0xe0,0x42,0x14,0x40,0x64,0x0b,0x5e,0xea,0x87,
-0x8a,0xdf,0xff,0xae,0x79,0x04,0x34,0x01,0x1d,0x7f,0x11,0x67,0x19,0x3d,0x74,0x0e,
-0x01,0x1e,0x02,0x28,0xcf,0xff,0x14,0x63,0x01,0x1f,0x32,0x25,0x9c,0xef,0xc0,0x70,
-0x0a,0x4a,0x03,0x19,0x4c,0x0e,0x00,0x1f,0xf4,0x1d,0x00,0x1c,0x12,0xcc,0x01,0x00,
-0x12,0xdf,0x1d,0x00,0x16,0xf1,0xa6,0x0c,0x16,0x4c,0x97,0x0f,0x1f,0x6f,0x1d,0x00,
-0xff,0x5b,0x24,0x40,0xcf,0x52,0x1b,0x1a,0xb7,0x52,0x1b,0x29,0xfd,0x50,0xfb,0x01,
-0x1a,0xfb,0x21,0x1d,0x19,0xd1,0x0e,0x00,0x14,0xfb,0xa9,0x15,0x33,0x67,0xae,0xff,
-0x54,0x00,0x15,0xf2,0x7f,0x02,0x15,0xb0,0x0e,0x00,0x1a,0x06,0x68,0x1c,0x00,0x52,
-0x03,0x09,0x48,0x1d,0x19,0xf4,0x29,0x1d,0x1f,0xf5,0x1c,0x00,0x05,0x00,0xb5,0x28,
-0x05,0x0e,0x00,0x19,0x04,0x54,0x00,0x01,0xf6,0x5e,0x03,0x0e,0x00,0x2d,0x01,0x38,
-0x85,0x17,0x0a,0x11,0x1f,0x18,0xd0,0x0e,0x00,0x19,0xfc,0xe0,0x00,0x17,0x80,0xfc,
-0x00,0x36,0xfd,0x81,0x00,0xfd,0x1f,0x1e,0x43,0xf9,0x16,0x0f,0x0e,0x00,0x7a,0x03,
-0x16,0x05,0x56,0x56,0x77,0x76,0x41,0x00,0x42,0x8b,0x11,0xbf,0xec,0x13,0x18,0xa4,
-0x04,0x13,0x07,0xae,0x8e,0x29,0x05,0xef,0xfc,0x72,0x09,0x13,0x0c,0x18,0xc0,0x00,
-0xa5,0x03,0x8f,0x0e,0x11,0x03,0x4b,0x01,0x46,0x52,0x00,0x02,0x6c,0xe1,0x56,0x02,
-0x8e,0x65,0x00,0x18,0x8b,0x01,0xf6,0xa6,0x04,0x5e,0x23,0x11,0x01,0x47,0x0c,0x07,
-0x16,0x28,0x10,0x01,0xec,0x25,0x17,0x01,0xba,0x50,0x35,0x07,0xfc,0x84,0xe9,0x32,
-0x02,0x22,0x00,0x0d,0x01,0x8c,0x0d,0x36,0x5c,0x09,0x20,0x4d,0x0b,0xed,0x4b,0x07,
-0x69,0x05,0x1f,0x00,0x21,0x00,0x1a,0x09,0xed,0x05,0x03,0x25,0x06,0x09,0x1e,0x11,
-0x19,0xaf,0xc0,0x80,0x03,0x4c,0x45,0x04,0x0d,0x00,0x13,0x62,0x2c,0x0b,0x14,0x20,
-0xe2,0x16,0x24,0xfc,0x61,0xfe,0x60,0x04,0xfe,0x14,0x23,0xfb,0x10,0x67,0x96,0x05,
-0xb2,0x79,0x01,0x66,0x06,0x15,0xf6,0x10,0x00,0x12,0xf6,0xba,0x24,0x01,0xd2,0x25,
-0x13,0x3b,0xf7,0x28,0x18,0x9f,0xe4,0x05,0x1b,0x20,0x60,0x7f,0x1a,0x40,0xab,0x6c,
-0x03,0xe5,0xa1,0x17,0x4e,0xb3,0x03,0x05,0x58,0x84,0x06,0x7c,0x86,0x00,0x01,0x00,
-0x16,0x26,0xdf,0x05,0x19,0x7f,0xa4,0x05,0x1a,0xd7,0xd4,0x73,0x0f,0x1d,0x00,0x18,
-0x11,0xd2,0xa3,0x19,0x13,0xef,0xb0,0x19,0x1c,0x65,0xfe,0x4e,0x0e,0xaa,0x02,0x0f,
-0x1d,0x00,0xff,0x54,0x06,0xc6,0x69,0x01,0x34,0x03,0x29,0x11,0xff,0xfd,0x05,0x11,
-0x90,0x1b,0x5e,0x07,0x51,0x19,0x06,0x31,0x66,0x11,0x4f,0x80,0x08,0x05,0x77,0x73,
-0x03,0xdd,0x3d,0x04,0x36,0x1a,0x13,0x02,0x97,0x2e,0x13,0xef,0x37,0x11,0x03,0xec,
-0x91,0x04,0xcb,0xa8,0x03,0x17,0x9b,0x04,0x88,0x00,0x17,0x08,0xd9,0x0f,0x15,0xfb,
-0x0e,0x26,0x05,0x35,0x51,0x14,0x6f,0xbc,0x00,0x23,0x01,0xef,0x15,0x03,0x16,0xfb,
-0x5a,0x4b,0x13,0x70,0x00,0x29,0x05,0xab,0x11,0x16,0xbf,0x76,0x03,0x12,0x2f,0xfc,
-0x2f,0x17,0xf3,0x6d,0x1a,0x1b,0xfc,0xc2,0x2d,0x08,0xc5,0x03,0x1a,0x05,0x8e,0x58,
-0x02,0xea,0x16,0x19,0xf4,0x1c,0xa0,0x09,0x27,0x85,0x1a,0x8f,0x9d,0x60,0x08,0x69,
-0x52,0x08,0x89,0x1f,0x16,0x00,0x30,0x18,0x08,0x29,0xa4,0x0a,0x7f,0x84,0x08,0x76,
-0x79,0x48,0x03,0xfa,0x64,0x49,0x91,0x28,0x03,0x45,0x47,0x0b,0x0b,0x2e,0x19,0x30,
-0xcf,0xa5,0x06,0x0a,0x55,0x1a,0x9f,0x65,0x57,0x1a,0x0b,0x44,0x85,0x00,0xcf,0xaa,
-0x2e,0xfe,0xb7,0x01,0x86,0x1a,0xcf,0xbc,0x00,0x03,0x4e,0x01,0x1f,0xfc,0x27,0x00,
-0x0c,0x42,0x01,0x59,0xcd,0xef,0x1d,0x08,0x24,0xc9,0x51,0x38,0xa7,0x08,0x4f,0x07,
-0x05,0x1e,0x81,0x0b,0x78,0x0a,0x07,0x37,0x60,0x04,0x53,0x65,0x0b,0x47,0x0a,0x01,
-0x68,0x00,0x10,0x9f,0xe5,0x0a,0x11,0x41,0x75,0x00,0x22,0x01,0x49,0xd6,0x00,0x12,
-0x2f,0x9b,0x25,0x02,0x9c,0x00,0x24,0x02,0xdf,0x53,0x33,0x15,0xe1,0x9c,0x00,0x11,
-0x02,0xfd,0x41,0x03,0xa3,0x5f,0x03,0xc3,0x00,0x01,0x11,0x31,0x04,0xd2,0x11,0x03,
-0xc3,0x00,0x17,0x1f,0xb1,0x3d,0x04,0xea,0x00,0x12,0xdf,0x6c,0x45,0x17,0xfa,0x27,
-0x00,0x10,0x0b,0xcf,0x93,0x03,0x05,0x03,0x04,0x27,0x00,0x00,0x6e,0x08,0x04,0xbf,
-0x65,0x07,0x27,0x00,0x13,0x32,0xc3,0x01,0x08,0x4e,0x00,0x04,0x2e,0x3b,0x07,0x75,
-0x00,0x04,0x14,0x14,0x03,0x27,0x00,0x01,0xde,0x7a,0x16,0x05,0x78,0x4a,0x03,0x53,
-0x44,0x01,0x4d,0x16,0x06,0xea,0x00,0x12,0x03,0xef,0x5b,0x10,0x4f,0x11,0x01,0x12,
-0x40,0x27,0x00,0x13,0x49,0xe2,0x05,0x15,0x9f,0xab,0x6a,0x15,0xef,0xfa,0x01,0x0b,
-0x4c,0x21,0x18,0x90,0x40,0x43,0x08,0xff,0x1a,0x18,0x19,0xf3,0x67,0x15,0x10,0x8e,
-0x96,0x08,0x32,0x27,0x0f,0x22,0x02,0x2c,0x0f,0x27,0x00,0x11,0x16,0x04,0xfc,0x1d,
-0x02,0x07,0x15,0x15,0x9f,0x18,0x07,0x02,0x0a,0x00,0x04,0x31,0x1d,0x03,0xf4,0x33,
-0x06,0x8e,0x13,0x04,0x78,0x13,0x04,0x66,0x0d,0x03,0xd6,0x92,0x04,0xce,0x5a,0x05,
-0x3d,0x1d,0x12,0x04,0xe9,0x01,0x06,0x6b,0x6b,0x02,0x3f,0x92,0x18,0x5f,0x76,0x19,
-0x02,0x0a,0x1f,0x17,0xf3,0x55,0x1e,0x08,0x66,0x08,0x00,0xa1,0x16,0x08,0x64,0x78,
-0x00,0x97,0x16,0x08,0x66,0x83,0x1c,0x03,0xed,0x87,0x14,0x9f,0xaf,0x6e,0x08,0xdc,
-0x5c,0x1a,0xf5,0xf1,0x03,0x08,0x2a,0x01,0x1b,0x0b,0x38,0x8f,0x1a,0x5f,0xa1,0xaa,
-0x2a,0x01,0xef,0xc8,0x03,0x16,0x0a,0xab,0x72,0x05,0xcf,0x56,0x07,0xab,0x7d,0x01,
-0x2a,0x05,0x16,0x0d,0x63,0x04,0x01,0xee,0x14,0x16,0x04,0xf2,0x1e,0x00,0x5a,0x38,
-0x05,0x16,0x31,0x02,0x2f,0x00,0x03,0x49,0x78,0x17,0x30,0x76,0xa5,0x05,0xac,0x0e,
-0x04,0xab,0x62,0x04,0x20,0x6c,0x04,0x29,0x01,0x16,0x2f,0xd3,0xa0,0x15,0x80,0x36,
-0x6c,0x04,0xad,0x35,0x06,0x2b,0x63,0x05,0xf4,0xaa,0x02,0xd5,0x1e,0x04,0xb7,0x40,
-0x04,0x44,0x41,0x05,0xb7,0x1e,0x03,0xf3,0x4a,0x06,0xac,0x06,0x02,0xc0,0x38,0x0f,
-0x10,0x00,0xff,0x91,0x26,0xfc,0xcc,0x0e,0x26,0x1b,0xc8,0xca,0x05,0x1f,0xfb,0x10,
-0x00,0x2d,0x09,0xba,0x0c,0x0f,0x10,0x00,0x80,0x19,0x6f,0x50,0x1d,0x16,0x86,0x9c,
-0x07,0x00,0x6e,0x22,0x0f,0x1d,0x00,0x73,0x16,0x40,0x1d,0x00,0x06,0xe9,0xa0,0x00,
-0x1d,0x00,0x16,0x84,0x8c,0x03,0x00,0x1d,0x00,0x05,0xfa,0x27,0x02,0x8f,0x5a,0x14,
-0xef,0x5d,0x6f,0x10,0x01,0x62,0x05,0x10,0x09,0xd2,0x04,0x51,0x95,0x32,0x23,0x57,
-0xad,0x68,0x06,0x09,0xa5,0x23,0x1a,0xf8,0x29,0x0c,0x19,0x80,0x83,0x06,0x14,0xf8,
-0xd5,0xa1,0x32,0xff,0xfb,0x68,0x92,0x3b,0x00,0x24,0x7d,0x33,0xec,0xa7,0x30,0x90,
-0x23,0x08,0x32,0x0d,0x07,0xd7,0x0d,0x0f,0x1d,0x00,0x74,0x02,0x9f,0x65,0x06,0xe3,
-0x1a,0x01,0x1e,0x05,0x05,0x9b,0x30,0x05,0x8f,0x8d,0x00,0xcd,0x22,0x0f,0x2b,0x00,
-0xff,0xff,0x0b,0x02,0xdc,0x14,0x17,0xcf,0x39,0x2b,0x1c,0xf0,0xf3,0x0a,0x05,0x29,
-0x85,0x0d,0x01,0x00,0x0f,0x2b,0x00,0x2e,0x03,0x65,0x68,0x02,0x68,0x08,0x07,0xcb,
-0x2b,0x0f,0x17,0x00,0xff,0xff,0x48,0x01,0x12,0x08,0x00,0x4a,0x0c,0x06,0x19,0x08,
-0x1e,0xc6,0x9a,0x02,0x01,0x79,0x0c,0x0f,0x17,0x00,0x49,0x1e,0x00,0x01,0x00,0x1f,
-0x04,0x17,0x00,0xbf,0x0c,0xe4,0x15,0x10,0x02,0x78,0x01,0x0a,0x01,0x12,0x02,0x96,
-0x28,0x0f,0x29,0x00,0xd2,0x08,0xba,0x7a,0x04,0x29,0x00,0x08,0xb6,0x18,0x0a,0x29,
-0x00,0x04,0xd7,0x16,0x0b,0x29,0x00,0x01,0xc9,0x0c,0x0d,0x29,0x00,0x03,0x68,0x22,
-0x14,0xfc,0x29,0x37,0x11,0x68,0xc8,0x56,0x0c,0xa4,0x00,0x12,0x2c,0xeb,0x0d,0x0a,
-0xa4,0x00,0x02,0x6e,0x70,0x0b,0xcd,0x00,0x02,0x88,0x0d,0x0a,0x29,0x00,0x02,0xf7,
-0x2d,0x0b,0x29,0x00,0x02,0xdd,0x22,0x0a,0x29,0x00,0x02,0x61,0x16,0x0b,0x29,0x00,
-0x02,0xdb,0x8b,0x09,0x29,0x00,0x12,0x02,0x82,0x53,0x04,0x29,0x00,0x15,0x76,0x5a,
-0x37,0x1e,0xb0,0xf6,0x00,0x00,0x33,0x00,0x0d,0xf6,0x00,0x1e,0xf4,0x1f,0x01,0x01,
-0x34,0x28,0x0c,0x29,0x00,0x1d,0x80,0x71,0x01,0x26,0xec,0x95,0x99,0x64,0x0f,0x11,
-0x39,0x59,0x0f,0x6b,0x39,0xff,0x71,0x02,0x17,0x11,0x46,0x56,0x77,0x65,0x31,0xa1,
-0x03,0x02,0x67,0x21,0x2b,0xd8,0x30,0x68,0x1a,0x2a,0xfc,0x30,0x99,0x18,0x02,0x83,
-0x0b,0x1a,0x05,0x8c,0x03,0x09,0x6d,0xab,0x13,0xfa,0x51,0x2a,0x52,0xd7,0x30,0x00,
-0x13,0x7d,0x19,0x11,0x15,0x07,0x52,0x2b,0x11,0x6f,0x26,0x12,0x19,0x0e,0xd7,0x24,
-0x45,0xf8,0x00,0x1a,0xef,0x4a,0x20,0x12,0x5f,0xb4,0x03,0x2e,0x7b,0xd0,0x66,0x76,
-0x0e,0x14,0x0c,0x0b,0x58,0x67,0x0a,0x8b,0x68,0x1b,0x0b,0x8d,0x36,0x18,0x0b,0x11,
-0x3c,0x09,0x10,0x00,0x1f,0xf2,0x10,0x00,0x0c,0x12,0xf1,0xcd,0x05,0x02,0xca,0x32,
-0x0a,0xfa,0x6c,0x0d,0x9d,0x1a,0x03,0x38,0x32,0x14,0x28,0xb4,0x00,0x02,0x90,0x28,
-0x38,0x5b,0xff,0xb0,0x9d,0x20,0x16,0x6e,0x6f,0x12,0x01,0x74,0x81,0x15,0x4f,0x8f,
-0x12,0x24,0x02,0xef,0x51,0x28,0x02,0x59,0x7d,0x11,0x3e,0x6f,0x00,0x14,0x03,0x46,
-0x16,0x24,0x18,0xff,0x31,0x27,0x00,0xe4,0xaa,0x24,0x78,0x9d,0x84,0x0f,0x1b,0x0a,
-0xb1,0x15,0x28,0x00,0x9f,0x1d,0x1d,0x06,0x36,0xae,0x06,0x8d,0x16,0x25,0x18,0xef,
-0x50,0x80,0x06,0xb3,0x2e,0x2e,0xed,0xa8,0x54,0x2c,0x00,0x27,0x02,0x1d,0x20,0x11,
-0x69,0x13,0xbf,0x2f,0xa1,0x09,0x88,0x03,0x17,0x7e,0xfb,0x95,0x05,0x2d,0x00,0x28,
-0x02,0xcf,0xd4,0x1a,0x05,0xb2,0x2a,0x16,0xef,0xae,0x02,0x15,0x10,0x2d,0x00,0x08,
-0x6b,0x7a,0x16,0xfc,0x2d,0x00,0x01,0x29,0x27,0x58,0x51,0x00,0x15,0xaf,0xff,0xcd,
-0x2a,0x14,0x6f,0xf1,0x22,0x27,0x4e,0xff,0xf1,0x2a,0x14,0x0e,0x9d,0x60,0x24,0x00,
-0x2e,0x34,0xa7,0x19,0x20,0x96,0xb1,0x01,0xe5,0x7c,0x03,0x2d,0x00,0x04,0xbb,0x6f,
-0x03,0x41,0x76,0x03,0x2d,0x00,0x16,0x0d,0xcd,0x13,0x16,0x06,0x1d,0x05,0x17,0x01,
-0xf9,0x01,0x16,0x1f,0x37,0x0c,0x17,0xcf,0xf4,0x22,0x03,0x15,0x1f,0x07,0x18,0x03,
-0x04,0x48,0x02,0x19,0x5c,0x1e,0x03,0x08,0x7c,0x3b,0x0b,0x49,0x33,0x19,0x09,0xf1,
-0x24,0x18,0xf9,0xec,0x30,0x0e,0x2d,0x00,0x00,0xf6,0x01,0x15,0x6c,0x65,0x86,0x17,
-0xfb,0x42,0x6e,0x16,0xf5,0xb4,0x00,0x17,0xd0,0x79,0x02,0x12,0x3c,0x2d,0x00,0x17,
-0x0e,0x40,0x1d,0x03,0x69,0x04,0x16,0xf2,0xea,0x34,0x04,0x72,0x80,0x03,0x0e,0x01,
-0x07,0x67,0x1a,0x13,0x0a,0x03,0x3c,0x14,0xf2,0xc9,0x49,0x05,0x82,0x03,0x14,0xf3,
-0x95,0x01,0x15,0xbf,0x52,0x01,0x17,0xbf,0xb7,0x3c,0x06,0xfd,0xb2,0x22,0x9f,0xff,
-0xe5,0x27,0x04,0x25,0x44,0x01,0x60,0x04,0x29,0x03,0xcf,0xa1,0x36,0x11,0x1e,0xeb,
-0x52,0x02,0xdd,0x02,0x16,0xe2,0x49,0x02,0x19,0x2f,0xf5,0x06,0x05,0x76,0x02,0x18,
-0x3e,0x16,0x00,0x06,0xa3,0x02,0x16,0x1b,0x4b,0x3d,0x08,0xa3,0x02,0x26,0x04,0xcf,
-0x45,0x7e,0x08,0x87,0x1b,0x66,0x27,0xad,0xef,0xfe,0xda,0x72,0x02,0x16,0x28,0x8b,
-0xde,0x61,0x07,0x29,0x18,0xef,0x7c,0x00,0x2a,0x04,0xef,0x81,0x07,0x1a,0x4f,0x91,
-0x07,0x1a,0x01,0x4a,0x23,0x02,0x9d,0x03,0x20,0xd9,0x76,0x3d,0x04,0x01,0x0c,0x1f,
-0x15,0x0f,0xaa,0x25,0x02,0x46,0x2b,0x07,0x05,0x9d,0x01,0x10,0x00,0x05,0xb9,0x34,
-0x03,0x10,0x00,0x06,0x7d,0x78,0x02,0x10,0x00,0x1b,0x7f,0x10,0x00,0x05,0x7e,0x36,
-0x03,0x10,0x00,0x07,0x8f,0xab,0x01,0x10,0x00,0x19,0x0d,0x2b,0x82,0x11,0xf4,0xbd,
-0x05,0x27,0xfd,0x62,0xc2,0x6c,0x1b,0xbf,0x51,0x08,0x1c,0x1d,0x61,0x08,0x1b,0xaf,
-0x10,0x00,0x2a,0x03,0xaf,0x10,0x00,0x08,0xaa,0x8b,0x14,0xf4,0x90,0x42,0x14,0x76,
-0xf0,0x00,0x04,0x27,0x2d,0x06,0x36,0x2c,0x14,0x07,0x56,0x18,0x15,0xaf,0xc1,0x08,
-0x27,0xff,0x60,0x10,0x00,0x05,0x46,0x02,0x02,0x10,0x00,0x04,0x83,0x19,0x04,0x10,
-0x00,0x15,0x1e,0x04,0x06,0x02,0x10,0x00,0x00,0xd7,0x70,0x07,0xe0,0x00,0x07,0xed,
-0x03,0x14,0xaf,0x13,0x8b,0x08,0x00,0x01,0x1a,0x9f,0x70,0x01,0x02,0x83,0x06,0x06,
-0x10,0x00,0x17,0x0d,0x35,0x03,0x03,0x90,0x00,0x00,0x8a,0x6b,0x29,0xda,0x71,0xc7,
-0x9c,0x15,0x90,0x69,0xb5,0x04,0x9f,0x7f,0x18,0x0c,0xac,0x8c,0x00,0x66,0x04,0x35,
-0x85,0x57,0xef,0x77,0x78,0x12,0xf2,0xca,0x36,0x05,0x94,0xa5,0x12,0x07,0xf7,0x09,
-0x30,0x66,0x66,0x66,0x00,0x03,0x08,0x70,0x1c,0x18,0x02,0x4b,0x18,0x03,0x56,0x78,
-0x01,0xe9,0xc6,0x04,0xbe,0x05,0x27,0x04,0xdf,0xcb,0x05,0x17,0x7f,0xfe,0x0a,0x11,
-0x04,0xfe,0x7b,0x25,0xaa,0xab,0xf7,0x2c,0x14,0x90,0x41,0x00,0x03,0xa9,0x50,0x14,
-0x02,0x9d,0x62,0x14,0xf6,0xa1,0x1d,0x04,0xa6,0x43,0x02,0x50,0x37,0x03,0xb9,0xab,
-0x14,0x1f,0x27,0x00,0x04,0xfc,0xab,0x13,0x80,0x2c,0x72,0x12,0x2c,0x18,0x19,0x10,
-0x1f,0x41,0x03,0x11,0xac,0xfc,0x66,0x33,0xf9,0x45,0x09,0x16,0x08,0x01,0xba,0x2e,
-0x03,0x22,0x3e,0x11,0x90,0xf2,0x02,0x02,0x83,0x03,0x12,0xf6,0x1f,0x19,0x00,0xb5,
-0xc3,0x01,0xdc,0x1c,0x46,0x19,0xef,0xfd,0xa5,0xbd,0x07,0x24,0x46,0x8a,0x9c,0xa2,
-0x25,0x58,0xad,0x62,0x66,0x16,0x6b,0x07,0x1b,0x27,0x02,0xaf,0x14,0x1b,0x17,0x8f,
-0x21,0x1b,0x18,0x0b,0xe5,0x95,0x12,0xdf,0xda,0x08,0x23,0x75,0x42,0x54,0x04,0x35,
-0xfb,0x84,0x10,0x5d,0x07,0x17,0xc5,0x4b,0x28,0x18,0xf6,0x99,0x0d,0x17,0x40,0x37,
-0xc4,0x00,0x85,0xb0,0x32,0x68,0x87,0x64,0x9f,0x1a,0x34,0xf1,0x00,0x29,0xac,0x81,
-0x11,0x2f,0x90,0x8d,0x03,0xbc,0x06,0x45,0x5f,0xff,0x80,0x7f,0x63,0x07,0x36,0x7f,
-0xff,0x54,0xd2,0x05,0x10,0x9f,0x98,0x31,0x31,0x83,0x10,0x16,0xae,0x67,0x35,0xaf,
-0xff,0x8f,0x73,0x8a,0x30,0xb0,0xbf,0xff,0x71,0xa5,0x03,0xa8,0x7c,0x05,0x3b,0x28,
-0x13,0xbf,0xc3,0x40,0x05,0x55,0x64,0x08,0x3c,0x7f,0x27,0xf9,0xbf,0xee,0x2e,0x05,
-0x95,0xb1,0x01,0x40,0x39,0x18,0x8f,0x0d,0x00,0x17,0x6f,0x27,0x00,0x24,0xf9,0x3f,
-0x39,0x16,0x12,0x6f,0x8b,0x01,0x15,0xf9,0xa3,0x1f,0x14,0x0a,0x1c,0x03,0x00,0x47,
-0x1a,0x01,0x2b,0xaf,0x05,0xbf,0xa1,0x03,0x87,0x4e,0x15,0x8f,0xd3,0x78,0x32,0xea,
-0x89,0xbf,0xa9,0x05,0x19,0x06,0x44,0x24,0x18,0x5f,0xbb,0x06,0x13,0x02,0x2a,0x8c,
-0x03,0x3f,0x4c,0x23,0x6a,0xde,0x4a,0x55,0x13,0xaf,0xfc,0x9f,0x27,0xc9,0x51,0x8e,
-0x08,0x00,0x6c,0x56,0x17,0xaf,0x2f,0xa0,0x18,0x0a,0xc1,0x0a,0x00,0xdb,0x00,0x53,
-0x22,0x22,0x23,0x5b,0xff,0xcf,0x9e,0x04,0x48,0x04,0x26,0xc0,0xaf,0xeb,0x3e,0x24,
-0xfe,0x0a,0xab,0x06,0x00,0x58,0x03,0x07,0x19,0x00,0x14,0xfa,0x19,0x00,0x13,0x07,
-0xf4,0x6b,0x65,0xf1,0x11,0x11,0x12,0x5a,0xff,0x1e,0x49,0x03,0x1b,0x02,0x05,0x7d,
-0x00,0x18,0xc5,0x96,0x00,0x28,0xea,0x40,0xd2,0x04,0x13,0xb0,0x4b,0x00,0x23,0x02,
-0x6c,0xfd,0xb8,0x14,0xf0,0xec,0x06,0x00,0xcf,0x82,0x05,0x93,0xb4,0x04,0x19,0x00,
-0x00,0xde,0x05,0x17,0x9a,0x19,0x00,0x14,0xf9,0x19,0x00,0x00,0x93,0x02,0x00,0x26,
-0x43,0x50,0x22,0x22,0x22,0x24,0x7d,0xf0,0x01,0x17,0xaf,0x66,0x17,0x18,0x0a,0x20,
-0x0b,0x17,0xaf,0x9a,0x0c,0x14,0x0a,0xc3,0x27,0x25,0xb8,0x30,0x45,0x01,0x1f,0xfb,
-0x08,0x00,0x08,0x54,0xf7,0x77,0x77,0x77,0x75,0x73,0x00,0x0f,0x08,0x00,0x8d,0x09,
-0x8a,0x0a,0x05,0x84,0x52,0x08,0x0f,0x00,0x1a,0xdf,0x0f,0x00,0x0a,0x14,0x92,0x00,
-0x36,0x03,0x34,0x77,0x77,0x7b,0x0f,0x00,0x11,0x04,0x68,0x0f,0x17,0x07,0xab,0x7f,
-0x17,0xfb,0x0f,0x00,0x02,0x3d,0x72,0x17,0x07,0x36,0x34,0x17,0xf7,0x0f,0x00,0x02,
-0x27,0x54,0x17,0x07,0x4c,0x08,0x17,0xf1,0x0f,0x00,0x01,0x27,0x54,0x06,0x0f,0x00,
-0x02,0xe7,0x4d,0x17,0x07,0x50,0x35,0x17,0x80,0x0f,0x00,0x02,0xad,0x05,0x04,0x0f,
-0x00,0x03,0x86,0x55,0x04,0x0f,0x00,0x12,0x09,0x88,0x1e,0x04,0x0f,0x00,0x03,0x51,
-0x4e,0x04,0x0f,0x00,0x16,0x4f,0xff,0x06,0x03,0x2d,0x09,0x16,0xe0,0x0f,0x00,0x01,
-0xbc,0xb2,0x05,0x0f,0x00,0x10,0x57,0x06,0x0a,0x22,0x97,0x77,0xff,0x00,0x3a,0x97,
-0x74,0xaf,0x3b,0x13,0x0f,0x0f,0x00,0x1d,0x16,0x10,0x50,0x06,0x0f,0x0f,0x00,0x75,
-0x01,0xa3,0x22,0x06,0xde,0x8f,0x17,0x18,0xe9,0x20,0x17,0x2d,0xee,0x8b,0x17,0x2e,
-0xfb,0x8b,0x00,0xd4,0x06,0x31,0xa5,0x33,0x7e,0x47,0x05,0x03,0xf7,0x4d,0x11,0x1d,
-0xeb,0x07,0x03,0x95,0x24,0x01,0xa3,0xc5,0x13,0x5f,0x18,0x05,0x00,0xe3,0x4b,0x16,
-0x09,0x57,0x04,0x01,0x29,0x7b,0x63,0xe1,0x11,0x11,0x11,0x11,0x6f,0x5d,0x89,0x05,
-0x30,0x4b,0x08,0x26,0xcf,0x08,0x70,0x86,0x18,0x01,0xba,0x17,0x18,0x0f,0x23,0x24,
-0x08,0x28,0x2e,0x18,0x0c,0x8d,0x28,0x17,0x9f,0xd2,0x24,0x13,0x05,0xd0,0x01,0x36,
-0x04,0x54,0x31,0x61,0x82,0x13,0xef,0x75,0x07,0x24,0xfd,0x20,0xbf,0x80,0x00,0x02,
-0x03,0x22,0xa7,0x7a,0x43,0x28,0x18,0x03,0xf9,0x0b,0x18,0x03,0x96,0xb4,0x03,0x90,
-0x0f,0x15,0xd4,0x02,0x60,0x02,0x1a,0x74,0x00,0xf0,0x7f,0x06,0xab,0xc6,0x00,0x2f,
-0x57,0x03,0x90,0x02,0x14,0x0f,0xc9,0x74,0x02,0xb3,0x2e,0x14,0x80,0x12,0x00,0x11,
-0x08,0xc7,0x00,0x11,0x3f,0x7a,0x00,0x02,0x12,0x00,0x11,0x1f,0x94,0x02,0x14,0x0b,
-0x3e,0x8a,0x01,0x0f,0xcd,0x04,0x60,0x13,0x12,0x10,0x12,0x00,0x13,0x01,0xbd,0x00,
-0x13,0x9f,0x3d,0x94,0x15,0xf0,0xaa,0x75,0x13,0x1f,0x58,0x54,0x15,0xf0,0xcd,0x4c,
-0x13,0x07,0x43,0x57,0x10,0xf0,0x05,0x04,0x15,0x80,0x8d,0x53,0x00,0x12,0x00,0x15,
-0x04,0xa7,0x09,0x12,0x5f,0x7f,0x23,0x25,0xf0,0x2e,0xf0,0x1c,0x12,0x0a,0x77,0x98,
-0x16,0xfa,0xab,0x09,0x2c,0x01,0xff,0x21,0x96,0x1a,0x09,0x15,0x14,0x02,0xc7,0x03,
-0x11,0xee,0x76,0x06,0x08,0x6e,0x2c,0x10,0x70,0x5a,0x00,0x14,0x06,0x10,0x0d,0x00,
-0xc8,0x33,0x02,0x90,0x00,0x04,0x9e,0x39,0x01,0xd7,0xcb,0x01,0x12,0x00,0x04,0x7b,
-0x3b,0x10,0x5f,0xbc,0x00,0x13,0x0f,0x37,0x81,0x04,0xb7,0xb5,0x03,0xea,0x00,0x16,
-0x08,0xc8,0x5d,0x16,0x20,0x0e,0x01,0x02,0x8f,0xb9,0x14,0xfa,0x32,0x01,0x02,0xa0,
-0x5c,0x11,0x7f,0xfd,0x01,0x02,0x12,0x00,0x01,0xcb,0xb7,0x15,0x01,0x8c,0xa3,0x13,
-0xf0,0xf6,0x59,0x03,0x07,0x83,0x02,0x12,0x00,0x01,0x1b,0x5a,0x03,0x71,0x78,0x03,
-0xb0,0x01,0x02,0xa9,0x0c,0x00,0xe7,0x23,0x27,0xed,0xa5,0x53,0x0f,0x17,0xf7,0x05,
-0xbe,0x07,0x62,0xbf,0x11,0xfa,0x97,0x00,0x21,0xa5,0x45,0xaf,0x53,0x02,0x8d,0x52,
-0x01,0x57,0x76,0x45,0x1d,0xef,0xff,0x90,0xbd,0xb8,0x10,0x12,0x53,0x03,0x04,0xfc,
-0x00,0x02,0x71,0x76,0x02,0x60,0x01,0x14,0x26,0x8c,0x31,0x16,0x07,0x81,0x2a,0x01,
-0x0e,0x7f,0x03,0x6c,0xc8,0x06,0x77,0x2c,0x16,0x07,0x67,0x93,0x35,0x01,0x34,0x69,
-0x51,0x81,0x05,0xcf,0x34,0x07,0xcb,0x46,0x14,0x25,0x52,0x28,0x24,0x49,0xcf,0x1b,
-0xc3,0x13,0xf3,0x67,0x01,0x00,0xa5,0x28,0x15,0x1f,0xab,0x63,0x01,0x3d,0xab,0x34,
-0xe8,0x79,0xdf,0x84,0x59,0x04,0xbc,0x4e,0x17,0x1c,0xb7,0x0d,0x15,0x8f,0x53,0x3f,
-0x00,0x2d,0x64,0x02,0xb1,0x14,0x02,0x5c,0x4f,0x02,0xe5,0x3a,0x03,0x0c,0x00,0x26,
-0x05,0xff,0x0c,0x00,0x17,0x0e,0x0c,0x00,0x16,0x7f,0x0c,0x00,0x26,0x01,0xff,0x0c,
-0x00,0x17,0x09,0x0c,0x00,0x17,0x2f,0x0c,0x00,0x16,0xbf,0x0c,0x00,0x11,0x04,0xb5,
-0x75,0x23,0xf3,0xaf,0x49,0x0b,0x13,0x9a,0x0c,0x00,0x00,0x5e,0x09,0x13,0x1c,0x0c,
-0x00,0x53,0x01,0xef,0xff,0xf7,0x0d,0x0c,0x00,0x53,0x09,0xff,0xff,0xe0,0x0e,0x9b,
-0x3e,0x12,0x2f,0xce,0x3e,0x23,0xf3,0xaf,0x00,0x37,0x03,0x0c,0x00,0x10,0x44,0x1c,
-0x02,0x03,0x0c,0x00,0x13,0x3d,0x03,0xc9,0x00,0x0c,0x00,0x01,0xfe,0xc9,0x03,0x0c,
-0x00,0x10,0xef,0xcc,0x03,0x14,0x0e,0xae,0xbe,0x17,0xe1,0x0c,0x00,0x16,0x60,0x0c,
-0x00,0x26,0xfd,0x00,0x0c,0x00,0x17,0xf5,0x0c,0x00,0x17,0xc0,0x0c,0x00,0x04,0xcd,
-0xca,0x04,0x8a,0x42,0x01,0xd9,0xca,0x14,0x8f,0x15,0x27,0x10,0xf7,0x26,0x0a,0x01,
-0x04,0x02,0x04,0x0a,0x17,0x11,0x30,0x44,0x01,0x02,0xfd,0x84,0x11,0xd1,0xa9,0x0c,
-0x11,0xc0,0x12,0x00,0x45,0xfe,0x85,0x58,0xef,0x0f,0x43,0x05,0xfc,0x13,0x18,0x07,
-0xb8,0x6e,0x10,0x06,0x38,0x0f,0x0f,0xe4,0xb1,0x09,0x0f,0xb0,0x01,0xff,0x26,0x03,
-0x43,0x09,0x00,0x5a,0x6e,0x02,0x0b,0x00,0x14,0x05,0xc9,0xd7,0x03,0xdc,0x08,0x02,
-0x0b,0x00,0x01,0xc2,0x54,0x14,0xaf,0xd9,0x1b,0x12,0x60,0x0b,0x00,0x02,0x29,0x09,
-0x13,0xaf,0x3a,0xa3,0x13,0xf5,0x0b,0x00,0x02,0x10,0x3f,0x01,0x0b,0x00,0x02,0xba,
-0x40,0x12,0xaf,0xd9,0xd4,0x13,0xfb,0xb1,0x09,0x18,0x7f,0x0a,0x98,0x26,0xff,0x30,
-0x15,0x98,0x07,0x21,0x5b,0x13,0x50,0x0b,0x00,0x03,0xcb,0xb9,0x00,0x37,0x00,0x03,
-0xea,0x74,0x16,0xaf,0xe1,0x05,0x04,0x63,0x00,0x13,0x70,0x0b,0x00,0x01,0x5f,0x05,
-0x02,0x0b,0x00,0x14,0x0d,0x7d,0xd5,0x13,0xf0,0x39,0x09,0x14,0xaf,0xd8,0x5c,0x13,
-0xa0,0x0b,0x00,0x13,0x6f,0xc3,0x61,0x02,0x3d,0xb2,0x13,0xfb,0x0b,0x00,0x13,0x06,
-0xe6,0x0b,0x14,0xf0,0x5e,0x52,0x08,0xc4,0x9b,0x19,0xf2,0xf8,0x30,0x19,0xf2,0x2a,
-0x06,0x1c,0xf2,0xd9,0x15,0x00,0x56,0x00,0x12,0xf9,0xd7,0xc1,0x03,0xbf,0x3a,0x12,
-0xf2,0x7b,0x02,0x16,0xf2,0xae,0x56,0x03,0x0e,0x00,0x03,0x69,0x56,0x03,0x0e,0x00,
-0x00,0x31,0x43,0x06,0x0e,0x00,0x03,0x2b,0x56,0x15,0x7f,0x3a,0x13,0x16,0x60,0x0e,
-0x00,0x15,0xdf,0xe3,0x35,0x16,0xf2,0x1b,0x89,0x15,0x7f,0xbf,0x19,0x15,0x00,0x0e,
-0x00,0x02,0x39,0x54,0x04,0x0e,0x00,0x04,0x20,0x54,0x14,0x7f,0x80,0x5e,0x16,0xf7,
-0x0e,0x00,0x16,0x0e,0xcf,0x8a,0x16,0xf2,0x55,0x57,0x14,0x7f,0xe2,0x94,0x15,0xc0,
-0x0e,0x00,0x03,0x9d,0x06,0x02,0x0e,0x00,0x24,0x34,0x4d,0x3d,0x07,0x12,0x7f,0x0a,
-0x48,0x03,0x14,0x07,0x04,0x0e,0x00,0x19,0xf2,0x0e,0x00,0x17,0x50,0x0e,0x00,0x35,
-0xfd,0xa3,0x00,0x0e,0x00,0x06,0x4e,0xb7,0x23,0x9f,0xff,0x0f,0x00,0x15,0xf8,0xa3,
-0x2d,0x14,0xf2,0xe4,0x02,0x02,0x0c,0x42,0x24,0xf2,0xaf,0xb0,0x07,0x16,0x07,0x0f,
-0x00,0x13,0x70,0x1d,0x11,0x00,0x0f,0x00,0x14,0xfd,0x6d,0x2b,0x11,0xfd,0x0f,0x00,
-0x23,0xfe,0xbf,0x41,0xa1,0x12,0xfa,0x2d,0x00,0x13,0x6f,0xc9,0x4d,0x12,0xf7,0x0f,
-0x00,0x31,0x2f,0xff,0xfb,0x42,0x01,0x12,0xa8,0x0f,0x00,0x10,0x1c,0x32,0x02,0x11,
-0x04,0x03,0x62,0x00,0x0f,0x00,0x40,0x17,0xff,0xff,0x50,0xeb,0x01,0x12,0x19,0x0f,
-0x00,0x12,0x22,0xa7,0x03,0x22,0xfc,0x09,0x0f,0x00,0x84,0x20,0xdf,0xff,0xf0,0x00,
-0x3f,0xff,0xf7,0x0f,0x00,0x11,0x8f,0x4a,0x13,0x14,0xf2,0x0f,0x00,0x11,0x3f,0xeb,
-0x51,0x14,0xd0,0x0f,0x00,0x42,0x0e,0xff,0xfd,0x01,0x27,0x86,0x01,0x0f,0x00,0x11,
-0x09,0xc2,0xc5,0x14,0x40,0x0f,0x00,0x01,0x74,0x00,0x24,0xfe,0x00,0x0f,0x00,0x66,
-0x00,0xef,0xff,0x9c,0xff,0xfa,0x0f,0x00,0x56,0xaf,0xff,0xcf,0xff,0xf5,0x0f,0x00,
-0x02,0x1d,0x85,0x05,0x0f,0x00,0x11,0x0f,0xb5,0x07,0x05,0x0f,0x00,0x02,0xe9,0x2a,
-0x05,0x0f,0x00,0x02,0x59,0x08,0x05,0x0f,0x00,0x11,0x01,0x4e,0x01,0x04,0x0f,0x00,
-0x00,0xd5,0x03,0x15,0xf8,0x0f,0x00,0x13,0xf0,0x7b,0x0a,0x16,0xaa,0xdd,0xd0,0x1f,
-0xfa,0x17,0x00,0x4c,0x10,0xf8,0xfa,0x5b,0x03,0x17,0x00,0x04,0x75,0x08,0x07,0x5e,
-0x0c,0x0f,0x17,0x00,0x08,0x0e,0xa1,0x00,0x0f,0x17,0x00,0x56,0x02,0x34,0x7b,0x47,
-0xef,0xfd,0xc9,0x50,0xb9,0xc3,0x03,0xfd,0xac,0x28,0x00,0x08,0x26,0x9c,0x18,0x0b,
-0x8f,0x33,0x11,0x08,0x86,0x7d,0x12,0x9c,0x6c,0x0c,0x03,0x82,0x88,0x00,0x65,0x7e,
-0x15,0xfb,0xe8,0xb2,0x02,0x85,0x2c,0x04,0x6b,0x2c,0x01,0x8b,0x79,0x05,0xe2,0x81,
-0x01,0x2d,0x79,0x17,0xcf,0xdc,0x42,0x15,0xf1,0xa6,0x34,0x13,0x09,0xb3,0x3a,0x15,
-0xd0,0x94,0x78,0x05,0x9e,0x82,0x00,0x26,0x03,0x15,0x61,0x1b,0x00,0x12,0x7f,0x58,
-0x69,0x16,0xfd,0x85,0x30,0x05,0x5d,0x1a,0x00,0xe4,0x2c,0x18,0x0c,0x12,0x43,0x14,
-0x10,0xa0,0x83,0x14,0x01,0x01,0x7d,0x15,0xd0,0xa3,0x76,0x04,0xad,0x79,0x02,0x93,
-0x60,0x03,0x8c,0x85,0x12,0x4e,0xac,0x09,0x15,0x8f,0x1f,0x77,0x18,0xd0,0x8e,0x0f,
-0x18,0xe2,0x83,0x3a,0x17,0xc1,0xc3,0x97,0x24,0xfd,0x60,0xa5,0x7d,0x4b,0xde,0xfe,
-0xdc,0x84,0x1f,0xd1,0x0f,0x17,0x02,0x13,0x10,0xf7,0x47,0xc7,0x0f,0x17,0x02,0x6f,
-0x0f,0x17,0x00,0x60,0x10,0xcf,0x93,0x04,0x20,0x17,0xbe,0xeb,0x71,0x01,0x46,0x36,
-0x02,0xe9,0x2f,0x12,0xc2,0xfb,0x5e,0x13,0x8f,0x93,0x06,0x00,0xa2,0xb7,0x14,0x5f,
-0x66,0x4d,0x10,0xaf,0xcd,0x0c,0x26,0xeb,0xac,0x46,0x15,0x12,0x80,0x41,0x1b,0x00,
-0xfa,0x07,0x01,0x31,0xb8,0x00,0xbd,0xbf,0x04,0xc1,0x63,0x13,0x06,0xb1,0x12,0x18,
-0xf8,0x2e,0x13,0x14,0x30,0x11,0x34,0x0b,0xca,0x12,0x27,0xfe,0x00,0x6c,0xc2,0x14,
-0xd0,0x62,0x02,0x14,0x5a,0x6f,0x02,0x00,0x97,0x02,0x16,0xaf,0x31,0x8e,0x24,0xff,
-0x4a,0xbe,0x02,0x12,0xaf,0x8d,0x08,0x14,0xf2,0x44,0x1a,0x13,0x1a,0xd2,0x05,0x01,
-0xa4,0x4d,0x04,0xea,0x65,0x13,0x6f,0xfb,0x7e,0x04,0x2a,0xc3,0x01,0x60,0x67,0x12,
-0xf6,0xce,0x0b,0x20,0xf0,0x0a,0x4b,0x41,0x11,0xfd,0x79,0x67,0x01,0xb7,0x08,0x14,
-0xe7,0xed,0x0b,0x13,0x0a,0xb3,0x00,0x01,0x41,0x17,0x14,0xaf,0xa4,0xde,0x10,0xfa,
-0x24,0x4f,0x00,0x28,0x7f,0x12,0x8c,0x22,0x80,0x1b,0xaf,0x74,0xcb,0x08,0x5b,0x0a,
-0x0f,0x19,0x00,0x4e,0x01,0x3a,0xbe,0x39,0xce,0xff,0xec,0x2d,0xc3,0x02,0x98,0x7f,
-0x17,0x1c,0x8e,0x1b,0x17,0x1d,0x99,0x0e,0x20,0x0b,0xff,0x4c,0xda,0x15,0xcf,0xc2,
-0x74,0x12,0xe3,0xa4,0x1a,0x14,0x10,0xc7,0x44,0x13,0x5f,0xaf,0x9b,0x14,0xfa,0x89,
-0xd0,0x04,0x6f,0x34,0x45,0x05,0x99,0x99,0x99,0x3e,0x46,0x0c,0x81,0x7d,0x09,0x74,
-0x10,0x18,0x1f,0x74,0x39,0x08,0x19,0x00,0x0c,0xa6,0x10,0x1e,0xf0,0xf9,0xc5,0x07,
-0xf0,0x86,0x00,0x43,0x16,0x04,0x8b,0x45,0x01,0x26,0x26,0x03,0xcd,0x7b,0x02,0xa4,
-0x18,0x11,0x7f,0x25,0x05,0x12,0x03,0x50,0x30,0x10,0xcf,0x55,0x5e,0x1b,0x9c,0x4b,
-0x94,0x17,0xfa,0x2f,0x34,0x17,0xf9,0xaf,0x0e,0x16,0xd3,0x30,0xb4,0x29,0xc8,0x40,
-0x32,0x04,0x1f,0xf2,0x0b,0x00,0x0e,0x30,0x47,0x77,0x77,0xfa,0x12,0x21,0x87,0x77,
-0x74,0xcb,0x07,0x62,0xb9,0x0f,0x0b,0x00,0xc6,0x05,0xd7,0x2c,0x00,0x77,0x03,0x15,
-0x41,0xce,0x01,0x00,0x26,0x32,0x17,0x0a,0x7d,0x37,0x15,0xf8,0x4b,0x69,0x0a,0x5b,
-0xba,0x01,0xc8,0xc8,0x16,0x07,0x0b,0x80,0x12,0xf6,0xbd,0xba,0x03,0x5d,0x06,0x15,
-0x10,0x67,0x63,0x15,0xcf,0xda,0xe0,0x14,0x20,0xf5,0x11,0x24,0x00,0x0e,0x8e,0x47,
-0x04,0xbd,0xc9,0x02,0x21,0x0c,0x27,0x90,0x00,0xff,0x11,0x13,0xf3,0xdc,0x16,0x13,
-0xf7,0x57,0x0c,0x02,0xc2,0x02,0x37,0xc0,0x00,0x9f,0x43,0x6a,0x24,0x10,0x0d,0xb6,
-0x02,0x12,0x08,0xab,0x70,0x15,0xfb,0xa0,0x11,0x28,0xa0,0x6f,0x01,0x4f,0x18,0x0a,
-0x09,0x58,0x28,0xf3,0xef,0xe7,0x89,0x19,0xaf,0x91,0x7c,0x07,0x72,0x37,0x09,0x12,
-0xdd,0x28,0x0d,0xff,0x6e,0x26,0x18,0x6f,0xfd,0x21,0x03,0xc8,0xe1,0x0e,0xd9,0x86,
-0x08,0xb6,0x38,0x03,0xbf,0x00,0x06,0x3a,0x38,0x03,0xc9,0x6e,0x0d,0xb0,0x89,0x02,
-0x81,0x35,0x13,0xd0,0x18,0x00,0x27,0xed,0xef,0x6f,0x38,0x18,0x8f,0x9b,0x1f,0x19,
-0x08,0x0c,0x34,0x18,0x8f,0xe2,0x1f,0x5f,0x05,0xde,0xff,0xed,0x83,0x66,0xc3,0x11,
-0x03,0x35,0x62,0x0f,0x14,0x00,0x94,0x00,0x7f,0xdf,0x12,0x93,0xb1,0x12,0x01,0x17,
-0x84,0x05,0x6e,0x1f,0x23,0xa0,0x0f,0x41,0xc6,0x25,0xff,0xd3,0x19,0x04,0x22,0xfb,
-0x0f,0x12,0xd6,0x02,0xc1,0x15,0x15,0x0c,0x63,0xa9,0x15,0xf5,0x2b,0x1d,0x10,0x5f,
-0x0f,0x75,0x11,0x8b,0xf3,0xdd,0x32,0xff,0xb8,0x9e,0xc4,0x01,0x02,0x76,0x09,0x12,
-0x3e,0xcc,0x26,0x24,0x01,0xcf,0x36,0x85,0x14,0xe1,0xa2,0xad,0x03,0x4f,0x91,0x16,
-0x07,0xad,0xa0,0x14,0xfd,0xc5,0x1c,0x04,0x03,0x07,0x03,0x25,0x1f,0x14,0x04,0xde,
-0xd5,0x07,0x91,0xcb,0x01,0x32,0x05,0x04,0x5c,0x05,0x04,0xb8,0x14,0x08,0xe4,0x15,
-0x16,0x0f,0xb5,0x64,0x0f,0x14,0x00,0x05,0x1f,0xfc,0x28,0x00,0x14,0x17,0xfe,0xcf,
-0x61,0x23,0x00,0xff,0xf9,0x35,0x0b,0x69,0x6b,0x26,0xc0,0x0a,0x52,0xe4,0x05,0xb4,
-0x00,0x04,0xc8,0x4c,0x17,0xef,0xdc,0x00,0x17,0x03,0x5b,0xa9,0x14,0x50,0x83,0x21,
-0x02,0x08,0x32,0x16,0x4f,0x2c,0x01,0x12,0xfc,0x18,0x03,0x40,0xea,0x9c,0xff,0xdf,
-0x79,0x07,0x22,0xb9,0xaf,0xbb,0x02,0x03,0x2b,0xaa,0x00,0x63,0x32,0x09,0x44,0x29,
-0x02,0x99,0xb8,0x16,0xf0,0x67,0x9e,0x23,0x3d,0xff,0x51,0xcb,0x26,0xf0,0x09,0x5e,
-0xa7,0x42,0x6c,0xef,0xfc,0x82,0xdc,0x00,0x16,0x39,0x6d,0xe2,0x0f,0xbc,0x02,0xa0,
-0x0d,0x14,0x00,0x04,0x22,0x4e,0x02,0x23,0x40,0x04,0xdc,0x0b,0x14,0x4f,0x12,0xe1,
-0x04,0x4e,0xd6,0x05,0xbb,0x24,0x16,0x08,0xe1,0x87,0x12,0xb0,0x3c,0xd8,0x05,0x47,
-0x88,0x04,0x71,0x2d,0x13,0x0a,0xc2,0x95,0x14,0xf3,0x40,0x51,0x28,0xfa,0x1f,0x0d,
-0x97,0x05,0x3d,0x6b,0x04,0x71,0x0b,0x07,0x01,0xbf,0x06,0x7f,0x04,0x09,0xd0,0x6c,
-0x02,0xdd,0x7c,0x09,0x70,0x38,0x18,0xb0,0xcc,0xd3,0x08,0xc4,0x88,0x0a,0x56,0xa4,
-0x05,0x6c,0x00,0x00,0xe9,0x39,0x05,0x0c,0x31,0x01,0x35,0x1d,0x04,0xe4,0xcf,0x02,
-0x78,0x1a,0x16,0xef,0x4f,0x06,0x12,0xd0,0x53,0xcd,0x05,0xcf,0x18,0x03,0x53,0x03,
-0x02,0x56,0x3e,0x01,0x90,0x73,0x02,0x6c,0x94,0x05,0x5f,0x50,0x05,0x4d,0x90,0x00,
-0xc8,0x1e,0x05,0xfb,0x4f,0x01,0xb2,0x03,0x07,0x19,0x0b,0x39,0xa0,0x00,0x0a,0xa5,
-0x0d,0x0f,0x1b,0x00,0xf1,0x00,0x1a,0x0d,0x69,0x7f,0xff,0xff,0xfd,0x77,0x70,0xb4,
-0x1b,0x28,0x1a,0xff,0xbf,0x64,0x0f,0x1b,0x00,0x08,0x09,0x68,0x15,0x18,0x10,0x35,
-0x67,0x0f,0x1b,0x00,0x5a,0x03,0x92,0x5f,0x01,0x9a,0x5f,0x0f,0x0c,0x00,0x5c,0x17,
-0xfa,0x0c,0x00,0x04,0xee,0x7b,0x20,0xf8,0x0d,0x2b,0x1b,0x11,0x10,0x53,0x76,0x27,
-0xf8,0x09,0x86,0x1f,0x18,0x03,0xf8,0x36,0x17,0x9f,0x0c,0x00,0x12,0x09,0x25,0x43,
-0x02,0x81,0xd1,0x77,0x39,0xdf,0xfe,0xda,0x62,0x00,0x0f,0x76,0x08,0x0f,0x0c,0x00,
-0x45,0x02,0x23,0x1b,0x00,0x4c,0x04,0x03,0xc1,0x1e,0x0f,0x11,0x00,0xff,0x45,0x42,
-0xb7,0x77,0x77,0x78,0x55,0x0c,0x1d,0x7c,0x1f,0x1f,0x0f,0x11,0x00,0x26,0x15,0x80,
-0x09,0x6e,0x14,0x08,0xf8,0x5b,0x0f,0x13,0x00,0xff,0x6a,0x09,0xe4,0x01,0x1b,0xfc,
-0x51,0x05,0x05,0xbc,0xbc,0x0f,0x13,0x00,0x23,0x0b,0x40,0x08,0x1f,0x0b,0x13,0x00,
-0x9b,0x18,0x1f,0x73,0x48,0x07,0x5a,0x1f,0x05,0x05,0x0d,0x0f,0x21,0x00,0x0e,0x00,
-0xb2,0xb9,0x1b,0x7a,0x89,0x2f,0x0a,0x47,0x0d,0x03,0x05,0x09,0x0f,0x21,0x00,0x2f,
-0x3b,0x41,0x11,0x11,0x69,0x41,0x00,0xbf,0x5d,0x18,0x61,0x06,0x46,0x07,0x32,0x5e,
-0x18,0x5f,0x8c,0xc6,0x0a,0x98,0x30,0x26,0xfe,0x10,0x63,0x00,0x24,0x01,0x48,0x81,
-0x30,0x04,0x84,0x00,0x03,0x76,0x42,0x06,0x84,0x00,0x03,0x35,0xd6,0x06,0xa5,0x00,
-0x04,0x60,0x65,0x04,0x21,0x00,0x1b,0x0e,0x21,0x00,0x05,0x18,0x2d,0x00,0x21,0x92,
-0x44,0x22,0x22,0x23,0x6b,0x76,0x2a,0x1c,0x05,0x1f,0x3f,0x08,0xa1,0xd9,0x0a,0x21,
-0x00,0x19,0xe6,0xe7,0x00,0x3a,0xed,0xb8,0x40,0x8a,0x12,0x09,0x50,0x14,0x05,0x36,
-0x06,0x1f,0xfa,0x23,0x00,0x7b,0x00,0x7a,0x27,0x1a,0x10,0x23,0x00,0x09,0xb9,0xb1,
-0x18,0xfa,0xee,0x26,0x09,0x23,0x00,0x05,0xb2,0xac,0x08,0x3c,0x16,0x18,0xf6,0x69,
-0x00,0x24,0x13,0x6d,0xcb,0xb6,0x05,0x8c,0x00,0x02,0x10,0x32,0x08,0x8c,0x00,0x01,
-0x35,0x3f,0x08,0x23,0x00,0x02,0xde,0x3b,0x08,0x23,0x00,0x1c,0x6f,0x23,0x00,0x11,
-0x1e,0x26,0x0b,0x02,0x23,0x00,0x00,0xb1,0x27,0x21,0x35,0x9f,0x10,0x02,0x0b,0x8c,
-0x00,0x1c,0xf3,0xaf,0x00,0x1c,0xf4,0xaf,0x00,0x1a,0xa1,0xd2,0x00,0x02,0x98,0x4b,
-0x0c,0x3b,0x01,0x0f,0xb5,0x14,0x5e,0x08,0x95,0x01,0x18,0x0a,0x90,0x01,0x0e,0x79,
-0x28,0x03,0x86,0x01,0x08,0x81,0x01,0x18,0x0a,0x7c,0x01,0x08,0x77,0x01,0x18,0x4a,
-0x72,0x01,0x08,0x6d,0x01,0x18,0x7a,0x68,0x01,0x08,0x63,0x01,0x18,0x2a,0x5e,0x01,
-0x08,0x59,0x01,0x18,0x0a,0x54,0x01,0x08,0x4f,0x01,0x19,0x0a,0x4a,0x01,0x02,0xec,
-0x84,0x03,0x37,0xb2,0x16,0x19,0xf9,0x03,0x04,0x1b,0x25,0x18,0xf5,0x7b,0x34,0x11,
-0x70,0x19,0x0d,0x31,0xfe,0xa9,0x9d,0xba,0x01,0x06,0x99,0xd9,0x12,0xfd,0x94,0xa7,
-0x03,0xd6,0x95,0x04,0xcf,0x95,0x00,0x46,0x1e,0x4c,0x47,0x77,0x77,0x70,0x49,0x01,
-0x04,0x6e,0xde,0x12,0x04,0x24,0x1e,0x17,0xf7,0x79,0x24,0x17,0xf8,0x0c,0x00,0x1f,
-0xf9,0x0c,0x00,0x04,0x1e,0xf8,0x76,0xdb,0x02,0x5c,0x17,0x03,0xec,0x27,0x01,0xf5,
-0x25,0x04,0x1c,0x0e,0x12,0xff,0x86,0xe6,0x14,0xfb,0x15,0x9d,0x03,0x31,0x7a,0x05,
-0x7a,0xe6,0x02,0xec,0x84,0x17,0xf5,0x02,0xb3,0x13,0x80,0x59,0x49,0x04,0xcf,0x04,
-0x15,0x07,0x0f,0xcd,0x01,0x8c,0x21,0x03,0x09,0x52,0x05,0xd0,0x00,0x23,0x16,0xad,
-0x06,0x1b,0x04,0x1f,0x02,0x03,0xb0,0xad,0x16,0xe7,0x25,0x00,0x14,0x05,0x20,0x02,
-0x14,0x20,0x25,0x00,0x17,0x06,0x68,0x87,0x15,0xaf,0xa9,0x24,0x02,0x1a,0x1b,0x14,
-0xfc,0x25,0x00,0x11,0xdf,0x64,0xd2,0x26,0x04,0xef,0x8a,0x20,0x00,0x6a,0x01,0x03,
-0x38,0x67,0x01,0xb8,0x14,0x02,0x83,0x13,0x14,0x50,0xe1,0x46,0x02,0x25,0x00,0x04,
-0x4d,0x07,0x13,0x4f,0xec,0xcd,0x07,0xb9,0x32,0x09,0x23,0x02,0x14,0x90,0x2a,0x48,
-0x1a,0x0a,0x7f,0xd0,0x18,0xdf,0xa0,0x07,0x05,0x18,0x9c,0x1a,0x1a,0xbd,0x66,0x00,
-0x43,0x17,0x01,0xbc,0x1c,0x14,0x8b,0x0d,0x1f,0x13,0x0d,0x4a,0x00,0x05,0xc5,0x0e,
-0x02,0x0d,0x5d,0x18,0xaf,0xa3,0x81,0x23,0x00,0x1f,0xda,0x92,0x06,0x20,0x33,0x25,
-0x05,0xff,0x7e,0x21,0x16,0x8f,0xba,0x6b,0x12,0xf4,0x25,0x00,0x03,0x02,0x68,0x02,
-0x48,0x66,0x02,0x25,0x00,0x16,0x0a,0xa9,0xdc,0x13,0x50,0x28,0x01,0x10,0x1e,0x9f,
-0x01,0x01,0x6f,0x1b,0x04,0xe1,0x20,0x06,0xb1,0x02,0x15,0xc0,0x97,0x01,0x16,0x3e,
-0x3e,0x18,0x04,0xbc,0x01,0x15,0x18,0x13,0x3b,0x05,0xdb,0x03,0x00,0x4c,0xd6,0x15,
-0xdc,0x51,0x14,0x35,0x38,0xbd,0xef,0x85,0x17,0x17,0x6d,0x5e,0x34,0x18,0x0b,0x6b,
-0x34,0x17,0xaf,0x0d,0x00,0x01,0xcb,0x79,0x40,0x63,0x22,0x22,0x2e,0x0d,0x00,0x04,
-0xe8,0x47,0x14,0x0e,0x46,0xbc,0x14,0x10,0x0d,0x00,0x04,0x0c,0x4d,0x0e,0x0d,0x00,
-0x04,0xea,0x28,0x01,0x0d,0x00,0x04,0xd4,0x76,0x01,0x0d,0x00,0x11,0x02,0x2f,0xf6,
-0x20,0x11,0x11,0xec,0x10,0x08,0xca,0x56,0x19,0xfa,0x0c,0x2e,0x06,0xeb,0xb0,0x06,
-0xc8,0x4b,0x07,0x15,0xf9,0x03,0x88,0xbc,0x03,0x9a,0x8c,0x03,0x1a,0x06,0x03,0x23,
-0xdc,0x04,0x0d,0x00,0x03,0x7e,0x11,0x14,0x0f,0xc6,0x7f,0x15,0xfa,0x5b,0x0f,0x15,
-0xdf,0x4f,0xa8,0x15,0xfa,0xd2,0x69,0x13,0x0f,0xc6,0xfa,0x14,0xfc,0xae,0x06,0x26,
-0x01,0xef,0xd8,0xe0,0x28,0xfa,0x0a,0xde,0x7c,0x03,0xa2,0xeb,0x13,0x0b,0xad,0x16,
-0x35,0xef,0xff,0xf1,0x79,0xd5,0x0f,0x19,0x00,0x13,0x33,0x22,0x22,0x20,0x05,0x00,
-0x0c,0x01,0x00,0x25,0x15,0x9d,0x05,0xea,0x08,0xc8,0x89,0x04,0xc8,0x03,0x18,0xe2,
-0xf8,0x36,0x13,0xe2,0x78,0xb3,0x22,0x53,0x37,0xe6,0x22,0x02,0xe5,0x1d,0x11,0x01,
-0xd0,0x62,0x02,0x71,0x28,0x02,0x9f,0x76,0x04,0x59,0xaa,0x13,0x0c,0x14,0x6a,0x04,
-0x0a,0x6e,0x10,0x70,0xc7,0x08,0x00,0xe5,0x2a,0x13,0x16,0xf3,0xb8,0x05,0x94,0x32,
-0x08,0x28,0xb9,0x09,0xd9,0x2a,0x18,0x1f,0x8a,0x42,0x0f,0x4c,0x1a,0x06,0x04,0x75,
-0xeb,0x0c,0x3c,0x94,0x14,0x00,0x5c,0x88,0x21,0x45,0x43,0x90,0x78,0x04,0x84,0x37,
-0x02,0xfc,0xd1,0x14,0xd2,0x88,0x17,0x01,0x9d,0x79,0x26,0x77,0xaf,0xa3,0x80,0x05,
-0xe6,0x03,0x18,0x3e,0xf2,0x03,0x16,0x19,0x5f,0xe8,0x03,0x3b,0xd9,0x0e,0x40,0x17,
-0x2f,0xef,0x00,0x01,0x00,0x2c,0x04,0x7a,0x39,0x17,0xde,0x14,0x00,0x70,0xf2,0xef,
-0x00,0xfa,0xe6,0x00,0xe6,0x5f,0x01,0x0f,0x5b,0x00,0x29,0x4f,0x06,0x0b,0x00,0x06,
-0x3f,0x00,0x28,0x2f,0xaf,0x00,0x01,0x00,0x3e,0x1f,0xb9,0x47,0x00,0x33,0x03,0x2c,
-0x01,0xb2,0xe9,0x00,0xfa,0x00,0x00,0xde,0xfb,0xea,0xf5,0x00,0xd5,0x37,0x01,0x7f,
-0xfd,0x00,0x00,0xfb,0xfd,0xf2,0xf7,0x36,0x01,0x27,0x6f,0xf8,0x00,0xf9,0x00,0x00,
-0xf0,0x9c,0x00,0x2a,0x06,0x79,0x41,0x03,0x7d,0x07,0x19,0xfd,0x1f,0x00,0x1f,0xfb,
-0x4f,0x00,0x1c,0x40,0xdd,0x00,0x00,0x00,0x68,0x03,0x7f,0xe8,0x00,0xfa,0x00,0xfa,
-0xf4,0xf9,0x40,0x01,0x33,0x15,0x06,0x8e,0x00,0x11,0xfb,0x91,0x00,0x3f,0xfb,0xf9,
-0xfa,0x45,0x00,0x1f,0x00,0xa5,0x6a,0x35,0xc9,0x00,0xc5,0x4d,0x00,0x62,0xf6,0xfa,
-0x00,0x00,0xfa,0xf9,0x04,0x00,0x0f,0x01,0x00,0x22,0x13,0x05,0x34,0x01,0x2f,0x05,
-0xf8,0xe3,0x00,0x30,0x1f,0xfa,0xb4,0x02,0x36,0x00,0xc1,0x3c,0x1a,0xf7,0xe1,0x01,
-0x10,0xf8,0x07,0x00,0x2f,0xf5,0xee,0x48,0x00,0x1b,0x14,0xae,0xe7,0x00,0x96,0xee,
-0x00,0x00,0xc5,0xf9,0xc5,0xe5,0x00,0xb0,0x1c,0x00,0x3f,0xfc,0xdd,0xf1,0x99,0x00,
-0x1f,0x71,0x8d,0x00,0x00,0x00,0xcd,0x00,0xcb,0x0c,0x00,0x80,0xf1,0x00,0xf6,0x00,
-0xfd,0xfc,0x00,0x00,0xfb,0xf9,0x2f,0x00,0x04,0xee,0x00,0x28,0x6f,0xf7,0x00,0xf8,
-0xfa,0x00,0xf6,0x3b,0x01,0x34,0x10,0xf2,0x5e,0x02,0x1f,0xf2,0x40,0x00,0x27,0x01,
-0x5d,0x05,0xc0,0xb6,0xb2,0x00,0x00,0xde,0xf8,0xc2,0xfb,0x05,0x00,0x05,0x04,0x24,
-0x02,0xdf,0xd0,0xe7,0x00,0xe7,0xc5,0xed,0xea,0x00,0xed,0xe9,0xf3,0xea,0xef,0xf8,
-0x02,0x1d,0x66,0xc3,0xd3,0x00,0x00,0xeb,0xfc,0x73,0x02,0xa3,0xf3,0xf3,0x00,0x00,
-0xf3,0xf7,0x00,0x00,0xf8,0xfd,0x81,0x02,0x0f,0x01,0x00,0x17,0x71,0x04,0x00,0xd7,
-0xef,0x00,0x00,0xf4,0x0a,0x00,0x02,0x1b,0x1e,0x63,0xf7,0xf7,0x00,0x00,0xf7,0xfa,
-0xe4,0x03,0x0f,0x85,0x01,0x1e,0x14,0xd3,0x3d,0x04,0x15,0x04,0x68,0x02,0x10,0xfa,
-0xc9,0x02,0x1f,0xf7,0xc3,0x01,0x1e,0xff,0x11,0x06,0xf2,0xbe,0xd5,0x00,0x00,0xd5,
-0xf8,0xe5,0xfb,0x05,0xe5,0x05,0x05,0x04,0x05,0x00,0x05,0xee,0xed,0xfa,0xf5,0xed,
-0xf5,0xef,0xfa,0xf5,0xfa,0x00,0xf9,0xf7,0x05,0x8a,0x01,0x20,0x2a,0x04,0xf9,0x5c,
-0x03,0x10,0xfa,0x36,0x04,0x1f,0xf8,0xa9,0x03,0x26,0x1e,0xfb,0x09,0x05,0x0f,0x43,
-0x00,0x20,0x0f,0x01,0x00,0x07,0x1f,0xfc,0xf8,0x05,0x1e,0x0f,0x01,0x00,0x08,0x3f,
-0xfd,0x00,0xfc,0x50,0x00,0x1a,0x1f,0xfd,0x32,0x07,0x39,0x1f,0xfc,0xe7,0x00,0x39,
-0x1e,0x05,0x10,0x08,0x17,0x05,0xb1,0x06,0x0f,0x02,0x03,0x1b,0x1f,0xe9,0x1f,0x08,
-0x3f,0x0f,0xc4,0x05,0x34,0x1f,0xe7,0x34,0x01,0x0b,0x2f,0xfa,0xfb,0x96,0x06,0x1d,
-0x1c,0xcf,0x62,0x03,0x30,0xfb,0x06,0x00,0x1c,0x8d,0x3f,0x00,0x05,0x05,0xea,0x00,
-0x33,0x0f,0xe4,0x03,0x1e,0x04,0x28,0x04,0x1c,0xd0,0xde,0x00,0x2f,0xfc,0x04,0x16,
-0x02,0x1e,0x09,0x6c,0x08,0x0f,0xce,0x01,0x4a,0x1e,0xf5,0x4d,0x00,0x0f,0x41,0x04,
-0x66,0x03,0xc5,0x04,0x0f,0x01,0x00,0x4c,0xfa,0x02,0x16,0x00,0x00,0x07,0x00,0xf8,
-0xf8,0xf1,0xe3,0xea,0xf1,0x00,0xd3,0xf1,0x00,0x07,0xf8,0x77,0x04,0x04,0x47,0xb5,
-0x0f,0x4c,0x00,0x12,0x50,0xea,0x00,0xf1,0xf8,0xf1,0x36,0x00,0x6e,0xf1,0xf1,0xf8,
-0xf1,0xea,0xf1,0x32,0x08,0x0f,0x8f,0x05,0x19,0xfe,0x02,0xe3,0xf8,0xea,0xf8,0xf1,
-0x00,0xf1,0x00,0xea,0xea,0xea,0xf1,0xea,0xea,0x00,0xf1,0x00,0x4c,0x00,0x2f,0xf8,
-0xea,0x4d,0x00,0x15,0x20,0xdb,0xf1,0x82,0x08,0x15,0xf8,0x81,0x00,0x10,0xf8,0x59,
-0x00,0x10,0xe2,0x66,0x00,0x50,0xea,0xf1,0xe3,0x00,0xea,0xbb,0x00,0x01,0xc0,0x00,
-0x1f,0xea,0x52,0x00,0x14,0x13,0x07,0x07,0x00,0x06,0x52,0x00,0x35,0x07,0x00,0x0f,
-0x19,0x00,0x1f,0x07,0x83,0x01,0x1b,0x11,0x07,0x90,0x00,0x21,0x0f,0x0f,0x0a,0x00,
-0x08,0x3c,0x00,0x0f,0xbe,0x06,0x20,0x11,0xf1,0xe7,0x00,0x40,0xf1,0xea,0xea,0xf1,
-0x8e,0x01,0x0f,0x1d,0x02,0x2f,0x00,0x86,0x00,0x65,0x0f,0x0f,0xf8,0x00,0x0f,0x07,
-0xf4,0x00,0x0f,0x9d,0x00,0x27,0x08,0x93,0x62,0x0f,0xc4,0x02,0x39,0x1e,0x07,0x66,
-0x02,0x0f,0x9f,0x00,0x17,0x33,0xf1,0xf8,0xf8,0x29,0x01,0x00,0x33,0x01,0x02,0x38,
-0x00,0x1f,0xf1,0xe1,0x00,0x25,0x70,0xcd,0xdb,0xf8,0xf8,0xdb,0xf8,0xf8,0x55,0x00,
-0x20,0xf8,0xea,0x5c,0x00,0x03,0x7c,0x02,0x05,0x55,0x00,0x0f,0xdb,0x01,0x18,0x00,
-0x3e,0x00,0x10,0xf8,0x51,0x03,0x00,0x09,0x00,0x33,0xea,0xf1,0xf8,0x9c,0x03,0x18,
-0x07,0x01,0x03,0x2f,0x00,0xf8,0x02,0x03,0x17,0x11,0x0f,0x1d,0x02,0x12,0x00,0xec,
-0x02,0x11,0xf8,0xed,0x00,0xb0,0xe3,0x00,0x00,0xea,0xdb,0xe2,0x00,0xdb,0xf8,0xea,
-0xdb,0xfd,0x02,0x01,0x51,0x00,0x0f,0x35,0x02,0x11,0x34,0xd4,0xe2,0x00,0x5f,0x02,
-0x10,0xea,0x4c,0x00,0x00,0x71,0x02,0xc4,0xdb,0xdb,0xf8,0xe3,0xea,0xdb,0xe3,0xea,
-0xdb,0xea,0xea,0xdb,0xee,0x00,0x2f,0xea,0xe3,0xe7,0x00,0x11,0x14,0xe2,0x7f,0x03,
-0x21,0xea,0xf8,0x99,0x03,0x06,0xcc,0x02,0x0f,0x23,0x0f,0x24,0x02,0xca,0x01,0x1c,
-0xea,0x42,0x00,0x1f,0xf8,0xb7,0x02,0x2d,0x18,0x16,0xfb,0x03,0x0f,0xb5,0x02,0x3c,
-0x0f,0xe7,0x03,0x1c,0x30,0xf8,0xea,0xf1,0x13,0x02,0x6e,0xf1,0xc5,0x00,0x00,0xe2,
-0xd4,0xb6,0x04,0x0f,0x4e,0x00,0x1c,0x14,0xf1,0x4a,0x05,0x25,0xf8,0xf1,0xfd,0x02,
-0x1f,0x07,0x81,0x01,0x23,0x34,0xf1,0xf1,0xf1,0x61,0x02,0x34,0x00,0xea,0xf8,0xc9,
-0x01,0x0e,0x4d,0x00,0x0f,0x3b,0x01,0x36,0x1f,0xf1,0xfa,0x00,0x2a,0x11,0x00,0xad,
-0x03,0x02,0xf2,0x00,0x10,0xf8,0x09,0x01,0x0f,0x54,0x03,0x19,0x0c,0x29,0x07,0x21,
-0xf8,0xf8,0x04,0x00,0x10,0xf8,0xa0,0x01,0x01,0xb4,0x03,0x0f,0x70,0x02,0x28,0x13,
-0xea,0xdc,0x00,0x01,0xe6,0x03,0x0f,0x34,0x01,0x38,0x01,0xd9,0x01,0x0f,0x53,0x00,
-0x27,0x05,0x44,0x03,0x12,0xf8,0xf6,0x00,0x0e,0x31,0x04,0x0f,0x93,0x00,0x1c,0x02,
-0x90,0x00,0x03,0xea,0x00,0x0f,0xce,0x01,0x28,0x26,0xf8,0xf1,0x90,0x00,0x01,0xc5,
-0x02,0x04,0x81,0x01,0x0f,0x36,0x01,0x2d,0x16,0xf8,0x6a,0x05,0x1f,0xf8,0x34,0x01,
-0x27,0x1a,0xf8,0xb4,0x05,0x0f,0xe7,0x00,0x27,0x18,0xf8,0x87,0x01,0x00,0x4d,0x00,
-0x0f,0xd6,0x04,0x2c,0x17,0xf8,0x02,0x03,0x10,0xf1,0x02,0x03,0x0e,0x56,0x06,0x0f,
-0x4f,0x03,0x22,0x01,0x09,0x03,0x0f,0x4d,0x00,0x26,0x0b,0x87,0x0a,0x04,0x9e,0x00,
-0x1f,0x00,0xe7,0x00,0x28,0x07,0xcb,0x01,0x1f,0x0f,0x49,0x00,0x2a,0x00,0xde,0x03,
-0x12,0x07,0x37,0x01,0x8f,0x00,0xf8,0xf1,0x07,0x00,0xf8,0x07,0x00,0x34,0x01,0x26,
-0x02,0x31,0x04,0x02,0xeb,0x07,0x03,0xde,0x01,0x0f,0x7c,0x08,0x26,0x02,0x9b,0x00,
-0x05,0x47,0x03,0x01,0xcc,0x0b,0x1f,0xf1,0x1b,0x02,0x25,0x0f,0xed,0x09,0x3a,0x0f,
-0xd4,0x0a,0x2c,0x0f,0x73,0x09,0x0c,0x03,0x04,0x00,0x0f,0xcf,0x01,0x26,0x08,0x02,
-0x03,0x05,0xe5,0x03,0x0f,0xce,0x01,0x26,0x02,0xfe,0x05,0x05,0x4c,0x07,0x03,0x52,
-0x0a,0x12,0x01,0x12,0xaf,0x31,0x02,0x03,0x00,0xff,0x14,0x1e,0x05,0xf9,0x13,0xf2,
-0x0b,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,
-0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x0e,0xfa,0xf1,0x0b,0x1b,
-0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,
-0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0xff,0xe8,0xf5,0x2e,0x2a,0x2b,0x2c,
-0x2d,0x00,0x2e,0x2f,0x00,0x00,0x30,0x31,0x32,0x00,0x33,0x00,0x34,0x35,0x36,0x37,
-0x38,0x39,0x3a,0x00,0x00,0x3b,0x00,0x3c,0x3d,0x3e,0x00,0x3f,0x40,0x41,0x42,0x43,
-0x44,0x45,0x46,0x00,0x00,0x47,0x48,0x49,0x00,0x4a,0x00,0x4b,0x4c,0x4d,0x4e,0x4f,
-0x50,0x51,0x00,0x00,0x52,0x00,0x00,0x53,0x54,0x55,0xa1,0x00,0x20,0x03,0x02,0x9c,
-0x00,0x4b,0x06,0x07,0x06,0x08,0x9f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,
-0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xd1,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,
-0x13,0x14,0x00,0x00,0x15,0x1c,0x09,0x52,0x17,0x17,0x17,0x18,0x17,0x7a,0x20,0xf0,
-0x05,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,
-0x23,0x00,0x00,0x24,0x00,0xec,0x42,0x20,0x26,0x27,0x9c,0x83,0xb1,0x29,0x00,0x2a,
-0x2b,0x00,0x2c,0x2d,0x2e,0x2f,0x30,0x00,0x50,0x55,0x33,0x32,0x00,0x33,0xb0,0x00,
-0x64,0x3b,0x36,0x37,0x3c,0x3d,0x3e,0xae,0x00,0xc0,0x47,0x37,0x48,0x37,0x41,0x49,
-0x4a,0x4a,0x4b,0x4c,0x4d,0x00,
+0x28,0xfd,0x00,0x1d,0x00,0x03,0xb4,0x01,0x50,0x00,0xdf,0xff,0xff,0x40,0xd0,0x00,
+0x00,0x1f,0xff,0xff,0x20,0x00,0x00,0x00,0x5f,0xff,0xfe,0x00,0x01,0x00,0xa0,0xff,
+0xff,0xf4,0x00,0x00,0x00,0x08,0xff,0xff,0xc0,0x0e,0x00,0xa1,0x0c,0xff,0xff,0x90,
+0x00,0x00,0x00,0xcf,0xff,0xf9,0x1d,0x00,0x11,0x7f,0x2c,0x00,0x40,0x5f,0xff,0xff,
+0x40,0x0e,0x00,0x73,0x01,0xff,0xff,0xfe,0x61,0x02,0x7f,0x2b,0x00,0x32,0x00,0x05,
+0xff,0x01,0x00,0x21,0xf3,0x00,0x01,0x00,0x12,0x06,0x0e,0x00,0x22,0xe3,0x00,0x01,
+0x00,0x94,0x01,0x8d,0xff,0xff,0xff,0xfc,0x70,0x00,0x00,0x10,0x00,0x4f,0x34,0x54,
+0x30,0x00,0x01,0x00,0x0e,0x63,0x0d,0xff,0xff,0xf5,0x00,0x00,0x8a,0x00,0x66,0xff,
+0xf4,0xdf,0xff,0xff,0x50,0x6c,0x00,0x15,0x4d,0x1d,0x00,0x19,0xdf,0x1d,0x00,0x19,
+0x7f,0x1d,0x00,0x28,0x1e,0xff,0x1d,0x00,0x28,0x09,0xff,0x1d,0x00,0x29,0x02,0xff,
+0x1d,0x00,0x19,0xbf,0x1d,0x00,0x45,0x4f,0xff,0xff,0xdb,0x1d,0x00,0x00,0x80,0x00,
+0x24,0xf4,0xbf,0x1d,0x00,0x00,0xdd,0x00,0x26,0xfb,0x0c,0x1d,0x00,0x54,0xef,0xff,
+0xff,0x20,0xcf,0x1d,0x00,0x00,0x80,0x00,0x24,0x90,0x0d,0x1d,0x00,0x00,0x60,0x01,
+0x33,0xf1,0x00,0xdf,0x1d,0x00,0x00,0x80,0x00,0x25,0xf7,0x00,0x1d,0x00,0x56,0x03,
+0xff,0xff,0xfd,0x00,0x1d,0x00,0x10,0xbf,0x14,0x00,0x05,0x1d,0x00,0x11,0x4f,0x59,
+0x01,0x04,0x1d,0x00,0x11,0x0d,0x59,0x01,0x04,0x1d,0x00,0x55,0x06,0xff,0xff,0xfa,
+0x00,0x1d,0x00,0x00,0x80,0x00,0x15,0x10,0x1d,0x00,0x55,0x40,0x8f,0xff,0xff,0x80,
+0x1d,0x00,0x65,0xf4,0x2f,0xff,0xff,0xe0,0x00,0x1d,0x00,0x55,0x3a,0xff,0xff,0xf6,
+0x00,0x1d,0x00,0x11,0xf6,0x80,0x00,0x05,0x1d,0x00,0x13,0xef,0xd9,0x01,0x01,0x1d,
+0x00,0x00,0x01,0x00,0x17,0xb0,0x1d,0x00,0x48,0xff,0xff,0xf2,0x00,0x1d,0x00,0x29,
+0xf9,0x00,0x1d,0x00,0x19,0x10,0x1d,0x00,0x19,0x70,0x1d,0x00,0x28,0xd0,0x00,0x1d,
+0x00,0x25,0xf5,0x00,0x1d,0x00,0x13,0xcf,0x55,0x00,0x10,0x02,0x25,0x00,0x22,0x0c,
+0xff,0x8a,0x02,0x20,0x00,0xcf,0xeb,0x00,0x04,0x1b,0x00,0x10,0x6f,0x6a,0x00,0x04,
+0x1b,0x00,0x20,0x1f,0xff,0xa6,0x02,0x03,0x1b,0x00,0x20,0x0a,0xff,0xaf,0x00,0x03,
+0x1b,0x00,0x00,0x11,0x02,0x14,0x90,0x1b,0x00,0x00,0x10,0x01,0x24,0xe1,0x00,0x1b,
+0x00,0x12,0x9f,0xd3,0x02,0x02,0x1b,0x00,0x12,0x3f,0x39,0x01,0x01,0x1b,0x00,0x00,
+0x83,0x00,0x24,0xfe,0x10,0x1b,0x00,0x00,0x1a,0x02,0x14,0x50,0x1b,0x00,0x00,0x4f,
+0x00,0x23,0xa0,0x00,0x1b,0x00,0x14,0x04,0xc3,0x00,0x00,0x1b,0x00,0x15,0x37,0x09,
+0x01,0x22,0xcf,0xff,0x3e,0x02,0x05,0x9f,0x02,0x06,0xf9,0x00,0x13,0xcf,0x0e,0x00,
+0x18,0x20,0x1b,0x00,0x14,0xfb,0x1b,0x00,0x33,0xfc,0x94,0xaf,0x06,0x01,0x10,0x0c,
+0x39,0x01,0x21,0x01,0xff,0xae,0x00,0x01,0x1b,0x00,0x32,0xf1,0x00,0x07,0xc9,0x00,
+0x02,0x1b,0x00,0x00,0xa2,0x00,0x24,0xff,0x30,0x1b,0x00,0x00,0x12,0x02,0x15,0xfd,
+0x1b,0x00,0x00,0x2e,0x02,0x15,0xf7,0x1b,0x00,0x12,0x02,0x97,0x00,0x03,0x1b,0x00,
+0x12,0x08,0xbc,0x01,0x02,0x1b,0x00,0x21,0x00,0x0e,0xda,0x00,0x13,0x0c,0xa5,0x01,
+0x14,0x5f,0x44,0x01,0x13,0xf1,0x74,0x00,0x15,0xf9,0x1b,0x00,0x23,0x03,0xff,0x7a,
+0x01,0x14,0xf1,0x2b,0x03,0x24,0xc0,0x0c,0xdb,0x01,0x10,0x1f,0xdd,0x00,0x04,0x1b,
+0x00,0x24,0x00,0x7f,0x17,0x00,0x13,0xef,0xdd,0x00,0x03,0xfb,0x00,0x16,0x0f,0x0f,
+0x00,0x13,0xf7,0x51,0x00,0x08,0x1f,0x00,0x1a,0x5f,0x1f,0x00,0x1b,0x07,0x1f,0x00,
+0x92,0xaf,0xff,0xff,0xfd,0xcc,0xcc,0xcc,0xcc,0xcf,0x1f,0x00,0x04,0xf6,0x01,0x12,
+0x03,0x1f,0x00,0x00,0x6c,0x00,0x31,0xf0,0x00,0x00,0xc4,0x01,0x15,0xf7,0x0d,0x02,
+0x05,0x1f,0x00,0x14,0x03,0xb0,0x02,0x03,0x1f,0x00,0x13,0x5f,0xa3,0x02,0x03,0x1f,
+0x00,0x14,0x08,0x9d,0x01,0x03,0x1f,0x00,0x13,0xaf,0xba,0x01,0x03,0x1f,0x00,0x14,
+0x0d,0xae,0x01,0x03,0x1f,0x00,0x13,0xff,0x6c,0x00,0x03,0x1f,0x00,0x13,0x2f,0x29,
+0x03,0x03,0x1f,0x00,0x14,0x05,0x6c,0x00,0x02,0x1f,0x00,0x00,0x0f,0x01,0x17,0xf8,
+0x1f,0x00,0x13,0x0a,0x4b,0x02,0x04,0x1f,0x00,0x14,0xdf,0x15,0x05,0x02,0x1f,0x00,
+0x00,0x4b,0x01,0x16,0x00,0x1f,0x00,0x05,0x5f,0x02,0x03,0x1f,0x00,0x14,0x8f,0x5c,
+0x03,0x02,0x1f,0x00,0x00,0x9a,0x00,0x16,0x60,0x1f,0x00,0x15,0x03,0x80,0x02,0x02,
+0x1f,0x00,0x14,0xbf,0x9a,0x00,0x01,0x1f,0x00,0x32,0x11,0x9f,0xff,0xfd,0x03,0x02,
+0x1f,0x00,0x16,0x7d,0xb7,0x03,0x01,0x1f,0x00,0x15,0xdf,0x87,0x02,0x06,0x1f,0x00,
+0x1a,0x30,0x1f,0x00,0x1a,0x70,0x1f,0x00,0x26,0x80,0x00,0x1f,0x00,0x31,0xcf,0xff,
+0xc9,0x23,0x01,0x04,0x7c,0x00,0x00,0xe6,0x02,0x13,0xfa,0x11,0x00,0x10,0x9f,0xde,
+0x05,0x23,0xcf,0xff,0x93,0x01,0x03,0x19,0x02,0x11,0xfc,0x08,0x03,0x15,0x40,0x32,
+0x00,0x03,0x11,0x00,0x11,0x90,0x11,0x00,0x16,0x08,0x11,0x00,0x14,0xe0,0x11,0x04,
+0x04,0x11,0x00,0x02,0x2e,0x01,0x14,0x2f,0x11,0x00,0x33,0xdf,0xff,0xf8,0x76,0x02,
+0x12,0xfd,0x11,0x00,0x33,0x9f,0xff,0xfd,0x4d,0x03,0x12,0xfa,0x11,0x00,0x12,0x5f,
+0xc8,0x00,0x11,0x01,0xd3,0x04,0x00,0x11,0x00,0x11,0x3d,0xbb,0x00,0x00,0xa8,0x05,
+0x12,0xe4,0x11,0x00,0x12,0x49,0x65,0x01,0x42,0x0b,0xff,0xff,0x95,0x11,0x00,0x11,
+0x54,0x1a,0x01,0x00,0xb2,0x02,0x12,0x55,0x11,0x00,0x15,0x50,0x38,0x02,0x13,0x05,
+0x11,0x00,0x31,0xbf,0xff,0xfc,0x2a,0x02,0x14,0xfb,0x11,0x00,0x11,0x7f,0xf6,0x02,
+0x34,0xff,0xff,0xf6,0x11,0x00,0x40,0x2f,0xff,0xff,0x60,0xc1,0x01,0x14,0xf1,0x11,
+0x00,0x40,0x0c,0xff,0xff,0xb0,0x3a,0x03,0x14,0xc0,0x11,0x00,0x40,0x07,0xff,0xff,
+0xf1,0x82,0x03,0x14,0x70,0x11,0x00,0x10,0x02,0x82,0x05,0x12,0x3f,0x64,0x04,0x01,
+0x11,0x00,0x95,0x00,0xdf,0xff,0xfa,0x00,0x8f,0xff,0xfd,0x00,0x11,0x00,0x75,0x8f,
+0xff,0xfe,0x00,0xdf,0xff,0xf7,0x11,0x00,0x00,0x2f,0x00,0x10,0x21,0xaf,0x00,0x04,
+0x11,0x00,0x00,0x2c,0x01,0x10,0x76,0xd1,0x00,0x04,0x11,0x00,0x00,0x4e,0x01,0x10,
+0xba,0xf3,0x00,0x04,0x11,0x00,0x00,0x70,0x01,0x10,0xfe,0x15,0x01,0x05,0x11,0x00,
+0x22,0x00,0xef,0x9e,0x01,0x06,0x11,0x00,0x00,0xb4,0x01,0x18,0xf8,0x11,0x00,0x12,
+0x3f,0x7b,0x01,0x06,0x11,0x00,0x12,0x0e,0x9d,0x01,0x06,0x11,0x00,0x12,0x09,0xbf,
+0x01,0x06,0x11,0x00,0x12,0x04,0xe1,0x01,0x06,0x11,0x00,0x21,0x00,0xef,0x03,0x02,
+0x07,0x11,0x00,0x36,0xaf,0xff,0xf9,0x11,0x00,0x03,0x8d,0x02,0x00,0xfa,0x03,0x14,
+0x7c,0x73,0x03,0x01,0x40,0x03,0x1f,0xf7,0x1d,0x00,0x90,0x07,0xbe,0x04,0x19,0xcf,
+0x0f,0x00,0x0f,0x1d,0x00,0x1c,0x21,0xfc,0xcc,0x01,0x00,0x1e,0xcd,0x05,0x01,0x0f,
+0x22,0x01,0xa9,0x13,0x70,0xd9,0x09,0x47,0x46,0x77,0x76,0x52,0xc3,0x09,0x21,0x05,
+0xae,0xf8,0x00,0x15,0xb6,0x11,0x00,0x14,0x6d,0x0b,0x01,0x03,0x5c,0x04,0x16,0x02,
+0x2f,0x01,0x12,0xe4,0x2b,0x04,0x07,0x55,0x06,0x15,0xf6,0x3c,0x04,0x08,0x12,0x00,
+0x20,0x01,0xef,0xc9,0x04,0x43,0x62,0x10,0x02,0x5a,0x2e,0x04,0x00,0xcf,0x05,0x25,
+0xff,0xd4,0x4e,0x00,0x12,0xd0,0xcc,0x02,0x34,0xd1,0x00,0x00,0xd7,0x09,0x11,0x70,
+0x95,0x05,0x25,0xf1,0x00,0x8a,0x08,0x11,0xfe,0xe4,0x05,0x17,0xf6,0xd0,0x04,0x13,
+0xf4,0x1b,0x07,0x06,0x70,0x0a,0x25,0x90,0x09,0xae,0x04,0x02,0x8a,0x08,0x35,0xfd,
+0x00,0xbf,0xc0,0x08,0x02,0x74,0x07,0x26,0xf0,0x0e,0x13,0x01,0x02,0x30,0x03,0x14,
+0x20,0x3b,0x06,0x04,0x6a,0x00,0x24,0xf3,0x0f,0xf0,0x05,0x04,0x58,0x00,0x18,0x40,
+0x23,0x00,0x00,0x70,0x07,0x19,0xf4,0x23,0x00,0x10,0x0d,0x23,0x00,0x16,0xef,0xae,
+0x00,0x01,0xbb,0x03,0x25,0xf3,0x0c,0x4b,0x05,0x03,0x8e,0x07,0x00,0xc0,0x03,0x14,
+0xf8,0x11,0x00,0x01,0x45,0x06,0x16,0x06,0x6c,0x09,0x01,0xde,0x03,0x37,0xf9,0x00,
+0x1f,0x35,0x00,0x11,0x0f,0x96,0x06,0x21,0xcf,0xff,0xd5,0x04,0x04,0x82,0x05,0x11,
+0xe0,0xcc,0x06,0x16,0xf9,0x45,0x00,0x12,0xf7,0xa3,0x00,0x15,0xf9,0x11,0x00,0x22,
+0xfe,0x00,0x4d,0x01,0x10,0xfc,0x48,0x00,0x14,0x2a,0xd1,0x05,0x01,0x64,0x0b,0x45,
+0xea,0x87,0x8a,0xdf,0xf5,0x08,0x17,0x8f,0xa4,0x01,0x16,0x90,0x88,0x0b,0x08,0x17,
+0x09,0x24,0x00,0x3d,0x10,0x00,0x24,0xfd,0x30,0x1e,0x02,0x03,0xfd,0x01,0x16,0xc5,
+0x31,0x02,0x62,0x16,0x9c,0xef,0xff,0xec,0x96,0x50,0x0a,0x0a,0x4a,0x03,0x19,0x4c,
+0x0e,0x00,0x1f,0xf4,0x1d,0x00,0x1c,0x12,0xcc,0x01,0x00,0x12,0xdf,0x1d,0x00,0x16,
+0xf1,0xa6,0x0c,0x15,0x4c,0xbf,0x0a,0x2f,0x00,0x6f,0x1d,0x00,0xff,0x57,0x50,0x06,
+0xff,0xff,0xff,0x40,0x22,0xcf,0xff,0x01,0x00,0x84,0xed,0xb7,0x30,0x00,0x00,0x00,
+0xcf,0xff,0x01,0x00,0x28,0xfd,0x50,0x0e,0x00,0x38,0xff,0xfb,0x10,0x0e,0x00,0x29,
+0xff,0xd1,0x0e,0x00,0x10,0xfb,0x0e,0x00,0x60,0xf7,0x66,0x66,0x66,0x67,0xae,0x0f,
+0x00,0x60,0x40,0xcf,0xff,0xff,0xf2,0x00,0x01,0x00,0x55,0x7f,0xff,0xff,0xff,0xb0,
+0x0e,0x00,0x55,0x06,0xff,0xff,0xff,0xf0,0x0e,0x00,0x56,0x00,0xef,0xff,0xff,0xf3,
+0x0e,0x00,0x46,0xaf,0xff,0xff,0xf4,0x0e,0x00,0x4f,0x9f,0xff,0xff,0xf5,0x1c,0x00,
+0x05,0x45,0xdf,0xff,0xff,0xf2,0x0e,0x00,0x19,0x04,0x54,0x00,0x53,0x2e,0xff,0xff,
+0xff,0xa0,0x0e,0x00,0x20,0x01,0x38,0x8c,0x00,0x18,0x30,0xa8,0x00,0x19,0xfa,0xb6,
+0x00,0x18,0xd0,0x0e,0x00,0x19,0xfc,0xe0,0x00,0x17,0x80,0xfc,0x00,0x22,0xfd,0x81,
+0x18,0x01,0x61,0xf7,0x55,0x55,0x55,0x55,0x43,0x67,0x00,0x06,0x8c,0x00,0x0f,0x0e,
+0x00,0x7d,0x02,0x01,0x00,0x56,0x02,0x56,0x77,0x76,0x41,0x0f,0x00,0x20,0x17,0xbf,
+0xc8,0x00,0x23,0xfe,0xa4,0x0f,0x00,0x26,0x01,0x9f,0xe3,0x01,0x00,0x01,0x00,0x25,
+0x05,0xef,0xf8,0x00,0x10,0xa0,0x10,0x00,0x17,0x07,0x24,0x01,0x13,0xc0,0xb7,0x01,
+0x05,0x01,0x00,0x41,0xb0,0x00,0x00,0x03,0x4b,0x01,0x40,0x52,0x00,0x02,0x6c,0x09,
+0x00,0x12,0x60,0x2b,0x01,0x11,0xc2,0x8d,0x01,0x74,0xdf,0xff,0xff,0xff,0x10,0x00,
+0x5f,0x4a,0x00,0x20,0x00,0x01,0x38,0x01,0x21,0x00,0x0c,0x6d,0x01,0x02,0x11,0x00,
+0x93,0xef,0xff,0xff,0x90,0x01,0xff,0xff,0xff,0xf4,0x8d,0x00,0xa4,0x07,0xfc,0x84,
+0x00,0x00,0x6f,0xff,0xff,0xfd,0x00,0x9e,0x00,0x42,0x00,0x00,0x00,0x09,0x83,0x01,
+0x09,0xe5,0x00,0x18,0xf4,0x10,0x00,0x11,0x0e,0x68,0x00,0x07,0x01,0x00,0x00,0x06,
+0x02,0x08,0x10,0x00,0x5f,0x0f,0xff,0xff,0xff,0x00,0x21,0x00,0x19,0x00,0x8e,0x02,
+0x18,0xf1,0x10,0x00,0x10,0x0c,0x3d,0x02,0x08,0x11,0x00,0x10,0xaf,0xcb,0x00,0x07,
+0x01,0x00,0x12,0x06,0x0e,0x01,0x02,0x01,0x00,0x93,0x62,0x00,0x00,0x00,0x2f,0xff,
+0xff,0xff,0x20,0x10,0x00,0x31,0x2f,0xfc,0x61,0xa9,0x02,0x13,0xfa,0x10,0x00,0x10,
+0x0b,0x42,0x03,0x00,0x32,0x00,0x34,0xf6,0x00,0x00,0x64,0x01,0x35,0xe0,0x00,0x0d,
+0x11,0x00,0x12,0x07,0x0a,0x00,0x10,0x4f,0x4d,0x03,0x00,0x76,0x00,0x10,0x3b,0x93,
+0x02,0x02,0x08,0x03,0x73,0xff,0xff,0xea,0x87,0x8a,0xdf,0xff,0x5d,0x00,0x17,0xaf,
+0x8c,0x01,0x13,0x40,0x2a,0x03,0x03,0x01,0x00,0x21,0xfe,0x40,0x4b,0x00,0x17,0x4e,
+0xb3,0x03,0x02,0xa9,0x00,0x12,0xdf,0x10,0x00,0x15,0xb4,0xbb,0x00,0x74,0x26,0x9c,
+0xef,0xff,0xec,0x96,0x10,0xa2,0x03,0x06,0x01,0x00,0x19,0xd7,0x0e,0x00,0x1f,0xfd,
+0x1d,0x00,0x18,0x20,0xd2,0x66,0x01,0x00,0x12,0xef,0x07,0x04,0x25,0x66,0x65,0x43,
+0x01,0x1f,0x20,0xaa,0x02,0x05,0x0f,0x1d,0x00,0xff,0x53,0x00,0x2f,0x02,0x17,0xf8,
+0x34,0x03,0x25,0x11,0xff,0xe6,0x02,0x00,0x8d,0x02,0x25,0x90,0x07,0xaa,0x03,0x20,
+0x00,0xdf,0x1a,0x00,0x14,0x0d,0x56,0x02,0x00,0x8a,0x02,0x44,0xf9,0x00,0x00,0x3f,
+0x99,0x03,0x12,0x0b,0x52,0x00,0x13,0xaf,0xb0,0x02,0x10,0x02,0x3d,0x00,0x02,0xce,
+0x03,0x13,0xe1,0x85,0x02,0x14,0xf2,0x54,0x00,0x43,0x00,0x00,0x00,0x1f,0xf9,0x02,
+0x03,0x88,0x00,0x14,0x08,0x8f,0x00,0x10,0x3f,0x2b,0x06,0x01,0x6b,0x03,0x15,0xa0,
+0xe6,0x05,0x01,0xfe,0x03,0x15,0xf2,0x1d,0x04,0x01,0x15,0x03,0x22,0xfb,0x00,0x99,
+0x04,0x56,0xff,0xff,0xff,0x70,0x04,0x88,0x03,0x10,0x0c,0xf6,0x03,0x15,0xbf,0x76,
+0x03,0x00,0x71,0x03,0x54,0xfa,0x2f,0xff,0xff,0xf3,0xf7,0x00,0x45,0x8f,0xff,0xff,
+0xfc,0x3d,0x00,0x02,0x68,0x00,0x08,0xc5,0x03,0x15,0x05,0xd2,0x04,0x05,0x94,0x03,
+0x09,0x57,0x04,0x13,0x2f,0x74,0x03,0x07,0x4f,0x00,0x03,0x0d,0x01,0x02,0x9e,0x00,
+0x09,0x3d,0x00,0x01,0x3a,0x03,0x1a,0xf5,0x93,0x04,0x17,0xfd,0x0f,0x00,0x00,0xf4,
+0x00,0x16,0x50,0x0f,0x00,0x16,0x05,0x03,0x05,0x67,0x00,0x03,0xfa,0x64,0x49,0xff,
+0x3d,0x00,0x12,0x9f,0x81,0x06,0x08,0xdc,0x04,0x07,0xb7,0x00,0x12,0x03,0x0f,0x00,
+0x1a,0x70,0x2e,0x00,0x19,0x80,0xc5,0x00,0x00,0x85,0x05,0x04,0x2f,0x00,0x49,0x8b,
+0xef,0xfe,0xb7,0x1b,0x05,0x04,0x20,0x02,0x08,0xbc,0x00,0x03,0x4e,0x01,0x1f,0xfc,
+0x27,0x00,0x0c,0x42,0x01,0x59,0xcd,0xef,0x1d,0x08,0x23,0xc9,0x51,0x13,0x00,0x18,
+0x4a,0x4f,0x07,0x2a,0x30,0x00,0x82,0x04,0x13,0xff,0x00,0x02,0x13,0x01,0x72,0x04,
+0x06,0x2e,0x08,0x09,0x4c,0x08,0x04,0x88,0x01,0x00,0x39,0x00,0x21,0xf9,0x41,0x75,
+0x00,0x22,0x01,0x49,0xd6,0x00,0x10,0x2f,0x4b,0x04,0x04,0x9c,0x00,0x11,0x02,0x4f,
+0x06,0x00,0x4a,0x01,0x15,0xe1,0x9c,0x00,0x20,0x02,0xef,0xd2,0x02,0x12,0xdf,0x88,
+0x02,0x03,0xc3,0x00,0x10,0x07,0x4f,0x00,0x13,0x1f,0xd1,0x05,0x03,0xc3,0x00,0x00,
+0x0f,0x00,0x13,0x02,0xb2,0x01,0x04,0xea,0x00,0x00,0x39,0x08,0x13,0x4f,0x9b,0x02,
+0x03,0x27,0x00,0x00,0x3f,0x01,0x13,0x34,0x05,0x03,0x04,0x27,0x00,0x00,0x6e,0x08,
+0x13,0x4f,0x48,0x02,0x07,0x27,0x00,0x13,0x32,0xc3,0x01,0x08,0x4e,0x00,0x13,0x0f,
+0x88,0x06,0x07,0x75,0x00,0x22,0x00,0xbf,0x28,0x06,0x03,0x27,0x00,0x10,0x08,0x5d,
+0x00,0x00,0xfe,0x01,0x16,0xf2,0xc3,0x00,0x01,0xfd,0x01,0x18,0x0d,0xea,0x00,0x21,
+0x03,0xef,0x3e,0x02,0x10,0x4f,0x11,0x01,0x12,0x40,0x27,0x00,0x13,0x49,0xe2,0x05,
+0x02,0x5e,0x01,0x13,0xef,0x04,0x00,0x02,0xfa,0x01,0x2d,0x9f,0xff,0x73,0x01,0x29,
+0x00,0x6f,0x13,0x00,0x02,0x11,0x02,0x17,0x19,0x12,0x00,0x14,0xf9,0x15,0x02,0x23,
+0x59,0xce,0x2f,0x06,0x2f,0xc9,0x50,0x22,0x02,0x2f,0x0f,0x27,0x00,0x11,0x13,0x04,
+0xc1,0x01,0x03,0xdc,0x02,0x35,0x50,0x00,0x9f,0x18,0x07,0x02,0x0a,0x00,0x14,0x0e,
+0x69,0x03,0x12,0x03,0x2a,0x00,0x14,0x04,0x2d,0x03,0x13,0x0d,0xca,0x00,0x13,0x9f,
+0xc6,0x04,0x13,0x7f,0x6a,0x00,0x12,0x0e,0x51,0x04,0x23,0x02,0xff,0x3a,0x04,0x12,
+0x04,0xe9,0x01,0x15,0x0b,0x28,0x03,0x11,0x9f,0x20,0x02,0x15,0x5f,0x93,0x03,0x10,
+0x0d,0xa8,0x01,0x10,0x01,0x71,0x0a,0x06,0x93,0x00,0x17,0xa0,0x66,0x08,0x00,0x31,
+0x00,0x15,0xf4,0xed,0x04,0x02,0x31,0x00,0x27,0xfe,0xdf,0x1e,0x04,0x17,0x03,0x6a,
+0x01,0x06,0xf5,0x02,0x37,0xfe,0x10,0x00,0x31,0x00,0x09,0x10,0x04,0x1a,0x05,0x6c,
+0x04,0x02,0xa8,0x03,0x07,0xa3,0x05,0x19,0x5f,0xf4,0x03,0x01,0xfb,0x04,0x08,0xc8,
+0x03,0x12,0x0a,0x70,0x00,0x17,0xf1,0x2f,0x00,0x26,0xf9,0x8f,0x4f,0x08,0x01,0x2a,
+0x05,0x16,0x0d,0x63,0x04,0x10,0x0a,0x0b,0x00,0x11,0x04,0x54,0x08,0x04,0x2f,0x00,
+0x11,0xfb,0xc9,0x02,0x14,0xf9,0x2f,0x00,0x00,0x4b,0x00,0x14,0x1e,0x57,0x04,0x12,
+0x0a,0x6b,0x00,0x14,0x06,0x68,0x01,0x13,0x4f,0x8b,0x00,0x13,0xbf,0xe3,0x08,0x04,
+0x29,0x01,0x03,0xd2,0x08,0x05,0x29,0x01,0x11,0x07,0xf3,0x08,0x00,0x2f,0x00,0x15,
+0xfe,0x35,0x06,0x11,0xf6,0x2f,0x00,0x03,0x29,0x01,0x10,0x3f,0x14,0x01,0x16,0x09,
+0x55,0x06,0x01,0x0b,0x00,0x16,0x4f,0xad,0x09,0x29,0x01,0xef,0xca,0x0b,0x11,0x8f,
+0x0a,0x00,0x0f,0x10,0x00,0xff,0x91,0x21,0xfc,0xcc,0x01,0x00,0x10,0xef,0x0a,0x00,
+0x1b,0xc8,0xca,0x05,0x1f,0xfb,0x10,0x00,0x2d,0x09,0xba,0x0c,0x0f,0x10,0x00,0x7b,
+0x50,0x00,0x02,0xff,0xff,0xfb,0x51,0x6f,0xff,0xff,0xf3,0x00,0x01,0x00,0x92,0x06,
+0xff,0xff,0xff,0x86,0xff,0xff,0xff,0x30,0x0f,0x00,0x4f,0x6f,0xff,0xff,0xf8,0x1d,
+0x00,0x73,0x16,0x40,0x1d,0x00,0x46,0x5f,0xff,0xff,0xf6,0x1d,0x00,0x56,0x84,0xff,
+0xff,0xff,0xa0,0x1d,0x00,0x55,0x1f,0xff,0xff,0xff,0x10,0x1d,0x00,0x51,0x80,0xef,
+0xff,0xff,0xfc,0x0f,0x00,0xf0,0x01,0x01,0x9f,0xff,0xff,0xf8,0x09,0xff,0xff,0xff,
+0xfe,0x95,0x32,0x23,0x57,0xad,0xff,0x1d,0x00,0x27,0x2f,0xff,0x01,0x00,0x38,0xf8,
+0x00,0x7f,0x0f,0x00,0x39,0x80,0x00,0x9f,0x1d,0x00,0x22,0x00,0x6e,0x0a,0x00,0x21,
+0xfb,0x68,0x1d,0x00,0x81,0x00,0x04,0x8c,0xef,0xff,0xec,0xa7,0x30,0x74,0x00,0x02,
+0x7e,0x00,0x05,0x74,0x00,0x06,0x0f,0x00,0x0f,0x1d,0x00,0x74,0x40,0xcf,0xff,0xff,
+0xe0,0x0d,0x00,0x50,0x03,0xff,0xff,0xff,0x70,0x09,0x00,0x81,0x0a,0xff,0xff,0xff,
+0x0c,0xff,0xff,0xfe,0x23,0x00,0x41,0x3f,0xff,0xff,0xf7,0x09,0x00,0x4f,0xaf,0xff,
+0xff,0xf0,0x2b,0x00,0xff,0xff,0x0b,0x20,0xff,0xcc,0x01,0x00,0x41,0xcf,0xff,0xff,
+0xfd,0x09,0x00,0x12,0xef,0x2b,0x00,0x0e,0x01,0x00,0x1e,0x0c,0x15,0x00,0x0f,0x2b,
+0x00,0x30,0x14,0x00,0x97,0x00,0x10,0x0b,0x0d,0x00,0x00,0x01,0x00,0x5f,0xbf,0xff,
+0xff,0xf0,0x00,0x17,0x00,0xff,0xff,0x49,0x10,0xfc,0xe5,0x02,0x14,0xce,0xf7,0x02,
+0x10,0xef,0x11,0x00,0x1f,0xc6,0x9a,0x02,0x02,0x2f,0xff,0xf9,0x17,0x00,0x49,0x1e,
+0x00,0x01,0x00,0x1f,0x04,0x17,0x00,0xbe,0x00,0xfd,0x00,0x18,0xf2,0x14,0x00,0x10,
+0x02,0x78,0x01,0x48,0xff,0xff,0xff,0x20,0x15,0x00,0x4f,0x2f,0xff,0xff,0xfc,0x29,
+0x00,0xd2,0x01,0x01,0x00,0x38,0xfe,0xdb,0x84,0x29,0x00,0x04,0x01,0x00,0x2c,0xfd,
+0x50,0x29,0x00,0x13,0xff,0x02,0x09,0x0b,0x29,0x00,0x3e,0xff,0xff,0xb0,0x29,0x00,
+0x01,0xd2,0x05,0x03,0x29,0x00,0x70,0xf6,0x55,0x55,0x55,0x55,0x68,0xbf,0x6b,0x00,
+0x0c,0xa4,0x00,0x5c,0x2c,0xff,0xff,0xff,0xf5,0xa4,0x00,0x5c,0x0d,0xff,0xff,0xff,
+0x90,0xcd,0x00,0x4c,0x5f,0xff,0xff,0xfb,0x29,0x00,0x00,0x23,0x00,0x1b,0xd0,0x29,
+0x00,0x00,0x23,0x00,0x1c,0xfd,0x29,0x00,0x11,0x06,0xa5,0x00,0x0b,0x29,0x00,0x11,
+0xdf,0xc1,0x08,0x09,0x29,0x00,0x21,0x02,0xcf,0x1f,0x00,0x04,0x29,0x00,0x63,0x76,
+0x66,0x66,0x66,0x67,0x9c,0xe2,0x00,0x0d,0xf6,0x00,0x2e,0xf2,0x00,0xf6,0x00,0x2e,
+0xf4,0x00,0x29,0x00,0x2e,0xe3,0x00,0x29,0x00,0x1d,0x80,0x71,0x01,0x25,0xec,0x95,
+0xd3,0x00,0x1b,0xc0,0xaf,0x01,0x0f,0x0f,0x00,0xa4,0x04,0x5e,0x02,0x17,0x83,0x0f,
+0x00,0x00,0x01,0x00,0x1a,0xd5,0x0f,0x00,0x2a,0xff,0xa0,0x0f,0x00,0x2a,0xfa,0x00,
+0xa1,0x04,0x14,0x60,0x42,0x02,0x20,0x56,0x8c,0x0f,0x00,0x16,0xe0,0x69,0x00,0x10,
+0x2c,0x71,0x01,0x07,0x78,0x00,0x00,0xd1,0x01,0x06,0x0f,0x00,0x00,0xa1,0x0a,0x17,
+0xfa,0x0f,0x00,0x1a,0x3f,0x08,0x03,0x0b,0x0f,0x00,0x1a,0x7f,0x2d,0x00,0x46,0xef,
+0xff,0xff,0xf7,0x0f,0x00,0xa5,0x3c,0xff,0xff,0xff,0xf1,0xcf,0xff,0xff,0xf7,0x66,
+0x11,0x02,0x19,0xa0,0xa5,0x00,0x29,0xfe,0x10,0x0f,0x00,0x19,0xf3,0xc3,0x00,0x28,
+0xfd,0x30,0x0f,0x00,0x28,0xfe,0x70,0x1d,0x01,0x24,0xc9,0x50,0x31,0x01,0x56,0x03,
+0x56,0x77,0x65,0x31,0xa1,0x03,0x11,0x7c,0x20,0x00,0x13,0xd8,0xab,0x0c,0x14,0x01,
+0x24,0x0c,0x12,0xfc,0x11,0x00,0x18,0x4e,0x31,0x0c,0x3a,0x00,0x00,0x05,0x8c,0x03,
+0x29,0x00,0x3f,0x4f,0x01,0x01,0x19,0x01,0x61,0xff,0xd7,0x30,0x00,0x13,0x7d,0x50,
+0x01,0x33,0x00,0x07,0xff,0x86,0x09,0x00,0x23,0x01,0x45,0xff,0xe1,0x00,0x0e,0xf7,
+0x0c,0x11,0x03,0x52,0x00,0x24,0x1a,0xef,0xf8,0x0c,0x22,0x00,0x5f,0xb4,0x03,0x23,
+0x7b,0xd0,0x10,0x00,0x16,0x0c,0x22,0x0d,0x0e,0x14,0x0c,0x04,0xbf,0x02,0x08,0x6a,
+0x04,0x13,0xff,0xf7,0x06,0x26,0x00,0x0b,0x77,0x09,0x0b,0x10,0x00,0x1b,0xf1,0x10,
+0x00,0x1f,0xf2,0x10,0x00,0x0c,0x12,0xf1,0xcd,0x05,0x11,0x66,0x01,0x00,0x05,0x10,
+0x00,0x06,0x70,0x00,0x17,0xf0,0x0f,0x00,0x12,0x03,0x90,0x00,0x14,0x28,0xb4,0x00,
+0x11,0x07,0x5b,0x04,0x11,0x5b,0x26,0x01,0x04,0x6b,0x04,0x21,0x40,0x6e,0x84,0x04,
+0x04,0xf0,0x00,0x30,0xff,0x00,0x4f,0xd1,0x01,0x02,0xcf,0x00,0x10,0xef,0x4a,0x06,
+0x00,0xf5,0x00,0x11,0xd2,0x10,0x00,0x11,0x3e,0x6f,0x00,0x23,0x03,0xff,0xb1,0x0a,
+0x13,0x18,0x09,0x00,0x01,0xd1,0x0d,0x31,0xb8,0x78,0x9d,0xb8,0x0d,0x03,0xc8,0x0a,
+0x04,0x01,0x00,0x10,0xd1,0x38,0x00,0x06,0xe3,0x0d,0x02,0x25,0x0e,0x27,0x06,0xef,
+0x26,0x05,0x10,0x00,0x4a,0x00,0x12,0xef,0x10,0x02,0x15,0x81,0xac,0x06,0xb0,0x8b,
+0xde,0xff,0xed,0xa8,0x30,0x00,0x00,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x51,0x03,
+0x56,0x77,0x65,0x20,0x0a,0x00,0x52,0x0c,0xff,0xff,0xff,0x20,0x15,0x00,0x80,0x06,
+0xbf,0xff,0xff,0xff,0xff,0xfb,0x50,0x0c,0x00,0x42,0xcf,0xff,0xff,0xf2,0x16,0x00,
+0x22,0x7e,0xff,0x01,0x00,0x18,0xe5,0x2d,0x00,0x33,0x02,0xcf,0xff,0x01,0x00,0x26,
+0xfb,0x10,0x2d,0x00,0x34,0x02,0xef,0xff,0x01,0x00,0x25,0xfd,0x10,0x2d,0x00,0x07,
+0x16,0x00,0x26,0xff,0xfc,0x2d,0x00,0x00,0x42,0x00,0x95,0xfa,0x51,0x00,0x15,0xaf,
+0xff,0xff,0xff,0xf9,0x2d,0x00,0x50,0x6f,0xff,0xff,0xff,0xe4,0x1f,0x00,0x54,0x4e,
+0xff,0xff,0xff,0xf3,0x2d,0x00,0x51,0x0e,0xff,0xff,0xff,0xe2,0x8e,0x00,0x53,0x2e,
+0xff,0xff,0xff,0xb0,0x2d,0x00,0x52,0x04,0xff,0xff,0xff,0xf5,0xa5,0x00,0x10,0x6f,
+0x12,0x00,0x03,0x2d,0x00,0x11,0xaf,0x67,0x00,0x13,0x00,0x64,0x00,0x13,0xf8,0x2d,
+0x00,0x53,0x0d,0xff,0xff,0xff,0x60,0xe8,0x00,0x42,0xff,0xff,0xff,0xc0,0x2d,0x00,
+0x53,0x01,0xff,0xff,0xff,0xf1,0x2d,0x00,0x40,0x1f,0xff,0xff,0xff,0x2d,0x00,0x74,
+0xcc,0xcc,0xcc,0xcf,0xff,0xff,0xfe,0x2b,0x01,0x55,0xef,0xff,0xff,0xf3,0xcf,0xc1,
+0x00,0x13,0xb0,0x16,0x00,0x55,0x0b,0xff,0xff,0xff,0x5c,0x16,0x00,0x13,0xfa,0x2d,
+0x00,0x00,0x7c,0x00,0x16,0xf6,0x2d,0x00,0x13,0x90,0x16,0x00,0x55,0x09,0xff,0xff,
+0xff,0x7c,0x16,0x00,0x14,0xf9,0x2d,0x00,0x4e,0x9f,0xff,0xff,0xf7,0x2d,0x00,0x52,
+0x0a,0xff,0xff,0xff,0x6c,0xb4,0x00,0x44,0x3f,0xff,0xff,0xfb,0x2d,0x00,0x46,0xbf,
+0xff,0xff,0xf5,0xb4,0x00,0x13,0xd0,0x16,0x00,0x00,0xd6,0x00,0x12,0x3c,0x2d,0x00,
+0x00,0x24,0x01,0x04,0x2d,0x00,0x00,0xd6,0x00,0x02,0x0e,0x01,0x00,0x38,0x00,0x13,
+0xf4,0x16,0x00,0x43,0x4f,0xff,0xff,0xfd,0x0e,0x01,0x56,0x07,0xff,0xff,0xff,0xa0,
+0x70,0x00,0x13,0x90,0x2d,0x00,0x15,0x1f,0x0d,0x02,0x10,0x02,0x7f,0x01,0x04,0x95,
+0x01,0x14,0xbf,0x52,0x01,0x00,0x0a,0x00,0x14,0xfd,0x95,0x01,0x14,0x03,0xf9,0x00,
+0x00,0xc9,0x00,0x24,0xff,0x50,0x2d,0x00,0x10,0x0a,0xe7,0x01,0x50,0x30,0x00,0x00,
+0x03,0xcf,0x67,0x01,0x05,0xef,0x01,0x10,0x1e,0xe4,0x00,0x41,0xd9,0x78,0x9d,0xff,
+0xcb,0x01,0x05,0x49,0x02,0x16,0x2f,0x1c,0x02,0x17,0xf4,0x76,0x02,0x18,0x3e,0x16,
+0x00,0x06,0xa3,0x02,0x14,0x1b,0x16,0x00,0x19,0xc1,0xa3,0x02,0x22,0x04,0xcf,0x5d,
+0x02,0x1a,0x40,0xd0,0x02,0x75,0x00,0x27,0xad,0xef,0xfe,0xda,0x72,0xf5,0x02,0x37,
+0x05,0x8b,0xde,0x56,0x00,0x39,0x00,0x18,0xef,0x7c,0x00,0x39,0x04,0xef,0xff,0x10,
+0x00,0x29,0x4f,0xff,0x10,0x00,0x2a,0x01,0xff,0x10,0x00,0x11,0x0a,0xd0,0x00,0x60,
+0x76,0x66,0x66,0x66,0x66,0xcf,0x10,0x00,0x14,0x0f,0xb9,0x02,0x01,0x05,0x02,0x11,
+0xf4,0x3f,0x00,0x17,0x20,0x10,0x00,0x16,0x6f,0x26,0x02,0x01,0x10,0x00,0x48,0x8f,
+0xff,0xff,0xf7,0x10,0x00,0x1b,0x7f,0x10,0x00,0x16,0x6f,0x29,0x02,0x01,0x10,0x00,
+0x16,0x2f,0x93,0x02,0x01,0x10,0x00,0x16,0x0d,0x8d,0x02,0x01,0x10,0x00,0x10,0x05,
+0x75,0x03,0x16,0x62,0x10,0x00,0x00,0xab,0x01,0x09,0xd0,0x00,0x1b,0x1d,0x10,0x00,
+0x2b,0x00,0xaf,0x10,0x00,0x2a,0x03,0xaf,0x10,0x00,0x2a,0x00,0x08,0x10,0x00,0x00,
+0x8f,0x02,0x24,0xff,0x76,0xf0,0x00,0x02,0x81,0x01,0x16,0xf9,0x70,0x00,0x01,0x54,
+0x02,0x17,0xe1,0x10,0x00,0x14,0x2f,0x72,0x03,0x03,0x10,0x00,0x05,0x46,0x02,0x02,
+0x10,0x00,0x00,0xb1,0x00,0x17,0xf2,0x10,0x00,0x00,0x21,0x02,0x17,0x80,0x10,0x00,
+0x15,0xaf,0xf1,0x00,0x01,0x10,0x00,0x07,0xed,0x03,0x01,0x10,0x00,0x1b,0x0e,0x00,
+0x01,0x1a,0x9f,0x70,0x01,0x00,0x9d,0x02,0x17,0xf8,0x30,0x01,0x17,0x0d,0x35,0x03,
+0x03,0x90,0x00,0x62,0x05,0x9c,0xef,0xfe,0xda,0x71,0x13,0x00,0x26,0x07,0xef,0x84,
+0x03,0x25,0x01,0xcf,0xc3,0x04,0x02,0x4f,0x02,0x01,0x01,0x00,0x13,0xd0,0x66,0x04,
+0x32,0x85,0x57,0xef,0xaa,0x01,0x11,0xef,0xbf,0x00,0x11,0x1e,0xa6,0x00,0x12,0x03,
+0x4f,0x03,0x11,0x07,0x84,0x00,0x52,0x02,0x66,0x66,0x66,0x30,0x14,0x00,0x01,0x4b,
+0x05,0x04,0x4f,0x03,0x18,0x60,0x0d,0x00,0x10,0x70,0x71,0x01,0x12,0x8b,0x73,0x02,
+0x00,0x0d,0x00,0x45,0x04,0xdf,0xff,0xff,0x0d,0x00,0x26,0x7f,0xff,0x0d,0x00,0x10,
+0x04,0x07,0x00,0x31,0xcb,0xaa,0xab,0x0d,0x00,0x12,0x0d,0xa4,0x00,0x02,0x41,0x00,
+0x12,0x3f,0x50,0x01,0x01,0x0d,0x00,0x00,0x33,0x00,0x10,0xf6,0xd4,0x00,0x01,0x0d,
+0x00,0x12,0x8f,0xe1,0x00,0x11,0x09,0x0d,0x00,0x12,0x9f,0x1a,0x00,0x14,0x1f,0x27,
+0x00,0x11,0xf9,0x8b,0x01,0x00,0x6c,0x01,0x81,0x5f,0xff,0xff,0xff,0x40,0x00,0x2c,
+0xff,0xa8,0x03,0x10,0x1f,0x41,0x03,0x30,0xac,0xff,0xff,0x22,0x00,0x22,0x45,0x09,
+0x7e,0x00,0x30,0xf8,0x0f,0xff,0x55,0x04,0x12,0xdf,0x1c,0x01,0x01,0xf2,0x02,0x02,
+0x83,0x03,0x41,0xf6,0x00,0x01,0xef,0x6f,0x04,0xc5,0x4a,0xdf,0xfe,0xb7,0x10,0x00,
+0x00,0x19,0xef,0xfd,0xa5,0x00,0xdf,0x00,0x33,0x46,0x8a,0x40,0x0a,0x00,0x24,0x58,
+0xad,0xf8,0x00,0x22,0x01,0x6b,0x53,0x00,0x10,0x60,0x17,0x00,0x26,0xaf,0xff,0x0d,
+0x00,0x26,0x8f,0xff,0x0d,0x00,0x14,0x0b,0x0c,0x00,0x32,0xfe,0x50,0x00,0x76,0x00,
+0x43,0xfe,0xc9,0x75,0x42,0x54,0x04,0x31,0xfb,0x84,0x10,0x56,0x00,0x00,0xb7,0x00,
+0x15,0xc5,0x6d,0x00,0x11,0xdf,0xdd,0x00,0x03,0x07,0x04,0x00,0xcf,0x00,0x14,0x00,
+0x74,0x05,0x00,0xe9,0x00,0x51,0x03,0x68,0x87,0x64,0x00,0x40,0x06,0x31,0xf1,0x00,
+0x29,0xae,0x06,0x10,0x40,0x98,0x02,0x25,0xc0,0x06,0xbc,0x06,0x34,0x5f,0xff,0x80,
+0x6e,0x01,0x56,0xd1,0x00,0x7f,0xff,0x54,0xd2,0x05,0x90,0x9f,0xff,0x4d,0xff,0xff,
+0x83,0x10,0x16,0xdf,0x26,0x01,0x53,0xaf,0xff,0x8f,0xff,0xe2,0x0f,0x02,0x41,0xb0,
+0xbf,0xff,0xef,0x69,0x00,0x13,0x02,0x67,0x05,0x14,0xfc,0x1b,0x05,0x23,0xf4,0xcf,
+0xc5,0x03,0x00,0x68,0x01,0x14,0xf8,0x27,0x03,0x00,0x0b,0x04,0x20,0xf9,0xbf,0xce,
+0x06,0x03,0x45,0x03,0x23,0xfa,0xaf,0xfa,0x02,0x00,0x23,0x03,0x28,0xfb,0x8f,0x0d,
+0x00,0x17,0x6f,0x27,0x00,0x33,0xf9,0x3f,0xff,0xdd,0x00,0x12,0x6f,0x8b,0x01,0x14,
+0xf9,0x6d,0x05,0x23,0xf5,0x0a,0x1c,0x03,0x00,0x85,0x02,0x23,0xf1,0x04,0x39,0x03,
+0x11,0x08,0x12,0x03,0x00,0xf3,0x06,0x03,0x57,0x01,0x11,0x40,0x83,0x03,0x32,0xea,
+0x89,0xbf,0xa9,0x05,0x15,0x06,0x56,0x02,0x12,0xc0,0x46,0x01,0x06,0xbb,0x06,0x03,
+0x92,0x01,0x22,0xfc,0x50,0xb7,0x01,0x66,0x6a,0xde,0xff,0xed,0xa7,0x20,0x23,0x04,
+0x32,0xee,0xc9,0x51,0x84,0x01,0x03,0x33,0x00,0x17,0x10,0x3c,0x04,0x46,0xfe,0x30,
+0x0a,0xff,0x0d,0x00,0x10,0x10,0xdb,0x00,0x40,0x22,0x22,0x23,0x5b,0x3e,0x02,0x00,
+0x19,0x00,0x04,0x48,0x04,0x53,0xc0,0xaf,0xff,0xff,0xf0,0x66,0x07,0x24,0xfe,0x0a,
+0xab,0x06,0x00,0x58,0x03,0x07,0x19,0x00,0x14,0xfa,0x19,0x00,0x00,0x49,0x03,0x90,
+0x30,0xaf,0xff,0xff,0xf1,0x11,0x11,0x12,0x5a,0xdf,0x00,0x27,0x0a,0xff,0x1b,0x02,
+0x05,0x7d,0x00,0x18,0xc5,0x96,0x00,0x28,0xea,0x40,0xd2,0x04,0x13,0xb0,0x4b,0x00,
+0x20,0x02,0x6c,0x0d,0x00,0x04,0x64,0x00,0x00,0x15,0x00,0x13,0x3a,0x7d,0x00,0x00,
+0x63,0x01,0x14,0xf8,0x19,0x00,0x00,0xde,0x05,0x17,0x9a,0x19,0x00,0x14,0xf9,0x19,
+0x00,0x00,0x93,0x02,0x90,0x6a,0xff,0xff,0xff,0x22,0x22,0x22,0x24,0x7d,0xf0,0x01,
+0x07,0x64,0x00,0x17,0xf8,0xfa,0x00,0x17,0xfa,0x7d,0x00,0x15,0xd5,0x96,0x00,0x35,
+0xed,0xb8,0x30,0x45,0x01,0x1f,0xfb,0x08,0x00,0x08,0x54,0xf7,0x77,0x77,0x77,0x75,
+0x73,0x00,0x0f,0x08,0x00,0x8d,0x04,0xf2,0x07,0x25,0xff,0xff,0x73,0x05,0x1a,0xbf,
+0x0f,0x00,0x1a,0xdf,0x0f,0x00,0x19,0xff,0x0f,0x00,0x00,0x36,0x03,0x34,0x77,0x77,
+0x7b,0x0f,0x00,0x10,0x04,0x52,0x08,0x03,0x3a,0x05,0x02,0xfa,0x01,0x17,0xfb,0x0f,
+0x00,0x11,0x09,0xf6,0x02,0x05,0x0f,0x00,0x11,0x0c,0x60,0x03,0x05,0x0f,0x00,0x11,
+0x0f,0x62,0x03,0x17,0x07,0x4c,0x08,0x16,0xf1,0x0f,0x00,0x00,0xe2,0x02,0x17,0xe0,
+0x0f,0x00,0x11,0x9f,0xf8,0x02,0x05,0x0f,0x00,0x11,0xcf,0x35,0x03,0x05,0x0f,0x00,
+0x02,0xad,0x05,0x04,0x0f,0x00,0x00,0x47,0x05,0x16,0x10,0x0f,0x00,0x11,0x09,0xa4,
+0x00,0x05,0x0f,0x00,0x12,0x0e,0x8b,0x03,0x04,0x0f,0x00,0x16,0x4f,0xff,0x06,0x03,
+0x2d,0x09,0x16,0xe0,0x0f,0x00,0x13,0x03,0x9d,0x03,0x02,0x0f,0x00,0x10,0x57,0x06,
+0x0a,0x22,0x97,0x77,0xff,0x00,0x39,0x97,0x74,0xaf,0x54,0x08,0x1f,0xf9,0x0f,0x00,
+0x1d,0x16,0x10,0x50,0x06,0x0f,0x0f,0x00,0x75,0x00,0x4b,0x03,0x43,0x59,0xde,0xff,
+0xdb,0x75,0x09,0x12,0x18,0xac,0x00,0x01,0x22,0x00,0x13,0x2d,0xc0,0x03,0x13,0x20,
+0xc6,0x0b,0x04,0x0d,0x00,0x00,0xd4,0x06,0x31,0xa5,0x33,0x7e,0x47,0x05,0x12,0x08,
+0x08,0x06,0x11,0x1d,0xeb,0x07,0x12,0xef,0xa3,0x0a,0x10,0x3f,0xb8,0x01,0x12,0x5f,
+0x18,0x05,0x00,0xb6,0x01,0x26,0x20,0x09,0x57,0x04,0x10,0xf7,0x6b,0x02,0xb6,0xe1,
+0x11,0x11,0x11,0x11,0x6f,0xff,0xff,0xa0,0x0f,0xff,0x7f,0x0c,0x17,0x00,0x2c,0x01,
+0x27,0xe0,0x1f,0x0d,0x00,0x08,0xc8,0x09,0x22,0xf0,0x0f,0xd9,0x01,0x05,0x35,0x0b,
+0x04,0x22,0x08,0x01,0xe8,0x05,0x17,0x00,0xed,0x02,0x15,0xf3,0x44,0x0a,0x03,0xd0,
+0x01,0x32,0x04,0x54,0x31,0x73,0x0b,0x12,0x20,0x86,0x05,0x01,0x75,0x07,0x21,0xfd,
+0x20,0xff,0x01,0x12,0xf1,0x02,0x03,0x31,0xa7,0x7a,0xff,0xc1,0x05,0x18,0x03,0xf9,
+0x0b,0x27,0x03,0xef,0x05,0x0c,0x12,0x01,0x47,0x03,0x12,0xd4,0x5b,0x00,0x62,0x16,
+0xad,0xef,0xfe,0xc8,0x30,0xd5,0x0b,0x12,0xf8,0xde,0x02,0x12,0xf0,0x4b,0x06,0x13,
+0xe0,0x90,0x02,0x03,0x12,0x00,0x10,0xef,0xac,0x02,0x02,0xc0,0x02,0x02,0x12,0x00,
+0x11,0x08,0xc7,0x00,0x11,0x3f,0x7a,0x00,0x02,0x12,0x00,0x11,0x1f,0x94,0x02,0x11,
+0x0b,0x68,0x00,0x02,0x12,0x00,0x11,0x8f,0x2f,0x09,0x11,0x02,0x49,0x00,0x01,0x12,
+0x00,0x13,0x01,0xbd,0x00,0x10,0x9f,0x53,0x08,0x01,0x12,0x00,0x02,0x6d,0x03,0x01,
+0x3d,0x00,0x12,0xf2,0x12,0x00,0x13,0x1f,0x1e,0x0d,0x01,0x96,0x03,0x01,0x12,0x00,
+0x14,0xaf,0xa5,0x09,0x00,0x85,0x00,0x00,0x12,0x00,0x14,0x04,0xa7,0x09,0x00,0xa4,
+0x01,0x10,0xf2,0x12,0x00,0x14,0x2e,0xb7,0x06,0x01,0x07,0x05,0x46,0xaf,0xff,0xff,
+0xfa,0xab,0x09,0x07,0x7e,0x01,0x16,0x20,0x1c,0x0d,0x03,0x01,0x00,0x24,0xa0,0x00,
+0x08,0x07,0x11,0xee,0x76,0x06,0x04,0xe0,0x0b,0x00,0x75,0x00,0x10,0x70,0x5a,0x00,
+0x14,0x06,0x10,0x0d,0x10,0x03,0x75,0x00,0x01,0x90,0x00,0x13,0xef,0xf4,0x07,0x10,
+0x0c,0x34,0x01,0x01,0x12,0x00,0x12,0x7f,0xe0,0x06,0x00,0x8f,0x00,0x12,0xf1,0x12,
+0x00,0x13,0x0f,0x3a,0x0a,0x15,0xdf,0xea,0x00,0x02,0x31,0x01,0x01,0x12,0x07,0x16,
+0x20,0x0e,0x01,0x11,0x70,0xd2,0x01,0x14,0xfa,0x32,0x01,0x11,0x9f,0xc9,0x03,0x11,
+0x7f,0xfd,0x01,0x02,0x12,0x00,0x10,0x2f,0x65,0x00,0x12,0x01,0xce,0x00,0x02,0x12,
+0x00,0x10,0x0b,0x50,0x01,0x11,0x09,0x6c,0x07,0x03,0x12,0x00,0x10,0x03,0x2b,0x09,
+0x11,0x2f,0x15,0x08,0x03,0x12,0x00,0x50,0x00,0xcf,0xff,0xff,0xf2,0x90,0x00,0x00,
+0x00,0x59,0xce,0xff,0xed,0xa5,0x00,0x01,0x00,0x20,0x7e,0xff,0x01,0x00,0x62,0xf7,
+0x00,0x00,0x00,0x1c,0xff,0x01,0x00,0x43,0xb0,0x00,0x00,0xcf,0x0b,0x00,0xf2,0x18,
+0xfa,0x00,0x06,0xff,0xff,0xff,0xa5,0x45,0x8f,0xff,0xff,0xff,0x20,0x0d,0xff,0xff,
+0xf4,0x00,0x00,0x04,0xff,0xff,0xff,0x60,0x1d,0xef,0xff,0x90,0x00,0x00,0x00,0xef,
+0xff,0xff,0x70,0x00,0x00,0x12,0x10,0x0b,0x00,0x11,0x40,0x50,0x00,0x00,0x32,0x00,
+0x11,0xfe,0x09,0x00,0x60,0x01,0x26,0xbf,0xff,0xff,0xf5,0x0a,0x00,0x10,0x07,0x4c,
+0x00,0x24,0xfe,0x40,0x0b,0x00,0x34,0xfb,0x60,0x00,0x0b,0x00,0x35,0xfe,0xa4,0x00,
+0x21,0x00,0x21,0xff,0xb1,0x36,0x00,0x72,0x34,0x69,0xef,0xff,0xff,0xfd,0x00,0x01,
+0x00,0x53,0x09,0xff,0xff,0xff,0x90,0x0c,0x00,0x70,0xdf,0xff,0xff,0xf0,0x00,0x00,
+0x25,0x0b,0x00,0x82,0x9f,0xff,0xff,0xf2,0x49,0xcf,0xff,0x30,0x0b,0x00,0x52,0xf3,
+0x7f,0xff,0xff,0xc0,0x21,0x00,0xc0,0xf1,0x1f,0xff,0xff,0xf9,0x00,0x00,0x08,0xff,
+0xff,0xff,0xd0,0x05,0x00,0x40,0xe8,0x79,0xdf,0xff,0xa5,0x00,0x04,0xd1,0x00,0x16,
+0xfd,0xe7,0x00,0x51,0xc1,0x00,0x00,0x00,0x8f,0x0a,0x00,0x11,0xe7,0x78,0x00,0x91,
+0x6a,0xdf,0xff,0xec,0x95,0x00,0x00,0x00,0xaf,0xd5,0x00,0x01,0x04,0x01,0x13,0xf3,
+0x0c,0x00,0x26,0x05,0xff,0x0c,0x00,0x17,0x0e,0x0c,0x00,0x16,0x7f,0x0c,0x00,0x26,
+0x01,0xff,0x0c,0x00,0x17,0x09,0x0c,0x00,0x17,0x2f,0x0c,0x00,0x15,0xbf,0x0c,0x00,
+0x00,0x46,0x01,0x14,0xfb,0x0c,0x00,0x44,0x0d,0xff,0xff,0x9a,0x0c,0x00,0x43,0x6f,
+0xff,0xff,0x1c,0x0c,0x00,0x53,0x01,0xef,0xff,0xf7,0x0d,0x0c,0x00,0x52,0x09,0xff,
+0xff,0xe0,0x0e,0x0c,0x00,0x53,0x60,0x2f,0xff,0xff,0x50,0x0c,0x00,0x53,0x50,0xbf,
+0xff,0xfc,0x00,0x0c,0x00,0x44,0x44,0xff,0xff,0xf3,0x0c,0x00,0x44,0x3d,0xff,0xff,
+0xa0,0x0c,0x00,0x44,0x8f,0xff,0xff,0x20,0x0c,0x00,0x44,0xef,0xff,0xf8,0x00,0x0c,
+0x00,0x37,0xff,0xff,0xe1,0x0c,0x00,0x16,0x60,0x0c,0x00,0x26,0xfd,0x00,0x0c,0x00,
+0x17,0xf5,0x0c,0x00,0x17,0xc0,0x0c,0x00,0x16,0x30,0x0c,0x00,0x23,0xfa,0x00,0x0c,
+0x00,0x41,0x00,0x8f,0xff,0xfb,0x38,0x01,0x00,0x4d,0x02,0x12,0x6f,0x04,0x02,0x01,
+0x42,0x00,0x10,0x2f,0x30,0x00,0x00,0x44,0x01,0x20,0xf1,0x00,0xec,0x00,0x40,0xd1,
+0x00,0x00,0x1e,0x4e,0x00,0x00,0x12,0x00,0x33,0xfe,0x85,0x58,0x39,0x02,0x12,0x9f,
+0x95,0x01,0x16,0xf8,0x0e,0x02,0x22,0xfe,0x60,0x4f,0x02,0x6f,0xad,0xef,0xfe,0xda,
+0x50,0x00,0x01,0x00,0x07,0x0f,0xb0,0x01,0xff,0x26,0x11,0xaf,0x4f,0x03,0x00,0x35,
+0x03,0x12,0x80,0x0b,0x00,0x00,0x36,0x01,0x12,0x10,0x0b,0x00,0x10,0x0c,0x12,0x04,
+0x02,0x0b,0x00,0x43,0x4f,0xff,0xff,0xe0,0x0b,0x00,0x10,0xcf,0x78,0x00,0x01,0x0b,
+0x00,0x11,0x04,0x77,0x00,0x01,0x0b,0x00,0x11,0x0c,0x76,0x00,0x01,0x0b,0x00,0x11,
+0x4f,0x75,0x00,0x01,0x0b,0x00,0x11,0xdf,0xd6,0x01,0x00,0x0b,0x00,0x21,0x08,0xff,
+0x17,0x02,0x00,0x0b,0x00,0x11,0x7f,0x03,0x02,0x22,0x00,0xaf,0xeb,0x01,0x15,0x30,
+0x0b,0x00,0x26,0xfc,0x00,0x16,0x00,0x13,0x50,0x0b,0x00,0x43,0xef,0xff,0xff,0xd0,
+0x37,0x00,0x43,0x0c,0xff,0xff,0xf6,0x0b,0x00,0x12,0x04,0x5c,0x04,0x04,0x63,0x00,
+0x13,0x70,0x0b,0x00,0x11,0x5f,0x59,0x00,0x01,0x0b,0x00,0x11,0x0d,0x44,0x02,0x01,
+0x0b,0x00,0x01,0xd0,0x00,0x03,0xbb,0x00,0x10,0xdf,0x62,0x01,0x01,0x0b,0x00,0x00,
+0xb3,0x01,0x13,0xf2,0x0b,0x00,0x10,0x0d,0x9c,0x00,0x02,0x0b,0x00,0x10,0x06,0x92,
+0x00,0x03,0x13,0x01,0x12,0xef,0x3d,0x01,0x24,0x04,0xff,0x01,0x00,0x15,0xf2,0x95,
+0x02,0x04,0x0e,0x00,0x19,0x09,0x0e,0x00,0x18,0x0b,0x0e,0x00,0x00,0x56,0x00,0x52,
+0xf9,0x77,0x77,0x77,0xbf,0x0e,0x00,0x12,0x0f,0x07,0x00,0x12,0x7f,0x07,0x00,0x12,
+0x2f,0x62,0x00,0x03,0x0e,0x00,0x12,0x4f,0xe5,0x00,0x03,0x0e,0x00,0x11,0x6f,0x7b,
+0x05,0x04,0x0e,0x00,0x12,0x8f,0xf9,0x04,0x03,0x0e,0x00,0x11,0xbf,0xf3,0x01,0x04,
+0x0e,0x00,0x02,0x5e,0x01,0x04,0x0e,0x00,0x00,0x9c,0x05,0x05,0x0e,0x00,0x55,0x02,
+0xff,0xff,0xff,0x00,0x0e,0x00,0x13,0x05,0x5d,0x01,0x02,0x0e,0x00,0x13,0x07,0xfe,
+0x01,0x02,0x0e,0x00,0x12,0x0b,0xf6,0x05,0x03,0x0e,0x00,0x01,0xc2,0x03,0x05,0x0e,
+0x00,0x03,0xa7,0x00,0x03,0x0e,0x00,0x12,0x8f,0x10,0x01,0x02,0x0e,0x00,0x11,0x01,
+0x50,0x05,0x03,0x0e,0x00,0x23,0x34,0x4d,0x7d,0x00,0x01,0x0e,0x00,0x22,0x8f,0xff,
+0xec,0x01,0x06,0x0e,0x00,0x19,0xf2,0x0e,0x00,0x17,0x50,0x0e,0x00,0x35,0xfd,0xa3,
+0x00,0x0e,0x00,0x23,0xaf,0xff,0x7d,0x00,0x01,0x06,0x04,0x24,0xf2,0xaf,0x08,0x04,
+0x24,0x00,0xef,0x0f,0x00,0x01,0x0f,0x06,0x24,0x02,0xff,0x0f,0x00,0x01,0x73,0x00,
+0x16,0x07,0x0f,0x00,0x00,0x90,0x00,0x13,0x0c,0x0f,0x00,0x12,0xfd,0xad,0x00,0x31,
+0x1f,0xff,0xfd,0x0f,0x00,0x41,0xfe,0xbf,0xff,0xf1,0x5c,0x01,0x12,0xfa,0x2d,0x00,
+0x31,0x6f,0xff,0xf6,0x4f,0x01,0x12,0xf7,0x0f,0x00,0x31,0x2f,0xff,0xfb,0x42,0x01,
+0x11,0xa8,0x0f,0x00,0x00,0xcc,0x03,0x10,0x10,0xf8,0x01,0x12,0x59,0x0f,0x00,0x40,
+0x17,0xff,0xff,0x50,0xeb,0x01,0x12,0x19,0x0f,0x00,0x12,0x22,0xa7,0x03,0x22,0xfc,
+0x09,0x0f,0x00,0x84,0x20,0xdf,0xff,0xf0,0x00,0x3f,0xff,0xf7,0x0f,0x00,0x74,0x8f,
+0xff,0xf4,0x00,0x8f,0xff,0xf2,0x0f,0x00,0x74,0x3f,0xff,0xf9,0x00,0xcf,0xff,0xd0,
+0x0f,0x00,0x74,0x0e,0xff,0xfd,0x01,0xff,0xff,0x80,0x0f,0x00,0x74,0x09,0xff,0xff,
+0x25,0xff,0xff,0x40,0x0f,0x00,0x01,0x74,0x00,0x24,0xfe,0x00,0x0f,0x00,0x66,0x00,
+0xef,0xff,0x9c,0xff,0xfa,0x0f,0x00,0x56,0xaf,0xff,0xcf,0xff,0xf5,0x0f,0x00,0x20,
+0x5f,0xff,0xf1,0x02,0x05,0x0f,0x00,0x11,0x0f,0xb5,0x07,0x05,0x0f,0x00,0x11,0x0b,
+0x12,0x01,0x05,0x0f,0x00,0x11,0x06,0x30,0x01,0x05,0x0f,0x00,0x11,0x01,0x4e,0x01,
+0x04,0x0f,0x00,0x00,0xd5,0x03,0x15,0xf8,0x0f,0x00,0x22,0xf0,0x00,0x4f,0x02,0x12,
+0xaa,0x45,0x02,0x00,0x59,0x00,0x1f,0xfa,0x17,0x00,0x4c,0x53,0xf8,0x88,0x88,0x88,
+0x88,0x17,0x00,0x04,0x75,0x08,0x16,0xaf,0x0c,0x00,0x0f,0x17,0x00,0x08,0x0e,0xa1,
+0x00,0x0f,0x17,0x00,0x56,0x00,0x08,0x00,0x53,0x27,0xbd,0xef,0xfd,0xc9,0x98,0x06,
+0x22,0x03,0xbf,0xbd,0x06,0x00,0x09,0x09,0x01,0x7c,0x08,0x01,0xc0,0x06,0x19,0x30,
+0x1a,0x04,0x13,0x40,0x1a,0x00,0x20,0xb9,0x9c,0x1c,0x00,0x32,0x20,0x00,0x04,0xe6,
+0x02,0x21,0x03,0xdf,0x34,0x03,0x12,0xcf,0x8d,0x03,0x20,0x01,0xef,0x0a,0x03,0x13,
+0x3f,0xf1,0x02,0x00,0xba,0x01,0x22,0xa0,0x08,0xee,0x05,0x01,0x79,0x00,0x33,0xfe,
+0x00,0xcf,0x54,0x03,0x00,0x09,0x00,0x10,0xf1,0xf8,0x01,0x05,0x26,0x09,0x22,0x40,
+0xff,0x4d,0x04,0x01,0xaf,0x03,0x24,0xf5,0x1f,0x43,0x09,0x00,0x26,0x03,0x14,0x61,
+0x1b,0x00,0x00,0x6e,0x03,0x24,0xf6,0x0f,0x1b,0x00,0x10,0x08,0x93,0x03,0x13,0xff,
+0xe2,0x00,0x00,0x7b,0x03,0x24,0xf4,0x0c,0xce,0x03,0x10,0x0c,0x3b,0x05,0x12,0x8f,
+0x78,0x05,0x01,0xf2,0x03,0x24,0xd0,0x03,0x44,0x00,0x10,0x7f,0xb7,0x00,0x13,0x0c,
+0x95,0x00,0x11,0x2f,0x63,0x05,0x12,0x4f,0x83,0x03,0x12,0x4e,0xac,0x09,0x00,0xea,
+0x03,0x33,0xea,0x89,0xdf,0x30,0x00,0x14,0xbf,0x00,0x01,0x13,0xe2,0x9b,0x00,0x05,
+0x7c,0x09,0x32,0x00,0x00,0x4c,0x93,0x09,0x12,0x60,0x45,0x01,0x67,0x02,0x7b,0xde,
+0xfe,0xdc,0x84,0x0b,0x06,0x1f,0xff,0x17,0x02,0x16,0x5f,0xf7,0x77,0x77,0x77,0x77,
+0x17,0x02,0x6f,0x0f,0x17,0x00,0x60,0x10,0xcf,0x93,0x04,0x30,0x17,0xbe,0xff,0x22,
+0x09,0x10,0x0b,0x4a,0x02,0x10,0x6f,0x14,0x01,0x11,0xc2,0x78,0x01,0x23,0xc0,0x8f,
+0x93,0x06,0x52,0x0a,0xff,0xff,0xfd,0x5f,0x2e,0x01,0x10,0xe1,0x5d,0x01,0x50,0xee,
+0xff,0xeb,0xac,0xff,0xad,0x01,0x10,0x0a,0x06,0x00,0x43,0x80,0x00,0x02,0xcf,0xfa,
+0x07,0x22,0xff,0x80,0x83,0x02,0x10,0xf6,0x19,0x00,0x13,0xe0,0x82,0x02,0x23,0xb0,
+0xaf,0x8f,0x05,0x53,0x1f,0xff,0xff,0xfe,0x0a,0xb9,0x07,0x01,0x6c,0x0b,0x04,0x94,
+0x00,0x00,0x15,0x00,0x14,0x3a,0xf6,0x0b,0x00,0x48,0x02,0x13,0xaf,0x2c,0x02,0x00,
+0x62,0x02,0x14,0x5a,0x6f,0x02,0x00,0x97,0x02,0x12,0xaf,0x57,0x00,0x01,0xb1,0x02,
+0x14,0x4a,0xbe,0x02,0x12,0xaf,0x8d,0x08,0x22,0xf2,0x00,0x3c,0x07,0x23,0xff,0x1a,
+0xd2,0x05,0x10,0x01,0x85,0x00,0x12,0xaf,0x3f,0x00,0x00,0xd8,0x00,0x32,0xfb,0x0a,
+0xff,0x92,0x02,0x10,0x1e,0xb9,0x02,0x12,0xaf,0x0d,0x00,0x10,0x1c,0xc1,0x02,0x93,
+0x0a,0xff,0xff,0xfe,0xff,0xfd,0x99,0xbf,0xff,0xb7,0x08,0x14,0xe7,0xed,0x0b,0x12,
+0x0a,0xb3,0x00,0x00,0x0c,0x00,0x01,0x0a,0x08,0x21,0xe0,0x08,0x33,0x02,0x11,0x10,
+0x19,0x00,0x64,0x00,0x02,0x8c,0xef,0xed,0x93,0x4f,0x08,0x03,0x01,0x00,0x14,0x0a,
+0x96,0x00,0x1f,0x00,0x19,0x00,0x54,0x00,0x01,0x00,0x53,0x49,0xce,0xff,0xec,0x94,
+0x3e,0x0d,0x11,0xef,0xae,0x00,0x27,0x40,0x00,0x91,0x0d,0x00,0x08,0x08,0x14,0x1d,
+0xf0,0x02,0x12,0xa0,0x55,0x04,0x31,0xfc,0x99,0xcf,0x27,0x01,0x00,0xa2,0x01,0x41,
+0xe3,0x00,0x00,0x3e,0x89,0x03,0x12,0xdf,0x48,0x07,0x10,0x5f,0xb1,0x01,0x13,0x4f,
+0xa8,0x04,0x13,0xdf,0x0a,0x0d,0x10,0x50,0x18,0x0b,0x31,0x99,0x99,0x99,0x3a,0x04,
+0x04,0x79,0x00,0x14,0x0f,0xb6,0x01,0x03,0x5b,0x02,0x14,0xd0,0x0c,0x00,0x05,0x40,
+0x04,0x04,0x00,0x04,0x07,0x32,0x00,0x18,0xfd,0x32,0x00,0x05,0xd5,0x00,0x00,0xba,
+0x01,0x01,0x00,0x05,0x03,0x05,0x02,0x13,0xf5,0xb6,0x01,0x22,0xf3,0x05,0x53,0x0e,
+0x01,0xb6,0x00,0x22,0x00,0x0e,0x40,0x02,0x11,0x03,0xc9,0x00,0x11,0x7f,0x25,0x05,
+0x11,0x03,0xf4,0x04,0x01,0xa2,0x0d,0x22,0xc9,0x9c,0x15,0x05,0x24,0x02,0xef,0x80,
+0x0e,0x00,0x7f,0x00,0x12,0xdf,0x0c,0x00,0x17,0xf9,0xaf,0x0e,0x12,0xd3,0x67,0x00,
+0x69,0x05,0x9c,0xef,0xfe,0xc8,0x40,0x32,0x04,0x1f,0xf2,0x0b,0x00,0x0e,0xb3,0x47,
+0x77,0x77,0x7c,0xff,0xff,0xff,0x87,0x77,0x77,0x71,0xa3,0x02,0x03,0xb7,0x00,0x0f,
+0x0b,0x00,0xc1,0x50,0xff,0x10,0x00,0x00,0x00,0x50,0x6f,0xff,0xff,0xf8,0x00,0x01,
+0x00,0x91,0x09,0xff,0xff,0xff,0x41,0xff,0xff,0xff,0xd0,0x0e,0x00,0x90,0xef,0xff,
+0xff,0xe0,0x0a,0xff,0xff,0xff,0x20,0x0d,0x00,0x10,0x3f,0x24,0x00,0x40,0x4f,0xff,
+0xff,0xf7,0x0d,0x00,0x11,0x08,0x16,0x00,0x12,0xdf,0x29,0x00,0x00,0x08,0x00,0x33,
+0xc0,0x00,0x07,0x29,0x00,0x72,0x2f,0xff,0xff,0xf6,0x00,0x00,0x1f,0x29,0x00,0x00,
+0x15,0x00,0x40,0x10,0x00,0x00,0xbf,0x21,0x00,0x91,0x00,0x00,0xcf,0xff,0xff,0xa0,
+0x00,0x00,0x04,0x29,0x00,0x00,0x22,0x00,0x51,0xf4,0x00,0x00,0x00,0x0e,0x29,0x00,
+0x40,0x05,0xff,0xff,0xfe,0x4a,0x00,0x11,0x8f,0x29,0x00,0x81,0xaf,0xff,0xff,0x90,
+0x00,0x00,0x00,0x02,0x3d,0x00,0x40,0x0f,0xff,0xff,0xf3,0x1b,0x00,0x40,0x0b,0xff,
+0xff,0xf7,0x3c,0x00,0x11,0xfd,0x9b,0x00,0x10,0x5f,0x29,0x00,0x44,0x9f,0xff,0xff,
+0x70,0xa9,0x00,0x63,0x10,0x0d,0xff,0xff,0xf1,0x00,0x9c,0x00,0x51,0xf6,0x01,0xff,
+0xff,0xfb,0x0d,0x00,0x00,0x8f,0x00,0x51,0xa0,0x6f,0xff,0xff,0x50,0x0e,0x00,0x00,
+0x82,0x00,0x42,0x0a,0xff,0xff,0xf0,0x0d,0x00,0x72,0x06,0xff,0xff,0xf3,0xef,0xff,
+0xf9,0x0d,0x00,0x00,0x68,0x00,0x43,0xaf,0xff,0xff,0x30,0x0e,0x00,0x25,0x9f,0xff,
+0x06,0x01,0x53,0x00,0x00,0x03,0xff,0xff,0x21,0x01,0x00,0x01,0x00,0x24,0x0d,0xff,
+0x13,0x01,0x00,0x01,0x00,0x22,0x6f,0xff,0xdc,0x00,0x01,0x01,0x00,0x21,0x01,0xff,
+0xfd,0x00,0x03,0x01,0x00,0x12,0x0b,0xfd,0x00,0x24,0x00,0x00,0xa4,0x00,0x15,0xa0,
+0x0d,0x00,0x12,0x5f,0xfd,0x00,0x05,0x51,0x00,0x02,0xd5,0x00,0x04,0x5a,0x01,0x14,
+0x60,0x0d,0x00,0x16,0x19,0x85,0x00,0x46,0x08,0xed,0xef,0xff,0x35,0x00,0x10,0x8f,
+0x84,0x00,0x17,0xf9,0x33,0x00,0x37,0xff,0xfc,0x00,0x1b,0x00,0x14,0xfa,0x0d,0x00,
+0x6f,0x05,0xde,0xff,0xed,0x83,0x00,0x01,0x00,0x10,0x15,0x1f,0x16,0x01,0x0f,0x14,
+0x00,0x92,0x60,0x4a,0xdf,0xfd,0x93,0x00,0x0f,0x14,0x00,0x41,0x28,0xce,0xfe,0xb6,
+0x13,0x00,0x10,0x1b,0x06,0x01,0x10,0xa0,0x14,0x00,0x10,0x07,0x0a,0x00,0x10,0xd3,
+0x8f,0x01,0x10,0xdf,0x0a,0x00,0x10,0xfb,0x14,0x00,0x01,0xd0,0x01,0x61,0xfe,0x20,
+0x00,0x00,0x0c,0xff,0x01,0x00,0x42,0x7f,0xff,0xff,0xf5,0x0a,0x00,0x11,0xd0,0x8e,
+0x01,0xb2,0xff,0xe9,0x8b,0xff,0xef,0xff,0xff,0xfd,0xff,0xb8,0x9e,0xc4,0x01,0x11,
+0xdf,0x42,0x02,0x10,0x3e,0x22,0x00,0x40,0xe3,0x00,0x01,0xcf,0xa0,0x02,0x00,0x90,
+0x02,0x12,0xe1,0xc0,0x02,0x21,0xff,0x50,0x93,0x00,0x20,0xff,0x30,0x6c,0x00,0x12,
+0x80,0x03,0x03,0x13,0xfd,0x40,0x03,0x32,0x70,0x0a,0xff,0x48,0x02,0x12,0x7f,0x04,
+0x03,0x10,0x04,0x98,0x00,0x00,0x35,0x02,0x00,0xa6,0x00,0x12,0x4f,0xc4,0x01,0x10,
+0x01,0x79,0x00,0x13,0x0f,0xf5,0x02,0x13,0x1f,0xba,0x02,0x53,0xff,0xff,0xff,0xf0,
+0x0f,0x0c,0x02,0x13,0x0f,0xf0,0x00,0x1f,0xdf,0x14,0x00,0x07,0x1f,0xfc,0x28,0x00,
+0x14,0x13,0xfe,0x07,0x03,0x04,0x64,0x00,0x17,0xe0,0x8c,0x00,0x13,0xf3,0x8c,0x00,
+0x10,0xc0,0xb4,0x00,0x12,0x40,0x3e,0x02,0x05,0xb4,0x00,0x22,0x07,0xff,0x88,0x03,
+0x17,0xef,0xdc,0x00,0x21,0x03,0xff,0x49,0x00,0x17,0x06,0x04,0x01,0x10,0x20,0x21,
+0x00,0x46,0xfc,0x10,0x00,0x4f,0x2c,0x01,0x12,0xfc,0x18,0x03,0xa2,0xea,0x9c,0xff,
+0xdf,0xff,0xff,0xfe,0xff,0xb9,0xaf,0xbb,0x02,0x12,0x0d,0x72,0x01,0x42,0x5f,0xff,
+0xff,0xf6,0x0a,0x00,0x11,0xb0,0xe5,0x03,0x00,0xcb,0x02,0x00,0xb4,0x00,0x10,0xaf,
+0x0a,0x00,0x10,0xfd,0x32,0x03,0x20,0x3d,0xff,0x57,0x01,0x00,0x14,0x00,0x10,0x09,
+0x0a,0x00,0x11,0xb1,0xe1,0x01,0x42,0x6c,0xef,0xfc,0x82,0xdc,0x00,0x4f,0x39,0xdf,
+0xfd,0xa4,0xbc,0x02,0xa7,0x0d,0x14,0x00,0x13,0x0d,0x30,0x02,0x00,0xf8,0x04,0x10,
+0xf7,0x68,0x05,0x13,0xfd,0x9e,0x01,0x15,0xfc,0x44,0x02,0x11,0x0d,0x4b,0x04,0x00,
+0xbf,0x04,0x12,0xf2,0xf0,0x03,0x12,0x50,0xb8,0x01,0x11,0xb0,0x40,0x01,0x10,0xa0,
+0xea,0x03,0x00,0x38,0x04,0x00,0x21,0x00,0x10,0xe0,0x3d,0x00,0x63,0x0a,0xff,0xff,
+0xfe,0x10,0x7f,0x3a,0x05,0x65,0x00,0x1e,0xff,0xff,0xfa,0x1f,0xc2,0x04,0x10,0x4f,
+0xe7,0x02,0x28,0xff,0xfc,0x4a,0x04,0x05,0xcf,0x04,0x27,0xdf,0xff,0x7f,0x04,0x13,
+0x02,0xa3,0x01,0x15,0x00,0x1b,0x06,0x15,0xf2,0xe9,0x04,0x18,0xef,0x1b,0x00,0x18,
+0xbf,0x36,0x00,0x18,0x6f,0x51,0x00,0x26,0x2f,0xff,0x9c,0x04,0x00,0x7b,0x03,0x23,
+0xfc,0x3f,0x41,0x06,0x01,0x1a,0x06,0x23,0x30,0x9f,0x53,0x00,0x11,0x03,0x46,0x03,
+0x16,0xef,0x4f,0x06,0x33,0xd0,0x00,0x04,0x59,0x03,0x11,0x9f,0xc5,0x00,0x03,0x53,
+0x03,0x12,0x4f,0xf5,0x04,0x11,0x1e,0x23,0x01,0x13,0x0e,0xdb,0x02,0x10,0x6f,0x15,
+0x00,0x04,0xc0,0x02,0x00,0x02,0x01,0x23,0xf4,0x05,0x14,0x01,0x02,0xb2,0x03,0x13,
+0xaf,0x6b,0x01,0x01,0x15,0x00,0x13,0x0a,0xfc,0x02,0x11,0x0f,0x25,0x05,0x0f,0x1b,
+0x00,0xf1,0xc7,0x77,0x77,0x77,0x77,0x7f,0xff,0xff,0xfd,0x77,0x70,0xaf,0xff,0x01,
+0x00,0x18,0x1a,0x0d,0x00,0x1f,0xf1,0x1b,0x00,0x08,0x06,0xd4,0x02,0x18,0xaf,0xef,
+0x06,0x1f,0x0a,0x1b,0x00,0x5c,0x13,0x0f,0xe0,0x02,0x00,0x08,0x00,0x0f,0x0c,0x00,
+0x5c,0x17,0xfa,0x0c,0x00,0x23,0xff,0x10,0x0c,0x00,0x00,0xb2,0x03,0x96,0xd4,0x10,
+0x02,0x6a,0xef,0xff,0xff,0xf8,0x09,0x2f,0x01,0x27,0xf8,0x03,0x0c,0x00,0x27,0x00,
+0x9f,0x0c,0x00,0x02,0x25,0x00,0x21,0xd7,0x2f,0x5c,0x00,0x77,0x39,0xdf,0xfe,0xda,
+0x62,0x00,0x0f,0x76,0x08,0x0f,0x0c,0x00,0x45,0x11,0xaf,0x67,0x03,0x00,0x4c,0x04,
+0x02,0xe4,0x03,0x1f,0xf9,0x11,0x00,0xff,0x45,0xb2,0xb7,0x77,0x77,0x78,0xff,0xff,
+0xff,0x87,0x77,0x77,0x7c,0x11,0x00,0x09,0x01,0x00,0x0f,0x11,0x00,0x24,0x03,0x66,
+0x00,0x10,0x10,0x14,0x06,0x00,0x1a,0x05,0x0f,0x13,0x00,0xff,0x6d,0x09,0xe4,0x01,
+0x1b,0xfc,0x51,0x05,0x01,0x01,0x00,0x1f,0xf0,0x13,0x00,0x26,0x0b,0x40,0x08,0x1f,
+0x0b,0x13,0x00,0x96,0x50,0x00,0x0b,0xff,0xff,0xf0,0x22,0x1f,0xff,0x01,0x00,0x22,
+0x40,0x00,0x01,0x00,0x13,0x01,0x10,0x00,0x23,0xf4,0x00,0x01,0x00,0x0f,0x21,0x00,
+0x0e,0x57,0x07,0x77,0x77,0x77,0x7a,0x21,0x00,0x01,0x01,0x00,0x17,0x5f,0x21,0x00,
+0x00,0x01,0x00,0x1f,0x05,0x21,0x00,0x32,0x39,0x41,0x11,0x11,0x21,0x00,0x01,0x01,
+0x00,0x26,0xda,0x61,0x21,0x00,0x02,0x01,0x00,0x29,0xfa,0x20,0x21,0x00,0x4a,0xff,
+0xff,0xfe,0x30,0x21,0x00,0x36,0xff,0xfe,0x10,0x63,0x00,0x68,0x01,0x48,0xff,0xff,
+0xff,0xf7,0x84,0x00,0x58,0x04,0xff,0xff,0xff,0xc0,0x84,0x00,0x49,0x0d,0xff,0xff,
+0xfe,0xa5,0x00,0x48,0xbf,0xff,0xff,0xf0,0x21,0x00,0x1b,0x0e,0x21,0x00,0x53,0x07,
+0xff,0xff,0xff,0xa0,0x21,0x00,0x9b,0xf5,0x22,0x22,0x23,0x6b,0xff,0xff,0xff,0xf5,
+0x84,0x00,0x1b,0xfb,0xa5,0x00,0x1b,0xfb,0xc6,0x00,0x19,0xe6,0xe7,0x00,0x63,0xed,
+0xb8,0x40,0x00,0x00,0xaf,0x77,0x00,0x02,0x01,0x00,0x76,0xff,0xff,0xff,0xaa,0xff,
+0xff,0xff,0x11,0x00,0x4f,0x0f,0xff,0xff,0xfa,0x23,0x00,0x7c,0x4a,0xf1,0x11,0x11,
+0x10,0x23,0x00,0x00,0x01,0x00,0x36,0xfd,0xb8,0x30,0x23,0x00,0x03,0x01,0x00,0x19,
+0xd5,0x23,0x00,0x00,0x01,0x00,0x1c,0xf9,0x23,0x00,0x28,0xff,0xf6,0x69,0x00,0x69,
+0x13,0x6d,0xff,0xff,0xff,0xe0,0x8c,0x00,0x11,0x0c,0x7f,0x01,0x08,0x8c,0x00,0x10,
+0x5f,0x35,0x00,0x08,0x23,0x00,0x59,0x03,0xff,0xff,0xff,0x70,0x23,0x00,0x1c,0x6f,
+0x23,0x00,0x54,0x1e,0xff,0xff,0xff,0x20,0x23,0x00,0x51,0x22,0x22,0x22,0x35,0x9f,
+0x10,0x02,0x0b,0x8c,0x00,0x1c,0xf3,0xaf,0x00,0x1c,0xf4,0xaf,0x00,0x1a,0xa1,0xd2,
+0x00,0x4e,0xec,0x96,0x10,0x00,0x3b,0x01,0x18,0x0a,0x36,0x01,0x0f,0x19,0x00,0x54,
+0x05,0x95,0x01,0x18,0x0a,0x90,0x01,0x08,0x8b,0x01,0x18,0x0a,0x86,0x01,0x08,0x81,
+0x01,0x18,0x0a,0x7c,0x01,0x08,0x77,0x01,0x18,0x4a,0x72,0x01,0x08,0x6d,0x01,0x18,
+0x7a,0x68,0x01,0x08,0x63,0x01,0x18,0x2a,0x5e,0x01,0x08,0x59,0x01,0x18,0x0a,0x54,
+0x01,0x08,0x4f,0x01,0x19,0x0a,0x4a,0x01,0x72,0x00,0x00,0x16,0xad,0xef,0xed,0xb7,
+0xec,0x03,0x16,0x19,0xf9,0x03,0x22,0x03,0xef,0x26,0x00,0x00,0x70,0x03,0x14,0x3f,
+0x3d,0x00,0x91,0x70,0x00,0x01,0xef,0xff,0xff,0xfe,0xa9,0x9d,0xba,0x01,0x11,0x09,
+0x9f,0x03,0x00,0xab,0x00,0x10,0xfd,0xe0,0x04,0xa3,0xfc,0x00,0x00,0x00,0x06,0xff,
+0xff,0xff,0x50,0x5f,0xa6,0x03,0x8c,0xef,0xff,0xff,0xc0,0x47,0x77,0x77,0x70,0x49,
+0x01,0x13,0x7f,0xef,0x03,0x53,0x04,0x77,0x77,0x77,0xbf,0x35,0x04,0x12,0x09,0x61,
+0x00,0x17,0xf8,0x0c,0x00,0x1e,0xf9,0x0c,0x00,0x06,0x24,0x00,0x03,0x0b,0x01,0x14,
+0xf7,0x0c,0x00,0x50,0x8f,0xff,0xff,0xf5,0xbf,0xc9,0x02,0x02,0x57,0x04,0x21,0xf1,
+0x7f,0x5b,0x02,0x01,0x3a,0x02,0x22,0xd0,0x1f,0x16,0x04,0x00,0x4e,0x04,0x10,0x60,
+0xfd,0x00,0x11,0x90,0x3b,0x00,0x12,0xfe,0xcc,0x00,0x22,0xa8,0x9d,0xe5,0x00,0x14,
+0x2e,0xe4,0x00,0x52,0x80,0x00,0x00,0x02,0xdf,0x0b,0x00,0x11,0xf7,0x99,0x05,0x02,
+0x57,0x04,0x11,0x30,0x67,0x00,0x67,0x06,0xad,0xff,0xed,0xb7,0x30,0xd0,0x00,0x00,
+0x3e,0x01,0x37,0xfd,0xc9,0x50,0x1f,0x02,0x12,0x01,0x6c,0x01,0x16,0xe7,0x25,0x00,
+0x14,0x05,0x20,0x02,0x14,0x20,0x25,0x00,0x15,0x06,0x42,0x05,0x13,0x20,0x25,0x00,
+0x10,0x03,0x0e,0x00,0x30,0xb9,0x9c,0xff,0x47,0x01,0x03,0x25,0x00,0x80,0xdf,0xff,
+0xff,0xfc,0x20,0x00,0x04,0xef,0x88,0x00,0x02,0x25,0x00,0x00,0x6a,0x01,0x12,0x10,
+0x2c,0x00,0x12,0xe0,0x25,0x00,0x10,0x0b,0x70,0x01,0x03,0x7d,0x00,0x12,0x50,0x25,
+0x00,0x13,0xff,0x9a,0x00,0x42,0x4f,0xff,0xff,0xf9,0x25,0x00,0x14,0x3f,0x16,0x05,
+0x09,0x23,0x02,0x13,0x90,0x72,0x05,0x15,0xff,0x29,0x02,0x01,0x4d,0x01,0x00,0x77,
+0x00,0x15,0xf0,0x25,0x00,0x14,0x60,0x99,0x02,0x16,0x1a,0x3d,0x04,0x00,0x01,0x00,
+0xa1,0xcf,0xff,0xff,0xf1,0xaf,0xff,0xff,0xf8,0x88,0x8b,0x16,0x02,0x02,0xdd,0x05,
+0x01,0x4a,0x00,0x02,0x79,0x00,0x13,0x00,0x00,0x02,0x11,0xf0,0x94,0x00,0x00,0xed,
+0x06,0x13,0xb0,0x06,0x07,0x12,0xfc,0x25,0x00,0x00,0x79,0x00,0x04,0xa9,0x05,0x12,
+0x80,0xb9,0x00,0x00,0xc3,0x01,0x03,0xbf,0x01,0x12,0xf4,0x25,0x00,0x10,0x02,0xbe,
+0x01,0x02,0x0d,0x03,0x13,0xfc,0x03,0x01,0x00,0x19,0x00,0x12,0xc1,0xcf,0x05,0x13,
+0x50,0x28,0x01,0x10,0x1e,0x9f,0x01,0x21,0x89,0xdf,0x8d,0x02,0x03,0x72,0x01,0x05,
+0xb1,0x02,0x15,0xc0,0x97,0x01,0x13,0x3e,0x12,0x00,0x16,0xa0,0xbc,0x01,0x12,0x18,
+0x96,0x01,0x17,0x50,0xdb,0x03,0x64,0x01,0x6a,0xde,0xff,0xdc,0x83,0x55,0x02,0x32,
+0x38,0xbd,0xef,0x11,0x03,0x45,0x00,0x00,0x00,0x6d,0x17,0x07,0x02,0x76,0x01,0x05,
+0x0d,0x00,0x17,0xaf,0x0d,0x00,0x10,0x04,0xc0,0x01,0x40,0x63,0x22,0x22,0x2e,0x0d,
+0x00,0x03,0x1f,0x03,0x00,0xeb,0x00,0x11,0xfa,0x1f,0x01,0x14,0x10,0x0d,0x00,0x10,
+0x0e,0x32,0x03,0x0f,0x0d,0x00,0x02,0x00,0x6b,0x01,0x05,0x0d,0x00,0x12,0x08,0x8e,
+0x02,0x02,0x0d,0x00,0x10,0x02,0x61,0x00,0x41,0x41,0x11,0x11,0x1e,0x75,0x00,0x18,
+0x8f,0x82,0x00,0x18,0x0a,0x0d,0x00,0x28,0x00,0x5c,0x0d,0x00,0x27,0x00,0xcf,0x0d,
+0x00,0x00,0x76,0x02,0x32,0x30,0x00,0x0f,0x0d,0x00,0x15,0x2f,0x1a,0x06,0x02,0x26,
+0x00,0x14,0xe0,0x0d,0x00,0x12,0x08,0x53,0x02,0x02,0x0d,0x00,0x12,0x3f,0x20,0x00,
+0x01,0x0d,0x00,0x00,0x1a,0x02,0x14,0xf1,0x0d,0x00,0x13,0x09,0x1d,0x02,0x01,0x0d,
+0x00,0x12,0x4f,0xfd,0x03,0x01,0x0d,0x00,0x00,0x55,0x03,0x14,0xf2,0x0d,0x00,0x14,
+0x0a,0x1e,0x02,0x02,0x41,0x00,0x10,0x0e,0x04,0x01,0x12,0x0b,0xb2,0x02,0x20,0x00,
+0xef,0x4d,0x00,0x12,0xbf,0xf3,0x01,0x0f,0x19,0x00,0x13,0x33,0x22,0x22,0x20,0x05,
+0x00,0x0c,0x01,0x00,0x43,0x15,0x9d,0xef,0xfd,0xc3,0x04,0x12,0x01,0x1b,0x01,0x36,
+0x91,0x00,0x00,0xc8,0x03,0x10,0xe2,0x0c,0x00,0x25,0xef,0xff,0x0d,0x00,0x00,0xca,
+0x00,0x41,0xfa,0x53,0x37,0xef,0xa0,0x08,0x11,0x8f,0xd4,0x02,0x20,0x01,0xdf,0x65,
+0x00,0x01,0x6a,0x01,0x01,0x61,0x03,0x11,0xfc,0x9a,0x02,0x12,0x30,0xfe,0x02,0x32,
+0xf2,0x00,0x9f,0x33,0x02,0x00,0x2d,0x00,0x10,0x70,0xc7,0x08,0x50,0x11,0x11,0x11,
+0x11,0x16,0x2d,0x00,0x16,0xff,0x01,0x00,0x27,0xd0,0x0f,0x1a,0x09,0x17,0x01,0x19,
+0x00,0x27,0xf0,0x1f,0x0d,0x00,0x01,0x92,0x04,0x07,0xdf,0x07,0x15,0xfd,0xc5,0x00,
+0x17,0xcf,0x23,0x05,0x13,0x09,0x7d,0x00,0x04,0x0c,0x06,0x01,0xf4,0x04,0x31,0x45,
+0x43,0x10,0x55,0x03,0x12,0xf2,0x19,0x01,0x11,0xf7,0xab,0x01,0x12,0xd2,0x8f,0x02,
+0x11,0x10,0x62,0x02,0x32,0xfa,0x77,0xaf,0x98,0x01,0x18,0x3f,0xe6,0x03,0x18,0x3e,
+0xf2,0x03,0x12,0x19,0xf5,0x02,0x15,0x40,0xef,0x02,0x60,0xec,0x83,0x00,0x00,0x00,
+0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -1494,11 +1788,31 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 1105, .range_length = 1, .glyph_id_start = 160, .list_length = 0, .type = 2, .unicode_list = 0, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[73186] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 2703, .size = 3744, .comp_size = 2062 },
+{ .bitmap_start = 3744, .comp_offset = 4765, .size = 3982, .comp_size = 1701 },
+{ .bitmap_start = 7726, .comp_offset = 6466, .size = 3686, .comp_size = 1913 },
+{ .bitmap_start = 11412, .comp_offset = 8379, .size = 3706, .comp_size = 1199 },
+{ .bitmap_start = 15118, .comp_offset = 9578, .size = 3986, .comp_size = 1630 },
+{ .bitmap_start = 19104, .comp_offset = 11208, .size = 3953, .comp_size = 1486 },
+{ .bitmap_start = 23057, .comp_offset = 12694, .size = 4090, .comp_size = 1679 },
+{ .bitmap_start = 27147, .comp_offset = 14373, .size = 3936, .comp_size = 1432 },
+{ .bitmap_start = 31083, .comp_offset = 15805, .size = 3930, .comp_size = 1942 },
+{ .bitmap_start = 35013, .comp_offset = 17747, .size = 3765, .comp_size = 1339 },
+{ .bitmap_start = 38778, .comp_offset = 19086, .size = 3710, .comp_size = 1462 },
+{ .bitmap_start = 42488, .comp_offset = 20548, .size = 3874, .comp_size = 1250 },
+{ .bitmap_start = 46362, .comp_offset = 21798, .size = 3894, .comp_size = 804 },
+{ .bitmap_start = 50256, .comp_offset = 22602, .size = 3965, .comp_size = 1891 },
+{ .bitmap_start = 54221, .comp_offset = 24493, .size = 4080, .comp_size = 1724 },
+{ .bitmap_start = 58301, .comp_offset = 26217, .size = 3681, .comp_size = 1025 },
+{ .bitmap_start = 61982, .comp_offset = 27242, .size = 2753, .comp_size = 1159 },
+};
+
+static uint8_t etxUncompBuf[8451] __SDRAMFONTS;
 
 const etxLz4Font lv_font_ru_bold_XL = {
-.uncomp_size = 72890,
-.comp_size = 23702,
+.uncomp_size = 8155,
+.comp_size = 2703,
 .line_height = 55,
 .base_line = 11,
 .subpx = 0,
@@ -1511,12 +1825,13 @@ const etxLz4Font lv_font_ru_bold_XL = {
 .bitmap_format = 0,
 .left_class_cnt = 85,
 .right_class_cnt = 77,
-.glyph_bitmap = 1288,
-.class_pair_values = 66023,
-.left_class_mapping = 72568,
-.right_class_mapping = 72729,
+.class_pair_values = 1288,
+.left_class_mapping = 7833,
+.right_class_mapping = 7994,
+.block_num = 17,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 73186,
+.lvglFontBufSize = 8451,
 };
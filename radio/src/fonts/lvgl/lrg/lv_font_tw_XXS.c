@@ -263,206 +263,246 @@ static const uint8_t lz4FontData[] ={
 0x00,0x22,0x29,0xe7,0x08,0x00,0x22,0x76,0xe7,0xa8,0x00,0xa2,0xd4,0xe7,0x60,0x0b,
 0x0b,0x0e,0x00,0xfe,0x21,0xe8,0x60,0x00,0x22,0x75,0xe8,0xa8,0x00,0xa2,0xd7,0xe8,
 0x40,0x10,0x11,0x0a,0x00,0x00,0x2c,0xe9,0x60,0x00,0x60,0x72,0xe9,0x10,0x0d,0x0e,
-0x09,0x88,0x19,0xf0,0xff,0xff,0xff,0xff,0xff,0xff,0x47,0x72,0x1f,0xb5,0x21,0x51,
-0x2f,0x50,0x4d,0x5a,0x4d,0x5b,0x4d,0x5d,0x4d,0x76,0x4d,0x7d,0x4d,0x82,0x4d,0x89,
-0x4d,0x8b,0x4d,0x9b,0x4d,0xa8,0x4d,0xdc,0x4d,0xf4,0x4d,0xfb,0x4d,0xfe,0x4d,0x1b,
-0x4e,0x26,0x4e,0x35,0x4e,0x40,0x4e,0x46,0x4e,0x4b,0x4e,0x4d,0x4e,0x60,0x4e,0x7f,
-0x4e,0x98,0x4e,0x9d,0x4e,0x9e,0x4e,0x9f,0x4e,0xa5,0x4e,0xac,0x4e,0xcf,0x4e,0xd6,
-0x4e,0xdb,0x4e,0xeb,0x4e,0x14,0x4f,0x2d,0x4f,0x31,0x4f,0x3e,0x4f,0x3f,0x4f,0x5b,
-0x4f,0x5d,0x4f,0x62,0x4f,0x8c,0x4f,0x9f,0x4f,0xac,0x4f,0xc4,0x4f,0xe9,0x4f,0x03,
-0x50,0x15,0x50,0x1f,0x50,0x50,0x50,0x6f,0x50,0x82,0x50,0x95,0x50,0x99,0x50,0x9b,
-0x50,0xb5,0x50,0xb7,0x50,0xb8,0x50,0xbc,0x50,0xc6,0x50,0xc7,0x50,0xc8,0x50,0xcc,
-0x50,0xda,0x50,0x16,0x51,0x4a,0x51,0x4d,0x51,0x56,0x51,0x57,0x51,0x67,0x51,0x6d,
-0x51,0x75,0x51,0x79,0x51,0x7a,0x51,0x80,0x51,0x86,0x51,0x87,0x51,0x9d,0x51,0x9e,
-0x51,0xbf,0x51,0xc5,0x51,0xef,0x51,0xf0,0x51,0x25,0x52,0x55,0x52,0x58,0x52,0x66,
-0x52,0x89,0x52,0x90,0x52,0x97,0x52,0x9a,0x52,0xa4,0x52,0xb1,0x52,0xef,0x52,0x13,
-0x53,0x19,0x53,0x1a,0x53,0x1d,0x53,0x26,0x53,0x33,0x53,0x3a,0x53,0x3f,0x53,0x40,
-0x53,0x43,0x53,0x58,0x53,0x5c,0x53,0x5d,0x53,0x5e,0x53,0x61,0x53,0x76,0x53,0x7b,
-0x53,0x7f,0x53,0x9a,0x53,0xdc,0x53,0x9f,0x54,0xaf,0x54,0xfe,0x54,0x1e,0x55,0xb8,
-0x55,0x2e,0x56,0x30,0x56,0x4a,0x56,0x4e,0x56,0x5b,0x56,0x5d,0x56,0x63,0x56,0x66,
-0x56,0x78,0x56,0x80,0x56,0x90,0x56,0x97,0x56,0xdb,0x56,0x47,0x57,0x4a,0x57,0x81,
-0x57,0x9a,0x57,0xbb,0x57,0xee,0x57,0x23,0x58,0x66,0x58,0x6a,0x58,0x77,0x58,0x79,
-0x58,0x7a,0x58,0x81,0x58,0x8e,0x58,0xcd,0x58,0x1b,0x59,0xa0,0x5a,0xa7,0x5a,0xa8,
-0x5a,0xc8,0x5a,0xd3,0x5a,0xd9,0x5a,0xdc,0x5a,0xea,0x5a,0x09,0x5b,0x36,0x5b,0x3b,
-0x5b,0x3c,0x5b,0x48,0x5b,0x49,0x5b,0x54,0x5b,0x57,0x5b,0x5d,0x5b,0x5e,0x5b,0x5f,
-0x5b,0x8a,0x5b,0x8e,0x5b,0x90,0x5b,0x9f,0x5b,0xa5,0x5b,0x35,0x5d,0x36,0x5d,0x3e,
-0x5d,0x42,0x5d,0x5c,0x5d,0x86,0x5d,0x88,0x5d,0x8d,0x5d,0x90,0x5d,0x95,0x5d,0xa5,
-0x5d,0xc3,0x5d,0xce,0x5d,0xdf,0x5d,0xf6,0x5d,0x30,0x5e,0x46,0x5e,0x4a,0x5e,0x50,
-0x5e,0x5f,0x5e,0x65,0x5e,0x81,0x5e,0x87,0x5e,0x98,0x5e,0xb2,0x5e,0xc1,0x5e,0xd5,
-0x5e,0xd8,0x5e,0xdc,0x5e,0xe1,0x5e,0xee,0x5e,0xf9,0x5e,0xfa,0x5e,0xfe,0x5e,0x07,
-0x5f,0x13,0x5f,0x15,0x5f,0x3b,0x5f,0x4d,0x5f,0x70,0x5f,0x75,0x5f,0xb2,0x5f,0xbf,
-0x5f,0x15,0x60,0x5f,0x60,0x6f,0x60,0x9b,0x60,0xb2,0x60,0x19,0x61,0x48,0x61,0x60,
-0x61,0x66,0x61,0x7a,0x61,0x82,0x61,0x86,0x61,0x90,0x61,0x97,0x61,0x9b,0x61,0xa3,
-0x61,0xce,0x61,0x19,0x62,0x22,0x62,0x4e,0x62,0x51,0x62,0x57,0x62,0x59,0x62,0x7f,
-0x62,0xc7,0x62,0xd3,0x62,0xe2,0x62,0xf1,0x62,0xf5,0x62,0xf7,0x62,0xf8,0x62,0x1f,
-0x63,0x20,0x63,0x22,0x63,0x2a,0x63,0x2b,0x63,0x44,0x63,0x66,0x63,0xc8,0x63,0xf5,
-0x63,0xfd,0x63,0x17,0x64,0x1a,0x64,0x1d,0x64,0x2a,0x64,0x36,0x64,0x3c,0x64,0x44,
-0x64,0x7f,0x64,0x86,0x64,0x89,0x64,0x8e,0x64,0x95,0x64,0x98,0x64,0x9f,0x64,0xa1,
-0x64,0xa7,0x64,0xa9,0x64,0xc4,0x64,0xc8,0x64,0xd7,0x64,0xec,0x64,0xff,0x64,0x00,
-0x65,0x07,0x65,0x09,0x65,0x0c,0x65,0x1b,0x65,0x35,0x65,0x5e,0x65,0x6f,0x65,0x70,
-0x65,0x7f,0x65,0x92,0x65,0xbe,0x65,0xbf,0x65,0xfb,0x65,0x42,0x66,0x44,0x66,0x4f,
-0x66,0x50,0x66,0x59,0x66,0x6f,0x66,0x7a,0x66,0x7c,0x66,0xcf,0x66,0xec,0x66,0x14,
-0x67,0x35,0x67,0x71,0x67,0x8c,0x67,0x96,0x67,0x98,0x67,0xcf,0x67,0xed,0x67,0xc5,
-0x68,0x52,0x69,0x69,0x69,0x71,0x69,0x73,0x69,0xaf,0x69,0xbb,0x69,0xe4,0x69,0xf2,
-0x69,0x54,0x6a,0xa0,0x6a,0xb2,0x6a,0xb3,0x6a,0xb4,0x6a,0xb5,0x6a,0xcb,0x6a,0xda,
-0x6a,0x05,0x6b,0x24,0x6b,0x84,0x6b,0xb0,0x6b,0xe2,0x6b,0xf1,0x6b,0x09,0x6c,0x0f,
-0x6c,0x25,0x6c,0x32,0x6c,0x38,0x6c,0x6b,0x6c,0x82,0x6c,0x8b,0x6c,0x91,0x6c,0xd8,
-0x6c,0x47,0x6d,0x4b,0x6d,0x55,0x6d,0x6b,0x6d,0x7c,0x6d,0xe0,0x6d,0xe6,0x6d,0xfb,
-0x6d,0x21,0x6e,0x3f,0x6e,0x4e,0x6e,0x4f,0x6e,0x88,0x6e,0x10,0x6f,0x4e,0x6f,0xb3,
-0x6f,0xbb,0x6f,0x09,0x70,0x0a,0x70,0x1f,0x70,0x71,0x70,0x76,0x70,0x86,0x70,0xd4,
-0x70,0x18,0x71,0x7c,0x71,0x97,0x71,0x98,0x71,0xa9,0x71,0xc9,0x71,0x10,0x72,0xd7,
-0x72,0x3d,0x73,0x4e,0x73,0x56,0x73,0xae,0x73,0x00,0x74,0x6f,0x74,0x78,0x74,0x9c,
-0x74,0xb5,0x74,0xc0,0x74,0xc6,0x74,0xda,0x74,0xcc,0x75,0xcd,0x75,0xd4,0x75,0x1a,
-0x76,0x33,0x76,0x34,0x76,0x3e,0x76,0x44,0x76,0x48,0x76,0x5b,0x76,0x6f,0x76,0xfc,
-0x76,0x35,0x77,0xbc,0x77,0x0a,0x78,0x0c,0x78,0x8a,0x78,0xd1,0x78,0x22,0x79,0x40,
-0x79,0x4b,0x79,0x5b,0x79,0x81,0x79,0x9d,0x79,0xb9,0x79,0xca,0x79,0xd1,0x79,0xe7,
-0x79,0x3f,0x7a,0x46,0x7a,0x7c,0x7a,0x99,0x7a,0xe7,0x7a,0xf1,0x7a,0x10,0x7b,0x14,
-0x7b,0x8d,0x7b,0xb4,0x7b,0xe8,0x7b,0x0e,0x7c,0x4b,0x7c,0x55,0x7c,0x6a,0x7c,0x7f,
-0x7c,0x80,0x7c,0x92,0x7c,0x94,0x7c,0xa0,0x7c,0xa5,0x7c,0xc1,0x7c,0xd1,0x7c,0xe3,
-0x7c,0xf0,0x7c,0x1a,0x7d,0x2a,0x7d,0x38,0x7d,0x39,0x7d,0x44,0x7d,0x7e,0x7d,0x81,
-0x7d,0x8d,0x7d,0xdc,0x7d,0x66,0x7e,0xbe,0x7e,0xde,0x7e,0xf9,0x7e,0x4b,0x7f,0x4c,
-0x7f,0x55,0x7f,0x67,0x7f,0x76,0x7f,0xbf,0x7f,0xc2,0x7f,0x1c,0x80,0x4d,0x80,0x58,
-0x80,0xc3,0x80,0x3a,0x81,0x43,0x81,0x57,0x81,0x7a,0x81,0x85,0x81,0xc2,0x81,0x41,
-0x82,0xc7,0x82,0x2c,0x83,0x54,0x83,0x8d,0x83,0xb1,0x83,0x1b,0x84,0x1d,0x85,0x1f,
-0x85,0x7d,0x85,0xaf,0x85,0x52,0x86,0x0a,0x87,0x9c,0x87,0xab,0x87,0xad,0x87,0xb8,
-0x87,0xc0,0x87,0xfb,0x87,0x2c,0x88,0x2d,0x88,0x4d,0x88,0x57,0x88,0xcf,0x88,0xd1,
-0x88,0xd6,0x88,0xdf,0x88,0xe6,0x88,0x18,0x89,0x22,0x89,0x33,0x89,0x48,0x89,0x50,
-0x89,0x58,0x89,0x68,0x89,0x7a,0x89,0x7d,0x89,0x8b,0x89,0xb2,0x89,0xb6,0x89,0xc1,
-0x89,0xc3,0x89,0xdc,0x89,0xdd,0x89,0xee,0x89,0xf4,0x89,0xfa,0x89,0x0f,0x8a,0x1b,
-0x8a,0x99,0x8a,0xac,0x8a,0xb6,0x8a,0xc0,0x8a,0xc7,0x8a,0xd0,0x8a,0xda,0x8a,0xf0,
-0x8b,0x0c,0x8c,0x75,0x8c,0xc7,0x8c,0xd5,0x8c,0x03,0x8d,0x2d,0x8d,0x2f,0x8d,0x3f,
-0x8d,0x43,0x8d,0xb4,0x8d,0xfb,0x8d,0x1a,0x8e,0x48,0x8e,0x53,0x8e,0x59,0x8e,0x7a,
-0x8e,0x7f,0x8e,0x88,0x8e,0x99,0x8e,0xc4,0x8e,0xe1,0x8e,0x40,0x8f,0x50,0x8f,0x56,
-0x8f,0x6a,0x8f,0x6f,0x8f,0x73,0x8f,0x81,0x8f,0x82,0x8f,0x9a,0x8f,0x9b,0x8f,0x9e,
-0x8f,0xa3,0x8f,0xa9,0x8f,0xc2,0x8f,0xc8,0x8f,0xda,0x8f,0xdf,0x8f,0x38,0x90,0x9d,
-0x90,0x1b,0x91,0x1d,0x91,0x1f,0x91,0x2d,0x91,0x65,0x91,0x54,0x92,0x7f,0x92,0xc5,
-0x92,0xe6,0x92,0x31,0x93,0x68,0x93,0xa1,0x93,0xc7,0x94,0xd0,0x94,0xd9,0x94,0xdb,
-0x94,0xe2,0x94,0xe3,0x94,0x2c,0x95,0x90,0x95,0x94,0x95,0x9d,0x95,0xa0,0x95,0xb4,
-0x95,0xc0,0x95,0xc7,0x95,0xde,0x95,0xe4,0x95,0xec,0x95,0xf8,0x95,0x16,0x96,0x29,
-0x96,0x32,0x96,0x46,0x96,0x4b,0x96,0x50,0x96,0x57,0x96,0x98,0x96,0xac,0x96,0xae,
-0x96,0xb2,0x96,0x1c,0x97,0x23,0x97,0x43,0x97,0x4f,0x97,0x51,0x97,0x52,0x97,0x55,
-0x97,0x56,0x97,0x58,0x97,0x60,0x97,0x8b,0x97,0x9c,0x97,0x9f,0x97,0xae,0x97,0xbf,
-0x97,0xd4,0x97,0xec,0x97,0x2b,0x98,0x9b,0x98,0x25,0x99,0x2b,0x99,0x95,0x99,0xa7,
-0x99,0x24,0x9a,0x28,0x9a,0x44,0x9c,0xf5,0x9d,0x28,0x9e,0x2e,0x9e,0x9a,0x9e,0xa0,
-0x9e,0x51,0xef,0x58,0xef,0x5b,0xef,0x5c,0xef,0x5d,0xef,0x61,0xef,0x63,0xef,0x65,
-0xef,0x69,0xef,0x6c,0xef,0x71,0xef,0x76,0xef,0x77,0xef,0x78,0xef,0x8e,0xef,0x93,
-0xef,0x98,0xef,0x9b,0xef,0x9c,0xef,0x9d,0xef,0xa1,0xef,0xa2,0xef,0xa3,0xef,0xa4,
-0xef,0xb7,0xef,0xb8,0xef,0xbe,0xef,0xc0,0xef,0xc1,0xef,0xc4,0xef,0xc7,0xef,0xc8,
-0xef,0xc9,0xef,0xcb,0xef,0xe3,0xef,0xe5,0xef,0x14,0xf0,0x15,0xf0,0x17,0xf0,0x19,
-0xf0,0x30,0xf0,0x37,0xf0,0x3a,0xf0,0x43,0xf0,0x6c,0xf0,0x74,0xf0,0xab,0xf0,0x3b,
-0xf1,0x90,0xf1,0x91,0xf1,0x92,0xf1,0x93,0xf1,0x94,0xf1,0xd7,0xf1,0xe3,0xf1,0x3d,
-0xf2,0x54,0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0xe4,0xe4,0xe4,0xe3,0xe3,0xd3,0x82,
-0x30,0xd4,0x2c,0x67,0x2b,0x66,0x29,0x65,0x01,0x00,0x00,0x09,0x50,0xe0,0x00,0x0d,
-0x13,0xa0,0x0a,0xef,0xef,0xec,0x00,0x3a,0x0a,0x40,0x00,0x77,0x0d,0x00,0x3d,0xfe,
-0xdf,0xd4,0x00,0xd1,0x3a,0x00,0x00,0xe0,0x68,0x00,0x02,0xc0,0x95,0x00,0x00,0x0a,
-0x40,0x00,0x05,0xda,0x20,0x08,0xd7,0xae,0x10,0xe4,0x00,0xc6,0x0d,0x70,0x03,0x20,
-0x5f,0xa4,0x00,0x00,0x28,0xeb,0x00,0x00,0x01,0xd7,0x3f,0x00,0x09,0x80,0xd9,0x46,
-0xf4,0x01,0x9f,0xb4,0x00,0x00,0xc2,0x00,0x0a,0xcb,0x00,0x00,0x04,0xa0,0x86,0x09,
-0x10,0x4a,0x08,0x64,0x90,0x00,0x8c,0xa1,0xc0,0x00,0x00,0x00,0xa4,0x00,0x00,0x00,
-0x4a,0x3b,0xb4,0x00,0x1c,0x1c,0x21,0xd0,0x09,0x50,0xc2,0x0d,0x00,0x00,0x04,0xcc,
-0x50,0x00,0xbf,0xd4,0x00,0x00,0x7c,0x06,0xd0,0x00,0x08,0xb0,0x7b,0x00,0x00,0x1e,
-0xbc,0x10,0x00,0x03,0xef,0x40,0x22,0x01,0xf4,0x4e,0x2a,0x60,0x5d,0x00,0x7d,0xe2,
-0x01,0xf3,0x01,0xee,0x00,0x04,0xcd,0xd8,0xc9,0x00,0x59,0x58,0x58,0x00,0x00,0x02,
-0x00,0x02,0xd1,0x00,0xd3,0x00,0x6b,0x00,0x0c,0x60,0x00,0xf2,0x00,0x1f,0x00,0x02,
-0xf0,0x00,0x1f,0x20,0x00,0xe3,0x00,0x09,0x80,0x00,0x2d,0xb4,0x1f,0xf0,0x0e,0x00,
-0xa1,0x20,0x00,0x88,0x00,0x0c,0x40,0x05,0xd0,0x00,0xe3,0x00,0xb6,0x00,0x98,0x00,
-0x99,0x00,0xa8,0x00,0xc5,0x01,0xf1,0x07,0x90,0x2d,0x10,0x83,0x82,0x00,0xf2,0x12,
-0x42,0xa4,0x31,0x6d,0xfe,0xc3,0x04,0xdc,0x00,0x0e,0x2a,0x70,0x01,0x01,0x10,0x00,
-0x0a,0x20,0x00,0x00,0xe4,0x00,0x00,0x0e,0x40,0x07,0xff,0xff,0xfc,0x12,0x2e,0x52,
-0x10,0x0e,0x00,0xf0,0x30,0x00,0x3f,0x4d,0x96,0x00,0xbf,0xf5,0x04,0x00,0xe3,0x00,
-0x03,0xc0,0x00,0x96,0x00,0x0e,0x00,0x06,0xa0,0x00,0xc3,0x00,0x2d,0x00,0x08,0x70,
-0x00,0xe1,0x00,0x5b,0x00,0x0b,0x50,0x00,0x02,0xcf,0xd5,0x00,0xc8,0x04,0xf2,0x2f,
-0x00,0x0b,0x63,0xe0,0x00,0xa8,0x4e,0x00,0x09,0x93,0xe0,0x00,0xa8,0x2f,0x00,0x0b,
-0x60,0xc8,0x03,0xf1,0x1c,0x00,0x77,0x04,0xa9,0xdc,0xca,0x10,0x8a,0x00,0x02,0x00,
-0xf0,0x19,0x04,0xcf,0xd6,0x01,0xf5,0x04,0xf3,0x4a,0x00,0x0d,0x50,0x00,0x01,0xf1,
-0x00,0x00,0xc7,0x00,0x00,0xba,0x00,0x00,0xaa,0x00,0x00,0x9b,0x00,0x00,0x3f,0xff,
-0xff,0xc0,0x04,0xcf,0xd4,0x01,0xf5,0x04,0xf1,0x26,0x80,0x00,0xf0,0x25,0x05,0xe1,
-0x00,0x8f,0xf5,0x00,0x00,0x04,0xf3,0x25,0x00,0x0c,0x62,0xf3,0x03,0xf3,0x05,0xdf,
-0xd5,0x00,0x00,0x00,0xdb,0x00,0x00,0x08,0xfb,0x00,0x00,0x3e,0x8b,0x00,0x00,0xc5,
-0x7b,0x00,0x07,0xa0,0x7b,0x00,0x2e,0x10,0x7b,0x00,0x9f,0xff,0xff,0xf0,0x00,0x00,
-0x7b,0x00,0x04,0x00,0xf1,0x50,0x04,0xff,0xff,0x80,0x6c,0x11,0x10,0x07,0x90,0x00,
-0x00,0x9d,0xdd,0x70,0x05,0x72,0x4e,0x60,0x00,0x00,0x7b,0x07,0x10,0x07,0xb0,0xb9,
-0x01,0xd6,0x01,0xae,0xe8,0x00,0x00,0x3b,0xf5,0x00,0x3f,0x71,0x00,0x0b,0x70,0x00,
-0x00,0xf9,0xee,0x70,0x2f,0x90,0x3e,0x52,0xf0,0x00,0x99,0x0f,0x20,0x08,0x90,0xab,
-0x02,0xe4,0x00,0xae,0xe6,0x00,0x7f,0xff,0xff,0xb0,0x00,0x00,0xc5,0x00,0x00,0x3d,
-0x00,0x00,0x0b,0x60,0x00,0x03,0xe0,0x00,0x00,0xa8,0x00,0x00,0x2f,0x10,0x00,0x09,
-0x90,0x00,0x01,0xf2,0x00,0xf6,0x00,0xf1,0x30,0xd8,0x04,0xf2,0x0f,0x20,0x0d,0x50,
-0xc8,0x04,0xe1,0x02,0xff,0xf6,0x00,0xe6,0x03,0xe3,0x3e,0x00,0x0a,0x81,0xf5,0x02,
-0xe5,0x04,0xcf,0xe7,0x00,0x03,0xcf,0xc2,0x00,0xe6,0x07,0xe0,0x4e,0x00,0x0d,0x44,
-0xd0,0x00,0xb6,0x1f,0x60,0x5f,0x60,0x4d,0xf9,0xd5,0x00,0x00,0x1f,0x10,0x00,0x3c,
-0x90,0x01,0xfd,0x70,0x00,0x0e,0x30,0x50,0x85,0x21,0x51,0x40,0x1e,0x30,0x2e,0x10,
-0x0b,0x00,0xf0,0x11,0x01,0x90,0x2f,0x06,0xb0,0x41,0x00,0x00,0x00,0x68,0x01,0x8e,
-0xc4,0x6e,0x92,0x00,0x4d,0xc5,0x00,0x00,0x4c,0xe6,0x00,0x00,0x36,0x0e,0xee,0xee,
-0x30,0x11,0x11,0x10,0x24,0x00,0xf0,0x33,0xee,0xee,0xe3,0x01,0x11,0x11,0x00,0x2a,
-0x30,0x00,0x00,0x7d,0xc5,0x00,0x00,0x04,0xae,0x20,0x02,0x8e,0xa1,0x1b,0xf9,0x20,
-0x01,0x71,0x00,0x00,0x08,0xee,0xa0,0x5e,0x21,0xd7,0x12,0x00,0x99,0x00,0x02,0xe4,
-0x00,0x1e,0x70,0x00,0x9a,0x00,0x00,0x43,0x00,0x00,0x21,0x00,0x00,0xa7,0x00,0x00,
-0x03,0xbd,0xdc,0x70,0x00,0x00,0x6b,0x20,0x00,0x7b,0xc7,0x01,0xf1,0x1a,0x00,0x07,
-0x60,0x0a,0x30,0x2b,0xd9,0x00,0xb0,0x0e,0x00,0xd4,0x0e,0x00,0xc0,0x2b,0x04,0xb0,
-0x0e,0x00,0xc0,0x3a,0x07,0x80,0x1c,0x00,0xc0,0x2b,0x06,0x90,0x6c,0x04,0x90,0x0e,
-0x01,0xcb,0x5b,0xca,0x10,0x09,0x60,0x97,0x00,0xf0,0x21,0xd6,0x00,0x02,0x00,0x00,
-0x00,0x18,0xcc,0xda,0x00,0x00,0x00,0x07,0xf0,0x00,0x00,0x00,0xdc,0x50,0x00,0x00,
-0x4b,0x4c,0x00,0x00,0x0a,0x50,0xd2,0x00,0x01,0xd0,0x07,0x80,0x00,0x7f,0xee,0xee,
-0x00,0x0d,0x31,0x11,0xb5,0x03,0xe0,0x00,0x06,0xb0,0xa9,0xe5,0x00,0xf0,0x21,0xef,
-0xff,0xc3,0x0e,0x40,0x18,0xe0,0xe4,0x00,0x2f,0x1e,0x40,0x09,0xc0,0xef,0xff,0xf4,
-0x0e,0x40,0x05,0xf1,0xe4,0x00,0x0e,0x5e,0x40,0x05,0xf2,0xef,0xff,0xd4,0x00,0x00,
-0x7d,0xfd,0x60,0x08,0xe4,0x04,0xe5,0x0f,0x40,0x00,0x7b,0x3f,0x00,0x00,0x00,0x04,
-0x00,0xf2,0x27,0x2f,0x00,0x00,0x00,0x0f,0x40,0x00,0x7a,0x07,0xd3,0x03,0xe5,0x00,
-0x7e,0xfd,0x60,0xef,0xfe,0x91,0x0e,0x40,0x2a,0xd0,0xe4,0x00,0x0d,0x6e,0x40,0x00,
-0x8a,0xe4,0x00,0x07,0xbe,0x40,0x00,0x9a,0xe4,0x00,0x0d,0x7e,0x40,0x2a,0xd0,0xef,
-0xfe,0x91,0x00,0xef,0xff,0xfe,0xe4,0x00,0x00,0x03,0x00,0x37,0xef,0xff,0xf4,0x0c,
-0x00,0x47,0xff,0xef,0xff,0xfc,0x0f,0x00,0x15,0xf2,0x0c,0x00,0x20,0xe4,0x00,0x7a,
-0x00,0xb0,0x70,0x07,0xd4,0x03,0xd8,0x0f,0x40,0x00,0x36,0x2f,0x10,0x7a,0x00,0xf8,
-0x07,0x7f,0xfe,0x2f,0x10,0x00,0x5e,0x0e,0x50,0x00,0x5e,0x06,0xe4,0x01,0xad,0x00,
-0x6d,0xfe,0xa2,0xe4,0x00,0x00,0xf2,0x04,0x00,0x4c,0xef,0xff,0xff,0xf2,0x14,0x00,
-0x14,0xd6,0x01,0x00,0x10,0x00,0x79,0x03,0x2a,0x01,0xf2,0x07,0x00,0xf8,0x20,0x55,
-0x00,0x1f,0x26,0xe2,0x09,0xd0,0x08,0xef,0xb2,0x00,0xe4,0x00,0x2e,0x60,0xe4,0x01,
-0xd7,0x00,0xe4,0x1d,0x90,0x00,0xe5,0xca,0x00,0x00,0xee,0xfa,0x00,0x00,0xeb,0x2e,
-0x60,0x00,0xe4,0x04,0xf3,0x00,0xe4,0x00,0x7e,0x10,0xe4,0x00,0x0a,0xb0,0xa1,0x00,
-0x08,0x03,0x00,0xf0,0x22,0xef,0xff,0xfa,0xed,0x00,0x00,0x08,0xf4,0xef,0x40,0x00,
-0x0e,0xf4,0xeb,0xa0,0x00,0x5d,0xd4,0xe5,0xf1,0x00,0xc6,0xe4,0xe4,0xa7,0x02,0xf0,
-0xe4,0xe4,0x4e,0x09,0x90,0xf4,0xe4,0x0d,0x5e,0x20,0xf4,0xe4,0x06,0xfc,0x00,0xf4,
-0xe4,0x00,0xf5,0x00,0xf4,0xea,0xad,0x00,0xf0,0x27,0x40,0x00,0xf2,0xeb,0xe1,0x00,
-0xf2,0xe4,0xba,0x00,0xf2,0xe4,0x1f,0x50,0xf2,0xe4,0x06,0xe1,0xf2,0xe4,0x00,0xba,
-0xf2,0xe4,0x00,0x1f,0xf2,0xe4,0x00,0x06,0xf2,0x00,0x6d,0xfd,0x60,0x00,0x7e,0x41,
-0x5e,0x60,0x0f,0x50,0x00,0x6e,0x02,0xf0,0x00,0x01,0xf1,0x3f,0x00,0x00,0x0f,0x22,
-0x09,0x00,0x91,0x0f,0x50,0x00,0x5e,0x00,0x7e,0x41,0x4e,0x60,0x24,0x00,0xf3,0x04,
-0xef,0xff,0xd7,0x0e,0x40,0x03,0xe6,0xe4,0x00,0x08,0xae,0x40,0x02,0xd7,0xef,0xff,
-0xd8,0x0e,0x40,0x23,0x04,0x01,0x49,0x01,0x00,0x4a,0x01,0xf0,0x05,0x50,0x00,0x8e,
-0x41,0x5f,0x50,0x0f,0x40,0x00,0x7d,0x03,0xf0,0x00,0x02,0xf0,0x4e,0x00,0x00,0x1f,
-0x13,0x09,0x00,0xc0,0x0f,0x40,0x00,0x6d,0x00,0x8d,0x41,0x5e,0x50,0x00,0x7d,0xff,
-0xf1,0x04,0x10,0x1c,0x05,0x00,0xf0,0x21,0x03,0x00,0xff,0xff,0xc4,0x0f,0x40,0x06,
-0xf2,0xf4,0x00,0x0e,0x5f,0x40,0x06,0xf2,0xff,0xff,0xe3,0x0f,0x40,0x4e,0x00,0xf4,
-0x00,0xc8,0x0f,0x40,0x04,0xf1,0xf4,0x00,0x0c,0x80,0x02,0xbf,0xfa,0x10,0x0e,0x81,
-0x19,0xd0,0x2f,0x10,0x00,0xb1,0x0c,0xb3,0x62,0x00,0xf1,0x07,0xe8,0x00,0x00,0x00,
-0x2b,0xd0,0x48,0x00,0x00,0xf2,0x2f,0x60,0x07,0xf0,0x03,0xbf,0xfb,0x30,0xbf,0xff,
-0xff,0xf7,0xb6,0x03,0x0f,0x04,0x00,0x07,0x00,0x65,0x03,0x1f,0xa9,0x04,0x00,0x01,
-0xf0,0x1b,0x0f,0x20,0x00,0xb7,0x0b,0xb2,0x05,0xf2,0x01,0x9e,0xfc,0x40,0xaa,0x00,
-0x00,0x6e,0x04,0xf0,0x00,0x0c,0x80,0x0d,0x50,0x01,0xf2,0x00,0x8b,0x00,0x7c,0x00,
-0x01,0xf1,0x0c,0x60,0x00,0x0b,0x62,0xf0,0x00,0x00,0x5b,0x7a,0x6b,0x03,0x50,0x30,
-0x00,0x00,0x09,0xd0,0x4b,0x04,0x20,0x0d,0x70,0x24,0x01,0xf5,0x5e,0x1f,0xc0,0x05,
-0xe0,0x0f,0x30,0x6b,0xf1,0x08,0xa0,0x0b,0x60,0xb6,0xb5,0x0c,0x60,0x07,0xa0,0xf1,
-0x6a,0x0f,0x20,0x03,0xe4,0xc0,0x1e,0x4e,0x00,0x00,0xfa,0x70,0x0d,0xaa,0x00,0x00,
-0xcf,0x20,0x08,0xf6,0x00,0x00,0x8e,0x00,0x03,0xf2,0x00,0x3f,0x30,0x01,0xe6,0x09,
-0xc0,0x0a,0xb0,0x00,0xe6,0x4f,0x20,0x00,0x4f,0xd7,0x00,0x00,0x0c,0xf0,0x00,0x00,
-0x5f,0xd7,0x00,0x01,0xe6,0x4f,0x20,0x0a,0xc0,0x09,0xc0,0x4f,0x20,0x01,0xe7,0xab,
-0x00,0x00,0xe6,0x1f,0x40,0x07,0xd0,0x07,0xc0,0x1e,0x40,0x00,0xe4,0x8b,0x00,0x00,
-0x5d,0xe2,0x00,0x00,0x0d,0x90,0x00,0x00,0x0b,0x80,0x04,0x00,0xf0,0x08,0x6f,0xff,
-0xff,0xf1,0x00,0x00,0x0b,0xa0,0x00,0x00,0x7d,0x00,0x00,0x03,0xf3,0x00,0x00,0x0d,
-0x70,0x00,0x00,0x9c,0x00,0x17,0x05,0x40,0x00,0x1e,0x50,0x00,0xa7,0x04,0x5f,0xf4,
-0x1f,0xf4,0x1f,0x10,0x02,0x00,0x02,0xf0,0x00,0xf4,0x89,0x00,0x00,0x2e,0x00,0x00,
-0x0c,0x50,0x00,0x06,0xb0,0x00,0x00,0xf1,0x0a,0x04,0x00,0xcf,0x04,0xca,0x0d,0x40,
-0x00,0x07,0xa0,0x00,0x01,0xf1,0xef,0x70,0xb7,0x0b,0x03,0x00,0xf1,0x22,0xef,0x70,
-0x00,0x61,0x00,0x2f,0x80,0x08,0x9e,0x00,0xe1,0xa5,0x6b,0x04,0xc0,0xef,0xff,0xfc,
-0x4f,0x20,0x06,0xb0,0x02,0xcf,0xd4,0x00,0xf5,0x06,0xf0,0x02,0x00,0x1f,0x10,0x4b,
-0xdd,0xf2,0x2f,0x30,0x1f,0x23,0xf3,0x17,0xf2,0x08,0xee,0x7d,0x30,0x1f,0x10,0xbf,
-0x05,0x00,0x07,0x00,0xe0,0xf8,0xee,0x70,0x1f,0x80,0x3f,0x41,0xf1,0x00,0x99,0x1f,
-0x10,0x07,0xa1,0x07,0x00,0x60,0x80,0x3f,0x41,0xf7,0xee,0x70,0x3c,0x00,0xf0,0x02,
-0xe7,0x04,0xf1,0x4e,0x00,0x05,0x26,0xc0,0x00,0x00,0x4e,0x00,0x03,0x10,0xe6,0x03,
-0xe2,0x15,0x00,0x10,0x00,0xba,0x06,0x20,0x00,0xc6,0x07,0x00,0xd0,0x3c,0xfa,0xd6,
-0x0e,0x80,0x4f,0x64,0xe0,0x00,0xc6,0x5c,0x00,0x0c,0x07,0x00,0xd0,0x0e,0x60,0x3f,
-0x60,0x3c,0xeb,0xc6,0x02,0xbf,0xd3,0x00,0xd7,0x05,0x43,0x05,0x60,0x46,0xff,0xff,
-0xf6,0x4d,0x00,0x14,0x26,0xf6,0x05,0x91,0x02,0xbf,0xe7,0x00,0x00,0x9d,0x60,0x5d,
+0x09,0x88,0x19,0xf8,0xff,0xff,0xff,0xff,0xff,0x75,0x72,0x1f,0xb5,0x21,0x51,0x2f,
+0x50,0x4d,0x5a,0x4d,0x5b,0x4d,0x5d,0x4d,0x76,0x4d,0x7d,0x4d,0x82,0x4d,0x89,0x4d,
+0x8b,0x4d,0x9b,0x4d,0xa8,0x4d,0xdc,0x4d,0xf4,0x4d,0xfb,0x4d,0xfe,0x4d,0x1b,0x4e,
+0x26,0x4e,0x35,0x4e,0x40,0x4e,0x46,0x4e,0x4b,0x4e,0x4d,0x4e,0x60,0x4e,0x7f,0x4e,
+0x98,0x4e,0x9d,0x4e,0x9e,0x4e,0x9f,0x4e,0xa5,0x4e,0xac,0x4e,0xcf,0x4e,0xd6,0x4e,
+0xdb,0x4e,0xeb,0x4e,0x14,0x4f,0x2d,0x4f,0x31,0x4f,0x3e,0x4f,0x3f,0x4f,0x5b,0x4f,
+0x5d,0x4f,0x62,0x4f,0x8c,0x4f,0x9f,0x4f,0xac,0x4f,0xc4,0x4f,0xe9,0x4f,0x03,0x50,
+0x15,0x50,0x1f,0x50,0x50,0x50,0x6f,0x50,0x82,0x50,0x95,0x50,0x99,0x50,0x9b,0x50,
+0xb5,0x50,0xb7,0x50,0xb8,0x50,0xbc,0x50,0xc6,0x50,0xc7,0x50,0xc8,0x50,0xcc,0x50,
+0xda,0x50,0x16,0x51,0x4a,0x51,0x4d,0x51,0x56,0x51,0x57,0x51,0x67,0x51,0x6d,0x51,
+0x75,0x51,0x79,0x51,0x7a,0x51,0x80,0x51,0x86,0x51,0x87,0x51,0x9d,0x51,0x9e,0x51,
+0xbf,0x51,0xc5,0x51,0xef,0x51,0xf0,0x51,0x25,0x52,0x55,0x52,0x58,0x52,0x66,0x52,
+0x89,0x52,0x90,0x52,0x97,0x52,0x9a,0x52,0xa4,0x52,0xb1,0x52,0xef,0x52,0x13,0x53,
+0x19,0x53,0x1a,0x53,0x1d,0x53,0x26,0x53,0x33,0x53,0x3a,0x53,0x3f,0x53,0x40,0x53,
+0x43,0x53,0x58,0x53,0x5c,0x53,0x5d,0x53,0x5e,0x53,0x61,0x53,0x76,0x53,0x7b,0x53,
+0x7f,0x53,0x9a,0x53,0xdc,0x53,0x9f,0x54,0xaf,0x54,0xfe,0x54,0x1e,0x55,0xb8,0x55,
+0x2e,0x56,0x30,0x56,0x4a,0x56,0x4e,0x56,0x5b,0x56,0x5d,0x56,0x63,0x56,0x66,0x56,
+0x78,0x56,0x80,0x56,0x90,0x56,0x97,0x56,0xdb,0x56,0x47,0x57,0x4a,0x57,0x81,0x57,
+0x9a,0x57,0xbb,0x57,0xee,0x57,0x23,0x58,0x66,0x58,0x6a,0x58,0x77,0x58,0x79,0x58,
+0x7a,0x58,0x81,0x58,0x8e,0x58,0xcd,0x58,0x1b,0x59,0xa0,0x5a,0xa7,0x5a,0xa8,0x5a,
+0xc8,0x5a,0xd3,0x5a,0xd9,0x5a,0xdc,0x5a,0xea,0x5a,0x09,0x5b,0x36,0x5b,0x3b,0x5b,
+0x3c,0x5b,0x48,0x5b,0x49,0x5b,0x54,0x5b,0x57,0x5b,0x5d,0x5b,0x5e,0x5b,0x5f,0x5b,
+0x8a,0x5b,0x8e,0x5b,0x90,0x5b,0x9f,0x5b,0xa5,0x5b,0x35,0x5d,0x36,0x5d,0x3e,0x5d,
+0x42,0x5d,0x5c,0x5d,0x86,0x5d,0x88,0x5d,0x8d,0x5d,0x90,0x5d,0x95,0x5d,0xa5,0x5d,
+0xc3,0x5d,0xce,0x5d,0xdf,0x5d,0xf6,0x5d,0x30,0x5e,0x46,0x5e,0x4a,0x5e,0x50,0x5e,
+0x5f,0x5e,0x65,0x5e,0x81,0x5e,0x87,0x5e,0x98,0x5e,0xb2,0x5e,0xc1,0x5e,0xd5,0x5e,
+0xd8,0x5e,0xdc,0x5e,0xe1,0x5e,0xee,0x5e,0xf9,0x5e,0xfa,0x5e,0xfe,0x5e,0x07,0x5f,
+0x13,0x5f,0x15,0x5f,0x3b,0x5f,0x4d,0x5f,0x70,0x5f,0x75,0x5f,0xb2,0x5f,0xbf,0x5f,
+0x15,0x60,0x5f,0x60,0x6f,0x60,0x9b,0x60,0xb2,0x60,0x19,0x61,0x48,0x61,0x60,0x61,
+0x66,0x61,0x7a,0x61,0x82,0x61,0x86,0x61,0x90,0x61,0x97,0x61,0x9b,0x61,0xa3,0x61,
+0xce,0x61,0x19,0x62,0x22,0x62,0x4e,0x62,0x51,0x62,0x57,0x62,0x59,0x62,0x7f,0x62,
+0xc7,0x62,0xd3,0x62,0xe2,0x62,0xf1,0x62,0xf5,0x62,0xf7,0x62,0xf8,0x62,0x1f,0x63,
+0x20,0x63,0x22,0x63,0x2a,0x63,0x2b,0x63,0x44,0x63,0x66,0x63,0xc8,0x63,0xf5,0x63,
+0xfd,0x63,0x17,0x64,0x1a,0x64,0x1d,0x64,0x2a,0x64,0x36,0x64,0x3c,0x64,0x44,0x64,
+0x7f,0x64,0x86,0x64,0x89,0x64,0x8e,0x64,0x95,0x64,0x98,0x64,0x9f,0x64,0xa1,0x64,
+0xa7,0x64,0xa9,0x64,0xc4,0x64,0xc8,0x64,0xd7,0x64,0xec,0x64,0xff,0x64,0x00,0x65,
+0x07,0x65,0x09,0x65,0x0c,0x65,0x1b,0x65,0x35,0x65,0x5e,0x65,0x6f,0x65,0x70,0x65,
+0x7f,0x65,0x92,0x65,0xbe,0x65,0xbf,0x65,0xfb,0x65,0x42,0x66,0x44,0x66,0x4f,0x66,
+0x50,0x66,0x59,0x66,0x6f,0x66,0x7a,0x66,0x7c,0x66,0xcf,0x66,0xec,0x66,0x14,0x67,
+0x35,0x67,0x71,0x67,0x8c,0x67,0x96,0x67,0x98,0x67,0xcf,0x67,0xed,0x67,0xc5,0x68,
+0x52,0x69,0x69,0x69,0x71,0x69,0x73,0x69,0xaf,0x69,0xbb,0x69,0xe4,0x69,0xf2,0x69,
+0x54,0x6a,0xa0,0x6a,0xb2,0x6a,0xb3,0x6a,0xb4,0x6a,0xb5,0x6a,0xcb,0x6a,0xda,0x6a,
+0x05,0x6b,0x24,0x6b,0x84,0x6b,0xb0,0x6b,0xe2,0x6b,0xf1,0x6b,0x09,0x6c,0x0f,0x6c,
+0x25,0x6c,0x32,0x6c,0x38,0x6c,0x6b,0x6c,0x82,0x6c,0x8b,0x6c,0x91,0x6c,0xd8,0x6c,
+0x47,0x6d,0x4b,0x6d,0x55,0x6d,0x6b,0x6d,0x7c,0x6d,0xe0,0x6d,0xe6,0x6d,0xfb,0x6d,
+0x21,0x6e,0x3f,0x6e,0x4e,0x6e,0x4f,0x6e,0x88,0x6e,0x10,0x6f,0x4e,0x6f,0xb3,0x6f,
+0xbb,0x6f,0x09,0x70,0x0a,0x70,0x1f,0x70,0x71,0x70,0x76,0x70,0x86,0x70,0xd4,0x70,
+0x18,0x71,0x7c,0x71,0x97,0x71,0x98,0x71,0xa9,0x71,0xc9,0x71,0x10,0x72,0xd7,0x72,
+0x3d,0x73,0x4e,0x73,0x56,0x73,0xae,0x73,0x00,0x74,0x6f,0x74,0x78,0x74,0x9c,0x74,
+0xb5,0x74,0xc0,0x74,0xc6,0x74,0xda,0x74,0xcc,0x75,0xcd,0x75,0xd4,0x75,0x1a,0x76,
+0x33,0x76,0x34,0x76,0x3e,0x76,0x44,0x76,0x48,0x76,0x5b,0x76,0x6f,0x76,0xfc,0x76,
+0x35,0x77,0xbc,0x77,0x0a,0x78,0x0c,0x78,0x8a,0x78,0xd1,0x78,0x22,0x79,0x40,0x79,
+0x4b,0x79,0x5b,0x79,0x81,0x79,0x9d,0x79,0xb9,0x79,0xca,0x79,0xd1,0x79,0xe7,0x79,
+0x3f,0x7a,0x46,0x7a,0x7c,0x7a,0x99,0x7a,0xe7,0x7a,0xf1,0x7a,0x10,0x7b,0x14,0x7b,
+0x8d,0x7b,0xb4,0x7b,0xe8,0x7b,0x0e,0x7c,0x4b,0x7c,0x55,0x7c,0x6a,0x7c,0x7f,0x7c,
+0x80,0x7c,0x92,0x7c,0x94,0x7c,0xa0,0x7c,0xa5,0x7c,0xc1,0x7c,0xd1,0x7c,0xe3,0x7c,
+0xf0,0x7c,0x1a,0x7d,0x2a,0x7d,0x38,0x7d,0x39,0x7d,0x44,0x7d,0x7e,0x7d,0x81,0x7d,
+0x8d,0x7d,0xdc,0x7d,0x66,0x7e,0xbe,0x7e,0xde,0x7e,0xf9,0x7e,0x4b,0x7f,0x4c,0x7f,
+0x55,0x7f,0x67,0x7f,0x76,0x7f,0xbf,0x7f,0xc2,0x7f,0x1c,0x80,0x4d,0x80,0x58,0x80,
+0xc3,0x80,0x3a,0x81,0x43,0x81,0x57,0x81,0x7a,0x81,0x85,0x81,0xc2,0x81,0x41,0x82,
+0xc7,0x82,0x2c,0x83,0x54,0x83,0x8d,0x83,0xb1,0x83,0x1b,0x84,0x1d,0x85,0x1f,0x85,
+0x7d,0x85,0xaf,0x85,0x52,0x86,0x0a,0x87,0x9c,0x87,0xab,0x87,0xad,0x87,0xb8,0x87,
+0xc0,0x87,0xfb,0x87,0x2c,0x88,0x2d,0x88,0x4d,0x88,0x57,0x88,0xcf,0x88,0xd1,0x88,
+0xd6,0x88,0xdf,0x88,0xe6,0x88,0x18,0x89,0x22,0x89,0x33,0x89,0x48,0x89,0x50,0x89,
+0x58,0x89,0x68,0x89,0x7a,0x89,0x7d,0x89,0x8b,0x89,0xb2,0x89,0xb6,0x89,0xc1,0x89,
+0xc3,0x89,0xdc,0x89,0xdd,0x89,0xee,0x89,0xf4,0x89,0xfa,0x89,0x0f,0x8a,0x1b,0x8a,
+0x99,0x8a,0xac,0x8a,0xb6,0x8a,0xc0,0x8a,0xc7,0x8a,0xd0,0x8a,0xda,0x8a,0xf0,0x8b,
+0x0c,0x8c,0x75,0x8c,0xc7,0x8c,0xd5,0x8c,0x03,0x8d,0x2d,0x8d,0x2f,0x8d,0x3f,0x8d,
+0x43,0x8d,0xb4,0x8d,0xfb,0x8d,0x1a,0x8e,0x48,0x8e,0x53,0x8e,0x59,0x8e,0x7a,0x8e,
+0x7f,0x8e,0x88,0x8e,0x99,0x8e,0xc4,0x8e,0xe1,0x8e,0x40,0x8f,0x50,0x8f,0x56,0x8f,
+0x6a,0x8f,0x6f,0x8f,0x73,0x8f,0x81,0x8f,0x82,0x8f,0x9a,0x8f,0x9b,0x8f,0x9e,0x8f,
+0xa3,0x8f,0xa9,0x8f,0xc2,0x8f,0xc8,0x8f,0xda,0x8f,0xdf,0x8f,0x38,0x90,0x9d,0x90,
+0x1b,0x91,0x1d,0x91,0x1f,0x91,0x2d,0x91,0x65,0x91,0x54,0x92,0x7f,0x92,0xc5,0x92,
+0xe6,0x92,0x31,0x93,0x68,0x93,0xa1,0x93,0xc7,0x94,0xd0,0x94,0xd9,0x94,0xdb,0x94,
+0xe2,0x94,0xe3,0x94,0x2c,0x95,0x90,0x95,0x94,0x95,0x9d,0x95,0xa0,0x95,0xb4,0x95,
+0xc0,0x95,0xc7,0x95,0xde,0x95,0xe4,0x95,0xec,0x95,0xf8,0x95,0x16,0x96,0x29,0x96,
+0x32,0x96,0x46,0x96,0x4b,0x96,0x50,0x96,0x57,0x96,0x98,0x96,0xac,0x96,0xae,0x96,
+0xb2,0x96,0x1c,0x97,0x23,0x97,0x43,0x97,0x4f,0x97,0x51,0x97,0x52,0x97,0x55,0x97,
+0x56,0x97,0x58,0x97,0x60,0x97,0x8b,0x97,0x9c,0x97,0x9f,0x97,0xae,0x97,0xbf,0x97,
+0xd4,0x97,0xec,0x97,0x2b,0x98,0x9b,0x98,0x25,0x99,0x2b,0x99,0x95,0x99,0xa7,0x99,
+0x24,0x9a,0x28,0x9a,0x44,0x9c,0xf5,0x9d,0x28,0x9e,0x2e,0x9e,0x9a,0x9e,0xa0,0x9e,
+0x51,0xef,0x58,0xef,0x5b,0xef,0x5c,0xef,0x5d,0xef,0x61,0xef,0x63,0xef,0x65,0xef,
+0x69,0xef,0x6c,0xef,0x71,0xef,0x76,0xef,0x77,0xef,0x78,0xef,0x8e,0xef,0x93,0xef,
+0x98,0xef,0x9b,0xef,0x9c,0xef,0x9d,0xef,0xa1,0xef,0xa2,0xef,0xa3,0xef,0xa4,0xef,
+0xb7,0xef,0xb8,0xef,0xbe,0xef,0xc0,0xef,0xc1,0xef,0xc4,0xef,0xc7,0xef,0xc8,0xef,
+0xc9,0xef,0xcb,0xef,0xe3,0xef,0xe5,0xef,0x14,0xf0,0x15,0xf0,0x17,0xf0,0x19,0xf0,
+0x30,0xf0,0x37,0xf0,0x3a,0xf0,0x43,0xf0,0x6c,0xf0,0x74,0xf0,0xab,0xf0,0x3b,0xf1,
+0x90,0xf1,0x91,0xf1,0x92,0xf1,0x93,0xf1,0x94,0xf1,0xd7,0xf1,0xe3,0xf1,0x3d,0xf2,
+0x54,0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0x00,0x01,0x00,0x2f,0xfc,0x00,0x01,0x00,
+0x03,0x13,0xf5,0x08,0x00,0x17,0xf4,0x14,0x00,0xce,0xfb,0xfa,0x00,0xfe,0xfa,0x00,
+0xf8,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x4e,0x02,0x02,0x00,0x02,0x16,0x00,0x2f,
+0xef,0x00,0x01,0x00,0x15,0x1f,0xe9,0x1e,0x00,0x0a,0x03,0x88,0x00,0xb1,0xfa,0x00,
+0xff,0x00,0x00,0xf3,0xfe,0xf7,0xf9,0x00,0xf6,0x11,0x00,0x00,0x0f,0x00,0x4d,0xfe,
+0xff,0xfb,0xfd,0x92,0x00,0x30,0xfd,0x00,0xfe,0x2e,0x00,0x1e,0x00,0x01,0x00,0x1c,
+0xfd,0x0a,0x00,0x19,0xff,0x1f,0x00,0x12,0xfe,0x07,0x00,0x13,0xf6,0x0b,0x00,0x00,
+0x48,0x00,0x3f,0xfe,0xfc,0xfe,0x9c,0x00,0x0a,0x15,0x02,0x3c,0x00,0x11,0xfe,0x34,
+0x00,0x26,0xfe,0xfd,0x30,0x00,0x11,0xe8,0x04,0x01,0x15,0xe5,0x24,0x00,0x20,0xfd,
+0xfe,0x20,0x00,0x01,0x2b,0x00,0x0d,0x44,0x00,0x10,0xfd,0x08,0x00,0x1f,0xfd,0x68,
+0x00,0x07,0x1f,0xfe,0x43,0x01,0x0d,0x19,0xfa,0xdf,0x00,0x01,0xbd,0x00,0x10,0xfd,
+0x38,0x00,0x12,0xfc,0x09,0x01,0x14,0xde,0x6c,0x00,0x97,0xf9,0x00,0x00,0xe4,0xfb,
+0xee,0xf1,0x00,0xe8,0x08,0x02,0x07,0x18,0x02,0x73,0xdf,0x00,0x00,0x00,0xf2,0x00,
+0xec,0x43,0x00,0x41,0xfd,0x00,0xff,0xff,0x25,0x01,0x1f,0x01,0xe0,0x01,0x01,0x10,
+0xfc,0xd2,0x00,0x1f,0xfc,0x97,0x00,0x0b,0x10,0xf8,0xba,0x00,0x1e,0xfb,0x3b,0x00,
+0x00,0x05,0x00,0x93,0xea,0xe8,0x00,0x00,0xf8,0xfd,0xe8,0xfe,0x02,0x40,0x02,0xd3,
+0xf5,0xf6,0x00,0xf5,0xf6,0xf8,0xf4,0x00,0xf6,0xf9,0xfa,0xf8,0xfa,0x1a,0x01,0x66,
+0xe9,0xfc,0x00,0x00,0xf8,0xff,0x2b,0x01,0xa4,0xfb,0xfc,0x00,0x00,0xfb,0xfd,0x00,
+0x00,0xfd,0xff,0x7d,0x01,0x42,0x02,0x00,0xf4,0xfa,0x51,0x00,0x03,0x08,0x02,0x33,
+0x01,0xfd,0xfd,0x6c,0x01,0x17,0x00,0xaf,0x02,0x14,0xfb,0x20,0x01,0x15,0x01,0x01,
+0x02,0x02,0xb0,0x01,0x04,0x30,0x01,0xf0,0x0a,0x02,0xfb,0xeb,0xfb,0x00,0x00,0xf6,
+0xfd,0xf6,0xfe,0x02,0xf6,0x02,0x02,0x01,0x02,0x00,0x02,0xf9,0xf9,0xfe,0xfc,0xf9,
+0xfc,0xfa,0x03,0x02,0x36,0xfe,0xfd,0x02,0xc5,0x00,0x2a,0x01,0xfd,0x99,0x01,0x02,
+0x48,0x00,0x1e,0xfd,0xb2,0x01,0x0f,0xb5,0x01,0x04,0x1e,0xf9,0x31,0x01,0x0d,0xe9,
+0x01,0x1f,0xfd,0x24,0x00,0x09,0x12,0xff,0x43,0x02,0x1f,0xff,0x5a,0x03,0x10,0x1f,
+0xff,0x1d,0x00,0x10,0x1e,0x02,0xdd,0x01,0x19,0x02,0xbc,0x00,0x16,0x02,0x14,0x04,
+0x0f,0x01,0x00,0x1e,0x0b,0x04,0x01,0x1f,0xf2,0x2c,0x00,0x0b,0x23,0xfe,0xfe,0xd7,
+0x01,0x1c,0xf4,0x31,0x02,0x11,0xfe,0x93,0x00,0x10,0x05,0x2b,0x02,0x0f,0x6f,0x00,
+0x15,0x2e,0x02,0x00,0xb8,0x00,0x3d,0xfe,0xff,0x01,0x97,0x01,0x1f,0xf3,0xd8,0x00,
+0x24,0x1f,0xfe,0x24,0x00,0x26,0x0f,0x3d,0x00,0x07,0x13,0x01,0xd5,0x02,0x00,0xb6,
+0x24,0x4d,0x04,0x00,0x04,0x05,0x21,0x00,0x30,0x06,0x07,0x08,0xc2,0x0c,0xf1,0x05,
+0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,
+0x16,0x17,0x18,0x19,0x20,0x00,0xff,0x0d,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,
+0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,
+0x24,0x27,0x28,0x00,0x01,0x00,0xff,0xff,0xc5,0x02,0x33,0x03,0x20,0x03,0x02,0x2e,
+0x03,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,
+0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xf1,0x08,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,
+0x12,0x13,0x14,0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,
+0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,
+0x1f,0x22,0x00,0x00,0x23,0x73,0x00,0x02,0x1f,0x24,0x2d,0x03,0xff,0xff,0xa8,0x50,
+0x00,0x00,0x00,0x00,0x00,0xf0,0xe4,0xe4,0xe4,0xe4,0xe3,0xe3,0xd3,0x82,0x30,0xd4,
+0x2c,0x67,0x2b,0x66,0x29,0x65,0x01,0x00,0x00,0x09,0x50,0xe0,0x00,0x0d,0x13,0xa0,
+0x0a,0xef,0xef,0xec,0x00,0x3a,0x0a,0x40,0x00,0x77,0x0d,0x00,0x3d,0xfe,0xdf,0xd4,
+0x00,0xd1,0x3a,0x00,0x00,0xe0,0x68,0x00,0x02,0xc0,0x95,0x00,0x00,0x0a,0x40,0x00,
+0x05,0xda,0x20,0x08,0xd7,0xae,0x10,0xe4,0x00,0xc6,0x0d,0x70,0x03,0x20,0x5f,0xa4,
+0x00,0x00,0x28,0xeb,0x00,0x00,0x01,0xd7,0x3f,0x00,0x09,0x80,0xd9,0x46,0xf4,0x01,
+0x9f,0xb4,0x00,0x00,0xc2,0x00,0x0a,0xcb,0x00,0x00,0x04,0xa0,0x86,0x09,0x10,0x4a,
+0x08,0x64,0x90,0x00,0x8c,0xa1,0xc0,0x00,0x00,0x00,0xa4,0x00,0x00,0x00,0x4a,0x3b,
+0xb4,0x00,0x1c,0x1c,0x21,0xd0,0x09,0x50,0xc2,0x0d,0x00,0x00,0x04,0xcc,0x50,0x00,
+0xbf,0xd4,0x00,0x00,0x7c,0x06,0xd0,0x00,0x08,0xb0,0x7b,0x00,0x00,0x1e,0xbc,0x10,
+0x00,0x03,0xef,0x40,0x22,0x01,0xf4,0x4e,0x2a,0x60,0x5d,0x00,0x7d,0xe2,0x01,0xf3,
+0x01,0xee,0x00,0x04,0xcd,0xd8,0xc9,0x00,0x59,0x58,0x58,0x00,0x00,0x02,0x00,0x02,
+0xd1,0x00,0xd3,0x00,0x6b,0x00,0x0c,0x60,0x00,0xf2,0x00,0x1f,0x00,0x02,0xf0,0x00,
+0x1f,0x20,0x00,0xe3,0x00,0x09,0x80,0x00,0x2d,0x00,0x00,0x88,0x00,0x00,0xa1,0x20,
+0x00,0x88,0x00,0x0c,0x40,0x05,0xd0,0x00,0xe3,0x00,0xb6,0x00,0x98,0x00,0x99,0x00,
+0xa8,0x00,0xc5,0x01,0xf1,0x07,0x90,0x2d,0x10,0x83,0x82,0x00,0xf2,0x12,0x42,0xa4,
+0x31,0x6d,0xfe,0xc3,0x04,0xdc,0x00,0x0e,0x2a,0x70,0x01,0x01,0x10,0x00,0x0a,0x20,
+0x00,0x00,0xe4,0x00,0x00,0x0e,0x40,0x07,0xff,0xff,0xfc,0x12,0x2e,0x52,0x10,0x0e,
+0x00,0xf0,0x30,0x00,0x3f,0x4d,0x96,0x00,0xbf,0xf5,0x04,0x00,0xe3,0x00,0x03,0xc0,
+0x00,0x96,0x00,0x0e,0x00,0x06,0xa0,0x00,0xc3,0x00,0x2d,0x00,0x08,0x70,0x00,0xe1,
+0x00,0x5b,0x00,0x0b,0x50,0x00,0x02,0xcf,0xd5,0x00,0xc8,0x04,0xf2,0x2f,0x00,0x0b,
+0x63,0xe0,0x00,0xa8,0x4e,0x00,0x09,0x93,0xe0,0x00,0xa8,0x2f,0x00,0x0b,0x60,0xc8,
+0x03,0xf1,0x1c,0x00,0x77,0x04,0xa9,0xdc,0xca,0x10,0x8a,0x00,0x02,0x00,0xf0,0x19,
+0x04,0xcf,0xd6,0x01,0xf5,0x04,0xf3,0x4a,0x00,0x0d,0x50,0x00,0x01,0xf1,0x00,0x00,
+0xc7,0x00,0x00,0xba,0x00,0x00,0xaa,0x00,0x00,0x9b,0x00,0x00,0x3f,0xff,0xff,0xc0,
+0x04,0xcf,0xd4,0x01,0xf5,0x04,0xf1,0x26,0x80,0x00,0xf0,0x25,0x05,0xe1,0x00,0x8f,
+0xf5,0x00,0x00,0x04,0xf3,0x25,0x00,0x0c,0x62,0xf3,0x03,0xf3,0x05,0xdf,0xd5,0x00,
+0x00,0x00,0xdb,0x00,0x00,0x08,0xfb,0x00,0x00,0x3e,0x8b,0x00,0x00,0xc5,0x7b,0x00,
+0x07,0xa0,0x7b,0x00,0x2e,0x10,0x7b,0x00,0x9f,0xff,0xff,0xf0,0x00,0x00,0x7b,0x00,
+0x04,0x00,0xf1,0x50,0x04,0xff,0xff,0x80,0x6c,0x11,0x10,0x07,0x90,0x00,0x00,0x9d,
+0xdd,0x70,0x05,0x72,0x4e,0x60,0x00,0x00,0x7b,0x07,0x10,0x07,0xb0,0xb9,0x01,0xd6,
+0x01,0xae,0xe8,0x00,0x00,0x3b,0xf5,0x00,0x3f,0x71,0x00,0x0b,0x70,0x00,0x00,0xf9,
+0xee,0x70,0x2f,0x90,0x3e,0x52,0xf0,0x00,0x99,0x0f,0x20,0x08,0x90,0xab,0x02,0xe4,
+0x00,0xae,0xe6,0x00,0x7f,0xff,0xff,0xb0,0x00,0x00,0xc5,0x00,0x00,0x3d,0x00,0x00,
+0x0b,0x60,0x00,0x03,0xe0,0x00,0x00,0xa8,0x00,0x00,0x2f,0x10,0x00,0x09,0x90,0x00,
+0x01,0xf2,0x00,0xf6,0x00,0xf0,0x31,0xd8,0x04,0xf2,0x0f,0x20,0x0d,0x50,0xc8,0x04,
+0xe1,0x02,0xff,0xf6,0x00,0xe6,0x03,0xe3,0x3e,0x00,0x0a,0x81,0xf5,0x02,0xe5,0x04,
+0xcf,0xe7,0x00,0x03,0xcf,0xc2,0x00,0xe6,0x07,0xe0,0x4e,0x00,0x0d,0x44,0xd0,0x00,
+0xb6,0x1f,0x60,0x5f,0x60,0x4d,0xf9,0xd5,0x00,0x00,0x1f,0x10,0x00,0x3c,0x90,0x01,
+0xfd,0x70,0x00,0x0e,0x30,0x50,0x00,0x01,0x00,0x51,0x40,0x1e,0x30,0x2e,0x10,0x0b,
+0x00,0xf0,0x11,0x01,0x90,0x2f,0x06,0xb0,0x41,0x00,0x00,0x00,0x68,0x01,0x8e,0xc4,
+0x6e,0x92,0x00,0x4d,0xc5,0x00,0x00,0x4c,0xe6,0x00,0x00,0x36,0x0e,0xee,0xee,0x30,
+0x11,0x11,0x10,0x24,0x00,0xf0,0x33,0xee,0xee,0xe3,0x01,0x11,0x11,0x00,0x2a,0x30,
+0x00,0x00,0x7d,0xc5,0x00,0x00,0x04,0xae,0x20,0x02,0x8e,0xa1,0x1b,0xf9,0x20,0x01,
+0x71,0x00,0x00,0x08,0xee,0xa0,0x5e,0x21,0xd7,0x12,0x00,0x99,0x00,0x02,0xe4,0x00,
+0x1e,0x70,0x00,0x9a,0x00,0x00,0x43,0x00,0x00,0x21,0x00,0x00,0xa7,0x00,0x00,0x03,
+0xbd,0xdc,0x70,0x00,0x00,0x6b,0x20,0x00,0x7b,0xc7,0x01,0xf1,0x1a,0x00,0x07,0x60,
+0x0a,0x30,0x2b,0xd9,0x00,0xb0,0x0e,0x00,0xd4,0x0e,0x00,0xc0,0x2b,0x04,0xb0,0x0e,
+0x00,0xc0,0x3a,0x07,0x80,0x1c,0x00,0xc0,0x2b,0x06,0x90,0x6c,0x04,0x90,0x0e,0x01,
+0xcb,0x5b,0xca,0x10,0x09,0x60,0x97,0x00,0xf0,0x21,0xd6,0x00,0x02,0x00,0x00,0x00,
+0x18,0xcc,0xda,0x00,0x00,0x00,0x07,0xf0,0x00,0x00,0x00,0xdc,0x50,0x00,0x00,0x4b,
+0x4c,0x00,0x00,0x0a,0x50,0xd2,0x00,0x01,0xd0,0x07,0x80,0x00,0x7f,0xee,0xee,0x00,
+0x0d,0x31,0x11,0xb5,0x03,0xe0,0x00,0x06,0xb0,0xa9,0xe5,0x00,0xf0,0x21,0xef,0xff,
+0xc3,0x0e,0x40,0x18,0xe0,0xe4,0x00,0x2f,0x1e,0x40,0x09,0xc0,0xef,0xff,0xf4,0x0e,
+0x40,0x05,0xf1,0xe4,0x00,0x0e,0x5e,0x40,0x05,0xf2,0xef,0xff,0xd4,0x00,0x00,0x7d,
+0xfd,0x60,0x08,0xe4,0x04,0xe5,0x0f,0x40,0x00,0x7b,0x3f,0x00,0x00,0x00,0x04,0x00,
+0xf2,0x27,0x2f,0x00,0x00,0x00,0x0f,0x40,0x00,0x7a,0x07,0xd3,0x03,0xe5,0x00,0x7e,
+0xfd,0x60,0xef,0xfe,0x91,0x0e,0x40,0x2a,0xd0,0xe4,0x00,0x0d,0x6e,0x40,0x00,0x8a,
+0xe4,0x00,0x07,0xbe,0x40,0x00,0x9a,0xe4,0x00,0x0d,0x7e,0x40,0x2a,0xd0,0xef,0xfe,
+0x91,0x00,0xef,0xff,0xfe,0xe4,0x00,0x00,0x03,0x00,0x37,0xef,0xff,0xf4,0x0c,0x00,
+0x47,0xff,0xef,0xff,0xfc,0x0f,0x00,0x15,0xf2,0x0c,0x00,0x20,0xe4,0x00,0x7a,0x00,
+0xb0,0x70,0x07,0xd4,0x03,0xd8,0x0f,0x40,0x00,0x36,0x2f,0x10,0x7a,0x00,0xf8,0x07,
+0x7f,0xfe,0x2f,0x10,0x00,0x5e,0x0e,0x50,0x00,0x5e,0x06,0xe4,0x01,0xad,0x00,0x6d,
+0xfe,0xa2,0xe4,0x00,0x00,0xf2,0x04,0x00,0x4c,0xef,0xff,0xff,0xf2,0x14,0x00,0x14,
+0xd6,0x01,0x00,0x10,0x00,0x79,0x03,0x2a,0x01,0xf2,0x07,0x00,0xf8,0x20,0x55,0x00,
+0x1f,0x26,0xe2,0x09,0xd0,0x08,0xef,0xb2,0x00,0xe4,0x00,0x2e,0x60,0xe4,0x01,0xd7,
+0x00,0xe4,0x1d,0x90,0x00,0xe5,0xca,0x00,0x00,0xee,0xfa,0x00,0x00,0xeb,0x2e,0x60,
+0x00,0xe4,0x04,0xf3,0x00,0xe4,0x00,0x7e,0x10,0xe4,0x00,0x0a,0xb0,0xa1,0x00,0x08,
+0x03,0x00,0xf0,0x22,0xef,0xff,0xfa,0xed,0x00,0x00,0x08,0xf4,0xef,0x40,0x00,0x0e,
+0xf4,0xeb,0xa0,0x00,0x5d,0xd4,0xe5,0xf1,0x00,0xc6,0xe4,0xe4,0xa7,0x02,0xf0,0xe4,
+0xe4,0x4e,0x09,0x90,0xf4,0xe4,0x0d,0x5e,0x20,0xf4,0xe4,0x06,0xfc,0x00,0xf4,0xe4,
+0x00,0xf5,0x00,0xf4,0xea,0xad,0x00,0xf0,0x27,0x40,0x00,0xf2,0xeb,0xe1,0x00,0xf2,
+0xe4,0xba,0x00,0xf2,0xe4,0x1f,0x50,0xf2,0xe4,0x06,0xe1,0xf2,0xe4,0x00,0xba,0xf2,
+0xe4,0x00,0x1f,0xf2,0xe4,0x00,0x06,0xf2,0x00,0x6d,0xfd,0x60,0x00,0x7e,0x41,0x5e,
+0x60,0x0f,0x50,0x00,0x6e,0x02,0xf0,0x00,0x01,0xf1,0x3f,0x00,0x00,0x0f,0x22,0x09,
+0x00,0x91,0x0f,0x50,0x00,0x5e,0x00,0x7e,0x41,0x4e,0x60,0x24,0x00,0xf3,0x04,0xef,
+0xff,0xd7,0x0e,0x40,0x03,0xe6,0xe4,0x00,0x08,0xae,0x40,0x02,0xd7,0xef,0xff,0xd8,
+0x0e,0x40,0x23,0x04,0x01,0x49,0x01,0x00,0x4a,0x01,0xf0,0x05,0x50,0x00,0x8e,0x41,
+0x5f,0x50,0x0f,0x40,0x00,0x7d,0x03,0xf0,0x00,0x02,0xf0,0x4e,0x00,0x00,0x1f,0x13,
+0x09,0x00,0xc0,0x0f,0x40,0x00,0x6d,0x00,0x8d,0x41,0x5e,0x50,0x00,0x7d,0xff,0xf1,
+0x04,0x10,0x1c,0x05,0x00,0xf0,0x21,0x03,0x00,0xff,0xff,0xc4,0x0f,0x40,0x06,0xf2,
+0xf4,0x00,0x0e,0x5f,0x40,0x06,0xf2,0xff,0xff,0xe3,0x0f,0x40,0x4e,0x00,0xf4,0x00,
+0xc8,0x0f,0x40,0x04,0xf1,0xf4,0x00,0x0c,0x80,0x02,0xbf,0xfa,0x10,0x0e,0x81,0x19,
+0xd0,0x2f,0x10,0x00,0xb1,0x0c,0xb3,0x62,0x00,0xf1,0x07,0xe8,0x00,0x00,0x00,0x2b,
+0xd0,0x48,0x00,0x00,0xf2,0x2f,0x60,0x07,0xf0,0x03,0xbf,0xfb,0x30,0xbf,0xff,0xff,
+0xf7,0xb6,0x03,0x0f,0x04,0x00,0x07,0x00,0x65,0x03,0x1f,0xa9,0x04,0x00,0x01,0xf0,
+0x1b,0x0f,0x20,0x00,0xb7,0x0b,0xb2,0x05,0xf2,0x01,0x9e,0xfc,0x40,0xaa,0x00,0x00,
+0x6e,0x04,0xf0,0x00,0x0c,0x80,0x0d,0x50,0x01,0xf2,0x00,0x8b,0x00,0x7c,0x00,0x01,
+0xf1,0x0c,0x60,0x00,0x0b,0x62,0xf0,0x00,0x00,0x5b,0x7a,0x6b,0x03,0x50,0x30,0x00,
+0x00,0x09,0xd0,0x4b,0x04,0x20,0x0d,0x70,0x24,0x01,0xf5,0x5e,0x1f,0xc0,0x05,0xe0,
+0x0f,0x30,0x6b,0xf1,0x08,0xa0,0x0b,0x60,0xb6,0xb5,0x0c,0x60,0x07,0xa0,0xf1,0x6a,
+0x0f,0x20,0x03,0xe4,0xc0,0x1e,0x4e,0x00,0x00,0xfa,0x70,0x0d,0xaa,0x00,0x00,0xcf,
+0x20,0x08,0xf6,0x00,0x00,0x8e,0x00,0x03,0xf2,0x00,0x3f,0x30,0x01,0xe6,0x09,0xc0,
+0x0a,0xb0,0x00,0xe6,0x4f,0x20,0x00,0x4f,0xd7,0x00,0x00,0x0c,0xf0,0x00,0x00,0x5f,
+0xd7,0x00,0x01,0xe6,0x4f,0x20,0x0a,0xc0,0x09,0xc0,0x4f,0x20,0x01,0xe7,0xab,0x00,
+0x00,0xe6,0x1f,0x40,0x07,0xd0,0x07,0xc0,0x1e,0x40,0x00,0xe4,0x8b,0x00,0x00,0x5d,
+0xe2,0x00,0x00,0x0d,0x90,0x00,0x00,0x0b,0x80,0x04,0x00,0xf0,0x08,0x6f,0xff,0xff,
+0xf1,0x00,0x00,0x0b,0xa0,0x00,0x00,0x7d,0x00,0x00,0x03,0xf3,0x00,0x00,0x0d,0x70,
+0x00,0x00,0x9c,0x00,0x17,0x05,0x40,0x00,0x1e,0x50,0x00,0xa7,0x04,0x5f,0xf4,0x1f,
+0xf4,0x1f,0x10,0x02,0x00,0x02,0xf0,0x00,0xf4,0x89,0x00,0x00,0x2e,0x00,0x00,0x0c,
+0x50,0x00,0x06,0xb0,0x00,0x00,0xf1,0x0a,0x04,0x00,0xcf,0x04,0xca,0x0d,0x40,0x00,
+0x07,0xa0,0x00,0x01,0xf1,0xef,0x70,0xb7,0x0b,0x03,0x00,0xf1,0x22,0xef,0x70,0x00,
+0x61,0x00,0x2f,0x80,0x08,0x9e,0x00,0xe1,0xa5,0x6b,0x04,0xc0,0xef,0xff,0xfc,0x4f,
+0x20,0x06,0xb0,0x02,0xcf,0xd4,0x00,0xf5,0x06,0xf0,0x02,0x00,0x1f,0x10,0x4b,0xdd,
+0xf2,0x2f,0x30,0x1f,0x23,0xf3,0x17,0xf2,0x08,0xee,0x7d,0x30,0x1f,0x10,0xbf,0x05,
+0x00,0x07,0x00,0xe0,0xf8,0xee,0x70,0x1f,0x80,0x3f,0x41,0xf1,0x00,0x99,0x1f,0x10,
+0x07,0xa1,0x07,0x00,0x60,0x80,0x3f,0x41,0xf7,0xee,0x70,0x3c,0x00,0xf0,0x02,0xe7,
+0x04,0xf1,0x4e,0x00,0x05,0x26,0xc0,0x00,0x00,0x4e,0x00,0x03,0x10,0xe6,0x03,0xe2,
+0x15,0x00,0x10,0x00,0xba,0x06,0x20,0x00,0xc6,0x07,0x00,0xd0,0x3c,0xfa,0xd6,0x0e,
+0x80,0x4f,0x64,0xe0,0x00,0xc6,0x5c,0x00,0x0c,0x07,0x00,0xd0,0x0e,0x60,0x3f,0x60,
+0x3c,0xeb,0xc6,0x02,0xbf,0xd3,0x00,0xd7,0x05,0x43,0x05,0xf6,0x0f,0x46,0xff,0xff,
+0xf6,0x4d,0x00,0x00,0x00,0xd7,0x01,0x91,0x02,0xbf,0xe7,0x00,0x00,0x9d,0x60,0x5d,
 0x20,0x08,0xa0,0x09,0xff,0xe1,0x08,0xa0,0x00,0x8a,0x00,0x05,0x00,0xf0,0x02,0x03,
 0xcf,0xac,0x60,0xe7,0x04,0xf6,0x4e,0x00,0x0c,0x65,0xd0,0x00,0xc6,0x4e,0x00,0x0c,
 0x0e,0x00,0xe7,0x03,0xcf,0xad,0x60,0x00,0x00,0xd5,0x0c,0x30,0x6f,0x10,0x4d,0xfc,
@@ -493,3051 +533,3184 @@ static const uint8_t lz4FontData[] ={
 0x6f,0xff,0xfd,0x1f,0x03,0x50,0x0c,0x90,0x00,0x08,0xd0,0x8f,0x03,0x30,0x01,0xe6,
 0x00,0x4b,0x03,0xf0,0x05,0x00,0x00,0x08,0x10,0x0b,0x80,0x02,0xf0,0x00,0x3e,0x00,
 0x04,0xe0,0x00,0x9b,0x00,0x9f,0x30,0x00,0x8b,0x0a,0x00,0x40,0x3e,0x00,0x02,0xf0,
-0x6e,0x03,0x36,0x08,0x10,0xe1,0x01,0x00,0xf5,0x18,0x72,0x00,0x3e,0x20,0x0a,0x80,
+0x6e,0x03,0x36,0x08,0x10,0xe1,0x01,0x00,0xf3,0x19,0x72,0x00,0x3e,0x20,0x0a,0x80,
 0x08,0x90,0x08,0xa0,0x05,0xd1,0x00,0xcf,0x05,0xd1,0x08,0xa0,0x08,0x90,0x0a,0x80,
 0x3e,0x20,0x73,0x00,0x03,0xdc,0x20,0x0d,0x00,0xe5,0x6e,0x25,0xb0,0x1c,0x00,0x6f,
-0xe3,0x56,0x29,0x00,0x05,0x00,0x10,0x4f,0xca,0x07,0xf0,0x10,0x04,0xee,0x40,0x0c,
-0xff,0xff,0xfc,0x3e,0x40,0xe4,0x22,0x22,0x00,0x4e,0x3e,0x20,0x00,0x00,0x00,0x8d,
-0xe3,0x11,0x11,0x00,0x3e,0x4d,0xff,0xff,0xfb,0x3e,0x40,0x21,0x00,0x10,0x50,0x2c,
-0x00,0x10,0x60,0x5e,0x07,0x15,0x40,0x3c,0x00,0x10,0x5f,0x0b,0x00,0x20,0x4e,0xe4,
-0x05,0x00,0x11,0x3c,0x3f,0x00,0xf1,0x07,0x02,0x22,0x24,0xed,0x80,0x00,0x00,0x00,
-0x2e,0x4e,0x30,0x01,0x11,0x13,0xe0,0x4e,0x3b,0xff,0xff,0xfd,0x00,0x5e,0x7b,0x05,
-0x21,0x6f,0x40,0x3c,0x08,0x01,0x79,0x00,0x20,0x2b,0x20,0x24,0x00,0xf0,0x0d,0xee,
-0x20,0x00,0x00,0x2e,0xa0,0xae,0x20,0x00,0x1d,0xa0,0x00,0xad,0x10,0x1d,0xd4,0x00,
-0x04,0xdd,0x13,0xcc,0xf2,0x02,0xfc,0xc3,0x00,0x0f,0x20,0x5a,0x07,0x43,0xf2,0x02,
-0xf0,0x00,0x0b,0x00,0x80,0xf3,0x13,0xf0,0x00,0x00,0x0d,0xff,0xfd,0x84,0x03,0x20,
-0xff,0xfc,0x11,0x00,0x3d,0x23,0xf0,0x00,0x27,0x00,0xf0,0x0a,0x33,0xf2,0x02,0xf3,
-0x30,0x3f,0xfd,0x10,0x1d,0xff,0x30,0x6e,0x30,0x00,0x3e,0x60,0x00,0x5e,0x40,0x4e,
-0x50,0x00,0x00,0x4e,0x8e,0x76,0x00,0x26,0x3c,0x30,0x4f,0x2a,0x11,0xa0,0x91,0x00,
-0x00,0xd2,0x00,0xf0,0x5c,0x0e,0xfe,0x00,0x00,0x00,0x06,0xf4,0xf6,0x00,0x00,0x00,
-0xe9,0x09,0xe0,0x00,0x00,0x7f,0x10,0x1f,0x70,0x00,0x1f,0x80,0x00,0x8f,0x10,0x08,
-0xe0,0x00,0x00,0xe8,0x01,0xfc,0x88,0x88,0x8c,0xf1,0x9f,0xff,0xff,0xff,0xff,0x90,
-0x00,0x00,0x00,0x3b,0xc5,0x00,0x00,0x02,0x1e,0x86,0xf2,0x00,0x4d,0xf7,0xf0,0x0d,
-0x50,0x4f,0x60,0x7f,0xb9,0xf1,0x0e,0x60,0x09,0xff,0xe6,0x04,0xe0,0x00,0xcf,0xa1,
-0xd4,0x5c,0x00,0x0e,0x60,0x0c,0x63,0xe0,0x01,0x20,0x00,0xe4,0x0e,0x60,0x00,0x00,
-0x6e,0x00,0x4f,0x70,0x00,0x7f,0x50,0x00,0x4d,0xfe,0xfd,0x40,0x00,0x00,0x02,0x42,
-0x3b,0x01,0x01,0x13,0x09,0xf0,0x06,0xbf,0xff,0x72,0x00,0x08,0xc1,0xdf,0xc3,0xf5,
-0x04,0x98,0x02,0xe2,0x07,0xb4,0x5d,0x00,0x01,0x00,0x1b,0x4d,0x5f,0x00,0xf0,0x12,
-0xbe,0x68,0x00,0x00,0x00,0x09,0x6a,0xd0,0x00,0x00,0x00,0xb9,0x1a,0xa0,0x00,0x00,
-0x9d,0x00,0x88,0xc4,0x25,0xb9,0x60,0x00,0x69,0xe9,0xf6,0x70,0x00,0x00,0x05,0x25,
-0x00,0x93,0x2a,0xf0,0x19,0x32,0x00,0x00,0x01,0xee,0xef,0xef,0xd5,0x00,0x0d,0x90,
-0xbc,0x10,0x5f,0x70,0x0b,0xc1,0x0b,0xd0,0x03,0xf3,0x07,0xfd,0x1a,0xc0,0x00,0x99,
-0x0b,0x7a,0xfc,0x10,0x00,0x5c,0x0b,0x60,0x61,0x00,0x00,0x5c,0x08,0xe4,0x00,0xf3,
-0x04,0x89,0x01,0xf4,0x00,0x00,0x02,0xf3,0x00,0x6f,0x60,0x00,0x5e,0x70,0x00,0x04,
-0xdf,0xef,0xd5,0x00,0x8a,0x00,0xf0,0x2a,0x0c,0xee,0xee,0xee,0x10,0x01,0xfa,0x66,
-0x6b,0xb0,0x00,0x6f,0x10,0x00,0xd5,0x00,0x0b,0xb0,0x00,0x5e,0x00,0x00,0x7e,0x00,
-0x6d,0x40,0x00,0x2d,0xf3,0x7b,0x10,0x00,0x0d,0x8b,0x3d,0xd0,0x00,0x03,0xf0,0xd4,
-0x8e,0x30,0x00,0x3f,0x15,0x10,0xf3,0x00,0x00,0xd8,0x00,0x8d,0x00,0x00,0x02,0xdf,
-0xfd,0xba,0x01,0x20,0x33,0x00,0xa8,0x00,0xf0,0x24,0xaa,0x60,0x00,0x00,0xef,0xfa,
-0x10,0xcb,0xbb,0xba,0xaa,0xbc,0x00,0x00,0x00,0x0b,0xc0,0x5f,0xff,0xd0,0xbc,0x00,
-0x22,0x21,0x0c,0xc0,0x13,0x33,0x20,0xcc,0x05,0xee,0xec,0x0c,0xb0,0x00,0x00,0x00,
-0xc9,0xcb,0xde,0xed,0xb9,0x00,0x0e,0xff,0xa0,0x00,0x00,0x56,0x63,0x38,0x00,0xf0,
-0x08,0x57,0x62,0x04,0x00,0x06,0xef,0xff,0xf1,0xad,0x47,0xfb,0x30,0x24,0x0a,0x39,
-0xfa,0x00,0x00,0x00,0xa2,0x03,0xc5,0x00,0xce,0x0b,0xf0,0x0f,0xc8,0x00,0x00,0xa2,
-0x00,0x98,0x00,0x00,0x0a,0x22,0xc6,0x00,0x00,0x00,0xa7,0xcf,0xb0,0x00,0x00,0x0a,
-0xa0,0x5f,0xc5,0x23,0x50,0x20,0x00,0x4d,0xff,0xff,0x90,0x07,0xf0,0x19,0x54,0x00,
-0x89,0x99,0x99,0x99,0x8c,0x2f,0xd1,0x11,0x2b,0xb0,0x65,0x06,0xef,0xfb,0x0b,0x93,
-0xdf,0xff,0xb0,0xfd,0x00,0x69,0xdb,0x02,0x20,0x00,0x0b,0xb0,0xeb,0x00,0x00,0xbb,
-0x0f,0xd0,0x00,0x0b,0xb0,0x76,0x09,0x00,0x81,0xe0,0x00,0x0b,0xea,0xff,0xaa,0xaa,
-0xe0,0xf2,0x01,0xf0,0x2b,0x18,0xde,0xd8,0x10,0x00,0x3e,0xad,0x6a,0xbe,0x30,0x1e,
-0x70,0xc5,0x70,0x7e,0x18,0xb0,0x0c,0x57,0x00,0xb8,0xc5,0x00,0xbd,0x60,0x05,0xce,
-0x30,0x24,0x06,0x90,0x2e,0xd4,0x4b,0xe3,0xe7,0xc7,0xd9,0xcb,0x8b,0x04,0xc6,0xd9,
-0x2f,0xa9,0x00,0x00,0xbf,0x20,0x5f,0x71,0x01,0x7e,0x50,0x00,0x3b,0xff,0xfb,0x37,
-0x02,0x10,0x20,0x8f,0x0a,0x70,0x80,0x00,0x00,0x03,0xe6,0x4b,0xb0,0x93,0x06,0xf2,
-0x22,0x0f,0x12,0x62,0x0a,0x60,0x00,0xe7,0xff,0xf4,0x6d,0x10,0x6d,0xbf,0xff,0xb0,
-0x9f,0xef,0x7a,0xff,0xfa,0x07,0xe9,0xcf,0xff,0xfe,0x23,0xe1,0x4f,0xff,0xff,0xe1,
-0x96,0x1e,0xff,0xff,0xff,0x8c,0x38,0xff,0xff,0xff,0xfb,0xcf,0xfd,0xdd,0xdd,0xdd,
-0x90,0x11,0x77,0x02,0x20,0x61,0x00,0x6b,0x03,0x11,0xd2,0x06,0x00,0xf1,0x05,0xe3,
-0x00,0x02,0x43,0x33,0x37,0xe3,0x00,0xaf,0xff,0xff,0xff,0xf4,0x03,0x66,0x66,0x66,
-0x66,0x60,0x09,0x67,0x02,0x90,0x08,0xf9,0x88,0x88,0x95,0x00,0x07,0xd1,0x00,0x99,
-0x02,0x01,0x06,0x00,0x25,0x05,0x90,0xb9,0x02,0x20,0x68,0x50,0xc1,0x01,0xf0,0x24,
-0x48,0xc9,0x10,0x00,0x00,0x8c,0xa4,0x4c,0x30,0x00,0x03,0x22,0x8b,0x20,0x00,0x00,
-0x5a,0xc5,0x10,0x00,0x06,0x86,0x97,0x30,0x00,0x1c,0xb0,0x10,0xab,0x00,0x0a,0xf2,
-0x7f,0x82,0xf9,0x00,0xaf,0x29,0xfa,0x1f,0x90,0x01,0xda,0x04,0x09,0xd1,0x00,0x01,
-0x8b,0x9a,0x81,0x76,0x02,0xfa,0x0a,0xfd,0x10,0x0d,0x63,0x36,0x9d,0x10,0xd3,0x00,
-0xb0,0xbd,0x0d,0x30,0x0a,0xc9,0xe3,0xd3,0x00,0x00,0x0d,0x3d,0x30,0x00,0x00,0xd3,
-0x09,0x00,0x91,0x40,0x00,0x00,0xd3,0xcf,0xff,0xff,0xff,0x20,0x72,0x00,0x20,0x03,
-0x53,0x06,0x00,0xf0,0x2b,0xa9,0x6a,0x90,0x00,0x00,0x06,0x70,0x00,0x8d,0xc7,0x00,
-0x0a,0x10,0x00,0x00,0x09,0x40,0x1d,0x10,0x00,0x47,0x33,0x90,0xa3,0x38,0xcf,0xda,
-0x33,0x80,0xc0,0x68,0x58,0x00,0x04,0xb0,0xb0,0x00,0x4f,0x90,0x00,0xa2,0xa1,0x00,
-0xdf,0xf3,0x00,0x83,0x2c,0x20,0x00,0x00,0x01,0xc0,0x02,0xbb,0xbb,0xbb,0xbb,0x3f,
-0x01,0x11,0x4d,0xf2,0x00,0xf0,0x1b,0xf0,0x87,0x00,0x00,0x00,0x7f,0x2f,0x40,0x19,
-0xd8,0x6e,0xae,0x30,0x0a,0xb3,0x7b,0x60,0xd4,0x01,0xf1,0x00,0x9b,0x4f,0x20,0x5b,
-0x00,0x01,0xbf,0x60,0x08,0x70,0x00,0x04,0xf0,0x00,0xa5,0x00,0x00,0x4f,0x00,0x0c,
-0x30,0x0b,0x00,0x10,0xe2,0x0b,0x00,0x02,0x01,0x00,0xe0,0x08,0xd7,0x01,0xc0,0xd0,
-0x09,0xd7,0x00,0x08,0xa1,0x1f,0xf7,0x0c,0xe3,0x01,0x01,0xf1,0x00,0xc5,0x00,0x00,
-0x05,0xae,0x82,0x00,0x00,0x09,0xf3,0x02,0x8d,0xb4,0x02,0xe7,0x68,0x0c,0xf0,0x01,
-0x02,0xff,0xff,0xf2,0x1a,0x10,0x00,0x9e,0x20,0x00,0x9e,0x10,0x00,0x71,0x2c,0xcc,
-0x01,0x00,0x20,0x80,0x33,0x01,0x00,0x51,0x32,0x00,0x00,0x05,0xa0,0x4a,0x00,0x11,
-0x5a,0x06,0x00,0x0a,0x0d,0x00,0x3e,0xfe,0xee,0xe5,0x1a,0x00,0x0b,0x0d,0x00,0x80,
-0x0c,0xcc,0xcd,0xec,0xcc,0xcc,0x60,0x22,0x01,0x00,0x60,0x21,0x3e,0xee,0xee,0xee,
-0xee,0x6b,0x09,0x21,0x4c,0x00,0xd8,0x00,0x21,0xc0,0x00,0x47,0x05,0x11,0x81,0x0d,
-0x00,0x20,0xd9,0xe7,0x07,0x00,0x41,0x4c,0x02,0xcd,0x20,0x1a,0x00,0x2b,0x72,0x00,
-0x27,0x00,0x07,0x0d,0x00,0x10,0x0f,0xef,0x01,0x00,0xd6,0x02,0x21,0x0a,0x90,0x6f,
-0x00,0x11,0xf0,0x1a,0x00,0x20,0xef,0x56,0x06,0x00,0xf1,0x06,0xe4,0xf1,0xbb,0x10,
-0x00,0x07,0xe3,0x0f,0x00,0x7e,0x30,0x1d,0xb1,0x00,0xf0,0x00,0x4f,0x20,0x50,0x00,
-0x0f,0x88,0x02,0x11,0x00,0x27,0x00,0x00,0x0d,0x00,0x14,0x00,0x0d,0x00,0xf0,0x0a,
-0x07,0x00,0x00,0x06,0x30,0x00,0x00,0x79,0x00,0x02,0xe1,0x00,0x00,0x01,0xd1,0x00,
-0x97,0x00,0x00,0xad,0xde,0xfd,0xee,0xdd,0xd1,0x2a,0x2d,0xf0,0x12,0x70,0x00,0x00,
-0x0c,0x03,0xb0,0x77,0x0a,0x60,0x00,0x95,0x3b,0x07,0x70,0xe1,0x00,0x03,0xb3,0xb0,
-0x77,0x4b,0x00,0x00,0x0e,0x3b,0x07,0x7b,0x40,0x00,0x00,0x03,0xb0,0x77,0xde,0x00,
-0x51,0xdf,0xcd,0xec,0xcc,0x50,0x2c,0x01,0x41,0x31,0x00,0x00,0x1e,0x43,0x0d,0xf2,
-0x0a,0xe0,0x00,0x00,0xac,0xcc,0xcf,0xcc,0xcc,0x8d,0x32,0x23,0xe2,0x22,0x6b,0xd1,
-0x00,0x1e,0x00,0x04,0xbd,0x10,0x01,0xe0,0x00,0x4b,0x0b,0x00,0x10,0xff,0xdd,0x02,
-0x61,0x50,0x00,0x1e,0x00,0x01,0x30,0x2c,0x00,0x07,0x37,0x00,0x02,0x0b,0x00,0xf2,
-0x28,0x22,0x23,0xe2,0x22,0x20,0x4e,0xbb,0xbf,0xbb,0xbe,0x04,0xa0,0x01,0xe0,0x01,
-0xe0,0x4e,0xaa,0xbf,0xaa,0xbe,0x00,0x11,0x13,0xe1,0x11,0x10,0xbe,0xee,0xef,0xee,
-0xee,0x6c,0x20,0x01,0xe0,0x00,0x87,0xc2,0x00,0x1e,0x00,0x08,0x7c,0xed,0xde,0xfd,
-0xdd,0xf7,0x30,0x00,0x1e,0x00,0x02,0x20,0x42,0x00,0xb0,0x3f,0xdd,0xdd,0xde,0xb0,
-0x00,0x03,0xb0,0x30,0x00,0x4b,0xc4,0x00,0x20,0xc1,0x04,0x0d,0x00,0x20,0x06,0xd1,
-0x0d,0x00,0xf0,0x06,0x00,0x03,0x04,0xb0,0x01,0xef,0xfe,0xee,0xee,0xff,0xe6,0x00,
-0x68,0x00,0x00,0x04,0xb0,0x00,0x0a,0x50,0x00,0x27,0x00,0x11,0xe1,0x0d,0x00,0x20,
-0x99,0x00,0x0d,0x00,0x65,0x1c,0x00,0x00,0x0a,0xee,0x60,0x36,0x03,0x31,0x06,0x10,
-0x00,0xfd,0x0b,0x00,0x3f,0x01,0xca,0x11,0x11,0x6c,0x11,0x10,0x00,0x8d,0xdd,0xef,
-0xdd,0xdd,0x80,0x4e,0x01,0xa1,0xbb,0xbb,0xfb,0xbb,0xb0,0x00,0x03,0x33,0x3f,0x33,
-0xe0,0x04,0x0c,0x68,0x01,0x11,0x03,0xaf,0x01,0x42,0xf4,0x00,0x00,0x03,0x06,0x0f,
-0x12,0x1e,0x4e,0x00,0x11,0x87,0x4e,0x00,0x31,0xdd,0xdd,0xef,0x64,0x00,0x11,0x1d,
-0x1c,0x00,0x26,0x0c,0x80,0x06,0x00,0x20,0x2d,0x70,0x06,0x00,0x11,0x5e,0x65,0x07,
-0x20,0xbc,0x20,0xee,0x01,0xf3,0x09,0xba,0xb5,0x22,0x12,0x34,0x21,0xa0,0x03,0x9c,
-0xdd,0xcc,0xb3,0x00,0x00,0x12,0x35,0x79,0x80,0x00,0x2d,0xcb,0xbf,0x87,0x52,0x68,
-0x00,0xf2,0x25,0x01,0xdd,0xdd,0xdf,0xdd,0xdd,0xd1,0x00,0x03,0x70,0xf0,0x83,0x21,
-0x00,0x9c,0xd9,0x0f,0x0a,0xcb,0x30,0x00,0x06,0x91,0xf0,0xa4,0x04,0x00,0xcb,0xa9,
-0xaf,0xa8,0xca,0xd0,0x00,0x00,0xb5,0xf5,0x92,0x20,0x00,0x03,0xc6,0x0f,0x06,0xc2,
-0x00,0x2b,0xc3,0x00,0xf0,0x04,0xea,0x1e,0x02,0x04,0xf1,0x00,0x25,0x1f,0xff,0xbe,
-0x03,0x0f,0x01,0x00,0x0f,0x11,0x02,0xd5,0x02,0x11,0x03,0xd4,0x02,0x51,0xe3,0x00,
-0x00,0x04,0x80,0x16,0x00,0x22,0x0e,0x10,0x47,0x00,0x00,0xa0,0x02,0xf0,0x0f,0x17,
-0x00,0x06,0x20,0x00,0x00,0x2d,0x50,0x00,0x4e,0x50,0x00,0x5e,0x53,0x00,0x04,0x3d,
-0x60,0x07,0x20,0xd1,0x01,0xe1,0x18,0x00,0x00,0x06,0xa0,0xa8,0x00,0xd2,0x00,0x11,
-0xcc,0x49,0x00,0x20,0xbe,0xc3,0x24,0x12,0xb6,0xe5,0x04,0xda,0x51,0x01,0xeb,0x50,
-0x00,0x00,0x59,0xe2,0x64,0x00,0xa2,0xa0,0x00,0x00,0x01,0xaa,0xaa,0xaf,0xba,0xaa,
-0xa1,0x6f,0x00,0xf0,0x06,0x00,0x07,0xdb,0xbb,0xbb,0xd9,0x00,0x00,0x79,0x22,0x22,
-0x28,0x90,0x00,0x03,0x77,0x77,0x77,0x74,0x00,0x00,0xb1,0x03,0x10,0x90,0x72,0x04,
-0xf4,0x01,0x9d,0x80,0x00,0x01,0x11,0x12,0xf6,0x21,0x11,0x02,0xbb,0xbb,0xbf,0xbb,
-0xbb,0xb3,0x8d,0x01,0x31,0x1c,0xcb,0x00,0x64,0x02,0x00,0x4e,0x00,0x80,0x88,0x88,
-0x8f,0xa8,0x88,0x81,0x04,0x44,0x01,0x00,0xf0,0x06,0x00,0x05,0xda,0xaa,0xaa,0xd6,
-0x00,0x00,0x5b,0x33,0x33,0x3a,0x60,0x00,0x02,0x66,0x66,0x66,0x62,0x00,0x0b,0x4e,
-0x00,0x21,0xcb,0x00,0x8f,0x02,0x70,0xe0,0x05,0x01,0xfd,0xdd,0xf0,0x05,0x19,0x02,
-0x30,0x0f,0x00,0x10,0xca,0x00,0xa5,0xf0,0x0c,0x10,0xbd,0x50,0x00,0x0b,0xdd,0xb0,
-0x01,0xa4,0x00,0x12,0x85,0xf4,0x03,0x11,0xdd,0xc7,0x01,0x20,0x6c,0x14,0xa5,0x05,
-0xf1,0x08,0x1a,0xc0,0x00,0x3e,0x70,0x00,0x19,0xe7,0x00,0x00,0x01,0xae,0x80,0x07,
-0x11,0xa0,0x00,0x1b,0x02,0x40,0x00,0x02,0xd0,0xdf,0x02,0x21,0x03,0xc0,0x07,0x00,
-0x21,0x06,0xa0,0x07,0x00,0x20,0x0c,0x50,0x07,0x00,0x21,0x01,0xab,0xfb,0x02,0x22,
-0x07,0x90,0x02,0x03,0x20,0x0a,0x20,0x7f,0x00,0xf0,0x24,0x03,0xd0,0x70,0x0e,0x00,
-0x00,0x00,0xa6,0x0d,0x10,0xe0,0x27,0x00,0x4f,0x10,0xd1,0x0f,0xcd,0xe0,0x1e,0xf0,
-0x0e,0xae,0xf3,0x0e,0x08,0x8d,0x4c,0xf7,0x0e,0x00,0xd0,0x10,0xd2,0x3d,0x10,0xe0,
-0x1d,0x00,0x0d,0x00,0xd1,0x0e,0x14,0xb0,0x00,0xd0,0x0d,0x10,0xe5,0xa4,0x0d,0x00,
-0xf3,0x00,0x00,0x00,0x75,0x00,0xd0,0x0d,0x40,0x00,0x0b,0x40,0x0d,0x00,0x5c,0xdd,
-0xdd,0x02,0x06,0xf1,0x08,0x07,0x00,0x20,0x00,0x3c,0x00,0x0e,0x10,0xd4,0x00,0x4b,
-0x00,0x0e,0x10,0x3e,0x00,0x69,0x00,0x0e,0x10,0x09,0x60,0x87,0xaf,0x01,0x11,0xb4,
-0x06,0x00,0x40,0xf0,0x00,0x0e,0x10,0x08,0x03,0xf1,0x09,0x0e,0x27,0xe3,0x0d,0xb0,
-0x00,0x1f,0xf9,0x10,0x9b,0xb9,0x00,0x79,0x10,0x09,0xd0,0x0b,0x80,0x00,0x03,0xe9,
-0x10,0x01,0xe3,0xb9,0x09,0x13,0x10,0xf4,0x00,0xf1,0x09,0x3b,0x01,0x78,0x00,0x00,
+0xe3,0x00,0x01,0x00,0x10,0x30,0x05,0x00,0x10,0x4f,0xca,0x07,0xf0,0x10,0x04,0xee,
+0x40,0x0c,0xff,0xff,0xfc,0x3e,0x40,0xe4,0x22,0x22,0x00,0x4e,0x3e,0x20,0x00,0x00,
+0x00,0x8d,0xe3,0x11,0x11,0x00,0x3e,0x4d,0xff,0xff,0xfb,0x3e,0x40,0x21,0x00,0x10,
+0x50,0x2c,0x00,0x10,0x60,0x5e,0x07,0x15,0x40,0x3c,0x00,0x10,0x5f,0x0b,0x00,0x20,
+0x4e,0xe4,0x05,0x00,0x11,0x3c,0x3f,0x00,0xf1,0x07,0x02,0x22,0x24,0xed,0x80,0x00,
+0x00,0x00,0x2e,0x4e,0x30,0x01,0x11,0x13,0xe0,0x4e,0x3b,0xff,0xff,0xfd,0x00,0x5e,
+0x7b,0x05,0x21,0x6f,0x40,0x3c,0x08,0x01,0x79,0x00,0x20,0x2b,0x20,0x24,0x00,0xf0,
+0x0d,0xee,0x20,0x00,0x00,0x2e,0xa0,0xae,0x20,0x00,0x1d,0xa0,0x00,0xad,0x10,0x1d,
+0xd4,0x00,0x04,0xdd,0x13,0xcc,0xf2,0x02,0xfc,0xc3,0x00,0x0f,0x20,0x5a,0x07,0x43,
+0xf2,0x02,0xf0,0x00,0x0b,0x00,0x80,0xf3,0x13,0xf0,0x00,0x00,0x0d,0xff,0xfd,0x84,
+0x03,0x20,0xff,0xfc,0x11,0x00,0x3d,0x23,0xf0,0x00,0x27,0x00,0xf0,0x0a,0x33,0xf2,
+0x02,0xf3,0x30,0x3f,0xfd,0x10,0x1d,0xff,0x30,0x6e,0x30,0x00,0x3e,0x60,0x00,0x5e,
+0x40,0x4e,0x50,0x00,0x00,0x4e,0x8e,0x76,0x00,0x35,0x3c,0x30,0x00,0x01,0x00,0x11,
+0xa0,0x91,0x00,0x00,0xd2,0x00,0xf0,0x5c,0x0e,0xfe,0x00,0x00,0x00,0x06,0xf4,0xf6,
+0x00,0x00,0x00,0xe9,0x09,0xe0,0x00,0x00,0x7f,0x10,0x1f,0x70,0x00,0x1f,0x80,0x00,
+0x8f,0x10,0x08,0xe0,0x00,0x00,0xe8,0x01,0xfc,0x88,0x88,0x8c,0xf1,0x9f,0xff,0xff,
+0xff,0xff,0x90,0x00,0x00,0x00,0x3b,0xc5,0x00,0x00,0x02,0x1e,0x86,0xf2,0x00,0x4d,
+0xf7,0xf0,0x0d,0x50,0x4f,0x60,0x7f,0xb9,0xf1,0x0e,0x60,0x09,0xff,0xe6,0x04,0xe0,
+0x00,0xcf,0xa1,0xd4,0x5c,0x00,0x0e,0x60,0x0c,0x63,0xe0,0x01,0x20,0x00,0xe4,0x0e,
+0x60,0x00,0x00,0x6e,0x00,0x4f,0x70,0x00,0x7f,0x50,0x00,0x4d,0xfe,0xfd,0x40,0x00,
+0x00,0x02,0x42,0x3b,0x01,0x01,0x13,0x09,0xf0,0x06,0xbf,0xff,0x72,0x00,0x08,0xc1,
+0xdf,0xc3,0xf5,0x04,0x98,0x02,0xe2,0x07,0xb4,0x5d,0x00,0x01,0x00,0x1b,0x4d,0x5f,
+0x00,0xf0,0x3e,0xbe,0x68,0x00,0x00,0x00,0x09,0x6a,0xd0,0x00,0x00,0x00,0xb9,0x1a,
+0xa0,0x00,0x00,0x9d,0x00,0x88,0xc4,0x25,0xb9,0x60,0x00,0x69,0xe9,0xf6,0x70,0x00,
+0x00,0x05,0x25,0x00,0x00,0x00,0x28,0x01,0x32,0x00,0x00,0x01,0xee,0xef,0xef,0xd5,
+0x00,0x0d,0x90,0xbc,0x10,0x5f,0x70,0x0b,0xc1,0x0b,0xd0,0x03,0xf3,0x07,0xfd,0x1a,
+0xc0,0x00,0x99,0x0b,0x7a,0xfc,0x10,0x00,0x5c,0x0b,0x60,0x61,0x00,0x00,0x5c,0x08,
+0xe4,0x00,0xf3,0x04,0x89,0x01,0xf4,0x00,0x00,0x02,0xf3,0x00,0x6f,0x60,0x00,0x5e,
+0x70,0x00,0x04,0xdf,0xef,0xd5,0x00,0x8a,0x00,0xf0,0x2a,0x0c,0xee,0xee,0xee,0x10,
+0x01,0xfa,0x66,0x6b,0xb0,0x00,0x6f,0x10,0x00,0xd5,0x00,0x0b,0xb0,0x00,0x5e,0x00,
+0x00,0x7e,0x00,0x6d,0x40,0x00,0x2d,0xf3,0x7b,0x10,0x00,0x0d,0x8b,0x3d,0xd0,0x00,
+0x03,0xf0,0xd4,0x8e,0x30,0x00,0x3f,0x15,0x10,0xf3,0x00,0x00,0xd8,0x00,0x8d,0x00,
+0x00,0x02,0xdf,0xfd,0xba,0x01,0x20,0x33,0x00,0xa8,0x00,0xf0,0x24,0xaa,0x60,0x00,
+0x00,0xef,0xfa,0x10,0xcb,0xbb,0xba,0xaa,0xbc,0x00,0x00,0x00,0x0b,0xc0,0x5f,0xff,
+0xd0,0xbc,0x00,0x22,0x21,0x0c,0xc0,0x13,0x33,0x20,0xcc,0x05,0xee,0xec,0x0c,0xb0,
+0x00,0x00,0x00,0xc9,0xcb,0xde,0xed,0xb9,0x00,0x0e,0xff,0xa0,0x00,0x00,0x56,0x63,
+0x38,0x00,0xf0,0x08,0x57,0x62,0x04,0x00,0x06,0xef,0xff,0xf1,0xad,0x47,0xfb,0x30,
+0x24,0x0a,0x39,0xfa,0x00,0x00,0x00,0xa2,0x03,0xc5,0x00,0xce,0x0b,0xf0,0x0f,0xc8,
+0x00,0x00,0xa2,0x00,0x98,0x00,0x00,0x0a,0x22,0xc6,0x00,0x00,0x00,0xa7,0xcf,0xb0,
+0x00,0x00,0x0a,0xa0,0x5f,0xc5,0x23,0x50,0x20,0x00,0x4d,0xff,0xff,0x90,0x07,0xf0,
+0x19,0x54,0x00,0x89,0x99,0x99,0x99,0x8c,0x2f,0xd1,0x11,0x2b,0xb0,0x65,0x06,0xef,
+0xfb,0x0b,0x93,0xdf,0xff,0xb0,0xfd,0x00,0x69,0xdb,0x02,0x20,0x00,0x0b,0xb0,0xeb,
+0x00,0x00,0xbb,0x0f,0xd0,0x00,0x0b,0xb0,0x76,0x09,0x00,0x81,0xe0,0x00,0x0b,0xea,
+0xff,0xaa,0xaa,0xe0,0xf2,0x01,0xf0,0x2b,0x18,0xde,0xd8,0x10,0x00,0x3e,0xad,0x6a,
+0xbe,0x30,0x1e,0x70,0xc5,0x70,0x7e,0x18,0xb0,0x0c,0x57,0x00,0xb8,0xc5,0x00,0xbd,
+0x60,0x05,0xce,0x30,0x24,0x06,0x90,0x2e,0xd4,0x4b,0xe3,0xe7,0xc7,0xd9,0xcb,0x8b,
+0x04,0xc6,0xd9,0x2f,0xa9,0x00,0x00,0xbf,0x20,0x5f,0x71,0x01,0x7e,0x50,0x00,0x3b,
+0xff,0xfb,0x37,0x02,0x10,0x20,0x8f,0x0a,0x70,0x80,0x00,0x00,0x03,0xe6,0x4b,0xb0,
+0x93,0x06,0xf2,0x22,0x0f,0x12,0x62,0x0a,0x60,0x00,0xe7,0xff,0xf4,0x6d,0x10,0x6d,
+0xbf,0xff,0xb0,0x9f,0xef,0x7a,0xff,0xfa,0x07,0xe9,0xcf,0xff,0xfe,0x23,0xe1,0x4f,
+0xff,0xff,0xe1,0x96,0x1e,0xff,0xff,0xff,0x8c,0x38,0xff,0xff,0xff,0xfb,0xcf,0xfd,
+0xdd,0xdd,0xdd,0x90,0x11,0x77,0x02,0x20,0x61,0x00,0x6b,0x03,0x11,0xd2,0x06,0x00,
+0xf1,0x05,0xe3,0x00,0x02,0x43,0x33,0x37,0xe3,0x00,0xaf,0xff,0xff,0xff,0xf4,0x03,
+0x66,0x66,0x66,0x66,0x60,0x09,0x67,0x02,0x90,0x08,0xf9,0x88,0x88,0x95,0x00,0x07,
+0xd1,0x00,0x99,0x02,0x01,0x06,0x00,0x25,0x05,0x90,0xb9,0x02,0x20,0x68,0x50,0xc1,
+0x01,0xf0,0x24,0x48,0xc9,0x10,0x00,0x00,0x8c,0xa4,0x4c,0x30,0x00,0x03,0x22,0x8b,
+0x20,0x00,0x00,0x5a,0xc5,0x10,0x00,0x06,0x86,0x97,0x30,0x00,0x1c,0xb0,0x10,0xab,
+0x00,0x0a,0xf2,0x7f,0x82,0xf9,0x00,0xaf,0x29,0xfa,0x1f,0x90,0x01,0xda,0x04,0x09,
+0xd1,0x00,0x01,0x8b,0x9a,0x81,0x76,0x02,0xfa,0x0a,0xfd,0x10,0x0d,0x63,0x36,0x9d,
+0x10,0xd3,0x00,0xb0,0xbd,0x0d,0x30,0x0a,0xc9,0xe3,0xd3,0x00,0x00,0x0d,0x3d,0x30,
+0x00,0x00,0xd3,0x09,0x00,0x91,0x40,0x00,0x00,0xd3,0xcf,0xff,0xff,0xff,0x20,0x72,
+0x00,0x20,0x03,0x53,0x06,0x00,0xf0,0x2b,0xa9,0x6a,0x90,0x00,0x00,0x06,0x70,0x00,
+0x8d,0xc7,0x00,0x0a,0x10,0x00,0x00,0x09,0x40,0x1d,0x10,0x00,0x47,0x33,0x90,0xa3,
+0x38,0xcf,0xda,0x33,0x80,0xc0,0x68,0x58,0x00,0x04,0xb0,0xb0,0x00,0x4f,0x90,0x00,
+0xa2,0xa1,0x00,0xdf,0xf3,0x00,0x83,0x2c,0x20,0x00,0x00,0x01,0xc0,0x02,0xbb,0xbb,
+0xbb,0xbb,0x3f,0x01,0x11,0x4d,0xf2,0x00,0xf0,0x1b,0xf0,0x87,0x00,0x00,0x00,0x7f,
+0x2f,0x40,0x19,0xd8,0x6e,0xae,0x30,0x0a,0xb3,0x7b,0x60,0xd4,0x01,0xf1,0x00,0x9b,
+0x4f,0x20,0x5b,0x00,0x01,0xbf,0x60,0x08,0x70,0x00,0x04,0xf0,0x00,0xa5,0x00,0x00,
+0x4f,0x00,0x0c,0x30,0x0b,0x00,0x10,0xe2,0x0b,0x00,0x02,0x01,0x00,0xe0,0x08,0xd7,
+0x01,0xc0,0xd0,0x09,0xd7,0x00,0x08,0xa1,0x1f,0xf7,0x0c,0xe3,0x01,0x01,0xf1,0x00,
+0xc5,0x00,0x00,0x05,0xae,0x82,0x00,0x00,0x09,0xf3,0x02,0x8d,0xb4,0x02,0xe7,0x68,
+0x0c,0xf0,0x01,0x02,0xff,0xff,0xf2,0x1a,0x10,0x00,0x9e,0x20,0x00,0x9e,0x10,0x00,
+0x71,0x2c,0xcc,0x01,0x00,0x20,0x80,0x33,0x01,0x00,0x51,0x32,0x00,0x00,0x05,0xa0,
+0x4a,0x00,0x11,0x5a,0x06,0x00,0x0a,0x0d,0x00,0x3e,0xfe,0xee,0xe5,0x1a,0x00,0x0b,
+0x0d,0x00,0x80,0x0c,0xcc,0xcd,0xec,0xcc,0xcc,0x60,0x22,0x01,0x00,0x60,0x21,0x3e,
+0xee,0xee,0xee,0xee,0x6b,0x09,0x21,0x4c,0x00,0xd8,0x00,0x21,0xc0,0x00,0x47,0x05,
+0x11,0x81,0x0d,0x00,0x20,0xd9,0xe7,0x07,0x00,0x41,0x4c,0x02,0xcd,0x20,0x1a,0x00,
+0x2a,0x72,0x00,0x27,0x00,0x03,0x0d,0x00,0x50,0x04,0xc0,0x00,0x00,0x00,0x20,0x0f,
+0xff,0x01,0x00,0xb0,0x00,0x00,0x00,0x0a,0x90,0x00,0x00,0x00,0x00,0x05,0xf0,0x06,
+0x00,0x30,0x04,0xef,0x56,0x06,0x00,0xf1,0x0c,0xe4,0xf1,0xbb,0x10,0x00,0x07,0xe3,
+0x0f,0x00,0x7e,0x30,0x1d,0xb1,0x00,0xf0,0x00,0x4f,0x20,0x50,0x00,0x0f,0x00,0x00,
+0x20,0x00,0x00,0x00,0x27,0x00,0x00,0x0d,0x00,0x14,0x00,0x0d,0x00,0xf0,0x39,0x07,
+0x00,0x00,0x06,0x30,0x00,0x00,0x79,0x00,0x02,0xe1,0x00,0x00,0x01,0xd1,0x00,0x97,
+0x00,0x00,0xad,0xde,0xfd,0xee,0xdd,0xd1,0x00,0x00,0x3b,0x07,0x70,0x00,0x00,0x0c,
+0x03,0xb0,0x77,0x0a,0x60,0x00,0x95,0x3b,0x07,0x70,0xe1,0x00,0x03,0xb3,0xb0,0x77,
+0x4b,0x00,0x00,0x0e,0x3b,0x07,0x7b,0x40,0x00,0x00,0x03,0xb0,0x77,0x00,0x00,0x0c,
+0xcc,0xdf,0xcd,0xec,0xcc,0x50,0x33,0x01,0x00,0x40,0x31,0x00,0x00,0x1e,0x54,0x00,
+0xf2,0x0b,0x01,0xe0,0x00,0x00,0xac,0xcc,0xcf,0xcc,0xcc,0x8d,0x32,0x23,0xe2,0x22,
+0x6b,0xd1,0x00,0x1e,0x00,0x04,0xbd,0x10,0x01,0xe0,0x00,0x4b,0x0b,0x00,0x00,0xbb,
+0x00,0x71,0xfb,0x50,0x00,0x1e,0x00,0x01,0x30,0x2c,0x00,0x07,0x37,0x00,0x02,0x0b,
+0x00,0xf2,0x28,0x22,0x23,0xe2,0x22,0x20,0x4e,0xbb,0xbf,0xbb,0xbe,0x04,0xa0,0x01,
+0xe0,0x01,0xe0,0x4e,0xaa,0xbf,0xaa,0xbe,0x00,0x11,0x13,0xe1,0x11,0x10,0xbe,0xee,
+0xef,0xee,0xee,0x6c,0x20,0x01,0xe0,0x00,0x87,0xc2,0x00,0x1e,0x00,0x08,0x7c,0xed,
+0xde,0xfd,0xdd,0xf7,0x30,0x00,0x1e,0x00,0x02,0x20,0x42,0x00,0xb0,0x3f,0xdd,0xdd,
+0xde,0xb0,0x00,0x03,0xb0,0x30,0x00,0x4b,0xc4,0x00,0x20,0xc1,0x04,0x0d,0x00,0x20,
+0x06,0xd1,0x0d,0x00,0xf0,0x06,0x00,0x03,0x04,0xb0,0x01,0xef,0xfe,0xee,0xee,0xff,
+0xe6,0x00,0x68,0x00,0x00,0x04,0xb0,0x00,0x0a,0x50,0x00,0x27,0x00,0x11,0xe1,0x0d,
+0x00,0x20,0x99,0x00,0x0d,0x00,0x74,0x1c,0x00,0x00,0x0a,0xee,0x60,0x00,0x01,0x00,
+0x21,0x06,0x10,0x07,0x00,0x10,0x7d,0x3f,0x01,0xca,0x11,0x11,0x6c,0x11,0x10,0x00,
+0x8d,0xdd,0xef,0xdd,0xdd,0x80,0x4e,0x01,0xde,0xbb,0xbb,0xfb,0xbb,0xb0,0x00,0x03,
+0x33,0x3f,0x33,0x33,0x00,0x00,0x68,0x01,0x11,0x03,0xaf,0x01,0x61,0xf4,0x00,0x00,
+0x03,0x50,0x00,0xe5,0x00,0x02,0x4e,0x00,0x11,0x87,0x4e,0x00,0x31,0xdd,0xdd,0xef,
+0x64,0x00,0x11,0x1d,0x1c,0x00,0x26,0x0c,0x80,0x06,0x00,0x20,0x2d,0x70,0x06,0x00,
+0x20,0x5e,0x50,0xd6,0x01,0x20,0xbc,0x20,0xee,0x01,0xf3,0x09,0xba,0xb5,0x22,0x12,
+0x34,0x21,0xa0,0x03,0x9c,0xdd,0xcc,0xb3,0x00,0x00,0x12,0x35,0x79,0x80,0x00,0x2d,
+0xcb,0xbf,0x87,0x52,0x68,0x00,0xf2,0x25,0x01,0xdd,0xdd,0xdf,0xdd,0xdd,0xd1,0x00,
+0x03,0x70,0xf0,0x83,0x21,0x00,0x9c,0xd9,0x0f,0x0a,0xcb,0x30,0x00,0x06,0x91,0xf0,
+0xa4,0x04,0x00,0xcb,0xa9,0xaf,0xa8,0xca,0xd0,0x00,0x00,0xb5,0xf5,0x92,0x20,0x00,
+0x03,0xc6,0x0f,0x06,0xc2,0x00,0x2b,0xc3,0x00,0xf0,0x04,0xea,0x1e,0x02,0x04,0xf1,
+0x00,0x10,0x1f,0xa9,0x00,0x2f,0x20,0x00,0x01,0x00,0x13,0x20,0x02,0x22,0x01,0x00,
+0x20,0x03,0xee,0x01,0x00,0x51,0xe3,0x00,0x00,0x04,0x80,0x16,0x00,0x22,0x0e,0x10,
+0x47,0x00,0x00,0xa0,0x02,0xf0,0x0f,0x17,0x00,0x06,0x20,0x00,0x00,0x2d,0x50,0x00,
+0x4e,0x50,0x00,0x5e,0x53,0x00,0x04,0x3d,0x60,0x07,0x20,0xd1,0x01,0xe1,0x18,0x00,
+0x00,0x06,0xa0,0xa8,0x00,0xd2,0x00,0x11,0xcc,0x49,0x00,0xf6,0x02,0xbe,0xc3,0x00,
+0x00,0x00,0x4a,0xe5,0x04,0xda,0x51,0x01,0xeb,0x50,0x00,0x00,0x59,0xe2,0x64,0x00,
+0xa2,0xa0,0x00,0x00,0x01,0xaa,0xaa,0xaf,0xba,0xaa,0xa1,0x6f,0x00,0xf0,0x0a,0x00,
+0x07,0xdb,0xbb,0xbb,0xd9,0x00,0x00,0x79,0x22,0x22,0x28,0x90,0x00,0x03,0x77,0x77,
+0x77,0x74,0x00,0x00,0xcc,0xcc,0xcc,0xcc,0x0a,0x03,0xf4,0x02,0x03,0x9d,0x80,0x00,
+0x01,0x11,0x12,0xf6,0x21,0x11,0x02,0xbb,0xbb,0xbf,0xbb,0xbb,0xb3,0x8d,0x01,0x31,
+0x1c,0xcb,0x00,0x64,0x02,0x00,0x4e,0x00,0x80,0x88,0x88,0x8f,0xa8,0x88,0x81,0x04,
+0x44,0x01,0x00,0xf0,0x06,0x00,0x05,0xda,0xaa,0xaa,0xd6,0x00,0x00,0x5b,0x33,0x33,
+0x3a,0x60,0x00,0x02,0x66,0x66,0x66,0x62,0x00,0x0b,0x4e,0x00,0x21,0xcb,0x00,0x8f,
+0x02,0x70,0xe0,0x05,0x01,0xfd,0xdd,0xf0,0x05,0x19,0x02,0x30,0x0f,0x00,0x10,0xca,
+0x00,0xa5,0xf0,0x0c,0x10,0xbd,0x50,0x00,0x0b,0xdd,0xb0,0x01,0xa4,0x00,0x21,0x85,
+0x00,0x85,0x03,0x11,0xdd,0xc7,0x01,0xf1,0x0e,0x6c,0x14,0xd2,0x00,0x00,0x00,0x1a,
+0xc0,0x00,0x3e,0x70,0x00,0x19,0xe7,0x00,0x00,0x01,0xae,0x80,0x07,0x11,0xa0,0x00,
+0x1b,0x02,0x40,0x00,0x02,0xd0,0xdf,0x02,0x21,0x03,0xc0,0x07,0x00,0x21,0x06,0xa0,
+0x07,0x00,0x20,0x0c,0x50,0x07,0x00,0x21,0x01,0xab,0xfb,0x02,0x22,0x07,0x90,0x02,
+0x03,0x20,0x0a,0x20,0x7f,0x00,0xf0,0x24,0x03,0xd0,0x70,0x0e,0x00,0x00,0x00,0xa6,
+0x0d,0x10,0xe0,0x27,0x00,0x4f,0x10,0xd1,0x0f,0xcd,0xe0,0x1e,0xf0,0x0e,0xae,0xf3,
+0x0e,0x08,0x8d,0x4c,0xf7,0x0e,0x00,0xd0,0x10,0xd2,0x3d,0x10,0xe0,0x1d,0x00,0x0d,
+0x00,0xd1,0x0e,0x14,0xb0,0x00,0xd0,0x0d,0x10,0xe5,0xa4,0x0d,0x00,0xf1,0x00,0x00,
+0x00,0x75,0x00,0xd0,0x0d,0x40,0x00,0x0b,0x40,0x0d,0x00,0x5c,0xdd,0xdd,0x22,0x04,
+0x00,0xea,0x03,0xf1,0x06,0x20,0x00,0x3c,0x00,0x0e,0x10,0xd4,0x00,0x4b,0x00,0x0e,
+0x10,0x3e,0x00,0x69,0x00,0x0e,0x10,0x09,0x60,0x87,0xaf,0x01,0x11,0xb4,0x06,0x00,
+0x40,0xf0,0x00,0x0e,0x10,0x08,0x03,0xf3,0x0f,0x0e,0x27,0xe3,0x0d,0xb0,0x00,0x1f,
+0xf9,0x10,0x9b,0xb9,0x00,0x79,0x10,0x09,0xd0,0x0b,0x80,0x00,0x03,0xe9,0x10,0x01,
+0xe3,0x00,0x00,0x30,0x00,0x00,0x10,0xf4,0x00,0xf1,0x09,0x3b,0x01,0x78,0x00,0x00,
 0x00,0x96,0xab,0x61,0xaa,0xaa,0x00,0xe1,0xc1,0x00,0xf3,0x3f,0x07,0xf0,0xc1,0x00,
 0xe0,0x0e,0x1e,0x06,0x00,0x20,0x67,0xe0,0x06,0x00,0x19,0x00,0x06,0x00,0xa0,0xc8,
 0xc3,0xe0,0x0f,0x00,0xe1,0xe8,0x10,0xe5,0xe9,0xdb,0x00,0x05,0x03,0x00,0x03,0x01,
-0x00,0x90,0xc2,0x21,0x3b,0x00,0x00,0x00,0x3d,0x0a,0x53,0xb8,0x07,0xf0,0x1a,0x70,
-0xd2,0x3c,0x00,0x00,0x03,0xf1,0x2f,0xef,0xfe,0xea,0x00,0xdf,0x19,0x70,0x3b,0x00,
-0x00,0x7b,0xd1,0xa0,0x03,0xb0,0x00,0x01,0x1d,0x13,0x33,0x6c,0x33,0x30,0x00,0xd1,
-0xab,0xbc,0xeb,0xbb,0x30,0x0d,0x10,0x00,0x34,0x00,0x69,0xd1,0x00,0x03,0xb0,0x00,
-0x00,0x0d,0x00,0x03,0x01,0x00,0x21,0x05,0x30,0xb2,0x00,0xe0,0xe2,0x24,0x7a,0xec,
-0x40,0x00,0x8a,0x9b,0x9b,0xa0,0x00,0x00,0x2f,0x30,0xf9,0x03,0xf0,0x09,0x1d,0xf2,
-0x00,0x06,0x80,0x00,0x0a,0xac,0x32,0x22,0x89,0x22,0x20,0x30,0xc6,0xcc,0xce,0xec,
-0xcc,0x20,0x0c,0x20,0x00,0x68,0x88,0x00,0x00,0x1a,0x00,0x14,0x00,0x0d,0x00,0xf0,
-0x01,0x23,0x38,0xa3,0x33,0x00,0x0c,0x28,0xbb,0xbb,0xbb,0xb0,0x00,0x0b,0x10,0x53,
-0x08,0xbc,0x01,0xf0,0x1b,0x0e,0x20,0xc2,0x00,0x00,0xa5,0x05,0xb0,0x07,0x80,0x00,
-0x4f,0x11,0xd3,0x00,0x1e,0x30,0x1e,0xf1,0xb9,0x00,0x00,0x5e,0x25,0x8d,0x2b,0xde,
-0xee,0xee,0x74,0x00,0xd1,0x00,0x4a,0x00,0xf0,0x00,0x0d,0x10,0x07,0x70,0x0e,0x8f,
-0x00,0x70,0xc2,0x01,0xd0,0x00,0x0d,0x10,0x4c,0x9d,0x00,0xbc,0xd1,0x2d,0x30,0x06,
-0x90,0x00,0x0d,0x1b,0x40,0x3d,0xc2,0x49,0x03,0x40,0xa5,0x04,0xb3,0x90,0xbc,0x0e,
-0xf0,0x0e,0x3c,0x07,0xc1,0x00,0x09,0x70,0x02,0xd0,0x04,0x00,0x04,0xf4,0x46,0x8f,
-0xbd,0xee,0x02,0xee,0x6a,0x86,0xf4,0x12,0x00,0x77,0xc3,0x00,0x0d,0x30,0xd4,0xdd,
-0x06,0x90,0xa6,0x9a,0x00,0x00,0xc3,0x00,0x07,0xdd,0x10,0x0d,0x00,0xfa,0x07,0x7f,
-0x20,0x10,0x00,0xc3,0x01,0xbb,0xd4,0x09,0x30,0x0c,0x39,0xd5,0x04,0xd1,0xc1,0x00,
-0xc3,0x50,0x00,0x07,0xfb,0x5a,0x00,0x40,0x0a,0x50,0x0a,0x50,0x53,0x02,0x00,0x48,
-0x02,0xf0,0x04,0x77,0x1b,0xcf,0xbb,0xb0,0x02,0xe1,0x2d,0x22,0x22,0xe1,0x0c,0xf1,
-0x2c,0x00,0x00,0xe1,0x7b,0xe1,0x06,0x00,0xe0,0x10,0xd1,0x2f,0xdd,0xdd,0xf1,0x00,
-0xd1,0x2d,0x11,0x11,0xe1,0x00,0xd1,0x12,0x00,0x04,0x06,0x00,0xe1,0x2f,0xcc,0xcc,
-0xf1,0x00,0xd1,0x2c,0x22,0x22,0xc1,0x00,0x09,0x10,0x2b,0x7c,0x06,0x10,0x07,0x4e,
-0x02,0xf0,0x17,0xc8,0xde,0xfe,0xdd,0xdd,0x50,0x6f,0x00,0x6a,0x06,0x00,0x00,0x3f,
-0xf0,0x0e,0x20,0xe0,0x00,0x09,0x5e,0x0b,0xfe,0xef,0xee,0xc0,0x00,0xe8,0xae,0x00,
-0xe0,0x1d,0x00,0x0e,0x10,0xe0,0x0e,0x01,0xd0,0xf6,0x01,0x00,0x0d,0x00,0x80,0x00,
-0xe0,0x0e,0x4d,0xa0,0x00,0xe0,0x02,0xee,0x01,0x11,0x0e,0x03,0x00,0x04,0x01,0x00,
-0x40,0xb3,0x00,0xb4,0x00,0xa3,0x0f,0x10,0x06,0x05,0x10,0xf0,0x0f,0x54,0xbb,0xcc,
-0xbb,0x70,0x06,0xf1,0x12,0x32,0x23,0x31,0x03,0xee,0x10,0x66,0x00,0x4b,0x00,0x75,
-0xd1,0x04,0x90,0x07,0x80,0x00,0x0d,0x10,0x1d,0x00,0x95,0x4c,0x01,0x90,0xe0,0x0c,
-0x20,0x00,0x0d,0x10,0x0c,0x20,0xe0,0x0d,0x00,0xe0,0x71,0x3a,0x00,0x00,0x0d,0x1a,
-0xaa,0xac,0xda,0xa1,0x00,0xd1,0x33,0x33,0x77,0x05,0xf0,0x1c,0x08,0x30,0x00,0x26,
-0xb5,0x00,0x02,0xe0,0x9c,0xdf,0x94,0x00,0x00,0x96,0x0e,0x10,0xa3,0x00,0x00,0x3f,
-0x10,0xe0,0x09,0x50,0x00,0x1e,0xf1,0x0e,0x00,0x86,0x00,0x08,0x8d,0x10,0xfe,0xef,
-0xfe,0xe6,0x10,0xd1,0x0e,0x00,0x59,0x30,0x02,0x91,0xe0,0x02,0xc0,0x00,0x00,0xd1,
-0x0e,0x00,0x0e,0x0d,0x00,0xf5,0x01,0x54,0xa4,0x37,0x00,0xd1,0x0e,0x68,0xb4,0xd9,
-0x60,0x0d,0x16,0xc7,0x28,0x07,0xc1,0x44,0x02,0x20,0x20,0x08,0x37,0x04,0x10,0xe1,
-0x19,0x07,0xf0,0x00,0x00,0x98,0x11,0x14,0x91,0x11,0x00,0x4f,0x29,0xcc,0xde,0xcc,
-0xc0,0x2f,0xf1,0x5c,0x09,0x50,0x07,0x7d,0x10,0x00,0x59,0x78,0x02,0xd1,0x4c,0xcd,
-0xec,0xc8,0x00,0x0d,0x10,0x11,0x7a,0x11,0x10,0x00,0xd1,0x76,0x09,0x12,0x0d,0x1a,
-0x00,0xb4,0xd2,0x22,0x27,0xa2,0x22,0x00,0x0d,0x3c,0xcc,0xcc,0xcc,0xf7,0x01,0x21,
-0x01,0xd0,0x07,0x00,0xe0,0x79,0xcd,0xdd,0xdd,0xdd,0x10,0x0d,0x31,0x11,0x11,0x1c,
-0x30,0x06,0xf1,0x6f,0x02,0xf2,0x08,0x02,0xff,0x17,0xdd,0xd7,0x0c,0x20,0x77,0xd1,
-0x85,0x06,0x80,0xc2,0x00,0x0d,0x18,0x50,0x68,0x0c,0x20,0x00,0xd1,0x86,0x0d,0x00,
-0x20,0xec,0xc6,0x0d,0x00,0x40,0x42,0x00,0x00,0xc2,0x5b,0x00,0x30,0x00,0x0d,0x20,
-0xed,0x02,0x25,0xfe,0xc0,0x4d,0x01,0x30,0xc3,0x0a,0x20,0x4d,0x01,0x01,0x04,0x07,
-0xf0,0x0a,0x0b,0x50,0x8f,0xee,0xee,0xe1,0x05,0xf1,0x2d,0x0e,0x10,0x00,0x02,0xff,
-0x1b,0x60,0xe1,0x00,0x00,0x88,0xd3,0x90,0x0e,0xee,0xeb,0x3b,0x00,0x11,0xe1,0x28,
-0x03,0x21,0x0e,0x10,0xa3,0x00,0x36,0xee,0xee,0xe0,0x0d,0x00,0x06,0x1a,0x00,0x0a,
-0x01,0x00,0x11,0xc2,0x0e,0x03,0x20,0x5c,0x33,0x0e,0x03,0xf1,0x0c,0x0d,0x5a,0xaa,
-0xcd,0xaa,0xa2,0x09,0xf0,0x00,0x07,0x80,0x00,0x06,0xff,0x0a,0xdb,0xde,0xbc,0xd0,
-0x94,0xe0,0xa4,0x06,0x80,0x1d,0x00,0x0e,0x0d,0x00,0x50,0x00,0xe0,0x45,0x09,0x60,
-0xe6,0x01,0x20,0xc4,0xd2,0x3f,0x05,0x20,0x01,0xed,0x12,0x06,0xba,0x03,0xab,0x8e,
-0x94,0x10,0x00,0xe3,0xc6,0x00,0x16,0xad,0x87,0x08,0x02,0xc8,0x08,0x60,0x10,0x00,
-0xa0,0x0f,0x00,0x81,0xec,0x09,0xf0,0x1f,0xf0,0x1e,0x00,0x00,0x0b,0xe5,0x0f,0x08,
-0xe8,0x00,0x08,0xa2,0xb5,0xf8,0xd1,0xaa,0x00,0x80,0x03,0xdf,0xd3,0x00,0x50,0x00,
-0x03,0xd2,0xf2,0xd3,0x00,0x00,0x07,0xd2,0x0f,0x03,0xe7,0x00,0x2d,0x90,0x00,0xf0,
-0x01,0xad,0x30,0x30,0x00,0x0f,0xdf,0x03,0x20,0x38,0x00,0x6d,0x00,0xf0,0x0b,0x96,
-0xef,0xee,0x73,0x0e,0x00,0xe1,0x0c,0x20,0x0d,0x0e,0x06,0xe0,0x0e,0x22,0x0d,0x0e,
-0x1e,0xe0,0x4d,0xbf,0x1d,0x0e,0x49,0xe0,0xb4,0xfd,0x1f,0xf0,0x00,0xe4,0xd1,0x2c,
-0x0d,0x0e,0x00,0xe3,0x4d,0xb7,0x0d,0x0e,0x00,0xe0,0x01,0xf1,0x06,0x00,0x20,0x06,
-0x90,0x99,0x02,0x20,0x4d,0x10,0x06,0x00,0x49,0xc2,0x00,0x08,0xea,0xf1,0x00,0x00,
-0x00,0x03,0xb0,0xb3,0x00,0x00,0x5c,0x02,0xc0,0x0b,0x30,0x00,0x0c,0x60,0x0d,0x00,
-0x90,0x06,0xf1,0xcf,0xfe,0xef,0xfe,0x12,0xff,0x10,0x0d,0x00,0x21,0x88,0xd1,0x1a,
-0x00,0x21,0x0d,0x10,0x27,0x00,0x11,0xd2,0xd3,0x09,0x30,0x0d,0x10,0x03,0x1c,0x05,
-0x90,0xd1,0x07,0xa0,0x0a,0x80,0x00,0x0d,0x14,0xd0,0xd8,0x05,0x5a,0xd1,0xb1,0x00,
-0x00,0x2c,0x5a,0x00,0xf0,0x28,0x01,0xd0,0x04,0xa6,0xb4,0x20,0x00,0x8b,0xae,0xe6,
-0x4b,0x3b,0x00,0x0e,0x34,0x2c,0x03,0xb0,0xa3,0x07,0xe0,0x02,0xc0,0x2c,0x01,0x02,
-0xfe,0x6d,0xef,0xde,0xfd,0xd6,0x97,0xe0,0x02,0xc0,0x1d,0x03,0x01,0x0e,0x00,0x2c,
-0x33,0xe2,0xc0,0x00,0xe2,0x7b,0xfb,0x4d,0xb3,0x00,0x0e,0x48,0x5c,0x31,0x18,0xf5,
-0x04,0xe0,0x02,0xc0,0x5f,0x80,0x80,0x0e,0x00,0x2c,0x7d,0x3d,0x29,0x00,0xe0,0xbe,
-0x73,0x00,0x8f,0x40,0xa5,0x02,0x11,0x00,0xa5,0x02,0x70,0xfd,0xdd,0xdf,0x30,0x00,
-0xa6,0x0d,0x59,0x03,0xf1,0x00,0x5f,0x00,0xd0,0x00,0x0b,0x30,0x4e,0xf0,0x0d,0xde,
-0xfd,0xd3,0x09,0x3e,0x00,0x1d,0x05,0xf5,0x16,0xe1,0xcc,0xcd,0xfc,0xcb,0x00,0x0e,
-0x01,0x14,0xff,0x81,0x10,0x00,0xe0,0x01,0xd7,0xbc,0x20,0x00,0x0e,0x02,0xc6,0x3b,
-0x3d,0x20,0x00,0xe3,0xe6,0x03,0xb0,0x5e,0x10,0x0e,0x02,0x00,0x3b,0x00,0xea,0x0e,
-0x50,0x0b,0x00,0x0b,0x00,0x00,0x9b,0x03,0x10,0x86,0x5d,0x02,0x61,0xcc,0xcd,0xdc,
-0xcc,0x10,0x6f,0x19,0x00,0x82,0x2e,0xf0,0x1c,0xcc,0xcc,0xc1,0x08,0x6e,0x27,0x00,
-0x10,0xe0,0x0d,0x00,0x04,0xd5,0x03,0xf4,0x0a,0xe0,0x5e,0xcc,0xcc,0xe3,0x00,0x0e,
-0x05,0x80,0x00,0x09,0x30,0x00,0xe0,0x58,0x11,0x11,0xa3,0x00,0x0e,0x05,0xdb,0xbb,
-0xbd,0x30,0xfe,0x00,0x20,0xc0,0x00,0x96,0x0c,0xf0,0x30,0x87,0x00,0x7e,0xaa,0xa9,
-0x00,0x0e,0x10,0x2e,0x91,0x19,0x80,0x07,0xf0,0x3d,0x4b,0x46,0xc0,0x02,0xff,0x0d,
-0x10,0x2e,0xf2,0x00,0x87,0xe0,0xd6,0xbc,0x56,0xdc,0x31,0x0e,0x0d,0x41,0x1a,0x50,
-0x31,0x00,0xe0,0xd0,0x9b,0x32,0x70,0x00,0x0e,0x0d,0x00,0x28,0xa1,0x30,0x00,0xe0,
-0xc0,0x89,0x30,0x8b,0x00,0x0e,0x00,0x01,0x59,0xd6,0x96,0x07,0x16,0xc7,0x92,0x0f,
-0x21,0x03,0xa0,0xa3,0x00,0x10,0x86,0x15,0x06,0xf0,0x32,0x20,0x0e,0x1d,0x13,0x31,
-0x14,0x10,0x06,0xe0,0xd0,0x65,0x00,0xc0,0x01,0xee,0x0d,0x0b,0x5a,0xae,0xb1,0x57,
-0xe0,0xd3,0xf1,0x22,0xd3,0x00,0x0e,0x0d,0xae,0x09,0x0c,0x00,0x00,0xe0,0xd1,0xd0,
-0xa2,0xc0,0x00,0x0e,0x0d,0x0d,0x03,0x9c,0x00,0x00,0xe3,0xa0,0xd0,0x00,0xc0,0x00,
-0x0e,0x76,0x0d,0x00,0x0c,0x00,0x00,0xe7,0x20,0xd0,0x1d,0xc0,0xb3,0x08,0x00,0x01,
-0x00,0xf0,0x13,0x78,0xcd,0xdd,0xdd,0xdf,0x00,0xe2,0xc2,0x03,0x50,0x0e,0x06,0xf0,
-0xc2,0x26,0x92,0x1e,0x1e,0xf0,0xc5,0x9b,0xc9,0x5e,0x98,0xe0,0xc2,0x04,0x70,0x0e,
-0x20,0xe0,0xc2,0xbb,0xbf,0x39,0x02,0x20,0xb0,0x0c,0x06,0x00,0x20,0xb7,0x7e,0x06,
-0x00,0x60,0x22,0x22,0x0e,0x00,0xe0,0xce,0x36,0x00,0xf3,0x1d,0xe0,0xb2,0x00,0x00,
-0x0c,0x00,0x06,0x10,0x04,0x50,0x00,0x00,0x02,0xe2,0x33,0x6b,0x33,0x30,0x00,0xa6,
-0x5a,0xba,0xaa,0xca,0x00,0x4f,0x00,0x58,0x00,0x5a,0x00,0x1e,0xf0,0x00,0xc0,0x0c,
-0x20,0x06,0x7e,0x0d,0xde,0xde,0xfd,0xd5,0x03,0x07,0x60,0x0e,0x00,0xcd,0xdd,0xdd,
-0x30,0x32,0x05,0x20,0x00,0xb3,0x93,0x02,0x20,0x00,0x0b,0x0d,0x00,0xa0,0xaa,0xaa,
-0xe3,0x00,0x0e,0x00,0xe3,0x33,0x3b,0x30,0x94,0x18,0x00,0x9e,0x0a,0xf1,0x1c,0xbb,
-0xbb,0x78,0x0e,0x00,0xa3,0x0c,0x32,0x0d,0x0e,0x02,0xe0,0x49,0x0b,0x1d,0x0e,0x0c,
-0xe1,0xeb,0xbc,0x8d,0x0e,0x69,0xe0,0x53,0x40,0x5d,0x0e,0x21,0xe0,0x02,0xb0,0x0d,
-0x0e,0x00,0xe2,0xcd,0xfc,0x6d,0x0e,0x00,0xe0,0x02,0x9c,0x00,0xf6,0x01,0x03,0xc7,
-0x70,0x0e,0x00,0xe5,0xdd,0x96,0x20,0x0e,0x00,0xe1,0x10,0x00,0x0b,0xdb,0xd2,0x03,
-0x10,0x4b,0xd7,0x10,0xff,0x17,0x8c,0xcd,0xec,0xcc,0x00,0x0b,0x40,0x11,0xa5,0x11,
-0x10,0x04,0xf0,0x0b,0xbe,0xbb,0xb2,0x01,0xef,0x00,0xd0,0x00,0x0a,0x40,0x57,0xe0,
-0x0f,0xbb,0xbb,0xe4,0x00,0x0e,0x00,0xd0,0x00,0x09,0x40,0x00,0x0d,0x00,0x07,0x52,
-0xe3,0xdf,0xdd,0xdd,0xed,0xd3,0x0a,0x00,0x41,0x04,0x20,0x0a,0x40,0x4d,0x16,0xf0,
-0x21,0xad,0xea,0xa7,0x00,0xd4,0xa4,0x11,0x11,0x5b,0x07,0xf1,0xa8,0x55,0x55,0x8b,
-0x3e,0xe1,0xb8,0x66,0x66,0x64,0x74,0xd1,0xb8,0xaa,0xaa,0xa9,0x00,0xd1,0xcb,0x4b,
-0x1b,0x1c,0x00,0xd1,0xda,0x2a,0x0a,0x0c,0x00,0xd1,0xd9,0xde,0xce,0xcd,0x00,0xd3,
-0xa9,0x0c,0x00,0x21,0xd6,0x79,0x06,0x00,0xf0,0x05,0x39,0x2a,0x0a,0x89,0x00,0x06,
-0x10,0x03,0x60,0x00,0x00,0x01,0xe6,0x88,0x9f,0x88,0x81,0x00,0x97,0x34,0xa5,0x09,
-0xf0,0x17,0x2f,0x10,0xcb,0xbb,0xbf,0x10,0x0d,0xf0,0x0c,0x64,0x44,0xe1,0x05,0x9e,
-0x00,0x45,0x55,0x55,0x00,0x00,0xe0,0xdc,0xcc,0xcc,0xce,0x20,0x0e,0x0d,0x00,0x00,
-0x00,0xb2,0x00,0xe0,0x2a,0xcd,0xfc,0xc2,0x86,0x02,0x10,0x1d,0x86,0x02,0x01,0x62,
-0x05,0x80,0x0e,0x00,0x0c,0xd9,0x00,0x00,0x00,0x3a,0x9a,0x00,0xf0,0x19,0x00,0x97,
-0xdc,0xcf,0x07,0x0d,0x00,0xe1,0xd0,0x0d,0x0d,0x0d,0x07,0xf0,0xd9,0x9f,0x0d,0x0d,
-0x2f,0xe0,0xd1,0x1e,0x0d,0x0d,0x97,0xe0,0xd4,0x4e,0x0d,0x0d,0x20,0xe0,0xd7,0x7e,
-0x0d,0x0d,0x00,0xe0,0xd0,0x0d,0x06,0x00,0x20,0xbc,0xcd,0x06,0x00,0xfa,0x01,0x47,
-0x36,0x00,0x0d,0x00,0xe0,0xd3,0x0d,0x10,0x0e,0x00,0xe5,0x60,0x04,0x15,0xdb,0xf8,
-0x0a,0xf9,0x2c,0xc0,0x0d,0x00,0xc2,0x00,0x00,0x88,0xac,0xfc,0xcf,0xcb,0x00,0x0e,
-0x21,0x1e,0x21,0xc4,0x10,0x06,0xf0,0x22,0xe3,0x2c,0x52,0x01,0xef,0x2b,0xde,0xbb,
-0xbb,0xb2,0x6a,0xf0,0x4f,0x86,0x66,0x64,0x00,0x0e,0x8d,0xd4,0x6c,0x47,0xa0,0x00,
-0xe1,0x2f,0xbc,0xeb,0xca,0x00,0x0e,0x02,0xc0,0x2b,0x04,0xa0,0x00,0xe0,0x0d,0x00,
-0x45,0x2c,0x02,0xb1,0xc7,0x56,0x00,0xf0,0x36,0xd2,0x11,0x69,0x11,0x10,0x00,0x5b,
-0x9a,0xac,0xda,0xaa,0x20,0x0c,0x33,0x99,0xbd,0x99,0x70,0x07,0xf0,0x68,0x27,0xa2,
-0x5b,0x03,0xff,0x06,0xb7,0xac,0x79,0xb0,0x95,0xe0,0x6c,0x9b,0xd9,0xbb,0x00,0x0e,
-0x03,0x33,0x7a,0x4d,0x60,0x00,0xe0,0x88,0x77,0x6a,0xb9,0x20,0x0e,0x3c,0xcc,0xcc,
-0xde,0xc4,0x00,0xe0,0x09,0x50,0x06,0x80,0x00,0x0e,0x00,0x1d,0x30,0x68,0xfe,0x00,
-0x35,0x12,0xcd,0x50,0xc5,0x03,0xf0,0x14,0x02,0xb0,0x07,0x70,0x00,0x05,0xbb,0xce,
-0xbb,0xdd,0xb2,0x00,0xc4,0x02,0xb1,0x18,0x70,0x00,0x6f,0x00,0x1a,0xcd,0xa4,0x00,
-0x3f,0xf0,0x3b,0xbc,0xdb,0xb7,0x09,0x6e,0x05,0x80,0x59,0x89,0x00,0xf1,0x0b,0x4c,
-0xbc,0xdb,0xc9,0x00,0x0e,0x03,0x55,0x9b,0x55,0x40,0x00,0xe0,0x36,0x69,0xb6,0x65,
-0x00,0x0e,0x03,0xbb,0xde,0xbb,0x60,0x00,0xe0,0xcc,0x06,0xa1,0x0e,0x1b,0xbb,0xde,
-0xbb,0xb3,0x00,0x08,0x30,0xa2,0xa8,0x0d,0xfb,0x36,0x6e,0xcc,0xd0,0x00,0x00,0x97,
-0x4e,0x10,0x96,0x00,0x00,0x3f,0x5f,0xeb,0xcf,0xbc,0xd0,0x0d,0xf0,0x3b,0x04,0x90,
-0x1d,0x06,0xae,0x01,0xbd,0xfb,0xbb,0x90,0x00,0xe0,0x17,0xdc,0x10,0x37,0x00,0x0e,
-0x0a,0x62,0xbc,0x9c,0x20,0x00,0xe0,0x29,0xa2,0xd5,0xc0,0x00,0x0e,0x08,0x35,0xba,
-0x57,0x90,0x00,0xe0,0x7d,0x90,0x95,0x0a,0x70,0x0e,0x06,0x12,0xdc,0x00,0x01,0x64,
-0x06,0x20,0xc0,0x58,0xc6,0x03,0xf0,0x29,0x5a,0x9b,0xfb,0xbf,0xbb,0x00,0x0c,0x21,
-0x33,0x98,0x33,0x10,0x07,0xf0,0x36,0x6b,0xa6,0x63,0x03,0xee,0x3b,0xbb,0xdd,0xbb,
-0xb4,0x74,0xe0,0x14,0x77,0x34,0x71,0x00,0x0e,0x18,0x9a,0x05,0x73,0xb0,0x00,0xe4,
-0xbc,0xeb,0xcd,0xbb,0x50,0x0e,0x00,0x4a,0x32,0xc3,0x70,0x00,0xe4,0xcc,0xd8,0x1c,
-0x82,0x04,0xb4,0x49,0x07,0xe9,0x16,0x00,0xe0,0x5c,0x65,0x70,0x9d,0x40,0xfe,0x00,
-0xf4,0x3d,0x2a,0x12,0xc0,0x92,0x00,0x04,0xc0,0x68,0x2c,0x2b,0x00,0x00,0xc5,0xfb,
-0xbb,0xbb,0xbe,0x20,0x6f,0x0a,0x88,0x77,0x7a,0x82,0x3e,0xf0,0x0b,0xa8,0x88,0xe0,
-0x09,0x4e,0x01,0x55,0x55,0x55,0x30,0x00,0xe0,0x5b,0x44,0x44,0x98,0x00,0x0e,0x05,
-0xc8,0x88,0x8b,0x80,0x00,0xe0,0x5c,0x88,0x88,0xb8,0x00,0x0e,0x05,0xd9,0x99,0x9b,
-0x80,0x00,0xe0,0x04,0xb2,0x0a,0x71,0x00,0x0e,0x2c,0x82,0x00,0x06,0xd2,0xa9,0x00,
-0xf0,0x14,0x29,0x25,0x00,0x38,0x04,0x10,0x08,0x60,0xc0,0x05,0x92,0xd0,0x00,0xe3,
-0x47,0x46,0xbd,0xe7,0x00,0x6d,0x15,0x55,0x13,0x9d,0x10,0x1e,0xd0,0xbc,0xc9,0xdf,
-0xfd,0x55,0x9d,0x02,0x22,0x7f,0x18,0xf0,0x08,0xd0,0x89,0x97,0xfd,0xcc,0x00,0x0d,
-0x06,0x66,0x9b,0x20,0xd0,0x00,0xd0,0xc5,0xc2,0xad,0xcf,0x00,0x0d,0x0b,0x0a,0x2a,
-0x0d,0x00,0xb5,0xec,0xe2,0xab,0xaf,0x00,0x0d,0x0a,0x0a,0x2a,0x52,0xd0,0xff,0x00,
-0x12,0x3c,0x07,0x00,0x10,0xb4,0xa1,0x13,0x00,0xe3,0x0e,0x41,0xe1,0x00,0x00,0xd6,
-0xf1,0x14,0x10,0x99,0xd6,0x15,0xf0,0x09,0x00,0x8c,0x00,0x01,0x3e,0x90,0x00,0x3f,
-0xff,0xfd,0xed,0xbd,0x70,0x00,0x20,0xa6,0x08,0x70,0x13,0x00,0x00,0x0d,0x30,0x87,
-0x93,0x09,0xf1,0x02,0xd0,0x08,0x70,0x07,0x40,0x04,0xe4,0x00,0x87,0x00,0xa4,0x0c,
-0xd4,0x00,0x04,0xee,0xed,0xea,0x0f,0x05,0xe2,0x0f,0xf1,0x03,0x0d,0x20,0x0f,0x00,
-0x1d,0x10,0x00,0x5c,0x00,0xf0,0x09,0x90,0x00,0x00,0xb4,0x0f,0x03,0xc0,0x1a,0x00,
-0x10,0x01,0x09,0x14,0x90,0xfe,0xff,0xee,0xe0,0x00,0x00,0xa5,0x08,0x60,0x87,0x0c,
-0x21,0x30,0x86,0xdc,0x01,0x01,0x0d,0x00,0x11,0x89,0x52,0x05,0xe8,0x7d,0x10,0x08,
-0x70,0x0a,0x21,0xea,0x20,0x00,0x4e,0xee,0xc0,0x02,0x00,0x55,0x00,0x10,0xcc,0xde,
-0x0f,0x74,0xc1,0x01,0x11,0x11,0xf1,0x11,0x11,0xe9,0x0e,0x50,0x9e,0xdd,0xdd,0xde,
-0xa0,0x15,0x04,0xf0,0x05,0x00,0x4a,0x00,0x00,0x95,0x11,0x11,0x15,0xa0,0x00,0x07,
-0xce,0xec,0xed,0xc8,0x00,0x00,0x00,0xc4,0x09,0x91,0x02,0xf5,0x03,0x3e,0x00,0x95,
-0x00,0x53,0x00,0x6e,0x50,0x09,0x50,0x09,0x52,0xea,0x30,0x00,0x5f,0xee,0xd1,0x54,
-0x00,0x02,0xb0,0x02,0x12,0x0c,0x35,0x11,0x12,0x1d,0x47,0x0e,0x21,0x3f,0x20,0x7f,
-0x0f,0x11,0xeb,0x0d,0x00,0x30,0xb6,0xd4,0x00,0x33,0x1d,0x20,0x05,0xd0,0xd3,0x0a,
-0x10,0x80,0xc0,0x17,0xf1,0x05,0x05,0xe0,0x00,0x4e,0x10,0x00,0x04,0xf3,0x00,0x00,
-0x8c,0x10,0x08,0xf5,0x00,0x00,0x00,0xad,0x21,0xb2,0x5e,0x26,0x21,0x00,0x06,0x32,
-0x00,0x12,0x99,0x15,0x09,0x30,0x00,0x00,0x0b,0x62,0x08,0xf0,0x0f,0xf2,0xb3,0x00,
-0xbf,0x20,0x0c,0x2b,0x30,0x2d,0x69,0x00,0xc2,0xb3,0x0a,0x60,0xe2,0x0c,0x2b,0x4a,
-0xb0,0x06,0xd3,0xc2,0xb9,0x90,0x00,0x06,0xac,0x2b,0x30,0x11,0x05,0x10,0xb3,0x2c,
-0x01,0x00,0x0b,0x00,0x10,0xbe,0x21,0x01,0x11,0xb1,0x3e,0x00,0x21,0xac,0xb0,0xc0,
-0x12,0xfa,0x08,0x08,0xc0,0x00,0x00,0x02,0xc9,0x00,0x07,0xd3,0x00,0x07,0xe5,0x00,
-0x00,0x04,0xe9,0x04,0xa7,0xdd,0xdf,0xdd,0xd8,0xa5,0xe8,0x0f,0x5a,0x4d,0xdd,0xfd,
-0xdd,0x60,0x5d,0x11,0x10,0xde,0xc9,0x01,0x10,0xe0,0x7a,0x11,0x10,0x30,0xff,0x00,
-0x31,0x10,0x1e,0x30,0xaf,0x1b,0x20,0x5c,0x00,0x84,0x17,0xf0,0x07,0x00,0xb8,0x00,
-0x03,0xe3,0x01,0x80,0x01,0xe6,0x01,0xe5,0x00,0xaa,0x00,0x03,0xf3,0x02,0x00,0x3e,
-0x10,0x00,0x02,0x9c,0x18,0xf5,0x0a,0x08,0x10,0x00,0x00,0x07,0xb0,0x00,0x6c,0x00,
-0x00,0x04,0xd1,0x00,0x12,0xc8,0x00,0x01,0xff,0xef,0xed,0xcb,0xe3,0x00,0x04,0x21,
-0x57,0x12,0x01,0x6d,0x05,0x00,0xeb,0x04,0xc0,0x22,0xe3,0x22,0x23,0xe2,0x20,0x0a,
-0xcf,0xcc,0xcc,0xcf,0xcb,0xbb,0x09,0x00,0xf8,0x04,0x5f,0x0d,0xdd,0xdd,0xdd,0x00,
-0x0d,0x00,0x01,0x20,0x3e,0xef,0x5a,0x02,0xf0,0x00,0x30,0x00,0x29,0x20,0x28,0x20,
-0x00,0x04,0xad,0x50,0x00,0x5c,0xb4,0x01,0x94,0x42,0x02,0xf1,0x0b,0x90,0x00,0x1f,
-0xcc,0xcc,0xcd,0xa0,0x00,0x01,0xe4,0x44,0x44,0x8a,0x00,0x00,0x1e,0x55,0x55,0x58,
-0xa0,0x00,0x01,0xfb,0xbb,0xbb,0xda,0x50,0x05,0x1a,0x05,0x0d,0x00,0xf0,0x06,0x01,
+0x00,0xf0,0x27,0xc2,0x21,0x3b,0x00,0x00,0x00,0x3d,0x0a,0x53,0xb0,0x00,0x00,0x0a,
+0x70,0xd2,0x3c,0x00,0x00,0x03,0xf1,0x2f,0xef,0xfe,0xea,0x00,0xdf,0x19,0x70,0x3b,
+0x00,0x00,0x7b,0xd1,0xa0,0x03,0xb0,0x00,0x01,0x1d,0x13,0x33,0x6c,0x33,0x30,0x00,
+0xd1,0xab,0xbc,0xeb,0xbb,0x30,0x0d,0x10,0x00,0x34,0x00,0x69,0xd1,0x00,0x03,0xb0,
+0x00,0x00,0x0d,0x00,0x03,0x01,0x00,0x21,0x05,0x30,0xb2,0x00,0xe0,0xe2,0x24,0x7a,
+0xec,0x40,0x00,0x8a,0x9b,0x9b,0xa0,0x00,0x00,0x2f,0x30,0xf9,0x03,0xf0,0x09,0x1d,
+0xf2,0x00,0x06,0x80,0x00,0x0a,0xac,0x32,0x22,0x89,0x22,0x20,0x30,0xc6,0xcc,0xce,
+0xec,0xcc,0x20,0x0c,0x20,0x00,0x68,0x88,0x00,0x00,0x1a,0x00,0x14,0x00,0x0d,0x00,
+0xf0,0x01,0x23,0x38,0xa3,0x33,0x00,0x0c,0x28,0xbb,0xbb,0xbb,0xb0,0x00,0x0b,0x10,
+0x53,0x08,0xbc,0x01,0xf0,0x1b,0x0e,0x20,0xc2,0x00,0x00,0xa5,0x05,0xb0,0x07,0x80,
+0x00,0x4f,0x11,0xd3,0x00,0x1e,0x30,0x1e,0xf1,0xb9,0x00,0x00,0x5e,0x25,0x8d,0x2b,
+0xde,0xee,0xee,0x74,0x00,0xd1,0x00,0x4a,0x00,0xf0,0x00,0x0d,0x10,0x07,0x70,0x0e,
+0x8f,0x00,0x70,0xc2,0x01,0xd0,0x00,0x0d,0x10,0x4c,0x9d,0x00,0xbc,0xd1,0x2d,0x30,
+0x06,0x90,0x00,0x0d,0x1b,0x40,0x3d,0xc2,0x49,0x03,0xf0,0x23,0xa5,0x04,0xb3,0x90,
+0x00,0x00,0x2e,0x00,0x3c,0x07,0xc1,0x00,0x09,0x70,0x02,0xd0,0x04,0x00,0x04,0xf4,
+0x46,0x8f,0xbd,0xee,0x02,0xee,0x6a,0x86,0xf4,0x12,0x00,0x77,0xc3,0x00,0x0d,0x30,
+0xd4,0x00,0x0c,0x30,0x00,0xa6,0x9a,0x00,0x00,0xc3,0x00,0x07,0xdd,0x10,0x0d,0x00,
+0xfa,0x07,0x7f,0x20,0x10,0x00,0xc3,0x01,0xbb,0xd4,0x09,0x30,0x0c,0x39,0xd5,0x04,
+0xd1,0xc1,0x00,0xc3,0x50,0x00,0x07,0xfb,0x5a,0x00,0x40,0x0a,0x50,0x0a,0x50,0x53,
+0x02,0x00,0x48,0x02,0xf0,0x04,0x77,0x1b,0xcf,0xbb,0xb0,0x02,0xe1,0x2d,0x22,0x22,
+0xe1,0x0c,0xf1,0x2c,0x00,0x00,0xe1,0x7b,0xe1,0x06,0x00,0xe0,0x10,0xd1,0x2f,0xdd,
+0xdd,0xf1,0x00,0xd1,0x2d,0x11,0x11,0xe1,0x00,0xd1,0x12,0x00,0x04,0x06,0x00,0xe0,
+0x2f,0xcc,0xcc,0xf1,0x00,0xd1,0x2c,0x22,0x22,0xc1,0x00,0x09,0x10,0x2b,0x86,0x04,
+0x20,0xc0,0x07,0x4e,0x02,0xf0,0x17,0xc8,0xde,0xfe,0xdd,0xdd,0x50,0x6f,0x00,0x6a,
+0x06,0x00,0x00,0x3f,0xf0,0x0e,0x20,0xe0,0x00,0x09,0x5e,0x0b,0xfe,0xef,0xee,0xc0,
+0x00,0xe8,0xae,0x00,0xe0,0x1d,0x00,0x0e,0x10,0xe0,0x0e,0x01,0xd0,0xf6,0x01,0x00,
+0x0d,0x00,0x80,0x00,0xe0,0x0e,0x4d,0xa0,0x00,0xe0,0x02,0xee,0x01,0x11,0x0e,0x03,
+0x00,0x04,0x01,0x00,0x30,0xb3,0x00,0xb4,0xf5,0x01,0xf0,0x15,0x00,0x06,0x90,0x00,
+0x00,0x0b,0x54,0xbb,0xcc,0xbb,0x70,0x06,0xf1,0x12,0x32,0x23,0x31,0x03,0xee,0x10,
+0x66,0x00,0x4b,0x00,0x75,0xd1,0x04,0x90,0x07,0x80,0x00,0x0d,0x10,0x1d,0x00,0x95,
+0x4c,0x01,0x90,0xe0,0x0c,0x20,0x00,0x0d,0x10,0x0c,0x20,0xe0,0x0d,0x00,0xe0,0x71,
+0x3a,0x00,0x00,0x0d,0x1a,0xaa,0xac,0xda,0xa1,0x00,0xd1,0x33,0x33,0x77,0x05,0xf0,
+0x1c,0x08,0x30,0x00,0x26,0xb5,0x00,0x02,0xe0,0x9c,0xdf,0x94,0x00,0x00,0x96,0x0e,
+0x10,0xa3,0x00,0x00,0x3f,0x10,0xe0,0x09,0x50,0x00,0x1e,0xf1,0x0e,0x00,0x86,0x00,
+0x08,0x8d,0x10,0xfe,0xef,0xfe,0xe6,0x10,0xd1,0x0e,0x00,0x59,0x30,0x02,0x91,0xe0,
+0x02,0xc0,0x00,0x00,0xd1,0x0e,0x00,0x0e,0x0d,0x00,0xf5,0x01,0x54,0xa4,0x37,0x00,
+0xd1,0x0e,0x68,0xb4,0xd9,0x60,0x0d,0x16,0xc7,0x28,0x07,0xc1,0x44,0x02,0x20,0x20,
+0x08,0x37,0x04,0x10,0xe1,0x19,0x07,0xf0,0x09,0x00,0x98,0x11,0x14,0x91,0x11,0x00,
+0x4f,0x29,0xcc,0xde,0xcc,0xc0,0x2f,0xf1,0x00,0x05,0x90,0x00,0x07,0x7d,0x10,0x00,
+0x59,0x78,0x02,0xd0,0x4c,0xcd,0xec,0xc8,0x00,0x0d,0x10,0x11,0x7a,0x11,0x10,0x00,
+0xd1,0x1a,0x00,0x22,0x00,0x0d,0x1a,0x00,0xb4,0xd2,0x22,0x27,0xa2,0x22,0x00,0x0d,
+0x3c,0xcc,0xcc,0xcc,0xf7,0x01,0x21,0x01,0xd0,0x07,0x00,0xe0,0x79,0xcd,0xdd,0xdd,
+0xdd,0x10,0x0d,0x31,0x11,0x11,0x1c,0x30,0x06,0xf1,0x6f,0x02,0xf2,0x08,0x02,0xff,
+0x17,0xdd,0xd7,0x0c,0x20,0x77,0xd1,0x85,0x06,0x80,0xc2,0x00,0x0d,0x18,0x50,0x68,
+0x0c,0x20,0x00,0xd1,0x86,0x0d,0x00,0x20,0xec,0xc6,0x0d,0x00,0x40,0x42,0x00,0x00,
+0xc2,0x5b,0x00,0x30,0x00,0x0d,0x20,0xed,0x02,0x25,0xfe,0xc0,0x4d,0x01,0x30,0xc3,
+0x0a,0x20,0x4d,0x01,0x01,0x04,0x07,0xf0,0x0a,0x0b,0x50,0x8f,0xee,0xee,0xe1,0x05,
+0xf1,0x2d,0x0e,0x10,0x00,0x02,0xff,0x1b,0x60,0xe1,0x00,0x00,0x88,0xd3,0x90,0x0e,
+0xee,0xeb,0x3b,0x00,0x11,0xe1,0x28,0x03,0x21,0x0e,0x10,0xa3,0x00,0x36,0xee,0xee,
+0xe0,0x0d,0x00,0x06,0x1a,0x00,0x0a,0x01,0x00,0x11,0xc2,0x0e,0x03,0x20,0x5c,0x33,
+0x0e,0x03,0xf1,0x0c,0x0d,0x5a,0xaa,0xcd,0xaa,0xa2,0x09,0xf0,0x00,0x07,0x80,0x00,
+0x06,0xff,0x0a,0xdb,0xde,0xbc,0xd0,0x94,0xe0,0xa4,0x06,0x80,0x1d,0x00,0x0e,0x0d,
+0x00,0x50,0x00,0xe0,0x45,0x09,0x60,0xe6,0x01,0x20,0xc4,0xd2,0x3f,0x05,0x20,0x01,
+0xed,0x12,0x06,0xba,0x03,0xab,0x8e,0x94,0x10,0x00,0xe3,0xc6,0x00,0x16,0xad,0x87,
+0x08,0x02,0xc8,0x08,0xf0,0x29,0x10,0x00,0xa0,0x0f,0x00,0x81,0x00,0x00,0x4d,0x00,
+0xf0,0x1e,0x00,0x00,0x0b,0xe5,0x0f,0x08,0xe8,0x00,0x08,0xa2,0xb5,0xf8,0xd1,0xaa,
+0x00,0x80,0x03,0xdf,0xd3,0x00,0x50,0x00,0x03,0xd2,0xf2,0xd3,0x00,0x00,0x07,0xd2,
+0x0f,0x03,0xe7,0x00,0x2d,0x90,0x00,0xf0,0x01,0xad,0x30,0x30,0x00,0x0f,0xdf,0x03,
+0x20,0x38,0x00,0x6d,0x00,0xf0,0x1e,0x96,0xef,0xee,0x73,0x0e,0x00,0xe1,0x0c,0x20,
+0x0d,0x0e,0x06,0xe0,0x0e,0x22,0x0d,0x0e,0x1e,0xe0,0x4d,0xbf,0x1d,0x0e,0x49,0xe0,
+0xb4,0x0d,0x0d,0x0e,0x00,0xe4,0xd1,0x2c,0x0d,0x0e,0x00,0xe3,0x4d,0xb7,0x0d,0x0e,
+0x00,0xe0,0x01,0xf1,0x06,0x00,0x20,0x06,0x90,0x99,0x02,0x20,0x4d,0x10,0x06,0x00,
+0x49,0xc2,0x00,0x08,0xea,0xf1,0x00,0x00,0x00,0x03,0xb0,0xb3,0x00,0x00,0x5c,0x02,
+0xc0,0x0b,0x30,0x00,0x0c,0x60,0x0d,0x00,0x90,0x06,0xf1,0xcf,0xfe,0xef,0xfe,0x12,
+0xff,0x10,0x0d,0x00,0x21,0x88,0xd1,0x1a,0x00,0x21,0x0d,0x10,0x27,0x00,0x10,0xd2,
+0xff,0x06,0x40,0x30,0x0d,0x10,0x03,0x1c,0x05,0x90,0xd1,0x07,0xa0,0x0a,0x80,0x00,
+0x0d,0x14,0xd0,0xd8,0x05,0x5a,0xd1,0xb1,0x00,0x00,0x2c,0x5a,0x00,0xf5,0x3f,0x01,
+0xd0,0x04,0xa6,0xb4,0x20,0x00,0x8b,0xae,0xe6,0x4b,0x3b,0x00,0x0e,0x34,0x2c,0x03,
+0xb0,0xa3,0x07,0xe0,0x02,0xc0,0x2c,0x01,0x02,0xfe,0x6d,0xef,0xde,0xfd,0xd6,0x97,
+0xe0,0x02,0xc0,0x1d,0x03,0x01,0x0e,0x00,0x2c,0x33,0xe2,0xc0,0x00,0xe2,0x7b,0xfb,
+0x4d,0xb3,0x00,0x0e,0x48,0x5c,0x00,0xba,0x00,0x00,0xe0,0x02,0xc0,0x5f,0x80,0x80,
+0x0e,0x00,0x2c,0x7d,0x3d,0x29,0x00,0xe0,0xbe,0x73,0x00,0x8f,0x40,0xa5,0x02,0x11,
+0x00,0xa5,0x02,0x70,0xfd,0xdd,0xdf,0x30,0x00,0xa6,0x0d,0x59,0x03,0xf1,0x00,0x5f,
+0x00,0xd0,0x00,0x0b,0x30,0x4e,0xf0,0x0d,0xde,0xfd,0xd3,0x09,0x3e,0x00,0x1d,0x05,
+0xf4,0x17,0xe1,0xcc,0xcd,0xfc,0xcb,0x00,0x0e,0x01,0x14,0xff,0x81,0x10,0x00,0xe0,
+0x01,0xd7,0xbc,0x20,0x00,0x0e,0x02,0xc6,0x3b,0x3d,0x20,0x00,0xe3,0xe6,0x03,0xb0,
+0x5e,0x10,0x0e,0x02,0x00,0x3b,0x00,0x30,0xaa,0x00,0x50,0x0b,0x00,0x0b,0x00,0x00,
+0x9b,0x03,0x10,0x86,0x5d,0x02,0x61,0xcc,0xcd,0xdc,0xcc,0x10,0x6f,0x19,0x00,0x82,
+0x2e,0xf0,0x1c,0xcc,0xcc,0xc1,0x08,0x6e,0x27,0x00,0x10,0xe0,0x0d,0x00,0x04,0xd5,
+0x03,0xf4,0x0a,0xe0,0x5e,0xcc,0xcc,0xe3,0x00,0x0e,0x05,0x80,0x00,0x09,0x30,0x00,
+0xe0,0x58,0x11,0x11,0xa3,0x00,0x0e,0x05,0xdb,0xbb,0xbd,0x30,0xfe,0x00,0x10,0xc0,
+0x9e,0x06,0xf0,0x31,0x00,0x87,0x00,0x7e,0xaa,0xa9,0x00,0x0e,0x10,0x2e,0x91,0x19,
+0x80,0x07,0xf0,0x3d,0x4b,0x46,0xc0,0x02,0xff,0x0d,0x10,0x2e,0xf2,0x00,0x87,0xe0,
+0xd6,0xbc,0x56,0xdc,0x31,0x0e,0x0d,0x41,0x1a,0x50,0x31,0x00,0xe0,0xd0,0x9b,0x32,
+0x70,0x00,0x0e,0x0d,0x00,0x28,0xa1,0x30,0x00,0xe0,0xc0,0x89,0x30,0x8b,0x00,0x0e,
+0x00,0x01,0x59,0xd6,0x96,0x07,0x25,0xc7,0x30,0x53,0x01,0x21,0x03,0xa0,0xa3,0x00,
+0x10,0x86,0x15,0x06,0xf0,0x32,0x20,0x0e,0x1d,0x13,0x31,0x14,0x10,0x06,0xe0,0xd0,
+0x65,0x00,0xc0,0x01,0xee,0x0d,0x0b,0x5a,0xae,0xb1,0x57,0xe0,0xd3,0xf1,0x22,0xd3,
+0x00,0x0e,0x0d,0xae,0x09,0x0c,0x00,0x00,0xe0,0xd1,0xd0,0xa2,0xc0,0x00,0x0e,0x0d,
+0x0d,0x03,0x9c,0x00,0x00,0xe3,0xa0,0xd0,0x00,0xc0,0x00,0x0e,0x76,0x0d,0x00,0x0c,
+0x00,0x00,0xe7,0x20,0xd0,0x1d,0xc0,0xb3,0x08,0x00,0x01,0x00,0xf0,0x13,0x78,0xcd,
+0xdd,0xdd,0xdf,0x00,0xe2,0xc2,0x03,0x50,0x0e,0x06,0xf0,0xc2,0x26,0x92,0x1e,0x1e,
+0xf0,0xc5,0x9b,0xc9,0x5e,0x98,0xe0,0xc2,0x04,0x70,0x0e,0x20,0xe0,0xc2,0xbb,0xbf,
+0x39,0x02,0x20,0xb0,0x0c,0x06,0x00,0x20,0xb7,0x7e,0x06,0x00,0x60,0x22,0x22,0x0e,
+0x00,0xe0,0xce,0x36,0x00,0xf3,0x1d,0xe0,0xb2,0x00,0x00,0x0c,0x00,0x06,0x10,0x04,
+0x50,0x00,0x00,0x02,0xe2,0x33,0x6b,0x33,0x30,0x00,0xa6,0x5a,0xba,0xaa,0xca,0x00,
+0x4f,0x00,0x58,0x00,0x5a,0x00,0x1e,0xf0,0x00,0xc0,0x0c,0x20,0x06,0x7e,0x0d,0xde,
+0xde,0xfd,0xd5,0x03,0x07,0x60,0x0e,0x00,0xcd,0xdd,0xdd,0x30,0x32,0x05,0x20,0x00,
+0xb3,0x93,0x02,0x20,0x00,0x0b,0x0d,0x00,0xc1,0xaa,0xaa,0xe3,0x00,0x0e,0x00,0xe3,
+0x33,0x3b,0x30,0x00,0x02,0x27,0x00,0xf1,0x1d,0x4b,0xbb,0xbb,0x78,0x0e,0x00,0xa3,
+0x0c,0x32,0x0d,0x0e,0x02,0xe0,0x49,0x0b,0x1d,0x0e,0x0c,0xe1,0xeb,0xbc,0x8d,0x0e,
+0x69,0xe0,0x53,0x40,0x5d,0x0e,0x21,0xe0,0x02,0xb0,0x0d,0x0e,0x00,0xe2,0xcd,0xfc,
+0x6d,0x0e,0x00,0xe0,0x02,0x9c,0x00,0xf5,0x01,0x03,0xc7,0x70,0x0e,0x00,0xe5,0xdd,
+0x96,0x20,0x0e,0x00,0xe1,0x10,0x00,0x0b,0xdb,0xd2,0x03,0x00,0xf6,0x0a,0xff,0x19,
+0x00,0x3c,0x8c,0xcd,0xec,0xcc,0x00,0x0b,0x40,0x11,0xa5,0x11,0x10,0x04,0xf0,0x0b,
+0xbe,0xbb,0xb2,0x01,0xef,0x00,0xd0,0x00,0x0a,0x40,0x57,0xe0,0x0f,0xbb,0xbb,0xe4,
+0x00,0x0e,0x00,0xd0,0x00,0x09,0x40,0x00,0x0d,0x00,0x07,0x52,0xe3,0xdf,0xdd,0xdd,
+0xed,0xd3,0x0a,0x00,0x41,0x04,0xf0,0x27,0x0a,0x40,0x00,0x00,0x5b,0x7a,0xad,0xea,
+0xa7,0x00,0xd4,0xa4,0x11,0x11,0x5b,0x07,0xf1,0xa8,0x55,0x55,0x8b,0x3e,0xe1,0xb8,
+0x66,0x66,0x64,0x74,0xd1,0xb8,0xaa,0xaa,0xa9,0x00,0xd1,0xcb,0x4b,0x1b,0x1c,0x00,
+0xd1,0xda,0x2a,0x0a,0x0c,0x00,0xd1,0xd9,0xde,0xce,0xcd,0x00,0xd3,0xa9,0x0c,0x00,
+0x21,0xd6,0x79,0x06,0x00,0xf0,0x05,0x39,0x2a,0x0a,0x89,0x00,0x06,0x10,0x03,0x60,
+0x00,0x00,0x01,0xe6,0x88,0x9f,0x88,0x81,0x00,0x97,0x34,0xa5,0x09,0xf0,0x17,0x2f,
+0x10,0xcb,0xbb,0xbf,0x10,0x0d,0xf0,0x0c,0x64,0x44,0xe1,0x05,0x9e,0x00,0x45,0x55,
+0x55,0x00,0x00,0xe0,0xdc,0xcc,0xcc,0xce,0x20,0x0e,0x0d,0x00,0x00,0x00,0xb2,0x00,
+0xe0,0x2a,0xcd,0xfc,0xc2,0x86,0x02,0x10,0x1d,0x86,0x02,0x01,0x62,0x05,0x80,0x0e,
+0x00,0x0c,0xd9,0x00,0x00,0x00,0x3a,0x9a,0x00,0xf0,0x19,0x00,0x97,0xdc,0xcf,0x07,
+0x0d,0x00,0xe1,0xd0,0x0d,0x0d,0x0d,0x07,0xf0,0xd9,0x9f,0x0d,0x0d,0x2f,0xe0,0xd1,
+0x1e,0x0d,0x0d,0x97,0xe0,0xd4,0x4e,0x0d,0x0d,0x20,0xe0,0xd7,0x7e,0x0d,0x0d,0x00,
+0xe0,0xd0,0x0d,0x06,0x00,0x20,0xbc,0xcd,0x06,0x00,0xfa,0x01,0x47,0x36,0x00,0x0d,
+0x00,0xe0,0xd3,0x0d,0x10,0x0e,0x00,0xe5,0x60,0x04,0x15,0xdb,0xf8,0x0a,0xf9,0x2c,
+0xc0,0x0d,0x00,0xc2,0x00,0x00,0x88,0xac,0xfc,0xcf,0xcb,0x00,0x0e,0x21,0x1e,0x21,
+0xc4,0x10,0x06,0xf0,0x22,0xe3,0x2c,0x52,0x01,0xef,0x2b,0xde,0xbb,0xbb,0xb2,0x6a,
+0xf0,0x4f,0x86,0x66,0x64,0x00,0x0e,0x8d,0xd4,0x6c,0x47,0xa0,0x00,0xe1,0x2f,0xbc,
+0xeb,0xca,0x00,0x0e,0x02,0xc0,0x2b,0x04,0xa0,0x00,0xe0,0x0d,0x00,0x45,0x2c,0x02,
+0xb1,0xc7,0x56,0x00,0xf0,0x36,0xd2,0x11,0x69,0x11,0x10,0x00,0x5b,0x9a,0xac,0xda,
+0xaa,0x20,0x0c,0x33,0x99,0xbd,0x99,0x70,0x07,0xf0,0x68,0x27,0xa2,0x5b,0x03,0xff,
+0x06,0xb7,0xac,0x79,0xb0,0x95,0xe0,0x6c,0x9b,0xd9,0xbb,0x00,0x0e,0x03,0x33,0x7a,
+0x4d,0x60,0x00,0xe0,0x88,0x77,0x6a,0xb9,0x20,0x0e,0x3c,0xcc,0xcc,0xde,0xc4,0x00,
+0xe0,0x09,0x50,0x06,0x80,0x00,0x0e,0x00,0x1d,0x30,0x68,0xfe,0x00,0x35,0x12,0xcd,
+0x50,0xc5,0x03,0xf0,0x14,0x02,0xb0,0x07,0x70,0x00,0x05,0xbb,0xce,0xbb,0xdd,0xb2,
+0x00,0xc4,0x02,0xb1,0x18,0x70,0x00,0x6f,0x00,0x1a,0xcd,0xa4,0x00,0x3f,0xf0,0x3b,
+0xbc,0xdb,0xb7,0x09,0x6e,0x05,0x80,0x59,0x89,0x00,0xf1,0x0b,0x4c,0xbc,0xdb,0xc9,
+0x00,0x0e,0x03,0x55,0x9b,0x55,0x40,0x00,0xe0,0x36,0x69,0xb6,0x65,0x00,0x0e,0x03,
+0xbb,0xde,0xbb,0x60,0x00,0xe0,0xcc,0x06,0xa1,0x0e,0x1b,0xbb,0xde,0xbb,0xb3,0x00,
+0x08,0x30,0xa2,0xa8,0x0d,0xfb,0x36,0x6e,0xcc,0xd0,0x00,0x00,0x97,0x4e,0x10,0x96,
+0x00,0x00,0x3f,0x5f,0xeb,0xcf,0xbc,0xd0,0x0d,0xf0,0x3b,0x04,0x90,0x1d,0x06,0xae,
+0x01,0xbd,0xfb,0xbb,0x90,0x00,0xe0,0x17,0xdc,0x10,0x37,0x00,0x0e,0x0a,0x62,0xbc,
+0x9c,0x20,0x00,0xe0,0x29,0xa2,0xd5,0xc0,0x00,0x0e,0x08,0x35,0xba,0x57,0x90,0x00,
+0xe0,0x7d,0x90,0x95,0x0a,0x70,0x0e,0x06,0x12,0xdc,0x00,0x01,0x64,0x06,0x20,0xc0,
+0x58,0xc6,0x03,0xf0,0x29,0x5a,0x9b,0xfb,0xbf,0xbb,0x00,0x0c,0x21,0x33,0x98,0x33,
+0x10,0x07,0xf0,0x36,0x6b,0xa6,0x63,0x03,0xee,0x3b,0xbb,0xdd,0xbb,0xb4,0x74,0xe0,
+0x14,0x77,0x34,0x71,0x00,0x0e,0x18,0x9a,0x05,0x73,0xb0,0x00,0xe4,0xbc,0xeb,0xcd,
+0xbb,0x50,0x0e,0x00,0x4a,0x32,0xc3,0x70,0x00,0xe4,0xcc,0xd8,0x1c,0x82,0x04,0xb4,
+0x49,0x07,0xe9,0x16,0x00,0xe0,0x5c,0x65,0x70,0x9d,0x40,0xfe,0x00,0xf4,0x3d,0x2a,
+0x12,0xc0,0x92,0x00,0x04,0xc0,0x68,0x2c,0x2b,0x00,0x00,0xc5,0xfb,0xbb,0xbb,0xbe,
+0x20,0x6f,0x0a,0x88,0x77,0x7a,0x82,0x3e,0xf0,0x0b,0xa8,0x88,0xe0,0x09,0x4e,0x01,
+0x55,0x55,0x55,0x30,0x00,0xe0,0x5b,0x44,0x44,0x98,0x00,0x0e,0x05,0xc8,0x88,0x8b,
+0x80,0x00,0xe0,0x5c,0x88,0x88,0xb8,0x00,0x0e,0x05,0xd9,0x99,0x9b,0x80,0x00,0xe0,
+0x04,0xb2,0x0a,0x71,0x00,0x0e,0x2c,0x82,0x00,0x06,0xd2,0xa9,0x00,0xf0,0x2f,0x29,
+0x25,0x00,0x38,0x04,0x10,0x08,0x60,0xc0,0x05,0x92,0xd0,0x00,0xe3,0x47,0x46,0xbd,
+0xe7,0x00,0x6d,0x15,0x55,0x13,0x9d,0x10,0x1e,0xd0,0xbc,0xc9,0xdf,0xfd,0x55,0x9d,
+0x02,0x22,0x06,0xb0,0x00,0x00,0xd0,0x89,0x97,0xfd,0xcc,0x00,0x0d,0x06,0x66,0x9b,
+0x20,0xd0,0x00,0xd0,0xc5,0xc2,0xad,0xcf,0x00,0x0d,0x0b,0x0a,0x2a,0x0d,0x00,0xb0,
+0xec,0xe2,0xab,0xaf,0x00,0x0d,0x0a,0x0a,0x2a,0x52,0xd0,0x14,0x00,0x01,0x00,0x12,
+0x3c,0x07,0x00,0xf4,0x37,0xb4,0x00,0x00,0x01,0xee,0xee,0xef,0xee,0xee,0xe1,0x00,
+0x00,0xd6,0x00,0x40,0x00,0x00,0x00,0x99,0x00,0x0c,0x90,0x00,0x00,0x8c,0x00,0x01,
+0x3e,0x90,0x00,0x3f,0xff,0xfd,0xed,0xbd,0x70,0x00,0x20,0xa6,0x08,0x70,0x13,0x00,
+0x00,0x0d,0x30,0x87,0x00,0x00,0x00,0x04,0xd0,0x08,0x70,0x07,0x40,0x04,0xe4,0x00,
+0x87,0x00,0xa4,0x0c,0xd4,0x00,0x04,0xee,0xed,0x00,0x20,0x55,0x00,0xf1,0x07,0xf0,
+0x00,0x00,0x00,0x0d,0x20,0x0f,0x00,0x1d,0x10,0x00,0x5c,0x00,0xf0,0x09,0x90,0x00,
+0x00,0xb4,0x0f,0x03,0xc0,0x1a,0x00,0xf1,0x0a,0x01,0x00,0x01,0xee,0xef,0xfe,0xff,
+0xee,0xe0,0x00,0x00,0xa5,0x08,0x60,0x00,0x00,0x00,0x0c,0x30,0x86,0x00,0x00,0x00,
+0x01,0xe0,0x0d,0x00,0x20,0x89,0x00,0x0d,0x00,0xe8,0x7d,0x10,0x08,0x70,0x0a,0x21,
+0xea,0x20,0x00,0x4e,0xee,0xc0,0x02,0x00,0x55,0x00,0xf0,0x01,0xcc,0xcc,0xcf,0xcc,
+0xcc,0xc1,0x01,0x11,0x11,0xf1,0x11,0x11,0x00,0x00,0x00,0x0f,0x18,0x00,0xf5,0x24,
+0x9e,0xdd,0xdd,0xde,0xa0,0x00,0x09,0x40,0x00,0x00,0x4a,0x00,0x00,0x95,0x11,0x11,
+0x15,0xa0,0x00,0x07,0xce,0xec,0xed,0xc8,0x00,0x00,0x00,0xc4,0x09,0x50,0x00,0x00,
+0x00,0x3e,0x00,0x95,0x00,0x53,0x00,0x6e,0x50,0x09,0x50,0x09,0x52,0xea,0x30,0x00,
+0x5f,0xee,0xd1,0x54,0x00,0x11,0x50,0x06,0x00,0x21,0x0c,0xa0,0x07,0x00,0x21,0x1d,
+0x80,0x07,0x00,0x11,0x3f,0xc7,0x00,0x21,0x06,0xeb,0x0d,0x00,0x20,0xb6,0xd4,0x06,
+0x00,0xf0,0x11,0x2f,0x05,0xd0,0x00,0x00,0x00,0x0a,0x80,0x0c,0x60,0x00,0x00,0x05,
+0xe0,0x00,0x4e,0x10,0x00,0x04,0xf3,0x00,0x00,0x8c,0x10,0x08,0xf5,0x00,0x00,0x00,
+0xad,0x21,0xb2,0x24,0x00,0x31,0x72,0x00,0x06,0x32,0x00,0x11,0x99,0x06,0x00,0xf0,
+0x1c,0xc3,0x00,0x00,0x0b,0xff,0xff,0xff,0xff,0xf2,0xb3,0x00,0xbf,0x20,0x0c,0x2b,
+0x30,0x2d,0x69,0x00,0xc2,0xb3,0x0a,0x60,0xe2,0x0c,0x2b,0x4a,0xb0,0x06,0xd3,0xc2,
+0xb9,0x90,0x00,0x06,0xac,0x2b,0x30,0x00,0x00,0x00,0xc2,0xb3,0x2c,0x01,0x00,0x0b,
+0x00,0x10,0xbe,0x21,0x01,0x11,0xb1,0x3e,0x00,0x20,0xac,0xb0,0x06,0x00,0xf3,0x09,
+0xa9,0x08,0xc0,0x00,0x00,0x02,0xc9,0x00,0x07,0xd3,0x00,0x07,0xe5,0x00,0x00,0x04,
+0xe9,0x04,0xa7,0xdd,0xdf,0xdd,0xd8,0xa5,0x0c,0x01,0x03,0xff,0x00,0x54,0x4d,0xdd,
+0xfd,0xdd,0x60,0x0d,0x00,0x02,0x1a,0x00,0x40,0xde,0xee,0xef,0xee,0x61,0x01,0x30,
+0x20,0x00,0x30,0xff,0x00,0xf4,0x36,0x10,0x1e,0x30,0x00,0x00,0x0b,0x70,0x00,0x5c,
+0x00,0x00,0x04,0xe0,0x00,0x00,0xb8,0x00,0x03,0xe3,0x01,0x80,0x01,0xe6,0x01,0xe5,
+0x00,0xaa,0x00,0x03,0xf3,0x02,0x00,0x3e,0x10,0x00,0x02,0x00,0x00,0x0c,0x60,0x08,
+0x10,0x00,0x00,0x07,0xb0,0x00,0x6c,0x00,0x00,0x04,0xd1,0x00,0x12,0xc8,0x00,0x01,
+0xff,0xef,0xed,0xcb,0xe3,0x00,0x04,0x21,0x00,0x00,0x05,0xa0,0x32,0x01,0xff,0x10,
+0x0d,0x10,0x00,0x1d,0x00,0x00,0x22,0xe3,0x22,0x23,0xe2,0x20,0x0a,0xcf,0xcc,0xcc,
+0xcf,0xcb,0x00,0x00,0xd1,0x00,0x01,0xd0,0x00,0x00,0x0d,0xdd,0xdd,0xdd,0x00,0x0d,
+0x00,0x01,0x20,0x3e,0xef,0x5a,0x02,0xf0,0x00,0x30,0x00,0x29,0x20,0x28,0x20,0x00,
+0x04,0xad,0x50,0x00,0x5c,0xb4,0x01,0x94,0x42,0x02,0xf0,0x0c,0x90,0x00,0x1f,0xcc,
+0xcc,0xcd,0xa0,0x00,0x01,0xe4,0x44,0x44,0x8a,0x00,0x00,0x1e,0x55,0x55,0x58,0xa0,
+0x00,0x01,0xfb,0xbb,0xbb,0xda,0x00,0x65,0x00,0x1a,0x05,0x0d,0x00,0xf0,0x06,0x01,
 0xee,0xfe,0xee,0xee,0xef,0xe7,0x00,0x03,0xb1,0x00,0x98,0x10,0x00,0x3a,0xd3,0x00,
-0x00,0x7e,0x70,0x0a,0xc1,0x01,0x60,0x19,0x30,0x00,0x00,0x94,0x0c,0xbe,0x13,0xf0,
-0x13,0x1a,0x61,0xc3,0x11,0x00,0x05,0xec,0xed,0xcf,0xdc,0xf0,0x00,0x59,0x09,0x40,
-0xc2,0x0e,0x00,0x05,0x90,0x95,0x0c,0x20,0xf0,0x00,0x5f,0xdf,0xed,0xfe,0xdf,0x00,
-0x05,0x90,0x94,0xc5,0x0b,0x02,0x1a,0x00,0xf0,0x06,0x9f,0xfe,0xfe,0xef,0xee,0xfe,
-0x20,0x00,0x59,0x00,0x29,0x20,0x00,0x02,0xad,0x30,0x00,0x5d,0x90,0x03,0xd6,0x23,
-0x16,0x15,0x80,0xc3,0x0c,0x02,0xae,0x21,0x10,0x7b,0xf4,0x1a,0x40,0x0d,0xdd,0xee,
-0xdf,0xd2,0x00,0xb1,0x06,0x80,0xa4,0x00,0x00,0x01,0xcc,0xde,0xce,0xdc,0xf0,0x0d,
-0x00,0x90,0x0f,0x00,0x2c,0xcc,0xee,0xcf,0xdc,0xfc,0x30,0x0d,0x00,0xf0,0x13,0x0e,
-0x00,0x03,0xcc,0xfe,0xce,0xfc,0xc0,0x00,0x01,0xbc,0x80,0xab,0xb1,0x00,0x06,0xd5,
-0x68,0x0a,0x45,0xd7,0x02,0x91,0x06,0x80,0xa4,0x01,0x82,0x00,0xee,0xff,0xef,0xfe,
-0xf8,0x81,0x05,0x93,0x49,0x06,0x80,0x00,0xe0,0x2c,0x04,0x90,0x68,0x0d,0x00,0xd9,
-0x02,0xf2,0x4c,0x26,0xa2,0x89,0x22,0xbf,0xbc,0xfb,0xde,0xbd,0xe8,0x1a,0x00,0x07,
-0x0d,0x00,0x11,0x07,0x0d,0x00,0x26,0x99,0xe4,0xb9,0x02,0xf1,0x0b,0x2b,0x07,0x60,
-0x00,0x0b,0x60,0x09,0x70,0x2d,0x00,0x00,0x2e,0x11,0xfc,0xcc,0xdc,0xc3,0x00,0x73,
-0xae,0x11,0x3c,0x11,0x00,0x00,0x6d,0x61,0x0c,0x40,0x0b,0x3f,0xdd,0xef,0x82,0x01,
-0x01,0x0d,0x00,0xf0,0x02,0x78,0x0e,0x33,0x5d,0x33,0x00,0x0e,0x20,0xfa,0xab,0xea,
-0xa0,0x06,0xb0,0x0e,0x00,0x2c,0x5a,0x1e,0x54,0xfe,0xee,0xfe,0xe8,0x02,0x41,0x09,
-0x00,0x0a,0x10,0xc0,0x60,0x01,0xe0,0x01,0x70,0x3c,0x00,0x1e,0x00,0x1e,0x03,0xc0,
-0xfe,0x12,0x02,0x0b,0x00,0x00,0xc6,0x02,0xf1,0x03,0xe0,0x51,0x00,0x1e,0x00,0x03,
-0x2c,0x30,0x01,0xe0,0x00,0x96,0xc3,0x00,0x1e,0x00,0x09,0x6c,0x0b,0x00,0x51,0xcf,
-0xee,0xff,0xee,0xef,0xc1,0x11,0x12,0x96,0x46,0x00,0x30,0x9e,0xee,0xee,0xc4,0x11,
-0xf1,0x21,0x02,0x9a,0x20,0x0d,0x13,0x00,0xf3,0x05,0x2d,0xd2,0xc5,0x0e,0x06,0xa1,
-0xdd,0x11,0xa1,0xf8,0xb0,0x1d,0xd1,0x05,0xcf,0xb8,0x01,0xdd,0x3b,0x91,0xe0,0x9a,
-0x1d,0xd5,0x41,0x3e,0x00,0x83,0xdd,0x10,0x49,0x50,0x00,0x1d,0xdd,0xcc,0xcc,0xcc,
-0xcd,0xd0,0x73,0x12,0x40,0x00,0x01,0x70,0x01,0x4c,0x00,0x10,0x9a,0x38,0x1d,0x30,
-0x00,0x2f,0x20,0x42,0x1d,0x20,0x0c,0x70,0x10,0x00,0x02,0x93,0x17,0x70,0x04,0xbb,
-0xff,0xff,0xff,0xf6,0xa0,0xdc,0x14,0x30,0x0b,0x40,0x00,0x18,0x23,0x00,0xbb,0x11,
-0x10,0xe2,0x90,0x0c,0x20,0x00,0x9a,0xf8,0x02,0x20,0x01,0x9c,0xca,0x0e,0x65,0x01,
-0xe8,0x00,0x0a,0xef,0x70,0xe1,0x03,0x50,0xe0,0x09,0xee,0xee,0xee,0xe5,0x00,0xf1,
-0x06,0x86,0x00,0xe0,0x02,0xe9,0xd7,0x09,0x50,0x0f,0x07,0xcf,0x51,0x00,0xa4,0x00,
-0xf0,0x00,0xe0,0x00,0x0c,0x30,0x85,0x0d,0xf0,0x05,0xe0,0x01,0xe0,0x00,0xe0,0x24,
-0x2d,0x00,0x1d,0x00,0x0f,0xbd,0x49,0x70,0x03,0xc0,0x04,0xd5,0x01,0xe1,0x41,0x15,
-0x21,0x01,0xc7,0x0c,0x02,0x48,0xb8,0x00,0xbf,0xd2,0x30,0x06,0x10,0x0e,0x88,0x02,
-0x30,0x62,0x10,0xe0,0x45,0x01,0x60,0x95,0x0e,0x00,0x07,0x92,0x21,0xc8,0x24,0xf0,
-0x07,0xdb,0xbb,0xf0,0x95,0x0e,0x00,0x5a,0x00,0x3b,0x09,0x50,0xe0,0x0e,0x43,0x09,
-0x70,0x95,0x0e,0x00,0x33,0xd6,0xe1,0x1a,0x00,0x20,0x01,0xd9,0x27,0x00,0x30,0x00,
-0x5d,0x10,0x22,0x07,0x20,0x7e,0x20,0x20,0x08,0x6a,0x9a,0x10,0x00,0x00,0x9e,0xb0,
-0x87,0x06,0x22,0x06,0x70,0x8b,0x04,0xf0,0x0c,0x05,0xef,0xfe,0xef,0x20,0xbc,0xdc,
-0x30,0x3c,0x00,0xc2,0x01,0x12,0xd0,0x04,0xb0,0x0d,0x10,0x00,0xa5,0x10,0x59,0x00,
-0xd1,0x00,0x4f,0x5a,0xda,0x0f,0x20,0x3f,0xfe,0xbd,0x00,0x30,0x0e,0x6c,0x98,0x21,
-0x08,0xf0,0x01,0x22,0xc0,0x24,0xc0,0x01,0xd0,0x00,0x2c,0x00,0xb5,0x00,0x3c,0x00,
-0x02,0xc0,0x9c,0xc6,0x11,0x49,0x2c,0x1c,0x10,0x9e,0xb0,0x00,0xc4,0x1d,0x0e,0xdd,
-0xdf,0x30,0x20,0x1d,0x0e,0x00,0x0b,0x33,0xa0,0x06,0x00,0x50,0xcc,0xcf,0x33,0xa0,
-0x1d,0xc6,0x1b,0xf0,0x01,0xa0,0x1d,0x00,0xab,0x88,0x23,0xa0,0x1d,0x00,0xd6,0x5c,
-0x43,0xa0,0x1d,0x00,0xd0,0x1e,0x00,0x80,0x05,0xa0,0x0c,0x10,0x00,0x1d,0x1d,0x30,
-0xd5,0x08,0x6a,0x67,0x0b,0xd9,0x00,0x3e,0xe9,0x49,0x0c,0xd0,0x6d,0x70,0x00,0x1d,
-0x1a,0xdf,0xc5,0x00,0x20,0x1d,0x04,0x28,0x60,0x69,0x0f,0x10,0x08,0x06,0x00,0x90,
-0x3c,0xce,0xec,0xc1,0xe0,0x1d,0x01,0x1e,0xa1,0x19,0x12,0xf0,0x03,0x7f,0xe8,0x00,
-0xe0,0x1d,0x01,0xd9,0x6a,0x80,0xe0,0x1d,0x0c,0x58,0x60,0x50,0xd0,0x1d,0x59,0xde,
-0x05,0x01,0x2a,0x00,0x20,0x00,0x2d,0x06,0x00,0x22,0x4f,0xe7,0x4d,0x04,0xb9,0x0d,
-0xdf,0xee,0xf4,0x11,0x0d,0x0d,0x0a,0x45,0x84,0x95,0x06,0x00,0xa8,0x5e,0x8d,0xab,
-0xca,0x95,0x0d,0x3e,0x5c,0x89,0xb8,0x18,0x00,0x11,0x85,0x06,0x00,0x10,0x00,0x06,
-0x00,0x10,0x94,0x06,0x00,0x42,0x4b,0xd1,0x0d,0xe8,0xe4,0x00,0xf0,0x1f,0x0d,0xdf,
-0xdd,0xd8,0x83,0x1d,0x00,0x5b,0x08,0x00,0xa4,0x1d,0x00,0xd1,0x07,0x90,0xa4,0x1d,
-0x09,0xec,0xcc,0xd4,0xa4,0x1d,0x01,0x11,0x60,0x22,0xa4,0x1d,0x01,0x14,0xc1,0x10,
-0xa4,0x1d,0x07,0xbc,0xeb,0xb3,0xa4,0x1d,0x00,0x02,0xc0,0x00,0x06,0x00,0xf3,0x01,
-0xc4,0x85,0x00,0x1d,0x07,0xad,0xeb,0x82,0x00,0x1d,0x08,0x52,0x00,0x00,0x0c,0xe8,
-0xdd,0x00,0xf1,0x12,0x82,0xc0,0x00,0x00,0x0c,0x10,0x6b,0x5d,0x33,0x12,0xb0,0xd1,
-0x0c,0xab,0xea,0xa4,0x2b,0x0d,0x12,0xb0,0x2c,0x00,0x02,0xb0,0xd1,0x4e,0xee,0xfe,
-0xed,0x2b,0x0d,0x10,0x00,0x0d,0x00,0xf0,0x12,0x08,0xcd,0xfc,0xc6,0x2b,0x0d,0x10,
-0xb4,0x3c,0x17,0x72,0xb0,0xd1,0x0b,0x22,0xc0,0x67,0x02,0x0d,0x10,0xb2,0x2c,0x06,
-0x70,0x00,0xd1,0x0a,0x22,0xc7,0xd4,0x00,0x0e,0x10,0x1d,0x02,0x29,0xaf,0xb0,0x37,
-0x02,0xf4,0x19,0x0c,0xed,0xdd,0xf1,0x30,0x0e,0x0c,0x10,0x00,0xc1,0xa3,0x0e,0x0c,
-0xbb,0xbb,0xe1,0xa3,0x0e,0x0c,0x20,0xa0,0x00,0xa3,0x0e,0x0c,0x44,0xe4,0x40,0xa3,
-0x0e,0x0d,0xa9,0xe8,0xd2,0xa3,0x0e,0x0d,0xa0,0xd0,0xa2,0x06,0x00,0xf4,0x03,0x2a,
-0xa0,0xd0,0xb2,0x00,0x0e,0x76,0x80,0xd1,0x90,0x00,0x0e,0x51,0x00,0xd0,0x00,0x3f,
-0xe8,0x5d,0x08,0x11,0x30,0x01,0x03,0x10,0x4d,0x91,0x17,0x62,0x1e,0xee,0xfe,0xee,
-0xff,0xee,0x40,0x24,0xf5,0x04,0x20,0x04,0xec,0xce,0x70,0xc0,0x59,0x00,0x4a,0x00,
-0x77,0x0e,0x05,0x90,0x04,0xeb,0xbd,0x70,0xe0,0x0d,0x00,0x23,0xec,0xce,0x0d,0x00,
-0xe1,0x05,0x05,0x90,0x04,0xa0,0x07,0x70,0x00,0x69,0x00,0x4a,0x0c,0xd4,0x02,0x20,
-0x1d,0x03,0xcb,0x0d,0xf0,0x30,0x50,0x00,0x0e,0x0c,0x91,0x2d,0x10,0x20,0x0e,0x00,
-0x7d,0xd5,0x00,0xe0,0x0e,0x01,0x8c,0x8d,0x50,0xe0,0x0e,0x3e,0x61,0x24,0x40,0xe0,
-0x0e,0x00,0x04,0x98,0x90,0xe0,0x0e,0x25,0x58,0xb6,0x80,0xe0,0x0e,0x37,0x7e,0xc7,
-0x70,0xe0,0x0e,0x00,0x7e,0xf6,0x00,0xd0,0x0e,0x08,0xb5,0x99,0xb0,0x00,0x0e,0x69,
-0x04,0x90,0x30,0x00,0x0e,0xce,0x05,0x28,0x1e,0xe9,0xf1,0x00,0xf1,0x20,0x2d,0xdd,
-0xdd,0xdc,0x00,0x0e,0x04,0xbb,0xbb,0xb2,0x39,0x0e,0x06,0x80,0x00,0xc2,0x39,0x0e,
-0x06,0xb7,0x77,0xd2,0x39,0x0e,0x01,0x44,0x44,0x40,0x39,0x0e,0x0a,0xcc,0xcc,0xc8,
-0x39,0x0e,0x0d,0x00,0xd0,0x3b,0x39,0x0e,0x0d,0xcc,0xfc,0xdb,0x26,0x0c,0x00,0x70,
-0x00,0x0e,0x0d,0xbb,0xfb,0xcb,0x00,0x5d,0x0b,0x3a,0x39,0x0d,0xea,0xfc,0x0a,0x01,
-0x5b,0x0b,0xf6,0x31,0x1d,0x8c,0x30,0x71,0x0e,0x05,0xd5,0x92,0xc4,0xb2,0x0e,0x1b,
-0x52,0x93,0x31,0xb2,0x0e,0x00,0xe8,0x88,0xe0,0xb2,0x0e,0x00,0xea,0xaa,0xf0,0xb2,
-0x0e,0x01,0xc2,0x22,0xd0,0xb2,0x0e,0x03,0xd8,0x88,0x80,0xb2,0x0e,0x05,0xab,0xbb,
-0xb0,0x51,0x0e,0x0a,0x78,0x00,0xc1,0x00,0x0e,0x2b,0x4d,0xaa,0xe1,0x00,0x0e,0x01,
-0x49,0x00,0xc1,0x0e,0xa2,0x00,0x00,0x01,0x0d,0xb0,0x88,0x88,0x50,0x1e,0x00,0x00,
-0x08,0x9e,0x85,0x01,0xe0,0x5d,0x0b,0x40,0x4e,0xff,0xee,0xe5,0xe1,0x01,0xf0,0x12,
-0xc0,0x0a,0x40,0x02,0xc0,0x00,0x4a,0x00,0xa4,0x00,0x2c,0x00,0x07,0x80,0x0b,0x30,
-0x02,0xc4,0x70,0xc3,0x00,0xc2,0x17,0xcf,0xa5,0x2e,0x00,0x0e,0x11,0x84,0x00,0x0b,
-0x60,0x66,0x07,0x20,0x0a,0xc0,0x18,0x19,0x36,0x08,0xa0,0x08,0x45,0x01,0x13,0x3b,
-0x06,0x00,0xf0,0x17,0x05,0x77,0x76,0x2b,0xce,0xbb,0x4b,0x97,0x8e,0x03,0x7b,0x3b,
-0x5b,0x20,0x0e,0x00,0x68,0x0a,0x4b,0x20,0x0e,0x00,0x86,0x0b,0x3b,0x20,0x0e,0x00,
-0xa4,0x0c,0x2b,0x20,0x0e,0x00,0xc2,0x0d,0x1b,0x20,0xa0,0x12,0x50,0x0b,0x20,0x0e,
-0x05,0xa0,0x06,0x00,0xc0,0x0d,0x50,0x4c,0x0b,0xfe,0xfe,0x4b,0x0d,0xe5,0x0b,0x20,
-0x0e,0xcd,0x01,0x06,0xf7,0x00,0xf5,0x3d,0x47,0xb8,0x0a,0x30,0x00,0x1b,0xad,0x95,
-0x20,0xa3,0x00,0x03,0x99,0xdb,0x99,0x0a,0x30,0x00,0x02,0x2a,0x62,0x3e,0xfe,0xee,
-0x20,0xe7,0xc9,0x8c,0x0c,0x20,0xc1,0x0e,0xad,0xba,0xc0,0xe0,0x0d,0x10,0xc1,0xa5,
-0x1c,0x0e,0x00,0xd0,0x09,0x9d,0xb9,0x72,0xc0,0x0e,0x00,0xaa,0xdb,0xa8,0x88,0x00,
-0xe0,0x01,0x1a,0x51,0x1e,0x20,0x1d,0x02,0x68,0xdd,0xdf,0xa0,0x04,0xb0,0x27,0x64,
-0x22,0xc0,0x4d,0xe5,0xc4,0x03,0x17,0xa0,0xab,0x08,0x60,0x4f,0xee,0xee,0xee,0xf4,
-0x00,0x30,0x1f,0xf1,0x0c,0x0b,0x40,0x1e,0x8d,0xdd,0xdd,0x10,0xb3,0x00,0x13,0xb0,
-0x00,0xd1,0x0c,0x20,0x00,0x3b,0x00,0x0d,0x10,0xd1,0x00,0x03,0xfd,0xdd,0xf1,0x0f,
-0xdd,0x00,0x22,0x8e,0xa0,0xe6,0x14,0x30,0x63,0x00,0x2d,0xab,0x04,0xa1,0x40,0x00,
-0xae,0xee,0xee,0xee,0xb0,0x00,0x03,0x40,0xf0,0x01,0x01,0x07,0x01,0xf2,0x1f,0x9f,
-0xee,0xee,0xee,0xff,0x08,0xd1,0x00,0x20,0x00,0x0f,0x5d,0xb4,0x40,0xc1,0x80,0x0e,
-0x01,0xe0,0xac,0x70,0xd0,0x1e,0x00,0xe0,0x3e,0xa0,0xd0,0x1d,0x00,0xe2,0xd1,0x88,
-0xd0,0x2c,0x00,0xe4,0x30,0x01,0xd0,0x3c,0x00,0xfe,0xee,0xee,0xf0,0xb4,0x1a,0x20,
-0x88,0x00,0x7d,0x0a,0x05,0xb5,0x04,0x12,0x10,0x91,0x06,0x21,0x11,0xe0,0x8d,0x07,
-0xf0,0x0d,0x1e,0x00,0x01,0x00,0x02,0xf1,0x01,0xe0,0x02,0xe3,0x00,0xce,0x00,0x1e,
-0x00,0xc8,0x00,0xad,0xe0,0x01,0xe0,0xbb,0x00,0x1d,0x2e,0x00,0x1f,0xca,0x37,0x0a,
-0x20,0x04,0xf8,0x2d,0x00,0x20,0x19,0xfe,0x44,0x00,0x50,0xe3,0x92,0xe0,0x00,0x26,
-0xb5,0x06,0x10,0x00,0xbf,0x19,0xc0,0x00,0xf0,0x00,0x78,0x00,0x1e,0x00,0x0b,0xfe,
+0x00,0x7e,0x70,0x0a,0xc1,0x01,0xf3,0x20,0x19,0x30,0x00,0x00,0x94,0x0c,0x20,0x00,
+0x00,0x01,0x1a,0x61,0xc3,0x11,0x00,0x05,0xec,0xed,0xcf,0xdc,0xf0,0x00,0x59,0x09,
+0x40,0xc2,0x0e,0x00,0x05,0x90,0x95,0x0c,0x20,0xf0,0x00,0x5f,0xdf,0xed,0xfe,0xdf,
+0x00,0x05,0x90,0x94,0x0c,0x20,0xe0,0x1a,0x00,0xf4,0x0b,0x9f,0xfe,0xfe,0xef,0xee,
+0xfe,0x20,0x00,0x59,0x00,0x29,0x20,0x00,0x02,0xad,0x30,0x00,0x5d,0x90,0x03,0xd6,
+0x00,0x00,0x00,0x09,0x80,0xeb,0x00,0xf0,0x01,0x0a,0x10,0x00,0x0a,0x20,0x00,0x00,
+0x7b,0x00,0x08,0xa0,0x00,0x0d,0xdd,0xee,0xdf,0xd2,0x00,0xb1,0x06,0x80,0xa4,0x00,
+0x00,0x01,0xcc,0xde,0xce,0xdc,0xf0,0x0d,0x00,0x90,0x0f,0x00,0x2c,0xcc,0xee,0xcf,
+0xdc,0xfc,0x30,0x0d,0x00,0xf3,0x20,0x0e,0x00,0x03,0xcc,0xfe,0xce,0xfc,0xc0,0x00,
+0x01,0xbc,0x80,0xab,0xb1,0x00,0x06,0xd5,0x68,0x0a,0x45,0xd7,0x02,0x91,0x06,0x80,
+0xa4,0x01,0x82,0x00,0xee,0xff,0xef,0xfe,0xf8,0x00,0x0e,0x02,0xc0,0x49,0x06,0x80,
+0x00,0xe0,0x2c,0x04,0x90,0x68,0x0d,0x00,0xd9,0x02,0xf2,0x4c,0x26,0xa2,0x89,0x22,
+0xbf,0xbc,0xfb,0xde,0xbd,0xe8,0x1a,0x00,0x07,0x0d,0x00,0x11,0x07,0x0d,0x00,0x26,
+0x99,0xe4,0xb9,0x02,0xf0,0x14,0x2b,0x07,0x60,0x00,0x0b,0x60,0x09,0x70,0x2d,0x00,
+0x00,0x2e,0x11,0xfc,0xcc,0xdc,0xc3,0x00,0x73,0xae,0x11,0x3c,0x11,0x00,0x00,0x6d,
+0xe0,0x02,0xc0,0x00,0x00,0x0b,0x3f,0xdd,0xef,0x82,0x01,0x01,0x0d,0x00,0xf2,0x0d,
+0x78,0x0e,0x33,0x5d,0x33,0x00,0x0e,0x20,0xfa,0xab,0xea,0xa0,0x06,0xb0,0x0e,0x00,
+0x2c,0x00,0x00,0xe4,0x00,0xfe,0xee,0xfe,0xe8,0x02,0x00,0x0e,0x50,0x00,0xf2,0x05,
+0x1e,0x00,0x00,0x01,0x60,0x01,0xe0,0x01,0x70,0x3c,0x00,0x1e,0x00,0x1e,0x03,0xc0,
+0x01,0xe0,0x01,0xe0,0x0b,0x00,0x00,0xc6,0x02,0xf1,0x03,0xe0,0x51,0x00,0x1e,0x00,
+0x03,0x2c,0x30,0x01,0xe0,0x00,0x96,0xc3,0x00,0x1e,0x00,0x09,0x6c,0x0b,0x00,0x60,
+0xcf,0xee,0xff,0xee,0xef,0x60,0x3f,0x00,0x12,0x96,0x46,0x00,0xf0,0x28,0x9e,0xee,
+0xee,0xff,0x20,0x00,0x00,0x02,0x9a,0x20,0x0d,0x13,0x00,0xf3,0x05,0x2d,0xd2,0xc5,
+0x0e,0x06,0xa1,0xdd,0x11,0xa1,0xf8,0xb0,0x1d,0xd1,0x05,0xcf,0xb8,0x01,0xdd,0x3b,
+0x91,0xe0,0x9a,0x1d,0xd5,0x41,0x3e,0x00,0x83,0xdd,0x10,0x49,0x50,0x00,0x1d,0xdd,
+0xcc,0xcc,0xcc,0xcd,0xd0,0x3b,0x00,0x50,0x2d,0x00,0x01,0x70,0x01,0x4c,0x00,0xe0,
+0x9a,0x00,0x0d,0x40,0x00,0x00,0x2f,0x20,0x00,0x3d,0x00,0x00,0x0c,0x70,0x10,0x00,
+0x10,0x0c,0x0e,0x03,0xf0,0x03,0xc9,0x04,0xbb,0xff,0xff,0xff,0xf6,0xa0,0x00,0x00,
+0x5a,0x00,0x0b,0x40,0x00,0x00,0x08,0x70,0x64,0x03,0x80,0x00,0xe2,0x00,0x0d,0x20,
+0x00,0x00,0x9a,0xf8,0x02,0xc5,0x01,0x9c,0x00,0x00,0x2e,0x00,0x01,0xe8,0x00,0x0a,
+0xef,0x70,0xe1,0x03,0x50,0xe0,0x09,0xee,0xee,0xee,0xe5,0x00,0xf0,0x07,0x86,0x00,
+0xe0,0x02,0xe9,0xd7,0x09,0x50,0x0f,0x07,0xcf,0x51,0x00,0xa4,0x00,0xf0,0x00,0xe0,
+0x00,0x0c,0x30,0x0e,0x1a,0x00,0xf1,0x0b,0xe0,0x01,0xe0,0x00,0xe0,0x24,0x2d,0x00,
+0x1d,0x00,0x0f,0xbd,0x49,0x70,0x03,0xc0,0x04,0xd5,0x01,0xe1,0x00,0x5a,0x00,0x00,
+0x01,0xc7,0x0c,0x02,0x57,0xb8,0x00,0xbf,0xd2,0x00,0x01,0x00,0x10,0x0e,0x88,0x02,
+0x30,0x62,0x10,0xe0,0x45,0x01,0xf0,0x11,0x95,0x0e,0x00,0x07,0x92,0x21,0x09,0x50,
+0xe0,0x00,0xdb,0xbb,0xf0,0x95,0x0e,0x00,0x5a,0x00,0x3b,0x09,0x50,0xe0,0x0e,0x43,
+0x09,0x70,0x95,0x0e,0x00,0x33,0xd6,0xe1,0x1a,0x00,0x20,0x01,0xd9,0x27,0x00,0xf9,
+0x05,0x00,0x5d,0x10,0x00,0x00,0xe0,0x00,0x7e,0x20,0x00,0x00,0x0e,0x00,0x9a,0x10,
+0x00,0x00,0x9e,0xb0,0x00,0x01,0x00,0x22,0x06,0x70,0x8b,0x04,0xf0,0x12,0x05,0xef,
+0xfe,0xef,0x20,0xbc,0xdc,0x30,0x3c,0x00,0xc2,0x01,0x12,0xd0,0x04,0xb0,0x0d,0x10,
+0x00,0xa5,0x10,0x59,0x00,0xd1,0x00,0x4f,0x5a,0x07,0x70,0x0e,0x00,0x3f,0xfe,0xbd,
+0x00,0xf9,0x10,0x0e,0x6c,0x98,0x0d,0x10,0x0e,0x00,0x22,0xc0,0x24,0xc0,0x01,0xd0,
+0x00,0x2c,0x00,0xb5,0x00,0x3c,0x00,0x02,0xc0,0x9c,0x00,0x07,0x90,0x00,0x2c,0x1c,
+0x10,0x9e,0xb0,0x00,0xc4,0x1d,0x0e,0xdd,0xdf,0x30,0x20,0x1d,0x0e,0x00,0x0b,0x33,
+0xa0,0x06,0x00,0xf0,0x0a,0xcc,0xcf,0x33,0xa0,0x1d,0x00,0x97,0x00,0x03,0xa0,0x1d,
+0x00,0xab,0x88,0x23,0xa0,0x1d,0x00,0xd6,0x5c,0x43,0xa0,0x1d,0x00,0xd0,0x1e,0x00,
+0xf9,0x03,0x05,0xa0,0x0c,0x10,0x00,0x1d,0x1d,0x30,0x0e,0x00,0x00,0x1d,0x67,0x0b,
+0xd9,0x00,0x3e,0xe9,0xa9,0x00,0xf0,0x04,0x01,0x6d,0x70,0x00,0x1d,0x1a,0xdf,0xc5,
+0x00,0x20,0x1d,0x04,0x28,0x60,0x00,0xe0,0x1d,0x00,0x08,0x06,0x00,0xf0,0x10,0x3c,
+0xce,0xec,0xc1,0xe0,0x1d,0x01,0x1e,0xa1,0x10,0xe0,0x1d,0x00,0x7f,0xe8,0x00,0xe0,
+0x1d,0x01,0xd9,0x6a,0x80,0xe0,0x1d,0x0c,0x58,0x60,0x50,0xd0,0x1d,0x59,0xde,0x05,
+0x01,0x2a,0x00,0x20,0x00,0x2d,0x06,0x00,0x22,0x4f,0xe7,0x4d,0x04,0xb9,0x0d,0xdf,
+0xee,0xf4,0x11,0x0d,0x0d,0x0a,0x45,0x84,0x95,0x06,0x00,0xa8,0x5e,0x8d,0xab,0xca,
+0x95,0x0d,0x3e,0x5c,0x89,0xb8,0x18,0x00,0x11,0x85,0x06,0x00,0x10,0x00,0x06,0x00,
+0x10,0x94,0x06,0x00,0x42,0x4b,0xd1,0x0d,0xe8,0xe4,0x00,0xf0,0x1f,0x0d,0xdf,0xdd,
+0xd8,0x83,0x1d,0x00,0x5b,0x08,0x00,0xa4,0x1d,0x00,0xd1,0x07,0x90,0xa4,0x1d,0x09,
+0xec,0xcc,0xd4,0xa4,0x1d,0x01,0x11,0x60,0x22,0xa4,0x1d,0x01,0x14,0xc1,0x10,0xa4,
+0x1d,0x07,0xbc,0xeb,0xb3,0xa4,0x1d,0x00,0x02,0xc0,0x00,0x06,0x00,0xf3,0x01,0xc4,
+0x85,0x00,0x1d,0x07,0xad,0xeb,0x82,0x00,0x1d,0x08,0x52,0x00,0x00,0x0c,0xe8,0xdd,
+0x00,0xf1,0x12,0x82,0xc0,0x00,0x00,0x0c,0x10,0x6b,0x5d,0x33,0x12,0xb0,0xd1,0x0c,
+0xab,0xea,0xa4,0x2b,0x0d,0x12,0xb0,0x2c,0x00,0x02,0xb0,0xd1,0x4e,0xee,0xfe,0xed,
+0x2b,0x0d,0x10,0x00,0x0d,0x00,0xf0,0x12,0x08,0xcd,0xfc,0xc6,0x2b,0x0d,0x10,0xb4,
+0x3c,0x17,0x72,0xb0,0xd1,0x0b,0x22,0xc0,0x67,0x02,0x0d,0x10,0xb2,0x2c,0x06,0x70,
+0x00,0xd1,0x0a,0x22,0xc7,0xd4,0x00,0x0e,0x10,0x1d,0x02,0x29,0xaf,0xb0,0x37,0x02,
+0xf4,0x19,0x0c,0xed,0xdd,0xf1,0x30,0x0e,0x0c,0x10,0x00,0xc1,0xa3,0x0e,0x0c,0xbb,
+0xbb,0xe1,0xa3,0x0e,0x0c,0x20,0xa0,0x00,0xa3,0x0e,0x0c,0x44,0xe4,0x40,0xa3,0x0e,
+0x0d,0xa9,0xe8,0xd2,0xa3,0x0e,0x0d,0xa0,0xd0,0xa2,0x06,0x00,0xf3,0x03,0x2a,0xa0,
+0xd0,0xb2,0x00,0x0e,0x76,0x80,0xd1,0x90,0x00,0x0e,0x51,0x00,0xd0,0x00,0x3f,0xe8,
+0x4a,0x00,0x21,0x0b,0x30,0x01,0x03,0xc1,0x4d,0x00,0x04,0xc0,0x00,0x1e,0xee,0xfe,
+0xee,0xff,0xee,0x60,0xbb,0x00,0xf5,0x04,0x20,0x04,0xec,0xce,0x70,0xc0,0x59,0x00,
+0x4a,0x00,0x77,0x0e,0x05,0x90,0x04,0xeb,0xbd,0x70,0xe0,0x0d,0x00,0x23,0xec,0xce,
+0x0d,0x00,0xf5,0x01,0x05,0x05,0x90,0x04,0xa0,0x07,0x70,0x00,0x69,0x00,0x4a,0x0c,
+0xd4,0x02,0xee,0x50,0xa0,0x00,0xf0,0x31,0x05,0x50,0x00,0x0e,0x0c,0x91,0x2d,0x10,
+0x20,0x0e,0x00,0x7d,0xd5,0x00,0xe0,0x0e,0x01,0x8c,0x8d,0x50,0xe0,0x0e,0x3e,0x61,
+0x24,0x40,0xe0,0x0e,0x00,0x04,0x98,0x90,0xe0,0x0e,0x25,0x58,0xb6,0x80,0xe0,0x0e,
+0x37,0x7e,0xc7,0x70,0xe0,0x0e,0x00,0x7e,0xf6,0x00,0xd0,0x0e,0x08,0xb5,0x99,0xb0,
+0x00,0x0e,0x69,0x04,0x90,0x30,0x00,0x0e,0xce,0x05,0x28,0x1e,0xe9,0xf1,0x00,0xf1,
+0x20,0x2d,0xdd,0xdd,0xdc,0x00,0x0e,0x04,0xbb,0xbb,0xb2,0x39,0x0e,0x06,0x80,0x00,
+0xc2,0x39,0x0e,0x06,0xb7,0x77,0xd2,0x39,0x0e,0x01,0x44,0x44,0x40,0x39,0x0e,0x0a,
+0xcc,0xcc,0xc8,0x39,0x0e,0x0d,0x00,0xd0,0x3b,0x39,0x0e,0x0d,0xcc,0xfc,0xdb,0x26,
+0x0c,0x00,0xe9,0x00,0x0e,0x0d,0xbb,0xfb,0xcb,0x00,0x0e,0x0d,0x00,0x00,0x39,0x0d,
+0xea,0x78,0x02,0x20,0x02,0xd0,0x3b,0x03,0xf7,0x31,0x1d,0x8c,0x30,0x71,0x0e,0x05,
+0xd5,0x92,0xc4,0xb2,0x0e,0x1b,0x52,0x93,0x31,0xb2,0x0e,0x00,0xe8,0x88,0xe0,0xb2,
+0x0e,0x00,0xea,0xaa,0xf0,0xb2,0x0e,0x01,0xc2,0x22,0xd0,0xb2,0x0e,0x03,0xd8,0x88,
+0x80,0xb2,0x0e,0x05,0xab,0xbb,0xb0,0x51,0x0e,0x0a,0x78,0x00,0xc1,0x00,0x0e,0x2b,
+0x4d,0xaa,0xe1,0x00,0x0e,0x01,0x49,0x00,0xc1,0x0e,0xa2,0x00,0xf0,0x07,0xe0,0x00,
+0x00,0x88,0x88,0x50,0x1e,0x00,0x00,0x08,0x9e,0x85,0x01,0xe0,0x00,0x00,0x02,0xc0,
+0x4e,0xff,0xee,0xe5,0xe1,0x01,0xf0,0x12,0xc0,0x0a,0x40,0x02,0xc0,0x00,0x4a,0x00,
+0xa4,0x00,0x2c,0x00,0x07,0x80,0x0b,0x30,0x02,0xc4,0x70,0xc3,0x00,0xc2,0x17,0xcf,
+0xa5,0x2e,0x00,0x0e,0x11,0x84,0x00,0x0b,0x60,0x66,0x07,0x96,0x0a,0xc0,0x00,0x4c,
+0x00,0x00,0x08,0xa0,0x08,0x45,0x01,0x13,0x3b,0x06,0x00,0xf0,0x20,0x05,0x77,0x76,
+0x2b,0xce,0xbb,0x4b,0x97,0x8e,0x03,0x7b,0x3b,0x5b,0x20,0x0e,0x00,0x68,0x0a,0x4b,
+0x20,0x0e,0x00,0x86,0x0b,0x3b,0x20,0x0e,0x00,0xa4,0x0c,0x2b,0x20,0x0e,0x00,0xc2,
+0x0d,0x1b,0x20,0x0e,0x00,0xe0,0x0e,0x0b,0x20,0x0e,0x05,0xa0,0x06,0x00,0xc0,0x0d,
+0x50,0x4c,0x0b,0xfe,0xfe,0x4b,0x0d,0xe5,0x0b,0x20,0x0e,0xcd,0x01,0x06,0xf7,0x00,
+0xf5,0x3d,0x47,0xb8,0x0a,0x30,0x00,0x1b,0xad,0x95,0x20,0xa3,0x00,0x03,0x99,0xdb,
+0x99,0x0a,0x30,0x00,0x02,0x2a,0x62,0x3e,0xfe,0xee,0x20,0xe7,0xc9,0x8c,0x0c,0x20,
+0xc1,0x0e,0xad,0xba,0xc0,0xe0,0x0d,0x10,0xc1,0xa5,0x1c,0x0e,0x00,0xd0,0x09,0x9d,
+0xb9,0x72,0xc0,0x0e,0x00,0xaa,0xdb,0xa8,0x88,0x00,0xe0,0x01,0x1a,0x51,0x1e,0x20,
+0x1d,0x02,0x68,0xdd,0xdf,0xa0,0x04,0xb0,0x27,0x64,0x22,0xc0,0x4d,0xe5,0xc4,0x03,
+0x17,0xa0,0xab,0x08,0xf1,0x16,0x4f,0xee,0xee,0xee,0xf4,0x00,0x3e,0x40,0x00,0x00,
+0x0b,0x40,0x1e,0x8d,0xdd,0xdd,0x10,0xb3,0x00,0x13,0xb0,0x00,0xd1,0x0c,0x20,0x00,
+0x3b,0x00,0x0d,0x10,0xd1,0x00,0x03,0xfd,0xdd,0xf1,0x0f,0xdd,0x00,0x40,0x8e,0xa0,
+0x00,0x03,0xd5,0x02,0x30,0x63,0x00,0x2d,0xab,0x04,0xa1,0x40,0x00,0xae,0xee,0xee,
+0xee,0xb0,0x00,0x03,0x40,0xf0,0x01,0x01,0x07,0x01,0xf1,0x20,0x9f,0xee,0xee,0xee,
+0xff,0x08,0xd1,0x00,0x20,0x00,0x0f,0x5d,0xb4,0x40,0xc1,0x80,0x0e,0x01,0xe0,0xac,
+0x70,0xd0,0x1e,0x00,0xe0,0x3e,0xa0,0xd0,0x1d,0x00,0xe2,0xd1,0x88,0xd0,0x2c,0x00,
+0xe4,0x30,0x01,0xd0,0x3c,0x00,0xfe,0xee,0xee,0xf0,0x5a,0x81,0x00,0x20,0x88,0x00,
+0x7d,0x0a,0x05,0xb5,0x04,0x12,0x10,0x91,0x06,0x21,0x11,0xe0,0x8d,0x07,0xf0,0x0d,
+0x1e,0x00,0x01,0x00,0x02,0xf1,0x01,0xe0,0x02,0xe3,0x00,0xce,0x00,0x1e,0x00,0xc8,
+0x00,0xad,0xe0,0x01,0xe0,0xbb,0x00,0x1d,0x2e,0x00,0x1f,0xca,0x37,0x0a,0x20,0x04,
+0xf8,0x2d,0x00,0x20,0x19,0xfe,0x44,0x00,0x50,0xe3,0x92,0xe0,0x00,0x26,0xb5,0x06,
+0xf0,0x02,0x00,0x04,0xa0,0x01,0xe0,0x00,0xf0,0x00,0x78,0x00,0x1e,0x00,0x0b,0xfe,
 0xfd,0x20,0xdf,0x72,0x0a,0xa0,0xc0,0xd1,0x03,0xb0,0x1d,0x00,0x00,0xd1,0x04,0xa0,
-0x06,0x00,0x20,0x05,0x90,0x06,0x00,0x20,0x08,0x60,0x06,0x00,0xf1,0x03,0x0c,0x30,
+0x06,0x00,0x20,0x05,0x90,0x06,0x00,0x20,0x08,0x60,0x06,0x00,0xf1,0x05,0x0c,0x30,
 0x1d,0x00,0xc0,0xd1,0x4c,0x00,0x1e,0x02,0xc0,0xd3,0xd2,0x00,0x0a,0xdd,0x50,0xd1,
-0x84,0x00,0x10,0xde,0x60,0x11,0x20,0xe0,0xdd,0x01,0x00,0xf0,0x24,0x70,0xd1,0x03,
-0xaa,0xaa,0x20,0x00,0xd1,0x05,0xb0,0x0b,0x30,0x00,0xd1,0x05,0xd7,0x7d,0x30,0x00,
-0xd1,0x01,0x44,0x44,0x00,0x00,0xd1,0xab,0xba,0x6b,0xbb,0x00,0xd1,0xc0,0x0c,0x81,
-0x0e,0x00,0xd1,0xc4,0x5c,0x85,0x5e,0x00,0xd1,0x45,0x54,0x35,0x55,0x00,0xdb,0xbb,
-0xbc,0x15,0x01,0x38,0x18,0x15,0x20,0x76,0x01,0xd1,0x7d,0x13,0xb0,0x00,0x02,0x6b,
-0xe8,0x20,0x3b,0x00,0x00,0x97,0x5c,0x4b,0x01,0x21,0x02,0xc0,0x35,0x02,0x10,0x2c,
-0x0d,0x00,0x00,0xcc,0x03,0x50,0xef,0xee,0x70,0x00,0x4b,0x0b,0x17,0x00,0x00,0x11,
-0x00,0x1a,0x00,0x11,0xb5,0x27,0x00,0x11,0x4d,0x7f,0x01,0x20,0x4e,0x40,0x0d,0x00,
-0x24,0x0c,0x30,0x69,0x02,0x00,0x01,0x00,0xb0,0x62,0x00,0xd2,0x00,0x81,0x00,0x06,
-0xb0,0x0d,0x20,0x4c,0x71,0x24,0xf1,0x01,0xd2,0x0d,0x30,0x00,0x00,0x32,0x0d,0x20,
-0x40,0x00,0x03,0xee,0xee,0xfe,0xee,0xea,0x88,0x0b,0x02,0xe5,0x0d,0x02,0xa5,0x19,
-0x99,0xed,0xdd,0xd6,0x01,0x11,0x11,0xd3,0x11,0x11,0x1a,0x00,0x04,0x0d,0x00,0x40,
-0x94,0x00,0x00,0xc0,0x29,0x1d,0xf0,0x13,0x6a,0xbe,0xaa,0xa1,0x00,0x94,0x01,0x1a,
-0x41,0x1d,0x12,0xad,0xc8,0x05,0xa0,0x00,0xe0,0x03,0xb7,0x3a,0xd1,0x0b,0xd9,0x00,
-0x09,0x40,0x72,0x00,0x05,0x00,0x00,0x94,0x07,0x50,0x87,0x0f,0xf7,0x10,0x4a,0xed,
-0xeb,0xde,0xcb,0x00,0x94,0x0c,0x1b,0x05,0x72,0xa0,0x09,0x40,0xc0,0xc0,0xa3,0x39,
-0x00,0x94,0x87,0x0d,0x4c,0x04,0x80,0x09,0x5a,0x0c,0x9a,0x16,0xd4,0xb6,0x0e,0x01,
-0x07,0x00,0x12,0x2c,0x0d,0x00,0x35,0xfe,0xee,0xe0,0x0d,0x00,0x00,0x1a,0x00,0x11,
-0x01,0x8a,0x13,0x12,0xf7,0xe1,0x03,0x00,0x09,0x08,0x11,0x74,0x1a,0x00,0x31,0xd4,
-0xad,0x71,0x16,0x08,0x26,0x29,0x70,0x1a,0x00,0x00,0x05,0x00,0x10,0xfe,0x95,0x01,
-0x21,0x60,0x0e,0x5f,0x29,0x01,0x8b,0x0f,0x40,0xe2,0x00,0x0e,0x0e,0x39,0x17,0x81,
-0x01,0xd0,0xeb,0xbb,0xbb,0xf2,0x00,0x2c,0x0d,0x00,0xf0,0x0f,0x03,0xb0,0xbc,0xcf,
-0xcc,0xc2,0x00,0x59,0x01,0x60,0xd1,0x51,0x00,0x09,0x60,0xc5,0x0d,0x15,0xd1,0x00,
-0xe1,0xb8,0x00,0xd1,0x07,0xc0,0x16,0x03,0x06,0xdc,0xc4,0x00,0x30,0x00,0x38,0x01,
-0xf2,0x00,0xf0,0x21,0x7c,0x31,0x4d,0x60,0x00,0x00,0x9c,0xbb,0xa9,0x8a,0x60,0x00,
-0x0a,0x63,0x07,0x09,0x56,0x00,0x0a,0xeb,0xeb,0xbc,0xfb,0xca,0x00,0x10,0x3c,0x50,
-0x5c,0x40,0x40,0x03,0x9c,0x36,0xb2,0x2b,0xb5,0x02,0xb4,0x9b,0x60,0x68,0x02,0x93,
-0x00,0x01,0x38,0xc6,0xf2,0x12,0xe0,0xb9,0x40,0x3a,0xa0,0x00,0x00,0x02,0x59,0xcb,
-0x30,0x00,0x00,0x06,0xb7,0x63,0x0b,0x10,0x09,0x24,0x02,0xc0,0xd0,0x00,0x09,0x71,
-0x21,0x11,0x4b,0x00,0x00,0x2d,0x09,0x90,0x98,0x0a,0x40,0xb4,0x0a,0x82,0xe0,0xba,
-0x16,0x30,0x02,0xb6,0x00,0x28,0x04,0x11,0x8a,0xdf,0x07,0x21,0xad,0x00,0x26,0x03,
-0x11,0xa1,0x77,0x1d,0xb0,0x18,0xe6,0x00,0x01,0x7d,0xc3,0x00,0x03,0xbe,0xa2,0x29,
-0x46,0x00,0x11,0x16,0x96,0x14,0x11,0xd0,0x8e,0x0d,0x10,0x59,0xe9,0x05,0x11,0x90,
-0xbf,0x0c,0x80,0xcf,0x00,0xce,0xef,0x60,0x00,0x0e,0xb6,0x1a,0x17,0xf6,0x17,0x01,
-0xe2,0xd0,0x00,0x6a,0x00,0x00,0x6a,0x09,0xb0,0x1d,0x30,0x00,0x0d,0x40,0x0c,0x8c,
-0x60,0x00,0x07,0xc0,0x00,0x4f,0xd1,0x00,0x04,0xf3,0x03,0x9e,0x59,0xe8,0x30,0x55,
-0x05,0xd7,0x00,0x02,0x8c,0xe4,0x04,0x90,0x13,0x69,0x80,0x00,0x0b,0xee,0xdc,0xa8,
-0x52,0x8b,0x0b,0x03,0xbf,0x0b,0x00,0x01,0x00,0x11,0xdf,0xb9,0x03,0x30,0x0e,0x1c,
-0x20,0xba,0x09,0x40,0xf0,0x5a,0x00,0x1e,0x5c,0x05,0xf4,0x0e,0xc5,0x0b,0x70,0x00,
-0x03,0xc0,0x01,0xeb,0xa0,0x00,0x00,0x78,0x00,0x2c,0xf7,0x00,0x00,0x0d,0x33,0x9e,
-0x61,0xad,0x72,0x02,0xb1,0xc7,0x10,0x00,0x38,0xcf,0x1f,0xf0,0x18,0x1e,0xfd,0xef,
-0xb2,0x22,0x22,0x00,0x3a,0x02,0xc1,0xcb,0x88,0xe2,0x03,0xec,0xdc,0x05,0x80,0x0e,
-0x00,0x3b,0x02,0xc0,0x2b,0x03,0xb0,0x03,0xa0,0x2c,0x00,0xd0,0x87,0x00,0x3f,0xdd,
-0xc0,0x09,0x5d,0x10,0x0d,0x00,0xf0,0x05,0x3e,0xa0,0x00,0x3b,0x15,0xe8,0x00,0xf5,
-0x00,0x1d,0xfc,0xbd,0x40,0xab,0xd1,0x00,0x20,0x02,0xc0,0x8b,0xe1,0x16,0x53,0x2c,
-0x4a,0x00,0x07,0x60,0xcc,0x06,0x00,0x27,0x03,0x61,0x91,0xe3,0x33,0x33,0x33,0x6c,
-0xa1,0x1a,0x20,0xc1,0xe0,0x93,0x0e,0x0f,0x0b,0x00,0x04,0xa1,0x22,0x22,0x22,0x26,
-0xc1,0xfc,0xcc,0xcc,0xcc,0xdc,0x16,0x00,0x11,0xb0,0xa1,0x03,0x32,0xd0,0x00,0x0e,
-0xbf,0x0a,0x11,0xe0,0xc9,0x1d,0x09,0x0d,0x00,0x55,0x0d,0xfe,0xee,0xee,0xfe,0x0c,
-0x01,0x80,0x1b,0x10,0x1b,0x20,0x00,0x00,0x1d,0x70,0x48,0x03,0x85,0x3d,0x70,0x00,
-0x00,0x3e,0x50,0x1d,0x40,0x8a,0x02,0x04,0x3a,0x1c,0x15,0x60,0x69,0x02,0x00,0x76,
-0x02,0x50,0x0b,0xfe,0xef,0x80,0x2d,0xe7,0x11,0x10,0x68,0x0d,0x00,0x27,0x20,0x06,
-0x0d,0x00,0x20,0xee,0xee,0x7a,0x0b,0x15,0xa2,0x9d,0x02,0x11,0x3d,0xcf,0x00,0x32,
-0xfe,0x70,0x00,0x23,0x05,0x20,0x01,0xd3,0x5f,0x02,0x40,0xb6,0x00,0x3d,0x20,0x1c,
-0x22,0xf0,0x03,0x4e,0x20,0x9f,0xcd,0xde,0xed,0xcc,0x03,0x32,0x10,0x00,0x00,0x94,
+0x10,0x00,0x47,0x09,0x50,0xee,0xee,0xee,0xe0,0xdd,0x01,0x00,0xf0,0x29,0x70,0xd1,
+0x03,0xaa,0xaa,0x20,0x00,0xd1,0x05,0xb0,0x0b,0x30,0x00,0xd1,0x05,0xd7,0x7d,0x30,
+0x00,0xd1,0x01,0x44,0x44,0x00,0x00,0xd1,0xab,0xba,0x6b,0xbb,0x00,0xd1,0xc0,0x0c,
+0x81,0x0e,0x00,0xd1,0xc4,0x5c,0x85,0x5e,0x00,0xd1,0x45,0x54,0x35,0x55,0x00,0xdb,
+0xbb,0xbb,0xbb,0xbb,0xb0,0x22,0x01,0x00,0x15,0x20,0x76,0x01,0xd1,0x7d,0x13,0xb0,
+0x00,0x02,0x6b,0xe8,0x20,0x3b,0x00,0x00,0x97,0x5c,0x4b,0x01,0x21,0x02,0xc0,0x35,
+0x02,0x10,0x2c,0x0d,0x00,0x00,0xcc,0x03,0xc1,0xef,0xee,0x70,0x00,0x4b,0x00,0x04,
+0xb0,0x00,0x00,0x06,0x90,0x1a,0x00,0x11,0xb5,0x27,0x00,0x11,0x4d,0x7f,0x01,0x20,
+0x4e,0x40,0x0d,0x00,0x24,0x0c,0x30,0x69,0x02,0x00,0x01,0x00,0xf1,0x10,0x62,0x00,
+0xd2,0x00,0x81,0x00,0x06,0xb0,0x0d,0x20,0x4c,0x00,0x00,0x0d,0x40,0xd2,0x0d,0x30,
+0x00,0x00,0x32,0x0d,0x20,0x40,0x00,0x03,0xee,0xee,0xfe,0xee,0xea,0x88,0x0b,0x01,
+0x29,0x00,0xe1,0xd2,0x00,0x00,0x01,0xdd,0xdd,0xdf,0xed,0xdd,0xd6,0x01,0x11,0x11,
+0xd3,0x3e,0x0b,0x06,0x1a,0x00,0x04,0x0d,0x00,0xf6,0x3e,0x94,0x00,0x00,0xc0,0x00,
+0x00,0x09,0x40,0x6a,0xbe,0xaa,0xa1,0x00,0x94,0x01,0x1a,0x41,0x1d,0x12,0xad,0xc8,
+0x05,0xa0,0x00,0xe0,0x03,0xb7,0x3a,0xd1,0x0b,0xd9,0x00,0x09,0x40,0x72,0x00,0x05,
+0x00,0x00,0x94,0x07,0x50,0x00,0xd0,0x00,0x09,0x4a,0xed,0xeb,0xde,0xcb,0x00,0x94,
+0x0c,0x1b,0x05,0x72,0xa0,0x09,0x40,0xc0,0xc0,0xa3,0x39,0x00,0x94,0x87,0x0d,0x4c,
+0x04,0x80,0x09,0x5a,0x0c,0x9a,0x16,0xd4,0xc3,0x02,0x11,0xc0,0x07,0x00,0x12,0x2c,
+0x0d,0x00,0x35,0xfe,0xee,0xe0,0x0d,0x00,0x00,0x1a,0x00,0x20,0x01,0xff,0x01,0x00,
+0x12,0xf7,0xe1,0x03,0x00,0x09,0x08,0x11,0x74,0x1a,0x00,0x31,0xd4,0xad,0x71,0x16,
+0x08,0x26,0x29,0x70,0x1a,0x00,0x00,0x05,0x00,0x10,0xfe,0x95,0x01,0x31,0x60,0x0e,
+0x00,0x4f,0x0c,0xf1,0x05,0xe0,0xdc,0xcc,0xcc,0xe2,0x00,0x0e,0x0e,0x00,0x00,0x0c,
+0x20,0x01,0xd0,0xeb,0xbb,0xbb,0xf2,0x00,0x2c,0x0d,0x00,0xf0,0x0f,0x03,0xb0,0xbc,
+0xcf,0xcc,0xc2,0x00,0x59,0x01,0x60,0xd1,0x51,0x00,0x09,0x60,0xc5,0x0d,0x15,0xd1,
+0x00,0xe1,0xb8,0x00,0xd1,0x07,0xc0,0x16,0x03,0x06,0xdc,0xc4,0x00,0x30,0x00,0x38,
+0x01,0xf2,0x00,0xf0,0x34,0x7c,0x31,0x4d,0x60,0x00,0x00,0x9c,0xbb,0xa9,0x8a,0x60,
+0x00,0x0a,0x63,0x07,0x09,0x56,0x00,0x0a,0xeb,0xeb,0xbc,0xfb,0xca,0x00,0x10,0x3c,
+0x50,0x5c,0x40,0x40,0x03,0x9c,0x36,0xb2,0x2b,0xb5,0x02,0xb4,0x9b,0x60,0x68,0x02,
+0x93,0x00,0x01,0x38,0xc6,0x05,0x20,0x00,0x00,0xb9,0x40,0x3a,0xa0,0x00,0x00,0x02,
+0x59,0xcb,0x30,0x00,0x00,0x06,0xb7,0x30,0xa7,0x02,0x00,0x24,0x02,0xc0,0xd0,0x00,
+0x09,0x71,0x21,0x11,0x4b,0x00,0x00,0x2d,0x09,0x90,0x98,0x0a,0xb0,0xb4,0x0a,0x82,
+0xe0,0x00,0x00,0x04,0xc0,0x02,0xb6,0x00,0x28,0x04,0x11,0x8a,0xdf,0x07,0x21,0xad,
+0x00,0x26,0x03,0x10,0xa1,0xff,0x0a,0xc0,0xd9,0x18,0xe6,0x00,0x01,0x7d,0xc3,0x00,
+0x03,0xbe,0xa2,0x29,0x46,0x00,0x71,0x16,0x00,0x0f,0xff,0xff,0xff,0xd0,0x8e,0x0d,
+0x10,0x59,0xe9,0x05,0x11,0x90,0xbf,0x0c,0xf6,0x23,0xcf,0x00,0xce,0xef,0x60,0x00,
+0x0e,0xb6,0x00,0x00,0xe1,0x00,0x01,0xe2,0xd0,0x00,0x6a,0x00,0x00,0x6a,0x09,0xb0,
+0x1d,0x30,0x00,0x0d,0x40,0x0c,0x8c,0x60,0x00,0x07,0xc0,0x00,0x4f,0xd1,0x00,0x04,
+0xf3,0x03,0x9e,0x59,0xe8,0x30,0x55,0x05,0xd7,0x00,0x02,0x8c,0xe4,0x04,0x90,0x13,
+0x69,0x80,0x00,0x0b,0xee,0xdc,0xa8,0x52,0x8b,0x0b,0x03,0xbf,0x0b,0x00,0x01,0x00,
+0x11,0xdf,0xb9,0x03,0x30,0x0e,0x1c,0x20,0xba,0x09,0x40,0xf0,0x5a,0x00,0x1e,0x5c,
+0x05,0xf3,0x10,0xc5,0x0b,0x70,0x00,0x03,0xc0,0x01,0xeb,0xa0,0x00,0x00,0x78,0x00,
+0x2c,0xf7,0x00,0x00,0x0d,0x33,0x9e,0x61,0xad,0x72,0x02,0xb1,0xc7,0x10,0x00,0x38,
+0x90,0x00,0x29,0x0a,0xf0,0x17,0xfd,0xef,0xb2,0x22,0x22,0x00,0x3a,0x02,0xc1,0xcb,
+0x88,0xe2,0x03,0xec,0xdc,0x05,0x80,0x0e,0x00,0x3b,0x02,0xc0,0x2b,0x03,0xb0,0x03,
+0xa0,0x2c,0x00,0xd0,0x87,0x00,0x3f,0xdd,0xc0,0x09,0x5d,0x10,0x0d,0x00,0xf3,0x0e,
+0x3e,0xa0,0x00,0x3b,0x15,0xe8,0x00,0xf5,0x00,0x1d,0xfc,0xbd,0x40,0xab,0xd1,0x00,
+0x20,0x02,0xc0,0x8b,0x07,0xc1,0x00,0x00,0x2c,0x4a,0x00,0x07,0x60,0xcc,0x06,0x00,
+0x27,0x03,0xd0,0x91,0xe3,0x33,0x33,0x33,0x6c,0x1e,0x00,0x00,0x00,0x03,0xc1,0xe0,
+0x93,0x0e,0x0f,0x0b,0x00,0x04,0xa1,0x22,0x22,0x22,0x26,0xc1,0xfc,0xcc,0xcc,0xcc,
+0xdc,0x16,0x00,0x11,0xb0,0xa1,0x03,0x32,0xd0,0x00,0x0e,0xbf,0x0a,0x10,0xe0,0x0e,
+0x04,0x0a,0x0d,0x00,0x55,0x0d,0xfe,0xee,0xee,0xfe,0x0c,0x01,0x80,0x1b,0x10,0x1b,
+0x20,0x00,0x00,0x1d,0x70,0x48,0x03,0x85,0x3d,0x70,0x00,0x00,0x3e,0x50,0x1d,0x40,
+0x8a,0x02,0x31,0x00,0x00,0x1f,0x88,0x02,0x15,0x60,0x69,0x02,0x00,0x76,0x02,0xa0,
+0x0b,0xfe,0xef,0x80,0x2d,0x00,0x00,0xb2,0x00,0x68,0x0d,0x00,0x27,0x20,0x06,0x0d,
+0x00,0x20,0xee,0xee,0x7a,0x0b,0x15,0xa2,0x9d,0x02,0x11,0x3d,0xcf,0x00,0x32,0xfe,
+0x70,0x00,0x23,0x05,0x20,0x01,0xd3,0x5f,0x02,0xf0,0x0b,0xb6,0x00,0x3d,0x20,0x00,
+0x98,0x00,0x00,0x4e,0x20,0x9f,0xcd,0xde,0xed,0xcc,0x03,0x32,0x10,0x00,0x00,0x94,
 0x03,0x33,0x33,0x33,0x30,0x21,0x04,0x40,0xbf,0x30,0x0d,0x10,0x2a,0x0e,0x10,0xd1,
-0x05,0x0f,0x70,0x0d,0xed,0xdd,0xdd,0xf3,0x00,0xd2,0x0b,0x00,0x06,0x5a,0x17,0x02,
-0x99,0x00,0x10,0x00,0x89,0x1c,0x81,0xac,0xea,0xaa,0xaa,0xa1,0x03,0x34,0xd7,0x72,
-0x18,0x12,0x4d,0x2c,0x0a,0x11,0x60,0x5f,0x1b,0xe0,0xff,0xee,0xee,0xef,0x30,0x07,
-0xea,0x70,0x00,0x00,0xc3,0x04,0xd1,0x77,0x41,0x00,0x31,0x01,0x07,0x70,0x3d,0x00,
-0x20,0x7e,0xdd,0x98,0x15,0x00,0x0d,0x00,0x16,0xb3,0x13,0x02,0x21,0x08,0x90,0x6f,
-0x0a,0x20,0xdd,0x40,0x0c,0x00,0xf7,0x03,0xb0,0x3e,0x60,0x00,0x00,0x4d,0x80,0x00,
-0x1b,0xc4,0x00,0xce,0xbd,0xdd,0xdd,0xe7,0xe9,0x04,0x83,0x05,0x01,0xd3,0x1e,0x21,
-0xdd,0xe0,0x6b,0x03,0x11,0x1e,0x2a,0x10,0x20,0x01,0xe0,0x0e,0x06,0x24,0xdd,0xee,
-0x0d,0x00,0x01,0x22,0x05,0x01,0x7e,0x1c,0x63,0x1d,0xd1,0xcd,0xdd,0xdd,0x81,0x0b,
-0x00,0xf0,0x0e,0x3d,0xdd,0xdc,0x01,0xdd,0x14,0x90,0x00,0xe0,0x1d,0xd1,0x49,0x00,
-0x0e,0x01,0xdd,0x14,0xea,0xaa,0xe0,0x1d,0xd1,0x4a,0x22,0x22,0x01,0xdd,0x10,0x20,
-0x21,0x00,0x44,0x00,0x00,0x03,0xee,0x67,0x0d,0x01,0x5b,0x0f,0xf0,0x05,0x03,0xfe,
-0xcc,0xcc,0x80,0x07,0xd3,0x11,0x12,0xe4,0x0c,0xc4,0x20,0x00,0xb9,0x00,0x40,0x4e,
-0x41,0xba,0xbb,0x0e,0x10,0xe7,0xff,0x17,0xb0,0xf6,0x33,0x32,0x29,0xef,0xbb,0xbb,
-0xbb,0xe1,0x41,0xd1,0x89,0x00,0x20,0x0d,0x10,0x7b,0x00,0xa1,0xdd,0xcc,0xcc,0xde,
-0x00,0x0d,0x21,0x11,0x12,0xe0,0xe7,0x02,0x41,0x90,0x00,0x0c,0xde,0xe7,0x02,0x03,
-0x1a,0x0f,0x20,0x11,0x11,0xca,0x2d,0x10,0xfd,0x98,0x03,0x23,0x40,0x1e,0xcf,0x01,
-0xe0,0xbb,0xbb,0xbb,0xb2,0x00,0x3c,0x0e,0x32,0x22,0x2d,0x20,0x06,0xa0,0xe0,0x8c,
-0x14,0x11,0xb6,0x2d,0x04,0xcb,0x3f,0x10,0xec,0xcc,0xcc,0xf2,0x03,0x80,0x0e,0x21,
-0x11,0x1c,0x82,0x1e,0x02,0x2d,0x01,0x40,0xe3,0x00,0x00,0x0c,0xe0,0x1e,0x80,0xda,
-0xd2,0x11,0x11,0x11,0x14,0xbd,0x10,0xe5,0x07,0xf0,0x09,0xd1,0x0f,0xdd,0xde,0x03,
-0xbd,0x10,0xd0,0x00,0xe0,0x3b,0xd1,0x0d,0x00,0x0e,0x03,0xbd,0x10,0xfc,0xcc,0xe0,
-0x3b,0xd1,0x0e,0x75,0x23,0x20,0x10,0x20,0x21,0x00,0xf1,0x00,0x00,0x00,0x09,0xfe,
-0x60,0x1e,0xee,0xee,0xff,0xee,0xee,0x10,0x00,0x00,0x2d,0xad,0x01,0xf0,0x06,0x6e,
+0x05,0x0f,0x70,0x0d,0xed,0xdd,0xdd,0xf3,0x00,0xd2,0x0b,0x00,0x05,0xb2,0x00,0x12,
+0xc3,0x99,0x00,0x00,0x4f,0x00,0xc1,0xaa,0xac,0xea,0xaa,0xaa,0xa1,0x03,0x34,0xd7,
+0x33,0x33,0x33,0x10,0x04,0x00,0x4d,0x02,0x01,0xad,0x00,0xf0,0x00,0x07,0xff,0xee,
+0xee,0xef,0x30,0x07,0xea,0x70,0x00,0x00,0xc3,0x04,0xd1,0x77,0x41,0x00,0x31,0x01,
+0x07,0x70,0x3d,0x00,0xc0,0x7e,0xdd,0xdd,0xdf,0x30,0x00,0x07,0x70,0x00,0x00,0xb3,
+0x00,0x14,0x00,0x01,0x00,0x20,0x08,0x90,0x06,0x00,0x30,0x06,0xdd,0x40,0x0c,0x00,
+0xf1,0x03,0xb0,0x3e,0x60,0x00,0x00,0x4d,0x80,0x00,0x1b,0xc4,0x00,0xce,0xbd,0xdd,
+0xdd,0xe7,0xe9,0x04,0x24,0x00,0x13,0x10,0x2c,0x00,0xf4,0x09,0x3f,0xdd,0xdd,0xdd,
+0xe0,0x00,0x03,0xc0,0x00,0x00,0x1e,0x00,0x00,0x3c,0x00,0x00,0x01,0xe0,0x00,0x03,
+0xfd,0xdd,0xdd,0xee,0x0d,0x00,0x60,0xde,0xee,0xee,0xee,0xee,0xdd,0x2e,0x00,0x63,
+0x1d,0xd1,0xcd,0xdd,0xdd,0x81,0x0b,0x00,0xf0,0x0e,0x3d,0xdd,0xdc,0x01,0xdd,0x14,
+0x90,0x00,0xe0,0x1d,0xd1,0x49,0x00,0x0e,0x01,0xdd,0x14,0xea,0xaa,0xe0,0x1d,0xd1,
+0x4a,0x22,0x22,0x01,0xdd,0x10,0x20,0x21,0x00,0x53,0x00,0x00,0x03,0xee,0x80,0x64,
+0x00,0xf0,0x1e,0x05,0xd0,0x00,0x00,0x00,0x03,0xfe,0xcc,0xcc,0x80,0x07,0xd3,0x11,
+0x12,0xe4,0x0c,0xc4,0x20,0x00,0xb9,0x00,0x40,0x4e,0x41,0xba,0x00,0x00,0x00,0x3e,
+0xe7,0x00,0x00,0x00,0x5c,0xf6,0x33,0x32,0x29,0xef,0xbb,0xbb,0xbb,0xe1,0x41,0xd1,
+0x89,0x00,0x20,0x0d,0x10,0x7b,0x00,0xf1,0x0a,0xdd,0xcc,0xcc,0xde,0x00,0x0d,0x21,
+0x11,0x12,0xe0,0x00,0x00,0x00,0x13,0x69,0x90,0x00,0x0c,0xde,0xdc,0xa8,0x52,0x00,
+0x00,0xf0,0x55,0x00,0xe1,0x0f,0x11,0x11,0x11,0x11,0x10,0x00,0xfd,0xdd,0xdd,0xdd,
+0xdd,0x40,0x1e,0x13,0x00,0xf5,0x18,0x02,0xd0,0xbb,0xbb,0xbb,0xb2,0x00,0x3c,0x0e,
+0x32,0x22,0x2d,0x20,0x06,0xa0,0xe0,0x00,0x00,0xc2,0x00,0xb6,0x0e,0x00,0x00,0x0c,
+0x20,0x3f,0x10,0xec,0xcc,0xcc,0xf2,0x03,0x80,0x0e,0x21,0x11,0x1c,0x20,0x28,0x01,
+0x07,0x2d,0x01,0xf0,0x00,0xe3,0x00,0x00,0x0c,0xdd,0xdf,0xdd,0xdd,0xda,0xd2,0x11,
+0x11,0x11,0x14,0xbd,0xe5,0x00,0xf0,0x10,0x3b,0xd1,0x0f,0xdd,0xde,0x03,0xbd,0x10,
+0xd0,0x00,0xe0,0x3b,0xd1,0x0d,0x00,0x0e,0x03,0xbd,0x10,0xfc,0xcc,0xe0,0x3b,0xd1,
+0x0e,0x00,0x00,0x03,0xbd,0x10,0x20,0x21,0x00,0xf0,0x01,0x00,0x00,0x09,0xfe,0x60,
+0x1e,0xee,0xee,0xff,0xee,0xee,0x10,0x00,0x00,0x2d,0x60,0x4a,0x00,0xf0,0x06,0x6e,
 0xf2,0xa3,0x00,0x00,0x05,0xdb,0x1f,0x05,0xcb,0x10,0x3e,0xc4,0x00,0xf0,0x00,0x6e,
-0x20,0x30,0x00,0x0d,0x70,0x01,0x50,0x9d,0xdd,0xdd,0xdd,0xa0,0xee,0x30,0x00,0x55,
-0x08,0x11,0xa4,0x6d,0x21,0xc2,0x0a,0xcb,0xbb,0xbb,0xcc,0x00,0x00,0xa6,0x22,0x22,
-0x25,0xb0,0x6e,0x16,0x00,0xc6,0x00,0x20,0xdc,0x50,0x34,0x01,0x10,0xd3,0x7f,0x21,
-0xf1,0x03,0x4b,0xc2,0xb7,0x07,0xe8,0x20,0x6c,0x40,0x00,0x83,0x01,0x8b,0x00,0x0a,
-0xdd,0xdd,0xde,0x90,0x96,0x16,0x10,0xd1,0x20,0x1f,0x80,0x23,0xe6,0x20,0x00,0x00,
-0xdb,0xaa,0xaa,0x6e,0x49,0x01,0x65,0x02,0x02,0x71,0x02,0x60,0x00,0x0d,0x32,0x22,
-0x22,0xd3,0x48,0x00,0x15,0x90,0xfc,0x05,0x00,0x52,0x05,0x31,0xf1,0x00,0xf0,0xae,
-0x0f,0x20,0xf1,0x11,0x8c,0x1b,0x00,0x64,0x03,0x12,0xc0,0x16,0x21,0xe0,0x02,0xc6,
-0xfe,0xee,0xee,0xf4,0x04,0xb6,0x80,0x00,0x00,0xa4,0x09,0x76,0x06,0x00,0x20,0x1f,
-0x26,0x12,0x00,0x20,0x49,0x06,0x0c,0x00,0x04,0x92,0x0a,0x20,0x10,0xb4,0x95,0x00,
-0x20,0xc0,0x0b,0x54,0x02,0x71,0xce,0xee,0xfe,0xee,0xe3,0x00,0x8b,0xa4,0x0a,0x20,
-0x06,0x10,0x59,0x12,0x11,0x02,0xa8,0x1f,0x14,0xe2,0x53,0x01,0x70,0xee,0xee,0xee,
-0xe9,0x00,0x00,0x86,0xaf,0x31,0x00,0x11,0x0c,0x00,0xb6,0x11,0xf0,0x0f,0x8d,0xbb,
-0xbb,0xbd,0xa0,0x00,0x08,0x82,0x22,0x22,0x6a,0x00,0x00,0x25,0x8d,0x30,0x00,0x00,
-0x0a,0xbd,0x91,0x0c,0xee,0xed,0x00,0x08,0x60,0x0e,0x10,0x1e,0x06,0x00,0xb0,0x00,
-0x0e,0x1e,0xef,0xfe,0x9e,0x00,0x0e,0x00,0x1f,0xa0,0xb5,0x0d,0xd0,0x9d,0xc9,0x0e,
-0x00,0x0e,0x03,0xc8,0x69,0x5e,0x00,0x0e,0x1d,0x38,0x1e,0x00,0x60,0x26,0x08,0x60,
-0x0e,0xdc,0xde,0x2a,0x00,0xf0,0x10,0x21,0x2e,0x00,0x08,0x60,0x02,0x00,0x01,0xdc,
-0xcc,0xd0,0xfc,0xcc,0xed,0xba,0xbd,0x0f,0xaa,0xbe,0xd1,0x01,0xd0,0xe0,0x01,0xed,
-0xcc,0xcd,0x0f,0xbb,0xce,0xd1,0x4d,0x03,0xf0,0x0e,0xed,0x10,0xcc,0xcc,0xa0,0x1e,
-0xd1,0x0d,0x00,0x1d,0x01,0xed,0x10,0xd0,0x01,0xd0,0x1e,0xd1,0x0f,0xdd,0xdd,0x01,
-0xed,0x10,0xa0,0x00,0x00,0x2e,0xd1,0x8d,0x02,0x10,0x80,0xcc,0x11,0x00,0xa1,0x02,
-0x01,0x61,0x18,0xf0,0x0a,0x0a,0xde,0xee,0x14,0xc3,0x33,0x00,0xb3,0x00,0xc1,0x8c,
-0xae,0xb0,0x0b,0x41,0x1c,0x2e,0x80,0xb2,0x00,0xbc,0xcc,0xc7,0xcc,0x0e,0xaf,0x1d,
-0xf4,0x15,0x11,0xc4,0xb0,0x00,0xda,0xdc,0xe3,0x07,0xd6,0x00,0x0e,0xa2,0x09,0x30,
-0x3f,0x00,0x02,0xc9,0x20,0x93,0x0a,0xe6,0x00,0x87,0x9d,0xce,0x47,0xb1,0xd3,0x06,
-0x29,0x20,0x98,0xc1,0x03,0xc0,0x30,0x18,0xf0,0x28,0xda,0xaf,0x0e,0xaa,0xd5,0x00,
-0x3b,0x33,0xe0,0xe3,0x3a,0x50,0x01,0x66,0x66,0x05,0x66,0x62,0x00,0x0e,0xcc,0xcf,
-0xcc,0xcf,0x00,0x00,0xe1,0x11,0xf1,0x11,0xf0,0x00,0x0e,0xaa,0xaf,0xaa,0xaf,0x00,
-0x00,0xe6,0x66,0xf6,0x66,0xf0,0x00,0x04,0x44,0x5f,0x44,0x44,0x00,0x2d,0xdd,0xdd,
-0xfd,0xa1,0x17,0x08,0xdf,0x11,0xf8,0x05,0x55,0x53,0x6e,0xdf,0xed,0xa0,0xe7,0x9a,
-0x67,0x09,0x40,0x00,0xd0,0x3a,0x6e,0xce,0xdc,0x60,0xd0,0x3a,0x0c,0x00,0xf3,0x13,
-0x69,0x4b,0x74,0x40,0xfc,0xda,0x26,0x66,0x86,0xd2,0xe1,0x11,0x93,0x5a,0x55,0xc1,
-0x70,0x00,0xc1,0x98,0x27,0xd0,0x00,0x04,0x80,0xa2,0x20,0xd0,0x00,0x03,0x10,0x00,
-0x8d,0x70,0x98,0x07,0xf0,0x03,0xfd,0xde,0x0a,0xdd,0xe8,0x00,0x2b,0x00,0xe0,0xa3,
-0x05,0x80,0x02,0xfd,0xdf,0x0a,0xdd,0xe8,0x83,0x13,0xf0,0x14,0x07,0x91,0x00,0x0b,
-0xbb,0xbf,0xcb,0xbe,0xdb,0x50,0x22,0x8d,0x32,0x2b,0xa2,0x21,0x01,0x9c,0x10,0x00,
-0x09,0xc5,0x01,0xef,0xdd,0xf0,0xbd,0xde,0xd7,0x00,0xe0,0x0d,0x0b,0x20,0x86,0x87,
-0x17,0xb0,0xb2,0x08,0x60,0x00,0xed,0xde,0x0b,0xdd,0xe6,0x00,0xef,0x39,0x05,0x20,
-0xee,0x10,0x7a,0x05,0xf1,0x13,0xe1,0x02,0x22,0x22,0x01,0xee,0x10,0xfb,0xbb,0xf0,
-0x1e,0xe1,0x0e,0x00,0x0f,0x01,0xee,0x10,0xe0,0x00,0xf0,0x1e,0xe1,0x0f,0xbb,0xbf,
-0x01,0xee,0x10,0x11,0x11,0x10,0x1e,0xe1,0xec,0x09,0x00,0x97,0x03,0x20,0xde,0xe2,
-0x83,0x00,0x20,0xe0,0xed,0x0b,0x00,0x10,0xee,0xb2,0x05,0x20,0x0e,0xe0,0xe5,0x00,
-0x70,0xee,0x3d,0xdd,0xfd,0xdd,0x3e,0xe0,0x50,0x05,0xf0,0x08,0xee,0x00,0x08,0xc9,
-0x00,0x0e,0xe0,0x02,0xd0,0x7a,0x00,0xee,0x04,0xd4,0x00,0x89,0x0e,0xe0,0xb3,0x00,
-0x00,0x81,0xee,0x33,0x06,0x71,0xbe,0xe1,0x11,0x11,0x11,0x12,0xe0,0x80,0x04,0xf0,
-0x05,0xed,0x10,0x00,0xb0,0x00,0x1e,0xd1,0x11,0x1e,0x11,0x11,0xed,0x1a,0xaa,0xfa,
-0xaa,0x1e,0xd1,0x00,0x0e,0xe4,0x01,0x40,0xfc,0xcc,0xf0,0x1e,0x9b,0x03,0xd1,0x01,
-0xed,0x10,0xe7,0x77,0xf0,0x1e,0xd1,0x03,0x33,0x33,0x01,0xed,0x3d,0x00,0x62,0xd4,
-0x33,0x33,0x33,0x34,0xe0,0xbd,0x04,0xf0,0x5a,0x00,0x1b,0x00,0x00,0x1d,0xd0,0x1c,
-0xcb,0xbf,0x71,0xdd,0x3d,0x9b,0x19,0xa0,0x1d,0xd1,0x10,0xaf,0xc1,0x01,0xdd,0x5a,
-0xd8,0x16,0xdc,0x5d,0xd3,0x30,0xaa,0x60,0x22,0xdd,0x00,0x63,0x16,0x10,0x1d,0xd0,
-0x15,0x8b,0xc9,0x11,0xdd,0x43,0x33,0x33,0x73,0x4d,0xda,0xaa,0xaa,0xaa,0xaa,0xd0,
-0xed,0xdd,0xde,0xee,0xde,0xde,0x00,0x00,0x76,0x67,0x1d,0xe2,0x99,0x9c,0xc9,0xa3,
-0xde,0x02,0x22,0x59,0x23,0x1d,0xe0,0xc9,0xe2,0xa5,0x71,0xde,0x0a,0x0b,0x0c,0xb1,
-0x1d,0xe0,0x79,0x90,0xb8,0x01,0xde,0x27,0x99,0x9d,0x85,0x4d,0xe1,0x20,0x4a,0x09,
-0xd2,0xde,0x37,0x00,0x20,0xad,0xe3,0x7a,0x00,0x11,0xd0,0x10,0x03,0xf1,0x29,0xde,
-0x02,0x8b,0xc8,0x81,0x1d,0xe0,0x22,0xd3,0x2b,0x41,0xde,0x07,0x77,0x77,0x77,0x3d,
-0xe0,0x2d,0x88,0x8b,0x61,0xde,0x01,0xb8,0x8a,0xa5,0x1d,0xe0,0x89,0x8a,0xe8,0x83,
-0xde,0x05,0x70,0x2b,0x00,0x1d,0xe0,0x59,0x9a,0xe9,0x92,0xde,0x33,0x33,0x47,0x33,
-0x4d,0xea,0xaa,0xaa,0xaa,0xab,0xd0,0x31,0x01,0xf8,0x1d,0xde,0x02,0x86,0x66,0x80,
-0x1d,0xe0,0x4c,0x88,0x8e,0x01,0xde,0x05,0x66,0x66,0x63,0x1d,0xe0,0xd4,0x44,0x48,
-0x81,0xde,0x0d,0x88,0x88,0xb8,0x1d,0xe0,0xd7,0x77,0x7a,0x81,0xde,0x08,0xbb,0x9c,
-0xa5,0x1d,0xe1,0x97,0x00,0x28,0x81,0x7a,0x00,0x10,0xed,0x7a,0x01,0xf0,0x1e,0xee,
-0x04,0x97,0x77,0x93,0x0e,0xe0,0x6c,0x99,0x9d,0x40,0xee,0x25,0x55,0xe5,0x55,0x2e,
-0xe3,0x55,0x5e,0x55,0x52,0xee,0x0c,0x99,0x99,0xaa,0x0e,0xe0,0xc0,0xb7,0xa2,0xa0,
-0xee,0x0c,0x0a,0x89,0x2a,0x0e,0xe0,0x98,0x88,0x89,0x80,0xee,0x3d,0x00,0x20,0xae,
-0xe3,0xe9,0x1e,0x20,0xe0,0x00,0xa3,0x24,0x01,0x40,0x22,0x00,0x09,0x2b,0x00,0xd8,
-0x04,0x42,0xee,0x20,0x00,0x5c,0x16,0x08,0x30,0x30,0x03,0xa0,0xf8,0x28,0x00,0x9a,
-0x0a,0x91,0x0b,0xf7,0x2e,0xee,0xfe,0xe9,0x04,0xb7,0x70,0xa7,0x0a,0x11,0x77,0x10,
-0x07,0x19,0x07,0x0d,0x00,0x53,0x79,0xee,0xef,0xee,0xe2,0x68,0x06,0x30,0x08,0x50,
-0x00,0xbb,0x13,0x40,0x85,0x01,0x30,0xc2,0x0d,0x00,0xf1,0x20,0x39,0x0c,0x23,0x80,
-0x3e,0xff,0xd3,0x91,0xde,0xbe,0x10,0x08,0x50,0x4e,0xee,0x30,0xd1,0x00,0x85,0x5f,
-0xb1,0xc2,0x0d,0x10,0x08,0x51,0x59,0x0c,0x20,0xd1,0x00,0x86,0x53,0x90,0xc3,0x1e,
-0x00,0x5c,0xe9,0x49,0x0a,0x4b,0x70,0x1b,0x50,0x03,0x90,0x16,0x05,0x21,0x3b,0x00,
-0x27,0x1e,0x34,0xce,0xdd,0xed,0xbe,0x05,0x21,0x09,0x40,0x44,0x0b,0x11,0x94,0x64,
-0x25,0x02,0x0d,0x00,0xf0,0x08,0x38,0xdb,0x84,0x90,0x4b,0x00,0x02,0x5c,0x85,0x4b,
-0x04,0xc2,0x21,0x00,0x94,0x04,0xb0,0x4e,0xbb,0x50,0x09,0x40,0x4b,0x27,0x00,0xf0,
-0x02,0x95,0x65,0xb0,0x4b,0x00,0x00,0x4d,0xe7,0x5b,0x04,0xb0,0x00,0x5b,0x50,0x04,
-0xb0,0x4b,0x99,0x02,0x60,0x7c,0x26,0xc2,0x22,0x00,0x00,0x2f,0x02,0x14,0x70,0x55,
-0x00,0x11,0x50,0x36,0x20,0x31,0x95,0x00,0x2d,0x0d,0x00,0xf1,0x22,0x0b,0xee,0xee,
-0xf3,0x3e,0xff,0xd7,0xb0,0x00,0x0b,0x30,0x09,0x50,0xc4,0x50,0x00,0xb2,0x00,0x95,
-0x00,0x0b,0x80,0x0c,0x20,0x09,0x50,0x00,0x0b,0x30,0xc1,0x00,0x96,0x73,0x00,0x2a,
-0x6d,0x00,0x1b,0xf8,0x12,0xac,0x40,0xe0,0x2e,0x91,0x04,0xe6,0x00,0x0e,0x1f,0x17,
-0x21,0x04,0xb0,0x5a,0x0c,0x18,0xe4,0x65,0x06,0xf1,0x08,0x1c,0x00,0x6e,0xfd,0xfe,
-0x58,0x51,0xc0,0x00,0x3a,0x0b,0x20,0x85,0x1c,0x00,0xbe,0xfd,0xfe,0x98,0x51,0xc0,
-0x00,0x77,0x0d,0x00,0xe1,0x0d,0x20,0xb2,0x02,0x12,0xc0,0x0a,0x70,0x0a,0x40,0x0a,
-0xd9,0x00,0x10,0x55,0x05,0x41,0x00,0xbe,0xee,0xfe,0x3f,0x01,0x20,0x0b,0x40,0x9d,
-0x2b,0x51,0x11,0xb5,0x11,0x11,0x11,0x39,0x28,0x31,0xc7,0x00,0x1c,0x10,0x01,0xf1,
-0x16,0xcc,0xfc,0x80,0x3a,0x00,0x00,0x01,0x2d,0x10,0x6a,0xd8,0x80,0x06,0xab,0xfa,
+0x20,0x30,0x00,0x0d,0x70,0x01,0xf0,0x10,0x9d,0xdd,0xdd,0xdd,0xa0,0x00,0x0a,0x40,
+0x00,0x00,0x4c,0x00,0x00,0xa4,0x00,0x00,0x04,0xc0,0x00,0x0a,0xcb,0xbb,0xbb,0xcc,
+0x00,0x00,0xa6,0x22,0x22,0x25,0xb0,0x23,0x01,0x11,0xa0,0xc6,0x00,0x20,0xdc,0x50,
+0x34,0x01,0xf1,0x07,0xd3,0x0a,0x90,0x00,0x00,0x4b,0xc2,0xb7,0x07,0xe8,0x20,0x6c,
+0x40,0x00,0x83,0x01,0x8b,0x00,0x0a,0xdd,0xdd,0xde,0xad,0x00,0xf0,0x01,0x03,0xd1,
+0x00,0x00,0x02,0x22,0x23,0xe6,0x20,0x00,0x00,0xdb,0xaa,0xaa,0xae,0x30,0x30,0x01,
+0xf0,0x00,0x00,0xc3,0x00,0x00,0xdb,0xbb,0xbb,0xbf,0x30,0x00,0x0d,0x32,0x22,0x22,
+0xd3,0x48,0x00,0x11,0x90,0xe0,0x00,0x91,0xd2,0x00,0x00,0x00,0xfe,0xee,0xee,0xee,
+0xf1,0x38,0x01,0xf1,0x00,0xd1,0x00,0xf1,0x11,0x11,0x11,0xe1,0x00,0xfc,0xcc,0xcc,
+0xcc,0xc0,0x01,0xe0,0x70,0x00,0xd0,0xc6,0xfe,0xee,0xee,0xf4,0x04,0xb6,0x80,0x00,
+0x00,0xa4,0x09,0x76,0x06,0x00,0x20,0x1f,0x26,0x12,0x00,0x20,0x49,0x06,0x0c,0x00,
+0x03,0x26,0x01,0x30,0x0b,0x10,0xb4,0x95,0x00,0x20,0xc0,0x0b,0x54,0x02,0x80,0xce,
+0xee,0xfe,0xee,0xe3,0x00,0x8b,0x00,0x0d,0x00,0x80,0x06,0x10,0x00,0xb4,0x00,0x00,
+0x02,0xee,0x01,0x00,0x14,0xe2,0x53,0x01,0xf0,0x22,0xee,0xee,0xee,0xe9,0x00,0x00,
+0x86,0x00,0x00,0x04,0xa0,0x00,0x08,0x60,0x00,0x00,0x4a,0x00,0x00,0x8d,0xbb,0xbb,
+0xbd,0xa0,0x00,0x08,0x82,0x22,0x22,0x6a,0x00,0x00,0x25,0x8d,0x30,0x00,0x00,0x0a,
+0xbd,0x91,0x0c,0xee,0xed,0x00,0x08,0x60,0x0e,0x10,0x1e,0x06,0x00,0xf0,0x0d,0x00,
+0x0e,0x1e,0xef,0xfe,0x9e,0x00,0x0e,0x00,0x1f,0xa0,0x0e,0x00,0x0e,0x00,0x9d,0xc9,
+0x0e,0x00,0x0e,0x03,0xc8,0x69,0x5e,0x00,0x0e,0x1d,0x38,0x1e,0x00,0x60,0x26,0x08,
+0x60,0x0e,0xdc,0xde,0x2a,0x00,0xf0,0x31,0x21,0x2e,0x00,0x08,0x60,0x02,0x00,0x01,
+0xdc,0xcc,0xd0,0xfc,0xcc,0xed,0xba,0xbd,0x0f,0xaa,0xbe,0xd1,0x01,0xd0,0xe0,0x01,
+0xed,0xcc,0xcd,0x0f,0xbb,0xce,0xd1,0x00,0x00,0x00,0x01,0xed,0x10,0xcc,0xcc,0xa0,
+0x1e,0xd1,0x0d,0x00,0x1d,0x01,0xed,0x10,0xd0,0x01,0xd0,0x1e,0xd1,0x0f,0xdd,0xdd,
+0x01,0xed,0x10,0xa0,0x00,0x00,0x2e,0xd1,0x8d,0x02,0x50,0x80,0x00,0x06,0x00,0x00,
+0xa1,0x02,0xf3,0x37,0xc1,0x00,0x0e,0x00,0x00,0x0a,0xde,0xee,0x14,0xc3,0x33,0x00,
+0xb3,0x00,0xc1,0x8c,0xae,0xb0,0x0b,0x41,0x1c,0x2e,0x80,0xb2,0x00,0xbc,0xcc,0xc7,
+0xcc,0x0e,0x00,0x0c,0x20,0x00,0x11,0xc4,0xb0,0x00,0xda,0xdc,0xe3,0x07,0xd6,0x00,
+0x0e,0xa2,0x09,0x30,0x3f,0x00,0x02,0xc9,0x20,0x93,0x0a,0xe6,0x00,0x87,0x9d,0xce,
+0x47,0xb1,0xd3,0x06,0x29,0x20,0x98,0xc1,0x03,0xc0,0xfa,0x00,0xf2,0x2f,0x03,0xda,
+0xaf,0x0e,0xaa,0xd5,0x00,0x3b,0x33,0xe0,0xe3,0x3a,0x50,0x01,0x66,0x66,0x05,0x66,
+0x62,0x00,0x0e,0xcc,0xcf,0xcc,0xcf,0x00,0x00,0xe1,0x11,0xf1,0x11,0xf0,0x00,0x0e,
+0xaa,0xaf,0xaa,0xaf,0x00,0x00,0xe6,0x66,0xf6,0x66,0xf0,0x00,0x04,0x44,0x5f,0x44,
+0x44,0x00,0x2d,0xdd,0xdd,0xfd,0xdd,0xdd,0x30,0x00,0x00,0x0f,0x44,0x00,0x00,0xa7,
+0x01,0xf8,0x05,0x55,0x53,0x6e,0xdf,0xed,0xa0,0xe7,0x9a,0x67,0x09,0x40,0x00,0xd0,
+0x3a,0x6e,0xce,0xdc,0x60,0xd0,0x3a,0x0c,0x00,0xf2,0x14,0x69,0x4b,0x74,0x40,0xfc,
+0xda,0x26,0x66,0x86,0xd2,0xe1,0x11,0x93,0x5a,0x55,0xc1,0x70,0x00,0xc1,0x98,0x27,
+0xd0,0x00,0x04,0x80,0xa2,0x20,0xd0,0x00,0x03,0x10,0x00,0x8d,0x70,0x00,0x12,0x03,
+0xf0,0x00,0xfd,0xde,0x0a,0xdd,0xe8,0x00,0x2b,0x00,0xe0,0xa3,0x05,0x80,0x02,0xfd,
+0xdf,0x0d,0x00,0xf0,0x2b,0x00,0x00,0x89,0x07,0x91,0x00,0x0b,0xbb,0xbf,0xcb,0xbe,
+0xdb,0x50,0x22,0x8d,0x32,0x2b,0xa2,0x21,0x01,0x9c,0x10,0x00,0x09,0xc5,0x01,0xef,
+0xdd,0xf0,0xbd,0xde,0xd7,0x00,0xe0,0x0d,0x0b,0x20,0x86,0x00,0x0e,0x00,0xd0,0xb2,
+0x08,0x60,0x00,0xed,0xde,0x0b,0xdd,0xe6,0x00,0xef,0xff,0xff,0xff,0xff,0xee,0x16,
+0x03,0xf0,0x14,0x1e,0xe1,0x02,0x22,0x22,0x01,0xee,0x10,0xfb,0xbb,0xf0,0x1e,0xe1,
+0x0e,0x00,0x0f,0x01,0xee,0x10,0xe0,0x00,0xf0,0x1e,0xe1,0x0f,0xbb,0xbf,0x01,0xee,
+0x10,0x11,0x11,0x10,0x1e,0xe1,0x80,0x01,0x10,0xee,0x97,0x03,0x20,0xde,0xe2,0x83,
+0x00,0x20,0xe0,0xed,0x0b,0x00,0x70,0xee,0x00,0x00,0xe0,0x00,0x0e,0xe0,0xe5,0x00,
+0xf1,0x1e,0xee,0x3d,0xdd,0xfd,0xdd,0x3e,0xe0,0x00,0x3d,0x00,0x00,0xee,0x00,0x08,
+0xc9,0x00,0x0e,0xe0,0x02,0xd0,0x7a,0x00,0xee,0x04,0xd4,0x00,0x89,0x0e,0xe0,0xb3,
+0x00,0x00,0x81,0xee,0xbb,0xbb,0xbb,0xbb,0xbe,0xe1,0x11,0x11,0x11,0x12,0xe0,0x80,
+0x04,0xf0,0x05,0xed,0x10,0x00,0xb0,0x00,0x1e,0xd1,0x11,0x1e,0x11,0x11,0xed,0x1a,
+0xaa,0xfa,0xaa,0x1e,0xd1,0x00,0x0e,0xe4,0x01,0x40,0xfc,0xcc,0xf0,0x1e,0x9b,0x03,
+0xd1,0x01,0xed,0x10,0xe7,0x77,0xf0,0x1e,0xd1,0x03,0x33,0x33,0x01,0xed,0x3d,0x00,
+0x62,0xd4,0x33,0x33,0x33,0x34,0xe0,0xbd,0x04,0xf0,0x5a,0x00,0x1b,0x00,0x00,0x1d,
+0xd0,0x1c,0xcb,0xbf,0x71,0xdd,0x3d,0x9b,0x19,0xa0,0x1d,0xd1,0x10,0xaf,0xc1,0x01,
+0xdd,0x5a,0xd8,0x16,0xdc,0x5d,0xd3,0x30,0xaa,0x60,0x22,0xdd,0x00,0x63,0x16,0x10,
+0x1d,0xd0,0x15,0x8b,0xc9,0x11,0xdd,0x43,0x33,0x33,0x73,0x4d,0xda,0xaa,0xaa,0xaa,
+0xaa,0xd0,0xed,0xdd,0xde,0xee,0xde,0xde,0x00,0x00,0x76,0x67,0x1d,0xe2,0x99,0x9c,
+0xc9,0xa3,0xde,0x02,0x22,0x59,0x23,0x1d,0xe0,0xc9,0xe2,0xa5,0x71,0xde,0x0a,0x0b,
+0x0c,0xb1,0x1d,0xe0,0x79,0x90,0xb8,0x01,0xde,0x27,0x99,0x9d,0x85,0x4d,0xe1,0x20,
+0x4a,0x09,0xd2,0xde,0x37,0x00,0x20,0xad,0xe3,0x7a,0x00,0x11,0xd0,0x10,0x03,0xf1,
+0x29,0xde,0x02,0x8b,0xc8,0x81,0x1d,0xe0,0x22,0xd3,0x2b,0x41,0xde,0x07,0x77,0x77,
+0x77,0x3d,0xe0,0x2d,0x88,0x8b,0x61,0xde,0x01,0xb8,0x8a,0xa5,0x1d,0xe0,0x89,0x8a,
+0xe8,0x83,0xde,0x05,0x70,0x2b,0x00,0x1d,0xe0,0x59,0x9a,0xe9,0x92,0xde,0x33,0x33,
+0x47,0x33,0x4d,0xea,0xaa,0xaa,0xaa,0xab,0xd0,0x31,0x01,0xf8,0x1d,0xde,0x02,0x86,
+0x66,0x80,0x1d,0xe0,0x4c,0x88,0x8e,0x01,0xde,0x05,0x66,0x66,0x63,0x1d,0xe0,0xd4,
+0x44,0x48,0x81,0xde,0x0d,0x88,0x88,0xb8,0x1d,0xe0,0xd7,0x77,0x7a,0x81,0xde,0x08,
+0xbb,0x9c,0xa5,0x1d,0xe1,0x97,0x00,0x28,0x81,0x7a,0x00,0x10,0xed,0x7a,0x01,0xf0,
+0x1e,0xee,0x04,0x97,0x77,0x93,0x0e,0xe0,0x6c,0x99,0x9d,0x40,0xee,0x25,0x55,0xe5,
+0x55,0x2e,0xe3,0x55,0x5e,0x55,0x52,0xee,0x0c,0x99,0x99,0xaa,0x0e,0xe0,0xc0,0xb7,
+0xa2,0xa0,0xee,0x0c,0x0a,0x89,0x2a,0x0e,0xe0,0x98,0x88,0x89,0x80,0xee,0x3d,0x00,
+0x10,0xae,0x3d,0x00,0x61,0x33,0xe0,0x00,0x00,0x1c,0x00,0x3c,0x06,0x00,0x8a,0x04,
+0x10,0x2e,0xd8,0x04,0x41,0xee,0x20,0x00,0x5c,0x13,0x00,0x20,0x1e,0x30,0x9f,0x04,
+0xf0,0x00,0x0a,0xa0,0x00,0x3b,0x00,0x00,0x0b,0xf7,0x2e,0xee,0xfe,0xe9,0x04,0xb7,
+0x70,0x0d,0x00,0x89,0x00,0x77,0x00,0x03,0xb0,0x00,0x00,0x07,0x0d,0x00,0x53,0x79,
+0xee,0xef,0xee,0xe2,0x68,0x06,0x20,0x08,0x50,0x46,0x03,0x50,0x00,0x85,0x01,0x30,
+0xc2,0x0d,0x00,0xf0,0x20,0x39,0x0c,0x23,0x80,0x3e,0xff,0xd3,0x91,0xde,0xbe,0x10,
+0x08,0x50,0x4e,0xee,0x30,0xd1,0x00,0x85,0x5f,0xb1,0xc2,0x0d,0x10,0x08,0x51,0x59,
+0x0c,0x20,0xd1,0x00,0x86,0x53,0x90,0xc3,0x1e,0x00,0x5c,0xe9,0x49,0x0a,0x4b,0x70,
+0x1b,0x50,0x03,0x90,0x16,0x05,0x00,0x5a,0x00,0x10,0x68,0x79,0x04,0x24,0xdd,0xed,
+0xbe,0x05,0xb4,0x09,0x40,0x00,0x04,0xb0,0x00,0x00,0x94,0x00,0x00,0x4b,0x0d,0x00,
+0xf0,0x08,0x38,0xdb,0x84,0x90,0x4b,0x00,0x02,0x5c,0x85,0x4b,0x04,0xc2,0x21,0x00,
+0x94,0x04,0xb0,0x4e,0xbb,0x50,0x09,0x40,0x4b,0x27,0x00,0xf0,0x02,0x95,0x65,0xb0,
+0x4b,0x00,0x00,0x4d,0xe7,0x5b,0x04,0xb0,0x00,0x5b,0x50,0x04,0xb0,0x4b,0x99,0x02,
+0x60,0x7c,0x26,0xc2,0x22,0x00,0x00,0x2f,0x02,0x14,0x70,0x55,0x00,0x20,0x50,0x00,
+0xe7,0x04,0x31,0x95,0x00,0x2d,0x0d,0x00,0xf0,0x23,0x0b,0xee,0xee,0xf3,0x3e,0xff,
+0xd7,0xb0,0x00,0x0b,0x30,0x09,0x50,0xc4,0x50,0x00,0xb2,0x00,0x95,0x00,0x0b,0x80,
+0x0c,0x20,0x09,0x50,0x00,0x0b,0x30,0xc1,0x00,0x96,0x73,0x00,0x2a,0x6d,0x00,0x1b,
+0xf8,0x12,0xac,0x40,0xe0,0x2e,0x91,0x04,0xe6,0x00,0x0e,0x00,0x9e,0x00,0x20,0x04,
+0xb0,0x4b,0x00,0x28,0xde,0xe4,0x65,0x06,0xf1,0x08,0x1c,0x00,0x6e,0xfd,0xfe,0x58,
+0x51,0xc0,0x00,0x3a,0x0b,0x20,0x85,0x1c,0x00,0xbe,0xfd,0xfe,0x98,0x51,0xc0,0x00,
+0x77,0x0d,0x00,0xe1,0x0d,0x20,0xb2,0x02,0x12,0xc0,0x0a,0x70,0x0a,0x40,0x0a,0xd9,
+0x00,0x10,0x55,0x05,0x41,0x00,0xbe,0xee,0xfe,0x3f,0x01,0x00,0x0d,0x00,0x80,0x01,
+0x11,0x11,0xb5,0x11,0x11,0x11,0xcc,0x01,0x00,0x31,0xc7,0x00,0x1c,0x10,0x01,0xf5,
+0x38,0xcc,0xfc,0x80,0x3a,0x00,0x00,0x01,0x2d,0x10,0x6a,0xd8,0x80,0x06,0xab,0xfa,
 0xa5,0x7c,0x5e,0x00,0x18,0x42,0x94,0x04,0x90,0xe0,0x00,0x48,0x0d,0x08,0x68,0x0e,
-0x00,0x2d,0xdd,0xfa,0x5f,0x80,0xac,0x1a,0xf5,0x0e,0xae,0x2e,0x00,0x6a,0xbf,0xaa,
-0x1e,0x49,0xe0,0x01,0x23,0xd2,0x25,0xa0,0x0c,0x37,0x00,0x1d,0x01,0xe2,0x00,0x8b,
-0x70,0x01,0xd0,0x76,0x00,0x01,0x91,0x04,0x07,0x10,0x50,0xd1,0x10,0xc1,0x6a,0xdc,
-0xaa,0xaa,0xfb,0xa0,0x01,0x2a,0x72,0x22,0x2e,0x32,0xb1,0x05,0xf0,0x09,0xf1,0x00,
-0x00,0x08,0x95,0x55,0x5f,0x10,0x00,0x00,0x89,0x44,0x44,0xe1,0x00,0x1d,0xde,0xed,
-0xdd,0xdf,0xdd,0x70,0x00,0xb5,0xcd,0x35,0xe0,0x01,0xb9,0x11,0xc4,0x13,0xd6,0x01,
-0xe7,0x4a,0xae,0xba,0x91,0xb7,0x01,0x6a,0x07,0x30,0x00,0x00,0x1d,0x42,0x07,0x12,
-0x80,0x43,0x02,0xf0,0x2b,0x01,0xcc,0xfc,0x96,0xfd,0xde,0xd0,0x01,0x2c,0x10,0x68,
-0x00,0x1d,0x01,0x24,0xd2,0x26,0x80,0x68,0xc0,0x5c,0xba,0xdb,0x78,0x06,0x62,0x00,
-0x57,0x0c,0x16,0xeb,0xaa,0xc0,0x3d,0xee,0xeb,0x6a,0xd0,0x3c,0x00,0x01,0xc0,0x06,
-0x8a,0x6a,0x70,0x5b,0xbe,0xbb,0x78,0x2d,0xe0,0x01,0x13,0xc1,0x16,0x80,0xdc,0x2e,
-0x01,0xa7,0x68,0xc9,0x9b,0x10,0x01,0xc0,0x06,0xe8,0x00,0x84,0x45,0x01,0x01,0xe1,
-0x29,0x01,0x43,0x20,0xf9,0x38,0x94,0x08,0xcc,0xfc,0xcc,0x00,0x09,0x40,0xb2,0x0c,
-0x10,0xe0,0x0a,0xdb,0x6b,0x31,0xd1,0x1e,0x00,0x6c,0x94,0xbb,0xaf,0xaa,0xf0,0x00,
-0x94,0x0b,0x20,0xc0,0x0d,0x00,0x09,0x40,0x8c,0xdf,0xdc,0xc0,0x00,0x94,0x00,0x09,
-0xf2,0x80,0x00,0x0a,0xcc,0x01,0xdb,0x48,0x90,0x2d,0xc6,0x00,0x96,0xab,0xcc,0x30,
-0x30,0x00,0x7c,0x0a,0x30,0x25,0x00,0x00,0x6b,0x10,0x7d,0xcd,0x50,0x5b,0x00,0x21,
-0x0b,0x20,0x98,0x09,0xf0,0x16,0xb2,0x0b,0xcc,0xfd,0xcc,0x60,0x0b,0x20,0x01,0x3c,
-0x11,0x10,0x2d,0xfe,0x83,0xd9,0x99,0xab,0x00,0x0c,0x30,0x3d,0x99,0x9a,0xb0,0x00,
-0xb2,0x03,0xb3,0x33,0x5b,0x00,0x0b,0x20,0x3c,0x66,0x68,0x0d,0x00,0x01,0x1a,0x00,
-0xf6,0x09,0xc9,0x4b,0x00,0x03,0xb0,0x1d,0xc5,0x5c,0xcd,0xcc,0xdc,0xa0,0x30,0x00,
-0x1a,0xb0,0x3d,0x50,0x00,0x00,0x4d,0x60,0x00,0x1c,0xe4,0x27,0x02,0x87,0x10,0x20,
-0xd1,0x06,0x62,0x0d,0xf0,0x0f,0x87,0x3d,0x51,0x00,0xe0,0x0e,0x87,0xd8,0x99,0x4e,
-0xfe,0x4c,0x91,0xb6,0x79,0x00,0xe0,0x0c,0x36,0xc9,0x39,0x00,0xe0,0x0e,0x78,0xd8,
-0x99,0x00,0xe0,0x03,0x11,0x2a,0xf0,0x02,0xe0,0x04,0xdb,0xbb,0xe0,0x02,0xec,0x54,
-0x92,0x22,0xe0,0x4d,0x71,0x04,0xc7,0x77,0xf0,0x44,0x0c,0x10,0x99,0x06,0x00,0xf0,
-0x29,0x91,0x11,0xe0,0x0c,0xcb,0xbb,0xbb,0xbb,0xba,0x00,0xc4,0xa6,0x79,0x01,0x98,
-0x10,0x0c,0x4d,0xaa,0xa3,0x4b,0x58,0x00,0xc5,0xaa,0xa8,0x47,0xf5,0x40,0x0c,0x7a,
-0x77,0xd0,0x7d,0x50,0x00,0xd7,0xa7,0x7d,0x0c,0x2c,0x00,0x0d,0x65,0x03,0xdb,0x60,
-0x8c,0x00,0xd4,0x30,0x96,0x70,0x00,0x60,0x1c,0x5e,0x1b,0x31,0xb2,0x05,0x80,0x7b,
-0x24,0x65,0x83,0xbb,0xbb,0xde,0xbb,0xbb,0x36,0x14,0x01,0x44,0x0b,0x21,0x06,0xa0,
-0x51,0x0b,0x40,0xbf,0xee,0xa0,0xe0,0x7a,0x09,0xf1,0x14,0x68,0x0e,0x00,0x00,0x08,
-0x80,0x0a,0x50,0xfb,0x10,0x02,0xe8,0x40,0xe1,0x0e,0x6d,0x20,0x03,0x2d,0xbb,0x00,
-0xe0,0x5e,0x20,0x00,0x0e,0x40,0x0e,0x00,0x51,0x00,0x08,0xc0,0x00,0xe0,0x32,0x33,
-0x00,0x27,0x00,0x10,0xe3,0x41,0x00,0x29,0x02,0xb1,0x77,0x23,0x11,0x89,0x47,0x03,
-0xe1,0xfe,0xdd,0xd1,0x00,0x04,0xd8,0x00,0x0a,0x80,0x00,0x3c,0x3b,0x40,0xaa,0x90,
-0x07,0xc0,0x72,0x00,0x00,0x02,0x7d,0xa3,0xaa,0x00,0x00,0xad,0x82,0x1b,0xba,0x18,
-0xa0,0x06,0xe6,0x00,0x0b,0x60,0x01,0xd9,0x2c,0x30,0xaa,0x37,0x07,0xc7,0xed,0x60,
-0x00,0x00,0x14,0xae,0xa2,0x00,0x00,0xae,0xda,0x50,0x9d,0x0a,0x09,0xed,0x28,0x25,
-0x01,0xf0,0x86,0x0b,0x41,0x2e,0xee,0xef,0xff,0xeb,0x2a,0x21,0x8f,0x80,0xf2,0x0c,
-0x12,0x5e,0x66,0x0a,0x10,0xb7,0x07,0x00,0x30,0xd4,0x02,0xe2,0x4c,0x16,0xc0,0x00,
-0x07,0xe2,0x00,0x03,0xda,0x00,0x00,0x08,0xe5,0x02,0xd5,0x1d,0x00,0x14,0xd2,0xe3,
-0x03,0x00,0x99,0x05,0x14,0xe8,0x18,0x2a,0x03,0x19,0x2a,0x20,0x00,0x2e,0x11,0x00,
-0x40,0xee,0xef,0xfe,0xee,0xfc,0x2f,0x21,0x9f,0x70,0xed,0x10,0x11,0x5d,0x21,0x18,
-0x01,0xd5,0x0d,0xe0,0x0a,0xd0,0x00,0xc9,0x00,0x00,0x5d,0xa0,0x00,0x00,0xad,0x50,
-0x2b,0x40,0xb1,0x0a,0x15,0x30,0x9d,0x00,0x07,0x48,0x00,0xf1,0x02,0x33,0x33,0x5e,
-0x33,0x33,0x30,0x2b,0xbb,0xbd,0xfd,0xbb,0xbb,0x20,0x00,0x00,0x8d,0xa0,0xc3,0x0b,
-0x21,0x4e,0x10,0x4b,0x1b,0x10,0x98,0x0d,0x00,0x20,0xc5,0x01,0x9d,0x00,0xf2,0x03,
+0x00,0x2d,0xdd,0xfa,0x5f,0x80,0xe0,0x00,0x01,0xd0,0x00,0xae,0x2e,0x00,0x6a,0xbf,
+0xaa,0x1e,0x49,0xe0,0x01,0x23,0xd2,0x25,0xa0,0x0c,0x37,0x00,0x1d,0x01,0xe2,0x00,
+0x8b,0x70,0x01,0xd0,0x76,0x00,0x01,0x91,0x04,0x07,0xf1,0x02,0x50,0x00,0x0e,0x10,
+0x00,0x6a,0xdc,0xaa,0xaa,0xfb,0xa0,0x01,0x2a,0x72,0x22,0x2e,0x32,0xb1,0x05,0xf0,
+0x1e,0xf1,0x00,0x00,0x08,0x95,0x55,0x5f,0x10,0x00,0x00,0x89,0x44,0x44,0xe1,0x00,
+0x1d,0xde,0xed,0xdd,0xdf,0xdd,0x70,0x00,0xb5,0x00,0x00,0xc5,0x00,0x01,0xb9,0x11,
+0xc4,0x13,0xd6,0x01,0xe7,0x4a,0xae,0xba,0x91,0xb7,0x01,0x00,0x00,0xc2,0x17,0x08,
+0x00,0x42,0x07,0x12,0x80,0x43,0x02,0xf0,0x2b,0x01,0xcc,0xfc,0x96,0xfd,0xde,0xd0,
+0x01,0x2c,0x10,0x68,0x00,0x1d,0x01,0x24,0xd2,0x26,0x80,0x68,0xc0,0x5c,0xba,0xdb,
+0x78,0x06,0x62,0x00,0x57,0x0c,0x16,0xeb,0xaa,0xc0,0x3d,0xee,0xeb,0x6a,0xd0,0x3c,
+0x00,0x01,0xc0,0x06,0x8a,0x6a,0x70,0x5b,0xbe,0xbb,0x78,0x2d,0xe0,0x01,0x13,0xc1,
+0x16,0x80,0xdc,0x2e,0x01,0xa7,0x68,0xc9,0x9b,0x10,0x01,0xc0,0x06,0xe8,0x00,0x84,
+0x45,0x01,0x10,0x10,0xe9,0x01,0x00,0xa9,0x00,0xf9,0x39,0x00,0x94,0x08,0xcc,0xfc,
+0xcc,0x00,0x09,0x40,0xb2,0x0c,0x10,0xe0,0x0a,0xdb,0x6b,0x31,0xd1,0x1e,0x00,0x6c,
+0x94,0xbb,0xaf,0xaa,0xf0,0x00,0x94,0x0b,0x20,0xc0,0x0d,0x00,0x09,0x40,0x8c,0xdf,
+0xdc,0xc0,0x00,0x94,0x00,0x09,0xf2,0x80,0x00,0x0a,0xcc,0x01,0xdb,0x48,0x90,0x2d,
+0xc6,0x00,0x96,0xab,0xcc,0x30,0x30,0x00,0x7c,0x0a,0x30,0x25,0x00,0x00,0x6b,0x10,
+0x7d,0xcd,0x50,0x5b,0x00,0xf0,0x1d,0x0b,0x20,0x00,0x0c,0x30,0x00,0x00,0xb2,0x0b,
+0xcc,0xfd,0xcc,0x60,0x0b,0x20,0x01,0x3c,0x11,0x10,0x2d,0xfe,0x83,0xd9,0x99,0xab,
+0x00,0x0c,0x30,0x3d,0x99,0x9a,0xb0,0x00,0xb2,0x03,0xb3,0x33,0x5b,0x00,0x0b,0x20,
+0x3c,0x66,0x68,0x0d,0x00,0x01,0x1a,0x00,0xf9,0x0a,0xc9,0x4b,0x00,0x03,0xb0,0x1d,
+0xc5,0x5c,0xcd,0xcc,0xdc,0xa0,0x30,0x00,0x1a,0xb0,0x3d,0x50,0x00,0x00,0x4d,0x60,
+0x00,0x1c,0x60,0x63,0x08,0xf0,0x31,0xe0,0x00,0xd1,0x06,0xa0,0x00,0xe0,0x03,0x87,
+0x3d,0x51,0x00,0xe0,0x0e,0x87,0xd8,0x99,0x4e,0xfe,0x4c,0x91,0xb6,0x79,0x00,0xe0,
+0x0c,0x36,0xc9,0x39,0x00,0xe0,0x0e,0x78,0xd8,0x99,0x00,0xe0,0x03,0x33,0x33,0x32,
+0x00,0xe0,0x04,0xdb,0xbb,0xe0,0x02,0xec,0x54,0x92,0x22,0xe0,0x4d,0x71,0x04,0xc7,
+0x77,0xf0,0x00,0x00,0x04,0xd9,0x99,0x06,0x00,0xf0,0x31,0x91,0x11,0xe0,0x0c,0xcb,
+0xbb,0xbb,0xbb,0xba,0x00,0xc4,0xa6,0x79,0x01,0x98,0x10,0x0c,0x4d,0xaa,0xa3,0x4b,
+0x58,0x00,0xc5,0xaa,0xa8,0x47,0xf5,0x40,0x0c,0x7a,0x77,0xd0,0x7d,0x50,0x00,0xd7,
+0xa7,0x7d,0x0c,0x2c,0x00,0x0d,0x65,0x03,0xdb,0x60,0x8c,0x00,0xd4,0x30,0x96,0x70,
+0x00,0x60,0x1c,0x1b,0xbb,0xde,0xbb,0xb2,0x05,0x80,0x00,0xcd,0x07,0x64,0x83,0xbb,
+0xbb,0xde,0xbb,0xbb,0x96,0x00,0x40,0x1d,0x00,0x00,0xe0,0xea,0x03,0x00,0x00,0x07,
+0x50,0x00,0xbf,0xee,0xa0,0xe0,0x7a,0x09,0xf0,0x12,0x68,0x0e,0x00,0x00,0x08,0x80,
+0x0a,0x50,0xfb,0x10,0x02,0xe8,0x40,0xe1,0x0e,0x6d,0x20,0x03,0x2d,0xbb,0x00,0xe0,
+0x5e,0x20,0x00,0x0e,0x40,0x0e,0x00,0x51,0x00,0x08,0xc0,0x34,0x00,0x30,0x05,0xe1,
+0x00,0x27,0x00,0x10,0xe3,0x41,0x00,0x56,0x02,0xb1,0x00,0x00,0x0e,0xeb,0x00,0x11,
+0x89,0x47,0x03,0xe1,0xfe,0xdd,0xd1,0x00,0x04,0xd8,0x00,0x0a,0x80,0x00,0x3c,0x3b,
+0x40,0xaa,0x90,0x07,0xf0,0x0b,0x72,0x00,0x00,0x02,0x7d,0xa3,0xaa,0x00,0x00,0xad,
+0x82,0x1b,0xee,0xee,0xe0,0x00,0x06,0xe6,0x00,0x0b,0x60,0x01,0xd9,0x2c,0x30,0xaa,
+0x37,0x07,0xc7,0xed,0x60,0x00,0x00,0x14,0xae,0xa2,0x00,0x00,0xae,0xda,0x50,0x9d,
+0x0a,0x04,0xeb,0x09,0x11,0x00,0x52,0x02,0x02,0x0d,0x00,0x11,0x3d,0x9a,0x04,0x81,
+0xef,0xff,0xee,0xee,0x30,0x00,0x00,0x8f,0x63,0x0a,0x22,0x0d,0x5e,0x66,0x0a,0x10,
+0xb7,0x07,0x00,0x20,0xd4,0x02,0x39,0x03,0xd0,0xc9,0x00,0x07,0xe2,0x00,0x03,0xda,
+0x00,0x00,0x08,0xe5,0x02,0xd5,0x1d,0x00,0x14,0xd2,0xe3,0x03,0x00,0x99,0x05,0x00,
+0x05,0x07,0x02,0x33,0x0a,0x02,0x03,0x09,0x20,0x00,0x2e,0x11,0x00,0x30,0xee,0xef,
+0xfe,0xef,0x04,0x21,0x00,0x9f,0x0f,0x04,0x40,0x0e,0x5d,0x00,0x00,0xf0,0x04,0x10,
+0x8a,0x06,0x00,0xd0,0xd0,0x00,0xc9,0x00,0x00,0x5d,0xa0,0x00,0x00,0xad,0x50,0x2b,
+0x40,0xb1,0x0a,0x15,0x30,0x9d,0x00,0x07,0x48,0x00,0xf1,0x01,0x33,0x33,0x5e,0x33,
+0x33,0x30,0x2b,0xbb,0xbd,0xfd,0xbb,0xbb,0x20,0x00,0x00,0x8d,0xcf,0x09,0x30,0x0c,
+0x4e,0x10,0x15,0x04,0x20,0xd0,0x98,0x0d,0x00,0x20,0xc5,0x01,0x9d,0x00,0xf2,0x03,
 0xbd,0xd2,0x05,0xe2,0x00,0x02,0xcb,0x05,0xe2,0x07,0xe4,0x02,0xe7,0x00,0x06,0x90,
-0x05,0xe4,0x44,0x00,0x00,0x90,0x18,0x10,0xd1,0x0f,0x01,0x11,0xe0,0xc4,0x0d,0xb0,
-0x9f,0xdd,0xfd,0xdd,0xd4,0x00,0x2e,0x22,0x2e,0x32,0x22,0x27,0x17,0x11,0xe1,0xf1,
-0x2d,0x18,0x0f,0xc8,0x0c,0x21,0x7c,0xc0,0xbd,0x00,0x30,0x2b,0x60,0x00,0x7e,0x0a,
-0xb0,0x1d,0x60,0x00,0x01,0x8e,0x60,0x00,0x2d,0xb3,0x00,0xd8,0xe7,0x19,0x3e,0xd7,
-0x00,0x00,0x47,0x01,0x11,0x3e,0xe5,0x00,0x31,0x30,0x00,0x90,0x15,0x23,0x11,0x4c,
-0x15,0x23,0xf0,0x03,0x0a,0xd2,0x1f,0x07,0xf3,0x00,0x05,0xb3,0xd5,0xf5,0xd3,0xd5,
-0x01,0xd1,0x02,0xab,0xc4,0x01,0x90,0x10,0x20,0x1d,0x30,0x3f,0x31,0xc0,0x30,0x3e,
-0x40,0x00,0x01,0x8d,0x20,0x00,0x3e,0x92,0x02,0xd7,0x8a,0x0c,0x1a,0xe2,0x3d,0x0b,
-0x00,0x79,0x0c,0x01,0x31,0x05,0x60,0x8e,0xee,0xee,0x10,0x0c,0x20,0x41,0x1b,0x30,
-0x2e,0xfe,0xea,0x24,0x35,0xf0,0x07,0x2c,0x05,0x80,0x02,0xd0,0x00,0x05,0x80,0x86,
-0x22,0x5d,0x22,0x10,0xa4,0x0c,0x4b,0xbc,0xfb,0xb7,0x0a,0xb4,0xc0,0x8b,0x0d,0x21,
-0x06,0xf8,0x15,0x10,0x20,0x5d,0xe5,0x0d,0x00,0x50,0x6e,0x22,0x70,0x03,0xc0,0x78,
-0x31,0x2a,0x0d,0xe8,0xb5,0x1d,0x00,0x90,0x03,0x80,0x1e,0x10,0x00,0x00,0xd0,0x00,
-0x08,0xa0,0x66,0x1f,0xf0,0x0b,0x01,0xe2,0x0a,0x00,0x5e,0xfe,0xf0,0x88,0x00,0x97,
-0x00,0x58,0x0d,0x4e,0x45,0x67,0xf1,0x09,0x41,0xc8,0xca,0x98,0x69,0x80,0xd0,0x59,
-0x30,0x02,0xa0,0x0d,0x79,0x40,0xfd,0xdd,0xde,0x00,0x09,0xf1,0x0e,0x94,0x02,0xf4,
-0x03,0xba,0xd1,0xe0,0x00,0x0e,0x01,0xab,0x03,0x0f,0xaa,0xaa,0xe0,0x2a,0x00,0x00,
-0xe3,0x33,0x3e,0x55,0x00,0x10,0x0c,0x39,0x01,0x01,0x7e,0x0d,0x20,0x4e,0x50,0x72,
-0x01,0x11,0xac,0x4f,0x06,0x33,0xb8,0x00,0x00,0x6c,0x05,0x02,0xcc,0x0b,0x12,0x80,
-0x0d,0x00,0x02,0x34,0x1d,0x15,0x00,0x0d,0x00,0x11,0xc4,0x28,0x1c,0x18,0xec,0xc3,
-0x24,0x10,0x3d,0x1d,0x02,0xd2,0xbb,0xbb,0xfc,0xbb,0xba,0x00,0xe3,0x22,0x22,0x22,
-0x24,0xe0,0x0d,0x5a,0x03,0x00,0xa0,0x1b,0x01,0x07,0x06,0x21,0x19,0x90,0x4c,0x02,
-0x01,0x5b,0x00,0x00,0xdd,0x1a,0x0b,0x23,0x2d,0x02,0x0d,0x00,0x32,0x01,0xee,0xa0,
-0x87,0x05,0x06,0xe0,0x2d,0x13,0x1e,0x7c,0x07,0x12,0x4c,0xd3,0x0f,0x40,0x27,0xdd,
-0xdd,0xe4,0x56,0x33,0x50,0x01,0xb7,0x00,0x1c,0xe7,0xae,0x0c,0xf2,0x01,0x04,0x78,
-0x76,0xaa,0xbf,0xaa,0xa4,0x00,0x77,0x23,0x33,0xf3,0x33,0x10,0x07,0x70,0x85,0x27,
-0x01,0xd2,0x03,0x28,0x07,0x70,0x57,0x15,0x30,0x02,0x21,0x03,0x41,0x00,0xf0,0x0b,
-0x83,0x8e,0x67,0xad,0x60,0x00,0xe8,0x59,0x29,0x58,0xc5,0x00,0x0e,0xa7,0x8f,0x67,
-0xae,0x30,0x03,0xe4,0x5c,0x5a,0x44,0xd6,0x00,0xc7,0xe3,0x2f,0x60,0xe3,0x0c,0x09,
-0xbb,0xbb,0xb9,0xff,0x04,0x30,0x01,0x9c,0x20,0x7b,0x2b,0x41,0xd8,0x22,0x22,0x10,
-0x19,0x2b,0x23,0xa5,0x00,0x57,0x10,0x21,0x08,0xcd,0x4f,0x00,0x23,0x39,0x00,0x2e,
-0x0d,0x00,0x5f,0x10,0x21,0xef,0xed,0x12,0x0a,0x40,0x91,0x90,0x00,0x00,0x51,0x02,
-0xc4,0x00,0x5a,0x10,0x00,0xf0,0x49,0xea,0x40,0x00,0x0f,0xda,0x61,0xe1,0x00,0x00,
-0xe0,0x00,0x30,0x48,0x00,0xf1,0x55,0x04,0x80,0x08,0xee,0xee,0xef,0xc2,0x00,0x00,
-0x04,0x79,0x01,0x90,0x12,0x22,0x5e,0x22,0x22,0x10,0x0b,0xcb,0xbb,0x00,0x0d,0xc0,
-0xb3,0x00,0x73,0x00,0x03,0xc0,0x05,0x10,0x3d,0x00,0x00,0x15,0x3a,0x1e,0x00,0xa2,
-0x1e,0x20,0x07,0xb0,0x67,0x06,0x21,0x02,0xf6,0x08,0x0f,0x40,0x05,0xbe,0x8e,0x20,
-0x27,0x01,0xf0,0x06,0x9e,0xeb,0x40,0x00,0x01,0x59,0xe8,0x00,0x6e,0xc3,0x00,0x7a,
-0x50,0x00,0x00,0x07,0x50,0x00,0x00,0x03,0x70,0xd4,0x2d,0x60,0x22,0x3f,0x32,0x22,
-0x20,0x0d,0x4e,0x00,0x31,0xcd,0x00,0xd0,0x09,0x0e,0x63,0x09,0x0e,0xee,0xee,0xee,
-0x19,0x04,0x01,0x31,0x2e,0xee,0xee,0x4d,0x01,0x31,0x0d,0x20,0x77,0x7a,0x01,0x01,
-0xb6,0x02,0xf5,0x04,0x5b,0x00,0x77,0x00,0x53,0x00,0x4e,0x30,0x07,0x70,0x0a,0x42,
-0xdb,0x30,0x00,0x4e,0xee,0xd1,0x01,0x34,0x01,0x03,0x55,0x00,0x40,0x42,0x22,0x20,
-0x0e,0x1f,0x08,0x32,0xce,0x00,0xe0,0xc0,0x1e,0x00,0x63,0x2f,0x14,0x58,0xb6,0x01,
-0x31,0x2c,0x00,0xf0,0x2a,0x09,0x61,0x0f,0xee,0xec,0x00,0x00,0xae,0x0d,0x00,0x31,
-0x0e,0x99,0x0f,0x52,0x0e,0x21,0xbb,0xf1,0xa5,0x0d,0x58,0x5b,0xef,0xff,0xf3,0x01,
-0x64,0x06,0x03,0x6a,0x04,0x10,0x0d,0x0b,0x02,0xf0,0x26,0xeb,0x00,0xe0,0x04,0x00,
-0x02,0x02,0xd0,0x06,0x09,0xa0,0x02,0xd7,0x16,0x00,0x1b,0xb0,0x2f,0x20,0xaa,0x00,
-0x08,0x80,0x1d,0x9d,0x20,0x94,0x00,0x00,0x2d,0x40,0x6e,0x30,0x00,0x00,0x7f,0x61,
-0x11,0x6f,0xa1,0x03,0xec,0xfb,0xbb,0xbb,0xfa,0xf2,0x03,0x2c,0x00,0x00,0x0e,0x11,
-0x3a,0x03,0x00,0x09,0x04,0x69,0x2f,0xdd,0xdd,0xdf,0x10,0x00,0xe2,0x1f,0xf4,0x24,
-0x0d,0xcc,0xcc,0xdc,0xcc,0xce,0x20,0xd0,0x88,0x88,0x88,0x84,0xc2,0x27,0x7d,0x55,
-0xe5,0x59,0xb7,0x32,0x69,0xb5,0x5e,0x55,0xaa,0x63,0x00,0x39,0x99,0x99,0x99,0x30,
-0x00,0x07,0xa9,0x99,0x99,0x9b,0x00,0x00,0x9b,0x88,0x88,0x89,0xd0,0x00,0x09,0xa7,
-0x77,0x77,0x8d,0x0d,0x00,0xc0,0x03,0x7c,0x40,0x3b,0x95,0x00,0x09,0x95,0x00,0x00,
-0x02,0x79,0x7f,0x04,0x11,0x80,0xdd,0x1d,0xf1,0x08,0xfd,0xdd,0xda,0x0e,0x00,0x36,
-0x00,0x00,0x2c,0x06,0x5c,0x83,0x4b,0xbd,0x35,0x00,0x69,0x55,0x05,0x5c,0x30,0x00,
-0x6a,0x06,0x00,0x20,0x6c,0xbb,0x79,0x25,0x21,0x07,0xc0,0x96,0x01,0xfb,0x06,0xcc,
-0xcc,0xcc,0xe5,0x2d,0x79,0x27,0x72,0xa1,0xa4,0x00,0x3a,0x0c,0x39,0x34,0xd2,0x00,
-0x52,0x05,0x01,0x9d,0xfc,0x1a,0x01,0x45,0x0a,0x10,0x0f,0xc3,0x08,0xf0,0x1f,0xce,
-0x40,0xe0,0x0b,0x10,0x77,0x00,0x94,0x06,0xbb,0xeb,0xbd,0xdb,0xb8,0x20,0x05,0x9c,
-0xa9,0xbb,0x98,0x00,0x00,0x86,0x22,0x22,0x23,0xd0,0x00,0x08,0xb9,0x99,0x99,0xad,
-0x00,0x00,0x8a,0x88,0x88,0x88,0xd0,0x00,0x08,0xca,0xaa,0xaa,0xbd,0x7b,0x26,0xf7,
-0x01,0x0d,0x1c,0x91,0x00,0x02,0xc7,0x00,0xd1,0x09,0x78,0x2d,0xc5,0x00,0x08,0xcb,
-0xbc,0x31,0x35,0x12,0x86,0x38,0x03,0x13,0x60,0x0d,0x00,0x05,0x69,0x14,0x01,0x1a,
-0x00,0x31,0x03,0x60,0x00,0x94,0x1a,0x11,0x50,0x27,0x00,0x21,0x2e,0x10,0x27,0x00,
-0x1a,0x75,0x34,0x00,0x11,0x96,0x72,0x35,0x19,0xfc,0x14,0x10,0xc0,0x03,0xb0,0x02,
-0x77,0x77,0x30,0x00,0x3b,0x00,0x27,0x77,0xb6,0xce,0x0a,0x90,0x60,0x0b,0x3d,0xee,
-0xff,0xe4,0x0c,0x50,0xf0,0x0d,0x00,0x50,0x2e,0x6a,0x04,0x40,0x3b,0xa5,0x35,0xf5,
-0x09,0x2d,0x03,0xb0,0x00,0x03,0xf5,0x00,0x96,0x3b,0x00,0x00,0xd7,0xe0,0x03,0x63,
-0xb0,0x00,0xaa,0x09,0x60,0x00,0x3b,0x00,0x4c,0x02,0x0a,0x2c,0x1f,0xe6,0xec,0x28,
-0x20,0x84,0x00,0xb7,0x0c,0x20,0x9e,0x99,0xa7,0x03,0x20,0x2c,0x33,0xca,0x12,0x93,
-0x02,0xeb,0xbf,0x7e,0xee,0xfe,0x60,0x2b,0x00,0x0d,0x00,0x30,0x09,0x00,0xe0,0xad,
-0x0d,0x80,0x87,0x0e,0x00,0x3d,0xdd,0xff,0x00,0xd0,0xc0,0x18,0x60,0xe0,0x05,0x0e,
-0x00,0x00,0x9a,0xd8,0x04,0x22,0x03,0xd7,0x27,0x00,0x57,0x04,0xdb,0x00,0xbe,0xa0,
-0xa2,0x26,0xfb,0x3a,0x93,0x00,0x00,0xd0,0x3a,0x00,0x9e,0xbb,0xb0,0x0d,0x03,0xa2,
-0xb7,0x60,0x69,0x00,0xd0,0x3a,0xa5,0x16,0xbd,0x10,0x0c,0xde,0xa0,0x2c,0x7c,0x10,
-0x00,0x00,0x3a,0x16,0xd8,0x0d,0x00,0x02,0x25,0xa8,0x82,0x00,0xe0,0x02,0xeb,0xca,
-0xcd,0xdd,0xdf,0xd8,0x0c,0x13,0xa0,0x83,0x00,0xe0,0x00,0xc0,0x3a,0x02,0xd1,0x0e,
-0x00,0x0b,0x03,0xa0,0x05,0x20,0xe0,0x03,0x60,0x3a,0x00,0x0b,0xea,0xaf,0x00,0xf0,
-0x1e,0x45,0x69,0x35,0x00,0x0d,0x10,0x0b,0x96,0x97,0xb0,0x00,0xd1,0x00,0x2b,0x69,
-0xa1,0x00,0x0d,0x10,0x5e,0xee,0xfe,0xe4,0x22,0xe3,0x00,0x0a,0x00,0xb0,0xab,0xbf,
-0xc3,0x01,0x84,0x69,0x10,0x10,0xd1,0x00,0xab,0xdd,0xb8,0x59,0x0d,0x10,0x44,0x0a,
-0x80,0xd1,0xd1,0x00,0x7c,0xee,0xc6,0x08,0x3d,0x0d,0x00,0xfa,0x01,0x10,0x00,0xd1,
-0x02,0x8a,0xde,0xca,0x10,0x0d,0x10,0x15,0x31,0x00,0x00,0x9e,0xc0,0x5b,0x00,0xf0,
-0x07,0x73,0x00,0x2b,0x00,0xa4,0x00,0x02,0xd3,0xab,0xcd,0xbd,0xbb,0x00,0x02,0x00,
-0x88,0xe8,0x88,0x00,0x4e,0xe4,0x1d,0x65,0x0a,0xf1,0x1b,0x09,0x41,0xd4,0x44,0x4e,
-0x10,0x00,0x94,0x1e,0x77,0x77,0xe1,0x00,0x5c,0xa5,0x97,0x77,0x78,0x00,0x1b,0x00,
-0x6b,0xbb,0xcd,0xcc,0x30,0x22,0x22,0x22,0x27,0xa2,0x20,0x29,0x9d,0xa9,0x99,0xcd,
-0x99,0x10,0x00,0x8c,0x10,0x7f,0x34,0x31,0x41,0x3c,0xd6,0x51,0x00,0x12,0xf1,0x4e,
-0x05,0x15,0x10,0x0d,0x00,0x50,0x06,0x70,0x0f,0x10,0x94,0x5d,0x17,0xf0,0x03,0xf1,
-0x04,0xd0,0x00,0x0f,0x10,0x0f,0x10,0x0c,0x50,0x06,0xc0,0x00,0xf1,0x00,0x5c,0x00,
-0xe3,0x27,0x00,0x20,0xf2,0x4b,0x27,0x00,0x21,0x0a,0x70,0x34,0x00,0x14,0x20,0x41,
-0x00,0x18,0x4f,0xe2,0x2c,0x20,0xdf,0xff,0x04,0x41,0x00,0x35,0x17,0x12,0x0f,0x46,
-0x11,0x05,0x0d,0x00,0x00,0x0e,0x0f,0x00,0xca,0x0e,0x22,0x05,0xa0,0x91,0x14,0x11,
-0x10,0x85,0x0c,0xf0,0x02,0x7a,0x00,0x00,0x09,0x70,0x00,0x00,0xd7,0x00,0x02,0xf1,
-0x00,0x00,0x01,0xd9,0x10,0x78,0x1d,0x03,0x14,0x9d,0x4e,0x00,0x01,0xa8,0x12,0x22,
-0x00,0x0e,0xa3,0x2b,0x21,0xfd,0xdd,0x39,0x1b,0xa0,0x00,0x14,0x7b,0xc2,0x00,0x01,
-0xd4,0xca,0xd7,0x10,0x4e,0x04,0x90,0x3c,0xaa,0xcd,0x50,0x03,0xb6,0xca,0xd7,0x20,
-0x30,0x11,0xc0,0x2c,0x99,0xcd,0xc3,0x08,0x6b,0xdb,0xe8,0x31,0x01,0x10,0xd2,0x80,
-0x06,0x10,0x59,0x2c,0x07,0x01,0xf3,0x08,0x05,0x4e,0x00,0x11,0xe0,0x73,0x04,0x17,
-0xe0,0x0c,0x00,0x20,0x00,0x01,0x0c,0x00,0x11,0xdb,0x8d,0x17,0xf1,0x10,0x3c,0x04,
-0xa0,0xdc,0xcc,0xd0,0x3b,0x07,0x70,0xd0,0x00,0xe0,0x4a,0x0c,0x20,0xe1,0x11,0xe0,
-0x69,0x4b,0x00,0xfa,0xaa,0xa0,0x96,0x23,0x00,0x20,0x00,0x8d,0xd2,0x36,0x00,0x32,
-0xeb,0x00,0x0e,0xae,0x02,0x00,0x0d,0x00,0x50,0xd9,0x00,0x0e,0x02,0xb0,0x10,0x03,
-0xf0,0x00,0xe6,0xac,0xaa,0xaf,0xaa,0x00,0x1d,0x12,0xc5,0x22,0xf2,0x20,0x02,0xb0,
-0x0b,0x25,0x1e,0x90,0x4a,0xbd,0xfd,0xdd,0xfd,0xd5,0x08,0x70,0x2d,0x31,0x00,0x20,
-0xd2,0x1c,0xbb,0x25,0x37,0x2a,0x0b,0x60,0xf8,0x09,0x00,0x41,0x00,0x32,0xea,0x00,
-0x0e,0x90,0x02,0x51,0xfd,0xdf,0xdd,0xdf,0xd9,0x6a,0x28,0x00,0x1b,0x1f,0x61,0xdf,
-0xdd,0xdf,0xdc,0x00,0x2c,0x0d,0x00,0xf2,0x13,0x03,0xbd,0xdf,0xdd,0xdf,0xdd,0x50,
-0x59,0x0c,0x10,0xc5,0x08,0x60,0x09,0x50,0xc1,0x02,0xec,0x70,0x00,0xe1,0x0e,0x7a,
-0xb3,0xdb,0x30,0x38,0x02,0xb6,0x20,0x00,0x6c,0x40,0x01,0x86,0x31,0x50,0x5c,0xcc,
-0xcf,0xdc,0xcc,0xe2,0x02,0x12,0xd3,0xfe,0x06,0x02,0xf6,0x00,0x0f,0x0d,0x00,0x0a,
-0x07,0xfa,0x03,0x14,0x00,0x82,0x03,0x00,0xe4,0x16,0x00,0x51,0x24,0x80,0xce,0xdc,
-0xcc,0xcc,0xc0,0x02,0x23,0xf3,0x5b,0x00,0x03,0x51,0x07,0x03,0x02,0x22,0x50,0xec,
-0xee,0xff,0xee,0xa0,0x7b,0x43,0x11,0x30,0xcb,0x3d,0x10,0xb3,0xc5,0x17,0x00,0x0d,
-0x00,0x21,0x04,0xd0,0x50,0x15,0x20,0x12,0x0e,0x8e,0x06,0x10,0x40,0xe4,0x12,0x10,
-0x28,0x32,0x06,0x00,0x17,0x1c,0x10,0x08,0xbc,0x05,0x00,0x63,0x1c,0x10,0x69,0x41,
-0x00,0x00,0x6e,0x19,0x13,0xd0,0xfe,0x09,0x04,0x2f,0x0f,0x21,0x3f,0x10,0xe8,0x05,
-0x10,0xbe,0x01,0x0f,0x20,0x7f,0x60,0x98,0x13,0x90,0x2b,0x3a,0xaa,0xae,0xca,0xaa,
-0x10,0x00,0x33,0x17,0x16,0x53,0x8f,0xff,0xff,0xff,0xfe,0x3a,0x0a,0x11,0x06,0x06,
-0x00,0x02,0xd1,0x16,0x23,0x0f,0xee,0xc7,0x20,0x23,0x00,0x1d,0x59,0x01,0x01,0x06,
-0x00,0x21,0x43,0x0e,0xa7,0x04,0x20,0x0f,0x20,0xfd,0x1a,0x64,0x07,0xef,0xff,0xff,
-0xfe,0x80,0x7c,0x09,0x40,0xa5,0x00,0x04,0xc5,0x56,0x0b,0xf0,0x0c,0xbc,0xb2,0x00,
+0x05,0xe4,0x44,0x00,0x50,0x00,0x00,0x0a,0x10,0xd1,0x0f,0x01,0x20,0xe0,0x0d,0x34,
+0x00,0xf0,0x00,0x9f,0xdd,0xfd,0xdd,0xd4,0x00,0x2e,0x22,0x2e,0x32,0x22,0x00,0x0c,
+0x70,0x00,0x58,0x07,0x11,0x20,0x0c,0x01,0x20,0x1f,0xff,0x01,0x00,0x51,0x60,0x00,
+0x00,0x7c,0xc0,0xbd,0x00,0x30,0x2b,0x60,0x00,0x7e,0x0a,0xfe,0x03,0x1d,0x60,0x00,
+0x01,0x8e,0x60,0x00,0x2d,0xb3,0x00,0xd8,0x10,0x00,0x00,0x07,0xd7,0x00,0x00,0x47,
+0x01,0x11,0x3e,0xe5,0x00,0x60,0x30,0x00,0x90,0x0f,0x00,0x81,0x89,0x0a,0xf0,0x0c,
+0xf0,0x1e,0x00,0x00,0x0a,0xd2,0x1f,0x07,0xf3,0x00,0x05,0xb3,0xd5,0xf5,0xd3,0xd5,
+0x01,0xd1,0x02,0xab,0xc4,0x01,0xb0,0x00,0x00,0x4d,0x1d,0xe3,0x00,0xc0,0x4e,0x30,
+0x3e,0x40,0x00,0x01,0x8d,0x20,0x00,0x3e,0x92,0x02,0x50,0x00,0x2a,0x07,0xe2,0x3d,
+0x0b,0x12,0x07,0x3a,0x05,0x60,0x95,0x00,0x8e,0xee,0xee,0x10,0xe5,0x05,0xf0,0x1d,
+0x0a,0x80,0x2e,0xfe,0xea,0x00,0x06,0xb0,0x00,0x2c,0x05,0x80,0x02,0xd0,0x00,0x05,
+0x80,0x86,0x22,0x5d,0x22,0x10,0xa4,0x0c,0x4b,0xbc,0xfb,0xb7,0x0a,0xb4,0xc0,0x00,
+0x2c,0x00,0x00,0x06,0xf8,0x00,0x02,0xc0,0x00,0x00,0x5d,0xe5,0x0d,0x00,0xba,0x6e,
+0x22,0x70,0x03,0xc0,0x00,0x2b,0x20,0x00,0x0d,0xe8,0x5a,0x00,0x00,0x90,0x03,0xf0,
+0x17,0x1e,0x10,0x00,0x00,0xd0,0x00,0x08,0xa0,0x00,0x00,0x0d,0x00,0x01,0xe2,0x0a,
+0x00,0x5e,0xfe,0xf0,0x88,0x00,0x97,0x00,0x58,0x0d,0x4e,0x45,0x67,0xf1,0x09,0x41,
+0xc8,0xca,0x98,0x69,0x80,0xd0,0x59,0x30,0x02,0xa0,0x0d,0x79,0x40,0xfd,0xdd,0xde,
+0x00,0x09,0xf1,0x0e,0x94,0x02,0xf4,0x03,0xba,0xd1,0xe0,0x00,0x0e,0x01,0xab,0x03,
+0x0f,0xaa,0xaa,0xe0,0x2a,0x00,0x00,0xe3,0x33,0x3e,0x55,0x00,0x10,0x0c,0x39,0x01,
+0x20,0x30,0x00,0xda,0x00,0x10,0x50,0x72,0x01,0x11,0xac,0x4f,0x06,0x33,0xb8,0x00,
+0x00,0x6c,0x05,0x02,0xcc,0x0b,0x22,0x80,0x00,0x86,0x05,0x11,0x00,0x0e,0x06,0x05,
+0x0d,0x00,0x10,0xc4,0x05,0x00,0x25,0x2f,0xec,0x9d,0x02,0x03,0x8d,0x02,0xe3,0x0a,
+0xbb,0xbb,0xfc,0xbb,0xba,0x00,0xe3,0x22,0x22,0x22,0x24,0xe0,0x0d,0x5a,0x03,0x31,
+0xde,0xee,0xef,0x07,0x06,0x21,0x19,0x90,0x4c,0x02,0x02,0x5b,0x00,0x35,0xfe,0xee,
+0xee,0xce,0x02,0x08,0xdb,0x02,0x32,0x01,0xee,0xa0,0x87,0x05,0x02,0x2e,0x0d,0x11,
+0xa0,0x8d,0x02,0x02,0x7c,0x07,0x21,0x4c,0x00,0xe1,0x02,0xd0,0x27,0xdd,0xdd,0xe4,
+0x00,0x0b,0x80,0x00,0x01,0xb7,0x00,0x1c,0xe7,0xae,0x0c,0xf1,0x01,0x04,0x78,0x76,
+0xaa,0xbf,0xaa,0xa4,0x00,0x77,0x23,0x33,0xf3,0x33,0x10,0x07,0x70,0x84,0x03,0x11,
+0x77,0xd2,0x03,0x46,0x07,0x70,0x0d,0xea,0xa2,0x00,0x30,0x02,0x21,0x03,0x41,0x00,
+0xf0,0x15,0x83,0x8e,0x67,0xad,0x60,0x00,0xe8,0x59,0x29,0x58,0xc5,0x00,0x0e,0xa7,
+0x8f,0x67,0xae,0x30,0x03,0xe4,0x5c,0x5a,0x44,0xd6,0x00,0xc7,0x66,0x66,0x66,0x66,
+0xe3,0x0c,0x09,0xbb,0xbb,0xb9,0xff,0x04,0xf1,0x02,0x01,0x9c,0x20,0x00,0x02,0x22,
+0x22,0xd8,0x22,0x22,0x10,0xaa,0xaa,0xaf,0xba,0xaa,0xa5,0x34,0x0c,0x00,0x9c,0x00,
+0x11,0xcd,0x4f,0x00,0x23,0x39,0x00,0x2e,0x0d,0x61,0xdf,0xee,0xee,0xee,0xef,0xed,
+0x12,0x0a,0x40,0x91,0x90,0x00,0x00,0x51,0x02,0xc4,0x00,0x5a,0x10,0x00,0xf0,0x49,
+0xea,0x40,0x00,0x0f,0xda,0x61,0xe1,0x00,0x00,0xe0,0x00,0x30,0x48,0x00,0xf1,0x55,
+0x04,0x80,0x08,0xee,0xee,0xef,0xc2,0x00,0x00,0x04,0x79,0x01,0x90,0x12,0x22,0x5e,
+0x22,0x22,0x10,0x0b,0xcb,0xbb,0x00,0x0d,0xd1,0xb3,0x00,0x73,0x00,0x03,0xc0,0x05,
+0x10,0x3d,0x00,0x00,0x15,0x01,0xa0,0x02,0x40,0xe1,0x00,0x07,0xb0,0x67,0x06,0x40,
+0x02,0xf6,0x00,0x4d,0x12,0x01,0x30,0xbe,0x8e,0x20,0x27,0x01,0xf0,0x05,0x9e,0xeb,
+0x40,0x00,0x01,0x59,0xe8,0x00,0x6e,0xc3,0x00,0x7a,0x50,0x00,0x00,0x07,0x50,0x00,
+0x00,0x03,0x81,0x02,0x70,0x22,0x22,0x3f,0x32,0x22,0x20,0x0d,0x4e,0x00,0x31,0xcd,
+0x00,0xd0,0x09,0x0e,0x63,0x09,0x0e,0xee,0xee,0xee,0x19,0x04,0x01,0x31,0x2e,0xee,
+0xee,0x4d,0x01,0x31,0x0d,0x20,0x77,0x7a,0x01,0x01,0xb6,0x02,0xf5,0x04,0x5b,0x00,
+0x77,0x00,0x53,0x00,0x4e,0x30,0x07,0x70,0x0a,0x42,0xdb,0x30,0x00,0x4e,0xee,0xd1,
+0x01,0x34,0x01,0x03,0x55,0x00,0x40,0x42,0x22,0x20,0x0e,0x1f,0x08,0x31,0xce,0x00,
+0xe0,0xe3,0x03,0x64,0x08,0x3e,0xee,0xee,0xee,0x58,0xb6,0x01,0x31,0x2c,0x00,0xf0,
+0x2a,0x09,0x61,0x0f,0xee,0xec,0x00,0x00,0xae,0x0d,0x00,0x31,0x0e,0x99,0x0f,0x52,
+0x0e,0x21,0xbb,0xf1,0xa5,0x0d,0x58,0x5b,0xef,0xff,0xf3,0x01,0x64,0x06,0x03,0x6a,
+0x04,0x10,0x0d,0x0b,0x02,0xf1,0x26,0xeb,0x00,0xe0,0x04,0x00,0x02,0x02,0xd0,0x06,
+0x09,0xa0,0x02,0xd7,0x16,0x00,0x1b,0xb0,0x2f,0x20,0xaa,0x00,0x08,0x80,0x1d,0x9d,
+0x20,0x94,0x00,0x00,0x2d,0x40,0x6e,0x30,0x00,0x00,0x7f,0x61,0x11,0x6f,0xa1,0x03,
+0xec,0xfb,0xbb,0xbb,0xfa,0xf2,0x03,0x2c,0x00,0x00,0x0e,0x11,0x3a,0x03,0x90,0xe1,
+0x00,0x00,0x2f,0xdd,0xdd,0xdf,0x10,0x00,0x14,0x00,0x01,0x00,0xf4,0x28,0x3c,0x00,
+0x00,0x00,0x0d,0xcc,0xcc,0xdc,0xcc,0xce,0x20,0xd0,0x88,0x88,0x88,0x84,0xc2,0x27,
+0x7d,0x55,0xe5,0x59,0xb7,0x32,0x69,0xb5,0x5e,0x55,0xaa,0x63,0x00,0x39,0x99,0x99,
+0x99,0x30,0x00,0x07,0xa9,0x99,0x99,0x9b,0x00,0x00,0x9b,0x88,0x88,0x89,0xd0,0x00,
+0x09,0xa7,0x77,0x77,0x8d,0x0d,0x00,0xf1,0x1e,0x03,0x7c,0x40,0x3b,0x95,0x00,0x09,
+0x95,0x00,0x00,0x02,0x79,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x0d,0xdd,0xdd,0xfd,
+0xdd,0xda,0x0e,0x00,0x36,0x00,0x00,0x2c,0x06,0x5c,0x83,0x4b,0xbd,0x35,0x00,0x69,
+0x55,0x05,0x5c,0x30,0x00,0x6a,0x06,0x00,0xfa,0x15,0x6c,0xbb,0xbb,0xbd,0x30,0x00,
+0x07,0xc0,0x00,0x00,0x00,0x01,0x9e,0xcc,0xcc,0xcc,0xe5,0x2d,0x79,0x27,0x72,0xa1,
+0xa4,0x00,0x3a,0x0c,0x39,0x34,0xd2,0x00,0x52,0x05,0x01,0x9d,0xb0,0x00,0x01,0x00,
+0xf6,0x3d,0x5c,0x00,0x00,0x00,0x0f,0xcc,0xcc,0xcc,0xcc,0xce,0x40,0xe0,0x0b,0x10,
+0x77,0x00,0x94,0x06,0xbb,0xeb,0xbd,0xdb,0xb8,0x20,0x05,0x9c,0xa9,0xbb,0x98,0x00,
+0x00,0x86,0x22,0x22,0x23,0xd0,0x00,0x08,0xb9,0x99,0x99,0xad,0x00,0x00,0x8a,0x88,
+0x88,0x88,0xd0,0x00,0x08,0xca,0xaa,0xaa,0xbd,0x00,0x00,0x01,0xe1,0x0d,0x1c,0x91,
+0x00,0x02,0xc7,0x00,0xd1,0x09,0x78,0x2d,0xc5,0x00,0x08,0xcb,0xbc,0x30,0x56,0x00,
+0x11,0x86,0x06,0x00,0x23,0x08,0x60,0x0d,0x00,0x20,0x01,0xff,0x01,0x00,0x13,0xf7,
+0x1a,0x00,0x21,0x03,0x60,0x1a,0x00,0x21,0x1d,0x50,0x27,0x00,0x21,0x2e,0x10,0x27,
+0x00,0x1a,0x75,0x34,0x00,0x10,0x96,0x05,0x00,0x38,0x6f,0xfc,0x20,0xab,0x00,0xf0,
+0x0a,0x03,0xb0,0x02,0x77,0x77,0x30,0x00,0x3b,0x00,0x27,0x77,0xb6,0x00,0x03,0xb0,
+0x00,0x60,0x0b,0x3d,0xee,0xff,0xe4,0x0c,0x50,0xf0,0x0d,0x00,0xf1,0x16,0x2e,0x6a,
+0x04,0x40,0x3b,0x00,0x00,0x6f,0x50,0x2d,0x03,0xb0,0x00,0x03,0xf5,0x00,0x96,0x3b,
+0x00,0x00,0xd7,0xe0,0x03,0x63,0xb0,0x00,0xaa,0x09,0x60,0x00,0x3b,0x00,0x4c,0x00,
+0x00,0x00,0x04,0xfd,0x00,0x3b,0x1f,0xe6,0x00,0x01,0x00,0xf3,0x0c,0x84,0x00,0x00,
+0x0e,0x00,0x01,0x9e,0x99,0x00,0x00,0xe0,0x00,0x2c,0x33,0xe0,0x00,0x0e,0x00,0x02,
+0xeb,0xbf,0x7e,0xee,0xfe,0x60,0x2b,0x00,0x0d,0x00,0xf2,0x10,0x09,0x00,0xe0,0x00,
+0x2b,0x00,0xe0,0x87,0x0e,0x00,0x3d,0xdd,0xff,0x00,0xd0,0xe0,0x00,0x00,0x88,0xe0,
+0x05,0x0e,0x00,0x00,0x9a,0x0e,0x00,0x00,0xe0,0x03,0xd7,0x27,0x00,0x55,0x04,0xdb,
+0x00,0xbe,0xa0,0xad,0x00,0xfb,0x3c,0xa0,0x00,0x93,0x00,0x00,0xd0,0x3a,0x00,0x9e,
+0xbb,0xb0,0x0d,0x03,0xa2,0xb7,0x60,0x69,0x00,0xd0,0x3a,0xa5,0x16,0xbd,0x10,0x0c,
+0xde,0xa0,0x2c,0x7c,0x10,0x00,0x00,0x3a,0x16,0xd8,0x0d,0x00,0x02,0x25,0xa8,0x82,
+0x00,0xe0,0x02,0xeb,0xca,0xcd,0xdd,0xdf,0xd8,0x0c,0x13,0xa0,0x83,0x00,0xe0,0x00,
+0xc0,0x3a,0x02,0xd1,0x0e,0x00,0x0b,0x03,0xa0,0x05,0x20,0xe0,0x03,0x60,0x3a,0x00,
+0x0b,0xea,0xaf,0x00,0xf0,0x2a,0x45,0x69,0x35,0x00,0x0d,0x10,0x0b,0x96,0x97,0xb0,
+0x00,0xd1,0x00,0x2b,0x69,0xa1,0x00,0x0d,0x10,0x5e,0xee,0xfe,0xe4,0x22,0xe3,0x00,
+0x0a,0x00,0xb0,0xab,0xbf,0xc3,0x01,0x84,0x69,0x10,0x10,0xd1,0x00,0xab,0xdd,0xb8,
+0x59,0x0d,0x10,0x00,0x08,0x50,0x00,0xd1,0xd1,0x00,0x7c,0xee,0xc6,0x08,0x3d,0x0d,
+0x00,0xfa,0x01,0x10,0x00,0xd1,0x02,0x8a,0xde,0xca,0x10,0x0d,0x10,0x15,0x31,0x00,
+0x00,0x9e,0xc0,0x5b,0x00,0xf1,0x3d,0x73,0x00,0x2b,0x00,0xa4,0x00,0x02,0xd3,0xab,
+0xcd,0xbd,0xbb,0x00,0x02,0x00,0x88,0xe8,0x88,0x00,0x4e,0xe4,0x1d,0x44,0x44,0xe1,
+0x00,0x09,0x41,0xd4,0x44,0x4e,0x10,0x00,0x94,0x1e,0x77,0x77,0xe1,0x00,0x5c,0xa5,
+0x97,0x77,0x78,0x00,0x1b,0x00,0x6b,0xbb,0xcd,0xcc,0x30,0x22,0x22,0x22,0x27,0xa2,
+0x20,0x29,0x9d,0xa9,0x99,0xcd,0x99,0x10,0x00,0x8c,0x10,0x05,0x90,0x00,0x00,0x00,
+0x41,0x3c,0xd6,0x51,0x00,0x11,0xf1,0x06,0x00,0x25,0x0f,0x10,0x0d,0x00,0xf0,0x0c,
+0x06,0x70,0x0f,0x10,0x94,0x00,0x00,0xb5,0x00,0xf1,0x04,0xd0,0x00,0x0f,0x10,0x0f,
+0x10,0x0c,0x50,0x06,0xc0,0x00,0xf1,0x00,0x5c,0x00,0xe3,0x27,0x00,0x20,0xf2,0x4b,
+0x27,0x00,0x21,0x0a,0x70,0x34,0x00,0x14,0x20,0x41,0x00,0x27,0x4f,0xfb,0xa4,0x00,
+0xf5,0x02,0xdf,0xff,0xff,0xff,0xf0,0x00,0x0d,0x20,0x00,0x00,0x0f,0x00,0x00,0xd2,
+0x00,0x00,0x00,0x0d,0x00,0xf0,0x18,0xef,0xff,0xff,0xff,0xe0,0x00,0x0f,0x00,0x05,
+0xa0,0x00,0x00,0x01,0xe0,0x00,0x0e,0x10,0x00,0x00,0x4b,0x00,0x00,0x7a,0x00,0x00,
+0x09,0x70,0x00,0x00,0xd7,0x00,0x02,0xf1,0x00,0x00,0x01,0xd9,0x10,0x78,0x1d,0x03,
+0x14,0x9d,0x4e,0x00,0x70,0xfd,0xdd,0xdd,0xdd,0xdd,0x00,0x0e,0x14,0x00,0x11,0xd0,
+0x0d,0x00,0xf7,0x27,0xdc,0x00,0x0e,0x00,0x14,0x7b,0xc2,0x00,0x01,0xd4,0xca,0xd7,
+0x10,0x00,0x00,0x2c,0x00,0x3c,0xaa,0xcd,0x50,0x03,0xb6,0xca,0xd7,0x20,0x00,0x00,
+0x4a,0x00,0x2c,0x99,0xcd,0xc3,0x08,0x6b,0xdb,0xe8,0x31,0x01,0x10,0xd2,0x00,0x0b,
+0x40,0x00,0x59,0x2c,0x00,0x00,0x6e,0xee,0xee,0x30,0x4e,0x00,0x40,0xe0,0x00,0xf0,
+0x00,0x4a,0x02,0x06,0x0c,0x00,0x20,0x00,0x01,0x0c,0x00,0x30,0xdb,0x02,0xc0,0x13,
+0x04,0xf1,0x0f,0x04,0xa0,0xdc,0xcc,0xd0,0x3b,0x07,0x70,0xd0,0x00,0xe0,0x4a,0x0c,
+0x20,0xe1,0x11,0xe0,0x69,0x4b,0x00,0xfa,0xaa,0xa0,0x96,0x23,0x00,0x20,0x00,0x8d,
+0xd2,0x36,0x00,0x32,0xeb,0x00,0x0e,0xae,0x02,0x00,0x0d,0x00,0x50,0xd9,0x00,0x0e,
+0x02,0xb0,0x10,0x03,0xf0,0x0d,0xe6,0xac,0xaa,0xaf,0xaa,0x00,0x1d,0x12,0xc5,0x22,
+0xf2,0x20,0x02,0xb0,0x0b,0x30,0x0e,0x00,0x00,0x4a,0xbd,0xfd,0xdd,0xfd,0xd5,0x08,
+0x70,0x2d,0x31,0x00,0x91,0xd2,0x1c,0x60,0x00,0xe0,0x00,0x2a,0x0b,0x60,0x3e,0x00,
+0x06,0x90,0x00,0x32,0xea,0x00,0x0e,0x90,0x02,0xf1,0x05,0xfd,0xdf,0xdd,0xdf,0xd9,
+0x00,0x0e,0x00,0xe0,0x00,0xe0,0x00,0x01,0xd9,0xdf,0xdd,0xdf,0xdc,0x00,0x2c,0x0d,
+0x00,0xf0,0x14,0x03,0xbd,0xdf,0xdd,0xdf,0xdd,0x50,0x59,0x0c,0x10,0xc5,0x08,0x60,
+0x09,0x50,0xc1,0x02,0xec,0x70,0x00,0xe1,0x0e,0x7a,0xb3,0xdb,0x30,0x38,0x02,0xb6,
+0x20,0x00,0x6c,0x40,0x01,0x22,0x01,0x00,0x60,0x00,0x5c,0xcc,0xcf,0xdc,0xcc,0xe2,
+0x02,0x11,0xd3,0x5d,0x00,0x12,0x0d,0xf6,0x00,0x0f,0x0d,0x00,0x0a,0x07,0xfa,0x03,
+0x15,0x00,0x82,0x03,0x20,0x00,0x78,0x05,0x00,0x90,0xcc,0xce,0xdc,0xcc,0xcc,0xc0,
+0x02,0x23,0xf3,0x5b,0x00,0x21,0x00,0x4c,0x19,0x00,0x21,0x09,0x80,0x07,0x00,0xf0,
+0x05,0xec,0xee,0xff,0xee,0xa0,0x00,0x5b,0x00,0x0b,0x30,0x00,0x00,0x0d,0x40,0x00,
+0xb3,0x00,0x00,0x08,0xa0,0x0d,0x00,0x30,0x04,0xd0,0x00,0x0d,0x00,0xe0,0x12,0x0e,
+0xee,0xef,0xfe,0xee,0x40,0x00,0x06,0x10,0x00,0x28,0x00,0x00,0x28,0x00,0xc0,0x60,
+0x00,0x08,0xee,0xee,0xfe,0xee,0xe9,0x00,0x00,0x00,0x69,0x41,0x00,0x50,0xdd,0xdf,
+0xed,0xdd,0xd0,0x05,0x02,0x00,0x61,0x04,0x81,0xee,0xff,0xee,0xee,0xee,0x20,0x00,
+0x3f,0x85,0x02,0xf1,0x0f,0x2e,0xbe,0xef,0xee,0xe2,0x00,0x7f,0x60,0x00,0xc3,0x00,
+0x00,0x2b,0x3a,0xaa,0xae,0xca,0xaa,0x10,0x00,0x33,0x33,0x33,0x33,0x30,0x8f,0xff,
+0xff,0xff,0xfe,0x7e,0x00,0x31,0x1e,0x00,0x06,0x06,0x00,0x11,0x0e,0x06,0x00,0x51,
+0x0f,0xee,0xee,0xee,0xee,0x0c,0x00,0x13,0x1d,0x59,0x01,0x01,0x06,0x00,0x21,0x43,
+0x0e,0xa7,0x04,0xc3,0x0f,0x20,0x00,0x00,0x01,0xe3,0x07,0xef,0xff,0xff,0xfe,0x80,
+0xe4,0x00,0xf0,0x3c,0x07,0xa5,0x00,0x04,0xc5,0x00,0x00,0x02,0x7d,0xbc,0xb2,0x00,
 0x00,0x15,0x9d,0xf8,0x8d,0xa3,0x00,0x04,0x95,0x2e,0x00,0x05,0x90,0x02,0xdd,0xde,
-0xfd,0xdd,0xdd,0xd2,0x00,0x04,0xd0,0x33,0xcd,0x06,0x10,0xe5,0x8a,0x17,0xf0,0x02,
-0x03,0xef,0xdd,0xee,0xdd,0xf2,0x03,0xe6,0xe0,0x07,0x60,0x0c,0x20,0x01,0x0e,0x00,
-0x76,0xb1,0x0d,0x40,0xe0,0x07,0x65,0xce,0x19,0x24,0x11,0x76,0xfc,0x3a,0xf1,0x10,
-0x2a,0x0b,0x2a,0x30,0x00,0x13,0xc3,0xb1,0xc3,0xb4,0x10,0x2b,0xce,0xbe,0xbe,0xbe,
-0xcb,0x20,0x09,0x52,0xb1,0xc2,0xa4,0x41,0x0a,0x70,0x18,0x88,0x14,0xaa,0x10,0x80,
-0x0e,0x40,0xc0,0x0e,0x00,0x00,0x31,0x0c,0x81,0x98,0xcc,0xcf,0xcc,0xca,0x90,0x00,
-0xa4,0x7c,0x22,0x20,0x0a,0x40,0x6f,0x22,0x00,0x0d,0x00,0x23,0xad,0x90,0xb7,0x00,
-0xf1,0x02,0x08,0x40,0x0f,0x00,0x66,0x00,0x3d,0x00,0xf0,0x1d,0x10,0xcd,0xed,0xdf,
-0xdd,0xdd,0xce,0x17,0x09,0x00,0xbf,0x19,0x22,0xd1,0xc0,0x4a,0x29,0xf1,0x13,0xab,
-0xbf,0xbb,0xa0,0x00,0x11,0x11,0xe2,0x11,0x10,0x1f,0xcc,0xcf,0xdc,0xcf,0x11,0xe0,
-0x00,0xe1,0x00,0xe1,0x1e,0x00,0x0e,0x12,0x2f,0x10,0x90,0x00,0xe1,0x6a,0x80,0x05,
-0x60,0x0c,0x09,0xf0,0x29,0x60,0x4e,0xcc,0xcc,0xe3,0x7a,0xb7,0x4a,0x9a,0xaa,0xa3,
-0xda,0xad,0x4a,0x00,0x00,0xa3,0xb5,0x6b,0x4a,0xaa,0xaa,0xa3,0xb5,0x6b,0x25,0x11,
-0x11,0x51,0xb5,0x6b,0x0d,0xaa,0xaa,0xe0,0xb5,0x6b,0x0d,0x77,0x77,0xe0,0xb5,0x9c,
-0x0d,0x22,0x22,0xe0,0x45,0x71,0x0d,0xbb,0xbb,0xe0,0x05,0x60,0x0d,0xc8,0x2b,0x10,
-0x60,0x0c,0x00,0x20,0x06,0x50,0x7e,0x15,0x00,0x06,0x00,0x40,0xdc,0xc2,0x7a,0xa7,
+0xfd,0xdd,0xdd,0xd2,0x00,0x04,0xd0,0x33,0x00,0x00,0x00,0x02,0xe5,0x07,0x60,0x00,
+0x00,0x03,0xef,0xdd,0xee,0xdd,0xf2,0x03,0xe6,0xe0,0x07,0x60,0x0c,0x20,0x01,0x0e,
+0x00,0x76,0x00,0xc2,0x00,0x00,0xe0,0x07,0x65,0xce,0x10,0x00,0x02,0x00,0x76,0x4f,
+0x00,0xf0,0x12,0x2b,0x2a,0x0b,0x2a,0x30,0x00,0x13,0xc3,0xb1,0xc3,0xb4,0x10,0x2b,
+0xce,0xbe,0xbe,0xbe,0xcb,0x20,0x09,0x52,0xb1,0xc2,0xa4,0x41,0x0a,0x70,0x18,0x88,
+0x14,0xaa,0x10,0xcc,0x01,0x00,0xf0,0x0c,0xc0,0x0e,0x00,0x00,0xa0,0x00,0x0e,0x00,
+0x98,0xcc,0xcf,0xcc,0xca,0x90,0x00,0xa4,0x00,0xe0,0x02,0xc0,0x00,0x0a,0x40,0x0e,
+0x00,0x2c,0x00,0x0d,0x00,0x23,0xad,0x90,0xb7,0x00,0xf0,0x03,0x08,0x40,0x0f,0x00,
+0x66,0x00,0x3d,0x00,0xf0,0x1d,0x10,0xcd,0xed,0xdf,0xdd,0xdd,0xce,0x00,0xd8,0x00,
+0x70,0xd0,0xeb,0xbb,0xbb,0xd1,0xc0,0x0e,0xe2,0x00,0xf1,0x13,0x00,0xab,0xbf,0xbb,
+0xa0,0x00,0x11,0x11,0xe2,0x11,0x10,0x1f,0xcc,0xcf,0xdc,0xcf,0x11,0xe0,0x00,0xe1,
+0x00,0xe1,0x1e,0x00,0x0e,0x12,0x2f,0x10,0x90,0x00,0xe1,0x6a,0x80,0x05,0xa0,0x05,
+0xf0,0x2f,0x05,0x60,0x4e,0xcc,0xcc,0xe3,0x7a,0xb7,0x4a,0x9a,0xaa,0xa3,0xda,0xad,
+0x4a,0x00,0x00,0xa3,0xb5,0x6b,0x4a,0xaa,0xaa,0xa3,0xb5,0x6b,0x25,0x11,0x11,0x51,
+0xb5,0x6b,0x0d,0xaa,0xaa,0xe0,0xb5,0x6b,0x0d,0x77,0x77,0xe0,0xb5,0x9c,0x0d,0x22,
+0x22,0xe0,0x45,0x71,0x0d,0xbb,0xbb,0xe0,0x05,0x60,0x0d,0x00,0x00,0xe0,0x05,0x60,
+0x0c,0x00,0x60,0x06,0x50,0x00,0x0d,0x00,0x00,0x06,0x00,0x40,0xdc,0xc2,0x7a,0xa7,
 0x0c,0x00,0x80,0xda,0xad,0x0c,0xcd,0xcc,0xd0,0xb6,0x5a,0x24,0x00,0x20,0xb6,0x5a,
 0x24,0x00,0x09,0x0c,0x00,0x10,0x8c,0x0c,0x00,0xf4,0x03,0x56,0x73,0x0b,0xdd,0xdd,
 0xc0,0x06,0x50,0x08,0xa0,0x1b,0x20,0x06,0x50,0xc7,0x00,0x01,0xa0,0x90,0x00,0xf0,
-0x33,0x6c,0xcc,0xcc,0xc7,0x37,0x83,0x03,0x33,0x33,0x30,0xec,0xde,0x0d,0x77,0x77,
+0x80,0x6c,0xcc,0xcc,0xc7,0x37,0x83,0x03,0x33,0x33,0x30,0xec,0xde,0x0d,0x77,0x77,
 0xd0,0xb5,0x6a,0x0d,0x22,0x22,0xd0,0xb5,0x6a,0x06,0x77,0x77,0x60,0xb5,0x6a,0x5a,
 0xaa,0xaa,0xa4,0xb5,0x6a,0x77,0x1b,0x31,0x86,0xb5,0x9d,0x78,0x1c,0x31,0x86,0x65,
 0x74,0x6c,0xae,0xba,0xd6,0x05,0x60,0x67,0x0b,0x20,0x86,0x05,0x60,0x6d,0xcc,0xcc,
-0xd5,0x00,0x02,0xa8,0x2c,0x40,0x02,0xcc,0xcf,0xcc,0xbe,0x1a,0xf0,0x27,0x46,0xa5,
-0x55,0xb6,0x40,0x00,0x0b,0x63,0x33,0x33,0x5d,0x00,0x00,0xbb,0x99,0x99,0x9a,0xd0,
-0x00,0x0b,0x86,0x66,0x66,0x7d,0x00,0x00,0x23,0x9b,0x33,0x33,0x30,0x03,0xcc,0xfe,
-0xcd,0xce,0xec,0xc3,0x01,0x9e,0x32,0xe2,0x3d,0x70,0x03,0xea,0xe9,0xaf,0x99,0xdb,
-0xd3,0x00,0x3a,0x00,0x79,0x30,0x71,0x03,0xa0,0x0e,0x09,0xd3,0x00,0x06,0xf0,0x36,
-0x60,0x00,0x02,0x20,0x0d,0x20,0x15,0xd5,0x18,0x20,0xd2,0x07,0x89,0x27,0x90,0x0d,
-0x20,0xd1,0x00,0x00,0x04,0x30,0xd2,0x25,0xde,0x10,0xbe,0xbf,0xcb,0xbb,0xb5,0x03,
-0x33,0x33,0xd5,0x33,0x33,0x10,0x10,0x1c,0x05,0x0d,0x00,0xfc,0x3e,0x18,0x00,0xe0,
-0x09,0x00,0x00,0x08,0x31,0x0e,0x04,0x82,0x40,0x03,0x91,0xc0,0xd2,0xc5,0xc2,0x00,
-0xbc,0xe2,0x0c,0x48,0xd7,0x30,0x00,0xa4,0x75,0xa4,0x89,0x5d,0x00,0x9e,0xbb,0xc7,
-0x9c,0xd7,0xa3,0x03,0x2d,0x34,0x6b,0x29,0x92,0x10,0xbb,0xfb,0xbb,0xfb,0xbb,0xb5,
-0x00,0x3e,0x10,0x09,0x67,0x90,0x00,0x08,0xac,0x60,0x2e,0xb0,0x12,0x02,0xe1,0x05,
-0x5c,0xcb,0x14,0x90,0xc3,0x00,0xb9,0x10,0x6d,0xe3,0xf8,0x06,0x10,0x0c,0x28,0x16,
-0x70,0x99,0x99,0xcd,0x99,0x99,0x00,0x98,0x19,0x35,0x30,0x40,0x09,0x45,0x05,0x39,
-0xf0,0x0b,0x00,0x94,0x00,0x20,0x06,0xd2,0x00,0x0a,0x40,0x1c,0xb9,0xc1,0x00,0x00,
-0xb3,0x22,0x27,0xf9,0x22,0x10,0x0c,0x4a,0xaa,0xbf,0xaa,0xdb,0x55,0x26,0xb1,0xe0,
-0x2d,0x10,0x1e,0x00,0x00,0x1e,0x03,0x20,0x06,0xa0,0x60,0x03,0x4e,0x83,0x00,0x5e,
-0xe9,0x27,0x36,0x20,0x09,0x70,0x6b,0x10,0xe0,0xcc,0xdf,0xcc,0xcc,0x30,0x1d,0x11,
-0x61,0x11,0x61,0x10,0x01,0xd0,0x0e,0x91,0x05,0x81,0x1d,0xac,0xfc,0xcc,0xfd,0xc2,
-0x02,0xc0,0x0d,0x00,0xf6,0x18,0x3b,0x00,0x99,0x99,0x90,0x00,0x04,0xa7,0xaa,0xaa,
-0xaa,0xa1,0x00,0x69,0x15,0xc2,0x12,0xa9,0x00,0x09,0x50,0x04,0xc6,0xc8,0x00,0x00,
-0xe2,0x47,0xad,0xce,0xa7,0x30,0x17,0x09,0x74,0x00,0x05,0x8b,0x20,0x99,0x1e,0x20,
-0x20,0x00,0x6d,0x17,0xf7,0x36,0xfe,0xdd,0xdd,0x40,0xc1,0x03,0x21,0x01,0x40,0x00,
-0x0c,0x49,0x65,0xb2,0x67,0x00,0x00,0xc1,0x67,0x75,0x0b,0xdc,0xc4,0x0d,0x6e,0xee,
-0xd9,0xf2,0x3a,0x00,0xd6,0x50,0x04,0xfc,0x76,0x70,0x0d,0x55,0xdd,0x49,0x1b,0xb3,
-0x00,0xd5,0x57,0x84,0x70,0xbc,0x00,0x3b,0x55,0xdc,0x47,0x0a,0xa0,0x07,0x85,0x53,
-0x04,0x77,0xab,0x70,0x92,0x55,0x07,0xcb,0x90,0x0b,0x40,0x8a,0x0b,0xd0,0x5a,0x21,
-0xdd,0xf5,0x4a,0xde,0xf8,0x40,0x00,0x2d,0x01,0x10,0x1d,0x60,0x12,0xf0,0x0c,0x06,
-0x01,0xd0,0x00,0x02,0xd1,0x11,0xc0,0x1e,0x88,0x50,0x7c,0xcd,0x1c,0x01,0xe7,0x74,
-0x03,0x04,0xa1,0xc0,0x1d,0x00,0x00,0x78,0xa6,0x1c,0x61,0x27,0x70,0xde,0x01,0xeb,
-0xbf,0xbb,0x80,0x09,0xa7,0x46,0x50,0x11,0x02,0xe8,0xe8,0x31,0xb9,0x2c,0x66,0x02,
-0x8b,0xde,0xee,0xeb,0x03,0xd3,0x21,0xf0,0x24,0x80,0x00,0x01,0xdd,0xf4,0x9a,0xcd,
-0xaa,0x30,0x00,0x2c,0x01,0x16,0x91,0x85,0x00,0x0a,0x49,0xcc,0xde,0xce,0xd3,0x02,
-0xe4,0x00,0x06,0x80,0x85,0x00,0x59,0xd3,0xbb,0xdd,0xbb,0x30,0x03,0x0d,0x16,0x6a,
-0xb6,0x63,0x00,0xb5,0xc0,0x44,0x8a,0x44,0x20,0x03,0xe7,0x7c,0x98,0x2d,0xf5,0x04,
-0x0e,0x90,0x00,0x58,0x00,0x00,0x08,0x77,0xc4,0x21,0x10,0x00,0x03,0xc0,0x03,0x9d,
-0xee,0xdd,0xe3,0xbc,0x17,0x00,0x6f,0x22,0x00,0xe7,0x06,0x21,0x06,0x90,0xf4,0x06,
-0x23,0x69,0x00,0x0d,0x00,0xd0,0x03,0x33,0xf3,0x33,0x8a,0x33,0x10,0xbb,0xbf,0xbb,
-0xbd,0xeb,0xb5,0x14,0x1b,0x10,0x69,0x69,0x32,0x01,0x27,0x00,0x20,0x1e,0x20,0x0d,
-0x00,0x20,0x1c,0x70,0x0d,0x00,0x23,0x0b,0x60,0x1c,0x05,0x04,0xa7,0x04,0x21,0x85,
-0x80,0x8b,0x05,0x90,0x0b,0x80,0x03,0x33,0x33,0x39,0xa3,0x47,0x10,0x51,0x0b,0x23,
-0xbb,0xb4,0xa5,0x05,0xb0,0x8c,0xcc,0xcc,0x3d,0x00,0x00,0x01,0x16,0xa1,0x10,0xf0,
-0xa6,0x37,0x00,0xd2,0x05,0x00,0x35,0x18,0xf0,0x02,0x87,0x01,0x20,0x00,0x4b,0x58,
+0xd5,0x00,0x02,0xc0,0x00,0xd1,0x00,0x02,0xcc,0xcf,0xcc,0xcf,0xcc,0xc2,0x00,0x46,
+0xa5,0x55,0xb6,0x40,0x00,0x0b,0x63,0x33,0x33,0x5d,0x00,0x00,0xbb,0x99,0x99,0x9a,
+0xd0,0x00,0x0b,0x86,0x66,0x66,0x7d,0x00,0x00,0x23,0x9b,0x33,0x33,0x30,0x03,0xcc,
+0xfe,0xcd,0xce,0xec,0xc3,0x01,0x9e,0x32,0xe2,0x3d,0x70,0x03,0xea,0xe9,0xaf,0x99,
+0xdb,0xd3,0x00,0x3a,0x00,0xe0,0x09,0x50,0x00,0x03,0xa0,0x0e,0x09,0xd3,0x00,0x06,
+0xf6,0x02,0xf1,0x1b,0xfb,0x00,0x02,0x20,0x0d,0x20,0x15,0x00,0x00,0x2d,0x00,0xd2,
+0x07,0x90,0x00,0x00,0xb4,0x0d,0x20,0xd1,0x00,0x00,0x04,0x30,0xd2,0x25,0x00,0x00,
+0xbb,0xbb,0xbf,0xcb,0xbb,0xb5,0x03,0x33,0x33,0xd5,0x33,0x33,0x10,0x00,0xc1,0x04,
+0x12,0x00,0xce,0x04,0x0a,0x0d,0x00,0xfc,0x3e,0x18,0x00,0xe0,0x09,0x00,0x00,0x08,
+0x31,0x0e,0x04,0x82,0x40,0x03,0x91,0xc0,0xd2,0xc5,0xc2,0x00,0xbc,0xe2,0x0c,0x48,
+0xd7,0x30,0x00,0xa4,0x75,0xa4,0x89,0x5d,0x00,0x9e,0xbb,0xc7,0x9c,0xd7,0xa3,0x03,
+0x2d,0x34,0x6b,0x29,0x92,0x10,0xbb,0xfb,0xbb,0xfb,0xbb,0xb5,0x00,0x3e,0x10,0x09,
+0x67,0x90,0x00,0x08,0xac,0x60,0x2e,0xb0,0x12,0x02,0xe1,0x05,0x5c,0xcb,0x14,0x90,
+0xc3,0x00,0xb9,0x10,0x6d,0xe3,0xf8,0x06,0xf1,0x31,0x0c,0x40,0x00,0x00,0x06,0x99,
+0x99,0xcd,0x99,0x99,0x00,0x98,0x44,0x44,0x44,0x44,0x40,0x09,0x45,0xcc,0xcc,0xcc,
+0x80,0x00,0x94,0x00,0x20,0x06,0xd2,0x00,0x0a,0x40,0x1c,0xb9,0xc1,0x00,0x00,0xb3,
+0x22,0x27,0xf9,0x22,0x10,0x0c,0x4a,0xaa,0xbf,0xaa,0xdb,0x00,0xd1,0x00,0x01,0xe0,
+0x2d,0x10,0x1e,0x00,0x00,0x1e,0x03,0x20,0x06,0xa0,0x60,0x03,0x4c,0x83,0x00,0x5e,
+0xe9,0x59,0x00,0x02,0x72,0x05,0xf0,0x01,0x01,0xcc,0xcc,0xdf,0xcc,0xcc,0x30,0x1d,
+0x11,0x61,0x11,0x61,0x10,0x01,0xd0,0x0e,0x91,0x05,0x81,0x1d,0xac,0xfc,0xcc,0xfd,
+0xc2,0x02,0xc0,0x0d,0x00,0xf0,0x17,0x3b,0x00,0x99,0x99,0x90,0x00,0x04,0xa7,0xaa,
+0xaa,0xaa,0xa1,0x00,0x69,0x15,0xc2,0x12,0xa9,0x00,0x09,0x50,0x04,0xc6,0xc8,0x00,
+0x00,0xe2,0x47,0xad,0xce,0xa7,0x30,0x17,0x09,0x74,0x00,0x05,0x8b,0x0e,0x01,0x12,
+0x10,0x99,0x03,0xf6,0x3c,0x20,0x00,0x00,0x0a,0xdd,0xdd,0xfe,0xdd,0xdd,0x40,0xc1,
+0x03,0x21,0x01,0x40,0x00,0x0c,0x49,0x65,0xb2,0x67,0x00,0x00,0xc1,0x67,0x75,0x0b,
+0xdc,0xc4,0x0d,0x6e,0xee,0xd9,0xf2,0x3a,0x00,0xd6,0x50,0x04,0xfc,0x76,0x70,0x0d,
+0x55,0xdd,0x49,0x1b,0xb3,0x00,0xd5,0x57,0x84,0x70,0xbc,0x00,0x3b,0x55,0xdc,0x47,
+0x0a,0xa0,0x07,0x85,0x53,0x04,0x77,0xab,0x70,0x92,0x55,0x07,0xcb,0x90,0x0b,0x40,
+0xab,0x00,0xf5,0x3c,0x02,0x5a,0x21,0xdd,0xf5,0x4a,0xde,0xf8,0x40,0x00,0x2d,0x01,
+0x10,0x1d,0x00,0x00,0x09,0x50,0x06,0x01,0xd0,0x00,0x02,0xd1,0x11,0xc0,0x1e,0x88,
+0x50,0x7c,0xcd,0x1c,0x01,0xe7,0x74,0x03,0x04,0xa1,0xc0,0x1d,0x00,0x00,0x78,0xa6,
+0x1c,0x01,0xd0,0x00,0x00,0xde,0x01,0xeb,0xbf,0xbb,0x80,0x09,0xe3,0x01,0x11,0x11,
+0x11,0x02,0xe8,0xe8,0x31,0x00,0x00,0x01,0xe6,0x02,0x8b,0xde,0xee,0xeb,0x03,0x54,
+0x00,0xf4,0x3b,0x05,0x80,0x00,0x01,0xdd,0xf4,0x9a,0xcd,0xaa,0x30,0x00,0x2c,0x01,
+0x16,0x91,0x85,0x00,0x0a,0x49,0xcc,0xde,0xce,0xd3,0x02,0xe4,0x00,0x06,0x80,0x85,
+0x00,0x59,0xd3,0xbb,0xdd,0xbb,0x30,0x03,0x0d,0x16,0x6a,0xb6,0x63,0x00,0xb5,0xc0,
+0x44,0x8a,0x44,0x20,0x03,0xe7,0x7c,0xcd,0xec,0xcc,0x00,0x0e,0x90,0x00,0x58,0x00,
+0x00,0x08,0x77,0xc4,0x21,0x10,0x00,0x03,0xc0,0x03,0x9d,0xee,0xdd,0xb5,0x01,0x60,
+0x08,0xee,0xfe,0xee,0xff,0xee,0xe7,0x06,0x21,0x06,0x90,0xf4,0x06,0x23,0x69,0x00,
+0x0d,0x00,0xf1,0x01,0x03,0x33,0xf3,0x33,0x8a,0x33,0x10,0xbb,0xbf,0xbb,0xbd,0xeb,
+0xb5,0x00,0x02,0xd0,0x1a,0x00,0x11,0x79,0x27,0x00,0x20,0x1e,0x20,0x0d,0x00,0x20,
+0x1c,0x70,0x0d,0x00,0x23,0x0b,0x60,0x1c,0x05,0x04,0xa7,0x04,0x21,0x85,0x80,0x8b,
+0x05,0xf3,0x00,0x0b,0x80,0x03,0x33,0x33,0x39,0xa3,0x47,0x10,0xbb,0xbb,0xbb,0xce,
+0xbb,0xb4,0xa5,0x05,0xa0,0x8c,0xcc,0xcc,0x3d,0x00,0x00,0x01,0x16,0xa1,0x10,0xc1,
+0x06,0x11,0x4a,0xd2,0x05,0xf0,0x05,0x04,0xa0,0x00,0x87,0x01,0x20,0x00,0x4b,0x58,
 0x54,0xd0,0x39,0x07,0xae,0xd9,0x51,0x0c,0x77,0x70,0x64,0x22,0x07,0x11,0xe2,0x15,
-0x05,0x40,0x18,0xee,0xee,0xf0,0x03,0x0b,0x00,0xda,0x01,0xc0,0x22,0x22,0xe0,0x00,
-0xe1,0x3e,0xcc,0xcc,0x00,0x0e,0x16,0x80,0x85,0x30,0x85,0xac,0xaa,0xaa,0x00,0x0e,
-0x12,0x33,0x33,0x21,0x00,0x30,0x00,0x02,0xc0,0x0b,0x00,0x71,0x6a,0x00,0x0e,0x10,
-0x0e,0xee,0x30,0x43,0x0f,0x01,0x5d,0x0d,0x41,0xeb,0x1d,0xdd,0xeb,0x56,0x14,0x91,
-0x3b,0x0b,0xee,0xea,0x0e,0xee,0xeb,0x0c,0x20,0xac,0x33,0xf1,0x19,0x32,0x21,0x1d,
-0x22,0x22,0x09,0xaa,0xbc,0x0a,0xaa,0xbe,0x09,0x92,0x3b,0x0b,0x82,0x1d,0x00,0x4a,
-0x7a,0x00,0x5a,0x5c,0x04,0x9c,0xc8,0x05,0xac,0xaa,0x39,0x30,0x96,0x28,0x30,0x78,
-0x00,0x6d,0xd1,0x00,0xbb,0x7e,0x06,0x13,0x11,0x08,0x36,0x60,0x02,0xee,0xec,0x02,
-0xd0,0x23,0xea,0x1e,0xf0,0x13,0xc3,0x01,0xc3,0x00,0x12,0x4c,0x9e,0xbb,0xba,0xd1,
-0x0e,0xbb,0x81,0x00,0xe0,0x03,0x00,0xd0,0x00,0x6c,0xcf,0xdc,0xb0,0x2c,0x55,0x47,
-0x50,0xe0,0x0e,0x03,0xaa,0xbd,0x75,0x0e,0x31,0x11,0x40,0xc6,0xcc,0xfd,0xcb,0xeb,
-0x00,0xf4,0x01,0x0e,0x08,0x40,0x00,0x07,0x82,0x34,0xe6,0x9e,0x00,0x4d,0xd2,0xbb,
-0xa8,0x76,0x97,0x97,0x11,0xf0,0x2e,0xdf,0x4e,0xbf,0x3e,0xbe,0x10,0x00,0xa4,0xc2,
-0xd3,0xb2,0xc1,0x05,0x5c,0x47,0x77,0x17,0x77,0x00,0xe7,0x71,0xbc,0xce,0xbb,0xd0,
-0x0d,0x00,0x0c,0x55,0xe4,0x4e,0x00,0xfb,0xb2,0xc6,0x6e,0x55,0xe0,0x02,0x2b,0x3c,
-0x9a,0xf9,0x9e,0x00,0x00,0xb2,0x23,0x4e,0x33,0x30,0x00,0x0c,0x6c,0xcd,0xfc,0xcc,
-0x70,0x00,0xe0,0x00,0xe4,0x32,0x14,0xe8,0xd6,0x10,0x04,0x7c,0x0c,0x60,0x16,0x00,
-0xef,0xfe,0xff,0x90,0x08,0x0b,0xb0,0x08,0x60,0x6d,0x50,0x00,0x08,0x60,0x86,0x18,
-0x10,0x00,0x0d,0x00,0xf0,0x07,0x00,0x3d,0x22,0xef,0xfe,0xff,0xc0,0x4e,0x30,0x00,
-0x94,0x08,0x60,0xac,0x20,0x00,0x0b,0x20,0x86,0x04,0x00,0x44,0x34,0x21,0xfc,0x05,
-0x00,0x2d,0x20,0x2d,0x00,0x86,0x00,0x3d,0x30,0x0a,0x70,0x08,0x61,0x9d,0x40,0x01,
-0xc0,0x00,0x86,0x88,0x7c,0x03,0xc0,0x6d,0xaa,0xad,0x50,0x0b,0x70,0x06,0xb7,0x77,
-0xc5,0x4c,0x60,0x0d,0x00,0xf0,0x26,0x68,0x20,0x10,0x02,0x24,0xb2,0x22,0x00,0x4d,
-0x10,0xaa,0xaa,0xaa,0x80,0x5d,0x10,0x03,0xaa,0xaa,0xa3,0xbb,0x10,0x00,0x49,0x00,
-0x0b,0x33,0x00,0x21,0x04,0xcb,0xda,0xc3,0x00,0x2e,0x20,0x2a,0x0e,0x37,0x00,0x1d,
-0x40,0x0c,0x50,0xe0,0xc2,0x6e,0x50,0x00,0x52,0xcb,0x02,0x5b,0xa2,0x0a,0x01,0x08,
-0x2e,0x20,0x1d,0x20,0x12,0x1f,0x91,0x2c,0x30,0x2e,0xee,0xfe,0xe8,0x03,0x21,0xb0,
-0x1f,0x1f,0x80,0xa5,0xde,0xee,0xfe,0xee,0x30,0x8f,0x20,0xcf,0x0b,0xf0,0x0a,0x8c,
-0xd2,0x11,0x11,0x19,0x71,0x04,0x1c,0x29,0xcc,0xcc,0xed,0xc1,0x00,0xc2,0x07,0x50,
-0x08,0x60,0x00,0x0c,0x20,0x1d,0x20,0x86,0x7c,0x14,0x11,0x42,0x0d,0x00,0x63,0x00,
-0x5e,0xd3,0x00,0x00,0x15,0x39,0x1d,0xe0,0xfd,0xdd,0xdf,0x00,0x3d,0x60,0x0e,0x00,
-0x00,0xd0,0x03,0x31,0xc0,0xfc,0x82,0x19,0x10,0xc5,0x0d,0x00,0xf0,0x05,0x01,0xcf,
-0x10,0xfa,0xaa,0xaf,0x00,0x98,0xd1,0x0f,0x2b,0x52,0x31,0x01,0x0d,0x10,0xe0,0x5a,
-0x2c,0x60,0xab,0x35,0x20,0xdd,0x30,0xab,0x35,0xf0,0x05,0x04,0xd1,0x00,0x00,0xd1,
-0x1f,0x8c,0x36,0xe5,0x00,0x0d,0x14,0xc7,0x20,0x04,0xb0,0x00,0x36,0x00,0x07,0x94,
-0x01,0xf0,0x29,0x30,0x0b,0x60,0x22,0x00,0x2d,0x40,0x1b,0x50,0x4d,0x30,0x04,0x32,
-0xc8,0xdc,0xfa,0x41,0x00,0x00,0xc4,0x05,0xb4,0x04,0xc0,0x00,0xbf,0x0c,0xfd,0xec,
-0xbb,0xa0,0x8a,0xe0,0x00,0xc5,0x00,0x08,0x01,0x0e,0x01,0xbd,0xbb,0xdc,0x00,0x00,
-0xe2,0xd8,0xd2,0x2d,0x40,0x00,0x0e,0x02,0x02,0xdd,0x50,0x87,0x06,0xc2,0xbb,0xab,
-0x50,0x00,0x0e,0x3d,0x93,0x00,0x39,0xd1,0x00,0x36,0xe5,0x20,0xf2,0x25,0x28,0xdd,
-0xdd,0xdd,0xd1,0x4d,0x30,0x05,0x31,0x80,0x62,0x04,0x13,0xd2,0xc0,0xa4,0x3b,0x00,
-0x01,0xe3,0x86,0x3c,0x0c,0x20,0x02,0xdf,0x01,0xc1,0x96,0x2c,0x00,0x94,0xd0,0x05,
-0x70,0xb0,0x56,0x00,0x0d,0x04,0xaa,0xaa,0xaa,0x60,0x00,0xd0,0x12,0x28,0x92,0x21,
-0x00,0x0d,0x01,0x17,0x11,0xd0,0xc8,0x13,0xf0,0x1a,0x0d,0x4d,0xdd,0xee,0xdd,0xd3,
-0x00,0x57,0x00,0xd1,0x04,0x80,0x00,0x4d,0x10,0x4c,0x00,0x96,0x00,0x5d,0x22,0x0a,
-0xd1,0x0e,0x70,0x02,0x04,0xc4,0xe4,0xd9,0xab,0x70,0x02,0xe3,0xe4,0x05,0xd0,0x0c,
-0x42,0xef,0x02,0x7b,0x32,0x50,0x94,0xd0,0x0c,0x10,0xe0,0x42,0x11,0x80,0xf0,0x0f,
-0xcc,0xa0,0x00,0xd0,0x2f,0x30,0x0d,0x00,0x30,0x06,0xcb,0x0e,0xd9,0x0f,0xe0,0xd2,
-0x9c,0xe1,0x00,0x00,0x0d,0x56,0x00,0x5a,0xcd,0xd3,0x00,0x66,0x06,0xe2,0x06,0xf0,
-0x1c,0x4d,0x10,0xea,0x88,0x88,0x70,0x5d,0x21,0x7a,0x33,0x33,0x33,0x03,0x14,0xdd,
-0xda,0xaa,0xae,0x00,0x01,0xe3,0x0d,0x55,0x55,0xe0,0x02,0xdf,0x00,0xd4,0x44,0x4e,
-0x00,0xb7,0xd0,0x0b,0xcc,0xaa,0xd0,0x01,0x0d,0x00,0x1e,0x30,0x8f,0x00,0xa0,0x1c,
-0xea,0xad,0xb0,0x00,0x0d,0x0c,0x5a,0x85,0xd2,0x68,0x01,0xf0,0x0b,0x7f,0xf8,0x30,
-0x00,0x0d,0x1d,0xa6,0x11,0x7b,0xb0,0x00,0x74,0x00,0x01,0x36,0x94,0x00,0x3d,0x0a,
-0xcc,0xae,0x83,0x10,0x2d,0x20,0xb2,0x06,0x09,0xf0,0x08,0x26,0x9b,0xdd,0xdf,0xdd,
-0xd0,0x02,0xf1,0xb2,0x00,0xd0,0x00,0x01,0xdf,0x0c,0x2b,0xcf,0xcc,0xa0,0x57,0xe0,
-0xc1,0xe0,0xef,0x08,0xb0,0x0d,0x0e,0xaa,0xab,0xd0,0x00,0xe0,0xe0,0xe3,0x33,0x4d,
-0x0d,0x00,0xfb,0x01,0x66,0x67,0xd0,0x00,0xe3,0xa0,0xe9,0x99,0xad,0x00,0x0e,0x36,
-0x0e,0x22,0x23,0xc0,0x19,0x12,0xf0,0x0b,0x30,0x38,0x00,0xa2,0x00,0x08,0xa0,0xa3,
-0x87,0x3d,0x00,0x05,0xa2,0x4a,0x38,0x73,0xe6,0x62,0x00,0x96,0xec,0xed,0x6c,0x6e,
-0x20,0x3e,0xc0,0x09,0x80,0xc0,0x1d,0xd3,0xdd,0xdd,0xec,0x1a,0x08,0x17,0x42,0xfc,
-0x14,0xa5,0x70,0x10,0xd0,0xad,0xcc,0x07,0xc3,0x00,0x0d,0x0b,0x20,0xc1,0x3e,0x00,
-0x00,0xd0,0xc0,0x1f,0x98,0xe1,0x00,0x0d,0x2d,0x02,0x66,0xb5,0xb0,0x00,0xd6,0x50,
-0x02,0xb1,0x08,0x40,0xa2,0x29,0x10,0x69,0xba,0x0f,0x61,0xbc,0xce,0xec,0xcc,0x13,
-0xd2,0xfe,0x1c,0xf0,0x06,0x62,0x2b,0x6d,0xdd,0xcd,0xca,0x00,0x0b,0x56,0x64,0x63,
-0x71,0xa0,0x07,0xf0,0x6b,0xbb,0xac,0x9a,0x06,0xdf,0xa8,0x0a,0x90,0x10,0x52,0xe0,
-0xcc,0xcd,0xcc,0xcc,0x20,0x0e,0x70,0x6d,0xf6,0x05,0x00,0x00,0xe0,0xa4,0xb2,0x90,
-0x86,0x00,0x0e,0x2a,0x2b,0x00,0x74,0xd0,0x00,0xe3,0x30,0xdc,0xbc,0x15,0x50,0x0e,
-0x12,0xd3,0x07,0x00,0x12,0xe5,0x95,0x03,0x11,0xd5,0x4c,0x10,0x60,0x01,0x10,0x30,
-0x00,0x3b,0x1e,0xc3,0x0a,0x30,0x06,0x81,0xe0,0x48,0x05,0x20,0x96,0x1e,0x17,0x00,
-0xe0,0x0e,0x21,0xe0,0x00,0x04,0x0c,0x42,0xd0,0x1e,0x00,0x00,0xc2,0x64,0x01,0x37,
-0x3b,0x00,0xf2,0x00,0x11,0xee,0x4b,0x1f,0x12,0x62,0xdb,0x0a,0x11,0xe6,0x61,0x17,
-0x20,0x01,0xc9,0xbd,0x0c,0xf0,0x19,0x09,0x00,0x24,0xc0,0x00,0x02,0x90,0xf0,0x01,
+0x05,0x80,0x18,0xee,0xee,0xf0,0x00,0xe1,0x00,0x00,0xda,0x01,0xb0,0x22,0x22,0xe0,
+0x00,0xe1,0x3e,0xcc,0xcc,0x00,0x0e,0x16,0x65,0x00,0x95,0xe1,0xac,0xaa,0xaa,0x00,
+0x0e,0x12,0x33,0x33,0x21,0x00,0x30,0x00,0x02,0xc0,0x0b,0x00,0x70,0x6a,0x00,0x0e,
+0x10,0x0e,0xee,0x30,0x0b,0x00,0x01,0xe0,0x01,0xf0,0x04,0xee,0xeb,0x1d,0xdd,0xeb,
+0x00,0x00,0x3b,0x00,0x00,0x3b,0x0b,0xee,0xea,0x0e,0xee,0xeb,0x0c,0x20,0xb7,0x04,
+0xf1,0x1a,0x0d,0x32,0x21,0x1d,0x22,0x22,0x09,0xaa,0xbc,0x0a,0xaa,0xbe,0x09,0x92,
+0x3b,0x0b,0x82,0x1d,0x00,0x4a,0x7a,0x00,0x5a,0x5c,0x04,0x9c,0xc8,0x05,0xac,0xaa,
+0x39,0x30,0x96,0x28,0x30,0x78,0x00,0x6d,0xd1,0x00,0xbb,0x7e,0x06,0x11,0x11,0x81,
+0x01,0xf0,0x1e,0x30,0x00,0x02,0xee,0xec,0x02,0xd0,0x23,0x00,0x00,0x02,0xc0,0xc3,
+0x01,0xc3,0x00,0x12,0x4c,0x9e,0xbb,0xba,0xd1,0x0e,0xbb,0x81,0x00,0xe0,0x03,0x00,
+0xd0,0x00,0x6c,0xcf,0xdc,0xb0,0x2c,0x55,0x47,0x50,0xe0,0x0e,0x03,0xaa,0xbd,0x75,
+0x14,0x07,0x50,0x02,0xc6,0xcc,0xfd,0xcb,0xeb,0x00,0xf3,0x01,0x0e,0x08,0x40,0x00,
+0x07,0x82,0x34,0xe6,0x9e,0x00,0x4d,0xd2,0xbb,0xa8,0x76,0x97,0x30,0x01,0xf1,0x34,
+0x1d,0xdf,0x4e,0xbf,0x3e,0xbe,0x10,0x00,0xa4,0xc2,0xd3,0xb2,0xc1,0x05,0x5c,0x47,
+0x77,0x17,0x77,0x00,0xe7,0x71,0xbc,0xce,0xbb,0xd0,0x0d,0x00,0x0c,0x55,0xe4,0x4e,
+0x00,0xfb,0xb2,0xc6,0x6e,0x55,0xe0,0x02,0x2b,0x3c,0x9a,0xf9,0x9e,0x00,0x00,0xb2,
+0x23,0x4e,0x33,0x30,0x00,0x0c,0x6c,0xcd,0xfc,0xcc,0x70,0x00,0xe0,0x00,0x1e,0x00,
+0x00,0x0b,0xe8,0x90,0x06,0x00,0x0f,0x08,0x03,0x53,0x00,0x60,0x16,0x00,0xef,0xfe,
+0xff,0x90,0x08,0x0b,0xb0,0x08,0x60,0x6d,0x50,0x00,0x08,0x60,0x86,0x18,0x10,0x00,
+0x0d,0x00,0xfc,0x1f,0x00,0x3d,0x22,0xef,0xfe,0xff,0xc0,0x4e,0x30,0x00,0x94,0x08,
+0x60,0xac,0x20,0x00,0x0b,0x20,0x86,0x04,0x00,0x44,0x00,0xd1,0x08,0x60,0x00,0x2d,
+0x20,0x2d,0x00,0x86,0x00,0x3d,0x30,0x0a,0x70,0x08,0x61,0x9d,0x40,0x01,0xc0,0x00,
+0x86,0x88,0x7c,0x03,0xc0,0x6d,0xaa,0xad,0x50,0x0b,0x70,0x06,0xb7,0x77,0xc5,0x4c,
+0x60,0x0d,0x00,0xf0,0x26,0x68,0x20,0x10,0x02,0x24,0xb2,0x22,0x00,0x4d,0x10,0xaa,
+0xaa,0xaa,0x80,0x5d,0x10,0x03,0xaa,0xaa,0xa3,0xbb,0x10,0x00,0x49,0x00,0x0b,0x33,
+0x00,0x21,0x04,0xcb,0xda,0xc3,0x00,0x2e,0x20,0x2a,0x0e,0x37,0x00,0x1d,0x40,0x0c,
+0x50,0xe0,0xc2,0x6e,0x50,0x00,0x52,0xcb,0x02,0x5b,0xa2,0x0a,0x10,0x00,0xcb,0x09,
+0xf0,0x00,0x1d,0x20,0x00,0x59,0x00,0x00,0x2c,0x30,0x2e,0xee,0xfe,0xe8,0x03,0x21,
+0xb0,0x0d,0x00,0x90,0x00,0xa5,0xde,0xee,0xfe,0xee,0x30,0x8f,0x20,0xcf,0x0b,0xf1,
+0x0f,0x8c,0xd2,0x11,0x11,0x19,0x71,0x04,0x1c,0x29,0xcc,0xcc,0xed,0xc1,0x00,0xc2,
+0x07,0x50,0x08,0x60,0x00,0x0c,0x20,0x1d,0x20,0x86,0x00,0x00,0xc2,0x00,0x42,0x0d,
+0x00,0x62,0x00,0x5e,0xd3,0x00,0x00,0x15,0x73,0x04,0xf0,0x05,0x60,0xfd,0xdd,0xdf,
+0x00,0x3d,0x60,0x0e,0x00,0x00,0xd0,0x03,0x31,0xc0,0xfc,0xcc,0xcf,0x00,0x00,0xc5,
+0x0d,0x00,0xf0,0x23,0x01,0xcf,0x10,0xfa,0xaa,0xaf,0x00,0x98,0xd1,0x0f,0x2b,0x52,
+0x31,0x01,0x0d,0x10,0xe0,0x5a,0x2c,0x60,0x00,0xd1,0x0e,0x00,0xdd,0x30,0x00,0x0d,
+0x10,0xe0,0x04,0xd1,0x00,0x00,0xd1,0x1f,0x8c,0x36,0xe5,0x00,0x0d,0x14,0xc7,0x20,
+0x04,0xb0,0x00,0x36,0x00,0x07,0x94,0x01,0xf0,0x29,0x30,0x0b,0x60,0x22,0x00,0x2d,
+0x40,0x1b,0x50,0x4d,0x30,0x04,0x32,0xc8,0xdc,0xfa,0x41,0x00,0x00,0xc4,0x05,0xb4,
+0x04,0xc0,0x00,0xbf,0x0c,0xfd,0xec,0xbb,0xa0,0x8a,0xe0,0x00,0xc5,0x00,0x08,0x01,
+0x0e,0x01,0xbd,0xbb,0xdc,0x00,0x00,0xe2,0xd8,0xd2,0x2d,0x40,0x00,0x0e,0x02,0x02,
+0xdd,0x50,0x87,0x06,0xc1,0xbb,0xab,0x50,0x00,0x0e,0x3d,0x93,0x00,0x39,0xd1,0x00,
+0x36,0x9c,0x00,0xf0,0x24,0x2d,0x28,0xdd,0xdd,0xdd,0xd1,0x4d,0x30,0x05,0x31,0x80,
+0x62,0x04,0x13,0xd2,0xc0,0xa4,0x3b,0x00,0x01,0xe3,0x86,0x3c,0x0c,0x20,0x02,0xdf,
+0x01,0xc1,0x96,0x2c,0x00,0x94,0xd0,0x05,0x70,0xb0,0x56,0x00,0x0d,0x04,0xaa,0xaa,
+0xaa,0x60,0x00,0xd0,0x12,0x28,0x92,0x21,0xb8,0x06,0x70,0x68,0x00,0x00,0x00,0xd0,
+0x00,0x06,0x9d,0x0d,0xf0,0x2e,0x4d,0xdd,0xee,0xdd,0xd3,0x00,0x57,0x00,0xd1,0x04,
+0x80,0x00,0x4d,0x10,0x4c,0x00,0x96,0x00,0x5d,0x22,0x0a,0xd1,0x0e,0x70,0x02,0x04,
+0xc4,0xe4,0xd9,0xab,0x70,0x02,0xe3,0xe4,0x05,0xd0,0x0c,0x42,0xef,0x02,0x00,0x0c,
+0x00,0x00,0x94,0xd0,0x0c,0x10,0xe0,0x00,0x00,0x0d,0x00,0xf0,0x0f,0xcc,0xa0,0x00,
+0xd0,0x2f,0x30,0x0d,0x00,0x20,0x06,0xcb,0xa6,0x07,0xf0,0x00,0xd1,0xd2,0x9c,0xe1,
+0x00,0x00,0x0d,0x56,0x00,0x5a,0xcd,0xd3,0x00,0x66,0x06,0xe2,0x06,0xf0,0x1c,0x4d,
+0x10,0xea,0x88,0x88,0x70,0x5d,0x21,0x7a,0x33,0x33,0x33,0x03,0x14,0xdd,0xda,0xaa,
+0xae,0x00,0x01,0xe3,0x0d,0x55,0x55,0xe0,0x02,0xdf,0x00,0xd4,0x44,0x4e,0x00,0xb7,
+0xd0,0x0b,0xcc,0xaa,0xd0,0x01,0x0d,0x00,0x1e,0x30,0x8f,0x00,0xa0,0x1c,0xea,0xad,
+0xb0,0x00,0x0d,0x0c,0x5a,0x85,0xd2,0x68,0x01,0xf0,0x0b,0x7f,0xf8,0x30,0x00,0x0d,
+0x1d,0xa6,0x11,0x7b,0xb0,0x00,0x74,0x00,0x01,0x36,0x94,0x00,0x3d,0x0a,0xcc,0xae,
+0x83,0x10,0x2d,0x20,0xb2,0x06,0x09,0xf0,0x08,0x26,0x9b,0xdd,0xdf,0xdd,0xd0,0x02,
+0xf1,0xb2,0x00,0xd0,0x00,0x01,0xdf,0x0c,0x2b,0xcf,0xcc,0xa0,0x57,0xe0,0xc1,0xe0,
+0xef,0x08,0xb0,0x0d,0x0e,0xaa,0xab,0xd0,0x00,0xe0,0xe0,0xe3,0x33,0x4d,0x0d,0x00,
+0xfb,0x00,0x66,0x67,0xd0,0x00,0xe3,0xa0,0xe9,0x99,0xad,0x00,0x0e,0x36,0x0e,0x22,
+0x23,0x3c,0x0c,0xf0,0x0c,0x0b,0x30,0x38,0x00,0xa2,0x00,0x08,0xa0,0xa3,0x87,0x3d,
+0x00,0x05,0xa2,0x4a,0x38,0x73,0xe6,0x62,0x00,0x96,0xec,0xed,0x6c,0x6e,0x20,0x3e,
+0xc0,0x09,0xf7,0x1f,0xc0,0x1d,0xd3,0xdd,0xdd,0xec,0x1a,0x08,0x8d,0x00,0x00,0x02,
+0xa5,0x70,0x10,0xd0,0xad,0xcc,0x07,0xc3,0x00,0x0d,0x0b,0x20,0xc1,0x3e,0x00,0x00,
+0xd0,0xc0,0x1f,0x98,0xe1,0x00,0x0d,0x2d,0x02,0x66,0xb5,0xb0,0x00,0xd6,0x50,0x02,
+0xb1,0x08,0xa0,0x05,0x01,0x35,0x0c,0x00,0xbb,0x04,0x80,0x03,0xd1,0xbc,0xce,0xec,
+0xcc,0x13,0xd2,0xd3,0x08,0xf0,0x07,0x00,0x62,0x2b,0x6d,0xdd,0xcd,0xca,0x00,0x0b,
+0x56,0x64,0x63,0x71,0xa0,0x07,0xf0,0x6b,0xbb,0xac,0x9a,0x06,0xdf,0xa8,0x0a,0xf6,
+0x12,0x10,0x52,0xe0,0xcc,0xcd,0xcc,0xcc,0x20,0x0e,0x00,0x00,0x93,0x01,0x00,0x00,
+0xe0,0xa4,0xb2,0x90,0x86,0x00,0x0e,0x2a,0x2b,0x00,0x74,0xd0,0x00,0xe3,0x30,0xdc,
+0xbc,0x15,0x50,0x0e,0x12,0xd3,0x07,0x00,0x12,0xe5,0x95,0x03,0x20,0xd5,0x00,0x31,
+0x0a,0x60,0x01,0x10,0x30,0x00,0x3b,0x1e,0xc3,0x0a,0x30,0x06,0x81,0xe0,0x48,0x05,
+0x20,0x96,0x1e,0x17,0x00,0xf0,0x0b,0x0e,0x21,0xe0,0x00,0x04,0x0c,0x42,0xd0,0x1e,
+0x00,0x00,0xc2,0x64,0x01,0x00,0xf0,0x00,0x0e,0x00,0x00,0x00,0x0b,0xee,0xee,0x80,
+0x00,0x40,0x00,0x00,0x62,0x00,0x01,0x00,0xf0,0x6a,0x04,0xe6,0x00,0x1c,0x00,0x00,
+0x00,0x01,0xc9,0x0a,0x70,0x00,0x00,0x09,0x00,0x24,0xc0,0x00,0x02,0x90,0xf0,0x01,
 0xd3,0x20,0x00,0x69,0x0f,0x01,0xd7,0x2e,0x10,0x0a,0x50,0xf1,0xc7,0x00,0x89,0x01,
-0xe0,0x0f,0xc7,0x00,0x01,0xe1,0x36,0x03,0xf6,0x00,0x02,0x0a,0x50,0x19,0xef,0xca,
-0x12,0x30,0x3e,0x80,0xf1,0x12,0x05,0x21,0x20,0x09,0x34,0x44,0x11,0xd1,0x02,0x0f,
-0x21,0x0d,0x10,0xa6,0x1d,0xf0,0x08,0xd9,0x0e,0xef,0xfe,0xe2,0x02,0x9d,0x85,0x00,
-0x86,0x0b,0x30,0x57,0xd3,0x60,0x08,0x60,0xb3,0x09,0x3d,0x10,0x00,0x95,0x09,0x25,
-0x50,0xde,0xef,0xfe,0xfe,0x40,0xcd,0x37,0x10,0x10,0x34,0x00,0x30,0x4b,0x79,0x00,
-0x34,0x39,0xd3,0x30,0xd3,0x00,0x00,0xd1,0x3d,0x60,0x04,0xe5,0x00,0x0d,0x2d,0x50,
-0x3a,0x42,0x07,0x01,0x00,0x21,0xb5,0x00,0x56,0x0f,0xf1,0x15,0xbb,0xbb,0xbb,0xb1,
-0x00,0x4d,0x36,0xd2,0x8a,0x2e,0x10,0x3e,0x20,0xd2,0x0d,0x10,0xf0,0x00,0x11,0xb6,
-0x08,0x80,0x1e,0x00,0x02,0xd6,0x07,0xc0,0x03,0xc0,0x00,0x03,0x05,0xc0,0x3b,0xd6,
-0x54,0x09,0x60,0x21,0x00,0x00,0x73,0xb2,0x1d,0xfe,0x68,0xf0,0x04,0x1c,0x20,0x49,
-0x12,0xb5,0x05,0xa0,0xc3,0x00,0x05,0x93,0xc0,0x22,0x07,0xed,0xdd,0xe4,0x01,0x00,
-0x97,0x6e,0x00,0xe9,0x07,0xf0,0x06,0xa0,0x05,0xd3,0x00,0x03,0xdd,0x77,0x88,0xbf,
-0x40,0x03,0x76,0x55,0x43,0x33,0xa0,0x00,0x9c,0xcc,0xcc,0xcc,0xac,0x21,0x00,0xc5,
-0x00,0x70,0xb4,0x22,0x22,0x2e,0x10,0x00,0x7a,0x00,0x06,0xf2,0x09,0x01,0x03,0x1b,
-0x80,0x00,0x20,0x09,0x6b,0x20,0x87,0x02,0xd0,0x0e,0x1b,0x30,0x00,0x58,0x87,0x37,
-0x06,0xee,0xee,0xe3,0x16,0xd4,0x1a,0x80,0x00,0x2f,0xdc,0xcd,0x70,0x00,0x04,0xe5,
-0xb8,0x30,0x81,0x6e,0xed,0xdd,0xee,0xdd,0x20,0x11,0x00,0x94,0x3b,0x61,0xbc,0xcc,
-0xcc,0xcf,0x20,0x00,0x0c,0x00,0x11,0x05,0xd8,0x01,0xf4,0x09,0x00,0x01,0x09,0x50,
-0x02,0x40,0x0d,0x2c,0x21,0xd3,0x12,0xe1,0x6b,0x0c,0x30,0x33,0x77,0x88,0x63,0x07,
-0xee,0xde,0xe2,0x15,0xd4,0x08,0x30,0x00,0x0a,0x30,0x5b,0x32,0x01,0xf9,0x18,0x20,
-0x4c,0x89,0x57,0x31,0xf0,0x1e,0x0b,0xc9,0x31,0xd0,0x06,0x00,0x01,0xbc,0x46,0x49,
-0x12,0xb0,0x30,0x57,0xc0,0x08,0x5a,0x4a,0x1a,0x00,0x0c,0x00,0xc1,0xc5,0x86,0x60,
-0x00,0xc0,0x3b,0x47,0x88,0xa0,0x00,0x0c,0x0b,0x40,0x0d,0xd0,0x00,0x00,0xc4,0xa0,
-0x06,0x98,0x60,0xc6,0x35,0x9c,0xd1,0x0d,0x40,0x00,0xc0,0x06,0xa1,0x00,0x1b,0x16,
-0x39,0x11,0x0d,0xb6,0x22,0x31,0xcc,0xfc,0xcc,0x8e,0x27,0x00,0x2f,0x0b,0x5b,0x3e,
-0xbb,0xbb,0xbc,0xd0,0x0d,0x00,0xf4,0x17,0xb1,0x11,0x11,0x2d,0x00,0x00,0x2b,0xbb,
-0xdb,0xbb,0x90,0x00,0x04,0x24,0x0c,0x50,0x04,0x40,0x04,0xb5,0xa0,0x1d,0x12,0x3e,
-0x00,0xc4,0x5a,0x00,0x00,0xa5,0x97,0x06,0x02,0xde,0xee,0xed,0x11,0x10,0x67,0x33,
-0xf0,0x20,0x07,0xbb,0xde,0xbb,0xb0,0x04,0xea,0x14,0x48,0xb4,0x43,0x01,0x9e,0x84,
-0x55,0x9c,0x55,0x40,0x47,0xe0,0xbb,0xbd,0xeb,0xbb,0x47,0x4e,0x00,0x44,0x44,0x44,
-0x20,0x00,0xe0,0x1e,0x66,0x66,0xb6,0x00,0x0e,0x01,0xea,0xaa,0xad,0x60,0x00,0xe0,
-0x1c,0x73,0x05,0x56,0x0e,0x01,0xfb,0xbb,0xbd,0x0d,0x00,0x40,0xc0,0x00,0xcd,0x30,
-0x68,0x37,0x00,0xce,0x11,0x71,0xcd,0xcd,0xdd,0xdc,0x50,0x00,0x04,0xa6,0x13,0x01,
-0xcc,0x0a,0xf7,0x25,0xc1,0x00,0x36,0x66,0x66,0x66,0x30,0x00,0x07,0x94,0x44,0x44,
-0x89,0x00,0x00,0x7c,0xaa,0xaa,0xac,0x90,0x00,0x07,0x71,0x11,0x11,0x69,0x00,0x00,
-0x49,0x9c,0xc9,0x99,0x50,0x00,0x0b,0x2b,0x1a,0x80,0x1c,0x00,0x07,0x71,0xd0,0x02,
-0x75,0x6a,0x00,0x80,0x0c,0xdc,0xdc,0x20,0x81,0x19,0xf4,0x3b,0x68,0x6a,0x10,0x01,
+0xe0,0x0f,0xc7,0x00,0x01,0xe1,0x36,0x03,0xf6,0x00,0x02,0x0a,0x50,0x19,0xef,0x00,
+0x00,0xb4,0x00,0x3e,0x80,0xf1,0x00,0x0e,0x10,0x00,0x20,0x09,0xff,0xff,0x90,0x00,
+0x00,0xd1,0x00,0x08,0x60,0x00,0x00,0x0d,0x10,0x00,0x86,0x00,0x00,0x04,0xd9,0x0e,
+0xef,0xfe,0xe2,0x02,0x9d,0x85,0x00,0x86,0x0b,0x30,0x57,0xd3,0x60,0x08,0x60,0xb3,
+0x09,0x3d,0x10,0x00,0x95,0x0b,0x30,0x00,0xd1,0xde,0xef,0xfe,0xfe,0x40,0x0d,0x10,
+0x00,0xee,0x10,0x34,0x00,0x20,0x4b,0x79,0x34,0x00,0xfa,0x03,0x1d,0x30,0xd3,0x00,
+0x00,0xd1,0x3d,0x60,0x04,0xe5,0x00,0x0d,0x2d,0x50,0x00,0x04,0xd2,0x00,0x01,0x00,
+0x11,0xb5,0x06,0x00,0xf1,0x58,0x6f,0xbb,0xbb,0xbb,0xb1,0x00,0x4d,0x36,0xd2,0x8a,
+0x2e,0x10,0x3e,0x20,0xd2,0x0d,0x10,0xf0,0x00,0x11,0xb6,0x08,0x80,0x1e,0x00,0x02,
+0xd6,0x07,0xc0,0x03,0xc0,0x00,0x03,0x05,0xc0,0x3b,0xd6,0x00,0x00,0x00,0x05,0x60,
+0x21,0x00,0x00,0x73,0xb2,0x1d,0x30,0x29,0x00,0x0d,0x1c,0x20,0x49,0x12,0xb5,0x05,
+0xa0,0xc3,0x00,0x05,0x93,0xc0,0x22,0x07,0xed,0xdd,0xe4,0x01,0x00,0x00,0x00,0x77,
+0x02,0x00,0x00,0x00,0x09,0xa0,0x05,0xd3,0x00,0x03,0xdd,0x77,0x88,0xbf,0x40,0x03,
+0x76,0x55,0x43,0x33,0xa0,0x00,0x9c,0xcc,0xcc,0xcc,0x00,0x00,0xb2,0xc5,0x00,0xf0,
+0x17,0xb4,0x22,0x22,0x2e,0x10,0x00,0x7a,0xac,0xaa,0xaa,0x00,0x01,0x03,0x1b,0x80,
+0x00,0x20,0x09,0x6b,0x20,0x87,0x02,0xd0,0x0e,0x1b,0x30,0x00,0x58,0x87,0x37,0x06,
+0xee,0xee,0xe3,0x16,0x00,0x06,0xa0,0x96,0x00,0xf1,0x0f,0x2f,0xdc,0xcd,0x70,0x00,
+0x04,0xe5,0x00,0x1d,0x10,0x00,0x6e,0xed,0xdd,0xee,0xdd,0x20,0x11,0x00,0x00,0x00,
+0x0c,0x20,0x00,0xbc,0xcc,0xcc,0xcf,0x20,0x00,0x0c,0x00,0xf3,0x0f,0x05,0xcc,0xcd,
+0xcc,0xcc,0x20,0x00,0x01,0x09,0x50,0x02,0x40,0x0d,0x2c,0x21,0xd3,0x12,0xe1,0x6b,
+0x0c,0x30,0x33,0x77,0x88,0x63,0x07,0xee,0xde,0xe2,0x15,0xe4,0x00,0xfb,0x3f,0x0c,
+0x00,0x0a,0x30,0x00,0x00,0x00,0xc0,0x00,0xc2,0x00,0x00,0x00,0x4c,0x89,0xef,0xee,
+0xee,0xe1,0x0b,0xc9,0x31,0xd0,0x06,0x00,0x01,0xbc,0x46,0x49,0x12,0xb0,0x30,0x57,
+0xc0,0x08,0x5a,0x4a,0x1a,0x00,0x0c,0x00,0xc1,0xc5,0x86,0x60,0x00,0xc0,0x3b,0x47,
+0x88,0xa0,0x00,0x0c,0x0b,0x40,0x0d,0xd0,0x00,0x00,0xc4,0xa0,0x06,0x98,0x60,0x00,
+0x0c,0x00,0x06,0xd1,0x0d,0x40,0x00,0xc0,0x06,0xa1,0x00,0x1b,0x10,0x41,0x01,0xfb,
+0x08,0x0d,0x40,0x00,0x00,0x00,0x2c,0xcc,0xfc,0xcc,0xa0,0x00,0x03,0xb0,0x00,0x00,
+0x1d,0x00,0x00,0x3e,0xbb,0xbb,0xbc,0xd0,0x0d,0x00,0xf6,0x57,0xb1,0x11,0x11,0x2d,
+0x00,0x00,0x2b,0xbb,0xdb,0xbb,0x90,0x00,0x04,0x24,0x0c,0x50,0x04,0x40,0x04,0xb5,
+0xa0,0x1d,0x12,0x3e,0x00,0xc4,0x5a,0x00,0x00,0xa5,0x97,0x06,0x02,0xde,0xee,0xed,
+0x11,0x10,0x00,0xe0,0x00,0x05,0x90,0x00,0x00,0x0e,0x07,0xbb,0xde,0xbb,0xb0,0x04,
+0xea,0x14,0x48,0xb4,0x43,0x01,0x9e,0x84,0x55,0x9c,0x55,0x40,0x47,0xe0,0xbb,0xbd,
+0xeb,0xbb,0x47,0x4e,0x00,0x44,0x44,0x44,0x20,0x00,0xe0,0x1e,0x66,0x66,0xb6,0x00,
+0x0e,0x01,0xea,0xaa,0xad,0x60,0x00,0xe0,0x1c,0x00,0x00,0x86,0x00,0x0e,0x01,0xfb,
+0xbb,0xbd,0x0d,0x00,0xf0,0x05,0xc0,0x00,0xcd,0x30,0x00,0x00,0x01,0xc0,0x00,0x00,
+0x00,0x5c,0xcd,0xcd,0xdd,0xdc,0x50,0x00,0x04,0xb0,0xec,0x01,0xf6,0x2b,0xcc,0xcf,
+0xcc,0xcf,0xcc,0xc1,0x00,0x36,0x66,0x66,0x66,0x30,0x00,0x07,0x94,0x44,0x44,0x89,
+0x00,0x00,0x7c,0xaa,0xaa,0xac,0x90,0x00,0x07,0x71,0x11,0x11,0x69,0x00,0x00,0x49,
+0x9c,0xc9,0x99,0x50,0x00,0x0b,0x2b,0x1a,0x80,0x1c,0x00,0x07,0x71,0xd0,0x02,0x75,
+0x6a,0x00,0x80,0x0c,0xdc,0xdc,0x20,0x50,0xf2,0x00,0xf4,0x3b,0x68,0x6a,0x10,0x01,
 0xcc,0xcc,0xcd,0xec,0xec,0x60,0x1d,0x12,0x22,0x3b,0x01,0x20,0x01,0xc6,0x99,0x92,
 0xe0,0xa6,0x00,0x3b,0x5a,0xaa,0x0c,0x6e,0x00,0x04,0x98,0x40,0xc0,0x6f,0x41,0x10,
 0x96,0x89,0x8e,0x2d,0xe3,0x48,0x0e,0x11,0x33,0x3b,0x53,0xde,0x40,0x30,0x23,0x3c,
 0x00,0x02,0x10,0x02,0xb6,0x80,0x89,0x02,0xa7,0x00,0xa6,0x58,0x00,0x40,0xd2,0xe1,
-0x08,0x01,0xdc,0xcc,0xdb,0x04,0x4c,0x01,0xf0,0x08,0xa6,0x40,0x0e,0x01,0x71,0x0a,
+0x08,0x01,0xdc,0xcc,0xdb,0x04,0x4c,0x01,0xf1,0x3a,0xa6,0x40,0x0e,0x01,0x71,0x0a,
 0x92,0x9b,0x0e,0xbb,0x50,0x4c,0xa9,0x8a,0x6e,0x00,0x19,0x07,0xaa,0xaa,0x0a,0xdc,
-0xd6,0x8f,0x29,0xf4,0x1d,0x00,0x00,0x0b,0x98,0x8e,0x0e,0x38,0xb2,0x0b,0xa9,0x9e,
+0xd6,0x0b,0x20,0x0e,0x05,0x00,0x00,0x0b,0x98,0x8e,0x0e,0x38,0xb2,0x0b,0xa9,0x9e,
 0x0e,0x73,0x04,0x0b,0x20,0x0e,0x0e,0x10,0x2b,0x08,0x13,0xa8,0x37,0xcc,0xb4,0x09,
 0x1b,0x11,0xc2,0x00,0xc2,0x3b,0x0d,0x10,0x20,0x93,0x69,0x42,0x08,0xdc,0xcc,0xd0,
-0x06,0x45,0x37,0xf0,0x05,0x01,0xfa,0xaa,0xad,0x50,0x03,0xe6,0x2f,0x88,0x88,0xc5,
-0x02,0x8e,0x84,0xc9,0x99,0x9b,0x40,0x46,0xe2,0x39,0x1d,0xf2,0x01,0x08,0x3e,0x0c,
-0x01,0xa0,0xc0,0xd0,0x00,0xe0,0xc9,0xad,0x9e,0x9e,0x00,0x0e,0x03,0x4c,0x01,0xa0,
-0xaf,0xda,0xaa,0xf6,0x00,0x0e,0x00,0x3d,0x81,0xb9,0x9f,0x2f,0x9c,0x5e,0xfc,0x40,
-0x00,0x0e,0x2d,0xc8,0x30,0x49,0x29,0x03,0x01,0x83,0x0b,0xf9,0x38,0x0a,0xdc,0xcc,
-0xee,0xdc,0xcc,0x10,0xc2,0x1c,0x0b,0x26,0x60,0x00,0x0c,0x2a,0x57,0xe9,0xad,0x96,
-0x00,0xc9,0xf9,0xfd,0x8a,0xd8,0x50,0x0c,0x8a,0x55,0xb3,0x5b,0x32,0x00,0xd0,0xa2,
-0x3c,0x57,0xc5,0x30,0x0d,0x0a,0x23,0xea,0xab,0xaa,0x10,0xd0,0x10,0x08,0xa2,0x00,
-0x00,0x2b,0x0b,0x0d,0x04,0xc1,0xc1,0x06,0x85,0xa0,0xd0,0x00,0x84,0x90,0x92,0x71,
-0x09,0xcc,0xcb,0x06,0xc1,0x2d,0xf0,0x23,0x00,0x2d,0x99,0xe1,0x8a,0xb9,0x50,0x02,
-0xb6,0x6d,0x02,0xa2,0x82,0x00,0x2c,0x77,0xe0,0xab,0xe5,0x00,0x02,0xc7,0x7e,0x05,
-0xc5,0x7b,0x00,0xad,0x99,0xe6,0xa8,0xe5,0x83,0x01,0x76,0x77,0x07,0x4c,0x58,0x00,
-0xb5,0x66,0x87,0xb0,0xd0,0xa3,0x05,0x5b,0x21,0x61,0xdf,0x46,0xf0,0x03,0x1b,0x09,
-0xb0,0x1c,0x10,0x08,0x71,0xd0,0x02,0x46,0x5d,0x00,0x90,0x0c,0xcc,0xcd,0x40,0x62,
-0x7d,0x04,0x11,0x4a,0xfa,0x0c,0x41,0xa4,0x09,0x80,0x00,0x3e,0x34,0x00,0x7c,0x3e,
-0x11,0x97,0x79,0x10,0xf0,0x00,0x06,0x80,0x46,0x00,0x1f,0xee,0xf3,0x4a,0x0c,0x50,
-0x01,0xe0,0x0b,0x32,0xd4,0x2f,0x2f,0xf7,0x0f,0xc2,0x0e,0xd5,0x00,0x03,0xb0,0x0d,
-0x10,0xbb,0x01,0x20,0x79,0x8e,0xc0,0x6e,0xc0,0x49,0x0c,0x50,0x00,0x8b,0x1d,0x57,
-0x61,0xd0,0x00,0x5a,0x00,0x2d,0xe1,0xf8,0x00,0x21,0x3a,0x70,0xfe,0x24,0x70,0x08,
-0x70,0x1e,0xee,0xee,0xef,0xfe,0xa5,0x42,0x00,0x65,0x45,0xf2,0x09,0x04,0xdd,0xdd,
+0x06,0x00,0xe0,0x4e,0x00,0xf2,0x1a,0x0e,0x01,0xfa,0xaa,0xad,0x50,0x03,0xe6,0x2f,
+0x88,0x88,0xc5,0x02,0x8e,0x84,0xc9,0x99,0x9b,0x40,0x46,0xe2,0xaa,0xaa,0xaa,0xaa,
+0x08,0x3e,0x0c,0x01,0xa0,0xc0,0xd0,0x00,0xe0,0xc9,0xad,0x9e,0x9e,0x00,0x0e,0x03,
+0x4c,0x01,0xfc,0x0a,0xaf,0xda,0xaa,0xf6,0x00,0x0e,0x00,0x3d,0x81,0xb9,0x00,0x00,
+0xe0,0x02,0x5e,0xfc,0x40,0x00,0x0e,0x2d,0xc8,0x30,0x49,0xd2,0x00,0xe9,0x01,0xf8,
+0x3b,0x20,0x00,0x00,0x0a,0xdc,0xcc,0xee,0xdc,0xcc,0x10,0xc2,0x1c,0x0b,0x26,0x60,
+0x00,0x0c,0x2a,0x57,0xe9,0xad,0x96,0x00,0xc9,0xf9,0xfd,0x8a,0xd8,0x50,0x0c,0x8a,
+0x55,0xb3,0x5b,0x32,0x00,0xd0,0xa2,0x3c,0x57,0xc5,0x30,0x0d,0x0a,0x23,0xea,0xab,
+0xaa,0x10,0xd0,0x10,0x08,0xa2,0x00,0x00,0x2b,0x0b,0x0d,0x04,0xc1,0xc1,0x06,0x85,
+0xa0,0xd0,0x00,0x84,0x90,0x92,0x71,0x09,0xcc,0xcb,0x06,0x57,0x00,0xf0,0x39,0x01,
+0x00,0x2d,0x99,0xe1,0x8a,0xb9,0x50,0x02,0xb6,0x6d,0x02,0xa2,0x82,0x00,0x2c,0x77,
+0xe0,0xab,0xe5,0x00,0x02,0xc7,0x7e,0x05,0xc5,0x7b,0x00,0xad,0x99,0xe6,0xa8,0xe5,
+0x83,0x01,0x76,0x77,0x07,0x4c,0x58,0x00,0xb5,0x66,0x87,0xb0,0xd0,0xa3,0x05,0x5b,
+0x21,0x61,0x98,0x00,0x00,0x0a,0x1b,0x09,0xb0,0x1c,0x10,0x08,0x71,0xd0,0x02,0x46,
+0x5d,0x00,0x90,0x0c,0xcc,0xcd,0x40,0x72,0x04,0x30,0x0b,0x4a,0x60,0x53,0x00,0xf7,
+0x35,0xa4,0x09,0x80,0x00,0xee,0xee,0xef,0xee,0xee,0x70,0x0e,0x00,0x00,0x97,0x00,
+0x00,0x00,0xe0,0x00,0x06,0x80,0x46,0x00,0x1f,0xee,0xf3,0x4a,0x0c,0x50,0x01,0xe0,
+0x0b,0x32,0xd4,0xe0,0x00,0x2c,0x00,0xc2,0x0e,0xd5,0x00,0x03,0xb0,0x0d,0x10,0xbb,
+0x01,0x20,0x79,0x8e,0xc0,0x6e,0xc0,0x49,0x0c,0x50,0x00,0x8b,0x1d,0x57,0x61,0xd0,
+0x00,0x5a,0x00,0x2d,0xe1,0xf8,0x00,0x20,0x3a,0x70,0x07,0x00,0x90,0xc3,0x08,0x70,
+0x1e,0xee,0xee,0xef,0xfe,0xef,0xb5,0x01,0xf2,0x0c,0xa5,0x00,0x00,0x04,0xdd,0xdd,
 0x18,0x70,0xa6,0x00,0x58,0x00,0xc2,0x69,0x1f,0x10,0x05,0x80,0x0c,0x23,0xc9,0xa0,
-0x00,0x5e,0xdd,0xf2,0x0f,0x3a,0x00,0xf0,0x01,0xe7,0x03,0x10,0x14,0x7a,0xe8,0xbe,
-0xa0,0x76,0x1f,0xc8,0x42,0xb9,0x1e,0x4a,0x30,0xbe,0x13,0x26,0x4e,0xc0,0x9a,0x2b,
-0x90,0x3c,0x37,0x00,0x06,0xcd,0xfc,0xc2,0xc0,0xa8,0x0d,0x00,0x60,0x2d,0x00,0x60,
-0x1d,0xdd,0xfd,0x39,0x33,0x30,0x06,0x47,0x10,0x45,0x05,0xfb,0x1d,0xe8,0xab,0x71,
-0xe0,0x5a,0x00,0xad,0x49,0x84,0x1c,0x2c,0x40,0x18,0xea,0xcc,0xa0,0x99,0xd0,0x00,
-0x0d,0x49,0x84,0x05,0xf4,0x00,0x00,0xd5,0x99,0x50,0x8f,0x03,0x80,0x0f,0xcd,0xdc,
-0x8c,0xa7,0x57,0x00,0xc0,0x00,0x4d,0x11,0xde,0x23,0x24,0xfa,0x3e,0x1c,0x00,0x02,
-0xb4,0x40,0x00,0x01,0xea,0xa5,0x1c,0x2d,0x10,0x8a,0xbe,0xaa,0x90,0xc0,0x64,0x0c,
-0x03,0xb5,0x79,0x2e,0x68,0x50,0xc5,0x8c,0x45,0x9b,0xf7,0x52,0x0c,0x00,0x88,0x70,
-0x0d,0x07,0x50,0xc7,0xaa,0xaa,0x60,0xc2,0xd1,0x0c,0x1a,0x88,0xa0,0x0a,0x9a,0x00,
-0xc2,0xb0,0x0c,0x00,0x7f,0x20,0x2b,0x1b,0x9a,0xa0,0x09,0xc0,0x76,0x60,0x47,0xa7,
-0x5c,0x9d,0x5b,0x42,0xab,0x97,0x5a,0x50,0x3d,0x50,0x5b,0x00,0x83,0x25,0x8b,0xd2,
-0x00,0xad,0xca,0x85,0x20,0xb6,0x27,0xc0,0xdc,0xbb,0xbb,0xbb,0xa0,0x0d,0x42,0x22,
-0x22,0x3e,0x00,0xd1,0x0f,0x06,0x00,0xd1,0x12,0x11,0x1e,0xbf,0x23,0x20,0xe0,0x3c,
-0xfc,0x05,0x20,0x09,0x70,0x49,0x06,0x01,0x0f,0x01,0x13,0x44,0x5d,0x06,0xd1,0x6a,
-0x10,0x14,0x9b,0x00,0xcd,0xa8,0x30,0xec,0x96,0x10,0x0d,0x10,0x2f,0x06,0x50,0xdd,
-0xdd,0xa0,0xe0,0x00,0x42,0x3c,0xf0,0x02,0x0f,0xbb,0xbb,0x40,0xe1,0x02,0xc0,0xe3,
-0x4e,0x31,0x0e,0xed,0xec,0x2d,0x01,0xd0,0x00,0xc2,0x14,0x01,0x5e,0x10,0xfc,0x07,
-0x5a,0x01,0xd0,0x03,0xc0,0x00,0x09,0x60,0x1d,0x00,0x87,0x00,0x02,0xe1,0x01,0xd0,
-0x08,0x20,0x00,0x76,0x00,0x1d,0x9e,0x02,0x01,0x47,0x0a,0x00,0x08,0x0d,0x31,0xd2,
-0x00,0xe0,0x29,0x0e,0xf5,0x26,0xf6,0x66,0x66,0x66,0xe2,0x00,0xf7,0x77,0x77,0x77,
-0x71,0x01,0xd7,0xaa,0xa5,0xaa,0xa5,0x02,0xc3,0x42,0xe1,0x62,0x78,0x03,0xb1,0xc0,
-0xd0,0xa5,0x58,0x05,0x90,0x45,0xe0,0x07,0x98,0x08,0x64,0xab,0xe2,0x8d,0xb8,0x0d,
-0x29,0x20,0xd4,0x50,0x68,0x2b,0x00,0x2c,0xc0,0x09,0xd5,0x4e,0x00,0x92,0x24,0x69,
-0xb0,0x00,0x1d,0xee,0xdf,0xb7,0x51,0xa0,0x3f,0x03,0xe9,0x2e,0x20,0x00,0x03,0x74,
-0x19,0x13,0xec,0x0d,0x00,0x02,0x1a,0x00,0x02,0xce,0x11,0x19,0xf8,0x27,0x00,0x04,
-0x2d,0x27,0x27,0x5f,0xec,0xa2,0x00,0x04,0x64,0x2a,0xe0,0x4c,0xcc,0xcc,0xc5,0x00,
-0x3c,0x02,0x44,0x4e,0x64,0x21,0xde,0xfd,0x80,0xd3,0x0e,0x11,0x2c,0x5d,0x03,0x21,
-0x02,0xc0,0xe0,0x0e,0x9d,0x6e,0xd8,0x00,0x0d,0x20,0x01,0xfc,0xd1,0x00,0x1a,0x00,
-0x00,0x56,0x17,0x66,0x20,0x00,0x8e,0x80,0x01,0xef,0x66,0x08,0x50,0x76,0x00,0x0d,
-0x06,0x00,0xc0,0x28,0x20,0xf0,0xa8,0x50,0x3c,0xf0,0x01,0x0e,0x00,0xc1,0x04,0xde,
-0xed,0x02,0xe6,0x78,0xa1,0x00,0x76,0x0a,0xce,0xa7,0x53,0x1a,0x00,0xf0,0x01,0x95,
-0x06,0x30,0x02,0xad,0xe1,0x07,0x81,0xd1,0x05,0xdc,0x80,0x00,0x3c,0xb6,0x00,0x43,
-0x11,0x10,0xf9,0x34,0x00,0xfd,0x02,0x01,0xbe,0x80,0x56,0x00,0x86,0x07,0xe7,0x1e,
-0x69,0x50,0xce,0x30,0x72,0x00,0x4e,0xe0,0x30,0x1b,0x12,0x1d,0xa9,0x19,0x10,0xd2,
-0x0d,0x00,0x70,0x35,0x59,0x65,0x51,0x1d,0xee,0xb5,0x9f,0x17,0xf0,0x0a,0x07,0x70,
-0x05,0x10,0x07,0x30,0x00,0x77,0x00,0x85,0x00,0xd2,0x00,0x3a,0xec,0x05,0x90,0x0f,
-0x00,0x1b,0xb8,0x00,0x2c,0x02,0xc0,0x34,0x00,0x20,0xe0,0x68,0x34,0x00,0xc0,0x09,
-0x0a,0x40,0x00,0x07,0x72,0xaa,0xaa,0xfb,0xa7,0x09,0xe4,0x62,0x28,0x1b,0x20,0x05,
-0x17,0xe1,0x8f,0xff,0xff,0xf0,0x01,0x97,0x18,0x60,0x00,0x00,0x04,0xde,0xec,0x86,
-0x1a,0x00,0xf1,0x09,0x08,0xfe,0xee,0xf2,0x00,0x08,0x62,0x86,0x00,0x0b,0x20,0x16,
-0xce,0xa8,0x60,0x00,0xb2,0x03,0x8a,0x60,0x8f,0xee,0xef,0x20,0xfd,0x0b,0x00,0x34,
-0x00,0x03,0x27,0x00,0xa0,0x83,0x33,0x33,0x10,0xdd,0x30,0x6b,0xbb,0xbb,0xb4,0x9c,
-0x00,0x11,0xc4,0xa9,0x00,0xf0,0x0c,0x5d,0xc0,0x00,0x17,0xbb,0x60,0x2e,0x27,0x90,
-0x01,0x6b,0xb6,0x3e,0x60,0x0b,0x90,0x00,0x77,0x2f,0xcd,0xdd,0xdb,0x80,0x07,0x70,
-0x30,0x00,0x7a,0x44,0xf0,0x06,0xf1,0x11,0x11,0x10,0x03,0xed,0x91,0x1f,0xcc,0xce,
-0x70,0x00,0x77,0x01,0xf0,0x00,0x87,0x00,0x07,0x70,0x1f,0xb4,0x33,0xc2,0x87,0x01,
-0xfb,0xbb,0xe7,0x00,0xbe,0x40,0x1f,0x11,0x19,0x70,0xa4,0x4a,0x01,0xc6,0x44,0x10,
-0xd0,0x67,0x20,0x00,0xc8,0x0a,0xb0,0x01,0x96,0x06,0xee,0xfe,0xeb,0x01,0x9c,0xb7,
-0x00,0x0d,0x1a,0x00,0x00,0x14,0x2d,0x30,0x60,0x08,0x50,0x8b,0x01,0xf0,0x0a,0x01,
-0xae,0xb1,0x11,0x14,0xc1,0x03,0xed,0x80,0xbc,0xcc,0xcf,0xc4,0x00,0x85,0x00,0xa1,
-0x02,0xb0,0x00,0x08,0x50,0x05,0xa0,0x2b,0x41,0x00,0x65,0x06,0x02,0xb0,0x00,0xbe,
-0x20,0xc7,0x31,0x00,0xb7,0x00,0x21,0x03,0xb0,0xc4,0x00,0xe0,0x3b,0x03,0x9e,0x40,
-0x00,0x86,0x03,0xfe,0xb6,0x10,0x04,0xde,0xec,0x3c,0x67,0x17,0xf0,0x07,0x86,0x01,
-0xe8,0x88,0x8e,0x20,0x08,0x74,0x01,0x33,0x33,0x10,0x27,0xde,0x93,0xdd,0xdd,0xdb,
-0x03,0x8a,0x60,0x3b,0x7a,0x15,0x74,0x86,0x03,0xec,0xcc,0xcd,0x00,0x08,0x0d,0x00,
-0x00,0x64,0x0a,0x30,0xce,0x30,0x3c,0x7c,0x18,0x0c,0xa8,0x01,0x00,0x9b,0x05,0xf1,
-0x23,0x77,0x01,0x11,0xa8,0x11,0x10,0x07,0x80,0xce,0xdd,0xdd,0xea,0x2d,0xee,0xbc,
-0x21,0x70,0x03,0xa0,0x07,0x70,0x30,0x88,0x00,0x13,0x00,0x77,0x2d,0xdf,0xed,0xdd,
-0xc0,0x08,0xcc,0x06,0xa0,0x0c,0x40,0x3e,0xea,0x20,0xe3,0x01,0xf0,0x00,0x17,0x70,
-0x1a,0xd5,0x98,0x01,0x23,0xd1,0xef,0x40,0x00,0x07,0x70,0x04,0xca,0x5d,0x90,0x0b,
-0xe4,0x0c,0xa4,0xa3,0x10,0x02,0xfa,0x3f,0x03,0x9f,0x2b,0x10,0xde,0xd3,0x2a,0x10,
-0xd1,0xf1,0x03,0x40,0x04,0xdf,0xd5,0xd4,0x32,0x21,0x00,0x0d,0x00,0x00,0x1a,0x00,
-0xf0,0x05,0xdd,0xed,0xed,0xd1,0x04,0xed,0x6e,0x0e,0x0a,0x05,0x06,0xbe,0x20,0xe0,
-0xe0,0xaa,0x70,0x00,0xd1,0x0d,0x59,0x31,0x40,0x0d,0x12,0xb0,0xe0,0xc6,0x2e,0x92,
-0x76,0x0f,0x9a,0x6c,0x00,0xcd,0x0a,0x13,0xc4,0xb3,0x4b,0x02,0x7b,0x1d,0x20,0x00,
-0xe0,0x4c,0x10,0x70,0xcc,0xcf,0xcc,0xc6,0x03,0xa7,0x20,0x61,0x0e,0xf0,0x1c,0xad,
-0xc7,0x5c,0xcf,0xcc,0xe0,0x00,0x95,0x01,0x11,0xe1,0x1e,0x10,0x09,0x54,0xaa,0xaf,
-0xaa,0xf9,0x16,0xdd,0x72,0x66,0xe6,0x6e,0x02,0x7b,0x50,0x58,0x4e,0x44,0x30,0x00,
-0x95,0x09,0x50,0xec,0xcc,0x00,0x09,0x50,0xdb,0x0e,0x41,0x00,0xb7,0x78,0x8a,0xe0,
-0x00,0x00,0xcd,0x2b,0x00,0x5a,0xdd,0xd8,0x55,0x00,0x01,0x01,0x23,0xf0,0x29,0x3b,
-0xbb,0xbc,0xc0,0x00,0x95,0x00,0x88,0x88,0x9c,0x02,0xde,0xea,0x01,0x11,0x12,0xc0,
-0x00,0x95,0x03,0x99,0x99,0x97,0x00,0x09,0x66,0xdc,0xcd,0xcc,0xc8,0x17,0xde,0xac,
-0x00,0xd0,0x03,0xa2,0x8b,0x52,0x9c,0xcf,0xcc,0xb5,0x00,0x95,0x03,0xa0,0xd0,0x0d,
-0x00,0x09,0x50,0x3a,0x0d,0x00,0xd0,0x0d,0x00,0x51,0xd2,0xbb,0x00,0xcd,0x20,0xe3,
-0x01,0x60,0x67,0x00,0x0c,0x1b,0x20,0x00,0x3b,0x33,0xf0,0x05,0xc2,0x00,0x00,0x78,
-0x06,0x7e,0x1c,0x87,0x21,0xde,0xec,0x56,0xe1,0xc8,0x61,0x00,0x67,0x00,0x0d,0x1c,
-0x1a,0x00,0xe0,0xad,0xf1,0xce,0xd1,0x02,0xae,0xd0,0x0d,0x1c,0x20,0x02,0xed,0x90,
-0x11,0x27,0x00,0x63,0x67,0x0c,0xcf,0x1c,0xdd,0x50,0x34,0x00,0x11,0x77,0x27,0x00,
-0x21,0x9e,0x40,0x0d,0x00,0x06,0xa3,0x00,0xf0,0x21,0x14,0x76,0x00,0x09,0x50,0xce,
-0xec,0xa7,0x20,0x00,0x95,0x03,0x03,0x40,0x09,0x22,0xde,0xe9,0xa3,0x1c,0x02,0xd0,
-0x00,0x95,0x04,0xa0,0xb0,0xb4,0x00,0x09,0x73,0x01,0x0c,0x06,0x00,0x2a,0xec,0x5b,
-0xbb,0xfb,0xbb,0x31,0x59,0x50,0x22,0xdf,0xd2,0x20,0xca,0x00,0xf0,0x02,0xe6,0xa0,
-0x00,0x09,0x50,0x8c,0x0e,0x0b,0x90,0x00,0x95,0x8a,0x00,0xe0,0x0a,0x70,0xcd,0xf9,
-0x0f,0x00,0xd4,0x08,0x00,0x0a,0x0c,0xf0,0x15,0x1c,0x02,0xbb,0xde,0xbb,0x90,0x48,
-0xe7,0x13,0x91,0x16,0x61,0x04,0x7e,0x60,0x0b,0x20,0xd1,0x00,0x01,0xc0,0x7b,0xcb,
-0xce,0xbb,0x10,0x1c,0x01,0x12,0xc2,0x11,0x10,0x04,0xff,0x00,0x3c,0x1a,0x12,0xf5,
-0x0f,0x1a,0xdf,0xdc,0xee,0xc3,0x01,0xc0,0x06,0xa0,0x09,0x60,0x00,0x1c,0x00,0x7c,
-0xa8,0xc0,0x00,0x01,0xc0,0x01,0x5d,0xcd,0x70,0x04,0xe8,0x0b,0xc8,0x20,0x19,0x16,
-0x4d,0x31,0x94,0x00,0x01,0x6b,0x2f,0xf0,0x0c,0x33,0x3d,0x63,0x32,0x02,0xa6,0x1f,
-0xbb,0xbb,0xbc,0xc2,0xbe,0xd7,0xd0,0x50,0x31,0x1a,0x00,0x94,0x00,0x7a,0x04,0xd2,
-0x00,0x09,0x40,0x9b,0x1c,0x0c,0xe1,0xab,0x85,0x32,0x22,0x24,0x02,0xdf,0x81,0x4b,
-0xbf,0xbb,0xb0,0x02,0x94,0xdf,0x1b,0x04,0xe7,0x22,0x01,0x0d,0x00,0xb0,0xcd,0x26,
-0xdd,0xdf,0xdd,0xdc,0x00,0x85,0x00,0x67,0x38,0x43,0x03,0xf0,0x06,0x0d,0x40,0xe0,
-0x00,0x01,0x96,0x13,0xf6,0x6b,0x76,0x02,0xde,0xeb,0xce,0x88,0xf8,0x80,0x00,0x85,
-0x7e,0xc0,0x8f,0x21,0xf0,0x0d,0x5a,0x5f,0xdd,0xfd,0xc0,0x02,0xbe,0xb2,0xc0,0x0e,
-0x00,0x03,0xee,0x70,0x2d,0x33,0xf3,0x20,0x00,0x85,0x02,0xea,0xaf,0xa9,0x00,0x08,
-0x50,0x2c,0x24,0x02,0x88,0x95,0x02,0xfe,0xef,0xee,0x50,0xce,0x20,0x36,0x42,0x40,
-0x94,0x00,0x1d,0x01,0x6e,0x3f,0xf1,0x25,0x01,0xd0,0x1d,0x00,0x00,0xa5,0x1e,0xef,
-0xee,0xfe,0x72,0xdf,0xe8,0x12,0xd1,0x2d,0x10,0x00,0x94,0x00,0x05,0x00,0x50,0x00,
-0x09,0x40,0x6d,0xdd,0xdd,0xd1,0x02,0xce,0x97,0x80,0x83,0x0d,0x14,0xee,0x60,0x78,
-0x08,0x30,0xd1,0x00,0x94,0x07,0xed,0xee,0xdf,0x10,0x09,0x40,0x0d,0x00,0xc6,0xa4,
-0x07,0xec,0xed,0xcf,0x10,0xcd,0x10,0x79,0x11,0x11,0xd1,0x55,0x00,0x02,0xa1,0x25,
-0xe0,0x7d,0xbb,0xbb,0xd0,0x04,0xb7,0x37,0xca,0xaa,0xad,0x02,0x9d,0xb7,0x76,0x02,
-0x04,0x20,0x94,0x05,0xc1,0x22,0x20,0x09,0x40,0xba,0x2b,0xc0,0x01,0xbc,0x9b,0xbb,
-0xfb,0xbb,0x63,0xcd,0x60,0x36,0x0e,0x00,0xd2,0x23,0x20,0x70,0xec,0xd2,0x23,0x11,
-0xcc,0x0d,0x00,0xa5,0x6b,0x4b,0xf0,0x00,0x00,0xcd,0x2c,0x20,0x3a,0xdd,0x1d,0x3f,
-0xf0,0x00,0xd0,0x00,0x02,0x47,0xb6,0x00,0x0d,0x00,0x6c,0xbf,0x74,0x10,0x14,0xe5,
-0x10,0x10,0x00,0x60,0x9f,0x93,0xee,0xef,0xee,0xe6,0x59,0x04,0x00,0x8e,0x3a,0xf1,
-0x0c,0x11,0x7d,0x4d,0x6d,0xc0,0x05,0xff,0x6b,0x10,0xd0,0x0e,0x05,0xdf,0x20,0xb1,
-0x0d,0x00,0xe0,0x00,0xd0,0x0b,0xd7,0xd6,0xcf,0x00,0x0d,0x00,0x0d,0x00,0xb5,0xe0,
-0x0b,0xcb,0xfb,0xbf,0x00,0xcd,0x00,0xb3,0x11,0x11,0x1e,0x11,0x12,0x68,0xf6,0x0d,
-0xe0,0x80,0x0f,0xbb,0xbb,0xe0,0x04,0x8a,0x30,0xfa,0xaa,0xae,0x01,0xac,0xd8,0x00,
-0x16,0x30,0x00,0x68,0x00,0xaa,0x00,0xf6,0x1e,0x06,0x80,0x77,0x77,0x77,0x76,0x03,
-0xaf,0xb4,0xa9,0x44,0x44,0x33,0xba,0x80,0x3f,0xdc,0xcc,0xc4,0x00,0x68,0x4c,0x1b,
-0x39,0x58,0x40,0x06,0x81,0x19,0x71,0xc0,0xa3,0x00,0x68,0x0a,0x80,0xc4,0x0d,0x10,
-0xbe,0x51,0x50,0x76,0x7c,0xa0,0xaa,0x00,0x11,0x68,0x18,0x40,0xf6,0x36,0x0d,0xdc,
-0xd1,0x00,0x14,0xe4,0x09,0x70,0x5a,0x00,0x04,0x9f,0x96,0xfc,0xcf,0xdc,0xa0,0x00,
-0xd0,0x2c,0x04,0x14,0x0c,0x00,0x0d,0x10,0xc1,0xb0,0xb1,0xc0,0x05,0xfd,0x0c,0x93,
-0x23,0x7c,0x06,0x9d,0x00,0xc0,0x1d,0x00,0xc0,0x00,0xd0,0x9d,0xcd,0xfc,0xcd,0x70,
-0x0d,0x00,0x00,0xca,0x90,0x00,0x00,0xd0,0x02,0xb8,0x09,0xa3,0x02,0xe9,0x0b,0xb4,
-0x00,0x04,0xa7,0xef,0x02,0xf6,0x3c,0x12,0x34,0x75,0x00,0x09,0x50,0xbb,0xab,0x77,
-0x50,0x00,0x96,0x05,0x61,0xb0,0x96,0x02,0xde,0xe9,0x3b,0x2a,0x4d,0x20,0x00,0x95,
-0x09,0xbe,0x99,0x99,0x10,0x09,0x51,0x69,0xc6,0x66,0x63,0x00,0xab,0xa5,0xb9,0x55,
-0x55,0x22,0xee,0x81,0x0d,0xdb,0xbd,0x70,0x00,0x95,0x02,0xed,0x10,0xd2,0x00,0x09,
-0x50,0x96,0x4d,0xb7,0x00,0x00,0x95,0x6c,0x16,0xde,0x93,0x00,0xcd,0x3b,0x1c,0x71,
-0x05,0xb7,0x55,0x00,0x20,0x02,0xc0,0xe7,0x03,0x20,0x01,0xdd,0xe7,0x03,0xa0,0x06,
-0xd5,0x10,0xb6,0x02,0xde,0xea,0x83,0x2b,0xb8,0x1a,0x00,0xf0,0x05,0xa9,0xb3,0x00,
-0x00,0x09,0x52,0xcf,0x70,0x00,0x00,0x04,0xce,0x83,0xec,0xfd,0xcc,0x02,0x9b,0x50,
-0x93,0xa6,0x04,0xf0,0x0e,0x95,0x4c,0xcc,0xfd,0xcc,0x70,0x09,0x50,0x53,0x0d,0x10,
-0x90,0x00,0x95,0x07,0x95,0xe6,0x5e,0x00,0xcd,0x20,0x36,0x66,0x66,0xe0,0x00,0xa4,
-0x00,0x1d,0x0d,0x18,0xf0,0x00,0x43,0xdd,0xfd,0xdf,0xd7,0x06,0xc9,0x30,0x1b,0x02,
-0xa0,0x01,0x9d,0xb5,0x7b,0xdf,0x48,0x20,0xa4,0x09,0x2c,0x1a,0xf0,0x07,0x0a,0x40,
-0x9d,0xaa,0xab,0xe0,0x03,0xcd,0x99,0xb7,0x77,0x7e,0x01,0xac,0x40,0x13,0x3e,0x43,
-0x20,0x00,0xa4,0x6c,0x4e,0x00,0xf6,0x04,0x0a,0x40,0x00,0x98,0xc2,0x00,0x00,0xa4,
-0x01,0xab,0x03,0xd4,0x00,0xcd,0x18,0xd6,0x00,0x02,0xa9,0x4d,0x01,0xf7,0x3c,0x00,
-0x52,0x00,0x00,0x0d,0x03,0xcc,0xd4,0x8a,0x00,0x01,0xd1,0x38,0x76,0x0d,0x38,0x13,
-0xaf,0xa0,0xa9,0x00,0x2e,0x50,0x00,0xd2,0xdf,0xc7,0x7b,0xed,0x50,0x0d,0x42,0x02,
-0x9a,0x0c,0x00,0x28,0xfa,0x5c,0xca,0xc0,0xa9,0x03,0x7e,0x07,0x60,0x07,0x55,0x30,
-0x00,0xd0,0xad,0xb6,0xa7,0xa9,0x00,0x0d,0x00,0x05,0x76,0x9c,0x20,0x00,0xd0,0x00,
-0x75,0x2d,0xd0,0x01,0xdb,0x00,0xbd,0x4c,0x35,0xa0,0x4d,0x01,0xf3,0x3d,0x47,0xaa,
-0x00,0x09,0x50,0xbc,0x9f,0x66,0x40,0x15,0xb9,0x40,0xc0,0xd0,0xb3,0x01,0x6b,0x97,
-0xbd,0xbf,0xcf,0xb6,0x00,0x95,0x01,0x3d,0xec,0x61,0x00,0x09,0x84,0x2d,0x3d,0x1d,
-0x60,0x06,0xdd,0xcd,0x30,0x90,0x1b,0xa3,0x9b,0x52,0x8d,0xbf,0xbb,0xe1,0x00,0x95,
-0x07,0x50,0xd0,0x0e,0x00,0x09,0x50,0x7d,0xbf,0xbb,0xe0,0x00,0x95,0x07,0x71,0xd1,
-0x1e,0x00,0xcd,0x20,0x7c,0x99,0x99,0xc0,0x00,0x85,0x43,0x27,0xf3,0x08,0xcb,0xeb,
+0x00,0x5e,0xdd,0xf2,0x0f,0x3a,0x00,0xf4,0x07,0xe7,0x03,0x10,0x14,0x7a,0xe8,0xbe,
+0xa0,0x76,0x1f,0xc8,0x42,0xb9,0x1e,0x4a,0x30,0x00,0x00,0x96,0x00,0x4e,0xc0,0x53,
+0x00,0xb0,0x3b,0x00,0x3c,0x37,0x00,0x06,0xcd,0xfc,0xc2,0xc0,0xa8,0x0d,0x00,0xfa,
+0x2f,0x2d,0x00,0x60,0x1d,0xdd,0xfd,0xdd,0xfd,0xdd,0x60,0x06,0x47,0x10,0x0e,0x00,
+0x00,0x00,0xe8,0xab,0x71,0xe0,0x5a,0x00,0xad,0x49,0x84,0x1c,0x2c,0x40,0x18,0xea,
+0xcc,0xa0,0x99,0xd0,0x00,0x0d,0x49,0x84,0x05,0xf4,0x00,0x00,0xd5,0x99,0x50,0x8f,
+0x03,0x80,0x0f,0xcd,0xdc,0x8c,0xa7,0x57,0x00,0xc0,0x00,0x4d,0x11,0xde,0x20,0xa6,
+0x01,0xfa,0x3e,0x1c,0x00,0x02,0xb4,0x40,0x00,0x01,0xea,0xa5,0x1c,0x2d,0x10,0x8a,
+0xbe,0xaa,0x90,0xc0,0x64,0x0c,0x03,0xb5,0x79,0x2e,0x68,0x50,0xc5,0x8c,0x45,0x9b,
+0xf7,0x52,0x0c,0x00,0x88,0x70,0x0d,0x07,0x50,0xc7,0xaa,0xaa,0x60,0xc2,0xd1,0x0c,
+0x1a,0x88,0xa0,0x0a,0x9a,0x00,0xc2,0xb0,0x0c,0x00,0x7f,0x20,0x2b,0x1b,0x9a,0xa0,
+0x09,0xc0,0x76,0x60,0x47,0xa7,0x5c,0x9d,0x5b,0x42,0xab,0x97,0x5a,0x50,0x3d,0x50,
+0x5b,0x00,0xa1,0x25,0x8b,0xd2,0x00,0xad,0xca,0x85,0x20,0x00,0x0d,0xb8,0x02,0xf0,
+0x0d,0xdc,0xbb,0xbb,0xbb,0xa0,0x0d,0x42,0x22,0x22,0x3e,0x00,0xd1,0x00,0x00,0x01,
+0xe0,0x0f,0x10,0x00,0x00,0x1e,0x00,0xfe,0xee,0xee,0xee,0xe0,0x3c,0xfc,0x05,0x10,
+0x09,0x37,0x01,0x11,0x03,0x0f,0x01,0x12,0x44,0x41,0x00,0xf0,0x00,0x03,0x6a,0x10,
+0x14,0x9b,0x00,0xcd,0xa8,0x30,0xec,0x96,0x10,0x0d,0x10,0x00,0xea,0x00,0x40,0xdd,
+0xdd,0xa0,0xe0,0x16,0x05,0xf0,0x08,0x2c,0x0f,0xbb,0xbb,0x40,0xe1,0x02,0xc0,0xe3,
+0x4e,0x31,0x0e,0xed,0xec,0x2d,0x01,0xd0,0x00,0xf0,0x00,0x03,0xb0,0x1d,0x24,0x00,
+0xfc,0x07,0x5a,0x01,0xd0,0x03,0xc0,0x00,0x09,0x60,0x1d,0x00,0x87,0x00,0x02,0xe1,
+0x01,0xd0,0x08,0x20,0x00,0x76,0x00,0x1d,0x9e,0x02,0x21,0x01,0xe0,0x4e,0x00,0x31,
+0xfe,0xdd,0xd2,0x06,0x03,0xf5,0x28,0xd2,0x00,0xf6,0x66,0x66,0x66,0xe2,0x00,0xf7,
+0x77,0x77,0x77,0x71,0x01,0xd7,0xaa,0xa5,0xaa,0xa5,0x02,0xc3,0x42,0xe1,0x62,0x78,
+0x03,0xb1,0xc0,0xd0,0xa5,0x58,0x05,0x90,0x45,0xe0,0x07,0x98,0x08,0x64,0xab,0xe2,
+0x8d,0xb8,0x0d,0x29,0x20,0xd4,0x50,0x68,0x2b,0x00,0x2c,0xc0,0x09,0xd5,0x4e,0x00,
+0x90,0x24,0x69,0xb0,0x00,0x1d,0xee,0xdf,0xb7,0x51,0x0e,0x00,0x11,0xb3,0x14,0x00,
+0xa3,0x0b,0x30,0x00,0x00,0x03,0xee,0xee,0xff,0xee,0xec,0x0d,0x00,0x02,0x1a,0x00,
+0x20,0x01,0xff,0x01,0x00,0x19,0xf8,0x27,0x00,0x00,0x2f,0x02,0x00,0x05,0x00,0x27,
+0x5f,0xec,0xa2,0x00,0x11,0x2c,0x06,0x00,0xf0,0x03,0x02,0xc0,0x4c,0xcc,0xcc,0xc5,
+0x00,0x3c,0x02,0x44,0x4e,0x64,0x21,0xde,0xfd,0x80,0x00,0xd2,0x1a,0x00,0x00,0x5d,
+0x03,0x30,0x02,0xc0,0x00,0x0d,0x00,0x9c,0x6e,0xd8,0x00,0x0d,0x20,0x01,0xfc,0xd1,
+0x00,0x1a,0x00,0x00,0x0d,0x00,0x85,0x0e,0x20,0x00,0x8e,0x80,0x01,0xef,0xc0,0x55,
+0x00,0xf0,0x10,0x76,0x00,0x0d,0x06,0x00,0x00,0x07,0x60,0x00,0xf0,0xa8,0x00,0x00,
+0x87,0x00,0x0e,0x00,0xc1,0x04,0xde,0xed,0x02,0xe6,0x78,0xa1,0x00,0x76,0x0a,0xce,
+0xa7,0x53,0x1a,0x00,0xf0,0x00,0x95,0x06,0x30,0x02,0xad,0xe1,0x07,0x81,0xd1,0x05,
+0xdc,0x80,0x00,0x3c,0xb6,0x34,0x00,0x20,0x00,0xf9,0x34,0x00,0xfa,0x02,0x01,0xbe,
+0x80,0x56,0x00,0x86,0x07,0xe7,0x1e,0x69,0x50,0xce,0x30,0x72,0x00,0x4e,0xe0,0x52,
+0x01,0x21,0x07,0x70,0x66,0x01,0x11,0x77,0x7c,0x00,0xf0,0x17,0x07,0x70,0x35,0x59,
+0x65,0x51,0x1d,0xee,0xb5,0x99,0x99,0x99,0x30,0x07,0x70,0x05,0x10,0x07,0x30,0x00,
+0x77,0x00,0x85,0x00,0xd2,0x00,0x3a,0xec,0x05,0x90,0x0f,0x00,0x1b,0xb8,0x00,0x2c,
+0x02,0xc0,0x34,0x00,0x20,0xe0,0x68,0x34,0x00,0xf4,0x01,0x09,0x0a,0x40,0x00,0x07,
+0x72,0xaa,0xaa,0xfb,0xa7,0x09,0xe4,0x03,0x33,0x33,0x33,0xa6,0x02,0x11,0x86,0x06,
+0x00,0xf1,0x01,0x08,0x60,0x8f,0xff,0xff,0xf0,0x01,0x97,0x18,0x60,0x00,0x00,0x04,
+0xde,0xec,0x86,0x1a,0x00,0xf1,0x0d,0x08,0xfe,0xee,0xf2,0x00,0x08,0x62,0x86,0x00,
+0x0b,0x20,0x16,0xce,0xa8,0x60,0x00,0xb2,0x03,0x8a,0x60,0x8f,0xee,0xef,0x20,0x00,
+0x86,0x08,0x60,0x34,0x00,0x03,0x27,0x00,0xa0,0x83,0x33,0x33,0x10,0xdd,0x30,0x6b,
+0xbb,0xbb,0xb4,0x9c,0x00,0x11,0xc4,0xa9,0x00,0xf0,0x0b,0x5d,0xc0,0x00,0x17,0xbb,
+0x60,0x2e,0x27,0x90,0x01,0x6b,0xb6,0x3e,0x60,0x0b,0x90,0x00,0x77,0x2f,0xcd,0xdd,
+0xdb,0x80,0x07,0x70,0x30,0xcd,0x01,0xf0,0x16,0xae,0xf1,0x11,0x11,0x10,0x03,0xed,
+0x91,0x1f,0xcc,0xce,0x70,0x00,0x77,0x01,0xf0,0x00,0x87,0x00,0x07,0x70,0x1f,0x00,
+0x08,0x70,0x00,0x87,0x01,0xfb,0xbb,0xe7,0x00,0xbe,0x40,0x1f,0x11,0x19,0xae,0x02,
+0x01,0xa6,0x00,0xf0,0x08,0x85,0x00,0x00,0xd0,0x00,0x00,0x08,0x50,0x00,0x0d,0x00,
+0x00,0x01,0x96,0x06,0xee,0xfe,0xeb,0x01,0x9c,0xb7,0x00,0x0d,0x1a,0x00,0x70,0x1e,
+0xee,0xfe,0xee,0x60,0x08,0x50,0x8b,0x01,0xf0,0x0a,0x01,0xae,0xb1,0x11,0x14,0xc1,
+0x03,0xed,0x80,0xbc,0xcc,0xcf,0xc4,0x00,0x85,0x00,0xa1,0x02,0xb0,0x00,0x08,0x50,
+0x05,0xa0,0x2b,0x41,0x00,0x95,0x06,0x02,0xb0,0x00,0xbe,0x20,0x00,0x0c,0xe8,0x4d,
+0x01,0x31,0x86,0x03,0xb0,0xc4,0x00,0xf4,0x24,0x3b,0x03,0x9e,0x40,0x00,0x86,0x03,
+0xfe,0xb6,0x10,0x04,0xde,0xec,0x3c,0x00,0x00,0x84,0x00,0x86,0x01,0xe8,0x88,0x8e,
+0x20,0x08,0x74,0x01,0x33,0x33,0x10,0x27,0xde,0x93,0xdd,0xdd,0xdb,0x03,0x8a,0x60,
+0x3b,0x00,0x01,0xd0,0x00,0x86,0x03,0xec,0xcc,0xcd,0x00,0x08,0x0d,0x00,0xad,0xe9,
+0x99,0xad,0x00,0xce,0x30,0x3c,0x22,0x23,0xd0,0xa8,0x01,0x00,0x9b,0x05,0xf0,0x23,
+0x77,0x01,0x11,0xa8,0x11,0x10,0x07,0x80,0xce,0xdd,0xdd,0xea,0x2d,0xee,0xbc,0x21,
+0x70,0x03,0xa0,0x07,0x70,0x30,0x88,0x00,0x13,0x00,0x77,0x2d,0xdf,0xed,0xdd,0xc0,
+0x08,0xcc,0x06,0xa0,0x0c,0x40,0x3e,0xea,0x20,0xe3,0x01,0xf0,0x00,0x17,0x70,0x1a,
+0xd5,0x98,0xa8,0x01,0xf3,0x02,0x03,0xef,0x40,0x00,0x07,0x70,0x04,0xca,0x5d,0x90,
+0x0b,0xe4,0x0c,0xa4,0x00,0x09,0x70,0x55,0x00,0x12,0xd1,0xfb,0x04,0x70,0x10,0xde,
+0xee,0xee,0xd0,0x00,0xd1,0xf1,0x03,0x71,0x04,0xdf,0xd5,0xd4,0xdd,0xdd,0x80,0x0d,
+0x00,0x00,0x1a,0x00,0xf4,0x1c,0xdd,0xed,0xed,0xd1,0x04,0xed,0x6e,0x0e,0x0a,0x05,
+0x06,0xbe,0x20,0xe0,0xe0,0xaa,0x70,0x00,0xd1,0x0d,0x0e,0x06,0x80,0x00,0x0d,0x12,
+0xb0,0xe0,0x1d,0x00,0x00,0xd1,0x76,0x0f,0x9a,0x6c,0x00,0xcd,0x0a,0x13,0xc4,0x00,
+0x61,0xaa,0x00,0x20,0x95,0x00,0x9c,0x03,0xf0,0x29,0x09,0x50,0xcc,0xcf,0xcc,0xc6,
+0x03,0xa7,0x20,0x00,0xe0,0x00,0x02,0xad,0xc7,0x5c,0xcf,0xcc,0xe0,0x00,0x95,0x01,
+0x11,0xe1,0x1e,0x10,0x09,0x54,0xaa,0xaf,0xaa,0xf9,0x16,0xdd,0x72,0x66,0xe6,0x6e,
+0x02,0x7b,0x50,0x58,0x4e,0x44,0x30,0x00,0x95,0x09,0x50,0xec,0xcc,0x00,0x09,0x50,
+0xdb,0x0e,0x41,0x00,0xb7,0x78,0x8a,0xe0,0x00,0x00,0xcd,0x2b,0x00,0x5a,0xdd,0xd8,
+0x55,0x00,0x10,0x00,0x55,0x00,0xf0,0x29,0x3b,0xbb,0xbc,0xc0,0x00,0x95,0x00,0x88,
+0x88,0x9c,0x02,0xde,0xea,0x01,0x11,0x12,0xc0,0x00,0x95,0x03,0x99,0x99,0x97,0x00,
+0x09,0x66,0xdc,0xcd,0xcc,0xc8,0x17,0xde,0xac,0x00,0xd0,0x03,0xa2,0x8b,0x52,0x9c,
+0xcf,0xcc,0xb5,0x00,0x95,0x03,0xa0,0xd0,0x0d,0x00,0x09,0x50,0x3a,0x0d,0x00,0xd0,
+0x0d,0x00,0x51,0xd2,0xbb,0x00,0xcd,0x20,0xe3,0x01,0xf0,0x0f,0x67,0x00,0x0c,0x1b,
+0x20,0x00,0x06,0x70,0x00,0xd1,0xc2,0x00,0x00,0x78,0x06,0x7e,0x1c,0x87,0x21,0xde,
+0xec,0x56,0xe1,0xc8,0x61,0x00,0x67,0x00,0x0d,0x1c,0x1a,0x00,0xe0,0xad,0xf1,0xce,
+0xd1,0x02,0xae,0xd0,0x0d,0x1c,0x20,0x02,0xed,0x90,0x11,0x27,0x00,0x63,0x67,0x0c,
+0xcf,0x1c,0xdd,0x50,0x34,0x00,0x11,0x77,0x27,0x00,0x21,0x9e,0x40,0x0d,0x00,0x06,
+0xa3,0x00,0xf0,0x21,0x14,0x76,0x00,0x09,0x50,0xce,0xec,0xa7,0x20,0x00,0x95,0x03,
+0x03,0x40,0x09,0x22,0xde,0xe9,0xa3,0x1c,0x02,0xd0,0x00,0x95,0x04,0xa0,0xb0,0xb4,
+0x00,0x09,0x73,0x01,0x0c,0x06,0x00,0x2a,0xec,0x5b,0xbb,0xfb,0xbb,0x31,0x59,0x50,
+0x22,0xdf,0xd2,0x20,0xca,0x00,0xf1,0x05,0xe6,0xa0,0x00,0x09,0x50,0x8c,0x0e,0x0b,
+0x90,0x00,0x95,0x8a,0x00,0xe0,0x0a,0x70,0xcd,0x20,0x00,0x0e,0xd4,0x08,0xf4,0x3c,
+0x08,0x40,0x00,0x00,0x1c,0x02,0xbb,0xde,0xbb,0x90,0x48,0xe7,0x13,0x91,0x16,0x61,
+0x04,0x7e,0x60,0x0b,0x20,0xd1,0x00,0x01,0xc0,0x7b,0xcb,0xce,0xbb,0x10,0x1c,0x01,
+0x12,0xc2,0x11,0x10,0x04,0xff,0x00,0x3c,0x00,0x00,0x0a,0xdd,0x1a,0xdf,0xdc,0xee,
+0xc3,0x01,0xc0,0x06,0xa0,0x09,0x60,0x00,0x1c,0x00,0x7c,0xa8,0xc0,0x00,0x01,0xc0,
+0x01,0x5d,0xcd,0x70,0x04,0xe8,0x0b,0xc8,0x20,0x19,0x90,0xa3,0x00,0x11,0x94,0x2c,
+0x09,0xf0,0x23,0x09,0x40,0x33,0x3d,0x63,0x32,0x02,0xa6,0x1f,0xbb,0xbb,0xbc,0xc2,
+0xbe,0xd7,0xd0,0x50,0x31,0x1a,0x00,0x94,0x00,0x7a,0x04,0xd2,0x00,0x09,0x40,0x9b,
+0x00,0x03,0xd3,0x00,0xab,0x85,0x32,0x22,0x24,0x02,0xdf,0x81,0x4b,0xbf,0xbb,0xb0,
+0x02,0x94,0x00,0x00,0xe1,0x34,0x00,0x00,0xaa,0x0b,0x12,0x00,0x0d,0x00,0xb0,0xcd,
+0x26,0xdd,0xdf,0xdd,0xdc,0x00,0x85,0x00,0x67,0x38,0x43,0x03,0xf0,0x26,0x0d,0x40,
+0xe0,0x00,0x01,0x96,0x13,0xf6,0x6b,0x76,0x02,0xde,0xeb,0xce,0x88,0xf8,0x80,0x00,
+0x85,0x7e,0xc0,0x0e,0x00,0x00,0x08,0x5a,0x5f,0xdd,0xfd,0xc0,0x02,0xbe,0xb2,0xc0,
+0x0e,0x00,0x03,0xee,0x70,0x2d,0x33,0xf3,0x20,0x00,0x85,0x02,0xea,0xaf,0xa9,0x00,
+0x08,0x50,0x2c,0x24,0x02,0x82,0x95,0x02,0xfe,0xef,0xee,0x50,0xce,0x20,0x34,0x05,
+0x04,0xa3,0x00,0xf1,0x2b,0x1d,0x01,0xd0,0x00,0x09,0x40,0x01,0xd0,0x1d,0x00,0x00,
+0xa5,0x1e,0xef,0xee,0xfe,0x72,0xdf,0xe8,0x12,0xd1,0x2d,0x10,0x00,0x94,0x00,0x05,
+0x00,0x50,0x00,0x09,0x40,0x6d,0xdd,0xdd,0xd1,0x02,0xce,0x97,0x80,0x83,0x0d,0x14,
+0xee,0x60,0x78,0x08,0x30,0xd1,0x00,0x94,0x07,0xed,0xee,0xdf,0x10,0x09,0x40,0x0d,
+0x00,0xc6,0xa4,0x07,0xec,0xed,0xcf,0x10,0xcd,0x10,0x79,0x11,0x11,0xd1,0x55,0x00,
+0x01,0x3e,0x02,0xf0,0x00,0x40,0x7d,0xbb,0xbb,0xd0,0x04,0xb7,0x37,0xca,0xaa,0xad,
+0x02,0x9d,0xb7,0x76,0x02,0x04,0xf0,0x08,0x94,0x05,0xbb,0xbb,0xba,0x00,0x09,0x40,
+0x11,0x11,0x11,0x10,0x01,0xbc,0x9b,0xbb,0xfb,0xbb,0x63,0xcd,0x60,0x36,0x0e,0x34,
+0x00,0x20,0x08,0x70,0x93,0x02,0x21,0x40,0xcc,0x0d,0x00,0xb4,0x6b,0x4b,0xf0,0x00,
+0x00,0xcd,0x2c,0x20,0x3a,0xdd,0xdb,0x55,0x00,0xf0,0x00,0xd0,0x00,0x02,0x47,0xb6,
+0x00,0x0d,0x00,0x6c,0xbf,0x74,0x10,0x14,0xe5,0x10,0x10,0x00,0x81,0x9f,0x93,0xee,
+0xef,0xee,0xe6,0x00,0xd0,0x5c,0x04,0xf1,0x0d,0x0d,0x11,0x7d,0x4d,0x6d,0xc0,0x05,
+0xff,0x6b,0x10,0xd0,0x0e,0x05,0xdf,0x20,0xb1,0x0d,0x00,0xe0,0x00,0xd0,0x0b,0xd7,
+0xd6,0xcf,0x00,0x0d,0x00,0x0d,0x00,0xc3,0xe0,0x0b,0xcb,0xfb,0xbf,0x00,0xcd,0x00,
+0xb3,0x11,0x11,0xe0,0x25,0x09,0x21,0x00,0x68,0x09,0x00,0xf0,0x01,0x06,0x80,0x0f,
+0xbb,0xbb,0xe0,0x04,0x8a,0x30,0xfa,0xaa,0xae,0x01,0xac,0xd8,0x0d,0x52,0x03,0x20,
+0x68,0x00,0xaa,0x00,0xf6,0x1e,0x06,0x80,0x77,0x77,0x77,0x76,0x03,0xaf,0xb4,0xa9,
+0x44,0x44,0x33,0xba,0x80,0x3f,0xdc,0xcc,0xc4,0x00,0x68,0x4c,0x1b,0x39,0x58,0x40,
+0x06,0x81,0x19,0x71,0xc0,0xa3,0x00,0x68,0x0a,0x80,0xc4,0x0d,0x10,0xbe,0x51,0x50,
+0x76,0x7c,0xa0,0xaa,0x00,0x10,0x68,0xcd,0x03,0xf6,0x37,0x00,0x0d,0xdc,0xd1,0x00,
+0x14,0xe4,0x09,0x70,0x5a,0x00,0x04,0x9f,0x96,0xfc,0xcf,0xdc,0xa0,0x00,0xd0,0x2c,
+0x04,0x14,0x0c,0x00,0x0d,0x10,0xc1,0xb0,0xb1,0xc0,0x05,0xfd,0x0c,0x93,0x23,0x7c,
+0x06,0x9d,0x00,0xc0,0x1d,0x00,0xc0,0x00,0xd0,0x9d,0xcd,0xfc,0xcd,0x70,0x0d,0x00,
+0x00,0xca,0x90,0x00,0x00,0xd0,0x02,0xb8,0x09,0xa3,0x02,0xe9,0x0b,0xb4,0x00,0x04,
+0xa7,0xef,0x02,0xf6,0x3c,0x12,0x34,0x75,0x00,0x09,0x50,0xbb,0xab,0x77,0x50,0x00,
+0x96,0x05,0x61,0xb0,0x96,0x02,0xde,0xe9,0x3b,0x2a,0x4d,0x20,0x00,0x95,0x09,0xbe,
+0x99,0x99,0x10,0x09,0x51,0x69,0xc6,0x66,0x63,0x00,0xab,0xa5,0xb9,0x55,0x55,0x22,
+0xee,0x81,0x0d,0xdb,0xbd,0x70,0x00,0x95,0x02,0xed,0x10,0xd2,0x00,0x09,0x50,0x96,
+0x4d,0xb7,0x00,0x00,0x95,0x6c,0x16,0xde,0x93,0x00,0xcd,0x3b,0x1c,0x71,0x05,0xb7,
+0x55,0x00,0x20,0x02,0xc0,0xe7,0x03,0x20,0x01,0xdd,0xe7,0x03,0xa0,0x06,0xd5,0x10,
+0xb6,0x02,0xde,0xea,0x83,0x2b,0xb8,0x1a,0x00,0xf0,0x05,0xa9,0xb3,0x00,0x00,0x09,
+0x52,0xcf,0x70,0x00,0x00,0x04,0xce,0x83,0xec,0xfd,0xcc,0x02,0x9b,0x50,0x93,0xa6,
+0x04,0xf0,0x41,0x95,0x4c,0xcc,0xfd,0xcc,0x70,0x09,0x50,0x53,0x0d,0x10,0x90,0x00,
+0x95,0x07,0x95,0xe6,0x5e,0x00,0xcd,0x20,0x36,0x66,0x66,0xe0,0x00,0xa4,0x00,0x1d,
+0x02,0xc0,0x00,0x0a,0x43,0xdd,0xfd,0xdf,0xd7,0x06,0xc9,0x30,0x1b,0x02,0xa0,0x01,
+0x9d,0xb5,0x7b,0xbb,0xbb,0xb0,0x00,0xa4,0x09,0x60,0x00,0x0e,0x00,0x0a,0x40,0x9d,
+0xaa,0xab,0xe0,0x03,0xcd,0x99,0xb7,0x77,0x7e,0x01,0xac,0x40,0x13,0x3e,0x43,0x20,
+0x00,0xa4,0x6c,0x4e,0x00,0xf6,0x04,0x0a,0x40,0x00,0x98,0xc2,0x00,0x00,0xa4,0x01,
+0xab,0x03,0xd4,0x00,0xcd,0x18,0xd6,0x00,0x02,0xa9,0x4d,0x01,0xf7,0x3c,0x00,0x52,
+0x00,0x00,0x0d,0x03,0xcc,0xd4,0x8a,0x00,0x01,0xd1,0x38,0x76,0x0d,0x38,0x13,0xaf,
+0xa0,0xa9,0x00,0x2e,0x50,0x00,0xd2,0xdf,0xc7,0x7b,0xed,0x50,0x0d,0x42,0x02,0x9a,
+0x0c,0x00,0x28,0xfa,0x5c,0xca,0xc0,0xa9,0x03,0x7e,0x07,0x60,0x07,0x55,0x30,0x00,
+0xd0,0xad,0xb6,0xa7,0xa9,0x00,0x0d,0x00,0x05,0x76,0x9c,0x20,0x00,0xd0,0x00,0x75,
+0x2d,0xd0,0x01,0xdb,0x00,0xbd,0x4c,0x35,0xa0,0x4d,0x01,0xf2,0x3d,0x47,0xaa,0x00,
+0x09,0x50,0xbc,0x9f,0x66,0x40,0x15,0xb9,0x40,0xc0,0xd0,0xb3,0x01,0x6b,0x97,0xbd,
+0xbf,0xcf,0xb6,0x00,0x95,0x01,0x3d,0xec,0x61,0x00,0x09,0x84,0x2d,0x3d,0x1d,0x60,
+0x06,0xdd,0xcd,0x30,0x90,0x1b,0xa3,0x9b,0x52,0x8d,0xbf,0xbb,0xe1,0x00,0x95,0x07,
+0x50,0xd0,0x0e,0x00,0x09,0x50,0x7d,0xbf,0xbb,0xe0,0x00,0x95,0x07,0x71,0xd1,0x1e,
+0x00,0xcd,0x20,0x7c,0x99,0x99,0xc0,0x00,0x85,0x7f,0x07,0xf3,0x09,0x50,0xcb,0xeb,
 0xeb,0xf0,0x01,0x96,0x0c,0x2c,0x2c,0x1d,0x01,0xbd,0xc7,0x57,0x7e,0x77,0x70,0x00,
 0x85,0x07,0xbb,0xfb,0xb8,0xf6,0x06,0xf1,0x0d,0x03,0xce,0x9c,0xdc,0xcc,0xec,0x21,
 0x9b,0x50,0x28,0x82,0x6a,0x20,0x00,0x85,0x06,0x77,0xe7,0x76,0x00,0x08,0x54,0xbb,
-0xbf,0xbb,0xb4,0x00,0x95,0xe7,0x00,0x12,0xce,0x2d,0x05,0x03,0x85,0x16,0x11,0x0c,
-0xdc,0x09,0xf3,0x2c,0xaa,0xea,0xa1,0xeb,0xd7,0x00,0x0d,0xae,0xac,0xb9,0x03,0xba,
-0x10,0xc7,0xe7,0xb3,0xbb,0xbc,0x00,0x58,0x8e,0x88,0x29,0x67,0x80,0x00,0xa1,0xc1,
-0x92,0x6e,0xe6,0x20,0x07,0x88,0x87,0xa7,0x35,0xab,0x10,0x99,0x99,0xae,0x76,0x53,
-0x00,0x05,0x99,0x9a,0xe9,0x99,0x80,0x07,0xaa,0xaa,0xce,0xaa,0xaa,0xa2,0x00,0xad,
-0x4a,0x10,0x0b,0x24,0x3f,0x05,0x09,0x44,0xf0,0x1a,0x3e,0xbb,0xd7,0x00,0x01,0xe1,
-0x03,0xa1,0x17,0x70,0x04,0xbf,0xb2,0x28,0x88,0x84,0x00,0x00,0xe0,0x7c,0xba,0x8c,
-0xbb,0x00,0x0e,0x19,0x31,0xb8,0x30,0xc0,0x05,0xfd,0xac,0xbb,0x8c,0xbc,0x05,0xaf,
-0x00,0x00,0x58,0x34,0x00,0xf5,0x09,0xad,0xdf,0xfd,0xdd,0x10,0x0e,0x00,0x0b,0xcc,
-0xc1,0x00,0x00,0xe0,0x6d,0x65,0x83,0xd7,0x00,0xcc,0x19,0x10,0x58,0x00,0x70,0x9b,
-0x01,0x00,0xfe,0x23,0x00,0xb4,0x00,0xfb,0x35,0x7d,0xbb,0x60,0x00,0xd0,0x07,0x7b,
-0xb7,0x77,0x05,0xdf,0xd0,0xd4,0xb7,0x55,0xd0,0x00,0xd0,0x0c,0x8d,0xa8,0x37,0x00,
-0x0d,0x10,0xc0,0x4a,0x99,0x70,0x05,0xfd,0x2b,0xaa,0xda,0xaa,0x05,0xae,0x03,0xa4,
-0xbb,0x02,0x80,0x00,0xd0,0x48,0x56,0xba,0xd1,0x00,0x0d,0x08,0x7a,0x5a,0xb8,0x30,
-0x00,0xd0,0xd1,0x5a,0x2b,0x1c,0x32,0xda,0x57,0x45,0x4b,0x60,0x12,0x17,0x0d,0x02,
-0x5c,0x43,0xf0,0x37,0xd0,0x4c,0xcc,0xfc,0xcc,0x02,0x5e,0x56,0x88,0x03,0x10,0xe0,
-0x39,0xf9,0x07,0xbb,0x9d,0xb8,0x00,0x0d,0x06,0x97,0xc1,0xb9,0x20,0x00,0xd1,0x37,
-0x97,0x05,0xc0,0x00,0x5f,0xd1,0xab,0xcc,0xcb,0x70,0x5c,0xe0,0xa8,0x00,0x00,0x09,
-0x10,0x0d,0x00,0xac,0xcf,0xcc,0x50,0x00,0xd0,0x04,0x80,0xe0,0x90,0x00,0x0d,0x03,
-0xd2,0x0e,0x07,0x80,0x0c,0xb0,0x52,0x3c,0xa0,0x06,0xf7,0x11,0x01,0x55,0x00,0xfc,
-0x37,0x0c,0x17,0x7c,0xcd,0xe0,0x00,0xd0,0xc8,0x30,0x54,0xa3,0x05,0xdf,0xcb,0x43,
-0xb1,0x9c,0x00,0x00,0xd0,0x67,0x54,0x44,0xa6,0x10,0x0e,0x9c,0xcc,0x84,0x99,0xb2,
-0x4d,0xf8,0xb8,0x40,0x56,0x5a,0x04,0x6d,0x14,0x84,0x0c,0x67,0x20,0x00,0xd4,0xbe,
-0xc9,0xb6,0xca,0x10,0x0d,0x00,0xe6,0x3e,0x65,0x00,0x00,0xd0,0x87,0xbb,0xbc,0x50,
-0x02,0xdb,0x58,0x01,0xa0,0x8c,0xc5,0x1b,0x0c,0x20,0x00,0x59,0x40,0x06,0xfe,0x38,
-0x5c,0xcc,0xfc,0xcc,0x52,0x5d,0x47,0x70,0x80,0x55,0x00,0x6a,0xe9,0x87,0xae,0xbd,
-0xd9,0x00,0x1c,0x07,0x93,0xc3,0x99,0x31,0x01,0xc1,0x8b,0x77,0xe7,0x77,0x31,0x7f,
-0xda,0x5b,0x9e,0x9a,0x90,0x89,0xc0,0xa3,0xd3,0xd3,0x3c,0x00,0x1c,0x0c,0x2e,0x5d,
-0x56,0xc0,0x01,0xc0,0xd0,0xe9,0xe9,0xac,0x00,0x1c,0x69,0x07,0xa0,0x7a,0x20,0x4e,
-0x89,0x2c,0x80,0x00,0x4d,0x20,0x00,0xb1,0x25,0x23,0x0e,0xff,0x30,0x1c,0x07,0x37,
-0x24,0x51,0x5f,0xff,0xff,0xff,0xf9,0x76,0x17,0x00,0x2f,0x17,0x12,0x5c,0xa9,0x51,
-0x21,0x7c,0x2b,0x79,0x06,0x20,0xbf,0xc1,0x6a,0x18,0xb4,0xe9,0x49,0xea,0x63,0x03,
-0xea,0x50,0x00,0x01,0x69,0xd2,0x08,0x16,0x10,0x0e,0x27,0x1d,0x50,0x06,0x00,0xe0,
-0x1f,0x00,0x9b,0x4a,0xf0,0x06,0x04,0xd2,0x22,0x20,0x0d,0x10,0xe0,0x9d,0xcc,0xfd,
-0x20,0xd1,0x0e,0x1e,0x90,0x0e,0x10,0x0d,0x10,0xe8,0xad,0x9b,0x1a,0xe0,0x0e,0x51,
-0x86,0x78,0x00,0x0e,0x13,0xf0,0x01,0xcd,0x10,0x01,0xfe,0xbf,0x80,0x55,0x60,0x17,
-0x10,0xe0,0x04,0xee,0x30,0x42,0x10,0x10,0xe2,0x4b,0x32,0x44,0xe5,0xa1,0x00,0x2b,
-0x64,0x0f,0x20,0x22,0x22,0x4e,0x06,0x51,0x0b,0xcc,0xcd,0x07,0x80,0xd9,0x1e,0xf1,
-0x0d,0xbc,0xbb,0xb5,0x00,0x00,0x1d,0x1f,0x33,0x8a,0x10,0x00,0x02,0xd8,0xf4,0x09,
-0x60,0x0c,0xee,0xec,0xea,0x70,0xc2,0x00,0xc2,0x00,0x05,0x1c,0x1e,0x04,0x2c,0xf0,
-0x0b,0xba,0x80,0x00,0xc2,0x00,0x10,0x05,0xf2,0x00,0x0c,0x47,0xcc,0x00,0xcf,0x70,
-0x00,0xfe,0x93,0x02,0xc9,0x1d,0x70,0x05,0x00,0x02,0xe7,0x3e,0x18,0x08,0xb9,0x43,
-0x21,0x05,0x90,0xe2,0x52,0x10,0x0b,0x3f,0x09,0xf5,0x33,0x08,0xef,0xee,0xe1,0xdc,
+0xbf,0xbb,0xb4,0x00,0x95,0xe7,0x00,0x12,0xce,0x2d,0x05,0x60,0x00,0x00,0x00,0x10,
+0x00,0x00,0xf0,0x36,0x00,0x0c,0x00,0x00,0x00,0x00,0x03,0xaa,0xea,0xa1,0xeb,0xd7,
+0x00,0x0d,0xae,0xac,0xb9,0x03,0xba,0x10,0xc7,0xe7,0xb3,0xbb,0xbc,0x00,0x58,0x8e,
+0x88,0x29,0x67,0x80,0x00,0xa1,0xc1,0x92,0x6e,0xe6,0x20,0x07,0x88,0x87,0xa7,0x35,
+0xab,0x10,0x99,0x99,0xae,0x76,0x53,0x00,0x05,0x99,0x9a,0xe9,0x99,0x80,0x07,0xaa,
+0xaa,0xce,0xaa,0xaa,0xa2,0x00,0x00,0x03,0xb0,0x43,0x00,0x20,0x0b,0xc8,0x06,0x00,
+0x20,0xe0,0x00,0x01,0x00,0xf0,0x1c,0x0e,0x00,0x3e,0xbb,0xd7,0x00,0x01,0xe1,0x03,
+0xa1,0x17,0x70,0x04,0xbf,0xb2,0x28,0x88,0x84,0x00,0x00,0xe0,0x7c,0xba,0x8c,0xbb,
+0x00,0x0e,0x19,0x31,0xb8,0x30,0xc0,0x05,0xfd,0xac,0xbb,0x8c,0xbc,0x05,0xaf,0x00,
+0x00,0x58,0x34,0x00,0xf3,0x0a,0xad,0xdf,0xfd,0xdd,0x10,0x0e,0x00,0x0b,0xcc,0xc1,
+0x00,0x00,0xe0,0x6d,0x65,0x83,0xd7,0x00,0xcc,0x19,0x10,0x58,0x00,0x70,0x00,0x01,
+0x00,0xf8,0x3f,0xd0,0x00,0x07,0x70,0x00,0x00,0x0d,0x00,0x00,0x7d,0xbb,0x60,0x00,
+0xd0,0x07,0x7b,0xb7,0x77,0x05,0xdf,0xd0,0xd4,0xb7,0x55,0xd0,0x00,0xd0,0x0c,0x8d,
+0xa8,0x37,0x00,0x0d,0x10,0xc0,0x4a,0x99,0x70,0x05,0xfd,0x2b,0xaa,0xda,0xaa,0x05,
+0xae,0x03,0xa4,0xbb,0x02,0x80,0x00,0xd0,0x48,0x56,0xba,0xd1,0x00,0x0d,0x08,0x7a,
+0x5a,0xb8,0x30,0x00,0xd0,0xd1,0x5a,0x2b,0x1c,0x32,0xda,0x57,0x45,0x4b,0x60,0x12,
+0x00,0x01,0x00,0x00,0x55,0x00,0x10,0x3a,0x62,0x00,0xf1,0x3a,0x4c,0xcc,0xfc,0xcc,
+0x02,0x5e,0x56,0x88,0x03,0x10,0xe0,0x39,0xf9,0x07,0xbb,0x9d,0xb8,0x00,0x0d,0x06,
+0x97,0xc1,0xb9,0x20,0x00,0xd1,0x37,0x97,0x05,0xc0,0x00,0x5f,0xd1,0xab,0xcc,0xcb,
+0x70,0x5c,0xe0,0xa8,0x00,0x00,0x09,0x10,0x0d,0x00,0xac,0xcf,0xcc,0x50,0x00,0xd0,
+0x04,0x80,0xe0,0x90,0x00,0x0d,0x03,0xd2,0x0e,0x07,0x80,0x0c,0xb0,0x52,0x3c,0xa0,
+0x06,0x00,0x00,0xd0,0xc0,0x55,0x00,0xfa,0x37,0x0c,0x17,0x7c,0xcd,0xe0,0x00,0xd0,
+0xc8,0x30,0x54,0xa3,0x05,0xdf,0xcb,0x43,0xb1,0x9c,0x00,0x00,0xd0,0x67,0x54,0x44,
+0xa6,0x10,0x0e,0x9c,0xcc,0x84,0x99,0xb2,0x4d,0xf8,0xb8,0x40,0x56,0x5a,0x04,0x6d,
+0x14,0x84,0x0c,0x67,0x20,0x00,0xd4,0xbe,0xc9,0xb6,0xca,0x10,0x0d,0x00,0xe6,0x3e,
+0x65,0x00,0x00,0xd0,0x87,0xbb,0xbc,0x50,0x02,0xdb,0x58,0x01,0xa0,0x8c,0xc5,0xaa,
+0x00,0xf5,0x3f,0x1c,0x00,0x00,0x59,0x00,0x00,0x01,0xc0,0x5c,0xcc,0xfc,0xcc,0x52,
+0x5d,0x47,0x70,0x80,0x55,0x00,0x6a,0xe9,0x87,0xae,0xbd,0xd9,0x00,0x1c,0x07,0x93,
+0xc3,0x99,0x31,0x01,0xc1,0x8b,0x77,0xe7,0x77,0x31,0x7f,0xda,0x5b,0x9e,0x9a,0x90,
+0x89,0xc0,0xa3,0xd3,0xd3,0x3c,0x00,0x1c,0x0c,0x2e,0x5d,0x56,0xc0,0x01,0xc0,0xd0,
+0xe9,0xe9,0xac,0x00,0x1c,0x69,0x07,0xa0,0x7a,0x20,0x4e,0x89,0x2c,0x80,0x00,0x4d,
+0x20,0x57,0x00,0x11,0xf0,0x06,0x00,0x10,0x0f,0xb5,0x01,0x53,0xff,0xff,0xff,0xff,
+0xfe,0x0d,0x00,0x03,0x1a,0x00,0xf0,0x09,0x5f,0xff,0xff,0xff,0xf9,0x00,0x00,0x1e,
+0x20,0x00,0x0d,0x30,0x00,0x00,0x5c,0x00,0x0a,0x90,0x00,0x00,0x00,0x7c,0x2b,0x90,
+0x20,0x00,0xf2,0x06,0xbf,0xc1,0x00,0x00,0x02,0x5a,0xe9,0x49,0xea,0x63,0x03,0xea,
+0x50,0x00,0x01,0x69,0xd2,0x00,0x00,0x00,0x01,0xfe,0x01,0xf3,0x3c,0xd3,0x00,0x00,
+0x06,0x00,0xe0,0x1f,0x00,0x00,0x00,0xd1,0x0e,0x04,0xd2,0x22,0x20,0x0d,0x10,0xe0,
+0x9d,0xcc,0xfd,0x20,0xd1,0x0e,0x1e,0x90,0x0e,0x10,0x0d,0x10,0xe8,0xad,0x02,0xc0,
+0x00,0xd1,0x0e,0x51,0x86,0x78,0x00,0x0e,0x13,0xf0,0x01,0xcd,0x10,0x01,0xfe,0xbf,
+0x00,0x0b,0xb0,0x00,0x17,0x10,0xe0,0x04,0xee,0x30,0x00,0x00,0x0e,0x07,0xe2,0x3e,
+0x60,0x00,0x00,0xe5,0xa1,0x00,0x2b,0x10,0xa7,0x00,0xb0,0x22,0x22,0x20,0x2c,0x00,
+0x00,0x0b,0xcc,0xcd,0x07,0x80,0x67,0x00,0xf3,0x30,0xd0,0xbc,0xbb,0xb5,0x00,0x00,
+0x1d,0x1f,0x33,0x8a,0x10,0x00,0x02,0xd8,0xf4,0x09,0x60,0x0c,0xee,0xec,0xea,0x70,
+0xc2,0x00,0xc2,0x00,0x05,0x1c,0x1e,0x00,0x0c,0x20,0x00,0x00,0xba,0x80,0x00,0xc2,
+0x00,0x10,0x05,0xf2,0x00,0x0c,0x47,0xcc,0x00,0xcf,0x70,0x00,0xfe,0x93,0x02,0xc9,
+0x1d,0x70,0x05,0x00,0x02,0xe7,0x00,0x1c,0x70,0xa9,0x00,0x02,0x01,0x00,0x40,0x05,
+0x90,0x00,0x5a,0xc0,0x02,0xf3,0x37,0x00,0x09,0x70,0x00,0x08,0xef,0xee,0xe1,0xdc,
 0xaa,0xa4,0x01,0xd0,0x00,0x2f,0x33,0xb8,0x10,0x1d,0x00,0x09,0xf3,0x0c,0x20,0x01,
 0xfe,0xea,0xea,0x60,0xe0,0x00,0x2c,0x06,0x95,0x3b,0x5b,0x00,0x04,0xa0,0x77,0x00,
 0xdc,0x40,0x00,0x59,0x07,0x70,0x08,0xe0,0x00,0x0a,0x50,0x86,0x02,0xee,0x60,0x03,
-0xe0,0x0a,0x45,0xe4,0x2e,0x70,0x94,0x3d,0xc6,0xc3,0x00,0x2c,0x40,0x24,0x0e,0x20,
-0x09,0x50,0x1a,0x03,0x00,0x7e,0x0b,0xfb,0x32,0x59,0xae,0x99,0x2f,0xbb,0xbb,0x43,
-0x57,0xd5,0x57,0xc3,0x3b,0x81,0x00,0x3b,0x00,0xee,0x00,0xd2,0x00,0x03,0xb0,0x89,
-0xc2,0x0e,0x00,0x0f,0xee,0xfa,0x18,0x76,0xa0,0x00,0xd0,0x05,0x90,0x2d,0xc3,0x00,
-0x0d,0x00,0x59,0x00,0xbc,0x00,0x00,0xe2,0x27,0x90,0x4e,0xe3,0x00,0x0f,0xbb,0xb8,
-0x8e,0x35,0xe5,0x00,0x70,0x00,0xc9,0x10,0x03,0xd3,0x2d,0x0d,0x10,0xd0,0xdb,0x31,
-0xf0,0x18,0x03,0x3a,0x73,0x20,0xe1,0x00,0x00,0xaa,0xaa,0xa8,0x2f,0xbb,0xb5,0x00,
-0xc0,0x49,0x07,0x92,0x6b,0x10,0x68,0x00,0xb5,0xe7,0x07,0x60,0x2d,0x40,0x77,0xac,
-0xd0,0xb3,0x00,0x2a,0x8d,0x11,0x1c,0x3d,0x00,0xf0,0x3e,0xf0,0x0b,0x6e,0x70,0x00,
-0x01,0xed,0x40,0x02,0xf3,0x00,0x01,0xc5,0x3e,0x01,0xda,0xc0,0x01,0xd7,0x00,0x35,
-0xd6,0x08,0xc2,0x03,0x00,0x00,0x92,0x36,0x53,0x20,0x80,0x00,0x69,0x03,0x10,0x3d,
-0xf9,0x47,0xf0,0x25,0x00,0x09,0xca,0xaa,0xa4,0xc2,0x22,0x03,0xe3,0x22,0x20,0x9d,
-0xbc,0xe3,0x4b,0xdc,0xae,0x5f,0x90,0x77,0x00,0x76,0x84,0xa9,0x9d,0x0a,0x30,0x6e,
-0xed,0xdf,0xd2,0xb3,0xe0,0x00,0xa3,0x90,0xc1,0x06,0xd9,0x00,0x0c,0x17,0x5d,0x00,
-0x1f,0x30,0x00,0xdd,0xdd,0xfd,0x19,0xd9,0xb4,0x16,0xa5,0x08,0xb0,0xc7,0x00,0x00,
-0xad,0x66,0xa0,0x01,0xc3,0xe7,0x2b,0x30,0x69,0x00,0xb2,0x38,0x0b,0xf0,0x26,0x79,
-0x0f,0x00,0x00,0x27,0x7c,0xa7,0x82,0xe2,0x22,0x12,0x77,0xca,0x77,0x6e,0xbd,0xe5,
-0x07,0x08,0x66,0x6c,0x90,0x67,0x00,0x69,0x8a,0xb4,0xdd,0x0a,0x40,0x00,0x89,0xd1,
-0x34,0xb3,0xe1,0x00,0x04,0xee,0x80,0x05,0xca,0x00,0x07,0xca,0x69,0x90,0x0f,0x40,
-0x04,0x90,0x86,0x02,0xc8,0x4a,0xc7,0x09,0x60,0x19,0xc1,0xc9,0x00,0x1d,0xe3,0x0b,
-0x91,0x01,0xb3,0x27,0x0e,0x71,0x50,0x00,0x00,0xec,0xcd,0xd0,0x79,0xbd,0x3b,0xf6,
-0x2f,0x0c,0x95,0x55,0x30,0xeb,0xbc,0xd3,0xf7,0x6b,0xb3,0x0e,0x00,0x1d,0xcf,0x20,
-0xa4,0x00,0xeb,0xbc,0xfc,0x76,0x0e,0x10,0x0e,0x00,0x1d,0x02,0xc3,0xc0,0x00,0xe0,
-0x01,0xd0,0x0d,0xc6,0x00,0x0b,0xcc,0xca,0x00,0x7f,0x00,0x00,0x3a,0x0a,0x20,0x1d,
-0xe7,0x00,0x0b,0x50,0x3c,0x3d,0x71,0xe7,0x05,0xa0,0x00,0x4e,0x50,0x02,0xc6,0x57,
-0x03,0x80,0x80,0xc1,0x00,0x00,0x8b,0xfa,0x9b,0x1e,0xe6,0x2c,0xf0,0x22,0x2e,0x35,
-0xea,0xaa,0x43,0x9a,0xeb,0xe8,0xba,0x38,0xa1,0x14,0x49,0xd4,0x7f,0xc0,0x95,0x00,
-0x3c,0xfd,0xcb,0x6e,0x0d,0x20,0x1a,0xc2,0xa6,0x00,0xa6,0xd0,0x01,0x70,0x96,0x02,
-0x05,0xf7,0x00,0x29,0xbe,0xed,0xb0,0x2f,0x30,0x01,0x43,0xa4,0x00,0x0d,0xcb,0x7e,
-0x08,0x83,0x3d,0x80,0xca,0x00,0x0c,0xd2,0x0c,0x60,0xc4,0x27,0x11,0x00,0x30,0x26,
-0xf0,0x1c,0xc1,0x00,0x00,0xbb,0xdd,0xb8,0x3e,0x55,0x53,0x06,0xad,0xca,0x4c,0xb6,
-0xba,0x30,0xa2,0x75,0x6a,0xac,0x2e,0x20,0x06,0xaf,0xea,0x40,0x4e,0x80,0x00,0x2b,
-0xb9,0xb2,0x4b,0xac,0x40,0x0a,0x25,0x30,0x3a,0x20,0x2a,0x50,0x3c,0x96,0x4a,0x11,
-0x80,0x82,0x06,0x00,0x05,0x00,0x30,0x0d,0xcb,0xb8,0x97,0x04,0x10,0xd0,0x63,0x39,
-0x50,0xfd,0xdf,0xdd,0xdd,0xd8,0x5f,0x33,0xfc,0x3b,0x19,0x00,0x00,0x7c,0xbd,0xac,
-0x04,0x90,0x00,0x2b,0xa8,0xc7,0xe5,0x78,0x22,0x11,0xa9,0x6b,0x4d,0x3b,0xcc,0xe6,
-0x04,0x9a,0xd9,0x72,0xf6,0x58,0x00,0xca,0xbd,0xae,0xa9,0x98,0x50,0x0d,0x78,0xc7,
-0xd3,0x0c,0xc2,0x00,0x23,0xc6,0x33,0x00,0xac,0x00,0x0b,0xed,0xbd,0xa0,0x07,0x90,
-0x00,0x2f,0x51,0xc2,0x01,0xdd,0x10,0x00,0x4d,0xfa,0x00,0xb5,0x4c,0x11,0xcc,0x60,
-0x64,0x97,0x00,0x66,0x7a,0x0f,0x12,0x1f,0x62,0x03,0x10,0xa8,0xdd,0x1c,0x00,0x89,
-0x00,0xc0,0xc7,0x02,0x2e,0x42,0x22,0x2c,0x62,0x10,0x00,0x69,0x00,0x03,0x91,0x00,
-0x00,0x89,0x64,0x00,0xc4,0x43,0x11,0x7b,0xd8,0x00,0x11,0xde,0x2e,0x00,0x20,0x7f,
-0xd2,0x33,0x06,0xc0,0xcb,0x16,0xe7,0x00,0x00,0x6d,0xd5,0x00,0x02,0xbf,0xa3,0x09,
-0xf7,0x02,0x51,0x17,0x30,0x00,0x02,0xb0,0x48,0x0f,0xf0,0x09,0xde,0x70,0x49,0x0b,
-0x30,0x00,0xb8,0x0b,0x90,0x98,0xb3,0x02,0xdc,0x32,0x3b,0x20,0x6c,0x30,0x28,0xac,
-0xda,0x25,0x00,0xb3,0xa1,0x0b,0xf5,0x17,0x6c,0x1b,0x30,0x1e,0xee,0xfe,0xc0,0x43,
-0xb3,0x00,0x02,0x67,0x20,0x00,0x2d,0xb5,0x04,0x96,0x78,0x5b,0xeb,0xe6,0x10,0xb4,
-0x67,0x1c,0x20,0x0b,0x30,0x1a,0x06,0x70,0x50,0x00,0xb3,0x00,0x0a,0xe4,0x89,0x0f,
-0x10,0x00,0x85,0x1e,0xe0,0x00,0x29,0xe1,0x03,0xa0,0x0e,0x05,0xde,0x82,0x03,0xef,
-0xdd,0xfc,0xa5,0xfa,0x21,0x10,0x0e,0x13,0x15,0x60,0x3e,0xcc,0xe0,0xa8,0x66,0x63,
-0x0d,0x00,0x80,0x97,0xf7,0x30,0x3e,0xcc,0xe0,0xb2,0x0e,0x1a,0x00,0x70,0x0c,0x10,
-0xe0,0x06,0xdd,0xdd,0xdd,0x85,0x4a,0x20,0xb1,0x82,0x8f,0x0a,0x70,0x89,0x03,0xca,
-0x70,0x0e,0x00,0x1a,0x82,0x08,0x0a,0x24,0x0f,0x00,0xe7,0x0f,0xe0,0x01,0x49,0x90,
-0x0b,0xbd,0xdb,0x89,0xc8,0x50,0x00,0x1a,0x11,0xc0,0x93,0xa5,0x33,0xf0,0x27,0x59,
-0x09,0x30,0x00,0x01,0xce,0xce,0xdc,0x9c,0xbb,0xb5,0x00,0x08,0x60,0x0a,0x52,0xe3,
-0x10,0x22,0x97,0x22,0xa2,0x0d,0x10,0x0a,0xad,0xca,0x8b,0x10,0xd1,0x00,0x38,0x76,
-0x90,0xc0,0x0d,0x10,0x0b,0x47,0x69,0x5d,0x00,0xd1,0x00,0x80,0x76,0x18,0x90,0x0d,
-0x10,0x00,0x6d,0x30,0x82,0x73,0x0d,0xf0,0x2b,0x20,0x02,0x00,0x02,0x20,0xd1,0x92,
-0x65,0x05,0xbc,0x60,0xda,0xb6,0xdb,0x1d,0x10,0x00,0xd4,0x94,0x87,0x2d,0x00,0x00,
-0xd7,0x78,0x86,0x5d,0x77,0x72,0xeb,0xbb,0xcc,0x6d,0x5d,0x52,0xd0,0x80,0x54,0x0d,
-0x0c,0x00,0xd8,0x87,0xca,0x1c,0x0c,0x00,0xd5,0xb2,0x88,0x0c,0x0c,0x00,0xda,0x99,
-0xca,0x6a,0x0c,0x25,0x35,0x11,0x86,0x89,0x07,0x26,0x70,0x0c,0x9e,0x00,0x13,0x1e,
-0x5f,0x14,0x01,0x1b,0x11,0x80,0xde,0xdd,0xdd,0xd1,0x01,0x11,0x98,0x11,0x6d,0x3b,
-0x12,0x0a,0x52,0x26,0x71,0xce,0xdd,0xdd,0xb0,0x00,0x00,0x0f,0x27,0x3a,0x20,0x03,
-0xd0,0xcd,0x1c,0x00,0x2c,0x60,0x10,0x69,0xa5,0x45,0x00,0x73,0x17,0x20,0x3e,0x40,
-0xb0,0x22,0x6d,0x1e,0x40,0x00,0x9e,0xea,0x00,0x74,0x0e,0x12,0x08,0x51,0x07,0x80,
-0xec,0x00,0x04,0xee,0xee,0xd0,0x69,0x97,0xb9,0x07,0x30,0x3e,0x10,0xd4,0xb9,0x07,
-0xf1,0x0b,0x30,0x02,0xe4,0x01,0xfe,0xf7,0x31,0x91,0x02,0x00,0x2c,0x07,0x60,0x07,
-0xd2,0x00,0x03,0xa0,0x85,0x00,0x05,0x10,0x00,0x68,0x09,0x40,0x89,0x51,0x30,0xb3,
-0x0d,0x91,0x29,0x27,0x70,0x10,0x19,0xe4,0x00,0x59,0x3e,0xb0,0xa9,0x3f,0x09,0x01,
-0x00,0x41,0x05,0x70,0x00,0xc4,0xbb,0x00,0xe1,0x2f,0x55,0x55,0x33,0xee,0xfe,0xda,
-0xb8,0x88,0x84,0x00,0xd0,0x04,0xe0,0x16,0x06,0xf0,0x0d,0x1a,0xee,0xee,0xe5,0x00,
-0xee,0xf5,0x01,0x2d,0x1b,0x10,0x0d,0x08,0x53,0x71,0xd0,0x60,0x01,0xc0,0x95,0x59,
-0x1f,0xdd,0x30,0x3a,0x09,0x47,0xa1,0xe3,0x07,0xf6,0x03,0xa3,0xae,0x2d,0x00,0x00,
-0xd2,0x0c,0x3d,0x5d,0xd0,0x00,0x3a,0x4d,0xc7,0x60,0x5d,0xed,0x80,0x1f,0x25,0x50,
-0xcd,0x10,0x00,0x00,0x3c,0x4f,0x35,0x01,0x09,0x00,0x95,0xdc,0xbb,0xbb,0xbc,0xcd,
-0x43,0x33,0x33,0x6c,0x12,0x00,0x01,0x09,0x00,0x50,0xff,0xff,0xff,0xfc,0xd1,0x76,
-0x05,0x30,0xee,0xef,0x03,0x02,0x2b,0xf0,0x09,0xe0,0x3b,0x00,0x0e,0xe0,0x0e,0x03,
-0xd4,0x45,0xee,0xee,0xf0,0x3e,0x88,0x9e,0xe0,0x0e,0x03,0xb0,0x00,0xee,0x00,0xe0,
-0x4b,0x16,0x00,0xa1,0x06,0xfe,0xee,0xee,0xdd,0xd0,0x96,0x00,0x1e,0xc0,0xe3,0x39,
-0x00,0xf3,0x2a,0x10,0x1e,0x62,0x61,0x13,0xde,0xd1,0x00,0xf2,0x05,0xcd,0xcc,0xcc,
-0xcd,0xc0,0x00,0x0c,0x64,0x44,0x44,0x6c,0x00,0x00,0xc6,0x44,0x44,0x46,0xc0,0x00,
-0x0c,0x44,0x37,0x11,0x39,0x69,0x10,0xf3,0x0a,0x0c,0xda,0xaf,0xaa,0xaa,0x30,0x09,
-0xa2,0x22,0xf3,0x22,0x20,0x01,0xc2,0x22,0x2f,0x22,0x21,0x00,0x00,0x69,0x99,0xfa,
-0x99,0x70,0x41,0x07,0x11,0x1d,0x6c,0x35,0x12,0x10,0xa6,0x22,0x30,0xfd,0xf3,0x00,
-0x12,0x1c,0xd0,0xa3,0x1d,0xdf,0xed,0xc0,0xd0,0xa3,0x1c,0x0e,0x00,0xe0,0xe5,0xc3,
-0x06,0x00,0x20,0xe7,0xd3,0x06,0x00,0xf4,0x12,0xd0,0xa6,0xcf,0xbf,0xbb,0xf7,0xd0,
-0xa3,0x22,0x5f,0x92,0x21,0xe1,0xb3,0x00,0x9a,0xe1,0x00,0xfc,0xc2,0x05,0xe1,0x98,
-0x00,0x80,0x00,0x8e,0x30,0x1d,0x70,0x00,0x09,0x91,0x13,0x45,0x00,0xb6,0x13,0x00,
-0x28,0x0f,0x30,0x0d,0xba,0xaa,0x71,0x5c,0x00,0x9c,0x37,0x02,0x96,0x00,0x14,0xcb,
-0xf9,0x1f,0x01,0x95,0x3d,0x31,0xd3,0x00,0x1a,0x02,0x10,0xa0,0x06,0xc0,0x0d,0xdd,
-0xdd,0x50,0x00,0xbe,0x50,0xd1,0xb5,0x07,0x30,0x2e,0x8e,0x10,0x1a,0x02,0x67,0x19,
-0xde,0xee,0xee,0x40,0x10,0x81,0x47,0xe0,0xfd,0xde,0x01,0x1e,0x21,0x10,0xd0,0x0e,
-0x4b,0xbf,0xcb,0xa0,0xd0,0x0e,0x12,0x00,0x80,0xe4,0x4e,0xcd,0xdf,0xdd,0xd6,0xe7,
-0x7e,0x29,0x11,0xf0,0x08,0xd0,0x0e,0x9b,0xbb,0xcf,0xb3,0xd0,0x0e,0x13,0x22,0x4c,
+0xe0,0x0a,0x45,0xe4,0x2e,0x70,0x94,0x3d,0xc6,0xc3,0x00,0x2c,0x40,0x55,0x00,0x41,
+0x3b,0x00,0x09,0x50,0x1a,0x03,0xf9,0x35,0xd2,0x00,0x00,0x59,0xae,0x99,0x2f,0xbb,
+0xbb,0x43,0x57,0xd5,0x57,0xc3,0x3b,0x81,0x00,0x3b,0x00,0xee,0x00,0xd2,0x00,0x03,
+0xb0,0x89,0xc2,0x0e,0x00,0x0f,0xee,0xfa,0x18,0x76,0xa0,0x00,0xd0,0x05,0x90,0x2d,
+0xc3,0x00,0x0d,0x00,0x59,0x00,0xbc,0x00,0x00,0xe2,0x27,0x90,0x4e,0xe3,0x00,0x0f,
+0xbb,0xb8,0x8e,0x35,0xe5,0x00,0x70,0x00,0xc9,0x10,0x03,0xd3,0x09,0x02,0x00,0x0f,
+0x03,0xf0,0x3f,0x0a,0x40,0x00,0x03,0x3a,0x73,0x20,0xe1,0x00,0x00,0xaa,0xaa,0xa8,
+0x2f,0xbb,0xb5,0x00,0xc0,0x49,0x07,0x92,0x6b,0x10,0x68,0x00,0xb5,0xe7,0x07,0x60,
+0x2d,0x40,0x77,0xac,0xd0,0xb3,0x00,0x2a,0x8d,0x11,0x1c,0x3d,0x00,0x00,0x0c,0xb0,
+0x00,0x6e,0x70,0x00,0x01,0xed,0x40,0x02,0xf3,0x00,0x01,0xc5,0x3e,0x01,0xda,0xc0,
+0x01,0xd7,0x00,0x35,0xd6,0x08,0xc2,0x03,0x00,0x00,0x92,0x00,0x06,0x30,0x00,0x80,
+0x00,0x69,0x03,0xf4,0x38,0x3d,0x22,0x22,0x0e,0x00,0x00,0x09,0xca,0xaa,0xa4,0xc2,
+0x22,0x03,0xe3,0x22,0x20,0x9d,0xbc,0xe3,0x4b,0xdc,0xae,0x5f,0x90,0x77,0x00,0x76,
+0x84,0xa9,0x9d,0x0a,0x30,0x6e,0xed,0xdf,0xd2,0xb3,0xe0,0x00,0xa3,0x90,0xc1,0x06,
+0xd9,0x00,0x0c,0x17,0x5d,0x00,0x1f,0x30,0x00,0xdd,0xdd,0xfd,0x19,0xd9,0x00,0x00,
+0x00,0x1d,0x08,0xb0,0xc7,0x00,0x00,0xad,0x66,0xa0,0x01,0xc3,0xa3,0x00,0xf6,0x3e,
+0x08,0x69,0x00,0xb2,0x00,0x00,0x00,0x86,0x79,0x0f,0x00,0x00,0x27,0x7c,0xa7,0x82,
+0xe2,0x22,0x12,0x77,0xca,0x77,0x6e,0xbd,0xe5,0x07,0x08,0x66,0x6c,0x90,0x67,0x00,
+0x69,0x8a,0xb4,0xdd,0x0a,0x40,0x00,0x89,0xd1,0x34,0xb3,0xe1,0x00,0x04,0xee,0x80,
+0x05,0xca,0x00,0x07,0xca,0x69,0x90,0x0f,0x40,0x04,0x90,0x86,0x02,0x08,0xea,0x00,
+0x00,0x09,0x60,0x19,0xc1,0xc9,0x00,0x1d,0xe3,0x0b,0x91,0x01,0xb3,0xfa,0x00,0x80,
+0x01,0x50,0x00,0x00,0xec,0xcd,0xd0,0x79,0x64,0x02,0xf6,0x30,0x1d,0x0c,0x95,0x55,
+0x30,0xeb,0xbc,0xd3,0xf7,0x6b,0xb3,0x0e,0x00,0x1d,0xcf,0x20,0xa4,0x00,0xeb,0xbc,
+0xfc,0x76,0x0e,0x10,0x0e,0x00,0x1d,0x02,0xc3,0xc0,0x00,0xe0,0x01,0xd0,0x0d,0xc6,
+0x00,0x0b,0xcc,0xca,0x00,0x7f,0x00,0x00,0x3a,0x0a,0x20,0x1d,0xe7,0x00,0x0b,0x50,
+0x3c,0x3d,0x71,0xe7,0x05,0xa0,0x00,0x4e,0x50,0x02,0xc6,0x57,0x03,0xf4,0x3c,0x80,
+0xc1,0x00,0x00,0x8b,0xfa,0x9b,0x1e,0x00,0x00,0x01,0x2d,0x2e,0x35,0xea,0xaa,0x43,
+0x9a,0xeb,0xe8,0xba,0x38,0xa1,0x14,0x49,0xd4,0x7f,0xc0,0x95,0x00,0x3c,0xfd,0xcb,
+0x6e,0x0d,0x20,0x1a,0xc2,0xa6,0x00,0xa6,0xd0,0x01,0x70,0x96,0x02,0x05,0xf7,0x00,
+0x29,0xbe,0xed,0xb0,0x2f,0x30,0x01,0x43,0xa4,0x00,0x0d,0xcb,0x00,0x00,0x09,0x40,
+0x3d,0x80,0xca,0x00,0x0c,0xd2,0x0c,0x60,0x00,0xb4,0x55,0x00,0xf1,0x24,0x07,0x50,
+0x00,0xc1,0x00,0x00,0xbb,0xdd,0xb8,0x3e,0x55,0x53,0x06,0xad,0xca,0x4c,0xb6,0xba,
+0x30,0xa2,0x75,0x6a,0xac,0x2e,0x20,0x06,0xaf,0xea,0x40,0x4e,0x80,0x00,0x2b,0xb9,
+0xb2,0x4b,0xac,0x40,0x0a,0x25,0x30,0x3a,0x20,0x2a,0x50,0x3c,0xcc,0xcd,0xdc,0xcc,
+0x80,0xd8,0x01,0x00,0x05,0x00,0x60,0x0d,0xcb,0xb8,0x00,0x00,0x0d,0x0d,0x00,0xfb,
+0x47,0x01,0xdd,0xfd,0xdf,0xdd,0xdd,0xd8,0x00,0x02,0x90,0x00,0x19,0x00,0x00,0x7c,
+0xbd,0xac,0x04,0x90,0x00,0x2b,0xa8,0xc7,0xe5,0x78,0x22,0x11,0xa9,0x6b,0x4d,0x3b,
+0xcc,0xe6,0x04,0x9a,0xd9,0x72,0xf6,0x58,0x00,0xca,0xbd,0xae,0xa9,0x98,0x50,0x0d,
+0x78,0xc7,0xd3,0x0c,0xc2,0x00,0x23,0xc6,0x33,0x00,0xac,0x00,0x0b,0xed,0xbd,0xa0,
+0x07,0x90,0x00,0x2f,0x51,0xc2,0x01,0xdd,0x10,0x00,0x4d,0xfa,0x00,0xb5,0x4c,0x11,
+0xcc,0x60,0x64,0x97,0x00,0x66,0x00,0x01,0x00,0x12,0x1f,0x62,0x03,0x50,0xa8,0x00,
+0x00,0x01,0xcc,0x89,0x00,0xc0,0xc7,0x02,0x2e,0x42,0x22,0x2c,0x62,0x10,0x00,0x69,
+0x00,0x03,0x91,0x00,0x91,0xe3,0x00,0xb6,0x00,0x00,0x00,0x04,0xd1,0x7b,0xd8,0x00,
+0x11,0xde,0x2e,0x00,0x20,0x7f,0xd2,0x33,0x06,0xc0,0xcb,0x16,0xe7,0x00,0x00,0x6d,
+0xd5,0x00,0x02,0xbf,0xa3,0x09,0xf7,0x02,0xf0,0x11,0x17,0x30,0x00,0x02,0xb0,0x00,
+0x00,0xb3,0x00,0x00,0xde,0x70,0x49,0x0b,0x30,0x00,0xb8,0x0b,0x90,0x98,0xb3,0x02,
+0xdc,0x32,0x3b,0x20,0x6c,0x30,0x28,0xac,0xda,0x25,0x1a,0x00,0xf3,0x1d,0x67,0x00,
+0x6c,0x1b,0x30,0x1e,0xee,0xfe,0xc0,0x43,0xb3,0x00,0x02,0x67,0x20,0x00,0x2d,0xb5,
+0x04,0x96,0x78,0x5b,0xeb,0xe6,0x10,0xb4,0x67,0x1c,0x20,0x0b,0x30,0x1a,0x06,0x70,
+0x50,0x00,0xb3,0x00,0x0a,0xe4,0x00,0x00,0x0b,0x30,0xa1,0x00,0xf0,0x11,0x3a,0x00,
+0xe0,0x00,0x29,0xe1,0x03,0xa0,0x0e,0x05,0xde,0x82,0x03,0xef,0xdd,0xfc,0xa5,0x00,
+0x00,0x03,0xa0,0x0e,0x0a,0x30,0x00,0x00,0x3e,0xcc,0xe0,0xa8,0x66,0x63,0x0d,0x00,
+0x80,0x97,0xf7,0x30,0x3e,0xcc,0xe0,0xb2,0x0e,0x1a,0x00,0xfb,0x0e,0x0c,0x10,0xe0,
+0x06,0xdd,0xdd,0xdd,0xe0,0x0e,0x00,0x00,0xb1,0x82,0x2c,0x00,0xe0,0x00,0x89,0x03,
+0xca,0x70,0x0e,0x00,0x1a,0x00,0x02,0xc0,0x00,0xe0,0xfd,0x00,0xf1,0x7e,0xc3,0x00,
+0x01,0x49,0x90,0x0b,0xbd,0xdb,0x89,0xc8,0x50,0x00,0x1a,0x11,0xc0,0x93,0x00,0x00,
+0x00,0xc1,0x59,0x09,0x30,0x00,0x01,0xce,0xce,0xdc,0x9c,0xbb,0xb5,0x00,0x08,0x60,
+0x0a,0x52,0xe3,0x10,0x22,0x97,0x22,0xa2,0x0d,0x10,0x0a,0xad,0xca,0x8b,0x10,0xd1,
+0x00,0x38,0x76,0x90,0xc0,0x0d,0x10,0x0b,0x47,0x69,0x5d,0x00,0xd1,0x00,0x80,0x76,
+0x18,0x90,0x0d,0x10,0x00,0x6d,0x30,0x82,0x00,0xd1,0x00,0x00,0x20,0x02,0x00,0x02,
+0x20,0xd1,0x92,0x65,0x05,0xbc,0x60,0xda,0xb6,0xdb,0x1d,0x10,0x00,0xd4,0x94,0x87,
+0x2d,0x00,0x00,0xd7,0x78,0x86,0x5d,0x77,0x72,0xeb,0xbb,0xcc,0x6d,0x5d,0x52,0xd0,
+0x80,0x54,0x0d,0x0c,0x00,0xd8,0x87,0xca,0x1c,0x0c,0x00,0xd5,0xb2,0x88,0x0c,0x0c,
+0x00,0xda,0x99,0xca,0x6a,0x0c,0x00,0xfc,0xcc,0xcc,0x86,0x89,0x07,0x26,0x70,0x0c,
+0x9e,0x00,0x12,0x1e,0x07,0x00,0xf1,0x05,0xa6,0x00,0x00,0x00,0xdd,0xdd,0xde,0xdd,
+0xdd,0xd1,0x01,0x11,0x98,0x11,0x11,0x11,0x00,0x00,0x0a,0x60,0x19,0x00,0xb0,0xce,
+0xdd,0xdd,0xb0,0x00,0x00,0x0f,0x21,0x11,0x4b,0x00,0xac,0x01,0xfa,0x0c,0x04,0xa0,
+0x00,0x00,0xa7,0x00,0x00,0x69,0x00,0x00,0x3e,0x10,0x00,0x08,0x60,0x00,0x3e,0x40,
+0x00,0x00,0xd3,0x00,0x1e,0x40,0x00,0x9e,0xea,0xf7,0x00,0x00,0x4e,0x07,0x12,0x08,
+0x51,0x07,0x80,0xec,0x00,0x04,0xee,0xee,0xd0,0x69,0x97,0xb9,0x07,0x30,0x3e,0x10,
+0xd4,0xb9,0x07,0xf1,0x09,0x30,0x02,0xe4,0x01,0xfe,0xf7,0x31,0x91,0x02,0x00,0x2c,
+0x07,0x60,0x07,0xd2,0x00,0x03,0xa0,0x85,0x00,0x05,0x10,0x00,0x68,0xe4,0x01,0xfa,
+0x04,0x0a,0x50,0xb3,0x0d,0x91,0x00,0x01,0xe1,0x0d,0x10,0x19,0xe4,0x00,0x59,0x3e,
+0xb0,0x00,0x04,0x90,0x5b,0x00,0x41,0x05,0x70,0x00,0xc4,0xbb,0x00,0xe1,0x2f,0x55,
+0x55,0x33,0xee,0xfe,0xda,0xb8,0x88,0x84,0x00,0xd0,0x04,0xe0,0x16,0x06,0xf0,0x0d,
+0x1a,0xee,0xee,0xe5,0x00,0xee,0xf5,0x01,0x2d,0x1b,0x10,0x0d,0x08,0x53,0x71,0xd0,
+0x60,0x01,0xc0,0x95,0x59,0x1f,0xdd,0x30,0x3a,0x09,0x47,0xa1,0xe3,0x07,0xf2,0x03,
+0xa3,0xae,0x2d,0x00,0x00,0xd2,0x0c,0x3d,0x5d,0xd0,0x00,0x3a,0x4d,0xc7,0x60,0x5d,
+0xed,0x80,0x54,0x00,0xd1,0xdf,0xff,0xff,0xff,0xcd,0x10,0x00,0x00,0x3c,0xd1,0x00,
+0x00,0x03,0x09,0x00,0x95,0xdc,0xbb,0xbb,0xbc,0xcd,0x43,0x33,0x33,0x6c,0x12,0x00,
+0x01,0x09,0x00,0x50,0xff,0xff,0xff,0xfc,0xd1,0x76,0x05,0xf0,0x10,0xee,0xef,0x03,
+0xfe,0xee,0xee,0x00,0xe0,0x3b,0x00,0x0e,0xe0,0x0e,0x03,0xd4,0x45,0xee,0xee,0xf0,
+0x3e,0x88,0x9e,0xe0,0x0e,0x03,0xb0,0x00,0xee,0x00,0xe0,0x4b,0x16,0x00,0xc0,0x06,
+0xfe,0xee,0xee,0xdd,0xd0,0x96,0x00,0x1e,0xc0,0x00,0x1e,0xfe,0x00,0x93,0x0b,0x80,
+0x00,0x1e,0x00,0x07,0xa0,0x00,0xde,0xd1,0x00,0xf0,0x0d,0xcd,0xcc,0xcc,0xcd,0xc0,
+0x00,0x0c,0x64,0x44,0x44,0x6c,0x00,0x00,0xc6,0x44,0x44,0x46,0xc0,0x00,0x0c,0xcb,
+0xbb,0xbb,0xcc,0x00,0x00,0x39,0x00,0x3e,0x07,0xf3,0x0a,0x0c,0xda,0xaf,0xaa,0xaa,
+0x30,0x09,0xa2,0x22,0xf3,0x22,0x20,0x01,0xc2,0x22,0x2f,0x22,0x21,0x00,0x00,0x69,
+0x99,0xfa,0x99,0x70,0x41,0x07,0x71,0x1d,0xdd,0xdd,0xfd,0xdd,0xdd,0x10,0xf9,0x00,
+0x30,0x00,0xfd,0xf3,0x06,0x00,0xe0,0xd0,0xa3,0x1d,0xdf,0xed,0xc0,0xd0,0xa3,0x1c,
+0x0e,0x00,0xe0,0xe5,0xc3,0x06,0x00,0x20,0xe7,0xd3,0x06,0x00,0xf3,0x15,0xd0,0xa6,
+0xcf,0xbf,0xbb,0xf7,0xd0,0xa3,0x22,0x5f,0x92,0x21,0xe1,0xb3,0x00,0x9a,0xe1,0x00,
+0xfc,0xc2,0x05,0xe1,0x98,0x00,0x80,0x00,0x8e,0x30,0x1d,0x70,0x00,0x09,0x91,0x00,
+0x00,0x96,0x5f,0x01,0x00,0xf9,0x00,0x80,0xc0,0x00,0x0d,0xba,0xaa,0xaa,0xbc,0x00,
+0x73,0x02,0x12,0x02,0x96,0x00,0x13,0xcb,0x1f,0x00,0x90,0x02,0xdd,0xdd,0xdf,0xed,
+0xdd,0xd3,0x00,0x1a,0x1c,0x00,0xb0,0x00,0x06,0xc0,0x0d,0xdd,0xdd,0x50,0x00,0xbe,
+0x50,0xd1,0xb5,0x07,0x30,0x2e,0x8e,0x10,0x1a,0x02,0x65,0x19,0xde,0xee,0xee,0x40,
+0x10,0xff,0x08,0xf0,0x01,0x10,0x00,0xfd,0xde,0x01,0x1e,0x21,0x10,0xd0,0x0e,0x4b,
+0xbf,0xcb,0xa0,0xd0,0x0e,0x12,0x00,0xf0,0x14,0xe4,0x4e,0xcd,0xdf,0xdd,0xd6,0xe7,
+0x7e,0x00,0x00,0x2c,0x00,0xd0,0x0e,0x9b,0xbb,0xcf,0xb3,0xd0,0x0e,0x13,0x22,0x4c,
 0x20,0xe3,0x3e,0x0d,0x30,0x2c,0x00,0xea,0xa9,0x03,0xd0,0x2c,0x33,0x06,0x21,0x50,
-0x2c,0x42,0x00,0x10,0xd8,0x9b,0x1e,0x00,0x51,0x2c,0xf0,0x02,0x01,0x4c,0x11,0x18,
-0x91,0x10,0x04,0xbb,0xbf,0xbd,0xdb,0xc9,0x00,0x07,0x70,0xd0,0x76,0xb1,0x07,0xb1,
-0x0d,0x07,0x68,0x30,0x01,0xcc,0xcd,0xdc,0xdd,0xcc,0xc6,0x69,0x57,0x41,0x10,0x00,
-0x04,0xda,0xbd,0x00,0x82,0x4a,0x11,0x11,0x14,0xc0,0x00,0x04,0xea,0x0d,0x00,0x01,
-0x4f,0x56,0x20,0x04,0xec,0xb1,0x56,0xc4,0x00,0xcb,0xaa,0xaa,0xab,0xb0,0x00,0x0c,
-0x87,0x77,0x77,0x8b,0x0d,0x00,0x80,0x22,0x22,0x4c,0x22,0x22,0x20,0x29,0x99,0x01,
-0x00,0x61,0x10,0x05,0xbb,0xbb,0xbb,0xb5,0xda,0x12,0x21,0x07,0x80,0x47,0x57,0x10,
-0xd8,0xfe,0x59,0xf1,0x01,0xf0,0x53,0x00,0x00,0x4c,0x90,0x0f,0x03,0xac,0x30,0x19,
-0x20,0x6c,0xc0,0x00,0x39,0xdb,0x0e,0xf0,0x20,0x14,0x79,0x00,0xaa,0xdb,0xa7,0x8c,
-0x86,0x20,0x0a,0x8c,0x9a,0x58,0x60,0x00,0x00,0xb8,0xca,0xb6,0x9d,0xcf,0xc4,0x09,
-0x8c,0xa9,0x5a,0x30,0xc0,0x02,0xaa,0xdb,0xa7,0xe0,0x0c,0x00,0x00,0x07,0x30,0x36,
-0x00,0x90,0x00,0x05,0xcc,0xcc,0xcc,0xca,0xa7,0x0d,0x00,0x6f,0x20,0x55,0x06,0xdb,
-0xbb,0xbb,0xbd,0x0d,0x00,0x10,0xeb,0xec,0x2b,0x01,0xbd,0x40,0x11,0x00,0x3f,0x11,
-0xf0,0x02,0x11,0x1e,0x21,0xd2,0x11,0x0e,0xed,0xfe,0xdf,0xed,0xeb,0xe0,0x0d,0x10,
-0xd1,0x03,0xbe,0x16,0x00,0xc7,0x3b,0xec,0xcf,0xcc,0xfc,0xcd,0xbe,0x22,0xe3,0x2e,
-0x32,0x5b,0x16,0x00,0x61,0xef,0xef,0xfe,0xff,0xef,0xbe,0x11,0x08,0x05,0x11,0x02,
-0x01,0x9a,0x52,0x50,0xec,0xcc,0xfd,0xcc,0xe4,0x39,0x20,0x00,0x6f,0x4e,0x36,0xec,
-0xcc,0xfc,0x0d,0x00,0x91,0xbd,0xcd,0xfc,0xcc,0xc3,0x00,0x03,0xc0,0x5b,0xaa,0x03,
-0x20,0xce,0x30,0x6b,0x05,0xc4,0x9e,0xdb,0x73,0x10,0x00,0x1e,0xc6,0x00,0x27,0xbd,
-0xef,0x40,0x16,0x1a,0x01,0x2b,0x56,0x60,0x9c,0xfc,0xa2,0xcd,0xec,0x90,0xb5,0x01,
-0xf3,0x1b,0x4a,0x00,0x02,0xcc,0xfc,0xc6,0xcd,0xec,0xc2,0x00,0x7e,0x90,0x01,0xda,
-0x70,0x00,0x7c,0x06,0x95,0xc3,0x0a,0x91,0x18,0x6a,0xab,0xcb,0xaa,0x65,0x10,0x08,
-0x72,0x22,0x22,0x78,0x00,0x00,0x8c,0x99,0x99,0x9c,0x80,0x00,0x0d,0x00,0x72,0x87,
-0x11,0x11,0x17,0x80,0x00,0x08,0x40,0x01,0xf0,0x37,0xeb,0xaa,0xaa,0xad,0x80,0x00,
-0x0e,0xaa,0xaa,0xaa,0xc8,0x00,0x00,0xe5,0x44,0x44,0x49,0x80,0x00,0x05,0x55,0x55,
-0x55,0x53,0x00,0x6d,0xdc,0xde,0xcc,0xcc,0xcc,0x10,0x4b,0x44,0xd3,0x55,0x55,0x30,
-0x04,0xc6,0x7d,0x4e,0x76,0xc6,0x00,0x4e,0xbb,0xd0,0x78,0x3d,0x00,0x04,0x90,0x2e,
-0x20,0xcd,0x30,0x05,0xdf,0xdc,0xf5,0x7d,0xcb,0x30,0x11,0x00,0x0d,0x87,0x00,0x4c,
-0x82,0x35,0x06,0xde,0x5b,0x00,0x6f,0x13,0x06,0x59,0x2e,0x20,0x1e,0xed,0xc4,0x57,
-0x20,0x1c,0xe4,0xed,0x01,0x91,0x2e,0x6a,0xed,0xdd,0xde,0xa0,0x01,0x50,0xa5,0xfa,
-0x01,0xb1,0x0a,0x62,0x22,0x26,0xa0,0x00,0x00,0xab,0xaa,0xaa,0xba,0xa3,0x6b,0x20,
-0x04,0xa0,0x0f,0x1d,0x50,0x4e,0xe6,0x00,0x02,0xb0,0x92,0x26,0x00,0xa6,0x2a,0x90,
-0x6f,0xee,0xf0,0x3e,0xfd,0xdf,0xc6,0x70,0x0d,0x0d,0x00,0x90,0x68,0x11,0xe0,0x02,
-0xfc,0xcf,0x06,0xdb,0xbf,0x0d,0x00,0x90,0x77,0x00,0xd0,0x02,0xfc,0xcf,0x07,0x82,
-0x2e,0x0d,0x00,0xf0,0x05,0x8c,0xaa,0xf0,0x5d,0xdd,0xdd,0xca,0x30,0x0d,0x00,0x0a,
-0x16,0x30,0xd1,0x00,0xd0,0x07,0xa0,0x2d,0x3c,0xf1,0x48,0x5e,0x00,0x47,0x60,0x7e,
-0xc0,0xa4,0x30,0x03,0xd2,0x5a,0x19,0xf4,0xf3,0x0a,0x11,0x01,0x16,0x4c,0xc1,0xc2,
-0x02,0x22,0x3e,0xfe,0x32,0x22,0x00,0x00,0x0b,0x8f,0x7b,0xa0,0x5c,0xf0,0x03,0xf0,
-0x9a,0x00,0x00,0x2c,0x90,0x0f,0x00,0xac,0x20,0x3e,0x50,0x00,0xf0,0x00,0x7f,0x30,
-0x10,0x34,0x00,0x1e,0x10,0x26,0x5b,0x00,0x92,0x4c,0x11,0xff,0x53,0x35,0x30,0x87,
-0xf8,0x70,0x83,0x1f,0x30,0x0f,0x0d,0x10,0x8d,0x6a,0x20,0xf0,0x6a,0x91,0x03,0xc0,
-0x0f,0x00,0xd6,0x00,0x06,0xe4,0x22,0xf2,0x24,0xe6,0x03,0xd2,0x97,0x25,0x1a,0xd3,
-0x41,0x00,0xf0,0x01,0x67,0x00,0x00,0x01,0x66,0x00,0x06,0x70,0x4b,0xde,0xc9,0x40,
-0x15,0x9a,0x57,0x91,0x26,0x2f,0x21,0xc9,0x78,0x8f,0x04,0xf5,0x22,0x07,0xff,0xee,
-0xea,0x00,0x1f,0xd8,0x87,0xd0,0x07,0x60,0x07,0xa8,0x99,0x59,0x60,0xd2,0x00,0xc6,
-0x70,0xa4,0x3d,0x4b,0x00,0x66,0x67,0x0c,0x20,0xbe,0x20,0x00,0x06,0x71,0xe0,0x0b,
-0xf2,0x00,0x00,0x67,0x79,0x3c,0x84,0xe5,0x00,0x06,0x7b,0x2c,0x50,0x03,0x8c,0x09,
-0x40,0xed,0xdd,0xfd,0xdd,0x15,0x59,0x10,0x0f,0x64,0x00,0x45,0xed,0xcc,0xfc,0xcc,
-0x0d,0x00,0x53,0xcd,0xdd,0xfd,0xdd,0xd0,0x7c,0x00,0x02,0xe9,0x32,0x60,0x20,0x00,
-0x08,0xbf,0xa9,0x00,0xeb,0x00,0xb0,0xf0,0x7c,0x30,0x02,0xbd,0x50,0x0f,0x00,0x4c,
-0xc2,0x05,0xa3,0x00,0x11,0x04,0x9d,0x00,0x01,0xb9,0x1e,0x00,0x6f,0x28,0x30,0x06,
-0xab,0x50,0xb3,0x1e,0xf0,0x1b,0x4a,0xa4,0x5b,0xbe,0xcb,0xb0,0x00,0xce,0x07,0x72,
-0xb5,0x2e,0x00,0x1f,0xb9,0x76,0x0c,0x50,0xe0,0x07,0xb7,0xa8,0x61,0xdc,0x0e,0x00,
-0xd7,0x70,0x76,0x86,0x67,0xe0,0x38,0x67,0x07,0xac,0x00,0xbe,0x00,0x06,0x70,0x76,
-0x63,0x05,0x20,0x67,0x07,0x9d,0x0f,0x00,0x0d,0x00,0x29,0x5e,0xb0,0x3a,0x45,0x03,
-0x83,0x00,0x40,0x2d,0xdd,0xdf,0xff,0x9f,0x3a,0xf0,0x0f,0x2c,0x5e,0x5b,0x20,0x00,
-0x01,0x8d,0x30,0xe0,0x3d,0x82,0x03,0xd7,0x76,0x69,0x66,0x66,0xc2,0x00,0x1e,0x33,
-0x33,0x3e,0x10,0x00,0x01,0xfa,0xaa,0xaa,0xf1,0x98,0x1c,0x00,0x44,0x03,0x45,0x01,
-0xea,0xaa,0xaa,0xe8,0x19,0x12,0xdd,0x34,0x41,0x05,0x5c,0x1f,0x12,0x4a,0x4d,0x01,
-0x10,0xc2,0x0d,0x00,0xf1,0x1e,0xae,0xee,0xee,0xe4,0x1e,0xff,0xd0,0x35,0x04,0x40,
-0x00,0x0c,0x90,0x0b,0x50,0x2d,0x30,0x01,0xff,0x29,0xb0,0x01,0x6d,0x10,0x6c,0x9c,
-0x66,0x80,0x89,0x40,0x0c,0x77,0x40,0x0d,0x2e,0x20,0x05,0x96,0x70,0x00,0x5e,0x90,
-0x00,0x21,0x67,0x7b,0x58,0xdb,0x06,0x70,0x1a,0xb1,0x8d,0x50,0x00,0x67,0x0c,0x60,
-0x00,0x3b,0x30,0xb7,0x1f,0x21,0x02,0xb0,0x5b,0x00,0xf0,0x1f,0x9c,0x88,0x83,0x00,
-0x28,0x92,0x2f,0x77,0x7f,0x30,0x2b,0xed,0xbd,0xb9,0x09,0xa0,0x00,0x0c,0xd1,0x40,
-0xab,0xb0,0x00,0x02,0xfb,0xb0,0x6c,0xbb,0x40,0x00,0x8a,0x79,0xea,0x20,0x17,0xc2,
-0x1c,0x67,0x15,0xdd,0xdd,0xd3,0x05,0x56,0x70,0x49,0xce,0x08,0x30,0x67,0x04,0x90,
-0x82,0x55,0x40,0x70,0x4e,0xcc,0xcf,0x0d,0x00,0x25,0x91,0x11,0xa1,0x01,0x04,0x59,
-0x01,0x10,0xce,0x80,0x5c,0x30,0x67,0x0c,0x10,0x04,0x5f,0xf1,0x1a,0xfd,0xc6,0xdd,
-0xed,0xd0,0x00,0xbb,0x0c,0x10,0x3a,0x00,0x00,0x1f,0xbb,0xc2,0xac,0xea,0x70,0x07,
-0xa7,0x5c,0x22,0x5b,0x21,0x01,0xb6,0x70,0xc1,0x03,0xa0,0x00,0x54,0x67,0x0c,0x7d,
-0xdf,0xdd,0x10,0x06,0x70,0xc1,0x41,0x00,0xb2,0x0c,0xbb,0xbb,0xbb,0x50,0x06,0x70,
-0x12,0x22,0x22,0x21,0x6c,0x5c,0x20,0x00,0xdc,0x8c,0x2a,0xe0,0xe0,0x0e,0x00,0x0b,
-0x10,0x00,0x0e,0x01,0xcc,0xcd,0xfc,0xcc,0xcc,0xc2,0x94,0x59,0xf0,0x12,0xc3,0x00,
-0x00,0x02,0x9b,0xc9,0xf7,0x00,0x00,0x07,0x8a,0xcb,0x76,0xad,0xa4,0x00,0x53,0x10,
-0x0f,0x00,0x03,0x20,0x3c,0xcc,0xdf,0xff,0xdc,0xcc,0x40,0x00,0x2b,0x8f,0x7b,0x54,
-0x4d,0xb5,0x30,0xf0,0x3c,0xa5,0x03,0xa4,0x00,0x0f,0x00,0x03,0xa4,0xb8,0x12,0xe0,
-0x6d,0xbb,0xbb,0xe0,0x00,0x68,0x06,0xa4,0x44,0x4e,0x04,0xef,0xfe,0x7b,0x85,0x11,
-0xf0,0x00,0xb8,0x06,0xb7,0x77,0x7e,0x00,0x0f,0xe1,0x13,0x33,0x33,0x30,0x06,0xca,
-0xba,0x3e,0x56,0x20,0xc6,0x85,0x8a,0x04,0xd0,0x57,0x68,0x2b,0xbb,0xfc,0xbb,0x60,
-0x06,0x80,0x22,0x2e,0x32,0x21,0x41,0x00,0x10,0xd1,0x41,0x00,0x04,0x2d,0x42,0x01,
-0xab,0x32,0x30,0x00,0x06,0x40,0x95,0x44,0xf3,0x34,0x02,0xfa,0x9a,0x20,0x00,0xd3,
-0xd2,0xda,0x25,0xd0,0x00,0x4f,0x0d,0x64,0xb6,0xd3,0x00,0x0e,0xf0,0xd0,0x06,0xfb,
-0x00,0x06,0x9e,0x0d,0x6c,0x95,0x7d,0xa1,0x00,0xe0,0xd3,0x10,0xe0,0x03,0x00,0x0e,
-0x0d,0x7d,0xdf,0xdd,0xc0,0x00,0xe0,0xd0,0x40,0xe1,0x40,0x00,0x0e,0x0c,0x4c,0x0e,
-0x0b,0x40,0x00,0xe0,0x1d,0x20,0xe0,0x1c,0x00,0x0e,0x00,0x11,0xea,0x37,0x0b,0x00,
-0x69,0x22,0xf0,0x2b,0xdd,0xdd,0xef,0x50,0x26,0xe6,0x00,0x01,0x89,0x20,0x01,0x4f,
-0x45,0x97,0x86,0xbb,0x90,0x03,0xf5,0x93,0xa8,0x51,0x1b,0x00,0x7f,0xba,0x0a,0x85,
-0xc6,0x70,0x0b,0xd4,0xa0,0xa8,0x43,0xf2,0x03,0x9d,0x09,0xbb,0x84,0x4e,0x50,0x63,
-0xd0,0x60,0x38,0x7c,0x1c,0x00,0x0d,0x00,0x0b,0xc3,0x10,0x10,0x00,0xd2,0x5e,0x1d,
-0x37,0x30,0x0d,0x02,0x5f,0x45,0xf0,0x29,0x08,0x20,0x0d,0x00,0x0a,0x00,0x00,0xb2,
-0x3c,0xeb,0x36,0x52,0x00,0x86,0xb5,0xa0,0x96,0xc2,0xc1,0x08,0xb8,0x2e,0xbd,0x9b,
-0xe5,0x00,0x0b,0x65,0xa0,0x94,0x3a,0x60,0x0a,0xbc,0x8d,0x8c,0x6d,0x8d,0x20,0x42,
-0x15,0x4a,0x43,0x74,0x53,0x1c,0xcc,0xcc,0xfd,0xcc,0xcc,0x60,0x00,0x05,0xcf,0xc7,
-0xdd,0x00,0xd0,0xb1,0xe0,0x7c,0x40,0x00,0xae,0x70,0x0e,0x00,0x3b,0xd5,0x05,0x00,
-0x8c,0x2c,0x15,0x20,0xe2,0x01,0xf0,0x39,0xcc,0xfc,0xfd,0xc4,0x00,0x67,0x04,0x6e,
-0x6d,0x76,0x03,0xef,0xfd,0x95,0xc3,0xc3,0xe0,0x00,0xb7,0x09,0x3b,0x0b,0x0d,0x00,
-0x0f,0xd0,0x6b,0xbb,0xbb,0xb0,0x05,0xdb,0x92,0x99,0x99,0x96,0x00,0xc7,0x76,0x01,
-0x11,0x11,0x10,0x49,0x67,0x0c,0xcc,0xfc,0xcc,0x41,0x16,0x70,0x1a,0x0d,0x19,0x20,
-0x00,0x67,0x2c,0x40,0xd1,0x3d,0x10,0x06,0x71,0x32,0xcd,0x00,0x41,0x00,0x76,0x00,
-0x98,0x5a,0xf1,0x06,0x07,0x60,0xdd,0xfd,0xdf,0xd8,0x08,0xcb,0x60,0x0c,0x01,0xc0,
-0x00,0x8c,0xb6,0x5b,0xbb,0xbb,0xc0,0x00,0xcb,0x9f,0x33,0xf0,0x06,0x1f,0xe5,0x7d,
-0xaa,0xaa,0xf0,0x06,0xe7,0xb7,0xb7,0x77,0x7f,0x00,0xc8,0x60,0x13,0x3d,0x53,0x30,
-0x29,0x76,0x4d,0x13,0xf0,0x58,0x80,0x07,0x60,0x00,0xa9,0xc3,0x00,0x00,0x76,0x02,
-0xac,0x02,0xe6,0x00,0x07,0x66,0xc6,0x00,0x01,0x9a,0x00,0x66,0x00,0x92,0x01,0xb0,
-0x00,0x06,0x60,0x59,0xc7,0xab,0x71,0x01,0x77,0x13,0x44,0xe5,0x44,0x03,0xce,0xeb,
-0x3b,0xbf,0xbb,0x80,0x00,0xc7,0x01,0x11,0xd2,0x11,0x00,0x1f,0xd2,0xaa,0xed,0xaa,
-0xa3,0x06,0xda,0xa0,0x04,0x9b,0x30,0x00,0xc8,0x65,0x19,0x9e,0x21,0x80,0x59,0x66,
-0x2b,0xb6,0xda,0xc4,0x01,0x16,0x60,0x0b,0x2d,0x98,0x00,0x00,0x66,0x1a,0x70,0xd1,
-0xaa,0x20,0x06,0x64,0x41,0xcd,0x00,0x52,0x00,0xc0,0x04,0x28,0x30,0x72,0x20,0xf6,
-0x36,0xa0,0x84,0x65,0x10,0x02,0xd2,0x46,0x88,0x6c,0x68,0x03,0xcf,0xbb,0xc7,0x78,
-0x9d,0x00,0x03,0xf0,0x09,0x76,0x77,0x59,0x00,0x7f,0x79,0xcb,0x9a,0xda,0xb0,0x0a,
-0xca,0x1a,0x03,0xb2,0xb1,0x02,0x9c,0x09,0xfc,0xcf,0xcc,0xc0,0x73,0xc0,0x0f,0x50,
-0xa3,0xb3,0x00,0x0c,0x04,0x9b,0x65,0xe6,0x00,0x00,0xc0,0xc2,0x04,0xbe,0x36,0x50,
-0x0c,0x74,0x04,0xa2,0x2c,0xd1,0x27,0x1b,0x10,0x3a,0x9e,0x1a,0x70,0x62,0xbc,0xeb,
-0xcf,0xb6,0x00,0x87,0x0d,0x00,0x90,0x04,0xce,0xec,0x02,0xbb,0xb9,0x00,0x00,0xd6,
-0x71,0x32,0xf5,0x1e,0x60,0x1f,0xb1,0x22,0x2b,0x52,0x22,0x06,0xdd,0xaa,0xca,0xeb,
-0xaf,0x00,0xc8,0x67,0xa9,0x6d,0x86,0xe0,0x58,0x76,0x09,0x73,0xc5,0x3e,0x00,0x17,
-0x60,0x8b,0xbc,0xbb,0xc0,0x00,0x76,0x02,0xb9,0x01,0xd6,0x00,0x07,0x67,0xc5,0x00,
-0x01,0xe8,0x14,0xf0,0x2e,0x58,0x03,0x60,0xd0,0x64,0x00,0x05,0x80,0x0d,0x0d,0x0d,
-0x10,0x01,0x69,0x1c,0xdc,0xfc,0xdc,0x31,0xef,0xfc,0xd0,0x00,0x00,0xa3,0x00,0x98,
-0x04,0xdb,0xbb,0xe6,0x10,0x0e,0xe0,0x0d,0x22,0x2c,0x20,0x03,0xdb,0x90,0x68,0x88,
-0x81,0x00,0xa7,0x85,0x8c,0xbc,0xbc,0xb0,0x2b,0x58,0x0a,0x20,0xd0,0x0e,0x00,0x25,
-0x80,0xac,0x9b,0x13,0x90,0x58,0x0a,0x30,0xd0,0x1e,0x00,0x05,0x80,0xac,0x1b,0x03,
-0x0a,0xe9,0x41,0x11,0x30,0x9e,0x38,0xf1,0x04,0x83,0x00,0x5c,0xb9,0x00,0x00,0x6b,
-0x82,0x7c,0x00,0x7d,0x60,0x08,0xda,0x99,0xac,0xcc,0x2a,0x30,0xd8,0x48,0x00,0x2f,
-0x8e,0xf4,0x1c,0xac,0x6c,0xc8,0x00,0x8c,0x86,0xa0,0xc6,0x53,0x80,0x0c,0x84,0x0d,
-0xba,0x6c,0xb7,0x02,0x78,0x30,0x28,0x00,0x74,0x00,0x00,0x83,0x09,0xb0,0x0e,0x60,
-0x00,0x08,0x35,0xa4,0xa9,0x8b,0x90,0x00,0x85,0xb0,0x03,0xa0,0x08,0x10,0x5b,0x54,
-0x02,0x06,0x00,0x60,0xca,0xab,0x8b,0xae,0x01,0xd1,0x06,0x00,0xf6,0x27,0x2e,0xfc,
-0xc0,0x0b,0x81,0x0d,0x01,0xe0,0xca,0xa9,0x8a,0xae,0x05,0xf7,0xc4,0x9a,0xc9,0x4c,
-0x09,0xd7,0xc0,0x8a,0xb8,0x0c,0x0a,0xc0,0xc1,0x97,0x8a,0x0c,0x66,0xc0,0xc1,0xcb,
-0xcc,0x0c,0x20,0xc0,0xc0,0x2c,0xc2,0x0c,0x00,0xc0,0xc4,0x83,0x68,0x0c,0x00,0xc0,
-0xc0,0x01,0x20,0xaa,0xa5,0x00,0x00,0x4c,0x2f,0xf5,0x31,0xdc,0x1d,0x00,0x00,0xd3,
-0xa9,0xa0,0x5f,0xdd,0xe2,0xd4,0x50,0xc0,0xb4,0x00,0xe0,0xd4,0x84,0xd2,0xe0,0xa3,
-0xa0,0xd1,0x55,0x51,0x42,0xc0,0x10,0xd7,0xa5,0xa7,0x03,0xf0,0x00,0xd7,0x87,0x2a,
-0x05,0xf5,0x00,0xd8,0xa7,0x5a,0x0a,0x9a,0x00,0xd4,0x62,0x64,0x1d,0x0d,0x30,0xeb,
-0xbb,0xbb,0xc5,0x03,0xd2,0x11,0x11,0x13,0x60,0x00,0x42,0xae,0x4f,0x01,0x77,0x70,
-0x11,0x21,0x0d,0x00,0x41,0x0a,0x40,0x09,0x60,0x30,0x73,0x30,0x9d,0xbb,0xb8,0x0d,
-0x00,0x5a,0x83,0x33,0x20,0x00,0xa4,0x1a,0x00,0x06,0x0d,0x00,0x81,0x6c,0xfd,0xcc,
-0xee,0xcc,0xcc,0x11,0x11,0x63,0x43,0x11,0x08,0x3e,0x35,0x04,0x4e,0x00,0x02,0x5b,
-0x00,0x21,0x04,0x80,0x0d,0x00,0xb0,0x59,0x00,0x9d,0xbb,0xb4,0x00,0x05,0x90,0x09,
-0x83,0x33,0x92,0x5c,0x11,0x96,0xb8,0x11,0x03,0x1a,0x00,0x10,0x96,0xe9,0x38,0x31,
-0xeb,0xbe,0xdb,0x7e,0x2c,0x11,0x33,0x7e,0x2c,0x31,0xe1,0x01,0xe0,0xc4,0x61,0x10,
-0x1e,0x71,0x69,0x01,0x0d,0x00,0xc0,0x1c,0x0e,0x10,0x1e,0x04,0xd1,0x01,0xc0,0xef,
-0xe1,0xf9,0xe4,0x0d,0x00,0x55,0x1f,0x80,0x00,0x01,0xc0,0x1a,0x00,0x13,0x00,0x0d,
-0x00,0x11,0x10,0x0d,0x00,0xe6,0x2c,0x01,0xd4,0xeb,0xd0,0xf0,0x05,0xa1,0xef,0xc9,
-0x63,0x0b,0xfe,0xe4,0x35,0x54,0x11,0xd2,0x76,0x30,0x30,0x0d,0xbb,0xba,0xe0,0x11,
-0x30,0xd5,0x33,0x30,0x81,0x20,0x00,0xc2,0x69,0x30,0xff,0xee,0xfe,0x97,0x43,0x40,
-0x22,0x0e,0x00,0x02,0x52,0x23,0xe1,0xe0,0x05,0xd0,0x00,0x1c,0x80,0x0e,0x02,0xe2,
-0x00,0x08,0x80,0x00,0xe5,0x8c,0x25,0x60,0x4c,0xd2,0x00,0x00,0x02,0x58,0x6f,0x43,
-0x21,0x01,0xda,0x5d,0x25,0xb1,0x3e,0xef,0xfe,0xef,0xfe,0xee,0x30,0x00,0xe2,0x00,
-0x77,0xf0,0x2f,0xf1,0x0b,0x07,0x70,0x01,0x00,0x0c,0xee,0xea,0x77,0x0a,0xa0,0x07,
-0x90,0x08,0x77,0xac,0x90,0x03,0xd6,0x30,0xe2,0x7e,0x40,0x00,0x02,0x3e,0x7c,0x43,
-0x36,0x31,0x4f,0x30,0x77,0x23,0x3a,0xf6,0x02,0x07,0x70,0x06,0x40,0x1a,0xb0,0x00,
-0x68,0x00,0x95,0x2e,0x70,0x00,0x03,0xee,0xed,0x10,0x55,0x05,0x90,0x2b,0x00,0x00,
-0x1d,0xfe,0xdc,0x49,0x2b,0x00,0xc3,0x02,0xf0,0x17,0x9b,0x8d,0x77,0x20,0x00,0xed,
-0xd7,0xd3,0x5c,0x22,0x00,0x03,0x90,0x8e,0x70,0x2b,0x00,0x00,0x0a,0x30,0xb4,0x21,
-0x4b,0x11,0x10,0x2c,0x93,0xd6,0xcc,0xff,0xdc,0x90,0x13,0x3d,0xa0,0x04,0xee,0xa0,
-0x85,0x01,0xf0,0x03,0x2d,0x4b,0x95,0x00,0x00,0x4b,0x05,0xd3,0x2b,0x0d,0x50,0x04,
-0xd1,0x2c,0x20,0x2b,0x01,0x90,0xa7,0x52,0x11,0x2b,0x11,0x30,0x01,0xaf,0x2d,0x40,
-0xc9,0x40,0xed,0xde,0x9e,0x0b,0x00,0x52,0x2a,0x50,0x3f,0xdd,0x71,0xd0,0x0e,0xd6,
-0x12,0x71,0xa8,0x00,0xdc,0x80,0x3b,0x00,0x18,0xcc,0x02,0xf0,0x08,0xd7,0xad,0xdd,
-0xd9,0x00,0x3b,0x00,0x02,0xb0,0x0a,0x50,0x03,0xc5,0x77,0x0a,0x63,0xd0,0x03,0xee,
-0x96,0x30,0x1d,0xe3,0x27,0x00,0xa9,0x08,0xed,0xa1,0x00,0x3b,0x00,0x6e,0x91,0x07,
-0xe6,0x01,0x3d,0x11,0x1e,0x6e,0x1a,0x06,0x06,0x00,0x20,0x01,0x50,0x06,0x00,0x70,
-0x1d,0xb0,0x1f,0xff,0xf1,0xe6,0xe8,0x12,0x00,0x2d,0xec,0x30,0x24,0x00,0xf6,0x04,
-0x00,0x93,0x1e,0x00,0x30,0xe1,0x00,0xb3,0x2f,0x8e,0xd1,0xe2,0x00,0xd1,0x6e,0x82,
-0x00,0x8f,0xee,0x7b,0x0e,0x0b,0x84,0x09,0xc0,0x61,0x00,0xcc,0xcc,0x2f,0x30,0x5d,
-0x10,0x02,0x23,0xf0,0xfb,0xeb,0x14,0x40,0x4c,0x0f,0xad,0x20,0x36,0x0f,0x20,0xf1,
-0xd1,0xf2,0x3a,0xf0,0x06,0x0f,0x05,0xc0,0x00,0x00,0xd5,0x00,0xf0,0x0a,0xc1,0x01,
-0xc9,0x00,0x0f,0x00,0x0a,0xe4,0x17,0x00,0x00,0xf0,0xe3,0x0e,0x29,0x0b,0xfb,0x42,
-0x51,0x00,0x9a,0x08,0x31,0x2b,0xc0,0x60,0xb9,0x32,0x40,0x0d,0x10,0xe0,0x15,0xff,
-0x0b,0xf0,0x05,0x0f,0xae,0xd0,0x3c,0x40,0x0d,0x8e,0xf5,0x1d,0x00,0x3c,0x5b,0xf8,
-0x2e,0x01,0xd0,0x00,0x01,0x4e,0x10,0x30,0x1d,0x30,0x70,0xd1,0x0e,0xf0,0x3f,0x51,
-0x0d,0x10,0xe6,0xc4,0x00,0x14,0x2f,0xd4,0x74,0x08,0xa0,0x0d,0x20,0x00,0x0a,0x40,
-0xa1,0x00,0x7e,0xee,0xee,0x7c,0x0a,0x21,0x79,0x10,0x90,0x47,0x51,0x7d,0x00,0xfe,
-0xee,0xe8,0xa6,0x65,0x30,0x07,0x80,0x03,0xbd,0x65,0xd0,0x86,0x02,0xcb,0x15,0xc0,
-0x04,0x6e,0x30,0x00,0x72,0x82,0x00,0x58,0x37,0x14,0xf0,0x01,0xdd,0xdd,0xde,0x60,
-0x00,0x0a,0x02,0xc0,0x01,0xd1,0x00,0x08,0x80,0x06,0x91,0xc6,0xbb,0x5f,0xf3,0x03,
-0x0b,0xf8,0x00,0x00,0xa7,0x01,0x5b,0xc8,0xe8,0x30,0x08,0x00,0xc9,0x40,0x01,0x7c,
-0x30,0x01,0x1c,0x2b,0x40,0x50,0x1f,0xee,0xf1,0x17,0x6b,0x31,0xd0,0x0d,0x10,0xad,
-0x67,0xc2,0xd2,0x00,0x2d,0x60,0x5e,0x30,0x07,0xee,0x30,0x1b,0x58,0x30,0x1f,0x27,
-0x90,0xee,0xee,0xf3,0x00,0x00,0x70,0x97,0x00,0x4c,0x8f,0x21,0x80,0xd3,0x2d,0x30,
-0x00,0x0d,0x30,0x02,0xee,0x50,0x70,0xb4,0x04,0xbc,0xcb,0x40,0x00,0xa2,0x2e,0xb5,
-0x00,0x5c,0xe2,0x42,0x28,0x11,0x91,0x4e,0x01,0x21,0x09,0xe3,0x4e,0x01,0x22,0x04,
-0x10,0x5b,0x01,0xf0,0x00,0xfe,0xef,0xee,0xf0,0x0b,0x81,0x0e,0x00,0xf0,0x0e,0x00,
-0x06,0x60,0xe0,0x0f,0x1a,0x01,0xd1,0x0f,0xbb,0xfb,0xbf,0x00,0x00,0x60,0xe3,0x3f,
-0x33,0xe0,0x00,0x4c,0x1a,0x00,0x20,0x0d,0x30,0x1a,0x00,0x80,0x07,0xa0,0x0f,0xee,
-0xfe,0xef,0x00,0x32,0x24,0x00,0x13,0xd0,0xa3,0x00,0xa1,0x5d,0x40,0x1f,0xee,0xeb,
-0x00,0x00,0x19,0x02,0xd0,0x2b,0x18,0xf0,0x05,0x6a,0x00,0x3b,0x00,0x2c,0x60,0x1d,
-0x30,0x02,0xd4,0x20,0x09,0x3c,0x50,0x00,0x05,0x73,0x00,0x00,0x0b,0x71,0x40,0x81,
-0x00,0xd0,0xd2,0x11,0x17,0x90,0x00,0x88,0x74,0x60,0x11,0x3e,0x81,0x60,0x80,0x0d,
-0x50,0x0d,0xed,0xdd,0xe9,0x00,0x50,0x0d,0x00,0x31,0x80,0x06,0x81,0x1c,0x0c,0x41,
-0x07,0xd0,0x00,0x4a,0xf2,0x07,0x50,0xde,0xfd,0xd7,0x00,0x20,0x3d,0x03,0x31,0x00,
-0x3e,0x80,0x1a,0x00,0x50,0x1b,0x31,0x22,0x6b,0x22,0x65,0x55,0x81,0xbf,0xdb,0xbb,
-0x00,0x00,0x70,0x02,0xe1,0x6f,0x68,0xf3,0x06,0xa7,0x09,0x20,0x00,0x0c,0x40,0x3d,
-0x00,0x3c,0x00,0x07,0xb0,0x1d,0xa9,0xac,0xf7,0x00,0xb2,0x01,0xa7,0x52,0xbe,0x60,
-0x01,0x38,0x56,0x00,0xab,0x00,0x22,0x08,0xd1,0x54,0x34,0x60,0x2f,0xee,0xfe,0xef,
-0x70,0x10,0xce,0x2f,0xf0,0x31,0xd1,0x0c,0xa1,0x2c,0x00,0xe0,0x17,0x00,0x06,0x33,
-0xfd,0xef,0xde,0x70,0x00,0x00,0x4a,0xa3,0x00,0xb4,0x00,0x01,0x95,0x83,0xc0,0x3d,
-0x00,0x00,0x78,0x76,0x09,0x9d,0x30,0x00,0x1e,0x1b,0x30,0x2f,0xc0,0x00,0x08,0x92,
-0xd1,0x7e,0x69,0xd5,0x00,0x71,0x65,0xa9,0x10,0x04,0xb6,0x02,0x20,0x00,0x07,0x20,
-0x00,0x00,0x4d,0x90,0x00,0x6b,0x45,0x02,0xd1,0x22,0x23,0xc3,0x22,0x00,0x00,0x07,
-0xbb,0xce,0xbb,0xb1,0x2c,0x60,0x28,0x19,0x22,0x18,0x30,0x70,0x4d,0xd2,0x1c,0xcd,
-0xfc,0xc8,0x00,0x00,0xc0,0x11,0x5c,0x11,0x10,0x00,0x5a,0xfc,0x63,0x01,0x1a,0x00,
-0x21,0x06,0xb0,0x0d,0x00,0x5a,0xd2,0x0e,0xee,0xff,0xee,0x35,0x03,0x41,0x00,0x3a,
-0x10,0x1e,0x49,0x67,0xf0,0x19,0x47,0xfd,0xdd,0xd9,0x00,0x00,0x14,0xf7,0x00,0x0c,
-0x40,0x02,0x00,0xc4,0xb5,0x0a,0x90,0x00,0xcb,0x20,0x00,0xcd,0x90,0x00,0x00,0x66,
-0x01,0x8e,0x9d,0x72,0x00,0x00,0x0a,0xe8,0x00,0x18,0xd9,0x00,0x09,0x5d,0x69,0x35,
-0x21,0x03,0xd0,0xcb,0x27,0x20,0xc5,0x0d,0xb2,0x04,0x10,0x7b,0x3d,0x35,0x20,0xb0,
-0x03,0x48,0x2a,0x14,0x4b,0x96,0x56,0x71,0x91,0x0d,0x10,0xe0,0x2c,0x00,0x63,0x06,
-0x00,0x10,0x00,0x06,0x00,0xf0,0x09,0x59,0x10,0x8d,0x70,0xf9,0x2c,0x07,0xc3,0x9d,
-0x95,0xe9,0x6c,0x00,0x09,0x4e,0x3a,0xe2,0xdc,0x00,0x36,0x0e,0x03,0xe0,0x5c,0x9c,
-0x27,0xf0,0x01,0xe0,0x2c,0x06,0x90,0x68,0x00,0xe0,0x2c,0x0d,0x20,0xc2,0x00,0xe0,
-0x2c,0x3b,0x05,0x47,0x56,0x06,0xa5,0x64,0xe4,0x15,0x94,0x00,0x4d,0xa2,0xad,0xee,
-0x95,0x10,0x00,0x04,0x02,0x02,0xb0,0x94,0x04,0x30,0x3d,0x50,0xde,0xda,0x34,0x22,
-0x2b,0x30,0x54,0x04,0x01,0x23,0x14,0x90,0x01,0xa0,0xfe,0xee,0xef,0x70,0x00,0x97,
-0x0d,0xc6,0x0f,0x11,0x3d,0xdf,0x19,0xf1,0x00,0x0d,0x40,0x0f,0xaa,0xaa,0xd7,0x00,
-0x50,0x00,0xe3,0x33,0x38,0x70,0x04,0x10,0x71,0x67,0x21,0x6d,0x30,0x7f,0x0a,0xf5,
-0x31,0x37,0xcd,0xef,0xdd,0xdd,0x20,0x00,0x00,0x1c,0x30,0x75,0x00,0x3d,0x60,0x3c,
-0xa6,0x78,0xf5,0x00,0x08,0x26,0x86,0x54,0x33,0xb0,0x00,0x00,0x0c,0x08,0x43,0x90,
-0x00,0x01,0xb0,0xe0,0x94,0x4a,0x00,0x00,0x88,0x0e,0x09,0x44,0xa0,0x00,0x2e,0x14,
-0xc0,0x94,0x4a,0x22,0x0b,0x71,0xd6,0x09,0x44,0xa4,0x60,0xb0,0x5b,0x00,0x10,0x2d,
-0xd2,0x94,0x15,0xf1,0x00,0x14,0x01,0xd0,0x05,0x10,0x2c,0x91,0xe1,0x1d,0x03,0xe0,
-0x00,0x04,0x08,0x81,0xc5,0x3f,0xd2,0x12,0x1d,0x04,0x00,0x2d,0x50,0x0f,0xee,0xee,
-0xed,0x00,0x1b,0x20,0x73,0x5d,0x10,0x0f,0x3f,0x37,0x12,0x01,0xd4,0x42,0x11,0x96,
-0x0d,0x00,0x11,0x1e,0x8d,0x5d,0x30,0x0a,0x70,0x0e,0xf9,0x32,0x63,0x90,0x00,0xe0,
-0x00,0xdd,0x80,0xc0,0x31,0xf1,0x0d,0x3d,0x83,0xfc,0xcc,0xcd,0x90,0x00,0x07,0x4c,
-0x11,0x11,0x59,0x00,0x00,0x02,0xea,0xaa,0xab,0x90,0x0b,0x40,0x2c,0x22,0x22,0x69,
-0x00,0x2c,0x61,0x54,0x2d,0xf4,0x17,0x00,0x1a,0x00,0x29,0x01,0x00,0x00,0xa3,0xfa,
-0xa3,0xc7,0xc2,0x00,0x3c,0x1d,0x22,0x3f,0x70,0x00,0x0b,0x41,0xd0,0x02,0xb0,0x14,
-0x05,0xc0,0x1d,0x38,0x4c,0x03,0xa0,0x93,0x06,0xfb,0x71,0xdd,0xe5,0xdf,0x16,0x02,
-0xdd,0x0f,0x80,0x2a,0xc8,0xee,0xff,0xee,0xe2,0x00,0x01,0x30,0x24,0xf0,0x2a,0x00,
-0x30,0x1b,0xbc,0xfb,0xbb,0xb6,0x1c,0xb1,0x24,0xe4,0x2c,0x72,0x10,0x06,0x00,0xa7,
-0x10,0x1d,0x20,0x00,0x01,0xb9,0x0d,0x00,0x3d,0x60,0x07,0x56,0x61,0xd2,0x39,0x42,
-0x00,0xd2,0x0d,0x0d,0x2b,0x2c,0x00,0x3c,0x0a,0x60,0xd0,0xc0,0xa5,0x0a,0x60,0x40,
-0x0d,0x03,0x02,0x20,0x51,0x00,0x4d,0xc0,0xc4,0x0a,0x01,0x45,0x15,0xf0,0x10,0x5e,
-0x4b,0xbb,0xec,0xbb,0x70,0x00,0x20,0x34,0x4d,0x74,0x41,0x01,0x00,0x04,0x55,0xd7,
-0x55,0x10,0x5d,0x46,0xbb,0xbe,0xcb,0xbb,0x00,0x27,0x02,0x44,0x44,0x44,0x4a,0x41,
-0xd0,0x66,0x66,0xf0,0x00,0x09,0x48,0xdb,0xbb,0xbf,0x00,0x00,0xe0,0x86,0x0f,0x03,
-0x20,0x79,0x08,0x0d,0x00,0x30,0x0e,0x20,0x85,0xd1,0x56,0x44,0x80,0x08,0x50,0x06,
-0x1d,0x1f,0x00,0x80,0x4c,0xa1,0x01,0xb9,0x50,0x00,0xa9,0x00,0x00,0x0c,0x0b,0x10,
-0xbc,0x3b,0xf3,0x2d,0xd3,0x01,0x00,0xd0,0x00,0x0c,0x00,0x03,0xe8,0x0d,0x6c,0xc8,
-0xc0,0x90,0x01,0x90,0xd0,0x00,0x0c,0x2b,0x00,0x00,0x0d,0x6d,0xca,0xa9,0x60,0x00,
-0x94,0xb6,0x40,0xa8,0xe0,0x00,0x1e,0x3a,0x6b,0xaa,0x89,0x01,0x07,0x86,0x76,0x61,
-0x4e,0xb2,0x80,0xe2,0xc2,0x11,0x4d,0x2d,0x76,0x17,0x1a,0x00,0x0a,0x20,0x5e,0x10,
-0x6c,0x05,0x10,0x30,0xce,0x03,0xf0,0x0d,0x04,0xe5,0xed,0xdd,0x14,0x0d,0x00,0x23,
-0xd0,0x0d,0x2a,0x0d,0x00,0x00,0xe9,0x9d,0x2a,0x0d,0x3d,0x50,0xd2,0x2d,0x2a,0x0d,
-0x02,0xa0,0xd3,0x3d,0x12,0x00,0x61,0xe8,0x8d,0x2a,0x0d,0x00,0x41,0x1e,0x00,0x80,
-0xd1,0xdd,0xdd,0x2a,0x0d,0x04,0xb0,0x73,0xb5,0x91,0xb3,0x43,0xd0,0x0d,0x30,0x0e,
-0x09,0x0c,0x20,0x02,0x2a,0xea,0xd1,0x03,0x02,0x07,0x00,0x30,0x8d,0x4c,0xee,0xde,
-0x3d,0x21,0x22,0xc2,0x39,0x09,0xf0,0x00,0x0c,0x2d,0xcd,0xbb,0xb0,0x5d,0x40,0xd2,
-0xd0,0x00,0x1c,0x00,0x29,0x0e,0x0f,0x2c,0x0b,0x20,0x00,0xe0,0x0d,0x00,0xf0,0x15,
-0x06,0x1e,0x0b,0xbf,0xbb,0x90,0x00,0xe4,0xc0,0x60,0xe0,0x52,0x00,0x79,0x77,0x5c,
-0x0e,0x04,0xa0,0x1e,0x2d,0x3e,0x30,0xe0,0x0a,0x12,0x72,0x80,0x01,0xdc,0x00,0x00,
-0x01,0xa3,0x06,0x72,0x87,0x4d,0xf0,0x1a,0xb2,0xf9,0x8f,0x87,0x50,0x07,0x21,0xdc,
-0x44,0xe4,0x43,0x00,0x5c,0x7a,0xea,0xaf,0xaa,0x30,0x00,0x04,0x3c,0x33,0xe3,0x31,
-0x00,0x06,0xb3,0xd5,0x5f,0x55,0x20,0x06,0xc0,0x3e,0xbb,0xfb,0xba,0x00,0x51,0x03,
-0xa6,0xac,0x24,0x56,0x33,0x33,0xe3,0x33,0x33,0xd6,0x3e,0x15,0xe0,0x64,0x37,0x03,
-0x33,0x2a,0xb0,0x7e,0x44,0xeb,0xcb,0xce,0x00,0x00,0x23,0x49,0x0a,0x10,0xd5,0x4f,
-0xe5,0x94,0xb9,0x0e,0x00,0x5d,0x50,0x49,0x70,0x35,0xe0,0x00,0x18,0x03,0xcb,0xcd,
-0x13,0xf0,0x07,0x00,0x04,0x2c,0xde,0xde,0xde,0x50,0x00,0xc3,0xc1,0x92,0x92,0x85,
-0x00,0x4c,0x0c,0x19,0x29,0x28,0x50,0x0c,0x50,0x0d,0x00,0x7a,0x02,0xc0,0xcf,0xef,
-0xef,0xef,0xe3,0xef,0x3d,0xc0,0x3d,0x70,0xad,0xcc,0xce,0x00,0x00,0x06,0x0a,0xba,
-0x90,0xe0,0x04,0x08,0xd2,0x0c,0x0e,0x00,0x0d,0x60,0xed,0xcc,0xdc,0xdd,0x40,0x1b,
-0x4e,0x00,0xbf,0x46,0xf0,0x00,0xcc,0xcc,0xf2,0x10,0x00,0x60,0xb7,0x66,0x6f,0x00,
-0x00,0x5a,0x0b,0x64,0x44,0x66,0x3a,0x70,0xbc,0xbb,0xbf,0x00,0x06,0xa0,0x0b,0xce,
-0x23,0x56,0x52,0x00,0xb2,0x03,0xcc,0x76,0x68,0xf0,0x14,0x0c,0x57,0x66,0xc0,0x00,
-0x4e,0x40,0xc5,0x77,0x6c,0x00,0x00,0x37,0xcf,0xde,0xee,0xfc,0x40,0x00,0x04,0xa5,
-0x98,0x6c,0x14,0x3d,0x41,0xb1,0x27,0x72,0x69,0x20,0x18,0x0c,0xcc,0xcc,0xb0,0x1d,
-0xf0,0x0f,0xd0,0x06,0x70,0x0b,0x10,0x0b,0x25,0xcc,0xee,0xcc,0x70,0x01,0xd0,0x2b,
-0x06,0x70,0x94,0x00,0x88,0x02,0xb0,0x67,0x09,0x40,0x0e,0x20,0x2b,0x06,0x79,0xd2,
-0xfd,0x5d,0x11,0x67,0x1f,0x04,0x10,0x0b,0x56,0x10,0xa1,0xac,0xcc,0xed,0xcc,0xc3,
-0x00,0x02,0x04,0x50,0x07,0xe3,0x4b,0x60,0x00,0x5c,0x20,0x3d,0x57,0xdd,0xbf,0x14,
-0x31,0x29,0x03,0x80,0x89,0x1e,0x10,0x3e,0x9a,0x01,0xf0,0x1e,0x07,0x30,0x1b,0x6c,
-0x02,0x80,0x00,0xd2,0x8e,0x30,0x6a,0xc2,0x00,0x69,0x86,0xd0,0x00,0xc7,0x00,0x0d,
-0x20,0x0e,0x8a,0x60,0xab,0x20,0x40,0x00,0x95,0x10,0x00,0x30,0x07,0x60,0x02,0xc0,
-0x06,0x80,0x00,0x1a,0x9d,0xef,0xdd,0xee,0xd8,0x04,0x15,0x10,0x06,0x8f,0x03,0x61,
-0x2f,0xdd,0xe8,0x00,0x2d,0x80,0x82,0x2c,0x31,0x08,0x0b,0xdd,0x67,0x34,0xf0,0x23,
-0xc3,0x34,0x96,0x0a,0x30,0x02,0x7c,0x1a,0x49,0x65,0xa3,0x00,0xa4,0xc4,0xe7,0x9a,
-0xaa,0x30,0x2d,0x0c,0xa4,0xcc,0x78,0xc3,0x0b,0x50,0xc2,0x05,0x90,0x0a,0x30,0x70,
-0x0c,0x00,0x48,0x0a,0xd1,0x08,0x30,0x0a,0x20,0x00,0x38,0x20,0x2c,0x7c,0xec,0xc4,
-0xd9,0x40,0xb4,0x6a,0x10,0x49,0x6c,0x05,0xf4,0x28,0xeb,0x84,0x90,0x00,0x3c,0x24,
-0x58,0x0a,0x4e,0xbb,0x50,0x37,0x4c,0xda,0xc4,0x92,0xb0,0x00,0x04,0x58,0x0a,0x58,
-0x1b,0x00,0x06,0x5b,0xdb,0xa6,0x71,0xb0,0x00,0xc0,0x0a,0x20,0x75,0x1b,0x00,0x58,
-0x8c,0xed,0xcc,0x21,0xb0,0x0c,0x10,0x0a,0x21,0xd0,0x1b,0x00,0x60,0x00,0xa2,0x25,
-0x01,0xd8,0x10,0xf5,0x3f,0xa1,0x00,0xe1,0x01,0xb0,0x00,0x03,0xd5,0xbf,0xb6,0x49,
-0x00,0x00,0x01,0x56,0x04,0x87,0xb7,0x73,0x00,0x05,0xda,0xc8,0xb9,0x8e,0x33,0xc2,
-0x56,0x04,0xaf,0x42,0xa0,0x03,0x74,0xbd,0xbc,0xc7,0x48,0x00,0x00,0x46,0xe5,0x51,
-0xb8,0x50,0x00,0x66,0xc8,0x66,0x0c,0xc0,0x00,0x1c,0x0b,0xdc,0x50,0x7b,0x00,0x08,
-0x60,0xd0,0x66,0x0b,0xe1,0x00,0xd1,0x59,0x08,0x56,0x95,0xa0,0x28,0x2d,0x1b,0xd5,
-0xb0,0x09,0x50,0x55,0x1a,0x00,0xf6,0x18,0xf4,0x38,0x4d,0x70,0x00,0xab,0xaa,0x50,
-0x00,0x01,0xab,0xbe,0xcb,0xbc,0x30,0x10,0x0c,0x34,0xc8,0x83,0xc0,0x3e,0x70,0xc4,
-0x5b,0x74,0x55,0x00,0x19,0x0c,0x10,0x27,0x77,0x10,0x00,0x00,0xd2,0xd8,0xe9,0xb6,
-0x00,0x05,0x1d,0x1d,0x7d,0x8a,0x60,0x00,0xd1,0xd1,0xd9,0xe9,0xb6,0x00,0x4b,0x3a,
-0x11,0x4c,0x33,0x20,0x0b,0x48,0x6a,0x4c,0x03,0x7c,0x00,0xc0,0xc2,0xa0,0xbb,0xb7,
-0x43,0xe8,0x01,0xf0,0x2d,0x00,0x50,0x05,0x00,0x50,0x01,0xaa,0x55,0x46,0xd6,0x65,
-0x40,0x00,0x27,0xb3,0x8b,0x97,0xc3,0x00,0x00,0x7a,0xb5,0x86,0x8b,0xb0,0x4d,0x35,
-0x35,0x68,0x65,0x35,0x00,0x36,0x98,0x8a,0x1a,0x98,0x80,0x00,0x05,0x41,0x57,0x65,
-0x52,0x00,0x05,0x19,0x99,0x99,0x9e,0x10,0x02,0xc0,0x99,0x88,0x88,0xb1,0x00,0x96,
-0x1f,0xe2,0x04,0x01,0xce,0x14,0x10,0x86,0xc8,0x40,0x3c,0x3b,0xbc,0x00,0x64,0x13,
-0x01,0xc0,0x13,0x90,0x24,0x01,0xe0,0x00,0x23,0x00,0x09,0x70,0x2d,0x05,0x3d,0xf0,
-0x02,0xe2,0x04,0xc0,0x01,0xe1,0x00,0x8a,0x00,0x7f,0x00,0x97,0x00,0x04,0x10,0x0b,
-0xe5,0x04,0x13,0x06,0x11,0xe3,0x8d,0x07,0x30,0xc7,0x09,0x90,0x84,0x6e,0xc4,0x00,
-0x0c,0xb1,0x00,0x06,0xe9,0x00,0x00,0x09,0xe9,0x10,0x82,0x22,0x41,0x03,0x24,0x12,
-0x30,0xbb,0xbb,0x80,0xf9,0x74,0x24,0x33,0x32,0x5b,0x00,0x00,0xb5,0x33,0x0c,0xb4,
-0x51,0x02,0x43,0x0c,0x11,0x10,0x10,0x28,0xf4,0x04,0x2d,0x06,0x70,0xa4,0x0d,0x30,
-0x0c,0x50,0x5a,0x04,0xb0,0x3d,0x03,0x80,0x02,0x70,0x08,0x00,0x71,0xa1,0x00,0x31,
-0xa4,0x00,0xb4,0xa9,0x14,0x10,0x2e,0x43,0x09,0x40,0xde,0xde,0xfd,0xd3,0x0e,0x00,
-0x10,0xe1,0x43,0x09,0x21,0x01,0xe8,0x70,0x00,0x10,0xae,0x05,0x66,0x30,0x00,0x8d,
-0x10,0x12,0x44,0xfc,0x10,0xcf,0xed,0xdd,0xdd,0xee,0x22,0xea,0x20,0x01,0x04,0x10,
-0xd1,0x03,0x86,0x75,0x66,0x39,0x0e,0x00,0x1d,0x05,0x71,0xb0,0x43,0xc0,0x06,0x40,
-0x13,0x00,0x3d,0xd5,0x54,0x1b,0x11,0x69,0x77,0x5f,0x32,0xce,0xdc,0xcc,0x23,0x53,
-0x00,0xea,0x33,0x01,0x0a,0x00,0x10,0x0d,0xd8,0x3a,0xf5,0x1f,0x00,0x00,0xd6,0x55,
-0x55,0x55,0x55,0x00,0x0d,0x65,0x55,0x55,0x55,0x50,0x00,0xdc,0xcc,0xcc,0xcc,0xc6,
-0x00,0x23,0x11,0x22,0x34,0x08,0x70,0x08,0x66,0x64,0x91,0xc0,0x96,0x01,0xd1,0x48,
-0x0d,0x04,0x0b,0x40,0x55,0x01,0x30,0x10,0x8c,0xc0,0xb3,0x19,0x11,0x10,0x2a,0x05,
-0x10,0xd2,0xa4,0x10,0xf1,0x19,0x03,0xed,0xbe,0xbf,0xbd,0xd9,0x02,0xeb,0x62,0xa0,
-0xc0,0x77,0x00,0x03,0x87,0x3b,0x1d,0x18,0x81,0x00,0xad,0xdc,0xec,0xfc,0xdd,0xa0,
-0x00,0x76,0x2a,0x0c,0x07,0x70,0x00,0x07,0x72,0xb0,0xd0,0x77,0x00,0x2d,0x15,0x13,
-0xf3,0x06,0x20,0x07,0x02,0x20,0x40,0x08,0x00,0x05,0xb0,0x68,0x09,0x60,0x98,0x01,
-0xe2,0x04,0xa0,0x4b,0x00,0xe2,0x01,0x95,0x24,0x31,0x09,0x10,0x75,0x04,0x01,0x01,
-0xe9,0x1b,0x80,0xde,0xdd,0xef,0xdd,0xd9,0x00,0xbf,0x30,0xa9,0x23,0x50,0x8b,0xcd,
-0xcc,0xdf,0xcc,0x8d,0x4a,0x01,0xe1,0x3d,0x55,0xbd,0xcc,0xdf,0xcc,0xc0,0x0d,0x00,
-0xf4,0x09,0xdd,0xdd,0xdd,0xd7,0x00,0x1a,0x14,0x00,0x40,0x17,0x00,0x08,0x80,0xd1,
-0x09,0x60,0xc5,0x02,0xd1,0x0b,0x30,0x4a,0x02,0xe0,0x55,0x00,0x03,0xf4,0x09,0xf0,
-0x16,0xe2,0x00,0x02,0xc7,0x20,0x00,0x5f,0xdd,0x80,0x2c,0x3d,0x00,0x0c,0x40,0x87,
+0x2c,0x42,0x00,0xf0,0x0b,0xd8,0x00,0x00,0x05,0x30,0x00,0x08,0x00,0x00,0x01,0x4c,
+0x11,0x18,0x91,0x10,0x04,0xbb,0xbf,0xbd,0xdb,0xc9,0x00,0x07,0x70,0xd0,0x76,0xb1,
+0x07,0xf1,0x05,0x0d,0x07,0x68,0x30,0x01,0xcc,0xcd,0xdc,0xdd,0xcc,0xc6,0x00,0x02,
+0x22,0x22,0x22,0x10,0x00,0x04,0xda,0xbd,0x00,0x82,0x4a,0x11,0x11,0x14,0xc0,0x00,
+0x04,0xea,0x0d,0x00,0xf4,0x08,0x00,0x00,0x03,0xc0,0x00,0x04,0xec,0xcc,0xcc,0xcb,
+0x00,0x00,0xcb,0xaa,0xaa,0xab,0xb0,0x00,0x0c,0x87,0x77,0x77,0x8b,0x0d,0x00,0x80,
+0x22,0x22,0x4c,0x22,0x22,0x20,0x29,0x99,0x01,0x00,0x40,0x10,0x05,0xbb,0xbb,0xfd,
+0x07,0xf0,0x10,0x77,0x00,0x00,0x07,0x80,0x00,0x07,0xdb,0xbb,0xbb,0xd8,0x00,0x00,
+0x06,0x30,0xf0,0x53,0x00,0x00,0x4c,0x90,0x0f,0x03,0xac,0x30,0x19,0x20,0x6c,0xc0,
+0x00,0x39,0x99,0x05,0xf5,0x2e,0x00,0x14,0x79,0x00,0xaa,0xdb,0xa7,0x8c,0x86,0x20,
+0x0a,0x8c,0x9a,0x58,0x60,0x00,0x00,0xb8,0xca,0xb6,0x9d,0xcf,0xc4,0x09,0x8c,0xa9,
+0x5a,0x30,0xc0,0x02,0xaa,0xdb,0xa7,0xe0,0x0c,0x00,0x00,0x07,0x30,0x36,0x00,0x90,
+0x00,0x05,0xcc,0xcc,0xcc,0xca,0x00,0x00,0x68,0x00,0x00,0x02,0xd0,0x00,0x06,0xdb,
+0xbb,0xbb,0xbd,0x0d,0x00,0x40,0xeb,0xbb,0xbb,0xcd,0x2a,0x01,0x10,0xd1,0xcf,0x08,
+0xf0,0x05,0x0d,0x10,0x00,0x11,0x1e,0x21,0xd2,0x11,0x0e,0xed,0xfe,0xdf,0xed,0xeb,
+0xe0,0x0d,0x10,0xd1,0x03,0xbe,0x16,0x00,0xc7,0x3b,0xec,0xcf,0xcc,0xfc,0xcd,0xbe,
+0x22,0xe3,0x2e,0x32,0x5b,0x16,0x00,0x61,0xef,0xef,0xfe,0xff,0xef,0xbe,0x11,0x08,
+0x05,0x11,0x02,0x10,0x0e,0x7e,0x01,0xf6,0x01,0xec,0xcc,0xfd,0xcc,0xe4,0x00,0x0e,
+0x00,0x0e,0x10,0x0a,0x40,0x00,0xec,0xcc,0xfc,0x0d,0x00,0x91,0xbd,0xcd,0xfc,0xcc,
+0xc3,0x00,0x03,0xc0,0x5b,0xaa,0x03,0x20,0xce,0x30,0x6b,0x05,0xb4,0x9e,0xdb,0x73,
+0x10,0x00,0x1e,0xc6,0x00,0x27,0xbd,0xef,0x61,0x08,0xc0,0x0c,0x10,0x00,0x3b,0x00,
+0x00,0x9c,0xfc,0xa2,0xcd,0xec,0x90,0xb5,0x01,0xf3,0x1b,0x4a,0x00,0x02,0xcc,0xfc,
+0xc6,0xcd,0xec,0xc2,0x00,0x7e,0x90,0x01,0xda,0x70,0x00,0x7c,0x06,0x95,0xc3,0x0a,
+0x91,0x18,0x6a,0xab,0xcb,0xaa,0x65,0x10,0x08,0x72,0x22,0x22,0x78,0x00,0x00,0x8c,
+0x99,0x99,0x9c,0x80,0x00,0x0d,0x00,0x72,0x87,0x11,0x11,0x17,0x80,0x00,0x08,0x40,
+0x01,0xf0,0x39,0xeb,0xaa,0xaa,0xad,0x80,0x00,0x0e,0xaa,0xaa,0xaa,0xc8,0x00,0x00,
+0xe5,0x44,0x44,0x49,0x80,0x00,0x05,0x55,0x55,0x55,0x53,0x00,0x6d,0xdc,0xde,0xcc,
+0xcc,0xcc,0x10,0x4b,0x44,0xd3,0x55,0x55,0x30,0x04,0xc6,0x7d,0x4e,0x76,0xc6,0x00,
+0x4e,0xbb,0xd0,0x78,0x3d,0x00,0x04,0x90,0x2e,0x20,0xcd,0x30,0x05,0xdf,0xdc,0xf5,
+0x7d,0xcb,0x30,0x11,0x00,0x0d,0x87,0x00,0x4c,0x10,0x00,0x08,0x02,0x00,0x2f,0x06,
+0x10,0xc0,0x04,0x04,0x82,0xee,0xfe,0xee,0xee,0xee,0x20,0x00,0x4c,0xcd,0x04,0x70,
+0xed,0xdd,0xdd,0x90,0x00,0x1c,0xe4,0xed,0x01,0x91,0x2e,0x6a,0xed,0xdd,0xde,0xa0,
+0x01,0x50,0xa5,0xfa,0x01,0xc0,0x0a,0x62,0x22,0x26,0xa0,0x00,0x00,0xab,0xaa,0xaa,
+0xba,0x00,0xda,0x08,0x00,0xc8,0x04,0x80,0xa4,0x00,0x4e,0xe6,0x00,0x02,0xb0,0x0e,
+0x3a,0x00,0xc0,0x2b,0x00,0xe0,0x6f,0xee,0xf0,0x3e,0xfd,0xdf,0xc6,0x70,0x0d,0x0d,
+0x00,0x90,0x68,0x11,0xe0,0x02,0xfc,0xcf,0x06,0xdb,0xbf,0x0d,0x00,0x90,0x77,0x00,
+0xd0,0x02,0xfc,0xcf,0x07,0x82,0x2e,0x0d,0x00,0xf1,0x0d,0x8c,0xaa,0xf0,0x5d,0xdd,
+0xdd,0xca,0x30,0x0d,0x00,0x0a,0x16,0x30,0xd1,0x00,0xd0,0x07,0xa0,0x2d,0x3c,0x00,
+0x0e,0x02,0xc0,0x00,0x47,0x60,0x7e,0x99,0x0b,0x0c,0xf3,0x0a,0x10,0x03,0xf3,0x0a,
+0x18,0xf4,0xf3,0x0a,0x00,0x06,0x07,0xe0,0xcf,0xcc,0xcc,0xc2,0x02,0x22,0x3e,0xfe,
+0x32,0x22,0x00,0x00,0x0b,0x8f,0xf9,0x06,0xf0,0x05,0x0a,0x90,0xf0,0x9a,0x00,0x00,
+0x2c,0x90,0x0f,0x00,0xac,0x20,0x3e,0x50,0x00,0xf0,0x00,0x7f,0x30,0x10,0x34,0x00,
+0x19,0x10,0x4e,0x00,0x03,0x41,0x00,0xa0,0xee,0xef,0xff,0xfe,0xee,0xe2,0x00,0x00,
+0x87,0xf8,0x0c,0x04,0xa0,0x2d,0x0f,0x0d,0x10,0x00,0x00,0x0b,0x60,0xf0,0x6a,0x91,
+0x03,0xfa,0x02,0x0f,0x00,0xd6,0x00,0x06,0xe4,0x22,0xf2,0x24,0xe6,0x03,0xd2,0xcc,
+0xcf,0xcc,0xc2,0xd3,0x41,0x00,0xf1,0x07,0x67,0x00,0x00,0x01,0x66,0x00,0x06,0x70,
+0x4b,0xde,0xc9,0x40,0x15,0x9a,0x57,0x91,0x00,0x00,0x01,0x9c,0xc9,0x78,0x8f,0x04,
+0xf5,0x22,0x07,0xff,0xee,0xea,0x00,0x1f,0xd8,0x87,0xd0,0x07,0x60,0x07,0xa8,0x99,
+0x59,0x60,0xd2,0x00,0xc6,0x70,0xa4,0x3d,0x4b,0x00,0x66,0x67,0x0c,0x20,0xbe,0x20,
+0x00,0x06,0x71,0xe0,0x0b,0xf2,0x00,0x00,0x67,0x79,0x3c,0x84,0xe5,0x00,0x06,0x7b,
+0x2c,0x50,0x03,0x8c,0x09,0x90,0xed,0xdd,0xfd,0xdd,0xf0,0x00,0x0e,0x10,0x0f,0x64,
+0x00,0x45,0xed,0xcc,0xfc,0xcc,0x0d,0x00,0x53,0xcd,0xdd,0xfd,0xdd,0xd0,0x7c,0x00,
+0x40,0x2e,0xee,0xef,0xff,0xae,0x01,0x40,0x08,0xbf,0xa9,0x00,0xeb,0x00,0xb0,0xf0,
+0x7c,0x30,0x02,0xbd,0x50,0x0f,0x00,0x4c,0xc2,0x05,0xa3,0x00,0x11,0x04,0x9d,0x00,
+0x00,0x55,0x04,0xf0,0x27,0x70,0xbe,0xef,0xee,0xe2,0x06,0xab,0x50,0x00,0xa4,0x00,
+0x00,0x4a,0xa4,0x5b,0xbe,0xcb,0xb0,0x00,0xce,0x07,0x72,0xb5,0x2e,0x00,0x1f,0xb9,
+0x76,0x0c,0x50,0xe0,0x07,0xb7,0xa8,0x61,0xdc,0x0e,0x00,0xd7,0x70,0x76,0x86,0x67,
+0xe0,0x38,0x67,0x07,0xac,0x00,0xbe,0x00,0x06,0x70,0x76,0x63,0x05,0x51,0x67,0x07,
+0x60,0x00,0x0e,0x0d,0x00,0x26,0x5e,0xb0,0x8e,0x01,0x15,0xe0,0xff,0x00,0xf1,0x1a,
+0x2d,0xdd,0xdf,0xff,0xdd,0xdd,0x30,0x00,0x2c,0x5e,0x5b,0x20,0x00,0x01,0x8d,0x30,
+0xe0,0x3d,0x82,0x03,0xd7,0x76,0x69,0x66,0x66,0xc2,0x00,0x1e,0x33,0x33,0x3e,0x10,
+0x00,0x01,0xfa,0xaa,0xaa,0xf1,0x00,0x00,0x1d,0x44,0x03,0x54,0x01,0xea,0xaa,0xaa,
+0xe1,0x45,0x00,0x10,0xdd,0x01,0x00,0x01,0x40,0x09,0x01,0xa3,0x00,0x22,0x00,0x4a,
+0x4d,0x01,0x10,0xc2,0x0d,0x00,0xf0,0x21,0xae,0xee,0xee,0xe4,0x1e,0xff,0xd0,0x35,
+0x04,0x40,0x00,0x0c,0x90,0x0b,0x50,0x2d,0x30,0x01,0xff,0x29,0xb0,0x01,0x6d,0x10,
+0x6c,0x9c,0x66,0x80,0x89,0x40,0x0c,0x77,0x40,0x0d,0x2e,0x20,0x05,0x96,0x70,0x00,
+0x5e,0x90,0x00,0x21,0x67,0x00,0x07,0xfb,0x34,0x00,0xa4,0x1a,0xb1,0x8d,0x50,0x00,
+0x67,0x0c,0x60,0x00,0x3b,0x87,0x08,0x04,0x5b,0x00,0x21,0x02,0xb0,0x5b,0x00,0xf0,
+0x1f,0x9c,0x88,0x83,0x00,0x28,0x92,0x2f,0x77,0x7f,0x30,0x2b,0xed,0xbd,0xb9,0x09,
+0xa0,0x00,0x0c,0xd1,0x40,0xab,0xb0,0x00,0x02,0xfb,0xb0,0x6c,0xbb,0x40,0x00,0x8a,
+0x79,0xea,0x20,0x17,0xc2,0x1c,0x67,0x15,0xdd,0xdd,0xd3,0x05,0x56,0x70,0x49,0xce,
+0x08,0xb0,0x67,0x04,0x90,0x00,0xb3,0x00,0x06,0x70,0x4e,0xcc,0xcf,0x0d,0x00,0x25,
+0x91,0x11,0xa1,0x01,0x04,0x59,0x01,0xf1,0x26,0xce,0xee,0xee,0xe3,0x00,0x67,0x0c,
+0x10,0x00,0x00,0x04,0xef,0xfd,0xc6,0xdd,0xed,0xd0,0x00,0xbb,0x0c,0x10,0x3a,0x00,
+0x00,0x1f,0xbb,0xc2,0xac,0xea,0x70,0x07,0xa7,0x5c,0x22,0x5b,0x21,0x01,0xb6,0x70,
+0xc1,0x03,0xa0,0x00,0x54,0x67,0x0c,0x7d,0xdf,0xdd,0x10,0x06,0x70,0xc1,0x41,0x00,
+0xb0,0x0c,0xbb,0xbb,0xbb,0x50,0x06,0x70,0x12,0x22,0x22,0x21,0xf0,0x42,0x00,0x00,
+0x02,0xa0,0x00,0x00,0x00,0xdc,0xcc,0xce,0xdc,0xcc,0xe0,0x0e,0x00,0x0b,0x10,0x00,
+0x0e,0x01,0xcc,0xcd,0xfc,0xcc,0xcc,0xc2,0x00,0x09,0x70,0x02,0xc3,0x00,0x00,0x02,
+0x9b,0xc9,0xf7,0x00,0x00,0x07,0x8a,0xcb,0x76,0xad,0xa4,0x00,0x53,0x10,0x0f,0x00,
+0x03,0x20,0x3c,0xcc,0xdf,0xff,0xdc,0xcc,0x40,0x00,0x2b,0x8f,0x7b,0x20,0x00,0x04,
+0xad,0x30,0xf0,0x3c,0xa5,0x03,0xa4,0x00,0x0f,0x00,0x03,0xa4,0x00,0x68,0x00,0x01,
+0x00,0xf0,0x2b,0x06,0x80,0x6d,0xbb,0xbb,0xe0,0x00,0x68,0x06,0xa4,0x44,0x4e,0x04,
+0xef,0xfe,0x7b,0x66,0x66,0xe0,0x00,0xb8,0x06,0xb7,0x77,0x7e,0x00,0x0f,0xe1,0x13,
+0x33,0x33,0x30,0x06,0xca,0xba,0xee,0xee,0xee,0x30,0xc6,0x85,0x00,0x0d,0x10,0x00,
+0x57,0x68,0x2b,0xbb,0xfc,0xbb,0x60,0x06,0x80,0x22,0x2e,0x32,0x21,0x41,0x00,0x10,
+0xd1,0x41,0x00,0x00,0x1a,0x00,0x04,0x01,0x00,0xf1,0x40,0x19,0x00,0x06,0x40,0x00,
+0x00,0x06,0x90,0x02,0xfa,0x9a,0x20,0x00,0xd3,0xd2,0xda,0x25,0xd0,0x00,0x4f,0x0d,
+0x64,0xb6,0xd3,0x00,0x0e,0xf0,0xd0,0x06,0xfb,0x00,0x06,0x9e,0x0d,0x6c,0x95,0x7d,
+0xa1,0x00,0xe0,0xd3,0x10,0xe0,0x03,0x00,0x0e,0x0d,0x7d,0xdf,0xdd,0xc0,0x00,0xe0,
+0xd0,0x40,0xe1,0x40,0x00,0x0e,0x0c,0x4c,0x0e,0x0b,0x40,0x00,0xe0,0x1d,0x20,0xe0,
+0x1c,0x00,0x0e,0x00,0x11,0xea,0x00,0x00,0x00,0xd0,0x54,0x00,0xf3,0x38,0x0d,0x06,
+0xdd,0xdd,0xef,0x50,0x26,0xe6,0x00,0x01,0x89,0x20,0x01,0x4f,0x45,0x97,0x86,0xbb,
+0x90,0x03,0xf5,0x93,0xa8,0x51,0x1b,0x00,0x7f,0xba,0x0a,0x85,0xc6,0x70,0x0b,0xd4,
+0xa0,0xa8,0x43,0xf2,0x03,0x9d,0x09,0xbb,0x84,0x4e,0x50,0x63,0xd0,0x60,0x38,0x7c,
+0x1c,0x00,0x0d,0x00,0x0b,0xc3,0x10,0x10,0x00,0xd2,0xaa,0xaa,0xaa,0xaa,0x30,0x0d,
+0x02,0x22,0x22,0x22,0x20,0xa2,0x00,0xf0,0x29,0x08,0x20,0x0d,0x00,0x0a,0x00,0x00,
+0xb2,0x3c,0xeb,0x36,0x52,0x00,0x86,0xb5,0xa0,0x96,0xc2,0xc1,0x08,0xb8,0x2e,0xbd,
+0x9b,0xe5,0x00,0x0b,0x65,0xa0,0x94,0x3a,0x60,0x0a,0xbc,0x8d,0x8c,0x6d,0x8d,0x20,
+0x42,0x15,0x4a,0x43,0x74,0x53,0x1c,0xcc,0xcc,0xfd,0xcc,0xcc,0x60,0x00,0x05,0xcf,
+0xc7,0xdd,0x00,0xf2,0x05,0xb1,0xe0,0x7c,0x40,0x00,0xae,0x70,0x0e,0x00,0x3b,0xd5,
+0x05,0x00,0x00,0xe0,0x00,0x03,0x20,0x00,0x67,0x46,0x01,0xf4,0xff,0x22,0x70,0xcc,
+0xfc,0xfd,0xc4,0x00,0x67,0x04,0x6e,0x6d,0x76,0x03,0xef,0xfd,0x95,0xc3,0xc3,0xe0,
+0x00,0xb7,0x09,0x3b,0x0b,0x0d,0x00,0x0f,0xd0,0x6b,0xbb,0xbb,0xb0,0x05,0xdb,0x92,
+0x99,0x99,0x96,0x00,0xc7,0x76,0x01,0x11,0x11,0x10,0x49,0x67,0x0c,0xcc,0xfc,0xcc,
+0x41,0x16,0x70,0x1a,0x0d,0x19,0x20,0x00,0x67,0x2c,0x40,0xd1,0x3d,0x10,0x06,0x71,
+0x32,0xcd,0x00,0x41,0x00,0x76,0x00,0x0e,0x01,0xd0,0x00,0x07,0x60,0xdd,0xfd,0xdf,
+0xd8,0x08,0xcb,0x60,0x0c,0x01,0xc0,0x00,0x8c,0xb6,0x5b,0xbb,0xbb,0xc0,0x00,0xcb,
+0x07,0x70,0x00,0x0e,0x00,0x1f,0xe5,0x7d,0xaa,0xaa,0xf0,0x06,0xe7,0xb7,0xb7,0x77,
+0x7f,0x00,0xc8,0x60,0x13,0x3d,0x53,0x30,0x29,0x76,0x4c,0xcc,0xfd,0xcc,0x80,0x07,
+0x60,0x00,0xa9,0xc3,0x00,0x00,0x76,0x02,0xac,0x02,0xe6,0x00,0x07,0x66,0xc6,0x00,
+0x01,0x9a,0x00,0x66,0x00,0x92,0x01,0xb0,0x00,0x06,0x60,0x59,0xc7,0xab,0x71,0x01,
+0x77,0x13,0x44,0xe5,0x44,0x03,0xce,0xeb,0x3b,0xbf,0xbb,0x80,0x00,0xc7,0x01,0x11,
+0xd2,0x11,0x00,0x1f,0xd2,0xaa,0xed,0xaa,0xa3,0x06,0xda,0xa0,0x04,0x9b,0x30,0x00,
+0xc8,0x65,0x19,0x9e,0x21,0x80,0x59,0x66,0x2b,0xb6,0xda,0xc4,0x01,0x16,0x60,0x0b,
+0x2d,0x98,0x00,0x00,0x66,0x1a,0x70,0xd1,0xaa,0x20,0x06,0x64,0x41,0xcd,0x00,0x52,
+0x00,0xc0,0x04,0x28,0x30,0x60,0x00,0x0c,0x00,0xa0,0x84,0x65,0x10,0x02,0xd2,0x46,
+0x88,0x6c,0x68,0x03,0xcf,0xbb,0xc7,0x78,0x9d,0x00,0x03,0xf0,0x09,0x76,0x77,0x59,
+0x00,0x7f,0x79,0xcb,0x9a,0xda,0xb0,0x0a,0xca,0x1a,0x03,0xb2,0xb1,0x02,0x9c,0x09,
+0xfc,0xcf,0xcc,0xc0,0x73,0xc0,0x0f,0x50,0xa3,0xb3,0x00,0x0c,0x04,0x9b,0x65,0xe6,
+0x00,0x00,0xc0,0xc2,0x04,0xbe,0x36,0x50,0x0c,0x74,0x04,0xa2,0x2c,0xd1,0x30,0x02,
+0xe0,0x76,0x00,0x3a,0x02,0xc0,0x00,0x07,0x62,0xbc,0xeb,0xcf,0xb6,0x00,0x87,0x0d,
+0x00,0xf4,0x2c,0x04,0xce,0xec,0x02,0xbb,0xb9,0x00,0x00,0xd6,0x39,0x99,0x99,0x99,
+0x60,0x1f,0xb1,0x22,0x2b,0x52,0x22,0x06,0xdd,0xaa,0xca,0xeb,0xaf,0x00,0xc8,0x67,
+0xa9,0x6d,0x86,0xe0,0x58,0x76,0x09,0x73,0xc5,0x3e,0x00,0x17,0x60,0x8b,0xbc,0xbb,
+0xc0,0x00,0x76,0x02,0xb9,0x01,0xd6,0x00,0x07,0x67,0xc5,0x00,0x01,0xa7,0x55,0x00,
+0xf0,0x3b,0x58,0x03,0x60,0xd0,0x64,0x00,0x05,0x80,0x0d,0x0d,0x0d,0x10,0x01,0x69,
+0x1c,0xdc,0xfc,0xdc,0x31,0xef,0xfc,0xd0,0x00,0x00,0xa3,0x00,0x98,0x04,0xdb,0xbb,
+0xe6,0x10,0x0e,0xe0,0x0d,0x22,0x2c,0x20,0x03,0xdb,0x90,0x68,0x88,0x81,0x00,0xa7,
+0x85,0x8c,0xbc,0xbc,0xb0,0x2b,0x58,0x0a,0x20,0xd0,0x0e,0x00,0x25,0x80,0xac,0xbf,
+0xbb,0xe0,0x00,0x58,0x0a,0x30,0xd0,0x1e,0x00,0x05,0x80,0xac,0x1b,0x03,0x09,0x01,
+0x00,0xf0,0x0d,0x08,0x30,0x00,0x89,0x00,0x00,0x00,0x83,0x00,0x5c,0xb9,0x00,0x00,
+0x6b,0x82,0x7c,0x00,0x7d,0x60,0x08,0xda,0x99,0xac,0xcc,0x2a,0x30,0x0e,0x50,0x20,
+0x00,0xf4,0x1e,0x03,0xfd,0x0e,0xac,0x6c,0xc8,0x00,0x8c,0x86,0xa0,0xc6,0x53,0x80,
+0x0c,0x84,0x0d,0xba,0x6c,0xb7,0x02,0x78,0x30,0x28,0x00,0x74,0x00,0x00,0x83,0x09,
+0xb0,0x0e,0x60,0x00,0x08,0x35,0xa4,0xa9,0x8b,0x90,0x00,0x85,0xb0,0x03,0xa0,0x08,
+0x37,0x03,0x12,0xc0,0x06,0x00,0x60,0xca,0xab,0x8b,0xae,0x01,0xd1,0x06,0x00,0xf6,
+0x27,0x2e,0xfc,0xc0,0x0b,0x81,0x0d,0x01,0xe0,0xca,0xa9,0x8a,0xae,0x05,0xf7,0xc4,
+0x9a,0xc9,0x4c,0x09,0xd7,0xc0,0x8a,0xb8,0x0c,0x0a,0xc0,0xc1,0x97,0x8a,0x0c,0x66,
+0xc0,0xc1,0xcb,0xcc,0x0c,0x20,0xc0,0xc0,0x2c,0xc2,0x0c,0x00,0xc0,0xc4,0x83,0x68,
+0x0c,0x00,0xc0,0xc0,0x01,0x20,0xaa,0xa5,0x00,0xf1,0x39,0x00,0x00,0xfd,0xdd,0xdc,
+0x1d,0x00,0x00,0xd3,0xa9,0xa0,0x5f,0xdd,0xe2,0xd4,0x50,0xc0,0xb4,0x00,0xe0,0xd4,
+0x84,0xd2,0xe0,0xa3,0xa0,0xd1,0x55,0x51,0x42,0xc0,0x10,0xd7,0xa5,0xa7,0x03,0xf0,
+0x00,0xd7,0x87,0x2a,0x05,0xf5,0x00,0xd8,0xa7,0x5a,0x0a,0x9a,0x00,0xd4,0x62,0x64,
+0x1d,0x0d,0x30,0xeb,0xbb,0xbb,0xc5,0x03,0xd2,0x11,0x11,0x13,0x60,0x00,0x42,0x00,
+0x00,0x00,0x96,0x4e,0x00,0x61,0x09,0x60,0x00,0x00,0x00,0x21,0x0d,0x00,0x21,0x0a,
+0x40,0x0d,0x00,0x50,0xa4,0x00,0x9d,0xbb,0xb8,0x0d,0x00,0x5a,0x83,0x33,0x20,0x00,
+0xa4,0x1a,0x00,0x06,0x0d,0x00,0x71,0x6c,0xfd,0xcc,0xee,0xcc,0xcc,0x11,0x01,0x00,
+0x30,0x10,0x08,0xee,0x01,0x00,0x04,0x4e,0x00,0x02,0x5b,0x00,0x21,0x04,0x80,0x0d,
+0x00,0xe1,0x59,0x00,0x9d,0xbb,0xb4,0x00,0x05,0x90,0x09,0x83,0x33,0x10,0x00,0x59,
+0x1a,0x00,0x23,0x05,0x90,0x1a,0x00,0x00,0x0d,0x00,0x80,0xbd,0xeb,0xbe,0xdb,0xbb,
+0xb5,0x03,0x33,0x01,0x00,0x50,0x10,0x00,0x00,0xe1,0x01,0x93,0x01,0x71,0x0e,0x10,
+0x1e,0x00,0x00,0x00,0x40,0x0d,0x00,0xc0,0x1c,0x0e,0x10,0x1e,0x04,0xd1,0x01,0xc0,
+0xef,0xe1,0xf9,0xe4,0x0d,0x00,0x55,0x1f,0x80,0x00,0x01,0xc0,0x1a,0x00,0x13,0x00,
+0x0d,0x00,0x11,0x10,0x0d,0x00,0xf5,0x00,0x2c,0x01,0xd4,0xeb,0xd0,0xf0,0x05,0xa1,
+0xef,0xc9,0x63,0x0b,0xfe,0xe4,0x02,0x33,0x01,0x10,0xd2,0xbc,0x01,0xf0,0x22,0xa0,
+0x0d,0xbb,0xba,0x00,0x00,0x3b,0x00,0xd5,0x33,0x30,0x00,0x03,0xb0,0x0d,0x20,0x00,
+0x00,0x2e,0xff,0xee,0xfe,0xee,0xee,0x10,0x00,0x22,0x0e,0x00,0x02,0x00,0x00,0x0d,
+0x40,0xe0,0x05,0xd0,0x00,0x1c,0x80,0x0e,0x02,0xe2,0x00,0x08,0x80,0x00,0xe5,0xe5,
+0x3a,0x00,0xd0,0x4c,0xd2,0x00,0x00,0x02,0x58,0xdc,0x50,0x00,0x00,0x01,0xda,0x62,
+0x11,0x00,0xf0,0x23,0x3e,0xef,0xfe,0xef,0xfe,0xee,0x30,0x00,0xe2,0x00,0x77,0x00,
+0x00,0x00,0x5b,0x00,0x07,0x70,0x01,0x00,0x0c,0xee,0xea,0x77,0x0a,0xa0,0x07,0x90,
+0x08,0x77,0xac,0x90,0x03,0xd6,0x30,0xe2,0x7e,0x40,0x00,0x02,0x3e,0x7c,0x07,0x70,
+0x00,0x00,0x00,0x4f,0x30,0x77,0x33,0x01,0xf6,0x03,0xa0,0x07,0x70,0x06,0x40,0x1a,
+0xb0,0x00,0x68,0x00,0x95,0x2e,0x70,0x00,0x03,0xee,0xed,0x10,0x55,0x05,0x90,0x2b,
+0x00,0x00,0x1d,0xfe,0xdc,0x49,0x2b,0x00,0xc3,0x02,0xf0,0x17,0x9b,0x8d,0x77,0x20,
+0x00,0xed,0xd7,0xd3,0x5c,0x22,0x00,0x03,0x90,0x8e,0x70,0x2b,0x00,0x00,0x0a,0x30,
+0xb4,0x21,0x4b,0x11,0x10,0x2c,0x93,0xd6,0xcc,0xff,0xdc,0x90,0x13,0x3d,0xa0,0x04,
+0xee,0xa0,0x85,0x01,0xf1,0x05,0x2d,0x4b,0x95,0x00,0x00,0x4b,0x05,0xd3,0x2b,0x0d,
+0x50,0x04,0xd1,0x2c,0x20,0x2b,0x01,0x90,0x0a,0x20,0x4d,0x00,0x30,0x00,0x00,0x43,
+0x05,0x00,0xf1,0x0e,0x18,0xc9,0x40,0xed,0xde,0x00,0x03,0xc0,0x00,0x0e,0x00,0xe0,
+0x00,0x3f,0xdd,0x71,0xd0,0x0e,0x00,0x03,0xb0,0x00,0xa8,0x00,0xdc,0x80,0x3b,0x00,
+0x18,0xcc,0x02,0xf0,0x08,0xd7,0xad,0xdd,0xd9,0x00,0x3b,0x00,0x02,0xb0,0x0a,0x50,
+0x03,0xc5,0x77,0x0a,0x63,0xd0,0x03,0xee,0x96,0x30,0x1d,0xe3,0x27,0x00,0xa6,0x08,
+0xed,0xa1,0x00,0x3b,0x00,0x6e,0x91,0x07,0xe6,0x1d,0x03,0x78,0x10,0x00,0x00,0x1e,
+0x00,0x00,0xe1,0x06,0x00,0x20,0x01,0x50,0x06,0x00,0x70,0x1d,0xb0,0x1f,0xff,0xf1,
+0xe6,0xe8,0x12,0x00,0x2d,0xec,0x30,0x24,0x00,0xf5,0x05,0x00,0x93,0x1e,0x00,0x30,
+0xe1,0x00,0xb3,0x2f,0x8e,0xd1,0xe2,0x00,0xd1,0x6e,0x82,0x00,0x8f,0xee,0x90,0x54,
+0x00,0x11,0xf0,0x06,0x00,0x14,0x0f,0x0d,0x00,0xf0,0x21,0x61,0x00,0xcc,0xcc,0x2f,
+0x30,0x5d,0x10,0x02,0x23,0xf0,0xfb,0x4d,0x20,0x00,0x00,0x4c,0x0f,0xad,0x20,0x00,
+0x00,0x0a,0x60,0xf1,0xd1,0x00,0x00,0x03,0xe0,0x0f,0x05,0xc0,0x00,0x00,0xd5,0x00,
+0xf0,0x0a,0xc1,0x01,0xc9,0x00,0x0f,0x00,0x0a,0xe4,0x17,0x34,0x00,0x56,0x05,0x10,
+0x00,0x0b,0xfb,0xa6,0x00,0x20,0x06,0x70,0xbb,0x05,0x50,0x00,0x2b,0xc0,0x60,0x0e,
+0x85,0x02,0xf3,0x30,0x0d,0x10,0xe0,0x15,0x00,0x00,0x00,0xd1,0x0f,0xae,0xd0,0x3c,
+0x40,0x0d,0x8e,0xf5,0x1d,0x00,0x3c,0x5b,0xf8,0x2e,0x01,0xd0,0x00,0x01,0x4e,0x10,
+0xe0,0x1d,0x00,0x00,0x70,0xd1,0x0e,0x04,0xb0,0x00,0x5b,0x0d,0x10,0xe6,0xc4,0x00,
+0x0d,0x20,0xd1,0x00,0x00,0x74,0x08,0xa0,0x0d,0x20,0x00,0x0a,0x40,0xa1,0x00,0x7e,
+0xee,0xee,0xc0,0x55,0x00,0xf2,0x40,0x79,0x10,0x0c,0x30,0x00,0x00,0x00,0x7d,0x00,
+0xfe,0xee,0xe8,0x00,0x00,0x00,0x4b,0x00,0x07,0x80,0x03,0x00,0x0a,0x50,0x00,0x86,
+0x02,0xcb,0x15,0xc0,0x04,0x6e,0x30,0x00,0x72,0x82,0x00,0x58,0x50,0x00,0x00,0x03,
+0xdd,0xdd,0xde,0x60,0x00,0x0a,0x02,0xc0,0x01,0xd1,0x00,0x08,0x80,0x06,0x91,0xc6,
+0x00,0x01,0xe1,0x00,0x0b,0xf8,0x00,0x00,0xa7,0x01,0x5b,0xc8,0xe8,0x30,0x08,0x00,
+0xc9,0x40,0x01,0x7c,0x30,0x01,0x55,0x00,0xa1,0x6d,0x50,0x1f,0xee,0xf1,0x00,0x00,
+0x28,0x01,0xd0,0x62,0x07,0xe1,0x5a,0x00,0xd2,0x00,0x2d,0x60,0x5e,0x30,0x07,0xee,
+0x30,0x1b,0x58,0x30,0x22,0x00,0xf3,0x16,0x6f,0xee,0xee,0xf3,0x00,0x00,0x70,0x97,
+0x00,0x4c,0x00,0x00,0x5a,0x01,0xd3,0x2d,0x30,0x00,0x0d,0x30,0x02,0xee,0x40,0x00,
+0x07,0xa0,0x04,0xbc,0xcb,0x40,0x00,0xa2,0x2e,0xb5,0x00,0x5c,0xe2,0xa3,0x00,0x21,
+0x03,0x91,0x4e,0x01,0x21,0x09,0xe3,0x4e,0x01,0x22,0x04,0x10,0x5b,0x01,0xf0,0x00,
+0xfe,0xef,0xee,0xf0,0x0b,0x81,0x0e,0x00,0xf0,0x0e,0x00,0x06,0x60,0xe0,0x0f,0x1a,
+0x01,0xd1,0x0f,0xbb,0xfb,0xbf,0x00,0x00,0x60,0xe3,0x3f,0x33,0xe0,0x00,0x4c,0x1a,
+0x00,0x20,0x0d,0x30,0x1a,0x00,0x80,0x07,0xa0,0x0f,0xee,0xfe,0xef,0x00,0x32,0x24,
+0x00,0x13,0xd0,0xa3,0x00,0xf0,0x21,0x5d,0x40,0x1f,0xee,0xeb,0x00,0x00,0x19,0x02,
+0xd0,0x03,0xb0,0x00,0x00,0x00,0x6a,0x00,0x3b,0x00,0x2c,0x60,0x1d,0x30,0x02,0xd4,
+0x20,0x09,0x3c,0x50,0x00,0x05,0x73,0x00,0x00,0x0b,0xcc,0xcc,0xc7,0x00,0x00,0xd0,
+0xd2,0x11,0x17,0x90,0x00,0x88,0x0d,0xe2,0x03,0xe0,0x3e,0x00,0xd1,0x00,0x05,0x90,
+0x0d,0x50,0x0d,0xed,0xdd,0xe9,0x00,0x50,0x0d,0x00,0xc1,0x80,0x06,0x81,0x00,0x04,
+0xa0,0x00,0x00,0x07,0xd0,0x00,0x4a,0xf2,0x07,0x50,0xde,0xfd,0xd7,0x00,0x20,0x3d,
+0x03,0x31,0x00,0x3e,0x80,0x1a,0x00,0x40,0x1b,0x31,0x22,0x6b,0xc3,0x07,0x90,0x7b,
+0xbf,0xdb,0xbb,0x00,0x00,0x70,0x02,0xe1,0x7a,0x03,0xf3,0x09,0x00,0xa7,0x09,0x20,
+0x00,0x0c,0x40,0x3d,0x00,0x3c,0x00,0x07,0xb0,0x1d,0xa9,0xac,0xf7,0x00,0xb2,0x01,
+0xa7,0x52,0x01,0xd0,0xf1,0x00,0x21,0x04,0x90,0xe9,0x01,0x40,0x08,0xd1,0x00,0x0e,
+0xff,0x00,0xf0,0x3b,0x2f,0xee,0xfe,0xef,0x70,0x10,0x02,0xc0,0x0e,0x00,0xd1,0x0c,
+0xa1,0x2c,0x00,0xe0,0x17,0x00,0x06,0x33,0xfd,0xef,0xde,0x70,0x00,0x00,0x4a,0xa3,
+0x00,0xb4,0x00,0x01,0x95,0x83,0xc0,0x3d,0x00,0x00,0x78,0x76,0x09,0x9d,0x30,0x00,
+0x1e,0x1b,0x30,0x2f,0xc0,0x00,0x08,0x92,0xd1,0x7e,0x69,0xd5,0x00,0x71,0x65,0xa9,
+0x10,0x04,0xb6,0x02,0x20,0x00,0x07,0x20,0x00,0x00,0x4d,0x90,0x00,0x6b,0x45,0x02,
+0xe0,0x22,0x23,0xc3,0x22,0x00,0x00,0x07,0xbb,0xce,0xbb,0xb1,0x2c,0x60,0x00,0xfd,
+0x00,0x40,0x18,0x30,0x00,0x3b,0x77,0x00,0xd1,0x1c,0xcd,0xfc,0xc8,0x00,0x00,0xc0,
+0x11,0x5c,0x11,0x10,0x00,0x5a,0x1a,0x00,0x11,0x0d,0x1a,0x00,0x21,0x06,0xb0,0x0d,
+0x00,0x5a,0xd2,0x0e,0xee,0xff,0xee,0x35,0x03,0x21,0x00,0x3a,0xce,0x04,0xf0,0x22,
+0x00,0x5e,0x47,0xfd,0xdd,0xd9,0x00,0x00,0x14,0xf7,0x00,0x0c,0x40,0x02,0x00,0xc4,
+0xb5,0x0a,0x90,0x00,0xcb,0x20,0x00,0xcd,0x90,0x00,0x00,0x66,0x01,0x8e,0x9d,0x72,
+0x00,0x00,0x0a,0xe8,0x00,0x18,0xd9,0x00,0x09,0x5d,0xdd,0xdd,0xd9,0x00,0x03,0xd0,
+0xd0,0x50,0x00,0x20,0xc5,0x0d,0xb2,0x04,0x90,0x7b,0x00,0xfd,0xdd,0xdd,0xb0,0x03,
+0x20,0x0e,0x7b,0x02,0x02,0x01,0x00,0x81,0x0a,0x91,0x0d,0x10,0xe0,0x2c,0x00,0x63,
+0x06,0x00,0x10,0x00,0x06,0x00,0xf2,0x21,0x59,0x10,0x8d,0x70,0xf9,0x2c,0x07,0xc3,
+0x9d,0x95,0xe9,0x6c,0x00,0x09,0x4e,0x3a,0xe2,0xdc,0x00,0x36,0x0e,0x03,0xe0,0x5c,
+0x00,0xe0,0x1c,0x00,0xe0,0x2c,0x06,0x90,0x68,0x00,0xe0,0x2c,0x0d,0x20,0xc2,0x00,
+0xe0,0x2c,0x3b,0x05,0x80,0x00,0xe0,0x2c,0x48,0x00,0xf4,0x03,0x05,0x30,0x00,0x00,
+0x15,0x94,0x00,0x4d,0xa2,0xad,0xee,0x95,0x10,0x00,0x04,0x02,0x02,0xb0,0x94,0x04,
+0x92,0x3d,0x50,0xde,0xef,0xfe,0xee,0x40,0x2b,0x30,0x54,0x04,0x10,0x00,0x1a,0x00,
+0xf1,0x1a,0x01,0xa0,0xfe,0xee,0xef,0x70,0x00,0x97,0x0d,0x00,0x00,0x77,0x00,0x3d,
+0x00,0xd0,0x00,0x07,0x70,0x0d,0x40,0x0f,0xaa,0xaa,0xd7,0x00,0x50,0x00,0xe3,0x33,
+0x38,0x70,0x04,0x10,0x00,0x06,0x20,0x00,0x00,0x6d,0x30,0x7f,0x0a,0xf3,0x31,0x37,
+0xcd,0xef,0xdd,0xdd,0x20,0x00,0x00,0x1c,0x30,0x75,0x00,0x3d,0x60,0x3c,0xa6,0x78,
+0xf5,0x00,0x08,0x26,0x86,0x54,0x33,0xb0,0x00,0x00,0x0c,0x08,0x43,0x90,0x00,0x01,
+0xb0,0xe0,0x94,0x4a,0x00,0x00,0x88,0x0e,0x09,0x44,0xa0,0x00,0x2e,0x14,0xc0,0x94,
+0x4a,0x22,0x0b,0x71,0xd6,0x09,0x44,0xa4,0x60,0xb0,0x5b,0x00,0x10,0x2d,0xd2,0xeb,
+0x00,0xf0,0x16,0x07,0x50,0x14,0x01,0xd0,0x05,0x10,0x2c,0x91,0xe1,0x1d,0x03,0xe0,
+0x00,0x04,0x08,0x81,0xd0,0xb7,0x00,0x00,0x00,0x12,0x1d,0x04,0x00,0x2d,0x50,0x0f,
+0xee,0xee,0xed,0x00,0x1b,0x20,0xe0,0x00,0x17,0x02,0x71,0x0f,0xdd,0xdd,0xdd,0x00,
+0x01,0x80,0x0d,0x00,0x11,0x96,0x0d,0x00,0x20,0x1e,0x00,0x0d,0x00,0xe2,0x0a,0x70,
+0x0e,0x00,0x00,0x2d,0x00,0x90,0x00,0xe0,0x00,0xdd,0x80,0x00,0x79,0x05,0xf3,0x38,
+0x3d,0x83,0xfc,0xcc,0xcd,0x90,0x00,0x07,0x4c,0x11,0x11,0x59,0x00,0x00,0x02,0xea,
+0xaa,0xab,0x90,0x0b,0x40,0x2c,0x22,0x22,0x69,0x00,0x2c,0x61,0xaa,0xaa,0xaa,0x60,
+0x00,0x00,0x1a,0x00,0x29,0x01,0x00,0x00,0xa3,0xfa,0xa3,0xc7,0xc2,0x00,0x3c,0x1d,
+0x22,0x3f,0x70,0x00,0x0b,0x41,0xd0,0x02,0xb0,0x14,0x05,0xc0,0x1d,0x38,0x4c,0x03,
+0xa0,0x93,0x06,0xfb,0x71,0xdd,0xe5,0xa3,0x00,0x21,0x01,0x40,0x07,0x00,0xf0,0x36,
+0x2a,0xc8,0xee,0xff,0xee,0xe2,0x00,0x01,0x00,0x0e,0x20,0x00,0x00,0x30,0x1b,0xbc,
+0xfb,0xbb,0xb6,0x1c,0xb1,0x24,0xe4,0x2c,0x72,0x10,0x06,0x00,0xa7,0x10,0x1d,0x20,
+0x00,0x01,0xb9,0x0d,0x00,0x3d,0x60,0x07,0x56,0x61,0xd2,0x39,0x42,0x00,0xd2,0x0d,
+0x0d,0x2b,0x2c,0x00,0x3c,0x0a,0x60,0xd0,0xc0,0xa5,0x0a,0x60,0x40,0x0d,0x03,0x02,
+0x20,0x51,0x00,0x4d,0xc0,0xc4,0x0a,0xf0,0x26,0x00,0x0b,0x30,0x00,0x00,0x5e,0x4b,
+0xbb,0xec,0xbb,0x70,0x00,0x20,0x34,0x4d,0x74,0x41,0x01,0x00,0x04,0x55,0xd7,0x55,
+0x10,0x5d,0x46,0xbb,0xbe,0xcb,0xbb,0x00,0x27,0x02,0x44,0x44,0x44,0x00,0x00,0x00,
+0x89,0x66,0x66,0xf0,0x00,0x09,0x48,0xdb,0xbb,0xbf,0x00,0x00,0xe0,0x86,0x0f,0x03,
+0x20,0x79,0x08,0x0d,0x00,0xc4,0x0e,0x20,0x85,0x00,0x00,0xe0,0x01,0x80,0x08,0x50,
+0x06,0xdb,0x89,0x02,0xf3,0x3f,0x98,0x00,0x00,0x01,0xb9,0x50,0x00,0xa9,0x00,0x00,
+0x0c,0x0b,0x10,0x00,0x0d,0xdd,0xdd,0xfd,0xd3,0x01,0x00,0xd0,0x00,0x0c,0x00,0x03,
+0xe8,0x0d,0x6c,0xc8,0xc0,0x90,0x01,0x90,0xd0,0x00,0x0c,0x2b,0x00,0x00,0x0d,0x6d,
+0xca,0xa9,0x60,0x00,0x94,0xb6,0x40,0xa8,0xe0,0x00,0x1e,0x3a,0x6b,0xaa,0x89,0x01,
+0x07,0x86,0x76,0x61,0x4e,0xb2,0x80,0xe2,0xc2,0x11,0x4d,0x2d,0x76,0x17,0x1a,0x00,
+0x0a,0x20,0x5e,0x10,0x6c,0x05,0x10,0x30,0xce,0x03,0xf0,0x0d,0x04,0xe5,0xed,0xdd,
+0x14,0x0d,0x00,0x23,0xd0,0x0d,0x2a,0x0d,0x00,0x00,0xe9,0x9d,0x2a,0x0d,0x3d,0x50,
+0xd2,0x2d,0x2a,0x0d,0x02,0xa0,0xd3,0x3d,0x12,0x00,0x61,0xe8,0x8d,0x2a,0x0d,0x00,
+0x41,0x1e,0x00,0xf3,0x08,0xd1,0xdd,0xdd,0x2a,0x0d,0x04,0xb0,0x73,0x46,0x00,0x0d,
+0x0c,0x43,0xd0,0x0d,0x30,0x0e,0x09,0x0c,0x20,0x02,0x2a,0xea,0xd1,0x03,0x02,0x07,
+0x00,0x91,0x8d,0x4c,0xee,0xee,0xee,0xe1,0x00,0x22,0xc2,0x39,0x09,0xf0,0x00,0x0c,
+0x2d,0xcd,0xbb,0xb0,0x5d,0x40,0xd2,0xd0,0x00,0x1c,0x00,0x29,0x0e,0x0f,0x2c,0x0b,
+0x20,0x00,0xe0,0x0d,0x00,0xf2,0x55,0x06,0x1e,0x0b,0xbf,0xbb,0x90,0x00,0xe4,0xc0,
+0x60,0xe0,0x52,0x00,0x79,0x77,0x5c,0x0e,0x04,0xa0,0x1e,0x2d,0x3e,0x30,0xe0,0x0a,
+0x12,0x72,0x80,0x01,0xdc,0x00,0x00,0x01,0xa3,0x06,0x72,0x70,0x00,0x00,0x03,0xb2,
+0xf9,0x8f,0x87,0x50,0x07,0x21,0xdc,0x44,0xe4,0x43,0x00,0x5c,0x7a,0xea,0xaf,0xaa,
+0x30,0x00,0x04,0x3c,0x33,0xe3,0x31,0x00,0x06,0xb3,0xd5,0x5f,0x55,0x20,0x06,0xc0,
+0x3e,0xbb,0xfb,0xba,0x00,0x51,0x03,0xa6,0x11,0x11,0x10,0x03,0x33,0x33,0xe3,0x33,
+0x33,0x10,0xaa,0xaa,0xaf,0xba,0xaa,0xa5,0x00,0x00,0x00,0x1e,0x0a,0x01,0x48,0x06,
+0x02,0xf2,0x00,0xf4,0x11,0x7e,0x44,0xeb,0xcb,0xce,0x00,0x00,0x23,0x49,0x0a,0x10,
+0xe0,0x00,0x00,0x04,0x94,0xb9,0x0e,0x00,0x5d,0x50,0x49,0x70,0x35,0xe0,0x00,0x18,
+0x03,0xcb,0xbb,0xcb,0x00,0x9b,0x04,0xf0,0x05,0x2c,0xde,0xde,0xde,0x50,0x00,0xc3,
+0xc1,0x92,0x92,0x85,0x00,0x4c,0x0c,0x19,0x29,0x28,0x50,0x0c,0x50,0x0d,0x00,0x77,
+0x02,0xc0,0xcf,0xef,0xef,0xef,0xe3,0x1d,0x04,0x00,0x8b,0x02,0xb0,0x70,0xad,0xcc,
+0xce,0x00,0x00,0x06,0x0a,0xba,0x90,0xe0,0x04,0x08,0xf4,0x29,0x0c,0x0e,0x00,0x0d,
+0x60,0xed,0xcc,0xdc,0xdd,0x40,0x1b,0x4e,0x00,0x00,0x00,0x94,0x00,0x00,0x4b,0xcc,
+0xcc,0xf2,0x10,0x00,0x60,0xb7,0x66,0x6f,0x00,0x00,0x5a,0x0b,0x64,0x44,0xf0,0x00,
+0x0d,0x20,0xbc,0xbb,0xbf,0x00,0x06,0xa0,0x0b,0x20,0x00,0xe0,0x00,0x52,0x00,0xb2,
+0x03,0xcc,0x00,0x00,0xd1,0x03,0xf1,0x3b,0x0c,0x57,0x66,0xc0,0x00,0x4e,0x40,0xc5,
+0x77,0x6c,0x00,0x00,0x37,0xcf,0xde,0xee,0xfc,0x40,0x00,0x04,0xa5,0x98,0x6c,0x14,
+0x3d,0x41,0xb1,0x27,0x72,0x69,0x20,0x18,0x0c,0xcc,0xcc,0xcc,0xc1,0x00,0x00,0xd0,
+0x06,0x70,0x0b,0x10,0x0b,0x25,0xcc,0xee,0xcc,0x70,0x01,0xd0,0x2b,0x06,0x70,0x94,
+0x00,0x88,0x02,0xb0,0x67,0x09,0x40,0x0e,0x20,0x2b,0x06,0x79,0xd2,0x00,0x40,0x00,
+0x00,0x67,0x1f,0x04,0xf0,0x00,0x0b,0x00,0x00,0x00,0x2c,0xac,0xcc,0xed,0xcc,0xc3,
+0x00,0x02,0x04,0x50,0x07,0x63,0x00,0xf0,0x01,0xc0,0x00,0x5c,0x20,0x3d,0x57,0xdd,
+0xbb,0xbb,0xcb,0x00,0x29,0x03,0x80,0x00,0x0c,0x17,0x09,0x00,0x9a,0x01,0xf1,0x20,
+0x07,0x30,0x1b,0x6c,0x02,0x80,0x00,0xd2,0x8e,0x30,0x6a,0xc2,0x00,0x69,0x86,0xd0,
+0x00,0xc7,0x00,0x0d,0x20,0x0e,0x8a,0x60,0xab,0x20,0x40,0x00,0x95,0x10,0x00,0x30,
+0x07,0x60,0x02,0xc0,0x06,0x80,0x00,0x1a,0x9d,0xef,0xdd,0xee,0xd8,0x00,0x00,0x0d,
+0x00,0xf0,0x3d,0x10,0x00,0x2f,0xdd,0xe8,0x00,0x2d,0x80,0x00,0x05,0x90,0x00,0x00,
+0x08,0x0b,0xdd,0xee,0xdd,0xe3,0x00,0x00,0xc3,0x34,0x96,0x0a,0x30,0x02,0x7c,0x1a,
+0x49,0x65,0xa3,0x00,0xa4,0xc4,0xe7,0x9a,0xaa,0x30,0x2d,0x0c,0xa4,0xcc,0x78,0xc3,
+0x0b,0x50,0xc2,0x05,0x90,0x0a,0x30,0x70,0x0c,0x00,0x48,0x0a,0xd1,0x08,0x30,0x0a,
+0x20,0x00,0x38,0x20,0x2c,0x7c,0xec,0xc4,0xd9,0x40,0x00,0x00,0x0a,0x20,0x49,0x6c,
+0x05,0xf3,0x29,0xeb,0x84,0x90,0x00,0x3c,0x24,0x58,0x0a,0x4e,0xbb,0x50,0x37,0x4c,
+0xda,0xc4,0x92,0xb0,0x00,0x04,0x58,0x0a,0x58,0x1b,0x00,0x06,0x5b,0xdb,0xa6,0x71,
+0xb0,0x00,0xc0,0x0a,0x20,0x75,0x1b,0x00,0x58,0x8c,0xed,0xcc,0x21,0xb0,0x0c,0x10,
+0x0a,0x21,0xd0,0x1b,0x00,0x60,0x00,0xa2,0x25,0x01,0xb0,0x3f,0x01,0xf0,0x45,0xa1,
+0x00,0xe1,0x01,0xb0,0x00,0x03,0xd5,0xbf,0xb6,0x49,0x00,0x00,0x01,0x56,0x04,0x87,
+0xb7,0x73,0x00,0x05,0xda,0xc8,0xb9,0x8e,0x33,0xc2,0x56,0x04,0xaf,0x42,0xa0,0x03,
+0x74,0xbd,0xbc,0xc7,0x48,0x00,0x00,0x46,0xe5,0x51,0xb8,0x50,0x00,0x66,0xc8,0x66,
+0x0c,0xc0,0x00,0x1c,0x0b,0xdc,0x50,0x7b,0x00,0x08,0x60,0xd0,0x66,0x0b,0xe1,0x00,
+0xd1,0x59,0x08,0x56,0x95,0xa0,0x28,0x2d,0x1b,0xd5,0xb0,0x09,0x50,0x00,0x00,0x00,
+0x00,0x00,0x00,0xf2,0x40,0x07,0x50,0x00,0x0a,0x30,0x00,0x00,0x4d,0x70,0x00,0xab,
+0xaa,0x50,0x00,0x01,0xab,0xbe,0xcb,0xbc,0x30,0x10,0x0c,0x34,0xc8,0x83,0xc0,0x3e,
+0x70,0xc4,0x5b,0x74,0x55,0x00,0x19,0x0c,0x10,0x27,0x77,0x10,0x00,0x00,0xd2,0xd8,
+0xe9,0xb6,0x00,0x05,0x1d,0x1d,0x7d,0x8a,0x60,0x00,0xd1,0xd1,0xd9,0xe9,0xb6,0x00,
+0x4b,0x3a,0x11,0x4c,0x33,0x20,0x0b,0x48,0x6a,0x4c,0x03,0x7c,0x00,0xc0,0xc2,0xa0,
+0xbb,0xb7,0x43,0x00,0x01,0x00,0xf6,0x3f,0x05,0x00,0x50,0x05,0x00,0x50,0x01,0xaa,
+0x55,0x46,0xd6,0x65,0x40,0x00,0x27,0xb3,0x8b,0x97,0xc3,0x00,0x00,0x7a,0xb5,0x86,
+0x8b,0xb0,0x4d,0x35,0x35,0x68,0x65,0x35,0x00,0x36,0x98,0x8a,0x1a,0x98,0x80,0x00,
+0x05,0x41,0x57,0x65,0x52,0x00,0x05,0x19,0x99,0x99,0x9e,0x10,0x02,0xc0,0x99,0x88,
+0x88,0xb1,0x00,0x96,0x1f,0xaa,0xaa,0xaa,0x60,0x0e,0x10,0x00,0x00,0x00,0x86,0x02,
+0x70,0x00,0x00,0x3b,0xbc,0x00,0x01,0x00,0x11,0xf0,0x06,0x00,0x10,0x0e,0x05,0x00,
+0xf0,0x15,0x24,0x01,0xe0,0x00,0x23,0x00,0x09,0x70,0x2d,0x00,0x0a,0x70,0x00,0xe2,
+0x04,0xc0,0x01,0xe1,0x00,0x8a,0x00,0x7f,0x00,0x97,0x00,0x04,0x10,0x0b,0xe5,0x04,
+0x00,0x00,0x00,0x02,0xe3,0xd0,0x28,0x00,0xf0,0x07,0xc7,0x09,0x90,0x00,0x00,0x00,
+0xbb,0x00,0x0c,0xb1,0x00,0x06,0xe9,0x00,0x00,0x09,0xe9,0x10,0x82,0x00,0x00,0x00,
+0x5a,0x00,0x21,0x00,0xe0,0x4e,0x00,0xa4,0x0f,0xbb,0xbb,0x80,0x00,0x00,0x00,0xf3,
+0x33,0x32,0x5b,0x00,0x51,0xde,0xee,0xfe,0xee,0xd0,0x0b,0x00,0x11,0x1e,0x25,0x00,
+0xa0,0x01,0xe0,0x00,0x0e,0xee,0xee,0xee,0xee,0x00,0x00,0x96,0x00,0xf4,0x06,0x20,
+0x00,0x2d,0x06,0x70,0xa4,0x0d,0x30,0x0c,0x50,0x5a,0x04,0xb0,0x3d,0x03,0x80,0x02,
+0x70,0x08,0x00,0x71,0xa1,0x00,0xf0,0x02,0xa4,0x00,0xb4,0x00,0x00,0x00,0x04,0xc0,
+0x2e,0x00,0x00,0x00,0x6d,0xde,0xde,0xfd,0xd3,0x0e,0x00,0x71,0xe1,0x0d,0x10,0x00,
+0x00,0x01,0xe8,0x70,0x00,0xfb,0x1d,0xae,0xcc,0xcc,0xe3,0x00,0x00,0x8d,0x10,0x00,
+0x0d,0x00,0x01,0xcf,0xed,0xdd,0xdd,0xee,0x22,0xea,0x20,0x01,0x04,0x10,0xd1,0x03,
+0x86,0x75,0x66,0x39,0x0e,0x00,0x1d,0x05,0x71,0xb0,0x43,0xc0,0x06,0x40,0x13,0x00,
+0x3d,0xd5,0x00,0x01,0x00,0x10,0x69,0x05,0x00,0x60,0xac,0xce,0xdc,0xcc,0x00,0x00,
+0x51,0x00,0x10,0xd1,0x03,0x00,0x00,0x0a,0x00,0xf4,0x24,0x0d,0xcc,0xcc,0xcc,0xc0,
+0x00,0x00,0xd6,0x55,0x55,0x55,0x55,0x00,0x0d,0x65,0x55,0x55,0x55,0x50,0x00,0xdc,
+0xcc,0xcc,0xcc,0xc6,0x00,0x23,0x11,0x22,0x34,0x08,0x70,0x08,0x66,0x64,0x91,0xc0,
+0x96,0x01,0xd1,0x48,0x0d,0x04,0x0b,0x40,0x55,0x01,0x30,0x10,0x8c,0xc0,0x53,0x00,
+0x20,0x07,0x10,0x06,0x00,0xf0,0x20,0x06,0xd2,0x22,0x22,0x22,0x20,0x03,0xed,0xbe,
+0xbf,0xbd,0xd9,0x02,0xeb,0x62,0xa0,0xc0,0x77,0x00,0x03,0x87,0x3b,0x1d,0x18,0x81,
+0x00,0xad,0xdc,0xec,0xfc,0xdd,0xa0,0x00,0x76,0x2a,0x0c,0x07,0x70,0x00,0x07,0x72,
+0xb0,0xd0,0x77,0x00,0x2d,0xdd,0x01,0x00,0xf0,0x06,0x20,0x07,0x02,0x20,0x40,0x08,
+0x00,0x05,0xb0,0x68,0x09,0x60,0x98,0x01,0xe2,0x04,0xa0,0x4b,0x00,0xe2,0x01,0x4c,
+0x00,0x61,0x01,0x00,0x00,0x09,0x10,0x75,0x04,0x01,0x20,0x03,0xd0,0x4c,0x01,0xf1,
+0x04,0xdd,0xef,0xdd,0xd9,0x00,0xbf,0x30,0x02,0xc0,0x00,0x00,0x8b,0xcd,0xcc,0xdf,
+0xcc,0xb0,0x00,0x0b,0x0d,0x00,0x65,0x00,0xbd,0xcc,0xdf,0xcc,0xc0,0x0d,0x00,0xf4,
+0x09,0xdd,0xdd,0xdd,0xd7,0x00,0x1a,0x14,0x00,0x40,0x17,0x00,0x08,0x80,0xd1,0x09,
+0x60,0xc5,0x02,0xd1,0x0b,0x30,0x4a,0x02,0xe0,0x55,0x00,0x12,0x01,0xb1,0x00,0xf6,
+0x3e,0xe2,0x00,0x02,0xc7,0x20,0x00,0x5f,0xdd,0x80,0x2c,0x3d,0x00,0x0c,0x40,0x87,
 0x02,0xc0,0x50,0x08,0xa8,0x7c,0x8e,0xff,0xee,0x63,0xd3,0x08,0xb0,0x06,0xf1,0x00,
-0x01,0x9a,0xd2,0x00,0xcd,0x70,0xa8,0x7e,0xf7,0x14,0x6d,0x1d,0x00,0x04,0xd6,0x00,
+0x01,0x9a,0xd2,0x00,0xcd,0x70,0x00,0x01,0xd6,0x00,0x6d,0x1d,0x00,0x04,0xd6,0x00,
 0x7d,0x20,0x7b,0x10,0x92,0x00,0x7a,0x10,0x00,0x75,0x00,0x90,0x23,0x04,0x30,0x82,
-0x00,0x79,0x05,0x90,0x5a,0x04,0xd0,0x2d,0x00,0x49,0x00,0xd0,0x09,0xe4,0x48,0x11,
-0x20,0x4c,0x12,0x20,0x0e,0x20,0x9e,0x17,0x00,0xf3,0x22,0xf0,0x10,0x26,0x84,0x3e,
-0x00,0x02,0xb0,0x0b,0x68,0xb2,0xfa,0xaa,0xbb,0x00,0xb6,0xaa,0x0e,0x44,0x46,0xb0,
-0x46,0x67,0x10,0xe5,0x55,0x7b,0x00,0x07,0x60,0x0f,0xbb,0xbc,0xaa,0x0c,0x01,0x65,
-0x42,0xf6,0x0a,0xd6,0x23,0x48,0x91,0x30,0x03,0xc1,0x8c,0x67,0x02,0x1c,0x10,0xc5,
-0x02,0xb6,0x70,0x0b,0x67,0x49,0x00,0x23,0x3d,0xcc,0xb0,0x50,0x10,0x77,0xf0,0x18,
-0x73,0x00,0x00,0x0a,0x01,0xde,0xa4,0x9c,0x10,0x00,0xa0,0x36,0x93,0x0d,0x38,0x00,
-0x9a,0x63,0xad,0x33,0x8e,0x50,0x18,0xb9,0x6d,0x67,0x76,0x8c,0x14,0x4b,0x17,0x8c,
-0xcc,0xcc,0x40,0x00,0xb0,0x08,0x50,0xec,0x5d,0x40,0x00,0x8b,0x99,0x9f,0x63,0x47,
-0xf5,0x07,0x82,0x27,0x50,0x00,0x55,0xa1,0x0d,0x00,0xc3,0x00,0x0b,0x14,0x30,0x94,
-0x2d,0x00,0x04,0x80,0x0a,0xde,0xde,0xed,0xdf,0x43,0x30,0x01,0x6b,0x60,0x8a,0x06,
-0xf6,0x03,0xf7,0xd0,0xcc,0xcc,0xa0,0x0c,0x1d,0x0c,0x0d,0x0a,0x0d,0x00,0xc1,0xd0,
-0xc0,0xd0,0xa0,0xd0,0x0d,0x00,0x40,0xfd,0xdd,0xa0,0x0c,0xb1,0x65,0xf0,0x02,0x01,
-0x00,0xd0,0xd0,0xb2,0xe0,0x00,0xb2,0x0d,0x0d,0x06,0x8a,0xdd,0xda,0x01,0xc0,0xd0,
-0x99,0x31,0xd6,0x58,0x0d,0x00,0x2d,0xa4,0x00,0x0a,0x20,0xd0,0x00,0x06,0xbe,0xe3,
-0x68,0x37,0x11,0x1e,0x8b,0x0e,0x06,0x06,0x00,0x71,0xdc,0xbb,0xcf,0xbb,0xb5,0x00,
-0xd5,0xbc,0x72,0x02,0x12,0x15,0x70,0xf5,0x44,0x44,0x42,0x00,0x00,0xfb,0xdb,0x17,
-0x20,0x03,0xc0,0x9d,0x3e,0x20,0x08,0x80,0x06,0x00,0x20,0x2e,0x10,0x06,0x00,0x14,
-0x66,0xaf,0x3e,0x20,0x00,0x00,0x2f,0x29,0x90,0x57,0x8a,0xda,0x00,0xc1,0xb2,0x0e,
-0x86,0x41,0x0d,0x00,0x10,0xe0,0x7d,0x46,0x11,0xc5,0xd1,0x6f,0x50,0xba,0xa5,0xef,
-0xee,0xeb,0x49,0x6b,0xf3,0x19,0x93,0x05,0x80,0x0e,0xcc,0x70,0xe4,0x80,0xa4,0x00,
-0xe1,0x79,0x1d,0x0d,0x2d,0x00,0x0d,0x06,0x92,0xc0,0x7e,0x50,0x04,0xb0,0x69,0x5a,
-0x07,0xf3,0x00,0x87,0x06,0x9b,0x67,0xd5,0xe4,0x09,0x10,0x69,0xc5,0xb1,0xe0,0x73,
-0x02,0xa3,0x51,0x42,0xff,0xeb,0x00,0x00,0x66,0x1c,0x10,0x4b,0xda,0x2c,0x00,0x90,
-0x1c,0x00,0x0d,0x00,0x10,0xdf,0x82,0x2d,0x00,0xe2,0x0c,0x21,0xdb,0x70,0x03,0x76,
-0x10,0x87,0x89,0x10,0x10,0xd2,0x1a,0x00,0x20,0x5d,0xa1,0x27,0x00,0x50,0xcc,0x40,
-0x00,0x09,0x70,0xe6,0x00,0x26,0x8e,0xe3,0x74,0x5e,0x00,0xd1,0x0e,0xf0,0x02,0x00,
-0xa4,0xd0,0x2b,0xbe,0xcb,0x90,0x0b,0x8e,0x50,0x33,0xb6,0x32,0x00,0xda,0xf9,0x00,
-0xc8,0x5a,0x81,0x1d,0x0d,0xee,0xfe,0xee,0x52,0x51,0xd0,0x1d,0x23,0xf0,0x03,0x4f,
-0xd8,0xbb,0xbb,0xfb,0x31,0xed,0xe1,0x26,0x32,0x4d,0x21,0x02,0x1d,0x00,0xa6,0x01,
-0xc0,0xc1,0x09,0x20,0xd1,0x1c,0x41,0x00,0x12,0x01,0x0d,0x00,0x06,0xfa,0x47,0x00,
-0x0b,0x36,0x11,0x01,0x47,0x13,0x21,0xe2,0xd1,0xdf,0x6d,0x50,0x05,0xc0,0x0e,0x12,
-0xd0,0xdf,0x6d,0x90,0xac,0xcd,0xaf,0xff,0xff,0xf5,0x00,0x01,0xd0,0x39,0x78,0x20,
-0x33,0x4d,0xc2,0x78,0xfc,0x12,0x2c,0xdb,0xd0,0x08,0xcc,0x00,0x00,0x77,0x1d,0x00,
-0xd3,0xd2,0x00,0x09,0x51,0xd0,0x7c,0x06,0xb0,0x00,0xe1,0x1d,0x5e,0x20,0x0c,0xa0,
-0x25,0x01,0xec,0x20,0x00,0x1a,0x30,0x6b,0x31,0x00,0x22,0x63,0x01,0xdf,0x47,0xf3,
-0x18,0x50,0x22,0x00,0x78,0x06,0x02,0x30,0x02,0xd6,0x5e,0x8c,0x63,0xd3,0x00,0x00,
-0x54,0x6d,0x80,0x51,0x00,0x00,0x29,0x39,0x75,0x99,0x60,0x00,0x9c,0x4b,0xfd,0xce,
-0x5a,0xa0,0x02,0x00,0x21,0x92,0x11,0x04,0x4c,0x59,0x04,0xf9,0x47,0x04,0xb6,0x55,
-0x13,0xc3,0x00,0x34,0x00,0x52,0x01,0xf0,0x00,0xed,0x00,0xc9,0xef,0xd8,0x00,0x94,
-0x01,0x0c,0x00,0xe0,0x00,0x09,0x40,0xd0,0x87,0x29,0x20,0x94,0x0d,0x0d,0x00,0x20,
-0x9d,0xb6,0x0d,0x00,0xc0,0x04,0xb8,0x6a,0x1c,0x6d,0xfd,0x50,0x09,0x42,0x42,0xb0,
-0x0e,0xec,0x07,0x60,0x68,0x00,0xe0,0x00,0x0a,0xa8,0x94,0x60,0xc5,0x2e,0xb7,0x38,
-0xa0,0x22,0xe2,0x20,0x00,0x08,0xa0,0x3c,0xcc,0x5a,0x08,0x00,0xb7,0x73,0x50,0x11,
-0x04,0xdf,0xed,0x6e,0x4e,0x1c,0x70,0x86,0x04,0x90,0x00,0x2c,0x00,0x08,0x00,0x3f,
-0xd5,0xc0,0x16,0xba,0x64,0x90,0x00,0x2c,0x01,0x7b,0xa7,0x4e,0xcc,0xcd,0x1a,0x00,
-0xf4,0x10,0x61,0x4d,0xfc,0xfc,0xa0,0x03,0xbe,0xd2,0x4a,0x0e,0x00,0x06,0xc7,0x20,
-0x09,0x60,0xe0,0x11,0x00,0x00,0x07,0xc0,0x0e,0x04,0x80,0x00,0x0d,0xa1,0x00,0xad,
-0xe4,0xfb,0x46,0x90,0xff,0xc8,0xed,0xfd,0xdf,0x00,0x08,0x60,0x84,0x04,0x29,0x80,
-0x86,0x08,0xdc,0xfc,0xcf,0x00,0x29,0x71,0x0d,0x00,0x50,0x0d,0xee,0x98,0x61,0xd1,
-0x79,0x53,0x61,0x5b,0xbf,0xbb,0xb0,0x00,0x86,0xd3,0x0f,0x30,0x08,0x86,0x9e,0x47,
-0x18,0x82,0xdf,0x90,0x00,0xe1,0x00,0x02,0xd6,0x10,0x15,0x1b,0x31,0x8e,0xee,0xfe,
-0x7f,0x36,0x00,0x25,0x2b,0x41,0xef,0xe1,0xd0,0x1c,0xc5,0x21,0x50,0x01,0xc0,0x0e,
-0x00,0x1d,0xe1,0x17,0x30,0xc0,0x01,0xe0,0xa0,0x3c,0x82,0x06,0xdf,0xd8,0xcc,0xde,
-0xcc,0xc4,0x01,0xa1,0x38,0xf0,0x06,0x1d,0x02,0xfd,0xfd,0xfd,0xf1,0x01,0xd1,0x2b,
-0x0c,0x0c,0x0c,0x13,0x8f,0xc4,0xb0,0xc0,0xc0,0xc1,0x46,0x10,0x0d,0x00,0x64,0x10,
-0x00,0x02,0xb0,0xb0,0xb8,0x93,0x02,0xf0,0x0e,0x39,0x99,0x0f,0xae,0xae,0xad,0x00,
-0x0c,0x00,0xe9,0xe9,0xe9,0xd0,0x00,0xc0,0x25,0x55,0x55,0x55,0x11,0x7e,0x64,0x88,
-0x88,0x88,0x82,0x17,0xe6,0x07,0x4f,0x1c,0x30,0x0c,0x00,0xa3,0x17,0x1f,0xf0,0x0e,
-0xc0,0x0a,0xcb,0xbb,0xd7,0x00,0x0d,0x50,0x08,0x98,0x62,0x90,0x4b,0xd8,0x9c,0xb0,
-0x0c,0xb2,0x02,0x20,0x01,0x2c,0x79,0x2d,0x71,0x00,0x00,0x04,0x84,0xbd,0x0d,0x30,
-0x09,0x10,0xc2,0xe2,0x02,0x20,0xf0,0x0c,0x2a,0x16,0x71,0x8b,0x22,0xd4,0x22,0x22,
-0x00,0x1f,0x44,0x42,0x21,0x0b,0x90,0xa0,0x35,0x01,0x1d,0x3a,0x00,0x6d,0x3c,0x92,
-0xfd,0xcc,0xc4,0x00,0x01,0x11,0x1d,0x41,0x11,0xa9,0x6a,0x02,0xf0,0x35,0x03,0xb6,
-0x6a,0x03,0x1e,0x67,0x22,0xe6,0x00,0x57,0x5b,0x00,0x3f,0x62,0x13,0x3b,0x06,0x00,
-0x11,0xfe,0xb0,0x47,0x07,0x12,0x00,0x10,0x01,0x12,0x00,0x50,0xfb,0x03,0xb0,0x00,
-0xe0,0xcb,0x76,0x00,0x06,0x00,0x10,0x0d,0xad,0x09,0x74,0x4b,0x59,0x00,0x00,0xe0,
-0x8d,0xe7,0xe3,0x19,0x40,0xcd,0xfc,0xcd,0xd0,0x41,0x1c,0x00,0x4f,0x50,0x45,0xeb,
-0xbb,0xfb,0xbc,0x0d,0x00,0xf0,0x0d,0xbc,0xef,0xcf,0xec,0xb0,0x00,0x00,0x5d,0x20,
-0x2d,0x40,0x00,0x04,0xbc,0x80,0x00,0x9c,0xb5,0x01,0xb4,0x0f,0x00,0x0e,0x13,0xa1,
-0x00,0x03,0xd0,0x88,0x01,0x21,0x02,0xd6,0xbc,0x3c,0x24,0xe6,0x00,0xb2,0x3c,0x06,
-0x21,0x02,0x00,0x82,0x2c,0xf0,0x28,0xec,0xed,0x60,0xae,0xcc,0xc2,0xc0,0xa5,0x65,
-0xf4,0x15,0xd0,0xc0,0xa5,0x9e,0x6b,0x1d,0x40,0xc0,0xa5,0x73,0x0a,0xd8,0x00,0xeb,
-0xed,0x60,0x4c,0xca,0x20,0xc0,0xa5,0x9c,0x91,0x04,0xc8,0xc0,0xa5,0x74,0xdd,0xdd,
-0xc1,0xc3,0xb7,0x63,0xa0,0x00,0xe0,0xe8,0x88,0x33,0xa0,0x00,0xe0,0x80,0xd9,0x57,
-0x11,0xe0,0xa2,0x43,0xf0,0x09,0xe0,0x00,0xcc,0xbb,0xfc,0xbb,0xe3,0x00,0x0c,0x64,
-0x4e,0x64,0x4d,0x30,0x00,0xc6,0x44,0xe5,0x44,0xd3,0x00,0x0c,0xcc,0xcf,0x05,0x19,
-0x20,0x00,0xf0,0x91,0x28,0x60,0x3c,0xcf,0xcc,0xce,0xdc,0x90,0x0d,0x00,0x11,0xa6,
-0xc4,0x11,0x10,0x0a,0xca,0x63,0x00,0x01,0x00,0xa0,0x60,0x00,0x5d,0x40,0x0c,0xa4,
-0x00,0x08,0xd9,0x20,0x79,0x77,0x11,0x10,0xea,0x0a,0x70,0x07,0x30,0x0e,0x00,0x57,
-0x00,0x4c,0x01,0x18,0x61,0xdd,0xed,0xde,0xdd,0xed,0xde,0x66,0x08,0x70,0xc0,0xeb,
-0xbb,0xbb,0xe0,0xd0,0x0e,0xcc,0x32,0x51,0x00,0x78,0x88,0x88,0x70,0x6a,0x51,0x30,
-0xb1,0x0d,0x00,0x54,0x55,0x00,0x41,0x40,0x12,0xe2,0x0b,0x00,0x51,0xfc,0xcc,0xfc,
-0xcc,0xe2,0xd3,0x26,0xf0,0x0e,0x50,0x00,0x05,0xb7,0x7e,0x77,0xb5,0x00,0x07,0x88,
-0x88,0x18,0x88,0x87,0x00,0xc7,0xd7,0xd2,0xd7,0xd7,0xd0,0x0c,0x7d,0x7d,0x2d,0x7d,
-0x7d,0x00,0x46,0xa7,0x4a,0xf0,0x04,0x40,0x0b,0x75,0x55,0x55,0x55,0x7b,0x00,0x61,
-0xe9,0x99,0x99,0xf1,0x60,0x00,0x0e,0x77,0x77,0x7e,0xd9,0x33,0xb0,0x88,0x88,0xf0,
-0x00,0x2a,0xaf,0xaa,0xaa,0xaf,0xaa,0x20,0x37,0x65,0x80,0x04,0x00,0x00,0x4c,0xce,
-0x86,0x88,0xa1,0x44,0x38,0xf0,0x04,0x09,0xc1,0xa7,0x00,0x1b,0xc1,0x00,0x06,0xe8,
-0x00,0x6d,0xcc,0xe2,0xcc,0xce,0x9d,0x11,0x00,0x0a,0xda,0x0e,0xf0,0x02,0x04,0xdb,
-0xca,0x90,0x0c,0xb7,0x00,0x75,0x00,0x35,0x55,0x54,0x00,0x09,0xdc,0xc4,0xa6,0x47,
-0x7a,0x40,0x0c,0x29,0xa5,0xd1,0xd6,0x08,0xab,0x2b,0xf9,0x00,0x00,0x2c,0xd8,0x8b,
-0x50,0x7b,0x00,0xbf,0x63,0x13,0xc0,0xdc,0x38,0x01,0x9e,0x32,0x30,0xf1,0x1d,0x00,
-0x91,0x49,0x10,0xd0,0x77,0x3e,0x02,0x0b,0x00,0x0f,0x16,0x00,0x0b,0x00,0x6a,0x08,
-0x60,0xd2,0x00,0x49,0x00,0x00,0x3d,0x48,0x15,0x30,0xce,0xfd,0xb0,0xdd,0x0e,0x50,
-0x0d,0x5a,0x00,0x0e,0xd0,0x7b,0x3c,0xf0,0x08,0xed,0x00,0x0d,0x35,0x30,0x0d,0xdd,
-0xdd,0xd0,0x3d,0x01,0xdd,0x00,0x0d,0x00,0x88,0x2c,0xd0,0x00,0xd0,0x00,0x73,0xbd,
-0x0d,0x22,0x10,0x59,0x50,0x22,0x20,0x08,0x7d,0x6e,0x1c,0x01,0x5a,0x55,0x11,0x10,
-0x74,0x57,0x10,0x06,0x63,0x11,0x00,0x2e,0x02,0xa1,0x01,0x12,0xc3,0x11,0xa5,0x11,
-0x00,0xab,0xbb,0xbb,0x92,0x76,0x10,0x71,0x31,0x07,0xf3,0x10,0x04,0xc6,0x00,0x04,
-0xbc,0x50,0x08,0xb3,0x11,0x11,0x11,0x39,0x10,0x07,0xdc,0xfc,0xdd,0xcf,0x00,0x00,
-0x76,0x0e,0x07,0x60,0xe0,0x00,0x07,0x60,0xe0,0x76,0x0e,0x0d,0x00,0x73,0x01,0xde,
-0xed,0xfd,0xee,0xdf,0xd8,0x24,0x69,0xf0,0x0b,0xbc,0xdd,0xc6,0x1d,0x00,0x00,0x0b,
-0xbc,0xda,0x26,0xca,0xaa,0x60,0xb2,0x00,0x85,0xd0,0x10,0x00,0x0b,0xbb,0xbc,0x64,
-0x3d,0x30,0x00,0xfa,0x40,0xb0,0x2d,0x30,0x07,0xaa,0xaa,0x70,0x00,0x10,0x00,0x06,
-0xaa,0x6b,0x6d,0xf0,0x0b,0x00,0xa5,0x5b,0x2b,0x62,0xf0,0x00,0x0a,0x32,0xa0,0xa4,
-0x0f,0x00,0x00,0xa3,0x2a,0x0a,0x40,0xf0,0x01,0xdf,0xee,0xfd,0xfe,0xdf,0xd8,0x78,
-0x5d,0x00,0xd8,0x20,0xf1,0x37,0xcb,0xb0,0xdb,0xd7,0x00,0x07,0x57,0x0c,0x1c,0x05,
-0xa4,0x00,0x74,0x51,0xca,0x40,0x06,0x70,0x7d,0xcb,0xbc,0x6d,0xbb,0xe1,0x00,0xb2,
-0x90,0xc0,0xa6,0xa7,0x00,0x2b,0x03,0x2c,0x38,0xee,0x61,0x07,0x30,0x2a,0x79,0x40,
-0x16,0xb0,0x00,0xfc,0xed,0xcf,0xcd,0x90,0x00,0x0d,0x07,0x60,0xe0,0x49,0x00,0x00,
-0xd0,0x76,0x0e,0x04,0x90,0x07,0xcf,0xce,0xec,0xfc,0xde,0xc1,0x56,0x68,0x00,0x5c,
-0x07,0x00,0x46,0x0a,0x01,0x87,0x16,0x01,0x09,0x00,0x01,0xc7,0x1e,0x03,0x95,0x16,
-0x02,0x1b,0x00,0x00,0x06,0x5c,0x02,0x6a,0x0a,0x09,0x5a,0x37,0x01,0x73,0x4d,0x13,
-0x20,0x27,0x34,0x50,0x3d,0xdd,0xed,0xdd,0xb0,0x92,0x12,0x00,0x0f,0x00,0x11,0x4e,
-0xb3,0x21,0x0d,0x0d,0x00,0x10,0x3c,0x0d,0x00,0x00,0xee,0x0c,0x80,0x26,0xb2,0x22,
-0x22,0x4d,0x21,0x1b,0xbb,0x01,0x00,0x15,0x60,0x83,0x70,0x10,0x0a,0x47,0x59,0xf1,
-0x18,0x0e,0x00,0xa4,0x00,0x0d,0x11,0xdd,0xfd,0xaa,0x40,0x00,0xd1,0x00,0x5f,0x00,
-0xae,0xdd,0xdf,0x10,0x0b,0xf6,0x0a,0x40,0x00,0xd1,0x01,0xbe,0xb4,0xa4,0x00,0x0d,
-0x10,0x94,0xe1,0x8a,0xed,0xdd,0xf1,0x3c,0x27,0x00,0x60,0x10,0x20,0xe0,0x0a,0x40,
-0x00,0xc6,0x12,0xa0,0xae,0xee,0xef,0x10,0x00,0xe0,0x09,0x30,0x00,0xc1,0xaa,0x04,
-0xf0,0x0b,0x35,0x70,0x00,0x3b,0xcc,0xfc,0xa8,0x74,0x00,0x01,0x66,0x6e,0x86,0x66,
-0x62,0x00,0x14,0x49,0xb4,0x44,0x44,0x20,0x2c,0xcd,0xfe,0xcc,0x7a,0x3a,0x12,0x8b,
-0xb5,0x61,0xf1,0x08,0xdc,0xcc,0xcc,0xe0,0x00,0x6e,0xc9,0x66,0x66,0x6e,0x00,0x3c,
-0x19,0x73,0x33,0x34,0xe0,0x00,0x00,0x9c,0xaa,0xaa,0xae,0xa7,0x54,0x00,0xea,0x00,
-0x53,0x9d,0xbb,0xbb,0xbe,0x00,0x6b,0x1b,0x10,0xbd,0x7b,0x53,0xf1,0x18,0xc0,0x00,
-0x12,0x25,0xc2,0x22,0x10,0x00,0x05,0xc7,0x77,0x77,0xc6,0x00,0x00,0x5d,0x99,0x99,
-0x9d,0x60,0x00,0x05,0xa3,0x33,0x33,0xa6,0x00,0x00,0x5b,0x55,0x55,0x5b,0x60,0x00,
-0x05,0xd9,0x99,0x99,0xd6,0x0b,0x0b,0x20,0x09,0x70,0x07,0x7d,0xb0,0xbc,0xbb,0xb2,
-0x00,0x17,0xc1,0x00,0xc9,0x30,0x00,0xad,0x15,0x08,0x26,0xc0,0x01,0xd5,0x27,0xf0,
-0x2c,0x35,0x40,0xfd,0xf4,0xcb,0xcb,0x86,0x30,0xc0,0xc0,0x94,0x3a,0x09,0x40,0xc2,
-0xd1,0x5a,0x2b,0x4c,0x20,0xea,0xe6,0xc9,0x99,0x9a,0xd3,0xc0,0xc5,0xb7,0x00,0x0c,
-0x72,0xfd,0xf0,0xb8,0xe9,0xae,0xa0,0xc0,0xc5,0x81,0xc9,0x1c,0x00,0xc0,0xc9,0x7b,
-0x7c,0x3d,0x30,0xfd,0xd0,0x1d,0x07,0x8e,0x80,0xc0,0x01,0xc3,0x1d,0x07,0x20,0x09,
-0x30,0x06,0x00,0x12,0x81,0x47,0x36,0x00,0xfe,0x43,0xe0,0x06,0xff,0xfe,0x7a,0x74,
-0x4f,0x0e,0x37,0x70,0x0a,0x40,0x0f,0x16,0x07,0x06,0x00,0xf0,0x00,0x2d,0xde,0xed,
-0xca,0x40,0x0f,0x00,0x0a,0x60,0x0a,0x40,0x0f,0x00,0x0c,0xa0,0x06,0x00,0x20,0x1e,
-0xa8,0x06,0x00,0xc0,0x97,0x0d,0x5a,0x51,0x1f,0x04,0xe1,0x02,0x9a,0xdc,0xcf,0x1e,
-0xaf,0x15,0x15,0x0d,0xbb,0x09,0x00,0x21,0x07,0x63,0xef,0xee,0x9c,0xcf,0xcc,0xc3,
-0xc0,0x0b,0xf7,0x2a,0x1c,0x00,0x6d,0xcf,0xcc,0xf0,0x06,0x80,0x06,0x60,0xd1,0x0e,
-0x00,0xde,0xde,0x6d,0xbf,0xcb,0xf0,0x5f,0x60,0xc6,0x60,0xd1,0x0e,0x03,0x96,0x0c,
-0x5c,0xcf,0xcc,0xc0,0x06,0x60,0xc2,0xa4,0xc0,0x00,0x00,0x6d,0xbe,0x06,0xf5,0x00,
-0x00,0x06,0x82,0x21,0xbb,0xe8,0x20,0x00,0x34,0x01,0xe7,0x01,0x9d,0xba,0x09,0x02,
-0xca,0x2a,0x00,0xe0,0x07,0x60,0x3b,0xeb,0xb9,0xcc,0xfc,0xcc,0xf2,0x35,0xf0,0x11,
-0xc7,0x40,0xe0,0x02,0xc0,0x05,0x5c,0x1d,0x05,0x00,0x6b,0x32,0x2e,0xec,0xfd,0xb0,
-0x0c,0xc9,0xde,0xf0,0x0e,0x00,0x03,0xf7,0x1c,0x2e,0xbb,0xfb,0x80,0x5a,0x71,0xc0,
-0xc9,0x26,0x81,0x57,0x1c,0x0e,0xbb,0xfb,0x80,0x05,0xec,0x0d,0x00,0xc3,0x58,0x11,
-0x0e,0x99,0xf9,0x92,0x00,0x10,0x00,0xe3,0x33,0x33,0xcb,0x07,0x70,0x01,0xdf,0xed,
-0x8d,0xcd,0xec,0xc0,0x56,0x5a,0x10,0x59,0x9a,0x37,0xf0,0x24,0x0d,0xbc,0xdb,0x70,
-0x02,0xc0,0x00,0xc1,0x59,0x11,0x00,0x8f,0xdf,0x2d,0xac,0xda,0x70,0x0e,0xa0,0xb2,
-0xc1,0x59,0x11,0x04,0xda,0x0b,0x2a,0xcc,0xcc,0xe3,0x04,0xa0,0xb3,0x64,0x42,0x7b,
-0x20,0x3e,0xbe,0x67,0xb3,0x74,0xc1,0x03,0xa1,0x1b,0x29,0x02,0x0e,0x00,0x26,0xac,
-0x49,0x05,0x51,0x17,0x11,0xff,0x91,0x4a,0x09,0x31,0x65,0x05,0x77,0x5b,0x10,0xf0,
-0xcd,0x00,0x40,0x80,0x0f,0x00,0x80,0x83,0x53,0xb0,0xf0,0x0a,0x80,0x00,0x1e,0x10,
-0x0f,0x00,0x1e,0x20,0x0d,0xc8,0x64,0x50,0x7a,0x02,0x80,0x00,0x0f,0x11,0x64,0x36,
-0x01,0xff,0xb0,0x5e,0x2d,0xf0,0x0d,0xcc,0xfc,0xa6,0xcd,0xec,0xb0,0x00,0x7f,0x90,
-0x01,0xef,0x50,0x00,0x4b,0xd6,0xb1,0xc7,0xbc,0x40,0x3d,0x1d,0x01,0xc5,0x3a,0x1d,
-0x20,0x10,0x40,0xf4,0x12,0x00,0x9b,0x43,0x14,0xcc,0x33,0x2f,0x03,0x27,0x23,0xf0,
-0x01,0x01,0x90,0x0e,0x02,0x80,0x00,0x04,0xd4,0x00,0xf0,0x05,0xd2,0x00,0x92,0x0a,
-0xdc,0xc6,0x0b,0x20,0x04,0x94,0x3c,0x07,0x20,0xbe,0xf6,0xff,0x51,0xf1,0x1a,0x01,
-0x0e,0x00,0x42,0xc2,0x81,0x00,0x00,0xf0,0x0a,0x3c,0x27,0x80,0x2e,0xef,0xea,0xc0,
-0xc2,0x1e,0x00,0x06,0xf4,0x1b,0x0c,0x20,0xa3,0x00,0xcf,0xb5,0x40,0xc2,0x24,0x00,
-0x86,0xe2,0x40,0x0c,0x2a,0x60,0x2d,0x0e,0x14,0x5e,0x50,0x20,0xe0,0x00,0x06,0xe2,
-0x5b,0x3b,0x20,0x6d,0xb1,0x5d,0x03,0x20,0xca,0x40,0xd2,0x00,0x10,0x71,0x5b,0x1b,
-0x30,0x9d,0xe7,0x12,0xce,0x03,0xf0,0x24,0x1c,0x00,0x6f,0xef,0xef,0x90,0x01,0xc0,
-0x0d,0x31,0xd0,0xb3,0x1e,0xef,0xed,0xa0,0x1d,0x06,0x00,0x07,0xe1,0x23,0x71,0xd3,
-0x60,0x00,0xce,0xb0,0x69,0x1d,0x1d,0x00,0x67,0xc5,0x3b,0x41,0xd0,0xb3,0x2c,0x1c,
-0x03,0xd0,0x1d,0x07,0x70,0x31,0xc0,0x65,0x01,0xd0,0x36,0x74,0x0a,0x11,0x2d,0xac,
-0x08,0x15,0x9e,0xe5,0x6b,0x20,0x15,0xaa,0xa8,0x51,0x60,0x1b,0xca,0x00,0x2e,0xed,
-0xd6,0x35,0x1f,0xd0,0x30,0x2d,0x10,0x00,0x68,0x07,0x3d,0x4c,0x40,0x04,0xef,0xfe,
-0x10,0x8a,0x5c,0x30,0xdc,0x09,0xc6,0xaf,0x16,0xf0,0x0e,0xb9,0x00,0x4e,0xdd,0xf3,
-0x0b,0x88,0x61,0xab,0x10,0x5c,0x04,0xa6,0x80,0x76,0x6a,0x3e,0x30,0x21,0x68,0x00,
-0x00,0xaf,0x40,0x00,0x06,0x80,0x04,0xbb,0xdc,0x0c,0x27,0x1d,0x94,0xf5,0x2a,0x01,
-0x37,0x08,0xf0,0x1a,0x7b,0xe7,0x5e,0xdd,0xdd,0xd0,0x03,0x87,0x05,0x80,0x00,0x1d,
-0x00,0x17,0x81,0x5a,0x55,0x56,0xd0,0x2a,0xdd,0xa3,0x55,0x55,0x54,0x00,0x0e,0xe0,
-0x6b,0xbb,0xbb,0xb3,0x04,0xec,0x91,0x22,0xe3,0x22,0x00,0xc8,0x89,0xff,0x05,0x91,
-0x5b,0x67,0x04,0xdd,0xfd,0xdd,0x03,0x36,0x70,0x80,0x0e,0x12,0x67,0x83,0x1f,0x51,
-0x72,0xee,0xef,0xee,0xe8,0x4e,0x00,0xf0,0x30,0x44,0x02,0x8c,0xd7,0x6a,0xbc,0xb9,
-0x60,0x13,0x86,0x04,0x71,0x80,0x7a,0x00,0x07,0x60,0x0d,0x1c,0x5e,0x10,0x5e,0xff,
-0xe2,0x42,0xb1,0x31,0x00,0x0d,0x80,0x5d,0xaf,0xaa,0xe0,0x03,0xfe,0x55,0x81,0xe1,
-0x1e,0x00,0xaa,0x7b,0x6c,0x9f,0x99,0xe0,0x3b,0x76,0x07,0x82,0xe2,0x2e,0x14,0x37,
-0x63,0xcd,0xaa,0xaa,0xf6,0x00,0x76,0x05,0x64,0x1e,0x81,0x07,0x60,0x57,0x00,0x6d,
-0xa0,0x00,0x05,0xc0,0x09,0xf0,0x07,0xbe,0xd6,0x6a,0xaf,0xaa,0xa3,0x00,0x49,0x02,
-0x99,0xfa,0x99,0x00,0x15,0xa1,0x55,0x5e,0x65,0x53,0x3d,0xee,0xd6,0x96,0x70,0xf1,
-0x1b,0x0b,0xb0,0x1d,0x88,0x88,0xe0,0x02,0xdd,0x92,0xea,0xaa,0xae,0x00,0xb7,0x97,
-0x4c,0x33,0x33,0xe0,0x69,0x49,0x01,0xd6,0x66,0x6e,0x02,0x04,0x90,0x1d,0xaa,0xaa,
-0xd0,0x00,0x49,0x00,0x7a,0x02,0xb3,0x00,0x04,0x93,0xd7,0xd3,0x80,0x03,0xf8,0x12,
-0xf0,0x41,0x30,0x01,0x34,0x79,0x10,0xbe,0xc3,0x7b,0x9c,0x66,0x70,0x01,0x67,0x00,
-0x90,0xb0,0xa4,0x00,0x06,0x70,0x3a,0xaf,0xaa,0xa0,0x1b,0xdd,0x97,0x88,0xd9,0x88,
-0x50,0x0d,0x90,0x59,0x99,0x99,0x90,0x03,0xee,0x51,0x44,0x44,0x4e,0x00,0xa8,0x79,
-0x15,0x55,0x55,0xe0,0x3b,0x57,0x06,0x9b,0xb9,0x9b,0x01,0x25,0x70,0x68,0x4c,0x32,
-0x60,0x00,0x57,0x1a,0xa2,0x12,0x6b,0x20,0x05,0x74,0x35,0xcb,0xc7,0x34,0x00,0x00,
-0x37,0x00,0x4d,0x7d,0x40,0xf3,0x11,0x11,0xfc,0x58,0x4a,0xf2,0x0c,0xfe,0x00,0x21,
-0x01,0x20,0x0f,0xc0,0x7d,0x30,0x3b,0xa2,0x76,0xe8,0x00,0x00,0x03,0xb7,0x28,0xaa,
-0xaa,0xaa,0xa7,0x00,0x12,0x23,0xf2,0x22,0x73,0x4d,0x07,0x50,0x52,0x14,0x0d,0x49,
-0x53,0x06,0x51,0x51,0x12,0x0b,0x83,0x53,0xf0,0x0a,0xf2,0x25,0x42,0x34,0x23,0xe0,
-0x0b,0x05,0xd2,0x03,0xd7,0x09,0x00,0x2b,0xb1,0x02,0x01,0xac,0x10,0x01,0x50,0x00,
-0xf1,0xc1,0x50,0xc7,0x22,0x25,0x04,0x90,0xfd,0x54,0x21,0x00,0xd9,0xd8,0x02,0x20,
-0x9a,0x0b,0xde,0x32,0xc6,0xcb,0x00,0x0b,0xb4,0x00,0x0d,0xb5,0x00,0x00,0x04,0xbe,
-0x20,0xe6,0x67,0x00,0xfc,0x18,0xf0,0x25,0xfc,0xcc,0xcb,0xf0,0x07,0x20,0x28,0x10,
-0xe5,0x7c,0x63,0x20,0x4b,0x94,0x69,0x44,0xe5,0x33,0x38,0x80,0xd8,0x7a,0x77,0x77,
-0xf0,0x0d,0x15,0xd9,0x98,0x0f,0x00,0xd4,0xb6,0x15,0x90,0xf0,0x0d,0x20,0x6c,0xd0,
-0x0f,0x00,0xd2,0x4a,0xa9,0xa1,0xf0,0x0d,0x49,0x30,0x04,0x1f,0x91,0x5f,0x42,0xab,
-0xe0,0x00,0x90,0xb0,0x19,0xf2,0x04,0x60,0x94,0x0f,0x00,0xe0,0x16,0x89,0x69,0x40,
-0xf0,0x0e,0x02,0x77,0x77,0x8d,0xdd,0xdd,0xd0,0x09,0xc9,0x7e,0x90,0xb1,0x68,0xdd,
-0xdf,0xdd,0xd5,0x09,0x38,0x40,0x5b,0x62,0xf0,0x09,0x75,0xa1,0xbd,0xfd,0xfd,0xf1,
-0x05,0x5b,0x0b,0x1c,0x0c,0x0c,0x11,0x6a,0xfd,0xc1,0xc0,0xc0,0xc1,0x39,0x51,0x0b,
-0x1c,0x0c,0x74,0x22,0x34,0xb1,0xb0,0xa6,0x9b,0x38,0x00,0xc7,0x5c,0xf0,0x26,0x82,
-0x00,0x00,0xcc,0xec,0xc6,0xcd,0xdc,0xc0,0x02,0x60,0x53,0x06,0x11,0xa0,0x01,0x5e,
-0x5d,0x74,0xa9,0x9c,0x62,0x16,0x66,0x66,0x45,0x55,0x55,0x20,0x8b,0xab,0xb2,0xdb,
-0xbc,0xa0,0x09,0x30,0x0c,0x29,0x00,0x6b,0x00,0x7d,0xbd,0x91,0xcc,0xdc,0x80,0x00,
-0xd0,0xd0,0x06,0x5b,0x36,0xab,0xf6,0x02,0x34,0xa2,0xb2,0x00,0x06,0x91,0xfb,0x5c,
-0x0b,0x30,0xa1,0xc1,0x05,0x3d,0x20,0x7c,0xc7,0x60,0x7e,0x00,0xf8,0x43,0xf0,0x05,
+0x00,0x79,0x05,0x90,0x5a,0x04,0xd0,0x2d,0x00,0x49,0x00,0xd0,0x09,0x60,0x5b,0x01,
+0xf3,0x42,0x20,0x00,0x00,0x06,0x80,0x00,0x0e,0x20,0x00,0x00,0x68,0x00,0xbb,0xfb,
+0xb8,0x00,0x26,0x84,0x3e,0x00,0x02,0xb0,0x0b,0x68,0xb2,0xfa,0xaa,0xbb,0x00,0xb6,
+0xaa,0x0e,0x44,0x46,0xb0,0x46,0x67,0x10,0xe5,0x55,0x7b,0x00,0x07,0x60,0x0f,0xbb,
+0xbc,0xb0,0x00,0xa8,0x00,0x03,0x80,0x00,0x00,0x0d,0xd6,0x23,0x48,0x91,0x30,0x03,
+0xc1,0x8c,0x67,0x02,0x1c,0x10,0xc5,0x02,0xb6,0x70,0x0b,0x67,0x49,0x00,0x23,0x3d,
+0xcc,0xb0,0x50,0x58,0x00,0xf3,0x3f,0xa0,0x00,0x00,0x73,0x00,0x00,0x0a,0x01,0xde,
+0xa4,0x9c,0x10,0x00,0xa0,0x36,0x93,0x0d,0x38,0x00,0x9a,0x63,0xad,0x33,0x8e,0x50,
+0x18,0xb9,0x6d,0x67,0x76,0x8c,0x14,0x4b,0x17,0x8c,0xcc,0xcc,0x40,0x00,0xb0,0x08,
+0x50,0x00,0xe0,0x00,0x0c,0x00,0x8b,0x99,0x9f,0x00,0x00,0xc5,0x01,0x82,0x27,0x50,
+0x00,0x55,0xa1,0x0d,0x00,0xc3,0x00,0x0b,0x14,0x30,0x94,0x2d,0x00,0x04,0x80,0x0a,
+0xde,0xde,0xed,0xd1,0x01,0x55,0x00,0x20,0x01,0x6b,0xba,0x00,0xf6,0x04,0x8d,0xf7,
+0xd0,0xcc,0xcc,0xa0,0x0c,0x1d,0x0c,0x0d,0x0a,0x0d,0x00,0xc1,0xd0,0xc0,0xd0,0xa0,
+0xd0,0x0d,0x00,0xf3,0x1c,0xfd,0xdd,0xa0,0x0c,0x0d,0x0d,0x0d,0x00,0x01,0x00,0xd0,
+0xd0,0xb2,0xe0,0x00,0xb2,0x0d,0x0d,0x06,0x8a,0xdd,0xda,0x01,0xc0,0xd0,0x0d,0x40,
+0x00,0x00,0x58,0x0d,0x00,0x2d,0xa4,0x00,0x0a,0x20,0xd0,0x00,0x06,0xbe,0xe3,0x00,
+0x60,0x01,0x01,0xec,0x02,0x27,0x00,0xd2,0x06,0x00,0xd1,0xdc,0xbb,0xcf,0xbb,0xb5,
+0x00,0xd5,0x33,0x33,0x33,0x31,0x00,0xe1,0x27,0x00,0xf0,0x04,0xf5,0x44,0x44,0x42,
+0x00,0x00,0xfb,0xbb,0xbb,0xd8,0x00,0x03,0xc0,0x00,0x00,0x78,0x00,0x08,0x80,0x06,
+0x00,0x20,0x2e,0x10,0x06,0x00,0x20,0x66,0x00,0x06,0x00,0x02,0x01,0x00,0xc0,0x0c,
+0x1b,0x20,0x57,0x8a,0xda,0x00,0xc1,0xb2,0x0e,0x86,0x41,0x0d,0x00,0x00,0xf9,0x02,
+0x30,0xc4,0xc5,0x1e,0x1a,0x00,0xf4,0x23,0xba,0xa5,0xef,0xee,0xeb,0x00,0xd1,0x00,
+0x0e,0x93,0x05,0x80,0x0e,0xcc,0x70,0xe4,0x80,0xa4,0x00,0xe1,0x79,0x1d,0x0d,0x2d,
+0x00,0x0d,0x06,0x92,0xc0,0x7e,0x50,0x04,0xb0,0x69,0x5a,0x07,0xf3,0x00,0x87,0x06,
+0x9b,0x67,0xd5,0xe4,0x09,0x10,0x69,0xc5,0xb1,0x04,0xad,0x02,0xf1,0x07,0x02,0xee,
+0xee,0xee,0xff,0xeb,0x00,0x00,0x70,0x00,0x08,0x70,0x00,0x00,0x4b,0x00,0x00,0x87,
+0x00,0x00,0x08,0x60,0x0d,0x00,0xb0,0xdf,0xee,0xee,0xff,0xee,0x50,0x00,0x00,0x03,
+0xdb,0x70,0x7a,0x02,0x70,0xe3,0x87,0x00,0x00,0x00,0x08,0xd2,0x1a,0x00,0x20,0x5d,
+0xa1,0x27,0x00,0x50,0xcc,0x40,0x00,0x09,0x70,0xe6,0x00,0x25,0x8e,0xe3,0xf3,0x01,
+0xf0,0x06,0x1d,0x00,0x00,0xa3,0x00,0x00,0xa4,0xd0,0x2b,0xbe,0xcb,0x90,0x0b,0x8e,
+0x50,0x33,0xb6,0x32,0x00,0xda,0xf9,0x0b,0x05,0xf0,0x17,0x1b,0x1d,0x0d,0xee,0xfe,
+0xee,0x52,0x51,0xd0,0x00,0x00,0x1c,0x00,0x00,0x4f,0xd8,0xbb,0xbb,0xfb,0x31,0xed,
+0xe1,0x26,0x32,0x4d,0x21,0x02,0x1d,0x00,0xa6,0x01,0xc0,0x00,0x01,0xd0,0x00,0xd1,
+0x1c,0x41,0x00,0x12,0x01,0x0d,0x00,0x27,0x0d,0xe8,0x55,0x00,0xfb,0x3c,0x0e,0x01,
+0x00,0x0e,0x01,0xd0,0x00,0xe2,0xd1,0x00,0xe0,0x1d,0x00,0x0e,0x05,0xc0,0x0e,0x12,
+0xd0,0x00,0xe0,0x02,0x00,0xac,0xcd,0xaf,0xff,0xff,0xf5,0x00,0x01,0xd0,0x01,0xf4,
+0x00,0x00,0x33,0x4d,0x00,0x4f,0x70,0x00,0x2c,0xdb,0xd0,0x08,0xcc,0x00,0x00,0x77,
+0x1d,0x00,0xd3,0xd2,0x00,0x09,0x51,0xd0,0x7c,0x06,0xb0,0x00,0xe1,0x1d,0x5e,0x20,
+0x0c,0xa0,0x25,0x01,0xec,0x20,0x00,0x1a,0x30,0xff,0x03,0x50,0x0d,0x30,0x00,0x00,
+0x0b,0xe9,0x00,0xf0,0x20,0xee,0x50,0x22,0x00,0x78,0x06,0x02,0x30,0x02,0xd6,0x5e,
+0x8c,0x63,0xd3,0x00,0x00,0x54,0x6d,0x80,0x51,0x00,0x00,0x29,0x39,0x75,0x99,0x60,
+0x00,0x9c,0x4b,0xfd,0xce,0x5a,0xa0,0x02,0x00,0x21,0x92,0x11,0x04,0x01,0xdd,0xdd,
+0xdf,0xed,0xdd,0xd6,0x7c,0x01,0x02,0x96,0x01,0x02,0x52,0x00,0x13,0xc3,0xa4,0x01,
+0x00,0x52,0x01,0xf0,0x06,0xed,0x00,0xc9,0xef,0xd8,0x00,0x94,0x01,0x0c,0x00,0xe0,
+0x00,0x09,0x40,0xd0,0xc0,0x0e,0x00,0x00,0x94,0x0d,0x0d,0x00,0x20,0x9d,0xb6,0x0d,
+0x00,0xb0,0x04,0xb8,0x6a,0x1c,0x6d,0xfd,0x50,0x09,0x42,0x42,0xb0,0x1a,0x00,0xf6,
+0x09,0x00,0x68,0x00,0xe0,0x00,0x0a,0xa8,0x0c,0x30,0x0e,0x00,0x2e,0xb7,0x38,0xa0,
+0x22,0xe2,0x20,0x00,0x08,0xa0,0x3c,0xcc,0xcb,0xa4,0x00,0xf5,0x14,0x11,0x11,0x11,
+0x04,0xdf,0xed,0x6e,0xbb,0xbc,0xc0,0x00,0x86,0x04,0x90,0x00,0x2c,0x00,0x08,0x60,
+0x4e,0xcc,0xcc,0xc0,0x16,0xba,0x64,0x90,0x00,0x2c,0x01,0x7b,0xa7,0x4e,0xcc,0xcd,
+0x1a,0x00,0xf3,0x10,0x61,0x4d,0xfc,0xfc,0xa0,0x03,0xbe,0xd2,0x4a,0x0e,0x00,0x06,
+0xc7,0x20,0x09,0x60,0xe0,0x11,0x00,0x00,0x07,0xc0,0x0e,0x04,0x80,0x00,0x0d,0xa1,
+0x00,0xad,0xe4,0x52,0x00,0xf0,0x07,0x2e,0xff,0xc8,0xed,0xfd,0xdf,0x00,0x08,0x60,
+0x84,0x0d,0x00,0xe0,0x00,0x86,0x08,0xdc,0xfc,0xcf,0x00,0x29,0x71,0x0d,0x00,0xf0,
+0x01,0x0d,0xee,0x98,0x61,0xd1,0x1e,0x00,0x08,0x60,0x5b,0xbf,0xbb,0xb0,0x00,0x86,
+0x00,0xa5,0x02,0xf1,0x01,0x08,0x86,0x9e,0xef,0xee,0xe2,0x06,0xdf,0x90,0x00,0xe1,
+0x00,0x02,0xd6,0x10,0x00,0x47,0x06,0x50,0x8e,0xee,0xfe,0xee,0x80,0xe6,0x02,0xf0,
+0x16,0xc0,0x00,0x08,0xef,0xe1,0xd0,0x1c,0x00,0xe0,0x01,0xd0,0x0d,0x01,0xc0,0x0e,
+0x00,0x1d,0x00,0xdd,0xdd,0xdd,0xc0,0x01,0xe0,0x01,0x11,0x11,0x11,0x06,0xdf,0xd8,
+0xcc,0xde,0xcc,0xc4,0x01,0xd0,0x09,0x04,0xf0,0x07,0x00,0x1d,0x02,0xfd,0xfd,0xfd,
+0xf1,0x01,0xd1,0x2b,0x0c,0x0c,0x0c,0x13,0x8f,0xc4,0xb0,0xc0,0xc0,0xc1,0x46,0x10,
+0x0d,0x00,0x64,0x10,0x00,0x02,0xb0,0xb0,0xb8,0x93,0x02,0xf0,0x3d,0x39,0x99,0x0f,
+0xae,0xae,0xad,0x00,0x0c,0x00,0xe9,0xe9,0xe9,0xd0,0x00,0xc0,0x25,0x55,0x55,0x55,
+0x11,0x7e,0x64,0x88,0x88,0x88,0x82,0x17,0xe6,0x07,0xbb,0xbb,0xb5,0x00,0x0c,0x00,
+0xa3,0x00,0x07,0x70,0x00,0xc0,0x0a,0xcb,0xbb,0xd7,0x00,0x0d,0x50,0x08,0x98,0x62,
+0x90,0x4b,0xd8,0x9c,0xb0,0x0c,0xb2,0x02,0x20,0x01,0x2c,0x79,0x2d,0x71,0x00,0x00,
+0x04,0x84,0x00,0x18,0x30,0x00,0x09,0x10,0xc2,0xe2,0x02,0xf0,0x06,0xf0,0x0c,0x20,
+0x00,0x00,0x00,0x8b,0x22,0xd4,0x22,0x22,0x00,0x1f,0xcc,0xcf,0xdc,0xcc,0xa0,0x0b,
+0x90,0x00,0x1a,0x00,0x21,0x60,0x00,0x1a,0x00,0xb0,0x8c,0xcc,0xfd,0xcc,0xc4,0x00,
+0x01,0x11,0x1d,0x41,0x11,0x7f,0x00,0x12,0xc2,0xc9,0x01,0x23,0x20,0x00,0x0d,0x00,
+0xf3,0x04,0x01,0xee,0xee,0xef,0xee,0xee,0xe6,0x00,0xee,0xee,0xfe,0xee,0xea,0x00,
+0xf0,0x00,0xe0,0x00,0x3b,0x06,0x00,0x58,0xfe,0xee,0xfe,0xee,0xeb,0x12,0x00,0x10,
+0x01,0x12,0x00,0x30,0xfb,0x03,0xb0,0x0c,0x00,0x20,0x07,0x70,0x06,0x00,0xc3,0x0d,
+0x20,0x00,0xe0,0x00,0x4b,0x59,0x00,0x00,0xe0,0x8d,0xe7,0xdf,0x00,0x40,0xed,0xcd,
+0xfc,0xcd,0x08,0x07,0x95,0x0e,0x00,0x2d,0x00,0x00,0xeb,0xbb,0xfb,0xbc,0x0d,0x00,
+0xf0,0x0d,0xbc,0xef,0xcf,0xec,0xb0,0x00,0x00,0x5d,0x20,0x2d,0x40,0x00,0x04,0xbc,
+0x80,0x00,0x9c,0xb5,0x01,0xb4,0x0f,0x00,0x0e,0x13,0xa1,0x00,0x03,0xd0,0x88,0x01,
+0x20,0x02,0xd6,0x7b,0x01,0x33,0x02,0xe6,0x00,0x3a,0x04,0x07,0x21,0x02,0xf0,0x51,
+0x00,0x3c,0x00,0x00,0xec,0xed,0x60,0xae,0xcc,0xc2,0xc0,0xa5,0x65,0xf4,0x15,0xd0,
+0xc0,0xa5,0x9e,0x6b,0x1d,0x40,0xc0,0xa5,0x73,0x0a,0xd8,0x00,0xeb,0xed,0x60,0x4c,
+0xca,0x20,0xc0,0xa5,0x9c,0x91,0x04,0xc8,0xc0,0xa5,0x74,0xdd,0xdd,0xc1,0xc3,0xb7,
+0x63,0xa0,0x00,0xe0,0xe8,0x88,0x33,0xa0,0x00,0xe0,0x80,0x00,0x03,0xfd,0xdd,0xe0,
+0x00,0x00,0x03,0xa0,0x00,0xe0,0x00,0xcc,0xbb,0xfc,0xbb,0xe3,0x00,0x0c,0x64,0x4e,
+0x64,0x4d,0x30,0x00,0xc6,0x44,0xe5,0x44,0xd3,0x00,0x0c,0xcc,0xcf,0xcc,0xcf,0x30,
+0x25,0x08,0x90,0x95,0x00,0x00,0x3c,0xcf,0xcc,0xce,0xdc,0x90,0x0d,0x00,0x10,0xa6,
+0xe4,0x07,0x51,0x00,0x0a,0x50,0x00,0x1d,0xba,0x06,0xe1,0x60,0x00,0x5d,0x40,0x0c,
+0xa4,0x00,0x08,0xd9,0x20,0x00,0x04,0xbd,0x10,0x00,0x07,0xf1,0x03,0x10,0x07,0x30,
+0x0e,0x00,0x57,0x00,0x4c,0x00,0xe0,0x1d,0x20,0xdd,0xed,0xde,0xdd,0xed,0xde,0x66,
+0x08,0xf2,0x12,0xc0,0xeb,0xbb,0xbb,0xe0,0xd0,0x0e,0x22,0x22,0x3e,0x00,0x00,0x78,
+0x88,0x88,0x70,0x00,0xbb,0xbb,0xbb,0xbb,0xb1,0x0d,0x00,0x0e,0x00,0x0c,0x20,0xfb,
+0xbb,0xfb,0xbb,0xe2,0x0b,0x00,0xf0,0x3d,0xfc,0xcc,0xfc,0xcc,0xe2,0x00,0x5f,0xff,
+0xff,0xff,0x50,0x00,0x05,0xb7,0x7e,0x77,0xb5,0x00,0x07,0x88,0x88,0x18,0x88,0x87,
+0x00,0xc7,0xd7,0xd2,0xd7,0xd7,0xd0,0x0c,0x7d,0x7d,0x2d,0x7d,0x7d,0x00,0x46,0x66,
+0x66,0x66,0x66,0x40,0x0b,0x75,0x55,0x55,0x55,0x7b,0x00,0x61,0xe9,0x99,0x99,0xf1,
+0x60,0x00,0x0e,0x77,0x77,0x7e,0x00,0x00,0x00,0xe8,0x88,0x88,0xf0,0x00,0x2a,0xaf,
+0xaa,0xaa,0xaf,0xaa,0xcb,0x01,0xf0,0x2e,0x50,0x04,0x00,0x00,0x4c,0xce,0x86,0x88,
+0xa1,0x00,0x05,0x93,0xc0,0x09,0xc1,0xa7,0x00,0x1b,0xc1,0x00,0x06,0xe8,0x00,0x6d,
+0xcc,0xe2,0xcc,0xce,0x9d,0x11,0x00,0x0a,0x3d,0x00,0xd0,0x00,0x04,0xdb,0xca,0x90,
+0x0c,0xb7,0x00,0x75,0x00,0x35,0x55,0x54,0x00,0x09,0xdc,0xc4,0xa6,0x6a,0x90,0x00,
+0x00,0x0c,0x29,0xa5,0xd1,0xd6,0x08,0x9b,0x2b,0xf9,0x00,0x00,0x2c,0xd8,0x8b,0x50,
+0x7b,0x41,0x04,0x11,0x06,0xb7,0x02,0xa0,0xb5,0x00,0x00,0x01,0xff,0xff,0xff,0xff,
+0xf1,0x1d,0xe4,0x00,0x10,0x11,0xa4,0x07,0x12,0xe1,0x0b,0x00,0x0f,0x16,0x00,0x0b,
+0x00,0x6a,0x08,0xf0,0x32,0xd2,0x00,0x49,0x00,0x00,0x3d,0x00,0x09,0x60,0x00,0xce,
+0xfd,0xb0,0xee,0xee,0xed,0x00,0x0d,0x5a,0x00,0x0e,0xd0,0x00,0xdd,0x30,0x00,0xed,
+0x00,0x0d,0x35,0x30,0x0d,0xdd,0xdd,0xd0,0x3d,0x01,0xdd,0x00,0x0d,0x00,0x88,0x2c,
+0xd0,0x00,0xd0,0x00,0x73,0xbd,0x00,0x0d,0x00,0x00,0x59,0xdd,0xdd,0xb0,0x00,0x08,
+0x7d,0x00,0x00,0x00,0xcd,0xe1,0x86,0x03,0xb0,0x10,0x00,0x00,0x06,0x10,0x00,0x06,
+0x20,0x00,0x00,0x5b,0x2e,0x02,0x80,0x01,0x12,0xc3,0x11,0xa5,0x11,0x00,0xab,0x5d,
+0x01,0x40,0xb3,0x00,0x00,0x71,0x31,0x07,0xf3,0x10,0x04,0xc6,0x00,0x04,0xbc,0x50,
+0x08,0xb3,0x11,0x11,0x11,0x39,0x10,0x07,0xdc,0xfc,0xdd,0xcf,0x00,0x00,0x76,0x0e,
+0x07,0x60,0xe0,0x00,0x07,0x60,0xe0,0x76,0x0e,0x0d,0x00,0x80,0x01,0xde,0xed,0xfd,
+0xee,0xdf,0xd8,0x00,0x34,0x01,0xf1,0x3c,0x00,0x00,0xbc,0xdd,0xc6,0x1d,0x00,0x00,
+0x0b,0xbc,0xda,0x26,0xca,0xaa,0x60,0xb2,0x00,0x85,0xd0,0x10,0x00,0x0b,0xbb,0xbc,
+0x64,0x3d,0x30,0x00,0xb2,0x67,0x00,0x00,0x2d,0x30,0x07,0xaa,0xaa,0x70,0x00,0x10,
+0x00,0x06,0xaa,0xaa,0xaa,0xa9,0x00,0x00,0xa5,0x5b,0x2b,0x62,0xf0,0x00,0x0a,0x32,
+0xa0,0xa4,0x0f,0x00,0x00,0xa3,0x2a,0x0a,0x40,0xf0,0x01,0xdf,0xee,0xfd,0xfe,0xdf,
+0xd8,0x00,0x05,0x2c,0x01,0xf0,0x39,0x7c,0xcb,0xb0,0xdb,0xd7,0x00,0x07,0x57,0x0c,
+0x1c,0x05,0xa4,0x00,0x74,0x51,0xca,0x40,0x06,0x70,0x7d,0xcb,0xbc,0x6d,0xbb,0xe1,
+0x00,0xb2,0x90,0xc0,0xa6,0xa7,0x00,0x2b,0x03,0x2c,0x38,0xee,0x61,0x07,0x30,0x2a,
+0x79,0x40,0x16,0xb0,0x00,0xfc,0xed,0xcf,0xcd,0x90,0x00,0x0d,0x07,0x60,0xe0,0x49,
+0x00,0x00,0xd0,0x76,0x0e,0x04,0x90,0x07,0xcf,0xce,0xec,0xfc,0xde,0xc1,0xef,0x92,
+0x03,0x00,0x5c,0x07,0x10,0xe0,0x9e,0x03,0x00,0x01,0x00,0x01,0x09,0x00,0x00,0x12,
+0x00,0x01,0x0e,0x00,0x05,0x1b,0x00,0x42,0xfe,0xee,0xee,0xfe,0x6a,0x0a,0x05,0xef,
+0x05,0x50,0x20,0x00,0x00,0x0a,0xee,0x19,0x00,0x40,0x20,0x00,0x00,0x2c,0x12,0x00,
+0x81,0x3d,0xdd,0xed,0xdd,0xb0,0x00,0x04,0xa0,0x0f,0x00,0x20,0x4e,0xbb,0x65,0x05,
+0x0d,0x0d,0x00,0x11,0x3c,0x0d,0x00,0xb0,0xbb,0xc0,0x00,0x26,0xb2,0x22,0x22,0x4d,
+0x21,0x1b,0xbb,0x01,0x00,0x11,0x60,0xd7,0x0a,0x00,0x1b,0x02,0xf1,0x1d,0x0a,0xee,
+0xee,0xf1,0x00,0x0e,0x00,0xa4,0x00,0x0d,0x11,0xdd,0xfd,0xaa,0x40,0x00,0xd1,0x00,
+0x5f,0x00,0xae,0xdd,0xdf,0x10,0x0b,0xf6,0x0a,0x40,0x00,0xd1,0x01,0xbe,0xb4,0xa4,
+0x00,0x0d,0x10,0x94,0xe1,0x8a,0xed,0xdd,0xf1,0x3c,0x27,0x00,0x50,0x10,0x20,0xe0,
+0x0a,0x40,0xaf,0x07,0xb0,0x00,0xae,0xee,0xef,0x10,0x00,0xe0,0x09,0x30,0x00,0xc1,
+0xaa,0x04,0xf1,0x10,0x35,0x70,0x00,0x3b,0xcc,0xfc,0xa8,0x74,0x00,0x01,0x66,0x6e,
+0x86,0x66,0x62,0x00,0x14,0x49,0xb4,0x44,0x44,0x20,0x2c,0xcd,0xfe,0xcc,0xcc,0xcc,
+0x20,0x00,0x8b,0x6e,0x00,0xf1,0x0d,0x4f,0xdc,0xcc,0xcc,0xe0,0x00,0x6e,0xc9,0x66,
+0x66,0x6e,0x00,0x3c,0x19,0x73,0x33,0x34,0xe0,0x00,0x00,0x9c,0xaa,0xaa,0xae,0x00,
+0x00,0x09,0x50,0xea,0x00,0x40,0x9d,0xbb,0xbb,0xbe,0x29,0x00,0x11,0xd0,0x01,0x0a,
+0xf1,0x1b,0xdf,0xdd,0xdd,0xc0,0x00,0x12,0x25,0xc2,0x22,0x10,0x00,0x05,0xc7,0x77,
+0x77,0xc6,0x00,0x00,0x5d,0x99,0x99,0x9d,0x60,0x00,0x05,0xa3,0x33,0x33,0xa6,0x00,
+0x00,0x5b,0x55,0x55,0x5b,0x60,0x00,0x05,0xd9,0x99,0x99,0xd6,0x0b,0x0b,0xf0,0x02,
+0x09,0x70,0x02,0xbb,0xbb,0xbb,0xbc,0xbb,0xb2,0x00,0x17,0xc1,0x00,0xc9,0x30,0x00,
+0xad,0x15,0x08,0x25,0xc0,0x01,0x40,0x01,0xf0,0x2d,0x01,0x35,0x40,0xfd,0xf4,0xcb,
+0xcb,0x86,0x30,0xc0,0xc0,0x94,0x3a,0x09,0x40,0xc2,0xd1,0x5a,0x2b,0x4c,0x20,0xea,
+0xe6,0xc9,0x99,0x9a,0xd3,0xc0,0xc5,0xb7,0x00,0x0c,0x72,0xfd,0xf0,0xb8,0xe9,0xae,
+0xa0,0xc0,0xc5,0x81,0xc9,0x1c,0x00,0xc0,0xc9,0x7b,0x7c,0x3d,0x30,0xfd,0xd0,0x1d,
+0x07,0x8e,0x80,0xc0,0x01,0xc3,0x1d,0x07,0x20,0x09,0x30,0x06,0x00,0x31,0x81,0x00,
+0x00,0x96,0x01,0xf0,0x02,0x06,0x99,0x99,0x06,0xff,0xfe,0x7a,0x74,0x4f,0x0e,0x37,
+0x70,0x0a,0x40,0x0f,0x16,0x07,0x06,0x00,0xf0,0x00,0x2d,0xde,0xed,0xca,0x40,0x0f,
+0x00,0x0a,0x60,0x0a,0x40,0x0f,0x00,0x0c,0xa0,0x06,0x00,0x20,0x1e,0xa8,0x06,0x00,
+0xf5,0x02,0x97,0x0d,0x5a,0x51,0x1f,0x04,0xe1,0x02,0x9a,0xdc,0xcf,0x1e,0x20,0x00,
+0x0a,0x40,0x0d,0xbb,0x09,0x00,0x21,0x07,0x63,0xef,0xee,0x9c,0xcf,0xcc,0xc3,0xc0,
+0x0b,0xf7,0x2a,0x1c,0x00,0x6d,0xcf,0xcc,0xf0,0x06,0x80,0x06,0x60,0xd1,0x0e,0x00,
+0xde,0xde,0x6d,0xbf,0xcb,0xf0,0x5f,0x60,0xc6,0x60,0xd1,0x0e,0x03,0x96,0x0c,0x5c,
+0xcf,0xcc,0xc0,0x06,0x60,0xc2,0xa4,0xc0,0x00,0x00,0x6d,0xbe,0x06,0xf5,0x00,0x00,
+0x06,0x82,0x21,0xbb,0xe8,0x20,0x00,0x34,0x01,0xe7,0x01,0x9d,0xba,0x09,0x00,0x01,
+0x00,0x20,0x22,0x22,0xe0,0x07,0xf1,0x27,0x3b,0xeb,0xb9,0xcc,0xfc,0xcc,0x00,0x0e,
+0x00,0xc1,0xc7,0x40,0xe0,0x02,0xc0,0x05,0x5c,0x1d,0x05,0x00,0x6b,0x32,0x2e,0xec,
+0xfd,0xb0,0x0c,0xc9,0xde,0xf0,0x0e,0x00,0x03,0xf7,0x1c,0x2e,0xbb,0xfb,0x80,0x5a,
+0x71,0xc0,0xe0,0x0e,0x00,0x00,0x57,0x1c,0x0e,0xbb,0xfb,0x80,0x05,0xec,0x0d,0x00,
+0xc3,0x58,0x11,0x0e,0x99,0xf9,0x92,0x00,0x10,0x00,0xe3,0x33,0x33,0xcb,0x07,0xf4,
+0x39,0x01,0xdf,0xed,0x8d,0xcd,0xec,0xc0,0x00,0xb3,0x00,0xc1,0x59,0x10,0x00,0x0e,
+0x00,0x0d,0xbc,0xdb,0x70,0x02,0xc0,0x00,0xc1,0x59,0x11,0x00,0x8f,0xdf,0x2d,0xac,
+0xda,0x70,0x0e,0xa0,0xb2,0xc1,0x59,0x11,0x04,0xda,0x0b,0x2a,0xcc,0xcc,0xe3,0x04,
+0xa0,0xb3,0x64,0x42,0x7b,0x20,0x3e,0xbe,0x67,0xb3,0x74,0xc1,0x03,0xa1,0x1b,0x29,
+0x02,0x0e,0x00,0x26,0x00,0x20,0x00,0x8d,0x90,0xa4,0x00,0x00,0x4b,0x04,0x19,0xf0,
+0x93,0x04,0x11,0x02,0x06,0x03,0x13,0xe2,0xda,0x0d,0xf1,0x15,0x01,0x80,0x0f,0x00,
+0x80,0x00,0x00,0x89,0x00,0xf0,0x0a,0x80,0x00,0x1e,0x10,0x0f,0x00,0x1e,0x20,0x0d,
+0x60,0x00,0xf0,0x00,0x7a,0x02,0x80,0x00,0x0f,0x00,0x01,0xa0,0x00,0x01,0xff,0xb0,
+0x1b,0x03,0xf0,0x15,0x00,0x00,0x3a,0x00,0x00,0xcc,0xfc,0xa6,0xcd,0xec,0xb0,0x00,
+0x7f,0x90,0x01,0xef,0x50,0x00,0x4b,0xd6,0xb1,0xc7,0xbc,0x40,0x3d,0x1d,0x01,0xc5,
+0x3a,0x1d,0x20,0x10,0x40,0x00,0x01,0x40,0x2e,0x07,0x34,0xcc,0xcc,0xa0,0x99,0x09,
+0xf0,0x07,0xdd,0xdd,0xfd,0xdd,0xdd,0x10,0x01,0x90,0x0e,0x02,0x80,0x00,0x04,0xd4,
+0x00,0xf0,0x05,0xd2,0x00,0x92,0x0a,0xdc,0xc6,0x0b,0x20,0x04,0x94,0x3c,0x07,0xf0,
+0x30,0xbe,0xf6,0x10,0x0c,0x20,0x00,0x01,0x0e,0x00,0x42,0xc2,0x81,0x00,0x00,0xf0,
+0x0a,0x3c,0x27,0x80,0x2e,0xef,0xea,0xc0,0xc2,0x1e,0x00,0x06,0xf4,0x1b,0x0c,0x20,
+0xa3,0x00,0xcf,0xb5,0x40,0xc2,0x24,0x00,0x86,0xe2,0x40,0x0c,0x2a,0x60,0x2d,0x0e,
+0x00,0x00,0x05,0xd0,0x00,0x20,0xe0,0x00,0x06,0xe2,0x00,0x00,0x0e,0x01,0x6d,0xb1,
+0x5d,0x03,0x20,0xca,0x40,0xd2,0x00,0x80,0x71,0x08,0x10,0x00,0x00,0x9d,0xe7,0x12,
+0xce,0x03,0xf0,0x24,0x1c,0x00,0x6f,0xef,0xef,0x90,0x01,0xc0,0x0d,0x31,0xd0,0xb3,
+0x1e,0xef,0xed,0xa0,0x1d,0x06,0x00,0x07,0xe1,0x23,0x71,0xd3,0x60,0x00,0xce,0xb0,
+0x69,0x1d,0x1d,0x00,0x67,0xc5,0x3b,0x41,0xd0,0xb3,0x2c,0x1c,0x03,0xd0,0x1d,0x07,
+0x70,0x31,0xc0,0x65,0x01,0xd0,0x36,0x74,0x0a,0x11,0x2d,0xac,0x08,0x24,0x9e,0x80,
+0x26,0x01,0xf0,0x36,0x15,0xaa,0x00,0x3d,0x00,0x00,0x1b,0xca,0x00,0x2e,0xed,0xd6,
+0x00,0x06,0x80,0x6d,0x30,0x2d,0x10,0x00,0x68,0x07,0x3d,0x4c,0x40,0x04,0xef,0xfe,
+0x10,0x8d,0x30,0x00,0x00,0xdc,0x09,0xc6,0x5b,0x00,0x00,0x3e,0xb9,0x00,0x4e,0xdd,
+0xf3,0x0b,0x88,0x61,0xab,0x10,0x5c,0x04,0xa6,0x80,0x76,0x6a,0x3e,0x30,0x21,0x68,
+0x00,0x00,0xaf,0x40,0x00,0x06,0x80,0x04,0xbb,0xdc,0x0c,0xb0,0x1d,0x94,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x2e,0x00,0x01,0x20,0x00,0x00,0x00,0x00,
+0x7b,0xe7,0x5e,0xdd,0xdd,0xd0,0x03,0x87,0x05,0x80,0x00,0x1d,0x00,0x17,0x81,0x5a,
+0x55,0x56,0xd0,0x2a,0xdd,0xa3,0x55,0x55,0x54,0x00,0x0e,0xe0,0x6b,0xbb,0xbb,0xb3,
+0x04,0xec,0x91,0x22,0xe3,0x22,0x00,0xc8,0x89,0x00,0x0d,0x10,0x00,0x5b,0x67,0x04,
+0xdd,0xfd,0xdd,0x03,0x36,0x70,0x0d,0x00,0xd1,0x00,0x67,0x00,0x00,0xd1,0x00,0x00,
+0x06,0x72,0xee,0xef,0xee,0xe8,0x4e,0x00,0xf3,0x89,0x44,0x02,0x8c,0xd7,0x6a,0xbc,
+0xb9,0x60,0x13,0x86,0x04,0x71,0x80,0x7a,0x00,0x07,0x60,0x0d,0x1c,0x5e,0x10,0x5e,
+0xff,0xe2,0x42,0xb1,0x31,0x00,0x0d,0x80,0x5d,0xaf,0xaa,0xe0,0x03,0xfe,0x55,0x81,
+0xe1,0x1e,0x00,0xaa,0x7b,0x6c,0x9f,0x99,0xe0,0x3b,0x76,0x07,0x82,0xe2,0x2e,0x14,
+0x37,0x63,0xcd,0xaa,0xaa,0xf6,0x00,0x76,0x05,0x70,0x00,0x0e,0x00,0x07,0x60,0x57,
+0x00,0x6d,0xa0,0x00,0x05,0x90,0x00,0xe1,0x00,0x02,0xbe,0xd6,0x6a,0xaf,0xaa,0xa3,
+0x00,0x49,0x02,0x99,0xfa,0x99,0x00,0x15,0xa1,0x55,0x5e,0x65,0x53,0x3d,0xee,0xd6,
+0x55,0x55,0x55,0x30,0x0b,0xb0,0x1d,0x88,0x88,0xe0,0x02,0xdd,0x92,0xea,0xaa,0xae,
+0x00,0xb7,0x97,0x4c,0x33,0x33,0xe0,0x69,0x49,0x01,0xd6,0x66,0x6e,0x02,0x04,0x90,
+0x1d,0xaa,0xaa,0xd0,0x00,0x49,0x00,0x7a,0x02,0xb3,0x00,0x04,0x93,0xd7,0x00,0x02,
+0xc5,0x00,0x01,0x00,0xf1,0x6d,0x04,0x30,0x01,0x34,0x79,0x10,0xbe,0xc3,0x7b,0x9c,
+0x66,0x70,0x01,0x67,0x00,0x90,0xb0,0xa4,0x00,0x06,0x70,0x3a,0xaf,0xaa,0xa0,0x1b,
+0xdd,0x97,0x88,0xd9,0x88,0x50,0x0d,0x90,0x59,0x99,0x99,0x90,0x03,0xee,0x51,0x44,
+0x44,0x4e,0x00,0xa8,0x79,0x15,0x55,0x55,0xe0,0x3b,0x57,0x06,0x9b,0xb9,0x9b,0x01,
+0x25,0x70,0x68,0x4c,0x32,0x60,0x00,0x57,0x1a,0xa2,0x12,0x6b,0x20,0x05,0x74,0x35,
+0xcb,0xc7,0x34,0x00,0x00,0x37,0x00,0x00,0x01,0x11,0x12,0xf3,0x11,0x11,0xfc,0xcc,
+0xcc,0xcc,0xcc,0xfe,0x00,0x21,0x01,0x20,0x0f,0xc0,0x7d,0x30,0x3b,0xa2,0x76,0xe8,
+0x00,0x00,0x03,0xb7,0x28,0xaa,0xaa,0xaa,0xa7,0x00,0x12,0x23,0xf2,0x22,0x20,0x00,
+0x00,0x0f,0x81,0x00,0x31,0xf0,0x00,0x00,0x0b,0x00,0xa1,0x0d,0xee,0xee,0xfe,0xee,
+0xee,0x00,0x00,0x00,0x10,0x17,0x00,0xf0,0x27,0x2e,0x00,0x00,0x00,0x0b,0xbb,0xbb,
+0xfc,0xbb,0xba,0x00,0xf2,0x25,0x42,0x34,0x23,0xe0,0x0b,0x05,0xd2,0x03,0xd7,0x09,
+0x00,0x2b,0xb1,0x02,0x01,0xac,0x10,0x01,0x50,0x00,0xf1,0xc1,0x50,0x00,0x00,0x00,
+0x2d,0x04,0x90,0x00,0x3e,0xee,0xef,0xfe,0xee,0xee,0x30,0x00,0x00,0xd9,0xa0,0x3a,
+0x00,0xf4,0x03,0x9a,0x0b,0x70,0x00,0x00,0x04,0xcb,0x00,0x0b,0xb4,0x00,0x0d,0xb5,
+0x00,0x00,0x04,0xbe,0x20,0xec,0x00,0xf1,0x33,0x3b,0x00,0x00,0x0b,0xcc,0xcc,0xfc,
+0xcc,0xcb,0xf0,0x07,0x20,0x28,0x10,0xe5,0x7c,0x63,0x20,0x4b,0x94,0x69,0x44,0xe5,
+0x33,0x38,0x80,0xd8,0x7a,0x77,0x77,0xf0,0x0d,0x15,0xd9,0x98,0x0f,0x00,0xd4,0xb6,
+0x15,0x90,0xf0,0x0d,0x20,0x6c,0xd0,0x0f,0x00,0xd2,0x4a,0xa9,0xa1,0xf0,0x0d,0x49,
+0x30,0x04,0x1f,0x00,0xdb,0xaa,0xaa,0xab,0xe0,0x00,0x90,0xaf,0x00,0xf0,0x07,0x09,
+0x60,0x94,0x0f,0x00,0xe0,0x16,0x89,0x69,0x40,0xf0,0x0e,0x02,0x77,0x77,0x8d,0xdd,
+0xdd,0xd0,0x09,0x04,0x80,0x61,0x00,0xf0,0x13,0xb1,0x68,0xdd,0xdf,0xdd,0xd5,0x09,
+0x38,0x40,0x02,0xd0,0x00,0x00,0x75,0xa1,0xbd,0xfd,0xfd,0xf1,0x05,0x5b,0x0b,0x1c,
+0x0c,0x0c,0x11,0x6a,0xfd,0xc1,0xc0,0xc0,0xc1,0x39,0x51,0x0d,0x00,0x74,0x10,0x00,
+0x00,0xb1,0xb0,0xa6,0xd0,0x96,0x00,0xf4,0x3e,0x1b,0x00,0x00,0x82,0x00,0x00,0xcc,
+0xec,0xc6,0xcd,0xdc,0xc0,0x02,0x60,0x53,0x06,0x11,0xa0,0x01,0x5e,0x5d,0x74,0xa9,
+0x9c,0x62,0x16,0x66,0x66,0x45,0x55,0x55,0x20,0x8b,0xab,0xb2,0xdb,0xbc,0xa0,0x09,
+0x30,0x0c,0x29,0x00,0x6b,0x00,0x7d,0xbd,0x91,0xcc,0xdc,0x80,0x00,0xd0,0xd0,0x06,
+0x5b,0x20,0x00,0x0d,0x0d,0x34,0xa2,0xb2,0x00,0x06,0x91,0xfb,0x5c,0x0b,0x30,0xa1,
+0xc1,0x05,0x3d,0x20,0x7c,0xc7,0x55,0x00,0xf0,0x14,0x85,0x00,0x06,0x60,0x00,0x00,
 0x1f,0xcc,0xb7,0xdd,0xcb,0xb0,0x0b,0x45,0xa0,0x6a,0x0d,0x10,0x03,0x80,0x08,0x08,
-0x20,0x53,0x00,0x05,0xa0,0x22,0x00,0x16,0x4f,0x01,0x7e,0x28,0x00,0x4a,0x3d,0x32,
-0xd1,0x00,0x3c,0x30,0x15,0x90,0xdd,0xdf,0xfd,0xdd,0xe7,0x00,0x00,0x0a,0x9e,0x17,
-0x0a,0xb7,0x5c,0x50,0xe0,0x23,0xd2,0x00,0xb7,0x10,0x0e,0x06,0xa6,0xb5,0x7e,0x10,
-0x07,0x55,0x00,0xf0,0x02,0xdc,0xc8,0xed,0xcc,0xc6,0x0c,0x58,0x60,0xc6,0x1e,0x00,
-0x01,0x60,0x23,0x0d,0x20,0x51,0xbc,0x81,0x00,0x83,0x0b,0x02,0x76,0x0b,0x20,0x1d,
-0xdd,0x53,0x80,0x12,0x80,0x88,0x63,0x11,0x09,0x0d,0x00,0x32,0x30,0x00,0x8a,0x6e,
-0x63,0x12,0x7c,0xa2,0x63,0x10,0x22,0x7a,0x0c,0x11,0xb1,0x62,0x13,0xf0,0x1d,0x6e,
-0xec,0xc9,0xfd,0xec,0xc2,0x3d,0x18,0x51,0xd2,0x0c,0x10,0x00,0x1a,0xb9,0x9a,0x99,
-0xae,0x00,0x00,0xab,0x99,0x99,0x9a,0xe0,0x00,0x0a,0x73,0x33,0x33,0x4e,0x00,0x00,
-0xa9,0x66,0x66,0x67,0xe0,0x00,0x09,0xbc,0xaa,0xab,0xbc,0x9d,0x12,0x00,0x60,0x50,
-0x81,0xcc,0xdf,0xcc,0xce,0xdc,0xc3,0x00,0x3d,0x17,0x25,0x21,0xab,0x30,0x7d,0x61,
-0x04,0x37,0x51,0x00,0xa2,0x06,0xf1,0x11,0x09,0xdc,0xbb,0x2f,0xcc,0xba,0x4d,0x08,
-0x61,0xa5,0x1d,0x10,0x16,0x45,0x57,0xc4,0x46,0x42,0x0d,0x87,0x77,0x77,0x77,0xa9,
-0x0c,0x6b,0xbb,0xbb,0xbb,0x58,0x00,0x68,0xd1,0x12,0x11,0x6d,0x67,0x07,0x02,0x73,
-0x23,0x40,0x6e,0xcc,0xcc,0xcd,0xe9,0x1d,0x00,0xbf,0x19,0x20,0x6e,0xbb,0xca,0x10,
-0x11,0xc0,0x48,0x43,0xf0,0x14,0x7f,0xcc,0xc2,0xfd,0xdc,0xc3,0x3e,0x1d,0x11,0xd5,
-0x1e,0x20,0x04,0x40,0x53,0x27,0x00,0x65,0x00,0x0b,0xdc,0xcf,0x0d,0xee,0xed,0x00,
-0xb7,0x44,0xf0,0xd1,0x01,0xd0,0x0b,0x75,0x5f,0x6b,0x7c,0x21,0xbc,0xbb,0x0d,0x00,
-0x20,0x41,0x81,0x0d,0x00,0xf0,0x01,0xb3,0x0c,0x60,0xd2,0x35,0xc0,0x0e,0x9a,0xde,
-0x1d,0x1a,0xa4,0x01,0x95,0x20,0x63,0x7d,0x0a,0x11,0x93,0xa1,0x30,0xf0,0x24,0x4f,
-0xed,0xca,0xfd,0xdc,0xc6,0x1e,0x29,0x51,0xd2,0x1d,0x10,0x00,0x42,0x85,0x22,0x34,
-0x75,0x40,0x09,0x9d,0xb9,0x7b,0xa8,0x8f,0x00,0x7a,0xdb,0xa5,0xb3,0x00,0xe0,0x0b,
-0x4a,0x67,0x7b,0x30,0x0e,0x00,0xb7,0xb9,0xa7,0xb3,0x24,0xe0,0x0a,0xad,0xbc,0x7b,
-0x34,0x95,0xd5,0x34,0xf2,0x02,0xb3,0x00,0x24,0x2b,0xbd,0xcb,0xab,0x30,0x05,0x90,
-0x00,0x84,0x00,0x6e,0xdd,0xe3,0x00,0x7a,0x68,0xf0,0x27,0x7f,0xcb,0xad,0xec,0xcb,
-0xb3,0x3d,0x1c,0x07,0xb0,0x4e,0x10,0x02,0x30,0x45,0xdb,0x50,0x52,0x00,0x00,0x29,
-0xc2,0x18,0xd6,0x10,0x03,0xbb,0x48,0x99,0x92,0x6c,0xc2,0x13,0xab,0xb7,0x4b,0xbb,
-0x91,0x00,0x0e,0x04,0xa6,0x70,0x1d,0x00,0x00,0xeb,0xca,0x6d,0xbb,0xd0,0x00,0x02,
-0xe1,0x71,0x6f,0xa0,0x05,0xca,0xc2,0x9b,0xad,0x82,0x03,0xa1,0x03,0x95,0x02,0x1b,
-0x02,0xd5,0x01,0xf6,0x38,0x2f,0xdc,0xb5,0xec,0xdb,0xb0,0x2d,0x46,0x80,0xa5,0x0b,
-0x20,0x00,0x2b,0x70,0x6a,0x0d,0x1b,0x10,0x09,0x69,0x5b,0x76,0xc1,0x45,0x04,0xba,
-0xeb,0xea,0xbe,0xba,0xa2,0x06,0x8c,0x0e,0x85,0x94,0x56,0x00,0x23,0xc0,0xd3,0x17,
-0x6c,0x20,0x04,0x7c,0x0e,0x74,0x3d,0xb0,0x00,0x89,0xc0,0xe9,0x61,0xf2,0x00,0x00,
-0x1d,0x2d,0x44,0xcd,0x68,0x23,0xba,0x97,0x66,0xe4,0x1c,0xc0,0xea,0x33,0x00,0xf3,
-0x66,0x90,0x90,0xd0,0xd0,0x0e,0x10,0x00,0x0b,0x1d,0x39,0xf0,0x0c,0x90,0x94,0xd9,
-0x30,0x0e,0xdd,0xd4,0x26,0x6e,0x75,0xc5,0x04,0x21,0x6a,0xe6,0xcc,0x14,0xf1,0x06,
-0xcf,0x60,0xee,0xfe,0xee,0x00,0x59,0xda,0x5e,0x00,0x00,0xe0,0x1d,0x2d,0x06,0xe0,
-0x00,0x0e,0x06,0x50,0xd0,0xec,0x57,0x30,0x0d,0x00,0xfb,0x22,0x19,0x00,0x68,0x0c,
-0x1c,0xe0,0x6f,0x6f,0x00,0x66,0x02,0x90,0x0a,0x67,0xa5,0xbb,0xfc,0xbb,0x50,0xa7,
-0x7b,0xe0,0x07,0xf0,0x01,0x08,0xaa,0x70,0xaa,0xeb,0xaa,0x11,0x69,0xa5,0x57,0x7e,
-0x87,0x75,0x28,0xdc,0x82,0x45,0x3d,0x30,0x0e,0xe1,0x0e,0x33,0x4e,0xf0,0x00,0xeb,
-0xb0,0xe5,0x55,0x5e,0x00,0xd8,0x77,0x0e,0x44,0x44,0xe0,0x3a,0x67,0x00,0x1a,0x05,
-0x31,0x16,0x70,0x0e,0x21,0x27,0x47,0x00,0xe0,0x08,0xca,0x18,0x09,0x81,0x7a,0x90,
-0x00,0x6d,0xed,0xfc,0x97,0x41,0xee,0x5a,0x10,0x33,0x7e,0x19,0x00,0x9e,0x88,0x50,
-0x00,0xbf,0xcd,0xfa,0x10,0x13,0x14,0xf0,0x08,0xd5,0x02,0xd1,0x00,0x00,0x5d,0xb5,
-0x56,0x7c,0xd0,0x00,0x6c,0xb9,0x8f,0x64,0x37,0xa0,0x00,0x07,0x40,0xe1,0x66,0x02,
-0x9c,0x0f,0xd0,0x10,0xb9,0x00,0x0a,0xc1,0x00,0xe1,0x00,0xab,0x00,0x20,0x09,0xec,
-0x36,0x13,0x12,0x0b,0x40,0x14,0xe0,0x90,0x3e,0xee,0xee,0xe0,0x01,0xc0,0xa1,0x00,
-0xa5,0x00,0x01,0xc7,0x7a,0x55,0x03,0x30,0x3b,0xbe,0x20,0x10,0x41,0x30,0x1c,0x3a,
-0x20,0x79,0x0d,0x20,0xca,0xd7,0x1a,0x00,0x90,0x85,0x22,0x40,0x0a,0x50,0x00,0x07,
-0x29,0xa2,0x1a,0x00,0xd3,0xd0,0xd4,0x60,0x0a,0x50,0x00,0x2b,0x0c,0x0b,0xee,0xff,
-0xee,0x21,0xeb,0x10,0x13,0x17,0xb6,0x3b,0xf0,0x37,0x5e,0xfd,0xef,0x00,0x03,0xa0,
-0xa0,0x3b,0x03,0xa0,0x02,0xd5,0x99,0x04,0xa0,0x85,0x00,0x39,0xbd,0x20,0x5a,0x0d,
-0xcb,0x10,0x2d,0x1d,0x06,0xf0,0x12,0xd0,0x2d,0xbb,0xe5,0x8c,0x60,0x68,0x02,0x74,
-0x14,0x4b,0x2c,0x1d,0x20,0x09,0x45,0xc0,0xe0,0x4e,0x80,0x01,0xc3,0x89,0x8a,0x06,
-0xf9,0x00,0x58,0x2a,0x0c,0x49,0xc1,0x9a,0x12,0x20,0x00,0x83,0x80,0x00,0x62,0x00,
-0x98,0x0d,0x31,0xf3,0x00,0xfb,0x28,0x0e,0x00,0xc8,0x7d,0x13,0xb3,0x12,0x00,0x20,
-0x04,0xc5,0x81,0x5e,0xf3,0x16,0xaf,0xdd,0xeb,0x35,0x00,0x00,0x14,0xba,0x30,0x1c,
-0x70,0x04,0xef,0xec,0xfc,0xba,0xc6,0x00,0x06,0x30,0xd2,0x53,0x01,0x03,0xb9,0x00,
-0xd2,0x2a,0xb2,0x08,0x30,0x4d,0xd1,0x00,0x47,0x00,0x07,0xd7,0x2e,0xf0,0x05,0x0e,
-0xff,0xff,0xf1,0x01,0xb0,0x90,0xe0,0x1c,0x0d,0x10,0xb5,0x88,0x0e,0x01,0xc0,0xd1,
-0x1a,0xbd,0x10,0x0d,0x00,0xf0,0x07,0x0c,0x2b,0x0e,0xbb,0xfb,0xf1,0x0a,0xb9,0xd4,
-0xe2,0x4d,0x2d,0x10,0x96,0x33,0x3e,0x01,0xc0,0xd1,0x07,0x24,0xb0,0x1a,0x00,0xe0,
-0xc3,0x98,0x4e,0x01,0xc0,0xd1,0x1b,0x1b,0x35,0xee,0xef,0xef,0x12,0x60,0x82,0x52,
-0x02,0x35,0x75,0x01,0x91,0x2c,0x11,0x88,0x2c,0x42,0xf0,0x30,0x1f,0xcb,0xb7,0x00,
-0x3c,0x1d,0x1c,0xd1,0x1c,0x40,0x1d,0x7a,0x79,0x88,0x87,0xb0,0x01,0x9b,0xc1,0x00,
-0x0d,0xe0,0x00,0x01,0xd3,0xb0,0x19,0xcb,0x90,0x01,0xcb,0x9f,0x6e,0x71,0x08,0xe4,
-0x08,0x52,0x63,0x12,0xc9,0x12,0x10,0x83,0x5b,0x00,0x00,0x66,0x00,0x0d,0x29,0x93,
-0x79,0x40,0x00,0x02,0xb0,0xb2,0x10,0x49,0xd8,0x10,0x13,0xca,0x01,0x23,0x75,0x00,
-0xa3,0x00,0xf0,0x0d,0x08,0x70,0x0c,0xee,0xef,0x60,0x01,0xb0,0x80,0xc1,0x00,0x86,
-0x00,0xb4,0x79,0x0c,0x10,0x08,0x60,0x4c,0xcd,0x00,0xce,0xdd,0xf6,0x00,0x1c,0x2a,
-0x0d,0x00,0xf4,0x18,0x1c,0xb9,0xe4,0xc1,0x00,0x86,0x01,0x74,0x24,0x4c,0xcc,0xce,
-0x60,0x08,0x26,0xc0,0xc3,0x11,0x86,0x00,0xd2,0xa9,0x3c,0x10,0x08,0x60,0x2a,0x0c,
-0x43,0xc1,0x00,0x86,0x04,0x60,0x60,0xdf,0xee,0xef,0xe4,0x95,0x09,0x11,0xb0,0x7d,
-0x0c,0x11,0x96,0x9a,0x22,0x20,0x1d,0x07,0x52,0x11,0x20,0x0b,0x46,0x94,0x40,0x31,
-0x04,0xfd,0xd0,0x1a,0x00,0x81,0xb3,0x74,0xee,0xee,0xec,0x00,0x9a,0x5d,0x8c,0x1d,
-0x90,0x85,0x82,0xfe,0xee,0xe7,0x00,0x72,0x49,0x0e,0x6f,0x1d,0xf3,0x06,0x39,0xb0,
-0xe0,0x00,0x77,0x02,0xa1,0xb4,0x1f,0xaa,0xad,0x70,0x24,0x02,0x00,0xe3,0x33,0x96,
-0x00,0x00,0x25,0x4e,0x3b,0xf1,0x3b,0x5d,0xdf,0xdd,0xd0,0x01,0xa0,0x70,0x08,0xa0,
-0x2b,0x00,0xb5,0x97,0x29,0xa0,0x3b,0x50,0x1a,0xac,0x06,0xfd,0xdd,0xdd,0x00,0x0b,
-0x39,0x0e,0x00,0xc0,0xe0,0x09,0xa8,0xe0,0xe0,0x0c,0x0e,0x00,0xa7,0x36,0x1e,0xdd,
-0xfd,0xf0,0x06,0x34,0x80,0xe0,0x00,0x05,0x00,0xa2,0x89,0x0e,0x00,0x00,0x43,0x0b,
-0x19,0x52,0xd0,0x00,0x08,0x51,0x50,0x30,0x08,0xed,0xdd,0xd1,0x00,0x08,0x00,0x02,
-0x60,0xad,0x15,0x00,0x56,0x03,0xf8,0x31,0xc0,0x79,0xde,0xfd,0xdd,0x20,0x86,0x59,
-0x00,0xb5,0x26,0x00,0x2f,0xef,0x10,0x7a,0x00,0xc2,0x00,0x18,0x67,0x6f,0xdd,0xdc,
-0xc0,0x04,0xb1,0xd3,0x45,0x03,0x07,0x11,0xfd,0xbc,0x44,0xa0,0xe0,0x00,0x03,0x12,
-0x50,0x58,0x0e,0x00,0x00,0xb4,0x7a,0x09,0x50,0xe0,0x32,0x0c,0x1a,0x72,0xd1,0x0e,
-0x07,0x52,0x90,0x73,0xd4,0x00,0xad,0xe2,0xb1,0x35,0x00,0x23,0x66,0x21,0x08,0x50,
-0xfc,0x2e,0xf6,0x34,0x85,0x0e,0xce,0x00,0x85,0x74,0xde,0xe8,0xb1,0xc0,0x1c,0x1d,
-0x00,0x85,0x0b,0x48,0x07,0xef,0x50,0x08,0x50,0xb8,0x30,0x02,0xb7,0x0a,0xed,0x6b,
-0xa2,0x01,0xc5,0xc2,0x09,0x40,0xb2,0xa0,0x5a,0x76,0x67,0xca,0x5b,0x0c,0x00,0x56,
-0x81,0x4e,0x53,0xb0,0xb1,0x37,0xa6,0x41,0xd0,0x0b,0xab,0x06,0x4a,0x14,0xa7,0x00,
-0xb0,0x00,0x40,0x10,0x1b,0x00,0x0b,0x15,0x31,0x03,0xea,0x28,0x10,0x7e,0xa6,0x30,
-0xf0,0x20,0xc0,0x70,0x54,0x26,0x08,0x00,0x96,0x79,0x1c,0x0c,0x28,0x50,0x1d,0xcd,
-0x07,0x73,0xb1,0xd0,0x00,0x0c,0x3a,0x0c,0x2a,0x56,0x90,0x0b,0xb8,0xe1,0x46,0x18,
-0x09,0x10,0x85,0x36,0x5b,0xbb,0xbb,0xb0,0x07,0x46,0xb0,0x11,0xa6,0x11,0x00,0xc3,
-0x9b,0x4c,0x05,0x30,0x0d,0x1b,0x51,0xe7,0x3a,0x52,0x90,0x60,0xcd,0xdf,0xed,0x2a,
-0x56,0x01,0xed,0x50,0x11,0x0b,0xba,0x19,0x80,0x05,0xec,0xce,0x20,0x00,0xc1,0x80,
-0xa5,0x1a,0x13,0x71,0x93,0x0f,0xcb,0xcb,0x00,0x0c,0xcb,0x14,0x15,0xf4,0x19,0x0a,
-0x29,0xbd,0xdf,0xed,0xd4,0x07,0xa6,0xd1,0x80,0xa8,0x2a,0x00,0xa8,0x56,0x1a,0x5a,
-0xec,0x20,0x05,0x34,0x80,0x15,0xe7,0xb0,0x00,0xb2,0x8a,0x3b,0x8b,0x38,0x90,0x0b,
-0x0a,0x16,0x20,0xb3,0x09,0x50,0x50,0x97,0x85,0x00,0x01,0x00,0xf0,0x35,0xeb,0xce,
+0x20,0x53,0x00,0x05,0xcc,0xcd,0xfc,0xcc,0xf1,0x00,0x00,0x00,0x0e,0xaf,0x02,0x90,
+0xfd,0xdd,0xfd,0xdd,0xd1,0x00,0x3c,0x00,0x0e,0x0a,0x02,0xf6,0x0a,0xdd,0xdf,0xfd,
+0xdd,0xe7,0x00,0x00,0x0a,0x9e,0x00,0x0a,0x50,0x00,0x5c,0x50,0xe0,0x23,0xd2,0x00,
+0xb7,0x10,0x0e,0x06,0xa6,0x00,0x55,0x00,0x10,0x07,0x55,0x00,0xf0,0x16,0xdc,0xc8,
+0xed,0xcc,0xc6,0x0c,0x58,0x60,0xc6,0x1e,0x00,0x01,0x60,0x23,0x0d,0x20,0x51,0x00,
+0x00,0xac,0xcc,0xfd,0xcc,0xc4,0x00,0x00,0x00,0x0c,0x20,0x00,0x00,0x1d,0xdd,0xdd,
+0xdd,0xdf,0xdd,0x10,0x01,0x41,0x02,0xd0,0x00,0x09,0x0d,0x00,0x50,0x30,0x00,0x8a,
+0x00,0x02,0xf1,0x00,0x30,0x7c,0x00,0x2d,0x49,0x00,0xf4,0x42,0x22,0xee,0x80,0x00,
+0x00,0xb1,0x00,0x0a,0x30,0x00,0x00,0x6e,0xec,0xc9,0xfd,0xec,0xc2,0x3d,0x18,0x51,
+0xd2,0x0c,0x10,0x00,0x1a,0xb9,0x9a,0x99,0xae,0x00,0x00,0xab,0x99,0x99,0x9a,0xe0,
+0x00,0x0a,0x73,0x33,0x33,0x4e,0x00,0x00,0xa9,0x66,0x66,0x67,0xe0,0x00,0x09,0xbc,
+0xaa,0xab,0xbc,0x00,0x00,0x00,0xe0,0x00,0xa4,0x00,0x02,0xcc,0xdf,0xcc,0xce,0xdc,
+0xc3,0x00,0x3d,0x50,0x00,0xa4,0x00,0x00,0xab,0x30,0x00,0x0a,0x40,0xa2,0x00,0xf0,
+0x18,0x03,0xa0,0x00,0x09,0x30,0x00,0x09,0xdc,0xbb,0x2f,0xcc,0xba,0x4d,0x08,0x61,
+0xa5,0x1d,0x10,0x16,0x45,0x57,0xc4,0x46,0x42,0x0d,0x87,0x77,0x77,0x77,0xa9,0x0c,
+0x6b,0xbb,0xbb,0xbb,0x58,0x00,0x68,0x00,0xf0,0x00,0x71,0x6d,0xbb,0xbb,0xbe,0x00,
+0x00,0x68,0x37,0x00,0x50,0x6e,0xcc,0xcc,0xcd,0xb0,0x0c,0x00,0xf1,0x29,0x03,0xb0,
+0x00,0x6e,0xbb,0xbb,0xbc,0xb0,0x00,0xc0,0x00,0x08,0x60,0x00,0x00,0x7f,0xcc,0xc2,
+0xfd,0xdc,0xc3,0x3e,0x1d,0x11,0xd5,0x1e,0x20,0x04,0x40,0x53,0x27,0x00,0x65,0x00,
+0x0b,0xdc,0xcf,0x0d,0xee,0xed,0x00,0xb7,0x44,0xf0,0xd1,0x01,0xd0,0x0b,0x75,0x5f,
+0x0d,0x10,0x1d,0x00,0xbc,0xbb,0x0d,0x00,0x20,0x41,0x81,0x0d,0x00,0xf0,0x54,0xb3,
+0x0c,0x60,0xd2,0x35,0xc0,0x0e,0x9a,0xde,0x1d,0x1a,0xa4,0x01,0x95,0x20,0x63,0xd1,
+0x00,0x00,0x00,0x93,0x00,0x09,0x50,0x00,0x00,0x4f,0xed,0xca,0xfd,0xdc,0xc6,0x1e,
+0x29,0x51,0xd2,0x1d,0x10,0x00,0x42,0x85,0x22,0x34,0x75,0x40,0x09,0x9d,0xb9,0x7b,
+0xa8,0x8f,0x00,0x7a,0xdb,0xa5,0xb3,0x00,0xe0,0x0b,0x4a,0x67,0x7b,0x30,0x0e,0x00,
+0xb7,0xb9,0xa7,0xb3,0x24,0xe0,0x0a,0xad,0xbc,0x7b,0x34,0x95,0x00,0x00,0x95,0x00,
+0xb3,0x00,0x24,0x2b,0xbd,0xcb,0xab,0x30,0x05,0x90,0x00,0x84,0x00,0x6e,0xdd,0xe3,
+0x00,0xc0,0xc9,0x02,0xf3,0x39,0x00,0x7f,0xcb,0xad,0xec,0xcb,0xb3,0x3d,0x1c,0x07,
+0xb0,0x4e,0x10,0x02,0x30,0x45,0xdb,0x50,0x52,0x00,0x00,0x29,0xc2,0x18,0xd6,0x10,
+0x03,0xbb,0x48,0x99,0x92,0x6c,0xc2,0x13,0xab,0xb7,0x4b,0xbb,0x91,0x00,0x0e,0x04,
+0xa6,0x70,0x1d,0x00,0x00,0xeb,0xca,0x6d,0xbb,0xd0,0x00,0x02,0xe1,0x00,0x9a,0x00,
+0x00,0x05,0xca,0xc2,0x9b,0xad,0x82,0x03,0xa1,0x03,0x95,0x00,0x06,0xb0,0xd5,0x01,
+0xf4,0x38,0x2f,0xdc,0xb5,0xec,0xdb,0xb0,0x2d,0x46,0x80,0xa5,0x0b,0x20,0x00,0x2b,
+0x70,0x6a,0x0d,0x1b,0x10,0x09,0x69,0x5b,0x76,0xc1,0x45,0x04,0xba,0xeb,0xea,0xbe,
+0xba,0xa2,0x06,0x8c,0x0e,0x85,0x94,0x56,0x00,0x23,0xc0,0xd3,0x17,0x6c,0x20,0x04,
+0x7c,0x0e,0x74,0x3d,0xb0,0x00,0x89,0xc0,0xe9,0x61,0xf2,0x00,0x00,0x1d,0x2d,0x44,
+0xcd,0x68,0x23,0xba,0x97,0x66,0xe4,0x1c,0xc0,0x88,0x01,0xf0,0x0d,0x0d,0x00,0x00,
+0xe1,0x00,0x01,0x90,0xd0,0xd0,0x0e,0x10,0x00,0x0b,0x1d,0x39,0x00,0xe1,0x00,0x00,
+0x94,0xd9,0x30,0x0e,0xdd,0xd4,0x26,0x6e,0x75,0xc5,0x04,0xf0,0x0e,0x6a,0xe6,0x60,
+0x0e,0x10,0x00,0x00,0xcf,0x60,0xee,0xfe,0xee,0x00,0x59,0xda,0x5e,0x00,0x00,0xe0,
+0x1d,0x2d,0x06,0xe0,0x00,0x0e,0x06,0x50,0xd0,0x0e,0xe6,0x01,0xd9,0x0d,0x00,0xfb,
+0xbb,0xbf,0x00,0x00,0xd0,0x0e,0x22,0x22,0xe0,0x00,0x01,0x00,0x20,0x06,0x70,0x66,
+0x02,0xf0,0x28,0x0a,0x67,0xa5,0xbb,0xfc,0xbb,0x50,0xa7,0x7b,0x00,0x0c,0x30,0x00,
+0x08,0xaa,0x70,0xaa,0xeb,0xaa,0x11,0x69,0xa5,0x57,0x7e,0x87,0x75,0x28,0xdc,0x82,
+0x33,0x33,0x33,0x20,0x0e,0xe1,0x0e,0xbb,0xbb,0xe0,0x05,0xeb,0xb0,0xe5,0x55,0x5e,
+0x00,0xd8,0x77,0x0e,0x44,0x44,0xe0,0x3a,0x67,0x00,0x1a,0x05,0x21,0x16,0x70,0x62,
+0x00,0x55,0x67,0x00,0xe0,0x08,0xca,0x56,0x00,0xf0,0x0d,0x01,0x35,0x7a,0x90,0x00,
+0x6d,0xed,0xfc,0x97,0x41,0x00,0x00,0x00,0x89,0x00,0x33,0x00,0x00,0x00,0x98,0x00,
+0x6d,0x40,0x00,0x00,0xbf,0xcd,0xfa,0x91,0x04,0xf1,0x20,0x07,0xd5,0x02,0xd1,0x00,
+0x00,0x5d,0xb5,0x56,0x7c,0xd0,0x00,0x6c,0xb9,0x8f,0x64,0x37,0xa0,0x00,0x07,0x40,
+0xe1,0x66,0x02,0x00,0x07,0xc0,0x0e,0x10,0xb9,0x00,0x0a,0xc1,0x00,0xe1,0x00,0xab,
+0x00,0x20,0x09,0xec,0x00,0x00,0x20,0x00,0x0b,0x10,0xa9,0x00,0xe0,0x90,0x3e,0xee,
+0xee,0xe0,0x01,0xc0,0xa1,0x00,0xa5,0x00,0x01,0xc7,0x7a,0x55,0x03,0xf0,0x01,0x3b,
+0xbe,0x20,0x00,0xa5,0x00,0x00,0x1c,0x3a,0x20,0x0a,0x50,0x00,0x1d,0xca,0xd7,0x1a,
+0x00,0x90,0x85,0x22,0x40,0x0a,0x50,0x00,0x07,0x29,0xa2,0x1a,0x00,0xe2,0xd0,0xd4,
+0x60,0x0a,0x50,0x00,0x2b,0x0c,0x0b,0xee,0xff,0xee,0x21,0x30,0x9b,0x00,0x11,0x17,
+0x06,0x00,0xf3,0x4a,0x09,0x50,0x5e,0xfd,0xef,0x00,0x03,0xa0,0xa0,0x3b,0x03,0xa0,
+0x02,0xd5,0x99,0x04,0xa0,0x85,0x00,0x39,0xbd,0x20,0x5a,0x0d,0xcb,0x10,0x2d,0x1d,
+0x06,0xf0,0x12,0xd0,0x2d,0xbb,0xe5,0x8c,0x60,0x68,0x02,0x74,0x14,0x4b,0x2c,0x1d,
+0x20,0x09,0x45,0xc0,0xe0,0x4e,0x80,0x01,0xc3,0x89,0x8a,0x06,0xf9,0x00,0x58,0x2a,
+0x0c,0x49,0xc1,0x9a,0x12,0x20,0x00,0x83,0x80,0x00,0x62,0x00,0xfc,0xcc,0xfc,0xcc,
+0xf3,0x00,0xfb,0xbb,0xfc,0xbb,0xe3,0x00,0xe0,0x00,0xd1,0x00,0xb3,0x12,0x00,0xf1,
+0x1c,0x04,0xc5,0x03,0xa0,0x00,0x00,0xaf,0xdd,0xeb,0x35,0x00,0x00,0x14,0xba,0x30,
+0x1c,0x70,0x04,0xef,0xec,0xfc,0xba,0xc6,0x00,0x06,0x30,0xd2,0x53,0x01,0x03,0xb9,
+0x00,0xd2,0x2a,0xb2,0x08,0x30,0x4d,0xd1,0x00,0x47,0x00,0x07,0x90,0x00,0xf0,0x07,
+0x07,0x70,0x0e,0xff,0xff,0xf1,0x01,0xb0,0x90,0xe0,0x1c,0x0d,0x10,0xb5,0x88,0x0e,
+0x01,0xc0,0xd1,0x1a,0xbd,0x10,0x0d,0x00,0xf0,0x07,0x0c,0x2b,0x0e,0xbb,0xfb,0xf1,
+0x0a,0xb9,0xd4,0xe2,0x4d,0x2d,0x10,0x96,0x33,0x3e,0x01,0xc0,0xd1,0x07,0x24,0xb0,
+0x1a,0x00,0xf0,0x01,0xc3,0x98,0x4e,0x01,0xc0,0xd1,0x1b,0x1b,0x35,0xee,0xef,0xef,
+0x12,0x60,0x30,0x0e,0x04,0x04,0x03,0xb8,0x03,0xf0,0x38,0xc0,0x00,0x88,0x00,0x00,
+0x00,0xa5,0x00,0x1f,0xcb,0xb7,0x00,0x3c,0x1d,0x1c,0xd1,0x1c,0x40,0x1d,0x7a,0x79,
+0x88,0x87,0xb0,0x01,0x9b,0xc1,0x00,0x0d,0xe0,0x00,0x01,0xd3,0xb0,0x19,0xcb,0x90,
+0x01,0xcb,0x9f,0x6e,0x71,0x08,0xe4,0x08,0x52,0x63,0x12,0xc9,0x12,0x10,0x83,0x5b,
+0x00,0x00,0x66,0x00,0x0d,0x29,0x93,0x79,0x40,0x00,0x02,0xb0,0xb2,0x10,0x49,0xd8,
+0x10,0x13,0xca,0x01,0x23,0x75,0x00,0xa3,0x00,0xf0,0x0d,0x08,0x70,0x0c,0xee,0xef,
+0x60,0x01,0xb0,0x80,0xc1,0x00,0x86,0x00,0xb4,0x79,0x0c,0x10,0x08,0x60,0x4c,0xcd,
+0x00,0xce,0xdd,0xf6,0x00,0x1c,0x2a,0x0d,0x00,0xf3,0x18,0x1c,0xb9,0xe4,0xc1,0x00,
+0x86,0x01,0x74,0x24,0x4c,0xcc,0xce,0x60,0x08,0x26,0xc0,0xc3,0x11,0x86,0x00,0xd2,
+0xa9,0x3c,0x10,0x08,0x60,0x2a,0x0c,0x43,0xc1,0x00,0x86,0x04,0x60,0x60,0xdf,0xee,
+0xef,0xe4,0xa3,0x00,0xf1,0x0d,0x02,0xb0,0x00,0x0d,0x20,0x00,0x00,0x96,0x00,0x00,
+0xd2,0x00,0x00,0x1d,0x07,0x9e,0xef,0xee,0xe2,0x0b,0x46,0x80,0x00,0xd2,0x00,0x04,
+0xfd,0xd0,0x1a,0x00,0x80,0xb3,0x74,0xee,0xee,0xec,0x00,0x9a,0x5d,0x2d,0x00,0xf2,
+0x14,0x2b,0x85,0x82,0xfe,0xee,0xe7,0x00,0x72,0x49,0x0e,0x00,0x07,0x70,0x0d,0x39,
+0xb0,0xe0,0x00,0x77,0x02,0xa1,0xb4,0x1f,0xaa,0xad,0x70,0x24,0x02,0x00,0xe3,0x33,
+0x96,0x00,0x00,0x25,0xd6,0x01,0xf0,0x41,0x40,0x5d,0xdf,0xdd,0xd0,0x01,0xa0,0x70,
+0x08,0xa0,0x2b,0x00,0xb5,0x97,0x29,0xa0,0x3b,0x50,0x1a,0xac,0x06,0xfd,0xdd,0xdd,
+0x00,0x0b,0x39,0x0e,0x00,0xc0,0xe0,0x09,0xa8,0xe0,0xe0,0x0c,0x0e,0x00,0xa7,0x36,
+0x1e,0xdd,0xfd,0xf0,0x06,0x34,0x80,0xe0,0x00,0x05,0x00,0xa2,0x89,0x0e,0x00,0x00,
+0x43,0x0b,0x19,0x52,0xd0,0x00,0x08,0x51,0x50,0x30,0x08,0xed,0xdd,0xd1,0x00,0x08,
+0x00,0x02,0x60,0x00,0x00,0x06,0x80,0x00,0x56,0x03,0xf7,0x34,0xc0,0x79,0xde,0xfd,
+0xdd,0x20,0x86,0x59,0x00,0xb5,0x26,0x00,0x2f,0xef,0x10,0x7a,0x00,0xc2,0x00,0x18,
+0x67,0x6f,0xdd,0xdc,0xc0,0x04,0xb1,0xd3,0x45,0x03,0x07,0x11,0xfd,0xbc,0x44,0xa0,
+0xe0,0x00,0x03,0x12,0x50,0x58,0x0e,0x00,0x00,0xb4,0x7a,0x09,0x50,0xe0,0x32,0x0c,
+0x1a,0x72,0xd1,0x0e,0x07,0x52,0x90,0x73,0xd4,0x00,0xad,0xe2,0x00,0x00,0x01,0x70,
+0x03,0xf5,0x3d,0x0b,0x10,0x08,0x50,0x00,0x00,0x02,0xc0,0x00,0x85,0x0e,0xce,0x00,
+0x85,0x74,0xde,0xe8,0xb1,0xc0,0x1c,0x1d,0x00,0x85,0x0b,0x48,0x07,0xef,0x50,0x08,
+0x50,0xb8,0x30,0x02,0xb7,0x0a,0xed,0x6b,0xa2,0x01,0xc5,0xc2,0x09,0x40,0xb2,0xa0,
+0x5a,0x76,0x67,0xca,0x5b,0x0c,0x00,0x56,0x81,0x4e,0x53,0xb0,0xb1,0x37,0xa6,0x41,
+0xd0,0x0b,0xab,0x06,0x4a,0x14,0xa7,0x00,0xb0,0x00,0x40,0x10,0x1b,0x00,0x0b,0x55,
+0x00,0x12,0x07,0xcb,0x03,0xf0,0x26,0x80,0x7e,0xee,0xee,0xe5,0x00,0xc0,0x70,0x54,
+0x26,0x08,0x00,0x96,0x79,0x1c,0x0c,0x28,0x50,0x1d,0xcd,0x07,0x73,0xb1,0xd0,0x00,
+0x0c,0x3a,0x0c,0x2a,0x56,0x90,0x0b,0xb8,0xe1,0x46,0x18,0x09,0x10,0x85,0x36,0x5b,
+0xbb,0xbb,0xb0,0x07,0x46,0xb0,0x11,0xa6,0x11,0x00,0xc3,0x9b,0x4c,0x05,0xd4,0x0d,
+0x1b,0x51,0x00,0x95,0x00,0x02,0x90,0x60,0xcd,0xdf,0xed,0xd6,0x55,0x00,0x11,0x18,
+0x61,0x00,0xf0,0x07,0x07,0x50,0x05,0xec,0xce,0x20,0x00,0xc1,0x80,0xa5,0x00,0xe0,
+0x00,0x86,0x93,0x0f,0xcb,0xcb,0x00,0x0c,0xcb,0x00,0xcf,0x05,0xf4,0x1d,0x0a,0x29,
+0xbd,0xdf,0xed,0xd4,0x07,0xa6,0xd1,0x80,0xa8,0x2a,0x00,0xa8,0x56,0x1a,0x5a,0xec,
+0x20,0x05,0x34,0x80,0x15,0xe7,0xb0,0x00,0xb2,0x8a,0x3b,0x8b,0x38,0x90,0x0b,0x0a,
+0x16,0x20,0xb3,0x09,0x50,0x50,0x00,0x05,0xdd,0x10,0x54,0x00,0xf4,0x38,0xeb,0xce,
 0xb6,0xfd,0xde,0x90,0x0e,0x9a,0xad,0x06,0x70,0xc3,0x00,0xe6,0x66,0xc0,0x0b,0xb8,
 0x00,0x0e,0x35,0xb3,0x02,0xbe,0x81,0x00,0xab,0xbb,0xc7,0xb3,0x06,0xd1,0x00,0x03,
 0x99,0x15,0x70,0x00,0x00,0x06,0xaa,0xfc,0x52,0x80,0x00,0x02,0x7b,0xfa,0x89,0xad,
 0xc2,0x00,0x46,0x76,0x3e,0x23,0x32,0x50,0x01,0x8c,0x20,0xd1,0x3a,0xa1,0x00,0x85,
-0x03,0xbd,0xb2,0x58,0x04,0x83,0x58,0x01,0xaf,0x85,0xf2,0x05,0xa5,0x00,0xab,0xed,
-0xbb,0x00,0x2c,0x1d,0x0e,0x00,0x00,0xf0,0x0c,0x7a,0x70,0xeb,0xbb,0xbf,0x01,0xcc,
-0xf7,0x04,0xf4,0x1c,0xc4,0xa0,0xec,0xcc,0xcf,0x00,0xab,0x6e,0x00,0x01,0xe0,0x30,
-0x0b,0x86,0xa7,0xcd,0x6f,0x6c,0x10,0x53,0x48,0x01,0xd2,0xfd,0x10,0x0c,0x47,0xc0,
-0xa7,0x1d,0x95,0x00,0xc2,0x93,0xb8,0x01,0xd0,0xc6,0x15,0x02,0x02,0x09,0xe9,0x4e,
-0x5f,0x00,0xfc,0x35,0x10,0xc0,0x1b,0x5b,0xf0,0x09,0xaa,0xeb,0xa6,0x08,0x68,0x5d,
-0x11,0x11,0x68,0x1c,0x0d,0x0d,0x00,0x00,0x58,0x9e,0xf6,0x0d,0xcc,0xcc,0xc6,0x03,
-0xb7,0x1d,0x26,0x09,0xf5,0x14,0x49,0x6e,0xeb,0xee,0xbe,0x59,0x76,0x8e,0xb0,0xaa,
-0x0b,0x17,0x89,0x1d,0xeb,0xee,0xbe,0x48,0xb7,0x9b,0xb0,0xaa,0x0b,0x75,0xa2,0xa7,
-0xb0,0xaa,0x0b,0x81,0x30,0x72,0xb0,0x66,0x5b,0x45,0x01,0xf0,0x0b,0x01,0x35,0x79,
-0x00,0x07,0x70,0x2c,0xab,0x85,0x70,0x00,0xd1,0x90,0x93,0x85,0x2c,0x00,0x85,0x5a,
-0x04,0x73,0x6a,0x40,0x2f,0xcd,0x10,0xb7,0x89,0xf6,0x1e,0x0a,0x39,0x14,0x8a,0x44,
-0x43,0x08,0xa6,0xc7,0x6c,0x96,0x66,0x50,0x96,0x43,0x50,0xdd,0xcc,0xb0,0x07,0x34,
-0xa1,0x2e,0xc0,0x89,0x00,0xb3,0x86,0x6a,0x67,0xcc,0x00,0x1a,0x1a,0x1c,0xc4,0xbc,
-0xd8,0x21,0x30,0x00,0x84,0xb3,0x00,0x79,0xb5,0x70,0x20,0x0b,0x20,0x0d,0x3e,0xf7,
-0x35,0xaa,0xeb,0xaa,0x20,0x2a,0x1b,0x22,0x2c,0x52,0x20,0x0b,0x7b,0x55,0xcc,0xfd,
-0xcb,0x02,0xbb,0xc0,0x76,0x3a,0x15,0xd0,0x00,0xc3,0xa7,0x59,0xa3,0x8d,0x00,0x99,
-0x4d,0x75,0x5a,0x42,0xd0,0x1e,0xb8,0xb8,0xcd,0xff,0xcb,0x00,0x41,0x37,0x00,0xce,
-0xc4,0x00,0x0c,0x38,0xa0,0x88,0xb3,0xc3,0x00,0xb1,0xa7,0xa9,0x0b,0x21,0xd2,0x26,
-0x05,0x02,0x00,0xb2,0x01,0xeb,0x07,0x00,0x99,0x02,0x20,0x94,0x0b,0x6d,0x08,0x30,
-0x1c,0x1a,0xd0,0x79,0x36,0xf0,0x79,0x48,0x34,0x5b,0x11,0x12,0x22,0xfd,0xa0,0x0a,
-0x7a,0xce,0xa7,0x00,0xa4,0x51,0xe0,0x06,0x80,0x00,0x77,0x3b,0x9e,0x0e,0xcc,0xd7,
-0x1c,0x97,0x8c,0xe0,0xd0,0x06,0x70,0x63,0x39,0x2e,0x0e,0xcc,0xd7,0x0b,0x47,0xa2,
-0xe0,0xd0,0x06,0x71,0xa2,0x93,0x3e,0x0e,0x99,0xc7,0x13,0x00,0x01,0xe0,0xd2,0x27,
-0x60,0x00,0x60,0x00,0x50,0x50,0x51,0x00,0x2c,0x00,0x58,0x39,0x0d,0x00,0x07,0x56,
-0x1c,0x16,0xb0,0xf1,0x00,0xc2,0xb7,0x77,0xb8,0xba,0x90,0x8e,0xe3,0x08,0x7a,0x0b,
-0x0b,0x01,0x3a,0x51,0xe0,0x10,0xa0,0x00,0x0b,0x2b,0xaf,0x0a,0x3d,0x00,0x06,0xeb,
-0xc4,0xc0,0xb1,0xdc,0xa0,0x02,0x37,0x0c,0x0d,0x0d,0x00,0x03,0x8a,0xa0,0xc0,0xf6,
-0xd0,0x00,0x55,0xa6,0x3c,0x56,0xbf,0x00,0x09,0x28,0x00,0xc9,0x00,0x9e,0xd1,0xde,
-0x03,0x10,0x71,0x29,0x0a,0xf0,0x12,0x08,0x8e,0x98,0x80,0x01,0xd0,0x70,0xd3,0xa3,
-0x3d,0x00,0xa4,0x68,0x0c,0x6a,0x9a,0xc0,0x1d,0xcd,0x00,0xc4,0x7c,0x1c,0x00,0x0a,
-0x29,0x0c,0x69,0x66,0xc0,0x07,0xba,0xe0,0xfc,0x01,0xf4,0x11,0xc7,0x26,0x31,0x17,
-0x31,0x10,0x02,0x12,0x50,0x46,0x3b,0x37,0x00,0xa5,0x7b,0x2a,0xc0,0x81,0xc1,0x0c,
-0x19,0x79,0x5c,0x00,0x78,0x71,0x80,0x50,0x30,0x9d,0xcc,0x10,0xf1,0x00,0x11,0x80,
-0xe9,0x08,0xf0,0x13,0xa5,0x0a,0xaa,0xec,0xaa,0x40,0x2c,0x18,0x49,0x9c,0xa9,0x80,
-0x0a,0x59,0x69,0xaa,0xaa,0xaa,0x31,0xdc,0xc0,0xc0,0x92,0x83,0x85,0x00,0xb5,0x7b,
-0xab,0xab,0xbb,0x40,0x9a,0x6d,0xb1,0x0b,0xf4,0x11,0x0b,0x86,0xb8,0xa7,0x77,0x7e,
-0x00,0x64,0x57,0x7a,0x66,0x66,0xe0,0x0c,0x47,0xb7,0xb9,0x99,0x9e,0x00,0xb2,0x84,
-0x28,0xb0,0x4b,0x50,0x25,0x02,0x1b,0x50,0x00,0x17,0x8b,0x19,0x03,0x33,0x04,0x70,
-0xb3,0x06,0xbb,0xed,0xba,0x00,0x2d,0x85,0x7b,0xf0,0x30,0xe0,0x09,0x55,0x89,0x50,
-0x00,0x0e,0x03,0xe6,0xc1,0xad,0xcc,0xcc,0xb0,0x39,0xb6,0x0a,0x51,0x11,0x12,0x00,
-0x2b,0x00,0xbe,0xae,0xcc,0xe0,0x1d,0xca,0x4c,0xd0,0xa5,0x5b,0x01,0x41,0x01,0xec,
-0xce,0xdd,0xe0,0x01,0x7d,0x7b,0xb0,0xa5,0x5b,0x04,0xe7,0x18,0x7b,0x0a,0x55,0xb0,
-0x00,0x00,0x91,0xb0,0xa5,0x8b,0x00,0x06,0xdb,0xdd,0x90,0x32,0xf0,0x08,0x69,0x49,
-0x94,0x99,0x48,0x90,0x02,0x55,0x56,0xe5,0x55,0x53,0x00,0xcc,0xcc,0xde,0xcc,0xcc,
-0xb0,0x00,0x36,0x6a,0xb6,0x47,0x4a,0xf5,0x02,0x93,0x33,0x33,0x97,0x00,0x00,0x7c,
-0x99,0x99,0x9c,0x70,0x00,0x07,0xb7,0x77,0x77,0xb7,0x0d,0x00,0x10,0x60,0xa0,0x22,
-0x70,0x2b,0xdd,0xbb,0xbb,0xbd,0xdb,0x20,0xb7,0x41,0x10,0x1a,0x88,0x5f,0x00,0xc6,
-0x1c,0x10,0x07,0xab,0x46,0x14,0xdb,0x02,0x6f,0x00,0x47,0x2f,0x13,0xd3,0x0d,0x00,
-0x02,0xbf,0x0e,0xb0,0x60,0x12,0x22,0x3e,0x22,0x22,0x20,0x08,0xbb,0xbd,0xfe,0x00,
-0x8e,0x30,0x01,0xe4,0xd4,0x1c,0x51,0xc9,0xe6,0x02,0xd9,0x20,0x01,0xdd,0x92,0x00,
-0x00,0x7d,0xe4,0x01,0x13,0x10,0x02,0xa1,0x19,0x64,0x07,0xbb,0xfb,0xbb,0xfc,0xb8,
-0x7f,0x8b,0xf0,0x28,0x88,0x88,0xf8,0x88,0x80,0x02,0x99,0x99,0x9f,0x99,0x99,0x92,
-0x04,0x67,0x9c,0x5c,0x2a,0x52,0x00,0x77,0xa8,0x10,0xd1,0x3c,0x40,0x2b,0xbd,0xdb,
-0xbf,0xcb,0xcc,0x30,0x00,0x77,0x22,0x59,0x19,0x00,0x3d,0xce,0xd9,0x60,0xec,0x40,
-0x00,0x00,0x76,0x04,0xbd,0xd1,0x65,0x02,0xbd,0x46,0xa4,0x28,0x04,0x20,0x23,0x66,
-0x59,0x0c,0xf1,0x75,0x9e,0x55,0x6c,0xe8,0xcd,0x0a,0x1d,0x56,0x00,0xc0,0x0c,0x6d,
-0xcf,0xec,0x74,0xc8,0x2c,0x00,0xbf,0x90,0x1a,0xc2,0x8c,0x0a,0x7d,0x4c,0x16,0xc0,
-0x5c,0x88,0x09,0x02,0x01,0xe0,0x2d,0x2e,0xce,0xcd,0x1c,0xe2,0xcd,0x1c,0x4c,0x4d,
-0x83,0xc8,0x2c,0x1c,0x4c,0x4c,0x00,0xc0,0x0c,0x1e,0xbe,0xbd,0x00,0xc0,0x0d,0x1a,
-0x00,0x0a,0x0c,0xb2,0xd9,0x1b,0xcb,0xbd,0x4d,0xbb,0xbe,0x00,0x1b,0x24,0xd0,0x5a,
-0x15,0xe0,0x06,0x99,0x6d,0x28,0xa9,0x5e,0x00,0x1b,0xaa,0xde,0xb9,0x9d,0x40,0x00,
-0xd7,0x77,0xf7,0x77,0xf0,0x00,0x0d,0x33,0x3f,0x33,0x3f,0x00,0x00,0x8a,0xf9,0x99,
-0xfa,0x90,0x00,0x68,0x8e,0x88,0x8e,0x98,0x80,0x1a,0xab,0xfa,0xaa,0xfb,0xaa,0x60,
-0x04,0x9a,0x00,0x1a,0xa6,0x10,0x0a,0x82,0xed,0x25,0x01,0x46,0x12,0x10,0x12,0x4b,
-0x07,0x00,0xb2,0x53,0x50,0xcd,0xde,0xed,0xde,0x50,0x1a,0x3f,0x20,0x1b,0x50,0xc6,
-0x65,0x71,0xef,0xfd,0xdd,0x50,0x00,0x03,0xba,0xe0,0x24,0xe0,0xfe,0xbb,0xbb,0x90,
-0x01,0xdc,0xa9,0x11,0x11,0x3d,0x00,0x02,0x05,0xd9,0xa2,0x56,0x51,0x00,0x5a,0x22,
-0x22,0x4d,0xa2,0x3b,0x00,0xab,0x0b,0x10,0x5e,0xcb,0x5a,0x10,0x00,0x15,0x6d,0xf0,
-0x02,0xb5,0x00,0xbb,0xfb,0x72,0x7c,0xa3,0x00,0x02,0x2e,0x21,0xb6,0xe1,0x00,0x00,
-0x12,0xe2,0x7c,0x01,0x60,0x07,0xaf,0xa4,0x36,0xeb,0xdd,0x6c,0x58,0xf0,0x10,0x7e,
-0x30,0x00,0x2d,0xef,0xec,0x00,0xd1,0x01,0x10,0x0a,0xfa,0x05,0x8f,0xdd,0xc5,0x04,
-0xae,0x97,0x85,0xe2,0x00,0x02,0xd1,0xe0,0x50,0x0d,0x10,0x15,0x03,0x0e,0xb7,0x73,
-0x10,0x90,0x48,0x19,0x22,0xdd,0xe4,0x6d,0x0b,0xf0,0x2f,0x01,0xbd,0xdb,0x3e,0xce,
-0xdc,0xf0,0x02,0x89,0x20,0xd7,0xc9,0x7e,0x00,0x17,0x91,0x0d,0x7c,0x97,0xe0,0x0a,
-0xdd,0xb1,0xd3,0xb5,0x3e,0x01,0x39,0xa3,0x15,0x5c,0x75,0x50,0x27,0xde,0x76,0xcc,
-0xed,0xcc,0x50,0x1f,0xe7,0x47,0x09,0x24,0x56,0x08,0xc8,0xc6,0x70,0x94,0xc6,0x63,
-0xc6,0x81,0x4c,0xdd,0xba,0xb6,0x33,0x68,0x04,0x29,0x02,0x67,0x06,0x80,0x47,0x00,
-0x08,0xd4,0xae,0xbd,0xf0,0x33,0x00,0x30,0x04,0xfe,0xfe,0x19,0x00,0x57,0x00,0x09,
-0x37,0x6b,0x5a,0x3c,0x68,0x00,0x9d,0xe6,0x7e,0x22,0x6e,0x30,0x09,0x37,0x58,0x5a,
-0x0a,0x4a,0x00,0x93,0x78,0xfb,0xd9,0xeb,0xb5,0x09,0xef,0x65,0x18,0x26,0x04,0x10,
-0x93,0x75,0x92,0xd0,0xd0,0xc0,0x09,0x38,0x89,0x7e,0x0e,0x6c,0x04,0xee,0xda,0x47,
-0xe0,0xe6,0xc0,0x00,0x07,0x50,0x78,0x0d,0x42,0x5e,0x36,0x5a,0x00,0xd0,0x04,0x89,
-0x11,0x30,0x66,0x75,0xf0,0x26,0xda,0x95,0x8b,0xc9,0x00,0x05,0x8a,0x98,0x6b,0x01,
-0xb9,0x00,0x6a,0xb9,0xc3,0xcc,0xaf,0x20,0x09,0xac,0xad,0x31,0xdd,0x60,0x00,0xc0,
-0x00,0x04,0xa5,0x38,0xb0,0x0b,0xbe,0xaa,0xaa,0xae,0xba,0x10,0x02,0xea,0xaa,0xaa,
-0xe2,0x00,0x00,0x2d,0x33,0x33,0x3d,0x20,0x00,0x02,0xe6,0x4c,0x49,0x30,0x0b,0xcf,
-0xbc,0x60,0x7d,0x13,0x11,0x8f,0x18,0x10,0x86,0xeb,0x85,0x60,0xbc,0xce,0x60,0xd7,
-0xad,0x80,0x0d,0x00,0xf2,0x02,0x72,0x00,0x01,0x69,0xbd,0x60,0xc4,0x22,0x78,0x16,
-0x30,0x64,0x04,0xaa,0xa9,0x20,0x02,0x10,0x35,0x11,0x2c,0x54,0x13,0x10,0x02,0x75,
-0x80,0x0f,0x0d,0x00,0x03,0x4c,0xc0,0x00,0x4d,0xd9,0x4f,0x63,0x30,0x51,0x00,0xd0,
-0x3f,0x09,0xf0,0x13,0xc3,0x0d,0x05,0xc3,0x01,0xd5,0x37,0xc1,0xfd,0x93,0x00,0x3b,
-0xa8,0x7b,0x4e,0x00,0x04,0x00,0x33,0x33,0x30,0xe0,0x00,0xd1,0x0d,0x99,0xad,0x0a,
-0xdd,0xd9,0x00,0xd6,0x67,0xd0,0xf6,0x26,0xf2,0x10,0x54,0x5d,0x0e,0x28,0xd4,0x00,
-0xda,0x9a,0xd0,0xf9,0x40,0x00,0x0d,0x21,0x3d,0x0e,0x00,0x07,0x20,0xd0,0x01,0xd0,
-0xe0,0x00,0xc2,0x0d,0x07,0xe9,0x0a,0xdd,0xda,0xe8,0x08,0xc0,0x71,0x00,0xce,0xdd,
-0x18,0xbd,0xc8,0x20,0x0c,0x00,0xd3,0xa2,0xc0,0x00,0xf6,0x2a,0x2d,0x37,0x03,0x7c,
-0x40,0x0c,0xcb,0xd3,0x7d,0xad,0x20,0x00,0xd0,0x0d,0x47,0xd0,0xc0,0x40,0x0d,0x11,
-0xd5,0x6d,0x0b,0x8a,0x00,0xed,0xdd,0x55,0xd0,0x89,0x00,0x0c,0x00,0xd7,0x4d,0x04,
-0x90,0x02,0xb0,0x0d,0xa1,0xd0,0x0d,0x00,0x68,0x00,0xdb,0x0d,0xb7,0x79,0x09,0x37,
-0xea,0xa0,0xc3,0x00,0xa0,0x5d,0x0b,0xf0,0x0b,0x01,0x00,0x00,0x0c,0xef,0x0b,0x2b,
-0x0c,0xde,0x0c,0x0c,0x3a,0x05,0x7c,0x0c,0x0c,0x2d,0x92,0xc0,0x9c,0x0c,0x0c,0xbf,
-0x04,0xd9,0x0c,0x01,0x00,0xf0,0x07,0x1b,0x4c,0x0c,0x0c,0x0c,0xa6,0x02,0xdd,0x0c,
-0x0d,0xdf,0x2e,0xde,0x3c,0x0c,0x0b,0x0c,0x0b,0x0a,0x1c,0x0c,0x1b,0x06,0x00,0xc5,
-0x7b,0x48,0x0c,0x0f,0xdf,0x1c,0x00,0x64,0xbb,0x0a,0x0a,0x1c,0x1d,0x13,0x12,0x90,
-0x53,0x1d,0x00,0x23,0x13,0x41,0xfe,0x10,0x00,0x00,0x46,0x4c,0x51,0xfe,0xed,0xdd,
-0xdd,0xdf,0x09,0x00,0x81,0xba,0xaa,0xaa,0xaf,0xe4,0x33,0x33,0x33,0x1b,0x00,0x00,
-0x35,0x6b,0x10,0xfe,0xb9,0x7b,0x11,0x0b,0xc5,0x5b,0x00,0x3a,0x8d,0x21,0x06,0x00,
-0xf8,0x34,0x60,0x4c,0x20,0x00,0x1c,0xec,0xcd,0xeb,0x26,0x54,0x63,0x21,0x20,0x00,
-0x4a,0x37,0x59,0x00,0xe4,0x20,0x1a,0xe5,0x44,0x59,0x71,0x33,0x33,0x3e,0x53,0x33,
-0x31,0x0b,0x33,0x16,0x41,0x50,0x00,0x2a,0x5d,0x15,0x1e,0x90,0x81,0xeb,0xb7,0xde,
-0x60,0x01,0xb0,0x0d,0x22,0x42,0x4f,0xf1,0x19,0xb4,0xd0,0x03,0xad,0x60,0x00,0xd4,
-0x1a,0xbf,0x14,0xb5,0x00,0x0d,0x21,0xa0,0xd0,0x1a,0x50,0x00,0xea,0x4c,0x0d,0x4b,
-0xe4,0x00,0x0c,0x00,0xc0,0xd0,0x0b,0x30,0x1e,0xfe,0xef,0xef,0xee,0xfe,0x80,0x00,
-0x2a,0x71,0x64,0x76,0x8d,0x40,0x00,0x3b,0xc3,0x00,0xa7,0xcd,0x5c,0x00,0x16,0x29,
-0x00,0x68,0x03,0x30,0x04,0xba,0x70,0x5d,0x0a,0x91,0x97,0x5d,0x7d,0xde,0xdd,0xd4,
-0x09,0x93,0xc0,0xd2,0x42,0xf4,0x23,0x9c,0x00,0x88,0x88,0x00,0x0a,0x42,0xc0,0x0e,
-0x66,0xe0,0x09,0xed,0xcf,0x00,0xd0,0x0e,0x00,0x0a,0x72,0xc0,0x1d,0x00,0xe0,0x00,
-0xb3,0xac,0x03,0xb0,0x0e,0x00,0x0d,0x03,0xc0,0x69,0x00,0xe0,0x32,0xc0,0x0c,0x1d,
-0x40,0x0e,0x18,0x96,0x0c,0xd9,0xa0,0x00,0xbd,0x0b,0x0f,0x10,0x37,0x18,0x23,0x30,
-0x00,0x29,0x84,0xe2,0x05,0xa0,0x09,0xa8,0xe4,0xed,0xdd,0xdf,0x00,0x98,0x3c,0x4b,
-0x57,0x7d,0xf1,0x0e,0x5a,0xc2,0x49,0x00,0x05,0x00,0x94,0x2c,0x00,0xe0,0x04,0x20,
-0x8e,0xdc,0xf0,0x0e,0x09,0xc3,0x00,0xa6,0x2c,0x00,0xec,0x60,0x00,0x0b,0x3a,0xc0,
-0x0e,0x9f,0x41,0xfc,0x02,0x00,0xe0,0x00,0x71,0x2c,0x00,0xc0,0x0e,0x00,0x0c,0x19,
-0x60,0xbc,0x00,0x9d,0xdd,0xa0,0xf9,0x59,0x11,0x20,0x5f,0x0b,0x40,0xfd,0xdd,0xc0,
-0x00,0x54,0x5d,0x10,0xa7,0xd3,0x96,0x00,0xe8,0x90,0x91,0x05,0xff,0xdd,0xdf,0xdd,
-0xdf,0x00,0x12,0xd1,0x17,0x5e,0x00,0xe8,0x7c,0x12,0x0e,0x8c,0x77,0x00,0xde,0x8c,
-0x01,0x05,0x2f,0x11,0xd1,0xb1,0x2f,0x21,0x0c,0x30,0x5c,0x01,0x12,0x5d,0xb3,0x67,
-0x20,0x04,0x90,0x73,0x1e,0xb0,0xee,0xef,0xee,0xef,0xee,0xe0,0x00,0x04,0x90,0x50,
-0xa3,0x17,0x72,0x34,0x0f,0x03,0x10,0x33,0x35,0x12,0x0d,0x40,0x35,0x10,0xd0,0x18,
-0x78,0x20,0x02,0xdf,0x62,0x00,0x70,0xd3,0x01,0x11,0x1b,0xcc,0x11,0x11,0x33,0x8f,
-0xf0,0x01,0xaa,0x00,0x00,0x04,0x9e,0x80,0x00,0x7e,0x94,0x12,0xa6,0x10,0x00,0x00,
-0x17,0xb2,0x63,0x09,0x31,0xb3,0x00,0x02,0x4e,0x00,0x12,0xe3,0x0d,0x00,0x00,0xa3,
-0x1d,0x10,0x02,0xdd,0x50,0x71,0x6e,0xee,0xee,0xfe,0x40,0x1e,0x50,0xd0,0x3e,0xf0,
-0x00,0xf4,0x4e,0xcd,0xd0,0xe0,0x04,0x8a,0x44,0xa0,0x0d,0x0e,0x00,0x00,0xa4,0x4a,
-0x94,0x61,0x40,0x0a,0x44,0xec,0xcb,0x0d,0x00,0x40,0x14,0x00,0x00,0xe0,0x23,0x02,
-0x21,0x0d,0xda,0xf7,0x0a,0x90,0xd2,0x00,0x02,0xdd,0xef,0xdd,0xdf,0xed,0xd2,0x02,
-0x0c,0xf0,0x06,0xc6,0x50,0x00,0x7b,0xcd,0xdd,0xdb,0x96,0x00,0x01,0x61,0x05,0x40,
-0x00,0xa2,0x00,0x0c,0x40,0x3b,0x00,0x4b,0x6d,0x01,0x40,0xb0,0x0a,0x10,0x02,0xab,
-0x1a,0xf0,0x08,0xaa,0xa2,0x03,0x33,0x8d,0xfd,0x73,0x33,0x00,0x01,0x9c,0x1f,0x1c,
-0x80,0x00,0x29,0xe8,0x00,0xf0,0x08,0xea,0x21,0x81,0xa9,0x15,0x13,0x70,0x9c,0x00,
-0x03,0x4e,0x00,0x20,0x27,0xa0,0xf7,0x00,0x20,0x0c,0xed,0xb1,0x95,0xf0,0x01,0x07,
-0x87,0x30,0x00,0x00,0x4a,0x03,0xc3,0xfc,0xbb,0xbb,0x25,0xa0,0x01,0x84,0x0b,0x34,
-0x57,0xc0,0x5b,0xbb,0xec,0xbb,0x86,0x80,0x00,0x31,0x0b,0x20,0x40,0x77,0x14,0x6b,
-0x91,0x0d,0x08,0x60,0x00,0x8c,0xbe,0xcb,0xe0,0xb4,0x33,0x02,0x11,0xcb,0x4d,0x0a,
-0x15,0xc2,0x4e,0x00,0x40,0x03,0xb0,0x23,0xc2,0x97,0x26,0xf0,0x01,0x1e,0xca,0xab,
-0x30,0x00,0x17,0x2c,0xd3,0x16,0xd0,0x02,0x92,0x0c,0x44,0xd8,0xd2,0x8b,0x15,0xf0,
-0x0d,0x4d,0xdb,0x40,0x00,0x01,0x08,0xda,0x20,0x5c,0xe4,0x00,0x1a,0x5c,0xcc,0xcc,
-0xd6,0x00,0x0a,0x60,0xb2,0x00,0x0b,0x30,0x07,0xc0,0x0b,0x41,0x11,0x71,0x17,0x10,
-0xbb,0x6c,0x72,0x06,0x56,0x09,0x33,0xb3,0x00,0x01,0x55,0x00,0x20,0x18,0xa0,0x5d,
-0x0a,0xf2,0x2b,0x09,0xc8,0x88,0x88,0x88,0x70,0x03,0xd6,0x69,0x7c,0x66,0x7c,0x02,
-0xeb,0x88,0xda,0xbc,0x72,0xc0,0x24,0x45,0x5b,0x85,0x52,0x2c,0x00,0x0b,0x54,0xb7,
-0x48,0x73,0xb0,0x00,0xba,0x9d,0xb9,0xc7,0x4a,0x00,0x0b,0xa9,0xdb,0x9c,0x75,0x90,
-0x00,0xb1,0x09,0x41,0x77,0x77,0x00,0x09,0x10,0x52,0x39,0xcc,0x20,0xa3,0x00,0x00,
-0xaf,0x11,0xb0,0xcf,0xdc,0xc2,0x00,0x02,0x80,0x80,0x92,0x00,0x00,0x0b,0x64,0x91,
-0x12,0x10,0x67,0x24,0xd0,0x02,0xbb,0xcf,0xdb,0xbd,0xcb,0xb2,0x00,0x2b,0x81,0x01,
-0x9b,0x20,0x5c,0x3b,0x50,0xaa,0x9d,0x30,0x00,0x8b,0x2c,0x4f,0xe1,0x00,0x0b,0x22,
-0xa0,0xa2,0x2c,0x00,0x00,0xc2,0x2a,0x0a,0x32,0xc0,0x03,0xa4,0x5e,0x10,0xc4,0xfe,
-0x15,0x10,0xa4,0x9c,0x5f,0x10,0xdd,0xf4,0x0b,0x20,0x01,0x70,0x36,0x13,0xf0,0x2e,
-0x6c,0xae,0xa6,0x2e,0x00,0x00,0x06,0xa8,0xa9,0x39,0xca,0xa9,0x00,0x6b,0x99,0xc8,
-0xd0,0xb0,0x00,0x06,0x63,0xb1,0x43,0x07,0x60,0x00,0x38,0x88,0x86,0x00,0x14,0x00,
-0x00,0xac,0xcd,0xbd,0xcb,0xd2,0x00,0x0c,0x12,0x90,0x84,0x0d,0x20,0x00,0xc1,0x29,
-0x08,0x40,0xd2,0x02,0xcf,0xdd,0xec,0xed,0xcf,0xd8,0x00,0x00,0xe0,0xa3,0x10,0x00,
-0x9c,0x00,0x20,0xdd,0xc3,0x93,0x22,0xf5,0x2d,0xb6,0x95,0x00,0xb0,0xcd,0xdd,0xdd,
-0xfd,0xf5,0x0b,0x0d,0x13,0x33,0x3b,0x01,0x00,0xab,0xd7,0x9c,0x73,0xc3,0xc0,0x00,
-0x0d,0x7b,0xda,0x3d,0x78,0x05,0xee,0xd7,0x30,0x64,0xdc,0x30,0x09,0x2c,0x7b,0xcb,
-0x3b,0xc0,0x00,0xc2,0xa7,0x3a,0x00,0xc6,0x01,0x58,0x66,0x5a,0xaa,0xdb,0xc4,0x70,
-0x08,0x10,0x00,0x4a,0x08,0x01,0x52,0x06,0x94,0x01,0xf3,0x34,0xdd,0xd2,0x05,0x9b,
-0xf8,0x09,0xfb,0x96,0x00,0x98,0x45,0xd0,0xe4,0x48,0xa0,0x09,0x84,0x5d,0x0e,0x44,
-0x8a,0x00,0x9b,0x99,0x87,0x99,0x9b,0xa0,0x09,0x46,0x88,0xe8,0x86,0x4a,0x00,0x94,
-0x49,0x8e,0x89,0x44,0xa0,0x09,0x45,0x66,0xa7,0x55,0x4a,0x00,0x94,0x39,0xdf,0xd9,
-0x34,0xa0,0x09,0x55,0xb6,0xc6,0xa1,0x4a,0x00,0x95,0x61,0x0c,0x02,0x7d,0x60,0xb1,
-0x37,0xf0,0x03,0xeb,0xbc,0x00,0x0e,0xcc,0x70,0x0b,0x00,0xc1,0x55,0xf5,0x55,0x00,
-0xeb,0xbc,0x5c,0x7d,0x77,0xac,0x6b,0xfb,0x22,0x95,0xe9,0x5c,0x07,0xdd,0xdd,0x69,
-0x6e,0x22,0x40,0x09,0x30,0x05,0x80,0x9a,0xa5,0x00,0xbb,0xc7,0x67,0x39,0x91,0x00,
-0x00,0x06,0x77,0x67,0x4b,0x10,0x00,0x00,0x85,0xa3,0x90,0xa1,0x50,0x00,0x0a,0x4d,
-0x1a,0x0a,0x19,0x10,0x3c,0xb5,0x8a,0x20,0x7e,0xc0,0x46,0x11,0x11,0x50,0xca,0x31,
-0xf0,0x31,0x65,0x00,0x4e,0xcc,0xf3,0x00,0xad,0xca,0x5e,0xc2,0x6b,0x00,0x0c,0x65,
-0xc6,0x23,0xdd,0x10,0x00,0xb5,0x4b,0x01,0x9b,0xd7,0x00,0x0b,0x54,0xb9,0xa4,0x63,
-0x7c,0x40,0xfd,0xdf,0x0b,0xbe,0xcb,0x80,0x07,0x75,0x20,0x34,0xb8,0x42,0x00,0x06,
-0x5c,0x04,0x6c,0x96,0x30,0x01,0x8a,0xe8,0xaa,0xdc,0xaa,0x35,0xfb,0x7a,0x61,0x1a,
-0x51,0x10,0x2f,0x5b,0x11,0x94,0x7f,0x65,0x02,0x35,0x27,0x00,0x47,0x47,0xf0,0x2a,
-0x05,0xa8,0x47,0x95,0xe5,0x5e,0x00,0xd9,0x8c,0x78,0x3e,0x33,0xe0,0x0b,0x54,0xb7,
-0xcc,0xeb,0xbd,0x00,0xb5,0x4b,0x06,0xb2,0x76,0x00,0x0f,0xed,0xd2,0xbc,0xf7,0x40,
-0x00,0x97,0x50,0x06,0xc3,0x08,0x90,0x00,0x76,0xaa,0xfc,0xec,0x9c,0x40,0x08,0x9d,
-0x18,0x1a,0x38,0x20,0x4e,0xc8,0xab,0x90,0xa3,0x28,0x2d,0x40,0x80,0xbd,0x10,0x61,
-0x4d,0x2b,0x01,0x1b,0x56,0x62,0x5e,0xee,0xee,0xe0,0x0b,0x90,0x36,0x83,0x21,0x6a,
-0x00,0xca,0x31,0xd1,0x1a,0xbb,0xbb,0xbb,0x40,0x3e,0xb0,0x22,0x22,0xa8,0x21,0x2e,
-0x9b,0xd6,0x0d,0x21,0x34,0xb0,0x2b,0x4f,0x11,0x4b,0x0d,0x00,0x15,0x04,0x0d,0x00,
-0x11,0x09,0x0d,0x00,0x25,0xbe,0xd2,0x52,0x5e,0x30,0x30,0x82,0x00,0xf2,0x2d,0x90,
-0x9e,0xbc,0x2d,0xee,0x14,0xb1,0x31,0xb1,0xa4,0xe2,0x11,0x00,0x40,0x5e,0xf1,0x15,
-0x00,0x3e,0x0a,0xaa,0xb8,0xdd,0xd4,0x1d,0xd0,0xb0,0x04,0x81,0xc3,0x08,0x7d,0x0c,
-0xbb,0xd7,0x0b,0x20,0x10,0xd0,0x11,0xc3,0x10,0xb2,0x00,0x0d,0x3e,0xae,0xb9,0x0b,
-0x20,0x00,0xd0,0xd1,0x0d,0x00,0x40,0x1a,0xae,0xaa,0x1c,0x79,0x48,0x35,0xc1,0x2e,
-0xc0,0xf0,0x64,0xf0,0x07,0x13,0x57,0x70,0x00,0x00,0x4c,0x19,0x8e,0x41,0xbd,0xd1,
-0x3c,0x23,0x88,0xe8,0x80,0x00,0x01,0x18,0x82,0x2d,0x22,0x1e,0x73,0xf1,0x1c,0xe9,
-0xe9,0xdd,0xdd,0x51,0xdd,0x0d,0x7e,0x7d,0x0a,0x30,0x77,0xd0,0xb2,0xd2,0xc0,0xa3,
-0x00,0x0d,0x0b,0x9e,0x9a,0x0a,0x30,0x00,0xd0,0x77,0xe7,0x70,0xa3,0x00,0x0d,0x02,
-0x2d,0x22,0x0a,0x30,0x00,0xd4,0xcc,0xed,0xc0,0xb3,0x21,0x48,0x2a,0xce,0x10,0xd0,
-0x27,0x10,0x8d,0xfa,0x1b,0x13,0x90,0x0d,0x00,0x10,0x0b,0x27,0x3b,0x1a,0x10,0xb1,
-0x95,0xf0,0x09,0x00,0x8b,0x6a,0x00,0x22,0x00,0x04,0xca,0x00,0xd3,0x4d,0x30,0x2d,
-0xbc,0x50,0x04,0xeb,0x10,0x00,0x30,0x95,0x01,0x26,0xd3,0xee,0x1d,0x71,0xd5,0x04,
-0xeb,0x20,0x00,0xc8,0x20,0x02,0x1e,0x01,0x7e,0x76,0x01,0x1f,0x2b,0x13,0xa0,0x0e,
-0x95,0xf0,0x04,0x03,0xdb,0xbb,0xbb,0xd4,0x00,0x05,0x8c,0x44,0x44,0x4b,0x85,0x10,
-0x69,0xc5,0x55,0x55,0xc9,0x61,0x1f,0x1d,0xf0,0x05,0xbe,0x40,0x00,0x00,0x18,0xc5,
-0xd1,0x06,0x40,0x00,0x5c,0xb0,0x0a,0x9a,0x80,0x03,0xe9,0x89,0x00,0x1c,0xf4,0x71,
-0xc2,0xdb,0xd7,0x08,0xe8,0x20,0x00,0x67,0x20,0x00,0x01,0x71,0x02,0xc0,0x2f,0x90,
-0x0c,0x20,0x22,0x2e,0x22,0x20,0x9c,0xdc,0x3c,0x97,0x30,0x30,0x11,0xc0,0xc1,0xeb,
-0x3f,0x80,0x78,0x0c,0x10,0xe0,0x34,0x00,0x1f,0x59,0x0a,0x64,0xf0,0x09,0x1d,0xfe,
-0x0e,0x94,0x00,0xc2,0x0b,0x8e,0x86,0xd2,0xc0,0x3c,0x00,0x20,0xd0,0x3c,0x08,0x8d,
-0x30,0x00,0x0d,0x05,0x80,0x1f,0xe4,0x88,0xf0,0x02,0xc3,0x5d,0x7b,0xb3,0x00,0x0d,
-0x18,0x7a,0x20,0x06,0xc1,0x02,0x80,0x00,0x05,0x96,0x80,0xc1,0x13,0xc1,0x59,0x07,
-0x80,0x17,0x98,0x9e,0xee,0xfe,0xee,0x11,0x55,0xd0,0x22,0x5c,0xf0,0x06,0x57,0x2d,
-0xde,0xed,0xd8,0x00,0x0e,0x69,0xb0,0x59,0x05,0x90,0x0a,0xfd,0x2f,0xcd,0xec,0xd9,
-0x06,0xae,0x76,0x0d,0x00,0x50,0x10,0xe0,0x2e,0xbd,0xeb,0xd4,0x64,0x00,0x0d,0x00,
-0x61,0x00,0xe0,0x2b,0x05,0x90,0x59,0x0d,0x00,0x25,0x6e,0x60,0x7a,0x2e,0x10,0xd0,
-0xe9,0x20,0x20,0x75,0x0d,0x09,0x0b,0x90,0x06,0xdc,0xf6,0xdd,0xfe,0xdd,0x30,0x55,
-0x5e,0x0d,0x00,0x30,0x09,0xc6,0xe0,0x1a,0x00,0xa1,0xa5,0x0d,0x2d,0xdd,0xdd,0xd0,
-0x15,0x00,0x40,0xd1,0x80,0x3c,0xf0,0x01,0xfe,0xec,0xcc,0xc5,0x00,0x16,0xc6,0x1d,
-0x21,0xa5,0x01,0xcb,0xb8,0x00,0x3d,0xc3,0x81,0x63,0xa6,0x86,0x3c,0x93,0x00,0x00,
-0xcb,0x73,0x00,0x05,0xb5,0x7a,0x55,0x01,0x1b,0x37,0x10,0x85,0xc0,0x6c,0xf0,0x1c,
-0x0d,0xbd,0xca,0x60,0xd0,0xb2,0x03,0xb6,0xb9,0x66,0x0d,0x0b,0x20,0x14,0x4a,0x84,
-0x40,0xd0,0xb2,0x00,0xca,0xdc,0xab,0x0d,0x0b,0x20,0x0c,0x08,0x55,0xb0,0x33,0xc2,
-0x00,0x20,0x32,0x3c,0x00,0x54,0x00,0x4c,0xcc,0xcd,0xfd,0x05,0x24,0xfb,0x09,0x4b,
-0x86,0xa0,0x3a,0x00,0x3a,0xdf,0x30,0x0a,0xca,0x10,0x01,0x30,0xe5,0x7a,0x08,0xd6,
-0x10,0x00,0x3d,0x84,0x10,0x02,0x89,0x54,0x07,0x12,0x2b,0x88,0x35,0xf0,0x27,0x0a,
+0x03,0xbd,0x00,0x03,0x60,0xe7,0x02,0x40,0xb0,0x00,0x07,0x90,0xe7,0x02,0xf2,0x03,
+0xab,0xed,0xbb,0x00,0x2c,0x1d,0x0e,0x00,0x00,0xf0,0x0c,0x7a,0x70,0xeb,0xbb,0xbf,
+0x01,0xcc,0xf7,0x04,0xf4,0x1d,0xc4,0xa0,0xec,0xcc,0xcf,0x00,0xab,0x6e,0x00,0x01,
+0xe0,0x30,0x0b,0x86,0xa7,0xcd,0x6f,0x6c,0x10,0x53,0x48,0x01,0xd2,0xfd,0x10,0x0c,
+0x47,0xc0,0xa7,0x1d,0x95,0x00,0xc2,0x93,0xb8,0x01,0xd0,0xc6,0x15,0x02,0x02,0x09,
+0xe9,0x00,0xa4,0x00,0xf0,0x11,0xb2,0x00,0x00,0xc0,0x00,0x02,0xd0,0x09,0xaa,0xeb,
+0xa6,0x08,0x68,0x5d,0x11,0x11,0x68,0x1c,0x0d,0x0d,0x00,0x00,0x58,0x9e,0xf6,0x0d,
+0xcc,0xcc,0xc6,0x03,0xb7,0x1d,0x26,0x09,0xf5,0x14,0x49,0x6e,0xeb,0xee,0xbe,0x59,
+0x76,0x8e,0xb0,0xaa,0x0b,0x17,0x89,0x1d,0xeb,0xee,0xbe,0x48,0xb7,0x9b,0xb0,0xaa,
+0x0b,0x75,0xa2,0xa7,0xb0,0xaa,0x0b,0x81,0x30,0x72,0xb0,0x66,0x5b,0x45,0x01,0xf4,
+0x3c,0x01,0x35,0x79,0x00,0x07,0x70,0x2c,0xab,0x85,0x70,0x00,0xd1,0x90,0x93,0x85,
+0x2c,0x00,0x85,0x5a,0x04,0x73,0x6a,0x40,0x2f,0xcd,0x10,0xcd,0xec,0xcc,0x50,0x0a,
+0x39,0x14,0x8a,0x44,0x43,0x08,0xa6,0xc7,0x6c,0x96,0x66,0x50,0x96,0x43,0x50,0xdd,
+0xcc,0xb0,0x07,0x34,0xa1,0x2e,0xc0,0x89,0x00,0xb3,0x86,0x6a,0x67,0xcc,0x00,0x1a,
+0x1a,0x1c,0xc4,0xbc,0xd8,0x21,0x30,0x00,0x84,0xb3,0x00,0x79,0x5d,0x05,0xf7,0x3d,
+0xa0,0x00,0x0b,0x20,0x00,0x00,0x94,0x08,0xaa,0xeb,0xaa,0x20,0x2a,0x1b,0x22,0x2c,
+0x52,0x20,0x0b,0x7b,0x55,0xcc,0xfd,0xcb,0x02,0xbb,0xc0,0x76,0x3a,0x15,0xd0,0x00,
+0xc3,0xa7,0x59,0xa3,0x8d,0x00,0x99,0x4d,0x75,0x5a,0x42,0xd0,0x1e,0xb8,0xb8,0xcd,
+0xff,0xcb,0x00,0x41,0x37,0x00,0xce,0xc4,0x00,0x0c,0x38,0xa0,0x88,0xb3,0xc3,0x00,
+0xb1,0xa7,0xa9,0x0b,0x21,0xd2,0x26,0x05,0x02,0x00,0xb2,0x01,0xeb,0x07,0x00,0x99,
+0x02,0x20,0x94,0x0b,0x6d,0x08,0xf0,0x80,0x1c,0x1a,0xd0,0x00,0x00,0x3a,0x0a,0x48,
+0x34,0x5b,0x11,0x12,0x22,0xfd,0xa0,0x0a,0x7a,0xce,0xa7,0x00,0xa4,0x51,0xe0,0x06,
+0x80,0x00,0x77,0x3b,0x9e,0x0e,0xcc,0xd7,0x1c,0x97,0x8c,0xe0,0xd0,0x06,0x70,0x63,
+0x39,0x2e,0x0e,0xcc,0xd7,0x0b,0x47,0xa2,0xe0,0xd0,0x06,0x71,0xa2,0x93,0x3e,0x0e,
+0x99,0xc7,0x13,0x00,0x01,0xe0,0xd2,0x27,0x60,0x00,0x60,0x00,0x50,0x50,0x51,0x00,
+0x2c,0x00,0x58,0x39,0x0d,0x00,0x07,0x56,0x1c,0x16,0xb0,0xf1,0x00,0xc2,0xb7,0x77,
+0xb8,0xba,0x90,0x8e,0xe3,0x08,0x7a,0x0b,0x0b,0x01,0x3a,0x51,0xe0,0x10,0xa0,0x00,
+0x0b,0x2b,0xaf,0x0a,0x3d,0x00,0x06,0xeb,0xc4,0xc0,0xb1,0xdc,0xa0,0x02,0x37,0x0c,
+0x0d,0x0d,0x00,0x03,0x8a,0xa0,0xc0,0xf6,0xd0,0x00,0x55,0xa6,0x3c,0x56,0xbf,0x00,
+0x09,0x28,0x00,0xc9,0x00,0x9e,0xd1,0xde,0x03,0x10,0x71,0x29,0x0a,0xf0,0x12,0x08,
+0x8e,0x98,0x80,0x01,0xd0,0x70,0xd3,0xa3,0x3d,0x00,0xa4,0x68,0x0c,0x6a,0x9a,0xc0,
+0x1d,0xcd,0x00,0xc4,0x7c,0x1c,0x00,0x0a,0x29,0x0c,0x69,0x66,0xc0,0x07,0xba,0xe0,
+0xfc,0x01,0xf4,0x11,0xc7,0x26,0x31,0x17,0x31,0x10,0x02,0x12,0x50,0x46,0x3b,0x37,
+0x00,0xa5,0x7b,0x2a,0xc0,0x81,0xc1,0x0c,0x19,0x79,0x5c,0x00,0x78,0x71,0x80,0x50,
+0x30,0x9d,0xcc,0x10,0xf1,0x00,0x11,0x80,0xe9,0x08,0xf0,0x13,0xa5,0x0a,0xaa,0xec,
+0xaa,0x40,0x2c,0x18,0x49,0x9c,0xa9,0x80,0x0a,0x59,0x69,0xaa,0xaa,0xaa,0x31,0xdc,
+0xc0,0xc0,0x92,0x83,0x85,0x00,0xb5,0x7b,0xab,0xab,0xbb,0x40,0x9a,0x6d,0xb1,0x0b,
+0xf4,0x12,0x0b,0x86,0xb8,0xa7,0x77,0x7e,0x00,0x64,0x57,0x7a,0x66,0x66,0xe0,0x0c,
+0x47,0xb7,0xb9,0x99,0x9e,0x00,0xb2,0x84,0x28,0xb0,0x4b,0x50,0x25,0x02,0x1b,0x50,
+0x00,0x17,0x50,0x4e,0x07,0x02,0x33,0x04,0xf4,0x6b,0xb3,0x06,0xbb,0xed,0xba,0x00,
+0x2d,0x00,0x95,0x11,0x11,0xe0,0x09,0x55,0x89,0x50,0x00,0x0e,0x03,0xe6,0xc1,0xad,
+0xcc,0xcc,0xb0,0x39,0xb6,0x0a,0x51,0x11,0x12,0x00,0x2b,0x00,0xbe,0xae,0xcc,0xe0,
+0x1d,0xca,0x4c,0xd0,0xa5,0x5b,0x01,0x41,0x01,0xec,0xce,0xdd,0xe0,0x01,0x7d,0x7b,
+0xb0,0xa5,0x5b,0x04,0xe7,0x18,0x7b,0x0a,0x55,0xb0,0x00,0x00,0x91,0xb0,0xa5,0x8b,
+0x00,0x06,0xdb,0xdd,0xbd,0xdb,0xc9,0x00,0x69,0x49,0x94,0x99,0x48,0x90,0x02,0x55,
+0x56,0xe5,0x55,0x53,0x00,0xcc,0xcc,0xde,0xcc,0xcc,0xb0,0x00,0x36,0x6a,0xb6,0x66,
+0x30,0x00,0x07,0x93,0x33,0x33,0x97,0x00,0x00,0x7c,0x99,0x99,0x9c,0x70,0x00,0x07,
+0xb7,0x77,0x77,0xb7,0x0d,0x00,0x00,0x85,0x08,0xf0,0x0d,0x77,0x00,0x2b,0xdd,0xbb,
+0xbb,0xbd,0xdb,0x20,0x00,0x08,0x40,0x00,0x1a,0x00,0x00,0x00,0x3d,0x00,0x0a,0x70,
+0x00,0x07,0xdd,0xdd,0xfe,0xdd,0xdb,0x55,0x08,0x00,0x0a,0x01,0x52,0xcd,0xdd,0xfd,
+0xdd,0xd3,0x0d,0x00,0x00,0x6a,0x0a,0xf1,0x15,0xfd,0xdd,0xdd,0x60,0x12,0x22,0x3e,
+0x22,0x22,0x20,0x08,0xbb,0xbd,0xfe,0xbb,0xbb,0x30,0x00,0x01,0xe4,0xd4,0x00,0x00,
+0x00,0x16,0xe6,0x02,0xd9,0x20,0x01,0xdd,0x92,0x00,0x00,0x7d,0xe4,0x33,0x02,0x06,
+0xd3,0x04,0xf0,0x3b,0x78,0x00,0x08,0x80,0x00,0x07,0xbb,0xfb,0xbb,0xfc,0xb8,0x00,
+0x03,0x33,0x3f,0x33,0x33,0x00,0x00,0x88,0x88,0xf8,0x88,0x80,0x02,0x99,0x99,0x9f,
+0x99,0x99,0x92,0x04,0x67,0x9c,0x5c,0x2a,0x52,0x00,0x77,0xa8,0x10,0xd1,0x3c,0x40,
+0x2b,0xbd,0xdb,0xbf,0xcb,0xcc,0x30,0x00,0x77,0x22,0x59,0x19,0x00,0x3d,0xce,0xd9,
+0x60,0xec,0x40,0x00,0x00,0x76,0x04,0xbd,0xd1,0x65,0x02,0xbd,0x46,0xa4,0x28,0x04,
+0x20,0x23,0x66,0x59,0x0c,0xf1,0x79,0x9e,0x55,0x6c,0xe8,0xcd,0x0a,0x1d,0x56,0x00,
+0xc0,0x0c,0x6d,0xcf,0xec,0x74,0xc8,0x2c,0x00,0xbf,0x90,0x1a,0xc2,0x8c,0x0a,0x7d,
+0x4c,0x16,0xc0,0x5c,0x88,0x09,0x02,0x01,0xe0,0x2d,0x2e,0xce,0xcd,0x1c,0xe2,0xcd,
+0x1c,0x4c,0x4d,0x83,0xc8,0x2c,0x1c,0x4c,0x4c,0x00,0xc0,0x0c,0x1e,0xbe,0xbd,0x00,
+0xc0,0x0d,0x1a,0x00,0x0a,0x0c,0xb2,0xd9,0x1b,0xcb,0xbd,0x4d,0xbb,0xbe,0x00,0x1b,
+0x24,0xd0,0x5a,0x15,0xe0,0x06,0x99,0x6d,0x28,0xa9,0x5e,0x00,0x1b,0xaa,0xde,0xb9,
+0x9d,0x40,0x00,0xd7,0x77,0xf7,0x77,0xf0,0x00,0x0d,0x33,0x3f,0x33,0x3f,0x00,0x00,
+0x8a,0xf9,0x99,0xfa,0x90,0x00,0x68,0x8e,0x88,0x8e,0x98,0x80,0x1a,0xab,0xfa,0xaa,
+0xfb,0xaa,0x60,0x04,0x9a,0x00,0x1a,0xa6,0x10,0x0a,0x82,0x00,0x00,0x00,0x6a,0x29,
+0x08,0x21,0x00,0x12,0x4b,0x07,0x70,0x0b,0x60,0x00,0xcd,0xde,0xed,0xde,0xea,0x01,
+0xe0,0x95,0x1b,0x50,0x00,0x1d,0xdd,0xdf,0xef,0xfd,0xdd,0x50,0x00,0x03,0xba,0x47,
+0x01,0xf0,0x0a,0x3a,0xfe,0xbb,0xbb,0x90,0x01,0xdc,0xa9,0x11,0x11,0x3d,0x00,0x02,
+0x05,0xd9,0x99,0x9a,0xd0,0x00,0x00,0x5a,0x22,0x22,0x4d,0x00,0x66,0x0e,0x00,0xab,
+0x0b,0x41,0x5e,0xdd,0xdd,0xdc,0x28,0x0b,0xf0,0x03,0x03,0xb5,0x00,0xbb,0xfb,0x72,
+0x7c,0xa3,0x00,0x02,0x2e,0x21,0xb6,0xe1,0x00,0x00,0x12,0xe2,0x7c,0x01,0xf2,0x25,
+0x07,0xaf,0xa4,0x36,0xeb,0xdd,0x00,0x00,0xe0,0x07,0x7e,0x30,0x00,0x2d,0xef,0xec,
+0x00,0xd1,0x01,0x10,0x0a,0xfa,0x05,0x8f,0xdd,0xc5,0x04,0xae,0x97,0x85,0xe2,0x00,
+0x02,0xd1,0xe0,0x50,0x0d,0x10,0x15,0x03,0x0e,0x00,0x00,0xd1,0x04,0x90,0x00,0xe0,
+0x00,0x09,0xdd,0xe4,0x6d,0x0b,0xf0,0x2f,0x01,0xbd,0xdb,0x3e,0xce,0xdc,0xf0,0x02,
+0x89,0x20,0xd7,0xc9,0x7e,0x00,0x17,0x91,0x0d,0x7c,0x97,0xe0,0x0a,0xdd,0xb1,0xd3,
+0xb5,0x3e,0x01,0x39,0xa3,0x15,0x5c,0x75,0x50,0x27,0xde,0x76,0xcc,0xed,0xcc,0x50,
+0x1f,0xe7,0x47,0x09,0x24,0x56,0x08,0xc8,0xc6,0x70,0x94,0xc6,0x63,0xc6,0x81,0x4c,
+0xdd,0xba,0xb6,0x33,0x68,0x04,0x29,0x02,0xd0,0x06,0x80,0x47,0x00,0x08,0xd4,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0xf4,0x3f,0x00,0x00,0x00,0x30,0x00,0x30,0x04,0xfe,
+0xfe,0x19,0x00,0x57,0x00,0x09,0x37,0x6b,0x5a,0x3c,0x68,0x00,0x9d,0xe6,0x7e,0x22,
+0x6e,0x30,0x09,0x37,0x58,0x5a,0x0a,0x4a,0x00,0x93,0x78,0xfb,0xd9,0xeb,0xb5,0x09,
+0xef,0x65,0x18,0x26,0x04,0x10,0x93,0x75,0x92,0xd0,0xd0,0xc0,0x09,0x38,0x89,0x7e,
+0x0e,0x6c,0x04,0xee,0xda,0x47,0xe0,0xe6,0xc0,0x00,0x07,0x50,0x78,0x0d,0x00,0x00,
+0x00,0x75,0x5a,0x00,0xd0,0x00,0x01,0x00,0x20,0x0a,0x30,0x06,0x00,0xf0,0x45,0x99,
+0xda,0x95,0x8b,0xc9,0x00,0x05,0x8a,0x98,0x6b,0x01,0xb9,0x00,0x6a,0xb9,0xc3,0xcc,
+0xaf,0x20,0x09,0xac,0xad,0x31,0xdd,0x60,0x00,0xc0,0x00,0x04,0xa5,0x38,0xb0,0x0b,
+0xbe,0xaa,0xaa,0xae,0xba,0x10,0x02,0xea,0xaa,0xaa,0xe2,0x00,0x00,0x2d,0x33,0x33,
+0x3d,0x20,0x00,0x02,0xe6,0x66,0x66,0xe2,0x00,0x0b,0xcf,0xbc,0xcc,0xcf,0xcb,0x00,
+0x11,0x00,0x00,0x00,0xc2,0x00,0x00,0x00,0x86,0x0d,0x10,0x03,0x00,0xbc,0xce,0x60,
+0xd7,0xad,0x80,0x0d,0x00,0xff,0x13,0x72,0x00,0x01,0x69,0xbd,0x60,0xc4,0x22,0x78,
+0x16,0x30,0x64,0x04,0xaa,0xa9,0x20,0x02,0xcc,0xcc,0xcc,0xca,0x00,0x00,0x2c,0x00,
+0x00,0x01,0xe0,0x00,0x02,0xfb,0xbb,0xbb,0xbe,0x0d,0x00,0x03,0x5a,0xc0,0x00,0x4d,
+0xd9,0x00,0x01,0x00,0x20,0x0b,0x51,0xb6,0x00,0xf1,0x38,0x03,0xc0,0xc3,0x0d,0x05,
+0xc3,0x01,0xd5,0x37,0xc1,0xfd,0x93,0x00,0x3b,0xa8,0x7b,0x4e,0x00,0x04,0x00,0x33,
+0x33,0x30,0xe0,0x00,0xd1,0x0d,0x99,0xad,0x0a,0xdd,0xd9,0x00,0xd6,0x67,0xd0,0xb0,
+0x00,0x00,0x0d,0x54,0x5d,0x0e,0x28,0xd4,0x00,0xda,0x9a,0xd0,0xf9,0x40,0x00,0x0d,
+0x21,0x3d,0x0e,0x00,0x07,0x20,0xd0,0x01,0xd0,0xe0,0x00,0xc2,0x0d,0x07,0xe9,0x0a,
+0xdd,0xda,0x52,0x00,0xd0,0x02,0x71,0x00,0xce,0xdd,0x18,0xbd,0xc8,0x20,0x0c,0x00,
+0xd3,0xa2,0xc0,0x00,0xf5,0x2a,0x2d,0x37,0x03,0x7c,0x40,0x0c,0xcb,0xd3,0x7d,0xad,
+0x20,0x00,0xd0,0x0d,0x47,0xd0,0xc0,0x40,0x0d,0x11,0xd5,0x6d,0x0b,0x8a,0x00,0xed,
+0xdd,0x55,0xd0,0x89,0x00,0x0c,0x00,0xd7,0x4d,0x04,0x90,0x02,0xb0,0x0d,0xa1,0xd0,
+0x0d,0x00,0x68,0x00,0xdb,0x0d,0xb7,0x79,0x09,0x37,0xea,0xa0,0xc3,0x00,0xa0,0xa5,
+0x00,0xf0,0x0c,0x01,0x01,0x00,0x00,0x0c,0xef,0x0b,0x2b,0x0c,0xde,0x0c,0x0c,0x3a,
+0x05,0x7c,0x0c,0x0c,0x2d,0x92,0xc0,0x9c,0x0c,0x0c,0xbf,0x04,0xd9,0x0c,0x01,0x00,
+0xf0,0x07,0x1b,0x4c,0x0c,0x0c,0x0c,0xa6,0x02,0xdd,0x0c,0x0d,0xdf,0x2e,0xde,0x3c,
+0x0c,0x0b,0x0c,0x0b,0x0a,0x1c,0x0c,0x1b,0x06,0x00,0xc4,0x7b,0x48,0x0c,0x0f,0xdf,
+0x1c,0x00,0x64,0xbb,0x0a,0x0a,0x1c,0x4d,0x00,0xf1,0x0b,0x02,0x90,0x00,0x00,0x00,
+0x78,0x00,0x00,0xee,0xee,0xee,0xee,0xfe,0x10,0x00,0x00,0x0f,0xe1,0x00,0x00,0x00,
+0xfe,0xed,0xdd,0xdd,0xdf,0x09,0x00,0x81,0xba,0xaa,0xaa,0xaf,0xe4,0x33,0x33,0x33,
+0x1b,0x00,0xf0,0x05,0xed,0xdd,0xdd,0xdd,0xfe,0x20,0x00,0x00,0x0e,0x0b,0xee,0xff,
+0xee,0xee,0xee,0x00,0x00,0x0c,0x50,0x06,0xde,0x01,0xf4,0x0f,0x40,0x00,0x4c,0x20,
+0x00,0x1c,0xec,0xcd,0xdd,0xdd,0x20,0x00,0x63,0x21,0x20,0x00,0x4a,0x00,0x00,0x00,
+0x0d,0x20,0x00,0x00,0x00,0xde,0xee,0xfe,0xee,0xe5,0x0d,0x00,0xe0,0x00,0x00,0xd2,
+0x00,0x00,0x00,0x33,0x33,0x3e,0x53,0x33,0x31,0x0b,0xbb,0x01,0x00,0x40,0x50,0x00,
+0x2a,0x5d,0x18,0x00,0xf3,0x38,0x1e,0x81,0xeb,0xb7,0xde,0x60,0x01,0xb0,0x0d,0x22,
+0x00,0x86,0x00,0x0e,0xb4,0xd0,0x03,0xad,0x60,0x00,0xd4,0x1a,0xbf,0x14,0xb5,0x00,
+0x0d,0x21,0xa0,0xd0,0x1a,0x50,0x00,0xea,0x4c,0x0d,0x4b,0xe4,0x00,0x0c,0x00,0xc0,
+0xd0,0x0b,0x30,0x1e,0xfe,0xef,0xef,0xee,0xfe,0x80,0x00,0x2a,0x00,0x0b,0x40,0x00,
+0x00,0x8d,0x40,0x00,0x3b,0xc3,0x00,0xa7,0x00,0x00,0x00,0x04,0xb0,0xd2,0x00,0xf0,
+0x07,0x04,0x90,0x00,0x0e,0x00,0x00,0x04,0xba,0x70,0x00,0x96,0x00,0x00,0x97,0x5d,
+0x7d,0xde,0xdd,0xd4,0x09,0x93,0xc0,0x1a,0x00,0xf3,0x25,0x95,0x9c,0x00,0x88,0x88,
+0x00,0x0a,0x42,0xc0,0x0e,0x66,0xe0,0x09,0xed,0xcf,0x00,0xd0,0x0e,0x00,0x0a,0x72,
+0xc0,0x1d,0x00,0xe0,0x00,0xb3,0xac,0x03,0xb0,0x0e,0x00,0x0d,0x03,0xc0,0x69,0x00,
+0xe0,0x32,0xc0,0x0c,0x1d,0x40,0x0e,0x18,0x96,0x0c,0xd9,0xa0,0x00,0xbd,0x40,0x55,
+0x00,0xfb,0x3e,0x37,0x00,0x00,0xa1,0x00,0x00,0x29,0x84,0x00,0x06,0x80,0x00,0x09,
+0xa8,0xe4,0xed,0xdd,0xdf,0x00,0x98,0x3c,0x4b,0x00,0x00,0xe0,0x09,0x5a,0xc2,0x49,
+0x00,0x05,0x00,0x94,0x2c,0x00,0xe0,0x04,0x20,0x8e,0xdc,0xf0,0x0e,0x09,0xc3,0x00,
+0xa6,0x2c,0x00,0xec,0x60,0x00,0x0b,0x3a,0xc0,0x0e,0x00,0x00,0x00,0xd0,0x4c,0x00,
+0xe0,0x00,0x71,0x2c,0x00,0xc0,0x0e,0x00,0x0c,0x19,0x60,0xbc,0x00,0x9d,0xdd,0xa0,
+0x75,0x02,0x11,0x0c,0x1e,0x01,0x80,0x08,0xfd,0xdd,0xc0,0x00,0x00,0x04,0xd0,0xcd,
+0x00,0xf0,0x0a,0x06,0xf4,0x11,0x6c,0x11,0x10,0x05,0xff,0xdd,0xdf,0xdd,0xdf,0x00,
+0x12,0xd1,0x00,0xe0,0x00,0xe0,0x00,0x0d,0x10,0x0e,0x00,0x0e,0x53,0x01,0xc0,0xee,
+0xee,0xf0,0x00,0x0d,0x10,0x00,0x00,0x08,0x00,0x00,0xd1,0x38,0x00,0x31,0x30,0x0c,
+0x30,0x5c,0x01,0x51,0x5d,0xee,0xee,0xee,0xe8,0xff,0x00,0xf0,0x1c,0xa3,0x00,0x00,
+0xee,0xef,0xee,0xef,0xee,0xe0,0x00,0x04,0x90,0x50,0xa3,0x00,0x00,0x00,0x13,0x0f,
+0x03,0x10,0x00,0x00,0xcd,0xdd,0xfd,0xdd,0xd0,0x00,0x0d,0x10,0x0f,0x00,0x0f,0x00,
+0x00,0xd0,0x01,0xe0,0x00,0xf0,0x02,0xdf,0x62,0x00,0xf1,0x13,0xd3,0x01,0x11,0x1b,
+0xcc,0x11,0x11,0x00,0x00,0x1a,0xc0,0xaa,0x00,0x00,0x04,0x9e,0x80,0x00,0x7e,0x94,
+0x12,0xa6,0x10,0x00,0x00,0x17,0xb2,0x00,0x03,0xb0,0x00,0xb3,0x00,0x02,0x4e,0x00,
+0x12,0xe3,0x0d,0x00,0xf0,0x1d,0x00,0x00,0x94,0x00,0x02,0x00,0x00,0x00,0x5c,0x6e,
+0xee,0xee,0xfe,0x40,0x1e,0x50,0x00,0x00,0x0e,0x00,0x1d,0xf4,0x4e,0xcd,0xd0,0xe0,
+0x04,0x8a,0x44,0xa0,0x0d,0x0e,0x00,0x00,0xa4,0x4a,0x00,0xd0,0xe0,0x00,0x0a,0x44,
+0xec,0xcb,0x0d,0x00,0x40,0x14,0x00,0x00,0xe0,0x23,0x02,0x30,0x0d,0xda,0x00,0x73,
+0x03,0xf0,0x13,0xd2,0x00,0x02,0xdd,0xef,0xdd,0xdf,0xed,0xd2,0x00,0x02,0xb0,0x00,
+0xc6,0x50,0x00,0x7b,0xcd,0xdd,0xdb,0x96,0x00,0x01,0x61,0x05,0x40,0x00,0xa2,0x00,
+0x0c,0x40,0x3b,0x00,0x4b,0x6d,0x01,0xf3,0x15,0xb0,0x0a,0x10,0x02,0xaa,0xaa,0xaf,
+0xaa,0xaa,0xa2,0x03,0x33,0x8d,0xfd,0x73,0x33,0x00,0x01,0x9c,0x1f,0x1c,0x80,0x00,
+0x29,0xe8,0x00,0xf0,0x08,0xea,0x21,0x81,0x00,0x0f,0x00,0x01,0x70,0x9c,0x00,0x03,
+0x4e,0x00,0x20,0x27,0xa0,0xf7,0x00,0x10,0x0c,0xa3,0x02,0xf1,0x1f,0x90,0x07,0x87,
+0x30,0x00,0x00,0x4a,0x03,0xc3,0xfc,0xbb,0xbb,0x25,0xa0,0x01,0x84,0x0b,0x20,0x00,
+0x59,0x00,0x5b,0xbb,0xec,0xbb,0x86,0x80,0x00,0x31,0x0b,0x20,0x40,0x77,0x00,0x09,
+0x40,0xb2,0x0d,0x08,0x60,0x00,0x8c,0xbe,0xcb,0xe0,0xb4,0x33,0x02,0x20,0xcb,0x00,
+0x4e,0x00,0x15,0xc2,0x4e,0x00,0xf4,0x31,0x03,0xb0,0x23,0xc2,0x00,0x00,0x3d,0x70,
+0x1e,0xca,0xab,0x30,0x00,0x17,0x2c,0xd3,0x16,0xd0,0x02,0x92,0x0c,0x44,0xd8,0xd2,
+0x00,0x06,0xe2,0x00,0x4d,0xdb,0x40,0x00,0x01,0x08,0xda,0x20,0x5c,0xe4,0x00,0x1a,
+0x5c,0xcc,0xcc,0xd6,0x00,0x0a,0x60,0xb2,0x00,0x0b,0x30,0x07,0xc0,0x0b,0x41,0x11,
+0xc3,0x00,0xd1,0x00,0xbb,0xaa,0xae,0x30,0xdb,0x01,0x63,0x03,0xa0,0x00,0xb3,0x00,
+0x01,0x55,0x00,0xf3,0x31,0x18,0xa0,0x00,0xb2,0x00,0x00,0x09,0xc8,0x88,0x88,0x88,
+0x70,0x03,0xd6,0x69,0x7c,0x66,0x7c,0x02,0xeb,0x88,0xda,0xbc,0x72,0xc0,0x24,0x45,
+0x5b,0x85,0x52,0x2c,0x00,0x0b,0x54,0xb7,0x48,0x73,0xb0,0x00,0xba,0x9d,0xb9,0xc7,
+0x4a,0x00,0x0b,0xa9,0xdb,0x9c,0x75,0x90,0x00,0xb1,0x09,0x41,0x77,0x77,0x00,0x09,
+0x10,0x52,0x39,0xcc,0x20,0xa3,0x00,0xf0,0x05,0xcc,0xdf,0xcc,0xcf,0xdc,0xc2,0x00,
+0x02,0x80,0x80,0x92,0x00,0x00,0x0b,0xbb,0xbf,0xbb,0xbb,0x10,0x00,0x64,0x01,0xf0,
+0x1b,0x00,0x02,0xbb,0xcf,0xdb,0xbd,0xcb,0xb2,0x00,0x2b,0x81,0x01,0x9b,0x20,0x00,
+0x0c,0xcb,0xbb,0xaa,0x9d,0x30,0x00,0x8b,0xbb,0xbb,0xbb,0xa0,0x00,0x0b,0x22,0xa0,
+0xa2,0x2c,0x00,0x00,0xc2,0x2a,0x0a,0x32,0xc0,0x03,0xcc,0x01,0x00,0x80,0xc4,0x00,
+0x01,0xc0,0x00,0xa4,0x00,0x00,0x01,0x02,0x20,0xed,0xd6,0x4f,0x01,0xf0,0x2e,0x82,
+0x00,0x00,0x6c,0xae,0xa6,0x2e,0x00,0x00,0x06,0xa8,0xa9,0x39,0xca,0xa9,0x00,0x6b,
+0x99,0xc8,0xd0,0xb0,0x00,0x06,0x63,0xb1,0x43,0x07,0x60,0x00,0x38,0x88,0x86,0x00,
+0x14,0x00,0x00,0xac,0xcd,0xbd,0xcb,0xd2,0x00,0x0c,0x12,0x90,0x84,0x0d,0x20,0x00,
+0xc1,0x29,0x08,0x40,0xd2,0x02,0xcf,0xdd,0xec,0xed,0xcf,0xd8,0x81,0x00,0x30,0xe1,
+0x00,0x01,0x9c,0x00,0xf5,0x34,0xdd,0xc3,0x00,0x00,0xa0,0x00,0xb6,0x95,0x00,0xb0,
+0xcd,0xdd,0xdd,0xfd,0xf5,0x0b,0x0d,0x13,0x33,0x3b,0x01,0x00,0xab,0xd7,0x9c,0x73,
+0xc3,0xc0,0x00,0x0d,0x7b,0xda,0x3d,0x78,0x05,0xee,0xd7,0x30,0x64,0xdc,0x30,0x09,
+0x2c,0x7b,0xcb,0x3b,0xc0,0x00,0xc2,0xa7,0x3a,0x00,0xc6,0x01,0x58,0x66,0x5a,0xaa,
+0xdb,0xc4,0x70,0x08,0x10,0x00,0x4a,0x08,0xd2,0x3f,0x01,0x05,0x94,0x01,0xf2,0x35,
+0xdd,0xd2,0x05,0x9b,0xf8,0x09,0xfb,0x96,0x00,0x98,0x45,0xd0,0xe4,0x48,0xa0,0x09,
+0x84,0x5d,0x0e,0x44,0x8a,0x00,0x9b,0x99,0x87,0x99,0x9b,0xa0,0x09,0x46,0x88,0xe8,
+0x86,0x4a,0x00,0x94,0x49,0x8e,0x89,0x44,0xa0,0x09,0x45,0x66,0xa7,0x55,0x4a,0x00,
+0x94,0x39,0xdf,0xd9,0x34,0xa0,0x09,0x55,0xb6,0xc6,0xa1,0x4a,0x00,0x95,0x61,0x0c,
+0x02,0x7d,0x60,0x00,0x26,0x01,0xfa,0x38,0xeb,0xbc,0x00,0x0e,0xcc,0x70,0x0b,0x00,
+0xc1,0x55,0xf5,0x55,0x00,0xeb,0xbc,0x5c,0x7d,0x77,0xe0,0x00,0x00,0x05,0x95,0xe9,
+0x5c,0x07,0xdd,0xdd,0x69,0x6e,0x22,0x40,0x09,0x30,0x05,0x80,0x9a,0xa5,0x00,0xbb,
+0xc7,0x67,0x39,0x91,0x00,0x00,0x06,0x77,0x67,0x4b,0x10,0x00,0x00,0x85,0xa3,0x90,
+0xa1,0x50,0x00,0x0a,0x4d,0x1a,0x0a,0x19,0x10,0x3c,0xb5,0x8a,0x20,0x7e,0xc0,0xc3,
+0x03,0x20,0x06,0x50,0x6d,0x04,0xf0,0x37,0x00,0x65,0x00,0x4e,0xcc,0xf3,0x00,0xad,
+0xca,0x5e,0xc2,0x6b,0x00,0x0c,0x65,0xc6,0x23,0xdd,0x10,0x00,0xb5,0x4b,0x01,0x9b,
+0xd7,0x00,0x0b,0x54,0xb9,0xa4,0x63,0x7c,0x40,0xfd,0xdf,0x0b,0xbe,0xcb,0x80,0x07,
+0x75,0x20,0x34,0xb8,0x42,0x00,0x06,0x5c,0x04,0x6c,0x96,0x30,0x01,0x8a,0xe8,0xaa,
+0xdc,0xaa,0x35,0xfb,0x7a,0x61,0x1a,0x51,0x10,0x00,0x00,0x11,0x00,0x94,0x3d,0x07,
+0x01,0x55,0x00,0xf1,0x3a,0x07,0x50,0x7d,0xbf,0xbb,0xe0,0x05,0xa8,0x47,0x95,0xe5,
+0x5e,0x00,0xd9,0x8c,0x78,0x3e,0x33,0xe0,0x0b,0x54,0xb7,0xcc,0xeb,0xbd,0x00,0xb5,
+0x4b,0x06,0xb2,0x76,0x00,0x0f,0xed,0xd2,0xbc,0xf7,0x40,0x00,0x97,0x50,0x06,0xc3,
+0x08,0x90,0x00,0x76,0xaa,0xfc,0xec,0x9c,0x40,0x08,0x9d,0x18,0x1a,0x38,0x20,0x4e,
+0xc8,0xab,0x90,0xa3,0x4b,0x00,0x00,0x00,0x80,0xbd,0x10,0x61,0x00,0x08,0x60,0x04,
+0x81,0x09,0xa0,0x5e,0xee,0xee,0xe0,0x0b,0x90,0x5b,0x00,0x21,0x50,0x6a,0x07,0x00,
+0xf1,0x0c,0x3e,0x1a,0xbb,0xbb,0xbb,0x40,0x3e,0xb0,0x22,0x22,0xa8,0x21,0x2e,0x9b,
+0x00,0x00,0x08,0x60,0x00,0x34,0xb0,0x00,0x00,0x86,0x00,0x00,0x4b,0x0d,0x00,0x15,
+0x04,0x0d,0x00,0x11,0x09,0x0d,0x00,0x15,0xbe,0x9a,0x01,0x30,0x09,0x30,0x82,0xf7,
+0x00,0xf1,0x27,0xb0,0x9e,0xbc,0x2d,0xee,0x14,0xb1,0x31,0xb1,0xa4,0x00,0x00,0x00,
+0x98,0x99,0x99,0x90,0x00,0x00,0x3e,0x0a,0xaa,0xb8,0xdd,0xd4,0x1d,0xd0,0xb0,0x04,
+0x81,0xc3,0x08,0x7d,0x0c,0xbb,0xd7,0x0b,0x20,0x10,0xd0,0x11,0xc3,0x10,0xb2,0x00,
+0x0d,0x3e,0xae,0xb9,0x0b,0x20,0x00,0xd0,0xd1,0x0d,0x00,0xa5,0x1a,0xae,0xaa,0x1c,
+0x20,0x00,0xd0,0x00,0xc1,0x2e,0x4c,0x01,0xf0,0x38,0x73,0x13,0x57,0x70,0x00,0x00,
+0x4c,0x19,0x8e,0x41,0xbd,0xd1,0x3c,0x23,0x88,0xe8,0x80,0x00,0x01,0x18,0x82,0x2d,
+0x22,0x00,0x00,0x02,0xe0,0xe9,0xe9,0xdd,0xdd,0x51,0xdd,0x0d,0x7e,0x7d,0x0a,0x30,
+0x77,0xd0,0xb2,0xd2,0xc0,0xa3,0x00,0x0d,0x0b,0x9e,0x9a,0x0a,0x30,0x00,0xd0,0x77,
+0xe7,0x70,0xa3,0x00,0x0d,0x02,0x2d,0x22,0x0a,0x30,0x00,0xd4,0xcc,0xed,0xc0,0xb3,
+0x00,0x7f,0x08,0x26,0xce,0x10,0x9d,0x01,0xa3,0xf0,0x00,0x00,0x00,0x8d,0xdd,0xdf,
+0xdd,0xdd,0x90,0x0d,0x00,0x62,0x0b,0xcc,0xcf,0xcc,0xcc,0x10,0x0d,0x00,0x20,0x01,
+0xdd,0x1a,0x00,0xf1,0x19,0xd1,0x00,0x00,0x8b,0x6a,0x00,0x22,0x00,0x04,0xca,0x00,
+0xd3,0x4d,0x30,0x2d,0xbc,0x50,0x04,0xeb,0x10,0x00,0x30,0x95,0x01,0x26,0xd3,0x00,
+0x00,0x0b,0xbc,0xd5,0x04,0xeb,0x20,0x00,0xc8,0x20,0x00,0x00,0x50,0xd2,0x03,0xa0,
+0x00,0x00,0xaa,0xaa,0xaf,0xba,0xaa,0xa0,0x02,0x22,0x01,0x00,0xf0,0x2c,0x00,0x03,
+0xdb,0xbb,0xbb,0xd4,0x00,0x05,0x8c,0x44,0x44,0x4b,0x85,0x10,0x69,0xc5,0x55,0x55,
+0xc9,0x61,0x00,0x4e,0xbb,0xbb,0xbe,0x40,0x00,0x00,0x18,0xc5,0xd1,0x06,0x40,0x00,
+0x5c,0xb0,0x0a,0x9a,0x80,0x03,0xe9,0x89,0x00,0x1c,0xb0,0x00,0x00,0x07,0xdb,0xd7,
+0x08,0xe8,0x20,0x00,0x67,0x20,0x00,0x01,0x71,0x7c,0x07,0x10,0xe0,0x00,0x06,0xf0,
+0x66,0x22,0x2e,0x22,0x20,0x9c,0xdc,0x3c,0xbb,0xfb,0xbf,0x00,0x11,0xc0,0xc1,0x0e,
+0x03,0xb0,0x00,0x78,0x0c,0x10,0xe0,0x34,0x00,0x1f,0x59,0xdd,0xdf,0xdd,0x50,0x1d,
+0xfe,0x0e,0x94,0x00,0xc2,0x0b,0x8e,0x86,0xd2,0xc0,0x3c,0x00,0x20,0xd0,0x3c,0x08,
+0x8d,0x30,0x00,0x0d,0x05,0x80,0x1f,0xb0,0x00,0x00,0xd0,0xc3,0x5d,0x7b,0xb3,0x00,
+0x0d,0x18,0x7a,0x20,0x06,0xc1,0x02,0x80,0x00,0x05,0x96,0x80,0x00,0x0c,0x30,0x00,
+0x59,0x07,0x80,0x17,0x98,0x9e,0xee,0xfe,0xee,0x11,0x55,0xd0,0x00,0x59,0x00,0x00,
+0x00,0x57,0x2d,0xde,0xed,0xd8,0x00,0x0e,0x69,0xb0,0x59,0x05,0x90,0x0a,0xfd,0x2f,
+0xcd,0xec,0xd9,0x06,0xae,0x76,0x0d,0x00,0x90,0x10,0xe0,0x2e,0xbd,0xeb,0xd9,0x00,
+0x0e,0x02,0x0d,0x00,0x61,0x00,0xe0,0x2b,0x05,0x90,0x59,0x0d,0x00,0x11,0x6e,0x2e,
+0x03,0x01,0x84,0x02,0xf0,0x05,0xd0,0x00,0x95,0x00,0x00,0x75,0x0d,0x00,0x09,0x50,
+0x00,0x06,0xdc,0xf6,0xdd,0xfe,0xdd,0x30,0x55,0x5e,0x0d,0x00,0x30,0x09,0xc6,0xe0,
+0x1a,0x00,0xf5,0x1e,0xa5,0x0d,0x2d,0xdd,0xdd,0xd0,0x15,0x00,0x40,0xd1,0x00,0x00,
+0x01,0xcc,0xcc,0xfe,0xec,0xcc,0xc5,0x00,0x16,0xc6,0x1d,0x21,0xa5,0x01,0xcb,0xb8,
+0x00,0x3d,0xc3,0x00,0x00,0x07,0xa5,0x86,0x3c,0x93,0x00,0x00,0xcb,0x73,0x00,0x05,
+0xb5,0xc2,0x08,0x01,0x06,0x00,0xfb,0x3e,0x76,0x85,0x00,0x00,0x0b,0x20,0x0d,0xbd,
+0xca,0x60,0xd0,0xb2,0x03,0xb6,0xb9,0x66,0x0d,0x0b,0x20,0x14,0x4a,0x84,0x40,0xd0,
+0xb2,0x00,0xca,0xdc,0xab,0x0d,0x0b,0x20,0x0c,0x08,0x55,0xb0,0x33,0xc2,0x00,0x20,
+0x32,0x3c,0x00,0x54,0x00,0x4c,0xcc,0xcd,0xfd,0xcc,0xcb,0x00,0x00,0x4b,0x86,0xa0,
+0x3a,0x00,0x3a,0xdf,0x30,0x0a,0xca,0x10,0x01,0x30,0xe5,0x7a,0x08,0xd6,0x10,0x00,
+0x3d,0x84,0x10,0x02,0x89,0x54,0x07,0x40,0x2b,0x00,0x09,0x60,0x9b,0x08,0xf4,0x3b,
 0x20,0x2f,0xdc,0xcc,0xa0,0x0a,0xcc,0xc6,0xd9,0x22,0x22,0x00,0x01,0x11,0xd5,0xcd,
 0x88,0x8e,0x20,0x00,0x07,0x81,0x3e,0x99,0x9e,0x20,0x00,0x3f,0x6b,0x4b,0x11,0x1c,
 0x20,0x03,0xef,0xe2,0x29,0xf9,0x88,0x10,0x0d,0x4d,0x4a,0x08,0xe9,0x99,0x00,0x00,
-0x0d,0x02,0x9f,0x81,0x9a,0xd2,0x2d,0x30,0x91,0xca,0xc0,0x78,0x15,0xb4,0x38,0xdd,
-0xc6,0x10,0x00,0x0d,0x09,0xc8,0x10,0x4b,0xc0,0x27,0x6b,0x00,0xc0,0x86,0x61,0xee,
-0x20,0x00,0x05,0x80,0x94,0x93,0x57,0x10,0x0a,0x15,0xa3,0xf0,0x0c,0xee,0xfe,0xfe,
-0xee,0x90,0x07,0x70,0x96,0x09,0x40,0x59,0x00,0x77,0x1d,0x10,0x95,0x05,0x90,0x07,
-0xac,0x50,0x06,0xfe,0xf9,0x00,0x78,0x20,0x03,0x0c,0x21,0x07,0x70,0xed,0x35,0x10,
-0x7f,0x65,0x09,0x02,0x0d,0x00,0xf3,0x13,0x58,0x00,0x0c,0xdd,0xef,0xde,0xfd,0xdd,
-0x30,0x02,0x27,0x92,0x6a,0x22,0x10,0x03,0xea,0xcd,0xac,0xda,0xbb,0x00,0x3a,0x05,
-0x80,0x59,0x03,0xb0,0x03,0xec,0xde,0xcd,0xec,0xdb,0xa8,0x1f,0x31,0x1d,0xdd,0xee,
-0x50,0x22,0x10,0x7b,0xe1,0x41,0x40,0x00,0x1d,0xd9,0x58,0x1a,0x1f,0xf6,0x45,0x26,
-0xde,0xcd,0x94,0x00,0x0b,0xdb,0x84,0x00,0x15,0xbb,0x00,0x0b,0xbb,0xdc,0xbd,0xdb,
-0xbb,0x10,0x7c,0xad,0xca,0xdc,0xac,0x80,0x07,0xb7,0xca,0x7b,0xb7,0xa8,0x00,0x15,
-0x93,0x89,0x33,0x33,0x20,0x03,0xc2,0x2d,0x99,0x99,0x98,0x02,0xb4,0xdd,0xd8,0x77,
-0x7d,0x20,0x02,0xd3,0x1b,0x87,0x77,0xd2,0x03,0xdd,0x10,0x6c,0xc8,0x88,0x10,0x00,
-0xb1,0x3a,0xe9,0x9c,0xc0,0x00,0x0b,0x16,0x16,0xca,0xc1,0x00,0x00,0xb1,0x9b,0x95,
-0x47,0xab,0x20,0x6b,0x16,0x01,0x2e,0x1f,0xf0,0x13,0x09,0xee,0xee,0xb0,0x06,0x7e,
+0x0d,0x02,0x9f,0x81,0x9a,0x00,0x00,0x0d,0x04,0x91,0xca,0xc0,0x00,0x00,0x0d,0x00,
+0x38,0xdd,0xc6,0x10,0x00,0x0d,0x09,0xc8,0x10,0x4b,0xa6,0x02,0xb0,0x2e,0xee,0xff,
+0xef,0xfe,0xee,0x20,0x00,0x05,0x80,0x94,0x0f,0x00,0xf0,0x1e,0x68,0x0a,0x50,0x00,
+0x00,0x7f,0xee,0xfe,0xfe,0xee,0x90,0x07,0x70,0x96,0x09,0x40,0x59,0x00,0x77,0x1d,
+0x10,0x95,0x05,0x90,0x07,0xac,0x50,0x06,0xfe,0xf9,0x00,0x78,0x20,0x00,0x00,0x05,
+0x90,0x07,0x70,0x00,0x00,0x00,0x59,0x00,0x7f,0x65,0x09,0x02,0x0d,0x00,0xf1,0x13,
+0x58,0x00,0x0c,0xdd,0xef,0xde,0xfd,0xdd,0x30,0x02,0x27,0x92,0x6a,0x22,0x10,0x03,
+0xea,0xcd,0xac,0xda,0xbb,0x00,0x3a,0x05,0x80,0x59,0x03,0xb0,0x03,0xec,0xde,0xcd,
+0xec,0xdb,0xa4,0x0a,0xf3,0x5c,0x00,0x00,0x1d,0xdd,0xee,0xdd,0xdd,0xdd,0x60,0x00,
+0x7b,0x00,0x07,0xa0,0x00,0x00,0x1d,0xd9,0x58,0xc1,0x00,0x00,0x00,0x26,0xde,0xcd,
+0x94,0x00,0x0b,0xdb,0x84,0x00,0x15,0xbb,0x00,0x0b,0xbb,0xdc,0xbd,0xdb,0xbb,0x10,
+0x7c,0xad,0xca,0xdc,0xac,0x80,0x07,0xb7,0xca,0x7b,0xb7,0xa8,0x00,0x15,0x93,0x89,
+0x33,0x33,0x20,0x03,0xc2,0x2d,0x99,0x99,0x98,0x02,0xb4,0xdd,0xd8,0x77,0x7d,0x20,
+0x02,0xd3,0x1b,0x87,0x77,0xd2,0x03,0xdd,0x10,0x6c,0xc8,0x88,0x10,0x00,0xb1,0x3a,
+0xe9,0x9c,0xc0,0x00,0x0b,0x16,0x16,0xca,0xc1,0x00,0x00,0xb1,0x9b,0x95,0x47,0xab,
+0x20,0xdf,0x00,0x12,0x0d,0x07,0x00,0xf0,0x13,0xd0,0x09,0xee,0xee,0xb0,0x06,0x7e,
 0x64,0x93,0x00,0x3b,0x00,0x56,0xe5,0x39,0xdc,0xcd,0xb0,0x00,0x0d,0x00,0x93,0x00,
-0x3b,0x01,0x99,0xf9,0x89,0xdc,0xcd,0xb0,0x04,0x6d,0x43,0x93,0xe0,0x81,0xf5,0x0f,
+0x3b,0x01,0x99,0xf9,0x89,0xdc,0xcd,0xb0,0x04,0x6d,0x43,0x1a,0x00,0xf4,0x11,0x05,
 0xf3,0x08,0xee,0xfe,0xa0,0x00,0x87,0xd1,0x09,0x4b,0x20,0x00,0x0d,0x15,0xa0,0xd1,
-0xb2,0x00,0x07,0x90,0x02,0x89,0x0b,0x24,0x51,0xb0,0x00,0xb9,0x00,0x7e,0xfd,0x47,
-0x12,0x32,0x99,0x09,0xf0,0x02,0xd0,0x0d,0xdc,0xcd,0xf0,0x16,0x6b,0x71,0xd0,0x00,
-0x1f,0x01,0x77,0x7e,0x2d,0xcb,0xbc,0xc4,0x92,0xf0,0x07,0xd0,0x00,0x1f,0x00,0x04,
-0xf2,0x0d,0xcb,0xbc,0xf0,0x07,0xfe,0xb0,0xd0,0x00,0x1f,0x06,0xc4,0xc7,0x6b,0xfd,
-0xfd,0x04,0x6f,0xfc,0x08,0x0d,0x1b,0x30,0x00,0x02,0xc0,0x01,0xc0,0xb3,0x03,0x00,
-0x2c,0x01,0xc5,0x0b,0x32,0xb0,0x02,0xc1,0xd5,0x00,0x6d,0xe6,0x3d,0x09,0xf1,0x0d,
-0x6a,0x00,0x00,0x3a,0x0c,0x20,0xbe,0xcc,0xc1,0x3a,0x0c,0x22,0xe3,0x81,0x10,0x3a,
-0x0c,0x2b,0x80,0x96,0x00,0x27,0x08,0x15,0x00,0x09,0x00,0x02,0x42,0x68,0x30,0x03,
-0x90,0x05,0xb6,0x87,0x30,0x90,0x0f,0x20,0x06,0x00,0x10,0x1f,0x07,0x7b,0xf8,0x03,
-0x20,0xab,0xe0,0x02,0x20,0x00,0x4c,0xb1,0xe0,0x00,0xa0,0x7e,0xa4,0x00,0xad,0xdd,
-0xa0,0x10,0xa2,0x7f,0x10,0x0b,0x8e,0x95,0x20,0x00,0x9b,0xcf,0x27,0x10,0x0a,0x8b,
-0x80,0x30,0xe1,0x2a,0xc4,0x78,0x65,0xe1,0x00,0xb6,0x22,0xe3,0x22,0xe1,0x00,0xbc,
-0xaa,0xfb,0xaa,0xf1,0x00,0xc3,0x12,0x00,0x70,0xee,0xdd,0xfe,0xdd,0xf1,0x02,0xd0,
-0x0c,0x00,0x10,0x09,0x7c,0x70,0x00,0xcf,0x22,0x24,0xe1,0xce,0x2b,0x02,0x02,0x5c,
-0x1d,0xf0,0x2d,0x2f,0xcc,0x27,0xcf,0xdd,0xd0,0x09,0x50,0xd1,0x01,0xc0,0x1c,0x03,
-0xf9,0xbd,0x80,0x96,0x04,0xa0,0x6e,0x3c,0x2d,0x89,0x09,0xb3,0x00,0xc5,0xc5,0xd0,
-0xa1,0xe0,0x00,0x0c,0x6c,0x5d,0x1f,0xdf,0xdc,0x00,0xc0,0xb0,0xd8,0x60,0xe0,0x00,
-0x0d,0xbe,0xbe,0x42,0x1e,0x11,0x00,0xd2,0xb2,0xd6,0xbb,0xfb,0xb2,0x5a,0x0b,0xfd,
-0x23,0x47,0x08,0x30,0x3b,0xa0,0xfe,0x45,0x02,0x9a,0x03,0xf5,0x38,0x4e,0xbb,0x1e,
-0xcd,0xdc,0xf0,0x0b,0x13,0xb0,0xd6,0xa9,0x6d,0x06,0xeb,0xdc,0x56,0xe6,0x66,0x60,
-0x1b,0x0a,0x56,0x7e,0xbb,0xbb,0x00,0xa7,0xca,0xbb,0x18,0x00,0xd0,0x0a,0x6c,0x99,
-0x9a,0xe9,0x3d,0x00,0xb0,0xa5,0x6a,0x0a,0x45,0xd0,0x0c,0xce,0xd6,0xba,0xeb,0x5d,
-0x00,0xb0,0xa5,0x60,0x0a,0x60,0xd0,0x39,0x0a,0x58,0xab,0xdc,0x6c,0x06,0x30,0x5c,
-0x42,0x00,0x2c,0x80,0x84,0x2f,0x12,0x02,0x95,0x0a,0x00,0x2e,0x5d,0x04,0xc2,0x24,
-0x02,0x3c,0x56,0x00,0x8b,0x9d,0x2e,0x70,0x00,0x0d,0x00,0x01,0xd3,0x0e,0x21,0xdd,
-0xb0,0xb4,0x2e,0x11,0x4b,0xed,0x0e,0x21,0x26,0xb0,0xcb,0x99,0x26,0xbb,0x00,0x0c,
-0x11,0x21,0x01,0xe0,0x03,0x28,0x10,0x1e,0x1a,0x04,0x34,0xc2,0x01,0xe0,0x1a,0x46,
-0xf0,0x07,0x7d,0xdd,0x92,0x23,0xe2,0x21,0x01,0x11,0x11,0x9c,0xcf,0xcc,0x60,0x47,
-0x77,0x40,0x01,0xe0,0x00,0x05,0xcc,0xc8,0x1a,0x00,0x40,0x76,0x03,0xa0,0x01,0x80,
-0x23,0x10,0x2a,0x0d,0x00,0x22,0x7e,0xcd,0x0d,0x00,0x02,0x36,0x2a,0x13,0x53,0xa1,
-0x01,0x41,0x07,0xee,0xee,0xd0,0x0f,0x28,0x13,0x1d,0xcf,0x93,0x30,0x07,0xbb,0xb2,
-0x0d,0x00,0xf0,0x01,0x33,0x33,0x15,0xee,0xee,0xd0,0x06,0x77,0x73,0x59,0x00,0x08,
-0x00,0x7a,0xaa,0x35,0xd2,0x96,0xf4,0x09,0x31,0x94,0x59,0x00,0x01,0x30,0xb2,0x09,
-0x45,0x90,0x00,0x49,0x0b,0xcb,0xe4,0x5b,0x11,0x18,0x70,0xb3,0x11,0x01,0xbd,0xdd,
-0x28,0x17,0x11,0xb0,0x3d,0x2b,0x10,0x93,0x39,0x17,0xf3,0x2d,0x6c,0xcc,0xc7,0xbb,
-0xec,0xba,0x01,0x11,0x01,0x2e,0x32,0x22,0x0a,0xaa,0x50,0x0e,0x00,0x00,0x06,0x66,
-0x40,0x0f,0xee,0xe4,0x04,0x44,0x20,0x1c,0x00,0xa4,0x0c,0xcc,0x70,0x48,0x00,0xb3,
-0x0b,0x04,0x90,0x95,0x00,0xc2,0x0b,0x03,0x91,0xe1,0x00,0xd1,0x0f,0xcd,0x9c,0x90,
-0x00,0xe0,0x0b,0x00,0x4c,0x00,0xbd,0x90,0xd3,0x04,0x13,0x31,0x99,0x70,0x70,0x01,
-0xfe,0xee,0x00,0x06,0x6a,0x64,0xc0,0x47,0xf0,0x01,0x44,0x44,0x36,0x80,0x0e,0x00,
-0x06,0xcc,0xc7,0xd2,0x00,0xad,0x60,0x35,0x55,0x55,0xae,0x66,0xf5,0x17,0x55,0x54,
-0xda,0x99,0xbc,0x00,0x7c,0xcc,0x35,0x90,0x0c,0x40,0x09,0x40,0x93,0x0b,0x79,0xa0,
-0x00,0x94,0x09,0x30,0x2f,0xe1,0x00,0x09,0xdc,0xe6,0x8f,0x8a,0xe8,0x20,0x94,0x00,
-0x9c,0x40,0x06,0xd7,0x5f,0x6c,0x01,0x79,0x0c,0x20,0x00,0xc0,0xff,0x03,0xf0,0x01,
-0x1c,0xcd,0xc8,0x55,0x6b,0x65,0x30,0x00,0x00,0x08,0x89,0xe8,0x85,0x06,0xcc,0xc4,
-0xc9,0x0e,0xf0,0x00,0x23,0x33,0x10,0x02,0xc0,0x00,0x05,0x77,0x72,0xad,0xdf,0xdd,
-0x40,0x4a,0xaa,0xe9,0x2c,0x30,0x06,0x81,0xa4,0x1a,0x00,0x30,0x67,0x09,0x40,0x0d,
-0x00,0x80,0xdc,0xd7,0xbb,0xce,0xaa,0x90,0x67,0x00,0x60,0x3a,0x05,0x23,0x1d,0x01,
-0xe8,0x02,0x10,0x93,0xea,0x3b,0xa0,0x07,0xcc,0xcc,0x2e,0xdd,0xdd,0xf0,0x00,0x00,
-0x0b,0x37,0x0d,0xf0,0x1b,0xcc,0xc8,0xbd,0xcc,0x80,0xe0,0x05,0x55,0x30,0xc0,0x1b,
-0x0e,0x00,0x55,0x53,0x0f,0xbb,0xb1,0xd0,0x0c,0xcc,0x70,0xc0,0x1b,0x1c,0x00,0xb0,
-0x39,0x0e,0x9a,0xb2,0xb0,0x0b,0x03,0x90,0xd4,0x43,0x4a,0x00,0xfc,0xd9,0x00,0x10,
-0x86,0x00,0x82,0x1c,0x11,0xf3,0x52,0x00,0x14,0x21,0x8f,0x03,0x00,0x09,0x31,0x20,
-0xe5,0x20,0xe9,0x57,0xf0,0x04,0x0e,0x2c,0x03,0xbb,0xba,0x46,0x66,0xf6,0x83,0x01,
-0x11,0x17,0x88,0x8f,0x98,0x40,0x9c,0xc8,0x00,0x54,0x26,0xf1,0x18,0x55,0x39,0xaa,
-0x7c,0x10,0x00,0x45,0x53,0x2c,0x41,0xb3,0x00,0x09,0xcc,0x80,0xb2,0x09,0x50,0x00,
-0xc1,0x2b,0x0b,0x20,0x77,0x00,0x0c,0x02,0xb4,0xdd,0xd6,0xb3,0x70,0xcc,0xdb,0xd8,
-0x30,0x0e,0x66,0x0c,0x47,0x1c,0x10,0x10,0x9e,0x01,0xe0,0x25,0x95,0x00,0x09,0x50,
-0x3c,0xdf,0x74,0x00,0x7a,0xbb,0xa1,0x00,0xe0,0xdd,0x22,0x00,0x07,0x0d,0x30,0x1c,
-0xcc,0x87,0x12,0x57,0x30,0x55,0x53,0x00,0x26,0x21,0x20,0x55,0x30,0x1a,0x00,0x90,
-0xcc,0xc9,0x0f,0xdd,0xde,0xb0,0x1b,0x01,0xb0,0x7b,0x28,0x30,0xb0,0x1b,0x0e,0xc7,
-0x59,0xf1,0x01,0x67,0xb0,0xe3,0x33,0x5b,0x01,0xd6,0x64,0x0f,0xaa,0xab,0xa0,0x00,
-0xa0,0x00,0x90,0x3c,0x1c,0xf2,0x05,0x09,0x60,0x2d,0x00,0x6a,0xba,0xa3,0x7b,0x59,
-0x94,0x01,0x11,0x11,0x48,0x8f,0x98,0x70,0x0c,0xcc,0x70,0x78,0x56,0xd0,0x17,0x7e,
-0x87,0x30,0x0b,0xbb,0x71,0x88,0xf8,0x84,0x00,0x88,0x86,0x66,0x0d,0x30,0x1c,0x12,
-0xba,0x48,0x07,0x20,0xb0,0x1b,0x0d,0x00,0x30,0x1f,0xcd,0xb0,0x74,0x67,0x02,0xed,
-0x9a,0x06,0xbd,0x0d,0x00,0x0d,0x00,0xc3,0x59,0x01,0x11,0xd3,0x11,0x04,0xcc,0xcb,
-0x8c,0xcf,0xcc,0xc4,0xc6,0x56,0x21,0xcd,0xd8,0xa2,0x7f,0x20,0x22,0x16,0xad,0xa3,
-0xf1,0x17,0xac,0xc7,0x00,0x1d,0x40,0x00,0x0a,0xcc,0x73,0x37,0x19,0x44,0x00,0xc0,
+0xb2,0x00,0x07,0x90,0x02,0x89,0x0b,0x24,0x51,0xb0,0x00,0xb9,0x00,0x7e,0xd3,0x8e,
+0x01,0x12,0x32,0x99,0x09,0xfc,0x37,0xd0,0x0d,0xdc,0xcd,0xf0,0x16,0x6b,0x71,0xd0,
+0x00,0x1f,0x01,0x77,0x7e,0x2d,0xcb,0xbc,0xf0,0x00,0x07,0x80,0xd0,0x00,0x1f,0x00,
+0x04,0xf2,0x0d,0xcb,0xbc,0xf0,0x07,0xfe,0xb0,0xd0,0x00,0x1f,0x06,0xc4,0xc7,0x6b,
+0xfd,0xfd,0xc0,0x00,0x2c,0x00,0x0d,0x1b,0x30,0x00,0x02,0xc0,0x01,0xc0,0xb3,0x03,
+0x00,0x2c,0x01,0xc5,0x0b,0x32,0xb0,0x02,0xc1,0xd5,0x00,0x6d,0xe6,0x3d,0x09,0xf0,
+0x1c,0x6a,0x00,0x00,0x3a,0x0c,0x20,0xbe,0xcc,0xc1,0x3a,0x0c,0x22,0xe3,0x81,0x10,
+0x3a,0x0c,0x2b,0x80,0x96,0x00,0x27,0x08,0x15,0x00,0x09,0x00,0x02,0xdd,0xdd,0xdd,
+0xdc,0x00,0x03,0x90,0x05,0x00,0x1e,0x00,0x03,0x90,0x0f,0x20,0x06,0x00,0xf3,0x08,
+0x1f,0x40,0x1e,0x00,0x00,0x20,0xab,0xe0,0x02,0x20,0x00,0x4c,0xb1,0xe0,0x00,0xa0,
+0x7e,0xa4,0x00,0xad,0xdd,0xa0,0x10,0x0e,0x0b,0x11,0xc0,0x06,0x0c,0xf1,0x15,0xdd,
+0xdd,0xf1,0x00,0x00,0x9b,0x00,0x09,0x70,0x00,0x0a,0xfe,0xee,0xef,0xee,0xe1,0x2a,
+0xc4,0x00,0xe1,0x00,0xe1,0x00,0xb6,0x22,0xe3,0x22,0xe1,0x00,0xbc,0xaa,0xfb,0xaa,
+0xf1,0x00,0xc3,0x12,0x00,0x70,0xee,0xdd,0xfe,0xdd,0xf1,0x02,0xd0,0x0c,0x00,0x20,
+0x09,0x70,0x06,0x00,0x54,0x1d,0x00,0x00,0xe1,0xce,0x2b,0x02,0x11,0x80,0x06,0x00,
+0xf5,0x37,0x2f,0xcc,0x27,0xcf,0xdd,0xd0,0x09,0x50,0xd1,0x01,0xc0,0x1c,0x03,0xf9,
+0xbd,0x80,0x96,0x04,0xa0,0x6e,0x3c,0x2d,0x89,0x09,0xb3,0x00,0xc5,0xc5,0xd0,0xa1,
+0xe0,0x00,0x0c,0x6c,0x5d,0x1f,0xdf,0xdc,0x00,0xc0,0xb0,0xd8,0x60,0xe0,0x00,0x0d,
+0xbe,0xbe,0x42,0x1e,0x11,0x00,0xd2,0xb2,0xd6,0xbb,0xfb,0xb2,0x5a,0x0b,0x0d,0x00,
+0x0e,0x00,0x08,0x30,0x3b,0xa0,0x00,0xe0,0xf1,0x00,0x02,0x9a,0x03,0xf2,0x37,0x4e,
+0xbb,0x1e,0xcd,0xdc,0xf0,0x0b,0x13,0xb0,0xd6,0xa9,0x6d,0x06,0xeb,0xdc,0x56,0xe6,
+0x66,0x60,0x1b,0x0a,0x56,0x7e,0xbb,0xbb,0x00,0xa7,0xca,0xbb,0x18,0x00,0xd0,0x0a,
+0x6c,0x99,0x9a,0xe9,0x3d,0x00,0xb0,0xa5,0x6a,0x0a,0x45,0xd0,0x0c,0xce,0xd6,0xba,
+0xeb,0x5d,0x00,0xb0,0xa5,0x60,0x0a,0x60,0xd0,0x39,0x0a,0x58,0xab,0xdc,0x6c,0x06,
+0x30,0x5c,0x42,0x00,0x2c,0xa1,0x00,0x10,0x10,0xf9,0x00,0x12,0xa0,0xa9,0x0d,0x10,
+0x70,0x72,0x02,0x00,0x01,0x00,0x04,0x01,0x04,0x40,0x2c,0xcc,0xcc,0xcc,0xb1,0x02,
+0x0e,0x0d,0x00,0x81,0x5e,0xdd,0xdd,0xdd,0xb0,0x00,0x05,0x90,0x20,0x06,0xb5,0x5a,
+0x22,0x22,0x26,0xb0,0x00,0x05,0xda,0xaa,0xaa,0xbb,0x14,0x07,0x11,0x80,0xc2,0x02,
+0x40,0x0c,0x00,0x00,0x1e,0x1a,0x04,0x11,0xc2,0xcf,0x02,0x00,0x0d,0x00,0xf0,0x08,
+0x00,0x7d,0xdd,0x92,0x23,0xe2,0x21,0x01,0x11,0x11,0x9c,0xcf,0xcc,0x60,0x47,0x77,
+0x40,0x01,0xe0,0x00,0x05,0xcc,0xc8,0x1a,0x00,0x90,0x76,0x03,0xa0,0x01,0xe0,0x00,
+0x07,0x60,0x2a,0x0d,0x00,0x22,0x7e,0xcd,0x0d,0x00,0x01,0x34,0x00,0x23,0x00,0x53,
+0xa1,0x01,0x50,0x07,0xee,0xee,0xd0,0x3c,0x0a,0x04,0x12,0x1d,0x4b,0x04,0x40,0xd0,
+0x07,0xbb,0xb2,0x0d,0x00,0xf3,0x1e,0x33,0x33,0x15,0xee,0xee,0xd0,0x06,0x77,0x73,
+0x59,0x00,0x08,0x00,0x7a,0xaa,0x35,0x90,0x00,0x00,0x0b,0x31,0x94,0x59,0x00,0x01,
+0x30,0xb2,0x09,0x45,0x90,0x00,0x49,0x0b,0xcb,0xe4,0x5b,0x11,0x18,0x70,0xb3,0x11,
+0x01,0xbd,0xdd,0xb1,0xa3,0x00,0x20,0xb0,0x00,0x57,0x0d,0xf3,0x32,0x93,0x00,0x00,
+0xb1,0x00,0x6c,0xcc,0xc7,0xbb,0xec,0xba,0x01,0x11,0x01,0x2e,0x32,0x22,0x0a,0xaa,
+0x50,0x0e,0x00,0x00,0x06,0x66,0x40,0x0f,0xee,0xe4,0x04,0x44,0x20,0x1c,0x00,0xa4,
+0x0c,0xcc,0x70,0x48,0x00,0xb3,0x0b,0x04,0x90,0x95,0x00,0xc2,0x0b,0x03,0x91,0xe1,
+0x00,0xd1,0x0f,0xcd,0x9c,0x90,0x00,0xe0,0x0b,0x00,0x4c,0x00,0xbd,0x90,0xd3,0x04,
+0x11,0x31,0x54,0x00,0xf4,0x38,0x05,0xa0,0x01,0xfe,0xee,0x00,0x06,0x6a,0x64,0x2c,
+0x00,0xe0,0x00,0x44,0x44,0x36,0x80,0x0e,0x00,0x06,0xcc,0xc7,0xd2,0x00,0xad,0x60,
+0x35,0x55,0x55,0x33,0x33,0x30,0x03,0x55,0x54,0xda,0x99,0xbc,0x00,0x7c,0xcc,0x35,
+0x90,0x0c,0x40,0x09,0x40,0x93,0x0b,0x79,0xa0,0x00,0x94,0x09,0x30,0x2f,0xe1,0x00,
+0x09,0xdc,0xe6,0x8f,0x8a,0xe8,0x20,0x94,0x00,0x9c,0x40,0x06,0xd7,0x46,0x01,0x11,
+0x45,0x79,0x0c,0x20,0x00,0xc0,0xff,0x03,0xf0,0x01,0x1c,0xcd,0xc8,0x55,0x6b,0x65,
+0x30,0x00,0x00,0x08,0x89,0xe8,0x85,0x06,0xcc,0xc4,0xc9,0x0e,0xf0,0x07,0x23,0x33,
+0x10,0x02,0xc0,0x00,0x05,0x77,0x72,0xad,0xdf,0xdd,0x40,0x4a,0xaa,0x30,0x02,0xc0,
+0x00,0x06,0x81,0xa4,0x1a,0x00,0x30,0x67,0x09,0x40,0x0d,0x00,0xc0,0xdc,0xd7,0xbb,
+0xce,0xaa,0x90,0x67,0x00,0x03,0x33,0x33,0x33,0x12,0x00,0x01,0x00,0xf1,0x3e,0x1b,
+0x00,0x02,0xc0,0x00,0x00,0x00,0x93,0x00,0x89,0x00,0x00,0x07,0xcc,0xcc,0x2e,0xdd,
+0xdd,0xf0,0x00,0x00,0x0b,0x90,0x00,0x0e,0x00,0xcc,0xc8,0xbd,0xcc,0x80,0xe0,0x05,
+0x55,0x30,0xc0,0x1b,0x0e,0x00,0x55,0x53,0x0f,0xbb,0xb1,0xd0,0x0c,0xcc,0x70,0xc0,
+0x1b,0x1c,0x00,0xb0,0x39,0x0e,0x9a,0xb2,0xb0,0x0b,0x03,0x90,0xd4,0x43,0x4a,0x00,
+0xfc,0xd9,0x00,0x00,0x07,0x80,0x0b,0x00,0x00,0x00,0x7c,0xf3,0x52,0x00,0x23,0x21,
+0x00,0x01,0x00,0xf0,0x39,0x0c,0x00,0x00,0x00,0xe5,0x20,0x00,0x76,0x00,0x00,0x0e,
+0x2c,0x03,0xbb,0xba,0x46,0x66,0xf6,0x83,0x01,0x11,0x17,0x88,0x8f,0x98,0x40,0x9c,
+0xc8,0x00,0x00,0xd0,0x00,0x04,0x55,0x39,0xaa,0x7c,0x10,0x00,0x45,0x53,0x2c,0x41,
+0xb3,0x00,0x09,0xcc,0x80,0xb2,0x09,0x50,0x00,0xc1,0x2b,0x0b,0x20,0x77,0x00,0x0c,
+0x02,0xb4,0xdd,0xd6,0xb3,0x70,0xcc,0xdb,0xd8,0x30,0x0e,0x66,0x0c,0x4c,0x00,0xf0,
+0x16,0x6e,0x10,0x00,0xa0,0x00,0x00,0x25,0x95,0x00,0x09,0x50,0x3c,0xdf,0x74,0x00,
+0x7a,0xbb,0xa1,0x00,0xe0,0x00,0x01,0x11,0x11,0x00,0x0e,0x00,0x00,0x1c,0xcc,0x87,
+0xee,0xfe,0xee,0x60,0x55,0x53,0x0d,0x00,0x30,0x05,0x55,0x30,0x1a,0x00,0xf0,0x30,
+0xcc,0xc9,0x0f,0xdd,0xde,0xb0,0x1b,0x01,0xb0,0xe0,0x00,0x3b,0x01,0xb0,0x1b,0x0e,
+0x00,0x03,0xb0,0x1d,0x67,0xb0,0xe3,0x33,0x5b,0x01,0xd6,0x64,0x0f,0xaa,0xab,0xa0,
+0x00,0xa0,0x00,0x90,0x00,0x93,0x00,0x09,0x50,0x09,0x60,0x2d,0x00,0x6a,0xba,0xa3,
+0x7b,0x59,0x94,0x01,0x11,0x11,0x48,0x8f,0x98,0x70,0x0c,0xcc,0x70,0x00,0xd1,0x73,
+0x00,0xf0,0x0b,0x17,0x7e,0x87,0x30,0x0b,0xbb,0x71,0x88,0xf8,0x84,0x00,0x88,0x86,
+0x00,0x0d,0x10,0x00,0x1c,0x12,0xba,0xee,0xfe,0xee,0x11,0xb0,0x1b,0x0d,0x00,0x90,
+0x1f,0xcd,0xb0,0x00,0xd1,0x00,0x01,0xb0,0x00,0x0d,0x00,0x04,0xf1,0x00,0x11,0x20,
+0x0d,0x00,0xc0,0x59,0x01,0x11,0xd3,0x11,0x04,0xcc,0xcb,0x8c,0xcf,0xcc,0xc4,0x17,
+0x00,0x50,0xd1,0x00,0x00,0xcd,0xd8,0x1a,0x00,0xf1,0x21,0x01,0x22,0x16,0xee,0xee,
+0xee,0x10,0xac,0xc7,0x00,0x1d,0x40,0x00,0x0a,0xcc,0x73,0x37,0x19,0x44,0x00,0xc0,
 0x39,0x85,0xe0,0x03,0xd0,0x0c,0x02,0xac,0x1e,0x01,0xbb,0x40,0xdc,0xda,0x60,0xe0,
-0x29,0x74,0x0c,0x00,0x00,0x0b,0xde,0x50,0x25,0x4c,0x01,0x4b,0x73,0xa0,0x1d,0xde,
-0xed,0xe0,0x6c,0xdc,0xc0,0xc1,0xa2,0x0d,0x94,0x2f,0xfb,0x27,0x0c,0x01,0xc0,0x0c,
-0xcc,0x81,0x09,0x60,0x3a,0x00,0x44,0x42,0x1b,0x90,0xbd,0x50,0x06,0x66,0x40,0x31,
-0x70,0x00,0x00,0xcc,0xc8,0x25,0xaa,0x47,0x20,0x0c,0x01,0xb7,0x6d,0x16,0x3b,0x00,
-0xc0,0x1b,0xc2,0xd0,0x08,0xc2,0x0f,0xcd,0xca,0x0d,0x00,0xc5,0x10,0xc0,0x00,0x00,
-0xcd,0xda,0x33,0x04,0xf0,0x07,0x0b,0x40,0x8c,0xee,0xcc,0xc0,0x47,0x98,0x71,0x0a,
-0x50,0x00,0x02,0x33,0x33,0x4a,0xfb,0xaf,0x00,0x0c,0xcc,0x80,0x1b,0x3b,0x81,0x55,
-0x54,0x79,0xd7,0x7f,0x71,0x05,0x55,0xea,0x93,0xf3,0x13,0xcc,0xc9,0x3d,0xdd,0xdd,
-0x50,0x1c,0x01,0xc3,0xa0,0x00,0x86,0x01,0xc0,0x0c,0x3a,0x00,0x08,0x60,0x1f,0xcd,
-0xc3,0xda,0xaa,0xd6,0x01,0xc0,0x00,0x3b,0x33,0x39,0x60,0x00,0x70,0xd7,0x9a,0xf0,
-0x01,0x1f,0xdd,0xdd,0xd0,0x37,0x99,0x71,0xc0,0x00,0x1d,0x01,0x33,0x33,0x1e,0x66,
-0x67,0x2a,0x02,0xf6,0x22,0x66,0x66,0x65,0x00,0x00,0x00,0x27,0x77,0x77,0x71,0x0b,
-0xbb,0x72,0x77,0xd9,0x77,0x10,0x55,0x53,0x11,0x1c,0x41,0x11,0x0e,0x78,0xb9,0xbc,
-0xfd,0xbb,0x60,0xc0,0x1b,0x00,0x9a,0xd1,0x00,0x0f,0xcd,0xb2,0x9d,0x06,0xd6,0x00,
-0xc0,0x00,0xcb,0x10,0x05,0xd6,0xd4,0xa5,0xf0,0x12,0x17,0x07,0x20,0x00,0x07,0x60,
-0x09,0x60,0x3b,0x00,0x4a,0xba,0xa4,0xc0,0x00,0x97,0x00,0x11,0x12,0xe8,0x55,0x56,
-0xe2,0x0b,0xcc,0x81,0xe7,0x77,0xc6,0x00,0x55,0x53,0x0d,0xe5,0x58,0xf4,0x17,0x55,
-0x30,0xe9,0x99,0xc5,0x00,0xbc,0xc9,0x03,0xe2,0xe2,0x10,0x0c,0x01,0xb0,0x3d,0x0e,
-0x00,0x00,0xc0,0x1b,0x08,0x90,0xe0,0x62,0x0e,0xcd,0xc6,0xf2,0x0e,0x09,0x30,0xc0,
-0x01,0xe5,0x00,0xbc,0xd0,0xd6,0x04,0x13,0x60,0xeb,0x1b,0xf0,0x05,0x4e,0xde,0xed,
-0xf0,0x4a,0xbb,0x94,0x70,0x83,0x0b,0x00,0x11,0x11,0x47,0x9d,0xc6,0xb0,0x0b,0xcc,
-0x64,0x0d,0x00,0xf0,0x15,0x44,0x42,0x58,0xbc,0xc9,0xb0,0x05,0x66,0x35,0x63,0x33,
-0x1b,0x00,0xbc,0xc7,0x65,0xc6,0x96,0xb0,0x0c,0x04,0x98,0x4b,0x04,0x6b,0x00,0xc0,
-0x39,0xb1,0xcb,0xb5,0xb0,0x0e,0xcd,0xbc,0x05,0x76,0x10,0x45,0x09,0x40,0x00,0x2c,
-0x55,0x00,0x05,0xe8,0x02,0x10,0x0e,0x8a,0x12,0xf0,0x26,0x05,0xbb,0xfb,0xbb,0x25,
+0x29,0x74,0x0c,0x00,0x00,0x0b,0xde,0x50,0x00,0x01,0x50,0x55,0x00,0xf4,0x38,0x0b,
+0x40,0x1d,0xde,0xed,0xe0,0x6c,0xdc,0xc0,0xc1,0xa2,0x0d,0x00,0x00,0x00,0x69,0x0c,
+0x01,0xc0,0x0c,0xcc,0x81,0x09,0x60,0x3a,0x00,0x44,0x42,0x1b,0x90,0xbd,0x50,0x06,
+0x66,0x40,0x31,0x70,0x00,0x00,0xcc,0xc8,0x25,0xaa,0x47,0x20,0x0c,0x01,0xb7,0x6d,
+0x16,0x3b,0x00,0xc0,0x1b,0xc2,0xd0,0x08,0xc2,0x0f,0xcd,0xca,0x0d,0x00,0xc5,0x10,
+0xc0,0x00,0x00,0xcd,0xda,0x00,0x01,0x00,0x13,0x60,0x55,0x00,0xf1,0x38,0x8c,0xee,
+0xcc,0xc0,0x47,0x98,0x71,0x0a,0x50,0x00,0x02,0x33,0x33,0x4a,0xfb,0xaf,0x00,0x0c,
+0xcc,0x80,0x0e,0x00,0xe0,0x00,0x55,0x54,0x79,0xd7,0x7f,0x71,0x05,0x55,0x34,0x44,
+0x44,0x44,0x00,0xcc,0xc9,0x3d,0xdd,0xdd,0x50,0x1c,0x01,0xc3,0xa0,0x00,0x86,0x01,
+0xc0,0x0c,0x3a,0x00,0x08,0x60,0x1f,0xcd,0xc3,0xda,0xaa,0xd6,0x01,0xc0,0x00,0x3b,
+0x33,0x39,0x60,0x00,0x70,0x4e,0x00,0xf0,0x03,0x0a,0x50,0x1f,0xdd,0xdd,0xd0,0x37,
+0x99,0x71,0xc0,0x00,0x1d,0x01,0x33,0x33,0x1e,0x66,0x67,0x2a,0x02,0xf4,0x22,0x66,
+0x66,0x65,0x00,0x00,0x00,0x27,0x77,0x77,0x71,0x0b,0xbb,0x72,0x77,0xd9,0x77,0x10,
+0x55,0x53,0x11,0x1c,0x41,0x11,0x0e,0x78,0xb9,0xbc,0xfd,0xbb,0x60,0xc0,0x1b,0x00,
+0x9a,0xd1,0x00,0x0f,0xcd,0xb2,0x9d,0x06,0xd6,0x00,0xc0,0x00,0xcb,0x10,0x05,0xd6,
+0xa3,0x00,0xf1,0x3e,0xa0,0x00,0x17,0x07,0x20,0x00,0x07,0x60,0x09,0x60,0x3b,0x00,
+0x4a,0xba,0xa4,0xc0,0x00,0x97,0x00,0x11,0x12,0xe8,0x55,0x56,0xe2,0x0b,0xcc,0x81,
+0xe7,0x77,0xc6,0x00,0x55,0x53,0x0d,0x00,0x08,0x50,0x05,0x55,0x30,0xe9,0x99,0xc5,
+0x00,0xbc,0xc9,0x03,0xe2,0xe2,0x10,0x0c,0x01,0xb0,0x3d,0x0e,0x00,0x00,0xc0,0x1b,
+0x08,0x90,0xe0,0x62,0x0e,0xcd,0xc6,0xf2,0x0e,0x09,0x30,0xc0,0x01,0xe5,0x00,0xbc,
+0xd0,0x52,0x00,0x14,0x10,0xf8,0x00,0xf0,0x07,0x09,0x50,0x4e,0xde,0xed,0xf0,0x4a,
+0xbb,0x94,0x70,0x83,0x0b,0x00,0x11,0x11,0x47,0x9d,0xc6,0xb0,0x0b,0xcc,0x64,0x0d,
+0x00,0xf5,0x1d,0x44,0x42,0x58,0xbc,0xc9,0xb0,0x05,0x66,0x35,0x63,0x33,0x1b,0x00,
+0xbc,0xc7,0x65,0xc6,0x96,0xb0,0x0c,0x04,0x98,0x4b,0x04,0x6b,0x00,0xc0,0x39,0xb1,
+0xcb,0xb5,0xb0,0x0e,0xcd,0xbc,0x05,0x00,0x0c,0x00,0xc0,0x09,0x40,0x00,0x2c,0x55,
+0x00,0x04,0xe8,0x02,0x00,0x79,0x02,0xf0,0x41,0x00,0x86,0x05,0xbb,0xfb,0xbb,0x25,
 0xab,0xaa,0x27,0x7f,0x77,0x70,0x11,0x11,0x10,0x33,0xf3,0x33,0x00,0xcc,0xc8,0x9b,
 0xbd,0xbb,0xb6,0x05,0x55,0x30,0x67,0x77,0x75,0x00,0x55,0x53,0x0e,0x22,0x25,0xb0,
 0x0c,0xcc,0x90,0xea,0xaa,0xbb,0x00,0xd0,0x1b,0x0e,0x55,0x57,0xb0,0x0c,0x01,0xb0,
-0xe3,0x2f,0x70,0xfc,0xdb,0x0e,0x00,0x02,0xb0,0x0c,0x42,0x10,0x10,0xb9,0xd8,0x04,
-0x00,0xdd,0x12,0x00,0x19,0x1a,0x00,0x3e,0x4c,0xf0,0x07,0x6c,0xe4,0xbb,0x10,0x26,
-0x88,0x56,0x4c,0x08,0x58,0x01,0x44,0x43,0x1e,0x82,0x4f,0x30,0x0b,0xcc,0x69,0x99,
-0x99,0x01,0xa1,0xa0,0x75,0x55,0x55,0x50,0x0a,0xbb,0x60,0xd7,0x77,0xe0,0x12,0x01,
-0x00,0x3f,0x55,0xf0,0x02,0x78,0x90,0xac,0xcc,0xc0,0x00,0xc0,0x29,0x04,0x90,0x77,
-0x00,0x0e,0xcd,0x90,0x0c,0x0d,0x2c,0x04,0x45,0xbc,0xcc,0xdc,0xc1,0xd0,0x07,0xf0,
-0x01,0x02,0xb0,0x3b,0x00,0x00,0x84,0x07,0x9e,0xad,0xc9,0x24,0xee,0xed,0x34,0xa5,
-0xc2,0xe8,0x6c,0xf1,0x04,0x99,0x2c,0x2a,0x00,0xbc,0xc7,0x09,0x92,0xc6,0x30,0x02,
-0x22,0x1c,0xce,0xdf,0xcc,0x40,0xab,0xb6,0x9e,0x31,0x80,0x44,0x20,0xfc,0xcc,0xd7,
-0x00,0xd8,0xa9,0x68,0x1b,0xf9,0x05,0x0c,0x03,0x90,0xfa,0xaa,0xd7,0x00,0xd5,0x79,
-0x0e,0x11,0x17,0x70,0x0d,0x77,0x40,0xfa,0xaa,0xc7,0x00,0xcc,0x1a,0xf2,0x32,0x0a,
-0x26,0x60,0x0c,0x10,0x00,0x15,0xd5,0x77,0x45,0xea,0xbb,0x30,0x7c,0x99,0xb8,0xdd,
-0x1a,0x30,0x3e,0xa8,0x78,0x62,0x4d,0xa0,0x00,0x69,0x79,0xb2,0x5c,0xad,0x70,0x02,
-0x31,0x79,0x97,0x10,0x08,0x20,0xaa,0xaa,0xac,0xaa,0xaa,0xa0,0x00,0x38,0x88,0x88,
-0x88,0x60,0x00,0x03,0x88,0x88,0x88,0x86,0x00,0x00,0x49,0x99,0x99,0x99,0x80,0x00,
-0x0c,0x8d,0x65,0x00,0x8b,0x99,0x99,0x99,0xd0,0x55,0x00,0xf8,0x3e,0x00,0x03,0x80,
-0x0b,0x10,0x00,0x83,0x06,0xbf,0xbc,0xeb,0x32,0xcc,0xca,0x02,0x29,0x52,0x20,0x01,
-0x22,0x10,0x77,0xb9,0x76,0x00,0x69,0x95,0xbb,0xbd,0xcb,0xb6,0x05,0x77,0x42,0x58,
-0x99,0x35,0x00,0x34,0x42,0x56,0xd0,0xc0,0xa3,0x08,0xbb,0x6b,0xbf,0xbe,0xcb,0x60,
-0xb0,0x48,0x00,0xd3,0x95,0x70,0x0b,0x03,0x9c,0xce,0x76,0xe4,0x00,0xcb,0xc8,0x00,
-0xd0,0xad,0x08,0x0b,0x00,0x04,0x9b,0x84,0x4a,0x50,0xb0,0x00,0x00,0x48,0x1e,0xe0,
-0xe0,0x1a,0x00,0x00,0x67,0x0a,0xaf,0xab,0xea,0x36,0xcc,0xcc,0x09,0x56,0x53,0x06,
-0xb0,0x03,0xfb,0xbe,0xa9,0x00,0xbc,0xc8,0xde,0x77,0xe7,0x40,0x00,0x79,0xf3,0x1b,
-0x2d,0x21,0x00,0xab,0xb7,0x0e,0x88,0xe8,0x50,0x07,0x77,0x40,0xe9,0x9b,0x99,0x10,
-0xe4,0x6a,0x7c,0xbb,0xbb,0x60,0x0d,0x02,0xa0,0x2c,0x56,0xb1,0x00,0xfc,0xda,0x15,
-0x9f,0xf8,0x30,0x0d,0x00,0x0e,0xd8,0x11,0xaf,0x50,0x0d,0x02,0x11,0xa0,0xde,0x40,
-0xf5,0x37,0x08,0x80,0x7a,0xaf,0xba,0xa2,0x2b,0xbc,0xa2,0x99,0xba,0x98,0x00,0x11,
-0x11,0x79,0xa9,0xa9,0xa1,0x08,0xcc,0x79,0x2a,0x0a,0x0a,0x20,0x33,0x32,0x89,0xc8,
-0xc9,0xc1,0x06,0x88,0x52,0xa9,0x99,0x98,0x00,0x57,0x74,0x3c,0x77,0x78,0xc0,0x0b,
-0x57,0x93,0xc7,0x77,0x8c,0x00,0xb0,0x39,0x3c,0x87,0x88,0xc0,0x0b,0xcd,0x91,0x8a,
-0x06,0xb3,0x00,0xb1,0x02,0xe8,0x00,0x03,0x85,0x15,0xf8,0x3d,0x90,0x04,0x60,0x02,
-0x80,0x00,0x66,0x67,0x9c,0x92,0xb2,0x70,0x2f,0xa6,0x48,0x88,0x9c,0xc4,0x00,0x39,
-0x73,0x55,0x50,0x76,0x80,0x1e,0xbc,0x54,0x44,0x8f,0xac,0x10,0x64,0x57,0xa9,0xc4,
-0x24,0x70,0x27,0xa8,0x87,0x4b,0x92,0xa8,0x12,0x33,0x68,0x33,0x34,0x03,0x10,0x00,
-0x6f,0xcc,0xcc,0xdf,0xcb,0x01,0xc9,0x6a,0x30,0x5d,0x50,0x00,0x02,0x02,0x7f,0xfe,
-0x62,0x00,0x03,0xde,0xb7,0x30,0x48,0xbd,0x4d,0x0f,0x01,0x64,0x7a,0x21,0xcc,0xe6,
-0x3b,0x2d,0x10,0x3d,0xf0,0xb3,0x40,0xcc,0xcd,0xdc,0xcd,0xd9,0xb3,0x01,0x25,0x86,
-0x10,0xcb,0xc4,0x75,0x2e,0x00,0xd1,0x0d,0x00,0x21,0x0a,0xcc,0xdd,0x4a,0xb7,0x4a,
-0xa0,0x01,0xb9,0x30,0x01,0xda,0x40,0x00,0x00,0x4b,0xc3,0x12,0x00,0x24,0x00,0x22,
-0xec,0xcf,0x56,0x5f,0x14,0xc1,0x0d,0x00,0x23,0xdd,0xd2,0x0d,0x00,0x22,0xeb,0xbf,
-0x1a,0x00,0xd1,0xd1,0xcd,0xfe,0xdc,0x00,0xe0,0x0c,0x1e,0x11,0x13,0xd0,0x0b,0xcc,
-0xcf,0x66,0xfa,0x01,0x68,0x49,0x0e,0x00,0x01,0xd0,0x1d,0x20,0xb4,0xeb,0xbb,0xbd,
-0x04,0x80,0x01,0x0e,0x5e,0x5c,0x10,0x60,0xaf,0x12,0xf1,0x34,0xd0,0x3a,0x00,0x00,
-0x0c,0x09,0x0d,0x08,0xed,0xdd,0x40,0xc0,0xd0,0xd0,0xc1,0x08,0x60,0x0c,0x0d,0x0d,
-0x6c,0x00,0xa2,0x00,0xc0,0xd0,0xdb,0xd2,0x0c,0x00,0x0c,0x0d,0x0d,0x06,0x81,0xc0,
-0x00,0xc0,0xc0,0xd0,0x0d,0x77,0x00,0x0a,0x39,0x0a,0x00,0x8e,0x10,0x00,0x0a,0x59,
-0x00,0x07,0xf2,0x00,0x04,0xc0,0x87,0x06,0xc4,0xd3,0x03,0xc1,0x00,0xa8,0xb1,0x54,
-0x01,0x13,0x10,0x0b,0x7f,0x00,0x2b,0x23,0x90,0xb6,0x21,0xbd,0xdd,0xd0,0x08,0xae,
-0xca,0x40,0x7a,0x02,0x10,0xa4,0x40,0x08,0x90,0x1c,0xce,0xec,0x99,0xdd,0xdd,0x00,
-0x11,0x68,0xdd,0x12,0xf1,0x0e,0x07,0x66,0xa4,0x3b,0x30,0x02,0x20,0x86,0x6c,0x85,
-0xb3,0x00,0x67,0x09,0xb6,0x80,0x08,0xdc,0xce,0x30,0xbc,0xb8,0x00,0x01,0x11,0x00,
-0x0d,0x2e,0xb2,0x45,0x01,0x64,0x18,0xde,0xee,0xee,0xe9,0x02,0xdc,0x8d,0x02,0x70,
-0x2e,0xc0,0xe1,0x18,0xdf,0xdd,0xf2,0x0c,0xcf,0xcb,0x00,0xe0,0x0d,0x10,0x83,0x3a,
-0x60,0x00,0xe0,0x3d,0xdf,0xdd,0xac,0x61,0x52,0xf1,0x11,0xc1,0x04,0x54,0x44,0x40,
-0x0a,0x2c,0x10,0x2e,0x99,0x9d,0x00,0xc2,0xcd,0xd4,0xb0,0x01,0xd0,0x0d,0x5c,0x10,
-0x2b,0x00,0x1d,0x00,0xdc,0xd1,0x02,0xcc,0xcc,0xb0,0x1b,0xc7,0xaa,0x73,0x06,0x60,
-0x4a,0xee,0xee,0xee,0xe7,0xab,0x02,0x00,0x69,0x32,0x12,0xef,0xe3,0x13,0x11,0x0f,
-0xe3,0x13,0x00,0x53,0x73,0x00,0x48,0x78,0x04,0xcc,0x0e,0x21,0x03,0xb0,0xeb,0x25,
-0x90,0x7a,0x00,0xfe,0xee,0xe4,0x00,0x0a,0xe0,0x0f,0xd6,0x01,0x30,0xe9,0x90,0xf0,
-0x82,0x0f,0x30,0x0b,0xcf,0x10,0x9f,0x2b,0x34,0x05,0xae,0xfe,0x05,0x73,0xb0,0x0d,
-0xdd,0xf2,0xdf,0xff,0xff,0x10,0xd0,0x0b,0x2d,0x10,0x0d,0x04,0x20,0xb2,0xd1,0x07,
-0x2b,0x70,0xfd,0x2d,0xed,0xde,0xb0,0x00,0x1b,0xb1,0x74,0xb0,0x00,0xd1,0xe9,0x5d,
-0x10,0x02,0xb0,0x0d,0x1c,0x11,0xde,0x33,0x33,0x11,0xb0,0xda,0x9e,0x30,0x1d,0x87,
-0xd1,0x37,0x29,0xf0,0x00,0xc7,0x2d,0x43,0x33,0x31,0x36,0x10,0x00,0x9b,0xbb,0xbb,
-0x40,0x0d,0xdd,0xf5,0x48,0x1f,0x30,0xd0,0x0b,0x5c,0xe8,0x51,0xf0,0x2b,0x00,0xb5,
-0xea,0xaa,0xad,0x00,0xbd,0xfd,0x4d,0x11,0x12,0xd0,0x02,0x1b,0x02,0xe7,0x77,0x8d,
-0x00,0xc1,0xfc,0x5d,0x2c,0x42,0x40,0x0c,0x1b,0x02,0xc0,0x68,0x6d,0x30,0xc1,0xb0,
-0x2c,0x00,0xea,0x00,0x0c,0x4e,0xc7,0xc0,0x06,0xd1,0x05,0xea,0x62,0x5e,0xbe,0x38,
-0xd4,0x00,0x00,0x05,0x83,0x00,0x04,0x40,0x08,0x0c,0xf0,0x3b,0x20,0x00,0x00,0xdd,
-0xde,0x30,0xed,0xcc,0x50,0x0d,0x00,0x83,0x6a,0x11,0xd6,0x00,0xd0,0x08,0x6c,0xd3,
-0x5e,0x00,0x0b,0xdf,0xdb,0x33,0xce,0x40,0x00,0x10,0xe0,0x00,0x2e,0xd2,0x00,0x0c,
-0x0f,0x84,0x8b,0x22,0xb9,0x20,0xc0,0xe3,0x9e,0xdd,0xdd,0xe4,0x0c,0x0e,0x00,0xb2,
-0x00,0x2b,0x00,0xc0,0xe6,0x4b,0x20,0x02,0xb0,0x3e,0xed,0x92,0xb3,0x11,0x4b,0x03,
-0x51,0x00,0x0b,0xcb,0xbc,0xb0,0x83,0x01,0x10,0x0e,0x4e,0x00,0x20,0x00,0xe0,0xdb,
-0x34,0x30,0xda,0x1e,0x0e,0xda,0x7e,0xf7,0x28,0x59,0xe0,0xe4,0xb0,0x0a,0xde,0xc0,
-0xbe,0x0e,0xb2,0x00,0x43,0x80,0x00,0xe0,0xe1,0x00,0x0b,0x3f,0xd0,0x6e,0x0e,0xd3,
-0x00,0xb3,0x81,0xbb,0xe0,0xe3,0xd3,0x0b,0x38,0x07,0x5b,0x0e,0x03,0x20,0xb4,0xb9,
-0x29,0x60,0xe0,0x12,0x4f,0xd9,0x44,0xe0,0x0e,0x04,0x81,0x20,0x02,0xd2,0x00,0xae,
-0x8c,0x80,0xfd,0x3b,0x50,0x41,0x23,0x00,0xed,0xd9,0x2b,0x0b,0x26,0x50,0x0c,0x02,
-0x9b,0x30,0xe1,0x94,0x00,0xc0,0x2c,0x67,0x5b,0xac,0xc0,0x0c,0xee,0x81,0xcb,0x18,
-0x36,0x50,0x16,0x60,0x98,0x10,0x65,0x00,0x0b,0x6c,0x9d,0x82,0x86,0x50,0x00,0xb6,
-0x83,0x48,0x49,0x6e,0xd1,0x0b,0x66,0x03,0x85,0xa6,0x50,0x00,0xb7,0xb9,0x38,0x7e,
-0x75,0x00,0x4f,0xc8,0x33,0x8c,0x6e,0x60,0x01,0x10,0x00,0x3a,0x80,0x6c,0x61,0x37,
-0x01,0xb2,0x25,0x00,0x25,0x80,0x11,0x10,0x1f,0x0b,0x10,0xd1,0x24,0x49,0x31,0xbb,
-0xbf,0x10,0xbf,0x3d,0x21,0xd1,0x30,0x0d,0x00,0x11,0x7b,0x0d,0x00,0x43,0xdc,0x00,
-0x0c,0xdf,0xc1,0x78,0x30,0x03,0xc8,0xe1,0x9e,0x47,0xe2,0xc2,0x0d,0x10,0x00,0x04,
-0xad,0x60,0x00,0xe1,0x00,0x1e,0xa4,0x00,0x4e,0x98,0x97,0x06,0xde,0x43,0x30,0x8c,
-0xcc,0xcf,0xae,0x86,0x11,0x22,0xd9,0x31,0xc0,0x09,0xcc,0xcf,0xdc,0xcd,0x20,0x00,
-0xb3,0x00,0xd2,0x00,0xc2,0x65,0x25,0x25,0xcc,0xcf,0x0d,0x00,0x60,0xca,0xaf,0xba,
-0xaf,0x20,0x00,0xb0,0x08,0x12,0x10,0xbd,0x33,0x1a,0xd7,0xec,0x70,0x10,0x0d,0x03,
-0x00,0xf0,0x26,0x29,0x9e,0x99,0x00,0x0d,0x00,0x14,0x5e,0x44,0x13,0x3e,0x33,0x0b,
-0xbf,0xb9,0x8c,0xaf,0xaf,0x0b,0x0b,0x0c,0x86,0x0d,0x0d,0x0e,0xae,0xac,0x86,0x0d,
-0x0d,0x0b,0x0b,0x0c,0x8a,0x7e,0x7e,0x0c,0xbf,0xba,0x8a,0x6e,0x6e,0x13,0x3d,0x33,
-0x86,0x0d,0x0d,0x49,0x9e,0x99,0x96,0x0d,0x91,0x06,0x20,0x8e,0xdf,0x4c,0x5c,0x35,
-0x86,0x00,0x0c,0xf2,0x55,0x00,0x58,0x1e,0xf1,0x1e,0x09,0x9e,0x98,0x11,0x4b,0x11,
-0x00,0x44,0xd4,0x3c,0xcc,0xcc,0xc5,0x09,0xcf,0xb7,0x08,0x40,0x91,0x00,0xc0,0xb2,
-0x92,0xd0,0x05,0xc0,0x0c,0xbe,0xca,0xd7,0x10,0x4a,0x70,0xc0,0xb2,0x93,0x77,0x2d,
-0x10,0x0c,0xbe,0xc9,0x00,0xd9,0x60,0x34,0x00,0x70,0xf0,0x00,0x2d,0xdf,0xdb,0x01,
-0xde,0x0d,0x00,0x86,0x04,0xd6,0x1d,0x91,0x00,0x0d,0x02,0xc3,0x24,0x60,0x05,0x7e,
-0x03,0x92,0x0e,0x29,0x00,0x05,0xcc,0xfc,0xc3,0xe1,0x8a,0x81,0x27,0x30,0x60,0x0c,
-0xcc,0x90,0x4e,0xf5,0x26,0x60,0x11,0x1e,0x11,0x1b,0x30,0x20,0x07,0xaa,0xfa,0xa7,
-0xa4,0x4b,0x00,0x39,0x8e,0x89,0x38,0x6b,0x50,0x05,0xb8,0xe8,0xb4,0x5b,0xe0,0x00,
-0x59,0x4d,0x49,0x42,0xf5,0x00,0x01,0x44,0xe4,0x41,0x6f,0x22,0x80,0xbb,0xbf,0xbb,
-0xdd,0x8b,0x68,0x00,0x00,0xd0,0x0b,0x10,0x8c,0x20,0x98,0x22,0x00,0x9b,0x4f,0xf2,
-0x28,0x09,0xae,0x96,0x03,0xdd,0x30,0x00,0x45,0xc4,0x22,0xc2,0x2d,0x20,0x09,0xce,
-0xb7,0xea,0x66,0x9e,0x40,0xb0,0xa6,0xa5,0x66,0x66,0x34,0x0c,0xbe,0xd5,0x66,0x66,
-0x66,0x00,0xb0,0xa6,0x5e,0x8b,0xa9,0xd0,0x0c,0xbe,0xc5,0xc2,0x87,0x4b,0x00,0x02,
-0xb0,0x0f,0xde,0xed,0xf0,0x2d,0xdf,0xd8,0x0d,0x00,0xa2,0x0c,0x28,0x74,0xb0,0x00,
-0x2b,0x00,0xc2,0x87,0x9b,0x8d,0x44,0x00,0xb2,0x03,0xf1,0x30,0x03,0xeb,0xbc,0xd0,
-0x38,0xae,0x88,0x3c,0x44,0x5d,0x00,0xbc,0xeb,0x80,0x33,0x33,0x30,0x0a,0x19,0x1b,
-0xdf,0xdd,0xdf,0x70,0xeb,0xeb,0xa2,0xc0,0x01,0xd0,0x0a,0x19,0x1a,0x2e,0xaa,0xbd,
-0x00,0xcc,0xeb,0x92,0xc2,0x23,0xd0,0x00,0x2b,0x00,0x2e,0xaa,0xad,0x07,0xde,0xfd,
-0xd3,0xc1,0x24,0xe3,0x00,0x2b,0x03,0xdc,0xba,0x9e,0x40,0x7a,0x40,0x16,0xd0,0xa3,
-0x00,0x11,0x08,0xa3,0x00,0xf0,0x1b,0x05,0xaa,0x50,0x00,0x46,0xc4,0x39,0x90,0x0a,
-0x91,0x09,0xce,0xb8,0xab,0xbb,0xb8,0x30,0xb1,0xa5,0x61,0x22,0x11,0x30,0x0c,0xbe,
-0xc6,0xd9,0xe4,0x4b,0x00,0xb1,0xa5,0x6c,0x4d,0x45,0xb0,0x0c,0xce,0xd6,0xc5,0xd4,
-0x5b,0xee,0x45,0x90,0x7d,0x45,0xb0,0x2c,0xdf,0xc8,0xc3,0xc4,0x5b,0x75,0x38,0x20,
-0x0b,0x00,0xa3,0x00,0x31,0xb4,0x90,0xab,0xa3,0x00,0xf0,0x13,0x1b,0x00,0x01,0x78,
-0xd7,0x5c,0xcc,0xfc,0xc3,0x15,0x6d,0x54,0x57,0x8d,0x77,0x00,0xbc,0xeb,0x6a,0x54,
-0xc3,0xd0,0x0b,0x0a,0x29,0xa9,0x8d,0x7e,0x00,0xeb,0xeb,0x99,0xaa,0xea,0x0d,0x00,
-0xf0,0x0e,0x33,0x5c,0x8a,0x00,0xcc,0xeb,0x88,0x87,0x7b,0x94,0x00,0x2b,0x01,0xaa,
-0xaa,0xea,0x46,0xde,0xfd,0xc3,0xa3,0x2d,0x21,0x00,0x2b,0x00,0x07,0x80,0xc0,0x96,
-0x00,0x16,0x04,0xa5,0x35,0x11,0x39,0x1c,0x05,0x30,0x59,0xb5,0x30,0xac,0x1c,0x21,
-0xea,0x96,0x38,0x70,0xf0,0x13,0x22,0x0b,0xee,0xfe,0xf0,0x04,0x97,0x60,0xb3,0x0d,
-0x0d,0x00,0xba,0xbb,0x4b,0x30,0xd0,0xd0,0x04,0x49,0x92,0xbc,0xbf,0xbf,0x00,0x00,
-0x77,0x2b,0x52,0xe2,0xe0,0x08,0xae,0xe7,0x1a,0x00,0x50,0x73,0x86,0x0b,0x30,0xd0,
-0x23,0x4a,0x20,0xbd,0xcf,0x91,0x31,0x26,0x0b,0x40,0x48,0x1c,0x21,0x31,0x00,0x51,
-0x8c,0xf1,0x13,0x10,0xeb,0xbb,0xf1,0x7d,0xfc,0xc2,0xe3,0x33,0xd1,0x05,0x84,0x00,
-0x66,0x66,0x60,0x0a,0x2e,0x08,0xec,0xcc,0xeb,0x2e,0x5e,0x50,0xc1,0x00,0xd0,0x28,
-0x7f,0x70,0xcb,0xbb,0xf0,0x8b,0x06,0xf1,0x05,0xd0,0x13,0x6f,0xc4,0xcb,0xbb,0xf0,
-0x6a,0x7e,0x10,0xc2,0x23,0xe6,0x00,0x0e,0x0c,0xdc,0xa9,0xe7,0x00,0x91,0x19,0x03,
-0x0f,0x07,0x00,0x4b,0x00,0x10,0x70,0xbd,0xb9,0xe1,0x1d,0x0c,0x60,0x00,0xb7,0x11,
-0x13,0xe1,0x36,0x00,0x01,0x67,0xcc,0xef,0xc0,0x0b,0xf0,0x11,0x0e,0xfa,0x00,0x01,
-0xde,0xb0,0x07,0x9d,0x99,0x00,0x00,0x3b,0x02,0xd1,0xd0,0xb6,0x00,0x03,0xb1,0xc3,
-0x1d,0x01,0xd2,0x00,0x3b,0x84,0x01,0xd0,0x03,0x10,0x08,0xd1,0x66,0x2a,0xd4,0x09,
-0xda,0xd7,0x21,0x01,0x12,0x20,0xb0,0x02,0x8b,0xcd,0xcc,0xb5,0x95,0x55,0x80,0x01,
-0xfc,0xcc,0xdd,0x00,0x02,0xe3,0x1e,0xae,0x01,0x30,0x03,0x11,0xfa,0x9b,0x7b,0x10,
-0x00,0x0d,0x00,0xf1,0x15,0x06,0xdf,0x21,0xfc,0xcc,0xca,0x10,0x00,0xb2,0x1e,0x07,
-0x41,0xc7,0x00,0x0b,0x21,0xe0,0x1c,0xe3,0x00,0x00,0xb2,0x2e,0x59,0x2a,0x90,0x00,
-0x0c,0x36,0xd8,0x30,0x0a,0x50,0x0a,0xbc,0x50,0x34,0x0f,0x59,0x07,0xdd,0xcd,0xde,
-0xf2,0x68,0x09,0x10,0x01,0x1b,0x31,0xf4,0x00,0xa5,0x00,0x1d,0x50,0x06,0xa0,0x3c,
-0x00,0x00,0x1d,0x5d,0xde,0xdf,0xed,0xa0,0x36,0x1a,0xf0,0x08,0x0a,0x20,0xc2,0x0b,
-0x20,0x6d,0xf1,0xb2,0x0c,0x20,0xc2,0x00,0x0d,0x1b,0x52,0xd4,0x2d,0x20,0x00,0xd1,
-0x8a,0xaf,0xaa,0x85,0x7a,0x20,0x05,0xb0,0x9c,0x07,0x01,0xd2,0x81,0x30,0x8d,0xca,
-0xa2,0x46,0x0c,0x59,0x02,0x9d,0xdc,0xdd,0xed,0xc6,0x0a,0xc0,0x01,0xb2,0x08,0xcc,
-0xcc,0xcf,0x70,0x03,0xd3,0x01,0x99,0x8a,0xd5,0x18,0xf0,0x04,0xbb,0xcf,0xfb,0xa0,
-0x00,0x00,0xb3,0x02,0xb0,0x0d,0x08,0xdf,0x2b,0xcb,0xce,0xbb,0xd0,0x00,0xc2,0x0d,
-0x00,0x28,0x00,0x0c,0x0d,0x00,0xb0,0x0e,0x4b,0x30,0x2b,0x5c,0xb0,0x0c,0x6b,0x70,
-0x00,0x00,0x3e,0x1e,0x44,0xcd,0xcc,0xde,0xf5,0x62,0x08,0x02,0xc6,0x04,0xf0,0x0f,
-0x5c,0x16,0xaa,0xbf,0xaa,0xa5,0x00,0x7a,0x12,0x23,0xe2,0x22,0x10,0x00,0x01,0xcc,
-0xcf,0xcc,0xb0,0x04,0x43,0x1d,0x01,0xd0,0x0e,0x01,0xcd,0xb1,0xd0,0x1d,0x07,0x36,
-0xf4,0x16,0x1c,0xce,0xfd,0xcb,0x00,0x03,0xb0,0x04,0xce,0xc5,0x00,0x00,0x3b,0x08,
-0xb2,0xd0,0xa9,0x00,0x05,0xc6,0x70,0x1d,0x00,0x60,0x05,0xb7,0xa3,0x00,0x20,0x00,
-0x10,0xd0,0x03,0xad,0xdc,0xde,0xf8,0x6a,0x16,0x11,0x10,0x0b,0x07,0x10,0x6c,0x05,
-0x4c,0x10,0x90,0x2e,0x32,0x01,0xc2,0x54,0xf1,0x11,0xbb,0xfb,0xbf,0x10,0x25,0x50,
-0xc1,0x0d,0x10,0xd1,0x05,0x9f,0x1c,0xa9,0xfa,0x9f,0x10,0x00,0xd1,0xc7,0x6e,0x76,
-0xe1,0x00,0x0d,0x13,0x33,0xe4,0x33,0x00,0x00,0xd7,0x0d,0x62,0x20,0x2e,0x20,0x5f,
-0x05,0xda,0x2d,0x5c,0x60,0x03,0x00,0x03,0x18,0x40,0x19,0xee,0xde,0xff,0xf1,0xba,
-0x67,0xf1,0x2e,0xd4,0x0c,0xdc,0xfe,0xcd,0x90,0x01,0xc2,0xc3,0x9c,0xb9,0x59,0x00,
-0x00,0x0c,0x12,0x97,0x24,0x90,0x00,0x00,0xd4,0xad,0xca,0x69,0x06,0xee,0x0d,0x02,
-0x22,0x25,0x90,0x12,0xe1,0xd0,0xda,0xac,0x49,0x00,0x0d,0x4b,0x0b,0x00,0xc4,0x90,
-0x00,0xd8,0x70,0x99,0x98,0x49,0x00,0x0e,0x91,0x00,0x00,0xad,0x60,0x0c,0xbc,0x81,
-0xd7,0x7e,0x53,0x06,0xcd,0xdd,0xde,0xf4,0x4f,0x00,0x50,0x26,0x00,0x03,0xa1,0x70,
-0x28,0x81,0x10,0xc6,0x46,0x39,0x90,0xc2,0x6f,0xdd,0xee,0xdd,0x00,0x00,0x4f,0xd0,
-0x3a,0x63,0x91,0x17,0x6f,0xcc,0xfc,0xc7,0x05,0xcf,0x01,0xd0,0x81,0x02,0xf3,0x0c,
-0x1f,0xbb,0xfb,0xb6,0x00,0x0d,0x01,0xd1,0x1e,0x11,0x00,0x00,0xd0,0x1e,0x22,0xe2,
-0x22,0x00,0x0d,0x11,0xfb,0xbb,0xbb,0xb2,0x09,0xaa,0x53,0x55,0x00,0x14,0xcd,0x55,
-0x00,0x00,0x4e,0x0d,0x20,0x00,0x28,0x40,0x84,0xf0,0x2d,0xe3,0x09,0xa5,0x51,0x05,
-0xd9,0xed,0xcd,0xd7,0x77,0x20,0x01,0x0a,0x20,0x39,0x77,0x70,0x35,0x50,0xad,0xd9,
-0x24,0xb8,0x04,0x8e,0x1b,0x13,0x90,0x2b,0x00,0x00,0xd1,0xc0,0x39,0xcd,0xec,0x50,
-0x0d,0x1c,0x04,0x80,0x2a,0x00,0x00,0xd7,0x70,0x77,0x02,0xa0,0x00,0x1e,0xb1,0xcd,
-0x25,0xd7,0x00,0x1d,0x8c,0x81,0x00,0xae,0x0f,0x08,0xaa,0x00,0xf1,0x0d,0x0b,0x24,
-0xdb,0xbb,0xbb,0xca,0x00,0x3d,0x5c,0xaa,0xfb,0xa9,0xa0,0x00,0x11,0x43,0x3e,0x43,
-0x43,0x00,0x00,0x0b,0x97,0xe8,0x7f,0x00,0x8e,0xf1,0x21,0x86,0xf0,0x06,0x0d,0x1b,
-0x42,0xe3,0x2e,0x00,0x00,0xd1,0x58,0x8e,0x88,0x80,0x00,0x0d,0x4b,0xbb,0xfb,0xbb,
-0x80,0x04,0xf7,0x88,0x01,0xd2,0x03,0xd2,0xaa,0x42,0x61,0x23,0x50,0x54,0x00,0x49,
-0xbc,0xcb,0xb9,0x14,0xa3,0x00,0x76,0x9a,0x30,0xdc,0xbb,0xcd,0x25,0x16,0x30,0xba,
-0x51,0xd0,0x75,0x02,0xf0,0x0d,0x38,0x1d,0x00,0x48,0x80,0x6e,0x89,0xc8,0xe6,0x03,
+0xe5,0x55,0x7b,0x00,0xfc,0xdb,0x0e,0x00,0x02,0xb0,0x0c,0x00,0x00,0xe0,0x09,0xb9,
+0x00,0x00,0x00,0x02,0x00,0x11,0x00,0x00,0x50,0x08,0x00,0xf1,0x18,0x00,0x0b,0x30,
+0x6c,0xe4,0xbb,0x10,0x26,0x88,0x56,0x4c,0x08,0x58,0x01,0x44,0x43,0x1e,0x82,0x4f,
+0x30,0x0b,0xcc,0x69,0x99,0x99,0x7d,0x20,0x00,0x00,0x75,0x55,0x55,0x50,0x0a,0xbb,
+0x60,0xd7,0x77,0xe0,0x12,0x01,0xf3,0x0d,0x0d,0x00,0x0d,0x78,0x90,0xac,0xcc,0xc0,
+0x00,0xc0,0x29,0x04,0x90,0x77,0x00,0x0e,0xcd,0x90,0x0c,0x0d,0x00,0x00,0xc0,0x00,
+0xbc,0xcc,0xdc,0xc1,0xa9,0x00,0xf5,0x43,0x0d,0x00,0x02,0xb0,0x3b,0x00,0x00,0x84,
+0x07,0x9e,0xad,0xc9,0x24,0xee,0xed,0x34,0xa5,0xc2,0x60,0x00,0x00,0x03,0x99,0x2c,
+0x2a,0x00,0xbc,0xc7,0x09,0x92,0xc6,0x30,0x02,0x22,0x1c,0xce,0xdf,0xcc,0x40,0xab,
+0xb6,0x22,0x22,0x22,0x20,0x03,0x44,0x20,0xfc,0xcc,0xd7,0x00,0xd8,0xa9,0x0e,0x00,
+0x07,0x70,0x0c,0x03,0x90,0xfa,0xaa,0xd7,0x00,0xd5,0x79,0x0e,0x11,0x17,0x70,0x0d,
+0x77,0x40,0xfa,0xaa,0xc7,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0xf5,0x3e,0x0a,0x26,
+0x60,0x0c,0x10,0x00,0x15,0xd5,0x77,0x45,0xea,0xbb,0x30,0x7c,0x99,0xb8,0xdd,0x1a,
+0x30,0x3e,0xa8,0x78,0x62,0x4d,0xa0,0x00,0x69,0x79,0xb2,0x5c,0xad,0x70,0x02,0x31,
+0x79,0x97,0x10,0x08,0x20,0xaa,0xaa,0xac,0xaa,0xaa,0xa0,0x00,0x38,0x88,0x88,0x88,
+0x60,0x00,0x03,0x88,0x88,0x88,0x86,0x00,0x00,0x49,0x99,0x99,0x99,0x80,0x00,0x08,
+0x60,0x00,0x00,0x1d,0x00,0x00,0x8b,0x99,0x99,0x99,0xd0,0x55,0x00,0xf9,0x3e,0x00,
+0x03,0x80,0x0b,0x10,0x00,0x83,0x06,0xbf,0xbc,0xeb,0x32,0xcc,0xca,0x02,0x29,0x52,
+0x20,0x01,0x22,0x10,0x77,0xb9,0x76,0x00,0x69,0x95,0xbb,0xbd,0xcb,0xb6,0x05,0x77,
+0x42,0x58,0x99,0x35,0x00,0x34,0x42,0x56,0xd0,0xc0,0xa3,0x08,0xbb,0x6b,0xbf,0xbe,
+0xcb,0x60,0xb0,0x48,0x00,0xd3,0x95,0x70,0x0b,0x03,0x9c,0xce,0x76,0xe4,0x00,0xcb,
+0xc8,0x00,0xd0,0xad,0x08,0x0b,0x00,0x04,0x9b,0x84,0x4a,0x50,0xb0,0x00,0xf3,0x3f,
+0x0b,0x10,0x00,0xe0,0x1a,0x00,0x00,0x67,0x0a,0xaf,0xab,0xea,0x36,0xcc,0xcc,0x09,
+0x56,0x53,0x00,0x00,0x00,0x03,0xfb,0xbe,0xa9,0x00,0xbc,0xc8,0xde,0x77,0xe7,0x40,
+0x00,0x00,0x05,0xd2,0x2d,0x21,0x00,0xab,0xb7,0x0e,0x88,0xe8,0x50,0x07,0x77,0x40,
+0xe9,0x9b,0x99,0x10,0xe4,0x6a,0x7c,0xbb,0xbb,0x60,0x0d,0x02,0xa0,0x2c,0x56,0xb1,
+0x00,0xfc,0xda,0x15,0x9f,0xf8,0x30,0x0d,0x00,0x0e,0xd8,0x11,0xaf,0x50,0x0d,0x02,
+0x10,0xa0,0x70,0x01,0xf4,0x39,0x00,0x08,0x80,0x7a,0xaf,0xba,0xa2,0x2b,0xbc,0xa2,
+0x99,0xba,0x98,0x00,0x11,0x11,0x79,0xa9,0xa9,0xa1,0x08,0xcc,0x79,0x2a,0x0a,0x0a,
+0x20,0x33,0x32,0x89,0xc8,0xc9,0xc1,0x06,0x88,0x52,0xa9,0x99,0x98,0x00,0x57,0x74,
+0x3c,0x77,0x78,0xc0,0x0b,0x57,0x93,0xc7,0x77,0x8c,0x00,0xb0,0x39,0x3c,0x87,0x88,
+0xc0,0x0b,0xcd,0x91,0x8a,0x06,0xb3,0x00,0xb1,0x02,0xe8,0x00,0x03,0xd4,0xaa,0x00,
+0xf4,0x3e,0x90,0x04,0x60,0x02,0x80,0x00,0x66,0x67,0x9c,0x92,0xb2,0x70,0x2f,0xa6,
+0x48,0x88,0x9c,0xc4,0x00,0x39,0x73,0x55,0x50,0x76,0x80,0x1e,0xbc,0x54,0x44,0x8f,
+0xac,0x10,0x64,0x57,0xa9,0xc4,0x24,0x70,0x27,0xa8,0x87,0x4b,0x92,0xa8,0x12,0x33,
+0x68,0x33,0x34,0x03,0x10,0x00,0x6f,0xcc,0xcc,0xdf,0xcb,0x01,0xc9,0x6a,0x30,0x5d,
+0x50,0x00,0x02,0x02,0x7f,0xfe,0x62,0x00,0x03,0xde,0xb7,0x30,0x48,0xbd,0xd2,0x55,
+0x00,0x30,0x03,0xb0,0x00,0xc0,0x01,0xf1,0x0f,0xed,0xcc,0xe6,0x00,0x00,0x02,0xd6,
+0x00,0x3d,0x10,0x00,0x03,0xef,0xcc,0xcd,0xdc,0xcd,0x00,0x02,0xd1,0x00,0x00,0x01,
+0xe0,0x00,0x0d,0xcb,0xbb,0xbb,0xce,0xba,0x04,0x0c,0x0d,0x00,0xf6,0x04,0x0a,0xcc,
+0xcc,0xcc,0xcb,0x00,0x00,0x4a,0xa0,0x01,0xb9,0x30,0x01,0xda,0x40,0x00,0x00,0x4b,
+0xa0,0x56,0x01,0x00,0x24,0x00,0x94,0xec,0xcf,0x10,0x0d,0x10,0x00,0x0e,0x00,0xc1,
+0x0d,0x00,0x23,0xdd,0xd2,0x0d,0x00,0x22,0xeb,0xbf,0x1a,0x00,0xf5,0x15,0xd1,0xcd,
+0xfe,0xdc,0x00,0xe0,0x0c,0x1e,0x11,0x13,0xd0,0x0b,0xcc,0xc1,0xe0,0x00,0x1d,0x00,
+0x68,0x49,0x0e,0x00,0x01,0xd0,0x1d,0x20,0xb4,0xeb,0xbb,0xbd,0x04,0x80,0x01,0x0e,
+0x22,0x23,0x04,0x02,0x02,0xb3,0x04,0xf4,0x38,0xcd,0xdd,0xd0,0x3a,0x00,0x00,0x0c,
+0x09,0x0d,0x08,0xed,0xdd,0x40,0xc0,0xd0,0xd0,0xc1,0x08,0x60,0x0c,0x0d,0x0d,0x6c,
+0x00,0xa2,0x00,0xc0,0xd0,0xdb,0xd2,0x0c,0x00,0x0c,0x0d,0x0d,0x06,0x81,0xc0,0x00,
+0xc0,0xc0,0xd0,0x0d,0x77,0x00,0x0a,0x39,0x0a,0x00,0x8e,0x10,0x00,0x0a,0x59,0x00,
+0x07,0xf2,0x00,0x04,0xc0,0x87,0x06,0xc4,0xd3,0x03,0xc1,0x00,0xa8,0xb1,0x03,0xd4,
+0xb6,0x03,0x20,0x09,0x40,0x06,0x00,0xa0,0x22,0xb6,0x21,0xbd,0xdd,0xd0,0x08,0xae,
+0xca,0x40,0x7a,0x02,0xf1,0x20,0xa4,0x00,0x00,0x01,0xd0,0x1c,0xce,0xec,0x99,0xdd,
+0xdd,0x00,0x11,0x68,0x00,0xb3,0x00,0x00,0x07,0x66,0xa4,0x3b,0x30,0x02,0x20,0x86,
+0x6c,0x85,0xb3,0x00,0x67,0x09,0xb6,0x80,0x08,0xdc,0xce,0x30,0xbc,0xb8,0x00,0x01,
+0x11,0x00,0x0d,0x2e,0xb2,0x45,0x01,0x63,0x18,0xde,0xee,0xee,0xe9,0x02,0xa7,0x00,
+0x11,0x0e,0x06,0x00,0xf0,0x2d,0x11,0xe1,0x18,0xdf,0xdd,0xf2,0x0c,0xcf,0xcb,0x00,
+0xe0,0x0d,0x10,0x00,0xe0,0x00,0x79,0x00,0xe0,0x3d,0xdf,0xdd,0xac,0x19,0xd9,0x00,
+0x00,0xc1,0x04,0x54,0x44,0x40,0x0a,0x2c,0x10,0x2e,0x99,0x9d,0x00,0xc2,0xcd,0xd4,
+0xb0,0x01,0xd0,0x0d,0x5c,0x10,0x2b,0x00,0x1d,0x00,0xdc,0xd1,0x02,0xcc,0xcc,0xb0,
+0x1b,0x6f,0xf1,0x05,0x74,0x06,0x60,0x4a,0xee,0xee,0xee,0xe7,0xab,0x02,0x51,0xdf,
+0xee,0xee,0xef,0xf0,0x56,0x06,0x21,0x0f,0x00,0x97,0x06,0x81,0xf0,0x00,0x0d,0xee,
+0xee,0xee,0xef,0x00,0x0b,0x00,0x00,0x84,0x00,0x10,0x0f,0x0b,0x00,0x90,0x7a,0x00,
+0xfe,0xee,0xe4,0x00,0x0a,0xe0,0x0f,0xd6,0x01,0x20,0xe9,0x90,0x1a,0x00,0xd3,0x98,
+0x0b,0xcf,0x10,0x00,0x00,0x3c,0x00,0x05,0xae,0xfe,0xee,0x30,0x00,0x04,0xa0,0xdd,
+0xf2,0xdf,0xff,0xff,0x10,0xd0,0x0b,0x2d,0x10,0x0d,0x04,0x10,0xb2,0x50,0x00,0xf0,
+0x0e,0xbd,0xfd,0x2d,0xed,0xde,0xb0,0x00,0x1b,0x00,0xd1,0x00,0x2b,0x00,0xd1,0xe9,
+0x5d,0x10,0x02,0xb0,0x0d,0x1c,0x11,0xde,0xee,0xeb,0x00,0xd1,0xb0,0x0d,0x27,0x00,
+0xf0,0x4b,0x1d,0x87,0xd1,0x00,0x00,0x02,0xee,0xc7,0x2d,0x43,0x33,0x31,0x36,0x10,
+0x00,0x9b,0xbb,0xbb,0x40,0x0d,0xdd,0xf5,0xfd,0xdd,0xdd,0x00,0xd0,0x0b,0x5c,0x00,
+0x00,0xd0,0x0d,0x00,0xb5,0xea,0xaa,0xad,0x00,0xbd,0xfd,0x4d,0x11,0x12,0xd0,0x02,
+0x1b,0x02,0xe7,0x77,0x8d,0x00,0xc1,0xfc,0x5d,0x2c,0x42,0x40,0x0c,0x1b,0x02,0xc0,
+0x68,0x6d,0x30,0xc1,0xb0,0x2c,0x00,0xea,0x00,0x0c,0x4e,0xc7,0xc0,0x06,0xd1,0x05,
+0xea,0x62,0x5e,0xbe,0x38,0xd4,0x00,0x00,0x05,0x83,0x00,0x04,0x85,0x01,0xf0,0x3c,
+0x04,0x20,0x00,0x00,0xdd,0xde,0x30,0xed,0xcc,0x50,0x0d,0x00,0x83,0x6a,0x11,0xd6,
+0x00,0xd0,0x08,0x6c,0xd3,0x5e,0x00,0x0b,0xdf,0xdb,0x33,0xce,0x40,0x00,0x10,0xe0,
+0x00,0x2e,0xd2,0x00,0x0c,0x0f,0x84,0x8b,0x22,0xb9,0x20,0xc0,0xe3,0x9e,0xdd,0xdd,
+0xe4,0x0c,0x0e,0x00,0xb2,0x00,0x2b,0x00,0xc0,0xe6,0x4b,0x20,0x02,0xb0,0x3e,0xed,
+0x92,0xb3,0x11,0x4b,0x03,0x51,0x00,0x0b,0xcb,0xbc,0xb0,0x83,0x01,0x10,0x0e,0x4e,
+0x00,0xf6,0x36,0x00,0xe0,0xe0,0x00,0x0c,0x00,0xda,0x1e,0x0e,0x0b,0x20,0xc0,0x0d,
+0x59,0xe0,0xe4,0xb0,0x0a,0xde,0xc0,0xbe,0x0e,0xb2,0x00,0x43,0x80,0x00,0xe0,0xe1,
+0x00,0x0b,0x3f,0xd0,0x6e,0x0e,0xd3,0x00,0xb3,0x81,0xbb,0xe0,0xe3,0xd3,0x0b,0x38,
+0x07,0x5b,0x0e,0x03,0x20,0xb4,0xb9,0x29,0x60,0xe0,0x12,0x4f,0xd9,0x44,0xe0,0x0e,
+0x04,0x81,0x20,0x02,0xd2,0x00,0xae,0xe4,0x7f,0x02,0xfb,0x3d,0x50,0x41,0x23,0x00,
+0xed,0xd9,0x2b,0x0b,0x26,0x50,0x0c,0x02,0x9b,0x30,0xe1,0x94,0x00,0xc0,0x2c,0x67,
+0x5b,0xac,0xc0,0x0c,0xee,0x81,0xcb,0x18,0x36,0x50,0x16,0x60,0x98,0x10,0x65,0x00,
+0x0b,0x6c,0x9d,0x82,0x86,0x50,0x00,0xb6,0x83,0x48,0x49,0x6e,0xd1,0x0b,0x66,0x03,
+0x85,0xa6,0x50,0x00,0xb7,0xb9,0x38,0x7e,0x75,0x00,0x4f,0xc8,0x33,0x8c,0x6e,0x60,
+0x01,0x10,0x00,0x3a,0x80,0x6c,0xd5,0x00,0x01,0x00,0x10,0x2d,0x05,0x00,0x50,0x1d,
+0xde,0xed,0xdd,0x10,0x5b,0x03,0x00,0xe0,0x01,0xc1,0x1f,0xbb,0xbb,0xbf,0x10,0x00,
+0x01,0xd0,0x00,0x00,0xd1,0x30,0x0d,0x00,0x11,0x7b,0x0d,0x00,0x80,0xdc,0x00,0x0c,
+0xdf,0xdd,0xdd,0xdf,0x10,0xf2,0x01,0xf7,0x06,0xc8,0xe1,0x00,0x00,0x00,0x19,0xc2,
+0x0d,0x10,0x00,0x04,0xad,0x60,0x00,0xe1,0x00,0x1e,0xa4,0x00,0x4e,0xeb,0x55,0x00,
+0x00,0xe5,0x03,0xf5,0x10,0x8c,0xcc,0xcf,0xcc,0xcc,0xc0,0x01,0x22,0x22,0xd4,0x22,
+0x22,0x00,0x09,0xcc,0xcf,0xdc,0xcd,0x20,0x00,0xb3,0x00,0xd2,0x00,0xc2,0x00,0x0b,
+0xdc,0xcf,0xcc,0xcf,0x0d,0x00,0x60,0xca,0xaf,0xba,0xaf,0x20,0x00,0xb0,0x08,0x82,
+0x10,0x01,0xdd,0xdd,0xdf,0xed,0xdd,0xd7,0x41,0x00,0x00,0x2d,0x02,0x10,0x20,0x32,
+0x06,0x00,0x03,0x00,0xf0,0x26,0x29,0x9e,0x99,0x00,0x0d,0x00,0x14,0x5e,0x44,0x13,
+0x3e,0x33,0x0b,0xbf,0xb9,0x8c,0xaf,0xaf,0x0b,0x0b,0x0c,0x86,0x0d,0x0d,0x0e,0xae,
+0xac,0x86,0x0d,0x0d,0x0b,0x0b,0x0c,0x8a,0x7e,0x7e,0x0c,0xbf,0xba,0x8a,0x6e,0x6e,
+0x13,0x3d,0x33,0x86,0x0d,0x0d,0x49,0x9e,0x99,0x96,0x0d,0x91,0x06,0x94,0x8e,0xdf,
+0xcf,0x00,0x0d,0x00,0x86,0x00,0x0c,0x9b,0x00,0xf1,0x23,0xd0,0x00,0x08,0x50,0x00,
+0x09,0x9e,0x98,0x11,0x4b,0x11,0x00,0x44,0xd4,0x3c,0xcc,0xcc,0xc5,0x09,0xcf,0xb7,
+0x08,0x40,0x91,0x00,0xc0,0xb2,0x92,0xd0,0x05,0xc0,0x0c,0xbe,0xca,0xd7,0x10,0x4a,
+0x70,0xc0,0xb2,0x93,0x77,0x2d,0x10,0x0c,0xbe,0xc9,0x00,0xd9,0x60,0x34,0x00,0x70,
+0xf0,0x00,0x2d,0xdf,0xdb,0x01,0xde,0x0d,0x00,0xba,0x04,0xd6,0x1d,0x91,0x00,0x0d,
+0x02,0xc3,0x00,0x09,0x70,0x4b,0x01,0xb0,0x0e,0x00,0x0e,0x29,0x00,0x05,0xcc,0xfc,
+0xc3,0xe1,0x8a,0x0d,0x00,0xf3,0x2f,0x0d,0x10,0x60,0x0c,0xcc,0xec,0xcc,0xfc,0xcc,
+0x60,0x11,0x1e,0x11,0x1b,0x30,0x20,0x07,0xaa,0xfa,0xa7,0xa4,0x4b,0x00,0x39,0x8e,
+0x89,0x38,0x6b,0x50,0x05,0xb8,0xe8,0xb4,0x5b,0xe0,0x00,0x59,0x4d,0x49,0x42,0xf5,
+0x00,0x01,0x44,0xe4,0x41,0x6f,0x22,0x80,0xbb,0xbf,0xbb,0xdd,0x8b,0x68,0x00,0x00,
+0xd0,0x0b,0x10,0x8c,0x20,0x54,0x00,0xf2,0x2e,0x02,0xb0,0x00,0x07,0x80,0x00,0x09,
+0xae,0x96,0x03,0xdd,0x30,0x00,0x45,0xc4,0x22,0xc2,0x2d,0x20,0x09,0xce,0xb7,0xea,
+0x66,0x9e,0x40,0xb0,0xa6,0xa5,0x66,0x66,0x34,0x0c,0xbe,0xd5,0x66,0x66,0x66,0x00,
+0xb0,0xa6,0x5e,0x8b,0xa9,0xd0,0x0c,0xbe,0xc5,0xc2,0x87,0x4b,0x00,0x02,0xb0,0x0f,
+0xde,0xed,0xf0,0x2d,0xdf,0xd8,0x0d,0x00,0xd3,0x0c,0x28,0x74,0xb0,0x00,0x2b,0x00,
+0xc2,0x87,0x9b,0x00,0x00,0x2b,0x7b,0x05,0xf0,0x32,0x03,0xeb,0xbc,0xd0,0x38,0xae,
+0x88,0x3c,0x44,0x5d,0x00,0xbc,0xeb,0x80,0x33,0x33,0x30,0x0a,0x19,0x1b,0xdf,0xdd,
+0xdf,0x70,0xeb,0xeb,0xa2,0xc0,0x01,0xd0,0x0a,0x19,0x1a,0x2e,0xaa,0xbd,0x00,0xcc,
+0xeb,0x92,0xc2,0x23,0xd0,0x00,0x2b,0x00,0x2e,0xaa,0xad,0x07,0xde,0xfd,0xd3,0xc1,
+0x24,0xe3,0x00,0x2b,0x03,0xdc,0xba,0x9e,0x40,0x02,0xb0,0xaa,0x04,0x06,0xa3,0x00,
+0x11,0x08,0xa3,0x00,0xf0,0x2e,0x05,0xaa,0x50,0x00,0x46,0xc4,0x39,0x90,0x0a,0x91,
+0x09,0xce,0xb8,0xab,0xbb,0xb8,0x30,0xb1,0xa5,0x61,0x22,0x11,0x30,0x0c,0xbe,0xc6,
+0xd9,0xe4,0x4b,0x00,0xb1,0xa5,0x6c,0x4d,0x45,0xb0,0x0c,0xce,0xd6,0xc5,0xd4,0x5b,
+0x00,0x03,0xb0,0x0d,0x7d,0x45,0xb0,0x2c,0xdf,0xc8,0xc3,0xc4,0x5b,0x00,0x02,0xb0,
+0x0b,0x0b,0x00,0xa3,0x00,0x31,0xb4,0x90,0xab,0xa3,0x00,0xf0,0x13,0x1b,0x00,0x01,
+0x78,0xd7,0x5c,0xcc,0xfc,0xc3,0x15,0x6d,0x54,0x57,0x8d,0x77,0x00,0xbc,0xeb,0x6a,
+0x54,0xc3,0xd0,0x0b,0x0a,0x29,0xa9,0x8d,0x7e,0x00,0xeb,0xeb,0x99,0xaa,0xea,0x0d,
+0x00,0xf0,0x0e,0x33,0x5c,0x8a,0x00,0xcc,0xeb,0x88,0x87,0x7b,0x94,0x00,0x2b,0x01,
+0xaa,0xaa,0xea,0x46,0xde,0xfd,0xc3,0xa3,0x2d,0x21,0x00,0x2b,0x00,0x07,0x80,0xc0,
+0x96,0x00,0x25,0x04,0xcb,0x9b,0x01,0x11,0x39,0x1c,0x05,0x20,0x59,0xb5,0x99,0x0b,
+0x30,0x09,0xea,0x96,0x0d,0x00,0xf0,0x14,0x0d,0x22,0x0b,0xee,0xfe,0xf0,0x04,0x97,
+0x60,0xb3,0x0d,0x0d,0x00,0xba,0xbb,0x4b,0x30,0xd0,0xd0,0x04,0x49,0x92,0xbc,0xbf,
+0xbf,0x00,0x00,0x77,0x2b,0x52,0xe2,0xe0,0x08,0xae,0xe7,0x1a,0x00,0xf5,0x03,0x73,
+0x86,0x0b,0x30,0xd0,0xd0,0x00,0x07,0x60,0xbd,0xcf,0xcf,0x00,0x00,0x76,0x0b,0x40,
+0x00,0x18,0x06,0x11,0x31,0xc1,0x06,0xf1,0x14,0xd3,0x10,0xeb,0xbb,0xf1,0x7d,0xfc,
+0xc2,0xe3,0x33,0xd1,0x05,0x84,0x00,0x66,0x66,0x60,0x0a,0x2e,0x08,0xec,0xcc,0xeb,
+0x2e,0x5e,0x50,0xc1,0x00,0xd0,0x28,0x7f,0x70,0xcb,0xbb,0xf0,0x8b,0x06,0xf1,0x04,
+0xd0,0x13,0x6f,0xc4,0xcb,0xbb,0xf0,0x6a,0x7e,0x10,0xc2,0x23,0xe6,0x00,0x0e,0x0c,
+0xdc,0xa9,0xe7,0xb0,0x05,0x13,0xd0,0x0f,0x07,0x00,0x4b,0x00,0xf1,0x04,0x70,0x00,
+0x7b,0x00,0x00,0x1d,0x0c,0x60,0x00,0xb7,0x11,0x13,0xe1,0x36,0x00,0x01,0x67,0xcc,
+0xef,0xc0,0x0b,0xf3,0x22,0x0e,0xfa,0x00,0x01,0xde,0xb0,0x07,0x9d,0x99,0x00,0x00,
+0x3b,0x02,0xd1,0xd0,0xb6,0x00,0x03,0xb1,0xc3,0x1d,0x01,0xd2,0x00,0x3b,0x84,0x01,
+0xd0,0x03,0x10,0x08,0xd1,0x00,0x1b,0x00,0x00,0x09,0xda,0xd7,0x21,0x01,0x12,0x20,
+0xb0,0x02,0x8b,0xcd,0xcc,0xb5,0xa2,0x00,0x90,0xc3,0x01,0xfc,0xcc,0xdd,0x00,0x02,
+0xe3,0x1e,0xae,0x01,0x80,0x03,0x11,0xfa,0xaa,0xbd,0x00,0x00,0x00,0x0d,0x00,0xf1,
+0x14,0x06,0xdf,0x21,0xfc,0xcc,0xca,0x10,0x00,0xb2,0x1e,0x07,0x41,0xc7,0x00,0x0b,
+0x21,0xe0,0x1c,0xe3,0x00,0x00,0xb2,0x2e,0x59,0x2a,0x90,0x00,0x0c,0x36,0xd8,0x30,
+0x0a,0x50,0x0a,0xbc,0x0a,0x06,0x69,0x80,0x07,0xdd,0xcd,0xde,0xf2,0x68,0x09,0xf1,
+0x05,0x01,0x40,0x00,0xd1,0x00,0xa5,0x00,0x1d,0x50,0x06,0xa0,0x3c,0x00,0x00,0x1d,
+0x5d,0xde,0xdf,0xed,0xa0,0x79,0x0c,0x00,0x2e,0x09,0xf0,0x0d,0x20,0xc2,0x0b,0x20,
+0x6d,0xf1,0xb2,0x0c,0x20,0xc2,0x00,0x0d,0x1b,0x52,0xd4,0x2d,0x20,0x00,0xd1,0x8a,
+0xaf,0xaa,0xa1,0x00,0x0d,0x10,0x05,0xb0,0x9c,0x07,0x10,0x05,0xd9,0x03,0x30,0x8d,
+0xca,0xa2,0x46,0x0c,0x59,0x02,0x9d,0xdc,0xdd,0xed,0xc6,0x0a,0xf0,0x14,0x01,0xb2,
+0x08,0xcc,0xcc,0xcf,0x70,0x03,0xd3,0x01,0x99,0x8a,0x40,0x00,0x01,0x08,0xbb,0xcf,
+0xfb,0xa0,0x00,0x00,0xb3,0x02,0xb0,0x0d,0x08,0xdf,0x2b,0xcb,0xce,0xbb,0xd0,0x00,
+0xc2,0x0d,0x00,0x28,0x00,0x0c,0x0d,0x00,0x80,0x0e,0x4b,0x30,0x2b,0x5c,0xb0,0x0c,
+0x6b,0x8d,0x03,0x74,0x07,0x60,0x06,0xcd,0xcc,0xde,0xf5,0x62,0x08,0x02,0xc6,0x04,
+0xf3,0x38,0x5c,0x16,0xaa,0xbf,0xaa,0xa5,0x00,0x7a,0x12,0x23,0xe2,0x22,0x10,0x00,
+0x01,0xcc,0xcf,0xcc,0xb0,0x04,0x43,0x1d,0x01,0xd0,0x0e,0x01,0xcd,0xb1,0xd0,0x1d,
+0x00,0xe0,0x00,0x3b,0x1c,0xce,0xfd,0xcb,0x00,0x03,0xb0,0x04,0xce,0xc5,0x00,0x00,
+0x3b,0x08,0xb2,0xd0,0xa9,0x00,0x05,0xc6,0x70,0x1d,0x00,0x60,0x05,0xb7,0xa3,0x00,
+0x20,0x00,0x10,0xd0,0x03,0xad,0xdc,0xde,0xf8,0x55,0x00,0x21,0x09,0x10,0x0b,0x07,
+0x82,0x6c,0x4c,0xcc,0xfd,0xcc,0x90,0x00,0xa4,0xa4,0x04,0xf0,0x19,0x0c,0xbb,0xfb,
+0xbf,0x10,0x25,0x50,0xc1,0x0d,0x10,0xd1,0x05,0x9f,0x1c,0xa9,0xfa,0x9f,0x10,0x00,
+0xd1,0xc7,0x6e,0x76,0xe1,0x00,0x0d,0x13,0x33,0xe4,0x33,0x00,0x00,0xd7,0xdd,0xdf,
+0xdd,0xdc,0x00,0x2e,0x20,0x5f,0x05,0xd9,0x2d,0x5c,0x60,0x03,0x00,0x03,0x18,0x40,
+0x19,0xee,0xde,0xff,0xf1,0x40,0x04,0xf0,0x2f,0x01,0xd4,0x0c,0xdc,0xfe,0xcd,0x90,
+0x01,0xc2,0xc3,0x9c,0xb9,0x59,0x00,0x00,0x0c,0x12,0x97,0x24,0x90,0x00,0x00,0xd4,
+0xad,0xca,0x69,0x06,0xee,0x0d,0x02,0x22,0x25,0x90,0x12,0xe1,0xd0,0xda,0xac,0x49,
+0x00,0x0d,0x4b,0x0b,0x00,0xc4,0x90,0x00,0xd8,0x70,0x99,0x98,0x49,0x00,0x0e,0x91,
+0x00,0x00,0xad,0x60,0x0c,0xbc,0x81,0xaf,0x01,0x63,0xa0,0x06,0xcd,0xdd,0xde,0xf4,
+0x4f,0x00,0xf1,0x15,0x26,0x00,0x03,0xa1,0x70,0x00,0x00,0xb8,0x00,0xc6,0x0d,0x30,
+0x00,0x00,0xc2,0x6f,0xdd,0xee,0xdd,0x00,0x00,0x4f,0xd0,0x0e,0x00,0x00,0x01,0x17,
+0x6f,0xcc,0xfc,0xc7,0x05,0xcf,0x01,0xd0,0x81,0x02,0xf3,0x0c,0x1f,0xbb,0xfb,0xb6,
+0x00,0x0d,0x01,0xd1,0x1e,0x11,0x00,0x00,0xd0,0x1e,0x22,0xe2,0x22,0x00,0x0d,0x11,
+0xfb,0xbb,0xbb,0xb2,0x09,0xaa,0x53,0x55,0x00,0xa0,0xcd,0xde,0xf4,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0xf2,0x40,0x00,0x00,0x27,0x00,0x28,0x00,0x02,0xb1,0x00,0xe3,
+0x09,0xa5,0x51,0x05,0xd9,0xed,0xcd,0xd7,0x77,0x20,0x01,0x0a,0x20,0x39,0x77,0x70,
+0x35,0x50,0xad,0xd9,0x24,0xb8,0x04,0x8e,0x1b,0x13,0x90,0x2b,0x00,0x00,0xd1,0xc0,
+0x39,0xcd,0xec,0x50,0x0d,0x1c,0x04,0x80,0x2a,0x00,0x00,0xd7,0x70,0x77,0x02,0xa0,
+0x00,0x1e,0xb1,0xcd,0x25,0xd7,0x00,0x1d,0x8c,0x81,0x00,0x00,0x00,0x07,0x80,0x06,
+0xcd,0xdd,0xde,0xf4,0x00,0x01,0x00,0xf2,0x3a,0x0b,0x24,0xdb,0xbb,0xbb,0xca,0x00,
+0x3d,0x5c,0xaa,0xfb,0xa9,0xa0,0x00,0x11,0x43,0x3e,0x43,0x43,0x00,0x00,0x0b,0x97,
+0xe8,0x7f,0x00,0x8e,0xf1,0xbb,0xaf,0xaa,0xf0,0x00,0x0d,0x1b,0x42,0xe3,0x2e,0x00,
+0x00,0xd1,0x58,0x8e,0x88,0x80,0x00,0x0d,0x4b,0xbb,0xfb,0xbb,0x80,0x04,0xf7,0x00,
+0x0d,0x10,0x00,0x03,0xd2,0xaa,0x42,0x61,0x23,0x50,0x54,0x00,0x49,0xbc,0xcb,0xb9,
+0x00,0x02,0x4f,0x00,0xf0,0x1d,0x9a,0x00,0xdc,0xbb,0xcd,0x00,0x00,0x75,0x0d,0xba,
+0x51,0xd0,0x00,0x00,0x00,0xd1,0x38,0x1d,0x00,0x48,0x80,0x6e,0x89,0xc8,0xe6,0x03,
 0x5e,0x1d,0x44,0x44,0x45,0xd0,0x00,0xd1,0xd0,0xaa,0xaa,0x0d,0x00,0x0d,0x1d,0x0b,
-0x00,0xc0,0x0d,0x00,0xc0,0xc9,0x99,0x0d,0x00,0x2e,0x2d,0x05,0x00,0x4c,0xa0,0x2c,
-0x3b,0x69,0xa2,0x64,0x29,0x40,0x07,0xde,0xde,0xef,0x97,0x7a,0x00,0xfd,0x80,0xb0,
-0x05,0x30,0x01,0xd3,0x00,0x1c,0x01,0xd1,0x00,0x03,0xd2,0x1c,0xaa,0xf0,0x02,0x00,
-0x02,0x00,0x33,0xd5,0x33,0x00,0x35,0x51,0x0f,0x66,0x66,0xf0,0x03,0x6d,0x30,0xfa,
-0x1e,0x8c,0x20,0xb3,0x0e,0x0f,0x09,0x18,0x0b,0x0d,0x00,0x80,0x0c,0x40,0xcb,0xbb,
-0xbc,0x00,0x0b,0x8b,0x55,0x00,0x66,0x06,0x70,0x07,0xdd,0xcd,0xdf,0xf1,0x01,0x00,
-0xec,0x3a,0xd0,0x01,0xd6,0x01,0x7c,0xaa,0xcd,0x00,0x01,0xc5,0xb5,0x27,0x3d,0x20,
-0x69,0x42,0xd0,0xbc,0x30,0x00,0x12,0x21,0x8c,0xe6,0x11,0x10,0x05,0xcf,0x15,0xda,
-0x20,0x76,0xf1,0x0d,0xd1,0x49,0x28,0x92,0x22,0x00,0x0d,0x2b,0xd9,0xcc,0x9d,0xb0,
-0x00,0xd1,0x58,0x06,0x70,0x95,0x00,0x0e,0x35,0xec,0xee,0xce,0x50,0x1d,0xbe,0x71,
-0x47,0x01,0x4b,0x18,0xde,0xdd,0xde,0x46,0x02,0xf0,0x04,0xc2,0x0d,0xaa,0xaa,0xaa,
-0xe0,0x03,0xd2,0xda,0xba,0xaa,0xad,0x00,0x01,0x0d,0x3b,0x1c,0x09,0x70,0x34,0x5f,
-0xfa,0x21,0xd5,0x70,0x05,0xcc,0x0d,0x89,0x38,0x29,0xb0,0x12,0xe1,0xd1,0xd3,0xe2,
-0x23,0x00,0x0d,0x3a,0x9a,0x8f,0x88,0x60,0x00,0xd8,0x8c,0x88,0xf8,0x88,0x20,0x0d,
-0xa1,0x33,0x3e,0x33,0x30,0x08,0xdc,0x50,0x00,0x90,0x00,0x06,0xb0,0x07,0xcd,0xdc,
-0xde,0xe5,0x55,0x00,0xfa,0x31,0xd3,0x0e,0xab,0x6d,0xaa,0xc0,0x02,0xd2,0xea,0xb5,
-0xda,0xaa,0x00,0x00,0x0d,0x55,0x8c,0x54,0x91,0x00,0x00,0x24,0xc1,0x3b,0x43,0x06,
-0xee,0x05,0x5e,0x57,0xd5,0x40,0x00,0xd0,0x45,0xe5,0x6d,0x53,0x00,0x0d,0x5a,0xaf,
-0xab,0xea,0xa2,0x00,0xd1,0x14,0xb2,0x5b,0x31,0x00,0x0e,0x37,0xd3,0x00,0x4d,0x60,
-0x0b,0xbc,0xa1,0x00,0x00,0x13,0x9b,0x02,0x10,0x06,0x2c,0x56,0x70,0x00,0x00,0x6c,
-0x00,0xe7,0x77,0x7e,0xd9,0x36,0x10,0x77,0xf5,0x1a,0x01,0x0d,0x00,0xf9,0x25,0x47,
-0x70,0x08,0x7d,0xa7,0x70,0x03,0x6e,0x3d,0x8a,0x9a,0xa8,0xd0,0x00,0xd2,0x6a,0x76,
-0x39,0x55,0x00,0x0d,0x3a,0xbb,0xcb,0xaa,0x90,0x00,0xd1,0x00,0xda,0x99,0x60,0x00,
-0x2e,0x24,0xc5,0x00,0x77,0x00,0x2d,0x6e,0xd3,0x00,0x88,0x12,0x18,0x50,0x29,0xee,
-0xde,0xef,0xf4,0xc6,0x17,0xd0,0x00,0xa6,0x0e,0xae,0xbc,0xda,0xe0,0x00,0xd3,0xda,
-0xdb,0xbc,0xad,0x77,0x01,0xf6,0x28,0x0a,0x57,0x00,0x37,0x72,0xc4,0xb2,0xf8,0xe8,
-0x22,0x6e,0x59,0xe6,0xcc,0x2c,0x20,0x00,0xd1,0xb7,0xb5,0xea,0xea,0x10,0x0d,0x5a,
-0x67,0x4d,0x5d,0x50,0x00,0xd3,0x99,0x91,0xd4,0xc4,0x00,0x1e,0x85,0xa4,0x4e,0xad,
-0xa4,0x1d,0x6c,0x71,0x00,0x40,0x01,0x17,0x70,0x07,0xde,0xee,0xef,0xf6,0xfd,0x01,
-0x01,0x53,0x0b,0xf2,0x0e,0x4d,0x11,0x0a,0xed,0xf3,0x08,0xcb,0xbc,0xc4,0xa2,0x1e,
-0x00,0x0b,0x30,0x79,0x0a,0x27,0x70,0x00,0x59,0x0d,0x20,0xa2,0xd1,0x01,0xde,0xee,
-0xfd,0x9a,0xda,0x52,0x90,0xa2,0x2c,0x00,0x4d,0xdd,0xdd,0x0a,0x20,0xc1,0xbb,0x18,
-0xe0,0xa2,0x0d,0x20,0x59,0x00,0x0e,0x0a,0x7d,0xa0,0x05,0xec,0xcc,0xf0,0xa2,0x6e,
-0x17,0x35,0x0d,0x0a,0x20,0x32,0x3d,0x80,0xee,0xfd,0x9a,0xee,0xee,0x10,0x03,0x7a,
-0x72,0x38,0xf0,0x10,0x0b,0xde,0xee,0x60,0x00,0x0d,0x10,0xb1,0x78,0x66,0x23,0x33,
-0xe1,0x0b,0x35,0x86,0x6a,0xca,0xaf,0x10,0xb9,0x19,0xb6,0xa4,0x00,0xd1,0x0b,0x20,
-0x06,0x6a,0x40,0x0e,0x7a,0x20,0xd6,0xa4,0x54,0x5f,0xf0,0x01,0x06,0x6a,0x40,0x06,
-0x70,0xbc,0xcc,0xd6,0x95,0x00,0x86,0x0b,0x00,0x06,0x65,0xde,0xd4,0x84,0x10,0x41,
-0x4f,0x00,0xf0,0x0e,0xab,0xe8,0x2e,0xbe,0xdc,0xf0,0x06,0x1c,0x37,0xd0,0xb6,0x4d,
-0x00,0x94,0xc8,0x48,0x8a,0xc8,0x80,0x05,0x5c,0x71,0x5a,0xcd,0xa6,0x02,0xee,0xfe,
-0xa0,0xb3,0x3f,0xf1,0x0f,0x9d,0x04,0xae,0xaa,0xeb,0x40,0x1c,0xeb,0x20,0xa3,0x0a,
-0x00,0x0a,0x5c,0x24,0x99,0xac,0x99,0x12,0xb1,0xc0,0x08,0xab,0xda,0x90,0x01,0x1c,
-0x00,0x00,0x49,0x79,0x33,0x27,0x03,0x80,0xee,0x01,0xb0,0x12,0x46,0x50,0x00,0x1c,
-0xcc,0xcf,0xa8,0x64,0x00,0x2c,0x51,0x31,0x23,0xcc,0x20,0x49,0x25,0x11,0xe8,0xac,
-0x24,0x82,0x0e,0x98,0x8f,0x88,0x8f,0x00,0x00,0xe2,0x1b,0x8f,0x44,0xba,0xbf,0xaa,
-0xaf,0x7c,0x54,0x10,0x3c,0xf3,0x09,0x12,0x60,0x0d,0x00,0x11,0x03,0xfd,0x55,0x31,
-0xc3,0x00,0x7c,0x20,0x7b,0xd1,0x07,0xc8,0x88,0x88,0x9d,0x00,0x00,0x59,0x88,0x88,
-0x88,0x90,0x00,0x6d,0x21,0x11,0xb5,0x1e,0x3a,0xf1,0x0a,0x61,0x00,0x0b,0x63,0x3d,
-0x53,0x3c,0x30,0x00,0xba,0x99,0xea,0x99,0xe3,0x00,0x07,0x87,0x7e,0x87,0x7a,0x20,
-0x00,0xaa,0xaa,0xeb,0xee,0x45,0x00,0x4c,0x31,0x10,0x1b,0x26,0x32,0x15,0xbb,0xb7,
-0x40,0x11,0xc5,0xa6,0x0a,0x20,0x8b,0xd6,0x84,0x15,0x91,0x9c,0x01,0xb5,0x01,0xe0,
-0x00,0x1c,0xdc,0xc9,0x91,0x15,0xf0,0x06,0xb2,0x09,0xbb,0xfb,0xb6,0x01,0x1b,0x41,
-0x78,0x9f,0x88,0x40,0xbb,0xec,0xb1,0x01,0xe0,0x00,0x04,0x1b,0x28,0x1a,0x00,0x90,
-0x56,0xb5,0x90,0x01,0xe0,0x00,0x01,0x7b,0x64,0x0d,0x00,0x30,0x58,0xed,0xa1,0xc5,
-0x15,0x12,0x41,0xc5,0x15,0x12,0x18,0xe4,0x0f,0xf0,0x34,0xe5,0x0a,0xef,0xee,0xc0,
-0x0a,0x91,0x99,0x00,0xe0,0x3b,0x03,0xdd,0xcc,0x00,0x2c,0x04,0xa0,0x00,0x2a,0x00,
-0x03,0xa0,0x59,0x00,0x13,0xb1,0x08,0xcd,0xac,0x80,0x0b,0xce,0xb4,0x4a,0xa6,0xb7,
-0x00,0x62,0xa6,0x20,0x95,0x09,0x50,0x09,0x3a,0xb0,0x0b,0x20,0xa4,0x00,0x44,0xb8,
-0x20,0xe0,0x0c,0x20,0x1a,0xdb,0x8a,0xcf,0xcc,0xfd,0x90,0x30,0x00,0x01,0xd6,0x92,
-0x30,0x48,0x00,0x0a,0xdd,0x01,0xf0,0x02,0xd5,0x03,0xec,0xce,0x20,0x1c,0x50,0xa5,
-0x84,0x00,0xd0,0x05,0xdc,0xca,0x0a,0xcc,0xdb,0x9b,0x63,0x00,0xd9,0x2e,0xf8,0x1c,
-0x15,0x91,0x9f,0xff,0xff,0xf4,0x2b,0xdd,0xb3,0x60,0xc4,0x17,0x00,0x54,0x87,0x09,
-0x4c,0xbb,0x50,0x0a,0x48,0xb0,0x05,0xe8,0x70,0x00,0x75,0x96,0x2a,0x9d,0x0c,0x40,
-0x17,0xbe,0xb7,0x30,0xc0,0x1c,0x21,0x62,0x00,0x03,0xdc,0xa4,0x97,0xf0,0x11,0x84,
-0x0d,0x00,0x00,0xcb,0xa0,0x4b,0x85,0xe5,0x00,0xb7,0x06,0xa6,0xca,0x7e,0x71,0x3d,
-0xdc,0xc1,0x08,0x40,0xd0,0x00,0x02,0xa0,0x2d,0xee,0xdf,0xd6,0x07,0x8d,0x73,0xc8,
-0x5c,0xf6,0x15,0x57,0xc6,0x22,0xdd,0xdd,0x90,0x09,0x2a,0x82,0x2a,0x00,0x2b,0x00,
-0x94,0xab,0x02,0xec,0xcc,0xb0,0x04,0x4a,0x41,0x2a,0x00,0x3b,0x00,0x49,0xfe,0x52,
-0xb2,0x25,0xb0,0x19,0x62,0x00,0x2e,0x0b,0x17,0x20,0x08,0x40,0x26,0x10,0xf0,0x28,
-0x01,0xdb,0x2d,0xe6,0xbf,0xb8,0x00,0xc3,0x29,0x19,0x23,0xd3,0xc1,0x3d,0xcc,0x57,
-0x36,0x7e,0x7d,0x20,0x07,0x50,0xc6,0x58,0xe8,0xb0,0x08,0xba,0x76,0xc3,0x3d,0x32,
-0x00,0x59,0x84,0x2b,0x7c,0xfc,0xb0,0x09,0x65,0xaa,0xc0,0x0c,0x00,0x00,0xa7,0x86,
-0x9a,0xac,0xfc,0xc1,0x05,0x88,0x57,0x25,0x12,0xdb,0x8d,0xd7,0xc6,0xa2,0x50,0x00,
-0x08,0x30,0x75,0x04,0xac,0xcc,0x40,0x0e,0x9c,0xf0,0x0c,0x04,0x0c,0x00,0x60,0x00,
-0xcc,0xa0,0xc0,0xc0,0x7b,0x00,0xb7,0x06,0xb6,0x5c,0x1e,0x20,0x5c,0xbb,0xb4,0xbc,
-0xfc,0xcb,0x00,0x02,0xd2,0x0c,0x59,0x77,0x90,0x5d,0x53,0xeb,0xbb,0xbe,0x00,0x89,
-0xe8,0x5c,0x5e,0x26,0x20,0x0c,0x45,0x0d,0x00,0xf4,0x0a,0xa2,0xc8,0x3d,0x11,0x11,
-0xe0,0x07,0x4c,0x80,0x9b,0xab,0xb9,0x00,0x37,0xfc,0x73,0xc1,0x3c,0x20,0x1a,0x63,
-0x06,0xc2,0x00,0x2c,0xd5,0x10,0x11,0x2b,0xd1,0x95,0xf1,0x06,0x0c,0xd9,0x2c,0xcd,
-0xcc,0xc4,0x0b,0x70,0x7a,0x0c,0x02,0xc0,0x04,0xdd,0xed,0x9c,0xed,0xde,0xc7,0x00,
-0x0c,0xfb,0xa7,0xfd,0x1e,0xab,0xea,0x6c,0x55,0x55,0xf0,0x02,0x3d,0x31,0xcb,0xbb,
-0xbf,0x00,0xa1,0xc5,0x6c,0x00,0x00,0xf0,0x09,0x3c,0x92,0x8e,0xbe,0xba,0x00,0x44,
-0xc4,0x10,0xc1,0xb2,0x00,0x05,0x8f,0xd9,0x6b,0x0b,0x31,0xa0,0x95,0x21,0xda,0x10,
-0x7d,0xd6,0x70,0x30,0x10,0x0d,0xbe,0x93,0xf0,0x2c,0x45,0xcc,0xfd,0xcc,0x21,0xd3,
-0x1b,0x24,0x70,0x2d,0x00,0x5c,0xcc,0x88,0xbe,0xbd,0xdb,0x50,0x06,0x50,0x15,0x55,
-0x55,0x40,0x17,0xaa,0x71,0xd6,0xe7,0x6d,0x01,0x7a,0xa7,0x1e,0x9e,0xa9,0xd0,0x08,
-0x65,0xa1,0xb1,0xc2,0x1d,0x00,0xa6,0x78,0x18,0x8e,0x98,0x70,0x06,0x67,0x53,0xbb,
-0xfb,0xbb,0x00,0x5c,0xfd,0x88,0x06,0x30,0x3a,0x61,0x09,0xb1,0x30,0x21,0x00,0x21,
-0x96,0xba,0xf1,0x3b,0x0c,0x80,0xdc,0xe8,0x2b,0x00,0x08,0x67,0xbd,0xae,0x58,0xdb,
-0x53,0xe9,0x96,0xc0,0x09,0xd4,0x00,0x02,0xa6,0x1d,0xad,0xd7,0x95,0x00,0x5b,0x84,
-0xc2,0xc3,0x01,0xd0,0x07,0xb9,0x67,0x88,0x70,0x01,0x00,0x78,0x48,0x5c,0xcc,0xcc,
-0xc0,0x0a,0x87,0x56,0x57,0x1a,0x0d,0x00,0x88,0x81,0x65,0x71,0xa0,0xd0,0x03,0xbd,
-0xa6,0x57,0x1a,0x0d,0x01,0xb7,0x26,0xee,0xed,0xfd,0xf8,0x00,0x0d,0xdc,0xe5,0x44,
-0x40,0xda,0xaa,0xaa,0xa6,0xe8,0x7a,0x00,0xf3,0x5b,0x00,0xe5,0x44,0x13,0xc7,0xf1,
-0x15,0x10,0x01,0xed,0x7c,0x20,0xdd,0xd6,0x5b,0xad,0x20,0x00,0x86,0xb3,0x72,0x20,
-0xd6,0xc6,0xe7,0x0a,0xf2,0x12,0x25,0xf6,0x00,0x00,0x05,0xfa,0xdb,0x22,0xbd,0x83,
-0x00,0x48,0x30,0x00,0x00,0x27,0x30,0xdd,0xcc,0xe0,0xfc,0xcd,0xed,0x21,0x1e,0x0e,
-0x11,0x2e,0xda,0xaa,0xe0,0xfa,0xaa,0x0b,0x00,0x52,0xdb,0xaa,0x90,0xbb,0xbb,0x0c,
-0x88,0x03,0x7d,0x93,0x0a,0x0b,0x00,0x20,0x2e,0xd1,0xd0,0xb6,0xf1,0x04,0x80,0xec,
-0xcc,0xb1,0xfc,0xcc,0xee,0xbb,0xcb,0x1f,0xbb,0xbe,0xe1,0x02,0xb1,0xc0,0x01,0xee,
-0xcb,0x0b,0x00,0xf0,0x94,0x00,0x00,0x20,0x01,0xee,0x19,0x99,0xbd,0x96,0x1e,0xe1,
-0x22,0x4e,0xa2,0x11,0xee,0x10,0x0b,0x99,0x00,0x1e,0xe1,0x2c,0x74,0x90,0x01,0xee,
-0x2d,0x50,0x49,0x00,0x2e,0xe1,0x00,0x6d,0x66,0xfe,0x80,0xdc,0xbc,0xb2,0xfb,0xbc,
-0xdd,0xba,0xcb,0x2e,0xaa,0xbd,0xd1,0x03,0xb2,0xc0,0x01,0xdd,0xcb,0xcb,0x2f,0xbb,
-0xcd,0xd2,0x11,0x00,0x11,0x12,0xdd,0x1b,0xed,0xcf,0xc6,0x1d,0xd1,0x08,0x50,0xd0,
-0x01,0xdd,0x3d,0xee,0xdf,0xda,0x1d,0xd1,0x0b,0x10,0xd0,0x01,0xdd,0x13,0xc0,0x0d,
-0x00,0x1d,0xd1,0xb2,0x00,0xd0,0xee,0x80,0xdd,0xce,0x70,0xfc,0xcd,0xcd,0xbb,0xd7,
-0x0f,0xbb,0xcc,0xd1,0x07,0x70,0xe0,0x03,0xcd,0xcc,0xd7,0x0f,0xcc,0xdc,0xd3,0x22,
-0x10,0x22,0x25,0xcd,0x10,0xdb,0xbd,0x80,0x3c,0xd1,0x0d,0x77,0xa8,0x03,0xcd,0x10,
-0xd2,0x28,0x80,0x3c,0xd1,0x0e,0xaa,0xc8,0x03,0xcd,0x14,0xa0,0x06,0x80,0x3c,0xd1,
-0x63,0x09,0xb4,0xde,0x70,0xec,0xcc,0xd0,0xb7,0x00,0x50,0xbd,0x0f,0xbb,0xbe,0xe1,
-0x66,0x94,0x11,0xee,0x66,0x94,0x02,0xe6,0x92,0x90,0x10,0xeb,0xbb,0xc0,0x1e,0xe1,
-0x0d,0x00,0x0d,0x12,0x93,0x24,0xbc,0xd0,0x0b,0x00,0xf0,0x37,0xfc,0xcc,0xa0,0x1e,
-0xe1,0x06,0x00,0x01,0xfe,0x90,0xeb,0xbb,0xc0,0xfb,0xbb,0xde,0xaa,0xac,0x0f,0xaa,
-0xad,0xe0,0x01,0xc0,0xe0,0x01,0xde,0xbb,0xe9,0x0c,0xcb,0xbd,0xe0,0x57,0x50,0xa4,
-0x31,0xde,0x0c,0xc5,0x5b,0xb1,0x1d,0xe0,0xa9,0xc3,0xc9,0x71,0xde,0x08,0x39,0x58,
-0x36,0x1d,0xe0,0xa2,0xb2,0xa5,0x71,0xde,0x04,0x8b,0x2b,0x75,0x1d,0xe0,0x1b,0x22,
-0x80,0x6e,0x48,0x05,0x50,0x34,0x00,0x00,0xed,0xed,0x5a,0x0f,0x80,0xe0,0x77,0xed,
-0xde,0xdd,0xe3,0xe1,0xd0,0xcc,0x61,0xf0,0x0c,0xe5,0xb0,0x4b,0x10,0x00,0x41,0xe0,
-0x97,0x0d,0x10,0x2a,0x40,0xe0,0x1c,0x0d,0x6a,0xd6,0x00,0xe0,0x1e,0x0d,0xa3,0x00,
-0x00,0xe8,0xe7,0x0d,0x83,0xa2,0x00,0xd3,0x01,0xa5,0x82,0xe0,0x00,0x0c,0x40,0x01,
-0xd2,0xe0,0x00,0x06,0xa5,0xb3,0x00,0x84,0x0b,0xf0,0x08,0x0c,0x10,0xdd,0xe9,0x0c,
-0x40,0x0c,0x10,0xd0,0x85,0x2e,0x00,0x0c,0x10,0xd0,0xc0,0xcc,0x9e,0xef,0xe3,0xd1,
-0xb6,0xec,0x0c,0x00,0x70,0xa8,0x4c,0x25,0x0c,0x10,0xd0,0x57,0x77,0x36,0xc0,0xd0,
-0x59,0x1c,0x09,0x5c,0x10,0xd4,0xe4,0x1c,0x01,0x0c,0x10,0x8f,0x4b,0x02,0x06,0x00,
-0x73,0x0d,0x10,0xd0,0x00,0x1b,0x03,0xec,0xc4,0x12,0xf0,0x1f,0xfd,0xe9,0x06,0xfc,
+0x00,0xc0,0x0d,0x00,0xf4,0x09,0xc9,0x99,0x0d,0x00,0x2e,0x2d,0x05,0x00,0x4c,0xa0,
+0x2c,0x3b,0x60,0x00,0x00,0x01,0x29,0x40,0x07,0xde,0xde,0xef,0xf7,0x00,0x01,0x00,
+0xf8,0x1e,0x04,0x50,0x05,0x30,0x01,0xd3,0x00,0x1c,0x01,0xd1,0x00,0x03,0xd2,0xcc,
+0xce,0xec,0xcc,0x00,0x02,0x00,0x33,0xd5,0x33,0x00,0x35,0x51,0x0f,0x66,0x66,0xf0,
+0x03,0x6d,0x30,0xfa,0xaa,0xaf,0x00,0x00,0xb3,0x0e,0x00,0x00,0xf0,0x00,0x0b,0x0d,
+0x00,0x80,0x0c,0x40,0xcb,0xbb,0xbc,0x00,0x0b,0x8b,0x55,0x00,0x85,0x06,0x70,0x07,
+0xdd,0xcd,0xdf,0xf1,0x00,0x01,0x00,0xf1,0x32,0x1a,0x30,0x00,0x01,0xd6,0x01,0x7c,
+0xaa,0xcd,0x00,0x01,0xc5,0xb5,0x27,0x3d,0x20,0x00,0x00,0x00,0xa3,0xbc,0x30,0x00,
+0x12,0x21,0x8c,0xe6,0x11,0x10,0x05,0xcf,0x15,0xda,0xcd,0xaa,0x30,0x00,0xd1,0x49,
+0x28,0x92,0x22,0x00,0x0d,0x2b,0xd9,0xcc,0x9d,0xb0,0x00,0xd1,0x58,0x06,0x70,0x95,
+0x00,0x0e,0x35,0xec,0xee,0xce,0x50,0x1d,0xbe,0x71,0x47,0x01,0x68,0x18,0xde,0xdd,
+0xde,0xf1,0x00,0x01,0x00,0xfa,0x39,0x01,0xc2,0x0d,0xaa,0xaa,0xaa,0xe0,0x03,0xd2,
+0xda,0xba,0xaa,0xad,0x00,0x01,0x0d,0x3b,0x1c,0x09,0x70,0x00,0x00,0xd0,0x67,0xd5,
+0x70,0x05,0xcc,0x0d,0x89,0x38,0x29,0xb0,0x12,0xe1,0xd1,0xd3,0xe2,0x23,0x00,0x0d,
+0x3a,0x9a,0x8f,0x88,0x60,0x00,0xd8,0x8c,0x88,0xf8,0x88,0x20,0x0d,0xa1,0x33,0x3e,
+0x33,0x30,0x08,0xdc,0x50,0x00,0x90,0x00,0x06,0xb0,0x07,0xcd,0xdc,0xde,0xe5,0x55,
+0x00,0xf8,0x33,0xd3,0x0e,0xab,0x6d,0xaa,0xc0,0x02,0xd2,0xea,0xb5,0xda,0xaa,0x00,
+0x00,0x0d,0x55,0x8c,0x54,0x91,0x00,0x00,0x24,0xc1,0x3b,0x43,0x06,0xee,0x05,0x5e,
+0x57,0xd5,0x40,0x00,0xd0,0x45,0xe5,0x6d,0x53,0x00,0x0d,0x5a,0xaf,0xab,0xea,0xa2,
+0x00,0xd1,0x14,0xb2,0x5b,0x31,0x00,0x0e,0x37,0xd3,0x00,0x4d,0x60,0x0b,0xbc,0xa1,
+0x00,0x00,0x13,0x06,0xa0,0xf1,0x01,0xf1,0x06,0x06,0x00,0x00,0x07,0x30,0x00,0x00,
+0x6c,0x00,0xe7,0x77,0x7e,0x00,0x00,0x76,0x0e,0x77,0x77,0xe0,0x00,0x00,0x0d,0x00,
+0xf4,0x25,0x47,0x70,0x08,0x7d,0xa7,0x70,0x03,0x6e,0x3d,0x8a,0x9a,0xa8,0xd0,0x00,
+0xd2,0x6a,0x76,0x39,0x55,0x00,0x0d,0x3a,0xbb,0xcb,0xaa,0x90,0x00,0xd1,0x00,0xda,
+0x99,0x60,0x00,0x2e,0x24,0xc5,0x00,0x77,0x00,0x2d,0x6e,0xd3,0x00,0x88,0x12,0x18,
+0x50,0x29,0xee,0xde,0xef,0xf4,0xa4,0x00,0x02,0x07,0x00,0xc0,0xa6,0x0e,0xae,0xbc,
+0xda,0xe0,0x00,0xd3,0xda,0xdb,0xbc,0xad,0x77,0x01,0xf6,0x28,0x0a,0x57,0x00,0x37,
+0x72,0xc4,0xb2,0xf8,0xe8,0x22,0x6e,0x59,0xe6,0xcc,0x2c,0x20,0x00,0xd1,0xb7,0xb5,
+0xea,0xea,0x10,0x0d,0x5a,0x67,0x4d,0x5d,0x50,0x00,0xd3,0x99,0x91,0xd4,0xc4,0x00,
+0x1e,0x85,0xa4,0x4e,0xad,0xa4,0x1d,0x6c,0x71,0x00,0x40,0x01,0x17,0x70,0x07,0xde,
+0xee,0xef,0xf6,0xfd,0x01,0x00,0x06,0x00,0xf0,0x11,0x11,0x4d,0x11,0x0a,0xed,0xf3,
+0x08,0xcb,0xbc,0xc4,0xa2,0x1e,0x00,0x0b,0x30,0x79,0x0a,0x27,0x70,0x00,0x59,0x0d,
+0x20,0xa2,0xd1,0x01,0xde,0xee,0xfd,0x9a,0x3b,0x30,0x24,0x00,0xf4,0x13,0xa2,0x2c,
+0x00,0x4d,0xdd,0xdd,0x0a,0x20,0xc1,0x05,0x90,0x00,0xe0,0xa2,0x0d,0x20,0x59,0x00,
+0x0e,0x0a,0x7d,0xa0,0x05,0xec,0xcc,0xf0,0xa2,0x00,0x00,0x59,0x00,0x0d,0x0a,0x20,
+0x54,0x00,0xf0,0x3c,0x1d,0xee,0xfd,0x9a,0xee,0xee,0x10,0x03,0x7a,0x00,0x00,0x00,
+0xe1,0x0b,0xde,0xee,0x60,0x00,0x0d,0x10,0xb1,0x78,0x66,0x23,0x33,0xe1,0x0b,0x35,
+0x86,0x6a,0xca,0xaf,0x10,0xb9,0x19,0xb6,0xa4,0x00,0xd1,0x0b,0x20,0x06,0x6a,0x40,
+0x00,0x00,0xbb,0xbb,0xd6,0xa4,0x00,0x00,0x0b,0x00,0x06,0x6a,0x40,0x06,0x70,0xbc,
+0xcc,0xd6,0x95,0x00,0x86,0x0b,0x00,0x06,0x65,0xde,0xec,0x10,0x00,0x00,0x41,0x4f,
+0x00,0xf7,0x37,0xab,0xe8,0x2e,0xbe,0xdc,0xf0,0x06,0x1c,0x37,0xd0,0xb6,0x4d,0x00,
+0x94,0xc8,0x48,0x8a,0xc8,0x80,0x05,0x5c,0x71,0x5a,0xcd,0xa6,0x02,0xee,0xfe,0xa0,
+0x03,0x80,0x00,0x00,0x9d,0x04,0xae,0xaa,0xeb,0x40,0x1c,0xeb,0x20,0xa3,0x0a,0x00,
+0x0a,0x5c,0x24,0x99,0xac,0x99,0x12,0xb1,0xc0,0x08,0xab,0xda,0x90,0x01,0x1c,0x00,
+0x00,0x49,0x00,0x00,0x01,0xc0,0x00,0x03,0x80,0xee,0x01,0xf0,0x21,0x12,0x46,0x50,
+0x00,0x1c,0xcc,0xcf,0xa8,0x64,0x00,0x2c,0xcc,0xcc,0xfc,0xcc,0xcc,0x20,0x03,0x33,
+0x3f,0x33,0x33,0x00,0x00,0xe8,0x77,0xf7,0x77,0xf0,0x00,0x0e,0x98,0x8f,0x88,0x8f,
+0x00,0x00,0xe2,0x11,0xf1,0x11,0xf0,0x00,0x0e,0xba,0xbf,0xaa,0xaf,0x34,0x00,0x00,
+0xc1,0x01,0x62,0x3c,0xcc,0xcf,0xcc,0xcc,0x60,0x0d,0x00,0x20,0x03,0xcc,0x0d,0x00,
+0xf0,0x07,0xc3,0x00,0x7c,0x99,0x99,0x9a,0xd0,0x00,0x07,0xc8,0x88,0x88,0x9d,0x00,
+0x00,0x59,0x88,0x88,0x88,0x90,0x00,0xbb,0x01,0x00,0xf4,0x20,0xb5,0x00,0x46,0x66,
+0x66,0x66,0x61,0x00,0x0b,0x63,0x3d,0x53,0x3c,0x30,0x00,0xba,0x99,0xea,0x99,0xe3,
+0x00,0x07,0x87,0x7e,0x87,0x7a,0x20,0x00,0xaa,0xaa,0xeb,0xaa,0xa5,0x00,0x00,0x00,
+0x0c,0x10,0x00,0x00,0x1b,0xbb,0xbb,0xfc,0xbb,0xbb,0x60,0x9b,0x00,0xf0,0x06,0xc5,
+0x00,0x01,0xe0,0x00,0x00,0x8b,0xd6,0x00,0x1e,0x00,0x00,0x9c,0x01,0xb5,0x01,0xe0,
+0x00,0x1c,0xdc,0xc9,0x0d,0x00,0xf0,0x07,0x00,0xb2,0x09,0xbb,0xfb,0xb6,0x01,0x1b,
+0x41,0x78,0x9f,0x88,0x40,0xbb,0xec,0xb1,0x01,0xe0,0x00,0x04,0x1b,0x28,0x1a,0x00,
+0x90,0x56,0xb5,0x90,0x01,0xe0,0x00,0x01,0x7b,0x64,0x0d,0x00,0x91,0x58,0xed,0xa1,
+0x01,0xe0,0x00,0x07,0x41,0x00,0x34,0x00,0x11,0x18,0x54,0x00,0xf0,0x3c,0x0a,0xe5,
+0x0a,0xef,0xee,0xc0,0x0a,0x91,0x99,0x00,0xe0,0x3b,0x03,0xdd,0xcc,0x00,0x2c,0x04,
+0xa0,0x00,0x2a,0x00,0x03,0xa0,0x59,0x00,0x13,0xb1,0x08,0xcd,0xac,0x80,0x0b,0xce,
+0xb4,0x4a,0xa6,0xb7,0x00,0x62,0xa6,0x20,0x95,0x09,0x50,0x09,0x3a,0xb0,0x0b,0x20,
+0xa4,0x00,0x44,0xb8,0x20,0xe0,0x0c,0x20,0x1a,0xdb,0x8a,0xcf,0xcc,0xfd,0x90,0x30,
+0x00,0x01,0x11,0x11,0x10,0x00,0x48,0x00,0x0a,0xdd,0x01,0xf5,0x35,0xd5,0x03,0xec,
+0xce,0x20,0x1c,0x50,0xa5,0x84,0x00,0xd0,0x05,0xdc,0xca,0x0a,0xcc,0xdb,0x00,0x00,
+0x58,0x00,0x00,0x06,0x70,0x00,0x15,0x91,0x9f,0xff,0xff,0xf4,0x2b,0xdd,0xb3,0x60,
+0xc4,0x17,0x00,0x54,0x87,0x09,0x4c,0xbb,0x50,0x0a,0x48,0xb0,0x05,0xe8,0x70,0x00,
+0x75,0x96,0x2a,0x9d,0x0c,0x40,0x17,0xbe,0xb7,0x30,0xc0,0x1c,0x21,0x62,0x00,0x03,
+0xdc,0x8b,0x01,0xf4,0x3e,0x02,0xc0,0x00,0x84,0x0d,0x00,0x00,0xcb,0xa0,0x4b,0x85,
+0xe5,0x00,0xb7,0x06,0xa6,0xca,0x7e,0x71,0x3d,0xdc,0xc1,0x08,0x40,0xd0,0x00,0x02,
+0xa0,0x2d,0xee,0xdf,0xd6,0x07,0x8d,0x73,0x11,0x11,0x11,0x00,0x57,0xc6,0x22,0xdd,
+0xdd,0x90,0x09,0x2a,0x82,0x2a,0x00,0x2b,0x00,0x94,0xab,0x02,0xec,0xcc,0xb0,0x04,
+0x4a,0x41,0x2a,0x00,0x3b,0x00,0x49,0xfe,0x52,0xb2,0x25,0xb0,0x19,0x62,0x00,0x2e,
+0xaa,0xbb,0x55,0x00,0xf9,0x3f,0x08,0x40,0x00,0x00,0xc0,0x00,0x01,0xdb,0x2d,0xe6,
+0xbf,0xb8,0x00,0xc3,0x29,0x19,0x23,0xd3,0xc1,0x3d,0xcc,0x57,0x36,0x7e,0x7d,0x20,
+0x07,0x50,0xc6,0x58,0xe8,0xb0,0x08,0xba,0x76,0xc3,0x3d,0x32,0x00,0x59,0x84,0x2b,
+0x7c,0xfc,0xb0,0x09,0x65,0xaa,0xc0,0x0c,0x00,0x00,0xa7,0x86,0x9a,0xac,0xfc,0xc1,
+0x05,0x88,0x57,0xb0,0x0c,0x00,0x00,0x8d,0xd7,0xc6,0xa2,0x50,0x00,0x08,0x30,0x75,
+0x04,0xac,0xcc,0x40,0x29,0x04,0xf0,0x21,0x02,0xd0,0x04,0x0c,0x00,0x60,0x00,0xcc,
+0xa0,0xc0,0xc0,0x7b,0x00,0xb7,0x06,0xb6,0x5c,0x1e,0x20,0x5c,0xbb,0xb4,0xbc,0xfc,
+0xcb,0x00,0x02,0xd2,0x0c,0x00,0x00,0xe0,0x05,0x5d,0x53,0xeb,0xbb,0xbe,0x00,0x89,
+0xe8,0x5c,0x00,0x00,0xe0,0x07,0x0c,0x45,0x0d,0x00,0xf0,0x0e,0xa2,0xc8,0x3d,0x11,
+0x11,0xe0,0x07,0x4c,0x80,0x9b,0xab,0xb9,0x00,0x37,0xfc,0x73,0xc1,0x3c,0x20,0x1a,
+0x63,0x06,0xc2,0x00,0x2c,0x50,0x00,0x00,0x10,0x55,0x00,0xf9,0x3e,0x2b,0x00,0x00,
+0xa2,0x00,0x00,0x0c,0xd9,0x2c,0xcd,0xcc,0xc4,0x0b,0x70,0x7a,0x0c,0x02,0xc0,0x04,
+0xdd,0xed,0x9c,0xed,0xde,0xc7,0x00,0x0c,0x00,0x45,0x55,0x55,0x00,0xab,0xea,0x6c,
+0x55,0x55,0xf0,0x02,0x3d,0x31,0xcb,0xbb,0xbf,0x00,0xa1,0xc5,0x6c,0x00,0x00,0xf0,
+0x09,0x3c,0x92,0x8e,0xbe,0xba,0x00,0x44,0xc4,0x10,0xc1,0xb2,0x00,0x05,0x8f,0xd9,
+0x6b,0x0b,0x31,0xa0,0x95,0x21,0xda,0x10,0x7d,0xd6,0xaf,0x00,0x00,0x97,0x01,0xf0,
+0x31,0x0d,0x00,0x00,0x02,0xdc,0x45,0xcc,0xfd,0xcc,0x21,0xd3,0x1b,0x24,0x70,0x2d,
+0x00,0x5c,0xcc,0x88,0xbe,0xbd,0xdb,0x50,0x06,0x50,0x15,0x55,0x55,0x40,0x17,0xaa,
+0x71,0xd6,0xe7,0x6d,0x01,0x7a,0xa7,0x1e,0x9e,0xa9,0xd0,0x08,0x65,0xa1,0xb1,0xc2,
+0x1d,0x00,0xa6,0x78,0x18,0x8e,0x98,0x70,0x06,0x67,0x53,0xbb,0xfb,0xbb,0x00,0x5c,
+0xfd,0x88,0x06,0xf0,0x63,0x3a,0x61,0x09,0xbb,0xfc,0xbb,0x50,0x00,0x21,0x00,0x00,
+0x00,0x40,0x00,0x0c,0x80,0xdc,0xe8,0x2b,0x00,0x08,0x67,0xbd,0xae,0x58,0xdb,0x53,
+0xe9,0x96,0xc0,0x09,0xd4,0x00,0x02,0xa6,0x1d,0xad,0xd7,0x95,0x00,0x5b,0x84,0xc2,
+0xc3,0x01,0xd0,0x07,0xb9,0x67,0x88,0x70,0x01,0x00,0x78,0x48,0x5c,0xcc,0xcc,0xc0,
+0x0a,0x87,0x56,0x57,0x1a,0x0d,0x00,0x88,0x81,0x65,0x71,0xa0,0xd0,0x03,0xbd,0xa6,
+0x57,0x1a,0x0d,0x01,0xb7,0x26,0xee,0xed,0xfd,0xf8,0x00,0x0d,0xdc,0xcc,0xcc,0xc0,
+0x00,0x00,0xda,0xaa,0xaa,0xa6,0x00,0x00,0x0d,0x32,0x22,0x22,0x10,0x00,0x00,0xdc,
+0xcc,0xcc,0xc7,0x00,0x00,0x0d,0x10,0xf1,0x04,0xf2,0x28,0xdd,0xfe,0xdd,0xdd,0xdd,
+0xd6,0x00,0x0e,0x00,0xc4,0x00,0x86,0x00,0x00,0xe0,0x02,0xd6,0xc6,0x00,0x00,0x0e,
+0x00,0x25,0xf6,0x00,0x00,0x05,0xfa,0xdb,0x22,0xbd,0x83,0x00,0x48,0x30,0x00,0x00,
+0x27,0x30,0xdd,0xcc,0xe0,0xfc,0xcd,0xed,0x21,0x1e,0x0e,0x11,0x2e,0xda,0xaa,0xe0,
+0xfa,0xaa,0x0b,0x00,0x60,0xdb,0xaa,0x90,0xbb,0xbb,0xed,0x48,0x00,0x20,0x1e,0xd1,
+0x4d,0x00,0x0c,0x0b,0x00,0xf1,0x0a,0x2e,0xd1,0x00,0x00,0x05,0xfe,0x80,0xec,0xcc,
+0xb1,0xfc,0xcc,0xee,0xbb,0xcb,0x1f,0xbb,0xbe,0xe1,0x02,0xb1,0xc0,0x01,0xee,0xcb,
+0x0b,0x00,0xf0,0x94,0x00,0x00,0x20,0x01,0xee,0x19,0x99,0xbd,0x96,0x1e,0xe1,0x22,
+0x4e,0xa2,0x11,0xee,0x10,0x0b,0x99,0x00,0x1e,0xe1,0x2c,0x74,0x90,0x01,0xee,0x2d,
+0x50,0x49,0x00,0x2e,0xe1,0x00,0x6d,0x66,0xfe,0x80,0xdc,0xbc,0xb2,0xfb,0xbc,0xdd,
+0xba,0xcb,0x2e,0xaa,0xbd,0xd1,0x03,0xb2,0xc0,0x01,0xdd,0xcb,0xcb,0x2f,0xbb,0xcd,
+0xd2,0x11,0x00,0x11,0x12,0xdd,0x1b,0xed,0xcf,0xc6,0x1d,0xd1,0x08,0x50,0xd0,0x01,
+0xdd,0x3d,0xee,0xdf,0xda,0x1d,0xd1,0x0b,0x10,0xd0,0x01,0xdd,0x13,0xc0,0x0d,0x00,
+0x1d,0xd1,0xb2,0x00,0xd0,0xee,0x80,0xdd,0xce,0x70,0xfc,0xcd,0xcd,0xbb,0xd7,0x0f,
+0xbb,0xcc,0xd1,0x07,0x70,0xe0,0x03,0xcd,0xcc,0xd7,0x0f,0xcc,0xdc,0xd3,0x22,0x10,
+0x22,0x25,0xcd,0x10,0xdb,0xbd,0x80,0x3c,0xd1,0x0d,0x77,0xa8,0x03,0xcd,0x10,0xd2,
+0x28,0x80,0x3c,0xd1,0x0e,0xaa,0xc8,0x03,0xcd,0x14,0xa0,0x06,0x80,0x3c,0xd1,0x63,
+0x09,0xb4,0xde,0x70,0xec,0xcc,0xd0,0xb7,0x00,0xf0,0x01,0xbd,0x0f,0xbb,0xbe,0xe1,
+0x01,0xd0,0xe0,0x01,0xee,0xcc,0xcd,0x0f,0xbb,0xce,0xe1,0xde,0x00,0xf4,0x01,0xee,
+0x10,0xeb,0xbb,0xc0,0x1e,0xe1,0x0d,0x00,0x0d,0x01,0xee,0x10,0xfb,0xbc,0xd0,0x0b,
+0x00,0xf0,0x37,0xfc,0xcc,0xa0,0x1e,0xe1,0x06,0x00,0x01,0xfe,0x90,0xeb,0xbb,0xc0,
+0xfb,0xbb,0xde,0xaa,0xac,0x0f,0xaa,0xad,0xe0,0x01,0xc0,0xe0,0x01,0xde,0xbb,0xe9,
+0x0c,0xcb,0xbd,0xe0,0x57,0x50,0xa4,0x31,0xde,0x0c,0xc5,0x5b,0xb1,0x1d,0xe0,0xa9,
+0xc3,0xc9,0x71,0xde,0x08,0x39,0x58,0x36,0x1d,0xe0,0xa2,0xb2,0xa5,0x71,0xde,0x04,
+0x8b,0x2b,0x75,0x1d,0xe0,0x1b,0x22,0x80,0x6e,0x48,0x05,0xf0,0x20,0x34,0x00,0x00,
+0xed,0xed,0x00,0x2d,0x00,0x00,0xe0,0x77,0xed,0xde,0xdd,0xe3,0xe1,0xd0,0xb0,0x00,
+0x00,0xb3,0xe5,0xb0,0x4b,0x10,0x00,0x41,0xe0,0x97,0x0d,0x10,0x2a,0x40,0xe0,0x1c,
+0x0d,0x6a,0xd6,0x00,0xe0,0x1e,0x0d,0xa3,0x00,0x00,0xe8,0xe7,0xcd,0x01,0x10,0xe0,
+0xd3,0x01,0xd5,0x82,0xe0,0x00,0x0c,0x40,0x01,0xd2,0xe0,0x00,0x06,0xdd,0xdd,0x90,
+0xa2,0x02,0xf0,0x09,0x80,0x0c,0x10,0xdd,0xe9,0x0c,0x40,0x0c,0x10,0xd0,0x85,0x2e,
+0x00,0x0c,0x10,0xd0,0xc0,0xcc,0x9e,0xef,0xe3,0xd1,0xb6,0xec,0x0c,0x00,0xf2,0x0c,
+0xa8,0x4c,0x25,0x0c,0x10,0xd0,0x57,0x1c,0x0c,0x0c,0x10,0xd0,0x59,0x1c,0x09,0x5c,
+0x10,0xd4,0xe4,0x1c,0x01,0x0c,0x10,0xd0,0x00,0x1c,0x00,0x06,0x00,0x70,0x0d,0x10,
+0xd0,0x00,0x1b,0x03,0xec,0x49,0x00,0xf1,0x2b,0x60,0x00,0x00,0xfd,0xe9,0x06,0xfc,
 0xcc,0x20,0xd0,0xb2,0x7e,0x60,0x7d,0x00,0xd3,0xb1,0x80,0xba,0xc1,0x00,0xd7,0x80,
 0x17,0xcb,0xc7,0x20,0xd0,0xb6,0xc6,0x05,0x15,0xb3,0xd0,0x58,0x7a,0xaf,0xba,0x80,
-0xd0,0x6a,0x44,0x2e,0x42,0x20,0xdb,0xd3,0x93,0x0d,0xb0,0x6b,0x51,0xed,0xdf,0xdd,
-0xd3,0xd0,0x70,0x02,0x18,0xd0,0x67,0x18,0x02,0x2a,0x5a,0x80,0xed,0x5e,0xdd,0xdf,
-0x10,0xd0,0x58,0x5a,0x6c,0x00,0x71,0xb1,0x5e,0xcc,0xcf,0x10,0xd0,0xc0,0x0c,0x00,
-0xf0,0x08,0x67,0x5e,0xaa,0xaf,0x10,0xd0,0x1c,0x5b,0x2d,0x22,0x10,0xd0,0x1d,0x5a,
-0x0a,0x39,0x90,0xd2,0xd7,0x5a,0x04,0xe7,0x00,0x50,0x74,0x10,0xc3,0x5f,0x7d,0x98,
-0x8c,0x2e,0x50,0xd0,0x00,0x9b,0x62,0x03,0xa0,0x55,0xb7,0xf0,0x0b,0xfd,0xe9,0x00,
-0x5f,0x70,0x00,0xd0,0xa3,0x05,0xd2,0xa9,0x00,0xd1,0xc1,0xbb,0x10,0x08,0xd3,0xd5,
-0x91,0x5d,0xde,0xdd,0x51,0xd0,0xb3,0x5c,0x0c,0xf7,0x13,0xd0,0x59,0x77,0x7e,0x97,
-0x72,0xd0,0x6a,0x66,0x6d,0x76,0x62,0xd9,0xd3,0x1a,0x0c,0x2b,0x10,0xd0,0x00,0x96,
-0x0c,0x24,0xc0,0xd0,0x04,0xb0,0x0c,0x20,0x94,0xd0,0x00,0x05,0xdd,0x99,0x00,0xf0,
-0x0e,0x26,0x00,0x00,0xee,0xe9,0x02,0xdc,0x40,0x00,0xd0,0x94,0x6d,0x51,0xa9,0x20,
-0xd0,0xc8,0x81,0x4a,0x04,0xb3,0xd3,0xa0,0x7b,0xbc,0xb9,0x00,0xd0,0xa3,0x43,0x22,
-0x80,0xd0,0x58,0x6b,0xbb,0xfb,0x50,0xd0,0x59,0xbe,0x19,0xf6,0x08,0xd7,0xd8,0xcc,
-0xcc,0xcc,0xc3,0xd0,0x00,0x08,0x80,0x67,0x00,0xd0,0x00,0x6b,0x12,0x4e,0x40,0xd0,
-0x01,0xdc,0xba,0x98,0x52,0x23,0xf1,0x20,0x51,0x00,0x0e,0xde,0x90,0x3e,0x32,0x30,
-0xd0,0x94,0x0b,0xba,0xae,0x6d,0x0c,0x09,0xa0,0x03,0xd0,0xd3,0xa5,0xb0,0x30,0xa3,
-0x0d,0x0a,0x36,0xb9,0x59,0x98,0xd0,0x58,0xd1,0x00,0x24,0xdd,0x05,0x9d,0x10,0x00,
-0x1d,0xd7,0xd3,0xdc,0xc4,0xcd,0xdd,0x8a,0xa7,0x90,0xd0,0x00,0xdc,0xbb,0xbc,0xdd,
-0x00,0x0d,0x21,0xed,0x77,0xf0,0x27,0xc2,0x01,0xc0,0x00,0xed,0xe8,0xc2,0x01,0xc0,
-0x41,0xc0,0x93,0xcd,0xd6,0xeb,0x70,0xc0,0xc0,0xc2,0x01,0xd0,0x10,0xc4,0x90,0xd6,
-0x74,0xd0,0x58,0xc0,0xc3,0xea,0x76,0xad,0xc3,0xc0,0x66,0x11,0x7b,0x11,0x10,0xc0,
-0x58,0x9c,0xaa,0xab,0xb0,0xc6,0xd4,0x96,0x11,0x13,0xb0,0xc1,0x10,0x0c,0x00,0x00,
-0xc8,0x6f,0x79,0x03,0xb0,0xc0,0x00,0x9d,0xbb,0xbc,0x9b,0x89,0xf0,0x0b,0xfd,0xe9,
-0xad,0xdd,0xdd,0xd7,0xd0,0xa4,0x0b,0xbb,0xbb,0x90,0xd1,0xd0,0x0d,0x00,0x00,0xd0,
-0xd5,0x90,0x0f,0xbb,0xbb,0xd0,0xd0,0xc2,0x43,0x5a,0xf7,0x08,0xd0,0x58,0xab,0xb9,
-0x9a,0xd5,0xd0,0x69,0xa4,0xa1,0x86,0x85,0xd8,0xb2,0xa6,0xcb,0xfa,0x85,0xd0,0x00,
-0xa4,0x0d,0x00,0x06,0x00,0x15,0x08,0x08,0x67,0x00,0x7a,0x7d,0xf0,0x17,0xfd,0xea,
-0xac,0xdf,0xcc,0x80,0xd0,0x93,0x07,0x60,0x83,0x00,0xd1,0xc4,0xcd,0xdc,0xec,0xc1,
-0xd4,0x90,0x24,0x44,0x44,0x00,0xd0,0xa3,0x6a,0x55,0x5d,0x20,0xd0,0x49,0x6c,0x99,
-0x9e,0x20,0xd0,0x5a,0x0c,0x00,0x80,0xd7,0xc3,0x24,0x4f,0x44,0x00,0xd0,0x04,0x01,
-0x25,0x21,0xd0,0x00,0x89,0x61,0x09,0x49,0x90,0x00,0x49,0x40,0xf5,0x33,0xed,0xea,
+0xd0,0x6a,0x44,0x2e,0x42,0x20,0xdb,0xd3,0x93,0x0d,0x10,0x00,0xd0,0x00,0xed,0xdf,
+0xdd,0xd3,0xd0,0x70,0x02,0x02,0x06,0x00,0x08,0x01,0x00,0x90,0xdd,0xed,0x5e,0xdd,
+0xdf,0x10,0xd0,0x58,0x5a,0x6c,0x00,0x71,0xb1,0x5e,0xcc,0xcf,0x10,0xd0,0xc0,0x0c,
+0x00,0xf6,0x1a,0x67,0x5e,0xaa,0xaf,0x10,0xd0,0x1c,0x5b,0x2d,0x22,0x10,0xd0,0x1d,
+0x5a,0x0a,0x39,0x90,0xd2,0xd7,0x5a,0x04,0xe7,0x00,0xd0,0x00,0x5a,0x00,0xc3,0x00,
+0xd0,0x00,0x6c,0x8c,0x2e,0x50,0xd0,0x00,0x9b,0x62,0x03,0xa0,0x87,0x03,0xf7,0x33,
+0x10,0x00,0xfd,0xe9,0x00,0x5f,0x70,0x00,0xd0,0xa3,0x05,0xd2,0xa9,0x00,0xd1,0xc1,
+0xbb,0x10,0x08,0xd3,0xd5,0x91,0x5d,0xde,0xdd,0x51,0xd0,0xb3,0x00,0x0c,0x20,0x00,
+0xd0,0x59,0x77,0x7e,0x97,0x72,0xd0,0x6a,0x66,0x6d,0x76,0x62,0xd9,0xd3,0x1a,0x0c,
+0x2b,0x10,0xd0,0x00,0x96,0x0c,0x24,0xc0,0xd0,0x04,0xb0,0x0c,0x20,0x94,0xd0,0x00,
+0x05,0xdd,0x99,0x00,0xf5,0x36,0x26,0x00,0x00,0xee,0xe9,0x02,0xdc,0x40,0x00,0xd0,
+0x94,0x6d,0x51,0xa9,0x20,0xd0,0xc8,0x81,0x4a,0x04,0xb3,0xd3,0xa0,0x7b,0xbc,0xb9,
+0x00,0xd0,0xa3,0x00,0x00,0x86,0x00,0xd0,0x58,0x6b,0xbb,0xfb,0x50,0xd0,0x59,0x01,
+0x11,0x11,0x00,0xd7,0xd8,0xcc,0xcc,0xcc,0xc3,0xd0,0x00,0x08,0x80,0x67,0x00,0xd0,
+0x00,0x6b,0x12,0x4e,0x40,0xd0,0x01,0xdc,0xba,0x98,0xc0,0x4e,0x00,0xf0,0x20,0x51,
+0x00,0x0e,0xde,0x90,0x3e,0x32,0x30,0xd0,0x94,0x0b,0xba,0xae,0x6d,0x0c,0x09,0xa0,
+0x03,0xd0,0xd3,0xa5,0xb0,0x30,0xa3,0x0d,0x0a,0x36,0xb9,0x59,0x98,0xd0,0x58,0xd1,
+0x00,0x24,0xdd,0x05,0x9d,0x10,0x00,0x1d,0xd7,0xd3,0xdc,0xc4,0xcd,0xdd,0x26,0x01,
+0xf0,0x35,0x1d,0xd0,0x00,0xdc,0xbb,0xbc,0xdd,0x00,0x0d,0x21,0x11,0x2d,0x00,0x00,
+0xc2,0x01,0xc0,0x00,0xed,0xe8,0xc2,0x01,0xc0,0x41,0xc0,0x93,0xcd,0xd6,0xeb,0x70,
+0xc0,0xc0,0xc2,0x01,0xd0,0x10,0xc4,0x90,0xd6,0x74,0xd0,0x58,0xc0,0xc3,0xea,0x76,
+0xad,0xc3,0xc0,0x66,0x11,0x7b,0x11,0x10,0xc0,0x58,0x9c,0xaa,0xab,0xb0,0xc6,0xd4,
+0x96,0x11,0x13,0xb0,0xc1,0x10,0x0c,0x00,0xc8,0xc0,0x00,0x95,0x00,0x03,0xb0,0xc0,
+0x00,0x9d,0xbb,0xbc,0xb0,0x7a,0x01,0xf7,0x26,0xfd,0xe9,0xad,0xdd,0xdd,0xd7,0xd0,
+0xa4,0x0b,0xbb,0xbb,0x90,0xd1,0xd0,0x0d,0x00,0x00,0xd0,0xd5,0x90,0x0f,0xbb,0xbb,
+0xd0,0xd0,0xc2,0x13,0x33,0x33,0x30,0xd0,0x58,0xab,0xb9,0x9a,0xd5,0xd0,0x69,0xa4,
+0xa1,0x86,0x85,0xd8,0xb2,0xa6,0xcb,0xfa,0x85,0xd0,0x00,0xa4,0x0d,0x00,0x06,0x00,
+0x25,0x08,0xd3,0x4b,0x00,0xf0,0x1a,0x15,0x00,0x00,0xfd,0xea,0xac,0xdf,0xcc,0x80,
+0xd0,0x93,0x07,0x60,0x83,0x00,0xd1,0xc4,0xcd,0xdc,0xec,0xc1,0xd4,0x90,0x24,0x44,
+0x44,0x00,0xd0,0xa3,0x6a,0x55,0x5d,0x20,0xd0,0x49,0x6c,0x99,0x9e,0x20,0xd0,0x5a,
+0x0c,0x00,0xd0,0xd7,0xc3,0x24,0x4f,0x44,0x00,0xd0,0x04,0xdd,0xdf,0xdd,0xd2,0xd0,
+0x6c,0x04,0x12,0x00,0x06,0x00,0x05,0x01,0x00,0xf3,0x36,0x05,0x00,0x00,0xed,0xea,
 0x55,0x9c,0x66,0x60,0xc0,0xa3,0xb2,0xcb,0xaa,0x70,0xc2,0xb0,0x09,0x71,0xb4,0x10,
 0xc4,0xa5,0x76,0x69,0x99,0x91,0xc0,0xa7,0xc0,0x9a,0xaa,0x50,0xc0,0x57,0xa0,0xd4,
 0x48,0x80,0xc0,0x68,0xa0,0xd6,0x69,0x80,0xc8,0xd2,0xa0,0xda,0xac,0x80,0xc0,0x00,
 0xa0,0xd0,0x06,0x80,0xc0,0x03,0xb7,0xa0,0x29,0x40,0xc0,0x09,0x11,0x9c,0xdd,0xd1,
-0x2d,0x94,0x10,0x83,0x80,0x09,0xf1,0x1a,0xf8,0x7a,0xc7,0x77,0x30,0x02,0xe8,0x44,
-0xa8,0x44,0x42,0x01,0xec,0xca,0xad,0xca,0xaa,0x00,0x02,0x99,0x55,0xb9,0x55,0x50,
-0x00,0x09,0x95,0x5b,0x95,0x55,0x00,0x00,0x9d,0xcc,0xed,0xcc,0xcb,0x00,0x04,0x20,
-0x0b,0x5b,0xbb,0xf4,0x09,0xce,0xfe,0xcc,0xcc,0x50,0x00,0x1a,0x9f,0x8c,0x30,0x00,
-0x03,0x9d,0x40,0xe0,0x3c,0xc6,0x11,0xb5,0x00,0x0e,0x00,0x03,0x93,0xcf,0x17,0xf0,
-0x20,0x3c,0x00,0x4b,0x48,0x00,0x01,0xfa,0xeb,0x5b,0xb9,0xe9,0x00,0xcc,0x3d,0x35,
-0xf4,0x4c,0x20,0x19,0xe8,0xe8,0xad,0x99,0xd7,0x00,0x1e,0xae,0xa3,0xca,0xae,0x80,
-0x01,0xc3,0xd3,0x2c,0x44,0xc3,0x00,0x06,0x66,0x64,0x56,0x66,0x61,0x05,0xcc,0xcc,
-0xdc,0x2e,0x50,0x00,0x7c,0x10,0x02,0xc4,0x7b,0x53,0x21,0x89,0xb2,0x7a,0x56,0x95,
-0xdc,0x96,0x30,0x0c,0xb9,0x51,0x00,0x26,0x9b,0xf6,0x00,0xf0,0x2f,0xa3,0x00,0x0b,
-0x47,0x00,0x0c,0xcc,0xcc,0xa2,0xc0,0xd0,0x00,0x64,0x57,0x63,0x8d,0x9b,0x92,0x08,
-0x3a,0xb7,0x7f,0x83,0xe3,0x10,0x87,0x76,0x98,0xd6,0x0d,0x00,0x08,0xcb,0xbd,0x47,
-0xec,0xfc,0x10,0x00,0x84,0x00,0x76,0x0d,0x00,0x0e,0xdf,0xdd,0xb7,0x60,0xd0,0x00,
-0xc2,0x96,0x0b,0x7e,0xdf,0xd1,0x0c,0x9a,0xa6,0xb7,0x60,0x72,0xb0,0xc0,0x2b,0x7d,
-0xcf,0xc5,0x0c,0x00,0x3b,0x67,0x71,0x11,0x00,0x02,0x3b,0xba,0x30,0xb2,0x00,0xda,
-0x6f,0x28,0xf0,0x03,0xd0,0x0d,0x38,0x82,0xe3,0x88,0x3e,0x00,0x50,0x11,0x0e,0x01,
-0x10,0x50,0x00,0x79,0x94,0xa5,0x15,0x63,0xf0,0x02,0x49,0xb8,0xb7,0x30,0x00,0x2b,
-0xc8,0x21,0xb1,0x38,0xbc,0x30,0x18,0xbb,0xbc,0xbb,0xc8,0x75,0x06,0x30,0x01,0xaa,
-0x00,0x1f,0x53,0x12,0xe5,0x55,0x36,0x15,0xd1,0x23,0x1f,0x00,0x86,0x09,0xd1,0x20,
-0x98,0x88,0x8f,0x88,0x88,0x90,0xd4,0x99,0x3e,0x39,0x93,0xe0,0x3b,0x92,0xf0,0x0b,
-0xa0,0x08,0xcc,0x4e,0x4c,0xc8,0x00,0x09,0xbb,0xbe,0xbb,0xba,0x00,0x0d,0x32,0x3e,
-0x22,0x2e,0x00,0x0d,0x87,0x7e,0x77,0x7e,0x00,0x0d,0x65,0xbb,0x20,0x32,0x0b,0x24,
-0x00,0x11,0x85,0x50,0x3b,0x20,0xd1,0x02,0x03,0x0a,0x30,0xc2,0x00,0xcb,0xda,0x27,
-0xf0,0x1c,0xc0,0x0d,0x26,0x62,0xe2,0x66,0x2e,0x00,0x81,0x33,0x1e,0x13,0x31,0x90,
+0x4c,0x00,0x30,0x09,0x40,0x83,0x80,0x09,0xf0,0x1a,0xf8,0x7a,0xc7,0x77,0x30,0x02,
+0xe8,0x44,0xa8,0x44,0x42,0x01,0xec,0xca,0xad,0xca,0xaa,0x00,0x02,0x99,0x55,0xb9,
+0x55,0x50,0x00,0x09,0x95,0x5b,0x95,0x55,0x00,0x00,0x9d,0xcc,0xed,0xcc,0xcb,0x00,
+0x04,0x20,0x0b,0x31,0x08,0xf3,0x0a,0xcc,0xce,0xfe,0xcc,0xcc,0x50,0x00,0x1a,0x9f,
+0x8c,0x30,0x00,0x03,0x9d,0x40,0xe0,0x3c,0xc6,0x11,0xb5,0x00,0x0e,0x00,0x03,0x93,
+0x54,0x00,0xf5,0x3e,0x0a,0x3c,0x00,0x4b,0x48,0x00,0x01,0xfa,0xeb,0x5b,0xb9,0xe9,
+0x00,0xcc,0x3d,0x35,0xf4,0x4c,0x20,0x19,0xe8,0xe8,0xad,0x99,0xd7,0x00,0x1e,0xae,
+0xa3,0xca,0xae,0x80,0x01,0xc3,0xd3,0x2c,0x44,0xc3,0x00,0x06,0x66,0x64,0x56,0x66,
+0x61,0x05,0xcc,0xcc,0xcc,0xcc,0xb0,0x00,0x00,0x7c,0x10,0x02,0xc4,0x00,0x00,0x00,
+0x5d,0x89,0xb2,0x00,0x00,0x02,0x58,0xdc,0xdc,0x96,0x30,0x0c,0xb9,0x51,0x00,0x26,
+0x9b,0xf6,0x00,0xf0,0x2d,0xa3,0x00,0x0b,0x47,0x00,0x0c,0xcc,0xcc,0xa2,0xc0,0xd0,
+0x00,0x64,0x57,0x63,0x8d,0x9b,0x92,0x08,0x3a,0xb7,0x7f,0x83,0xe3,0x10,0x87,0x76,
+0x98,0xd6,0x0d,0x00,0x08,0xcb,0xbd,0x47,0xec,0xfc,0x10,0x00,0x84,0x00,0x76,0x0d,
+0x00,0x0e,0xdf,0xdd,0xb7,0x60,0xd0,0x00,0xc2,0x96,0x0b,0x7e,0xdf,0xd1,0x0c,0x9a,
+0xa6,0x0d,0x00,0xf0,0x31,0xc0,0x00,0x2b,0x7d,0xcf,0xc5,0x0c,0x00,0x3b,0x67,0x71,
+0x11,0x00,0x02,0xbb,0xbb,0xfb,0xbb,0xb2,0x00,0xda,0xaa,0xaf,0xaa,0xaa,0xd0,0x0d,
+0x38,0x82,0xe3,0x88,0x3e,0x00,0x50,0x11,0x0e,0x01,0x10,0x50,0x00,0x79,0x94,0xa5,
+0x99,0x70,0x00,0x00,0x49,0xb8,0xb7,0x30,0x00,0x2b,0xc8,0x21,0xb1,0x38,0xbc,0x30,
+0x18,0xbb,0xbc,0xbb,0xc8,0x75,0x06,0x20,0x01,0xaa,0x10,0x0c,0x12,0xbb,0xb7,0x0b,
+0x24,0x17,0xd1,0x9b,0x00,0x10,0x2c,0x86,0x09,0xe0,0x20,0x98,0x88,0x8f,0x88,0x88,
+0x90,0xd4,0x99,0x3e,0x39,0x93,0xe0,0xa0,0xb1,0x01,0xf0,0x11,0xa0,0x08,0xcc,0x4e,
+0x4c,0xc8,0x00,0x09,0xbb,0xbe,0xbb,0xba,0x00,0x0d,0x32,0x3e,0x22,0x2e,0x00,0x0d,
+0x87,0x7e,0x77,0x7e,0x00,0x0d,0xbb,0xbf,0xbb,0xbe,0x32,0x0b,0x24,0x00,0x80,0x85,
+0x00,0x00,0x0b,0xcc,0xcc,0xd1,0x02,0x03,0x0a,0xf4,0x33,0xc2,0x00,0xcb,0xbb,0xbf,
+0xbb,0xbb,0xc0,0x0d,0x26,0x62,0xe2,0x66,0x2e,0x00,0x81,0x33,0x1e,0x13,0x31,0x90,
 0x00,0x7a,0xa3,0xe4,0xaa,0x80,0x00,0x55,0x55,0x5a,0x55,0x55,0x50,0x04,0x44,0x47,
-0xd4,0x44,0x44,0x00,0x1e,0xcd,0xed,0xdd,0xcd,0x60,0x01,0xc0,0x49,0x9c,0x5e,0xb4,
-0x1c,0x04,0x90,0x67,0x07,0x60,0x01,0xc0,0x38,0x06,0x67,0x4c,0x18,0x03,0xde,0x00,
-0x10,0xa8,0x91,0x00,0xf0,0x08,0xa0,0x0e,0x49,0x93,0xe3,0x99,0x4e,0x00,0x33,0x44,
-0x1e,0x24,0x43,0x30,0x00,0x56,0x62,0xc2,0x66,0x50,0x00,0x3e,0xaa,0x88,0x80,0x81,
-0x03,0xb5,0x88,0x88,0x88,0x80,0x00,0x4e,0x21,0x43,0xf4,0x04,0x07,0x74,0xa0,0x1c,
-0x43,0xb2,0x00,0xd2,0x6b,0x35,0x6a,0xf7,0x30,0x48,0x0a,0xb8,0x62,0x02,0x7a,0x4b,
-0x0b,0xf1,0x37,0x9a,0xaa,0xea,0xaa,0xa4,0x00,0xa7,0x77,0x7e,0x87,0x77,0xb2,0x0b,
-0x38,0x84,0xc4,0x88,0x6a,0x20,0x06,0xbb,0x6c,0x4b,0xbb,0x00,0x03,0xa9,0x79,0xcb,
-0x4a,0x98,0x00,0x48,0x49,0xb2,0xa5,0x92,0xb0,0x01,0x77,0x45,0x77,0x27,0x75,0x00,
-0x3a,0xbc,0xae,0xba,0xda,0x70,0x00,0x0a,0x50,0xc1,0x5a,0x00,0x00,0x0a,0x79,0x5c,
-0x6b,0x6b,0x10,0x0a,0xca,0xbc,0xec,0xba,0xcb,0xec,0x6d,0x20,0x24,0x79,0x06,0x4b,
-0x20,0xcb,0x85,0x0d,0x00,0xf0,0x12,0x52,0xb0,0x3b,0x00,0x9b,0xfb,0x83,0x88,0x3a,
-0x30,0x28,0x8e,0x88,0x6c,0xba,0xb8,0x00,0x35,0x55,0x30,0x0d,0x00,0xc0,0x09,0xa8,
-0xa8,0xcd,0xfd,0xdf,0x80,0x9a,0x8a,0x80,0x0d,0x00,0xa0,0x52,0x68,0x6c,0xfc,0xcb,
-0x00,0x9c,0xac,0x80,0x0d,0x80,0x26,0x10,0x48,0x0b,0x03,0x41,0x93,0x6d,0x52,0xec,
-0xb5,0x09,0x14,0x1e,0x06,0x00,0x68,0xaf,0xff,0xc0,0x1f,0xff,0xf8,0x12,0x00,0x68,
-0x7e,0xee,0xc0,0x1f,0xee,0xe4,0x12,0x00,0x68,0xee,0xef,0xc0,0x1f,0xff,0xfc,0x12,
-0x00,0x03,0x06,0x00,0x03,0xe1,0x23,0x03,0x00,0x3d,0x01,0x07,0x55,0xf0,0x00,0xaa,
-0xad,0xda,0xaa,0xa6,0x00,0x97,0x3d,0x43,0x6c,0x37,0x90,0x09,0x50,0xd0,0xa5,0x0a,
-0x5f,0x95,0x0d,0xcc,0xda,0x05,0x0d,0x00,0x02,0x91,0x9d,0xcf,0xcc,0xde,0xcd,0x90,
-0x09,0x61,0x11,0xd1,0x7b,0x11,0x0a,0x4f,0x00,0xf0,0x37,0x9d,0xec,0xd0,0xdd,0xfd,
-0xf0,0x01,0x87,0x1d,0x10,0x1b,0x0d,0x03,0xaa,0xaa,0xa9,0x22,0xb0,0xd0,0x07,0xaa,
-0xaa,0x1b,0x4a,0x0d,0x00,0xa4,0x00,0xb3,0xd5,0x80,0xd0,0x09,0xba,0xbd,0x78,0x75,
-0x0d,0x01,0x66,0x8d,0x64,0x1b,0x20,0xd0,0x0b,0x66,0xc3,0x21,0xd0,0x1c,0x00,0xdb,
-0xbe,0xa7,0x78,0x02,0xb0,0x01,0x14,0xc1,0x4d,0x10,0x69,0x00,0x00,0x2b,0x08,0x31,
-0xdc,0xf7,0x6e,0x00,0x43,0x0a,0xf1,0x28,0x88,0xf8,0x76,0xcf,0xcc,0x40,0x05,0x6e,
-0x55,0x03,0xa0,0x84,0x00,0x79,0xf9,0x6a,0xcc,0xcc,0xc2,0x0c,0x33,0x6a,0x29,0x99,
-0x96,0x00,0xcb,0xbc,0xa3,0xa1,0x15,0xa0,0x0c,0x00,0x3a,0x3d,0x99,0xba,0x00,0xbd,
-0xed,0x90,0x22,0xe2,0x10,0x00,0x1e,0x00,0x8c,0xcf,0xcc,0x23,0xbc,0xfb,0xb2,0xeb,
-0x78,0x00,0xaf,0x46,0x00,0x72,0x27,0x0d,0x4b,0x68,0x02,0xd8,0x63,0x10,0x04,0x19,
-0x32,0x10,0xda,0x3c,0x0b,0x21,0x02,0xc0,0x48,0x94,0x40,0x97,0x00,0x01,0xdd,0x21,
-0x2c,0x03,0xc3,0x16,0x00,0x21,0x00,0x00,0x20,0x00,0x11,0x4a,0x4b,0x1a,0x21,0x04,
-0xeb,0xbb,0x65,0x11,0x4a,0x79,0x2d,0x52,0x04,0xb1,0x11,0x11,0x4b,0x22,0x44,0x10,
-0xb0,0x0d,0x20,0x10,0x60,0x13,0x31,0xf0,0x26,0x63,0xd8,0xa8,0xdb,0xe3,0x07,0xd5,
-0x5d,0x8a,0x8c,0x1a,0x00,0xaa,0xb9,0xd7,0xb7,0xc0,0x74,0x00,0x5d,0x5e,0xbb,0x8c,
-0x5b,0x60,0xbb,0x14,0x7d,0x13,0xd0,0x00,0x03,0x46,0x86,0xb8,0x7b,0x62,0x00,0x99,
-0x9e,0xa9,0x9e,0xa9,0x94,0x01,0x26,0x66,0x66,0x66,0x51,0x00,0x03,0xc5,0xb9,0x46,
-0xf4,0x04,0x00,0x3d,0x77,0x77,0x79,0xb0,0x00,0x03,0xd8,0x88,0x88,0xab,0x00,0x0c,
-0xdd,0xde,0xfe,0xdd,0xdc,0xa0,0xaf,0x41,0xad,0xcc,0xcc,0xcc,0x43,0x6c,0x00,0xed,
-0x07,0x11,0xad,0xe1,0x7d,0x21,0x0a,0x50,0x61,0x92,0x80,0xac,0xbb,0xbb,0xbb,0xd0,
-0x00,0x0a,0x61,0x82,0x31,0xf2,0x05,0x00,0x7a,0xba,0xaa,0xba,0x90,0x00,0x02,0x9e,
-0x20,0x3d,0x93,0x00,0x1d,0xc6,0x00,0x00,0x05,0xcc,0x00,0x84,0x47,0x74,0x7e,0xff,
-0xea,0xdd,0xfd,0xdd,0x40,0x0a,0x92,0x80,0x04,0xeb,0xbb,0xcd,0x00,0x07,0x70,0x49,
-0x57,0x05,0x56,0x77,0x04,0xea,0xaa,0xbd,0x0d,0x00,0x26,0xeb,0xbb,0x0d,0x00,0x10,
-0x03,0xe6,0x72,0xf0,0x0e,0x07,0x70,0x07,0x80,0x69,0x00,0x3e,0xe3,0x6d,0x90,0x00,
-0x7d,0x30,0x00,0x02,0x10,0x00,0x00,0x30,0x01,0x11,0x1b,0xdd,0xfe,0xdd,0x62,0xad,
-0xca,0x10,0x40,0x01,0x90,0x96,0x02,0xeb,0xbb,0xbf,0x00,0x09,0x60,0x2b,0x61,0x01,
-0x09,0x0d,0x00,0x80,0x98,0x87,0xeb,0xbb,0xbf,0x02,0x8e,0xc6,0x30,0x2e,0x41,0x37,
-0x20,0x02,0xbc,0x5e,0x96,0x80,0x19,0xa0,0x4b,0x20,0x00,0x00,0x7d,0x60,0x78,0x3d,
-0x08,0x4f,0x0f,0x90,0xc0,0x60,0xb9,0xdd,0xfd,0xd3,0x0c,0x0b,0x0b,0x5c,0x01,0xc0,
-0xc0,0xb0,0xb4,0xdb,0xbb,0xe0,0x0c,0x0b,0x0b,0x49,0x00,0x0e,0x0d,0x00,0x20,0xd9,
-0x99,0x0d,0x00,0x30,0x4a,0x22,0x2e,0x0d,0x00,0x21,0xc8,0x88,0x0d,0x00,0xf0,0x07,
-0x33,0x3e,0x00,0xc0,0xb0,0xb2,0x78,0x78,0x60,0x49,0x00,0x0b,0x0a,0x80,0xd5,0x07,
-0x40,0x00,0xcc,0x90,0x01,0xd4,0xa0,0x00,0x00,0xa6,0x00,0x21,0x02,0x10,0xbb,0x01,
-0x70,0xd3,0xcd,0xdf,0xdd,0xd4,0x08,0xd2,0x25,0x11,0xa0,0x02,0x80,0x00,0x5e,0xbb,
-0xbc,0xe0,0x00,0x05,0x75,0xf2,0x21,0xf0,0x01,0x05,0xd1,0x5d,0xbb,0xbb,0xe0,0x1a,
-0xc2,0x05,0x90,0x00,0x1e,0x00,0x50,0x01,0x5d,0x98,0x3f,0x30,0x04,0xd5,0x90,0x31,
-0x25,0xf0,0x00,0xe2,0x3b,0xbb,0xbb,0xa0,0x08,0xe3,0x01,0x98,0x05,0xb2,0x03,0xa1,
-0x08,0xd6,0xd2,0x42,0x28,0x00,0x10,0x8f,0x08,0x80,0xde,0xac,0xde,0xfd,0xd7,0x01,
-0x11,0xc1,0x2a,0x45,0xf0,0x0e,0x3c,0xe3,0x07,0xdb,0xbb,0xf1,0x00,0x09,0xa0,0x77,
+0xd4,0x44,0x44,0x00,0x1e,0xcd,0xed,0xdd,0xcd,0x60,0x01,0xc0,0x49,0x06,0x70,0x76,
+0x00,0x1c,0x04,0x90,0x67,0x07,0x60,0x01,0xc0,0x38,0x06,0x67,0xd4,0x20,0x08,0x02,
+0xde,0x00,0x10,0xa8,0x91,0x00,0xf0,0x14,0xa0,0x0e,0x49,0x93,0xe3,0x99,0x4e,0x00,
+0x33,0x44,0x1e,0x24,0x43,0x30,0x00,0x56,0x62,0xc2,0x66,0x50,0x00,0x3e,0xaa,0xaa,
+0xaa,0xaa,0x80,0x03,0xb5,0x88,0x88,0x88,0x80,0x00,0x4e,0x2a,0x0a,0xf4,0x05,0xb3,
+0x07,0x74,0xa0,0x1c,0x43,0xb2,0x00,0xd2,0x6b,0x35,0x6a,0xf7,0x30,0x48,0x0a,0xb8,
+0x62,0x02,0x7a,0x4b,0x0b,0xf0,0x38,0x9a,0xaa,0xea,0xaa,0xa4,0x00,0xa7,0x77,0x7e,
+0x87,0x77,0xb2,0x0b,0x38,0x84,0xc4,0x88,0x6a,0x20,0x06,0xbb,0x6c,0x4b,0xbb,0x00,
+0x03,0xa9,0x79,0xcb,0x4a,0x98,0x00,0x48,0x49,0xb2,0xa5,0x92,0xb0,0x01,0x77,0x45,
+0x77,0x27,0x75,0x00,0x3a,0xbc,0xae,0xba,0xda,0x70,0x00,0x0a,0x50,0xc1,0x5a,0x00,
+0x00,0x0a,0x79,0x5c,0x6b,0x6b,0x10,0x0a,0xca,0xbc,0xec,0xba,0xcb,0x50,0x04,0x08,
+0x80,0x24,0x79,0x00,0xbb,0xfb,0xb8,0xcb,0x85,0x0d,0x00,0xf0,0x12,0x52,0xb0,0x3b,
+0x00,0x9b,0xfb,0x83,0x88,0x3a,0x30,0x28,0x8e,0x88,0x6c,0xba,0xb8,0x00,0x35,0x55,
+0x30,0x0d,0x00,0xc0,0x09,0xa8,0xa8,0xcd,0xfd,0xdf,0x80,0x9a,0x8a,0x80,0x0d,0x00,
+0xf0,0x00,0x52,0x68,0x6c,0xfc,0xcb,0x00,0x9c,0xac,0x80,0x0d,0x00,0x00,0x09,0x30,
+0x48,0x0b,0x03,0x41,0x93,0x6d,0x52,0xec,0xb5,0x09,0x14,0x1e,0x06,0x00,0x68,0xaf,
+0xff,0xc0,0x1f,0xff,0xf8,0x12,0x00,0x68,0x7e,0xee,0xc0,0x1f,0xee,0xe4,0x12,0x00,
+0x68,0xee,0xef,0xc0,0x1f,0xff,0xfc,0x12,0x00,0x03,0x06,0x00,0x01,0x01,0x00,0xa0,
+0x2e,0xee,0xef,0xfe,0xee,0xee,0x30,0x00,0x00,0x6b,0x28,0x05,0xf0,0x00,0xaa,0xad,
+0xda,0xaa,0xa6,0x00,0x97,0x3d,0x43,0x6c,0x37,0x90,0x09,0x50,0xd0,0xa5,0x0a,0x5f,
+0x95,0x0d,0xcc,0xda,0x05,0x0d,0x00,0x02,0xd0,0x9d,0xcf,0xcc,0xde,0xcd,0x90,0x09,
+0x61,0x11,0x11,0x11,0x69,0x00,0x30,0x00,0x0a,0x00,0x01,0x00,0xfc,0x86,0x9d,0xec,
+0xd0,0xdd,0xfd,0xf0,0x01,0x87,0x1d,0x10,0x1b,0x0d,0x03,0xaa,0xaa,0xa9,0x22,0xb0,
+0xd0,0x07,0xaa,0xaa,0x1b,0x4a,0x0d,0x00,0xa4,0x00,0xb3,0xd5,0x80,0xd0,0x09,0xba,
+0xbd,0x78,0x75,0x0d,0x01,0x66,0x8d,0x64,0x1b,0x20,0xd0,0x0b,0x66,0xc3,0x21,0xd0,
+0x1c,0x00,0xdb,0xbe,0xa7,0x78,0x02,0xb0,0x01,0x14,0xc1,0x4d,0x10,0x69,0x00,0x00,
+0x2b,0x08,0x31,0xdc,0x20,0x00,0x0d,0x00,0x00,0xc0,0x00,0x01,0x88,0xf8,0x76,0xcf,
+0xcc,0x40,0x05,0x6e,0x55,0x03,0xa0,0x84,0x00,0x79,0xf9,0x6a,0xcc,0xcc,0xc2,0x0c,
+0x33,0x6a,0x29,0x99,0x96,0x00,0xcb,0xbc,0xa3,0xa1,0x15,0xa0,0x0c,0x00,0x3a,0x3d,
+0x99,0xba,0x00,0xbd,0xed,0x90,0x22,0xe2,0x10,0x00,0x1e,0x00,0x8c,0xcf,0xcc,0x23,
+0xbc,0xfb,0xb2,0xa0,0xe0,0x00,0x00,0x0d,0x00,0x3c,0xcf,0xcc,0x20,0x00,0xd0,0x00,
+0x00,0xe0,0x00,0x01,0x00,0xf2,0x0f,0x0e,0x10,0x00,0x00,0x04,0xdd,0xdd,0xfe,0xdd,
+0xda,0x00,0x00,0x58,0x00,0x02,0xc0,0x00,0x00,0x01,0xf0,0x00,0x97,0x00,0x01,0xdd,
+0xdf,0xdd,0xdf,0xdd,0xd5,0x25,0x00,0x00,0x21,0x00,0x00,0x20,0x00,0xb1,0x4a,0x00,
+0x00,0x03,0xb0,0x00,0x04,0xeb,0xbb,0xbb,0xcb,0x0d,0x00,0xf0,0x59,0x04,0xb0,0x00,
+0x04,0xb1,0x11,0x11,0x4b,0x00,0x00,0x4e,0xbb,0xbb,0xbc,0xb0,0x00,0x00,0x21,0x00,
+0x60,0x00,0x00,0x00,0x3a,0x63,0xd8,0xa8,0xdb,0xe3,0x07,0xd5,0x5d,0x8a,0x8c,0x1a,
+0x00,0xaa,0xb9,0xd7,0xb7,0xc0,0x74,0x00,0x5d,0x5e,0xbb,0x8c,0x5b,0x60,0xbb,0x14,
+0x7d,0x13,0xd0,0x00,0x03,0x46,0x86,0xb8,0x7b,0x62,0x00,0x99,0x9e,0xa9,0x9e,0xa9,
+0x94,0x01,0x26,0x66,0x66,0x66,0x51,0x00,0x03,0xc5,0x55,0x55,0x7b,0x00,0x00,0x3d,
+0x77,0x77,0x79,0xb0,0x00,0x03,0xd8,0x88,0x88,0xab,0x00,0x0c,0xdd,0xde,0xfe,0xdd,
+0xdc,0x00,0x00,0x00,0x3c,0x83,0x00,0xf0,0x2c,0xad,0xcc,0xcc,0xcc,0xd0,0x00,0x0a,
+0x40,0x00,0x00,0x2d,0x00,0x00,0xad,0xbb,0xbb,0xbc,0xd0,0x00,0x0a,0x50,0x00,0x00,
+0x3d,0x00,0x00,0xac,0xbb,0xbb,0xbb,0xd0,0x00,0x0a,0x61,0x11,0x11,0x3d,0x00,0x00,
+0x7a,0xba,0xaa,0xba,0x90,0x00,0x02,0x9e,0x20,0x3d,0x93,0x00,0x1d,0xc6,0x00,0x00,
+0x05,0xcc,0x00,0x10,0x3f,0x00,0xf6,0x12,0x10,0x7e,0xff,0xea,0xdd,0xfd,0xdd,0x40,
+0x07,0x70,0x00,0x0e,0x00,0x00,0x00,0x77,0x04,0xeb,0xbb,0xcd,0x00,0x07,0x70,0x49,
+0x00,0x00,0xd0,0x00,0x77,0x04,0xea,0xaa,0xbd,0x0d,0x00,0x26,0xeb,0xbb,0x0d,0x00,
+0xf0,0x13,0x03,0xbb,0xbb,0xba,0x00,0x07,0x70,0x07,0x80,0x69,0x00,0x3e,0xe3,0x6d,
+0x90,0x00,0x7d,0x30,0x00,0x02,0x10,0x00,0x00,0x30,0x01,0x11,0x1b,0xdd,0xfe,0xdd,
+0x62,0xad,0xca,0x10,0x40,0x01,0x90,0x96,0x02,0xeb,0xbb,0xbf,0x00,0x09,0x60,0x2b,
+0x61,0x01,0x09,0x0d,0x00,0xf2,0x11,0x98,0x87,0xeb,0xbb,0xbf,0x02,0x8e,0xc6,0x4b,
+0x00,0x00,0xe0,0x37,0x20,0x02,0xbc,0xbb,0xbb,0x00,0x00,0x00,0x19,0xa0,0x4b,0x20,
+0x00,0x00,0x7d,0x60,0x00,0x3d,0x50,0x5f,0x01,0x12,0x01,0x07,0x00,0x90,0xc0,0x60,
+0xb9,0xdd,0xfd,0xd3,0x0c,0x0b,0x0b,0x5c,0x01,0xc0,0xc0,0xb0,0xb4,0xdb,0xbb,0xe0,
+0x0c,0x0b,0x0b,0x49,0x00,0x0e,0x0d,0x00,0x20,0xd9,0x99,0x0d,0x00,0x30,0x4a,0x22,
+0x2e,0x0d,0x00,0x21,0xc8,0x88,0x0d,0x00,0xf0,0x07,0x33,0x3e,0x00,0xc0,0xb0,0xb2,
+0x78,0x78,0x60,0x49,0x00,0x0b,0x0a,0x80,0xd5,0x07,0x40,0x00,0xcc,0x90,0x01,0xd4,
+0xa0,0x00,0x00,0xa6,0x00,0x21,0x02,0x10,0xbb,0x01,0xf0,0x20,0xd3,0xcd,0xdf,0xdd,
+0xd4,0x08,0xd2,0x00,0x00,0xf0,0x00,0x02,0x80,0x00,0x5e,0xbb,0xbc,0xe0,0x00,0x05,
+0x75,0x90,0x00,0x0e,0x00,0x05,0xd1,0x5d,0xbb,0xbb,0xe0,0x1a,0xc2,0x05,0x90,0x00,
+0x1e,0x00,0x50,0x01,0x5d,0xaa,0xab,0xe0,0x00,0x04,0xd5,0x0d,0x00,0xf7,0x07,0x03,
+0xe2,0x3b,0xbb,0xbb,0xa0,0x08,0xe3,0x01,0x98,0x05,0xb2,0x03,0xa1,0x08,0xd6,0x00,
+0x04,0xd4,0x00,0x00,0x10,0x35,0x02,0xf0,0x1b,0xdd,0xde,0xac,0xde,0xfd,0xd7,0x01,
+0x11,0xc1,0x00,0x69,0x00,0x00,0x3c,0xe3,0x07,0xdb,0xbb,0xf1,0x00,0x09,0xa0,0x77,
 0x00,0x0c,0x16,0xdd,0xfd,0xf9,0xca,0xaa,0xe1,0x00,0x1c,0x1c,0x76,0x00,0x0c,0x10,
-0x01,0xc5,0x67,0x1a,0x00,0x21,0x1c,0x00,0x0d,0x00,0xf8,0x03,0xc0,0x05,0xcb,0xbb,
-0xb1,0x00,0x1c,0x00,0x3d,0x40,0xb6,0x00,0x9e,0x90,0x9b,0x30,0x00,0x98,0x25,0x0d,
-0xf3,0x3b,0x00,0x00,0x35,0x84,0x02,0xdd,0xfd,0xd4,0x04,0x78,0xcb,0x10,0x0c,0x00,
-0x00,0x47,0x84,0x00,0xbc,0xcc,0xf0,0x2c,0xdd,0xcb,0x8b,0x10,0x0d,0x00,0x22,0xb5,
-0x21,0xbb,0xbb,0xf0,0x03,0x9a,0x36,0x4b,0x10,0x0d,0x00,0xa4,0xa3,0xd1,0xbc,0xbb,
-0xf0,0x1a,0x09,0x8b,0x0b,0x10,0x0d,0x00,0x00,0x2d,0x10,0x9c,0xcc,0xc0,0x00,0x4d,
-0x40,0x05,0xb0,0xa5,0x00,0xbb,0x20,0x0b,0x91,0x00,0xb4,0x01,0xab,0x00,0x12,0x11,
-0x12,0xbe,0xf6,0x38,0x9a,0xb5,0xbc,0xfb,0xb5,0x06,0xda,0xbb,0x07,0x9d,0x88,0x00,
-0x66,0x02,0xb0,0xd2,0x22,0xe0,0x04,0xbb,0xb8,0x0e,0xaa,0xae,0x00,0x22,0x22,0x21,
-0xd0,0x00,0xe0,0x19,0x9d,0xa9,0x6e,0xaa,0xae,0x00,0x35,0xa1,0x00,0xd5,0x55,0xe0,
-0x06,0x7a,0xcb,0x26,0xa6,0x95,0x00,0x8d,0xb1,0x02,0xc6,0x06,0xb0,0x0b,0x5f,0x51,
-0xa4,0x00,0x05,0x42,0xb0,0x18,0xcd,0xdc,0xcc,0xd7,0x01,0x7f,0x5e,0x00,0x7e,0x9e,
-0x20,0xc9,0x57,0xef,0x8d,0x80,0xb6,0xba,0x20,0x2b,0x00,0x00,0x08,0xfe,0x67,0x9d,
-0x30,0x08,0xa3,0x6a,0x04,0x19,0x90,0xbb,0xbb,0xc7,0xfb,0xbb,0xf0,0x0b,0x14,0xb4,
-0x0d,0x00,0x90,0xc6,0x71,0x60,0xfb,0xbb,0xf0,0x0c,0x04,0xc4,0x0d,0x00,0xf1,0x07,
-0xd3,0x70,0x73,0xcc,0xcc,0xc0,0x2b,0x01,0x99,0x07,0x90,0xb4,0x04,0x68,0xc5,0x0c,
-0x90,0x01,0xd4,0x00,0x10,0x00,0xe3,0x19,0x11,0x0d,0x4d,0x13,0xf0,0x22,0xc1,0xd2,
-0xb9,0xde,0xfd,0xd5,0x17,0x6e,0x76,0x00,0x78,0x00,0x02,0x7c,0xf8,0x76,0xec,0xcc,
-0xf0,0x04,0xae,0xb4,0x58,0x00,0x0e,0x02,0x60,0x91,0x75,0xdb,0xbb,0xf0,0x00,0x0b,
-0x68,0x58,0x00,0x0e,0x01,0x55,0xe5,0xb6,0xdb,0xbb,0xf0,0x27,0x8e,0x77,0x68,0xc3,
-0x01,0xf4,0x03,0xf8,0x03,0xbb,0xbb,0xb0,0x04,0xd1,0x8b,0x1b,0x50,0xb4,0x03,0xb1,
-0x00,0x6d,0x60,0x01,0xc5,0xfd,0x1f,0xf9,0x38,0xaa,0xaa,0xd8,0xdf,0xdd,0x30,0xd7,
-0x77,0x7d,0x00,0xc0,0x00,0x0d,0x22,0x22,0xd5,0xdc,0xcf,0x00,0xab,0xaa,0xc9,0x56,
-0x00,0xd0,0x08,0x42,0x3a,0x35,0xdb,0xbf,0x02,0xeb,0x6d,0xab,0x56,0x00,0xd0,0x07,
-0xa3,0x3b,0x65,0xdb,0xbf,0x03,0xea,0xbd,0xcc,0xa6,0x00,0xd0,0x15,0x14,0x52,0x57,
-0xbb,0xbb,0x00,0xc4,0x8a,0x2c,0x1a,0x27,0x50,0x48,0x1a,0x43,0x2c,0x60,0x0c,0x40,
-0x34,0x16,0x81,0xdd,0xdf,0x8b,0xcd,0xfc,0xc6,0x01,0x02,0xf7,0x01,0xf1,0x0e,0x5d,
-0xd2,0x07,0xfe,0xee,0xf0,0x00,0x2b,0x80,0x76,0x13,0x0e,0x06,0xde,0xfd,0xf7,0x64,
-0xa0,0xe0,0x00,0x1c,0x2a,0x76,0x4a,0x0e,0x00,0x01,0xc6,0x47,0x0d,0x00,0x40,0x00,
-0x76,0x77,0x0e,0xf1,0x10,0x30,0x2d,0x54,0x10,0xf7,0x01,0x90,0x51,0xc8,0x00,0xbe,
-0x80,0x4b,0x30,0x00,0xa3,0xd9,0x15,0x00,0x33,0x2a,0xf5,0x36,0xed,0xc9,0xcc,0xfc,
-0xc3,0x00,0x90,0x19,0x00,0x2a,0x00,0x00,0x0b,0x17,0x60,0xfd,0xdc,0xd0,0x0b,0xdc,
-0xdc,0x5c,0x06,0x0c,0x00,0xc0,0x07,0x80,0xc0,0xb0,0xc0,0x0c,0x7c,0x61,0x0c,0x0c,
-0x0c,0x00,0xd1,0x08,0xa0,0xc1,0xb0,0xc0,0x0d,0x7d,0x63,0x1c,0x48,0x0c,0x00,0xd3,
-0x07,0xc1,0x29,0x54,0x20,0x3b,0x5c,0x90,0x07,0xa0,0xa7,0x05,0x67,0x20,0x1c,0x70,
-0x00,0x6f,0x08,0xf9,0x38,0xdd,0xdd,0xdd,0xf1,0x94,0x00,0x00,0x47,0x64,0x0a,0xd9,
-0x00,0x08,0xdb,0x59,0x50,0x6b,0xa9,0x00,0x3a,0x40,0x95,0x01,0xe1,0x40,0x02,0xb6,
-0x2a,0x72,0x26,0xdd,0x03,0xbe,0xcb,0xed,0xbe,0x32,0x40,0x00,0xc2,0x09,0x50,0x97,
-0xc3,0x00,0x0e,0x00,0x95,0x07,0xdc,0x30,0x03,0xc0,0x09,0x50,0x3c,0x17,0x00,0xc4,
-0x00,0x95,0x00,0xd3,0x53,0x49,0x00,0x09,0x50,0x03,0xce,0x10,0xed,0x21,0x21,0x08,
-0x80,0xb9,0x35,0xf0,0x00,0xdd,0x50,0xe9,0xf9,0x9d,0x03,0xe5,0x3d,0x3e,0x6e,0x66,
-0xd0,0x84,0x68,0x20,0x4e,0x57,0x20,0xcc,0xcc,0x0d,0x7c,0xf8,0x1f,0x0d,0x55,0xd0,
-0xb8,0x88,0x99,0x00,0xd4,0x4d,0x0e,0x99,0x9a,0xc0,0x0d,0x88,0xd0,0xe3,0x33,0x5c,
-0x00,0xd2,0x55,0x0e,0x66,0x67,0xc0,0x0d,0x05,0xa0,0xb9,0x9a,0xa9,0x01,0xfb,0xac,
-0x17,0x90,0x4b,0x20,0x38,0x10,0x0a,0x80,0x00,0x2c,0x30,0x3a,0x1e,0xf3,0x15,0x0c,
-0xdf,0xcd,0x8a,0xdc,0xcd,0x00,0xa5,0x07,0x7a,0x30,0x1d,0x19,0xb0,0xad,0x29,0xcc,
-0xcc,0x16,0x57,0x77,0x77,0x77,0x70,0x00,0x97,0x33,0x99,0x33,0x30,0x00,0x9b,0x99,
-0xcc,0x99,0x50,0x06,0x00,0xf8,0x09,0x97,0x22,0x88,0x22,0x21,0x00,0x79,0x99,0x99,
-0xb9,0x9d,0x08,0x91,0xb0,0xc1,0x85,0x3b,0x1b,0x00,0x90,0x42,0x0b,0xd5,0x00,0x6b,
-0x50,0x30,0xdc,0xfc,0xa0,0x2a,0x50,0xf0,0x03,0x2d,0x21,0x68,0x9e,0x88,0x00,0xd9,
-0xe9,0x5b,0x54,0xd3,0xe0,0x0d,0x2d,0x21,0xb2,0x1d,0x0e,0x0d,0x00,0xf9,0x1b,0x43,
-0xd2,0xe0,0x0d,0x2d,0x22,0x8b,0xbf,0xbb,0x00,0x89,0x99,0xd5,0x62,0xb0,0x00,0x05,
-0x56,0x6d,0x0d,0x79,0x00,0x01,0x77,0x88,0xb0,0x4f,0x40,0x00,0x54,0x52,0x49,0x1b,
-0xad,0x61,0x00,0x00,0xad,0x6d,0x60,0x19,0xe2,0x6a,0x4f,0xf1,0x38,0x00,0xdc,0xfc,
-0x6d,0xbb,0xbb,0xb3,0x0c,0x0c,0x00,0xc0,0x78,0x83,0x00,0xdb,0xeb,0x3c,0x0c,0x17,
-0x60,0x0c,0x2d,0x20,0xc0,0xc1,0x76,0x00,0xd9,0xe9,0x3c,0x07,0x88,0x30,0x0c,0x2d,
-0x21,0xc6,0x94,0x99,0x10,0x8a,0xab,0x8c,0x92,0x69,0x71,0x07,0x68,0x68,0xc9,0x26,
-0x97,0x12,0x78,0x79,0x7c,0x7a,0x5b,0xa1,0x63,0x62,0x66,0xd1,0x11,0x11,0x01,0x00,
-0x7d,0x29,0xaa,0xaa,0x22,0xa3,0x10,0x54,0xa3,0x00,0xf1,0x04,0x60,0x4e,0xc2,0x00,
-0x0c,0x3d,0x31,0x7c,0x11,0xb7,0x00,0xc7,0xe7,0x99,0xcc,0xcb,0x84,0x0c,0x3d,0x14,
-0x01,0xf6,0x1f,0xd8,0xe8,0x2d,0xab,0xba,0xd0,0x0c,0x5d,0x52,0xa0,0xba,0x0b,0x00,
-0x56,0x89,0x7b,0xa9,0x9a,0xb0,0x08,0x89,0x77,0x19,0x00,0xa0,0x02,0x78,0x7a,0x66,
-0xc0,0x3d,0x00,0x63,0x52,0x76,0xc6,0xca,0xca,0x00,0x00,0x8c,0x94,0x03,0xa0,0x71,
-0x00,0xcd,0xa6,0xf1,0x36,0x57,0x00,0x5d,0xce,0x35,0x8d,0xab,0x71,0x5c,0x98,0x3b,
-0x4b,0x78,0xb2,0x56,0x88,0x3b,0x6c,0x99,0xc2,0xeb,0xbb,0xeb,0xae,0xbc,0xd2,0xb6,
-0x66,0xb5,0x55,0x55,0x52,0x4b,0x6b,0x37,0x77,0x77,0x73,0x4d,0xad,0x35,0xca,0xaa,
-0xc0,0x48,0x09,0x36,0x92,0x22,0xd0,0x4d,0xbd,0x33,0xb8,0x8b,0x80,0x48,0x09,0x30,
-0x76,0x1d,0x10,0x48,0x6c,0x4f,0xff,0xfe,0xb7,0x00,0xd5,0x25,0x00,0x97,0xc2,0x15,
-0x98,0x97,0xc2,0x20,0x03,0xeb,0x67,0xb9,0x21,0x00,0x3b,0xe0,0x34,0x10,0x02,0x38,
-0x4c,0x00,0xa0,0x49,0x00,0xe5,0x64,0xf1,0x03,0xb6,0x33,0x33,0x33,0x36,0xb0,0x0b,
-0x35,0xeb,0xbb,0xe2,0x3b,0x00,0xb3,0x59,0x00,0x0b,0x23,0x0d,0x00,0x98,0xb1,0x3b,
-0x00,0xb3,0x12,0x00,0x00,0x6c,0x70,0x4c,0x55,0xe2,0xcc,0xc8,0x7c,0xbb,0xbe,0x10,
-0xd1,0x3b,0x78,0x55,0x5d,0x10,0xd0,0x2b,0x06,0x00,0xf9,0x1f,0x7c,0xbb,0xbf,0x10,
-0xd0,0x2b,0x77,0x44,0x44,0x42,0xd0,0x2b,0x79,0x77,0x77,0x73,0xfb,0xcb,0x7d,0xcc,
-0xcc,0xc0,0xe2,0x21,0x32,0x21,0x60,0xf0,0x40,0x03,0x8c,0x48,0x95,0xe0,0x00,0x0a,
-0x3a,0x27,0x03,0xc0,0x00,0x07,0x02,0x00,0xbd,0x60,0x6d,0x68,0x03,0xad,0x2e,0xf0,
-0x1a,0x0a,0x00,0xe0,0x09,0x10,0x00,0x08,0xd1,0x2f,0x24,0xf3,0x00,0x08,0xa4,0xac,
-0xfc,0xd3,0xb8,0x00,0x60,0x3c,0x2e,0x2c,0x40,0x60,0x02,0x9b,0x3c,0x30,0x1c,0x92,
-0x03,0xc4,0x3d,0xdc,0xce,0x55,0xd4,0x02,0xab,0x63,0x2f,0x60,0x41,0x14,0x04,0xbd,
-0xe2,0x99,0xc3,0x9b,0x78,0xe8,0x10,0x00,0x9d,0x95,0x00,0x01,0x8c,0x45,0x76,0xf0,
-0x0e,0xcb,0xdb,0xd4,0x00,0xd8,0x00,0x0c,0x68,0x5a,0x40,0x0d,0x4a,0x00,0xc8,0x89,
-0x84,0x00,0xd0,0x40,0x0c,0x6b,0x8b,0x9e,0xef,0xee,0x60,0x33,0xb6,0x31,0xa8,0xcc,
-0x50,0xce,0xdc,0x30,0x4f,0x30,0x76,0x0b,0xf9,0x0c,0x08,0x97,0x00,0x2c,0xde,0xdc,
-0x50,0xc0,0xb0,0x00,0x62,0x23,0x50,0x5a,0x09,0x50,0x1b,0x45,0xa7,0x4d,0x20,0x2d,
-0x15,0x53,0x56,0x09,0x80,0xce,0x8c,0x00,0x22,0x43,0xf0,0x07,0xeb,0xe2,0x01,0xd0,
-0x00,0x0c,0x6a,0x7a,0x20,0x1d,0x00,0x00,0xb7,0xa8,0x92,0x01,0xfe,0xe9,0x0d,0x8d,
-0x8d,0x20,0x33,0xb5,0x20,0xe2,0x20,0x1a,0x00,0xf3,0x17,0xcf,0xcc,0x3b,0xcf,0xbb,
-0x00,0x00,0xe2,0x33,0xe3,0x33,0xe0,0x3d,0xcb,0xa9,0x5d,0x00,0x0e,0x00,0x75,0x35,
-0xb2,0xd0,0x00,0xe0,0x0b,0x64,0xa3,0x7f,0xbb,0xbe,0x04,0x51,0x20,0x01,0xe2,0x22,
-0xd0,0x31,0xc4,0x00,0x0c,0x34,0x00,0x7f,0xc4,0xf0,0x15,0x39,0x2a,0x22,0x74,0x00,
-0xbf,0xbd,0x8a,0x69,0xbc,0x20,0x02,0xa0,0xc0,0xd0,0xd0,0xb2,0x02,0xd6,0xb8,0x0d,
-0x1f,0xb8,0xd3,0x12,0x35,0x00,0x50,0x14,0x42,0x00,0x06,0xec,0xcc,0xcc,0xd8,0xb4,
-0x53,0x00,0x7d,0x2a,0x20,0x0b,0xdc,0x0d,0x00,0x21,0x04,0xe0,0x0d,0x00,0x10,0xc3,
-0xab,0x2d,0x0d,0xf7,0x08,0x20,0x1e,0x10,0x4a,0x28,0xf1,0x00,0xcc,0xed,0xcc,0xcc,
-0x10,0x11,0x89,0x11,0x1b,0x81,0x10,0x00,0x00,0xb8,0x09,0xf9,0x0d,0x10,0xcf,0x01,
-0x21,0xc0,0x69,0xe9,0x49,0xeb,0x75,0x12,0xc9,0x83,0x00,0x03,0x77,0xa1,0xad,0x24,
-0x11,0x77,0xd8,0x63,0x01,0x95,0xc7,0x10,0x40,0x0d,0x00,0x11,0x06,0xdd,0x77,0x11,
-0x01,0x7c,0x7d,0x08,0xd0,0x5a,0x20,0x16,0xaf,0x72,0xc6,0x10,0x7c,0x88,0x4a,0x20,
-0x06,0xef,0x8f,0x4a,0x00,0x03,0xb7,0x20,0xfe,0xac,0x07,0x00,0x90,0xd8,0x30,0x09,
-0xf0,0x00,0x0b,0xf1,0x00,0x00,0x07,0x00,0x1b,0xe0,0x07,0x00,0xf0,0x05,0x3d,0xff,
-0xf0,0x03,0x6c,0xe0,0x00,0xcf,0xff,0xf0,0xaf,0xff,0xe0,0x00,0x5f,0xff,0x80,0xdf,
-0xff,0xd0,0x4f,0x09,0x31,0x2a,0xda,0x20,0x4f,0x2c,0x00,0xcc,0x87,0x90,0x40,0x8f,
-0xdf,0xb7,0x77,0x77,0xfe,0xdf,0xd0,0x95,0x12,0xf0,0x07,0x50,0xde,0x8e,0x70,0x00,
-0x00,0xdb,0x8e,0xe5,0xdb,0x77,0x77,0x7f,0x95,0xed,0x1c,0xeb,0xbb,0xbb,0xf6,0x1d,
-0xfc,0xb1,0xaa,0x20,0xdc,0xfd,0x33,0xb4,0xa0,0xd5,0x0d,0xfa,0xe9,0x33,0x33,0x3e,
-0xca,0xfc,0x3d,0x29,0x82,0x30,0x3c,0x35,0x52,0x19,0x6d,0x31,0x3f,0xff,0xc6,0x39,
-0x82,0x20,0xfc,0x6f,0x05,0x00,0x80,0xee,0x94,0xee,0xee,0xee,0xec,0x34,0x42,0xf6,
-0x02,0x0f,0x1a,0x00,0x14,0x30,0xfd,0xff,0xa4,0x06,0x00,0x02,0x8c,0xb9,0x02,0xc7,
-0x93,0x12,0xfc,0x46,0x53,0x21,0x90,0x50,0x06,0x00,0x20,0xaf,0xc0,0x06,0x00,0xa0,
-0x0c,0xff,0xc0,0x2e,0xff,0x90,0x00,0x1c,0xff,0xce,0x4a,0x89,0x12,0x1c,0x84,0xcd,
-0x11,0x1c,0x06,0x00,0x00,0x6d,0x2a,0x03,0x74,0x0e,0xf0,0x06,0xf5,0x00,0x06,0xf8,
-0xdf,0xf5,0x06,0xff,0xc2,0xef,0xf9,0xff,0xd1,0x02,0xef,0xff,0xd1,0x00,0x08,0xff,
-0xf7,0xb2,0x91,0xe0,0xf5,0x06,0xff,0xe4,0xef,0xf5,0xef,0xe1,0x02,0xef,0xd4,0xa1,
-0x00,0x02,0x3e,0xa7,0x11,0x50,0x45,0x57,0xf0,0x1e,0xbf,0x40,0x30,0x00,0x01,0xcf,
-0x1b,0xf4,0x7f,0x80,0x00,0xbf,0xd0,0xbf,0x45,0xff,0x40,0x4f,0xe1,0x0b,0xf4,0x07,
-0xfd,0x09,0xf8,0x00,0xbf,0x40,0x0e,0xf2,0xcf,0x40,0x0b,0xf4,0x00,0xbf,0x4b,0xf4,
-0x00,0x9e,0x30,0x0b,0xf4,0x9f,0x80,0x10,0x4c,0x10,0x23,0x8a,0xb5,0xf1,0x05,0x8f,
-0xc0,0x0a,0xfe,0x40,0x01,0x8f,0xf4,0x00,0x0c,0xff,0xed,0xff,0xf6,0x00,0x00,0x07,
-0xef,0xff,0xc3,0x7a,0x17,0x17,0x10,0xc0,0x2a,0x20,0xff,0xf3,0xc2,0x01,0xb2,0x3f,
-0xff,0x70,0x11,0x00,0x7f,0xbf,0xff,0xff,0xce,0xb0,0x43,0x9e,0xf1,0x14,0x53,0xff,
-0xff,0x82,0x5f,0xff,0xf7,0x03,0xff,0xc0,0x00,0x7f,0xf8,0x00,0x3f,0xfa,0x00,0x06,
-0xff,0x70,0x2c,0xff,0xf4,0x01,0xdf,0xfe,0x42,0xff,0xff,0xfe,0xff,0xff,0xf6,0x0a,
-0xff,0x10,0x01,0x60,0x05,0x07,0xff,0xfa,0x13,0x20,0x53,0xc1,0x01,0xca,0x08,0x22,
-0x46,0x50,0xbc,0x84,0x30,0x00,0x36,0x20,0xa8,0x4e,0x30,0xfc,0x1a,0xf6,0x67,0x46,
-0xf1,0x15,0xe9,0xfe,0xcf,0x60,0x00,0x00,0xaf,0xc3,0x64,0xff,0xf6,0x00,0x01,0xcf,
-0xa3,0xef,0xa3,0xdf,0x90,0x03,0xef,0x75,0xff,0xff,0xc3,0xcf,0xb0,0xdf,0x48,0xff,
-0xff,0xff,0xe3,0x9f,0x72,0x27,0x30,0xb9,0xd0,0x50,0x00,0x9f,0xff,0xcb,0xef,0xff,
-0x30,0x00,0x09,0xff,0xf1,0x07,0x9a,0x00,0xd0,0x9f,0xff,0x10,0x7f,0xff,0x30,0x00,
-0x07,0xff,0xe0,0x06,0xff,0xf2,0xd4,0x09,0x13,0x54,0xaf,0xab,0x11,0x10,0x66,0x2e,
-0x2d,0xff,0x20,0x07,0x00,0x50,0x47,0x8f,0xff,0x87,0x40,0x39,0x00,0x01,0x7c,0x01,
-0x40,0x0a,0xff,0xff,0xfa,0x1c,0x00,0x10,0xaf,0xce,0xcd,0xf2,0x03,0x46,0x66,0x3a,
-0xfa,0x36,0x66,0x50,0xff,0xff,0xf4,0x54,0xff,0xff,0xf2,0xff,0xff,0xff,0xcf,0x07,
-0x00,0x71,0xff,0xf3,0xb8,0xf2,0x9b,0xbb,0xbb,0x35,0x36,0x21,0x08,0xaa,0xb8,0x05,
-0x11,0x08,0x8f,0x00,0x30,0x00,0x03,0xfb,0x58,0x00,0x21,0xd0,0x00,0x91,0x22,0x41,
-0x6f,0x80,0x8f,0x60,0x48,0x79,0x10,0x3f,0xfa,0x95,0xc1,0x9e,0xee,0xf9,0xff,0xff,
-0xfc,0x44,0x5f,0xff,0xff,0xaf,0xff,0x01,0x00,0x22,0xfa,0xff,0x01,0x00,0x12,0x9a,
-0x07,0x00,0x10,0xf5,0x19,0x03,0x00,0xab,0x41,0xf0,0x0c,0x6d,0xff,0xfb,0x40,0xcf,
-0x00,0xbf,0xfd,0xbd,0xff,0xac,0xf0,0xbf,0xd3,0x00,0x03,0xcf,0xff,0x4f,0xd1,0x00,
-0x07,0xaa,0xff,0xf9,0xf5,0x00,0x4b,0xcd,0x11,0x01,0x73,0x06,0x03,0x77,0x07,0x01,
-0xae,0x00,0xf0,0x0b,0x4f,0x9f,0xff,0xab,0x70,0x00,0x0d,0xf4,0xff,0xfb,0x20,0x00,
-0x3c,0xfb,0x0f,0xcb,0xff,0xca,0xcf,0xfc,0x10,0xfc,0x05,0xcf,0xff,0xd7,0x0d,0x22,
-0x23,0x12,0x10,0x7c,0xc1,0xb4,0x06,0xf7,0x01,0x16,0xff,0x8f,0xff,0xff,0xf8,0xff,
-0xff,0x07,0x00,0xa0,0x8a,0xcc,0xef,0xf8,0x00,0x02,0xef,0x80,0x00,0x02,0x02,0xc8,
-0x03,0x76,0x24,0x80,0x00,0x6f,0x70,0x00,0x01,0x16,0xff,0x80,0x9c,0x98,0x70,0x82,
-0xb1,0xff,0xff,0xff,0x80,0xc9,0x05,0x00,0xa0,0x9b,0xff,0xff,0xff,0x82,0xf3,0xbd,
-0xdf,0xff,0x80,0x14,0x27,0x10,0x80,0x19,0x35,0x1a,0x70,0xeb,0x28,0x01,0x44,0x0b,
-0x12,0xc2,0x6d,0x00,0xa0,0x0b,0xe1,0x00,0x00,0x06,0xf7,0x00,0xb7,0x0c,0xb0,0x4b,
-0x00,0xb0,0x05,0xf5,0x2f,0x3f,0xff,0xff,0xf8,0x2c,0x17,0xd0,0xb8,0x4b,0x00,0xb1,
-0xba,0x2f,0x18,0xbf,0xff,0xff,0xf8,0x09,0xb1,0xf2,0x7b,0x55,0x00,0x30,0x5e,0x0a,
-0x9a,0x89,0x00,0x30,0x2e,0x80,0xe4,0x8d,0x00,0x40,0x0c,0xa0,0x8d,0x00,0x91,0x00,
-0x31,0x10,0x7f,0x30,0x5f,0x00,0x24,0x4f,0x40,0x36,0x04,0x11,0x9f,0x29,0x01,0x32,
-0x9f,0xf9,0xbf,0xd3,0x85,0x20,0xdf,0xff,0x4d,0x00,0x90,0x0d,0xff,0xf8,0xaf,0xff,
-0xff,0x9b,0xff,0xf8,0x1d,0x01,0x80,0x6d,0xf8,0x00,0x00,0xcf,0xff,0x40,0x17,0xc9,
-0x01,0x11,0xa0,0xc8,0x01,0x11,0xfd,0xd0,0xa6,0x12,0xfa,0x72,0x01,0x02,0x9d,0xd1,
-0x00,0x4f,0x26,0x20,0x0c,0xfb,0x1d,0x70,0x10,0xf3,0x7c,0x74,0xb0,0xc0,0x00,0x8f,
-0xff,0xff,0x70,0x2f,0xff,0xff,0xff,0x2a,0x0d,0x7b,0xf0,0x0b,0xef,0xef,0xff,0xff,
-0xdf,0xb7,0xff,0xff,0xfe,0xce,0x2d,0xff,0xff,0xb5,0xfc,0x36,0xff,0xf3,0x07,0xff,
-0xff,0xf6,0x00,0x02,0x89,0x72,0xd5,0x6c,0xf0,0x0a,0x02,0x42,0xfa,0x00,0x03,0xef,
-0x2f,0xa0,0x04,0xff,0xf2,0xfa,0x05,0xff,0xff,0x2f,0xa6,0xff,0xff,0xf2,0xfe,0xff,
-0xff,0xff,0x2f,0xff,0x01,0xf1,0x04,0xfc,0xdf,0xff,0xff,0x2f,0xa1,0xdf,0xff,0xf2,
-0xfa,0x01,0xcf,0xff,0x2f,0xa0,0x00,0xbf,0xf2,0xf9,0x17,0xd6,0x00,0x24,0x5d,0x01,
-0x06,0x00,0x22,0xef,0xc3,0xb5,0x01,0x12,0x91,0x83,0x4f,0x11,0x70,0x06,0x00,0x31,
-0xfd,0x40,0x00,0x9d,0x00,0x21,0x10,0xff,0x44,0x02,0x11,0xff,0x61,0x02,0x01,0xab,
-0x7b,0x11,0x50,0xe1,0x00,0x00,0x1e,0x00,0x10,0xb2,0x2a,0x00,0x00,0xae,0x10,0x02,
-0x98,0x98,0x21,0x48,0x10,0x51,0x14,0xff,0x02,0x66,0x10,0x16,0x66,0x30,0xef,0xff,
-0xc0,0xaf,0xff,0xf1,0xff,0xff,0xe0,0xbf,0xff,0xf2,0x06,0x00,0x19,0xb0,0xd0,0xbf,
-0xff,0xf2,0xaf,0xff,0x80,0x6e,0xff,0xc0,0x26,0x11,0x55,0x21,0x50,0xef,0x2b,0x71,
-0x01,0x7e,0x00,0x1f,0xf6,0x06,0x00,0x1c,0x11,0xf5,0xd2,0x02,0xf3,0x09,0xd1,0x05,
-0x00,0x00,0x06,0x45,0xfb,0x00,0x01,0xfc,0x6f,0xfc,0x10,0x1f,0xc6,0xff,0xfd,0x11,
-0xfc,0x6f,0xff,0xfd,0x3f,0xc6,0x12,0x05,0x00,0x1d,0x05,0xf5,0x04,0xfa,0xfc,0x6f,
-0xff,0xf7,0x1f,0xc6,0xff,0xf6,0x01,0xfc,0x6f,0xf5,0x00,0x1f,0xc3,0xe4,0x00,0x00,
-0x93,0x67,0x21,0x52,0x00,0xb0,0x01,0x11,0xe2,0xf2,0xb0,0x10,0xff,0x2b,0x12,0x20,
-0x8f,0xff,0x07,0x00,0x00,0x3b,0x00,0x11,0xc0,0xd5,0x55,0x31,0xff,0xb0,0x0e,0x6f,
-0x00,0x20,0x40,0x8e,0x23,0x34,0x22,0xc1,0x02,0x83,0x08,0x02,0x82,0x00,0x12,0x0f,
-0xc8,0xa2,0x20,0xcf,0xff,0x1e,0x04,0x02,0x86,0xa5,0x00,0x2f,0x71,0x91,0xbf,0xf2,
-0x00,0x0b,0xff,0x30,0x00,0xbf,0xf3,0x07,0x00,0xb4,0x2f,0xf9,0x00,0x00,0x06,0xff,
-0x80,0x00,0x00,0x6f,0xf8,0x09,0x00,0x41,0xf4,0x00,0x00,0x05,0x23,0xcb,0x10,0x1e,
-0xb7,0xae,0x40,0xfc,0x00,0x00,0x02,0xbe,0x87,0x14,0x2e,0x09,0x00,0x20,0x7f,0xf4,
-0xc8,0x04,0x31,0x00,0x6f,0xf7,0x07,0x00,0x21,0x2f,0xf7,0xfd,0x31,0x00,0xcb,0x12,
-0x01,0x94,0x02,0x2f,0x8f,0xe0,0x06,0x00,0x01,0x15,0xdf,0xc1,0x01,0x8e,0xff,0xf5,
-0x36,0x66,0xbf,0xf6,0x66,0x50,0x2a,0x00,0x01,0x42,0x66,0x01,0x84,0x52,0x19,0x11,
-0x30,0x00,0x10,0x35,0x3a,0x5e,0x70,0x40,0x00,0x00,0x5a,0xcd,0xc8,0x20,0x8c,0xd2,
-0xf0,0x2a,0xd7,0x69,0xff,0x90,0x00,0x04,0xff,0xa0,0x01,0x02,0xef,0xc1,0x02,0xff,
-0xf1,0x02,0xfc,0x16,0xff,0xb0,0xcf,0xfb,0x05,0xaf,0xf9,0x1f,0xff,0x6d,0xff,0xb1,
-0xff,0xff,0xb1,0xff,0xf7,0x4f,0xfe,0x0b,0xff,0xf5,0x5f,0xfc,0x00,0x6f,0xf9,0x08,
-0xa5,0x1d,0xfd,0x20,0x00,0x5e,0xfb,0x53,0x6e,0xfb,0x10,0x5a,0x74,0x23,0xfe,0xa4,
-0x55,0x34,0x00,0x4a,0x0b,0x04,0x7f,0x22,0x60,0x3e,0xf9,0x05,0xac,0xdb,0x71,0x14,
-0x0a,0x60,0xff,0xfd,0x76,0xaf,0xf7,0x00,0xbb,0x04,0xf0,0x20,0x31,0x30,0x4f,0xfa,
-0x00,0x00,0x32,0x04,0xef,0xbf,0xc0,0x9f,0xf8,0x00,0x0e,0xf5,0x02,0xcf,0xff,0x64,
-0xff,0xf3,0x01,0xff,0xf6,0x00,0x9f,0xf8,0x4f,0xff,0x40,0x06,0xff,0xc0,0x00,0x6f,
-0xeb,0xff,0xa0,0x00,0x09,0xff,0x60,0x00,0x3e,0xff,0xc0,0x46,0xb0,0x30,0xa4,0x30,
-0x1b,0x65,0x00,0x73,0x02,0x8d,0xff,0x80,0x08,0xfe,0x30,0xfc,0x03,0x27,0xef,0x20,
-0xf5,0xa0,0x23,0x01,0x40,0x3c,0x09,0x03,0xa4,0x22,0x22,0x7f,0xff,0xff,0xc5,0x12,
-0xff,0x99,0x03,0x12,0x0a,0x98,0x73,0x51,0x00,0x3f,0xf5,0x1a,0xfd,0x4c,0x08,0x30,
-0xf4,0x0a,0xff,0x30,0xbf,0x50,0xff,0xf5,0x0a,0xff,0xe1,0xac,0x7e,0x40,0xf6,0x0b,
-0xff,0xf9,0x04,0x02,0xf2,0x08,0xfd,0x8f,0xff,0xff,0x20,0x02,0xff,0xff,0xf3,0x09,
-0xff,0xff,0xb0,0x0a,0xff,0xff,0xf7,0x1c,0xff,0xff,0xf4,0x0e,0xff,0xd7,0x89,0x30,
-0x04,0x9a,0xaa,0x01,0x00,0x11,0x91,0x5a,0x00,0x12,0x70,0x86,0xb0,0x50,0xa0,0xef,
-0xfa,0x00,0x05,0x66,0x05,0xf0,0x02,0xf9,0x04,0xff,0xff,0xfb,0x11,0x3f,0xa4,0xff,
-0x84,0xfc,0x00,0x00,0x33,0xff,0x90,0x19,0xd5,0x01,0xd0,0xa2,0x01,0x70,0x00,0x02,
-0xef,0xa4,0xf6,0x3f,0xa0,0xef,0xff,0xb0,0x8d,0x05,0x00,0xdd,0x00,0x20,0xff,0xfb,
-0x51,0x05,0x23,0x14,0xfc,0xbd,0x70,0x04,0xd6,0x04,0x20,0x5f,0xa0,0xcd,0x04,0x01,
-0x11,0x06,0xf0,0x09,0x5f,0xfa,0xff,0xa0,0x00,0x05,0xff,0x90,0x3f,0xfa,0x00,0x4f,
-0xf9,0x00,0x03,0xff,0xa0,0xbf,0x90,0x00,0x00,0x3f,0xf1,0x15,0x34,0x0a,0x02,0xa9,
-0x69,0xf0,0x09,0x10,0x9f,0x50,0x00,0x00,0x1d,0xe1,0x8f,0xf5,0x00,0x01,0xdf,0xd0,
-0x08,0xff,0x50,0x1d,0xfd,0x10,0x00,0x8f,0xf6,0xdf,0xd1,0x61,0x01,0x20,0xfd,0x10,
-0xf8,0x01,0x02,0xea,0xd2,0x11,0x10,0xb3,0xc0,0x03,0x14,0x01,0x20,0xfd,0x18,0xe2,
-0x03,0x00,0x1a,0xd7,0xf0,0x02,0x4a,0xaa,0xaa,0xfb,0x00,0x0c,0xda,0xf7,0xf4,0x00,
-0x00,0x0e,0xb0,0x00,0x00,0x9f,0x11,0x09,0x48,0x53,0x00,0x00,0x09,0xf1,0x00,0x11,
-0x00,0x00,0xc5,0x59,0xb0,0xeb,0x9d,0x00,0x09,0xf9,0x99,0x99,0x4d,0xff,0xff,0xa0,
-0x64,0xda,0x43,0xfb,0x1d,0xff,0xa0,0x4c,0x0a,0x07,0x6c,0x2c,0x32,0x6b,0xcc,0xc7,
-0xb3,0xc8,0x32,0xf8,0x22,0x22,0x54,0x04,0x00,0xb8,0x06,0x0f,0x01,0x00,0x11,0x05,
-0x26,0x05,0x03,0x5f,0xc7,0x12,0x08,0xbb,0x01,0x31,0x8f,0xff,0x80,0x27,0x02,0x01,
-0x46,0x8b,0x12,0x7f,0xb8,0x04,0x5f,0x69,0x9f,0xff,0x99,0x60,0x52,0x07,0x03,0x50,
-0x46,0x66,0x2f,0xff,0x26,0x36,0x07,0x30,0x46,0x76,0x4f,0x69,0x04,0x2e,0xfc,0xbc,
-0x36,0x07,0x13,0x00,0x63,0xd5,0x00,0x10,0x02,0x12,0xfa,0x98,0xb2,0x11,0xff,0xa7,
-0x02,0x02,0x32,0x09,0x12,0x0c,0x15,0x00,0x32,0x00,0xbf,0xf6,0x07,0x00,0x00,0x4c,
-0x22,0x00,0xb1,0x03,0x00,0xfb,0x31,0x90,0x4f,0xfd,0x00,0x03,0xaf,0xf8,0x07,0xff,
-0xf2,0xd0,0x80,0x31,0xef,0xfe,0x30,0x3a,0xc1,0x11,0xc2,0xa0,0x00,0x01,0xfb,0xd5,
-0x21,0x98,0x62,0x67,0x01,0x10,0x84,0xc5,0x01,0xf1,0x05,0x8f,0xff,0x60,0x00,0xaf,
-0xf3,0xec,0x2e,0xc0,0x1c,0xff,0xa0,0xde,0x9f,0xd1,0xdf,0xfa,0x00,0x3e,0xff,0x80,
-0x02,0x11,0x2d,0x61,0x00,0x10,0x1c,0x4e,0x05,0x11,0x2d,0x00,0xa7,0xf0,0x09,0xcf,
-0xaf,0xd2,0xef,0xf6,0x00,0xfb,0x0d,0xd0,0x2e,0xff,0x60,0xbf,0xef,0x80,0x02,0xef,
-0xf3,0x19,0xc8,0x00,0x00,0x16,0x40,0x6c,0xcf,0x11,0x12,0x9e,0xc1,0x20,0x3f,0x40,
-0xf3,0xa5,0xa1,0x3f,0xf2,0xdf,0x6c,0xff,0xff,0x53,0x31,0xff,0x7c,0xfe,0x04,0x0f,
-0x06,0x00,0x0b,0x10,0x7b,0xd3,0x03,0x20,0xff,0xc2,0x1b,0x4e,0x02,0xb0,0xd0,0x11,
-0x8a,0xf2,0x58,0x10,0x49,0xd3,0x70,0x12,0x00,0xc4,0x06,0x10,0xfa,0x02,0x01,0x20,
-0x80,0xfa,0x1c,0x06,0x11,0xf3,0x06,0x00,0x72,0xf5,0xfe,0xaa,0xaa,0xaa,0xff,0xf5,
-0x0f,0x04,0x40,0xff,0xff,0x80,0x4f,0x06,0x00,0x20,0x10,0x0c,0x06,0x00,0x20,0x50,
-0x1e,0x06,0x00,0x51,0xfb,0xef,0xff,0xf5,0x9f,0x70,0x05,0x10,0xcd,0x83,0x36,0x24,
-0xd4,0xef,0x3d,0x08,0x05,0x01,0x00,0x20,0xbc,0xcc,0x3c,0x1a,0x1f,0xff,0x18,0x00,
-0x10,0x11,0x6b,0x43,0xd0,0x12,0x6f,0xfe,0x01,0x02,0x5e,0x07,0x11,0x95,0x0e,0x00,
-0x70,0x65,0xf9,0x3d,0xff,0xff,0xfd,0x39,0x03,0x00,0x20,0xf9,0x3d,0x10,0x00,0x11,
-0xa4,0x17,0x00,0x2c,0xb7,0xbf,0x2b,0x02,0x30,0x55,0x55,0x20,0x65,0x77,0x10,0x90,
-0x72,0x03,0x10,0x40,0x84,0x01,0x00,0xda,0x03,0x40,0xfc,0x44,0x40,0x0c,0xd2,0x0b,
-0x12,0x0e,0xa0,0x07,0x01,0x74,0x82,0x20,0x8f,0xf6,0xc9,0x01,0x10,0xc0,0xc3,0x06,
-0x00,0xa9,0x8d,0x10,0xfa,0xf4,0x01,0x25,0xf1,0x00,0x6b,0xd2,0x00,0xd5,0x12,0xb2,
-0x6e,0xf7,0x54,0x00,0x00,0xff,0xf9,0x8f,0xff,0x10,0x00,0x6f,0xcb,0xc0,0xff,0xfa,
-0x24,0x44,0x01,0x00,0xff,0xf4,0xef,0xff,0x3e,0x20,0x9b,0x06,0x20,0x3f,0xe2,0x06,
-0x00,0x21,0x43,0x31,0xa7,0x06,0x18,0xf6,0x06,0x00,0x40,0x23,0x30,0xff,0xff,0xb2,
-0x0a,0x02,0x06,0x00,0x12,0x7a,0xb6,0x84,0x02,0xfa,0x09,0x01,0x82,0x27,0x10,0xef,
-0x51,0x4f,0x10,0x8f,0x2f,0xb7,0x11,0x01,0xdc,0x9f,0x11,0x04,0xec,0x9c,0x11,0x07,
-0x92,0x0a,0x11,0x09,0x04,0xd2,0x11,0x0d,0xcf,0xa7,0x20,0x7f,0xff,0x54,0xb7,0x02,
-0x0b,0x07,0x22,0x13,0x33,0x19,0x8d,0x21,0xcf,0xf2,0xc4,0x0b,0x51,0x50,0x00,0x00,
-0x5a,0xaa,0x01,0x00,0x12,0x2f,0x03,0x01,0xf0,0x1a,0xf9,0xfa,0x0d,0x01,0xb0,0xd0,
-0xa2,0x0f,0xaf,0xeb,0xfb,0xcf,0xbf,0xbe,0xcb,0xfa,0xff,0xe1,0x98,0x1c,0x1c,0x15,
-0xff,0xaf,0xfd,0x08,0x70,0xb0,0xb0,0x3f,0xfa,0xff,0xdf,0xdd,0xdd,0xdd,0xfd,0xdf,
-0xaf,0xa0,0xd0,0x82,0x28,0x87,0xfa,0xfe,0xaf,0xaa,0xaa,0xaa,0xeb,0xaf,0xed,0x09,
-0x12,0x00,0x29,0x23,0x00,0x9e,0x00,0x10,0xd0,0x09,0x03,0x11,0x8f,0xf6,0xd9,0x11,
-0x29,0xbe,0x5c,0x21,0x03,0xbf,0x18,0xa2,0x12,0x3c,0x8a,0xa0,0x13,0x0f,0xb9,0x83,
-0x12,0x9e,0x10,0x08,0x01,0xb7,0x83,0x21,0xf1,0x00,0x9c,0x04,0x12,0xf9,0xa9,0x04,
-0x02,0x7f,0x03,0x13,0x05,0x0f,0x04,0x23,0x4f,0xf3,0x57,0x73,0x00,0xf6,0x1d,0x20,
-0x44,0x43,0x4f,0x01,0x20,0xfb,0x8a,0x05,0x00,0xc1,0x8f,0xa0,0xff,0xff,0xfb,0x7f,
-0xf8,0xff,0xff,0xfc,0x11,0x11,0xaa,0x0c,0x0f,0x05,0x00,0x10,0x00,0x10,0x64,0x10,
-0xd8,0x9f,0x01,0x12,0x54,0x26,0x14,0xf0,0x02,0xff,0xff,0xff,0xd8,0x10,0x00,0x04,
-0xef,0xff,0xdb,0xbc,0xff,0xff,0x70,0x08,0xff,0xd6,0xb3,0xa2,0xf0,0x0b,0xff,0xb0,
-0xbf,0x70,0x00,0x13,0x32,0x00,0x05,0xed,0x10,0x30,0x06,0xdf,0xff,0xfe,0x80,0x01,
-0x10,0x00,0x0b,0xff,0xfc,0xce,0xff,0xd2,0x82,0xae,0x31,0x60,0x00,0x04,0x58,0x80,
-0x42,0x10,0x03,0x40,0x00,0x6a,0x15,0x13,0xff,0xd9,0x23,0x23,0x6f,0xfa,0x30,0x13,
-0x10,0xac,0x72,0x04,0x03,0x19,0x0b,0x31,0xd2,0x0f,0xea,0x68,0x01,0xc1,0xcf,0x90,
-0xfa,0x48,0x88,0x88,0x88,0x88,0x65,0xff,0x1f,0xa9,0x3d,0x0c,0x32,0x1a,0xf1,0xfa,
-0xfa,0x02,0x30,0xaf,0x1f,0xa5,0x66,0x10,0x41,0x98,0x5f,0xf1,0xfd,0x33,0x7c,0x33,
-0x9b,0xfa,0x0b,0x98,0x02,0x06,0xab,0x61,0x0f,0x4d,0x00,0x03,0x22,0x30,0x05,0x4d,
-0x00,0x23,0xf7,0x00,0x4d,0x00,0x22,0x70,0x01,0x4d,0x00,0x2f,0x94,0x00,0x4d,0x00,
-0x1e,0x22,0x00,0x00,0x4d,0x00,0x23,0xf0,0x00,0x4d,0x00,0x22,0x00,0x00,0x4d,0x00,
-0x2f,0x90,0x00,0x4d,0x00,0x1d,0x23,0x85,0x00,0x4d,0x00,0x22,0xa0,0x00,0x4d,0x00,
-0x23,0xfa,0x00,0x4d,0x00,0x2f,0x60,0x00,0x4d,0x00,0x1d,0x22,0x00,0x00,0x4d,0x00,
-0x01,0x0c,0x02,0x00,0x4d,0x00,0x02,0x62,0x01,0x13,0xaf,0x11,0x00,0x0f,0x4d,0x00,
-0x09,0x01,0x5e,0xa7,0x13,0x50,0x95,0x02,0x12,0xfc,0xaf,0x2a,0x11,0xd0,0x11,0x00,
-0x31,0x64,0x00,0xa5,0x56,0x09,0xf0,0x04,0xbf,0xf6,0x4e,0x21,0x11,0x11,0x17,0xd3,
-0x0f,0xff,0xec,0xce,0xec,0xcc,0xcc,0xef,0xe1,0x7f,0xe3,0x66,0x18,0x11,0x06,0x30,
-0x6d,0x23,0x97,0x0a,0xb8,0x55,0x14,0xcc,0x98,0x06,0x2a,0x2f,0xfa,0xb1,0x27,0x10,
-0x10,0x89,0x00,0xf0,0x2e,0xff,0xe8,0x00,0x00,0xdf,0xf8,0xcf,0xf8,0x00,0x7f,0xff,
-0x81,0xdf,0xf1,0x0c,0xfa,0xf8,0x52,0xdf,0x60,0xff,0x64,0x78,0x3a,0xf8,0x0f,0xff,
-0x50,0x08,0xff,0xa1,0xff,0xff,0x12,0xff,0xfa,0x0f,0xff,0x41,0x15,0xff,0xa0,0xef,
-0x46,0x88,0x48,0xf8,0x0b,0xfc,0xf8,0x42,0xef,0x50,0x5f,0xff,0x82,0xef,0xf1,0x00,
-0xaf,0xfa,0x04,0x27,0x20,0x5a,0xdc,0x94,0x32,0x00,0x6c,0xdb,0x62,0x78,0x8b,0xff,
-0xfe,0x88,0x82,0x53,0x03,0x11,0x12,0x3f,0xbd,0x11,0x3f,0x62,0xda,0xbf,0x3f,0xfc,
-0xfc,0xfe,0xdf,0x90,0x3f,0xd5,0xf4,0xeb,0x7f,0x06,0x00,0x07,0x61,0xe6,0xf5,0xec,
-0x8f,0x90,0x2f,0x54,0x03,0x52,0x07,0x9a,0xaa,0xaa,0xa9,0x95,0x07,0x12,0x14,0xf7,
-0x00,0x12,0xef,0x72,0xad,0x01,0x61,0x03,0x40,0x03,0xc3,0xdf,0xff,0x3b,0x09,0x30,
-0xfd,0x3d,0xf5,0x1a,0x00,0x40,0xff,0xd3,0x50,0x00,0x49,0x06,0x02,0x0d,0x00,0x21,
-0xff,0x60,0x0d,0x00,0x15,0xf6,0x0d,0x00,0x11,0x0b,0x0d,0x00,0x00,0x51,0x04,0x01,
-0x69,0xc7,0x00,0x0d,0x00,0x00,0x0f,0x63,0x03,0x66,0x01,0x10,0x8b,0x73,0x05,0x14,
-0xb6,0xb8,0x01,0xf1,0x0c,0xf2,0x00,0xbf,0xff,0xf8,0xbf,0xf6,0xef,0xff,0x40,0xbf,
-0xff,0xff,0x10,0xa4,0x09,0xff,0xf4,0xaf,0xff,0xff,0xfd,0x10,0x07,0xff,0xff,0x4d,
-0xb9,0x7c,0xf3,0x07,0xbf,0xff,0xf4,0x1d,0xff,0xff,0xf4,0x06,0x10,0xbf,0xff,0x40,
-0x1d,0xff,0xff,0x47,0xfd,0x2b,0xff,0xf4,0x00,0x1d,0xb7,0x01,0x00,0x2f,0x10,0x01,
-0xcf,0x06,0x50,0x08,0x99,0x99,0x70,0x00,0x52,0x0d,0x60,0x0a,0xd0,0xd0,0xd0,0xeb,
-0x9f,0x05,0x00,0x51,0xff,0xd1,0xd1,0xd1,0xeb,0xd2,0xa1,0x0f,0x05,0x00,0x0b,0x10,
-0xef,0xc6,0x05,0x54,0x5c,0xdd,0xdd,0xdd,0xb2,0xed,0x3b,0x10,0x03,0x7a,0x10,0x30,
-0xf0,0x00,0x9f,0x5a,0x33,0x82,0xf0,0x0a,0xff,0x21,0x11,0x11,0x1f,0xf0,0xad,0x00,
-0x12,0xf0,0x22,0x06,0x21,0xd0,0x08,0x4d,0x0f,0x00,0x49,0xde,0x0a,0xf9,0x5c,0x06,
-0x01,0x00,0x1f,0xfc,0x8a,0xd7,0x04,0x04,0x8f,0x06,0x17,0xf4,0x14,0x00,0x7e,0xfb,
-0xfa,0x00,0xfe,0xfa,0x00,0xf8,0x49,0x00,0x02,0x4b,0x0a,0x3e,0x02,0x00,0x02,0x16,
-0x00,0x2f,0xef,0x00,0x01,0x00,0x15,0x1f,0xe9,0x1e,0x00,0x0a,0x03,0x88,0x00,0xa2,
-0xfa,0x00,0xff,0x00,0x00,0xf3,0xfe,0xf7,0xf9,0x00,0x61,0x29,0x00,0x0f,0x00,0x4d,
-0xfe,0xff,0xfb,0xfd,0x92,0x00,0x5a,0xfd,0x00,0xfe,0x00,0x00,0xd3,0x02,0x05,0x1a,
-0x00,0x0b,0x0a,0x00,0x19,0xff,0x1f,0x00,0x03,0x58,0xbc,0x13,0xf6,0x0b,0x00,0x00,
-0x48,0x00,0x3f,0xfe,0xfc,0xfe,0xb6,0xd8,0x0b,0x05,0x3c,0x00,0x11,0xfe,0x34,0x00,
-0x26,0xfe,0xfd,0x30,0x00,0x11,0xe8,0x04,0x01,0x15,0xe5,0x24,0x00,0x20,0xfd,0xfe,
-0x20,0x00,0x01,0x2b,0x00,0x0d,0x44,0x00,0x11,0xfd,0xbc,0xb7,0x0f,0x68,0x00,0x07,
-0x1f,0xfe,0x43,0x01,0x0d,0x19,0xfa,0xdf,0x00,0x01,0xbd,0x00,0x10,0xfd,0x38,0x00,
-0x12,0xfc,0x09,0x01,0x14,0xde,0x6c,0x00,0x97,0xf9,0x00,0x00,0xe4,0xfb,0xee,0xf1,
-0x00,0xe8,0x08,0x02,0x26,0xf2,0xf7,0x04,0xa9,0x00,0xc8,0xe0,0x23,0x00,0xec,0x43,
-0x00,0x20,0xfd,0x00,0x2f,0x05,0x00,0x32,0x05,0x0f,0xe0,0x01,0x01,0x10,0xfc,0xd2,
-0x00,0x1f,0xfc,0x97,0x00,0x0b,0x37,0xf8,0x00,0xfe,0x3e,0x0e,0x0a,0x7b,0x02,0x93,
-0xea,0xe8,0x00,0x00,0xf8,0xfd,0xe8,0xfe,0x02,0x40,0x02,0xd3,0xf5,0xf6,0x00,0xf5,
-0xf6,0xf8,0xf4,0x00,0xf6,0xf9,0xfa,0xf8,0xfa,0x1a,0x01,0x66,0xe9,0xfc,0x00,0x00,
-0xf8,0xff,0x2b,0x01,0xa4,0xfb,0xfc,0x00,0x00,0xfb,0xfd,0x00,0x00,0xfd,0xff,0x7d,
-0x01,0x42,0x02,0x00,0xf4,0xfa,0x51,0x00,0x13,0x01,0xbf,0x04,0x23,0xfd,0xfd,0x6c,
-0x01,0x08,0xf8,0x02,0x14,0xfb,0x20,0x01,0x15,0x01,0x01,0x02,0x02,0xb0,0x01,0x04,
-0x30,0x01,0xf0,0x0a,0x02,0xfb,0xeb,0xfb,0x00,0x00,0xf6,0xfd,0xf6,0xfe,0x02,0xf6,
-0x02,0x02,0x01,0x02,0x00,0x02,0xf9,0xf9,0xfe,0xfc,0xf9,0xfc,0xfa,0x03,0x02,0x46,
-0xfe,0xfd,0x02,0xfb,0x20,0x05,0x1a,0xfd,0x99,0x01,0x02,0x48,0x00,0x1e,0xfd,0xb2,
-0x01,0x0f,0xb5,0x01,0x04,0x1e,0xf9,0x31,0x01,0x0d,0xe9,0x01,0x1f,0xfd,0x24,0x00,
-0x09,0x12,0xff,0x43,0x02,0x1f,0xff,0x5a,0x03,0x10,0x1f,0xff,0x1d,0x00,0x10,0x1e,
-0x02,0xdd,0x01,0x19,0x02,0xbc,0x00,0x16,0x02,0x14,0x04,0x0f,0x01,0x00,0x1e,0x0b,
-0x04,0x01,0x1f,0xf2,0x2c,0x00,0x0b,0x23,0xfe,0xfe,0xd7,0x01,0x1c,0xf4,0x31,0x02,
-0x11,0xfe,0x93,0x00,0x10,0x05,0x2b,0x02,0x0f,0x6f,0x00,0x15,0x2e,0x02,0x00,0xb8,
-0x00,0x3d,0xfe,0xff,0x01,0x97,0x01,0x1f,0xf3,0xd8,0x00,0x24,0x1f,0xfe,0x24,0x00,
-0x26,0x0f,0x3d,0x00,0x07,0x13,0x01,0xd5,0x02,0x11,0x03,0x43,0x73,0x2d,0x04,0x05,
-0x21,0x00,0x30,0x06,0x07,0x08,0x73,0xf6,0xf2,0x05,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,
-0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x4a,0x08,
-0x70,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x6e,0x5a,0xe0,0x1f,0x1f,0x21,0x1b,0x00,
-0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0xd2,0xaa,0x0f,0x01,0x00,0xff,0xff,
-0xc3,0x02,0x33,0x03,0x20,0x03,0x02,0x2e,0x03,0x4c,0x06,0x07,0x06,0x08,0x31,0xaa,
-0x21,0x00,0x0a,0xfe,0x59,0x13,0x0b,0x64,0x93,0x00,0x8b,0xd8,0x82,0x0d,0x0e,0x0f,
-0x10,0x11,0x12,0x13,0x14,0x3d,0xa6,0x72,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x57,
-0x12,0xff,0x01,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,
-0x00,0x00,0x23,0x73,0x00,0x02,0x1f,0x24,0x2d,0x03,0xff,0xff,0xa8,0x50,0x00,0x00,
-0x00,0x00,0x00,
+0x01,0xc5,0x67,0x1a,0x00,0x21,0x1c,0x00,0x0d,0x00,0xf4,0x03,0xc0,0x05,0xcb,0xbb,
+0xb1,0x00,0x1c,0x00,0x3d,0x40,0xb6,0x00,0x9e,0x90,0x9b,0x30,0x00,0x98,0x4f,0x00,
+0x20,0x08,0x40,0x06,0x00,0xf3,0x39,0x35,0x84,0x02,0xdd,0xfd,0xd4,0x04,0x78,0xcb,
+0x10,0x0c,0x00,0x00,0x47,0x84,0x00,0xbc,0xcc,0xf0,0x2c,0xdd,0xcb,0x8b,0x10,0x0d,
+0x00,0x22,0xb5,0x21,0xbb,0xbb,0xf0,0x03,0x9a,0x36,0x4b,0x10,0x0d,0x00,0xa4,0xa3,
+0xd1,0xbc,0xbb,0xf0,0x1a,0x09,0x8b,0x0b,0x10,0x0d,0x00,0x00,0x2d,0x10,0x9c,0xcc,
+0xc0,0x00,0x4d,0x40,0x05,0xb0,0xa5,0x00,0xbb,0x20,0x0b,0x91,0x00,0xb4,0x01,0xab,
+0x00,0x11,0x11,0x06,0x00,0xf4,0x39,0x6c,0x9a,0xb5,0xbc,0xfb,0xb5,0x06,0xda,0xbb,
+0x07,0x9d,0x88,0x00,0x66,0x02,0xb0,0xd2,0x22,0xe0,0x04,0xbb,0xb8,0x0e,0xaa,0xae,
+0x00,0x22,0x22,0x21,0xd0,0x00,0xe0,0x19,0x9d,0xa9,0x6e,0xaa,0xae,0x00,0x35,0xa1,
+0x00,0xd5,0x55,0xe0,0x06,0x7a,0xcb,0x26,0xa6,0x95,0x00,0x8d,0xb1,0x02,0xc6,0x06,
+0xb0,0x0b,0x5f,0x51,0xa4,0x00,0x05,0x42,0xb0,0x18,0xcd,0xdc,0xcc,0xd7,0x01,0xaa,
+0x00,0x01,0x06,0x00,0xf0,0x14,0x55,0xc9,0x57,0xdd,0xfd,0xd5,0x08,0xb6,0xba,0x20,
+0x2b,0x00,0x00,0x08,0xfe,0x10,0xfc,0xcc,0xf0,0x08,0xa3,0x6a,0x0d,0x00,0x0d,0x00,
+0xbb,0xbb,0xc7,0xfb,0xbb,0xf0,0x0b,0x14,0xb4,0x0d,0x00,0x90,0xc6,0x71,0x60,0xfb,
+0xbb,0xf0,0x0c,0x04,0xc4,0x0d,0x00,0xf1,0x06,0xd3,0x70,0x73,0xcc,0xcc,0xc0,0x2b,
+0x01,0x99,0x07,0x90,0xb4,0x04,0x68,0xc5,0x0c,0x90,0x01,0xd4,0x00,0x10,0xaa,0x00,
+0x30,0x03,0x0d,0x02,0x55,0x00,0xf0,0x22,0xc1,0xd2,0xb9,0xde,0xfd,0xd5,0x17,0x6e,
+0x76,0x00,0x78,0x00,0x02,0x7c,0xf8,0x76,0xec,0xcc,0xf0,0x04,0xae,0xb4,0x58,0x00,
+0x0e,0x02,0x60,0x91,0x75,0xdb,0xbb,0xf0,0x00,0x0b,0x68,0x58,0x00,0x0e,0x01,0x55,
+0xe5,0xb6,0xdb,0xbb,0xf0,0x27,0x8e,0x77,0x68,0xc3,0x01,0xf3,0x03,0xf8,0x03,0xbb,
+0xbb,0xb0,0x04,0xd1,0x8b,0x1b,0x50,0xb4,0x03,0xb1,0x00,0x6d,0x60,0x01,0xc5,0xa9,
+0x00,0xf6,0x3a,0x0d,0xaa,0xaa,0xd8,0xdf,0xdd,0x30,0xd7,0x77,0x7d,0x00,0xc0,0x00,
+0x0d,0x22,0x22,0xd5,0xdc,0xcf,0x00,0xab,0xaa,0xc9,0x56,0x00,0xd0,0x08,0x42,0x3a,
+0x35,0xdb,0xbf,0x02,0xeb,0x6d,0xab,0x56,0x00,0xd0,0x07,0xa3,0x3b,0x65,0xdb,0xbf,
+0x03,0xea,0xbd,0xcc,0xa6,0x00,0xd0,0x15,0x14,0x52,0x57,0xbb,0xbb,0x00,0xc4,0x8a,
+0x2c,0x1a,0x27,0x50,0x48,0x1a,0x43,0x2c,0x60,0x0c,0x40,0x00,0xf9,0x01,0x00,0x14,
+0x04,0x61,0x8b,0xcd,0xfc,0xc6,0x01,0x02,0xf7,0x01,0xf1,0x0e,0x5d,0xd2,0x07,0xfe,
+0xee,0xf0,0x00,0x2b,0x80,0x76,0x13,0x0e,0x06,0xde,0xfd,0xf7,0x64,0xa0,0xe0,0x00,
+0x1c,0x2a,0x76,0x4a,0x0e,0x00,0x01,0xc6,0x47,0x0d,0x00,0xb0,0x00,0x76,0x77,0x0e,
+0x00,0x01,0xc0,0x00,0x2d,0x54,0x10,0xf7,0x01,0xc0,0x51,0xc8,0x00,0xbe,0x80,0x4b,
+0x30,0x00,0xa3,0x00,0x09,0x10,0x4e,0x00,0xf3,0x38,0xcc,0xed,0xc9,0xcc,0xfc,0xc3,
+0x00,0x90,0x19,0x00,0x2a,0x00,0x00,0x0b,0x17,0x60,0xfd,0xdc,0xd0,0x0b,0xdc,0xdc,
+0x5c,0x06,0x0c,0x00,0xc0,0x07,0x80,0xc0,0xb0,0xc0,0x0c,0x7c,0x61,0x0c,0x0c,0x0c,
+0x00,0xd1,0x08,0xa0,0xc1,0xb0,0xc0,0x0d,0x7d,0x63,0x1c,0x48,0x0c,0x00,0xd3,0x07,
+0xc1,0x29,0x54,0x20,0x3b,0x5c,0x90,0x07,0xa0,0xa7,0x05,0x67,0x20,0x1c,0x70,0x00,
+0x93,0x9d,0x00,0xf2,0x38,0x0a,0xdd,0xdd,0xdd,0xf1,0x94,0x00,0x00,0x47,0x64,0x0a,
+0xd9,0x00,0x08,0xdb,0x59,0x50,0x6b,0xa9,0x00,0x3a,0x40,0x95,0x01,0xe1,0x40,0x02,
+0xb6,0x2a,0x72,0x26,0xdd,0x03,0xbe,0xcb,0xed,0xbe,0x32,0x40,0x00,0xc2,0x09,0x50,
+0x97,0xc3,0x00,0x0e,0x00,0x95,0x07,0xdc,0x30,0x03,0xc0,0x09,0x50,0x3c,0x17,0x00,
+0xc4,0x00,0x95,0x00,0xd3,0x53,0x49,0x00,0x09,0x50,0x03,0xce,0xed,0x00,0x14,0x10,
+0xef,0x01,0x10,0x80,0x2e,0x04,0xf4,0x39,0x03,0xdd,0x50,0xe9,0xf9,0x9d,0x03,0xe5,
+0x3d,0x3e,0x6e,0x66,0xd0,0x84,0x68,0x20,0x44,0xe4,0x43,0x00,0xcc,0xcc,0x6b,0xbb,
+0xbb,0xb4,0x0d,0x55,0xd0,0xb8,0x88,0x99,0x00,0xd4,0x4d,0x0e,0x99,0x9a,0xc0,0x0d,
+0x88,0xd0,0xe3,0x33,0x5c,0x00,0xd2,0x55,0x0e,0x66,0x67,0xc0,0x0d,0x05,0xa0,0xb9,
+0x9a,0xa9,0x01,0xfb,0xac,0x17,0x90,0x4b,0x20,0x38,0x10,0x0a,0x80,0x00,0x2c,0x30,
+0x72,0x05,0x00,0x05,0x00,0xf3,0x15,0x0c,0xdf,0xcd,0x8a,0xdc,0xcd,0x00,0xa5,0x07,
+0x7a,0x30,0x1d,0x19,0xb0,0xad,0x29,0xcc,0xcc,0x16,0x57,0x77,0x77,0x77,0x70,0x00,
+0x97,0x33,0x99,0x33,0x30,0x00,0x9b,0x99,0xcc,0x99,0x50,0x06,0x00,0xf6,0x08,0x97,
+0x22,0x88,0x22,0x21,0x00,0x79,0x99,0x99,0xb9,0x9d,0x08,0x91,0xb0,0xc1,0x85,0x3b,
+0x1b,0x00,0x90,0x42,0x0b,0xd5,0x8e,0x03,0xf0,0x0d,0x1d,0x00,0x00,0xdc,0xfc,0xa0,
+0x01,0xd0,0x00,0x0d,0x2d,0x21,0x68,0x9e,0x88,0x00,0xd9,0xe9,0x5b,0x54,0xd3,0xe0,
+0x0d,0x2d,0x21,0xb2,0x1d,0x0e,0x0d,0x00,0xf6,0x1b,0x43,0xd2,0xe0,0x0d,0x2d,0x22,
+0x8b,0xbf,0xbb,0x00,0x89,0x99,0xd5,0x62,0xb0,0x00,0x05,0x56,0x6d,0x0d,0x79,0x00,
+0x01,0x77,0x88,0xb0,0x4f,0x40,0x00,0x54,0x52,0x49,0x1b,0xad,0x61,0x00,0x00,0xad,
+0x6d,0x60,0x19,0xe2,0x54,0x00,0xf0,0x3c,0x11,0x11,0x11,0x00,0xdc,0xfc,0x6d,0xbb,
+0xbb,0xb3,0x0c,0x0c,0x00,0xc0,0x78,0x83,0x00,0xdb,0xeb,0x3c,0x0c,0x17,0x60,0x0c,
+0x2d,0x20,0xc0,0xc1,0x76,0x00,0xd9,0xe9,0x3c,0x07,0x88,0x30,0x0c,0x2d,0x21,0xc6,
+0x94,0x99,0x10,0x8a,0xab,0x8c,0x92,0x69,0x71,0x07,0x68,0x68,0xc9,0x26,0x97,0x12,
+0x78,0x79,0x7c,0x7a,0x5b,0xa1,0x63,0x62,0x66,0xd1,0x11,0x11,0x01,0x00,0x7d,0x29,
+0xaa,0xaa,0xa4,0x4f,0x00,0x10,0x54,0xa3,0x00,0xf1,0x04,0x60,0x4e,0xc2,0x00,0x0c,
+0x3d,0x31,0x7c,0x11,0xb7,0x00,0xc7,0xe7,0x99,0xcc,0xcb,0x84,0x0c,0x3d,0x14,0x01,
+0xf6,0x1e,0xd8,0xe8,0x2d,0xab,0xba,0xd0,0x0c,0x5d,0x52,0xa0,0xba,0x0b,0x00,0x56,
+0x89,0x7b,0xa9,0x9a,0xb0,0x08,0x89,0x77,0x19,0x00,0xa0,0x02,0x78,0x7a,0x66,0xc0,
+0x3d,0x00,0x63,0x52,0x76,0xc6,0xca,0xca,0x00,0x00,0x8c,0x94,0x03,0xa0,0x71,0xa3,
+0x00,0xf0,0x45,0x1b,0x57,0x00,0x5d,0xce,0x35,0x8d,0xab,0x71,0x5c,0x98,0x3b,0x4b,
+0x78,0xb2,0x56,0x88,0x3b,0x6c,0x99,0xc2,0xeb,0xbb,0xeb,0xae,0xbc,0xd2,0xb6,0x66,
+0xb5,0x55,0x55,0x52,0x4b,0x6b,0x37,0x77,0x77,0x73,0x4d,0xad,0x35,0xca,0xaa,0xc0,
+0x48,0x09,0x36,0x92,0x22,0xd0,0x4d,0xbd,0x33,0xb8,0x8b,0x80,0x48,0x09,0x30,0x76,
+0x1d,0x10,0x48,0x6c,0x4f,0xff,0xfe,0xb7,0x00,0x00,0x01,0xb0,0x00,0x00,0x01,0x88,
+0x88,0x8f,0x98,0x88,0x81,0x04,0x44,0x01,0x00,0xa0,0x00,0x03,0xeb,0xbb,0xbb,0xe4,
+0x00,0x00,0x3b,0x00,0x6f,0x06,0xf1,0x10,0x02,0xbb,0xbb,0xbb,0xb3,0x00,0x06,0x99,
+0x99,0x99,0x99,0x96,0x00,0xb6,0x33,0x33,0x33,0x36,0xb0,0x0b,0x35,0xeb,0xbb,0xe2,
+0x3b,0x00,0xb3,0x59,0x00,0x0b,0x23,0x0d,0x00,0x94,0xb1,0x3b,0x00,0xb3,0x12,0x00,
+0x00,0x6c,0x70,0x9c,0x00,0x00,0x20,0x03,0xe2,0xcc,0xc8,0x7c,0xbb,0xbe,0x10,0xd1,
+0x3b,0x78,0x55,0x5d,0x10,0xd0,0x2b,0x06,0x00,0xf5,0x1f,0x7c,0xbb,0xbf,0x10,0xd0,
+0x2b,0x77,0x44,0x44,0x42,0xd0,0x2b,0x79,0x77,0x77,0x73,0xfb,0xcb,0x7d,0xcc,0xcc,
+0xc0,0xe2,0x21,0x32,0x21,0x60,0xf0,0x40,0x03,0x8c,0x48,0x95,0xe0,0x00,0x0a,0x3a,
+0x27,0x03,0xc0,0x00,0x07,0x02,0x00,0xbd,0x60,0x4e,0x00,0x10,0xe0,0x73,0x05,0xf0,
+0x28,0xdd,0xdf,0xdd,0xdd,0xd1,0x00,0x0a,0x00,0xe0,0x09,0x10,0x00,0x08,0xd1,0x2f,
+0x24,0xf3,0x00,0x08,0xa4,0xac,0xfc,0xd3,0xb8,0x00,0x60,0x3c,0x2e,0x2c,0x40,0x60,
+0x02,0x9b,0x3c,0x30,0x1c,0x92,0x03,0xc4,0x3d,0xdc,0xce,0x55,0xd4,0x02,0xab,0x63,
+0x05,0xc0,0x00,0x00,0x14,0x04,0xbd,0xe2,0x61,0x04,0xa7,0x9d,0x78,0xe8,0x10,0x00,
+0x9d,0x95,0x00,0x01,0x8c,0xfa,0x07,0x00,0x57,0x08,0xf0,0x36,0xcb,0xdb,0xd4,0x00,
+0xd8,0x00,0x0c,0x68,0x5a,0x40,0x0d,0x4a,0x00,0xc8,0x89,0x84,0x00,0xd0,0x40,0x0c,
+0x6b,0x8b,0x9e,0xef,0xee,0x60,0x33,0xb6,0x31,0x02,0xf0,0x00,0x0b,0xce,0xdc,0x30,
+0x4f,0x30,0x00,0x00,0xa3,0x00,0x08,0x97,0x00,0x2c,0xde,0xdc,0x50,0xc0,0xb0,0x00,
+0x62,0x23,0x50,0x5a,0x09,0x50,0x1b,0x45,0xa7,0x4d,0x20,0x2d,0x15,0x53,0x56,0x09,
+0x80,0xed,0x00,0x08,0x8c,0x02,0xf0,0x07,0xeb,0xeb,0xe2,0x01,0xd0,0x00,0x0c,0x6a,
+0x7a,0x20,0x1d,0x00,0x00,0xb7,0xa8,0x92,0x01,0xfe,0xe9,0x0d,0x8d,0x8d,0x0d,0x00,
+0x30,0x22,0xe2,0x20,0x1a,0x00,0xf0,0x54,0xcf,0xcc,0x3b,0xcf,0xbb,0x00,0x00,0xe2,
+0x33,0xe3,0x33,0xe0,0x3d,0xcb,0xa9,0x5d,0x00,0x0e,0x00,0x75,0x35,0xb2,0xd0,0x00,
+0xe0,0x0b,0x64,0xa3,0x7f,0xbb,0xbe,0x04,0x51,0x20,0x01,0xe2,0x22,0xd0,0x00,0x00,
+0x01,0xa0,0x00,0x00,0x01,0xaa,0xaa,0xaf,0xaa,0xaa,0xa1,0x02,0x22,0x39,0x2a,0x22,
+0x74,0x00,0xbf,0xbd,0x8a,0x69,0xbc,0x20,0x02,0xa0,0xc0,0xd0,0xd0,0xb2,0x02,0xd6,
+0xb8,0x0d,0x1f,0xb8,0xd3,0x12,0x35,0x00,0x50,0x14,0x42,0x00,0x06,0xec,0xcc,0xcc,
+0xd8,0x00,0x00,0x87,0x00,0x00,0x06,0x80,0x00,0x0b,0xdc,0x0d,0x00,0x21,0x04,0xe0,
+0x0d,0x00,0x5d,0xc3,0x00,0x00,0x00,0x68,0xf7,0x08,0xf0,0x07,0x1e,0x10,0x00,0x00,
+0x1c,0xcc,0xcc,0xed,0xcc,0xcc,0x10,0x11,0x89,0x11,0x1b,0x81,0x10,0x00,0x00,0xb8,
+0x09,0xb0,0x1a,0x00,0xf0,0x12,0xcf,0xd1,0x00,0x00,0x02,0x69,0xe9,0x49,0xeb,0x75,
+0x12,0xc9,0x83,0x00,0x03,0x77,0xa1,0x00,0x08,0x60,0x00,0x77,0x00,0x00,0x00,0x96,
+0x00,0x07,0x70,0x00,0x00,0x0c,0x40,0x0d,0x00,0x20,0x06,0xd0,0x0d,0x00,0x31,0x01,
+0xc2,0x00,0x1a,0x00,0x06,0x34,0x04,0xe0,0x16,0xaf,0xf0,0x00,0x00,0x03,0x7c,0xff,
+0xff,0xf0,0x00,0x06,0xef,0xff,0x07,0x00,0x50,0x0b,0xff,0xff,0xfe,0xac,0x07,0x00,
+0x90,0xd8,0x30,0x09,0xf0,0x00,0x0b,0xf1,0x00,0x00,0x07,0x00,0x1b,0xe0,0x07,0x00,
+0xf0,0x05,0x3d,0xff,0xf0,0x03,0x6c,0xe0,0x00,0xcf,0xff,0xf0,0xaf,0xff,0xe0,0x00,
+0x5f,0xff,0x80,0xdf,0xff,0xd0,0x4f,0x09,0x30,0x2a,0xda,0x20,0x57,0x00,0xf0,0x3c,
+0x80,0x9c,0xcc,0xcc,0xcc,0x40,0x8f,0xdf,0xb7,0x77,0x77,0xfe,0xdf,0xd0,0xc7,0x00,
+0x00,0x0d,0x50,0xde,0x8e,0x70,0x00,0x00,0xdb,0x8e,0xe5,0xdb,0x77,0x77,0x7f,0x95,
+0xed,0x1c,0xeb,0xbb,0xbb,0xf6,0x1d,0xfc,0xf7,0x00,0x00,0x0d,0xdc,0xfd,0x0c,0x70,
+0x00,0x00,0xd5,0x0d,0xfa,0xe9,0x33,0x33,0x3e,0xca,0xfc,0x3d,0xff,0xff,0xff,0xf8,
+0x3c,0x35,0x52,0x05,0x55,0x55,0x55,0x3f,0xff,0xc6,0xff,0x01,0x00,0x20,0xfc,0x6f,
+0x05,0x00,0x80,0xee,0x94,0xee,0xee,0xee,0xec,0x34,0x42,0xf6,0x02,0x0f,0x1a,0x00,
+0x14,0x30,0xfd,0xff,0xa4,0x06,0x00,0x01,0xf0,0x00,0x11,0x29,0xf1,0x00,0x21,0x2e,
+0xfc,0x06,0x00,0x31,0xff,0x90,0x50,0x06,0x00,0x20,0xaf,0xc0,0x06,0x00,0xf0,0x01,
+0x0c,0xff,0xc0,0x2e,0xff,0x90,0x00,0x1c,0xff,0xce,0xff,0x90,0x00,0x00,0x1c,0xff,
+0x06,0x00,0x21,0x00,0x1c,0x06,0x00,0x33,0x00,0x0b,0x90,0x30,0x01,0xf1,0x1d,0x09,
+0xf5,0x00,0x06,0xf8,0xdf,0xf5,0x06,0xff,0xc2,0xef,0xf9,0xff,0xd1,0x02,0xef,0xff,
+0xd1,0x00,0x08,0xff,0xf7,0x00,0x06,0xff,0xff,0xf5,0x06,0xff,0xe4,0xef,0xf5,0xef,
+0xe1,0x02,0xef,0xd4,0xa1,0x00,0x02,0xb4,0x00,0x00,0x02,0x28,0x09,0xf0,0x3c,0x20,
+0xbf,0x40,0x30,0x00,0x01,0xcf,0x1b,0xf4,0x7f,0x80,0x00,0xbf,0xd0,0xbf,0x45,0xff,
+0x40,0x4f,0xe1,0x0b,0xf4,0x07,0xfd,0x09,0xf8,0x00,0xbf,0x40,0x0e,0xf2,0xcf,0x40,
+0x0b,0xf4,0x00,0xbf,0x4b,0xf4,0x00,0x9e,0x30,0x0b,0xf4,0x9f,0x80,0x00,0x00,0x00,
+0xff,0x23,0xff,0x20,0x00,0x00,0x8f,0xc0,0x0a,0xfe,0x40,0x01,0x8f,0xf4,0x00,0x0c,
+0xff,0xed,0xff,0xf6,0x00,0x00,0x07,0xef,0xff,0xc3,0x4f,0x00,0x12,0x12,0xe5,0x05,
+0x11,0x21,0x06,0x00,0x20,0xff,0xf3,0xc2,0x01,0xc1,0x3f,0xff,0x70,0x11,0x00,0x7f,
+0xbf,0xff,0xff,0xce,0xb0,0x1f,0xf5,0x00,0xf1,0x14,0x53,0xff,0xff,0x82,0x5f,0xff,
+0xf7,0x03,0xff,0xc0,0x00,0x7f,0xf8,0x00,0x3f,0xfa,0x00,0x06,0xff,0x70,0x2c,0xff,
+0xf4,0x01,0xdf,0xfe,0x42,0xff,0xff,0xfe,0xff,0xff,0xf6,0x0a,0xff,0x10,0x01,0xa1,
+0x05,0x07,0xff,0xfa,0x13,0x20,0x00,0x00,0x0f,0xff,0xca,0x08,0x12,0x46,0xd8,0x09,
+0x30,0x25,0x00,0x36,0xbe,0x01,0xf0,0x1d,0x4f,0xfc,0x1a,0xf6,0x00,0x00,0x00,0x7f,
+0xe9,0xfe,0xcf,0x60,0x00,0x00,0xaf,0xc3,0x64,0xff,0xf6,0x00,0x01,0xcf,0xa3,0xef,
+0xa3,0xdf,0x90,0x03,0xef,0x75,0xff,0xff,0xc3,0xcf,0xb0,0xdf,0x48,0xff,0xff,0xff,
+0xe3,0x9f,0x72,0x27,0x4f,0x00,0xe0,0xf2,0x50,0x00,0x9f,0xff,0xcb,0xef,0xff,0x30,
+0x00,0x09,0xff,0xf1,0x07,0x9a,0x00,0xd0,0x9f,0xff,0x10,0x7f,0xff,0x30,0x00,0x07,
+0xff,0xe0,0x06,0xff,0xf2,0xd4,0x09,0x11,0x54,0x60,0x00,0x21,0x1f,0xff,0xc3,0x00,
+0x3d,0x2f,0xff,0x20,0x07,0x00,0x50,0x47,0x8f,0xff,0x87,0x40,0x39,0x00,0x01,0x7c,
+0x01,0x40,0x0a,0xff,0xff,0xfa,0x1c,0x00,0xf2,0x08,0xaf,0xff,0xa0,0x00,0x00,0x46,
+0x66,0x3a,0xfa,0x36,0x66,0x50,0xff,0xff,0xf4,0x54,0xff,0xff,0xf2,0xff,0xff,0xff,
+0xcf,0x07,0x00,0x60,0xff,0xf3,0xb8,0xf2,0x9b,0xbb,0x01,0x00,0x41,0xa0,0x00,0x08,
+0xaa,0xb8,0x05,0x11,0x08,0x8f,0x00,0x30,0x00,0x03,0xfb,0x58,0x00,0x30,0xd0,0x00,
+0xdf,0x6f,0x00,0x31,0x6f,0x80,0x8f,0x99,0x04,0xf1,0x03,0xbf,0x3f,0xfe,0xee,0x40,
+0x00,0x9e,0xee,0xf9,0xff,0xff,0xfc,0x44,0x5f,0xff,0xff,0xaf,0xff,0x01,0x00,0x22,
+0xfa,0xff,0x01,0x00,0x12,0x9a,0x07,0x00,0x11,0xf5,0x19,0x03,0xf0,0x0e,0x07,0x90,
+0x00,0x6d,0xff,0xfb,0x40,0xcf,0x00,0xbf,0xfd,0xbd,0xff,0xac,0xf0,0xbf,0xd3,0x00,
+0x03,0xcf,0xff,0x4f,0xd1,0x00,0x07,0xaa,0xff,0xf9,0xf5,0x97,0x00,0x21,0xff,0x01,
+0x73,0x06,0x03,0x77,0x07,0x01,0xae,0x00,0xf3,0x0e,0x4f,0x9f,0xff,0xab,0x70,0x00,
+0x0d,0xf4,0xff,0xfb,0x20,0x00,0x3c,0xfb,0x0f,0xcb,0xff,0xca,0xcf,0xfc,0x10,0xfc,
+0x05,0xcf,0xff,0xd7,0x00,0x09,0x70,0xbd,0x01,0xe4,0x05,0x20,0x00,0x06,0xf7,0x01,
+0x16,0xff,0x8f,0xff,0xff,0xf8,0xff,0xff,0x07,0x00,0xb2,0x8a,0xcc,0xef,0xf8,0x00,
+0x02,0xef,0x80,0x00,0x02,0xe7,0x5b,0x0b,0x20,0x04,0x20,0xb8,0x00,0xf0,0x02,0x70,
+0x00,0x01,0x16,0xff,0x80,0x00,0xef,0xff,0xff,0x82,0xb1,0xff,0xff,0xff,0x80,0xc9,
+0x05,0x00,0xe0,0x9b,0xff,0xff,0xff,0x82,0xf3,0xbd,0xdf,0xff,0x80,0x10,0x00,0x03,
+0xef,0x35,0x02,0x26,0x3e,0x70,0x91,0x0b,0x14,0x00,0xff,0x0c,0x12,0xc2,0x6d,0x00,
+0xa0,0x0b,0xe1,0x00,0x00,0x06,0xf7,0x00,0xb7,0x0c,0xb0,0x4b,0x00,0xb0,0x05,0xf5,
+0x2f,0x3f,0xff,0xff,0xf8,0x2c,0x17,0xd0,0xb8,0x4b,0x00,0xb1,0xba,0x2f,0x18,0xbf,
+0xff,0xff,0xf8,0x09,0xb1,0xf2,0x7b,0x55,0x00,0x30,0x5e,0x0a,0x9a,0x89,0x00,0x30,
+0x2e,0x80,0xe4,0x8d,0x00,0x40,0x0c,0xa0,0x8d,0x00,0x91,0x00,0x31,0x10,0x7f,0x30,
+0x5f,0x00,0x24,0x4f,0x40,0x36,0x04,0x11,0x9f,0x29,0x01,0x40,0x9f,0xf9,0xbf,0xff,
+0xaa,0x03,0x30,0x00,0xdf,0xff,0x4d,0x00,0x90,0x0d,0xff,0xf8,0xaf,0xff,0xff,0x9b,
+0xff,0xf8,0x1d,0x01,0x80,0x6d,0xf8,0x00,0x00,0xcf,0xff,0x40,0x17,0xc9,0x01,0x11,
+0xa0,0xc8,0x01,0x61,0xfd,0xaa,0xaa,0xaa,0xaa,0xad,0x6c,0x01,0x00,0x2c,0x01,0x10,
+0x40,0xe0,0x00,0x80,0x50,0x00,0x00,0x0c,0xfb,0x00,0x00,0x03,0x31,0x02,0xf0,0x39,
+0xdf,0xff,0xc0,0x00,0x8f,0xff,0xff,0x70,0x2f,0xff,0xff,0xff,0x2a,0xff,0xff,0xff,
+0xf9,0xef,0xef,0xff,0xff,0xdf,0xb7,0xff,0xff,0xfe,0xce,0x2d,0xff,0xff,0xb5,0xfc,
+0x36,0xff,0xf3,0x07,0xff,0xff,0xf6,0x00,0x02,0x89,0x72,0x00,0x06,0x40,0x00,0x02,
+0x42,0xfa,0x00,0x03,0xef,0x2f,0xa0,0x04,0xff,0xf2,0xfa,0x05,0xff,0xff,0x2f,0xa6,
+0xff,0xff,0xf2,0xfe,0xff,0xff,0xff,0x2f,0xff,0x01,0xf1,0x07,0xfc,0xdf,0xff,0xff,
+0x2f,0xa1,0xdf,0xff,0xf2,0xfa,0x01,0xcf,0xff,0x2f,0xa0,0x00,0xbf,0xf2,0xf9,0x00,
+0x00,0x9c,0xbd,0x00,0x11,0x24,0x06,0x00,0x22,0xef,0xc3,0xb5,0x01,0x11,0x91,0x06,
+0x00,0x21,0xff,0x70,0x06,0x00,0x31,0xfd,0x40,0x00,0x9d,0x00,0x21,0x10,0xff,0x44,
+0x02,0x11,0xff,0x61,0x02,0x00,0x05,0x00,0x21,0xfe,0x50,0xe1,0x00,0x00,0x1e,0x00,
+0x10,0xb2,0x2a,0x00,0x10,0xd4,0x36,0x00,0x10,0xf7,0x42,0x00,0x11,0x48,0xd4,0x01,
+0xff,0x03,0x26,0x66,0x10,0x16,0x66,0x30,0xef,0xff,0xc0,0xaf,0xff,0xf1,0xff,0xff,
+0xe0,0xbf,0xff,0xf2,0x06,0x00,0x19,0xa0,0xd0,0xbf,0xff,0xf2,0xaf,0xff,0x80,0x6e,
+0xff,0xc0,0x57,0x0e,0x30,0x66,0x50,0xef,0x6d,0x00,0x11,0xf4,0x7e,0x00,0x1f,0xf6,
+0x06,0x00,0x1c,0x70,0xf5,0xaf,0xff,0xff,0xff,0xff,0xd1,0xf3,0x28,0x05,0x00,0x00,
+0x06,0x45,0xfb,0x00,0x01,0xfc,0x6f,0xfc,0x10,0x1f,0xc6,0xff,0xfd,0x11,0xfc,0x6f,
+0xff,0xfd,0x3f,0xc6,0xff,0xff,0xff,0xfc,0x6f,0xff,0xff,0xff,0xc6,0xff,0xff,0xfa,
+0xfc,0x6f,0xff,0xf7,0x1f,0xc6,0xff,0xf6,0x01,0xfc,0x6f,0xf5,0x00,0x1f,0xc3,0xe4,
+0x00,0x00,0xfb,0x00,0x01,0x00,0x11,0x52,0x06,0x00,0x20,0xaf,0xe2,0x06,0x00,0x80,
+0x9f,0xff,0xd1,0x00,0x00,0x00,0x8f,0xff,0x07,0x00,0x00,0x3b,0x00,0xa0,0xc0,0x00,
+0x5f,0xff,0xff,0xff,0xff,0xb0,0x0e,0xff,0x01,0x00,0x90,0x40,0x8e,0xee,0xee,0xee,
+0xee,0xc1,0x02,0x44,0x01,0x00,0x11,0x00,0x13,0x00,0x21,0xf5,0x0f,0x07,0x00,0x20,
+0x60,0xcf,0x06,0x00,0xf1,0x05,0xe3,0x00,0x00,0x00,0x10,0x00,0x00,0x0b,0xf2,0x00,
+0x00,0xbf,0xf2,0x00,0x0b,0xff,0x30,0x00,0xbf,0xf3,0x07,0x00,0xb4,0x2f,0xf9,0x00,
+0x00,0x06,0xff,0x80,0x00,0x00,0x6f,0xf8,0x09,0x00,0xf4,0x08,0xf4,0x00,0x00,0x05,
+0xb0,0x01,0x00,0x00,0x00,0x1e,0xc0,0x00,0x00,0x1e,0xfc,0x00,0x00,0x02,0xef,0xc0,
+0x00,0x00,0x2e,0x09,0x00,0x91,0x7f,0xf4,0x00,0x06,0xff,0x70,0x00,0x6f,0xf7,0x07,
+0x00,0x60,0x2f,0xf7,0x00,0x00,0x0a,0x70,0xa1,0x00,0x30,0x17,0x40,0x00,0xa1,0x00,
+0x1f,0xe0,0x06,0x00,0x01,0x10,0xdf,0x84,0x00,0x12,0xf3,0x97,0x00,0x6f,0x36,0x66,
+0xbf,0xf6,0x66,0x50,0x2a,0x00,0x01,0x99,0x4d,0x90,0x00,0x00,0x01,0x11,0x11,0x11,
+0x11,0x30,0x00,0xf3,0x43,0x35,0x55,0x55,0x55,0x55,0x40,0x00,0x00,0x5a,0xcd,0xc8,
+0x20,0x00,0x00,0x02,0xdf,0xd7,0x69,0xff,0x90,0x00,0x04,0xff,0xa0,0x01,0x02,0xef,
+0xc1,0x02,0xff,0xf1,0x02,0xfc,0x16,0xff,0xb0,0xcf,0xfb,0x05,0xaf,0xf9,0x1f,0xff,
+0x6d,0xff,0xb1,0xff,0xff,0xb1,0xff,0xf7,0x4f,0xfe,0x0b,0xff,0xf5,0x5f,0xfc,0x00,
+0x6f,0xf9,0x08,0xa5,0x1d,0xfd,0x20,0x00,0x5e,0xfb,0x53,0x6e,0xfb,0x10,0x00,0x00,
+0x07,0xce,0xfe,0xa4,0x00,0x00,0x32,0x5e,0x01,0x23,0x0e,0xf5,0x09,0x00,0xf0,0x3b,
+0x3e,0xf9,0x05,0xac,0xdb,0x71,0x00,0x00,0x00,0x1b,0xff,0xfd,0x76,0xaf,0xf7,0x00,
+0x00,0x00,0x08,0xff,0x31,0x30,0x4f,0xfa,0x00,0x00,0x32,0x04,0xef,0xbf,0xc0,0x9f,
+0xf8,0x00,0x0e,0xf5,0x02,0xcf,0xff,0x64,0xff,0xf3,0x01,0xff,0xf6,0x00,0x9f,0xf8,
+0x4f,0xff,0x40,0x06,0xff,0xc0,0x00,0x6f,0xeb,0xff,0xa0,0x00,0x09,0xff,0x60,0x00,
+0x3e,0xff,0xc0,0x00,0x00,0x07,0xff,0xa4,0x30,0x1b,0x65,0x00,0x72,0x02,0x8d,0xff,
+0x80,0x08,0xfe,0x30,0x5b,0x00,0x32,0x04,0xef,0x20,0x09,0x00,0x10,0x02,0x24,0x01,
+0x22,0x01,0x40,0x0d,0x00,0x22,0x0d,0xf8,0x08,0x00,0x21,0x7f,0xff,0x1e,0x00,0x40,
+0x01,0xff,0xff,0xa0,0x08,0x00,0x40,0x0a,0xff,0xff,0xf4,0x08,0x00,0x40,0x3f,0xf5,
+0x1a,0xfd,0x08,0x00,0xf0,0x06,0xcf,0xf4,0x0a,0xff,0x60,0x00,0x00,0x05,0xff,0xf5,
+0x0a,0xff,0xe1,0x00,0x00,0x0e,0xff,0xf6,0x0b,0xff,0xf9,0x04,0x02,0xf2,0x06,0xfd,
+0x8f,0xff,0xff,0x20,0x02,0xff,0xff,0xf3,0x09,0xff,0xff,0xb0,0x0a,0xff,0xff,0xf7,
+0x1c,0xff,0xff,0xf4,0x09,0x02,0x50,0xff,0xf8,0x04,0x9a,0xaa,0x01,0x00,0x11,0x91,
+0x5a,0x00,0x21,0x70,0x00,0x51,0x00,0xf0,0x0b,0xa0,0xef,0xfa,0x00,0x05,0xff,0xff,
+0xaf,0xff,0xf9,0x04,0xff,0xff,0xfb,0x11,0x3f,0xa4,0xff,0x84,0xfc,0x00,0x00,0x33,
+0xff,0x90,0x19,0xd5,0x01,0xe0,0xa2,0x01,0x70,0x00,0x02,0xef,0xa4,0xf6,0x3f,0xa0,
+0xef,0xff,0xb0,0x5f,0x27,0x00,0xb1,0xc0,0x00,0x6f,0xff,0xfb,0x11,0x10,0x00,0x00,
+0x14,0xfc,0x41,0x00,0x10,0x19,0x4c,0x00,0x01,0x0a,0x00,0x30,0x5f,0xa0,0x00,0x92,
+0x00,0x10,0xfa,0x0b,0x00,0xf1,0x0d,0xfa,0xff,0xa0,0x00,0x05,0xff,0x90,0x3f,0xfa,
+0x00,0x4f,0xf9,0x00,0x03,0xff,0xa0,0xbf,0x90,0x00,0x00,0x3f,0xf1,0x15,0x00,0x00,
+0x00,0x03,0x30,0x2e,0x00,0xf0,0x09,0x10,0x9f,0x50,0x00,0x00,0x1d,0xe1,0x8f,0xf5,
+0x00,0x01,0xdf,0xd0,0x08,0xff,0x50,0x1d,0xfd,0x10,0x00,0x8f,0xf6,0xdf,0xd1,0x61,
+0x01,0x20,0xfd,0x10,0xf8,0x01,0x20,0xd1,0x00,0x4f,0x00,0x00,0x0b,0x00,0x23,0x7d,
+0x10,0x14,0x01,0xf3,0x15,0xfd,0x18,0xff,0xff,0xff,0x80,0x00,0x6f,0xff,0xfd,0x4a,
+0xaa,0xaa,0xfb,0x00,0x0c,0xda,0xf7,0xf4,0x00,0x00,0x0e,0xb0,0x00,0x00,0x9f,0x11,
+0x00,0x00,0x00,0xeb,0x00,0x00,0x09,0xf1,0x00,0x11,0x00,0xc0,0x10,0x00,0x02,0xe6,
+0xeb,0x9d,0x00,0x09,0xf9,0x99,0x99,0x4d,0x44,0x01,0x72,0x7f,0xff,0xff,0xfb,0x1d,
+0xff,0xa0,0x49,0x00,0x35,0x1d,0xa0,0x00,0x01,0x00,0xd2,0x6b,0xcc,0xc7,0x00,0x00,
+0x00,0x0f,0xff,0xff,0xf8,0x22,0x22,0x10,0x28,0x01,0x2f,0xcf,0xff,0x01,0x00,0x12,
+0x11,0xfa,0x06,0x00,0x00,0xef,0x00,0x02,0xd2,0x01,0x12,0x08,0xbb,0x01,0x31,0x8f,
+0xff,0x80,0x27,0x02,0x21,0xff,0xf8,0xc7,0x01,0xe2,0xff,0xff,0x70,0x00,0x00,0x69,
+0x9f,0xff,0x99,0x60,0x00,0x00,0x00,0x2f,0xd6,0x01,0x08,0x07,0x00,0xf1,0x06,0x46,
+0x66,0x2f,0xff,0x26,0x66,0x50,0xff,0xff,0x46,0x76,0x4f,0xff,0xf2,0xff,0xff,0xfc,
+0xbc,0xff,0xff,0xf2,0xe4,0x02,0x40,0xb8,0xf2,0x9b,0xbb,0x01,0x00,0x02,0xad,0x00,
+0x21,0x33,0x00,0x10,0x02,0x00,0x70,0x00,0x00,0x52,0x02,0x11,0xff,0xa7,0x02,0x11,
+0xff,0x0d,0x02,0x12,0x0c,0x15,0x00,0x32,0x00,0xbf,0xf6,0x07,0x00,0x00,0x05,0x01,
+0x01,0xb1,0x03,0xf1,0x0a,0x01,0x50,0x00,0x4f,0xfd,0x00,0x03,0xaf,0xf8,0x07,0xff,
+0xf2,0x00,0x0e,0xff,0xff,0xef,0xfe,0x30,0x00,0x0b,0xff,0xff,0xff,0xc2,0xa0,0x00,
+0x10,0xd5,0x7c,0x02,0x21,0x98,0x62,0x67,0x01,0x10,0x84,0xc5,0x01,0xf1,0x05,0x8f,
+0xff,0x60,0x00,0xaf,0xf3,0xec,0x2e,0xc0,0x1c,0xff,0xa0,0xde,0x9f,0xd1,0xdf,0xfa,
+0x00,0x3e,0xff,0x80,0x02,0x11,0x2d,0x61,0x00,0x60,0x1c,0xff,0xf7,0x00,0x00,0x2d,
+0x38,0x04,0xf0,0x10,0x00,0xcf,0xaf,0xd2,0xef,0xf6,0x00,0xfb,0x0d,0xd0,0x2e,0xff,
+0x60,0xbf,0xef,0x80,0x02,0xef,0xf3,0x19,0xc8,0x00,0x00,0x16,0x40,0x00,0x02,0x66,
+0x66,0x12,0x00,0x64,0x00,0xff,0x05,0x3f,0x40,0x00,0x0c,0xff,0xff,0x3f,0xf2,0xdf,
+0x6c,0xff,0xff,0x53,0x31,0xff,0x7c,0xff,0xff,0xff,0xf6,0x06,0x00,0x0c,0x10,0x7b,
+0xd3,0x03,0x60,0xff,0xc2,0x33,0x33,0x33,0x20,0x00,0x01,0xe1,0x20,0x00,0x8a,0xaa,
+0xaa,0xa9,0x00,0x00,0x49,0x99,0x99,0x99,0x60,0x00,0xc0,0x02,0x20,0x00,0xfa,0x02,
+0x01,0x10,0x80,0x8d,0x00,0x21,0xef,0xf3,0x06,0x00,0x72,0xf5,0xfe,0xaa,0xaa,0xaa,
+0xff,0xf5,0x0f,0x04,0x40,0xff,0xff,0x80,0x4f,0x06,0x00,0x20,0x10,0x0c,0x06,0x00,
+0x20,0x50,0x1e,0x06,0x00,0x50,0xfb,0xef,0xff,0xf5,0x9f,0x1e,0x00,0x81,0xd1,0xcd,
+0xdd,0xdd,0xdd,0xdd,0xd4,0xef,0x2a,0x00,0x17,0x00,0x01,0x00,0x7f,0xbc,0xcc,0xcc,
+0xcc,0xcc,0xc3,0xff,0x18,0x00,0x10,0x10,0x6b,0x12,0x00,0x22,0xcb,0x6f,0xfe,0x01,
+0x11,0x9f,0x06,0x00,0x11,0x95,0x0e,0x00,0x70,0x65,0xf9,0x3d,0xff,0xff,0xfd,0x39,
+0x03,0x00,0x20,0xf9,0x3d,0x10,0x00,0x11,0xa4,0x17,0x00,0x2c,0xb7,0xbf,0x2b,0x02,
+0x80,0x55,0x55,0x20,0x00,0x03,0xff,0xff,0x90,0x72,0x03,0x10,0x40,0x84,0x01,0x00,
+0xda,0x03,0x90,0xfc,0x44,0x40,0x0c,0xff,0xff,0xff,0xf0,0x0e,0xdd,0x02,0x40,0x0d,
+0xff,0xff,0xfe,0x45,0x02,0x10,0xf6,0xc9,0x01,0xa0,0xc0,0x00,0x00,0x00,0xff,0x30,
+0x00,0x00,0x03,0xfa,0xf4,0x01,0x10,0xf1,0x3e,0x03,0x14,0x50,0x9f,0x00,0xb0,0x35,
+0x6e,0xf7,0x54,0x00,0x00,0xff,0xf9,0x8f,0xff,0x10,0x1d,0x01,0x00,0x06,0x00,0xf0,
+0x02,0xfa,0x24,0x44,0x01,0x00,0xff,0xf4,0xef,0xff,0x3e,0x20,0xff,0xf4,0xff,0xff,
+0x3f,0xe2,0x06,0x00,0x41,0x43,0x31,0xff,0xf4,0x5f,0x01,0x07,0x06,0x00,0x20,0x23,
+0x30,0x06,0x00,0x22,0x00,0x00,0x06,0x00,0x71,0x7a,0xaa,0xaa,0xa2,0x00,0x00,0x03,
+0x56,0x00,0x20,0x1f,0x70,0x6a,0x00,0x31,0xef,0xfa,0x10,0x50,0x06,0x10,0xd0,0x80,
+0x04,0x80,0xff,0xf7,0x00,0x04,0xff,0xff,0xff,0xfb,0x75,0x02,0x40,0xff,0xfd,0x00,
+0x09,0x6d,0x00,0x20,0x00,0x0d,0x06,0x00,0x20,0x30,0x7f,0x06,0x00,0x11,0xd0,0x53,
+0x01,0x30,0xf4,0x13,0x33,0xb9,0x01,0x40,0x00,0x00,0xcf,0xf2,0x48,0x00,0x61,0x29,
+0x50,0x00,0x00,0x5a,0xaa,0x01,0x00,0x12,0x2f,0x03,0x01,0xf8,0x28,0xf9,0xfa,0x0d,
+0x01,0xb0,0xd0,0xa2,0x0f,0xaf,0xeb,0xfb,0xcf,0xbf,0xbe,0xcb,0xfa,0xff,0xe1,0x98,
+0x1c,0x1c,0x15,0xff,0xaf,0xfd,0x08,0x70,0xb0,0xb0,0x3f,0xfa,0xff,0xdf,0xdd,0xdd,
+0xdd,0xfd,0xdf,0xaf,0xa0,0xd0,0x00,0x00,0x0a,0x20,0xfa,0xfe,0xaf,0xaa,0xaa,0xaa,
+0xeb,0xaf,0x9a,0xff,0x80,0x01,0x31,0x41,0x00,0x00,0x9e,0x00,0x10,0xd0,0x09,0x03,
+0x30,0x8f,0xff,0xfc,0x68,0x00,0x60,0xff,0xff,0xff,0x50,0x00,0x03,0x69,0x01,0x41,
+0xe0,0x00,0x3c,0xff,0xae,0x00,0x00,0xdd,0x06,0x00,0x45,0x01,0x21,0x9e,0xff,0x2e,
+0x04,0x00,0x8f,0x04,0x31,0xff,0xf1,0x00,0x9c,0x04,0x12,0xf9,0xa9,0x04,0x02,0x7f,
+0x03,0x13,0x05,0x0f,0x04,0x22,0x4f,0xf3,0x5f,0x00,0x70,0x76,0x00,0x00,0x00,0x34,
+0x44,0x43,0x4f,0x01,0x20,0xfb,0x8a,0x05,0x00,0xd0,0x8f,0xa0,0xff,0xff,0xfb,0x7f,
+0xf8,0xff,0xff,0xfc,0x11,0x11,0xff,0x98,0x07,0x0f,0x05,0x00,0x10,0x50,0xbd,0xdd,
+0xdd,0xdd,0xd8,0x9f,0x01,0x11,0x54,0xb5,0x04,0xf0,0x2a,0x6c,0xff,0xff,0xff,0xd8,
+0x10,0x00,0x04,0xef,0xff,0xdb,0xbc,0xff,0xff,0x70,0x08,0xff,0xd6,0x10,0x00,0x00,
+0x4b,0xff,0xb0,0xbf,0x70,0x00,0x13,0x32,0x00,0x05,0xed,0x10,0x30,0x06,0xdf,0xff,
+0xfe,0x80,0x01,0x10,0x00,0x0b,0xff,0xfc,0xce,0xff,0xd2,0x00,0x00,0x00,0xbe,0x60,
+0x00,0x04,0xde,0x10,0x23,0x05,0x41,0x03,0x40,0x00,0x10,0x2a,0x06,0x22,0xff,0x80,
+0xa2,0x00,0x32,0x6f,0xfa,0x00,0x06,0x04,0x20,0xac,0x30,0xfd,0x07,0x02,0x1d,0x01,
+0x31,0xd2,0x0f,0xea,0x68,0x01,0xd0,0xcf,0x90,0xfa,0x48,0x88,0x88,0x88,0x88,0x65,
+0xff,0x1f,0xa9,0xff,0xab,0x01,0x32,0x1a,0xf1,0xfa,0xfa,0x02,0xc0,0xaf,0x1f,0xa5,
+0x99,0x99,0x99,0x99,0x98,0x5f,0xf1,0xfd,0x99,0x01,0x00,0x33,0x9b,0xfa,0x0b,0x98,
+0x02,0x03,0x8b,0x06,0x0f,0x4d,0x00,0x06,0x22,0x30,0x05,0x4d,0x00,0x23,0xf7,0x00,
+0x4d,0x00,0x22,0x70,0x01,0x4d,0x00,0x2f,0x94,0x00,0x4d,0x00,0x1e,0x22,0x00,0x00,
+0x4d,0x00,0x23,0xf0,0x00,0x4d,0x00,0x22,0x00,0x00,0x4d,0x00,0x2f,0x90,0x00,0x4d,
+0x00,0x1d,0x23,0x85,0x00,0x4d,0x00,0x22,0xa0,0x00,0x4d,0x00,0x23,0xfa,0x00,0x4d,
+0x00,0x2f,0x60,0x00,0x4d,0x00,0x1d,0x22,0x00,0x00,0x4d,0x00,0x01,0x0c,0x02,0x00,
+0x4d,0x00,0x02,0x62,0x01,0x13,0xaf,0x11,0x00,0x0f,0x4d,0x00,0x09,0x00,0x01,0x00,
+0x23,0x5c,0x50,0x95,0x02,0x02,0x0e,0x07,0x21,0x03,0xd0,0x11,0x00,0x31,0x64,0x00,
+0xa5,0x56,0x09,0xf0,0x0a,0xbf,0xf6,0x4e,0x21,0x11,0x11,0x17,0xd3,0x0f,0xff,0xec,
+0xce,0xec,0xcc,0xcc,0xef,0xe1,0x7f,0xe3,0x00,0x2d,0x00,0x00,0x06,0x80,0xd9,0x01,
+0x32,0x97,0x0a,0xa6,0x44,0x00,0x14,0xcc,0x98,0x06,0x29,0x2f,0xfa,0x5c,0x00,0x20,
+0x01,0x10,0x89,0x00,0xf2,0x42,0xff,0xe8,0x00,0x00,0xdf,0xf8,0xcf,0xf8,0x00,0x7f,
+0xff,0x81,0xdf,0xf1,0x0c,0xfa,0xf8,0x52,0xdf,0x60,0xff,0x64,0x78,0x3a,0xf8,0x0f,
+0xff,0x50,0x08,0xff,0xa1,0xff,0xff,0x12,0xff,0xfa,0x0f,0xff,0x41,0x15,0xff,0xa0,
+0xef,0x46,0x88,0x48,0xf8,0x0b,0xfc,0xf8,0x42,0xef,0x50,0x5f,0xff,0x82,0xef,0xf1,
+0x00,0xaf,0xfa,0xef,0xf6,0x00,0x00,0x5a,0xdc,0xa4,0x00,0x00,0x01,0x56,0x63,0x00,
+0x00,0x78,0x8b,0xff,0xfe,0x88,0x82,0x53,0x03,0x70,0x12,0x22,0x22,0x22,0x22,0x20,
+0x3f,0x0c,0x00,0xcf,0x90,0x3f,0xfc,0xfc,0xfe,0xdf,0x90,0x3f,0xd5,0xf4,0xeb,0x7f,
+0x06,0x00,0x07,0x61,0xe6,0xf5,0xec,0x8f,0x90,0x2f,0x54,0x03,0x52,0x07,0x9a,0xaa,
+0xaa,0xa9,0x95,0x07,0x12,0x14,0xf7,0x00,0x22,0xef,0xa0,0x89,0x06,0x10,0xf9,0x0d,
+0x00,0x30,0xc3,0xdf,0xff,0x3b,0x09,0x30,0xfd,0x3d,0xf5,0x1a,0x00,0x40,0xff,0xd3,
+0x50,0x00,0x49,0x06,0x02,0x0d,0x00,0x21,0xff,0x60,0x0d,0x00,0x15,0xf6,0x0d,0x00,
+0x11,0x0b,0x0d,0x00,0x00,0x51,0x04,0x11,0x60,0x88,0x07,0x11,0xf6,0x4b,0x07,0x13,
+0x86,0x66,0x01,0x10,0x8b,0x73,0x05,0x14,0xb6,0xb8,0x01,0xf0,0x0d,0xf2,0x00,0xbf,
+0xff,0xf8,0xbf,0xf6,0xef,0xff,0x40,0xbf,0xff,0xff,0x10,0xa4,0x09,0xff,0xf4,0xaf,
+0xff,0xff,0xfd,0x10,0x07,0xff,0xff,0x4d,0xff,0x21,0x09,0xf4,0x07,0xbf,0xff,0xf4,
+0x1d,0xff,0xff,0xf4,0x06,0x10,0xbf,0xff,0x40,0x1d,0xff,0xff,0x47,0xfd,0x2b,0xff,
+0xf4,0x00,0x1d,0xb7,0x01,0x31,0x1c,0xff,0xff,0xcf,0x06,0xf0,0x00,0x08,0x99,0x99,
+0x70,0x00,0xbf,0xff,0xff,0xf8,0x0a,0xd0,0xd0,0xd0,0xeb,0x9f,0x05,0x00,0x60,0xff,
+0xd1,0xd1,0xd1,0xeb,0xff,0xe6,0x04,0x0f,0x05,0x00,0x0b,0x10,0xef,0xc6,0x05,0x52,
+0x5c,0xdd,0xdd,0xdd,0xb2,0x9f,0x00,0x11,0xb0,0x37,0x05,0x20,0x0b,0xf0,0x70,0x08,
+0xa2,0x00,0x0f,0xf0,0x0a,0xff,0x21,0x11,0x11,0x1f,0xf0,0xad,0x00,0x12,0xf0,0x22,
+0x06,0x42,0xd0,0x08,0xff,0x10,0xbe,0x08,0x02,0x07,0x00,0x60,0x01,0x00,0x00,0x00,
+0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -3547,11 +3720,29 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 176, .range_length = 63475, .glyph_id_start = 115, .list_length = 704, .type = 3, .unicode_list = 6552, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[71127] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 6229, .size = 4038, .comp_size = 3561 },
+{ .bitmap_start = 4038, .comp_offset = 9790, .size = 4040, .comp_size = 3485 },
+{ .bitmap_start = 8078, .comp_offset = 13275, .size = 4081, .comp_size = 3494 },
+{ .bitmap_start = 12159, .comp_offset = 16769, .size = 4081, .comp_size = 3559 },
+{ .bitmap_start = 16240, .comp_offset = 20328, .size = 4077, .comp_size = 3609 },
+{ .bitmap_start = 20317, .comp_offset = 23937, .size = 4077, .comp_size = 3681 },
+{ .bitmap_start = 24394, .comp_offset = 27618, .size = 4048, .comp_size = 3626 },
+{ .bitmap_start = 28442, .comp_offset = 31244, .size = 4058, .comp_size = 3735 },
+{ .bitmap_start = 32500, .comp_offset = 34979, .size = 4087, .comp_size = 3668 },
+{ .bitmap_start = 36587, .comp_offset = 38647, .size = 4018, .comp_size = 3823 },
+{ .bitmap_start = 40605, .comp_offset = 42470, .size = 4062, .comp_size = 3715 },
+{ .bitmap_start = 44667, .comp_offset = 46185, .size = 4019, .comp_size = 3675 },
+{ .bitmap_start = 48686, .comp_offset = 49860, .size = 4026, .comp_size = 3714 },
+{ .bitmap_start = 52712, .comp_offset = 53574, .size = 4044, .comp_size = 3541 },
+{ .bitmap_start = 56756, .comp_offset = 57115, .size = 3069, .comp_size = 2215 },
+};
+
+static uint8_t etxUncompBuf[11302] __SDRAMFONTS;
 
 const etxLz4Font lv_font_tw_XXS = {
-.uncomp_size = 70863,
-.comp_size = 56563,
+.uncomp_size = 11038,
+.comp_size = 6229,
 .line_height = 15,
 .base_line = 3,
 .subpx = 0,
@@ -3564,12 +3755,13 @@ const etxLz4Font lv_font_tw_XXS = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 36,
-.glyph_bitmap = 7960,
-.class_pair_values = 67785,
-.left_class_mapping = 69225,
-.right_class_mapping = 70044,
+.class_pair_values = 7960,
+.left_class_mapping = 9400,
+.right_class_mapping = 10219,
+.block_num = 15,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 71127,
+.lvglFontBufSize = 11302,
 };
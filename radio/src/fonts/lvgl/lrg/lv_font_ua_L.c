@@ -85,39 +85,129 @@ static const uint8_t lz4FontData[] ={
 0x1a,0xff,0x00,0x00,0x00,0x54,0x03,0x56,0x03,0x57,0x03,0x00,0x00,0x01,0x02,0x03,
 0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,
 0x14,0x15,0x16,0x17,0x18,0x19,0x1a,0x1b,0x1c,0x00,0x00,0x1d,0x00,0x1e,0x1f,0x9e,
-0x05,0xe5,0x20,0x00,0x21,0x22,0x0f,0xff,0x50,0xff,0xf5,0x0f,0xff,0x40,0xff,0xf4,
-0x05,0x00,0xf3,0x0e,0xf3,0x0f,0xff,0x30,0xff,0xf3,0x0e,0xff,0x30,0xef,0xf3,0x0e,
-0xff,0x20,0xef,0xf2,0x0e,0xff,0x20,0xdf,0xf2,0x0d,0xff,0x20,0xdf,0xf1,0x0c,0xff,
-0x10,0xe1,0x05,0xf1,0x03,0x05,0xca,0x11,0xff,0xf8,0x1f,0xff,0x90,0x8f,0xd2,0x9f,
-0xd0,0x0d,0xf9,0x9f,0xe0,0x0d,0xf9,0x08,0x00,0xf0,0x11,0xc0,0x0d,0xf8,0x9f,0xb0,
-0x0d,0xf7,0x9f,0xa0,0x0d,0xf5,0x9f,0x80,0x0d,0xf4,0x9f,0x70,0x0d,0xf3,0x9f,0x60,
-0x0d,0xf2,0x00,0x00,0x00,0x03,0xff,0x40,0x00,0x1f,0xf7,0x3b,0x00,0x60,0x06,0xff,
-0x10,0x00,0x4f,0xf4,0x0a,0x00,0x60,0x0a,0xfe,0x00,0x00,0x7f,0xf0,0x0a,0x00,0x60,
-0x0d,0xfa,0x00,0x00,0xbf,0xd0,0x0a,0x00,0x90,0x0f,0xf7,0x00,0x00,0xef,0xa0,0x00,
-0x00,0x00,0x24,0x00,0x51,0x01,0xff,0x60,0x00,0x00,0x24,0x00,0x63,0x04,0xff,0x30,
-0x00,0x09,0xff,0x01,0x00,0x16,0xfb,0x0a,0x00,0xa2,0x04,0x88,0x89,0xff,0xb8,0x88,
-0x8f,0xfd,0x88,0x85,0x63,0x00,0x15,0x0f,0x63,0x00,0x11,0x3f,0x63,0x00,0x10,0x09,
-0x63,0x00,0x10,0xf1,0x0a,0x00,0x61,0x0c,0xfb,0x00,0x00,0xaf,0xe0,0x63,0x00,0x50,
-0xf8,0x00,0x00,0xdf,0xb0,0x0a,0x00,0x94,0x2f,0xf5,0x00,0x00,0xff,0x80,0x00,0x00,
-0xef,0x50,0x00,0x16,0x60,0x0a,0x00,0xf0,0x02,0x77,0x77,0xdf,0xe7,0x77,0x7c,0xff,
-0x77,0x77,0x30,0x00,0x00,0xef,0x90,0x00,0x0b,0xfc,0x31,0x00,0x00,0x91,0x00,0x20,
-0x0e,0xf9,0x0a,0x00,0x00,0x91,0x00,0x20,0x1f,0xf6,0x0a,0x00,0x10,0x07,0xd0,0x00,
-0x11,0xf3,0xd0,0x00,0x18,0xfd,0xd0,0x00,0x15,0xaf,0xd0,0x00,0x23,0xdf,0xa0,0x36,
-0x01,0x23,0xad,0xb0,0x09,0x00,0x2f,0xcf,0xd0,0x09,0x00,0x04,0x41,0x01,0x7b,0xff,
-0xfb,0xf4,0x00,0x60,0x6f,0xff,0xff,0xff,0xfe,0x30,0xcb,0x00,0x00,0x01,0x00,0xf0,
-0x00,0xf3,0x00,0x00,0x2f,0xff,0xe5,0x10,0x28,0xff,0xfd,0x00,0x00,0x9f,0xfe,0x10,
-0x1f,0x00,0x40,0x50,0x00,0xdf,0xf7,0xd7,0x00,0x51,0xff,0xb0,0x00,0xff,0xf3,0xf4,
-0x00,0x12,0xe0,0x09,0x00,0x60,0x03,0xff,0xf0,0x00,0xff,0xf5,0x4c,0x00,0x53,0xaa,
-0xa0,0x00,0xcf,0xfb,0x60,0x00,0x32,0x7f,0xff,0x90,0x09,0x00,0x41,0x0e,0xff,0xfd,
-0x50,0x09,0x00,0x51,0x03,0xef,0xff,0xfe,0x93,0x0a,0x00,0x51,0x2c,0xff,0xff,0xff,
-0xc3,0x0a,0x00,0x51,0x5c,0xff,0xff,0xff,0x80,0x0a,0x00,0x31,0x28,0xef,0xff,0xe8,
-0x00,0x00,0xe0,0x00,0x22,0xff,0x50,0x0a,0x00,0x52,0x3f,0xff,0xc0,0x00,0x00,0x60,
-0x01,0x40,0xf1,0x0a,0xaa,0x20,0x0a,0x00,0x00,0x2d,0x02,0x11,0x40,0x09,0x00,0x41,
-0xf4,0x0d,0xff,0x70,0x22,0x01,0x41,0xf3,0x09,0xff,0xe0,0x37,0x00,0x30,0xf0,0x03,
-0xff,0x7e,0x00,0xe1,0x5f,0xff,0xa0,0x00,0xaf,0xff,0xe8,0x55,0x7c,0xff,0xff,0x20,
-0x00,0x0b,0xcf,0x00,0x00,0x9b,0x01,0x10,0x7e,0xbf,0x01,0x01,0x44,0x00,0x42,0x48,
-0xff,0xc5,0x10,0xfd,0x00,0x03,0x7c,0x00,0x0d,0x09,0x00,0x44,0x06,0xcf,0xfd,0x70,
-0x5b,0x08,0x43,0xbf,0xff,0xff,0xfd,0x86,0x02,0x63,0x08,0xff,0xa4,0x49,0xff,0xa0,
+0x05,0x58,0x20,0x00,0x21,0x22,0x00,0x01,0x00,0x2f,0xf5,0x00,0x01,0x00,0x29,0x13,
+0xe2,0x08,0x00,0x17,0xde,0x14,0x00,0xbf,0xf2,0xef,0x00,0xfa,0xef,0x00,0xea,0x00,
+0x00,0x00,0x03,0x58,0x00,0x26,0x4f,0x06,0x05,0x00,0x06,0x3c,0x00,0x25,0x2f,0xd0,
+0x00,0x01,0x00,0x3b,0x1f,0xc1,0x44,0x00,0x30,0x03,0x20,0x01,0xb1,0xef,0x00,0xfd,
+0x00,0x00,0xdc,0xfb,0xe8,0xed,0x00,0xe6,0x11,0x00,0x00,0x0f,0x00,0x4f,0xfb,0xfd,
+0xf2,0xf7,0x2a,0x01,0x24,0x6f,0xf8,0x00,0xf9,0x00,0x00,0xf1,0x96,0x00,0x27,0x17,
+0xf9,0x4a,0x00,0x04,0x8f,0x00,0x07,0x01,0x00,0x1f,0xfb,0x4c,0x00,0x19,0x51,0xe3,
+0x00,0x00,0x00,0xfa,0x4a,0x00,0x5f,0xfa,0x00,0xfa,0xf4,0xfa,0x34,0x01,0x30,0x15,
+0x06,0x88,0x00,0x11,0xfb,0x8b,0x00,0x2f,0xfb,0xf9,0x56,0x00,0x1d,0x11,0xbe,0x0e,
+0x02,0x15,0xb6,0x4a,0x00,0x62,0xf6,0xfa,0x00,0x00,0xfa,0xf9,0x04,0x00,0x0f,0x01,
+0x00,0x1f,0x13,0x05,0x28,0x01,0x2f,0x05,0xf8,0xda,0x00,0x2d,0x1f,0xfa,0x99,0x02,
+0x33,0x59,0xee,0x00,0x00,0x00,0xf7,0xcf,0x01,0x20,0xfa,0xf8,0x5e,0x00,0x2f,0xf5,
+0xee,0x45,0x00,0x18,0x14,0xa2,0xde,0x00,0x96,0xee,0x00,0x00,0xb3,0xf1,0xcf,0xd8,
+0x00,0xbd,0x1c,0x00,0x3f,0xf4,0xdb,0xe6,0x93,0x00,0x1c,0x91,0xa5,0x00,0x00,0x00,
+0xd9,0x00,0xc8,0x00,0x00,0x9b,0x00,0xcf,0xf9,0x00,0xfd,0xfc,0x00,0x00,0xfc,0x00,
+0x00,0x04,0x00,0x04,0xe5,0x00,0x25,0x6f,0xf4,0x00,0xf8,0xfa,0x00,0xf6,0x2f,0x01,
+0x31,0x10,0xea,0x46,0x02,0x1f,0xf3,0x3d,0x00,0x24,0x01,0x27,0x05,0xc0,0xc3,0xbf,
+0x00,0x00,0xea,0xf8,0xbd,0xfc,0x05,0x00,0x05,0x04,0x0f,0x02,0xdf,0xe0,0xe4,0x00,
+0xe1,0xe4,0xeb,0xdf,0x00,0xe5,0xec,0xf0,0xea,0xef,0xda,0x02,0x1a,0x66,0xc1,0xf6,
+0x00,0x00,0xeb,0xfc,0x5b,0x02,0xa3,0xf3,0xf4,0x00,0x00,0xf3,0xf8,0x00,0x00,0xf8,
+0xfd,0x69,0x02,0x0f,0x01,0x00,0x14,0x40,0x04,0x00,0xdd,0xef,0x24,0x01,0x14,0x00,
+0x61,0x01,0x73,0x03,0xf7,0xf7,0x00,0x00,0xf7,0xfa,0xbd,0x03,0x0f,0x76,0x01,0x1b,
+0x14,0xf3,0x13,0x04,0x15,0x04,0x1f,0x04,0x10,0xfa,0x50,0x02,0x1f,0xf7,0x95,0x04,
+0x1b,0xff,0x11,0x06,0xf2,0xc5,0xf1,0x00,0x00,0xe6,0xf8,0xe5,0xfc,0x05,0xe5,0x05,
+0x05,0x04,0x05,0x00,0x05,0xeb,0xee,0xfa,0xf5,0xee,0xf5,0xf0,0xfa,0xf5,0xfa,0x00,
+0xfa,0xf8,0x05,0x7b,0x01,0x1d,0x2a,0x04,0xf9,0x3b,0x03,0x10,0xfa,0x0c,0x04,0x1f,
+0xf8,0x85,0x03,0x23,0x1f,0xfb,0xd6,0x04,0x1c,0x0c,0x01,0x00,0x1f,0xed,0x1d,0x00,
+0x09,0x1f,0xfc,0xbc,0x05,0x1b,0x0f,0x01,0x00,0x08,0x3f,0xfd,0x00,0xfc,0x4d,0x00,
+0x17,0x1f,0xfd,0xea,0x06,0x36,0x1f,0xfc,0xde,0x00,0x36,0x1e,0x05,0xbf,0x07,0x17,
+0x05,0x6f,0x06,0x0f,0xe4,0x02,0x18,0x1f,0xe3,0xce,0x07,0x3c,0x0f,0x8b,0x05,0x31,
+0x1f,0xda,0x28,0x01,0x0b,0x2f,0xfa,0xfc,0x54,0x06,0x1a,0x1c,0xdd,0x6b,0x04,0x20,
+0xfb,0x04,0x97,0x00,0x4f,0x0e,0x00,0x05,0x05,0xe1,0x00,0x62,0x17,0x04,0xd8,0x09,
+0x05,0xd5,0x00,0x4f,0xfc,0x04,0x00,0xfc,0x80,0x00,0x22,0x1f,0xdd,0xbc,0x01,0x4a,
+0x1f,0xfa,0xf9,0x02,0x36,0x1f,0xfc,0x89,0x00,0x72,0x0f,0x01,0x00,0x06,0xde,0x13,
+0x00,0xfa,0x0d,0x00,0xf3,0xfa,0xf3,0xd3,0xe7,0xed,0x00,0xd3,0x5d,0x03,0x3f,0xf3,
+0xfa,0x06,0xe5,0x05,0x17,0x01,0xaf,0x00,0x7e,0xfa,0xe6,0xf3,0xfa,0xf3,0xe6,0xfa,
+0x2a,0x02,0x1f,0xf3,0x0c,0x05,0x16,0xe8,0xf3,0xf3,0xed,0xfa,0x00,0xed,0x00,0xed,
+0xd9,0xed,0xed,0xe7,0xe6,0xed,0x6d,0x02,0x11,0xfa,0x20,0x00,0x4f,0xfa,0x00,0xfa,
+0xed,0x19,0x01,0x12,0x73,0xd9,0xd9,0x00,0xf3,0xe0,0xf3,0xe0,0x15,0x0b,0x40,0xed,
+0xe0,0x00,0xe0,0x13,0x00,0x90,0x00,0xe0,0x00,0x00,0xe0,0xe0,0xe0,0xd9,0xe0,0x53,
+0x08,0x4f,0x00,0x00,0xe0,0xd9,0x3e,0x0a,0x1b,0x36,0xf3,0x00,0xec,0x3d,0x01,0x05,
+0x51,0x0a,0x1f,0x0d,0x10,0x07,0x1c,0x0f,0x57,0x03,0x33,0x10,0xfa,0x4d,0x00,0x35,
+0xfa,0x06,0x0d,0xd7,0x0a,0x18,0xf9,0x48,0x00,0x1f,0xfa,0x4b,0x00,0x1a,0x00,0x02,
+0x00,0x6f,0xf3,0xfa,0xfa,0x00,0xf3,0xfa,0x3e,0x03,0x30,0x4f,0xfa,0x00,0x06,0xec,
+0x4c,0x05,0x3b,0x0d,0x88,0x02,0x0f,0xc8,0x0d,0x21,0x01,0x99,0x00,0x09,0x3d,0x00,
+0x11,0x06,0x02,0x00,0x0f,0x2b,0x01,0x14,0x53,0xf3,0xf3,0xf3,0x00,0xfa,0xc3,0x01,
+0x37,0xe6,0xf3,0xf3,0xcc,0x01,0x1f,0xfa,0xc0,0x01,0x1c,0x71,0xd9,0xd9,0xfa,0xf3,
+0xe0,0xfa,0xf3,0x2e,0x03,0x30,0xe6,0x00,0xf3,0xe5,0x02,0x24,0xd3,0xe7,0x1d,0x00,
+0x1f,0xe7,0x16,0x08,0x12,0x05,0x94,0x00,0xc3,0x00,0xfa,0xed,0xfa,0xf3,0x00,0x00,
+0xed,0xed,0x00,0xe0,0xed,0xd9,0x00,0x1f,0x0d,0x55,0x02,0x21,0x73,0xed,0xed,0x06,
+0xfa,0xf3,0x00,0xe6,0x79,0x00,0x20,0xf3,0xe6,0x88,0x00,0x10,0xe0,0x8e,0x00,0x90,
+0xe7,0xe6,0xe7,0x00,0xd3,0xe0,0xe0,0x00,0xe0,0x0c,0x00,0x1f,0xe0,0xde,0x00,0x11,
+0x01,0xd3,0x00,0x14,0xed,0x4a,0x00,0xf0,0x01,0x00,0xf3,0xe0,0xe6,0xd3,0xd9,0xed,
+0xe0,0xe6,0xed,0xe6,0xd9,0xe6,0xe6,0xd9,0xe6,0x71,0x03,0x12,0xe6,0x7d,0x03,0x0f,
+0xde,0x00,0x0e,0x13,0xed,0x06,0x01,0x6e,0xe0,0xe6,0x00,0x00,0xf3,0xec,0x32,0x09,
+0x0f,0x88,0x0a,0x1c,0x01,0x96,0x00,0x1e,0xed,0x62,0x02,0x0f,0xa0,0x04,0x19,0x0b,
+0xc5,0x03,0x1f,0x0d,0xe8,0x02,0x36,0x0e,0xd2,0x02,0x0f,0x5c,0x00,0x16,0x00,0x33,
+0x05,0xbf,0xec,0xf3,0xf3,0x00,0xf3,0xc6,0x00,0x00,0xe6,0xd3,0xe6,0x8a,0x0a,0x29,
+0x40,0xe7,0xf3,0x00,0xe6,0x29,0x03,0x32,0xe0,0x00,0x00,0x7d,0x05,0x04,0x54,0x10,
+0x2f,0xe6,0xfa,0x19,0x09,0x3b,0x2f,0xf3,0xfa,0x37,0x0d,0x24,0x11,0xf3,0x8d,0x00,
+0x11,0xfa,0x07,0x00,0x00,0x05,0x00,0x00,0xb4,0x04,0x2f,0xed,0xed,0x4c,0x00,0x21,
+0x20,0xfa,0xfa,0x04,0x00,0x11,0xfa,0xff,0x01,0x02,0x01,0x05,0x21,0xf3,0xfa,0xfe,
+0x00,0x0f,0x94,0x00,0x23,0x14,0xf3,0x49,0x02,0x1d,0xf3,0x18,0x04,0x0f,0xd5,0x05,
+0x1e,0x15,0xf3,0xe4,0x02,0x22,0xed,0xfa,0x21,0x04,0x0f,0x51,0x02,0x30,0x1f,0x06,
+0x51,0x08,0x25,0x13,0xfa,0x21,0x01,0x04,0xdf,0x05,0x00,0x3a,0x01,0x0f,0x94,0x00,
+0x22,0x23,0x0d,0x0d,0x75,0x05,0x00,0x8d,0x00,0x00,0x09,0x00,0x2f,0x06,0x06,0x3c,
+0x03,0x39,0x1f,0xf3,0x94,0x02,0x28,0x1f,0xfa,0x5c,0x06,0x2b,0x06,0x0a,0x02,0x16,
+0xfa,0x4f,0x04,0x10,0xf3,0x54,0x02,0x0f,0x4a,0x00,0x27,0x01,0x94,0x00,0x17,0xec,
+0x4a,0x00,0x1f,0xfa,0x5c,0x04,0x2d,0x1f,0x06,0x9f,0x0c,0x28,0x11,0xfa,0x8d,0x02,
+0x15,0x13,0x9b,0x00,0x1f,0xfa,0x28,0x01,0x26,0x20,0xfa,0x06,0x4a,0x00,0x13,0x06,
+0xd8,0x00,0x11,0xf9,0x87,0x03,0x0f,0x2e,0x03,0x29,0x07,0xfc,0x01,0x12,0xf3,0x3f,
+0x03,0x0f,0x0c,0x04,0x23,0x01,0xd5,0x00,0x04,0x2a,0x08,0x00,0x0c,0x00,0x0f,0xbc,
+0x01,0x26,0x09,0x4a,0x00,0x0f,0x32,0x05,0x34,0x1f,0xfa,0x9a,0x02,0x2c,0x09,0x01,
+0x00,0x11,0xd3,0x52,0x13,0x0f,0xe4,0x02,0x27,0x04,0x6c,0x01,0x02,0x0c,0x02,0x00,
+0x28,0x01,0x30,0x01,0x00,0x02,0x0f,0x00,0x31,0x02,0x03,0x00,0x99,0x13,0x0e,0x65,
+0x0e,0x02,0x45,0x18,0x20,0x00,0x0c,0x47,0x18,0x92,0x0c,0x0c,0x09,0x10,0x11,0x12,
+0x00,0x13,0x0d,0x4c,0x18,0x01,0x20,0x00,0x00,0x51,0x18,0x40,0x1d,0x1e,0x00,0x1f,
+0x4e,0x18,0xff,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,
+0x24,0x27,0x28,0x87,0x00,0x03,0xf5,0x2c,0x29,0x2a,0x2b,0x2c,0x2d,0x2e,0x2f,0x30,
+0x00,0x00,0x31,0x32,0x33,0x00,0x34,0x00,0x35,0x36,0x37,0x38,0x39,0x3a,0x3b,0x00,
+0x00,0x3c,0x3d,0x3e,0x00,0x3f,0x40,0x41,0x42,0x00,0x43,0x44,0x45,0x00,0x00,0x46,
+0x47,0x48,0x00,0x49,0x00,0x4a,0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x00,0x00,0x51,0x52,
+0x53,0x00,0x00,0xb0,0x00,0x20,0x03,0x02,0xab,0x00,0x4b,0x06,0x07,0x06,0x08,0x5d,
+0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,
+0x24,0x0b,0x00,0x00,0x19,0xd1,0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,
+0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,
+0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0xb0,0x00,0x01,0xf2,0x02,0x24,0x00,0x00,
+0x00,0x25,0x00,0x26,0x27,0x00,0x00,0x00,0x28,0x29,0x00,0x2a,0x2b,0x00,0xbe,0x00,
+0x10,0x31,0x1c,0x00,0x33,0x32,0x33,0x34,0xbf,0x00,0xf0,0x08,0x3c,0x3d,0x3e,0x3f,
+0x40,0x41,0x3d,0x42,0x43,0x44,0x45,0x46,0x47,0x36,0x48,0x36,0x3d,0x49,0x3b,0x4a,
+0x00,0x00,0x00,0xa5,0x0f,0xff,0x50,0xff,0xf5,0x0f,0xff,0x40,0xff,0xf4,0x05,0x00,
+0xf2,0x0f,0xf3,0x0f,0xff,0x30,0xff,0xf3,0x0e,0xff,0x30,0xef,0xf3,0x0e,0xff,0x20,
+0xef,0xf2,0x0e,0xff,0x20,0xdf,0xf2,0x0d,0xff,0x20,0xdf,0xf1,0x0c,0xff,0x10,0x00,
+0x01,0x00,0xf1,0x03,0x05,0xca,0x11,0xff,0xf8,0x1f,0xff,0x90,0x8f,0xd2,0x9f,0xd0,
+0x0d,0xf9,0x9f,0xe0,0x0d,0xf9,0x08,0x00,0xf0,0x11,0xc0,0x0d,0xf8,0x9f,0xb0,0x0d,
+0xf7,0x9f,0xa0,0x0d,0xf5,0x9f,0x80,0x0d,0xf4,0x9f,0x70,0x0d,0xf3,0x9f,0x60,0x0d,
+0xf2,0x00,0x00,0x00,0x03,0xff,0x40,0x00,0x1f,0xf7,0x3b,0x00,0x60,0x06,0xff,0x10,
+0x00,0x4f,0xf4,0x0a,0x00,0x60,0x0a,0xfe,0x00,0x00,0x7f,0xf0,0x0a,0x00,0x60,0x0d,
+0xfa,0x00,0x00,0xbf,0xd0,0x0a,0x00,0x90,0x0f,0xf7,0x00,0x00,0xef,0xa0,0x00,0x00,
+0x00,0x24,0x00,0x51,0x01,0xff,0x60,0x00,0x00,0x24,0x00,0x63,0x04,0xff,0x30,0x00,
+0x09,0xff,0x01,0x00,0x16,0xfb,0x0a,0x00,0xa2,0x04,0x88,0x89,0xff,0xb8,0x88,0x8f,
+0xfd,0x88,0x85,0x63,0x00,0x15,0x0f,0x63,0x00,0x11,0x3f,0x63,0x00,0x10,0x09,0x63,
+0x00,0x10,0xf1,0x0a,0x00,0x61,0x0c,0xfb,0x00,0x00,0xaf,0xe0,0x63,0x00,0x50,0xf8,
+0x00,0x00,0xdf,0xb0,0x0a,0x00,0x94,0x2f,0xf5,0x00,0x00,0xff,0x80,0x00,0x00,0xef,
+0x50,0x00,0x16,0x60,0x0a,0x00,0xf0,0x02,0x77,0x77,0xdf,0xe7,0x77,0x7c,0xff,0x77,
+0x77,0x30,0x00,0x00,0xef,0x90,0x00,0x0b,0xfc,0x31,0x00,0x00,0x91,0x00,0x20,0x0e,
+0xf9,0x0a,0x00,0x00,0x91,0x00,0x20,0x1f,0xf6,0x0a,0x00,0x10,0x07,0xd0,0x00,0x11,
+0xf3,0xd0,0x00,0x18,0xfd,0xd0,0x00,0x15,0xaf,0xd0,0x00,0x23,0xdf,0xa0,0x36,0x01,
+0x23,0xad,0xb0,0x09,0x00,0x2f,0xcf,0xd0,0x09,0x00,0x04,0x41,0x01,0x7b,0xff,0xfb,
+0xf4,0x00,0x60,0x6f,0xff,0xff,0xff,0xfe,0x30,0xcb,0x00,0x00,0x01,0x00,0xf0,0x00,
+0xf3,0x00,0x00,0x2f,0xff,0xe5,0x10,0x28,0xff,0xfd,0x00,0x00,0x9f,0xfe,0x10,0x1f,
+0x00,0x40,0x50,0x00,0xdf,0xf7,0xd7,0x00,0x51,0xff,0xb0,0x00,0xff,0xf3,0xf4,0x00,
+0x12,0xe0,0x09,0x00,0x60,0x03,0xff,0xf0,0x00,0xff,0xf5,0x4c,0x00,0x53,0xaa,0xa0,
+0x00,0xcf,0xfb,0x60,0x00,0x32,0x7f,0xff,0x90,0x09,0x00,0x41,0x0e,0xff,0xfd,0x50,
+0x09,0x00,0x51,0x03,0xef,0xff,0xfe,0x93,0x0a,0x00,0x51,0x2c,0xff,0xff,0xff,0xc3,
+0x0a,0x00,0x51,0x5c,0xff,0xff,0xff,0x80,0x0a,0x00,0x31,0x28,0xef,0xff,0xe8,0x00,
+0x00,0xe0,0x00,0x22,0xff,0x50,0x0a,0x00,0x52,0x3f,0xff,0xc0,0x00,0x00,0x60,0x01,
+0x40,0xf1,0x0a,0xaa,0x20,0x0a,0x00,0x00,0x2d,0x02,0x11,0x40,0x09,0x00,0x41,0xf4,
+0x0d,0xff,0x70,0x22,0x01,0x41,0xf3,0x09,0xff,0xe0,0x37,0x00,0x30,0xf0,0x03,0xff,
+0x7e,0x00,0xe1,0x5f,0xff,0xa0,0x00,0xaf,0xff,0xe8,0x55,0x7c,0xff,0xff,0x20,0x00,
+0x0b,0xcf,0x00,0x00,0x9b,0x01,0x10,0x7e,0xbf,0x01,0x01,0x44,0x00,0x42,0x48,0xff,
+0xc5,0x10,0xfd,0x00,0x03,0x7c,0x00,0x0d,0x09,0x00,0x53,0x06,0xcf,0xfd,0x70,0x00,
+0x01,0x00,0x43,0xbf,0xff,0xff,0xfd,0x86,0x02,0x63,0x08,0xff,0xa4,0x49,0xff,0xa0,
 0xd7,0x00,0xe1,0xfb,0x00,0x00,0x8f,0xf1,0x00,0x00,0x0d,0x91,0x00,0x00,0x1f,0xf5,
 0x00,0xff,0x01,0x61,0x8f,0xe0,0x00,0x00,0x2f,0xf4,0x10,0x00,0x32,0x03,0xff,0x50,
 0xef,0x01,0x21,0x2f,0xf4,0x0a,0x02,0x72,0x00,0x0f,0xf9,0x00,0x00,0x6f,0xf2,0x1c,
@@ -149,8 +239,8 @@ static const uint8_t lz4FontData[] ={
 0x60,0x81,0x00,0x00,0x00,0x0b,0xf5,0xa5,0x01,0x40,0xf6,0x00,0x00,0x0a,0x14,0x01,
 0x20,0x6f,0xfa,0xe6,0x00,0x40,0xe0,0x00,0x00,0x09,0x21,0x02,0x60,0x2f,0xfe,0x00,
 0x00,0x00,0x9f,0x7f,0x01,0x00,0x78,0x01,0x10,0x04,0x12,0x03,0x10,0x09,0x26,0x00,
-0x10,0x0d,0xb1,0x00,0x10,0x1f,0xa0,0x00,0x20,0x4f,0xfe,0xbf,0x03,0x10,0xfc,0x4f,
-0x06,0x10,0xfb,0x2c,0x00,0x64,0xfa,0x00,0x00,0x00,0xaf,0xf9,0x05,0x00,0x24,0x9f,
+0x10,0x0d,0xb1,0x00,0x10,0x1f,0xa0,0x00,0x20,0x4f,0xfe,0xbf,0x03,0x00,0xc5,0x01,
+0x20,0x8f,0xfb,0x2c,0x00,0x64,0xfa,0x00,0x00,0x00,0xaf,0xf9,0x05,0x00,0x24,0x9f,
 0xfa,0x05,0x00,0x20,0x7f,0xfb,0x28,0x00,0x11,0xfd,0x58,0x03,0x01,0x80,0x01,0x10,
 0x20,0xce,0x03,0x10,0x50,0xca,0x00,0x10,0x90,0xca,0x00,0x10,0xd0,0x4d,0x02,0x10,
 0xf3,0x29,0x00,0x11,0xf9,0x7e,0x01,0x01,0x2e,0x02,0x23,0x80,0x00,0x8f,0x01,0x21,
@@ -241,1102 +331,1188 @@ static const uint8_t lz4FontData[] ={
 0x14,0xfd,0x91,0x0d,0x03,0x4f,0x00,0x00,0x4f,0x0d,0x03,0x08,0x02,0x03,0x4f,0x00,
 0x02,0x86,0x0a,0x04,0xc7,0x09,0x02,0xf4,0x0c,0x0b,0xc8,0x01,0x14,0x0e,0x33,0x0d,
 0x02,0xf2,0x00,0x02,0xf8,0x05,0x03,0x05,0x02,0x03,0xaf,0x0b,0x14,0x0c,0xd5,0x03,
-0x14,0x3f,0xff,0x04,0x15,0xaf,0xff,0x04,0x13,0xf4,0x35,0x00,0x22,0x04,0xad,0x6f,
-0x05,0x20,0x01,0xcf,0xf8,0x05,0x10,0x30,0x11,0x05,0x21,0xff,0xcc,0x0e,0x0e,0x11,
-0xaf,0xdd,0x06,0x51,0xfd,0x00,0x01,0xff,0xf8,0x87,0x04,0x42,0x40,0x05,0xff,0xf0,
-0x5a,0x02,0x32,0x06,0xff,0xd0,0x6f,0x05,0x13,0x05,0x09,0x00,0x41,0x90,0x02,0xff,
-0xf1,0x93,0x00,0x31,0x60,0x00,0xbf,0x78,0x0a,0x90,0xfe,0x00,0x00,0x2e,0xff,0xb4,
-0x00,0x39,0xff,0x8f,0x09,0x10,0xdf,0xef,0x04,0x11,0x50,0x87,0x00,0x11,0xff,0xa0,
-0x02,0x11,0x08,0x8d,0x06,0x10,0xa0,0x63,0x05,0x71,0x60,0x00,0x05,0xef,0xfa,0x00,
-0x03,0xde,0x00,0x62,0x2e,0xff,0x60,0x0a,0xff,0xa0,0x0d,0x06,0x02,0xde,0x00,0x67,
-0x02,0xff,0xf2,0x0f,0xff,0x30,0x05,0x0e,0x00,0x07,0x07,0x02,0xdb,0x02,0x61,0x05,
-0xff,0xf0,0x08,0xff,0xf2,0x90,0x00,0x20,0xb0,0x01,0x3d,0x02,0x61,0x03,0xcf,0xff,
-0x30,0x00,0x4f,0x91,0x0b,0x13,0xf7,0xb0,0x02,0x01,0x56,0x03,0x51,0x05,0xae,0xff,
-0xeb,0x71,0x89,0x01,0x30,0xbe,0xfe,0xc7,0x56,0x01,0x12,0x2d,0x8f,0x00,0x00,0x8e,
-0x00,0x10,0xde,0x78,0x0e,0x30,0x0d,0xff,0xe5,0xa4,0x00,0x40,0x10,0x06,0xff,0xf3,
-0x86,0x0b,0x42,0xfa,0x00,0xbf,0xf9,0x45,0x01,0x02,0x7b,0x00,0x32,0x0e,0xff,0x51,
-0x9f,0x01,0x22,0xaf,0xf9,0x67,0x06,0x14,0x07,0x39,0x03,0x22,0x6f,0xfc,0x22,0x00,
-0x51,0x06,0xff,0xd0,0xdf,0xf8,0xd0,0x01,0x41,0xfd,0x07,0xff,0xf2,0x3a,0x06,0x90,
-0xc0,0x1e,0xff,0xe4,0x00,0x02,0xbf,0xff,0xfc,0xbe,0x06,0x51,0xce,0xff,0xfc,0xff,
-0xb0,0xfd,0x03,0x95,0xe5,0x8f,0xf9,0x00,0x00,0x29,0xdf,0xfd,0x81,0xf1,0x03,0x04,
-0x26,0x02,0x24,0x3f,0xfe,0x02,0x02,0x19,0x90,0x99,0x05,0x01,0xc1,0x07,0x01,0xd4,
-0x05,0x10,0xfd,0x39,0x01,0x12,0xde,0x66,0x05,0x00,0xa2,0x02,0x12,0xe7,0xdf,0x10,
-0x20,0xc9,0x50,0xdb,0x05,0xaf,0xfa,0x08,0xff,0xf5,0x8f,0xff,0x51,0xcf,0xa0,0x00,
+0x14,0x3f,0xff,0x04,0x15,0xaf,0xff,0x04,0x60,0xf4,0x00,0x00,0x00,0x00,0x00,0xf3,
+0x31,0x00,0x00,0x04,0xad,0xff,0xeb,0x60,0x00,0x00,0x00,0x01,0xcf,0xff,0xff,0xff,
+0xfd,0x30,0x00,0x00,0x1d,0xff,0xff,0xcc,0xff,0xff,0xf3,0x00,0x00,0xaf,0xff,0x80,
+0x00,0x06,0xff,0xfd,0x00,0x01,0xff,0xf8,0x00,0x00,0x00,0x5f,0xff,0x40,0x05,0xff,
+0xf0,0x00,0x00,0x00,0x0d,0xff,0x80,0x06,0xff,0xd0,0x00,0x00,0x00,0x0a,0xff,0xa0,
+0x05,0x09,0x00,0xf0,0x35,0x90,0x02,0xff,0xf1,0x00,0x00,0x00,0x0e,0xff,0x60,0x00,
+0xbf,0xfa,0x00,0x00,0x00,0x7f,0xfe,0x00,0x00,0x2e,0xff,0xb4,0x00,0x39,0xff,0xf4,
+0x00,0x00,0x03,0xdf,0xff,0xff,0xff,0xfe,0x50,0x00,0x00,0x00,0x3f,0xff,0xff,0xff,
+0xf5,0x00,0x00,0x00,0x08,0xff,0xff,0xcc,0xef,0xff,0xa0,0x00,0x00,0x8f,0xff,0x60,
+0x00,0x05,0xef,0xfa,0x00,0x03,0xff,0xf3,0x00,0x32,0x00,0x20,0x60,0x0a,0x16,0x00,
+0x60,0x00,0x07,0xff,0xd0,0x0e,0xff,0x31,0x00,0xf0,0x00,0x02,0xff,0xf2,0x0f,0xff,
+0x30,0x00,0x00,0x00,0x00,0xff,0xf3,0x0f,0xff,0x40,0xa7,0x00,0xe1,0xff,0xf2,0x0d,
+0xff,0x80,0x00,0x00,0x00,0x05,0xff,0xf0,0x08,0xff,0xf2,0x90,0x00,0xf0,0x0c,0xb0,
+0x01,0xff,0xfe,0x40,0x00,0x03,0xcf,0xff,0x30,0x00,0x4f,0xff,0xfe,0xcc,0xef,0xff,
+0xf7,0x00,0x00,0x04,0xef,0xff,0xff,0xff,0xff,0x60,0x29,0x00,0x40,0xae,0xff,0xeb,
+0x71,0x43,0x00,0x92,0x06,0xbe,0xfe,0xc7,0x10,0x00,0x00,0x00,0x2d,0x8f,0x00,0x00,
+0x8e,0x00,0x80,0xde,0xff,0xff,0x50,0x00,0x0d,0xff,0xe5,0xa4,0x00,0x20,0x10,0x06,
+0x85,0x00,0x61,0x01,0xef,0xfa,0x00,0xbf,0xf9,0x60,0x00,0x12,0xf1,0x7b,0x00,0x31,
+0x0e,0xff,0x51,0xf8,0x00,0x61,0x00,0xaf,0xf9,0x3f,0xff,0x00,0x9e,0x00,0x12,0xb2,
+0x11,0x00,0x22,0x6f,0xfc,0x22,0x00,0x50,0x06,0xff,0xd0,0xdf,0xf8,0x11,0x00,0x31,
+0xcf,0xfd,0x07,0x93,0x00,0xf0,0x14,0x8f,0xff,0xc0,0x1e,0xff,0xe4,0x00,0x02,0xbf,
+0xff,0xfc,0x00,0x5f,0xff,0xfe,0xce,0xff,0xfc,0xff,0xb0,0x00,0x5f,0xff,0xff,0xff,
+0xe5,0x8f,0xf9,0x00,0x00,0x29,0xdf,0xfd,0x81,0x0a,0x9b,0x00,0x00,0x01,0x00,0x22,
+0xef,0xf3,0x08,0x00,0x21,0x3f,0xfe,0x08,0x00,0x00,0x4c,0x01,0x01,0x08,0x00,0x11,
+0x05,0x12,0x01,0x00,0x5c,0x00,0x20,0xf9,0x00,0xf7,0x00,0x30,0x5c,0xff,0xfd,0x39,
+0x01,0x60,0xde,0xff,0xff,0xfc,0x10,0x00,0x9c,0x01,0x21,0xff,0xe7,0x2f,0x00,0x20,
+0xfe,0xc9,0x28,0x01,0xbf,0x1c,0xfa,0x08,0xff,0xf5,0x8f,0xff,0x51,0xcf,0xa0,0x00,
 0x01,0x00,0x0a,0x00,0x28,0x00,0xc0,0xf4,0x8f,0xff,0x52,0xcf,0xa0,0x00,0x6e,0xe5,
 0x00,0xff,0xfe,0x03,0x00,0x3f,0x6e,0xe5,0x00,0x01,0x00,0x11,0x21,0x9f,0xfa,0x03,
-0x00,0xf2,0x01,0xf9,0x00,0x9f,0xf8,0x00,0xcf,0xf5,0x01,0xff,0xf0,0x07,0xff,0x90,
-0x1f,0xff,0x10,0x14,0x0c,0x03,0xea,0x02,0x02,0x98,0x06,0x21,0x6e,0xfa,0x26,0x01,
-0x01,0xe1,0x01,0x50,0x01,0x8e,0xff,0xff,0xf7,0x70,0x06,0x90,0xff,0xfe,0x82,0x00,
-0x02,0x9f,0xff,0xff,0xd6,0x3f,0x0b,0x30,0xff,0xfa,0x40,0x67,0x04,0x22,0xfe,0x81,
-0x6d,0x0f,0x22,0x50,0x00,0x14,0x02,0x20,0xe7,0x10,0xf3,0x01,0x40,0xaf,0xff,0xff,
-0xa3,0x11,0x00,0x41,0x29,0xff,0xff,0xfd,0x99,0x02,0x61,0x9f,0xff,0xff,0xf9,0x20,
-0x00,0x45,0x00,0x11,0xfa,0x0c,0x01,0x13,0x7e,0x51,0x04,0x23,0x07,0xea,0x79,0x00,
-0x13,0x30,0x59,0x05,0x14,0xf5,0x08,0x00,0x21,0x4e,0xee,0x01,0x00,0x1f,0xe4,0xd5,
-0x00,0x0d,0x04,0x28,0x00,0x0c,0x40,0x00,0x23,0x86,0x00,0x2f,0x03,0x22,0xe8,0x10,
-0x08,0x00,0x02,0x82,0x00,0x63,0x00,0x6e,0xff,0xff,0xfa,0x30,0xc5,0x10,0x27,0xfc,
-0x40,0xa6,0x00,0x00,0x40,0x10,0x31,0xff,0xfe,0x70,0xcd,0x03,0x13,0x9f,0x26,0x04,
-0x12,0x3a,0x08,0x00,0x81,0x6c,0xff,0xff,0xe3,0x00,0x00,0x02,0x8e,0xfc,0x00,0xc2,
-0x05,0xbf,0xff,0xff,0xc5,0x00,0x00,0x18,0xef,0xff,0xff,0xb4,0xc7,0x01,0x12,0xa2,
-0x60,0x00,0x02,0x6a,0x0a,0x13,0xae,0xda,0x07,0x24,0x20,0x00,0x64,0x0f,0x50,0x7c,
-0xef,0xec,0x81,0x00,0x87,0x05,0x12,0xff,0x8e,0x05,0x01,0x42,0x03,0xa0,0xef,0xfe,
-0x61,0x00,0x5e,0xff,0xe0,0x6f,0xff,0x20,0x98,0x03,0x31,0x49,0xff,0xb0,0xfd,0x03,
-0x21,0x46,0x63,0xbd,0x05,0x12,0x80,0x5b,0x04,0x13,0xf7,0xf8,0x08,0x12,0x40,0x5d,
-0x01,0x17,0xe0,0x1e,0x06,0x32,0x05,0xff,0xfa,0xc7,0x08,0x12,0xfc,0x0b,0x04,0x12,
-0xfc,0x3e,0x04,0x12,0xfc,0x68,0x10,0x02,0x2b,0x04,0x02,0x53,0x0a,0x02,0xa4,0x0d,
-0x00,0xde,0x00,0x2f,0x88,0x40,0x47,0x01,0x08,0x38,0x02,0xbb,0x30,0x43,0x09,0x13,
-0x0c,0x1e,0x05,0x15,0x4e,0x5a,0x02,0x32,0x03,0x8c,0xef,0xa9,0x02,0x02,0xdc,0x02,
-0x11,0xdf,0xc8,0x00,0x13,0x81,0x3d,0x00,0x64,0xcf,0xff,0xea,0x76,0x68,0x9d,0xd7,
-0x0f,0x31,0x3e,0xff,0xc4,0x1c,0x12,0x02,0x3d,0x01,0x14,0x03,0x72,0x05,0x31,0x2c,
-0xff,0x40,0xe7,0x07,0x14,0x30,0x3b,0x05,0x10,0xe1,0x70,0x00,0x14,0xf3,0x53,0x00,
-0x24,0x1e,0xf9,0xec,0x0b,0x21,0x03,0x43,0xe2,0x00,0x42,0x10,0x00,0x0d,0xfd,0x86,
-0x02,0x92,0xfa,0x10,0x00,0x00,0xdf,0x70,0x00,0x4f,0xf5,0xd7,0x0f,0x00,0x8d,0x01,
-0x21,0x8f,0xc0,0xa7,0x13,0xd2,0x0a,0xff,0xb3,0x01,0x9f,0xf4,0x00,0x00,0x3f,0xf0,
-0x00,0xff,0x90,0x40,0x0e,0x70,0x6f,0xf3,0x00,0x00,0x0f,0xf3,0x04,0x6d,0x00,0xa0,
-0xdf,0xf1,0x00,0x00,0x7f,0xf2,0x00,0x00,0x0e,0xf6,0x7e,0x13,0x10,0x03,0x58,0x01,
-0x60,0x9f,0xf0,0x00,0x00,0x0c,0xf7,0x53,0x14,0x10,0x09,0x26,0x01,0xc1,0xaf,0xf0,
-0x00,0x00,0x0b,0xf8,0x0c,0xfc,0x00,0x00,0x0d,0xfe,0x50,0x11,0x00,0x0f,0x00,0x00,
-0x97,0x13,0x20,0x0f,0xfb,0x50,0x01,0x10,0xc0,0x0f,0x00,0x23,0x0e,0xf9,0x99,0x0c,
-0x20,0xef,0xa0,0x3c,0x00,0x00,0x0f,0x00,0x10,0x4f,0x9b,0x01,0x00,0x71,0x00,0x42,
-0x0e,0xf5,0x0e,0xf9,0x6c,0x0c,0x01,0x84,0x12,0x80,0x1f,0xf2,0x0d,0xfb,0x00,0x00,
-0x4f,0xf8,0x62,0x04,0x00,0x14,0x10,0x32,0xe0,0x0b,0xfc,0xb9,0x0e,0x10,0x1e,0x1e,
-0x00,0x41,0xdf,0x80,0x09,0xff,0xf5,0x05,0x40,0x01,0xcf,0xff,0xc0,0xb7,0x0e,0x00,
-0xb4,0x11,0xa2,0x08,0xff,0xfb,0xae,0xfb,0x9f,0xf8,0x24,0xaf,0xf6,0x43,0x00,0x52,
-0xdf,0xff,0xff,0xc1,0x1e,0x0f,0x12,0xc0,0xcf,0xe0,0x00,0x00,0x08,0xef,0xd7,0x00,
-0x02,0xae,0xfe,0xa3,0xac,0x04,0x19,0xf6,0xb2,0x01,0x38,0x0d,0xfe,0x10,0x0f,0x00,
-0x14,0x04,0x55,0x06,0x04,0x1d,0x0f,0x19,0xfc,0x1f,0x00,0x12,0x09,0x6d,0x04,0x25,
-0x03,0x70,0xe9,0x13,0x64,0xfb,0x75,0x44,0x69,0xdf,0xf0,0xff,0x01,0x02,0x27,0x07,
-0x15,0xc1,0xb5,0x02,0x56,0x6a,0xde,0xff,0xeb,0x73,0x3f,0x00,0x16,0xef,0x7c,0x00,
-0x03,0x74,0x02,0x03,0xeb,0x04,0x04,0x96,0x06,0x01,0xdf,0x08,0x15,0x80,0x3c,0x09,
-0x13,0xfb,0x5e,0x07,0x00,0xe7,0x01,0x45,0xf4,0xcf,0xf4,0x00,0x74,0x07,0x13,0x6f,
-0x5c,0x07,0x00,0x5e,0x0f,0x04,0x71,0x07,0x00,0xfc,0x0f,0x05,0x4e,0x05,0x26,0x4f,
-0xfc,0xcb,0x00,0x10,0xaf,0xe6,0x15,0x13,0xf2,0x3d,0x07,0x20,0xf1,0x00,0xb8,0x04,
-0x05,0x8f,0x07,0x03,0x6e,0x05,0x01,0x0b,0x11,0x03,0x97,0x07,0x12,0x2f,0xfd,0x10,
-0x11,0xa0,0xff,0x00,0x13,0xfa,0x35,0x00,0x00,0xbd,0x00,0x10,0xfe,0x22,0x04,0x01,
-0x87,0x02,0x13,0x04,0x0e,0x08,0x12,0xfc,0xbd,0x00,0x02,0x01,0x00,0x15,0x30,0x80,
-0x0b,0x01,0x43,0x0b,0x03,0xc1,0x0a,0x10,0x05,0xc3,0x00,0x02,0x15,0x06,0x00,0xb9,
-0x0b,0x00,0xc9,0x06,0x05,0x81,0x07,0x12,0x09,0xe1,0x12,0x01,0xda,0x0b,0x16,0x0e,
-0xa1,0x0c,0x44,0x70,0x5f,0xff,0x20,0x19,0x01,0x20,0xd0,0x0f,0x5b,0x00,0x20,0xed,
-0xa5,0x3d,0x00,0x02,0x2e,0x0c,0x40,0x40,0x00,0x0f,0xff,0x88,0x00,0x00,0xe9,0x12,
-0x21,0xff,0xf5,0x21,0x03,0x13,0xfe,0xa1,0x12,0x00,0xd6,0x03,0x22,0xff,0xf5,0x0b,
-0x01,0x12,0x90,0x13,0x00,0x00,0x86,0x07,0x22,0xff,0xf5,0x95,0x00,0x13,0xa0,0x13,
-0x00,0x23,0xff,0xf7,0x13,0x00,0x31,0xaf,0xff,0x10,0x13,0x00,0x43,0x15,0xcf,0xff,
-0x50,0x5f,0x00,0x10,0xfd,0x5f,0x00,0x04,0x95,0x03,0x83,0xff,0xfd,0xcc,0xcc,0xcd,
-0xff,0xff,0xe4,0x5f,0x00,0x32,0x3c,0xff,0xf2,0x39,0x00,0x00,0x6a,0x07,0x03,0x4c,
-0x00,0x05,0x94,0x0c,0x33,0x01,0xff,0xf5,0x13,0x00,0x01,0xe5,0x17,0x02,0x13,0x00,
-0x13,0xf4,0x13,0x00,0x31,0x6f,0xff,0x20,0x13,0x00,0x00,0x0a,0x13,0x02,0x13,0x00,
-0x10,0x5e,0xab,0x00,0x40,0xfe,0xdd,0xdd,0xde,0x4c,0x0a,0x03,0x72,0x00,0x13,0xf7,
-0xe4,0x00,0x02,0xa5,0x07,0x51,0x00,0x49,0xdf,0xfe,0xc9,0x4f,0x01,0x11,0x3d,0x7d,
-0x17,0x12,0x10,0xd3,0x13,0x11,0xef,0xd6,0x13,0x40,0x5f,0xff,0xf7,0x20,0xf9,0x00,
-0x20,0x10,0x01,0x7d,0x0f,0x00,0xac,0x04,0x22,0x90,0x09,0x59,0x01,0x10,0x08,0xae,
-0x07,0x12,0x80,0x7f,0x00,0x14,0xf6,0x49,0x01,0x33,0xcf,0xf9,0x9f,0x6a,0x09,0x34,
-0x58,0x86,0xcf,0x3b,0x02,0x04,0x96,0x01,0x00,0xdb,0x01,0x06,0x0a,0x00,0x1f,0xf7,
-0x0a,0x00,0x09,0x06,0x32,0x00,0x06,0x46,0x00,0x04,0x5a,0x00,0x53,0x47,0x75,0x5f,
-0xff,0x10,0x6e,0x00,0x15,0x1f,0x82,0x00,0x33,0x09,0xff,0xf1,0x96,0x00,0x12,0x01,
-0x4a,0x16,0x81,0x3f,0xff,0x90,0x00,0x5f,0xff,0xe6,0x00,0xbe,0x00,0x00,0xd2,0x00,
-0x31,0xfe,0xdf,0xff,0x68,0x0e,0x14,0x4d,0xe6,0x00,0x81,0x00,0x00,0x5a,0xdf,0xfe,
-0xc8,0x20,0x00,0x17,0x01,0x02,0x03,0x01,0x12,0x0f,0x6e,0x02,0x21,0x30,0x00,0xfc,
-0x01,0x11,0xef,0x2b,0x01,0x01,0x48,0x01,0x43,0x27,0xef,0xff,0x80,0x9e,0x01,0x32,
-0x1c,0xff,0xf4,0x0a,0x00,0x00,0x7e,0x08,0x04,0x0a,0x00,0x13,0x2f,0x1b,0x0f,0x00,
-0x4b,0x02,0x12,0xc0,0x0a,0x00,0x00,0x30,0x09,0x03,0x0a,0x00,0x10,0x01,0x4c,0x09,
-0x12,0x50,0x9a,0x02,0x14,0xf6,0x0a,0x00,0x24,0xef,0xf7,0x0a,0x00,0x1e,0xdf,0x0a,
-0x00,0x07,0x1e,0x00,0x05,0x32,0x00,0x15,0x02,0xe7,0x01,0x01,0x2a,0x09,0x12,0x50,
-0x6d,0x02,0x04,0x6e,0x00,0x33,0x3f,0xff,0x60,0x0a,0x00,0x25,0xdf,0xfe,0xaa,0x00,
-0x12,0xf5,0x0a,0x00,0x21,0x38,0xff,0xbe,0x00,0x31,0xed,0xdd,0xef,0x2e,0x16,0x07,
-0xe6,0x00,0x00,0xfa,0x00,0x16,0xc8,0xfa,0x00,0x37,0xff,0xff,0xf1,0x09,0x00,0x02,
-0xab,0x07,0x24,0xe0,0x0f,0xf7,0x0a,0x0f,0x09,0x00,0x2e,0x03,0x7e,0x02,0x07,0x09,
-0x00,0x6f,0xed,0xdd,0xdd,0xdd,0xdd,0xd5,0x5a,0x00,0x2f,0x0e,0x09,0x00,0x01,0x5a,
-0x00,0x24,0xdd,0xd3,0xcf,0x00,0x1d,0xf3,0x09,0x00,0x23,0xd0,0xff,0x8a,0x03,0x04,
-0xe9,0x00,0x3b,0xb0,0xff,0xf5,0x46,0x00,0x0f,0x11,0x00,0x21,0x11,0xfe,0x78,0x00,
-0x23,0x10,0x0f,0x46,0x01,0x13,0x00,0x66,0x00,0x1e,0x10,0x55,0x00,0x0f,0x11,0x00,
-0x40,0x00,0x01,0x00,0x41,0x59,0xde,0xfe,0xda,0x16,0x00,0x13,0x4d,0xc7,0x04,0x01,
-0x2b,0x10,0x11,0xee,0xcc,0x02,0xa2,0x6f,0xff,0xf7,0x10,0x00,0x17,0xef,0xff,0x50,
-0x02,0x25,0x03,0x33,0x1d,0xff,0xe0,0xcf,0x03,0x10,0x03,0x57,0x04,0x13,0x80,0x73,
-0x03,0x13,0x4f,0xcf,0x03,0x45,0x36,0x65,0x8f,0xfe,0xa2,0x19,0x15,0xfb,0x93,0x03,
-0x1e,0xf9,0xa7,0x03,0x01,0x0a,0x00,0x74,0x5d,0xdd,0xdd,0xdd,0xdb,0xdf,0xf8,0xe8,
-0x1a,0x06,0x0a,0x00,0x04,0x32,0x00,0x44,0x7f,0xfe,0xaf,0xfc,0x0a,0x00,0x24,0x7f,
-0xff,0x0a,0x00,0x33,0x3f,0xff,0x50,0x0a,0x00,0x33,0x0e,0xff,0xc0,0x0a,0x00,0x12,
-0x07,0x86,0x08,0x00,0xd7,0x0c,0x12,0xdf,0xc0,0x13,0x40,0xcf,0xfe,0x00,0x2f,0x0b,
-0x0a,0x40,0x02,0x7e,0xff,0xf9,0xe6,0x1a,0x00,0xd2,0x00,0x00,0x3c,0x06,0x11,0x1a,
-0x5f,0x01,0x11,0xe6,0xc2,0x08,0x45,0xce,0xff,0xdc,0x84,0x15,0x01,0x00,0x06,0x0f,
-0x24,0xff,0xf5,0x46,0x04,0x0f,0x15,0x00,0x4d,0x14,0xff,0xb8,0x0e,0x15,0x0f,0x0b,
-0x00,0x13,0xa0,0x0c,0x02,0x3f,0xdd,0xff,0xfa,0x93,0x00,0x62,0x05,0x15,0x00,0x2f,
-0xcf,0xf9,0x02,0x00,0x1f,0x0b,0xd8,0x0e,0x0f,0x09,0x00,0x80,0x34,0x08,0x88,0x20,
-0x0b,0x05,0x12,0x60,0x9a,0x1c,0x10,0x0d,0x4c,0x08,0x00,0x70,0x1a,0x31,0x08,0xff,
-0xf3,0x33,0x07,0x20,0x70,0x01,0x91,0x0e,0x10,0x18,0x2d,0x11,0x11,0x6f,0x31,0x02,
-0x13,0xf4,0xd9,0x0b,0x10,0xfe,0xf3,0x04,0x11,0x17,0x34,0x1a,0x15,0x00,0x4a,0x05,
-0x04,0xd4,0x07,0x11,0x09,0x9a,0x04,0x11,0x50,0x54,0x00,0x13,0xf9,0x5b,0x03,0x33,
-0x06,0xff,0xfb,0x2a,0x00,0x02,0x50,0x09,0x00,0x15,0x00,0x10,0x03,0x59,0x06,0x00,
-0x15,0x00,0x00,0x0d,0x12,0x11,0x20,0x15,0x00,0x00,0x69,0x1c,0x13,0x30,0x98,0x03,
-0x00,0xec,0x07,0x02,0x15,0x00,0x33,0xaf,0xff,0x70,0xad,0x03,0x33,0x9f,0xff,0x90,
-0xaf,0x03,0x33,0x7f,0xff,0xe0,0xc2,0x03,0x23,0xaf,0xff,0x92,0x08,0x04,0xdd,0x08,
-0x01,0x2a,0x05,0x42,0xc2,0xef,0xfe,0x10,0x15,0x00,0x42,0xd1,0x04,0xff,0xfb,0x15,
-0x00,0x54,0xe1,0x00,0x08,0xff,0xf7,0xee,0x03,0x34,0x0c,0xff,0xf3,0x01,0x04,0x34,
-0x2e,0xff,0xe1,0x03,0x04,0x34,0x5f,0xff,0xb0,0xd2,0x00,0x34,0x9f,0xff,0x70,0x18,
-0x04,0x00,0xa8,0x0f,0x12,0x0f,0xdf,0x0f,0x00,0xb4,0x00,0x04,0x94,0x0c,0x14,0xfb,
-0xfc,0x00,0x15,0x09,0xaa,0x08,0x00,0x57,0x00,0x0e,0xaa,0x04,0x0f,0x11,0x00,0xa0,
-0x02,0x7b,0x03,0x14,0xd6,0x8e,0x03,0x13,0x80,0x08,0x00,0x23,0xf8,0x0f,0x2f,0x1d,
-0x01,0xa6,0x15,0x25,0x70,0xff,0xf8,0x0a,0x45,0x8f,0xff,0xf7,0x0f,0x13,0x1f,0x11,
-0x0e,0x1b,0x00,0x14,0xfb,0x6b,0x02,0x01,0x1b,0x00,0x15,0xf1,0xa9,0x1e,0x53,0x70,
-0xff,0xfd,0xff,0x70,0x44,0x0b,0x63,0xcf,0xf7,0x0f,0xff,0x7f,0xfe,0x22,0x0b,0x34,
-0xca,0xff,0x70,0x44,0x18,0x92,0x00,0xef,0xf5,0xbf,0xf7,0x0f,0xff,0x19,0xff,0xf5,
-0x20,0x20,0xfe,0x0b,0x1b,0x00,0x01,0xf4,0x1c,0x00,0x70,0x10,0x00,0x1b,0x00,0x32,
-0x20,0xcf,0xf7,0x5d,0x11,0x62,0x0c,0xff,0x70,0xff,0xf3,0x06,0x8d,0x17,0x20,0xfc,
-0x00,0x51,0x00,0x11,0x30,0x44,0x0e,0x81,0x0d,0xff,0x60,0x0d,0xff,0x70,0xff,0xf4,
-0x91,0x12,0x00,0x3e,0x15,0x00,0x1d,0x08,0x40,0x40,0x03,0xff,0xf1,0x23,0x0e,0x00,
-0xb8,0x1d,0x21,0xff,0xf5,0x99,0x16,0x33,0x1f,0xff,0x20,0x2e,0x08,0x21,0x6f,0xfd,
-0xac,0x12,0x11,0x0f,0x1b,0x00,0x00,0x37,0x20,0x00,0xaf,0x16,0x10,0xff,0x1b,0x00,
-0x00,0xa0,0x17,0x00,0x4b,0x11,0x03,0x1b,0x00,0x21,0x3f,0xff,0x1e,0x1c,0x01,0x1b,
-0x00,0x00,0xb9,0x0e,0x25,0xff,0xf2,0x1b,0x00,0x12,0x06,0x6d,0x0b,0x03,0x1b,0x00,
-0x11,0x0f,0xd1,0x11,0x02,0x1b,0x00,0x00,0x52,0x02,0x16,0xf0,0x1b,0x00,0x00,0xe2,
-0x1d,0x06,0x1b,0x00,0x01,0xfc,0x1b,0x01,0x1b,0x00,0x23,0xa0,0x00,0x05,0x0b,0x04,
-0x4e,0x01,0x31,0xbf,0xfa,0x0f,0x29,0x03,0x03,0x15,0x00,0x15,0xf9,0x15,0x00,0x25,
-0xff,0xf4,0x15,0x00,0x24,0xff,0xd0,0x15,0x00,0x00,0x03,0x13,0x02,0x15,0x00,0x43,
-0xf5,0xaf,0xff,0x30,0x15,0x00,0x34,0x51,0xef,0xfc,0x15,0x00,0x33,0x05,0xff,0xf7,
-0x15,0x00,0x43,0x50,0x0b,0xff,0xf2,0x15,0x00,0x43,0x00,0x2f,0xff,0xb0,0x15,0x00,
-0x43,0x00,0x7f,0xff,0x60,0x15,0x00,0x43,0x00,0xcf,0xfe,0x10,0x15,0x00,0x34,0x02,
-0xff,0xfa,0x15,0x00,0x32,0x08,0xff,0xf4,0x15,0x00,0x00,0x62,0x01,0x13,0xe0,0x15,
-0x00,0x00,0x2e,0x0a,0x24,0xbf,0xfa,0x38,0x03,0x14,0x3b,0x3d,0x05,0x24,0xef,0xfd,
-0x15,0x00,0x11,0x04,0xd0,0x05,0x13,0xf5,0x45,0x0d,0x04,0x67,0x05,0x25,0x1e,0xff,
-0x67,0x05,0x16,0x5f,0xe5,0x05,0x15,0xbf,0x15,0x00,0x11,0x01,0xf7,0x0f,0x12,0x49,
-0x66,0x0a,0x00,0x78,0x0f,0x00,0x83,0x02,0x33,0xa1,0x00,0x00,0x57,0x10,0x02,0x6b,
-0x15,0x70,0xff,0xa4,0x10,0x15,0xbf,0xff,0xe1,0xb0,0x22,0x11,0x30,0x31,0x07,0x13,
-0xb0,0x86,0x1f,0x00,0x07,0x00,0x13,0x0e,0x50,0x01,0x32,0xdf,0xfa,0x04,0x9f,0x12,
-0x00,0xe8,0x04,0x24,0x8f,0xfd,0xb3,0x14,0x34,0x4b,0xff,0xa0,0x3b,0x0b,0x24,0xdf,
-0xf8,0x82,0x14,0x14,0x9e,0xe2,0x0c,0x44,0xbf,0xf9,0xef,0xf7,0x6c,0x18,0x15,0xae,
-0x15,0x00,0x16,0xfa,0x15,0x00,0x34,0x9d,0xff,0x80,0xd3,0x07,0x24,0xbf,0xfa,0xfb,
-0x02,0x12,0x78,0x14,0x03,0x00,0x56,0x0c,0x13,0x4f,0xfd,0x0f,0x22,0x6f,0xff,0xdf,
-0x1a,0x01,0x91,0x0c,0x00,0x41,0x01,0x01,0x12,0x05,0x52,0xf4,0x00,0x0e,0xff,0xf3,
-0x49,0x04,0x00,0x19,0x0c,0x41,0xf9,0x30,0x00,0x4a,0xe9,0x01,0x25,0x5f,0xff,0x63,
-0x05,0x15,0x2c,0x6c,0x0b,0x00,0xfd,0x1a,0x24,0xec,0x83,0x06,0x0a,0x35,0xfe,0xd9,
-0x40,0x10,0x0a,0x10,0xfd,0x9c,0x04,0x11,0xfe,0x6e,0x0b,0x03,0x59,0x0b,0x00,0xe3,
-0x11,0x13,0x20,0x4e,0x01,0x15,0x4f,0x4e,0x0d,0x15,0x09,0x4f,0x0b,0x17,0x03,0x4f,
-0x0b,0x1d,0xf5,0x0a,0x00,0x05,0x1e,0x00,0x00,0xbe,0x16,0x0b,0x46,0x00,0x21,0x01,
-0x49,0x5a,0x00,0x03,0x74,0x12,0x04,0x82,0x00,0x22,0xfc,0x30,0x30,0x0a,0x37,0xdc,
-0xb7,0x30,0x43,0x04,0x0f,0x0a,0x00,0x48,0x00,0x35,0x01,0x42,0xad,0xff,0xec,0x72,
-0xa1,0x0f,0x01,0x9c,0x11,0x12,0x90,0xf1,0x01,0x01,0x11,0x01,0x02,0x82,0x0d,0x40,
-0x93,0x10,0x26,0xcf,0x18,0x03,0x11,0x2f,0xb6,0x0c,0x10,0x08,0x39,0x03,0x01,0xeb,
-0x20,0x01,0x07,0x00,0x13,0x01,0x11,0x1b,0x10,0x1f,0x1b,0x16,0x13,0xf1,0x33,0x10,
-0x23,0xe0,0x0a,0xf9,0x16,0x14,0x04,0xb3,0x15,0x03,0x1c,0x0e,0x2a,0x60,0x00,0x7c,
-0x0c,0x00,0x30,0x02,0x01,0x8c,0x21,0x02,0xbb,0x09,0x07,0x0b,0x00,0x07,0x21,0x00,
-0x07,0x37,0x00,0x16,0x0e,0x4d,0x00,0x16,0x0b,0x63,0x00,0x16,0x07,0x79,0x00,0x04,
-0x8f,0x00,0x00,0x29,0x00,0x03,0xa5,0x00,0x71,0x9f,0xff,0x20,0x00,0x2f,0xff,0xd2,
-0xb2,0x02,0x11,0xf8,0xd1,0x00,0x10,0x82,0x00,0x0f,0x15,0xc0,0xe7,0x00,0x25,0xfc,
-0x10,0xfd,0x00,0x15,0xf7,0x13,0x01,0x03,0x09,0x01,0x02,0x97,0x12,0x04,0x13,0x11,
-0x00,0x2a,0x17,0x16,0xe3,0xc4,0x10,0x15,0xd1,0x45,0x01,0x18,0x7d,0x34,0x11,0x02,
-0xc1,0x0f,0x18,0xa6,0x69,0x0c,0x05,0xc2,0x0f,0x03,0x5a,0x22,0x23,0x01,0x7f,0x12,
-0x0d,0x00,0xc0,0x19,0x05,0xbc,0x0d,0x15,0x6f,0x6d,0x02,0x35,0x1f,0xff,0x50,0x5c,
-0x0f,0x1d,0x60,0x14,0x00,0x05,0x28,0x00,0x35,0x02,0xef,0xfc,0x50,0x00,0x12,0xf3,
-0x3b,0x02,0x10,0xef,0xee,0x04,0x03,0x78,0x00,0x14,0xc3,0x82,0x00,0x14,0xfb,0xf5,
-0x01,0x01,0x37,0x14,0x03,0x73,0x04,0x13,0xa0,0x0a,0x00,0x34,0x06,0xff,0xf2,0x13,
-0x02,0x24,0xdf,0xfb,0x0a,0x00,0x14,0x5f,0xa9,0x07,0x00,0x69,0x03,0x05,0x6d,0x10,
-0x24,0xf3,0x00,0xda,0x0d,0x05,0xb2,0x07,0x10,0x5f,0x25,0x06,0x03,0x8b,0x1f,0x05,
-0x70,0x0e,0x00,0x99,0x03,0x31,0x02,0x8b,0xef,0x39,0x1f,0x21,0x00,0x19,0x68,0x03,
-0x11,0x60,0x5e,0x18,0x20,0xfe,0xef,0x2b,0x0b,0x10,0x0c,0x3f,0x0b,0x42,0x04,0xcf,
-0xff,0x80,0x4e,0x1d,0x00,0xa2,0x01,0x22,0x9f,0xfe,0xed,0x01,0x21,0xf9,0x0b,0x49,
-0x04,0x00,0x29,0x11,0x03,0xe8,0x0b,0x33,0x5b,0xba,0x08,0xf3,0x06,0x00,0x82,0x02,
-0x15,0xc1,0x26,0x07,0x24,0xf8,0x20,0x0a,0x00,0x22,0xff,0xc7,0x1d,0x04,0x61,0x3c,
-0xff,0xff,0xff,0xd7,0x10,0x7a,0x03,0x15,0xaf,0x69,0x26,0x25,0x04,0x9e,0x9e,0x12,
-0x25,0x05,0xcf,0xeb,0x12,0x15,0x8f,0x02,0x03,0x43,0xcf,0xfc,0x6b,0xb9,0xcf,0x04,
-0x33,0xe7,0xff,0xf0,0x65,0x04,0x14,0x3f,0x42,0x0f,0x41,0xd0,0xcf,0xfe,0x30,0x64,
-0x02,0x50,0xf9,0x02,0xff,0xff,0x93,0xc3,0x0f,0x20,0xff,0x20,0x5f,0x18,0x20,0xed,
-0xff,0x67,0x01,0x33,0x01,0xaf,0xff,0x39,0x19,0x64,0x00,0x16,0xbd,0xff,0xec,0x94,
-0xf7,0x1b,0x00,0x01,0x00,0x16,0xa2,0x89,0x0b,0x20,0x1e,0xee,0x54,0x04,0x00,0xd9,
-0x0d,0x1a,0x90,0x13,0x13,0x14,0x0e,0xd9,0x02,0x0f,0x15,0x00,0xc7,0x23,0x8f,0xfc,
-0x7a,0x13,0x02,0x29,0x23,0x00,0x5d,0x01,0x0f,0x13,0x00,0x7d,0x13,0xd0,0x13,0x00,
-0x05,0x3e,0x09,0x33,0xe4,0xff,0xf1,0x69,0x0e,0x03,0x89,0x0e,0x61,0x2f,0xff,0x70,
-0xaf,0xff,0x40,0xd3,0x06,0xa0,0xf1,0x01,0xef,0xff,0x82,0x00,0x00,0x5d,0xff,0xf6,
-0x31,0x07,0x21,0xfe,0xde,0xc7,0x10,0x25,0x02,0xcf,0xfa,0x0d,0x55,0x39,0xce,0xff,
-0xdb,0x60,0x2f,0x20,0x00,0x57,0x00,0x13,0x40,0xb1,0x06,0x00,0x1b,0x17,0x13,0x09,
-0x62,0x02,0x00,0x57,0x1b,0x04,0x6d,0x0e,0x00,0x93,0x03,0x12,0xdf,0x23,0x00,0x00,
-0xa1,0x26,0x12,0x07,0x23,0x00,0x01,0xc8,0x04,0x14,0x2f,0xef,0x03,0x13,0x10,0x7f,
-0x12,0x00,0x8f,0x29,0x00,0xb5,0x00,0x12,0xf0,0x7f,0x13,0x02,0x15,0x04,0x01,0xc8,
-0x04,0x01,0x8e,0x05,0x15,0xfa,0xf8,0x1b,0x00,0xaf,0x1b,0x00,0x25,0x05,0x05,0x2d,
-0x1c,0x25,0x7f,0xfe,0x53,0x1c,0x34,0x0c,0xff,0x80,0x79,0x1c,0x13,0x01,0x9b,0x14,
-0x10,0x0d,0xaf,0x08,0x15,0xfc,0xc5,0x1c,0x12,0x0c,0xc6,0x01,0x00,0x67,0x22,0x16,
-0x01,0x50,0x1c,0x13,0x50,0x40,0x21,0x00,0xb3,0x26,0x14,0x0c,0xe0,0x00,0x00,0xac,
-0x22,0x15,0xe0,0x11,0x05,0x06,0x91,0x0f,0x24,0x4f,0xff,0xaf,0x17,0x00,0x4f,0x08,
-0x16,0xd0,0x4e,0x16,0x05,0xa9,0x0f,0x04,0x99,0x1c,0x27,0xcf,0xf9,0x2a,0x1d,0x52,
-0x5f,0xff,0x09,0xff,0xc0,0x5a,0x06,0x03,0x8a,0x18,0x22,0x5f,0xff,0xc4,0x00,0x12,
-0xf4,0x2c,0x00,0x13,0x01,0x84,0x2a,0x22,0xff,0x80,0xd3,0x04,0x02,0x16,0x2a,0x11,
-0x7f,0x22,0x1b,0x00,0x92,0x0a,0x21,0x9f,0xfb,0xac,0x00,0x21,0xdf,0xf1,0x52,0x22,
-0x00,0xb6,0x2a,0x00,0xa4,0x00,0x32,0xe8,0xff,0x60,0x5f,0x1b,0x11,0x2f,0x37,0x19,
-0x33,0xfa,0x4f,0xfa,0xa1,0x02,0x21,0xef,0xf6,0x78,0x27,0x00,0x26,0x00,0x00,0xbe,
-0x0a,0x01,0x82,0x1b,0x52,0xef,0xf1,0x0b,0xff,0x30,0xc6,0x15,0x21,0x6f,0xfd,0x86,
-0x17,0x22,0x6f,0xf7,0x3a,0x01,0x30,0x02,0xff,0xf1,0x24,0x27,0x32,0x02,0xff,0xb0,
-0x23,0x01,0x00,0x1e,0x0b,0x21,0xbf,0xf3,0x3c,0x27,0x01,0x97,0x00,0x91,0xbf,0xf8,
-0x00,0x0f,0xfe,0x00,0x00,0x9f,0xf4,0x73,0x27,0x00,0xc0,0x20,0xa2,0x04,0xff,0xa0,
-0x00,0x05,0xff,0x80,0x07,0xff,0xb0,0x88,0x27,0x92,0x9f,0xf5,0x00,0x00,0x0f,0xfd,
-0x00,0xbf,0xf7,0xe0,0x1f,0x11,0x0d,0xda,0x01,0x10,0xf1,0xa5,0x20,0x00,0xb6,0x00,
-0x30,0x61,0xff,0xc0,0x36,0x00,0x12,0x52,0x03,0x02,0x40,0x8f,0xf9,0x6f,0xf8,0x36,
-0x00,0x32,0xfa,0x5f,0xfc,0xe8,0x06,0x11,0xb9,0x27,0x00,0x22,0xef,0xd7,0xc0,0x01,
-0x41,0x0f,0xfe,0xdf,0xe0,0x75,0x01,0x01,0x4a,0x29,0x00,0x5b,0x0d,0x13,0xfa,0x25,
-0x29,0x04,0x22,0x29,0x02,0x6e,0x24,0x23,0xff,0xc0,0x17,0x0a,0x12,0xf1,0xc7,0x01,
-0x13,0xf9,0xb8,0x01,0x19,0xfc,0x09,0x05,0x12,0x0d,0x96,0x09,0x02,0xc5,0x24,0x33,
-0x7f,0xff,0x70,0xa7,0x21,0x21,0x20,0xdf,0xe2,0x14,0x00,0x12,0x00,0x32,0x03,0xff,
-0xfa,0x86,0x06,0x51,0xd0,0x00,0x09,0xff,0xf4,0x7a,0x00,0x11,0xf3,0xdf,0x15,0x01,
-0x1f,0x05,0x01,0x62,0x00,0x10,0x80,0xf3,0x13,0x02,0x43,0x29,0x00,0x20,0x25,0x02,
-0xe7,0x0d,0x34,0xfb,0x00,0x1f,0xb2,0x25,0x25,0xf5,0x0b,0x70,0x02,0x16,0xe5,0x48,
-0x23,0x05,0x16,0x22,0x16,0x9f,0x34,0x02,0x15,0xef,0x7e,0x07,0x14,0x2f,0xfe,0x0c,
-0x00,0xc7,0x24,0x15,0xf5,0x09,0x0d,0x01,0x69,0x0e,0x00,0xb3,0x1d,0x43,0xfe,0x5f,
-0xff,0x90,0x3e,0x00,0x12,0x40,0xa5,0x03,0x00,0x64,0x09,0x32,0x01,0xff,0xfd,0x68,
-0x00,0x10,0xf1,0xe3,0x03,0x01,0x4a,0x02,0x10,0xf6,0xfd,0x00,0x14,0xf2,0xf4,0x1a,
-0x01,0x6c,0x2c,0x00,0x8e,0x0e,0x02,0x89,0x1e,0x32,0x6f,0xff,0x80,0x77,0x00,0x24,
-0x10,0x1f,0x2f,0x1b,0x43,0xfa,0x0a,0xff,0xf4,0x78,0x00,0x25,0xf4,0x7f,0xcd,0x10,
-0x43,0xf1,0x0e,0xff,0xd0,0xe1,0x02,0x23,0x70,0x06,0x1b,0x12,0x62,0xcf,0xfe,0x00,
-0x00,0xdf,0xfd,0x3f,0x01,0x10,0xf6,0x1a,0x00,0x11,0x60,0x2b,0x00,0x13,0xd0,0x05,
-0x00,0x00,0x3f,0x1f,0x04,0xce,0x1a,0x21,0xcf,0xfc,0xdd,0x02,0x15,0xfd,0xe5,0x1d,
-0x55,0x2f,0xff,0x60,0x00,0x0d,0xf3,0x06,0x00,0xb7,0x25,0x03,0x47,0x16,0x33,0x00,
-0xdf,0xf9,0xab,0x06,0x15,0xfd,0x6c,0x10,0x34,0x0e,0xff,0x6d,0x28,0x0b,0x13,0x06,
-0x79,0x21,0x02,0xa7,0x01,0x05,0xaf,0x16,0x16,0x5f,0x6b,0x03,0x05,0x5f,0x18,0x0f,
-0x0b,0x00,0x4e,0x14,0x4f,0xea,0x06,0x16,0x90,0x0a,0x00,0x12,0x3e,0xca,0x14,0x15,
-0xef,0xdb,0x19,0x25,0xdf,0xfe,0x03,0x04,0x15,0xf4,0x24,0x04,0x1e,0x90,0x2d,0x24,
-0x15,0xf3,0x1d,0x00,0x04,0xa4,0x2d,0x05,0x1d,0x00,0x14,0x0a,0x49,0x19,0x00,0x51,
-0x11,0x04,0x1d,0x00,0x15,0xfc,0x1e,0x02,0x14,0xf2,0x9e,0x04,0x04,0x84,0x06,0x15,
-0x02,0x3b,0x02,0x15,0x0c,0x42,0x08,0x04,0xca,0x01,0x01,0x89,0x0d,0x04,0x1d,0x00,
-0x1c,0xe1,0x16,0x08,0x15,0x03,0x1d,0x00,0x15,0x0d,0xde,0x04,0x13,0x6f,0xc9,0x15,
-0x34,0xdd,0xd1,0x7f,0xe6,0x00,0x16,0xf2,0x0a,0x00,0x81,0x5c,0xcc,0xcc,0xc2,0x7f,
-0xff,0xff,0xf3,0x04,0x00,0x00,0xa8,0x2f,0x0f,0x04,0x00,0x61,0x16,0xff,0x84,0x00,
-0x23,0x1f,0xff,0x65,0x0d,0x13,0xf5,0x32,0x03,0x13,0xb0,0x9b,0x0a,0x02,0xa9,0x0a,
-0x01,0x62,0x2c,0x04,0x06,0x2c,0x00,0xe6,0x00,0x12,0x30,0x1e,0x01,0x04,0x1d,0x04,
-0x13,0xf0,0x54,0x01,0x12,0x50,0x6f,0x01,0x03,0x48,0x01,0x05,0x67,0x0b,0x12,0x70,
-0xbb,0x03,0x13,0xfd,0xdb,0x01,0x04,0x10,0x0e,0x02,0xcf,0x01,0x0f,0x7b,0x00,0x49,
-0xe0,0x05,0x88,0x30,0xac,0xcc,0xcc,0x9d,0xff,0xff,0xfc,0xdf,0xff,0xff,0xc0,0xb4,
-0x06,0x1f,0x07,0x07,0x00,0x50,0x30,0xca,0xcc,0xdf,0x70,0x00,0x11,0xcd,0x92,0x10,
-0x23,0x0d,0xfc,0xdc,0x0d,0x02,0xa7,0x06,0x12,0x90,0xc2,0x1c,0x01,0x00,0x01,0x21,
-0xcf,0xf6,0x3f,0x2d,0x00,0xda,0x00,0xf0,0x03,0x4f,0xfa,0x0a,0xff,0x30,0x00,0x0a,
-0xff,0x40,0x4f,0xfa,0x00,0x01,0xff,0xd0,0x00,0xef,0xf1,0x91,0x2c,0x30,0x08,0xff,
-0x70,0xf3,0x05,0x31,0x2f,0xfd,0x04,0x27,0x10,0x30,0xf4,0xaf,0xf5,0x20,0x01,0x32,
-0xa0,0xab,0xbb,0x01,0x00,0x14,0x2e,0x4e,0x02,0x04,0x27,0x32,0x31,0x20,0x68,0x87,
-0x6a,0x28,0x00,0x60,0x2a,0x02,0x4c,0x09,0x10,0x0b,0xdd,0x02,0x62,0xdf,0xe1,0x00,
-0x00,0x06,0xbd,0x41,0x28,0x11,0x4e,0x13,0x26,0x00,0x13,0x03,0x20,0xfd,0xbd,0x09,
-0x00,0x30,0x2f,0xff,0xb2,0x37,0x21,0x42,0x50,0x08,0xff,0xd0,0x0c,0x1c,0x22,0x58,
-0x85,0xa7,0x22,0x04,0x3a,0x03,0x00,0x06,0x00,0x30,0x35,0x56,0x69,0x68,0x01,0x12,
-0x6c,0x93,0x26,0x23,0x02,0xdf,0xa4,0x26,0x40,0xef,0xff,0x84,0x10,0x22,0x00,0x10,
-0x8f,0xc5,0x05,0x10,0x05,0xc7,0x14,0x12,0x60,0x33,0x00,0x03,0x5e,0x0f,0x12,0xf0,
-0x53,0x20,0x13,0x9f,0x85,0x0f,0x70,0x6f,0xff,0xf0,0x09,0xff,0xfa,0x20,0x6d,0x0b,
-0x21,0x00,0x1e,0xe5,0x0b,0x21,0xff,0xf2,0x62,0x23,0x10,0xfa,0xb9,0x08,0x94,0x07,
-0xcf,0xfe,0xa3,0x00,0x9a,0xa5,0x7e,0xea,0xb7,0x1d,0x13,0xb0,0x65,0x03,0x1f,0xfb,
-0x11,0x00,0x20,0xa1,0x01,0x8c,0xef,0xd9,0x20,0x00,0x08,0xff,0xb4,0xef,0xe2,0x1e,
-0x21,0x8f,0xfe,0x17,0x1c,0x80,0x60,0x08,0xff,0xff,0xb3,0x00,0x05,0xef,0x2d,0x26,
-0x11,0xa0,0x09,0x12,0x01,0xed,0x20,0x00,0xf3,0x20,0x22,0x8f,0xfb,0x5e,0x05,0x32,
-0x38,0xff,0xb0,0x8d,0x0a,0x22,0x8f,0xfb,0xec,0x03,0x13,0x78,0x2d,0x26,0x32,0xf8,
-0x8f,0xfb,0x68,0x02,0x32,0x88,0xff,0xb0,0x35,0x21,0x22,0x8f,0xfb,0xd4,0x04,0x32,
-0x68,0xff,0xb0,0x25,0x2a,0x02,0x73,0x18,0x52,0x8f,0xfe,0x08,0xff,0xfa,0x99,0x11,
-0xd0,0x8f,0xff,0xfb,0x30,0x00,0x5e,0xff,0xf1,0x08,0xff,0xdf,0xff,0xfd,0x95,0x21,
-0x30,0x8f,0xf8,0x5f,0x9d,0x21,0x00,0xd8,0x01,0x43,0x18,0xdf,0xfd,0x92,0x54,0x25,
-0x01,0x98,0x01,0x01,0x8a,0x32,0x11,0xb1,0xf5,0x0c,0x10,0xdc,0x56,0x12,0x31,0x0a,
-0xff,0xf7,0x26,0x33,0x32,0x04,0xff,0xf5,0xf5,0x09,0x22,0xbf,0xfb,0x07,0x26,0x02,
-0x54,0x01,0x58,0x08,0xff,0x93,0xff,0xf1,0xa3,0x01,0x03,0x48,0x1e,0x14,0x00,0x0e,
-0x2f,0x02,0x4b,0x2c,0x04,0x34,0x07,0x04,0x22,0x28,0x01,0x4b,0x05,0x21,0x37,0x74,
-0x35,0x0d,0x00,0x4f,0x30,0x12,0x4f,0x6b,0x06,0x50,0xf2,0x00,0xbf,0xff,0x60,0x40,
-0x24,0x00,0x07,0x16,0x43,0xfc,0xce,0xff,0xfc,0xc0,0x2c,0x12,0xf9,0x66,0x1d,0x24,
-0xfd,0x93,0xc2,0x05,0x3f,0x07,0xee,0xa0,0x96,0x01,0x28,0x60,0x00,0x00,0x07,0xce,
-0xfd,0x93,0x11,0x00,0x00,0xf6,0x01,0x00,0x52,0x01,0x10,0x2e,0xdd,0x16,0xb1,0xfe,
-0xff,0xb0,0x0c,0xff,0xf9,0x10,0x01,0x8f,0xff,0xfb,0xe1,0x0d,0x00,0x0c,0x16,0x22,
-0xaf,0xfc,0x02,0x1f,0x02,0xcc,0x0f,0x33,0x08,0xff,0xb2,0x40,0x2f,0x23,0xfb,0x3f,
-0xe9,0x09,0x13,0xb4,0xf5,0x08,0x23,0xfb,0x4f,0x11,0x00,0x14,0xb3,0x11,0x00,0x01,
-0xb4,0x09,0x00,0x77,0x00,0x03,0x52,0x0c,0x21,0xfb,0x0a,0xd3,0x08,0x10,0x0a,0xf3,
-0x2c,0x12,0x60,0xf5,0x11,0x30,0xbf,0xff,0x81,0x23,0x24,0x30,0xb0,0x01,0xef,0x62,
-0x0e,0x22,0xef,0xfb,0xd3,0x02,0x10,0x96,0xaa,0x00,0x40,0x7c,0xef,0xda,0x30,0xde,
-0x21,0x52,0x02,0x9d,0xff,0xd9,0x30,0x6c,0x24,0x01,0xae,0x19,0x11,0x0a,0xd0,0x03,
-0x51,0xb0,0x00,0x07,0xff,0xf7,0x03,0x08,0x02,0x4f,0x0b,0x23,0x8f,0xfe,0xe8,0x00,
-0x22,0xef,0xf4,0x86,0x26,0x52,0x0a,0xff,0x72,0xff,0xf1,0x18,0x20,0x04,0xdd,0x06,
-0x14,0xb5,0x0b,0x20,0x22,0x5f,0xff,0x1a,0x28,0x3c,0x94,0xff,0xf0,0x98,0x01,0x14,
-0xf6,0x95,0x06,0x12,0xd0,0xd3,0x23,0x02,0xeb,0x06,0x10,0x4f,0xaa,0x34,0x60,0xa2,
-0x00,0x01,0x8f,0xff,0x40,0x47,0x2e,0x11,0xcd,0x70,0x17,0x11,0x9f,0xf7,0x28,0x00,
-0x35,0x1a,0x12,0xde,0xa4,0x26,0x20,0x01,0x8c,0x4b,0x0c,0x10,0x3e,0x37,0x10,0x00,
-0xd0,0x00,0x12,0xe6,0xb7,0x10,0x02,0xfb,0x0b,0x03,0x61,0x0d,0x02,0x9c,0x00,0x01,
-0x6e,0x0f,0x02,0x4e,0x36,0x02,0x06,0x00,0x54,0x99,0x9f,0xff,0xb9,0x99,0xb8,0x0f,
-0x0f,0x06,0x00,0x4d,0x00,0xfc,0x01,0x10,0xa3,0x72,0x21,0x10,0x3d,0x59,0x02,0x22,
-0x5f,0xfc,0xfc,0x01,0x33,0xfd,0xff,0xc0,0xfc,0x01,0x14,0xfc,0xfc,0x01,0x22,0xc0,
-0xaf,0x9d,0x2b,0x10,0xfc,0x03,0x34,0x00,0x81,0x01,0x32,0xc2,0xff,0xf3,0x1b,0x0e,
-0x04,0xfc,0x01,0x13,0xc4,0xeb,0x01,0x14,0xfc,0xfc,0x01,0x14,0xc3,0x11,0x00,0x13,
-0x1f,0xfc,0x01,0x14,0xc0,0x4e,0x0e,0x04,0xfc,0x01,0x20,0xc0,0x4f,0x4d,0x00,0x00,
-0x88,0x2c,0x03,0xfc,0x01,0x31,0xc0,0x02,0xef,0x5e,0x10,0x12,0xfc,0xfc,0x01,0x32,
-0x98,0xff,0xc0,0xfc,0x01,0x04,0xb7,0x02,0x04,0x18,0x2e,0x00,0x70,0x0c,0x13,0x07,
-0x4f,0x11,0x21,0x09,0xf7,0x4c,0x00,0xb1,0xf1,0x02,0xff,0xfa,0x20,0x00,0x2a,0xff,
-0xf8,0x00,0x07,0xf3,0x2a,0x13,0xfb,0xd2,0x33,0x11,0xf9,0x7f,0x10,0x01,0x2e,0x03,
-0x2a,0x7e,0xea,0x05,0x03,0x0f,0x08,0x00,0x20,0x81,0x6b,0xef,0xea,0x40,0x00,0x8f,
-0xfb,0x2d,0x59,0x00,0x40,0x8f,0xfd,0xef,0xff,0xaa,0x11,0x40,0x8f,0xff,0xfc,0x40,
-0xb5,0x09,0x31,0x8f,0xff,0xb0,0x45,0x30,0x31,0x8f,0xff,0x10,0x42,0x14,0x22,0x8f,
-0xfb,0xe3,0x2a,0x0f,0x08,0x00,0x55,0xa3,0x1c,0xfa,0x06,0xff,0xf3,0x6f,0xff,0x30,
-0x9c,0x70,0x7d,0x09,0x3f,0x04,0xff,0xf0,0x05,0x00,0x1a,0x52,0x00,0x00,0x3d,0xe6,
-0x00,0xec,0x35,0x00,0xbb,0x0d,0x28,0x02,0xbc,0x34,0x26,0x23,0x7f,0xfd,0xe5,0x2f,
-0x0f,0x09,0x00,0x48,0x10,0xfc,0xe3,0x01,0xff,0x04,0xb0,0x00,0x02,0xef,0xf8,0x02,
-0xee,0xff,0xff,0x30,0x2f,0xff,0xff,0x90,0x01,0xdf,0xfc,0x60,0x00,0x80,0x06,0x33,
-0x01,0xa2,0x2a,0x11,0xd1,0x11,0x00,0x30,0x1d,0xff,0xe1,0x11,0x00,0x00,0x4d,0x0c,
-0x00,0x22,0x00,0x00,0x1f,0x0c,0x01,0x22,0x00,0x12,0x0a,0xd4,0x17,0x12,0xb0,0x1a,
-0x1b,0x21,0x8f,0xfb,0xb3,0x1b,0x01,0xd9,0x04,0x12,0xfb,0xc7,0x0b,0x13,0xef,0xcc,
-0x02,0x12,0xff,0x7b,0x0d,0x13,0x8f,0x6f,0x14,0x62,0x08,0xff,0xfe,0x2b,0xff,0xf3,
-0x74,0x30,0x01,0x4e,0x0d,0x11,0x08,0xe2,0x2d,0x12,0x90,0x77,0x00,0x00,0x93,0x0a,
-0x01,0x77,0x00,0x00,0x43,0x18,0x22,0x8f,0xfb,0xd5,0x0a,0x12,0x08,0x06,0x10,0x11,
-0xf7,0x99,0x00,0x00,0x17,0x0b,0x01,0xaa,0x00,0x00,0x8c,0x0d,0x4f,0x3e,0xee,0x4f,
-0xff,0x02,0x00,0x21,0xf1,0x02,0x9f,0xf8,0x01,0x8c,0xef,0xda,0x30,0x00,0x03,0xad,
-0xff,0xd8,0x10,0x00,0x9f,0xf9,0x5f,0x9d,0x00,0x20,0xaf,0xff,0x0b,0x24,0x21,0x9f,
-0xfd,0x59,0x03,0x10,0x4b,0x06,0x00,0x60,0xfe,0x10,0x9f,0xff,0xf8,0x10,0x38,0x15,
-0x10,0xf7,0x66,0x08,0x41,0x80,0x9f,0xff,0x60,0xd6,0x1f,0x11,0x60,0xec,0x04,0x24,
-0x9f,0xfd,0x5a,0x0e,0x00,0x2d,0x08,0x24,0x9f,0xfb,0x69,0x23,0x00,0x39,0x0f,0x13,
-0x9f,0x6a,0x02,0x0f,0x0e,0x00,0x9b,0x23,0x8f,0xf8,0xb8,0x03,0x13,0xf9,0xb8,0x03,
-0x1f,0xfc,0xb8,0x03,0x7b,0x01,0xd8,0x06,0x23,0xeb,0x60,0x3e,0x0f,0x00,0x8b,0x14,
-0x00,0x79,0x08,0x40,0xdc,0xef,0xff,0xf4,0x11,0x00,0x11,0x91,0x1c,0x09,0x11,0x02,
-0x3f,0x06,0x14,0x2e,0x54,0x32,0x10,0x05,0x58,0x2d,0x12,0x60,0x5a,0x17,0x13,0x3f,
-0x22,0x17,0x33,0xfa,0x5f,0xff,0xbb,0x30,0x23,0x6f,0xfe,0x73,0x08,0x23,0x6f,0xfe,
-0x61,0x2e,0x23,0x4f,0xff,0xc4,0x03,0x03,0x98,0x2e,0x25,0x9f,0xfb,0x3f,0x00,0x05,
-0x51,0x00,0x31,0x03,0xff,0xf8,0x80,0x02,0x50,0xb0,0x00,0x8f,0xff,0x91,0x4b,0x17,
-0x13,0x10,0x75,0x34,0x13,0xf4,0x99,0x00,0x01,0x46,0x15,0x50,0x02,0x8d,0xef,0xeb,
-0x60,0x50,0x38,0x31,0x02,0x8d,0xff,0xce,0x09,0x12,0x86,0xa8,0x2d,0x25,0x8f,0xfd,
-0xce,0x09,0x22,0x92,0x00,0xfb,0x2f,0x01,0xdc,0x05,0x23,0xf9,0x08,0xed,0x05,0x03,
-0xce,0x09,0x32,0x3f,0xff,0x28,0x92,0x03,0x04,0x68,0x01,0x0d,0xce,0x09,0x14,0x0c,
-0xce,0x09,0x33,0xdf,0xf7,0x8f,0xab,0x1e,0x10,0x58,0x11,0x00,0x00,0x13,0x09,0x02,
-0xf2,0x13,0x33,0x9f,0xfe,0x08,0x67,0x1b,0x41,0x80,0x8f,0xff,0xf7,0x17,0x11,0x00,
-0x92,0x03,0x10,0xcc,0x0c,0x30,0x33,0x8f,0xfb,0x7f,0xce,0x09,0x21,0xb0,0x28,0xce,
-0x09,0x2f,0x8f,0xfb,0x3c,0x04,0x2f,0x00,0x28,0x07,0x20,0xfe,0xa4,0x05,0x0d,0x10,
-0x3e,0x1a,0x0b,0x11,0x6f,0x24,0x09,0x10,0xdd,0xb4,0x0b,0x10,0x0c,0x4a,0x03,0x32,
-0x6f,0xff,0xfb,0x49,0x1c,0x32,0x3f,0xff,0xb0,0x43,0x2b,0x1e,0x9f,0x24,0x09,0x1f,
-0x4f,0x24,0x09,0x17,0x19,0xff,0x24,0x09,0x13,0x09,0x24,0x09,0x00,0x2a,0x3d,0x30,
-0xcf,0xff,0x70,0x36,0x10,0x30,0xb0,0x02,0xef,0x12,0x0a,0x22,0xff,0xfb,0x9c,0x2f,
-0x12,0xa9,0x24,0x09,0x4f,0xea,0x40,0x8f,0xfb,0x28,0x05,0x31,0xa0,0x8f,0xfa,0x04,
-0xbe,0xfa,0x8f,0xfa,0x7f,0xff,0xfa,0xa3,0x0b,0x61,0xfa,0x8f,0xff,0xfe,0x75,0x43,
-0x24,0x03,0x01,0x21,0x03,0x01,0x31,0x00,0x0f,0x05,0x00,0x2d,0x00,0x2a,0x09,0x11,
-0xcf,0x2a,0x09,0x01,0x79,0x34,0x10,0xe5,0x5c,0x00,0x60,0xfd,0xcf,0xff,0xff,0x50,
-0x02,0xef,0x2b,0x31,0x5e,0xff,0xe1,0xfa,0x0c,0x32,0x02,0xff,0xf6,0x50,0x30,0x22,
-0xbf,0xf8,0x0a,0x0d,0x30,0x01,0x10,0x04,0xe6,0x07,0x02,0x2a,0x03,0x23,0xfd,0x84,
-0x7a,0x3e,0x01,0x8e,0x2e,0x34,0x00,0x17,0xcf,0x1c,0x1c,0x43,0x48,0xdf,0xff,0xc0,
-0xcd,0x0e,0x32,0xf6,0x15,0x54,0xa6,0x1c,0x02,0xd6,0x09,0x13,0x8f,0x0d,0x16,0xa3,
-0xbf,0xfa,0x08,0xff,0xf9,0x10,0x00,0x19,0xff,0xf4,0xc3,0x09,0x12,0xa0,0x39,0x40,
-0x00,0xed,0x05,0x52,0x38,0xce,0xff,0xc8,0x20,0x2b,0x3f,0x03,0x9b,0x31,0x0b,0x0b,
-0x00,0x11,0x0d,0xcc,0x2d,0x01,0x6f,0x0d,0x6e,0x68,0x99,0xcf,0xff,0x99,0x94,0x2c,
-0x00,0x0f,0x0b,0x00,0x19,0x24,0x5f,0xfe,0xeb,0x15,0x00,0x75,0x27,0x01,0xc0,0x12,
-0x10,0xee,0x2c,0x0e,0x00,0x8e,0x03,0x62,0x04,0xcf,0xfd,0x50,0x9f,0xfa,0xfc,0x0c,
-0x0f,0x08,0x00,0x55,0x22,0x7f,0xfd,0xbc,0x12,0x01,0xae,0x1d,0x10,0x0a,0xae,0x1b,
-0x10,0xd3,0xe7,0x19,0x22,0xf6,0x07,0x24,0x25,0x11,0xf6,0x51,0x06,0xb1,0xf6,0xcf,
-0xf6,0x00,0x04,0xbe,0xfe,0xc8,0x20,0xbf,0xf6,0xb3,0x38,0x00,0x3c,0x2b,0x22,0xef,
-0xf6,0xce,0x0c,0x00,0xc2,0x07,0x01,0xd7,0x00,0x23,0x3f,0xff,0x10,0x31,0x22,0xdf,
-0xf5,0x29,0x31,0x32,0x08,0xff,0xa0,0xfb,0x3c,0x23,0x2f,0xff,0x7a,0x33,0x22,0xdf,
-0xf4,0x42,0x31,0x00,0x77,0x10,0x21,0x3f,0xfd,0x42,0x36,0x01,0x7a,0x3b,0x00,0x39,
-0x2c,0x01,0xc4,0x3c,0x00,0x1a,0x00,0x21,0x2f,0xfd,0xeb,0x09,0x11,0xfe,0xda,0x3c,
-0x00,0x63,0x35,0x22,0xcf,0xf2,0x3e,0x13,0x24,0xaf,0xfd,0x7c,0x2c,0x13,0x70,0x2b,
-0x1f,0x13,0xf2,0x58,0x13,0x14,0xfc,0x96,0x2c,0x04,0xa7,0x1e,0x15,0xf2,0xe3,0x33,
-0x22,0xff,0xe0,0x9f,0x33,0x01,0x95,0x00,0x01,0xe5,0x00,0x10,0x06,0xe3,0x23,0x14,
-0x90,0xd8,0x16,0x20,0xaf,0xf8,0xf8,0x3b,0x00,0x91,0x13,0x12,0xd0,0x7a,0x36,0x21,
-0xff,0xf1,0x13,0x1a,0x10,0x20,0x4a,0x17,0x01,0xd3,0x10,0x42,0x07,0xff,0x9f,0xf6,
-0xf3,0x3d,0x20,0x7f,0xf9,0xc9,0x2e,0x21,0xff,0xb0,0x00,0x36,0x00,0x38,0x3d,0x41,
-0x1f,0xf9,0x0c,0xff,0xb6,0x2c,0x00,0x1c,0x35,0x80,0x05,0xff,0x50,0x7f,0xf5,0x00,
-0x1f,0xfd,0x55,0x00,0x50,0xf5,0x00,0xaf,0xf0,0x02,0x70,0x33,0x10,0x90,0xed,0x01,
-0x30,0x90,0x0e,0xfb,0x73,0x2e,0x20,0x9f,0xf4,0x96,0x00,0x72,0xfd,0x03,0xff,0x60,
-0x00,0x9f,0xf3,0x05,0x3b,0xa1,0xcf,0xf1,0x8f,0xf2,0x00,0x04,0xff,0x81,0xff,0xb0,
-0x94,0x03,0x20,0x5d,0xfd,0xd3,0x3a,0x02,0xce,0x3a,0x40,0x3f,0xfb,0xff,0x80,0x7e,
-0x0d,0x03,0x50,0x33,0x00,0x6f,0x08,0x13,0x05,0x72,0x22,0x11,0x0b,0x48,0x14,0x13,
-0x0f,0xf1,0x12,0x12,0x6f,0x34,0x03,0x04,0xe7,0x29,0x12,0xf5,0x8d,0x41,0x03,0xa9,
-0x11,0x01,0xfc,0x3d,0x15,0xfc,0xe5,0x2f,0x10,0x3f,0x0a,0x17,0x11,0xf8,0x7d,0x2a,
-0x00,0x84,0x03,0x11,0x20,0x89,0x1f,0x01,0x2f,0x1c,0x01,0x0b,0x39,0x31,0x04,0xff,
-0xf4,0x4c,0x42,0x00,0x30,0x2b,0x32,0x02,0xff,0xf6,0xa6,0x20,0x34,0x7c,0xff,0xc0,
-0xc1,0x15,0x13,0x20,0x78,0x01,0x14,0xf8,0xe8,0x15,0x14,0xd0,0xf9,0x13,0x14,0xe1,
-0xd7,0x14,0x14,0xfa,0x24,0x38,0x04,0xa7,0x2d,0x12,0x58,0xb4,0x00,0x22,0xcf,0xfb,
-0x57,0x08,0x00,0xba,0x1c,0x12,0x5f,0x86,0x2d,0x11,0x80,0x3d,0x19,0x30,0x00,0xbf,
-0xfe,0xed,0x04,0x52,0xf7,0x00,0x05,0xff,0xf6,0x58,0x1c,0x01,0xc9,0x27,0x00,0x9a,
-0x06,0x31,0x7f,0xff,0x10,0xe8,0x00,0x32,0x61,0xff,0xf6,0xad,0x25,0x02,0x50,0x0d,
-0x22,0xaf,0xfc,0x5f,0x19,0x10,0x0e,0x02,0x0e,0x12,0xf6,0x44,0x18,0x11,0x0b,0xb1,
-0x04,0x11,0xfc,0x6e,0x20,0x00,0xfd,0x22,0x01,0x6b,0x19,0x01,0xe6,0x34,0x00,0x68,
-0x0f,0x22,0x7f,0xfc,0xa4,0x0f,0x02,0x60,0x3a,0x21,0xff,0xf5,0x22,0x19,0x00,0x11,
-0x35,0x22,0x5f,0xfc,0xbe,0x0f,0x01,0xd6,0x3f,0x00,0xce,0x02,0x22,0xef,0xf1,0xb6,
-0x14,0x05,0x5e,0x31,0x03,0x53,0x02,0x15,0xef,0x48,0x13,0x14,0xfc,0xf3,0x00,0x03,
-0x6c,0x02,0x03,0xb4,0x2e,0x02,0x66,0x01,0x01,0xc2,0x02,0x04,0xef,0x39,0x13,0xf2,
-0x0b,0x10,0x12,0xfc,0x26,0x13,0x33,0x6f,0xff,0x40,0x44,0x0a,0x13,0xb0,0x41,0x33,
-0x12,0xd1,0x80,0x33,0x37,0xfd,0x80,0x00,0x93,0x15,0x14,0xf2,0x08,0x00,0x10,0x3c,
-0xa8,0x0e,0x38,0xcf,0xff,0xe0,0x04,0x15,0x13,0x03,0x0b,0x18,0x13,0x0d,0x7a,0x01,
-0x12,0x9f,0x1e,0x02,0x13,0x05,0x4e,0x16,0x13,0x1e,0x0a,0x05,0x33,0xbf,0xfe,0x10,
-0xbe,0x17,0x03,0xe4,0x0e,0x12,0x90,0x92,0x00,0x19,0xfd,0xb1,0x15,0x03,0xc3,0x00,
-0x04,0x90,0x15,0x33,0x0b,0xff,0xf1,0xcc,0x10,0x10,0xeb,0xd9,0x12,0x23,0xb7,0x7f,
-0x0b,0x1d,0x04,0x08,0x00,0x05,0x1b,0x0c,0x21,0x08,0xe4,0xc4,0x12,0x10,0xa0,0x42,
-0x00,0x11,0xa2,0xc6,0x2e,0x00,0x6b,0x00,0x11,0xe0,0x9b,0x38,0x04,0xc4,0x32,0x02,
-0xa6,0x1a,0x01,0x7f,0x08,0x02,0x6c,0x36,0x09,0x0b,0x00,0x01,0x19,0x11,0x14,0xf0,
-0xee,0x38,0x00,0x6c,0x17,0x21,0x09,0xdf,0xc7,0x19,0x02,0x1d,0x40,0x10,0xfe,0x11,
-0x11,0x02,0xc4,0x00,0x12,0xdf,0x34,0x02,0x02,0xbc,0x02,0x02,0xe0,0x09,0x0e,0x58,
-0x00,0x03,0x6e,0x00,0x02,0xde,0x35,0x01,0x98,0x04,0x02,0x92,0x1a,0x11,0x3f,0x72,
-0x01,0x13,0x8f,0x01,0x13,0x10,0x90,0x65,0x2a,0x11,0xf6,0x95,0x11,0x4f,0x10,0xef,
-0xbe,0xfb,0x03,0x00,0x18,0x22,0xb7,0x85,0x7f,0x16,0x24,0xe9,0x10,0x8a,0x01,0x10,
-0x01,0x45,0x0b,0x00,0x0c,0x00,0x14,0x20,0x0e,0x1b,0x02,0xa4,0x00,0x02,0xd4,0x07,
-0x03,0x5d,0x27,0x14,0x40,0xee,0x11,0x07,0x0b,0x00,0x02,0xbb,0x39,0x22,0xdf,0xf6,
-0xe9,0x07,0x02,0xa8,0x1c,0x01,0xc4,0x03,0x11,0xda,0x91,0x01,0x11,0xf0,0xf6,0x22,
-0x00,0xe0,0x01,0x14,0xc4,0x53,0x00,0x25,0xbf,0xf8,0x3d,0x10,0x0c,0x4d,0x00,0x07,
-0x0b,0x00,0x01,0x75,0x0f,0x07,0x54,0x01,0x01,0x87,0x1c,0x10,0x3e,0xa4,0x01,0x11,
-0x7f,0xef,0x0a,0x11,0xfe,0x5b,0x37,0x03,0x88,0x18,0x30,0xcf,0xfc,0x70,0x06,0x01,
-0x33,0x88,0x10,0x0b,0x6c,0x3c,0x31,0xaf,0xf1,0x09,0xd4,0x22,0x00,0x77,0x05,0x00,
-0xf8,0x03,0x90,0x5e,0xff,0xf9,0x10,0x3c,0xff,0x80,0x7f,0xf8,0x07,0x2e,0x00,0xb9,
-0x19,0x12,0x0a,0x15,0x42,0x00,0x8e,0x33,0x20,0x46,0x60,0x88,0x02,0x3f,0xae,0xfe,
-0x91,0x5e,0x34,0x05,0x1a,0x55,0x0f,0x00,0x19,0xdd,0x0e,0x00,0x16,0x06,0x6d,0x1e,
-0x02,0xba,0x13,0x28,0xe0,0x00,0x75,0x0e,0x06,0x16,0x19,0x02,0x75,0x03,0x17,0xfe,
-0x0e,0x00,0x14,0x07,0x38,0x45,0x05,0x83,0x32,0x05,0x22,0x18,0x01,0xe6,0x01,0x16,
-0xbc,0xa8,0x1c,0x00,0x43,0x1b,0x10,0x33,0x08,0x44,0x05,0xa3,0x18,0x13,0xfa,0xf7,
-0x15,0x03,0xb8,0x04,0x35,0xf2,0x00,0x2f,0x7c,0x18,0x01,0x1a,0x00,0x15,0x09,0xe0,
-0x02,0x10,0x03,0x38,0x00,0x15,0x01,0xd7,0x1a,0x11,0x0b,0x56,0x00,0x14,0x8f,0x2f,
-0x09,0x11,0x3f,0x74,0x00,0x14,0x1f,0xf3,0x18,0x11,0xcf,0x92,0x00,0x13,0x07,0x15,
-0x04,0x13,0x04,0xb0,0x00,0x03,0xfc,0x04,0x33,0x0d,0xff,0xf6,0xa1,0x05,0x18,0xd0,
-0xe8,0x19,0x12,0x0d,0x96,0x03,0x02,0x9a,0x2c,0x00,0xbc,0x03,0x18,0xfd,0xc4,0x06,
-0x20,0x00,0xcf,0x22,0x01,0x17,0x0e,0x71,0x19,0x10,0xe0,0x18,0x01,0x22,0xd2,0x22,
-0x01,0x00,0x37,0x2d,0xff,0xf7,0x9c,0x48,0x00,0xa6,0x0b,0x38,0x10,0x08,0xff,0x01,
-0x00,0x29,0x80,0x1f,0x0f,0x00,0x29,0xf1,0x9f,0x0f,0x00,0x15,0xf9,0x22,0x01,0x49,
-0x28,0xcd,0xb7,0x10,0x5b,0x01,0x17,0xe5,0x4b,0x01,0x15,0xff,0xcd,0x28,0x00,0xa8,
-0x2a,0x23,0x64,0x7e,0xdf,0x05,0x70,0x47,0x81,0x0a,0xff,0xe1,0x00,0x02,0xa5,0x01,
-0x00,0x2a,0x38,0x02,0xf5,0x0a,0x12,0x9f,0x57,0x16,0x00,0x41,0x16,0x11,0x40,0xee,
-0x09,0x00,0xa7,0x13,0x21,0xfc,0x81,0x0c,0x1a,0x10,0xbf,0xc4,0x49,0x02,0x7d,0x0e,
-0x11,0xf4,0xf8,0x32,0x10,0x09,0x97,0x23,0x00,0x53,0x08,0x21,0xb9,0xcf,0x3a,0x1b,
-0x00,0xa6,0x03,0x00,0x5b,0x09,0x00,0x20,0x32,0x02,0xb4,0x2a,0x12,0xff,0xf0,0x40,
-0x11,0x06,0x25,0x01,0x11,0x03,0x79,0x04,0x22,0x14,0x20,0xf8,0x05,0x11,0x06,0x7b,
-0x0c,0x22,0xaf,0xf2,0xcc,0x12,0x11,0x09,0x28,0x00,0x43,0xdf,0xf6,0x3f,0xff,0x69,
-0x1c,0x10,0xf9,0x4e,0x1f,0x02,0xac,0x3b,0x02,0x43,0x04,0x42,0x6f,0xfc,0x6f,0xfc,
-0x2a,0x02,0x11,0xb1,0xc6,0x3b,0x02,0x1c,0x00,0x22,0x4f,0xf7,0x0c,0x3a,0x02,0x38,
-0x00,0x22,0x7d,0x30,0x05,0x0b,0x02,0xc6,0x24,0x13,0x50,0xc9,0x24,0x05,0x89,0x3b,
-0x01,0x54,0x16,0x04,0xab,0x24,0x02,0xd8,0x0c,0x14,0x01,0x1c,0x20,0x02,0xc1,0x09,
-0x04,0x78,0x1d,0x02,0xd4,0x3d,0x34,0x0c,0xff,0xf8,0x80,0x24,0x11,0xf4,0x39,0x48,
-0x22,0xc4,0x00,0x0a,0x39,0x12,0x70,0xc9,0x3a,0x43,0xd8,0x53,0x34,0x6a,0xb2,0x24,
-0x25,0x01,0xbf,0x2b,0x34,0x03,0xe9,0x22,0x01,0xbf,0x01,0x05,0x82,0x37,0x4f,0xff,
-0xff,0xda,0x50,0xea,0x39,0x12,0x04,0x13,0x3f,0x16,0x30,0xb3,0x00,0x05,0x17,0x25,
-0x00,0x01,0x00,0x12,0x71,0x54,0x27,0x32,0xc0,0x01,0xd9,0xd1,0x02,0x12,0xfd,0x32,
-0x02,0x02,0x55,0x01,0x00,0xee,0x01,0x30,0xd2,0x00,0xbf,0x2f,0x00,0x12,0xbf,0xa0,
-0x02,0x50,0x2e,0xff,0xf7,0x00,0x1e,0xa9,0x19,0x30,0xcf,0xfe,0x20,0x4c,0x26,0x20,
-0x02,0xef,0xc6,0x3e,0x00,0xa8,0x49,0x30,0xf3,0x4c,0xf1,0x04,0x09,0x14,0x47,0x9f,
-0x36,0x30,0x4c,0xff,0xf8,0x8c,0x02,0x01,0xd2,0x1e,0x11,0xc0,0x68,0x01,0x33,0xfe,
-0x00,0x02,0x06,0x1e,0x11,0x20,0xa2,0x01,0x56,0x91,0x00,0x00,0x06,0xdf,0x1d,0x39,
-0x68,0x92,0x13,0x20,0x05,0x76,0x54,0xb4,0x03,0x27,0xd0,0x0f,0x93,0x02,0x00,0x23,
-0x2a,0x06,0x62,0x2b,0x01,0x20,0x00,0x0a,0x10,0x00,0x66,0x39,0x75,0x30,0x00,0x12,
-0x42,0x10,0x00,0x57,0x6c,0x73,0x00,0x01,0x7c,0x74,0x49,0x10,0xcf,0xda,0x09,0x05,
-0xa5,0x36,0x00,0x4c,0x02,0x36,0xa0,0x04,0xff,0x71,0x04,0x84,0x01,0xae,0xff,0x50,
-0x00,0xee,0x94,0x71,0x10,0x00,0x85,0x1d,0x80,0x26,0x00,0x00,0x10,0x1c,0xfb,0xa5,
-0x30,0x21,0xfc,0x20,0x5c,0x3e,0x15,0x80,0x09,0x04,0x11,0xe0,0xf7,0x08,0x21,0x68,
-0x10,0x3e,0x00,0x21,0xa9,0x5e,0xc6,0x01,0x42,0xaf,0xe3,0x8f,0xf8,0x99,0x03,0x21,
-0x41,0xca,0x3c,0x03,0x75,0x11,0xff,0xfe,0x5b,0x96,0x29,0xce,0xc7,0x1d,0x85,0x09,
-0xff,0xf6,0x9f,0xff,0x5f,0xff,0x4a,0xfa,0x1e,0x84,0xef,0xd0,0xbf,0xfd,0x1f,0xff,
-0x81,0xee,0x89,0x00,0x86,0x19,0x40,0xef,0xfa,0x0e,0xff,0xb0,0x31,0xb9,0x00,0x4f,
-0xad,0xf7,0x0a,0xea,0xb1,0x39,0x06,0x29,0x05,0x20,0x0f,0x00,0x10,0x01,0x45,0x0b,
-0x45,0x13,0x43,0x20,0x00,0x0b,0x1d,0x30,0xff,0x45,0xae,0xe3,0x16,0x06,0x0d,0x4b,
-0x15,0xff,0xd6,0x30,0x00,0x19,0x03,0x22,0xf9,0xef,0x91,0x35,0x23,0xff,0xe3,0xed,
-0x04,0x10,0x2e,0x75,0x0d,0x21,0x03,0x8e,0x1a,0x01,0x52,0x09,0xff,0xf9,0x00,0x02,
-0xf2,0x1d,0x10,0x7f,0xaf,0x04,0x10,0x2f,0x93,0x03,0x11,0x1d,0x95,0x01,0x10,0x03,
-0x53,0x2a,0x31,0x0e,0xff,0xf7,0xc8,0x02,0x11,0xa0,0x1a,0x02,0x13,0xe0,0x1f,0x01,
-0x11,0x1c,0x2e,0x05,0x10,0x03,0x1c,0x00,0x12,0x1f,0x4f,0x0a,0x21,0xff,0x10,0x70,
-0x31,0x10,0x10,0x1c,0x20,0x13,0x90,0xd4,0x04,0x01,0xf9,0x16,0x10,0x8f,0x3a,0x08,
-0x34,0x4f,0xff,0xe2,0x75,0x0e,0x52,0xdf,0xf7,0xbf,0xff,0xb4,0x0f,0x36,0x02,0x97,
-0x4c,0x22,0xf3,0x0b,0xcd,0x4c,0x02,0x32,0x1c,0x00,0x9a,0x09,0x15,0xaf,0xcc,0x02,
-0x20,0xff,0xf3,0x5c,0x1c,0x02,0x91,0x2f,0x02,0xe2,0x17,0x01,0x8f,0x48,0x34,0x6a,
-0x30,0x00,0x20,0x00,0x05,0x91,0x3d,0x04,0x38,0x38,0x02,0xa7,0x21,0x06,0x8e,0x19,
-0x04,0x23,0x23,0x04,0x50,0x16,0x16,0x1f,0x28,0x03,0x01,0x52,0x4a,0x17,0x0a,0x4b,
-0x39,0x00,0x61,0x0c,0x16,0x02,0x39,0x03,0x01,0x1c,0x0b,0x07,0x77,0x26,0x11,0x4f,
-0x31,0x03,0x14,0x0c,0x21,0x00,0x12,0x06,0x06,0x33,0x22,0x01,0xef,0xe5,0x03,0x13,
-0x03,0x8f,0x0c,0x00,0x32,0x07,0x53,0xd9,0x54,0x34,0x58,0xcf,0xe5,0x00,0x03,0x50,
-0x05,0x03,0xbc,0x2b,0x07,0x80,0x39,0x26,0xb3,0x00,0x81,0x39,0x45,0xce,0xff,0xda,
-0x61,0x0e,0x00,0x14,0xbb,0x01,0x00,0x16,0xa0,0xed,0x2b,0x02,0x31,0x1c,0x06,0xc7,
-0x38,0x03,0xd5,0x17,0x06,0x3d,0x48,0x00,0x9f,0x00,0x17,0xf2,0x03,0x3c,0x33,0x9f,
-0xff,0xc0,0xec,0x23,0x02,0x92,0x06,0x15,0x50,0x8d,0x40,0x00,0xd3,0x05,0x07,0xf9,
-0x25,0x01,0x1c,0x2a,0x05,0xc3,0x1a,0x33,0x0d,0xff,0xf2,0xfe,0x2b,0x02,0x21,0x01,
-0x12,0xe0,0x37,0x00,0x17,0xf3,0xaf,0x1f,0x12,0xaf,0x96,0x17,0x02,0x40,0x12,0x14,
-0x2c,0x37,0x19,0x20,0xcf,0xfd,0xc5,0x3f,0x00,0x42,0x03,0x02,0x0c,0x38,0x14,0x30,
-0xa0,0x21,0x01,0xc2,0x00,0x44,0x90,0x01,0xff,0xe3,0x34,0x05,0x46,0xfa,0xff,0xd0,
-0x07,0x30,0x0c,0x43,0x41,0xff,0x80,0x0d,0xf4,0x1f,0x10,0x06,0xaa,0x44,0x22,0x30,
-0x3f,0xfe,0x01,0x00,0x15,0x25,0x51,0x08,0xfe,0x00,0x9f,0xbc,0x50,0x04,0x00,0xe0,
-0x08,0x73,0x0c,0xf9,0x00,0xef,0x46,0xff,0xc0,0xfd,0x39,0x42,0x0f,0xf4,0x05,0xfc,
-0xa2,0x42,0x00,0x0e,0x00,0x42,0x3f,0xe0,0x08,0x93,0x9e,0x1e,0x00,0x3b,0x46,0x20,
-0x49,0x50,0x76,0x00,0x26,0xc0,0x00,0x7d,0x45,0x03,0xe0,0x0b,0x36,0x06,0xff,0xe1,
-0x34,0x3d,0x00,0xc3,0x20,0x10,0x10,0xe7,0x02,0x14,0xfa,0x2d,0x20,0x44,0xe7,0x20,
-0x03,0x9f,0x4e,0x46,0x03,0x56,0x07,0x04,0x96,0x03,0x01,0xf4,0x45,0x15,0xd3,0xb2,
-0x01,0x48,0x7c,0xff,0xff,0xb6,0x51,0x3d,0x18,0x20,0xe3,0x08,0x55,0x88,0x88,0x88,
-0x88,0x80,0x00,0x23,0x00,0xa5,0x1d,0x0f,0x0c,0x00,0x08,0x31,0x11,0x11,0x1c,0x59,
-0x36,0x46,0x33,0x44,0x51,0xdf,0xa8,0x07,0x30,0xfc,0xff,0xff,0xd6,0x2c,0x00,0x57,
-0x2c,0x26,0xcd,0xfd,0xd2,0x04,0x18,0x02,0x0c,0x00,0x1b,0xfe,0x0c,0x00,0x62,0x23,
-0x33,0x33,0x33,0x33,0x31,0x0c,0x00,0x12,0xef,0xed,0x07,0x0a,0x0c,0x00,0x1a,0xef,
-0x0c,0x00,0x05,0x3c,0x00,0x2f,0xef,0x30,0x0c,0x00,0x06,0x10,0x33,0x01,0x00,0x65,
-0x32,0x00,0x02,0xff,0xef,0x30,0x3c,0x00,0x0f,0x0c,0x00,0x09,0x05,0x82,0x06,0x26,
-0xdf,0x30,0x95,0x03,0x27,0xdf,0x40,0x0c,0x00,0xc7,0x51,0x11,0x12,0x22,0x22,0x22,
-0x23,0x33,0x33,0x35,0xff,0xdf,0x99,0x08,0x11,0x9f,0xb0,0x16,0x10,0xff,0xcc,0x3a,
-0x1f,0xb8,0x38,0x01,0x12,0x0a,0x0c,0x00,0x12,0x01,0xa0,0x45,0x0f,0xf0,0x3e,0x05,
-0x54,0x8b,0xef,0xff,0xeb,0x72,0xd3,0x3c,0x12,0xcf,0x60,0x35,0x18,0x50,0x85,0x07,
-0x34,0xf4,0xcd,0x30,0x98,0x1f,0x00,0x8d,0x01,0x22,0xcf,0xf8,0xb5,0x2f,0xb5,0xd7,
-0x42,0x23,0x59,0xdf,0x80,0xcf,0xff,0xd4,0x00,0x3f,0x21,0x09,0x55,0xcf,0x9d,0xff,
-0xa1,0xdf,0x2e,0x0a,0x34,0xcf,0x50,0x8f,0x80,0x2d,0x01,0x0e,0x00,0x36,0x02,0xcf,
-0xff,0xeb,0x36,0x14,0x50,0x0f,0x42,0x03,0x0e,0x00,0x25,0x00,0x1a,0x43,0x02,0x12,
-0xcf,0x5f,0x3b,0x16,0x90,0x0e,0x00,0x00,0xe8,0x14,0x17,0x40,0x0e,0x00,0x38,0x03,
+0x00,0xf6,0x03,0xf9,0x00,0x9f,0xf8,0x00,0xcf,0xf5,0x01,0xff,0xf0,0x07,0xff,0x90,
+0x1f,0xff,0x10,0x07,0xf4,0x23,0x00,0x21,0x06,0x70,0x07,0x00,0x21,0x6e,0xfa,0x26,
+0x01,0x01,0xe1,0x01,0x30,0x01,0x8e,0xff,0x8e,0x01,0xf0,0x09,0x18,0xff,0xff,0xfe,
+0x82,0x00,0x02,0x9f,0xff,0xff,0xd6,0x00,0x00,0x2a,0xff,0xff,0xfa,0x40,0x00,0x00,
+0x0b,0xff,0xfe,0x81,0x29,0x00,0x11,0xbf,0xea,0x01,0x00,0x14,0x02,0x20,0xe7,0x10,
+0xf3,0x01,0x40,0xaf,0xff,0xff,0xa3,0x11,0x00,0x41,0x29,0xff,0xff,0xfd,0x99,0x02,
+0x61,0x9f,0xff,0xff,0xf9,0x20,0x00,0x45,0x00,0x11,0xfa,0x0c,0x01,0x22,0x7e,0xff,
+0xe7,0x00,0x23,0x07,0xea,0x79,0x00,0x10,0x30,0x5c,0x01,0x00,0x5c,0x02,0x04,0x08,
+0x00,0x21,0x4e,0xee,0x01,0x00,0x1f,0xe4,0xd5,0x00,0x0d,0x04,0x28,0x00,0x0c,0x40,
+0x00,0x13,0x86,0x20,0x00,0x32,0xaf,0xe8,0x10,0x08,0x00,0x02,0x82,0x00,0x51,0x00,
+0x6e,0xff,0xff,0xfa,0x8f,0x02,0x58,0x5c,0xff,0xff,0xfc,0x40,0xa6,0x00,0x51,0x00,
+0x06,0xcf,0xff,0xfe,0x00,0x01,0x41,0x03,0x9f,0xff,0xf6,0x35,0x00,0x12,0x3a,0x08,
+0x00,0x81,0x6c,0xff,0xff,0xe3,0x00,0x00,0x02,0x8e,0xfc,0x00,0xc2,0x05,0xbf,0xff,
+0xff,0xc5,0x00,0x00,0x18,0xef,0xff,0xff,0xb4,0xc7,0x01,0x12,0xa2,0x60,0x00,0x11,
+0x81,0x33,0x00,0x22,0xae,0x70,0x78,0x00,0x14,0x20,0xa1,0x00,0x80,0x01,0x7c,0xef,
+0xec,0x81,0x00,0x00,0x05,0x96,0x00,0x11,0xf6,0x07,0x00,0x00,0x42,0x03,0xa0,0xef,
+0xfe,0x61,0x00,0x5e,0xff,0xe0,0x6f,0xff,0x20,0x98,0x03,0xb0,0x49,0xff,0xb0,0x00,
+0x00,0x00,0xdf,0xf7,0x46,0x63,0x00,0x56,0x01,0x21,0x80,0x00,0x8b,0x02,0x11,0xf7,
+0x07,0x00,0x01,0x35,0x03,0x00,0x5d,0x01,0x12,0xe0,0x55,0x02,0x12,0xf5,0x07,0x00,
+0x01,0x48,0x01,0x41,0x04,0xff,0xfc,0x00,0x64,0x03,0x11,0xfc,0x2b,0x00,0x12,0xdf,
+0x07,0x00,0x32,0x4f,0xff,0x20,0x32,0x00,0x22,0xc0,0x00,0xf5,0x02,0x02,0xdb,0x01,
+0x2f,0x88,0x40,0x47,0x01,0x08,0x41,0x02,0xbb,0x30,0x00,0xcb,0x01,0x11,0xfd,0x07,
+0x00,0x32,0x0c,0xff,0xe0,0x5e,0x01,0x05,0x5a,0x02,0x32,0x03,0x8c,0xef,0xa9,0x02,
+0x02,0xdc,0x02,0x11,0xdf,0xc8,0x00,0x13,0x81,0x3d,0x00,0x82,0xcf,0xff,0xea,0x76,
+0x68,0x9d,0xff,0xfe,0x62,0x00,0x30,0x3e,0xff,0xc4,0x07,0x00,0x12,0x28,0x3d,0x01,
+0x13,0x03,0x4c,0x01,0x21,0x00,0x2c,0xc9,0x00,0x12,0x1e,0x0d,0x04,0x00,0xe0,0x00,
+0x10,0xe1,0x70,0x00,0x14,0xf3,0x53,0x00,0x20,0x1e,0xf9,0xd7,0x00,0x10,0x70,0x32,
+0x00,0x11,0x43,0xe2,0x00,0x42,0x10,0x00,0x0d,0xfd,0x86,0x02,0x91,0xfa,0x10,0x00,
+0x00,0xdf,0x70,0x00,0x4f,0xf5,0x6c,0x02,0x01,0x8d,0x01,0x50,0x8f,0xc0,0x00,0xaf,
+0xe0,0x6c,0x03,0x90,0xb3,0x01,0x9f,0xf4,0x00,0x00,0x3f,0xf0,0x00,0x76,0x03,0xb0,
+0x4f,0xfb,0x00,0x00,0x6f,0xf3,0x00,0x00,0x0f,0xf3,0x04,0x6d,0x00,0xf0,0x00,0xdf,
+0xf1,0x00,0x00,0x7f,0xf2,0x00,0x00,0x0e,0xf6,0x07,0xff,0x10,0x00,0x03,0x58,0x01,
+0xb0,0x9f,0xf0,0x00,0x00,0x0c,0xf7,0x0a,0xfe,0x00,0x00,0x09,0x26,0x01,0xc0,0xaf,
+0xf0,0x00,0x00,0x0b,0xf8,0x0c,0xfc,0x00,0x00,0x0d,0xfe,0x5d,0x00,0x10,0xd0,0x0f,
+0x00,0x60,0x0d,0xfa,0x00,0x00,0x0f,0xfb,0x50,0x01,0x10,0xc0,0x0f,0x00,0x60,0x0e,
+0xf9,0x00,0x00,0x3f,0xf9,0xe9,0x03,0x10,0xa0,0x3c,0x00,0x00,0x0f,0x00,0x10,0x4f,
+0x9b,0x01,0x00,0x71,0x00,0x20,0x0e,0xf5,0x0f,0x00,0x50,0x5f,0xf7,0x00,0x00,0x01,
+0x5e,0x00,0xb0,0x1f,0xf2,0x0d,0xfb,0x00,0x00,0x4f,0xf8,0x00,0x00,0x07,0xca,0x00,
+0xb0,0x6f,0xe0,0x0b,0xfc,0x00,0x00,0x2f,0xfc,0x00,0x00,0x1e,0x1e,0x00,0x40,0xdf,
+0x80,0x09,0xff,0x8d,0x04,0x70,0x50,0x01,0xcf,0xff,0xc0,0x00,0x08,0xaf,0x04,0xc2,
+0x30,0x00,0x08,0xff,0xfb,0xae,0xfb,0x9f,0xf8,0x24,0xaf,0xf6,0x43,0x00,0x70,0xdf,
+0xff,0xff,0xc1,0x1e,0xff,0xff,0x3f,0x00,0xc0,0xcf,0xe0,0x00,0x00,0x08,0xef,0xd7,
+0x00,0x02,0xae,0xfe,0xa3,0xac,0x04,0x19,0xf6,0xb2,0x01,0x38,0x0d,0xfe,0x10,0x0f,
+0x00,0x39,0x04,0xff,0xc0,0x1f,0x00,0x29,0x8f,0xfc,0x1f,0x00,0x12,0x09,0x6d,0x04,
+0x23,0x03,0x70,0x10,0x00,0x84,0x7f,0xff,0xfb,0x75,0x44,0x69,0xdf,0xf0,0xff,0x01,
+0x11,0xaf,0xd0,0x01,0x15,0xc1,0xb5,0x02,0x56,0x6a,0xde,0xff,0xeb,0x73,0x3f,0x00,
+0x16,0xef,0x7c,0x00,0x03,0x74,0x02,0x03,0xeb,0x04,0x15,0xff,0xe8,0x02,0x23,0x1f,
+0xff,0xb8,0x02,0x00,0xab,0x00,0x13,0xfb,0x40,0x02,0x00,0xe7,0x01,0x34,0xf4,0xcf,
+0xf4,0x66,0x00,0x31,0xff,0xe0,0x6f,0xb8,0x02,0x01,0x9e,0x02,0x33,0x80,0x1f,0xff,
+0xa3,0x00,0x35,0x0e,0xff,0x20,0x4e,0x05,0x26,0x4f,0xfc,0xcb,0x00,0x62,0xaf,0xf7,
+0x00,0x00,0xef,0xf2,0x91,0x00,0x00,0x9e,0x06,0x23,0x9f,0xf8,0x51,0x05,0x15,0xb0,
+0x6e,0x05,0x10,0x0c,0x7b,0x04,0x12,0x0d,0x23,0x03,0x21,0x2f,0xff,0xdb,0x05,0x11,
+0xa0,0xff,0x00,0x13,0xfa,0x35,0x00,0x00,0xbd,0x00,0x10,0xfe,0x22,0x04,0x01,0x87,
+0x02,0x12,0x04,0x1e,0x04,0x01,0xc3,0x00,0x13,0x0a,0x0c,0x00,0x00,0x91,0x02,0x12,
+0x1f,0x96,0x02,0x10,0x0b,0xd4,0x01,0x22,0x7f,0xfd,0xbf,0x05,0x00,0xc3,0x00,0x01,
+0x15,0x06,0x00,0xec,0x01,0x10,0xf5,0xc9,0x06,0x03,0x96,0x00,0x31,0xfb,0x00,0x09,
+0x35,0x07,0x01,0x53,0x07,0x21,0x10,0x0e,0xb4,0x02,0x01,0xa9,0x03,0x44,0x70,0x5f,
+0xff,0x20,0x19,0x01,0x20,0xd0,0x0f,0x5b,0x00,0x20,0xed,0xa5,0x3d,0x00,0x00,0x01,
+0x00,0x00,0x1d,0x03,0x20,0x0f,0xff,0x88,0x00,0x30,0xff,0xff,0x40,0x50,0x00,0x00,
+0x21,0x03,0x53,0xfe,0x00,0x0f,0xff,0x50,0xd6,0x03,0x22,0xff,0xf5,0x0b,0x01,0x12,
+0x90,0x13,0x00,0x00,0x86,0x07,0x22,0xff,0xf5,0x95,0x00,0x13,0xa0,0x13,0x00,0x23,
+0xff,0xf7,0x13,0x00,0x31,0xaf,0xff,0x10,0x13,0x00,0x43,0x15,0xcf,0xff,0x50,0x5f,
+0x00,0x10,0xfd,0x5f,0x00,0x04,0x95,0x03,0x83,0xff,0xfd,0xcc,0xcc,0xcd,0xff,0xff,
+0xe4,0x5f,0x00,0x32,0x3c,0xff,0xf2,0x39,0x00,0x00,0x6a,0x07,0x02,0x4c,0x00,0x00,
+0xba,0x00,0x22,0xff,0xf5,0x5a,0x01,0x12,0xf5,0x13,0x00,0x00,0x2d,0x00,0x04,0x13,
+0x00,0x13,0xf4,0x13,0x00,0x32,0x6f,0xff,0x20,0x13,0x00,0x32,0x1e,0xff,0xd0,0x13,
+0x00,0x10,0x5e,0xab,0x00,0x74,0xfe,0xdd,0xdd,0xde,0xff,0xff,0xf9,0x72,0x00,0x13,
+0xf7,0xe4,0x00,0x02,0xa5,0x07,0x51,0x00,0x49,0xdf,0xfe,0xc9,0x4f,0x01,0x10,0x3d,
+0x15,0x00,0x20,0xfb,0x10,0xb2,0x01,0x60,0xff,0xff,0xef,0xff,0xff,0xe2,0x77,0x00,
+0x20,0xf7,0x20,0xf9,0x00,0x51,0x10,0x01,0xff,0xfe,0x20,0xac,0x04,0x22,0x90,0x09,
+0x59,0x01,0x10,0x08,0xae,0x07,0x12,0x80,0x7f,0x00,0x14,0xf6,0x49,0x01,0x42,0xcf,
+0xf9,0x9f,0xfd,0x52,0x01,0x34,0x58,0x86,0xcf,0x3b,0x02,0x04,0x96,0x01,0x00,0xdb,
+0x01,0x06,0x0a,0x00,0x1f,0xf7,0x0a,0x00,0x09,0x06,0x32,0x00,0x06,0x46,0x00,0x04,
+0x5a,0x00,0x53,0x47,0x75,0x5f,0xff,0x10,0x6e,0x00,0x15,0x1f,0x82,0x00,0x33,0x09,
+0xff,0xf1,0x96,0x00,0x41,0x01,0xff,0xfd,0x10,0xfa,0x08,0x61,0x90,0x00,0x5f,0xff,
+0xe6,0x00,0xbe,0x00,0x00,0xd2,0x00,0x21,0xfe,0xdf,0xd2,0x00,0x24,0x00,0x4d,0xe6,
+0x00,0x81,0x00,0x00,0x5a,0xdf,0xfe,0xc8,0x20,0x00,0x17,0x01,0x02,0x03,0x01,0x12,
+0x0f,0x6e,0x02,0x21,0x30,0x00,0xfc,0x01,0x11,0xef,0x2b,0x01,0x01,0x48,0x01,0x43,
+0x27,0xef,0xff,0x80,0x9e,0x01,0x32,0x1c,0xff,0xf4,0x0a,0x00,0x00,0x7e,0x08,0x04,
+0x0a,0x00,0x33,0x2f,0xff,0x50,0x0a,0x00,0x32,0x0a,0xff,0xc0,0x0a,0x00,0x00,0x30,
+0x09,0x03,0x0a,0x00,0x10,0x01,0x4c,0x09,0x12,0x50,0x9a,0x02,0x14,0xf6,0x0a,0x00,
+0x24,0xef,0xf7,0x0a,0x00,0x1e,0xdf,0x0a,0x00,0x07,0x1e,0x00,0x05,0x32,0x00,0x15,
+0x02,0xe7,0x01,0x01,0x2a,0x09,0x12,0x50,0x6d,0x02,0x04,0x6e,0x00,0x33,0x3f,0xff,
+0x60,0x0a,0x00,0x25,0xdf,0xfe,0xaa,0x00,0x12,0xf5,0x0a,0x00,0x21,0x38,0xff,0xbe,
+0x00,0x69,0xed,0xdd,0xef,0xff,0xff,0xf8,0xe6,0x00,0x00,0xfa,0x00,0x16,0xc8,0xfa,
+0x00,0x37,0xff,0xff,0xf1,0x09,0x00,0x02,0xab,0x07,0x14,0xe0,0x89,0x00,0x1f,0x00,
+0x09,0x00,0x2e,0x03,0x7e,0x02,0x07,0x09,0x00,0x6f,0xed,0xdd,0xdd,0xdd,0xdd,0xd5,
+0x5a,0x00,0x2f,0x0e,0x09,0x00,0x01,0x5a,0x00,0x24,0xdd,0xd3,0xcf,0x00,0x1d,0xf3,
+0x09,0x00,0x23,0xd0,0xff,0x8a,0x03,0x04,0xe9,0x00,0x3b,0xb0,0xff,0xf5,0x46,0x00,
+0x0f,0x11,0x00,0x21,0x11,0xfe,0x78,0x00,0x23,0x10,0x0f,0x46,0x01,0x13,0x00,0x66,
+0x00,0x1e,0x10,0x55,0x00,0x0f,0x11,0x00,0x40,0x00,0x01,0x00,0x41,0x59,0xde,0xfe,
+0xda,0x16,0x00,0x12,0x4d,0xc7,0x04,0x00,0x64,0x05,0x31,0xff,0xff,0xee,0xcc,0x02,
+0xa2,0x6f,0xff,0xf7,0x10,0x00,0x17,0xef,0xff,0x50,0x02,0x25,0x03,0x33,0x1d,0xff,
+0xe0,0xcf,0x03,0x10,0x03,0x57,0x04,0x13,0x80,0x73,0x03,0x13,0x4f,0xcf,0x03,0x44,
+0x36,0x65,0x8f,0xfe,0x57,0x00,0x25,0xbf,0xfb,0x93,0x03,0x1e,0xf9,0xa7,0x03,0x01,
+0x0a,0x00,0x51,0x5d,0xdd,0xdd,0xdd,0xdb,0x0a,0x00,0x10,0x6f,0x7a,0x00,0x06,0x0a,
+0x00,0x04,0x32,0x00,0x44,0x7f,0xfe,0xaf,0xfc,0x0a,0x00,0x24,0x7f,0xff,0x0a,0x00,
+0x33,0x3f,0xff,0x50,0x0a,0x00,0x33,0x0e,0xff,0xc0,0x0a,0x00,0x12,0x07,0x86,0x08,
+0x00,0xd7,0x0c,0x31,0xdf,0xff,0x50,0x2d,0x0d,0x30,0xfe,0x00,0x2f,0x0b,0x0a,0x71,
+0x02,0x7e,0xff,0xf9,0x00,0x03,0xef,0xd2,0x00,0x00,0x3c,0x06,0x11,0x1a,0x5f,0x01,
+0x11,0xe6,0xc2,0x08,0x46,0xce,0xff,0xdc,0x84,0x15,0x01,0x54,0x0c,0xff,0xa0,0xff,
+0xf5,0x46,0x04,0x0f,0x15,0x00,0x4d,0x04,0x01,0x00,0x25,0xfa,0x0f,0x0b,0x00,0x13,
+0xa0,0x0c,0x02,0x3f,0xdd,0xff,0xfa,0x93,0x00,0x62,0x05,0x15,0x00,0x2f,0xcf,0xf9,
+0x02,0x00,0x1f,0x23,0x00,0x00,0x69,0x04,0x0f,0x09,0x00,0x86,0x34,0x08,0x88,0x20,
+0x0b,0x05,0x11,0x60,0x49,0x08,0x41,0xf0,0x0d,0xff,0xa0,0xfb,0x00,0x41,0xc0,0x08,
+0xff,0xf3,0x33,0x07,0x20,0x70,0x01,0x91,0x0e,0x30,0x18,0xff,0xfe,0x88,0x02,0x00,
+0x31,0x02,0x13,0xf4,0xd9,0x0b,0xc0,0xfe,0x30,0x00,0x00,0x00,0x17,0xbe,0xff,0xea,
+0x60,0x00,0x00,0xd0,0x0f,0xff,0x50,0x00,0x00,0x00,0x00,0x0b,0xff,0xf5,0x00,0xff,
+0xf5,0x0a,0x00,0x42,0x09,0xff,0xf7,0x00,0x15,0x00,0x42,0x07,0xff,0xf9,0x00,0x15,
+0x00,0x42,0x06,0xff,0xfb,0x00,0x15,0x00,0x42,0x04,0xff,0xfc,0x00,0x15,0x00,0x42,
+0x03,0xff,0xfe,0x10,0x15,0x00,0x42,0x02,0xef,0xfe,0x20,0x15,0x00,0x52,0x01,0xdf,
+0xff,0x30,0x00,0x15,0x00,0x11,0xcf,0x58,0x00,0x00,0x15,0x00,0x42,0xaf,0xff,0x70,
+0x00,0x15,0x00,0x42,0x9f,0xff,0x90,0x00,0x15,0x00,0x42,0x7f,0xff,0xe0,0x00,0x15,
+0x00,0x42,0xaf,0xff,0xff,0x70,0x15,0x00,0x00,0x01,0x00,0x12,0x30,0x15,0x00,0x52,
+0xff,0xc2,0xef,0xfe,0x10,0x15,0x00,0x42,0xd1,0x04,0xff,0xfb,0x15,0x00,0x63,0xe1,
+0x00,0x08,0xff,0xf7,0x00,0x7e,0x00,0x43,0x0c,0xff,0xf3,0x00,0x93,0x00,0x43,0x2e,
+0xff,0xe1,0x00,0xa8,0x00,0x43,0x5f,0xff,0xb0,0x00,0xbd,0x00,0x10,0x9f,0x57,0x00,
+0x02,0xd2,0x00,0x33,0xcf,0xff,0x30,0x15,0x00,0x10,0x02,0xb4,0x00,0x02,0x15,0x00,
+0x33,0x05,0xff,0xfb,0x15,0x00,0x01,0xf2,0x00,0x02,0x15,0x00,0x00,0x57,0x00,0x03,
+0x15,0x00,0x14,0x00,0x13,0x00,0x1f,0x00,0x11,0x00,0xa1,0x20,0xfe,0xdd,0x01,0x00,
+0x32,0xd6,0x0f,0xff,0x01,0x00,0x13,0x80,0x08,0x00,0x41,0xf8,0x0f,0xff,0xf8,0x22,
+0x00,0x00,0x0b,0x01,0x53,0xff,0x70,0xff,0xff,0xe0,0x0e,0x00,0x54,0x8f,0xff,0xf7,
+0x0f,0xff,0x3e,0x00,0x11,0x0e,0x1b,0x00,0x01,0x76,0x01,0x00,0x28,0x01,0x01,0x1b,
+0x00,0x12,0xf1,0x0e,0x00,0x10,0xbf,0x1b,0x00,0x13,0xfd,0xb2,0x01,0x81,0x1f,0xff,
+0xcf,0xf7,0x0f,0xff,0x7f,0xfe,0x0d,0x00,0x91,0x08,0xff,0xca,0xff,0x70,0xff,0xf2,
+0xff,0xf4,0x0e,0x00,0x90,0xef,0xf5,0xbf,0xf7,0x0f,0xff,0x19,0xff,0xa0,0x0d,0x00,
+0x30,0x4f,0xfe,0x0b,0x1b,0x00,0x20,0x3f,0xff,0xd3,0x01,0x30,0x0a,0xff,0x90,0x1b,
+0x00,0x20,0x20,0xcf,0xcb,0x01,0xf0,0x02,0x01,0xff,0xf2,0x0c,0xff,0x70,0xff,0xf3,
+0x06,0xff,0xd0,0x00,0x00,0x00,0x7f,0xfc,0x00,0x51,0x00,0xf0,0x02,0x30,0x0f,0xff,
+0x40,0x00,0x00,0x0d,0xff,0x60,0x0d,0xff,0x70,0xff,0xf4,0x00,0x9f,0xfa,0x76,0x02,
+0x80,0xe0,0x00,0xdf,0xf7,0x0f,0xff,0x40,0x03,0x89,0x00,0xf0,0x04,0xaf,0xf9,0x00,
+0x0e,0xff,0x70,0xff,0xf5,0x00,0x0c,0xff,0x70,0x00,0x1f,0xff,0x20,0x00,0xef,0xf7,
+0xfa,0x00,0x81,0x6f,0xfd,0x00,0x07,0xff,0xc0,0x00,0x0f,0x1b,0x00,0x91,0x00,0xff,
+0xf3,0x00,0xdf,0xf6,0x00,0x00,0xff,0x1b,0x00,0x64,0x09,0xff,0xa0,0x3f,0xff,0x00,
+0x1b,0x00,0x54,0x3f,0xff,0x09,0xff,0x90,0x1b,0x00,0x55,0x00,0xcf,0xf7,0xff,0xf2,
+0x1b,0x00,0x22,0x06,0xff,0xe0,0x02,0x01,0x1b,0x00,0x00,0x89,0x02,0x14,0x60,0x1b,
+0x00,0x00,0x52,0x02,0x16,0xf0,0x1b,0x00,0x10,0x03,0x1c,0x03,0x05,0x1b,0x00,0x33,
+0x0c,0xff,0x20,0x1b,0x00,0x22,0xa0,0x00,0x4e,0x03,0x14,0xa0,0x4e,0x01,0x31,0xbf,
+0xfa,0x0f,0x29,0x03,0x03,0x15,0x00,0x15,0xf9,0x15,0x00,0x25,0xff,0xf4,0x15,0x00,
+0x24,0xff,0xd0,0x15,0x00,0x33,0xaf,0xff,0x80,0x15,0x00,0x43,0xf5,0xaf,0xff,0x30,
+0x15,0x00,0x34,0x51,0xef,0xfc,0x15,0x00,0x33,0x05,0xff,0xf7,0x15,0x00,0x43,0x50,
+0x0b,0xff,0xf2,0x15,0x00,0x43,0x00,0x2f,0xff,0xb0,0x15,0x00,0x43,0x00,0x7f,0xff,
+0x60,0x15,0x00,0x43,0x00,0xcf,0xfe,0x10,0x15,0x00,0x34,0x02,0xff,0xfa,0x15,0x00,
+0x32,0x08,0xff,0xf4,0x15,0x00,0x00,0x62,0x01,0x12,0xe0,0x15,0x00,0x00,0x12,0x01,
+0x34,0x90,0xbf,0xfa,0x38,0x03,0x13,0x3b,0x15,0x00,0x34,0x00,0xef,0xfd,0x15,0x00,
+0x34,0x04,0xff,0xff,0x15,0x00,0x43,0x0a,0xff,0xff,0xfa,0x68,0x02,0x15,0x1e,0x15,
+0x00,0x25,0x00,0x5f,0x15,0x00,0x25,0x00,0xbf,0x15,0x00,0xb1,0x01,0xff,0xfa,0x00,
+0x00,0x00,0x49,0xdf,0xfe,0xc8,0x20,0x72,0x02,0x10,0xcf,0x83,0x02,0x12,0xa1,0x54,
+0x02,0x00,0x01,0x00,0x10,0xe2,0x47,0x01,0x50,0xff,0xa4,0x10,0x15,0xbf,0xc2,0x03,
+0x11,0xef,0xf0,0x00,0x50,0x6f,0xff,0xb0,0x00,0x7f,0x00,0x02,0x10,0x00,0x07,0x00,
+0x13,0x0e,0x50,0x01,0x31,0xdf,0xfa,0x04,0xf0,0x03,0x00,0x94,0x04,0x32,0xf0,0x8f,
+0xfd,0x8c,0x02,0x33,0x2f,0xff,0x4b,0x1f,0x00,0x63,0x00,0xef,0xf7,0xdf,0xf8,0x00,
+0xc1,0x03,0x33,0x9e,0xff,0x70,0xac,0x02,0x43,0xf9,0xef,0xf7,0x00,0x8f,0x01,0x15,
+0xae,0x15,0x00,0x16,0xfa,0x15,0x00,0x11,0x9d,0x6d,0x01,0x00,0x21,0x04,0x34,0xf9,
+0xbf,0xfa,0xfb,0x02,0x33,0x78,0xff,0xe0,0xbd,0x00,0x21,0xf4,0x4f,0x8f,0x04,0x00,
+0x94,0x00,0x22,0x00,0xef,0x20,0x00,0x30,0x0d,0xff,0xb0,0x41,0x01,0x01,0x12,0x05,
+0x53,0xf4,0x00,0x0e,0xff,0xf3,0x49,0x04,0x71,0x00,0x4f,0xff,0xf9,0x30,0x00,0x4a,
+0xe9,0x01,0x11,0x5f,0xdc,0x00,0x10,0xfe,0x3b,0x00,0x10,0x2c,0x0a,0x00,0x11,0xfb,
+0xfd,0x01,0x51,0x04,0x9d,0xff,0xec,0x83,0xdc,0x04,0x00,0x1d,0x00,0x43,0xd9,0x40,
+0x00,0x00,0x9c,0x03,0x10,0xfd,0x9c,0x04,0x40,0xfe,0xee,0xee,0xef,0x11,0x02,0x02,
+0x44,0x01,0x43,0x29,0xff,0xff,0x20,0x4e,0x01,0x35,0x4f,0xff,0xa0,0xa5,0x04,0x13,
+0xf0,0x0a,0x00,0x16,0x03,0xa4,0x04,0x2d,0xff,0xf5,0x0a,0x00,0x06,0x1e,0x00,0x3b,
+0x08,0xff,0xf0,0x46,0x00,0x21,0x01,0x49,0x5a,0x00,0x02,0x01,0x00,0x14,0xf5,0x82,
+0x00,0x10,0xfc,0x82,0x00,0x67,0xed,0xdd,0xdd,0xdc,0xb7,0x30,0x43,0x04,0x0f,0x0a,
+0x00,0x48,0x00,0x35,0x01,0x51,0xad,0xff,0xec,0x72,0x00,0x19,0x01,0x10,0xdf,0x84,
+0x00,0x12,0x90,0xf1,0x01,0x01,0x11,0x01,0x11,0x10,0x87,0x03,0x60,0x93,0x10,0x26,
+0xcf,0xff,0xd0,0xe6,0x01,0x10,0xe2,0xcc,0x00,0x00,0x39,0x03,0x11,0xaf,0x66,0x03,
+0x00,0x07,0x00,0x33,0x01,0xff,0xf7,0x82,0x04,0x23,0x80,0x06,0x9b,0x04,0x40,0x09,
+0xff,0xe0,0x0a,0x07,0x03,0x01,0xae,0x02,0x44,0xf2,0x0d,0xff,0x80,0xc6,0x01,0x33,
+0x0f,0xff,0x60,0x15,0x05,0x15,0xf6,0x83,0x00,0x31,0xef,0xf7,0x1f,0x64,0x02,0x00,
+0x5b,0x02,0x17,0xf8,0x0b,0x00,0x07,0x21,0x00,0x07,0x37,0x00,0x16,0x0e,0x4d,0x00,
+0x16,0x0b,0x63,0x00,0x16,0x07,0x79,0x00,0x04,0x8f,0x00,0x00,0x29,0x00,0x03,0xa5,
+0x00,0x71,0x9f,0xff,0x20,0x00,0x2f,0xff,0xd2,0xb2,0x02,0x11,0xf8,0xd1,0x00,0x65,
+0x82,0x00,0x15,0xcf,0xff,0xc0,0xe7,0x00,0x25,0xfc,0x10,0xfd,0x00,0x15,0xf7,0x13,
+0x01,0x03,0x09,0x01,0x00,0x01,0x00,0x12,0x3e,0x22,0x00,0x01,0x78,0x00,0x34,0xcf,
+0xff,0xe3,0x17,0x00,0x35,0x0a,0xff,0xd1,0x45,0x01,0x26,0x7d,0x10,0x51,0x01,0x02,
+0xcd,0x01,0x35,0xed,0xa6,0x00,0x59,0x02,0x10,0xf7,0x0a,0x00,0x31,0xee,0xee,0xee,
+0x5e,0x01,0x02,0xff,0x01,0x34,0x7f,0xff,0xf5,0x09,0x07,0x24,0xef,0xfd,0x91,0x01,
+0x15,0x6f,0x6d,0x02,0x33,0x1f,0xff,0x50,0x0a,0x00,0x3d,0x0f,0xff,0x60,0x14,0x00,
+0x05,0x28,0x00,0x35,0x02,0xef,0xfc,0x50,0x00,0x12,0xf3,0x3b,0x02,0x10,0xef,0xee,
+0x04,0x03,0x78,0x00,0x14,0xc3,0x82,0x00,0x14,0xfb,0xf5,0x01,0x10,0x6f,0x13,0x01,
+0x03,0x73,0x04,0x13,0xa0,0x0a,0x00,0x34,0x06,0xff,0xf2,0x13,0x02,0x24,0xdf,0xfb,
+0x0a,0x00,0x14,0x5f,0xa9,0x07,0x00,0x69,0x03,0x03,0x0a,0x00,0x34,0x05,0xff,0xf3,
+0xaa,0x00,0x15,0xdf,0xb2,0x07,0x10,0x5f,0x25,0x06,0x12,0x50,0x92,0x03,0x13,0xc0,
+0x0a,0x00,0x10,0x05,0x99,0x03,0x50,0x02,0x8b,0xef,0xfe,0xb6,0x0e,0x00,0x11,0x19,
+0x68,0x03,0xf3,0x09,0x60,0x00,0x00,0x1d,0xff,0xff,0xfe,0xef,0xff,0xff,0xa0,0x00,
+0x0c,0xff,0xfa,0x30,0x00,0x04,0xcf,0xff,0x80,0x04,0xff,0xf7,0xa2,0x01,0x22,0x9f,
+0xfe,0xed,0x01,0x42,0xf9,0x0b,0xff,0xa0,0xcb,0x01,0x22,0xd0,0xbf,0xf7,0x06,0x33,
+0x5b,0xba,0x08,0xf3,0x06,0x00,0x82,0x02,0x15,0xc1,0x26,0x07,0x24,0xf8,0x20,0x0a,
+0x00,0x22,0xff,0xc7,0x1d,0x04,0x61,0x3c,0xff,0xff,0xff,0xd7,0x10,0x7a,0x03,0x10,
+0xaf,0x6a,0x07,0x02,0x1f,0x02,0x24,0x9e,0xff,0x35,0x00,0x12,0x05,0xf5,0x01,0x02,
+0x35,0x00,0x04,0x02,0x03,0x43,0xcf,0xfc,0x6b,0xb9,0xcf,0x04,0x33,0xe7,0xff,0xf0,
+0x65,0x04,0x32,0x3f,0xff,0x50,0xe2,0x01,0x41,0xd0,0xcf,0xfe,0x30,0x64,0x02,0xf0,
+0x02,0xf9,0x02,0xff,0xff,0x93,0x00,0x00,0x28,0xff,0xff,0x20,0x04,0xef,0xff,0xff,
+0xed,0xff,0x67,0x01,0x23,0x01,0xaf,0x37,0x04,0x70,0x00,0x00,0x16,0xbd,0xff,0xec,
+0x94,0xa1,0x00,0x04,0x01,0x00,0x15,0xa2,0x0a,0x00,0x60,0xfa,0x1e,0xee,0xee,0xee,
+0xef,0x00,0x02,0x21,0xee,0x90,0xe4,0x00,0x14,0xf6,0x29,0x02,0x14,0x0e,0xd9,0x02,
+0x0f,0x15,0x00,0xc7,0x32,0x8f,0xfc,0x00,0xa4,0x05,0x33,0xf8,0xff,0xc0,0x5d,0x01,
+0x0f,0x13,0x00,0x7d,0x13,0xd0,0x13,0x00,0x05,0x3e,0x09,0x13,0xe4,0x70,0x02,0x52,
+0xbf,0xfb,0x0f,0xff,0x80,0x77,0x02,0x41,0x70,0xaf,0xff,0x40,0xd3,0x06,0xa0,0xf1,
+0x01,0xef,0xff,0x82,0x00,0x00,0x5d,0xff,0xf6,0x31,0x07,0x54,0xfe,0xde,0xff,0xff,
+0xf8,0x4f,0x07,0x10,0xe6,0x2b,0x00,0x50,0x39,0xce,0xff,0xdb,0x60,0x16,0x03,0x23,
+0x50,0x00,0x57,0x00,0x34,0x40,0xef,0xfa,0x10,0x07,0x43,0xe0,0x09,0xff,0xf0,0xbf,
+0x04,0x23,0xf8,0x00,0x64,0x02,0x01,0x93,0x03,0x23,0xdf,0xfa,0x22,0x00,0x32,0xc0,
+0x00,0x07,0x23,0x00,0x01,0xc8,0x04,0x13,0x2f,0xef,0x03,0x00,0xae,0x09,0x22,0xcf,
+0xfa,0x22,0x00,0x10,0xb0,0xb5,0x00,0x11,0xf0,0x22,0x00,0x12,0xf5,0x15,0x04,0x01,
+0xc8,0x04,0x01,0x8e,0x05,0x11,0xfa,0x22,0x00,0x11,0x90,0x82,0x03,0x11,0xf0,0x25,
+0x05,0x01,0x94,0x01,0x00,0x23,0x00,0x03,0xdd,0x00,0x20,0x9f,0xfa,0x22,0x00,0x12,
+0x80,0x9e,0x06,0x10,0xf0,0xf5,0x09,0x03,0x4d,0x07,0x10,0x50,0xf3,0x09,0x11,0x00,
+0xfb,0x05,0x53,0xfa,0x00,0x0c,0xff,0x60,0x99,0x0a,0x44,0xf0,0x01,0xff,0xf1,0xbe,
+0x00,0x43,0x50,0x7f,0xfb,0x00,0xd5,0x00,0x23,0xfa,0x0c,0xe0,0x00,0x00,0x42,0x00,
+0x25,0xff,0xe0,0x11,0x05,0x24,0xcf,0xf9,0xfe,0x01,0x13,0x4f,0x41,0x0c,0x01,0x0a,
+0x02,0x03,0x63,0x01,0x01,0xd7,0x03,0x04,0xf5,0x0a,0x00,0xea,0x08,0x12,0x20,0xf2,
+0x07,0x02,0x89,0x01,0x12,0xb0,0x4e,0x04,0x32,0x09,0xff,0xc0,0x5a,0x06,0x02,0x8c,
+0x01,0x32,0xc0,0x5f,0xff,0xc4,0x00,0x12,0xf4,0x2c,0x00,0x11,0x01,0xe9,0x07,0x11,
+0x03,0xde,0x03,0x00,0x83,0x04,0x31,0x0d,0xff,0x70,0x00,0x01,0x00,0x89,0x08,0x00,
+0x92,0x0a,0x21,0x9f,0xfb,0xac,0x00,0x20,0xdf,0xf1,0x16,0x00,0x50,0xfd,0x00,0x06,
+0xff,0xe0,0xa4,0x00,0x31,0xe8,0xff,0x60,0xef,0x0a,0x20,0x00,0x2f,0x74,0x00,0x43,
+0x5f,0xfa,0x4f,0xfa,0xa1,0x02,0x20,0xef,0xf6,0x94,0x00,0x10,0x60,0x26,0x00,0x00,
+0xbe,0x0a,0x10,0x0a,0x3d,0x01,0xa0,0xef,0xf1,0x0b,0xff,0x30,0x00,0x05,0xff,0xe0,
+0x00,0xc8,0x0a,0x62,0x00,0x2f,0xfc,0x00,0x6f,0xf7,0x3a,0x01,0xa2,0x02,0xff,0xf1,
+0x00,0x07,0xff,0x80,0x02,0xff,0xb0,0x23,0x01,0x00,0x1e,0x0b,0x50,0xbf,0xf3,0x00,
+0x0e,0xff,0xe4,0x0a,0x00,0x31,0x02,0xb1,0xf8,0x00,0x0f,0xfe,0x00,0x00,0x9f,0xf4,
+0x00,0x3f,0xff,0x52,0x04,0x90,0xb0,0x04,0xff,0xa0,0x00,0x05,0xff,0x80,0x07,0xde,
+0x00,0x00,0x15,0x00,0x82,0x9f,0xf5,0x00,0x00,0x0f,0xfd,0x00,0xbf,0x3d,0x0d,0x21,
+0xf2,0x0d,0xda,0x01,0x41,0xf1,0x0e,0xff,0x30,0xb6,0x00,0x30,0x61,0xff,0xc0,0x36,
+0x00,0x12,0x52,0x03,0x02,0x40,0x8f,0xf9,0x6f,0xf8,0x36,0x00,0x32,0xfa,0x5f,0xfc,
+0xe8,0x06,0x11,0xb9,0x27,0x00,0x22,0xef,0xd7,0xc0,0x01,0x41,0x0f,0xfe,0xdf,0xe0,
+0x75,0x01,0x22,0xbf,0xf4,0xc9,0x04,0x01,0xe3,0x09,0x00,0xf4,0x08,0x03,0x6a,0x01,
+0x21,0xff,0x50,0xa0,0x01,0x23,0xff,0xc0,0x17,0x0a,0x12,0xf1,0xc7,0x01,0x13,0xf9,
+0xb8,0x01,0x19,0xfc,0x09,0x05,0x01,0x48,0x01,0x00,0x65,0x00,0x01,0x39,0x01,0x03,
+0xa3,0x09,0x41,0xdf,0xff,0x20,0xdf,0x2a,0x0c,0x00,0x12,0x00,0x32,0x03,0xff,0xfa,
+0x86,0x06,0x51,0xd0,0x00,0x09,0xff,0xf4,0x7a,0x00,0x10,0xf3,0x79,0x0a,0x11,0xd0,
+0x1f,0x05,0x00,0x62,0x00,0x00,0x98,0x00,0x31,0xdf,0xfe,0x10,0x79,0x0a,0x33,0x20,
+0x00,0x7f,0xe7,0x0d,0x52,0xfb,0x00,0x1f,0xff,0xb0,0x61,0x05,0x25,0xf5,0x0b,0x70,
+0x02,0x34,0xe5,0xff,0xf7,0x06,0x02,0x01,0xbc,0x01,0x02,0x07,0x06,0x05,0x34,0x02,
+0x15,0xef,0x7e,0x07,0x13,0x2f,0xfe,0x0c,0x00,0x26,0x0a,0x04,0x5d,0x0d,0x00,0xb5,
+0x0a,0x12,0xe1,0xc7,0x00,0x53,0xef,0xfe,0x5f,0xff,0x90,0x3e,0x00,0x12,0x40,0xa5,
+0x03,0x00,0x64,0x09,0x32,0x01,0xff,0xfd,0x68,0x00,0x10,0xf1,0xe3,0x03,0x01,0x4a,
+0x02,0x10,0xf6,0xfd,0x00,0x10,0xf2,0x92,0x00,0x11,0xfc,0x77,0x00,0x12,0xc0,0x8e,
+0x0e,0x00,0x03,0x01,0x52,0x60,0x00,0x6f,0xff,0x80,0x77,0x00,0x42,0x10,0x1f,0xff,
+0xe0,0x63,0x00,0xc0,0xfa,0x0a,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xf4,
+0x40,0x7f,0xff,0x50,0x00,0x01,0x00,0x61,0x0c,0xff,0xf1,0x0e,0xff,0xd0,0x0b,0x00,
+0x61,0x4f,0xff,0x70,0x06,0xff,0xf6,0x0b,0x00,0x60,0xcf,0xfe,0x00,0x00,0xdf,0xfd,
+0x0a,0x00,0x30,0x04,0xff,0xf6,0x1a,0x00,0x11,0x60,0x2b,0x00,0x13,0xd0,0x05,0x00,
+0x71,0x00,0x5f,0xff,0x40,0x00,0x00,0x03,0x2d,0x00,0x20,0xcf,0xfc,0x27,0x00,0x70,
+0xaf,0xfd,0x00,0x00,0x05,0xff,0xf3,0x0b,0x00,0x70,0x2f,0xff,0x60,0x00,0x0d,0xff,
+0xa0,0x0b,0x00,0x70,0x09,0xff,0xd0,0x00,0x5f,0xff,0x20,0x0b,0x00,0x71,0x01,0xff,
+0xf6,0x00,0xdf,0xf9,0x00,0x01,0x00,0x52,0x8f,0xfd,0x05,0xff,0xf1,0x0b,0x00,0x52,
+0x0e,0xff,0x6d,0xff,0x80,0x0b,0x00,0x53,0x06,0xff,0xff,0xfe,0x00,0x01,0x00,0x34,
+0xdf,0xff,0xf7,0x0b,0x00,0x13,0x5f,0x9e,0x00,0x01,0x2d,0x00,0x1f,0x70,0x0b,0x00,
+0x54,0x23,0x4f,0xff,0x01,0x00,0x16,0x90,0x0a,0x00,0x21,0x3e,0xee,0x01,0x00,0x34,
+0xef,0xff,0x80,0xa5,0x00,0x04,0xaf,0x00,0x53,0x09,0xff,0xf4,0x00,0x00,0x43,0x01,
+0x13,0x90,0x0a,0x00,0x25,0xef,0xfd,0x1d,0x00,0x15,0xf3,0x1d,0x00,0x03,0x3a,0x00,
+0x15,0x01,0x1d,0x00,0x35,0x0a,0xff,0xf2,0xe7,0x00,0x14,0x70,0x1d,0x00,0x13,0xfc,
+0x13,0x00,0x15,0x0b,0x1d,0x00,0x32,0x6f,0xff,0x60,0x09,0x00,0x54,0x02,0xff,0xfb,
+0x00,0x00,0xb8,0x01,0x03,0x0a,0x00,0x03,0xca,0x01,0x00,0x1d,0x00,0x15,0xfa,0x1d,
+0x00,0x23,0xe1,0x00,0x6b,0x01,0x04,0x1d,0x00,0x15,0x03,0x1d,0x00,0x35,0x0d,0xff,
+0xe0,0x57,0x00,0x21,0xed,0xdd,0x01,0x00,0x24,0xd1,0x7f,0xe6,0x00,0x16,0xf2,0x0a,
+0x00,0x81,0x5c,0xcc,0xcc,0xc2,0x7f,0xff,0xff,0xf3,0x04,0x00,0x3f,0xfd,0x00,0x00,
+0x04,0x00,0x62,0x16,0xff,0x84,0x00,0x22,0x1f,0xff,0xb6,0x00,0x21,0xbf,0xf5,0x07,
+0x00,0x31,0x05,0xff,0xb0,0x08,0x00,0x31,0x0f,0xff,0x10,0x08,0x00,0x23,0x9f,0xf7,
+0xe8,0x00,0x13,0xd0,0xe6,0x00,0x12,0x30,0x1e,0x01,0x22,0xf9,0x00,0x7f,0x02,0x13,
+0xf0,0x54,0x01,0x12,0x50,0x6f,0x01,0x03,0x48,0x01,0x03,0x46,0x01,0x13,0x09,0x7e,
+0x01,0x23,0x3f,0xfd,0xdb,0x01,0x02,0xb4,0x01,0x13,0x07,0xcf,0x01,0x0f,0x7b,0x00,
+0x49,0xff,0x04,0x05,0x88,0x30,0xac,0xcc,0xcc,0x9d,0xff,0xff,0xfc,0xdf,0xff,0xff,
+0xc0,0x00,0x7f,0xfc,0x00,0x07,0x07,0x00,0x50,0x30,0xca,0xcc,0xdf,0x70,0x00,0x82,
+0xcd,0xff,0xff,0xfc,0x00,0x00,0x0d,0xfc,0xbf,0x00,0x11,0xf3,0xca,0x03,0x21,0xff,
+0x90,0xf2,0x00,0x11,0xff,0x00,0x01,0x20,0xcf,0xf6,0x0e,0x01,0x10,0xf2,0xda,0x00,
+0xf0,0x11,0x4f,0xfa,0x0a,0xff,0x30,0x00,0x0a,0xff,0x40,0x4f,0xfa,0x00,0x01,0xff,
+0xd0,0x00,0xef,0xf1,0x00,0x7f,0xf7,0x00,0x08,0xff,0x70,0x0d,0xff,0x10,0x00,0x2f,
+0xfd,0x04,0x15,0x01,0x40,0xbf,0xf4,0xaf,0xf5,0x20,0x01,0x32,0xa0,0xab,0xbb,0x01,
+0x00,0x14,0x2e,0x4e,0x02,0x13,0xef,0x09,0x00,0xa0,0x20,0x68,0x87,0x00,0x00,0x3f,
+0xff,0x80,0x00,0x05,0xde,0x02,0x50,0x8f,0xfc,0x00,0x00,0x0b,0xdd,0x02,0xd0,0xdf,
+0xe1,0x00,0x00,0x06,0xbd,0xff,0xda,0x40,0x00,0x00,0x00,0x4e,0x28,0x00,0x10,0xb0,
+0x13,0x03,0x20,0xfd,0xbd,0x09,0x00,0x91,0x2f,0xff,0xb2,0x00,0x01,0x9f,0xff,0x50,
+0x08,0x60,0x01,0x51,0xbf,0xfa,0x00,0x58,0x85,0x2f,0x04,0x14,0xd0,0x3a,0x03,0x00,
+0x06,0x00,0x30,0x35,0x56,0x69,0x68,0x01,0x11,0x6c,0x65,0x00,0x31,0x00,0x02,0xdf,
+0x08,0x00,0x60,0xf0,0x00,0xef,0xff,0x84,0x10,0x22,0x00,0x30,0x8f,0xfe,0x10,0x98,
+0x00,0x42,0xf0,0x0d,0xff,0x60,0x33,0x00,0x00,0xed,0x00,0x00,0x11,0x00,0x30,0x0f,
+0xff,0x40,0xc2,0x01,0x41,0xff,0x00,0xef,0xfa,0x12,0x03,0xb0,0xf0,0x09,0xff,0xfa,
+0x20,0x03,0xaf,0xff,0xff,0x00,0x1e,0x42,0x00,0xf2,0x07,0xfe,0xff,0xf2,0x00,0x2d,
+0xff,0xff,0xff,0xfa,0x2f,0xff,0x50,0x00,0x07,0xcf,0xfe,0xa3,0x00,0x9a,0xa5,0x7e,
+0xea,0x79,0x00,0x33,0x08,0xff,0xb0,0x65,0x03,0x1f,0xfb,0x11,0x00,0x20,0x90,0x01,
+0x8c,0xef,0xd9,0x20,0x00,0x08,0xff,0xb4,0x1a,0x01,0xf0,0x07,0x70,0x00,0x8f,0xfe,
+0xff,0xff,0xef,0xff,0xff,0x60,0x08,0xff,0xff,0xb3,0x00,0x05,0xef,0xff,0x10,0x8f,
+0xff,0xa0,0x94,0x01,0x41,0xf9,0x08,0xff,0xe0,0x39,0x00,0x32,0xe0,0x8f,0xfb,0x5e,
+0x05,0x12,0x38,0x44,0x00,0x42,0xef,0xf6,0x8f,0xfb,0xec,0x03,0x12,0x78,0x11,0x00,
+0x42,0xbf,0xf8,0x8f,0xfb,0x68,0x02,0x12,0x88,0x11,0x00,0x42,0xcf,0xf7,0x8f,0xfb,
+0xd4,0x04,0x31,0x68,0xff,0xb0,0x20,0x04,0x31,0xf3,0x8f,0xfe,0x7d,0x00,0x21,0xfe,
+0x08,0x0e,0x04,0xf0,0x0c,0x3f,0xff,0x90,0x8f,0xff,0xfb,0x30,0x00,0x5e,0xff,0xf1,
+0x08,0xff,0xdf,0xff,0xfd,0xff,0xff,0xf6,0x00,0x8f,0xf8,0x5f,0xff,0xff,0xff,0xf6,
+0xd8,0x01,0x41,0x18,0xdf,0xfd,0x92,0x03,0x06,0x12,0xad,0x98,0x01,0x10,0x0b,0x11,
+0x01,0xe0,0xb1,0x00,0x00,0x1d,0xff,0xff,0xdc,0xff,0xff,0xd0,0x00,0x0a,0xff,0xf7,
+0xa2,0x03,0x41,0x90,0x04,0xff,0xf5,0x3b,0x01,0x31,0x20,0xbf,0xfb,0x77,0x00,0x12,
+0xf6,0x54,0x01,0x58,0x08,0xff,0x93,0xff,0xf1,0xa3,0x01,0x00,0x70,0x01,0x13,0xe0,
+0x11,0x00,0x03,0x3b,0x05,0x14,0x04,0x11,0x00,0x13,0x3f,0x4b,0x03,0x12,0x00,0x4b,
+0x05,0x51,0x37,0x74,0x0b,0xff,0xa0,0x20,0x05,0x22,0x70,0x4f,0x6b,0x06,0xf0,0x00,
+0xf2,0x00,0xbf,0xff,0x60,0x00,0x06,0xff,0xf9,0x00,0x01,0xdf,0xff,0xfc,0xce,0xb7,
+0x02,0x51,0x01,0xbf,0xff,0xff,0xff,0x64,0x03,0x44,0x49,0xdf,0xfd,0x93,0xc2,0x05,
+0x3f,0x07,0xee,0xa0,0x96,0x01,0x28,0x60,0x00,0x00,0x07,0xce,0xfd,0x93,0x11,0x00,
+0x00,0xf6,0x01,0x00,0x52,0x01,0xf1,0x04,0x2e,0xff,0xff,0xee,0xff,0xfe,0xff,0xb0,
+0x0c,0xff,0xf9,0x10,0x01,0x8f,0xff,0xfb,0x04,0xff,0xf7,0xd2,0x00,0x22,0xb0,0xaf,
+0xf9,0x06,0x41,0xfb,0x0f,0xff,0x60,0x44,0x00,0x32,0xb2,0xff,0xf2,0x44,0x00,0x22,
+0x3f,0xff,0x55,0x00,0x32,0xb4,0xff,0xf0,0x11,0x00,0x13,0x4f,0x11,0x00,0x14,0xb3,
+0x11,0x00,0x32,0x2f,0xff,0x20,0x77,0x00,0x22,0xef,0xf6,0x11,0x00,0x31,0x0a,0xff,
+0xc0,0xee,0x00,0x11,0xb0,0x6a,0x07,0xf2,0x05,0x05,0xff,0xfb,0x00,0xbf,0xff,0x81,
+0x00,0x18,0xff,0xff,0xb0,0x01,0xef,0xff,0xfe,0xef,0xff,0xef,0xfb,0xd3,0x02,0x10,
+0x96,0xaa,0x00,0xd1,0x7c,0xef,0xda,0x30,0x4f,0xfb,0x00,0x00,0x02,0x9d,0xff,0xd9,
+0x30,0x48,0x00,0x20,0xff,0xff,0x2e,0x01,0x11,0x0a,0xd0,0x03,0x50,0xb0,0x00,0x07,
+0xff,0xf7,0xf9,0x05,0x41,0x60,0x01,0xff,0xf5,0xed,0x01,0x03,0xe8,0x00,0x51,0xef,
+0xf4,0x0e,0xff,0x50,0x66,0x00,0x12,0x72,0x98,0x01,0x24,0x8f,0xfa,0xdd,0x06,0x13,
+0xb5,0x08,0x00,0x41,0xfc,0x5f,0xff,0xcc,0x01,0x00,0x3c,0x94,0xff,0xf0,0x98,0x01,
+0x14,0xf6,0x95,0x06,0x01,0x77,0x03,0x13,0x20,0xeb,0x06,0xf0,0x02,0x4f,0xa0,0x00,
+0xaf,0xff,0xa2,0x00,0x01,0x8f,0xff,0x40,0x00,0xcf,0xff,0xfd,0xcd,0xff,0x49,0x05,
+0x10,0x9f,0x4c,0x00,0x00,0x6b,0x00,0x50,0x28,0xde,0xfe,0xc7,0x10,0x03,0x05,0xa0,
+0x8c,0xff,0xe6,0x00,0x00,0x3e,0xff,0xff,0xf7,0x00,0xd0,0x00,0x51,0xe6,0x00,0x07,
+0xff,0xf8,0xbb,0x02,0x11,0xb0,0x9f,0x02,0x00,0x40,0x01,0x02,0x9c,0x00,0x10,0x0f,
+0x06,0x00,0x01,0x8b,0x00,0x12,0x60,0x06,0x00,0x62,0x99,0x9f,0xff,0xb9,0x99,0x30,
+0x18,0x00,0x0f,0x06,0x00,0x4e,0x00,0xfc,0x01,0x60,0xa3,0x04,0xff,0xc0,0x00,0x3d,
+0x59,0x02,0x22,0x5f,0xfc,0xfc,0x01,0x33,0xfd,0xff,0xc0,0xfc,0x01,0x14,0xfc,0xfc,
+0x01,0x31,0xc0,0xaf,0xfd,0xfc,0x01,0x41,0xfc,0x0f,0xff,0x70,0x81,0x01,0x12,0xc2,
+0x3c,0x05,0x24,0x8f,0xfc,0xfc,0x01,0x13,0xc4,0xeb,0x01,0x14,0xfc,0xfc,0x01,0x14,
+0xc3,0x11,0x00,0x13,0x1f,0xfc,0x01,0x13,0xc0,0xfc,0x01,0x14,0xfc,0xfc,0x01,0x40,
+0xc0,0x4f,0xff,0x70,0xfc,0x01,0x14,0xfc,0xfc,0x01,0x21,0xc0,0x02,0xfc,0x01,0x22,
+0xff,0xfc,0xfc,0x01,0x32,0x98,0xff,0xc0,0xfc,0x01,0x24,0x8f,0xfb,0x5a,0x08,0x03,
+0xea,0x02,0x42,0xcf,0xf9,0x00,0x07,0xa7,0x06,0x31,0x50,0x09,0xf7,0x4c,0x00,0xf0,
+0x00,0xf1,0x02,0xff,0xfa,0x20,0x00,0x2a,0xff,0xf8,0x00,0x07,0xff,0xff,0xdc,0xdf,
+0x36,0x08,0x24,0x05,0xef,0x2e,0x03,0x11,0x5b,0x2e,0x03,0x2a,0x7e,0xea,0x05,0x03,
+0x0f,0x08,0x00,0x20,0x81,0x6b,0xef,0xea,0x40,0x00,0x8f,0xfb,0x2d,0x59,0x00,0x30,
+0x8f,0xfd,0xef,0xc1,0x04,0x50,0x50,0x8f,0xff,0xfc,0x40,0xb5,0x09,0x40,0x8f,0xff,
+0xb0,0x00,0xe5,0x05,0x11,0x8f,0x42,0x02,0x22,0xff,0xf5,0x38,0x00,0x2f,0xdf,0xf6,
+0x08,0x00,0x55,0xa3,0x1c,0xfa,0x06,0xff,0xf3,0x6f,0xff,0x30,0x9c,0x70,0x7d,0x09,
+0x3f,0x04,0xff,0xf0,0x05,0x00,0x1a,0x40,0x00,0x00,0x3d,0xe6,0x4c,0x01,0x10,0xf0,
+0x14,0x07,0x66,0x00,0x00,0x02,0xbc,0x40,0x00,0x01,0x00,0x20,0x7f,0xfd,0x1e,0x07,
+0x1f,0xd0,0x09,0x00,0x4a,0x10,0xfc,0xe3,0x01,0xff,0x04,0xb0,0x00,0x02,0xef,0xf8,
+0x02,0xee,0xff,0xff,0x30,0x2f,0xff,0xff,0x90,0x01,0xdf,0xfc,0x60,0x00,0x80,0x06,
+0x32,0x00,0x11,0x00,0x31,0x2e,0xff,0xd1,0x11,0x00,0x31,0x1d,0xff,0xe1,0x11,0x00,
+0x31,0x0c,0xff,0xf2,0x22,0x00,0x31,0x0b,0xff,0xf4,0x22,0x00,0x31,0x0a,0xff,0xf5,
+0x33,0x00,0x31,0x08,0xff,0xf7,0x33,0x00,0x33,0x07,0xff,0xf9,0xd9,0x04,0x12,0xfb,
+0xc7,0x0b,0x13,0xef,0xcc,0x02,0x01,0x46,0x08,0x00,0x74,0x04,0x00,0xe2,0x03,0x00,
+0x11,0x00,0x41,0xfe,0x2b,0xff,0xf3,0x11,0x00,0x42,0x30,0x1e,0xff,0xd0,0x77,0x00,
+0x01,0x30,0x04,0x22,0x8f,0xfb,0x93,0x0a,0x01,0x77,0x00,0x31,0xcf,0xfe,0x10,0x11,
+0x00,0x00,0xd5,0x0a,0x01,0x11,0x00,0x31,0x06,0xff,0xf7,0x99,0x00,0x00,0x17,0x0b,
+0x02,0xaa,0x00,0x7f,0x1e,0xff,0xd0,0x3e,0xee,0x4f,0xff,0x02,0x00,0x21,0xf1,0x02,
+0x9f,0xf8,0x01,0x8c,0xef,0xda,0x30,0x00,0x03,0xad,0xff,0xd8,0x10,0x00,0x9f,0xf9,
+0x5f,0x9d,0x00,0x81,0xaf,0xff,0xff,0xff,0xe4,0x00,0x9f,0xfd,0x59,0x03,0x10,0x4b,
+0x06,0x00,0x81,0xfe,0x10,0x9f,0xff,0xf8,0x10,0x00,0x7f,0x9d,0x04,0x70,0x9f,0xff,
+0x80,0x9f,0xff,0x60,0x00,0x36,0x03,0x11,0x60,0xec,0x04,0x21,0x9f,0xfd,0xc2,0x09,
+0x12,0xfc,0x2d,0x08,0x12,0x9f,0x49,0x05,0x11,0xf8,0x4d,0x07,0x23,0xf1,0x9f,0x6a,
+0x02,0x0f,0x0e,0x00,0x9b,0x23,0x8f,0xf8,0xb8,0x03,0x13,0xf9,0xb8,0x03,0x1f,0xfc,
+0xb8,0x03,0x7b,0x01,0xd8,0x06,0x11,0xeb,0xf0,0x0c,0x00,0x48,0x06,0x21,0xfd,0x30,
+0x79,0x08,0x40,0xdc,0xef,0xff,0xf4,0x11,0x00,0x11,0x91,0x1c,0x09,0x31,0x02,0xff,
+0xf8,0xbf,0x02,0x20,0xa0,0x0a,0x8e,0x06,0x00,0xae,0x00,0x12,0x0f,0x22,0x0d,0x32,
+0xef,0xf7,0x3f,0x6f,0x0e,0x23,0x9f,0xfa,0x74,0x08,0x43,0x6f,0xfd,0x6f,0xfe,0x73,
+0x08,0x03,0x09,0x00,0x43,0x6f,0xfe,0x4f,0xff,0xc4,0x03,0x12,0x2f,0xde,0x06,0x25,
+0x9f,0xfb,0x3f,0x00,0x05,0x51,0x00,0x31,0x03,0xff,0xf8,0x80,0x02,0xa0,0xb0,0x00,
+0x8f,0xff,0x91,0x00,0x04,0xdf,0xff,0x10,0x87,0x00,0x11,0xcc,0x87,0x00,0x01,0x99,
+0x00,0xc0,0xfe,0x30,0x00,0x00,0x00,0x02,0x8d,0xef,0xeb,0x60,0x00,0x00,0xf0,0x2f,
+0x8f,0xf7,0x02,0x8d,0xff,0xd9,0x20,0x00,0x08,0xff,0x86,0xff,0xff,0xff,0xff,0x60,
+0x00,0x8f,0xfd,0xff,0xff,0xef,0xff,0xff,0x60,0x08,0xff,0xff,0x92,0x00,0x17,0xff,
+0xff,0x10,0x8f,0xff,0x70,0x00,0x00,0x05,0xff,0xf9,0x08,0xff,0xc0,0x00,0x00,0x00,
+0x0a,0xff,0xe0,0x8f,0xfb,0x00,0x00,0x00,0x00,0x3f,0xff,0x28,0xff,0xb0,0x09,0x00,
+0x22,0xff,0xf5,0x11,0x00,0x32,0x0c,0xff,0x78,0x11,0x00,0x24,0xbf,0xf8,0x11,0x00,
+0x12,0x88,0x11,0x00,0x22,0xdf,0xf7,0x11,0x00,0x31,0x0f,0xff,0x58,0x11,0x00,0x50,
+0x03,0xff,0xf2,0x8f,0xfc,0x11,0x00,0x51,0x9f,0xfe,0x08,0xff,0xf5,0x4c,0x00,0xf2,
+0x14,0x80,0x8f,0xff,0xf7,0x00,0x00,0x5f,0xff,0xf1,0x08,0xff,0xff,0xff,0xcc,0xef,
+0xff,0xf5,0x00,0x8f,0xfb,0x7f,0xff,0xff,0xff,0xf6,0x00,0x08,0xff,0xb0,0x28,0xdf,
+0xfd,0x92,0x00,0x00,0x44,0x00,0x32,0x00,0x00,0x08,0x55,0x00,0x0f,0x11,0x00,0x22,
+0xf1,0x16,0x00,0x00,0x07,0xce,0xfe,0xa4,0x05,0xff,0xb0,0x00,0x3e,0xff,0xff,0xff,
+0xfa,0x6f,0xfb,0x00,0x2e,0xff,0xff,0xdd,0xff,0xff,0xff,0xb0,0x0c,0xff,0xf8,0x10,
+0x00,0x6f,0xff,0xfb,0x05,0xff,0xf7,0x91,0x00,0x31,0xb0,0xbf,0xfd,0xa2,0x00,0x41,
+0xfb,0x0f,0xff,0x60,0x42,0x00,0x32,0xb2,0xff,0xf2,0x53,0x00,0x22,0x4f,0xff,0x53,
+0x00,0x3a,0xb4,0xff,0xf0,0x11,0x00,0x14,0xb3,0x11,0x00,0x32,0x2f,0xff,0x20,0x75,
+0x00,0x22,0xff,0xf6,0x11,0x00,0x11,0x0a,0x3b,0x01,0x60,0x09,0xff,0xb0,0x4f,0xff,
+0x60,0xff,0x00,0xf0,0x0a,0xfb,0x00,0xcf,0xff,0x70,0x00,0x06,0xff,0xff,0xb0,0x02,
+0xef,0xff,0xfc,0xce,0xff,0xff,0xfb,0x00,0x03,0xdf,0xff,0xff,0xff,0xa9,0xa8,0x00,
+0x4f,0x7c,0xef,0xea,0x40,0xec,0x00,0x31,0xf0,0x08,0x8f,0xfb,0x8f,0xfa,0x04,0xbe,
+0xfa,0x8f,0xfa,0x7f,0xff,0xfa,0x8f,0xfe,0xff,0xff,0xfa,0x8f,0xff,0xfe,0x75,0x43,
+0x8f,0x1f,0x00,0x33,0x8f,0xff,0x10,0x31,0x00,0x0f,0x05,0x00,0x2e,0xa0,0x00,0x00,
+0x28,0xcf,0xfe,0xc7,0x10,0x00,0x00,0x07,0x3f,0x02,0x10,0xe5,0x5c,0x00,0xf1,0x09,
+0xfd,0xcf,0xff,0xff,0x50,0x02,0xff,0xfa,0x10,0x00,0x5e,0xff,0xe1,0x08,0xff,0xd0,
+0x00,0x00,0x02,0xff,0xf6,0x0a,0xff,0xa0,0x1b,0x02,0x01,0x10,0x00,0x81,0x00,0x01,
+0x10,0x04,0xff,0xfa,0x20,0x00,0x62,0x01,0x31,0xff,0xfd,0x84,0x99,0x01,0x00,0x91,
+0x01,0xa0,0x40,0x00,0x00,0x00,0x17,0xcf,0xff,0xff,0xfb,0x10,0x13,0x00,0x21,0x48,
+0xdf,0x38,0x01,0x00,0x1c,0x00,0x31,0xf6,0x15,0x54,0x5b,0x02,0x41,0xfa,0x3f,0xff,
+0x10,0x7b,0x00,0x31,0x0f,0xff,0x80,0x10,0x00,0xf0,0x03,0x08,0xff,0xf9,0x10,0x00,
+0x19,0xff,0xf4,0x00,0xcf,0xff,0xfd,0xcd,0xff,0xff,0xa0,0x00,0x09,0x88,0x00,0xfd,
+0x05,0xf9,0x00,0x00,0x00,0x38,0xce,0xff,0xc8,0x20,0x00,0x00,0x06,0xff,0xe0,0x00,
+0x00,0x00,0x6f,0xfe,0x00,0x0b,0x00,0x20,0x0d,0xff,0x61,0x02,0x10,0xdf,0x06,0x00,
+0x6e,0x68,0x99,0xcf,0xff,0x99,0x94,0x2c,0x00,0x0f,0x0b,0x00,0x19,0x10,0x5f,0x0b,
+0x00,0x11,0x05,0x04,0x02,0x11,0x3f,0x34,0x02,0xf0,0x03,0xef,0xff,0xee,0x80,0x00,
+0x05,0xff,0xff,0xf8,0x00,0x00,0x04,0xcf,0xfd,0x50,0x9f,0xfa,0x00,0x15,0x00,0x1f,
+0xf6,0x08,0x00,0x55,0x20,0x7f,0xfd,0x69,0x01,0x50,0xff,0xf6,0x4f,0xff,0x30,0xb7,
+0x03,0xd1,0xf6,0x0e,0xff,0xd3,0x00,0x04,0xcf,0xff,0xf6,0x07,0xff,0xff,0xee,0x5a,
+0x03,0x10,0xaf,0x06,0x00,0xb1,0xcf,0xf6,0x00,0x04,0xbe,0xfe,0xc8,0x20,0xbf,0xf6,
+0x4f,0x5a,0x01,0x51,0x0b,0xff,0x90,0xef,0xf6,0xd7,0x03,0x42,0xf4,0x09,0xff,0xb0,
+0xd7,0x00,0x21,0x3f,0xff,0xf9,0x03,0x40,0x90,0x00,0xdf,0xf5,0x5a,0x00,0x30,0xf3,
+0x00,0x08,0xcd,0x01,0x90,0x4f,0xfe,0x00,0x00,0x2f,0xff,0x00,0x00,0x09,0x8a,0x01,
+0x20,0xdf,0xf4,0x19,0x00,0x00,0xaa,0x01,0x30,0x90,0x00,0x3f,0x79,0x00,0x41,0x2f,
+0xfe,0x00,0x08,0xa3,0x01,0x61,0xcf,0xf4,0x00,0xdf,0xf2,0x00,0x1a,0x00,0x11,0x2f,
+0x53,0x03,0x31,0x1f,0xfe,0x07,0x19,0x00,0x61,0x00,0xcf,0xf3,0xcf,0xf2,0x00,0x3f,
+0x01,0x31,0xaf,0xfd,0x00,0x1a,0x00,0x10,0xff,0x6b,0x04,0x00,0xd7,0x01,0x01,0x6c,
+0x03,0x00,0x1a,0x00,0x23,0xfc,0x00,0x1a,0x00,0x22,0x70,0x00,0x1a,0x00,0x11,0xf2,
+0x0e,0x00,0x00,0xaa,0x00,0x01,0x75,0x01,0x31,0x2f,0xff,0x10,0x95,0x00,0x01,0xe5,
+0x00,0x90,0x06,0xff,0xc0,0x08,0xff,0x90,0x00,0x00,0x09,0x73,0x01,0x60,0x00,0xaf,
+0xf8,0x00,0x4f,0xfd,0x7e,0x04,0x00,0x72,0x02,0x60,0x0e,0xff,0x30,0x00,0xff,0xf1,
+0x30,0x00,0xf0,0x1f,0xff,0x20,0x00,0x02,0xff,0xf0,0x00,0x0b,0xff,0x50,0x00,0x07,
+0xff,0x9f,0xf6,0x00,0x00,0x6f,0xfa,0x00,0x00,0x7f,0xf9,0x00,0x00,0xcf,0xe1,0xff,
+0xb0,0x00,0x0a,0xff,0x60,0x00,0x02,0xff,0xd0,0x00,0x1f,0xf9,0x0c,0xff,0x00,0x00,
+0xef,0xf2,0x3a,0x00,0x90,0x10,0x05,0xff,0x50,0x7f,0xf5,0x00,0x1f,0xfd,0x55,0x00,
+0xa0,0xf5,0x00,0xaf,0xf0,0x02,0xff,0xa0,0x05,0xff,0x90,0xed,0x01,0x90,0x90,0x0e,
+0xfb,0x00,0x0d,0xfe,0x00,0x9f,0xf4,0x96,0x00,0x91,0xfd,0x03,0xff,0x60,0x00,0x9f,
+0xf3,0x0d,0xff,0xdd,0x00,0x91,0xf1,0x8f,0xf2,0x00,0x04,0xff,0x81,0xff,0xb0,0x94,
+0x03,0x81,0x5d,0xfd,0x00,0x00,0x0e,0xfd,0x5f,0xf7,0x3a,0x05,0x10,0xfb,0x00,0x01,
+0x41,0xaf,0xfb,0xff,0x30,0x68,0x01,0x20,0xff,0xf3,0x4a,0x00,0x00,0xce,0x00,0x00,
+0x7e,0x01,0x11,0xfe,0x28,0x05,0x11,0xfa,0xed,0x00,0x12,0x6f,0x34,0x03,0x40,0xff,
+0x50,0x00,0x00,0x44,0x03,0x11,0xf5,0x12,0x01,0x11,0xf1,0x1b,0x00,0x11,0x0d,0x03,
+0x01,0x21,0x1f,0xfc,0x67,0x05,0x12,0xe0,0x43,0x05,0x11,0x02,0xf7,0x00,0x20,0xcf,
+0xfd,0x84,0x03,0x50,0x20,0x00,0x06,0xff,0xf4,0x27,0x00,0x30,0xb0,0x00,0x1e,0x46,
+0x00,0x70,0x04,0xff,0xf4,0x00,0x9f,0xfe,0x10,0x70,0x03,0x22,0xfd,0x02,0x97,0x04,
+0x32,0x1e,0xff,0x7c,0x5f,0x03,0x20,0x05,0xff,0x15,0x01,0x02,0x78,0x01,0x12,0xf8,
+0x67,0x01,0x11,0x2f,0xa6,0x03,0x01,0x58,0x01,0x12,0xe1,0x09,0x00,0x33,0xdf,0xff,
+0xfa,0x5f,0x04,0x32,0xef,0xff,0x40,0x23,0x00,0x12,0x58,0xb4,0x00,0x51,0xcf,0xfb,
+0x00,0xef,0xf8,0x9b,0x00,0x50,0xf2,0x00,0x5f,0xff,0x30,0x9f,0x01,0x30,0x80,0x00,
+0x0c,0x5b,0x00,0x20,0xbf,0xfe,0xed,0x04,0x51,0xf7,0x00,0x05,0xff,0xf6,0xe9,0x03,
+0x41,0x20,0x0e,0xff,0xc0,0x79,0x00,0x41,0xb0,0x7f,0xff,0x10,0xe8,0x00,0x31,0x61,
+0xff,0xf6,0x81,0x00,0x21,0xf1,0x0c,0x28,0x01,0x60,0xaf,0xfc,0x00,0x6f,0xff,0x10,
+0x74,0x01,0x40,0x60,0x01,0xff,0xf6,0x3d,0x00,0x31,0xf1,0x00,0x0b,0xb1,0x04,0x10,
+0xfc,0x0e,0x01,0x00,0xd0,0x00,0x90,0x60,0x00,0x01,0xff,0xf5,0x00,0x02,0xff,0xf1,
+0x2d,0x01,0x50,0xa0,0x00,0x7f,0xfc,0x00,0x37,0x06,0x41,0x00,0x0b,0xff,0x70,0x8b,
+0x06,0x31,0x01,0xff,0xf1,0xac,0x02,0x41,0xa0,0x5f,0xfc,0x00,0x1a,0x00,0x32,0x0a,
+0xff,0x70,0xce,0x02,0x31,0xef,0xf1,0x00,0x1a,0x00,0x23,0xdf,0xfc,0xd9,0x00,0x03,
+0x53,0x02,0x13,0xef,0x52,0x01,0x14,0x09,0x6c,0x02,0x14,0x4f,0x6c,0x02,0x23,0xef,
+0xf2,0x7d,0x02,0x13,0xfc,0x3b,0x06,0x04,0x19,0x00,0x13,0xdf,0x19,0x00,0x12,0x5f,
+0x19,0x00,0x22,0x01,0x6f,0x12,0x01,0x42,0x8f,0xff,0xff,0xb0,0x23,0x01,0x21,0xff,
+0xd1,0x19,0x00,0x34,0x6e,0xfd,0x80,0x6c,0x00,0x00,0x01,0x00,0x14,0xf2,0x08,0x00,
+0x62,0x3c,0xcc,0xcc,0xcc,0xcc,0xcf,0x3e,0x01,0x22,0x00,0x7f,0xdf,0x01,0x33,0x03,
+0xff,0xf9,0xd9,0x01,0x13,0xd0,0x17,0x05,0x01,0x1e,0x02,0x02,0x8f,0x06,0x00,0x34,
+0x01,0x12,0xc0,0xa2,0x01,0x22,0xfe,0x10,0x8b,0x00,0x22,0xf5,0x00,0x85,0x07,0x12,
+0x90,0x92,0x00,0x13,0xfd,0xc4,0x00,0x18,0xf3,0xc3,0x00,0x22,0x01,0xef,0xa1,0x00,
+0x13,0x0b,0xe3,0x00,0x92,0x5f,0xff,0xeb,0xbb,0xbb,0xbb,0xbb,0xb7,0x7f,0x88,0x00,
+0x14,0xfa,0x08,0x00,0x14,0x00,0x01,0x00,0x61,0x08,0xe4,0x00,0x00,0x00,0x4e,0xdd,
+0x03,0x20,0xff,0xa2,0x87,0x01,0x10,0x90,0x6b,0x00,0x10,0xe0,0xe5,0x01,0x11,0xf8,
+0xb0,0x01,0x10,0x40,0x52,0x04,0x12,0xf2,0x78,0x03,0x12,0x00,0x86,0x01,0x0a,0x0b,
+0x00,0x10,0x00,0x6b,0x02,0x11,0xf0,0x39,0x07,0x01,0x71,0x00,0x60,0x40,0x00,0x09,
+0xdf,0xff,0x90,0x66,0x01,0x10,0x80,0x50,0x00,0x52,0xfe,0x40,0x00,0x00,0x03,0xc4,
+0x00,0x25,0xdf,0xf8,0x3a,0x05,0x01,0x60,0x04,0x1e,0x02,0x4d,0x00,0x14,0x10,0x6e,
+0x00,0x11,0x0f,0x0d,0x01,0x01,0x98,0x04,0x11,0x09,0x09,0x01,0x11,0x3f,0x72,0x01,
+0x11,0x8f,0x06,0x00,0x11,0x9f,0x04,0x01,0x11,0x5d,0xd4,0x02,0x5f,0x04,0x10,0xef,
+0xbe,0xfb,0x03,0x00,0x18,0x31,0xb7,0x85,0x00,0x5c,0x03,0x24,0xe9,0x10,0x8a,0x01,
+0x21,0x01,0x9f,0xbc,0x05,0x11,0x7f,0x12,0x03,0x25,0xcf,0xf9,0xa4,0x00,0x02,0xd4,
+0x07,0x23,0xff,0xf3,0x07,0x01,0x00,0x52,0x02,0x0a,0x0b,0x00,0x11,0x0e,0x0b,0x00,
+0x22,0xdf,0xf6,0xe9,0x07,0x01,0x32,0x00,0x11,0x70,0xc4,0x03,0x10,0xda,0x91,0x01,
+0x00,0x14,0x01,0x21,0x2c,0xff,0xc2,0x02,0x14,0xc4,0x53,0x00,0x21,0xbf,0xf8,0x37,
+0x00,0x1e,0x50,0x4d,0x00,0x08,0x0b,0x00,0x39,0x1f,0xff,0x20,0x54,0x01,0x10,0x2f,
+0x31,0x00,0x10,0x3e,0xa4,0x01,0x10,0x7f,0x67,0x00,0x30,0x05,0xfe,0x60,0x27,0x02,
+0x12,0x00,0x30,0x05,0x30,0xcf,0xfc,0x70,0x06,0x01,0x70,0x88,0x10,0x0b,0xff,0xff,
+0xff,0xd3,0x52,0x03,0x11,0xf1,0x10,0x07,0x10,0xf5,0x77,0x05,0x00,0xf8,0x03,0xc0,
+0x5e,0xff,0xf9,0x10,0x3c,0xff,0x80,0x7f,0xf8,0x00,0x00,0x1c,0x19,0x00,0x20,0xe1,
+0x0a,0x6a,0x00,0x00,0x24,0x00,0x40,0xe3,0x00,0x46,0x60,0x88,0x02,0x4f,0xae,0xfe,
+0x91,0x00,0x01,0x00,0x04,0x1a,0x55,0x0f,0x00,0x19,0xdd,0x0e,0x00,0x38,0x06,0xff,
+0x60,0x0f,0x00,0x38,0x0e,0xff,0xe0,0x0f,0x00,0x38,0x7f,0xff,0xf7,0x0f,0x00,0x11,
+0xef,0xe8,0x04,0x05,0x94,0x09,0x14,0xff,0x8d,0x03,0x04,0x07,0x06,0x03,0xb1,0x02,
+0x12,0x00,0x57,0x03,0x14,0xbc,0x97,0x04,0x01,0xd1,0x06,0x31,0xff,0x33,0xff,0x3e,
+0x04,0x03,0xf2,0x02,0x33,0xfa,0x00,0xaf,0x05,0x03,0x01,0x1d,0x01,0x11,0xf2,0x04,
+0x00,0x03,0x01,0x00,0x00,0x1a,0x00,0x15,0x09,0xe0,0x02,0x10,0x03,0x38,0x00,0x22,
+0x01,0xff,0x59,0x03,0x00,0x16,0x03,0x11,0xf8,0x5e,0x00,0x03,0x2f,0x09,0x11,0x3f,
+0x74,0x00,0x13,0x1f,0x42,0x03,0x01,0xa1,0x09,0x00,0x9a,0x00,0x02,0x42,0x03,0x13,
+0x04,0xb0,0x00,0x03,0xfc,0x04,0x33,0x0d,0xff,0xf6,0xa1,0x05,0x12,0xd0,0x58,0x03,
+0x13,0xd0,0xbc,0x03,0x12,0xf5,0x2b,0x05,0x22,0x50,0x00,0xbc,0x03,0x18,0xfd,0xc4,
+0x06,0x20,0x00,0xcf,0x22,0x01,0x11,0x0e,0xd5,0x01,0x02,0xa5,0x03,0x10,0xe0,0x18,
+0x01,0x22,0xd2,0x22,0x01,0x00,0x30,0x2d,0xff,0xf7,0x60,0x00,0x06,0x01,0x00,0x48,
+0xfe,0x10,0x08,0xff,0x01,0x00,0x29,0x80,0x1f,0x0f,0x00,0x29,0xf1,0x9f,0x0f,0x00,
+0x15,0xf9,0x22,0x01,0x49,0x28,0xcd,0xb7,0x10,0x5b,0x01,0x16,0xe5,0x4b,0x01,0x00,
+0x2a,0x00,0x15,0x50,0x0f,0x01,0x33,0xfe,0x64,0x7e,0xdf,0x05,0x71,0x47,0x81,0x0a,
+0xff,0xe1,0x00,0x02,0xa5,0x01,0x32,0x01,0x8e,0xff,0xf5,0x0a,0x21,0x9f,0xfa,0xe3,
+0x00,0x52,0xff,0xfa,0x2f,0xff,0x40,0xee,0x09,0x80,0x0a,0xff,0xff,0xfc,0x81,0x4f,
+0xff,0x80,0x79,0x09,0x01,0x2e,0x06,0x90,0x10,0x00,0x7f,0xff,0xf4,0x00,0x05,0xff,
+0xf5,0x3f,0x05,0x20,0x10,0x00,0x53,0x08,0x61,0xb9,0xcf,0xff,0xd0,0x00,0x5f,0xa6,
+0x03,0x11,0xdf,0xc7,0x00,0x31,0x20,0x00,0xef,0xf1,0x03,0x01,0xa7,0x00,0x31,0xd2,
+0x00,0x06,0x25,0x01,0x11,0x03,0x79,0x04,0x22,0x14,0x20,0xf8,0x05,0x11,0x06,0x7b,
+0x0c,0x31,0xaf,0xf2,0x0f,0x9d,0x00,0x11,0x09,0x28,0x00,0x42,0xdf,0xf6,0x3f,0xff,
+0xa7,0x01,0x00,0xdc,0x00,0x31,0xaf,0xfa,0x5f,0xe3,0x04,0x02,0x43,0x04,0x42,0x6f,
+0xfc,0x6f,0xfc,0x2a,0x02,0x10,0xb1,0x7f,0x01,0x12,0xfd,0x1c,0x00,0x21,0x4f,0xf7,
+0x94,0x01,0x12,0xfc,0x38,0x00,0x22,0x7d,0x30,0x05,0x0b,0x11,0x1f,0xb3,0x01,0x12,
+0x50,0x27,0x05,0x26,0xf8,0x0c,0x2c,0x02,0x45,0x02,0xff,0xf3,0x07,0x68,0x02,0x00,
+0xd8,0x0c,0x25,0x01,0xef,0x0a,0x05,0x00,0xc1,0x09,0x14,0x7f,0x94,0x02,0x30,0x02,
+0xef,0xfe,0x66,0x07,0x03,0x84,0x02,0x10,0x3e,0xc1,0x01,0x40,0x01,0xdf,0xff,0xc4,
+0x0d,0x00,0x12,0x18,0xb9,0x02,0x82,0x2d,0xff,0xff,0xd8,0x53,0x34,0x6a,0xff,0xe5,
+0x02,0x23,0x01,0xbf,0xc1,0x01,0x12,0x40,0x07,0x02,0x12,0xcf,0xbf,0x01,0x04,0x77,
+0x01,0x6f,0x8c,0xff,0xff,0xda,0x50,0x00,0x01,0x00,0x12,0x12,0x0d,0x49,0x00,0x16,
+0x30,0xb3,0x00,0x00,0x01,0x00,0x05,0x4a,0x03,0x30,0x71,0x00,0x5f,0x10,0x00,0x32,
+0xc0,0x01,0xd9,0xd1,0x02,0x12,0xfd,0x32,0x02,0x02,0x55,0x01,0x00,0xee,0x01,0x30,
+0xd2,0x00,0xbf,0x2f,0x00,0x12,0xbf,0xa0,0x02,0xf0,0x06,0x2e,0xff,0xf7,0x00,0x1e,
+0xff,0xff,0xc0,0x00,0xcf,0xfe,0x20,0x10,0x00,0x00,0x06,0x02,0xef,0xa0,0x00,0x03,
+0xfb,0x07,0x40,0x0b,0xf3,0x4c,0xf1,0x04,0x09,0x10,0x47,0x3f,0x01,0x00,0xda,0x02,
+0x10,0x4c,0xed,0x00,0x11,0xef,0xc2,0x03,0x21,0x0a,0xc0,0x68,0x01,0x42,0xfe,0x00,
+0x02,0xef,0x3b,0x01,0x11,0x20,0xa2,0x01,0x65,0x91,0x00,0x00,0x06,0xdf,0x20,0x95,
+0x03,0x68,0x92,0x13,0x20,0x05,0x76,0x54,0xb4,0x03,0x26,0xd0,0x0f,0x93,0x02,0x00,
+0xa4,0x05,0x48,0xf0,0x0f,0xff,0xf8,0x20,0x00,0x0a,0x10,0x00,0x66,0x39,0x75,0x30,
+0x00,0x12,0x42,0x10,0x00,0x66,0x6c,0x73,0x00,0x01,0x7c,0xfd,0x10,0x00,0x10,0xcf,
+0xda,0x09,0x03,0xa5,0x08,0x02,0x35,0x09,0x36,0xa0,0x04,0xff,0x71,0x04,0x84,0x01,
+0xae,0xff,0x50,0x00,0xee,0x94,0x71,0x10,0x00,0x84,0x1d,0x80,0x26,0x00,0x00,0x10,
+0x1c,0xfb,0x10,0x00,0x95,0xbf,0xfc,0x20,0x00,0x00,0x02,0xdf,0xff,0x80,0x09,0x04,
+0x11,0xe0,0xf7,0x08,0x21,0x68,0x10,0x3e,0x00,0x21,0xa9,0x5e,0xc6,0x01,0x42,0xaf,
+0xe3,0x8f,0xf8,0x99,0x03,0x21,0x41,0xca,0x3c,0x03,0x73,0x11,0xff,0xfe,0x5b,0x96,
+0x29,0xce,0xdf,0x03,0x00,0xf7,0x00,0x63,0xf6,0x9f,0xff,0x5f,0xff,0x4a,0x7d,0x07,
+0xa4,0x00,0x05,0xef,0xd0,0xbf,0xfd,0x1f,0xff,0x81,0xee,0x89,0x00,0x86,0x19,0x40,
+0xef,0xfa,0x0e,0xff,0xb0,0x31,0xb9,0x00,0x5c,0xad,0xf7,0x0a,0xea,0x40,0xd7,0x01,
+0x50,0x00,0x00,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0x05,0x20,0x00,0x01,0x00,0x75,
+0x01,0xdf,0xf4,0x00,0x00,0x13,0x43,0x15,0x00,0x93,0x0c,0xff,0xff,0x45,0xae,0xff,
+0xff,0xff,0xb5,0x10,0x00,0x23,0xbf,0xff,0x01,0x00,0x11,0xe6,0x0f,0x00,0x70,0x0b,
+0xff,0xf9,0xef,0xff,0xff,0xff,0x04,0x00,0x10,0xe3,0x10,0x00,0xf0,0x23,0xaf,0xff,
+0x90,0x2e,0xff,0xfa,0x10,0x00,0x03,0x8e,0xff,0xff,0x60,0x00,0x00,0x09,0xff,0xf9,
+0x00,0x02,0xef,0xff,0x80,0x00,0x00,0x00,0x7f,0xff,0xf6,0x00,0x00,0x2f,0xff,0xc0,
+0x00,0x00,0x1d,0xff,0xf9,0x00,0x00,0x00,0x03,0xef,0xff,0x30,0x00,0x0e,0xff,0xf7,
+0x73,0x00,0xb0,0xff,0xa0,0x00,0x00,0x00,0x2e,0xff,0xe0,0x00,0x02,0xdf,0x2c,0x00,
+0x30,0x1c,0xff,0xfa,0x21,0x00,0x00,0x1c,0x00,0x90,0x1f,0xff,0xf8,0x00,0x00,0x00,
+0xcf,0xff,0x10,0x42,0x00,0xb0,0xfe,0x10,0x00,0x3f,0xff,0xff,0x90,0x00,0x05,0xff,
+0xfd,0x6c,0x00,0xc0,0x0e,0xff,0x60,0x00,0x8f,0xff,0xff,0xfa,0x00,0x4f,0xff,0xe2,
+0x10,0x00,0xd1,0x08,0xff,0xb0,0x00,0xdf,0xf7,0xbf,0xff,0xb4,0xff,0xfe,0x20,0x00,
+0x41,0x00,0x92,0xf0,0x00,0xff,0xf3,0x0b,0xff,0xff,0xff,0xf3,0xbc,0x00,0xa3,0xff,
+0xf1,0x01,0xff,0xf1,0x00,0xaf,0xff,0xff,0x30,0x10,0x00,0x64,0xf3,0x01,0xff,0xf0,
+0x00,0x08,0x1f,0x00,0xb4,0x00,0xef,0xf4,0x00,0xff,0xf2,0x00,0x00,0x6a,0x30,0x00,
+0x20,0x00,0x36,0x00,0xef,0xf3,0x1b,0x01,0x00,0x3d,0x00,0x26,0xbf,0xf7,0x10,0x00,
+0x66,0x05,0xff,0xe0,0x00,0x7f,0xfc,0x10,0x00,0x64,0x09,0xff,0xa0,0x00,0x1f,0xff,
+0x3d,0x00,0x00,0xbc,0x00,0x55,0x40,0x00,0x0a,0xff,0xc0,0x10,0x00,0x65,0xaf,0xfd,
+0x00,0x00,0x02,0xff,0x41,0x00,0x93,0x06,0xff,0xf4,0x00,0x00,0x00,0x8f,0xff,0x50,
+0x10,0x00,0x31,0x4f,0xff,0xb0,0x70,0x01,0x14,0xf7,0x1f,0x00,0x20,0xfd,0x10,0x75,
+0x00,0x31,0xef,0xff,0xc4,0xcd,0x00,0x10,0xbf,0x9b,0x00,0x10,0x00,0x1d,0x01,0x63,
+0xff,0xd9,0x54,0x34,0x58,0xcf,0xe5,0x00,0x00,0x42,0x00,0x02,0x01,0x00,0x13,0xa1,
+0x48,0x00,0x21,0x02,0xaf,0x0f,0x00,0x16,0xb3,0xb8,0x00,0x55,0x6a,0xce,0xff,0xda,
+0x61,0x0e,0x00,0x14,0xbb,0x01,0x00,0x11,0xa0,0xc4,0x00,0x04,0x01,0x00,0x00,0x7d,
+0x00,0x15,0x0a,0x0e,0x00,0x00,0x95,0x00,0x14,0x0f,0x0d,0x00,0x12,0xfe,0x9f,0x00,
+0x12,0xf2,0xc6,0x00,0x10,0xf9,0x06,0x00,0x12,0x9f,0xd8,0x00,0x12,0x01,0x15,0x00,
+0x12,0xef,0xc5,0x00,0x11,0x07,0x15,0x00,0x12,0x03,0x30,0x00,0x01,0x9f,0x01,0x00,
+0x95,0x01,0x11,0xf9,0x0e,0x00,0x20,0x5f,0xff,0x06,0x00,0x13,0x0d,0x45,0x00,0x22,
+0xbf,0xf9,0x21,0x01,0x12,0xe0,0x37,0x00,0x12,0xf3,0x4b,0x02,0x12,0xf2,0x42,0x02,
+0x12,0xa0,0xbd,0x01,0x00,0xf9,0x01,0x32,0x2c,0xff,0xf6,0xb6,0x00,0x72,0xcf,0xfd,
+0x00,0x00,0x04,0xef,0xfc,0xf3,0x00,0x10,0x3d,0xc2,0x01,0x11,0x6f,0x56,0x02,0x02,
+0xc2,0x00,0x42,0x90,0x01,0xff,0xe3,0x28,0x00,0x82,0x3f,0xff,0xfa,0xff,0xd0,0x07,
+0xff,0xe1,0x0e,0x00,0x84,0xdf,0xff,0x41,0xff,0x80,0x0d,0xff,0xfb,0x70,0x01,0x43,
+0x05,0xff,0x30,0x3f,0xfe,0x01,0xa2,0x0c,0xff,0x90,0x08,0xfe,0x00,0x9f,0xbc,0xff,
+0x90,0x8a,0x00,0x62,0x20,0x0c,0xf9,0x00,0xef,0x46,0xd6,0x00,0xa3,0x2f,0xff,0x00,
+0x0f,0xf4,0x05,0xfc,0x03,0xff,0xe0,0x0e,0x00,0x81,0x3f,0xe0,0x08,0x93,0x03,0xff,
+0xd0,0x00,0x15,0x01,0x30,0x20,0x49,0x50,0x76,0x00,0x12,0xc0,0x46,0x00,0x21,0x70,
+0x00,0x38,0x01,0x12,0x70,0x62,0x00,0x12,0xe1,0x2a,0x01,0x12,0x20,0x4f,0x02,0x20,
+0xfd,0x10,0xe7,0x02,0x12,0xfa,0x8c,0x00,0x62,0x6f,0xff,0xe7,0x20,0x03,0x9f,0xaa,
+0x02,0x00,0x17,0x01,0x01,0x01,0x00,0x13,0x40,0x95,0x01,0x10,0x5e,0x0d,0x00,0x15,
+0xd3,0xb2,0x01,0x47,0x7c,0xff,0xff,0xb6,0x94,0x03,0x18,0x02,0xa3,0x03,0x72,0x06,
+0x88,0x88,0x88,0x88,0x80,0x00,0x7e,0x03,0x00,0x37,0x00,0x1f,0xf0,0x0c,0x00,0x09,
+0x40,0x11,0x11,0x1c,0xff,0x01,0x03,0x55,0x33,0x44,0x51,0xdf,0xff,0x01,0x00,0x10,
+0xfc,0xd5,0x01,0xa5,0xee,0xee,0xed,0xdd,0xdd,0xdc,0xcd,0xfd,0xff,0x20,0x68,0x00,
+0x08,0x0c,0x00,0x1b,0xfe,0x0c,0x00,0x62,0x23,0x33,0x33,0x33,0x33,0x31,0x0c,0x00,
+0x10,0xef,0x45,0x00,0x1b,0xf9,0x0c,0x00,0x1a,0xef,0x0c,0x00,0x05,0x3c,0x00,0x2f,
+0xef,0x30,0x0c,0x00,0x06,0x10,0x33,0x01,0x00,0x65,0x32,0x00,0x02,0xff,0xef,0x30,
+0x3c,0x00,0x0f,0x0c,0x00,0x09,0x04,0x3c,0x00,0x36,0xff,0xdf,0x30,0x95,0x03,0x27,
+0xdf,0x40,0x0c,0x00,0xb7,0x51,0x11,0x12,0x22,0x22,0x22,0x23,0x33,0x33,0x35,0xff,
+0xf0,0x00,0x41,0xff,0x9f,0xff,0xfe,0x48,0x00,0x4f,0xfd,0xcc,0xcc,0xb8,0x38,0x01,
+0x12,0x0a,0x0c,0x00,0x69,0x01,0x11,0x11,0x11,0x11,0x10,0x28,0x05,0x08,0x9f,0x01,
+0x53,0x8b,0xef,0xff,0xeb,0x72,0x0d,0x00,0x21,0x04,0xcf,0x71,0x00,0x21,0xa0,0x50,
+0x38,0x00,0x03,0x2e,0x05,0x20,0xf4,0xcd,0xb0,0x00,0x13,0x4e,0x8d,0x00,0xf0,0x03,
+0xf3,0xcf,0xf8,0x00,0x00,0x04,0xff,0xff,0xff,0xd7,0x42,0x23,0x59,0xdf,0x80,0xcf,
+0xff,0xd4,0xd7,0x04,0x13,0xe5,0xe9,0x02,0x41,0x9d,0xff,0xa1,0xdf,0x00,0x05,0x01,
+0x0e,0x00,0x20,0x50,0x8f,0xdf,0x02,0x05,0x0e,0x00,0x23,0x02,0xcf,0xcd,0x02,0x01,
+0x0e,0x00,0x47,0x00,0x06,0xff,0xf9,0x0e,0x00,0x46,0x00,0x1a,0xff,0xd3,0x0e,0x00,
+0x00,0x55,0x02,0x17,0x90,0x0e,0x00,0x47,0x00,0x9f,0xfe,0x40,0x0e,0x00,0x38,0x03,
 0xdf,0xfa,0x0e,0x00,0x27,0xef,0xf5,0x0e,0x00,0x36,0x6f,0xfc,0x20,0x0e,0x00,0x18,
-0x0a,0x46,0x00,0x37,0x02,0xdf,0xf5,0x62,0x00,0x36,0x5f,0xfd,0x20,0x0e,0x00,0x03,
-0xa6,0x27,0x05,0xa8,0x00,0x16,0xf1,0x0e,0x00,0x27,0x4e,0xff,0xb6,0x00,0x36,0x58,
-0xff,0xca,0x88,0x08,0x45,0xcf,0xef,0xf9,0x00,0x87,0x48,0x00,0x96,0x34,0x00,0x0a,
-0x01,0x13,0xd4,0x0e,0x00,0x12,0xd2,0x26,0x01,0x74,0xd8,0x42,0x13,0x59,0xef,0x80,
-0xc9,0x70,0x50,0x01,0xbd,0x0e,0x18,0x30,0x5e,0x01,0x19,0xf2,0x7a,0x01,0x05,0xe3,
-0x08,0x00,0x96,0x01,0x1c,0x61,0xf2,0x42,0x16,0xdd,0x01,0x00,0x37,0xd7,0x4f,0xff,
-0x12,0x03,0x34,0x4f,0xc0,0x03,0x4a,0x00,0x54,0x01,0xfd,0x4f,0xc0,0x02,0xfe,0x0b,
-0x07,0x0d,0x00,0x62,0x28,0x99,0x9a,0xfd,0x4f,0xc0,0x93,0x08,0x00,0x1f,0x0a,0x00,
-0x0d,0x00,0x63,0x01,0x11,0x00,0x00,0x06,0xef,0x0d,0x00,0x20,0x00,0x00,0x77,0x44,
-0x03,0x0d,0x00,0x54,0x25,0x55,0x30,0x2e,0xff,0x0d,0x00,0x00,0x83,0x06,0x13,0x7e,
-0x0d,0x00,0x11,0x01,0x5d,0x32,0x18,0x7f,0x0d,0x00,0x27,0x01,0x8f,0x0d,0x00,0x03,
-0x75,0x00,0x46,0x00,0xcf,0xff,0xd1,0x0d,0x00,0x05,0xe3,0x02,0x0d,0x0d,0x00,0x36,
-0x46,0x66,0x40,0x0d,0x00,0x04,0xeb,0x06,0x1c,0x01,0x4e,0x00,0x0c,0x0d,0x00,0x1f,
-0xf3,0x68,0x00,0x1e,0x38,0xbf,0xff,0xe2,0x68,0x00,0x1f,0xf6,0x0d,0x00,0x13,0x14,
-0xf5,0x0d,0x00,0x08,0x6c,0x01,0x26,0x1d,0xee,0x01,0x00,0x12,0xe8,0xad,0x01,0x56,
-0x7a,0xcd,0xdc,0xa7,0x30,0xe4,0x04,0x01,0xbc,0x03,0x03,0x36,0x54,0x04,0x89,0x2f,
-0x01,0x98,0x3e,0x04,0xf2,0x06,0x41,0xcf,0xf3,0x5f,0xf9,0xda,0x45,0x02,0xab,0x0b,
-0x63,0x92,0x1f,0xf0,0x4f,0xe0,0x06,0x1d,0x0a,0x40,0x8f,0xff,0xd3,0x00,0x10,0x00,
-0x21,0x00,0x1b,0x44,0x06,0x10,0x05,0x15,0x0c,0x01,0x10,0x00,0x20,0x00,0xaf,0xa8,
-0x06,0x10,0x0e,0xf0,0x00,0x11,0x2f,0x10,0x00,0x12,0x0c,0xfe,0x0c,0x14,0x20,0x10,
-0x00,0x01,0xdc,0x46,0x01,0xbe,0x4b,0x02,0x10,0x00,0x00,0x24,0x2b,0x02,0x6b,0x27,
-0x02,0x10,0x00,0x00,0x29,0x0f,0x04,0x58,0x0f,0x00,0x1d,0x06,0x00,0xc9,0x50,0x02,
-0x12,0x23,0x11,0x1f,0x55,0x29,0x00,0x84,0x50,0x02,0x27,0x10,0x51,0x01,0x44,0x44,
-0x00,0x10,0x2f,0x2b,0x11,0x0f,0x42,0x10,0x00,0xe0,0x0e,0x00,0x58,0x00,0x03,0x10,
-0x00,0x20,0x4e,0xf9,0x12,0x07,0x13,0xd3,0x10,0x00,0x00,0x7b,0x0c,0x90,0x70,0x02,
-0xff,0xbe,0xff,0x80,0x00,0xff,0xf0,0x81,0x40,0xf0,0x1e,0x9f,0xfb,0x9f,0xf5,0x0a,
-0xff,0x21,0xaf,0xfc,0x23,0xff,0xd0,0x0b,0xff,0x70,0x1b,0xff,0x90,0x4f,0xfa,0x07,
-0xff,0xe4,0x05,0xff,0xfb,0xff,0xb0,0x06,0xff,0xd2,0xdf,0xf6,0x06,0xff,0xd2,0x00,
-0x4d,0xff,0x90,0x1b,0xff,0xff,0x60,0x01,0x47,0x06,0x21,0x9f,0xfb,0x55,0x13,0x10,
-0x30,0x54,0x17,0x32,0x9f,0xff,0xe2,0xbf,0x4b,0x50,0x03,0xdf,0xf8,0xcf,0xfa,0x9b,
-0x00,0x34,0x81,0xdf,0xf6,0x75,0x06,0x10,0xf2,0x6f,0x07,0x14,0xfe,0x78,0x06,0x12,
-0x6f,0x73,0x0a,0x24,0xff,0xf2,0xd1,0x08,0x03,0x33,0x19,0x12,0xfc,0x73,0x28,0x14,
-0xaf,0xf0,0x11,0x96,0xff,0xfb,0x51,0x00,0x00,0x05,0x9f,0xff,0xfb,0xbd,0x06,0x27,
-0xfd,0xdf,0x6c,0x03,0x13,0x2a,0xe1,0x2e,0x05,0xc1,0x01,0x00,0x3f,0x17,0x28,0xfc,
-0x71,0x7a,0x03,0x26,0x24,0x42,0x4f,0x02,0x38,0x7a,0xcc,0x95,0x5e,0x42,0x01,0x53,
-0x1c,0x05,0xa2,0x03,0x01,0x4a,0x00,0x07,0x7c,0x55,0x35,0xa4,0x23,0x6d,0xae,0x0e,
-0x02,0x7c,0x4d,0x29,0xaf,0xfe,0x5b,0x2e,0x04,0x9b,0x2c,0x03,0x7d,0x26,0x01,0xf2,
-0x41,0x10,0x12,0xb1,0x56,0x12,0xf8,0xc5,0x09,0x30,0xf0,0x00,0x7e,0x9b,0x1b,0x22,
-0x7f,0xf6,0x95,0x07,0x21,0xf0,0x1c,0xbe,0x0c,0x04,0x1e,0x00,0x21,0xe0,0xcf,0xf7,
-0x0d,0x13,0x3f,0x51,0x2b,0x12,0xc6,0xd7,0x0e,0x02,0x11,0x11,0x32,0x0c,0xff,0x6c,
-0x02,0x4c,0x04,0x78,0x00,0x13,0x0f,0xab,0x12,0x74,0xcf,0xff,0x93,0x01,0x5d,0xff,
-0xf4,0x0f,0x00,0x12,0x0c,0xb4,0x00,0x12,0x0d,0xc6,0x37,0x03,0x92,0x09,0x24,0x94,
-0x08,0x48,0x57,0x02,0x56,0x09,0x12,0xc8,0x66,0x09,0x00,0xee,0x0a,0x44,0xfd,0xbb,
-0xcf,0xff,0x4e,0x33,0x53,0x0d,0xff,0xf7,0x10,0x01,0x0f,0x00,0x10,0xb1,0x24,0x0a,
-0x24,0x20,0x00,0xf4,0x25,0x50,0xe1,0x00,0x03,0xff,0xe2,0x01,0x0a,0x03,0x7a,0x58,
-0x01,0xea,0x25,0x15,0x0c,0x47,0x03,0x10,0x40,0x59,0x2c,0x16,0x8f,0xc0,0x09,0x47,
-0x4f,0xf8,0x00,0x02,0x9a,0x0f,0x23,0x7f,0xf4,0xfb,0x56,0x02,0x82,0x06,0x27,0x9f,
-0xf3,0x8a,0x30,0x47,0xff,0xf7,0xaf,0xf2,0x3b,0x00,0x67,0xff,0xf8,0xaf,0xfb,0xbb,
-0xef,0x0f,0x00,0x0a,0xd6,0x0f,0x10,0xf7,0x28,0x3d,0x24,0xb7,0x77,0x01,0x00,0x5d,
-0x72,0x02,0x22,0x22,0x22,0x05,0x07,0x29,0x42,0x00,0x42,0x44,0x29,0xfe,0x30,0x64,
-0x0c,0x05,0xc2,0x01,0x0a,0x3b,0x4f,0x1b,0x00,0xa7,0x4c,0x05,0x0a,0x0b,0x1a,0x60,
-0x8f,0x44,0x09,0xb7,0x11,0x05,0x68,0x4f,0x04,0xe9,0x05,0x12,0xef,0x14,0x49,0x04,
-0xa1,0x07,0x11,0x3e,0x41,0x0a,0x13,0x3f,0xbd,0x00,0x47,0xee,0xef,0xff,0xfb,0x0f,
-0x00,0x03,0x9a,0x44,0x08,0x0f,0x00,0x28,0xfd,0x10,0x0f,0x00,0x00,0xf9,0x36,0x23,
-0x15,0x55,0x01,0x00,0x7b,0x56,0x66,0x66,0x66,0x64,0x00,0x00,0xfb,0x07,0x18,0x7f,
-0x2e,0x00,0x13,0xf3,0x30,0x59,0x15,0xff,0x8c,0x06,0x1a,0x4f,0x0f,0x00,0x19,0x04,
-0x0f,0x00,0x00,0x9f,0x00,0xa3,0xe4,0x44,0x45,0x55,0x66,0x66,0x77,0x78,0x88,0x91,
-0xb0,0x33,0x08,0x01,0x00,0x00,0x99,0x56,0x09,0x8f,0x0d,0x1a,0xfc,0xc1,0x06,0x06,
-0x58,0x45,0x03,0xac,0x32,0x09,0x9c,0x00,0x1b,0x0b,0x1f,0x00,0x2b,0xaf,0xfd,0xba,
-0x45,0x19,0x70,0x1f,0x00,0x1f,0x99,0xf7,0x0f,0x08,0x3a,0xbc,0xb9,0x63,0x2d,0x13,
-0x27,0xff,0xfa,0xb5,0x01,0x33,0x46,0x7a,0xdf,0xb1,0x49,0x04,0xa9,0x00,0x17,0x5b,
-0xb6,0x03,0x10,0x21,0x03,0x04,0x25,0xef,0xfd,0xbb,0x2d,0x33,0xfe,0xa7,0x20,0xb3,
-0x24,0x03,0x4b,0x00,0x44,0xfc,0x50,0x00,0x1b,0xf4,0x12,0x30,0x01,0x35,0x9d,0xeb,
-0x05,0x26,0x7f,0x90,0x89,0x0f,0x43,0xff,0xfb,0x20,0x02,0x0c,0x00,0x20,0x54,0x20,
-0x2f,0x34,0x25,0xf5,0x00,0x4b,0x00,0x56,0xa4,0x00,0x00,0x3d,0xe4,0x9b,0x59,0x00,
-0x47,0x49,0x06,0xe4,0x00,0x46,0x15,0x9f,0xff,0xc3,0x94,0x00,0x57,0x11,0x00,0x00,
-0x7e,0xf6,0xf2,0x10,0x44,0xfd,0xa3,0x01,0x20,0x52,0x06,0x45,0xfd,0x61,0x02,0x6c,
-0x2c,0x00,0x02,0xbe,0x15,0x00,0xbf,0x53,0x02,0x64,0x01,0x17,0xf9,0x18,0x49,0x10,
-0x00,0x4b,0x12,0x33,0x07,0xa9,0x20,0xe2,0x13,0x10,0x08,0xd8,0x0e,0x72,0xcf,0xff,
-0xf3,0x00,0x3f,0xff,0xf5,0x08,0x06,0x50,0x10,0x07,0xff,0xff,0xfd,0x14,0x12,0x02,
-0x1b,0x02,0x01,0x76,0x03,0x20,0x10,0x0d,0x29,0x10,0x00,0x1e,0x00,0x01,0xfe,0x03,
-0x43,0x00,0x0d,0xff,0xfe,0xe3,0x46,0x12,0x04,0xec,0x44,0x12,0xf7,0xdb,0x0d,0x11,
-0x80,0xa5,0x09,0x03,0xdc,0x0f,0x01,0x62,0x0d,0x11,0x10,0x64,0x2f,0x03,0x78,0x1a,
-0x02,0x93,0x3b,0x14,0xf4,0xd6,0x58,0x10,0xd4,0x58,0x32,0x03,0xf0,0x58,0x00,0x9e,
-0x05,0x55,0xd9,0x89,0xcf,0xff,0x91,0x81,0x01,0x1c,0x7b,0xf0,0x08,0x15,0x10,0x52,
-0x17,0x03,0x6c,0x07,0x16,0x90,0x86,0x50,0x0a,0x15,0x03,0x10,0xb0,0x3d,0x05,0x01,
-0x8d,0x0b,0x10,0x38,0x19,0x00,0x02,0x0d,0x05,0x11,0x3f,0xcb,0x20,0x04,0x0c,0x00,
-0x00,0xf2,0x28,0x04,0x0c,0x00,0x44,0x00,0x8f,0xff,0xa0,0x0c,0x00,0x00,0xe1,0x0d,
-0x03,0x0c,0x00,0x73,0xfe,0xee,0xe8,0x8f,0xfd,0x3f,0xfc,0xc3,0x2f,0x42,0xf9,0x1f,
-0xfe,0x3f,0x52,0x4a,0x34,0x22,0x22,0x21,0x0c,0x00,0x02,0x7b,0x1b,0x0f,0x0c,0x00,
-0xa2,0x14,0xff,0xb2,0x08,0x37,0xef,0xfe,0x3f,0x3d,0x04,0x17,0x0b,0x37,0x05,0x0d,
-0x44,0x03,0x1a,0x01,0x28,0x05,0x58,0x08,0xef,0xff,0xfc,0x60,0xb9,0x04,0x26,0xff,
-0xee,0x48,0x38,0x00,0xaf,0x48,0x55,0x50,0x00,0x17,0xef,0xe2,0x3d,0x00,0x01,0x95,
-0x5e,0x43,0x1d,0xfc,0x01,0x32,0x1d,0x14,0x12,0xfc,0x16,0x00,0x32,0xef,0xff,0xe8,
-0x67,0x16,0x13,0xf2,0x4c,0x05,0x12,0xef,0xc1,0x09,0x22,0x7f,0xb0,0xb1,0x11,0x32,
-0x60,0x00,0x7e,0x5e,0x27,0x15,0x70,0xa1,0x0c,0x20,0xef,0x90,0x2c,0x03,0x06,0x7b,
-0x00,0x01,0x79,0x5a,0x16,0xbf,0x0c,0x04,0x20,0x0c,0xf6,0xa8,0x04,0x03,0x81,0x03,
-0x92,0x14,0x83,0x00,0x07,0xf9,0x00,0x00,0x2f,0xfa,0x52,0x03,0xa0,0x8c,0xff,0xf7,
-0x00,0x06,0xfb,0x00,0x00,0xbf,0xc0,0x0e,0x00,0x11,0x9d,0x3b,0x02,0x10,0x06,0x45,
-0x5b,0x12,0x20,0x0e,0x00,0x30,0xff,0xfd,0xa5,0xdb,0x08,0x13,0x09,0x07,0x07,0x20,
-0xfd,0x95,0x3b,0x1b,0x10,0xf4,0x03,0x00,0x00,0xa9,0x15,0x21,0x86,0x30,0x68,0x08,
-0xa2,0xf5,0x00,0x1f,0xf0,0x00,0x06,0xfb,0x74,0x00,0x0a,0x37,0x0f,0x33,0xfe,0x10,
-0x3f,0x34,0x31,0x12,0xf6,0xa9,0x0f,0x13,0x90,0x6f,0x0a,0x12,0xef,0x56,0x17,0x43,
-0x4f,0xf0,0x2f,0xd0,0xdb,0x09,0x11,0xb0,0xea,0x07,0x33,0xf4,0x1f,0xf0,0x58,0x02,
-0x02,0xe8,0x3c,0x32,0xf6,0x0d,0xf4,0xe1,0x0f,0x02,0x6d,0x10,0x44,0x08,0xf7,0x08,
-0xfa,0x56,0x0f,0x10,0x80,0x38,0x00,0x21,0xf6,0x01,0x8c,0x1d,0x00,0xb0,0x06,0x10,
-0x70,0x71,0x00,0x36,0xf4,0x00,0x9f,0x9b,0x39,0x00,0xcf,0x09,0x28,0x00,0x1e,0x3a,
-0x05,0x66,0xbf,0xa0,0x00,0x03,0xef,0xe5,0x28,0x05,0x20,0xfe,0x10,0x50,0x15,0xb8,
-0xd7,0x43,0x33,0x34,0x44,0x45,0x55,0x56,0x68,0xdf,0xf3,0x69,0x11,0x02,0x9f,0x46,
-0x00,0xce,0x44,0x98,0xbc,0xcc,0xcc,0xcc,0xbb,0xbb,0xbb,0xb9,0x40,0x64,0x05,0x19,
-0x99,0xbd,0x06,0x3f,0x1f,0xff,0xa0,0x0f,0x00,0x0c,0x29,0x35,0x41,0x0f,0x00,0x28,
-0xbf,0xf6,0x0f,0x00,0x04,0x8f,0x35,0x03,0x0f,0x00,0x15,0x07,0xcd,0x31,0x00,0x24,
-0x1a,0x23,0xd4,0x07,0x63,0x1b,0x12,0x10,0x76,0x06,0x30,0x90,0x8f,0x10,0xbf,0x57,
-0x41,0xff,0xfd,0x81,0x02,0x90,0x02,0x14,0x04,0x5d,0x26,0x50,0x0b,0xff,0xe5,0x13,
-0xaf,0x5a,0x01,0x00,0x14,0x2e,0x20,0xdf,0xfa,0xd9,0x19,0x00,0xde,0x33,0x00,0x4b,
-0x5d,0x53,0x20,0x03,0xb8,0x2f,0xff,0x02,0x5c,0x01,0xc0,0x11,0x33,0x01,0x2f,0xff,
-0x7a,0x52,0x02,0x4d,0x1a,0x00,0xa3,0x29,0x01,0xef,0x19,0x22,0x4f,0xfc,0xfc,0x09,
-0x46,0xfb,0x89,0xff,0xfe,0xb7,0x53,0x13,0xcf,0x5d,0x5f,0x24,0xdf,0xf1,0xc6,0x4b,
-0x01,0xa6,0x0b,0x04,0xa8,0x00,0x13,0x3f,0x6c,0x23,0x18,0x90,0xff,0x00,0x38,0x06,
-0xff,0x50,0x0f,0x00,0x03,0x6d,0x59,0x04,0x0f,0x00,0x29,0x0b,0xff,0x2c,0x01,0x29,
-0x0d,0xfe,0x0f,0x00,0x29,0x0f,0xfd,0x0f,0x00,0x29,0x1f,0xfb,0x0f,0x00,0x29,0x2f,
-0xf9,0x0f,0x00,0x29,0x4f,0xf8,0x0f,0x00,0x29,0x5f,0xf7,0x0f,0x00,0x2a,0x7f,0xf6,
-0x95,0x01,0x1b,0x10,0xbd,0x03,0x11,0x43,0x1a,0x06,0x11,0xe4,0xd1,0x05,0xf0,0x0d,
-0x30,0x4f,0xf7,0x12,0xcf,0xc0,0x9f,0xb0,0x00,0x3f,0xf1,0xbf,0x80,0x00,0x0f,0xf2,
-0x9f,0xc0,0x00,0x4f,0xf0,0x3f,0xfb,0x57,0xff,0xa0,0x08,0xff,0x59,0x3e,0x13,0x5c,
-0xb1,0x1a,0x43,0x59,0xce,0xff,0xec,0xdd,0x0a,0x16,0x7e,0x27,0x15,0x22,0x1c,0xff,
-0xef,0x20,0x11,0xb0,0xf5,0x05,0x20,0xe6,0x20,0x00,0x50,0x14,0xfc,0x7a,0x35,0x00,
-0xc8,0x0e,0x15,0x80,0x7d,0x06,0x00,0x98,0x32,0x24,0xef,0xfc,0x90,0x11,0x25,0x71,
-0x05,0x9d,0x14,0x10,0x10,0x7c,0x3a,0x07,0x95,0x17,0x17,0x90,0x5d,0x3c,0x17,0x60,
-0x24,0x02,0x10,0xdc,0xd8,0x1d,0x26,0xc9,0x00,0xeb,0x05,0x1c,0xfc,0x0c,0x00,0x17,
-0x1f,0x30,0x00,0x04,0x58,0x47,0x03,0x40,0x3f,0x07,0x2a,0x08,0x2e,0xf1,0x00,0x80,
-0x09,0x24,0x7d,0x50,0x9d,0x06,0x00,0x4e,0x23,0x03,0x61,0x19,0x02,0x12,0x33,0x11,
-0x0b,0x0a,0x5b,0x00,0xf8,0x38,0x10,0x40,0xe3,0x0a,0x51,0xf8,0x30,0x00,0x02,0x8f,
-0x38,0x00,0x22,0x1b,0xff,0xdd,0x24,0x13,0x60,0x32,0x51,0x05,0xfa,0x61,0x01,0x2c,
-0x01,0x11,0x83,0x03,0x2e,0x0f,0x02,0x00,0x1f,0x56,0xef,0xf0,0x00,0x0f,0xfe,0x05,
-0x00,0x54,0x45,0x50,0x00,0x05,0x54,0x44,0x19,0x1f,0xb0,0x05,0x00,0x6c,0x02,0x1c,
-0x18,0x16,0x30,0xe8,0x15,0x06,0xac,0x01,0x15,0x0c,0xd5,0x43,0x00,0x30,0x07,0x26,
-0xdf,0xf5,0x4f,0x53,0x04,0x3a,0x25,0x00,0x9e,0x43,0x04,0x35,0x2e,0x00,0xc9,0x23,
-0x04,0x5c,0x35,0x00,0x14,0x23,0x02,0xb7,0x24,0x01,0xce,0x01,0x15,0x30,0xb2,0x5a,
-0x26,0x8f,0xfd,0x89,0x4c,0x22,0xef,0xf7,0xa2,0x20,0x04,0xb7,0x37,0x03,0x1a,0x02,
-0x03,0x9b,0x00,0x13,0xc0,0xe4,0x2c,0x01,0x21,0x3f,0x02,0xc9,0x0a,0x06,0x29,0x49,
-0x22,0xdf,0xf9,0xda,0x30,0x04,0x17,0x1b,0x03,0x9e,0x14,0x05,0xf8,0x64,0x01,0xbb,
-0x45,0x10,0xcb,0x37,0x16,0x33,0xbc,0xff,0xf1,0x81,0x3a,0x02,0x47,0x4e,0x05,0xf2,
-0x63,0x26,0x9f,0xfd,0x49,0x56,0x32,0x3f,0xff,0x30,0x95,0x63,0x02,0xac,0x02,0x04,
-0xa5,0x3f,0x00,0xcc,0x3a,0x04,0xd9,0x4e,0x00,0x44,0x21,0x06,0xb9,0x49,0x00,0x08,
-0x30,0x04,0x52,0x0b,0x08,0x0a,0x00,0x03,0x2b,0x4b,0x0f,0xf1,0x40,0x3f,0x00,0x29,
-0x03,0x26,0xcb,0xa8,0xeb,0x41,0x25,0xfe,0x70,0x78,0x00,0x13,0xfc,0x28,0x00,0x24,
-0x26,0xdf,0xe1,0x41,0x00,0x9d,0x16,0x05,0x30,0x4d,0x05,0x89,0x40,0x04,0x81,0x43,
-0x02,0xbe,0x00,0x15,0x50,0x22,0x3c,0x13,0x50,0x50,0x4e,0x05,0xeb,0x41,0x13,0xf3,
-0x9c,0x3f,0x10,0x9f,0x50,0x00,0x51,0xdb,0xbb,0xbb,0xbc,0xef,0x64,0x00,0x03,0x19,
-0x37,0x03,0x0a,0x00,0x24,0xec,0x82,0x81,0x42,0x25,0xca,0x50,0xea,0x4f,0x23,0xff,
-0xe5,0xab,0x00,0x11,0xce,0x59,0x11,0x02,0x66,0x65,0x36,0x7f,0xff,0xf1,0x6c,0x3f,
-0x14,0x60,0x61,0x46,0x26,0xef,0xf9,0x2f,0x48,0x13,0xa0,0x15,0x00,0x00,0x3d,0x20,
-0x06,0x92,0x4f,0x03,0x15,0x00,0x00,0x4d,0x21,0x02,0x15,0x00,0x11,0x18,0x8c,0x45,
-0x11,0xfc,0xde,0x5a,0x15,0xe4,0x0a,0x01,0x16,0xb3,0x7e,0x00,0x23,0xfc,0x40,0x2a,
-0x00,0x26,0x25,0xcf,0x69,0x00,0x36,0x7f,0xff,0x30,0xee,0x00,0x04,0x15,0x00,0x14,
-0x06,0xd0,0x42,0x00,0x8b,0x06,0x1d,0x10,0x15,0x00,0x00,0xb5,0x0f,0x06,0x2f,0x22,
-0x01,0x15,0x00,0x00,0xc8,0x00,0x11,0xf2,0x5f,0x50,0x27,0xcc,0xde,0xf1,0x42,0x01,
-0x16,0x11,0x11,0xff,0xf6,0x4e,0x06,0x9d,0x01,0x08,0x11,0x4d,0x02,0x12,0x02,0x05,
-0x43,0x4a,0x0f,0x12,0x48,0xa8,0x05,0x4d,0x1d,0x02,0x80,0x06,0x17,0x04,0x0c,0x00,
-0x12,0x06,0x76,0x44,0x15,0xa0,0x4d,0x29,0x02,0xbb,0x28,0x02,0x8e,0x15,0x03,0x0c,
-0x00,0x01,0x7d,0x18,0x03,0x0c,0x00,0x01,0xb1,0x10,0x03,0x0c,0x00,0x12,0x0f,0x6c,
-0x27,0x15,0xa0,0x3a,0x5a,0x03,0x0c,0x00,0x01,0x23,0x2a,0x03,0x0c,0x00,0x12,0x6f,
-0xb6,0x52,0x06,0xe0,0x52,0x03,0x0c,0x00,0x26,0xbf,0xf8,0x0c,0x00,0x26,0xdf,0xf5,
-0x0c,0x00,0x25,0xff,0xf3,0x0c,0x00,0x02,0x07,0x22,0x04,0x9b,0x59,0x15,0xc0,0x0c,
-0x00,0x02,0x75,0x12,0x12,0x0a,0xa6,0x07,0x03,0x2a,0x33,0x12,0xa0,0x1e,0x52,0x05,
-0x0c,0x00,0x23,0xcf,0xfb,0x9a,0x5f,0x01,0xd5,0x4d,0x05,0x0c,0x00,0x02,0x15,0x3b,
-0x01,0x0c,0x00,0x42,0xae,0xef,0xff,0xfe,0x27,0x3a,0x36,0xfe,0xea,0xbf,0x5c,0x0b,
-0x19,0xfb,0x0c,0x00,0x15,0xf6,0x8b,0x0f,0x0f,0x0c,0x00,0x42,0x25,0x0f,0xff,0x09,
-0x04,0x05,0x75,0x00,0x24,0xc0,0x0f,0xed,0x39,0x17,0xd9,0xc0,0x01,0x07,0x37,0x45,
-0x0f,0x15,0x00,0x2d,0x12,0xfd,0x3a,0x34,0x36,0xc8,0x00,0x0f,0x73,0x05,0x05,0xf2,
-0x00,0x0e,0x69,0x00,0x0f,0x7e,0x00,0x3c,0x03,0x0e,0x4e,0x06,0x95,0x4a,0x01,0x66,
-0x4a,0x04,0x01,0x12,0x01,0x6c,0x38,0x02,0xd1,0x1c,0x01,0x2b,0x06,0x00,0xdb,0x51,
-0x02,0x73,0x45,0x02,0x59,0x18,0x00,0x1b,0x26,0x15,0x70,0x21,0x00,0x01,0x18,0x25,
-0x01,0xe6,0x05,0x02,0x21,0x00,0x02,0xac,0x08,0x24,0xbf,0xfb,0x21,0x00,0x02,0xcd,
-0x25,0x01,0x5c,0x27,0x11,0x01,0x17,0x44,0x04,0xb5,0x47,0x13,0xe1,0x21,0x00,0x24,
-0xcf,0xfa,0xa8,0x49,0x02,0x21,0x00,0x33,0x6f,0xfe,0x10,0x80,0x26,0x11,0x50,0x21,
-0x00,0x15,0x2f,0x3b,0x5d,0x00,0x6d,0x46,0x17,0xf4,0x0d,0x09,0x77,0x9f,0xfe,0x30,
-0x1f,0xff,0x40,0x2c,0x8b,0x18,0x47,0xff,0xca,0xff,0xfc,0x8d,0x18,0x17,0x2f,0xe0,
-0x1c,0x02,0x64,0x00,0x55,0xc8,0xcf,0xff,0xff,0xd9,0x53,0x14,0x00,0x70,0x09,0x00,
-0x63,0x00,0x04,0xc3,0x61,0x00,0x09,0x00,0x00,0x63,0x00,0x05,0x88,0x09,0x00,0xc0,
-0x28,0x00,0x21,0x00,0x01,0x5c,0x28,0x03,0xa5,0x21,0x01,0xa5,0x00,0x35,0x3f,0xff,
-0x70,0x3b,0x27,0x01,0xc6,0x00,0x34,0x9f,0xff,0x10,0xdd,0x1c,0x00,0x21,0x00,0x00,
-0x6d,0x0b,0x05,0x77,0x49,0x01,0x21,0x00,0x02,0x85,0x22,0x12,0xbf,0x62,0x26,0x14,
-0xf4,0x45,0x29,0x19,0x5f,0x4a,0x01,0x22,0x90,0x00,0x5e,0x3e,0x03,0x6b,0x01,0x10,
-0xaf,0x57,0x07,0x15,0xf4,0x8c,0x01,0x00,0x5a,0x31,0x03,0x99,0x3c,0x03,0x21,0x00,
-0x01,0xbc,0x36,0x52,0x02,0x7b,0xef,0xfe,0xc7,0x23,0x21,0x03,0x11,0x0d,0x12,0x1d,
-0xb1,0x15,0x33,0xb0,0x00,0x0d,0x68,0x45,0x13,0x70,0xae,0x4d,0x22,0xdf,0xfe,0x91,
-0x00,0x00,0xe7,0x16,0x33,0x04,0xae,0x10,0x5d,0x08,0x04,0xa2,0x20,0x24,0xf2,0x00,
-0x08,0x51,0x07,0x93,0x22,0x01,0x24,0x0e,0x03,0x2d,0x4e,0x14,0x9f,0xa6,0x17,0x11,
-0x09,0xd3,0x5b,0x00,0x01,0x00,0x26,0x6b,0xbc,0xd1,0x19,0x3d,0x29,0xff,0xfa,0xe3,
-0x13,0x04,0xa5,0x47,0x01,0x56,0x00,0x14,0x73,0x5a,0x2d,0x23,0xef,0xb0,0x43,0x08,
-0x00,0x67,0x6c,0x01,0xd0,0x04,0x42,0xa0,0xdf,0xff,0x40,0x1c,0x3e,0x10,0x02,0x05,
-0x30,0x40,0x00,0x3b,0xff,0xfb,0x22,0x05,0x00,0xd1,0x5d,0x14,0xfc,0x60,0x43,0x11,
-0xf8,0xbd,0x38,0x40,0xce,0xff,0xdb,0x71,0xce,0x02,0x05,0xd2,0x24,0x02,0xb7,0x1b,
-0x00,0x75,0x11,0x24,0x0f,0xff,0x81,0x24,0x14,0xe0,0x45,0x43,0x05,0x15,0x00,0x24,
-0xaf,0xfc,0x15,0x00,0x32,0x4f,0xff,0x3f,0x15,0x00,0x00,0x4a,0x02,0x03,0x15,0x00,
-0x42,0x07,0xff,0xe1,0x0f,0x15,0x00,0x00,0xa9,0x02,0x02,0x15,0x00,0x00,0x1b,0x2a,
-0x11,0x1f,0x15,0x00,0x00,0xe0,0x08,0x12,0x01,0x15,0x00,0x00,0x7d,0x02,0x02,0x15,
-0x00,0x00,0xc1,0x02,0x02,0x15,0x00,0x01,0xdc,0x02,0x02,0x15,0x00,0x00,0xf5,0x1f,
-0x01,0x15,0x00,0x00,0x33,0x00,0x03,0x15,0x00,0x01,0x03,0x61,0x01,0x15,0x00,0x02,
-0x4a,0x2b,0x00,0x15,0x00,0x11,0x01,0xfa,0x4a,0x00,0x15,0x00,0x23,0xe0,0x9f,0xa2,
-0x2c,0x22,0x0f,0xfe,0x62,0x28,0x00,0x15,0x00,0x33,0xdc,0xff,0xa0,0x15,0x00,0x03,
-0x99,0x1a,0x00,0x15,0x00,0x04,0x68,0x49,0x23,0xfe,0x0f,0x31,0x41,0x01,0x15,0x00,
-0x13,0x40,0x15,0x00,0x40,0x00,0x00,0x38,0x84,0x82,0x2e,0x11,0x83,0xb4,0x05,0x13,
-0xa0,0x4e,0x6a,0x01,0xb8,0x2c,0x32,0x01,0xef,0xf2,0x1e,0x14,0x22,0x41,0x14,0x92,
-0x05,0x11,0x01,0x95,0x5f,0x02,0x66,0x03,0x54,0x8d,0xff,0xff,0xe8,0x10,0xc0,0x10,
-0x0b,0x14,0x0d,0x0f,0x65,0x01,0xfe,0x04,0xfd,0x48,0x13,0xf9,0x58,0x05,0x14,0x8f,
-0xe0,0x56,0x14,0x3f,0x9a,0x59,0x14,0x0d,0xe1,0x49,0x01,0x96,0x20,0x23,0xff,0xf5,
-0xf0,0x04,0x02,0xde,0x4e,0x13,0xfa,0x91,0x05,0x14,0x6f,0xae,0x51,0x02,0xdb,0x04,
-0x01,0x3e,0x4f,0x12,0x90,0xa3,0x05,0x12,0x1c,0x69,0x04,0x05,0xc6,0x04,0x15,0x0f,
-0xbf,0x04,0x01,0xb8,0x04,0x13,0x10,0xc9,0x05,0x23,0xef,0xf9,0xdd,0x05,0x15,0x05,
-0x7c,0x51,0x02,0x56,0x07,0x23,0xff,0xf5,0x06,0x2a,0x01,0x72,0x00,0x00,0xfa,0x4a,
-0x01,0x13,0x00,0x24,0x01,0xef,0xd9,0x49,0x01,0x87,0x04,0x03,0x29,0x4f,0x15,0xe0,
-0xbe,0x00,0x13,0x90,0xd1,0x00,0x14,0x9f,0xed,0x09,0x00,0x40,0x43,0x04,0x40,0x0a,
-0x16,0xf7,0x17,0x26,0x15,0xb0,0x2d,0x0a,0x02,0xe0,0x05,0x01,0xbb,0x07,0x14,0xb0,
-0xc5,0x62,0x02,0x81,0x2b,0x14,0xfd,0x8f,0x2a,0x02,0xf5,0x44,0x02,0xad,0x1a,0x14,
-0xf9,0x15,0x00,0x02,0x36,0x2d,0x24,0x9f,0xfb,0x72,0x08,0x12,0x09,0x6c,0x0c,0x13,
-0x30,0x15,0x00,0x02,0x88,0x2b,0x01,0x15,0x00,0x24,0x4f,0xff,0xc3,0x64,0x02,0xbd,
-0x3e,0x11,0x09,0x96,0x2d,0x14,0xfa,0x15,0x00,0x02,0xed,0x5e,0x01,0x15,0x00,0x24,
-0xef,0xf6,0x15,0x00,0x02,0x91,0x23,0x00,0x15,0x00,0x02,0xb8,0x08,0x01,0x15,0x00,
-0x13,0x7f,0x18,0x68,0x14,0xb0,0xe9,0x66,0x23,0x9f,0xfb,0x3d,0x47,0x01,0x15,0x00,
-0x14,0x7f,0xd7,0x34,0x24,0x00,0x3f,0x88,0x43,0x12,0xb9,0xde,0x6b,0x00,0x15,0x00,
-0x15,0xbf,0x77,0x1c,0x34,0xbb,0xff,0xc4,0x56,0x65,0x06,0x49,0x26,0x10,0x7f,0xf4,
-0x0a,0x15,0xfe,0x7f,0x06,0x23,0xf0,0x0f,0x2d,0x02,0x00,0xeb,0x09,0x54,0xf0,0x0f,
-0xfe,0xff,0xa0,0xc2,0x2e,0x52,0xf0,0x0f,0xfd,0xcf,0xf0,0xc8,0x1a,0x63,0xfc,0xef,
-0xf0,0x0f,0xfe,0x7f,0x1f,0x0b,0x10,0xf8,0x27,0x00,0x23,0x2f,0xfb,0xbe,0x6a,0x00,
-0x0d,0x00,0x12,0x0d,0x90,0x00,0x20,0xef,0xe0,0x0d,0x00,0x10,0x08,0x2f,0x01,0x00,
-0x42,0x46,0x00,0x5b,0x00,0x13,0x02,0x72,0x63,0x10,0x20,0x0d,0x00,0x01,0x2f,0x66,
-0x00,0x22,0x30,0x01,0x0d,0x00,0x11,0x6f,0xdd,0x66,0x12,0xf7,0x0d,0x00,0x21,0x1f,
-0xfe,0x0e,0x30,0x02,0x0d,0x00,0x00,0x98,0x6d,0x00,0x33,0x6b,0x00,0x0d,0x00,0x00,
-0x6c,0x40,0x41,0x00,0x07,0xff,0x60,0x0d,0x00,0x00,0x1e,0x1b,0x01,0x3f,0x6b,0x01,
-0x0d,0x00,0x00,0xe2,0x11,0x23,0x3f,0xfa,0x0d,0x00,0x00,0xfc,0x15,0x23,0x8f,0xf4,
-0x0d,0x00,0x00,0xf9,0x2f,0x24,0xef,0xe0,0x0d,0x00,0x54,0x08,0xff,0x53,0xff,0x90,
-0x0d,0x00,0x54,0x02,0xff,0xa8,0xff,0x30,0x0d,0x00,0x54,0x00,0xcf,0xec,0xfd,0x00,
-0x0d,0x00,0x00,0xe0,0x57,0x06,0x0d,0x00,0x36,0x1f,0xff,0xf2,0x0d,0x00,0x02,0x9b,
-0x0e,0x03,0x0d,0x00,0x11,0x04,0xa6,0x04,0x05,0x39,0x0c,0x00,0xc9,0x0e,0x0f,0x0b,
-0x00,0x5d,0x03,0xe9,0x15,0x06,0x70,0x5a,0x1b,0xff,0x0b,0x00,0x0f,0x9a,0x00,0x66,
-0x05,0x0b,0x00,0x0b,0x6c,0x12,0x03,0x6d,0x12,0x01,0x98,0x5f,0x01,0x7a,0x3f,0x12,
-0xee,0xd7,0x6b,0x00,0x7d,0x27,0x20,0xd7,0x20,0x98,0x58,0x00,0x2e,0x26,0x13,0x0d,
-0xa5,0x02,0x10,0x9f,0x36,0x02,0x01,0x52,0x37,0x01,0x8a,0x02,0x35,0xf8,0x00,0x01,
-0xa0,0x21,0x10,0xcf,0xcf,0x18,0x15,0xf2,0xee,0x07,0x14,0x70,0xe7,0x08,0x03,0xef,
-0x5d,0x15,0x80,0x72,0x5f,0x15,0xf0,0x85,0x09,0x00,0x3b,0x08,0x14,0x3f,0xef,0x10,
-0x00,0x06,0x43,0x04,0x00,0x25,0x01,0xea,0x04,0x09,0x0d,0x00,0x09,0x27,0x00,0x02,
-0xa8,0x4a,0x05,0x33,0x5c,0x06,0x5b,0x00,0x24,0xe0,0x0b,0xe9,0x12,0x00,0x08,0x47,
-0x15,0x06,0x02,0x13,0x00,0x1f,0x4b,0x06,0xc8,0x2c,0x16,0xfe,0x62,0x74,0x01,0x91,
-0x59,0x04,0xc7,0x48,0x11,0x8f,0x66,0x13,0x10,0xdf,0x3f,0x64,0x21,0x02,0x6d,0x44,
-0x27,0x00,0x7f,0x13,0x23,0xfe,0xdd,0x00,0x6b,0x09,0x98,0x13,0x03,0x45,0x01,0x14,
-0x94,0xf1,0x2d,0x03,0x9a,0x69,0x09,0x0b,0x00,0x13,0xfe,0xb6,0x46,0x14,0xf0,0x8a,
-0x50,0x1f,0x05,0x0b,0x00,0xe1,0x02,0xff,0x02,0x26,0xed,0x94,0x1b,0x10,0x22,0xfd,
-0x20,0x99,0x10,0x20,0xcc,0xef,0xec,0x12,0x02,0x3d,0x05,0x00,0xce,0x58,0x05,0xf1,
-0x4f,0x05,0xb7,0x57,0x06,0x08,0x5e,0x00,0x9d,0x12,0x2c,0xff,0xf5,0xcf,0x02,0x0e,
-0x30,0x10,0x01,0x2e,0x2b,0x15,0x00,0xbe,0x54,0x15,0x60,0x30,0x10,0x80,0xc0,0x00,
-0xff,0xfd,0xbb,0xbb,0xbb,0xcd,0xa6,0x1d,0x04,0x92,0x03,0x15,0xb1,0x30,0x10,0x2f,
-0x30,0x00,0x28,0x0d,0x4e,0x09,0xa9,0x1e,0x05,0x3c,0x02,0x0f,0xed,0x15,0x02,0x11,
-0xa0,0xed,0x15,0x76,0xe7,0x20,0x00,0x03,0x8f,0xff,0xfb,0xed,0x15,0x00,0xd4,0x2f,
-0x04,0xb9,0x02,0x00,0x8d,0x4a,0x04,0xcc,0x48,0x36,0x03,0xfe,0x92,0x27,0x1f,0x10,
-0x30,0x0b,0x2e,0x07,0x99,0x15,0x1f,0xa0,0xed,0x15,0x04,0x06,0x92,0x1d,0x06,0x8f,
-0x03,0x0a,0x0c,0x00,0x08,0x24,0x00,0x02,0x6e,0x41,0x0e,0xed,0x15,0x04,0x84,0x4e,
-0x05,0xb0,0x4a,0x02,0x85,0x28,0x13,0x40,0xbb,0x4b,0x0a,0xed,0x15,0x11,0x0c,0xed,
-0x15,0x2a,0xfc,0x10,0xed,0x15,0x16,0x03,0xed,0x15,0x1a,0xed,0xed,0x15,0x15,0xb2,
-0x2c,0x01,0x29,0xeb,0x82,0x89,0x1f,0x17,0xf2,0x0b,0x00,0xb4,0x2d,0xdd,0xdd,0xdd,
-0xdf,0xff,0xfd,0xdd,0xdd,0xdd,0xd2,0xfa,0x0d,0x05,0x2f,0x0c,0x0f,0x0b,0x00,0xd9,
-0x16,0x0b,0x5c,0x4f,0x15,0xc0,0x8f,0x4a,0x10,0x4f,0x12,0x24,0x04,0x1d,0x37,0x12,
-0xfc,0x55,0x3d,0x02,0x7a,0x6f,0x04,0x45,0x2c,0x03,0x55,0x0d,0x26,0xdf,0xfd,0xc0,
-0x0d,0x02,0x44,0x21,0x23,0xaf,0xfb,0x57,0x30,0x05,0xe3,0x70,0x01,0x81,0x2c,0x02,
-0xc4,0x24,0x02,0x83,0x3b,0x04,0xb2,0x2c,0x00,0x68,0x35,0x02,0x4c,0x09,0x01,0xc0,
-0x3d,0x02,0x99,0x75,0x02,0x5b,0x37,0x03,0x08,0x65,0x01,0xbe,0x01,0x15,0x4e,0xd0,
-0x05,0x17,0x09,0xb5,0x35,0x15,0x01,0x86,0x27,0x08,0xf9,0x79,0x04,0x39,0x34,0x04,
-0x9d,0x0f,0x17,0xf9,0xf7,0x12,0x17,0xf1,0xb4,0x20,0x16,0x80,0x19,0x22,0x04,0x89,
-0x66,0x26,0x39,0x10,0x89,0x02,0x21,0xcf,0xfd,0x52,0x0a,0x03,0x35,0x2f,0x06,0x33,
-0x66,0x28,0x39,0xdf,0x4e,0x1d,0x0a,0x9d,0x03,0x0f,0x0c,0x00,0x03,0x67,0x25,0x78,
-0xff,0xfb,0x76,0x30,0xb1,0x03,0x23,0xff,0x92,0x30,0x07,0x02,0x15,0x10,0x00,0xb1,
-0x03,0x82,0xa4,0x10,0xff,0xf5,0x13,0x8e,0xff,0xf5,0xc6,0x41,0x02,0x37,0x5d,0x10,
-0x10,0x94,0x4d,0x03,0x4a,0x0b,0x33,0x80,0x8f,0xfe,0x54,0x00,0x00,0x91,0x54,0x03,
-0xc1,0x0b,0x00,0xc3,0x06,0x01,0x48,0x17,0x02,0xe0,0x0b,0x32,0xf3,0xef,0xf7,0x0c,
-0x00,0x00,0x97,0x0f,0x17,0xef,0x18,0x00,0x25,0xcf,0xf9,0xa0,0x5d,0x32,0xf2,0x8f,
-0xfd,0x0c,0x00,0x00,0x10,0x11,0x11,0x3f,0x35,0x09,0x11,0xf5,0x2e,0x0c,0x01,0xb7,
-0x0b,0x21,0xff,0xf5,0x41,0x39,0x31,0x02,0xff,0xfd,0x5c,0x05,0x12,0x19,0x99,0x3e,
-0x51,0xfc,0x98,0xff,0xfa,0x8b,0x4f,0x18,0x23,0x02,0xdf,0x9d,0x70,0x02,0x9d,0x56,
-0x00,0xff,0x04,0x2f,0xb7,0x10,0x08,0x01,0x16,0x05,0x0c,0x00,0x36,0x02,0xff,0xf9,
-0xde,0x72,0x03,0x42,0x38,0x01,0xc2,0x39,0x03,0x83,0x07,0x11,0x0c,0x12,0x1c,0x02,
-0x5c,0x0c,0x02,0x8e,0x36,0x12,0x5f,0xd5,0x77,0x15,0xf7,0x58,0x02,0x04,0x22,0x08,
-0x24,0xef,0xf9,0x23,0x00,0x01,0xb2,0x02,0x03,0xe0,0x39,0x01,0xba,0x79,0x03,0x0b,
-0x32,0x01,0x2b,0x5a,0x04,0xcc,0x11,0x01,0x8b,0x11,0x17,0xf5,0x22,0x34,0x17,0xa0,
-0x6b,0x22,0x17,0x30,0x18,0x00,0x17,0xc0,0xbb,0x11,0x06,0xd3,0x61,0x47,0xfa,0x7f,
-0xff,0x30,0x60,0x00,0x15,0xd0,0x2a,0x03,0x02,0x80,0x3a,0x03,0xb5,0x00,0x03,0x25,
-0x00,0x03,0xa8,0x00,0x03,0x27,0x35,0x13,0x40,0xe3,0x00,0x06,0xd8,0x00,0x17,0x30,
-0xf0,0x00,0x15,0xd0,0x36,0x00,0x00,0x1c,0x01,0x04,0x4e,0x00,0x00,0x14,0x00,0x14,
-0x0d,0x66,0x00,0x14,0x0c,0xc0,0x66,0x02,0x44,0x37,0x0f,0x0c,0x00,0xf7,0x04,0xe1,
-0x4f,0x37,0xfe,0xee,0x0f,0xf5,0x24,0x08,0x0c,0x00,0x08,0xc5,0x25,0x0f,0x0c,0x00,
-0x41,0x02,0xbe,0x42,0x00,0x5d,0x08,0x0f,0x0a,0x00,0x51,0x02,0x2a,0x13,0x00,0x0a,
-0x00,0x02,0x53,0x1d,0x00,0x0a,0x00,0x02,0x26,0x02,0x00,0x0a,0x00,0xc4,0x07,0xff,
-0xfd,0x51,0x00,0x12,0x57,0xae,0xff,0xf1,0x00,0xcf,0x3b,0x0c,0x03,0x12,0x64,0x10,
-0xfd,0xff,0x04,0x65,0x26,0xab,0xcb,0xa8,0x63,0x04,0x09,0x05,0x0f,0x0a,0x00,0x36,
-0x02,0x94,0x01,0x02,0x79,0x05,0x13,0x3f,0x70,0x09,0x01,0x47,0x20,0x00,0x94,0x0f,
-0x0f,0x1d,0x00,0xff,0x20,0x02,0xf1,0x6b,0x02,0x06,0x00,0x03,0x07,0x0b,0x05,0xce,
-0x02,0x09,0x0e,0x00,0x03,0x3a,0x00,0x02,0x12,0x34,0x03,0x3c,0x06,0x04,0x22,0x19,
-0x00,0x72,0x21,0x0f,0x1f,0x00,0xff,0x35,0x13,0xfe,0x63,0x04,0x01,0x41,0x5b,0x1a,
-0xe4,0x91,0x01,0x2a,0xff,0x50,0x0f,0x00,0x1b,0xf5,0xc9,0x38,0x0a,0xf2,0x38,0x1f,
-0xdf,0x1f,0x00,0x4b,0x0f,0xad,0x5f,0x51,0x0b,0xd0,0x1e,0x36,0xcc,0xb9,0x50,0x33,
-0x1d,0x1d,0x80,0xd0,0x1e,0x27,0x27,0xef,0xd0,0x1e,0x1f,0xf3,0xd0,0x1e,0x26,0x3f,
-0x07,0xff,0xf2,0xd0,0x1e,0x17,0x02,0x3c,0x00,0x14,0x38,0x2a,0x0d,0x27,0xff,0xf5,
-0x26,0x31,0x25,0x40,0x00,0xcc,0x66,0x02,0x33,0x0d,0x15,0x80,0xff,0x01,0x00,0x5a,
-0x5d,0x15,0x38,0x1c,0x5f,0x12,0x04,0xed,0x36,0x24,0x02,0xdf,0x85,0x1e,0x33,0xdf,
-0xfe,0x20,0xec,0x57,0x02,0x21,0x00,0x08,0x8c,0x7b,0x00,0x21,0x00,0x1c,0x0b,0xac,
-0x07,0x05,0xc3,0x22,0x12,0x6f,0x6d,0x0e,0x14,0x3f,0x23,0x0d,0x12,0x02,0x9c,0x61,
-0x02,0x33,0x45,0x03,0x25,0x0d,0x0a,0xac,0x06,0x22,0xdf,0xf9,0xd0,0x00,0x25,0xe0,
-0x00,0x47,0x77,0x00,0x7f,0x02,0x0a,0x21,0x00,0x14,0x50,0xa6,0x5b,0x02,0x69,0x60,
-0x00,0x63,0x00,0x04,0x0a,0x6e,0x04,0x96,0x64,0x03,0xf1,0x1c,0x02,0xa0,0x0d,0x10,
-0xff,0xf6,0x59,0x04,0x28,0x0b,0x13,0x06,0xb5,0x05,0x15,0xaf,0x37,0x14,0x02,0xfd,
-0x0e,0x05,0x79,0x23,0x33,0x4f,0xff,0x50,0xa2,0x5f,0x13,0xf3,0xa6,0x7c,0x23,0xd0,
-0x00,0xb4,0x48,0x12,0xe3,0x10,0x00,0x04,0x9e,0x62,0x34,0x6f,0xff,0xf9,0x7a,0x23,
-0x02,0x6f,0x00,0x12,0x6f,0xfa,0x19,0x15,0xf6,0x8c,0x01,0x15,0x3c,0x83,0x23,0x25,
-0xff,0xf5,0x8e,0x73,0x13,0xc8,0x4d,0x09,0x23,0x6a,0xdf,0x12,0x6c,0x24,0x00,0x05,
-0x10,0x2e,0x00,0xe0,0x5a,0x02,0x9d,0x1c,0x74,0xdf,0xff,0x10,0x03,0xff,0xff,0x61,
-0x71,0x06,0x15,0xbf,0xed,0x09,0x13,0x10,0x1a,0x45,0x00,0x17,0x00,0x04,0x35,0x1a,
-0x00,0x17,0x00,0x02,0xcd,0x45,0x01,0x17,0x00,0x05,0xa2,0x06,0x10,0x4f,0x4d,0x0b,
-0x15,0x40,0xb6,0x06,0x25,0xef,0xfa,0x17,0x00,0x04,0x57,0x6b,0x00,0x17,0x00,0x43,
-0x0d,0xff,0xfb,0x41,0x17,0x00,0x06,0x9f,0x0b,0x17,0xf1,0x8f,0x22,0x01,0x45,0x44,
-0x00,0x6d,0x51,0x13,0xcd,0x32,0x3f,0x13,0x80,0x2e,0x00,0x03,0xfb,0x01,0x01,0x70,
-0x00,0x03,0x50,0x0f,0x11,0x4f,0xf2,0x18,0x15,0xfa,0x29,0x07,0x02,0x35,0x17,0x01,
-0x17,0x00,0x15,0x5f,0xb8,0x07,0x04,0xdd,0x42,0x00,0x17,0x00,0x03,0x56,0x58,0x00,
-0x17,0x00,0x34,0x05,0xff,0xf8,0xa1,0x00,0x37,0x11,0xef,0xfd,0x6e,0x07,0x23,0x28,
-0xce,0x65,0x4b,0x15,0x08,0x51,0x64,0x73,0x8f,0xff,0xd9,0x88,0xaf,0xff,0xe2,0x56,
-0x0b,0x34,0x02,0xef,0xfa,0xeb,0x1c,0x00,0xfc,0x38,0x39,0x01,0x34,0x40,0x0f,0x0d,
-0x03,0xc9,0x78,0x31,0x12,0x34,0x44,0x36,0x46,0x24,0x03,0xae,0x65,0x3d,0x13,0x9f,
-0x6f,0x3d,0x00,0xdc,0x7e,0x12,0x52,0x28,0x00,0x33,0x0f,0xff,0xb0,0x32,0x00,0x12,
-0x4f,0x72,0x45,0x00,0xad,0x0b,0x13,0xfd,0x6b,0x61,0x03,0xcd,0x16,0x00,0xb9,0x5a,
-0x22,0x5f,0xff,0x3c,0x03,0x12,0x40,0xab,0x46,0xf1,0x00,0x8f,0xad,0xff,0x70,0x00,
-0x0a,0xff,0xfb,0x76,0x9e,0xfd,0x1a,0xff,0xf7,0x60,0xe4,0x19,0x20,0xd1,0x04,0xd5,
-0x36,0x93,0x07,0xcf,0xfd,0xb5,0x00,0x00,0x5d,0xfe,0xa0,0x56,0x0d,0x21,0x58,0x20,
-0x80,0x3f,0x11,0xad,0x81,0x00,0x23,0x02,0x9f,0x8a,0x00,0x00,0xe8,0x2e,0x92,0xdb,
-0x86,0x10,0x00,0x09,0xff,0xfe,0xa6,0x30,0x2c,0x7c,0x04,0xca,0x16,0x13,0xa0,0x7c,
-0x0b,0x05,0x8a,0x31,0x14,0xf7,0x83,0x09,0x31,0xf2,0x00,0x6b,0xa4,0x76,0x32,0x6f,
-0xf0,0x2d,0xcb,0x4b,0xc0,0x9f,0xd1,0xef,0xd8,0x77,0xaf,0xff,0xf5,0x00,0xbf,0xba,
-0xf7,0xc3,0x03,0x52,0xfe,0x00,0xcf,0xdf,0x80,0xce,0x13,0x01,0x4a,0x5c,0x00,0xa9,
-0x19,0x01,0xe5,0x2e,0x00,0xb6,0x4f,0x23,0xdf,0xf9,0x70,0x12,0x01,0xbd,0x7a,0x00,
-0xb3,0x17,0x01,0xba,0x76,0x00,0x84,0x45,0x14,0xaf,0x12,0x00,0x14,0x8f,0x24,0x00,
-0x02,0x09,0x58,0x10,0x08,0x5e,0x12,0x03,0x98,0x03,0x02,0x88,0x39,0x10,0x3f,0x1e,
-0x25,0x10,0xf5,0x82,0x01,0x10,0xfb,0xc5,0x00,0x21,0xc8,0x67,0xc2,0x66,0x04,0x94,
-0x7e,0x00,0xbb,0x01,0x01,0xe3,0x65,0x00,0xcf,0x29,0x00,0x35,0x4a,0x13,0x8f,0x2b,
-0x06,0x80,0x8f,0xfd,0x88,0x88,0x8b,0xff,0xff,0x30,0x05,0x0f,0x00,0xb5,0x67,0x23,
-0x8f,0xfa,0x38,0x56,0x12,0xfa,0xe1,0x0a,0x01,0x08,0x00,0x13,0x07,0x18,0x00,0xa2,
-0x1d,0xff,0x40,0x8f,0xfc,0x55,0x55,0x69,0xef,0xf5,0x40,0x00,0x14,0xf9,0x48,0x00,
-0x10,0xe8,0x45,0x0f,0x00,0x71,0x15,0x32,0xa0,0x8f,0xfa,0xe8,0x14,0x22,0x8f,0xfa,
-0x9b,0x25,0x22,0x8f,0xfa,0x6e,0x25,0x22,0x8f,0xfa,0x10,0x54,0x02,0x60,0x00,0x00,
-0x86,0x4c,0x40,0x66,0x66,0x68,0xcf,0x4b,0x56,0x12,0xff,0x51,0x4e,0x01,0xf8,0x70,
-0x12,0x20,0x50,0x00,0x11,0x18,0xf9,0x02,0x00,0x23,0x00,0x11,0x66,0xf0,0x48,0x02,
-0xa3,0x0f,0x0f,0x0b,0x00,0x40,0x03,0x96,0x4d,0x02,0xe4,0x1a,0x12,0x0b,0x74,0x23,
-0x02,0xb0,0x00,0x44,0x66,0x66,0x9f,0xfd,0x35,0x81,0x13,0x05,0x8d,0x1e,0x14,0xf0,
-0xb7,0x7c,0x22,0x3f,0xfd,0x5b,0x7f,0x00,0x22,0x01,0x14,0xa0,0x15,0x00,0x24,0x9f,
-0xf8,0x15,0x00,0x21,0x0b,0xff,0x27,0x38,0x02,0xdb,0x5e,0x04,0x15,0x00,0x24,0x2f,
-0xff,0x15,0x1a,0x00,0xb2,0x7f,0x03,0x15,0x00,0x24,0xaf,0xf8,0x15,0x00,0x01,0x77,
-0x2a,0x01,0x15,0x00,0x02,0x44,0x1a,0x24,0x5f,0xfd,0x1f,0x1a,0x01,0x15,0x00,0x03,
-0x8d,0x64,0xe5,0xfd,0x00,0x03,0x6a,0xff,0xf6,0x66,0x66,0x66,0x69,0xff,0xe6,0x62,
-0xaf,0xf2,0x07,0x25,0x6a,0xff,0xb7,0x7f,0x15,0xaf,0x23,0x7d,0x14,0x6a,0x2c,0x0e,
-0x1f,0x7f,0x15,0x00,0x2d,0x01,0x6c,0x0f,0x01,0xf8,0x03,0x02,0xc7,0x7c,0x11,0x40,
-0x72,0x3c,0x40,0x77,0x9e,0xff,0xf4,0x01,0x65,0x11,0x10,0xc3,0x05,0x02,0xa4,0x2b,
-0x10,0x0d,0x10,0x34,0x12,0x60,0x68,0x59,0x02,0x2b,0x4a,0x10,0x01,0x18,0x53,0x03,
-0xe6,0x7b,0x14,0x6f,0xa1,0x08,0x14,0x7f,0xae,0x00,0x31,0x6f,0xfe,0x88,0x01,0x00,
-0x15,0x83,0xc0,0x7d,0x16,0x4f,0x08,0x2b,0x19,0x30,0xc6,0x7f,0x10,0x51,0x82,0x07,
-0x03,0x8c,0x87,0x10,0xdf,0x76,0x29,0x11,0x6f,0x38,0x39,0x53,0xfb,0x87,0x9d,0xff,
-0xfa,0x99,0x00,0x23,0xff,0x80,0xb4,0x66,0x13,0x82,0x7d,0x80,0x21,0x8f,0xfa,0xd1,
-0x58,0x11,0x0c,0x18,0x04,0x11,0xfa,0x4b,0x01,0x01,0xae,0x6b,0x22,0x8f,0xfa,0x71,
-0x01,0x22,0x9f,0xf9,0x0c,0x00,0x02,0x10,0x00,0x10,0x20,0x08,0x00,0x32,0x02,0xff,
-0xe1,0xab,0x5b,0x22,0x8f,0xfa,0x64,0x5a,0x00,0xbf,0x5b,0x23,0x8f,0xfa,0x08,0x2c,
-0x53,0x1f,0xfe,0x10,0x8f,0xfa,0x48,0x1e,0x63,0x05,0xff,0xd3,0x8f,0xfa,0x2c,0x99,
-0x14,0x15,0xdf,0x32,0x3e,0x04,0x5d,0x3e,0x12,0x70,0x15,0x07,0x43,0x44,0xbf,0xfc,
-0x43,0x39,0x57,0x10,0xfb,0x48,0x00,0x22,0xaf,0xf9,0xd3,0x7d,0x00,0x0c,0x00,0x12,
-0x1f,0x84,0x0f,0x10,0xa0,0x0c,0x00,0x00,0xe3,0x4f,0x00,0xe9,0x04,0x00,0x0c,0x00,
-0x32,0x01,0xef,0xf5,0xa1,0x28,0x21,0x8f,0xfa,0x30,0x20,0x01,0x24,0x22,0x02,0xa4,
-0x00,0x23,0x80,0x1e,0xcc,0x00,0x00,0x3f,0x07,0x24,0x9f,0xfe,0xe4,0x00,0x00,0xd7,
-0x3a,0x12,0x5b,0x67,0x66,0x13,0x1c,0xdc,0x84,0x61,0xbf,0xff,0xa8,0x7a,0xff,0xfe,
-0x4d,0x35,0x00,0x0a,0x1d,0x35,0x03,0xab,0x60,0xd7,0x24,0x05,0x04,0x56,0x12,0x1e,
-0x62,0x16,0x32,0x37,0xef,0xfb,0x5a,0x1d,0x22,0xfe,0x80,0x08,0x00,0x11,0xe8,0x1a,
-0x05,0x14,0x89,0xf4,0x1b,0x03,0x99,0x47,0x03,0x53,0x10,0x03,0x0c,0x06,0x12,0x14,
-0x08,0x00,0x00,0xab,0x8e,0x00,0x06,0x08,0x00,0x05,0x68,0x00,0x5c,0x51,0x50,0x01,
-0xef,0xff,0xa7,0x7a,0x07,0x32,0x23,0x3e,0xff,0x1e,0x41,0x11,0x6b,0x98,0x00,0x22,
-0x8f,0xf9,0x5d,0x10,0x01,0x08,0x00,0x13,0x0a,0x08,0x00,0x13,0x3f,0x08,0x00,0x12,
-0xcf,0x08,0x00,0x31,0x04,0xff,0xdf,0x08,0x00,0x31,0x0d,0xfe,0x6f,0x08,0x00,0x31,
-0x6f,0xf7,0x5f,0x08,0x00,0x20,0xef,0xd0,0x10,0x00,0x00,0xea,0x86,0x00,0x08,0x00,
-0x00,0x15,0x4a,0x40,0x6f,0xf9,0x8f,0xf8,0xe5,0x86,0x00,0x08,0x00,0x00,0x98,0x05,
-0x00,0x08,0x00,0x30,0x0a,0xff,0x10,0x08,0x00,0x41,0xf7,0x3f,0xf8,0x00,0x08,0x00,
-0x21,0xcf,0xe0,0x08,0x00,0x31,0xfb,0xff,0x60,0x08,0x00,0x01,0xe4,0x03,0x00,0x08,
-0x00,0x13,0xf4,0x08,0x00,0x13,0xb0,0x08,0x00,0x11,0x20,0x08,0x00,0x20,0x02,0x88,
-0x20,0x49,0x21,0x88,0x40,0x91,0x5c,0x10,0x08,0x72,0x09,0x12,0xf2,0xbb,0x4c,0x61,
-0x9f,0xfd,0x51,0x03,0xcf,0xfc,0x4d,0x22,0x02,0xae,0x76,0x51,0x7d,0xff,0xff,0xe9,
-0x10,0xc6,0x06,0x18,0x21,0xd0,0x37,0x0f,0xe0,0x00,0x8c,0x21,0x9f,0xf9,0x0b,0x03,
-0x21,0x9f,0xf9,0x9c,0x03,0x21,0x9f,0xf9,0xdd,0x00,0x01,0x00,0x03,0x10,0xf9,0x07,
-0x03,0x00,0xf7,0x02,0x21,0x9f,0xf9,0xf2,0x02,0x21,0x9f,0xf9,0x5e,0x4b,0x21,0x9f,
-0xf9,0xe8,0x02,0x31,0x9f,0xf9,0x3d,0x91,0x46,0x12,0xff,0xff,0x2e,0x02,0xe6,0x16,
-0x51,0x9f,0xfb,0x44,0xff,0xe1,0xdb,0x14,0x21,0xaf,0xf9,0x07,0x00,0x00,0xa3,0x49,
-0x21,0x9f,0xf9,0x62,0x15,0x21,0x9f,0xf9,0x55,0x1e,0x21,0x9f,0xf9,0x71,0x1e,0x02,
-0x69,0x00,0x32,0x70,0x9f,0xf9,0xb1,0x02,0x13,0xf9,0xac,0x02,0x14,0x02,0xad,0x0b,
-0x03,0x38,0x36,0x01,0x8f,0x6a,0x63,0xd6,0x66,0x66,0x6c,0xff,0x80,0x4b,0x01,0x23,
-0xaf,0xf8,0x61,0x40,0x01,0x95,0x2f,0x23,0xcf,0xf5,0x13,0x00,0x03,0xe6,0x27,0x13,
-0x80,0x20,0x5f,0x23,0xaf,0xf8,0xc8,0x7a,0x11,0x0a,0x1c,0x5e,0x13,0xc0,0x13,0x00,
-0x23,0x7f,0xf9,0x13,0x00,0x12,0x0a,0x10,0x16,0x13,0xf8,0x9c,0x5f,0x11,0x0a,0x1f,
-0x0c,0x03,0x22,0x85,0x13,0x03,0x46,0x1e,0x13,0x80,0x82,0x84,0x21,0xaf,0xf8,0x25,
-0x85,0x00,0x13,0x00,0x23,0x82,0x2a,0x7d,0x65,0x13,0xf8,0x01,0x1f,0x62,0x0a,0xff,
-0x8d,0xfe,0xb2,0x00,0x13,0x00,0x33,0x8f,0xff,0xf9,0x09,0x16,0x13,0x48,0x1f,0x0b,
-0x10,0xef,0x50,0x80,0x01,0x3b,0x00,0x10,0x3f,0x15,0x00,0x21,0xaf,0xf8,0x1f,0x00,
-0x60,0xbf,0xf4,0x8f,0xf8,0xdf,0xd0,0x1f,0x00,0x50,0xbb,0xff,0x48,0xff,0x88,0x88,
-0x01,0x20,0x3f,0xf6,0x15,0x00,0x20,0x3f,0xf7,0x62,0x02,0x70,0x1c,0xff,0x48,0xff,
-0x90,0xef,0xc0,0x24,0x7d,0x50,0xcf,0xf4,0x8f,0xf9,0x09,0x0f,0x5f,0x20,0xf7,0x0c,
-0x15,0x00,0x20,0x4f,0xf6,0xaf,0x8e,0x00,0x15,0x00,0x61,0x00,0xef,0xb0,0x00,0xcf,
-0xd0,0x15,0x00,0x61,0x09,0xff,0x10,0x1f,0xf8,0x00,0x15,0x00,0x51,0x4f,0xf5,0x06,
-0xff,0x30,0x15,0x00,0x52,0x00,0xff,0xa0,0xaf,0xd0,0x15,0x00,0x52,0x0a,0xfe,0x0f,
-0xf8,0x00,0x15,0x00,0x42,0x5f,0xf4,0xff,0x30,0x15,0x00,0x43,0x00,0xff,0xaf,0xe0,
-0x15,0x00,0x10,0x0a,0xb6,0x00,0x02,0x15,0x00,0x11,0x5f,0xc9,0x25,0x12,0x48,0xbf,
-0x1e,0x01,0x15,0x00,0x12,0xfa,0x82,0x5d,0x0f,0x08,0x00,0x26,0x00,0xa9,0x07,0x33,
-0x66,0xdf,0xf6,0x2b,0x32,0x06,0x08,0x00,0x0f,0x58,0x00,0x2d,0x03,0x08,0x00,0x01,
-0x4d,0x8e,0x01,0x1b,0x7b,0x05,0xd2,0x82,0x51,0x5f,0xff,0xea,0x77,0x9e,0x19,0x5c,
-0x21,0xfb,0x10,0x7f,0x6d,0x02,0xf1,0x5e,0x01,0x75,0x2d,0x12,0x70,0x54,0x1b,0x01,
-0x37,0x4c,0x00,0x6b,0x05,0x23,0x5f,0xff,0xfd,0x15,0x03,0x65,0x06,0x03,0xa0,0x51,
-0x00,0x1d,0x55,0x05,0x09,0x00,0x05,0x1b,0x00,0x14,0x4f,0x2d,0x00,0x02,0x80,0x06,
-0x10,0x02,0x9c,0x66,0x12,0x70,0x3f,0x2c,0x01,0xd7,0x0a,0x00,0x84,0x05,0x01,0x75,
-0x00,0x10,0x01,0x4c,0x4d,0x32,0x4f,0xff,0xe9,0x07,0x07,0x24,0x04,0xef,0x76,0x48,
-0x02,0xf8,0x8e,0x04,0x37,0x33,0x13,0xf8,0xea,0x06,0x01,0x23,0x01,0x32,0x67,0xff,
-0xf8,0xb0,0x31,0x11,0xff,0xda,0x00,0x1f,0x02,0x0f,0x00,0x5f,0x70,0xaf,0xf6,0x00,
-0x6c,0xef,0xeb,0x60,0x8a,0x91,0x11,0xcf,0x14,0x3a,0xa0,0x9f,0xf8,0xcf,0xfa,0x89,
-0xef,0xff,0xc0,0x09,0xff,0x78,0x35,0x10,0x9f,0x10,0x75,0x11,0xc0,0x8b,0x0d,0x02,
-0x71,0x27,0x10,0x05,0xec,0x4a,0x02,0x8e,0x07,0x13,0x39,0x92,0x23,0x03,0xe5,0x52,
-0x33,0x0d,0xff,0x79,0x7f,0x86,0x01,0x54,0x04,0x02,0x11,0x00,0x13,0xa0,0x11,0x00,
-0x03,0x73,0x56,0x13,0x59,0xf3,0x28,0x23,0xf3,0x9f,0x45,0x17,0x01,0x11,0x4c,0x00,
-0xb7,0x19,0x31,0x9f,0xfe,0xf7,0xd8,0x3c,0xa1,0x09,0xff,0x9d,0xfd,0x86,0x7c,0xff,
-0xfb,0x00,0x9f,0x58,0x58,0x10,0xfc,0x5b,0x3e,0x46,0x06,0xce,0xfe,0xb5,0x37,0x19,
-0x14,0x09,0x2f,0x0e,0x0f,0x11,0x00,0x20,0x01,0x5e,0x8a,0x24,0xc8,0x20,0x85,0x42,
-0x10,0x70,0x6e,0x04,0x51,0xfa,0x9b,0xef,0xff,0x70,0x99,0x51,0x00,0x36,0x02,0x12,
-0x07,0xfe,0x8f,0x12,0xf9,0x3d,0x4e,0x34,0x07,0xfe,0xb0,0xab,0x0c,0x03,0x37,0x23,
-0x06,0x59,0x86,0x05,0x84,0x34,0x04,0x9e,0x89,0x02,0x49,0x4e,0x07,0xb2,0x08,0x03,
-0x9e,0x86,0x22,0x33,0x30,0xb1,0x08,0x21,0x5f,0xfd,0xbb,0x47,0x00,0x6c,0x23,0x30,
-0x01,0xef,0xfc,0x50,0x0c,0x10,0xf2,0xca,0x27,0x25,0xb9,0xbe,0x9a,0x85,0x12,0xf7,
-0x4a,0x88,0x01,0xae,0x08,0x03,0x8e,0x2f,0x04,0x08,0x00,0x87,0x26,0x66,0x66,0x9f,
-0xfe,0x66,0x66,0x65,0x29,0x87,0x0f,0x08,0x00,0x6a,0x03,0x8c,0x72,0x43,0x9f,0xfc,
-0x5f,0xff,0x28,0x03,0x02,0x2c,0x3e,0x10,0x03,0xfa,0x62,0x12,0xb0,0x4f,0x0b,0x13,
-0x03,0xf8,0x8d,0x12,0x40,0x84,0x87,0x23,0x2f,0xfe,0xc1,0x12,0x23,0x8f,0xf9,0x02,
-0x0e,0x22,0xdf,0xf3,0xf7,0x1a,0x01,0xbf,0x23,0x00,0xd6,0x0a,0x01,0xc9,0x35,0x00,
-0x6d,0x48,0x02,0xf0,0x96,0x00,0x48,0x06,0x03,0x54,0x39,0x02,0xa6,0x34,0x00,0x4d,
-0x00,0x22,0xcf,0xf0,0x7e,0x01,0x32,0x92,0xff,0xa0,0x65,0x01,0x33,0xe7,0xff,0x40,
-0x8f,0x51,0x14,0xfe,0x0f,0x2b,0x14,0xf9,0x82,0x10,0x03,0xbd,0x0a,0x05,0x5d,0x80,
-0x02,0x36,0x24,0x08,0x4b,0x8a,0x14,0x5f,0x4b,0x88,0x04,0x62,0x52,0x13,0x1c,0x6e,
-0x2e,0x13,0x9a,0xee,0x94,0x12,0x0d,0x42,0x22,0x00,0xaa,0x00,0x18,0xd8,0x07,0x28,
-0x28,0x58,0x82,0xe8,0x12,0x2f,0xbf,0xf4,0x0e,0x00,0x3b,0x80,0x7d,0xfe,0xc7,0x10,
-0xaf,0xf4,0x03,0xad,0xfa,0x02,0x01,0x6a,0x08,0x42,0xd1,0xaf,0xf4,0x6f,0x4e,0x1f,
-0xa1,0xcf,0xff,0xb7,0x7b,0xfc,0xaf,0xf6,0xff,0x97,0x8d,0xcf,0x53,0x00,0x37,0x27,
-0x31,0xef,0xfe,0xd1,0x42,0x2b,0x12,0x0b,0x23,0x2f,0x02,0xf9,0x53,0x13,0x60,0x34,
-0x12,0x12,0xfd,0x58,0x1d,0x12,0x3f,0xa9,0x55,0x12,0xf9,0xbb,0x02,0x24,0x5f,0xff,
-0x1c,0x89,0x00,0x43,0x0e,0x22,0x6f,0xfe,0x5f,0x8c,0x02,0xe8,0x02,0x24,0x7f,0xfd,
-0xa5,0x66,0x00,0x71,0x0e,0x03,0x0e,0x00,0x12,0xf4,0xde,0x09,0x02,0x2a,0x00,0x13,
-0xbf,0x2a,0x00,0x06,0x46,0x00,0x00,0x60,0x05,0x06,0x62,0x00,0x00,0xbd,0x0a,0x15,
-0x1f,0x7e,0x00,0x00,0xdb,0x0e,0x12,0x0c,0xe3,0x26,0x21,0xff,0x40,0x35,0x51,0x01,
-0xe4,0x10,0x40,0x7f,0xef,0xfe,0xe2,0x34,0x7c,0x00,0x2f,0x07,0x20,0xc8,0x9d,0xd2,
-0x00,0x20,0xb8,0x9e,0x18,0x00,0x10,0x2e,0x57,0x09,0x01,0xee,0x00,0x00,0xb7,0x03,
-0x42,0x01,0x8d,0xff,0xd7,0x0a,0x01,0x1e,0xb4,0x6c,0x01,0x0f,0x0e,0x00,0x4d,0x01,
-0xb0,0x33,0x00,0x71,0x36,0x02,0x2a,0x34,0x00,0x9f,0x1c,0x23,0xaf,0xfb,0x2c,0x34,
-0x11,0x1e,0xed,0x12,0x12,0xd0,0x7d,0x64,0x02,0x1c,0x06,0x21,0xaf,0xf9,0xc0,0x0d,
-0x00,0x1c,0x00,0x14,0x34,0x00,0x19,0x13,0xcd,0xb6,0x0c,0x14,0xaf,0x42,0x11,0x15,
-0x1f,0xbd,0x64,0x04,0x8b,0x44,0x00,0x3d,0x5e,0x02,0x54,0x08,0x32,0x9a,0xff,0xa0,
-0xff,0x1d,0x11,0x11,0x1c,0x00,0x00,0xf7,0x0b,0x01,0x29,0x1c,0x11,0x0a,0x58,0x6d,
-0x12,0x90,0x10,0x0c,0x01,0x38,0x29,0x22,0xef,0xf6,0x66,0x29,0x02,0x6f,0x46,0x10,
-0x0d,0x61,0x6a,0x12,0x20,0x0d,0x1f,0x23,0x8f,0xfa,0xa9,0x30,0x0f,0x09,0x00,0x7e,
-0x01,0x15,0x08,0x44,0xff,0xf8,0x64,0x8f,0x90,0x15,0x05,0x09,0x00,0x04,0xe2,0x0d,
-0x0f,0x09,0x00,0x2d,0x21,0xdf,0xf5,0xb5,0x01,0x31,0x4d,0xff,0x50,0xc7,0x4c,0x0f,
-0x0f,0x00,0x1a,0x21,0xcf,0xf7,0x0f,0x00,0x10,0x4a,0xc8,0x0a,0x10,0x15,0xb1,0x25,
-0x70,0xfb,0xab,0xdf,0xff,0xff,0x40,0xaf,0xdb,0x42,0x83,0xff,0xf4,0x00,0x6c,0xff,
-0xda,0x61,0x0e,0x6a,0x04,0x12,0xef,0xb9,0x01,0x0f,0x0f,0x00,0x15,0x03,0x4a,0x11,
-0x01,0x09,0x03,0x31,0x68,0xff,0xa0,0x0f,0x45,0x06,0xcf,0x08,0x0f,0x19,0x00,0xa5,
-0x10,0xc6,0xbf,0x08,0x18,0xf6,0xe7,0x09,0x11,0xff,0xbe,0x5b,0x07,0x0c,0x00,0x02,
-0x32,0x00,0x03,0x65,0x97,0x22,0x30,0x08,0xef,0x32,0x17,0xf0,0x17,0x02,0x0f,0x1b,
-0x00,0xb3,0x00,0x0b,0x01,0x3a,0x68,0xff,0xf6,0xdd,0x02,0x07,0xed,0x44,0x0b,0xe6,
-0x02,0x02,0xb6,0x06,0x18,0xc0,0xff,0x3c,0x0f,0x1b,0x00,0x3f,0x04,0xc3,0x22,0x0f,
-0x08,0x00,0x26,0x44,0xfc,0x44,0x44,0x43,0xed,0x3d,0x43,0xfd,0x70,0x00,0x8f,0x24,
-0x44,0x21,0x8f,0xfa,0xcc,0x8b,0x13,0xa0,0x33,0x13,0x13,0xf0,0x4f,0x0a,0x13,0xf3,
-0x1d,0x88,0x01,0xec,0x02,0x00,0x58,0x39,0x22,0x8f,0xfa,0x76,0x18,0x00,0x48,0x00,
-0x31,0x58,0xef,0xff,0xc0,0x4b,0x01,0x18,0x6a,0x03,0xa3,0x21,0x02,0x38,0x00,0x43,
-0x8c,0xef,0xed,0x82,0x74,0x00,0x12,0x8f,0xff,0x0d,0x21,0x8f,0xfa,0x51,0x9a,0x41,
-0x87,0x8c,0xff,0xf8,0x0c,0x00,0x12,0x3f,0x11,0x8f,0x01,0x8e,0x14,0x22,0xaf,0xfd,
-0xdf,0x14,0x10,0x8f,0x8e,0x2b,0x03,0xba,0x06,0x14,0x8f,0x27,0x8f,0x11,0x01,0x74,
-0x00,0x03,0xc0,0x18,0x00,0xf7,0x8d,0x14,0xff,0x8c,0x0d,0x15,0xf6,0x0c,0x00,0x00,
-0xfd,0x60,0x35,0xfc,0x66,0x6a,0x0c,0x00,0x00,0x30,0x00,0x04,0x24,0x00,0x00,0x48,
-0x00,0x04,0x3c,0x00,0x13,0xfa,0xe9,0x35,0x12,0x02,0xc8,0x00,0x26,0xcf,0xf7,0xfa,
-0x14,0x12,0x6f,0x84,0x00,0x12,0x80,0x7d,0x11,0x11,0x90,0x4a,0x2e,0x21,0x8f,0xfa,
-0xe9,0x06,0x42,0x86,0x8d,0xff,0xf6,0xcc,0x00,0x13,0x5e,0xbe,0x61,0x13,0xfa,0xac,
-0x8c,0x02,0x69,0x8f,0x12,0xad,0x4a,0x4d,0x03,0xbd,0x4b,0x00,0x2a,0x83,0x30,0x65,
-0x55,0x56,0x2f,0x09,0x12,0xf3,0x57,0x03,0x12,0xef,0x31,0x10,0x03,0x40,0x1d,0x22,
-0x2f,0xff,0x2c,0x69,0x10,0x02,0x0b,0x49,0x02,0xb2,0x42,0x01,0xfe,0x24,0x00,0x11,
-0x00,0x83,0x02,0xff,0xfe,0x85,0x44,0x44,0x6f,0xff,0xfe,0x0c,0x00,0x05,0x30,0x02,
-0xc8,0x23,0x02,0xa6,0x5b,0x01,0xb0,0x03,0x11,0xdf,0xa6,0x23,0x02,0xfb,0x74,0x00,
-0x11,0x00,0x01,0x48,0x06,0x22,0x2f,0xff,0x15,0x27,0x07,0x55,0x00,0x01,0x1b,0x09,
-0x00,0xff,0x19,0x04,0x76,0x71,0x01,0xb1,0x0c,0x24,0xda,0x40,0x67,0x4c,0x10,0xb1,
-0x84,0x01,0x52,0xe9,0x78,0xbf,0xff,0xc0,0xf0,0x00,0x10,0x3f,0xb4,0x73,0x02,0xd1,
-0x92,0x02,0xfc,0x1b,0x34,0x01,0xdc,0xa2,0x76,0x8a,0x07,0x24,0x0b,0x32,0x66,0x66,
-0x66,0x00,0x65,0x02,0xa5,0x18,0x13,0x7f,0xb9,0x18,0x16,0x06,0xa3,0x22,0x05,0x26,
-0x75,0x01,0x3a,0x11,0x11,0x20,0x55,0x0d,0x00,0xeb,0x1c,0x13,0x7f,0x63,0x6d,0x40,
-0x00,0xef,0xfc,0x10,0xff,0x50,0x00,0x24,0x0b,0x20,0xa7,0x8b,0x3e,0x03,0x00,0x52,
-0x84,0x00,0xb9,0x8c,0x00,0x42,0x12,0x20,0xfd,0x93,0x1f,0x0a,0x00,0x02,0x00,0x24,
-0x11,0x11,0xed,0x0b,0x0f,0x02,0x00,0x13,0xb1,0x2f,0xfc,0x00,0x03,0xff,0xa2,0xff,
-0xc0,0x00,0x3f,0xfa,0x0b,0x00,0x6a,0xa0,0x55,0x40,0x00,0x15,0x53,0xd6,0x8f,0x15,
-0xf9,0x35,0x0c,0x0f,0x0b,0x00,0x50,0x07,0x01,0x00,0x2f,0xf5,0x00,0x01,0x00,0x29,
-0x04,0x33,0x43,0x17,0xde,0x14,0x00,0x77,0xf2,0xef,0x00,0xfa,0xef,0x00,0xea,0xe3,
-0x9b,0x0f,0x01,0x00,0x1f,0x4f,0x06,0x05,0x00,0x06,0x3c,0x00,0x25,0x2f,0xd0,0x00,
-0x01,0x00,0x3b,0x1f,0xc1,0x44,0x00,0x30,0x13,0xde,0x60,0x25,0x92,0x00,0xfd,0x00,
-0x00,0xdc,0xfb,0xe8,0xed,0x00,0x05,0x2d,0x00,0x0f,0x00,0x4f,0xfb,0xfd,0xf2,0xf7,
-0x2a,0x01,0x24,0x6f,0xf8,0x00,0xf9,0x00,0x00,0xf1,0x96,0x00,0x27,0x17,0xf9,0x4a,
-0x00,0x04,0x8f,0x00,0x07,0x01,0x00,0x1f,0xfb,0x4c,0x00,0x19,0x00,0x66,0x15,0x11,
-0xfa,0x4a,0x00,0x5f,0xfa,0x00,0xfa,0xf4,0xfa,0x34,0x01,0x30,0x15,0x06,0x88,0x00,
-0x11,0xfb,0x8b,0x00,0x2f,0xfb,0xf9,0x56,0x00,0x1d,0x11,0xbe,0x0e,0x02,0x15,0xb6,
-0x4a,0x00,0x62,0xf6,0xfa,0x00,0x00,0xfa,0xf9,0x04,0x00,0x0f,0x01,0x00,0x1f,0x13,
-0x05,0x28,0x01,0x2f,0x05,0xf8,0xda,0x00,0x2d,0x1f,0xfa,0x99,0x02,0x33,0x59,0xee,
-0x00,0x00,0x00,0xf7,0xcf,0x01,0x20,0xfa,0xf8,0x5e,0x00,0x2f,0xf5,0xee,0x45,0x00,
-0x18,0x14,0xa2,0xde,0x00,0x96,0xee,0x00,0x00,0xb3,0xf1,0xcf,0xd8,0x00,0xbd,0x1c,
-0x00,0x3f,0xf4,0xdb,0xe6,0x93,0x00,0x1c,0x00,0x29,0x8f,0x51,0xd9,0x00,0xc8,0x00,
-0x00,0x9b,0x00,0xcf,0xf9,0x00,0xfd,0xfc,0x00,0x00,0xfc,0x00,0x00,0x04,0x00,0x04,
-0xe5,0x00,0x25,0x6f,0xf4,0x00,0xf8,0xfa,0x00,0xf6,0x2f,0x01,0x31,0x10,0xea,0x46,
-0x02,0x1f,0xf3,0x3d,0x00,0x24,0x01,0x27,0x05,0xc0,0xc3,0xbf,0x00,0x00,0xea,0xf8,
-0xbd,0xfc,0x05,0x00,0x05,0x04,0x0f,0x02,0xdf,0xe0,0xe4,0x00,0xe1,0xe4,0xeb,0xdf,
-0x00,0xe5,0xec,0xf0,0xea,0xef,0xda,0x02,0x1a,0x66,0xc1,0xf6,0x00,0x00,0xeb,0xfc,
-0x5b,0x02,0x91,0xf3,0xf4,0x00,0x00,0xf3,0xf8,0x00,0x00,0xf8,0x31,0x9b,0x0f,0x4a,
-0x00,0x17,0x61,0x04,0x00,0xdd,0xef,0x00,0x00,0x29,0x0f,0x03,0x51,0x1e,0x63,0xf7,
-0xf7,0x00,0x00,0xf7,0xfa,0xbd,0x03,0x0f,0x76,0x01,0x1b,0x14,0xf3,0x13,0x04,0x15,
-0x04,0x1f,0x04,0x10,0xfa,0x50,0x02,0x1f,0xf7,0x95,0x04,0x1b,0xff,0x11,0x06,0xf2,
-0xc5,0xf1,0x00,0x00,0xe6,0xf8,0xe5,0xfc,0x05,0xe5,0x05,0x05,0x04,0x05,0x00,0x05,
-0xeb,0xee,0xfa,0xf5,0xee,0xf5,0xf0,0xfa,0xf5,0xfa,0x00,0xfa,0xf8,0x05,0x7b,0x01,
-0x1d,0x2a,0x04,0xf9,0x3b,0x03,0x10,0xfa,0x0c,0x04,0x1f,0xf8,0x85,0x03,0x23,0x1f,
-0xfb,0xd6,0x04,0x1c,0x0c,0x01,0x00,0x1f,0xed,0x1d,0x00,0x09,0x1f,0xfc,0xbc,0x05,
-0x1b,0x0f,0x01,0x00,0x08,0x3f,0xfd,0x00,0xfc,0x4d,0x00,0x17,0x1f,0xfd,0xea,0x06,
-0x36,0x1f,0xfc,0xde,0x00,0x36,0x1e,0x05,0xbf,0x07,0x17,0x05,0x6f,0x06,0x0f,0xe4,
-0x02,0x18,0x1f,0xe3,0xce,0x07,0x3c,0x0f,0x8b,0x05,0x31,0x1f,0xda,0x28,0x01,0x0b,
-0x2f,0xfa,0xfc,0x54,0x06,0x1a,0x1c,0xdd,0x6b,0x04,0x30,0xfb,0x04,0x00,0xeb,0x0b,
-0x3f,0x00,0x05,0x05,0xe1,0x00,0x62,0x17,0x04,0xd8,0x09,0x05,0xd5,0x00,0x2f,0xfc,
-0x04,0x01,0x02,0x1b,0x0e,0x26,0x64,0x0f,0xbc,0x01,0x42,0x1f,0xfa,0xf9,0x02,0x36,
-0x1f,0xfc,0x89,0x00,0x72,0x0f,0x01,0x00,0x06,0xde,0x13,0x00,0xfa,0x0d,0x00,0xf3,
-0xfa,0xf3,0xd3,0xe7,0xed,0x00,0xd3,0x5d,0x03,0x3f,0xf3,0xfa,0x06,0xe5,0x05,0x17,
-0x01,0xaf,0x00,0x7e,0xfa,0xe6,0xf3,0xfa,0xf3,0xe6,0xfa,0x2a,0x02,0x1f,0xf3,0x0c,
-0x05,0x16,0xe8,0xf3,0xf3,0xed,0xfa,0x00,0xed,0x00,0xed,0xd9,0xed,0xed,0xe7,0xe6,
-0xed,0x6d,0x02,0x11,0xfa,0x20,0x00,0x4f,0xfa,0x00,0xfa,0xed,0x19,0x01,0x12,0x73,
-0xd9,0xd9,0x00,0xf3,0xe0,0xf3,0xe0,0x15,0x0b,0x40,0xed,0xe0,0x00,0xe0,0x13,0x00,
-0xb0,0x00,0xe0,0x00,0x00,0xe0,0xe0,0xe0,0xd9,0xe0,0x00,0x00,0xe1,0x62,0x2f,0xe0,
-0xd9,0x3e,0x0a,0x1b,0x36,0xf3,0x00,0xec,0x3d,0x01,0x05,0x51,0x0a,0x1f,0x0d,0x10,
-0x07,0x1c,0x0f,0x57,0x03,0x33,0x10,0xfa,0x4d,0x00,0x35,0xfa,0x06,0x0d,0xd7,0x0a,
-0x18,0xf9,0x48,0x00,0x1f,0xfa,0x4b,0x00,0x1a,0x00,0x02,0x00,0x6f,0xf3,0xfa,0xfa,
-0x00,0xf3,0xfa,0x3e,0x03,0x30,0x4f,0xfa,0x00,0x06,0xec,0x4c,0x05,0x3b,0x0d,0x88,
-0x02,0x0f,0xc8,0x0d,0x21,0x01,0x99,0x00,0x09,0x3d,0x00,0x11,0x06,0x02,0x00,0x0f,
-0x2b,0x01,0x14,0x53,0xf3,0xf3,0xf3,0x00,0xfa,0xc3,0x01,0x37,0xe6,0xf3,0xf3,0xcc,
-0x01,0x1f,0xfa,0xc0,0x01,0x1c,0x71,0xd9,0xd9,0xfa,0xf3,0xe0,0xfa,0xf3,0x2e,0x03,
-0x30,0xe6,0x00,0xf3,0xe5,0x02,0x24,0xd3,0xe7,0x1d,0x00,0x1f,0xe7,0x16,0x08,0x12,
-0x05,0x94,0x00,0xc3,0x00,0xfa,0xed,0xfa,0xf3,0x00,0x00,0xed,0xed,0x00,0xe0,0xed,
-0xd9,0x00,0x1f,0x0d,0x55,0x02,0x21,0x73,0xed,0xed,0x06,0xfa,0xf3,0x00,0xe6,0x79,
-0x00,0x20,0xf3,0xe6,0x88,0x00,0x10,0xe0,0x8e,0x00,0x90,0xe7,0xe6,0xe7,0x00,0xd3,
-0xe0,0xe0,0x00,0xe0,0x0c,0x00,0x1f,0xe0,0xde,0x00,0x11,0x01,0xd3,0x00,0x14,0xed,
-0x4a,0x00,0xf0,0x01,0x00,0xf3,0xe0,0xe6,0xd3,0xd9,0xed,0xe0,0xe6,0xed,0xe6,0xd9,
-0xe6,0xe6,0xd9,0xe6,0x71,0x03,0x12,0xe6,0x7d,0x03,0x0f,0xde,0x00,0x0e,0x13,0xed,
-0x06,0x01,0x6e,0xe0,0xe6,0x00,0x00,0xf3,0xec,0x32,0x09,0x0f,0x88,0x0a,0x1c,0x01,
-0x96,0x00,0x1e,0xed,0x62,0x02,0x0f,0xa0,0x04,0x19,0x0b,0xc5,0x03,0x1f,0x0d,0xe8,
-0x02,0x36,0x0e,0xd2,0x02,0x0f,0x5c,0x00,0x16,0x00,0x33,0x05,0xbf,0xec,0xf3,0xf3,
-0x00,0xf3,0xc6,0x00,0x00,0xe6,0xd3,0xe6,0x8a,0x0a,0x29,0x40,0xe7,0xf3,0x00,0xe6,
-0x29,0x03,0x32,0xe0,0x00,0x00,0x7d,0x05,0x04,0x54,0x10,0x2f,0xe6,0xfa,0x19,0x09,
-0x3b,0x2f,0xf3,0xfa,0x37,0x0d,0x24,0x11,0xf3,0x8d,0x00,0x11,0xfa,0x07,0x00,0x00,
-0x05,0x00,0x00,0xb4,0x04,0x2f,0xed,0xed,0x4c,0x00,0x21,0x20,0xfa,0xfa,0x04,0x00,
-0x11,0xfa,0xff,0x01,0x02,0x01,0x05,0x21,0xf3,0xfa,0xfe,0x00,0x0f,0x94,0x00,0x23,
-0x14,0xf3,0x49,0x02,0x1d,0xf3,0x18,0x04,0x0f,0xd5,0x05,0x1e,0x15,0xf3,0xe4,0x02,
-0x22,0xed,0xfa,0x21,0x04,0x0f,0x51,0x02,0x30,0x1f,0x06,0x51,0x08,0x25,0x13,0xfa,
-0x21,0x01,0x04,0xdf,0x05,0x00,0x3a,0x01,0x0f,0x94,0x00,0x22,0x23,0x0d,0x0d,0x75,
-0x05,0x00,0x8d,0x00,0x00,0x09,0x00,0x2f,0x06,0x06,0x3c,0x03,0x39,0x1f,0xf3,0x94,
-0x02,0x28,0x1f,0xfa,0x5c,0x06,0x2b,0x06,0x0a,0x02,0x16,0xfa,0x4f,0x04,0x10,0xf3,
-0x54,0x02,0x0f,0x4a,0x00,0x27,0x01,0x94,0x00,0x17,0xec,0x4a,0x00,0x1f,0xfa,0x5c,
-0x04,0x2d,0x1f,0x06,0x9f,0x0c,0x28,0x11,0xfa,0x8d,0x02,0x15,0x13,0x9b,0x00,0x1f,
-0xfa,0x28,0x01,0x26,0x20,0xfa,0x06,0x4a,0x00,0x13,0x06,0xd8,0x00,0x11,0xf9,0x87,
-0x03,0x0f,0x2e,0x03,0x29,0x07,0xfc,0x01,0x12,0xf3,0x3f,0x03,0x0f,0x0c,0x04,0x23,
-0x01,0xd5,0x00,0x04,0x2a,0x08,0x00,0x0c,0x00,0x0f,0xbc,0x01,0x26,0x09,0x4a,0x00,
-0x0f,0x32,0x05,0x34,0x01,0xb6,0x2e,0x0f,0x6d,0x06,0x35,0x11,0xd3,0x52,0x13,0x0f,
-0xe4,0x02,0x27,0x04,0x6c,0x01,0x02,0x0c,0x02,0x11,0xf3,0xff,0xb2,0x11,0x02,0x4b,
-0x30,0x21,0x03,0x00,0x99,0x13,0x0e,0x65,0x0e,0x02,0x4c,0xba,0x20,0x00,0x0c,0x4e,
-0xba,0x92,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x53,0xba,0x01,0x20,0x00,
-0x00,0x58,0xba,0x40,0x1d,0x1e,0x00,0x1f,0x0d,0x6e,0xff,0x00,0x1f,0x1f,0x21,0x1b,
-0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x87,0x00,0x03,0xf2,0x29,
-0x29,0x2a,0x2b,0x2c,0x2d,0x2e,0x2f,0x30,0x00,0x00,0x31,0x32,0x33,0x00,0x34,0x00,
-0x35,0x36,0x37,0x38,0x39,0x3a,0x3b,0x00,0x00,0x3c,0x3d,0x3e,0x00,0x3f,0x40,0x41,
-0x42,0x00,0x43,0x44,0x45,0x00,0x00,0x46,0x47,0x48,0x00,0x49,0x00,0x4a,0x4b,0x4c,
-0x4d,0x4e,0x4f,0x50,0x00,0x00,0x51,0x52,0x23,0x19,0x02,0xb0,0x00,0x20,0x03,0x02,
-0xab,0x00,0x4b,0x06,0x07,0x06,0x08,0x5d,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,
-0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0x24,0x0b,0x00,0x07,0xbb,0x30,0x00,0x00,
-0x15,0x0f,0x92,0x62,0x00,0x17,0x17,0x17,0x18,0x17,0xa3,0x6d,0xff,0x01,0x19,0x1a,
-0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0xb0,0x00,
-0x01,0x10,0x24,0xb1,0x3e,0x30,0x00,0x26,0x27,0xb2,0x30,0x52,0x29,0x00,0x2a,0x2b,
-0x00,0xbe,0x00,0x01,0xd8,0x6d,0x33,0x32,0x33,0x34,0xbf,0x00,0xf0,0x08,0x3c,0x3d,
-0x3e,0x3f,0x40,0x41,0x3d,0x42,0x43,0x44,0x45,0x46,0x47,0x36,0x48,0x36,0x3d,0x49,
-0x3b,0x4a,0x00,0x00,0x00,
+0x0a,0x46,0x00,0x37,0x02,0xdf,0xf5,0x62,0x00,0x36,0x5f,0xfd,0x20,0x0e,0x00,0x16,
+0x09,0xea,0x04,0x01,0xa8,0x00,0x16,0xf1,0x0e,0x00,0x27,0x4e,0xff,0xb6,0x00,0x64,
+0x58,0xff,0xca,0xff,0xff,0x80,0x0e,0x00,0x45,0xef,0xf9,0x00,0xef,0xc5,0x00,0x30,
+0xcf,0xff,0x50,0x0a,0x01,0x13,0xd4,0x0e,0x00,0x12,0xd2,0x26,0x01,0x70,0xd8,0x42,
+0x13,0x59,0xef,0x80,0xc9,0x13,0x00,0x13,0x3e,0x42,0x01,0x28,0xf2,0x30,0x5e,0x01,
+0x19,0xf2,0x7a,0x01,0x04,0x5b,0x00,0x10,0x03,0x96,0x01,0x1b,0x61,0xab,0x01,0x26,
+0x1c,0xdd,0x01,0x00,0x37,0xd7,0x4f,0xff,0x12,0x03,0x34,0x4f,0xc0,0x03,0x4a,0x00,
+0x8c,0x01,0xfd,0x4f,0xc0,0x02,0xff,0xff,0xf1,0x0d,0x00,0xa0,0x28,0x99,0x9a,0xfd,
+0x4f,0xc0,0x00,0xef,0xff,0xe0,0xec,0x05,0x20,0xff,0xff,0x0d,0x00,0x63,0x01,0x11,
+0x00,0x00,0x06,0xef,0x0d,0x00,0x00,0x76,0x00,0x23,0xcf,0xff,0x0d,0x00,0x54,0x25,
+0x55,0x30,0x2e,0xff,0x0d,0x00,0x00,0x83,0x06,0x13,0x7e,0x0d,0x00,0x20,0x01,0xff,
+0xf9,0x05,0x18,0x7f,0x0d,0x00,0x27,0x01,0x8f,0x0d,0x00,0x03,0x75,0x00,0x46,0x00,
+0xcf,0xff,0xd1,0x0d,0x00,0x05,0xe3,0x02,0x0d,0x0d,0x00,0x36,0x46,0x66,0x40,0x0d,
+0x00,0x04,0xeb,0x06,0x1c,0x01,0x4e,0x00,0x0c,0x0d,0x00,0x1f,0xf3,0x68,0x00,0x1e,
+0x38,0xbf,0xff,0xe2,0x68,0x00,0x1f,0xf6,0x0d,0x00,0x13,0x14,0xf5,0x0d,0x00,0x08,
+0x6c,0x01,0x26,0x1d,0xee,0x01,0x00,0x12,0xe8,0xad,0x01,0x56,0x7a,0xcd,0xdc,0xa7,
+0x30,0xe4,0x04,0x11,0xdf,0x2c,0x01,0x14,0x50,0x54,0x03,0x03,0xcb,0x03,0x25,0xfd,
+0x40,0xf2,0x06,0x52,0xcf,0xf3,0x5f,0xf9,0xef,0x2b,0x07,0x00,0x8c,0x01,0x92,0x92,
+0x1f,0xf0,0x4f,0xe0,0x06,0xef,0xff,0x90,0x1f,0x00,0x20,0xd3,0x00,0x10,0x00,0x41,
+0x00,0x1b,0xff,0xf8,0x21,0x06,0x22,0xfc,0x10,0x10,0x00,0x20,0x00,0xaf,0xa8,0x06,
+0x10,0x0e,0xf0,0x00,0x11,0x2f,0x10,0x00,0x30,0x0c,0xff,0xe0,0x8a,0x01,0x14,0x20,
+0x10,0x00,0x10,0x01,0x31,0x00,0x33,0xef,0xf9,0x00,0x10,0x00,0x00,0x73,0x08,0x46,
+0x00,0x05,0xff,0xf1,0x10,0x00,0x61,0x0e,0xff,0x50,0x09,0xff,0xb0,0x15,0x06,0x21,
+0xff,0xe0,0x7b,0x00,0x41,0x90,0x0d,0xff,0x60,0x41,0x06,0x01,0xff,0x02,0x41,0x04,
+0xff,0xd0,0x0f,0x60,0x06,0x50,0x01,0x44,0x44,0x00,0x10,0xaa,0x04,0x20,0xf0,0x0f,
+0xbc,0x08,0x50,0x01,0x40,0x00,0x00,0x09,0x58,0x00,0x03,0x10,0x00,0x20,0x4e,0xf9,
+0x12,0x07,0x14,0xd3,0x10,0x00,0xf0,0x2e,0x06,0xff,0xff,0x70,0x02,0xff,0xbe,0xff,
+0x80,0x00,0xff,0xf0,0x0d,0xff,0x40,0x00,0x9f,0xfb,0x9f,0xf5,0x0a,0xff,0x21,0xaf,
+0xfc,0x23,0xff,0xd0,0x0b,0xff,0x70,0x1b,0xff,0x90,0x4f,0xfa,0x07,0xff,0xe4,0x05,
+0xff,0xfb,0xff,0xb0,0x06,0xff,0xd2,0xdf,0xf6,0x06,0xff,0xd2,0x00,0x4d,0xff,0x90,
+0x1b,0xff,0xff,0x60,0x01,0x47,0x06,0x20,0x9f,0xfb,0xe1,0x03,0xc1,0xfd,0x30,0x8f,
+0xff,0x10,0x00,0x9f,0xff,0xe2,0x0b,0xff,0x90,0xe3,0x03,0x30,0xf8,0xcf,0xfa,0x9b,
+0x00,0x34,0x81,0xdf,0xf6,0x75,0x06,0x10,0xf2,0x6f,0x07,0x34,0xfe,0xff,0x40,0x94,
+0x06,0x11,0x70,0x72,0x07,0x14,0xf2,0xd1,0x08,0x12,0xfb,0xd5,0x06,0x02,0x00,0x04,
+0x43,0x01,0xaf,0xff,0xc0,0xf4,0x09,0x86,0xfb,0x51,0x00,0x00,0x05,0x9f,0xff,0xfb,
+0xbd,0x06,0x27,0xfd,0xdf,0x6c,0x03,0x12,0x2a,0xa0,0x01,0x15,0xa2,0xc1,0x01,0x68,
+0x17,0xcf,0xff,0xff,0xfc,0x71,0x7a,0x03,0x26,0x24,0x42,0x4f,0x02,0x37,0x7a,0xcc,
+0x95,0x1a,0x00,0x00,0xe2,0x04,0x16,0xe4,0xa2,0x03,0x01,0x4a,0x00,0x25,0x70,0x00,
+0x6f,0x0a,0x33,0xa4,0x23,0x6d,0xbb,0x02,0x00,0xbb,0x00,0x10,0xf4,0xb0,0x00,0x02,
+0x60,0x08,0x04,0x62,0x08,0x33,0x0c,0xff,0x60,0xfc,0x07,0x11,0xfd,0x2d,0x02,0x00,
+0xb5,0x00,0x62,0x12,0x10,0x00,0x00,0x6f,0xf8,0xc5,0x09,0x92,0xf0,0x00,0x7e,0xff,
+0xfc,0x40,0x00,0x7f,0xf6,0x95,0x07,0x10,0xf0,0x62,0x00,0x15,0xf7,0x1e,0x00,0x11,
+0xe0,0xb1,0x03,0x32,0x60,0x3f,0xfc,0x3c,0x00,0x11,0xc6,0x7f,0x00,0x41,0xf1,0x0e,
+0xff,0x50,0x5a,0x00,0x11,0x6c,0x0f,0x00,0x14,0xf6,0x78,0x00,0x02,0x12,0x09,0x94,
+0xfa,0x00,0xcf,0xff,0x93,0x01,0x5d,0xff,0xf4,0x0f,0x00,0x12,0x0c,0xb4,0x00,0x11,
+0x0d,0x07,0x00,0x13,0xf8,0x92,0x09,0x22,0x94,0x08,0xed,0x05,0x04,0x56,0x09,0x12,
+0xc8,0x66,0x09,0x00,0xee,0x0a,0x22,0xfd,0xbb,0xab,0x04,0x00,0xe2,0x09,0x53,0x0d,
+0xff,0xf7,0x10,0x01,0x0f,0x00,0x10,0xb1,0x24,0x0a,0x33,0x20,0x00,0x2e,0x28,0x03,
+0x50,0xe1,0x00,0x03,0xff,0xe2,0x01,0x0a,0x02,0x01,0x00,0x53,0xfb,0x00,0x0b,0xff,
+0x60,0x6c,0x00,0x01,0x3c,0x08,0x25,0x0f,0xfe,0xfd,0x09,0x00,0x5a,0x00,0x46,0x4f,
+0xf8,0x00,0x02,0x65,0x03,0x32,0xf1,0x7f,0xf4,0xc3,0x06,0x03,0x82,0x06,0x46,0x9f,
+0xf3,0x00,0x2f,0x0f,0x00,0x37,0xf7,0xaf,0xf2,0x3b,0x00,0x67,0xff,0xf8,0xaf,0xfb,
+0xbb,0xef,0x0f,0x00,0x28,0x9f,0xff,0x01,0x00,0x74,0xf7,0x6f,0xff,0xff,0xff,0xb7,
+0x77,0x01,0x00,0x5d,0x72,0x02,0x22,0x22,0x22,0x05,0x07,0x19,0x42,0x0e,0x00,0x38,
+0x04,0xfe,0x30,0x0f,0x00,0x15,0x05,0xc2,0x01,0x13,0x00,0x0d,0x0a,0x1a,0x50,0x1f,
+0x00,0x04,0x56,0x06,0x04,0x0a,0x0b,0x19,0x60,0x4d,0x00,0x06,0x34,0x0b,0x03,0xe4,
+0x09,0x18,0x80,0x0f,0x00,0x32,0x03,0xef,0xf9,0xa4,0x07,0x03,0xa1,0x07,0x11,0x3e,
+0x41,0x0a,0x13,0x3f,0xbd,0x00,0x21,0xee,0xef,0xb6,0x02,0x17,0x3f,0xd0,0x00,0x1a,
+0xc1,0x0f,0x00,0x29,0xfd,0x10,0x0f,0x00,0x53,0xff,0xe2,0x00,0x15,0x55,0x01,0x00,
+0x7b,0x56,0x66,0x66,0x66,0x64,0x00,0x00,0xfb,0x07,0x18,0x7f,0x2e,0x00,0x38,0xf3,
+0x00,0x06,0x0f,0x00,0x10,0xf2,0xbe,0x00,0x09,0x0f,0x00,0x19,0x04,0x0f,0x00,0x00,
+0x9f,0x00,0xa0,0xe4,0x44,0x45,0x55,0x66,0x66,0x77,0x78,0x88,0x91,0x3d,0x08,0x17,
+0xef,0x42,0x0c,0x01,0x06,0x0d,0x1a,0xc0,0x8f,0x0d,0x1a,0xfc,0xc1,0x06,0x29,0xff,
+0xc1,0x10,0x00,0x29,0xcf,0xfc,0x9c,0x00,0x1b,0x0b,0x1f,0x00,0x11,0xaf,0x44,0x0c,
+0x07,0xa2,0x0c,0x19,0x70,0x1f,0x00,0x2f,0x99,0x00,0x01,0x00,0x07,0x37,0xbc,0xb9,
+0x63,0x0f,0x00,0x00,0x87,0x09,0x17,0xfa,0xb5,0x01,0x68,0x46,0x7a,0xdf,0xff,0xfe,
+0x81,0xa9,0x00,0x17,0x5b,0xb6,0x03,0x10,0x21,0x03,0x04,0x34,0xef,0xfd,0x30,0x3c,
+0x00,0x76,0xfe,0xa7,0x20,0x00,0x07,0xff,0xf8,0x4b,0x00,0x63,0xfc,0x50,0x00,0x1b,
+0xff,0xb0,0x3a,0x00,0x20,0x35,0x9d,0xeb,0x05,0x25,0x7f,0x90,0x4c,0x00,0x53,0x39,
+0xff,0xfb,0x20,0x02,0x0c,0x00,0x56,0x54,0x20,0x00,0x00,0x19,0x20,0x02,0x86,0xef,
+0xfe,0xa4,0x00,0x00,0x3d,0xe4,0x00,0x8e,0x0e,0x36,0xd6,0x00,0x00,0xe4,0x00,0x46,
+0x15,0x9f,0xff,0xc3,0x94,0x00,0x54,0x11,0x00,0x00,0x7e,0xf6,0x26,0x02,0x74,0x8c,
+0xff,0xff,0xfd,0xa3,0x01,0x20,0x52,0x06,0x45,0xfd,0x61,0x02,0x6c,0x2c,0x00,0x31,
+0x9f,0xff,0x90,0xd8,0x01,0x13,0x80,0x64,0x01,0x12,0xf9,0x96,0x02,0x13,0xfa,0x96,
+0x08,0x50,0xd0,0x00,0x07,0xa9,0x20,0xdb,0x0e,0x02,0xfc,0x04,0x92,0x60,0x00,0xcf,
+0xff,0xf3,0x00,0x3f,0xff,0xf5,0x08,0x06,0x92,0x10,0x07,0xff,0xff,0xfd,0x00,0x0e,
+0xff,0xfe,0x1b,0x02,0x01,0x76,0x03,0x51,0x10,0x0d,0xff,0xff,0x20,0x1e,0x00,0x01,
+0xfe,0x03,0x42,0x00,0x0d,0xff,0xfe,0x5f,0x0d,0x20,0x20,0x04,0xcd,0x0a,0x32,0x0f,
+0xff,0xf7,0xdb,0x0d,0x11,0x80,0xa5,0x09,0x35,0x5f,0xff,0xd0,0x62,0x0d,0x10,0x10,
+0xb6,0x0c,0x12,0x20,0x4e,0x0c,0x01,0xdc,0x01,0x14,0x0a,0x3c,0x03,0x10,0x4e,0x19,
+0x09,0x23,0x02,0xcf,0xc6,0x09,0x00,0x9e,0x05,0x55,0xd9,0x89,0xcf,0xff,0x91,0x81,
+0x01,0x1c,0x7b,0xf0,0x08,0x90,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,
+0x08,0xee,0x01,0x00,0x62,0x90,0x00,0x00,0x00,0x2f,0xff,0x01,0x00,0x63,0xfb,0x00,
+0x00,0x00,0x3f,0xff,0x01,0x00,0x60,0xb0,0x00,0x00,0x3f,0xfd,0x33,0x01,0x00,0x10,
+0x38,0x19,0x00,0x30,0x3f,0xfc,0x00,0x1e,0x00,0x45,0xd0,0x8f,0xff,0xb0,0x0c,0x00,
+0x35,0x08,0xff,0xfa,0x0c,0x00,0x45,0x00,0x8f,0xff,0xa0,0x0c,0x00,0x33,0x08,0xff,
+0xf9,0x0c,0x00,0x53,0xfe,0xee,0xe8,0x8f,0xfd,0x0c,0x00,0x52,0xff,0xff,0xf9,0x1f,
+0xfe,0x0c,0x00,0x44,0x02,0x22,0x22,0x21,0x0c,0x00,0x00,0x01,0x00,0x0f,0x0c,0x00,
+0xa4,0x23,0xff,0xee,0x01,0x00,0x45,0xef,0xfe,0x3f,0xff,0x01,0x00,0x26,0xfd,0x0b,
+0x0c,0x00,0x2c,0xf8,0x00,0x01,0x00,0x29,0x01,0x22,0x0f,0x00,0x56,0x08,0xef,0xff,
+0xfc,0x60,0x0f,0x00,0x75,0x03,0xef,0xff,0xee,0xff,0xfc,0x10,0x10,0x00,0x75,0x4f,
+0xfc,0x50,0x00,0x17,0xef,0xe2,0x3d,0x00,0x92,0xef,0xa0,0x00,0x00,0x00,0x1d,0xfc,
+0x01,0x32,0x10,0x00,0x22,0x0a,0xfc,0x16,0x00,0x31,0xef,0xff,0xe8,0x10,0x00,0x21,
+0x2f,0xf2,0x07,0x00,0x50,0x5f,0xff,0xef,0xff,0xd1,0x09,0x00,0x21,0x7f,0xb0,0x10,
+0x00,0x50,0x0c,0x60,0x00,0x7e,0xfd,0x09,0x00,0x24,0xaf,0x70,0x4a,0x00,0x20,0x02,
+0xef,0xfa,0x01,0x16,0xbf,0x7b,0x00,0x20,0x3f,0xf1,0x10,0x00,0x15,0x70,0x10,0x00,
+0x72,0x0c,0xf6,0x00,0x00,0x04,0xff,0x90,0x0d,0x00,0x91,0x14,0x83,0x00,0x07,0xf9,
+0x00,0x00,0x2f,0xfa,0x0e,0x00,0xb0,0x15,0x8c,0xff,0xf7,0x00,0x06,0xfb,0x00,0x00,
+0xbf,0xc0,0x0e,0x00,0x10,0x9d,0x3b,0x02,0x00,0x10,0x00,0x32,0x03,0xff,0x20,0x0e,
+0x00,0xb1,0xff,0xfd,0xa5,0x00,0x09,0xf9,0x00,0x09,0xfa,0x00,0x0c,0x0e,0x00,0x60,
+0x95,0x10,0x00,0x00,0x0e,0xf4,0x03,0x00,0x60,0x0a,0xff,0xff,0xfc,0x86,0x30,0x45,
+0x00,0xc1,0x6f,0xf5,0x00,0x1f,0xf0,0x00,0x06,0xfb,0x74,0x00,0x0a,0xc0,0x70,0x00,
+0x42,0xfe,0x10,0x3f,0xd0,0xf4,0x00,0x11,0xf6,0x07,0x00,0x41,0xdf,0x90,0x4f,0xc0,
+0x09,0x00,0x31,0xef,0xff,0x10,0x17,0x00,0x21,0xf0,0x2f,0x20,0x00,0x11,0x09,0x9c,
+0x02,0x00,0x51,0x00,0x23,0x1f,0xf0,0x58,0x02,0x11,0xf5,0x0c,0x01,0x31,0xf6,0x0d,
+0xf4,0x38,0x00,0x31,0xff,0xff,0xfe,0x5a,0x01,0x30,0xf7,0x08,0xfa,0x07,0x00,0x00,
+0x82,0x00,0x10,0x80,0x38,0x00,0xc0,0xf6,0x01,0xff,0x30,0x00,0x00,0x06,0x77,0x77,
+0x77,0x77,0x70,0x71,0x00,0x47,0xf4,0x00,0x9f,0xd1,0x8a,0x01,0x47,0x2f,0xf0,0x00,
+0x1e,0x7a,0x01,0x75,0x00,0xbf,0xa0,0x00,0x03,0xef,0xe5,0x0f,0x00,0xf0,0x03,0x09,
+0xfe,0x10,0x00,0x00,0x2d,0xff,0xd7,0x43,0x33,0x34,0x44,0x45,0x55,0x56,0x68,0xdf,
+0xf3,0x16,0x00,0x15,0x8f,0xea,0x01,0x21,0xfc,0x30,0x27,0x00,0xa7,0x59,0xbc,0xcc,
+0xcc,0xcc,0xbb,0xbb,0xbb,0xb9,0x40,0x5b,0x00,0x38,0x09,0x99,0x60,0xf4,0x01,0x3f,
+0x1f,0xff,0xa0,0x0f,0x00,0x0c,0x29,0x35,0x41,0x0f,0x00,0x28,0xbf,0xf6,0x0f,0x00,
+0x38,0x01,0xff,0xf2,0x0f,0x00,0x35,0x07,0xff,0xd0,0x1f,0x02,0x61,0x9f,0xff,0xd4,
+0x07,0xff,0x70,0x0b,0x00,0x90,0x10,0x00,0x00,0x4f,0xff,0xff,0xff,0x90,0x8f,0xd3,
+0x00,0x51,0x4b,0xff,0xfd,0x81,0x02,0x90,0x02,0x13,0x04,0x13,0x01,0x81,0xfc,0x0b,
+0xff,0xe5,0x13,0xaf,0xff,0x10,0x2e,0x02,0xa0,0xfd,0xdf,0xfa,0x0f,0xff,0x40,0x00,
+0x0d,0xff,0x70,0x4d,0x02,0x90,0xfb,0x20,0x03,0xb8,0x2f,0xff,0x00,0x00,0x08,0xfe,
+0x01,0x60,0x07,0xff,0xc0,0x00,0x00,0x01,0x0f,0x00,0x10,0x0a,0x46,0x01,0x20,0x0e,
+0xff,0xd8,0x00,0x70,0x0f,0xff,0x70,0x00,0x2f,0xff,0x50,0x9f,0x02,0x11,0x00,0x50,
+0x00,0x21,0xfb,0x89,0x74,0x01,0x12,0x9f,0xa8,0x00,0x50,0xcf,0xff,0xff,0xff,0xf4,
+0x8a,0x01,0x12,0xf1,0xa5,0x02,0x30,0xff,0xff,0xfd,0x36,0x00,0x04,0xa8,0x00,0x11,
+0x3f,0xc0,0x01,0x38,0x03,0xff,0x90,0xff,0x00,0x38,0x06,0xff,0x50,0x0f,0x00,0x38,
+0x09,0xff,0x30,0x0f,0x00,0x29,0x0b,0xff,0x2c,0x01,0x29,0x0d,0xfe,0x0f,0x00,0x29,
+0x0f,0xfd,0x0f,0x00,0x29,0x1f,0xfb,0x0f,0x00,0x29,0x2f,0xf9,0x0f,0x00,0x29,0x4f,
+0xf8,0x0f,0x00,0x29,0x5f,0xf7,0x0f,0x00,0x2a,0x7f,0xf6,0x95,0x01,0x1b,0x10,0xbd,
+0x03,0x10,0x43,0xe6,0x00,0x30,0xff,0xe4,0x00,0xe3,0x03,0xf2,0x14,0x30,0x4f,0xf7,
+0x12,0xcf,0xc0,0x9f,0xb0,0x00,0x3f,0xf1,0xbf,0x80,0x00,0x0f,0xf2,0x9f,0xc0,0x00,
+0x4f,0xf0,0x3f,0xfb,0x57,0xff,0xa0,0x08,0xff,0xff,0xfe,0x10,0x00,0x5c,0xfe,0x91,
+0x13,0x02,0x42,0xce,0xff,0xec,0x95,0x40,0x00,0x11,0x7e,0x2b,0x02,0x10,0xe6,0x0b,
+0x00,0x52,0x1c,0xff,0xff,0xff,0xee,0x68,0x05,0xe1,0x01,0xef,0xff,0xe6,0x20,0x00,
+0x02,0x8e,0xff,0xfc,0x00,0x00,0x0c,0xff,0xaf,0x00,0x61,0x01,0xbf,0xff,0x80,0x00,
+0x7f,0xb8,0x02,0x00,0x14,0x00,0x43,0xf1,0x00,0xef,0xfc,0xb8,0x03,0x41,0xfd,0x71,
+0x05,0xff,0x7b,0x02,0x01,0x9e,0x00,0x16,0x0a,0xfd,0x01,0x24,0x00,0x0d,0x52,0x01,
+0x01,0xa2,0x01,0x17,0x60,0x24,0x02,0x76,0xdc,0xcc,0xcc,0xcc,0xcc,0xc9,0x00,0xeb,
+0x05,0x1c,0xfc,0x0c,0x00,0x37,0x1f,0xff,0x60,0x3c,0x00,0x17,0x80,0x54,0x00,0x16,
+0xb0,0xc6,0x02,0x25,0xff,0xf1,0x0c,0x00,0x24,0x04,0xff,0x38,0x01,0x62,0x7d,0x50,
+0x00,0xdf,0xff,0x20,0x9c,0x00,0x63,0xff,0xf6,0x00,0x5f,0xff,0xc0,0x39,0x00,0x60,
+0xe0,0x00,0x0b,0xff,0xfd,0x20,0x17,0x00,0xc1,0xcf,0xff,0x40,0x00,0x01,0xdf,0xff,
+0xf8,0x30,0x00,0x02,0x8f,0x38,0x00,0x72,0x1b,0xff,0xff,0xff,0xdd,0xff,0xff,0x74,
+0x00,0x11,0x6e,0x86,0x00,0x25,0xc3,0x00,0x2c,0x01,0x10,0x83,0xa9,0x04,0x1f,0xfb,
+0x02,0x00,0x1f,0x56,0xef,0xf0,0x00,0x0f,0xfe,0x05,0x00,0x63,0x45,0x50,0x00,0x05,
+0x54,0x00,0x82,0x02,0x1f,0xb0,0x05,0x00,0x6c,0x10,0x00,0x00,0x03,0x04,0xd4,0x02,
+0x00,0xee,0x02,0x05,0xac,0x01,0x00,0x23,0x05,0x15,0xe0,0x85,0x05,0x34,0xfe,0xdf,
+0xf5,0x0c,0x00,0x44,0x9f,0xfa,0x8f,0xfb,0x0c,0x00,0x43,0xef,0xf5,0x3f,0xff,0x8b,
+0x02,0x42,0x05,0xff,0xf0,0x0e,0xe3,0x03,0x00,0x17,0x03,0x24,0x90,0x08,0x01,0x02,
+0x44,0x2f,0xff,0x30,0x02,0x19,0x02,0x63,0x8f,0xfd,0x00,0x00,0xcf,0xfa,0x3b,0x00,
+0x53,0xf7,0x00,0x00,0x6f,0xff,0xb5,0x01,0x15,0xf1,0x1a,0x02,0x03,0x9b,0x00,0x12,
+0xc0,0xfd,0x01,0x10,0x50,0x1d,0x00,0x11,0xf2,0x32,0x06,0x11,0xff,0x44,0x05,0x11,
+0xf8,0x06,0x00,0x11,0xf9,0x4d,0x00,0x11,0xfe,0xae,0x03,0x03,0x01,0x00,0x11,0x40,
+0x81,0x05,0x05,0x23,0x08,0x80,0x0f,0xff,0xcb,0xbb,0xbb,0xbb,0xbb,0xbc,0x5a,0x00,
+0x13,0x6f,0xa3,0x00,0x00,0xe3,0x01,0x23,0xcf,0xfb,0xc5,0x00,0x54,0xfd,0x00,0x02,
+0xff,0xf4,0xf8,0x03,0x45,0x30,0x09,0xff,0xe0,0xac,0x02,0x14,0x0e,0x67,0x02,0x63,
+0x07,0xff,0xf0,0x5f,0xff,0x20,0x61,0x03,0x35,0xff,0xf5,0xbf,0xf6,0x00,0x33,0xaf,
+0xfb,0x0f,0x6a,0x00,0x28,0xf3,0x00,0x0a,0x00,0x20,0xed,0xdd,0x01,0x00,0x34,0xd3,
+0x00,0x0f,0x34,0x04,0x0f,0x0a,0x00,0x35,0x00,0x29,0x03,0x44,0xcb,0xa8,0x40,0x00,
+0x6e,0x00,0x25,0xfe,0x70,0x78,0x00,0x13,0xfc,0x28,0x00,0x43,0x26,0xdf,0xff,0xa0,
+0x32,0x00,0x33,0x0b,0xff,0xf2,0x0a,0x00,0x34,0x01,0xff,0xf8,0x46,0x00,0x24,0xbf,
+0xfa,0x0a,0x00,0x25,0xaf,0xfb,0x14,0x00,0x05,0x0a,0x00,0x14,0xef,0x28,0x00,0x32,
+0x08,0xff,0xf3,0x0a,0x00,0x20,0x02,0x9f,0x50,0x00,0x75,0xdb,0xbb,0xbb,0xbc,0xef,
+0xff,0xfc,0x6e,0x00,0x13,0x90,0x0a,0x00,0x23,0xec,0x82,0x8c,0x00,0x20,0xfe,0xca,
+0x2d,0x00,0x03,0x1e,0x00,0x13,0xe5,0xab,0x00,0x61,0xce,0xff,0xff,0xf6,0x00,0x00,
+0xfe,0x06,0x44,0x01,0x7f,0xff,0xf1,0xca,0x00,0x31,0x5f,0xff,0x60,0x15,0x00,0x00,
+0x70,0x00,0x25,0xf9,0x00,0xad,0x00,0x14,0xa0,0x15,0x00,0x15,0xcf,0x15,0x00,0x00,
+0x07,0x00,0x22,0xff,0xf5,0x84,0x01,0x13,0xe0,0x15,0x00,0x10,0x18,0x11,0x00,0x85,
+0xff,0xfc,0xbb,0xbb,0xbb,0xdf,0xff,0xe4,0x0a,0x01,0x16,0xb3,0x7e,0x00,0x23,0xfc,
+0x40,0x2a,0x00,0x26,0x25,0xcf,0x69,0x00,0x36,0x7f,0xff,0x30,0xee,0x00,0x04,0x15,
+0x00,0x34,0x06,0xff,0xf0,0x15,0x00,0x3e,0x4f,0xff,0x10,0x15,0x00,0x24,0xaf,0xfe,
+0x2a,0x00,0x31,0x3f,0xff,0x90,0x15,0x00,0x00,0xc8,0x00,0x80,0xf2,0x00,0xff,0xfd,
+0xcc,0xcc,0xcc,0xde,0xd7,0x07,0x04,0x10,0x01,0x13,0xd3,0x7e,0x00,0x26,0xfe,0xc9,
+0x9d,0x01,0x24,0xff,0xd0,0x70,0x09,0x04,0x12,0x02,0x3b,0xa0,0xff,0xf5,0xd3,0x01,
+0x0f,0x11,0x00,0x9f,0x01,0x47,0x05,0x01,0x01,0x00,0x12,0xa0,0xb3,0x03,0x06,0x0c,
+0x00,0x62,0x06,0xff,0xfe,0xee,0xee,0xef,0x0c,0x00,0x12,0x08,0xbf,0x03,0x12,0xa0,
+0xcb,0x03,0x15,0x90,0x0c,0x00,0x35,0x0c,0xff,0x70,0x0c,0x00,0x35,0x0e,0xff,0x50,
+0x0c,0x00,0x35,0x0f,0xff,0x30,0x0c,0x00,0x35,0x2f,0xff,0x10,0x0c,0x00,0x35,0x4f,
+0xff,0x00,0x0c,0x00,0x26,0x6f,0xfc,0x0c,0x00,0x26,0x8f,0xfa,0x0c,0x00,0x26,0xbf,
+0xf8,0x0c,0x00,0x26,0xdf,0xf5,0x0c,0x00,0x25,0xff,0xf3,0x0c,0x00,0x35,0x04,0xff,
+0xf0,0x0c,0x00,0x01,0x32,0x08,0x02,0x0c,0x00,0x00,0xa1,0x04,0x05,0x0c,0x00,0x02,
+0xeb,0x00,0x12,0x0a,0x76,0x07,0x25,0xff,0x10,0x0c,0x00,0x02,0x2b,0x04,0x01,0x0c,
+0x00,0x35,0x03,0xff,0xf5,0x0c,0x00,0x34,0x0c,0xff,0xd0,0x0c,0x00,0x20,0xae,0xef,
+0xfa,0x00,0x00,0xfc,0x00,0x36,0xfe,0xea,0xbf,0x5c,0x0b,0x19,0xfb,0x0c,0x00,0x05,
+0x23,0x09,0x1f,0x7f,0x0c,0x00,0x42,0x25,0x0f,0xff,0x09,0x04,0x05,0x75,0x00,0x14,
+0xc0,0x79,0x02,0x27,0xdd,0xd9,0xc0,0x01,0x06,0x50,0x04,0x0f,0x15,0x00,0x2e,0x21,
+0xfd,0xcc,0x01,0x00,0x36,0xc8,0x00,0x0f,0x73,0x05,0x05,0xf2,0x00,0x0e,0x69,0x00,
+0x0f,0x7e,0x00,0x3c,0x22,0xfe,0xdd,0x01,0x00,0x25,0xd6,0x0f,0xf2,0x00,0x15,0x70,
+0x0a,0x00,0x42,0xf7,0x05,0xff,0xf2,0x3c,0x06,0x13,0x40,0x2b,0x06,0x11,0x0b,0xf8,
+0x01,0x12,0x01,0xee,0x05,0x75,0x9f,0xfe,0x00,0x00,0x1e,0xff,0x70,0x21,0x00,0x10,
+0x3f,0x06,0x00,0x01,0xe6,0x05,0x02,0x21,0x00,0x02,0xac,0x08,0x24,0xbf,0xfb,0x21,
+0x00,0x00,0x80,0x04,0x00,0x1c,0x00,0x13,0xf6,0x21,0x00,0x03,0x35,0x06,0x33,0x06,
+0xff,0xe1,0x21,0x00,0x03,0xcf,0x06,0x00,0xc7,0x04,0x01,0x21,0x00,0x22,0x6f,0xfe,
+0x6d,0x06,0x31,0x1e,0xff,0x50,0x21,0x00,0x12,0x2f,0x88,0x00,0x01,0x65,0x00,0x00,
+0x21,0x00,0x06,0x0d,0x09,0x73,0x9f,0xfe,0x30,0x1f,0xff,0x40,0x2c,0x98,0x08,0x01,
+0x9f,0x0a,0x46,0xca,0xff,0xfc,0xcf,0xcd,0x08,0x04,0xff,0x0e,0x24,0x50,0x00,0x56,
+0x07,0x64,0xc8,0xcf,0xff,0xff,0xd9,0xaf,0x65,0x0a,0x00,0x70,0x09,0x00,0x63,0x00,
+0x24,0xef,0xf9,0x8e,0x07,0x11,0xf9,0x84,0x00,0x05,0x88,0x09,0x31,0x9f,0xfe,0x10,
+0x21,0x00,0x33,0x0c,0xff,0xc0,0xce,0x04,0x12,0x60,0xa5,0x00,0x32,0x3f,0xff,0x70,
+0xed,0x06,0x13,0xd0,0xc6,0x00,0x31,0x9f,0xff,0x10,0x22,0x03,0x12,0xf3,0xe7,0x00,
+0x00,0x6d,0x0b,0x01,0xf7,0x00,0x14,0xfa,0x08,0x01,0x11,0x06,0x8b,0x01,0x34,0xbf,
+0xff,0x10,0x29,0x01,0x10,0x0c,0x19,0x01,0x19,0x5f,0x4a,0x01,0x56,0x90,0x00,0x0e,
+0xff,0xd0,0x6b,0x01,0x10,0xaf,0x57,0x07,0x16,0xf4,0x8c,0x01,0x62,0x01,0xff,0xfc,
+0x03,0xff,0xfa,0x97,0x06,0x80,0xf4,0x00,0x00,0x00,0x00,0x07,0xff,0xf7,0xd0,0x00,
+0x00,0x02,0x7b,0xef,0xfe,0xc7,0x20,0x00,0x00,0x00,0x09,0xff,0x01,0x00,0xf0,0x12,
+0x80,0x00,0x00,0x1d,0xff,0xff,0xfd,0xdf,0xff,0xff,0xb0,0x00,0x0d,0xff,0xfa,0x30,
+0x00,0x04,0xcf,0xff,0x70,0x08,0xff,0xf7,0x00,0x00,0x00,0x00,0xdf,0xfe,0x01,0xff,
+0xfa,0x09,0x00,0x60,0x05,0xff,0xf1,0x04,0xae,0x10,0x0a,0x00,0x41,0x2f,0xff,0x30,
+0x00,0x01,0x00,0x42,0x03,0xff,0xf2,0x00,0x01,0x00,0x23,0x7f,0xfe,0x09,0x00,0x31,
+0x3f,0xff,0x60,0x08,0x00,0x40,0x14,0x9f,0xff,0x90,0x08,0x00,0x62,0x9f,0xff,0xff,
+0xfd,0x50,0x00,0x6a,0x00,0x21,0xfe,0x82,0x1b,0x00,0x53,0x6b,0xbc,0xef,0xff,0xf9,
+0x2f,0x00,0x12,0x29,0x5c,0x00,0x01,0x5f,0x00,0x13,0xf5,0x0a,0x00,0x36,0x0b,0xff,
+0xb0,0x56,0x00,0x11,0x73,0x09,0x00,0x42,0x07,0xff,0xf6,0xef,0x15,0x00,0x41,0x9f,
+0xfd,0x6f,0xff,0x50,0x00,0x61,0x0e,0xff,0xa0,0xdf,0xff,0x40,0x59,0x00,0xf0,0x08,
+0xf4,0x02,0xff,0xff,0x92,0x00,0x00,0x3b,0xff,0xfb,0x00,0x04,0xff,0xff,0xfe,0xcc,
+0xef,0xff,0xfc,0x00,0x00,0x02,0xcf,0xda,0x00,0x10,0xf8,0x2b,0x00,0x92,0x49,0xce,
+0xff,0xdb,0x71,0x00,0x00,0x0f,0xff,0x56,0x00,0x51,0x4f,0xff,0xe0,0xff,0xf0,0x0a,
+0x00,0x53,0x0d,0xff,0xfe,0x0f,0xff,0x61,0x00,0x04,0x15,0x00,0x25,0x01,0xff,0x15,
+0x00,0x24,0xaf,0xfc,0x15,0x00,0x33,0x4f,0xff,0x3f,0x15,0x00,0x33,0x0d,0xff,0x90,
+0x15,0x00,0x42,0x07,0xff,0xe1,0x0f,0x15,0x00,0x43,0x01,0xff,0xf6,0x00,0x15,0x00,
+0x42,0xaf,0xfc,0x00,0x1f,0x15,0x00,0x41,0x3f,0xff,0x30,0x01,0x15,0x00,0x00,0x33,
+0x00,0x03,0x15,0x00,0x42,0x06,0xff,0xe1,0x00,0x15,0x00,0x00,0x33,0x00,0x03,0x15,
+0x00,0x32,0xaf,0xfd,0x00,0x15,0x00,0x00,0x33,0x00,0x03,0x15,0x00,0x33,0x0c,0xff,
+0xa0,0x15,0x00,0x42,0x06,0xff,0xf1,0x00,0x15,0x00,0x42,0x01,0xef,0xf7,0x00,0x15,
+0x00,0x42,0xe0,0x9f,0xfd,0x00,0x15,0x00,0x43,0xfe,0x3f,0xff,0x40,0x15,0x00,0x10,
+0xdc,0x33,0x00,0x02,0x2a,0x00,0x01,0x33,0x00,0x01,0x15,0x00,0x02,0xc3,0x01,0x01,
+0x15,0x00,0x25,0xfd,0x00,0x15,0x00,0x13,0x40,0x15,0x00,0xd0,0x00,0x00,0x38,0x84,
+0x00,0x00,0x00,0x38,0x83,0x00,0x00,0x00,0x04,0x3f,0x00,0x11,0x09,0xbd,0x01,0x71,
+0x1f,0xff,0x10,0x00,0x01,0xef,0xf2,0x02,0x01,0x51,0xfd,0x41,0x14,0xcf,0xfb,0x39,
+0x00,0x61,0xdf,0xff,0xff,0xff,0xfe,0x10,0x3a,0x00,0x62,0x8d,0xff,0xff,0xe8,0x10,
+0x00,0x50,0x00,0x39,0x22,0x10,0x00,0x01,0x00,0x0f,0x65,0x01,0xfe,0x12,0x0f,0xaf,
+0x02,0x32,0xdf,0xf9,0x00,0xe1,0x02,0x32,0x8f,0xfe,0x00,0x13,0x00,0x00,0x56,0x00,
+0x22,0xff,0xf5,0xee,0x00,0x01,0x13,0x00,0x00,0xed,0x00,0x11,0x00,0x13,0x00,0x42,
+0x02,0xff,0xf4,0x00,0x13,0x00,0x32,0xcf,0xfa,0x00,0x13,0x00,0x32,0x6f,0xfe,0x10,
+0x13,0x00,0x32,0x2f,0xff,0x40,0x13,0x00,0x10,0x0c,0x61,0x03,0x00,0x13,0x00,0x40,
+0x1c,0xff,0xc0,0x00,0x13,0x00,0x22,0xfc,0xcf,0x94,0x00,0x10,0x0f,0xf9,0x02,0x11,
+0x50,0x13,0x00,0x31,0xff,0xd9,0xaf,0xb4,0x01,0x00,0x39,0x00,0x32,0xef,0xf9,0x00,
+0x39,0x00,0x33,0x05,0xff,0xf3,0x13,0x00,0x33,0x0c,0xff,0xd0,0x5f,0x00,0x33,0x2f,
+0xff,0x70,0x72,0x00,0x32,0x9f,0xff,0x20,0x13,0x00,0x33,0x01,0xef,0xfb,0x13,0x00,
+0x10,0x06,0x0f,0x00,0x01,0xab,0x00,0x35,0x0c,0xff,0xe0,0xbe,0x00,0x13,0x90,0xd1,
+0x00,0x32,0x9f,0xff,0x30,0x13,0x00,0x33,0x01,0xff,0xfd,0x13,0x00,0x11,0x07,0x13,
+0x01,0x11,0x0d,0x5c,0x04,0x01,0xcd,0x03,0x02,0x0a,0x00,0x11,0xfb,0x5d,0x02,0x40,
+0xee,0xee,0xee,0xef,0x15,0x00,0x11,0x03,0xcc,0x01,0x10,0x9f,0x15,0x00,0x21,0x5f,
+0xfd,0xc8,0x03,0x10,0xb0,0x3a,0x00,0x14,0xb0,0x15,0x00,0x24,0x9f,0xf9,0x15,0x00,
+0x34,0x0b,0xff,0x70,0x15,0x00,0x24,0xdf,0xf5,0x15,0x00,0x33,0x0f,0xff,0x30,0x15,
+0x00,0x34,0x02,0xff,0xf1,0x15,0x00,0x33,0x4f,0xff,0x00,0x15,0x00,0x34,0x06,0xff,
+0xd0,0x15,0x00,0x24,0x8f,0xfa,0x15,0x00,0x34,0x0b,0xff,0x80,0x15,0x00,0x24,0xef,
+0xf6,0x15,0x00,0x33,0x1f,0xff,0x30,0x15,0x00,0x34,0x04,0xff,0xf0,0x15,0x00,0x33,
+0x7f,0xfd,0x00,0x15,0x00,0x33,0x0b,0xff,0x90,0x15,0x00,0x34,0x01,0xff,0xf5,0x15,
+0x00,0x33,0x7f,0xff,0x10,0x15,0x00,0x32,0x3f,0xff,0xa0,0x15,0x00,0x23,0xb9,0xdf,
+0x0d,0x05,0x33,0x9f,0xfb,0xbf,0x12,0x02,0x63,0x09,0xff,0xbb,0xff,0xc4,0x00,0x15,
+0x00,0x34,0x0f,0xff,0xf8,0xd6,0x04,0x44,0xff,0xf0,0x0f,0xff,0x30,0x05,0x10,0xcf,
+0x0d,0x00,0x03,0x2d,0x02,0x62,0x02,0xff,0xff,0xf0,0x0f,0xfe,0x51,0x00,0x82,0x00,
+0x08,0xff,0xef,0xf0,0x0f,0xfd,0xcf,0x44,0x03,0x82,0x0e,0xfc,0xef,0xf0,0x0f,0xfe,
+0x7f,0xf5,0x63,0x05,0x10,0xf8,0x27,0x00,0x22,0x2f,0xfb,0x59,0x00,0x10,0xf3,0x0d,
+0x00,0x12,0x0d,0x90,0x00,0x20,0xef,0xe0,0x0d,0x00,0x31,0x08,0xff,0x70,0x50,0x05,
+0x10,0x80,0x5b,0x00,0x11,0x02,0x08,0x01,0x30,0x0a,0xff,0x20,0x0d,0x00,0x30,0x00,
+0xcf,0xf3,0x83,0x01,0x21,0xfd,0x00,0x0d,0x00,0x10,0x6f,0x61,0x01,0x22,0x6f,0xf7,
+0x0d,0x00,0x20,0x1f,0xfe,0x8d,0x00,0x12,0xf1,0x0d,0x00,0x72,0x0b,0xff,0x40,0x00,
+0x01,0xff,0xb0,0x0d,0x00,0x72,0x05,0xff,0xa0,0x00,0x07,0xff,0x60,0x0d,0x00,0x73,
+0x00,0xef,0xf0,0x00,0x0d,0xff,0x00,0x0d,0x00,0x54,0x9f,0xf6,0x00,0x3f,0xfa,0x0d,
+0x00,0x54,0x3f,0xfc,0x00,0x8f,0xf4,0x0d,0x00,0x54,0x0d,0xff,0x10,0xef,0xe0,0x0d,
+0x00,0x54,0x08,0xff,0x53,0xff,0x90,0x0d,0x00,0x54,0x02,0xff,0xa8,0xff,0x30,0x0d,
+0x00,0x55,0x00,0xcf,0xec,0xfd,0x00,0x0d,0x00,0x36,0x6f,0xff,0xf7,0x0d,0x00,0x36,
+0x1f,0xff,0xf2,0x0d,0x00,0x36,0x0a,0xff,0xc0,0x0d,0x00,0x33,0x04,0xff,0x60,0x0d,
+0x00,0x00,0xe5,0x02,0x00,0x10,0x00,0x1f,0xf1,0x0b,0x00,0x5d,0x12,0xee,0x01,0x00,
+0x00,0x0b,0x00,0x04,0x01,0x00,0x0a,0x0b,0x00,0x0f,0x9a,0x00,0x66,0x05,0x0b,0x00,
+0x00,0x07,0x00,0x53,0x59,0xce,0xff,0xec,0x95,0x69,0x02,0x11,0x7e,0x9b,0x00,0x11,
+0xe7,0x0c,0x00,0x90,0x2d,0xff,0xff,0xff,0xee,0xff,0xff,0xff,0xd2,0x75,0x02,0xa0,
+0xef,0xff,0xd7,0x20,0x00,0x02,0x7e,0xff,0xfe,0x20,0xb7,0x01,0x12,0xf8,0x56,0x02,
+0x00,0x36,0x02,0x33,0x8f,0xff,0x70,0x8a,0x02,0x55,0xf8,0x00,0x01,0xff,0xfb,0xb1,
+0x02,0x45,0x10,0x07,0xff,0xf2,0xee,0x07,0x22,0x70,0x0c,0x7e,0x04,0x01,0xf0,0x03,
+0x21,0xb0,0x0f,0x61,0x03,0x02,0x35,0x00,0x12,0xf0,0xaa,0x04,0x03,0x3b,0x08,0x01,
+0x77,0x05,0x03,0x35,0x08,0x20,0xf3,0x4f,0x64,0x04,0x03,0xf3,0x02,0x19,0xf4,0x0d,
+0x00,0x09,0x27,0x00,0x36,0x1f,0xff,0x50,0x41,0x00,0x08,0x5b,0x00,0x45,0xe0,0x0b,
+0xff,0xd0,0x75,0x00,0x45,0xa0,0x06,0xff,0xf3,0x8f,0x00,0x44,0x50,0x00,0xff,0xfc,
+0xa9,0x00,0x10,0xfe,0x6b,0x03,0x14,0x90,0x40,0x08,0x00,0xbd,0x04,0x02,0x76,0x08,
+0x31,0x8f,0xff,0xb0,0xd0,0x06,0x70,0xe7,0x10,0x00,0x02,0x6d,0xff,0xfd,0x3a,0x03,
+0x97,0x1c,0xff,0xff,0xfe,0xdd,0xff,0xff,0xff,0xb1,0x2b,0x01,0x13,0xe6,0x48,0x00,
+0x00,0x45,0x01,0x11,0x94,0xcc,0x05,0x05,0xe1,0x01,0x19,0xf0,0x0b,0x00,0x11,0xfe,
+0x0c,0x02,0x10,0xef,0x0b,0x00,0x13,0x40,0xae,0x00,0x0f,0x0b,0x00,0xe0,0x02,0xff,
+0x02,0x25,0xed,0x94,0xee,0x05,0xe3,0xff,0xfd,0x20,0x00,0x0f,0xff,0xdc,0xcc,0xcc,
+0xcc,0xef,0xff,0xff,0x30,0x1a,0x06,0x23,0x18,0xff,0xff,0x06,0x00,0x34,0x00,0x12,
+0xf7,0x15,0x00,0x00,0x98,0x05,0x14,0xc0,0xba,0x02,0x24,0x6f,0xff,0x15,0x00,0x07,
+0xcf,0x02,0x33,0x4f,0xff,0x10,0x15,0x00,0x16,0x06,0xf7,0x03,0x24,0xbf,0xfc,0x2a,
+0x00,0x33,0x5f,0xff,0x60,0x82,0x06,0xe4,0x7f,0xff,0xc0,0x00,0xff,0xfd,0xbb,0xbb,
+0xbb,0xcd,0xff,0xff,0xe2,0x00,0x92,0x03,0x13,0xb1,0x93,0x00,0x33,0xfe,0xc9,0x30,
+0xd2,0x06,0x02,0x01,0x00,0x05,0x72,0x0a,0x0f,0x15,0x00,0x42,0x09,0x3c,0x02,0x09,
+0x55,0x02,0x13,0x1c,0x7f,0x03,0x10,0xa0,0x65,0x07,0x85,0xff,0xe7,0x20,0x00,0x03,
+0x8f,0xff,0xfb,0xa0,0x02,0x45,0x01,0xcf,0xff,0x70,0xb9,0x02,0x63,0x0d,0xff,0xf1,
+0x00,0xef,0xfd,0x12,0x03,0x53,0xfe,0x92,0x05,0xff,0xf4,0x5a,0x00,0x76,0x30,0x00,
+0x0a,0xff,0xe0,0x00,0x00,0x06,0x03,0x07,0x82,0x09,0x15,0x60,0x0c,0x00,0x16,0x1f,
+0x99,0x00,0x03,0x39,0x08,0x0e,0x0c,0x00,0x08,0x24,0x00,0x13,0x0f,0xf3,0x03,0x03,
+0xcf,0x03,0x05,0x0c,0x00,0x13,0x09,0xcc,0x09,0x02,0x98,0x01,0x13,0xf6,0x0a,0x00,
+0x63,0x7c,0x40,0x00,0xdf,0xfe,0x10,0xbb,0x03,0x33,0xf6,0x00,0x5f,0x0a,0x04,0x00,
+0x25,0x08,0x51,0x0b,0xff,0xfc,0x10,0x00,0x85,0x0b,0x10,0x40,0x6b,0x03,0x20,0xf8,
+0x30,0xe4,0x00,0x00,0xde,0x05,0x10,0x1b,0x25,0x02,0x22,0xff,0xff,0xa4,0x00,0x11,
+0x6e,0x14,0x01,0x15,0xb2,0x2c,0x01,0x21,0xeb,0x82,0xc5,0x03,0x04,0x01,0x00,0x17,
+0xf2,0x0b,0x00,0xb2,0x2d,0xdd,0xdd,0xdd,0xdf,0xff,0xfd,0xdd,0xdd,0xdd,0xd2,0x32,
+0x02,0x05,0xf1,0x00,0x0f,0x0b,0x00,0xdb,0x12,0x0b,0xda,0x05,0x00,0x66,0x01,0x44,
+0xc0,0x02,0xff,0xfa,0x6d,0x0b,0x12,0x40,0xb8,0x09,0x02,0x17,0x03,0x42,0x00,0x1e,
+0xff,0xb0,0x43,0x05,0x10,0xf4,0x32,0x03,0x16,0xf4,0x55,0x0d,0x26,0xdf,0xfd,0xc0,
+0x0d,0x11,0x4f,0x84,0x01,0x11,0xaf,0xd8,0x05,0x01,0x4c,0x02,0x32,0x02,0xff,0xf3,
+0xcb,0x01,0x13,0xf7,0x24,0x09,0x01,0x2c,0x05,0x13,0x10,0x21,0x09,0x00,0x72,0x0d,
+0x13,0x90,0x4c,0x09,0x00,0xbd,0x03,0x25,0xf2,0x00,0x06,0x06,0x55,0xcf,0xfb,0x07,
+0xff,0xa0,0x83,0x05,0x35,0x4e,0xff,0x20,0x36,0x02,0x05,0xde,0x0d,0x00,0xf2,0x0b,
+0x04,0x2f,0x00,0x06,0x97,0x05,0x02,0x7f,0x02,0x15,0x20,0x0c,0x00,0x14,0x9f,0x17,
+0x0e,0x04,0xd5,0x09,0x04,0xfb,0x00,0x15,0x80,0x0c,0x00,0x23,0x5f,0xfe,0x71,0x0c,
+0x26,0x39,0x10,0x89,0x02,0x21,0xcf,0xfd,0x52,0x0a,0x02,0xf4,0x00,0x15,0xff,0x02,
+0x06,0xc0,0x00,0x39,0xdf,0xfc,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,
+0x01,0x00,0x21,0xff,0xf5,0x07,0x00,0x0f,0x0c,0x00,0x08,0x61,0x25,0x78,0xff,0xfb,
+0x76,0x30,0x0b,0x00,0x21,0x7e,0xff,0x01,0x00,0x63,0x92,0x00,0x00,0x00,0x2d,0xff,
+0x01,0x00,0xf1,0x02,0x50,0x00,0x01,0xef,0xff,0xa4,0x10,0xff,0xf5,0x13,0x8e,0xff,
+0xf5,0x00,0x0b,0xff,0xf4,0x3c,0x00,0x72,0x01,0xdf,0xff,0x10,0x2f,0xff,0x60,0x48,
+0x00,0x53,0x2f,0xff,0x80,0x8f,0xfe,0x54,0x00,0x53,0x09,0xff,0xd0,0xbf,0xfa,0x0c,
+0x00,0x53,0x05,0xff,0xf1,0xdf,0xf8,0x0c,0x00,0x53,0x02,0xff,0xf3,0xef,0xf7,0x0c,
+0x00,0x47,0x01,0xff,0xf4,0xef,0x18,0x00,0x23,0xcf,0xf9,0x0c,0x00,0x53,0x03,0xff,
+0xf2,0x8f,0xfd,0x0c,0x00,0x62,0x07,0xff,0xe0,0x3f,0xff,0x30,0x0c,0x00,0x62,0x0d,
+0xff,0x90,0x0c,0xff,0xd0,0x0c,0x00,0x70,0x8f,0xff,0x20,0x02,0xff,0xfd,0x30,0x0c,
+0x00,0xf2,0x04,0x19,0xff,0xf7,0x00,0x00,0x5f,0xff,0xfc,0x98,0xff,0xfa,0x8b,0xff,
+0xff,0x90,0x00,0x00,0x02,0xdf,0xb3,0x00,0x10,0xf6,0xcc,0x00,0x8e,0x05,0xad,0xff,
+0xff,0xff,0xfe,0xb7,0x10,0xfc,0x00,0x0f,0x0c,0x00,0x0d,0x32,0x02,0xff,0xf9,0x10,
+0x00,0x72,0x8f,0xff,0x30,0x00,0x6f,0xff,0x40,0x14,0x00,0x60,0xf8,0x00,0x00,0x0b,
+0xff,0xd0,0x0c,0x00,0x71,0x0c,0xff,0xc0,0x00,0x00,0x01,0xef,0x25,0x00,0x40,0x7f,
+0xff,0x20,0x00,0x85,0x00,0x10,0x40,0x23,0x00,0x10,0xf7,0x12,0x00,0x32,0x0a,0xff,
+0xe0,0x23,0x00,0x00,0x01,0x00,0x24,0xef,0xf9,0x23,0x00,0x82,0x00,0x00,0x4f,0xff,
+0x40,0x02,0xff,0xf6,0x5a,0x00,0x63,0x08,0xff,0xe1,0x0c,0xff,0xb0,0x77,0x00,0x44,
+0xdf,0xfa,0x6f,0xfe,0xa7,0x00,0x26,0x2f,0xff,0x91,0x00,0x45,0x07,0xff,0xff,0xa0,
+0x9c,0x00,0x37,0xef,0xff,0x30,0x18,0x00,0x26,0xc0,0x00,0x30,0x00,0x25,0xf8,0x00,
+0x48,0x00,0x37,0x7f,0xff,0x30,0x60,0x00,0x26,0xd0,0x00,0x78,0x00,0x02,0x25,0x00,
+0x12,0x01,0x90,0x00,0x17,0x30,0xa8,0x00,0x26,0xd0,0x00,0xc0,0x00,0x27,0xf8,0x00,
+0xd8,0x00,0x17,0x30,0xf0,0x00,0x15,0xd0,0x36,0x00,0x00,0x1c,0x01,0x04,0x4e,0x00,
+0x00,0x14,0x00,0x13,0x0d,0x66,0x00,0x00,0x25,0x00,0x31,0x0f,0xff,0x50,0x0b,0x00,
+0x4f,0x06,0xff,0xe0,0x00,0x0c,0x00,0xf7,0x11,0xee,0x01,0x00,0x66,0xef,0xff,0xfe,
+0xee,0x0f,0xff,0x01,0x00,0x08,0x0c,0x00,0x06,0x81,0x02,0x1f,0x3f,0x0c,0x00,0x42,
+0x12,0x3f,0x81,0x02,0x3f,0x04,0xff,0xf1,0x0a,0x00,0x51,0x33,0x2f,0xff,0x30,0x0a,
+0x00,0x33,0x1f,0xff,0x60,0x0a,0x00,0x02,0x26,0x02,0x00,0x0a,0x00,0xc3,0x07,0xff,
+0xfd,0x51,0x00,0x12,0x57,0xae,0xff,0xf1,0x00,0xcf,0xff,0x00,0x31,0xf1,0x00,0x1a,
+0x08,0x00,0xd3,0xfd,0xff,0xf1,0x00,0x00,0x26,0xab,0xcb,0xa8,0x63,0x04,0xff,0xf1,
+0xbd,0x00,0x0f,0x0a,0x00,0x36,0x02,0x94,0x01,0x32,0x1f,0xff,0x20,0x1e,0x01,0x01,
+0x65,0x03,0x40,0x01,0xff,0xf2,0x00,0x75,0x04,0x1f,0xf0,0x1d,0x00,0xff,0x20,0x10,
+0xfe,0xd4,0x02,0x03,0x06,0x00,0x17,0xf0,0xcc,0x02,0x00,0xce,0x02,0x09,0x0e,0x00,
+0x03,0x3a,0x00,0x21,0x7f,0xfc,0x60,0x05,0x13,0xf4,0x64,0x05,0x11,0x07,0xc1,0x04,
+0x4f,0x0f,0xff,0x40,0x00,0x1f,0x00,0xff,0x35,0x13,0xfe,0x63,0x04,0x00,0x06,0x00,
+0x2a,0xee,0xe4,0x91,0x01,0x2a,0xff,0x50,0x0f,0x00,0x28,0xf5,0x00,0x01,0x00,0x13,
+0x0d,0xad,0x04,0x05,0x45,0x06,0x0f,0x1f,0x00,0x4b,0x15,0x0f,0x12,0x00,0x0f,0x0a,
+0x00,0x53,0x84,0xdc,0xcc,0xcc,0xcc,0xb9,0x50,0x00,0x00,0x13,0x01,0x15,0x80,0x0a,
+0x00,0x13,0xfc,0x28,0x00,0x43,0x27,0xef,0xff,0xa0,0x32,0x00,0x33,0x0b,0xff,0xf3,
+0x0a,0x00,0x34,0x01,0xff,0xf8,0x46,0x00,0x24,0xbf,0xfa,0x0a,0x00,0x25,0xaf,0xfb,
+0x14,0x00,0x05,0x0a,0x00,0x14,0xef,0x28,0x00,0x32,0x07,0xff,0xf2,0x0a,0x00,0x20,
+0x02,0x9f,0x50,0x00,0x75,0xdb,0xbb,0xbb,0xbc,0xef,0xff,0xfc,0x6e,0x00,0x13,0x90,
+0x0a,0x00,0x26,0xec,0x82,0xa0,0x00,0x56,0x38,0xce,0xff,0xec,0x94,0x78,0x08,0x21,
+0x03,0xcf,0x06,0x05,0x13,0x40,0x21,0x00,0x00,0xe7,0x07,0x21,0xff,0xee,0xb3,0x00,
+0x04,0xff,0x01,0x52,0xff,0x93,0x00,0x00,0x38,0x4c,0x00,0x10,0x50,0xd6,0x04,0x31,
+0xfe,0x20,0x00,0xf5,0x08,0x12,0x60,0x21,0x00,0x32,0xdf,0xfe,0x20,0xe5,0x07,0x12,
+0xfe,0x21,0x00,0x33,0x5f,0xff,0x50,0xff,0x04,0x11,0xf7,0x21,0x00,0x1c,0x0b,0xac,
+0x07,0x23,0xff,0xf7,0x28,0x01,0x30,0x6f,0xff,0x10,0x21,0x00,0x12,0x3f,0xec,0x08,
+0x00,0xe6,0x07,0x01,0xa9,0x01,0x35,0x05,0xff,0xf0,0x49,0x01,0x1a,0x70,0xac,0x06,
+0x22,0xdf,0xf9,0xd0,0x00,0x24,0xe0,0x00,0x53,0x00,0x10,0x90,0x7f,0x02,0x0a,0x21,
+0x00,0x35,0x50,0x00,0x07,0x42,0x00,0x50,0x0e,0xff,0x80,0xff,0xf5,0x94,0x00,0x05,
+0x91,0x09,0x10,0xf7,0x21,0x00,0x35,0x03,0xff,0xf5,0xca,0x08,0x10,0x40,0x0c,0x00,
+0x10,0x0f,0xc9,0x09,0x02,0x3e,0x07,0x02,0xb5,0x05,0x23,0xaf,0xfe,0x21,0x00,0x21,
+0xcf,0xfc,0xc6,0x00,0x00,0xce,0x00,0x03,0xd8,0x08,0x11,0x50,0x21,0x00,0x31,0x0d,
+0xff,0xf3,0x10,0x00,0x32,0x1d,0xff,0xd0,0x08,0x01,0x32,0x3f,0xff,0xe3,0x10,0x00,
+0x13,0xf4,0x4a,0x01,0x94,0x6f,0xff,0xf9,0x30,0x00,0x02,0x8f,0xff,0xf7,0x6b,0x01,
+0x51,0x6f,0xff,0xff,0xfd,0xdf,0x28,0x0a,0x03,0x8c,0x01,0x11,0x3c,0xcd,0x00,0x16,
+0xc3,0x04,0x0a,0x53,0x03,0x8c,0xef,0xfe,0xc8,0x4d,0x09,0x13,0x6a,0x57,0x0a,0x44,
+0x10,0x00,0x05,0xef,0xb4,0x06,0x00,0x8e,0x01,0xc4,0xfd,0xcc,0xcc,0xcc,0xcc,0xdf,
+0xff,0x10,0x03,0xff,0xff,0x61,0x71,0x06,0x15,0xbf,0xed,0x09,0x44,0x10,0x1f,0xff,
+0x70,0x7e,0x06,0x11,0x03,0x48,0x05,0x02,0x17,0x00,0x34,0x4f,0xff,0x10,0x17,0x00,
+0x05,0xa2,0x06,0x10,0x4f,0x4d,0x0b,0x15,0x40,0xb6,0x06,0x25,0xef,0xfa,0x17,0x00,
+0x35,0x07,0xff,0xf6,0x17,0x00,0x43,0x0d,0xff,0xfb,0x41,0x17,0x00,0x06,0x9f,0x0b,
+0x10,0xf1,0x73,0x0b,0x03,0x01,0x00,0x00,0x59,0x00,0x81,0x9f,0xff,0xcc,0xcc,0xcc,
+0xcd,0xff,0xf1,0xaf,0x05,0x13,0x80,0x2e,0x00,0x03,0xfb,0x01,0x01,0x70,0x00,0x34,
+0x05,0xff,0xf4,0x45,0x00,0x35,0x01,0xef,0xfa,0x29,0x07,0x34,0xaf,0xfe,0x10,0x17,
+0x00,0x15,0x5f,0xb8,0x07,0x44,0x00,0x1e,0xff,0xc0,0x8a,0x00,0x34,0x0a,0xff,0xf2,
+0x8a,0x00,0x34,0x05,0xff,0xf8,0xa1,0x00,0x37,0x11,0xef,0xfd,0x6e,0x07,0x52,0x28,
+0xce,0xff,0xeb,0x60,0x80,0x0a,0x00,0x7d,0x0b,0x11,0x30,0x44,0x0b,0x53,0xd9,0x88,
+0xaf,0xff,0xe2,0x56,0x0b,0x31,0x02,0xef,0xfa,0xdb,0x0b,0x01,0x74,0x0a,0x55,0x00,
+0x00,0x01,0x34,0x40,0x57,0x06,0x02,0x67,0x02,0x01,0x73,0x01,0x40,0x12,0x34,0x44,
+0x4f,0x0a,0x00,0x21,0x03,0xae,0xd7,0x00,0x10,0x30,0xd6,0x00,0x03,0x0a,0x00,0x42,
+0x07,0xff,0xfd,0x52,0x28,0x00,0x33,0x0f,0xff,0xb0,0x32,0x00,0x02,0x52,0x01,0x10,
+0x1f,0xad,0x0b,0x12,0xfd,0xce,0x0a,0x41,0x30,0x00,0x7f,0xfd,0x33,0x02,0x21,0xff,
+0x30,0x68,0x00,0x00,0xae,0x01,0x21,0x40,0x00,0x91,0x01,0xf0,0x01,0x8f,0xad,0xff,
+0x70,0x00,0x0a,0xff,0xfb,0x76,0x9e,0xfd,0x1a,0xff,0xf7,0x60,0x01,0xdc,0x01,0xe3,
+0xd1,0x04,0xff,0xff,0xf0,0x00,0x07,0xcf,0xfd,0xb5,0x00,0x00,0x5d,0xfe,0x74,0x0b,
+0x21,0x03,0x58,0x96,0x00,0x21,0x47,0xad,0x81,0x00,0x23,0x02,0x9f,0x8a,0x00,0xe1,
+0x7f,0xff,0xff,0xff,0xdb,0x86,0x10,0x00,0x09,0xff,0xfe,0xa6,0x30,0x00,0x86,0x05,
+0x13,0x40,0x34,0x03,0x13,0xa0,0x7c,0x0b,0x14,0xfe,0xf3,0x02,0x14,0xf7,0x83,0x09,
+0xa1,0xf2,0x00,0x6b,0xef,0xec,0x81,0x00,0x00,0x6f,0xf0,0xb8,0x01,0xe0,0x60,0x00,
+0x9f,0xd1,0xef,0xd8,0x77,0xaf,0xff,0xf5,0x00,0xbf,0xba,0xf7,0xc3,0x03,0x51,0xfe,
+0x00,0xcf,0xdf,0x80,0xbb,0x02,0x41,0x50,0xdf,0xff,0x10,0x50,0x03,0x32,0xa0,0xdf,
+0xfc,0x58,0x04,0x20,0xd0,0xdf,0x92,0x0b,0x00,0x8d,0x03,0x22,0xdf,0xf7,0x6a,0x01,
+0x41,0xf0,0xcf,0xf7,0x00,0x98,0x07,0x24,0xf1,0xaf,0x12,0x00,0x14,0x8f,0x24,0x00,
+0x22,0x5f,0xfb,0x80,0x01,0x33,0xc0,0x0f,0xff,0x98,0x03,0x31,0x0a,0xff,0x70,0x5a,
+0x00,0x21,0x30,0x02,0x70,0x0d,0x20,0xef,0xfb,0xc5,0x00,0x52,0xc8,0x67,0xbf,0xff,
+0xe1,0x64,0x04,0x40,0xff,0xfc,0x10,0x00,0xbb,0x01,0x60,0xfe,0xd9,0x40,0x00,0x00,
+0x8f,0xb8,0x01,0x43,0xc7,0x10,0x00,0x8f,0x2b,0x06,0xa1,0x8f,0xfd,0x88,0x88,0x8b,
+0xff,0xff,0x30,0x8f,0xfa,0xa3,0x03,0x31,0xb0,0x8f,0xfa,0x5e,0x00,0x11,0xe0,0x08,
+0x00,0x13,0x06,0x08,0x00,0x13,0x07,0x18,0x00,0xa2,0x1d,0xff,0x40,0x8f,0xfc,0x55,
+0x55,0x69,0xef,0xf5,0x40,0x00,0x14,0xf9,0x48,0x00,0x20,0xe8,0x00,0x20,0x00,0x61,
+0x02,0x7e,0xff,0xa0,0x8f,0xfa,0xb9,0x00,0x31,0xf3,0x8f,0xfa,0x3e,0x05,0x12,0xf7,
+0x08,0x00,0x22,0xdf,0xf8,0x08,0x00,0x23,0xff,0xf6,0x60,0x00,0x92,0xf2,0x8f,0xfc,
+0x66,0x66,0x68,0xcf,0xff,0x90,0x40,0x00,0x12,0xf9,0x98,0x00,0x22,0xc8,0x20,0x50,
+0x00,0x11,0x18,0xf9,0x02,0x00,0x23,0x00,0x21,0x66,0x08,0x76,0x01,0x03,0x36,0x00,
+0x0f,0x0b,0x00,0x39,0x50,0xff,0xa0,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x9f,0xff,
+0xff,0xff,0xff,0xfd,0x00,0x00,0x00,0x00,0x0b,0x0a,0x00,0x20,0xff,0xd0,0x0b,0x00,
+0x51,0xdf,0xf8,0x66,0x66,0x9f,0x15,0x00,0x51,0x0f,0xff,0x20,0x00,0x05,0x15,0x00,
+0x61,0x01,0xff,0xf0,0x00,0x00,0x5f,0x15,0x00,0x33,0x3f,0xfd,0x00,0x15,0x00,0x34,
+0x06,0xff,0xa0,0x15,0x00,0x24,0x9f,0xf8,0x15,0x00,0x34,0x0b,0xff,0x50,0x15,0x00,
+0x24,0xff,0xf2,0x15,0x00,0x33,0x2f,0xff,0x00,0x15,0x00,0x34,0x06,0xff,0xc0,0x15,
+0x00,0x24,0xaf,0xf8,0x15,0x00,0x33,0x0e,0xff,0x40,0x15,0x00,0x34,0x03,0xff,0xf0,
+0x15,0x00,0x33,0x9f,0xfb,0x00,0x15,0x00,0x32,0x0f,0xff,0x50,0x15,0x00,0xd4,0x03,
+0x6a,0xff,0xf6,0x66,0x66,0x66,0x69,0xff,0xe6,0x62,0xaf,0xff,0x01,0x00,0x15,0x6a,
+0x0a,0x00,0x41,0xf6,0xaf,0xf3,0x00,0x01,0x00,0x52,0x07,0xff,0x6a,0xff,0x30,0x0b,
+0x00,0x1f,0x7f,0x15,0x00,0x2d,0xf1,0x16,0x00,0x00,0x05,0xad,0xff,0xeb,0x60,0x00,
+0x00,0x00,0x03,0xdf,0xff,0xff,0xff,0xfe,0x40,0x00,0x00,0x3f,0xff,0xfa,0x77,0x9e,
+0xff,0xf4,0x00,0x00,0xdf,0xfb,0x10,0x00,0x00,0xaf,0xfe,0x00,0x07,0xd0,0x00,0x61,
+0x0d,0xff,0x70,0x0d,0xff,0x60,0xe4,0x00,0x42,0xd0,0x1f,0xff,0x10,0x36,0x01,0x21,
+0x4f,0xff,0x48,0x00,0x33,0xef,0xf3,0x6f,0xa5,0x00,0x24,0xf5,0x7f,0xae,0x00,0x31,
+0x6f,0xfe,0x88,0x01,0x00,0x42,0x83,0x6f,0xfe,0x00,0x01,0x00,0x23,0x4f,0xff,0x09,
+0x00,0x14,0x1f,0x80,0x00,0x30,0x0d,0xff,0x80,0x07,0x00,0x51,0x51,0x00,0x07,0xff,
+0xf2,0x5a,0x00,0xf3,0x03,0x90,0x00,0xdf,0xfd,0x20,0x00,0x00,0x6f,0xff,0x50,0x00,
+0x3f,0xff,0xfb,0x87,0x9d,0xff,0xfa,0x99,0x00,0x00,0x29,0x00,0x00,0xab,0x00,0x50,
+0xec,0x82,0x00,0x00,0x6f,0x40,0x01,0xa1,0x8f,0xfa,0x00,0x00,0x00,0xcf,0xf7,0x0c,
+0xff,0x70,0x0c,0x00,0x00,0x4b,0x01,0x32,0x03,0xff,0xf1,0x0c,0x00,0x00,0x71,0x01,
+0x22,0x9f,0xf9,0x0c,0x00,0x02,0x10,0x00,0x10,0x20,0x08,0x00,0x30,0x02,0xff,0xe1,
+0x28,0x00,0x10,0xb0,0x0c,0x00,0x11,0x0b,0xcb,0x00,0x20,0xbf,0xf5,0x0c,0x00,0x21,
+0x4f,0xfc,0x95,0x00,0x81,0xfe,0x10,0x8f,0xfa,0x01,0xef,0xf2,0x00,0x98,0x01,0x61,
+0xd3,0x8f,0xfa,0x2c,0xff,0x60,0xa5,0x00,0x01,0x7f,0x00,0x02,0xc4,0x00,0x12,0x05,
+0xdc,0x00,0x21,0x70,0x00,0xd6,0x01,0x70,0x44,0xbf,0xfc,0x43,0xff,0xf1,0x00,0x8d,
+0x00,0x10,0xfb,0x48,0x00,0x80,0xaf,0xf9,0x00,0x00,0x00,0x02,0xff,0xf2,0x0c,0x00,
+0x01,0xe3,0x00,0x30,0x0b,0xff,0xa0,0x0c,0x00,0x30,0x08,0xff,0xc0,0xfd,0x00,0x10,
+0x10,0x0c,0x00,0x30,0x01,0xef,0xf5,0x83,0x02,0x02,0x98,0x00,0x64,0x7f,0xfe,0x00,
+0x06,0xff,0xe1,0xa4,0x00,0x24,0x80,0x1e,0xcc,0x00,0x54,0x06,0xff,0xf1,0x9f,0xfe,
+0xe4,0x00,0xc0,0xdf,0xfa,0x00,0x00,0x5b,0xef,0xfe,0xb6,0x00,0x00,0x00,0x1c,0x7d,
+0x00,0xd0,0xd2,0x00,0x00,0xbf,0xff,0xa8,0x7a,0xff,0xfe,0x00,0x03,0xff,0xe2,0x7c,
+0x02,0x91,0x70,0x03,0xab,0x60,0x00,0x00,0x0a,0xff,0xa0,0xa3,0x00,0x13,0x09,0x08,
+0x00,0x11,0x1e,0x56,0x02,0x41,0x01,0x37,0xef,0xfb,0xac,0x02,0x32,0xff,0xfe,0x80,
+0x08,0x00,0x20,0xe8,0x20,0x08,0x00,0x41,0x89,0xbf,0xff,0xf7,0x27,0x00,0x23,0x01,
+0x9f,0xe6,0x00,0x31,0x0a,0xff,0xe0,0x08,0x00,0x52,0x04,0xff,0xf1,0x00,0x14,0x08,
+0x00,0x30,0x0c,0xff,0x10,0x2e,0x02,0xf0,0x04,0xf0,0x0a,0xff,0xd1,0x00,0x00,0x2e,
+0xff,0xa0,0x01,0xef,0xff,0xa7,0x7a,0xff,0xff,0x20,0x00,0x3e,0x88,0x00,0x51,0xe3,
+0x00,0x00,0x00,0x6b,0x98,0x00,0x12,0x8f,0xf8,0x00,0x11,0xf9,0x08,0x00,0x13,0x0a,
+0x08,0x00,0x13,0x3f,0x08,0x00,0x12,0xcf,0x08,0x00,0x31,0x04,0xff,0xdf,0x08,0x00,
+0x31,0x0d,0xfe,0x6f,0x08,0x00,0x31,0x6f,0xf7,0x5f,0x08,0x00,0x21,0xef,0xd0,0x10,
+0x00,0x31,0x07,0xff,0x50,0x08,0x00,0xa1,0x1f,0xfc,0x00,0x6f,0xf9,0x8f,0xf8,0x00,
+0x9f,0xf3,0x08,0x00,0x31,0x02,0xff,0xa0,0x08,0x00,0x30,0x0a,0xff,0x10,0x08,0x00,
+0x41,0xf7,0x3f,0xf8,0x00,0x08,0x00,0x21,0xcf,0xe0,0x08,0x00,0x31,0xfb,0xff,0x60,
+0x08,0x00,0x01,0xe4,0x03,0x00,0x08,0x00,0x13,0xf4,0x08,0x00,0x13,0xb0,0x08,0x00,
+0x11,0x20,0x08,0x00,0x90,0x02,0x88,0x40,0x00,0x00,0x03,0x88,0x40,0x04,0x18,0x00,
+0x31,0x08,0xff,0x60,0xba,0x03,0xd0,0x0e,0xff,0x30,0x00,0x9f,0xfd,0x51,0x03,0xcf,
+0xfc,0x00,0x00,0x1d,0xd0,0x00,0x90,0xe2,0x00,0x00,0x00,0x7d,0xff,0xff,0xe9,0x10,
+0x06,0x01,0x36,0x12,0x21,0x00,0x01,0x00,0x0f,0xe0,0x00,0x8d,0x21,0x9f,0xf9,0x0b,
+0x03,0x21,0x9f,0xf9,0x9c,0x03,0x21,0x9f,0xf9,0xdd,0x00,0x01,0x00,0x03,0x10,0xf9,
+0x07,0x03,0x00,0xf7,0x02,0x20,0x9f,0xf9,0xf2,0x02,0x00,0x07,0x00,0x61,0x5f,0xfc,
+0x00,0x00,0x9f,0xf9,0xe8,0x02,0x51,0x9f,0xf9,0x3d,0xff,0x60,0x26,0x05,0x13,0xfe,
+0x2d,0x05,0x10,0x60,0x98,0x04,0x30,0x44,0xff,0xe1,0x1c,0x00,0x00,0xcf,0x02,0x00,
+0x07,0x00,0x30,0x2f,0xff,0x20,0x07,0x00,0x30,0x09,0xff,0xb0,0x07,0x00,0x31,0x01,
+0xff,0xf5,0x5b,0x03,0x32,0x7f,0xfd,0x00,0x69,0x00,0x32,0x70,0x9f,0xf9,0xb1,0x02,
+0x13,0xf9,0xac,0x02,0x33,0x02,0xff,0xff,0xb0,0x03,0x11,0x4f,0x09,0x00,0x10,0xf8,
+0x1f,0x00,0x63,0xd6,0x66,0x66,0x6c,0xff,0x80,0x4b,0x01,0x00,0x1a,0x05,0x10,0x0a,
+0xec,0x02,0x10,0x0a,0x13,0x00,0x23,0xcf,0xf5,0x13,0x00,0x32,0x0f,0xff,0x30,0x13,
+0x00,0x01,0x8e,0x05,0x01,0x13,0x00,0x32,0x3f,0xfe,0x00,0x13,0x00,0x33,0x05,0xff,
+0xc0,0x13,0x00,0x23,0x7f,0xf9,0x13,0x00,0x33,0x0a,0xff,0x60,0x13,0x00,0x23,0xdf,
+0xf3,0x13,0x00,0x32,0x0f,0xff,0x00,0x13,0x00,0x33,0x03,0xff,0xd0,0x13,0x00,0x23,
+0x8f,0xf8,0x13,0x00,0x00,0xf0,0x01,0x00,0x13,0x00,0x42,0x82,0x2a,0xff,0xc0,0x13,
+0x00,0x32,0xdf,0xff,0xf2,0xf9,0x02,0x42,0x8d,0xfe,0xb2,0x00,0x13,0x00,0x32,0x8f,
+0xff,0xf9,0x44,0x03,0x32,0xff,0x48,0xff,0x10,0x03,0x51,0xef,0xff,0xf4,0x8f,0xff,
+0x3b,0x00,0x10,0x3f,0x15,0x00,0x21,0xaf,0xf8,0x1f,0x00,0x60,0xbf,0xf4,0x8f,0xf8,
+0xdf,0xd0,0x1f,0x00,0x50,0xbb,0xff,0x48,0xff,0x88,0x88,0x01,0x20,0x3f,0xf6,0x15,
+0x00,0x20,0x3f,0xf7,0x62,0x02,0xf0,0x07,0x1c,0xff,0x48,0xff,0x90,0xef,0xc0,0x00,
+0x00,0xdf,0xc0,0xcf,0xf4,0x8f,0xf9,0x09,0xff,0x10,0x00,0x2f,0xf7,0x0c,0x15,0x00,
+0x60,0x4f,0xf6,0x00,0x07,0xff,0x20,0x15,0x00,0x61,0x00,0xef,0xb0,0x00,0xcf,0xd0,
+0x15,0x00,0x61,0x09,0xff,0x10,0x1f,0xf8,0x00,0x15,0x00,0x51,0x4f,0xf5,0x06,0xff,
+0x30,0x15,0x00,0x52,0x00,0xff,0xa0,0xaf,0xd0,0x15,0x00,0x52,0x0a,0xfe,0x0f,0xf8,
+0x00,0x15,0x00,0x42,0x5f,0xf4,0xff,0x30,0x15,0x00,0x43,0x00,0xff,0xaf,0xe0,0x15,
+0x00,0x10,0x0a,0xb6,0x00,0x02,0x15,0x00,0x33,0x5f,0xff,0x40,0x15,0x00,0x31,0x00,
+0xff,0xf0,0x15,0x00,0x20,0xfa,0x00,0x1d,0x02,0x1f,0xf6,0x08,0x00,0x26,0x83,0xfc,
+0x66,0x66,0x66,0x66,0xdf,0xf6,0x8f,0xd6,0x05,0x05,0x08,0x00,0x0f,0x58,0x00,0x2d,
+0x03,0x08,0x00,0x70,0x00,0x00,0x06,0xbe,0xff,0xeb,0x71,0x71,0x04,0x22,0xef,0xff,
+0x82,0x02,0xa1,0x5f,0xff,0xea,0x77,0x9e,0xff,0xf7,0x00,0x01,0xef,0x80,0x06,0x51,
+0xff,0x20,0x08,0xff,0xe0,0x2c,0x06,0x41,0x90,0x0e,0xff,0x70,0x26,0x06,0x10,0xf0,
+0x94,0x02,0x01,0x6b,0x05,0x12,0x5f,0x53,0x06,0x23,0xff,0xf5,0x65,0x06,0x42,0xef,
+0xf6,0x7f,0xfd,0xb5,0x05,0x15,0xf7,0x09,0x00,0x05,0x1b,0x00,0x14,0x4f,0x2d,0x00,
+0x01,0x80,0x06,0x00,0x3f,0x00,0x31,0x0d,0xff,0x70,0x11,0x07,0x20,0xe0,0x07,0x63,
+0x00,0x00,0x84,0x05,0x01,0x75,0x00,0x82,0x01,0xbf,0xfe,0x10,0x00,0x4f,0xff,0xe9,
+0x07,0x07,0x23,0x04,0xef,0x19,0x07,0x00,0xab,0x00,0x43,0xea,0x60,0x00,0x00,0x04,
+0x01,0x13,0xf8,0xea,0x06,0x01,0x23,0x01,0x51,0x67,0xff,0xf8,0xff,0xa0,0x0b,0x08,
+0x01,0xda,0x00,0x1f,0x02,0x0f,0x00,0x5f,0xf0,0x0e,0xaf,0xf6,0x00,0x6c,0xef,0xeb,
+0x60,0x00,0x09,0xff,0x71,0xcf,0xff,0xff,0xff,0xc1,0x00,0x9f,0xf8,0xcf,0xfa,0x89,
+0xef,0xff,0xc0,0x09,0xff,0xef,0xa0,0xdf,0x03,0x21,0x50,0x9f,0xfa,0x02,0x51,0xcf,
+0xfc,0x09,0xff,0xf4,0xcc,0x06,0x32,0xf1,0x9f,0xff,0x8e,0x07,0x12,0x39,0x13,0x03,
+0x42,0xff,0xf6,0x9f,0xfa,0x96,0x07,0x32,0x79,0xff,0x90,0x3c,0x01,0x24,0x9f,0xf9,
+0x11,0x00,0x13,0xa0,0x11,0x00,0x12,0xfb,0x3a,0x09,0x31,0x59,0xff,0xe0,0x02,0x08,
+0x21,0xf3,0x9f,0x8b,0x01,0x51,0x5f,0xff,0x09,0xff,0xfa,0x1f,0x09,0x40,0xb0,0x9f,
+0xfe,0xf7,0x53,0x01,0xf1,0x0a,0xf4,0x09,0xff,0x9d,0xfd,0x86,0x7c,0xff,0xfb,0x00,
+0x9f,0xf9,0x2d,0xff,0xff,0xff,0xfc,0x00,0x09,0xff,0x90,0x06,0xce,0xfe,0xb5,0x55,
+0x04,0x03,0xab,0x06,0x01,0x66,0x00,0x0f,0x11,0x00,0x21,0x00,0xb6,0x01,0x30,0xbe,
+0xff,0xc8,0x7b,0x00,0x13,0x4e,0x92,0x07,0xb1,0x4f,0xff,0xfa,0x9b,0xef,0xff,0x70,
+0x00,0x1e,0xff,0xa0,0x36,0x02,0x02,0xb6,0x08,0x50,0xdf,0xf9,0x00,0xdf,0xf6,0x2e,
+0x00,0x53,0xfe,0xb0,0x1f,0xff,0x20,0xe2,0x06,0x12,0xf0,0x42,0x00,0x04,0x99,0x08,
+0x02,0x2a,0x00,0x00,0x0f,0x09,0x01,0x33,0x02,0x00,0x62,0x02,0x1a,0xe0,0xb2,0x08,
+0x21,0x01,0xff,0x3c,0x09,0x21,0x33,0x30,0xb1,0x08,0x00,0xac,0x09,0x30,0x7f,0xfe,
+0x10,0xee,0x00,0xf3,0x02,0x90,0x01,0xef,0xfc,0x10,0x00,0x09,0xff,0xf2,0x00,0x04,
+0xff,0xff,0xb9,0xbe,0xff,0xf7,0x2f,0x02,0x01,0x5d,0x07,0x21,0x7b,0xef,0xae,0x08,
+0x02,0x26,0x02,0x14,0xfe,0x08,0x00,0x84,0x26,0x66,0x66,0x9f,0xfe,0x66,0x66,0x65,
+0x09,0x0a,0x0f,0x08,0x00,0x6d,0x22,0xbf,0xfa,0x62,0x01,0x33,0xfc,0x5f,0xff,0x28,
+0x03,0x10,0x0e,0x3b,0x08,0x00,0xac,0x0a,0x00,0xf4,0x05,0x00,0xd0,0x04,0x10,0xa0,
+0x5a,0x09,0x00,0x07,0x02,0x40,0x40,0x00,0xdf,0xf7,0x6d,0x02,0x53,0xfe,0x00,0x00,
+0x7f,0xfc,0x1a,0x07,0x01,0x57,0x01,0x20,0xdf,0xf3,0x0e,0x01,0x52,0x80,0x00,0x02,
+0xff,0xd0,0xd6,0x0a,0x31,0x07,0xff,0x70,0x18,0x0a,0x11,0x00,0x45,0x08,0x01,0x48,
+0x06,0x11,0xfc,0x5f,0x0b,0x11,0xfe,0x75,0x0a,0x01,0x4d,0x00,0x22,0xcf,0xf0,0x7e,
+0x01,0x32,0x92,0xff,0xa0,0x65,0x01,0x10,0xe7,0x29,0x0b,0x00,0x93,0x00,0x23,0xfe,
+0xfe,0xa1,0x00,0x02,0x90,0x05,0x00,0x9a,0x03,0x14,0xf3,0x01,0x02,0x03,0xac,0x01,
+0x34,0x08,0xff,0x70,0x1b,0x00,0x13,0x10,0x2d,0x00,0x13,0xfa,0xad,0x01,0x02,0xc4,
+0x09,0x00,0x2f,0x09,0x11,0xa0,0x2a,0x00,0x42,0x9a,0xff,0xfd,0x10,0x73,0x00,0x00,
+0x3d,0x09,0x01,0xa6,0x02,0x27,0xd8,0x10,0xe0,0x07,0x37,0x58,0x82,0x00,0x01,0x00,
+0x2f,0xbf,0xf4,0x0e,0x00,0x3b,0x80,0x7d,0xfe,0xc7,0x10,0xaf,0xf4,0x03,0xad,0xfa,
+0x02,0x01,0x6a,0x08,0x30,0xd1,0xaf,0xf4,0x0c,0x02,0x10,0xa0,0x3c,0x08,0xf0,0x05,
+0xb7,0x7b,0xfc,0xaf,0xf6,0xff,0x97,0x8d,0xff,0xf7,0x00,0x05,0xff,0xf5,0x00,0x00,
+0x6f,0xef,0xfe,0xd1,0xe0,0x09,0x20,0x10,0x0b,0x7b,0x01,0x11,0x0a,0x7a,0x06,0x31,
+0x1f,0xff,0x60,0x23,0x0c,0x10,0x04,0x07,0x08,0x00,0x54,0x0a,0x11,0x3f,0xf2,0x00,
+0x22,0xff,0xf9,0xbb,0x02,0x22,0x5f,0xff,0x9a,0x03,0x01,0xd3,0x03,0x12,0xf0,0xd4,
+0x02,0x22,0xcf,0xf5,0xe8,0x02,0x02,0xd1,0x02,0x21,0xbf,0xf5,0xcf,0x01,0x13,0xf1,
+0x0e,0x00,0x12,0xf4,0xde,0x09,0x02,0x2a,0x00,0x13,0xbf,0x2a,0x00,0x06,0x46,0x00,
+0x00,0x60,0x05,0x06,0x62,0x00,0x00,0xbd,0x0a,0x16,0x1f,0x7e,0x00,0x61,0x0c,0xff,
+0xa0,0x0c,0xff,0xb0,0x50,0x0d,0x10,0x40,0x75,0x04,0xe0,0x50,0x07,0xff,0xf6,0x00,
+0x00,0x7f,0xef,0xfe,0xe2,0x00,0x01,0xcf,0xfe,0x2f,0x07,0x20,0xc8,0x9d,0xd2,0x00,
+0x20,0xb8,0x9e,0x18,0x00,0x10,0x2e,0x57,0x09,0x01,0xee,0x00,0x00,0xb7,0x03,0x42,
+0x01,0x8d,0xff,0xd7,0x0a,0x01,0x1e,0xb4,0x6c,0x01,0x0f,0x0e,0x00,0x4c,0x00,0xdb,
+0x05,0x01,0xec,0x07,0x41,0xd0,0x04,0xff,0xf2,0xcd,0x07,0x41,0x30,0x00,0xaf,0xfb,
+0x0e,0x0e,0x02,0x2b,0x0b,0x01,0x04,0x04,0x33,0x04,0xff,0xe0,0x9c,0x0c,0x21,0xaf,
+0xf9,0xc0,0x0d,0x00,0x1c,0x00,0x32,0x34,0xff,0xd0,0x36,0x04,0x13,0xcd,0xb6,0x0c,
+0x34,0xaf,0xff,0xf8,0xc7,0x0c,0x14,0xe0,0xa7,0x02,0x13,0xf4,0x7a,0x02,0x32,0xff,
+0xfe,0x10,0x54,0x08,0x12,0x9a,0x7c,0x02,0x31,0x5f,0xfe,0x11,0x1c,0x00,0x00,0xf7,
+0x0b,0x30,0x6f,0xfe,0x10,0x1a,0x00,0x52,0xb0,0x00,0x0c,0xff,0x90,0x10,0x0c,0x30,
+0x02,0xff,0xf4,0x70,0x03,0x00,0x49,0x03,0x52,0xfe,0x00,0x09,0xff,0xc0,0xe6,0x06,
+0x31,0x4f,0xff,0x20,0xb0,0x01,0x03,0xbc,0x07,0x3f,0xff,0xf3,0x00,0x09,0x00,0x7e,
+0x01,0x15,0x08,0x43,0xff,0xf8,0x64,0x8f,0x03,0x07,0x15,0xfc,0x09,0x00,0x04,0xe2,
+0x0d,0x0f,0x09,0x00,0x28,0x50,0x00,0x00,0x00,0x1f,0xfc,0xff,0x00,0xdf,0xf5,0x00,
+0x00,0x00,0x0e,0xff,0x4d,0xff,0x50,0x00,0x00,0x00,0xef,0xf4,0x0f,0x00,0x1a,0x21,
+0xcf,0xf7,0x0f,0x00,0xf1,0x12,0x4a,0xff,0xe1,0x00,0x00,0x15,0xff,0xf4,0x4f,0xff,
+0xfb,0xab,0xdf,0xff,0xff,0x40,0xaf,0xff,0xff,0xff,0xfa,0xff,0xf4,0x00,0x6c,0xff,
+0xda,0x61,0x0e,0xff,0x40,0x00,0x00,0x2d,0x00,0x01,0x07,0x00,0x0f,0x0f,0x00,0x15,
+0xff,0x0a,0x8f,0xfa,0x00,0x00,0x00,0x2f,0xff,0x00,0x00,0x00,0x0c,0xff,0x68,0xff,
+0xa0,0x00,0x00,0x02,0xff,0xf0,0x00,0x00,0x00,0xcf,0xf6,0x19,0x00,0xaa,0xd6,0xc6,
+0x66,0x66,0x67,0xff,0xf6,0x66,0x66,0x66,0xdf,0xf6,0x8f,0xff,0x01,0x00,0x17,0x68,
+0x0c,0x00,0x02,0x32,0x00,0x10,0x3f,0x32,0x00,0x40,0x0f,0xff,0x30,0x08,0x4c,0x00,
+0x11,0x03,0x4c,0x00,0x3f,0xff,0xf3,0x00,0x1b,0x00,0xb8,0x00,0x0b,0x01,0x11,0x68,
+0x0b,0x01,0x38,0xff,0xf8,0x64,0x0c,0x01,0x28,0xff,0xc8,0x0d,0x00,0x26,0xfc,0x00,
+0x01,0x00,0x37,0x01,0xff,0xc0,0x0e,0x00,0x1f,0x1f,0x1b,0x00,0x3f,0x22,0x8f,0xfa,
+0x0a,0x00,0x0f,0x08,0x00,0x26,0x40,0xfc,0x44,0x44,0x43,0x08,0x00,0x00,0xba,0x00,
+0x32,0xfd,0x70,0x00,0xd7,0x00,0x20,0xfd,0x10,0x20,0x00,0x41,0x03,0x9f,0xff,0xa0,
+0x28,0x00,0x31,0x08,0xff,0xf0,0x08,0x00,0x51,0x02,0xff,0xf3,0x8f,0xfa,0x85,0x00,
+0x02,0xec,0x02,0x51,0x04,0xff,0xf2,0x8f,0xfa,0x27,0x02,0x10,0xd0,0x48,0x00,0x52,
+0x58,0xef,0xff,0x50,0x8f,0x11,0x02,0x01,0x48,0x00,0x42,0xfe,0xb7,0x10,0x00,0x38,
+0x00,0x43,0x8c,0xef,0xed,0x82,0x74,0x00,0x01,0x21,0x00,0x11,0x80,0x0c,0x00,0x71,
+0x08,0xff,0xfd,0x87,0x8c,0xff,0xf8,0x0c,0x00,0x30,0x3f,0xff,0xa0,0x1c,0x00,0x10,
+0x30,0x0c,0x00,0x21,0xaf,0xfd,0x54,0x00,0x10,0x90,0x0c,0x00,0x10,0xff,0xae,0x03,
+0x11,0x05,0x80,0x00,0x31,0x03,0xff,0xf3,0x7c,0x00,0x00,0x74,0x00,0x11,0x05,0xa2,
+0x01,0x31,0x00,0xff,0xf5,0x4f,0x00,0x11,0xe0,0x80,0x03,0x16,0xf6,0x0c,0x00,0x65,
+0xdf,0xf7,0x8f,0xfc,0x66,0x6a,0x0c,0x00,0x00,0x30,0x00,0x04,0x24,0x00,0x00,0x48,
+0x00,0x04,0x3c,0x00,0x11,0xfa,0xe5,0x01,0x00,0xd8,0x00,0x01,0xc8,0x00,0x01,0x1a,
+0x04,0x30,0x06,0xff,0xe0,0x0c,0x00,0x12,0x6f,0x84,0x00,0x30,0x80,0x8f,0xfa,0xe2,
+0x03,0x80,0x90,0x00,0x00,0x9f,0xff,0x20,0x8f,0xfa,0xf3,0x00,0x52,0xfd,0x86,0x8d,
+0xff,0xf6,0xcc,0x00,0x10,0x5e,0x71,0x00,0x22,0x60,0x00,0x14,0x01,0x50,0x7c,0xef,
+0xec,0x71,0x00,0x41,0x00,0x10,0xad,0x16,0x00,0x32,0xf0,0x00,0x3e,0x0e,0x02,0xc2,
+0x00,0x2f,0xff,0xfa,0x65,0x55,0x56,0xff,0xf0,0x09,0xff,0xf3,0x57,0x03,0x31,0xef,
+0xf9,0x00,0x6c,0x03,0x32,0x0f,0xff,0x50,0x11,0x00,0x22,0xff,0xf6,0x11,0x00,0x31,
+0x0d,0xff,0x90,0x11,0x00,0x00,0x6c,0x00,0x01,0x11,0x00,0xc2,0x02,0xff,0xfe,0x85,
+0x44,0x44,0x6f,0xff,0x00,0x04,0xef,0xff,0x55,0x00,0x21,0x01,0x7e,0x55,0x00,0x00,
+0xa3,0x02,0x12,0xf1,0xb0,0x03,0x22,0xdf,0xf5,0xac,0x03,0x22,0xaf,0xfa,0xc1,0x03,
+0x31,0x6f,0xfe,0x10,0x11,0x00,0x39,0x2f,0xff,0x40,0x55,0x00,0x31,0x09,0xff,0xd0,
+0x66,0x00,0x11,0xf5,0x87,0x00,0x01,0x33,0x00,0x40,0x06,0xbe,0xff,0xda,0xbc,0x04,
+0x01,0xaa,0x00,0x10,0xb1,0x84,0x01,0x52,0xe9,0x78,0xbf,0xff,0xc0,0xf0,0x00,0x41,
+0x3f,0xff,0x80,0x07,0x6c,0x02,0x31,0x6f,0xff,0x00,0x42,0x05,0x61,0x01,0xdc,0xa2,
+0x1f,0xff,0x10,0x35,0x02,0x11,0x04,0x42,0x01,0x00,0x1c,0x00,0x80,0xfe,0x66,0x66,
+0x66,0x60,0x00,0x00,0x07,0x96,0x00,0x00,0x1d,0x00,0x10,0x7f,0x08,0x00,0x10,0xf1,
+0x46,0x01,0x12,0xd0,0x22,0x00,0x24,0x4f,0xff,0xb8,0x02,0x10,0xf2,0x07,0x00,0x51,
+0x12,0x20,0x0d,0xff,0x70,0x4f,0x03,0x20,0x40,0x7f,0xa9,0x00,0x00,0xc8,0x01,0xd0,
+0xef,0xfc,0x10,0x00,0x03,0xff,0xf8,0x00,0x04,0xff,0xff,0xa7,0x8b,0x3e,0x03,0x20,
+0x03,0xef,0x8c,0x05,0x00,0x6b,0x00,0x80,0x6b,0xef,0xfd,0x93,0x00,0x00,0x9f,0xf9,
+0x02,0x00,0x22,0x11,0x11,0x4a,0x00,0x2f,0x9f,0xf9,0x02,0x00,0x13,0xb1,0x2f,0xfc,
+0x00,0x03,0xff,0xa2,0xff,0xc0,0x00,0x3f,0xfa,0x0b,0x00,0x78,0xa0,0x55,0x40,0x00,
+0x15,0x53,0x00,0x01,0x00,0x10,0x9f,0x8a,0x01,0x3f,0x09,0xff,0x90,0x0b,0x00,0x4c,
+0x50,0x00,0x09,0xff,0x90,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -1347,11 +1523,25 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 1068, .range_length = 44, .glyph_id_start = 141, .list_length = 44, .type = 0, .unicode_list = 0, .glyph_id_ofs_list = 1416 },
 };
 
-static uint8_t etxUncompBuf[49729] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 2771, .size = 3995, .comp_size = 2508 },
+{ .bitmap_start = 3995, .comp_offset = 5279, .size = 3985, .comp_size = 2164 },
+{ .bitmap_start = 7980, .comp_offset = 7443, .size = 3994, .comp_size = 2157 },
+{ .bitmap_start = 11974, .comp_offset = 9600, .size = 3917, .comp_size = 1870 },
+{ .bitmap_start = 15891, .comp_offset = 11470, .size = 3961, .comp_size = 2424 },
+{ .bitmap_start = 19852, .comp_offset = 13894, .size = 4070, .comp_size = 2249 },
+{ .bitmap_start = 23922, .comp_offset = 16143, .size = 4078, .comp_size = 1903 },
+{ .bitmap_start = 28000, .comp_offset = 18046, .size = 3828, .comp_size = 1696 },
+{ .bitmap_start = 31828, .comp_offset = 19742, .size = 3906, .comp_size = 1532 },
+{ .bitmap_start = 35734, .comp_offset = 21274, .size = 4030, .comp_size = 2161 },
+{ .bitmap_start = 39764, .comp_offset = 23435, .size = 1715, .comp_size = 731 },
+};
+
+static uint8_t etxUncompBuf[8250] __SDRAMFONTS;
 
 const etxLz4Font lv_font_ua_L = {
-.uncomp_size = 49433,
-.comp_size = 21349,
+.uncomp_size = 7954,
+.comp_size = 2771,
 .line_height = 43,
 .base_line = 9,
 .subpx = 0,
@@ -1364,12 +1554,13 @@ const etxLz4Font lv_font_ua_L = {
 .bitmap_format = 0,
 .left_class_cnt = 83,
 .right_class_cnt = 74,
-.glyph_bitmap = 1460,
-.class_pair_values = 42939,
-.left_class_mapping = 49081,
-.right_class_mapping = 49257,
+.class_pair_values = 1460,
+.left_class_mapping = 7602,
+.right_class_mapping = 7778,
+.block_num = 11,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 49729,
+.lvglFontBufSize = 8250,
 };
@@ -36,10 +36,12 @@
         The font to be compressed is read from the structures in the lv_font.inc
    file. Including and compiling with this files saves the effort of writing a
    parser for the 'lvgl' font data. Data that can be compressed is collected
-   into a byte array and then LZ4 compressed. The remaining data, and offsets
-   needed to rebuild the LVGL font structures are collected into custom
-   structures (see lz4_fonts.h). Everything is then written back out to the
-   argv[1].c file to be compiled into the EdgeTx firmware.
+   into a byte array and then LZ4 compressed. The glyph bitmaps are split into
+   blocks of whole glyphs (up to ETX_FONT_BLOCK_SIZE bytes), each compressed
+   separately, so that they can be uncompressed on demand. The remaining data,
+   and offsets needed to rebuild the LVGL font structures are collected into
+   custom structures (see lz4_fonts.h). Everything is then written back out to
+   the argv[1].c file to be compiled into the EdgeTx firmware.
 
     Note:
         This is dependant on the LVGL font structure formats. If the LVGL
@@ -82,8 +84,13 @@ int main(int argc, char* argv[])
   const lv_font_t* font = &lv_font;
   lv_font_fmt_txt_dsc_t* dsc = (lv_font_fmt_txt_dsc_t*)font->dsc;
 
-  // Calculate size of data to compress
-  uncomp_size = sizeof(glyph_bitmap) + sizeof(glyph_dsc);
+  if (dsc->bitmap_format != LV_FONT_FMT_TXT_PLAIN) {
+    printf("%s: compressed glyph bitmaps are not supported\n", argv[1]);
+    return 1;
+  }
+
+  // Calculate size of data to compress (glyph bitmaps are compressed apart)
+  uncomp_size = sizeof(glyph_dsc);
 
   if (dsc->kern_classes) {
     uncomp_size += sizeof(kern_class_values) + sizeof(kern_left_class_mapping) +
@@ -166,12 +173,6 @@ int main(int argc, char* argv[])
     }
   }
 
-  // Copy glyph_bitmap
-  memcpy(next, glyph_bitmap, sizeof(glyph_bitmap));
-  etx_font.glyph_bitmap = next - data;
-
-  next += sizeof(glyph_bitmap);
-
   // Copy kern_classes (optional)
   if (dsc->kern_classes) {
     memcpy(next, kern_class_values, sizeof(kern_class_values));
@@ -190,10 +191,48 @@ int main(int argc, char* argv[])
     next += sizeof(kern_right_class_mapping);
   }
 
-  // Allocate array and LZ4 compress data
-  uint8_t* lz4_data = (uint8_t*)malloc(uncomp_size);
+  // Split the glyph bitmaps into blocks of whole glyphs
+  int glyph_num = sizeof(glyph_dsc) / sizeof(glyph_dsc[0]);
+  int bitmap_size = sizeof(glyph_bitmap);
+  etxFontBlock* blocks = (etxFontBlock*)calloc(glyph_num, sizeof(etxFontBlock));
+  int block_num = 0;
+  uint32_t block_start = 0;
+
+  for (int gid = 1; gid < glyph_num; gid += 1) {
+    uint32_t glyph_start = glyph_dsc[gid].bitmap_index;
+    uint32_t glyph_end = gid + 1 < glyph_num ? glyph_dsc[gid + 1].bitmap_index
+                                             : bitmap_size;
+    if (glyph_end - glyph_start > ETX_FONT_BLOCK_SIZE) {
+      printf("%s: glyph %d is larger than a block\n", argv[1], gid);
+      return 1;
+    }
+    if (glyph_end - block_start > ETX_FONT_BLOCK_SIZE) {
+      blocks[block_num].bitmap_start = block_start;
+      blocks[block_num].size = glyph_start - block_start;
+      block_num += 1;
+      block_start = glyph_start;
+    }
+  }
+  blocks[block_num].bitmap_start = block_start;
+  blocks[block_num].size = bitmap_size - block_start;
+  block_num += 1;
+
+  // Allocate array and LZ4 compress data, followed by each block
+  int lz4_size = LZ4_compressBound(uncomp_size) +
+                 block_num * LZ4_compressBound(ETX_FONT_BLOCK_SIZE);
+  uint8_t* lz4_data = (uint8_t*)malloc(lz4_size);
   comp_size = LZ4_compress_HC((const char*)data, (char*)lz4_data, uncomp_size,
-                              uncomp_size, 12);
+                              lz4_size, 12);
+
+  int total_size = comp_size;
+  for (int b = 0; b < block_num; b += 1) {
+    blocks[b].comp_offset = total_size;
+    blocks[b].comp_size = LZ4_compress_HC(
+        (const char*)&glyph_bitmap[blocks[b].bitmap_start],
+        (char*)&lz4_data[total_size], blocks[b].size, lz4_size - total_size,
+        12);
+    total_size += blocks[b].comp_size;
+  }
 
   // Write data to file
   int i;
@@ -206,7 +245,7 @@ int main(int argc, char* argv[])
 
   // Compressed data
   fprintf(fp, "static const uint8_t lz4FontData[] ={\n");
-  for (i = 0; i < comp_size; i += 1) {
+  for (i = 0; i < total_size; i += 1) {
     fprintf(fp, "0x%02x,", lz4_data[i]);
     if ((i & 0x0F) == 0x0F) fprintf(fp, "\n");
   }
@@ -229,6 +268,17 @@ int main(int argc, char* argv[])
     fprintf(fp, "};\n\n");
   }
 
+  // Glyph bitmaps blocks
+  fprintf(fp, "static const etxFontBlock blocks[] = {\n");
+  for (int b = 0; b < block_num; b += 1) {
+    fprintf(fp,
+            "{ .bitmap_start = %d, .comp_offset = %d, .size = %d, "
+            ".comp_size = %d },\n",
+            blocks[b].bitmap_start, blocks[b].comp_offset, blocks[b].size,
+            blocks[b].comp_size);
+  }
+  fprintf(fp, "};\n\n");
+
   // SDRAM buffer to decompress data into
   int size = uncomp_size + sizeof(lv_font_t) +
              sizeof(lv_font_fmt_txt_dsc_t) +
@@ -253,10 +303,11 @@ int main(int argc, char* argv[])
   fprintf(fp, ".bitmap_format = %d,\n", etx_font.bitmap_format);
   fprintf(fp, ".left_class_cnt = %d,\n", etx_font.left_class_cnt);
   fprintf(fp, ".right_class_cnt = %d,\n", etx_font.right_class_cnt);
-  fprintf(fp, ".glyph_bitmap = %d,\n", etx_font.glyph_bitmap);
   fprintf(fp, ".class_pair_values = %d,\n", etx_font.class_pair_values);
   fprintf(fp, ".left_class_mapping = %d,\n", etx_font.left_class_mapping);
   fprintf(fp, ".right_class_mapping = %d,\n", etx_font.right_class_mapping);
+  fprintf(fp, ".block_num = %d,\n", block_num);
+  fprintf(fp, ".blocks = blocks,\n");
   fprintf(fp, ".cmaps = cmaps,\n");
   fprintf(fp, ".compressed = lz4FontData,\n");
   fprintf(fp, ".lvglFontBuf = etxUncompBuf,\n");
@@ -265,6 +316,7 @@ int main(int argc, char* argv[])
 
   fclose(fp);
 
-  printf("%s %d %d %d%%\n", argv[1], uncomp_size, comp_size,
-         (comp_size * 100) / uncomp_size);
+  printf("%s %d %d %d%% (%d blocks)\n", argv[1], uncomp_size + bitmap_size,
+         total_size, (total_size * 100) / (uncomp_size + bitmap_size),
+         block_num);
 }
@@ -132,216 +132,275 @@ static const uint8_t lz4FontData[] ={
 0x08,0x00,0x13,0x79,0x08,0x00,0x20,0x97,0x16,0xd0,0x00,0x42,0x00,0xff,0xc3,0x16,
 0x58,0x00,0x13,0xdf,0x08,0x00,0x21,0xfb,0x16,0xa8,0x00,0x32,0xfe,0x24,0x17,0x28,
 0x00,0x40,0x42,0x17,0x00,0x06,0x18,0x00,0x60,0x5e,0x17,0x10,0x08,0x09,0x06,0x80,
-0x0b,0xf0,0x7f,0x43,0x02,0xdf,0xcf,0xe6,0xcf,0xe9,0xcf,0xea,0xcf,0xeb,0xcf,0xef,
+0x0b,0xf8,0x6c,0x43,0x02,0xdf,0xcf,0xe6,0xcf,0xe9,0xcf,0xea,0xcf,0xeb,0xcf,0xef,
 0xcf,0xf1,0xcf,0xf3,0xcf,0xf7,0xcf,0xfa,0xcf,0xff,0xcf,0x04,0xd0,0x05,0xd0,0x06,
 0xd0,0x1c,0xd0,0x21,0xd0,0x26,0xd0,0x29,0xd0,0x2a,0xd0,0x2b,0xd0,0x2f,0xd0,0x30,
 0xd0,0x31,0xd0,0x32,0xd0,0x45,0xd0,0x46,0xd0,0x4c,0xd0,0x4e,0xd0,0x4f,0xd0,0x52,
 0xd0,0x55,0xd0,0x56,0xd0,0x57,0xd0,0x59,0xd0,0x71,0xd0,0x73,0xd0,0xa2,0xd0,0xa3,
 0xd0,0xa5,0xd0,0xa7,0xd0,0xbe,0xd0,0xc5,0xd0,0xc8,0xd0,0xd1,0xd0,0xfa,0xd0,0x02,
 0xd1,0x39,0xd1,0xc9,0xd1,0x1e,0xd2,0x1f,0xd2,0x20,0xd2,0x21,0xd2,0x22,0xd2,0x65,
-0xd2,0x71,0xd2,0xcb,0xd2,0xe2,0xd2,0x38,0xd5,0xa0,0xd7,0x80,0xd8,0x56,0x56,0x55,
-0x34,0x34,0x77,0x25,0x50,0x00,0x86,0x21,0xaa,0xc6,0x06,0x29,0x04,0xc8,0xc4,0x08,
-0x35,0x92,0x00,0xf0,0x37,0x1a,0x00,0x2b,0x5b,0x04,0x80,0x50,0x0a,0xb3,0x01,0x01,
-0xc0,0x66,0x1c,0x00,0x6c,0x20,0x00,0x10,0x00,0x67,0x70,0x20,0x36,0x47,0x00,0x00,
-0x58,0x82,0x02,0x68,0x17,0x03,0x07,0x84,0x0b,0xa6,0x00,0xb6,0x50,0x1a,0xb0,0x48,
-0x34,0xb6,0x39,0x8b,0x80,0x96,0x03,0x50,0x90,0x46,0x06,0x40,0x64,0x03,0x70,0x09,
-0x00,0x14,0x71,0x01,0x80,0x0a,0x00,0x82,0x09,0x20,0xa0,0x02,0x09,0xf0,0xff,0x0d,
-0x00,0x6d,0x92,0x37,0x80,0x00,0x00,0x01,0x80,0x00,0x1a,0x00,0x6a,0xda,0x20,0x1a,
-0x00,0x82,0x70,0x78,0x00,0x44,0x00,0x90,0x03,0x60,0x09,0x00,0x18,0x00,0x72,0x00,
-0x40,0x00,0x1a,0x97,0x07,0x30,0xb0,0x82,0x0b,0x07,0x40,0xb0,0x1a,0x97,0x00,0x18,
-0xb1,0x0b,0x00,0xb0,0x0b,0x00,0xb0,0x3a,0x98,0x04,0x10,0xb0,0x00,0x65,0x00,0x76,
-0x00,0x6c,0x88,0x10,0x3a,0x97,0x31,0x0b,0x04,0xc6,0x30,0x0b,0x3a,0x97,0x00,0x98,
-0x00,0x68,0x80,0x28,0x38,0x08,0x8a,0xc2,0x00,0x38,0x00,0x0d,0xaa,0x01,0xd9,0x60,
-0x01,0x0b,0x12,0x30,0x91,0x0a,0x98,0x00,0x06,0x82,0x03,0xb9,0x50,0x75,0x0b,0x06,
-0x50,0xa0,0x0a,0x97,0x00,0x69,0x9d,0x10,0x02,0x80,0x00,0x91,0x00,0x28,0x00,0x0a,
-0x10,0x00,0x1a,0x97,0x05,0x60,0xb0,0x1c,0xb7,0x07,0x30,0xb0,0x3a,0x99,0x00,0x3a,
-0x95,0x82,0x0b,0x19,0x8c,0x00,0x1b,0x07,0xa2,0x43,0x00,0x00,0x43,0x52,0x00,0x00,
-0x52,0x91,0x00,0x02,0x85,0x8a,0x10,0x07,0xa3,0x00,0x01,0x39,0x97,0x00,0x00,0x39,
-0x97,0x58,0x20,0x01,0x8a,0x3a,0x71,0x10,0x00,0x5a,0xb2,0x20,0x56,0x02,0x90,0x04,
-0x10,0x06,0x10,0x03,0x87,0x87,0x01,0x80,0x77,0x26,0x62,0x81,0x90,0x88,0x0a,0x09,
-0x08,0x36,0x87,0xa7,0x40,0x67,0x75,0x00,0x00,0xe2,0x00,0x05,0x79,0x00,0x0b,0x0a,
-0x10,0x3c,0x9b,0x70,0xa1,0x00,0xb0,0x5b,0x9a,0x15,0x60,0x74,0x5b,0x9c,0x15,0x60,
-0x47,0x5b,0x9b,0x20,0x09,0x9a,0x46,0x60,0x07,0x83,0x00,0x06,0x60,0x07,0x09,0x9a,
-0x30,0x5b,0x99,0x15,0x60,0x29,0x56,0x00,0xc5,0x60,0x39,0x5b,0x9a,0x10,0x5b,0x99,
-0x25,0x60,0x00,0x5b,0x97,0x05,0x60,0x00,0x5b,0x99,0x20,0x1a,0x00,0x02,0x0d,0x00,
-0xf2,0x0a,0x56,0x00,0x00,0x09,0x9a,0x55,0x60,0x04,0x83,0x19,0xa5,0x70,0x0c,0x08,
-0x99,0x70,0x56,0x00,0xb0,0x56,0x00,0xb0,0x5b,0x99,0xe0,0x09,0x00,0x10,0x47,0x01,
-0x00,0x20,0x00,0x0c,0x02,0x00,0xf1,0x06,0x50,0x0b,0x5a,0xa5,0x56,0x08,0x50,0x56,
-0x95,0x00,0x5d,0xc0,0x00,0x57,0x3a,0x00,0x56,0x04,0x90,0x56,0x00,0x42,0x00,0x01,
-0x54,0x00,0xf0,0x1f,0x00,0x5d,0x00,0x0d,0x55,0xc4,0x05,0xc5,0x56,0xa0,0xb6,0x55,
-0x67,0x77,0x65,0x56,0x1e,0x16,0x50,0x5c,0x00,0xb0,0x5b,0x80,0xb0,0x56,0x94,0xb0,
-0x56,0x0b,0xc0,0x56,0x02,0xf0,0x09,0x9a,0x30,0x66,0x00,0xc0,0x83,0x00,0xb0,0x66,
-0x00,0xc0,0x9e,0x00,0x73,0x9a,0x45,0x60,0x1b,0x5b,0x89,0x35,0x84,0x00,0xf1,0x23,
-0x30,0x65,0x00,0xc0,0x92,0x00,0xc0,0x65,0x00,0xc0,0x09,0x9c,0x40,0x00,0x02,0x80,
-0x5b,0x9a,0x25,0x60,0x47,0x5b,0xab,0x15,0x60,0xb0,0x56,0x04,0x70,0x2a,0x89,0x16,
-0x60,0x22,0x06,0x97,0x05,0x10,0x65,0x3a,0x9a,0x20,0x79,0xe9,0x50,0x0c,0x00,0x00,
-0xc0,0x00,0x05,0x00,0xf2,0x31,0x74,0x01,0xa7,0x40,0x1a,0x74,0x01,0xa6,0x50,0x2a,
-0x1a,0x9a,0x20,0xa1,0x00,0xb4,0x70,0x65,0x0a,0x0a,0x00,0x65,0x80,0x00,0xe1,0x00,
-0xa1,0x0d,0x10,0xb5,0x63,0xb6,0x38,0x1a,0x82,0xa7,0x30,0xba,0x09,0xb0,0x08,0x70,
-0x4a,0x00,0x67,0x07,0x60,0x95,0xa0,0x02,0xf2,0x00,0xa6,0xa0,0x67,0x07,0x70,0x93,
-0x06,0x61,0xa0,0xb0,0x06,0xb2,0x46,0x00,0xf2,0x02,0x59,0x9e,0x40,0x04,0x80,0x02,
-0xa0,0x00,0xb1,0x00,0x9b,0x99,0x40,0x59,0x06,0x40,0x64,0x03,0x00,0xf1,0x01,0x05,
-0x90,0x91,0x00,0x37,0x00,0x0a,0x00,0x05,0x50,0x00,0xa0,0x00,0x40,0x86,0x38,0x01,
-0x00,0xf0,0x33,0x96,0x05,0x00,0x1b,0x60,0x82,0xa0,0x88,0x85,0x47,0x39,0x96,0x18,
-0x7b,0x83,0x0b,0x4b,0x9b,0x74,0x00,0x07,0xa9,0x80,0x74,0x0a,0x07,0x40,0xa0,0x7a,
-0x98,0x00,0x19,0x97,0x82,0x04,0x92,0x03,0x2a,0x96,0x00,0x0b,0x2b,0x8d,0x83,0x0b,
-0x82,0x0b,0x2a,0x8d,0x19,0x97,0x89,0x8a,0x94,0x00,0x2b,0x87,0x08,0x71,0xa0,0x7d,
-0x41,0xa0,0x1a,0x01,0xa0,0x19,0x00,0xc0,0x83,0x0b,0x2b,0x9d,0x18,0x97,0x74,0x00,
-0x7a,0xa8,0x74,0x0b,0x02,0x00,0x71,0x43,0x65,0x65,0x65,0x65,0x04,0x20,0x79,0x00,
-0xf0,0x01,0x42,0xb2,0x74,0x00,0x07,0x48,0x60,0x7b,0x70,0x07,0x8b,0x00,0x74,0x39,
-0x00,0x65,0x01,0x00,0xe4,0x7a,0xaa,0x9b,0x37,0x40,0xc0,0x47,0x74,0x0b,0x04,0x77,
-0x40,0xb0,0x47,0x36,0x00,0xf0,0x02,0x19,0x98,0x08,0x20,0x91,0x82,0x09,0x11,0xa8,
-0x70,0x7a,0x88,0x07,0x40,0xa0,0x74,0x0b,0x89,0x00,0x24,0x00,0x00,0x7a,0x00,0xf2,
-0x0b,0x00,0x0b,0x00,0x07,0xb5,0x74,0x07,0x40,0x74,0x00,0x3a,0xa5,0x49,0x32,0x22,
-0x68,0x3a,0x96,0x38,0x09,0xc2,0x38,0x02,0x80,0x0c,0x30,0x3f,0x00,0xf0,0x28,0x2b,
-0x9c,0xa1,0x38,0x46,0x82,0x0a,0xa0,0x08,0x60,0xa0,0x77,0x0a,0x64,0x99,0x45,0x1b,
-0x77,0xa1,0x0c,0x22,0xb0,0x75,0x66,0x0a,0xa0,0x0a,0xa0,0x75,0x57,0xa1,0x37,0x46,
-0x81,0x09,0x80,0x08,0x30,0x69,0x00,0x59,0xc7,0x02,0xb0,0x0b,0x10,0x8b,0x86,0x00,
-0x00,0x75,0x0b,0x00,0xb0,0x96,0x27,0x03,0x41,0x75,0x00,0x00,0x54,0x01,0x00,0xf2,
-0x20,0x22,0x00,0x08,0x30,0x29,0x01,0xa0,0x0a,0x40,0xa0,0x29,0x08,0x30,0x00,0x00,
-0x19,0x70,0x74,0x23,0x95,0x00,0x00,0x20,0x00,0x00,0x00,0xc9,0x00,0x1b,0xaa,0xa5,
-0x90,0x18,0x00,0x00,0x86,0x1d,0xaa,0x93,0xa0,0x00,0x00,0xba,0x00,0x00,0x00,0x40,
-0xfa,0x0f,0xf0,0x24,0x4f,0x00,0x00,0x04,0x98,0xaa,0xa6,0x0c,0x00,0x00,0x18,0x05,
-0x76,0xaa,0xb8,0x00,0x6e,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x07,0x20,0x00,0x08,
-0x7b,0x10,0x08,0x60,0x1b,0x11,0xad,0x08,0xb5,0x00,0xa0,0x91,0x00,0x0a,0x09,0x10,
-0x00,0xaa,0xd1,0x00,0x00,0x6a,0xa0,0x0b,0x00,0x00,0x12,0x00,0xd2,0x8d,0x08,0x94,
-0x0a,0x60,0x1c,0x20,0x0b,0x3a,0x30,0x00,0x0c,0x50,0x45,0x10,0xa0,0x06,0x60,0x00,
-0x00,0x0d,0xd0,0x00,0x00,0x77,0x87,0x4b,0x08,0xf1,0x12,0x00,0x08,0x60,0x06,0x80,
-0x1f,0xee,0xee,0xf1,0x00,0x02,0xa4,0x00,0x79,0xc1,0xc0,0x77,0x0f,0xd9,0x0b,0x02,
-0xf6,0xa0,0xb0,0x32,0x0b,0x08,0x50,0x05,0x90,0x08,0xbb,0x80,0x34,0x00,0xf1,0x40,
-0x13,0x32,0x00,0x02,0x6c,0xf6,0x60,0x09,0x52,0x71,0xa2,0x1b,0x00,0x00,0x66,0x0b,
-0x00,0x00,0x65,0x07,0x70,0x02,0xb0,0x00,0x8a,0xaa,0x20,0x00,0x02,0x10,0x00,0x00,
-0x30,0x00,0x00,0x0a,0xbd,0xab,0x40,0x1c,0x28,0x70,0x93,0x0c,0xbb,0x30,0x19,0x0b,
-0x01,0x00,0x19,0x07,0x60,0x00,0xa3,0x00,0x6b,0xba,0x30,0x06,0xcc,0xc8,0x0c,0x30,
-0x65,0x0d,0x01,0xb0,0x3e,0x3a,0x00,0xb8,0x7c,0x00,0xb2,0x1b,0x00,0x4b,0xb5,0x54,
-0x00,0xf1,0x71,0x99,0x10,0x57,0xdd,0x85,0x71,0x55,0x17,0x71,0x66,0x17,0x72,0xbb,
-0x37,0x70,0x00,0x07,0x47,0xff,0x84,0x00,0x66,0x10,0x00,0x01,0x30,0x06,0x08,0xdb,
-0xc0,0x99,0xc0,0x00,0x07,0x05,0x80,0x00,0x71,0x81,0x00,0x0b,0xab,0x00,0x00,0x30,
-0x7e,0xdc,0x00,0x00,0x01,0x00,0x68,0x86,0x66,0x77,0x53,0x9a,0x77,0x78,0xec,0x73,
-0x30,0x06,0x79,0x80,0x06,0x76,0x60,0x06,0x9c,0xc7,0x79,0x00,0x28,0x96,0x00,0x04,
-0xa9,0x85,0xb0,0x0c,0x07,0x80,0x66,0x19,0x05,0x63,0x19,0x0b,0x8b,0x5a,0x88,0x07,
-0xb2,0x03,0xd2,0x00,0x6b,0xba,0x20,0x02,0x97,0x00,0x00,0x0a,0x14,0x73,0x30,0x0b,
-0x02,0xbf,0xf4,0x04,0xde,0x9f,0xf5,0x08,0x5a,0xff,0xe0,0x0a,0x5f,0xff,0xf5,0x0d,
-0xcb,0xbb,0xb4,0x43,0x01,0xf0,0x02,0x03,0x90,0x00,0x16,0x65,0x9a,0x00,0x1a,0xaa,
-0xaa,0x60,0x05,0xfe,0xef,0xf2,0x00,0x49,0x14,0x00,0x12,0x70,0x29,0x01,0xf0,0x0b,
-0x04,0x72,0x00,0x00,0x04,0x77,0x80,0x00,0x04,0x66,0x20,0x00,0x54,0x93,0x00,0x0c,
-0x47,0x4b,0x00,0x1f,0x3d,0x3e,0x00,0x03,0x85,0x93,0xd8,0x00,0x92,0xa0,0x07,0xc3,
-0xa0,0x08,0x5a,0xa0,0x00,0x0a,0x03,0x00,0xf1,0x2b,0xaa,0xaa,0xa9,0x00,0x46,0x10,
-0x00,0x05,0x40,0x87,0x20,0x08,0x00,0x01,0x80,0x35,0x6a,0xb5,0x70,0x60,0x37,0x40,
-0x62,0x34,0x0b,0x90,0x24,0x06,0x77,0x77,0x70,0x00,0x00,0x0a,0x00,0x00,0x00,0x1d,
-0x81,0x02,0xb9,0xb7,0x80,0x09,0x10,0xb5,0x80,0x0a,0x00,0x2d,0x00,0x09,0x00,0x1c,
-0x00,0x27,0x00,0x1c,0x6c,0x00,0x8c,0x37,0x33,0x73,0x02,0x30,0x00,0x00,0x50,0xaf,
-0x04,0x21,0x00,0x14,0x06,0x02,0x0b,0x15,0x00,0x4c,0x60,0x00,0x02,0x24,0x15,0x00,
-0x5c,0x04,0x46,0x00,0x05,0x36,0x15,0x00,0x21,0x05,0x17,0x5e,0x00,0x0b,0x3f,0x00,
-0x00,0x4e,0x05,0x0d,0x15,0x00,0xf9,0x07,0x01,0xdb,0x99,0x00,0x00,0x97,0x70,0x00,
-0x00,0x57,0x3c,0x86,0x00,0x1d,0xab,0x80,0x00,0x0b,0x20,0x2c,0x88,0x30,0x22,0x05,
-0x79,0x07,0x40,0x04,0x20,0x00,0x04,0x00,0x1c,0x05,0x4b,0x00,0x33,0x00,0x05,0x12,
-0x00,0x49,0x60,0x00,0x42,0x20,0x12,0x00,0x00,0x1d,0x08,0x0a,0x24,0x00,0x61,0x06,
-0x00,0x22,0x04,0x70,0x47,0x03,0x00,0x42,0x05,0x01,0x40,0x47,0x0c,0x00,0x74,0x00,
-0x03,0x40,0x05,0x40,0x04,0x70,0x02,0x00,0x46,0x16,0x43,0x00,0x00,0x0e,0x00,0xfb,
-0x04,0x3c,0x9a,0x23,0x80,0x1b,0x9c,0x40,0xb3,0x80,0x1b,0x3c,0x9a,0x20,0x02,0x74,
-0x20,0x05,0x18,0x00,0x31,0x05,0x20,0x02,0xa0,0x2b,0x01,0x0b,0x37,0x05,0x3e,0x00,
-0x29,0x00,0x15,0x00,0x20,0x01,0x96,0x15,0x01,0x0b,0x15,0x00,0x3e,0x03,0x77,0x00,
-0x15,0x00,0x3e,0x04,0x27,0x00,0x15,0x00,0xfa,0x11,0x00,0x00,0x56,0x48,0x0a,0xc0,
-0x49,0x67,0x10,0x01,0x09,0x9a,0x90,0x66,0x07,0xc0,0x83,0x53,0xb0,0x58,0x60,0xc0,
-0x0d,0xaa,0x30,0x12,0x00,0x00,0x04,0x80,0x00,0x05,0x66,0x05,0x4b,0x00,0x47,0x00,
-0x04,0x12,0x00,0x49,0xc2,0x00,0x31,0x40,0x12,0x00,0x10,0x06,0xa7,0x01,0x0a,0x24,
-0x00,0x00,0x57,0x01,0x08,0x75,0x05,0x00,0x39,0x06,0xf1,0x0d,0xb9,0x80,0x56,0x07,
-0x45,0xb8,0x80,0x56,0x00,0x00,0x2b,0xa4,0x07,0x44,0x60,0x74,0x93,0x07,0x40,0xa3,
-0x75,0x7a,0x30,0x04,0x30,0x2a,0x96,0x28,0x5b,0x05,0x24,0x00,0x61,0x65,0x05,0x24,
-0x04,0x51,0x0a,0x00,0x44,0x00,0x00,0x08,0x84,0x0c,0x00,0x24,0x07,0x25,0x0a,0x00,
-0x44,0x03,0x50,0x03,0x50,0x0c,0x00,0xe4,0x4a,0x99,0x9a,0x22,0x98,0xd8,0x95,0xa1,
-0x1c,0x00,0x05,0xaa,0x89,0x93,0x92,0x05,0x44,0x02,0x90,0x05,0x20,0x8c,0x05,0x24,
-0x00,0x61,0x0a,0x00,0x24,0x04,0x50,0x0a,0x00,0x24,0x07,0x34,0x0a,0x00,0x91,0x06,
-0x10,0x65,0x06,0x50,0x65,0x06,0x50,0x16,0x06,0x00,0x53,0x65,0x00,0x05,0x50,0x06,
-0x02,0x00,0x24,0x25,0x51,0x0a,0x00,0xf0,0x00,0x09,0x75,0x00,0x39,0x70,0x08,0x8d,
-0x05,0x60,0x92,0x64,0x0a,0x01,0x99,0x70,0x95,0x00,0x04,0x96,0x05,0xf7,0x00,0x05,
-0x30,0x01,0x99,0x80,0x82,0x09,0x18,0x20,0x91,0x1a,0x87,0x00,0x00,0x61,0x0d,0x00,
-0x28,0x04,0x51,0x1a,0x00,0x46,0x00,0x00,0x88,0x40,0xc2,0x05,0x27,0x07,0x24,0x1c,
-0x00,0x10,0x01,0xb2,0x03,0xf4,0x07,0x7a,0xaa,0x10,0x16,0x00,0x00,0x03,0x01,0x9a,
-0x90,0x82,0x7a,0x18,0x64,0x91,0x1d,0x87,0x00,0x20,0x00,0x04,0x20,0xbb,0x05,0x24,
-0x00,0x60,0x0a,0x00,0x24,0x04,0x50,0x0a,0x00,0x24,0x07,0x24,0x0a,0x00,0x26,0x01,
-0x60,0xbf,0x05,0xf6,0x02,0x65,0x00,0x06,0xb9,0x80,0x65,0x0a,0x16,0x50,0xa1,0x6a,
-0x98,0x06,0x50,0x00,0x25,0x51,0x1b,0x00,0x3e,0x05,0x87,0x00,0x4f,0x03,0x25,0x08,
-0x85,0x75,0x01,0x4c,0x04,0x00,0x02,0x74,0x1f,0x00,0x52,0x06,0x62,0x19,0x96,0x5a,
-0x8a,0x01,0xf3,0x02,0xc2,0x00,0x05,0x26,0x00,0x09,0x9a,0x10,0x33,0x00,0x60,0xa0,
-0x00,0xa0,0x00,0x02,0xa0,0x39,0x00,0x30,0xac,0x00,0x58,0xd6,0x07,0x19,0x00,0x6d,
-0x03,0x61,0x00,0x60,0x19,0x96,0x82,0x05,0x8a,0x01,0x1c,0x95,0x1c,0x00,0x25,0x05,
-0x50,0x38,0x07,0x1c,0x70,0x1c,0x00,0x25,0x02,0x40,0xc2,0x01,0x0d,0x38,0x00,0xf9,
-0x00,0x04,0x40,0x19,0x94,0x82,0x0b,0x92,0x00,0x2a,0x87,0x04,0x22,0x00,0x06,0x00,
-0xf2,0x08,0xf9,0x00,0x00,0x0b,0x81,0x2b,0x8d,0x00,0x83,0x0b,0x00,0x82,0x0b,0x00,
-0x2a,0x8d,0x00,0x70,0x03,0xfc,0x00,0x00,0x6d,0x52,0xb8,0xd0,0x83,0x0b,0x08,0x20,
-0xb0,0x2a,0x8d,0x00,0x07,0x86,0xce,0x03,0x25,0x08,0x84,0x1f,0x02,0x4a,0x04,0x00,
-0x48,0x20,0xea,0x03,0x15,0x72,0x45,0x02,0x1c,0x70,0x38,0x00,0x24,0x01,0x60,0x1c,
-0x00,0x53,0x5b,0x99,0x25,0xb9,0x70,0x1b,0x09,0x30,0x20,0x02,0xb0,0x17,0x00,0xaa,
-0x93,0x01,0x2b,0x84,0x00,0xb1,0x04,0x23,0x00,0x06,0x35,0x00,0x24,0x04,0x41,0x35,
-0x00,0x03,0xe0,0x00,0x07,0x8f,0x09,0x26,0x04,0x50,0x2d,0x08,0x59,0x04,0x04,0x00,
-0x28,0x40,0x1e,0x00,0x00,0x67,0x07,0x06,0x20,0x00,0x2c,0x00,0x70,0x3e,0x00,0x17,
-0x01,0x3e,0x00,0x0a,0x57,0x00,0x10,0x10,0x2d,0x00,0x39,0x40,0x02,0x80,0x40,0x00,
-0x5b,0x51,0x00,0x01,0x34,0x00,0x01,0x0a,0x46,0x04,0x30,0x04,0x40,0xa6,0x08,0x61,
-0x56,0x00,0xc0,0xab,0x88,0xe4,0x1d,0x00,0xf6,0x06,0xc0,0x56,0x00,0xc0,0x1a,0xb3,
-0x00,0x5b,0x9a,0x05,0x60,0xb0,0x56,0x0b,0x05,0x60,0xb0,0x08,0x15,0x23,0x71,0xde,
-0x04,0x44,0x00,0x00,0x28,0x82,0x2b,0x03,0x28,0x18,0x83,0xf8,0x04,0x06,0x18,0x00,
-0x46,0x04,0x31,0x06,0x70,0x18,0x00,0x24,0x07,0x70,0x18,0x00,0x00,0x74,0x0a,0x40,
-0x58,0xa3,0x04,0x30,0x7c,0x03,0x51,0x07,0x50,0xb2,0x24,0x00,0x86,0x0a,0x00,0x06,
-0x09,0x33,0x47,0x00,0x0c,0x03,0x00,0x92,0x31,0x0b,0x47,0x3a,0x97,0x43,0x52,0x65,
-0x73,0x02,0x00,0x40,0x02,0xb1,0x00,0x59,0x74,0x08,0x02,0x19,0x0a,0xa2,0x05,0x00,
-0xb0,0x5a,0xa5,0x00,0x05,0x50,0x05,0x60,0x02,0x00,0x2b,0x2b,0x30,0xb9,0x0a,0x20,
-0x00,0xa0,0xe2,0x07,0x09,0x66,0x09,0x10,0x55,0x99,0x08,0xf9,0x00,0x65,0x2b,0x06,
-0x5b,0x10,0x6c,0x90,0x06,0x55,0x80,0x05,0x00,0x01,0x30,0x00,0xe0,0x0a,0x43,0x19,
-0x00,0x00,0x65,0x10,0x04,0x09,0x18,0x00,0x00,0xa8,0x17,0x02,0xa4,0x09,0x65,0x32,
-0x61,0x56,0x91,0x05,0x62,0x19,0x00,0x37,0x66,0x96,0x51,0x2e,0x00,0x11,0x60,0x15,
-0x00,0x00,0x43,0x00,0x24,0x66,0x56,0x15,0x00,0x22,0x9a,0x20,0x15,0x00,0x80,0x46,
-0x04,0x60,0x8a,0x04,0x60,0x46,0x00,0x4c,0x00,0x1c,0x32,0x06,0x06,0x24,0x00,0x61,
-0x7e,0x01,0x0c,0x19,0x00,0x45,0x41,0x00,0x00,0x80,0x9b,0x01,0x9c,0x01,0x40,0x04,
-0x40,0x01,0x35,0x00,0x00,0x42,0x40,0x00,0x24,0x03,0x41,0x23,0x00,0x90,0x18,0x00,
-0x00,0x7a,0xa8,0x07,0x40,0xb0,0x74,0xf2,0x0c,0xf2,0x02,0x5b,0x00,0xc5,0xb7,0x0c,
-0x56,0x93,0xc5,0x60,0xbc,0x56,0x03,0xe0,0x00,0x69,0x79,0x99,0x24,0x00,0x5e,0x00,
-0x6a,0x04,0x88,0x00,0x22,0x06,0x28,0x08,0x84,0x9d,0x04,0x4c,0x01,0x00,0x01,0x76,
-0x22,0x00,0x28,0x06,0x72,0xdb,0x04,0x4c,0x98,0x20,0x00,0x11,0x22,0x00,0x45,0x05,
-0x88,0x01,0xaa,0x22,0x00,0xc0,0x1a,0xad,0xba,0xa0,0x84,0x09,0x20,0x00,0x92,0x09,
-0xa9,0x50,0x08,0x00,0xf0,0x05,0x19,0x8c,0xa9,0x90,0x19,0x98,0x99,0x88,0x30,0xaa,
-0x8a,0x83,0x0a,0x50,0x01,0xa8,0x79,0x87,0x00,0x32,0x88,0x07,0x08,0x06,0x0c,0x22,
-0x04,0x37,0xcd,0x0a,0x09,0x15,0x00,0x11,0x05,0x2c,0x05,0x02,0xe7,0x0a,0x42,0x03,
-0x20,0x61,0x00,0x08,0x04,0x08,0x22,0x00,0x13,0x13,0x37,0x00,0x59,0x00,0x74,0x00,
-0x05,0x00,0x4a,0x0c,0xea,0x00,0x60,0x3a,0xa3,0x49,0x57,0x01,0x68,0x4a,0x96,0x04,
-0x93,0x00,0x00,0x1c,0x00,0x24,0x04,0x50,0x34,0x0b,0x09,0x17,0x00,0x23,0x09,0x20,
-0x17,0x00,0x4e,0xa6,0x01,0xa0,0x04,0x35,0x00,0x14,0x40,0x51,0x00,0x07,0xa5,0x0c,
-0xf1,0x00,0xf0,0x00,0x08,0x10,0x14,0x03,0x80,0x9c,0x23,0x80,0x28,0x00,0xc3,0x06,
-0x50,0xa1,0x00,0x09,0xc4,0x0c,0x32,0x00,0xa3,0x81,0x1d,0x00,0x54,0x79,0xe9,0x50,
-0x6e,0x50,0x16,0x00,0xcc,0x03,0x80,0x09,0xc2,0x09,0xc3,0x02,0x80,0x00,0xc3,0x04,
-0x76,0x4d,0x07,0x00,0x6e,0x06,0x04,0xea,0x05,0x2c,0x05,0x87,0x1e,0x00,0x06,0x1c,
-0x00,0x4b,0x04,0x04,0x00,0x27,0x99,0x07,0x15,0x72,0x40,0x06,0x49,0x52,0x00,0x05,
-0x20,0x1c,0x00,0x00,0x43,0x07,0x05,0x40,0x06,0x4a,0x99,0x10,0x01,0x10,0x3a,0x00,
-0x14,0x88,0x3b,0x02,0x26,0x2b,0x9c,0x70,0x00,0x65,0x28,0x1a,0x98,0x10,0x07,0x50,
-0x54,0x00,0x40,0x48,0x00,0x06,0x00,0xcb,0x09,0x0e,0x7d,0x0d,0x38,0x00,0x55,0x00,
-0x65,0x0c,0x01,0x54,0x09,0x09,0x0f,0x08,0x26,0x05,0x50,0x97,0x06,0x4a,0x07,0x16,
-0x00,0x00,0x2d,0x08,0x01,0x3f,0x08,0x09,0xa7,0x0d,0x25,0x01,0x60,0x97,0x0c,0x00,
-0xf9,0x04,0x09,0x1c,0x00,0x24,0x03,0x30,0x1c,0x00,0x01,0x6f,0x05,0x09,0x1c,0x00,
-0x24,0x04,0x40,0x1c,0x00,0x32,0x19,0x35,0x60,0xd2,0x03,0xd2,0x27,0x05,0xe0,0x10,
-0x00,0x29,0x82,0x01,0x8b,0x38,0x20,0x39,0x98,0x2b,0x0b,0xf0,0x01,0x26,0xbe,0x00,
-0x8d,0xff,0xff,0x00,0xff,0xe9,0x5f,0x00,0xf3,0x00,0x0f,0x00,0xf0,0x04,0x00,0xf0,
-0x07,0x0a,0xff,0xaf,0xf0,0x0a,0xfa,0xaf,0xa0,0x00,0x00,0xbd,0xcc,0xce,0xab,0x8b,
-0x00,0x07,0x58,0xcd,0x66,0x6a,0xac,0x04,0x00,0x00,0x0c,0x00,0x00,0x14,0x00,0xf0,
-0x01,0x34,0x14,0x44,0x43,0xff,0x7f,0xff,0xff,0xab,0x4b,0xbb,0xba,0xbc,0x5c,0xcc,
-0xcb,0x0c,0x00,0x43,0x67,0x17,0x88,0x86,0x14,0x00,0x00,0x02,0x0d,0xf0,0x01,0x9a,
-0x00,0x00,0x09,0xfa,0xa9,0x00,0x9f,0xa0,0xaf,0x99,0xfa,0x00,0x0a,0xff,0xa0,0x7e,
-0x1c,0xf0,0x34,0x00,0x63,0x00,0x72,0xcf,0x4a,0xf4,0x1d,0xff,0x60,0x0a,0xff,0x30,
-0xaf,0x7d,0xf3,0xa6,0x01,0xb3,0x00,0x0c,0x51,0x00,0x1d,0x7d,0x6e,0x70,0x8d,0x0d,
-0x65,0xf1,0xc7,0x0d,0x60,0xe6,0xd7,0x06,0x20,0xe6,0x9d,0x00,0x04,0xf2,0x1e,0xc7,
-0x8f,0x80,0x01,0x9d,0xc6,0x00,0x00,0x0c,0xc0,0x00,0x18,0x8f,0xf8,0x81,0x8f,0xfe,
-0xef,0xf8,0x2f,0xe0,0x0e,0xf2,0x04,0x00,0x00,0x0c,0x00,0x00,0x14,0x00,0x00,0x1c,
-0x00,0xf4,0x19,0x00,0x00,0x30,0x22,0x00,0x00,0xaf,0xaa,0xa0,0x01,0xda,0x6a,0xfa,
-0x03,0xe8,0xbf,0xb8,0xe3,0xb6,0xdf,0xff,0xd6,0xb0,0x8f,0xfb,0xff,0x80,0x08,0xfc,
-0x0c,0xf8,0x00,0x5b,0x80,0x8b,0x50,0x00,0x0f,0xf0,0x00,0x04,0x00,0xf0,0x17,0x07,
-0xff,0xff,0x70,0x00,0x9f,0xf9,0x00,0x78,0x7a,0xa7,0x87,0xff,0xfb,0xbf,0xff,0xff,
-0xff,0xfb,0xbf,0x05,0xff,0xff,0xf5,0x01,0xe3,0x00,0x03,0xe1,0xa8,0x00,0x00,0x08,
-0xaf,0xff,0x50,0x6f,0xff,0x01,0x00,0x10,0xfd,0x04,0x00,0x00,0x55,0x0c,0xf1,0x12,
-0x02,0xbf,0xfb,0x3f,0x2e,0x92,0x18,0xff,0x9a,0x00,0x6c,0xff,0x31,0x00,0x24,0x44,
-0x44,0x42,0x00,0x13,0xff,0xc6,0x00,0xb9,0xfe,0xa5,0x5b,0xd1,0xf2,0x8c,0xc8,0x10,
-0x30,0x48,0x04,0x20,0x34,0xcf,0x35,0x00,0xf0,0x06,0xab,0xff,0x00,0x4f,0x00,0x01,
-0x00,0x09,0x00,0x34,0xcf,0x01,0xff,0xff,0x1b,0xff,0xff,0x1b,0xbb,0xff,0x01,0x07,
-0x0e,0x10,0x01,0x25,0x00,0xf2,0x20,0x54,0x00,0x00,0x90,0x23,0xb3,0x34,0xcf,0x02,
+0xd2,0x71,0xd2,0xcb,0xd2,0xe2,0xd2,0x38,0xd5,0xa0,0xd7,0x80,0xd8,0x00,0x01,0x00,
+0x2f,0xfe,0x00,0x01,0x00,0x06,0x1b,0xf9,0x08,0x00,0x00,0x01,0x00,0xbf,0xfd,0xfc,
+0x00,0xff,0xfc,0x00,0xfb,0x00,0x00,0x00,0x01,0x35,0x00,0x03,0x2f,0x01,0x01,0x1a,
+0x00,0x04,0x2f,0xf5,0x00,0x01,0x00,0x18,0x1f,0xf2,0x21,0x00,0x0d,0x03,0x94,0x00,
+0xb1,0xfc,0x00,0xff,0x00,0x00,0xf8,0xff,0xfb,0xfc,0x00,0xfa,0x11,0x00,0x00,0x0f,
+0x00,0x4f,0xff,0xff,0xfd,0xfe,0x84,0x00,0x01,0x10,0xfe,0x1d,0x00,0x1f,0xfd,0x50,
+0x00,0x04,0x1c,0xfe,0x0a,0x00,0x19,0xff,0x1f,0x00,0x06,0x0e,0x00,0x13,0xfa,0x0e,
+0x00,0x00,0x4e,0x00,0x3e,0xff,0xfd,0xff,0x47,0x00,0x0b,0x0f,0x01,0x05,0x42,0x00,
+0x11,0xff,0x37,0x00,0x29,0xff,0xfe,0x33,0x00,0x11,0xf1,0x19,0x01,0x15,0xf0,0x27,
+0x00,0x20,0xfe,0xff,0x23,0x00,0x01,0x2e,0x00,0x0e,0x4a,0x00,0x02,0x5f,0x00,0x1e,
+0x01,0xb2,0x01,0x0e,0xaa,0x00,0x0f,0x01,0x00,0x0b,0x1b,0xfc,0xaa,0x00,0x10,0xfe,
+0x74,0x00,0x00,0x79,0x00,0x14,0xfc,0x12,0x00,0x14,0xeb,0x75,0x00,0x97,0xfc,0x00,
+0x00,0xef,0xfd,0xf5,0xf7,0x00,0xf1,0x03,0x02,0x28,0xf8,0xfa,0x4d,0x00,0x73,0xec,
+0x00,0x00,0x00,0xf7,0x00,0xf4,0x49,0x00,0x10,0xfe,0xbb,0x00,0x00,0x85,0x00,0x03,
+0x07,0x02,0x1c,0xfa,0x7c,0x00,0x10,0xfd,0xe4,0x00,0x1f,0xfe,0xa3,0x00,0x0e,0x1e,
+0xfb,0xad,0x01,0x08,0x63,0x01,0x93,0xf2,0xf2,0x00,0x00,0xfb,0xfe,0xf1,0xff,0x01,
+0x70,0x02,0xf2,0x02,0xf9,0xfa,0x00,0xf9,0xfa,0xfb,0xf9,0x00,0xfa,0xfc,0xfc,0xfb,
+0xfc,0x00,0xf5,0xf9,0xfa,0x32,0x01,0x66,0xf2,0xfe,0x00,0x00,0xfb,0xff,0x43,0x01,
+0x62,0xfd,0xfd,0x00,0x00,0xfd,0xfe,0x67,0x01,0x25,0x00,0x01,0x59,0x01,0x22,0xf8,
+0xfc,0x6c,0x00,0x13,0x01,0x11,0x00,0x23,0xfe,0xfe,0x8a,0x01,0x1a,0x00,0xe8,0x02,
+0x14,0xfd,0x7f,0x00,0x15,0x01,0x8b,0x00,0x02,0xd4,0x01,0x07,0x9e,0x00,0xe0,0x01,
+0xfd,0xf3,0xfd,0x00,0x00,0xfa,0xfe,0xfa,0xff,0x01,0xfa,0x01,0x01,0x9e,0x00,0x70,
+0xfb,0xfc,0xff,0xfe,0xfc,0xfe,0xfc,0xfa,0x01,0x66,0xff,0xfe,0x01,0xfa,0xfc,0xfc,
+0xd7,0x00,0x09,0xcc,0x01,0x14,0xff,0x4e,0x00,0x0e,0x1e,0x01,0x04,0x1c,0x00,0x0f,
+0xcf,0x01,0x07,0x0f,0x10,0x02,0x10,0x1f,0xfe,0x27,0x00,0x0b,0x2e,0xff,0xff,0x41,
+0x02,0x0f,0x68,0x02,0x25,0x07,0x73,0x01,0x0e,0x8a,0x03,0x19,0x01,0x3c,0x00,0x15,
+0x01,0x56,0x03,0x0f,0x01,0x00,0x25,0x0e,0x8a,0x00,0x1f,0xf8,0xea,0x00,0x13,0x1d,
+0x01,0x2b,0x00,0x00,0xf7,0x01,0x01,0x9f,0x00,0x10,0x03,0x58,0x02,0x0f,0x78,0x00,
+0x1b,0x1b,0x01,0x2a,0x05,0x02,0xf5,0x03,0x0a,0xed,0x00,0x0e,0xa0,0x00,0x0f,0xea,
+0x00,0x1d,0x1f,0xff,0x27,0x00,0x2c,0x0f,0x43,0x00,0x0a,0x12,0x01,0x1c,0x12,0x9c,
+0x02,0x03,0x00,0x00,0x00,0x04,0x00,0x04,0x05,0x21,0x00,0x00,0xc3,0x06,0xf1,0x09,
+0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,
+0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,0xff,0x0c,0x1a,0x1b,0x1c,0x00,
+0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,
+0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x73,0x00,0x04,0x11,0x06,0x01,0x00,0x00,0x84,
+0x07,0x90,0x0a,0x0a,0x0c,0x0c,0x0c,0x0c,0x09,0x0c,0x09,0x01,0x00,0xa1,0x00,0x00,
+0x0d,0x0d,0x0d,0x0d,0x17,0x00,0x00,0x1a,0x01,0x00,0x61,0x00,0x1c,0x1d,0x1d,0x1d,
+0x1d,0x31,0x00,0x20,0x1f,0x21,0x01,0x00,0x02,0x3d,0x00,0x50,0x24,0x1b,0x24,0x06,
+0x1a,0x02,0x00,0x22,0x08,0x1c,0x02,0x00,0x64,0x09,0x00,0x09,0x00,0x0a,0x1d,0x02,
+0x00,0x04,0x64,0x00,0x55,0x0c,0x1f,0x00,0x00,0x0c,0x02,0x00,0x83,0x00,0x00,0x0d,
+0x00,0x0e,0x00,0x00,0x0f,0x02,0x00,0x00,0x1f,0x00,0x00,0x02,0x00,0x80,0x1f,0x00,
+0x00,0x09,0x21,0x09,0x21,0x09,0x5b,0x00,0x11,0x22,0x02,0x00,0x03,0x01,0x00,0x11,
+0x13,0x02,0x00,0x17,0x0d,0x02,0x00,0x70,0x15,0x00,0x17,0x24,0x17,0x18,0x27,0x02,
+0x00,0x0f,0xb7,0x02,0x28,0x07,0x72,0x01,0x20,0x03,0x02,0x6d,0x01,0x4a,0x06,0x07,
+0x06,0x08,0x1f,0x00,0x00,0xce,0x00,0x60,0x00,0x0b,0x00,0x00,0x00,0x0b,0xc1,0x00,
+0x01,0x08,0x00,0xa0,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0xac,0x13,
+0x91,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,
+0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x73,
+0x00,0x02,0x11,0x0a,0x01,0x00,0x26,0x24,0x0b,0x12,0x00,0x10,0x0b,0x01,0x00,0xa1,
+0x00,0x0b,0x0f,0x0f,0x0f,0x0f,0x13,0x00,0x00,0x16,0x01,0x00,0x20,0x25,0x17,0x01,
+0x00,0x02,0x57,0x00,0x02,0x83,0x01,0xa0,0x26,0x1e,0x1e,0x1e,0x1e,0x1f,0x00,0x1f,
+0x0a,0x16,0x02,0x00,0x22,0x0b,0x17,0x02,0x00,0x10,0x00,0x24,0x00,0x14,0x17,0x02,
+0x00,0x05,0x16,0x00,0x0b,0x01,0x00,0x1b,0x0c,0x10,0x00,0x10,0x19,0x02,0x00,0x51,
+0x19,0x00,0x00,0x0b,0x1a,0x02,0x00,0x03,0x30,0x00,0x22,0x0d,0x1c,0x02,0x00,0x10,
+0x0e,0xa0,0x01,0x36,0x00,0x0f,0x1e,0x02,0x00,0x70,0x11,0x00,0x13,0x1f,0x13,0x14,
+0x22,0x02,0x00,0x1f,0x00,0x74,0x01,0x26,0x50,0x00,0x00,0x00,0x00,0x00,0xf0,0xff,
+0x6f,0x56,0x56,0x55,0x34,0x34,0x77,0x25,0x50,0x00,0x86,0x21,0xaa,0xc6,0x06,0x29,
+0x04,0xc8,0xc4,0x08,0x35,0x00,0x00,0x00,0x00,0x1a,0x00,0x2b,0x5b,0x04,0x80,0x50,
+0x0a,0xb3,0x01,0x01,0xc0,0x66,0x1c,0x00,0x6c,0x20,0x00,0x10,0x00,0x67,0x70,0x20,
+0x36,0x47,0x00,0x00,0x58,0x82,0x02,0x68,0x17,0x03,0x07,0x84,0x0b,0xa6,0x00,0xb6,
+0x50,0x1a,0xb0,0x48,0x34,0xb6,0x39,0x8b,0x80,0x96,0x03,0x50,0x90,0x46,0x06,0x40,
+0x64,0x03,0x70,0x09,0x00,0x14,0x71,0x01,0x80,0x0a,0x00,0x82,0x09,0x20,0xa0,0x37,
+0x05,0x00,0x08,0x00,0x6d,0x92,0x37,0x80,0x00,0x00,0x01,0x80,0x00,0x1a,0x00,0x6a,
+0xda,0x20,0x1a,0x00,0x82,0x70,0x78,0x00,0x44,0x00,0x90,0x03,0x60,0x09,0x00,0x18,
+0x00,0x72,0x00,0x40,0x00,0x1a,0x97,0x07,0x30,0xb0,0x82,0x0b,0x07,0x40,0xb0,0x1a,
+0x97,0x00,0x18,0xb1,0x0b,0x00,0xb0,0x0b,0x00,0xb0,0x3a,0x98,0x04,0x10,0xb0,0x00,
+0x65,0x00,0x76,0x00,0x6c,0x88,0x10,0x3a,0x97,0x31,0x0b,0x04,0xc6,0x30,0x0b,0x3a,
+0x97,0x00,0x98,0x00,0x68,0x80,0x28,0x38,0x08,0x8a,0xc2,0x00,0x38,0x00,0x0d,0xaa,
+0x01,0xd9,0x60,0x01,0x0b,0x12,0x30,0x91,0x0a,0x98,0x00,0x06,0x82,0x03,0xb9,0x50,
+0x75,0x0b,0x06,0x50,0xa0,0x0a,0x97,0x00,0x69,0x9d,0x10,0x02,0x80,0x00,0x91,0x00,
+0x28,0x00,0x0a,0x10,0x00,0x1a,0x97,0x05,0x60,0xb0,0x1c,0xb7,0x07,0x30,0xb0,0x3a,
+0x99,0x00,0x3a,0x95,0x82,0x0b,0x19,0x8c,0x00,0x1b,0x07,0xa2,0x43,0x00,0x00,0x43,
+0x52,0x00,0x00,0x52,0x91,0x00,0x02,0x85,0x8a,0x10,0x07,0xa3,0x00,0x01,0x39,0x97,
+0x00,0x00,0x39,0x97,0x58,0x20,0x01,0x8a,0x3a,0x71,0x10,0x00,0x5a,0xb2,0x20,0x56,
+0x02,0x90,0x04,0x10,0x06,0x10,0x03,0x87,0x87,0x01,0x80,0x77,0x26,0x62,0x81,0x90,
+0x88,0x0a,0x09,0x08,0x36,0x87,0xa7,0x40,0x67,0x75,0x00,0x00,0xe2,0x00,0x05,0x79,
+0x00,0x0b,0x0a,0x10,0x3c,0x9b,0x70,0xa1,0x00,0xb0,0x5b,0x9a,0x15,0x60,0x74,0x5b,
+0x9c,0x15,0x60,0x47,0x5b,0x9b,0x20,0x09,0x9a,0x46,0x60,0x07,0x83,0x00,0x06,0x60,
+0x07,0x09,0x9a,0x30,0x5b,0x99,0x15,0x60,0x29,0x56,0x00,0xc5,0x60,0x39,0x5b,0x9a,
+0x10,0x5b,0x99,0x25,0x60,0x00,0x5b,0x97,0x05,0x60,0x00,0x5b,0x99,0x20,0x1a,0x00,
+0x02,0x0d,0x00,0xf2,0x0a,0x56,0x00,0x00,0x09,0x9a,0x55,0x60,0x04,0x83,0x19,0xa5,
+0x70,0x0c,0x08,0x99,0x70,0x56,0x00,0xb0,0x56,0x00,0xb0,0x5b,0x99,0xe0,0x09,0x00,
+0x10,0x47,0x01,0x00,0x20,0x00,0x0c,0x02,0x00,0xf1,0x06,0x50,0x0b,0x5a,0xa5,0x56,
+0x08,0x50,0x56,0x95,0x00,0x5d,0xc0,0x00,0x57,0x3a,0x00,0x56,0x04,0x90,0x56,0x00,
+0x42,0x00,0x01,0x54,0x00,0xf0,0x1f,0x00,0x5d,0x00,0x0d,0x55,0xc4,0x05,0xc5,0x56,
+0xa0,0xb6,0x55,0x67,0x77,0x65,0x56,0x1e,0x16,0x50,0x5c,0x00,0xb0,0x5b,0x80,0xb0,
+0x56,0x94,0xb0,0x56,0x0b,0xc0,0x56,0x02,0xf0,0x09,0x9a,0x30,0x66,0x00,0xc0,0x83,
+0x00,0xb0,0x66,0x00,0xc0,0x9e,0x00,0x73,0x9a,0x45,0x60,0x1b,0x5b,0x89,0x35,0x84,
+0x00,0xf1,0x23,0x30,0x65,0x00,0xc0,0x92,0x00,0xc0,0x65,0x00,0xc0,0x09,0x9c,0x40,
+0x00,0x02,0x80,0x5b,0x9a,0x25,0x60,0x47,0x5b,0xab,0x15,0x60,0xb0,0x56,0x04,0x70,
+0x2a,0x89,0x16,0x60,0x22,0x06,0x97,0x05,0x10,0x65,0x3a,0x9a,0x20,0x79,0xe9,0x50,
+0x0c,0x00,0x00,0xc0,0x00,0x05,0x00,0xf2,0x31,0x74,0x01,0xa7,0x40,0x1a,0x74,0x01,
+0xa6,0x50,0x2a,0x1a,0x9a,0x20,0xa1,0x00,0xb4,0x70,0x65,0x0a,0x0a,0x00,0x65,0x80,
+0x00,0xe1,0x00,0xa1,0x0d,0x10,0xb5,0x63,0xb6,0x38,0x1a,0x82,0xa7,0x30,0xba,0x09,
+0xb0,0x08,0x70,0x4a,0x00,0x67,0x07,0x60,0x95,0xa0,0x02,0xf2,0x00,0xa6,0xa0,0x67,
+0x07,0x70,0x93,0x06,0x61,0xa0,0xb0,0x06,0xb2,0x46,0x00,0xf2,0x02,0x59,0x9e,0x40,
+0x04,0x80,0x02,0xa0,0x00,0xb1,0x00,0x9b,0x99,0x40,0x59,0x06,0x40,0x64,0x03,0x00,
+0xf1,0x01,0x05,0x90,0x91,0x00,0x37,0x00,0x0a,0x00,0x05,0x50,0x00,0xa0,0x00,0x40,
+0x86,0x38,0x01,0x00,0xf0,0x33,0x96,0x05,0x00,0x1b,0x60,0x82,0xa0,0x88,0x85,0x47,
+0x39,0x96,0x18,0x7b,0x83,0x0b,0x4b,0x9b,0x74,0x00,0x07,0xa9,0x80,0x74,0x0a,0x07,
+0x40,0xa0,0x7a,0x98,0x00,0x19,0x97,0x82,0x04,0x92,0x03,0x2a,0x96,0x00,0x0b,0x2b,
+0x8d,0x83,0x0b,0x82,0x0b,0x2a,0x8d,0x19,0x97,0x89,0x8a,0x94,0x00,0x2b,0x87,0x08,
+0x71,0xa0,0x7d,0x41,0xa0,0x1a,0x01,0xa0,0x19,0x00,0xc0,0x83,0x0b,0x2b,0x9d,0x18,
+0x97,0x74,0x00,0x7a,0xa8,0x74,0x0b,0x02,0x00,0x71,0x43,0x65,0x65,0x65,0x65,0x04,
+0x20,0x79,0x00,0xf0,0x01,0x42,0xb2,0x74,0x00,0x07,0x48,0x60,0x7b,0x70,0x07,0x8b,
+0x00,0x74,0x39,0x00,0x65,0x01,0x00,0xe4,0x7a,0xaa,0x9b,0x37,0x40,0xc0,0x47,0x74,
+0x0b,0x04,0x77,0x40,0xb0,0x47,0x36,0x00,0xf0,0x02,0x19,0x98,0x08,0x20,0x91,0x82,
+0x09,0x11,0xa8,0x70,0x7a,0x88,0x07,0x40,0xa0,0x74,0x0b,0x89,0x00,0x24,0x00,0x00,
+0x7a,0x00,0xf2,0x0b,0x00,0x0b,0x00,0x07,0xb5,0x74,0x07,0x40,0x74,0x00,0x3a,0xa5,
+0x49,0x32,0x22,0x68,0x3a,0x96,0x38,0x09,0xc2,0x38,0x02,0x80,0x0c,0x30,0x3f,0x00,
+0xf0,0x28,0x2b,0x9c,0xa1,0x38,0x46,0x82,0x0a,0xa0,0x08,0x60,0xa0,0x77,0x0a,0x64,
+0x99,0x45,0x1b,0x77,0xa1,0x0c,0x22,0xb0,0x75,0x66,0x0a,0xa0,0x0a,0xa0,0x75,0x57,
+0xa1,0x37,0x46,0x81,0x09,0x80,0x08,0x30,0x69,0x00,0x59,0xc7,0x02,0xb0,0x0b,0x10,
+0x8b,0x86,0x00,0x00,0x75,0x0b,0x00,0xb0,0x96,0x27,0x03,0x41,0x75,0x00,0x00,0x54,
+0x01,0x00,0xf0,0x59,0x22,0x00,0x08,0x30,0x29,0x01,0xa0,0x0a,0x40,0xa0,0x29,0x08,
+0x30,0x00,0x00,0x19,0x70,0x74,0x23,0x95,0x00,0x00,0x20,0x00,0x00,0x00,0xc9,0x00,
+0x1b,0xaa,0xa5,0x90,0x18,0x00,0x00,0x86,0x1d,0xaa,0x93,0xa0,0x00,0x00,0xba,0x00,
+0x00,0x00,0x40,0x00,0x00,0x02,0x00,0x00,0x00,0x4f,0x00,0x00,0x04,0x98,0xaa,0xa6,
+0x0c,0x00,0x00,0x18,0x05,0x76,0xaa,0xb8,0x00,0x6e,0x00,0x00,0x00,0x04,0x00,0x00,
+0x00,0x07,0x20,0x00,0x08,0x7b,0x10,0x08,0x60,0x1b,0x11,0xad,0x08,0xb5,0x00,0xa0,
+0x91,0x00,0x0a,0x09,0x10,0x00,0xaa,0xd1,0x00,0x00,0x6a,0xa0,0x0b,0x00,0x00,0x12,
+0x00,0xe1,0x8d,0x08,0x94,0x0a,0x60,0x1c,0x20,0x0b,0x3a,0x30,0x00,0x0c,0x50,0x00,
+0x01,0x00,0xf1,0x20,0x06,0x60,0x00,0x00,0x0d,0xd0,0x00,0x00,0x77,0x87,0x00,0x00,
+0xd0,0x0d,0x00,0x08,0x60,0x06,0x80,0x1f,0xee,0xee,0xf1,0x00,0x02,0xa4,0x00,0x79,
+0xc1,0xc0,0x77,0x0f,0xd9,0x0b,0x02,0xf6,0xa0,0xb0,0x32,0x0b,0x08,0x50,0x05,0x90,
+0x08,0xbb,0x80,0x34,0x00,0xf1,0x40,0x13,0x32,0x00,0x02,0x6c,0xf6,0x60,0x09,0x52,
+0x71,0xa2,0x1b,0x00,0x00,0x66,0x0b,0x00,0x00,0x65,0x07,0x70,0x02,0xb0,0x00,0x8a,
+0xaa,0x20,0x00,0x02,0x10,0x00,0x00,0x30,0x00,0x00,0x0a,0xbd,0xab,0x40,0x1c,0x28,
+0x70,0x93,0x0c,0xbb,0x30,0x19,0x0b,0x01,0x00,0x19,0x07,0x60,0x00,0xa3,0x00,0x6b,
+0xba,0x30,0x06,0xcc,0xc8,0x0c,0x30,0x65,0x0d,0x01,0xb0,0x3e,0x3a,0x00,0xb8,0x7c,
+0x00,0xb2,0x1b,0x00,0x4b,0xb5,0x54,0x00,0xf1,0x71,0x99,0x10,0x57,0xdd,0x85,0x71,
+0x55,0x17,0x71,0x66,0x17,0x72,0xbb,0x37,0x70,0x00,0x07,0x47,0xff,0x84,0x00,0x66,
+0x10,0x00,0x01,0x30,0x06,0x08,0xdb,0xc0,0x99,0xc0,0x00,0x07,0x05,0x80,0x00,0x71,
+0x81,0x00,0x0b,0xab,0x00,0x00,0x30,0x7e,0xdc,0x00,0x00,0x01,0x00,0x68,0x86,0x66,
+0x77,0x53,0x9a,0x77,0x78,0xec,0x73,0x30,0x06,0x79,0x80,0x06,0x76,0x60,0x06,0x9c,
+0xc7,0x79,0x00,0x28,0x96,0x00,0x04,0xa9,0x85,0xb0,0x0c,0x07,0x80,0x66,0x19,0x05,
+0x63,0x19,0x0b,0x8b,0x5a,0x88,0x07,0xb2,0x03,0xd2,0x00,0x6b,0xba,0x20,0x02,0x97,
+0x00,0x00,0x0a,0x14,0x73,0x30,0x0b,0x02,0xbf,0xf4,0x04,0xde,0x9f,0xf5,0x08,0x5a,
+0xff,0xe0,0x0a,0x5f,0xff,0xf5,0x0d,0xcb,0xbb,0xb4,0x43,0x01,0xf0,0x02,0x03,0x90,
+0x00,0x16,0x65,0x9a,0x00,0x1a,0xaa,0xaa,0x60,0x05,0xfe,0xef,0xf2,0x00,0x49,0x14,
+0x00,0x12,0x70,0x29,0x01,0xf0,0x0b,0x04,0x72,0x00,0x00,0x04,0x77,0x80,0x00,0x04,
+0x66,0x20,0x00,0x54,0x93,0x00,0x0c,0x47,0x4b,0x00,0x1f,0x3d,0x3e,0x00,0x03,0x85,
+0x93,0xd8,0x00,0x92,0xa0,0x07,0xc3,0xa0,0x08,0x5a,0xa0,0x00,0x0a,0x03,0x00,0xf1,
+0x2b,0xaa,0xaa,0xa9,0x00,0x46,0x10,0x00,0x05,0x40,0x87,0x20,0x08,0x00,0x01,0x80,
+0x35,0x6a,0xb5,0x70,0x60,0x37,0x40,0x62,0x34,0x0b,0x90,0x24,0x06,0x77,0x77,0x70,
+0x00,0x00,0x0a,0x00,0x00,0x00,0x1d,0x81,0x02,0xb9,0xb7,0x80,0x09,0x10,0xb5,0x80,
+0x0a,0x00,0x2d,0x00,0x09,0x00,0x1c,0x00,0x27,0x00,0x1c,0x6c,0x00,0x8c,0x37,0x33,
+0x73,0x02,0x30,0x00,0x00,0x50,0xaf,0x04,0x21,0x00,0x14,0x06,0x02,0x0b,0x15,0x00,
+0x4c,0x60,0x00,0x02,0x24,0x15,0x00,0x5c,0x04,0x46,0x00,0x05,0x36,0x15,0x00,0x21,
+0x05,0x17,0x5e,0x00,0x0b,0x3f,0x00,0x00,0x4e,0x05,0x0d,0x15,0x00,0xf9,0x07,0x01,
+0xdb,0x99,0x00,0x00,0x97,0x70,0x00,0x00,0x57,0x3c,0x86,0x00,0x1d,0xab,0x80,0x00,
+0x0b,0x20,0x2c,0x88,0x30,0x22,0x05,0x79,0x07,0x40,0x04,0x20,0x00,0x04,0x00,0x1c,
+0x05,0x4b,0x00,0x33,0x00,0x05,0x12,0x00,0x49,0x60,0x00,0x42,0x20,0x12,0x00,0x4a,
+0x07,0x06,0x00,0x00,0x24,0x00,0x61,0x06,0x00,0x22,0x04,0x70,0x47,0x03,0x00,0x42,
+0x05,0x01,0x40,0x47,0x0c,0x00,0x74,0x00,0x03,0x40,0x05,0x40,0x04,0x70,0x02,0x00,
+0x46,0x16,0x43,0x00,0x00,0x0e,0x00,0xfb,0x04,0x3c,0x9a,0x23,0x80,0x1b,0x9c,0x40,
+0xb3,0x80,0x1b,0x3c,0x9a,0x20,0x02,0x74,0x20,0x05,0x18,0x00,0x31,0x05,0x20,0x02,
+0xa0,0x2b,0x01,0x0b,0x37,0x05,0x3e,0x00,0x29,0x00,0x15,0x00,0x20,0x01,0x96,0x15,
+0x01,0x0b,0x15,0x00,0x3e,0x03,0x77,0x00,0x15,0x00,0x3e,0x04,0x27,0x00,0x15,0x00,
+0xfa,0x11,0x00,0x00,0x56,0x48,0x0a,0xc0,0x49,0x67,0x10,0x01,0x09,0x9a,0x90,0x66,
+0x07,0xc0,0x83,0x53,0xb0,0x58,0x60,0xc0,0x0d,0xaa,0x30,0x12,0x00,0x00,0x04,0x80,
+0x00,0x05,0x66,0x05,0x4b,0x00,0x47,0x00,0x04,0x12,0x00,0x49,0xc2,0x00,0x31,0x40,
+0x12,0x00,0x10,0x06,0xa7,0x01,0x0a,0x24,0x00,0x00,0x57,0x01,0x08,0x75,0x05,0x00,
+0x39,0x06,0xf1,0x0d,0xb9,0x80,0x56,0x07,0x45,0xb8,0x80,0x56,0x00,0x00,0x2b,0xa4,
+0x07,0x44,0x60,0x74,0x93,0x07,0x40,0xa3,0x75,0x7a,0x30,0x04,0x30,0x2a,0x96,0x28,
+0x5b,0x05,0x24,0x00,0x61,0x65,0x05,0x24,0x04,0x51,0x0a,0x00,0x44,0x00,0x00,0x08,
+0x84,0x0c,0x00,0x24,0x07,0x25,0x0a,0x00,0x44,0x03,0x50,0x03,0x50,0x0c,0x00,0xe4,
+0x4a,0x99,0x9a,0x22,0x98,0xd8,0x95,0xa1,0x1c,0x00,0x05,0xaa,0x89,0x93,0x92,0x05,
+0x44,0x02,0x90,0x05,0x20,0x8c,0x05,0x24,0x00,0x61,0x0a,0x00,0x24,0x04,0x50,0x0a,
+0x00,0x24,0x07,0x34,0x0a,0x00,0x91,0x06,0x10,0x65,0x06,0x50,0x65,0x06,0x50,0x16,
+0x06,0x00,0x53,0x65,0x00,0x05,0x50,0x06,0x02,0x00,0x24,0x25,0x51,0x0a,0x00,0xf0,
+0x00,0x09,0x75,0x00,0x39,0x70,0x08,0x8d,0x05,0x60,0x92,0x64,0x0a,0x01,0x99,0x70,
+0x95,0x00,0x04,0x96,0x05,0xf7,0x00,0x05,0x30,0x01,0x99,0x80,0x82,0x09,0x18,0x20,
+0x91,0x1a,0x87,0x00,0x00,0x61,0x0d,0x00,0x28,0x04,0x51,0x1a,0x00,0x46,0x00,0x00,
+0x88,0x40,0xc2,0x05,0x27,0x07,0x24,0x1c,0x00,0x10,0x01,0xb2,0x03,0xf4,0x07,0x7a,
+0xaa,0x10,0x16,0x00,0x00,0x03,0x01,0x9a,0x90,0x82,0x7a,0x18,0x64,0x91,0x1d,0x87,
+0x00,0x20,0x00,0x04,0x20,0xbb,0x05,0x24,0x00,0x60,0x0a,0x00,0x24,0x04,0x50,0x0a,
+0x00,0x24,0x07,0x24,0x0a,0x00,0x26,0x01,0x60,0xbf,0x05,0xf6,0x02,0x65,0x00,0x06,
+0xb9,0x80,0x65,0x0a,0x16,0x50,0xa1,0x6a,0x98,0x06,0x50,0x00,0x25,0x51,0x1b,0x00,
+0x3e,0x05,0x87,0x00,0x4f,0x03,0x25,0x08,0x85,0x75,0x01,0x4c,0x04,0x00,0x02,0x74,
+0x1f,0x00,0x52,0x06,0x62,0x19,0x96,0x5a,0x8a,0x01,0xf3,0x02,0xc2,0x00,0x05,0x26,
+0x00,0x09,0x9a,0x10,0x33,0x00,0x60,0xa0,0x00,0xa0,0x00,0x02,0xa0,0x39,0x00,0x30,
+0xac,0x00,0x58,0xd6,0x07,0x19,0x00,0x6d,0x03,0x61,0x00,0x60,0x19,0x96,0x82,0x05,
+0x8a,0x01,0x1c,0x95,0x1c,0x00,0x25,0x05,0x50,0x38,0x07,0x1c,0x70,0x1c,0x00,0x25,
+0x02,0x40,0xc2,0x01,0x0d,0x38,0x00,0xf9,0x00,0x04,0x40,0x19,0x94,0x82,0x0b,0x92,
+0x00,0x2a,0x87,0x04,0x22,0x00,0x06,0x00,0xf2,0x08,0xf9,0x00,0x00,0x0b,0x81,0x2b,
+0x8d,0x00,0x83,0x0b,0x00,0x82,0x0b,0x00,0x2a,0x8d,0x00,0x70,0x03,0xfc,0x00,0x00,
+0x6d,0x52,0xb8,0xd0,0x83,0x0b,0x08,0x20,0xb0,0x2a,0x8d,0x00,0x07,0x86,0xce,0x03,
+0x25,0x08,0x84,0x1f,0x02,0x4a,0x04,0x00,0x48,0x20,0xea,0x03,0x15,0x72,0x45,0x02,
+0x1c,0x70,0x38,0x00,0x24,0x01,0x60,0x1c,0x00,0x53,0x5b,0x99,0x25,0xb9,0x70,0x1b,
+0x09,0x30,0x20,0x02,0xb0,0x17,0x00,0xaa,0x93,0x01,0x2b,0x84,0x00,0xb1,0x04,0x23,
+0x00,0x06,0x35,0x00,0x24,0x04,0x41,0x35,0x00,0x03,0xe0,0x00,0x07,0x8f,0x09,0x26,
+0x04,0x50,0x2d,0x08,0x59,0x04,0x04,0x00,0x28,0x40,0x1e,0x00,0x00,0x67,0x07,0x06,
+0x20,0x00,0x2c,0x00,0x70,0x3e,0x00,0x17,0x01,0x3e,0x00,0x0a,0x57,0x00,0x10,0x10,
+0x2d,0x00,0x39,0x40,0x02,0x80,0x40,0x00,0x5b,0x51,0x00,0x01,0x34,0x00,0x01,0x0a,
+0x46,0x04,0x30,0x04,0x40,0xa6,0x08,0x61,0x56,0x00,0xc0,0xab,0x88,0xe4,0x1d,0x00,
+0xf6,0x06,0xc0,0x56,0x00,0xc0,0x1a,0xb3,0x00,0x5b,0x9a,0x05,0x60,0xb0,0x56,0x0b,
+0x05,0x60,0xb0,0x08,0x15,0x23,0x71,0xde,0x04,0x44,0x00,0x00,0x28,0x82,0x2b,0x03,
+0x28,0x18,0x83,0xf8,0x04,0x06,0x18,0x00,0x46,0x04,0x31,0x06,0x70,0x18,0x00,0x24,
+0x07,0x70,0x18,0x00,0x00,0x74,0x0a,0x40,0x58,0xa3,0x04,0x30,0x7c,0x03,0x51,0x07,
+0x50,0xb2,0x24,0x00,0x86,0x0a,0x00,0x06,0x09,0x33,0x47,0x00,0x0c,0x03,0x00,0x92,
+0x31,0x0b,0x47,0x3a,0x97,0x43,0x52,0x65,0x73,0x02,0x00,0x40,0x02,0xb1,0x00,0x59,
+0x74,0x08,0x02,0x19,0x0a,0xa2,0x05,0x00,0xb0,0x5a,0xa5,0x00,0x05,0x50,0x05,0x60,
+0x02,0x00,0x2b,0x2b,0x30,0xb9,0x0a,0x20,0x00,0xa0,0xe2,0x07,0x09,0x66,0x09,0x10,
+0x55,0x99,0x08,0xf9,0x00,0x65,0x2b,0x06,0x5b,0x10,0x6c,0x90,0x06,0x55,0x80,0x05,
+0x00,0x01,0x30,0x00,0xe0,0x0a,0x43,0x19,0x00,0x00,0x65,0x10,0x04,0x09,0x18,0x00,
+0x42,0x05,0x00,0x00,0x70,0xa4,0x09,0x65,0x32,0x61,0x56,0x91,0x05,0x62,0x19,0x00,
+0x37,0x66,0x96,0x51,0x2e,0x00,0x11,0x60,0x15,0x00,0x00,0x43,0x00,0x24,0x66,0x56,
+0x15,0x00,0x22,0x9a,0x20,0x15,0x00,0x80,0x46,0x04,0x60,0x8a,0x04,0x60,0x46,0x00,
+0x4c,0x00,0x1c,0x32,0x06,0x06,0x24,0x00,0x61,0x7e,0x01,0x0c,0x19,0x00,0x45,0x41,
+0x00,0x00,0x80,0x9b,0x01,0x9c,0x01,0x40,0x04,0x40,0x01,0x35,0x00,0x00,0x42,0x40,
+0x00,0x24,0x03,0x41,0x23,0x00,0x90,0x18,0x00,0x00,0x7a,0xa8,0x07,0x40,0xb0,0x74,
+0xf2,0x0c,0xf2,0x02,0x5b,0x00,0xc5,0xb7,0x0c,0x56,0x93,0xc5,0x60,0xbc,0x56,0x03,
+0xe0,0x00,0x69,0x79,0x99,0x24,0x00,0x5e,0x00,0x6a,0x04,0x88,0x00,0x22,0x06,0x28,
+0x08,0x84,0x9d,0x04,0x4c,0x01,0x00,0x01,0x76,0x22,0x00,0x28,0x06,0x72,0xdb,0x04,
+0x4c,0x98,0x20,0x00,0x11,0x22,0x00,0x45,0x05,0x88,0x01,0xaa,0x22,0x00,0xc0,0x1a,
+0xad,0xba,0xa0,0x84,0x09,0x20,0x00,0x92,0x09,0xa9,0x50,0x08,0x00,0xf0,0x05,0x19,
+0x8c,0xa9,0x90,0x19,0x98,0x99,0x88,0x30,0xaa,0x8a,0x83,0x0a,0x50,0x01,0xa8,0x79,
+0x87,0x00,0x32,0x88,0x07,0x08,0x06,0x0c,0x22,0x04,0x37,0xcd,0x0a,0x09,0x15,0x00,
+0x11,0x05,0x2c,0x05,0x02,0xe7,0x0a,0x42,0x03,0x20,0x61,0x00,0x08,0x04,0x08,0x22,
+0x00,0x13,0x13,0x37,0x00,0x59,0x00,0x74,0x00,0x05,0x00,0x4a,0x0c,0xea,0x00,0x60,
+0x3a,0xa3,0x49,0x57,0x01,0x68,0x4a,0x96,0x04,0x93,0x00,0x00,0x1c,0x00,0x24,0x04,
+0x50,0x34,0x0b,0x09,0x17,0x00,0x23,0x09,0x20,0x17,0x00,0x4e,0xa6,0x01,0xa0,0x04,
+0x35,0x00,0x14,0x40,0x51,0x00,0x07,0xa5,0x0c,0xf1,0x00,0xf0,0x00,0x08,0x10,0x14,
+0x03,0x80,0x9c,0x23,0x80,0x28,0x00,0xc3,0x06,0x50,0xa1,0x00,0x09,0xc4,0x0c,0x32,
+0x00,0xa3,0x81,0x1d,0x00,0x54,0x79,0xe9,0x50,0x6e,0x50,0x16,0x00,0xcc,0x03,0x80,
+0x09,0xc2,0x09,0xc3,0x02,0x80,0x00,0xc3,0x04,0x76,0x4d,0x07,0x00,0x6e,0x06,0x04,
+0xea,0x05,0x2c,0x05,0x87,0x1e,0x00,0x06,0x1c,0x00,0x4b,0x04,0x04,0x00,0x27,0x99,
+0x07,0x15,0x72,0x40,0x06,0x49,0x52,0x00,0x05,0x20,0x1c,0x00,0x00,0x43,0x07,0x05,
+0x40,0x06,0x4a,0x99,0x10,0x01,0x10,0x3a,0x00,0x14,0x88,0x3b,0x02,0x26,0x2b,0x9c,
+0x70,0x00,0x65,0x28,0x1a,0x98,0x10,0x07,0x50,0x54,0x00,0x40,0x48,0x00,0x06,0x00,
+0xcb,0x09,0x0e,0x7d,0x0d,0x33,0x00,0x55,0x00,0x65,0x0c,0x50,0x77,0xa1,0x0c,0x22,
+0xb0,0xf9,0x14,0x00,0x60,0x00,0x42,0x20,0x93,0x06,0x61,0xa0,0xb0,0x06,0xb2,0x00,
+0x0c,0x00,0x00,0xc0,0x00,0x05,0x50,0xa1,0x37,0x46,0x81,0x09,0x80,0x08,0x30,0x69,
+0x00,0x07,0x16,0x00,0x00,0x00,0x1e,0x00,0xfa,0x11,0x00,0x33,0x00,0x05,0x00,0x59,
+0x9e,0x40,0x04,0x80,0x02,0xa0,0x00,0xb1,0x00,0x9b,0x99,0x40,0x01,0x60,0x59,0xc7,
+0x02,0xb0,0x0b,0x10,0x8b,0x86,0x00,0x70,0x00,0x00,0x1c,0x00,0x24,0x03,0x30,0x1c,
+0x00,0x4a,0x04,0x23,0x00,0x06,0x1c,0x00,0x24,0x04,0x40,0x1c,0x00,0xf1,0x08,0x19,
+0x35,0x60,0x65,0x06,0x50,0x65,0x06,0x50,0x27,0x05,0xe0,0x10,0x00,0x29,0x82,0x01,
+0x8b,0x38,0x20,0x39,0x98,0x00,0x01,0x00,0xf0,0x01,0x26,0xbe,0x00,0x8d,0xff,0xff,
+0x00,0xff,0xe9,0x5f,0x00,0xf3,0x00,0x0f,0x00,0xf0,0x04,0x00,0xf0,0x07,0x0a,0xff,
+0xaf,0xf0,0x0a,0xfa,0xaf,0xa0,0x00,0x00,0xbd,0xcc,0xce,0xab,0x8b,0x00,0x07,0x58,
+0xcd,0x66,0x6a,0xac,0x04,0x00,0x00,0x0c,0x00,0x00,0x14,0x00,0xf0,0x01,0x34,0x14,
+0x44,0x43,0xff,0x7f,0xff,0xff,0xab,0x4b,0xbb,0xba,0xbc,0x5c,0xcc,0xcb,0x0c,0x00,
+0x44,0x67,0x17,0x88,0x86,0x14,0x00,0xf0,0x4b,0x00,0x00,0x00,0x9a,0x00,0x00,0x09,
+0xfa,0xa9,0x00,0x9f,0xa0,0xaf,0x99,0xfa,0x00,0x0a,0xff,0xa0,0x00,0x00,0x99,0x00,
+0x00,0x63,0x00,0x72,0xcf,0x4a,0xf4,0x1d,0xff,0x60,0x0a,0xff,0x30,0xaf,0x7d,0xf3,
+0xa6,0x01,0xb3,0x00,0x0c,0x51,0x00,0x1d,0x7d,0x6e,0x70,0x8d,0x0d,0x65,0xf1,0xc7,
+0x0d,0x60,0xe6,0xd7,0x06,0x20,0xe6,0x9d,0x00,0x04,0xf2,0x1e,0xc7,0x8f,0x80,0x01,
+0x9d,0xc6,0x00,0x00,0x0c,0xc0,0x00,0x18,0x8f,0xf8,0x81,0x8f,0xfe,0xef,0xf8,0x2f,
+0xe0,0x0e,0xf2,0x04,0x00,0x00,0x0c,0x00,0x00,0x14,0x00,0x00,0x1c,0x00,0xf4,0x19,
+0x00,0x00,0x30,0x22,0x00,0x00,0xaf,0xaa,0xa0,0x01,0xda,0x6a,0xfa,0x03,0xe8,0xbf,
+0xb8,0xe3,0xb6,0xdf,0xff,0xd6,0xb0,0x8f,0xfb,0xff,0x80,0x08,0xfc,0x0c,0xf8,0x00,
+0x5b,0x80,0x8b,0x50,0x00,0x0f,0xf0,0x00,0x04,0x00,0xf0,0x17,0x07,0xff,0xff,0x70,
+0x00,0x9f,0xf9,0x00,0x78,0x7a,0xa7,0x87,0xff,0xfb,0xbf,0xff,0xff,0xff,0xfb,0xbf,
+0x05,0xff,0xff,0xf5,0x01,0xe3,0x00,0x03,0xe1,0xa8,0x00,0x00,0x08,0xaf,0xff,0x50,
+0x6f,0xff,0x01,0x00,0x10,0xfd,0x04,0x00,0xf0,0x16,0x00,0x00,0x00,0x03,0x02,0xbf,
+0xfb,0x3f,0x2e,0x92,0x18,0xff,0x9a,0x00,0x6c,0xff,0x31,0x00,0x24,0x44,0x44,0x42,
+0x00,0x13,0xff,0xc6,0x00,0xb9,0xfe,0xa5,0x5b,0xd1,0xf2,0x8c,0xc8,0x10,0x30,0x48,
+0x01,0x30,0x09,0x34,0xcf,0x35,0x00,0xf0,0x0b,0xab,0xff,0x00,0x4f,0x00,0x01,0x00,
+0x09,0x00,0x34,0xcf,0x01,0xff,0xff,0x1b,0xff,0xff,0x1b,0xbb,0xff,0x01,0x00,0x4f,
+0x00,0x00,0x01,0x25,0x00,0xf2,0x20,0x54,0x00,0x00,0x90,0x23,0xb3,0x34,0xcf,0x02,
 0xc3,0xbf,0xff,0xf1,0xb5,0x6c,0xff,0xff,0x1b,0x56,0xca,0xbf,0xf0,0x2c,0x3a,0x00,
 0x4f,0x02,0x3b,0x30,0x00,0x10,0x05,0x40,0xdf,0xff,0xff,0xfd,0xf0,0x7f,0xff,0xff,
 0xf8,0xcf,0xb1,0xbf,0xfb,0x5b,0xb4,0x00,0x10,0xdf,0x87,0x00,0xf1,0x10,0xb4,0x00,
@@ -352,124 +411,70 @@ static const uint8_t lz4FontData[] ={
 0x0f,0xff,0x70,0x00,0xda,0x10,0xf5,0x01,0xb9,0x9b,0x90,0x9b,0x9f,0xff,0x0f,0xff,
 0xff,0xf0,0xff,0xff,0x07,0x00,0xae,0xf2,0x42,0x02,0x42,0x24,0x44,0x44,0x2f,0xff,
 0xff,0x01,0x00,0xc1,0xf8,0xbb,0xbb,0xb8,0x20,0x00,0x4f,0x80,0x2f,0xff,0x92,0xff,
-0x70,0x00,0x72,0xfe,0x5f,0xfd,0x22,0xf9,0x10,0x1b,0x04,0x0f,0xf1,0x1b,0x8f,0x80,
-0x00,0x00,0x7f,0xff,0x70,0x00,0x5f,0xff,0xff,0x50,0x0e,0xff,0xff,0xfe,0x00,0x58,
-0x88,0x88,0x50,0x0f,0xff,0xff,0xff,0x00,0xab,0xbb,0xbb,0xa0,0x00,0x06,0x20,0x07,
-0xf4,0x07,0xf5,0x05,0xf5,0x00,0x2e,0xb0,0x03,0x00,0xf1,0x07,0x60,0x00,0x10,0x26,
-0x00,0x04,0xf6,0x00,0x05,0xf6,0x00,0x06,0xf5,0x00,0xbe,0x20,0xbe,0x10,0x6e,0x10,
-0x00,0x10,0x1c,0x0f,0xf0,0x01,0x03,0xf3,0x00,0x00,0x4f,0x40,0x07,0x8a,0xfa,0x87,
-0xef,0xff,0xff,0xe0,0x04,0xf4,0x0e,0x00,0x80,0x00,0x01,0xb1,0x00,0x78,0x88,0x88,
-0x7e,0x59,0x00,0xf1,0x0c,0x8c,0xcc,0x80,0x01,0xdd,0x16,0x3d,0xd1,0xcf,0x55,0xed,
-0x5f,0xcb,0xf5,0xdf,0xd5,0xfc,0x1d,0xd3,0x73,0xdd,0x10,0x08,0xdc,0xc8,0x10,0x1d,
-0x89,0x01,0xf1,0x11,0x5e,0x8c,0xcc,0xa2,0x00,0x00,0x2d,0xb4,0x49,0xf4,0x00,0x7a,
-0x1a,0xff,0x3f,0xe1,0x07,0xfa,0x06,0xf7,0xff,0x10,0x0a,0xf3,0x03,0xef,0x40,0x00,
-0x06,0xcc,0x71,0xbb,0x02,0x01,0x50,0x89,0x00,0x00,0x3e,0x30,0x47,0x07,0x10,0xfc,
-0x57,0x0f,0xf0,0x28,0xfc,0xf6,0x00,0x00,0x00,0xed,0x0d,0xe0,0x00,0x00,0x8f,0xe0,
-0xef,0x80,0x00,0x2f,0xff,0x6f,0xff,0x20,0x0b,0xff,0xe2,0xef,0xfa,0x00,0xdf,0xff,
-0xff,0xff,0xd0,0x00,0x00,0x00,0x20,0x44,0x00,0x04,0xf5,0xef,0xb1,0xcf,0xfd,0x01,
-0x8c,0xd1,0xc1,0x01,0xdc,0x81,0xc1,0xef,0xc1,0xbf,0xfd,0x14,0x00,0x00,0x1c,0x00,
-0x01,0x72,0x0e,0xd2,0xe4,0x00,0x04,0xfc,0xf4,0x04,0xf8,0x08,0xf4,0xb8,0x00,0x08,
-0xb0,0x5b,0x03,0xe1,0x0b,0x80,0x00,0x8b,0x4f,0x80,0x8f,0x40,0x4f,0xcf,0x40,0x00,
-0x4e,0x40,0x13,0x00,0xf1,0x12,0x94,0x14,0x44,0x40,0x00,0xbf,0xf8,0xbb,0xbf,0x10,
-0x08,0xb7,0x60,0x00,0xe1,0x00,0x0b,0x40,0x00,0x1e,0x20,0x00,0xb7,0x44,0x5e,0xfd,
-0x50,0x07,0xbb,0xb8,0x5f,0x80,0x00,0x50,0x00,0x43,0xdf,0xfb,0x00,0x00,0x81,0x02,
-0x05,0x01,0x00,0x01,0x06,0x02,0x30,0x09,0x90,0x00,0xbc,0x02,0x01,0xc4,0x02,0x03,
-0xd0,0x02,0x71,0x78,0x4f,0xf4,0x87,0xff,0xe8,0x8e,0xc8,0x02,0x03,0x73,0x20,0x73,
-0x07,0xea,0x00,0x00,0x00,0xef,0xe0,0xde,0x00,0xf3,0x33,0x4f,0x70,0x00,0x00,0x1d,
-0xe0,0x07,0xdc,0x4d,0xf3,0x00,0xef,0xff,0xe3,0x00,0x0a,0xec,0x70,0x00,0x00,0x03,
-0x00,0x00,0x00,0xcd,0xc0,0x2d,0xc0,0xe7,0xf2,0xee,0x20,0x4b,0xff,0xe2,0x00,0x04,
-0xff,0xa0,0x00,0xcd,0xf9,0xf9,0x00,0xe7,0xe0,0x7f,0x90,0x4a,0x40,0x04,0x50,0x00,
-0xff,0xf7,0x47,0x4f,0xff,0x47,0xf8,0xff,0xff,0xff,0x8f,0xff,0xff,0x07,0x00,0xf0,
-0x10,0xfb,0x78,0x88,0x7f,0xff,0xff,0x00,0x24,0x44,0x41,0x0f,0xbb,0xbb,0xe2,0xf0,
-0x00,0x0f,0xdf,0x44,0x44,0xff,0xff,0xfc,0xff,0xff,0xf9,0x09,0xff,0xff,0xd5,0xdf,
-0x20,0x02,0x30,0x01,0x11,0x11,0xf4,0x01,0xf0,0x06,0x01,0x11,0x11,0x05,0x55,0x55,
-0x55,0xcc,0xcc,0xcc,0xc0,0x11,0x11,0x10,0xff,0xff,0xff,0xf0,0x11,0x11,0x10,0xc1,
-0x00,0xf1,0x00,0x9f,0xff,0xff,0xf9,0xb7,0xff,0xff,0x7b,0xfe,0x7c,0xc7,0xef,0xff,
-0xfa,0xaf,0xd5,0x00,0xf1,0x3b,0x07,0xff,0x60,0x00,0xaf,0xf2,0x00,0x0c,0xff,0x87,
-0x00,0xef,0xff,0xb0,0x07,0x8e,0xf2,0x00,0x00,0xf8,0x00,0x00,0x3e,0x00,0x00,0x06,
-0x50,0x00,0x79,0xb9,0x70,0x0f,0xfc,0xff,0x00,0xff,0x68,0x83,0x0f,0xf8,0xff,0x8b,
-0xff,0x8f,0xf8,0x8f,0xf8,0xff,0xff,0x78,0x8f,0xff,0xf0,0x07,0xff,0xff,0x00,0x0d,
-0x00,0x00,0x4e,0xfe,0x30,0x0d,0xff,0xfd,0x00,0xff,0xff,0xf0,0x3f,0xff,0xff,0x3b,
-0xa3,0x00,0x41,0x88,0x60,0x04,0xf4,0xb7,0x01,0xf4,0x03,0xdf,0x18,0x81,0x88,0x1f,
-0xfe,0xaa,0xca,0xae,0xff,0xea,0xac,0xaa,0xef,0xf1,0x80,0x00,0x81,0xd1,0x03,0x01,
-0x01,0x00,0xf0,0x07,0x4b,0xc0,0x00,0x00,0x5c,0xff,0xb0,0x00,0x6e,0xff,0xff,0x40,
-0x0d,0xff,0xff,0xfc,0x00,0x06,0x88,0xcf,0xf5,0x00,0x02,0x02,0x00,0x05,0x00,0x53,
-0x60,0x00,0x00,0x00,0x5d,0x2a,0x00,0x9b,0xff,0xf8,0xb0,0xff,0xf8,0xfb,0xff,0xfc,
-0x88,0x11,0x03,0xf0,0x0d,0x00,0x04,0x77,0x40,0x00,0x09,0xff,0xcc,0xff,0x90,0xcd,
-0x40,0x00,0x04,0xdc,0x20,0x4b,0xff,0xb4,0x02,0x01,0xfa,0x55,0xaf,0x10,0x00,0x00,
-0x21,0x38,0x00,0x10,0xee,0x05,0x00,0x20,0x87,0x00,0x31,0x04,0xc0,0x44,0x40,0xfb,
-0xbb,0xbb,0xbb,0xda,0xf7,0xee,0xee,0xee,0x5f,0x4e,0x01,0xb9,0x2f,0xf5,0x66,0x66,
-0x66,0xab,0x8b,0xbb,0xbb,0xbb,0xb3,0x1e,0x00,0x10,0x70,0x1e,0x00,0x10,0x80,0x1e,
-0x00,0x1e,0x54,0x1e,0x00,0xcd,0xe0,0x00,0x5f,0xf8,0xff,0xf0,0x00,0x2f,0xf5,0x66,
-0x64,0x44,0x1e,0x00,0xcc,0xe7,0x00,0x00,0x5f,0xf8,0xf8,0x00,0x00,0x2f,0xf5,0x65,
-0x44,0x1e,0x00,0x60,0xd8,0xf0,0x00,0x00,0x00,0x5f,0x05,0x00,0x61,0x2f,0xf4,0x44,
-0x44,0x44,0xad,0x1e,0x00,0x04,0x2c,0x02,0x10,0xd8,0x05,0x00,0xf0,0x04,0x36,0x40,
-0x00,0x09,0xb1,0x91,0x11,0x17,0x20,0xef,0x88,0xd8,0x88,0xd9,0x02,0x20,0x06,0x48,
-0x70,0x18,0x03,0x23,0xec,0x00,0x78,0x12,0xf3,0x1d,0xdd,0xc3,0x04,0xff,0x3e,0xd0,
-0x9c,0xb5,0x5f,0x2b,0xf7,0x1a,0xf4,0xbf,0x81,0xbf,0x39,0xc9,0x64,0xf2,0x4f,0xf3,
-0xde,0x00,0x6d,0xed,0x30,0x78,0xdf,0xd8,0x77,0x88,0x88,0x87,0x8f,0xff,0xff,0x88,
-0xcc,0x8c,0xc8,0x8c,0xc8,0xcc,0x07,0x00,0x30,0x85,0xff,0xff,0x4f,0x01,0xf1,0x00,
-0x7d,0x30,0x00,0x00,0x4b,0xfd,0x00,0x00,0x7f,0x9b,0x70,0x00,0x7f,0xff,0x40,0x24,
-0x04,0x00,0x04,0x00,0x74,0x0e,0xff,0x70,0x00,0x00,0xee,0x70,0x8e,0x01,0xd2,0xaf,
-0xff,0xff,0xfc,0x0b,0xff,0x9c,0xc9,0xff,0xaf,0xff,0xc1,0x1c,0x05,0x00,0x01,0x0f,
-0x00,0x01,0x19,0x00,0xf3,0x02,0x07,0xff,0xfe,0x17,0xb6,0x27,0xc3,0xfe,0xb9,0xbe,
-0x3f,0xff,0xff,0xf3,0xff,0xff,0xff,0x07,0x00,0x50,0x3c,0xff,0xff,0xe1,0x00,0xcd,
-0x02,0xc0,0x23,0x00,0x02,0xf0,0x2e,0x92,0x22,0x5f,0x0d,0xff,0xff,0xff,0x09,0x00,
-0x4b,0x21,0x00,0x23,0x00,0x01,0x00,0x2f,0xfe,0x00,0x01,0x00,0x06,0x1b,0xf9,0x08,
-0x00,0x00,0x01,0x00,0x83,0xfd,0xfc,0x00,0xff,0xfc,0x00,0xfb,0x00,0xb8,0x05,0x0e,
-0x01,0x00,0x2f,0x01,0x01,0x1a,0x00,0x04,0x2f,0xf5,0x00,0x01,0x00,0x18,0x1f,0xf2,
-0x21,0x00,0x0d,0x03,0x94,0x00,0xb3,0xfc,0x00,0xff,0x00,0x00,0xf8,0xff,0xfb,0xfc,
-0x00,0xfa,0x94,0x02,0x00,0x21,0x04,0x2f,0xfd,0xfe,0x84,0x00,0x01,0x10,0xfe,0x1d,
-0x00,0x05,0xe7,0x02,0x0e,0x07,0x01,0x0a,0x0a,0x00,0x19,0xff,0x1f,0x00,0x06,0x0e,
-0x00,0x13,0xfa,0x0e,0x00,0x00,0x4e,0x00,0x3f,0xff,0xfd,0xff,0x4e,0x01,0x0d,0x05,
-0x88,0x00,0x00,0x4b,0x08,0x00,0x07,0x00,0x19,0xfe,0x33,0x00,0x11,0xf1,0x19,0x01,
-0x15,0xf0,0x27,0x00,0x20,0xfe,0xff,0x23,0x00,0x01,0x2e,0x00,0x0e,0x4a,0x00,0x02,
-0x5f,0x00,0x1e,0x01,0xb2,0x01,0x0e,0xaa,0x00,0x0f,0x01,0x00,0x0b,0x1b,0xfc,0xaa,
-0x00,0x10,0xfe,0x74,0x00,0x00,0x79,0x00,0x14,0xfc,0x12,0x00,0x14,0xeb,0x75,0x00,
-0x97,0xfc,0x00,0x00,0xef,0xfd,0xf5,0xf7,0x00,0xf1,0x03,0x02,0x28,0xf8,0xfa,0x4d,
-0x00,0x00,0x0c,0x03,0x33,0xf7,0x00,0xf4,0x49,0x00,0x10,0xfe,0xbb,0x00,0x00,0x85,
-0x00,0x03,0x07,0x02,0x1c,0xfa,0x7c,0x00,0x10,0xfd,0xe4,0x00,0x1f,0xfe,0xa3,0x00,
-0x0e,0x1e,0xfb,0xad,0x01,0x08,0x63,0x01,0x93,0xf2,0xf2,0x00,0x00,0xfb,0xfe,0xf1,
-0xff,0x01,0x70,0x02,0xf2,0x02,0xf9,0xfa,0x00,0xf9,0xfa,0xfb,0xf9,0x00,0xfa,0xfc,
-0xfc,0xfb,0xfc,0x00,0xf5,0xf9,0xfa,0x32,0x01,0x66,0xf2,0xfe,0x00,0x00,0xfb,0xff,
-0x43,0x01,0x62,0xfd,0xfd,0x00,0x00,0xfd,0xfe,0x67,0x01,0x25,0x00,0x01,0x59,0x01,
-0x22,0xf8,0xfc,0x6c,0x00,0x13,0x01,0x11,0x00,0x23,0xfe,0xfe,0x8a,0x01,0x1a,0x00,
-0xe8,0x02,0x14,0xfd,0x7f,0x00,0x15,0x01,0x8b,0x00,0x02,0xd4,0x01,0x07,0x9e,0x00,
-0xe0,0x01,0xfd,0xf3,0xfd,0x00,0x00,0xfa,0xfe,0xfa,0xff,0x01,0xfa,0x01,0x01,0x9e,
-0x00,0x70,0xfb,0xfc,0xff,0xfe,0xfc,0xfe,0xfc,0xfa,0x01,0x66,0xff,0xfe,0x01,0xfa,
-0xfc,0xfc,0xd7,0x00,0x09,0xcc,0x01,0x14,0xff,0x4e,0x00,0x0e,0x1e,0x01,0x04,0x1c,
-0x00,0x0f,0xcf,0x01,0x07,0x0f,0x10,0x02,0x10,0x1f,0xfe,0x27,0x00,0x0b,0x2e,0xff,
-0xff,0x41,0x02,0x0f,0x68,0x02,0x25,0x07,0x73,0x01,0x0e,0x8a,0x03,0x19,0x01,0x3c,
-0x00,0x15,0x01,0x56,0x03,0x0f,0x01,0x00,0x25,0x0e,0x8a,0x00,0x1f,0xf8,0xea,0x00,
-0x13,0x1d,0x01,0x2b,0x00,0x00,0xf7,0x01,0x01,0x9f,0x00,0x10,0x03,0x58,0x02,0x0f,
-0x78,0x00,0x1b,0x1b,0x01,0x2a,0x05,0x02,0xf5,0x03,0x0a,0xed,0x00,0x0e,0xa0,0x00,
-0x0f,0xea,0x00,0x1d,0x1f,0xff,0x27,0x00,0x2c,0x0f,0x43,0x00,0x0a,0x12,0x01,0x95,
-0x29,0x21,0x02,0x03,0x8d,0x19,0x2c,0x04,0x05,0x21,0x00,0x00,0x3c,0x1e,0xf1,0x0a,
-0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,
-0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x00,0xbb,0x1d,0x70,0x1b,0x1c,0x00,0x1d,
-0x1e,0x00,0x1f,0xac,0x09,0xff,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,
-0x24,0x25,0x26,0x24,0x27,0x28,0x73,0x00,0x04,0x11,0x06,0x01,0x00,0x00,0xfd,0x1e,
-0x90,0x0a,0x0a,0x0c,0x0c,0x0c,0x0c,0x09,0x0c,0x09,0x01,0x00,0xa1,0x00,0x00,0x0d,
-0x0d,0x0d,0x0d,0x17,0x00,0x00,0x1a,0x01,0x00,0x61,0x00,0x1c,0x1d,0x1d,0x1d,0x1d,
-0x31,0x00,0x20,0x1f,0x21,0x01,0x00,0x02,0x3d,0x00,0x50,0x24,0x1b,0x24,0x06,0x1a,
-0x02,0x00,0x22,0x08,0x1c,0x02,0x00,0x64,0x09,0x00,0x09,0x00,0x0a,0x1d,0x02,0x00,
-0x04,0x64,0x00,0x20,0x0c,0x1f,0x17,0x12,0x03,0x02,0x00,0x00,0x05,0x0c,0x53,0x00,
-0x0e,0x00,0x00,0x0f,0x02,0x00,0x00,0x1f,0x00,0x00,0x02,0x00,0x80,0x1f,0x00,0x00,
-0x09,0x21,0x09,0x21,0x09,0x5b,0x00,0x11,0x22,0x02,0x00,0x03,0x01,0x00,0x11,0x13,
-0x02,0x00,0x17,0x0d,0x02,0x00,0x70,0x15,0x00,0x17,0x24,0x17,0x18,0x27,0x02,0x00,
-0x0f,0xb7,0x02,0x28,0x07,0x72,0x01,0x20,0x03,0x02,0x6d,0x01,0x4a,0x06,0x07,0x06,
-0x08,0x1f,0x00,0x00,0xce,0x00,0x20,0x00,0x0b,0x31,0x0b,0x01,0xd8,0x12,0x00,0x08,
-0x00,0xa0,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x25,0x2b,0x82,0x00,
-0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x13,0x19,0xfe,0x00,0x19,0x19,0x1a,0x19,0x17,
-0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0xec,0x07,0x01,0x01,0x00,0x11,
-0x0a,0x01,0x00,0x26,0x24,0x0b,0x12,0x00,0x10,0x0b,0x01,0x00,0xa1,0x00,0x0b,0x0f,
-0x0f,0x0f,0x0f,0x13,0x00,0x00,0x16,0x01,0x00,0x20,0x25,0x17,0x01,0x00,0x02,0x57,
-0x00,0x02,0x83,0x01,0xa0,0x26,0x1e,0x1e,0x1e,0x1e,0x1f,0x00,0x1f,0x0a,0x16,0x02,
-0x00,0x22,0x0b,0x17,0x02,0x00,0x10,0x00,0x24,0x00,0x14,0x17,0x02,0x00,0x05,0x16,
-0x00,0x0b,0x01,0x00,0x1b,0x0c,0x10,0x00,0x10,0x19,0x02,0x00,0x51,0x19,0x00,0x00,
-0x0b,0x1a,0x02,0x00,0x03,0x30,0x00,0x22,0x0d,0x1c,0x02,0x00,0x10,0x0e,0xa0,0x01,
-0x36,0x00,0x0f,0x1e,0x02,0x00,0x70,0x11,0x00,0x13,0x1f,0x13,0x14,0x22,0x02,0x00,
-0x1f,0x00,0x74,0x01,0x26,0x50,0x00,0x00,0x00,0x00,0x00,
+0x70,0x00,0xf1,0x28,0xfe,0x5f,0xfd,0x22,0xf9,0x10,0x1b,0x00,0x00,0x20,0x00,0x00,
+0x00,0x8f,0x80,0x00,0x00,0x7f,0xff,0x70,0x00,0x5f,0xff,0xff,0x50,0x0e,0xff,0xff,
+0xfe,0x00,0x58,0x88,0x88,0x50,0x0f,0xff,0xff,0xff,0x00,0xab,0xbb,0xbb,0xa0,0x00,
+0x06,0x20,0x07,0xf4,0x07,0xf5,0x05,0xf5,0x00,0x2e,0xb0,0x03,0x00,0xf0,0x1c,0x60,
+0x00,0x10,0x26,0x00,0x04,0xf6,0x00,0x05,0xf6,0x00,0x06,0xf5,0x00,0xbe,0x20,0xbe,
+0x10,0x6e,0x10,0x00,0x10,0x00,0x00,0x04,0x00,0x00,0x03,0xf3,0x00,0x00,0x4f,0x40,
+0x07,0x8a,0xfa,0x87,0xef,0xff,0xff,0xe0,0x04,0xf4,0x0e,0x00,0x80,0x00,0x01,0xb1,
+0x00,0x78,0x88,0x88,0x7e,0x59,0x00,0xf1,0x0c,0x8c,0xcc,0x80,0x01,0xdd,0x16,0x3d,
+0xd1,0xcf,0x55,0xed,0x5f,0xcb,0xf5,0xdf,0xd5,0xfc,0x1d,0xd3,0x73,0xdd,0x10,0x08,
+0xdc,0xc8,0x10,0x1d,0x89,0x01,0xf1,0x11,0x5e,0x8c,0xcc,0xa2,0x00,0x00,0x2d,0xb4,
+0x49,0xf4,0x00,0x7a,0x1a,0xff,0x3f,0xe1,0x07,0xfa,0x06,0xf7,0xff,0x10,0x0a,0xf3,
+0x03,0xef,0x40,0x00,0x06,0xcc,0x71,0xbb,0x02,0x01,0x40,0x89,0x00,0x00,0x3e,0x2e,
+0x00,0xf0,0x2e,0x0c,0xfc,0x00,0x00,0x00,0x06,0xfc,0xf6,0x00,0x00,0x00,0xed,0x0d,
+0xe0,0x00,0x00,0x8f,0xe0,0xef,0x80,0x00,0x2f,0xff,0x6f,0xff,0x20,0x0b,0xff,0xe2,
+0xef,0xfa,0x00,0xdf,0xff,0xff,0xff,0xd0,0x00,0x00,0x00,0x20,0x44,0x00,0x04,0xf5,
+0xef,0xb1,0xcf,0xfd,0x01,0x8c,0xd1,0xc1,0x01,0xdc,0x81,0xc1,0xef,0xc1,0xbf,0xfd,
+0x14,0x00,0x12,0x00,0xff,0x00,0xf2,0x00,0x00,0x04,0xe4,0x00,0x04,0xfc,0xf4,0x04,
+0xf8,0x08,0xf4,0xb8,0x00,0x08,0xb0,0x5b,0x03,0xe1,0x0b,0x80,0x00,0x8b,0x4f,0x80,
+0x8f,0x40,0x4f,0xcf,0x40,0x00,0x4e,0x40,0x13,0x00,0xf1,0x12,0x94,0x14,0x44,0x40,
+0x00,0xbf,0xf8,0xbb,0xbf,0x10,0x08,0xb7,0x60,0x00,0xe1,0x00,0x0b,0x40,0x00,0x1e,
+0x20,0x00,0xb7,0x44,0x5e,0xfd,0x50,0x07,0xbb,0xb8,0x5f,0x80,0x00,0x50,0x00,0x43,
+0xdf,0xfb,0x00,0x00,0x81,0x02,0x05,0x01,0x00,0x01,0x06,0x02,0x30,0x09,0x90,0x00,
+0xbc,0x02,0x01,0xc4,0x02,0x03,0xd0,0x02,0x71,0x78,0x4f,0xf4,0x87,0xff,0xe8,0x8e,
+0xc8,0x02,0x12,0x00,0x01,0x00,0x73,0x07,0xea,0x00,0x00,0x00,0xef,0xe0,0xde,0x00,
+0xf3,0x33,0x4f,0x70,0x00,0x00,0x1d,0xe0,0x07,0xdc,0x4d,0xf3,0x00,0xef,0xff,0xe3,
+0x00,0x0a,0xec,0x70,0x00,0x00,0x03,0x00,0x00,0x00,0xcd,0xc0,0x2d,0xc0,0xe7,0xf2,
+0xee,0x20,0x4b,0xff,0xe2,0x00,0x04,0xff,0xa0,0x00,0xcd,0xf9,0xf9,0x00,0xe7,0xe0,
+0x7f,0x90,0x4a,0x40,0x04,0x50,0x00,0xff,0xf7,0x47,0x4f,0xff,0x47,0xf8,0xff,0xff,
+0xff,0x8f,0xff,0xff,0x07,0x00,0xf0,0x10,0xfb,0x78,0x88,0x7f,0xff,0xff,0x00,0x24,
+0x44,0x41,0x0f,0xbb,0xbb,0xe2,0xf0,0x00,0x0f,0xdf,0x44,0x44,0xff,0xff,0xfc,0xff,
+0xff,0xf9,0x09,0xff,0xff,0xd5,0xdf,0x20,0x02,0x30,0x01,0x11,0x11,0xf4,0x01,0xf0,
+0x06,0x01,0x11,0x11,0x05,0x55,0x55,0x55,0xcc,0xcc,0xcc,0xc0,0x11,0x11,0x10,0xff,
+0xff,0xff,0xf0,0x11,0x11,0x10,0xc1,0x00,0xf1,0x00,0x9f,0xff,0xff,0xf9,0xb7,0xff,
+0xff,0x7b,0xfe,0x7c,0xc7,0xef,0xff,0xfa,0xaf,0xd5,0x00,0xf1,0x3b,0x07,0xff,0x60,
+0x00,0xaf,0xf2,0x00,0x0c,0xff,0x87,0x00,0xef,0xff,0xb0,0x07,0x8e,0xf2,0x00,0x00,
+0xf8,0x00,0x00,0x3e,0x00,0x00,0x06,0x50,0x00,0x79,0xb9,0x70,0x0f,0xfc,0xff,0x00,
+0xff,0x68,0x83,0x0f,0xf8,0xff,0x8b,0xff,0x8f,0xf8,0x8f,0xf8,0xff,0xff,0x78,0x8f,
+0xff,0xf0,0x07,0xff,0xff,0x00,0x0d,0x00,0x00,0x4e,0xfe,0x30,0x0d,0xff,0xfd,0x00,
+0xff,0xff,0xf0,0x3f,0xff,0xff,0x3b,0xa3,0x00,0x41,0x88,0x60,0x04,0xf4,0xb7,0x01,
+0xf4,0x03,0xdf,0x18,0x81,0x88,0x1f,0xfe,0xaa,0xca,0xae,0xff,0xea,0xac,0xaa,0xef,
+0xf1,0x80,0x00,0x81,0xd1,0x03,0x01,0x01,0x00,0xf0,0x07,0x4b,0xc0,0x00,0x00,0x5c,
+0xff,0xb0,0x00,0x6e,0xff,0xff,0x40,0x0d,0xff,0xff,0xfc,0x00,0x06,0x88,0xcf,0xf5,
+0x00,0x02,0x02,0x00,0x05,0x00,0x53,0x60,0x00,0x00,0x00,0x5d,0x2a,0x00,0x9b,0xff,
+0xf8,0xb0,0xff,0xf8,0xfb,0xff,0xfc,0x88,0x11,0x03,0xf0,0x0d,0x00,0x04,0x77,0x40,
+0x00,0x09,0xff,0xcc,0xff,0x90,0xcd,0x40,0x00,0x04,0xdc,0x20,0x4b,0xff,0xb4,0x02,
+0x01,0xfa,0x55,0xaf,0x10,0x00,0x00,0x21,0x38,0x00,0x10,0xee,0x05,0x00,0x20,0x87,
+0x00,0x31,0x04,0xc0,0x44,0x40,0xfb,0xbb,0xbb,0xbb,0xda,0xf7,0xee,0xee,0xee,0x5f,
+0x4e,0x01,0xb9,0x2f,0xf5,0x66,0x66,0x66,0xab,0x8b,0xbb,0xbb,0xbb,0xb3,0x1e,0x00,
+0x10,0x70,0x1e,0x00,0x10,0x80,0x1e,0x00,0x1e,0x54,0x1e,0x00,0xcd,0xe0,0x00,0x5f,
+0xf8,0xff,0xf0,0x00,0x2f,0xf5,0x66,0x64,0x44,0x1e,0x00,0xcc,0xe7,0x00,0x00,0x5f,
+0xf8,0xf8,0x00,0x00,0x2f,0xf5,0x65,0x44,0x1e,0x00,0x60,0xd8,0xf0,0x00,0x00,0x00,
+0x5f,0x05,0x00,0x61,0x2f,0xf4,0x44,0x44,0x44,0xad,0x1e,0x00,0x04,0x2c,0x02,0x10,
+0xd8,0x05,0x00,0xf0,0x04,0x36,0x40,0x00,0x09,0xb1,0x91,0x11,0x17,0x20,0xef,0x88,
+0xd8,0x88,0xd9,0x02,0x20,0x06,0x48,0x70,0x18,0x03,0x13,0xec,0x25,0x00,0xf3,0x1e,
+0x06,0xdd,0xc3,0x04,0xff,0x3e,0xd0,0x9c,0xb5,0x5f,0x2b,0xf7,0x1a,0xf4,0xbf,0x81,
+0xbf,0x39,0xc9,0x64,0xf2,0x4f,0xf3,0xde,0x00,0x6d,0xed,0x30,0x78,0xdf,0xd8,0x77,
+0x88,0x88,0x87,0x8f,0xff,0xff,0x88,0xcc,0x8c,0xc8,0x8c,0xc8,0xcc,0x07,0x00,0x30,
+0x85,0xff,0xff,0x4f,0x01,0xf1,0x00,0x7d,0x30,0x00,0x00,0x4b,0xfd,0x00,0x00,0x7f,
+0x9b,0x70,0x00,0x7f,0xff,0x40,0x24,0x04,0x00,0x04,0x00,0x74,0x0e,0xff,0x70,0x00,
+0x00,0xee,0x70,0x8e,0x01,0xd2,0xaf,0xff,0xff,0xfc,0x0b,0xff,0x9c,0xc9,0xff,0xaf,
+0xff,0xc1,0x1c,0x05,0x00,0x01,0x0f,0x00,0x01,0x19,0x00,0xf3,0x02,0x07,0xff,0xfe,
+0x17,0xb6,0x27,0xc3,0xfe,0xb9,0xbe,0x3f,0xff,0xff,0xf3,0xff,0xff,0xff,0x07,0x00,
+0x50,0x3c,0xff,0xff,0xe1,0x00,0xcd,0x02,0x90,0x23,0x00,0x02,0xf0,0x2e,0x92,0x22,
+0x5f,0x0d,0x6b,0x02,0x90,0x2e,0x92,0x22,0x21,0x00,0x23,0x00,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -481,11 +486,16 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 8226, .range_length = 55425, .glyph_id_start = 308, .list_length = 62, .type = 3, .unicode_list = 2960, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[11721] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 3086, .size = 4095, .comp_size = 2819 },
+{ .bitmap_start = 4095, .comp_offset = 5905, .size = 1914, .comp_size = 1661 },
+};
+
+static uint8_t etxUncompBuf[5712] __SDRAMFONTS;
 
 const etxLz4Font lv_font_en_XXS = {
-.uncomp_size = 11393,
-.comp_size = 7483,
+.uncomp_size = 5384,
+.comp_size = 3086,
 .line_height = 10,
 .base_line = 2,
 .subpx = 0,
@@ -498,12 +508,13 @@ const etxLz4Font lv_font_en_XXS = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 39,
-.glyph_bitmap = 3084,
-.class_pair_values = 9093,
-.left_class_mapping = 10653,
-.right_class_mapping = 11023,
+.class_pair_values = 3084,
+.left_class_mapping = 4644,
+.right_class_mapping = 5014,
+.block_num = 2,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 11721,
+.lvglFontBufSize = 5712,
 };
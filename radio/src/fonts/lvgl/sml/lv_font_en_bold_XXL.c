@@ -45,867 +45,1019 @@ static const uint8_t lz4FontData[] ={
 0xe0,0x10,0x10,0x22,0x00,0x00,0xda,0x82,0x38,0x00,0xf1,0x14,0x1e,0x84,0x40,0x19,
 0x19,0x1b,0x00,0x00,0x70,0x85,0xc0,0x24,0x24,0x1b,0x00,0x00,0x56,0x87,0x70,0x19,
 0x1a,0x1b,0x00,0x00,0xb5,0x88,0x20,0x19,0x1a,0x26,0x00,0xf5,0xa3,0x8a,0x70,0x38,
-0x00,0xf0,0x21,0xda,0x8b,0x80,0x10,0x0f,0x31,0x01,0xf7,0x4a,0x8d,0xa0,0x0c,0x05,
+0x00,0xf8,0x1a,0xda,0x8b,0x80,0x10,0x0f,0x31,0x01,0xf7,0x4a,0x8d,0xa0,0x0c,0x05,
 0x2b,0x04,0xf9,0xb6,0x8d,0x80,0x10,0x10,0x31,0x00,0xf7,0x3e,0x8f,0x70,0x20,0x1c,
-0x0b,0x02,0x09,0xd8,0x8f,0x70,0x13,0x0e,0x0e,0x03,0x17,0xcf,0xff,0xff,0xfb,0xbf,
-0xff,0xff,0xfa,0x04,0x00,0x40,0xaf,0xff,0xff,0xf9,0x04,0x00,0x92,0x9f,0xff,0xff,
-0xf8,0x9f,0xff,0xff,0xf7,0x8f,0x04,0x00,0x22,0xf6,0x7f,0x04,0x00,0x22,0xf5,0x6f,
-0x04,0x00,0x22,0xf4,0x5f,0x04,0x00,0x90,0xf3,0x4f,0xff,0xff,0xf3,0x3f,0xff,0xff,
-0xf2,0x04,0x00,0x40,0x2f,0xff,0xff,0xf1,0x04,0x00,0x40,0x1f,0xff,0xff,0xf0,0x04,
-0x00,0x12,0x0f,0x04,0x00,0x68,0xe0,0x0b,0xbb,0xbb,0xa0,0x00,0x01,0x00,0x70,0x36,
-0x63,0x00,0x0b,0xff,0xff,0xa0,0x5c,0x00,0x80,0xef,0xff,0xff,0xfc,0xff,0xff,0xff,
-0xfe,0x84,0x00,0x00,0x4c,0x00,0xbc,0x04,0xcf,0xfb,0x30,0x7f,0xff,0xf8,0x00,0x7f,
-0xff,0xf6,0x07,0x00,0x12,0xf7,0x07,0x00,0xf2,0x0e,0xf6,0x00,0x7f,0xff,0xf5,0x7f,
-0xff,0xf4,0x00,0x7f,0xff,0xf3,0x7f,0xff,0xf3,0x00,0x7f,0xff,0xf2,0x7f,0xff,0xf1,
-0x00,0x7f,0xff,0xf0,0x7f,0xff,0xf0,0x07,0x00,0xf0,0x0f,0xe0,0x00,0x7f,0xff,0xd0,
-0x7f,0xff,0xc0,0x00,0x7f,0xff,0xc0,0x7f,0xff,0xb0,0x00,0x7f,0xff,0xa0,0x7f,0xff,
-0x90,0x00,0x7f,0xff,0x90,0x37,0x77,0x30,0x00,0x04,0x00,0x00,0x01,0x00,0x00,0x2f,
-0x00,0x42,0x04,0xff,0xff,0x20,0x94,0x00,0x73,0xaf,0xff,0xc0,0x00,0x07,0xff,0xff,
-0xa2,0x00,0x73,0xdf,0xff,0xa0,0x00,0x0a,0xff,0xfd,0x0e,0x00,0x72,0xff,0xff,0x70,
-0x00,0x0c,0xff,0xfa,0x0d,0x00,0x82,0x02,0xff,0xff,0x40,0x00,0x0f,0xff,0xf8,0x0e,
-0x00,0x10,0x05,0x41,0x00,0x32,0x2f,0xff,0xf5,0x0e,0x00,0x01,0x41,0x00,0x32,0x4f,
-0xff,0xf2,0x0e,0x00,0x32,0x0a,0xff,0xfc,0x66,0x00,0x01,0x01,0x00,0x30,0x0d,0xff,
-0xfa,0x66,0x00,0x12,0xd0,0x0e,0x00,0x70,0x0f,0xff,0xf7,0x00,0x00,0xcf,0xff,0x18,
-0x01,0xf6,0x01,0x24,0x44,0x44,0x5f,0xff,0xf8,0x44,0x44,0xff,0xff,0xa4,0x44,0x43,
-0x00,0x9f,0xff,0x01,0x00,0x1f,0xfd,0x0e,0x00,0x18,0x01,0xa7,0x00,0x52,0x60,0x00,
-0x0d,0xff,0xf9,0x61,0x00,0x82,0x03,0xff,0xff,0x30,0x00,0x0f,0xff,0xf6,0x0e,0x00,
-0x82,0x06,0xff,0xff,0x10,0x00,0x3f,0xff,0xf4,0x0e,0x00,0x82,0x09,0xff,0xfe,0x00,
-0x00,0x6f,0xff,0xf1,0x0e,0x00,0x82,0x0c,0xff,0xfb,0x00,0x00,0x9f,0xff,0xe0,0x0e,
-0x00,0x30,0x0e,0xff,0xf8,0x99,0x00,0xf7,0x05,0xb0,0x00,0x00,0x00,0x13,0x33,0x33,
-0x4f,0xff,0xf8,0x33,0x33,0xef,0xff,0xa3,0x33,0x33,0x00,0x7f,0xff,0x01,0x00,0x0f,
-0x0e,0x00,0x18,0x0f,0x40,0x01,0x04,0x19,0xf7,0x40,0x01,0x03,0x99,0x00,0x10,0x08,
-0x30,0x00,0x14,0x5f,0x40,0x01,0x10,0x0b,0x40,0x01,0x16,0x8f,0x40,0x01,0x12,0xf9,
-0xa6,0x01,0x03,0x40,0x01,0x10,0xf6,0xa6,0x01,0x12,0x90,0x0e,0x00,0x01,0xda,0x00,
-0x00,0xff,0x00,0x01,0x01,0x00,0x00,0xda,0x00,0x10,0x03,0x66,0x00,0x01,0x01,0x00,
-0x00,0xda,0x00,0x01,0xff,0x00,0x04,0x01,0x00,0x36,0x0a,0xdd,0xd1,0x8b,0x02,0x14,
-0xcf,0x00,0x02,0x01,0x09,0x01,0x1f,0xf2,0x19,0x00,0x0f,0x43,0x47,0xef,0xff,0x83,
-0x0b,0x00,0x20,0x2a,0xff,0xba,0x02,0x11,0x81,0x0c,0x00,0x12,0x8f,0xee,0x00,0x10,
-0xe4,0x0c,0x00,0x13,0xbf,0xfb,0x00,0x00,0x15,0x02,0x05,0xa5,0x01,0x10,0xf2,0xa6,
-0x00,0x04,0x01,0x00,0x10,0xc0,0x00,0x03,0x60,0xff,0xf9,0x20,0x15,0xdf,0xff,0xa8,
-0x00,0x20,0xff,0xff,0x0f,0x01,0x50,0x01,0xdf,0xff,0xff,0xfa,0x25,0x00,0x12,0xfe,
-0x18,0x01,0x20,0xff,0xe0,0x05,0x00,0x11,0xb0,0xed,0x00,0x52,0xff,0xff,0x20,0x6f,
-0xff,0x42,0x01,0x10,0xdf,0x26,0x03,0x00,0x44,0x00,0x00,0x22,0x01,0x40,0xee,0xee,
-0xee,0x40,0x57,0x00,0x05,0xac,0x00,0x44,0xef,0xff,0xff,0xfd,0xeb,0x00,0x10,0x09,
-0x9f,0x00,0x13,0x60,0x0d,0x00,0x10,0x2f,0x78,0x00,0x24,0xd6,0x00,0x22,0x01,0x00,
-0x01,0x00,0x27,0x81,0x00,0xbb,0x00,0x27,0xf9,0x10,0x1a,0x00,0x21,0xff,0x70,0x0d,
-0x00,0x12,0x1a,0x0d,0x00,0x12,0xb0,0x51,0x02,0x13,0xaf,0xbb,0x00,0x01,0x01,0x00,
-0x20,0x18,0xef,0x0d,0x00,0x04,0xd7,0x03,0x30,0x5d,0xff,0xff,0x6f,0x02,0x05,0xc5,
-0x01,0x00,0x52,0x02,0x06,0x0d,0x00,0x63,0xf0,0x68,0x88,0x88,0x82,0x00,0xc8,0x00,
-0x52,0x3a,0xff,0xff,0xff,0x50,0x61,0x01,0x42,0xff,0xf4,0x9f,0xff,0x48,0x03,0x00,
-0x0e,0x01,0x32,0x56,0xff,0xff,0x1d,0x03,0x12,0xef,0x53,0x04,0x01,0x26,0x00,0x62,
-0x4f,0xff,0xff,0xff,0x10,0xdf,0x0d,0x00,0x10,0x3e,0x21,0x00,0x10,0x06,0x6a,0x00,
-0x31,0xc8,0x78,0xbf,0x33,0x01,0x14,0x0c,0x51,0x01,0x00,0x33,0x01,0x14,0x2e,0x0d,
-0x00,0x00,0x89,0x00,0x14,0x2d,0x18,0x00,0x12,0x40,0x84,0x00,0x00,0x01,0x00,0x11,
-0xfa,0x25,0x01,0x20,0x01,0x6b,0x73,0x04,0x14,0x82,0xa0,0x00,0x26,0x5f,0xff,0x9b,
-0x04,0x36,0x04,0xff,0xfa,0x00,0x02,0x1f,0x4f,0x19,0x00,0x0f,0x47,0x5a,0xdf,0xfe,
-0xa5,0xd6,0x04,0x20,0x02,0xcf,0x89,0x03,0x06,0x36,0x02,0x21,0x01,0xef,0x82,0x00,
-0x06,0x11,0x00,0x02,0x18,0x02,0x14,0xfc,0x10,0x00,0x00,0xeb,0x01,0x31,0x82,0x27,
-0xff,0xfc,0x02,0x22,0x2f,0xa2,0xa8,0x00,0x10,0x70,0xab,0x02,0x10,0x80,0x11,0x01,
-0x10,0xf7,0x94,0x04,0x00,0xa3,0x03,0x31,0x1f,0xff,0xfa,0xc0,0x03,0x10,0x30,0x51,
-0x04,0x11,0xff,0x4e,0x03,0x10,0xb0,0x5c,0x00,0x11,0x80,0x21,0x00,0x10,0xf0,0x56,
-0x01,0x10,0xfb,0x0a,0x00,0x10,0xe0,0x72,0x04,0x00,0xe8,0x02,0x10,0x01,0x21,0x00,
-0x32,0x4f,0xff,0xf4,0xdc,0x01,0x10,0xf7,0xd4,0x01,0x53,0xf9,0x00,0x0e,0xff,0xfa,
-0x16,0x04,0xa4,0xf7,0x22,0x7f,0xff,0xff,0x40,0x09,0xff,0xfe,0x10,0x7a,0x01,0x00,
-0x58,0x01,0x13,0x03,0x96,0x01,0x23,0x00,0x2e,0xae,0x02,0x13,0xdf,0xf7,0x01,0x20,
-0x00,0x2c,0x10,0x00,0x35,0xd2,0x00,0x7f,0x04,0x03,0x74,0x05,0xad,0xff,0xea,0x50,
-0x00,0x2f,0xc2,0x03,0x05,0x24,0x03,0x19,0xfc,0x10,0x00,0x16,0x06,0x11,0x02,0x02,
-0x0e,0x01,0x01,0xd8,0x00,0x07,0x01,0x00,0x00,0x0b,0x05,0x46,0x4a,0xdf,0xfd,0xa5,
-0x8a,0x01,0x30,0xf4,0x01,0xbf,0x20,0x01,0x03,0xbf,0x02,0x00,0xb2,0x00,0x11,0xdf,
-0x42,0x01,0x14,0x10,0xb5,0x04,0x12,0x10,0x83,0x02,0x14,0xfb,0xe1,0x04,0x93,0x50,
-0x2f,0xff,0xff,0x83,0x28,0xff,0xff,0xf3,0xb4,0x05,0x50,0xb0,0x06,0xff,0xff,0x90,
-0x47,0x01,0x12,0x80,0xfc,0x00,0x53,0xf2,0x00,0x9f,0xff,0xf2,0x42,0x01,0x11,0x00,
-0xb2,0x00,0x06,0x42,0x01,0x03,0xb2,0x00,0x12,0xbf,0x42,0x01,0x14,0xfc,0xb2,0x00,
-0x04,0x21,0x00,0x14,0xc0,0xb2,0x00,0x07,0x42,0x00,0x10,0xbf,0xa0,0x02,0x01,0x63,
-0x00,0x02,0xa5,0x01,0x32,0x03,0xbf,0xf4,0x59,0x03,0x23,0x92,0x26,0x84,0x00,0x12,
-0x48,0xd9,0x00,0x06,0xa5,0x00,0x01,0xfa,0x00,0x08,0xc6,0x00,0x01,0x11,0x00,0x01,
-0xe7,0x00,0x17,0x20,0x0c,0x01,0x15,0x4a,0x4a,0x02,0x66,0x05,0x9d,0xef,0xec,0x93,
-0x00,0x7a,0x02,0x01,0x3c,0x00,0x15,0xb1,0x10,0x00,0x29,0x7f,0xff,0x54,0x02,0x13,
-0x05,0xe7,0x02,0x13,0xe1,0x10,0x00,0x23,0x1f,0xff,0xeb,0x02,0x16,0x00,0xdb,0x03,
-0x35,0xdb,0xef,0xff,0xfe,0x04,0x10,0xdf,0x95,0x04,0x14,0x07,0x82,0x03,0x00,0xe8,
-0x00,0x00,0xc8,0x00,0x14,0xaf,0xf0,0x03,0x12,0x02,0x3d,0x03,0x14,0x6f,0xab,0x01,
-0x12,0x03,0x5a,0x04,0x14,0x6f,0x20,0x00,0x12,0x01,0x3a,0x00,0x15,0xcf,0xdb,0x01,
-0x10,0xef,0x29,0x01,0x13,0x08,0x7f,0x06,0x02,0x70,0x00,0x32,0xf5,0x01,0xaf,0xd3,
-0x02,0x03,0x75,0x04,0x30,0xfe,0x6e,0xff,0x32,0x01,0x06,0x92,0x04,0x07,0x9f,0x00,
-0x03,0x23,0x03,0x26,0xff,0x70,0x5d,0x03,0x00,0x0f,0x00,0x36,0xe3,0x00,0x00,0x15,
-0x02,0x07,0xd0,0x04,0x03,0x40,0x00,0x00,0xd9,0x05,0x81,0x06,0x77,0x77,0x70,0x00,
-0x00,0x01,0xcf,0x10,0x00,0x10,0xf3,0x5a,0x04,0x00,0xc8,0x01,0x24,0x1d,0xff,0x1f,
-0x01,0x01,0x10,0x00,0x00,0x71,0x03,0x10,0xfd,0x42,0x00,0x10,0xd1,0x6b,0x03,0x11,
-0xe0,0x2e,0x01,0x21,0xe1,0x04,0x83,0x03,0x10,0x8f,0x03,0x02,0x11,0x0c,0xcf,0x00,
-0x10,0x6f,0xe2,0x04,0x10,0xdf,0xf3,0x00,0x11,0x1f,0xaf,0x06,0x10,0x07,0x21,0x00,
-0x01,0x66,0x00,0x12,0x3f,0xd9,0x00,0x14,0x9f,0x62,0x04,0x03,0x9b,0x05,0x02,0x33,
-0x03,0x12,0xf8,0x53,0x05,0x12,0x20,0xca,0x04,0x10,0xff,0xaa,0x03,0x13,0x0f,0x2c,
-0x05,0x13,0x1d,0xd4,0x00,0x10,0x0a,0x07,0x02,0x52,0x10,0x00,0x02,0x8f,0xff,0x82,
-0x01,0x11,0x04,0xff,0x03,0x25,0xbb,0xdf,0x48,0x05,0x17,0xaf,0x28,0x07,0x11,0xf9,
-0x92,0x02,0x07,0x01,0x00,0x13,0x60,0x29,0x02,0x01,0x7d,0x00,0x12,0xff,0x61,0x02,
-0x22,0x06,0xdf,0x40,0x01,0x23,0x21,0xef,0x51,0x02,0x61,0x04,0x8c,0xef,0xff,0xeb,
-0x85,0x5b,0x06,0x00,0xeb,0x08,0x17,0xfb,0x03,0x00,0x71,0xfa,0x7f,0xff,0xf9,0x7f,
-0xff,0xf8,0x34,0x09,0x00,0x30,0x09,0x01,0x2f,0x09,0x00,0x2b,0x09,0x23,0x38,0x88,
-0xde,0x01,0x12,0x20,0x88,0x03,0x01,0x9d,0x01,0x11,0x2d,0x40,0x04,0x21,0x02,0xef,
-0xb5,0x06,0x12,0x1e,0xc2,0x01,0x02,0xe8,0x01,0x12,0x08,0x0d,0x00,0x12,0x3f,0x15,
-0x02,0x11,0xcf,0x13,0x01,0x12,0x05,0x14,0x00,0x12,0x0d,0xb2,0x05,0x11,0x4f,0x7a,
-0x07,0x00,0x6e,0x01,0x02,0x24,0x02,0x12,0xfb,0x22,0x00,0x12,0xf6,0x91,0x04,0x11,
-0xf1,0xcc,0x03,0x01,0x5f,0x00,0x12,0x2f,0x20,0x01,0x12,0x5f,0x4b,0x00,0x12,0x8f,
-0x37,0x00,0x12,0xaf,0xaa,0x07,0x12,0xcf,0x4c,0x01,0x12,0xdf,0xac,0x02,0x12,0xef,
-0x07,0x00,0x05,0x40,0x08,0x08,0x07,0x00,0x15,0xef,0x07,0x00,0x12,0x10,0x31,0x00,
-0x12,0x20,0x7d,0x00,0x12,0x30,0xac,0x01,0x12,0x50,0x27,0x03,0x12,0x70,0x99,0x00,
-0x12,0x90,0x77,0x06,0x12,0xc0,0x5e,0x01,0x12,0xf0,0x66,0x05,0x12,0xf3,0xdc,0x02,
-0x12,0xf8,0x47,0x00,0x13,0xfc,0xba,0x02,0x12,0x20,0x41,0x03,0x12,0x90,0xb7,0x00,
-0x12,0xf0,0x10,0x03,0x17,0xf8,0x1d,0x00,0x12,0x0d,0x48,0x00,0x22,0x04,0xff,0x64,
-0x09,0x12,0x7f,0x2c,0x00,0x12,0x09,0xea,0x00,0x02,0x29,0x04,0x00,0x3f,0x02,0x02,
-0x22,0x07,0x15,0x3c,0xd5,0x02,0x13,0x50,0x9c,0x03,0x13,0xe5,0x18,0x05,0x13,0xf9,
-0x60,0x08,0x22,0xfa,0x00,0x6a,0x00,0x13,0xf9,0xda,0x02,0x13,0xf7,0x90,0x05,0x22,
-0xf3,0x00,0x83,0x01,0x13,0xd0,0x01,0x03,0x13,0x70,0x2e,0x07,0x12,0x10,0x57,0x01,
-0x12,0xf8,0x1d,0x05,0x02,0xbe,0x09,0x12,0x8f,0x1f,0x00,0x13,0x02,0x57,0x06,0x11,
-0x0e,0x68,0x08,0x01,0x07,0x01,0x12,0x70,0xd2,0x04,0x13,0xfb,0x69,0x06,0x13,0xf0,
-0x41,0x01,0x12,0x20,0x26,0x00,0x13,0xf6,0x54,0x00,0x12,0x80,0x83,0x00,0x13,0xfa,
-0x35,0x00,0x12,0xb0,0x20,0x01,0x04,0x12,0x01,0x12,0xd0,0xd3,0x0a,0x13,0xfe,0xee,
-0x00,0x00,0x0f,0x00,0x04,0xed,0x03,0x12,0x9f,0x0c,0x01,0x13,0x09,0x62,0x00,0x12,
-0xaf,0x0c,0x01,0x13,0x0c,0xc6,0x00,0x12,0xef,0xd4,0x01,0x12,0x0f,0xa6,0x00,0x16,
-0x04,0x43,0x00,0x12,0x90,0xe3,0x00,0x17,0xf5,0xcf,0x01,0x12,0x5f,0x47,0x08,0x12,
-0x0a,0x53,0x02,0x13,0x01,0x7e,0x00,0x12,0x7f,0xc9,0x01,0x15,0x1f,0x67,0x00,0x16,
-0xf3,0x7a,0x01,0x21,0x02,0xef,0x84,0x00,0x22,0x02,0xdf,0x09,0x05,0x12,0xdf,0x6d,
-0x00,0x13,0x09,0xf2,0x09,0x13,0x4f,0x83,0x07,0x2b,0xd8,0x00,0x01,0x00,0x00,0x9e,
-0x00,0x07,0x8c,0x07,0x15,0xe0,0x10,0x0a,0x05,0xbf,0x04,0x00,0xd7,0x00,0x16,0xc0,
-0xba,0x08,0x12,0xfb,0x64,0x05,0x00,0x8e,0x00,0x00,0xa3,0x00,0x52,0x01,0x00,0x03,
-0xfe,0x82,0xc0,0x01,0xf1,0x04,0x5b,0xf2,0x00,0x8f,0xff,0xfb,0x50,0x5f,0xff,0x90,
-0x18,0xef,0xff,0x70,0x0e,0xff,0xff,0xff,0xeb,0x43,0x0d,0x26,0xfc,0x03,0xc0,0x03,
-0x34,0xf1,0x02,0x7b,0x0b,0x00,0x60,0xb6,0x10,0x00,0x00,0x49,0xdf,0xcb,0x04,0x15,
-0x84,0xf7,0x04,0x15,0xd1,0x68,0x0a,0x05,0xb8,0x0a,0x34,0x9f,0xff,0xfd,0x5a,0x05,
-0x42,0x5f,0xff,0xfb,0x1f,0x33,0x06,0x00,0xbd,0x01,0x22,0x10,0x6f,0x15,0x01,0x10,
-0x1d,0x2b,0x00,0x11,0xcf,0x02,0x02,0x10,0x0a,0x19,0x01,0x12,0x03,0x4a,0x01,0x30,
-0x2b,0xff,0xf2,0xff,0x00,0x20,0xfb,0x10,0xf3,0x01,0x10,0xf8,0xe1,0x01,0x12,0xf6,
-0xcf,0x05,0x00,0x05,0x00,0x24,0x42,0x00,0x4d,0x0b,0x27,0xff,0xfe,0xdd,0x0a,0x04,
-0x56,0x0b,0x02,0x75,0x04,0x0f,0x19,0x00,0x3c,0xd8,0x03,0x66,0x66,0x66,0x66,0xdf,
-0xff,0xff,0xf6,0x66,0x66,0x66,0x64,0xa7,0x0c,0x17,0xc9,0x0c,0x00,0x1f,0xfc,0x19,
-0x00,0x1f,0x0f,0xaf,0x00,0x44,0x0f,0x19,0x00,0x14,0x10,0x09,0x6e,0x01,0x0f,0x05,
-0x00,0x04,0x30,0xf4,0x00,0x0a,0xa3,0x02,0x10,0x0d,0x2c,0x00,0x10,0x1f,0x48,0x03,
-0x10,0x6f,0xc0,0x02,0x50,0xcf,0xff,0xfe,0x00,0x04,0x1d,0x00,0x10,0x0d,0x13,0x00,
-0x20,0x05,0xdf,0xca,0x06,0x61,0x06,0xc1,0x00,0x00,0x3b,0xbb,0x01,0x00,0x12,0x45,
-0xd7,0x00,0x22,0xf7,0x5f,0x08,0x00,0x1f,0x75,0x0f,0x00,0x03,0x30,0x00,0x47,0x84,
-0xaf,0x02,0x70,0xfc,0x10,0x8f,0xff,0xff,0xfa,0x0d,0x4f,0x0b,0x00,0x35,0x07,0x10,
-0x0b,0xb5,0x09,0x10,0x3f,0x7e,0x00,0x36,0x3b,0xff,0xc4,0x73,0x09,0x15,0xd0,0xed,
-0x01,0x15,0x80,0x12,0x08,0x14,0x20,0xf4,0x0b,0x15,0xfd,0xd2,0x00,0x15,0xf7,0x94,
-0x09,0x15,0xf2,0xb9,0x0e,0x15,0xc0,0xfc,0x00,0x15,0x70,0xbd,0x07,0x14,0x20,0x76,
-0x08,0x1c,0xfc,0x3b,0x00,0x13,0x02,0x81,0x04,0x08,0x3b,0x00,0x15,0x0d,0xca,0x02,
-0x14,0x2f,0x72,0x08,0x00,0x27,0x03,0x05,0x53,0x0f,0x1c,0xf6,0x3b,0x00,0x14,0x08,
-0x5c,0x0c,0x07,0x3b,0x00,0x2e,0x3f,0xff,0x3b,0x00,0x02,0x96,0x06,0x02,0xb5,0x05,
-0x1c,0xf0,0x3b,0x00,0x14,0x0e,0xce,0x08,0x00,0x3b,0x00,0x05,0xc7,0x03,0x1c,0xfa,
-0x3b,0x00,0x15,0x04,0x3b,0x00,0x15,0x09,0xb8,0x0c,0x06,0x3b,0x00,0x1f,0x4f,0x3b,
-0x00,0x02,0x15,0xf4,0x3b,0x00,0x14,0xe0,0x2b,0x04,0x04,0xcb,0x08,0x15,0x0f,0x60,
-0x0e,0x37,0x18,0x88,0x87,0x04,0x0c,0x67,0x7b,0xde,0xfe,0xca,0x50,0x00,0x3e,0x0d,
-0x16,0xf7,0xd8,0x08,0x03,0xdc,0x0a,0x14,0x4f,0xb4,0x0f,0x16,0x10,0xb1,0x09,0x22,
-0xff,0xfa,0x2f,0x08,0x20,0xff,0xdc,0xdd,0x01,0x11,0xf4,0x8a,0x09,0x41,0xfa,0x10,
-0x00,0x4d,0x29,0x08,0x12,0x8f,0x65,0x05,0x01,0x6f,0x08,0x12,0x0e,0x69,0x0d,0x00,
-0x14,0x00,0x23,0xf8,0x01,0x32,0x0d,0x10,0x03,0x26,0x00,0x13,0x4f,0xc6,0x05,0x00,
-0x85,0x08,0x12,0x07,0xd8,0x09,0x01,0x1b,0x05,0x10,0xf2,0xbe,0x11,0x04,0xd5,0x02,
-0x13,0x39,0x6d,0x04,0x00,0x2f,0x07,0x23,0xf4,0xaf,0x19,0x00,0x00,0x4b,0x02,0x17,
+0x0b,0x02,0x09,0xd8,0x8f,0x70,0x13,0x0e,0x0e,0x03,0x17,0x00,0x01,0x00,0x2f,0xef,
+0x00,0x01,0x00,0x02,0x13,0xf5,0x08,0x00,0x17,0xde,0x14,0x00,0xbe,0xf2,0xef,0x00,
+0xfa,0xe6,0x00,0xe6,0x00,0x00,0x00,0x03,0x31,0x00,0x4d,0x06,0x0b,0x00,0x06,0x15,
+0x00,0x2f,0xaf,0x00,0x01,0x00,0x14,0x1f,0xba,0x1d,0x00,0x09,0x03,0x84,0x00,0xb2,
+0xe9,0x00,0xfa,0x00,0x00,0xde,0xfb,0xea,0xf5,0x00,0xd5,0x8f,0x00,0x7c,0xfd,0x00,
+0x00,0xfb,0xfd,0xf2,0xf7,0x8e,0x00,0x7e,0xf8,0x00,0xf9,0x00,0x00,0xf0,0x00,0x01,
+0x00,0x17,0xf9,0x23,0x00,0x01,0x01,0x00,0x19,0xfd,0x1f,0x00,0x11,0xfb,0x06,0x00,
+0x30,0xdd,0x00,0x00,0x68,0x00,0x8f,0x00,0xe8,0x00,0xfa,0x00,0xfa,0xf4,0xf9,0x98,
+0x00,0x09,0x15,0x06,0x3a,0x00,0x11,0xfb,0x3d,0x00,0x34,0xfb,0xf9,0xfa,0x12,0x00,
+0x75,0xb2,0x00,0x00,0x00,0xc9,0x00,0xc5,0x23,0x00,0x62,0xf6,0xfa,0x00,0x00,0xfa,
+0xf9,0x04,0x00,0x07,0x01,0x00,0x13,0x05,0x8c,0x00,0x2f,0x05,0xf8,0x65,0x00,0x06,
+0x1f,0xfa,0x3a,0x01,0x0c,0x5a,0xd1,0x00,0x00,0x00,0xf7,0xe5,0x00,0x10,0xf8,0x07,
+0x00,0x20,0xf5,0xee,0x0e,0x00,0x14,0xae,0x69,0x00,0x96,0xee,0x00,0x00,0xc6,0xf9,
+0xc5,0xe6,0x00,0xb1,0x2a,0x00,0x34,0xfc,0xdd,0xf1,0x0b,0x00,0x72,0x8d,0x00,0x00,
+0x00,0xcd,0x00,0xcc,0x57,0x01,0xdd,0x00,0xf6,0x00,0xfd,0xfc,0x00,0x00,0xfc,0x00,
+0x00,0x04,0x00,0x04,0x70,0x00,0x6f,0xf7,0x00,0xf8,0xfa,0x00,0xf6,0x93,0x00,0x0a,
+0x10,0xf2,0x0e,0x01,0x1c,0xf2,0x16,0x00,0x01,0x69,0x02,0xc0,0xb7,0xb3,0x00,0x00,
+0xde,0xf8,0xc3,0xfb,0x05,0x00,0x05,0x04,0xfe,0x00,0xd2,0xd0,0xe7,0x00,0xe7,0xc5,
+0xee,0xea,0x00,0xee,0xe9,0xf3,0xea,0xef,0x54,0x01,0x66,0xc3,0xd3,0x00,0x00,0xeb,
+0xfc,0x23,0x01,0xa3,0xf3,0xf4,0x00,0x00,0xf3,0xf7,0x00,0x00,0xf8,0xfd,0x31,0x01,
+0x94,0x04,0x00,0xd7,0xef,0x00,0x00,0xf4,0x00,0x00,0x9e,0x00,0x73,0x03,0xf7,0xf7,
+0x00,0x00,0xf7,0xfa,0xc2,0x01,0x03,0x15,0x00,0x14,0xd4,0xf1,0x01,0x15,0x04,0x18,
+0x01,0x10,0xfa,0x4f,0x01,0x13,0xf7,0xc7,0x00,0xf5,0x11,0x06,0xf2,0xbe,0xd5,0x00,
+0x00,0xd5,0xf8,0xe5,0xfb,0x05,0xe5,0x05,0x05,0x04,0x05,0x00,0x05,0xee,0xee,0xfa,
+0xf5,0xee,0xf5,0xf0,0xfa,0xf5,0xfa,0x00,0xf9,0xf7,0x05,0x81,0x00,0x2a,0x04,0xf9,
+0x8e,0x01,0x10,0xfa,0xea,0x01,0x1b,0xf8,0xb1,0x01,0x14,0xfb,0x3f,0x02,0x0c,0x01,
+0x00,0x1f,0xfb,0x29,0x01,0x09,0x02,0xe6,0x00,0x0f,0xfc,0x01,0x07,0x01,0xa3,0x02,
+0x2c,0xfc,0xfc,0xa9,0x02,0x0f,0x4c,0x00,0x08,0x0f,0x1d,0x00,0x0a,0x1e,0x05,0xa2,
+0x03,0x39,0x05,0x00,0xf9,0x0e,0x00,0x2f,0xe9,0x00,0x01,0x00,0x23,0x0a,0xa6,0x02,
+0x1f,0xe7,0x8c,0x00,0x0b,0x22,0xfa,0xfb,0xc9,0x01,0x1c,0xcf,0x5b,0x02,0x20,0xfb,
+0x06,0x5a,0x02,0x4f,0x0e,0x00,0x05,0x05,0x41,0x00,0x09,0x07,0xee,0x02,0x13,0x04,
+0x01,0x03,0x09,0x60,0x00,0x2c,0xfc,0x04,0x0d,0x01,0x1f,0xdd,0xd2,0x00,0x23,0x1e,
+0xf5,0x23,0x00,0x0f,0xf5,0x01,0x12,0x1f,0xfa,0xb6,0x03,0x05,0x30,0x01,0x00,0x02,
+0x07,0x00,0x31,0x02,0x03,0x00,0x5c,0x03,0x1e,0x05,0x52,0x04,0xf1,0x0b,0x07,0x08,
+0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,
+0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,0xf7,0x0c,0x1a,0x1b,0x1c,0x00,
+0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,
+0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x61,0x00,0x20,0x03,0x02,0x5c,0x00,0x4b,0x06,
+0x07,0x06,0x08,0x5f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,
+0x0c,0x00,0x08,0x00,0xf2,0x07,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,
+0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x22,0x06,0xf0,0x04,
+0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,
+0x23,0x00,0x00,0x80,0xcf,0xff,0xff,0xfb,0xbf,0xff,0xff,0xfa,0x04,0x00,0x40,0xaf,
+0xff,0xff,0xf9,0x04,0x00,0x92,0x9f,0xff,0xff,0xf8,0x9f,0xff,0xff,0xf7,0x8f,0x04,
+0x00,0x22,0xf6,0x7f,0x04,0x00,0x22,0xf5,0x6f,0x04,0x00,0x22,0xf4,0x5f,0x04,0x00,
+0x90,0xf3,0x4f,0xff,0xff,0xf3,0x3f,0xff,0xff,0xf2,0x04,0x00,0x40,0x2f,0xff,0xff,
+0xf1,0x04,0x00,0x40,0x1f,0xff,0xff,0xf0,0x04,0x00,0x12,0x0f,0x04,0x00,0x68,0xe0,
+0x0b,0xbb,0xbb,0xa0,0x00,0x01,0x00,0x70,0x36,0x63,0x00,0x0b,0xff,0xff,0xa0,0x5c,
+0x00,0x80,0xef,0xff,0xff,0xfc,0xff,0xff,0xff,0xfe,0x84,0x00,0x00,0x4c,0x00,0xbc,
+0x04,0xcf,0xfb,0x30,0x7f,0xff,0xf8,0x00,0x7f,0xff,0xf6,0x07,0x00,0x12,0xf7,0x07,
+0x00,0xf2,0x0e,0xf6,0x00,0x7f,0xff,0xf5,0x7f,0xff,0xf4,0x00,0x7f,0xff,0xf3,0x7f,
+0xff,0xf3,0x00,0x7f,0xff,0xf2,0x7f,0xff,0xf1,0x00,0x7f,0xff,0xf0,0x7f,0xff,0xf0,
+0x07,0x00,0xf0,0x0f,0xe0,0x00,0x7f,0xff,0xd0,0x7f,0xff,0xc0,0x00,0x7f,0xff,0xc0,
+0x7f,0xff,0xb0,0x00,0x7f,0xff,0xa0,0x7f,0xff,0x90,0x00,0x7f,0xff,0x90,0x37,0x77,
+0x30,0x00,0x04,0x00,0x00,0x01,0x00,0x00,0x2f,0x00,0x42,0x04,0xff,0xff,0x20,0x94,
+0x00,0x73,0xaf,0xff,0xc0,0x00,0x07,0xff,0xff,0xa2,0x00,0x73,0xdf,0xff,0xa0,0x00,
+0x0a,0xff,0xfd,0x0e,0x00,0x72,0xff,0xff,0x70,0x00,0x0c,0xff,0xfa,0x0d,0x00,0x82,
+0x02,0xff,0xff,0x40,0x00,0x0f,0xff,0xf8,0x0e,0x00,0x10,0x05,0x41,0x00,0x32,0x2f,
+0xff,0xf5,0x0e,0x00,0x01,0x41,0x00,0x32,0x4f,0xff,0xf2,0x0e,0x00,0x32,0x0a,0xff,
+0xfc,0x66,0x00,0x01,0x01,0x00,0x30,0x0d,0xff,0xfa,0x66,0x00,0x12,0xd0,0x0e,0x00,
+0x70,0x0f,0xff,0xf7,0x00,0x00,0xcf,0xff,0x18,0x01,0xf6,0x01,0x24,0x44,0x44,0x5f,
+0xff,0xf8,0x44,0x44,0xff,0xff,0xa4,0x44,0x43,0x00,0x9f,0xff,0x01,0x00,0x1f,0xfd,
+0x0e,0x00,0x18,0x01,0xa7,0x00,0x52,0x60,0x00,0x0d,0xff,0xf9,0x61,0x00,0x82,0x03,
+0xff,0xff,0x30,0x00,0x0f,0xff,0xf6,0x0e,0x00,0x82,0x06,0xff,0xff,0x10,0x00,0x3f,
+0xff,0xf4,0x0e,0x00,0x82,0x09,0xff,0xfe,0x00,0x00,0x6f,0xff,0xf1,0x0e,0x00,0x82,
+0x0c,0xff,0xfb,0x00,0x00,0x9f,0xff,0xe0,0x0e,0x00,0x30,0x0e,0xff,0xf8,0x99,0x00,
+0xf7,0x05,0xb0,0x00,0x00,0x00,0x13,0x33,0x33,0x4f,0xff,0xf8,0x33,0x33,0xef,0xff,
+0xa3,0x33,0x33,0x00,0x7f,0xff,0x01,0x00,0x0f,0x0e,0x00,0x18,0x0f,0x40,0x01,0x04,
+0x19,0xf7,0x40,0x01,0x03,0x99,0x00,0x10,0x08,0x30,0x00,0x14,0x5f,0x40,0x01,0x10,
+0x0b,0x40,0x01,0x16,0x8f,0x40,0x01,0x12,0xf9,0xa6,0x01,0x03,0x40,0x01,0x10,0xf6,
+0xa6,0x01,0x12,0x90,0x0e,0x00,0x01,0xda,0x00,0x00,0xff,0x00,0x01,0x01,0x00,0x00,
+0xda,0x00,0x10,0x03,0x66,0x00,0x01,0x01,0x00,0x00,0xda,0x00,0x01,0xff,0x00,0x04,
+0x01,0x00,0x36,0x0a,0xdd,0xd1,0x8b,0x02,0x14,0xcf,0x00,0x02,0x01,0x09,0x01,0x1f,
+0xf2,0x19,0x00,0x0f,0x43,0x47,0xef,0xff,0x83,0x0b,0x00,0x20,0x2a,0xff,0xba,0x02,
+0x11,0x81,0x0c,0x00,0x12,0x8f,0xee,0x00,0x10,0xe4,0x0c,0x00,0x13,0xbf,0xfb,0x00,
+0x00,0x15,0x02,0x05,0xa5,0x01,0x10,0xf2,0xa6,0x00,0x04,0x01,0x00,0x10,0xc0,0x00,
+0x03,0x60,0xff,0xf9,0x20,0x15,0xdf,0xff,0xa8,0x00,0x20,0xff,0xff,0x0f,0x01,0x50,
+0x01,0xdf,0xff,0xff,0xfa,0x25,0x00,0x12,0xfe,0x18,0x01,0x20,0xff,0xe0,0x05,0x00,
+0x11,0xb0,0xed,0x00,0x52,0xff,0xff,0x20,0x6f,0xff,0x42,0x01,0x10,0xdf,0x26,0x03,
+0x00,0x44,0x00,0x00,0x22,0x01,0x40,0xee,0xee,0xee,0x40,0x57,0x00,0x05,0xac,0x00,
+0x44,0xef,0xff,0xff,0xfd,0xeb,0x00,0x10,0x09,0x9f,0x00,0x13,0x60,0x0d,0x00,0x10,
+0x2f,0x78,0x00,0x24,0xd6,0x00,0x22,0x01,0x00,0x01,0x00,0x27,0x81,0x00,0xbb,0x00,
+0x27,0xf9,0x10,0x1a,0x00,0x21,0xff,0x70,0x0d,0x00,0x12,0x1a,0x0d,0x00,0x12,0xb0,
+0x51,0x02,0x13,0xaf,0xbb,0x00,0x01,0x01,0x00,0x20,0x18,0xef,0x0d,0x00,0x04,0xd7,
+0x03,0x30,0x5d,0xff,0xff,0x6f,0x02,0x05,0xc5,0x01,0x00,0x52,0x02,0x06,0x0d,0x00,
+0x63,0xf0,0x68,0x88,0x88,0x82,0x00,0xc8,0x00,0x52,0x3a,0xff,0xff,0xff,0x50,0x61,
+0x01,0x42,0xff,0xf4,0x9f,0xff,0x48,0x03,0x00,0x0e,0x01,0x32,0x56,0xff,0xff,0x1d,
+0x03,0x12,0xef,0x53,0x04,0x01,0x26,0x00,0x62,0x4f,0xff,0xff,0xff,0x10,0xdf,0x0d,
+0x00,0x10,0x3e,0x21,0x00,0x10,0x06,0x6a,0x00,0x31,0xc8,0x78,0xbf,0x33,0x01,0x14,
+0x0c,0x51,0x01,0x00,0x33,0x01,0x14,0x2e,0x0d,0x00,0x00,0x89,0x00,0x14,0x2d,0x18,
+0x00,0x12,0x40,0x84,0x00,0x00,0x01,0x00,0x11,0xfa,0x25,0x01,0x20,0x01,0x6b,0x73,
+0x04,0x14,0x82,0xa0,0x00,0x26,0x5f,0xff,0x9b,0x04,0x36,0x04,0xff,0xfa,0x00,0x02,
+0x1f,0x4f,0x19,0x00,0x0f,0x47,0x5a,0xdf,0xfe,0xa5,0xd6,0x04,0x20,0x02,0xcf,0x89,
+0x03,0x06,0x36,0x02,0x21,0x01,0xef,0x82,0x00,0x06,0x11,0x00,0x02,0x18,0x02,0x14,
+0xfc,0x10,0x00,0x00,0xeb,0x01,0x31,0x82,0x27,0xff,0xfc,0x02,0x22,0x2f,0xa2,0xa8,
+0x00,0x10,0x70,0xab,0x02,0x10,0x80,0x11,0x01,0x10,0xf7,0x94,0x04,0x00,0xa3,0x03,
+0x31,0x1f,0xff,0xfa,0xc0,0x03,0x10,0x30,0x51,0x04,0x11,0xff,0x4e,0x03,0x10,0xb0,
+0x5c,0x00,0x11,0x80,0x21,0x00,0x10,0xf0,0x56,0x01,0x10,0xfb,0x0a,0x00,0x10,0xe0,
+0x72,0x04,0x00,0xe8,0x02,0x10,0x01,0x21,0x00,0x32,0x4f,0xff,0xf4,0xdc,0x01,0x10,
+0xf7,0xd4,0x01,0x53,0xf9,0x00,0x0e,0xff,0xfa,0x16,0x04,0xa4,0xf7,0x22,0x7f,0xff,
+0xff,0x40,0x09,0xff,0xfe,0x10,0x7a,0x01,0x00,0x58,0x01,0x13,0x03,0x96,0x01,0x23,
+0x00,0x2e,0xae,0x02,0x13,0xdf,0xf7,0x01,0x20,0x00,0x2c,0x10,0x00,0x35,0xd2,0x00,
+0x7f,0x04,0x03,0x74,0x05,0xad,0xff,0xea,0x50,0x00,0x2f,0xc2,0x03,0x05,0x24,0x03,
+0x19,0xfc,0x10,0x00,0x16,0x06,0x11,0x02,0x02,0x0e,0x01,0x01,0xd8,0x00,0x07,0x01,
+0x00,0x00,0x0b,0x05,0x46,0x4a,0xdf,0xfd,0xa5,0x8a,0x01,0x30,0xf4,0x01,0xbf,0x20,
+0x01,0x03,0xbf,0x02,0x00,0xb2,0x00,0x11,0xdf,0x42,0x01,0x14,0x10,0xb5,0x04,0x12,
+0x10,0x83,0x02,0x14,0xfb,0xe1,0x04,0x93,0x50,0x2f,0xff,0xff,0x83,0x28,0xff,0xff,
+0xf3,0xb4,0x05,0x50,0xb0,0x06,0xff,0xff,0x90,0x47,0x01,0x12,0x80,0xfc,0x00,0x53,
+0xf2,0x00,0x9f,0xff,0xf2,0x42,0x01,0x11,0x00,0xb2,0x00,0x06,0x42,0x01,0x03,0xb2,
+0x00,0x12,0xbf,0x42,0x01,0x14,0xfc,0xb2,0x00,0x04,0x21,0x00,0x14,0xc0,0xb2,0x00,
+0x07,0x42,0x00,0x10,0xbf,0xa0,0x02,0x01,0x63,0x00,0x02,0xa5,0x01,0x32,0x03,0xbf,
+0xf4,0x59,0x03,0x23,0x92,0x26,0x84,0x00,0x12,0x48,0xd9,0x00,0x06,0xa5,0x00,0x01,
+0xfa,0x00,0x08,0xc6,0x00,0x01,0x11,0x00,0x01,0xe7,0x00,0x17,0x20,0x0c,0x01,0x15,
+0x4a,0x4a,0x02,0x66,0x05,0x9d,0xef,0xec,0x93,0x00,0x7a,0x02,0x01,0x3c,0x00,0x15,
+0xb1,0x10,0x00,0x29,0x7f,0xff,0x54,0x02,0x13,0x05,0xe7,0x02,0x13,0xe1,0x10,0x00,
+0x23,0x1f,0xff,0xeb,0x02,0x16,0x00,0xdb,0x03,0x35,0xdb,0xef,0xff,0xfe,0x04,0x10,
+0xdf,0x95,0x04,0x14,0x07,0x82,0x03,0x00,0xe8,0x00,0x00,0xc8,0x00,0x14,0xaf,0xf0,
+0x03,0x12,0x02,0x3d,0x03,0x14,0x6f,0xab,0x01,0x12,0x03,0x5a,0x04,0x14,0x6f,0x20,
+0x00,0x12,0x01,0x3a,0x00,0x15,0xcf,0xdb,0x01,0x10,0xef,0x29,0x01,0x13,0x08,0x7f,
+0x06,0x02,0x70,0x00,0x32,0xf5,0x01,0xaf,0xd3,0x02,0x03,0x75,0x04,0x30,0xfe,0x6e,
+0xff,0x32,0x01,0x06,0x92,0x04,0x07,0x9f,0x00,0x03,0x23,0x03,0x26,0xff,0x70,0x5d,
+0x03,0x00,0x0f,0x00,0x36,0xe3,0x00,0x00,0x15,0x02,0x07,0xd0,0x04,0x03,0x40,0x00,
+0x00,0xd9,0x05,0x81,0x06,0x77,0x77,0x70,0x00,0x00,0x01,0xcf,0x10,0x00,0x10,0xf3,
+0x5a,0x04,0x00,0xc8,0x01,0x24,0x1d,0xff,0x1f,0x01,0x01,0x10,0x00,0x00,0x71,0x03,
+0x10,0xfd,0x42,0x00,0x10,0xd1,0x6b,0x03,0x11,0xe0,0x2e,0x01,0x21,0xe1,0x04,0x83,
+0x03,0x10,0x8f,0x03,0x02,0x11,0x0c,0xcf,0x00,0x10,0x6f,0xe2,0x04,0x10,0xdf,0xf3,
+0x00,0x11,0x1f,0xaf,0x06,0x10,0x07,0x21,0x00,0x01,0x66,0x00,0x12,0x3f,0xd9,0x00,
+0x14,0x9f,0x62,0x04,0x03,0x9b,0x05,0x02,0x33,0x03,0x12,0xf8,0x53,0x05,0x12,0x20,
+0xca,0x04,0x10,0xff,0xaa,0x03,0x13,0x0f,0x2c,0x05,0x13,0x1d,0xd4,0x00,0x10,0x0a,
+0x07,0x02,0x52,0x10,0x00,0x02,0x8f,0xff,0x82,0x01,0x11,0x04,0xff,0x03,0x25,0xbb,
+0xdf,0x48,0x05,0x17,0xaf,0x28,0x07,0x11,0xf9,0x92,0x02,0x07,0x01,0x00,0x13,0x60,
+0x29,0x02,0x01,0x7d,0x00,0x12,0xff,0x61,0x02,0x22,0x06,0xdf,0x40,0x01,0x23,0x21,
+0xef,0x51,0x02,0x61,0x04,0x8c,0xef,0xff,0xeb,0x85,0x5b,0x06,0x00,0xeb,0x08,0x17,
+0xfb,0x03,0x00,0x71,0xfa,0x7f,0xff,0xf9,0x7f,0xff,0xf8,0x34,0x09,0x00,0x30,0x09,
+0x01,0x2f,0x09,0x00,0x2b,0x09,0x23,0x38,0x88,0xde,0x01,0x12,0x20,0x88,0x03,0x01,
+0x9d,0x01,0x11,0x2d,0x40,0x04,0x21,0x02,0xef,0xb5,0x06,0x12,0x1e,0xc2,0x01,0x02,
+0xe8,0x01,0x12,0x08,0x0d,0x00,0x12,0x3f,0x15,0x02,0x11,0xcf,0x13,0x01,0x12,0x05,
+0x14,0x00,0x12,0x0d,0xb2,0x05,0x11,0x4f,0x7a,0x07,0x00,0x6e,0x01,0x02,0x24,0x02,
+0x12,0xfb,0x22,0x00,0x12,0xf6,0x91,0x04,0x11,0xf1,0xcc,0x03,0x01,0x5f,0x00,0x12,
+0x2f,0x20,0x01,0x12,0x5f,0x4b,0x00,0x12,0x8f,0x37,0x00,0x12,0xaf,0xaa,0x07,0x12,
+0xcf,0x4c,0x01,0x12,0xdf,0xac,0x02,0x12,0xef,0x07,0x00,0x05,0x40,0x08,0x08,0x07,
+0x00,0x15,0xef,0x07,0x00,0x12,0x10,0x31,0x00,0x12,0x20,0x7d,0x00,0x12,0x30,0xac,
+0x01,0x12,0x50,0x27,0x03,0x12,0x70,0x99,0x00,0x12,0x90,0x77,0x06,0x12,0xc0,0x5e,
+0x01,0x12,0xf0,0x66,0x05,0x12,0xf3,0xdc,0x02,0x12,0xf8,0x47,0x00,0x13,0xfc,0xba,
+0x02,0x12,0x20,0x41,0x03,0x12,0x90,0xb7,0x00,0x12,0xf0,0x10,0x03,0x17,0xf8,0x1d,
+0x00,0x12,0x0d,0x48,0x00,0x22,0x04,0xff,0x64,0x09,0x12,0x7f,0x2c,0x00,0x12,0x09,
+0xea,0x00,0x02,0x29,0x04,0x00,0x3f,0x02,0x02,0x22,0x07,0x15,0x3c,0xd5,0x02,0x13,
+0x50,0x9c,0x03,0x13,0xe5,0x18,0x05,0x13,0xf9,0x60,0x08,0x22,0xfa,0x00,0x6a,0x00,
+0x13,0xf9,0xda,0x02,0x13,0xf7,0x90,0x05,0x22,0xf3,0x00,0x83,0x01,0x13,0xd0,0x01,
+0x03,0x13,0x70,0x2e,0x07,0x12,0x10,0x57,0x01,0x12,0xf8,0x1d,0x05,0x02,0xbe,0x09,
+0x12,0x8f,0x1f,0x00,0x13,0x02,0x57,0x06,0x11,0x0e,0x68,0x08,0x01,0x07,0x01,0x12,
+0x70,0xd2,0x04,0x13,0xfb,0x69,0x06,0x13,0xf0,0x41,0x01,0x12,0x20,0x26,0x00,0x13,
+0xf6,0x54,0x00,0x12,0x80,0x83,0x00,0x13,0xfa,0x35,0x00,0x12,0xb0,0x20,0x01,0x04,
+0x12,0x01,0x12,0xd0,0xd3,0x0a,0x13,0xfe,0xee,0x00,0x00,0x0f,0x00,0x04,0xed,0x03,
+0x12,0x9f,0x0c,0x01,0x13,0x09,0x62,0x00,0x12,0xaf,0x0c,0x01,0x13,0x0c,0xc6,0x00,
+0x12,0xef,0xd4,0x01,0x12,0x0f,0xa6,0x00,0x16,0x04,0x43,0x00,0x12,0x90,0xe3,0x00,
+0x17,0xf5,0xcf,0x01,0x12,0x5f,0x47,0x08,0x12,0x0a,0x53,0x02,0x13,0x01,0x7e,0x00,
+0x12,0x7f,0xc9,0x01,0x15,0x1f,0x67,0x00,0x16,0xf3,0x7a,0x01,0x21,0x02,0xef,0x84,
+0x00,0x22,0x02,0xdf,0x09,0x05,0x12,0xdf,0x6d,0x00,0x13,0x09,0xf2,0x09,0x13,0x4f,
+0x83,0x07,0x2b,0xd8,0x00,0x01,0x00,0x00,0x9e,0x00,0x07,0x8c,0x07,0x15,0xe0,0x10,
+0x0a,0x05,0xbf,0x04,0x00,0xd7,0x00,0x16,0xc0,0xba,0x08,0x12,0xfb,0x64,0x05,0x00,
+0x8e,0x00,0x00,0xa3,0x00,0x52,0x01,0x00,0x03,0xfe,0x82,0xc0,0x01,0xf1,0x04,0x5b,
+0xf2,0x00,0x8f,0xff,0xfb,0x50,0x5f,0xff,0x90,0x18,0xef,0xff,0x70,0x0e,0xff,0xff,
+0xff,0xeb,0x43,0x0d,0x26,0xfc,0x03,0xc0,0x03,0x34,0xf1,0x02,0x7b,0x0b,0x00,0x60,
+0xb6,0x10,0x00,0x00,0x49,0xdf,0xcb,0x04,0x15,0x84,0xf7,0x04,0x15,0xd1,0x68,0x0a,
+0x05,0xb8,0x0a,0x34,0x9f,0xff,0xfd,0x5a,0x05,0x42,0x5f,0xff,0xfb,0x1f,0x33,0x06,
+0x00,0xbd,0x01,0x22,0x10,0x6f,0x15,0x01,0x10,0x1d,0x2b,0x00,0x11,0xcf,0x02,0x02,
+0x10,0x0a,0x19,0x01,0x12,0x03,0x4a,0x01,0x30,0x2b,0xff,0xf2,0xff,0x00,0x20,0xfb,
+0x10,0xf3,0x01,0x10,0xf8,0xe1,0x01,0x12,0xf6,0xcf,0x05,0x00,0x05,0x00,0x24,0x42,
+0x00,0x4d,0x0b,0x27,0xff,0xfe,0xdd,0x0a,0x04,0x56,0x0b,0x02,0x75,0x04,0x0f,0x19,
+0x00,0x3c,0xd8,0x03,0x66,0x66,0x66,0x66,0xdf,0xff,0xff,0xf6,0x66,0x66,0x66,0x64,
+0xa7,0x0c,0x17,0xc9,0x0c,0x00,0x1f,0xfc,0x19,0x00,0x1f,0x0f,0xaf,0x00,0x44,0x0f,
+0x19,0x00,0x14,0x10,0x09,0x6e,0x01,0x0f,0x05,0x00,0x04,0x30,0xf4,0x00,0x0a,0xa3,
+0x02,0x10,0x0d,0x2c,0x00,0x10,0x1f,0x48,0x03,0x10,0x6f,0xc0,0x02,0x50,0xcf,0xff,
+0xfe,0x00,0x04,0x1d,0x00,0x10,0x0d,0x13,0x00,0x20,0x05,0xdf,0xca,0x06,0x61,0x06,
+0xc1,0x00,0x00,0x3b,0xbb,0x01,0x00,0x12,0x45,0xd7,0x00,0x22,0xf7,0x5f,0x08,0x00,
+0x1f,0x75,0x0f,0x00,0x03,0x30,0x00,0x47,0x84,0xaf,0x02,0x70,0xfc,0x10,0x8f,0xff,
+0xff,0xfa,0x0d,0x4f,0x0b,0x00,0x35,0x07,0x10,0x0b,0xb5,0x09,0x90,0x3f,0xff,0xff,
+0xf5,0x00,0x3b,0xff,0xc4,0x00,0x11,0x00,0x01,0x00,0x42,0x06,0xff,0xff,0xd0,0x0a,
+0x00,0x42,0x0b,0xff,0xff,0x80,0x0a,0x00,0x42,0x1f,0xff,0xff,0x20,0x0a,0x00,0x42,
+0x6f,0xff,0xfd,0x00,0x01,0x00,0x32,0xcf,0xff,0xf7,0x09,0x00,0x42,0x01,0xff,0xff,
+0xf2,0x0a,0x00,0x42,0x07,0xff,0xff,0xc0,0x0a,0x00,0x42,0x0c,0xff,0xff,0x70,0x0a,
+0x00,0x15,0x2f,0x3b,0x00,0x3c,0x7f,0xff,0xfc,0x3b,0x00,0x4c,0x02,0xff,0xff,0xf1,
+0x3b,0x00,0x45,0x0d,0xff,0xff,0x60,0x3b,0x00,0x12,0x10,0x0a,0x00,0x33,0x8f,0xff,
+0xfb,0x3b,0x00,0x3c,0xdf,0xff,0xf6,0x3b,0x00,0x4c,0x08,0xff,0xff,0xb0,0x3b,0x00,
+0x2e,0x3f,0xff,0x3b,0x00,0x32,0xef,0xff,0xf5,0x09,0x00,0x4c,0x03,0xff,0xff,0xf0,
+0x3b,0x00,0x45,0x0e,0xff,0xff,0x50,0x3b,0x00,0x03,0x31,0x00,0x3c,0x9f,0xff,0xfa,
+0x3b,0x00,0x15,0x04,0x3b,0x00,0x4c,0x09,0xff,0xff,0xa0,0x3b,0x00,0x1f,0x4f,0x3b,
+0x00,0x02,0x15,0xf4,0x3b,0x00,0x12,0xe0,0x0a,0x00,0x42,0x0a,0xff,0xff,0x90,0x0a,
+0x00,0x42,0x0f,0xff,0xff,0x40,0x0a,0x00,0x45,0x18,0x88,0x87,0x00,0x01,0x00,0x53,
+0x02,0x7b,0xde,0xfe,0xca,0x54,0x00,0x20,0x1a,0xff,0x01,0x00,0x14,0xf7,0x60,0x00,
+0x00,0x01,0x00,0x26,0xfc,0x10,0x0c,0x00,0x31,0xff,0xfd,0x10,0x9f,0x01,0x02,0x01,
+0x00,0x11,0xfa,0x5d,0x00,0xa0,0xff,0xff,0xdc,0xef,0xff,0xff,0xff,0xf4,0x00,0x02,
+0x13,0x00,0x40,0x10,0x00,0x4d,0xff,0x5d,0x01,0x42,0x8f,0xff,0xff,0xfb,0x55,0x01,
+0x71,0xff,0x20,0x0e,0xff,0xff,0xff,0x30,0x1d,0x01,0x42,0xff,0xf8,0x01,0xff,0xf1,
+0x01,0x10,0x03,0x26,0x00,0x11,0x4f,0x44,0x00,0x01,0x99,0x00,0x33,0xff,0x07,0xff,
+0x00,0x02,0x83,0xdf,0xff,0xff,0xf2,0x8f,0xff,0xff,0xf6,0xd9,0x01,0x33,0xff,0x39,
+0xff,0x68,0x01,0x52,0xbf,0xff,0xff,0xf4,0xaf,0x19,0x00,0x00,0x2d,0x02,0x27,0xff,
 0x5b,0x19,0x00,0x2f,0xf5,0xbf,0x19,0x00,0x2a,0x18,0x5a,0x19,0x00,0x17,0x9f,0x19,
-0x00,0x14,0x48,0x19,0x00,0x20,0xcf,0xff,0x8b,0x08,0x02,0xc9,0x06,0x00,0xd1,0x02,
-0x14,0x24,0x4a,0x0e,0x12,0xff,0x39,0x12,0x13,0xfe,0xcd,0x01,0x11,0xfc,0x0b,0x0e,
-0x03,0xc1,0x0d,0x34,0x80,0x08,0xff,0x96,0x0b,0x21,0xff,0xf2,0x0c,0x01,0x41,0xa1,
-0x00,0x03,0xdf,0x8e,0x06,0x10,0xaf,0x5a,0x01,0x21,0xbd,0xff,0xce,0x09,0x03,0x52,
-0x0a,0x02,0x8a,0x09,0x14,0x04,0x0c,0x00,0x26,0xd1,0x00,0x0d,0x00,0x11,0xd1,0xfa,
-0x02,0x18,0xaf,0x79,0x0a,0x56,0x26,0xbd,0xef,0xed,0xa5,0x66,0x0a,0x21,0x28,0xe9,
-0x23,0x00,0x11,0x7c,0x6d,0x06,0x21,0x05,0xbf,0x75,0x06,0x11,0x4a,0xa4,0x09,0x22,
-0x02,0x8e,0xac,0x09,0x13,0xcf,0xb4,0x09,0x1e,0xef,0x08,0x00,0x21,0xfd,0xcf,0x08,
-0x00,0x81,0xc7,0x20,0x8f,0xff,0xff,0xf9,0xeb,0x61,0xaa,0x01,0x01,0xe2,0x07,0x0f,
-0x08,0x00,0xb5,0x67,0x48,0xce,0xff,0xed,0xa7,0x10,0xf8,0x0f,0x21,0xff,0xfb,0x27,
-0x04,0x13,0x1b,0x60,0x01,0x16,0xf6,0xd8,0x0b,0x02,0xf1,0x01,0x27,0x0d,0xff,0x04,
-0x11,0x10,0x9f,0xce,0x0a,0x21,0xbc,0xef,0x21,0x0d,0x12,0x02,0xa1,0x0f,0x11,0x06,
-0x1f,0x0b,0x12,0x08,0x20,0x00,0x01,0xf2,0x0b,0x23,0x50,0x0d,0x9c,0x01,0x10,0x0d,
-0xf9,0x01,0x13,0x1f,0xc0,0x0c,0x10,0x08,0x49,0x0c,0x03,0x84,0x0b,0x01,0xa6,0x0b,
-0x54,0x90,0x2a,0xaa,0xaa,0xa8,0x65,0x10,0x05,0x5d,0x0e,0x16,0x0b,0xdf,0x0c,0x02,
-0x34,0x03,0x16,0x10,0x72,0x0e,0x26,0xff,0xfa,0xd3,0x0f,0x04,0x37,0x0e,0x02,0x6d,
-0x09,0x06,0xee,0x0f,0x17,0xcf,0xac,0x0d,0x13,0x0b,0xc6,0x11,0x03,0x1a,0x04,0x06,
-0x66,0x00,0x09,0xe4,0x10,0x16,0x8f,0x17,0x11,0x28,0x00,0x07,0xb1,0x0c,0x26,0x6f,
-0xff,0xe8,0x07,0x18,0x05,0x04,0x0e,0x00,0x03,0x04,0x25,0xe2,0x00,0xd4,0x04,0x06,
-0xd1,0x0d,0x17,0x3f,0x97,0x00,0x27,0x02,0xef,0x55,0x11,0x11,0x2e,0x17,0x04,0x07,
-0x51,0x0e,0x12,0xeb,0x44,0x06,0x28,0xb8,0x09,0x21,0x07,0x0f,0x0d,0x00,0x21,0x00,
-0x51,0x00,0x53,0x6a,0xdf,0xff,0xec,0x96,0x76,0x00,0x17,0xaf,0x0f,0x12,0x17,0x7f,
-0xca,0x12,0x18,0x09,0x9a,0x0c,0x03,0x27,0x12,0x01,0xae,0x00,0x11,0x01,0xcd,0x04,
-0x21,0xbc,0xef,0x4d,0x00,0x12,0x07,0x10,0x02,0x20,0x04,0xef,0xad,0x04,0x13,0x0c,
-0x11,0x0d,0x10,0x2f,0x35,0x00,0x04,0xba,0x04,0x10,0x09,0xba,0x01,0x43,0x06,0x66,
-0x66,0x66,0xb3,0x06,0x06,0x7a,0x01,0x17,0x06,0x2a,0x0e,0x28,0x00,0x0a,0x18,0x0e,
-0x08,0xc7,0x01,0x00,0xf5,0x03,0x02,0x7d,0x15,0x45,0x38,0x88,0x89,0xcf,0x9f,0x12,
-0x18,0x6f,0x76,0x0f,0x27,0x6f,0xff,0xfb,0x12,0x11,0x6f,0xa0,0x00,0x18,0x50,0xfa,
-0x12,0x19,0xfc,0xed,0x12,0x14,0xe2,0x58,0x01,0x14,0x49,0x4a,0x15,0x05,0x8c,0x01,
-0x27,0x60,0x00,0xd8,0x01,0x17,0xc0,0xcc,0x10,0x06,0x2d,0x08,0x00,0xa5,0x04,0x64,
-0xf2,0x24,0x44,0x44,0x43,0x00,0x9e,0x13,0x14,0x5f,0x88,0x00,0x00,0x1a,0x00,0x13,
-0x4f,0x4c,0x08,0x13,0x04,0xdd,0x04,0x23,0xff,0xa0,0xd8,0x02,0x22,0xc0,0x0b,0x2b,
-0x01,0x20,0x03,0xdf,0xea,0x00,0x11,0x03,0xa5,0x00,0x22,0xbb,0xef,0x6a,0x0e,0x06,
-0x02,0x09,0x15,0xf5,0xa3,0x11,0x03,0x8e,0x00,0x04,0x1b,0x00,0x11,0xe5,0x0c,0x01,
-0x17,0xbf,0xbc,0x13,0x00,0x7d,0x06,0x37,0xff,0xec,0x95,0xf1,0x0a,0x12,0x2f,0x2d,
-0x0f,0x06,0xd5,0x08,0x18,0xf4,0x6b,0x01,0x27,0xff,0x40,0xcf,0x00,0x06,0x1b,0x00,
-0x18,0xaf,0x1b,0x00,0x18,0x4f,0x1b,0x00,0x14,0x0e,0x7e,0x0f,0x06,0x8b,0x0f,0x16,
-0xf4,0xc4,0x02,0x06,0x1b,0x00,0x17,0xcf,0x1b,0x00,0x00,0x43,0x02,0x14,0xbc,0x1b,
-0x00,0x00,0xef,0x06,0x10,0xf2,0xf8,0x13,0x04,0x5d,0x03,0x24,0xf8,0x0c,0x1b,0x00,
-0x10,0x05,0x7a,0x01,0x05,0x1b,0x00,0x00,0x40,0x0c,0x05,0x1b,0x00,0x10,0x9f,0x34,
-0x01,0x04,0x1b,0x00,0x10,0x3f,0xed,0x10,0x04,0x1b,0x00,0x11,0x0d,0x6e,0x04,0x03,
-0x1b,0x00,0x11,0x07,0x76,0x01,0x03,0x1b,0x00,0x12,0x02,0xeb,0x0c,0x03,0x1b,0x00,
-0x11,0xbf,0x4b,0x02,0x03,0x1b,0x00,0x12,0x5f,0x35,0x07,0x02,0x1b,0x00,0x10,0x1e,
-0x75,0x01,0x98,0xbb,0xbb,0xbe,0xff,0xff,0xff,0xcb,0xbb,0x38,0x7f,0x0f,0x28,0xf5,
-0x9f,0x0e,0x00,0x19,0x58,0x1b,0x00,0x09,0xe1,0x16,0x19,0x56,0x1b,0x00,0x07,0x6d,
-0x01,0x05,0x7a,0x01,0x06,0xd8,0x00,0x0f,0x1b,0x00,0x3c,0x15,0x08,0x78,0x00,0x18,
-0xf7,0x4d,0x10,0x00,0x6d,0x17,0x07,0x19,0x00,0x17,0xef,0x19,0x00,0x17,0x0f,0x19,
-0x00,0x00,0xf7,0x01,0x12,0xee,0x01,0x00,0x37,0x60,0x00,0x3f,0x0f,0x05,0x18,0x05,
-0x35,0x05,0x17,0x7f,0xeb,0x02,0x18,0x09,0x1f,0x03,0x17,0xaf,0x11,0x03,0x17,0x0c,
-0x5a,0x05,0x00,0x70,0x00,0x62,0x82,0x7c,0xef,0xfd,0xb6,0x10,0x8e,0x08,0x11,0xfe,
-0x6f,0x00,0x12,0x80,0x94,0x01,0x05,0x83,0x07,0x15,0x4f,0x0d,0x00,0x15,0xe1,0xc6,
-0x12,0x01,0x1d,0x03,0x00,0x5c,0x01,0x32,0xb7,0x56,0x8d,0xc8,0x15,0x42,0x26,0xae,
-0xfd,0x30,0x7c,0x03,0x10,0xfa,0xe0,0x02,0x04,0x06,0x06,0x05,0x91,0x00,0x27,0x0f,
-0xff,0x66,0x14,0x04,0x85,0x08,0x0d,0x12,0x06,0x13,0x7f,0xba,0x06,0x04,0xc8,0x03,
-0x53,0x92,0x66,0x66,0x66,0x30,0x5a,0x02,0x14,0xf8,0xad,0x03,0x00,0x33,0x01,0x12,
-0x63,0xc8,0x11,0x01,0xaa,0x00,0x23,0xf2,0x0e,0x8e,0x04,0x10,0xbf,0x92,0x03,0x11,
-0x8f,0x70,0x08,0x01,0x36,0x08,0x21,0x70,0x01,0x42,0x04,0x1c,0xbc,0xbc,0x00,0x12,
-0xf5,0x5d,0x00,0x04,0x1d,0x12,0x26,0x00,0x06,0x82,0x01,0x05,0x70,0x08,0x12,0xb2,
-0x85,0x00,0x56,0x16,0xad,0xff,0xfe,0xb7,0x00,0x14,0x44,0x26,0x9c,0xef,0xf9,0x98,
-0x03,0x16,0xcf,0x04,0x05,0x14,0x5d,0x17,0x12,0x05,0x2a,0x12,0x01,0x19,0x00,0x03,
-0xf5,0x12,0x17,0xf9,0x6b,0x03,0x24,0xfe,0x70,0x24,0x00,0x26,0xfe,0x84,0xe7,0x04,
-0x17,0xe6,0xb7,0x03,0x17,0xd1,0xff,0x00,0x17,0xd1,0xa9,0x01,0x17,0xf3,0x69,0x13,
-0x18,0xfa,0x66,0x13,0x62,0x40,0x17,0xbe,0xfe,0xda,0x50,0x25,0x00,0x11,0xf0,0xc1,
-0x12,0x11,0xd4,0xbf,0x03,0x23,0xfd,0xcf,0xe5,0x07,0x18,0x04,0xf5,0x02,0x26,0x6f,
-0xff,0xcf,0x01,0x02,0x05,0x01,0x21,0xdb,0xcf,0xb1,0x00,0x12,0x8f,0x78,0x17,0x01,
-0x2d,0x04,0x13,0x08,0x0d,0x01,0x13,0x08,0x5e,0x03,0x14,0xfc,0x00,0x0a,0x13,0x88,
-0xad,0x01,0x00,0xa9,0x01,0x10,0xfb,0xd9,0x0a,0x04,0x53,0x04,0x14,0xd7,0x19,0x00,
-0x00,0x48,0x14,0x13,0x6f,0xf4,0x00,0x10,0x02,0x22,0x14,0x04,0x8e,0x05,0x00,0xa3,
-0x13,0x00,0x05,0x02,0x04,0xdc,0x00,0x13,0xa0,0x05,0x02,0x00,0x88,0x05,0x23,0xf7,
-0x05,0xdc,0x05,0x10,0x8f,0x0d,0x04,0x12,0x0d,0x9e,0x19,0x22,0x8f,0xff,0x1e,0x17,
-0x00,0x86,0x08,0x03,0x3c,0x14,0x18,0x9f,0xb6,0x01,0x04,0x46,0x03,0x04,0x12,0x11,
-0x06,0x6b,0x01,0x11,0x4c,0x0c,0x00,0x13,0xc4,0xf1,0x04,0x43,0x8c,0xdf,0xfe,0xc8,
-0x88,0x0b,0x06,0xc3,0x13,0x0f,0x0d,0x00,0x20,0x33,0xf5,0x6b,0xbb,0x01,0x00,0x00,
-0xf1,0x19,0x05,0x47,0x0c,0x08,0xbf,0x02,0x18,0x0a,0x8f,0x03,0x18,0x1f,0x6a,0x03,
-0x17,0x8f,0xc1,0x01,0x18,0x00,0xa1,0x06,0x18,0x07,0x04,0x09,0x18,0x0e,0xfa,0x0f,
-0x14,0x5f,0x3d,0x07,0x03,0x25,0x01,0x18,0xf1,0x11,0x09,0x18,0xa0,0x44,0x09,0x17,
-0x30,0x08,0x07,0x18,0xfc,0xf6,0x03,0x18,0xf5,0x07,0x07,0x18,0xe0,0x72,0x03,0x18,
-0x70,0x98,0x03,0x08,0x42,0x04,0x09,0x1d,0x04,0x18,0xf3,0x85,0x06,0x05,0xb3,0x00,
-0x18,0x0d,0xb3,0x00,0x18,0x4f,0xb3,0x00,0x14,0xbf,0x45,0x0d,0x03,0x16,0x02,0x18,
-0xf1,0x19,0x01,0x17,0xa0,0x19,0x01,0x06,0xb3,0x00,0x17,0x9f,0xb3,0x00,0x18,0x01,
-0xc4,0x09,0x18,0x07,0xb3,0x00,0x18,0x0e,0xb3,0x00,0x18,0x6f,0xb3,0x00,0x00,0x58,
-0x15,0x3e,0xfe,0xda,0x72,0xe5,0x0a,0x17,0xaf,0x8a,0x07,0x17,0xbf,0x97,0x07,0x17,
-0x8f,0x7d,0x1a,0x01,0xd4,0x0d,0x21,0xcb,0xdf,0x8e,0x08,0x12,0x07,0xc8,0x0d,0x11,
-0x3d,0xb7,0x00,0x00,0x21,0x12,0x04,0x0e,0x09,0x04,0xef,0x00,0x10,0xaf,0xdd,0x00,
-0x00,0x28,0x08,0x04,0xe1,0x0a,0x17,0x0d,0xe1,0x0d,0x13,0x00,0xa3,0x0d,0x01,0xd3,
-0x0a,0x12,0x05,0xee,0x0d,0x11,0x02,0x4b,0x00,0x11,0x0d,0x16,0x18,0x03,0x0b,0x09,
-0x14,0x3f,0x00,0x0d,0x1b,0xfc,0x5e,0x0e,0x02,0xbc,0x19,0x03,0xf2,0x01,0x13,0x02,
-0xb0,0x00,0x17,0x80,0x9c,0x04,0x27,0xff,0xd2,0x0c,0x00,0x21,0xff,0xe1,0x5d,0x00,
-0x41,0xfc,0x41,0x02,0x7e,0x99,0x01,0x00,0x0f,0x20,0x03,0x7a,0x0a,0x10,0x60,0x81,
-0x03,0x03,0x3f,0x02,0x24,0xfc,0x07,0x8a,0x04,0x00,0x8a,0x00,0x17,0x9f,0x5e,0x0e,
-0x17,0x4a,0xe1,0x0d,0x27,0xf5,0x9f,0xe1,0x0d,0x13,0x48,0xa9,0x0e,0x01,0x58,0x05,
-0x17,0x5f,0x3f,0x01,0x12,0x00,0x96,0x06,0x01,0x1e,0x05,0x35,0xa0,0x08,0xff,0xc8,
-0x0d,0x11,0xf3,0x93,0x0b,0x05,0x8a,0x03,0x18,0x2e,0xad,0x0a,0x18,0x2d,0xa2,0x03,
-0x12,0x07,0xdd,0x06,0x12,0xc5,0xaa,0x01,0x64,0x58,0xce,0xff,0xed,0xb7,0x30,0x8a,
-0x0f,0x15,0xef,0x64,0x05,0x11,0x2b,0x25,0x00,0x18,0xa2,0xf4,0x09,0x1c,0xf5,0xdf,
-0x0a,0x17,0x5f,0xa5,0x0c,0x01,0x7d,0x00,0x12,0xcc,0xa6,0x17,0x12,0x08,0x01,0x04,
-0x11,0x8f,0xb0,0x01,0x03,0x0d,0x04,0x10,0x8f,0x8a,0x00,0x13,0x5f,0x13,0x01,0x00,
-0x64,0x0f,0x01,0xd4,0x0a,0x04,0x05,0x03,0x00,0xfe,0x00,0x03,0x38,0x03,0x23,0xfb,
-0x0d,0x73,0x15,0x01,0xab,0x0f,0x03,0xe7,0x01,0x01,0x1e,0x03,0x04,0xe7,0x01,0x01,
-0xf4,0x0e,0x04,0x32,0x00,0x00,0x19,0x00,0x18,0x1a,0x5e,0x01,0x04,0x95,0x02,0x00,
-0xd5,0x01,0x13,0x12,0xdf,0x0a,0x10,0x3e,0x32,0x00,0x12,0x0b,0xa9,0x01,0x01,0x77,
-0x02,0x07,0x4c,0x07,0x27,0xff,0xf0,0x3b,0x0a,0x17,0xfd,0xa3,0x02,0x23,0xff,0xb0,
-0xce,0x04,0x13,0xfd,0x01,0x04,0x10,0x3a,0x0e,0x1e,0x14,0x06,0x74,0x03,0x57,0x35,
-0x65,0x20,0x00,0xbf,0x5a,0x03,0x17,0x1f,0xde,0x0c,0x17,0x0a,0x99,0x03,0x17,0x08,
-0x3f,0x03,0x16,0x1a,0x58,0x03,0x24,0x25,0xaf,0x7b,0x0b,0x03,0x25,0x0c,0x02,0xe9,
-0x0c,0x17,0x9f,0xad,0x1a,0x02,0x19,0x00,0x03,0x9b,0x15,0x17,0x9f,0xda,0x06,0x16,
-0x09,0x9b,0x01,0x00,0x19,0x00,0x23,0xdb,0x85,0xe9,0x03,0x40,0xbf,0xfb,0x30,0x03,
-0x88,0x06,0x00,0x35,0x03,0x14,0x0e,0xf6,0x12,0x10,0x08,0x28,0x02,0x9f,0x0b,0xff,
-0xff,0xc1,0x00,0x04,0x88,0x40,0x00,0x01,0x00,0x1f,0x30,0x04,0x78,0x40,0x4d,0x03,
-0x11,0xc0,0x6a,0x03,0x00,0xa2,0x03,0x01,0x5a,0x00,0x00,0x27,0x1a,0x01,0x6c,0x00,
-0x91,0x03,0xbf,0xfc,0x40,0x00,0x00,0x07,0xdf,0xe9,0xa3,0x00,0x20,0xd0,0x02,0xe9,
-0x06,0x10,0x05,0xab,0x00,0x11,0x04,0x45,0x03,0x01,0xbc,0x04,0x11,0x4f,0xb1,0x02,
-0x3f,0x68,0x72,0x00,0x01,0x00,0x2f,0x50,0x07,0x77,0x77,0x60,0x00,0x21,0x23,0x0f,
-0x05,0x00,0x02,0x00,0xfb,0x16,0x00,0x2c,0x04,0x10,0xa0,0xb3,0x02,0x10,0x60,0x0b,
-0x04,0x23,0x10,0x01,0x53,0x04,0x01,0x1f,0x03,0x50,0x90,0x00,0x5f,0xff,0xfd,0xd7,
-0x03,0x16,0xe2,0xcc,0x19,0x0d,0x01,0x00,0x35,0x03,0xa5,0x00,0x5a,0x08,0x04,0x05,
-0x05,0x15,0x18,0x14,0x13,0x15,0x4a,0xc3,0x01,0x14,0x6d,0x07,0x03,0x24,0x02,0x8f,
-0x12,0x03,0x13,0x04,0x3d,0x02,0x14,0xf4,0x76,0x1a,0x43,0xff,0xd8,0x20,0x29,0xdf,
-0x01,0x14,0x93,0x5b,0x02,0x24,0xfa,0x50,0x09,0x05,0x14,0xc6,0xac,0x05,0x26,0xfe,
-0x71,0xee,0x1e,0x26,0xc6,0x10,0xf9,0x1e,0x27,0xfb,0x50,0x53,0x07,0x16,0xa4,0x51,
-0x20,0x73,0xff,0xe9,0x30,0x00,0x00,0x01,0x7e,0xb4,0x02,0x00,0x94,0x20,0x17,0x5c,
-0xa3,0x03,0x17,0x29,0x57,0x0b,0x26,0x17,0xdf,0x73,0x02,0x26,0x04,0xbf,0xd6,0x05,
-0x26,0x02,0x9f,0xe1,0x05,0x36,0x00,0x6d,0xf5,0xfe,0x00,0x17,0x43,0x61,0x1b,0x26,
-0x2a,0xff,0x87,0x10,0x0f,0x17,0x00,0x0f,0x25,0x28,0xcc,0x01,0x00,0x1f,0xc1,0xd5,
-0x01,0x1b,0x16,0x8c,0x3a,0x00,0x1f,0x1a,0x73,0x00,0x1a,0x08,0x17,0x00,0x27,0x0c,
-0x50,0x38,0x1f,0x18,0xe8,0xfd,0x07,0x17,0xa3,0xd6,0x06,0x27,0xfd,0x60,0xf6,0x1d,
-0x12,0xe8,0xde,0x20,0x02,0x41,0x00,0x14,0xb4,0x4e,0x04,0x00,0x26,0x00,0x13,0x71,
-0xc6,0x12,0x01,0x75,0x03,0x10,0x30,0x7f,0x0a,0x03,0xbf,0x12,0x15,0xc5,0x55,0x01,
-0x04,0x95,0x07,0x27,0x28,0xdf,0xc9,0x21,0x16,0x39,0x8c,0x10,0x15,0x4a,0x17,0x00,
-0x24,0x39,0xef,0x2e,0x00,0x02,0x2c,0x00,0x00,0xdf,0x04,0x13,0x17,0x50,0x00,0x15,
-0xd6,0x67,0x00,0x24,0xfa,0x40,0x8a,0x00,0x25,0xfe,0x81,0x97,0x1e,0x15,0xc5,0xa1,
-0x00,0x24,0xfa,0x30,0xb8,0x00,0x25,0xfe,0x71,0xcf,0x00,0x15,0xc5,0xe6,0x00,0x16,
-0xf9,0xcd,0x02,0x06,0x1a,0x1e,0x0a,0x7b,0x12,0x12,0x05,0x7d,0x00,0x13,0xa1,0xa0,
-0x04,0x03,0x7b,0x23,0x16,0x0a,0x95,0x10,0x15,0x07,0x4d,0x01,0x11,0xd0,0x01,0x0d,
-0x02,0xb8,0x0a,0x21,0x50,0x5f,0x38,0x07,0x10,0x06,0x84,0x00,0x12,0x0a,0x95,0x06,
-0x01,0x12,0x08,0x12,0xcf,0xc6,0x06,0x00,0x9a,0x07,0x53,0x0c,0xee,0xee,0xee,0x30,
-0x7f,0x05,0x07,0x5b,0x08,0x07,0x1b,0x0d,0x16,0xd0,0x85,0x0d,0x17,0xf7,0x1b,0x12,
-0x05,0xb6,0x16,0x07,0xd0,0x19,0x05,0xa0,0x08,0x16,0xaf,0xeb,0x08,0x02,0x82,0x0a,
-0x05,0x62,0x10,0x16,0xb0,0x72,0x09,0x16,0xa0,0xca,0x09,0x16,0xd0,0x09,0x09,0x17,
-0xf5,0x2e,0x09,0x07,0x53,0x09,0x14,0xc0,0x17,0x00,0x3f,0xdd,0xdd,0xd9,0x9f,0x02,
-0x18,0x25,0x05,0x76,0x5d,0x01,0x16,0x2d,0xfe,0x08,0x16,0x0c,0xf6,0x01,0x26,0x02,
-0xff,0x2e,0x0d,0x1a,0x3f,0x95,0x00,0x16,0xf7,0x06,0x06,0x05,0xe3,0x12,0x36,0x06,
-0xdf,0xea,0x36,0x09,0x01,0xcc,0x0c,0x4a,0xde,0xff,0xed,0xa7,0x9c,0x05,0x13,0x6c,
-0x0b,0x02,0x17,0xa3,0x14,0x00,0x15,0x7e,0xa0,0x01,0x15,0xb2,0x14,0x00,0x1a,0x3d,
-0xfe,0x1e,0x05,0xf6,0x00,0x79,0xfc,0x74,0x10,0x00,0x13,0x59,0xef,0xd7,0x20,0x03,
-0x24,0x02,0x24,0x04,0xcf,0xa2,0x00,0x17,0x08,0x53,0x21,0x14,0x06,0xe5,0x0a,0x17,
-0x5f,0x51,0x12,0x00,0x39,0x07,0x12,0x40,0xe1,0x00,0x17,0xf9,0x21,0x05,0x02,0x6c,
-0x01,0x17,0x0c,0x4a,0x0a,0x01,0x25,0x08,0x16,0xf6,0x32,0x19,0x51,0x03,0x9d,0xff,
-0xec,0x82,0x24,0x00,0x11,0xfe,0xc1,0x0a,0x24,0xf3,0x00,0x9a,0x1f,0x11,0xa2,0x37,
-0x0b,0x01,0xc2,0x14,0x13,0xa0,0x9a,0x07,0x02,0xa7,0x0f,0x00,0x3f,0x28,0x11,0x0d,
-0xfa,0x07,0x04,0x11,0x1c,0x10,0x80,0xb6,0x00,0x52,0xe0,0x00,0x3f,0xff,0xfb,0x14,
-0x09,0x31,0xfb,0x75,0x6c,0xe5,0x00,0x20,0x3f,0xff,0x4b,0x1c,0x14,0xf5,0xbb,0x1e,
-0x11,0x09,0x6c,0x07,0x71,0x0f,0xff,0xf5,0x00,0xdf,0xff,0xf0,0xac,0x00,0x11,0xf6,
-0xd7,0x02,0x10,0x40,0x35,0x00,0x21,0xf7,0x01,0x2f,0x02,0x11,0x09,0xfd,0x01,0x11,
-0x0c,0x5f,0x00,0x11,0x0c,0x9c,0x06,0x11,0x80,0xed,0x03,0x11,0x50,0x59,0x00,0x10,
-0x10,0x4c,0x02,0x20,0xfa,0x07,0x0f,0x00,0x00,0xff,0x00,0x02,0x08,0x04,0x01,0x27,
-0x03,0x21,0xfb,0x0a,0x33,0x00,0x31,0xaf,0xff,0xfb,0x15,0x00,0x12,0xfe,0x15,0x00,
-0x11,0x0b,0x1e,0x00,0x11,0xdf,0x31,0x01,0x11,0x1f,0xf1,0x00,0x11,0x0a,0x67,0x1a,
-0x01,0xf3,0x01,0x11,0xf5,0x05,0x02,0x11,0xfb,0xa0,0x02,0x20,0xf9,0x0d,0x33,0x00,
-0x12,0x03,0xfd,0x03,0x10,0x4f,0x8c,0x01,0x00,0x93,0x00,0x01,0x15,0x00,0x14,0x04,
-0xbb,0x15,0x21,0xf8,0x00,0xbd,0x00,0x01,0x15,0x00,0x12,0x05,0x41,0x03,0x00,0xb8,
-0x29,0x01,0xe7,0x00,0x04,0x15,0x00,0x11,0xf2,0xec,0x00,0x11,0xf6,0x1b,0x00,0x11,
-0xe0,0x93,0x1d,0x11,0x03,0xce,0x10,0x11,0x01,0x6f,0x00,0x00,0xd4,0x27,0x01,0xa8,
-0x00,0x11,0x01,0xa7,0x01,0x01,0x60,0x1b,0x01,0x9a,0x23,0x12,0x08,0x59,0x01,0x00,
-0xa8,0x02,0x02,0x0a,0x0e,0x30,0x2f,0xff,0xfc,0x4f,0x00,0x12,0x80,0x0f,0x02,0x21,
-0x7b,0xff,0x24,0x0b,0x30,0xef,0xff,0xf2,0x35,0x01,0x14,0xc0,0x74,0x04,0x15,0xed,
-0xcf,0x26,0x34,0xef,0xff,0xf1,0x30,0x23,0x15,0x44,0x15,0x0b,0x33,0x9f,0xff,0xf8,
-0x13,0x0a,0x11,0xe3,0x01,0x0a,0x25,0xfe,0x50,0x82,0x1a,0xce,0x02,0x9d,0xfe,0xc6,
-0x00,0x00,0x02,0x8d,0xff,0xdb,0x50,0x00,0x21,0x02,0x05,0x34,0x0d,0x1e,0xf6,0x63,
-0x03,0x17,0xbf,0xc9,0x0c,0x17,0x00,0x63,0x16,0x1f,0xf7,0x40,0x00,0x01,0x05,0xbd,
-0x1b,0x19,0x30,0xf4,0x22,0x10,0xd8,0xaa,0x02,0x36,0x14,0x8d,0xf3,0x2b,0x00,0x11,
-0xef,0xcf,0x00,0x29,0xcc,0xdf,0x48,0x00,0x06,0x62,0x06,0x17,0xfb,0x57,0x00,0x18,
-0x3b,0xd1,0x0e,0x05,0x01,0x00,0x12,0x27,0x9c,0x05,0x2a,0xb7,0x10,0x84,0x00,0x5d,
-0x24,0x66,0x77,0x65,0x20,0x28,0x1f,0x0a,0xc2,0x00,0x16,0x2f,0xa8,0x04,0x06,0xc4,
-0x04,0x05,0x2d,0x0a,0x03,0xd7,0x0d,0x09,0xe0,0x00,0x15,0x04,0x95,0x2a,0x09,0xba,
-0x23,0x07,0x12,0x26,0x16,0x0f,0xd2,0x10,0x06,0xf7,0x00,0x07,0x9d,0x0d,0x04,0x62,
-0x08,0x28,0xf5,0x00,0xc9,0x0d,0x18,0xdf,0xea,0x00,0x00,0xbb,0x05,0x18,0x6c,0xb7,
-0x0d,0x00,0x55,0x0b,0x18,0x17,0xd5,0x0d,0x00,0xbb,0x0e,0x18,0x02,0x66,0x0e,0x01,
-0x0d,0x1b,0x00,0xb2,0x0b,0x07,0xb9,0x00,0x12,0xf1,0x6c,0x0d,0x06,0xb9,0x00,0x11,
-0xc0,0x70,0x10,0x09,0x88,0x16,0x16,0x0d,0x7f,0x13,0x11,0x0f,0xf4,0x06,0x16,0x08,
-0x1b,0x05,0x11,0x6f,0xea,0x00,0x16,0x03,0x98,0x12,0x12,0xcf,0x4f,0x00,0x14,0xdf,
-0x1e,0x02,0x01,0xf7,0x0c,0x04,0x37,0x0c,0x04,0x47,0x0b,0x00,0x76,0x04,0x05,0xba,
-0x29,0x01,0xe8,0x18,0x03,0x92,0x0e,0x14,0x80,0x7a,0x05,0x06,0xc1,0x06,0x08,0x48,
-0x2a,0x04,0x95,0x07,0x1b,0xef,0x3c,0x24,0x2b,0x05,0xff,0x76,0x2b,0x19,0x0b,0x11,
-0x00,0x17,0x50,0x6c,0x1c,0x04,0x11,0x0c,0x15,0x7f,0x92,0x01,0x12,0x08,0xd0,0x01,
-0x15,0xcf,0xb4,0x01,0x11,0x03,0xd0,0x01,0x17,0x02,0x44,0x02,0x01,0x6b,0x1b,0x04,
-0xa5,0x19,0x04,0x04,0x02,0x27,0x30,0x0e,0xac,0x06,0x10,0x2f,0xd0,0x01,0x17,0x4f,
-0x7f,0x01,0x10,0x0d,0xd0,0x01,0x17,0xaf,0x9e,0x2a,0x10,0x07,0xd0,0x01,0x03,0x37,
-0x08,0x48,0xed,0xb8,0x40,0x00,0x1c,0x1a,0x21,0xe9,0x10,0x64,0x00,0x06,0x00,0x06,
-0x17,0x0d,0xad,0x00,0x18,0x70,0x1b,0x00,0x39,0xff,0x40,0x0d,0xfa,0x2c,0x03,0x10,
-0x18,0x20,0x15,0xbf,0x1b,0x01,0x04,0x4a,0x01,0x01,0x9f,0x00,0x15,0x80,0x2b,0x18,
-0x00,0x3d,0x06,0x05,0x1b,0x00,0x13,0x0a,0xf2,0x25,0x14,0xf8,0xa6,0x07,0x19,0xfb,
-0x1b,0x00,0x18,0x90,0x36,0x00,0x18,0xf5,0x51,0x00,0x15,0xfe,0x6c,0x00,0x01,0xb6,
-0x21,0x08,0x87,0x00,0x1f,0x90,0xbd,0x00,0x06,0x19,0x60,0xd8,0x00,0x39,0xd4,0x00,
-0x0d,0x2f,0x16,0x00,0xf4,0x2b,0x59,0x44,0x44,0x44,0x56,0xaf,0xbd,0x00,0x19,0x3e,
-0xa2,0x00,0x00,0x1a,0x03,0x15,0x2d,0x12,0x12,0x00,0x95,0x0c,0x05,0x1b,0x00,0x00,
-0xab,0x03,0x15,0x8d,0x1b,0x00,0x00,0x7b,0x1c,0x05,0x1b,0x00,0x18,0x0d,0x1b,0x00,
-0x19,0x03,0x36,0x00,0x00,0xbe,0x00,0x13,0x3d,0x1b,0x00,0x01,0x83,0x2c,0x22,0xe0,
-0xdf,0x0c,0x16,0x11,0xef,0xb1,0x14,0x08,0xa2,0x00,0x18,0xfe,0xbd,0x00,0x37,0xfe,
-0x20,0x0d,0x79,0x01,0x17,0x20,0x1b,0x00,0x16,0xd7,0xcb,0x01,0x25,0xed,0xb8,0x58,
-0x18,0x79,0x6a,0xde,0xff,0xec,0xa6,0x20,0x00,0x59,0x1a,0x28,0xfb,0x40,0x76,0x2c,
-0x04,0xd4,0x07,0x18,0x0c,0x1c,0x16,0x04,0xd7,0x14,0x04,0xc7,0x10,0x1a,0x09,0xb7,
-0x02,0x10,0x4f,0x13,0x08,0x42,0x62,0x00,0x25,0xbf,0x1e,0x04,0x13,0xdf,0x72,0x02,
-0x11,0x04,0x0d,0x02,0x02,0xaa,0x0d,0x04,0xe9,0x0f,0x11,0x30,0x27,0x21,0x05,0x0f,
-0x01,0x25,0x90,0x0f,0x9e,0x02,0x13,0x08,0x34,0x1f,0x25,0xff,0x20,0xd8,0x09,0x25,
-0xf0,0x8f,0xf6,0x03,0x6a,0x01,0x66,0x66,0x66,0x60,0xaf,0x56,0x05,0x18,0xcf,0xc7,
-0x12,0x01,0x77,0x00,0x1a,0xf9,0x01,0x05,0x1f,0xf8,0x0f,0x00,0x25,0x1a,0xcf,0x4b,
-0x00,0x1a,0xbf,0x0f,0x00,0x0b,0x87,0x00,0x16,0x8f,0x58,0x05,0x55,0x33,0x33,0x33,
-0x30,0x4f,0x00,0x05,0x14,0x05,0x61,0x1a,0x16,0x60,0x64,0x04,0x15,0x0b,0xfc,0x04,
-0x10,0x0d,0xb0,0x04,0x13,0x05,0x9f,0x1d,0x02,0x53,0x02,0x11,0x40,0x44,0x04,0x13,
-0x50,0x3b,0x01,0x12,0xfe,0x15,0x00,0x22,0xfb,0x51,0x59,0x01,0x17,0xf7,0x4e,0x0b,
-0x02,0x44,0x01,0x27,0x01,0xdf,0x08,0x02,0x04,0xe6,0x28,0x06,0x40,0x1b,0x15,0x01,
-0x3a,0x15,0x15,0x10,0x9a,0x09,0x06,0xef,0x01,0x00,0x90,0x11,0x14,0xdf,0x0d,0x02,
-0x12,0xdf,0x28,0x02,0x24,0xa7,0x20,0x49,0x01,0x02,0xdc,0x11,0x18,0x50,0x0e,0x00,
-0x38,0xff,0xfd,0x30,0x0e,0x00,0x01,0xb7,0x00,0x07,0x8a,0x02,0x19,0x80,0x0e,0x00,
-0x23,0xf6,0x00,0x99,0x03,0x22,0x13,0x8e,0x66,0x06,0x03,0xea,0x02,0x12,0x01,0x77,
-0x0b,0x04,0xf8,0x02,0x23,0x0a,0xff,0xfe,0x05,0x16,0xf8,0xd2,0x04,0x09,0x65,0x03,
-0x15,0x30,0x0e,0x00,0x19,0x0e,0x3e,0x04,0x10,0x09,0x02,0x01,0x05,0x0e,0x00,0x10,
-0x06,0x69,0x01,0x05,0x0e,0x00,0x10,0x03,0x13,0x05,0x05,0x0e,0x00,0x10,0x02,0x31,
-0x0f,0x05,0x0e,0x00,0x1d,0x01,0x0e,0x00,0x1e,0xf5,0x0e,0x00,0x0e,0x2a,0x00,0x0b,
-0x46,0x00,0x19,0x04,0x62,0x00,0x0a,0x7e,0x00,0x19,0x0a,0x9a,0x00,0x19,0x0e,0xbe,
-0x04,0x01,0xe4,0x01,0x08,0xcc,0x04,0x1e,0xfd,0x0a,0x01,0x05,0x26,0x01,0x13,0xd0,
-0x0e,0x00,0x22,0x03,0x8e,0xc3,0x0a,0x01,0x11,0x04,0x14,0xef,0xc1,0x18,0x18,0xdf,
-0xe9,0x04,0x07,0x0e,0x00,0x1f,0xf7,0xb2,0x01,0x06,0x2e,0xfd,0x50,0xea,0x01,0x08,
-0xc4,0x05,0x0f,0x0c,0x00,0x28,0x27,0xfe,0xdf,0x3f,0x03,0x0f,0x0c,0x00,0x50,0x05,
-0x65,0x07,0x0f,0x0c,0x00,0x20,0x12,0xfe,0x0a,0x10,0x2f,0xc6,0x00,0xb4,0x00,0x5d,
-0x13,0xee,0x01,0x00,0x0f,0x74,0x01,0x34,0x1f,0xf5,0x0c,0x00,0x28,0x1f,0xf4,0xfc,
-0x00,0x63,0x1f,0xe8,0xbc,0x01,0x2d,0x0e,0xb4,0x00,0x0f,0x0c,0x00,0x8c,0x01,0x01,
-0x00,0x64,0x59,0xce,0xff,0xed,0xb8,0x50,0x82,0x07,0x03,0x37,0x0a,0x18,0x92,0xfd,
-0x20,0x04,0x04,0x07,0x18,0x0a,0x63,0x17,0x09,0x8d,0x2e,0x17,0x90,0xcb,0x1c,0x02,
-0xca,0x1f,0x10,0x2f,0x78,0x03,0x21,0x72,0x00,0x1a,0x18,0x03,0x72,0x25,0x14,0xc1,
-0xa4,0x0b,0x25,0x40,0x02,0xec,0x0b,0x14,0x0d,0xc8,0x17,0x15,0xf4,0xac,0x04,0x26,
-0xe0,0x0d,0x80,0x0b,0x12,0xff,0x1d,0x38,0x04,0x21,0x0a,0x46,0x56,0x66,0x66,0x61,
-0x83,0x07,0x05,0xe0,0x30,0x07,0xcd,0x00,0x1a,0x9f,0x45,0x0c,0x18,0xaf,0x8a,0x1a,
-0x05,0x0f,0x00,0x21,0x04,0x66,0x01,0x00,0x33,0x61,0xbf,0xff,0xaa,0x0e,0x02,0xb5,
-0x00,0x0e,0x0f,0x00,0x17,0xfc,0x0f,0x00,0x1a,0xaf,0x0f,0x00,0x03,0x69,0x00,0x04,
-0x0f,0x00,0x07,0x87,0x00,0x00,0x0f,0x00,0x16,0x4f,0xbb,0x0c,0x00,0x0f,0x00,0x07,
-0xc3,0x00,0x00,0x0f,0x00,0x16,0x0d,0x04,0x0b,0x00,0x0f,0x00,0x15,0x08,0x65,0x07,
-0x01,0x0f,0x00,0x16,0x01,0xdf,0x23,0x01,0x18,0x01,0x14,0x9f,0xe1,0x30,0x11,0x05,
-0x0f,0x00,0x13,0x1f,0x0e,0x15,0x01,0xbe,0x0a,0x14,0xf4,0xc6,0x0b,0x14,0xef,0x78,
-0x01,0x08,0x2b,0x1c,0x18,0xc0,0xf1,0x1f,0x02,0xb4,0x01,0x15,0x4e,0x14,0x05,0x18,
-0x50,0x56,0x11,0x14,0xfc,0x00,0x02,0x79,0x38,0xbd,0xff,0xfe,0xdb,0x85,0x10,0x28,
-0x02,0x01,0x43,0x1b,0x0f,0x0f,0x00,0xc2,0x07,0x01,0x00,0x0f,0x0f,0x00,0x3c,0x0f,
-0x3b,0x01,0xcb,0x00,0x29,0x08,0x0f,0x04,0x00,0x79,0x08,0x53,0x1e,0x1e,0xd0,0xf8,
-0x0a,0x0f,0x19,0x00,0xff,0x08,0x04,0x2f,0x11,0x13,0x8f,0x34,0x1b,0x14,0x70,0x59,
-0x16,0x00,0x5e,0x3d,0x03,0x66,0x0a,0x23,0xf8,0x08,0x42,0x10,0x00,0xc4,0x05,0x01,
-0x3f,0x0c,0x41,0xe6,0x10,0x02,0xbf,0x57,0x00,0x15,0xcf,0x7b,0x04,0x17,0xf5,0xdf,
-0x21,0x17,0xfb,0x23,0x1e,0x17,0xfc,0x3c,0x1e,0x17,0xfb,0xd5,0x0d,0x14,0xd5,0xd8,
-0x22,0x48,0xef,0xfe,0xc8,0x40,0x6e,0x04,0x11,0x09,0x02,0x0f,0x09,0x93,0x0a,0x06,
-0x5c,0x07,0x29,0x02,0xff,0x9f,0x0b,0x12,0x0d,0x39,0x1c,0x04,0x0f,0x00,0x12,0xaf,
-0x02,0x05,0x17,0xdf,0x4e,0x23,0x15,0x70,0x0f,0x00,0x13,0x3f,0x02,0x05,0x02,0x0f,
-0x00,0x01,0x6f,0x2a,0x15,0xd0,0x0f,0x00,0x12,0x0b,0x97,0x18,0x04,0x0f,0x00,0x14,
-0x7f,0x90,0x06,0x01,0x0f,0x00,0x27,0x04,0xff,0x1d,0x2d,0x11,0xf8,0xeb,0x1d,0x16,
-0xfb,0x4a,0x07,0x15,0xbf,0x20,0x23,0x00,0x0f,0x00,0x14,0x07,0x49,0x00,0x02,0x0f,
-0x00,0x16,0x3f,0x8f,0x12,0x00,0x0f,0x00,0x16,0xdf,0xc0,0x12,0x18,0xdf,0x58,0x07,
-0x06,0x0f,0x00,0x2a,0xf2,0x00,0xe2,0x0c,0x0b,0x53,0x0a,0x1a,0x70,0x0f,0x00,0x16,
-0xf2,0x0f,0x00,0x18,0xfd,0x96,0x00,0x35,0xff,0xff,0x72,0x12,0x17,0x11,0xdf,0xdf,
-0x0e,0x14,0x7f,0x7f,0x13,0x02,0x83,0x00,0x14,0x0d,0x2e,0x00,0x02,0x1e,0x13,0x13,
-0x03,0xf0,0x11,0x04,0x2c,0x01,0x13,0x9f,0x21,0x38,0x03,0x0f,0x00,0x19,0x0e,0x3b,
-0x01,0x25,0x00,0x05,0xb3,0x16,0x06,0x77,0x01,0x16,0xe0,0x0f,0x00,0x12,0x1f,0x5f,
-0x12,0x04,0x0f,0x00,0x19,0x06,0x60,0x0d,0x02,0xa9,0x0f,0x04,0x3b,0x0c,0x03,0x03,
-0x12,0x16,0xf8,0x0f,0x00,0x29,0x08,0xff,0x55,0x0d,0x01,0xaf,0x00,0x1f,0xc0,0x5a,
-0x09,0xa1,0x0f,0x0c,0x00,0xa4,0x04,0x06,0x0c,0x27,0xe0,0xdf,0x22,0x20,0x0f,0x0c,
-0x00,0x21,0x18,0xfe,0x80,0x23,0x01,0x64,0x12,0x06,0x8e,0x28,0x16,0x09,0x13,0x00,
-0x18,0x90,0x29,0x2a,0x02,0x13,0x00,0x18,0xf0,0x49,0x2a,0x28,0xf9,0xdf,0xd2,0x15,
-0x16,0x9f,0x13,0x00,0x06,0x73,0x31,0x05,0x13,0x00,0x17,0xff,0x49,0x16,0x04,0x13,
-0x00,0x15,0x50,0xf4,0x0e,0x05,0x13,0x00,0x17,0xb0,0x4d,0x16,0x00,0x13,0x00,0x01,
-0xd0,0x15,0x03,0x6b,0x04,0x12,0xef,0x13,0x00,0x13,0xdc,0x90,0x09,0x00,0xdd,0x03,
-0x12,0x9f,0x13,0x00,0x13,0xd6,0x8d,0x03,0x00,0x11,0x05,0x12,0x4f,0x13,0x00,0x12,
-0xe1,0x49,0x11,0x00,0xe2,0x02,0x22,0xfc,0x3f,0x13,0x00,0x25,0xf0,0xbf,0x43,0x05,
-0x14,0xf6,0x13,0x00,0x02,0x3e,0x2a,0x00,0x17,0x03,0x13,0xf1,0x39,0x00,0x00,0xe3,
-0x42,0x12,0xf2,0xbb,0x0a,0x22,0xb0,0x5f,0x13,0x00,0x22,0xf1,0x0a,0x88,0x01,0x12,
-0xcf,0x72,0x1c,0x01,0x13,0x00,0x11,0x04,0xad,0x05,0x00,0xf3,0x04,0x01,0xc0,0x18,
-0x01,0x84,0x16,0x10,0xef,0x4c,0x03,0x10,0x07,0x61,0x03,0x12,0x7f,0x13,0x00,0x33,
-0xf3,0x00,0x8f,0xd1,0x03,0x14,0xf4,0x13,0x00,0x12,0xf4,0xbc,0x3a,0x10,0x2f,0x05,
-0x00,0x14,0x8f,0x13,0x00,0x01,0x21,0x00,0x10,0x8f,0xc8,0x04,0x03,0xd1,0x00,0x12,
-0xf5,0x47,0x00,0x01,0x0d,0x39,0x03,0x13,0x00,0x10,0xf6,0x6d,0x00,0x24,0xfe,0x03,
-0xb0,0x0b,0x24,0xf9,0xdf,0x2d,0x2b,0x11,0x49,0xb8,0x0f,0x12,0xbf,0x13,0x00,0x11,
-0xf7,0x16,0x0c,0x11,0xae,0x36,0x01,0x06,0x13,0x00,0x14,0x1f,0x71,0x0a,0x06,0x52,
-0x14,0x14,0x0b,0xcd,0x14,0x06,0x13,0x00,0x02,0xad,0x0a,0x19,0x10,0x78,0x14,0x04,
-0xce,0x01,0x07,0x13,0x00,0x13,0xaf,0xf4,0x01,0x07,0x13,0x00,0x13,0x4f,0x1a,0x02,
-0x07,0x13,0x00,0x04,0x6f,0x29,0x07,0x13,0x00,0x13,0x08,0x66,0x02,0x07,0x13,0x00,
-0x13,0x03,0x8c,0x02,0x08,0xea,0x14,0x02,0xbc,0x1a,0x04,0x13,0x00,0x1b,0xfc,0x14,
-0x0a,0x1a,0x60,0x0f,0x00,0x1a,0xe1,0x0f,0x00,0x1b,0xf9,0x41,0x0a,0x1a,0x30,0x0f,
-0x00,0x1a,0xc0,0x0f,0x00,0x1a,0xf6,0x0f,0x00,0x2a,0xfe,0x10,0x7d,0x0a,0x1a,0x90,
-0x0f,0x00,0x1a,0xf3,0x0f,0x00,0x1b,0xfc,0xaa,0x0a,0x16,0x60,0x0f,0x00,0x12,0xfd,
-0x99,0x00,0x05,0x9c,0x09,0x02,0x11,0x14,0x05,0x0f,0x00,0x11,0x3f,0x99,0x00,0x05,
-0x0f,0x00,0x11,0x09,0x99,0x00,0x05,0x0f,0x00,0x00,0xfd,0x06,0x17,0xf6,0xd8,0x09,
-0x01,0x34,0x24,0x06,0x0f,0x00,0x10,0x0c,0x00,0x08,0x06,0x0f,0x00,0x10,0x03,0x99,
-0x00,0x07,0x05,0x0a,0x00,0xf9,0x0c,0x07,0x0f,0x00,0x14,0x1e,0x06,0x2b,0x02,0x0f,
-0x00,0x10,0x06,0xbb,0x01,0x07,0x32,0x0a,0x00,0x21,0x18,0x07,0x0f,0x00,0x1a,0x2f,
-0x22,0x0b,0x1b,0x09,0x31,0x0b,0x1a,0xef,0x0f,0x00,0x1a,0x5f,0x0f,0x00,0x1a,0x0c,
-0x0f,0x00,0x1b,0x02,0x6d,0x0b,0x1a,0x9f,0x0f,0x00,0x1a,0x0e,0x0f,0x00,0x1b,0x05,
-0x9a,0x0b,0x1a,0xcf,0x0f,0x00,0x1a,0x2f,0x0f,0x00,0x03,0xdf,0x18,0x03,0x42,0x20,
-0x15,0xa6,0x30,0x1a,0x03,0x3e,0x26,0x13,0xb3,0x0f,0x00,0x1a,0x4e,0x3e,0x3f,0x17,
-0x8f,0xea,0x16,0x09,0xea,0x29,0x01,0xcf,0x0d,0x1a,0x5f,0x43,0x31,0x01,0x32,0x03,
-0x42,0x94,0x21,0x37,0xcf,0x80,0x16,0x14,0x0a,0xe2,0x3f,0x11,0x7f,0xd9,0x07,0x15,
-0x02,0x16,0x32,0x11,0x6f,0x38,0x1a,0x15,0x9f,0x51,0x0e,0x10,0xbf,0xae,0x01,0x15,
-0x0e,0x4d,0x1a,0x01,0xa8,0x17,0x16,0x03,0x25,0x05,0x01,0x51,0x0f,0x07,0x8e,0x0e,
-0x00,0xa3,0x16,0x01,0x8e,0x14,0x06,0x8f,0x20,0x17,0xf1,0x99,0x16,0x13,0x3f,0xd9,
-0x17,0x26,0x90,0x00,0x48,0x14,0x07,0x6d,0x16,0x00,0xa5,0x00,0x17,0x5e,0x5b,0x2a,
-0x00,0x68,0x00,0x07,0x1f,0x00,0x1a,0x0f,0x1f,0x00,0x04,0xa2,0x14,0x17,0xf9,0xe0,
-0x19,0x16,0x4c,0xf7,0x1a,0x01,0x4a,0x02,0x07,0xa1,0x0f,0x13,0x5f,0x7d,0x1b,0x17,
-0xf0,0x2b,0x26,0x16,0x3f,0x4a,0x1c,0x01,0xdd,0x44,0x15,0xef,0xcc,0x16,0x01,0x5d,
-0x31,0x15,0x09,0x62,0x22,0x11,0x0b,0xa2,0x01,0x14,0x2f,0x7e,0x09,0x12,0x05,0x86,
-0x01,0x04,0x67,0x10,0x12,0x06,0x88,0x09,0x11,0x01,0xd4,0x1c,0x33,0x31,0x02,0x5b,
-0x6d,0x03,0x08,0xf3,0x1a,0x03,0x9c,0x3c,0x09,0x93,0x16,0x1a,0x08,0x0f,0x00,0x03,
-0x44,0x1d,0x03,0x37,0x22,0x06,0x2f,0x0f,0x2e,0xfc,0x40,0xf6,0x29,0x04,0x96,0x09,
-0x03,0x0f,0x00,0x06,0x10,0x07,0x1a,0xc4,0xc8,0x14,0x2a,0xb1,0x00,0x20,0x19,0x09,
-0xe4,0x14,0x19,0xd1,0x0e,0x00,0x15,0xfa,0x70,0x15,0x1a,0x5d,0x17,0x09,0x01,0xfd,
-0x28,0x09,0xb7,0x19,0x19,0xf0,0xee,0x15,0x0f,0x5e,0x16,0x05,0x01,0xbf,0x01,0x0e,
-0x0e,0x00,0x06,0x9d,0x01,0x09,0x26,0x16,0x06,0x0f,0x03,0x17,0x6f,0x86,0x09,0x24,
-0x01,0x4a,0xa1,0x0b,0x0a,0x51,0x1b,0x07,0x6c,0x1c,0x09,0x7a,0x1b,0x08,0x0e,0x00,
-0x2a,0xd3,0x00,0x01,0x1a,0x05,0x34,0x01,0x2e,0xdb,0x73,0x9a,0x12,0x0f,0x0e,0x00,
-0x95,0x01,0x01,0x00,0x19,0x49,0x26,0x04,0x1a,0x18,0x26,0x04,0x17,0x5e,0x75,0x1d,
-0x08,0x99,0x1d,0x17,0xfd,0xf4,0x28,0x05,0x10,0x00,0x1a,0x6f,0x26,0x04,0x13,0x2f,
-0x26,0x04,0x25,0xdf,0xff,0x54,0x07,0x01,0x8b,0x34,0x02,0xd1,0x0b,0x15,0x03,0x24,
-0x0c,0x11,0x7f,0xe1,0x02,0x15,0x9f,0x7e,0x0c,0x10,0xcf,0x02,0x04,0x15,0x0f,0xd9,
-0x03,0x01,0x21,0x04,0x16,0x03,0x64,0x33,0x01,0x3c,0x07,0x07,0x26,0x04,0x00,0x96,
-0x03,0x16,0x0a,0x77,0x13,0x13,0x06,0x64,0x2a,0x17,0xf9,0x8c,0x09,0x16,0x2e,0xe8,
-0x03,0x10,0x02,0xe7,0x01,0x07,0x07,0x04,0x00,0xa5,0x00,0x07,0xc7,0x1d,0x13,0x01,
-0x04,0x06,0x1e,0xf7,0x45,0x04,0x0e,0x94,0x02,0x0d,0x26,0x04,0x01,0xbd,0x18,0x07,
-0xb8,0x13,0x13,0x6f,0x9f,0x3a,0x06,0x8c,0x3b,0x02,0x26,0x04,0x03,0x84,0x03,0x01,
-0xe5,0x23,0x06,0x83,0x05,0x05,0x26,0x04,0x15,0xf2,0x26,0x04,0x12,0xf0,0xec,0x42,
-0x04,0xd8,0x00,0x12,0xf9,0x43,0x05,0x05,0x26,0x04,0x12,0x10,0x49,0x06,0x43,0xe8,
-0x31,0x02,0x6c,0xe9,0x0d,0x1a,0x06,0x43,0x13,0x08,0x4e,0x1c,0x1a,0xd1,0x26,0x04,
-0x12,0xd1,0x54,0x05,0x1a,0xef,0x53,0x21,0x28,0x01,0x8e,0x07,0x06,0x00,0xd3,0x00,
-0x20,0x9c,0xef,0x83,0x18,0x09,0x24,0x21,0x15,0x4e,0x56,0x0e,0x05,0x5c,0x25,0x09,
-0x33,0x21,0x19,0x0a,0xca,0x20,0x01,0x5f,0x15,0x1a,0xe3,0x0a,0x22,0x19,0xe2,0x82,
-0x02,0x25,0x02,0xa1,0x4f,0x03,0x3a,0xed,0xc9,0x51,0x83,0x04,0x1f,0xa3,0x0b,0x1b,
-0x09,0x1a,0xfa,0x67,0x19,0x1e,0x90,0xcd,0x03,0x01,0x47,0x09,0x11,0x9f,0xe0,0x00,
-0x04,0xb7,0x01,0x01,0x65,0x0b,0x06,0x09,0x03,0x19,0x8f,0x39,0x1a,0x19,0x1f,0xc2,
-0x0f,0x01,0x57,0x10,0x09,0xad,0x04,0x19,0x70,0x1c,0x00,0x19,0x60,0x38,0x00,0x19,
-0x40,0x54,0x00,0x14,0x10,0x0e,0x00,0x18,0x05,0x7e,0x00,0x12,0x14,0xe9,0x0f,0x08,
-0xa8,0x00,0x18,0xa0,0x0e,0x00,0x19,0xfc,0xd2,0x00,0x18,0xb0,0x0e,0x00,0x19,0xe6,
-0x0a,0x01,0x19,0x60,0x0e,0x00,0x06,0x0f,0x10,0x16,0x06,0x3f,0x1c,0x03,0x97,0x21,
-0x16,0xfe,0x0e,0x00,0x19,0x5f,0x57,0x10,0x01,0xb2,0x20,0x09,0x1b,0x0f,0x16,0xf7,
-0x21,0x04,0x02,0x39,0x00,0x08,0xce,0x08,0x28,0x80,0x00,0xcd,0x08,0x19,0xf1,0x50,
-0x01,0x1a,0xf8,0x25,0x0f,0x15,0x10,0x0e,0x00,0x19,0x4f,0xa5,0x1b,0x19,0x0c,0x9b,
-0x05,0x14,0x04,0x58,0x04,0x20,0x03,0x8b,0x2e,0x1d,0x19,0x10,0xa7,0x08,0x29,0xfa,
-0x20,0x9f,0x02,0x04,0x84,0x44,0x06,0xdb,0x02,0x07,0xea,0x02,0x13,0xfb,0x92,0x08,
-0x23,0xfe,0xde,0x6a,0x10,0x10,0x9f,0xcc,0x00,0x12,0x10,0x96,0x1d,0x33,0xe0,0x00,
-0xef,0xc5,0x08,0x10,0x09,0x1b,0x01,0x15,0x01,0xb1,0x16,0x00,0x7e,0x03,0x01,0xd0,
-0x1c,0x05,0x5f,0x12,0x15,0x02,0xa2,0x07,0x44,0x5e,0xee,0xee,0xed,0x00,0x2f,0x07,
-0xbb,0x42,0x1a,0x80,0xab,0x47,0x18,0x50,0x44,0x24,0x01,0x28,0x2c,0x08,0xe8,0x47,
-0x27,0xe9,0x30,0x1e,0x03,0x06,0xc0,0x2a,0x19,0x9f,0xc4,0x16,0x03,0xd4,0x38,0x02,
-0xcf,0x42,0x03,0xab,0x02,0x07,0xa5,0x39,0x17,0x5b,0x6d,0x05,0x04,0x31,0x35,0x06,
-0x9b,0x25,0x01,0x3d,0x00,0x19,0xf2,0x22,0x24,0x55,0xf8,0x28,0x88,0x88,0x88,0xb1,
-0x00,0x24,0xfc,0x3f,0x31,0x1f,0x00,0x3c,0x01,0x24,0xfe,0x1f,0xc7,0x03,0x00,0x99,
-0x04,0x25,0xfe,0x0e,0x34,0x05,0x00,0x42,0x05,0x27,0x08,0xff,0x8b,0x34,0x23,0xfb,
-0x02,0xc3,0x2a,0x21,0x01,0x7f,0xcb,0x03,0x11,0x7f,0xb2,0x00,0x22,0xdd,0xef,0xb4,
-0x24,0x1a,0x0b,0x6a,0x23,0x19,0xaf,0x21,0x1d,0x29,0x06,0xef,0xa5,0x17,0x26,0x07,
-0xdf,0x19,0x2b,0x00,0x5d,0x00,0x23,0x7a,0xde,0x33,0x21,0x29,0x0f,0xff,0x01,0x00,
-0x0f,0x0f,0x00,0x37,0x15,0xfe,0x5c,0x02,0x06,0xb5,0x3a,0x0f,0x0f,0x00,0xff,0x9d,
-0x04,0x6b,0x4a,0x06,0x0b,0x32,0x15,0xf2,0x22,0x00,0x1f,0xf1,0x1d,0x00,0xff,0x2c,
-0x16,0xf0,0x3a,0x36,0x13,0x5f,0x93,0x34,0x16,0xf5,0x2c,0x36,0x15,0x0d,0x75,0x09,
-0x01,0x50,0x1c,0x05,0xe9,0x2d,0x10,0x3f,0x56,0x05,0x14,0x04,0xc0,0x09,0x11,0x1d,
-0x52,0x00,0x17,0x0c,0x25,0x1d,0x14,0xfb,0x8a,0x35,0x13,0xef,0x25,0x2f,0x08,0xcb,
-0x1b,0x08,0xc8,0x3d,0x03,0x68,0x09,0x18,0x6f,0xb1,0x50,0x04,0xf7,0x30,0x06,0xfb,
-0x2f,0x64,0x59,0xcd,0xff,0xed,0xc8,0x40,0x2e,0x0c,0x17,0x70,0x81,0x05,0x17,0x55,
-0xfd,0x29,0x22,0x1f,0xff,0x8f,0x12,0x04,0x44,0x02,0x11,0x06,0x11,0x08,0x16,0xaf,
-0xab,0x08,0x01,0xaf,0x1d,0x16,0x04,0x60,0x09,0x02,0x2c,0x00,0x15,0x0e,0x78,0x29,
-0x03,0x80,0x06,0x06,0x9f,0x0e,0x11,0x9f,0x9b,0x09,0x06,0x55,0x25,0x03,0x2b,0x00,
-0x05,0xf7,0x27,0x13,0x03,0x12,0x06,0x05,0xab,0x0a,0x03,0x54,0x28,0x27,0x03,0xff,
-0x18,0x36,0x13,0xe0,0x39,0x00,0x14,0xb0,0x83,0x18,0x04,0x11,0x08,0x05,0xa7,0x25,
-0x04,0xd4,0x0a,0x03,0xe4,0x09,0x15,0xd0,0xfb,0x0e,0x02,0xd8,0x0c,0x05,0x43,0x08,
-0x00,0xca,0x04,0x05,0x32,0x1e,0x03,0x9c,0x06,0x19,0x09,0xe3,0x25,0x11,0x80,0xc6,
-0x06,0x15,0xf7,0x4e,0x1e,0x17,0xfd,0x66,0x29,0x03,0x3c,0x37,0x07,0xcb,0x3f,0x11,
-0x0c,0x8d,0x01,0x07,0xc9,0x2f,0x00,0x82,0x3a,0x01,0x47,0x01,0x16,0x20,0xde,0x0a,
-0x18,0xf0,0xa8,0x38,0x01,0x1c,0x2b,0x08,0x6a,0x3c,0x00,0xa7,0x13,0x08,0xef,0x38,
-0x10,0x01,0x8b,0x30,0x08,0xfd,0x09,0x00,0x32,0x00,0x03,0x60,0x30,0x09,0x86,0x1f,
-0x18,0x10,0xd8,0x2a,0x09,0x2e,0x0a,0x1b,0x0b,0xf9,0x2a,0x03,0x32,0x00,0x19,0x00,
-0x0a,0x2b,0x09,0x90,0x2c,0x1b,0x0b,0x31,0x00,0x02,0x9e,0x10,0x08,0x51,0x0a,0x0b,
-0x31,0x00,0x01,0x91,0x0a,0x1b,0xf4,0x45,0x3d,0x24,0x4f,0xff,0xc3,0x4c,0x02,0x55,
-0x24,0x14,0xf7,0x1f,0x0b,0x13,0x50,0x79,0x02,0x24,0xf9,0x09,0x46,0x00,0x04,0xa4,
-0x26,0x10,0x0d,0x41,0x01,0x13,0x6f,0x05,0x10,0x14,0x0f,0x8a,0x01,0x00,0x0e,0x03,
-0x01,0x3a,0x01,0x04,0x32,0x16,0x13,0x10,0x32,0x03,0x14,0x00,0x05,0x42,0x13,0x6f,
-0x7f,0x00,0x11,0x06,0xf9,0x00,0x15,0xbf,0x2d,0x4e,0x02,0x51,0x08,0x01,0x3c,0x38,
-0x13,0x08,0x7a,0x03,0x02,0x58,0x42,0x04,0x02,0x3f,0x17,0x4f,0x6f,0x11,0x14,0xf0,
-0xa7,0x31,0x03,0x90,0x41,0x14,0x05,0x64,0x2c,0x11,0x2f,0x91,0x00,0x03,0x7c,0x37,
-0x13,0x9f,0x88,0x07,0x12,0x05,0xbc,0x00,0x02,0xc1,0x3a,0x14,0x0c,0x42,0x01,0x02,
-0x1e,0x47,0x12,0x06,0x79,0x00,0x01,0xf9,0x4f,0x15,0xfe,0xff,0x3a,0x14,0x3f,0xc7,
-0x03,0x11,0x8b,0x19,0x01,0x15,0xef,0x72,0x00,0x10,0xe0,0x23,0x01,0x11,0xf4,0xa3,
-0x4c,0x16,0x1f,0x9d,0x00,0x10,0x10,0xc8,0x00,0x10,0x03,0x19,0x01,0x25,0x04,0xff,
-0xe2,0x4e,0x11,0xf4,0x7e,0x4e,0x10,0x0f,0x19,0x01,0x00,0x3f,0x59,0x03,0x56,0x0a,
-0x10,0x70,0x85,0x30,0x00,0x78,0x02,0x05,0xdd,0x3b,0x01,0xd8,0x3b,0x00,0x35,0x4a,
-0x13,0x08,0x0d,0x0b,0x13,0xe0,0x91,0x09,0x10,0xd0,0x43,0x4f,0x00,0x85,0x00,0x35,
-0x80,0x0f,0xff,0x33,0x4e,0x00,0xad,0x0b,0x10,0xfd,0x8b,0x00,0x23,0xfb,0x03,0x0f,
-0x04,0x00,0x5e,0x00,0x11,0xf3,0xbe,0x4e,0x00,0xe7,0x4e,0x13,0x6f,0xb6,0x09,0x00,
-0x1e,0x00,0x11,0x65,0x77,0x00,0x12,0x8f,0xfd,0x47,0x04,0xf1,0x01,0x00,0x84,0x3c,
-0x11,0x10,0xa5,0x4f,0x14,0xcf,0xdc,0x02,0x11,0xcf,0xf3,0x38,0x11,0xe0,0x8b,0x00,
-0x14,0xaf,0xe8,0x09,0x15,0x09,0x11,0x13,0x08,0x82,0x17,0x14,0x5f,0xc6,0x04,0x17,
-0x09,0xb9,0x1a,0x02,0xc1,0x13,0x04,0xc3,0x45,0x04,0x33,0x18,0x14,0x0e,0x0c,0x00,
-0x18,0x01,0xe5,0x02,0x14,0xbf,0x8f,0x02,0x16,0x0e,0x23,0x49,0x02,0x73,0x22,0x1c,
-0xf6,0x83,0x42,0x14,0x4f,0x97,0x15,0x18,0x06,0x4f,0x18,0x05,0x0c,0x00,0x17,0x2f,
-0x68,0x2e,0x27,0x0d,0xff,0x79,0x43,0x05,0x8d,0x18,0x18,0x9f,0xf0,0x22,0x17,0xf6,
-0x57,0x32,0x15,0xf3,0x5c,0x03,0x13,0x20,0x3d,0x00,0x16,0xf8,0x9e,0x00,0x25,0xb0,
-0x05,0xa4,0x03,0x12,0x04,0xc1,0x05,0x14,0xbf,0x54,0x00,0x16,0x0c,0xfe,0x51,0x14,
-0xf2,0x0e,0x01,0x12,0xe0,0x0c,0x01,0x14,0xfa,0xaa,0x0d,0x13,0x50,0xf4,0x0a,0x13,
-0x30,0xc2,0x32,0x05,0x78,0x11,0x02,0xf3,0x00,0x14,0xf3,0xaf,0x00,0x03,0xe3,0x21,
-0x25,0xa0,0x00,0xc1,0x2a,0x16,0x01,0x1c,0x04,0x14,0xbf,0xfe,0x0e,0x16,0xf7,0x5b,
-0x0f,0x26,0xe0,0x2f,0xfe,0x13,0x01,0x51,0x3f,0x17,0xaf,0x89,0x0e,0x1b,0xef,0x0c,
-0x30,0x19,0x5f,0x87,0x1c,0x05,0x66,0x2b,0x19,0x90,0xce,0x19,0x08,0x9a,0x54,0x15,
-0xaf,0x83,0x01,0x07,0x5a,0x36,0x05,0x70,0x1e,0x03,0x97,0x2e,0x1a,0xe1,0x02,0x0c,
-0x07,0x12,0x0c,0x14,0x06,0x12,0x36,0x09,0x31,0x44,0x06,0x7e,0x2f,0x1a,0x9f,0x25,
-0x43,0x13,0x02,0xea,0x1c,0x17,0xfe,0xc6,0x04,0x11,0xf4,0xb8,0x2d,0x06,0xbf,0x00,
-0x2a,0xb0,0x0e,0x48,0x1d,0x25,0x30,0x06,0xbe,0x06,0x16,0x07,0xef,0x0e,0x14,0x40,
-0xad,0x00,0x12,0xf2,0x36,0x00,0x14,0xd0,0xcd,0x00,0x12,0x90,0xf5,0x00,0x14,0xf7,
-0xc7,0x01,0x16,0x10,0x08,0x00,0x14,0x0d,0x59,0x01,0x03,0xd9,0x01,0x14,0x6f,0x06,
-0x07,0x12,0x2f,0xd6,0x46,0x14,0xef,0x3d,0x18,0x11,0x09,0xc1,0x01,0x15,0x09,0x69,
-0x02,0x11,0x01,0x09,0x03,0x16,0x2f,0xc9,0x00,0x10,0x8f,0x3a,0x00,0x01,0x5b,0x07,
-0x06,0xaf,0x05,0x16,0x93,0xf0,0x1d,0x22,0x0d,0xff,0x12,0x1a,0x25,0xff,0xf3,0xb4,
-0x15,0x11,0xf8,0x65,0x00,0x16,0xa0,0x1e,0x0e,0x15,0x00,0x27,0x2f,0x11,0x3f,0x00,
-0x01,0x05,0x86,0x35,0x12,0x0b,0xbb,0x16,0x17,0x0a,0x9a,0x42,0x04,0x7a,0x17,0x17,
-0x80,0x79,0x36,0x12,0xaf,0x46,0x01,0x13,0x1f,0x17,0x00,0x01,0xba,0x3a,0x02,0x21,
-0x02,0x15,0xe1,0xc1,0x2a,0x07,0xc4,0x35,0x11,0x2f,0x35,0x02,0x00,0x01,0x0d,0x07,
-0x30,0x3f,0x06,0x0f,0x3f,0x01,0x8e,0x2a,0x16,0x06,0x8e,0x31,0x13,0x09,0x8f,0x2e,
-0x08,0x03,0x12,0x06,0x3d,0x00,0x05,0xdb,0x08,0x1a,0x70,0xd1,0x06,0x09,0x1b,0x40,
-0x08,0x57,0x02,0x17,0x1f,0x20,0x04,0x05,0x3f,0x00,0x1a,0x60,0xde,0x06,0x07,0x08,
-0x32,0x1a,0x08,0x94,0x02,0x06,0x01,0x08,0x07,0x62,0x12,0x0f,0x1f,0x00,0x9d,0x18,
-0x3f,0xa0,0x0d,0x1f,0xf7,0x0e,0x00,0x24,0x39,0xf4,0x2f,0xff,0xeb,0x11,0x07,0x6d,
-0x0f,0x19,0xfd,0x1b,0x08,0x19,0xf4,0x4a,0x08,0x18,0x90,0x69,0x01,0x0a,0x29,0x00,
-0x19,0xf3,0x29,0x00,0x28,0x80,0x00,0xa9,0x03,0x09,0x1f,0x34,0x19,0xf3,0xb2,0x27,
-0x09,0x29,0x00,0x06,0xa2,0x27,0x19,0x0d,0xff,0x00,0x18,0x8f,0x99,0x33,0x1f,0x03,
+0x00,0x14,0x48,0x19,0x00,0x83,0xcf,0xff,0xff,0xf3,0x7f,0xff,0xff,0xf8,0xf9,0x01,
+0x33,0xff,0x24,0xff,0x92,0x01,0x83,0xff,0xff,0xff,0xf0,0x1f,0xff,0xff,0xfe,0xcd,
+0x01,0x62,0xfc,0x00,0xef,0xff,0xff,0xf3,0xed,0x01,0x41,0xff,0x80,0x08,0xff,0x69,
+0x02,0x00,0xf5,0x00,0x11,0xf2,0x0c,0x01,0x50,0xa1,0x00,0x03,0xdf,0xff,0xd5,0x02,
+0x10,0xaf,0x5a,0x01,0x30,0xbd,0xff,0xff,0xce,0x01,0x24,0x01,0xef,0x52,0x01,0x11,
+0xb0,0xb9,0x01,0x02,0x01,0x00,0x26,0xd1,0x00,0x0d,0x00,0x11,0xd1,0xfa,0x02,0x00,
+0x34,0x00,0x05,0xea,0x02,0x65,0x26,0xbd,0xef,0xed,0xa5,0x10,0xc5,0x01,0x21,0x28,
+0xe9,0x23,0x00,0x90,0x7c,0xff,0xf9,0x00,0x00,0x00,0x05,0xbf,0xff,0x08,0x00,0x10,
+0x4a,0x2f,0x00,0x41,0xf9,0x02,0x8e,0xff,0x08,0x00,0x22,0xcf,0xff,0x08,0x00,0x1e,
+0xef,0x08,0x00,0x21,0xfd,0xcf,0x08,0x00,0x81,0xc7,0x20,0x8f,0xff,0xff,0xf9,0xeb,
+0x61,0xaa,0x01,0x00,0x48,0x00,0x0f,0x08,0x00,0xb6,0x53,0x48,0xce,0xff,0xed,0xa7,
+0x2d,0x01,0x11,0x5d,0xf7,0x00,0x11,0xfb,0x27,0x04,0x13,0x1b,0x60,0x01,0x00,0xf0,
+0x01,0x06,0x86,0x01,0x12,0x60,0xe3,0x01,0x02,0x01,0x00,0x10,0xf2,0x5f,0x03,0x50,
+0xff,0xff,0xfe,0xbc,0xef,0x36,0x00,0x01,0xe5,0x02,0x40,0xfe,0x40,0x00,0x06,0x1b,
+0x00,0x32,0x10,0x08,0xff,0x8d,0x04,0x10,0x5f,0xc7,0x01,0x13,0x0d,0x9c,0x01,0x10,
+0x0d,0xf9,0x01,0x10,0x1f,0x1f,0x00,0x03,0x06,0x02,0x23,0x90,0x3f,0x1f,0x02,0x10,
+0x07,0x0d,0x00,0x43,0x2a,0xaa,0xaa,0xa8,0x0d,0x04,0x04,0xf0,0x04,0x02,0x6b,0x02,
+0x03,0x82,0x03,0x02,0x34,0x03,0x05,0xd9,0x01,0x25,0xaf,0xff,0xdc,0x03,0x01,0x0e,
+0x02,0x14,0xf3,0x0d,0x00,0x14,0x1e,0x81,0x02,0x03,0x9e,0x02,0x27,0xfe,0x10,0x4c,
+0x00,0x25,0xf5,0x00,0x1a,0x04,0x06,0x66,0x00,0x22,0x08,0xff,0x94,0x03,0x03,0xa9,
+0x04,0x05,0x03,0x05,0x23,0x00,0x07,0xd9,0x03,0x03,0x73,0x05,0x03,0x6f,0x02,0x00,
+0x48,0x02,0x17,0xff,0x58,0x00,0x00,0x03,0x04,0x25,0xe2,0x00,0xd4,0x04,0x45,0xff,
+0xfe,0x20,0x00,0xc3,0x04,0x05,0x97,0x00,0x23,0x02,0xef,0xec,0x03,0x00,0x01,0x00,
+0x11,0x2e,0x17,0x04,0x03,0xb7,0x05,0x61,0xdf,0xff,0xff,0xff,0xeb,0xbb,0x01,0x00,
+0x36,0xb8,0x09,0xff,0x01,0x00,0x1f,0xfc,0x0d,0x00,0x21,0x00,0x51,0x00,0x53,0x6a,
+0xdf,0xff,0xec,0x96,0x76,0x00,0x12,0xaf,0xcb,0x02,0x12,0x10,0xf9,0x05,0x02,0x01,
+0x00,0x12,0xf5,0x37,0x05,0x06,0xd4,0x01,0x15,0x6f,0x0d,0x00,0x31,0xf3,0x00,0x01,
+0xcd,0x04,0x21,0xbc,0xef,0x4d,0x00,0x12,0x07,0x10,0x02,0x20,0x04,0xef,0xad,0x04,
+0x12,0x0c,0x87,0x03,0x01,0x86,0x01,0x14,0x60,0xba,0x04,0x10,0x09,0xba,0x01,0x43,
+0x06,0x66,0x66,0x66,0xb3,0x06,0x06,0x7a,0x01,0x25,0x06,0xff,0x5f,0x05,0x02,0x0e,
+0x05,0x1f,0x70,0xc7,0x01,0x01,0x23,0x03,0xdf,0x3b,0x04,0x53,0x00,0x38,0x88,0x89,
+0xcf,0x62,0x00,0x04,0x92,0x00,0x26,0xfb,0x00,0x0d,0x00,0x27,0xfe,0x60,0x0d,0x00,
+0x27,0xfd,0x50,0x0d,0x00,0x02,0x88,0x05,0x05,0xc6,0x00,0x14,0xe2,0x58,0x01,0x21,
+0x49,0xff,0x50,0x04,0x07,0x8c,0x01,0x27,0x60,0x00,0xd8,0x01,0x04,0xe4,0x01,0x01,
+0xf2,0x00,0x14,0xf0,0x28,0x00,0x00,0xa5,0x04,0x63,0xf2,0x24,0x44,0x44,0x43,0x00,
+0x72,0x05,0x24,0xf3,0x5f,0x88,0x00,0x00,0x1a,0x00,0x00,0xeb,0x01,0x04,0x71,0x02,
+0x23,0xf0,0x1f,0xef,0x00,0x10,0x0d,0x4e,0x00,0x12,0x0b,0x2b,0x01,0x20,0x03,0xdf,
+0xea,0x00,0x11,0x03,0xa5,0x00,0x20,0xbb,0xef,0xb8,0x00,0x02,0x6b,0x02,0x05,0x7a,
+0x01,0x18,0x0b,0x79,0x01,0x05,0x1b,0x00,0x11,0xe5,0x0c,0x01,0x17,0xbf,0xad,0x01,
+0x00,0x7d,0x06,0x36,0xff,0xec,0x95,0x8d,0x06,0x01,0x37,0x01,0x14,0x40,0x0d,0x00,
+0x17,0x0c,0x42,0x02,0x02,0x74,0x03,0x17,0x40,0xcf,0x00,0x06,0x1b,0x00,0x18,0xaf,
+0x1b,0x00,0x18,0x4f,0x1b,0x00,0x27,0x0e,0xff,0x1b,0x00,0x02,0x0f,0x02,0x16,0xf4,
+0xc4,0x02,0x06,0x1b,0x00,0x17,0xcf,0x1b,0x00,0x00,0x43,0x02,0x14,0xbc,0x1b,0x00,
+0x00,0xef,0x06,0x23,0xf2,0xcf,0x1b,0x00,0x00,0xd8,0x00,0x24,0xf8,0x0c,0x1b,0x00,
+0x10,0x05,0x7a,0x01,0x04,0x1b,0x00,0x00,0x39,0x01,0x15,0x40,0x1b,0x00,0x10,0x9f,
+0x34,0x01,0x03,0x1b,0x00,0x00,0x95,0x01,0x24,0xe1,0x00,0x1b,0x00,0x11,0x0d,0x6e,
+0x04,0x03,0x1b,0x00,0x11,0x07,0x76,0x01,0x03,0x1b,0x00,0x10,0x02,0x7f,0x02,0x05,
+0x1b,0x00,0x11,0xbf,0x4b,0x02,0x03,0x1b,0x00,0x12,0x5f,0x35,0x07,0x02,0x1b,0x00,
+0x10,0x1e,0x75,0x01,0x97,0xbb,0xbb,0xbe,0xff,0xff,0xff,0xcb,0xbb,0x38,0x17,0x03,
+0x01,0xbb,0x06,0x06,0x01,0x00,0x19,0x58,0x1b,0x00,0x18,0x7f,0x0e,0x00,0x19,0x56,
+0x1b,0x00,0x07,0x6d,0x01,0x05,0x7a,0x01,0x06,0xd8,0x00,0x0f,0x1b,0x00,0x3c,0x15,
+0x08,0x78,0x00,0x13,0xf7,0xb8,0x01,0x03,0xd6,0x06,0x18,0x0c,0x19,0x00,0x17,0xef,
+0x19,0x00,0x17,0x0f,0x19,0x00,0x00,0xf7,0x01,0x12,0xee,0x01,0x00,0x37,0x60,0x00,
+0x3f,0x0f,0x05,0x18,0x05,0x35,0x05,0x17,0x7f,0xeb,0x02,0x18,0x09,0x1f,0x03,0x17,
+0xaf,0x11,0x03,0x17,0x0c,0x5a,0x05,0x00,0x70,0x00,0x62,0x82,0x7c,0xef,0xfd,0xb6,
+0x10,0x8e,0x08,0x11,0xfe,0x6f,0x00,0x12,0x80,0x94,0x01,0x05,0x83,0x07,0x04,0x05,
+0x09,0x00,0xcf,0x01,0x16,0x05,0x40,0x01,0x11,0xa0,0x73,0x04,0x41,0xb7,0x56,0x8d,
+0xff,0x2e,0x04,0x42,0x26,0xae,0xfd,0x30,0x7c,0x03,0x10,0xfa,0xe0,0x02,0x04,0x06,
+0x06,0x05,0x91,0x00,0x17,0x0f,0x22,0x05,0x14,0x00,0x85,0x08,0x0d,0x12,0x06,0x13,
+0x7f,0xba,0x06,0x04,0xc8,0x03,0x53,0x92,0x66,0x66,0x66,0x30,0x5a,0x02,0x14,0xf8,
+0xad,0x03,0x00,0x33,0x01,0x22,0x63,0xff,0x9b,0x0a,0x10,0x02,0x8c,0x06,0x13,0x0e,
+0x8e,0x04,0x10,0xbf,0x92,0x03,0x11,0x8f,0x70,0x08,0x01,0x36,0x08,0x21,0x70,0x01,
+0x42,0x04,0x1c,0xbc,0xbc,0x00,0x12,0xf5,0x5d,0x00,0x01,0x01,0x00,0x14,0xf8,0x63,
+0x03,0x04,0x01,0x0a,0x03,0x70,0x08,0x12,0xb2,0x85,0x00,0x65,0x16,0xad,0xff,0xfe,
+0xb7,0x20,0x31,0x01,0x44,0x26,0x9c,0xef,0xf9,0x98,0x03,0x16,0xcf,0x04,0x05,0x11,
+0x5d,0xdb,0x03,0x07,0x95,0x03,0x02,0x19,0x00,0x22,0x01,0xcf,0xf4,0x03,0x07,0x6b,
+0x03,0x24,0xfe,0x70,0x24,0x00,0x26,0xfe,0x84,0xe7,0x04,0x17,0xe6,0xb7,0x03,0x17,
+0xd1,0xff,0x00,0x17,0xd1,0xa9,0x01,0x05,0xf4,0x01,0x17,0x5f,0xc2,0x01,0x10,0x09,
+0x6c,0x02,0x52,0x17,0xbe,0xfe,0xda,0x50,0x25,0x00,0x20,0xf0,0x8f,0x65,0x00,0x11,
+0xd4,0xbf,0x03,0x23,0xfd,0xcf,0xe5,0x07,0x18,0x04,0xf5,0x02,0x26,0x6f,0xff,0xcf,
+0x01,0x02,0x05,0x01,0x21,0xdb,0xcf,0xb1,0x00,0x10,0x8f,0xbb,0x01,0x12,0x20,0x2d,
+0x04,0x13,0x08,0x0d,0x01,0x13,0x08,0x5e,0x03,0x14,0xfc,0x00,0x0a,0x13,0x88,0xad,
+0x01,0x00,0xa9,0x01,0x10,0xfb,0xd9,0x0a,0x04,0x53,0x04,0x13,0xd7,0x19,0x00,0x00,
+0xc9,0x04,0x23,0xfe,0x6f,0xf4,0x00,0x00,0x9d,0x01,0x13,0xe3,0x8e,0x05,0x00,0xb7,
+0x02,0x10,0xfd,0x05,0x02,0x04,0xdc,0x00,0x13,0xa0,0x05,0x02,0x00,0x88,0x05,0x23,
+0xf7,0x05,0xdc,0x05,0x10,0x8f,0x0d,0x04,0x00,0x69,0x00,0x12,0xe4,0x0c,0x00,0x31,
+0xb0,0x00,0x4f,0x86,0x08,0x12,0xff,0x6d,0x07,0x18,0x9f,0xb6,0x01,0x16,0xaf,0x90,
+0x0b,0x05,0x1a,0x00,0x02,0x6b,0x01,0x11,0x4c,0x0c,0x00,0x13,0xc4,0xf1,0x04,0x43,
+0x8c,0xdf,0xfe,0xc8,0x88,0x0b,0x05,0x01,0x00,0x1f,0xf9,0x0d,0x00,0x20,0x33,0xf5,
+0x6b,0xbb,0x01,0x00,0x15,0xff,0x66,0x0c,0x02,0xe4,0x00,0x18,0x80,0x0a,0x07,0x05,
+0x8f,0x03,0x18,0x1f,0x6a,0x03,0x17,0x8f,0xc1,0x01,0x18,0x00,0xa1,0x06,0x18,0x07,
+0x04,0x09,0x13,0x0e,0x33,0x09,0x04,0xe8,0x01,0x02,0x3d,0x07,0x03,0x25,0x01,0x18,
+0xf1,0x11,0x09,0x18,0xa0,0x44,0x09,0x17,0x30,0x08,0x07,0x18,0xfc,0xf6,0x03,0x18,
+0xf5,0x07,0x07,0x18,0xe0,0x72,0x03,0x18,0x70,0x98,0x03,0x08,0x42,0x04,0x09,0x1d,
+0x04,0x18,0xf3,0x85,0x06,0x05,0xb3,0x00,0x18,0x0d,0xb3,0x00,0x18,0x4f,0xb3,0x00,
+0x14,0xbf,0x45,0x0d,0x03,0x16,0x02,0x18,0xf1,0x19,0x01,0x17,0xa0,0x19,0x01,0x06,
+0xb3,0x00,0x17,0x9f,0xb3,0x00,0x18,0x01,0xc4,0x09,0x18,0x07,0xb3,0x00,0x17,0x0e,
+0xb3,0x00,0x01,0xc3,0x02,0x70,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,0x00,0x00,
+0x00,0x04,0x8c,0xef,0xfe,0xda,0x72,0x00,0x01,0x00,0x20,0x5d,0xff,0x01,0x00,0x20,
+0xfb,0x20,0x0c,0x00,0x22,0xaf,0xff,0x01,0x00,0x66,0x60,0x00,0x00,0x00,0xbf,0xff,
+0x0d,0x00,0x24,0x8f,0xff,0x01,0x00,0x30,0x30,0x00,0x1f,0x07,0x00,0x20,0xcb,0xdf,
+0x34,0x00,0xd0,0x00,0x07,0xff,0xff,0xff,0xfa,0x10,0x00,0x3d,0xff,0xff,0xff,0xf1,
+0x31,0x00,0x50,0xfc,0x00,0x00,0x00,0x2f,0x33,0x00,0x52,0x0d,0xff,0xff,0xff,0x50,
+0x51,0x00,0xf1,0x00,0xf7,0x00,0xef,0xff,0xff,0xf2,0x00,0x00,0x00,0x08,0xff,0xff,
+0xff,0x90,0x0d,0x44,0x00,0x01,0x52,0x00,0x10,0xf8,0x1e,0x00,0x50,0xf6,0x00,0x00,
+0x00,0x0b,0x2d,0x00,0x81,0x05,0xff,0xff,0xff,0xd0,0x00,0x00,0x02,0x4b,0x00,0x00,
+0x26,0x00,0x40,0xb1,0x00,0x03,0xdf,0x25,0x00,0x82,0x00,0x3f,0xff,0xff,0xff,0xfc,
+0xbd,0xff,0x5e,0x00,0x13,0x4f,0x88,0x00,0x62,0xfd,0x10,0x00,0x00,0x00,0x2c,0x0c,
+0x00,0x10,0xf8,0xbb,0x00,0x13,0x02,0xb0,0x00,0x54,0x80,0x00,0x00,0x00,0x06,0xae,
+0x00,0x17,0xd2,0x0c,0x00,0x21,0xff,0xe1,0x5d,0x00,0x80,0xfc,0x41,0x02,0x7e,0xff,
+0xff,0xff,0xc0,0xaf,0x00,0x50,0xfa,0x00,0x00,0x00,0x2e,0xaf,0x00,0x40,0x2f,0xff,
+0xff,0xfe,0x45,0x00,0x50,0x5f,0xff,0xff,0xfc,0x07,0xa7,0x00,0x00,0x0d,0x00,0x00,
+0x8a,0x00,0x12,0x9f,0xa2,0x00,0x63,0x00,0x0c,0xff,0xff,0xff,0x4a,0x19,0x01,0x63,
+0x00,0xcf,0xff,0xff,0xf5,0x9f,0x77,0x00,0x00,0xaa,0x00,0x12,0x48,0xbb,0x00,0x01,
+0x5f,0x00,0x27,0xf2,0x5f,0x3f,0x01,0x10,0x00,0x77,0x00,0x30,0x70,0x00,0x01,0x57,
+0x01,0x34,0xa0,0x08,0xff,0xc8,0x00,0x45,0xff,0xf3,0x00,0x1e,0x96,0x00,0x12,0xfa,
+0x83,0x00,0x23,0xff,0xff,0xe1,0x00,0x16,0x2d,0x18,0x00,0x41,0x00,0x00,0x07,0xef,
+0x0c,0x00,0x12,0xc5,0xaa,0x01,0x62,0x58,0xce,0xff,0xed,0xb7,0x30,0x0c,0x00,0x62,
+0x02,0x7b,0xef,0xfe,0xb7,0x20,0x0c,0x00,0x11,0x2b,0x25,0x00,0x11,0xa2,0x0c,0x00,
+0x12,0x6f,0x3e,0x00,0x10,0xf5,0x0c,0x00,0x26,0x7f,0xff,0x0d,0x00,0x14,0x5f,0x64,
+0x00,0x22,0xf2,0x00,0x7d,0x00,0x21,0xcc,0xff,0x06,0x01,0x00,0x96,0x00,0x12,0xf9,
+0xe1,0x01,0x22,0x50,0x00,0x0c,0x00,0x20,0x00,0x8f,0x8a,0x00,0x13,0x5f,0x13,0x01,
+0x53,0xdf,0xff,0xff,0xf2,0x09,0x13,0x01,0x10,0x08,0xcf,0x00,0x12,0xcf,0x5e,0x00,
+0x00,0x97,0x01,0x10,0xfb,0xfe,0x00,0x00,0x85,0x00,0x10,0x01,0x02,0x01,0x03,0xe7,
+0x01,0x54,0x00,0x0f,0xff,0xff,0xff,0xe7,0x01,0x00,0x53,0x00,0x14,0xf0,0x32,0x00,
+0x00,0x19,0x00,0x18,0x1a,0x5e,0x01,0x00,0xad,0x00,0x13,0x10,0xd5,0x01,0x11,0x12,
+0x51,0x02,0x30,0x00,0x00,0x3e,0x32,0x00,0x12,0x0b,0xa9,0x01,0x01,0x77,0x02,0x05,
+0xf3,0x01,0x00,0x19,0x00,0x25,0x00,0x9f,0x0c,0x00,0x17,0xfd,0xa3,0x02,0x32,0xff,
+0xb0,0x00,0x1a,0x00,0x22,0xfd,0x5f,0x98,0x01,0x63,0x3a,0xff,0xff,0xff,0xd6,0x06,
+0x85,0x02,0x60,0x00,0x35,0x65,0x20,0x00,0xbf,0x58,0x02,0x03,0x01,0x00,0x12,0x1f,
+0x6b,0x00,0x01,0x01,0x00,0x14,0x0a,0x25,0x00,0x03,0xe0,0x00,0x13,0xe0,0x0c,0x00,
+0x14,0x1a,0x46,0x01,0x53,0x00,0x00,0x25,0xaf,0xff,0x31,0x00,0x12,0x09,0x6e,0x00,
+0x10,0xfe,0xb5,0x00,0x03,0x8b,0x00,0x26,0xfe,0x20,0x19,0x00,0x35,0xfd,0x20,0x00,
+0x19,0x00,0x12,0xf9,0x3c,0x00,0x16,0x09,0x9b,0x01,0x00,0x19,0x00,0x22,0xdb,0x85,
+0x0a,0x00,0x90,0x03,0xbf,0xfb,0x30,0x03,0xff,0xff,0xff,0x40,0x35,0x03,0x10,0x0e,
+0xda,0x00,0x00,0xea,0x01,0x10,0x08,0x28,0x02,0x9f,0x0b,0xff,0xff,0xc1,0x00,0x04,
+0x88,0x40,0x00,0x01,0x00,0x1f,0x30,0x04,0x78,0x40,0x4d,0x03,0x11,0xc0,0x6a,0x03,
+0x00,0xa2,0x03,0x01,0x5a,0x00,0x41,0xbf,0xff,0xff,0xfd,0x6c,0x00,0x91,0x03,0xbf,
+0xfc,0x40,0x00,0x00,0x07,0xdf,0xe9,0xa3,0x00,0x10,0xd0,0xaf,0x02,0x20,0xf6,0x05,
+0xab,0x00,0x11,0x04,0x45,0x03,0x10,0xef,0x99,0x02,0x11,0x4f,0xb1,0x02,0x3f,0x68,
+0x72,0x00,0x01,0x00,0x2f,0x40,0x07,0x77,0x77,0x60,0xf4,0x01,0x1f,0xe0,0x05,0x00,
+0x01,0x00,0x84,0x01,0x10,0xc0,0x2c,0x04,0x10,0xa0,0xb3,0x02,0x10,0x60,0x0b,0x04,
+0x23,0x10,0x01,0x53,0x04,0x01,0x1f,0x03,0x50,0x90,0x00,0x5f,0xff,0xfd,0xd7,0x03,
+0x10,0xe2,0x2f,0x01,0x1f,0x20,0x63,0x00,0x03,0x24,0x03,0xa5,0x0a,0x00,0x33,0x06,
+0xcf,0xf5,0x0a,0x00,0x24,0x18,0xef,0xb8,0x01,0x15,0x4a,0xc3,0x01,0x14,0x6d,0x07,
+0x03,0x24,0x02,0x8f,0x12,0x03,0x13,0x04,0x3d,0x02,0x42,0xf4,0x00,0x06,0xdf,0x0a,
+0x00,0x33,0xd8,0x20,0x29,0xdf,0x01,0x14,0x93,0x5b,0x02,0x24,0xfa,0x50,0x09,0x05,
+0x32,0xc6,0x00,0x00,0x0b,0x00,0x34,0xfe,0x71,0x00,0x0b,0x00,0x35,0xff,0xc6,0x10,
+0x0b,0x00,0x36,0xff,0xfb,0x50,0x14,0x02,0x20,0xff,0xa4,0x9c,0x00,0x03,0x4d,0x05,
+0x63,0xe9,0x30,0x00,0x00,0x01,0x7e,0xb4,0x02,0x57,0x81,0x00,0x00,0x00,0x5c,0xa3,
+0x03,0x16,0x29,0x0b,0x00,0x36,0x00,0x17,0xdf,0x73,0x02,0x00,0x9e,0x00,0x04,0xd1,
+0x00,0x24,0x02,0x9f,0x0b,0x00,0x00,0xca,0x00,0x16,0xf5,0xfe,0x00,0x26,0x43,0xaf,
+0x1a,0x03,0x16,0x2a,0x0b,0x00,0x1f,0xf2,0x17,0x00,0x0f,0x25,0x28,0xcc,0x01,0x00,
+0x1f,0xc1,0xd5,0x01,0x1b,0x16,0x8c,0x3a,0x00,0x1f,0x1a,0x73,0x00,0x1a,0x08,0x17,
+0x00,0x14,0x0c,0x71,0x03,0x00,0x3a,0x04,0x27,0xe8,0x10,0x97,0x03,0x14,0xa3,0x17,
+0x00,0x00,0x2d,0x01,0x15,0x60,0x17,0x00,0x43,0xff,0xff,0xe8,0x20,0x17,0x00,0x00,
+0x01,0x00,0x14,0xb4,0x4e,0x04,0x00,0x26,0x00,0x00,0x90,0x01,0x13,0x05,0xcd,0x01,
+0x10,0xf9,0x74,0x04,0x36,0x16,0xcf,0xff,0x36,0x05,0x12,0x17,0xdd,0x01,0x11,0xf3,
+0x4a,0x00,0x11,0x28,0x0d,0x00,0x03,0x42,0x05,0x15,0x39,0x17,0x00,0x25,0x00,0x4a,
+0x17,0x00,0x24,0x39,0xef,0x2e,0x00,0x02,0x2c,0x00,0x00,0xdf,0x04,0x13,0x17,0x50,
+0x00,0x15,0xd6,0x67,0x00,0x24,0xfa,0x40,0x8a,0x00,0x24,0xfe,0x81,0xa1,0x00,0x25,
+0xff,0xc5,0xa1,0x00,0x24,0xfa,0x30,0xb8,0x00,0x25,0xfe,0x71,0xcf,0x00,0x15,0xc5,
+0xe6,0x00,0x16,0xf9,0xcd,0x02,0x19,0x70,0x5c,0x01,0x51,0x48,0xce,0xff,0xed,0xa7,
+0x0e,0x01,0x12,0x05,0x7d,0x00,0x13,0xa1,0xa0,0x04,0x00,0x01,0x00,0x15,0xe4,0x0b,
+0x00,0x00,0xa0,0x00,0x15,0x07,0x4d,0x01,0x30,0xd0,0x00,0xef,0x06,0x01,0x01,0xa4,
+0x00,0x21,0x50,0x5f,0x38,0x07,0x10,0x06,0x84,0x00,0x12,0x0a,0x95,0x06,0x10,0x07,
+0xd3,0x04,0x12,0xcf,0xc6,0x06,0x00,0x9a,0x07,0x53,0x0c,0xee,0xee,0xee,0x30,0x7f,
+0x05,0x16,0x00,0x60,0x01,0x03,0x0b,0x00,0x13,0x05,0xca,0x06,0x03,0xe6,0x06,0x15,
+0xf7,0xb8,0x04,0x02,0xa8,0x05,0x12,0x00,0x29,0x06,0x16,0x60,0x16,0x00,0x34,0xa0,
+0x00,0x00,0x38,0x08,0x16,0xc0,0x21,0x00,0x12,0xb0,0x0b,0x00,0x16,0x3f,0x0b,0x00,
+0x16,0x0b,0x2c,0x00,0x17,0x00,0x64,0x00,0x16,0x4f,0xe6,0x02,0x16,0x06,0x86,0x00,
+0x00,0xb9,0x06,0x14,0xc0,0x17,0x00,0x3f,0xdd,0xdd,0xd9,0x9f,0x02,0x18,0x24,0x05,
+0x76,0x5d,0x01,0x00,0x49,0x07,0x04,0x5f,0x01,0x16,0x0c,0xf6,0x01,0x16,0x02,0x9b,
+0x05,0x2a,0x00,0x3f,0x95,0x00,0x16,0xf7,0x06,0x06,0x24,0xfd,0x10,0x7f,0x00,0x38,
+0xdf,0xea,0x10,0x60,0x00,0x6a,0x26,0x9c,0xde,0xff,0xed,0xa7,0x9c,0x05,0x13,0x6c,
+0x0b,0x02,0x17,0xa3,0x14,0x00,0x15,0x7e,0xa0,0x01,0x15,0xb2,0x14,0x00,0x00,0x26,
+0x09,0x07,0x54,0x09,0x05,0xf6,0x00,0x73,0xfc,0x74,0x10,0x00,0x13,0x59,0xef,0xf3,
+0x07,0x02,0x43,0x01,0x03,0x24,0x02,0x23,0x04,0xcf,0xa2,0x00,0x00,0x95,0x00,0x26,
+0xfc,0x20,0x35,0x00,0x23,0xf8,0x00,0xaf,0x08,0x14,0x90,0x5f,0x00,0x00,0x39,0x07,
+0x12,0x40,0xe1,0x00,0x17,0xf9,0x21,0x05,0x02,0x6c,0x01,0x16,0x0c,0xe9,0x00,0x02,
+0x25,0x08,0x11,0xf6,0x06,0x00,0x11,0xfd,0x23,0x00,0x41,0x9d,0xff,0xec,0x82,0x24,
+0x00,0x00,0xf0,0x07,0x11,0xef,0xfd,0x02,0x23,0x01,0xbf,0xb7,0x06,0x10,0x04,0x55,
+0x00,0x12,0x06,0x3e,0x00,0x12,0x3e,0xbb,0x00,0x10,0x40,0x14,0x08,0x10,0xa0,0xf9,
+0x08,0x11,0x20,0x60,0x00,0x04,0x76,0x09,0x72,0x8f,0xff,0xe0,0x00,0x3f,0xff,0xfb,
+0x14,0x09,0x31,0xfb,0x75,0x6c,0xe5,0x00,0x72,0x3f,0xff,0xf2,0x00,0x8f,0xff,0xf5,
+0x2e,0x02,0x10,0x50,0x0e,0x07,0x10,0x50,0xba,0x03,0x51,0xf5,0x00,0xdf,0xff,0xf0,
+0xac,0x00,0x11,0xf6,0xd7,0x02,0x10,0x40,0x35,0x00,0x21,0xf7,0x01,0x2f,0x02,0x11,
+0x09,0xfd,0x01,0x11,0x0c,0x5f,0x00,0x11,0x0c,0x9c,0x06,0x11,0x80,0xed,0x03,0x11,
+0x50,0x59,0x00,0x10,0x10,0x4c,0x02,0x20,0xfa,0x07,0x0f,0x00,0x00,0xff,0x00,0x02,
+0x08,0x04,0x01,0x27,0x03,0x21,0xfb,0x0a,0x33,0x00,0x31,0xaf,0xff,0xfb,0x15,0x00,
+0x12,0xfe,0x15,0x00,0x31,0x0b,0xff,0xff,0xc5,0x08,0x11,0xf8,0xe9,0x02,0x11,0xfd,
+0x15,0x00,0x21,0xfa,0x0d,0x15,0x00,0x02,0x7c,0x02,0x02,0xb3,0x00,0x40,0x0b,0xff,
+0xf9,0x0d,0x33,0x00,0x12,0x03,0xfd,0x03,0x10,0x4f,0x8c,0x01,0x00,0x93,0x00,0x01,
+0x15,0x00,0x12,0x04,0xd9,0x08,0x10,0x5f,0x45,0x00,0x00,0xbd,0x00,0x01,0x15,0x00,
+0x12,0x05,0x41,0x03,0x10,0x7f,0x37,0x02,0x00,0xe7,0x00,0x04,0x15,0x00,0x11,0xf2,
+0xec,0x00,0x11,0xf6,0x1b,0x00,0x41,0xe0,0x0c,0xff,0xff,0x54,0x00,0x11,0xf4,0x03,
+0x04,0x11,0xf5,0x8a,0x00,0x11,0x90,0xa8,0x00,0x11,0x01,0xa7,0x01,0x10,0x09,0x15,
+0x00,0x00,0x60,0x01,0x23,0x30,0x08,0x59,0x01,0x20,0xff,0x30,0x10,0x07,0x10,0xf9,
+0xad,0x03,0x10,0xfc,0x4f,0x00,0x12,0x80,0x0f,0x02,0x21,0x7b,0xff,0x24,0x0b,0x30,
+0xef,0xff,0xf2,0x35,0x01,0x14,0xc0,0x74,0x04,0x12,0xed,0x7e,0x01,0x10,0x70,0xb8,
+0x01,0x12,0xf1,0xbf,0x03,0x35,0xff,0xff,0x44,0x15,0x0b,0x33,0x9f,0xff,0xf8,0x13,
+0x0a,0x11,0xe3,0x01,0x0a,0x21,0xfe,0x50,0xf6,0x02,0x00,0x45,0x01,0xce,0x02,0x9d,
+0xfe,0xc6,0x00,0x00,0x02,0x8d,0xff,0xdb,0x50,0x00,0x21,0x02,0x03,0x85,0x06,0x03,
+0xfd,0x0a,0x0a,0x01,0x00,0x16,0xbf,0x30,0x09,0x06,0x01,0x00,0x16,0x1e,0x3f,0x03,
+0x09,0x40,0x00,0x23,0xff,0xc4,0x0c,0x00,0x03,0x7f,0x03,0x03,0x8a,0x0a,0x10,0xd8,
+0xaa,0x02,0x36,0x14,0x8d,0xf3,0x2b,0x00,0x11,0xef,0xcf,0x00,0x29,0xcc,0xdf,0x48,
+0x00,0x06,0x62,0x06,0x17,0xfb,0x57,0x00,0x14,0x3b,0x15,0x00,0x18,0xf8,0x6d,0x00,
+0x12,0x27,0x9c,0x05,0x2a,0xb7,0x10,0x84,0x00,0x4b,0x24,0x66,0x77,0x65,0x3d,0x08,
+0x2b,0x0c,0xff,0xc2,0x00,0x16,0x2f,0xa8,0x04,0x06,0xc4,0x04,0x18,0xf1,0x11,0x00,
+0x17,0xef,0x1f,0x04,0x04,0xda,0x00,0x02,0x3e,0x03,0x17,0x00,0xe7,0x09,0x04,0x64,
+0x04,0x06,0x9e,0x06,0x06,0x9e,0x03,0x03,0x81,0x0b,0x19,0xe0,0x48,0x01,0x06,0xf0,
+0x07,0x03,0x3b,0x06,0x18,0xdf,0xea,0x00,0x00,0xbb,0x05,0x16,0x6c,0x7a,0x05,0x02,
+0x6c,0x0c,0x12,0x17,0xef,0x01,0x05,0xc1,0x04,0x26,0xfc,0x02,0x7b,0x05,0x01,0xb9,
+0x00,0x11,0xf6,0xb2,0x0b,0x07,0xb9,0x00,0x12,0xf1,0x6c,0x0d,0x06,0xb9,0x00,0x01,
+0x77,0x09,0x17,0xfe,0xff,0x0a,0x11,0x70,0x5a,0x00,0x16,0x40,0xb9,0x00,0x36,0x20,
+0x00,0x08,0x1b,0x05,0x11,0x6f,0xea,0x00,0x11,0x03,0x7e,0x0b,0x04,0x19,0x06,0x12,
+0xf8,0x19,0x0c,0x15,0xf6,0x53,0x05,0x14,0xf2,0x37,0x0c,0x04,0x47,0x0b,0x13,0xd0,
+0x60,0x05,0x14,0x20,0xb9,0x00,0x00,0x98,0x0d,0x13,0x0e,0x08,0x00,0x01,0x1a,0x00,
+0x06,0xc1,0x06,0x06,0x38,0x09,0x06,0xac,0x07,0x17,0xef,0x11,0x00,0x13,0xf9,0x9a,
+0x06,0x06,0x01,0x00,0x03,0x52,0x06,0x06,0x01,0x00,0x14,0x50,0x12,0x03,0x07,0x11,
+0x0c,0x15,0x7f,0x92,0x01,0x12,0x08,0xd0,0x01,0x15,0xcf,0xb4,0x01,0x11,0x03,0xd0,
+0x01,0x17,0x02,0x44,0x02,0x10,0xdf,0x1c,0x00,0x13,0x08,0xca,0x00,0x04,0x04,0x02,
+0x27,0x30,0x0e,0xac,0x06,0x10,0x2f,0xd0,0x01,0x17,0x4f,0x7f,0x01,0x10,0x0d,0xd0,
+0x01,0x00,0xfa,0x06,0x04,0x60,0x02,0x50,0x07,0xff,0xff,0xff,0xf5,0x21,0xdf,0xff,
+0x01,0x00,0x84,0xed,0xb8,0x40,0x00,0x00,0x00,0x0d,0xff,0x01,0x00,0x65,0xe9,0x10,
+0x00,0x00,0xdf,0xff,0x01,0x00,0x17,0x60,0x1b,0x00,0x38,0xff,0xff,0x70,0x1b,0x00,
+0x28,0xff,0x40,0x1b,0x00,0x10,0xfd,0x1b,0x00,0xa0,0xf8,0x00,0x00,0x00,0x15,0xbf,
+0xff,0xff,0xff,0xf3,0x1b,0x00,0x60,0x80,0x00,0x00,0x00,0x00,0x8f,0x09,0x00,0x03,
+0x1b,0x00,0x65,0x00,0x00,0xef,0xff,0xff,0xfa,0x1b,0x00,0x55,0x0a,0xff,0xff,0xff,
+0xb0,0x1b,0x00,0x49,0x9f,0xff,0xff,0xfb,0x1b,0x00,0x18,0x90,0x36,0x00,0x18,0xf5,
+0x51,0x00,0x15,0xfe,0x6c,0x00,0x10,0xcf,0xa3,0x00,0x08,0x87,0x00,0x1f,0x90,0xbd,
+0x00,0x06,0x19,0x60,0xd8,0x00,0x19,0xd4,0xd8,0x00,0x10,0xf5,0x1b,0x00,0x69,0xfa,
+0x44,0x44,0x44,0x56,0xaf,0xbd,0x00,0x19,0x3e,0xa2,0x00,0x54,0x5f,0xff,0xff,0xff,
+0x2d,0x1b,0x00,0x55,0x00,0xff,0xff,0xff,0xf6,0x1b,0x00,0x55,0x0c,0xff,0xff,0xff,
+0x8d,0x1b,0x00,0x45,0xcf,0xff,0xff,0xf9,0x1b,0x00,0x18,0x0d,0x1b,0x00,0x19,0x03,
+0x36,0x00,0x00,0xbe,0x00,0x13,0x3d,0x1b,0x00,0x10,0x15,0x9d,0x00,0x10,0xe0,0x05,
+0x00,0x40,0xee,0xee,0xee,0xef,0x95,0x00,0x18,0xf7,0xa2,0x00,0x18,0xfe,0xbd,0x00,
+0x37,0xfe,0x20,0x0d,0x79,0x01,0x17,0x20,0x1b,0x00,0x16,0xd7,0xcb,0x01,0x02,0xd9,
+0x01,0x00,0x01,0x00,0x73,0x01,0x6a,0xde,0xff,0xec,0xa6,0x20,0x0e,0x00,0x21,0x02,
+0xaf,0x1f,0x00,0x13,0xfb,0x1e,0x00,0x13,0x8f,0x2f,0x00,0x15,0xfa,0xc8,0x00,0x02,
+0x01,0x00,0x14,0xd1,0xa1,0x00,0x03,0x66,0x00,0x47,0x10,0x00,0x00,0x09,0x90,0x00,
+0xc1,0xb0,0x00,0x00,0x4f,0xff,0xff,0xff,0xfc,0x62,0x00,0x25,0xbf,0x41,0x01,0x21,
+0x00,0xdf,0x20,0x02,0x31,0x00,0x00,0x04,0x0d,0x02,0x24,0x04,0xff,0xe5,0x00,0xa5,
+0x6f,0xff,0xff,0xff,0x30,0x0b,0xff,0xff,0xff,0xd0,0x0f,0x01,0x23,0x90,0x0f,0x2c,
+0x00,0x70,0x00,0x00,0x08,0xff,0xff,0xff,0xc0,0x4a,0x00,0x02,0x9f,0x00,0x51,0x05,
+0xff,0xff,0xff,0xf0,0xe2,0x01,0x02,0xba,0x00,0x83,0x66,0x66,0x66,0x60,0xaf,0xff,
+0xff,0xfb,0xbc,0x00,0x03,0x94,0x00,0x16,0xfa,0x0f,0x00,0x00,0x77,0x00,0x17,0xf9,
+0x0f,0x00,0x14,0xef,0x77,0x00,0x0f,0x0f,0x00,0x20,0x1a,0xcf,0x4b,0x00,0x1a,0xbf,
+0x0f,0x00,0x0b,0x87,0x00,0x10,0x8f,0xe6,0x00,0x02,0x01,0x00,0x40,0x33,0x33,0x33,
+0x30,0xc3,0x00,0x16,0x10,0xc3,0x00,0x12,0x1f,0x71,0x02,0x03,0xe1,0x00,0x20,0xd0,
+0x0b,0xe6,0x00,0x05,0xff,0x00,0x20,0xa0,0x05,0x06,0x02,0x05,0x53,0x02,0x20,0x40,
+0x00,0xef,0x01,0x13,0x50,0x3b,0x01,0x12,0xfe,0x15,0x00,0x22,0xfb,0x51,0x59,0x01,
+0x12,0xf7,0x0c,0x03,0x03,0x01,0x00,0x00,0x44,0x01,0x26,0x01,0xdf,0x08,0x02,0x00,
+0x35,0x01,0x15,0x1d,0x0f,0x00,0x11,0xe2,0x33,0x01,0x14,0xaf,0xd1,0x01,0x02,0x8f,
+0x00,0x29,0x04,0xcf,0xef,0x01,0x44,0x00,0x02,0x7b,0xdf,0x0d,0x02,0x12,0xdf,0x28,
+0x02,0x12,0xa7,0x7b,0x01,0x04,0x57,0x00,0x28,0xfc,0x50,0x0e,0x00,0x38,0xff,0xfd,
+0x30,0x0e,0x00,0x01,0xb7,0x00,0x07,0x8a,0x02,0x19,0x80,0x0e,0x00,0x23,0xf6,0x00,
+0x99,0x03,0x30,0x13,0x8e,0xff,0xf6,0x01,0x04,0xa7,0x03,0x21,0x01,0xaf,0x00,0x01,
+0x04,0xf8,0x02,0x11,0x0a,0x2b,0x00,0x05,0x06,0x03,0x17,0xdf,0x3d,0x04,0x02,0xfd,
+0x00,0x15,0x30,0x0e,0x00,0x19,0x0e,0x3e,0x04,0x10,0x09,0x02,0x01,0x05,0x0e,0x00,
+0x10,0x06,0x69,0x01,0x05,0x0e,0x00,0x00,0x5a,0x03,0x15,0xf2,0x0e,0x00,0x55,0x02,
+0xff,0xff,0xff,0xf4,0x0e,0x00,0x1d,0x01,0x0e,0x00,0x1e,0xf5,0x0e,0x00,0x0e,0x2a,
+0x00,0x0b,0x46,0x00,0x19,0x04,0x62,0x00,0x0a,0x7e,0x00,0x19,0x0a,0x9a,0x00,0x19,
+0x0e,0xbe,0x04,0x01,0xe4,0x01,0x08,0xcc,0x04,0x1e,0xfd,0x0a,0x01,0x05,0x26,0x01,
+0x13,0xd0,0x0e,0x00,0x21,0x03,0x8e,0x62,0x05,0x01,0x5e,0x01,0x02,0x0f,0x04,0x29,
+0xff,0xf7,0x6c,0x01,0x18,0x90,0x0e,0x00,0x1f,0xf7,0xb2,0x01,0x06,0x2e,0xfd,0x50,
+0xea,0x01,0x08,0xc4,0x05,0x0f,0x0c,0x00,0x28,0x27,0xfe,0xdf,0x3f,0x03,0x0f,0x0c,
+0x00,0x50,0x03,0x01,0x00,0x1f,0xf9,0x0c,0x00,0x21,0x21,0xfe,0xcc,0x01,0x00,0x2f,
+0xc6,0x00,0xb4,0x00,0x5d,0x13,0xee,0x01,0x00,0x0f,0x74,0x01,0x34,0x1f,0xf5,0x0c,
+0x00,0x28,0x1f,0xf4,0xfc,0x00,0x63,0x1f,0xe8,0xbc,0x01,0x2d,0x0e,0xb4,0x00,0x0f,
+0x0c,0x00,0x8c,0x01,0x01,0x00,0x64,0x59,0xce,0xff,0xed,0xb8,0x50,0x82,0x07,0x12,
+0x9f,0xd0,0x00,0x25,0x92,0x00,0x13,0x07,0x03,0x50,0x09,0x03,0x05,0x04,0x07,0x84,
+0x07,0x19,0xaf,0xe4,0x03,0x27,0x07,0xff,0xc1,0x01,0x30,0x00,0x00,0x2f,0x78,0x03,
+0x41,0x72,0x00,0x02,0x7e,0x65,0x07,0x01,0x2c,0x00,0x13,0xc1,0xac,0x06,0x32,0xff,
+0x40,0x02,0x15,0x00,0x04,0x66,0x06,0x12,0x08,0x33,0x00,0x03,0xac,0x04,0x25,0xe0,
+0x0d,0x84,0x06,0x00,0xbb,0x08,0x25,0xf1,0x1f,0x83,0x07,0x56,0x00,0x56,0x66,0x66,
+0x61,0x83,0x07,0x01,0x01,0x00,0x47,0x7f,0xff,0xff,0xff,0xcd,0x00,0x16,0x9f,0xed,
+0x06,0x03,0xa3,0x00,0x1e,0xfc,0x0f,0x00,0x21,0x04,0x66,0x01,0x00,0x22,0x61,0xbf,
+0x29,0x07,0x13,0x0b,0xb5,0x00,0x0e,0x0f,0x00,0x17,0xfc,0x0f,0x00,0x1a,0xaf,0x0f,
+0x00,0x03,0x69,0x00,0x04,0x0f,0x00,0x07,0x87,0x00,0x00,0x0f,0x00,0x11,0x4f,0x55,
+0x06,0x05,0x0f,0x00,0x07,0xc3,0x00,0x00,0x0f,0x00,0x15,0x0d,0x64,0x08,0x01,0x0f,
+0x00,0x15,0x08,0x65,0x07,0x01,0x0f,0x00,0x14,0x01,0x30,0x07,0x02,0x0f,0x00,0x10,
+0x00,0x92,0x01,0x14,0xe3,0xb0,0x07,0x30,0xf4,0x00,0x1f,0x70,0x00,0x13,0xa4,0xbe,
+0x0a,0x32,0xf4,0x00,0x05,0x81,0x00,0x14,0xef,0x78,0x01,0x17,0x8f,0x87,0x01,0x12,
+0xc0,0xd5,0x07,0x08,0xb4,0x01,0x15,0x4e,0x14,0x05,0x02,0xf2,0x01,0x17,0x7e,0x4b,
+0x07,0x00,0x01,0x00,0x79,0x38,0xbd,0xff,0xfe,0xdb,0x85,0x10,0x28,0x02,0x10,0x03,
+0x86,0x01,0x0f,0x0f,0x00,0xc2,0x07,0x01,0x00,0x0f,0x0f,0x00,0x3c,0x0f,0x3b,0x01,
+0xcb,0x00,0x29,0x08,0x0f,0x04,0x00,0x79,0x04,0xe0,0x03,0x01,0xc3,0x0a,0x0e,0xf8,
+0x0a,0x0f,0x19,0x00,0xff,0x08,0x02,0x11,0x0d,0x01,0x19,0x00,0x23,0xfc,0x0e,0xa5,
+0x04,0x10,0x0b,0x93,0x05,0x12,0xcf,0x0c,0x05,0x10,0x01,0x1d,0x0d,0x10,0x08,0x6a,
+0x0e,0x03,0xf0,0x05,0x01,0x3f,0x0c,0x41,0xe6,0x10,0x02,0xbf,0x57,0x00,0x15,0xcf,
+0x7b,0x04,0x35,0xf5,0x00,0x04,0x00,0x03,0x12,0xfb,0xc8,0x05,0x02,0x59,0x04,0x16,
+0x00,0x0d,0x00,0x17,0xfb,0xd5,0x0d,0x12,0xd5,0x85,0x00,0x90,0x16,0xad,0xef,0xfe,
+0xc8,0x40,0x00,0x00,0x00,0x50,0xdf,0xff,0xff,0xf8,0x00,0x01,0x00,0x65,0x09,0xff,
+0xff,0xff,0xff,0x60,0x0f,0x00,0x64,0x5f,0xff,0xff,0xff,0xf9,0x00,0x0f,0x00,0x10,
+0x02,0x1d,0x00,0x15,0xc0,0x0f,0x00,0x65,0x0d,0xff,0xff,0xff,0xfe,0x10,0x0f,0x00,
+0x64,0xaf,0xff,0xff,0xff,0xf4,0x00,0x0f,0x00,0x10,0x06,0x2c,0x00,0x15,0x70,0x0f,
+0x00,0x64,0x3f,0xff,0xff,0xff,0xfa,0x00,0x0f,0x00,0x65,0x01,0xef,0xff,0xff,0xff,
+0xd0,0x0f,0x00,0x10,0x0b,0x2c,0x00,0x15,0x20,0x0f,0x00,0x12,0x7f,0x49,0x00,0x03,
+0x0f,0x00,0x10,0x04,0x1d,0x00,0x15,0x80,0x0f,0x00,0x65,0x1e,0xff,0xff,0xff,0xfb,
+0x00,0x0f,0x00,0x55,0xbf,0xff,0xff,0xff,0xd1,0x0f,0x00,0x14,0x07,0x49,0x00,0x02,
+0x0f,0x00,0x00,0x75,0x00,0x25,0xf5,0x00,0x0f,0x00,0x55,0xdf,0xff,0xff,0xff,0x90,
+0x0f,0x00,0x13,0xff,0xa1,0x00,0x08,0x0f,0x00,0x1a,0xf2,0x0f,0x00,0x1a,0xfc,0x0f,
+0x00,0x2a,0xff,0x70,0x0f,0x00,0x16,0xf2,0x0f,0x00,0x18,0xfd,0x96,0x00,0x31,0xff,
+0xff,0x72,0x46,0x01,0x04,0x0f,0x00,0x11,0xf8,0xd2,0x00,0x14,0xf1,0x0f,0x00,0x34,
+0x90,0x00,0x0d,0x2e,0x00,0x11,0xdf,0x08,0x00,0x10,0x03,0x2e,0x00,0x25,0x50,0x00,
+0x2c,0x01,0x56,0x9f,0xff,0xff,0xff,0xe1,0x0f,0x00,0x19,0x0e,0x3b,0x01,0x20,0x00,
+0x05,0x2e,0x00,0x29,0x40,0x00,0x77,0x01,0x16,0xe0,0x0f,0x00,0x11,0x1f,0xb2,0x01,
+0x05,0x0f,0x00,0x01,0x87,0x01,0x25,0x30,0x00,0xd1,0x01,0x11,0xcf,0x79,0x01,0x05,
+0x0f,0x00,0x11,0x2f,0x9f,0x00,0x05,0x0f,0x00,0x11,0x08,0x2e,0x00,0x05,0x0f,0x00,
+0x01,0xaf,0x00,0x16,0xc0,0x0f,0x00,0x2f,0x00,0x00,0x0c,0x00,0xff,0x4d,0x22,0xff,
+0xee,0x01,0x00,0x35,0xe0,0xdf,0xff,0x01,0x00,0x1f,0xf0,0x0c,0x00,0x21,0x14,0xfe,
+0x55,0x00,0x01,0x5c,0x02,0x23,0xf9,0xdf,0x34,0x02,0x06,0xe3,0x03,0x02,0x13,0x00,
+0x13,0x90,0x13,0x00,0x16,0x0e,0x13,0x00,0x13,0xf0,0x13,0x00,0x16,0x4f,0x13,0x00,
+0x13,0xf5,0x13,0x00,0x16,0x9f,0x13,0x00,0x13,0xfa,0x13,0x00,0x16,0xef,0x13,0x00,
+0x12,0xff,0x12,0x00,0x27,0x04,0xff,0x13,0x00,0x11,0x50,0x13,0x00,0x18,0x0a,0x13,
+0x00,0x11,0xb0,0x13,0x00,0x15,0x0f,0x13,0x00,0x13,0xef,0x1a,0x03,0x00,0x6b,0x04,
+0x12,0xef,0x13,0x00,0x40,0xdc,0xff,0xff,0xf6,0x13,0x00,0x00,0xdd,0x03,0x12,0x9f,
+0x13,0x00,0x13,0xd6,0x8d,0x03,0x52,0x01,0xff,0xff,0xff,0x4f,0x13,0x00,0x52,0xe1,
+0xff,0xff,0xff,0x10,0xe2,0x02,0x22,0xfc,0x3f,0x13,0x00,0x21,0xf0,0xbf,0xa4,0x03,
+0x00,0x50,0x04,0x14,0xf6,0x13,0x00,0x11,0x5f,0x69,0x04,0x00,0x17,0x03,0x23,0xf1,
+0x4f,0x13,0x00,0x11,0x0f,0xbb,0x03,0x00,0x95,0x03,0x22,0xb0,0x5f,0x13,0x00,0x21,
+0xf1,0x0a,0x88,0x01,0x00,0x1e,0x03,0x14,0x50,0x13,0x00,0x42,0x04,0xff,0xff,0xfd,
+0xf3,0x04,0x22,0x00,0x6f,0x13,0x00,0x30,0xf2,0x00,0xef,0x4c,0x03,0x10,0x07,0x61,
+0x03,0x12,0x7f,0x13,0x00,0x33,0xf3,0x00,0x8f,0xd1,0x03,0x14,0xf4,0x13,0x00,0x30,
+0xf4,0x00,0x3f,0x91,0x03,0x10,0x2f,0x05,0x00,0x14,0x8f,0x13,0x00,0x01,0x21,0x00,
+0x10,0x8f,0xc8,0x04,0x03,0xd1,0x00,0x33,0xf5,0x00,0x07,0x5a,0x05,0x14,0x20,0x13,
+0x00,0x10,0xf6,0x6d,0x00,0x21,0xfe,0x03,0x77,0x00,0x14,0xaf,0x13,0x00,0x00,0x93,
+0x00,0x41,0x49,0xff,0xff,0xf7,0x0d,0x01,0x20,0xf9,0xdf,0x0a,0x00,0x00,0x8f,0x00,
+0x11,0xae,0x36,0x01,0x06,0x13,0x00,0x22,0x1f,0xff,0x9b,0x05,0x00,0x2f,0x00,0x17,
+0xf9,0x55,0x05,0x28,0xff,0x60,0x13,0x00,0x11,0x05,0x13,0x00,0x18,0x10,0x13,0x00,
+0x14,0x00,0xce,0x01,0x07,0x13,0x00,0x13,0xaf,0xf4,0x01,0x07,0x13,0x00,0x13,0x4f,
+0x1a,0x02,0x07,0x13,0x00,0x13,0x0e,0x40,0x02,0x07,0x13,0x00,0x13,0x08,0x66,0x02,
+0x07,0x13,0x00,0x13,0x03,0x8c,0x02,0x06,0x13,0x00,0x00,0xe9,0x02,0x17,0xf8,0x13,
+0x00,0x16,0xfc,0xa9,0x02,0x24,0xf1,0xdf,0x37,0x05,0x06,0x0f,0x00,0x1a,0xe1,0x0f,
+0x00,0x1a,0xf9,0x0f,0x00,0x2a,0xff,0x30,0x0f,0x00,0x1a,0xc0,0x0f,0x00,0x1a,0xf6,
+0x0f,0x00,0x29,0xfe,0x10,0x0f,0x00,0x2a,0xff,0x90,0x0f,0x00,0x1a,0xf3,0x0f,0x00,
+0x1a,0xfc,0x0f,0x00,0x26,0xff,0x60,0x0f,0x00,0x12,0xfd,0x99,0x00,0x04,0x0f,0x00,
+0x10,0xf8,0xcb,0x00,0x07,0x0f,0x00,0x11,0x3f,0x99,0x00,0x05,0x0f,0x00,0x11,0x09,
+0x99,0x00,0x05,0x0f,0x00,0x00,0xfd,0x06,0x16,0xf6,0x0f,0x00,0x20,0x00,0x6f,0x94,
+0x01,0x06,0x0f,0x00,0x56,0x0c,0xff,0xff,0xff,0xa0,0x0f,0x00,0x10,0x03,0x99,0x00,
+0x06,0x0f,0x00,0x00,0x2d,0x02,0x17,0xfd,0x0f,0x00,0x00,0x0f,0x07,0x16,0x63,0x0f,
+0x00,0x10,0x06,0xbb,0x01,0x06,0x0f,0x00,0x00,0x64,0x01,0x17,0xfd,0x0f,0x00,0x00,
+0xef,0x05,0x07,0x0f,0x00,0x1a,0x09,0x0f,0x00,0x2a,0x00,0xef,0x0f,0x00,0x1a,0x5f,
+0x0f,0x00,0x1a,0x0c,0x0f,0x00,0x1a,0x02,0x0f,0x00,0x2a,0x00,0x9f,0x0f,0x00,0x1a,
+0x0e,0x0f,0x00,0x1a,0x05,0x0f,0x00,0x2a,0x00,0xcf,0x0f,0x00,0x1a,0x2f,0x0f,0x00,
+0x24,0x08,0xff,0x16,0x04,0x64,0x48,0xce,0xff,0xed,0xa6,0x10,0xce,0x04,0x12,0x07,
+0xa2,0x00,0x13,0xb3,0x0f,0x00,0x13,0x4e,0xf3,0x04,0x03,0x8e,0x04,0x14,0x8f,0x03,
+0x05,0x29,0xfd,0x20,0x0f,0x00,0x35,0xff,0xfe,0x20,0xce,0x00,0x05,0xda,0x01,0x01,
+0x32,0x03,0x41,0x94,0x21,0x37,0xcf,0x02,0x07,0x01,0xa4,0x04,0x32,0xfc,0x20,0x00,
+0x7d,0x08,0x11,0xf2,0xdd,0x00,0x11,0xfd,0x77,0x00,0x10,0x6f,0x8f,0x01,0x24,0x00,
+0x9f,0x6b,0x02,0x01,0x71,0x08,0x21,0x10,0x0e,0x15,0x00,0x04,0x5d,0x02,0x26,0xf6,
+0x03,0x25,0x05,0x10,0x0d,0x1a,0x00,0x15,0x7f,0x0e,0x05,0x00,0x85,0x00,0x23,0xfe,
+0x09,0xed,0x08,0x03,0x07,0x01,0x26,0xf1,0xcf,0x40,0x05,0x00,0x2a,0x02,0x16,0x3d,
+0x89,0x05,0x10,0x02,0xfa,0x08,0x16,0xef,0x14,0x06,0x00,0xa5,0x00,0x14,0x5e,0xff,
+0x08,0x02,0xad,0x03,0x17,0xf5,0x1f,0x00,0x1a,0x0f,0x1f,0x00,0x10,0x01,0x1f,0x00,
+0x14,0xdf,0x24,0x03,0x02,0x55,0x01,0x15,0x4c,0xaa,0x00,0x02,0x4a,0x02,0x11,0x9f,
+0x5f,0x04,0x05,0xdc,0x09,0x16,0x17,0xf2,0x05,0x10,0x08,0x48,0x08,0x15,0x3f,0xb5,
+0x05,0x00,0x9b,0x04,0x10,0xfa,0x12,0x02,0x16,0xfb,0xaa,0x00,0x23,0x60,0x09,0x26,
+0x03,0x02,0x5e,0x04,0x11,0xf1,0x62,0x00,0x14,0xd1,0xd8,0x00,0x12,0xfa,0x3a,0x04,
+0x14,0xc1,0x76,0x08,0x11,0x20,0x91,0x00,0x53,0xff,0xf8,0x31,0x02,0x5b,0x6d,0x03,
+0x16,0x05,0x83,0x01,0x01,0x11,0x01,0x16,0x08,0x0f,0x00,0x29,0xe2,0x00,0x10,0x00,
+0x12,0xe2,0x4c,0x06,0x13,0xef,0x0f,0x00,0x13,0xa1,0xb3,0x00,0x12,0x7e,0xbf,0x01,
+0x14,0x40,0x10,0x02,0x68,0x04,0x8c,0xef,0xfe,0xda,0x72,0x96,0x09,0x03,0x0f,0x00,
+0x06,0x10,0x07,0x19,0xc4,0x0e,0x00,0x29,0xff,0xb1,0x0e,0x00,0x28,0xfe,0x20,0x0e,
+0x00,0x29,0xff,0xd1,0x0e,0x00,0x14,0xfa,0x9e,0x07,0x2a,0x01,0x5d,0x17,0x09,0x10,
+0xaf,0x54,0x01,0x05,0x0e,0x00,0x13,0x0d,0x74,0x07,0x24,0xf8,0x00,0x70,0x09,0x15,
+0xf2,0x0e,0x00,0x01,0xd0,0x01,0x06,0xd7,0x02,0x03,0xa0,0x01,0x0e,0x0e,0x00,0x03,
+0x9d,0x01,0x05,0x0e,0x00,0x19,0x0a,0x0f,0x03,0x17,0x6f,0x86,0x09,0x24,0x01,0x4a,
+0xa1,0x0b,0x15,0xff,0xee,0x02,0x09,0xb6,0x00,0x19,0xf3,0x0e,0x00,0x18,0x40,0x0e,
+0x00,0x18,0xd3,0xfc,0x00,0x17,0xd7,0x34,0x01,0x2c,0xdb,0x73,0x8c,0x08,0x0f,0x0e,
+0x00,0x97,0x01,0x01,0x00,0x19,0x49,0x26,0x04,0x1a,0x18,0x26,0x04,0x13,0x5e,0xf2,
+0x00,0x17,0xf9,0xc6,0x08,0x15,0xff,0xe0,0x03,0x29,0x9f,0xff,0x10,0x00,0x1a,0x6f,
+0x26,0x04,0x13,0x2f,0x26,0x04,0x25,0xdf,0xff,0x54,0x07,0x10,0xfc,0x27,0x00,0x02,
+0xd1,0x0b,0x15,0x03,0x24,0x0c,0x11,0x7f,0xe1,0x02,0x15,0x9f,0x7e,0x0c,0x10,0xcf,
+0x02,0x04,0x15,0x0f,0xd9,0x03,0x01,0x21,0x04,0x14,0x03,0xd7,0x0c,0x03,0x3c,0x07,
+0x07,0x26,0x04,0x00,0x96,0x03,0x14,0x0a,0xbf,0x06,0x02,0x45,0x02,0x12,0xf0,0x54,
+0x06,0x05,0x8c,0x09,0x16,0x2e,0xe8,0x03,0x10,0x02,0xe7,0x01,0x07,0x07,0x04,0x12,
+0x2f,0x15,0x09,0x04,0xcd,0x0c,0x13,0x01,0x04,0x06,0x1e,0xf7,0x45,0x04,0x0e,0x94,
+0x02,0x0d,0x26,0x04,0x10,0x04,0xc1,0x02,0x15,0xaf,0x97,0x07,0x01,0x11,0x01,0x16,
+0x07,0x26,0x04,0x14,0x09,0x26,0x04,0x15,0x40,0x01,0x0a,0x26,0xfa,0x00,0x83,0x05,
+0x05,0x26,0x04,0x15,0xf2,0x26,0x04,0x34,0xf0,0x00,0x3f,0xda,0x00,0x12,0x06,0x86,
+0x01,0x18,0xbf,0x26,0x04,0x12,0x10,0x49,0x06,0x43,0xe8,0x31,0x02,0x6c,0xe9,0x0d,
+0x17,0x06,0xc0,0x02,0x16,0xc0,0xa6,0x06,0x02,0xa1,0x03,0x09,0x26,0x04,0x12,0xd1,
+0x54,0x05,0x04,0x26,0x04,0x13,0xfb,0x00,0x01,0x18,0x8e,0x07,0x06,0x00,0xd3,0x00,
+0x46,0x9c,0xef,0xfe,0xdf,0x8f,0x0a,0x06,0x3b,0x06,0x16,0x80,0x10,0x00,0x16,0x2d,
+0x9c,0x0a,0x05,0x82,0x03,0x16,0xf5,0x62,0x02,0x00,0xae,0x09,0x18,0xe3,0x72,0x02,
+0x38,0x04,0xff,0xe2,0x0f,0x00,0x50,0x00,0x02,0xa1,0x00,0x00,0x21,0xdf,0xff,0x01,
+0x00,0x94,0xed,0xc9,0x51,0x00,0x00,0x00,0x00,0xdf,0xff,0x01,0x00,0x19,0xa3,0x0e,
+0x00,0x29,0xff,0x80,0x0e,0x00,0x19,0xfa,0x0e,0x00,0x29,0xff,0x90,0x0e,0x00,0x10,
+0xf3,0x0e,0x00,0xa4,0xf8,0x00,0x00,0x00,0x03,0x9f,0xff,0xff,0xff,0xfb,0x0e,0x00,
+0x20,0x00,0x04,0x1d,0x00,0x05,0x0e,0x00,0x65,0x00,0x8f,0xff,0xff,0xff,0x40,0x0e,
+0x00,0x55,0x1f,0xff,0xff,0xff,0x60,0x0e,0x00,0x55,0x0e,0xff,0xff,0xff,0x70,0x0e,
+0x00,0x19,0x0d,0x0e,0x00,0x19,0x0e,0x2a,0x00,0x19,0x1f,0x46,0x00,0x00,0x54,0x00,
+0x14,0x10,0x0e,0x00,0x18,0x05,0x7e,0x00,0x69,0x14,0xaf,0xff,0xff,0xff,0xf4,0xa8,
+0x00,0x18,0xa0,0x0e,0x00,0x19,0xfc,0xd2,0x00,0x18,0xb0,0x0e,0x00,0x19,0xe6,0x0a,
+0x01,0x19,0x60,0x0e,0x00,0x33,0xd0,0x00,0x00,0x62,0x00,0x55,0x06,0xff,0xff,0xff,
+0xf6,0x0e,0x00,0x00,0x07,0x00,0x16,0xfe,0x0e,0x00,0x10,0x5f,0xc2,0x00,0x05,0x0e,
+0x00,0x00,0xd0,0x00,0x15,0xe0,0x0e,0x00,0x00,0xa7,0x00,0x15,0xf7,0x0e,0x00,0x03,
+0x39,0x00,0x04,0x0e,0x00,0x11,0x5f,0x7b,0x01,0x04,0x0e,0x00,0x59,0x0c,0xff,0xff,
+0xff,0xf1,0x50,0x01,0x16,0xf8,0x50,0x01,0x18,0xcf,0xfc,0x00,0x20,0x00,0x4f,0x97,
+0x01,0x05,0x0e,0x00,0x01,0x39,0x00,0x05,0x0e,0x00,0x00,0x39,0x00,0x20,0xf9,0x00,
+0xa1,0x01,0x71,0x8b,0xdf,0xff,0xec,0xa6,0x10,0x00,0x01,0x00,0x22,0x07,0xef,0xdb,
+0x01,0x11,0x20,0x3c,0x01,0x02,0x0d,0x00,0x03,0x28,0x00,0x15,0x7f,0xf0,0x00,0x12,
+0xc0,0xe9,0x00,0x03,0x01,0x00,0x12,0xfb,0x80,0x01,0x51,0xff,0xfe,0xde,0xff,0xff,
+0xe2,0x00,0x10,0x9f,0xcc,0x00,0x41,0x10,0x00,0x04,0xcf,0xe2,0x00,0x40,0xef,0xff,
+0xff,0xfe,0x4e,0x00,0x10,0x09,0x1b,0x01,0x13,0x01,0x20,0x01,0x10,0x00,0x17,0x00,
+0x64,0xfa,0x03,0xff,0xff,0xff,0xf2,0xb3,0x01,0x21,0xfd,0x02,0x36,0x02,0x00,0x01,
+0x00,0x54,0x5e,0xee,0xee,0xed,0x00,0x77,0x00,0x15,0x00,0xd8,0x00,0x15,0x80,0x0e,
+0x00,0x00,0x11,0x01,0x24,0xfd,0x50,0x0e,0x00,0x11,0x0c,0x7e,0x00,0x13,0x93,0x0e,
+0x00,0x12,0x01,0xb5,0x00,0x22,0xe9,0x30,0x0f,0x00,0x12,0x2d,0xa5,0x00,0x22,0xfd,
+0x60,0x0f,0x00,0x12,0x9f,0x0f,0x00,0x12,0xfe,0x3d,0x00,0x23,0x03,0xbf,0xc3,0x00,
+0x12,0x10,0x0f,0x00,0x03,0x1e,0x00,0x13,0xe2,0x4b,0x00,0x12,0x5b,0x3b,0x00,0x13,
+0x10,0x0f,0x00,0x22,0x06,0xcf,0x31,0x02,0x26,0x00,0x00,0x3d,0x00,0x15,0xf2,0x94,
+0x00,0x10,0x07,0x89,0x01,0x45,0x28,0x88,0x88,0x88,0xb1,0x00,0x20,0xfc,0x3f,0x8d,
+0x01,0x13,0x00,0x3c,0x01,0x10,0xfe,0x25,0x01,0x02,0x77,0x00,0x52,0x6f,0xff,0xff,
+0xfe,0x0e,0x48,0x01,0x02,0x93,0x00,0x33,0xfd,0x08,0xff,0x97,0x01,0x10,0x03,0x8e,
+0x00,0x10,0x02,0x68,0x00,0x40,0xc5,0x00,0x00,0x01,0x73,0x01,0x12,0xf5,0x79,0x01,
+0x41,0xfe,0xdd,0xef,0xff,0x50,0x01,0x16,0x0b,0xbd,0x02,0x00,0x4f,0x00,0x15,0xaf,
+0x0d,0x00,0x10,0xf7,0xa3,0x00,0x28,0xef,0xff,0xe1,0x00,0x22,0x07,0xdf,0x0d,0x00,
+0x13,0x81,0xb2,0x00,0xb9,0x7a,0xde,0xff,0xed,0xb8,0x40,0x00,0x00,0x00,0x0f,0xff,
+0x01,0x00,0x0f,0x0f,0x00,0x37,0x15,0xfe,0x5c,0x02,0x16,0xf0,0xbd,0x01,0x0f,0x0f,
+0x00,0xff,0x9c,0x55,0x2f,0xff,0xff,0xff,0x20,0x3f,0x04,0x15,0x12,0xe5,0x02,0x10,
+0x04,0x3f,0x04,0x0f,0x1d,0x00,0xff,0x2c,0x10,0xf0,0x04,0x04,0x15,0x30,0xc3,0x04,
+0x11,0x00,0xdf,0x03,0x04,0x3d,0x04,0x21,0xe0,0x0d,0x45,0x07,0x00,0x01,0x00,0x10,
+0xbf,0x56,0x05,0x14,0x9f,0x3e,0x04,0x10,0x3f,0x56,0x05,0x10,0x04,0x9f,0x06,0x00,
+0x0f,0x00,0x11,0x1d,0x52,0x00,0x10,0x0c,0x6c,0x03,0x42,0x72,0x00,0x02,0x7e,0x81,
+0x05,0x11,0x4f,0x7d,0x03,0x02,0xfd,0x03,0x12,0x20,0x02,0x07,0x07,0xaa,0x06,0x15,
+0x9f,0x0e,0x00,0x13,0x70,0x7f,0x04,0x02,0xac,0x03,0x11,0x40,0x6d,0x00,0x12,0x29,
+0x0e,0x00,0x14,0xe8,0xe7,0x04,0x51,0x59,0xcd,0xff,0xed,0xc8,0x1b,0x00,0x14,0xaf,
+0x32,0x00,0x03,0x81,0x05,0x12,0x55,0x6d,0x00,0x05,0x73,0x07,0x26,0xf0,0x0f,0x44,
+0x02,0x11,0x06,0x11,0x08,0x15,0xaf,0xe4,0x04,0x20,0x00,0xbf,0x94,0x07,0x12,0x04,
+0x27,0x08,0x13,0x00,0x73,0x04,0x11,0xf0,0xb8,0x07,0x18,0xe0,0x80,0x06,0x15,0x9f,
+0x12,0x01,0x10,0x9f,0x31,0x00,0x03,0xd0,0x06,0x04,0xe3,0x07,0x12,0xe0,0x07,0x00,
+0x14,0xd0,0x1b,0x05,0x13,0xf9,0x28,0x00,0x14,0x20,0x91,0x06,0x12,0x30,0x18,0x00,
+0x14,0xf6,0x08,0x06,0x13,0xe0,0x39,0x00,0x10,0xb0,0x0a,0x06,0x04,0x4b,0x00,0x00,
+0x0f,0x01,0x04,0xf9,0x00,0x13,0x30,0x4a,0x00,0x00,0x78,0x01,0x14,0x0b,0x5b,0x00,
+0x13,0x0d,0xd8,0x05,0x17,0xff,0x43,0x08,0x13,0xfe,0xc2,0x01,0x01,0x6b,0x00,0x03,
+0x9c,0x06,0x14,0x09,0x31,0x00,0x22,0x00,0x0d,0x90,0x06,0x12,0xef,0x77,0x05,0x02,
+0x8d,0x00,0x12,0xfd,0xab,0x01,0x24,0x20,0x00,0x32,0x00,0x11,0xf1,0xd8,0x01,0x16,
+0xc0,0xa6,0x06,0x35,0x60,0x00,0xcf,0x31,0x00,0x20,0x00,0x7f,0x4d,0x01,0x15,0x1f,
+0x31,0x00,0x01,0x32,0x00,0x26,0xf0,0x06,0x31,0x00,0x01,0x32,0x00,0x24,0x50,0xbf,
+0x31,0x07,0x02,0x32,0x00,0x25,0xf9,0x0f,0x54,0x06,0x02,0xe1,0x00,0x13,0xe4,0xed,
+0x00,0x05,0x32,0x00,0x17,0xcf,0x31,0x00,0x04,0xeb,0x01,0x27,0x10,0x00,0x32,0x00,
+0x08,0x31,0x00,0x03,0x4e,0x06,0x2b,0xf5,0x00,0x32,0x00,0x06,0x10,0x00,0x13,0x01,
+0x26,0x09,0x0a,0x32,0x00,0x07,0x31,0x00,0x2a,0x00,0x5f,0x31,0x00,0x2b,0x00,0x00,
+0x31,0x00,0x21,0x00,0x0a,0x75,0x09,0x05,0x05,0x02,0x13,0x30,0x1c,0x03,0x14,0xf2,
+0xf9,0x02,0x23,0xd0,0xdf,0x15,0x01,0x13,0x08,0x3e,0x02,0x00,0x47,0x02,0x24,0xf9,
+0x09,0x46,0x00,0x13,0xbf,0x09,0x08,0x10,0x0d,0x41,0x01,0x11,0x6f,0x67,0x01,0x02,
+0x49,0x00,0x13,0xd0,0x6d,0x00,0x23,0xf2,0x02,0x87,0x02,0x14,0x03,0xec,0x00,0x10,
+0x3f,0x92,0x00,0x13,0x0e,0x6c,0x00,0x13,0x6f,0x7f,0x00,0x11,0x06,0xf9,0x00,0x03,
+0x50,0x01,0x23,0x0a,0xff,0x51,0x08,0x10,0x9f,0xf3,0x01,0x13,0x08,0x7a,0x03,0x12,
+0xef,0x04,0x0a,0x01,0x48,0x01,0x10,0x40,0xa4,0x00,0x13,0xfc,0xea,0x02,0x01,0x5f,
+0x00,0x01,0xd2,0x01,0x12,0x01,0x0d,0x00,0x00,0xb0,0x09,0x01,0x5f,0x00,0x11,0x2f,
+0x91,0x00,0x12,0x0d,0xc7,0x01,0x13,0x9f,0x88,0x07,0x12,0x05,0xbc,0x00,0x11,0xaf,
+0x29,0x01,0x14,0x0c,0x42,0x01,0x11,0x8f,0x7b,0x00,0x12,0x06,0x79,0x00,0x31,0xff,
+0xff,0xfc,0x64,0x02,0x12,0x0b,0x47,0x00,0x14,0x3f,0xc7,0x03,0x11,0x8b,0x19,0x01,
+0x15,0xef,0x72,0x00,0x10,0xe0,0x23,0x01,0x20,0xf4,0x7f,0x19,0x01,0x16,0x1f,0x9d,
+0x00,0x10,0x10,0xc8,0x00,0x10,0x03,0x19,0x01,0x12,0x04,0xc8,0x00,0x00,0x5d,0x00,
+0x10,0xf4,0x16,0x01,0x20,0xc0,0x0f,0x19,0x01,0x12,0x7f,0xa3,0x01,0x10,0x05,0xc1,
+0x03,0x40,0x02,0xff,0xff,0xf9,0x78,0x02,0x01,0xf4,0x00,0x12,0x10,0xd1,0x00,0x10,
+0xfa,0x16,0x01,0x23,0x50,0x08,0x0d,0x0b,0x13,0xe0,0x91,0x09,0x50,0xd0,0x0a,0xff,
+0xff,0xf1,0x85,0x00,0x23,0x80,0x0f,0xb7,0x03,0x12,0x0a,0xad,0x0b,0x10,0xfd,0x8b,
+0x00,0x23,0xfb,0x03,0x0f,0x04,0x00,0x5e,0x00,0x50,0xf3,0x1f,0xff,0xff,0x90,0x8b,
+0x00,0x23,0xf0,0x6f,0xb6,0x09,0x00,0x1e,0x00,0x10,0x65,0x77,0x00,0x00,0x8b,0x00,
+0x13,0x39,0x13,0x02,0x00,0x92,0x00,0x50,0xf9,0x8f,0xff,0xff,0x10,0x8b,0x00,0x23,
+0xf6,0xcf,0xdc,0x02,0x00,0x8e,0x00,0x10,0xcc,0x77,0x00,0x00,0x8b,0x00,0x14,0xaf,
+0xe8,0x09,0x14,0x09,0x55,0x0c,0x03,0x5a,0x0b,0x16,0x50,0x5e,0x02,0x24,0xff,0x60,
+0x1f,0x00,0x15,0xf2,0x2b,0x03,0x02,0x0c,0x00,0x16,0x5f,0x75,0x08,0x24,0x00,0x0e,
+0x0c,0x00,0x18,0x01,0xe5,0x02,0x14,0xbf,0x8f,0x02,0x14,0x0e,0x25,0x09,0x03,0x77,
+0x02,0x02,0x27,0x03,0x01,0x40,0x09,0x02,0x09,0x05,0x02,0x46,0x05,0x13,0x30,0x2b,
+0x02,0x05,0x1d,0x07,0x05,0x0c,0x00,0x23,0x2f,0xff,0x7d,0x02,0x03,0x8d,0x02,0x14,
+0xfb,0xc9,0x0a,0x03,0xb6,0x05,0x02,0x00,0x02,0x14,0x70,0x38,0x01,0x26,0xf6,0x00,
+0x1a,0x05,0x15,0xf3,0x5c,0x03,0x13,0x20,0x3d,0x00,0x16,0xf8,0x9e,0x00,0x25,0xb0,
+0x05,0xa4,0x03,0x12,0x04,0xc1,0x05,0x14,0xbf,0x54,0x00,0x12,0x0c,0x2a,0x00,0x14,
+0x2f,0xfa,0x00,0x12,0x5f,0xe3,0x04,0x14,0x09,0x57,0x05,0x12,0xdf,0x28,0x01,0x01,
+0xf4,0x0a,0x12,0x30,0x6b,0x00,0x14,0xfc,0x6a,0x00,0x12,0xc0,0xf3,0x00,0x14,0xf3,
+0xaf,0x00,0x12,0xf4,0x09,0x05,0x14,0xa0,0x68,0x00,0x12,0xfd,0x28,0x01,0x15,0x10,
+0x88,0x00,0x26,0x60,0x09,0x21,0x01,0x10,0x2f,0x69,0x00,0x15,0x2f,0xef,0x04,0x01,
+0x22,0x03,0x17,0xf7,0xde,0x05,0x25,0x00,0xef,0xfd,0x0b,0x07,0x06,0x04,0x07,0x10,
+0x0b,0x14,0x0c,0x15,0x0e,0x04,0x2e,0x0b,0x02,0x73,0x06,0x15,0x10,0x16,0x04,0x15,
+0xaf,0x83,0x01,0x06,0x51,0x06,0x04,0x6e,0x00,0x04,0xf6,0x06,0x2a,0xff,0xe1,0x02,
+0x0c,0x07,0x12,0x0c,0x24,0x06,0xff,0xed,0x06,0x07,0xfd,0x01,0x06,0x3c,0x05,0x04,
+0xf4,0x06,0x26,0xf5,0x00,0x5d,0x05,0x16,0xfd,0x2b,0x02,0x01,0x77,0x03,0x26,0xf4,
+0x8f,0x55,0x0c,0x10,0x5f,0x88,0x01,0x16,0x0e,0xc1,0x00,0x10,0xdf,0x51,0x01,0x15,
+0x06,0xbe,0x06,0x16,0x07,0xef,0x0e,0x14,0x40,0xad,0x00,0x12,0xf2,0x36,0x00,0x14,
+0xd0,0xcd,0x00,0x12,0x90,0xf5,0x00,0x14,0xf7,0xc7,0x01,0x16,0x10,0x08,0x00,0x14,
+0x0d,0x59,0x01,0x03,0xd9,0x01,0x14,0x6f,0x06,0x07,0x11,0x2f,0xa1,0x01,0x01,0xbf,
+0x01,0x14,0x60,0x04,0x03,0x11,0xfc,0x06,0x00,0x16,0xfd,0x7e,0x05,0x26,0x50,0x2f,
+0xc9,0x00,0x50,0x8f,0xff,0xff,0xff,0xe0,0x61,0xbf,0xff,0xff,0xff,0x40,0x00,0x01,
+0x00,0x92,0x6f,0xff,0xff,0xff,0x93,0xff,0xff,0xff,0xfc,0x0f,0x00,0xa1,0x0d,0xff,
+0xff,0xff,0xf1,0x0a,0xff,0xff,0xff,0xf3,0x0f,0x00,0xb1,0x05,0xff,0xff,0xff,0xf8,
+0x00,0x2f,0xff,0xff,0xff,0xa0,0x10,0x00,0xb0,0xcf,0xff,0xff,0xff,0x10,0x00,0xaf,
+0xff,0xff,0xff,0x20,0x0f,0x00,0xb0,0x3f,0xff,0xff,0xff,0x80,0x00,0x02,0xff,0xff,
+0xff,0xf9,0x0f,0x00,0x10,0x0b,0x3d,0x00,0x32,0x00,0x00,0x0a,0x07,0x00,0x21,0x00,
+0x02,0x3d,0x00,0x31,0x00,0x00,0x2f,0x26,0x00,0x31,0x00,0x00,0x9f,0x3d,0x00,0x10,
+0x00,0x3f,0x00,0x53,0xfe,0x00,0x00,0x00,0x1f,0x17,0x00,0x00,0x27,0x00,0x80,0xf6,
+0x00,0x00,0x08,0xff,0xff,0xff,0xe1,0x46,0x00,0xd3,0x09,0xff,0xff,0xff,0xd0,0x00,
+0x00,0xff,0xff,0xff,0xf7,0x00,0x00,0x3f,0x00,0x32,0x50,0x00,0x7f,0x35,0x00,0x02,
+0x47,0x00,0x71,0xfc,0x00,0x0e,0xff,0xff,0xff,0x70,0x0f,0x00,0xc4,0x01,0xff,0xff,
+0xff,0xf4,0x06,0xff,0xff,0xff,0xe0,0x00,0x00,0x3f,0x00,0x24,0xb0,0xdf,0x3d,0x00,
+0x02,0x67,0x00,0x06,0x3d,0x00,0x65,0x00,0x00,0x8f,0xff,0xff,0xff,0x3d,0x00,0x02,
+0x3f,0x00,0x06,0x3d,0x00,0x02,0x87,0x00,0x01,0x90,0x00,0x07,0x3f,0x00,0x06,0x3d,
+0x00,0x03,0x3f,0x00,0x15,0x60,0x0f,0x00,0x19,0x01,0x3d,0x00,0x02,0x3f,0x00,0x26,
+0xf6,0x00,0x01,0x00,0x14,0x4f,0x2b,0x01,0x02,0x01,0x00,0x5f,0x04,0xff,0xff,0xff,
+0xf2,0x1f,0x00,0x9d,0x27,0x3f,0xff,0x01,0x00,0x1f,0xf7,0x0e,0x00,0x24,0x28,0xf4,
+0x2f,0x0e,0x00,0x15,0x90,0x40,0x01,0x45,0xef,0xff,0xff,0xfd,0x74,0x00,0x10,0x0b,
+0x29,0x00,0x05,0x0e,0x00,0x19,0x6f,0x29,0x00,0x1c,0xff,0x29,0x00,0x19,0xf3,0x29,
+0x00,0x14,0x80,0x0d,0x00,0x19,0x02,0x29,0x00,0x19,0x0c,0x29,0x00,0x1c,0x7f,0x29,
+0x00,0x15,0xfc,0x1b,0x00,0x19,0x0d,0xff,0x00,0x17,0x8f,0x22,0x02,0x2f,0x00,0x03,
 0x29,0x00,0x08,0x18,0x9f,0x0e,0x02,0x19,0x04,0x29,0x00,0x19,0x0e,0x29,0x00,0x1c,
-0xaf,0x29,0x00,0x18,0xfb,0x6f,0x35,0x07,0xa1,0x34,0x18,0xaf,0xad,0x13,0x1d,0x05,
-0x29,0x00,0x19,0xe1,0x73,0x34,0x19,0x50,0xce,0x04,0x04,0x48,0x2b,0x19,0xec,0x3e,
-0x33,0x2f,0xfd,0x3f,0x0e,0x00,0x24,0x11,0x1f,0xc6,0x01,0x0f,0x06,0x00,0x09,0x22,
-0x77,0x73,0x6f,0x3a,0x0f,0x06,0x00,0xcf,0x2f,0x77,0x73,0x0e,0x01,0x0b,0x07,0x35,
-0x0b,0x08,0x82,0x0b,0x17,0x1f,0x64,0x03,0x1a,0xaf,0xb9,0x35,0x17,0xe0,0x27,0x02,
-0x16,0x50,0x77,0x02,0x17,0xfb,0xf0,0x02,0x17,0xf1,0xee,0x02,0x16,0x70,0x27,0x07,
-0x17,0xfd,0x9b,0x31,0x17,0xf4,0xd9,0x20,0x17,0xa0,0xf9,0x06,0x07,0xf5,0x06,0x0f,
-0x98,0x00,0x10,0x1f,0xf9,0x98,0x00,0x56,0x1f,0x10,0x98,0x00,0x0f,0x1f,0x30,0x98,
-0x00,0x17,0x1f,0x7f,0x98,0x00,0x07,0x16,0x80,0x98,0x00,0x1f,0xfe,0x98,0x00,0x0c,
-0x42,0x28,0x88,0x88,0x87,0xe6,0x09,0x11,0xdb,0xf8,0x02,0x0c,0x0b,0x00,0x21,0xd5,
-0x77,0x3a,0x1c,0x11,0x03,0x98,0x06,0x1f,0x3f,0x0b,0x00,0xb6,0x2e,0x57,0x79,0xf2,
-0x00,0x09,0x0b,0x00,0x02,0xed,0x04,0x06,0xff,0x3d,0x1b,0xf1,0xc8,0x02,0x15,0x01,
-0x1a,0x07,0x15,0x07,0x6f,0x0b,0x15,0x0d,0x39,0x0b,0x15,0x4f,0xce,0x09,0x31,0xaf,
-0xff,0xfa,0x08,0x58,0x00,0x31,0x00,0x42,0xf4,0x6f,0xff,0xfe,0x31,0x00,0x24,0xe0,
-0x1f,0x06,0x3c,0x11,0x80,0x20,0x58,0x00,0x31,0x00,0x11,0x20,0x9d,0x3b,0x00,0x41,
-0x56,0x00,0xad,0x01,0x10,0xf9,0x31,0x00,0x10,0xf6,0x7e,0x02,0x31,0xfe,0x00,0x08,
-0x43,0x0b,0x12,0x2f,0x9b,0x4f,0x11,0xa0,0xd8,0x05,0x20,0xc0,0x5f,0xc5,0x08,0x00,
-0x23,0x05,0x24,0xf3,0xbf,0x54,0x64,0x26,0xf9,0x88,0x01,0x00,0x17,0x2f,0x7d,0x06,
-0x07,0xd7,0x04,0x1f,0x4f,0x17,0x00,0x0f,0x64,0x49,0x99,0x99,0x99,0x10,0x00,0x54,
-0x46,0x01,0xc5,0x22,0x01,0xa9,0x06,0x12,0xe0,0xe8,0x50,0x12,0x90,0x13,0x06,0x13,
-0x30,0x09,0x4e,0x01,0xc2,0x02,0x11,0xf7,0x08,0x17,0x43,0xef,0xfe,0xda,0x71,0xda,
-0x41,0x06,0x5f,0x34,0x23,0x01,0xcf,0x2e,0x11,0x18,0x30,0x98,0x34,0x17,0x20,0xf1,
-0x44,0x12,0xfc,0x1c,0x03,0x31,0xe7,0x54,0x6c,0xa8,0x09,0x03,0x3d,0x54,0x02,0x66,
-0x3f,0x14,0xbf,0xd9,0x3c,0x07,0x85,0x08,0x0c,0x56,0x4c,0x10,0x10,0xcf,0x28,0x22,
-0x9c,0xee,0x95,0x20,0x05,0xe8,0x28,0x01,0x19,0x00,0x16,0x06,0x1b,0x2c,0x08,0x27,
-0x2f,0x21,0x10,0x03,0x80,0x4b,0x25,0x22,0x22,0xec,0x47,0x13,0x10,0x4b,0x00,0x02,
-0x32,0x3a,0x02,0xac,0x0e,0x02,0x2c,0x02,0x03,0x19,0x00,0x03,0xcd,0x0e,0x01,0x19,
-0x00,0x04,0x90,0x03,0x01,0xbf,0x21,0x03,0xdf,0x09,0x02,0x17,0x1c,0x10,0xef,0xf2,
-0x62,0x21,0x79,0xef,0x64,0x00,0x17,0x07,0x25,0x42,0x08,0x4a,0x38,0x14,0x30,0x8f,
-0x35,0x01,0x0c,0x24,0x02,0x4a,0x0f,0x22,0xfc,0x27,0xed,0x07,0x52,0x02,0x8c,0xef,
-0xed,0x94,0xd3,0x3a,0x17,0x4f,0x4d,0x07,0x18,0x04,0x9a,0x0b,0x0f,0x19,0x00,0x56,
-0x53,0x39,0xde,0xfd,0xb7,0x10,0x19,0x00,0x13,0xaf,0x35,0x0a,0x15,0x4f,0x57,0x4c,
-0x18,0xb0,0x57,0x4c,0x18,0xb0,0xd9,0x46,0x35,0x60,0x04,0xff,0x1f,0x57,0x11,0xfe,
-0x19,0x00,0x40,0xf8,0x10,0x00,0x3c,0xdc,0x01,0x13,0x04,0x1f,0x0a,0x10,0x0d,0x33,
-0x00,0x00,0x4b,0x00,0x04,0x3b,0x0c,0x05,0x7d,0x00,0x12,0xff,0x87,0x51,0x05,0x3f,
-0x5a,0x14,0x54,0x19,0x00,0x00,0x5f,0x49,0x04,0x19,0x00,0x00,0xbe,0x04,0x14,0x74,
-0x19,0x00,0x00,0x11,0x3c,0x0e,0x19,0x00,0x0b,0x32,0x00,0x18,0x0b,0x4b,0x00,0x03,
-0xeb,0x51,0x14,0xfd,0xa7,0x03,0x13,0x04,0x1f,0x0c,0x14,0x0c,0x68,0x38,0x12,0xf7,
-0x87,0x48,0x35,0xf6,0x04,0xff,0x1f,0x4a,0x1e,0xff,0xe1,0x00,0x07,0xfa,0x00,0x23,
-0xf7,0xef,0x3d,0x0d,0x00,0x19,0x00,0x23,0x31,0xbf,0x1c,0x11,0x10,0x4f,0x12,0x02,
-0x56,0x49,0xde,0xfe,0xc7,0x20,0xf0,0x31,0x28,0xdb,0x72,0xcf,0x20,0x01,0x50,0x41,
-0x16,0x1c,0x8d,0x18,0x26,0x02,0xef,0xe6,0x48,0x06,0x67,0x39,0x11,0x20,0x90,0x09,
-0x22,0xfd,0xcd,0x89,0x0f,0x02,0xbe,0x35,0x10,0x1a,0x6f,0x02,0x13,0x07,0x11,0x09,
-0x00,0x94,0x11,0x13,0x0c,0x61,0x09,0x17,0x3f,0xe4,0x12,0x00,0x86,0x10,0x23,0x3f,
-0xff,0x1a,0x41,0x4a,0x33,0x33,0x32,0x4f,0x70,0x0e,0x05,0x0c,0x00,0x04,0xaf,0x66,
-0x0c,0x18,0x00,0x08,0x30,0x00,0x02,0xa8,0x11,0x0a,0x75,0x03,0x44,0x07,0x88,0x88,
-0x86,0xc3,0x55,0x00,0x6c,0x00,0x13,0x07,0x31,0x03,0x10,0x7f,0x43,0x01,0x02,0x56,
-0x23,0x22,0x07,0xff,0x2a,0x27,0x00,0x76,0x54,0x02,0x23,0x01,0x17,0x0c,0x09,0x03,
-0x05,0xf0,0x00,0x17,0xf6,0xa5,0x38,0x16,0x50,0x20,0x01,0x15,0xa2,0x38,0x01,0x2b,
-0xeb,0x72,0x11,0x13,0x17,0x60,0x31,0x0a,0x1f,0xf6,0x19,0x00,0x54,0x53,0x05,0xbd,
-0xff,0xd9,0x30,0x19,0x00,0x11,0x5e,0x9d,0x22,0x13,0xaf,0xa2,0x05,0x01,0xf0,0x02,
-0x01,0x19,0x00,0x17,0x7f,0xea,0x38,0x17,0x2f,0x33,0x02,0x01,0xf7,0x00,0x12,0xec,
-0x9b,0x26,0x12,0x02,0x61,0x1a,0x11,0x17,0x19,0x00,0x03,0xc1,0x15,0x01,0xf0,0x39,
-0x04,0xc2,0x16,0x10,0x0b,0x19,0x00,0x04,0xbb,0x0b,0x12,0xaf,0xd3,0x28,0x14,0xff,
-0x96,0x00,0x18,0x64,0xe1,0x02,0x04,0xaf,0x01,0x12,0x0a,0x3e,0x12,0x2e,0xff,0xa0,
-0x19,0x00,0x0b,0x32,0x00,0x04,0x30,0x3f,0x01,0xc8,0x00,0x06,0xa4,0x06,0x02,0x42,
+0xaf,0x29,0x00,0x15,0xfb,0x1b,0x00,0x13,0x1e,0x30,0x03,0x06,0x29,0x00,0x14,0x50,
+0x0d,0x00,0x1d,0x05,0x29,0x00,0x15,0xe1,0x0e,0x00,0x18,0xbf,0x29,0x00,0x10,0x06,
+0x56,0x01,0x13,0xee,0x01,0x00,0x28,0xec,0x1f,0x6c,0x01,0x2f,0xfd,0x3f,0x0e,0x00,
+0x24,0x11,0x1f,0xc6,0x01,0x0f,0x06,0x00,0x09,0x20,0x77,0x73,0x06,0x00,0x2f,0x00,
+0x00,0x06,0x00,0xcf,0x2f,0x77,0x73,0x0e,0x01,0x0b,0x16,0xcf,0xf7,0x03,0x00,0x8b,
+0x01,0x17,0xc0,0x3e,0x04,0x16,0x20,0xd9,0x01,0x17,0xf8,0x00,0x02,0x17,0xe0,0x27,
+0x02,0x16,0x50,0x77,0x02,0x17,0xfb,0xf0,0x02,0x17,0xf1,0xee,0x02,0x04,0x8e,0x02,
+0x17,0x5f,0xde,0x02,0x16,0xef,0x2e,0x03,0x15,0x09,0xa3,0x05,0x02,0xb0,0x03,0x04,
+0x23,0x00,0x0f,0x98,0x00,0x13,0x1f,0xf9,0x98,0x00,0x56,0x1f,0x10,0x98,0x00,0x0f,
+0x1f,0x30,0x98,0x00,0x17,0x1f,0x7f,0x98,0x00,0x07,0x16,0x80,0x98,0x00,0x1f,0xfe,
+0x98,0x00,0x0c,0x41,0x28,0x88,0x88,0x87,0x4e,0x03,0x21,0xff,0xdb,0xf8,0x02,0x0c,
+0x0b,0x00,0x30,0xd5,0x77,0x9f,0xdd,0x00,0x11,0x03,0x98,0x06,0x1f,0x3f,0x0b,0x00,
+0xb6,0x2e,0x57,0x79,0xf2,0x00,0x09,0x0b,0x00,0x02,0xed,0x04,0x15,0xb0,0xbd,0x01,
+0x1b,0xf1,0xc8,0x02,0x15,0x01,0x1a,0x07,0x24,0x07,0xff,0x95,0x01,0x20,0x0d,0xff,
+0x7f,0x07,0x04,0x40,0x06,0x22,0xff,0xf2,0x31,0x00,0x42,0xfa,0xcf,0xff,0xf8,0x31,
+0x00,0x42,0xf4,0x6f,0xff,0xfe,0x31,0x00,0x20,0xe0,0x1f,0x33,0x00,0x00,0x31,0x00,
+0x20,0x80,0x0a,0x01,0x02,0x00,0x31,0x00,0x21,0x20,0x04,0x33,0x00,0x30,0xbf,0xff,
+0xfc,0xad,0x01,0x10,0xf9,0x31,0x00,0x10,0xf6,0x7e,0x02,0x10,0xfe,0x58,0x07,0x11,
+0xf0,0x0b,0x08,0x20,0x60,0x0e,0xb9,0x01,0x00,0xd8,0x05,0x20,0xc0,0x5f,0xc5,0x08,
+0x00,0x23,0x05,0x22,0xf3,0xbf,0x7c,0x02,0x46,0xff,0xff,0xf9,0x88,0x01,0x00,0x17,
+0x2f,0x7d,0x06,0x07,0xd7,0x04,0x1f,0x4f,0x17,0x00,0x0f,0x51,0x49,0x99,0x99,0x99,
+0x10,0x61,0x05,0x51,0xfa,0x00,0x00,0x00,0xdf,0x36,0x02,0x21,0x01,0xef,0x83,0x02,
+0x21,0x02,0xef,0x94,0x06,0x12,0x03,0xa8,0x02,0x12,0x05,0x26,0x01,0x12,0x06,0x6e,
+0x08,0x62,0x03,0x8b,0xef,0xfe,0xda,0x71,0x25,0x01,0x11,0x6d,0x4a,0x00,0x20,0xfa,
+0x10,0xf6,0x00,0x12,0xcf,0x57,0x00,0x64,0xfe,0x30,0x00,0x00,0x01,0xdf,0x65,0x00,
+0x12,0x20,0xc1,0x05,0x01,0x01,0x00,0x12,0xfc,0x1c,0x03,0x71,0xe7,0x54,0x6c,0xff,
+0xff,0xff,0xf5,0x44,0x08,0x12,0xc0,0xc6,0x02,0x10,0xa0,0x25,0x00,0x12,0xf5,0x7f,
+0x01,0x06,0x85,0x08,0x11,0xff,0x0d,0x01,0x02,0x01,0x00,0x13,0x0f,0x55,0x03,0x52,
+0x16,0x9c,0xee,0xff,0xff,0x04,0x03,0x24,0x02,0xaf,0x59,0x00,0x12,0x10,0x18,0x06,
+0x03,0x19,0x00,0x16,0x07,0xe3,0x00,0x20,0x10,0x03,0x91,0x00,0x30,0x84,0x22,0x22,
+0x19,0x00,0x00,0x64,0x00,0x23,0xfc,0x10,0x4b,0x00,0x13,0x0f,0x1a,0x04,0x00,0x19,
+0x00,0x02,0x2c,0x02,0x03,0x19,0x00,0x13,0x4f,0xdc,0x06,0x00,0x19,0x00,0x04,0x90,
+0x03,0x10,0x6f,0x19,0x00,0x03,0xdf,0x09,0x10,0x7f,0x4b,0x00,0x00,0x63,0x03,0x41,
+0xff,0xc8,0x79,0xef,0x64,0x00,0x07,0x70,0x00,0x36,0xf2,0x00,0x0d,0x0d,0x00,0x32,
+0x30,0x00,0x1d,0x09,0x00,0x11,0xdf,0xdc,0x00,0x11,0x0a,0x03,0x01,0x12,0x27,0xed,
+0x07,0x70,0x02,0x8c,0xef,0xed,0x94,0x00,0x2f,0xee,0x00,0x17,0x4f,0x4d,0x07,0x17,
+0x04,0x24,0x04,0x0f,0x19,0x00,0x57,0x53,0x39,0xde,0xfd,0xb7,0x10,0x19,0x00,0x12,
+0xaf,0x35,0x0a,0x00,0x19,0x00,0x32,0xfd,0xcf,0xff,0xe6,0x02,0x16,0x04,0xd4,0x00,
+0x27,0xb0,0x00,0x41,0x02,0x12,0x60,0x19,0x00,0x33,0xdc,0xef,0xff,0xc8,0x00,0x50,
+0xff,0xf8,0x10,0x00,0x3c,0xdc,0x01,0x13,0x04,0x1f,0x0a,0x10,0x0d,0x33,0x00,0x00,
+0x4b,0x00,0x03,0xa3,0x04,0x15,0xff,0x7d,0x00,0x00,0x2d,0x01,0x04,0x96,0x00,0x00,
+0xbd,0x08,0x13,0x54,0x19,0x00,0x00,0x77,0x03,0x14,0xf6,0x19,0x00,0x00,0xbe,0x04,
+0x13,0x74,0x19,0x00,0x00,0x9d,0x05,0x1e,0xf8,0x19,0x00,0x0b,0x32,0x00,0x18,0x0b,
+0x4b,0x00,0x12,0xef,0x64,0x00,0x14,0xfd,0xa7,0x03,0x11,0x04,0x77,0x02,0x02,0x70,
+0x00,0x22,0xc0,0x4f,0x79,0x0b,0x10,0x2b,0xaa,0x00,0x02,0xc8,0x00,0x11,0xcb,0xb5,
+0x02,0x0e,0xe1,0x00,0x07,0xfa,0x00,0x21,0xf7,0xef,0x0c,0x00,0x11,0xc0,0x13,0x01,
+0x32,0x31,0xbf,0xff,0x13,0x02,0x10,0x4f,0x12,0x02,0x44,0x49,0xde,0xfe,0xc7,0x6b,
+0x06,0x52,0x59,0xce,0xff,0xdb,0x72,0x0b,0x00,0x11,0x7e,0x31,0x00,0x10,0xb2,0x0b,
+0x00,0x13,0x1c,0x4a,0x00,0x12,0x50,0x5f,0x03,0x01,0x01,0x00,0x12,0xf5,0x8e,0x00,
+0x04,0x2c,0x03,0x10,0x8f,0x90,0x04,0x21,0xcd,0xff,0x12,0x03,0x00,0x0b,0x00,0x30,
+0x30,0x00,0x1a,0x6f,0x02,0x12,0x07,0x11,0x09,0x00,0xc1,0x02,0x22,0xf6,0x0c,0x61,
+0x09,0x00,0x2a,0x03,0x13,0xf9,0x15,0x03,0x00,0xb9,0x02,0x23,0xfa,0x3f,0xe9,0x00,
+0x57,0x03,0x33,0x33,0x32,0x4f,0x4e,0x09,0x17,0x5f,0x0c,0x00,0x12,0x6f,0xea,0x03,
+0x0d,0x18,0x00,0x08,0x30,0x00,0x17,0x2f,0xe1,0x06,0x04,0x60,0x00,0x53,0x07,0x88,
+0x88,0x86,0x0b,0xfb,0x04,0x00,0x6c,0x00,0x13,0x07,0x31,0x03,0x10,0x7f,0x43,0x01,
+0x00,0xd6,0x02,0x11,0x20,0x75,0x03,0x12,0xf3,0xc0,0x00,0x12,0xbc,0x23,0x01,0x17,
+0x0c,0x09,0x03,0x05,0xf0,0x00,0x00,0x15,0x02,0x16,0x1d,0x08,0x01,0x04,0x20,0x01,
+0x15,0xa2,0x38,0x01,0x27,0xeb,0x72,0x9c,0x0b,0x18,0x0a,0x4d,0x0a,0x00,0xe7,0x01,
+0x0f,0x19,0x00,0x54,0x53,0x05,0xbd,0xff,0xd9,0x30,0x19,0x00,0x10,0x5e,0xa0,0x00,
+0x23,0xa1,0xaf,0xa2,0x05,0x01,0xf0,0x02,0x01,0x19,0x00,0x00,0x08,0x04,0x04,0xd4,
+0x00,0x17,0x2f,0x33,0x02,0x01,0xf7,0x00,0x21,0xec,0xdf,0x19,0x00,0x10,0x02,0x19,
+0x03,0x31,0x50,0x00,0x17,0x19,0x00,0x15,0x9f,0x4c,0x05,0x33,0xff,0xf6,0x0d,0xf3,
+0x0b,0x10,0x0b,0x19,0x00,0x04,0xbb,0x0b,0x00,0x64,0x00,0x04,0xd4,0x08,0x00,0x7d,
+0x00,0x18,0x64,0xe1,0x02,0x04,0xaf,0x01,0x00,0x19,0x00,0x14,0x65,0xd5,0x07,0x0c,
+0x19,0x00,0x09,0x32,0x00,0x01,0x5d,0x04,0x04,0xe1,0x00,0x06,0xa4,0x06,0x02,0x42,
 0x02,0x14,0x80,0x7d,0x00,0x12,0x8f,0x08,0x05,0x15,0x04,0xaf,0x00,0x12,0x40,0x40,
-0x05,0x27,0x60,0x0b,0xc8,0x00,0x09,0xe1,0x00,0x07,0x40,0x21,0x14,0xf6,0xed,0x1c,
-0x17,0xe6,0x2c,0x01,0x26,0xb2,0x1f,0x45,0x01,0x24,0x40,0x00,0x5e,0x01,0x53,0x38,
-0xbe,0xff,0xec,0x84,0x68,0x0c,0x11,0xcf,0x77,0x07,0x18,0x40,0xe9,0x1f,0x18,0x90,
-0x05,0x20,0x18,0xa0,0xeb,0x34,0x12,0x60,0xc5,0x12,0x34,0xfc,0xce,0xff,0xcf,0x13,
-0x21,0xff,0x70,0x83,0x65,0x13,0xf8,0x32,0x0f,0x01,0x20,0x00,0x35,0xe0,0x08,0xff,
-0x2a,0x61,0x23,0xff,0x20,0xbc,0x4b,0x00,0xd8,0x02,0x14,0xf6,0xc4,0x02,0x00,0xe5,
-0x05,0x18,0x91,0xfb,0x23,0x08,0x05,0x0c,0x27,0xb3,0xff,0xa7,0x1d,0x08,0x19,0x00,
-0x10,0xb2,0xaa,0x00,0x12,0xdd,0x01,0x00,0x28,0xd9,0x0f,0xc0,0x15,0x17,0xdf,0xdd,
-0x15,0x06,0xef,0x16,0x12,0x40,0x6a,0x04,0x11,0xa0,0x6e,0x03,0x12,0xa0,0x49,0x10,
-0x11,0xc4,0x1a,0x49,0x12,0x90,0xda,0x11,0x43,0xfe,0xcb,0xcf,0xff,0x53,0x68,0x06,
-0x13,0x4c,0x18,0x08,0xc6,0x26,0x14,0x05,0x2e,0x07,0x16,0x20,0x2d,0x36,0x03,0x37,
-0x52,0x14,0x15,0xcc,0x2f,0x01,0x97,0x08,0x44,0x7b,0xdf,0xfe,0xc8,0x9c,0x0d,0x14,
-0xfe,0x58,0x03,0x14,0xfe,0x02,0x12,0x14,0xfe,0xfb,0x11,0x13,0xfd,0xae,0x08,0x22,
-0xec,0xcc,0x78,0x0a,0x24,0xc3,0x00,0xc4,0x69,0x09,0xd0,0x0a,0x05,0x10,0x04,0x03,
-0x09,0x00,0x14,0x4f,0x6c,0x2c,0x0f,0x09,0x00,0x11,0x9e,0x03,0x33,0x7f,0xff,0xff,
-0xfc,0x33,0x33,0x30,0x48,0x00,0x0f,0x09,0x00,0x9a,0x61,0x00,0x04,0x9d,0xef,0xec,
-0x82,0x69,0x4c,0x03,0xa9,0x4f,0x21,0xf9,0x0b,0x21,0x01,0x12,0x4f,0x93,0x01,0x10,
-0xef,0x19,0x00,0x17,0x4f,0xbb,0x01,0x17,0x0e,0xee,0x26,0x11,0x09,0x13,0x00,0x11,
-0xce,0x06,0x00,0x12,0x01,0xcc,0x6b,0x11,0x03,0x8c,0x2f,0x13,0x6f,0x40,0x0c,0x00,
-0xd4,0x4c,0x04,0xfe,0x3d,0x13,0x04,0x7d,0x4e,0x04,0xa8,0x02,0x14,0xfd,0x52,0x5b,
-0x10,0x04,0xc6,0x25,0x04,0x08,0x0c,0x00,0x19,0x00,0x04,0xdb,0x06,0x10,0x04,0xaa,
-0x40,0x07,0x76,0x0a,0x09,0x19,0x00,0x14,0xd3,0x82,0x02,0x04,0x4b,0x00,0x17,0x00,
+0x05,0x27,0x60,0x0b,0xc8,0x00,0x09,0xe1,0x00,0x27,0x00,0x6f,0xfa,0x00,0x03,0x07,
+0x01,0x17,0xe6,0x2c,0x01,0x26,0xb2,0x1f,0x45,0x01,0x60,0x40,0x00,0xff,0xff,0xff,
+0x60,0xa1,0x00,0x00,0x00,0x00,0x38,0xbe,0xff,0xec,0x84,0x00,0x01,0x00,0x80,0x03,
+0xcf,0xff,0xff,0xff,0xff,0xfd,0x40,0x0c,0x00,0x22,0x08,0xff,0x01,0x00,0x63,0x90,
+0x00,0x00,0x00,0x09,0xff,0x01,0x00,0x54,0xa0,0x00,0x00,0x07,0xff,0x01,0x00,0x30,
+0x60,0x00,0x02,0x07,0x00,0x20,0xfc,0xce,0x06,0x00,0xf1,0x05,0x10,0x00,0xbf,0xff,
+0xff,0xff,0x70,0x00,0x04,0xdf,0xff,0xff,0xf8,0x00,0x2f,0xff,0xff,0xff,0x50,0x00,
+0x20,0x00,0x10,0xe0,0x49,0x00,0x13,0xb0,0x51,0x00,0x50,0x20,0xcf,0xff,0xff,0xf5,
+0x5e,0x00,0x50,0x4f,0xff,0xff,0xf6,0x0f,0x37,0x00,0x00,0x76,0x00,0x56,0xff,0xff,
+0xff,0x91,0xff,0x01,0x00,0x27,0xfa,0x3f,0x0d,0x00,0x17,0xb3,0x0c,0x00,0x18,0xfb,
+0x19,0x00,0x10,0xb2,0xaa,0x00,0x12,0xdd,0x01,0x00,0x10,0xd9,0x4b,0x00,0x14,0x00,
+0x01,0x00,0x13,0xdf,0x64,0x00,0x13,0x00,0xba,0x00,0x11,0xd0,0x0a,0x00,0x11,0x40,
+0x75,0x00,0x20,0xff,0xa0,0x0c,0x00,0x40,0x6f,0xa0,0x00,0x00,0xeb,0x00,0x71,0xc4,
+0x00,0x00,0x04,0xbf,0xff,0x90,0x82,0x00,0x41,0xff,0xfe,0xcb,0xcf,0xc2,0x00,0x15,
+0x06,0x63,0x00,0x16,0xfd,0x06,0x01,0x63,0xff,0xfe,0x20,0x00,0x00,0x05,0x0c,0x00,
+0x71,0xfc,0x20,0x00,0x00,0x00,0x01,0x9f,0x0c,0x00,0x12,0xe6,0x68,0x00,0x63,0x15,
+0xad,0xef,0xfe,0xc8,0x40,0x75,0x00,0x50,0x01,0x7b,0xdf,0xfe,0xc8,0x09,0x00,0x10,
+0x9f,0x39,0x00,0x53,0x00,0x00,0x00,0x1d,0xff,0x09,0x00,0x13,0xcf,0x09,0x00,0x14,
+0x06,0x60,0x00,0x10,0x0d,0x08,0x00,0x93,0xec,0xcc,0x00,0x00,0x1f,0xff,0xff,0xff,
+0xc3,0x1a,0x01,0x01,0x16,0x01,0x21,0x00,0x5f,0x21,0x00,0x02,0x09,0x00,0x18,0xfb,
+0x09,0x00,0x13,0x4f,0x87,0x00,0x1f,0xf0,0x09,0x00,0x11,0x9e,0x03,0x33,0x7f,0xff,
+0xff,0xfc,0x33,0x33,0x30,0x48,0x00,0x0f,0x09,0x00,0x9a,0x81,0x00,0x04,0x9d,0xef,
+0xec,0x82,0x00,0x9f,0xcf,0x01,0x10,0x2c,0xdb,0x00,0x21,0xf9,0x0b,0x21,0x01,0x12,
+0x4f,0x93,0x01,0x10,0xef,0x19,0x00,0x17,0x4f,0xbb,0x01,0x16,0x0e,0x2b,0x02,0x21,
+0xd0,0x09,0x13,0x00,0x11,0xce,0x06,0x00,0x10,0x01,0x06,0x00,0x12,0x81,0xeb,0x02,
+0x21,0xd0,0x6f,0xf2,0x01,0x10,0x00,0xbc,0x02,0x60,0xfd,0x0b,0xff,0xff,0xff,0xc0,
+0x69,0x00,0x00,0x19,0x00,0x16,0xef,0xa8,0x02,0x23,0xfd,0x1f,0x92,0x01,0x00,0x19,
+0x00,0x10,0xd3,0xd2,0x02,0x04,0x19,0x00,0x53,0x4f,0xff,0xff,0xfc,0x00,0x19,0x00,
+0x13,0xd4,0xe6,0x02,0x0d,0x19,0x00,0x14,0xd3,0x82,0x02,0x04,0x4b,0x00,0x17,0x00,
 0x64,0x00,0x14,0xf4,0x19,0x00,0x13,0x0b,0x3f,0x00,0x14,0x04,0x96,0x00,0x13,0x50,
-0x96,0x00,0x03,0xf4,0x4f,0x02,0x74,0x32,0x16,0x08,0x70,0x03,0x18,0xfd,0xd0,0x08,
-0x17,0xd0,0x22,0x11,0x05,0x13,0x01,0x26,0xfa,0xff,0x2c,0x01,0x13,0xe5,0x6d,0x07,
-0x68,0x03,0x9d,0xef,0xeb,0x70,0x05,0x67,0x08,0x12,0x7f,0x05,0x31,0x07,0x12,0x1a,
-0x26,0x04,0xf7,0xf3,0x15,0x32,0x01,0xef,0xfc,0xd4,0x66,0x03,0x1f,0x4f,0x44,0xda,
-0x89,0xbf,0xff,0x0d,0x13,0x05,0x7e,0x07,0x27,0x02,0xef,0x56,0x21,0x01,0xd7,0x6b,
-0x05,0x3f,0x19,0x17,0x5d,0x33,0x28,0x00,0x9e,0x0a,0x03,0x7d,0x07,0x08,0x63,0x56,
-0x0f,0x0c,0x00,0x5e,0x52,0x16,0xbe,0xfe,0xd9,0x40,0x0c,0x00,0x22,0x05,0xef,0xce,
-0x03,0x15,0x7f,0x67,0x54,0x11,0xe2,0xe7,0x13,0x04,0x15,0x0b,0x17,0x7f,0xa8,0x20,
-0x16,0x7f,0x44,0x02,0x22,0xb0,0x7f,0x52,0x5a,0x10,0x4e,0x61,0x03,0x16,0x7f,0xa7,
-0x05,0x14,0xf2,0x6c,0x00,0x12,0xef,0xf0,0x18,0x14,0xf9,0xd8,0x5f,0x0f,0x0c,0x00,
-0xb9,0x40,0x00,0x8d,0xfe,0x91,0xad,0x06,0x23,0xd0,0x2f,0xf0,0x06,0x23,0xf8,0x3f,
-0xd7,0x24,0x30,0xf1,0x02,0xdf,0x57,0x4c,0x39,0x34,0x30,0x00,0x82,0x12,0x10,0x20,
-0xed,0x09,0x0f,0x09,0x00,0x5e,0x00,0xfc,0x05,0x23,0xef,0xe8,0xe9,0x0f,0x12,0xc0,
-0xa0,0x01,0x15,0xf4,0xde,0x24,0x13,0x05,0x70,0x0a,0x12,0xef,0xce,0x03,0x12,0x3d,
-0x8e,0x3f,0x09,0xbb,0x00,0x0b,0x83,0x55,0x0f,0x07,0x00,0xaa,0x02,0x64,0x08,0x03,
-0xa1,0x10,0x01,0x13,0x5a,0x11,0x26,0x43,0x45,0x13,0xb0,0x9b,0x1a,0x03,0x83,0x1a,
-0x12,0x5f,0x47,0x3b,0x12,0x5f,0xe3,0x03,0x12,0x5f,0xfe,0x09,0x4b,0x03,0x67,0x76,
-0x40,0xa8,0x0c,0x0f,0x0d,0x00,0x6a,0x01,0x8d,0x04,0x04,0x0c,0x0e,0x11,0x5f,0xda,
-0x00,0x02,0x0d,0x00,0x27,0x03,0xff,0xf3,0x1c,0x12,0x1e,0xe8,0x01,0x02,0x0d,0x00,
-0x15,0xcf,0x0d,0x0c,0x12,0xfc,0x66,0x6c,0x04,0x4e,0x00,0x04,0x8b,0x60,0x00,0x0d,
-0x00,0x05,0x72,0x60,0x13,0x4f,0xf7,0x24,0x14,0xf3,0x9c,0x05,0x03,0xa2,0x1a,0x05,
-0x79,0x07,0x09,0xa4,0x64,0x18,0xf1,0x0d,0x00,0x18,0xfa,0x0d,0x00,0x03,0x60,0x69,
-0x08,0x74,0x6e,0x18,0x4f,0x33,0x2f,0x01,0x56,0x59,0x02,0x32,0x20,0x03,0xe3,0x60,
-0x03,0x50,0x27,0x01,0xd0,0x57,0x14,0x20,0xdd,0x26,0x02,0xc3,0x00,0x12,0xaf,0x28,
-0x00,0x06,0xdd,0x00,0x14,0xd0,0x0d,0x00,0x01,0x72,0x53,0x05,0x1e,0x01,0x11,0xbf,
-0xcb,0x0a,0x16,0x4f,0x40,0x2b,0x14,0xd0,0x0d,0x00,0x01,0xdd,0x25,0x05,0x52,0x01,
-0x01,0x1d,0x1a,0x04,0x0d,0x00,0x14,0x3f,0x6f,0x55,0x0f,0x04,0x00,0x7d,0x01,0xd0,
-0x4f,0x50,0x06,0xad,0xff,0xdb,0x60,0xcb,0x26,0x41,0xdf,0xfe,0xb7,0x10,0xc8,0x03,
-0x22,0x60,0x6e,0xf8,0x6e,0x21,0x05,0xef,0xc6,0x0b,0x00,0xd5,0x00,0x22,0xf8,0xaf,
-0xb3,0x29,0x1e,0x09,0x1f,0x0e,0x14,0xd8,0xc4,0x0d,0x07,0x3f,0x0e,0x04,0x15,0x28,
-0x06,0x27,0x0f,0x00,0x4a,0x00,0x15,0xcd,0x3b,0x09,0x13,0xf7,0xa4,0x2a,0x12,0xc3,
-0xbb,0x4e,0x13,0x34,0x2f,0x04,0x13,0x6f,0xcc,0x07,0x16,0xef,0xd8,0x0e,0x13,0x01,
-0x31,0x18,0x17,0x0a,0xf8,0x0e,0x04,0xc2,0x10,0x08,0x18,0x0f,0x07,0xb5,0x58,0x13,
-0x94,0x27,0x00,0x16,0x0e,0x27,0x00,0x1f,0xf9,0x27,0x00,0xff,0x12,0x20,0x90,0x7f,
-0x95,0x03,0x51,0x16,0xbd,0xff,0xeb,0x60,0xbf,0x07,0x32,0xf4,0x06,0xef,0x17,0x0d,
-0x00,0x6e,0x79,0x13,0xaf,0x04,0x40,0x06,0xbf,0x07,0x18,0xfe,0xbf,0x07,0x17,0x60,
-0xbf,0x07,0x22,0xc0,0x7f,0xe2,0x01,0x14,0x3d,0xbf,0x07,0x13,0x40,0x98,0x46,0x16,
-0x7f,0x93,0x1e,0x14,0xf4,0x0c,0x00,0x03,0xff,0x06,0x0f,0x0c,0x00,0xb6,0x01,0xf2,
-0x0d,0x58,0xce,0xff,0xec,0x94,0x00,0xaf,0x5b,0x17,0xe6,0x2b,0x38,0x03,0xac,0x42,
-0x17,0xcf,0xf9,0x0c,0x18,0x0b,0xf5,0x2d,0x11,0x6f,0xef,0x59,0x12,0xef,0x77,0x04,
-0x02,0xf7,0x1d,0x11,0x05,0xc0,0x64,0x02,0xa3,0x41,0x02,0x80,0x5a,0x14,0x90,0xa2,
-0x53,0x01,0x18,0x1d,0x17,0x0f,0xbf,0x59,0x10,0xf3,0x96,0x04,0x05,0x82,0x60,0x14,
-0x4f,0xe5,0x0c,0x17,0x8f,0x5d,0x60,0x01,0x90,0x09,0x05,0x12,0x11,0x00,0x09,0x00,
-0x09,0x1a,0x00,0x05,0x16,0x06,0x00,0x34,0x00,0x05,0x7c,0x4e,0x00,0x4e,0x00,0x18,
-0x0e,0x68,0x00,0x13,0x0b,0xbd,0x0e,0x01,0xea,0x49,0x13,0x05,0xd1,0x05,0x11,0x1e,
-0x15,0x00,0x02,0xb6,0x00,0x21,0x04,0xdf,0x70,0x02,0x11,0x6f,0xfc,0x0d,0x17,0xef,
-0x56,0x6a,0x05,0x12,0x2d,0x18,0xcf,0xc3,0x34,0x19,0x0a,0xf8,0x2e,0x11,0x4d,0x0c,
-0x00,0x14,0xe7,0x3a,0x42,0x13,0xcd,0x52,0x01,0x10,0x4f,0x03,0x01,0x16,0x49,0xb6,
-0x13,0x26,0x62,0xbf,0xb6,0x13,0x2e,0xfa,0xef,0xb6,0x13,0x18,0xa0,0xd5,0x12,0x1c,
-0x50,0xb6,0x13,0x00,0x84,0x2c,0x14,0x4e,0xb6,0x13,0x04,0x5b,0x01,0x26,0xb0,0x4f,
-0xf5,0x6f,0x14,0xfe,0xb6,0x13,0x18,0x01,0xb6,0x13,0x13,0x0d,0xb6,0x51,0x14,0xc0,
-0x83,0x5e,0x08,0x9d,0x13,0x05,0x8a,0x10,0x00,0xb0,0x7c,0x0e,0x19,0x00,0x06,0x98,
-0x01,0x0d,0x4b,0x00,0x09,0x64,0x00,0x04,0x7d,0x00,0x14,0xf4,0x11,0x68,0x12,0x4f,
-0x72,0x07,0x10,0x3d,0x14,0x00,0x07,0xb6,0x13,0x18,0xfd,0xe1,0x00,0x28,0x40,0x04,
-0x81,0x1d,0x04,0x5c,0x07,0x00,0x06,0x01,0x10,0x04,0x77,0x02,0x13,0xaf,0xda,0x1e,
-0x03,0xfb,0x14,0x3f,0xfe,0xb6,0x10,0x78,0x15,0x65,0x06,0x01,0x00,0x00,0x70,0x04,
-0x41,0xda,0x50,0x00,0xdf,0x99,0x00,0x11,0x6e,0x14,0x06,0x11,0x0f,0xe9,0x00,0x12,
-0x9f,0x68,0x11,0x01,0xb2,0x00,0x17,0x8f,0x78,0x11,0x1d,0x3f,0x72,0x12,0x24,0xcf,
-0xff,0xa7,0x36,0x22,0xfe,0x50,0x2b,0x03,0x04,0x72,0x12,0x18,0x03,0x72,0x12,0x1f,
-0x0a,0x72,0x12,0x75,0x17,0x03,0x72,0x12,0x16,0x05,0x72,0x12,0x2e,0xeb,0xce,0x72,
-0x12,0x09,0x6c,0x13,0x03,0x07,0x01,0x17,0xec,0x72,0x12,0x27,0xb1,0xaf,0x72,0x12,
-0x0f,0x34,0x14,0x65,0x06,0x19,0x00,0x10,0x4f,0x11,0x00,0x30,0x4b,0xef,0xfa,0x30,
-0x16,0x00,0xc8,0x73,0x00,0x39,0x08,0x12,0xbf,0x52,0x04,0x10,0xfe,0xd0,0x04,0x03,
-0xab,0x02,0x0c,0x08,0x00,0x11,0xf8,0x44,0x4f,0x13,0x51,0x8d,0x30,0x07,0x71,0x61,
-0x04,0x2c,0x02,0x0f,0x08,0x00,0x6d,0x03,0x4d,0x42,0x27,0xc9,0x50,0x38,0x24,0x14,
-0xe7,0x14,0x6b,0x02,0x76,0x2b,0x26,0x02,0xef,0x69,0x35,0x16,0xcf,0xff,0x32,0x10,
-0x4f,0x7d,0x23,0x24,0x11,0x4c,0x3b,0x09,0x13,0x70,0x05,0x10,0x02,0xde,0x5e,0x00,
-0x1b,0x05,0x32,0xfb,0x0c,0xff,0xe1,0x55,0x56,0x77,0x77,0x77,0x50,0xaf,0x70,0x7a,
-0x01,0xca,0x03,0x27,0xa5,0x20,0x29,0x25,0x02,0x20,0x16,0x13,0x1d,0x72,0x00,0x17,
-0x60,0x70,0x55,0x17,0xd2,0xa8,0x30,0x11,0xf3,0xad,0x00,0x26,0xae,0xff,0x2b,0x25,
-0x27,0x02,0x6b,0xd1,0x22,0x10,0x02,0x95,0x41,0x12,0x7c,0x47,0x5c,0x13,0x02,0xd4,
-0x64,0x03,0xdc,0x16,0x00,0x1c,0x20,0x01,0x13,0x72,0x03,0x5f,0x23,0x44,0xfe,0x73,
-0x11,0x38,0x59,0x03,0x04,0xfb,0x10,0x17,0x06,0xda,0x16,0x27,0x05,0xff,0xf6,0x1a,
-0x17,0xaf,0xe2,0x55,0x00,0x50,0x66,0x03,0x2b,0x01,0x47,0x78,0x88,0x88,0x81,0x66,
-0x08,0x0f,0x08,0x00,0x14,0x13,0xcf,0x3e,0x01,0x0f,0x08,0x00,0x0d,0x20,0x23,0x33,
-0x47,0x12,0x2e,0x33,0x32,0x60,0x00,0x0f,0x08,0x00,0x48,0x13,0xf4,0xbd,0x07,0x14,
-0xfb,0xcb,0x21,0x26,0xfd,0xde,0x13,0x2b,0x02,0x97,0x21,0x04,0x80,0x14,0x04,0x12,
-0x33,0x11,0x00,0xf6,0x1a,0x2f,0xfd,0xb7,0xb3,0x10,0xc5,0x00,0xc7,0x02,0x04,0x0c,
-0x00,0x16,0x4f,0xd7,0x26,0x21,0xf5,0x1f,0xec,0x08,0x02,0xa3,0x32,0x11,0x0d,0x7a,
-0x07,0x02,0x72,0x41,0x18,0x07,0x73,0x54,0x17,0xef,0x0c,0x00,0x03,0xdc,0x05,0x01,
-0x48,0x09,0x21,0x03,0xdf,0x0d,0x06,0x00,0xe2,0x83,0x01,0xe5,0x7d,0x20,0xec,0x94,
-0x8e,0x0e,0x14,0xf5,0x66,0x46,0x13,0x0a,0xbc,0x16,0x23,0xf1,0x00,0x30,0x0c,0x04,
-0xc3,0x64,0x01,0x84,0x20,0x00,0x9d,0x74,0x03,0x94,0x0d,0x23,0xb0,0x03,0xf6,0x0d,
-0x01,0xd7,0x2b,0x03,0xe9,0x62,0x02,0x1b,0x17,0x00,0xf2,0x83,0x02,0xab,0x00,0x11,
-0xb0,0x95,0x05,0x14,0xb0,0x81,0x2b,0x00,0xe8,0x08,0x02,0xaa,0x03,0x13,0x10,0x37,
-0x2b,0x12,0x01,0x1f,0x00,0x11,0x03,0xa1,0x04,0x12,0x6f,0xf8,0x04,0x10,0x0e,0x8b,
-0x00,0x04,0x32,0x2b,0x13,0x8f,0x1c,0x1d,0x13,0xc0,0x71,0x17,0x23,0x60,0x3f,0x1d,
-0x05,0x13,0x0e,0x36,0x1a,0x04,0x90,0x39,0x27,0xe0,0xcf,0xc9,0x3f,0x14,0x4f,0x42,
-0x05,0x12,0x0e,0xe6,0x7b,0x17,0x10,0x61,0x04,0x17,0xc0,0x15,0x29,0x18,0xf7,0xc2,
-0x28,0x17,0x10,0xbf,0x28,0x17,0xc0,0x2e,0x04,0x18,0xf7,0xe8,0x28,0x17,0x10,0xbf,
-0x24,0x17,0xc0,0x88,0x07,0x19,0xf7,0x3b,0x12,0x13,0x00,0x4f,0x1b,0x02,0x49,0x0a,
-0x13,0xf0,0x09,0x04,0x00,0x8d,0x00,0x06,0x04,0x79,0x12,0x2f,0x0b,0x16,0x12,0xff,
-0x34,0x00,0x12,0xf9,0x16,0x10,0x25,0xf5,0x07,0x95,0x2c,0x03,0x95,0x7c,0x26,0xf1,
-0x03,0x7c,0x66,0x02,0xec,0x6c,0x22,0xd0,0x00,0x4b,0x1f,0x12,0xcf,0xf9,0x04,0x01,
-0x3b,0x01,0x10,0xbf,0x8e,0x00,0x13,0x01,0xd8,0x14,0x04,0xea,0x14,0x12,0xf0,0x4c,
-0x04,0x11,0xf0,0x37,0x03,0x12,0x10,0xfd,0x6b,0x12,0x0a,0x6f,0x0c,0x02,0xe4,0x6b,
-0x01,0x23,0x7a,0x02,0xc7,0x43,0x00,0x0d,0x05,0x11,0xf9,0x50,0x07,0x10,0xf9,0x29,
-0x00,0x00,0x18,0x20,0x14,0x0f,0xee,0x6a,0x00,0x51,0x14,0x00,0xc6,0x04,0x12,0x20,
-0xcb,0x20,0x10,0x03,0xb5,0x00,0x42,0xcf,0xff,0xf9,0x0e,0x15,0x2e,0x03,0x59,0x0e,
-0x95,0x30,0xff,0xff,0xf4,0x0a,0xff,0xff,0xb0,0x9f,0x50,0x6b,0x12,0x65,0xc0,0x0a,
-0x25,0xf0,0xdf,0xae,0x7b,0x40,0x99,0xff,0xff,0xb0,0x01,0x5c,0x06,0x2c,0x2e,0x12,
-0xcd,0x9a,0x2f,0x17,0xfc,0x5c,0x2e,0x00,0x1c,0x00,0x28,0x7f,0xff,0x1a,0x29,0x04,
-0xe7,0x1f,0x25,0xff,0xf5,0x33,0x21,0x14,0xf8,0x2c,0x40,0x05,0xcc,0x01,0x03,0x24,
-0x30,0x03,0x9d,0x05,0x03,0x5d,0x28,0x28,0x04,0xff,0xd9,0x31,0x04,0x69,0x30,0x25,
-0xff,0x50,0xd4,0x26,0x14,0x50,0x9d,0x3f,0x09,0x68,0x23,0x15,0x6f,0xb2,0x1c,0x13,
-0x0f,0xaa,0x06,0x00,0xad,0x01,0x05,0x23,0x23,0x13,0xf7,0x62,0x0a,0x14,0xf5,0x90,
-0x1e,0x03,0x80,0x23,0x26,0x70,0x04,0x75,0x49,0x02,0x78,0x16,0x15,0xfc,0xf2,0x30,
-0x02,0x5a,0x1a,0x03,0xac,0x17,0x02,0xde,0x19,0x12,0x5f,0xeb,0x01,0x14,0x01,0xa6,
-0x53,0x14,0xf9,0xa0,0x0a,0x14,0x07,0xd9,0x00,0x00,0x5d,0x00,0x14,0x9e,0x2b,0x24,
-0x18,0x05,0xe7,0x35,0x28,0x00,0xcf,0x64,0x2b,0x18,0x3f,0x81,0x2b,0x18,0x0a,0x84,
-0x5b,0x19,0x01,0x89,0x7f,0x1b,0xdf,0x1c,0x2d,0x29,0xff,0xfe,0xc3,0x2b,0x18,0x80,
-0xe8,0x29,0x18,0xf2,0xe5,0x29,0x15,0xfa,0x5a,0x00,0x14,0xdf,0x5c,0x00,0x13,0x3f,
-0x0b,0x68,0x14,0xc0,0xb8,0x05,0x03,0x8e,0x2a,0x01,0xa8,0x00,0x14,0xf2,0xc7,0x31,
-0x02,0xf0,0x43,0x16,0x1e,0xe9,0x20,0x35,0x10,0x00,0x07,0xcd,0x2f,0x14,0xf7,0x31,
-0x40,0x13,0x0a,0x4b,0x04,0x01,0x12,0x01,0x04,0x91,0x71,0x01,0x54,0x1f,0x04,0xac,
-0x5a,0x14,0x0b,0x60,0x18,0x03,0x9d,0x1e,0x02,0x30,0x74,0x14,0x60,0x6e,0x29,0x04,
-0x87,0x18,0x01,0x6f,0x24,0x13,0x05,0xe6,0x21,0x02,0x22,0x32,0x02,0xec,0x0b,0x03,
-0x9d,0x5b,0x02,0x1a,0x25,0x03,0x1b,0x32,0x02,0xe1,0x24,0x12,0x0c,0x60,0x01,0x15,
-0x0f,0xd5,0x69,0x14,0x10,0x0e,0x5c,0x00,0x06,0x69,0x05,0x66,0x0b,0x04,0x94,0x09,
-0x01,0x7a,0x46,0x04,0x7f,0x46,0x13,0x9f,0xc7,0x07,0x04,0x41,0x19,0x24,0xfa,0x08,
-0x12,0x08,0x13,0x0e,0xfd,0x67,0x14,0x10,0xa6,0x0c,0x17,0x6f,0xd1,0x82,0x14,0xff,
-0xa6,0x19,0x04,0xcc,0x2d,0x18,0xf0,0x79,0x01,0x18,0xa0,0xd4,0x01,0x16,0x50,0x3b,
-0x29,0x05,0x2a,0x1c,0x18,0x08,0xd4,0x01,0x19,0x02,0xd6,0x71,0x18,0xdf,0x54,0x2b,
-0x18,0x7f,0x06,0x2a,0x0c,0x25,0x72,0x18,0xfe,0xec,0x16,0x18,0xf9,0xad,0x14,0x18,
-0xf3,0xf8,0x2d,0x18,0xd0,0x64,0x39,0x13,0x80,0xef,0x04,0x26,0x56,0xbf,0x05,0x27,
-0x18,0x2f,0x8d,0x00,0x18,0x2f,0x88,0x2e,0x18,0x2f,0x2d,0x2c,0x18,0x2f,0xa8,0x5e,
-0x18,0x2f,0x8e,0x41,0x26,0x02,0x57,0xac,0x62,0x17,0x0d,0x54,0x0e,0x16,0xdf,0xc0,
-0x06,0x0f,0x17,0x00,0x0f,0x24,0x20,0x9b,0x5d,0x6d,0x04,0x91,0x09,0x16,0x5f,0x4a,
-0x01,0x03,0x77,0x14,0x0b,0xd5,0x2a,0x04,0xa8,0x6e,0x0a,0x55,0x2a,0x14,0x01,0x73,
-0x81,0x04,0x47,0x35,0x0d,0xff,0x2a,0x05,0x98,0x3e,0x02,0xaf,0x00,0x1d,0xe1,0xfa,
-0x3d,0x03,0xb0,0x3e,0x0c,0x52,0x2b,0x02,0xb5,0x0f,0x0c,0xfb,0x2a,0x01,0x8d,0x59,
-0x02,0xe3,0x75,0x1e,0x1e,0x3d,0x1e,0x0b,0x3c,0x1e,0x0e,0x17,0x00,0x08,0x6e,0x31,
-0x13,0x33,0xaa,0x63,0x13,0xa0,0x65,0x63,0x13,0x00,0x52,0x06,0x03,0xf8,0x0b,0x02,
-0x32,0x26,0x00,0x89,0x0a,0x04,0x36,0x07,0x12,0xdf,0xd4,0x00,0x15,0x1f,0x76,0x7f,
-0x04,0xaa,0x35,0x12,0xe0,0xf0,0x01,0x17,0xfd,0x11,0x80,0x0f,0x0f,0x00,0x0b,0x04,
-0x2f,0x80,0x12,0xaf,0x8d,0x00,0x12,0x0e,0xec,0x01,0x12,0x07,0xcf,0x43,0x12,0x3a,
-0x8a,0x01,0x03,0x97,0x47,0x13,0x0d,0x58,0x0b,0x12,0xdf,0x91,0x10,0x07,0x0f,0x00,
-0x01,0x4b,0x01,0x13,0x29,0xd0,0x00,0x03,0x07,0x07,0x04,0x4b,0x00,0x04,0x5a,0x00,
-0x1f,0x08,0x96,0x00,0x19,0x04,0x0f,0x00,0x03,0xd2,0x00,0x04,0xe1,0x00,0x16,0x1f,
-0x6c,0x0a,0x04,0x67,0x11,0x13,0x20,0x14,0x03,0x14,0x20,0xb8,0x6d,0x02,0xe8,0x01,
-0x13,0xf5,0x19,0x87,0x02,0x51,0x2c,0x13,0xcf,0x4f,0x02,0x7f,0x22,0x00,0xcf,0xff,
-0x8c,0xff,0xf8,0x05,0x00,0x51,0x54,0x34,0x44,0x20,0x00,0x51,0x4b,0x02,0x02,0xd2,
-0x22,0x04,0xf7,0x86,0x17,0x0d,0xea,0x24,0x13,0xb0,0xf5,0x00,0x13,0xf6,0x6d,0x04,
-0x17,0xfe,0xc6,0x85,0x05,0xe8,0x00,0x00,0x5e,0x04,0x17,0xc0,0x0f,0x01,0x00,0x1c,
-0x02,0x1f,0xf0,0x08,0x00,0x21,0x16,0x3f,0xe0,0x6c,0x13,0xf6,0xfb,0x02,0x05,0x23,
-0x49,0x14,0xe6,0x0d,0x47,0x14,0xf5,0x08,0x60,0x07,0x86,0x02,0x01,0x12,0x72,0x03,
-0xe7,0x04,0x12,0xf5,0x30,0x00,0x22,0xd5,0x10,0xb3,0x80,0x17,0x10,0x50,0x00,0x04,
-0x60,0x00,0x0f,0xa0,0x00,0x25,0x04,0xe0,0x00,0x16,0x8f,0x9c,0x06,0x04,0x2d,0x31,
-0x12,0x40,0xaf,0x00,0x14,0xfd,0xc5,0x86,0x04,0x31,0x5e,0x07,0xdc,0x74,0x13,0x07,
-0xb4,0x04,0x44,0x01,0xff,0x91,0x00,0x80,0x21,0x03,0x52,0x2e,0x31,0xae,0xfe,0xc7,
-0x1a,0x04,0x32,0x12,0x22,0x22,0x9b,0x28,0x12,0xf7,0x48,0x00,0x13,0xfc,0x3d,0x0e,
-0x11,0xb0,0x34,0x04,0x34,0xfb,0x00,0xaf,0xbc,0x0e,0x00,0x59,0x84,0x14,0x04,0xc9,
-0x77,0x00,0xad,0x25,0x10,0xf5,0x27,0x04,0x14,0xdd,0xb2,0x64,0x20,0xf0,0x0f,0x8a,
-0x02,0x14,0x2b,0x58,0x12,0x11,0x2f,0x7a,0x00,0x13,0x8f,0xad,0x33,0x11,0x4f,0xa4,
-0x03,0x13,0x06,0x7c,0x0e,0x12,0x5f,0xd4,0x01,0x12,0x3d,0x17,0x0e,0x32,0x01,0x11,
-0x10,0x25,0x3f,0x21,0xef,0xec,0xac,0x00,0x32,0x37,0x98,0x50,0x9a,0x7b,0x13,0xfe,
-0x1a,0x7d,0x13,0xf6,0xdb,0x0e,0xf0,0x02,0x30,0x5f,0xff,0xe5,0x02,0xbf,0xff,0xb0,
+0x96,0x00,0x21,0x00,0xff,0xa3,0x00,0x20,0x02,0xbf,0x19,0x00,0x16,0x08,0x70,0x03,
+0x37,0xfd,0x00,0x0d,0xe1,0x00,0x16,0x00,0x1a,0x03,0x05,0x13,0x01,0x26,0xfa,0xff,
+0x2c,0x01,0x22,0xe5,0x4f,0x4d,0x02,0x63,0x03,0x9d,0xef,0xeb,0x70,0x05,0xe9,0x00,
+0x01,0x01,0x00,0x11,0x7f,0x61,0x01,0x11,0x03,0x0c,0x00,0x00,0x52,0x00,0x62,0x80,
+0x00,0x04,0xf7,0x00,0x00,0xa2,0x02,0x62,0xf3,0x00,0x01,0xef,0xfc,0x30,0x05,0x03,
+0x11,0xfd,0x8f,0x00,0x41,0xda,0x89,0xbf,0xff,0x9d,0x00,0x15,0x7f,0x70,0x00,0x43,
+0xb0,0x00,0x02,0xef,0x0c,0x00,0x00,0x56,0x00,0x11,0x02,0xe3,0x02,0x04,0x69,0x03,
+0x12,0x5d,0x9d,0x01,0x12,0x40,0x5e,0x04,0x53,0x8b,0xef,0xff,0xdb,0x72,0x75,0x00,
+0x17,0xf9,0x81,0x00,0x0f,0x0c,0x00,0x5b,0x52,0x16,0xbe,0xfe,0xd9,0x40,0x0c,0x00,
+0x22,0x05,0xef,0xce,0x03,0x00,0x0c,0x00,0x11,0x8f,0xab,0x00,0x10,0xe2,0x0c,0x00,
+0x13,0xfe,0xe7,0x03,0x07,0xe6,0x00,0x36,0xff,0x50,0x7f,0x44,0x02,0x20,0xb0,0x7f,
+0x53,0x01,0x30,0x00,0x00,0x4e,0x61,0x03,0x10,0x7f,0xd7,0x04,0x02,0xb9,0x01,0x14,
+0xf2,0x6c,0x00,0x00,0xda,0x01,0x03,0x0c,0x00,0x00,0x36,0x01,0x1f,0xf5,0x0c,0x00,
+0xb9,0x90,0x00,0x8d,0xfe,0x91,0x00,0xaf,0xff,0xff,0xd0,0xe4,0x05,0x60,0x65,0xff,
+0xff,0xff,0xf8,0x3f,0xa2,0x02,0xc5,0xdf,0xff,0xff,0xf1,0x02,0xdf,0xff,0xe4,0x00,
+0x00,0x34,0x30,0x8a,0x05,0x01,0x85,0x03,0x5f,0x20,0xef,0xff,0xff,0xf2,0x09,0x00,
+0x5e,0x00,0xfc,0x05,0x32,0xef,0xe8,0x00,0x74,0x05,0x12,0xc0,0xa0,0x01,0x12,0xf4,
+0xd7,0x02,0x12,0xf6,0xca,0x05,0x12,0xf5,0xa9,0x01,0x00,0xce,0x03,0x31,0x3d,0xff,
+0xfd,0xb5,0x00,0x08,0xbb,0x00,0x04,0x01,0x00,0x10,0xef,0x08,0x03,0x0f,0x07,0x00,
+0xac,0x00,0x9c,0x02,0x20,0x00,0x00,0xfa,0x04,0x12,0xf1,0xce,0x03,0x40,0xf0,0x26,
+0x56,0xaf,0xc9,0x02,0x12,0x5f,0xc9,0x07,0x12,0x5f,0x97,0x06,0x01,0x07,0x00,0x12,
+0xf4,0x07,0x00,0x11,0x50,0x07,0x00,0x72,0xa2,0x00,0x00,0x03,0x67,0x76,0x40,0xa5,
+0x04,0x15,0xfc,0x14,0x01,0x0f,0x0d,0x00,0x69,0x01,0x8d,0x04,0x13,0x10,0x0d,0x00,
+0x11,0x5f,0xda,0x00,0x02,0x0d,0x00,0x01,0xc5,0x07,0x13,0x40,0x0d,0x00,0x12,0x1e,
+0xe8,0x01,0x02,0x0d,0x00,0x11,0xcf,0xd8,0x04,0x02,0x0d,0x00,0x10,0x0a,0x48,0x08,
+0x04,0x4e,0x00,0x13,0x8f,0x0a,0x05,0x00,0x0d,0x00,0x10,0x05,0x03,0x01,0x13,0x10,
+0x0d,0x00,0x11,0x3f,0xfe,0x04,0x03,0x9c,0x05,0x13,0xdf,0x8f,0x05,0x04,0x5f,0x06,
+0x27,0xf7,0x00,0x0d,0x00,0x18,0xf1,0x0d,0x00,0x18,0xfa,0x0d,0x00,0x28,0xff,0x40,
+0x0d,0x00,0x18,0xe1,0x0d,0x00,0x14,0xfa,0x0d,0x00,0x23,0xfe,0x9f,0x28,0x00,0x10,
+0x4f,0x7c,0x04,0x13,0x0d,0x5d,0x06,0x10,0x4f,0x6f,0x08,0x10,0x04,0xe3,0x06,0x05,
+0xf7,0x00,0x12,0xaf,0x28,0x00,0x06,0xdd,0x00,0x14,0xd0,0x0d,0x00,0x12,0x05,0x28,
+0x00,0x03,0x11,0x01,0x00,0x9f,0x05,0x14,0x30,0x0d,0x00,0x11,0x2f,0x28,0x00,0x03,
+0x0d,0x00,0x10,0x07,0xab,0x03,0x05,0x52,0x01,0x10,0xdf,0x28,0x00,0x04,0x0d,0x00,
+0x13,0x3f,0x8e,0x06,0x1f,0xf2,0x04,0x00,0x7d,0x10,0x4f,0xa6,0x03,0xd1,0x06,0xad,
+0xff,0xdb,0x60,0x00,0x00,0x00,0x5b,0xdf,0xfe,0xb7,0x10,0xc8,0x03,0x20,0x60,0x6e,
+0x45,0x01,0x21,0xe3,0x00,0xbf,0x05,0x20,0xfe,0x50,0xd5,0x00,0x21,0xf8,0xaf,0x59,
+0x01,0x23,0xf3,0x09,0x9b,0x0a,0x16,0x04,0xba,0x05,0x13,0xd8,0x08,0x00,0x3c,0x20,
+0x4f,0xff,0x01,0x00,0x12,0xf9,0x27,0x00,0x22,0xdc,0xef,0xe3,0x09,0x15,0xcd,0x3b,
+0x09,0x11,0xf7,0xdd,0x05,0x00,0x92,0x09,0x10,0x01,0x52,0x01,0x13,0x34,0x2f,0x04,
+0x12,0x6f,0xcc,0x07,0x00,0x57,0x03,0x13,0xf6,0x3d,0x01,0x12,0x01,0x58,0x04,0x01,
+0x58,0x02,0x13,0x74,0x4f,0x02,0x12,0x0f,0x81,0x04,0x00,0x5f,0x02,0x14,0xf8,0x64,
+0x01,0x00,0xcf,0x00,0x03,0xbe,0x02,0x13,0x94,0x27,0x00,0x16,0x0e,0x27,0x00,0x1f,
+0xf9,0x27,0x00,0xff,0x12,0x20,0x90,0x7f,0x95,0x03,0x51,0x16,0xbd,0xff,0xeb,0x60,
+0xbf,0x07,0x21,0xf4,0x06,0x00,0x02,0x10,0x40,0x0c,0x00,0x12,0xf6,0x00,0x02,0x17,
+0xf4,0xbf,0x07,0x18,0xfe,0xbf,0x07,0x17,0x60,0xbf,0x07,0x22,0xc0,0x7f,0xe2,0x01,
+0x14,0x3d,0xbf,0x07,0x12,0x40,0x3d,0x04,0x23,0xf2,0x7f,0x9a,0x03,0x12,0xdf,0xbf,
+0x07,0x17,0xfa,0xff,0x06,0x0f,0x0c,0x00,0xb6,0x01,0xf2,0x0d,0x43,0xce,0xff,0xec,
+0x94,0x56,0x05,0x17,0x5d,0xc6,0x0c,0x13,0x0a,0x2d,0x01,0x13,0xc1,0x37,0x07,0x05,
+0xf9,0x0c,0x15,0x0b,0x48,0x01,0x12,0xd1,0x05,0x03,0x32,0xff,0xcc,0xef,0x77,0x04,
+0x11,0xef,0x08,0x0e,0x01,0x89,0x03,0x23,0x20,0x05,0x0b,0x03,0x10,0x2e,0xac,0x01,
+0x13,0x0b,0x03,0x0a,0x10,0x06,0xd4,0x04,0x11,0x0f,0x96,0x04,0x02,0x89,0x06,0x24,
+0xf3,0x2f,0xac,0x0d,0x12,0xbf,0x46,0x03,0x02,0xe5,0x0c,0x00,0x2c,0x03,0x05,0xed,
+0x0b,0x00,0x70,0x08,0x14,0x6f,0x4f,0x05,0x00,0x09,0x00,0x09,0x1a,0x00,0x05,0x16,
+0x06,0x00,0x34,0x00,0x12,0x2f,0x59,0x0d,0x02,0x4e,0x00,0x18,0x0e,0x68,0x00,0x13,
+0x0b,0xbd,0x0e,0x10,0x05,0xe7,0x01,0x13,0x05,0xd1,0x05,0x11,0x1e,0x15,0x00,0x02,
+0xb6,0x00,0x21,0x04,0xdf,0x70,0x02,0x11,0x6f,0xfc,0x0d,0x12,0xef,0x97,0x05,0x17,
+0x0a,0x54,0x0b,0x0a,0x04,0x01,0x05,0x1b,0x00,0x11,0xd1,0x6f,0x00,0x11,0x4d,0x0c,
+0x00,0x13,0xe7,0x46,0x01,0x90,0x38,0xcd,0xff,0xec,0x94,0x00,0x00,0x00,0x00,0xf0,
+0x10,0x4f,0xff,0xff,0xf4,0x00,0x49,0xde,0xfd,0xb7,0x10,0x00,0x00,0x04,0xff,0xff,
+0xff,0x62,0xbf,0xff,0xff,0xff,0xff,0x70,0x00,0x00,0x4f,0xff,0xff,0xfa,0xef,0xff,
+0x01,0x00,0x11,0xb0,0x19,0x00,0x03,0x01,0x00,0x36,0xa0,0x00,0x4f,0x0d,0x00,0x12,
+0x50,0x19,0x00,0x10,0xdc,0x28,0x00,0x11,0xfe,0x19,0x00,0xa0,0xf7,0x10,0x00,0x4e,
+0xff,0xff,0xff,0xf5,0x04,0xff,0x58,0x00,0x30,0x00,0x00,0x2e,0x40,0x00,0xc0,0x4f,
+0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x7f,0xff,0xff,0xfe,0x19,0x00,0x94,0xc0,0x00,
+0x00,0x00,0x01,0xff,0xff,0xff,0xf2,0x19,0x00,0x53,0x0d,0xff,0xff,0xff,0x44,0x19,
+0x00,0x54,0x00,0xaf,0xff,0xff,0xf5,0x19,0x00,0x54,0x09,0xff,0xff,0xff,0x64,0x19,
+0x00,0x4f,0x9f,0xff,0xff,0xf7,0x19,0x00,0x02,0x4e,0xbf,0xff,0xff,0xf6,0x4b,0x00,
+0x0b,0x64,0x00,0x04,0x7d,0x00,0x00,0x96,0x00,0x10,0x1e,0xc9,0x00,0x00,0xaf,0x00,
+0x40,0xf6,0x00,0x00,0x3d,0x14,0x00,0x02,0xc8,0x00,0x68,0xcb,0xdf,0xff,0xff,0xff,
+0xfd,0xe1,0x00,0x17,0x40,0xfa,0x00,0x10,0x90,0x19,0x00,0x23,0xfd,0xdf,0x06,0x01,
+0x00,0x19,0x00,0x20,0xc1,0xaf,0x0c,0x00,0x31,0x60,0x00,0x00,0x64,0x00,0x43,0x39,
+0xde,0xfe,0xb6,0x45,0x01,0x23,0xc0,0x00,0x01,0x00,0x04,0x7d,0x00,0x2f,0x00,0x00,
+0x19,0x00,0x53,0x00,0x01,0x00,0x71,0x16,0xbd,0xff,0xda,0x50,0x00,0xdf,0x99,0x00,
+0x10,0x6e,0xa1,0x00,0x21,0xc3,0x0f,0xe9,0x00,0x11,0x9f,0xba,0x00,0x11,0xf6,0xb2,
+0x00,0x15,0x8f,0xd6,0x00,0x36,0xf6,0x00,0x3f,0xe3,0x00,0x20,0x60,0x0c,0x06,0x00,
+0x21,0xec,0xcf,0x19,0x00,0x10,0x03,0xd5,0x01,0x40,0x50,0x00,0x05,0xef,0x19,0x00,
+0x00,0x3d,0x00,0x40,0x30,0x00,0x00,0x03,0x19,0x00,0x11,0x0d,0x0d,0x01,0x30,0x00,
+0x00,0x0a,0x19,0x00,0x43,0xff,0xff,0xff,0xf3,0xb6,0x01,0x10,0xf6,0x4a,0x00,0x13,
+0x00,0x19,0x00,0x17,0x64,0xcf,0x01,0x54,0xf6,0x5f,0xff,0xff,0xfb,0x19,0x00,0x11,
+0x65,0x3f,0x01,0x0e,0x19,0x00,0x0a,0x32,0x00,0x10,0x2f,0x51,0x02,0x07,0x64,0x00,
+0x14,0xf2,0x19,0x00,0x00,0xa2,0x00,0x50,0x80,0x00,0x00,0x00,0x0b,0x19,0x00,0x00,
+0xc7,0x00,0x13,0x20,0x96,0x00,0x10,0x02,0xaf,0x00,0x31,0x40,0x00,0x05,0xc8,0x00,
+0x10,0x0b,0x06,0x00,0x22,0xeb,0xce,0xe1,0x00,0x17,0x2f,0xe1,0x00,0x27,0x00,0x7f,
+0xfa,0x00,0x03,0x07,0x01,0x12,0xec,0xc5,0x01,0x10,0x5e,0x0c,0x00,0x21,0xb1,0xaf,
+0x19,0x00,0x61,0x00,0x05,0xbd,0xff,0xd9,0x40,0x7d,0x00,0x04,0x57,0x01,0x03,0x19,
+0x00,0x01,0x01,0x00,0x0f,0x19,0x00,0x56,0x10,0x4f,0x11,0x00,0xa0,0x4b,0xef,0xfa,
+0x4f,0xff,0xff,0xf7,0x0a,0xff,0xff,0x08,0x00,0xa2,0xf8,0xbf,0xff,0xff,0xf9,0x4f,
+0xff,0xff,0xfe,0xff,0x08,0x00,0x2e,0xff,0xff,0x08,0x00,0x10,0xf8,0x08,0x00,0x21,
+0xfc,0x51,0x1c,0x02,0x01,0xab,0x01,0x00,0x30,0x00,0x08,0x2c,0x02,0x0f,0x08,0x00,
+0x6d,0x00,0xa7,0x02,0x51,0xad,0xef,0xfe,0xc9,0x50,0x0b,0x00,0x02,0x9a,0x02,0x62,
+0xe7,0x00,0x00,0x00,0x02,0xef,0xc1,0x00,0x25,0xfc,0x10,0x0b,0x00,0x54,0xff,0xfd,
+0x10,0x00,0xcf,0xb4,0x01,0x11,0xfa,0xd2,0x00,0x30,0x93,0x11,0x4c,0x77,0x02,0x12,
+0x09,0xa9,0x04,0x10,0x0d,0x12,0x02,0xb0,0xbf,0xff,0xff,0xf1,0x00,0x00,0x00,0x6f,
+0xff,0xff,0xfb,0x22,0x02,0x91,0x10,0x00,0x00,0x02,0x77,0x77,0x77,0x50,0xaf,0x4b,
+0x00,0x05,0x34,0x03,0x31,0xff,0xa5,0x20,0x0c,0x00,0x21,0x0c,0xff,0x20,0x02,0x10,
+0x72,0x0c,0x00,0x13,0x1d,0x72,0x00,0x00,0x85,0x01,0x13,0x1a,0x67,0x00,0x51,0xd2,
+0x00,0x00,0x00,0x03,0x09,0x05,0x03,0xde,0x02,0x21,0x16,0xae,0x0c,0x00,0x11,0xd0,
+0x3e,0x00,0x36,0x02,0x6b,0xff,0xb5,0x01,0xc0,0x02,0xdf,0xff,0xff,0xfb,0x7c,0xcc,
+0xcc,0xc1,0x00,0x00,0x00,0x83,0x02,0x40,0xd7,0xff,0xff,0xff,0xd6,0x00,0x51,0x0f,
+0xff,0xff,0xfd,0x3f,0xbd,0x00,0x20,0x00,0x06,0x04,0x05,0x74,0xdf,0xff,0xff,0xfe,
+0x73,0x11,0x38,0x59,0x03,0x03,0xdb,0x00,0x25,0x00,0x06,0x0c,0x00,0x12,0x30,0xbb,
+0x02,0x00,0xc6,0x02,0x52,0x30,0x00,0x00,0x01,0xaf,0xc9,0x01,0x03,0x2b,0x01,0x14,
+0xff,0x2b,0x01,0x40,0x78,0x88,0x88,0x81,0x08,0x00,0x13,0xef,0x13,0x03,0x0f,0x08,
+0x00,0x13,0x13,0xcf,0x3e,0x01,0x0f,0x08,0x00,0x0d,0x8e,0x23,0x33,0xef,0xff,0xff,
+0xf5,0x33,0x32,0x60,0x00,0x0f,0x08,0x00,0x48,0x10,0xf4,0x08,0x00,0x13,0xcf,0x09,
+0x04,0x10,0xaf,0x16,0x01,0x11,0xde,0xc9,0x01,0x01,0x4d,0x04,0x13,0x1f,0x08,0x00,
+0x13,0x06,0x08,0x00,0x02,0xc0,0x03,0x00,0x6c,0x01,0x83,0x8c,0xef,0xfd,0xb7,0x7f,
+0xff,0xff,0xf9,0x01,0x06,0x1f,0xf5,0x0c,0x00,0xb9,0x00,0xc7,0x02,0x04,0x0c,0x00,
+0x00,0xf1,0x02,0x03,0x57,0x06,0x20,0xf5,0x1f,0x75,0x06,0x30,0x00,0x01,0x7f,0x0c,
+0x00,0x11,0x0d,0x7a,0x07,0x01,0x8f,0x06,0x26,0xf5,0x07,0xe2,0x04,0x37,0xf5,0x00,
+0xef,0x0c,0x00,0x03,0xdc,0x05,0x10,0xbf,0x0c,0x00,0x21,0x03,0xdf,0x0d,0x06,0x10,
+0x6f,0x0c,0x00,0xc0,0x00,0x05,0xad,0xff,0xec,0x94,0x00,0x5f,0xff,0xff,0xf5,0x8f,
+0x87,0x02,0x03,0x70,0x04,0x22,0xb3,0xff,0x47,0x03,0x23,0x00,0xef,0xe7,0x05,0x00,
+0x75,0x02,0x10,0x3f,0x81,0x00,0x10,0x8f,0x7c,0x03,0x30,0x00,0x00,0x07,0xcb,0x02,
+0x00,0xc0,0x02,0x13,0xe0,0x77,0x07,0x22,0x00,0x0d,0x19,0x06,0x10,0x0f,0xa6,0x00,
+0x00,0x50,0x05,0x12,0xf7,0xab,0x00,0x11,0xb0,0x95,0x05,0x10,0xb0,0x63,0x05,0x00,
+0xd3,0x04,0x11,0x0e,0xb5,0x01,0x12,0x0d,0xcb,0x00,0x10,0x8f,0xf4,0x01,0x12,0x01,
+0x1f,0x00,0x11,0x03,0xa1,0x04,0x12,0x6f,0xf8,0x04,0x10,0x0e,0x8b,0x00,0x12,0x0a,
+0x25,0x00,0x20,0x00,0x8f,0x8b,0x00,0x12,0xef,0x13,0x06,0x10,0x03,0x70,0x03,0x12,
+0x3f,0x1d,0x05,0x00,0x26,0x00,0x23,0xfa,0x07,0x25,0x00,0x00,0x3b,0x04,0x23,0xe0,
+0xcf,0x38,0x06,0x00,0x26,0x00,0x01,0x31,0x05,0x03,0x26,0x00,0x14,0xfc,0x25,0x00,
+0x03,0x61,0x04,0x24,0xc0,0x00,0x26,0x00,0x01,0xa7,0x00,0x03,0x26,0x00,0x05,0x25,
+0x00,0x02,0x26,0x00,0x17,0xc0,0x2e,0x04,0x27,0xf7,0x00,0x26,0x00,0x26,0x10,0x00,
+0x26,0x00,0x17,0xc0,0x88,0x07,0x27,0xf7,0x00,0x26,0x00,0x01,0x5f,0x04,0x11,0x3f,
+0xca,0x01,0x00,0xb3,0x02,0x13,0xf0,0x09,0x04,0x12,0x0e,0xf7,0x04,0x11,0x0a,0xed,
+0x02,0x00,0x90,0x06,0x22,0xf9,0x0b,0xc6,0x02,0x12,0x0e,0x2b,0x00,0x13,0x5f,0xc4,
+0x01,0x11,0x30,0x3d,0x00,0x12,0xfd,0x66,0x00,0x22,0xf1,0x03,0x66,0x04,0x03,0xe5,
+0x06,0x10,0xcf,0x7f,0x04,0x11,0xef,0xcf,0x05,0x12,0xcf,0xf9,0x04,0x01,0x3b,0x01,
+0x10,0xbf,0x8e,0x00,0x12,0x01,0xa7,0x09,0x11,0x02,0xb2,0x01,0x10,0x7f,0x78,0x00,
+0x01,0x4c,0x04,0x11,0xf0,0x37,0x03,0x10,0x10,0x54,0x00,0x11,0xf3,0x58,0x01,0x20,
+0xff,0xf4,0x39,0x09,0x11,0xfd,0x78,0x00,0x12,0xf6,0xd7,0x00,0x31,0xf9,0x00,0x0c,
+0x84,0x00,0x10,0x0b,0x06,0x00,0x10,0x3f,0x2b,0x02,0x31,0xfd,0x00,0x0f,0x23,0x02,
+0x10,0x07,0xb5,0x00,0x11,0x7f,0xc6,0x04,0x21,0x20,0x3f,0x18,0x02,0x10,0x03,0xb5,
+0x00,0x81,0xcf,0xff,0xf9,0x0e,0xff,0xff,0x60,0x6f,0x0e,0x05,0x00,0x91,0x00,0x92,
+0x30,0xff,0xff,0xf4,0x0a,0xff,0xff,0xb0,0x9f,0x6b,0x06,0x11,0xbf,0xe3,0x07,0x61,
+0xf0,0x05,0xff,0xff,0xf0,0xdf,0x41,0x02,0x00,0x91,0x00,0x82,0x99,0xff,0xff,0xb0,
+0x01,0xff,0xff,0xf5,0x48,0x01,0x00,0x68,0x00,0x10,0xcd,0xdc,0x00,0x33,0xcf,0xff,
+0xfc,0x7e,0x02,0x13,0x0f,0x89,0x01,0x12,0x7f,0x94,0x00,0x03,0xe1,0x07,0x00,0x36,
+0x01,0x12,0x3f,0xca,0x02,0x03,0x7d,0x02,0x23,0xff,0xf8,0x8f,0x01,0x15,0xf1,0xcc,
+0x01,0x12,0xf3,0x0e,0x0a,0x03,0x9d,0x05,0x12,0xff,0x9d,0x02,0x12,0x04,0xb2,0x09,
+0x03,0x45,0x03,0x23,0xff,0xa0,0x1a,0x00,0x02,0x45,0x05,0x13,0x7f,0x0a,0x00,0x15,
+0xbf,0xd7,0x01,0x13,0x3f,0x0a,0x00,0x13,0x6f,0x8f,0x00,0x01,0x91,0x00,0x23,0xfc,
+0x00,0xad,0x01,0x02,0x12,0x00,0x13,0x0b,0xec,0x01,0x12,0x0d,0x8f,0x00,0x12,0x0d,
+0xc1,0x02,0x01,0xa2,0x04,0x23,0x70,0x04,0x29,0x06,0x11,0xaf,0x40,0x00,0x11,0xbf,
+0x3c,0x00,0x12,0x03,0xb8,0x00,0x11,0x2f,0x6d,0x00,0x12,0x0b,0x36,0x02,0x11,0x09,
+0xa8,0x00,0x12,0x5f,0xeb,0x01,0x11,0x01,0x85,0x08,0x13,0xdf,0x61,0x00,0x00,0xa0,
+0x0a,0x14,0x07,0xd9,0x00,0x00,0x5d,0x00,0x12,0x9e,0xe6,0x01,0x14,0x00,0x18,0x06,
+0x12,0xfe,0x87,0x00,0x13,0xcf,0xdb,0x03,0x05,0xb8,0x00,0x05,0x8f,0x02,0x13,0x0a,
+0x48,0x06,0x01,0x01,0x00,0x12,0x01,0x2f,0x07,0x03,0x01,0x00,0x26,0xdf,0xff,0x5a,
+0x08,0x17,0x06,0x4d,0x00,0x03,0x01,0x03,0x12,0x80,0x0d,0x00,0x02,0x0f,0x09,0x16,
+0xf2,0x40,0x00,0x04,0x42,0x00,0x00,0x5a,0x00,0x14,0xdf,0x5c,0x00,0x00,0x74,0x00,
+0x14,0x4a,0x76,0x00,0x00,0xb8,0x05,0x23,0x02,0xff,0x34,0x09,0x01,0x3d,0x00,0x12,
+0x8f,0x5d,0x00,0x11,0x0e,0x80,0x01,0x12,0x1e,0x5d,0x00,0x11,0x7f,0x5f,0x01,0x02,
+0xde,0x00,0x13,0x01,0x34,0x03,0x10,0xdf,0x5d,0x00,0x13,0x0a,0x4b,0x04,0x01,0x12,
+0x01,0x13,0x3f,0x56,0x07,0x10,0x0c,0x5d,0x00,0x13,0xcf,0x8a,0x01,0x10,0x0b,0x32,
+0x01,0x13,0x6f,0x9f,0x01,0x10,0x0f,0x4f,0x00,0x13,0x1f,0x27,0x00,0x10,0x4f,0x18,
+0x03,0x13,0x0b,0x86,0x01,0x10,0x9f,0x2f,0x00,0x22,0x05,0xff,0x73,0x03,0x11,0xef,
+0x62,0x00,0x02,0xec,0x0b,0x12,0x02,0xd2,0x00,0x11,0xaf,0x66,0x01,0x12,0x07,0xb7,
+0x00,0x11,0x5f,0xa3,0x00,0x12,0x0c,0x60,0x01,0x11,0x0f,0xd8,0x00,0x12,0x1f,0x62,
+0x00,0x11,0x0a,0x14,0x00,0x12,0x5f,0xfc,0x01,0x02,0x66,0x0b,0x04,0x94,0x09,0x13,
+0xef,0x90,0x04,0x13,0xf1,0x05,0x04,0x13,0xf6,0xe1,0x04,0x02,0x2a,0x0d,0x14,0x08,
+0x12,0x08,0x00,0xf8,0x00,0x03,0xe8,0x04,0x02,0xef,0x01,0x04,0xcc,0x05,0x01,0x10,
+0x02,0x15,0xef,0xba,0x01,0x02,0xa6,0x05,0x18,0xf0,0x79,0x01,0x18,0xa0,0xd4,0x01,
+0x12,0x50,0x0d,0x00,0x14,0x0d,0xf8,0x06,0x00,0x01,0x00,0x18,0x08,0xd4,0x01,0x12,
+0x02,0xd0,0x03,0x07,0xe1,0x01,0x14,0xe0,0x0d,0x00,0x15,0x7f,0xfc,0x02,0x12,0x00,
+0x80,0x02,0x14,0x40,0x0d,0x00,0x16,0x0c,0xfa,0x01,0x05,0x7d,0x04,0x05,0x46,0x0c,
+0x15,0xf3,0x0d,0x00,0x14,0xcf,0x4e,0x03,0x03,0x76,0x03,0x13,0x80,0xef,0x04,0x24,
+0x56,0xbf,0xe4,0x04,0x02,0x58,0x00,0x05,0x8d,0x00,0x16,0x2f,0x39,0x02,0x03,0x0d,
+0x00,0x17,0x70,0x0d,0x00,0x17,0xf8,0x8c,0x00,0x15,0xfc,0x8c,0x00,0x44,0x02,0x57,
+0x76,0x20,0x0c,0x00,0x17,0x0d,0x54,0x0e,0x16,0xdf,0xc0,0x06,0x0f,0x17,0x00,0x0f,
+0x30,0x20,0x9b,0xbb,0x01,0x00,0x07,0x91,0x09,0x16,0x5f,0x4a,0x01,0x15,0x1e,0x16,
+0x04,0x01,0xed,0x01,0x16,0xf3,0x46,0x01,0x16,0xf7,0xc0,0x05,0x13,0xfb,0x30,0x03,
+0x65,0xef,0xff,0xff,0xfe,0x10,0x00,0x32,0x04,0x16,0x40,0x4b,0x01,0x16,0x80,0x98,
+0x01,0x16,0xc0,0xaf,0x00,0x16,0xe1,0x75,0x03,0x16,0xf5,0x59,0x03,0x16,0xf9,0x9d,
+0x01,0x17,0xfd,0x9b,0x01,0x16,0x20,0x3c,0x06,0x07,0xa7,0x00,0x11,0xfb,0xbc,0x00,
+0x26,0xb8,0x1e,0xcf,0x00,0x16,0xb3,0x0b,0x00,0x2f,0xfb,0x3f,0x17,0x00,0x0a,0x50,
+0xff,0xff,0xff,0xff,0xb0,0x11,0x00,0x01,0x00,0x11,0x33,0x06,0x00,0x30,0x06,0xdf,
+0xa0,0x07,0x00,0x30,0x3d,0xff,0xff,0x07,0x00,0xf2,0x1e,0x5f,0xff,0xff,0xf5,0x00,
+0x00,0x00,0x4f,0xff,0xff,0xfe,0x50,0x00,0x00,0x0d,0xff,0xff,0xfd,0x10,0x00,0x00,
+0x07,0xff,0xff,0xff,0x10,0x00,0x00,0x00,0xdf,0xff,0xff,0x80,0x00,0x00,0x00,0x1f,
+0xff,0xff,0xf3,0x00,0x00,0x00,0x04,0xff,0x33,0x00,0x51,0x6f,0xff,0xff,0xe0,0x00,
+0x25,0x00,0x10,0xfd,0x0f,0x00,0x4f,0x7f,0xff,0xff,0xd0,0x0f,0x00,0x0e,0x13,0x08,
+0x0f,0x00,0xc2,0xaf,0xff,0xff,0xb0,0x00,0x00,0x00,0x0e,0xff,0xff,0xf8,0x00,0x68,
+0x00,0x81,0x20,0x00,0x01,0x3a,0xff,0xff,0xff,0xa0,0x6e,0x00,0x21,0xff,0xe1,0x84,
+0x00,0x22,0xff,0xd2,0x7d,0x00,0x29,0xd1,0x00,0x0f,0x00,0x00,0x1e,0x00,0x32,0x00,
+0x29,0xff,0x43,0x00,0x00,0x3c,0x00,0x16,0x30,0x4b,0x00,0x04,0x5a,0x00,0x1f,0x08,
+0x96,0x00,0x19,0x04,0x0f,0x00,0x03,0xd2,0x00,0x03,0xe1,0x00,0x00,0xf0,0x00,0x10,
+0xf4,0x08,0x00,0x81,0xcf,0xff,0xff,0x90,0x00,0x00,0x00,0x05,0xa6,0x00,0x60,0x00,
+0x00,0x0c,0xff,0xff,0xfe,0x08,0x00,0x92,0x2f,0xff,0xff,0xff,0x60,0x00,0x00,0x00,
+0x3f,0x3b,0x01,0x22,0x00,0x2c,0x36,0x00,0x42,0x00,0x05,0xcf,0xa0,0x68,0x01,0x7f,
+0x22,0x00,0xcf,0xff,0x8c,0xff,0xf8,0x05,0x00,0x51,0x52,0x34,0x44,0x20,0x00,0x51,
+0x76,0x00,0x31,0x02,0xff,0xa2,0x08,0x00,0x12,0x08,0xb5,0x01,0x00,0x39,0x01,0x22,
+0xfc,0x00,0xb7,0x00,0x23,0xff,0xb0,0xf5,0x00,0x10,0xf6,0x08,0x00,0x40,0x09,0xff,
+0xff,0xfe,0x08,0x00,0x57,0x01,0xff,0xff,0xff,0x50,0xe8,0x00,0x57,0x00,0x8f,0xff,
+0xff,0xc0,0x0f,0x01,0x00,0x1c,0x02,0x1f,0xf0,0x08,0x00,0x20,0x00,0x19,0x01,0x10,
+0xf2,0x08,0x00,0x13,0x0f,0x71,0x00,0x40,0x0a,0xff,0xff,0xfe,0x4f,0x02,0x62,0x03,
+0xff,0xff,0xff,0xe6,0x20,0x8a,0x00,0x23,0xff,0xf5,0xc4,0x01,0x17,0xf5,0x86,0x02,
+0x13,0x08,0x10,0x00,0x12,0x8f,0x08,0x00,0x00,0x30,0x00,0x53,0xd5,0x10,0x00,0x00,
+0x0b,0x40,0x00,0x04,0x50,0x00,0x04,0x60,0x00,0x0f,0xa0,0x00,0x25,0x04,0xe0,0x00,
+0x04,0xf0,0x00,0x12,0xcf,0x32,0x01,0x52,0x02,0xff,0xff,0xff,0x40,0xaf,0x00,0x13,
+0xfd,0x1f,0x00,0x13,0xf5,0x81,0x02,0x12,0x90,0x48,0x01,0x22,0xfa,0x00,0xb5,0x00,
+0x12,0x70,0x3f,0x01,0x12,0x91,0x79,0x01,0x00,0x34,0x00,0x02,0x01,0x02,0x40,0xae,
+0xfe,0xc7,0x10,0x09,0x00,0xa2,0x12,0x22,0x22,0x00,0x01,0xcf,0xff,0xff,0xff,0xf7,
+0x48,0x00,0x53,0xfc,0x00,0x1d,0xff,0xff,0x87,0x01,0x51,0xbf,0xff,0xfb,0x00,0xaf,
+0x0e,0x00,0x20,0xfc,0x10,0x73,0x00,0x32,0xf8,0x04,0xff,0x01,0x00,0xb0,0xe5,0x00,
+0x1c,0xff,0xff,0xf5,0x0a,0xff,0xff,0xff,0xdd,0x0f,0x00,0x60,0xed,0xff,0xff,0xff,
+0xf0,0x0f,0x8a,0x02,0x13,0x2b,0x21,0x00,0x21,0x90,0x2f,0x7a,0x00,0x00,0x1d,0x01,
+0x00,0x11,0x01,0x11,0x4f,0xa4,0x03,0x11,0x06,0x0e,0x00,0x32,0xf3,0x00,0x5f,0xd4,
+0x01,0x10,0x3d,0x1b,0x00,0x51,0x30,0x00,0x01,0x11,0x10,0x92,0x00,0x31,0x5b,0xef,
+0xec,0xac,0x00,0x20,0x37,0x98,0xe9,0x01,0x11,0x1b,0xe5,0x03,0x30,0x01,0xef,0xff,
+0x48,0x01,0x11,0x0c,0x39,0x00,0xf0,0x02,0x30,0x5f,0xff,0xe5,0x02,0xbf,0xff,0xb0,
 0xbf,0xff,0x30,0x00,0x0c,0xff,0xf0,0xdf,0xfc,0x52,0x00,0x30,0xf3,0xef,0xfb,0xf6,
-0x02,0x30,0xf3,0xcf,0xfe,0x2d,0x02,0x20,0xf2,0x8f,0xcc,0x13,0x00,0x54,0x2a,0x63,
-0xfe,0xac,0xff,0xff,0x70,0x06,0x5a,0x34,0x01,0x2f,0x87,0x01,0x1f,0x65,0x1c,0xb5,
-0x58,0x1c,0x0f,0x72,0x68,0x03,0x04,0xba,0x22,0x17,0xde,0x14,0x00,0x84,0xf2,0xef,
-0x00,0xfa,0xe6,0x00,0xe6,0x00,0xa8,0x1f,0x0a,0x3a,0x8a,0x3d,0x0b,0x00,0x06,0x15,
-0x00,0x1f,0xaf,0xe1,0x68,0x15,0x1f,0xba,0x1d,0x00,0x09,0x03,0x84,0x00,0xb2,0xe9,
-0x00,0xfa,0x00,0x00,0xde,0xfb,0xea,0xf5,0x00,0xd5,0x8f,0x00,0x7c,0xfd,0x00,0x00,
-0xfb,0xfd,0xf2,0xf7,0x8e,0x00,0x7e,0xf8,0x00,0xf9,0x00,0x00,0xf0,0x00,0x01,0x00,
-0x06,0x17,0x07,0x03,0xbb,0x06,0x19,0xfd,0x1f,0x00,0x02,0x33,0x06,0x40,0xdd,0x00,
-0x00,0x00,0x3a,0x02,0x68,0xe8,0x00,0xfa,0x00,0xfa,0xf4,0xd3,0x5f,0x0e,0xf3,0x00,
-0x05,0x3a,0x00,0x11,0xfb,0x3d,0x00,0x25,0xfb,0xf9,0x9a,0x09,0x00,0xcf,0x27,0x35,
-0xc9,0x00,0xc5,0x23,0x00,0x62,0xf6,0xfa,0x00,0x00,0xfa,0xf9,0x04,0x00,0x08,0xd8,
-0x69,0x03,0x8c,0x00,0x2f,0x05,0xf8,0x65,0x00,0x06,0x1f,0xfa,0x3a,0x01,0x0c,0x00,
-0x76,0x05,0x1a,0xf7,0xe5,0x00,0x10,0xf8,0x07,0x00,0x20,0xf5,0xee,0x0e,0x00,0x14,
-0xae,0x69,0x00,0x96,0xee,0x00,0x00,0xc6,0xf9,0xc5,0xe6,0x00,0xb1,0x2a,0x00,0x25,
-0xfc,0xdd,0x6c,0x31,0x72,0x8d,0x00,0x00,0x00,0xcd,0x00,0xcc,0x57,0x01,0xdd,0x00,
-0xf6,0x00,0xfd,0xfc,0x00,0x00,0xfc,0x00,0x00,0x04,0x00,0x04,0x70,0x00,0x6f,0xf7,
-0x00,0xf8,0xfa,0x00,0xf6,0x93,0x00,0x0a,0x10,0xf2,0x0e,0x01,0x08,0x42,0x33,0x06,
-0x69,0x02,0xc0,0xb7,0xb3,0x00,0x00,0xde,0xf8,0xc3,0xfb,0x05,0x00,0x05,0x04,0xfe,
-0x00,0xd2,0xd0,0xe7,0x00,0xe7,0xc5,0xee,0xea,0x00,0xee,0xe9,0xf3,0xea,0xef,0x54,
-0x01,0x66,0xc3,0xd3,0x00,0x00,0xeb,0xfc,0x23,0x01,0xa3,0xf3,0xf4,0x00,0x00,0xf3,
-0xf7,0x00,0x00,0xf8,0xfd,0x31,0x01,0x71,0x04,0x00,0xd7,0xef,0x00,0x00,0xf4,0x0a,
-0x00,0x02,0x83,0x09,0x63,0xf7,0xf7,0x00,0x00,0xf7,0xfa,0xc2,0x01,0x03,0x15,0x00,
-0x14,0xd4,0xf1,0x01,0x15,0x04,0x18,0x01,0x10,0xfa,0x4f,0x01,0x13,0xf7,0xc7,0x00,
-0xf6,0x11,0x06,0xf2,0xbe,0xd5,0x00,0x00,0xd5,0xf8,0xe5,0xfb,0x05,0xe5,0x05,0x05,
-0x04,0x05,0x00,0x05,0xee,0xee,0xfa,0xf5,0xee,0xf5,0xf0,0xfa,0xf5,0xfa,0x00,0xf9,
-0xf7,0x05,0x0f,0x34,0x1a,0xf9,0x8e,0x01,0x10,0xfa,0xea,0x01,0x3c,0xf8,0xf8,0x00,
-0x3c,0x02,0x08,0xef,0x61,0x0c,0x55,0x02,0x0f,0x01,0x00,0x04,0x02,0xe6,0x00,0x0f,
-0xfc,0x01,0x07,0x01,0xa3,0x02,0x2c,0xfc,0xfc,0xa9,0x02,0x0f,0x4c,0x00,0x08,0x0f,
-0x1d,0x00,0x0a,0x1e,0x05,0xa2,0x03,0x39,0x05,0x00,0xf9,0x0e,0x00,0x1f,0xe9,0x15,
-0x71,0x24,0x0a,0xa6,0x02,0x1f,0xe7,0x8c,0x00,0x0b,0x22,0xfa,0xfb,0xc9,0x01,0x1c,
-0xcf,0x5b,0x02,0x30,0xfb,0x06,0x00,0x56,0x10,0x3f,0x00,0x05,0x05,0x41,0x00,0x09,
-0x17,0xf7,0xab,0x35,0x03,0x01,0x03,0x09,0x60,0x00,0x2c,0xfc,0x04,0x0d,0x01,0x1f,
-0xdd,0xd2,0x00,0x23,0x1e,0xf5,0x23,0x00,0x0f,0xf5,0x01,0x12,0x1f,0xfa,0xb6,0x03,
-0x05,0x12,0x01,0xdd,0x87,0x31,0x02,0x03,0x00,0x5c,0x03,0x1e,0x05,0x52,0x04,0xf2,
-0x0b,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,
-0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x3a,0x6a,0xf7,0x0b,0x1b,
-0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,
-0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x61,0x00,0x20,0x03,0x02,0x5c,0x00,
-0x4b,0x06,0x07,0x06,0x08,0x5f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,
-0x00,0x21,0x0c,0x00,0x08,0x00,0xd0,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,
-0x14,0x00,0x00,0x15,0x94,0x14,0x61,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xf0,
-0x04,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,
-0x00,0x23,0x00,0x00,
+0x02,0x30,0xf3,0xcf,0xfe,0x2d,0x02,0xf1,0x00,0xf2,0x8f,0xff,0xa0,0x00,0x4f,0xff,
+0xe0,0x1f,0xff,0xfe,0xac,0xff,0xff,0x70,0x71,0x00,0x11,0xfb,0x45,0x01,0xa0,0xff,
+0xb0,0x00,0x00,0x02,0x9d,0xfe,0xb5,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -913,11 +1065,24 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 176, .range_length = 1, .glyph_id_start = 96, .list_length = 0, .type = 2, .unicode_list = 0, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[39492] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 1395, .size = 4034, .comp_size = 2179 },
+{ .bitmap_start = 4034, .comp_offset = 3574, .size = 3918, .comp_size = 1735 },
+{ .bitmap_start = 7952, .comp_offset = 5309, .size = 3934, .comp_size = 2016 },
+{ .bitmap_start = 11886, .comp_offset = 7325, .size = 4068, .comp_size = 1112 },
+{ .bitmap_start = 15954, .comp_offset = 8437, .size = 3909, .comp_size = 1511 },
+{ .bitmap_start = 19863, .comp_offset = 9948, .size = 4014, .comp_size = 1628 },
+{ .bitmap_start = 23877, .comp_offset = 11576, .size = 3975, .comp_size = 1433 },
+{ .bitmap_start = 27852, .comp_offset = 13009, .size = 3921, .comp_size = 1374 },
+{ .bitmap_start = 31773, .comp_offset = 14383, .size = 4029, .comp_size = 1894 },
+{ .bitmap_start = 35802, .comp_offset = 16277, .size = 1120, .comp_size = 612 },
+};
+
+static uint8_t etxUncompBuf[2570] __SDRAMFONTS;
 
 const etxLz4Font lv_font_en_bold_XXL = {
-.uncomp_size = 39292,
-.comp_size = 14452,
+.uncomp_size = 2370,
+.comp_size = 1395,
 .line_height = 54,
 .base_line = 12,
 .subpx = 0,
@@ -930,12 +1095,13 @@ const etxLz4Font lv_font_en_bold_XXL = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 35,
-.glyph_bitmap = 776,
-.class_pair_values = 37698,
-.left_class_mapping = 39098,
-.right_class_mapping = 39195,
+.class_pair_values = 776,
+.left_class_mapping = 2176,
+.right_class_mapping = 2273,
+.block_num = 10,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 39492,
+.lvglFontBufSize = 2570,
 };
@@ -82,375 +82,379 @@ static const uint8_t lz4FontData[] ={
 0x08,0x00,0x43,0x07,0x00,0x00,0xe4,0x08,0x00,0x22,0x12,0x15,0x08,0x00,0x13,0x40,
 0x08,0x00,0x13,0x6e,0x08,0x00,0x10,0x9c,0x08,0x00,0x52,0x09,0x00,0xff,0xd7,0x15,
 0x58,0x00,0x22,0x09,0x16,0x08,0x00,0x22,0x3b,0x16,0xa8,0x00,0x22,0x78,0x16,0xc8,
-0x00,0x22,0xac,0x16,0x60,0x00,0x60,0xd8,0x16,0x10,0x0a,0x0b,0x07,0x60,0x06,0xf1,
-0x95,0x2e,0x1a,0x71,0x1c,0x0d,0xea,0x14,0xea,0x17,0xea,0x18,0xea,0x19,0xea,0x1d,
+0x00,0x22,0xac,0x16,0x60,0x00,0x60,0xd8,0x16,0x10,0x0a,0x0b,0x07,0x60,0x06,0xf8,
+0x6e,0x2e,0x1a,0x71,0x1c,0x0d,0xea,0x14,0xea,0x17,0xea,0x18,0xea,0x19,0xea,0x1d,
 0xea,0x1f,0xea,0x21,0xea,0x25,0xea,0x28,0xea,0x2d,0xea,0x32,0xea,0x33,0xea,0x34,
 0xea,0x4a,0xea,0x4f,0xea,0x54,0xea,0x57,0xea,0x58,0xea,0x59,0xea,0x5d,0xea,0x5e,
 0xea,0x5f,0xea,0x60,0xea,0x73,0xea,0x74,0xea,0x7a,0xea,0x7c,0xea,0x7d,0xea,0x80,
 0xea,0x83,0xea,0x84,0xea,0x85,0xea,0x87,0xea,0x9f,0xea,0xa1,0xea,0xd0,0xea,0xd1,
 0xea,0xd3,0xea,0xd5,0xea,0xec,0xea,0xf3,0xea,0xf6,0xea,0xff,0xea,0x28,0xeb,0x30,
 0xeb,0x67,0xeb,0xf7,0xeb,0x4c,0xec,0x4d,0xec,0x4e,0xec,0x4f,0xec,0x50,0xec,0x93,
-0xec,0x9f,0xec,0xf9,0xec,0x10,0xed,0x66,0xef,0xce,0xf1,0xae,0xf2,0x2c,0x2b,0x2b,
-0x2b,0x2b,0x17,0x00,0x2b,0x55,0xa5,0x59,0x32,0x60,0x00,0x55,0x55,0x00,0x08,0x29,
-0x20,0x0c,0xec,0xec,0x00,0x0b,0x0b,0x00,0x00,0xa0,0xa0,0x05,0xce,0xcd,0x80,0x05,
-0x56,0x50,0x00,0x82,0x92,0x09,0x07,0xf0,0x85,0x74,0x00,0x05,0xdc,0x30,0x1d,0x14,
-0xd0,0x2c,0x00,0x80,0x0b,0xa3,0x00,0x00,0x5c,0x70,0x23,0x00,0xd0,0x4b,0x01,0xe0,
-0x09,0xed,0x50,0x00,0x83,0x00,0x1b,0xb1,0x00,0x07,0x45,0x63,0x70,0x64,0x55,0xa0,
-0x01,0xa9,0x65,0x00,0x00,0x0a,0x6a,0x40,0x08,0x3b,0x0b,0x01,0x90,0xb0,0xb0,0x00,
-0x08,0xa6,0x05,0xdc,0x10,0x00,0xd1,0x67,0x00,0x0c,0x3a,0x40,0x00,0x5f,0x70,0x00,
-0x1d,0xa9,0x07,0x07,0x80,0xc8,0x90,0x59,0x02,0xf4,0x00,0x9b,0xc9,0xc0,0x73,0x73,
-0x41,0x00,0x71,0x04,0x90,0x0b,0x10,0x1c,0x00,0x4a,0x00,0x59,0x00,0x49,0x00,0x2b,
-0x00,0x0d,0x00,0x09,0x40,0x01,0xb0,0x00,0x21,0x81,0x03,0xa0,0x0b,0x20,0x67,0x04,
-0xa0,0x2b,0x03,0xb0,0x49,0x08,0x50,0xc0,0x76,0x03,0x00,0x03,0x80,0x07,0x69,0x80,
-0x3b,0xe5,0x01,0xca,0x30,0x13,0x13,0x00,0x00,0x83,0x00,0x00,0xa4,0x03,0x00,0x32,
-0x9f,0xff,0xf3,0x09,0x00,0xf6,0x28,0x67,0x85,0x70,0xad,0x70,0x01,0x3b,0x00,0x1a,
-0x00,0x74,0x00,0xb0,0x02,0x90,0x08,0x40,0x0c,0x00,0x38,0x00,0x83,0x00,0x60,0x00,
-0x08,0xdc,0x30,0x2c,0x03,0xc0,0x58,0x00,0xe0,0x67,0x00,0xd0,0x67,0x00,0xd0,0x58,
-0x00,0xe0,0x2c,0x03,0xb0,0x07,0xdc,0x30,0x03,0x98,0x2b,0x99,0x00,0x59,0x02,0x00,
-0xf0,0x6e,0x09,0xdd,0x30,0x5a,0x03,0xc0,0x32,0x01,0xd0,0x00,0x07,0x80,0x00,0x3c,
-0x00,0x01,0xd2,0x00,0x0b,0x40,0x00,0x6f,0xdd,0xd3,0x0a,0xdd,0x35,0x80,0x2c,0x00,
-0x04,0xb0,0x1d,0xf2,0x00,0x04,0xb2,0x20,0x0e,0x5a,0x03,0xc0,0xad,0xc2,0x00,0x0d,
-0x60,0x00,0x7e,0x60,0x01,0xc8,0x60,0x0a,0x38,0x60,0x4a,0x08,0x60,0xad,0xde,0xe5,
-0x00,0x08,0x60,0x00,0x08,0x60,0x0a,0xff,0xf0,0x0c,0x10,0x00,0x0d,0x00,0x00,0x0e,
-0xdd,0x50,0x04,0x02,0xe0,0x00,0x00,0xb2,0x1c,0x00,0xd1,0x06,0xdd,0x60,0x01,0xae,
-0x10,0x0b,0x80,0x00,0x1d,0x00,0x00,0x4c,0xcd,0x40,0x5d,0x12,0xe0,0x49,0x00,0xc1,
-0x1d,0x01,0xd0,0x05,0xdd,0x40,0x8d,0xdd,0xf2,0x00,0x01,0xc0,0x00,0x07,0x60,0x34,
-0x00,0x70,0x49,0x00,0x00,0xb3,0x00,0x01,0xd0,0x4a,0x00,0xf0,0x5b,0x09,0xdd,0x40,
-0x3c,0x02,0xd0,0x2c,0x03,0xc0,0x09,0xef,0x30,0x3c,0x03,0xc0,0x67,0x00,0xd0,0x4b,
-0x02,0xd0,0x08,0xdd,0x40,0x09,0xdc,0x15,0xa0,0x5a,0x76,0x00,0xd4,0xb0,0x4f,0x08,
-0xd8,0xe0,0x00,0x3c,0x00,0x0b,0x60,0x7e,0x70,0x3a,0x01,0x00,0x00,0x01,0x3a,0x58,
-0x01,0x00,0x00,0x12,0x58,0x84,0x30,0x00,0x18,0x40,0x8d,0x70,0x9c,0x10,0x00,0x7d,
-0x81,0x00,0x08,0x40,0x3e,0xee,0xb0,0x00,0x00,0x3e,0xee,0xb0,0x49,0x10,0x00,0x6d,
-0x91,0x00,0x0a,0xc1,0x7d,0x81,0x48,0x10,0x00,0x1c,0xea,0x08,0x60,0xb3,0x00,0x0a,
-0x30,0x04,0xc0,0x00,0xd1,0x00,0x27,0xdc,0x01,0xf0,0x7c,0x3a,0x00,0x00,0x3b,0xbb,
-0x80,0x00,0x3a,0x00,0x04,0x90,0x0b,0x02,0xba,0x18,0x22,0x80,0xb1,0x92,0x35,0x55,
-0x1a,0x0a,0x12,0x76,0x44,0x80,0xb0,0x36,0x56,0x38,0x0d,0x07,0x31,0xa0,0xb9,0x7a,
-0x80,0x09,0x50,0x00,0x00,0x00,0x07,0xba,0xa0,0x00,0x00,0x5d,0x00,0x00,0x0a,0xd2,
-0x00,0x00,0xd5,0x80,0x00,0x59,0x0d,0x00,0x0a,0x30,0xb3,0x00,0xfd,0xde,0x80,0x59,
-0x00,0x1d,0x0b,0x40,0x00,0xb3,0x2f,0xdd,0xb0,0x2c,0x00,0x96,0x2c,0x00,0xa5,0x2f,
-0xde,0xc0,0x2c,0x00,0x97,0x2c,0x00,0x5a,0x2c,0x00,0x97,0x2f,0xdd,0xa0,0x03,0xcd,
-0xb2,0x00,0xd3,0x05,0xb0,0x4a,0x00,0x09,0x06,0x80,0x00,0x00,0x68,0x00,0x00,0x04,
-0xa0,0x00,0x80,0x0d,0x30,0x5b,0x00,0x3c,0xdb,0x10,0x2f,0xed,0x70,0x2c,0x00,0xb6,
-0x2c,0x00,0x2c,0x2c,0x00,0x0e,0x03,0x00,0x00,0x09,0x00,0xd1,0xb6,0x2f,0xde,0x70,
-0x2f,0xdd,0xd4,0x2c,0x00,0x00,0x2c,0x00,0x00,0x55,0x00,0x14,0x00,0x0c,0x00,0x47,
-0xd4,0x2f,0xdd,0xd3,0x0f,0x00,0x15,0xa0,0x0c,0x00,0xa1,0x03,0xcd,0xc2,0x00,0xd3,
-0x04,0xc0,0x4b,0x00,0x06,0x64,0x00,0xf0,0x05,0x06,0xde,0x14,0xb0,0x00,0xd1,0x0d,
-0x40,0x1e,0x10,0x2c,0xed,0x60,0x2c,0x00,0x0a,0x42,0xc0,0x00,0xa4,0x07,0x00,0x36,
-0xfd,0xdd,0xf4,0x0e,0x00,0x00,0x07,0x00,0x13,0x1d,0x01,0x00,0x53,0x00,0x03,0xc0,
-0x00,0x3c,0x05,0x00,0xf5,0x15,0xc3,0x00,0x3b,0x96,0x07,0x91,0xcd,0xb1,0x2c,0x00,
-0x7a,0x02,0xc0,0x4d,0x00,0x2c,0x2d,0x20,0x02,0xcd,0x60,0x00,0x2f,0xad,0x00,0x02,
-0xc0,0x89,0x00,0x2c,0x00,0xd4,0x02,0xc0,0x03,0xd0,0x79,0x00,0x08,0x03,0x00,0xf1,
-0x52,0x2f,0xdd,0xd1,0x2f,0x30,0x00,0x7e,0x2f,0x90,0x00,0xde,0x2b,0xd0,0x03,0xbe,
-0x2b,0x94,0x09,0x5e,0x2c,0x4a,0x0d,0x0e,0x2c,0x0d,0x59,0x0e,0x2c,0x08,0xe4,0x0e,
-0x2c,0x02,0xe0,0x0e,0x2f,0x10,0x0a,0x42,0xfa,0x00,0xa4,0x2c,0xd3,0x0a,0x42,0xc4,
-0xc0,0xa4,0x2c,0x0b,0x6a,0x42,0xc0,0x2e,0xb4,0x2c,0x00,0x8f,0x42,0xc0,0x00,0xe4,
-0x02,0xce,0xb1,0x00,0xd4,0x05,0xc0,0x4b,0x00,0x0d,0x26,0x80,0x00,0xa4,0x68,0x00,
-0x0a,0x44,0xb0,0x00,0xd2,0x0d,0x40,0x5c,0x00,0x2c,0xeb,0x10,0x2f,0xed,0xc2,0x2c,
-0x00,0x5b,0x22,0x01,0x46,0x5b,0x2f,0xdd,0xb2,0xf8,0x00,0xf1,0x16,0xce,0xb1,0x00,
-0xd3,0x06,0xb0,0x4a,0x00,0x0d,0x17,0x70,0x00,0xb3,0x77,0x00,0x0b,0x35,0xa0,0x00,
-0xd1,0x0d,0x30,0x6b,0x00,0x3c,0xef,0x40,0x00,0x00,0x4d,0x10,0x00,0x00,0x00,0x2f,
-0xee,0xa0,0x8e,0x01,0xfe,0x1f,0x4a,0x2c,0x00,0xa7,0x2f,0xde,0xa0,0x2c,0x04,0xb0,
-0x2c,0x00,0xc3,0x2c,0x00,0x4b,0x07,0xdd,0x80,0x3c,0x00,0xb5,0x5b,0x00,0x22,0x0b,
-0xb5,0x00,0x00,0x3a,0xd1,0x32,0x00,0x87,0x6a,0x00,0x96,0x08,0xdd,0xa0,0xad,0xee,
-0xda,0x00,0x77,0x00,0x03,0x00,0x38,0x59,0x00,0x1d,0x03,0x00,0xf0,0x45,0x4a,0x00,
-0x2c,0x1d,0x10,0x79,0x05,0xde,0xa1,0xb4,0x00,0x0e,0x15,0x90,0x04,0xb0,0x1e,0x00,
-0x96,0x00,0xb3,0x0d,0x10,0x06,0x83,0xb0,0x00,0x1d,0x86,0x00,0x00,0xbe,0x10,0x00,
-0x06,0xc0,0x00,0x95,0x00,0xf0,0x06,0x86,0x80,0x4f,0x40,0x95,0x2b,0x08,0x98,0x0c,
-0x10,0xe0,0xc1,0xb0,0xd0,0x0b,0x3c,0x0c,0x3a,0x00,0x89,0x80,0x89,0x70,0x04,0xf4,
-0x04,0xf4,0x00,0x1f,0x00,0x0f,0x00,0x6b,0x00,0x7a,0x0d,0x41,0xe2,0x04,0xd9,0x80,
-0x00,0xbe,0x37,0x00,0xf6,0x08,0x04,0xc8,0x90,0x0d,0x30,0xe2,0x6a,0x00,0x6b,0xa5,
-0x00,0x6a,0x3d,0x00,0xd2,0x0b,0x45,0xb0,0x03,0xcc,0x30,0x00,0xbb,0x88,0x00,0xf6,
-0x0e,0x7d,0xdd,0xf6,0x00,0x01,0xe1,0x00,0x0b,0x50,0x00,0x4c,0x00,0x00,0xd2,0x00,
-0x08,0x80,0x00,0x2d,0x00,0x00,0x9f,0xdd,0xd8,0x4d,0x74,0xa0,0x4a,0x04,0x03,0x00,
-0x60,0x4e,0x70,0xa3,0x00,0x04,0x90,0x5c,0x03,0x40,0x94,0x00,0x03,0xa0,0x08,0x00,
-0x94,0x85,0x00,0x02,0xa0,0x00,0x06,0x00,0xcc,0x0e,0x01,0x00,0xf4,0x63,0xcc,0x06,
-0x90,0x0c,0xc0,0x2a,0x84,0x85,0x2a,0xdd,0xdd,0x60,0x44,0x00,0xc1,0x09,0xdc,0x22,
-0x60,0x4a,0x07,0xbc,0xb5,0xa0,0x3b,0x69,0x07,0xb0,0xcd,0x9b,0x59,0x00,0x00,0x59,
-0x00,0x00,0x5c,0xcd,0x40,0x5c,0x02,0xd0,0x59,0x00,0xc1,0x59,0x00,0xc1,0x5c,0x02,
-0xd0,0x5b,0xce,0x40,0x08,0xdc,0x34,0xb0,0x2c,0x86,0x00,0x17,0x60,0x00,0x4b,0x02,
-0xb0,0x8d,0xc2,0x00,0x00,0xe0,0x00,0x0e,0x09,0xda,0xe4,0xb0,0x2e,0x76,0x00,0xe7,
-0x60,0x0e,0x4b,0x02,0xe0,0x9c,0xae,0x07,0xdc,0x33,0xa0,0x2c,0x7e,0xdd,0xd7,0x70,
-0x00,0x4c,0x01,0x60,0x8d,0xd4,0x03,0xd6,0x0c,0x30,0x0d,0x00,0x8f,0xc1,0x0e,0x00,
-0x02,0x00,0x43,0x09,0xda,0xe4,0xc0,0x30,0x00,0xf1,0x09,0x03,0xe0,0x9e,0xae,0x03,
-0x03,0xc0,0x9d,0xc3,0x59,0x00,0x05,0x90,0x00,0x5b,0xbe,0x45,0xc0,0x3c,0x59,0x01,
-0xd5,0x90,0x1d,0x05,0x00,0x31,0x3a,0x00,0x3a,0x01,0x00,0x62,0x04,0x90,0x00,0x04,
-0x90,0x49,0x03,0x00,0x32,0x05,0x94,0xe4,0x9b,0x00,0xf3,0x04,0x59,0x0b,0x60,0x59,
-0x89,0x00,0x5d,0xe0,0x00,0x5d,0xb6,0x00,0x59,0x1d,0x10,0x59,0x05,0xb0,0x3a,0x01,
-0x00,0xf5,0x03,0x5b,0xcd,0x5b,0xe8,0x05,0xb0,0x3f,0x10,0xe0,0x59,0x01,0xd0,0x0d,
-0x15,0x90,0x1d,0x00,0xd1,0x09,0x00,0x0b,0x61,0x00,0xf6,0x08,0x07,0xdd,0x40,0x4c,
-0x02,0xd0,0x86,0x00,0xb2,0x76,0x00,0xb3,0x3c,0x01,0xe0,0x07,0xdd,0x40,0x5c,0xbd,
-0x40,0x5b,0x01,0xf1,0x00,0x32,0x5c,0xcd,0x40,0x6e,0x00,0x36,0x09,0xda,0xd4,0xe3,
-0x00,0x21,0x9d,0xae,0xf7,0x00,0x55,0x00,0x00,0x5c,0xd3,0x5c,0x46,0x05,0xf6,0x0c,
-0x0a,0xdc,0x14,0xa0,0x56,0x1d,0x82,0x00,0x05,0xc5,0x67,0x05,0x90,0xad,0xc2,0x07,
-0x00,0xe0,0xbf,0xa0,0xe0,0x0e,0x00,0xe0,0x0e,0x00,0xac,0x71,0x00,0xf4,0x66,0x3b,
-0x04,0xd0,0xbd,0xad,0xb3,0x06,0x75,0x80,0xb2,0x1c,0x0d,0x00,0xb6,0x80,0x06,0xe3,
-0x00,0x1e,0x00,0xa3,0x0c,0x30,0xb2,0x67,0x0e,0x80,0xd0,0x2b,0x47,0xc3,0xa0,0x0d,
-0x92,0xb8,0x60,0x0a,0xd0,0x6f,0x20,0x06,0x90,0x2e,0x00,0x79,0x0a,0x60,0xd5,0xc0,
-0x04,0xf3,0x00,0x5f,0x40,0x0d,0x3d,0x08,0x80,0x97,0xb3,0x08,0x76,0x80,0xc2,0x1d,
-0x1c,0x00,0xb7,0x70,0x06,0xf2,0x00,0x1d,0x00,0x06,0x70,0x08,0xd1,0x00,0x7d,0xdf,
-0x70,0x02,0xd0,0x00,0xb4,0x00,0x6a,0x00,0x1d,0x10,0x08,0xed,0xd8,0x00,0x82,0x06,
-0x80,0x0a,0x40,0x0a,0x30,0x0c,0x10,0xaa,0x00,0x0c,0x10,0x0a,0x30,0x0a,0x40,0x06,
-0x80,0x00,0x82,0x29,0x01,0x00,0xf5,0x6f,0x14,0x82,0x00,0x2c,0x00,0x0e,0x00,0x0d,
-0x00,0x0b,0x30,0x04,0xf0,0x0b,0x20,0x0d,0x00,0x0e,0x00,0x2c,0x00,0x82,0x00,0x0b,
-0xd6,0x0b,0x13,0x70,0x9e,0x80,0x00,0x00,0xa3,0x00,0x00,0x00,0x0d,0xd3,0x00,0xed,
-0xdd,0xc2,0xd3,0x0d,0x00,0x00,0x02,0xd2,0xd0,0x00,0x00,0x4c,0x1c,0xdd,0xde,0x3d,
-0x10,0x00,0x00,0xdd,0x10,0x00,0x00,0x08,0x20,0x00,0x00,0x02,0xb0,0x00,0x00,0x02,
-0xde,0x00,0x00,0x02,0xd3,0xad,0xdd,0xe2,0xd3,0x00,0x00,0x0d,0x1d,0x50,0x00,0x00,
-0xd0,0x1c,0x5c,0xdd,0xdc,0x00,0x1c,0xf0,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x01,
-0x10,0x00,0x00,0x2d,0xd2,0x00,0x02,0xd3,0x3d,0x20,0x2d,0x30,0x03,0xd2,0x8d,0xe0,
-0x0e,0xd8,0x00,0xd0,0x0d,0x00,0x04,0x00,0xb8,0xdd,0xdd,0x00,0x00,0x11,0x11,0x00,
-0x00,0xdb,0xbd,0x00,0x18,0x00,0xf3,0x00,0xaf,0xc0,0x0c,0xfa,0x1c,0x50,0x05,0xc1,
-0x01,0xc5,0x5c,0x10,0x00,0x1c,0xc1,0x8e,0x0e,0x40,0x22,0x00,0x00,0x00,0xff,0x02,
-0xf1,0x0f,0x00,0x03,0xee,0x30,0x00,0x00,0x0c,0x77,0xb0,0x00,0x00,0x4e,0x00,0xe4,
-0x00,0x00,0xc5,0x00,0x6c,0x00,0x05,0xe2,0x22,0x2e,0x50,0x0d,0xff,0xff,0xff,0xd0,
-0x2b,0x00,0xf1,0x10,0x01,0x4d,0xd3,0x05,0xd8,0xc3,0x4b,0x3d,0x10,0xff,0xf5,0xa5,
-0x02,0xfe,0x78,0xb2,0x05,0x90,0x2b,0x96,0x00,0x00,0x69,0x2d,0x30,0x03,0xd1,0x03,
-0xcd,0xdc,0x30,0x98,0x00,0xf0,0x1f,0x08,0xcc,0x61,0x00,0x01,0xd3,0xee,0x3d,0x10,
-0x0b,0x70,0x44,0x07,0xb0,0x1a,0x20,0x00,0x01,0xc1,0x1a,0x10,0x00,0x01,0xb1,0x0b,
-0x50,0x00,0x05,0x90,0x04,0xc5,0x00,0x5a,0x60,0x00,0x4a,0xec,0x95,0x00,0x00,0x00,
-0x32,0x00,0x00,0x00,0x10,0x77,0x00,0xf0,0x17,0xeb,0xcd,0x91,0x00,0x1e,0x29,0xb1,
-0x4d,0x30,0x0c,0x90,0xb7,0x02,0xc0,0x0d,0x9c,0xc1,0x00,0xc2,0x0d,0x05,0x10,0x00,
-0xb3,0x0a,0x50,0x00,0x01,0xd0,0x02,0xd3,0x00,0x1b,0x50,0x00,0x2b,0xdd,0xd5,0x7f,
-0x00,0x10,0x00,0xd7,0x00,0xf2,0x11,0x10,0x00,0xef,0xff,0xf4,0x03,0xe0,0x00,0xd0,
-0x07,0x90,0x08,0x70,0x06,0xc0,0x97,0x00,0x4c,0xc5,0xd0,0x00,0x94,0x97,0xb2,0x00,
-0x77,0x00,0xd0,0x00,0x0b,0xcd,0x50,0x56,0x00,0xf0,0x10,0x04,0x43,0x00,0x00,0x0f,
-0xfc,0x00,0x1c,0x98,0x88,0x88,0x18,0x02,0x22,0x09,0x18,0x3b,0xba,0x09,0x08,0x15,
-0x54,0x09,0x08,0x27,0x76,0x09,0x0c,0x99,0x99,0x88,0x1c,0x00,0x31,0x00,0x02,0x21,
-0xd6,0x00,0xf2,0x39,0x20,0x04,0xcf,0xf8,0xb8,0x6f,0x71,0x32,0x91,0xb9,0x00,0x00,
-0x90,0x05,0xa0,0x00,0x90,0x09,0x50,0x00,0x92,0xd4,0x00,0x00,0xb9,0x9d,0x30,0x00,
-0x30,0x08,0xfe,0xfa,0x00,0x00,0x13,0x30,0x14,0x44,0x44,0x41,0x85,0xf8,0x44,0x58,
-0x90,0x62,0x7e,0xf8,0x91,0xf6,0x4d,0xf8,0x90,0x62,0x00,0x08,0x91,0xf6,0x00,0x08,
-0x90,0x83,0x00,0x08,0x90,0xe6,0x00,0x08,0x89,0xfc,0x99,0x98,0x4f,0x01,0xf2,0x17,
-0x3b,0xee,0xb2,0x00,0x04,0xd3,0x99,0x3d,0x40,0x0d,0x20,0x99,0x02,0xd0,0x1c,0x00,
-0x76,0x20,0xc2,0x1b,0x1a,0x97,0xa7,0xc2,0x0c,0xa9,0x51,0x8a,0xd0,0x03,0xf6,0x00,
-0x3d,0x30,0x00,0x2a,0xee,0xa2,0x2c,0x00,0xf1,0x1e,0x03,0xdd,0x90,0x00,0x00,0x0d,
-0x20,0x86,0x02,0x00,0x0d,0x00,0x49,0xef,0xa0,0x09,0x84,0xc9,0xff,0xf0,0x00,0xde,
-0xeb,0xff,0xb0,0x09,0x55,0xff,0xff,0x70,0x0c,0x1f,0xff,0xff,0xe0,0x0e,0xdf,0xff,
-0xff,0xf0,0x00,0x01,0x22,0x22,0x10,0xff,0x00,0x10,0x0a,0x28,0x07,0xf0,0x0d,0xa5,
-0x00,0x9a,0xa9,0x9f,0x60,0x89,0x99,0x99,0x92,0x2e,0xff,0xff,0xfe,0x02,0xd6,0x44,
-0x44,0x00,0x2c,0x20,0x00,0x00,0x01,0x90,0x00,0x00,0x00,0xd3,0x00,0xf0,0x15,0x05,
-0x8a,0x50,0x00,0x00,0x8a,0x76,0x70,0x00,0x08,0x63,0x70,0x00,0x15,0x58,0x50,0x00,
-0x4d,0x21,0x7a,0x00,0x0e,0x88,0xf1,0xf5,0x00,0x9b,0x49,0x2f,0x20,0x00,0x89,0x79,
-0x30,0x00,0x00,0x46,0x08,0xf3,0x01,0xea,0x00,0xd0,0x09,0x6a,0x0d,0x00,0x69,0xc2,
-0xd0,0x00,0x0a,0x2d,0x00,0x00,0xa2,0x07,0x00,0x42,0xed,0xdd,0xde,0x10,0xa0,0x00,
-0x30,0x3a,0x89,0x00,0x88,0x0f,0x20,0xaa,0x30,0x5b,0x00,0xf1,0x0e,0xa0,0x09,0x24,
-0x8c,0xd3,0x90,0x08,0x18,0x66,0x00,0x91,0x08,0x00,0x9f,0x10,0x26,0x08,0x20,0x67,
-0x30,0x45,0x00,0x88,0x89,0x99,0x80,0x00,0x00,0x00,0x52,0x00,0xf5,0x0d,0xe2,0x40,
-0x00,0x00,0x01,0xf4,0xc0,0x00,0x7d,0x7d,0x8d,0x20,0x03,0xb0,0x2e,0x1c,0x20,0x08,
-0x40,0x06,0xf8,0x00,0x0b,0x00,0x00,0xe2,0x00,0x0c,0x05,0x00,0x01,0x01,0x00,0xf0,
-0x12,0x0a,0x80,0x55,0x91,0x1a,0x90,0x1d,0x20,0x2c,0x00,0x4c,0x05,0x90,0x0a,0xc8,
-0xb4,0x02,0xc0,0xca,0x00,0x58,0x02,0xd1,0x09,0x50,0x05,0xc0,0x4d,0xdc,0x40,0x00,
-0x02,0xd0,0xfe,0x03,0x01,0x03,0x00,0xf8,0x06,0x7d,0xdd,0xf8,0x4e,0x70,0x01,0xd0,
-0x00,0xb2,0x0b,0xc6,0x58,0x4a,0x95,0x0d,0xad,0xde,0xe3,0x00,0x06,0x80,0x03,0x00,
-0xa4,0x3d,0xdd,0xb0,0x00,0x00,0x96,0x2a,0x00,0x58,0x2b,0x03,0x00,0x11,0x2c,0x01,
-0x00,0x73,0x00,0x00,0xaa,0x50,0x09,0xc1,0x0d,0x10,0x05,0x31,0x2f,0xdd,0xc2,0x2f,
-0x08,0x15,0x2c,0x03,0x00,0xf6,0x11,0x3b,0x0a,0xc6,0x3b,0x00,0x1d,0x3b,0x00,0x0e,
-0x2b,0x00,0x0e,0x0e,0x10,0x6a,0x06,0xdd,0xb1,0x2c,0x2c,0x2c,0x01,0xad,0xda,0x00,
-0x00,0x96,0x00,0x05,0x80,0x00,0x58,0x05,0x00,0x50,0x8d,0xd9,0x00,0x00,0x96,0x54,
-0x08,0xf0,0x01,0x4a,0x00,0x09,0x68,0xdd,0x90,0x10,0x00,0x0a,0x30,0x00,0xa3,0x00,
-0x08,0xdd,0xd5,0xcf,0x07,0x90,0x3b,0x00,0x0b,0x50,0x1a,0x90,0x0e,0x60,0x00,0x9e,
-0x07,0x44,0xc4,0x2c,0x00,0x2d,0x68,0x08,0xf3,0x0b,0x0e,0x2f,0xdd,0xdf,0x69,0x8d,
-0xd4,0x00,0xcb,0x02,0xd0,0x0b,0x30,0x0e,0x00,0xe0,0x00,0xd1,0x4b,0x00,0x0d,0x18,
-0x70,0xbd,0xf1,0x2c,0x01,0x00,0x20,0x4d,0x90,0x15,0x00,0x00,0x02,0x00,0xf9,0x25,
-0x8d,0xf1,0x9f,0xdd,0xd4,0x02,0xb0,0x02,0xd0,0x5a,0x00,0x0f,0x04,0xa0,0x00,0xe0,
-0x1e,0x10,0x6a,0x00,0x6d,0xdb,0x10,0x4a,0x00,0xa4,0x0e,0x10,0xa3,0x08,0x60,0xc1,
-0x02,0xb2,0xc0,0x00,0xdd,0x30,0xbe,0xa3,0x00,0x5e,0xdd,0x90,0x59,0x00,0xb4,0x59,
-0x00,0x76,0x4d,0x90,0x3b,0x07,0xf1,0x12,0x4e,0xdd,0x90,0x49,0x00,0xa5,0x4d,0xa0,
-0x68,0x00,0x00,0x67,0x00,0x00,0xc4,0x3d,0xdd,0x70,0xa6,0x03,0xb1,0xd0,0x49,0x08,
-0x6a,0x50,0x6d,0x60,0x06,0x80,0x00,0x68,0x00,0x05,0x00,0xf0,0x04,0x98,0x02,0xc0,
-0x0c,0x44,0xa0,0x02,0xdc,0x40,0x00,0x5c,0x00,0x00,0x09,0x70,0x7d,0xdd,0xf0,0x5d,
-0x3c,0x01,0x20,0xa4,0x19,0xad,0x08,0x63,0xd1,0x2c,0x0a,0x70,0x2c,0xa8,0xf5,0x07,
-0x29,0xad,0xdb,0x06,0x01,0xf0,0x3a,0xa4,0x0c,0x22,0xc7,0x70,0xd0,0x4a,0x4a,0x3d,
-0x06,0x81,0xfb,0x30,0x96,0x0e,0x00,0x4e,0x10,0xbe,0xda,0x30,0x8f,0xdd,0xd5,0x00,
-0xb2,0x01,0xe0,0x0b,0x20,0x0c,0x10,0xb2,0x00,0xc1,0x0d,0x10,0x0c,0x19,0xa0,0x00,
-0xc1,0x6a,0x3d,0x09,0x46,0x70,0xb0,0xa1,0x00,0x04,0x14,0xf9,0x2e,0x70,0x02,0x00,
-0x00,0x1a,0xb5,0x00,0x00,0x09,0xe0,0x08,0xc8,0x10,0x15,0x00,0x00,0x1c,0xcc,0xb0,
-0x98,0x03,0xf3,0x21,0x9c,0x10,0x00,0x16,0xbf,0xff,0xf2,0x00,0x3f,0xff,0xff,0xff,
-0x20,0x05,0xff,0xd9,0x41,0xf2,0x00,0x5f,0x20,0x00,0x1f,0x20,0x05,0xe0,0x00,0x01,
-0xf2,0x00,0x5e,0x00,0x07,0x9f,0x20,0x48,0xe0,0x07,0xff,0xf2,0xaf,0xfe,0x00,0x2b,
-0xd8,0x07,0xff,0x90,0xef,0x04,0xf1,0x1b,0x00,0x00,0x41,0x88,0x88,0x88,0x14,0xeb,
-0xe7,0x77,0x7e,0xbe,0xa2,0xd0,0x00,0x0d,0x2a,0xeb,0xe3,0x33,0x3e,0xbe,0xb4,0xfb,
-0xbb,0xbf,0x4b,0xd9,0xd0,0x00,0x0d,0x9d,0xb5,0xd0,0x00,0x0d,0x5b,0xb7,0xff,0xff,
-0xff,0x7b,0x61,0x02,0xff,0x05,0xff,0xd6,0xff,0xff,0xff,0xff,0xe7,0xff,0xff,0xff,
-0x67,0x52,0x77,0x77,0x76,0xef,0xc6,0xff,0xff,0xfe,0x0f,0x00,0x01,0x51,0x78,0x63,
-0x88,0x88,0x87,0x5e,0x00,0xf1,0x12,0x00,0x00,0x00,0x06,0xfd,0x00,0x00,0x00,0x6f,
-0xf7,0x7c,0x10,0x06,0xff,0x70,0xdf,0xc1,0x6f,0xf7,0x00,0x1d,0xfe,0xff,0x70,0x00,
-0x01,0xdf,0xf7,0x00,0x00,0x00,0x1c,0x60,0x58,0x00,0xf3,0x3b,0x0c,0xd1,0x02,0xea,
-0xaf,0xd4,0xef,0x80,0xaf,0xff,0x80,0x02,0xff,0xf1,0x02,0xef,0xdf,0xd1,0xdf,0x80,
-0xaf,0xb6,0x70,0x00,0x85,0x00,0x00,0xa6,0x00,0x00,0x02,0xa0,0xea,0x29,0x00,0x0e,
-0xe1,0xea,0x5f,0xa0,0x7f,0x40,0xea,0x08,0xf3,0xbd,0x00,0xea,0x01,0xf7,0xcc,0x00,
-0xb7,0x00,0xf8,0xaf,0x00,0x00,0x04,0xf6,0x4f,0xa0,0x00,0x1d,0xf1,0x09,0xfd,0x89,
-0xef,0x50,0x00,0x6d,0xff,0xc4,0x7e,0x05,0xf9,0x22,0x01,0x88,0x10,0x00,0x00,0x05,
-0xff,0x40,0x00,0x1e,0xcf,0xff,0xfc,0xd0,0x7f,0xff,0xdd,0xff,0xf7,0x2d,0xfa,0x00,
-0xbf,0xd1,0x0b,0xf7,0x00,0x8f,0xa0,0x6f,0xfe,0x55,0xef,0xf6,0x4f,0xff,0xff,0xff,
-0xf3,0x06,0x3a,0xff,0xa3,0x60,0x00,0x03,0xff,0x30,0x00,0x01,0x00,0xf0,0x28,0x6f,
-0x90,0xf8,0x00,0x00,0x09,0xf8,0xec,0xf8,0x00,0x01,0xbe,0x5a,0x5c,0xf8,0x00,0x2d,
-0xd5,0xef,0xf6,0xaf,0x50,0xda,0x6f,0xff,0xff,0x87,0xf1,0x11,0xff,0xff,0xff,0xf5,
-0x10,0x02,0xff,0xc3,0x9f,0xf6,0x00,0x02,0xff,0xb0,0x7f,0xf6,0x00,0x01,0xbb,0x70,
-0x4b,0xb3,0x00,0x00,0x00,0x88,0x2d,0x04,0x27,0xff,0x60,0x05,0x00,0x90,0x01,0xff,
-0xff,0xff,0x60,0x00,0x5f,0xff,0xfa,0x8c,0x00,0xf2,0x02,0xb0,0x00,0x8b,0xb9,0x8b,
-0x8b,0xb9,0xdf,0xff,0xff,0xfe,0xdf,0xcf,0xff,0xff,0xfc,0xbe,0x6c,0x00,0xf0,0x15,
-0x24,0x44,0x44,0x30,0x00,0x01,0xef,0xff,0xff,0xf4,0x00,0x0b,0xc0,0x00,0x00,0x8e,
-0x10,0x6e,0x10,0x00,0x00,0x0c,0xa0,0xee,0xcb,0x10,0x0a,0xcd,0xf2,0xff,0xff,0xb8,
-0x9f,0xff,0xf4,0xff,0x01,0x00,0x20,0xf4,0xcf,0x06,0x00,0xf2,0x25,0xe1,0x00,0x04,
-0x87,0x30,0x5f,0x02,0xdf,0xfe,0xfc,0x7f,0x1e,0xd3,0x00,0x3c,0xff,0x9f,0x10,0x05,
-0xfe,0xff,0x44,0x00,0x02,0x66,0x66,0x12,0x22,0x00,0x00,0x11,0xff,0xff,0x50,0x00,
-0xda,0xff,0xa3,0x10,0x08,0xf4,0xfc,0xfb,0x66,0xbf,0x80,0xf5,0x4c,0xff,0xd5,0x00,
-0x31,0x68,0x00,0x63,0x70,0x00,0xbf,0xab,0xdf,0xff,0x01,0x00,0x50,0x00,0x3e,0xf0,
-0x00,0x2c,0x14,0x00,0xf0,0x05,0x00,0x0b,0xf0,0x00,0xab,0xdf,0xf0,0x20,0xff,0xff,
-0xf0,0xa6,0xff,0xff,0xf0,0x59,0xff,0xff,0xf0,0x92,0x1d,0x00,0x31,0x00,0x02,0xc0,
-0x36,0x00,0x11,0x40,0x3a,0x00,0x10,0xaa,0x28,0x00,0x90,0x0a,0x4a,0x70,0xab,0xdf,
-0xf0,0x23,0xe2,0xe0,0x2c,0x00,0x20,0x95,0xc2,0x2e,0x00,0x20,0x76,0xc3,0x30,0x00,
-0xe0,0xc3,0xe1,0x00,0x3e,0xf0,0x09,0xa6,0xb0,0x00,0x02,0xc0,0x03,0x3e,0x20,0x36,
-0x00,0x10,0xc3,0xd6,0x00,0x40,0x44,0x42,0xff,0xef,0x64,0x01,0xf0,0x09,0x0d,0xff,
-0xef,0xff,0xf8,0x4e,0xfe,0x25,0xff,0xff,0x9d,0xe2,0x00,0x6f,0xf9,0x01,0x20,0x00,
-0x4f,0xf7,0x44,0x44,0x44,0x7f,0xd0,0x00,0xf1,0x18,0xfc,0x00,0x1a,0x00,0x00,0x07,
-0xf5,0x00,0x00,0xef,0xc0,0x00,0x8f,0xff,0x60,0x3f,0xff,0xff,0x1b,0xff,0xff,0xf9,
-0xfb,0xff,0xff,0xdd,0x6e,0xff,0xfc,0x7e,0x59,0xff,0x60,0x9f,0xff,0x80,0x00,0x13,
-0x10,0x58,0x05,0xf0,0x3a,0x70,0x03,0xe4,0xe7,0x04,0xff,0x5e,0x75,0xff,0xf5,0xec,
-0xff,0xff,0x5e,0xff,0xff,0xf5,0xea,0xef,0xff,0x5e,0x71,0xdf,0xf5,0xe7,0x01,0xcf,
-0x59,0x50,0x00,0x92,0x88,0x00,0x00,0x00,0x0f,0xfe,0x50,0x00,0x00,0xff,0xff,0xc3,
-0x00,0x0f,0xff,0xff,0xf9,0x10,0xff,0xff,0xff,0xfe,0x5f,0xff,0xff,0xff,0xfa,0xff,
-0xff,0xff,0xf8,0x0f,0xff,0xff,0xb2,0x00,0xff,0xfd,0x40,0x00,0x0e,0xf7,0xef,0x06,
-0x04,0xea,0x01,0xef,0x0d,0xff,0x90,0xdf,0xf9,0xff,0xfc,0x0f,0xff,0xcf,0xff,0xc0,
-0xff,0xfc,0x09,0x00,0x00,0x82,0xfb,0x0f,0xff,0xb8,0xbb,0x50,0x8b,0xb5,0x2d,0x00,
-0x30,0xff,0xff,0xf9,0x3f,0x01,0x01,0xbb,0x00,0x0f,0x09,0x00,0x03,0x40,0xb8,0xbb,
-0xbb,0xbb,0x2d,0x00,0xf1,0x13,0x0b,0xa0,0x00,0xe7,0xcf,0xb0,0x0e,0x7c,0xff,0xc1,
-0xe7,0xcf,0xff,0xdf,0x7c,0xff,0xff,0xf7,0xcf,0xff,0x9e,0x7c,0xff,0x70,0xe7,0xcf,
-0x60,0x0e,0x77,0x50,0x00,0x95,0x00,0x00,0xae,0x16,0xe0,0xaf,0x60,0x00,0x00,0x09,
-0xff,0xf5,0x00,0x00,0x8f,0xff,0xff,0x40,0x06,0x2f,0x01,0x10,0x0e,0xb2,0x00,0x51,
-0x03,0x66,0x66,0x66,0x62,0x6f,0x00,0xa1,0x0f,0xff,0xff,0xff,0xfb,0x06,0x88,0x88,
-0x88,0x84,0xd7,0x02,0xf0,0x23,0xc7,0x00,0x1d,0xf5,0x01,0xdf,0x50,0x1d,0xf5,0x00,
-0x4f,0xd0,0x00,0x06,0xfc,0x00,0x00,0x6f,0xc0,0x00,0x06,0xf9,0x00,0x00,0x51,0x00,
-0x00,0x00,0x3e,0x30,0x00,0x2e,0xf3,0x00,0x02,0xef,0x30,0x00,0x2e,0xe3,0x00,0x09,
-0xf8,0x00,0x8f,0xa0,0x08,0xfa,0x00,0x5f,0x3b,0x0b,0x03,0x13,0x08,0xf0,0x02,0x8f,
-0x40,0x00,0x00,0x09,0xf5,0x00,0x00,0x00,0x9f,0x50,0x00,0x9b,0xbd,0xfc,0xbb,0x6f,
-0x5c,0x00,0x50,0x13,0x3a,0xf7,0x33,0x10,0x12,0x00,0x02,0x1b,0x00,0x80,0x39,0x10,
-0x00,0xbd,0xdd,0xdd,0xdd,0x8e,0x86,0x00,0x02,0x23,0x01,0xf1,0x21,0x04,0x8a,0x95,
-0x00,0x00,0x01,0xcf,0x84,0x6e,0xe3,0x00,0x1e,0xf5,0x08,0x72,0xff,0x40,0xbf,0xe0,
-0x2d,0xf5,0xbf,0xe0,0xdf,0xe3,0xff,0xf6,0xaf,0xf1,0x4f,0xf3,0xaf,0xd1,0xef,0x70,
-0x05,0xfd,0x31,0x2b,0xf7,0x00,0x00,0x19,0xdf,0xea,0x30,0x00,0xb6,0x35,0x00,0xf2,
-0x25,0x06,0xfa,0x16,0xaa,0x83,0x00,0x00,0x03,0xef,0xe6,0x49,0xfb,0x00,0x00,0x01,
-0xbe,0x49,0x28,0xfd,0x00,0x1d,0x40,0x8f,0xfe,0x1f,0xf9,0x04,0xff,0x50,0x5f,0xf1,
-0xff,0xb0,0x0a,0xfc,0x00,0x2d,0xdf,0xf2,0x00,0x0a,0xfa,0x10,0x1b,0xf7,0x00,0x00,
-0x04,0xbe,0xe4,0x08,0xf7,0x6e,0x00,0x00,0x85,0x00,0x02,0x94,0x08,0x21,0x02,0xe6,
-0x0b,0x00,0x20,0xbf,0xe1,0x06,0x00,0x11,0x4f,0xb3,0x04,0x90,0x0d,0xe7,0xcf,0x20,
-0x00,0x00,0x07,0xfc,0x08,0x55,0x00,0xf0,0x0b,0xef,0xd0,0x9f,0xf4,0x00,0x00,0x9f,
-0xff,0x5c,0xff,0xd0,0x00,0x2f,0xff,0xe1,0xaf,0xff,0x60,0x0b,0xff,0xfe,0x2b,0xff,
-0xfe,0x00,0xef,0x89,0x01,0x75,0xf2,0x01,0x33,0x33,0x33,0x33,0x32,0xd4,0x03,0xf0,
-0x16,0x07,0xc1,0xef,0xd1,0x03,0xef,0xfc,0x99,0xfb,0x2e,0xec,0xf8,0x00,0x54,0xde,
-0x25,0x70,0x00,0x0c,0xf4,0x01,0x10,0x00,0xbf,0x5c,0x78,0xd1,0xff,0xf6,0x0a,0xff,
-0xfd,0x78,0x60,0x00,0x7c,0xf6,0xe6,0x07,0x12,0x60,0x77,0x07,0x00,0x9a,0x01,0xf1,
-0x1f,0xaf,0xef,0x60,0x00,0xaf,0x90,0xcf,0x60,0x9f,0x80,0x00,0xcf,0x57,0x80,0x00,
-0x00,0xa4,0x11,0x00,0x00,0x02,0x0c,0xe2,0x00,0x05,0xf8,0x3f,0xe2,0x05,0xfd,0x10,
-0x3f,0xe7,0xfd,0x10,0x00,0x3f,0xfd,0x10,0x00,0x00,0x3b,0x10,0x00,0x00,0x80,0x67,
-0x00,0xf0,0x07,0xcf,0xc3,0xff,0xff,0xf5,0x00,0xbe,0xfe,0xb3,0x44,0x4e,0x60,0x04,
-0x3f,0x34,0x00,0x00,0xd6,0x00,0x02,0xf2,0x00,0x7c,0x10,0xf0,0x07,0x2f,0x20,0x00,
-0x8c,0xea,0xf1,0x01,0xff,0xff,0xf7,0xdf,0xf7,0x00,0x04,0x44,0x44,0x11,0xc7,0x00,
-0x58,0x88,0x20,0xb0,0x02,0x50,0xe4,0x44,0x41,0xff,0xff,0x3b,0x05,0x1e,0xff,0x01,
-0x00,0x02,0x26,0x03,0x20,0x00,0x33,0xd7,0x08,0x90,0xff,0x40,0x00,0x00,0x3f,0xff,
-0xf4,0x00,0x02,0xe4,0x05,0x92,0x00,0x36,0xff,0x63,0x00,0x00,0x04,0xff,0x40,0x05,
-0x00,0xb5,0x9a,0xa5,0xff,0x5a,0xa9,0xff,0xff,0xdd,0xfe,0xdf,0xff,0x5c,0x04,0x00,
-0x01,0x00,0x10,0xa8,0xc2,0x03,0x20,0x5f,0xff,0x64,0x05,0x20,0xff,0xe0,0xdb,0x04,
-0x11,0xfa,0xa6,0x00,0x10,0x50,0x16,0x00,0xb0,0xd0,0x00,0x39,0x10,0x4f,0xf4,0x00,
-0xbf,0xfc,0x9f,0xf6,0xdc,0x02,0xa4,0xe4,0x00,0x00,0x9f,0xfd,0x81,0x00,0x00,0x01,
-0x31,0x3d,0x00,0xf5,0x31,0x06,0xfe,0x30,0x05,0xc6,0xe7,0xbb,0x05,0xff,0x4d,0xbd,
-0xb4,0xff,0x40,0x3c,0xff,0xff,0x40,0x00,0x08,0xff,0xb0,0x00,0x6f,0xff,0xdf,0x80,
-0x0e,0x7b,0xb2,0xef,0x80,0xdb,0xd9,0x02,0xef,0x73,0xca,0x10,0x02,0x72,0x00,0x5d,
-0xdd,0x48,0x00,0x08,0xff,0xf6,0xf8,0xcc,0x8f,0xff,0x84,0x3f,0xe8,0xff,0xff,0xfc,
-0xfe,0x8f,0xff,0xff,0xcf,0x09,0x00,0x10,0xe7,0x1e,0x03,0x40,0x46,0x66,0x66,0x3f,
-0xe7,0x04,0xf1,0x0d,0x34,0x44,0x43,0x00,0x00,0x02,0x22,0x22,0x00,0x0e,0xff,0xff,
-0xfe,0x20,0xf5,0x22,0x22,0xfe,0x1f,0x40,0x00,0x0e,0xf8,0xf7,0x44,0x44,0xff,0x9f,
-0x62,0x03,0xf0,0x07,0xf6,0x0c,0xff,0x9f,0xff,0x20,0x9f,0xf9,0xff,0xfc,0x7f,0xff,
-0x9a,0xdd,0xdd,0xdd,0xd4,0x67,0x77,0x77,0x77,0x4e,0xad,0x02,0x01,0x95,0x00,0x40,
-0x77,0x77,0x77,0x74,0xe3,0x01,0x10,0xb0,0x0e,0x00,0x50,0x45,0x55,0x55,0x55,0x3f,
-0x1b,0x00,0x60,0x11,0x11,0x11,0x11,0x00,0x58,0x29,0x03,0x01,0x38,0x01,0x00,0xdc,
-0x02,0xf7,0x00,0xf6,0xc5,0xdf,0xff,0xfd,0x5c,0xfe,0x6a,0xff,0xa5,0xef,0xff,0xf9,
-0x55,0x9f,0x51,0x01,0xf0,0x06,0x03,0xaa,0xa2,0x00,0x07,0xff,0xf2,0x00,0x09,0xff,
-0xd0,0x00,0x0b,0xff,0xd8,0x81,0x0e,0xff,0xff,0xe1,0x0e,0xac,0x05,0xe1,0x05,0xfd,
-0x00,0x00,0x09,0xf4,0x00,0x00,0x0d,0xa0,0x00,0x00,0x0f,0x20,0xa5,0x03,0xf1,0x23,
-0x01,0x79,0x11,0x00,0x0f,0xfc,0x9f,0xf4,0x00,0xff,0xfd,0xcc,0x30,0x0f,0xfa,0x79,
-0x93,0x40,0xff,0x8e,0xff,0x6f,0x5f,0xf8,0xef,0xf7,0x64,0xff,0x8e,0xff,0xff,0xcf,
-0xf8,0xef,0xff,0xfc,0x46,0x3e,0xff,0xff,0xc0,0x00,0xdf,0xff,0xfc,0x00,0x02,0x44,
-0x44,0x20,0x33,0x0a,0x50,0x02,0xaf,0x81,0x00,0x02,0xe2,0x0b,0x80,0x9f,0xff,0xff,
-0x50,0x0c,0xff,0xff,0xf8,0x97,0x02,0x51,0xa0,0x3f,0xff,0xff,0xfe,0xd8,0x03,0x82,
-0x46,0x66,0x66,0x66,0x20,0x00,0xbf,0x70,0xe5,0x09,0x00,0x2f,0x05,0x21,0x44,0x30,
-0xa0,0x00,0xf3,0x0f,0xf3,0xf4,0xa0,0xa0,0xb0,0xb0,0xf4,0xff,0xbe,0xae,0xae,0xaf,
-0xf4,0xff,0x3a,0x0a,0x0a,0x0f,0xf4,0xfb,0xea,0xaa,0xaa,0xea,0xf4,0xf7,0xb4,0x44,
-0x44,0xc4,0x06,0x06,0x00,0xfa,0x00,0x20,0x29,0x70,0x4b,0x0a,0x00,0xd5,0x01,0xb0,
-0x4b,0xff,0xff,0x70,0x00,0x5d,0xff,0xff,0xff,0x10,0x0c,0x5b,0x00,0x60,0x00,0x0a,
-0xee,0xef,0xff,0xf2,0x0f,0x0a,0x21,0xff,0xa0,0x06,0x00,0x10,0x30,0x06,0x00,0x01,
-0x3c,0x01,0x22,0x08,0xf4,0x9b,0x0b,0xf0,0x03,0x00,0x00,0xef,0xff,0x5b,0x00,0xff,
-0xff,0x6f,0xb0,0xff,0xff,0x68,0x83,0xff,0xff,0xfd,0xd6,0x24,0x05,0x1e,0xff,0x04,
-0x00,0x02,0x95,0x03,0x02,0x2b,0x08,0xd0,0x05,0xbf,0xff,0xfd,0x81,0x00,0x2c,0xfe,
-0xa8,0x78,0xcf,0xf7,0x0d,0x19,0x00,0xf0,0x05,0x3c,0xf5,0x22,0x05,0xbe,0xfd,0x81,
-0x05,0x00,0x09,0xfe,0xa9,0xcf,0xe2,0x00,0x00,0x37,0x00,0x00,0x38,0x2e,0x00,0x11,
-0x8c,0x05,0x06,0x12,0x0f,0x3c,0x00,0x61,0x58,0x10,0x00,0x00,0xcf,0xff,0xcb,0x04,
-0xd0,0x75,0x55,0x55,0x55,0x5a,0xf2,0xf6,0xff,0xff,0xff,0xfd,0x4f,0x5f,0xa1,0x01,
-0x91,0xd1,0xf5,0xf5,0x77,0x77,0x77,0x76,0x8f,0x4f,0xfa,0x00,0x11,0xd0,0x06,0x01,
-0x17,0x41,0x2e,0x00,0x21,0x54,0x4a,0x2e,0x00,0x11,0x00,0x2e,0x00,0x21,0xf0,0x01,
-0x2e,0x00,0x1f,0x00,0x2e,0x00,0x05,0x21,0x54,0x44,0x2e,0x00,0x11,0x20,0x2e,0x00,
-0x21,0xf2,0x00,0x2e,0x00,0x1f,0x10,0x2e,0x00,0x05,0x21,0x54,0x44,0x2e,0x00,0x20,
-0x50,0x00,0x2e,0x00,0x21,0xf5,0x00,0x2e,0x00,0x2f,0x20,0x00,0x2e,0x00,0x02,0x40,
-0xfa,0x0f,0x74,0x44,0x2e,0x00,0x11,0xf4,0x87,0x04,0x30,0x5f,0x40,0x00,0x2e,0x00,
-0x01,0x0d,0x00,0x0a,0x2e,0x00,0x00,0x12,0x00,0x11,0x5b,0x7a,0x0d,0x11,0xbd,0x1e,
-0x00,0xf1,0x0d,0xa1,0x03,0x00,0x00,0x0a,0xf7,0x39,0x00,0x00,0x07,0x60,0xff,0xea,
-0xbf,0xaa,0xaa,0xdf,0x45,0xa3,0x00,0x93,0x00,0x04,0x10,0x00,0x00,0x01,0xb8,0x8d,
-0x01,0x44,0x02,0x9f,0xb0,0x00,0x9b,0x05,0xf2,0x1c,0x6b,0xca,0x40,0x00,0x9f,0xf6,
-0xff,0x40,0x1f,0xff,0x26,0xfb,0x04,0xf6,0xb4,0x6b,0xf0,0x6f,0xf4,0x06,0xff,0x06,
-0xff,0x90,0xbf,0xf0,0x5f,0x95,0x34,0xcf,0x02,0xfb,0xf3,0x4d,0xc0,0x0c,0xff,0x3d,
-0xf7,0x00,0x1b,0xfe,0xf9,0x32,0x00,0x50,0x12,0x3b,0xca,0x22,0x1f,0xf8,0x02,0x50,
-0x36,0x66,0x66,0x66,0x16,0xf0,0x04,0x8a,0x6f,0x6f,0x6f,0x7f,0x26,0xf6,0xf6,0xf7,
-0x09,0x00,0x91,0x24,0xff,0xff,0xff,0xf1,0x03,0x44,0x44,0x42,0x6b,0x00,0x20,0x97,
-0x00,0xfe,0x05,0x10,0xf8,0xed,0x0c,0xc0,0xef,0xe0,0x00,0x00,0xbf,0xe5,0xd4,0x00,
-0x00,0xbf,0xff,0xe0,0x05,0x00,0x13,0xf4,0x05,0x00,0x30,0xaf,0xff,0xf4,0xea,0x06,
-0x00,0xc3,0x00,0x01,0x05,0x00,0x21,0x02,0x20,0x3a,0x00,0x80,0x05,0x88,0x88,0x88,
-0x86,0x00,0x08,0xff,0x57,0x03,0xf0,0x13,0x08,0xff,0xf9,0x6f,0x69,0xff,0x88,0xff,
-0xff,0xc1,0x21,0xcf,0xf8,0xdf,0xff,0xff,0x50,0x5f,0xff,0x82,0xef,0xff,0x71,0x91,
-0x7f,0xf8,0x02,0xef,0xfe,0xdf,0xde,0xff,0x70,0x02,0x85,0x04,0xf0,0x02,0xe3,0x01,
-0xdf,0xff,0xe5,0x1d,0x6c,0x5a,0xab,0xdf,0x3b,0x18,0x8b,0xff,0xdf,0xde,0xeb,0xae,
-0x00,0x0c,0x04,0x00,0x44,0xbf,0xff,0xff,0xf6,0x6e,0x04,0xd0,0x0a,0x00,0x08,0x10,
-0x00,0x07,0xf0,0x0b,0xf2,0x00,0x00,0x8f,0x0b,0x69,0x00,0xa4,0xf0,0x7f,0xfa,0x99,
-0x99,0x99,0x00,0x6f,0x20,0x00,0x0b,0x0d,0x09,0x01,0x00,0x2f,0xfd,0x00,0x01,0x00,
-0x03,0x13,0xf8,0x08,0x00,0x17,0xf7,0x14,0x00,0x73,0xfc,0xfb,0x00,0xfe,0xfb,0x00,
-0xfa,0x5a,0x06,0x0c,0x01,0x00,0x4e,0x02,0x01,0x00,0x02,0x16,0x00,0x2f,0xf3,0x00,
-0x01,0x00,0x15,0x1f,0xef,0x1e,0x00,0x0a,0x03,0x88,0x00,0xc2,0xfb,0x00,0xff,0x00,
-0x00,0xf6,0xff,0xf9,0xfb,0x00,0xf9,0x00,0x4d,0x0b,0x00,0xfc,0x05,0x2d,0xfc,0xfd,
-0x92,0x00,0x6f,0xfe,0x00,0xfe,0x00,0x00,0xfc,0x4a,0x00,0x01,0x1c,0xfe,0x0a,0x00,
-0x19,0xff,0x1f,0x00,0x16,0xff,0x00,0x01,0x13,0xfe,0x48,0x00,0x3f,0xfe,0xfd,0xfe,
-0x9c,0x00,0x0a,0x15,0x02,0x3c,0x00,0x11,0xff,0x3f,0x00,0x26,0xff,0xfe,0x30,0x00,
-0x11,0xee,0x04,0x01,0x15,0xeb,0x24,0x00,0x00,0x4b,0x00,0x13,0xfe,0x04,0x00,0x08,
-0x01,0x00,0x13,0x01,0x70,0x00,0x1f,0x01,0x6b,0x00,0x08,0x1f,0xfe,0x43,0x01,0x0d,
-0x1b,0xfb,0x25,0x00,0x12,0xfe,0x67,0x00,0x31,0xfe,0xfd,0xfb,0x0f,0x00,0x14,0xe6,
-0x6c,0x00,0x97,0xfb,0x00,0x00,0xeb,0xfc,0xf2,0xf5,0x00,0xed,0x08,0x02,0x25,0xf6,
-0xf9,0x0c,0x00,0x75,0xe7,0x00,0x00,0x00,0xf5,0x00,0xf0,0x48,0x01,0x21,0xff,0xff,
-0x17,0x01,0x1f,0x01,0xf7,0x01,0x01,0x10,0xfd,0x63,0x00,0x1f,0xfd,0x97,0x00,0x0b,
-0x3e,0xfa,0x00,0xff,0x8c,0x01,0x03,0x7b,0x02,0xb1,0xef,0xee,0x00,0x00,0xfa,0xfe,
-0xed,0xff,0x01,0x00,0x01,0x60,0x00,0xd3,0xf7,0xf8,0x00,0xf7,0xf8,0xfa,0xf7,0x00,
-0xf9,0xfa,0xfc,0xfa,0xfb,0x5e,0x01,0x66,0xee,0xfd,0x00,0x00,0xfa,0xff,0x2b,0x01,
-0x50,0xfc,0xfd,0x00,0x00,0xfc,0x44,0x01,0x14,0xff,0x8b,0x02,0x42,0x01,0x00,0xf6,
-0xfb,0x51,0x00,0x13,0x01,0x24,0x00,0x04,0x68,0x01,0x27,0xff,0x00,0xaf,0x02,0x14,
-0xfc,0x20,0x01,0x15,0x01,0x51,0x01,0x27,0xfe,0x00,0x8c,0x01,0xf0,0x00,0xfe,0x02,
-0xfc,0xf0,0xfc,0x00,0x00,0xf9,0xfe,0xf9,0xff,0x01,0xf9,0x01,0x01,0x92,0x00,0x90,
-0xfa,0xfb,0xfe,0xfd,0xfb,0xfd,0xfb,0xfe,0xfd,0x4c,0x01,0x16,0x01,0xc5,0x00,0x09,
-0xa8,0x01,0x03,0x48,0x00,0x08,0xf8,0x01,0x06,0x9e,0x02,0x0f,0xab,0x01,0x07,0x0f,
-0x01,0x00,0x06,0x1f,0xff,0xf0,0x01,0x10,0x11,0xff,0x97,0x01,0x0e,0x5f,0x00,0x0f,
-0x4f,0x00,0x07,0x0f,0x1d,0x00,0x0a,0x1e,0x01,0xbd,0x03,0x19,0x01,0x81,0x00,0x16,
-0x01,0x14,0x04,0x0f,0x01,0x00,0x1e,0x0b,0xc9,0x00,0x1f,0xf5,0x90,0x00,0x0b,0x05,
-0xd7,0x01,0x1c,0xf6,0x31,0x02,0x11,0xff,0x93,0x00,0x10,0x04,0x2b,0x02,0x0f,0x6f,
-0x00,0x15,0x17,0x01,0xcc,0x04,0x06,0xa7,0x03,0x1d,0x01,0x14,0x01,0x1f,0xf6,0xd8,
-0x00,0x24,0x1f,0xfe,0x7d,0x01,0x10,0x1f,0xff,0x3d,0x00,0x1c,0x03,0x8c,0x01,0x30,
-0x02,0x03,0x00,0xed,0x00,0x2d,0x04,0x05,0x21,0x00,0xf1,0x0c,0x06,0x07,0x08,0x09,
-0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,
-0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,0x80,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,
-0x00,0x1f,0xa5,0x08,0xff,0x01,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,
-0x25,0x26,0x24,0x27,0x28,0x00,0x01,0x00,0x5e,0x02,0xce,0x00,0x20,0x03,0x02,0xc9,
-0x00,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x30,0x09,0x00,0x0a,0x87,0x13,0x00,0x04,
-0x00,0x21,0x0c,0x00,0x08,0x00,0xf1,0x08,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,
-0x13,0x14,0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,
-0x00,0xff,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,
-0x22,0x00,0x00,0x23,0x8f,0x00,0x1e,0x1f,0x24,0xc8,0x00,0x25,0x50,0x00,0x00,0x00,
-0x00,0x00,
+0xec,0x9f,0xec,0xf9,0xec,0x10,0xed,0x66,0xef,0xce,0xf1,0xae,0xf2,0x00,0x01,0x00,
+0x2f,0xfd,0x00,0x01,0x00,0x03,0x13,0xf8,0x08,0x00,0x17,0xf7,0x14,0x00,0xce,0xfc,
+0xfb,0x00,0xfe,0xfb,0x00,0xfa,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x4e,0x02,0x01,
+0x00,0x02,0x16,0x00,0x2f,0xf3,0x00,0x01,0x00,0x15,0x1f,0xef,0x1e,0x00,0x0a,0x03,
+0x88,0x00,0xb1,0xfb,0x00,0xff,0x00,0x00,0xf6,0xff,0xf9,0xfb,0x00,0xf9,0x11,0x00,
+0x00,0x0f,0x00,0x4d,0xff,0xff,0xfc,0xfd,0x92,0x00,0x6f,0xfe,0x00,0xfe,0x00,0x00,
+0xfc,0x4a,0x00,0x01,0x1c,0xfe,0x0a,0x00,0x19,0xff,0x1f,0x00,0x16,0xff,0x00,0x01,
+0x13,0xfe,0x48,0x00,0x3f,0xfe,0xfd,0xfe,0x9c,0x00,0x0a,0x15,0x02,0x3c,0x00,0x11,
+0xff,0x3f,0x00,0x26,0xff,0xfe,0x30,0x00,0x11,0xee,0x04,0x01,0x15,0xeb,0x24,0x00,
+0x00,0x4b,0x00,0x13,0xfe,0x04,0x00,0x08,0x01,0x00,0x13,0x01,0x70,0x00,0x1f,0x01,
+0x6b,0x00,0x08,0x1f,0xfe,0x43,0x01,0x0d,0x1b,0xfb,0x25,0x00,0x12,0xfe,0x67,0x00,
+0x31,0xfe,0xfd,0xfb,0x0f,0x00,0x14,0xe6,0x6c,0x00,0x97,0xfb,0x00,0x00,0xeb,0xfc,
+0xf2,0xf5,0x00,0xed,0x08,0x02,0x25,0xf6,0xf9,0x0c,0x00,0x75,0xe7,0x00,0x00,0x00,
+0xf5,0x00,0xf0,0x48,0x01,0x21,0xff,0xff,0x17,0x01,0x1f,0x01,0xf7,0x01,0x01,0x10,
+0xfd,0x63,0x00,0x1f,0xfd,0x97,0x00,0x0b,0x3e,0xfa,0x00,0xff,0x8c,0x01,0x03,0x7b,
+0x02,0xb1,0xef,0xee,0x00,0x00,0xfa,0xfe,0xed,0xff,0x01,0x00,0x01,0x60,0x00,0xd3,
+0xf7,0xf8,0x00,0xf7,0xf8,0xfa,0xf7,0x00,0xf9,0xfa,0xfc,0xfa,0xfb,0x5e,0x01,0x66,
+0xee,0xfd,0x00,0x00,0xfa,0xff,0x2b,0x01,0x50,0xfc,0xfd,0x00,0x00,0xfc,0x44,0x01,
+0x14,0xff,0x8b,0x02,0x42,0x01,0x00,0xf6,0xfb,0x51,0x00,0x13,0x01,0x24,0x00,0x04,
+0x68,0x01,0x27,0xff,0x00,0xaf,0x02,0x14,0xfc,0x20,0x01,0x15,0x01,0x51,0x01,0x27,
+0xfe,0x00,0x8c,0x01,0xf0,0x00,0xfe,0x02,0xfc,0xf0,0xfc,0x00,0x00,0xf9,0xfe,0xf9,
+0xff,0x01,0xf9,0x01,0x01,0x92,0x00,0x90,0xfa,0xfb,0xfe,0xfd,0xfb,0xfd,0xfb,0xfe,
+0xfd,0x4c,0x01,0x16,0x01,0xc5,0x00,0x09,0xa8,0x01,0x03,0x48,0x00,0x08,0xf8,0x01,
+0x06,0x9e,0x02,0x0f,0xab,0x01,0x07,0x0f,0x01,0x00,0x06,0x1f,0xff,0xf0,0x01,0x10,
+0x11,0xff,0x97,0x01,0x0e,0x5f,0x00,0x0f,0x4f,0x00,0x07,0x0f,0x1d,0x00,0x0a,0x1e,
+0x01,0xbd,0x03,0x19,0x01,0x81,0x00,0x16,0x01,0x14,0x04,0x0f,0x01,0x00,0x1e,0x0b,
+0xc9,0x00,0x1f,0xf5,0x90,0x00,0x0b,0x05,0xd7,0x01,0x1c,0xf6,0x31,0x02,0x11,0xff,
+0x93,0x00,0x10,0x04,0x2b,0x02,0x0f,0x6f,0x00,0x15,0x17,0x01,0xcc,0x04,0x06,0xa7,
+0x03,0x1d,0x01,0x14,0x01,0x1f,0xf6,0xd8,0x00,0x24,0x1f,0xfe,0x7d,0x01,0x10,0x1f,
+0xff,0x3d,0x00,0x1c,0x03,0x8c,0x01,0x30,0x02,0x03,0x00,0xed,0x00,0x2d,0x04,0x05,
+0x21,0x00,0xf1,0x0c,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,
+0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,
+0x00,0xff,0x0d,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,
+0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x00,0x01,
+0x00,0x5e,0x02,0xce,0x00,0x20,0x03,0x02,0xc9,0x00,0x4b,0x06,0x07,0x06,0x08,0x1f,
+0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,
+0xf1,0x08,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x00,
+0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,
+0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x8f,0x00,
+0x1e,0x1f,0x24,0xc8,0x00,0x25,0x50,0x00,0x00,0x00,0x00,0x00,0xf0,0x1a,0x2c,0x2b,
+0x2b,0x2b,0x2b,0x17,0x00,0x2b,0x55,0xa5,0x59,0x32,0x60,0x00,0x55,0x55,0x00,0x08,
+0x29,0x20,0x0c,0xec,0xec,0x00,0x0b,0x0b,0x00,0x00,0xa0,0xa0,0x05,0xce,0xcd,0x80,
+0x05,0x56,0x50,0x00,0x82,0x92,0x00,0x01,0x00,0xf0,0x85,0x74,0x00,0x05,0xdc,0x30,
+0x1d,0x14,0xd0,0x2c,0x00,0x80,0x0b,0xa3,0x00,0x00,0x5c,0x70,0x23,0x00,0xd0,0x4b,
+0x01,0xe0,0x09,0xed,0x50,0x00,0x83,0x00,0x1b,0xb1,0x00,0x07,0x45,0x63,0x70,0x64,
+0x55,0xa0,0x01,0xa9,0x65,0x00,0x00,0x0a,0x6a,0x40,0x08,0x3b,0x0b,0x01,0x90,0xb0,
+0xb0,0x00,0x08,0xa6,0x05,0xdc,0x10,0x00,0xd1,0x67,0x00,0x0c,0x3a,0x40,0x00,0x5f,
+0x70,0x00,0x1d,0xa9,0x07,0x07,0x80,0xc8,0x90,0x59,0x02,0xf4,0x00,0x9b,0xc9,0xc0,
+0x73,0x73,0x41,0x00,0x71,0x04,0x90,0x0b,0x10,0x1c,0x00,0x4a,0x00,0x59,0x00,0x49,
+0x00,0x2b,0x00,0x0d,0x00,0x09,0x40,0x01,0xb0,0x00,0x21,0x81,0x03,0xa0,0x0b,0x20,
+0x67,0x04,0xa0,0x2b,0x03,0xb0,0x49,0x08,0x50,0xc0,0x76,0x03,0x00,0x03,0x80,0x07,
+0x69,0x80,0x3b,0xe5,0x01,0xca,0x30,0x13,0x13,0x00,0x00,0x83,0x00,0x00,0xa4,0x03,
+0x00,0x32,0x9f,0xff,0xf3,0x09,0x00,0xf6,0x28,0x67,0x85,0x70,0xad,0x70,0x01,0x3b,
+0x00,0x1a,0x00,0x74,0x00,0xb0,0x02,0x90,0x08,0x40,0x0c,0x00,0x38,0x00,0x83,0x00,
+0x60,0x00,0x08,0xdc,0x30,0x2c,0x03,0xc0,0x58,0x00,0xe0,0x67,0x00,0xd0,0x67,0x00,
+0xd0,0x58,0x00,0xe0,0x2c,0x03,0xb0,0x07,0xdc,0x30,0x03,0x98,0x2b,0x99,0x00,0x59,
+0x02,0x00,0xf0,0x6e,0x09,0xdd,0x30,0x5a,0x03,0xc0,0x32,0x01,0xd0,0x00,0x07,0x80,
+0x00,0x3c,0x00,0x01,0xd2,0x00,0x0b,0x40,0x00,0x6f,0xdd,0xd3,0x0a,0xdd,0x35,0x80,
+0x2c,0x00,0x04,0xb0,0x1d,0xf2,0x00,0x04,0xb2,0x20,0x0e,0x5a,0x03,0xc0,0xad,0xc2,
+0x00,0x0d,0x60,0x00,0x7e,0x60,0x01,0xc8,0x60,0x0a,0x38,0x60,0x4a,0x08,0x60,0xad,
+0xde,0xe5,0x00,0x08,0x60,0x00,0x08,0x60,0x0a,0xff,0xf0,0x0c,0x10,0x00,0x0d,0x00,
+0x00,0x0e,0xdd,0x50,0x04,0x02,0xe0,0x00,0x00,0xb2,0x1c,0x00,0xd1,0x06,0xdd,0x60,
+0x01,0xae,0x10,0x0b,0x80,0x00,0x1d,0x00,0x00,0x4c,0xcd,0x40,0x5d,0x12,0xe0,0x49,
+0x00,0xc1,0x1d,0x01,0xd0,0x05,0xdd,0x40,0x8d,0xdd,0xf2,0x00,0x01,0xc0,0x00,0x07,
+0x60,0x34,0x00,0x70,0x49,0x00,0x00,0xb3,0x00,0x01,0xd0,0x4a,0x00,0xf0,0x5b,0x09,
+0xdd,0x40,0x3c,0x02,0xd0,0x2c,0x03,0xc0,0x09,0xef,0x30,0x3c,0x03,0xc0,0x67,0x00,
+0xd0,0x4b,0x02,0xd0,0x08,0xdd,0x40,0x09,0xdc,0x15,0xa0,0x5a,0x76,0x00,0xd4,0xb0,
+0x4f,0x08,0xd8,0xe0,0x00,0x3c,0x00,0x0b,0x60,0x7e,0x70,0x3a,0x01,0x00,0x00,0x01,
+0x3a,0x58,0x01,0x00,0x00,0x12,0x58,0x84,0x30,0x00,0x18,0x40,0x8d,0x70,0x9c,0x10,
+0x00,0x7d,0x81,0x00,0x08,0x40,0x3e,0xee,0xb0,0x00,0x00,0x3e,0xee,0xb0,0x49,0x10,
+0x00,0x6d,0x91,0x00,0x0a,0xc1,0x7d,0x81,0x48,0x10,0x00,0x1c,0xea,0x08,0x60,0xb3,
+0x00,0x0a,0x30,0x04,0xc0,0x00,0xd1,0x00,0x27,0xdc,0x01,0xf0,0x7c,0x3a,0x00,0x00,
+0x3b,0xbb,0x80,0x00,0x3a,0x00,0x04,0x90,0x0b,0x02,0xba,0x18,0x22,0x80,0xb1,0x92,
+0x35,0x55,0x1a,0x0a,0x12,0x76,0x44,0x80,0xb0,0x36,0x56,0x38,0x0d,0x07,0x31,0xa0,
+0xb9,0x7a,0x80,0x09,0x50,0x00,0x00,0x00,0x07,0xba,0xa0,0x00,0x00,0x5d,0x00,0x00,
+0x0a,0xd2,0x00,0x00,0xd5,0x80,0x00,0x59,0x0d,0x00,0x0a,0x30,0xb3,0x00,0xfd,0xde,
+0x80,0x59,0x00,0x1d,0x0b,0x40,0x00,0xb3,0x2f,0xdd,0xb0,0x2c,0x00,0x96,0x2c,0x00,
+0xa5,0x2f,0xde,0xc0,0x2c,0x00,0x97,0x2c,0x00,0x5a,0x2c,0x00,0x97,0x2f,0xdd,0xa0,
+0x03,0xcd,0xb2,0x00,0xd3,0x05,0xb0,0x4a,0x00,0x09,0x06,0x80,0x00,0x00,0x68,0x00,
+0x00,0x04,0xa0,0x00,0x80,0x0d,0x30,0x5b,0x00,0x3c,0xdb,0x10,0x2f,0xed,0x70,0x2c,
+0x00,0xb6,0x2c,0x00,0x2c,0x2c,0x00,0x0e,0x03,0x00,0x00,0x09,0x00,0xd1,0xb6,0x2f,
+0xde,0x70,0x2f,0xdd,0xd4,0x2c,0x00,0x00,0x2c,0x00,0x00,0x55,0x00,0x14,0x00,0x0c,
+0x00,0x47,0xd4,0x2f,0xdd,0xd3,0x0f,0x00,0x15,0xa0,0x0c,0x00,0xa1,0x03,0xcd,0xc2,
+0x00,0xd3,0x04,0xc0,0x4b,0x00,0x06,0x64,0x00,0xf0,0x05,0x06,0xde,0x14,0xb0,0x00,
+0xd1,0x0d,0x40,0x1e,0x10,0x2c,0xed,0x60,0x2c,0x00,0x0a,0x42,0xc0,0x00,0xa4,0x07,
+0x00,0x36,0xfd,0xdd,0xf4,0x0e,0x00,0x00,0x07,0x00,0x13,0x1d,0x01,0x00,0x53,0x00,
+0x03,0xc0,0x00,0x3c,0x05,0x00,0xf5,0x15,0xc3,0x00,0x3b,0x96,0x07,0x91,0xcd,0xb1,
+0x2c,0x00,0x7a,0x02,0xc0,0x4d,0x00,0x2c,0x2d,0x20,0x02,0xcd,0x60,0x00,0x2f,0xad,
+0x00,0x02,0xc0,0x89,0x00,0x2c,0x00,0xd4,0x02,0xc0,0x03,0xd0,0x79,0x00,0x08,0x03,
+0x00,0xf1,0x52,0x2f,0xdd,0xd1,0x2f,0x30,0x00,0x7e,0x2f,0x90,0x00,0xde,0x2b,0xd0,
+0x03,0xbe,0x2b,0x94,0x09,0x5e,0x2c,0x4a,0x0d,0x0e,0x2c,0x0d,0x59,0x0e,0x2c,0x08,
+0xe4,0x0e,0x2c,0x02,0xe0,0x0e,0x2f,0x10,0x0a,0x42,0xfa,0x00,0xa4,0x2c,0xd3,0x0a,
+0x42,0xc4,0xc0,0xa4,0x2c,0x0b,0x6a,0x42,0xc0,0x2e,0xb4,0x2c,0x00,0x8f,0x42,0xc0,
+0x00,0xe4,0x02,0xce,0xb1,0x00,0xd4,0x05,0xc0,0x4b,0x00,0x0d,0x26,0x80,0x00,0xa4,
+0x68,0x00,0x0a,0x44,0xb0,0x00,0xd2,0x0d,0x40,0x5c,0x00,0x2c,0xeb,0x10,0x2f,0xed,
+0xc2,0x2c,0x00,0x5b,0x22,0x01,0x46,0x5b,0x2f,0xdd,0xb2,0xf8,0x00,0xf1,0x16,0xce,
+0xb1,0x00,0xd3,0x06,0xb0,0x4a,0x00,0x0d,0x17,0x70,0x00,0xb3,0x77,0x00,0x0b,0x35,
+0xa0,0x00,0xd1,0x0d,0x30,0x6b,0x00,0x3c,0xef,0x40,0x00,0x00,0x4d,0x10,0x00,0x00,
+0x00,0x2f,0xee,0xa0,0x8e,0x01,0xfe,0x1f,0x4a,0x2c,0x00,0xa7,0x2f,0xde,0xa0,0x2c,
+0x04,0xb0,0x2c,0x00,0xc3,0x2c,0x00,0x4b,0x07,0xdd,0x80,0x3c,0x00,0xb5,0x5b,0x00,
+0x22,0x0b,0xb5,0x00,0x00,0x3a,0xd1,0x32,0x00,0x87,0x6a,0x00,0x96,0x08,0xdd,0xa0,
+0xad,0xee,0xda,0x00,0x77,0x00,0x03,0x00,0x38,0x59,0x00,0x1d,0x03,0x00,0xf0,0x45,
+0x4a,0x00,0x2c,0x1d,0x10,0x79,0x05,0xde,0xa1,0xb4,0x00,0x0e,0x15,0x90,0x04,0xb0,
+0x1e,0x00,0x96,0x00,0xb3,0x0d,0x10,0x06,0x83,0xb0,0x00,0x1d,0x86,0x00,0x00,0xbe,
+0x10,0x00,0x06,0xc0,0x00,0x95,0x00,0xf0,0x06,0x86,0x80,0x4f,0x40,0x95,0x2b,0x08,
+0x98,0x0c,0x10,0xe0,0xc1,0xb0,0xd0,0x0b,0x3c,0x0c,0x3a,0x00,0x89,0x80,0x89,0x70,
+0x04,0xf4,0x04,0xf4,0x00,0x1f,0x00,0x0f,0x00,0x6b,0x00,0x7a,0x0d,0x41,0xe2,0x04,
+0xd9,0x80,0x00,0xbe,0x37,0x00,0xf6,0x08,0x04,0xc8,0x90,0x0d,0x30,0xe2,0x6a,0x00,
+0x6b,0xa5,0x00,0x6a,0x3d,0x00,0xd2,0x0b,0x45,0xb0,0x03,0xcc,0x30,0x00,0xbb,0x88,
+0x00,0xf6,0x0e,0x7d,0xdd,0xf6,0x00,0x01,0xe1,0x00,0x0b,0x50,0x00,0x4c,0x00,0x00,
+0xd2,0x00,0x08,0x80,0x00,0x2d,0x00,0x00,0x9f,0xdd,0xd8,0x4d,0x74,0xa0,0x4a,0x04,
+0x03,0x00,0x60,0x4e,0x70,0xa3,0x00,0x04,0x90,0x5c,0x03,0x40,0x94,0x00,0x03,0xa0,
+0x08,0x00,0x94,0x85,0x00,0x02,0xa0,0x00,0x06,0x00,0xcc,0x0e,0x01,0x00,0xf4,0x63,
+0xcc,0x06,0x90,0x0c,0xc0,0x2a,0x84,0x85,0x2a,0xdd,0xdd,0x60,0x44,0x00,0xc1,0x09,
+0xdc,0x22,0x60,0x4a,0x07,0xbc,0xb5,0xa0,0x3b,0x69,0x07,0xb0,0xcd,0x9b,0x59,0x00,
+0x00,0x59,0x00,0x00,0x5c,0xcd,0x40,0x5c,0x02,0xd0,0x59,0x00,0xc1,0x59,0x00,0xc1,
+0x5c,0x02,0xd0,0x5b,0xce,0x40,0x08,0xdc,0x34,0xb0,0x2c,0x86,0x00,0x17,0x60,0x00,
+0x4b,0x02,0xb0,0x8d,0xc2,0x00,0x00,0xe0,0x00,0x0e,0x09,0xda,0xe4,0xb0,0x2e,0x76,
+0x00,0xe7,0x60,0x0e,0x4b,0x02,0xe0,0x9c,0xae,0x07,0xdc,0x33,0xa0,0x2c,0x7e,0xdd,
+0xd7,0x70,0x00,0x4c,0x01,0x60,0x8d,0xd4,0x03,0xd6,0x0c,0x30,0x0d,0x00,0x8f,0xc1,
+0x0e,0x00,0x02,0x00,0x43,0x09,0xda,0xe4,0xc0,0x30,0x00,0xf1,0x09,0x03,0xe0,0x9e,
+0xae,0x03,0x03,0xc0,0x9d,0xc3,0x59,0x00,0x05,0x90,0x00,0x5b,0xbe,0x45,0xc0,0x3c,
+0x59,0x01,0xd5,0x90,0x1d,0x05,0x00,0x31,0x3a,0x00,0x3a,0x01,0x00,0x62,0x04,0x90,
+0x00,0x04,0x90,0x49,0x03,0x00,0x32,0x05,0x94,0xe4,0x9b,0x00,0xf3,0x04,0x59,0x0b,
+0x60,0x59,0x89,0x00,0x5d,0xe0,0x00,0x5d,0xb6,0x00,0x59,0x1d,0x10,0x59,0x05,0xb0,
+0x3a,0x01,0x00,0xf5,0x03,0x5b,0xcd,0x5b,0xe8,0x05,0xb0,0x3f,0x10,0xe0,0x59,0x01,
+0xd0,0x0d,0x15,0x90,0x1d,0x00,0xd1,0x09,0x00,0x0b,0x61,0x00,0xf6,0x08,0x07,0xdd,
+0x40,0x4c,0x02,0xd0,0x86,0x00,0xb2,0x76,0x00,0xb3,0x3c,0x01,0xe0,0x07,0xdd,0x40,
+0x5c,0xbd,0x40,0x5b,0x01,0xf1,0x00,0x32,0x5c,0xcd,0x40,0x6e,0x00,0x36,0x09,0xda,
+0xd4,0xe3,0x00,0x21,0x9d,0xae,0xf7,0x00,0x55,0x00,0x00,0x5c,0xd3,0x5c,0x46,0x05,
+0xf6,0x0c,0x0a,0xdc,0x14,0xa0,0x56,0x1d,0x82,0x00,0x05,0xc5,0x67,0x05,0x90,0xad,
+0xc2,0x07,0x00,0xe0,0xbf,0xa0,0xe0,0x0e,0x00,0xe0,0x0e,0x00,0xac,0x71,0x00,0xf4,
+0x66,0x3b,0x04,0xd0,0xbd,0xad,0xb3,0x06,0x75,0x80,0xb2,0x1c,0x0d,0x00,0xb6,0x80,
+0x06,0xe3,0x00,0x1e,0x00,0xa3,0x0c,0x30,0xb2,0x67,0x0e,0x80,0xd0,0x2b,0x47,0xc3,
+0xa0,0x0d,0x92,0xb8,0x60,0x0a,0xd0,0x6f,0x20,0x06,0x90,0x2e,0x00,0x79,0x0a,0x60,
+0xd5,0xc0,0x04,0xf3,0x00,0x5f,0x40,0x0d,0x3d,0x08,0x80,0x97,0xb3,0x08,0x76,0x80,
+0xc2,0x1d,0x1c,0x00,0xb7,0x70,0x06,0xf2,0x00,0x1d,0x00,0x06,0x70,0x08,0xd1,0x00,
+0x7d,0xdf,0x70,0x02,0xd0,0x00,0xb4,0x00,0x6a,0x00,0x1d,0x10,0x08,0xed,0xd8,0x00,
+0x82,0x06,0x80,0x0a,0x40,0x0a,0x30,0x0c,0x10,0xaa,0x00,0x0c,0x10,0x0a,0x30,0x0a,
+0x40,0x06,0x80,0x00,0x82,0x29,0x01,0x00,0xf5,0x6f,0x14,0x82,0x00,0x2c,0x00,0x0e,
+0x00,0x0d,0x00,0x0b,0x30,0x04,0xf0,0x0b,0x20,0x0d,0x00,0x0e,0x00,0x2c,0x00,0x82,
+0x00,0x0b,0xd6,0x0b,0x13,0x70,0x9e,0x80,0x00,0x00,0xa3,0x00,0x00,0x00,0x0d,0xd3,
+0x00,0xed,0xdd,0xc2,0xd3,0x0d,0x00,0x00,0x02,0xd2,0xd0,0x00,0x00,0x4c,0x1c,0xdd,
+0xde,0x3d,0x10,0x00,0x00,0xdd,0x10,0x00,0x00,0x08,0x20,0x00,0x00,0x02,0xb0,0x00,
+0x00,0x02,0xde,0x00,0x00,0x02,0xd3,0xad,0xdd,0xe2,0xd3,0x00,0x00,0x0d,0x1d,0x50,
+0x00,0x00,0xd0,0x1c,0x5c,0xdd,0xdc,0x00,0x1c,0xf0,0x00,0x00,0x00,0x19,0x00,0x00,
+0x00,0x01,0x10,0x00,0x00,0x2d,0xd2,0x00,0x02,0xd3,0x3d,0x20,0x2d,0x30,0x03,0xd2,
+0x8d,0xe0,0x0e,0xd8,0x00,0xd0,0x0d,0x00,0x04,0x00,0xb8,0xdd,0xdd,0x00,0x00,0x11,
+0x11,0x00,0x00,0xdb,0xbd,0x00,0x18,0x00,0xf2,0x01,0xaf,0xc0,0x0c,0xfa,0x1c,0x50,
+0x05,0xc1,0x01,0xc5,0x5c,0x10,0x00,0x1c,0xc1,0x00,0x01,0x00,0x40,0x22,0x00,0x00,
+0x00,0xff,0x02,0xf1,0x0f,0x00,0x03,0xee,0x30,0x00,0x00,0x0c,0x77,0xb0,0x00,0x00,
+0x4e,0x00,0xe4,0x00,0x00,0xc5,0x00,0x6c,0x00,0x05,0xe2,0x22,0x2e,0x50,0x0d,0xff,
+0xff,0xff,0xd0,0x2b,0x00,0xf1,0x10,0x01,0x4d,0xd3,0x05,0xd8,0xc3,0x4b,0x3d,0x10,
+0xff,0xf5,0xa5,0x02,0xfe,0x78,0xb2,0x05,0x90,0x2b,0x96,0x00,0x00,0x69,0x2d,0x30,
+0x03,0xd1,0x03,0xcd,0xdc,0x30,0x98,0x00,0xf0,0x1f,0x08,0xcc,0x61,0x00,0x01,0xd3,
+0xee,0x3d,0x10,0x0b,0x70,0x44,0x07,0xb0,0x1a,0x20,0x00,0x01,0xc1,0x1a,0x10,0x00,
+0x01,0xb1,0x0b,0x50,0x00,0x05,0x90,0x04,0xc5,0x00,0x5a,0x60,0x00,0x4a,0xec,0x95,
+0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x10,0x77,0x00,0xf0,0x17,0xeb,0xcd,0x91,0x00,
+0x1e,0x29,0xb1,0x4d,0x30,0x0c,0x90,0xb7,0x02,0xc0,0x0d,0x9c,0xc1,0x00,0xc2,0x0d,
+0x05,0x10,0x00,0xb3,0x0a,0x50,0x00,0x01,0xd0,0x02,0xd3,0x00,0x1b,0x50,0x00,0x2b,
+0xdd,0xd5,0x7f,0x00,0x10,0x00,0xd7,0x00,0xf2,0x11,0x10,0x00,0xef,0xff,0xf4,0x03,
+0xe0,0x00,0xd0,0x07,0x90,0x08,0x70,0x06,0xc0,0x97,0x00,0x4c,0xc5,0xd0,0x00,0x94,
+0x97,0xb2,0x00,0x77,0x00,0xd0,0x00,0x0b,0xcd,0x50,0x56,0x00,0xf0,0x10,0x04,0x43,
+0x00,0x00,0x0f,0xfc,0x00,0x1c,0x98,0x88,0x88,0x18,0x02,0x22,0x09,0x18,0x3b,0xba,
+0x09,0x08,0x15,0x54,0x09,0x08,0x27,0x76,0x09,0x0c,0x99,0x99,0x88,0x1c,0x00,0x31,
+0x00,0x02,0x21,0xd6,0x00,0xf2,0x39,0x20,0x04,0xcf,0xf8,0xb8,0x6f,0x71,0x32,0x91,
+0xb9,0x00,0x00,0x90,0x05,0xa0,0x00,0x90,0x09,0x50,0x00,0x92,0xd4,0x00,0x00,0xb9,
+0x9d,0x30,0x00,0x30,0x08,0xfe,0xfa,0x00,0x00,0x13,0x30,0x14,0x44,0x44,0x41,0x85,
+0xf8,0x44,0x58,0x90,0x62,0x7e,0xf8,0x91,0xf6,0x4d,0xf8,0x90,0x62,0x00,0x08,0x91,
+0xf6,0x00,0x08,0x90,0x83,0x00,0x08,0x90,0xe6,0x00,0x08,0x89,0xfc,0x99,0x98,0x4f,
+0x01,0xf2,0x17,0x3b,0xee,0xb2,0x00,0x04,0xd3,0x99,0x3d,0x40,0x0d,0x20,0x99,0x02,
+0xd0,0x1c,0x00,0x76,0x20,0xc2,0x1b,0x1a,0x97,0xa7,0xc2,0x0c,0xa9,0x51,0x8a,0xd0,
+0x03,0xf6,0x00,0x3d,0x30,0x00,0x2a,0xee,0xa2,0x2c,0x00,0xf1,0x1e,0x03,0xdd,0x90,
+0x00,0x00,0x0d,0x20,0x86,0x02,0x00,0x0d,0x00,0x49,0xef,0xa0,0x09,0x84,0xc9,0xff,
+0xf0,0x00,0xde,0xeb,0xff,0xb0,0x09,0x55,0xff,0xff,0x70,0x0c,0x1f,0xff,0xff,0xe0,
+0x0e,0xdf,0xff,0xff,0xf0,0x00,0x01,0x22,0x22,0x10,0xff,0x00,0x10,0x0a,0x28,0x07,
+0xf0,0x0d,0xa5,0x00,0x9a,0xa9,0x9f,0x60,0x89,0x99,0x99,0x92,0x2e,0xff,0xff,0xfe,
+0x02,0xd6,0x44,0x44,0x00,0x2c,0x20,0x00,0x00,0x01,0x90,0x00,0x00,0x00,0xd3,0x00,
+0xf0,0x15,0x05,0x8a,0x50,0x00,0x00,0x8a,0x76,0x70,0x00,0x08,0x63,0x70,0x00,0x15,
+0x58,0x50,0x00,0x4d,0x21,0x7a,0x00,0x0e,0x88,0xf1,0xf5,0x00,0x9b,0x49,0x2f,0x20,
+0x00,0x89,0x79,0x30,0x00,0x00,0x46,0x08,0xf3,0x01,0xea,0x00,0xd0,0x09,0x6a,0x0d,
+0x00,0x69,0xc2,0xd0,0x00,0x0a,0x2d,0x00,0x00,0xa2,0x07,0x00,0x42,0xed,0xdd,0xde,
+0x10,0xa0,0x00,0x90,0x3a,0x89,0x00,0x00,0x00,0xa0,0x02,0xaa,0x30,0x5b,0x00,0xf1,
+0x0e,0xa0,0x09,0x24,0x8c,0xd3,0x90,0x08,0x18,0x66,0x00,0x91,0x08,0x00,0x9f,0x10,
+0x26,0x08,0x20,0x67,0x30,0x45,0x00,0x88,0x89,0x99,0x80,0x00,0x00,0x00,0x52,0x00,
+0xf5,0x0d,0xe2,0x40,0x00,0x00,0x01,0xf4,0xc0,0x00,0x7d,0x7d,0x8d,0x20,0x03,0xb0,
+0x2e,0x1c,0x20,0x08,0x40,0x06,0xf8,0x00,0x0b,0x00,0x00,0xe2,0x00,0x0c,0x05,0x00,
+0x01,0x01,0x00,0xf0,0x12,0x0a,0x80,0x55,0x91,0x1a,0x90,0x1d,0x20,0x2c,0x00,0x4c,
+0x05,0x90,0x0a,0xc8,0xb4,0x02,0xc0,0xca,0x00,0x58,0x02,0xd1,0x09,0x50,0x05,0xc0,
+0x4d,0xdc,0x40,0x00,0x02,0xd0,0xfe,0x03,0x01,0x03,0x00,0xf8,0x06,0x7d,0xdd,0xf8,
+0x4e,0x70,0x01,0xd0,0x00,0xb2,0x0b,0xc6,0x58,0x4a,0x95,0x0d,0xad,0xde,0xe3,0x00,
+0x06,0x80,0x03,0x00,0xa4,0x3d,0xdd,0xb0,0x00,0x00,0x96,0x2a,0x00,0x58,0x2b,0x03,
+0x00,0x11,0x2c,0x01,0x00,0x73,0x00,0x00,0xaa,0x50,0x09,0xc1,0x0d,0x10,0x05,0x31,
+0x2f,0xdd,0xc2,0x2f,0x08,0x15,0x2c,0x03,0x00,0xf6,0x11,0x3b,0x0a,0xc6,0x3b,0x00,
+0x1d,0x3b,0x00,0x0e,0x2b,0x00,0x0e,0x0e,0x10,0x6a,0x06,0xdd,0xb1,0x2c,0x2c,0x2c,
+0x01,0xad,0xda,0x00,0x00,0x96,0x00,0x05,0x80,0x00,0x58,0x05,0x00,0x50,0x8d,0xd9,
+0x00,0x00,0x96,0x54,0x08,0xf0,0x01,0x4a,0x00,0x09,0x68,0xdd,0x90,0x10,0x00,0x0a,
+0x30,0x00,0xa3,0x00,0x08,0xdd,0xd5,0xcf,0x07,0x90,0x3b,0x00,0x0b,0x50,0x1a,0x90,
+0x0e,0x60,0x00,0x9e,0x07,0x44,0xc4,0x2c,0x00,0x2d,0x68,0x08,0xf3,0x0b,0x0e,0x2f,
+0xdd,0xdf,0x69,0x8d,0xd4,0x00,0xcb,0x02,0xd0,0x0b,0x30,0x0e,0x00,0xe0,0x00,0xd1,
+0x4b,0x00,0x0d,0x18,0x70,0xbd,0xf1,0x2c,0x01,0x00,0x20,0x4d,0x90,0x15,0x00,0x00,
+0x02,0x00,0xf9,0x25,0x8d,0xf1,0x9f,0xdd,0xd4,0x02,0xb0,0x02,0xd0,0x5a,0x00,0x0f,
+0x04,0xa0,0x00,0xe0,0x1e,0x10,0x6a,0x00,0x6d,0xdb,0x10,0x4a,0x00,0xa4,0x0e,0x10,
+0xa3,0x08,0x60,0xc1,0x02,0xb2,0xc0,0x00,0xdd,0x30,0xbe,0xa3,0x00,0x5e,0xdd,0x90,
+0x59,0x00,0xb4,0x59,0x00,0x76,0x4d,0x90,0x3b,0x07,0xf1,0x12,0x4e,0xdd,0x90,0x49,
+0x00,0xa5,0x4d,0xa0,0x68,0x00,0x00,0x67,0x00,0x00,0xc4,0x3d,0xdd,0x70,0xa6,0x03,
+0xb1,0xd0,0x49,0x08,0x6a,0x50,0x6d,0x60,0x06,0x80,0x00,0x68,0x00,0x05,0x00,0xf0,
+0x04,0x98,0x02,0xc0,0x0c,0x44,0xa0,0x02,0xdc,0x40,0x00,0x5c,0x00,0x00,0x09,0x70,
+0x7d,0xdd,0xf0,0x5d,0x3c,0x01,0x20,0xa4,0x19,0xad,0x08,0x63,0xd1,0x2c,0x0a,0x70,
+0x2c,0xa8,0xf5,0x07,0x29,0xad,0xdb,0x06,0x01,0xf0,0x3a,0xa4,0x0c,0x22,0xc7,0x70,
+0xd0,0x4a,0x4a,0x3d,0x06,0x81,0xfb,0x30,0x96,0x0e,0x00,0x4e,0x10,0xbe,0xda,0x30,
+0x8f,0xdd,0xd5,0x00,0xb2,0x01,0xe0,0x0b,0x20,0x0c,0x10,0xb2,0x00,0xc1,0x0d,0x10,
+0x0c,0x19,0xa0,0x00,0xc1,0x6a,0x3d,0x09,0x46,0x70,0xb0,0xa1,0x00,0x04,0x14,0xf9,
+0x2e,0x70,0x02,0x00,0x00,0x1a,0xb5,0x00,0x00,0x09,0xe0,0x08,0xc8,0x10,0x15,0x00,
+0x00,0x1c,0xcc,0xb0,0x98,0x03,0xf3,0x21,0x9c,0x10,0x00,0x16,0xbf,0xff,0xf2,0x00,
+0x3f,0xff,0xff,0xff,0x20,0x05,0xff,0xd9,0x41,0xf2,0x00,0x5f,0x20,0x00,0x1f,0x20,
+0x05,0xe0,0x00,0x01,0xf2,0x00,0x5e,0x00,0x07,0x9f,0x20,0x48,0xe0,0x07,0xff,0xf2,
+0xaf,0xfe,0x00,0x2b,0xd8,0x07,0xff,0x90,0xef,0x04,0xf1,0x1b,0x00,0x00,0x41,0x88,
+0x88,0x88,0x14,0xeb,0xe7,0x77,0x7e,0xbe,0xa2,0xd0,0x00,0x0d,0x2a,0xeb,0xe3,0x33,
+0x3e,0xbe,0xb4,0xfb,0xbb,0xbf,0x4b,0xd9,0xd0,0x00,0x0d,0x9d,0xb5,0xd0,0x00,0x0d,
+0x5b,0xb7,0xff,0xff,0xff,0x7b,0x61,0x02,0xff,0x05,0xff,0xd6,0xff,0xff,0xff,0xff,
+0xe7,0xff,0xff,0xff,0x67,0x52,0x77,0x77,0x76,0xef,0xc6,0xff,0xff,0xfe,0x0f,0x00,
+0x01,0x51,0x78,0x63,0x88,0x88,0x87,0x5e,0x00,0xf1,0x12,0x00,0x00,0x00,0x06,0xfd,
+0x00,0x00,0x00,0x6f,0xf7,0x7c,0x10,0x06,0xff,0x70,0xdf,0xc1,0x6f,0xf7,0x00,0x1d,
+0xfe,0xff,0x70,0x00,0x01,0xdf,0xf7,0x00,0x00,0x00,0x1c,0x60,0x58,0x00,0xf3,0x3b,
+0x0c,0xd1,0x02,0xea,0xaf,0xd4,0xef,0x80,0xaf,0xff,0x80,0x02,0xff,0xf1,0x02,0xef,
+0xdf,0xd1,0xdf,0x80,0xaf,0xb6,0x70,0x00,0x85,0x00,0x00,0xa6,0x00,0x00,0x02,0xa0,
+0xea,0x29,0x00,0x0e,0xe1,0xea,0x5f,0xa0,0x7f,0x40,0xea,0x08,0xf3,0xbd,0x00,0xea,
+0x01,0xf7,0xcc,0x00,0xb7,0x00,0xf8,0xaf,0x00,0x00,0x04,0xf6,0x4f,0xa0,0x00,0x1d,
+0xf1,0x09,0xfd,0x89,0xef,0x50,0x00,0x6d,0xff,0xc4,0x7e,0x05,0xf9,0x22,0x01,0x88,
+0x10,0x00,0x00,0x05,0xff,0x40,0x00,0x1e,0xcf,0xff,0xfc,0xd0,0x7f,0xff,0xdd,0xff,
+0xf7,0x2d,0xfa,0x00,0xbf,0xd1,0x0b,0xf7,0x00,0x8f,0xa0,0x6f,0xfe,0x55,0xef,0xf6,
+0x4f,0xff,0xff,0xff,0xf3,0x06,0x3a,0xff,0xa3,0x60,0x00,0x03,0xff,0x30,0x00,0x01,
+0x00,0xf0,0x28,0x6f,0x90,0xf8,0x00,0x00,0x09,0xf8,0xec,0xf8,0x00,0x01,0xbe,0x5a,
+0x5c,0xf8,0x00,0x2d,0xd5,0xef,0xf6,0xaf,0x50,0xda,0x6f,0xff,0xff,0x87,0xf1,0x11,
+0xff,0xff,0xff,0xf5,0x10,0x02,0xff,0xc3,0x9f,0xf6,0x00,0x02,0xff,0xb0,0x7f,0xf6,
+0x00,0x01,0xbb,0x70,0x4b,0xb3,0x00,0x00,0x00,0x88,0x2d,0x04,0x27,0xff,0x60,0x05,
+0x00,0x90,0x01,0xff,0xff,0xff,0x60,0x00,0x5f,0xff,0xfa,0x8c,0x00,0xf2,0x02,0xb0,
+0x00,0x8b,0xb9,0x8b,0x8b,0xb9,0xdf,0xff,0xff,0xfe,0xdf,0xcf,0xff,0xff,0xfc,0xbe,
+0x6c,0x00,0xf0,0x15,0x24,0x44,0x44,0x30,0x00,0x01,0xef,0xff,0xff,0xf4,0x00,0x0b,
+0xc0,0x00,0x00,0x8e,0x10,0x6e,0x10,0x00,0x00,0x0c,0xa0,0xee,0xcb,0x10,0x0a,0xcd,
+0xf2,0xff,0xff,0xb8,0x9f,0xff,0xf4,0xff,0x01,0x00,0x20,0xf4,0xcf,0x06,0x00,0xf2,
+0x25,0xe1,0x00,0x04,0x87,0x30,0x5f,0x02,0xdf,0xfe,0xfc,0x7f,0x1e,0xd3,0x00,0x3c,
+0xff,0x9f,0x10,0x05,0xfe,0xff,0x44,0x00,0x02,0x66,0x66,0x12,0x22,0x00,0x00,0x11,
+0xff,0xff,0x50,0x00,0xda,0xff,0xa3,0x10,0x08,0xf4,0xfc,0xfb,0x66,0xbf,0x80,0xf5,
+0x4c,0xff,0xd5,0x00,0x31,0x68,0x00,0x63,0x70,0x00,0xbf,0xab,0xdf,0xff,0x01,0x00,
+0x50,0x00,0x3e,0xf0,0x00,0x2c,0x14,0x00,0xf0,0x05,0x00,0x0b,0xf0,0x00,0xab,0xdf,
+0xf0,0x20,0xff,0xff,0xf0,0xa6,0xff,0xff,0xf0,0x59,0xff,0xff,0xf0,0x92,0x1d,0x00,
+0x31,0x00,0x02,0xc0,0x36,0x00,0x11,0x40,0x3a,0x00,0x10,0xaa,0x28,0x00,0x90,0x0a,
+0x4a,0x70,0xab,0xdf,0xf0,0x23,0xe2,0xe0,0x2c,0x00,0x20,0x95,0xc2,0x2e,0x00,0x20,
+0x76,0xc3,0x30,0x00,0xe0,0xc3,0xe1,0x00,0x3e,0xf0,0x09,0xa6,0xb0,0x00,0x02,0xc0,
+0x03,0x3e,0x20,0x36,0x00,0x10,0xc3,0xd6,0x00,0x40,0x44,0x42,0xff,0xef,0x64,0x01,
+0xf0,0x09,0x0d,0xff,0xef,0xff,0xf8,0x4e,0xfe,0x25,0xff,0xff,0x9d,0xe2,0x00,0x6f,
+0xf9,0x01,0x20,0x00,0x4f,0xf7,0x44,0x44,0x44,0x7f,0xd0,0x00,0xf1,0x18,0xfc,0x00,
+0x1a,0x00,0x00,0x07,0xf5,0x00,0x00,0xef,0xc0,0x00,0x8f,0xff,0x60,0x3f,0xff,0xff,
+0x1b,0xff,0xff,0xf9,0xfb,0xff,0xff,0xdd,0x6e,0xff,0xfc,0x7e,0x59,0xff,0x60,0x9f,
+0xff,0x80,0x00,0x13,0x10,0x58,0x05,0xf0,0x3a,0x70,0x03,0xe4,0xe7,0x04,0xff,0x5e,
+0x75,0xff,0xf5,0xec,0xff,0xff,0x5e,0xff,0xff,0xf5,0xea,0xef,0xff,0x5e,0x71,0xdf,
+0xf5,0xe7,0x01,0xcf,0x59,0x50,0x00,0x92,0x88,0x00,0x00,0x00,0x0f,0xfe,0x50,0x00,
+0x00,0xff,0xff,0xc3,0x00,0x0f,0xff,0xff,0xf9,0x10,0xff,0xff,0xff,0xfe,0x5f,0xff,
+0xff,0xff,0xfa,0xff,0xff,0xff,0xf8,0x0f,0xff,0xff,0xb2,0x00,0xff,0xfd,0x40,0x00,
+0x0e,0xf7,0xef,0x06,0x04,0xea,0x01,0xef,0x0d,0xff,0x90,0xdf,0xf9,0xff,0xfc,0x0f,
+0xff,0xcf,0xff,0xc0,0xff,0xfc,0x09,0x00,0x00,0x82,0xfb,0x0f,0xff,0xb8,0xbb,0x50,
+0x8b,0xb5,0x2d,0x00,0x30,0xff,0xff,0xf9,0x3f,0x01,0x01,0xbb,0x00,0x0f,0x09,0x00,
+0x03,0x40,0xb8,0xbb,0xbb,0xbb,0x2d,0x00,0xf0,0x14,0x0b,0xa0,0x00,0xe7,0xcf,0xb0,
+0x0e,0x7c,0xff,0xc1,0xe7,0xcf,0xff,0xdf,0x7c,0xff,0xff,0xf7,0xcf,0xff,0x9e,0x7c,
+0xff,0x70,0xe7,0xcf,0x60,0x0e,0x77,0x50,0x00,0x95,0x00,0x00,0x02,0x53,0x00,0xe0,
+0xaf,0x60,0x00,0x00,0x09,0xff,0xf5,0x00,0x00,0x8f,0xff,0xff,0x40,0x06,0x2f,0x01,
+0x10,0x0e,0xb2,0x00,0x51,0x03,0x66,0x66,0x66,0x62,0x6f,0x00,0xa0,0x0f,0xff,0xff,
+0xff,0xfb,0x06,0x88,0x88,0x88,0x84,0xf0,0x2b,0x00,0x00,0x00,0x00,0x01,0xc7,0x00,
+0x1d,0xf5,0x01,0xdf,0x50,0x1d,0xf5,0x00,0x4f,0xd0,0x00,0x06,0xfc,0x00,0x00,0x6f,
+0xc0,0x00,0x06,0xf9,0x00,0x00,0x51,0x00,0x00,0x00,0x3e,0x30,0x00,0x2e,0xf3,0x00,
+0x02,0xef,0x30,0x00,0x2e,0xe3,0x00,0x09,0xf8,0x00,0x8f,0xa0,0x08,0xfa,0x00,0x5f,
+0xa0,0x00,0x06,0x3a,0x00,0xf0,0x0f,0x10,0x00,0x00,0x00,0x8f,0x40,0x00,0x00,0x09,
+0xf5,0x00,0x00,0x00,0x9f,0x50,0x00,0x9b,0xbd,0xfc,0xbb,0x6f,0xff,0xff,0xff,0xfb,
+0x13,0x3a,0xf7,0x33,0x10,0x12,0x00,0x02,0x1b,0x00,0xd1,0x39,0x10,0x00,0xbd,0xdd,
+0xdd,0xdd,0x8e,0xff,0xff,0xff,0xfa,0x00,0x01,0x00,0xf1,0x21,0x04,0x8a,0x95,0x00,
+0x00,0x01,0xcf,0x84,0x6e,0xe3,0x00,0x1e,0xf5,0x08,0x72,0xff,0x40,0xbf,0xe0,0x2d,
+0xf5,0xbf,0xe0,0xdf,0xe3,0xff,0xf6,0xaf,0xf1,0x4f,0xf3,0xaf,0xd1,0xef,0x70,0x05,
+0xfd,0x31,0x2b,0xf7,0x00,0x00,0x19,0xdf,0xea,0x30,0x00,0xb6,0x35,0x00,0xf2,0x25,
+0x06,0xfa,0x16,0xaa,0x83,0x00,0x00,0x03,0xef,0xe6,0x49,0xfb,0x00,0x00,0x01,0xbe,
+0x49,0x28,0xfd,0x00,0x1d,0x40,0x8f,0xfe,0x1f,0xf9,0x04,0xff,0x50,0x5f,0xf1,0xff,
+0xb0,0x0a,0xfc,0x00,0x2d,0xdf,0xf2,0x00,0x0a,0xfa,0x10,0x1b,0xf7,0x00,0x00,0x04,
+0xbe,0xe4,0x08,0xf7,0x6e,0x00,0x21,0xf5,0x00,0xe9,0x00,0x51,0x00,0x00,0x00,0x02,
+0xe6,0x0b,0x00,0x20,0xbf,0xe1,0x06,0x00,0xf0,0x00,0x4f,0xff,0x90,0x00,0x00,0x00,
+0x0d,0xe7,0xcf,0x20,0x00,0x00,0x07,0xfc,0x08,0x55,0x00,0xf4,0x17,0xef,0xd0,0x9f,
+0xf4,0x00,0x00,0x9f,0xff,0x5c,0xff,0xd0,0x00,0x2f,0xff,0xe1,0xaf,0xff,0x60,0x0b,
+0xff,0xfe,0x2b,0xff,0xfe,0x00,0xef,0xff,0xff,0xff,0xff,0xf2,0x01,0x33,0x33,0x33,
+0x33,0x32,0x00,0x01,0x00,0xf1,0x53,0x07,0xc1,0xef,0xd1,0x03,0xef,0xfc,0x99,0xfb,
+0x2e,0xec,0xf8,0x00,0x54,0xde,0x25,0x70,0x00,0x0c,0xf4,0x01,0x10,0x00,0xbf,0x5c,
+0x78,0xd1,0xff,0xf6,0x0a,0xff,0xfd,0x78,0x60,0x00,0x7c,0xf6,0x00,0x00,0x00,0x05,
+0x60,0x00,0x00,0x30,0x00,0x00,0x00,0xaf,0x60,0x00,0x00,0xaf,0xef,0x60,0x00,0xaf,
+0x90,0xcf,0x60,0x9f,0x80,0x00,0xcf,0x57,0x80,0x00,0x00,0xa4,0x11,0x00,0x00,0x02,
+0x0c,0xe2,0x00,0x05,0xf8,0x3f,0xe2,0x05,0xfd,0x10,0x3f,0xe7,0xfd,0x10,0x00,0x3f,
+0xfd,0x10,0x00,0x00,0x3b,0x10,0x00,0x00,0x80,0x67,0x00,0xf0,0x28,0xcf,0xc3,0xff,
+0xff,0xf5,0x00,0xbe,0xfe,0xb3,0x44,0x4e,0x60,0x04,0x3f,0x34,0x00,0x00,0xd6,0x00,
+0x02,0xf2,0x00,0x00,0x0d,0x60,0x00,0x2f,0x20,0x00,0x8c,0xea,0xf1,0x01,0xff,0xff,
+0xf7,0xdf,0xf7,0x00,0x04,0x44,0x44,0x11,0xc7,0x00,0x58,0x88,0x20,0x00,0x00,0xff,
+0xff,0xe4,0x44,0x41,0xb2,0x00,0x3e,0xfe,0xff,0xff,0x01,0x00,0xf2,0x13,0xcf,0xff,
+0xff,0xff,0xfc,0x00,0x00,0x33,0x00,0x00,0x00,0x03,0xff,0x40,0x00,0x00,0x3f,0xff,
+0xf4,0x00,0x02,0xff,0xff,0xff,0x20,0x00,0x36,0xff,0x63,0x00,0x00,0x04,0xff,0x40,
+0x05,0x00,0xa0,0x9a,0xa5,0xff,0x5a,0xa9,0xff,0xff,0xdd,0xfe,0xdf,0x31,0x00,0x15,
+0xbe,0xf7,0x00,0xf1,0x03,0xa8,0x40,0x00,0x00,0x00,0x5f,0xff,0x00,0x00,0x00,0x0c,
+0xff,0xe0,0x00,0x00,0x00,0x6f,0xfa,0xa6,0x00,0x10,0x50,0x16,0x00,0xf4,0x0a,0xd0,
+0x00,0x39,0x10,0x4f,0xf4,0x00,0xbf,0xfc,0x9f,0xf6,0x00,0x0d,0xff,0xff,0xe4,0x00,
+0x00,0x9f,0xfd,0x81,0x00,0x00,0x01,0x31,0x3d,0x00,0xf5,0x31,0x06,0xfe,0x30,0x05,
+0xc6,0xe7,0xbb,0x05,0xff,0x4d,0xbd,0xb4,0xff,0x40,0x3c,0xff,0xff,0x40,0x00,0x08,
+0xff,0xb0,0x00,0x6f,0xff,0xdf,0x80,0x0e,0x7b,0xb2,0xef,0x80,0xdb,0xd9,0x02,0xef,
+0x73,0xca,0x10,0x02,0x72,0x00,0x5d,0xdd,0x48,0x00,0x08,0xff,0xf6,0xf8,0xcc,0x8f,
+0xff,0x84,0x3f,0xe8,0xff,0xff,0xfc,0xfe,0x8f,0xff,0xff,0xcf,0x09,0x00,0xf0,0x35,
+0xe7,0xff,0xff,0xfc,0xff,0x46,0x66,0x66,0x3f,0xff,0xff,0xf4,0x00,0x34,0x44,0x43,
+0x00,0x00,0x02,0x22,0x22,0x00,0x0e,0xff,0xff,0xfe,0x20,0xf5,0x22,0x22,0xfe,0x1f,
+0x40,0x00,0x0e,0xf8,0xf7,0x44,0x44,0xff,0x9f,0xff,0xff,0xff,0xf9,0xff,0xf6,0x0c,
+0xff,0x9f,0xff,0x20,0x9f,0xf9,0xff,0xfc,0x7f,0xff,0x9a,0xdd,0xdd,0xdd,0xd4,0x67,
+0x77,0x77,0x77,0x4e,0xad,0x02,0x01,0x95,0x00,0x40,0x77,0x77,0x77,0x74,0xe3,0x01,
+0x10,0xb0,0x0e,0x00,0x50,0x45,0x55,0x55,0x55,0x3f,0x1b,0x00,0xa1,0x11,0x11,0x11,
+0x11,0x00,0x58,0x88,0x88,0x88,0x84,0x38,0x01,0x00,0xdc,0x02,0xf7,0x00,0xf6,0xc5,
+0xdf,0xff,0xfd,0x5c,0xfe,0x6a,0xff,0xa5,0xef,0xff,0xf9,0x55,0x9f,0x51,0x01,0xf0,
+0x57,0x03,0xaa,0xa2,0x00,0x07,0xff,0xf2,0x00,0x09,0xff,0xd0,0x00,0x0b,0xff,0xd8,
+0x81,0x0e,0xff,0xff,0xe1,0x0e,0xff,0xff,0x60,0x00,0x05,0xfd,0x00,0x00,0x09,0xf4,
+0x00,0x00,0x0d,0xa0,0x00,0x00,0x0f,0x20,0x00,0x00,0x02,0x00,0x00,0x01,0x79,0x11,
+0x00,0x0f,0xfc,0x9f,0xf4,0x00,0xff,0xfd,0xcc,0x30,0x0f,0xfa,0x79,0x93,0x40,0xff,
+0x8e,0xff,0x6f,0x5f,0xf8,0xef,0xf7,0x64,0xff,0x8e,0xff,0xff,0xcf,0xf8,0xef,0xff,
+0xfc,0x46,0x3e,0xff,0xff,0xc0,0x00,0xdf,0xff,0xfc,0x00,0x02,0x44,0x44,0x20,0x00,
+0x01,0x90,0x00,0x00,0x02,0xaf,0x81,0xa9,0x01,0xa0,0xd0,0x00,0x9f,0xff,0xff,0x50,
+0x0c,0xff,0xff,0xf8,0x97,0x02,0x60,0xa0,0x3f,0xff,0xff,0xfe,0x0d,0xe5,0x00,0x91,
+0x46,0x66,0x66,0x66,0x20,0x00,0xbf,0x70,0x00,0x6e,0x02,0x61,0x24,0x44,0x44,0x44,
+0x44,0x30,0xa0,0x00,0xf0,0x11,0xf3,0xf4,0xa0,0xa0,0xb0,0xb0,0xf4,0xff,0xbe,0xae,
+0xae,0xaf,0xf4,0xff,0x3a,0x0a,0x0a,0x0f,0xf4,0xfb,0xea,0xaa,0xaa,0xea,0xf4,0xf7,
+0xb4,0x44,0x44,0xc4,0xf4,0xcf,0x24,0x00,0x01,0x12,0x03,0x10,0x29,0x3c,0x00,0x10,
+0x3a,0xd5,0x01,0xb0,0x4b,0xff,0xff,0x70,0x00,0x5d,0xff,0xff,0xff,0x10,0x0c,0x5b,
+0x00,0xc1,0x00,0x0a,0xee,0xef,0xff,0xf2,0x00,0x00,0x00,0x0a,0xff,0xa0,0x06,0x00,
+0x10,0x30,0x06,0x00,0x01,0x3c,0x01,0x21,0x08,0xf4,0xd8,0x01,0xfe,0x09,0x20,0x00,
+0x00,0xef,0xff,0x5b,0x00,0xff,0xff,0x6f,0xb0,0xff,0xff,0x68,0x83,0xff,0xff,0xfd,
+0xd6,0xff,0xff,0xff,0xf8,0xff,0x04,0x00,0x22,0xf7,0x00,0x8f,0x03,0x10,0x10,0x1a,
+0x03,0xc0,0xbf,0xff,0xfd,0x81,0x00,0x2c,0xfe,0xa8,0x78,0xcf,0xf7,0x0d,0x19,0x00,
+0xf0,0x05,0x3c,0xf5,0x22,0x05,0xbe,0xfd,0x81,0x05,0x00,0x09,0xfe,0xa9,0xcf,0xe2,
+0x00,0x00,0x37,0x00,0x00,0x38,0x2e,0x00,0x20,0x8c,0x20,0x06,0x00,0x12,0x0f,0x3c,
+0x00,0x41,0x58,0x10,0x00,0x00,0xb5,0x00,0xf0,0x00,0xf9,0x0f,0x75,0x55,0x55,0x55,
+0x5a,0xf2,0xf6,0xff,0xff,0xff,0xfd,0x4f,0x5f,0xa1,0x01,0x91,0xd1,0xf5,0xf5,0x77,
+0x77,0x77,0x76,0x8f,0x4f,0xfa,0x00,0x11,0xd0,0x06,0x01,0x17,0x41,0x2e,0x00,0x21,
+0x54,0x4a,0x2e,0x00,0x11,0x00,0x2e,0x00,0x21,0xf0,0x01,0x2e,0x00,0x1f,0x00,0x2e,
+0x00,0x05,0x21,0x54,0x44,0x2e,0x00,0x11,0x20,0x2e,0x00,0x21,0xf2,0x00,0x2e,0x00,
+0x1f,0x10,0x2e,0x00,0x05,0x21,0x54,0x44,0x2e,0x00,0x20,0x50,0x00,0x2e,0x00,0x21,
+0xf5,0x00,0x2e,0x00,0x2f,0x20,0x00,0x2e,0x00,0x02,0x40,0xfa,0x0f,0x74,0x44,0x2e,
+0x00,0x11,0xf4,0x87,0x04,0x30,0x5f,0x40,0x00,0x2e,0x00,0x01,0x0d,0x00,0x0a,0x2e,
+0x00,0x00,0x12,0x00,0x20,0x5b,0x10,0xa8,0x03,0x11,0xbd,0x1e,0x00,0xf1,0x0d,0xa1,
+0x03,0x00,0x00,0x0a,0xf7,0x39,0x00,0x00,0x07,0x60,0xff,0xea,0xbf,0xaa,0xaa,0xdf,
+0x45,0xa3,0x00,0x93,0x00,0x04,0x10,0x00,0x00,0x01,0xb8,0x8d,0x01,0x44,0x02,0x9f,
+0xb0,0x00,0x9b,0x05,0xf2,0x1c,0x6b,0xca,0x40,0x00,0x9f,0xf6,0xff,0x40,0x1f,0xff,
+0x26,0xfb,0x04,0xf6,0xb4,0x6b,0xf0,0x6f,0xf4,0x06,0xff,0x06,0xff,0x90,0xbf,0xf0,
+0x5f,0x95,0x34,0xcf,0x02,0xfb,0xf3,0x4d,0xc0,0x0c,0xff,0x3d,0xf7,0x00,0x1b,0xfe,
+0xf9,0x32,0x00,0x50,0x12,0x3b,0xca,0x22,0x1f,0xf8,0x02,0x50,0x36,0x66,0x66,0x66,
+0x16,0xf0,0x04,0x8a,0x6f,0x6f,0x6f,0x7f,0x26,0xf6,0xf6,0xf7,0x09,0x00,0x91,0x24,
+0xff,0xff,0xff,0xf1,0x03,0x44,0x44,0x42,0x6b,0x00,0x20,0x97,0x00,0xfe,0x05,0xf0,
+0x02,0xf8,0x00,0x00,0x00,0xa5,0xef,0xe0,0x00,0x00,0xbf,0xe5,0xd4,0x00,0x00,0xbf,
+0xff,0xe0,0x05,0x00,0x13,0xf4,0x05,0x00,0x20,0xaf,0xff,0xff,0x02,0x10,0xff,0xc3,
+0x00,0x01,0x05,0x00,0x21,0x02,0x20,0x3a,0x00,0x80,0x05,0x88,0x88,0x88,0x86,0x00,
+0x08,0xff,0x57,0x03,0xf0,0x13,0x08,0xff,0xf9,0x6f,0x69,0xff,0x88,0xff,0xff,0xc1,
+0x21,0xcf,0xf8,0xdf,0xff,0xff,0x50,0x5f,0xff,0x82,0xef,0xff,0x71,0x91,0x7f,0xf8,
+0x02,0xef,0xfe,0xdf,0xde,0xff,0x70,0x02,0x85,0x04,0xf0,0x02,0xe3,0x01,0xdf,0xff,
+0xe5,0x1d,0x6c,0x5a,0xab,0xdf,0x3b,0x18,0x8b,0xff,0xdf,0xde,0xeb,0xae,0x00,0x0c,
+0x04,0x00,0x44,0xbf,0xff,0xff,0xf6,0x6e,0x04,0xd0,0x0a,0x00,0x08,0x10,0x00,0x07,
+0xf0,0x0b,0xf2,0x00,0x00,0x8f,0x0b,0x69,0x00,0xf0,0x03,0xf0,0x7f,0xfa,0x99,0x99,
+0x99,0x00,0x6f,0x20,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -462,11 +466,16 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 1524, .range_length = 62127, .glyph_id_start = 143, .list_length = 63, .type = 3, .unicode_list = 1648, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[9841] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 2044, .size = 4091, .comp_size = 3675 },
+{ .bitmap_start = 4091, .comp_offset = 5719, .size = 1796, .comp_size = 1526 },
+};
+
+static uint8_t etxUncompBuf[3954] __SDRAMFONTS;
 
 const etxLz4Font lv_font_he_XS = {
-.uncomp_size = 9513,
-.comp_size = 7170,
+.uncomp_size = 3626,
+.comp_size = 2044,
 .line_height = 13,
 .base_line = 3,
 .subpx = 0,
@@ -479,12 +488,13 @@ const etxLz4Font lv_font_he_XS = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 36,
-.glyph_bitmap = 1774,
-.class_pair_values = 7661,
-.left_class_mapping = 9101,
-.right_class_mapping = 9307,
+.class_pair_values = 1774,
+.left_class_mapping = 3214,
+.right_class_mapping = 3420,
+.block_num = 2,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 9841,
+.lvglFontBufSize = 3954,
 };
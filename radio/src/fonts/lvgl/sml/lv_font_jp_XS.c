@@ -199,1465 +199,1503 @@ static const uint8_t lz4FontData[] ={
 0xb0,0x2f,0xb3,0x2f,0xb4,0x2f,0xb6,0x2f,0xb7,0x2f,0xb8,0x2f,0xba,0x2f,0xbb,0x2f,
 0xbe,0x2f,0xbf,0x2f,0xc8,0x2f,0xc9,0x2f,0xce,0x2f,0xcf,0x2f,0xd0,0x2f,0xd1,0x2f,
 0xd2,0x2f,0xd9,0x2f,0xda,0x2f,0xdb,0x2f,0xdc,0x2f,0xdf,0x2f,0xe2,0x2f,0xe3,0x2f,
-0x00,0x26,0x12,0xf1,0xff,0xff,0xff,0x02,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,
-0x00,0x0c,0x0d,0x0e,0x0f,0x10,0x00,0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,
-0x1a,0x1b,0x1c,0x1d,0x00,0x1e,0x1f,0x00,0x20,0x21,0x22,0x23,0x24,0x25,0x00,0x26,
-0x27,0x28,0x29,0x2a,0x00,0x00,0x04,0x00,0x0d,0x00,0x11,0x1d,0x1b,0x1d,0x1c,0x1d,
-0x1e,0x1d,0x32,0x1d,0x3e,0x1d,0x68,0x1d,0x97,0x1d,0xe7,0x1d,0xe9,0x1d,0x07,0x1e,
-0x0c,0x1e,0x5e,0x1e,0x5f,0x1e,0x64,0x1e,0x6d,0x1e,0x90,0x1e,0xee,0x1e,0xf2,0x1e,
-0xff,0x1e,0x1e,0x1f,0x35,0x1f,0x60,0x1f,0x6d,0x1f,0x85,0x1f,0xaa,0x1f,0xe0,0x1f,
-0x54,0x20,0x56,0x20,0x59,0x20,0x76,0x20,0x79,0x20,0x7d,0x20,0x82,0x20,0x88,0x20,
-0x96,0x20,0x97,0x20,0x9e,0x20,0x0b,0x21,0x17,0x21,0x2e,0x21,0x36,0x21,0x3a,0x21,
-0x4c,0x21,0x5b,0x21,0x5e,0x21,0x83,0x21,0xac,0x21,0xb0,0x21,0xb1,0x21,0xca,0x21,
-0xe6,0x21,0x27,0x22,0x69,0x22,0xcc,0x22,0xe8,0x22,0x04,0x23,0x08,0x23,0x19,0x23,
-0x1d,0x23,0x1e,0x23,0x22,0x23,0x37,0x23,0x3c,0x23,0x5b,0x23,0x79,0x23,0x60,0x24,
-0x79,0x25,0xef,0x25,0x03,0x26,0x0b,0x26,0x0e,0x26,0x38,0x26,0x39,0x26,0x58,0x26,
-0xdc,0x26,0x42,0x27,0x68,0x27,0xa8,0x27,0x01,0x28,0x1a,0x28,0x27,0x28,0x2b,0x28,
-0x38,0x28,0x3f,0x28,0x42,0x28,0x79,0x28,0x69,0x2a,0x9d,0x2a,0xab,0x2a,0xb0,0x2a,
-0xca,0x2a,0x0f,0x2b,0x20,0x2b,0x22,0x2b,0xf7,0x2c,0xff,0x2c,0x49,0x2d,0x84,0x2d,
-0xb7,0x2d,0xb8,0x2d,0x07,0x2e,0x20,0x2e,0x42,0x2e,0x46,0x2e,0x48,0x2e,0x64,0x2e,
-0x73,0x2e,0x82,0x2e,0x96,0x2e,0x9d,0x2e,0xba,0x2e,0xbf,0x2e,0xd6,0x2e,0xed,0x2e,
-0x36,0x2f,0xd6,0x2f,0x04,0x30,0x20,0x30,0x5c,0x30,0x21,0x31,0x5c,0x31,0xaf,0x31,
-0xcd,0x31,0xe3,0x31,0xf2,0x31,0x12,0x32,0x50,0x32,0xb6,0x32,0xb9,0x32,0xd4,0x32,
-0xec,0x32,0xde,0x33,0x68,0x34,0x81,0x34,0x98,0x34,0xc1,0x34,0xca,0x34,0xf3,0x34,
-0xf6,0x34,0x1f,0x35,0x53,0x35,0x80,0x35,0x05,0x36,0x09,0x36,0x11,0x36,0x1a,0x36,
-0x30,0x36,0x3b,0x36,0x3c,0x36,0x3d,0x36,0x72,0x36,0xb1,0x36,0x4d,0x37,0x2d,0x38,
-0x86,0x38,0x93,0x38,0xdc,0x38,0x2a,0x39,0x70,0x39,0x73,0x3a,0x74,0x3a,0x9c,0x3a,
-0xdf,0x3a,0xe5,0x3a,0x28,0x3b,0x71,0x3b,0xe6,0x3b,0xf3,0x3b,0x99,0x3c,0x2c,0x3d,
-0x3a,0x3d,0xa1,0x3d,0xa7,0x3d,0x25,0x3e,0x81,0x3e,0x32,0x40,0xc7,0x41,0x98,0x42,
-0x0f,0x43,0x17,0x43,0x30,0x44,0x39,0x44,0x4c,0x44,0x7b,0x44,0x8c,0x45,0x51,0x46,
-0xcb,0x47,0x4b,0x48,0xe3,0x48,0x01,0x49,0x0c,0x49,0x8b,0x49,0x92,0x49,0x00,0x4a,
-0x3d,0x4a,0x65,0x4a,0xa8,0x4a,0xb2,0x4a,0xd5,0x4a,0xcf,0x4b,0x31,0x4c,0x33,0x4c,
-0x41,0x4c,0x53,0x4c,0x5d,0x4c,0x82,0x4c,0xaa,0x4c,0xab,0x4c,0xdb,0x4c,0xe2,0x4c,
-0xeb,0x4c,0xf9,0x4c,0x7f,0x4e,0x83,0x4e,0x14,0x4f,0x16,0x4f,0xdd,0x4f,0x0e,0x50,
-0xfb,0x50,0x80,0x51,0x83,0x51,0x46,0x54,0x5d,0x57,0x6e,0x57,0x79,0x57,0x81,0x57,
-0xd6,0x57,0x0e,0x58,0x18,0x58,0x92,0x58,0x9c,0x58,0xa0,0x58,0xa7,0x58,0xf4,0x58,
-0x11,0x59,0x19,0x59,0x29,0x59,0x3e,0x59,0x4d,0x59,0x83,0x59,0x84,0x59,0x9e,0x59,
-0xaf,0x59,0xbd,0x59,0xbe,0x59,0xe7,0x59,0x69,0x5a,0x77,0x5a,0xcc,0x5b,0xcd,0x5b,
-0x75,0x5c,0x88,0x5c,0x96,0x5c,0xee,0x5c,0x09,0x5e,0x14,0x5e,0x2e,0x5e,0xcd,0x5e,
-0x0e,0x5f,0x12,0x5f,0x2b,0x5f,0x30,0x5f,0x56,0x5f,0x5f,0x5f,0x7a,0x5f,0x89,0x5f,
-0xf9,0x5f,0xe0,0x60,0x43,0x62,0x88,0x64,0x9c,0x64,0xa4,0x64,0x75,0x65,0xd7,0x65,
-0xf3,0x65,0x0c,0x66,0x63,0x66,0x6f,0x66,0x73,0x66,0xe4,0x66,0x04,0x67,0x17,0x67,
-0x5d,0x67,0xec,0x67,0xe9,0x69,0x12,0xbf,0x19,0xbf,0x1c,0xbf,0x1d,0xbf,0x1e,0xbf,
-0x22,0xbf,0x24,0xbf,0x26,0xbf,0x2a,0xbf,0x2d,0xbf,0x32,0xbf,0x37,0xbf,0x38,0xbf,
-0x39,0xbf,0x4f,0xbf,0x54,0xbf,0x59,0xbf,0x5c,0xbf,0x5d,0xbf,0x5e,0xbf,0x62,0xbf,
-0x63,0xbf,0x64,0xbf,0x65,0xbf,0x78,0xbf,0x79,0xbf,0x7f,0xbf,0x81,0xbf,0x82,0xbf,
-0x85,0xbf,0x88,0xbf,0x89,0xbf,0x8a,0xbf,0x8c,0xbf,0xa4,0xbf,0xa6,0xbf,0xd5,0xbf,
-0xd6,0xbf,0xd8,0xbf,0xda,0xbf,0xf1,0xbf,0xf8,0xbf,0xfb,0xbf,0x04,0xc0,0x2d,0xc0,
-0x35,0xc0,0x6c,0xc0,0xfc,0xc0,0x51,0xc1,0x52,0xc1,0x53,0xc1,0x54,0xc1,0x55,0xc1,
-0x98,0xc1,0xa4,0xc1,0xfe,0xc1,0x15,0xc2,0x6b,0xc4,0xd3,0xc6,0xb3,0xc7,0x2c,0x2b,
-0x2b,0x2b,0x2b,0x17,0x00,0x2b,0x55,0xa5,0x59,0x32,0x60,0x00,0x55,0x55,0x00,0x08,
-0x29,0x20,0x0c,0xec,0xec,0x00,0x0b,0x0b,0x00,0x00,0xa0,0xa0,0x05,0xce,0xcd,0x80,
-0x05,0x56,0x50,0x00,0x82,0x92,0x96,0x15,0xf0,0x85,0x74,0x00,0x05,0xdc,0x30,0x1d,
-0x14,0xd0,0x2c,0x00,0x80,0x0b,0xa3,0x00,0x00,0x5c,0x70,0x23,0x00,0xd0,0x4b,0x01,
-0xe0,0x09,0xed,0x50,0x00,0x83,0x00,0x1b,0xb1,0x00,0x07,0x45,0x63,0x70,0x64,0x55,
-0xa0,0x01,0xa9,0x65,0x00,0x00,0x0a,0x6a,0x40,0x08,0x3b,0x0b,0x01,0x90,0xb0,0xb0,
-0x00,0x08,0xa6,0x05,0xdc,0x10,0x00,0xd1,0x67,0x00,0x0c,0x3a,0x40,0x00,0x5f,0x70,
-0x00,0x1d,0xa9,0x07,0x07,0x80,0xc8,0x90,0x59,0x02,0xf4,0x00,0x9b,0xc9,0xc0,0x73,
-0x73,0x41,0x00,0x71,0x04,0x90,0x0b,0x10,0x1c,0x00,0x4a,0x00,0x59,0x00,0x49,0x00,
-0x2b,0x00,0x0d,0x00,0x09,0x40,0x01,0xb0,0x00,0x21,0x81,0x03,0xa0,0x0b,0x20,0x67,
-0x04,0xa0,0x2b,0x03,0xb0,0x49,0x08,0x50,0xc0,0x76,0x03,0x00,0x03,0x80,0x07,0x69,
-0x80,0x3b,0xe5,0x01,0xca,0x30,0x13,0x13,0x00,0x00,0x83,0x00,0x00,0xa4,0x03,0x00,
-0x32,0x9f,0xff,0xf3,0x09,0x00,0xf6,0x28,0x67,0x85,0x70,0xad,0x70,0x01,0x3b,0x00,
-0x1a,0x00,0x74,0x00,0xb0,0x02,0x90,0x08,0x40,0x0c,0x00,0x38,0x00,0x83,0x00,0x60,
-0x00,0x08,0xdc,0x30,0x2c,0x03,0xc0,0x58,0x00,0xe0,0x67,0x00,0xd0,0x67,0x00,0xd0,
-0x58,0x00,0xe0,0x2c,0x03,0xb0,0x07,0xdc,0x30,0x03,0x98,0x2b,0x99,0x00,0x59,0x02,
-0x00,0xf0,0x6e,0x09,0xdd,0x30,0x5a,0x03,0xc0,0x32,0x01,0xd0,0x00,0x07,0x80,0x00,
-0x3c,0x00,0x01,0xd2,0x00,0x0b,0x40,0x00,0x6f,0xdd,0xd3,0x0a,0xdd,0x35,0x80,0x2c,
-0x00,0x04,0xb0,0x1d,0xf2,0x00,0x04,0xb2,0x20,0x0e,0x5a,0x03,0xc0,0xad,0xc2,0x00,
-0x0d,0x60,0x00,0x7e,0x60,0x01,0xc8,0x60,0x0a,0x38,0x60,0x4a,0x08,0x60,0xad,0xde,
-0xe5,0x00,0x08,0x60,0x00,0x08,0x60,0x0a,0xff,0xf0,0x0c,0x10,0x00,0x0d,0x00,0x00,
-0x0e,0xdd,0x50,0x04,0x02,0xe0,0x00,0x00,0xb2,0x1c,0x00,0xd1,0x06,0xdd,0x60,0x01,
-0xae,0x10,0x0b,0x80,0x00,0x1d,0x00,0x00,0x4c,0xcd,0x40,0x5d,0x12,0xe0,0x49,0x00,
-0xc1,0x1d,0x01,0xd0,0x05,0xdd,0x40,0x8d,0xdd,0xf2,0x00,0x01,0xc0,0x00,0x07,0x60,
-0x34,0x00,0x70,0x49,0x00,0x00,0xb3,0x00,0x01,0xd0,0x4a,0x00,0xf0,0x5b,0x09,0xdd,
-0x40,0x3c,0x02,0xd0,0x2c,0x03,0xc0,0x09,0xef,0x30,0x3c,0x03,0xc0,0x67,0x00,0xd0,
-0x4b,0x02,0xd0,0x08,0xdd,0x40,0x09,0xdc,0x15,0xa0,0x5a,0x76,0x00,0xd4,0xb0,0x4f,
-0x08,0xd8,0xe0,0x00,0x3c,0x00,0x0b,0x60,0x7e,0x70,0x3a,0x01,0x00,0x00,0x01,0x3a,
-0x58,0x01,0x00,0x00,0x12,0x58,0x84,0x30,0x00,0x18,0x40,0x8d,0x70,0x9c,0x10,0x00,
-0x7d,0x81,0x00,0x08,0x40,0x3e,0xee,0xb0,0x00,0x00,0x3e,0xee,0xb0,0x49,0x10,0x00,
-0x6d,0x91,0x00,0x0a,0xc1,0x7d,0x81,0x48,0x10,0x00,0x1c,0xea,0x08,0x60,0xb3,0x00,
-0x0a,0x30,0x04,0xc0,0x00,0xd1,0x00,0x27,0xdc,0x01,0xf0,0x7c,0x3a,0x00,0x00,0x3b,
-0xbb,0x80,0x00,0x3a,0x00,0x04,0x90,0x0b,0x02,0xba,0x18,0x22,0x80,0xb1,0x92,0x35,
-0x55,0x1a,0x0a,0x12,0x76,0x44,0x80,0xb0,0x36,0x56,0x38,0x0d,0x07,0x31,0xa0,0xb9,
-0x7a,0x80,0x09,0x50,0x00,0x00,0x00,0x07,0xba,0xa0,0x00,0x00,0x5d,0x00,0x00,0x0a,
-0xd2,0x00,0x00,0xd5,0x80,0x00,0x59,0x0d,0x00,0x0a,0x30,0xb3,0x00,0xfd,0xde,0x80,
-0x59,0x00,0x1d,0x0b,0x40,0x00,0xb3,0x2f,0xdd,0xb0,0x2c,0x00,0x96,0x2c,0x00,0xa5,
-0x2f,0xde,0xc0,0x2c,0x00,0x97,0x2c,0x00,0x5a,0x2c,0x00,0x97,0x2f,0xdd,0xa0,0x03,
-0xcd,0xb2,0x00,0xd3,0x05,0xb0,0x4a,0x00,0x09,0x06,0x80,0x00,0x00,0x68,0x00,0x00,
-0x04,0xa0,0x00,0x80,0x0d,0x30,0x5b,0x00,0x3c,0xdb,0x10,0x2f,0xed,0x70,0x2c,0x00,
-0xb6,0x2c,0x00,0x2c,0x2c,0x00,0x0e,0x03,0x00,0x00,0x09,0x00,0xd1,0xb6,0x2f,0xde,
-0x70,0x2f,0xdd,0xd4,0x2c,0x00,0x00,0x2c,0x00,0x00,0x55,0x00,0x14,0x00,0x0c,0x00,
-0x47,0xd4,0x2f,0xdd,0xd3,0x0f,0x00,0x15,0xa0,0x0c,0x00,0xa1,0x03,0xcd,0xc2,0x00,
-0xd3,0x04,0xc0,0x4b,0x00,0x06,0x64,0x00,0xf0,0x05,0x06,0xde,0x14,0xb0,0x00,0xd1,
-0x0d,0x40,0x1e,0x10,0x2c,0xed,0x60,0x2c,0x00,0x0a,0x42,0xc0,0x00,0xa4,0x07,0x00,
-0x36,0xfd,0xdd,0xf4,0x0e,0x00,0x00,0x07,0x00,0x13,0x1d,0x01,0x00,0x53,0x00,0x03,
-0xc0,0x00,0x3c,0x05,0x00,0xf5,0x15,0xc3,0x00,0x3b,0x96,0x07,0x91,0xcd,0xb1,0x2c,
-0x00,0x7a,0x02,0xc0,0x4d,0x00,0x2c,0x2d,0x20,0x02,0xcd,0x60,0x00,0x2f,0xad,0x00,
-0x02,0xc0,0x89,0x00,0x2c,0x00,0xd4,0x02,0xc0,0x03,0xd0,0x79,0x00,0x08,0x03,0x00,
-0xf1,0x52,0x2f,0xdd,0xd1,0x2f,0x30,0x00,0x7e,0x2f,0x90,0x00,0xde,0x2b,0xd0,0x03,
-0xbe,0x2b,0x94,0x09,0x5e,0x2c,0x4a,0x0d,0x0e,0x2c,0x0d,0x59,0x0e,0x2c,0x08,0xe4,
-0x0e,0x2c,0x02,0xe0,0x0e,0x2f,0x10,0x0a,0x42,0xfa,0x00,0xa4,0x2c,0xd3,0x0a,0x42,
-0xc4,0xc0,0xa4,0x2c,0x0b,0x6a,0x42,0xc0,0x2e,0xb4,0x2c,0x00,0x8f,0x42,0xc0,0x00,
-0xe4,0x02,0xce,0xb1,0x00,0xd4,0x05,0xc0,0x4b,0x00,0x0d,0x26,0x80,0x00,0xa4,0x68,
-0x00,0x0a,0x44,0xb0,0x00,0xd2,0x0d,0x40,0x5c,0x00,0x2c,0xeb,0x10,0x2f,0xed,0xc2,
-0x2c,0x00,0x5b,0x22,0x01,0x46,0x5b,0x2f,0xdd,0xb2,0xf8,0x00,0xf1,0x16,0xce,0xb1,
-0x00,0xd3,0x06,0xb0,0x4a,0x00,0x0d,0x17,0x70,0x00,0xb3,0x77,0x00,0x0b,0x35,0xa0,
-0x00,0xd1,0x0d,0x30,0x6b,0x00,0x3c,0xef,0x40,0x00,0x00,0x4d,0x10,0x00,0x00,0x00,
-0x2f,0xee,0xa0,0x8e,0x01,0xfe,0x1f,0x4a,0x2c,0x00,0xa7,0x2f,0xde,0xa0,0x2c,0x04,
-0xb0,0x2c,0x00,0xc3,0x2c,0x00,0x4b,0x07,0xdd,0x80,0x3c,0x00,0xb5,0x5b,0x00,0x22,
-0x0b,0xb5,0x00,0x00,0x3a,0xd1,0x32,0x00,0x87,0x6a,0x00,0x96,0x08,0xdd,0xa0,0xad,
-0xee,0xda,0x00,0x77,0x00,0x03,0x00,0x38,0x59,0x00,0x1d,0x03,0x00,0xf0,0x45,0x4a,
-0x00,0x2c,0x1d,0x10,0x79,0x05,0xde,0xa1,0xb4,0x00,0x0e,0x15,0x90,0x04,0xb0,0x1e,
-0x00,0x96,0x00,0xb3,0x0d,0x10,0x06,0x83,0xb0,0x00,0x1d,0x86,0x00,0x00,0xbe,0x10,
-0x00,0x06,0xc0,0x00,0x95,0x00,0xf0,0x06,0x86,0x80,0x4f,0x40,0x95,0x2b,0x08,0x98,
-0x0c,0x10,0xe0,0xc1,0xb0,0xd0,0x0b,0x3c,0x0c,0x3a,0x00,0x89,0x80,0x89,0x70,0x04,
-0xf4,0x04,0xf4,0x00,0x1f,0x00,0x0f,0x00,0x6b,0x00,0x7a,0x0d,0x41,0xe2,0x04,0xd9,
-0x80,0x00,0xbe,0x37,0x00,0xf6,0x08,0x04,0xc8,0x90,0x0d,0x30,0xe2,0x6a,0x00,0x6b,
-0xa5,0x00,0x6a,0x3d,0x00,0xd2,0x0b,0x45,0xb0,0x03,0xcc,0x30,0x00,0xbb,0x88,0x00,
-0xf6,0x0e,0x7d,0xdd,0xf6,0x00,0x01,0xe1,0x00,0x0b,0x50,0x00,0x4c,0x00,0x00,0xd2,
-0x00,0x08,0x80,0x00,0x2d,0x00,0x00,0x9f,0xdd,0xd8,0x4d,0x74,0xa0,0x4a,0x04,0x03,
-0x00,0x60,0x4e,0x70,0xa3,0x00,0x04,0x90,0x5c,0x03,0x40,0x94,0x00,0x03,0xa0,0x08,
-0x00,0x94,0x85,0x00,0x02,0xa0,0x00,0x06,0x00,0xcc,0x0e,0x01,0x00,0xf4,0x63,0xcc,
-0x06,0x90,0x0c,0xc0,0x2a,0x84,0x85,0x2a,0xdd,0xdd,0x60,0x44,0x00,0xc1,0x09,0xdc,
-0x22,0x60,0x4a,0x07,0xbc,0xb5,0xa0,0x3b,0x69,0x07,0xb0,0xcd,0x9b,0x59,0x00,0x00,
-0x59,0x00,0x00,0x5c,0xcd,0x40,0x5c,0x02,0xd0,0x59,0x00,0xc1,0x59,0x00,0xc1,0x5c,
-0x02,0xd0,0x5b,0xce,0x40,0x08,0xdc,0x34,0xb0,0x2c,0x86,0x00,0x17,0x60,0x00,0x4b,
-0x02,0xb0,0x8d,0xc2,0x00,0x00,0xe0,0x00,0x0e,0x09,0xda,0xe4,0xb0,0x2e,0x76,0x00,
-0xe7,0x60,0x0e,0x4b,0x02,0xe0,0x9c,0xae,0x07,0xdc,0x33,0xa0,0x2c,0x7e,0xdd,0xd7,
-0x70,0x00,0x4c,0x01,0x60,0x8d,0xd4,0x03,0xd6,0x0c,0x30,0x0d,0x00,0x8f,0xc1,0x0e,
-0x00,0x02,0x00,0x43,0x09,0xda,0xe4,0xc0,0x30,0x00,0xf1,0x09,0x03,0xe0,0x9e,0xae,
-0x03,0x03,0xc0,0x9d,0xc3,0x59,0x00,0x05,0x90,0x00,0x5b,0xbe,0x45,0xc0,0x3c,0x59,
-0x01,0xd5,0x90,0x1d,0x05,0x00,0x31,0x3a,0x00,0x3a,0x01,0x00,0x62,0x04,0x90,0x00,
-0x04,0x90,0x49,0x03,0x00,0x32,0x05,0x94,0xe4,0x9b,0x00,0xf3,0x04,0x59,0x0b,0x60,
-0x59,0x89,0x00,0x5d,0xe0,0x00,0x5d,0xb6,0x00,0x59,0x1d,0x10,0x59,0x05,0xb0,0x3a,
-0x01,0x00,0xf5,0x03,0x5b,0xcd,0x5b,0xe8,0x05,0xb0,0x3f,0x10,0xe0,0x59,0x01,0xd0,
-0x0d,0x15,0x90,0x1d,0x00,0xd1,0x09,0x00,0x0b,0x61,0x00,0xf6,0x08,0x07,0xdd,0x40,
-0x4c,0x02,0xd0,0x86,0x00,0xb2,0x76,0x00,0xb3,0x3c,0x01,0xe0,0x07,0xdd,0x40,0x5c,
-0xbd,0x40,0x5b,0x01,0xf1,0x00,0x32,0x5c,0xcd,0x40,0x6e,0x00,0x36,0x09,0xda,0xd4,
-0xe3,0x00,0x21,0x9d,0xae,0xf7,0x00,0x55,0x00,0x00,0x5c,0xd3,0x5c,0x46,0x05,0xf6,
-0x0c,0x0a,0xdc,0x14,0xa0,0x56,0x1d,0x82,0x00,0x05,0xc5,0x67,0x05,0x90,0xad,0xc2,
-0x07,0x00,0xe0,0xbf,0xa0,0xe0,0x0e,0x00,0xe0,0x0e,0x00,0xac,0x71,0x00,0xf4,0x66,
-0x3b,0x04,0xd0,0xbd,0xad,0xb3,0x06,0x75,0x80,0xb2,0x1c,0x0d,0x00,0xb6,0x80,0x06,
-0xe3,0x00,0x1e,0x00,0xa3,0x0c,0x30,0xb2,0x67,0x0e,0x80,0xd0,0x2b,0x47,0xc3,0xa0,
-0x0d,0x92,0xb8,0x60,0x0a,0xd0,0x6f,0x20,0x06,0x90,0x2e,0x00,0x79,0x0a,0x60,0xd5,
-0xc0,0x04,0xf3,0x00,0x5f,0x40,0x0d,0x3d,0x08,0x80,0x97,0xb3,0x08,0x76,0x80,0xc2,
-0x1d,0x1c,0x00,0xb7,0x70,0x06,0xf2,0x00,0x1d,0x00,0x06,0x70,0x08,0xd1,0x00,0x7d,
-0xdf,0x70,0x02,0xd0,0x00,0xb4,0x00,0x6a,0x00,0x1d,0x10,0x08,0xed,0xd8,0x00,0x82,
-0x06,0x80,0x0a,0x40,0x0a,0x30,0x0c,0x10,0xaa,0x00,0x0c,0x10,0x0a,0x30,0x0a,0x40,
-0x06,0x80,0x00,0x82,0x29,0x01,0x00,0xf5,0x6f,0x14,0x82,0x00,0x2c,0x00,0x0e,0x00,
-0x0d,0x00,0x0b,0x30,0x04,0xf0,0x0b,0x20,0x0d,0x00,0x0e,0x00,0x2c,0x00,0x82,0x00,
-0x0b,0xd6,0x0b,0x13,0x70,0x9e,0x80,0x00,0x00,0xa3,0x00,0x00,0x00,0x0d,0xd3,0x00,
-0xed,0xdd,0xc2,0xd3,0x0d,0x00,0x00,0x02,0xd2,0xd0,0x00,0x00,0x4c,0x1c,0xdd,0xde,
-0x3d,0x10,0x00,0x00,0xdd,0x10,0x00,0x00,0x08,0x20,0x00,0x00,0x02,0xb0,0x00,0x00,
-0x02,0xde,0x00,0x00,0x02,0xd3,0xad,0xdd,0xe2,0xd3,0x00,0x00,0x0d,0x1d,0x50,0x00,
-0x00,0xd0,0x1c,0x5c,0xdd,0xdc,0x00,0x1c,0xf0,0x00,0x00,0x00,0x19,0x00,0x00,0x00,
-0x01,0x10,0x00,0x00,0x2d,0xd2,0x00,0x02,0xd3,0x3d,0x20,0x2d,0x30,0x03,0xd2,0x8d,
-0xe0,0x0e,0xd8,0x00,0xd0,0x0d,0x00,0x04,0x00,0xb8,0xdd,0xdd,0x00,0x00,0x11,0x11,
-0x00,0x00,0xdb,0xbd,0x00,0x18,0x00,0xf3,0x00,0xaf,0xc0,0x0c,0xfa,0x1c,0x50,0x05,
-0xc1,0x01,0xc5,0x5c,0x10,0x00,0x1c,0xc1,0x1b,0x1d,0x40,0x22,0x00,0x00,0x00,0xff,
-0x02,0xf1,0x0f,0x00,0x03,0xee,0x30,0x00,0x00,0x0c,0x77,0xb0,0x00,0x00,0x4e,0x00,
-0xe4,0x00,0x00,0xc5,0x00,0x6c,0x00,0x05,0xe2,0x22,0x2e,0x50,0x0d,0xff,0xff,0xff,
-0xd0,0x2b,0x00,0xf1,0x10,0x01,0x4d,0xd3,0x05,0xd8,0xc3,0x4b,0x3d,0x10,0xff,0xf5,
-0xa5,0x02,0xfe,0x78,0xb2,0x05,0x90,0x2b,0x96,0x00,0x00,0x69,0x2d,0x30,0x03,0xd1,
-0x03,0xcd,0xdc,0x30,0x98,0x00,0xf0,0x1f,0x08,0xcc,0x61,0x00,0x01,0xd3,0xee,0x3d,
-0x10,0x0b,0x70,0x44,0x07,0xb0,0x1a,0x20,0x00,0x01,0xc1,0x1a,0x10,0x00,0x01,0xb1,
-0x0b,0x50,0x00,0x05,0x90,0x04,0xc5,0x00,0x5a,0x60,0x00,0x4a,0xec,0x95,0x00,0x00,
-0x00,0x32,0x00,0x00,0x00,0x10,0x77,0x00,0xf0,0x17,0xeb,0xcd,0x91,0x00,0x1e,0x29,
-0xb1,0x4d,0x30,0x0c,0x90,0xb7,0x02,0xc0,0x0d,0x9c,0xc1,0x00,0xc2,0x0d,0x05,0x10,
-0x00,0xb3,0x0a,0x50,0x00,0x01,0xd0,0x02,0xd3,0x00,0x1b,0x50,0x00,0x2b,0xdd,0xd5,
-0x7f,0x00,0x10,0x00,0xd7,0x00,0xf2,0x11,0x10,0x00,0xef,0xff,0xf4,0x03,0xe0,0x00,
-0xd0,0x07,0x90,0x08,0x70,0x06,0xc0,0x97,0x00,0x4c,0xc5,0xd0,0x00,0x94,0x97,0xb2,
-0x00,0x77,0x00,0xd0,0x00,0x0b,0xcd,0x50,0x56,0x00,0xf0,0x10,0x04,0x43,0x00,0x00,
-0x0f,0xfc,0x00,0x1c,0x98,0x88,0x88,0x18,0x02,0x22,0x09,0x18,0x3b,0xba,0x09,0x08,
-0x15,0x54,0x09,0x08,0x27,0x76,0x09,0x0c,0x99,0x99,0x88,0x1c,0x00,0x31,0x00,0x02,
-0x21,0xd6,0x00,0xf2,0x39,0x20,0x04,0xcf,0xf8,0xb8,0x6f,0x71,0x32,0x91,0xb9,0x00,
-0x00,0x90,0x05,0xa0,0x00,0x90,0x09,0x50,0x00,0x92,0xd4,0x00,0x00,0xb9,0x9d,0x30,
-0x00,0x30,0x08,0xfe,0xfa,0x00,0x00,0x13,0x30,0x14,0x44,0x44,0x41,0x85,0xf8,0x44,
-0x58,0x90,0x62,0x7e,0xf8,0x91,0xf6,0x4d,0xf8,0x90,0x62,0x00,0x08,0x91,0xf6,0x00,
-0x08,0x90,0x83,0x00,0x08,0x90,0xe6,0x00,0x08,0x89,0xfc,0x99,0x98,0x4f,0x01,0xf2,
-0x17,0x3b,0xee,0xb2,0x00,0x04,0xd3,0x99,0x3d,0x40,0x0d,0x20,0x99,0x02,0xd0,0x1c,
-0x00,0x76,0x20,0xc2,0x1b,0x1a,0x97,0xa7,0xc2,0x0c,0xa9,0x51,0x8a,0xd0,0x03,0xf6,
-0x00,0x3d,0x30,0x00,0x2a,0xee,0xa2,0x2c,0x00,0xf1,0x1e,0x03,0xdd,0x90,0x00,0x00,
-0x0d,0x20,0x86,0x02,0x00,0x0d,0x00,0x49,0xef,0xa0,0x09,0x84,0xc9,0xff,0xf0,0x00,
-0xde,0xeb,0xff,0xb0,0x09,0x55,0xff,0xff,0x70,0x0c,0x1f,0xff,0xff,0xe0,0x0e,0xdf,
-0xff,0xff,0xf0,0x00,0x01,0x22,0x22,0x10,0xff,0x00,0x10,0x0a,0x28,0x07,0xf0,0x0d,
-0xa5,0x00,0x9a,0xa9,0x9f,0x60,0x89,0x99,0x99,0x92,0x2e,0xff,0xff,0xfe,0x02,0xd6,
-0x44,0x44,0x00,0x2c,0x20,0x00,0x00,0x01,0x90,0x00,0x00,0x00,0xd3,0x00,0xf0,0x15,
-0x05,0x8a,0x50,0x00,0x00,0x8a,0x76,0x70,0x00,0x08,0x63,0x70,0x00,0x15,0x58,0x50,
-0x00,0x4d,0x21,0x7a,0x00,0x0e,0x88,0xf1,0xf5,0x00,0x9b,0x49,0x2f,0x20,0x00,0x89,
-0x79,0x30,0x00,0x00,0x46,0x08,0xf3,0x01,0xea,0x00,0xd0,0x09,0x6a,0x0d,0x00,0x69,
-0xc2,0xd0,0x00,0x0a,0x2d,0x00,0x00,0xa2,0x07,0x00,0x42,0xed,0xdd,0xde,0x10,0xa0,
-0x00,0x30,0x3a,0x89,0x00,0x15,0x1e,0x20,0xaa,0x30,0x5b,0x00,0xf1,0x0e,0xa0,0x09,
-0x24,0x8c,0xd3,0x90,0x08,0x18,0x66,0x00,0x91,0x08,0x00,0x9f,0x10,0x26,0x08,0x20,
-0x67,0x30,0x45,0x00,0x88,0x89,0x99,0x80,0x00,0x00,0x00,0x52,0x00,0xf5,0x0d,0xe2,
-0x40,0x00,0x00,0x01,0xf4,0xc0,0x00,0x7d,0x7d,0x8d,0x20,0x03,0xb0,0x2e,0x1c,0x20,
-0x08,0x40,0x06,0xf8,0x00,0x0b,0x00,0x00,0xe2,0x00,0x0c,0x05,0x00,0x01,0x01,0x00,
-0xf0,0x45,0x0a,0x80,0x55,0x91,0x1a,0x90,0x04,0x14,0xf9,0x2e,0x70,0x02,0x00,0x00,
-0x1a,0xb5,0x00,0x00,0x09,0xe0,0x08,0xc8,0x10,0x15,0x00,0x00,0x1c,0xcc,0xb0,0x00,
-0x00,0x3c,0x10,0x05,0xd1,0x00,0x41,0x05,0x50,0x44,0x53,0x70,0x16,0x19,0x91,0x00,
-0x56,0x00,0x10,0x05,0xbd,0xcb,0xba,0x00,0x00,0x82,0x06,0x00,0x00,0x0b,0xba,0xe8,
-0x00,0x0a,0xc1,0x74,0x3b,0x08,0x48,0x6a,0x00,0xc0,0xc0,0x8c,0x00,0x3b,0x07,0xca,
-0x73,0x8c,0x20,0x00,0x00,0x33,0x5e,0x03,0xf7,0x0d,0x02,0x60,0x0a,0x30,0x00,0x0d,
-0x20,0x93,0x00,0x00,0x68,0x08,0x40,0x00,0x01,0xc0,0x57,0x05,0x30,0x0d,0x01,0xc0,
-0xc2,0x00,0x40,0x07,0xf8,0x00,0x01,0x00,0x20,0x0b,0xdb,0x2b,0x01,0xf2,0x0e,0x24,
-0x00,0x00,0x00,0x12,0x40,0x00,0x1c,0xba,0xcc,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,
-0x6f,0x70,0x00,0x00,0x8b,0x2c,0x20,0x00,0x79,0x00,0x4d,0xbc,0x6f,0x02,0x10,0xb0,
-0x2d,0x00,0x90,0x36,0x09,0x10,0x8b,0xe8,0x50,0x3c,0x30,0x0b,0x3b,0x00,0xf3,0x01,
-0xda,0xaa,0x91,0x04,0xad,0x00,0x05,0x80,0xc1,0xb0,0x00,0x87,0x05,0xbd,0x0a,0xc6,
-0x52,0x00,0x20,0x08,0x30,0x2a,0x00,0xf7,0x10,0x20,0x07,0x00,0x19,0xae,0xbb,0x35,
-0x80,0x02,0x2a,0x02,0xa0,0xc1,0x00,0x75,0x01,0xa0,0x66,0x00,0xc0,0x03,0x90,0x00,
-0x06,0x80,0x07,0x50,0x00,0x0c,0x16,0xcb,0x82,0x00,0xf3,0x19,0x21,0x00,0x07,0x40,
-0x05,0x69,0x00,0x0a,0x20,0x06,0x50,0x19,0x9e,0xbb,0x36,0x70,0x03,0x3b,0x02,0xb0,
-0xc1,0x00,0x66,0x00,0xb0,0x67,0x00,0xc1,0x02,0xa0,0x00,0x05,0x90,0x06,0x60,0x00,
-0x0b,0x16,0xcc,0x10,0x2f,0x00,0xf1,0x13,0x04,0x80,0x20,0x2b,0xaa,0xeb,0x60,0x00,
-0x00,0x75,0x22,0x3b,0xba,0xbf,0x93,0x00,0x00,0x09,0x30,0x07,0x00,0x5c,0xa0,0x1b,
-0x00,0x00,0x10,0x0d,0x62,0x35,0x00,0x01,0x79,0x97,0x4f,0x02,0xf0,0x04,0x00,0x00,
-0xb0,0x29,0x81,0xab,0xad,0xc8,0x41,0x00,0x00,0x2a,0x03,0x00,0xbb,0xba,0xeb,0x60,
-0x00,0xa3,0x06,0xa0,0x41,0x01,0x9e,0x00,0x0b,0x10,0x02,0x40,0x00,0xa5,0xd6,0x00,
-0x33,0xbc,0xcd,0x50,0x7e,0x02,0xf3,0x31,0xa0,0x00,0x04,0xc2,0x00,0x06,0xb1,0x00,
-0x08,0x90,0x00,0x00,0xb6,0x00,0x00,0x01,0xb7,0x00,0x00,0x00,0xaa,0x00,0x00,0x00,
-0x8b,0x00,0x00,0x00,0x50,0x29,0x00,0x01,0xc0,0x04,0x80,0x00,0x0c,0x00,0x65,0x0a,
-0xcc,0xfc,0x47,0x30,0x00,0x0b,0x00,0x85,0x00,0x00,0xb0,0x07,0xc1,0x00,0x2a,0x00,
-0x6c,0x00,0x08,0x50,0x02,0x80,0x08,0xb0,0xf8,0x01,0x00,0xff,0x00,0x34,0xdc,0xcc,
-0x80,0xdb,0x00,0x00,0xa7,0x02,0xf0,0x09,0x2a,0x00,0x00,0x00,0x2c,0x10,0x00,0x00,
-0x06,0xcd,0xdd,0xc3,0x00,0x01,0xa0,0x00,0x11,0x01,0xb6,0x84,0x49,0x99,0x9d,0x40,
-0x24,0x01,0x90,0x01,0x00,0x27,0x90,0x1b,0x00,0x26,0x60,0x2b,0x38,0x00,0xc0,0xca,
-0xab,0x30,0x00,0x02,0x10,0x00,0xc2,0x00,0x00,0x0b,0x10,0x6f,0x01,0x00,0x24,0x02,
-0x24,0x00,0xc0,0x07,0x00,0xf9,0x04,0x05,0x8a,0x40,0x05,0xd2,0x2c,0xdd,0x91,0x00,
-0xd1,0x00,0x24,0x0c,0x00,0x74,0xb0,0xc0,0x00,0x82,0x20,0x00,0x91,0x06,0x7b,0x30,
-0x06,0xd1,0x2c,0xdd,0x81,0x00,0x11,0x00,0xd0,0x19,0x99,0xae,0xaa,0xa0,0x03,0x22,
-0x1c,0x11,0x10,0x00,0x05,0xbe,0x13,0x00,0xf3,0x01,0x06,0x60,0x00,0x00,0x08,0xad,
-0x70,0x00,0x00,0x00,0x4f,0x10,0x00,0x00,0x09,0xd3,0x9d,0x00,0x00,0x07,0x00,0xf1,
-0x1b,0x40,0x00,0x00,0x0a,0x29,0x64,0x08,0x99,0x9d,0xbb,0xa1,0x04,0x32,0x2a,0x42,
-0x20,0x00,0x05,0xbe,0x20,0x00,0x00,0x0c,0x07,0x50,0x00,0x00,0x0b,0x2a,0x60,0x00,
-0x00,0x02,0x9e,0x30,0x00,0x00,0x01,0x99,0x00,0x00,0x00,0x9a,0x0a,0x30,0x15,0x00,
-0x09,0xd5,0x00,0xb0,0x0b,0x00,0x02,0x5c,0x67,0x9e,0xb7,0x2a,0x9c,0x53,0x2b,0x35,
-0x22,0x91,0x1a,0x00,0x00,0x2a,0x06,0xb5,0x00,0x00,0x1c,0x03,0x01,0xf0,0x09,0xcc,
-0xcc,0x60,0x00,0x5a,0xab,0xc1,0x00,0x01,0x11,0xb5,0x00,0x00,0x02,0xb3,0x00,0x00,
-0x36,0xe9,0x89,0xa5,0x19,0x76,0xc5,0xe0,0x0c,0x00,0x48,0x00,0xb1,0x20,0x00,0x00,
-0x00,0x3c,0x63,0x00,0x00,0x00,0x27,0x81,0x12,0x00,0xe0,0x03,0x3b,0x89,0x00,0x00,
-0x78,0xe5,0x30,0x00,0x00,0x1b,0x07,0xbb,0xa0,0xac,0x00,0x80,0x00,0xb2,0x14,0x00,
-0x00,0x2c,0x03,0x90,0xec,0x0b,0x23,0xcc,0xc0,0x5a,0x01,0xa0,0x20,0x03,0x70,0x01,
-0x1c,0x56,0x08,0x63,0x0a,0xbe,0x46,0x00,0x60,0x39,0x08,0xbb,0x60,0x00,0x84,0x19,
-0x00,0x20,0xd0,0x22,0xc2,0x01,0x81,0x66,0x00,0x00,0x0b,0x40,0x2c,0xbb,0x90,0xd8,
-0x00,0xf2,0x05,0x02,0x7b,0xbc,0xa0,0x1a,0x51,0x00,0x86,0x00,0x00,0x00,0x57,0x00,
-0x00,0x03,0xc2,0x00,0x1c,0xc9,0x20,0xea,0x01,0x90,0x69,0xa5,0x00,0x19,0xd9,0x42,
-0x19,0x80,0x05,0x39,0x00,0x00,0x12,0x00,0x10,0xe0,0x6f,0x0b,0x93,0x90,0x00,0x00,
-0x14,0xab,0x00,0x00,0x07,0xb9,0xc6,0x01,0x81,0x78,0xab,0xce,0xd9,0x05,0x31,0x2a,
-0x10,0x5f,0x01,0x00,0xcc,0x08,0x03,0xdb,0x00,0x10,0xa8,0x87,0x02,0x26,0x7d,0xb0,
-0xbe,0x02,0x50,0x07,0x8a,0xbc,0xed,0x90,0x2a,0x00,0xd1,0x40,0x00,0x00,0xb0,0x09,
-0x71,0x00,0x02,0xa0,0x02,0x00,0x00,0x01,0x21,0x00,0x11,0xb7,0xb5,0x00,0x13,0xda,
-0xe7,0x03,0x00,0x03,0x02,0xd2,0x80,0x04,0x90,0x00,0xd3,0xb9,0x10,0x00,0xaa,0x20,
-0x00,0x08,0x70,0x5b,0x00,0x81,0x0d,0x10,0x00,0x00,0x04,0xcc,0xcd,0xd2,0x25,0x00,
-0x20,0x05,0x50,0x1e,0x01,0xc0,0x74,0x01,0x00,0x0a,0xbe,0x73,0x2c,0x60,0x00,0x57,
-0x00,0x30,0xf0,0x01,0xf2,0x15,0xc0,0x00,0x0a,0x60,0x79,0xd0,0x00,0x04,0x09,0x51,
-0xdc,0x20,0x00,0x0b,0x10,0xc4,0xc0,0x00,0x03,0xbd,0x60,0x00,0x36,0x00,0x00,0x00,
-0x66,0x06,0xcc,0xc7,0x83,0x00,0x00,0x00,0xa1,0x00,0xa0,0x03,0xd1,0xb9,0x09,0x00,
-0x00,0xa9,0x0d,0x10,0x01,0x85,0x05,0xcc,0xda,0x11,0x7e,0x00,0xf0,0x11,0xbd,0xa3,
-0x00,0x01,0xc4,0x67,0x1b,0x40,0x0a,0x30,0x93,0x01,0xc0,0x0c,0x00,0xc0,0x00,0xc0,
-0x0c,0x02,0xb0,0x00,0xd0,0x0c,0x5c,0x30,0x07,0x80,0x02,0xa5,0x05,0xba,0x75,0x00,
-0xf0,0x01,0x20,0x00,0x35,0x00,0x02,0x70,0x07,0x50,0x00,0x29,0x00,0x92,0x09,0xbc,
-0xeb,0x3b,0xd0,0x01,0xf3,0x03,0xb0,0x00,0x01,0xa0,0x0b,0x80,0x38,0xac,0x00,0xb9,
-0x0d,0x12,0xdb,0x48,0x50,0x9b,0xd5,0x02,0x2e,0x02,0x00,0x20,0x01,0x10,0x1d,0x82,
-0x06,0x80,0xc4,0x0c,0x40,0x00,0x0a,0x70,0x01,0xd2,0xe1,0x02,0x20,0x2d,0x20,0x5a,
-0x01,0x01,0xc4,0x00,0x23,0x31,0x00,0xcc,0x06,0xf1,0x06,0x53,0x90,0x00,0x1c,0xd2,
-0x19,0x40,0x00,0xb5,0x2d,0x10,0x00,0x09,0x80,0x04,0xc0,0x00,0x3b,0x00,0x00,0x6b,
-0x32,0x01,0x01,0x1d,0x01,0x10,0x61,0xb5,0x02,0x40,0x09,0xba,0xeb,0xb4,0x08,0x00,
-0x40,0x0b,0xba,0xeb,0xb6,0x08,0x00,0xe0,0x02,0x8a,0xd2,0x00,0x0c,0x20,0xdb,0x90,
-0x0d,0x33,0xb0,0x68,0x02,0x89,0xc8,0x05,0x60,0x12,0x00,0x00,0x00,0x5a,0x9e,0x75,
-0x00,0x10,0x2b,0x36,0x00,0xf0,0x07,0xa4,0x02,0x90,0x01,0xab,0xda,0xa9,0x80,0x0a,
-0x18,0x50,0x0a,0xe4,0x0b,0x3c,0x00,0x0c,0x13,0x06,0xb2,0x01,0xb4,0x55,0x00,0x12,
-0x20,0x4f,0x01,0xf0,0x02,0x09,0x8e,0xb8,0x1a,0x00,0x02,0x3c,0x00,0x04,0xb0,0x03,
-0xac,0x00,0x00,0x30,0x0a,0x0c,0x7b,0x01,0xd4,0x4b,0x00,0x07,0x20,0x02,0xa7,0x00,
-0x0a,0x30,0x00,0x2d,0x99,0xca,0xe7,0x07,0x21,0x06,0x00,0x91,0x04,0xf0,0x0a,0x0a,
-0x9b,0xdd,0xa1,0x00,0xc9,0x0b,0x05,0xa0,0x94,0xc4,0x90,0x0b,0x0b,0x05,0xe1,0x00,
-0xb1,0xb1,0x9d,0x20,0x3c,0x04,0xa5,0x03,0x49,0x05,0x14,0x44,0xe6,0x01,0xc0,0x75,
-0x00,0x00,0x04,0x28,0x31,0x00,0x00,0x59,0xeb,0xa1,0x00,0xfb,0x02,0xf2,0x07,0x00,
-0xab,0xeb,0xb1,0xb2,0x00,0x0c,0x00,0x04,0x80,0x00,0xd0,0x00,0x49,0x00,0x0b,0x83,
-0x5d,0x30,0x00,0x07,0x97,0xa3,0x04,0x80,0x8c,0x86,0x10,0x02,0x00,0x36,0x10,0x0a,
-0x92,0x00,0xf4,0x04,0x05,0x89,0x40,0x0d,0xb5,0x23,0xb4,0x0b,0x10,0x00,0x58,0x00,
-0x00,0x01,0xb4,0x00,0x9b,0xcc,0x50,0x52,0x00,0xf0,0x00,0x01,0x00,0x93,0xaa,0xc1,
-0xb9,0x20,0x49,0xc6,0x00,0x0c,0xd1,0x00,0x0d,0xb0,0xe0,0x00,0xf3,0x1b,0xb4,0x01,
-0x5c,0x70,0x05,0x71,0x00,0x00,0x12,0x23,0x00,0x05,0x99,0xae,0x30,0x00,0x03,0xa1,
-0x00,0x00,0x7e,0x98,0x20,0x1b,0x83,0x03,0xc2,0x64,0x17,0x30,0x48,0x00,0xb3,0xb2,
-0x67,0x00,0xc4,0x6c,0xd1,0x00,0x16,0x86,0x45,0x00,0x10,0x0d,0x10,0x05,0xf3,0x14,
-0x6e,0x14,0x96,0x00,0x07,0x5d,0x97,0x1c,0x10,0x00,0x2f,0x40,0x0b,0x10,0x00,0xca,
-0x00,0x0c,0x00,0x08,0x8a,0x00,0x0c,0x00,0x0b,0x1a,0x00,0x0c,0x04,0x00,0x2a,0x00,
-0x0a,0xd7,0x00,0xbd,0x01,0x03,0x32,0x00,0x20,0x00,0x1d,0xa1,0x05,0xf2,0x0e,0xae,
-0x29,0xbb,0x50,0x00,0x1e,0xa2,0x00,0xb4,0x00,0xba,0x00,0x00,0x58,0x07,0x8a,0x00,
-0x00,0x85,0x0a,0x1a,0x00,0x28,0xb0,0x00,0x2a,0x03,0xb6,0x00,0x32,0x00,0xa0,0x06,
-0x50,0x00,0x00,0xab,0xec,0xbb,0x20,0x00,0x39,0x43,0x04,0xf0,0x09,0x9a,0x45,0xb7,
-0x0a,0x70,0x5e,0x71,0x00,0x40,0x97,0xb0,0x00,0x00,0x39,0x07,0x00,0x00,0x01,0xca,
-0x9a,0xb1,0x00,0x00,0x02,0xf6,0x00,0x10,0x43,0x2f,0x00,0x10,0xd1,0x71,0x02,0x13,
-0x70,0x60,0x00,0xf2,0x05,0x00,0x9d,0xc9,0x00,0x00,0x02,0xe2,0x0c,0x00,0x52,0x09,
-0x50,0x0c,0x01,0xc0,0x0d,0x00,0x07,0xdd,0x40,0x49,0x07,0xe1,0xaa,0xaa,0xa4,0x01,
-0x13,0x22,0xc1,0x00,0x09,0x4b,0x40,0x00,0x0b,0x12,0x58,0x03,0x63,0x02,0xc3,0x00,
-0x00,0x04,0x20,0x29,0x03,0xf3,0x01,0xcc,0xcc,0xcc,0xf1,0x00,0x02,0x00,0x96,0x00,
-0x00,0xa3,0x99,0x00,0x00,0x0c,0x24,0xa8,0x03,0x50,0x69,0x00,0x00,0x00,0x7c,0xaf,
-0x02,0x03,0x89,0x02,0xe0,0x80,0x00,0x00,0x3c,0x40,0x00,0x19,0xe2,0x00,0x3b,0xb5,
-0xc0,0x00,0x11,0x09,0x05,0x00,0x04,0x00,0x21,0x01,0xc0,0x48,0x03,0xf3,0x03,0x40,
-0x00,0x00,0x07,0xc1,0x00,0x00,0x2b,0x80,0x00,0x04,0xab,0xe0,0x00,0x0c,0x93,0x0d,
-0x00,0x46,0x00,0x14,0x0d,0xf2,0x03,0x12,0x04,0x0d,0x00,0xd0,0x11,0x1d,0x11,0x20,
-0xc9,0x99,0x99,0xd5,0xc0,0x00,0x00,0xb2,0xc0,0x15,0x10,0x00,0x16,0x10,0x61,0x00,
-0x6a,0x00,0x00,0x5c,0x90,0xa4,0x02,0x10,0x00,0x7a,0x02,0x40,0xbe,0xcb,0x90,0x00,
-0xcf,0x01,0x03,0x04,0x00,0x50,0x8c,0xce,0xcc,0xc3,0x00,0x6c,0x02,0x41,0xcc,0xcc,
-0xcc,0x50,0x15,0x00,0x10,0x00,0xc5,0x08,0x06,0x09,0x00,0x50,0x30,0x00,0x4c,0xcc,
-0xcc,0xbd,0x07,0xf1,0x08,0x07,0x00,0x08,0xbb,0xbe,0xb9,0x00,0x00,0xab,0x00,0x00,
-0x08,0x6b,0x00,0x01,0xb8,0x0b,0x00,0x0c,0x60,0x0b,0x00,0x00,0x77,0x03,0x12,0x00,
-0xaa,0x05,0x00,0xb6,0x00,0xf1,0x04,0x6c,0xbb,0xdf,0xbc,0x20,0x00,0x1c,0xc0,0x00,
-0x00,0x2c,0x3c,0x00,0x00,0x7c,0x20,0xc0,0x00,0x97,0x1b,0x00,0x26,0x8b,0xb0,0xb6,
-0x01,0x00,0x11,0x00,0xf2,0x08,0x9c,0xbf,0xbb,0xc9,0x00,0x1b,0x00,0x39,0x00,0x57,
-0x00,0x48,0x00,0xc1,0x00,0x56,0x0a,0x80,0x00,0x94,0x99,0x00,0xac,0x91,0x0a,0x02,
-0x82,0x06,0xf0,0x0a,0xd0,0x09,0x73,0x00,0x00,0xc0,0x04,0x20,0x0b,0xcc,0xeb,0xbd,
-0x40,0x00,0x03,0x80,0x08,0x40,0x00,0x08,0x50,0x09,0x30,0x00,0x1d,0x81,0x04,0x10,
-0xc5,0x8e,0x0b,0x33,0x70,0x0d,0xd9,0x2f,0x00,0x10,0x29,0x5a,0x00,0xf2,0x03,0x36,
-0x90,0x9c,0xce,0x96,0x30,0x20,0x09,0x30,0x00,0x00,0x18,0xa8,0xbb,0xac,0xb9,0xc3,
-0x10,0x29,0x01,0x00,0x13,0x0b,0x13,0x41,0xcb,0x03,0xf5,0x12,0x0d,0x20,0x00,0x00,
-0x07,0xeb,0xbb,0x60,0x04,0xb0,0x00,0x95,0x06,0xb1,0x00,0x0d,0x00,0x40,0x00,0x09,
-0x60,0x00,0x00,0x06,0xb0,0x00,0x00,0x19,0xa0,0x00,0x00,0x8d,0x60,0x4d,0x06,0x00,
-0x01,0x00,0xf0,0x07,0x60,0x06,0x82,0x00,0x07,0x91,0x16,0x42,0x00,0x2d,0x99,0x9f,
-0x20,0x02,0xc2,0x00,0x2c,0x00,0x1c,0x20,0x00,0x95,0x73,0x01,0x22,0xb0,0x00,0x27,
-0x0f,0x21,0x29,0xc1,0x0d,0x03,0x03,0x16,0x05,0x02,0x2f,0x02,0x50,0x8d,0xcd,0xec,
-0xc4,0x04,0x66,0x07,0x43,0x0b,0x10,0x07,0x60,0x18,0x05,0x20,0x00,0x89,0x66,0x01,
-0x12,0xb0,0xcf,0x07,0x12,0x00,0x59,0x04,0xf0,0x08,0x18,0x00,0x08,0x82,0x00,0x58,
-0x00,0x04,0x21,0x00,0xcd,0xcc,0xcc,0xc0,0x07,0x80,0x09,0x30,0x00,0x3c,0x00,0x0c,
-0x10,0x65,0x07,0x00,0x21,0x00,0x00,0x56,0x00,0x20,0x1a,0x80,0xa7,0x06,0x00,0x44,
-0x00,0x33,0xcc,0xcc,0xc9,0x82,0x07,0x05,0x04,0x00,0x82,0x01,0x00,0x00,0x3a,0x2c,
-0xbb,0xbb,0xca,0xfd,0x08,0x00,0xda,0x02,0x00,0xc0,0x12,0x90,0x1c,0xcf,0xbb,0xce,
-0xc7,0x00,0x0c,0x00,0x48,0x0f,0x00,0x10,0x57,0x1d,0x04,0x10,0x94,0x76,0x00,0x10,
-0xd0,0xcf,0x03,0x16,0x20,0xdc,0x07,0x00,0x07,0x29,0xe0,0xa6,0x71,0x00,0xa2,0x00,
-0xc3,0x31,0x9c,0xec,0xbc,0xfc,0xa0,0x00,0xa2,0x74,0x02,0x10,0xa2,0xef,0x05,0x30,
-0x51,0x05,0x80,0xa5,0x01,0x53,0x20,0x00,0x00,0x04,0xc5,0x97,0x0c,0x23,0x02,0x60,
-0xbf,0x00,0x60,0x30,0x02,0x00,0x01,0x07,0xc3,0xc2,0x0b,0xf2,0x00,0x40,0x00,0xc4,
-0x00,0x00,0x03,0xd5,0x00,0x00,0x18,0xd2,0x00,0x03,0xcd,0x60,0x68,0x03,0x00,0xb1,
-0x09,0xf2,0x07,0x12,0x90,0x00,0x2b,0x90,0x0a,0x53,0x02,0x00,0x30,0x02,0x10,0x0a,
-0xb1,0x00,0x02,0xc0,0x00,0x43,0x00,0x1c,0x30,0x2c,0x00,0x60,0x01,0x8c,0x20,0x00,
-0x04,0xbd,0x65,0x01,0x02,0x23,0x03,0x00,0x1a,0x0a,0x21,0xcd,0xc0,0xaa,0x02,0x00,
-0xf5,0x00,0x00,0x53,0x00,0xc3,0x1c,0x8c,0x10,0x04,0xd4,0x04,0xd1,0xab,0x20,0x00,
-0x5b,0x10,0x8d,0x01,0x10,0x30,0x7d,0x00,0x60,0x64,0x04,0xcc,0xcc,0xca,0x10,0x39,
-0x05,0x00,0xcf,0x00,0x13,0xb0,0xcc,0x01,0x21,0x01,0xcb,0x3d,0x03,0x80,0x98,0x00,
-0x0a,0xb2,0x00,0x0b,0x70,0x03,0xf8,0x0b,0x22,0x00,0x0d,0x8b,0x02,0xf3,0x03,0x34,
-0x01,0x3e,0x9c,0xbc,0x84,0xc9,0xe2,0x01,0xc0,0x00,0x0c,0x00,0xb3,0x00,0x00,0xc0,
-0x02,0x34,0x03,0x30,0x8d,0xcd,0xd5,0x07,0x00,0x80,0x40,0x00,0x0a,0x00,0x08,0x56,
-0x00,0x0d,0x09,0x06,0xd0,0x0d,0x69,0xcd,0x90,0x4c,0xce,0x52,0x0c,0x10,0x00,0x0c,
-0x00,0xa5,0x39,0x01,0x13,0x40,0x2c,0x00,0x81,0x0b,0xba,0xbd,0x50,0x00,0x00,0x12,
-0x10,0xde,0x09,0xd0,0x87,0x00,0x00,0x95,0x0d,0x10,0x00,0xd1,0x06,0x70,0x03,0xb0,
-0x00,0xeb,0x13,0x93,0x00,0x7a,0x00,0x00,0x07,0xc0,0x00,0x01,0xd8,0x5e,0x02,0x30,
-0x00,0x00,0x14,0x0a,0x02,0x70,0x63,0x92,0x00,0x00,0x81,0x04,0xc0,0xa3,0x02,0x50,
-0x50,0x03,0xa0,0x00,0x10,0x7e,0x00,0x00,0x89,0x03,0x60,0x00,0x6c,0x00,0x00,0x02,
-0xba,0x26,0x07,0x06,0xc5,0x04,0x12,0x10,0x90,0x02,0xc0,0x03,0xb0,0x00,0x95,0x05,
-0xc2,0x50,0x1d,0x00,0x60,0x08,0xca,0xe0,0x08,0x95,0xf9,0x00,0x00,0x08,0xa0,0x30,
-0x00,0x7d,0x70,0x31,0x02,0xf0,0x0b,0x01,0x50,0x00,0x02,0xc0,0x08,0x55,0x00,0x0c,
-0xdb,0xbc,0x40,0x00,0x87,0x00,0x0d,0x10,0x08,0x93,0x20,0x4a,0x00,0x16,0x02,0xb9,
-0xc1,0x47,0x00,0xa1,0xe4,0x00,0x00,0x01,0xc6,0x12,0x00,0x01,0x9c,0x40,0xda,0x00,
-0x01,0x38,0x08,0x80,0x68,0x00,0x02,0xbb,0xbc,0x52,0x00,0x00,0x1a,0x02,0x51,0x1c,
-0xbb,0xce,0xbb,0xc1,0x41,0x08,0x11,0x00,0x10,0x02,0x10,0x04,0x5d,0x04,0x24,0x5c,
-0x10,0xdd,0x09,0xc0,0x08,0x00,0x31,0x1c,0x08,0x40,0xa3,0x09,0x32,0x40,0xd0,0x01,
-0x8d,0x01,0x00,0xdf,0x06,0x31,0x2a,0xa0,0x00,0x94,0x08,0x00,0x4f,0x00,0xc0,0xa0,
-0x0d,0x00,0x1d,0x08,0x50,0x85,0x05,0x80,0x2b,0x01,0x10,0xcd,0x00,0xe3,0x4a,0x00,
-0x00,0x00,0x3d,0x20,0x00,0x00,0x5d,0x20,0x00,0x02,0xda,0x10,0xfc,0x01,0x83,0x21,
-0x11,0x12,0x00,0x00,0x8a,0x99,0x9a,0x11,0x04,0x51,0xcc,0xcd,0xcc,0xc2,0x00,0x70,
-0x05,0x24,0x00,0x67,0x54,0x05,0x10,0x2c,0x34,0x06,0x14,0x13,0x02,0x03,0x00,0x98,
-0x05,0x61,0x57,0x00,0xbb,0xbb,0xb5,0x51,0x10,0x00,0x53,0x2c,0xcc,0xcc,0xcc,0xc0,
-0xa4,0x00,0x10,0x85,0x96,0x00,0x14,0xd0,0x32,0x00,0x12,0x33,0xf3,0x04,0x10,0xd0,
-0xb9,0x11,0x84,0x00,0xdb,0xc7,0x00,0xd0,0x18,0xe1,0xd0,0x12,0x00,0x01,0x50,0x04,
-0xf2,0x05,0x37,0x10,0xd0,0x09,0x36,0x0d,0x00,0x11,0x00,0xed,0x93,0x00,0x0d,0x05,
-0xbc,0x00,0xd0,0x00,0x20,0x0d,0x1e,0x05,0x12,0x03,0xbf,0x0d,0x12,0x00,0x35,0x03,
-0xb0,0x0a,0x99,0xae,0x99,0xa2,0x02,0x22,0x5b,0x22,0x20,0x00,0xc7,0x06,0x00,0x3e,
-0x15,0x02,0xfd,0x03,0x24,0x00,0x7b,0x0c,0x01,0x70,0x02,0xba,0xaa,0xab,0x00,0x02,
+0x00,0x26,0x12,0xf8,0xff,0xff,0xda,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,
+0x0c,0x0d,0x0e,0x0f,0x10,0x00,0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,0x1a,
+0x1b,0x1c,0x1d,0x00,0x1e,0x1f,0x00,0x20,0x21,0x22,0x23,0x24,0x25,0x00,0x26,0x27,
+0x28,0x29,0x2a,0x00,0x00,0x04,0x00,0x0d,0x00,0x11,0x1d,0x1b,0x1d,0x1c,0x1d,0x1e,
+0x1d,0x32,0x1d,0x3e,0x1d,0x68,0x1d,0x97,0x1d,0xe7,0x1d,0xe9,0x1d,0x07,0x1e,0x0c,
+0x1e,0x5e,0x1e,0x5f,0x1e,0x64,0x1e,0x6d,0x1e,0x90,0x1e,0xee,0x1e,0xf2,0x1e,0xff,
+0x1e,0x1e,0x1f,0x35,0x1f,0x60,0x1f,0x6d,0x1f,0x85,0x1f,0xaa,0x1f,0xe0,0x1f,0x54,
+0x20,0x56,0x20,0x59,0x20,0x76,0x20,0x79,0x20,0x7d,0x20,0x82,0x20,0x88,0x20,0x96,
+0x20,0x97,0x20,0x9e,0x20,0x0b,0x21,0x17,0x21,0x2e,0x21,0x36,0x21,0x3a,0x21,0x4c,
+0x21,0x5b,0x21,0x5e,0x21,0x83,0x21,0xac,0x21,0xb0,0x21,0xb1,0x21,0xca,0x21,0xe6,
+0x21,0x27,0x22,0x69,0x22,0xcc,0x22,0xe8,0x22,0x04,0x23,0x08,0x23,0x19,0x23,0x1d,
+0x23,0x1e,0x23,0x22,0x23,0x37,0x23,0x3c,0x23,0x5b,0x23,0x79,0x23,0x60,0x24,0x79,
+0x25,0xef,0x25,0x03,0x26,0x0b,0x26,0x0e,0x26,0x38,0x26,0x39,0x26,0x58,0x26,0xdc,
+0x26,0x42,0x27,0x68,0x27,0xa8,0x27,0x01,0x28,0x1a,0x28,0x27,0x28,0x2b,0x28,0x38,
+0x28,0x3f,0x28,0x42,0x28,0x79,0x28,0x69,0x2a,0x9d,0x2a,0xab,0x2a,0xb0,0x2a,0xca,
+0x2a,0x0f,0x2b,0x20,0x2b,0x22,0x2b,0xf7,0x2c,0xff,0x2c,0x49,0x2d,0x84,0x2d,0xb7,
+0x2d,0xb8,0x2d,0x07,0x2e,0x20,0x2e,0x42,0x2e,0x46,0x2e,0x48,0x2e,0x64,0x2e,0x73,
+0x2e,0x82,0x2e,0x96,0x2e,0x9d,0x2e,0xba,0x2e,0xbf,0x2e,0xd6,0x2e,0xed,0x2e,0x36,
+0x2f,0xd6,0x2f,0x04,0x30,0x20,0x30,0x5c,0x30,0x21,0x31,0x5c,0x31,0xaf,0x31,0xcd,
+0x31,0xe3,0x31,0xf2,0x31,0x12,0x32,0x50,0x32,0xb6,0x32,0xb9,0x32,0xd4,0x32,0xec,
+0x32,0xde,0x33,0x68,0x34,0x81,0x34,0x98,0x34,0xc1,0x34,0xca,0x34,0xf3,0x34,0xf6,
+0x34,0x1f,0x35,0x53,0x35,0x80,0x35,0x05,0x36,0x09,0x36,0x11,0x36,0x1a,0x36,0x30,
+0x36,0x3b,0x36,0x3c,0x36,0x3d,0x36,0x72,0x36,0xb1,0x36,0x4d,0x37,0x2d,0x38,0x86,
+0x38,0x93,0x38,0xdc,0x38,0x2a,0x39,0x70,0x39,0x73,0x3a,0x74,0x3a,0x9c,0x3a,0xdf,
+0x3a,0xe5,0x3a,0x28,0x3b,0x71,0x3b,0xe6,0x3b,0xf3,0x3b,0x99,0x3c,0x2c,0x3d,0x3a,
+0x3d,0xa1,0x3d,0xa7,0x3d,0x25,0x3e,0x81,0x3e,0x32,0x40,0xc7,0x41,0x98,0x42,0x0f,
+0x43,0x17,0x43,0x30,0x44,0x39,0x44,0x4c,0x44,0x7b,0x44,0x8c,0x45,0x51,0x46,0xcb,
+0x47,0x4b,0x48,0xe3,0x48,0x01,0x49,0x0c,0x49,0x8b,0x49,0x92,0x49,0x00,0x4a,0x3d,
+0x4a,0x65,0x4a,0xa8,0x4a,0xb2,0x4a,0xd5,0x4a,0xcf,0x4b,0x31,0x4c,0x33,0x4c,0x41,
+0x4c,0x53,0x4c,0x5d,0x4c,0x82,0x4c,0xaa,0x4c,0xab,0x4c,0xdb,0x4c,0xe2,0x4c,0xeb,
+0x4c,0xf9,0x4c,0x7f,0x4e,0x83,0x4e,0x14,0x4f,0x16,0x4f,0xdd,0x4f,0x0e,0x50,0xfb,
+0x50,0x80,0x51,0x83,0x51,0x46,0x54,0x5d,0x57,0x6e,0x57,0x79,0x57,0x81,0x57,0xd6,
+0x57,0x0e,0x58,0x18,0x58,0x92,0x58,0x9c,0x58,0xa0,0x58,0xa7,0x58,0xf4,0x58,0x11,
+0x59,0x19,0x59,0x29,0x59,0x3e,0x59,0x4d,0x59,0x83,0x59,0x84,0x59,0x9e,0x59,0xaf,
+0x59,0xbd,0x59,0xbe,0x59,0xe7,0x59,0x69,0x5a,0x77,0x5a,0xcc,0x5b,0xcd,0x5b,0x75,
+0x5c,0x88,0x5c,0x96,0x5c,0xee,0x5c,0x09,0x5e,0x14,0x5e,0x2e,0x5e,0xcd,0x5e,0x0e,
+0x5f,0x12,0x5f,0x2b,0x5f,0x30,0x5f,0x56,0x5f,0x5f,0x5f,0x7a,0x5f,0x89,0x5f,0xf9,
+0x5f,0xe0,0x60,0x43,0x62,0x88,0x64,0x9c,0x64,0xa4,0x64,0x75,0x65,0xd7,0x65,0xf3,
+0x65,0x0c,0x66,0x63,0x66,0x6f,0x66,0x73,0x66,0xe4,0x66,0x04,0x67,0x17,0x67,0x5d,
+0x67,0xec,0x67,0xe9,0x69,0x12,0xbf,0x19,0xbf,0x1c,0xbf,0x1d,0xbf,0x1e,0xbf,0x22,
+0xbf,0x24,0xbf,0x26,0xbf,0x2a,0xbf,0x2d,0xbf,0x32,0xbf,0x37,0xbf,0x38,0xbf,0x39,
+0xbf,0x4f,0xbf,0x54,0xbf,0x59,0xbf,0x5c,0xbf,0x5d,0xbf,0x5e,0xbf,0x62,0xbf,0x63,
+0xbf,0x64,0xbf,0x65,0xbf,0x78,0xbf,0x79,0xbf,0x7f,0xbf,0x81,0xbf,0x82,0xbf,0x85,
+0xbf,0x88,0xbf,0x89,0xbf,0x8a,0xbf,0x8c,0xbf,0xa4,0xbf,0xa6,0xbf,0xd5,0xbf,0xd6,
+0xbf,0xd8,0xbf,0xda,0xbf,0xf1,0xbf,0xf8,0xbf,0xfb,0xbf,0x04,0xc0,0x2d,0xc0,0x35,
+0xc0,0x6c,0xc0,0xfc,0xc0,0x51,0xc1,0x52,0xc1,0x53,0xc1,0x54,0xc1,0x55,0xc1,0x98,
+0xc1,0xa4,0xc1,0xfe,0xc1,0x15,0xc2,0x6b,0xc4,0xd3,0xc6,0xb3,0xc7,0x00,0x01,0x00,
+0x2f,0xfd,0x00,0x01,0x00,0x56,0x13,0xf8,0x08,0x00,0x17,0xf7,0x14,0x00,0xbf,0xfc,
+0xfb,0x00,0xfe,0xfb,0x00,0xfa,0x00,0x00,0x00,0x01,0x85,0x00,0x53,0x4f,0x02,0x01,
+0x00,0x02,0x69,0x00,0x52,0x2f,0xf3,0x00,0x01,0x00,0x68,0x1f,0xef,0x71,0x00,0x5d,
+0x03,0xd4,0x01,0xb1,0xfb,0x00,0xff,0x00,0x00,0xf6,0xff,0xf9,0xfb,0x00,0xf9,0x11,
+0x00,0x00,0x0f,0x00,0x4f,0xff,0xff,0xfc,0xfd,0xde,0x01,0x51,0x6f,0xfe,0x00,0xfe,
+0x00,0x00,0xfc,0xf0,0x00,0x54,0x1c,0xfe,0x0a,0x00,0x19,0xff,0x1f,0x00,0x1f,0xff,
+0x45,0x03,0x4a,0x13,0xfe,0xee,0x00,0x3f,0xfe,0xfd,0xfe,0xe8,0x01,0x5d,0x15,0x02,
+0xe2,0x00,0x11,0xff,0xe5,0x00,0x2f,0xff,0xfe,0x83,0x00,0x4a,0x11,0xee,0x49,0x03,
+0x15,0xeb,0x77,0x00,0x00,0xf1,0x00,0x13,0xfe,0x04,0x00,0x0f,0x01,0x00,0x4c,0x13,
+0x01,0x69,0x01,0x1f,0x01,0x64,0x01,0x5b,0x1f,0xfe,0x2e,0x04,0x60,0x1b,0xfb,0x78,
+0x00,0x12,0xfe,0x60,0x01,0x3f,0xfe,0xfd,0xfb,0x72,0x00,0x45,0x14,0xe6,0x65,0x01,
+0x97,0xfb,0x00,0x00,0xeb,0xfc,0xf2,0xf5,0x00,0xed,0x92,0x06,0x2f,0xf6,0xf9,0xed,
+0x00,0x49,0x75,0xe7,0x00,0x00,0x00,0xf5,0x00,0xf0,0x33,0x04,0x21,0xff,0xff,0xaf,
+0x03,0x1f,0x01,0x81,0x06,0x54,0x10,0xfd,0x5c,0x01,0x1f,0xfd,0xe3,0x01,0x5e,0x3f,
+0xfa,0x00,0xff,0x1d,0x05,0x54,0x11,0xfd,0x80,0x06,0xa1,0xee,0x00,0x00,0xfa,0xfe,
+0xed,0xff,0x01,0x00,0x01,0x59,0x01,0xdf,0xf7,0xf8,0x00,0xf7,0xf8,0xfa,0xf7,0x00,
+0xf9,0xfa,0xfc,0xfa,0xfb,0x9c,0x04,0x47,0x66,0xee,0xfd,0x00,0x00,0xfa,0xff,0xc3,
+0x03,0x50,0xfc,0xfd,0x00,0x00,0xfc,0x2f,0x04,0x1f,0xff,0x61,0x08,0x48,0x42,0x01,
+0x00,0xf6,0xfb,0xf7,0x00,0x13,0x01,0x11,0x00,0x04,0xa6,0x04,0x2f,0xff,0x00,0xd8,
+0x08,0x4b,0x14,0xfc,0xb8,0x03,0x15,0x01,0x3c,0x04,0x2f,0xfe,0x00,0x1d,0x05,0x4b,
+0xf0,0x00,0xfe,0x02,0xfc,0xf0,0xfc,0x00,0x00,0xf9,0xfe,0xf9,0xff,0x01,0xf9,0x01,
+0x01,0xde,0x01,0x90,0xfa,0xfb,0xfe,0xfd,0xfb,0xfd,0xfb,0xfe,0xfd,0x37,0x04,0x1f,
+0x01,0x64,0x02,0x4a,0x09,0x8c,0x05,0x03,0xee,0x00,0x0f,0x82,0x06,0x4c,0x06,0xc7,
+0x08,0x0f,0x8f,0x05,0x5a,0x0f,0x8a,0x00,0x09,0x0f,0x7a,0x06,0x61,0x11,0xff,0x28,
+0x05,0x0f,0x5b,0x01,0x44,0x0f,0x01,0x00,0x61,0x1f,0xff,0x94,0x00,0x63,0x1e,0x01,
+0x7e,0x0c,0x19,0x01,0x7a,0x01,0x1f,0x01,0x7b,0x0d,0x4a,0x0f,0x01,0x00,0x71,0x0f,
+0xaf,0x03,0x4f,0x1f,0xf5,0xdc,0x01,0x0b,0x2f,0xfe,0xff,0x32,0x0a,0x47,0x1c,0xf6,
+0x0e,0x07,0x11,0xff,0xdf,0x01,0x10,0x04,0x08,0x07,0x0f,0x68,0x01,0xbb,0x1d,0x01,
+0x57,0x02,0x00,0x15,0x0c,0x1f,0x01,0xd0,0x03,0x51,0x1f,0xf6,0xca,0x02,0x77,0x1f,
+0xfe,0xbb,0x04,0x63,0x1f,0xff,0xe3,0x00,0xcc,0x0f,0x6f,0x0a,0x18,0x1f,0xfd,0xc1,
+0x00,0x0c,0x1f,0xfe,0xef,0x12,0x42,0x2f,0xfb,0xfb,0x9f,0x0d,0x58,0x05,0x6d,0x00,
+0x34,0xfb,0xf8,0xfb,0xe0,0x04,0x1f,0xfb,0x35,0x08,0x10,0x00,0x1d,0x01,0x3f,0xfd,
+0xfd,0xfd,0x54,0x01,0x34,0x1f,0xfa,0xcb,0x01,0x6d,0x0f,0x2e,0x06,0x45,0x1e,0xf8,
+0xe7,0x00,0x0f,0x1d,0x15,0x50,0x13,0xf8,0x77,0x00,0x1f,0x03,0x5e,0x01,0x54,0x0f,
+0xca,0x02,0x0d,0x1f,0x06,0xee,0x00,0x52,0x0f,0x1e,0x04,0x5d,0x0a,0x5c,0x02,0x1f,
+0xf5,0x9e,0x04,0x64,0x1e,0xf6,0x2f,0x04,0x0f,0x63,0x02,0x41,0x2b,0xf3,0xf0,0xca,
+0x02,0x2e,0x02,0x02,0xf6,0x00,0x0e,0x2b,0x04,0x08,0x54,0x07,0x3f,0xf2,0xf5,0xf2,
+0x41,0x03,0x1f,0x1f,0xf0,0x77,0x08,0x02,0x1f,0xf8,0xab,0x09,0x18,0x3f,0xf5,0xf5,
+0xf5,0x3f,0x0d,0x53,0x0f,0xfa,0x05,0x47,0x0f,0xbd,0x04,0x5d,0x00,0x5f,0x01,0x1f,
+0x05,0x38,0x12,0x4f,0x0f,0x98,0x04,0x63,0x52,0xf8,0xfb,0xfb,0x00,0xfb,0xf9,0x06,
+0x00,0xd0,0x01,0x23,0xf6,0xfd,0x63,0x01,0x10,0xf8,0xf7,0x00,0x1f,0xfd,0xee,0x00,
+0x48,0x0f,0xed,0x08,0x62,0x16,0xfa,0xe9,0x07,0x00,0xee,0x00,0x20,0xfb,0xfa,0x08,
+0x00,0x1f,0xfe,0xb5,0x0d,0x4e,0x13,0xfb,0xb7,0x02,0x3f,0xfd,0x02,0x02,0x92,0x14,
+0x5f,0x1f,0xfb,0x36,0x0a,0x8a,0x0f,0x6f,0x08,0x49,0x2f,0xf5,0xf8,0x64,0x02,0x62,
+0x1f,0xfa,0x66,0x00,0x5c,0x1f,0xfb,0xd5,0x08,0x58,0x18,0xfb,0xea,0x07,0x01,0x87,
+0x00,0x2f,0xfa,0xfd,0x4f,0x02,0x5b,0x1f,0xfd,0x16,0x0c,0x58,0x0c,0xdc,0x00,0x0f,
+0xd0,0x1e,0x53,0x0f,0x10,0x0c,0x23,0x1f,0xfd,0x46,0x0c,0x2e,0x2b,0x02,0x02,0x52,
+0x00,0x0f,0x7b,0x0d,0x59,0x0f,0x4e,0x13,0x67,0x1f,0xfd,0x39,0x0b,0x5a,0x2f,0xf0,
+0xf0,0xba,0x01,0x0c,0x17,0xf8,0x8d,0x00,0x18,0xfa,0x1d,0x00,0x32,0xfd,0x00,0xf2,
+0x6d,0x03,0x10,0xfd,0x6d,0x0e,0x23,0xf5,0xf8,0x04,0x0a,0x2f,0xfa,0xf6,0x87,0x05,
+0x34,0x00,0x50,0x0a,0x07,0x5e,0x03,0x00,0x62,0x04,0x13,0xfd,0xb7,0x06,0x18,0xfd,
+0xf4,0x03,0x1f,0xfb,0xc3,0x06,0x18,0x1f,0xfb,0xfe,0x05,0x63,0x2f,0xf6,0xf6,0x9c,
+0x06,0x33,0x1f,0xfb,0x04,0x0d,0x24,0x0f,0x71,0x06,0x89,0x1e,0xfb,0xc1,0x15,0x0f,
+0xf7,0x00,0x23,0x2f,0xf2,0xf3,0x19,0x15,0x12,0x26,0xfa,0xfa,0x0a,0x02,0x05,0xaa,
+0x00,0x26,0xf6,0xf8,0x6e,0x03,0x2f,0xf3,0xfa,0x6c,0x01,0x1a,0x2f,0xf5,0xf3,0xdc,
+0x01,0x1d,0x1e,0x02,0xa1,0x01,0x0f,0xad,0x01,0x1f,0x2f,0xf3,0xf2,0xfd,0x01,0x21,
+0x02,0x86,0x00,0x44,0xf6,0xfa,0xfa,0xfa,0x75,0x0a,0x24,0xf5,0xfb,0x5d,0x05,0x0f,
+0x77,0x00,0x13,0x1f,0xf3,0x61,0x03,0x0e,0x1f,0xfd,0x1c,0x00,0x07,0x05,0x05,0x01,
+0x2f,0xfe,0xf8,0xcb,0x05,0x3d,0x0f,0x71,0x08,0x42,0x2f,0xf2,0xf2,0x6f,0x03,0x27,
+0x12,0xfd,0x65,0x01,0x0f,0xdc,0x01,0x22,0x1f,0xf5,0xee,0x17,0x27,0x0e,0x53,0x02,
+0x0f,0x1b,0x0b,0x53,0x06,0xab,0x14,0x0f,0x51,0x15,0x50,0x25,0xfd,0xfd,0x32,0x22,
+0x08,0x5b,0x05,0x1f,0xf8,0xe7,0x11,0x5b,0x00,0xbc,0x10,0x1f,0xfb,0xdb,0x12,0x66,
+0x1f,0xfd,0xce,0x17,0x1b,0x1f,0xfe,0xb1,0x0d,0x2e,0x1f,0xfe,0xf9,0x06,0x47,0x0f,
+0x19,0x06,0x0e,0x1f,0xfd,0x77,0x00,0x63,0x0f,0x1b,0x18,0x58,0x1f,0xfb,0x84,0x00,
+0x27,0x0f,0x4c,0x05,0x1a,0x1f,0x03,0x77,0x00,0x36,0x2f,0xf6,0xf8,0xdc,0x01,0x35,
+0x1f,0xfe,0xca,0x02,0x55,0x0f,0x62,0x15,0x29,0x1f,0xfb,0x98,0x16,0x3c,0x0f,0x53,
+0x02,0x33,0x1f,0xf6,0xed,0x0a,0x14,0x1f,0xfb,0x77,0x00,0x3b,0x1f,0xf5,0xee,0x00,
+0x43,0x0f,0xbc,0x0f,0x29,0x1f,0xfd,0xa3,0x18,0x63,0x1f,0xf8,0xda,0x12,0x51,0x1f,
+0xfd,0x02,0x13,0x57,0x12,0xfd,0xe5,0x0d,0x1f,0xfb,0x80,0x00,0x13,0x1f,0xfd,0xe5,
+0x00,0x4f,0x1f,0x05,0xc5,0x0c,0x63,0x1f,0x05,0x78,0x00,0x05,0x1f,0x08,0xd2,0x01,
+0x7f,0x0f,0x7b,0x0d,0x17,0x1f,0xfd,0x23,0x22,0x14,0x1e,0xfb,0x2f,0x06,0x0f,0x2f,
+0x04,0x29,0x0f,0x19,0x03,0x44,0x0f,0x77,0x00,0x39,0x0f,0x2c,0x0f,0x46,0x2f,0x03,
+0x03,0x1a,0x19,0x36,0x0f,0x74,0x17,0xa2,0x09,0xa2,0x0b,0x0f,0x41,0x13,0x17,0x2f,
+0xf3,0xf3,0xb1,0x01,0x27,0x17,0xf3,0x21,0x12,0x0f,0xf2,0x11,0x1c,0x1f,0xfd,0x26,
+0x02,0x3c,0x1f,0xfd,0x7b,0x0d,0x40,0x0b,0xd9,0x21,0x4f,0xfd,0xfe,0xfe,0xfe,0x82,
+0x0a,0x24,0x2f,0xf6,0xfa,0xe0,0x23,0x88,0x1f,0xfb,0x3f,0x01,0x0e,0x1f,0xfd,0xe9,
+0x12,0x63,0x0f,0x8d,0x0c,0x3c,0x1f,0xfb,0xf4,0x03,0x09,0x1e,0xfe,0x95,0x0f,0x0f,
+0x04,0x0d,0x42,0x19,0xfd,0x38,0x10,0x17,0xf8,0xd1,0x0f,0x2f,0xfd,0xfb,0x69,0x0e,
+0x2b,0x2e,0xf6,0xf6,0xa1,0x06,0x05,0xc8,0x02,0x28,0xf8,0xf8,0x52,0x01,0x44,0xf6,
+0xfd,0xfe,0xfe,0x2f,0x04,0x26,0xfb,0xfa,0x32,0x04,0x03,0x3b,0x2b,0x30,0x02,0x03,
+0x00,0x50,0x29,0x1e,0x04,0x9a,0x07,0x04,0xbc,0x3b,0x00,0xbd,0x3b,0x92,0x0c,0x0c,
+0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0xc1,0x3b,0x01,0x20,0x00,0xff,0x0c,0x1a,0x1b,
+0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,
+0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0xcb,0x00,0x08,0xf0,0x4e,0x29,0x2a,
+0x2b,0x00,0x2c,0x2d,0x2e,0x2f,0x30,0x31,0x32,0x00,0x33,0x00,0x34,0x35,0x00,0x00,
+0x36,0x37,0x38,0x39,0x3a,0x3b,0x3c,0x00,0x3d,0x3e,0x3f,0x40,0x41,0x42,0x00,0x00,
+0x00,0x43,0x44,0x45,0x46,0x47,0x48,0x00,0x49,0x31,0x4a,0x00,0x4b,0x4c,0x00,0x00,
+0x31,0x4d,0x4e,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x00,
+0x5a,0x5b,0x5c,0x5d,0x5e,0x5f,0x60,0x61,0x62,0x63,0x64,0x2d,0x65,0x66,0x00,0x67,
+0x68,0x69,0x6a,0x6a,0x6b,0x00,0x6c,0x6d,0x6e,0x00,0x6f,0x61,0x00,0xff,0x05,0x70,
+0x00,0x71,0x00,0x00,0x2d,0x72,0x73,0x00,0x00,0x00,0x74,0x75,0x76,0x77,0x00,0x78,
+0x79,0x7a,0x00,0x01,0x00,0xff,0x48,0x02,0x46,0x02,0x20,0x03,0x02,0x41,0x02,0x3c,
+0x06,0x07,0x06,0xc8,0x09,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,
+0x0c,0x00,0x08,0x00,0x20,0x0b,0x00,0x0c,0x3e,0x00,0x0b,0x3e,0xd1,0x00,0x00,0x15,
+0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,
+0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x73,
+0x00,0x02,0xf1,0x03,0x24,0x00,0x25,0x26,0x27,0x28,0x00,0x29,0x00,0x2a,0x2b,0x2c,
+0x2d,0x00,0x2a,0x2a,0x00,0x00,0x4e,0x02,0x30,0x33,0x34,0x35,0x4a,0x02,0xf3,0x01,
+0x00,0x3a,0x3b,0x3c,0x3c,0x3d,0x3e,0x00,0x00,0x3f,0x00,0x00,0x40,0x41,0x00,0x42,
+0x4e,0x02,0x91,0x49,0x4a,0x00,0x4b,0x4b,0x00,0x4c,0x4d,0x00,0x4b,0x02,0x00,0x4c,
+0x02,0x01,0x4d,0x02,0x22,0x55,0x43,0x4e,0x02,0x11,0x55,0x4f,0x02,0x40,0x00,0x00,
+0x65,0x66,0x4f,0x02,0x41,0x00,0x00,0x00,0x6b,0x50,0x02,0xdf,0x70,0x71,0x72,0x00,
+0x00,0x73,0x00,0x74,0x75,0x00,0x00,0x76,0x77,0x40,0x02,0xff,0x43,0x50,0x00,0x00,
+0x00,0x00,0x00,0xf0,0x1a,0x2c,0x2b,0x2b,0x2b,0x2b,0x17,0x00,0x2b,0x55,0xa5,0x59,
+0x32,0x60,0x00,0x55,0x55,0x00,0x08,0x29,0x20,0x0c,0xec,0xec,0x00,0x0b,0x0b,0x00,
+0x00,0xa0,0xa0,0x05,0xce,0xcd,0x80,0x05,0x56,0x50,0x00,0x82,0x92,0x00,0x01,0x00,
+0xf0,0x85,0x74,0x00,0x05,0xdc,0x30,0x1d,0x14,0xd0,0x2c,0x00,0x80,0x0b,0xa3,0x00,
+0x00,0x5c,0x70,0x23,0x00,0xd0,0x4b,0x01,0xe0,0x09,0xed,0x50,0x00,0x83,0x00,0x1b,
+0xb1,0x00,0x07,0x45,0x63,0x70,0x64,0x55,0xa0,0x01,0xa9,0x65,0x00,0x00,0x0a,0x6a,
+0x40,0x08,0x3b,0x0b,0x01,0x90,0xb0,0xb0,0x00,0x08,0xa6,0x05,0xdc,0x10,0x00,0xd1,
+0x67,0x00,0x0c,0x3a,0x40,0x00,0x5f,0x70,0x00,0x1d,0xa9,0x07,0x07,0x80,0xc8,0x90,
+0x59,0x02,0xf4,0x00,0x9b,0xc9,0xc0,0x73,0x73,0x41,0x00,0x71,0x04,0x90,0x0b,0x10,
+0x1c,0x00,0x4a,0x00,0x59,0x00,0x49,0x00,0x2b,0x00,0x0d,0x00,0x09,0x40,0x01,0xb0,
+0x00,0x21,0x81,0x03,0xa0,0x0b,0x20,0x67,0x04,0xa0,0x2b,0x03,0xb0,0x49,0x08,0x50,
+0xc0,0x76,0x03,0x00,0x03,0x80,0x07,0x69,0x80,0x3b,0xe5,0x01,0xca,0x30,0x13,0x13,
+0x00,0x00,0x83,0x00,0x00,0xa4,0x03,0x00,0x32,0x9f,0xff,0xf3,0x09,0x00,0xf6,0x28,
+0x67,0x85,0x70,0xad,0x70,0x01,0x3b,0x00,0x1a,0x00,0x74,0x00,0xb0,0x02,0x90,0x08,
+0x40,0x0c,0x00,0x38,0x00,0x83,0x00,0x60,0x00,0x08,0xdc,0x30,0x2c,0x03,0xc0,0x58,
+0x00,0xe0,0x67,0x00,0xd0,0x67,0x00,0xd0,0x58,0x00,0xe0,0x2c,0x03,0xb0,0x07,0xdc,
+0x30,0x03,0x98,0x2b,0x99,0x00,0x59,0x02,0x00,0xf0,0x6e,0x09,0xdd,0x30,0x5a,0x03,
+0xc0,0x32,0x01,0xd0,0x00,0x07,0x80,0x00,0x3c,0x00,0x01,0xd2,0x00,0x0b,0x40,0x00,
+0x6f,0xdd,0xd3,0x0a,0xdd,0x35,0x80,0x2c,0x00,0x04,0xb0,0x1d,0xf2,0x00,0x04,0xb2,
+0x20,0x0e,0x5a,0x03,0xc0,0xad,0xc2,0x00,0x0d,0x60,0x00,0x7e,0x60,0x01,0xc8,0x60,
+0x0a,0x38,0x60,0x4a,0x08,0x60,0xad,0xde,0xe5,0x00,0x08,0x60,0x00,0x08,0x60,0x0a,
+0xff,0xf0,0x0c,0x10,0x00,0x0d,0x00,0x00,0x0e,0xdd,0x50,0x04,0x02,0xe0,0x00,0x00,
+0xb2,0x1c,0x00,0xd1,0x06,0xdd,0x60,0x01,0xae,0x10,0x0b,0x80,0x00,0x1d,0x00,0x00,
+0x4c,0xcd,0x40,0x5d,0x12,0xe0,0x49,0x00,0xc1,0x1d,0x01,0xd0,0x05,0xdd,0x40,0x8d,
+0xdd,0xf2,0x00,0x01,0xc0,0x00,0x07,0x60,0x34,0x00,0x70,0x49,0x00,0x00,0xb3,0x00,
+0x01,0xd0,0x4a,0x00,0xf0,0x5b,0x09,0xdd,0x40,0x3c,0x02,0xd0,0x2c,0x03,0xc0,0x09,
+0xef,0x30,0x3c,0x03,0xc0,0x67,0x00,0xd0,0x4b,0x02,0xd0,0x08,0xdd,0x40,0x09,0xdc,
+0x15,0xa0,0x5a,0x76,0x00,0xd4,0xb0,0x4f,0x08,0xd8,0xe0,0x00,0x3c,0x00,0x0b,0x60,
+0x7e,0x70,0x3a,0x01,0x00,0x00,0x01,0x3a,0x58,0x01,0x00,0x00,0x12,0x58,0x84,0x30,
+0x00,0x18,0x40,0x8d,0x70,0x9c,0x10,0x00,0x7d,0x81,0x00,0x08,0x40,0x3e,0xee,0xb0,
+0x00,0x00,0x3e,0xee,0xb0,0x49,0x10,0x00,0x6d,0x91,0x00,0x0a,0xc1,0x7d,0x81,0x48,
+0x10,0x00,0x1c,0xea,0x08,0x60,0xb3,0x00,0x0a,0x30,0x04,0xc0,0x00,0xd1,0x00,0x27,
+0xdc,0x01,0xf0,0x7c,0x3a,0x00,0x00,0x3b,0xbb,0x80,0x00,0x3a,0x00,0x04,0x90,0x0b,
+0x02,0xba,0x18,0x22,0x80,0xb1,0x92,0x35,0x55,0x1a,0x0a,0x12,0x76,0x44,0x80,0xb0,
+0x36,0x56,0x38,0x0d,0x07,0x31,0xa0,0xb9,0x7a,0x80,0x09,0x50,0x00,0x00,0x00,0x07,
+0xba,0xa0,0x00,0x00,0x5d,0x00,0x00,0x0a,0xd2,0x00,0x00,0xd5,0x80,0x00,0x59,0x0d,
+0x00,0x0a,0x30,0xb3,0x00,0xfd,0xde,0x80,0x59,0x00,0x1d,0x0b,0x40,0x00,0xb3,0x2f,
+0xdd,0xb0,0x2c,0x00,0x96,0x2c,0x00,0xa5,0x2f,0xde,0xc0,0x2c,0x00,0x97,0x2c,0x00,
+0x5a,0x2c,0x00,0x97,0x2f,0xdd,0xa0,0x03,0xcd,0xb2,0x00,0xd3,0x05,0xb0,0x4a,0x00,
+0x09,0x06,0x80,0x00,0x00,0x68,0x00,0x00,0x04,0xa0,0x00,0x80,0x0d,0x30,0x5b,0x00,
+0x3c,0xdb,0x10,0x2f,0xed,0x70,0x2c,0x00,0xb6,0x2c,0x00,0x2c,0x2c,0x00,0x0e,0x03,
+0x00,0x00,0x09,0x00,0xd1,0xb6,0x2f,0xde,0x70,0x2f,0xdd,0xd4,0x2c,0x00,0x00,0x2c,
+0x00,0x00,0x55,0x00,0x14,0x00,0x0c,0x00,0x47,0xd4,0x2f,0xdd,0xd3,0x0f,0x00,0x15,
+0xa0,0x0c,0x00,0xa1,0x03,0xcd,0xc2,0x00,0xd3,0x04,0xc0,0x4b,0x00,0x06,0x64,0x00,
+0xf0,0x05,0x06,0xde,0x14,0xb0,0x00,0xd1,0x0d,0x40,0x1e,0x10,0x2c,0xed,0x60,0x2c,
+0x00,0x0a,0x42,0xc0,0x00,0xa4,0x07,0x00,0x36,0xfd,0xdd,0xf4,0x0e,0x00,0x00,0x07,
+0x00,0x13,0x1d,0x01,0x00,0x53,0x00,0x03,0xc0,0x00,0x3c,0x05,0x00,0xf5,0x15,0xc3,
+0x00,0x3b,0x96,0x07,0x91,0xcd,0xb1,0x2c,0x00,0x7a,0x02,0xc0,0x4d,0x00,0x2c,0x2d,
+0x20,0x02,0xcd,0x60,0x00,0x2f,0xad,0x00,0x02,0xc0,0x89,0x00,0x2c,0x00,0xd4,0x02,
+0xc0,0x03,0xd0,0x79,0x00,0x08,0x03,0x00,0xf1,0x52,0x2f,0xdd,0xd1,0x2f,0x30,0x00,
+0x7e,0x2f,0x90,0x00,0xde,0x2b,0xd0,0x03,0xbe,0x2b,0x94,0x09,0x5e,0x2c,0x4a,0x0d,
+0x0e,0x2c,0x0d,0x59,0x0e,0x2c,0x08,0xe4,0x0e,0x2c,0x02,0xe0,0x0e,0x2f,0x10,0x0a,
+0x42,0xfa,0x00,0xa4,0x2c,0xd3,0x0a,0x42,0xc4,0xc0,0xa4,0x2c,0x0b,0x6a,0x42,0xc0,
+0x2e,0xb4,0x2c,0x00,0x8f,0x42,0xc0,0x00,0xe4,0x02,0xce,0xb1,0x00,0xd4,0x05,0xc0,
+0x4b,0x00,0x0d,0x26,0x80,0x00,0xa4,0x68,0x00,0x0a,0x44,0xb0,0x00,0xd2,0x0d,0x40,
+0x5c,0x00,0x2c,0xeb,0x10,0x2f,0xed,0xc2,0x2c,0x00,0x5b,0x22,0x01,0x46,0x5b,0x2f,
+0xdd,0xb2,0xf8,0x00,0xf1,0x16,0xce,0xb1,0x00,0xd3,0x06,0xb0,0x4a,0x00,0x0d,0x17,
+0x70,0x00,0xb3,0x77,0x00,0x0b,0x35,0xa0,0x00,0xd1,0x0d,0x30,0x6b,0x00,0x3c,0xef,
+0x40,0x00,0x00,0x4d,0x10,0x00,0x00,0x00,0x2f,0xee,0xa0,0x8e,0x01,0xfe,0x1f,0x4a,
+0x2c,0x00,0xa7,0x2f,0xde,0xa0,0x2c,0x04,0xb0,0x2c,0x00,0xc3,0x2c,0x00,0x4b,0x07,
+0xdd,0x80,0x3c,0x00,0xb5,0x5b,0x00,0x22,0x0b,0xb5,0x00,0x00,0x3a,0xd1,0x32,0x00,
+0x87,0x6a,0x00,0x96,0x08,0xdd,0xa0,0xad,0xee,0xda,0x00,0x77,0x00,0x03,0x00,0x38,
+0x59,0x00,0x1d,0x03,0x00,0xf0,0x45,0x4a,0x00,0x2c,0x1d,0x10,0x79,0x05,0xde,0xa1,
+0xb4,0x00,0x0e,0x15,0x90,0x04,0xb0,0x1e,0x00,0x96,0x00,0xb3,0x0d,0x10,0x06,0x83,
+0xb0,0x00,0x1d,0x86,0x00,0x00,0xbe,0x10,0x00,0x06,0xc0,0x00,0x95,0x00,0xf0,0x06,
+0x86,0x80,0x4f,0x40,0x95,0x2b,0x08,0x98,0x0c,0x10,0xe0,0xc1,0xb0,0xd0,0x0b,0x3c,
+0x0c,0x3a,0x00,0x89,0x80,0x89,0x70,0x04,0xf4,0x04,0xf4,0x00,0x1f,0x00,0x0f,0x00,
+0x6b,0x00,0x7a,0x0d,0x41,0xe2,0x04,0xd9,0x80,0x00,0xbe,0x37,0x00,0xf6,0x08,0x04,
+0xc8,0x90,0x0d,0x30,0xe2,0x6a,0x00,0x6b,0xa5,0x00,0x6a,0x3d,0x00,0xd2,0x0b,0x45,
+0xb0,0x03,0xcc,0x30,0x00,0xbb,0x88,0x00,0xf6,0x0e,0x7d,0xdd,0xf6,0x00,0x01,0xe1,
+0x00,0x0b,0x50,0x00,0x4c,0x00,0x00,0xd2,0x00,0x08,0x80,0x00,0x2d,0x00,0x00,0x9f,
+0xdd,0xd8,0x4d,0x74,0xa0,0x4a,0x04,0x03,0x00,0x60,0x4e,0x70,0xa3,0x00,0x04,0x90,
+0x5c,0x03,0x40,0x94,0x00,0x03,0xa0,0x08,0x00,0x94,0x85,0x00,0x02,0xa0,0x00,0x06,
+0x00,0xcc,0x0e,0x01,0x00,0xf4,0x63,0xcc,0x06,0x90,0x0c,0xc0,0x2a,0x84,0x85,0x2a,
+0xdd,0xdd,0x60,0x44,0x00,0xc1,0x09,0xdc,0x22,0x60,0x4a,0x07,0xbc,0xb5,0xa0,0x3b,
+0x69,0x07,0xb0,0xcd,0x9b,0x59,0x00,0x00,0x59,0x00,0x00,0x5c,0xcd,0x40,0x5c,0x02,
+0xd0,0x59,0x00,0xc1,0x59,0x00,0xc1,0x5c,0x02,0xd0,0x5b,0xce,0x40,0x08,0xdc,0x34,
+0xb0,0x2c,0x86,0x00,0x17,0x60,0x00,0x4b,0x02,0xb0,0x8d,0xc2,0x00,0x00,0xe0,0x00,
+0x0e,0x09,0xda,0xe4,0xb0,0x2e,0x76,0x00,0xe7,0x60,0x0e,0x4b,0x02,0xe0,0x9c,0xae,
+0x07,0xdc,0x33,0xa0,0x2c,0x7e,0xdd,0xd7,0x70,0x00,0x4c,0x01,0x60,0x8d,0xd4,0x03,
+0xd6,0x0c,0x30,0x0d,0x00,0x8f,0xc1,0x0e,0x00,0x02,0x00,0x43,0x09,0xda,0xe4,0xc0,
+0x30,0x00,0xf1,0x09,0x03,0xe0,0x9e,0xae,0x03,0x03,0xc0,0x9d,0xc3,0x59,0x00,0x05,
+0x90,0x00,0x5b,0xbe,0x45,0xc0,0x3c,0x59,0x01,0xd5,0x90,0x1d,0x05,0x00,0x31,0x3a,
+0x00,0x3a,0x01,0x00,0x62,0x04,0x90,0x00,0x04,0x90,0x49,0x03,0x00,0x32,0x05,0x94,
+0xe4,0x9b,0x00,0xf3,0x04,0x59,0x0b,0x60,0x59,0x89,0x00,0x5d,0xe0,0x00,0x5d,0xb6,
+0x00,0x59,0x1d,0x10,0x59,0x05,0xb0,0x3a,0x01,0x00,0xf5,0x03,0x5b,0xcd,0x5b,0xe8,
+0x05,0xb0,0x3f,0x10,0xe0,0x59,0x01,0xd0,0x0d,0x15,0x90,0x1d,0x00,0xd1,0x09,0x00,
+0x0b,0x61,0x00,0xf6,0x08,0x07,0xdd,0x40,0x4c,0x02,0xd0,0x86,0x00,0xb2,0x76,0x00,
+0xb3,0x3c,0x01,0xe0,0x07,0xdd,0x40,0x5c,0xbd,0x40,0x5b,0x01,0xf1,0x00,0x32,0x5c,
+0xcd,0x40,0x6e,0x00,0x36,0x09,0xda,0xd4,0xe3,0x00,0x21,0x9d,0xae,0xf7,0x00,0x55,
+0x00,0x00,0x5c,0xd3,0x5c,0x46,0x05,0xf6,0x0c,0x0a,0xdc,0x14,0xa0,0x56,0x1d,0x82,
+0x00,0x05,0xc5,0x67,0x05,0x90,0xad,0xc2,0x07,0x00,0xe0,0xbf,0xa0,0xe0,0x0e,0x00,
+0xe0,0x0e,0x00,0xac,0x71,0x00,0xf4,0x66,0x3b,0x04,0xd0,0xbd,0xad,0xb3,0x06,0x75,
+0x80,0xb2,0x1c,0x0d,0x00,0xb6,0x80,0x06,0xe3,0x00,0x1e,0x00,0xa3,0x0c,0x30,0xb2,
+0x67,0x0e,0x80,0xd0,0x2b,0x47,0xc3,0xa0,0x0d,0x92,0xb8,0x60,0x0a,0xd0,0x6f,0x20,
+0x06,0x90,0x2e,0x00,0x79,0x0a,0x60,0xd5,0xc0,0x04,0xf3,0x00,0x5f,0x40,0x0d,0x3d,
+0x08,0x80,0x97,0xb3,0x08,0x76,0x80,0xc2,0x1d,0x1c,0x00,0xb7,0x70,0x06,0xf2,0x00,
+0x1d,0x00,0x06,0x70,0x08,0xd1,0x00,0x7d,0xdf,0x70,0x02,0xd0,0x00,0xb4,0x00,0x6a,
+0x00,0x1d,0x10,0x08,0xed,0xd8,0x00,0x82,0x06,0x80,0x0a,0x40,0x0a,0x30,0x0c,0x10,
+0xaa,0x00,0x0c,0x10,0x0a,0x30,0x0a,0x40,0x06,0x80,0x00,0x82,0x29,0x01,0x00,0xf5,
+0x6f,0x14,0x82,0x00,0x2c,0x00,0x0e,0x00,0x0d,0x00,0x0b,0x30,0x04,0xf0,0x0b,0x20,
+0x0d,0x00,0x0e,0x00,0x2c,0x00,0x82,0x00,0x0b,0xd6,0x0b,0x13,0x70,0x9e,0x80,0x00,
+0x00,0xa3,0x00,0x00,0x00,0x0d,0xd3,0x00,0xed,0xdd,0xc2,0xd3,0x0d,0x00,0x00,0x02,
+0xd2,0xd0,0x00,0x00,0x4c,0x1c,0xdd,0xde,0x3d,0x10,0x00,0x00,0xdd,0x10,0x00,0x00,
+0x08,0x20,0x00,0x00,0x02,0xb0,0x00,0x00,0x02,0xde,0x00,0x00,0x02,0xd3,0xad,0xdd,
+0xe2,0xd3,0x00,0x00,0x0d,0x1d,0x50,0x00,0x00,0xd0,0x1c,0x5c,0xdd,0xdc,0x00,0x1c,
+0xf0,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x01,0x10,0x00,0x00,0x2d,0xd2,0x00,0x02,
+0xd3,0x3d,0x20,0x2d,0x30,0x03,0xd2,0x8d,0xe0,0x0e,0xd8,0x00,0xd0,0x0d,0x00,0x04,
+0x00,0xb8,0xdd,0xdd,0x00,0x00,0x11,0x11,0x00,0x00,0xdb,0xbd,0x00,0x18,0x00,0xf2,
+0x01,0xaf,0xc0,0x0c,0xfa,0x1c,0x50,0x05,0xc1,0x01,0xc5,0x5c,0x10,0x00,0x1c,0xc1,
+0x00,0x01,0x00,0x40,0x22,0x00,0x00,0x00,0xff,0x02,0xf1,0x0f,0x00,0x03,0xee,0x30,
+0x00,0x00,0x0c,0x77,0xb0,0x00,0x00,0x4e,0x00,0xe4,0x00,0x00,0xc5,0x00,0x6c,0x00,
+0x05,0xe2,0x22,0x2e,0x50,0x0d,0xff,0xff,0xff,0xd0,0x2b,0x00,0xf1,0x10,0x01,0x4d,
+0xd3,0x05,0xd8,0xc3,0x4b,0x3d,0x10,0xff,0xf5,0xa5,0x02,0xfe,0x78,0xb2,0x05,0x90,
+0x2b,0x96,0x00,0x00,0x69,0x2d,0x30,0x03,0xd1,0x03,0xcd,0xdc,0x30,0x98,0x00,0xf0,
+0x1f,0x08,0xcc,0x61,0x00,0x01,0xd3,0xee,0x3d,0x10,0x0b,0x70,0x44,0x07,0xb0,0x1a,
+0x20,0x00,0x01,0xc1,0x1a,0x10,0x00,0x01,0xb1,0x0b,0x50,0x00,0x05,0x90,0x04,0xc5,
+0x00,0x5a,0x60,0x00,0x4a,0xec,0x95,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x10,0x77,
+0x00,0xf0,0x17,0xeb,0xcd,0x91,0x00,0x1e,0x29,0xb1,0x4d,0x30,0x0c,0x90,0xb7,0x02,
+0xc0,0x0d,0x9c,0xc1,0x00,0xc2,0x0d,0x05,0x10,0x00,0xb3,0x0a,0x50,0x00,0x01,0xd0,
+0x02,0xd3,0x00,0x1b,0x50,0x00,0x2b,0xdd,0xd5,0x7f,0x00,0x10,0x00,0xd7,0x00,0xf2,
+0x11,0x10,0x00,0xef,0xff,0xf4,0x03,0xe0,0x00,0xd0,0x07,0x90,0x08,0x70,0x06,0xc0,
+0x97,0x00,0x4c,0xc5,0xd0,0x00,0x94,0x97,0xb2,0x00,0x77,0x00,0xd0,0x00,0x0b,0xcd,
+0x50,0x56,0x00,0xf0,0x10,0x04,0x43,0x00,0x00,0x0f,0xfc,0x00,0x1c,0x98,0x88,0x88,
+0x18,0x02,0x22,0x09,0x18,0x3b,0xba,0x09,0x08,0x15,0x54,0x09,0x08,0x27,0x76,0x09,
+0x0c,0x99,0x99,0x88,0x1c,0x00,0x31,0x00,0x02,0x21,0xd6,0x00,0xf2,0x39,0x20,0x04,
+0xcf,0xf8,0xb8,0x6f,0x71,0x32,0x91,0xb9,0x00,0x00,0x90,0x05,0xa0,0x00,0x90,0x09,
+0x50,0x00,0x92,0xd4,0x00,0x00,0xb9,0x9d,0x30,0x00,0x30,0x08,0xfe,0xfa,0x00,0x00,
+0x13,0x30,0x14,0x44,0x44,0x41,0x85,0xf8,0x44,0x58,0x90,0x62,0x7e,0xf8,0x91,0xf6,
+0x4d,0xf8,0x90,0x62,0x00,0x08,0x91,0xf6,0x00,0x08,0x90,0x83,0x00,0x08,0x90,0xe6,
+0x00,0x08,0x89,0xfc,0x99,0x98,0x4f,0x01,0xf2,0x17,0x3b,0xee,0xb2,0x00,0x04,0xd3,
+0x99,0x3d,0x40,0x0d,0x20,0x99,0x02,0xd0,0x1c,0x00,0x76,0x20,0xc2,0x1b,0x1a,0x97,
+0xa7,0xc2,0x0c,0xa9,0x51,0x8a,0xd0,0x03,0xf6,0x00,0x3d,0x30,0x00,0x2a,0xee,0xa2,
+0x2c,0x00,0xf1,0x1e,0x03,0xdd,0x90,0x00,0x00,0x0d,0x20,0x86,0x02,0x00,0x0d,0x00,
+0x49,0xef,0xa0,0x09,0x84,0xc9,0xff,0xf0,0x00,0xde,0xeb,0xff,0xb0,0x09,0x55,0xff,
+0xff,0x70,0x0c,0x1f,0xff,0xff,0xe0,0x0e,0xdf,0xff,0xff,0xf0,0x00,0x01,0x22,0x22,
+0x10,0xff,0x00,0x10,0x0a,0x28,0x07,0xf0,0x0d,0xa5,0x00,0x9a,0xa9,0x9f,0x60,0x89,
+0x99,0x99,0x92,0x2e,0xff,0xff,0xfe,0x02,0xd6,0x44,0x44,0x00,0x2c,0x20,0x00,0x00,
+0x01,0x90,0x00,0x00,0x00,0xd3,0x00,0xf0,0x15,0x05,0x8a,0x50,0x00,0x00,0x8a,0x76,
+0x70,0x00,0x08,0x63,0x70,0x00,0x15,0x58,0x50,0x00,0x4d,0x21,0x7a,0x00,0x0e,0x88,
+0xf1,0xf5,0x00,0x9b,0x49,0x2f,0x20,0x00,0x89,0x79,0x30,0x00,0x00,0x46,0x08,0xf3,
+0x01,0xea,0x00,0xd0,0x09,0x6a,0x0d,0x00,0x69,0xc2,0xd0,0x00,0x0a,0x2d,0x00,0x00,
+0xa2,0x07,0x00,0x42,0xed,0xdd,0xde,0x10,0xa0,0x00,0x90,0x3a,0x89,0x00,0x00,0x00,
+0xa0,0x02,0xaa,0x30,0x5b,0x00,0xf1,0x0e,0xa0,0x09,0x24,0x8c,0xd3,0x90,0x08,0x18,
+0x66,0x00,0x91,0x08,0x00,0x9f,0x10,0x26,0x08,0x20,0x67,0x30,0x45,0x00,0x88,0x89,
+0x99,0x80,0x00,0x00,0x00,0x52,0x00,0xf5,0x0d,0xe2,0x40,0x00,0x00,0x01,0xf4,0xc0,
+0x00,0x7d,0x7d,0x8d,0x20,0x03,0xb0,0x2e,0x1c,0x20,0x08,0x40,0x06,0xf8,0x00,0x0b,
+0x00,0x00,0xe2,0x00,0x0c,0x05,0x00,0x01,0x01,0x00,0xf0,0x45,0x0a,0x80,0x55,0x91,
+0x1a,0x90,0x04,0x14,0xf9,0x2e,0x70,0x02,0x00,0x00,0x1a,0xb5,0x00,0x00,0x09,0xe0,
+0x08,0xc8,0x10,0x15,0x00,0x00,0x1c,0xcc,0xb0,0x00,0x00,0x3c,0x10,0x05,0xd1,0x00,
+0x41,0x05,0x50,0x44,0x53,0x70,0x16,0x19,0x91,0x00,0x56,0x00,0x10,0x05,0xbd,0xcb,
+0xba,0x00,0x00,0x82,0x06,0x00,0x00,0x0b,0xba,0xe8,0x00,0x0a,0xc1,0x74,0x3b,0x08,
+0x48,0x6a,0x00,0xc0,0xc0,0x8c,0x00,0x3b,0x07,0xca,0x73,0x8c,0x20,0x00,0x00,0x33,
+0x5e,0x03,0xf7,0x0d,0x02,0x60,0x0a,0x30,0x00,0x0d,0x20,0x93,0x00,0x00,0x68,0x08,
+0x40,0x00,0x01,0xc0,0x57,0x05,0x30,0x0d,0x01,0xc0,0xc2,0x00,0x40,0x07,0xf8,0x00,
+0x01,0x00,0x20,0x0b,0xdb,0x2b,0x01,0xf2,0x0e,0x24,0x00,0x00,0x00,0x12,0x40,0x00,
+0x1c,0xba,0xcc,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x6f,0x70,0x00,0x00,0x8b,0x2c,
+0x20,0x00,0x79,0x00,0x4d,0xbc,0x6f,0x02,0x10,0xb0,0x2d,0x00,0x90,0x36,0x09,0x10,
+0x8b,0xe8,0x50,0x3c,0x30,0x0b,0x3b,0x00,0xf3,0x01,0xda,0xaa,0x91,0x04,0xad,0x00,
+0x05,0x80,0xc1,0xb0,0x00,0x87,0x05,0xbd,0x0a,0xc6,0x52,0x00,0x20,0x08,0x30,0x2a,
+0x00,0xf7,0x10,0x20,0x07,0x00,0x19,0xae,0xbb,0x35,0x80,0x02,0x2a,0x02,0xa0,0xc1,
+0x00,0x75,0x01,0xa0,0x66,0x00,0xc0,0x03,0x90,0x00,0x06,0x80,0x07,0x50,0x00,0x0c,
+0x16,0xcb,0x82,0x00,0xf3,0x19,0x21,0x00,0x07,0x40,0x05,0x69,0x00,0x0a,0x20,0x06,
+0x50,0x19,0x9e,0xbb,0x36,0x70,0x03,0x3b,0x02,0xb0,0xc1,0x00,0x66,0x00,0xb0,0x67,
+0x00,0xc1,0x02,0xa0,0x00,0x05,0x90,0x06,0x60,0x00,0x0b,0x16,0xcc,0x10,0x2f,0x00,
+0xf1,0x13,0x04,0x80,0x20,0x2b,0xaa,0xeb,0x60,0x00,0x00,0x75,0x22,0x3b,0xba,0xbf,
+0x93,0x00,0x00,0x09,0x30,0x07,0x00,0x5c,0xa0,0x1b,0x00,0x00,0x10,0x0d,0x62,0x35,
+0x00,0x01,0x79,0x97,0x4f,0x02,0xf0,0x04,0x00,0x00,0xb0,0x29,0x81,0xab,0xad,0xc8,
+0x41,0x00,0x00,0x2a,0x03,0x00,0xbb,0xba,0xeb,0x60,0x00,0xa3,0x06,0xa0,0x41,0x01,
+0x9e,0x00,0x0b,0x10,0x02,0x40,0x00,0xa5,0xd6,0x00,0x33,0xbc,0xcd,0x50,0x7e,0x02,
+0xf3,0x31,0xa0,0x00,0x04,0xc2,0x00,0x06,0xb1,0x00,0x08,0x90,0x00,0x00,0xb6,0x00,
+0x00,0x01,0xb7,0x00,0x00,0x00,0xaa,0x00,0x00,0x00,0x8b,0x00,0x00,0x00,0x50,0x29,
+0x00,0x01,0xc0,0x04,0x80,0x00,0x0c,0x00,0x65,0x0a,0xcc,0xfc,0x47,0x30,0x00,0x0b,
+0x00,0x85,0x00,0x00,0xb0,0x07,0xc1,0x00,0x2a,0x00,0x6c,0x00,0x08,0x50,0x02,0x80,
+0x08,0xb0,0xf8,0x01,0x00,0xff,0x00,0x34,0xdc,0xcc,0x80,0xdb,0x00,0x00,0xa7,0x02,
+0xf0,0x09,0x2a,0x00,0x00,0x00,0x2c,0x10,0x00,0x00,0x06,0xcd,0xdd,0xc3,0x00,0x01,
+0xa0,0x00,0x11,0x01,0xb6,0x84,0x49,0x99,0x9d,0x40,0x24,0x01,0x90,0x01,0x00,0x27,
+0x90,0x1b,0x00,0x26,0x60,0x2b,0x38,0x00,0xc0,0xca,0xab,0x30,0x00,0x02,0x10,0x00,
+0xc2,0x00,0x00,0x0b,0x10,0x6f,0x01,0x00,0x24,0x02,0x24,0x00,0xc0,0x07,0x00,0xf9,
+0x04,0x05,0x8a,0x40,0x05,0xd2,0x2c,0xdd,0x91,0x00,0xd1,0x00,0x24,0x0c,0x00,0x74,
+0xb0,0xc0,0x00,0x82,0x20,0x00,0x91,0x06,0x7b,0x30,0x06,0xd1,0x2c,0xdd,0x81,0x00,
+0x11,0x00,0xd0,0x19,0x99,0xae,0xaa,0xa0,0x03,0x22,0x1c,0x11,0x10,0x00,0x05,0xbe,
+0x13,0x00,0xf3,0x01,0x06,0x60,0x00,0x00,0x08,0xad,0x70,0x00,0x00,0x00,0x4f,0x10,
+0x00,0x00,0x09,0xd3,0x9d,0x00,0x00,0x07,0x00,0xf1,0x1b,0x40,0x00,0x00,0x0a,0x29,
+0x64,0x08,0x99,0x9d,0xbb,0xa1,0x04,0x32,0x2a,0x42,0x20,0x00,0x05,0xbe,0x20,0x00,
+0x00,0x0c,0x07,0x50,0x00,0x00,0x0b,0x2a,0x60,0x00,0x00,0x02,0x9e,0x30,0x00,0x00,
+0x01,0x99,0x00,0x00,0x00,0x9a,0x0a,0x30,0x15,0x00,0x09,0xd5,0x00,0xf1,0x09,0x0b,
+0x00,0x02,0x5c,0x67,0x9e,0xb7,0x2a,0x9c,0x53,0x2b,0x00,0x00,0x29,0x00,0x1a,0x00,
+0x00,0x2a,0x06,0xb5,0x00,0x00,0x1c,0x03,0x01,0xf0,0x09,0xcc,0xcc,0x60,0x00,0x5a,
+0xab,0xc1,0x00,0x01,0x11,0xb5,0x00,0x00,0x02,0xb3,0x00,0x00,0x36,0xe9,0x89,0xa5,
+0x19,0x76,0xc5,0xe0,0x0c,0x00,0x48,0x00,0xb1,0x20,0x00,0x00,0x00,0x3c,0x63,0x00,
+0x00,0x00,0x27,0x81,0x12,0x00,0xe0,0x03,0x3b,0x89,0x00,0x00,0x78,0xe5,0x30,0x00,
+0x00,0x1b,0x07,0xbb,0xa0,0xac,0x00,0x80,0x00,0xb2,0x14,0x00,0x00,0x2c,0x03,0x90,
+0xec,0x0b,0x23,0xcc,0xc0,0x5a,0x01,0xa0,0x20,0x03,0x70,0x01,0x1c,0x56,0x08,0x63,
+0x0a,0xbe,0x46,0x00,0x60,0x39,0x08,0xbb,0x60,0x00,0x84,0x19,0x00,0x20,0xd0,0x22,
+0xc2,0x01,0x81,0x66,0x00,0x00,0x0b,0x40,0x2c,0xbb,0x90,0xd8,0x00,0xf2,0x05,0x02,
+0x7b,0xbc,0xa0,0x1a,0x51,0x00,0x86,0x00,0x00,0x00,0x57,0x00,0x00,0x03,0xc2,0x00,
+0x1c,0xc9,0x20,0xea,0x01,0x90,0x69,0xa5,0x00,0x19,0xd9,0x42,0x19,0x80,0x05,0x39,
+0x00,0x00,0x12,0x00,0x10,0xe0,0x6f,0x0b,0x93,0x90,0x00,0x00,0x14,0xab,0x00,0x00,
+0x07,0xb9,0xc6,0x01,0x81,0x78,0xab,0xce,0xd9,0x05,0x31,0x2a,0x10,0x5f,0x01,0x00,
+0xcc,0x08,0x03,0xdb,0x00,0x10,0xa8,0x87,0x02,0x26,0x7d,0xb0,0xbe,0x02,0x50,0x07,
+0x8a,0xbc,0xed,0x90,0x2a,0x00,0xd1,0x40,0x00,0x00,0xb0,0x09,0x71,0x00,0x02,0xa0,
+0x02,0x00,0x00,0x01,0x21,0x00,0x11,0xb7,0xb5,0x00,0x13,0xda,0xe7,0x03,0x00,0x03,
+0x02,0xd2,0x80,0x04,0x90,0x00,0xd3,0xb9,0x10,0x00,0xaa,0x20,0x00,0x08,0x70,0x5b,
+0x00,0x81,0x0d,0x10,0x00,0x00,0x04,0xcc,0xcd,0xd2,0x25,0x00,0x20,0x05,0x50,0x1e,
+0x01,0xc0,0x74,0x01,0x00,0x0a,0xbe,0x73,0x2c,0x60,0x00,0x57,0x00,0x30,0xf0,0x01,
+0xf2,0x15,0xc0,0x00,0x0a,0x60,0x79,0xd0,0x00,0x04,0x09,0x51,0xdc,0x20,0x00,0x0b,
+0x10,0xc4,0xc0,0x00,0x03,0xbd,0x60,0x00,0x36,0x00,0x00,0x00,0x66,0x06,0xcc,0xc7,
+0x83,0x00,0x00,0x00,0xa1,0x00,0xa0,0x03,0xd1,0xb9,0x09,0x00,0x00,0xa9,0x0d,0x10,
+0x01,0x85,0x05,0xcc,0xda,0x11,0x7e,0x00,0xf0,0x11,0xbd,0xa3,0x00,0x01,0xc4,0x67,
+0x1b,0x40,0x0a,0x30,0x93,0x01,0xc0,0x0c,0x00,0xc0,0x00,0xc0,0x0c,0x02,0xb0,0x00,
+0xd0,0x0c,0x5c,0x30,0x07,0x80,0x02,0xa5,0x05,0xba,0x75,0x00,0xf0,0x01,0x20,0x00,
+0x35,0x00,0x02,0x70,0x07,0x50,0x00,0x29,0x00,0x92,0x09,0xbc,0xeb,0x3b,0xd0,0x01,
+0xf3,0x03,0xb0,0x00,0x01,0xa0,0x0b,0x80,0x38,0xac,0x00,0xb9,0x0d,0x12,0xdb,0x48,
+0x50,0x9b,0xd5,0x02,0x2e,0x02,0x00,0x20,0x01,0x10,0x1d,0x82,0x06,0x80,0xc4,0x0c,
+0x40,0x00,0x0a,0x70,0x01,0xd2,0xe1,0x02,0x20,0x2d,0x20,0x5a,0x01,0x01,0xc4,0x00,
+0x23,0x31,0x00,0xcc,0x06,0xf1,0x06,0x53,0x90,0x00,0x1c,0xd2,0x19,0x40,0x00,0xb5,
+0x2d,0x10,0x00,0x09,0x80,0x04,0xc0,0x00,0x3b,0x00,0x00,0x6b,0x32,0x01,0x01,0x1d,
+0x01,0x10,0x61,0xb5,0x02,0x40,0x09,0xba,0xeb,0xb4,0x08,0x00,0x40,0x0b,0xba,0xeb,
+0xb6,0x08,0x00,0xe0,0x02,0x8a,0xd2,0x00,0x0c,0x20,0xdb,0x90,0x0d,0x33,0xb0,0x68,
+0x02,0x89,0xc8,0x05,0x60,0x12,0x00,0x00,0x00,0x5a,0x9e,0x75,0x00,0x10,0x2b,0x36,
+0x00,0xf0,0x07,0xa4,0x02,0x90,0x01,0xab,0xda,0xa9,0x80,0x0a,0x18,0x50,0x0a,0xe4,
+0x0b,0x3c,0x00,0x0c,0x13,0x06,0xb2,0x01,0xb4,0x55,0x00,0x12,0x20,0x4f,0x01,0xf0,
+0x02,0x09,0x8e,0xb8,0x1a,0x00,0x02,0x3c,0x00,0x04,0xb0,0x03,0xac,0x00,0x00,0x30,
+0x0a,0x0c,0x7b,0x01,0xd4,0x4b,0x00,0x07,0x20,0x02,0xa7,0x00,0x0a,0x30,0x00,0x2d,
+0x99,0xca,0xe7,0x07,0x21,0x06,0x00,0x91,0x04,0xf0,0x0a,0x0a,0x9b,0xdd,0xa1,0x00,
+0xc9,0x0b,0x05,0xa0,0x94,0xc4,0x90,0x0b,0x0b,0x05,0xe1,0x00,0xb1,0xb1,0x9d,0x20,
+0x3c,0x04,0xa5,0x03,0x49,0x05,0x14,0x44,0xe6,0x01,0xc0,0x75,0x00,0x00,0x04,0x28,
+0x31,0x00,0x00,0x59,0xeb,0xa1,0x00,0xfb,0x02,0xf0,0x08,0x00,0xab,0xeb,0xb1,0xb2,
+0x00,0x0c,0x00,0x04,0x80,0x00,0xd0,0x00,0x49,0x00,0x0b,0x83,0x5d,0x30,0x00,0x07,
+0x97,0x10,0x10,0x00,0x01,0x00,0xf2,0x11,0x8c,0x86,0x10,0x02,0x00,0x36,0x10,0x0a,
+0x20,0x00,0x00,0x0c,0x05,0x89,0x40,0x0d,0xb5,0x23,0xb4,0x0b,0x10,0x00,0x58,0x00,
+0x00,0x01,0xb4,0x00,0x9b,0xcc,0x50,0x00,0x01,0x00,0xf3,0x2f,0x75,0x01,0x00,0x93,
+0xaa,0xc1,0xb9,0x20,0x49,0xc6,0x00,0x0c,0xd1,0x00,0x0d,0xb0,0x00,0x2b,0x00,0x00,
+0xb4,0x01,0x5c,0x70,0x05,0x71,0x00,0x00,0x12,0x23,0x00,0x05,0x99,0xae,0x30,0x00,
+0x03,0xa1,0x00,0x00,0x7e,0x98,0x20,0x1b,0x83,0x03,0xc2,0x64,0x17,0x30,0x48,0x00,
+0xb3,0xb2,0x67,0x00,0xc4,0x6c,0xd1,0x00,0x16,0x86,0x45,0x00,0xf7,0x1c,0x0d,0x00,
+0x00,0x00,0x04,0x6e,0x14,0x96,0x00,0x07,0x5d,0x97,0x1c,0x10,0x00,0x2f,0x40,0x0b,
+0x10,0x00,0xca,0x00,0x0c,0x00,0x08,0x8a,0x00,0x0c,0x00,0x0b,0x1a,0x00,0x0c,0x04,
+0x00,0x2a,0x00,0x0a,0xd7,0x00,0x02,0x00,0x00,0x32,0x00,0xf2,0x14,0x00,0x1d,0x00,
+0x00,0x00,0x0b,0xae,0x29,0xbb,0x50,0x00,0x1e,0xa2,0x00,0xb4,0x00,0xba,0x00,0x00,
+0x58,0x07,0x8a,0x00,0x00,0x85,0x0a,0x1a,0x00,0x28,0xb0,0x00,0x2a,0x03,0xb6,0x00,
+0x32,0x00,0xf0,0x1c,0x06,0x50,0x00,0x00,0xab,0xec,0xbb,0x20,0x00,0x39,0x00,0x00,
+0x00,0x0c,0x9a,0x45,0xb7,0x0a,0x70,0x5e,0x71,0x00,0x40,0x97,0xb0,0x00,0x00,0x39,
+0x07,0x00,0x00,0x01,0xca,0x9a,0xb1,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x43,0x2f,
+0x00,0x63,0xd1,0x00,0x00,0x00,0x08,0x70,0x60,0x00,0xf1,0x05,0x00,0x9d,0xc9,0x00,
+0x00,0x02,0xe2,0x0c,0x00,0x52,0x09,0x50,0x0c,0x01,0xc0,0x0d,0x00,0x07,0xdd,0x40,
+0x82,0x00,0xf2,0x0b,0x3a,0xaa,0xaa,0xa4,0x01,0x13,0x22,0xc1,0x00,0x09,0x4b,0x40,
+0x00,0x0b,0x12,0x00,0x00,0x1c,0x00,0x00,0x02,0xc3,0x00,0x00,0x04,0x20,0xa2,0x00,
+0xf2,0x12,0x0a,0xcc,0xcc,0xcc,0xf1,0x00,0x02,0x00,0x96,0x00,0x00,0xa3,0x99,0x00,
+0x00,0x0c,0x24,0x00,0x00,0x00,0xd0,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x7c,0x00,
+0x00,0x00,0x05,0x27,0x00,0xf0,0x04,0x01,0x80,0x00,0x00,0x3c,0x40,0x00,0x19,0xe2,
+0x00,0x3b,0xb5,0xc0,0x00,0x11,0x00,0xc0,0x00,0x00,0x04,0x00,0x30,0x01,0xc0,0x00,
+0x24,0x00,0xf1,0x01,0x40,0x00,0x00,0x07,0xc1,0x00,0x00,0x2b,0x80,0x00,0x04,0xab,
+0xe0,0x00,0x0c,0x93,0xf7,0x00,0x14,0xd0,0x00,0x01,0x10,0xe0,0x37,0x01,0x02,0x0d,
+0x00,0xf2,0x0f,0x11,0x1d,0x11,0x20,0xc9,0x99,0x99,0xd5,0xc0,0x00,0x00,0xb2,0xc0,
+0x00,0x01,0xd0,0x00,0x00,0x08,0x60,0x00,0x00,0x6a,0x00,0x00,0x5c,0x90,0x00,0x00,
+0x61,0x6b,0x00,0x50,0x2b,0xbe,0xcb,0x90,0x00,0xcf,0x01,0x03,0x04,0x00,0x40,0x8c,
+0xce,0xcc,0xc3,0x18,0x00,0x51,0x09,0xcc,0xcc,0xcc,0x50,0x15,0x00,0x47,0x00,0xa2,
+0x00,0x00,0x09,0x00,0xf3,0x13,0x30,0x00,0x4c,0xcc,0xcc,0xcc,0xb0,0x00,0x00,0x07,
+0x00,0x08,0xbb,0xbe,0xb9,0x00,0x00,0xab,0x00,0x00,0x08,0x6b,0x00,0x01,0xb8,0x0b,
+0x00,0x0c,0x60,0x0b,0x00,0x00,0x05,0xba,0x8e,0x01,0x21,0x0c,0x00,0xb6,0x00,0xf1,
+0x04,0x6c,0xbb,0xdf,0xbc,0x20,0x00,0x1c,0xc0,0x00,0x00,0x2c,0x3c,0x00,0x00,0x7c,
+0x20,0xc0,0x00,0x97,0x1b,0x00,0x26,0x8b,0xb0,0xb6,0x01,0x00,0x11,0x00,0xf4,0x09,
+0x9c,0xbf,0xbb,0xc9,0x00,0x1b,0x00,0x39,0x00,0x57,0x00,0x48,0x00,0xc1,0x00,0x56,
+0x0a,0x80,0x00,0x94,0x99,0x00,0xac,0xd0,0xdd,0x01,0xf3,0x19,0x30,0x00,0x00,0xd0,
+0x09,0x73,0x00,0x00,0xc0,0x04,0x20,0x0b,0xcc,0xeb,0xbd,0x40,0x00,0x03,0x80,0x08,
+0x40,0x00,0x08,0x50,0x09,0x30,0x00,0x1d,0x00,0x0a,0x10,0x00,0xc5,0x00,0x0d,0x00,
+0x0b,0x70,0x0d,0xd9,0x2f,0x00,0x10,0x29,0x5a,0x00,0xf2,0x03,0x36,0x90,0x9c,0xce,
+0x96,0x30,0x20,0x09,0x30,0x00,0x00,0x18,0xa8,0xbb,0xac,0xb9,0xc3,0x10,0x29,0x01,
+0x90,0xc1,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x10,0x25,0x00,0xf5,0x15,0x20,0x00,
+0x00,0x07,0xeb,0xbb,0x60,0x04,0xb0,0x00,0x95,0x06,0xb1,0x00,0x0d,0x00,0x40,0x00,
+0x09,0x60,0x00,0x00,0x06,0xb0,0x00,0x00,0x19,0xa0,0x00,0x00,0x8d,0x60,0x00,0x00,
+0x01,0x00,0x01,0x00,0xf0,0x07,0x60,0x06,0x82,0x00,0x07,0x91,0x16,0x42,0x00,0x2d,
+0x99,0x9f,0x20,0x02,0xc2,0x00,0x2c,0x00,0x1c,0x20,0x00,0x95,0x73,0x01,0x00,0xcf,
+0x00,0x61,0x4d,0x10,0x00,0x00,0x29,0xc1,0x0d,0x03,0x00,0x2b,0x01,0x14,0x10,0x2f,
+0x02,0xd0,0x8d,0xcd,0xec,0xc4,0x04,0xc0,0x04,0x80,0x00,0x0b,0x10,0x07,0x60,0x74,
+0x00,0x00,0x1a,0x00,0x10,0x89,0x66,0x01,0x00,0x36,0x00,0x13,0x03,0x5c,0x00,0xf0,
+0x09,0x10,0x00,0x18,0x00,0x08,0x82,0x00,0x58,0x00,0x04,0x21,0x00,0xcd,0xcc,0xcc,
+0xc0,0x07,0x80,0x09,0x30,0x00,0x3c,0x00,0x0c,0x2d,0x00,0x10,0x2c,0x21,0x00,0x00,
+0x56,0x00,0x60,0x1a,0x80,0x00,0x00,0x00,0x15,0x44,0x00,0x78,0xcc,0xcc,0xc9,0x00,
+0x00,0x00,0x2a,0x04,0x00,0x81,0x01,0x00,0x00,0x3a,0x2c,0xbb,0xbb,0xca,0x4f,0x00,
+0x30,0x0b,0x00,0x39,0x59,0x01,0xb0,0x38,0x00,0x1c,0xcf,0xbb,0xce,0xc7,0x00,0x0c,
+0x00,0x48,0x0f,0x00,0x60,0x57,0x00,0x00,0x06,0x00,0x94,0x76,0x00,0x10,0xd0,0xcf,
+0x03,0x12,0x20,0x5a,0x01,0x02,0x01,0x00,0xf0,0x01,0x82,0x00,0xa6,0x71,0x00,0xa2,
+0x00,0xc3,0x31,0x9c,0xec,0xbc,0xfc,0xa0,0x00,0xa2,0x74,0x02,0x80,0xa2,0x01,0xb0,
+0x00,0x00,0x51,0x05,0x80,0xa5,0x01,0x50,0x20,0x00,0x00,0x04,0xc5,0x9f,0x02,0x53,
+0x10,0x00,0x00,0x02,0x60,0xbf,0x00,0xf3,0x0b,0x30,0x02,0x00,0x01,0x07,0xc3,0x00,
+0x01,0xd0,0x02,0x40,0x00,0xc4,0x00,0x00,0x03,0xd5,0x00,0x00,0x18,0xd2,0x00,0x03,
+0xcd,0x60,0x00,0x9a,0x03,0xf2,0x09,0x33,0x00,0x12,0x90,0x00,0x2b,0x90,0x0a,0x53,
+0x02,0x00,0x30,0x02,0x10,0x0a,0xb1,0x00,0x02,0xc0,0x00,0x43,0x00,0x1c,0x30,0x2c,
+0x00,0x60,0x01,0x8c,0x20,0x00,0x04,0xbd,0x65,0x01,0x13,0x20,0x86,0x00,0x41,0x1c,
+0xcc,0xcd,0xc0,0xaa,0x02,0x00,0xf5,0x00,0x00,0x53,0x00,0xc3,0x1c,0x8c,0x10,0x04,
+0xd4,0x04,0xd1,0xab,0x20,0x00,0x5b,0x10,0x8d,0x01,0x10,0x30,0x7d,0x00,0x50,0x64,
+0x04,0xcc,0xcc,0xca,0x1d,0x01,0x10,0xa4,0xcf,0x00,0x13,0xb0,0xcc,0x01,0x21,0x01,
+0xcb,0x3d,0x03,0x70,0x98,0x00,0x0a,0xb2,0x00,0x0b,0x70,0x5c,0x01,0x32,0x20,0x00,
+0x0d,0x8b,0x02,0xf3,0x03,0x34,0x01,0x3e,0x9c,0xbc,0x84,0xc9,0xe2,0x01,0xc0,0x00,
+0x0c,0x00,0xb3,0x00,0x00,0xc0,0x02,0x34,0x03,0x30,0x8d,0xcd,0xd5,0x07,0x00,0xf0,
+0x0a,0x40,0x00,0x0a,0x00,0x08,0x56,0x00,0x0d,0x00,0x01,0x30,0x00,0x0d,0x69,0xcd,
+0x90,0x4c,0xce,0x52,0x0c,0x10,0x00,0x0c,0x00,0xa5,0x39,0x01,0x13,0x40,0x2c,0x00,
+0x80,0x0b,0xba,0xbd,0x50,0x00,0x00,0x12,0x10,0x0c,0x00,0xb0,0x21,0x87,0x00,0x00,
+0x95,0x0d,0x10,0x00,0xd1,0x06,0x70,0x80,0x00,0xc3,0x0b,0x40,0x00,0x00,0x7a,0x00,
+0x00,0x07,0xc0,0x00,0x01,0xd8,0x5e,0x02,0x30,0x00,0x00,0x14,0x0a,0x02,0x70,0x63,
+0x92,0x00,0x00,0x81,0x04,0xc0,0xa3,0x02,0x50,0x50,0x03,0xa0,0x00,0x10,0x7e,0x00,
+0x00,0x89,0x03,0x72,0x00,0x6c,0x00,0x00,0x02,0xba,0x10,0xb2,0x03,0x03,0x0f,0x03,
+0x12,0x10,0x90,0x02,0xf5,0x0a,0x03,0xb0,0x00,0x95,0x05,0xc2,0x50,0x1d,0x00,0x60,
+0x08,0xca,0x60,0x00,0x00,0x08,0xf9,0x00,0x00,0x08,0xa0,0x30,0x00,0x7d,0x70,0x31,
+0x02,0xf0,0x0b,0x01,0x50,0x00,0x02,0xc0,0x08,0x55,0x00,0x0c,0xdb,0xbc,0x40,0x00,
+0x87,0x00,0x0d,0x10,0x08,0x93,0x20,0x4a,0x00,0x16,0x02,0xb9,0xc1,0x47,0x00,0x90,
+0xe4,0x00,0x00,0x01,0xc6,0x12,0x00,0x01,0x9c,0x9a,0x04,0x02,0x9e,0x04,0x90,0x02,
+0x68,0x00,0x02,0xbb,0xbc,0x52,0x00,0x00,0x1a,0x02,0x60,0x1c,0xbb,0xce,0xbb,0xc1,
+0x00,0x10,0x02,0x11,0x00,0x10,0x02,0x10,0x04,0x5d,0x04,0x33,0x5c,0x10,0x00,0x5c,
+0x00,0xc1,0x08,0x00,0x31,0x1c,0x08,0x40,0xa3,0x09,0x32,0x40,0xd0,0x01,0x8d,0x01,
+0x92,0x6b,0x00,0x00,0x2a,0xa0,0x00,0x00,0x84,0x00,0x4f,0x00,0xc0,0xa0,0x0d,0x00,
+0x1d,0x08,0x50,0x85,0x05,0x80,0x2b,0x01,0x10,0xcd,0x00,0xe3,0x4a,0x00,0x00,0x00,
+0x3d,0x20,0x00,0x00,0x5d,0x20,0x00,0x02,0xda,0x10,0xfc,0x01,0x83,0x21,0x11,0x12,
+0x00,0x00,0x8a,0x99,0x9a,0x11,0x04,0x51,0xcc,0xcd,0xcc,0xc2,0x00,0x70,0x05,0x24,
+0x00,0x67,0x54,0x05,0x10,0x2c,0x34,0x06,0x14,0x13,0x02,0x03,0x00,0x98,0x05,0x61,
+0x57,0x00,0xbb,0xbb,0xb5,0x51,0x10,0x00,0x53,0x2c,0xcc,0xcc,0xcc,0xc0,0xa4,0x00,
+0x10,0x85,0x96,0x00,0x14,0xd0,0x32,0x00,0x11,0x33,0xf3,0x04,0x00,0x03,0x00,0xa4,
+0xd2,0x00,0x00,0xdb,0xc7,0x00,0xd0,0x18,0xe1,0xd0,0x12,0x00,0x01,0x50,0x04,0xf2,
+0x05,0x37,0x10,0xd0,0x09,0x36,0x0d,0x00,0x11,0x00,0xed,0x93,0x00,0x0d,0x05,0xbc,
+0x00,0xd0,0x00,0x20,0x0d,0x1e,0x05,0x02,0x3e,0x01,0x22,0x3b,0x00,0x35,0x03,0xb0,
+0x0a,0x99,0xae,0x99,0xa2,0x02,0x22,0x5b,0x22,0x20,0x00,0xc7,0x06,0x11,0x00,0x9a,
+0x01,0x10,0x06,0x4d,0x02,0x14,0x7b,0x0c,0x01,0x70,0x02,0xba,0xaa,0xab,0x00,0x02,
 0x22,0x22,0x00,0x08,0x01,0x00,0x91,0xcb,0xbb,0xbb,0xba,0x02,0x11,0x11,0x12,0x20,
 0xd3,0x00,0x60,0x04,0xbb,0xcd,0xbb,0x20,0x00,0x00,0x02,0x00,0xa8,0x01,0xe0,0x00,
-0x00,0x05,0xda,0x35,0x00,0x09,0xd8,0x58,0x09,0xb1,0x02,0x00,0x38,0xaf,0x02,0x20,
-0x49,0x00,0xd5,0x0e,0x01,0x39,0x00,0x40,0x50,0x00,0x00,0x03,0xe2,0x02,0x11,0x50,
+0x00,0x05,0xda,0x35,0x00,0x09,0xd8,0x58,0x09,0xb1,0x02,0x00,0x38,0xaf,0x02,0x10,
+0x49,0x33,0x00,0x11,0x11,0x39,0x00,0x40,0x50,0x00,0x00,0x03,0xe2,0x02,0x11,0x50,
 0x1e,0x04,0x00,0x5e,0x02,0x84,0x09,0xa0,0x00,0x02,0xba,0x00,0x00,0x4d,0x40,0x07,
-0x30,0x0a,0x01,0xb0,0x6e,0x02,0x20,0xa4,0x00,0xce,0x16,0x00,0x9f,0x01,0x21,0x0c,
-0x20,0x52,0x16,0x10,0x09,0x2a,0x0f,0x13,0x0a,0x14,0x09,0x02,0xa2,0x09,0xa0,0x73,
-0x00,0x08,0x02,0x73,0x42,0x00,0x1c,0x00,0xc2,0xc0,0x00,0x10,0x58,0x1d,0x0d,0x10,
-0x0d,0x62,0x03,0x50,0x09,0x50,0x0a,0x50,0x00,0xa2,0x13,0x04,0x13,0x01,0x00,0x3a,
-0x06,0x63,0x74,0x00,0x0a,0x02,0x95,0x74,0x2d,0x00,0x00,0x8c,0x11,0x30,0xb2,0x00,
-0x0d,0x8c,0x00,0x70,0x09,0x60,0x0c,0x30,0x00,0x03,0xc0,0x34,0x05,0x02,0x91,0x04,
-0x50,0x90,0x00,0x09,0x91,0x0d,0x24,0x06,0x72,0xc0,0x16,0xc8,0x00,0x0e,0xcb,0x61,
-0x45,0x00,0x14,0x0c,0x69,0x06,0x53,0x08,0xdc,0xcd,0xd3,0x00,0x68,0x08,0xe4,0x67,
-0x30,0xd0,0x00,0x07,0x73,0x0c,0x00,0x6b,0x90,0x00,0xeb,0xb7,0x10,0x6b,0x03,0x04,
-0x59,0x03,0x35,0xcc,0xdd,0x30,0x31,0x01,0x43,0x7c,0xcc,0xcc,0xe7,0xae,0x03,0x20,
-0xd0,0x00,0x20,0x17,0x94,0x00,0x4d,0x00,0x00,0x06,0xd1,0x00,0x04,0xd8,0x6a,0x01,
-0x01,0xab,0x0d,0x61,0x09,0x46,0x9c,0xcc,0xcc,0xd4,0x67,0x0d,0x03,0x6f,0x00,0x21,
-0x86,0x00,0x2b,0x00,0x74,0x00,0x6d,0x10,0x00,0x05,0xc9,0x10,0x47,0x01,0x73,0x00,
-0x37,0x69,0xcc,0xcc,0xce,0x85,0xcf,0x05,0x10,0x1d,0x3a,0x00,0x12,0x60,0xc7,0x02,
-0x62,0x06,0xc1,0x00,0x00,0x6c,0x81,0xa8,0x04,0x00,0x00,0x04,0x00,0x55,0x04,0x10,
-0xd6,0x40,0x05,0x70,0x0b,0x60,0x00,0x0a,0x70,0x00,0xc5,0x5c,0x11,0x30,0x1d,0x40,
-0x00,0xc3,0x07,0x04,0x4d,0x04,0x02,0xd6,0x09,0x41,0xa0,0x00,0x0c,0xd3,0xd6,0x09,
-0x60,0x30,0x00,0x09,0x80,0x02,0xd2,0x25,0x02,0x20,0x3d,0x10,0x39,0x01,0x12,0xd1,
-0xd6,0x09,0xf0,0x09,0x01,0x10,0x38,0x70,0x00,0x2d,0xd5,0x37,0x70,0x01,0xc2,0x0c,
-0x50,0x00,0x0c,0x40,0x01,0xc4,0x00,0x37,0x00,0x00,0x2d,0x30,0x34,0x01,0x13,0xe1,
-0x4b,0x00,0x12,0xc0,0x29,0x01,0x50,0x8c,0xbc,0xfb,0xbc,0x20,0x09,0x00,0xf2,0x00,
-0x07,0x60,0xc0,0x94,0x03,0xb0,0x0c,0x00,0xc1,0x71,0x00,0xc0,0x04,0x30,0x06,0x9c,
-0x05,0x05,0xd3,0x06,0xd2,0xb2,0x19,0x91,0x00,0x00,0xa2,0x05,0x10,0x3c,0xcc,0xec,
-0xcc,0x70,0x62,0x07,0xf0,0x02,0xa0,0xa2,0x47,0x00,0x09,0x50,0xa2,0x0c,0x20,0x5a,
-0x00,0xa2,0x03,0xa0,0x00,0x02,0xc2,0x0d,0x12,0x01,0x76,0x0d,0x72,0xb2,0x08,0x80,
-0x00,0x0a,0x20,0x66,0x2c,0x00,0x20,0x0a,0x20,0x2b,0x00,0xb1,0x28,0x00,0x95,0x0a,
-0x20,0xa2,0x5a,0x00,0xa2,0x02,0xa0,0x1c,0x10,0x00,0x29,0x00,0x40,0xcc,0xbb,0xbb,
-0xcc,0x91,0x0b,0x11,0xa0,0xe5,0x05,0x70,0x6a,0x03,0xc2,0x00,0x00,0x6c,0xc1,0xdd,
-0x03,0x00,0x44,0x00,0x12,0x6b,0x79,0x00,0x80,0x02,0x74,0x10,0x00,0x01,0x58,0xbc,
-0x90,0x0d,0x00,0x71,0x09,0xb8,0x40,0x00,0x00,0x14,0x8c,0x24,0x04,0x82,0x3c,0xb7,
-0x30,0x00,0x00,0x15,0x9d,0x70,0x12,0x01,0x14,0x71,0xf1,0x01,0x22,0x05,0x80,0xfb,
-0x07,0x00,0xd7,0x01,0x10,0x57,0x3c,0x02,0xc4,0x0c,0x10,0x01,0xb7,0x57,0x9d,0x90,
-0x2b,0xa8,0x65,0x31,0xd1,0x64,0x01,0x00,0xf2,0x05,0xf2,0x07,0xc0,0x06,0xa0,0x09,
-0x50,0x00,0x5d,0x6c,0x00,0x00,0x03,0xf8,0x00,0x00,0x0c,0x6c,0x70,0x03,0xc6,0x00,
-0xb6,0x7d,0x32,0x12,0x02,0x4d,0x03,0x54,0xbb,0xfb,0xbb,0x30,0x00,0xb3,0x08,0x47,
-0xac,0xbf,0xbb,0xbc,0xbc,0x08,0x36,0x8e,0xcd,0x90,0x1e,0x01,0x00,0x49,0x01,0xb1,
-0x97,0x8a,0xd6,0x4b,0xab,0x21,0xb0,0x00,0x0c,0x0b,0x20,0x39,0x0e,0x10,0x07,0x3c,
-0x03,0x51,0x70,0x00,0x00,0x56,0x00,0x35,0x0b,0xf4,0x01,0x36,0x90,0x14,0x7f,0xcb,
-0x88,0xa0,0x28,0x4a,0x40,0x1c,0x10,0x00,0x05,0x90,0xc3,0xed,0x02,0x01,0xf3,0x12,
-0x14,0x76,0xf5,0x12,0x00,0xdd,0x04,0x50,0xcb,0xbd,0x70,0x00,0x00,0x7c,0x07,0x20,
-0x09,0x40,0x83,0x0e,0x83,0x3c,0xcc,0xcd,0xc9,0x01,0xdc,0xcc,0xc9,0xb9,0x18,0x01,
-0x4d,0x18,0x01,0x63,0x04,0x00,0x40,0x03,0xd1,0x2a,0xaa,0xaa,0xea,0xa2,0x02,0x22,
-0x22,0x22,0x20,0x7a,0xaa,0xa8,0xcd,0x01,0x20,0x0c,0x5b,0xa7,0x00,0x43,0x0c,0xab,
-0xbb,0xbc,0x05,0x03,0x30,0x6c,0xcc,0xcc,0xf0,0x01,0x10,0xb1,0x04,0x00,0x35,0x3c,
-0xbb,0xbb,0x0c,0x00,0x40,0x8c,0xcc,0xcc,0xf1,0x53,0x01,0x81,0x07,0xa9,0x99,0xa0,
-0x01,0x21,0x11,0x20,0xf7,0x02,0x31,0xbb,0xbb,0xd9,0x64,0x05,0x00,0x97,0x03,0xf1,
-0x02,0x00,0x4c,0x20,0x00,0x5b,0xb1,0x00,0x00,0x42,0x00,0x00,0xa0,0x00,0x0a,0xd0,
-0x00,0x0d,0x03,0x00,0xd1,0x0c,0xd0,0x00,0x2b,0x10,0x00,0x86,0x00,0x06,0xc0,0x01,
-0xca,0x10,0x08,0x03,0x10,0x06,0xa5,0x05,0x00,0x14,0x01,0x10,0x38,0x70,0x00,0x20,
-0x48,0x0c,0x10,0x0d,0xf0,0x04,0x0c,0x00,0x20,0x00,0xa3,0x0c,0x01,0xc2,0x02,0xc0,
-0x0c,0x4d,0x30,0x0d,0x30,0x0d,0xa1,0x00,0x01,0x0e,0x07,0x12,0x60,0x3d,0x01,0x14,
-0xd0,0x07,0x00,0x93,0x04,0xad,0x00,0x08,0xb1,0xd0,0x6c,0x70,0x0d,0xb4,0x10,0x88,
-0xac,0xcc,0xcc,0xd1,0xb1,0x00,0x00,0xa2,0x04,0x00,0x84,0xb2,0x11,0x11,0xb2,0xcb,
-0xbb,0xbb,0xe2,0x6c,0x01,0xd1,0xdc,0xcc,0xcc,0xe6,0xd0,0x00,0x00,0x94,0xd0,0x00,
-0x00,0xc1,0x50,0x9b,0x14,0x91,0x0c,0x40,0x00,0x01,0xc6,0x00,0x00,0x9d,0x50,0xdc,
-0x01,0x10,0x01,0x7d,0x05,0x11,0xd6,0xf8,0x0d,0x00,0xa4,0x0a,0xf3,0x03,0x10,0x02,
-0xd0,0x00,0x00,0x01,0xd3,0x00,0x00,0x03,0xd4,0x00,0x00,0x3a,0xc2,0x00,0x04,0xeb,
-0xba,0x04,0x00,0x9b,0x03,0xf1,0x02,0x11,0xdd,0xcc,0xcc,0xdd,0x01,0x11,0x11,0x11,
-0x10,0x3b,0xbb,0xbb,0xbb,0xb9,0x00,0x00,0xfc,0x1b,0x06,0x05,0x00,0x3b,0x9c,0xbb,
-0x90,0x14,0x00,0x51,0x2a,0xaa,0xdb,0xaa,0xa7,0x32,0x00,0x53,0x2b,0xbb,0xbb,0xbb,
-0xb7,0xdf,0x01,0x01,0x8e,0x05,0x10,0x5d,0x8f,0x05,0x30,0x56,0x2c,0x80,0x14,0x00,
-0x13,0x50,0x19,0x00,0x04,0x05,0x00,0x80,0x0b,0xbb,0xbb,0xbb,0xb5,0x00,0x00,0x1d,
-0x32,0x01,0x10,0xc9,0xf9,0x0f,0xd3,0xa9,0xb6,0x00,0x01,0xc7,0x39,0x09,0x90,0x1d,
-0x40,0x39,0x00,0x77,0x69,0x06,0x04,0x05,0x00,0x12,0x1b,0x5a,0x00,0xf3,0x02,0x38,
-0x00,0x00,0x07,0xbb,0xcd,0xbb,0xb1,0x0a,0x00,0x38,0x00,0x92,0x0a,0x19,0x38,0x36,
-0x05,0x00,0x40,0x1d,0xbd,0xb6,0x92,0x59,0x05,0x00,0x05,0x00,0x20,0x0a,0xc1,0xc5,
-0x0f,0x84,0xbb,0xbe,0xcb,0xb5,0xb0,0x09,0x20,0x37,0x04,0x00,0x41,0xeb,0xbe,0xcb,
-0xc7,0xdd,0x0f,0x04,0x04,0x00,0x00,0x1e,0x0c,0xf0,0x22,0x06,0xaa,0xbb,0xa8,0x40,
-0x03,0x44,0x89,0x44,0x40,0x04,0xa7,0x89,0x5c,0x50,0x1a,0xdb,0xcc,0xae,0xa6,0x00,
-0x83,0x46,0x0b,0x00,0x09,0xdb,0xcd,0xae,0xa2,0x00,0x09,0xcc,0xa1,0x00,0x05,0xc5,
-0x46,0x3c,0x71,0x17,0x00,0x46,0x00,0x66,0x9b,0xbb,0xbb,0xba,0x8b,0x04,0x52,0x40,
-0x00,0x00,0x5b,0x30,0x73,0x0f,0x20,0x01,0xa0,0xd3,0x09,0x07,0x09,0x00,0x30,0x01,
-0xbb,0x60,0xdf,0x05,0xf2,0x1c,0x10,0xb0,0x00,0x04,0x80,0xb0,0xb1,0x50,0x1e,0x20,
-0xb4,0xea,0xc0,0xbc,0x48,0xe6,0xb0,0xb0,0x19,0x32,0xb0,0xb0,0xb0,0x09,0x20,0xb0,
-0xb9,0x90,0x09,0x20,0xb0,0xa0,0x00,0x09,0x20,0xb0,0x00,0x64,0x09,0x20,0x9b,0xaa,
-0xb1,0x78,0x01,0xf0,0x0c,0x38,0x00,0x09,0x10,0x00,0xb1,0x00,0x09,0x10,0x05,0xc5,
-0xbb,0xbe,0xc4,0x2d,0xb0,0x00,0x09,0x10,0x22,0xb0,0x92,0x09,0x10,0x00,0xb0,0x2b,
-0x05,0x00,0x10,0x06,0x05,0x00,0x11,0x00,0x0a,0x00,0x18,0xad,0xc4,0x06,0xf0,0x10,
-0x66,0x51,0xb0,0x00,0x00,0xc0,0xc2,0xc1,0x10,0x09,0xa2,0xd9,0xe9,0x92,0x3b,0x96,
-0x20,0xb0,0x00,0x01,0x96,0x99,0xe9,0x97,0x01,0x90,0x11,0xc1,0x11,0x01,0x90,0x2a,
-0x0f,0x05,0x05,0x00,0x06,0xf6,0x11,0xf0,0x01,0x00,0x58,0x13,0x6a,0xb0,0x00,0xc5,
-0x97,0xc1,0x00,0x08,0xb0,0x00,0xb0,0x00,0x5b,0x05,0x00,0x60,0x20,0xb9,0xbb,0xeb,
-0xb7,0x00,0x0a,0x00,0x03,0x05,0x00,0xa0,0x11,0xc1,0x10,0x00,0xb4,0x99,0x99,0x95,
-0x00,0x04,0xb9,0x01,0x10,0x65,0xcf,0x03,0xf0,0x07,0xc1,0xbb,0xcb,0xb3,0x0a,0xb0,
-0x21,0x01,0x40,0x39,0xb0,0x55,0x04,0x80,0x00,0xb0,0x29,0x06,0x40,0x00,0xb0,0x0b,
-0x96,0x00,0xf0,0x00,0x0a,0x0b,0x00,0x00,0xb5,0x99,0x9d,0x96,0x00,0xb1,0x22,0x22,
-0x21,0x00,0x13,0x5e,0x0a,0xf0,0x05,0x93,0x8a,0xbd,0x50,0x01,0xc0,0xb0,0x0b,0x00,
-0x0a,0xa0,0xb0,0x0b,0x00,0x5a,0xa0,0xeb,0xbe,0xb8,0x11,0x0a,0x00,0xf7,0x05,0x01,
-0xa0,0xb0,0x09,0x10,0x01,0xa0,0xb0,0x36,0x42,0x01,0xa0,0xb2,0x94,0x98,0x01,0xa3,
-0xc7,0x26,0x96,0xd2,0x00,0xf0,0x20,0xa0,0x06,0x40,0x00,0x06,0x69,0x9c,0xb9,0x92,
-0x1e,0x22,0x3f,0xe2,0x20,0xab,0x10,0x89,0x96,0x00,0x09,0x10,0xa6,0x4b,0x00,0x09,
-0x29,0x36,0x45,0x80,0x09,0x77,0xad,0xc9,0x93,0x09,0x20,0x06,0x40,0x00,0x09,0x10,
-0x06,0x40,0x00,0x00,0x02,0x01,0x43,0x11,0x10,0x0c,0x32,0x04,0xd4,0x5e,0xbb,0xb9,
-0x09,0xc1,0xc0,0xb0,0x00,0x3a,0xb7,0x30,0xea,0xa6,0xc8,0x00,0x77,0xe9,0x96,0x00,
-0xb0,0x00,0xc1,0x11,0xd7,0x00,0x06,0x01,0x00,0x20,0x05,0x70,0x28,0x14,0xd0,0xb5,
-0x88,0xd8,0x88,0x00,0xaa,0x29,0x9e,0x99,0x70,0x58,0xa4,0x60,0xad,0x00,0xd0,0x4c,
-0x9e,0x9a,0xb0,0x00,0xa0,0x70,0xb0,0x00,0x00,0x0a,0x06,0xb7,0x90,0x00,0x92,0x4d,
-0xb6,0x10,0x00,0x0a,0x98,0x00,0x6b,0xb0,0x79,0x08,0xf0,0x01,0x75,0xea,0xaa,0xe0,
-0x01,0xc0,0xb0,0x00,0xb0,0x0b,0xa0,0xd9,0x99,0xe0,0x57,0xa0,0x55,0x00,0xf3,0x09,
-0xa7,0xaa,0xea,0xa6,0x00,0xa0,0x09,0xe9,0x00,0x00,0xa0,0x67,0xb7,0x50,0x00,0xa8,
-0xa0,0xb0,0xb5,0x00,0xa4,0x00,0xb0,0x03,0x53,0x03,0x00,0x81,0x03,0x10,0x83,0x12,
-0x08,0xf3,0x0e,0xb6,0x99,0xb9,0x96,0x09,0x90,0x11,0x11,0x10,0x3c,0x90,0x78,0x88,
-0x70,0x01,0x90,0x67,0x77,0x60,0x00,0x90,0x99,0x99,0x90,0x00,0x90,0xa0,0x00,0xa0,
-0x05,0x00,0xf3,0x25,0xd9,0x99,0xc0,0x00,0x40,0x04,0x10,0x00,0x02,0x90,0x0e,0x76,
-0x60,0x09,0x20,0xac,0x35,0xb0,0x3f,0x09,0x53,0xbb,0x10,0xbc,0x0b,0x7a,0x79,0xa3,
-0x1a,0x0a,0x22,0x92,0x01,0x0a,0x0a,0x26,0x39,0x10,0x0a,0x0a,0x19,0x71,0xa2,0x0a,
-0x00,0x02,0x7c,0x40,0x0a,0x00,0xa9,0x40,0xd7,0x01,0xf3,0x1d,0xb0,0x05,0x70,0x00,
-0x05,0x77,0xb9,0x9c,0xa0,0x1e,0x20,0xa0,0x0b,0x00,0xad,0x25,0x96,0x7b,0x51,0x19,
-0x24,0x44,0x44,0x41,0x09,0x13,0xca,0xab,0x60,0x09,0x14,0x60,0x03,0x70,0x09,0x14,
-0xc8,0x8a,0x70,0x09,0x14,0x71,0x15,0x70,0x05,0x01,0xf2,0x21,0xb1,0x11,0xb1,0x10,
-0x00,0x56,0x57,0x7d,0x77,0x20,0x1e,0x21,0x0b,0xb8,0x80,0x0b,0xc1,0xa0,0xc5,0x5b,
-0x00,0x19,0x1a,0x0b,0x22,0xb0,0x00,0x91,0xa0,0xd8,0x8b,0x00,0x09,0x1a,0x0d,0x88,
-0xb0,0x00,0x91,0xb1,0x22,0x22,0x00,0x09,0x17,0x88,0x88,0x83,0x36,0x00,0xf3,0x45,
-0x57,0x02,0xc1,0x00,0x00,0xc5,0xb8,0x88,0xb5,0x06,0xb4,0x84,0x44,0x95,0x2c,0xa5,
-0x85,0x55,0x51,0x12,0xa5,0xda,0xcc,0xa7,0x00,0xa6,0xc1,0x77,0x17,0x00,0xa8,0xaa,
-0xcc,0xa7,0x00,0xa9,0x91,0x77,0x17,0x00,0xa7,0x91,0x77,0x75,0x00,0x40,0x02,0x40,
-0x00,0x00,0xb8,0x9a,0xe9,0x94,0x06,0x50,0x66,0x66,0x40,0x2f,0x11,0xa2,0x23,0xa0,
-0xac,0x11,0x98,0x88,0x60,0x09,0x1b,0x88,0x88,0x96,0x09,0x19,0x99,0x99,0x86,0x09,
-0x10,0x00,0xa0,0x00,0x05,0x00,0x22,0x5a,0x70,0xcb,0x07,0xf2,0x19,0x29,0xd9,0xd0,
-0x1a,0x09,0x2a,0x0a,0x09,0xa2,0xf0,0xd9,0xd0,0x9a,0xbc,0x0a,0x1b,0x09,0xa2,0xa0,
-0xc8,0xd0,0x9a,0x0a,0x0a,0x1b,0x09,0xa0,0xa0,0x99,0x90,0x6a,0x0a,0x0a,0x2b,0x00,
-0xa0,0xa5,0x40,0x51,0x6c,0xd4,0x02,0xf0,0x00,0x92,0x95,0x3a,0x20,0x07,0x37,0xb9,
-0x8c,0x60,0x0e,0x4a,0xdc,0xbd,0xa2,0x9e,0x3a,0x07,0xf0,0x04,0x4a,0x7f,0xbb,0xc9,
+0x30,0x0a,0x01,0xb0,0x6e,0x02,0x10,0xa4,0x37,0x00,0x10,0x2b,0x9f,0x01,0xf4,0x02,
+0x0c,0x20,0x01,0xd0,0x00,0x07,0x80,0x09,0x50,0x00,0x01,0xd0,0x0a,0x00,0x00,0x00,
+0xa1,0x85,0x00,0xe0,0x07,0x73,0x00,0x08,0x02,0x73,0x42,0x00,0x1c,0x00,0xc2,0x00,
+0x00,0x58,0xc2,0x00,0x30,0xa3,0x00,0x0d,0x62,0x03,0x70,0x09,0x50,0x0a,0x50,0x00,
+0x04,0xb0,0x43,0x03,0x05,0x43,0x05,0x74,0x05,0x74,0x00,0x0a,0x02,0x95,0x74,0x2d,
+0x00,0x60,0x59,0x00,0x00,0xb2,0x00,0x0d,0x8c,0x00,0x70,0x09,0x60,0x0c,0x30,0x00,
+0x03,0xc0,0x34,0x05,0x02,0x91,0x04,0x50,0x90,0x00,0x09,0x91,0x0d,0x24,0x06,0x72,
+0xc0,0x16,0xc8,0x00,0x0e,0xcb,0x61,0x45,0x00,0x14,0x0c,0x69,0x06,0x51,0x08,0xdc,
+0xcd,0xd3,0x00,0x45,0x07,0xf4,0x01,0x00,0x00,0x67,0x30,0xd0,0x00,0x07,0x73,0x0c,
+0x00,0x6b,0x90,0x00,0xeb,0xb7,0x10,0x6b,0x03,0x04,0x59,0x03,0x35,0xcc,0xdd,0x30,
+0x31,0x01,0x42,0x7c,0xcc,0xcc,0xe7,0xae,0x03,0x00,0x45,0x00,0xd4,0x07,0x80,0x00,
+0x00,0x4d,0x00,0x00,0x06,0xd1,0x00,0x04,0xd8,0x10,0x23,0x00,0x10,0x24,0xd8,0x03,
+0x50,0x46,0x9c,0xcc,0xcc,0xd4,0x6a,0x03,0x13,0x20,0x6f,0x00,0x21,0x86,0x00,0x2b,
+0x00,0x74,0x00,0x6d,0x10,0x00,0x05,0xc9,0x10,0x47,0x01,0x73,0x00,0x37,0x69,0xcc,
+0xcc,0xce,0x85,0xcf,0x05,0x10,0x1d,0x3a,0x00,0x12,0x60,0xc7,0x02,0x62,0x06,0xc1,
+0x00,0x00,0x6c,0x81,0xa8,0x04,0x00,0x00,0x04,0x00,0x55,0x04,0x10,0xd6,0x40,0x05,
+0xe0,0x0b,0x60,0x00,0x0a,0x70,0x00,0xc5,0x00,0x19,0x00,0x00,0x1d,0x40,0x00,0xc3,
+0x07,0x04,0x4d,0x04,0x01,0x7b,0x02,0xf0,0x01,0x53,0xa0,0x00,0x0c,0xd3,0x19,0x40,
+0x00,0xb5,0x2d,0x30,0x00,0x09,0x80,0x02,0xd2,0x25,0x02,0x20,0x3d,0x10,0x39,0x01,
+0x30,0xd1,0x00,0x00,0x0e,0x01,0xf0,0x09,0x01,0x10,0x38,0x70,0x00,0x2d,0xd5,0x37,
+0x70,0x01,0xc2,0x0c,0x50,0x00,0x0c,0x40,0x01,0xc4,0x00,0x37,0x00,0x00,0x2d,0x30,
+0x34,0x01,0x13,0xe1,0x4b,0x00,0x12,0xc0,0x29,0x01,0x50,0x8c,0xbc,0xfb,0xbc,0x20,
+0x09,0x00,0xf2,0x00,0x07,0x60,0xc0,0x94,0x03,0xb0,0x0c,0x00,0xc1,0x71,0x00,0xc0,
+0x04,0x30,0x06,0x9c,0x05,0x05,0xd3,0x06,0xd2,0xb2,0x19,0x91,0x00,0x00,0xa2,0x05,
+0x10,0x3c,0xcc,0xec,0xcc,0x70,0x62,0x07,0xf0,0x07,0xa0,0xa2,0x47,0x00,0x09,0x50,
+0xa2,0x0c,0x20,0x5a,0x00,0xa2,0x03,0xa0,0x00,0x02,0xc2,0x00,0x00,0x00,0x19,0x80,
+0x30,0x00,0x72,0xb2,0x08,0x80,0x00,0x0a,0x20,0x66,0x2c,0x00,0x20,0x0a,0x20,0x2b,
+0x00,0xe2,0x28,0x00,0x95,0x0a,0x20,0xa2,0x5a,0x00,0xa2,0x02,0xa0,0x00,0x2c,0x20,
+0x29,0x00,0x91,0xcc,0xbb,0xbb,0xcc,0x10,0x00,0x00,0x06,0xa0,0xe5,0x05,0x70,0x6a,
+0x03,0xc2,0x00,0x00,0x6c,0xc1,0xdd,0x03,0x00,0x44,0x00,0x12,0x6b,0x79,0x00,0x80,
+0x02,0x74,0x10,0x00,0x01,0x58,0xbc,0x90,0x0d,0x00,0x71,0x09,0xb8,0x40,0x00,0x00,
+0x14,0x8c,0x24,0x04,0x82,0x3c,0xb7,0x30,0x00,0x00,0x15,0x9d,0x70,0x12,0x01,0x14,
+0x71,0xf1,0x01,0x22,0x05,0x80,0xfb,0x07,0x00,0xd7,0x01,0x10,0x57,0x3c,0x02,0xc4,
+0x0c,0x10,0x01,0xb7,0x57,0x9d,0x90,0x2b,0xa8,0x65,0x31,0xd1,0x64,0x01,0x00,0xf2,
+0x05,0xf5,0x0a,0xc0,0x06,0xa0,0x09,0x50,0x00,0x5d,0x6c,0x00,0x00,0x03,0xf8,0x00,
+0x00,0x0c,0x6c,0x70,0x03,0xc6,0x00,0xb6,0x7d,0x30,0x00,0x01,0x4d,0x03,0x54,0xbb,
+0xfb,0xbb,0x30,0x00,0xb3,0x08,0x47,0xac,0xbf,0xbb,0xbc,0xbc,0x08,0x36,0x8e,0xcd,
+0x90,0x1e,0x01,0x00,0x49,0x01,0xd0,0x97,0x8a,0xd6,0x4b,0xab,0x21,0xb0,0x00,0x0c,
+0x0b,0x20,0x00,0x0b,0x19,0x05,0x00,0x3c,0x03,0x41,0x70,0x00,0x00,0x56,0xbb,0x08,
+0xf4,0x02,0x00,0x36,0x90,0x14,0x7f,0xcb,0x88,0xa0,0x28,0x4a,0x40,0x1c,0x10,0x00,
+0x05,0x90,0xc3,0xed,0x02,0x10,0xc1,0x05,0x00,0x10,0x76,0x05,0x00,0x12,0x22,0x4c,
+0x00,0x60,0x04,0xcb,0xbd,0x70,0x00,0x00,0x7c,0x07,0xe1,0x09,0x40,0x00,0x00,0x0b,
+0x10,0x3c,0xcc,0xcd,0xc9,0x01,0xdc,0xcc,0xc9,0xb4,0x09,0x00,0x05,0x00,0x13,0x68,
+0x63,0x04,0x00,0x40,0x03,0xd1,0x2a,0xaa,0xaa,0xea,0xa2,0x02,0x22,0x22,0x22,0x20,
+0x7a,0xaa,0xa8,0xcd,0x01,0x20,0x0c,0x5b,0xa7,0x00,0x43,0x0c,0xab,0xbb,0xbc,0x05,
+0x03,0x30,0x6c,0xcc,0xcc,0xf0,0x01,0x10,0xb1,0x04,0x00,0x35,0x3c,0xbb,0xbb,0x0c,
+0x00,0x40,0x8c,0xcc,0xcc,0xf1,0x53,0x01,0x81,0x07,0xa9,0x99,0xa0,0x01,0x21,0x11,
+0x20,0xf7,0x02,0x31,0xbb,0xbb,0xd9,0x64,0x05,0x00,0x97,0x03,0xf1,0x02,0x00,0x4c,
+0x20,0x00,0x5b,0xb1,0x00,0x00,0x42,0x00,0x00,0xa0,0x00,0x0a,0xd0,0x00,0x0d,0x03,
+0x00,0xd1,0x0c,0xd0,0x00,0x2b,0x10,0x00,0x86,0x00,0x06,0xc0,0x01,0xca,0x10,0x08,
+0x03,0x10,0x06,0xa5,0x05,0x00,0x14,0x01,0x10,0x38,0x70,0x00,0x10,0x48,0x05,0x00,
+0xf0,0x05,0x66,0x0c,0x00,0x20,0x00,0xa3,0x0c,0x01,0xc2,0x02,0xc0,0x0c,0x4d,0x30,
+0x0d,0x30,0x0d,0xa1,0x00,0x01,0x0e,0x07,0x12,0x60,0x3d,0x01,0x14,0xd0,0x07,0x00,
+0xa2,0x04,0xad,0x00,0x08,0xb1,0xd0,0x6c,0x70,0x0d,0xc6,0xfc,0x00,0x88,0xac,0xcc,
+0xcc,0xd1,0xb1,0x00,0x00,0xa2,0x04,0x00,0x84,0xb2,0x11,0x11,0xb2,0xcb,0xbb,0xbb,
+0xe2,0x6c,0x01,0xf1,0x0c,0xdc,0xcc,0xcc,0xe6,0xd0,0x00,0x00,0x94,0xd0,0x00,0x00,
+0xc1,0x50,0x00,0x02,0xb0,0x00,0x00,0x0c,0x40,0x00,0x01,0xc6,0x00,0x00,0x9d,0x50,
+0xdc,0x01,0x10,0x01,0x7d,0x05,0x10,0xd6,0x2a,0x00,0x10,0xb7,0xa4,0x0a,0xf3,0x03,
+0x10,0x02,0xd0,0x00,0x00,0x01,0xd3,0x00,0x00,0x03,0xd4,0x00,0x00,0x3a,0xc2,0x00,
+0x04,0xeb,0xba,0x04,0x00,0x9b,0x03,0xf8,0x05,0x11,0xdd,0xcc,0xcc,0xdd,0x01,0x11,
+0x11,0x11,0x10,0x3b,0xbb,0xbb,0xbb,0xb9,0x00,0x00,0x92,0x00,0x00,0x05,0x00,0x3b,
+0x9c,0xbb,0x90,0x14,0x00,0x51,0x2a,0xaa,0xdb,0xaa,0xa7,0x32,0x00,0x53,0x2b,0xbb,
+0xbb,0xbb,0xb7,0xdf,0x01,0x01,0x8e,0x05,0x10,0x5d,0x8f,0x05,0x30,0x56,0x2c,0x80,
+0x14,0x00,0x13,0x50,0x19,0x00,0x04,0x05,0x00,0x80,0x0b,0xbb,0xbb,0xbb,0xb5,0x00,
+0x00,0x1d,0x32,0x01,0x00,0x17,0x04,0xe3,0x09,0xa9,0xb6,0x00,0x01,0xc7,0x39,0x09,
+0x90,0x1d,0x40,0x39,0x00,0x77,0x69,0x06,0x04,0x05,0x00,0x12,0x1b,0x5a,0x00,0xf3,
+0x02,0x38,0x00,0x00,0x07,0xbb,0xcd,0xbb,0xb1,0x0a,0x00,0x38,0x00,0x92,0x0a,0x19,
+0x38,0x36,0x05,0x00,0x40,0x1d,0xbd,0xb6,0x92,0x59,0x05,0x00,0x05,0x00,0xe4,0x0a,
+0xc1,0x00,0x09,0x20,0x00,0xbb,0xbe,0xcb,0xb5,0xb0,0x09,0x20,0x37,0x04,0x00,0x40,
+0xeb,0xbe,0xcb,0xc7,0x18,0x00,0x05,0x04,0x00,0x00,0x1e,0x0c,0xf0,0x22,0x06,0xaa,
+0xbb,0xa8,0x40,0x03,0x44,0x89,0x44,0x40,0x04,0xa7,0x89,0x5c,0x50,0x1a,0xdb,0xcc,
+0xae,0xa6,0x00,0x83,0x46,0x0b,0x00,0x09,0xdb,0xcd,0xae,0xa2,0x00,0x09,0xcc,0xa1,
+0x00,0x05,0xc5,0x46,0x3c,0x71,0x17,0x00,0x46,0x00,0x66,0x9b,0xbb,0xbb,0xba,0x8b,
+0x04,0x51,0x40,0x00,0x00,0x5b,0x30,0x1b,0x0c,0x30,0x00,0x01,0xa0,0xd3,0x09,0x07,
+0x09,0x00,0x30,0x01,0xbb,0x60,0xdf,0x05,0xf2,0x1c,0x10,0xb0,0x00,0x04,0x80,0xb0,
+0xb1,0x50,0x1e,0x20,0xb4,0xea,0xc0,0xbc,0x48,0xe6,0xb0,0xb0,0x19,0x32,0xb0,0xb0,
+0xb0,0x09,0x20,0xb0,0xb9,0x90,0x09,0x20,0xb0,0xa0,0x00,0x09,0x20,0xb0,0x00,0x64,
+0x09,0x20,0x9b,0xaa,0xb1,0x78,0x01,0xf0,0x0c,0x38,0x00,0x09,0x10,0x00,0xb1,0x00,
+0x09,0x10,0x05,0xc5,0xbb,0xbe,0xc4,0x2d,0xb0,0x00,0x09,0x10,0x22,0xb0,0x92,0x09,
+0x10,0x00,0xb0,0x2b,0x05,0x00,0x10,0x06,0x05,0x00,0x11,0x00,0x0a,0x00,0x18,0xad,
+0xc4,0x06,0xf6,0x13,0x66,0x51,0xb0,0x00,0x00,0xc0,0xc2,0xc1,0x10,0x09,0xa2,0xd9,
+0xe9,0x92,0x3b,0x96,0x20,0xb0,0x00,0x01,0x96,0x99,0xe9,0x97,0x01,0x90,0x11,0xc1,
+0x11,0x01,0x90,0x00,0xb0,0x00,0x05,0x00,0x03,0x19,0x08,0x01,0x9b,0x01,0xe0,0x13,
+0x6a,0xb0,0x00,0xc5,0x97,0xc1,0x00,0x08,0xb0,0x00,0xb0,0x00,0x5b,0x05,0x00,0x60,
+0x20,0xb9,0xbb,0xeb,0xb7,0x00,0x0a,0x00,0x03,0x05,0x00,0xa0,0x11,0xc1,0x10,0x00,
+0xb4,0x99,0x99,0x95,0x00,0x04,0xb9,0x01,0x10,0x65,0xcf,0x03,0xf0,0x07,0xc1,0xbb,
+0xcb,0xb3,0x0a,0xb0,0x21,0x01,0x40,0x39,0xb0,0x55,0x04,0x80,0x00,0xb0,0x29,0x06,
+0x40,0x00,0xb0,0x0b,0x96,0x00,0xf0,0x00,0x0a,0x0b,0x00,0x00,0xb5,0x99,0x9d,0x96,
+0x00,0xb1,0x22,0x22,0x21,0x00,0x13,0x5e,0x0a,0xf0,0x05,0x93,0x8a,0xbd,0x50,0x01,
+0xc0,0xb0,0x0b,0x00,0x0a,0xa0,0xb0,0x0b,0x00,0x5a,0xa0,0xeb,0xbe,0xb8,0x11,0x0a,
+0x00,0xf7,0x05,0x01,0xa0,0xb0,0x09,0x10,0x01,0xa0,0xb0,0x36,0x42,0x01,0xa0,0xb2,
+0x94,0x98,0x01,0xa3,0xc7,0x26,0x96,0xd2,0x00,0xf0,0x1f,0xa0,0x06,0x40,0x00,0x06,
+0x69,0x9c,0xb9,0x92,0x1e,0x22,0x3f,0xe2,0x20,0xab,0x10,0x89,0x96,0x00,0x09,0x10,
+0xa6,0x4b,0x00,0x09,0x29,0x36,0x45,0x80,0x09,0x77,0xad,0xc9,0x93,0x09,0x20,0x06,
+0x40,0x00,0x09,0x10,0x06,0x40,0x00,0x00,0x02,0xce,0x00,0x20,0x57,0x0c,0x32,0x04,
+0xd4,0x5e,0xbb,0xb9,0x09,0xc1,0xc0,0xb0,0x00,0x3a,0xb7,0x30,0xea,0xa6,0xc8,0x00,
+0x77,0xe9,0x96,0x00,0xb0,0x00,0xc1,0x11,0xd7,0x00,0x06,0x01,0x00,0xf0,0x04,0x05,
+0x70,0x0b,0x00,0x00,0x00,0xb5,0x88,0xd8,0x88,0x00,0xaa,0x29,0x9e,0x99,0x70,0x58,
+0xa4,0x60,0xad,0x00,0xd0,0x4c,0x9e,0x9a,0xb0,0x00,0xa0,0x70,0xb0,0x00,0x00,0x0a,
+0x06,0xb7,0x90,0x00,0x92,0x4d,0xb6,0x10,0x00,0x0a,0x98,0x00,0x6b,0xb0,0x79,0x08,
+0xf0,0x01,0x75,0xea,0xaa,0xe0,0x01,0xc0,0xb0,0x00,0xb0,0x0b,0xa0,0xd9,0x99,0xe0,
+0x57,0xa0,0x55,0x00,0xf3,0x09,0xa7,0xaa,0xea,0xa6,0x00,0xa0,0x09,0xe9,0x00,0x00,
+0xa0,0x67,0xb7,0x50,0x00,0xa8,0xa0,0xb0,0xb5,0x00,0xa4,0x00,0xb0,0x03,0x53,0x03,
+0x00,0x81,0x03,0x10,0x83,0x12,0x08,0xf3,0x0e,0xb6,0x99,0xb9,0x96,0x09,0x90,0x11,
+0x11,0x10,0x3c,0x90,0x78,0x88,0x70,0x01,0x90,0x67,0x77,0x60,0x00,0x90,0x99,0x99,
+0x90,0x00,0x90,0xa0,0x00,0xa0,0x05,0x00,0xf0,0x26,0xd9,0x99,0xc0,0x00,0x40,0x04,
+0x10,0x00,0x02,0x90,0x0e,0x76,0x60,0x09,0x20,0xac,0x35,0xb0,0x3f,0x09,0x53,0xbb,
+0x10,0xbc,0x0b,0x7a,0x79,0xa3,0x1a,0x0a,0x22,0x92,0x01,0x0a,0x0a,0x26,0x39,0x10,
+0x0a,0x0a,0x19,0x71,0xa2,0x0a,0x00,0x02,0x7c,0x40,0x0a,0x00,0xa9,0x40,0x00,0xf2,
+0x24,0x00,0x00,0x01,0x00,0x00,0x00,0xb0,0x05,0x70,0x00,0x05,0x77,0xb9,0x9c,0xa0,
+0x1e,0x20,0xa0,0x0b,0x00,0xad,0x25,0x96,0x7b,0x51,0x19,0x24,0x44,0x44,0x41,0x09,
+0x13,0xca,0xab,0x60,0x09,0x14,0x60,0x03,0x70,0x09,0x14,0xc8,0x8a,0x70,0x09,0x14,
+0x71,0x15,0x70,0x00,0x01,0x00,0xf2,0x21,0xb1,0x11,0xb1,0x10,0x00,0x56,0x57,0x7d,
+0x77,0x20,0x1e,0x21,0x0b,0xb8,0x80,0x0b,0xc1,0xa0,0xc5,0x5b,0x00,0x19,0x1a,0x0b,
+0x22,0xb0,0x00,0x91,0xa0,0xd8,0x8b,0x00,0x09,0x1a,0x0d,0x88,0xb0,0x00,0x91,0xb1,
+0x22,0x22,0x00,0x09,0x17,0x88,0x88,0x83,0x36,0x00,0xf3,0x45,0x57,0x02,0xc1,0x00,
+0x00,0xc5,0xb8,0x88,0xb5,0x06,0xb4,0x84,0x44,0x95,0x2c,0xa5,0x85,0x55,0x51,0x12,
+0xa5,0xda,0xcc,0xa7,0x00,0xa6,0xc1,0x77,0x17,0x00,0xa8,0xaa,0xcc,0xa7,0x00,0xa9,
+0x91,0x77,0x17,0x00,0xa7,0x91,0x77,0x75,0x00,0x40,0x02,0x40,0x00,0x00,0xb8,0x9a,
+0xe9,0x94,0x06,0x50,0x66,0x66,0x40,0x2f,0x11,0xa2,0x23,0xa0,0xac,0x11,0x98,0x88,
+0x60,0x09,0x1b,0x88,0x88,0x96,0x09,0x19,0x99,0x99,0x86,0x09,0x10,0x00,0xa0,0x00,
+0x05,0x00,0xf1,0x21,0x5a,0x70,0x00,0x00,0x10,0x00,0x00,0x00,0x29,0xd9,0xd0,0x1a,
+0x09,0x2a,0x0a,0x09,0xa2,0xf0,0xd9,0xd0,0x9a,0xbc,0x0a,0x1b,0x09,0xa2,0xa0,0xc8,
+0xd0,0x9a,0x0a,0x0a,0x1b,0x09,0xa0,0xa0,0x99,0x90,0x6a,0x0a,0x0a,0x2b,0x00,0xa0,
+0xa5,0x40,0x51,0x6c,0x90,0x00,0xf0,0x18,0x01,0x92,0x95,0x3a,0x20,0x07,0x37,0xb9,
+0x8c,0x60,0x0e,0x4a,0xdc,0xbd,0xa2,0x9e,0x06,0xa0,0x00,0x00,0x4a,0x7f,0xbb,0xc9,
 0xb0,0x0a,0x28,0x99,0xb7,0xb0,0x0a,0x07,0xaa,0xc8,0xb0,0x0a,0x07,0x33,0x70,0x05,
-0x00,0x50,0x76,0x80,0x00,0x20,0x21,0x9d,0x06,0xf3,0x1c,0xd9,0xa2,0x00,0x06,0x7a,
-0x41,0xb1,0x00,0x1e,0x7e,0x8b,0xa8,0xb0,0xad,0x19,0x9d,0x98,0xa0,0x19,0x14,0xba,
-0x02,0x50,0x09,0x36,0x4a,0xbd,0x10,0x09,0x3a,0x67,0xb7,0x30,0x09,0x14,0xa3,0xa1,
-0xc2,0x09,0x46,0x2a,0x60,0x11,0xf8,0x06,0x36,0xbb,0xbb,0x80,0x3e,0x02,0x81,0x1b,
-0xbc,0xbb,0xcb,0xb7,0x00,0x0a,0x10,0x0a,0x15,0x10,0xb0,0x8a,0x0a,0xc8,0xb0,0x05,
-0x00,0xb3,0x00,0xb0,0x0a,0x1c,0x40,0x00,0xab,0xc6,0xb2,0x19,0x10,0x2b,0xe9,0x04,
-0xf2,0x17,0xbc,0xbb,0xb6,0x00,0x0b,0x30,0x52,0x00,0x00,0x95,0x00,0x2c,0x30,0x05,
-0xdc,0xdb,0xe9,0xc1,0x00,0x07,0x50,0xb0,0x10,0x00,0x0b,0x20,0xb0,0x03,0x00,0x5a,
-0x00,0xb0,0x0b,0x0b,0xa0,0x00,0xbb,0xc6,0xa8,0x0e,0x20,0x53,0x29,0x9d,0x0a,0x90,
-0xce,0xbb,0xa0,0x05,0x70,0x29,0x00,0x00,0x03,0x0a,0x0f,0x55,0x1b,0xbd,0xcb,0xeb,
-0xb6,0x6e,0x00,0xb8,0x01,0x00,0x96,0x00,0xb0,0x0a,0x1b,0x70,0x00,0x9b,0xb5,0x2c,
-0x17,0x10,0x30,0xa6,0x00,0x01,0xcd,0x07,0x11,0x9a,0x01,0x17,0x60,0x30,0x00,0x00,
-0x04,0xa2,0xb0,0xf7,0x0d,0xf1,0x05,0x95,0x00,0x00,0x88,0x00,0x1d,0x20,0x09,0xa0,
-0x00,0x03,0xd3,0x26,0x00,0x00,0x00,0x23,0x00,0x00,0x12,0x4d,0x1a,0xf0,0x05,0x10,
-0x00,0x00,0x1b,0x33,0xc1,0x00,0x05,0xc3,0x00,0x2c,0x50,0x69,0xba,0xaa,0xab,0xa7,
-0x00,0x00,0x55,0x5c,0x16,0x32,0xcc,0xaa,0x00,0x0a,0x00,0x20,0x00,0x55,0xde,0x05,
-0x33,0xcc,0xaa,0xa2,0xdb,0x0d,0x20,0x00,0xc1,0x09,0x07,0xf1,0x00,0x3a,0x00,0x05,
-0xb0,0x10,0x08,0x80,0x2c,0x00,0xc2,0x00,0xa5,0x01,0x06,0x90,0x19,0x00,0x10,0x93,
-0x7a,0x0b,0x70,0x2d,0x10,0x07,0xec,0xbb,0xaa,0xa0,0x2b,0x00,0x50,0x70,0x00,0x0b,
-0x00,0x56,0xaf,0x00,0x72,0x66,0x00,0x09,0xae,0xaa,0xcc,0xa4,0x0f,0x00,0x00,0x05,
-0x00,0x00,0x24,0x06,0xd0,0xb8,0x00,0x08,0x00,0x62,0x00,0x01,0xa6,0x00,0x1b,0x50,
-0x0a,0x40,0xb4,0x07,0x60,0xba,0x99,0x9c,0x40,0x00,0xb9,0x05,0x00,0xf0,0x10,0xb1,
-0x11,0x18,0x40,0x00,0xb8,0x77,0x7b,0x40,0x00,0xb8,0x88,0x8c,0x40,0x00,0xb0,0x00,
-0x07,0x40,0x2a,0xac,0xaa,0xcb,0xa7,0x01,0x9a,0x00,0x4b,0x60,0x1a,0x30,0xf5,0x37,
-0xf0,0x0f,0x02,0x90,0x00,0x0b,0xbb,0xce,0xbb,0xb5,0xb0,0x03,0x80,0x04,0x6b,0x00,
-0x7a,0x00,0x46,0xb0,0x0c,0x7a,0x04,0x6b,0x1b,0x40,0x6a,0x46,0xb9,0x30,0x00,0x77,
-0x22,0x09,0xf0,0x05,0x46,0xb0,0x00,0x01,0xbc,0x40,0xbb,0xbb,0xbb,0xbb,0x6b,0x00,
-0x19,0x00,0x38,0xb0,0x01,0x90,0x03,0x8b,0x09,0x00,0x50,0xeb,0xbb,0xbb,0xbc,0x8b,
-0x6f,0x05,0x44,0xb0,0x00,0x00,0x03,0x09,0x00,0xf2,0x44,0xac,0x50,0x0a,0xbb,0xcd,
-0xbb,0xb4,0x00,0x00,0x28,0x00,0x00,0x02,0xda,0xbd,0xab,0x90,0x02,0x80,0x28,0x01,
-0x90,0x02,0xda,0xbd,0xaa,0x90,0x04,0x91,0x49,0x13,0xa1,0x3a,0xd9,0x99,0x9a,0xd7,
-0x02,0x80,0x00,0x01,0x90,0x02,0x80,0x00,0x7b,0x60,0x31,0x0a,0x20,0x05,0x07,0x30,
-0xa2,0x00,0xb0,0x73,0x0a,0x20,0x0b,0x07,0xcb,0xec,0xbb,0xb0,0x10,0x0a,0x20,0x01,
-0x0c,0x00,0xa2,0x00,0xa2,0xc0,0x0a,0x20,0x0a,0x2e,0xbb,0xec,0xbb,0xe2,0x72,0x11,
-0x30,0x02,0x00,0x20,0xa9,0x0c,0x10,0xa3,0x1b,0x01,0xe0,0x1c,0x00,0x09,0x80,0x00,
-0x05,0xb0,0x4b,0xbb,0xbb,0xbb,0x74,0x00,0x04,0x7c,0x04,0x30,0x08,0x40,0x0c,0x20,
-0x01,0x10,0x0c,0x18,0x10,0x53,0x0c,0x00,0x1c,0x50,0x0b,0x37,0x02,0x02,0x49,0x0f,
-0xf0,0x0b,0xb0,0x99,0x99,0x90,0x2a,0xb8,0x12,0xc1,0xb0,0x00,0x37,0x01,0xa0,0xb0,
-0x00,0xb5,0x12,0x80,0xb0,0x08,0xf9,0x05,0x50,0xb0,0x39,0xcb,0x3b,0x06,0x20,0xb0,
-0x1b,0xcf,0x04,0x72,0xa4,0x00,0xb0,0x00,0xb5,0x60,0x6b,0xbc,0x07,0xf5,0x1a,0x0e,
-0xaa,0xd0,0x00,0xb0,0xa0,0x0b,0x0b,0x0b,0x0c,0x33,0xb0,0xb0,0xb0,0x7d,0x76,0x0b,
-0x0b,0x00,0xd7,0x70,0xb0,0xb0,0x3a,0x3b,0x0b,0x0b,0x06,0x40,0xa0,0x50,0xb0,0xb0,
-0x0b,0x00,0x0b,0x64,0x4a,0x70,0x2b,0xc0,0x32,0x02,0xf0,0x16,0x16,0x8a,0x81,0x10,
-0xa1,0x02,0x29,0x00,0x91,0xa1,0x15,0x7c,0x54,0x91,0xa1,0x14,0x9d,0x53,0x91,0xa1,
-0x00,0xcd,0x80,0x91,0xa1,0x07,0x79,0x65,0x91,0xa1,0x3b,0x29,0x00,0x20,0xa1,0x11,
-0x19,0xac,0x0c,0x32,0x19,0x00,0x1b,0x36,0x00,0x00,0x79,0x01,0xf2,0x15,0x4a,0xdc,
-0xaa,0x54,0xb0,0x2a,0x05,0x05,0x4b,0x0d,0xa9,0x80,0x54,0xb0,0x23,0xb1,0x75,0x4b,
-0x06,0xa1,0xb3,0x54,0xb1,0x60,0x9b,0x02,0x2b,0x03,0xb5,0x78,0x00,0xb2,0xb1,0x00,
-0x50,0xac,0x5f,0x00,0xf2,0x0e,0x55,0x64,0x00,0xb0,0xb5,0x5b,0x0b,0x0b,0x0a,0xbb,
-0xa0,0xb0,0xb0,0xb1,0x1b,0x0b,0x0b,0x0e,0xaa,0xe0,0xb0,0xb0,0xb0,0x0b,0x0b,0x0b,
-0x0e,0x99,0xe0,0x91,0x00,0x53,0x0b,0x09,0xc0,0x2a,0xc0,0xe5,0x0b,0x10,0x03,0x2e,
-0x0d,0xf0,0x04,0x1b,0x00,0x2a,0xad,0xaa,0xcc,0xa7,0x01,0x33,0x30,0x10,0x40,0x09,
-0x76,0xd0,0xb0,0xb0,0x09,0x99,0x05,0x00,0x21,0x10,0xa0,0x0a,0x00,0x10,0xa0,0x0a,
-0x00,0x76,0x00,0xb0,0x09,0x18,0xb0,0x1a,0xc0,0xfa,0x02,0xf2,0x1e,0x02,0x2c,0x22,
-0x00,0x0a,0x1b,0x59,0x5c,0x27,0x0a,0x05,0x8d,0x85,0x2a,0x0a,0x02,0x8d,0x82,0x2a,
-0x0a,0x08,0x8d,0x88,0x2a,0x0a,0x00,0x0a,0x00,0x2a,0x0a,0x07,0xba,0xb7,0x16,0x0a,
-0x07,0x98,0x97,0x00,0x0a,0x07,0x20,0x17,0x07,0xb7,0x98,0x0a,0x20,0x00,0xc0,0x52,
-0x08,0x32,0xfb,0xbb,0xe0,0x17,0x06,0x00,0xcd,0x06,0x00,0x1f,0x0b,0x30,0xc0,0x00,
-0x4b,0x05,0x39,0x85,0xd1,0x00,0x04,0x80,0x2c,0x10,0x05,0xbc,0x31,0x0e,0x41,0xb0,
-0x00,0x5a,0xda,0x47,0x07,0xf4,0x12,0xbb,0xeb,0xe1,0x01,0x90,0x02,0x90,0xb0,0x01,
-0x90,0x04,0x70,0xb0,0x01,0xb7,0x18,0x30,0xb0,0x7c,0x94,0x1c,0x00,0xb0,0x10,0x00,
-0xb4,0x00,0xb0,0x00,0x0b,0x50,0x6b,0x60,0x30,0x00,0xf7,0x16,0x22,0x24,0xbe,0xba,
-0x5a,0x6d,0x00,0xb0,0xb5,0x50,0xb0,0x29,0x0b,0x55,0x0b,0x03,0x70,0xb5,0x50,0xb0,
-0x55,0x0b,0x55,0x0b,0x0a,0x21,0xa5,0x50,0xb1,0xc0,0x48,0x5d,0xbe,0x66,0x8c,0x25,
-0x50,0x90,0x06,0xf6,0x1d,0xb1,0x00,0xa0,0x00,0x59,0xb9,0x90,0xa0,0x00,0x08,0x15,
-0x28,0xeb,0xe0,0x3a,0x02,0xb0,0xa0,0xa0,0x45,0x2b,0x30,0xa0,0xa0,0x00,0xb8,0x01,
-0x80,0xa0,0x00,0xbb,0x05,0x50,0xa0,0x09,0x55,0x3b,0x00,0xb0,0x65,0x00,0x75,0x5b,
-0x70,0x36,0x00,0xf7,0x1e,0x58,0xc6,0x20,0xb0,0x00,0x8b,0xeb,0xb2,0xb0,0x00,0x36,
-0xc7,0x6a,0xeb,0xe1,0x74,0xa3,0xb0,0xa0,0xa1,0x78,0xc8,0xc0,0xa0,0xa0,0x47,0xc8,
-0x82,0x80,0xb0,0x48,0xd9,0x88,0x50,0xb0,0x02,0xb7,0x8d,0x00,0xb0,0x78,0x64,0xb3,
-0x4b,0x70,0x00,0x08,0x20,0x3a,0x0c,0x8e,0x0c,0xf0,0x06,0x0c,0x00,0x53,0x06,0xe0,
-0x0c,0x03,0xc1,0x3c,0xc0,0x0c,0x3d,0x20,0x22,0xc0,0x0d,0xb1,0x00,0x00,0xc2,0xbe,
-0xb3,0x11,0xf1,0x26,0x3c,0x00,0x08,0x00,0xc0,0x0c,0x00,0x1a,0x00,0xc0,0x09,0xcb,
-0xc4,0x00,0x10,0x30,0x00,0x20,0x01,0xb0,0x75,0x08,0x50,0x02,0xcb,0xad,0xae,0x80,
-0x04,0x70,0x28,0x00,0xc0,0x04,0xc9,0xad,0x99,0xc0,0x04,0x93,0x6a,0x33,0xc0,0x01,
-0x66,0x8b,0x66,0x50,0x2a,0xaa,0xbd,0xaa,0xa7,0x3f,0x03,0x02,0x05,0x00,0x00,0xb3,
-0x04,0x52,0x05,0xbb,0xce,0xbb,0xb0,0xc7,0x13,0x00,0x05,0x00,0xf0,0x1f,0x2b,0xbc,
-0xfb,0xbb,0xb8,0x00,0x09,0x40,0x52,0x00,0x00,0x48,0x00,0x1c,0x00,0x03,0xd6,0x68,
-0x9d,0x90,0x03,0x75,0x43,0x10,0x81,0x00,0x01,0x24,0x68,0x90,0x08,0xc8,0x89,0x42,
-0x50,0x00,0xa2,0x0b,0x05,0x70,0x0a,0xcc,0xac,0xae,0xa7,0x0a,0xcf,0x04,0xf1,0x0a,
-0x04,0x6b,0xaa,0xab,0x34,0x00,0x0a,0x30,0x4b,0x00,0x00,0x00,0xb8,0xb1,0x00,0x01,
-0x59,0xb9,0xb7,0x30,0x0a,0x73,0x00,0x04,0x87,0x32,0x0b,0x03,0xc2,0x01,0x32,0xeb,
-0xbb,0xb6,0xdb,0x14,0x01,0x0f,0x10,0xb0,0xcd,0xbb,0xbb,0xb0,0x0b,0x6a,0x00,0x00,
-0xb0,0x24,0x1a,0x84,0x01,0x60,0x1e,0xbb,0xbb,0xc0,0x00,0x1a,0x18,0x07,0xf0,0x06,
-0xca,0xaa,0xad,0x00,0x05,0x71,0x11,0x1c,0x00,0x03,0x88,0x88,0x87,0x00,0x59,0x99,
-0x99,0x99,0x90,0x01,0xa3,0xa2,0x1e,0x31,0xfb,0xaa,0xa9,0xce,0x05,0x10,0x00,0xa5,
-0x0b,0x00,0xfe,0x0f,0x28,0xb1,0x00,0x28,0x09,0x10,0x8a,0x2c,0x0f,0x20,0x77,0x90,
-0x36,0x13,0x72,0x4c,0x40,0x4b,0x7a,0xaa,0xa6,0xa3,0x1d,0x00,0x30,0xea,0xaa,0xae,
-0x61,0x00,0x15,0x0c,0x0a,0x00,0xf0,0x03,0x0b,0x00,0xeb,0xbb,0xbb,0xbe,0xb1,0x44,
-0x44,0x2b,0xb2,0x55,0x55,0x2b,0xb0,0x99,0x99,0x0b,0x8b,0x03,0x01,0x04,0x00,0xd0,
-0xda,0xab,0x0b,0xb0,0x20,0x00,0x0b,0xb0,0x00,0x01,0xbb,0x00,0x04,0x35,0x13,0xf0,
-0x0c,0xfa,0x99,0x70,0x07,0xa2,0x11,0x85,0x03,0x73,0x80,0x69,0x00,0x00,0x07,0xd7,
-0x00,0x00,0x4a,0xfc,0x99,0x90,0x67,0xc1,0x11,0x1c,0x00,0x0a,0x4b,0x00,0x32,0xaa,
-0xaa,0xae,0x09,0x00,0x21,0x04,0x10,0x12,0x0c,0x40,0xbb,0xce,0xbb,0xbb,0x9c,0x12,
-0x72,0xb0,0xaa,0xaa,0x0b,0xb0,0xa0,0x0a,0x04,0x00,0x50,0xda,0xaa,0x0b,0xb0,0x30,
-0x55,0x00,0xf2,0x07,0x05,0xbb,0x0b,0xbb,0xbf,0xcb,0xb5,0x00,0x00,0xab,0x20,0x00,
-0x00,0x5c,0x79,0x6b,0x50,0x1d,0x81,0x29,0x00,0x87,0xb6,0x12,0x40,0xea,0xaa,0xab,
-0x70,0x48,0x00,0xb2,0x70,0x00,0xe9,0x99,0x9b,0x70,0x00,0xc1,0x11,0x15,0x70,0xab,
-0x11,0x10,0x01,0xf9,0x05,0xe2,0x4b,0x42,0xb4,0x00,0x2c,0x91,0x68,0x18,0xc3,0x01,
-0xaa,0xab,0xa6,0x10,0x01,0x0d,0x30,0xaa,0xac,0xda,0xca,0x0a,0x62,0x0b,0x00,0x01,
-0xd9,0x99,0x9e,0x0a,0x00,0xf2,0x07,0x00,0x73,0x0c,0x00,0x00,0x01,0xdb,0xae,0xaa,
-0x90,0x0a,0x20,0x0c,0x00,0x00,0x1b,0xaa,0xae,0xaa,0xa6,0x00,0x00,0x62,0x1d,0x20,
-0xac,0x60,0x5f,0x00,0xf1,0x24,0x60,0x00,0xd9,0x99,0x9b,0x60,0x00,0xb1,0x11,0x15,
-0x60,0x0a,0xbb,0xbb,0xbb,0xb0,0xa1,0x0b,0x00,0x0b,0x0a,0x39,0xe9,0x91,0xb0,0xa4,
-0x7d,0x77,0x3b,0x0b,0x12,0x22,0x21,0xb0,0xb0,0xd9,0x9c,0x0b,0x0b,0x0a,0x00,0xb0,
-0xb4,0x80,0xd9,0x97,0x0b,0x91,0x01,0x00,0x7b,0x49,0x07,0xf2,0x04,0xe9,0xa7,0xb9,
-0x9e,0xe8,0x97,0xb8,0x8e,0xc1,0x37,0xb1,0x1c,0xd7,0x73,0x57,0x7d,0xb0,0x89,0x96,
-0xdd,0x00,0xf0,0x0a,0xb0,0x0a,0x0b,0xb0,0xb9,0x96,0x0c,0xb0,0x00,0x04,0xbb,0x08,
-0xba,0x94,0xca,0xd0,0x08,0x21,0x94,0x50,0xb0,0x06,0xaa,0xa4,0xba,0xec,0x0a,0xf0,
-0x0c,0x4a,0x00,0x2a,0xaf,0xaa,0xeb,0xa7,0x04,0xc5,0x00,0x2b,0x71,0x2b,0xb8,0xb5,
-0xb8,0xd5,0x05,0x50,0xb5,0x50,0xb0,0x05,0xca,0xa5,0xca,0xb0,0x83,0x01,0x10,0x1b,
-0xc9,0x00,0x90,0xb0,0x8a,0xaa,0x0b,0x1b,0x0b,0x00,0xb0,0xb1,0x6d,0x04,0x50,0x1b,
-0x0b,0xaa,0xd0,0xb1,0x41,0x01,0x60,0x1e,0xbb,0xbb,0xbb,0xe1,0xb0,0x3e,0x0e,0x00,
-0x29,0x00,0xf1,0x15,0x0b,0x00,0x80,0x80,0xb0,0xb5,0xad,0x9d,0x8b,0x0b,0x01,0x90,
-0xa0,0xb0,0xb6,0xad,0xae,0x8b,0x0b,0x07,0x40,0xa0,0xb0,0xb3,0x90,0x0a,0x0b,0x0e,
-0x99,0x99,0x99,0xe0,0xc1,0x11,0x11,0x1b,0xd5,0x01,0xf2,0x00,0xb0,0x04,0x30,0x0b,
-0xb6,0x9c,0xb9,0x6b,0xb0,0x05,0x40,0x0b,0xb0,0xc9,0x9c,0xa3,0x00,0xf1,0x08,0x98,
-0x89,0x0b,0xe9,0x99,0x99,0x9e,0xb1,0x11,0x11,0x1c,0xea,0xaa,0xaa,0xae,0xb3,0x99,
-0x99,0x5c,0xb0,0x12,0xa1,0x0c,0x04,0x00,0xb0,0x89,0xda,0x3c,0xb0,0x01,0x96,0x2c,
-0xb4,0x88,0x88,0x6c,0x1c,0x00,0x00,0x82,0x07,0x00,0x18,0x01,0x40,0xb3,0x0a,0x10,
-0x02,0x54,0x16,0x10,0x0b,0x06,0x07,0x00,0x05,0x00,0x64,0x4b,0xbe,0xbb,0x80,0x0b,
-0x00,0x0f,0x00,0xa2,0x38,0x11,0x1c,0x11,0x10,0x73,0x99,0x99,0x99,0x94,0xd1,0x10,
-0x21,0x02,0xa0,0xf7,0x07,0x40,0xbb,0xb6,0x00,0x2b,0x11,0x09,0x10,0xb3,0xa1,0x04,
-0x57,0xe0,0xbb,0xeb,0xb1,0x27,0xa3,0x0b,0x00,0x05,0x00,0x20,0xb5,0xbb,0x9e,0x1a,
-0x01,0x82,0x0c,0xf1,0x15,0x05,0x70,0x00,0x01,0xa0,0x0d,0xa9,0x97,0x3b,0xe9,0xa3,
-0x00,0x0a,0x01,0xa0,0x48,0x40,0x0a,0x01,0xa0,0x00,0xa3,0x19,0x01,0xa7,0x10,0x29,
-0x58,0x08,0xd4,0x29,0xa1,0x37,0x26,0x00,0x53,0xd6,0x07,0x23,0x6a,0xb1,0x32,0x00,
-0xd1,0xca,0xea,0xe1,0x01,0xa0,0xa0,0xb0,0xa1,0x3c,0xe9,0xca,0xea,0xd1,0x0a,0x00,
-0xf1,0x01,0x01,0xa0,0x8a,0xea,0xa0,0x01,0xc8,0x11,0xc2,0x10,0x3c,0xa2,0x99,0xea,
-0x92,0x12,0x68,0x03,0xf0,0x1c,0x07,0xbb,0xeb,0xb6,0x08,0xca,0x6b,0xaa,0xe0,0x01,
-0x83,0x0a,0x00,0xb0,0x3a,0xcb,0x9a,0x0a,0xa0,0x07,0x17,0x2b,0x88,0x81,0x1c,0xbe,
-0x7a,0xa1,0xb0,0x00,0x82,0x0a,0x56,0xa0,0x4a,0xdb,0x9a,0x0e,0x30,0x00,0x82,0x0a,
-0x5c,0x0f,0x00,0x00,0xed,0x1c,0x04,0xca,0x06,0xf1,0x14,0x05,0x90,0x2b,0xa3,0x00,
-0x03,0x28,0xd5,0x4c,0xa4,0x08,0x53,0x37,0xa4,0x12,0x00,0x36,0x9a,0xc9,0x90,0x02,
-0x82,0x83,0x76,0x60,0x0a,0x19,0x3a,0x60,0x81,0x04,0x99,0xab,0x99,0x80,0x20,0x04,
-0x52,0x29,0x99,0xad,0x99,0x97,0x35,0x00,0xf0,0x18,0x90,0x0b,0x04,0x80,0x01,0x90,
-0xb9,0xb9,0xa4,0x2b,0xe7,0xd8,0xd8,0xb5,0x01,0x90,0xa0,0xa0,0x55,0x01,0x90,0x99,
-0x99,0x93,0x01,0xb7,0x79,0x88,0xc0,0x3c,0x82,0x89,0x88,0xe0,0x00,0x00,0x81,0x00,
-0xb0,0x99,0x14,0x61,0xd0,0x0a,0xaa,0xbd,0xaa,0xa4,0x16,0x0e,0x10,0x04,0xd5,0x03,
-0x41,0x02,0x99,0x99,0x99,0xa2,0x04,0xb1,0xb0,0x05,0xc8,0xac,0x88,0xc0,0x08,0x41,
-0x11,0x11,0x80,0x1a,0x1d,0x12,0x23,0x91,0x00,0xf0,0x0a,0x34,0x00,0x00,0x0a,0xaa,
-0xbe,0xaa,0xa4,0x00,0x35,0x60,0xa3,0x00,0x02,0xa5,0x60,0xa5,0x90,0x09,0x14,0x50,
-0x90,0x62,0x00,0x05,0xc4,0x08,0xf3,0x04,0x7e,0x99,0xbd,0x00,0x0a,0x66,0x93,0xc2,
-0x00,0x00,0x26,0xde,0x82,0x00,0x1c,0xa6,0x00,0x49,0xb6,0xce,0x05,0x00,0xfd,0x1b,
-0xf0,0x0f,0xeb,0xc2,0xc0,0x00,0x08,0x30,0xc0,0xc1,0x00,0x2b,0x21,0xc0,0xdc,0x30,
-0x33,0xba,0x70,0xc1,0xc3,0x00,0x0e,0x10,0xc0,0x12,0x00,0x87,0x00,0xc0,0x00,0x07,
-0x23,0x00,0x12,0x49,0x5b,0x06,0x10,0x51,0x34,0x04,0xf5,0x1a,0xfa,0xa8,0x00,0x03,
-0xb6,0x00,0xb3,0x00,0x04,0x18,0x8c,0x40,0x00,0x01,0x5b,0xa7,0xa0,0x00,0x0b,0x72,
-0x6c,0xaa,0xe2,0x00,0x5c,0x91,0x06,0x70,0x00,0x40,0x1b,0xa8,0x00,0x00,0x36,0xba,
-0x30,0x00,0x0b,0x85,0x00,0xe3,0x0e,0x10,0x48,0xcf,0x04,0x10,0xdd,0xe3,0x0e,0x20,
-0x9e,0x20,0x84,0x05,0xf1,0x03,0x90,0x00,0x00,0x07,0x70,0xb1,0x00,0x00,0x4c,0x00,
-0x3c,0x10,0x09,0xb0,0x00,0x05,0xd4,0x05,0xc7,0x00,0x00,0xeb,0x00,0xf0,0x16,0x02,
-0xeb,0xcd,0xbc,0xa0,0x02,0x90,0x38,0x01,0xa0,0x02,0x90,0x47,0x01,0xa0,0x2c,0xeb,
-0xdd,0xbc,0xe7,0x00,0x00,0xb9,0x40,0x00,0x00,0x08,0x80,0xb2,0x00,0x03,0xb7,0x00,
-0x2c,0x82,0x18,0x20,0xa3,0x15,0xc0,0x82,0x38,0x00,0x00,0x00,0xeb,0xce,0xbb,0x90,
-0x09,0x40,0x38,0xec,0x13,0x60,0x47,0x00,0x00,0x2b,0xbb,0xde,0x64,0x00,0x20,0xc9,
-0x50,0x2d,0x00,0x91,0xc2,0x00,0x03,0xb8,0x00,0x2c,0x61,0x19,0x20,0xd0,0x15,0xf1,
-0x21,0x01,0x24,0x60,0x07,0x66,0x98,0x84,0x70,0x0a,0x74,0x91,0x94,0x80,0x01,0x76,
-0xba,0xbd,0xa6,0x1a,0xd4,0x46,0x05,0x60,0x14,0x64,0x09,0x16,0x60,0x00,0x43,0x37,
-0x48,0x10,0x29,0x99,0xee,0xb9,0x96,0x00,0x18,0x83,0xc4,0x00,0x2a,0x93,0x00,0x18,
-0xb7,0x35,0x12,0x00,0x13,0x08,0x41,0x00,0x1b,0xbe,0xbb,0xa8,0x02,0x00,0x7e,0x15,
-0xf0,0x00,0x6a,0xad,0xb0,0x0b,0xd0,0x00,0x67,0x00,0x35,0xb4,0xbb,0xeb,0xb8,0x00,
-0xb0,0xea,0x14,0x02,0x05,0x00,0x15,0x2a,0xb2,0x07,0xf2,0x03,0x52,0x00,0x00,0x06,
-0x66,0xab,0x66,0x62,0x0b,0x44,0x44,0x44,0x95,0x0a,0x6a,0xaa,0xa9,0x75,0x53,0x0b,
-0x10,0xbb,0x46,0x00,0x10,0x0c,0x4a,0x0f,0x01,0x05,0x00,0x98,0x77,0x01,0xa0,0x0b,
-0x1b,0x80,0x00,0xcb,0xb6,0x92,0x05,0x10,0x2b,0xe9,0x08,0xf0,0x01,0xaa,0xaa,0xe1,
-0x0b,0x01,0x11,0x11,0xb1,0x01,0x69,0xae,0x99,0x40,0x00,0x62,0x0b,0x00,0x0e,0xb0,
-0x0e,0xaa,0x70,0x00,0xe7,0x0b,0x00,0x00,0x09,0x5b,0x6b,0x0e,0x06,0x21,0x8d,0xcb,
-0xc3,0x19,0x02,0xbf,0x24,0xf5,0x1e,0x09,0x99,0xbd,0x99,0x91,0x0b,0x00,0x34,0x00,
-0xa2,0x05,0x99,0xbc,0x99,0x60,0x00,0x22,0x67,0x22,0x00,0x00,0x77,0xaa,0x77,0x10,
-0x1a,0xaa,0xdb,0xaa,0xa6,0x00,0x06,0x97,0x60,0x00,0x03,0xa8,0x00,0x8a,0x51,0x07,
-0x10,0x00,0x01,0x73,0x26,0x02,0xf0,0x0d,0xa3,0x0b,0x05,0x00,0x50,0x74,0x02,0x96,
-0x15,0x4b,0x30,0x09,0x50,0xbb,0x41,0xa0,0x00,0x3b,0x20,0x96,0x00,0x1a,0xfc,0xaa,
-0xaf,0xc4,0x15,0xa1,0x1c,0x1c,0x10,0xa1,0xb7,0x03,0x30,0xab,0xaa,0xad,0x8e,0x02,
-0x40,0x00,0xb0,0x38,0xab,0x44,0x08,0xf4,0x12,0x05,0x4b,0xbb,0xe9,0x0a,0x19,0x11,
-0x00,0xb0,0x03,0xbb,0x09,0x40,0xb0,0x00,0x7a,0x01,0xb0,0xb0,0x00,0xbb,0x20,0x30,
-0xb0,0x09,0x62,0x70,0x00,0xb0,0x47,0x00,0x00,0x7c,0x43,0x0c,0x14,0x1a,0x05,0x00,
-0xf2,0x09,0x80,0x1a,0x06,0x10,0x01,0xc0,0x1a,0x03,0x90,0x06,0x70,0x1a,0x00,0xb2,
-0x0c,0x10,0x1a,0x00,0x58,0x26,0x00,0x1a,0x00,0x0a,0x12,0x1a,0x33,0x0a,0xc7,0x00,
-0xd4,0x15,0xf0,0x08,0x30,0xb0,0x03,0x00,0x05,0x60,0xb0,0x0b,0x10,0x0b,0x00,0xb0,
-0x02,0xa0,0x65,0x00,0xb0,0x00,0x91,0x00,0x00,0xb0,0x19,0x7d,0x17,0x95,0xc2,0x00,
-0x00,0x04,0xaa,0x10,0x00,0x7c,0xb7,0x87,0x15,0x23,0x04,0x10,0xbf,0x1a,0x20,0x5b,
-0xbe,0x3d,0x06,0x01,0x85,0x07,0x01,0x65,0x01,0xf0,0x00,0xca,0xbd,0xcb,0x90,0x03,
-0x90,0x09,0x20,0x00,0x0c,0x20,0x09,0x20,0x00,0x87,0x08,0x11,0xf0,0x4d,0x50,0x9b,
-0xbe,0xcb,0xb3,0x00,0x13,0x00,0x05,0x00,0x02,0x4c,0x33,0x89,0x30,0x05,0x77,0xba,
-0x77,0x71,0x02,0xaa,0xdc,0xaa,0x70,0x02,0x22,0xc2,0x22,0x21,0x18,0x8d,0xa8,0x88,
-0x84,0x00,0x3e,0xba,0xaa,0x90,0x05,0xc1,0x03,0x80,0x00,0x1a,0x69,0x9a,0xc9,0x95,
-0x00,0x11,0x11,0x11,0x11,0x0a,0x00,0xa0,0x92,0x0a,0xb9,0x9c,0x8b,0x93,0xb3,0x88,
-0x88,0x66,0x43,0x64,0x00,0x0b,0x21,0x03,0x88,0xd8,0x60,0x03,0xaa,0xae,0xaa,0x70,
-0x56,0x00,0xb0,0x1a,0x05,0x60,0x0b,0x39,0x90,0x00,0x1a,0x09,0xf3,0x05,0x08,0xbb,
-0xbb,0xbb,0xb1,0x00,0x50,0x29,0x03,0x30,0x00,0x92,0x29,0x0b,0x10,0x00,0x35,0x29,
-0x27,0x00,0x31,0x08,0x14,0x39,0xe9,0x1b,0x06,0x05,0x00,0x00,0x92,0x16,0xf0,0x03,
-0x06,0x99,0x9e,0x99,0x94,0x0b,0x11,0x61,0x16,0x10,0x0b,0x79,0xe9,0x9e,0x93,0x0b,
-0x00,0xb0,0x22,0x05,0xf1,0x08,0xa9,0x98,0x00,0x0b,0x59,0x99,0x9a,0x50,0x1b,0x02,
-0xb2,0x4b,0x10,0x56,0x03,0x7e,0xe5,0x10,0x52,0x96,0x30,0x15,0x94,0x18,0x02,0xf0,
-0x15,0x01,0x11,0x2c,0x11,0x10,0x0c,0x99,0x99,0x99,0x93,0x0b,0x05,0x08,0x05,0x00,
-0x0b,0x0c,0x0b,0x0c,0x00,0x0b,0x78,0xab,0x87,0xa1,0x0b,0x40,0x2b,0x30,0x31,0x0a,
-0x49,0x9e,0x99,0x70,0x56,0xae,0x01,0x55,0x93,0xaa,0xae,0xaa,0xa4,0x25,0x01,0x80,
-0x60,0x5a,0xe1,0xaa,0xe6,0x20,0x02,0x90,0x5b,0x05,0xf3,0x14,0x20,0x60,0xb1,0x10,
-0x1c,0xb7,0xa0,0xb8,0x81,0x02,0x65,0xa0,0xb0,0x00,0x0b,0xa1,0xa0,0xb0,0x00,0x07,
-0xc0,0x8a,0xba,0xa2,0x09,0xd7,0x00,0x00,0x00,0x59,0x07,0xbb,0xbb,0xb2,0x10,0x86,
-0x02,0x71,0xa4,0x80,0x2b,0xbb,0xbc,0xeb,0xc7,0x82,0x08,0x80,0x01,0x11,0x10,0xc0,
-0x00,0x08,0xae,0xa5,0x2e,0x10,0x20,0x00,0x83,0x05,0x00,0xf2,0x01,0x48,0x04,0x02,
-0x6e,0xb8,0x0c,0x0a,0x09,0x52,0x00,0x04,0xd7,0x0a,0xaa,0xb8,0xaa,0x61,0x0a,0x60,
-0x0d,0xaa,0x78,0xba,0xa0,0x0b,0x6e,0x01,0xf1,0x0a,0x09,0xaa,0xc6,0xaa,0xd1,0x09,
-0x92,0xb5,0xa4,0xa0,0x00,0x4a,0xa0,0x2a,0xe0,0x1b,0x75,0x88,0x92,0xb0,0x00,0x8b,
-0x30,0x69,0x90,0xe1,0x02,0xf4,0x1e,0x1a,0xaa,0x4c,0x99,0x92,0x00,0x0a,0x4b,0x88,
-0x80,0x0a,0xaa,0x48,0x33,0x20,0x0a,0x00,0x49,0x55,0x40,0x0d,0xa7,0xca,0xc9,0x94,
-0x00,0x0a,0x82,0x92,0xa0,0x00,0x19,0x82,0x1e,0x20,0x00,0x37,0x84,0x56,0x80,0x09,
-0xc3,0x98,0x20,0x65,0xfe,0x0a,0xf2,0x1f,0x30,0x00,0x3a,0xaa,0x0a,0x15,0x10,0x00,
-0x0a,0x79,0x58,0xb0,0x1b,0xaa,0x66,0xb3,0x62,0x37,0x00,0x79,0xe9,0x90,0x5b,0x86,
-0xa0,0xb0,0xb0,0x02,0x2b,0xb9,0xe9,0xe0,0x00,0x0a,0x00,0xb1,0x50,0x00,0x28,0x01,
-0xb3,0xd1,0x07,0xb5,0xcb,0xa9,0x6c,0x11,0xf0,0x01,0x51,0x09,0x20,0x26,0x3a,0x09,
-0x20,0xb2,0x07,0x09,0x22,0x60,0x7b,0xbd,0xbb,0xb8,0x8d,0x02,0x12,0x3b,0x79,0x1c,
-0x91,0x1a,0x89,0x99,0x99,0xaa,0x11,0x11,0x11,0x3a,0x29,0x1a,0xf7,0x1d,0x3c,0xdb,
-0xe8,0x08,0x80,0x03,0x70,0xb0,0xb6,0x00,0x03,0x70,0xb0,0x00,0x52,0x5c,0xda,0xea,
-0x07,0x90,0x04,0x60,0xb0,0xa7,0x00,0x06,0x50,0xb0,0x10,0x45,0x08,0x30,0xb0,0x02,
-0xc0,0x0c,0x00,0xb0,0x5c,0x10,0x55,0x00,0xb5,0x90,0x8d,0x0e,0xf5,0x1d,0x0c,0x88,
-0x99,0x04,0xa0,0x0c,0x77,0x89,0x7a,0x00,0x09,0x89,0x86,0x40,0x31,0x39,0xad,0x98,
-0x05,0xa0,0x07,0x88,0x84,0x99,0x00,0x0b,0x00,0x37,0x20,0x22,0x08,0x9d,0x93,0x01,
-0xc1,0x0b,0x1a,0x82,0x2b,0x30,0x23,0x87,0x05,0xb1,0x02,0x0b,0xf0,0x0f,0xb0,0x00,
-0x2b,0x30,0xaa,0xea,0xa2,0x00,0xa5,0x22,0xc2,0x22,0x08,0xb4,0x66,0x6a,0x95,0x57,
-0xb4,0x88,0x8b,0xb5,0x00,0xb0,0x52,0x17,0x61,0x00,0xb0,0x59,0x6c,0x12,0x10,0x09,
-0x05,0x00,0x02,0xf5,0x1c,0x00,0x32,0x00,0xf0,0x1f,0x08,0x40,0x00,0x0a,0x30,0x86,
-0x19,0x30,0x02,0x86,0x9c,0x83,0x40,0x05,0xb3,0xdc,0x99,0xc2,0x3a,0xb1,0x2c,0x10,
-0x16,0x00,0xb1,0xbc,0x9b,0xa0,0x00,0xb7,0x4a,0x5c,0x10,0x00,0xb0,0x28,0xea,0x20,
-0x00,0xb8,0x93,0x04,0xa8,0x00,0x51,0x33,0x63,0x25,0xf2,0x1b,0xba,0x99,0x96,0x3a,
-0x26,0xb4,0x44,0x40,0x00,0xc7,0xb5,0x55,0xc0,0x09,0xb0,0xa7,0x77,0xd0,0x57,0xa0,
-0x8a,0x88,0xb0,0x00,0xa0,0x3e,0x88,0x70,0x00,0xa4,0xab,0x18,0x70,0x00,0xa1,0x17,
-0xfc,0x10,0x00,0xa7,0xb7,0x14,0x26,0x28,0xf7,0x1e,0x09,0x44,0x84,0x19,0x00,0x85,
-0x38,0x88,0x4a,0x42,0x06,0x6b,0xbb,0x87,0xb4,0x2e,0x16,0x66,0xe4,0xa0,0xbc,0x14,
-0x44,0x68,0xb0,0x0a,0x0b,0x9a,0x0b,0x70,0x0a,0x09,0x0b,0x4b,0x30,0x0a,0x19,0x1a,
-0x6a,0xa0,0x0a,0x53,0x03,0x90,0x56,0x00,0x01,0x20,0x08,0x50,0xc6,0x0d,0xf3,0x16,
-0x8a,0x0b,0x30,0x00,0x07,0x02,0x58,0x00,0x09,0x1c,0x02,0xc5,0x20,0x0c,0x0c,0x2c,
-0x22,0xb0,0x48,0x0d,0xb1,0x00,0x93,0x31,0x5e,0x10,0x05,0x25,0x2b,0x8c,0x00,0x0b,
-0x00,0x22,0x09,0xcb,0xc7,0xda,0x04,0x00,0xef,0x03,0x10,0x0c,0x11,0x15,0x30,0x0b,
-0x00,0x57,0x13,0x08,0x10,0x06,0x55,0x0a,0xf3,0x07,0xb0,0x20,0x10,0x0b,0x47,0xb0,
-0x02,0xa0,0x0b,0x74,0xb0,0x02,0xa2,0x47,0xb0,0xb0,0x0a,0x47,0x83,0x10,0x8a,0xb8,
-0xcf,0x1e,0x01,0x5f,0x12,0xf0,0x44,0x2f,0x99,0x92,0x00,0x02,0xb1,0x01,0xc0,0x00,
-0x0a,0x9a,0xaa,0xaa,0x90,0x00,0x57,0x77,0x78,0x90,0x00,0x11,0x11,0x13,0x90,0x00,
-0x99,0xba,0x99,0x60,0x01,0x24,0x4a,0x00,0x70,0x09,0x59,0x06,0x46,0x57,0x07,0x0c,
-0xaa,0xab,0x06,0x0a,0x05,0x68,0xb6,0x60,0x4b,0x84,0x8a,0xc8,0x70,0x8a,0x44,0x36,
-0x93,0x31,0x8a,0x05,0x55,0x55,0x52,0x1a,0x05,0xb9,0x99,0xa0,0x0a,0x05,0xa8,0x88,
-0xa0,0x0a,0x05,0xb8,0x89,0xa0,0x0a,0x05,0x50,0x00,0x05,0x00,0xf1,0x20,0x2a,0x70,
-0x00,0x65,0x0a,0x99,0xe0,0x2a,0xdc,0x9a,0x44,0xc0,0x00,0xd9,0x0a,0x44,0xc0,0x08,
-0x98,0xaa,0x99,0xd0,0x38,0x65,0x0a,0x00,0xb0,0x00,0x44,0x37,0x88,0x80,0x05,0x16,
-0x3a,0x02,0x80,0x0c,0x0b,0x04,0x25,0xa2,0x15,0x0b,0xaa,0xb4,0x21,0x50,0x10,0xb1,
-0x06,0x99,0xad,0x99,0x90,0x00,0x0b,0x00,0x75,0x00,0x09,0xc7,0x08,0x60,0xc8,0x88,
-0x8b,0x40,0x00,0xd7,0xc9,0x0f,0x01,0x0a,0x00,0xe2,0x12,0x77,0x01,0x20,0x08,0x4b,
-0x06,0x33,0xb0,0x07,0x09,0x99,0xb3,0x32,0x83,0x13,0xf4,0x4a,0x84,0x35,0x76,0x50,
-0x3b,0x88,0xa7,0x70,0x51,0x0a,0x77,0x92,0x99,0x80,0x0c,0x77,0xb5,0x55,0x80,0x0c,
-0x66,0xb5,0xa4,0x21,0x0a,0x07,0x93,0xb9,0xb1,0x03,0x01,0x66,0x00,0x60,0x2a,0x46,
-0x07,0x32,0xb0,0x42,0x2c,0x99,0xb2,0x42,0x00,0x00,0x07,0x48,0x50,0x08,0xbb,0xbd,
-0xcb,0xd4,0x0c,0x00,0x05,0x60,0x20,0x0c,0xaa,0x83,0x74,0x90,0x0c,0x00,0xb1,0xab,
-0x20,0x0b,0x00,0xa0,0xc8,0x00,0x0b,0x5a,0x72,0xe4,0x26,0x48,0x01,0x2c,0x3a,0x45,
-0x82,0x00,0x92,0x07,0xc1,0x88,0x01,0x71,0x14,0x20,0x05,0xaa,0xbd,0x96,0x20,0x5c,
-0x04,0x57,0x06,0xbb,0xbe,0xbb,0xb1,0x92,0x0c,0x47,0xbb,0xce,0xbb,0xb8,0x7a,0x04,
-0x20,0x1b,0xc6,0x6a,0x05,0xd1,0x7c,0xbb,0xe0,0x48,0xd8,0x73,0x00,0xb0,0x12,0xb2,
-0x73,0x00,0xb0,0x0f,0x00,0xb0,0x38,0xfb,0x92,0x64,0x00,0x44,0xb0,0x90,0x19,0x00,
-0x00,0xb3,0x0e,0xa3,0x00,0xb2,0x90,0x05,0x90,0x3a,0x88,0x10,0x00,0x84,0x1d,0x08,
-0xf6,0x0d,0xbb,0xeb,0xbb,0x18,0xd6,0xa0,0xb0,0x0b,0x03,0xc2,0xba,0xea,0xbb,0x00,
-0xb0,0xa0,0xb0,0x0b,0x18,0xe8,0xb9,0xd9,0x9b,0x13,0xb0,0x71,0xb1,0x27,0xa8,0x09,
-0x25,0x0a,0x80,0x7e,0x14,0xf1,0x10,0xb0,0xab,0xbb,0xb2,0x38,0xd8,0xa1,0x00,0x00,
-0x12,0xc2,0xab,0xbb,0x90,0x00,0xb0,0xa1,0x00,0xa0,0x16,0xeb,0xa1,0x00,0xa0,0x36,
-0xb0,0xab,0xaa,0xa0,0x00,0xb0,0x2f,0x25,0xf0,0x4d,0xa3,0x11,0x10,0x1a,0x80,0x69,
-0x99,0x94,0x08,0x20,0x01,0x90,0x00,0x7c,0xa6,0xb8,0x98,0x83,0x19,0x45,0x60,0x80,
-0x00,0x08,0x25,0x60,0xc0,0x00,0x3b,0xd8,0x52,0x92,0x00,0x7b,0x27,0x37,0x45,0x50,
-0x08,0x29,0x1c,0x00,0xb0,0x08,0x3b,0x4c,0x57,0xd2,0x5c,0x55,0x47,0x53,0x45,0x07,
-0x30,0x11,0xb1,0x10,0x7c,0xa2,0x66,0xd6,0x50,0x18,0x43,0x55,0xc5,0x51,0x07,0x43,
-0x55,0x5c,0x51,0x6d,0xb6,0x88,0x8d,0x92,0x48,0x30,0x62,0x1b,0x20,0x07,0x30,0x57,
-0x0a,0x00,0x07,0x30,0x08,0x0a,0x25,0x1e,0x17,0xac,0xac,0x02,0xf2,0x1e,0x06,0x53,
-0x88,0xc4,0x10,0x6b,0xb8,0xaa,0xea,0xa2,0x17,0x61,0x33,0xb3,0x30,0x06,0x55,0xa6,
-0xd6,0xc0,0x5c,0xc7,0xc9,0xd9,0xd0,0x47,0x54,0x60,0xa0,0xb0,0x06,0x54,0xc9,0xd9,
-0xd0,0x06,0x50,0x10,0xa0,0x10,0x4c,0x30,0x00,0xa0,0x00,0x16,0x03,0xf3,0x1d,0x10,
-0x15,0x71,0x10,0x2a,0x43,0xb9,0x8b,0x90,0x5c,0x70,0x35,0x1a,0x00,0x09,0x17,0xac,
-0xba,0xa2,0x0a,0xb0,0x0b,0x10,0x00,0x9d,0x28,0xcb,0x9e,0x93,0x09,0x10,0xd3,0x2a,
-0x00,0x09,0x10,0x1b,0xf8,0x00,0x5b,0x09,0xa6,0x06,0xa0,0x77,0x29,0xa0,0x72,0x91,
-0x00,0x7c,0xa3,0xda,0xdb,0xa3,0x18,0x49,0x11,0x34,0xf0,0x0c,0x49,0xda,0xea,0xa1,
-0x3b,0xc3,0xa0,0xb0,0x00,0x6a,0x30,0xda,0xea,0xa1,0x08,0x30,0xa0,0xb0,0x00,0x08,
-0x30,0xda,0xea,0xa5,0x5c,0x10,0xa0,0x2f,0x25,0xf2,0x1c,0x81,0x06,0x50,0x29,0x65,
-0x8a,0x6d,0x63,0x4a,0x74,0x66,0x33,0x52,0x07,0x38,0x6b,0x09,0x82,0x4c,0xb9,0x9d,
-0x09,0x82,0x38,0x28,0x2a,0x09,0x82,0x07,0x28,0x7c,0x08,0x82,0x07,0x28,0x09,0x00,
-0x82,0x5c,0x18,0x4a,0x05,0xb0,0x46,0x1d,0xf3,0x1d,0x20,0x1c,0x53,0x00,0x3a,0x60,
-0x93,0x85,0x00,0x3a,0x66,0xd9,0x99,0xc0,0x07,0x20,0x97,0x35,0x90,0x0a,0xc0,0xa8,
-0x09,0xa0,0x7c,0x30,0x91,0xa0,0xa0,0x07,0x27,0x9b,0xf9,0x94,0x07,0x20,0x1b,0x39,
-0x00,0x4c,0x19,0x92,0x03,0x94,0xc3,0x00,0xf1,0x1c,0xb8,0x8c,0x00,0x5c,0x80,0xb7,
-0x7c,0x00,0x1a,0x36,0x97,0x69,0x70,0x09,0x19,0x09,0x90,0x90,0x0b,0xdb,0x8b,0xa8,
-0xc0,0x4b,0x19,0xac,0xca,0xa1,0x09,0x10,0x4e,0xe5,0x00,0x09,0x15,0xb5,0x6a,0x50,
-0x3b,0x38,0x04,0x60,0x71,0x32,0x1f,0xf0,0x49,0x0e,0x9a,0xb0,0xc0,0x00,0x0b,0x00,
-0xb3,0xc7,0x76,0x0d,0x99,0xba,0x94,0xd4,0x0b,0x00,0xdd,0xb1,0xc0,0x0d,0x88,0xd2,
-0xb7,0x70,0x0e,0x9a,0xb0,0x4e,0x10,0x06,0x36,0x20,0x9e,0x40,0x2c,0x01,0xaa,0x81,
-0xc6,0x22,0x00,0x14,0x00,0x05,0x16,0x93,0x70,0x80,0x00,0x6b,0xeb,0x94,0xca,0xa2,
-0x05,0xfb,0x27,0x64,0x70,0x4a,0xa2,0x8c,0x96,0x40,0x40,0x80,0x34,0xb9,0x10,0x4d,
-0xbb,0x70,0x8a,0x00,0x0c,0x4a,0x00,0x8a,0x00,0x03,0xdc,0x16,0x87,0x70,0x67,0x01,
-0x77,0x38,0x06,0x03,0x68,0x21,0x02,0xe0,0x08,0x20,0x2b,0xbb,0x91,0x05,0x11,0x75,
-0xb8,0x1a,0x00,0x98,0x09,0x30,0x05,0x92,0xc0,0xb2,0x24,0xe0,0x20,0x00,0x00,0x05,
-0xc9,0xa1,0x00,0x06,0xc9,0x00,0x4c,0x93,0x17,0x10,0xa6,0x08,0xf3,0x22,0x60,0x00,
-0x00,0x40,0x38,0xca,0x84,0xa9,0x60,0x08,0x16,0x57,0x40,0x00,0x29,0x6b,0x57,0x73,
-0x32,0x25,0xa7,0x58,0xa8,0xd4,0x49,0xca,0x98,0x40,0xa0,0x05,0x75,0x28,0x30,0xa0,
-0x1a,0x75,0x8a,0x10,0xa0,0x64,0x73,0x7c,0x00,0xa0,0x02,0xb1,0x36,0x00,0xa0,0x92,
-0x14,0x10,0x2a,0x92,0x14,0x60,0xbd,0xbb,0xb6,0x00,0x07,0x40,0x0a,0x01,0xa0,0x51,
-0x11,0x00,0x00,0x0b,0xa9,0x9c,0x40,0x00,0x0b,0x1e,0x2b,0x60,0x67,0x00,0x09,0x10,
-0x03,0xc1,0x91,0x12,0x42,0x20,0x0b,0xb8,0x00,0x5a,0x12,0xf1,0x1d,0xae,0x2a,0xad,
-0xa2,0x0b,0x0a,0x04,0x0a,0x00,0x0d,0x9d,0x0b,0x19,0x00,0x0b,0x0a,0x2b,0x5a,0x31,
-0x0d,0xaa,0x37,0xba,0x72,0x0b,0x04,0x00,0xca,0x00,0x0b,0x0c,0x03,0x99,0x00,0x0e,
-0xb9,0x4c,0x29,0x07,0x17,0x00,0xa4,0x0a,0xa5,0xbf,0x15,0x50,0xbb,0xbb,0xbb,0x8b,
-0x00,0x9f,0x0e,0x92,0x00,0xbc,0x00,0x00,0x1b,0xeb,0xbb,0xbb,0xbb,0x0e,0x00,0xf0,
-0x1c,0xbe,0xbb,0xbb,0xcb,0xb0,0x00,0x00,0xa0,0xea,0xe0,0xcb,0xbe,0x1b,0x0b,0x0b,
-0x00,0x91,0xb0,0xb0,0xb6,0x6c,0x1e,0xae,0x0b,0x55,0xb1,0xb0,0xb0,0xc2,0x2a,0x1e,
-0xae,0x0c,0x66,0xc1,0x90,0x02,0x70,0x09,0x10,0x00,0xa2,0x00,0x4e,0x2c,0x12,0xbc,
-0x6d,0x0f,0x10,0xc0,0x36,0x48,0xf0,0x0e,0x6a,0xea,0xa1,0xa0,0xb3,0x3c,0x33,0x1e,
-0xac,0x66,0x6a,0x94,0xa0,0xa7,0x77,0xaa,0x3a,0x0a,0x45,0x38,0x71,0xea,0xa0,0xb0,
-0x65,0x03,0x00,0x02,0x06,0xce,0x0a,0xf0,0x40,0xc3,0x00,0x07,0x98,0x88,0x8d,0x00,
-0x07,0x97,0x77,0x7d,0x00,0x06,0x98,0xa8,0x8a,0x00,0x69,0x99,0xea,0x99,0x91,0x01,
-0x77,0x77,0x76,0x00,0x04,0x71,0x11,0x1b,0x00,0x02,0x98,0xc9,0x87,0x00,0x04,0xb1,
-0x92,0x89,0x10,0x57,0x07,0xc1,0x02,0x90,0x1a,0xaa,0xbe,0xaa,0xa5,0x01,0x88,0x9d,
-0x88,0x70,0x02,0x91,0x2a,0x11,0xb0,0x02,0xc9,0xad,0x99,0xd0,0x02,0x80,0x1a,0x00,
-0xb0,0x01,0xc9,0xbc,0x99,0x80,0x00,0x67,0xea,0x0f,0x92,0x1e,0xe4,0x00,0x00,0x1b,
-0xa4,0x17,0xbb,0xb8,0x69,0x07,0xf1,0x24,0x77,0xab,0x79,0x40,0x18,0x88,0xbc,0x8b,
-0xb5,0x03,0x77,0xab,0x7b,0x50,0x04,0x77,0x9b,0x77,0x60,0x18,0x88,0xab,0x88,0x85,
-0x01,0x66,0x66,0x66,0x20,0x01,0xb3,0x33,0x37,0x60,0x01,0xc7,0x77,0x7a,0x60,0x01,
-0xc8,0x88,0x8a,0x60,0x06,0xa8,0x88,0x8d,0x00,0x06,0xa7,0x8c,0x00,0xf3,0x12,0x88,
-0x8c,0x00,0x69,0x99,0x99,0x99,0x92,0x0b,0x47,0x85,0x55,0x40,0x0b,0x47,0x8a,0x66,
-0xa0,0x0b,0x8a,0x71,0xab,0x20,0x4d,0x9c,0xd2,0xcc,0x20,0x33,0x14,0x9a,0x22,0xb2,
-0x4a,0x0b,0x14,0xa0,0x4a,0x0b,0xf0,0x01,0x2d,0x33,0x33,0x10,0x01,0xcb,0x66,0x69,
-0x60,0x1c,0x6d,0xaa,0xac,0x60,0x02,0x38,0x64,0x0f,0x10,0x3d,0x6e,0x0f,0x01,0x0a,
-0x00,0xf5,0x1e,0x38,0x00,0x9c,0x40,0x0a,0x05,0x56,0xca,0xe7,0xea,0xcc,0x73,0x0b,
-0x0b,0x7a,0x56,0xa8,0xe0,0xb1,0x65,0x65,0x1b,0x0c,0x9b,0x57,0x63,0xc1,0xb1,0x66,
-0x8a,0x8e,0x7a,0x99,0x8b,0x00,0xb1,0xc1,0xa2,0xc0,0x0b,0x84,0x02,0x77,0x0a,0xc0,
-0x4d,0x25,0x52,0x04,0xbb,0xce,0xbb,0xa0,0xef,0x04,0x00,0x78,0x09,0xf0,0x05,0x1a,
-0xaa,0xef,0xba,0xa6,0x00,0x06,0xbc,0xb0,0x00,0x00,0x6a,0x29,0x4b,0x10,0x1b,0x80,
-0x29,0x03,0xc5,0x6b,0x16,0x21,0x03,0x00,0x70,0x16,0x46,0xbb,0xce,0xbb,0xb6,0x1c,
-0x05,0x40,0x07,0xbb,0xef,0xcb,0x6b,0x10,0x00,0x2d,0x00,0x21,0x39,0x3b,0x2d,0x00,
-0x10,0xc6,0x2d,0x00,0x12,0x02,0x23,0x00,0x00,0x82,0x1d,0xf7,0x0a,0x1a,0xab,0xee,
-0xda,0xa6,0x00,0x09,0x69,0xb1,0x00,0x00,0x39,0x29,0x3a,0x00,0x03,0xc1,0x29,0x09,
-0x90,0x2d,0x8b,0xce,0xbb,0x99,0x62,0x05,0x20,0x05,0x10,0xe2,0x2b,0xf3,0x1c,0xaa,
-0xa4,0x00,0x06,0xca,0x02,0xd1,0x00,0x28,0x06,0xbd,0x20,0x00,0x00,0x5b,0x9b,0x93,
-0x00,0x68,0x50,0x61,0x26,0x91,0x07,0xaa,0xdb,0xaa,0x20,0x00,0x61,0x92,0x71,0x00,
-0x07,0x80,0x92,0x2b,0x00,0x06,0x05,0xb0,0x03,0x30,0x7f,0x0d,0x00,0x7a,0x13,0xf6,
-0x0f,0xb1,0x7c,0xdc,0x40,0x39,0xe8,0x09,0x25,0x43,0x05,0xe1,0x87,0x04,0xb7,0x09,
-0xca,0x10,0x82,0x00,0x47,0xb3,0xbb,0xdb,0xb6,0x60,0xb0,0x00,0x82,0x00,0x00,0x05,
-0x00,0x02,0x32,0x00,0xf1,0x0f,0x0a,0x54,0x40,0x3a,0xe9,0x7c,0x25,0xc0,0x02,0xf2,
-0x65,0x9c,0x20,0x06,0xea,0x07,0xcb,0x30,0x0a,0xb7,0xc5,0x01,0x99,0x47,0xb0,0x7b,
-0xaa,0xc0,0x20,0xb0,0xda,0x05,0x10,0x7b,0x2f,0x15,0x19,0x73,0x13,0x1a,0xf7,0x1d,
-0xb0,0x00,0xc2,0x00,0x02,0xb2,0x1a,0x39,0x50,0x17,0xf7,0x99,0xc9,0x95,0x04,0xf6,
-0x79,0xd9,0x90,0x08,0xb6,0xa0,0xa0,0x91,0x28,0xb0,0xb9,0xd9,0xd1,0x21,0xb0,0x02,
-0xc9,0x00,0x00,0xb0,0x1b,0x29,0x60,0x00,0xb2,0xb3,0x00,0x86,0x64,0x2b,0xf0,0x1a,
-0x26,0xaa,0xaf,0x60,0x4c,0xa0,0x02,0xb5,0x00,0x1a,0x67,0x97,0x69,0x90,0x0c,0xa7,
-0x77,0x52,0x80,0x2e,0x88,0x77,0x3b,0x50,0x99,0x29,0xc7,0x3b,0x80,0x37,0x23,0x4a,
-0x82,0x60,0x07,0x48,0xaa,0x88,0x82,0x07,0x31,0x71,0x12,0x01,0x7c,0x04,0xf3,0x1d,
-0x0b,0x98,0x9c,0xa2,0x1a,0x29,0x08,0x38,0x00,0x4d,0x7b,0x88,0x99,0x00,0x0d,0x69,
-0x09,0xaa,0x10,0x1f,0xab,0x96,0x8d,0x73,0x7c,0x29,0x32,0x2f,0x00,0x99,0x09,0x68,
-0x8c,0x00,0x09,0x2d,0x46,0xa9,0x06,0x09,0x10,0x09,0x17,0xa4,0x16,0x1b,0xf6,0x76,
-0x3c,0x3b,0x41,0x00,0xa0,0x5d,0x6c,0x71,0x3b,0xea,0x4d,0x6c,0x70,0x03,0xe1,0x78,
-0xc8,0x83,0x08,0xc9,0x99,0xd8,0xc0,0x28,0xa1,0x98,0xc7,0xd0,0x31,0xa2,0xd9,0xd9,
-0xd5,0x00,0xa0,0x91,0x00,0xa0,0x00,0xa0,0x91,0x07,0xb0,0x00,0xa0,0x9a,0xdd,0xa9,
-0x03,0xb3,0x69,0xcc,0x96,0x27,0xe6,0xa0,0x88,0x0a,0x04,0xf1,0x89,0xaa,0x98,0x08,
-0xb9,0x27,0x77,0x73,0x28,0xa1,0x88,0x88,0x88,0x31,0xa0,0x15,0x65,0x60,0x00,0xa0,
-0xa2,0x55,0x67,0x00,0xa2,0x34,0xb2,0x06,0x06,0x30,0x70,0x83,0x40,0x5c,0xb7,0x97,
-0xab,0xb1,0x09,0x41,0x94,0xa4,0x82,0x0d,0x98,0xbb,0xac,0x97,0x1d,0xb2,0x82,0xa2,
-0x90,0x78,0x37,0xe9,0xca,0xb5,0x46,0x32,0xd6,0x49,0x90,0x06,0x39,0x25,0x5f,0x15,
-0x06,0x76,0x07,0x63,0xb7,0xbc,0x0c,0x71,0x01,0x30,0x1a,0x00,0x00,0x04,0x70,0x05,
-0x00,0x33,0x1e,0xbb,0xb0,0x0a,0x00,0x04,0x05,0x00,0x33,0x7c,0xda,0xbe,0x32,0x18,
-0x70,0x09,0xbb,0xbb,0xbb,0xb2,0x00,0x00,0xa2,0x0d,0x01,0x97,0x2f,0x11,0xb0,0x05,
-0x00,0x54,0x0e,0xbb,0x80,0x00,0xb0,0x0f,0x00,0x60,0x29,0xe9,0xae,0x99,0x96,0x01,
-0x53,0x0c,0xf7,0x1e,0x7d,0xca,0x12,0x94,0x50,0x09,0x10,0x04,0xc7,0xa1,0x0c,0xba,
-0x88,0xc3,0x10,0x38,0x19,0x00,0xc6,0xa4,0xa7,0x67,0xba,0xd4,0x31,0x22,0xe1,0x00,
-0xa2,0xb1,0x01,0xa0,0x00,0x7d,0x10,0x0b,0x20,0x3a,0xbb,0x06,0x75,0x04,0x92,0x06,
-0xc4,0x04,0x09,0xf8,0x1c,0x7b,0x55,0x55,0x51,0x02,0xb4,0x44,0x44,0x41,0x0b,0x7b,
-0xac,0xab,0x60,0x00,0x92,0x0b,0x04,0x60,0x3a,0xeb,0xae,0xac,0xc8,0x00,0xb0,0x37,
-0x07,0x40,0x02,0xd8,0xbb,0x8c,0xa4,0x00,0x11,0x11,0x1c,0x10,0x00,0x00,0x05,0x99,
-0xa3,0x0a,0x13,0x00,0x7f,0x17,0xa0,0x10,0x0c,0x11,0x0c,0x08,0x90,0x0c,0xaa,0x4c,
-0xb7,0x0f,0x00,0x16,0x20,0x19,0x00,0xb3,0xa0,0x0c,0x38,0x5c,0x00,0xb0,0x0e,0x94,
-0x08,0xbb,0x90,0x3d,0x28,0x00,0xac,0x09,0xf0,0x01,0xe8,0x88,0x88,0x80,0x08,0x62,
-0x22,0x22,0x10,0x4b,0x58,0x88,0x88,0x00,0x17,0xaa,0x0f,0x13,0xb0,0x10,0x26,0x0a,
-0x00,0x01,0xc5,0xb1,0x0b,0x00,0x00,0x0e,0xe2,0x1c,0x92,0xb5,0x7a,0x0b,0x44,0x1c,
-0x30,0x05,0x04,0xc2,0x04,0x01,0x10,0x60,0x66,0x02,0xf0,0x1a,0x60,0xb0,0xb0,0x40,
-0x11,0x00,0xb2,0xda,0xd0,0x19,0x67,0xe7,0xc0,0xb0,0x00,0x02,0xb0,0xb0,0xb0,0x00,
-0xa0,0xb0,0xb7,0xb0,0x02,0x90,0xb0,0xa0,0x00,0x0a,0x20,0xb0,0x00,0x46,0x09,0x00,
-0xab,0xaa,0xc2,0x08,0x60,0x1f,0x21,0x50,0x24,0xbc,0xdb,0x80,0x42,0x29,0x21,0x20,
-0x2b,0x30,0x0f,0x00,0xf0,0x0b,0x09,0xbe,0xcb,0xb1,0x00,0x80,0x1b,0x01,0x00,0x05,
-0x70,0x83,0x0b,0x00,0x0c,0x04,0xd6,0x8c,0x90,0x24,0x03,0x63,0x10,0x80,0x09,0x40,
-0xd4,0x05,0xf1,0x29,0x3a,0xbb,0xeb,0xd5,0x53,0x0a,0x00,0xa0,0xa0,0x08,0x2a,0xaa,
-0xea,0x70,0x00,0x0b,0x67,0x06,0x70,0x04,0x7a,0x0c,0x3d,0x10,0x0b,0x2a,0x03,0xf6,
-0x00,0x48,0x74,0x8b,0x5a,0xa2,0x11,0x42,0x50,0x00,0x33,0x07,0x61,0x70,0xb0,0x54,
-0x00,0x40,0x82,0xb0,0xa0,0x27,0x00,0xbb,0xeb,0xb2,0x05,0x80,0x30,0x03,0xd0,0xea,
-0xaa,0xd2,0x00,0x90,0xb0,0x00,0x82,0x01,0xa0,0xea,0xaa,0xd2,0xb3,0x0e,0x64,0x82,
-0x09,0x00,0xb0,0x0a,0xc1,0xb9,0x00,0xf6,0x1b,0x37,0x91,0x00,0x1a,0xaa,0xbc,0xa4,
-0x34,0x0a,0x44,0x58,0x10,0x19,0x3a,0x34,0x39,0x91,0x00,0x0a,0xa9,0x8a,0xb0,0x04,
-0x6a,0x80,0x8c,0x50,0x0a,0x48,0xa8,0x7e,0x14,0x1b,0x65,0x20,0x97,0x68,0x34,0x90,
-0x07,0x20,0xc4,0xa3,0x0f,0xf3,0x05,0x04,0xb3,0xea,0xaa,0xc0,0x00,0x11,0xc5,0x55,
-0xc0,0x15,0x00,0xc3,0x33,0xb0,0x07,0x90,0xc9,0x99,0xa0,0xae,0x1e,0xf2,0x03,0xbd,
-0xac,0xd1,0x00,0xb5,0x49,0x26,0x91,0x07,0x45,0x49,0x26,0x91,0x0b,0x2c,0xcd,0xbc,
-0xd9,0x5a,0x05,0x01,0x23,0x08,0xf0,0x43,0x9a,0xba,0xca,0xa4,0x00,0x1a,0x21,0xc2,
-0x10,0x43,0x0a,0x79,0x77,0xd0,0x1a,0x4a,0x6a,0x88,0xd0,0x00,0x0b,0x63,0x00,0xa0,
-0x01,0x6b,0x38,0xd8,0x80,0x07,0x5b,0x45,0xb0,0x90,0x0b,0x57,0xb0,0xb0,0x94,0x25,
-0x90,0x27,0xb0,0x01,0x03,0x20,0x61,0x40,0x00,0x01,0x84,0xe8,0xe8,0x80,0x1a,0x4d,
-0x82,0xc2,0x20,0x02,0x47,0xb7,0xd7,0x50,0x00,0x85,0xb8,0xd8,0x60,0x06,0x74,0x95,
-0xc5,0x51,0x07,0x03,0x98,0x55,0x51,0x2a,0xaa,0xcd,0x64,0x0e,0x20,0x46,0x00,0x0f,
-0x1a,0x00,0x2a,0x02,0xf2,0x4c,0x02,0x40,0x00,0x06,0x98,0x9a,0xe9,0x92,0x00,0x0b,
-0x11,0x11,0x74,0x44,0x01,0x99,0xd9,0x40,0x08,0x25,0x99,0xd9,0x80,0x00,0x08,0x42,
-0xb1,0xb0,0x01,0x98,0x86,0xd6,0xc0,0x08,0x37,0x99,0xc9,0xb0,0x1c,0x02,0xa4,0x0a,
-0x50,0x03,0x18,0x10,0x00,0x61,0x03,0x72,0xc9,0xc8,0xb0,0x00,0x02,0xa9,0xd8,0x90,
-0x47,0x09,0x9a,0xd9,0x95,0x05,0x51,0x87,0x77,0x70,0x00,0x03,0xb7,0x77,0xc0,0x00,
-0xb3,0xb6,0x66,0xc0,0x06,0x53,0xb7,0x77,0xc0,0x1c,0x03,0x95,0x09,0x70,0x02,0x06,
-0x10,0x63,0x2c,0x02,0x1b,0x25,0xf0,0x01,0x06,0xfa,0xdc,0xcd,0xc3,0x18,0xa0,0x93,
-0x66,0x40,0x09,0xea,0xdc,0xcd,0xc3,0x00,0x0a,0x00,0xf0,0x2d,0x2a,0xea,0xdc,0xcd,
-0xc6,0x01,0x41,0x21,0x30,0x60,0x0a,0x33,0x70,0xb0,0xa4,0x15,0x01,0x40,0x50,0x15,
-0x00,0xb0,0x01,0x94,0x30,0x64,0xb0,0x01,0x90,0x90,0x09,0xc6,0xab,0xda,0xa5,0x00,
-0xb0,0x14,0xe1,0x10,0x04,0xf0,0x06,0xe3,0x00,0x4b,0xc0,0x0b,0x38,0x00,0x60,0xb0,
-0x4a,0x0b,0x10,0x00,0xb1,0xd1,0x03,0xa0,0xd9,0x11,0x11,0x56,0x5a,0x25,0x00,0x95,
-0x10,0xf7,0x10,0xa6,0x04,0x00,0xa1,0x50,0x40,0x04,0xb6,0xda,0x57,0x70,0x00,0x22,
-0x67,0x34,0x00,0x07,0xa8,0xd8,0xe8,0xa0,0x03,0x03,0x47,0x21,0x32,0x2a,0xaa,0xbe,
-0xaa,0xa7,0x4a,0x0f,0x00,0x9d,0x0e,0xf2,0x1e,0x4a,0xea,0x89,0x88,0xc2,0x00,0xa0,
-0x89,0x88,0xc2,0x01,0xb1,0x83,0x11,0x92,0x2a,0xe9,0x8a,0x99,0xd2,0x00,0xa0,0x82,
-0x00,0x92,0x00,0xb3,0x5e,0xae,0xa1,0x3a,0xd8,0x0d,0x0b,0x00,0x22,0x00,0x68,0x0b,
-0x07,0x00,0x09,0x90,0x0a,0xa8,0x57,0x27,0x40,0xc9,0xba,0xda,0xa9,0x55,0x42,0xa1,
-0x01,0x90,0x00,0xa0,0xb9,0xd9,0xa9,0x02,0xce,0x8a,0x0b,0x00,0xf0,0x0e,0x7a,0xea,
-0xa6,0x00,0x0a,0x01,0x1b,0x21,0x00,0x01,0xd8,0x89,0xea,0x97,0x03,0xe9,0x20,0x0a,
-0x00,0x00,0x10,0x06,0xaa,0xeb,0xaa,0x00,0x00,0x72,0x29,0xa5,0x07,0xb0,0xbd,0xaa,
-0xa2,0x09,0x41,0x3a,0x11,0x10,0x06,0x00,0x29,0x61,0x16,0x3b,0xce,0xbb,0x90,0xdb,
-0x0f,0x00,0x70,0x0b,0x20,0xb7,0x07,0x46,0x1d,0x01,0x21,0x16,0x90,0x98,0xe8,0x88,
-0xb0,0xa3,0x1c,0x11,0x1b,0x0b,0x8d,0x05,0x40,0xcb,0xbe,0xbb,0xbb,0x5b,0x0c,0x10,
-0xb3,0x11,0x15,0x41,0x91,0x00,0xb0,0x9b,0x27,0x11,0x51,0xaa,0xaa,0xaa,0xaa,0x30,
-0x52,0x02,0xf3,0x0b,0xba,0xc9,0x90,0x0b,0x46,0x19,0x0a,0x65,0xb4,0xca,0xd9,0xa6,
-0x5b,0x47,0x3a,0x2a,0x65,0xb1,0x66,0x66,0x46,0x5e,0xaa,0xaa,0xaa,0xc5,0x09,0x2e,
-0xf0,0x1c,0x01,0x35,0x30,0x04,0xaa,0xac,0x68,0x20,0x00,0x66,0x28,0x1c,0x00,0x1a,
-0xad,0xbd,0xcc,0xa6,0x00,0x2a,0x6a,0x96,0x00,0x1b,0xc5,0x58,0x49,0xd6,0x01,0xd6,
-0x8b,0x69,0x70,0x00,0xd8,0x9c,0x8a,0x70,0x00,0xb0,0x28,0x04,0x70,0xae,0x16,0x00,
-0x84,0x29,0xf0,0x0e,0x01,0x00,0x07,0x9a,0xb5,0x7b,0x10,0x06,0x49,0x30,0xb3,0x93,
-0x00,0xcc,0x88,0xae,0x50,0x1b,0x71,0x22,0x22,0xc7,0x13,0xaa,0x99,0x9e,0x02,0x00,
-0xa1,0x03,0x04,0x30,0x6b,0x88,0xaa,0x2d,0x16,0x63,0x92,0x00,0x1a,0xac,0xba,0xea,
-0xf4,0x16,0x10,0x76,0xa4,0x21,0xf1,0x0f,0x9a,0xe9,0x99,0x60,0x05,0x8b,0xb8,0x88,
-0x10,0x59,0x9e,0xa9,0x99,0x90,0x00,0xab,0x88,0x88,0x10,0x09,0xc9,0x77,0x7c,0x20,
-0x95,0x87,0x44,0x4b,0x20,0x00,0x05,0x00,0x41,0x8a,0x99,0x9d,0x20,0xa4,0x2c,0xfb,
-0x1f,0x3b,0xca,0x78,0xd9,0x82,0x05,0x60,0xa5,0xa5,0x64,0x09,0x30,0x2d,0x2b,0x00,
-0x0d,0x96,0xbd,0x9e,0x92,0x4f,0x0b,0x7d,0x9d,0x90,0x5b,0x0a,0x29,0x0b,0x00,0x0a,
-0x5a,0x2c,0x8d,0x80,0x0a,0x43,0x2c,0x8d,0x84,0x00,0x00,0x29,0x11,0x11,0x03,0x64,
-0x1e,0x01,0x86,0x07,0x70,0x10,0x29,0x02,0x00,0x00,0xc1,0x29,0xc1,0x38,0xf0,0x29,
-0x29,0x01,0xc0,0x2b,0x00,0x29,0x00,0x84,0x00,0x09,0xc7,0x00,0x00,0x26,0x97,0x00,
-0xb0,0x00,0x12,0xa0,0x33,0xb3,0x30,0x7b,0xea,0x83,0xb0,0xb0,0x05,0xd0,0xa0,0xb0,
-0x92,0x0a,0xd8,0x60,0xb0,0x40,0x38,0xa6,0x00,0xb4,0x80,0x92,0xa0,0x00,0x3b,0x10,
-0x00,0xa0,0x06,0xb2,0x00,0x00,0xa4,0xb6,0x72,0x2c,0xf0,0x19,0x05,0x00,0x00,0x2a,
-0xd4,0x0b,0x33,0x30,0x00,0xa0,0x59,0xd7,0xd1,0x4b,0xeb,0xb0,0xa1,0x70,0x02,0xe0,
-0x35,0xa3,0x40,0x08,0xca,0x36,0xa2,0xa0,0x19,0xa3,0x82,0xa0,0xb0,0x71,0xa0,0xb0,
-0xa0,0x92,0x00,0xa0,0x81,0x0b,0x30,0xa0,0x07,0xc0,0x71,0x02,0xf5,0x1e,0x70,0x00,
-0x2a,0xd3,0x09,0xd9,0x80,0x00,0xb0,0xb8,0x08,0x60,0x4a,0xe9,0x05,0xd8,0x00,0x06,
-0xe2,0x9a,0x76,0x00,0x09,0xd8,0x12,0xda,0xb5,0x28,0xb3,0x7a,0x20,0xc0,0x71,0xb0,
-0x31,0xbb,0x50,0x00,0xb0,0x04,0xb5,0x00,0x00,0xb2,0xb8,0x7c,0x12,0x03,0xee,0x2c,
-0xf5,0x03,0xea,0xaa,0xaa,0xab,0xab,0x04,0x50,0x63,0x1a,0x7a,0x80,0x00,0x6a,0x23,
-0xba,0xaa,0xaa,0x70,0x5b,0x27,0x10,0x00,0x35,0x32,0x43,0xaa,0xae,0xaa,0xa7,0xbc,
-0x11,0xf1,0x09,0x4a,0x11,0x10,0x0e,0x89,0x98,0x98,0xb6,0x09,0x1b,0x20,0xa6,0x44,
-0x05,0xa2,0x14,0x36,0x90,0x00,0x00,0x47,0x47,0x00,0x2a,0xa3,0x08,0x30,0x01,0xc5,
-0x80,0x75,0x25,0xf3,0x24,0x88,0x20,0x0b,0x81,0x00,0x04,0xb7,0x02,0x80,0x90,0xe0,
-0x73,0x4a,0xca,0xa5,0xe5,0xa3,0x03,0x04,0x45,0x55,0x51,0x09,0x29,0xaa,0xca,0xa5,
-0x09,0x45,0x01,0xd0,0x00,0x09,0x62,0xcd,0xad,0xc5,0x05,0xa6,0x98,0x09,0x45,0x5c,
-0x84,0x98,0x09,0x45,0x00,0x00,0x97,0x08,0xac,0x19,0xf3,0x22,0x40,0x02,0x30,0x00,
-0x06,0xc9,0x79,0xb9,0x94,0x2a,0x38,0x4a,0x0c,0x10,0x07,0x9a,0xaa,0x9b,0x60,0x00,
-0x11,0xa3,0x12,0xa0,0x06,0x97,0xc8,0x77,0x40,0x09,0xba,0xda,0xaa,0x90,0x00,0x0a,
-0xd1,0x00,0xc0,0x01,0xa4,0xa1,0x12,0xb0,0x1b,0x30,0xa1,0x58,0x20,0x9c,0x2b,0xc0,
-0x01,0x40,0x00,0x08,0xca,0x98,0xca,0xa3,0x49,0x38,0x19,0x1b,0x44,0x2a,0xf1,0x01,
-0x01,0x00,0x00,0x5b,0x32,0xb7,0x10,0x3c,0x79,0x99,0x96,0xc5,0x00,0x89,0x99,0x98,
-0xf7,0x19,0x00,0x42,0x21,0xf0,0x06,0x1b,0x00,0x00,0xc9,0x99,0x9c,0x00,0x02,0x10,
-0x03,0x00,0x00,0x0d,0xa9,0x7e,0xa9,0x91,0x84,0x91,0x93,0x47,0xfc,0x09,0x71,0x7c,
-0x20,0x06,0x96,0x66,0x6c,0x20,0x0a,0x00,0xe0,0x03,0x8c,0x77,0xc8,0x10,0x69,0xad,
-0x99,0xe9,0x92,0x01,0xb2,0x00,0xb0,0x1d,0x30,0x13,0xb0,0xbf,0x11,0xf0,0x0b,0x10,
-0x01,0x20,0x00,0x0a,0xa8,0x79,0xc8,0x83,0x48,0x28,0x39,0x0a,0x00,0x0a,0x88,0xaa,
-0x88,0xa1,0x0b,0x79,0x99,0x98,0x91,0x00,0xc0,0x5f,0x00,0x96,0xc8,0x88,0x88,0x00,
-0x00,0xd9,0x99,0x99,0x40,0x6a,0x19,0xf2,0x22,0x02,0x10,0x03,0x10,0x00,0x0b,0xb9,
-0x8e,0xa9,0x93,0x66,0xa1,0x93,0x57,0x00,0x59,0xb9,0x96,0xac,0xa0,0x15,0xb5,0x39,
-0x10,0xb0,0x38,0xb4,0xa9,0x10,0xb0,0x3a,0xc8,0xa9,0x14,0xb0,0x17,0xc7,0x59,0x13,
-0x21,0x59,0xd9,0x9a,0x10,0x37,0x00,0x90,0x05,0xba,0x87,0x06,0xf2,0x1e,0x13,0xa4,
-0x46,0xc7,0x62,0x08,0xb9,0x38,0xd9,0x81,0x06,0xc4,0x34,0xb4,0x42,0x3b,0xe8,0x45,
-0x55,0x53,0x06,0xf3,0x3b,0x99,0xd0,0x0a,0xba,0x4b,0x77,0xd0,0x47,0xa0,0x3b,0x88,
-0xd0,0x10,0xa0,0x36,0x00,0xb0,0x00,0xa0,0x36,0x07,0xb0,0x19,0x0e,0xf1,0x4a,0x88,
-0xac,0x88,0x81,0x00,0x55,0x7b,0x55,0x30,0x00,0x44,0x6a,0x44,0x20,0x19,0x9a,0xe9,
-0x99,0x96,0x00,0x9c,0xa9,0x83,0x00,0x03,0x8c,0xb7,0x8d,0x80,0x04,0x56,0x2b,0x12,
-0x42,0x01,0xb3,0x0b,0x1a,0x70,0x0a,0x24,0xa8,0x00,0x74,0x03,0x33,0x3c,0x33,0x32,
-0x04,0x44,0x4d,0x44,0x42,0x1c,0xaa,0xcc,0xaa,0xaa,0x19,0x07,0x71,0x64,0x0b,0x00,
-0xa9,0xda,0x36,0x00,0x03,0x9d,0x87,0x8b,0xb0,0x04,0x56,0x2b,0x13,0x34,0x01,0xa5,
-0x0b,0x08,0x80,0x09,0x32,0xaa,0x00,0x46,0xd0,0x2c,0xf3,0x1e,0x03,0x70,0xac,0xeb,
+0x00,0xf1,0x25,0x76,0x80,0x00,0x20,0x21,0x00,0x00,0x00,0xc0,0xd9,0xa2,0x00,0x06,
+0x7a,0x41,0xb1,0x00,0x1e,0x7e,0x8b,0xa8,0xb0,0xad,0x19,0x9d,0x98,0xa0,0x19,0x14,
+0xba,0x02,0x50,0x09,0x36,0x4a,0xbd,0x10,0x09,0x3a,0x67,0xb7,0x30,0x09,0x14,0xa3,
+0xa1,0xc2,0x09,0x46,0x2a,0x60,0x11,0x64,0x00,0x65,0x02,0xbb,0xbb,0xbb,0x80,0x00,
+0x01,0x00,0xf3,0x0f,0x1b,0xbc,0xbb,0xcb,0xb7,0x00,0x0a,0x10,0xb0,0x00,0x00,0x0c,
+0x00,0xb0,0x00,0x00,0x2a,0x00,0xb0,0x05,0x00,0xb3,0x00,0xb0,0x0a,0x1c,0x40,0x00,
+0xab,0xc6,0x25,0x00,0x10,0x22,0x05,0x00,0xf1,0x1d,0x2b,0x00,0x00,0x0b,0xbb,0xbc,
+0xbb,0xb6,0x00,0x0b,0x30,0x52,0x00,0x00,0x95,0x00,0x2c,0x30,0x05,0xdc,0xdb,0xe9,
+0xc1,0x00,0x07,0x50,0xb0,0x10,0x00,0x0b,0x20,0xb0,0x03,0x00,0x5a,0x00,0xb0,0x0b,
+0x0b,0xa0,0x00,0xbb,0xc6,0x01,0x36,0x00,0xf5,0x09,0x53,0x29,0x00,0x00,0x00,0xcb,
+0xce,0xbb,0xa0,0x05,0x70,0x29,0x00,0x00,0x03,0x00,0x29,0x00,0x00,0x1b,0xbd,0xcb,
+0xeb,0xb6,0x6e,0x00,0xc6,0x01,0x00,0x96,0x00,0xb0,0x0a,0x1b,0x70,0x00,0x9b,0xb5,
+0x00,0x01,0x00,0x20,0x0b,0x30,0xa6,0x00,0x10,0xd1,0x0b,0x00,0x10,0x9a,0x05,0x00,
+0x60,0xda,0x30,0x00,0x00,0x04,0xa2,0x32,0x00,0xf0,0x06,0x20,0x95,0x00,0x00,0x88,
+0x00,0x1d,0x20,0x09,0xa0,0x00,0x03,0xd3,0x26,0x00,0x00,0x00,0x23,0x00,0x00,0x12,
+0x23,0x00,0xf2,0x0d,0xbb,0x10,0x00,0x00,0x1b,0x33,0xc1,0x00,0x05,0xc3,0x00,0x2c,
+0x50,0x69,0xba,0xaa,0xab,0xa7,0x00,0x00,0x55,0x00,0x00,0x00,0xaa,0xcc,0xaa,0x00,
+0x0a,0x00,0x00,0x05,0x00,0x52,0x2a,0xaa,0xcc,0xaa,0xa2,0x64,0x00,0xf1,0x07,0x1c,
+0x00,0xc1,0x00,0x00,0x94,0x00,0x3a,0x00,0x05,0xb0,0x10,0x08,0x80,0x2c,0x00,0xc2,
+0x00,0xa5,0x01,0x06,0x90,0x19,0x00,0xc0,0x93,0x00,0x00,0xb3,0x00,0x2d,0x10,0x07,
+0xec,0xbb,0xaa,0xa0,0x2b,0x00,0x50,0x70,0x00,0x0b,0x00,0x56,0xaf,0x00,0x72,0x66,
+0x00,0x09,0xae,0xaa,0xcc,0xa4,0x0f,0x00,0x00,0x05,0x00,0xf0,0x0c,0x2b,0xbb,0xbb,
+0xbb,0xb8,0x00,0x08,0x00,0x62,0x00,0x01,0xa6,0x00,0x1b,0x50,0x0a,0x40,0x00,0x00,
+0xa3,0x00,0xba,0x99,0x9c,0x40,0x00,0xb9,0x05,0x00,0xf0,0x4a,0xb1,0x11,0x18,0x40,
+0x00,0xb8,0x77,0x7b,0x40,0x00,0xb8,0x88,0x8c,0x40,0x00,0xb0,0x00,0x07,0x40,0x2a,
+0xac,0xaa,0xcb,0xa7,0x01,0x9a,0x00,0x4b,0x60,0x1a,0x30,0x00,0x00,0x66,0x00,0x02,
+0x90,0x00,0x0b,0xbb,0xce,0xbb,0xb5,0xb0,0x03,0x80,0x04,0x6b,0x00,0x7a,0x00,0x46,
+0xb0,0x0c,0x7a,0x04,0x6b,0x1b,0x40,0x6a,0x46,0xb9,0x30,0x00,0x77,0x6b,0x00,0x00,
+0x00,0x46,0xb0,0x00,0x01,0xbc,0x40,0xbb,0xbb,0xbb,0xbb,0x6b,0x00,0x19,0x00,0x38,
+0xb0,0x01,0x90,0x03,0x8b,0x09,0x00,0xd4,0xeb,0xbb,0xbb,0xbc,0x8b,0x00,0x00,0x00,
+0x38,0xb0,0x00,0x00,0x03,0x09,0x00,0xf0,0x52,0xac,0x50,0x0a,0xbb,0xcd,0xbb,0xb4,
+0x00,0x00,0x28,0x00,0x00,0x02,0xda,0xbd,0xab,0x90,0x02,0x80,0x28,0x01,0x90,0x02,
+0xda,0xbd,0xaa,0x90,0x04,0x91,0x49,0x13,0xa1,0x3a,0xd9,0x99,0x9a,0xd7,0x02,0x80,
+0x00,0x01,0x90,0x02,0x80,0x00,0x7b,0x60,0x31,0x0a,0x20,0x05,0x07,0x30,0xa2,0x00,
+0xb0,0x73,0x0a,0x20,0x0b,0x07,0xcb,0xec,0xbb,0xb0,0x10,0x0a,0x20,0x01,0x0c,0x00,
+0xa2,0x00,0xa2,0xc0,0x0a,0x20,0x0a,0x2e,0xbb,0xec,0xbb,0xe2,0x00,0x00,0x00,0x0a,
+0x20,0x00,0x02,0x00,0x20,0x00,0x00,0x3b,0x00,0xa3,0x1b,0x01,0xf0,0x06,0x1c,0x00,
+0x09,0x80,0x00,0x05,0xb0,0x4b,0xbb,0xbb,0xbb,0x74,0x00,0x04,0x70,0x0b,0x00,0x00,
+0x08,0x40,0x0c,0x20,0x01,0xa3,0x0c,0x00,0x00,0xb4,0x00,0x0c,0x00,0x1c,0x50,0x0b,
+0x37,0x02,0x30,0x01,0x20,0x00,0xcd,0x03,0xf1,0x1c,0x99,0x99,0x90,0x2a,0xb8,0x12,
+0xc1,0xb0,0x00,0x37,0x01,0xa0,0xb0,0x00,0xb5,0x12,0x80,0xb0,0x08,0xf9,0x05,0x50,
+0xb0,0x39,0xcb,0x09,0x20,0xb0,0x00,0xb0,0x1b,0x00,0xb0,0x00,0xb0,0xa4,0x00,0xb0,
+0x00,0xb5,0x60,0x6b,0x50,0x37,0x00,0xf5,0x1a,0x0e,0xaa,0xd0,0x00,0xb0,0xa0,0x0b,
+0x0b,0x0b,0x0c,0x33,0xb0,0xb0,0xb0,0x7d,0x76,0x0b,0x0b,0x00,0xd7,0x70,0xb0,0xb0,
+0x3a,0x3b,0x0b,0x0b,0x06,0x40,0xa0,0x50,0xb0,0xb0,0x0b,0x00,0x0b,0x64,0x4a,0x70,
+0x2b,0xc0,0x32,0x02,0xf2,0x1d,0x16,0x8a,0x81,0x10,0xa1,0x02,0x29,0x00,0x91,0xa1,
+0x15,0x7c,0x54,0x91,0xa1,0x14,0x9d,0x53,0x91,0xa1,0x00,0xcd,0x80,0x91,0xa1,0x07,
+0x79,0x65,0x91,0xa1,0x3b,0x29,0x00,0x20,0xa1,0x11,0x19,0x00,0x00,0xa1,0x00,0x19,
+0x00,0x1b,0x36,0x00,0x00,0x79,0x01,0xf2,0x15,0x4a,0xdc,0xaa,0x54,0xb0,0x2a,0x05,
+0x05,0x4b,0x0d,0xa9,0x80,0x54,0xb0,0x23,0xb1,0x75,0x4b,0x06,0xa1,0xb3,0x54,0xb1,
+0x60,0x9b,0x02,0x2b,0x03,0xb5,0x78,0x00,0xb2,0xb1,0x00,0x50,0xac,0x5f,0x00,0xf2,
+0x0e,0x55,0x64,0x00,0xb0,0xb5,0x5b,0x0b,0x0b,0x0a,0xbb,0xa0,0xb0,0xb0,0xb1,0x1b,
+0x0b,0x0b,0x0e,0xaa,0xe0,0xb0,0xb0,0xb0,0x0b,0x0b,0x0b,0x0e,0x99,0xe0,0x91,0x00,
+0x42,0x0b,0x09,0xc0,0x2a,0x5b,0x00,0xf0,0x0b,0x20,0x00,0x03,0x00,0x00,0x49,0x00,
+0x1b,0x00,0x2a,0xad,0xaa,0xcc,0xa7,0x01,0x33,0x30,0x10,0x40,0x09,0x76,0xd0,0xb0,
+0xb0,0x09,0x99,0x05,0x00,0x21,0x10,0xa0,0x0a,0x00,0x10,0xa0,0x0a,0x00,0x76,0x00,
+0xb0,0x09,0x18,0xb0,0x1a,0xc0,0xfa,0x02,0xf0,0x20,0x02,0x2c,0x22,0x00,0x0a,0x1b,
+0x59,0x5c,0x27,0x0a,0x05,0x8d,0x85,0x2a,0x0a,0x02,0x8d,0x82,0x2a,0x0a,0x08,0x8d,
+0x88,0x2a,0x0a,0x00,0x0a,0x00,0x2a,0x0a,0x07,0xba,0xb7,0x16,0x0a,0x07,0x98,0x97,
+0x00,0x0a,0x07,0x20,0x17,0x07,0xb7,0x00,0x00,0x3a,0x00,0x00,0x05,0x00,0x60,0x1b,
+0xbb,0xfb,0xbb,0xe0,0x00,0x48,0x01,0xf4,0x0a,0x00,0x04,0x80,0x00,0xb0,0x00,0x0a,
+0x30,0x00,0xc0,0x00,0x4b,0x00,0x00,0xb0,0x03,0xd1,0x00,0x04,0x80,0x2c,0x10,0x05,
+0xbc,0x20,0x62,0x00,0xf4,0x1b,0xb0,0x00,0x5a,0xda,0x00,0xb0,0x00,0x01,0x90,0xbb,
+0xeb,0xe1,0x01,0x90,0x02,0x90,0xb0,0x01,0x90,0x04,0x70,0xb0,0x01,0xb7,0x18,0x30,
+0xb0,0x7c,0x94,0x1c,0x00,0xb0,0x10,0x00,0xb4,0x00,0xb0,0x00,0x0b,0x50,0x6b,0x60,
+0x30,0x00,0xf6,0x17,0x22,0x24,0xbe,0xba,0x5a,0x6d,0x00,0xb0,0xb5,0x50,0xb0,0x29,
+0x0b,0x55,0x0b,0x03,0x70,0xb5,0x50,0xb0,0x55,0x0b,0x55,0x0b,0x0a,0x21,0xa5,0x50,
+0xb1,0xc0,0x48,0x5d,0xbe,0x66,0x8c,0x25,0x50,0xb0,0xc4,0x00,0xf6,0x1d,0xb1,0x00,
+0xa0,0x00,0x59,0xb9,0x90,0xa0,0x00,0x08,0x15,0x28,0xeb,0xe0,0x3a,0x02,0xb0,0xa0,
+0xa0,0x45,0x2b,0x30,0xa0,0xa0,0x00,0xb8,0x01,0x80,0xa0,0x00,0xbb,0x05,0x50,0xa0,
+0x09,0x55,0x3b,0x00,0xb0,0x65,0x00,0x75,0x5b,0x70,0x36,0x00,0xf3,0x1d,0x58,0xc6,
+0x20,0xb0,0x00,0x8b,0xeb,0xb2,0xb0,0x00,0x36,0xc7,0x6a,0xeb,0xe1,0x74,0xa3,0xb0,
+0xa0,0xa1,0x78,0xc8,0xc0,0xa0,0xa0,0x47,0xc8,0x82,0x80,0xb0,0x48,0xd9,0x88,0x50,
+0xb0,0x02,0xb7,0x8d,0x00,0xb0,0x78,0x64,0xb3,0x4b,0x37,0x00,0x01,0x64,0x04,0xf1,
+0x45,0x3a,0x0c,0x00,0x00,0x00,0xb2,0x0c,0x00,0x53,0x06,0xe0,0x0c,0x03,0xc1,0x3c,
+0xc0,0x0c,0x3d,0x20,0x22,0xc0,0x0d,0xb1,0x00,0x00,0xc2,0xbe,0x00,0x00,0x00,0xc4,
+0x3c,0x00,0x08,0x00,0xc0,0x0c,0x00,0x1a,0x00,0xc0,0x09,0xcb,0xc4,0x00,0x10,0x30,
+0x00,0x20,0x01,0xb0,0x75,0x08,0x50,0x02,0xcb,0xad,0xae,0x80,0x04,0x70,0x28,0x00,
+0xc0,0x04,0xc9,0xad,0x99,0xc0,0x04,0x93,0x6a,0x33,0xc0,0x01,0x66,0x8b,0x66,0x50,
+0x2a,0xaa,0xbd,0xaa,0xa7,0x3f,0x03,0x02,0x05,0x00,0x00,0xb3,0x04,0x51,0x05,0xbb,
+0xce,0xbb,0xb0,0x0a,0x00,0x01,0x05,0x00,0xf0,0x1f,0x2b,0xbc,0xfb,0xbb,0xb8,0x00,
+0x09,0x40,0x52,0x00,0x00,0x48,0x00,0x1c,0x00,0x03,0xd6,0x68,0x9d,0x90,0x03,0x75,
+0x43,0x10,0x81,0x00,0x01,0x24,0x68,0x90,0x08,0xc8,0x89,0x42,0x50,0x00,0xa2,0x0b,
+0x05,0x70,0x0a,0xcc,0xac,0xae,0xa7,0x0a,0xcf,0x04,0xf5,0x0d,0x04,0x6b,0xaa,0xab,
+0x34,0x00,0x0a,0x30,0x4b,0x00,0x00,0x00,0xb8,0xb1,0x00,0x01,0x59,0xb9,0xb7,0x30,
+0x0a,0x73,0x00,0x04,0x87,0x00,0x00,0x60,0xc2,0x01,0x50,0xeb,0xbb,0xb6,0x00,0x0a,
+0xa7,0x01,0x10,0x3b,0x13,0x00,0xb0,0xcd,0xbb,0xbb,0xb0,0x0b,0x6a,0x00,0x00,0xb0,
+0x24,0x1a,0x84,0x01,0x60,0x1e,0xbb,0xbb,0xc0,0x00,0x1a,0x18,0x07,0xf1,0x0d,0xca,
+0xaa,0xad,0x00,0x05,0x71,0x11,0x1c,0x00,0x03,0x88,0x88,0x87,0x00,0x59,0x99,0x99,
+0x99,0x90,0x01,0xa3,0x11,0x11,0x10,0x00,0xfb,0xaa,0xa9,0xce,0x05,0x20,0x00,0x00,
+0x98,0x00,0x67,0x00,0x00,0x7a,0xb1,0x00,0x00,0x28,0x01,0xf2,0x03,0x8a,0x00,0x00,
+0x00,0x08,0x77,0x90,0x00,0x04,0xc5,0x00,0x4c,0x40,0x4b,0x7a,0xaa,0xa6,0xa3,0x1d,
+0x00,0x30,0xea,0xaa,0xae,0x61,0x00,0x15,0x0c,0x0a,0x00,0xf0,0x03,0x0b,0x00,0xeb,
+0xbb,0xbb,0xbe,0xb1,0x44,0x44,0x2b,0xb2,0x55,0x55,0x2b,0xb0,0x99,0x99,0x0b,0x8b,
+0x03,0x01,0x04,0x00,0xf0,0x1d,0xda,0xab,0x0b,0xb0,0x20,0x00,0x0b,0xb0,0x00,0x01,
+0xbb,0x00,0x04,0x30,0x00,0x00,0x03,0xfa,0x99,0x70,0x07,0xa2,0x11,0x85,0x03,0x73,
+0x80,0x69,0x00,0x00,0x07,0xd7,0x00,0x00,0x4a,0xfc,0x99,0x90,0x67,0xc1,0x11,0x1c,
+0x00,0x0a,0x4b,0x00,0x32,0xaa,0xaa,0xae,0x09,0x00,0xa0,0x04,0x10,0x00,0x00,0x0d,
+0x00,0x00,0xbb,0xce,0xbb,0x49,0x01,0x82,0x0b,0xb0,0xaa,0xaa,0x0b,0xb0,0xa0,0x0a,
+0x04,0x00,0x50,0xda,0xaa,0x0b,0xb0,0x30,0x55,0x00,0xf1,0x0a,0x05,0xbb,0x0b,0xbb,
+0xbf,0xcb,0xb5,0x00,0x00,0xab,0x20,0x00,0x00,0x5c,0x79,0x6b,0x50,0x1d,0x81,0x29,
+0x00,0x87,0x00,0x00,0x14,0xa6,0x00,0x20,0xab,0x70,0x48,0x00,0x90,0x70,0x00,0xe9,
+0x99,0x9b,0x70,0x00,0xc1,0x11,0xf7,0x07,0x10,0x13,0xdc,0x00,0x00,0xf9,0x05,0xe1,
+0x4b,0x42,0xb4,0x00,0x2c,0x91,0x68,0x18,0xc3,0x01,0xaa,0xab,0xa6,0x10,0x83,0x02,
+0xe2,0x00,0xaa,0xac,0xda,0x00,0x01,0xa0,0x00,0x0b,0x00,0x01,0xd9,0x99,0x9e,0x0a,
+0x00,0xf2,0x05,0x00,0x73,0x0c,0x00,0x00,0x01,0xdb,0xae,0xaa,0x90,0x0a,0x20,0x0c,
+0x00,0x00,0x1b,0xaa,0xae,0xaa,0xa6,0x05,0x01,0x40,0xda,0xaa,0xac,0x60,0x5f,0x00,
+0xf1,0x24,0x60,0x00,0xd9,0x99,0x9b,0x60,0x00,0xb1,0x11,0x15,0x60,0x0a,0xbb,0xbb,
+0xbb,0xb0,0xa1,0x0b,0x00,0x0b,0x0a,0x39,0xe9,0x91,0xb0,0xa4,0x7d,0x77,0x3b,0x0b,
+0x12,0x22,0x21,0xb0,0xb0,0xd9,0x9c,0x0b,0x0b,0x0a,0x00,0xb0,0xb4,0x80,0xd9,0x97,
+0x0b,0x91,0x01,0x00,0x7b,0x49,0x07,0xf2,0x04,0xe9,0xa7,0xb9,0x9e,0xe8,0x97,0xb8,
+0x8e,0xc1,0x37,0xb1,0x1c,0xd7,0x73,0x57,0x7d,0xb0,0x89,0x96,0xdd,0x00,0xf0,0x29,
+0xb0,0x0a,0x0b,0xb0,0xb9,0x96,0x0c,0xb0,0x00,0x04,0xbb,0x08,0xba,0x94,0xca,0xd0,
+0x08,0x21,0x94,0x50,0xb0,0x06,0xaa,0xa4,0xba,0xb0,0x00,0x00,0xc0,0x4a,0x00,0x2a,
+0xaf,0xaa,0xeb,0xa7,0x04,0xc5,0x00,0x2b,0x71,0x2b,0xb8,0xb5,0xb8,0xd5,0x05,0x50,
+0xb5,0x50,0xb0,0x05,0xca,0xa5,0xca,0xb0,0x83,0x01,0x10,0x1b,0xc9,0x00,0x90,0xb0,
+0x8a,0xaa,0x0b,0x1b,0x0b,0x00,0xb0,0xb1,0x6d,0x04,0x50,0x1b,0x0b,0xaa,0xd0,0xb1,
+0x41,0x01,0x50,0x1e,0xbb,0xbb,0xbb,0xe1,0x09,0x00,0x10,0x10,0x29,0x00,0xf1,0x15,
+0x0b,0x00,0x80,0x80,0xb0,0xb5,0xad,0x9d,0x8b,0x0b,0x01,0x90,0xa0,0xb0,0xb6,0xad,
+0xae,0x8b,0x0b,0x07,0x40,0xa0,0xb0,0xb3,0x90,0x0a,0x0b,0x0e,0x99,0x99,0x99,0xe0,
+0xc1,0x11,0x11,0x1b,0xd5,0x01,0xf2,0x00,0xb0,0x04,0x30,0x0b,0xb6,0x9c,0xb9,0x6b,
+0xb0,0x05,0x40,0x0b,0xb0,0xc9,0x9c,0xa3,0x00,0xf1,0x08,0x98,0x89,0x0b,0xe9,0x99,
+0x99,0x9e,0xb1,0x11,0x11,0x1c,0xea,0xaa,0xaa,0xae,0xb3,0x99,0x99,0x5c,0xb0,0x12,
+0xa1,0x0c,0x04,0x00,0xb0,0x89,0xda,0x3c,0xb0,0x01,0x96,0x2c,0xb4,0x88,0x88,0x6c,
+0x1c,0x00,0x00,0x82,0x07,0x00,0x18,0x01,0x90,0xb3,0x0a,0x10,0x02,0x00,0x00,0x0a,
+0x10,0x0b,0x06,0x07,0x00,0x05,0x00,0x64,0x4b,0xbe,0xbb,0x80,0x0b,0x00,0x0f,0x00,
+0xc1,0x38,0x11,0x1c,0x11,0x10,0x73,0x99,0x99,0x99,0x94,0x00,0x00,0xca,0x07,0x11,
+0xa0,0xf7,0x07,0x40,0xbb,0xb6,0x00,0x2b,0x11,0x09,0x10,0xb3,0xa1,0x04,0x60,0xe0,
+0xbb,0xeb,0xb1,0x27,0xb0,0x6f,0x08,0x06,0x05,0x00,0x42,0xb5,0xbb,0xeb,0xb6,0xb1,
+0x02,0xf1,0x16,0xa0,0x05,0x70,0x00,0x01,0xa0,0x0d,0xa9,0x97,0x3b,0xe9,0xa3,0x00,
+0x0a,0x01,0xa0,0x48,0x40,0x0a,0x01,0xa0,0x00,0xa3,0x19,0x01,0xa7,0x10,0x29,0x58,
+0x08,0xd4,0x29,0xa1,0x37,0x26,0x00,0x53,0xd6,0x07,0x23,0x6a,0xb1,0x32,0x00,0xd1,
+0xca,0xea,0xe1,0x01,0xa0,0xa0,0xb0,0xa1,0x3c,0xe9,0xca,0xea,0xd1,0x0a,0x00,0xf1,
+0x01,0x01,0xa0,0x8a,0xea,0xa0,0x01,0xc8,0x11,0xc2,0x10,0x3c,0xa2,0x99,0xea,0x92,
+0x12,0x68,0x03,0xf0,0x1c,0x07,0xbb,0xeb,0xb6,0x08,0xca,0x6b,0xaa,0xe0,0x01,0x83,
+0x0a,0x00,0xb0,0x3a,0xcb,0x9a,0x0a,0xa0,0x07,0x17,0x2b,0x88,0x81,0x1c,0xbe,0x7a,
+0xa1,0xb0,0x00,0x82,0x0a,0x56,0xa0,0x4a,0xdb,0x9a,0x0e,0x30,0x00,0x82,0x0a,0x5c,
+0x0f,0x00,0x35,0xa0,0x66,0x00,0xca,0x06,0xf1,0x14,0x05,0x90,0x2b,0xa3,0x00,0x03,
+0x28,0xd5,0x4c,0xa4,0x08,0x53,0x37,0xa4,0x12,0x00,0x36,0x9a,0xc9,0x90,0x02,0x82,
+0x83,0x76,0x60,0x0a,0x19,0x3a,0x60,0x81,0x04,0x99,0xab,0x99,0x80,0x20,0x04,0x52,
+0x29,0x99,0xad,0x99,0x97,0x35,0x00,0xf0,0x16,0x90,0x0b,0x04,0x80,0x01,0x90,0xb9,
+0xb9,0xa4,0x2b,0xe7,0xd8,0xd8,0xb5,0x01,0x90,0xa0,0xa0,0x55,0x01,0x90,0x99,0x99,
+0x93,0x01,0xb7,0x79,0x88,0xc0,0x3c,0x82,0x89,0x88,0xe0,0x00,0x00,0x81,0xfb,0x00,
+0xe0,0x8a,0x99,0xd0,0x0a,0xaa,0xbd,0xaa,0xa4,0x00,0x00,0x38,0x00,0x00,0x04,0xd5,
+0x03,0x41,0x02,0x99,0x99,0x99,0xa2,0x04,0xd2,0xb0,0x05,0xc8,0xac,0x88,0xc0,0x08,
+0x41,0x11,0x11,0x80,0x1c,0x00,0xf2,0x08,0x00,0x01,0x00,0xf0,0x0a,0x34,0x00,0x00,
+0x0a,0xaa,0xbe,0xaa,0xa4,0x00,0x35,0x60,0xa3,0x00,0x02,0xa5,0x60,0xa5,0x90,0x09,
+0x14,0x50,0x90,0x62,0x00,0x05,0xc4,0x08,0xf4,0x04,0x7e,0x99,0xbd,0x00,0x0a,0x66,
+0x93,0xc2,0x00,0x00,0x26,0xde,0x82,0x00,0x1c,0xa6,0x00,0x49,0xb6,0xce,0x05,0xf0,
+0x12,0xc0,0x00,0x02,0xeb,0xc2,0xc0,0x00,0x08,0x30,0xc0,0xc1,0x00,0x2b,0x21,0xc0,
+0xdc,0x30,0x33,0xba,0x70,0xc1,0xc3,0x00,0x0e,0x10,0xc0,0x12,0x00,0x87,0x00,0xc0,
+0x00,0x07,0x23,0x00,0x12,0x49,0x5b,0x06,0x10,0x51,0x34,0x04,0xf1,0x19,0xfa,0xa8,
+0x00,0x03,0xb6,0x00,0xb3,0x00,0x04,0x18,0x8c,0x40,0x00,0x01,0x5b,0xa7,0xa0,0x00,
+0x0b,0x72,0x6c,0xaa,0xe2,0x00,0x5c,0x91,0x06,0x70,0x00,0x40,0x1b,0xa8,0x00,0x00,
+0x36,0xba,0x30,0x00,0x0b,0x85,0x60,0x00,0x13,0x39,0x7e,0x04,0x90,0x1b,0xbb,0xdd,
+0xbb,0xb7,0x00,0x00,0x9e,0x20,0x84,0x05,0xf1,0x03,0x90,0x00,0x00,0x07,0x70,0xb1,
+0x00,0x00,0x4c,0x00,0x3c,0x10,0x09,0xb0,0x00,0x05,0xd4,0x05,0xc7,0x00,0x00,0xeb,
+0x00,0xf0,0x30,0x02,0xeb,0xcd,0xbc,0xa0,0x02,0x90,0x38,0x01,0xa0,0x02,0x90,0x47,
+0x01,0xa0,0x2c,0xeb,0xdd,0xbc,0xe7,0x00,0x00,0xb9,0x40,0x00,0x00,0x08,0x80,0xb2,
+0x00,0x03,0xb7,0x00,0x2c,0x82,0x18,0x20,0x00,0x00,0x67,0x00,0x82,0x38,0x00,0x00,
+0x00,0xeb,0xce,0xbb,0x90,0x09,0x40,0x38,0x00,0x00,0x06,0x00,0x47,0x00,0x00,0x2b,
+0xbb,0xde,0x64,0x00,0x20,0xc9,0x50,0x2d,0x00,0x81,0xc2,0x00,0x03,0xb8,0x00,0x2c,
+0x61,0x19,0x2d,0x00,0xf0,0x22,0x00,0x01,0x24,0x60,0x07,0x66,0x98,0x84,0x70,0x0a,
+0x74,0x91,0x94,0x80,0x01,0x76,0xba,0xbd,0xa6,0x1a,0xd4,0x46,0x05,0x60,0x14,0x64,
+0x09,0x16,0x60,0x00,0x43,0x37,0x48,0x10,0x29,0x99,0xee,0xb9,0x96,0x00,0x18,0x83,
+0xc4,0x00,0x2a,0x93,0x00,0x18,0xb7,0xb4,0x07,0x01,0x13,0x08,0x40,0x00,0x1b,0xbe,
+0xbb,0xa8,0x02,0x00,0xc7,0x00,0xf3,0x04,0xb3,0x6a,0xad,0xb0,0x0b,0xd0,0x00,0x67,
+0x00,0x35,0xb4,0xbb,0xeb,0xb8,0x00,0xb0,0x00,0xa1,0x00,0x05,0x00,0x15,0x2a,0xb2,
+0x07,0xf2,0x03,0x52,0x00,0x00,0x06,0x66,0xab,0x66,0x62,0x0b,0x44,0x44,0x44,0x95,
+0x0a,0x6a,0xaa,0xa9,0x75,0x53,0x0b,0x10,0xbb,0x46,0x00,0x42,0x0c,0x01,0xa0,0x00,
+0x05,0x00,0x98,0x77,0x01,0xa0,0x0b,0x1b,0x80,0x00,0xcb,0xb6,0x92,0x05,0x10,0x2b,
+0xe9,0x08,0xf0,0x10,0xaa,0xaa,0xe1,0x0b,0x01,0x11,0x11,0xb1,0x01,0x69,0xae,0x99,
+0x40,0x00,0x62,0x0b,0x00,0x00,0x00,0xc1,0x0e,0xaa,0x70,0x00,0xe7,0x0b,0x00,0x00,
+0x09,0x5b,0x6b,0x0e,0x06,0x33,0x8d,0xcb,0xb4,0x37,0x00,0xf5,0x21,0x32,0x00,0x00,
+0x09,0x99,0xbd,0x99,0x91,0x0b,0x00,0x34,0x00,0xa2,0x05,0x99,0xbc,0x99,0x60,0x00,
+0x22,0x67,0x22,0x00,0x00,0x77,0xaa,0x77,0x10,0x1a,0xaa,0xdb,0xaa,0xa6,0x00,0x06,
+0x97,0x60,0x00,0x03,0xa8,0x00,0x8a,0x51,0x07,0x10,0x00,0x01,0x73,0x26,0x02,0xf0,
+0x12,0xa3,0x0b,0x05,0x00,0x50,0x74,0x02,0x96,0x15,0x4b,0x30,0x09,0x50,0xbb,0x41,
+0xa0,0x00,0x3b,0x20,0x96,0x00,0x1a,0xfc,0xaa,0xaf,0xc4,0x15,0xa1,0x00,0x0b,0x12,
+0x00,0xa1,0xb7,0x03,0x30,0xab,0xaa,0xad,0x8e,0x02,0x40,0x00,0xb0,0x38,0xab,0x44,
+0x08,0xf4,0x12,0x05,0x4b,0xbb,0xe9,0x0a,0x19,0x11,0x00,0xb0,0x03,0xbb,0x09,0x40,
+0xb0,0x00,0x7a,0x01,0xb0,0xb0,0x00,0xbb,0x20,0x30,0xb0,0x09,0x62,0x70,0x00,0xb0,
+0x47,0x00,0x00,0x7c,0x43,0x0c,0x14,0x1a,0x05,0x00,0xf0,0x07,0x80,0x1a,0x06,0x10,
+0x01,0xc0,0x1a,0x03,0x90,0x06,0x70,0x1a,0x00,0xb2,0x0c,0x10,0x1a,0x00,0x58,0x26,
+0x00,0x1a,0x02,0x06,0x10,0x2a,0x45,0x0a,0x12,0xc7,0x81,0x02,0xf3,0x18,0x00,0x00,
+0x30,0xb0,0x03,0x00,0x05,0x60,0xb0,0x0b,0x10,0x0b,0x00,0xb0,0x02,0xa0,0x65,0x00,
+0xb0,0x00,0x91,0x00,0x00,0xb0,0x19,0x00,0x00,0x00,0x13,0xc2,0x00,0x00,0x04,0xaa,
+0x10,0x00,0x7c,0xb7,0x10,0x62,0x01,0x00,0x3b,0x06,0x00,0x6b,0x04,0x40,0x00,0x00,
+0x5b,0xbe,0x3d,0x06,0x01,0x85,0x07,0x01,0x65,0x01,0xf0,0x60,0xca,0xbd,0xcb,0x90,
+0x03,0x90,0x09,0x20,0x00,0x0c,0x20,0x09,0x20,0x00,0x87,0x00,0x09,0x20,0x00,0x50,
+0x9b,0xbe,0xcb,0xb3,0x00,0x13,0x00,0x05,0x00,0x02,0x4c,0x33,0x89,0x30,0x05,0x77,
+0xba,0x77,0x71,0x02,0xaa,0xdc,0xaa,0x70,0x02,0x22,0xc2,0x22,0x21,0x18,0x8d,0xa8,
+0x88,0x84,0x00,0x3e,0xba,0xaa,0x90,0x05,0xc1,0x03,0x80,0x00,0x1a,0x69,0x9a,0xc9,
+0x95,0x00,0x11,0x11,0x11,0x11,0x0a,0x00,0xa0,0x92,0x0a,0xb9,0x9c,0x8b,0x93,0xb3,
+0x88,0x88,0x66,0x43,0x64,0x00,0x0b,0x21,0x03,0x88,0xd8,0x60,0x03,0xaa,0xae,0xaa,
+0x70,0x56,0x00,0xb0,0x1a,0x05,0x60,0x0b,0x39,0x90,0x00,0x1a,0x09,0xf3,0x05,0x08,
+0xbb,0xbb,0xbb,0xb1,0x00,0x50,0x29,0x03,0x30,0x00,0x92,0x29,0x0b,0x10,0x00,0x35,
+0x29,0x27,0x00,0x31,0x08,0x13,0x39,0x1d,0x08,0x08,0x05,0x00,0xf0,0x06,0x06,0x00,
+0x00,0x06,0x99,0x9e,0x99,0x94,0x0b,0x11,0x61,0x16,0x10,0x0b,0x79,0xe9,0x9e,0x93,
+0x0b,0x00,0xb0,0x22,0x05,0xf1,0x08,0xa9,0x98,0x00,0x0b,0x59,0x99,0x9a,0x50,0x1b,
+0x02,0xb2,0x4b,0x10,0x56,0x03,0x7e,0xe5,0x10,0x52,0x96,0x30,0x15,0x94,0x18,0x02,
+0xf0,0x15,0x01,0x11,0x2c,0x11,0x10,0x0c,0x99,0x99,0x99,0x93,0x0b,0x05,0x08,0x05,
+0x00,0x0b,0x0c,0x0b,0x0c,0x00,0x0b,0x78,0xab,0x87,0xa1,0x0b,0x40,0x2b,0x30,0x31,
+0x0a,0x49,0x9e,0x99,0x70,0x56,0xae,0x01,0x55,0x93,0xaa,0xae,0xaa,0xa4,0x25,0x01,
+0x80,0x60,0x5a,0xe1,0xaa,0xe6,0x20,0x02,0x90,0x5b,0x05,0xf3,0x14,0x20,0x60,0xb1,
+0x10,0x1c,0xb7,0xa0,0xb8,0x81,0x02,0x65,0xa0,0xb0,0x00,0x0b,0xa1,0xa0,0xb0,0x00,
+0x07,0xc0,0x8a,0xba,0xa2,0x09,0xd7,0x00,0x00,0x00,0x59,0x07,0xbb,0xbb,0xb2,0x10,
+0x86,0x02,0x71,0xa4,0x80,0x2b,0xbb,0xbc,0xeb,0xc7,0x82,0x08,0xe0,0x01,0x11,0x10,
+0xc0,0x00,0x08,0xae,0xa5,0xb0,0x00,0x00,0x0a,0x00,0x83,0x05,0x00,0xf2,0x01,0x48,
+0x04,0x02,0x6e,0xb8,0x0c,0x0a,0x09,0x52,0x00,0x04,0xd7,0x0a,0xaa,0xb8,0xaa,0x61,
+0x0a,0x60,0x0d,0xaa,0x78,0xba,0xa0,0x0b,0x6e,0x01,0xf1,0x0a,0x09,0xaa,0xc6,0xaa,
+0xd1,0x09,0x92,0xb5,0xa4,0xa0,0x00,0x4a,0xa0,0x2a,0xe0,0x1b,0x75,0x88,0x92,0xb0,
+0x00,0x8b,0x30,0x69,0x90,0xe1,0x02,0xf0,0x23,0x1a,0xaa,0x4c,0x99,0x92,0x00,0x0a,
+0x4b,0x88,0x80,0x0a,0xaa,0x48,0x33,0x20,0x0a,0x00,0x49,0x55,0x40,0x0d,0xa7,0xca,
+0xc9,0x94,0x00,0x0a,0x82,0x92,0xa0,0x00,0x19,0x82,0x1e,0x20,0x00,0x37,0x84,0x56,
+0x80,0x09,0xc3,0x98,0x20,0x65,0x00,0x00,0x00,0x00,0x00,0xf0,0x24,0x00,0x00,0x02,
+0x30,0x00,0x3a,0xaa,0x0a,0x15,0x10,0x00,0x0a,0x79,0x58,0xb0,0x1b,0xaa,0x66,0xb3,
+0x62,0x37,0x00,0x79,0xe9,0x90,0x5b,0x86,0xa0,0xb0,0xb0,0x02,0x2b,0xb9,0xe9,0xe0,
+0x00,0x0a,0x00,0xb1,0x50,0x00,0x28,0x01,0xb3,0xd1,0x07,0xb5,0xcb,0xa9,0x96,0x00,
+0x01,0x00,0xf0,0x09,0x51,0x09,0x20,0x26,0x3a,0x09,0x20,0xb2,0x07,0x09,0x22,0x60,
+0x7b,0xbd,0xbb,0xb8,0x00,0x00,0x00,0x1a,0x3b,0xbb,0xbb,0xca,0x08,0x00,0x80,0x89,
+0x99,0x99,0xaa,0x11,0x11,0x11,0x3a,0x28,0x00,0xf6,0x1f,0x40,0x3c,0xdb,0xe8,0x08,
+0x80,0x03,0x70,0xb0,0xb6,0x00,0x03,0x70,0xb0,0x00,0x52,0x5c,0xda,0xea,0x07,0x90,
+0x04,0x60,0xb0,0xa7,0x00,0x06,0x50,0xb0,0x10,0x45,0x08,0x30,0xb0,0x02,0xc0,0x0c,
+0x00,0xb0,0x5c,0x10,0x55,0x00,0xb5,0x90,0x00,0x01,0x00,0xf3,0x1d,0x0c,0x88,0x99,
+0x04,0xa0,0x0c,0x77,0x89,0x7a,0x00,0x09,0x89,0x86,0x40,0x31,0x39,0xad,0x98,0x05,
+0xa0,0x07,0x88,0x84,0x99,0x00,0x0b,0x00,0x37,0x20,0x22,0x08,0x9d,0x93,0x01,0xc1,
+0x0b,0x1a,0x82,0x2b,0x30,0x23,0x87,0x05,0xb1,0x33,0x00,0xf0,0x16,0xb1,0x00,0xb0,
+0x00,0x2b,0x30,0xaa,0xea,0xa2,0x00,0xa5,0x22,0xc2,0x22,0x08,0xb4,0x66,0x6a,0x95,
+0x57,0xb4,0x88,0x8b,0xb5,0x00,0xb0,0x52,0x17,0x61,0x00,0xb0,0x59,0x06,0x40,0x00,
+0xb0,0x09,0x05,0x00,0x33,0x00,0x8c,0x20,0x32,0x00,0xf1,0x4e,0x08,0x40,0x00,0x0a,
+0x30,0x86,0x19,0x30,0x02,0x86,0x9c,0x83,0x40,0x05,0xb3,0xdc,0x99,0xc2,0x3a,0xb1,
+0x2c,0x10,0x16,0x00,0xb1,0xbc,0x9b,0xa0,0x00,0xb7,0x4a,0x5c,0x10,0x00,0xb0,0x28,
+0xea,0x20,0x00,0xb8,0x93,0x04,0xa8,0x00,0x51,0x33,0x00,0x00,0x04,0x90,0xba,0x99,
+0x96,0x3a,0x26,0xb4,0x44,0x40,0x00,0xc7,0xb5,0x55,0xc0,0x09,0xb0,0xa7,0x77,0xd0,
+0x57,0xa0,0x8a,0x88,0xb0,0x00,0xa0,0x3e,0x88,0x70,0x00,0xa4,0xab,0x18,0x70,0x00,
+0xa1,0x17,0xfc,0x10,0x00,0xa7,0xb7,0x14,0x98,0x63,0x00,0xf7,0x1e,0x09,0x44,0x84,
+0x19,0x00,0x85,0x38,0x88,0x4a,0x42,0x06,0x6b,0xbb,0x87,0xb4,0x2e,0x16,0x66,0xe4,
+0xa0,0xbc,0x14,0x44,0x68,0xb0,0x0a,0x0b,0x9a,0x0b,0x70,0x0a,0x09,0x0b,0x4b,0x30,
+0x0a,0x19,0x1a,0x6a,0xa0,0x0a,0x53,0x03,0x90,0x56,0x00,0x01,0xf0,0x20,0x08,0x50,
+0x01,0x20,0x00,0x00,0x8a,0x0b,0x30,0x00,0x07,0x02,0x58,0x00,0x09,0x1c,0x02,0xc5,
+0x20,0x0c,0x0c,0x2c,0x22,0xb0,0x48,0x0d,0xb1,0x00,0x93,0x31,0x5e,0x10,0x05,0x25,
+0x2b,0x8c,0x00,0x0b,0x00,0x22,0x09,0xcb,0xc7,0x00,0x00,0x00,0x01,0x33,0x00,0xf2,
+0x1c,0x2a,0x00,0x00,0x0c,0xbb,0xbb,0xbb,0xb5,0x0b,0x00,0x57,0x00,0x00,0x0b,0x00,
+0x06,0xb0,0x00,0x0b,0x00,0xb0,0x20,0x10,0x0b,0x47,0xb0,0x02,0xa0,0x0b,0x74,0xb0,
+0x02,0xa2,0x47,0xb0,0xb0,0x0a,0x47,0x83,0x10,0x8a,0xb8,0x01,0x64,0x00,0x10,0x03,
+0x05,0x00,0xf0,0x44,0x2f,0x99,0x92,0x00,0x02,0xb1,0x01,0xc0,0x00,0x0a,0x9a,0xaa,
+0xaa,0x90,0x00,0x57,0x77,0x78,0x90,0x00,0x11,0x11,0x13,0x90,0x00,0x99,0xba,0x99,
+0x60,0x01,0x24,0x4a,0x00,0x70,0x09,0x59,0x06,0x46,0x57,0x07,0x0c,0xaa,0xab,0x06,
+0x0a,0x05,0x68,0xb6,0x60,0x4b,0x84,0x8a,0xc8,0x70,0x8a,0x44,0x36,0x93,0x31,0x8a,
+0x05,0x55,0x55,0x52,0x1a,0x05,0xb9,0x99,0xa0,0x0a,0x05,0xa8,0x88,0xa0,0x0a,0x05,
+0xb8,0x89,0xa0,0x0a,0x05,0x50,0x00,0x05,0x00,0xf2,0x3e,0x2a,0x70,0x00,0x65,0x0a,
+0x99,0xe0,0x2a,0xdc,0x9a,0x44,0xc0,0x00,0xd9,0x0a,0x44,0xc0,0x08,0x98,0xaa,0x99,
+0xd0,0x38,0x65,0x0a,0x00,0xb0,0x00,0x44,0x37,0x88,0x80,0x05,0x16,0x3a,0x02,0x80,
+0x0c,0x0b,0x04,0x25,0xa2,0x15,0x0b,0xaa,0xb4,0x21,0x00,0x00,0x12,0x00,0x00,0x06,
+0x99,0xad,0x99,0x90,0x00,0x0b,0x00,0x75,0x00,0x09,0x99,0x99,0x99,0x94,0x00,0xc8,
+0x88,0x8b,0x40,0x00,0xd7,0x77,0x7b,0x40,0x0a,0x00,0xe1,0x12,0x77,0x01,0x20,0x08,
+0x4b,0x06,0x33,0xb0,0x07,0x09,0x99,0xb3,0x32,0xc2,0x00,0xf4,0x4b,0x05,0x84,0x35,
+0x76,0x50,0x3b,0x88,0xa7,0x70,0x51,0x0a,0x77,0x92,0x99,0x80,0x0c,0x77,0xb5,0x55,
+0x80,0x0c,0x66,0xb5,0xa4,0x21,0x0a,0x07,0x93,0xb9,0xb1,0x03,0x01,0x66,0x00,0x60,
+0x2a,0x46,0x07,0x32,0xb0,0x42,0x2c,0x99,0xb2,0x42,0x00,0x00,0x07,0x48,0x50,0x08,
+0xbb,0xbd,0xcb,0xd4,0x0c,0x00,0x05,0x60,0x20,0x0c,0xaa,0x83,0x74,0x90,0x0c,0x00,
+0xb1,0xab,0x20,0x0b,0x00,0xa0,0xc8,0x00,0x0b,0x5a,0x72,0xe4,0x26,0x48,0x01,0x2c,
+0x3a,0x45,0x82,0x00,0x92,0x07,0xc1,0x88,0x01,0xf1,0x02,0x14,0x20,0x05,0xaa,0xbd,
+0x96,0x20,0x00,0x00,0x29,0x00,0x00,0x06,0xbb,0xbe,0xbb,0xb1,0x0a,0x00,0x01,0x05,
+0x00,0x56,0x2b,0xbb,0xce,0xbb,0xb8,0x0f,0x00,0xf1,0x05,0x00,0x1b,0xc6,0x00,0x00,
+0x00,0xb0,0x7c,0xbb,0xe0,0x48,0xd8,0x73,0x00,0xb0,0x12,0xb2,0x73,0x00,0xb0,0x0f,
+0x00,0xf2,0x0a,0x38,0xfb,0x92,0x64,0x00,0x44,0xb0,0x90,0x19,0x00,0x00,0xb0,0xb0,
+0x0b,0x00,0x00,0xb2,0x90,0x05,0x90,0x3a,0x88,0x10,0x00,0x84,0x62,0x00,0xf0,0x0e,
+0xb0,0xbb,0xeb,0xbb,0x18,0xd6,0xa0,0xb0,0x0b,0x03,0xc2,0xba,0xea,0xbb,0x00,0xb0,
+0xa0,0xb0,0x0b,0x18,0xe8,0xb9,0xd9,0x9b,0x13,0xb0,0x71,0xb1,0x27,0x43,0x00,0x11,
+0x00,0x05,0x00,0x20,0x0a,0x80,0x0a,0x00,0x02,0x32,0x00,0xf0,0x10,0xab,0xbb,0xb2,
+0x38,0xd8,0xa1,0x00,0x00,0x12,0xc2,0xab,0xbb,0x90,0x00,0xb0,0xa1,0x00,0xa0,0x16,
+0xeb,0xa1,0x00,0xa0,0x36,0xb0,0xab,0xaa,0xa0,0x00,0xb0,0xa1,0x23,0x00,0xf7,0x52,
+0xa3,0x11,0x10,0x1a,0x80,0x69,0x99,0x94,0x08,0x20,0x01,0x90,0x00,0x7c,0xa6,0xb8,
+0x98,0x83,0x19,0x45,0x60,0x80,0x00,0x08,0x25,0x60,0xc0,0x00,0x3b,0xd8,0x52,0x92,
+0x00,0x7b,0x27,0x37,0x45,0x50,0x08,0x29,0x1c,0x00,0xb0,0x08,0x3b,0x4c,0x57,0xd2,
+0x5c,0x55,0x47,0x53,0x45,0x07,0x30,0x11,0xb1,0x10,0x7c,0xa2,0x66,0xd6,0x50,0x18,
+0x43,0x55,0xc5,0x51,0x07,0x43,0x55,0x5c,0x51,0x6d,0xb6,0x88,0x8d,0x92,0x48,0x30,
+0x62,0x1b,0x20,0x07,0x30,0x57,0x0a,0x00,0x07,0x30,0x08,0x0a,0x00,0x5c,0x10,0x00,
+0xac,0xac,0x02,0xf2,0x1e,0x06,0x53,0x88,0xc4,0x10,0x6b,0xb8,0xaa,0xea,0xa2,0x17,
+0x61,0x33,0xb3,0x30,0x06,0x55,0xa6,0xd6,0xc0,0x5c,0xc7,0xc9,0xd9,0xd0,0x47,0x54,
+0x60,0xa0,0xb0,0x06,0x54,0xc9,0xd9,0xd0,0x06,0x50,0x10,0xa0,0x10,0x4c,0x30,0x00,
+0xa0,0x00,0x16,0x03,0xf2,0x1d,0x10,0x15,0x71,0x10,0x2a,0x43,0xb9,0x8b,0x90,0x5c,
+0x70,0x35,0x1a,0x00,0x09,0x17,0xac,0xba,0xa2,0x0a,0xb0,0x0b,0x10,0x00,0x9d,0x28,
+0xcb,0x9e,0x93,0x09,0x10,0xd3,0x2a,0x00,0x09,0x10,0x1b,0xf8,0x00,0x5b,0x09,0xa6,
+0x06,0xa0,0x10,0x03,0xf2,0x49,0x30,0x72,0x91,0x00,0x7c,0xa3,0xda,0xdb,0xa3,0x18,
+0x49,0xb0,0xb0,0x00,0x08,0x49,0xda,0xea,0xa1,0x3b,0xc3,0xa0,0xb0,0x00,0x6a,0x30,
+0xda,0xea,0xa1,0x08,0x30,0xa0,0xb0,0x00,0x08,0x30,0xda,0xea,0xa5,0x5c,0x10,0xa0,
+0x00,0x00,0x07,0x20,0x81,0x06,0x50,0x29,0x65,0x8a,0x6d,0x63,0x4a,0x74,0x66,0x33,
+0x52,0x07,0x38,0x6b,0x09,0x82,0x4c,0xb9,0x9d,0x09,0x82,0x38,0x28,0x2a,0x09,0x82,
+0x07,0x28,0x7c,0x08,0x82,0x07,0x28,0x09,0x00,0x82,0x5c,0x18,0x4a,0x05,0x55,0x01,
+0xf3,0x1e,0x07,0x20,0x1c,0x53,0x00,0x3a,0x60,0x93,0x85,0x00,0x3a,0x66,0xd9,0x99,
+0xc0,0x07,0x20,0x97,0x35,0x90,0x0a,0xc0,0xa8,0x09,0xa0,0x7c,0x30,0x91,0xa0,0xa0,
+0x07,0x27,0x9b,0xf9,0x94,0x07,0x20,0x1b,0x39,0x00,0x4c,0x19,0x92,0x03,0x94,0xc3,
+0x00,0xf0,0x1c,0xb8,0x8c,0x00,0x5c,0x80,0xb7,0x7c,0x00,0x1a,0x36,0x97,0x69,0x70,
+0x09,0x19,0x09,0x90,0x90,0x0b,0xdb,0x8b,0xa8,0xc0,0x4b,0x19,0xac,0xca,0xa1,0x09,
+0x10,0x4e,0xe5,0x00,0x09,0x15,0xb5,0x6a,0x50,0x3b,0x38,0x04,0x60,0x71,0x09,0x05,
+0xf3,0x4c,0x00,0x0e,0x9a,0xb0,0xc0,0x00,0x0b,0x00,0xb3,0xc7,0x76,0x0d,0x99,0xba,
+0x94,0xd4,0x0b,0x00,0xdd,0xb1,0xc0,0x0d,0x88,0xd2,0xb7,0x70,0x0e,0x9a,0xb0,0x4e,
+0x10,0x06,0x36,0x20,0x9e,0x40,0x2c,0x01,0xaa,0x81,0xc6,0x22,0x00,0x14,0x00,0x05,
+0x16,0x93,0x70,0x80,0x00,0x6b,0xeb,0x94,0xca,0xa2,0x05,0xfb,0x27,0x64,0x70,0x4a,
+0xa2,0x8c,0x96,0x40,0x40,0x80,0x34,0xb9,0x10,0x4d,0xbb,0x70,0x8a,0x00,0x0c,0x4a,
+0x00,0x8a,0x00,0x03,0xdc,0x16,0x87,0x70,0x67,0x01,0x77,0x00,0x83,0x88,0x01,0x10,
+0x33,0x05,0x00,0x10,0x2b,0x99,0x02,0x00,0x91,0x05,0xf0,0x43,0x75,0x00,0x0c,0x00,
+0x00,0x0c,0x00,0x67,0x00,0x00,0x05,0x92,0xc0,0x00,0x00,0x00,0x9d,0x20,0x00,0x00,
+0x05,0xc9,0xa1,0x00,0x06,0xc9,0x00,0x4c,0x93,0x17,0x10,0x00,0x00,0x34,0x00,0x60,
+0x00,0x00,0x40,0x38,0xca,0x84,0xa9,0x60,0x08,0x16,0x57,0x40,0x00,0x29,0x6b,0x57,
+0x73,0x32,0x25,0xa7,0x58,0xa8,0xd4,0x49,0xca,0x98,0x40,0xa0,0x05,0x75,0x28,0x30,
+0xa0,0x1a,0x75,0x8a,0x10,0xa0,0x64,0x73,0x7c,0x00,0xa0,0x02,0xb1,0x36,0xbe,0x01,
+0x13,0x22,0x6a,0x04,0x80,0x0b,0xbb,0xbd,0xbb,0xb6,0x00,0x07,0x40,0x0a,0x01,0xf2,
+0x0c,0x51,0x11,0x00,0x00,0x0b,0xa9,0x9c,0x40,0x00,0x0b,0x00,0x08,0x30,0x00,0x67,
+0x00,0x09,0x10,0x03,0xc1,0x00,0x0c,0x00,0x1c,0x20,0x0b,0xb8,0x99,0x00,0xf2,0x35,
+0x0e,0xae,0x2a,0xad,0xa2,0x0b,0x0a,0x04,0x0a,0x00,0x0d,0x9d,0x0b,0x19,0x00,0x0b,
+0x0a,0x2b,0x5a,0x31,0x0d,0xaa,0x37,0xba,0x72,0x0b,0x04,0x00,0xca,0x00,0x0b,0x0c,
+0x03,0x99,0x00,0x0e,0xb9,0x4c,0x29,0x07,0x17,0x00,0xa4,0x0a,0xa5,0x00,0x00,0x10,
+0x00,0x00,0xbb,0xbb,0xbb,0x8b,0x00,0x00,0x0b,0xb0,0x00,0x00,0xbc,0x00,0x00,0x1b,
+0xeb,0xbb,0xbb,0xbb,0x0e,0x00,0xf1,0x21,0xbe,0xbb,0xbb,0xcb,0xb0,0x00,0x00,0xa0,
+0xea,0xe0,0xcb,0xbe,0x1b,0x0b,0x0b,0x00,0x91,0xb0,0xb0,0xb6,0x6c,0x1e,0xae,0x0b,
+0x55,0xb1,0xb0,0xb0,0xc2,0x2a,0x1e,0xae,0x0c,0x66,0xc1,0x90,0x02,0x70,0x09,0x10,
+0x00,0xa2,0x00,0x91,0x00,0x56,0x00,0xbc,0x7f,0x00,0xf2,0x73,0xea,0xc0,0x0b,0x00,
+0x0a,0x0a,0x6a,0xea,0xa1,0xa0,0xb3,0x3c,0x33,0x1e,0xac,0x66,0x6a,0x94,0xa0,0xa7,
+0x77,0xaa,0x3a,0x0a,0x45,0x38,0x71,0xea,0xa0,0xb0,0x65,0x03,0x00,0x02,0x06,0x50,
+0x00,0x00,0x08,0xc3,0x00,0x07,0x98,0x88,0x8d,0x00,0x07,0x97,0x77,0x7d,0x00,0x06,
+0x98,0xa8,0x8a,0x00,0x69,0x99,0xea,0x99,0x91,0x01,0x77,0x77,0x76,0x00,0x04,0x71,
+0x11,0x1b,0x00,0x02,0x98,0xc9,0x87,0x00,0x04,0xb1,0x92,0x89,0x10,0x57,0x07,0xc1,
+0x02,0x90,0x1a,0xaa,0xbe,0xaa,0xa5,0x01,0x88,0x9d,0x88,0x70,0x02,0x91,0x2a,0x11,
+0xb0,0x02,0xc9,0xad,0x99,0xd0,0x02,0x80,0x1a,0x00,0xb0,0x01,0xc9,0xbc,0x99,0x80,
+0x00,0x67,0xa3,0x00,0x00,0x00,0x1e,0xe4,0x00,0x00,0x1b,0xa4,0x17,0xbb,0x08,0x01,
+0xf1,0x25,0x02,0x77,0xab,0x79,0x40,0x18,0x88,0xbc,0x8b,0xb5,0x03,0x77,0xab,0x7b,
+0x50,0x04,0x77,0x9b,0x77,0x60,0x18,0x88,0xab,0x88,0x85,0x01,0x66,0x66,0x66,0x20,
+0x01,0xb3,0x33,0x37,0x60,0x01,0xc7,0x77,0x7a,0x60,0x01,0xc8,0x88,0x8a,0x60,0x06,
+0xa8,0x88,0x8d,0x00,0x06,0xa7,0x8c,0x00,0xf0,0x15,0x88,0x8c,0x00,0x69,0x99,0x99,
+0x99,0x92,0x0b,0x47,0x85,0x55,0x40,0x0b,0x47,0x8a,0x66,0xa0,0x0b,0x8a,0x71,0xab,
+0x20,0x4d,0x9c,0xd2,0xcc,0x20,0x33,0x14,0x9a,0x22,0xb2,0x00,0x00,0x20,0x60,0x00,
+0xf1,0x13,0xa0,0x00,0x00,0x1b,0xbe,0xbb,0xbb,0xb6,0x00,0x2d,0x33,0x33,0x10,0x01,
+0xcb,0x66,0x69,0x60,0x1c,0x6d,0xaa,0xac,0x60,0x02,0x38,0x00,0x04,0x60,0x00,0x3d,
+0xaa,0xac,0x60,0x00,0x0a,0x00,0xf0,0x1d,0x38,0x00,0x9c,0x40,0x0a,0x05,0x56,0xca,
+0xe7,0xea,0xcc,0x73,0x0b,0x0b,0x7a,0x56,0xa8,0xe0,0xb1,0x65,0x65,0x1b,0x0c,0x9b,
+0x57,0x63,0xc1,0xb1,0x66,0x8a,0x8e,0x7a,0x99,0x8b,0x00,0xb1,0xc1,0xa2,0xc0,0x0b,
+0x84,0x02,0x77,0x0a,0x3a,0x02,0x02,0xe0,0x04,0x53,0x04,0xbb,0xce,0xbb,0xa0,0xef,
+0x04,0xf1,0x0d,0x39,0x00,0x00,0x1a,0xaa,0xef,0xba,0xa6,0x00,0x06,0xbc,0xb0,0x00,
+0x00,0x6a,0x29,0x4b,0x10,0x1b,0x80,0x29,0x03,0xc5,0x03,0x00,0x29,0x00,0x03,0x23,
+0x00,0x56,0x1b,0xbb,0xce,0xbb,0xb6,0x1c,0x05,0x80,0x07,0xbb,0xef,0xcb,0xb0,0x00,
+0x05,0xbb,0x2d,0x00,0x21,0x39,0x3b,0x2d,0x00,0x10,0xc6,0x2d,0x00,0x13,0x02,0x23,
+0x00,0xf7,0x0d,0x3a,0x00,0x00,0x1a,0xab,0xee,0xda,0xa6,0x00,0x09,0x69,0xb1,0x00,
+0x00,0x39,0x29,0x3a,0x00,0x03,0xc1,0x29,0x09,0x90,0x2d,0x8b,0xce,0xbb,0x99,0x62,
+0x05,0xf2,0x22,0x05,0x10,0x00,0x00,0x00,0x4f,0xaa,0xa4,0x00,0x06,0xca,0x02,0xd1,
+0x00,0x28,0x06,0xbd,0x20,0x00,0x00,0x5b,0x9b,0x93,0x00,0x68,0x50,0x61,0x26,0x91,
+0x07,0xaa,0xdb,0xaa,0x20,0x00,0x61,0x92,0x71,0x00,0x07,0x80,0x92,0x2b,0x00,0x06,
+0x05,0xb0,0x03,0x30,0x30,0x05,0x00,0x3f,0x05,0xf6,0x10,0x01,0xb1,0x7c,0xdc,0x40,
+0x39,0xe8,0x09,0x25,0x43,0x05,0xe1,0x87,0x04,0xb7,0x09,0xca,0x10,0x82,0x00,0x47,
+0xb3,0xbb,0xdb,0xb6,0x60,0xb0,0x00,0x82,0x00,0x00,0x05,0x00,0x02,0x32,0x00,0xf1,
+0x0f,0x0a,0x54,0x40,0x3a,0xe9,0x7c,0x25,0xc0,0x02,0xf2,0x65,0x9c,0x20,0x06,0xea,
+0x07,0xcb,0x30,0x0a,0xb7,0xc5,0x01,0x99,0x47,0xb0,0x7b,0xaa,0xc0,0x20,0xb0,0xda,
+0x05,0x65,0x7b,0xaa,0xd0,0x00,0xb0,0x73,0x95,0x05,0x02,0x69,0x00,0xf6,0x1b,0xc2,
+0x00,0x02,0xb2,0x1a,0x39,0x50,0x17,0xf7,0x99,0xc9,0x95,0x04,0xf6,0x79,0xd9,0x90,
+0x08,0xb6,0xa0,0xa0,0x91,0x28,0xb0,0xb9,0xd9,0xd1,0x21,0xb0,0x02,0xc9,0x00,0x00,
+0xb0,0x1b,0x29,0x60,0x00,0xb2,0xb3,0x00,0x86,0x36,0x00,0xf2,0x1e,0x07,0x26,0xaa,
+0xaf,0x60,0x4c,0xa0,0x02,0xb5,0x00,0x1a,0x67,0x97,0x69,0x90,0x0c,0xa7,0x77,0x52,
+0x80,0x2e,0x88,0x77,0x3b,0x50,0x99,0x29,0xc7,0x3b,0x80,0x37,0x23,0x4a,0x82,0x60,
+0x07,0x48,0xaa,0x88,0x82,0x07,0x31,0x11,0x11,0x10,0x7c,0x04,0xf2,0x1d,0x0b,0x98,
+0x9c,0xa2,0x1a,0x29,0x08,0x38,0x00,0x4d,0x7b,0x88,0x99,0x00,0x0d,0x69,0x09,0xaa,
+0x10,0x1f,0xab,0x96,0x8d,0x73,0x7c,0x29,0x32,0x2f,0x00,0x99,0x09,0x68,0x8c,0x00,
+0x09,0x2d,0x46,0xa9,0x06,0x09,0x10,0x09,0x17,0xa4,0x65,0x00,0xf3,0x77,0xa0,0x3c,
+0x3b,0x41,0x00,0xa0,0x5d,0x6c,0x71,0x3b,0xea,0x4d,0x6c,0x70,0x03,0xe1,0x78,0xc8,
+0x83,0x08,0xc9,0x99,0xd8,0xc0,0x28,0xa1,0x98,0xc7,0xd0,0x31,0xa2,0xd9,0xd9,0xd5,
+0x00,0xa0,0x91,0x00,0xa0,0x00,0xa0,0x91,0x07,0xb0,0x00,0xa0,0x9a,0xdd,0xa9,0x03,
+0xb3,0x69,0xcc,0x96,0x27,0xe6,0xa0,0x88,0x0a,0x04,0xf1,0x89,0xaa,0x98,0x08,0xb9,
+0x27,0x77,0x73,0x28,0xa1,0x88,0x88,0x88,0x31,0xa0,0x15,0x65,0x60,0x00,0xa0,0xa2,
+0x55,0x67,0x00,0xa2,0x34,0xb2,0x06,0x06,0x30,0x70,0x83,0x40,0x5c,0xb7,0x97,0xab,
+0xb1,0x09,0x41,0x94,0xa4,0x82,0x0d,0x98,0xbb,0xac,0x97,0x1d,0xb2,0x82,0xa2,0x90,
+0x78,0x37,0xe9,0xca,0xb5,0x46,0x32,0xd6,0x49,0x90,0x06,0x39,0x25,0x5f,0x15,0x06,
+0x76,0x07,0x63,0xb7,0xf2,0x00,0xa1,0x1a,0x00,0x00,0x01,0x30,0x1a,0x00,0x00,0x04,
+0x70,0x05,0x00,0x33,0x1e,0xbb,0xb0,0x0a,0x00,0x04,0x05,0x00,0x52,0x7c,0xda,0xbe,
+0xaa,0xa2,0xeb,0x00,0x40,0xbb,0xbb,0xbb,0xb2,0xcf,0x08,0x40,0x00,0x00,0x30,0x0b,
+0x63,0x01,0x01,0x05,0x00,0x54,0x0e,0xbb,0x80,0x00,0xb0,0x0f,0x00,0xf7,0x28,0x29,
+0xe9,0xae,0x99,0x96,0x01,0x11,0x11,0x11,0x11,0x7d,0xca,0x12,0x94,0x50,0x09,0x10,
+0x04,0xc7,0xa1,0x0c,0xba,0x88,0xc3,0x10,0x38,0x19,0x00,0xc6,0xa4,0xa7,0x67,0xba,
+0xd4,0x31,0x22,0xe1,0x00,0xa2,0xb1,0x01,0xa0,0x00,0x7d,0x10,0x0b,0x20,0x3a,0xbb,
+0x06,0x75,0x04,0x92,0x06,0xc4,0x04,0x09,0xf8,0x1c,0x7b,0x55,0x55,0x51,0x02,0xb4,
+0x44,0x44,0x41,0x0b,0x7b,0xac,0xab,0x60,0x00,0x92,0x0b,0x04,0x60,0x3a,0xeb,0xae,
+0xac,0xc8,0x00,0xb0,0x37,0x07,0x40,0x02,0xd8,0xbb,0x8c,0xa4,0x00,0x11,0x11,0x1c,
+0x10,0x00,0x00,0x05,0x99,0xa3,0x0a,0x22,0x00,0x0c,0x05,0x00,0xa0,0x10,0x0c,0x11,
+0x0c,0x08,0x90,0x0c,0xaa,0x4c,0xb7,0x0f,0x00,0x16,0x20,0x19,0x00,0xa3,0xa0,0x0c,
+0x38,0x5c,0x00,0xb0,0x0e,0x94,0x08,0xbb,0xdb,0x0a,0x10,0x60,0xac,0x09,0xf2,0x1d,
+0xe8,0x88,0x88,0x80,0x08,0x62,0x22,0x22,0x10,0x4b,0x58,0x88,0x88,0x00,0x17,0xaa,
+0xaa,0xa6,0x00,0x00,0x10,0x26,0x0a,0x00,0x01,0xc5,0xb1,0x0b,0x00,0x00,0x0e,0xb0,
+0x0b,0x00,0x01,0xb5,0x7a,0x0b,0x44,0x1c,0x30,0x05,0x04,0xc2,0x04,0x01,0x10,0x60,
+0x66,0x02,0xf0,0x29,0x60,0xb0,0xb0,0x40,0x11,0x00,0xb2,0xda,0xd0,0x19,0x67,0xe7,
+0xc0,0xb0,0x00,0x02,0xb0,0xb0,0xb0,0x00,0xa0,0xb0,0xb7,0xb0,0x02,0x90,0xb0,0xa0,
+0x00,0x0a,0x20,0xb0,0x00,0x46,0x09,0x00,0xab,0xaa,0xc2,0x08,0x60,0x03,0x70,0x00,
+0x00,0x24,0xbc,0xdb,0x80,0x42,0x00,0x03,0x70,0x00,0x2b,0x30,0x0f,0x00,0xf0,0x0b,
+0x09,0xbe,0xcb,0xb1,0x00,0x80,0x1b,0x01,0x00,0x05,0x70,0x83,0x0b,0x00,0x0c,0x04,
+0xd6,0x8c,0x90,0x24,0x03,0x63,0x10,0x80,0x09,0x40,0xd4,0x05,0xf1,0x29,0x3a,0xbb,
+0xeb,0xd5,0x53,0x0a,0x00,0xa0,0xa0,0x08,0x2a,0xaa,0xea,0x70,0x00,0x0b,0x67,0x06,
+0x70,0x04,0x7a,0x0c,0x3d,0x10,0x0b,0x2a,0x03,0xf6,0x00,0x48,0x74,0x8b,0x5a,0xa2,
+0x11,0x42,0x50,0x00,0x33,0x07,0x61,0x70,0xb0,0x54,0x00,0x40,0x82,0xb0,0xa0,0x27,
+0x00,0xbb,0xeb,0xb2,0x05,0x80,0x30,0x03,0xf4,0x08,0xea,0xaa,0xd2,0x00,0x90,0xb0,
+0x00,0x82,0x01,0xa0,0xea,0xaa,0xd2,0x09,0x40,0xb0,0x00,0x82,0x09,0x00,0xb0,0x0a,
+0xc1,0xb9,0x00,0xf2,0x1a,0x37,0x91,0x00,0x1a,0xaa,0xbc,0xa4,0x34,0x0a,0x44,0x58,
+0x10,0x19,0x3a,0x34,0x39,0x91,0x00,0x0a,0xa9,0x8a,0xb0,0x04,0x6a,0x80,0x8c,0x50,
+0x0a,0x48,0xa8,0x7e,0x14,0x1b,0x65,0x20,0x97,0x68,0x34,0x90,0x07,0x20,0x90,0x01,
+0x01,0x9a,0x0a,0xf3,0x04,0x04,0xb3,0xea,0xaa,0xc0,0x00,0x11,0xc5,0x55,0xc0,0x15,
+0x00,0xc3,0x33,0xb0,0x07,0x90,0xc9,0x99,0x38,0x08,0xf2,0x04,0x66,0xbd,0xac,0xd1,
+0x00,0xb5,0x49,0x26,0x91,0x07,0x45,0x49,0x26,0x91,0x0b,0x2c,0xcd,0xbc,0xd9,0x5a,
+0x05,0x01,0x23,0x08,0xf0,0x48,0x9a,0xba,0xca,0xa4,0x00,0x1a,0x21,0xc2,0x10,0x43,
+0x0a,0x79,0x77,0xd0,0x1a,0x4a,0x6a,0x88,0xd0,0x00,0x0b,0x63,0x00,0xa0,0x01,0x6b,
+0x38,0xd8,0x80,0x07,0x5b,0x45,0xb0,0x90,0x0b,0x57,0xb0,0xb0,0x94,0x25,0x90,0x27,
+0xb0,0x01,0x03,0x20,0x61,0x40,0x00,0x01,0x84,0xe8,0xe8,0x80,0x1a,0x4d,0x82,0xc2,
+0x20,0x02,0x47,0xb7,0xd7,0x50,0x00,0x85,0xb8,0xd8,0x60,0x06,0x74,0x95,0xc5,0x51,
+0x07,0x03,0x98,0x55,0x51,0x2a,0xaa,0xcd,0xaa,0xa7,0x00,0x00,0x46,0x5c,0x00,0x10,
+0x46,0x2a,0x02,0xf2,0x4e,0x02,0x40,0x00,0x06,0x98,0x9a,0xe9,0x92,0x00,0x0b,0x11,
+0x11,0x74,0x44,0x01,0x99,0xd9,0x40,0x08,0x25,0x99,0xd9,0x80,0x00,0x08,0x42,0xb1,
+0xb0,0x01,0x98,0x86,0xd6,0xc0,0x08,0x37,0x99,0xc9,0xb0,0x1c,0x02,0xa4,0x0a,0x50,
+0x03,0x18,0x10,0x00,0x61,0x03,0x72,0xc9,0xc8,0xb0,0x00,0x02,0xa9,0xd8,0x90,0x47,
+0x09,0x9a,0xd9,0x95,0x05,0x51,0x87,0x77,0x70,0x00,0x03,0xb7,0x77,0xc0,0x00,0xb3,
+0xb6,0x66,0xc0,0x06,0x53,0xb7,0x77,0xc0,0x1c,0x03,0x95,0x09,0x70,0x02,0x06,0x10,
+0x00,0x43,0xe1,0x00,0x10,0xa4,0x4f,0x09,0xf0,0x00,0xfa,0xdc,0xcd,0xc3,0x18,0xa0,
+0x93,0x66,0x40,0x09,0xea,0xdc,0xcd,0xc3,0x00,0x0a,0x00,0xf7,0x5a,0x2a,0xea,0xdc,
+0xcd,0xc6,0x01,0x41,0x21,0x30,0x60,0x0a,0x33,0x70,0xb0,0xa4,0x15,0x01,0x40,0x50,
+0x15,0x00,0xb0,0x01,0x94,0x30,0x64,0xb0,0x01,0x90,0x90,0x09,0xc6,0xab,0xda,0xa5,
+0x00,0xb0,0x14,0xe1,0x10,0x04,0xf0,0x06,0xe3,0x00,0x4b,0xc0,0x0b,0x38,0x00,0x60,
+0xb0,0x4a,0x0b,0x10,0x00,0xb1,0xd1,0x03,0xa0,0x00,0xb9,0x40,0x00,0x56,0x00,0x00,
+0x24,0x00,0x00,0x0a,0xaa,0xbe,0xaa,0xa6,0x04,0x00,0xa1,0x50,0x40,0x04,0xb6,0xda,
+0x57,0x70,0x00,0x22,0x67,0x34,0x00,0x07,0xa8,0xd8,0xe8,0xa0,0x03,0x03,0x47,0x21,
+0x32,0x2a,0xaa,0xbe,0xaa,0xa7,0x6e,0x05,0xf1,0x22,0x00,0x01,0x11,0x10,0x4a,0xea,
+0x89,0x88,0xc2,0x00,0xa0,0x89,0x88,0xc2,0x01,0xb1,0x83,0x11,0x92,0x2a,0xe9,0x8a,
+0x99,0xd2,0x00,0xa0,0x82,0x00,0x92,0x00,0xb3,0x5e,0xae,0xa1,0x3a,0xd8,0x0d,0x0b,
+0x00,0x22,0x00,0x68,0x0b,0x07,0x00,0x09,0x90,0x0a,0xa8,0xc2,0x00,0xf1,0x04,0x3b,
+0xc9,0xba,0xda,0xa9,0x00,0x0a,0x0a,0x0a,0x01,0x90,0x00,0xa0,0xb9,0xd9,0xa9,0x02,
+0xce,0x8a,0x0b,0x00,0xf0,0x0e,0x7a,0xea,0xa6,0x00,0x0a,0x01,0x1b,0x21,0x00,0x01,
+0xd8,0x89,0xea,0x97,0x03,0xe9,0x20,0x0a,0x00,0x00,0x10,0x06,0xaa,0xeb,0xaa,0x00,
+0x00,0x72,0x29,0xa5,0x07,0x90,0xbd,0xaa,0xa2,0x09,0x41,0x3a,0x11,0x10,0x06,0x7d,
+0x00,0x58,0x01,0xbb,0xce,0xbb,0x90,0x8c,0x00,0x03,0x70,0x0b,0xf0,0x05,0xb7,0x07,
+0xbb,0xbb,0xbb,0x80,0xa1,0x0b,0x00,0x0b,0x0a,0x98,0xe8,0x88,0xb0,0xa3,0x1c,0x11,
+0x1b,0x0b,0x8d,0x05,0x40,0xcb,0xbe,0xbb,0xbb,0x5b,0x0c,0xa0,0xb3,0x80,0x0b,0x00,
+0x0b,0x91,0x00,0xb0,0x9b,0x80,0x35,0x00,0x51,0xaa,0xaa,0xaa,0xaa,0x30,0x52,0x02,
+0xf0,0x0e,0xba,0xc9,0x90,0x0b,0x46,0x19,0x0a,0x65,0xb4,0xca,0xd9,0xa6,0x5b,0x47,
+0x3a,0x2a,0x65,0xb1,0x66,0x66,0x46,0x5e,0xaa,0xaa,0xaa,0xc5,0x00,0x00,0x00,0xfe,
+0x07,0xf0,0x41,0x01,0x35,0x30,0x04,0xaa,0xac,0x68,0x20,0x00,0x66,0x28,0x1c,0x00,
+0x1a,0xad,0xbd,0xcc,0xa6,0x00,0x2a,0x6a,0x96,0x00,0x1b,0xc5,0x58,0x49,0xd6,0x01,
+0xd6,0x8b,0x69,0x70,0x00,0xd8,0x9c,0x8a,0x70,0x00,0xb0,0x28,0x04,0x70,0x00,0xd9,
+0x99,0x9b,0x70,0x00,0x00,0x03,0x01,0x00,0x07,0x9a,0xb5,0x7b,0x10,0x06,0x49,0x30,
+0xb3,0x93,0x00,0xcc,0x88,0xae,0x50,0x1b,0x71,0x22,0x22,0xc7,0x13,0xaa,0x99,0x9e,
+0x02,0x00,0xa1,0x03,0x04,0xe2,0x6b,0x88,0xaa,0x00,0x00,0x0b,0x10,0x92,0x00,0x1a,
+0xac,0xba,0xea,0xa6,0xe1,0x01,0xf1,0x14,0x76,0x00,0xb1,0x00,0x09,0x9a,0xe9,0x99,
+0x60,0x05,0x8b,0xb8,0x88,0x10,0x59,0x9e,0xa9,0x99,0x90,0x00,0xab,0x88,0x88,0x10,
+0x09,0xc9,0x77,0x7c,0x20,0x95,0x87,0x44,0x4b,0x20,0x00,0x05,0x00,0x30,0x8a,0x99,
+0x9d,0xd3,0x07,0xf0,0x21,0x41,0x00,0x3b,0xca,0x78,0xd9,0x82,0x05,0x60,0xa5,0xa5,
+0x64,0x09,0x30,0x2d,0x2b,0x00,0x0d,0x96,0xbd,0x9e,0x92,0x4f,0x0b,0x7d,0x9d,0x90,
+0x5b,0x0a,0x29,0x0b,0x00,0x0a,0x5a,0x2c,0x8d,0x80,0x0a,0x43,0x2c,0x8d,0x84,0x00,
+0x00,0x29,0x11,0x11,0x03,0x1e,0x01,0x06,0xa2,0x04,0x02,0x86,0x07,0xf0,0x09,0x10,
+0x29,0x02,0x00,0x00,0xc1,0x29,0x0a,0x40,0x06,0x80,0x29,0x01,0xc0,0x2b,0x00,0x29,
+0x00,0x84,0x00,0x09,0xc7,0x00,0x00,0xf3,0x82,0x26,0x97,0x00,0xb0,0x00,0x12,0xa0,
+0x33,0xb3,0x30,0x7b,0xea,0x83,0xb0,0xb0,0x05,0xd0,0xa0,0xb0,0x92,0x0a,0xd8,0x60,
+0xb0,0x40,0x38,0xa6,0x00,0xb4,0x80,0x92,0xa0,0x00,0x3b,0x10,0x00,0xa0,0x06,0xb2,
+0x00,0x00,0xa4,0xb6,0x00,0x00,0x00,0x15,0x05,0x00,0x00,0x2a,0xd4,0x0b,0x33,0x30,
+0x00,0xa0,0x59,0xd7,0xd1,0x4b,0xeb,0xb0,0xa1,0x70,0x02,0xe0,0x35,0xa3,0x40,0x08,
+0xca,0x36,0xa2,0xa0,0x19,0xa3,0x82,0xa0,0xb0,0x71,0xa0,0xb0,0xa0,0x92,0x00,0xa0,
+0x10,0xa0,0x00,0x00,0xa0,0x07,0xc0,0x00,0x00,0x24,0x00,0x70,0x00,0x2a,0xd3,0x09,
+0xd9,0x80,0x00,0xb0,0xb8,0x08,0x60,0x4a,0xe9,0x05,0xd8,0x00,0x06,0xe2,0x9a,0x76,
+0x00,0x09,0xd8,0x12,0xda,0xb5,0x28,0xb3,0x7a,0x20,0xc0,0x71,0xb0,0x31,0xbb,0x50,
+0x00,0xb0,0x04,0xb5,0x00,0x00,0xb2,0xb8,0x10,0x00,0x01,0x00,0x00,0x09,0x00,0xf0,
+0x0f,0x2c,0x00,0x00,0xea,0xaa,0xaa,0xab,0xab,0x04,0x50,0x63,0x1a,0x7a,0x80,0x00,
+0x6a,0x23,0xba,0xaa,0xaa,0x70,0x00,0x00,0xc0,0x00,0x00,0x00,0x0c,0x00,0x00,0x09,
+0x00,0xf2,0x55,0x0a,0xaa,0xae,0xaa,0xa7,0x00,0x00,0x01,0x00,0x00,0x01,0x11,0x4a,
+0x11,0x10,0x0e,0x89,0x98,0x98,0xb6,0x09,0x1b,0x20,0xa6,0x44,0x05,0xa2,0x14,0x36,
+0x90,0x00,0x00,0x47,0x47,0x00,0x2a,0xaa,0xef,0xba,0xa6,0x00,0x01,0xc5,0x80,0x00,
+0x00,0x4c,0x20,0x88,0x20,0x0b,0x81,0x00,0x04,0xb7,0x02,0x80,0x90,0xe0,0x73,0x4a,
+0xca,0xa5,0xe5,0xa3,0x03,0x04,0x45,0x55,0x51,0x09,0x29,0xaa,0xca,0xa5,0x09,0x45,
+0x01,0xd0,0x00,0x09,0x62,0xcd,0xad,0xc5,0x05,0xa6,0x98,0x09,0x45,0x5c,0x84,0x98,
+0x09,0x45,0x00,0x00,0x97,0x08,0xa3,0x90,0x00,0xf1,0x22,0x40,0x02,0x30,0x00,0x06,
+0xc9,0x79,0xb9,0x94,0x2a,0x38,0x4a,0x0c,0x10,0x07,0x9a,0xaa,0x9b,0x60,0x00,0x11,
+0xa3,0x12,0xa0,0x06,0x97,0xc8,0x77,0x40,0x09,0xba,0xda,0xaa,0x90,0x00,0x0a,0xd1,
+0x00,0xc0,0x01,0xa4,0xa1,0x12,0xb0,0x1b,0x30,0xa1,0x58,0x20,0x36,0x00,0xf1,0x3c,
+0x01,0x50,0x01,0x40,0x00,0x08,0xca,0x98,0xca,0xa3,0x49,0x38,0x19,0x1b,0x00,0x00,
+0x02,0xba,0x01,0x00,0x00,0x5b,0x32,0xb7,0x10,0x3c,0x79,0x99,0x96,0xc5,0x00,0x89,
+0x99,0x98,0x00,0x00,0xb0,0x00,0x0b,0x00,0x00,0xb1,0x11,0x1b,0x00,0x00,0xc9,0x99,
+0x9c,0x00,0x02,0x10,0x03,0x00,0x00,0x0d,0xa9,0x7e,0xa9,0x91,0x84,0x91,0x93,0x47,
+0x00,0x06,0xa7,0x77,0x7c,0x20,0x06,0x96,0x66,0x6c,0x20,0x0a,0x00,0xf2,0x04,0x03,
+0x8c,0x77,0xc8,0x10,0x69,0xad,0x99,0xe9,0x92,0x01,0xb2,0x00,0xb0,0x00,0x3c,0x40,
+0x00,0xb0,0x9f,0x00,0xf0,0x0c,0x02,0x10,0x01,0x20,0x00,0x0a,0xa8,0x79,0xc8,0x83,
+0x48,0x28,0x39,0x0a,0x00,0x0a,0x88,0xaa,0x88,0xa1,0x0b,0x79,0x99,0x98,0x91,0x00,
+0xc0,0x5f,0x00,0x80,0xc8,0x88,0x88,0x00,0x00,0xd9,0x99,0x99,0x30,0x00,0xf1,0x2a,
+0x04,0x60,0x00,0xd9,0x99,0x9b,0x60,0x02,0x10,0x03,0x10,0x00,0x0b,0xb9,0x8e,0xa9,
+0x93,0x66,0xa1,0x93,0x57,0x00,0x59,0xb9,0x96,0xac,0xa0,0x15,0xb5,0x39,0x10,0xb0,
+0x38,0xb4,0xa9,0x10,0xb0,0x3a,0xc8,0xa9,0x14,0xb0,0x17,0xc7,0x59,0x13,0x21,0x59,
+0xd9,0x9a,0x10,0x37,0x00,0x90,0x05,0xba,0xc2,0x69,0x00,0xf2,0x1d,0x13,0xa4,0x46,
+0xc7,0x62,0x08,0xb9,0x38,0xd9,0x81,0x06,0xc4,0x34,0xb4,0x42,0x3b,0xe8,0x45,0x55,
+0x53,0x06,0xf3,0x3b,0x99,0xd0,0x0a,0xba,0x4b,0x77,0xd0,0x47,0xa0,0x3b,0x88,0xd0,
+0x10,0xa0,0x36,0x00,0xb0,0x00,0xa0,0x36,0x07,0x9c,0x00,0xf2,0x7d,0x06,0x88,0xac,
+0x88,0x81,0x00,0x55,0x7b,0x55,0x30,0x00,0x44,0x6a,0x44,0x20,0x19,0x9a,0xe9,0x99,
+0x96,0x00,0x9c,0xa9,0x83,0x00,0x03,0x8c,0xb7,0x8d,0x80,0x04,0x56,0x2b,0x12,0x42,
+0x01,0xb3,0x0b,0x1a,0x70,0x0a,0x24,0xa8,0x00,0x74,0x03,0x33,0x3c,0x33,0x32,0x04,
+0x44,0x4d,0x44,0x42,0x1c,0xaa,0xcc,0xaa,0xaa,0x19,0x07,0x71,0x64,0x0b,0x00,0xa9,
+0xda,0x36,0x00,0x03,0x9d,0x87,0x8b,0xb0,0x04,0x56,0x2b,0x13,0x34,0x01,0xa5,0x0b,
+0x08,0x80,0x09,0x32,0xaa,0x00,0x46,0x00,0x40,0x00,0x00,0x00,0x03,0x70,0xac,0xeb,
 0xe1,0x09,0x26,0xa0,0xa0,0x91,0x5b,0xa0,0xa0,0xa0,0x91,0x37,0x62,0xa0,0xa0,0xa1,
 0x1a,0x29,0xab,0xea,0xe1,0x48,0x56,0xa0,0xa0,0x91,0x35,0x78,0xa0,0xa0,0x91,0x73,
-0x96,0xab,0xeb,0xe1,0x60,0x20,0xa0,0x00,0x91,0xb1,0x18,0xf3,0x1b,0x07,0x61,0x10,
-0x08,0x25,0x2d,0x8a,0xb0,0x3b,0x86,0xb9,0x5a,0x10,0x38,0xc2,0x00,0xe8,0x00,0x0b,
-0x49,0x5b,0x48,0xa1,0x59,0x69,0x51,0xa3,0x33,0x25,0x68,0x00,0x07,0x00,0x64,0x98,
-0x2a,0x92,0x00,0x51,0x40,0x00,0x29,0x48,0x03,0x10,0x50,0x69,0x00,0xf3,0x1e,0x90,
-0x9d,0xaa,0xe0,0x09,0x29,0x0b,0x17,0x80,0x4b,0x93,0x04,0xbd,0x00,0x59,0x91,0x06,
-0xea,0x00,0x1b,0x3b,0x95,0x43,0x83,0x35,0x47,0x5a,0xdb,0xa0,0x36,0x99,0x00,0x92,
-0x00,0x63,0xa9,0x00,0x92,0x00,0x91,0x71,0x9a,0xdb,0xa5,0x00,0x8e,0x1e,0x30,0x20,
-0x00,0x01,0xdc,0x23,0xf2,0x19,0x08,0x26,0xac,0xea,0xa3,0x3b,0x94,0x09,0x36,0x30,
-0x48,0xa1,0x6c,0x68,0xd0,0x0a,0x1a,0x77,0x54,0x73,0x6c,0x9c,0x0b,0x0a,0x00,0x13,
-0x45,0x0b,0x0a,0x00,0x55,0x88,0x47,0x0a,0x16,0x71,0x64,0xb0,0x0c,0xb4,0xfb,0x06,
-0x11,0x10,0xd7,0x00,0xf2,0x1c,0xb2,0x0a,0x31,0x09,0x36,0xb4,0x5a,0xa0,0x5c,0xa1,
-0xb0,0x5b,0x50,0x27,0x62,0xb7,0xce,0xa4,0x1b,0x69,0xb0,0x9f,0x20,0x47,0x35,0xb3,
-0x8b,0xa0,0x06,0x78,0xb9,0x0a,0x31,0x35,0x88,0xb0,0x07,0x00,0x61,0x60,0xba,0xaa,
-0xa5,0x03,0x02,0xf6,0x1e,0x70,0x99,0xda,0x94,0x08,0x37,0x00,0x92,0x00,0x5c,0xc1,
-0x59,0x99,0x90,0x26,0x92,0x89,0x99,0x93,0x1c,0x38,0xa0,0x00,0x45,0x47,0x46,0x18,
-0x1a,0x00,0x16,0x78,0x0b,0x0a,0x00,0x45,0x89,0x2b,0x0a,0x08,0x61,0x52,0xc2,0x09,
-0xa6,0x00,0x69,0x2e,0xf0,0x07,0x8d,0x86,0xda,0xd3,0x0d,0x78,0xa0,0xa2,0xb0,0x0d,
-0x79,0x90,0x3e,0x30,0x0c,0x8c,0x86,0xa5,0xb5,0x00,0x16,0x72,0x1c,0x39,0xf2,0x03,
-0xd7,0x18,0x10,0x08,0xcc,0x8b,0x88,0xa1,0x00,0x74,0x0b,0x2a,0x40,0x08,0x22,0x99,
-0x00,0x71,0x54,0x1a,0xf0,0x1c,0x90,0x49,0x99,0xb0,0x09,0x28,0x16,0x66,0xb0,0x5c,
-0xa3,0x02,0x22,0xa0,0x25,0x84,0x9a,0xcb,0xb4,0x1c,0x5b,0x53,0x82,0x62,0x47,0x58,
-0x1a,0x8a,0x70,0x25,0x78,0x07,0xdb,0x30,0x54,0x98,0xb5,0x83,0xa4,0x60,0x40,0x05,
-0xc0,0x04,0x01,0x00,0xa4,0x31,0xf1,0x1c,0x35,0xd4,0x40,0x09,0x26,0xa4,0x44,0xc0,
-0x5c,0xb1,0xa8,0x88,0xd0,0x27,0x72,0xa6,0x66,0xd0,0x2c,0x78,0x23,0xc3,0x60,0x36,
-0x46,0x9d,0xba,0xa0,0x27,0x86,0x38,0xbb,0x20,0x54,0x87,0xb1,0xb2,0xc2,0x60,0x32,
-0x18,0xb0,0x22,0x01,0x01,0xf2,0x1e,0x03,0x80,0x00,0xa1,0x00,0x09,0x24,0xc8,0x88,
-0xd0,0x4b,0xa2,0xb6,0x66,0xc0,0x28,0x82,0xa2,0x22,0x20,0x2c,0x78,0xea,0xcc,0xa5,
-0x36,0x46,0xe4,0x77,0x35,0x38,0x96,0xdb,0xcc,0xb5,0x65,0x7b,0xa4,0x77,0x35,0x50,
-0x35,0x64,0x22,0x73,0x67,0x08,0xf0,0x0b,0x9a,0xb8,0xd8,0xc1,0x08,0x8a,0xb9,0xc8,
-0xb1,0x09,0x99,0xbc,0x99,0x93,0x00,0x34,0x97,0x44,0x10,0x00,0xb5,0x55,0x5a,0x40,
-0x00,0xc7,0x3d,0x12,0x30,0xc6,0x66,0x6a,0x05,0x00,0x70,0x6b,0x40,0x18,0xd8,0x88,
-0x8c,0xa5,0x2d,0x00,0xf0,0x1a,0xc2,0x09,0x79,0x96,0xd6,0xc2,0x02,0x33,0x87,0x33,
-0x60,0x01,0x99,0xcb,0xac,0x70,0x18,0x88,0xbc,0xbb,0x85,0x02,0x7c,0xfb,0x88,0x60,
-0x29,0x6b,0x55,0x55,0xb0,0x00,0x1a,0x33,0x33,0xb0,0x00,0x1d,0x88,0x88,0xb0,0xbc,
-0x20,0xd0,0x60,0x01,0x77,0xc7,0x9c,0x20,0x0a,0xaa,0xda,0xfb,0xa5,0x00,0x01,0xe4,
-0x06,0x70,0x6e,0xd9,0x99,0x50,0x2c,0x7a,0x20,0x79,0x00,0x00,0xbc,0x1d,0x02,0x9d,
-0x0a,0x26,0x4a,0xa6,0x05,0x0c,0x50,0x70,0x03,0xaa,0xea,0xad,0x31,0x37,0xf0,0x04,
-0xb4,0x00,0x2a,0xaa,0xee,0xaa,0xa6,0x00,0x5c,0xd6,0x55,0x20,0x2c,0x9b,0x33,0x37,
-0x60,0x00,0x1d,0xe9,0x1c,0xf0,0x0f,0x19,0x00,0x05,0x60,0x00,0x1d,0xaa,0xab,0x60,
-0x19,0x9d,0x0b,0x57,0x50,0x00,0x0a,0x0b,0x50,0x00,0x28,0xbd,0x0b,0x43,0x94,0x13,
-0x9f,0x9c,0xff,0x70,0x00,0xc8,0x1d,0x93,0x00,0xd7,0x77,0x7d,0x00,0x00,0xe8,0x88,
-0x8e,0x24,0x04,0x37,0xb0,0x03,0xab,0x79,0x0a,0xf1,0x1e,0x03,0x94,0x05,0x60,0x40,
-0x1c,0x58,0xa5,0xb8,0x40,0x16,0x43,0x65,0x60,0x07,0x0b,0x99,0x92,0xca,0xb6,0x0b,
-0x22,0xb2,0x30,0x00,0x0c,0x55,0xb5,0x87,0xa1,0x0d,0x99,0xb5,0xa2,0x01,0x0a,0x00,
-0xb5,0x60,0x0a,0x0a,0x1a,0x82,0xba,0xb5,0x0e,0x22,0x20,0x07,0x50,0xcc,0x1e,0x5f,
-0xbc,0x19,0x00,0x00,0x0c,0x08,0x00,0x03,0x00,0xf6,0x35,0x30,0x50,0x00,0x00,0x7d,
-0x17,0x10,0x0c,0xa0,0x0b,0x50,0xe9,0x99,0x9a,0xa0,0x0c,0x8f,0x16,0xf0,0x0a,0xea,
-0xba,0xaa,0x90,0x0c,0x04,0xa0,0x2b,0x10,0xc0,0x07,0xba,0x10,0x1d,0x6a,0x25,0xd8,
-0x23,0x95,0x10,0x00,0x56,0x00,0x03,0x20,0xde,0x0e,0xf0,0x00,0xba,0xa1,0x00,0x00,
-0xa3,0x03,0xa0,0x00,0x1c,0xea,0xae,0xba,0x80,0x14,0xa0,0x8a,0x07,0x01,0x05,0x00,
-0x10,0xeb,0x34,0x18,0x00,0x03,0x2f,0x00,0xa4,0x04,0x10,0x1a,0x87,0x07,0xf1,0x21,
-0xb4,0x7a,0xbd,0xaa,0xeb,0xa2,0x00,0x13,0x00,0x63,0x90,0x0b,0xaa,0xaa,0xea,0xa1,
-0x19,0x77,0x85,0xa1,0x60,0x19,0xb9,0xb5,0x88,0x60,0x29,0x91,0x19,0x5d,0x00,0x37,
-0xb8,0xa4,0x6a,0x00,0x83,0x98,0x99,0xab,0x05,0x80,0x00,0x19,0x04,0xc3,0x00,0x42,
-0x50,0x33,0x50,0x6b,0xbb,0xb3,0x4b,0x12,0x14,0x02,0x10,0x77,0x0f,0x00,0xb2,0xd0,
-0xbb,0xbe,0xb6,0x4c,0xb0,0x00,0x0a,0x00,0x21,0xb0,0xdf,0x1e,0x05,0x05,0x00,0xf3,
-0x16,0x04,0xbb,0x00,0x03,0x31,0x35,0x40,0x00,0x0b,0x27,0xa5,0x19,0xa4,0x94,0x59,
-0xca,0x90,0x00,0x07,0x62,0x84,0x10,0x00,0x2f,0x1a,0xa7,0xa9,0xe5,0xac,0x0a,0xa7,
-0x90,0xb0,0x0a,0x07,0xb9,0x50,0x05,0x00,0x50,0x3a,0xdc,0xc0,0xb0,0x0a,0x97,0x3c,
-0x02,0x89,0x0c,0xf0,0x1a,0xaa,0xda,0xaa,0x70,0x01,0x22,0xa4,0x22,0x00,0x04,0x77,
+0x96,0xab,0xeb,0xe1,0x60,0x20,0xa0,0x00,0x91,0x95,0x01,0xf2,0x1d,0xa0,0x07,0x61,
+0x10,0x08,0x25,0x2d,0x8a,0xb0,0x3b,0x86,0xb9,0x5a,0x10,0x38,0xc2,0x00,0xe8,0x00,
+0x0b,0x49,0x5b,0x48,0xa1,0x59,0x69,0x51,0xa3,0x33,0x25,0x68,0x00,0x07,0x00,0x64,
+0x98,0x2a,0x92,0x00,0x51,0x40,0x00,0x29,0x80,0x5f,0x01,0x10,0x50,0x69,0x00,0xf2,
+0x1d,0x90,0x9d,0xaa,0xe0,0x09,0x29,0x0b,0x17,0x80,0x4b,0x93,0x04,0xbd,0x00,0x59,
+0x91,0x06,0xea,0x00,0x1b,0x3b,0x95,0x43,0x83,0x35,0x47,0x5a,0xdb,0xa0,0x36,0x99,
+0x00,0x92,0x00,0x63,0xa9,0x00,0x92,0x00,0x91,0x71,0x9a,0xdb,0xa5,0x37,0x00,0xf4,
+0x24,0x20,0x00,0x20,0x00,0x01,0xa0,0x00,0xb0,0x00,0x08,0x26,0xac,0xea,0xa3,0x3b,
+0x94,0x09,0x36,0x30,0x48,0xa1,0x6c,0x68,0xd0,0x0a,0x1a,0x77,0x54,0x73,0x6c,0x9c,
+0x0b,0x0a,0x00,0x13,0x45,0x0b,0x0a,0x00,0x55,0x88,0x47,0x0a,0x16,0x71,0x64,0xb0,
+0x0c,0xb4,0x00,0x01,0xfc,0x02,0xf2,0x1e,0x03,0x70,0xb2,0x0a,0x31,0x09,0x36,0xb4,
+0x5a,0xa0,0x5c,0xa1,0xb0,0x5b,0x50,0x27,0x62,0xb7,0xce,0xa4,0x1b,0x69,0xb0,0x9f,
+0x20,0x47,0x35,0xb3,0x8b,0xa0,0x06,0x78,0xb9,0x0a,0x31,0x35,0x88,0xb0,0x07,0x00,
+0x61,0x60,0xba,0xaa,0xa5,0x03,0x02,0xf5,0x1e,0x70,0x99,0xda,0x94,0x08,0x37,0x00,
+0x92,0x00,0x5c,0xc1,0x59,0x99,0x90,0x26,0x92,0x89,0x99,0x93,0x1c,0x38,0xa0,0x00,
+0x45,0x47,0x46,0x18,0x1a,0x00,0x16,0x78,0x0b,0x0a,0x00,0x45,0x89,0x2b,0x0a,0x08,
+0x61,0x52,0xc2,0x09,0xa6,0x00,0x01,0x00,0xf0,0x20,0x0d,0x8d,0x86,0xda,0xd3,0x0d,
+0x78,0xa0,0xa2,0xb0,0x0d,0x79,0x90,0x3e,0x30,0x0c,0x8c,0x86,0xa5,0xb5,0x00,0x16,
+0x72,0x70,0x00,0x00,0x8b,0xd7,0x18,0x10,0x08,0xcc,0x8b,0x88,0xa1,0x00,0x74,0x0b,
+0x2a,0x40,0x08,0x22,0x99,0x00,0x71,0x00,0x30,0x69,0x00,0xf0,0x1c,0x90,0x49,0x99,
+0xb0,0x09,0x28,0x16,0x66,0xb0,0x5c,0xa3,0x02,0x22,0xa0,0x25,0x84,0x9a,0xcb,0xb4,
+0x1c,0x5b,0x53,0x82,0x62,0x47,0x58,0x1a,0x8a,0x70,0x25,0x78,0x07,0xdb,0x30,0x54,
+0x98,0xb5,0x83,0xa4,0x60,0x40,0x05,0xc0,0x04,0x01,0xf1,0x20,0x40,0x00,0x03,0x80,
+0x35,0xd4,0x40,0x09,0x26,0xa4,0x44,0xc0,0x5c,0xb1,0xa8,0x88,0xd0,0x27,0x72,0xa6,
+0x66,0xd0,0x2c,0x78,0x23,0xc3,0x60,0x36,0x46,0x9d,0xba,0xa0,0x27,0x86,0x38,0xbb,
+0x20,0x54,0x87,0xb1,0xb2,0xc2,0x60,0x32,0x18,0xb0,0x22,0x01,0x01,0xf1,0x1e,0x03,
+0x80,0x00,0xa1,0x00,0x09,0x24,0xc8,0x88,0xd0,0x4b,0xa2,0xb6,0x66,0xc0,0x28,0x82,
+0xa2,0x22,0x20,0x2c,0x78,0xea,0xcc,0xa5,0x36,0x46,0xe4,0x77,0x35,0x38,0x96,0xdb,
+0xcc,0xb5,0x65,0x7b,0xa4,0x77,0x35,0x50,0x35,0x64,0x22,0x73,0xc8,0x00,0xf0,0x13,
+0x09,0x9a,0xb8,0xd8,0xc1,0x08,0x8a,0xb9,0xc8,0xb1,0x09,0x99,0xbc,0x99,0x93,0x00,
+0x34,0x97,0x44,0x10,0x00,0xb5,0x55,0x5a,0x40,0x00,0xc7,0x77,0x7b,0x40,0x00,0xc6,
+0x66,0x6a,0x05,0x00,0x70,0x6b,0x40,0x18,0xd8,0x88,0x8c,0xa5,0x2d,0x00,0xf0,0x36,
+0xc2,0x09,0x79,0x96,0xd6,0xc2,0x02,0x33,0x87,0x33,0x60,0x01,0x99,0xcb,0xac,0x70,
+0x18,0x88,0xbc,0xbb,0x85,0x02,0x7c,0xfb,0x88,0x60,0x29,0x6b,0x55,0x55,0xb0,0x00,
+0x1a,0x33,0x33,0xb0,0x00,0x1d,0x88,0x88,0xb0,0x00,0x00,0xa1,0x00,0x60,0x01,0x77,
+0xc7,0x9c,0x20,0x0a,0xaa,0xda,0xfb,0xa5,0x00,0x01,0xa8,0x00,0x00,0x00,0x6e,0xd9,
+0x99,0x50,0x2c,0x7a,0x20,0x79,0x00,0x50,0xaa,0xae,0x00,0x00,0x00,0x66,0x03,0x25,
+0x00,0x4a,0x58,0x01,0xf3,0x3e,0xb0,0x00,0x70,0x03,0xaa,0xea,0xad,0x40,0x00,0x00,
+0xb0,0xb4,0x00,0x2a,0xaa,0xee,0xaa,0xa6,0x00,0x5c,0xd6,0x55,0x20,0x2c,0x9b,0x33,
+0x37,0x60,0x00,0x1d,0x99,0x9b,0x60,0x00,0x19,0x00,0x05,0x60,0x00,0x1d,0xaa,0xab,
+0x60,0x19,0x9d,0x0b,0x57,0x50,0x00,0x0a,0x0b,0x50,0x00,0x28,0xbd,0x0b,0x43,0x94,
+0x13,0x9f,0x9c,0xff,0x70,0x00,0xc1,0x11,0x1c,0x00,0x00,0xd7,0x77,0x7d,0x00,0x00,
+0xe8,0x88,0x8e,0x24,0x04,0x46,0xb0,0x03,0xab,0x00,0x01,0x00,0xff,0x2e,0x03,0x94,
+0x05,0x60,0x40,0x1c,0x58,0xa5,0xb8,0x40,0x16,0x43,0x65,0x60,0x07,0x0b,0x99,0x92,
+0xca,0xb6,0x0b,0x22,0xb2,0x30,0x00,0x0c,0x55,0xb5,0x87,0xa1,0x0d,0x99,0xb5,0xa2,
+0x01,0x0a,0x00,0xb5,0x60,0x0a,0x0a,0x1a,0x82,0xba,0xb5,0x00,0x01,0x20,0x00,0x00,
+0x07,0x50,0x00,0x1e,0xbb,0xbb,0xbc,0x19,0x00,0x00,0x0c,0x08,0x00,0x04,0xf0,0x21,
+0x0b,0x00,0x02,0x50,0x00,0x00,0xaa,0xae,0xaa,0x70,0x0c,0x00,0x00,0x1a,0x00,0xe9,
+0x99,0x9a,0xa0,0x0c,0x00,0x00,0x0a,0x00,0xea,0xba,0xaa,0x90,0x0c,0x04,0xa0,0x2b,
+0x10,0xc0,0x07,0xba,0x10,0x1d,0x6a,0x25,0xd8,0x23,0x95,0x10,0x00,0x56,0x00,0x03,
+0xff,0x00,0xf0,0x02,0x1e,0xba,0xa1,0x00,0x00,0xa3,0x03,0xa0,0x00,0x1c,0xea,0xae,
+0xba,0x80,0x14,0xa0,0x0b,0xfc,0x03,0x00,0x05,0x00,0xb0,0xeb,0xbb,0xbb,0xb0,0x00,
+0xa0,0x00,0x00,0x05,0x00,0xb0,0x4d,0x00,0xf0,0x2e,0xaa,0xaa,0xaa,0xb4,0x7a,0xbd,
+0xaa,0xeb,0xa2,0x00,0x13,0x00,0x63,0x90,0x0b,0xaa,0xaa,0xea,0xa1,0x19,0x77,0x85,
+0xa1,0x60,0x19,0xb9,0xb5,0x88,0x60,0x29,0x91,0x19,0x5d,0x00,0x37,0xb8,0xa4,0x6a,
+0x00,0x83,0x98,0x99,0xab,0x05,0x80,0x00,0x19,0x04,0xc3,0x00,0x42,0x00,0x00,0x00,
+0x04,0xb0,0x6b,0xbb,0xb3,0x4b,0x12,0x14,0x02,0x10,0x77,0x0f,0x00,0xa0,0xd0,0xbb,
+0xbe,0xb6,0x4c,0xb0,0x00,0x0a,0x00,0x21,0x05,0x00,0x17,0x00,0x05,0x00,0xf3,0x16,
+0x04,0xbb,0x00,0x03,0x31,0x35,0x40,0x00,0x0b,0x27,0xa5,0x19,0xa4,0x94,0x59,0xca,
+0x90,0x00,0x07,0x62,0x84,0x10,0x00,0x2f,0x1a,0xa7,0xa9,0xe5,0xac,0x0a,0xa7,0x90,
+0xb0,0x0a,0x07,0xb9,0x50,0x05,0x00,0x82,0x3a,0xdc,0xc0,0xb0,0x0a,0x00,0x00,0x0a,
+0xde,0x03,0xf1,0x1b,0x1a,0xaa,0xda,0xaa,0x70,0x01,0x22,0xa4,0x22,0x00,0x04,0x77,
 0xc8,0x77,0x20,0x5a,0xaa,0xda,0xaa,0xa0,0x00,0x2b,0x4a,0x02,0x50,0x29,0xe3,0x06,
 0x8a,0x10,0x53,0x92,0x01,0xb5,0x00,0x00,0xca,0xb5,0x09,0xb2,0x00,0x62,0x9b,0x03,
-0x00,0x65,0x0f,0xf1,0x05,0x25,0x55,0xb9,0x55,0x50,0x24,0x44,0x44,0x44,0x40,0x00,
-0xd9,0x99,0x9c,0x00,0x49,0xd7,0x77,0x7d,0x91,0x0a,0x00,0xf2,0x32,0x00,0x2a,0x59,
+0xf1,0x08,0x20,0x00,0x00,0x25,0x55,0xb9,0x55,0x50,0x24,0x44,0x44,0x44,0x40,0x00,
+0xd9,0x99,0x9c,0x00,0x49,0xd7,0x77,0x7d,0x91,0x0a,0x00,0xf1,0x32,0x00,0x2a,0x59,
 0x24,0x60,0x39,0xc7,0x01,0xc8,0x00,0x21,0x5a,0x99,0x3a,0x71,0x00,0x45,0x10,0x00,
 0x41,0x05,0x28,0x00,0xb0,0x00,0x03,0x59,0xaa,0xea,0xa5,0x03,0xa8,0x00,0xb0,0x00,
 0x27,0x38,0x8a,0xda,0xa3,0x00,0x15,0x44,0x00,0x00,0x29,0x9b,0xee,0x99,0xa6,0x03,
-0x8a,0x04,0x79,0x70,0x17,0x67,0x45,0x6b,0x40,0x00,0x79,0x51,0x00,0x66,0xf6,0x3d,
-0xf0,0x20,0x9d,0x83,0x72,0xa0,0x2b,0x8d,0x86,0x72,0xa0,0x05,0x7d,0x74,0x72,0xa0,
-0x09,0x0a,0x28,0x20,0xb0,0x05,0x09,0x78,0x0a,0xa0,0x19,0x9a,0xee,0xa9,0xb5,0x04,
-0x8b,0x22,0x89,0x70,0x16,0x59,0x56,0x4a,0x40,0x00,0x57,0x30,0x00,0x54,0x01,0x10,
-0x04,0xd3,0x04,0xf2,0x1c,0x5c,0x77,0x73,0x4a,0xb7,0xc6,0x55,0x51,0x00,0x57,0xd6,
-0x55,0xd0,0x01,0xc5,0x98,0x77,0xd0,0x0b,0xe6,0x7a,0x97,0xa0,0x65,0xa9,0x1d,0xa9,
-0x80,0x00,0xa3,0xbb,0x29,0x60,0x00,0xa0,0x17,0xfb,0x10,0x00,0xa5,0xb5,0x14,0xa6,
-0x5c,0x30,0xf2,0x2c,0xac,0xca,0xea,0xa5,0x05,0x9c,0xca,0xe9,0x90,0x08,0x25,0x50,
-0xa0,0xa1,0x08,0x9b,0xb9,0xd8,0xd1,0x00,0x13,0xa1,0x11,0x10,0x2a,0xaf,0xaa,0xbd,
-0xa6,0x00,0x8b,0x21,0xb2,0x00,0x00,0x18,0xed,0xc6,0x10,0x0a,0x96,0x20,0x04,0xa1,
-0x00,0xea,0xaa,0xac,0x50,0x00,0xd8,0x88,0x8b,0x50,0x00,0xb1,0x11,0x16,0x50,0x0f,
-0x00,0x10,0xb0,0xcb,0x39,0x60,0xae,0xba,0xea,0x30,0x00,0x0d,0x4d,0x26,0x93,0x79,
-0x00,0xb0,0x0a,0x2c,0x70,0x00,0xbb,0xb5,0x7f,0x1d,0xf6,0x1c,0x6c,0xaa,0xd0,0x5b,
-0xda,0x68,0x55,0xc0,0x01,0x90,0x67,0x44,0xc0,0x47,0xc6,0x8b,0x99,0xd0,0x37,0xa4,
-0x74,0x00,0xb0,0x05,0xd1,0x4d,0xbe,0x90,0x09,0x4a,0x0b,0x0a,0x00,0x1b,0x05,0x3a,
-0x0a,0x12,0x82,0x04,0xb1,0x0c,0xb3,0xf2,0x07,0xd0,0x00,0xb0,0x1d,0x99,0xe0,0x29,
-0xac,0x2d,0x88,0xd0,0x00,0x39,0x1a,0x75,0x29,0xf0,0x05,0x1d,0x99,0xd0,0x0b,0xea,
-0x19,0x00,0xa0,0x55,0xb6,0x3b,0xbe,0x90,0x00,0xb0,0x07,0x2a,0x00,0x00,0xb0,0x54,
-0x4c,0x46,0xb2,0xb2,0x0a,0xb6,0xad,0x39,0xf6,0x1e,0x07,0xc9,0x19,0xda,0xc4,0x0b,
-0x0b,0x00,0xb0,0x73,0x6d,0xb9,0xab,0x77,0xc0,0x0a,0x52,0xa7,0x24,0x00,0x0b,0xa8,
-0xa8,0xce,0xa3,0x0b,0x75,0xa9,0x0a,0x00,0x0c,0x98,0xa9,0xae,0xa5,0x47,0x52,0x90,
-0x0a,0x00,0x72,0x17,0x80,0x0a,0x00,0xd1,0x1b,0xf0,0x0a,0x01,0x11,0x3c,0x11,0x10,
-0x19,0x99,0x99,0x99,0x96,0x00,0x79,0x99,0x99,0x20,0x00,0x12,0x22,0x22,0x00,0x00,
-0x57,0x77,0x77,0x10,0x0f,0x00,0x10,0x30,0x34,0x26,0x00,0xf0,0x00,0x20,0x17,0x50,
-0x7a,0x16,0x12,0x50,0xa0,0x00,0x00,0xae,0x1b,0xf0,0x11,0x19,0xa9,0x80,0x0b,0x00,
-0x04,0x55,0x20,0x0b,0x00,0x03,0x44,0x3b,0xbe,0xb9,0x06,0x88,0x30,0x0b,0x00,0x07,
-0x9a,0x50,0x0b,0x00,0x0a,0x02,0x70,0x0b,0x00,0x0a,0x9a,0x05,0x00,0x00,0x4c,0x03,
-0x21,0x04,0x10,0x2d,0x05,0xf1,0x1d,0x4b,0xbb,0xb0,0x79,0x99,0x20,0x00,0xb0,0x27,
-0x75,0x00,0x00,0xb0,0x13,0x32,0x2b,0xbb,0xb0,0x37,0x76,0x37,0x00,0x60,0x3a,0x97,
-0x37,0x00,0x00,0x54,0x0a,0x37,0x00,0x43,0x5b,0x9b,0x38,0x00,0x73,0x55,0x00,0x1b,
-0xbb,0xb0,0x02,0xa7,0x0a,0xf2,0x1d,0x70,0x0e,0xbe,0x00,0x68,0x98,0x29,0x0b,0x00,
-0x29,0x96,0xa4,0x0a,0x81,0x03,0x33,0x71,0x12,0x20,0x16,0x65,0xcb,0xab,0xa0,0x3a,
-0x97,0x2a,0x0b,0x20,0x45,0x0a,0x06,0xc6,0x00,0x4c,0x9b,0x6d,0xad,0x71,0x45,0x03,
-0xd4,0x04,0xd2,0x0b,0x04,0x02,0x31,0x06,0xf2,0x4e,0x7b,0xeb,0xb2,0x59,0xa9,0x00,
-0x91,0x00,0x04,0x42,0x11,0x91,0x00,0x06,0x64,0x54,0x93,0x10,0x18,0x86,0x54,0x99,
-0x90,0x19,0x97,0x54,0x91,0x00,0x18,0x0a,0x54,0x91,0x00,0x1c,0x8b,0xaa,0xd9,0x83,
-0x18,0x11,0x22,0x22,0x21,0x03,0x10,0x00,0x50,0x00,0x01,0x80,0x23,0x96,0x31,0x69,
-0x99,0x68,0xc7,0x73,0x29,0x96,0x09,0x24,0x20,0x03,0x32,0x5e,0xaa,0x00,0x17,0x75,
-0x12,0xb1,0x80,0x2a,0x98,0x49,0x17,0x60,0x36,0x09,0x30,0x8d,0x00,0x3c,0x9b,0x6e,
-0x75,0xa0,0x36,0x04,0xd4,0x00,0x93,0x63,0x06,0xf0,0x01,0x20,0x12,0x00,0x50,0x01,
-0x90,0x0a,0x07,0x60,0x59,0x99,0x6d,0xad,0xa1,0x19,0x96,0xda,0x02,0xf0,0x06,0x32,
-0x37,0xd7,0x60,0x17,0x75,0x14,0xc4,0x40,0x1a,0x99,0x11,0xb1,0x10,0x27,0x0a,0x68,
-0xd8,0x83,0x2c,0x9b,0xe9,0x02,0x00,0x9a,0x03,0x11,0x02,0xa0,0x00,0xf2,0x1d,0x80,
-0x4a,0xdb,0xc4,0x59,0xa9,0x54,0xb0,0x73,0x16,0x64,0x62,0xa0,0x82,0x04,0x43,0x3c,
-0x29,0xb0,0x17,0x75,0x31,0x60,0x00,0x1a,0x98,0x58,0x74,0x70,0x27,0x0a,0x9a,0x02,
-0x94,0x2c,0x9c,0x8a,0x00,0xa7,0x27,0x00,0x07,0xab,0x50,0xd6,0x01,0x11,0x10,0x44,
-0x02,0xf1,0x21,0x7a,0xea,0xa4,0x58,0x98,0x48,0xc6,0x40,0x19,0x96,0x18,0x62,0xa0,
-0x03,0x32,0x4b,0x64,0xc2,0x17,0x75,0x66,0x66,0x63,0x2a,0x99,0x5a,0xaa,0xc0,0x27,
-0x0a,0x74,0x00,0xb0,0x2c,0x9b,0x7a,0x88,0xd0,0x27,0x00,0x75,0x11,0xb0,0x02,0x20,
-0x04,0x00,0x60,0xf5,0x1f,0xf7,0x19,0x59,0x99,0x4b,0x9c,0xa0,0x19,0x96,0x74,0x11,
+0x8a,0x04,0x79,0x70,0x17,0x67,0x45,0x6b,0x40,0x00,0x79,0x51,0x00,0x66,0x01,0x04,
+0xf0,0x21,0x0a,0x9d,0x83,0x72,0xa0,0x2b,0x8d,0x86,0x72,0xa0,0x05,0x7d,0x74,0x72,
+0xa0,0x09,0x0a,0x28,0x20,0xb0,0x05,0x09,0x78,0x0a,0xa0,0x19,0x9a,0xee,0xa9,0xb5,
+0x04,0x8b,0x22,0x89,0x70,0x16,0x59,0x56,0x4a,0x40,0x00,0x57,0x30,0x00,0x54,0x01,
+0x10,0x04,0xd3,0x04,0xf2,0x1b,0x5c,0x77,0x73,0x4a,0xb7,0xc6,0x55,0x51,0x00,0x57,
+0xd6,0x55,0xd0,0x01,0xc5,0x98,0x77,0xd0,0x0b,0xe6,0x7a,0x97,0xa0,0x65,0xa9,0x1d,
+0xa9,0x80,0x00,0xa3,0xbb,0x29,0x60,0x00,0xa0,0x17,0xfb,0x10,0x00,0xa5,0xb5,0x14,
+0xa4,0x02,0xf2,0x2d,0x0a,0xac,0xca,0xea,0xa5,0x05,0x9c,0xca,0xe9,0x90,0x08,0x25,
+0x50,0xa0,0xa1,0x08,0x9b,0xb9,0xd8,0xd1,0x00,0x13,0xa1,0x11,0x10,0x2a,0xaf,0xaa,
+0xbd,0xa6,0x00,0x8b,0x21,0xb2,0x00,0x00,0x18,0xed,0xc6,0x10,0x0a,0x96,0x20,0x04,
+0xa1,0x00,0xea,0xaa,0xac,0x50,0x00,0xd8,0x88,0x8b,0x50,0x00,0xb1,0x11,0x16,0x50,
+0x0f,0x00,0xf2,0x09,0xb0,0x00,0x05,0x50,0x00,0xae,0xba,0xea,0x30,0x00,0x0d,0x00,
+0xb0,0x01,0x00,0x79,0x00,0xb0,0x0a,0x2c,0x70,0x00,0xbb,0xb5,0x64,0x05,0xf6,0x1d,
+0x90,0x6c,0xaa,0xd0,0x5b,0xda,0x68,0x55,0xc0,0x01,0x90,0x67,0x44,0xc0,0x47,0xc6,
+0x8b,0x99,0xd0,0x37,0xa4,0x74,0x00,0xb0,0x05,0xd1,0x4d,0xbe,0x90,0x09,0x4a,0x0b,
+0x0a,0x00,0x1b,0x05,0x3a,0x0a,0x12,0x82,0x04,0xb1,0x0c,0xb3,0xf2,0x07,0xf2,0x1e,
+0x00,0xb0,0x1d,0x99,0xe0,0x29,0xac,0x2d,0x88,0xd0,0x00,0x39,0x1a,0x00,0xb0,0x00,
+0xc1,0x1d,0x99,0xd0,0x0b,0xea,0x19,0x00,0xa0,0x55,0xb6,0x3b,0xbe,0x90,0x00,0xb0,
+0x07,0x2a,0x00,0x00,0xb0,0x0a,0x0a,0x08,0x00,0xb2,0xb2,0x0a,0xb6,0x69,0x00,0x00,
+0x92,0x04,0xf4,0x1d,0x07,0xc9,0x19,0xda,0xc4,0x0b,0x0b,0x00,0xb0,0x73,0x6d,0xb9,
+0xab,0x77,0xc0,0x0a,0x52,0xa7,0x24,0x00,0x0b,0xa8,0xa8,0xce,0xa3,0x0b,0x75,0xa9,
+0x0a,0x00,0x0c,0x98,0xa9,0xae,0xa5,0x47,0x52,0x90,0x0a,0x00,0x72,0x17,0x80,0x0a,
+0x40,0x03,0x10,0x32,0x34,0x08,0xf0,0x08,0x3c,0x11,0x10,0x19,0x99,0x99,0x99,0x96,
+0x00,0x79,0x99,0x99,0x20,0x00,0x12,0x22,0x22,0x00,0x00,0x57,0x77,0x77,0x10,0x0f,
+0x00,0x50,0x30,0x00,0xb0,0x00,0x07,0xf0,0x00,0x40,0x17,0x50,0x00,0xc8,0xfa,0x00,
+0x01,0xa0,0x00,0xf0,0x15,0xa1,0x00,0x0b,0x00,0x19,0xa9,0x80,0x0b,0x00,0x04,0x55,
+0x20,0x0b,0x00,0x03,0x44,0x3b,0xbe,0xb9,0x06,0x88,0x30,0x0b,0x00,0x07,0x9a,0x50,
+0x0b,0x00,0x0a,0x02,0x70,0x0b,0x00,0x0a,0x9a,0x05,0x00,0x00,0x4c,0x03,0x21,0x04,
+0x10,0x2d,0x05,0xf0,0x1e,0x4b,0xbb,0xb0,0x79,0x99,0x20,0x00,0xb0,0x27,0x75,0x00,
+0x00,0xb0,0x13,0x32,0x2b,0xbb,0xb0,0x37,0x76,0x37,0x00,0x60,0x3a,0x97,0x37,0x00,
+0x00,0x54,0x0a,0x37,0x00,0x43,0x5b,0x9b,0x38,0x00,0x73,0x55,0x00,0x1b,0xbb,0xb0,
+0x02,0x00,0xe4,0x02,0xf2,0x1d,0x70,0x0e,0xbe,0x00,0x68,0x98,0x29,0x0b,0x00,0x29,
+0x96,0xa4,0x0a,0x81,0x03,0x33,0x71,0x12,0x20,0x16,0x65,0xcb,0xab,0xa0,0x3a,0x97,
+0x2a,0x0b,0x20,0x45,0x0a,0x06,0xc6,0x00,0x4c,0x9b,0x6d,0xad,0x71,0x45,0x03,0xd4,
+0x04,0xd2,0x0b,0x04,0x02,0x31,0x06,0xf2,0x4e,0x7b,0xeb,0xb2,0x59,0xa9,0x00,0x91,
+0x00,0x04,0x42,0x11,0x91,0x00,0x06,0x64,0x54,0x93,0x10,0x18,0x86,0x54,0x99,0x90,
+0x19,0x97,0x54,0x91,0x00,0x18,0x0a,0x54,0x91,0x00,0x1c,0x8b,0xaa,0xd9,0x83,0x18,
+0x11,0x22,0x22,0x21,0x03,0x10,0x00,0x50,0x00,0x01,0x80,0x23,0x96,0x31,0x69,0x99,
+0x68,0xc7,0x73,0x29,0x96,0x09,0x24,0x20,0x03,0x32,0x5e,0xaa,0x00,0x17,0x75,0x12,
+0xb1,0x80,0x2a,0x98,0x49,0x17,0x60,0x36,0x09,0x30,0x8d,0x00,0x3c,0x9b,0x6e,0x75,
+0xa0,0x36,0x04,0xd4,0x00,0x93,0x63,0x06,0xf0,0x01,0x20,0x12,0x00,0x50,0x01,0x90,
+0x0a,0x07,0x60,0x59,0x99,0x6d,0xad,0xa1,0x19,0x96,0xda,0x02,0xf0,0x06,0x32,0x37,
+0xd7,0x60,0x17,0x75,0x14,0xc4,0x40,0x1a,0x99,0x11,0xb1,0x10,0x27,0x0a,0x68,0xd8,
+0x83,0x2c,0x9b,0xe9,0x02,0x00,0x9a,0x03,0x11,0x02,0xa0,0x00,0xf2,0x1d,0x80,0x4a,
+0xdb,0xc4,0x59,0xa9,0x54,0xb0,0x73,0x16,0x64,0x62,0xa0,0x82,0x04,0x43,0x3c,0x29,
+0xb0,0x17,0x75,0x31,0x60,0x00,0x1a,0x98,0x58,0x74,0x70,0x27,0x0a,0x9a,0x02,0x94,
+0x2c,0x9c,0x8a,0x00,0xa7,0x27,0x00,0x07,0xab,0x50,0xd6,0x01,0x11,0x10,0x44,0x02,
+0xf3,0x4c,0x7a,0xea,0xa4,0x58,0x98,0x48,0xc6,0x40,0x19,0x96,0x18,0x62,0xa0,0x03,
+0x32,0x4b,0x64,0xc2,0x17,0x75,0x66,0x66,0x63,0x2a,0x99,0x5a,0xaa,0xc0,0x27,0x0a,
+0x74,0x00,0xb0,0x2c,0x9b,0x7a,0x88,0xd0,0x27,0x00,0x75,0x11,0xb0,0x02,0x20,0x04,
+0x00,0x60,0x01,0x90,0x0b,0x04,0x80,0x59,0x99,0x4b,0x9c,0xa0,0x19,0x96,0x74,0x11,
 0xb1,0x03,0x32,0x73,0x00,0xa1,0x17,0x74,0x6d,0xcd,0xd1,0x1a,0x98,0x09,0x1b,0x00,
-0x27,0x0a,0x0c,0x0b,0x02,0x2c,0x9b,0x89,0x0b,0x09,0x27,0x03,0xc1,0x0a,0xb6,0xfa,
-0x25,0xf2,0x1d,0x80,0x34,0x7a,0x43,0x39,0xb9,0x23,0x69,0x32,0x05,0x53,0x29,0xaa,
-0x92,0x04,0x43,0x69,0x99,0x96,0x0e,0xe8,0xa1,0x00,0x0a,0x0b,0x98,0x12,0x87,0x21,
-0x0a,0x0a,0x04,0x77,0x22,0x0d,0x9b,0x2d,0x27,0x29,0x0a,0x00,0xd5,0x05,0xb9,0x73,
-0x18,0x00,0x13,0x08,0xf7,0x4a,0x07,0x30,0x0a,0xc1,0x00,0x79,0x93,0xa6,0x1b,0x30,
-0x49,0x9b,0xaa,0xab,0xc2,0x13,0x31,0x33,0x33,0x30,0x37,0x74,0xac,0x99,0xb0,0x5a,
-0xa4,0x69,0x65,0xa0,0x72,0x85,0xac,0x99,0xb0,0x7a,0xd5,0x58,0x43,0x90,0x72,0x04,
-0x58,0x47,0x80,0x07,0x05,0xc8,0xa6,0x20,0x69,0x94,0x48,0x83,0x80,0x39,0x88,0xbc,
-0xca,0x80,0x12,0x23,0x55,0x75,0x20,0x27,0x67,0x6b,0x57,0x90,0x39,0x97,0x9d,0x3d,
-0x20,0x53,0x87,0x5b,0x3b,0x20,0x5a,0xb7,0x48,0xba,0x80,0x53,0x00,0x08,0x25,0x4e,
-0x12,0xf0,0x0a,0x7d,0xce,0xb3,0xc6,0x62,0x1a,0x7a,0x8a,0xa8,0x81,0x5b,0x86,0x81,
-0xad,0x10,0x08,0x69,0x88,0x42,0x94,0x37,0x77,0xa8,0x77,0x71,0x2e,0x14,0x11,0x00,
-0x97,0x14,0x10,0x05,0x1f,0x14,0x02,0x05,0x00,0xf1,0x05,0x7a,0xb7,0xd7,0xc0,0x04,
-0xaa,0xb8,0xd8,0x80,0x06,0x9c,0x97,0xd7,0x84,0x03,0xab,0x11,0xb3,0xa4,0x04,0xb5,
-0x23,0x33,0xc4,0x44,0x47,0x05,0x00,0xb0,0x9e,0x87,0xdc,0x30,0x0a,0x82,0x00,0x04,
-0xa3,0x0e,0x9e,0x7b,0x30,0xf1,0x18,0x0a,0x00,0xa2,0x10,0x0d,0x9d,0x00,0xa9,0x94,
-0x0a,0x0b,0x00,0xa0,0x00,0x0d,0x8d,0x26,0xc6,0x60,0x0d,0x8d,0x56,0x00,0xb0,0x07,
-0x37,0x56,0x00,0xb0,0x2d,0x0a,0x6c,0x99,0xe0,0x45,0x00,0x47,0x11,0xb0,0x31,0x20,
-0x00,0x8f,0x0d,0x11,0x50,0x0a,0x00,0xf0,0x34,0x0b,0xbc,0xdb,0xfb,0xb5,0x00,0x54,
-0x70,0xc2,0x20,0x05,0x75,0x60,0xc1,0xb0,0x1b,0x0a,0x20,0xc0,0x75,0x01,0x4b,0x00,
-0xc0,0x03,0x01,0xb1,0x2b,0xa0,0x00,0x00,0x92,0x07,0xaa,0xd0,0x2a,0xdb,0x70,0x00,
-0xb0,0x12,0xa4,0x20,0x00,0xb0,0x38,0xba,0x89,0xba,0x90,0x08,0x56,0x18,0x20,0x00,
-0x0b,0x5a,0x78,0x20,0x55,0x1f,0x74,0x03,0xaa,0x91,0x47,0xe5,0x68,0x38,0x42,0x3b,
-0xbb,0xbb,0xb6,0xf1,0x0b,0xf0,0x14,0x63,0x0a,0xea,0xc4,0x0a,0xcb,0x80,0xa0,0x83,
-0x01,0x85,0x15,0x52,0xb1,0x18,0xab,0x86,0x06,0x50,0x08,0x46,0x1b,0x99,0xe0,0x0b,
-0x4b,0x7b,0x00,0xa0,0x0e,0x85,0x0b,0x99,0xd0,0x19,0x42,0x1d,0x53,0x54,0x1a,0xcb,
-0xbb,0xb5,0x4d,0x16,0x61,0x3d,0xbb,0xb4,0x0a,0x0a,0x38,0x0a,0x00,0xf2,0x3e,0xaa,
-0xa0,0x00,0x90,0x38,0x00,0xb0,0x09,0xa8,0x58,0x00,0xa0,0x0a,0x92,0x4d,0xbb,0xc0,
-0x0a,0x91,0x48,0x00,0x00,0x1d,0xda,0x69,0x11,0x11,0x34,0x00,0x29,0x99,0x95,0x01,
-0x83,0x10,0x0a,0x00,0x17,0xb9,0x62,0x3c,0x31,0x0b,0xc9,0x9b,0x6c,0x78,0x0b,0xb7,
-0x9a,0x0a,0x18,0x09,0x82,0x9b,0x7d,0x88,0x08,0xca,0x6b,0x3b,0x58,0x39,0xca,0x9a,
-0x0a,0x18,0x00,0x72,0x0c,0xae,0xb8,0x00,0x72,0x0a,0x00,0x18,0x81,0x34,0xf2,0x1d,
-0xa3,0x00,0xa1,0x00,0x36,0xb5,0x8b,0xbb,0xa2,0x69,0xcb,0x0c,0x06,0x50,0x7a,0xcc,
-0x98,0x02,0xc2,0x73,0x89,0x27,0x3b,0x10,0x49,0xd8,0x01,0xc8,0x00,0x7a,0xda,0x10,
-0xd7,0x00,0x01,0x90,0x1b,0x3b,0x60,0x01,0x90,0xb3,0x00,0x94,0x6f,0x2b,0xf0,0x0a,
+0x27,0x0a,0x0c,0x0b,0x02,0x2c,0x9b,0x89,0x0b,0x09,0x27,0x03,0xc1,0x3f,0x02,0x02,
+0xd7,0x00,0xf1,0x1d,0x80,0x34,0x7a,0x43,0x39,0xb9,0x23,0x69,0x32,0x05,0x53,0x29,
+0xaa,0x92,0x04,0x43,0x69,0x99,0x96,0x0e,0xe8,0xa1,0x00,0x0a,0x0b,0x98,0x12,0x87,
+0x21,0x0a,0x0a,0x04,0x77,0x22,0x0d,0x9b,0x2d,0x27,0x29,0x0a,0x00,0xd5,0x05,0xb9,
+0x32,0x00,0x10,0x05,0x13,0x08,0xf6,0x4b,0x07,0x30,0x0a,0xc1,0x00,0x79,0x93,0xa6,
+0x1b,0x30,0x49,0x9b,0xaa,0xab,0xc2,0x13,0x31,0x33,0x33,0x30,0x37,0x74,0xac,0x99,
+0xb0,0x5a,0xa4,0x69,0x65,0xa0,0x72,0x85,0xac,0x99,0xb0,0x7a,0xd5,0x58,0x43,0x90,
+0x72,0x04,0x58,0x47,0x80,0x07,0x05,0xc8,0xa6,0x20,0x69,0x94,0x48,0x83,0x80,0x39,
+0x88,0xbc,0xca,0x80,0x12,0x23,0x55,0x75,0x20,0x27,0x67,0x6b,0x57,0x90,0x39,0x97,
+0x9d,0x3d,0x20,0x53,0x87,0x5b,0x3b,0x20,0x5a,0xb7,0x48,0xba,0x80,0x53,0x00,0x08,
+0x25,0xb0,0x9b,0x00,0xf3,0x18,0x7d,0xce,0xb3,0xc6,0x62,0x1a,0x7a,0x8a,0xa8,0x81,
+0x5b,0x86,0x81,0xad,0x10,0x08,0x69,0x88,0x42,0x94,0x37,0x77,0xa8,0x77,0x71,0x01,
+0x66,0x66,0x66,0x00,0x01,0x77,0x77,0x76,0x00,0x05,0xa7,0x77,0x7d,0x05,0x00,0xf3,
+0x0d,0x7a,0xb7,0xd7,0xc0,0x04,0xaa,0xb8,0xd8,0x80,0x06,0x9c,0x97,0xd7,0x84,0x03,
+0xab,0x11,0xb3,0xa4,0x04,0xe9,0x99,0x9b,0x70,0x00,0xc4,0x44,0x47,0x05,0x00,0xf1,
+0x31,0x9e,0x87,0xdc,0x30,0x0a,0x82,0x00,0x04,0xa3,0x0e,0x9e,0x00,0xa0,0x00,0x0a,
+0x0a,0x00,0xa2,0x10,0x0d,0x9d,0x00,0xa9,0x94,0x0a,0x0b,0x00,0xa0,0x00,0x0d,0x8d,
+0x26,0xc6,0x60,0x0d,0x8d,0x56,0x00,0xb0,0x07,0x37,0x56,0x00,0xb0,0x2d,0x0a,0x6c,
+0x99,0xe0,0x45,0x00,0x47,0x11,0xb0,0x00,0x00,0x38,0x00,0x00,0x01,0xbb,0xce,0xbb,
+0x50,0x0a,0x00,0xf2,0x3c,0x0b,0xbc,0xdb,0xfb,0xb5,0x00,0x54,0x70,0xc2,0x20,0x05,
+0x75,0x60,0xc1,0xb0,0x1b,0x0a,0x20,0xc0,0x75,0x01,0x4b,0x00,0xc0,0x03,0x01,0xb1,
+0x2b,0xa0,0x00,0x00,0x92,0x07,0xaa,0xd0,0x2a,0xdb,0x70,0x00,0xb0,0x12,0xa4,0x20,
+0x00,0xb0,0x38,0xba,0x89,0xba,0x90,0x08,0x56,0x18,0x20,0x00,0x0b,0x5a,0x78,0x20,
+0x55,0x1f,0x74,0x03,0xaa,0x91,0x47,0xe5,0x00,0x00,0x00,0x82,0x3b,0xbb,0xbb,0xb6,
+0xf1,0x0b,0xf3,0x1b,0x63,0x0a,0xea,0xc4,0x0a,0xcb,0x80,0xa0,0x83,0x01,0x85,0x15,
+0x52,0xb1,0x18,0xab,0x86,0x06,0x50,0x08,0x46,0x1b,0x99,0xe0,0x0b,0x4b,0x7b,0x00,
+0xa0,0x0e,0x85,0x0b,0x99,0xd0,0x19,0xd7,0x00,0x00,0x00,0x54,0x1a,0xcb,0x60,0x04,
+0x81,0x0e,0xae,0x3d,0xbb,0xb4,0x0a,0x0a,0x38,0x0a,0x00,0xf1,0x3e,0xaa,0xa0,0x00,
+0x90,0x38,0x00,0xb0,0x09,0xa8,0x58,0x00,0xa0,0x0a,0x92,0x4d,0xbb,0xc0,0x0a,0x91,
+0x48,0x00,0x00,0x1d,0xda,0x69,0x11,0x11,0x34,0x00,0x29,0x99,0x95,0x01,0x83,0x10,
+0x0a,0x00,0x17,0xb9,0x62,0x3c,0x31,0x0b,0xc9,0x9b,0x6c,0x78,0x0b,0xb7,0x9a,0x0a,
+0x18,0x09,0x82,0x9b,0x7d,0x88,0x08,0xca,0x6b,0x3b,0x58,0x39,0xca,0x9a,0x0a,0x18,
+0x00,0x72,0x0c,0xae,0xb8,0x00,0x72,0x0a,0x00,0x18,0x5f,0x00,0xf1,0x1e,0x24,0xa3,
+0x00,0xa1,0x00,0x36,0xb5,0x8b,0xbb,0xa2,0x69,0xcb,0x0c,0x06,0x50,0x7a,0xcc,0x98,
+0x02,0xc2,0x73,0x89,0x27,0x3b,0x10,0x49,0xd8,0x01,0xc8,0x00,0x7a,0xda,0x10,0xd7,
+0x00,0x01,0x90,0x1b,0x3b,0x60,0x01,0x90,0xb3,0x00,0x94,0x32,0x00,0xf0,0x0b,0x53,
 0x76,0xb9,0x99,0xc3,0x65,0x79,0x50,0xb0,0x41,0x38,0xa5,0x58,0xd8,0x80,0x7c,0xca,
-0x77,0xd7,0xa0,0x0a,0x81,0x78,0xd7,0xc0,0x09,0x05,0x00,0xb0,0x18,0x98,0x22,0xb2,
-0x20,0x64,0xa4,0x88,0xd8,0x83,0x80,0xf2,0x31,0x30,0x03,0x00,0x01,0xdb,0x38,0x00,
-0x4d,0x12,0x30,0x50,0x04,0xa0,0xc1,0x04,0xf0,0x20,0xe1,0x00,0x4a,0x80,0x0c,0x47,
-0x00,0x00,0xb0,0x49,0x0c,0x00,0x00,0xb3,0xc1,0x05,0xa0,0x02,0xd6,0x10,0x00,0x54,
-0x1b,0x4a,0x41,0x11,0x33,0x32,0x00,0x68,0x99,0x84,0x01,0x00,0x01,0x70,0x00,0x0b,
-0x30,0x8a,0xc8,0x60,0x00,0x70,0xb1,0x11,0xb0,0x1c,0x08,0xd0,0xb0,0x5b,0xb0,0xc2,
-0x22,0x20,0x00,0xb0,0xea,0xaa,0xb0,0x00,0xb0,0x1d,0x21,0x60,0xb0,0xe9,0x99,0xd1,
-0x09,0xc4,0x12,0x35,0x43,0x07,0xaa,0xab,0xda,0xd9,0x12,0xf0,0x06,0x40,0x00,0x50,
-0x07,0x70,0x38,0x07,0x50,0x00,0x73,0xbc,0xbe,0xb3,0x03,0x20,0x00,0xb0,0x00,0x17,
-0xb5,0x99,0xd1,0x2e,0xf6,0x08,0x14,0xf4,0x10,0x00,0xb0,0x0b,0x3b,0x20,0x00,0xb2,
-0xc5,0x01,0xc1,0x0b,0xa7,0x10,0x00,0x10,0x56,0x06,0xcb,0xbb,0xdb,0x7b,0x02,0xf0,
-0x16,0x0a,0x12,0x9a,0x9c,0xa0,0x02,0xa0,0x18,0xa9,0x00,0x00,0x03,0xb8,0xd9,0xc0,
-0x4a,0x83,0xc8,0xd8,0xd0,0x00,0xb3,0x81,0xb1,0xa0,0x00,0xb3,0xb6,0xc6,0xc0,0x00,
-0xc3,0x70,0xa5,0xc0,0x0a,0x97,0x16,0x11,0x42,0x05,0xba,0x9a,0xc6,0xea,0x0b,0xf2,
-0x1d,0x01,0x11,0xc1,0x10,0x05,0x85,0x66,0xd6,0x63,0x00,0x04,0xb9,0xe9,0xc0,0x4a,
-0x95,0x50,0xb0,0xb0,0x00,0xb3,0x9c,0xfa,0x90,0x00,0xb0,0x2b,0xdb,0x20,0x00,0xb5,
-0xc1,0xb1,0xc1,0x06,0xd6,0x00,0x90,0x10,0x48,0x08,0xaa,0x9a,0xb6,0xd1,0x19,0xf6,
-0x1d,0x13,0xb8,0x88,0x99,0x01,0xa4,0xb8,0x88,0x99,0x00,0x04,0x68,0x03,0xa0,0x2a,
-0xa5,0x99,0xca,0x95,0x00,0xb6,0x67,0xc8,0x72,0x00,0xba,0x68,0xd9,0x85,0x00,0xc9,
-0x00,0x91,0x00,0x09,0xb7,0x00,0x40,0x00,0x38,0x05,0xba,0xaa,0xc9,0x1c,0x12,0x90,
-0x08,0x60,0xa9,0x9b,0x40,0x00,0x80,0xa8,0x84,0x82,0x38,0xf4,0x11,0x84,0x40,0x3a,
-0xb5,0xb9,0x99,0xd0,0x00,0xb6,0x39,0x86,0x90,0x00,0xb6,0x39,0x07,0x90,0x00,0xb6,
-0x3a,0x95,0x90,0x0b,0xd8,0x20,0x04,0x70,0x56,0x08,0xba,0xab,0xc8,0xe5,0x03,0xf2,
-0x20,0x20,0x00,0x0b,0x37,0x9a,0xd9,0x95,0x01,0x80,0x55,0x0b,0x10,0x00,0x06,0x98,
-0xc8,0xc2,0x3a,0x76,0x77,0xc7,0x92,0x00,0xa6,0x38,0xc5,0x82,0x00,0xa6,0x38,0x08,
-0x82,0x00,0xb6,0x3a,0x77,0xa2,0x0a,0x9a,0x30,0x03,0x61,0x15,0x02,0x89,0xaa,0x95,
-0x0e,0x2d,0xf3,0x1c,0x28,0x89,0x79,0xa5,0x02,0xa8,0x98,0x7a,0x93,0x00,0x06,0x9a,
-0x6a,0x87,0x2b,0x81,0x4a,0x4a,0x41,0x00,0xb2,0x5c,0x5c,0x51,0x00,0xb7,0x9d,0x9d,
-0x95,0x00,0xb1,0x94,0x08,0x70,0x08,0x98,0x20,0x00,0x31,0x29,0x03,0xaa,0xaa,0xd3,
-0x35,0x12,0x13,0xdc,0x14,0xf4,0x19,0x8b,0xba,0x0b,0xba,0xc7,0x82,0x66,0x02,0x90,
-0xb0,0x82,0xb0,0x16,0xc7,0xc6,0x84,0xa0,0x03,0x33,0x33,0x82,0x74,0x0a,0xaa,0xb6,
-0x82,0x19,0x0b,0x00,0x47,0x86,0x97,0x0b,0xaa,0xc7,0x83,0x10,0x0b,0x00,0x46,0x6d,
-0x16,0xf1,0x09,0xd7,0x77,0x7a,0x60,0x00,0xd6,0x66,0x69,0x60,0x00,0x87,0x77,0x78,
-0x30,0x18,0x88,0x88,0x88,0x86,0x02,0xb7,0x8c,0x77,0xb0,0x05,0x00,0xa0,0x01,0x77,
-0x8c,0x77,0x50,0x03,0x88,0x9c,0x88,0x70,0xe1,0x24,0x21,0x96,0x00,0x6a,0x36,0xf0,
-0x1a,0xd3,0x49,0x99,0xb0,0x2b,0x1a,0x36,0x66,0xb0,0x5a,0xc7,0x02,0x22,0xb0,0x00,
-0x90,0x8b,0xdb,0xc5,0x4a,0xda,0x51,0xa0,0x52,0x14,0x97,0x19,0xb9,0x70,0x08,0x98,
-0x08,0xea,0x20,0x05,0xca,0xb4,0xa1,0xa5,0x47,0x30,0xde,0x1a,0x10,0x8b,0xfc,0x0d,
-0x60,0x8a,0x99,0x99,0x10,0x00,0x84,0xe5,0x06,0xf0,0x09,0x88,0x77,0x77,0x10,0x2a,
-0xdb,0xaa,0xaa,0xa7,0x00,0xa0,0x2a,0x04,0x90,0x00,0xa0,0x06,0xc6,0x00,0x00,0xd7,
-0xa6,0x5b,0x72,0x46,0x1a,0xf3,0x20,0x55,0xe8,0x8c,0x4b,0x8e,0xe8,0x8c,0x4b,0x8d,
-0xc2,0x2b,0x48,0x2c,0xd6,0x65,0x16,0x6d,0xb2,0xac,0xad,0x5b,0xb0,0x29,0x1a,0x0b,
-0xb4,0xac,0x9d,0x6b,0xb0,0x74,0x09,0x0b,0xb2,0x80,0x09,0x9c,0xe9,0x98,0xb9,0x9e,
-0xe8,0x98,0xb8,0x8e,0xc1,0x38,0x76,0x27,0x62,0x99,0x98,0x0b,0xb0,0xb4,0x4b,0x04,
-0x00,0x70,0xc9,0x99,0x0c,0xb0,0x30,0x03,0xbb,0x7f,0x02,0xf3,0x1a,0x0e,0xba,0x02,
-0xd4,0x00,0xa6,0x51,0xa1,0xa4,0x0a,0xb2,0xc4,0x12,0xb5,0xab,0x13,0x8d,0x94,0x0a,
-0x29,0x33,0xc3,0x31,0xa1,0xb7,0x7d,0x77,0x3c,0x93,0x73,0xb2,0x90,0xa0,0x2b,0x0b,
-0x08,0x4a,0x01,0x18,0xc0,0x01,0xbd,0x1a,0x00,0xd3,0x3c,0xf0,0x79,0xd9,0x8d,0x88,
-0x60,0x0a,0xb3,0x4c,0x33,0x20,0x38,0xc6,0x6d,0x66,0x20,0x01,0xd8,0x8d,0x88,0x30,
-0x01,0xd7,0x8d,0x77,0x71,0x01,0x63,0x68,0x33,0x30,0x29,0x9b,0xff,0xc9,0x96,0x01,
-0x7a,0x67,0x8a,0x30,0x2a,0x40,0x46,0x02,0x86,0x00,0x50,0x00,0x43,0x00,0x49,0xca,
-0x92,0x89,0x10,0x06,0x65,0x78,0xcb,0xa4,0x09,0x97,0xaf,0x3a,0x00,0x0c,0x99,0xa7,
-0xbd,0x93,0x15,0xa6,0x56,0x3a,0x00,0x57,0xa6,0xb6,0xbe,0xa3,0x59,0xbb,0x96,0x3a,
-0x00,0x55,0x11,0xa6,0xbe,0xa6,0x54,0x04,0x96,0x30,0x00,0x39,0x99,0xe9,0x98,0x0b,
-0x88,0x8e,0x88,0x96,0xa5,0x73,0xb5,0x74,0x82,0x66,0x3b,0x56,0x41,0x19,0x88,0x98,
-0x86,0x02,0xb4,0x5c,0x44,0xb0,0x2b,0x34,0xc3,0x3b,0x01,0xb8,0x8d,0x88,0x68,0x00,
-0x00,0xb9,0x99,0x80,0x04,0x89,0x1e,0xf0,0x02,0x01,0x99,0xad,0x99,0x50,0x03,0x33,
-0x5a,0x33,0x32,0x16,0x66,0x66,0x66,0x63,0x00,0xb8,0x84,0x1e,0x12,0xb7,0x8e,0x1e,
-0x02,0x57,0x2e,0x00,0x05,0x00,0xc1,0x8b,0x20,0x00,0x0a,0x1a,0x10,0x00,0x4b,0xbe,
-0x1a,0xbb,0xa0,0x0a,0x00,0x51,0x2b,0xbe,0x1a,0xbb,0x80,0x0a,0x00,0xa1,0x11,0x1b,
-0x1a,0x31,0x10,0x59,0x9d,0x1a,0xa9,0x91,0x0f,0x00,0x01,0x05,0x00,0x02,0xa2,0x25,
-0x00,0x4b,0x23,0xf1,0x10,0x08,0xbb,0xdb,0xba,0xb1,0x0b,0x08,0x10,0xa0,0x92,0x0b,
-0x08,0xa9,0xc0,0x92,0x0b,0x08,0x64,0xb0,0x92,0x0b,0x08,0x53,0xb0,0x92,0x0b,0xad,
-0xba,0xea,0xd2,0x0b,0x18,0x35,0xf7,0x1c,0xa2,0x03,0xb4,0x30,0x18,0xd9,0x64,0xd4,
-0xb0,0x09,0xb9,0x7a,0xaa,0xa6,0x0d,0x8a,0x7c,0x55,0xa4,0x0b,0x36,0x7a,0x8a,0xa3,
-0x05,0xb6,0x39,0x9e,0x96,0x3b,0xec,0x98,0x0b,0x00,0x00,0x91,0x0a,0x9e,0x96,0x00,
-0x91,0x00,0x0b,0x40,0x39,0x70,0x06,0xaa,0xbe,0xaa,0xa1,0x00,0x18,0x8c,0x19,0xd0,
-0x3d,0x43,0xa7,0x32,0x17,0x77,0x77,0x77,0x74,0x00,0x8a,0xaa,0xaa,0xd7,0x08,0x20,
-0x06,0x50,0x6b,0x10,0x16,0x50,0x0a,0x00,0x11,0x01,0x41,0x0d,0xf0,0x08,0x00,0x9a,
-0xbd,0xa3,0x09,0x81,0x94,0x99,0x50,0x09,0x81,0x9a,0x33,0xb0,0x09,0x81,0x9a,0x88,
-0xd0,0x09,0x81,0x99,0x22,0x0a,0x00,0x30,0x66,0xc0,0x28,0x0f,0x00,0xc0,0x54,0x41,
-0x93,0x64,0x60,0x50,0x00,0x67,0x00,0x63,0x01,0x11,0x85,0x11,0xf3,0x1c,0x7a,0x68,
-0xbb,0x83,0x0c,0x8a,0x56,0xba,0x80,0x0b,0x26,0x5a,0x00,0xb0,0x05,0x66,0x2b,0x77,
-0xd0,0x48,0xc8,0x7b,0x77,0xd0,0x0a,0x89,0x78,0x88,0xa0,0x0d,0x91,0x08,0x53,0x90,
-0x29,0xe2,0x47,0x00,0x64,0x71,0x2a,0xa9,0x99,0x30,0x1d,0xf3,0x1c,0xaa,0xaa,0xd4,
-0x90,0x02,0x7a,0xb0,0x5e,0x70,0x29,0xb0,0xb0,0x1a,0x51,0x01,0xa0,0xb0,0x08,0xb6,
-0x5b,0xda,0xea,0xd3,0x60,0x03,0x70,0xb0,0x6b,0x70,0x06,0x50,0xb0,0x4b,0xb2,0x0c,
-0x00,0xb0,0x0c,0x03,0x65,0x00,0xb0,0x05,0xa1,0x07,0x00,0x70,0x0b,0xf0,0x00,0x12,
-0x22,0xb5,0x22,0x20,0x46,0x66,0x66,0x66,0x60,0x01,0xd8,0x88,0x9b,0x00,0x1b,0x1b,
-0xf1,0x08,0x00,0x29,0x99,0x99,0x99,0x70,0x37,0x26,0x66,0x50,0xb0,0x37,0x66,0x22,
-0xb0,0xb0,0x37,0x6b,0x88,0x80,0xb0,0x37,0x10,0xdd,0x46,0xf4,0x24,0x00,0x04,0x9c,
-0x10,0x00,0x16,0xbf,0xff,0xf2,0x00,0x3f,0xff,0xff,0xff,0x20,0x05,0xff,0xd9,0x41,
-0xf2,0x00,0x5f,0x20,0x00,0x1f,0x20,0x05,0xe0,0x00,0x01,0xf2,0x00,0x5e,0x00,0x07,
-0x9f,0x20,0x48,0xe0,0x07,0xff,0xf2,0xaf,0xfe,0x00,0x2b,0xd8,0x07,0xff,0x90,0x00,
-0x26,0x3a,0xf1,0x19,0x41,0x88,0x88,0x88,0x14,0xeb,0xe7,0x77,0x7e,0xbe,0xa2,0xd0,
-0x00,0x0d,0x2a,0xeb,0xe3,0x33,0x3e,0xbe,0xb4,0xfb,0xbb,0xbf,0x4b,0xd9,0xd0,0x00,
-0x0d,0x9d,0xb5,0xd0,0x00,0x0d,0x5b,0xb7,0xff,0xff,0xff,0x7b,0x9a,0x00,0xff,0x05,
-0xff,0xd6,0xff,0xff,0xff,0xff,0xe7,0xff,0xff,0xff,0x67,0x52,0x77,0x77,0x76,0xef,
-0xc6,0xff,0xff,0xfe,0x0f,0x00,0x01,0x20,0x78,0x63,0x30,0x2c,0x03,0x6d,0x40,0x20,
-0x06,0xfd,0x7b,0x48,0xf0,0x04,0xf7,0x7c,0x10,0x06,0xff,0x70,0xdf,0xc1,0x6f,0xf7,
-0x00,0x1d,0xfe,0xff,0x70,0x00,0x01,0xdf,0xf7,0x00,0x31,0x12,0x60,0x54,0x18,0xf0,
-0x07,0xd1,0x02,0xea,0xaf,0xd4,0xef,0x80,0xaf,0xff,0x80,0x02,0xff,0xf1,0x02,0xef,
-0xdf,0xd1,0xdf,0x80,0xaf,0xb6,0x70,0x99,0x38,0x10,0xa6,0xe1,0x1b,0xf4,0x1b,0xea,
+0x77,0xd7,0xa0,0x0a,0x81,0x78,0xd7,0xc0,0x09,0x05,0x00,0xf0,0x01,0x18,0x98,0x22,
+0xb2,0x20,0x64,0xa4,0x88,0xd8,0x83,0x80,0x00,0x00,0xa0,0x00,0x03,0xe7,0x05,0x90,
+0x08,0x60,0x1c,0x10,0x00,0x00,0x50,0x04,0xa0,0xc1,0x04,0xf0,0x20,0xe1,0x00,0x4a,
+0x80,0x0c,0x47,0x00,0x00,0xb0,0x49,0x0c,0x00,0x00,0xb3,0xc1,0x05,0xa0,0x02,0xd6,
+0x10,0x00,0x54,0x1b,0x4a,0x41,0x11,0x33,0x32,0x00,0x68,0x99,0x84,0x01,0x00,0x01,
+0x70,0x00,0x0b,0x30,0x8a,0xc8,0x60,0x00,0x70,0xb1,0x11,0xb0,0x1c,0x08,0xf2,0x10,
+0xb0,0x5b,0xb0,0xc2,0x22,0x20,0x00,0xb0,0xea,0xaa,0xb0,0x00,0xb0,0xb0,0x00,0xa1,
+0x00,0xb0,0xe9,0x99,0xd1,0x09,0xc4,0x00,0x00,0x00,0x37,0x07,0xaa,0xab,0xda,0x1a,
+0x04,0xf6,0x22,0x00,0x40,0x00,0x50,0x07,0x70,0x38,0x07,0x50,0x00,0x73,0xbc,0xbe,
+0xb3,0x03,0x20,0x00,0xb0,0x00,0x17,0xb5,0x99,0xe9,0x96,0x00,0xb0,0x14,0xf4,0x10,
+0x00,0xb0,0x0b,0x3b,0x20,0x00,0xb2,0xc5,0x01,0xc1,0x0b,0xa7,0x10,0x00,0x10,0x56,
+0x06,0xcb,0xbb,0xdb,0x7b,0x02,0xf2,0x1e,0x0a,0x12,0x9a,0x9c,0xa0,0x02,0xa0,0x18,
+0xa9,0x00,0x00,0x03,0xb8,0xd9,0xc0,0x4a,0x83,0xc8,0xd8,0xd0,0x00,0xb3,0x81,0xb1,
+0xa0,0x00,0xb3,0xb6,0xc6,0xc0,0x00,0xc3,0x70,0xa5,0xc0,0x0a,0x97,0x00,0x00,0x00,
+0x46,0x05,0xba,0x9a,0xc6,0xea,0x0b,0xf2,0x1c,0x01,0x11,0xc1,0x10,0x05,0x85,0x66,
+0xd6,0x63,0x00,0x04,0xb9,0xe9,0xc0,0x4a,0x95,0x50,0xb0,0xb0,0x00,0xb3,0x9c,0xfa,
+0x90,0x00,0xb0,0x2b,0xdb,0x20,0x00,0xb5,0xc1,0xb1,0xc1,0x06,0xd6,0x00,0x90,0x10,
+0x48,0x08,0xaa,0x9a,0x7f,0x03,0xf2,0x1e,0x08,0x13,0xb8,0x88,0x99,0x01,0xa4,0xb8,
+0x88,0x99,0x00,0x04,0x68,0x03,0xa0,0x2a,0xa5,0x99,0xca,0x95,0x00,0xb6,0x67,0xc8,
+0x72,0x00,0xba,0x68,0xd9,0x85,0x00,0xc9,0x00,0x91,0x00,0x09,0xb7,0x00,0x40,0x00,
+0x38,0x05,0xba,0xaa,0xc9,0x1a,0x04,0x01,0x37,0x00,0xf4,0x1d,0x60,0xa9,0x9b,0x40,
+0x00,0x80,0xa8,0x84,0x40,0x00,0x00,0xa0,0x84,0x40,0x3a,0xb5,0xb9,0x99,0xd0,0x00,
+0xb6,0x39,0x86,0x90,0x00,0xb6,0x39,0x07,0x90,0x00,0xb6,0x3a,0x95,0x90,0x0b,0xd8,
+0x20,0x04,0x70,0x56,0x08,0xba,0xab,0xc8,0xe5,0x03,0xf1,0x21,0x20,0x00,0x0b,0x37,
+0x9a,0xd9,0x95,0x01,0x80,0x55,0x0b,0x10,0x00,0x06,0x98,0xc8,0xc2,0x3a,0x76,0x77,
+0xc7,0x92,0x00,0xa6,0x38,0xc5,0x82,0x00,0xa6,0x38,0x08,0x82,0x00,0xb6,0x3a,0x77,
+0xa2,0x0a,0x9a,0x30,0x03,0x61,0x15,0x02,0x89,0xaa,0x95,0x00,0xd5,0x09,0xf2,0x1e,
+0x28,0x89,0x79,0xa5,0x02,0xa8,0x98,0x7a,0x93,0x00,0x06,0x9a,0x6a,0x87,0x2b,0x81,
+0x4a,0x4a,0x41,0x00,0xb2,0x5c,0x5c,0x51,0x00,0xb7,0x9d,0x9d,0x95,0x00,0xb1,0x94,
+0x08,0x70,0x08,0x98,0x20,0x00,0x31,0x29,0x03,0xaa,0xaa,0xca,0x00,0x21,0x0d,0x01,
+0x53,0x08,0xf3,0x1b,0x00,0x8b,0xba,0x0b,0xba,0xc7,0x82,0x66,0x02,0x90,0xb0,0x82,
+0xb0,0x16,0xc7,0xc6,0x84,0xa0,0x03,0x33,0x33,0x82,0x74,0x0a,0xaa,0xb6,0x82,0x19,
+0x0b,0x00,0x47,0x86,0x97,0x0b,0xaa,0xc7,0x83,0x10,0x0b,0x00,0x46,0x82,0x9f,0x00,
+0xf1,0x09,0xd7,0x77,0x7a,0x60,0x00,0xd6,0x66,0x69,0x60,0x00,0x87,0x77,0x78,0x30,
+0x18,0x88,0x88,0x88,0x86,0x02,0xb7,0x8c,0x77,0xb0,0x05,0x00,0xf1,0x00,0x01,0x77,
+0x8c,0x77,0x50,0x03,0x88,0x9c,0x88,0x70,0x29,0x99,0xad,0x99,0x96,0x86,0x0b,0xf0,
+0x1e,0x03,0xd3,0x49,0x99,0xb0,0x2b,0x1a,0x36,0x66,0xb0,0x5a,0xc7,0x02,0x22,0xb0,
+0x00,0x90,0x8b,0xdb,0xc5,0x4a,0xda,0x51,0xa0,0x52,0x14,0x97,0x19,0xb9,0x70,0x08,
+0x98,0x08,0xea,0x20,0x05,0xca,0xb4,0xa1,0xa5,0x47,0x30,0x05,0xb0,0x00,0xf2,0x59,
+0x00,0x8b,0x99,0x99,0x40,0x00,0x8a,0x99,0x99,0x10,0x00,0x84,0x22,0x22,0x00,0x00,
+0x88,0x77,0x77,0x10,0x2a,0xdb,0xaa,0xaa,0xa7,0x00,0xa0,0x2a,0x04,0x90,0x00,0xa0,
+0x06,0xc6,0x00,0x00,0xd7,0xa6,0x5b,0x72,0x00,0x83,0x00,0x00,0x55,0xe8,0x8c,0x4b,
+0x8e,0xe8,0x8c,0x4b,0x8d,0xc2,0x2b,0x48,0x2c,0xd6,0x65,0x16,0x6d,0xb2,0xac,0xad,
+0x5b,0xb0,0x29,0x1a,0x0b,0xb4,0xac,0x9d,0x6b,0xb0,0x74,0x09,0x0b,0xb2,0x80,0x09,
+0x9c,0xe9,0x98,0xb9,0x9e,0xe8,0x98,0xb8,0x8e,0xc1,0x38,0xb1,0x1c,0xd7,0x73,0x57,
+0x7d,0xb0,0x99,0x98,0x0b,0xb0,0xb4,0x4b,0x04,0x00,0xf1,0x26,0xc9,0x99,0x0c,0xb0,
+0x30,0x03,0xbb,0x00,0x00,0x03,0x00,0x0e,0xba,0x02,0xd4,0x00,0xa6,0x51,0xa1,0xa4,
+0x0a,0xb2,0xc4,0x12,0xb5,0xab,0x13,0x8d,0x94,0x0a,0x29,0x33,0xc3,0x31,0xa1,0xb7,
+0x7d,0x77,0x3c,0x93,0x73,0xb2,0x90,0xa0,0x2b,0x0b,0x08,0x4a,0x01,0x18,0xc0,0x01,
+0x00,0x01,0x00,0xf0,0xa4,0x33,0x15,0x00,0x00,0x00,0xd9,0x8d,0x88,0x60,0x0a,0xb3,
+0x4c,0x33,0x20,0x38,0xc6,0x6d,0x66,0x20,0x01,0xd8,0x8d,0x88,0x30,0x01,0xd7,0x8d,
+0x77,0x71,0x01,0x63,0x68,0x33,0x30,0x29,0x9b,0xff,0xc9,0x96,0x01,0x7a,0x67,0x8a,
+0x30,0x2a,0x40,0x46,0x02,0x86,0x00,0x50,0x00,0x43,0x00,0x49,0xca,0x92,0x89,0x10,
+0x06,0x65,0x78,0xcb,0xa4,0x09,0x97,0xaf,0x3a,0x00,0x0c,0x99,0xa7,0xbd,0x93,0x15,
+0xa6,0x56,0x3a,0x00,0x57,0xa6,0xb6,0xbe,0xa3,0x59,0xbb,0x96,0x3a,0x00,0x55,0x11,
+0xa6,0xbe,0xa6,0x54,0x04,0x96,0x30,0x00,0x39,0x99,0xe9,0x98,0x0b,0x88,0x8e,0x88,
+0x96,0xa5,0x73,0xb5,0x74,0x82,0x66,0x3b,0x56,0x41,0x19,0x88,0x98,0x86,0x02,0xb4,
+0x5c,0x44,0xb0,0x2b,0x34,0xc3,0x3b,0x01,0xb8,0x8d,0x88,0x68,0x00,0x00,0xb9,0x99,
+0x80,0x04,0x99,0xad,0x99,0x90,0x01,0x99,0xad,0x99,0x50,0x03,0x33,0x5a,0x33,0x32,
+0x16,0x66,0x66,0x66,0x63,0x00,0xb8,0x88,0x8b,0x40,0x00,0xb7,0x77,0x7b,0x40,0x00,
+0xc8,0x88,0x8c,0x40,0x00,0xb0,0x00,0x07,0x05,0x00,0xc1,0x8b,0x20,0x00,0x0a,0x1a,
+0x10,0x00,0x4b,0xbe,0x1a,0xbb,0xa0,0x0a,0x00,0x51,0x2b,0xbe,0x1a,0xbb,0x80,0x0a,
+0x00,0xa1,0x11,0x1b,0x1a,0x31,0x10,0x59,0x9d,0x1a,0xa9,0x91,0x0f,0x00,0x01,0x05,
+0x00,0xf3,0x4b,0x1b,0xbb,0xdd,0xbb,0xb7,0x00,0x00,0x75,0x00,0x00,0x08,0xbb,0xdb,
+0xba,0xb1,0x0b,0x08,0x10,0xa0,0x92,0x0b,0x08,0xa9,0xc0,0x92,0x0b,0x08,0x64,0xb0,
+0x92,0x0b,0x08,0x53,0xb0,0x92,0x0b,0xad,0xba,0xea,0xd2,0x0b,0x00,0x00,0x00,0x92,
+0x00,0xa2,0x03,0xb4,0x30,0x18,0xd9,0x64,0xd4,0xb0,0x09,0xb9,0x7a,0xaa,0xa6,0x0d,
+0x8a,0x7c,0x55,0xa4,0x0b,0x36,0x7a,0x8a,0xa3,0x05,0xb6,0x39,0x9e,0x96,0x3b,0xec,
+0x98,0x0b,0x00,0x00,0x91,0x0a,0x9e,0x96,0x00,0x91,0x00,0x0b,0x00,0x01,0x00,0xf6,
+0x17,0x24,0x00,0x00,0x06,0xaa,0xbe,0xaa,0xa1,0x00,0x18,0x00,0x29,0x00,0x03,0x3d,
+0x43,0xa7,0x32,0x17,0x77,0x77,0x77,0x74,0x00,0x8a,0xaa,0xaa,0x30,0x00,0xb0,0x00,
+0x06,0x50,0x00,0xc9,0x99,0x9c,0x50,0x0a,0x00,0x01,0x7e,0x01,0xf0,0x09,0x09,0x00,
+0x9a,0xbd,0xa3,0x09,0x81,0x94,0x99,0x50,0x09,0x81,0x9a,0x33,0xb0,0x09,0x81,0x9a,
+0x88,0xd0,0x09,0x81,0x99,0x22,0x0a,0x00,0x30,0x66,0xc0,0x28,0x0f,0x00,0xf1,0x2e,
+0x54,0x41,0x93,0x64,0x60,0x50,0x00,0x67,0x00,0x63,0x01,0x11,0x00,0x00,0x00,0x0c,
+0x7a,0x68,0xbb,0x83,0x0c,0x8a,0x56,0xba,0x80,0x0b,0x26,0x5a,0x00,0xb0,0x05,0x66,
+0x2b,0x77,0xd0,0x48,0xc8,0x7b,0x77,0xd0,0x0a,0x89,0x78,0x88,0xa0,0x0d,0x91,0x08,
+0x53,0x90,0x29,0xe2,0x47,0x00,0x64,0x71,0x2a,0xa9,0x99,0x94,0x00,0x64,0x00,0xf3,
+0x1d,0xaa,0xaa,0xd4,0x90,0x02,0x7a,0xb0,0x5e,0x70,0x29,0xb0,0xb0,0x1a,0x51,0x01,
+0xa0,0xb0,0x08,0xb6,0x5b,0xda,0xea,0xd3,0x60,0x03,0x70,0xb0,0x6b,0x70,0x06,0x50,
+0xb0,0x4b,0xb2,0x0c,0x00,0xb0,0x0c,0x03,0x65,0x00,0xb0,0x05,0xb6,0xcd,0x00,0xf0,
+0x54,0x20,0x00,0x00,0x12,0x22,0xb5,0x22,0x20,0x46,0x66,0x66,0x66,0x60,0x01,0xd8,
+0x88,0x9b,0x00,0x01,0xc8,0x88,0x8a,0x00,0x29,0x99,0x99,0x99,0x70,0x37,0x26,0x66,
+0x50,0xb0,0x37,0x66,0x22,0xb0,0xb0,0x37,0x6b,0x88,0x80,0xb0,0x37,0x10,0x00,0x08,
+0x90,0x00,0x00,0x00,0x04,0x9c,0x10,0x00,0x16,0xbf,0xff,0xf2,0x00,0x3f,0xff,0xff,
+0xff,0x20,0x05,0xff,0xd9,0x41,0xf2,0x00,0x5f,0x20,0x00,0x1f,0x20,0x05,0xe0,0x00,
+0x01,0xf2,0x00,0x5e,0x00,0x07,0x9f,0x20,0x48,0xe0,0x07,0xff,0xf2,0xaf,0xfe,0x00,
+0x2b,0xd8,0x07,0xff,0x34,0x00,0x20,0x01,0x10,0x6d,0x00,0xf1,0x19,0x41,0x88,0x88,
+0x88,0x14,0xeb,0xe7,0x77,0x7e,0xbe,0xa2,0xd0,0x00,0x0d,0x2a,0xeb,0xe3,0x33,0x3e,
+0xbe,0xb4,0xfb,0xbb,0xbf,0x4b,0xd9,0xd0,0x00,0x0d,0x9d,0xb5,0xd0,0x00,0x0d,0x5b,
+0xb7,0xff,0xff,0xff,0x7b,0x9a,0x00,0xff,0x05,0xff,0xd6,0xff,0xff,0xff,0xff,0xe7,
+0xff,0xff,0xff,0x67,0x52,0x77,0x77,0x76,0xef,0xc6,0xff,0xff,0xfe,0x0f,0x00,0x01,
+0x51,0x78,0x63,0x88,0x88,0x87,0x5e,0x00,0xf1,0x12,0x00,0x00,0x00,0x06,0xfd,0x00,
+0x00,0x00,0x6f,0xf7,0x7c,0x10,0x06,0xff,0x70,0xdf,0xc1,0x6f,0xf7,0x00,0x1d,0xfe,
+0xff,0x70,0x00,0x01,0xdf,0xf7,0x00,0x00,0x00,0x1c,0x60,0x58,0x00,0xf3,0x3b,0x0c,
+0xd1,0x02,0xea,0xaf,0xd4,0xef,0x80,0xaf,0xff,0x80,0x02,0xff,0xf1,0x02,0xef,0xdf,
+0xd1,0xdf,0x80,0xaf,0xb6,0x70,0x00,0x85,0x00,0x00,0xa6,0x00,0x00,0x02,0xa0,0xea,
 0x29,0x00,0x0e,0xe1,0xea,0x5f,0xa0,0x7f,0x40,0xea,0x08,0xf3,0xbd,0x00,0xea,0x01,
 0xf7,0xcc,0x00,0xb7,0x00,0xf8,0xaf,0x00,0x00,0x04,0xf6,0x4f,0xa0,0x00,0x1d,0xf1,
-0x09,0xfd,0x89,0xef,0x50,0x00,0x6d,0xff,0xc4,0xf4,0x26,0x10,0x88,0xb7,0x18,0xfa,
-0x1b,0xff,0x40,0x00,0x1e,0xcf,0xff,0xfc,0xd0,0x7f,0xff,0xdd,0xff,0xf7,0x2d,0xfa,
-0x00,0xbf,0xd1,0x0b,0xf7,0x00,0x8f,0xa0,0x6f,0xfe,0x55,0xef,0xf6,0x4f,0xff,0xff,
-0xff,0xf3,0x06,0x3a,0xff,0xa3,0x60,0x00,0x03,0xff,0x30,0xe2,0x3c,0xf0,0x23,0x6f,
-0x90,0xf8,0x00,0x00,0x09,0xf8,0xec,0xf8,0x00,0x01,0xbe,0x5a,0x5c,0xf8,0x00,0x2d,
-0xd5,0xef,0xf6,0xaf,0x50,0xda,0x6f,0xff,0xff,0x87,0xf1,0x11,0xff,0xff,0xff,0xf5,
-0x10,0x02,0xff,0xc3,0x9f,0xf6,0x00,0x02,0xff,0xb0,0x7f,0xf6,0x00,0x01,0xbb,0x70,
-0x4b,0xd2,0x0b,0x10,0x88,0x30,0x38,0x27,0xff,0x60,0x05,0x00,0x90,0x01,0xff,0xff,
-0xff,0x60,0x00,0x5f,0xff,0xfa,0x8c,0x00,0xf3,0x02,0xb0,0x00,0x8b,0xb9,0x8b,0x8b,
-0xb9,0xdf,0xff,0xff,0xfe,0xdf,0xcf,0xff,0xff,0xfc,0xbe,0xba,0x02,0xf0,0x02,0x44,
-0x44,0x30,0x00,0x01,0xef,0xff,0xff,0xf4,0x00,0x0b,0xc0,0x00,0x00,0x8e,0x10,0x6e,
-0x9f,0x46,0xe0,0xa0,0xee,0xcb,0x10,0x0a,0xcd,0xf2,0xff,0xff,0xb8,0x9f,0xff,0xf4,
-0xff,0x01,0x00,0x20,0xf4,0xcf,0x06,0x00,0xf2,0x23,0xe1,0x00,0x04,0x87,0x30,0x5f,
-0x02,0xdf,0xfe,0xfc,0x7f,0x1e,0xd3,0x00,0x3c,0xff,0x9f,0x10,0x05,0xfe,0xff,0x44,
-0x00,0x02,0x66,0x66,0x12,0x22,0x00,0x00,0x11,0xff,0xff,0x50,0x00,0xda,0xff,0xa3,
-0x10,0x08,0xf4,0xfc,0xfb,0x66,0xbf,0x80,0xf5,0x4c,0xff,0xd5,0xbc,0x45,0x00,0x58,
-0x32,0x43,0xbf,0xab,0xdf,0xff,0x01,0x00,0x50,0x00,0x3e,0xf0,0x00,0x2c,0x14,0x00,
-0xf0,0x05,0x00,0x0b,0xf0,0x00,0xab,0xdf,0xf0,0x20,0xff,0xff,0xf0,0xa6,0xff,0xff,
-0xf0,0x59,0xff,0xff,0xf0,0x92,0x1d,0x00,0x01,0xb3,0x39,0x03,0x40,0x3f,0x30,0x70,
-0x00,0xaa,0x28,0x00,0x90,0x0a,0x4a,0x70,0xab,0xdf,0xf0,0x23,0xe2,0xe0,0x2c,0x00,
-0x20,0x95,0xc2,0x2e,0x00,0x20,0x76,0xc3,0x30,0x00,0xd1,0xc3,0xe1,0x00,0x3e,0xf0,
-0x09,0xa6,0xb0,0x00,0x02,0xc0,0x03,0x3e,0x06,0x14,0x20,0xc3,0x00,0x2b,0x0e,0x30,
-0x42,0xff,0xef,0x64,0x01,0xf0,0x09,0x0d,0xff,0xef,0xff,0xf8,0x4e,0xfe,0x25,0xff,
-0xff,0x9d,0xe2,0x00,0x6f,0xf9,0x01,0x20,0x00,0x4f,0xf7,0x44,0x44,0x44,0x7f,0xd0,
-0x00,0x10,0xfc,0x14,0x1b,0xf1,0x13,0x07,0xf5,0x00,0x00,0xef,0xc0,0x00,0x8f,0xff,
-0x60,0x3f,0xff,0xff,0x1b,0xff,0xff,0xf9,0xfb,0xff,0xff,0xdd,0x6e,0xff,0xfc,0x7e,
-0x59,0xff,0x60,0x9f,0xff,0x80,0x00,0x13,0x10,0x00,0x09,0xf5,0x3a,0x70,0x03,0xe4,
-0xe7,0x04,0xff,0x5e,0x75,0xff,0xf5,0xec,0xff,0xff,0x5e,0xff,0xff,0xf5,0xea,0xef,
-0xff,0x5e,0x71,0xdf,0xf5,0xe7,0x01,0xcf,0x59,0x50,0x00,0x92,0x88,0x00,0x00,0x00,
-0x0f,0xfe,0x50,0x00,0x00,0xff,0xff,0xc3,0x00,0x0f,0xff,0xff,0xf9,0x10,0xff,0xff,
-0xff,0xfe,0x5f,0xff,0xff,0xff,0xfa,0xff,0xff,0xff,0xf8,0x0f,0xff,0xff,0xb2,0x00,
-0xff,0xfd,0x40,0x00,0x0e,0xf7,0x90,0x3e,0x00,0x0c,0x12,0xee,0xff,0x90,0xdf,0xf9,
-0xff,0xfc,0x0f,0xff,0xcf,0xff,0xc0,0xff,0xfc,0xff,0x09,0x00,0x71,0xfb,0x0f,0xff,
-0xb8,0xbb,0x50,0x8b,0x84,0x09,0x00,0x28,0x4e,0x10,0xf9,0x3f,0x01,0x01,0xbb,0x00,
-0x0f,0x09,0x00,0x03,0x12,0xb8,0x9c,0x39,0xf3,0x12,0x00,0x0b,0xa0,0x00,0xe7,0xcf,
-0xb0,0x0e,0x7c,0xff,0xc1,0xe7,0xcf,0xff,0xdf,0x7c,0xff,0xff,0xf7,0xcf,0xff,0x9e,
-0x7c,0xff,0x70,0xe7,0xcf,0x60,0x0e,0x77,0x50,0x00,0x95,0xbd,0x19,0x10,0xaf,0x9a,
-0x3b,0x90,0xff,0xf5,0x00,0x00,0x8f,0xff,0xff,0x40,0x06,0x2f,0x01,0x10,0x0e,0xb2,
-0x00,0x51,0x03,0x66,0x66,0x66,0x62,0x6f,0x00,0xa1,0x0f,0xff,0xff,0xff,0xfb,0x06,
-0x88,0x88,0x88,0x84,0xd7,0x02,0xf2,0x07,0xc7,0x00,0x1d,0xf5,0x01,0xdf,0x50,0x1d,
-0xf5,0x00,0x4f,0xd0,0x00,0x06,0xfc,0x00,0x00,0x6f,0xc0,0x00,0x06,0xf9,0x3d,0x2b,
-0xf0,0x07,0x3e,0x30,0x00,0x2e,0xf3,0x00,0x02,0xef,0x30,0x00,0x2e,0xe3,0x00,0x09,
-0xf8,0x00,0x8f,0xa0,0x08,0xfa,0x00,0x5f,0xb1,0x51,0x03,0x6c,0x0e,0xf0,0x02,0x8f,
-0x40,0x00,0x00,0x09,0xf5,0x00,0x00,0x00,0x9f,0x50,0x00,0x9b,0xbd,0xfc,0xbb,0x6f,
-0x5c,0x00,0x50,0x13,0x3a,0xf7,0x33,0x10,0x12,0x00,0x02,0x1b,0x00,0x80,0x39,0x10,
-0x00,0xbd,0xdd,0xdd,0xdd,0x8e,0x86,0x00,0x03,0xef,0x27,0xf0,0x1e,0x8a,0x95,0x00,
-0x00,0x01,0xcf,0x84,0x6e,0xe3,0x00,0x1e,0xf5,0x08,0x72,0xff,0x40,0xbf,0xe0,0x2d,
-0xf5,0xbf,0xe0,0xdf,0xe3,0xff,0xf6,0xaf,0xf1,0x4f,0xf3,0xaf,0xd1,0xef,0x70,0x05,
-0xfd,0x31,0x2b,0xf7,0x00,0x00,0x19,0xdf,0xea,0x30,0x68,0x4b,0x01,0xcd,0x19,0xf2,
-0x23,0x16,0xaa,0x83,0x00,0x00,0x03,0xef,0xe6,0x49,0xfb,0x00,0x00,0x01,0xbe,0x49,
-0x28,0xfd,0x00,0x1d,0x40,0x8f,0xfe,0x1f,0xf9,0x04,0xff,0x50,0x5f,0xf1,0xff,0xb0,
-0x0a,0xfc,0x00,0x2d,0xdf,0xf2,0x00,0x0a,0xfa,0x10,0x1b,0xf7,0x00,0x00,0x04,0xbe,
-0xe4,0x08,0xf7,0x6e,0x00,0x15,0xf5,0xf5,0x08,0x21,0x02,0xe6,0x0b,0x00,0x11,0xbf,
-0x61,0x3e,0x11,0x4f,0xb3,0x04,0x30,0x0d,0xe7,0xcf,0xd7,0x11,0x20,0xfc,0x08,0x55,
-0x00,0xf0,0x0b,0xef,0xd0,0x9f,0xf4,0x00,0x00,0x9f,0xff,0x5c,0xff,0xd0,0x00,0x2f,
-0xff,0xe1,0xaf,0xff,0x60,0x0b,0xff,0xfe,0x2b,0xff,0xfe,0x00,0xef,0x89,0x01,0x76,
-0xf2,0x01,0x33,0x33,0x33,0x33,0x32,0x6f,0x1e,0xf0,0x15,0xc1,0xef,0xd1,0x03,0xef,
-0xfc,0x99,0xfb,0x2e,0xec,0xf8,0x00,0x54,0xde,0x25,0x70,0x00,0x0c,0xf4,0x01,0x10,
-0x00,0xbf,0x5c,0x78,0xd1,0xff,0xf6,0x0a,0xff,0xfd,0x78,0x60,0x00,0x7c,0xf6,0xe9,
-0x0c,0x12,0x60,0x48,0x2e,0x00,0x9a,0x01,0xf0,0x19,0xaf,0xef,0x60,0x00,0xaf,0x90,
-0xcf,0x60,0x9f,0x80,0x00,0xcf,0x57,0x80,0x00,0x00,0xa4,0x11,0x00,0x00,0x02,0x0c,
-0xe2,0x00,0x05,0xf8,0x3f,0xe2,0x05,0xfd,0x10,0x3f,0xe7,0xfd,0x10,0x00,0x3f,0xfd,
-0x10,0x00,0x33,0x18,0x12,0x00,0x5b,0x11,0xf0,0x07,0xcf,0xc3,0xff,0xff,0xf5,0x00,
-0xbe,0xfe,0xb3,0x44,0x4e,0x60,0x04,0x3f,0x34,0x00,0x00,0xd6,0x00,0x02,0xf2,0x00,
-0xf2,0x56,0xf0,0x07,0x2f,0x20,0x00,0x8c,0xea,0xf1,0x01,0xff,0xff,0xf7,0xdf,0xf7,
-0x00,0x04,0x44,0x44,0x11,0xc7,0x00,0x58,0x88,0x20,0xb0,0x02,0x50,0xe4,0x44,0x41,
-0xff,0xff,0x3b,0x05,0x0e,0x01,0x00,0x02,0x59,0x02,0x02,0xe4,0x22,0xa0,0x03,0xff,
-0x40,0x00,0x00,0x3f,0xff,0xf4,0x00,0x02,0xe4,0x05,0x92,0x00,0x36,0xff,0x63,0x00,
-0x00,0x04,0xff,0x40,0x05,0x00,0xb6,0x9a,0xa5,0xff,0x5a,0xa9,0xff,0xff,0xdd,0xfe,
-0xdf,0xff,0x5c,0x04,0x00,0xdb,0x4a,0x00,0xc2,0x03,0x20,0x5f,0xff,0x64,0x05,0x20,
-0xff,0xe0,0xdb,0x04,0x11,0xfa,0xa6,0x00,0x10,0x50,0x16,0x00,0xb0,0xd0,0x00,0x39,
-0x10,0x4f,0xf4,0x00,0xbf,0xfc,0x9f,0xf6,0xdc,0x02,0x50,0xe4,0x00,0x00,0x9f,0xfd,
-0x3e,0x40,0x15,0x31,0xe2,0x24,0xf5,0x30,0xfe,0x30,0x05,0xc6,0xe7,0xbb,0x05,0xff,
-0x4d,0xbd,0xb4,0xff,0x40,0x3c,0xff,0xff,0x40,0x00,0x08,0xff,0xb0,0x00,0x6f,0xff,
-0xdf,0x80,0x0e,0x7b,0xb2,0xef,0x80,0xdb,0xd9,0x02,0xef,0x73,0xca,0x10,0x02,0x72,
-0x00,0x5d,0xdd,0x48,0x00,0x08,0xff,0xf6,0xf8,0xcc,0x8f,0xff,0x84,0x3f,0xe8,0xff,
-0xff,0xfc,0xfe,0x8f,0xff,0xff,0xcf,0x09,0x00,0x10,0xe7,0x1e,0x03,0x40,0x46,0x66,
-0x66,0x3f,0xe7,0x04,0x40,0x34,0x44,0x43,0x00,0x57,0x42,0xf1,0x05,0x00,0x0e,0xff,
-0xff,0xfe,0x20,0xf5,0x22,0x22,0xfe,0x1f,0x40,0x00,0x0e,0xf8,0xf7,0x44,0x44,0xff,
-0x9f,0x62,0x03,0xf0,0x07,0xf6,0x0c,0xff,0x9f,0xff,0x20,0x9f,0xf9,0xff,0xfc,0x7f,
-0xff,0x9a,0xdd,0xdd,0xdd,0xd4,0x67,0x77,0x77,0x77,0x4e,0xad,0x02,0x01,0x95,0x00,
-0x00,0xd9,0x07,0x00,0xe3,0x01,0x01,0x35,0x0e,0x50,0x45,0x55,0x55,0x55,0x3f,0x1b,
-0x00,0x00,0x09,0x1f,0x20,0x00,0x58,0x29,0x03,0x01,0x38,0x01,0x00,0xdc,0x02,0xf7,
-0x00,0xf6,0xc5,0xdf,0xff,0xfd,0x5c,0xfe,0x6a,0xff,0xa5,0xef,0xff,0xf9,0x55,0x9f,
-0x51,0x01,0xf0,0x06,0x03,0xaa,0xa2,0x00,0x07,0xff,0xf2,0x00,0x09,0xff,0xd0,0x00,
-0x0b,0xff,0xd8,0x81,0x0e,0xff,0xff,0xe1,0x0e,0xac,0x05,0xe1,0x05,0xfd,0x00,0x00,
-0x09,0xf4,0x00,0x00,0x0d,0xa0,0x00,0x00,0x0f,0x20,0xa5,0x03,0xf1,0x23,0x01,0x79,
-0x11,0x00,0x0f,0xfc,0x9f,0xf4,0x00,0xff,0xfd,0xcc,0x30,0x0f,0xfa,0x79,0x93,0x40,
-0xff,0x8e,0xff,0x6f,0x5f,0xf8,0xef,0xf7,0x64,0xff,0x8e,0xff,0xff,0xcf,0xf8,0xef,
-0xff,0xfc,0x46,0x3e,0xff,0xff,0xc0,0x00,0xdf,0xff,0xfc,0x00,0x02,0x44,0x44,0x20,
-0xa9,0x50,0x50,0x02,0xaf,0x81,0x00,0x02,0x58,0x52,0x80,0x9f,0xff,0xff,0x50,0x0c,
-0xff,0xff,0xf8,0x97,0x02,0x51,0xa0,0x3f,0xff,0xff,0xfe,0xd8,0x03,0x10,0x46,0xfc,
-0x22,0x32,0x00,0xbf,0x70,0x0e,0x41,0x00,0x2f,0x05,0x21,0x44,0x30,0xa0,0x00,0xf4,
-0x0f,0xf3,0xf4,0xa0,0xa0,0xb0,0xb0,0xf4,0xff,0xbe,0xae,0xae,0xaf,0xf4,0xff,0x3a,
-0x0a,0x0a,0x0f,0xf4,0xfb,0xea,0xaa,0xaa,0xea,0xf4,0xf7,0xb4,0x44,0x44,0xc4,0x06,
-0x06,0x00,0x1b,0x1c,0x10,0x70,0x42,0x22,0x00,0xd5,0x01,0xb0,0x4b,0xff,0xff,0x70,
-0x00,0x5d,0xff,0xff,0xff,0x10,0x0c,0x5b,0x00,0x60,0x00,0x0a,0xee,0xef,0xff,0xf2,
-0xd0,0x0c,0x21,0xff,0xa0,0x06,0x00,0x10,0x30,0x06,0x00,0x11,0xfb,0x47,0x0c,0x14,
+0x09,0xfd,0x89,0xef,0x50,0x00,0x6d,0xff,0xc4,0x43,0x01,0xf9,0x22,0x01,0x88,0x10,
+0x00,0x00,0x05,0xff,0x40,0x00,0x1e,0xcf,0xff,0xfc,0xd0,0x7f,0xff,0xdd,0xff,0xf7,
+0x2d,0xfa,0x00,0xbf,0xd1,0x0b,0xf7,0x00,0x8f,0xa0,0x6f,0xfe,0x55,0xef,0xf6,0x4f,
+0xff,0xff,0xff,0xf3,0x06,0x3a,0xff,0xa3,0x60,0x00,0x03,0xff,0x30,0x00,0x01,0x00,
+0xf7,0x2e,0x6f,0x90,0xf8,0x00,0x00,0x09,0xf8,0xec,0xf8,0x00,0x01,0xbe,0x5a,0x5c,
+0xf8,0x00,0x2d,0xd5,0xef,0xf6,0xaf,0x50,0xda,0x6f,0xff,0xff,0x87,0xf1,0x11,0xff,
+0xff,0xff,0xf5,0x10,0x02,0xff,0xc3,0x9f,0xf6,0x00,0x02,0xff,0xb0,0x7f,0xf6,0x00,
+0x01,0xbb,0x70,0x4b,0xb3,0x00,0x00,0x00,0x88,0x20,0x00,0x00,0x01,0xff,0x60,0x05,
+0x00,0x90,0x01,0xff,0xff,0xff,0x60,0x00,0x5f,0xff,0xfa,0x8c,0x00,0xf3,0x02,0xb0,
+0x00,0x8b,0xb9,0x8b,0x8b,0xb9,0xdf,0xff,0xff,0xfe,0xdf,0xcf,0xff,0xff,0xfc,0xbe,
+0xba,0x02,0xf0,0x14,0x44,0x44,0x30,0x00,0x01,0xef,0xff,0xff,0xf4,0x00,0x0b,0xc0,
+0x00,0x00,0x8e,0x10,0x6e,0x10,0x00,0x00,0x0c,0xa0,0xee,0xcb,0x10,0x0a,0xcd,0xf2,
+0xff,0xff,0xb8,0x9f,0xff,0xf4,0xff,0x01,0x00,0x20,0xf4,0xcf,0x06,0x00,0xf2,0x25,
+0xe1,0x00,0x04,0x87,0x30,0x5f,0x02,0xdf,0xfe,0xfc,0x7f,0x1e,0xd3,0x00,0x3c,0xff,
+0x9f,0x10,0x05,0xfe,0xff,0x44,0x00,0x02,0x66,0x66,0x12,0x22,0x00,0x00,0x11,0xff,
+0xff,0x50,0x00,0xda,0xff,0xa3,0x10,0x08,0xf4,0xfc,0xfb,0x66,0xbf,0x80,0xf5,0x4c,
+0xff,0xd5,0x00,0x31,0x68,0x00,0x63,0x70,0x00,0xbf,0xab,0xdf,0xff,0x01,0x00,0x50,
+0x00,0x3e,0xf0,0x00,0x2c,0x14,0x00,0xf0,0x05,0x00,0x0b,0xf0,0x00,0xab,0xdf,0xf0,
+0x20,0xff,0xff,0xf0,0xa6,0xff,0xff,0xf0,0x59,0xff,0xff,0xf0,0x92,0x1d,0x00,0x31,
+0x00,0x02,0xc0,0x36,0x00,0x11,0x40,0x3a,0x00,0x10,0xaa,0x28,0x00,0x90,0x0a,0x4a,
+0x70,0xab,0xdf,0xf0,0x23,0xe2,0xe0,0x2c,0x00,0x20,0x95,0xc2,0x2e,0x00,0x20,0x76,
+0xc3,0x30,0x00,0xe0,0xc3,0xe1,0x00,0x3e,0xf0,0x09,0xa6,0xb0,0x00,0x02,0xc0,0x03,
+0x3e,0x20,0x36,0x00,0x10,0xc3,0xd6,0x00,0x40,0x44,0x42,0xff,0xef,0x64,0x01,0xf0,
+0x09,0x0d,0xff,0xef,0xff,0xf8,0x4e,0xfe,0x25,0xff,0xff,0x9d,0xe2,0x00,0x6f,0xf9,
+0x01,0x20,0x00,0x4f,0xf7,0x44,0x44,0x44,0x7f,0xd0,0x00,0xf1,0x17,0xfc,0x00,0x1a,
+0x00,0x00,0x07,0xf5,0x00,0x00,0xef,0xc0,0x00,0x8f,0xff,0x60,0x3f,0xff,0xff,0x1b,
+0xff,0xff,0xf9,0xfb,0xff,0xff,0xdd,0x6e,0xff,0xfc,0x7e,0x59,0xff,0x60,0x9f,0xff,
+0x80,0x00,0x13,0xa8,0x02,0xf0,0x3a,0x0e,0x70,0x03,0xe4,0xe7,0x04,0xff,0x5e,0x75,
+0xff,0xf5,0xec,0xff,0xff,0x5e,0xff,0xff,0xf5,0xea,0xef,0xff,0x5e,0x71,0xdf,0xf5,
+0xe7,0x01,0xcf,0x59,0x50,0x00,0x92,0x88,0x00,0x00,0x00,0x0f,0xfe,0x50,0x00,0x00,
+0xff,0xff,0xc3,0x00,0x0f,0xff,0xff,0xf9,0x10,0xff,0xff,0xff,0xfe,0x5f,0xff,0xff,
+0xff,0xfa,0xff,0xff,0xff,0xf8,0x0f,0xff,0xff,0xb2,0x00,0xff,0xfd,0x40,0x00,0x0e,
+0x77,0x02,0x14,0x11,0xea,0x01,0xef,0x0d,0xff,0x90,0xdf,0xf9,0xff,0xfc,0x0f,0xff,
+0xcf,0xff,0xc0,0xff,0xfc,0x09,0x00,0x00,0x82,0xfb,0x0f,0xff,0xb8,0xbb,0x50,0x8b,
+0xb5,0x2d,0x00,0x30,0xff,0xff,0xf9,0x3f,0x01,0x01,0xbb,0x00,0x0f,0x09,0x00,0x03,
+0x40,0xb8,0xbb,0xbb,0xbb,0x2d,0x00,0xf0,0x14,0x0b,0xa0,0x00,0xe7,0xcf,0xb0,0x0e,
+0x7c,0xff,0xc1,0xe7,0xcf,0xff,0xdf,0x7c,0xff,0xff,0xf7,0xcf,0xff,0x9e,0x7c,0xff,
+0x70,0xe7,0xcf,0x60,0x0e,0x77,0x50,0x00,0x95,0x00,0x00,0x02,0x53,0x00,0xe0,0xaf,
+0x60,0x00,0x00,0x09,0xff,0xf5,0x00,0x00,0x8f,0xff,0xff,0x40,0x06,0x2f,0x01,0x10,
+0x0e,0xb2,0x00,0x51,0x03,0x66,0x66,0x66,0x62,0x6f,0x00,0xa1,0x0f,0xff,0xff,0xff,
+0xfb,0x06,0x88,0x88,0x88,0x84,0xd7,0x02,0xf0,0x26,0xc7,0x00,0x1d,0xf5,0x01,0xdf,
+0x50,0x1d,0xf5,0x00,0x4f,0xd0,0x00,0x06,0xfc,0x00,0x00,0x6f,0xc0,0x00,0x06,0xf9,
+0x00,0x00,0x51,0x00,0x00,0x00,0x3e,0x30,0x00,0x2e,0xf3,0x00,0x02,0xef,0x30,0x00,
+0x2e,0xe3,0x00,0x09,0xf8,0x00,0x8f,0xa0,0x08,0xfa,0x00,0x5f,0xa0,0x00,0x06,0x3a,
+0x00,0x00,0x44,0x01,0xf0,0x02,0x8f,0x40,0x00,0x00,0x09,0xf5,0x00,0x00,0x00,0x9f,
+0x50,0x00,0x9b,0xbd,0xfc,0xbb,0x6f,0x5c,0x00,0x50,0x13,0x3a,0xf7,0x33,0x10,0x12,
+0x00,0x02,0x1b,0x00,0x80,0x39,0x10,0x00,0xbd,0xdd,0xdd,0xdd,0x8e,0x86,0x00,0x02,
+0x23,0x01,0xf2,0x20,0x04,0x8a,0x95,0x00,0x00,0x01,0xcf,0x84,0x6e,0xe3,0x00,0x1e,
+0xf5,0x08,0x72,0xff,0x40,0xbf,0xe0,0x2d,0xf5,0xbf,0xe0,0xdf,0xe3,0xff,0xf6,0xaf,
+0xf1,0x4f,0xf3,0xaf,0xd1,0xef,0x70,0x05,0xfd,0x31,0x2b,0xf7,0x00,0x00,0x19,0xdf,
+0xea,0x30,0x00,0xc5,0x04,0xf2,0x25,0x06,0xfa,0x16,0xaa,0x83,0x00,0x00,0x03,0xef,
+0xe6,0x49,0xfb,0x00,0x00,0x01,0xbe,0x49,0x28,0xfd,0x00,0x1d,0x40,0x8f,0xfe,0x1f,
+0xf9,0x04,0xff,0x50,0x5f,0xf1,0xff,0xb0,0x0a,0xfc,0x00,0x2d,0xdf,0xf2,0x00,0x0a,
+0xfa,0x10,0x1b,0xf7,0x00,0x00,0x04,0xbe,0xe4,0x08,0xf7,0x6e,0x00,0x11,0xf5,0xc0,
+0x03,0x00,0xa0,0x05,0x21,0x02,0xe6,0x0b,0x00,0x20,0xbf,0xe1,0x06,0x00,0x11,0x4f,
+0xb3,0x04,0x90,0x0d,0xe7,0xcf,0x20,0x00,0x00,0x07,0xfc,0x08,0x55,0x00,0xf0,0x0b,
+0xef,0xd0,0x9f,0xf4,0x00,0x00,0x9f,0xff,0x5c,0xff,0xd0,0x00,0x2f,0xff,0xe1,0xaf,
+0xff,0x60,0x0b,0xff,0xfe,0x2b,0xff,0xfe,0x00,0xef,0x89,0x01,0x75,0xf2,0x01,0x33,
+0x33,0x33,0x33,0x32,0xd4,0x03,0xf3,0x1e,0x07,0xc1,0xef,0xd1,0x03,0xef,0xfc,0x99,
+0xfb,0x2e,0xec,0xf8,0x00,0x54,0xde,0x25,0x70,0x00,0x0c,0xf4,0x01,0x10,0x00,0xbf,
+0x5c,0x78,0xd1,0xff,0xf6,0x0a,0xff,0xfd,0x78,0x60,0x00,0x7c,0xf6,0x00,0x00,0x00,
+0x05,0x60,0x00,0x00,0x30,0x9a,0x01,0xf1,0x1f,0xaf,0xef,0x60,0x00,0xaf,0x90,0xcf,
+0x60,0x9f,0x80,0x00,0xcf,0x57,0x80,0x00,0x00,0xa4,0x11,0x00,0x00,0x02,0x0c,0xe2,
+0x00,0x05,0xf8,0x3f,0xe2,0x05,0xfd,0x10,0x3f,0xe7,0xfd,0x10,0x00,0x3f,0xfd,0x10,
+0x00,0x00,0x3b,0x10,0x00,0x00,0x80,0x67,0x00,0xf0,0x21,0xcf,0xc3,0xff,0xff,0xf5,
+0x00,0xbe,0xfe,0xb3,0x44,0x4e,0x60,0x04,0x3f,0x34,0x00,0x00,0xd6,0x00,0x02,0xf2,
+0x00,0x00,0x0d,0x60,0x00,0x2f,0x20,0x00,0x8c,0xea,0xf1,0x01,0xff,0xff,0xf7,0xdf,
+0xf7,0x00,0x04,0x44,0x44,0x11,0xc7,0x00,0x58,0x88,0x20,0xb0,0x02,0x50,0xe4,0x44,
+0x41,0xff,0xff,0x3b,0x05,0x1e,0xff,0x01,0x00,0x02,0x26,0x03,0xf0,0x00,0x00,0x33,
+0x00,0x00,0x00,0x03,0xff,0x40,0x00,0x00,0x3f,0xff,0xf4,0x00,0x02,0xe4,0x05,0x92,
+0x00,0x36,0xff,0x63,0x00,0x00,0x04,0xff,0x40,0x05,0x00,0xb5,0x9a,0xa5,0xff,0x5a,
+0xa9,0xff,0xff,0xdd,0xfe,0xdf,0xff,0x5c,0x04,0x00,0x01,0x00,0x10,0xa8,0xc2,0x03,
+0x20,0x5f,0xff,0x64,0x05,0x20,0xff,0xe0,0xdb,0x04,0x11,0xfa,0xa6,0x00,0x10,0x50,
+0x16,0x00,0xb0,0xd0,0x00,0x39,0x10,0x4f,0xf4,0x00,0xbf,0xfc,0x9f,0xf6,0xdc,0x02,
+0xa4,0xe4,0x00,0x00,0x9f,0xfd,0x81,0x00,0x00,0x01,0x31,0x3d,0x00,0xf5,0x31,0x06,
+0xfe,0x30,0x05,0xc6,0xe7,0xbb,0x05,0xff,0x4d,0xbd,0xb4,0xff,0x40,0x3c,0xff,0xff,
+0x40,0x00,0x08,0xff,0xb0,0x00,0x6f,0xff,0xdf,0x80,0x0e,0x7b,0xb2,0xef,0x80,0xdb,
+0xd9,0x02,0xef,0x73,0xca,0x10,0x02,0x72,0x00,0x5d,0xdd,0x48,0x00,0x08,0xff,0xf6,
+0xf8,0xcc,0x8f,0xff,0x84,0x3f,0xe8,0xff,0xff,0xfc,0xfe,0x8f,0xff,0xff,0xcf,0x09,
+0x00,0x10,0xe7,0x1e,0x03,0x40,0x46,0x66,0x66,0x3f,0xe7,0x04,0xf1,0x0d,0x34,0x44,
+0x43,0x00,0x00,0x02,0x22,0x22,0x00,0x0e,0xff,0xff,0xfe,0x20,0xf5,0x22,0x22,0xfe,
+0x1f,0x40,0x00,0x0e,0xf8,0xf7,0x44,0x44,0xff,0x9f,0x62,0x03,0xf0,0x07,0xf6,0x0c,
+0xff,0x9f,0xff,0x20,0x9f,0xf9,0xff,0xfc,0x7f,0xff,0x9a,0xdd,0xdd,0xdd,0xd4,0x67,
+0x77,0x77,0x77,0x4e,0xad,0x02,0x01,0x95,0x00,0x00,0xd9,0x07,0x00,0xe3,0x01,0x10,
+0xb0,0x0e,0x00,0x50,0x45,0x55,0x55,0x55,0x3f,0x1b,0x00,0x60,0x11,0x11,0x11,0x11,
+0x00,0x58,0x29,0x03,0x01,0x38,0x01,0x00,0xdc,0x02,0xf7,0x00,0xf6,0xc5,0xdf,0xff,
+0xfd,0x5c,0xfe,0x6a,0xff,0xa5,0xef,0xff,0xf9,0x55,0x9f,0x51,0x01,0xf0,0x06,0x03,
+0xaa,0xa2,0x00,0x07,0xff,0xf2,0x00,0x09,0xff,0xd0,0x00,0x0b,0xff,0xd8,0x81,0x0e,
+0xff,0xff,0xe1,0x0e,0xac,0x05,0xe1,0x05,0xfd,0x00,0x00,0x09,0xf4,0x00,0x00,0x0d,
+0xa0,0x00,0x00,0x0f,0x20,0xa5,0x03,0xf0,0x2b,0x01,0x79,0x11,0x00,0x0f,0xfc,0x9f,
+0xf4,0x00,0xff,0xfd,0xcc,0x30,0x0f,0xfa,0x79,0x93,0x40,0xff,0x8e,0xff,0x6f,0x5f,
+0xf8,0xef,0xf7,0x64,0xff,0x8e,0xff,0xff,0xcf,0xf8,0xef,0xff,0xfc,0x46,0x3e,0xff,
+0xff,0xc0,0x00,0xdf,0xff,0xfc,0x00,0x02,0x44,0x44,0x20,0x00,0x01,0x90,0x00,0x00,
+0x02,0xaf,0x81,0xa9,0x01,0xa0,0xd0,0x00,0x9f,0xff,0xff,0x50,0x0c,0xff,0xff,0xf8,
+0x97,0x02,0x51,0xa0,0x3f,0xff,0xff,0xfe,0xd8,0x03,0x00,0xdc,0x07,0x51,0x20,0x00,
+0xbf,0x70,0x00,0x6e,0x02,0x00,0x2f,0x05,0x21,0x44,0x30,0xa0,0x00,0xf3,0x0f,0xf3,
+0xf4,0xa0,0xa0,0xb0,0xb0,0xf4,0xff,0xbe,0xae,0xae,0xaf,0xf4,0xff,0x3a,0x0a,0x0a,
+0x0f,0xf4,0xfb,0xea,0xaa,0xaa,0xea,0xf4,0xf7,0xb4,0x44,0x44,0xc4,0x06,0x06,0x00,
+0xfa,0x00,0x10,0x29,0x3c,0x00,0x10,0x3a,0xd5,0x01,0xb0,0x4b,0xff,0xff,0x70,0x00,
+0x5d,0xff,0xff,0xff,0x10,0x0c,0x5b,0x00,0xc1,0x00,0x0a,0xee,0xef,0xff,0xf2,0x00,
+0x00,0x00,0x0a,0xff,0xa0,0x06,0x00,0x10,0x30,0x06,0x00,0x01,0x3c,0x01,0x24,0x08,
 0xf4,0x61,0x08,0xf0,0x01,0xef,0xff,0x5b,0x00,0xff,0xff,0x6f,0xb0,0xff,0xff,0x68,
-0x83,0xff,0xff,0xfd,0xd6,0x24,0x05,0x1e,0xff,0x04,0x00,0x26,0xf7,0x00,0x9e,0x10,
-0xe0,0x05,0xbf,0xff,0xfd,0x81,0x00,0x2c,0xfe,0xa8,0x78,0xcf,0xf7,0x0d,0xf7,0x34,
-0x41,0xe0,0xf5,0x22,0x05,0xbe,0xfd,0x81,0x05,0x00,0x09,0xfe,0xa9,0xcf,0xe2,0x00,
-0x13,0x42,0x00,0x39,0x2f,0x03,0x68,0x2a,0x22,0x0f,0xf7,0x6b,0x35,0x51,0x10,0x00,
-0x00,0xcf,0xff,0xcb,0x04,0xd0,0x75,0x55,0x55,0x55,0x5a,0xf2,0xf6,0xff,0xff,0xff,
-0xfd,0x4f,0x5f,0xa1,0x01,0x91,0xd1,0xf5,0xf5,0x77,0x77,0x77,0x76,0x8f,0x4f,0xfa,
-0x00,0x11,0xd0,0x06,0x01,0x17,0x41,0x2e,0x00,0x21,0x54,0x4a,0x2e,0x00,0x11,0x00,
-0x2e,0x00,0x21,0xf0,0x01,0x2e,0x00,0x1f,0x00,0x2e,0x00,0x05,0x21,0x54,0x44,0x2e,
-0x00,0x11,0x20,0x2e,0x00,0x21,0xf2,0x00,0x2e,0x00,0x1f,0x10,0x2e,0x00,0x05,0x21,
-0x54,0x44,0x2e,0x00,0x20,0x50,0x00,0x2e,0x00,0x21,0xf5,0x00,0x2e,0x00,0x2f,0x20,
-0x00,0x2e,0x00,0x02,0x40,0xfa,0x0f,0x74,0x44,0x2e,0x00,0x11,0xf4,0x87,0x04,0x11,
-0x5f,0x35,0x3c,0x11,0xf5,0x0d,0x00,0x0b,0x2e,0x00,0x00,0x65,0x51,0x01,0x98,0x12,
-0x21,0xbd,0xf4,0x39,0x13,0x60,0x03,0x00,0x00,0x0a,0xf7,0x39,0x7e,0x41,0xa1,0xff,
-0xea,0xbf,0xaa,0xaa,0xdf,0x45,0xa3,0x00,0x93,0x23,0x13,0x31,0x01,0xb8,0xfb,0xa0,
-0x0d,0x25,0x9f,0xb0,0x07,0x14,0xf2,0x1c,0x6b,0xca,0x40,0x00,0x9f,0xf6,0xff,0x40,
-0x1f,0xff,0x26,0xfb,0x04,0xf6,0xb4,0x6b,0xf0,0x6f,0xf4,0x06,0xff,0x06,0xff,0x90,
-0xbf,0xf0,0x5f,0x95,0x34,0xcf,0x02,0xfb,0xf3,0x4d,0xc0,0x0c,0xff,0x3d,0xf7,0x00,
-0x1b,0xfe,0xf9,0x32,0x00,0x50,0x12,0x3b,0xca,0x22,0x1f,0xf8,0x02,0x50,0x36,0x66,
-0x66,0x66,0x16,0xf0,0x04,0x8a,0x6f,0x6f,0x6f,0x7f,0x26,0xf6,0xf6,0xf7,0x09,0x00,
-0x91,0x24,0xff,0xff,0xff,0xf1,0x03,0x44,0x44,0x42,0x6b,0x00,0x01,0x2a,0x32,0x20,
-0x9f,0xf8,0x7d,0x45,0xc0,0xef,0xe0,0x00,0x00,0xbf,0xe5,0xd4,0x00,0x00,0xbf,0xff,
-0xe0,0x05,0x00,0x13,0xf4,0x05,0x00,0x30,0xaf,0xff,0xf4,0xea,0x06,0x10,0xf4,0xee,
-0x09,0x12,0xf4,0x46,0x0e,0x01,0x00,0x12,0x00,0xa0,0x0d,0x30,0x00,0x08,0xff,0x57,
-0x03,0xf0,0x13,0x08,0xff,0xf9,0x6f,0x69,0xff,0x88,0xff,0xff,0xc1,0x21,0xcf,0xf8,
-0xdf,0xff,0xff,0x50,0x5f,0xff,0x82,0xef,0xff,0x71,0x91,0x7f,0xf8,0x02,0xef,0xfe,
-0xdf,0xde,0xff,0x70,0x02,0x85,0x04,0xf0,0x02,0xe3,0x01,0xdf,0xff,0xe5,0x1d,0x6c,
-0x5a,0xab,0xdf,0x3b,0x18,0x8b,0xff,0xdf,0xde,0xeb,0xae,0x00,0x0c,0x04,0x00,0x45,
-0xbf,0xff,0xff,0xf6,0x7f,0x0f,0xc0,0x00,0x08,0x10,0x00,0x07,0xf0,0x0b,0xf2,0x00,
-0x00,0x8f,0x0b,0x69,0x00,0x95,0xf0,0x7f,0xfa,0x99,0x99,0x99,0x00,0x6f,0x20,0xad,
-0x44,0x09,0x01,0x00,0x2f,0xfd,0x00,0x01,0x00,0x56,0x04,0x5d,0x53,0x17,0xf7,0x14,
-0x00,0x76,0xfc,0xfb,0x00,0xfe,0xfb,0x00,0xfa,0x74,0x51,0x0f,0x01,0x00,0x4c,0x00,
-0xb5,0x3f,0x1f,0x02,0x69,0x00,0x52,0x2f,0xf3,0x00,0x01,0x00,0x68,0x1f,0xef,0x71,
-0x00,0x5d,0x03,0xd4,0x01,0xc2,0xfb,0x00,0xff,0x00,0x00,0xf6,0xff,0xf9,0xfb,0x00,
-0xf9,0x00,0xec,0x0c,0x00,0x9b,0x07,0x2f,0xfc,0xfd,0xde,0x01,0x51,0x6f,0xfe,0x00,
-0xfe,0x00,0x00,0xfc,0xf0,0x00,0x54,0x1c,0xfe,0x0a,0x00,0x19,0xff,0x1f,0x00,0x1f,
-0xff,0x45,0x03,0x4a,0x13,0xfe,0xee,0x00,0x3f,0xfe,0xfd,0xfe,0xe8,0x01,0x5d,0x15,
-0x02,0xe2,0x00,0x11,0xff,0xe5,0x00,0x2f,0xff,0xfe,0x83,0x00,0x4a,0x11,0xee,0x49,
-0x03,0x15,0xeb,0x77,0x00,0x00,0xf1,0x00,0x13,0xfe,0x04,0x00,0x0f,0x01,0x00,0x4c,
-0x13,0x01,0x69,0x01,0x1f,0x01,0x64,0x01,0x5b,0x1f,0xfe,0x2e,0x04,0x60,0x1b,0xfb,
-0x78,0x00,0x12,0xfe,0x60,0x01,0x3f,0xfe,0xfd,0xfb,0x72,0x00,0x45,0x14,0xe6,0x65,
-0x01,0x97,0xfb,0x00,0x00,0xeb,0xfc,0xf2,0xf5,0x00,0xed,0x92,0x06,0x2f,0xf6,0xf9,
-0xed,0x00,0x49,0x00,0x45,0x4c,0x35,0xf5,0x00,0xf0,0x33,0x04,0x21,0xff,0xff,0xaf,
-0x03,0x1f,0x01,0x81,0x06,0x54,0x10,0xfd,0x5c,0x01,0x1f,0xfd,0xe3,0x01,0x5e,0x3f,
-0xfa,0x00,0xff,0x1d,0x05,0x54,0x11,0xfd,0x80,0x06,0xa1,0xee,0x00,0x00,0xfa,0xfe,
-0xed,0xff,0x01,0x00,0x01,0x59,0x01,0xdf,0xf7,0xf8,0x00,0xf7,0xf8,0xfa,0xf7,0x00,
-0xf9,0xfa,0xfc,0xfa,0xfb,0x9c,0x04,0x47,0x66,0xee,0xfd,0x00,0x00,0xfa,0xff,0xc3,
-0x03,0x50,0xfc,0xfd,0x00,0x00,0xfc,0x2f,0x04,0x1f,0xff,0x61,0x08,0x48,0x42,0x01,
-0x00,0xf6,0xfb,0xf7,0x00,0x04,0x37,0x5a,0x04,0xa6,0x04,0x2f,0xff,0x00,0xd8,0x08,
-0x4b,0x14,0xfc,0xb8,0x03,0x15,0x01,0x3c,0x04,0x2f,0xfe,0x00,0x1d,0x05,0x4b,0xf0,
-0x00,0xfe,0x02,0xfc,0xf0,0xfc,0x00,0x00,0xf9,0xfe,0xf9,0xff,0x01,0xf9,0x01,0x01,
-0xde,0x01,0x90,0xfa,0xfb,0xfe,0xfd,0xfb,0xfd,0xfb,0xfe,0xfd,0x37,0x04,0x1f,0x01,
-0x64,0x02,0x4a,0x09,0x8c,0x05,0x03,0xee,0x00,0x0f,0x82,0x06,0x4c,0x06,0xc7,0x08,
-0x0f,0x8f,0x05,0x5a,0x0f,0x8a,0x00,0x09,0x0f,0x7a,0x06,0x61,0x11,0xff,0x28,0x05,
-0x0f,0x5b,0x01,0x44,0x0f,0x01,0x00,0x61,0x1f,0xff,0x94,0x00,0x63,0x1e,0x01,0x7e,
-0x0c,0x19,0x01,0x7a,0x01,0x1f,0x01,0x7b,0x0d,0x4a,0x0f,0x01,0x00,0x71,0x0f,0xaf,
-0x03,0x4f,0x1f,0xf5,0xdc,0x01,0x0b,0x2f,0xfe,0xff,0x32,0x0a,0x47,0x1c,0xf6,0x0e,
-0x07,0x11,0xff,0xdf,0x01,0x10,0x04,0x08,0x07,0x0f,0x68,0x01,0xbb,0x1d,0x01,0x57,
-0x02,0x00,0x15,0x0c,0x1f,0x01,0xd0,0x03,0x51,0x1f,0xf6,0xca,0x02,0x77,0x1f,0xfe,
-0xbb,0x04,0x63,0x1f,0xff,0xe3,0x00,0xcc,0x0f,0x6f,0x0a,0x18,0x1f,0xfd,0xc1,0x00,
-0x0c,0x1f,0xfe,0xef,0x12,0x42,0x2f,0xfb,0xfb,0x9f,0x0d,0x58,0x05,0x6d,0x00,0x34,
-0xfb,0xf8,0xfb,0xe0,0x04,0x1f,0xfb,0x35,0x08,0x10,0x00,0x1d,0x01,0x3f,0xfd,0xfd,
-0xfd,0x54,0x01,0x34,0x1f,0xfa,0xcb,0x01,0x6d,0x0f,0x2e,0x06,0x45,0x1e,0xf8,0xe7,
-0x00,0x0f,0x1d,0x15,0x50,0x27,0xf8,0xf8,0x45,0x38,0x0f,0x5e,0x01,0x50,0x0f,0xca,
-0x02,0x0d,0x1f,0x06,0xee,0x00,0x52,0x0f,0x1e,0x04,0x5d,0x0a,0x5c,0x02,0x1f,0xf5,
-0x9e,0x04,0x64,0x1e,0xf6,0x2f,0x04,0x0f,0x63,0x02,0x41,0x2b,0xf3,0xf0,0xca,0x02,
-0x2e,0x02,0x02,0xf6,0x00,0x0e,0x2b,0x04,0x08,0x54,0x07,0x3f,0xf2,0xf5,0xf2,0x41,
-0x03,0x1f,0x1f,0xf0,0x77,0x08,0x02,0x1f,0xf8,0xab,0x09,0x18,0x3f,0xf5,0xf5,0xf5,
-0x3f,0x0d,0x53,0x0f,0xfa,0x05,0x47,0x0f,0xbd,0x04,0x5d,0x16,0xf8,0xf1,0x65,0x0f,
-0x38,0x12,0x49,0x0f,0x98,0x04,0x63,0x52,0xf8,0xfb,0xfb,0x00,0xfb,0xf9,0x06,0x00,
-0xd0,0x01,0x23,0xf6,0xfd,0x63,0x01,0x10,0xf8,0xf7,0x00,0x1f,0xfd,0xee,0x00,0x48,
-0x0f,0xed,0x08,0x62,0x16,0xfa,0xe9,0x07,0x00,0xee,0x00,0x20,0xfb,0xfa,0x08,0x00,
-0x1f,0xfe,0xb5,0x0d,0x4e,0x13,0xfb,0xb7,0x02,0x3f,0xfd,0x02,0x02,0x92,0x14,0x5f,
-0x1f,0xfb,0x36,0x0a,0x8a,0x0f,0x6f,0x08,0x49,0x2f,0xf5,0xf8,0x64,0x02,0x62,0x1f,
-0xfa,0x66,0x00,0x5c,0x1f,0xfb,0xd5,0x08,0x58,0x18,0xfb,0xea,0x07,0x01,0x87,0x00,
-0x2f,0xfa,0xfd,0x4f,0x02,0x5b,0x1f,0xfd,0x16,0x0c,0x58,0x0c,0xdc,0x00,0x0f,0xd0,
-0x1e,0x53,0x0f,0x10,0x0c,0x23,0x1f,0xfd,0x46,0x0c,0x2e,0x2b,0x02,0x02,0x52,0x00,
-0x0f,0x7b,0x0d,0x59,0x0f,0x4e,0x13,0x67,0x1f,0xfd,0x39,0x0b,0x5a,0x2f,0xf0,0xf0,
-0xba,0x01,0x0c,0x17,0xf8,0x8d,0x00,0x18,0xfa,0x1d,0x00,0x32,0xfd,0x00,0xf2,0x6d,
-0x03,0x10,0xfd,0x6d,0x0e,0x23,0xf5,0xf8,0x04,0x0a,0x2f,0xfa,0xf6,0x87,0x05,0x34,
-0x00,0x50,0x0a,0x07,0x5e,0x03,0x00,0x62,0x04,0x13,0xfd,0xb7,0x06,0x18,0xfd,0xf4,
-0x03,0x1f,0xfb,0xc3,0x06,0x18,0x1f,0xfb,0xfe,0x05,0x63,0x2f,0xf6,0xf6,0x9c,0x06,
-0x33,0x1f,0xfb,0x04,0x0d,0x24,0x0f,0x71,0x06,0x89,0x1e,0xfb,0xc1,0x15,0x0f,0xf7,
-0x00,0x23,0x2f,0xf2,0xf3,0x19,0x15,0x12,0x26,0xfa,0xfa,0x0a,0x02,0x05,0xaa,0x00,
-0x26,0xf6,0xf8,0x6e,0x03,0x2f,0xf3,0xfa,0x6c,0x01,0x1a,0x2f,0xf5,0xf3,0xdc,0x01,
-0x1d,0x1e,0x02,0xa1,0x01,0x0f,0xad,0x01,0x1f,0x2f,0xf3,0xf2,0xfd,0x01,0x21,0x02,
-0x86,0x00,0x44,0xf6,0xfa,0xfa,0xfa,0x75,0x0a,0x24,0xf5,0xfb,0x5d,0x05,0x0f,0x77,
-0x00,0x13,0x1f,0xf3,0x61,0x03,0x0e,0x1f,0xfd,0x1c,0x00,0x07,0x05,0x05,0x01,0x2f,
-0xfe,0xf8,0xcb,0x05,0x3d,0x0f,0x71,0x08,0x42,0x2f,0xf2,0xf2,0x6f,0x03,0x27,0x12,
-0xfd,0x65,0x01,0x0f,0xdc,0x01,0x22,0x1f,0xf5,0xee,0x17,0x27,0x0e,0x53,0x02,0x0f,
-0x1b,0x0b,0x53,0x06,0xab,0x14,0x0f,0x51,0x15,0x50,0x25,0xfd,0xfd,0x32,0x22,0x08,
-0x5b,0x05,0x1f,0xf8,0xe7,0x11,0x5b,0x00,0xbc,0x10,0x1f,0xfb,0xdb,0x12,0x66,0x1f,
-0xfd,0xce,0x17,0x1b,0x1f,0xfe,0xb1,0x0d,0x2e,0x1f,0xfe,0xf9,0x06,0x47,0x0f,0x19,
-0x06,0x0e,0x1f,0xfd,0x77,0x00,0x63,0x0f,0x1b,0x18,0x58,0x1f,0xfb,0x84,0x00,0x27,
-0x0f,0x4c,0x05,0x1a,0x1f,0x03,0x77,0x00,0x36,0x2f,0xf6,0xf8,0xdc,0x01,0x35,0x1f,
-0xfe,0xca,0x02,0x55,0x0f,0x62,0x15,0x29,0x1f,0xfb,0x98,0x16,0x3c,0x0f,0x53,0x02,
-0x33,0x1f,0xf6,0xed,0x0a,0x14,0x1f,0xfb,0x77,0x00,0x3b,0x1f,0xf5,0xee,0x00,0x43,
-0x0f,0xbc,0x0f,0x29,0x1f,0xfd,0xa3,0x18,0x63,0x1f,0xf8,0xda,0x12,0x51,0x1f,0xfd,
-0x02,0x13,0x57,0x12,0xfd,0xe5,0x0d,0x1f,0xfb,0x80,0x00,0x13,0x1f,0xfd,0xe5,0x00,
-0x4f,0x1f,0x05,0xc5,0x0c,0x63,0x1f,0x05,0x78,0x00,0x05,0x1f,0x08,0xd2,0x01,0x7f,
-0x0f,0x7b,0x0d,0x17,0x1f,0xfd,0x23,0x22,0x14,0x1e,0xfb,0x2f,0x06,0x0f,0x2f,0x04,
-0x29,0x0f,0x19,0x03,0x44,0x0f,0x77,0x00,0x39,0x0f,0x2c,0x0f,0x46,0x2f,0x03,0x03,
-0x1a,0x19,0x36,0x0f,0x74,0x17,0xa2,0x09,0xa2,0x0b,0x0f,0x41,0x13,0x17,0x2f,0xf3,
-0xf3,0xb1,0x01,0x27,0x17,0xf3,0x21,0x12,0x0f,0xf2,0x11,0x1c,0x1f,0xfd,0x26,0x02,
-0x3c,0x1f,0xfd,0x7b,0x0d,0x40,0x0b,0xd9,0x21,0x4f,0xfd,0xfe,0xfe,0xfe,0x82,0x0a,
-0x24,0x2f,0xf6,0xfa,0xe0,0x23,0x88,0x1f,0xfb,0x3f,0x01,0x0e,0x1f,0xfd,0xe9,0x12,
-0x63,0x0f,0x8d,0x0c,0x3c,0x1f,0xfb,0xf4,0x03,0x09,0x1e,0xfe,0x95,0x0f,0x0f,0x04,
-0x0d,0x42,0x19,0xfd,0x38,0x10,0x17,0xf8,0xd1,0x0f,0x2f,0xfd,0xfb,0x69,0x0e,0x2b,
-0x2e,0xf6,0xf6,0xa1,0x06,0x05,0xc8,0x02,0x28,0xf8,0xf8,0x52,0x01,0x44,0xf6,0xfd,
-0xfe,0xfe,0x2f,0x04,0x26,0xfb,0xfa,0x32,0x04,0x03,0x3b,0x2b,0x21,0x02,0x03,0xa3,
-0x84,0x1e,0x04,0x9a,0x07,0x04,0x31,0x99,0x00,0x32,0x99,0x92,0x0c,0x0c,0x09,0x10,
-0x11,0x12,0x00,0x13,0x0d,0x36,0x99,0x02,0xb1,0x4f,0x70,0x1b,0x1c,0x00,0x1d,0x1e,
-0x00,0x1f,0xbb,0x3b,0xff,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,
-0x25,0x26,0x24,0x27,0x28,0xcb,0x00,0x08,0xf0,0x11,0x29,0x2a,0x2b,0x00,0x2c,0x2d,
-0x2e,0x2f,0x30,0x31,0x32,0x00,0x33,0x00,0x34,0x35,0x00,0x00,0x36,0x37,0x38,0x39,
-0x3a,0x3b,0x3c,0x00,0x3d,0x3e,0x3f,0x40,0x41,0x42,0xe3,0x85,0xf1,0x2a,0x44,0x45,
-0x46,0x47,0x48,0x00,0x49,0x31,0x4a,0x00,0x4b,0x4c,0x00,0x00,0x31,0x4d,0x4e,0x4e,
-0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x00,0x5a,0x5b,0x5c,0x5d,
-0x5e,0x5f,0x60,0x61,0x62,0x63,0x64,0x2d,0x65,0x66,0x00,0x67,0x68,0x69,0x6a,0x6a,
-0x6b,0x00,0x6c,0x6d,0x6e,0x00,0x6f,0x54,0x42,0x00,0x29,0x7d,0x30,0x2d,0x72,0x73,
-0x02,0x8a,0x8f,0x75,0x76,0x77,0x00,0x78,0x79,0x7a,0x00,0x01,0x00,0xff,0x48,0x02,
-0x46,0x02,0x20,0x03,0x02,0x41,0x02,0x3c,0x06,0x07,0x06,0xc8,0x09,0x31,0x09,0x00,
-0x0a,0x10,0x47,0x13,0x0b,0x2c,0x58,0x00,0xfc,0x69,0x00,0x81,0x9b,0x00,0x80,0x9b,
-0x02,0x3a,0x85,0x71,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xe5,0x19,0x19,
-0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0xe9,0x6d,0x0b,0x01,
-0x00,0xf1,0x03,0x24,0x00,0x25,0x26,0x27,0x28,0x00,0x29,0x00,0x2a,0x2b,0x2c,0x2d,
-0x00,0x2a,0x2a,0x00,0x00,0x4e,0x02,0x30,0x33,0x34,0x35,0x4a,0x02,0xf3,0x01,0x00,
-0x3a,0x3b,0x3c,0x3c,0x3d,0x3e,0x00,0x00,0x3f,0x00,0x00,0x40,0x41,0x00,0x42,0x4e,
-0x02,0x91,0x49,0x4a,0x00,0x4b,0x4b,0x00,0x4c,0x4d,0x00,0x4b,0x02,0x00,0x4c,0x02,
-0x01,0x4d,0x02,0x22,0x55,0x43,0x4e,0x02,0x11,0x55,0x4f,0x02,0x40,0x00,0x00,0x65,
-0x66,0x4f,0x02,0x00,0xfc,0x3c,0x01,0x50,0x02,0xdf,0x70,0x71,0x72,0x00,0x00,0x73,
-0x00,0x74,0x75,0x00,0x00,0x76,0x77,0x40,0x02,0xff,0x43,0x50,0x00,0x00,0x00,0x00,
-0x00,
+0x83,0xff,0xff,0xfd,0xd6,0x24,0x05,0x1e,0xff,0x04,0x00,0x02,0x95,0x03,0x02,0x2b,
+0x08,0xd0,0x05,0xbf,0xff,0xfd,0x81,0x00,0x2c,0xfe,0xa8,0x78,0xcf,0xf7,0x0d,0x19,
+0x00,0xf0,0x05,0x3c,0xf5,0x22,0x05,0xbe,0xfd,0x81,0x05,0x00,0x09,0xfe,0xa9,0xcf,
+0xe2,0x00,0x00,0x37,0x00,0x00,0x38,0x2e,0x00,0x11,0x8c,0x05,0x06,0x12,0x0f,0x3c,
+0x00,0x61,0x58,0x10,0x00,0x00,0xcf,0xff,0xcb,0x04,0xd0,0x75,0x55,0x55,0x55,0x5a,
+0xf2,0xf6,0xff,0xff,0xff,0xfd,0x4f,0x5f,0xa1,0x01,0x91,0xd1,0xf5,0xf5,0x77,0x77,
+0x77,0x76,0x8f,0x4f,0xfa,0x00,0x11,0xd0,0x06,0x01,0x17,0x41,0x2e,0x00,0x21,0x54,
+0x4a,0x2e,0x00,0x11,0x00,0x2e,0x00,0x21,0xf0,0x01,0x2e,0x00,0x1f,0x00,0x2e,0x00,
+0x05,0x21,0x54,0x44,0x2e,0x00,0x11,0x20,0x2e,0x00,0x21,0xf2,0x00,0x2e,0x00,0x1f,
+0x10,0x2e,0x00,0x05,0x21,0x54,0x44,0x2e,0x00,0x20,0x50,0x00,0x2e,0x00,0x21,0xf5,
+0x00,0x2e,0x00,0x2f,0x20,0x00,0x2e,0x00,0x02,0x40,0xfa,0x0f,0x74,0x44,0x2e,0x00,
+0x11,0xf4,0x87,0x04,0x30,0x5f,0x40,0x00,0x2e,0x00,0x01,0x0d,0x00,0x0a,0x2e,0x00,
+0x00,0x12,0x00,0x20,0x5b,0x10,0xa8,0x03,0x11,0xbd,0x1e,0x00,0xf1,0x0d,0xa1,0x03,
+0x00,0x00,0x0a,0xf7,0x39,0x00,0x00,0x07,0x60,0xff,0xea,0xbf,0xaa,0xaa,0xdf,0x45,
+0xa3,0x00,0x93,0x00,0x04,0x10,0x00,0x00,0x01,0xb8,0x8d,0x01,0x44,0x02,0x9f,0xb0,
+0x00,0x9b,0x05,0xf2,0x1c,0x6b,0xca,0x40,0x00,0x9f,0xf6,0xff,0x40,0x1f,0xff,0x26,
+0xfb,0x04,0xf6,0xb4,0x6b,0xf0,0x6f,0xf4,0x06,0xff,0x06,0xff,0x90,0xbf,0xf0,0x5f,
+0x95,0x34,0xcf,0x02,0xfb,0xf3,0x4d,0xc0,0x0c,0xff,0x3d,0xf7,0x00,0x1b,0xfe,0xf9,
+0x32,0x00,0x50,0x12,0x3b,0xca,0x22,0x1f,0xf8,0x02,0x50,0x36,0x66,0x66,0x66,0x16,
+0xf0,0x04,0x8a,0x6f,0x6f,0x6f,0x7f,0x26,0xf6,0xf6,0xf7,0x09,0x00,0x91,0x24,0xff,
+0xff,0xff,0xf1,0x03,0x44,0x44,0x42,0x6b,0x00,0x20,0x97,0x00,0xfe,0x05,0xf0,0x02,
+0xf8,0x00,0x00,0x00,0xa5,0xef,0xe0,0x00,0x00,0xbf,0xe5,0xd4,0x00,0x00,0xbf,0xff,
+0xe0,0x05,0x00,0x13,0xf4,0x05,0x00,0x30,0xaf,0xff,0xf4,0xea,0x06,0x00,0xc3,0x00,
+0x01,0x05,0x00,0x21,0x02,0x20,0x3a,0x00,0x80,0x05,0x88,0x88,0x88,0x86,0x00,0x08,
+0xff,0x57,0x03,0xf0,0x13,0x08,0xff,0xf9,0x6f,0x69,0xff,0x88,0xff,0xff,0xc1,0x21,
+0xcf,0xf8,0xdf,0xff,0xff,0x50,0x5f,0xff,0x82,0xef,0xff,0x71,0x91,0x7f,0xf8,0x02,
+0xef,0xfe,0xdf,0xde,0xff,0x70,0x02,0x85,0x04,0xf0,0x02,0xe3,0x01,0xdf,0xff,0xe5,
+0x1d,0x6c,0x5a,0xab,0xdf,0x3b,0x18,0x8b,0xff,0xdf,0xde,0xeb,0xae,0x00,0x0c,0x04,
+0x00,0x44,0xbf,0xff,0xff,0xf6,0x6e,0x04,0xd0,0x0a,0x00,0x08,0x10,0x00,0x07,0xf0,
+0x0b,0xf2,0x00,0x00,0x8f,0x0b,0x69,0x00,0xf0,0x03,0xf0,0x7f,0xfa,0x99,0x99,0x99,
+0x00,0x6f,0x20,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -1670,11 +1708,20 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 12527, .range_length = 51124, .glyph_id_start = 233, .list_length = 349, .type = 3, .unicode_list = 4801, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[45466] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 5555, .size = 4074, .comp_size = 3679 },
+{ .bitmap_start = 4074, .comp_offset = 9234, .size = 4059, .comp_size = 3341 },
+{ .bitmap_start = 8133, .comp_offset = 12575, .size = 4090, .comp_size = 3740 },
+{ .bitmap_start = 12223, .comp_offset = 16315, .size = 4090, .comp_size = 3820 },
+{ .bitmap_start = 16313, .comp_offset = 20135, .size = 4070, .comp_size = 3879 },
+{ .bitmap_start = 20383, .comp_offset = 24014, .size = 3542, .comp_size = 3086 },
+};
+
+static uint8_t etxUncompBuf[21541] __SDRAMFONTS;
 
 const etxLz4Font lv_font_jp_XS = {
-.uncomp_size = 45106,
-.comp_size = 26481,
+.uncomp_size = 21181,
+.comp_size = 5555,
 .line_height = 13,
 .base_line = 3,
 .subpx = 0,
@@ -1687,12 +1734,13 @@ const etxLz4Font lv_font_jp_XS = {
 .bitmap_format = 0,
 .left_class_cnt = 122,
 .right_class_cnt = 119,
-.glyph_bitmap = 5499,
-.class_pair_values = 29424,
-.left_class_mapping = 43942,
-.right_class_mapping = 44524,
+.class_pair_values = 5499,
+.left_class_mapping = 20017,
+.right_class_mapping = 20599,
+.block_num = 6,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 45466,
+.lvglFontBufSize = 21541,
 };
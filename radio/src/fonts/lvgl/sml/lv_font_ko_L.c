@@ -190,7 +190,7 @@ static const uint8_t lz4FontData[] ={
 0x70,0x00,0x22,0x17,0xf4,0x08,0x00,0x13,0xaf,0x08,0x00,0x22,0x47,0xf5,0x08,0x00,
 0x22,0xdf,0xf5,0x70,0x00,0x22,0x54,0xf6,0x08,0x03,0x22,0xc5,0xf6,0x40,0x00,0x22,
 0x54,0xf7,0x78,0x00,0x22,0xd9,0xf7,0x10,0x00,0x22,0x68,0xf8,0x70,0x00,0x23,0xe4,
-0xf8,0x88,0x0b,0xf1,0xff,0xff,0xff,0xbf,0x00,0x50,0xab,0x54,0xab,0x58,0xab,0x60,
+0xf8,0x88,0x0b,0xf8,0xff,0xff,0xff,0x7c,0x00,0x50,0xab,0x54,0xab,0x58,0xab,0x60,
 0xab,0x62,0xab,0x65,0xab,0x69,0xab,0x6c,0xab,0x81,0xab,0xc0,0xab,0xc4,0xab,0xd0,
 0xab,0xdc,0xab,0xf0,0xab,0xf8,0xab,0xf9,0xab,0x00,0xac,0x0d,0xac,0x14,0xac,0x30,
 0xac,0x31,0xac,0x41,0xac,0x45,0xac,0x4c,0xac,0x50,0xac,0xa0,0xac,0xbc,0xac,0xbd,
@@ -246,384 +246,433 @@ static const uint8_t lz4FontData[] ={
 0xd4,0xa8,0xd4,0xa9,0xd4,0xac,0xd4,0xb0,0xd4,0xb8,0xd4,0xb9,0xd4,0xbd,0xd4,0xc4,
 0xd4,0xd9,0xd4,0xf5,0xd4,0x18,0xd5,0x28,0xd5,0x2d,0xd5,0x3c,0xd5,0x54,0xd5,0x65,
 0xd5,0x88,0xd5,0x90,0xd5,0x9d,0xd5,0xa4,0xd5,0xa5,0xd5,0xa8,0xd5,0xac,0xd5,0xb9,
-0xd5,0xdc,0xd5,0xf8,0xd5,0x14,0xd6,0x70,0xd6,0x84,0xd6,0xc0,0xd6,0xd8,0xd6,0x7f,
-0x56,0xf5,0x6f,0x46,0xf4,0x6f,0x46,0xf4,0x5f,0x45,0xf3,0x5f,0x32,0x71,0x00,0x04,
-0xd4,0x5f,0x50,0xb9,0x3f,0x1b,0x83,0xf0,0xb7,0x3f,0x0b,0x63,0xe0,0x52,0x16,0x00,
-0x00,0x00,0xe6,0x02,0xf3,0x00,0x00,0x2f,0x20,0x6e,0x00,0x00,0x06,0xe0,0x0a,0xb0,
-0x03,0xff,0xff,0xff,0xff,0xf7,0x04,0x4e,0x94,0x4f,0x64,0x10,0x00,0xf5,0x03,0xf1,
-0x00,0x00,0x3f,0x1b,0x00,0xf0,0x0f,0xf0,0x09,0xc0,0x00,0xef,0xff,0xff,0xff,0xfc,
-0x03,0x3c,0xa3,0x3f,0x73,0x20,0x00,0xe6,0x02,0xf2,0x00,0x00,0x2f,0x30,0x5f,0x00,
-0x00,0x05,0xf0,0x08,0xc0,0x79,0x15,0xf0,0x43,0x61,0x00,0x00,0x00,0x2f,0x40,0x00,
-0x00,0x16,0xf7,0x00,0x00,0x4f,0xff,0xff,0x40,0x1f,0xd3,0x04,0xee,0x05,0xf5,0x00,
-0x06,0xf5,0x6f,0x50,0x00,0x3d,0x63,0xfc,0x00,0x00,0x00,0x09,0xfe,0x71,0x00,0x00,
-0x06,0xef,0xfa,0x10,0x00,0x00,0x4b,0xfe,0x10,0x00,0x00,0x08,0xf7,0xca,0x00,0x00,
-0x1f,0x9c,0xf1,0x00,0x04,0xf8,0x5f,0xc4,0x36,0xef,0x20,0x6f,0xff,0xfe,0x40,0x00,
-0x06,0xf3,0x00,0x00,0x00,0x4f,0x10,0x00,0x02,0xbf,0xe7,0x56,0x00,0xf1,0x12,0x0d,
-0xa2,0x4f,0x40,0x04,0x30,0x00,0x0f,0x40,0x0c,0x70,0x1e,0x40,0x00,0x0e,0x80,0x2f,
-0x50,0xaa,0x00,0x00,0x04,0xef,0xf9,0x05,0xe1,0x00,0x00,0x00,0x01,0x00,0x1e,0x50,
-0xf5,0x15,0x11,0xaa,0x06,0x00,0xf1,0x07,0x05,0xe1,0x4c,0xea,0x10,0x00,0x00,0x1e,
-0x52,0xf6,0x3b,0xc0,0x00,0x00,0xaa,0x06,0xd0,0x03,0xf0,0x00,0x05,0xe1,0x07,0x00,
-0x51,0x06,0x50,0x02,0xf6,0x2a,0xa7,0x00,0xf3,0x64,0x5d,0xfb,0x20,0x00,0x07,0xdf,
-0xd5,0x00,0x00,0x00,0x8f,0xa6,0xcf,0x40,0x00,0x00,0xdd,0x00,0x0f,0x90,0x00,0x00,
-0xed,0x00,0x3f,0x60,0x00,0x00,0x8f,0x65,0xec,0x00,0x00,0x00,0x0c,0xff,0x90,0x00,
-0x00,0x00,0x4e,0xff,0x30,0x00,0x10,0x05,0xfb,0x2e,0xe1,0x0a,0xe0,0x0e,0xe0,0x03,
-0xfd,0x0d,0xc0,0x0f,0xb0,0x00,0x5f,0xdf,0x70,0x0e,0xe0,0x00,0x08,0xff,0x10,0x05,
-0xfc,0x53,0x6e,0xff,0x70,0x00,0x3b,0xef,0xe9,0x2b,0xf5,0x0f,0x50,0xf5,0x0f,0x40,
-0xf3,0x05,0x00,0x00,0x01,0x90,0x00,0x0d,0xb0,0x00,0xad,0x00,0x04,0xf4,0x00,0x0b,
-0xd0,0x00,0x1f,0x80,0x00,0x6f,0x40,0x00,0x9f,0x10,0x00,0xbf,0x00,0x03,0x00,0x50,
-0xaf,0x00,0x00,0x7f,0x30,0x68,0x00,0x90,0x0e,0xb0,0x00,0x07,0xf2,0x00,0x00,0xda,
-0x00,0x0d,0x00,0xa1,0x04,0xe0,0x00,0x00,0x00,0x65,0x00,0x00,0x4f,0x50,0x15,0x00,
-0xf2,0x1e,0xdc,0x00,0x00,0x6f,0x30,0x00,0x1f,0x90,0x00,0x0c,0xd0,0x00,0x09,0xf1,
-0x00,0x08,0xf2,0x00,0x07,0xf3,0x00,0x08,0xf3,0x00,0x09,0xf2,0x00,0x0b,0xf0,0x00,
-0x0f,0xb0,0x00,0x3f,0x50,0x00,0x9e,0x00,0x02,0xf5,0x00,0x1d,0xa0,0x00,0x8a,0xf2,
-0x16,0xf0,0x14,0x09,0xc0,0x00,0x00,0x08,0xc0,0x00,0x69,0x38,0xc1,0x77,0x6d,0xff,
-0xff,0xf9,0x00,0x4f,0xf6,0x00,0x00,0xcb,0xbd,0x00,0x08,0xf2,0x1e,0x90,0x01,0x40,
-0x04,0x20,0x00,0x00,0x5a,0x20,0xee,0x00,0x17,0x30,0x05,0x00,0x60,0x29,0x99,0xcf,
-0xa9,0x99,0x4f,0xeb,0x01,0x0b,0x19,0x00,0x01,0x05,0x00,0xf2,0x0c,0x0d,0xd0,0xdd,
-0x0f,0xa7,0xf3,0x25,0x00,0x01,0x11,0x1a,0xff,0xfe,0x24,0x44,0x30,0x6e,0x46,0xf4,
-0x00,0x00,0x06,0xf1,0x00,0x00,0x0c,0xb0,0xe3,0x01,0xf0,0x10,0x8e,0x00,0x00,0x00,
-0xe8,0x00,0x00,0x05,0xf2,0x00,0x00,0x0b,0xc0,0x00,0x00,0x1f,0x50,0x00,0x00,0x7e,
-0x00,0x00,0x00,0xe9,0x00,0x00,0x04,0xf3,0x00,0x00,0x0a,0x13,0x00,0xf0,0x1c,0x60,
-0x00,0x00,0x7f,0x10,0x00,0x00,0x55,0x00,0x00,0x00,0x02,0xae,0xfd,0x80,0x01,0xef,
-0x97,0xbf,0xa0,0x7f,0x50,0x00,0xaf,0x2c,0xf0,0x00,0x04,0xf6,0xed,0x00,0x00,0x2f,
-0x8e,0xc0,0x00,0x02,0xf9,0xfc,0x00,0x00,0x2f,0x9e,0x09,0x00,0x00,0x12,0x00,0xff,
-0x11,0x8b,0xf0,0x00,0x05,0xf6,0x7f,0x50,0x00,0xbf,0x20,0xef,0x96,0xbf,0x90,0x01,
-0xae,0xfd,0x70,0x00,0x00,0x04,0xab,0x29,0xef,0xfc,0x6e,0x93,0xfc,0x10,0x00,0xfc,
-0x00,0x03,0x00,0x08,0xf0,0x06,0x3b,0xef,0xd7,0x00,0x04,0xfe,0x87,0xbf,0xb0,0x0d,
-0xe1,0x00,0x0b,0xf3,0x1f,0xa0,0x00,0x06,0xf5,0x00,0x00,0x3d,0x01,0xc0,0x00,0x00,
-0x1e,0xa0,0x00,0x00,0x00,0xce,0x10,0x00,0x00,0x0b,0x59,0x02,0xf1,0x04,0xbf,0x40,
-0x00,0x00,0x0a,0xf4,0x00,0x00,0x00,0xaf,0x40,0x00,0x00,0x09,0xfa,0x66,0x66,0x65,
-0x0e,0x06,0x01,0xf0,0x01,0x4b,0xef,0xd7,0x00,0x06,0xfc,0x76,0xaf,0xb0,0x0e,0xd0,
-0x00,0x0a,0xf2,0x01,0x10,0x70,0x01,0xf0,0x04,0x00,0x12,0x7f,0x90,0x00,0x06,0xff,
-0xf9,0x00,0x00,0x01,0x45,0xaf,0x80,0x00,0x00,0x00,0x0a,0xf2,0x65,0x02,0x60,0xf6,
-0x1e,0x90,0x00,0x05,0xf6,0x69,0x00,0xa0,0xf2,0x05,0xfe,0x76,0xbf,0x90,0x00,0x4b,
-0xff,0xd6,0x87,0x01,0x70,0xcf,0x60,0x00,0x00,0x00,0x6f,0xf6,0x06,0x03,0xf0,0x15,
-0xdf,0x60,0x00,0x00,0x0b,0xd6,0xf6,0x00,0x00,0x06,0xf4,0x5f,0x60,0x00,0x01,0xfa,
-0x05,0xf6,0x00,0x00,0xbe,0x10,0x5f,0x60,0x00,0x5f,0x50,0x05,0xf6,0x00,0x1e,0xc1,
-0x11,0x6f,0x61,0x07,0x77,0x00,0x70,0xf4,0x24,0x44,0x44,0x8f,0x84,0x10,0x55,0x00,
-0x00,0x42,0x00,0x30,0x5f,0x60,0x00,0x17,0x00,0x60,0x80,0x9f,0x88,0x88,0x84,0x0b,
-0x17,0x02,0xf0,0x02,0xcc,0x00,0x00,0x00,0x0e,0xdc,0xff,0xa2,0x00,0xff,0xa8,0xbf,
-0xe1,0x03,0x30,0x00,0x8f,0x99,0x02,0x10,0xfd,0x16,0x03,0xf0,0x3f,0xe5,0xb1,0x00,
-0x00,0xed,0x3f,0x80,0x00,0x5f,0x80,0xaf,0xa6,0x8f,0xe1,0x00,0x7d,0xfe,0xa1,0x00,
-0x00,0x05,0xbe,0xd0,0x00,0x0b,0xfc,0x96,0x00,0x09,0xf5,0x00,0x00,0x02,0xf7,0x01,
-0x00,0x00,0x7f,0x7d,0xff,0xc2,0x0a,0xff,0x95,0x8f,0xe0,0xbf,0x50,0x00,0x7f,0x7c,
-0xf0,0x00,0x01,0xfb,0xbf,0x00,0x00,0x0f,0xb9,0xf3,0x00,0x01,0xfa,0x3f,0xb0,0x00,
-0x8f,0x50,0x9f,0xb6,0xaf,0xc0,0x00,0x7d,0xfe,0x90,0x00,0x0a,0x02,0x64,0xfd,0x16,
-0x66,0x66,0x67,0xf9,0x36,0x01,0x10,0x0e,0x36,0x01,0x10,0x7f,0x10,0x02,0x20,0xeb,
-0x00,0xc7,0x00,0x00,0x13,0x00,0x10,0xc0,0xe0,0x00,0x20,0x50,0x00,0x33,0x03,0x03,
-0xb2,0x00,0x20,0x0d,0xe0,0xac,0x03,0x12,0x70,0xe3,0x01,0xa0,0x02,0xfe,0x86,0xaf,
-0xc0,0x9f,0x40,0x00,0x9f,0x39,0xb4,0x02,0xf1,0x03,0x2f,0xc3,0x25,0xfc,0x00,0x3f,
-0xff,0xfc,0x00,0x1d,0xe7,0x59,0xf9,0x09,0xf2,0x00,0x08,0xf4,0xf5,0x01,0x90,0xd0,
-0x00,0x02,0xf9,0xbf,0x30,0x00,0x8f,0x52,0x2d,0x00,0x00,0x36,0x00,0xf2,0x1d,0x00,
-0x00,0x3b,0xef,0xc4,0x00,0x03,0xfe,0x87,0xdf,0x40,0x0b,0xf2,0x00,0x1e,0xd0,0x0f,
-0xb0,0x00,0x07,0xf3,0x0f,0xa0,0x00,0x05,0xf5,0x0e,0xe0,0x00,0x07,0xf6,0x07,0xfb,
-0x32,0x8f,0xf6,0x00,0x8f,0xff,0xc7,0xf4,0x00,0x01,0x32,0x9a,0x00,0xf5,0x04,0xd0,
-0x00,0x00,0x00,0x9f,0x50,0x00,0x16,0x8d,0xf9,0x00,0x00,0x2f,0xea,0x40,0x00,0x8f,
-0x38,0xe3,0x05,0x1a,0x87,0x8e,0x38,0xf3,0x0b,0xd0,0x0b,0xd0,0x00,0x01,0x00,0x90,
-0x0b,0xf0,0x0b,0xe0,0x0e,0xb0,0x5f,0x40,0x15,0x0d,0x00,0xf1,0x12,0x2a,0x30,0x00,
-0x04,0xbf,0xf3,0x00,0x5c,0xfe,0x82,0x03,0xef,0xb5,0x00,0x00,0x4f,0xe6,0x10,0x00,
-0x00,0x29,0xff,0xa3,0x00,0x00,0x01,0x8e,0xfd,0x20,0x00,0x00,0x07,0xe4,0x33,0x00,
-0xda,0x12,0x22,0x22,0x22,0x09,0xff,0xff,0xff,0xf2,0x35,0x55,0x55,0x55,0x12,0x00,
-0x10,0x25,0x12,0x00,0x10,0x97,0x0c,0x02,0xd0,0xff,0x92,0x00,0x00,0x03,0x9f,0xfb,
-0x40,0x00,0x00,0x06,0xcf,0xd1,0x46,0x00,0xb5,0x20,0x06,0xcf,0xe8,0x10,0x7f,0xfc,
-0x60,0x00,0x0b,0xa3,0x7d,0x00,0xe2,0x8d,0xfd,0x80,0x00,0xbf,0xb8,0xbf,0xa0,0x3f,
-0x90,0x00,0xbf,0x10,0x31,0x5b,0x01,0x10,0xde,0xc0,0x00,0xa1,0x60,0x00,0x00,0x9f,
-0x80,0x00,0x00,0x5f,0x90,0x00,0x6a,0x02,0x24,0x00,0x34,0x32,0x00,0x10,0x7d,0x18,
-0x05,0x20,0xe2,0x00,0x37,0x03,0x30,0x9d,0xff,0xd9,0x81,0x01,0x40,0x07,0xfb,0x63,
-0x35,0x2c,0x00,0x10,0x09,0x9d,0x00,0x70,0x2d,0x90,0x00,0x05,0xf3,0x00,0x00,0x7b,
-0x05,0xf3,0x40,0x00,0xe8,0x00,0x06,0xde,0xb3,0x00,0x99,0x00,0x4f,0x10,0x08,0xf6,
-0x3c,0xc0,0x04,0xe0,0x09,0xc0,0x02,0xf6,0x00,0xba,0x00,0x2f,0x00,0xc9,0x00,0x8e,
-0x00,0x0c,0x90,0x01,0xf1,0x0e,0x70,0x0c,0xb0,0x00,0xe7,0x00,0x1f,0x10,0xd7,0x00,
-0xd9,0x00,0x0f,0x60,0x03,0xe0,0x0c,0x80,0x0d,0xa0,0x03,0xf5,0x00,0x9a,0x00,0xab,
-0x00,0x8f,0x43,0xce,0xb2,0x6f,0x20,0x05,0xf1,0x01,0xbf,0xc3,0x3d,0xfc,0x40,0x00,
-0x0e,0x90,0x80,0x00,0x24,0x4f,0x70,0x09,0x00,0x40,0xc6,0x32,0x47,0x60,0x09,0x00,
-0x41,0x18,0xcf,0xfd,0xb4,0x12,0x00,0x21,0x0c,0xf2,0x97,0x00,0x11,0xff,0x2b,0x00,
-0x30,0x9f,0xae,0x00,0x8d,0x01,0x20,0x93,0xf5,0x0c,0x02,0x20,0xf3,0x0d,0x1c,0x02,
-0xf1,0x03,0xcd,0x00,0x6f,0x20,0x00,0x00,0x2f,0x70,0x01,0xf8,0x00,0x00,0x08,0xf3,
-0x22,0x2b,0xe0,0x00,0x32,0x06,0xa0,0x50,0x00,0x5f,0x75,0x55,0x55,0xec,0x00,0x0b,
-0xe0,0x5c,0x02,0x10,0x02,0x63,0x02,0x41,0x3f,0x80,0x8f,0x40,0x0a,0x01,0xf0,0x04,
-0x7f,0xff,0xff,0xd8,0x00,0x7f,0xa7,0x77,0xcf,0xc0,0x7f,0x50,0x00,0x0b,0xf3,0x7f,
-0x50,0x00,0x07,0x02,0x04,0xf0,0x38,0x09,0xf3,0x7f,0x61,0x12,0x7f,0xb0,0x7f,0xff,
-0xff,0xfd,0x10,0x7f,0x84,0x44,0x7e,0xd1,0x7f,0x50,0x00,0x04,0xf9,0x7f,0x50,0x00,
-0x01,0xfb,0x7f,0x50,0x00,0x06,0xf9,0x7f,0x96,0x67,0xaf,0xe2,0x7f,0xff,0xff,0xd9,
-0x10,0x00,0x29,0xef,0xea,0x30,0x00,0x4f,0xf9,0x79,0xef,0x50,0x1e,0xe1,0x00,0x01,
-0xee,0x07,0xf6,0x00,0x00,0x08,0xf5,0xbf,0x10,0x00,0x00,0x14,0x2d,0xf0,0xa2,0x00,
-0x24,0xee,0x00,0xa8,0x02,0x71,0x00,0xcf,0x00,0x00,0x00,0x13,0x18,0x21,0x00,0x10,
-0x1f,0x2c,0x00,0x80,0x00,0x5f,0xe9,0x79,0xef,0x50,0x00,0x3a,0x42,0x00,0xb0,0x7f,
-0xff,0xfd,0xa3,0x00,0x07,0xfa,0x77,0x9e,0xf7,0x00,0x8a,0x00,0x30,0xf4,0x07,0xf5,
-0x6a,0x02,0xb0,0x7f,0x50,0x00,0x00,0x9f,0x27,0xf5,0x00,0x00,0x07,0xf4,0x0b,0x00,
-0x25,0x6f,0x57,0x0b,0x00,0x10,0xaf,0x16,0x00,0x20,0x1f,0xd0,0x2c,0x00,0x62,0xf5,
-0x07,0xf9,0x66,0x9e,0xf7,0x42,0x00,0x00,0xd1,0x00,0x80,0xff,0xf1,0x7f,0xa7,0x77,
-0x77,0x70,0x7f,0x2a,0x03,0x07,0x05,0x00,0x31,0x61,0x11,0x11,0x1e,0x00,0x6c,0x30,
-0x7f,0x84,0x44,0x44,0x00,0x1e,0x00,0x50,0x96,0x66,0x66,0x61,0x7f,0x61,0x02,0x10,
-0x7f,0x7f,0x07,0x40,0xfa,0x77,0x77,0x76,0x18,0x00,0x23,0x07,0xf5,0x21,0x00,0x50,
-0x07,0xf6,0x11,0x11,0x10,0x1b,0x00,0x5a,0x07,0xf8,0x44,0x44,0x40,0x1b,0x00,0x14,
-0xf5,0x45,0x00,0xf0,0x09,0x00,0x3a,0xef,0xeb,0x40,0x00,0x5f,0xe9,0x78,0xef,0x70,
-0x1f,0xe1,0x00,0x00,0xcf,0x28,0xf5,0x00,0x00,0x03,0x94,0xbf,0x10,0x01,0x01,0xf0,
-0x01,0xf0,0x00,0x01,0x11,0x10,0xee,0x00,0x05,0xff,0xff,0x8d,0xf0,0x00,0x14,0x47,
-0xf8,0x16,0x00,0xf1,0x08,0x3f,0x86,0xf7,0x00,0x00,0x03,0xf8,0x0e,0xf3,0x00,0x00,
-0x5f,0x80,0x3e,0xfa,0x77,0xaf,0xe2,0x00,0x18,0xdf,0xfd,0x81,0x4d,0x00,0x20,0x0d,
-0xf7,0x57,0x00,0x1d,0xdf,0x0b,0x00,0x61,0xf6,0x11,0x11,0x11,0xdf,0x7f,0x24,0x08,
-0x5f,0xf8,0x44,0x44,0x44,0xef,0x2c,0x00,0x08,0x4c,0xf0,0x4f,0x74,0xf7,0x03,0x00,
-0x10,0x70,0x47,0x02,0x1f,0xf0,0x05,0x00,0x15,0xf0,0x04,0x5c,0x30,0x00,0x0d,0xf0,
-0x5f,0x90,0x00,0x3f,0xc0,0x0c,0xfb,0x79,0xff,0x30,0x00,0x8d,0xff,0xb3,0x9d,0x00,
-0xf0,0x07,0x02,0xee,0x27,0xf5,0x00,0x02,0xee,0x20,0x7f,0x50,0x01,0xdf,0x30,0x07,
-0xf5,0x01,0xdf,0x40,0x00,0x7f,0x50,0xcf,0x3b,0x02,0xf0,0x04,0xcf,0x70,0x00,0x00,
-0x7f,0xef,0xfc,0x00,0x00,0x07,0xff,0x78,0xf9,0x00,0x00,0x7f,0x80,0x0c,0xf5,0x20,
-0x01,0x20,0x1e,0xf3,0x37,0x00,0x20,0x3f,0xd1,0x2b,0x01,0x21,0x6f,0xb0,0xd5,0x01,
-0x1e,0x80,0x44,0x01,0x0f,0x09,0x00,0x0d,0x00,0x2d,0x06,0x00,0xfa,0x00,0x30,0xc0,
-0x7f,0xf1,0x26,0x05,0x30,0xff,0x07,0xff,0xce,0x00,0x40,0xef,0xf0,0x7f,0xfe,0xbb,
-0x05,0xf0,0x25,0xff,0x07,0xf9,0xf5,0x00,0x00,0x0c,0xea,0xf0,0x7f,0x4f,0xb0,0x00,
-0x02,0xf8,0xaf,0x07,0xf4,0x9f,0x20,0x00,0x9f,0x2b,0xf0,0x7f,0x42,0xf9,0x00,0x0f,
-0xb0,0xbf,0x07,0xf5,0x0b,0xf0,0x06,0xf4,0x0c,0xf0,0x7f,0x50,0x4f,0x60,0xdd,0x00,
-0xcf,0x07,0xf5,0x00,0xdd,0x4f,0x60,0x0f,0x00,0x31,0x07,0xfd,0xf0,0x0f,0x00,0x30,
-0x1f,0xf9,0x00,0x0f,0x00,0x80,0x00,0x9f,0x20,0x00,0xcf,0x00,0x7f,0xb0,0x4b,0x01,
-0x20,0xff,0x50,0x4b,0x01,0x70,0xff,0x10,0x00,0x0d,0xf7,0xfa,0xfb,0x0b,0x00,0x20,
-0x59,0xf6,0x61,0x01,0x20,0x0e,0xf2,0x61,0x01,0x20,0x4f,0xc0,0x6c,0x01,0x20,0x9f,
-0x60,0x6c,0x01,0x70,0xdf,0x2d,0xf7,0xf5,0x00,0x03,0xfc,0x0b,0x00,0x20,0x08,0xff,
-0x82,0x01,0x20,0x0d,0xff,0xb2,0x00,0xf0,0x09,0x3f,0xf0,0x00,0x29,0xdf,0xe9,0x20,
-0x00,0x3f,0xfa,0x8a,0xff,0x40,0x1e,0xe2,0x00,0x02,0xee,0x17,0xf6,0x00,0x00,0x05,
-0xf7,0xfc,0x01,0x30,0x0f,0xcd,0xe0,0x81,0x03,0x10,0xed,0x1c,0x02,0x20,0xfd,0xe0,
-0x28,0x03,0x01,0x16,0x00,0x20,0xc7,0xf7,0x21,0x00,0xf0,0x01,0x1e,0xe2,0x00,0x01,
-0xdf,0x10,0x3f,0xfa,0x89,0xff,0x50,0x00,0x29,0xdf,0xea,0x20,0xb8,0x02,0x80,0xeb,
-0x30,0x07,0xfa,0x77,0x79,0xff,0x50,0x80,0x01,0x10,0xfe,0x15,0x01,0x20,0x09,0xf3,
-0x64,0x00,0x20,0x8f,0x47,0x6f,0x00,0x80,0xf1,0x7f,0x61,0x11,0x3b,0xfa,0x07,0xff,
-0x7e,0x08,0x42,0x7f,0x84,0x44,0x30,0x36,0x01,0x02,0x96,0x02,0x06,0x0b,0x00,0x00,
-0x80,0x05,0x50,0xef,0xd9,0x20,0x00,0x4f,0x90,0x00,0x10,0x1f,0x90,0x00,0x60,0x18,
-0xf5,0x00,0x00,0x06,0xf6,0x98,0x03,0x20,0x1f,0xbe,0xb5,0x05,0x20,0xed,0xfc,0x54,
-0x04,0x20,0xee,0xd0,0xe6,0x06,0x10,0xdf,0x16,0x00,0x20,0xb8,0xf6,0xfc,0x02,0xf1,
-0x01,0x1f,0xe1,0x00,0x02,0xee,0x10,0x4f,0xf9,0x8a,0xfe,0x30,0x00,0x2a,0xef,0xef,
-0xd2,0x2c,0x07,0x01,0x32,0x07,0x12,0x2c,0x57,0x00,0x01,0x0b,0x04,0x61,0x07,0xfa,
-0x77,0x7b,0xfe,0x20,0x20,0x04,0x10,0x07,0x9d,0x03,0x00,0xe9,0x01,0xf0,0x04,0x03,
-0xf9,0x07,0xf6,0x11,0x26,0xef,0x20,0x7f,0xff,0xff,0xfc,0x30,0x07,0xf8,0x44,0x8f,
-0x70,0x00,0x30,0x01,0x60,0x10,0x07,0xf5,0x00,0x05,0xf8,0x0b,0x00,0x40,0x0d,0xf1,
-0x07,0xf5,0x87,0x05,0x00,0xa0,0x00,0xd0,0xcf,0x10,0x00,0x18,0xdf,0xeb,0x40,0x00,
-0x2e,0xfa,0x78,0xdf,0x80,0x25,0x08,0x90,0xbf,0x30,0xcf,0x00,0x00,0x04,0xe6,0x09,
-0xf7,0x64,0x00,0x30,0x1d,0xfc,0x61,0x0a,0x07,0x20,0xdf,0xfc,0x73,0x00,0x40,0x27,
-0xdf,0xa0,0x00,0x45,0x08,0x80,0x52,0xe8,0x00,0x00,0x04,0xf8,0x0e,0xe2,0xd2,0x05,
-0xc0,0x4f,0xfa,0x78,0xbf,0xd0,0x00,0x19,0xdf,0xec,0x70,0x00,0x8f,0x21,0x03,0x90,
-0xe3,0x77,0x78,0xfc,0x77,0x76,0x00,0x00,0x3f,0x30,0x05,0x10,0x03,0xf7,0x04,0x0f,
-0x0b,0x00,0x1e,0x00,0x94,0x01,0x7f,0xbf,0x1b,0xf1,0x00,0x00,0x0b,0xf1,0x0b,0x00,
-0x13,0x30,0x19,0xf3,0x00,0x33,0x03,0xf0,0x09,0xa0,0x00,0x05,0xfb,0x00,0xbf,0xc8,
-0x7a,0xfe,0x20,0x00,0x6c,0xff,0xd8,0x00,0x00,0x8f,0x60,0x00,0x00,0x04,0xfa,0x2f,
-0xb0,0xfc,0x08,0xe1,0x0c,0xf1,0x00,0x00,0x0f,0xd0,0x06,0xf6,0x00,0x00,0x5f,0x70,
-0x00,0xfc,0x64,0x00,0x90,0x9f,0x20,0x01,0xfb,0x00,0x00,0x3f,0x70,0x06,0xcc,0x01,
-0xd1,0xd0,0x0c,0xe0,0x00,0x00,0x07,0xf3,0x1f,0x90,0x00,0x00,0x01,0xf8,0x02,0x08,
-0x26,0xbe,0xdc,0x71,0x01,0x21,0x0e,0xf1,0x38,0x00,0xf0,0x04,0x05,0xf7,0x00,0x00,
-0x7f,0x51,0xfb,0x00,0x00,0xaf,0xb0,0x00,0x0b,0xf1,0x0d,0xe0,0x00,0x0e,0xff,0x44,
-0x0b,0xf0,0x2a,0x8f,0x20,0x03,0xf9,0xf4,0x00,0x2f,0x90,0x04,0xf6,0x00,0x8f,0x1e,
-0x90,0x06,0xf5,0x00,0x1f,0xa0,0x0d,0xb0,0xae,0x00,0xaf,0x10,0x00,0xce,0x01,0xf6,
-0x05,0xf2,0x0e,0xc0,0x00,0x08,0xf2,0x6f,0x20,0x1f,0x71,0xf8,0x00,0x00,0x4f,0x6b,
-0xd0,0x00,0xcb,0x5f,0x40,0x00,0x01,0xf9,0xf8,0x00,0x07,0xf9,0x5c,0x0a,0x50,0xef,
-0x30,0x00,0x3f,0xec,0x81,0x0a,0x00,0x38,0x06,0xb0,0x80,0x00,0x00,0x04,0xf9,0x00,
-0x00,0x09,0xf4,0x00,0x00,0xcc,0x04,0xd0,0x2f,0xe1,0x06,0xfa,0x00,0x00,0xbf,0x50,
-0x00,0xbf,0x50,0x06,0xfa,0x13,0x00,0x80,0x1e,0xe1,0x00,0x00,0x06,0xf9,0xaf,0x50,
-0xd3,0x09,0x11,0xfa,0xaf,0x06,0x11,0xf3,0xe3,0x05,0x10,0xfb,0x72,0x02,0xf0,0x15,
-0xf9,0xaf,0x60,0x00,0x00,0x2f,0xe0,0x1e,0xf1,0x00,0x00,0xcf,0x40,0x05,0xfb,0x00,
-0x07,0xf9,0x00,0x00,0xaf,0x60,0x2f,0xe1,0x00,0x00,0x1e,0xf1,0x9f,0x70,0x00,0x00,
-0x1f,0xe0,0x1e,0xe0,0xb2,0x01,0xf1,0x02,0x06,0xf8,0x00,0x02,0xfc,0x00,0x00,0xdf,
-0x10,0x0a,0xf3,0x00,0x00,0x4f,0x80,0x2f,0xa0,0x48,0x01,0x61,0x20,0x00,0x00,0x02,
-0xfc,0xf8,0xe4,0x06,0x15,0xe0,0x94,0x01,0x0f,0x06,0x00,0x04,0x20,0x1f,0xff,0xe1,
-0x06,0x40,0x77,0x77,0x77,0x7f,0x1c,0x07,0x01,0x29,0x02,0x20,0x04,0xfb,0x99,0x0c,
-0x23,0xee,0x10,0x6d,0x0a,0x30,0x00,0x7f,0x90,0x2c,0x00,0x10,0xd0,0x69,0x03,0x01,
-0x24,0x00,0x10,0xf6,0x31,0x07,0x10,0xfa,0x24,0x00,0x60,0xef,0x76,0x66,0x66,0x64,
-0x3f,0x42,0x00,0x9f,0xa0,0x01,0x11,0xaf,0xfd,0xaf,0x53,0xaf,0x10,0x02,0x00,0x08,
-0x90,0x21,0xaf,0xfd,0x24,0x43,0x6f,0x30,0x00,0x00,0x9a,0x01,0x50,0x0a,0xe0,0x00,
-0x00,0x04,0x59,0x03,0x10,0xdb,0x62,0x00,0x20,0x20,0x00,0x6e,0x0c,0x01,0x61,0x07,
-0x23,0x05,0xf4,0xb3,0x09,0x20,0x8f,0x10,0x8b,0x07,0x10,0x00,0x47,0x0c,0x02,0xbf,
-0x09,0x8f,0x74,0x11,0x10,0xef,0xf9,0x45,0xf9,0x02,0x02,0x00,0x08,0x90,0x13,0xf9,
-0xef,0xf9,0x44,0x42,0x00,0x05,0x50,0x23,0x01,0xf0,0x0e,0x00,0x00,0x7f,0xf6,0x00,
-0x00,0xe9,0xbd,0x00,0x05,0xf3,0x4f,0x30,0x0c,0xc0,0x0e,0xa0,0x3f,0x60,0x07,0xf1,
-0x11,0x11,0x11,0x11,0x0f,0xff,0xff,0xff,0xfc,0x05,0xf1,0x07,0x44,0x20,0x17,0x60,
-0x00,0x8f,0x40,0x00,0x8e,0x10,0x03,0xbe,0xfd,0x60,0x03,0xfd,0x76,0xcf,0x60,0x9d,
-0x10,0x00,0x41,0x0d,0xf1,0x0e,0xe0,0x04,0xbe,0xff,0xff,0x07,0xfb,0x53,0x3c,0xf0,
-0xed,0x00,0x00,0xcf,0x0e,0xd0,0x00,0x2e,0xf0,0x8f,0xc8,0x9f,0xff,0x00,0x7d,0xfd,
-0x58,0xd2,0xbf,0x94,0x09,0x00,0x1e,0x01,0x05,0x09,0x00,0xf0,0x02,0x3c,0xfe,0xa1,
-0x0b,0xff,0x97,0xbf,0xd0,0xbf,0x40,0x00,0x9f,0x6b,0xf0,0x00,0x01,0xfa,0xa7,0x0a,
-0xf0,0x1c,0xcb,0xf0,0x00,0x00,0xfc,0xbf,0x00,0x00,0x2f,0xab,0xf5,0x00,0x09,0xf5,
-0xbf,0xf9,0x7b,0xfc,0x0b,0xe3,0xcf,0xea,0x10,0x00,0x19,0xef,0xc6,0x00,0x01,0xef,
-0x86,0xbf,0x90,0x0a,0xf3,0x00,0x0a,0xf1,0x0f,0xc0,0x00,0x02,0x72,0x12,0x01,0x01,
-0x17,0x01,0x00,0x20,0x0d,0x30,0x01,0x31,0x0a,0x2e,0x0d,0x91,0x02,0xef,0x86,0xaf,
-0x80,0x00,0x2a,0xef,0xd6,0x19,0x0e,0x1c,0xf5,0x05,0x00,0xf4,0x06,0x3b,0xfe,0xa7,
-0xf5,0x02,0xff,0x97,0xbf,0xf5,0x0a,0xf4,0x00,0x09,0xf5,0x0f,0xd0,0x00,0x05,0xf5,
-0x1f,0xa0,0x05,0x00,0xf0,0x19,0x0f,0xc0,0x00,0x05,0xf5,0x0a,0xf2,0x00,0x08,0xf5,
-0x02,0xfe,0x64,0x9f,0xf5,0x00,0x2b,0xff,0xb6,0xf5,0x00,0x19,0xef,0xd6,0x00,0x01,
-0xdf,0x86,0xbf,0x70,0x09,0xf3,0x00,0x0b,0xf0,0x0e,0xc1,0x11,0x17,0xf4,0xfe,0x01,
-0x80,0xf5,0x1f,0xb4,0x44,0x44,0x41,0x0f,0xc0,0x13,0x0a,0xe0,0xf5,0x00,0x02,0x70,
-0x01,0xef,0x96,0x8f,0xd0,0x00,0x19,0xef,0xe9,0x10,0x9f,0x0e,0x70,0x00,0x9f,0xf9,
-0x00,0x7f,0xa5,0x30,0xd0,0x06,0x10,0xdd,0xdc,0x0b,0x71,0xf0,0x24,0xee,0x44,0x00,
-0x0d,0xd0,0x43,0x0b,0x0f,0x07,0x00,0x02,0x50,0x00,0x3b,0xfe,0xa5,0xf6,0x99,0x00,
-0x10,0xf6,0x99,0x00,0x10,0xf6,0x99,0x00,0x34,0xf6,0x1f,0xa0,0x05,0x00,0x01,0x0f,
-0x00,0x01,0x19,0x00,0x01,0x23,0x00,0x01,0xc6,0x00,0x10,0x00,0x93,0x08,0xe7,0x01,
-0x80,0x00,0x0d,0xf1,0x05,0xfc,0x77,0xcf,0x80,0x00,0x3b,0xef,0xc6,0x5b,0x01,0x05,
-0x09,0x00,0xfe,0x0b,0x2b,0xfe,0xa1,0x0b,0xfe,0xa7,0xaf,0xb0,0xbf,0x60,0x00,0xbf,
-0x0b,0xf0,0x00,0x08,0xf2,0xbf,0x00,0x00,0x8f,0x3b,0xf0,0x00,0x08,0xf3,0x09,0x00,
-0x87,0x7f,0x26,0xe2,0x00,0x08,0xf2,0x8f,0x28,0x03,0x00,0x60,0x20,0x00,0x9e,0x10,
-0x08,0xd1,0xe5,0x00,0x4f,0xf1,0x00,0xaf,0x10,0x05,0x00,0x05,0x5f,0x04,0x8f,0xd0,
-0x8f,0xc3,0x7e,0x00,0x01,0x50,0x00,0x06,0xfa,0x0b,0xf0,0x94,0x04,0xf9,0x14,0x05,
-0xfc,0x00,0x0b,0xf4,0xfd,0x10,0x00,0xbf,0xef,0x80,0x00,0x0b,0xfd,0xcf,0x40,0x00,
-0xbf,0x22,0xee,0x10,0x0b,0xf0,0x04,0xfb,0x00,0xbf,0x00,0x08,0xf7,0x0b,0xf0,0x00,
-0x0c,0xf3,0x78,0x00,0x04,0x03,0x00,0xf1,0x10,0xbe,0x3b,0xff,0xa1,0x2b,0xfe,0xb2,
-0x0b,0xfe,0x87,0xbf,0xcf,0xa7,0x9f,0xd0,0xbf,0x30,0x00,0xcf,0x80,0x00,0x9f,0x3b,
-0xf0,0x00,0x09,0xf3,0x00,0x06,0xf5,0xbf,0xb7,0x0e,0x30,0x5f,0x5b,0xf0,0x2a,0x0f,
-0x1f,0x05,0x0f,0x00,0x0d,0x0f,0x0b,0x01,0x19,0xf0,0x00,0x00,0x19,0xef,0xd8,0x00,
-0x01,0xdf,0x96,0xaf,0xc0,0x09,0xf4,0x00,0x07,0xf7,0xe8,0x01,0x60,0xfc,0x1f,0xa0,
-0x00,0x00,0xcf,0x6f,0x02,0x11,0xdf,0x0f,0x00,0x10,0x0a,0x19,0x00,0xfb,0x0c,0x01,
-0xef,0x96,0xaf,0xc0,0x00,0x19,0xef,0xd7,0x00,0xbe,0x5c,0xfe,0x91,0x0b,0xfe,0x64,
-0x9f,0xc0,0xbf,0x20,0x00,0x8f,0x5b,0xf0,0x00,0x02,0xce,0x02,0xdd,0xf3,0x00,0x0a,
-0xf5,0xbf,0xe8,0x6b,0xfc,0x0b,0xf4,0xcf,0xea,0x10,0x2b,0x01,0x00,0x01,0x02,0xb0,
-0xa6,0xf5,0x02,0xff,0x86,0xaf,0xf5,0x0b,0xf4,0x00,0x08,0x9a,0x02,0x10,0x06,0x95,
-0x02,0x02,0x05,0x00,0x00,0x9a,0x02,0x10,0x06,0xb3,0x02,0x12,0x08,0x23,0x00,0x31,
-0x00,0x3b,0xff,0x01,0x02,0x2e,0x06,0xf5,0x05,0x00,0x86,0xbf,0x5d,0xf2,0xbf,0xf9,
-0x71,0xbf,0x40,0x80,0x10,0x08,0x03,0x00,0xe0,0x00,0x4c,0xfe,0xb4,0x00,0x5f,0xc6,
-0x7e,0xf4,0x0b,0xf0,0x00,0x2f,0xb0,0x48,0x05,0xf0,0x11,0x01,0xcf,0xea,0x50,0x00,
-0x00,0x38,0xcf,0xe3,0x02,0x10,0x00,0x3f,0xb0,0xfc,0x00,0x00,0xec,0x07,0xfc,0x66,
-0xcf,0x60,0x05,0xcf,0xfc,0x50,0x00,0x85,0x00,0x01,0xfa,0x03,0x00,0x62,0xef,0xff,
-0xf8,0x45,0xfb,0x42,0x0c,0x00,0x08,0x03,0x00,0x60,0x00,0xef,0x74,0x00,0x4d,0xf7,
-0x35,0x01,0x14,0x2b,0x50,0x01,0x0e,0x09,0x00,0xf0,0x27,0x29,0xf3,0x00,0x0c,0xf2,
-0x3f,0xe7,0x8d,0xff,0x20,0x5d,0xfe,0x98,0xf2,0x8f,0x30,0x00,0x1f,0xa2,0xf9,0x00,
-0x06,0xf4,0x0c,0xe0,0x00,0xbe,0x00,0x6f,0x30,0x1f,0x90,0x01,0xf9,0x06,0xf3,0x00,
-0x0b,0xe0,0xbd,0x00,0x00,0x5f,0x5f,0x80,0x00,0x00,0xfe,0xf2,0x00,0x00,0x09,0xfc,
-0x00,0x24,0x11,0x00,0x89,0x0e,0xf1,0x2b,0xbe,0x00,0x00,0xfa,0x2f,0x80,0x01,0xff,
-0x40,0x04,0xf6,0x0d,0xc0,0x05,0xfe,0x90,0x08,0xf1,0x09,0xf0,0x0a,0xb9,0xe0,0x0c,
-0xc0,0x04,0xf4,0x0f,0x64,0xf3,0x0f,0x80,0x00,0xf8,0x4f,0x10,0xe8,0x4f,0x30,0x00,
-0xbd,0x9c,0x00,0x9d,0x8e,0x00,0x00,0x6f,0xf7,0x00,0x4f,0xea,0x00,0x00,0x1f,0xf2,
-0x00,0x0f,0xd5,0x06,0x00,0xb8,0x02,0xf0,0x06,0x3f,0xc0,0x00,0x6f,0x80,0x8f,0x60,
-0x1f,0xd0,0x00,0xde,0x1a,0xf3,0x00,0x03,0xfc,0xf9,0x00,0x00,0x08,0xfd,0xe7,0x05,
-0xf0,0x27,0xe1,0x00,0x00,0x4f,0xaf,0xa0,0x00,0x0e,0xe0,0x8f,0x50,0x09,0xf4,0x00,
-0xee,0x14,0xfa,0x00,0x04,0xfa,0x9f,0x30,0x00,0x3f,0x94,0xf9,0x00,0x08,0xf3,0x0e,
-0xe0,0x00,0xde,0x00,0x8f,0x40,0x3f,0x80,0x02,0xf9,0x08,0xf2,0x00,0x0c,0xe0,0xdd,
-0x00,0x00,0x7f,0x6f,0x70,0x00,0x01,0xff,0xfd,0x10,0x12,0xfc,0xb6,0x0f,0x32,0x00,
-0x07,0xf1,0x8c,0x05,0x72,0x18,0xcf,0x30,0x00,0x03,0xfd,0x50,0x19,0x06,0xd3,0x80,
-0x66,0x66,0x6e,0xf4,0x00,0x00,0x07,0xf8,0x00,0x00,0x03,0xfb,0x14,0x06,0x20,0xbf,
-0x40,0x97,0x0a,0xb0,0x00,0x00,0x3f,0xb0,0x00,0x00,0x1e,0xf7,0x66,0x66,0x43,0x53,
-0x13,0xd1,0x00,0x00,0x02,0x00,0x00,0x1b,0xf1,0x00,0x0c,0xe2,0x00,0x03,0xf8,0x64,
-0x0f,0x60,0x07,0xf4,0x00,0x00,0x7f,0x40,0x30,0x0e,0x92,0x04,0xed,0x00,0x06,0xff,
-0x20,0x00,0x17,0xfb,0x29,0x0e,0x20,0x7f,0x40,0x1c,0x00,0x00,0x5a,0x12,0x22,0x04,
-0xf7,0x35,0x04,0x7a,0x2e,0xd1,0x00,0x00,0x05,0x00,0x6f,0x01,0x00,0x60,0x38,0x10,
-0x00,0x00,0xae,0x40,0xb1,0x10,0x30,0x01,0xf9,0x00,0x94,0x05,0x10,0xed,0x5e,0x04,
-0x00,0x02,0x0d,0xa1,0x6f,0x81,0x00,0x09,0xfd,0x00,0x4f,0xb4,0x00,0xbf,0x12,0x00,
-0x11,0xed,0x1e,0x00,0xa1,0xfa,0x00,0x08,0xf4,0x00,0x8f,0x70,0x00,0x31,0x00,0xb5,
-0x04,0xf1,0x01,0x01,0x10,0x8f,0xfd,0x50,0x00,0xc9,0x6f,0x86,0xdf,0x93,0x7f,0x5b,
-0xc0,0x00,0x9f,0xf2,0x0d,0x21,0x14,0x20,0x6b,0x09,0x13,0x50,0x1f,0x0e,0x23,0x3f,
-0x30,0x5f,0x0f,0x12,0xfb,0x08,0x00,0x32,0x04,0xff,0xf4,0x09,0x00,0x41,0xcf,0xdf,
-0xc0,0x00,0x30,0x08,0x31,0xe1,0xef,0x50,0x7c,0x0d,0x31,0xf6,0x06,0xfd,0x84,0x05,
-0x31,0xfd,0x00,0x0d,0x0b,0x0a,0x50,0xdf,0x50,0x00,0x5f,0xd0,0x4b,0x10,0x12,0xc0,
-0x34,0x11,0x60,0x0e,0xf4,0x00,0x00,0x04,0xfe,0xe8,0x0e,0x00,0x4f,0x00,0xa1,0xf7,
-0x00,0x01,0xff,0x63,0x33,0x33,0x33,0x6f,0xf1,0x46,0x09,0x00,0x47,0x01,0x22,0x1f,
-0xff,0x01,0x00,0x11,0x10,0x7f,0x0e,0x11,0x89,0x56,0x00,0xf0,0x1a,0x03,0xff,0xff,
-0xb0,0x00,0x00,0x02,0x40,0xdf,0x30,0x9f,0x50,0x00,0x4d,0xff,0x4f,0xa0,0x02,0xf9,
-0x00,0x7f,0xf9,0x44,0xfe,0x10,0x6f,0x70,0x5f,0xd1,0x00,0x7f,0xfe,0xcf,0xe1,0x0e,
-0xf1,0x00,0x0a,0xff,0xff,0xd2,0xaa,0x08,0xf1,0x0e,0xdf,0xff,0x93,0xf4,0x8f,0x20,
-0x00,0x0f,0xfe,0x40,0x2f,0x8a,0xf0,0x00,0x03,0xfb,0x10,0x00,0xfa,0x8f,0x20,0x00,
-0x57,0x00,0x00,0x2f,0x85,0xf7,0x00,0xa3,0x0a,0x21,0x0e,0xe1,0xb5,0x07,0x30,0x00,
-0x6f,0xc1,0x09,0x03,0x60,0x60,0x00,0x8f,0xe7,0x32,0x37,0x84,0x08,0x50,0x5e,0xff,
-0xff,0xfe,0x50,0xde,0x00,0x21,0x78,0x74,0xd5,0x00,0x40,0x1a,0xbb,0xbb,0xb7,0x08,
-0x00,0xf1,0x13,0x40,0x6f,0xff,0xff,0x23,0x60,0x00,0x00,0x6f,0x90,0xaf,0xff,0x72,
-0xef,0x30,0x00,0x13,0xec,0x00,0xcf,0xc0,0x1d,0x86,0x30,0x0b,0xf8,0x10,0x02,0xe2,
-0x00,0x0c,0xfb,0x00,0x9f,0x47,0x0f,0x41,0x6a,0x20,0x3a,0xa0,0x38,0x00,0x41,0xef,
-0x56,0xff,0x00,0x3f,0x09,0x22,0xd5,0x04,0x69,0x0f,0x41,0xa7,0x12,0xff,0x40,0x47,
-0x01,0x31,0xf3,0x0b,0x87,0xc4,0x13,0x40,0x66,0x00,0x0b,0xf7,0x26,0x01,0xf0,0x02,
-0xff,0x30,0x00,0xcd,0x8b,0x10,0x00,0x0a,0xb6,0xb0,0x00,0x00,0x1d,0xf8,0xe7,0xeb,
-0xdf,0x7f,0x00,0x51,0x8a,0x8f,0x6f,0xe3,0x80,0x66,0x01,0x21,0x92,0x76,0x07,0x00,
-0x14,0x60,0x75,0x01,0x40,0x99,0xdf,0xec,0x70,0x3f,0x01,0xf0,0x02,0xbf,0xfd,0xbb,
-0xef,0xe5,0x00,0x02,0xfe,0x20,0xbf,0xa0,0x00,0x4e,0xf6,0x00,0x5f,0xc0,0x9a,0x09,
-0xf0,0x08,0x1d,0xf3,0x00,0x9f,0xc1,0x00,0xaf,0x80,0x00,0x1f,0xc0,0x08,0xff,0xd1,
-0x1e,0xf4,0x00,0x00,0x8f,0x20,0xcd,0x6f,0xdd,0x17,0x0e,0x41,0xf6,0x0e,0xb0,0x5f,
-0xab,0x12,0x21,0x80,0xec,0x7c,0x10,0x10,0x02,0x7c,0x05,0x01,0xb7,0x01,0x11,0x50,
-0xe3,0x11,0x00,0x8d,0x04,0x00,0xc4,0x08,0x00,0x27,0x0b,0x30,0x04,0xfc,0x10,0xbf,
-0x01,0x70,0x10,0x00,0x06,0xff,0x84,0x23,0x5b,0x28,0x11,0x51,0x03,0xcf,0xff,0xff,
-0xf8,0x2f,0x00,0x31,0x26,0x77,0x40,0x08,0x00,0x62,0xbd,0xdd,0xdd,0xdd,0xdd,0x40,
-0x10,0x09,0xe0,0xe0,0x00,0x06,0xfe,0x21,0x11,0x13,0xf9,0x00,0x00,0xbf,0x80,0x00,
-0x00,0x79,0x01,0x11,0xf2,0x3e,0x12,0x61,0x04,0xfd,0x00,0x00,0x08,0xf6,0x44,0x0a,
-0x90,0x0a,0xf9,0x00,0x00,0x02,0xcf,0x60,0x1d,0xe4,0x50,0x10,0x11,0xec,0x58,0x13,
-0x50,0xdf,0x4c,0x90,0xff,0x80,0x87,0x09,0xf0,0x05,0xf4,0x6d,0xde,0x00,0x00,0x06,
-0xf3,0x3f,0x0c,0x59,0xf1,0x00,0x00,0x6f,0x53,0x60,0x10,0xaf,0x00,0x00,0xa0,0x0a,
-0x00,0xbf,0x0a,0x51,0x09,0xfb,0x31,0x5e,0xf3,0x7e,0x11,0x21,0xff,0xf5,0x07,0x02,
-0x31,0x89,0x71,0x00,0x16,0x02,0x40,0x77,0x77,0x60,0x00,0x77,0x16,0xf1,0x02,0xfe,
-0x00,0x00,0x01,0x15,0xff,0xff,0xe2,0x33,0x0e,0xff,0xff,0xfe,0xee,0xee,0xf4,0xf2,
-0xb9,0x10,0x11,0x4f,0xbc,0x02,0xe1,0xc4,0xe2,0x0e,0xff,0xff,0xf2,0x0c,0x5e,0x20,
-0x9a,0xaa,0xaa,0x10,0xc5,0x35,0x12,0x32,0x0c,0x5e,0x30,0x0d,0x00,0x02,0x1a,0x00,
-0x01,0xd4,0x02,0x03,0x1a,0x00,0x30,0x5d,0xee,0xee,0xdf,0x07,0x63,0x12,0x26,0xff,
+0xd5,0xdc,0xd5,0xf8,0xd5,0x14,0xd6,0x70,0xd6,0x84,0xd6,0xc0,0xd6,0xd8,0xd6,0x00,
+0x01,0x00,0x2f,0xfa,0x00,0x01,0x00,0x02,0x13,0xf0,0x08,0x00,0x17,0xee,0x14,0x00,
+0xbe,0xf9,0xf7,0x00,0xfd,0xf7,0x00,0xf4,0x00,0x00,0x00,0x02,0x31,0x00,0x4d,0x03,
+0x03,0x00,0x03,0x15,0x00,0x2f,0xe7,0x00,0x01,0x00,0x14,0x1f,0xdf,0x1d,0x00,0x09,
+0x03,0x84,0x00,0xb1,0xf7,0x00,0xfe,0x00,0x00,0xed,0xfd,0xf3,0xf6,0x00,0xf2,0x11,
+0x00,0x00,0x0f,0x00,0x4c,0xfd,0xfe,0xf9,0xfb,0x8e,0x00,0x7e,0xfc,0x00,0xfc,0x00,
+0x00,0xf8,0x00,0x01,0x00,0x1c,0xfc,0x0a,0x00,0x19,0xfe,0x1f,0x00,0x11,0xfd,0x06,
+0x00,0x13,0xf1,0x0a,0x00,0x7f,0xfc,0x00,0xfd,0x00,0xfd,0xfa,0xfd,0x98,0x00,0x09,
+0x15,0x03,0x3a,0x00,0x11,0xfd,0x33,0x00,0x25,0xfd,0xfc,0x2f,0x00,0x11,0xdd,0xfd,
+0x00,0x15,0xd9,0x23,0x00,0x20,0xfb,0xfd,0x1f,0x00,0x02,0x04,0x00,0x0b,0x42,0x00,
+0x10,0xfc,0x08,0x00,0x0a,0x17,0x00,0x0e,0x96,0x00,0x0f,0x01,0x00,0x07,0x10,0xf7,
+0x5e,0x00,0x09,0xe5,0x00,0x01,0x64,0x00,0x30,0xfd,0xfa,0xf7,0x0e,0x00,0x14,0xce,
+0x69,0x00,0x97,0xf6,0x00,0x00,0xd7,0xf8,0xe6,0xeb,0x00,0xdd,0xcf,0x01,0x24,0xec,
+0xf2,0x0b,0x00,0x72,0xd0,0x00,0x00,0x00,0xec,0x00,0xe2,0xab,0x00,0x51,0x00,0xfc,
+0x00,0xfe,0xfe,0x1d,0x01,0x1d,0x02,0xe9,0x01,0x00,0x30,0x02,0x29,0xfc,0xfd,0x71,
+0x00,0x0e,0x01,0x00,0x10,0xf4,0xb5,0x00,0x1e,0xf9,0x39,0x00,0x00,0x89,0x17,0xa1,
+0xde,0x00,0x00,0xf4,0xfc,0xdc,0xfe,0x02,0x00,0x02,0x5d,0x00,0xd2,0xef,0xf1,0x00,
+0xf0,0xf1,0xf5,0xef,0x00,0xf2,0xf5,0xf8,0xf5,0xf7,0x12,0x01,0x66,0xdf,0xfb,0x00,
+0x00,0xf5,0xfe,0x23,0x01,0xa3,0xf9,0xf9,0x00,0x00,0xf9,0xfc,0x00,0x00,0xfc,0xfe,
+0x31,0x01,0x42,0x02,0x00,0xee,0xf7,0x4f,0x00,0x03,0x9e,0x00,0x33,0x02,0xfb,0xfb,
+0x62,0x01,0x16,0x00,0x15,0x00,0x14,0xf9,0xe7,0x01,0x15,0x02,0xf3,0x01,0x01,0xa4,
+0x01,0x13,0xfb,0x0f,0x00,0xf0,0x0a,0x03,0xf9,0xe1,0xf8,0x00,0x00,0xf2,0xfc,0xf2,
+0xfe,0x03,0xf2,0x03,0x03,0x02,0x03,0x00,0x03,0xf5,0xf6,0xfd,0xfa,0xf6,0xfa,0xf7,
+0xf5,0x01,0x26,0xfd,0xfc,0xcc,0x02,0x2a,0x02,0xfc,0x8e,0x01,0x02,0xea,0x01,0x1d,
+0xfc,0xa6,0x01,0x0f,0xa9,0x01,0x03,0x1f,0xf6,0x29,0x01,0x09,0x1b,0xfe,0x97,0x02,
+0x0f,0x23,0x00,0x02,0x03,0x8c,0x01,0x0f,0x01,0x00,0x0d,0x1f,0xfe,0x1d,0x00,0x0f,
+0x1e,0x02,0xa2,0x03,0x19,0x03,0x7e,0x00,0x11,0x03,0xfe,0x02,0x0f,0x01,0x00,0x21,
+0x0a,0xfd,0x00,0x1f,0xec,0x8c,0x00,0x0b,0x22,0xfd,0xfe,0x96,0x01,0x1c,0xee,0x22,
+0x02,0x20,0xfd,0x02,0x49,0x00,0x10,0x07,0x4c,0x04,0x0f,0x6c,0x00,0x13,0x17,0x02,
+0xaa,0x04,0x05,0x60,0x00,0x2c,0xfe,0x02,0x0d,0x01,0x1f,0xee,0xd2,0x00,0x23,0x1f,
+0xfd,0x73,0x01,0x0f,0x1f,0xfe,0x3b,0x00,0x1a,0x12,0x01,0x8d,0x02,0x10,0x02,0xdf,
+0x00,0x4d,0x04,0x00,0x04,0x05,0x21,0x00,0xf1,0x0c,0x06,0x07,0x08,0x09,0x0a,0x0b,
+0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,
+0x15,0x16,0x17,0x18,0x19,0x20,0x00,0xff,0x0d,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,
+0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,
+0x26,0x24,0x27,0x28,0x00,0x01,0x00,0xff,0xc4,0x02,0x33,0x02,0x20,0x03,0x02,0x2e,
+0x02,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,
+0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xf1,0x08,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,
+0x12,0x13,0x14,0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,
+0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,
+0x1f,0x22,0x00,0x00,0x23,0x2d,0x02,0xff,0xbd,0x50,0x00,0x00,0x00,0x00,0x00,0xf1,
+0x35,0x7f,0x56,0xf5,0x6f,0x46,0xf4,0x6f,0x46,0xf4,0x5f,0x45,0xf3,0x5f,0x32,0x71,
+0x00,0x04,0xd4,0x5f,0x50,0xb9,0x3f,0x1b,0x83,0xf0,0xb7,0x3f,0x0b,0x63,0xe0,0x52,
+0x16,0x00,0x00,0x00,0xe6,0x02,0xf3,0x00,0x00,0x2f,0x20,0x6e,0x00,0x00,0x06,0xe0,
+0x0a,0xb0,0x03,0xff,0xff,0xff,0xff,0xf7,0x04,0x4e,0x94,0x4f,0x64,0x10,0x00,0xf5,
+0x03,0xf1,0x00,0x00,0x3f,0x1b,0x00,0xf0,0x65,0xf0,0x09,0xc0,0x00,0xef,0xff,0xff,
+0xff,0xfc,0x03,0x3c,0xa3,0x3f,0x73,0x20,0x00,0xe6,0x02,0xf2,0x00,0x00,0x2f,0x30,
+0x5f,0x00,0x00,0x05,0xf0,0x08,0xc0,0x00,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x2f,
+0x40,0x00,0x00,0x16,0xf7,0x00,0x00,0x4f,0xff,0xff,0x40,0x1f,0xd3,0x04,0xee,0x05,
+0xf5,0x00,0x06,0xf5,0x6f,0x50,0x00,0x3d,0x63,0xfc,0x00,0x00,0x00,0x09,0xfe,0x71,
+0x00,0x00,0x06,0xef,0xfa,0x10,0x00,0x00,0x4b,0xfe,0x10,0x00,0x00,0x08,0xf7,0xca,
+0x00,0x00,0x1f,0x9c,0xf1,0x00,0x04,0xf8,0x5f,0xc4,0x36,0xef,0x20,0x6f,0xff,0xfe,
+0x40,0x00,0x06,0xf3,0x00,0x00,0x00,0x4f,0x10,0x00,0x02,0xbf,0xe7,0x56,0x00,0xf0,
+0x13,0x0d,0xa2,0x4f,0x40,0x04,0x30,0x00,0x0f,0x40,0x0c,0x70,0x1e,0x40,0x00,0x0e,
+0x80,0x2f,0x50,0xaa,0x00,0x00,0x04,0xef,0xf9,0x05,0xe1,0x00,0x00,0x00,0x01,0x00,
+0x1e,0x50,0x00,0x01,0x00,0x11,0xaa,0x06,0x00,0xf1,0x07,0x05,0xe1,0x4c,0xea,0x10,
+0x00,0x00,0x1e,0x52,0xf6,0x3b,0xc0,0x00,0x00,0xaa,0x06,0xd0,0x03,0xf0,0x00,0x05,
+0xe1,0x07,0x00,0x51,0x06,0x50,0x02,0xf6,0x2a,0xa7,0x00,0xf3,0x64,0x5d,0xfb,0x20,
+0x00,0x07,0xdf,0xd5,0x00,0x00,0x00,0x8f,0xa6,0xcf,0x40,0x00,0x00,0xdd,0x00,0x0f,
+0x90,0x00,0x00,0xed,0x00,0x3f,0x60,0x00,0x00,0x8f,0x65,0xec,0x00,0x00,0x00,0x0c,
+0xff,0x90,0x00,0x00,0x00,0x4e,0xff,0x30,0x00,0x10,0x05,0xfb,0x2e,0xe1,0x0a,0xe0,
+0x0e,0xe0,0x03,0xfd,0x0d,0xc0,0x0f,0xb0,0x00,0x5f,0xdf,0x70,0x0e,0xe0,0x00,0x08,
+0xff,0x10,0x05,0xfc,0x53,0x6e,0xff,0x70,0x00,0x3b,0xef,0xe9,0x2b,0xf5,0x0f,0x50,
+0xf5,0x0f,0x40,0xf3,0x05,0x00,0x00,0x01,0x90,0x00,0x0d,0xb0,0x00,0xad,0x00,0x04,
+0xf4,0x00,0x0b,0xd0,0x00,0x1f,0x80,0x00,0x6f,0x40,0x00,0x9f,0x10,0x00,0xbf,0x00,
+0x03,0x00,0x50,0xaf,0x00,0x00,0x7f,0x30,0x68,0x00,0x90,0x0e,0xb0,0x00,0x07,0xf2,
+0x00,0x00,0xda,0x00,0x0d,0x00,0xa1,0x04,0xe0,0x00,0x00,0x00,0x65,0x00,0x00,0x4f,
+0x50,0x15,0x00,0xf1,0x1f,0xdc,0x00,0x00,0x6f,0x30,0x00,0x1f,0x90,0x00,0x0c,0xd0,
+0x00,0x09,0xf1,0x00,0x08,0xf2,0x00,0x07,0xf3,0x00,0x08,0xf3,0x00,0x09,0xf2,0x00,
+0x0b,0xf0,0x00,0x0f,0xb0,0x00,0x3f,0x50,0x00,0x9e,0x00,0x02,0xf5,0x00,0x1d,0xa0,
+0x00,0x8a,0x00,0x01,0x00,0xf0,0x14,0x09,0xc0,0x00,0x00,0x08,0xc0,0x00,0x69,0x38,
+0xc1,0x77,0x6d,0xff,0xff,0xf9,0x00,0x4f,0xf6,0x00,0x00,0xcb,0xbd,0x00,0x08,0xf2,
+0x1e,0x90,0x01,0x40,0x04,0x20,0x00,0x00,0x5a,0x20,0xee,0x00,0x17,0x30,0x05,0x00,
+0x60,0x29,0x99,0xcf,0xa9,0x99,0x4f,0xeb,0x01,0x0b,0x19,0x00,0x01,0x05,0x00,0xf2,
+0x0c,0x0d,0xd0,0xdd,0x0f,0xa7,0xf3,0x25,0x00,0x01,0x11,0x1a,0xff,0xfe,0x24,0x44,
+0x30,0x6e,0x46,0xf4,0x00,0x00,0x06,0xf1,0x00,0x00,0x0c,0xb0,0xe3,0x01,0xf0,0x10,
+0x8e,0x00,0x00,0x00,0xe8,0x00,0x00,0x05,0xf2,0x00,0x00,0x0b,0xc0,0x00,0x00,0x1f,
+0x50,0x00,0x00,0x7e,0x00,0x00,0x00,0xe9,0x00,0x00,0x04,0xf3,0x00,0x00,0x0a,0x13,
+0x00,0xf0,0x1c,0x60,0x00,0x00,0x7f,0x10,0x00,0x00,0x55,0x00,0x00,0x00,0x02,0xae,
+0xfd,0x80,0x01,0xef,0x97,0xbf,0xa0,0x7f,0x50,0x00,0xaf,0x2c,0xf0,0x00,0x04,0xf6,
+0xed,0x00,0x00,0x2f,0x8e,0xc0,0x00,0x02,0xf9,0xfc,0x00,0x00,0x2f,0x9e,0x09,0x00,
+0x00,0x12,0x00,0xff,0x11,0x8b,0xf0,0x00,0x05,0xf6,0x7f,0x50,0x00,0xbf,0x20,0xef,
+0x96,0xbf,0x90,0x01,0xae,0xfd,0x70,0x00,0x00,0x04,0xab,0x29,0xef,0xfc,0x6e,0x93,
+0xfc,0x10,0x00,0xfc,0x00,0x03,0x00,0x08,0xf0,0x06,0x3b,0xef,0xd7,0x00,0x04,0xfe,
+0x87,0xbf,0xb0,0x0d,0xe1,0x00,0x0b,0xf3,0x1f,0xa0,0x00,0x06,0xf5,0x00,0x00,0x3d,
+0x01,0xc0,0x00,0x00,0x1e,0xa0,0x00,0x00,0x00,0xce,0x10,0x00,0x00,0x0b,0x59,0x02,
+0xf1,0x04,0xbf,0x40,0x00,0x00,0x0a,0xf4,0x00,0x00,0x00,0xaf,0x40,0x00,0x00,0x09,
+0xfa,0x66,0x66,0x65,0x0e,0x06,0x01,0xf0,0x01,0x4b,0xef,0xd7,0x00,0x06,0xfc,0x76,
+0xaf,0xb0,0x0e,0xd0,0x00,0x0a,0xf2,0x01,0x10,0x70,0x01,0xf0,0x04,0x00,0x12,0x7f,
+0x90,0x00,0x06,0xff,0xf9,0x00,0x00,0x01,0x45,0xaf,0x80,0x00,0x00,0x00,0x0a,0xf2,
+0x65,0x02,0x60,0xf6,0x1e,0x90,0x00,0x05,0xf6,0x69,0x00,0xa0,0xf2,0x05,0xfe,0x76,
+0xbf,0x90,0x00,0x4b,0xff,0xd6,0x87,0x01,0x70,0xcf,0x60,0x00,0x00,0x00,0x6f,0xf6,
+0x06,0x03,0xf0,0x15,0xdf,0x60,0x00,0x00,0x0b,0xd6,0xf6,0x00,0x00,0x06,0xf4,0x5f,
+0x60,0x00,0x01,0xfa,0x05,0xf6,0x00,0x00,0xbe,0x10,0x5f,0x60,0x00,0x5f,0x50,0x05,
+0xf6,0x00,0x1e,0xc1,0x11,0x6f,0x61,0x07,0x77,0x00,0x70,0xf4,0x24,0x44,0x44,0x8f,
+0x84,0x10,0x55,0x00,0x00,0x42,0x00,0x30,0x5f,0x60,0x00,0x17,0x00,0x60,0x80,0x9f,
+0x88,0x88,0x84,0x0b,0x17,0x02,0xf0,0x02,0xcc,0x00,0x00,0x00,0x0e,0xdc,0xff,0xa2,
+0x00,0xff,0xa8,0xbf,0xe1,0x03,0x30,0x00,0x8f,0x99,0x02,0x10,0xfd,0x16,0x03,0xf0,
+0x3f,0xe5,0xb1,0x00,0x00,0xed,0x3f,0x80,0x00,0x5f,0x80,0xaf,0xa6,0x8f,0xe1,0x00,
+0x7d,0xfe,0xa1,0x00,0x00,0x05,0xbe,0xd0,0x00,0x0b,0xfc,0x96,0x00,0x09,0xf5,0x00,
+0x00,0x02,0xf7,0x01,0x00,0x00,0x7f,0x7d,0xff,0xc2,0x0a,0xff,0x95,0x8f,0xe0,0xbf,
+0x50,0x00,0x7f,0x7c,0xf0,0x00,0x01,0xfb,0xbf,0x00,0x00,0x0f,0xb9,0xf3,0x00,0x01,
+0xfa,0x3f,0xb0,0x00,0x8f,0x50,0x9f,0xb6,0xaf,0xc0,0x00,0x7d,0xfe,0x90,0x00,0x0a,
+0x02,0x64,0xfd,0x16,0x66,0x66,0x67,0xf9,0x36,0x01,0x10,0x0e,0x36,0x01,0x10,0x7f,
+0x10,0x02,0x20,0xeb,0x00,0xc7,0x00,0x00,0x13,0x00,0x10,0xc0,0xe0,0x00,0x20,0x50,
+0x00,0x33,0x03,0x03,0xb2,0x00,0x20,0x0d,0xe0,0xac,0x03,0x12,0x70,0xe3,0x01,0xa0,
+0x02,0xfe,0x86,0xaf,0xc0,0x9f,0x40,0x00,0x9f,0x39,0xb4,0x02,0xf1,0x03,0x2f,0xc3,
+0x25,0xfc,0x00,0x3f,0xff,0xfc,0x00,0x1d,0xe7,0x59,0xf9,0x09,0xf2,0x00,0x08,0xf4,
+0xf5,0x01,0x90,0xd0,0x00,0x02,0xf9,0xbf,0x30,0x00,0x8f,0x52,0x2d,0x00,0x00,0x36,
+0x00,0xf2,0x1d,0x00,0x00,0x3b,0xef,0xc4,0x00,0x03,0xfe,0x87,0xdf,0x40,0x0b,0xf2,
+0x00,0x1e,0xd0,0x0f,0xb0,0x00,0x07,0xf3,0x0f,0xa0,0x00,0x05,0xf5,0x0e,0xe0,0x00,
+0x07,0xf6,0x07,0xfb,0x32,0x8f,0xf6,0x00,0x8f,0xff,0xc7,0xf4,0x00,0x01,0x32,0x9a,
+0x00,0xf4,0x05,0xd0,0x00,0x00,0x00,0x9f,0x50,0x00,0x16,0x8d,0xf9,0x00,0x00,0x2f,
+0xea,0x40,0x00,0x8f,0x38,0xe3,0x00,0x01,0x00,0x87,0x8e,0x38,0xf3,0x0b,0xd0,0x0b,
+0xd0,0x00,0x01,0x00,0x90,0x0b,0xf0,0x0b,0xe0,0x0e,0xb0,0x5f,0x40,0x15,0x0d,0x00,
+0xf1,0x12,0x2a,0x30,0x00,0x04,0xbf,0xf3,0x00,0x5c,0xfe,0x82,0x03,0xef,0xb5,0x00,
+0x00,0x4f,0xe6,0x10,0x00,0x00,0x29,0xff,0xa3,0x00,0x00,0x01,0x8e,0xfd,0x20,0x00,
+0x00,0x07,0xe4,0x33,0x00,0xda,0x12,0x22,0x22,0x22,0x09,0xff,0xff,0xff,0xf2,0x35,
+0x55,0x55,0x55,0x12,0x00,0x10,0x25,0x12,0x00,0x10,0x97,0x0c,0x02,0xd0,0xff,0x92,
+0x00,0x00,0x03,0x9f,0xfb,0x40,0x00,0x00,0x06,0xcf,0xd1,0x46,0x00,0xb5,0x20,0x06,
+0xcf,0xe8,0x10,0x7f,0xfc,0x60,0x00,0x0b,0xa3,0x7d,0x00,0xe2,0x8d,0xfd,0x80,0x00,
+0xbf,0xb8,0xbf,0xa0,0x3f,0x90,0x00,0xbf,0x10,0x31,0x5b,0x01,0x10,0xde,0xc0,0x00,
+0xa1,0x60,0x00,0x00,0x9f,0x80,0x00,0x00,0x5f,0x90,0x00,0x6a,0x02,0x24,0x00,0x34,
+0x32,0x00,0x10,0x7d,0x18,0x05,0x20,0xe2,0x00,0x37,0x03,0x30,0x9d,0xff,0xd9,0x81,
+0x01,0x40,0x07,0xfb,0x63,0x35,0x2c,0x00,0x10,0x09,0x9d,0x00,0x70,0x2d,0x90,0x00,
+0x05,0xf3,0x00,0x00,0x7b,0x05,0xf3,0x40,0x00,0xe8,0x00,0x06,0xde,0xb3,0x00,0x99,
+0x00,0x4f,0x10,0x08,0xf6,0x3c,0xc0,0x04,0xe0,0x09,0xc0,0x02,0xf6,0x00,0xba,0x00,
+0x2f,0x00,0xc9,0x00,0x8e,0x00,0x0c,0x90,0x01,0xf1,0x0e,0x70,0x0c,0xb0,0x00,0xe7,
+0x00,0x1f,0x10,0xd7,0x00,0xd9,0x00,0x0f,0x60,0x03,0xe0,0x0c,0x80,0x0d,0xa0,0x03,
+0xf5,0x00,0x9a,0x00,0xab,0x00,0x8f,0x43,0xce,0xb2,0x6f,0x20,0x05,0xf1,0x01,0xbf,
+0xc3,0x3d,0xfc,0x40,0x00,0x0e,0x90,0x80,0x00,0x24,0x4f,0x70,0x09,0x00,0x40,0xc6,
+0x32,0x47,0x60,0x09,0x00,0x41,0x18,0xcf,0xfd,0xb4,0x12,0x00,0x21,0x0c,0xf2,0x97,
+0x00,0x11,0xff,0x2b,0x00,0x30,0x9f,0xae,0x00,0x8d,0x01,0x20,0x93,0xf5,0x0c,0x02,
+0x20,0xf3,0x0d,0x1c,0x02,0xf1,0x03,0xcd,0x00,0x6f,0x20,0x00,0x00,0x2f,0x70,0x01,
+0xf8,0x00,0x00,0x08,0xf3,0x22,0x2b,0xe0,0x00,0x32,0x06,0xa0,0x50,0x00,0x5f,0x75,
+0x55,0x55,0xec,0x00,0x0b,0xe0,0x5c,0x02,0x10,0x02,0x63,0x02,0x41,0x3f,0x80,0x8f,
+0x40,0x0a,0x01,0xf0,0x04,0x7f,0xff,0xff,0xd8,0x00,0x7f,0xa7,0x77,0xcf,0xc0,0x7f,
+0x50,0x00,0x0b,0xf3,0x7f,0x50,0x00,0x07,0x02,0x04,0xf0,0x38,0x09,0xf3,0x7f,0x61,
+0x12,0x7f,0xb0,0x7f,0xff,0xff,0xfd,0x10,0x7f,0x84,0x44,0x7e,0xd1,0x7f,0x50,0x00,
+0x04,0xf9,0x7f,0x50,0x00,0x01,0xfb,0x7f,0x50,0x00,0x06,0xf9,0x7f,0x96,0x67,0xaf,
+0xe2,0x7f,0xff,0xff,0xd9,0x10,0x00,0x29,0xef,0xea,0x30,0x00,0x4f,0xf9,0x79,0xef,
+0x50,0x1e,0xe1,0x00,0x01,0xee,0x07,0xf6,0x00,0x00,0x08,0xf5,0xbf,0x10,0x00,0x00,
+0x14,0x2d,0xf0,0xa2,0x00,0x24,0xee,0x00,0xa8,0x02,0x71,0x00,0xcf,0x00,0x00,0x00,
+0x13,0x18,0x21,0x00,0x10,0x1f,0x2c,0x00,0x80,0x00,0x5f,0xe9,0x79,0xef,0x50,0x00,
+0x3a,0x42,0x00,0xb0,0x7f,0xff,0xfd,0xa3,0x00,0x07,0xfa,0x77,0x9e,0xf7,0x00,0x8a,
+0x00,0x30,0xf4,0x07,0xf5,0x6a,0x02,0xb0,0x7f,0x50,0x00,0x00,0x9f,0x27,0xf5,0x00,
+0x00,0x07,0xf4,0x0b,0x00,0x25,0x6f,0x57,0x0b,0x00,0x10,0xaf,0x16,0x00,0x20,0x1f,
+0xd0,0x2c,0x00,0x62,0xf5,0x07,0xf9,0x66,0x9e,0xf7,0x42,0x00,0x00,0xd1,0x00,0x80,
+0xff,0xf1,0x7f,0xa7,0x77,0x77,0x70,0x7f,0x2a,0x03,0x07,0x05,0x00,0x31,0x61,0x11,
+0x11,0x1e,0x00,0x6c,0x30,0x7f,0x84,0x44,0x44,0x00,0x1e,0x00,0x50,0x96,0x66,0x66,
+0x61,0x7f,0x61,0x02,0x10,0x7f,0x7f,0x07,0x40,0xfa,0x77,0x77,0x76,0x18,0x00,0x23,
+0x07,0xf5,0x21,0x00,0x50,0x07,0xf6,0x11,0x11,0x10,0x1b,0x00,0x5a,0x07,0xf8,0x44,
+0x44,0x40,0x1b,0x00,0x14,0xf5,0x45,0x00,0xf0,0x09,0x00,0x3a,0xef,0xeb,0x40,0x00,
+0x5f,0xe9,0x78,0xef,0x70,0x1f,0xe1,0x00,0x00,0xcf,0x28,0xf5,0x00,0x00,0x03,0x94,
+0xbf,0x10,0x01,0x01,0xf0,0x01,0xf0,0x00,0x01,0x11,0x10,0xee,0x00,0x05,0xff,0xff,
+0x8d,0xf0,0x00,0x14,0x47,0xf8,0x16,0x00,0xf1,0x08,0x3f,0x86,0xf7,0x00,0x00,0x03,
+0xf8,0x0e,0xf3,0x00,0x00,0x5f,0x80,0x3e,0xfa,0x77,0xaf,0xe2,0x00,0x18,0xdf,0xfd,
+0x81,0x4d,0x00,0x20,0x0d,0xf7,0x57,0x00,0x1d,0xdf,0x0b,0x00,0x61,0xf6,0x11,0x11,
+0x11,0xdf,0x7f,0x24,0x08,0x5f,0xf8,0x44,0x44,0x44,0xef,0x2c,0x00,0x08,0x4c,0xf0,
+0x4f,0x74,0xf7,0x03,0x00,0x10,0x70,0x47,0x02,0x1f,0xf0,0x05,0x00,0x15,0xf0,0x04,
+0x5c,0x30,0x00,0x0d,0xf0,0x5f,0x90,0x00,0x3f,0xc0,0x0c,0xfb,0x79,0xff,0x30,0x00,
+0x8d,0xff,0xb3,0x9d,0x00,0xf0,0x07,0x02,0xee,0x27,0xf5,0x00,0x02,0xee,0x20,0x7f,
+0x50,0x01,0xdf,0x30,0x07,0xf5,0x01,0xdf,0x40,0x00,0x7f,0x50,0xcf,0x3b,0x02,0xf0,
+0x04,0xcf,0x70,0x00,0x00,0x7f,0xef,0xfc,0x00,0x00,0x07,0xff,0x78,0xf9,0x00,0x00,
+0x7f,0x80,0x0c,0xf5,0x20,0x01,0x20,0x1e,0xf3,0x37,0x00,0x20,0x3f,0xd1,0x2b,0x01,
+0x21,0x6f,0xb0,0xd5,0x01,0x1e,0x80,0x44,0x01,0x0f,0x09,0x00,0x0d,0x00,0x2d,0x06,
+0x00,0xfa,0x00,0x30,0xc0,0x7f,0xf1,0x26,0x05,0x30,0xff,0x07,0xff,0xce,0x00,0x40,
+0xef,0xf0,0x7f,0xfe,0xbb,0x05,0xf0,0x25,0xff,0x07,0xf9,0xf5,0x00,0x00,0x0c,0xea,
+0xf0,0x7f,0x4f,0xb0,0x00,0x02,0xf8,0xaf,0x07,0xf4,0x9f,0x20,0x00,0x9f,0x2b,0xf0,
+0x7f,0x42,0xf9,0x00,0x0f,0xb0,0xbf,0x07,0xf5,0x0b,0xf0,0x06,0xf4,0x0c,0xf0,0x7f,
+0x50,0x4f,0x60,0xdd,0x00,0xcf,0x07,0xf5,0x00,0xdd,0x4f,0x60,0x0f,0x00,0x31,0x07,
+0xfd,0xf0,0x0f,0x00,0x30,0x1f,0xf9,0x00,0x0f,0x00,0x80,0x00,0x9f,0x20,0x00,0xcf,
+0x00,0x7f,0xb0,0x4b,0x01,0x20,0xff,0x50,0x4b,0x01,0x70,0xff,0x10,0x00,0x0d,0xf7,
+0xfa,0xfb,0x0b,0x00,0x20,0x59,0xf6,0x61,0x01,0x20,0x0e,0xf2,0x61,0x01,0x20,0x4f,
+0xc0,0x6c,0x01,0x20,0x9f,0x60,0x6c,0x01,0x70,0xdf,0x2d,0xf7,0xf5,0x00,0x03,0xfc,
+0x0b,0x00,0x20,0x08,0xff,0x82,0x01,0x20,0x0d,0xff,0xb2,0x00,0xf0,0x09,0x3f,0xf0,
+0x00,0x29,0xdf,0xe9,0x20,0x00,0x3f,0xfa,0x8a,0xff,0x40,0x1e,0xe2,0x00,0x02,0xee,
+0x17,0xf6,0x00,0x00,0x05,0xf7,0xfc,0x01,0x30,0x0f,0xcd,0xe0,0x81,0x03,0x10,0xed,
+0x1c,0x02,0x20,0xfd,0xe0,0x28,0x03,0x01,0x16,0x00,0x20,0xc7,0xf7,0x21,0x00,0xf0,
+0x01,0x1e,0xe2,0x00,0x01,0xdf,0x10,0x3f,0xfa,0x89,0xff,0x50,0x00,0x29,0xdf,0xea,
+0x20,0xb8,0x02,0x80,0xeb,0x30,0x07,0xfa,0x77,0x79,0xff,0x50,0x80,0x01,0x10,0xfe,
+0x15,0x01,0x20,0x09,0xf3,0x64,0x00,0x20,0x8f,0x47,0x6f,0x00,0x80,0xf1,0x7f,0x61,
+0x11,0x3b,0xfa,0x07,0xff,0x7e,0x08,0x42,0x7f,0x84,0x44,0x30,0x36,0x01,0x02,0x96,
+0x02,0x06,0x0b,0x00,0x00,0x80,0x05,0x50,0xef,0xd9,0x20,0x00,0x4f,0x90,0x00,0x10,
+0x1f,0x90,0x00,0x60,0x18,0xf5,0x00,0x00,0x06,0xf6,0x98,0x03,0x20,0x1f,0xbe,0xb5,
+0x05,0x20,0xed,0xfc,0x54,0x04,0x20,0xee,0xd0,0xe6,0x06,0x10,0xdf,0x16,0x00,0x20,
+0xb8,0xf6,0xfc,0x02,0xf1,0x01,0x1f,0xe1,0x00,0x02,0xee,0x10,0x4f,0xf9,0x8a,0xfe,
+0x30,0x00,0x2a,0xef,0xef,0xd2,0x2c,0x07,0x01,0x32,0x07,0x12,0x2c,0x57,0x00,0x01,
+0x0b,0x04,0x61,0x07,0xfa,0x77,0x7b,0xfe,0x20,0x20,0x04,0x10,0x07,0x9d,0x03,0x00,
+0xe9,0x01,0xf0,0x04,0x03,0xf9,0x07,0xf6,0x11,0x26,0xef,0x20,0x7f,0xff,0xff,0xfc,
+0x30,0x07,0xf8,0x44,0x8f,0x70,0x00,0x30,0x01,0x60,0x10,0x07,0xf5,0x00,0x05,0xf8,
+0x0b,0x00,0x40,0x0d,0xf1,0x07,0xf5,0x87,0x05,0x00,0xa0,0x00,0xd0,0xcf,0x10,0x00,
+0x18,0xdf,0xeb,0x40,0x00,0x2e,0xfa,0x78,0xdf,0x80,0x25,0x08,0x90,0xbf,0x30,0xcf,
+0x00,0x00,0x04,0xe6,0x09,0xf7,0x64,0x00,0x30,0x1d,0xfc,0x61,0x0a,0x07,0x20,0xdf,
+0xfc,0x73,0x00,0x40,0x27,0xdf,0xa0,0x00,0x45,0x08,0x80,0x52,0xe8,0x00,0x00,0x04,
+0xf8,0x0e,0xe2,0xd2,0x05,0xc0,0x4f,0xfa,0x78,0xbf,0xd0,0x00,0x19,0xdf,0xec,0x70,
+0x00,0x8f,0x21,0x03,0x90,0xe3,0x77,0x78,0xfc,0x77,0x76,0x00,0x00,0x3f,0x30,0x05,
+0x10,0x03,0xf7,0x04,0x0f,0x0b,0x00,0x1e,0x00,0x94,0x01,0x7f,0xbf,0x1b,0xf1,0x00,
+0x00,0x0b,0xf1,0x0b,0x00,0x13,0x30,0x19,0xf3,0x00,0x33,0x03,0xf0,0x09,0xa0,0x00,
+0x05,0xfb,0x00,0xbf,0xc8,0x7a,0xfe,0x20,0x00,0x6c,0xff,0xd8,0x00,0x00,0x8f,0x60,
+0x00,0x00,0x04,0xfa,0x2f,0xb0,0xfc,0x08,0xe1,0x0c,0xf1,0x00,0x00,0x0f,0xd0,0x06,
+0xf6,0x00,0x00,0x5f,0x70,0x00,0xfc,0x64,0x00,0x90,0x9f,0x20,0x01,0xfb,0x00,0x00,
+0x3f,0x70,0x06,0xcc,0x01,0xd1,0xd0,0x0c,0xe0,0x00,0x00,0x07,0xf3,0x1f,0x90,0x00,
+0x00,0x01,0xf8,0x02,0x08,0x26,0xbe,0xdc,0x71,0x01,0x21,0x0e,0xf1,0x38,0x00,0xf0,
+0x04,0x05,0xf7,0x00,0x00,0x7f,0x51,0xfb,0x00,0x00,0xaf,0xb0,0x00,0x0b,0xf1,0x0d,
+0xe0,0x00,0x0e,0xff,0x44,0x0b,0xf0,0x2a,0x8f,0x20,0x03,0xf9,0xf4,0x00,0x2f,0x90,
+0x04,0xf6,0x00,0x8f,0x1e,0x90,0x06,0xf5,0x00,0x1f,0xa0,0x0d,0xb0,0xae,0x00,0xaf,
+0x10,0x00,0xce,0x01,0xf6,0x05,0xf2,0x0e,0xc0,0x00,0x08,0xf2,0x6f,0x20,0x1f,0x71,
+0xf8,0x00,0x00,0x4f,0x6b,0xd0,0x00,0xcb,0x5f,0x40,0x00,0x01,0xf9,0xf8,0x00,0x07,
+0xf9,0x5c,0x0a,0x50,0xef,0x30,0x00,0x3f,0xec,0x81,0x0a,0x00,0x38,0x06,0xb0,0x80,
+0x00,0x00,0x04,0xf9,0x00,0x00,0x09,0xf4,0x00,0x00,0xcc,0x04,0xd0,0x2f,0xe1,0x06,
+0xfa,0x00,0x00,0xbf,0x50,0x00,0xbf,0x50,0x06,0xfa,0x13,0x00,0x80,0x1e,0xe1,0x00,
+0x00,0x06,0xf9,0xaf,0x50,0xd3,0x09,0x11,0xfa,0xaf,0x06,0x11,0xf3,0xe3,0x05,0x10,
+0xfb,0x72,0x02,0xf0,0x15,0xf9,0xaf,0x60,0x00,0x00,0x2f,0xe0,0x1e,0xf1,0x00,0x00,
+0xcf,0x40,0x05,0xfb,0x00,0x07,0xf9,0x00,0x00,0xaf,0x60,0x2f,0xe1,0x00,0x00,0x1e,
+0xf1,0x9f,0x70,0x00,0x00,0x1f,0xe0,0x1e,0xe0,0xb2,0x01,0xf1,0x02,0x06,0xf8,0x00,
+0x02,0xfc,0x00,0x00,0xdf,0x10,0x0a,0xf3,0x00,0x00,0x4f,0x80,0x2f,0xa0,0x48,0x01,
+0x61,0x20,0x00,0x00,0x02,0xfc,0xf8,0xe4,0x06,0x15,0xe0,0x94,0x01,0x0f,0x06,0x00,
+0x04,0x20,0x1f,0xff,0xe1,0x06,0x40,0x77,0x77,0x77,0x7f,0x1c,0x07,0x01,0x29,0x02,
+0x20,0x04,0xfb,0x99,0x0c,0x23,0xee,0x10,0x6d,0x0a,0x30,0x00,0x7f,0x90,0x2c,0x00,
+0x10,0xd0,0x69,0x03,0x01,0x24,0x00,0x10,0xf6,0x31,0x07,0x10,0xfa,0x24,0x00,0x60,
+0xef,0x76,0x66,0x66,0x64,0x3f,0x42,0x00,0x9f,0xa0,0x01,0x11,0xaf,0xfd,0xaf,0x53,
+0xaf,0x10,0x02,0x00,0x08,0x90,0x21,0xaf,0xfd,0x24,0x43,0x6f,0x30,0x00,0x00,0x9a,
+0x01,0x50,0x0a,0xe0,0x00,0x00,0x04,0x59,0x03,0x10,0xdb,0x62,0x00,0x20,0x20,0x00,
+0x6e,0x0c,0x01,0x61,0x07,0x23,0x05,0xf4,0xb3,0x09,0x20,0x8f,0x10,0x8b,0x07,0x10,
+0x00,0x47,0x0c,0x02,0xbf,0x09,0x8f,0x74,0x11,0x10,0xef,0xf9,0x45,0xf9,0x02,0x02,
+0x00,0x08,0x90,0x13,0xf9,0xef,0xf9,0x44,0x42,0x00,0x05,0x50,0x23,0x01,0xf0,0x0e,
+0x00,0x00,0x7f,0xf6,0x00,0x00,0xe9,0xbd,0x00,0x05,0xf3,0x4f,0x30,0x0c,0xc0,0x0e,
+0xa0,0x3f,0x60,0x07,0xf1,0x11,0x11,0x11,0x11,0x0f,0xff,0xff,0xff,0xfc,0x05,0xf1,
+0x07,0x44,0x20,0x17,0x60,0x00,0x8f,0x40,0x00,0x8e,0x10,0x03,0xbe,0xfd,0x60,0x03,
+0xfd,0x76,0xcf,0x60,0x9d,0x10,0x00,0x41,0x0d,0xf1,0x0e,0xe0,0x04,0xbe,0xff,0xff,
+0x07,0xfb,0x53,0x3c,0xf0,0xed,0x00,0x00,0xcf,0x0e,0xd0,0x00,0x2e,0xf0,0x8f,0xc8,
+0x9f,0xff,0x00,0x7d,0xfd,0x58,0xd2,0xbf,0x94,0x09,0x00,0x1e,0x01,0x05,0x09,0x00,
+0xf0,0x02,0x3c,0xfe,0xa1,0x0b,0xff,0x97,0xbf,0xd0,0xbf,0x40,0x00,0x9f,0x6b,0xf0,
+0x00,0x01,0xfa,0xa7,0x0a,0xf0,0x1c,0xcb,0xf0,0x00,0x00,0xfc,0xbf,0x00,0x00,0x2f,
+0xab,0xf5,0x00,0x09,0xf5,0xbf,0xf9,0x7b,0xfc,0x0b,0xe3,0xcf,0xea,0x10,0x00,0x19,
+0xef,0xc6,0x00,0x01,0xef,0x86,0xbf,0x90,0x0a,0xf3,0x00,0x0a,0xf1,0x0f,0xc0,0x00,
+0x02,0x72,0x12,0x01,0x01,0x17,0x01,0x00,0x20,0x0d,0x30,0x01,0x31,0x0a,0x2e,0x0d,
+0x91,0x02,0xef,0x86,0xaf,0x80,0x00,0x2a,0xef,0xd6,0x19,0x0e,0x1c,0xf5,0x05,0x00,
+0xf4,0x06,0x3b,0xfe,0xa7,0xf5,0x02,0xff,0x97,0xbf,0xf5,0x0a,0xf4,0x00,0x09,0xf5,
+0x0f,0xd0,0x00,0x05,0xf5,0x1f,0xa0,0x05,0x00,0xf0,0x19,0x0f,0xc0,0x00,0x05,0xf5,
+0x0a,0xf2,0x00,0x08,0xf5,0x02,0xfe,0x64,0x9f,0xf5,0x00,0x2b,0xff,0xb6,0xf5,0x00,
+0x19,0xef,0xd6,0x00,0x01,0xdf,0x86,0xbf,0x70,0x09,0xf3,0x00,0x0b,0xf0,0x0e,0xc1,
+0x11,0x17,0xf4,0xfe,0x01,0x80,0xf5,0x1f,0xb4,0x44,0x44,0x41,0x0f,0xc0,0x13,0x0a,
+0xe0,0xf5,0x00,0x02,0x70,0x01,0xef,0x96,0x8f,0xd0,0x00,0x19,0xef,0xe9,0x10,0x9f,
+0x0e,0x70,0x00,0x9f,0xf9,0x00,0x7f,0xa5,0x30,0xd0,0x06,0x10,0xdd,0xdc,0x0b,0x71,
+0xf0,0x24,0xee,0x44,0x00,0x0d,0xd0,0x43,0x0b,0x0f,0x07,0x00,0x02,0x50,0x00,0x3b,
+0xfe,0xa5,0xf6,0x99,0x00,0x10,0xf6,0x99,0x00,0x10,0xf6,0x99,0x00,0x34,0xf6,0x1f,
+0xa0,0x05,0x00,0x01,0x0f,0x00,0x01,0x19,0x00,0x01,0x23,0x00,0x01,0xc6,0x00,0x10,
+0x00,0x93,0x08,0xf0,0x00,0x01,0x80,0x00,0x0d,0xf1,0x05,0xfc,0x77,0xcf,0x80,0x00,
+0x3b,0xef,0xc6,0x00,0x96,0xbf,0x00,0x00,0x00,0x0b,0xf0,0x00,0x00,0x00,0x09,0x00,
+0xfe,0x0b,0x2b,0xfe,0xa1,0x0b,0xfe,0xa7,0xaf,0xb0,0xbf,0x60,0x00,0xbf,0x0b,0xf0,
+0x00,0x08,0xf2,0xbf,0x00,0x00,0x8f,0x3b,0xf0,0x00,0x08,0xf3,0x09,0x00,0x87,0x7f,
+0x26,0xe2,0x00,0x08,0xf2,0x8f,0x28,0x03,0x00,0xef,0x20,0x00,0x9e,0x10,0x08,0xd1,
+0x00,0x00,0x00,0x0a,0xf1,0x00,0xaf,0x10,0x05,0x00,0x05,0x57,0x04,0x8f,0xd0,0x8f,
+0xc3,0x75,0x00,0x06,0x09,0x00,0xf9,0x1c,0x06,0xfa,0x0b,0xf0,0x05,0xfb,0x00,0xbf,
+0x05,0xfc,0x00,0x0b,0xf4,0xfd,0x10,0x00,0xbf,0xef,0x80,0x00,0x0b,0xfd,0xcf,0x40,
+0x00,0xbf,0x22,0xee,0x10,0x0b,0xf0,0x04,0xfb,0x00,0xbf,0x00,0x08,0xf7,0x0b,0xf0,
+0x00,0x0c,0xf3,0x78,0x00,0x04,0x03,0x00,0xf0,0x0f,0xbe,0x3b,0xff,0xa1,0x2b,0xfe,
+0xb2,0x0b,0xfe,0x87,0xbf,0xcf,0xa7,0x9f,0xd0,0xbf,0x30,0x00,0xcf,0x80,0x00,0x9f,
+0x3b,0xf0,0x00,0x09,0xf3,0x00,0x06,0xf5,0xba,0x00,0x40,0x30,0x00,0x5f,0x5b,0xbd,
+0x00,0x2f,0x00,0x05,0x0f,0x00,0x0d,0x0f,0x0b,0x01,0x19,0xf1,0x0f,0x00,0x19,0xef,
+0xd8,0x00,0x01,0xdf,0x96,0xaf,0xc0,0x09,0xf4,0x00,0x07,0xf7,0x0f,0xc0,0x00,0x00,
+0xfc,0x1f,0xa0,0x00,0x00,0xcf,0x1f,0x90,0x00,0x00,0xdf,0x0f,0x00,0x10,0x0a,0x19,
+0x00,0xfe,0x28,0x01,0xef,0x96,0xaf,0xc0,0x00,0x19,0xef,0xd7,0x00,0xbe,0x5c,0xfe,
+0x91,0x0b,0xfe,0x64,0x9f,0xc0,0xbf,0x20,0x00,0x8f,0x5b,0xf0,0x00,0x02,0xfa,0xbf,
+0x00,0x00,0x0f,0xcb,0xf0,0x00,0x00,0xfc,0xbf,0x00,0x00,0x2f,0xab,0xf3,0x00,0x0a,
+0xf5,0xbf,0xe8,0x6b,0xfc,0x0b,0xf4,0xcf,0xea,0x10,0x2b,0x01,0xf4,0x07,0x00,0x3b,
+0xfe,0xa6,0xf5,0x02,0xff,0x86,0xaf,0xf5,0x0b,0xf4,0x00,0x08,0xf5,0x0f,0xd0,0x00,
+0x06,0xf5,0x1f,0xa0,0x05,0x00,0x60,0x0f,0xc0,0x00,0x06,0xf5,0x0a,0x19,0x00,0x01,
+0x23,0x00,0xae,0x00,0x3b,0xff,0xa7,0xf5,0x00,0x00,0x00,0x06,0xf5,0x05,0x00,0x80,
+0xbf,0x5d,0xf2,0xbf,0xf9,0x71,0xbf,0x40,0x5b,0x00,0x0e,0x03,0x00,0xf0,0x23,0x00,
+0x4c,0xfe,0xb4,0x00,0x5f,0xc6,0x7e,0xf4,0x0b,0xf0,0x00,0x2f,0xb0,0xaf,0x50,0x00,
+0x00,0x01,0xcf,0xea,0x50,0x00,0x00,0x38,0xcf,0xe3,0x02,0x10,0x00,0x3f,0xb0,0xfc,
+0x00,0x00,0xec,0x07,0xfc,0x66,0xcf,0x60,0x05,0xcf,0xfc,0x50,0x00,0x85,0x00,0x01,
+0xfa,0x03,0x00,0x62,0xef,0xff,0xf8,0x45,0xfb,0x42,0x0c,0x00,0x08,0x03,0x00,0x60,
+0x00,0xef,0x74,0x00,0x4d,0xf7,0x35,0x01,0x14,0x2b,0x50,0x01,0x0e,0x09,0x00,0xf0,
+0x6e,0x29,0xf3,0x00,0x0c,0xf2,0x3f,0xe7,0x8d,0xff,0x20,0x5d,0xfe,0x98,0xf2,0x8f,
+0x30,0x00,0x1f,0xa2,0xf9,0x00,0x06,0xf4,0x0c,0xe0,0x00,0xbe,0x00,0x6f,0x30,0x1f,
+0x90,0x01,0xf9,0x06,0xf3,0x00,0x0b,0xe0,0xbd,0x00,0x00,0x5f,0x5f,0x80,0x00,0x00,
+0xfe,0xf2,0x00,0x00,0x09,0xfc,0x00,0x00,0x00,0x3f,0x60,0x00,0x7f,0x30,0x00,0xbe,
+0x00,0x00,0xfa,0x2f,0x80,0x01,0xff,0x40,0x04,0xf6,0x0d,0xc0,0x05,0xfe,0x90,0x08,
+0xf1,0x09,0xf0,0x0a,0xb9,0xe0,0x0c,0xc0,0x04,0xf4,0x0f,0x64,0xf3,0x0f,0x80,0x00,
+0xf8,0x4f,0x10,0xe8,0x4f,0x30,0x00,0xbd,0x9c,0x00,0x9d,0x8e,0x00,0x00,0x6f,0xf7,
+0x00,0x4f,0xea,0x00,0x00,0x1f,0xf2,0x00,0x0f,0xf5,0x00,0x00,0x0d,0xd0,0xb8,0x02,
+0xf0,0x44,0x3f,0xc0,0x00,0x6f,0x80,0x8f,0x60,0x1f,0xd0,0x00,0xde,0x1a,0xf3,0x00,
+0x03,0xfc,0xf9,0x00,0x00,0x08,0xfd,0x00,0x00,0x00,0x9f,0xe1,0x00,0x00,0x4f,0xaf,
+0xa0,0x00,0x0e,0xe0,0x8f,0x50,0x09,0xf4,0x00,0xee,0x14,0xfa,0x00,0x04,0xfa,0x9f,
+0x30,0x00,0x3f,0x94,0xf9,0x00,0x08,0xf3,0x0e,0xe0,0x00,0xde,0x00,0x8f,0x40,0x3f,
+0x80,0x02,0xf9,0x08,0xf2,0x00,0x0c,0xe0,0xdd,0x00,0x00,0x7f,0x6f,0x70,0x00,0x01,
+0xff,0xf2,0x00,0x00,0x0b,0xa0,0x00,0xf1,0x5c,0x5f,0x60,0x00,0x00,0x07,0xf1,0x00,
+0x00,0x00,0xdb,0x00,0x00,0x18,0xcf,0x30,0x00,0x03,0xfd,0x50,0x00,0x00,0x1f,0xff,
+0xff,0xff,0x80,0x66,0x66,0x6e,0xf4,0x00,0x00,0x07,0xf8,0x00,0x00,0x03,0xfb,0x00,
+0x00,0x01,0xee,0x10,0x00,0x00,0xbf,0x40,0x00,0x00,0x7f,0x80,0x00,0x00,0x3f,0xb0,
+0x00,0x00,0x1e,0xf7,0x66,0x66,0x43,0xff,0xff,0xff,0xfc,0x00,0x00,0x02,0x00,0x00,
+0x1b,0xf1,0x00,0x0c,0xe2,0x00,0x03,0xf8,0x00,0x00,0x6f,0x50,0x00,0x07,0xf4,0x00,
+0x00,0x7f,0x40,0x00,0x08,0xf2,0x00,0x04,0xed,0x00,0x06,0xff,0x20,0x00,0x17,0xfb,
+0x00,0x00,0x09,0xf2,0x15,0x00,0x00,0x1c,0x00,0x51,0x6f,0x40,0x00,0x04,0xf7,0xd8,
+0x00,0x8a,0x00,0x2e,0xd1,0x00,0x00,0x05,0x00,0x6f,0x01,0x00,0xf1,0x15,0x38,0x10,
+0x00,0x00,0xae,0x40,0x00,0x0a,0xf2,0x00,0x01,0xf9,0x00,0x00,0xec,0x00,0x00,0xed,
+0x00,0x00,0xdd,0x00,0x00,0xcf,0x00,0x00,0x6f,0x81,0x00,0x09,0xfd,0x00,0x4f,0xb4,
+0x00,0xbf,0x12,0x00,0x11,0xed,0x1e,0x00,0xf0,0x18,0xfa,0x00,0x08,0xf4,0x00,0x8f,
+0x70,0x00,0x31,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x10,0x8f,0xfd,0x50,0x00,0xc9,
+0x6f,0x86,0xdf,0x93,0x7f,0x5b,0xc0,0x00,0x9f,0xff,0x90,0x00,0x00,0x00,0x14,0x20,
+0x00,0x01,0x00,0x22,0x50,0x00,0x01,0x00,0x22,0x3f,0x30,0x08,0x00,0x22,0x0b,0xfb,
+0x08,0x00,0x32,0x04,0xff,0xf4,0x09,0x00,0x31,0xcf,0xdf,0xc0,0x08,0x00,0x31,0x5f,
+0xe1,0xef,0x2c,0x00,0x40,0x0d,0xf6,0x06,0xfd,0x08,0x00,0x50,0x05,0xfd,0x00,0x0d,
+0xf5,0x09,0x00,0xf0,0x0b,0xdf,0x50,0x00,0x5f,0xd0,0x00,0x00,0x00,0x6f,0xc0,0x00,
+0x00,0xcf,0x60,0x00,0x00,0x0e,0xf4,0x00,0x00,0x04,0xfe,0x00,0x00,0x07,0xfb,0x4f,
+0x00,0xd1,0xf7,0x00,0x01,0xff,0x63,0x33,0x33,0x33,0x6f,0xf1,0x00,0x8f,0xff,0x01,
+0x00,0x32,0x80,0x1f,0xff,0x01,0x00,0x10,0x10,0x3e,0x00,0x21,0x02,0x89,0x56,0x00,
+0xf0,0x3a,0x03,0xff,0xff,0xb0,0x00,0x00,0x02,0x40,0xdf,0x30,0x9f,0x50,0x00,0x4d,
+0xff,0x4f,0xa0,0x02,0xf9,0x00,0x7f,0xf9,0x44,0xfe,0x10,0x6f,0x70,0x5f,0xd1,0x00,
+0x7f,0xfe,0xcf,0xe1,0x0e,0xf1,0x00,0x0a,0xff,0xff,0xd2,0x05,0xf7,0x00,0x00,0xdf,
+0xff,0x93,0xf4,0x8f,0x20,0x00,0x0f,0xfe,0x40,0x2f,0x8a,0xf0,0x00,0x03,0xfb,0x10,
+0x00,0xfa,0x8f,0x20,0x00,0x57,0x00,0x00,0x2f,0x85,0xf7,0x4d,0x00,0x50,0x07,0xf5,
+0x0e,0xe1,0x00,0xa1,0x01,0x30,0x00,0x6f,0xc1,0x09,0x03,0xe0,0x60,0x00,0x8f,0xe7,
+0x32,0x37,0xef,0x80,0x00,0x00,0x5e,0xff,0xff,0xfe,0x70,0x00,0x31,0x04,0x78,0x74,
+0xd5,0x00,0x40,0x1a,0xbb,0xbb,0xb7,0x08,0x00,0xf0,0x14,0x40,0x6f,0xff,0xff,0x23,
+0x60,0x00,0x00,0x6f,0x90,0xaf,0xff,0x72,0xef,0x30,0x00,0x13,0xec,0x00,0xcf,0xc0,
+0x1d,0x86,0x30,0x0b,0xf8,0x10,0x02,0xe2,0x00,0x0c,0xfb,0x00,0x9f,0x70,0x27,0x00,
+0x41,0x6a,0x20,0x3a,0xa0,0x38,0x00,0x31,0xef,0x56,0xff,0x08,0x00,0x41,0x0e,0xd5,
+0x04,0x90,0x09,0x00,0x41,0xa7,0x12,0xff,0x40,0x47,0x01,0x30,0xf3,0x0b,0x87,0x08,
+0x00,0x50,0x09,0x66,0x00,0x0b,0xf7,0x26,0x01,0xf0,0x02,0xff,0x30,0x00,0xcd,0x8b,
+0x10,0x00,0x0a,0xb6,0xb0,0x00,0x00,0x1d,0xf8,0xe7,0xeb,0xdf,0x7f,0x00,0x51,0x8a,
+0x8f,0x6f,0xe3,0x80,0x66,0x01,0x21,0x92,0x76,0x07,0x00,0x14,0x60,0x75,0x01,0x40,
+0x99,0xdf,0xec,0x70,0x3f,0x01,0xf0,0x2e,0xbf,0xfd,0xbb,0xef,0xe5,0x00,0x02,0xfe,
+0x20,0xbf,0xa0,0x00,0x4e,0xf6,0x00,0x5f,0xc0,0x00,0xaf,0xb0,0x00,0x1d,0xf3,0x00,
+0x9f,0xc1,0x00,0xaf,0x80,0x00,0x1f,0xc0,0x08,0xff,0xd1,0x1e,0xf4,0x00,0x00,0x8f,
+0x20,0xcd,0x6f,0xdd,0xf5,0x00,0x00,0x03,0xf6,0x0e,0xb0,0x5f,0xf6,0x00,0x00,0x00,
+0x2f,0x80,0xec,0x00,0x34,0x57,0x01,0x00,0x7c,0x05,0x01,0xb7,0x01,0x42,0x50,0x6f,
+0x50,0x00,0x8d,0x04,0x20,0xee,0x10,0x91,0x00,0x50,0xf8,0x00,0x04,0xfc,0x10,0xbf,
+0x01,0xf1,0x01,0x10,0x00,0x06,0xff,0x84,0x23,0x5b,0xfd,0x20,0x00,0x00,0x03,0xcf,
+0xff,0xff,0xf8,0x2f,0x00,0x31,0x26,0x77,0x40,0x08,0x00,0x71,0xbd,0xdd,0xdd,0xdd,
+0xdd,0x40,0x00,0xab,0x01,0xe0,0xe0,0x00,0x06,0xfe,0x21,0x11,0x13,0xf9,0x00,0x00,
+0xbf,0x80,0x00,0x00,0x79,0x01,0xe0,0xf2,0x00,0x00,0x0e,0xc0,0x00,0x04,0xfd,0x00,
+0x00,0x08,0xf6,0x00,0x00,0x9a,0x01,0xf0,0x00,0xf9,0x00,0x00,0x02,0xcf,0x60,0x1d,
+0xe4,0x00,0x00,0x02,0xff,0xec,0x0a,0xf2,0x17,0x02,0xf0,0x1c,0x4c,0x90,0xff,0x80,
+0x00,0x00,0x4f,0x80,0xf4,0x6d,0xde,0x00,0x00,0x06,0xf3,0x3f,0x0c,0x59,0xf1,0x00,
+0x00,0x6f,0x53,0x60,0x10,0xaf,0x00,0x00,0x01,0xfb,0x00,0x00,0x2f,0xb0,0x00,0x00,
+0x09,0xfb,0x31,0x5e,0xf3,0x00,0x00,0xda,0x01,0x11,0xf5,0x07,0x02,0x31,0x89,0x71,
+0x00,0x16,0x02,0x20,0x77,0x77,0x13,0x01,0xf0,0x04,0x4f,0xff,0xfe,0x00,0x00,0x01,
+0x15,0xff,0xff,0xe2,0x33,0x0e,0xff,0xff,0xfe,0xee,0xee,0xf4,0xf2,0x1e,0x00,0x21,
+0x0c,0x4f,0xbc,0x02,0xf1,0x00,0xc4,0xe2,0x0e,0xff,0xff,0xf2,0x0c,0x5e,0x20,0x9a,
+0xaa,0xaa,0x10,0xc5,0xe3,0x1a,0x00,0x22,0x5e,0x30,0x0d,0x00,0x02,0x1a,0x00,0x01,
+0xd4,0x02,0x03,0x1a,0x00,0xd3,0x5d,0xee,0xee,0xff,0xff,0xff,0xf5,0x12,0x26,0xff,
 0xff,0xe1,0x10,0x5b,0x00,0x43,0x00,0x01,0x55,0x55,0x01,0x03,0x30,0x03,0x44,0x10,
 0x10,0x00,0xf0,0x08,0x9f,0xff,0xff,0xc2,0xa3,0x00,0x04,0xef,0xff,0xee,0xff,0x5e,
-0xf8,0x03,0xff,0xe6,0x00,0x01,0x40,0xe5,0xbe,0xef,0xc1,0xeb,0x01,0x21,0x30,0x5e,
-0x93,0x0a,0x12,0xe3,0x17,0x0a,0x60,0x0e,0x30,0x00,0x03,0xcc,0x20,0x0f,0x00,0x31,
-0x00,0x2d,0xb1,0x0f,0x00,0x21,0x6f,0x70,0x1e,0x00,0x20,0xae,0x30,0x1e,0x00,0x40,
-0x32,0xdf,0xe1,0x00,0x42,0x15,0x30,0xf8,0xef,0xb0,0x0f,0x00,0x82,0xe4,0x04,0xff,
-0xd6,0x00,0x02,0x40,0x91,0x5a,0x00,0x12,0x50,0x69,0x00,0x11,0xc1,0x78,0x00,0x50,
-0x54,0x10,0x00,0x0d,0xee,0x01,0x00,0xa0,0xed,0x01,0xf2,0x4f,0xfa,0x22,0x22,0x22,
-0xe1,0x1f,0x93,0x11,0xf2,0x1a,0x79,0xaf,0x11,0xf0,0x03,0x31,0x02,0xcf,0xff,0xf1,
-0x1f,0x00,0x12,0x04,0xff,0xff,0xff,0x11,0xf0,0x1f,0xfa,0x05,0xdf,0xff,0xf1,0x1f,
-0x02,0xff,0xb0,0x00,0x7a,0x9f,0x11,0xf0,0x09,0xa5,0x00,0x00,0x00,0xe1,0x1f,0x88,
-0x02,0x41,0x11,0xf0,0x1f,0xf9,0x0f,0x00,0x00,0x1e,0x00,0x00,0x0f,0x00,0x22,0x1b,
-0xc7,0x1e,0x00,0x22,0x67,0x40,0x1e,0x00,0x11,0xfb,0x0f,0x00,0x12,0x01,0x1e,0x00,
-0x90,0xfe,0xef,0xff,0xee,0xee,0xee,0xf0,0x01,0x22,0x01,0x00,0x10,0x21,0xf8,0x00,
-0x41,0x58,0x98,0x51,0x00,0x06,0x0f,0x02,0x09,0x02,0xf0,0x00,0x1d,0xfc,0x7f,0x3e,
-0x5b,0xfc,0x10,0x00,0x0c,0xf7,0x02,0xf3,0xe0,0x07,0xfc,0xf4,0x04,0xf0,0x35,0x2f,
-0x3e,0x00,0x07,0xf7,0x00,0xed,0x00,0x02,0xf3,0xe0,0x00,0x0d,0xe0,0x3f,0x70,0x00,
-0x2f,0xfd,0x00,0x00,0x6f,0x35,0xf4,0x00,0x00,0x22,0x15,0x20,0x03,0xf5,0x6f,0x30,
-0x07,0xf4,0x04,0xff,0x60,0x2f,0x65,0xf5,0x09,0xe8,0xf2,0xdb,0x4e,0xb6,0xf5,0x1f,
-0xab,0xd3,0xcc,0x03,0xcd,0x39,0xff,0x10,0xbf,0xb3,0xea,0x00,0x00,0x7f,0x8f,0xb0,
-0x02,0xfd,0xf8,0x21,0x03,0x90,0xf2,0x00,0x05,0xfe,0x40,0x00,0x00,0x4d,0xf5,0xf7,
-0x17,0x41,0xd9,0x89,0xdf,0xe4,0x26,0x13,0x23,0xff,0xfd,0xa8,0x12,0x22,0x10,0x00,
-0x08,0x02,0x12,0x60,0x0b,0x17,0x20,0xff,0xff,0x3c,0x13,0x00,0xf2,0x0b,0x11,0x4e,
-0x06,0x14,0x10,0xeb,0xd2,0x02,0x00,0x1e,0x0a,0xf0,0x06,0x70,0x00,0x00,0xf8,0x1b,
-0xff,0x80,0x00,0xf8,0x00,0x00,0x1f,0x8c,0xff,0xff,0x90,0x0c,0xe1,0x00,0x08,0xf7,
-0x55,0x04,0xd0,0x4f,0xd6,0x5a,0xfa,0x6f,0xff,0xff,0xf3,0x00,0x4d,0xff,0xff,0x64,
-0x0b,0x16,0x30,0x03,0xef,0xdb,0xb7,0x12,0x60,0x60,0x01,0xed,0x20,0x7f,0xff,0x67,
-0x04,0x31,0xaf,0x10,0x6f,0xe7,0x0b,0x40,0x0f,0x80,0x2f,0xff,0xaf,0x05,0x31,0x02,
-0xf5,0x0b,0x90,0x04,0x32,0xf1,0x3f,0x75,0x99,0x04,0x13,0x22,0xa1,0x04,0x45,0xf2,
-0x03,0x33,0x20,0xfb,0x13,0x13,0x60,0x28,0x05,0x13,0x90,0x4f,0x13,0x13,0xa0,0x10,
-0x00,0x13,0xb0,0x08,0x00,0xa2,0xc1,0x00,0x09,0x99,0x98,0x88,0x88,0xbf,0xd1,0x00,
-0x3d,0x00,0xb1,0xd2,0x0b,0xbb,0xbb,0xbb,0xbc,0xcc,0xcc,0xa0,0x16,0x66,0x01,0x00,
-0x22,0x60,0x6f,0x18,0x00,0xa4,0x00,0x5f,0xfe,0xde,0xee,0xff,0xff,0xf0,0x00,0x4f,
-0x3a,0x00,0x12,0xc0,0x08,0x00,0x13,0x3e,0x08,0x00,0x13,0x2e,0x08,0x00,0x16,0x2c,
-0x7c,0x00,0x01,0xc1,0x02,0x22,0xb9,0x40,0x09,0x00,0x41,0x57,0x9e,0xf9,0x10,0x24,
-0x01,0x41,0x20,0x03,0xbf,0x70,0x8d,0x04,0x41,0xfb,0x50,0x3d,0xb0,0x12,0x00,0x40,
-0x8e,0xd4,0x05,0x00,0xb9,0x06,0x31,0x71,0x06,0xd2,0xa3,0x05,0x32,0x7c,0xf8,0x00,
-0xdd,0x01,0x20,0x43,0x80,0xdd,0x01,0x40,0xf9,0x20,0x4c,0xd3,0x0b,0x04,0x50,0xf8,
-0x00,0x00,0x0c,0xf4,0xed,0x01,0xf0,0x0f,0x01,0xcf,0x80,0x4f,0xf1,0x00,0x00,0xff,
-0xd0,0x6f,0xff,0x11,0xff,0x70,0x00,0x0b,0xfe,0x04,0xff,0xe0,0x3f,0xf3,0x00,0x00,
-0x1e,0xf5,0x04,0x72,0x0a,0xf9,0x9f,0x14,0x31,0xf5,0x00,0x08,0xbe,0x0e,0x40,0x06,
-0xcd,0xcd,0xa4,0xf0,0x0f,0x40,0xaa,0xaa,0xaa,0x80,0x26,0x02,0x00,0x48,0x01,0xf0,
-0x0d,0x8f,0x00,0x00,0x15,0x6f,0xb0,0x08,0xf0,0x00,0x02,0xe0,0x8f,0xb0,0x8f,0x00,
-0x00,0x2f,0x33,0xcf,0x78,0xf0,0x00,0x02,0xdd,0xd6,0xf8,0x8f,0x00,0xbc,0x0b,0x11,
-0x88,0x82,0x04,0x0f,0x0d,0x00,0x16,0x61,0x88,0x88,0x88,0x88,0x8f,0x86,0x24,0x01,
-0x15,0xf6,0xf6,0x00,0x32,0x01,0x31,0x00,0xa9,0x05,0x31,0xfe,0xfc,0x20,0x7e,0x06,
-0xf0,0x08,0x91,0x00,0x8f,0x23,0x10,0x00,0x00,0x07,0xb0,0x00,0x00,0x9f,0xef,0x90,
-0x00,0x00,0xc5,0x00,0x00,0x01,0x30,0x2c,0x90,0x81,0x03,0x00,0xff,0x04,0xf2,0x15,
-0x10,0x06,0xe2,0x00,0x00,0x02,0x6a,0x00,0xd4,0x01,0xf3,0x00,0x26,0xae,0xff,0xf2,
-0x0d,0x40,0x7b,0x04,0xef,0xff,0xc8,0x40,0x01,0xf1,0x0b,0x60,0x2c,0x84,0x38,0x00,
-0x00,0x2d,0x70,0xb5,0x3b,0x18,0xf0,0x0f,0x3f,0x09,0x70,0x00,0x05,0xff,0xd0,0x00,
-0x00,0xd3,0x4d,0x00,0x01,0xef,0xff,0x60,0x00,0x0e,0x30,0xc8,0x00,0x14,0x44,0x43,
-0x00,0x03,0xf0,0x02,0xea,0x20,0x4e,0x01,0x90,0xd7,0x00,0x01,0x9f,0xfe,0xff,0xff,
-0xff,0xe6,0x88,0x00,0x43,0x22,0x11,0x11,0x10,0x94,0x00,0x13,0x49,0x33,0x04,0x23,
-0x06,0xf8,0x11,0x00,0x42,0x6f,0x80,0x8d,0x10,0x11,0x00,0x20,0x0e,0xd0,0x71,0x07,
-0x40,0x05,0xef,0xe5,0x96,0x71,0x1a,0x30,0x93,0xfd,0x8d,0x8b,0x1b,0x90,0xe7,0x8b,
-0x8f,0x20,0x2f,0x80,0x00,0x0a,0xf2,0x2f,0x15,0x31,0xf8,0x00,0x00,0xe8,0x16,0x40,
-0xef,0x20,0x00,0x4f,0x07,0x03,0x51,0xfe,0x40,0x00,0x07,0xf0,0x44,0x00,0x33,0x00,
-0x00,0xac,0x55,0x00,0x23,0x0c,0xa0,0x11,0x00,0x13,0xe8,0x11,0x00,0x22,0x0f,0x70,
-0x11,0x00,0x28,0x01,0xf6,0x77,0x00,0x10,0x00,0x39,0x05,0xd2,0xeb,0x18,0xc3,0xb9,
-0xc6,0x04,0xd9,0xa0,0x8b,0x1d,0xfe,0x20,0x01,0x14,0x00,0x00,0x1a,0x17,0xd2,0x11,
-0x22,0x22,0x00,0x5d,0x00,0x00,0x0b,0xff,0xfe,0xef,0x20,0x4e,0xb1,0x02,0x12,0x00,
-0x08,0x00,0x31,0x8c,0x00,0x4f,0x08,0x00,0x12,0xe6,0x08,0x00,0x22,0x06,0xe0,0x08,
-0x00,0x40,0x0e,0x60,0x00,0x3f,0x03,0x09,0xc0,0x8d,0x00,0x00,0x3f,0x33,0x20,0x00,
-0x03,0xf3,0x00,0x00,0x3e,0x6e,0x19,0x11,0x60,0x08,0x00,0x31,0x01,0xd9,0x00,0x08,
-0x00,0x22,0x0d,0x80,0x08,0x00,0x11,0x05,0xb9,0x02,0x04,0x3b,0x08,0x0f,0x08,0x00,
-0x04,0x13,0x02,0x08,0x00,0xf3,0x00,0x17,0x00,0x00,0x04,0x77,0x88,0x85,0x00,0x5e,
-0x00,0x00,0x06,0x99,0x88,0xcc,0x88,0x00,0x13,0xaa,0x08,0x00,0x12,0xf5,0x08,0x00,
-0x22,0x08,0xd0,0x08,0x00,0xf0,0x03,0x3f,0x40,0x00,0x3f,0xdd,0xc0,0x00,0x02,0xe8,
-0x00,0x00,0x3f,0x55,0x40,0x00,0x3e,0x80,0x00,0xa0,0x00,0x31,0x09,0xe5,0x00,0x08,
-0x00,0x20,0x18,0x10,0xca,0x1b,0x03,0x5c,0x00,0x10,0x4e,0xb7,0x00,0x43,0x50,0x00,
-0x00,0x3c,0x08,0x00,0x2e,0x00,0x00,0x08,0x00,0xe3,0x0d,0xfe,0xee,0xee,0xff,0x30,
-0x00,0x00,0x01,0x33,0x33,0x33,0x32,0x00,0xeb,0x05,0x80,0x00,0x00,0x07,0xcc,0xcd,
-0xd9,0x00,0x4e,0xf6,0x05,0x41,0x43,0xab,0x00,0x5e,0x16,0x00,0x12,0xd8,0x80,0x00,
-0xc0,0x04,0xf2,0x00,0x4f,0x44,0x30,0x00,0x00,0x1e,0x80,0x00,0x4f,0xb9,0x12,0x12,
-0xcc,0x68,0x00,0x21,0x2d,0xc1,0x08,0x00,0x22,0x06,0xfa,0x00,0x01,0x22,0x1b,0x30,
-0xd8,0x00,0x60,0x00,0x03,0x33,0x33,0x44,0x43,0x28,0x01,0x00,0x9f,0x06,0x04,0x6a,
-0x17,0x00,0xa0,0x00,0x52,0x34,0x44,0x44,0x7e,0x00,0x38,0x0a,0x10,0xea,0x08,0x00,
-0x03,0x5f,0x09,0x50,0x1f,0x52,0x22,0x23,0x33,0x94,0x1c,0x00,0x30,0x00,0x15,0x40,
+0xf8,0x03,0xff,0xe6,0x00,0x01,0x40,0xe5,0xbe,0xef,0xc1,0xeb,0x01,0x11,0x30,0xaa,
+0x00,0x51,0x00,0xe3,0x00,0x09,0xf7,0x0f,0x00,0x40,0x00,0x03,0xcc,0x20,0x0f,0x00,
+0x31,0x00,0x2d,0xb1,0x0f,0x00,0x21,0x6f,0x70,0x1e,0x00,0x20,0xae,0x30,0x1e,0x00,
+0x30,0x32,0xdf,0xe1,0x2d,0x00,0x40,0xe9,0xf8,0xef,0xb0,0x0f,0x00,0x82,0xe4,0x04,
+0xff,0xd6,0x00,0x02,0x40,0x91,0x5a,0x00,0x12,0x50,0x69,0x00,0x11,0xc1,0x78,0x00,
+0x50,0x54,0x10,0x00,0x0d,0xee,0x01,0x00,0xf2,0x28,0xed,0x01,0xf2,0x4f,0xfa,0x22,
+0x22,0x22,0xe1,0x1f,0x02,0xff,0x90,0x00,0x79,0xaf,0x11,0xf0,0x03,0x31,0x02,0xcf,
+0xff,0xf1,0x1f,0x00,0x12,0x04,0xff,0xff,0xff,0x11,0xf0,0x1f,0xfa,0x05,0xdf,0xff,
+0xf1,0x1f,0x02,0xff,0xb0,0x00,0x7a,0x9f,0x11,0xf0,0x09,0xa5,0x00,0x00,0x00,0xe1,
+0x1f,0x88,0x02,0x41,0x11,0xf0,0x1f,0xf9,0x0f,0x00,0x00,0x1e,0x00,0x00,0x0f,0x00,
+0x22,0x1b,0xc7,0x1e,0x00,0x22,0x67,0x40,0x1e,0x00,0x11,0xfb,0x0f,0x00,0x12,0x01,
+0x1e,0x00,0x90,0xfe,0xef,0xff,0xee,0xee,0xee,0xf0,0x01,0x22,0x01,0x00,0x10,0x21,
+0xf8,0x00,0x30,0x58,0x98,0x51,0x48,0x00,0x22,0x08,0xff,0x09,0x02,0xf0,0x00,0x1d,
+0xfc,0x7f,0x3e,0x5b,0xfc,0x10,0x00,0x0c,0xf7,0x02,0xf3,0xe0,0x07,0xfc,0xf4,0x04,
+0xf0,0x35,0x2f,0x3e,0x00,0x07,0xf7,0x00,0xed,0x00,0x02,0xf3,0xe0,0x00,0x0d,0xe0,
+0x3f,0x70,0x00,0x2f,0xfd,0x00,0x00,0x6f,0x35,0xf4,0x00,0x00,0x22,0x15,0x20,0x03,
+0xf5,0x6f,0x30,0x07,0xf4,0x04,0xff,0x60,0x2f,0x65,0xf5,0x09,0xe8,0xf2,0xdb,0x4e,
+0xb6,0xf5,0x1f,0xab,0xd3,0xcc,0x03,0xcd,0x39,0xff,0x10,0xbf,0xb3,0xea,0x00,0x00,
+0x7f,0x8f,0xb0,0x02,0xfd,0xf8,0x21,0x03,0xf0,0x02,0xf2,0x00,0x05,0xfe,0x40,0x00,
+0x00,0x4d,0xf5,0x00,0x00,0x04,0xef,0xd9,0x89,0xdf,0xe4,0x78,0x00,0x42,0x7d,0xff,
+0xfd,0x70,0x88,0x01,0x22,0x10,0x00,0x08,0x02,0x02,0x12,0x03,0x41,0x09,0xff,0xff,
+0xe2,0xd2,0x03,0x40,0xf9,0x00,0x4e,0xd0,0x09,0x00,0x40,0xeb,0x00,0x00,0x5f,0xb2,
+0x01,0xf0,0x07,0x1f,0x70,0x00,0x00,0xf8,0x1b,0xff,0x80,0x00,0xf8,0x00,0x00,0x1f,
+0x8c,0xff,0xff,0x90,0x0c,0xe1,0x00,0x08,0xf7,0x55,0x04,0xf0,0x0f,0x4f,0xd6,0x5a,
+0xfa,0x6f,0xff,0xff,0xf3,0x00,0x4d,0xff,0xff,0x64,0xff,0xff,0xff,0x00,0x03,0xef,
+0xdb,0xef,0xff,0xff,0xff,0x60,0x01,0xed,0x20,0x7f,0xff,0x67,0x04,0x30,0xaf,0x10,
+0x6f,0xd7,0x02,0x50,0x50,0x0f,0x80,0x2f,0xff,0xaf,0x05,0x31,0x02,0xf5,0x0b,0x90,
+0x04,0x32,0xf1,0x3f,0x75,0x99,0x04,0x13,0x22,0xa1,0x04,0x54,0xf2,0x03,0x33,0x20,
+0x00,0x01,0x00,0x13,0x60,0x28,0x05,0x12,0x90,0x08,0x00,0x23,0x4f,0xa0,0x10,0x00,
+0x13,0xb0,0x08,0x00,0xa2,0xc1,0x00,0x09,0x99,0x98,0x88,0x88,0xbf,0xd1,0x00,0x3d,
+0x00,0xb1,0xd2,0x0b,0xbb,0xbb,0xbb,0xbc,0xcc,0xcc,0xa0,0x16,0x66,0x01,0x00,0x22,
+0x60,0x6f,0x18,0x00,0xa4,0x00,0x5f,0xfe,0xde,0xee,0xff,0xff,0xf0,0x00,0x4f,0x3a,
+0x00,0x12,0xc0,0x08,0x00,0x13,0x3e,0x08,0x00,0x13,0x2e,0x08,0x00,0x16,0x2c,0x7c,
+0x00,0x01,0xc1,0x02,0x22,0xb9,0x40,0x09,0x00,0x41,0x57,0x9e,0xf9,0x10,0x24,0x01,
+0x41,0x20,0x03,0xbf,0x70,0x8d,0x04,0x41,0xfb,0x50,0x3d,0xb0,0x12,0x00,0x40,0x8e,
+0xd4,0x05,0x00,0xb9,0x06,0x31,0x71,0x06,0xd2,0xa3,0x05,0x32,0x7c,0xf8,0x00,0xdd,
+0x01,0x20,0x43,0x80,0xdd,0x01,0x40,0xf9,0x20,0x4c,0xd3,0x0b,0x04,0x50,0xf8,0x00,
+0x00,0x0c,0xf4,0xed,0x01,0xf0,0x0e,0x01,0xcf,0x80,0x4f,0xf1,0x00,0x00,0xff,0xd0,
+0x6f,0xff,0x11,0xff,0x70,0x00,0x0b,0xfe,0x04,0xff,0xe0,0x3f,0xf3,0x00,0x00,0x1e,
+0xf5,0x04,0x72,0x0a,0x50,0x02,0x60,0x2d,0xf5,0x00,0x08,0xf9,0x00,0x83,0x08,0xb0,
+0xcd,0xcd,0xa4,0x00,0x00,0x00,0x2a,0xaa,0xaa,0xaa,0x80,0x26,0x02,0x00,0x48,0x01,
+0xf0,0x0c,0x8f,0x00,0x00,0x15,0x6f,0xb0,0x08,0xf0,0x00,0x02,0xe0,0x8f,0xb0,0x8f,
+0x00,0x00,0x2f,0x33,0xcf,0x78,0xf0,0x00,0x02,0xdd,0xd6,0xf8,0x8f,0x33,0x00,0x21,
+0x0f,0x88,0x82,0x04,0x0f,0x0d,0x00,0x16,0x61,0x88,0x88,0x88,0x88,0x8f,0x86,0x24,
+0x01,0x15,0xf6,0xf6,0x00,0x32,0x01,0x31,0x00,0xa9,0x05,0x31,0xfe,0xfc,0x20,0x7e,
+0x06,0xf0,0x08,0x91,0x00,0x8f,0x23,0x10,0x00,0x00,0x07,0xb0,0x00,0x00,0x9f,0xef,
+0x90,0x00,0x00,0xc5,0x00,0x00,0x01,0x30,0x2c,0x90,0x81,0x03,0x00,0xff,0x04,0xf0,
+0x39,0x10,0x06,0xe2,0x00,0x00,0x02,0x6a,0x00,0xd4,0x01,0xf3,0x00,0x26,0xae,0xff,
+0xf2,0x0d,0x40,0x7b,0x04,0xef,0xff,0xc8,0x40,0x01,0xf1,0x0b,0x60,0x2c,0x84,0x38,
+0x00,0x00,0x2d,0x70,0xb5,0x00,0x00,0x0b,0xf3,0x00,0x00,0x3f,0x09,0x70,0x00,0x05,
+0xff,0xd0,0x00,0x00,0xd3,0x4d,0x00,0x01,0xef,0xff,0x60,0x00,0x0e,0x30,0xc8,0x00,
+0x14,0x44,0x43,0x00,0x03,0xf0,0x02,0xea,0x20,0x4e,0x01,0x90,0xd7,0x00,0x01,0x9f,
+0xfe,0xff,0xff,0xff,0xe6,0x88,0x00,0x43,0x22,0x11,0x11,0x10,0x94,0x00,0x13,0x49,
+0x33,0x04,0x23,0x06,0xf8,0x11,0x00,0x42,0x6f,0x80,0x8d,0x10,0x11,0x00,0x20,0x0e,
+0xd0,0x71,0x07,0xf0,0x06,0x05,0xef,0xe5,0x96,0x00,0x00,0x4e,0xff,0x93,0xfd,0x8d,
+0xf3,0x00,0x00,0x2f,0xe7,0x8b,0x8f,0x20,0x2f,0x80,0xbd,0x07,0xf0,0x00,0x08,0xf2,
+0x02,0xf8,0x00,0x00,0xf9,0x00,0x00,0x2f,0xea,0xef,0x20,0x00,0x4f,0x07,0x03,0x51,
+0xfe,0x40,0x00,0x07,0xf0,0x44,0x00,0x33,0x00,0x00,0xac,0x55,0x00,0x23,0x0c,0xa0,
+0x11,0x00,0x13,0xe8,0x11,0x00,0x22,0x0f,0x70,0x11,0x00,0x28,0x01,0xf6,0x77,0x00,
+0x10,0x00,0x39,0x05,0xd2,0xeb,0x18,0xc3,0xb9,0xc6,0x04,0xd9,0xa0,0x8b,0x1d,0xfe,
+0x20,0x01,0x14,0x00,0xf2,0x02,0x15,0x00,0x00,0x00,0x11,0x22,0x22,0x00,0x5d,0x00,
+0x00,0x0b,0xff,0xfe,0xef,0x20,0x4e,0xb1,0x02,0x12,0x00,0x08,0x00,0x31,0x8c,0x00,
+0x4f,0x08,0x00,0x12,0xe6,0x08,0x00,0x22,0x06,0xe0,0x08,0x00,0x40,0x0e,0x60,0x00,
+0x3f,0x03,0x09,0xf1,0x02,0x8d,0x00,0x00,0x3f,0x33,0x20,0x00,0x03,0xf3,0x00,0x00,
+0x3e,0x00,0x00,0x00,0x1e,0x60,0x08,0x00,0x31,0x01,0xd9,0x00,0x08,0x00,0x22,0x0d,
+0x80,0x08,0x00,0x11,0x05,0xb9,0x02,0x04,0x3b,0x08,0x0f,0x08,0x00,0x04,0x13,0x02,
+0x08,0x00,0xf3,0x00,0x17,0x00,0x00,0x04,0x77,0x88,0x85,0x00,0x5e,0x00,0x00,0x06,
+0x99,0x88,0xcc,0x88,0x00,0x13,0xaa,0x08,0x00,0x12,0xf5,0x08,0x00,0x22,0x08,0xd0,
+0x08,0x00,0xf0,0x03,0x3f,0x40,0x00,0x3f,0xdd,0xc0,0x00,0x02,0xe8,0x00,0x00,0x3f,
+0x55,0x40,0x00,0x3e,0x80,0x00,0xa0,0x00,0x31,0x09,0xe5,0x00,0x08,0x00,0x10,0x18,
+0x68,0x01,0x13,0x4e,0x5c,0x00,0x10,0x4e,0xb7,0x00,0x43,0x50,0x00,0x00,0x3c,0x08,
+0x00,0x2e,0x00,0x00,0x08,0x00,0xe3,0x0d,0xfe,0xee,0xee,0xff,0x30,0x00,0x00,0x01,
+0x33,0x33,0x33,0x32,0x00,0xeb,0x05,0x80,0x00,0x00,0x07,0xcc,0xcd,0xd9,0x00,0x4e,
+0xf6,0x05,0x41,0x43,0xab,0x00,0x5e,0x16,0x00,0x12,0xd8,0x80,0x00,0xf2,0x02,0x04,
+0xf2,0x00,0x4f,0x44,0x30,0x00,0x00,0x1e,0x80,0x00,0x4f,0xee,0xd0,0x00,0x00,0xcc,
+0x68,0x00,0x21,0x2d,0xc1,0x08,0x00,0x22,0x06,0xfa,0x00,0x01,0x22,0x1b,0x30,0xd8,
+0x00,0x60,0x00,0x03,0x33,0x33,0x44,0x43,0x28,0x01,0x00,0x9f,0x06,0x13,0x00,0x1b,
+0x04,0x00,0xa0,0x00,0x52,0x34,0x44,0x44,0x7e,0x00,0x38,0x0a,0x10,0xea,0x08,0x00,
+0x03,0x5f,0x09,0x50,0x1f,0x52,0x22,0x23,0x33,0xce,0x03,0x00,0x30,0x00,0x15,0x40,
 0x20,0x01,0x40,0x01,0x34,0x45,0x53,0x38,0x01,0x43,0x08,0xdc,0xcc,0xdd,0x40,0x01,
 0x13,0x8b,0x08,0x00,0x11,0xc7,0x90,0x01,0x71,0x00,0x04,0xf1,0x00,0x3f,0xff,0xe0,
 0x98,0x00,0x10,0x3f,0x90,0x02,0x12,0xdc,0x68,0x01,0x21,0x5e,0xa0,0x08,0x00,0x22,
@@ -631,2067 +680,2472 @@ static const uint8_t lz4FontData[] ={
 0x40,0x53,0x33,0x32,0x6f,0x08,0x00,0x12,0x20,0xc8,0x00,0x0c,0x08,0x00,0x50,0x0f,
 0xdc,0xbb,0xcc,0xdd,0xb0,0x00,0x43,0x45,0x55,0x44,0x31,0x73,0x03,0xf1,0x00,0x70,
 0x00,0x03,0x44,0x55,0x30,0x04,0xf0,0x00,0x6d,0xcc,0xcd,0xf0,0x04,0xf0,0x25,0x02,
-0x01,0x07,0x00,0x41,0x0a,0xa0,0x04,0xf0,0x15,0x1e,0x30,0x03,0xff,0xfd,0x1a,0x01,
+0x01,0x07,0x00,0x21,0x0a,0xa0,0x07,0x00,0x50,0x2f,0x40,0x03,0xff,0xfd,0x1a,0x01,
 0xd0,0x03,0xf2,0x21,0x00,0x0b,0xe1,0x00,0x03,0xf0,0x00,0x04,0xdd,0x20,0x07,0x00,
-0x71,0xae,0x70,0x00,0x00,0x03,0xe0,0x00,0xaa,0x03,0xf2,0x24,0x20,0x00,0x02,0xd0,
+0x71,0xae,0x70,0x00,0x00,0x03,0xe0,0x00,0xaa,0x03,0xf2,0x23,0x20,0x00,0x02,0xd0,
 0x01,0xb0,0x09,0x40,0x00,0x03,0xe0,0x02,0xf0,0x0d,0x50,0x00,0x03,0xfe,0xee,0xf0,
 0x0f,0x70,0x00,0x03,0xe4,0x46,0xf0,0x4f,0xe0,0x00,0x03,0xe0,0x03,0xf0,0xb6,0xb9,
-0x00,0x03,0xe1,0x14,0xf5,0xd0,0x1e,0x30,0x02,0xef,0xff,0xaa,0x30,0x03,0x20,0x53,
-0x14,0x00,0xad,0x01,0x20,0x44,0x42,0x96,0x01,0x45,0x08,0xdd,0xdc,0xed,0xb6,0x02,
+0x00,0x03,0xe1,0x14,0xf5,0xd0,0x1e,0x30,0x02,0xef,0xff,0xaa,0x30,0x03,0xf0,0x04,
+0x10,0x2a,0xad,0x01,0x20,0x44,0x42,0x96,0x01,0x45,0x08,0xdd,0xdc,0xed,0xb6,0x02,
 0x02,0x08,0x00,0x13,0xd7,0xa6,0x01,0x33,0xf1,0x00,0x4f,0x0e,0x01,0x10,0x4f,0x1e,
 0x01,0x12,0xbc,0xce,0x00,0x22,0x1c,0xc0,0x9e,0x02,0x12,0xe9,0xa6,0x01,0x14,0x0b,
-0xa6,0x01,0x50,0x00,0x18,0xde,0xda,0x40,0xdb,0x00,0x43,0xeb,0x42,0x38,0xf6,0x62,
-0x1d,0x10,0x6e,0x86,0x01,0x10,0x80,0x33,0x04,0x70,0x00,0x00,0x0a,0xb0,0x00,0x00,
-0x6f,0x06,0x01,0x41,0xfa,0x31,0x27,0xf7,0x85,0x00,0x24,0xde,0xdb,0x19,0x0b,0x13,
-0x16,0x2e,0x02,0x19,0x5e,0x2e,0x02,0x07,0x88,0x00,0x00,0x80,0x00,0x56,0x1e,0x70,
-0x00,0x4f,0xff,0x2e,0x02,0x12,0x1c,0x2e,0x02,0x22,0x05,0xea,0xa6,0x02,0x22,0x1c,
-0x40,0xd8,0x00,0x32,0x00,0x01,0x11,0x6f,0x07,0x12,0x0f,0x26,0x0c,0x01,0x86,0x01,
-0x01,0x16,0x02,0x43,0x42,0x33,0x33,0x31,0x2e,0x02,0x10,0xfa,0x08,0x00,0x13,0x00,
-0x18,0x00,0x30,0x43,0x33,0x33,0x2e,0x02,0x00,0xd4,0x1c,0x22,0xee,0x20,0x23,0x0a,
-0xf1,0x05,0x00,0x71,0x01,0x34,0x45,0x40,0x0f,0x00,0xd4,0x09,0xdd,0xdd,0xf0,0x1f,
-0x00,0xd4,0x00,0x00,0x05,0xe0,0x07,0x00,0x21,0x09,0xb0,0x07,0x00,0x21,0x0c,0x70,
-0x07,0x00,0xc0,0x1f,0x20,0x1f,0x44,0xe4,0x00,0x00,0x7c,0x00,0x1f,0xcc,0xf4,0xed,
-0x03,0x00,0x15,0x00,0x21,0x07,0xe0,0x07,0x00,0x21,0x1f,0x50,0x07,0x00,0x20,0xca,
-0x00,0x07,0x00,0x91,0x09,0xd0,0x00,0x00,0x0f,0x00,0xd4,0x0c,0x10,0x07,0x00,0x01,
-0x91,0x05,0x2e,0x00,0xd5,0x07,0x00,0x32,0x00,0x00,0x41,0xd3,0x03,0x11,0x32,0x7e,
-0x00,0xd1,0x20,0x98,0x08,0xdc,0xcc,0xf3,0x0f,0x30,0x99,0x00,0x00,0x03,0xf2,0x07,
-0x00,0x50,0x09,0xd0,0x0f,0x40,0x99,0x28,0x1e,0x30,0x0f,0xff,0xf9,0x90,0x01,0x00,
-0x15,0x00,0x20,0x08,0xe2,0x07,0x00,0x00,0xee,0x0d,0xb1,0x0f,0x30,0x98,0x0a,0xd3,
-0x00,0x00,0x0e,0x20,0x98,0x06,0x93,0x0c,0x70,0x44,0x00,0x00,0x00,0x4a,0xcc,0xa5,
-0xf8,0x03,0x41,0xf8,0x44,0x8e,0xa0,0xf7,0x03,0x22,0x02,0xf4,0x95,0x01,0x11,0xc6,
-0x2f,0x20,0x80,0x01,0xf4,0x00,0x00,0x0b,0xd5,0x22,0x5d,0x0d,0x07,0x33,0x7c,0xed,
-0xb7,0x1a,0x1f,0xe0,0x20,0x66,0x67,0x78,0x50,0x00,0xe4,0x09,0xaa,0x99,0xce,0x00,
-0x0e,0x40,0xf4,0x00,0x21,0x00,0xe4,0xcc,0x04,0x21,0x0e,0x40,0x36,0x00,0x10,0xe4,
-0xd4,0x01,0xd0,0x11,0x1e,0x40,0x00,0x05,0xe1,0x7f,0xff,0xf4,0x00,0x01,0xe6,0x00,
-0x0d,0x00,0x70,0xba,0x00,0x00,0x00,0xe4,0x00,0x8d,0x17,0x03,0x11,0x40,0xaa,0x05,
-0x21,0xd4,0x5d,0x45,0x19,0x02,0x80,0x03,0x12,0xd4,0x29,0x04,0x02,0xa1,0x03,0x12,
-0xd3,0x0d,0x00,0x08,0x7b,0x07,0xc1,0x09,0x20,0x6b,0xcc,0xdd,0x60,0x00,0xe4,0x02,
-0x44,0x43,0xc9,0x68,0x00,0x30,0x0d,0x60,0x00,0xe8,0x0a,0x11,0xf2,0x0d,0x00,0xe0,
-0xbb,0x02,0x22,0xe4,0x00,0x00,0x5f,0x21,0xef,0xff,0x40,0x00,0x4f,0x50,0x68,0x00,
-0x10,0x6f,0x04,0x0d,0x30,0x40,0xad,0x30,0x75,0x00,0x11,0x05,0x8c,0x04,0x11,0x40,
-0x93,0x03,0x10,0xe3,0x22,0x03,0x33,0x00,0x0a,0x10,0x80,0x05,0x24,0x04,0xf0,0x2d,
-0x04,0x00,0xb3,0x03,0x00,0xa7,0x04,0x72,0x70,0x00,0x02,0x33,0x32,0x22,0x10,0xfb,
-0x20,0xb0,0x10,0x13,0x44,0x45,0x20,0x00,0xe5,0x08,0xdc,0xcc,0xed,0xcd,0x04,0x00,
-0xea,0x00,0x10,0xe5,0xea,0x00,0x20,0x22,0x2e,0xb9,0x1a,0x10,0x1e,0x2f,0x0b,0x50,
-0x2f,0x60,0x00,0x0e,0x50,0x42,0x1c,0x50,0x00,0xe5,0x00,0x4e,0x90,0x68,0x00,0x20,
-0x9e,0x50,0xd0,0x00,0x22,0x06,0x00,0xf7,0x0d,0xc1,0x2c,0xdd,0xdd,0xdd,0xd3,0x00,
-0x04,0xf5,0x44,0x44,0x4e,0x50,0x68,0x00,0xa1,0xd5,0x00,0x05,0xf0,0x00,0x00,0x0d,
-0x50,0x00,0x5f,0x0d,0x00,0xc2,0x03,0xfc,0xbb,0xbc,0xcf,0x40,0x00,0x03,0x45,0x54,
-0x44,0x30,0x5b,0x02,0xf0,0x00,0x81,0x04,0x56,0x67,0x30,0x0e,0x30,0xe3,0x0a,0xbb,
-0xae,0x90,0x0e,0x30,0xe3,0x4d,0x02,0x01,0x07,0x00,0x21,0x0f,0x40,0x07,0x00,0x21,
-0x2f,0x10,0x07,0x00,0x30,0x7c,0x36,0x6e,0x07,0x00,0x50,0xd6,0x8c,0xbf,0x30,0xe3,
-0x02,0x03,0x00,0x15,0x00,0x21,0x0c,0x90,0x07,0x00,0x20,0x6e,0x10,0x07,0x00,0x30,
-0x02,0xf5,0x00,0x07,0x00,0x20,0x1d,0x90,0x57,0x01,0x31,0xe3,0x38,0x00,0x07,0x00,
-0x11,0x00,0x72,0x01,0x08,0x07,0x00,0x23,0x0b,0x20,0xe9,0x1d,0x14,0x20,0x07,0x00,
-0x70,0x13,0x44,0x54,0x00,0x5c,0x0d,0x50,0x5c,0x02,0x21,0x06,0xd0,0xd3,0x04,0x40,
-0x20,0x5d,0x0d,0x50,0x5d,0x02,0x10,0x05,0x0f,0x00,0x40,0x01,0xf6,0xcf,0xfd,0x0f,
-0x00,0x30,0xbc,0x01,0x26,0x0f,0x00,0x60,0x8e,0x20,0x00,0x5d,0x0d,0x50,0x5f,0x02,
-0x00,0x1e,0x00,0x00,0x71,0x01,0x44,0x4c,0x0d,0x40,0x06,0x52,0x00,0x00,0x01,0x04,
-0x10,0xc0,0xbc,0x04,0x31,0xd0,0x00,0x3c,0xd2,0x0c,0x30,0x00,0x08,0xb0,0xbd,0x04,
-0xf1,0x0d,0xda,0x01,0xee,0x60,0x00,0x00,0x0c,0x91,0xd8,0x9a,0x3f,0x50,0x00,0x08,
-0xd0,0x02,0xed,0x10,0x4f,0x40,0x00,0x61,0x00,0x06,0x20,0x00,0x21,0x00,0x89,0x06,
-0x80,0x21,0x66,0x77,0x78,0x50,0x00,0xd4,0x19,0x64,0x02,0x12,0x0d,0x64,0x02,0x10,
-0xd4,0x7a,0x01,0x20,0xce,0xef,0x64,0x02,0x70,0x12,0x33,0xd4,0x00,0x00,0x0d,0x90,
-0x1a,0x00,0x20,0x05,0xf1,0x3d,0x02,0x21,0x01,0xe6,0x4a,0x02,0xe0,0xc9,0x00,0x8f,
-0xff,0xf4,0x00,0xac,0x00,0x01,0x22,0x2d,0x40,0xac,0x10,0x9e,0x0c,0x11,0x8b,0xb6,
-0x09,0x02,0x47,0x04,0x12,0xc5,0xc3,0x09,0x08,0x71,0x02,0x27,0x0c,0x30,0x64,0x02,
-0xc1,0x07,0x20,0x68,0x89,0x99,0x40,0x00,0xe5,0x07,0x88,0x77,0xd9,0xef,0x01,0x40,
-0x0e,0x6a,0xff,0xf5,0x5f,0x04,0x30,0x12,0x3e,0x50,0x59,0x22,0x00,0xfc,0x01,0x20,
-0x9e,0x10,0xfc,0x01,0xe0,0x9e,0x30,0x6f,0xff,0xf5,0x01,0xbd,0x20,0x00,0x00,0x0e,
-0x52,0xe8,0x00,0x64,0x02,0x12,0x01,0xa5,0x02,0xc2,0x00,0x12,0x33,0x33,0x33,0x20,
-0x00,0x0b,0xfe,0xee,0xee,0xef,0x68,0x00,0x18,0xe5,0x0a,0x07,0x09,0x0d,0x00,0x12,
-0xa2,0x64,0x02,0xf0,0x06,0x20,0x38,0x89,0x9a,0x70,0x00,0xc7,0x04,0x88,0x77,0xae,
-0x01,0x1d,0x70,0x00,0x00,0x09,0xa8,0xff,0xf7,0x00,0x7a,0x03,0x50,0x0c,0x70,0x00,
-0x00,0xca,0x7b,0x06,0xf0,0x05,0x00,0x9e,0x11,0x55,0x5d,0x70,0x00,0xbd,0x20,0x3c,
-0xcc,0xf6,0x04,0xdb,0x10,0x00,0x00,0x0c,0x60,0xb5,0x3b,0x00,0x71,0x93,0x00,0x00,
-0x33,0x33,0x34,0x44,0x19,0x24,0x24,0xee,0xf4,0x5b,0x00,0x50,0x03,0x44,0x44,0x44,
-0xe4,0x94,0x1c,0x31,0xff,0xed,0x10,0xcb,0x03,0x00,0x53,0x22,0xa2,0x22,0x23,0x33,
-0x20,0x00,0x3e,0xff,0xff,0xee,0xe9,0x11,0x00,0xf1,0x03,0x30,0x37,0x88,0x99,0x60,
-0x00,0xc7,0x05,0x98,0x87,0xbd,0x00,0x0b,0x70,0x00,0x00,0x0a,0xa7,0x72,0x0c,0x41,
-0xf5,0x02,0x3c,0x80,0x7e,0x08,0x10,0xb7,0x0d,0x04,0xf0,0x03,0x22,0x2c,0x70,0x00,
-0x2e,0x70,0x3f,0xff,0xf7,0x00,0x4e,0x70,0x00,0x00,0x0b,0x70,0x9e,0x40,0x0a,0x07,
-0x11,0x07,0xa0,0x01,0x60,0x30,0x00,0x00,0x4b,0xee,0xc7,0x28,0x17,0x31,0x72,0x25,
-0xdc,0xad,0x22,0x21,0x01,0xe5,0x5b,0x03,0x21,0x0b,0x80,0x67,0x07,0xe1,0xe6,0x00,
-0x00,0x9e,0x62,0x24,0xcd,0x00,0x00,0x00,0x6c,0xee,0xc8,0x10,0x11,0x09,0xf0,0x13,
-0x02,0xa1,0x45,0x56,0x60,0x04,0xd0,0x3e,0x6c,0xcc,0xcf,0x20,0x4c,0x03,0xe0,0x00,
-0x03,0xf0,0x04,0xc0,0x3e,0x00,0x00,0x6d,0x24,0x8c,0x03,0xe0,0x00,0x0a,0x98,0xde,
-0xc0,0x3f,0x21,0x01,0xc0,0x4c,0x03,0xf0,0x00,0x5f,0x00,0x04,0xc0,0x3f,0x00,0x0b,
-0x90,0x0d,0x00,0xf1,0x0c,0x04,0xf1,0x9f,0xff,0xc0,0x3f,0x00,0xd8,0x01,0x22,0x6c,
-0x03,0xf0,0xad,0x00,0x00,0x04,0xd0,0x3f,0x6e,0x20,0x00,0x00,0x4d,0x03,0xfa,0x30,
-0x0d,0x00,0x00,0x5b,0x00,0x10,0x4d,0x79,0x00,0x04,0x0d,0x00,0x33,0x3c,0x03,0xe0,
-0xa4,0x05,0x13,0x00,0x22,0x0a,0x01,0x68,0x0c,0x02,0x3e,0x0a,0x13,0xd7,0xc7,0x0b,
-0x03,0x48,0x0c,0x13,0xd6,0xa0,0x08,0x12,0x50,0xff,0x0f,0x01,0x06,0x0d,0x51,0x9b,
-0x00,0x0f,0x30,0x00,0x71,0x02,0x12,0xf1,0x0f,0x00,0x11,0x07,0xdb,0x01,0x03,0x28,
-0x0c,0x11,0x9a,0x08,0x07,0x81,0xcc,0xde,0xed,0xdd,0xdd,0xdc,0x23,0x55,0x01,0x00,
-0x15,0x50,0x27,0x0b,0x30,0xff,0xff,0xff,0xd6,0x11,0x62,0x02,0x22,0x22,0x22,0x9b,
-0x00,0xc8,0x02,0x12,0xa0,0x4f,0x0d,0x21,0x8a,0x00,0x0c,0x03,0x11,0x09,0x8a,0x1a,
-0x35,0xf0,0x00,0x97,0xa2,0x09,0xf5,0x00,0x13,0x34,0x47,0xf4,0x44,0x44,0x44,0x09,
-0xee,0xee,0xed,0xdd,0xee,0xee,0xe2,0x8c,0x02,0x11,0x22,0xb2,0x01,0x00,0xb3,0x01,
-0x38,0xfe,0xff,0x00,0xab,0x04,0x04,0xd9,0x09,0x1a,0x03,0x0f,0x00,0x14,0x02,0x6b,
-0x20,0x0a,0x87,0x00,0x13,0x8c,0xda,0x02,0x12,0xb0,0x87,0x00,0x12,0x7b,0x32,0x00,
-0x22,0x08,0xa0,0x41,0x00,0x15,0x88,0x41,0x00,0xf5,0x00,0x25,0x55,0x57,0xf5,0x55,
-0x55,0x55,0x07,0xdd,0xdc,0xcc,0xcc,0xcc,0xdd,0xc1,0x4c,0x00,0x12,0x70,0x74,0x0d,
-0x22,0x1f,0x10,0x81,0x0a,0xf1,0x02,0xf6,0x54,0x44,0x57,0xe0,0x00,0x00,0x1f,0xdc,
-0xcc,0xcc,0xde,0x00,0x00,0x01,0xf1,0x00,0x69,0x25,0x50,0x1f,0x31,0x11,0x11,0x5e,
-0x6d,0x10,0x02,0x78,0x00,0x0f,0x0e,0x01,0x07,0x01,0x87,0x00,0x43,0x01,0x80,0x00,
-0x8a,0x87,0x00,0x03,0x0e,0x01,0x15,0x76,0x87,0x00,0x12,0x7e,0x9e,0x0d,0x33,0x11,
-0x33,0x33,0x00,0x01,0x04,0xc5,0x0a,0x30,0x9c,0xdc,0x81,0x2c,0x00,0x30,0xfa,0x42,
-0x4b,0x23,0x01,0x10,0xca,0x06,0x09,0x02,0x48,0x03,0x52,0x6c,0x00,0x00,0x00,0xc9,
-0x0f,0x00,0x50,0x04,0xf8,0x32,0x4a,0xf2,0x26,0x00,0x34,0xad,0xec,0x81,0xd2,0x03,
-0x11,0x00,0xf0,0x07,0x00,0xc0,0x00,0x10,0x0d,0xf6,0x0d,0xa1,0x0f,0x10,0x00,0x00,
-0x11,0x00,0x2f,0x20,0x0f,0x20,0xd9,0x07,0x23,0x10,0x0f,0xb0,0x0c,0x03,0x08,0x00,
-0x01,0xfa,0x01,0xf1,0x04,0x0c,0x40,0x3e,0x00,0x0f,0x52,0x20,0x00,0x0c,0x60,0x4d,
-0x00,0x0f,0xff,0xe0,0x00,0x0c,0x60,0x6b,0x18,0x00,0x32,0x0b,0x60,0x46,0x08,0x00,
-0x23,0x70,0x00,0x08,0x00,0xf2,0x03,0x02,0x44,0x0f,0x30,0x00,0x8f,0xef,0xff,0xff,
-0xc7,0x0f,0x30,0x00,0x02,0x22,0x11,0x00,0x00,0x48,0x00,0x0e,0x08,0x00,0x03,0x8c,
-0x02,0x00,0x78,0x06,0x70,0x03,0xef,0xff,0xff,0x20,0x0f,0x30,0xe2,0x01,0x42,0x2f,
-0x40,0x0e,0x40,0x9b,0x06,0x08,0x08,0x00,0x22,0x05,0x60,0x08,0x00,0xfa,0x13,0x07,
-0xb0,0x0e,0x40,0x0e,0x73,0x20,0x00,0x07,0xb0,0x06,0x00,0x0e,0xff,0xe1,0x00,0x07,
-0xb0,0x02,0x44,0x0e,0x50,0x00,0x6e,0xef,0xff,0xff,0xd8,0x0e,0x50,0x00,0x02,0x22,
-0x21,0x69,0x0b,0xa3,0x06,0xa0,0x00,0x00,0x0a,0x30,0x00,0x00,0x07,0xc0,0x7b,0x02,
-0x0b,0x08,0x00,0x50,0x06,0xff,0xee,0xee,0xff,0xf8,0x02,0x47,0x23,0x33,0x33,0x22,
-0xf5,0x04,0x02,0x1e,0x03,0x00,0xc0,0x00,0x23,0x11,0xc8,0x1e,0x03,0x03,0x06,0x10,
-0x17,0xc6,0x1e,0x03,0x41,0x60,0x03,0x20,0xe4,0xa6,0x01,0x30,0xb8,0x0f,0x30,0xb5,
-0x01,0x32,0x0b,0x81,0xf1,0x0f,0x00,0x21,0x03,0x00,0x0f,0x00,0x12,0x80,0xc4,0x01,
-0x00,0x23,0x08,0xa0,0x6d,0xde,0xfd,0xdf,0xed,0xdd,0xdd,0x22,0x54,0x44,0x01,0x00,
-0x60,0x40,0x00,0x04,0x44,0x44,0x55,0x61,0x00,0x43,0xcd,0xdc,0xcc,0xcf,0x6d,0x0b,
-0x17,0xe5,0x5a,0x00,0x01,0x17,0x08,0x02,0xc6,0x00,0x03,0x2e,0x01,0x22,0xf2,0x00,
-0xa5,0x04,0x02,0x3c,0x02,0x51,0x22,0x33,0x34,0x07,0xef,0x78,0x12,0x15,0xc0,0xaa,
-0x07,0x05,0x0d,0x03,0x04,0x0f,0x00,0x12,0xe0,0x08,0x00,0x1a,0x4e,0x0f,0x00,0x18,
-0x28,0xbb,0x0f,0x13,0x04,0x90,0x02,0x44,0x01,0x22,0x22,0x21,0x9e,0x03,0x03,0xd5,
-0x03,0x04,0xf3,0x27,0x03,0xbd,0x02,0x10,0x65,0x58,0x05,0x00,0x01,0x00,0x12,0x30,
-0x90,0x02,0x2c,0xfe,0x20,0x6f,0x03,0x30,0x22,0x25,0xf2,0x9e,0x02,0x1e,0x4f,0x9e,
-0x03,0x0f,0xa0,0x00,0x03,0x22,0x02,0xb0,0x77,0x0a,0x21,0x20,0x00,0x80,0x15,0x19,
-0xf4,0x06,0x01,0x19,0xe5,0x05,0x01,0x14,0xe2,0x82,0x11,0xe0,0x8f,0xfe,0xee,0xee,
-0xee,0xef,0xfb,0x02,0x23,0x33,0x4f,0x42,0x22,0x20,0x9f,0x02,0x11,0x20,0xbd,0x01,
-0xa1,0x27,0x23,0x32,0x00,0x00,0xce,0xee,0xe0,0xad,0xef,0xea,0x00,0x00,0x92,0x00,
-0xc1,0x24,0x47,0xe0,0x00,0x2f,0x00,0x00,0xee,0xdd,0x80,0x00,0x2f,0x50,0x00,0x00,
-0x07,0x00,0x30,0xe7,0x22,0x21,0x07,0x00,0x69,0xaf,0xff,0xfa,0x00,0x1d,0x00,0x01,
-0x00,0xd1,0x30,0x00,0x45,0x55,0x55,0x20,0x03,0xe0,0x00,0xbc,0xcc,0xcd,0xc0,0x2e,
-0x05,0x12,0x06,0x07,0x00,0x41,0x07,0xb0,0x03,0xf0,0xb5,0x04,0x02,0x50,0x05,0xe0,
-0x63,0x03,0xe0,0x3c,0xcc,0xcd,0xef,0xfd,0x33,0xe0,0x04,0x44,0xca,0x21,0x54,0x0c,
-0xb0,0x00,0xa8,0x00,0x44,0x47,0xe0,0x00,0x00,0xa9,0x00,0xbc,0xeb,0x20,0x12,0x65,
-0x18,0x01,0x00,0xdc,0x1d,0x12,0xe0,0x75,0x01,0x42,0x20,0x00,0x05,0xe0,0xbd,0x01,
-0x13,0xe0,0x75,0x01,0x41,0xee,0xee,0xef,0xf2,0x74,0x02,0x22,0x32,0x20,0x44,0x10,
-0xd0,0x00,0xad,0xdd,0xde,0xc0,0x02,0xf0,0x03,0x44,0x44,0x5f,0x10,0x2f,0x1c,0x01,
-0x21,0xf1,0x01,0xd0,0x0c,0x01,0x70,0x0b,0x21,0x02,0xf0,0x0d,0x00,0x11,0x3e,0x0d,
-0x00,0x41,0x04,0xc0,0x01,0xf0,0x45,0x09,0xe1,0x1f,0x01,0x22,0x22,0x34,0x68,0x61,
-0xf0,0x9e,0xee,0xfe,0xcb,0x84,0x1f,0xcc,0x09,0x21,0x01,0xf0,0x32,0x01,0x0c,0x0d,
-0x00,0x21,0x0f,0x40,0x96,0x04,0x11,0xe3,0xb3,0x04,0x11,0x01,0xbd,0x04,0x05,0x7f,
-0x02,0x3a,0xdd,0xcc,0xcf,0xf7,0x05,0x04,0x06,0x06,0x1a,0xc5,0x8e,0x02,0x15,0xe3,
-0x7f,0x02,0x16,0x03,0x7f,0x02,0x71,0xee,0xfe,0xee,0xd1,0x00,0x00,0xf3,0x6e,0x0a,
-0x00,0xd7,0x03,0x01,0xae,0x01,0x0f,0x0f,0x00,0x0b,0x31,0x91,0x00,0x09,0x29,0x0f,
-0x42,0xee,0xee,0xff,0xf9,0x77,0x03,0x13,0x29,0x70,0x02,0x18,0x8b,0x1d,0x06,0x33,
-0x00,0x00,0x99,0x0f,0x00,0x15,0x70,0x94,0x03,0x11,0xee,0x01,0x00,0x80,0xe2,0x13,
-0x33,0x37,0xe3,0x39,0xc3,0x33,0x60,0x2b,0x01,0xbb,0x05,0x31,0x07,0x05,0xd0,0x43,
-0x05,0x40,0xf2,0x5d,0x00,0x7a,0x69,0x00,0x21,0x20,0x10,0xe0,0x04,0x03,0x30,0x03,
-0x04,0xc8,0x0c,0x00,0x73,0x01,0x1a,0xf5,0x6d,0x0f,0x01,0x04,0x17,0x00,0x27,0x25,
-0x00,0xff,0x02,0x33,0x21,0x11,0xf5,0x9e,0x04,0x03,0x8e,0x03,0x13,0xf3,0x0f,0x00,
-0x12,0x20,0xb8,0x05,0x19,0xf1,0x59,0x06,0x2a,0x04,0xd0,0x48,0x10,0x01,0x9c,0x06,
-0x00,0x01,0x00,0x13,0x20,0x4a,0x18,0x09,0x21,0x13,0x00,0x29,0x00,0x14,0xef,0x6f,
-0x07,0x33,0x22,0x11,0xc7,0xcf,0x18,0x0a,0x51,0x04,0x13,0x0c,0x69,0x01,0x41,0x82,
-0x00,0x00,0x11,0x01,0x00,0x26,0x10,0x9f,0x4b,0x00,0x00,0x71,0x41,0x04,0x01,0x00,
-0x00,0x87,0x03,0x00,0x16,0x0b,0x10,0x3e,0x0a,0x03,0x0f,0x68,0x03,0x11,0x17,0x03,
-0xa5,0x28,0x52,0x2d,0xdd,0xde,0xee,0xe5,0x44,0x00,0x22,0x3c,0x80,0x13,0x00,0x1f,
+0xa6,0x01,0x50,0x00,0x18,0xde,0xda,0x40,0xdb,0x00,0x40,0xeb,0x42,0x38,0xf6,0x57,
+0x06,0x40,0xc0,0x00,0x00,0x6e,0x86,0x01,0x10,0x80,0x33,0x04,0x70,0x00,0x00,0x0a,
+0xb0,0x00,0x00,0x6f,0x06,0x01,0xe0,0xfa,0x31,0x27,0xf7,0x00,0x00,0x00,0x00,0x2a,
+0xde,0xdb,0x50,0x00,0x00,0x10,0x00,0x01,0x00,0xf1,0x02,0x16,0x00,0x00,0x07,0xcc,
+0xcd,0xd9,0x00,0x5e,0x00,0x00,0x03,0x44,0x43,0xab,0x00,0x5e,0x16,0x00,0x30,0xd7,
+0x00,0x4e,0x07,0x00,0xf1,0x03,0x04,0xf1,0x00,0x4f,0x33,0x20,0x00,0x00,0x1e,0x70,
+0x00,0x4f,0xff,0xd0,0x00,0x00,0xcc,0x00,0x18,0x00,0x21,0x1c,0xc1,0x08,0x00,0x31,
+0x05,0xea,0x00,0x08,0x00,0xf1,0x0d,0x1c,0x40,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,
+0x01,0x11,0x22,0x22,0x21,0x00,0x00,0x00,0x0f,0xff,0xff,0xff,0xfc,0x00,0x00,0x00,
+0x1f,0x20,0x00,0x01,0x00,0x50,0x1f,0x42,0x33,0x33,0x31,0x08,0x00,0x40,0xff,0xff,
+0xff,0xfa,0x08,0x00,0x13,0x00,0x18,0x00,0xc2,0x43,0x33,0x33,0x33,0x00,0x00,0x00,
+0x0e,0xff,0xff,0xff,0xee,0x2c,0x00,0xf1,0x06,0x04,0x00,0x71,0x01,0x34,0x45,0x40,
+0x0f,0x00,0xd4,0x09,0xdd,0xdd,0xf0,0x1f,0x00,0xd4,0x00,0x00,0x05,0xe0,0x07,0x00,
+0x21,0x09,0xb0,0x07,0x00,0x21,0x0c,0x70,0x07,0x00,0xf0,0x01,0x1f,0x20,0x1f,0x44,
+0xe4,0x00,0x00,0x7c,0x00,0x1f,0xcc,0xf4,0x00,0x00,0xe6,0x00,0x15,0x00,0x21,0x07,
+0xe0,0x07,0x00,0x21,0x1f,0x50,0x07,0x00,0x20,0xca,0x00,0x07,0x00,0x91,0x09,0xd0,
+0x00,0x00,0x0f,0x00,0xd4,0x0c,0x10,0x07,0x00,0x20,0x00,0x00,0x07,0x00,0x1e,0xd5,
+0x07,0x00,0x30,0x00,0x00,0x41,0x05,0x00,0x31,0x02,0x00,0x32,0x7e,0x00,0xd1,0x20,
+0x98,0x08,0xdc,0xcc,0xf3,0x0f,0x30,0x99,0x00,0x00,0x03,0xf2,0x07,0x00,0xf0,0x01,
+0x09,0xd0,0x0f,0x40,0x99,0x00,0x00,0x1f,0x60,0x0f,0xff,0xf9,0x00,0x00,0xbc,0x00,
+0x15,0x00,0x21,0x08,0xe2,0x07,0x00,0xe0,0x7f,0x30,0x00,0x0f,0x30,0x98,0x0a,0xd3,
+0x00,0x00,0x0e,0x20,0x98,0x06,0x07,0x01,0xf2,0x23,0x00,0x44,0x00,0x00,0x00,0x4a,
+0xcc,0xa5,0x00,0x00,0x00,0x08,0xf8,0x44,0x8e,0xa0,0x00,0x00,0x3f,0x40,0x00,0x02,
+0xf4,0x00,0x00,0x6e,0x00,0x00,0x00,0xc6,0x00,0x00,0x4f,0x10,0x00,0x01,0xf4,0x00,
+0x00,0x0b,0xd5,0x22,0x5d,0xc0,0x00,0x00,0x00,0x7c,0xed,0xb7,0x84,0x00,0xf0,0x00,
+0x09,0x20,0x66,0x67,0x78,0x50,0x00,0xe4,0x09,0xaa,0x99,0xce,0x00,0x0e,0x40,0xf4,
+0x00,0x30,0x00,0xe4,0x00,0xdf,0x00,0x20,0x0e,0x40,0x36,0x00,0x00,0x0d,0x00,0xf0,
+0x00,0x0c,0x80,0x11,0x1e,0x40,0x00,0x05,0xe1,0x7f,0xff,0xf4,0x00,0x01,0xe6,0x00,
+0x0d,0x00,0xf1,0x05,0xba,0x00,0x00,0x00,0xe4,0x00,0x8d,0x00,0x00,0x00,0x0d,0x40,
+0x8d,0x10,0x00,0x00,0x00,0xd4,0x5d,0x10,0x0d,0x00,0x01,0x55,0x00,0x11,0xd4,0x06,
+0x00,0x21,0x0d,0x30,0x07,0x00,0x12,0xd3,0x0d,0x00,0x03,0x98,0x01,0x03,0x75,0x00,
+0xa1,0x6b,0xcc,0xdd,0x60,0x00,0xe4,0x02,0x44,0x43,0xc9,0x68,0x00,0x20,0x0d,0x60,
+0x68,0x00,0x21,0x02,0xf2,0x0d,0x00,0xe0,0xbb,0x02,0x22,0xe4,0x00,0x00,0x5f,0x21,
+0xef,0xff,0x40,0x00,0x4f,0x50,0x68,0x00,0x80,0x6f,0x60,0x00,0x00,0x0e,0x40,0xad,
+0x30,0x75,0x00,0x40,0x05,0x00,0x00,0x00,0x27,0x00,0xe2,0x03,0x00,0x00,0x00,0xe3,
+0x00,0x03,0xf0,0x00,0x00,0x0a,0x10,0x00,0x4f,0xc9,0x01,0x11,0xf0,0x07,0x00,0x02,
+0x0d,0x00,0xc1,0x03,0xfe,0xee,0xee,0xff,0x70,0x00,0x02,0x33,0x32,0x22,0x10,0x11,
+0x00,0xf1,0x00,0x05,0x10,0x13,0x44,0x45,0x20,0x00,0xe5,0x08,0xdc,0xcc,0xed,0x00,
+0x0e,0x50,0xea,0x00,0x10,0xe5,0xea,0x00,0xd0,0x22,0x2e,0x50,0x00,0x00,0x6f,0x1e,
+0xff,0xf5,0x00,0x00,0x2f,0x60,0x1a,0x00,0x80,0x2d,0x90,0x00,0x00,0xe5,0x00,0x4e,
+0x90,0x68,0x00,0x20,0x9e,0x50,0xd0,0x00,0x21,0x06,0x00,0x64,0x01,0xd1,0x00,0x2c,
+0xdd,0xdd,0xdd,0xd3,0x00,0x04,0xf5,0x44,0x44,0x4e,0x50,0x68,0x00,0xa1,0xd5,0x00,
+0x05,0xf0,0x00,0x00,0x0d,0x50,0x00,0x5f,0x0d,0x00,0xc2,0x03,0xfc,0xbb,0xbc,0xcf,
+0x40,0x00,0x03,0x45,0x54,0x44,0x30,0x5b,0x02,0xf0,0x00,0x81,0x04,0x56,0x67,0x30,
+0x0e,0x30,0xe3,0x0a,0xbb,0xae,0x90,0x0e,0x30,0xe3,0x4d,0x02,0x01,0x07,0x00,0x21,
+0x0f,0x40,0x07,0x00,0x21,0x2f,0x10,0x07,0x00,0x30,0x7c,0x36,0x6e,0x07,0x00,0x50,
+0xd6,0x8c,0xbf,0x30,0xe3,0x02,0x03,0x00,0x15,0x00,0x21,0x0c,0x90,0x07,0x00,0x20,
+0x6e,0x10,0x07,0x00,0x30,0x02,0xf5,0x00,0x07,0x00,0x20,0x1d,0x90,0x57,0x01,0x31,
+0xe3,0x38,0x00,0x07,0x00,0x11,0x00,0x72,0x01,0x08,0x07,0x00,0x32,0x0b,0x20,0xe3,
+0x62,0x01,0x14,0x20,0x07,0x00,0x70,0x13,0x44,0x54,0x00,0x5c,0x0d,0x50,0x5c,0x02,
+0x20,0x06,0xd0,0x78,0x02,0x50,0x3f,0x20,0x5d,0x0d,0x50,0x5d,0x02,0x10,0x05,0x0f,
+0x00,0x40,0x01,0xf6,0xcf,0xfd,0x0f,0x00,0x30,0xbc,0x01,0x26,0x0f,0x00,0x60,0x8e,
+0x20,0x00,0x5d,0x0d,0x50,0x5f,0x02,0x00,0x1e,0x00,0x00,0x71,0x01,0x45,0x4c,0x0d,
+0x40,0x06,0x52,0x00,0x30,0x3e,0x00,0x00,0x3d,0x02,0x40,0x06,0xd0,0x00,0x3c,0x13,
+0x00,0xf1,0x14,0xbd,0x00,0x08,0xb0,0x00,0x00,0x00,0x2f,0xda,0x01,0xee,0x60,0x00,
+0x00,0x0c,0x91,0xd8,0x9a,0x3f,0x50,0x00,0x08,0xd0,0x02,0xed,0x10,0x4f,0x40,0x00,
+0x61,0x00,0x06,0x20,0x00,0x21,0x3b,0x00,0x90,0x08,0x21,0x66,0x77,0x78,0x50,0x00,
+0xd4,0x19,0x64,0x02,0x12,0x0d,0x64,0x02,0x10,0xd4,0x7a,0x01,0x20,0xce,0xef,0x64,
+0x02,0x70,0x12,0x33,0xd4,0x00,0x00,0x0d,0x90,0x1a,0x00,0x20,0x05,0xf1,0x3d,0x02,
+0x21,0x01,0xe6,0x4a,0x02,0xd0,0xc9,0x00,0x8f,0xff,0xf4,0x00,0xac,0x00,0x01,0x22,
+0x2d,0x40,0xac,0xc4,0x01,0x20,0xc4,0x8b,0x4e,0x00,0x21,0x0c,0x50,0x55,0x00,0x21,
+0xc5,0x00,0x0d,0x00,0x08,0x71,0x02,0x27,0x0c,0x30,0x64,0x02,0xc1,0x07,0x20,0x68,
+0x89,0x99,0x40,0x00,0xe5,0x07,0x88,0x77,0xd9,0xef,0x01,0x40,0x0e,0x6a,0xff,0xf5,
+0x5f,0x04,0x70,0x12,0x3e,0x50,0x00,0x00,0xda,0x00,0xfc,0x01,0x20,0x9e,0x10,0xfc,
+0x01,0xe0,0x9e,0x30,0x6f,0xff,0xf5,0x01,0xbd,0x20,0x00,0x00,0x0e,0x52,0xe8,0x00,
+0x64,0x02,0x12,0x01,0xa5,0x02,0xc2,0x00,0x12,0x33,0x33,0x33,0x20,0x00,0x0b,0xfe,
+0xee,0xee,0xef,0x68,0x00,0x21,0xe5,0x00,0x7e,0x02,0x1e,0x50,0x0d,0x00,0x12,0xa2,
+0x64,0x02,0xf0,0x06,0x20,0x38,0x89,0x9a,0x70,0x00,0xc7,0x04,0x88,0x77,0xae,0x01,
+0x1d,0x70,0x00,0x00,0x09,0xa8,0xff,0xf7,0x00,0x7a,0x03,0x30,0x0c,0x70,0x00,0x1f,
+0x04,0xf0,0x07,0xc7,0x00,0x00,0x9e,0x11,0x55,0x5d,0x70,0x00,0xbd,0x20,0x3c,0xcc,
+0xf6,0x04,0xdb,0x10,0x00,0x00,0x0c,0x60,0xb5,0x3b,0x00,0xe4,0x93,0x00,0x00,0x33,
+0x33,0x34,0x44,0x00,0x00,0x4f,0xff,0xff,0xee,0xf4,0x5b,0x00,0xe2,0x03,0x44,0x44,
+0x44,0xe4,0x00,0x05,0xff,0xff,0xff,0xed,0x10,0x00,0x6e,0x64,0x00,0xb2,0xf2,0x22,
+0x23,0x33,0x20,0x00,0x3e,0xff,0xff,0xee,0xe9,0x11,0x00,0xf0,0x0d,0x30,0x37,0x88,
+0x99,0x60,0x00,0xc7,0x05,0x98,0x87,0xbd,0x00,0x0b,0x70,0x00,0x00,0x0a,0xa7,0xff,
+0xf8,0x00,0x00,0x00,0xf5,0x02,0x3c,0x80,0x00,0xa4,0x03,0x10,0xb7,0x0d,0x04,0xf0,
+0x02,0x22,0x2c,0x70,0x00,0x2e,0x70,0x3f,0xff,0xf7,0x00,0x4e,0x70,0x00,0x00,0x0b,
+0x70,0x9e,0xd2,0x00,0x21,0xc7,0x07,0xa0,0x01,0xe0,0x30,0x00,0x00,0x4b,0xee,0xc7,
+0x00,0x00,0x00,0x7f,0x72,0x25,0xdc,0x00,0xce,0x04,0x21,0x01,0xe5,0x5b,0x03,0x50,
+0x0b,0x80,0x00,0x1f,0x30,0x0d,0x04,0xb1,0x00,0x9e,0x62,0x24,0xcd,0x00,0x00,0x00,
+0x6c,0xee,0xc8,0x4e,0x03,0xf0,0x14,0x15,0x02,0xa1,0x45,0x56,0x60,0x04,0xd0,0x3e,
+0x6c,0xcc,0xcf,0x20,0x4c,0x03,0xe0,0x00,0x03,0xf0,0x04,0xc0,0x3e,0x00,0x00,0x6d,
+0x24,0x8c,0x03,0xe0,0x00,0x0a,0x98,0xde,0xc0,0x3f,0x21,0x01,0xc0,0x4c,0x03,0xf0,
+0x00,0x5f,0x00,0x04,0xc0,0x3f,0x00,0x0b,0x90,0x0d,0x00,0xf1,0x0c,0x04,0xf1,0x9f,
+0xff,0xc0,0x3f,0x00,0xd8,0x01,0x22,0x6c,0x03,0xf0,0xad,0x00,0x00,0x04,0xd0,0x3f,
+0x6e,0x20,0x00,0x00,0x4d,0x03,0xfa,0x30,0x0d,0x00,0x00,0x5b,0x00,0x10,0x4d,0x79,
+0x00,0x04,0x0d,0x00,0x33,0x3c,0x03,0xe0,0xa4,0x05,0x03,0x01,0x00,0xe2,0x06,0xff,
+0xff,0xff,0xff,0x50,0x00,0x00,0x01,0x22,0x11,0x11,0xd7,0x00,0xf7,0x01,0x12,0x60,
+0x08,0x00,0x22,0xd6,0x00,0x6a,0x04,0x10,0x50,0x30,0x00,0x11,0x60,0xc6,0x04,0x61,
+0x00,0x9b,0x00,0x0f,0x30,0x00,0x71,0x02,0x12,0xf1,0x0f,0x00,0x22,0x07,0x00,0x0f,
+0x00,0x01,0x01,0x00,0x10,0x9a,0x05,0x00,0x91,0x8c,0xcc,0xde,0xed,0xdd,0xdd,0xdc,
+0x23,0x55,0x01,0x00,0x14,0x50,0x69,0x00,0x10,0x01,0x69,0x00,0x92,0x90,0x00,0x00,
+0x02,0x22,0x22,0x22,0x9b,0x00,0xc8,0x02,0x10,0xa0,0x06,0x00,0x41,0x10,0x00,0x8a,
+0x00,0x0c,0x03,0x40,0x09,0x90,0x00,0x00,0x26,0x01,0x10,0x97,0x0f,0x00,0x01,0xae,
+0x00,0xf5,0x00,0x13,0x34,0x47,0xf4,0x44,0x44,0x44,0x09,0xee,0xee,0xed,0xdd,0xee,
+0xee,0xe2,0x8c,0x02,0x11,0x22,0xb2,0x01,0x00,0xb3,0x01,0x38,0xfe,0xff,0x00,0xab,
+0x04,0x02,0x37,0x00,0x01,0x46,0x00,0x08,0x0f,0x00,0x10,0x02,0x5a,0x00,0x0e,0x87,
+0x00,0x13,0x8c,0xda,0x02,0x12,0xb0,0x87,0x00,0x12,0x7b,0x32,0x00,0x22,0x08,0xa0,
+0x41,0x00,0x15,0x88,0x41,0x00,0xf5,0x00,0x25,0x55,0x57,0xf5,0x55,0x55,0x55,0x07,
+0xdd,0xdc,0xcc,0xcc,0xcc,0xdd,0xc1,0x4c,0x00,0x91,0x70,0x00,0x00,0x00,0x60,0x00,
+0x00,0x1f,0x10,0xca,0x03,0xf0,0x05,0x01,0xf6,0x54,0x44,0x57,0xe0,0x00,0x00,0x1f,
+0xdc,0xcc,0xcc,0xde,0x00,0x00,0x01,0xf1,0x00,0x00,0x04,0x0f,0x00,0x30,0x31,0x11,
+0x11,0x91,0x07,0x12,0xdf,0x78,0x00,0x0f,0x0e,0x01,0x07,0x01,0x87,0x00,0x43,0x01,
+0x80,0x00,0x8a,0x87,0x00,0x03,0x0e,0x01,0x15,0x76,0x87,0x00,0x21,0x7e,0xff,0x01,
+0x00,0x33,0x11,0x33,0x33,0x00,0x01,0x13,0x00,0xde,0x00,0x30,0x9c,0xdc,0x81,0x2c,
+0x00,0x51,0xfa,0x42,0x4b,0xe2,0x00,0x16,0x03,0x22,0x0a,0xa0,0x48,0x03,0x52,0x6c,
+0x00,0x00,0x00,0xc9,0x0f,0x00,0x50,0x04,0xf8,0x32,0x4a,0xf2,0x26,0x00,0x34,0xad,
+0xec,0x81,0xd2,0x03,0x11,0x00,0xf0,0x07,0x00,0xc0,0x00,0xe1,0x0d,0xff,0xff,0xff,
+0x00,0x0f,0x10,0x00,0x00,0x11,0x00,0x2f,0x20,0x0f,0x5b,0x00,0x31,0x1f,0x10,0x0f,
+0xff,0x03,0x14,0x2f,0x08,0x00,0x01,0xfa,0x01,0xf1,0x04,0x0c,0x40,0x3e,0x00,0x0f,
+0x52,0x20,0x00,0x0c,0x60,0x4d,0x00,0x0f,0xff,0xe0,0x00,0x0c,0x60,0x6b,0x18,0x00,
+0x32,0x0b,0x60,0x46,0x08,0x00,0x23,0x70,0x00,0x08,0x00,0xf2,0x03,0x02,0x44,0x0f,
+0x30,0x00,0x8f,0xef,0xff,0xff,0xc7,0x0f,0x30,0x00,0x02,0x22,0x11,0x00,0x00,0x48,
+0x00,0x0e,0x08,0x00,0x03,0x8c,0x02,0x00,0x78,0x06,0x70,0x03,0xef,0xff,0xff,0x20,
+0x0f,0x30,0xe2,0x01,0x42,0x2f,0x40,0x0e,0x40,0x9b,0x06,0x08,0x08,0x00,0x22,0x05,
+0x60,0x08,0x00,0xf5,0x13,0x07,0xb0,0x0e,0x40,0x0e,0x73,0x20,0x00,0x07,0xb0,0x06,
+0x00,0x0e,0xff,0xe1,0x00,0x07,0xb0,0x02,0x44,0x0e,0x50,0x00,0x6e,0xef,0xff,0xff,
+0xd8,0x0e,0x50,0x00,0x02,0x22,0x21,0x4a,0x04,0x01,0x08,0x00,0xa3,0x06,0xa0,0x00,
+0x00,0x0a,0x30,0x00,0x00,0x07,0xc0,0x7b,0x02,0x0b,0x08,0x00,0x50,0x06,0xff,0xee,
+0xee,0xff,0xf8,0x02,0x47,0x23,0x33,0x33,0x22,0xf5,0x04,0x02,0x1e,0x03,0x00,0xc0,
+0x00,0x23,0x11,0xc8,0x1e,0x03,0x12,0x70,0x08,0x00,0x17,0xc6,0x1e,0x03,0x41,0x60,
+0x03,0x20,0xe4,0xa6,0x01,0x30,0xb8,0x0f,0x30,0xb5,0x01,0x32,0x0b,0x81,0xf1,0x0f,
+0x00,0x21,0x03,0x00,0x0f,0x00,0x12,0x80,0xc4,0x01,0x00,0x23,0x08,0xa0,0x6d,0xde,
+0xfd,0xdf,0xed,0xdd,0xdd,0x22,0x54,0x44,0x01,0x00,0x60,0x40,0x00,0x04,0x44,0x44,
+0x55,0x61,0x00,0x67,0xcd,0xdc,0xcc,0xcf,0x40,0x00,0x08,0x05,0x02,0x5a,0x00,0x01,
+0x17,0x08,0x02,0xc6,0x00,0x03,0x2e,0x01,0x22,0xf2,0x00,0xa5,0x04,0x02,0x3c,0x02,
+0xb5,0x22,0x33,0x34,0x07,0xef,0xff,0xff,0xfe,0xee,0xee,0xc0,0xaa,0x07,0x05,0x0d,
+0x03,0x04,0x0f,0x00,0x12,0xe0,0x08,0x00,0x1a,0x4e,0x0f,0x00,0x27,0x28,0x00,0x01,
+0x00,0x13,0x04,0x90,0x02,0x44,0x01,0x22,0x22,0x21,0x9e,0x03,0x03,0xd5,0x03,0x13,
+0x8a,0x64,0x08,0x03,0xbd,0x02,0x10,0x65,0x58,0x05,0x00,0x01,0x00,0x12,0x30,0x90,
+0x02,0x2c,0xfe,0x20,0x6f,0x03,0x30,0x22,0x25,0xf2,0x9e,0x02,0x1e,0x4f,0x9e,0x03,
+0x0f,0xa0,0x00,0x03,0x22,0x02,0xb0,0x77,0x0a,0x89,0x20,0x00,0x00,0x8f,0xff,0xff,
+0xff,0xf4,0x06,0x01,0x19,0xe5,0x05,0x01,0x03,0x03,0x04,0xe0,0x10,0x00,0x8f,0xfe,
+0xee,0xee,0xee,0xef,0xfb,0x02,0x23,0x33,0x4f,0x42,0x39,0x00,0x31,0x00,0x2f,0x20,
+0xbd,0x01,0xa1,0x27,0x23,0x32,0x00,0x00,0xce,0xee,0xe0,0xad,0xef,0xea,0x00,0x00,
+0x92,0x00,0xc1,0x24,0x47,0xe0,0x00,0x2f,0x00,0x00,0xee,0xdd,0x80,0x00,0x2f,0x50,
+0x00,0x00,0x07,0x00,0x30,0xe7,0x22,0x21,0x07,0x00,0x69,0xaf,0xff,0xfa,0x00,0x1d,
+0x00,0x01,0x00,0xd1,0x30,0x00,0x45,0x55,0x55,0x20,0x03,0xe0,0x00,0xbc,0xcc,0xcd,
+0xc0,0x2e,0x05,0x12,0x06,0x07,0x00,0x41,0x07,0xb0,0x03,0xf0,0xb5,0x04,0x02,0x50,
+0x05,0xf0,0x00,0x63,0x03,0xe0,0x3c,0xcc,0xcd,0xef,0xfd,0x33,0xe0,0x04,0x44,0xca,
+0x21,0x00,0x23,0x00,0xc1,0xa8,0x00,0x44,0x47,0xe0,0x00,0x00,0xa9,0x00,0xbc,0xcd,
+0xe0,0x29,0x01,0x21,0x03,0xf0,0xe8,0x07,0x22,0x02,0xe0,0x75,0x01,0x42,0x20,0x00,
+0x05,0xe0,0xbd,0x01,0x13,0xe0,0x75,0x01,0x41,0xee,0xee,0xef,0xf2,0x74,0x02,0x12,
+0x32,0xcf,0x03,0xe0,0x1a,0x00,0xad,0xdd,0xde,0xc0,0x02,0xf0,0x03,0x44,0x44,0x5f,
+0x10,0x2f,0x1c,0x01,0x31,0xf1,0x01,0xf0,0xb2,0x00,0x10,0x1f,0x0d,0x00,0x11,0xf0,
+0x0d,0x00,0x11,0x3e,0x0d,0x00,0x41,0x04,0xc0,0x01,0xf0,0x45,0x09,0xe1,0x1f,0x01,
+0x22,0x22,0x34,0x68,0x61,0xf0,0x9e,0xee,0xfe,0xcb,0x84,0x1f,0xcc,0x09,0x21,0x01,
+0xf0,0x32,0x01,0x0c,0x0d,0x00,0x21,0x0f,0x40,0x96,0x04,0x11,0xe3,0xb3,0x04,0x11,
+0x01,0xbd,0x04,0x05,0x7f,0x02,0x3a,0xdd,0xcc,0xcf,0xf7,0x05,0x04,0x06,0x06,0x1a,
+0xc5,0x8e,0x02,0x15,0xe3,0x7f,0x02,0x16,0x03,0x7f,0x02,0x71,0xee,0xfe,0xee,0xd1,
+0x00,0x00,0xf3,0x6e,0x0a,0x00,0xd7,0x03,0x01,0xae,0x01,0x0f,0x0f,0x00,0x0b,0x40,
+0x91,0x00,0x09,0x10,0x94,0x02,0x42,0xee,0xee,0xff,0xf9,0x77,0x03,0x13,0x29,0x70,
+0x02,0x18,0x8b,0x1d,0x06,0x33,0x00,0x00,0x99,0x0f,0x00,0x15,0x70,0x94,0x03,0x11,
+0xee,0x01,0x00,0x70,0xe2,0x13,0x33,0x37,0xe3,0x39,0xc3,0x7c,0x0c,0x11,0x5d,0xbb,
+0x05,0x31,0x07,0x05,0xd0,0x43,0x05,0x40,0xf2,0x5d,0x00,0x7a,0x69,0x00,0x21,0x20,
+0x10,0xe0,0x04,0x03,0x30,0x03,0x04,0xc8,0x0c,0x00,0x73,0x01,0x86,0xf5,0x00,0x00,
+0x01,0x33,0x33,0x33,0x32,0xf5,0x01,0x10,0x05,0xca,0x02,0x10,0x30,0xff,0x02,0x33,
+0x21,0x11,0xf5,0x9e,0x04,0x03,0x8e,0x03,0x13,0xf3,0x0f,0x00,0x12,0x20,0xb8,0x05,
+0x19,0xf1,0x59,0x06,0x23,0x04,0xd0,0xc3,0x02,0x17,0x00,0x9c,0x06,0x00,0x01,0x00,
+0x22,0x20,0x8f,0xad,0x05,0x08,0xa6,0x0b,0x01,0x29,0x00,0x14,0xef,0x6f,0x07,0x32,
+0x22,0x11,0xc7,0x13,0x00,0x1a,0x0b,0x51,0x04,0x13,0x0c,0x69,0x01,0x41,0x82,0x00,
+0x00,0x11,0x01,0x00,0x25,0x10,0x9f,0x4b,0x00,0x00,0x12,0x00,0x05,0x4c,0x00,0x00,
+0x87,0x03,0x00,0x16,0x0b,0x10,0x3e,0x0a,0x03,0x0f,0x68,0x03,0x11,0x26,0x03,0xd0,
+0x3c,0x00,0x52,0x2d,0xdd,0xde,0xee,0xe5,0x44,0x00,0x22,0x3c,0x80,0x13,0x00,0x1f,
 0xb7,0x8f,0x00,0x0a,0x13,0x61,0xda,0x00,0x08,0xf7,0x03,0x19,0x00,0x26,0x0a,0x04,
 0x38,0x01,0x03,0x31,0x00,0x1a,0xf4,0x47,0x01,0x22,0xef,0xfe,0x78,0x01,0x03,0x60,
-0x05,0x03,0xf0,0x03,0x01,0x77,0x04,0x0f,0xf7,0x04,0x0b,0x15,0x20,0x48,0x12,0x01,
+0x05,0x03,0xf0,0x03,0x01,0x77,0x04,0x0f,0xf7,0x04,0x0b,0x05,0x68,0x00,0x11,0x0a,
 0xf7,0x01,0x77,0xff,0xe0,0x13,0x34,0x44,0x44,0x43,0xbd,0x01,0xc3,0x14,0x44,0x44,
 0x44,0x42,0x00,0x00,0x06,0xde,0xed,0xdd,0xde,0xce,0x05,0x12,0x7c,0x52,0x02,0xc4,
-0x39,0xc0,0x00,0x00,0x3f,0xee,0xee,0xee,0xd8,0x00,0x00,0x03,0xb8,0x01,0x40,0x31,
-0x11,0x22,0x34,0x09,0x21,0x00,0x2e,0x23,0x06,0x96,0x01,0x10,0xff,0x7e,0x15,0x02,
-0x52,0x05,0x13,0xc8,0x07,0x01,0x0a,0x16,0x01,0x04,0x0e,0x03,0x15,0x83,0x96,0x01,
-0x04,0xe1,0x01,0x2a,0x11,0x10,0xe2,0x01,0x11,0x80,0x9f,0x10,0x20,0x00,0x2f,0x7a,
-0x09,0xb0,0x00,0x00,0x02,0xf5,0x54,0x44,0x58,0xd0,0x00,0x00,0x2f,0x3a,0x08,0x00,
-0xc2,0x03,0x02,0x80,0x05,0x53,0x2f,0x21,0x11,0x11,0x5d,0x87,0x00,0x14,0xa0,0xc4,
-0x0d,0xd1,0x36,0x67,0x77,0x70,0x00,0xe4,0x06,0xaa,0x99,0xaf,0x30,0x0e,0x40,0x3d,
-0x04,0x11,0xe4,0x0f,0x03,0x20,0x0e,0x40,0xc4,0x06,0x00,0x0d,0x00,0x21,0x07,0xd0,
-0xd1,0x03,0x11,0xe5,0x1e,0x01,0x11,0xab,0xde,0x03,0x20,0x6e,0x10,0x0d,0x00,0x20,
-0x3f,0x40,0x0d,0x00,0x20,0x3e,0x50,0x38,0x01,0x22,0x0e,0x50,0xd1,0x0d,0x06,0x45,
-0x01,0x03,0x3b,0x06,0x1e,0xe3,0x39,0x0e,0x30,0x02,0x10,0x7c,0x35,0x01,0x51,0xc7,
-0x01,0x43,0x33,0x7e,0xda,0x06,0x20,0x0a,0xa0,0x53,0x0b,0x20,0x03,0xf4,0x07,0x02,
-0x20,0x01,0xda,0xff,0x00,0x20,0x02,0xdc,0xf4,0x06,0x20,0x18,0xf9,0x13,0x02,0x26,
-0x0d,0xb3,0x0b,0x01,0x1f,0x20,0x60,0x0b,0x26,0xd1,0x03,0x03,0x34,0x45,0x30,0x00,
-0x4e,0x6d,0xdc,0xcd,0xf0,0x00,0x4f,0xd5,0x00,0x10,0x4f,0xe8,0x10,0x00,0x06,0x00,
-0x70,0x5f,0x20,0x00,0x4f,0x00,0x02,0xe7,0xb3,0x02,0x70,0x2e,0x90,0x00,0x00,0x4e,
-0x05,0xe8,0x24,0x04,0x01,0xa9,0x0e,0x22,0x4e,0x30,0x69,0x03,0x10,0x2c,0x76,0x28,
-0x21,0x00,0x4e,0x5f,0x01,0xb1,0x4f,0xee,0xee,0xee,0xfd,0x00,0x4e,0x44,0x44,0x44,
-0x8d,0x12,0x00,0x93,0x5c,0x00,0x4e,0x11,0x11,0x11,0x6c,0x00,0x2e,0x24,0x18,0x03,
-0x27,0x07,0x20,0x01,0x22,0x77,0x04,0x61,0x5f,0xef,0x7d,0xff,0xc0,0x0f,0x1d,0x0f,
-0x40,0x07,0xc0,0x0e,0x40,0x8b,0x04,0x40,0x0a,0xa0,0x0e,0x40,0xcc,0x03,0x40,0x0d,
-0x70,0x0e,0x50,0x36,0x02,0xf0,0x05,0x0f,0x30,0x0e,0x61,0x10,0x00,0xb7,0x00,0x4f,
-0x00,0x0e,0xff,0xf4,0x02,0xf2,0x00,0x9b,0x00,0x0e,0x50,0x08,0x07,0x10,0xe5,0x50,
-0x01,0x40,0x1f,0x30,0x05,0xe0,0x47,0x0d,0x40,0xaa,0x00,0x0d,0x80,0x08,0x00,0x33,
-0x41,0x00,0x7e,0xa1,0x0f,0x15,0xa4,0xa9,0x0f,0x05,0xbe,0x02,0x0c,0x08,0x00,0x23,
-0x04,0x10,0xf8,0x09,0xf0,0x27,0x80,0x78,0x85,0x38,0x85,0x00,0x4e,0x09,0x9c,0xd5,
-0x9b,0xf0,0x04,0xe0,0x00,0x9a,0x00,0x6e,0x00,0x4e,0x00,0x0b,0x70,0x09,0xb0,0x04,
-0xe0,0x00,0xf4,0x00,0xb8,0x00,0x4e,0x00,0x3f,0x00,0x0f,0x5c,0xcd,0xe0,0x08,0xb0,
-0x04,0xf1,0x55,0x8e,0x00,0xe5,0x00,0x9b,0x00,0x04,0xe0,0x6d,0x88,0x00,0x80,0x4f,
-0x0e,0x50,0x06,0xe0,0x00,0x03,0xf6,0x60,0x2b,0x00,0x70,0x0a,0x11,0x8d,0xc9,0x12,
-0x22,0x05,0x20,0x06,0x15,0x01,0x0d,0x00,0x06,0xe6,0x07,0x03,0xec,0x03,0x03,0x6f,
-0x15,0x00,0x6d,0x13,0x20,0xea,0x4e,0x8e,0x12,0x70,0x33,0x3a,0xb0,0x22,0x4f,0x10,
-0x00,0xa5,0x06,0x22,0x02,0xf1,0xb3,0x01,0x12,0x3f,0xd7,0x04,0x00,0xa2,0x06,0x00,
-0x31,0x0a,0x10,0x5d,0x6b,0x03,0x11,0x70,0x8e,0x0a,0x00,0xea,0x18,0x12,0x22,0xf8,
-0x03,0x40,0x23,0x33,0x40,0x7e,0xe2,0x11,0x3f,0xee,0xed,0x20,0x67,0x04,0x06,0x1f,
-0x4e,0x6f,0x08,0x02,0x24,0x02,0x80,0x84,0x00,0x10,0x10,0x26,0x12,0xa1,0xf8,0x5f,
-0xff,0xf0,0x00,0x00,0x12,0x2b,0xa0,0x11,0x87,0x00,0x12,0xc7,0x3c,0x08,0x21,0x0f,
-0x40,0x4d,0x00,0x22,0x03,0xf1,0x1b,0x07,0x12,0x7d,0xbb,0x0a,0x21,0x0c,0x80,0x85,
-0x08,0x22,0x01,0xf2,0x06,0x06,0x6b,0x4b,0x00,0x00,0x08,0x60,0x00,0x01,0x00,0x12,
-0x9e,0x87,0x03,0x18,0x21,0x15,0x0b,0x10,0x10,0xed,0x14,0x21,0xfb,0x4f,0x69,0x00,
-0x42,0x29,0xb0,0x11,0x4f,0xc8,0x03,0x22,0x03,0xf0,0x07,0x06,0x21,0x4e,0x00,0x07,
-0x0a,0x22,0x06,0xc0,0xba,0x01,0x15,0x58,0x4b,0x00,0x12,0x6e,0x59,0x06,0x13,0x10,
-0xdf,0x08,0x05,0x18,0x00,0x40,0x34,0x44,0x44,0x44,0x66,0x2c,0x42,0xee,0xee,0xee,
-0xfe,0xd4,0x07,0x22,0x03,0xf0,0x02,0x06,0x13,0x3f,0x0f,0x00,0x00,0xd2,0x03,0x12,
-0xcb,0xa6,0x14,0x50,0x35,0x55,0x55,0x44,0x10,0xbe,0x2d,0x30,0x10,0x23,0x32,0x2e,
-0x13,0x42,0xfd,0x3e,0xef,0xf1,0x4d,0x09,0x16,0x2f,0xf0,0x00,0x00,0x0c,0x00,0x12,
-0x4e,0xe4,0x06,0x01,0x87,0x00,0x61,0x52,0x00,0x00,0x24,0x00,0x02,0x13,0x0a,0x40,
-0x45,0x50,0x6c,0xcc,0x01,0x00,0x25,0xbb,0x10,0x2b,0x0c,0x43,0x12,0x22,0x22,0x31,
-0x32,0x0c,0x00,0x4a,0x04,0x03,0x57,0x01,0x52,0xf4,0x34,0x44,0x44,0x30,0x96,0x00,
-0x17,0xec,0x82,0x09,0x00,0xbb,0x00,0x02,0x67,0x06,0x24,0xfe,0xe2,0xd1,0x08,0x22,
-0x01,0x50,0x8f,0x01,0x12,0x4f,0x9e,0x01,0x22,0x05,0xf0,0x0f,0x00,0x12,0x5e,0xbc,
-0x01,0x11,0x05,0x52,0x2f,0x03,0x0f,0x00,0x21,0xf3,0x33,0x0f,0x00,0x42,0x3f,0xee,
-0xd1,0x5e,0x7f,0x0c,0x22,0x05,0xe0,0xe8,0x00,0x04,0x0f,0x00,0x50,0xf4,0x45,0x68,
-0x90,0x3f,0x40,0x06,0x2b,0xcb,0x96,0x65,0x0d,0x0f,0x0f,0x00,0x04,0x02,0xee,0x10,
-0x00,0xc6,0x1f,0x22,0x02,0xa0,0x7c,0x09,0x01,0x7d,0x16,0x03,0xea,0x01,0x21,0x2f,
-0x10,0x5a,0x00,0x32,0x02,0xf8,0x77,0x0f,0x00,0x41,0xbb,0xa1,0x6d,0x00,0x27,0x05,
-0xd3,0x05,0xf9,0x89,0xac,0xe2,0x2f,0x00,0x00,0x18,0x99,0x98,0x63,0x02,0x4b,0x00,
-0x10,0x1b,0x13,0x0e,0x40,0x33,0x33,0x44,0x40,0x76,0x1b,0x00,0x37,0x18,0x05,0xa2,
-0x07,0x40,0x01,0x44,0x44,0x44,0x72,0x1d,0x21,0xbf,0xee,0x09,0x0b,0x13,0x0b,0xac,
-0x0a,0x30,0xbb,0x22,0x22,0xb5,0x14,0x10,0x07,0x21,0x0b,0x03,0xd7,0x06,0x11,0x40,
-0x9e,0x05,0x00,0xa5,0x00,0x17,0x4f,0xe1,0x00,0x22,0x2f,0x00,0x87,0x00,0x22,0xf5,
-0x55,0x0f,0x00,0x32,0xdd,0xc1,0x5e,0x87,0x00,0xd3,0x06,0xe2,0x22,0x35,0x81,0x2f,
-0x00,0x00,0x3f,0xff,0xfe,0xc9,0x12,0x87,0x00,0x37,0x1e,0x00,0x00,0x94,0x06,0x20,
-0xff,0xfd,0x65,0x0d,0x42,0x33,0x33,0x24,0xf1,0x1c,0x0c,0x20,0x2f,0x10,0x7b,0x15,
-0x01,0x5e,0x03,0x13,0x0d,0x08,0x06,0x50,0xbe,0xcb,0xbc,0xcd,0xf0,0xd3,0x31,0x33,
-0x55,0x44,0x42,0x94,0x01,0x30,0x01,0x61,0x80,0xb8,0x03,0x20,0x4e,0x4f,0x3e,0x02,
-0x31,0x04,0xe4,0xf0,0x0d,0x00,0x11,0x5e,0x0d,0x00,0x25,0xe5,0xe0,0x0d,0x00,0x20,
-0xf3,0x37,0x0d,0x00,0x39,0x3f,0xdd,0xee,0x1a,0x00,0x11,0x6e,0x0d,0x00,0xd2,0xe6,
-0xe4,0x45,0x88,0x3e,0x00,0x4e,0x2b,0xcb,0xa7,0x43,0xe0,0x04,0xa5,0x01,0x11,0x4e,
-0xd2,0x00,0x07,0x0d,0x00,0x38,0x02,0xe0,0x04,0xef,0x0f,0x21,0x90,0x1d,0x7a,0x01,
-0x10,0x2f,0x28,0x26,0x09,0x06,0x00,0xc2,0x3f,0x10,0x02,0x55,0x56,0xf1,0x3f,0x00,
-0x05,0xdd,0xdd,0xf1,0x0f,0x04,0x1e,0x3f,0x06,0x00,0x92,0x88,0x9a,0xde,0x01,0xf1,
-0x07,0x98,0x87,0x52,0x04,0x09,0x1e,0x01,0x06,0x00,0x17,0xf0,0x98,0x03,0x21,0x31,
-0x1b,0x1a,0x18,0x23,0x2f,0x10,0x06,0x00,0xa1,0x33,0x33,0xd7,0x2f,0x00,0x03,0xee,
-0xee,0xf7,0x3f,0x18,0x00,0x03,0x06,0x00,0xb3,0x54,0x45,0x7a,0x30,0xc6,0x1d,0xee,
-0xdd,0xb8,0x10,0xd6,0x5f,0x07,0x50,0x02,0x33,0x33,0x33,0x10,0x5e,0x2b,0x23,0xfe,
-0xf4,0x16,0x08,0x00,0x12,0x00,0x11,0xe5,0xc8,0x2e,0x32,0xe2,0x00,0x8d,0xe3,0x30,
-0x41,0x22,0x22,0x23,0x32,0x42,0x32,0x17,0xe9,0x72,0x00,0x21,0x43,0x01,0x2d,0x26,
-0x21,0x90,0x2f,0xdf,0x04,0x71,0x02,0xf1,0x00,0x03,0x33,0x3b,0x90,0x74,0x00,0x21,
-0xf9,0x03,0x1b,0x18,0x20,0x80,0x3f,0x79,0x18,0xc0,0xa8,0x02,0xfd,0xdd,0xef,0xf4,
-0x0a,0x80,0x04,0x54,0x43,0x10,0xde,0x07,0xa1,0x01,0x20,0x00,0x08,0x40,0x00,0x00,
-0x9f,0xff,0xe5,0xc4,0x00,0x13,0x21,0x3d,0x03,0x31,0xed,0x00,0x01,0xe7,0x07,0xc1,
-0x00,0x02,0xad,0xee,0xd9,0x20,0x00,0x01,0xf9,0x32,0x23,0x9f,0x64,0x34,0x00,0x95,
-0x34,0x50,0x5e,0xfe,0xef,0xe5,0x00,0x45,0x0a,0x14,0x10,0xcf,0x01,0x20,0x71,0x80,
-0x74,0x07,0x20,0x4e,0x4f,0x74,0x07,0x00,0xcf,0x01,0x00,0x0d,0x00,0x12,0x4e,0x0d,
-0x00,0x13,0xe0,0x0d,0x00,0xc1,0x5c,0xdd,0xf4,0x04,0xe4,0xe0,0x01,0x44,0x4e,0x40,
-0x4e,0x5e,0x1a,0x00,0x12,0xe5,0x1a,0x00,0x12,0x5d,0x0d,0x00,0xd1,0xe5,0x57,0x99,
-0x0e,0x40,0x4e,0x1b,0xcb,0xa7,0x40,0xe4,0x04,0xe0,0xc2,0x07,0x01,0x41,0x05,0x09,
-0x0d,0x00,0x13,0xd3,0x6b,0x05,0x15,0x04,0x34,0x0f,0x1a,0xe4,0x66,0x09,0x1f,0xf4,
-0xbc,0x0a,0x03,0x30,0x41,0x11,0x11,0x3a,0x14,0x04,0x6e,0x08,0x04,0x45,0x0a,0x29,
-0x07,0x90,0xe2,0x0d,0x01,0x72,0x0b,0x40,0x24,0x44,0x44,0xbb,0x73,0x11,0x11,0xdd,
-0x01,0x00,0x15,0xd2,0xb9,0x06,0x1f,0xd5,0x9e,0x09,0x03,0x07,0xde,0x09,0x10,0xa0,
-0x11,0x01,0x34,0x7f,0x33,0x31,0x04,0x06,0x00,0x99,0x09,0x63,0x7f,0x44,0x44,0x45,
-0x07,0xed,0x4b,0x00,0x03,0x01,0x00,0x00,0x41,0x09,0x10,0x12,0xdf,0x20,0x00,0x46,
-0x0a,0x01,0x25,0x1e,0x02,0xe2,0x23,0x12,0xa7,0xa8,0x08,0x21,0x0a,0x70,0xa9,0x08,
-0xfe,0x03,0x15,0xca,0x55,0x5e,0x86,0x20,0x00,0x06,0xcc,0xcc,0xcc,0xcb,0xa4,0x00,
-0x00,0x08,0x00,0x00,0xce,0x0b,0x06,0x0f,0x00,0x12,0x10,0x0f,0x00,0x52,0xf3,0x11,
-0x11,0x23,0x20,0x8c,0x18,0x1c,0xea,0x29,0x06,0x11,0x07,0x57,0x05,0x71,0xdd,0xe2,
-0x25,0x55,0x55,0x7f,0x44,0x11,0x1b,0x0f,0xc0,0x04,0x0b,0x04,0xc7,0x06,0x19,0x02,
-0xe1,0x0b,0x08,0xf6,0x0f,0x06,0x16,0x01,0x50,0x0e,0x61,0x11,0x12,0x22,0x01,0x27,
-0x45,0xff,0xff,0xfe,0xa0,0x71,0x00,0x02,0x2f,0x12,0x85,0xd2,0x13,0x34,0x44,0x7f,
-0x44,0x33,0x32,0x29,0x07,0x30,0x04,0x44,0x7f,0x7f,0x00,0x56,0x03,0xde,0xee,0xdd,
-0xdd,0x49,0x07,0x00,0xb0,0x0a,0x22,0x37,0xf0,0xb0,0x0a,0x11,0xdb,0xb6,0x19,0x02,
-0x1a,0x00,0xcf,0x42,0x22,0x33,0x44,0x10,0x00,0x01,0xdf,0xff,0xff,0xfe,0xd6,0x07,
-0x01,0x06,0x19,0xf1,0x07,0x01,0x10,0x02,0x07,0x01,0x11,0x10,0xf1,0x1b,0x2c,0xff,
-0xe7,0x07,0x01,0x11,0x06,0x06,0x01,0x91,0xde,0xd0,0x25,0x55,0xf7,0x54,0x4e,0x74,
-0x32,0xd9,0x0c,0x0f,0xa0,0x0d,0x01,0x13,0xf2,0x0f,0x00,0x12,0x20,0x37,0x0a,0x13,
-0x20,0xb8,0x1b,0x19,0x10,0xac,0x0b,0x04,0x62,0x11,0x1a,0xe5,0x0e,0x02,0x16,0xe4,
-0x0a,0x0c,0x13,0x11,0xfa,0x12,0x1c,0xb0,0xbd,0x0c,0x0b,0x01,0x00,0x12,0x7e,0x7c,
-0x07,0x14,0x21,0x7c,0x07,0x2a,0x0a,0x40,0x61,0x01,0x0b,0x69,0x00,0x11,0x73,0x13,
-0x07,0x01,0x70,0x01,0x1c,0x80,0x4b,0x00,0x04,0x99,0x0b,0x03,0x89,0x0d,0x05,0x2b,
-0x03,0x1a,0xf3,0x76,0x12,0x03,0x0f,0x00,0x04,0xf6,0x1c,0x03,0x8b,0x0f,0x04,0x18,
-0x0e,0x1f,0x03,0xf7,0x02,0x03,0x0b,0xe9,0x00,0x52,0xdf,0xee,0xef,0xff,0xc0,0xf4,
-0x0d,0x06,0x06,0x0c,0x11,0x5c,0x69,0x02,0x22,0xcd,0x12,0x00,0x15,0x16,0x40,0x99,
-0x00,0x22,0x03,0x43,0xa0,0x00,0x11,0xdc,0xca,0x2f,0x21,0x8e,0x20,0x18,0x19,0x22,
-0x0d,0x70,0x73,0x09,0x10,0xc8,0x09,0x0b,0x00,0xfc,0x24,0x30,0x32,0x38,0xf5,0x25,
-0x02,0x34,0xad,0xed,0x93,0x66,0x50,0x21,0x1d,0x00,0xaa,0x05,0x05,0x06,0x00,0x12,
-0x00,0x06,0x00,0x2f,0xf2,0x3f,0x06,0x00,0x04,0x16,0x4f,0x06,0x00,0xc2,0xf1,0x4f,
-0x88,0x8a,0xce,0x10,0xf1,0x08,0x99,0x87,0x52,0x00,0x25,0x02,0x0d,0xb6,0x05,0x27,
-0x00,0xf1,0xd5,0x22,0x21,0x62,0x1b,0x02,0x10,0x2f,0x2f,0x10,0x06,0x00,0x04,0x01,
-0x1e,0x00,0x00,0x54,0x11,0x90,0x10,0xd5,0x2f,0xff,0xff,0xfd,0x30,0xd5,0x02,0xce,
-0x0d,0x13,0xd5,0x11,0x0c,0x11,0x4d,0xe7,0x03,0x51,0x7d,0x54,0x44,0x44,0xf4,0x83,
-0x0d,0x19,0xe4,0x06,0x00,0xb2,0x6f,0xcb,0xbc,0xcc,0xf3,0x00,0x04,0x55,0x54,0x44,
-0x20,0xae,0x1b,0x11,0x1b,0x61,0x01,0x2c,0x2f,0x10,0x06,0x00,0x27,0x3f,0x00,0x06,
-0x00,0xa2,0x32,0x23,0x58,0x20,0xd5,0x1f,0xff,0xff,0xda,0x20,0x66,0x00,0x13,0xc4,
-0x16,0x01,0x71,0x59,0x00,0x00,0x00,0xb2,0x00,0x7b,0xd7,0x0c,0xb3,0x7f,0xee,0xee,
-0xee,0xf3,0x00,0x7c,0x44,0x44,0x44,0xe3,0x12,0x00,0x50,0x7b,0x11,0x11,0x11,0xf3,
-0x4b,0x27,0x22,0xff,0xe1,0xab,0x1a,0x00,0xd8,0x04,0xa1,0x10,0x0d,0x50,0x00,0xde,
-0xee,0xdd,0x50,0x0d,0x50,0xc8,0x01,0x06,0x07,0x00,0x24,0xe4,0x00,0x32,0x1b,0x51,
-0x00,0x0d,0x72,0x20,0xf4,0xfc,0x1e,0x22,0xf8,0xf4,0xfd,0x0e,0x0a,0x07,0x00,0xd8,
-0xe7,0x33,0x45,0x75,0x0c,0x50,0x00,0x9d,0xed,0xdb,0xa4,0x0c,0x50,0x19,0x0e,0x0e,
-0x07,0x00,0x06,0xf5,0x0b,0xd5,0x09,0x30,0x00,0xbe,0xee,0xee,0x30,0x0d,0x60,0x00,
-0xe7,0x33,0x32,0x69,0x00,0x0a,0x07,0x00,0x31,0x84,0x30,0xe4,0x77,0x00,0x21,0xf6,
-0xe4,0x3f,0x00,0x00,0x69,0x00,0x87,0x82,0x0c,0x60,0x00,0x9d,0xed,0xb7,0x51,0x54,
-0x00,0x11,0x20,0x07,0x00,0x21,0x03,0xf0,0x63,0x18,0x03,0xb0,0x04,0x0a,0x07,0x00,
-0x10,0x02,0xc8,0x02,0x12,0x80,0x53,0x12,0x03,0xc0,0x04,0x81,0x60,0x00,0xbe,0xdd,
-0xde,0x70,0x06,0xd0,0x7e,0x00,0x21,0x06,0xd0,0x70,0x00,0x15,0x05,0x07,0x00,0x11,
-0xf4,0xfe,0x10,0x11,0xfe,0x07,0x00,0xe2,0xe2,0x21,0xe5,0x11,0x13,0x53,0x05,0xd0,
-0x00,0xbf,0xff,0xeb,0x94,0x05,0x42,0x0c,0x25,0x03,0xb0,0x2c,0x0e,0x11,0xd0,0xab,
-0x13,0x12,0x03,0xc3,0x0e,0xc0,0x03,0xff,0xfe,0xee,0xff,0xe0,0x00,0x03,0xf3,0x33,
-0x32,0x26,0xae,0x18,0x01,0x0c,0x11,0x62,0x03,0xf2,0x22,0x22,0x26,0xd0,0xd7,0x0e,
-0x12,0x90,0x1a,0x07,0xf0,0x01,0x07,0x14,0x66,0x66,0x60,0x4d,0x00,0xe3,0xcd,0xbb,
-0xb9,0x04,0xe0,0x0f,0x3d,0x60,0x7a,0x0a,0x20,0xe3,0xd6,0x43,0x00,0x17,0x0e,0x0d,
-0x00,0xa2,0xe4,0x4f,0x3d,0x50,0x00,0x00,0x4f,0xdd,0xf3,0xd5,0x1a,0x00,0x11,0x50,
-0x1a,0x00,0x03,0x0d,0x00,0xc1,0x95,0x68,0xa4,0x4e,0x00,0xe3,0x6b,0xba,0x97,0x14,
-0xe0,0x0e,0x0a,0x0e,0x00,0x93,0x04,0x00,0x1a,0x00,0x11,0x40,0x0d,0x00,0x11,0xe4,
-0x88,0x11,0x03,0x93,0x03,0x02,0x06,0x00,0xd1,0x91,0x19,0x88,0x88,0x80,0x00,0xe4,
-0x4f,0x99,0x99,0x70,0x00,0xe4,0x09,0x03,0x03,0x06,0x00,0x02,0x53,0x07,0xd3,0x5e,
-0x00,0x03,0xaa,0xaa,0xf4,0x5e,0x00,0x02,0x78,0x87,0xf4,0x5e,0x12,0x00,0x06,0x06,
-0x00,0xa3,0x4f,0x55,0x56,0x8a,0x10,0xe4,0x1b,0xcc,0xba,0x96,0xc9,0x04,0x0e,0x06,
-0x00,0x17,0xe3,0x33,0x03,0xe1,0x31,0x2e,0xdd,0xde,0xb0,0x00,0xd6,0x4f,0x33,0x32,
-0x10,0x00,0xd6,0x4e,0x21,0x03,0x10,0x4e,0xf4,0x04,0x81,0xf6,0x5e,0x00,0x00,0x12,
-0x33,0xd5,0x5e,0xc7,0x02,0xc3,0x4e,0x43,0x45,0x78,0x00,0xd5,0x1c,0xdd,0xc7,0x31,
-0x00,0xd5,0xe9,0x08,0x11,0x03,0xc9,0x0a,0x53,0x5f,0xee,0xee,0xed,0xf5,0x6a,0x04,
-0xd1,0x02,0x33,0x34,0x44,0xe5,0x00,0x5f,0xff,0xff,0xfe,0xd2,0x00,0x6d,0x14,0x00,
-0x57,0x5e,0x22,0x22,0x33,0x32,0x3a,0x0f,0x81,0x21,0x02,0xed,0xdd,0xdd,0x00,0x0a,
-0x80,0x6d,0x00,0x31,0xa9,0x04,0xe0,0xf0,0x08,0x10,0x4e,0xa2,0x0c,0x81,0xb9,0x05,
-0xe0,0x00,0x09,0xdd,0xde,0x90,0x6f,0x00,0xf4,0x06,0xa8,0x05,0xe0,0x00,0x01,0x30,
-0x0a,0x80,0x3f,0xed,0xef,0xff,0x00,0xa8,0x00,0x13,0x32,0x33,0x10,0x09,0x70,0x2b,
-0x1e,0x11,0xff,0x05,0x08,0x21,0x13,0x33,0x80,0x11,0x41,0x0c,0x10,0x00,0xd0,0xed,
-0x05,0x11,0x1f,0xec,0x05,0x00,0xc2,0x09,0x70,0x35,0xf7,0x55,0x6f,0x66,0x10,0x0a,
-0x83,0x0c,0x11,0xa2,0x55,0x26,0xf0,0x01,0x01,0xa1,0x88,0x88,0x80,0x0e,0x30,0x3e,
-0x4f,0x99,0x97,0x00,0xf3,0x04,0xe5,0xd0,0x43,0x05,0x01,0xb5,0x08,0x11,0xe3,0x0d,
-0x00,0x10,0x0e,0x0d,0x00,0xa2,0x2b,0xbb,0xf4,0x04,0xe5,0xd0,0x01,0x66,0x6f,0x40,
-0x1a,0x00,0x12,0x03,0x1a,0x00,0x13,0x3e,0x0d,0x00,0xb0,0xe7,0x89,0xbb,0x0e,0x30,
-0x3e,0x19,0xa9,0x86,0x20,0xe3,0xa6,0x0e,0x00,0x1a,0x00,0x01,0x83,0x05,0x21,0x03,
-0xe0,0x77,0x00,0x01,0x0d,0x00,0x36,0xd1,0x03,0xe0,0x6a,0x07,0xf0,0x02,0x20,0x03,
-0x20,0x88,0x88,0x60,0x0e,0x40,0xb8,0x4f,0x99,0x95,0x00,0xe4,0x0a,0x84,0xf0,0x03,
-0x06,0xe0,0xa9,0x4e,0x00,0x01,0x11,0xe5,0x0a,0x95,0xe0,0x02,0xff,0xff,0x50,0xa9,
-0xea,0x00,0x40,0xd5,0x0a,0x85,0xe0,0xc2,0x03,0xe1,0xa8,0x4f,0x88,0x9c,0x80,0xd5,
-0x0a,0x80,0x89,0x97,0x51,0x0d,0x50,0xa8,0x5d,0x04,0x50,0x05,0x30,0x00,0x23,0x33,
-0x22,0x0d,0x5f,0x0c,0xee,0xed,0xdd,0xdf,0x6e,0x1c,0x06,0x26,0x0f,0x40,0x6e,0x1c,
-0xe2,0x71,0x01,0x70,0x43,0x34,0x30,0x0f,0x40,0x4e,0x3f,0xdd,0xd9,0x00,0xe5,0xc6,
-0x09,0x11,0x50,0xc6,0x09,0x31,0xe5,0x04,0xe5,0x75,0x00,0x50,0x4e,0x5e,0x00,0x02,
-0x22,0x0d,0x00,0x00,0x75,0x00,0xe1,0x4e,0x5e,0x11,0x35,0x30,0xd5,0x04,0xe2,0xef,
-0xfe,0xc5,0x0d,0x50,0x4d,0xc3,0x01,0x80,0x04,0xd0,0x00,0x30,0x00,0x0d,0x40,0x5d,
-0x64,0x00,0x3e,0x51,0x03,0x90,0x71,0x00,0x03,0xee,0x23,0x34,0x80,0x00,0x13,0xf3,
-0x15,0xf0,0x02,0x40,0x03,0x10,0x44,0x45,0x30,0x0e,0x40,0xc7,0x3f,0xcc,0xc8,0x00,
-0xe4,0x0b,0x84,0xe0,0x30,0x00,0xe1,0xb8,0x5e,0x00,0x05,0x55,0xe5,0x0b,0x85,0xe0,
-0x01,0xcc,0xcf,0x50,0xb8,0xea,0x00,0xd1,0x0b,0x85,0xe1,0x12,0x53,0x0d,0x50,0xb7,
-0x2f,0xff,0xec,0x50,0xd5,0xa4,0x13,0x31,0x06,0x10,0x74,0x0a,0x1b,0x11,0x32,0x2a,
-0x2a,0x06,0x83,0x11,0x50,0x02,0x22,0x33,0x33,0xe5,0x83,0x11,0x00,0xac,0x0f,0x12,
-0x5e,0x06,0x11,0x11,0xe2,0x1c,0x0f,0x11,0x2e,0x49,0x02,0x31,0x02,0x44,0x44,0x4d,
-0x1f,0x5f,0xfd,0xde,0xdd,0xdc,0x10,0x44,0x08,0x05,0x26,0x01,0xf1,0x62,0x08,0x13,
-0x10,0x3b,0x0a,0x11,0x70,0xea,0x06,0x12,0x11,0x52,0x00,0x03,0xe7,0x08,0x13,0x6c,
-0x56,0x08,0x12,0xc0,0x3b,0x0a,0x18,0x9d,0x3b,0x0a,0x11,0x01,0x7f,0x07,0x02,0x00,
-0x08,0x16,0x70,0xc4,0x07,0x1a,0xf5,0xd3,0x07,0x50,0xdf,0xdd,0xdd,0xee,0xe0,0x79,
-0x07,0x34,0x6f,0x33,0x21,0x4e,0x10,0x00,0x89,0x13,0x53,0x5f,0x22,0x22,0x21,0x08,
-0xe5,0x28,0x0c,0xe3,0x07,0x01,0xc2,0x34,0x02,0x24,0x3d,0x1f,0x14,0xc5,0x09,0x0a,
-0x3f,0x01,0xa0,0x00,0x87,0x00,0x1d,0x13,0x7f,0x87,0x00,0x12,0xe0,0x87,0x00,0x5d,
-0x6e,0x22,0x22,0x21,0x07,0x87,0x00,0x0b,0xcb,0x07,0x1f,0x30,0xcb,0x07,0x01,0x1e,
-0x04,0xcb,0x07,0xf1,0x01,0x02,0x90,0x03,0x33,0x33,0x42,0x00,0x4d,0x07,0xfd,0xdd,
-0xdd,0x90,0x04,0xe0,0x8c,0x27,0x11,0x01,0x83,0x1a,0x03,0x0d,0x00,0x31,0x3e,0x08,
-0xc0,0xca,0x11,0xa1,0x8d,0x22,0x22,0x34,0x00,0x3e,0x04,0xef,0xff,0xfe,0x7c,0x18,
-0x02,0x61,0x1c,0x11,0x3e,0x6a,0x10,0x00,0xe2,0x00,0x10,0x4e,0x0d,0x00,0xdb,0x02,
-0x04,0xe1,0xcc,0xcd,0xfd,0xef,0xd4,0x4f,0x03,0x44,0x44,0x32,0xac,0x21,0x17,0xe0,
-0xfe,0x11,0xf2,0x01,0x02,0x80,0x0d,0xff,0xff,0xfd,0x00,0x5e,0x00,0xf5,0x22,0x22,
-0x00,0x04,0xe0,0x0f,0x43,0x05,0x11,0xf3,0x27,0x00,0x01,0xff,0x02,0x10,0x4f,0xde,
-0x01,0x71,0xf1,0x04,0xf0,0x00,0x15,0xe1,0x10,0x5b,0x00,0x00,0x8f,0x00,0xc4,0x11,
-0x14,0xe2,0x46,0x70,0x4e,0x1f,0xff,0xff,0xed,0xb8,0x04,0x59,0x12,0x21,0x03,0x80,
-0x59,0x12,0x12,0x6d,0xf3,0x01,0x02,0x20,0x06,0x12,0x6d,0x40,0x17,0x00,0x3f,0x1b,
-0x10,0xc0,0xab,0x0d,0x23,0x32,0x21,0xb9,0x1f,0x01,0x75,0x00,0x81,0xb8,0x00,0xf5,
-0x22,0x21,0x00,0x0b,0x80,0x75,0x00,0x10,0xb8,0x75,0x00,0x00,0x0d,0x00,0xc1,0x51,
-0x11,0x22,0x00,0xb8,0x00,0xcf,0xff,0xff,0xd1,0x0b,0x80,0xac,0x00,0x80,0xb8,0x00,
-0x00,0x3e,0x01,0x35,0x0b,0x83,0x4e,0x0f,0x65,0xa1,0xb8,0x02,0x22,0x21,0x10,0xea,
-0x11,0x00,0xef,0x17,0xc1,0xef,0xff,0x30,0x00,0x9b,0x32,0x22,0x22,0xe5,0x00,0x09,
-0xa0,0xb1,0x07,0x11,0x9a,0x30,0x05,0xf0,0x03,0x09,0xfc,0xcc,0xcc,0xdf,0x40,0x00,
-0x05,0x55,0x55,0x54,0x30,0x00,0x0c,0xdd,0xdd,0xdd,0xd6,0xc2,0x0f,0x34,0x34,0x43,
-0x33,0x0f,0x1a,0x01,0x02,0x23,0x27,0x00,0x00,0x0f,0x00,0x50,0xf4,0x22,0x22,0x47,
-0x70,0xad,0x3a,0x0e,0x21,0x0c,0x02,0x1a,0x0b,0x18,0xcd,0x21,0x0c,0x04,0x78,0x10,
-0x04,0x73,0x11,0x0a,0x0f,0x00,0x28,0x03,0xf0,0x21,0x0c,0x0b,0x66,0x02,0x2a,0x0f,
-0x50,0x15,0x17,0x40,0x72,0x22,0x22,0x32,0x0a,0x10,0x36,0xff,0xff,0xfe,0x86,0x17,
-0x91,0x32,0x22,0x11,0x11,0x22,0x22,0x30,0x6e,0xef,0x59,0x13,0x14,0x10,0x53,0x00,
-0x0f,0x21,0x0c,0x04,0x40,0x22,0x23,0x33,0x36,0x21,0x0c,0x4f,0xfe,0xee,0xee,0xeb,
-0x21,0x0c,0x06,0x01,0x8b,0x00,0xe1,0x60,0x0c,0xdd,0xdd,0xeb,0x00,0x4e,0x00,0xf6,
-0x44,0x33,0x10,0x03,0xe0,0xe2,0x0a,0x22,0x3e,0x01,0xf1,0x01,0x02,0x0d,0x00,0xb5,
-0x00,0xfe,0xdd,0xef,0xf3,0x03,0xe0,0x02,0x44,0x43,0x21,0x3d,0x14,0xc2,0x11,0x11,
-0x23,0x46,0x83,0x3e,0x0e,0xff,0xff,0xdc,0xa8,0x23,0x66,0x02,0x12,0x3e,0xe1,0x12,
-0x1e,0xe0,0x0d,0x00,0x12,0x3f,0x8d,0x02,0x11,0xf0,0x9a,0x02,0x11,0x06,0x7c,0x01,
+0x39,0xc0,0x00,0x00,0x3f,0xee,0xee,0xee,0xd8,0x00,0x00,0x03,0xb8,0x01,0x70,0x31,
+0x11,0x22,0x34,0x00,0x00,0x01,0x87,0x01,0x16,0xe3,0x96,0x01,0x00,0x87,0x00,0x12,
+0x60,0x52,0x05,0x13,0xc8,0x07,0x01,0x0a,0x16,0x01,0x04,0x0e,0x03,0x15,0x83,0x96,
+0x01,0x04,0xe1,0x01,0x2a,0x11,0x10,0xe2,0x01,0x51,0x80,0x00,0x00,0x01,0x70,0x64,
+0x04,0xd0,0x00,0x4d,0x00,0x00,0x02,0xf5,0x54,0x44,0x58,0xd0,0x00,0x00,0x2f,0x3a,
+0x08,0x00,0xc2,0x03,0x02,0x80,0x05,0xe0,0x2f,0x21,0x11,0x11,0x5d,0x00,0x00,0x01,
+0xef,0xff,0xff,0xff,0xa0,0x00,0x10,0x00,0x01,0x00,0xf0,0x0b,0x09,0x20,0x36,0x67,
+0x77,0x70,0x00,0xe4,0x06,0xaa,0x99,0xaf,0x30,0x0e,0x40,0x00,0x00,0x03,0xf0,0x00,
+0xe4,0x00,0x00,0x00,0x8b,0x00,0x0d,0x00,0x20,0x0e,0x50,0x0d,0x00,0x20,0x07,0xd0,
+0x0d,0x00,0x30,0x01,0xe5,0x00,0x0d,0x00,0x20,0xab,0x00,0x0d,0x00,0x20,0x6e,0x10,
+0x0d,0x00,0x20,0x3f,0x40,0x0d,0x00,0x70,0x3e,0x50,0x00,0x00,0x00,0xe4,0x0e,0x06,
+0x00,0x00,0x34,0x00,0x11,0x00,0x27,0x00,0x00,0x0d,0x00,0x11,0x30,0x07,0x00,0x11,
+0xe3,0x06,0x00,0x36,0x0d,0x20,0x00,0x01,0x00,0xf1,0x27,0x02,0x10,0x7c,0xdd,0xde,
+0xc0,0x00,0xc7,0x01,0x43,0x33,0x7e,0x00,0x0c,0x70,0x00,0x00,0x0a,0xa0,0x00,0xc7,
+0x00,0x00,0x03,0xf4,0x00,0x0b,0x70,0x00,0x01,0xda,0x00,0x00,0xb7,0x00,0x02,0xdc,
+0x00,0x00,0x0c,0x70,0x18,0xf9,0x00,0x00,0x00,0xc6,0x0d,0xb3,0x00,0x00,0x00,0x0c,
+0x60,0x3b,0x00,0xe2,0x20,0x00,0x00,0x33,0x33,0x34,0x44,0x00,0x00,0x4f,0xff,0xff,
+0xee,0xf4,0x68,0x00,0xf1,0x01,0x50,0x00,0x03,0x44,0x44,0x44,0xe4,0x00,0x05,0xff,
+0xff,0xff,0xed,0x10,0x00,0x6e,0x16,0x00,0xc1,0x05,0xf2,0x22,0x23,0x33,0x20,0x00,
+0x3e,0xff,0xff,0xee,0xe9,0x11,0x00,0xd0,0x03,0x03,0x34,0x45,0x30,0x00,0x4e,0x6d,
+0xdc,0xcd,0xf0,0x00,0x4f,0xd5,0x00,0x00,0x06,0x00,0x20,0x0c,0x80,0x06,0x00,0xf0,
+0x09,0x5f,0x20,0x00,0x4f,0x00,0x02,0xe7,0x00,0x00,0x4f,0x00,0x2e,0x90,0x00,0x00,
+0x4e,0x05,0xe8,0x00,0x00,0x00,0x4e,0xad,0x30,0x06,0x00,0x11,0x30,0xb1,0x00,0xf1,
+0x09,0x00,0x2c,0x00,0x00,0x00,0x3a,0x00,0x4e,0x00,0x00,0x00,0x4d,0x00,0x4f,0xee,
+0xee,0xee,0xfd,0x00,0x4e,0x44,0x44,0x44,0x8d,0x12,0x00,0xd2,0x5c,0x00,0x4e,0x11,
+0x11,0x11,0x6c,0x00,0x2e,0xff,0xff,0xff,0xf8,0x7d,0x00,0xf0,0x08,0x00,0x00,0x02,
+0x22,0x01,0x22,0x00,0x0f,0x30,0x00,0x5f,0xef,0x7d,0xff,0xc0,0x0f,0x40,0x00,0x00,
+0x0d,0x60,0x07,0xc0,0x20,0x01,0x40,0x0f,0x30,0x0a,0xa0,0x08,0x00,0x40,0x3f,0x00,
+0x0d,0x70,0x35,0x01,0xf0,0x04,0x7c,0x00,0x0f,0x30,0x0e,0x61,0x10,0x00,0xb7,0x00,
+0x4f,0x00,0x0e,0xff,0xf4,0x02,0xf2,0x00,0x9b,0xd3,0x00,0x40,0x08,0xb0,0x00,0xe5,
+0x50,0x01,0xc0,0x1f,0x30,0x05,0xe0,0x00,0x0d,0x40,0x00,0xaa,0x00,0x0d,0x80,0x08,
+0x00,0x60,0x41,0x00,0x7e,0x00,0x00,0x0d,0x68,0x01,0x13,0xa4,0x08,0x00,0x00,0x5e,
+0x01,0x1f,0x50,0x08,0x00,0x03,0x22,0x04,0x10,0x08,0x00,0xf0,0x28,0x01,0x80,0x78,
+0x85,0x38,0x85,0x00,0x4e,0x09,0x9c,0xd5,0x9b,0xf0,0x04,0xe0,0x00,0x9a,0x00,0x6e,
+0x00,0x4e,0x00,0x0b,0x70,0x09,0xb0,0x04,0xe0,0x00,0xf4,0x00,0xb8,0x00,0x4e,0x00,
+0x3f,0x00,0x0f,0x5c,0xcd,0xe0,0x08,0xb0,0x04,0xf1,0x55,0x8e,0x00,0xe5,0x00,0x9b,
+0x00,0x04,0xe0,0x6d,0x88,0x00,0xf1,0x09,0x4f,0x0e,0x50,0x06,0xe0,0x00,0x03,0xf6,
+0xb0,0x00,0xe7,0x00,0x00,0x3e,0x00,0x00,0x8d,0x00,0x00,0x03,0xe0,0x00,0x05,0x20,
+0x0d,0x00,0x11,0x00,0x0d,0x00,0x10,0x00,0x28,0x01,0x02,0x0d,0x00,0x12,0xd0,0x6f,
+0x00,0x04,0xe9,0x01,0xd0,0x0d,0xee,0xea,0x4e,0xff,0xe0,0x00,0x00,0x33,0x3a,0xb0,
+0x22,0x4f,0x8c,0x00,0x42,0xa9,0x00,0x02,0xf1,0xb3,0x01,0x10,0x3f,0x28,0x00,0x30,
+0xf1,0x00,0x04,0x3f,0x00,0xf2,0x19,0x6c,0x00,0x00,0x5d,0x00,0x00,0x00,0x0a,0x70,
+0x00,0x07,0xb0,0x00,0x00,0x00,0x10,0x00,0x00,0x22,0x00,0x00,0x22,0x22,0x22,0x22,
+0x23,0x33,0x40,0x7e,0xff,0xff,0xff,0xee,0xee,0xed,0x20,0x00,0x00,0x04,0xf0,0x55,
+0x00,0x13,0x4f,0xdc,0x00,0x27,0xf0,0x00,0x7a,0x00,0x02,0x49,0x00,0x06,0x0f,0x00,
+0x23,0x02,0x80,0x84,0x00,0x00,0x4e,0x00,0xc1,0x0e,0xff,0xf8,0x5f,0xff,0xf0,0x00,
+0x00,0x12,0x2b,0xa0,0x11,0x87,0x00,0x30,0xc7,0x00,0x03,0x3e,0x00,0x21,0x0f,0x40,
+0x4d,0x00,0x40,0x03,0xf1,0x00,0x05,0x3e,0x00,0x10,0x7d,0x8a,0x00,0x00,0x14,0x02,
+0x00,0x7d,0x01,0xd2,0x00,0x01,0xf2,0x00,0x00,0x99,0x00,0x00,0x00,0x4b,0x00,0x00,
+0x08,0x7c,0x02,0x07,0x01,0x00,0x21,0x9e,0xff,0x01,0x00,0x41,0x21,0x33,0x33,0x22,
+0x67,0x02,0x03,0x69,0x00,0x41,0x1e,0xff,0xfb,0x4f,0x69,0x00,0x31,0x29,0xb0,0x11,
+0xa7,0x00,0x12,0xb7,0x69,0x00,0x21,0x1f,0x20,0x98,0x00,0x52,0x07,0xc0,0x00,0x06,
+0xc0,0xba,0x01,0x15,0x58,0x4b,0x00,0x21,0x6e,0xee,0x01,0x00,0x21,0x10,0x33,0x01,
+0x00,0x15,0x30,0x18,0x00,0xc1,0x34,0x44,0x44,0x44,0x20,0x00,0x00,0x2f,0xee,0xee,
+0xee,0xfe,0x97,0x03,0x01,0x04,0x00,0x00,0x37,0x01,0x12,0x3f,0x0f,0x00,0x00,0x7a,
+0x01,0xf0,0x0f,0x2f,0xcb,0xbb,0xcc,0xdd,0x00,0x00,0x00,0x35,0x55,0x55,0x44,0x10,
+0x00,0x00,0x12,0x22,0x10,0x23,0x32,0x00,0x00,0x1f,0xff,0xfd,0x3e,0xef,0xf1,0x00,
+0x00,0xc8,0x00,0x17,0x2f,0xf0,0x00,0x21,0x2f,0x10,0x87,0x00,0x22,0x08,0xa0,0x87,
+0x00,0xf0,0x00,0x52,0x00,0x00,0x24,0x00,0x02,0x54,0x44,0x44,0x44,0x44,0x45,0x50,
+0x6c,0xcc,0x01,0x00,0x24,0xbb,0x10,0x7f,0x00,0x80,0x01,0x12,0x22,0x22,0x31,0x00,
+0x00,0x01,0xe7,0x00,0x43,0xd0,0x00,0x00,0x2f,0x57,0x01,0x52,0xf4,0x34,0x44,0x44,
+0x30,0x96,0x00,0x22,0xec,0x00,0x56,0x00,0x00,0x92,0x00,0x00,0xbb,0x00,0x82,0x00,
+0x00,0x02,0xef,0xff,0xff,0xfe,0xe2,0x13,0x00,0x42,0x30,0x00,0x01,0x50,0x8f,0x01,
+0x12,0x4f,0x9e,0x01,0x22,0x05,0xf0,0x0f,0x00,0x12,0x5e,0xbc,0x01,0x01,0x72,0x01,
+0x13,0x4f,0x0f,0x00,0x21,0xf3,0x33,0x0f,0x00,0x40,0x3f,0xee,0xd1,0x5e,0x90,0x01,
+0x02,0x1e,0x00,0x00,0xe8,0x00,0x04,0x0f,0x00,0xb5,0xf4,0x45,0x68,0x90,0x3f,0x00,
+0x00,0x2d,0xdd,0xcb,0x96,0x74,0x00,0x02,0x07,0x00,0x0f,0x0f,0x00,0x04,0x13,0x06,
+0xc7,0x00,0x40,0x50,0x00,0x02,0xa0,0xfa,0x00,0x02,0x87,0x00,0x13,0x02,0xea,0x01,
+0x21,0x2f,0x10,0x5a,0x00,0x32,0x02,0xf8,0x77,0x0f,0x00,0x30,0xbb,0xa1,0x6d,0x0f,
+0x00,0xf3,0x00,0xf0,0x00,0x05,0xf9,0x89,0xac,0xe2,0x2f,0x00,0x00,0x18,0x99,0x98,
+0x63,0x02,0x4b,0x00,0xf3,0x01,0x1b,0x00,0x00,0x00,0x13,0x33,0x33,0x44,0x40,0x00,
+0x00,0x09,0xff,0xff,0xfe,0xef,0xca,0x04,0xf2,0x05,0xf3,0x00,0x00,0x01,0x44,0x44,
+0x44,0x4f,0x20,0x00,0x00,0xbf,0xee,0xee,0xee,0xc0,0x00,0x00,0x0b,0x90,0x1a,0x00,
+0xd2,0xbb,0x22,0x22,0x33,0x31,0x00,0x00,0x07,0xff,0xff,0xfe,0xee,0x70,0x13,0x00,
+0x42,0x40,0x00,0x01,0x70,0xa5,0x00,0x17,0x4f,0xe1,0x00,0x22,0x2f,0x00,0x87,0x00,
+0x22,0xf5,0x55,0x0f,0x00,0x32,0xdd,0xc1,0x5e,0x87,0x00,0xd3,0x06,0xe2,0x22,0x35,
+0x81,0x2f,0x00,0x00,0x3f,0xff,0xfe,0xc9,0x12,0x87,0x00,0x16,0x1e,0x7e,0x02,0xe1,
+0x0a,0xee,0xee,0xff,0xfd,0x00,0x00,0x00,0xc9,0x33,0x33,0x24,0xf1,0x00,0x42,0x05,
+0x00,0xe7,0x01,0x21,0xd7,0x00,0x5e,0x03,0x22,0x0d,0x70,0xaf,0x01,0xc3,0xbe,0xcb,
+0xbc,0xcd,0xf0,0x00,0x00,0x01,0x45,0x55,0x44,0x42,0x94,0x01,0x30,0x01,0x61,0x80,
+0xb8,0x03,0x20,0x4e,0x4f,0x3e,0x02,0x31,0x04,0xe4,0xf0,0x0d,0x00,0x11,0x5e,0x0d,
+0x00,0x25,0xe5,0xe0,0x0d,0x00,0x20,0xf3,0x37,0x0d,0x00,0x39,0x3f,0xdd,0xee,0x1a,
+0x00,0x11,0x6e,0x0d,0x00,0xd2,0xe6,0xe4,0x45,0x88,0x3e,0x00,0x4e,0x2b,0xcb,0xa7,
+0x43,0xe0,0x04,0xa5,0x01,0x11,0x4e,0xd2,0x00,0x07,0x0d,0x00,0x23,0x02,0xe0,0x8d,
+0x03,0x11,0x04,0x06,0x00,0x21,0x90,0x1d,0x7a,0x01,0x00,0xa2,0x00,0x19,0x01,0x06,
+0x00,0xc2,0x3f,0x10,0x02,0x55,0x56,0xf1,0x3f,0x00,0x05,0xdd,0xdd,0xf1,0x0f,0x04,
+0x1e,0x3f,0x06,0x00,0xb1,0x88,0x9a,0xde,0x01,0xf1,0x07,0x98,0x87,0x52,0x01,0xf1,
+0x97,0x02,0x0e,0x06,0x00,0x17,0xf0,0x98,0x03,0x30,0x31,0x1b,0x00,0xef,0x02,0x23,
+0x2f,0x10,0x06,0x00,0xa1,0x33,0x33,0xd7,0x2f,0x00,0x03,0xee,0xee,0xf7,0x3f,0x18,
+0x00,0x03,0x06,0x00,0xb1,0x54,0x45,0x7a,0x30,0xc6,0x1d,0xee,0xdd,0xb8,0x10,0xd6,
+0x36,0x00,0xc2,0x83,0x00,0x02,0x33,0x33,0x33,0x10,0x00,0x7f,0xff,0xff,0xfe,0x54,
+0x06,0x11,0xe5,0x12,0x00,0x10,0xe5,0x12,0x00,0x41,0xff,0xe2,0x00,0x8d,0x14,0x00,
+0x50,0x8d,0x22,0x22,0x23,0x32,0x78,0x06,0x27,0xff,0xe9,0x72,0x00,0x30,0x43,0x01,
+0xd1,0x92,0x01,0x21,0x90,0x2f,0xdf,0x04,0x71,0x02,0xf1,0x00,0x03,0x33,0x3b,0x90,
+0x74,0x00,0x11,0xf9,0x8c,0x02,0x20,0x0a,0x80,0xaf,0x03,0xc0,0x00,0xa8,0x02,0xfd,
+0xdd,0xef,0xf4,0x0a,0x80,0x04,0x54,0x43,0xeb,0x05,0xb1,0x00,0x01,0x20,0x00,0x08,
+0x40,0x00,0x00,0x9f,0xff,0xe5,0xc4,0x00,0x13,0x21,0x3d,0x03,0xf0,0x12,0xed,0x00,
+0x01,0x11,0x11,0x11,0x11,0x10,0x00,0x02,0xad,0xee,0xd9,0x20,0x00,0x01,0xf9,0x32,
+0x23,0x9f,0x00,0x00,0x1f,0x60,0x00,0x06,0xf1,0x00,0x00,0x5e,0xfe,0xef,0xe5,0x2d,
+0x00,0x24,0x33,0x10,0xcf,0x01,0x20,0x71,0x80,0x74,0x07,0x20,0x4e,0x4f,0x74,0x07,
+0x00,0xcf,0x01,0x00,0x0d,0x00,0x12,0x4e,0x0d,0x00,0x13,0xe0,0x0d,0x00,0xc1,0x5c,
+0xdd,0xf4,0x04,0xe4,0xe0,0x01,0x44,0x4e,0x40,0x4e,0x5e,0x1a,0x00,0x12,0xe5,0x1a,
+0x00,0x12,0x5d,0x0d,0x00,0xd1,0xe5,0x57,0x99,0x0e,0x40,0x4e,0x1b,0xcb,0xa7,0x40,
+0xe4,0x04,0xe0,0xc2,0x07,0x01,0x41,0x05,0x09,0x0d,0x00,0x13,0xd3,0x6b,0x05,0x13,
+0x04,0xd1,0x01,0x04,0xe1,0x07,0x23,0x00,0x0f,0x7f,0x06,0x1a,0xf4,0x0f,0x00,0x13,
+0xf3,0x0f,0x00,0xb0,0x41,0x11,0x11,0x21,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0x84,
+0x03,0x22,0x11,0x11,0x18,0x00,0x13,0x07,0x27,0x03,0x12,0x8a,0x07,0x00,0x10,0x08,
+0x1c,0x00,0x91,0x24,0x44,0x44,0xbb,0x44,0x44,0x44,0x09,0xdd,0x01,0x00,0x15,0xd2,
+0xb9,0x06,0x1a,0xd5,0xd0,0x06,0x03,0x78,0x00,0x13,0x0e,0x69,0x00,0x50,0xef,0xfe,
+0xee,0xef,0xa0,0x11,0x01,0x35,0x7f,0x33,0x31,0x04,0x06,0x93,0x14,0x44,0x44,0x7f,
+0x44,0x44,0x45,0x07,0xed,0x4b,0x00,0x04,0x01,0x00,0x61,0x11,0x11,0x11,0x12,0x10,
+0x00,0xc0,0x01,0x10,0xfe,0xb2,0x02,0x21,0x20,0x00,0x55,0x00,0x12,0xa7,0xa8,0x08,
+0x21,0x0a,0x70,0xa9,0x08,0xf3,0x01,0x15,0xca,0x55,0x5e,0x86,0x20,0x00,0x06,0xcc,
+0xcc,0xcc,0xcb,0xa4,0x00,0x00,0x08,0x0c,0x05,0x12,0xf2,0x08,0x00,0x2a,0x1f,0x20,
+0x0f,0x00,0x12,0x10,0x0f,0x00,0x50,0xf3,0x11,0x11,0x23,0x20,0x66,0x06,0x3c,0xff,
+0xff,0xea,0x29,0x06,0x11,0x07,0x57,0x05,0x9f,0xdd,0xe2,0x25,0x55,0x55,0x7f,0x44,
+0x44,0x43,0xb1,0x04,0x07,0x1a,0x3f,0xc7,0x06,0x16,0x02,0x06,0x00,0x00,0x03,0x09,
+0x0a,0x07,0x01,0x13,0xd5,0x07,0x01,0xc5,0x61,0x11,0x12,0x22,0x00,0x00,0x00,0xbf,
+0xff,0xff,0xfe,0xa0,0x71,0x00,0x20,0xdd,0xdc,0x71,0x00,0x85,0xd2,0x13,0x34,0x44,
+0x7f,0x44,0x33,0x32,0x29,0x07,0x30,0x04,0x44,0x7f,0x7f,0x00,0x57,0x03,0xde,0xee,
+0xdd,0xdd,0x49,0x07,0x50,0x23,0x33,0x33,0x37,0xf0,0x7a,0x05,0x73,0xee,0xee,0xdb,
+0x00,0x00,0x04,0xf1,0x1a,0x00,0xcf,0x42,0x22,0x33,0x44,0x10,0x00,0x01,0xdf,0xff,
+0xff,0xfe,0xd6,0x07,0x01,0x06,0x19,0xf1,0x07,0x01,0x10,0x02,0x07,0x01,0x01,0x04,
+0x07,0x3c,0xff,0xff,0xe7,0x07,0x01,0x11,0x06,0x06,0x01,0xd2,0xde,0xd0,0x25,0x55,
+0xf7,0x54,0x4e,0x74,0x32,0x00,0x00,0x0f,0x20,0xcd,0x01,0x12,0xf3,0xcd,0x01,0x22,
+0x0f,0x30,0x0f,0x00,0x13,0xf2,0x0f,0x00,0x12,0x20,0x37,0x0a,0x12,0x20,0x02,0x01,
+0x33,0x03,0x10,0x00,0x96,0x03,0x04,0xf1,0x09,0x09,0x0f,0x00,0x1a,0x40,0x95,0x02,
+0x30,0x50,0x00,0x00,0x6a,0x02,0x52,0xdf,0xff,0xff,0xff,0xb0,0xf8,0x01,0x1f,0x00,
+0x01,0x00,0x05,0x12,0x7e,0x7c,0x07,0x14,0x21,0x7c,0x07,0x2a,0x0a,0x40,0x61,0x01,
+0x0b,0x69,0x00,0x11,0x73,0x13,0x07,0x01,0x70,0x01,0x1c,0x80,0x4b,0x00,0x12,0x8f,
+0x12,0x08,0x21,0x20,0x22,0x01,0x00,0x15,0x20,0x2b,0x03,0x04,0x0d,0x03,0x19,0x30,
+0x0f,0x00,0x13,0x1f,0x0f,0x00,0x50,0xff,0xee,0xee,0xef,0xf2,0xc2,0x02,0x37,0x33,
+0x33,0x32,0xe9,0x00,0x0b,0xf7,0x02,0x0b,0xe9,0x00,0x61,0xdf,0xee,0xef,0xff,0xc0,
+0x00,0x22,0x09,0x15,0x10,0x80,0x00,0x11,0x5c,0x69,0x02,0x31,0xcd,0x12,0x55,0x01,
+0x00,0x16,0x40,0x99,0x00,0x22,0x03,0x43,0xa0,0x00,0x20,0xdc,0xdf,0x24,0x02,0x52,
+0x8e,0x20,0x00,0x2d,0x90,0x24,0x06,0x00,0x02,0x04,0x11,0xc8,0x09,0x0b,0x60,0x00,
+0x05,0xf8,0x32,0x38,0xf5,0x25,0x02,0x33,0xad,0xed,0x93,0x37,0x00,0x31,0xb0,0x1d,
+0x00,0xaa,0x05,0x05,0x06,0x00,0x12,0x00,0x06,0x00,0x2f,0xf2,0x3f,0x06,0x00,0x04,
+0x16,0x4f,0x06,0x00,0xc2,0xf1,0x4f,0x88,0x8a,0xce,0x10,0xf1,0x08,0x99,0x87,0x52,
+0x00,0x25,0x02,0x0d,0xb6,0x05,0x03,0x18,0x00,0x02,0xc0,0x00,0x11,0x62,0xb6,0x05,
+0x3f,0xd6,0x2f,0x10,0x06,0x00,0x04,0x01,0x1e,0x00,0xf4,0x00,0x3f,0x00,0x00,0x24,
+0x10,0xd5,0x2f,0xff,0xff,0xfd,0x30,0xd5,0x02,0x33,0x22,0x25,0x01,0x31,0x20,0x00,
+0x4d,0xe7,0x03,0x71,0x7d,0x54,0x44,0x44,0xf4,0x00,0x7c,0x08,0x02,0x08,0x06,0x00,
+0xa2,0x6f,0xcb,0xbc,0xcc,0xf3,0x00,0x04,0x55,0x54,0x44,0xb6,0x02,0x21,0x41,0x1b,
+0x61,0x01,0x2c,0x2f,0x10,0x06,0x00,0x27,0x3f,0x00,0x06,0x00,0xa2,0x32,0x23,0x58,
+0x20,0xd5,0x1f,0xff,0xff,0xda,0x20,0x66,0x00,0x13,0xc4,0x16,0x01,0x71,0x59,0x00,
+0x00,0x00,0xb2,0x00,0x7b,0xd7,0x0c,0xb3,0x7f,0xee,0xee,0xee,0xf3,0x00,0x7c,0x44,
+0x44,0x44,0xe3,0x12,0x00,0xb1,0x7b,0x11,0x11,0x11,0xf3,0x00,0x5e,0xff,0xff,0xff,
+0xe1,0x06,0x0c,0x10,0x10,0xd8,0x04,0xa1,0x10,0x0d,0x50,0x00,0xde,0xee,0xdd,0x50,
+0x0d,0x50,0xc8,0x01,0x06,0x07,0x00,0x20,0xe4,0x00,0x15,0x0c,0x02,0x07,0x00,0x30,
+0x72,0x20,0xf4,0x7a,0x0a,0x21,0xff,0xf8,0x07,0x00,0x2a,0x50,0x00,0x07,0x00,0xc2,
+0xe7,0x33,0x45,0x75,0x0c,0x50,0x00,0x9d,0xed,0xdb,0xa4,0x0c,0x13,0x02,0x2f,0x0c,
+0x60,0x07,0x00,0x07,0x03,0x3c,0x05,0xd5,0x09,0x30,0x00,0xbe,0xee,0xee,0x30,0x0d,
+0x60,0x00,0xe7,0x33,0x32,0x69,0x00,0x0a,0x07,0x00,0x31,0x84,0x30,0xe4,0x77,0x00,
+0x21,0xf6,0xe4,0x3f,0x00,0x00,0x69,0x00,0x87,0x82,0x0c,0x60,0x00,0x9d,0xed,0xb7,
+0x51,0x54,0x00,0x11,0x20,0x07,0x00,0x00,0xa9,0x04,0x24,0x08,0x30,0xb0,0x04,0x0a,
+0x07,0x00,0x10,0x02,0xc8,0x02,0x11,0x80,0x4e,0x04,0x13,0x32,0xc0,0x04,0x81,0x60,
+0x00,0xbe,0xdd,0xde,0x70,0x06,0xd0,0x7e,0x00,0x21,0x06,0xd0,0x70,0x00,0x15,0x05,
+0x07,0x00,0x10,0xf4,0x07,0x00,0x02,0x6d,0x07,0xf2,0x01,0x05,0xe2,0x21,0xe5,0x11,
+0x13,0x53,0x05,0xd0,0x00,0xbf,0xff,0xeb,0x94,0x05,0xd0,0x58,0x00,0x15,0xb0,0x2c,
+0x0e,0x50,0xd0,0x00,0x00,0x02,0xb0,0x69,0x00,0x00,0x1c,0x05,0xd2,0x03,0xff,0xfe,
+0xee,0xff,0xe0,0x00,0x03,0xf3,0x33,0x32,0x26,0xe0,0x15,0x00,0xa0,0xd0,0x00,0x03,
+0xf2,0x22,0x22,0x26,0xd0,0x00,0x01,0x69,0x06,0x12,0x90,0x1a,0x07,0xf0,0x01,0x07,
+0x14,0x66,0x66,0x60,0x4d,0x00,0xe3,0xcd,0xbb,0xb9,0x04,0xe0,0x0f,0x3d,0x60,0x7a,
+0x0a,0x20,0xe3,0xd6,0x43,0x00,0x17,0x0e,0x0d,0x00,0xa2,0xe4,0x4f,0x3d,0x50,0x00,
+0x00,0x4f,0xdd,0xf3,0xd5,0x1a,0x00,0x11,0x50,0x1a,0x00,0x03,0x0d,0x00,0xb0,0x95,
+0x68,0xa4,0x4e,0x00,0xe3,0x6b,0xba,0x97,0x14,0xe0,0x22,0x06,0x00,0x1a,0x00,0x01,
+0xa0,0x05,0x01,0x86,0x03,0x11,0x4e,0xc9,0x00,0x23,0x04,0xd0,0x93,0x03,0x02,0x06,
+0x00,0xd1,0x91,0x19,0x88,0x88,0x80,0x00,0xe4,0x4f,0x99,0x99,0x70,0x00,0xe4,0x09,
+0x03,0x03,0x06,0x00,0x02,0x53,0x07,0xd3,0x5e,0x00,0x03,0xaa,0xaa,0xf4,0x5e,0x00,
+0x02,0x78,0x87,0xf4,0x5e,0x12,0x00,0x06,0x06,0x00,0xa3,0x4f,0x55,0x56,0x8a,0x10,
+0xe4,0x1b,0xcc,0xba,0x96,0xc9,0x04,0x0e,0x06,0x00,0x70,0xe3,0x00,0x00,0x00,0x00,
+0x00,0x10,0x10,0x00,0x01,0x00,0xe0,0x31,0x2e,0xdd,0xde,0xb0,0x00,0xd6,0x4f,0x33,
+0x32,0x10,0x00,0xd6,0x4e,0x12,0x00,0x00,0x06,0x00,0xa0,0xdf,0xff,0xf6,0x5e,0x00,
+0x00,0x12,0x33,0xd5,0x5e,0x12,0x00,0xd1,0xd5,0x4e,0x43,0x45,0x78,0x00,0xd5,0x1c,
+0xdd,0xc7,0x31,0x00,0xd5,0x36,0x00,0xe1,0x83,0x00,0x03,0x33,0x33,0x44,0x40,0x00,
+0x5f,0xee,0xee,0xed,0xf5,0x00,0x24,0x00,0xe1,0x00,0x02,0x33,0x34,0x44,0xe5,0x00,
+0x5f,0xff,0xff,0xfe,0xd2,0x00,0x6d,0x14,0x00,0xb1,0x5e,0x22,0x22,0x33,0x32,0x00,
+0x3e,0xff,0xff,0xee,0xe9,0x10,0x00,0x81,0x21,0x02,0xed,0xdd,0xdd,0x00,0x0a,0x80,
+0x6d,0x00,0xf1,0x06,0xa9,0x04,0xe0,0x00,0x00,0x00,0x0a,0x90,0x4e,0x00,0x00,0x34,
+0x44,0xb9,0x05,0xe0,0x00,0x09,0xdd,0xde,0x90,0x6f,0x00,0xf2,0x07,0xa8,0x05,0xe0,
+0x00,0x01,0x30,0x0a,0x80,0x3f,0xed,0xef,0xff,0x00,0xa8,0x00,0x13,0x32,0x33,0x10,
+0x09,0x70,0x00,0x01,0x00,0xf0,0x1e,0x09,0xff,0xff,0xff,0xff,0xa0,0x00,0x13,0x33,
+0x22,0x22,0x20,0x00,0x00,0x0c,0x10,0x00,0xd0,0x00,0x00,0x00,0xf2,0x00,0x1f,0x00,
+0x00,0x00,0x0f,0x20,0x01,0xf0,0x00,0x00,0x35,0xf7,0x55,0x6f,0x66,0x10,0x0a,0xcc,
+0xcc,0xcc,0xbb,0xa2,0x31,0x00,0xf1,0x0c,0x60,0x01,0xa1,0x88,0x88,0x80,0x0e,0x30,
+0x3e,0x4f,0x99,0x97,0x00,0xf3,0x04,0xe5,0xd0,0x00,0x00,0x0f,0x30,0x4e,0x5d,0x00,
+0x00,0x00,0xe3,0x0d,0x00,0x10,0x0e,0x0d,0x00,0xa2,0x2b,0xbb,0xf4,0x04,0xe5,0xd0,
+0x01,0x66,0x6f,0x40,0x1a,0x00,0x12,0x03,0x1a,0x00,0x13,0x3e,0x0d,0x00,0xe1,0xe7,
+0x89,0xbb,0x0e,0x30,0x3e,0x19,0xa9,0x86,0x20,0xe3,0x03,0xe0,0x00,0x1a,0x00,0x00,
+0x5b,0x00,0x31,0xf3,0x03,0xe0,0x77,0x00,0x01,0x0d,0x00,0x31,0xd1,0x03,0xe0,0xa1,
+0x00,0x10,0x02,0x05,0x00,0xf0,0x15,0x20,0x03,0x20,0x88,0x88,0x60,0x0e,0x40,0xb8,
+0x4f,0x99,0x95,0x00,0xe4,0x0a,0x84,0xf0,0x00,0x00,0x0e,0x50,0xa9,0x4e,0x00,0x01,
+0x11,0xe5,0x0a,0x95,0xe0,0x02,0xff,0xff,0x50,0xa9,0x5e,0x34,0x01,0xf0,0x06,0x0a,
+0x85,0xe0,0x00,0x00,0x0d,0x50,0xa8,0x4f,0x88,0x9c,0x80,0xd5,0x0a,0x80,0x89,0x97,
+0x51,0x0d,0x50,0xa8,0x41,0x00,0xf1,0x01,0x41,0x05,0x30,0x00,0x23,0x33,0x44,0x44,
+0x30,0x00,0x0c,0xee,0xed,0xdd,0xdf,0x40,0x5b,0x00,0x11,0xe5,0x06,0x00,0x27,0x0e,
+0x50,0x0d,0x00,0x12,0x0f,0x1a,0x00,0x01,0xea,0x00,0xf1,0x01,0x71,0x01,0x70,0x43,
+0x34,0x30,0x0f,0x40,0x4e,0x3f,0xdd,0xd9,0x00,0xe5,0x04,0xe4,0x75,0x00,0x20,0x4e,
+0x4e,0x2c,0x00,0x21,0x04,0xe5,0x75,0x00,0x50,0x4e,0x5e,0x00,0x02,0x22,0x0d,0x00,
+0x00,0x75,0x00,0xe1,0x4e,0x5e,0x11,0x35,0x30,0xd5,0x04,0xe2,0xef,0xfe,0xc5,0x0d,
+0x50,0x4d,0xc3,0x01,0x80,0x04,0xd0,0x00,0x30,0x00,0x0d,0x40,0x5d,0x64,0x00,0x3f,
+0x51,0x03,0x90,0x71,0x00,0x01,0xc0,0x0d,0xfe,0xee,0xee,0xff,0x80,0x00,0x13,0x33,
+0x33,0x32,0x20,0x10,0x00,0xf0,0x02,0x40,0x03,0x10,0x44,0x45,0x30,0x0e,0x40,0xc7,
+0x3f,0xcc,0xc8,0x00,0xe4,0x0b,0x84,0xe0,0x30,0x00,0xe1,0xb8,0x5e,0x00,0x05,0x55,
+0xe5,0x0b,0x85,0xe0,0x01,0xcc,0xcf,0x50,0xb8,0xea,0x00,0xe0,0x0b,0x85,0xe1,0x12,
+0x53,0x0d,0x50,0xb7,0x2f,0xff,0xec,0x50,0xd5,0x0b,0xce,0x01,0xf4,0x01,0x06,0x10,
+0x74,0x00,0x00,0x22,0x22,0x23,0x32,0x00,0x00,0x4f,0xff,0xfe,0xee,0xf4,0x6c,0x00,
+0xe1,0x02,0x22,0x33,0x33,0xe5,0x00,0x05,0xff,0xff,0xee,0xed,0x20,0x00,0x5e,0x16,
+0x00,0x81,0x05,0xe2,0x22,0x23,0x33,0x20,0x00,0x2e,0x49,0x02,0x20,0x02,0x44,0x17,
+0x01,0xb1,0x00,0x00,0xfd,0xde,0xdd,0xdc,0x10,0x00,0x00,0x1f,0x20,0x23,0x00,0x22,
+0x01,0xf1,0x20,0x02,0x29,0x1f,0x10,0x0f,0x00,0x00,0x1e,0x00,0x00,0x12,0x00,0x60,
+0xef,0xff,0xff,0xff,0x70,0x00,0x70,0x00,0x12,0x11,0x52,0x00,0x12,0xa0,0x20,0x00,
+0x12,0x6c,0x07,0x00,0xe1,0x06,0xc0,0x00,0x00,0x00,0x24,0x44,0x44,0x9d,0x44,0x44,
+0x44,0x09,0xdd,0x01,0x00,0x41,0xd2,0x00,0x01,0x22,0x64,0x02,0x22,0x00,0xdf,0x3c,
+0x00,0x03,0x07,0x01,0x12,0x00,0xef,0x02,0x05,0x0f,0x00,0xc0,0xdf,0xdd,0xdd,0xee,
+0xe0,0x00,0x00,0x01,0x33,0x6f,0x33,0x21,0x10,0x00,0x20,0x04,0xf0,0x05,0x02,0x81,
+0x22,0x22,0x5f,0x22,0x22,0x21,0x08,0xff,0x01,0x00,0x2b,0xf2,0x00,0x01,0x00,0x10,
+0x3f,0x16,0x00,0x83,0x00,0x00,0x00,0x12,0x22,0x22,0x14,0xf0,0x13,0x00,0x02,0x07,
+0x00,0x1a,0x03,0x0f,0x00,0x3f,0x01,0xa0,0x00,0x87,0x00,0x1d,0x13,0x7f,0x87,0x00,
+0x12,0xe0,0x87,0x00,0x5d,0x6e,0x22,0x22,0x21,0x07,0x87,0x00,0x21,0x03,0x43,0x07,
+0x00,0x30,0x8f,0xdc,0xdf,0x08,0x01,0xb0,0x8e,0x30,0x00,0x2d,0x90,0x00,0x00,0x0d,
+0x70,0x00,0x00,0xf1,0x02,0xc0,0xc8,0x00,0x00,0x07,0xd0,0x00,0x00,0x04,0xf8,0x32,
+0x38,0xf5,0x4a,0x00,0x33,0xad,0xed,0x93,0x37,0x00,0xf0,0x01,0x02,0x90,0x03,0x33,
+0x33,0x42,0x00,0x4d,0x07,0xfd,0xdd,0xdd,0x90,0x04,0xe0,0x8c,0x14,0x00,0x20,0x4e,
+0x08,0x3c,0x01,0x03,0x0d,0x00,0x11,0x3e,0x0d,0x00,0xf1,0x00,0x03,0xe0,0x8d,0x22,
+0x22,0x34,0x00,0x3e,0x04,0xef,0xff,0xfe,0xc0,0x03,0xe0,0x82,0x01,0x11,0x3e,0x03,
+0x00,0x21,0x03,0xe0,0xe2,0x00,0x10,0x4e,0x0d,0x00,0xd2,0x02,0x04,0xe1,0xcc,0xcd,
+0xfd,0xef,0xd4,0x4f,0x03,0x44,0x44,0x32,0x37,0x01,0x32,0x00,0x00,0x4f,0x9f,0x00,
+0x12,0xe0,0xfe,0x00,0x02,0x75,0x00,0xf0,0x02,0x80,0x0d,0xff,0xff,0xfd,0x00,0x5e,
+0x00,0xf5,0x22,0x22,0x00,0x04,0xe0,0x0f,0x30,0x00,0x41,0x00,0x11,0xf3,0x27,0x00,
+0x01,0xff,0x02,0x10,0x4f,0xde,0x01,0x71,0xf1,0x04,0xf0,0x00,0x15,0xe1,0x10,0x5b,
+0x00,0x00,0x8f,0x00,0xb1,0x11,0x14,0xe2,0x46,0x70,0x4e,0x1f,0xff,0xff,0xed,0xb8,
+0x0b,0x01,0x00,0x34,0x00,0x63,0x03,0x80,0x00,0x00,0x03,0xd0,0x9c,0x04,0x21,0x06,
+0xd0,0x07,0x00,0x12,0x6d,0x0f,0x02,0xb2,0xff,0xee,0xee,0xff,0xc0,0x00,0x02,0x33,
+0x33,0x32,0x21,0x11,0x00,0x11,0x20,0x75,0x00,0x81,0xb8,0x00,0xf5,0x22,0x21,0x00,
+0x0b,0x80,0x75,0x00,0x10,0xb8,0x75,0x00,0x00,0x0d,0x00,0xc1,0x51,0x11,0x22,0x00,
+0xb8,0x00,0xcf,0xff,0xff,0xd1,0x0b,0x80,0xac,0x00,0xf3,0x06,0xb8,0x00,0x00,0x3e,
+0x01,0x35,0x0b,0x83,0xee,0xee,0xff,0xfd,0xa1,0xb8,0x02,0x22,0x21,0x10,0x00,0x08,
+0x60,0x34,0x01,0xf0,0x00,0x07,0xee,0xee,0xef,0xff,0x30,0x00,0x9b,0x32,0x22,0x22,
+0xe5,0x00,0x09,0xa0,0x7a,0x03,0x21,0x00,0x9a,0x30,0x05,0xf2,0x0f,0x09,0xfc,0xcc,
+0xcc,0xdf,0x40,0x00,0x05,0x55,0x55,0x54,0x30,0x00,0x0c,0xdd,0xdd,0xdd,0xd6,0x00,
+0x00,0x02,0xf5,0x34,0x43,0x33,0x00,0x00,0x00,0x2f,0x20,0xfc,0x00,0x03,0xb4,0x01,
+0x04,0x0f,0x00,0xcc,0xf4,0x22,0x22,0x47,0x70,0x00,0x00,0x0d,0xff,0xff,0xff,0xea,
+0x55,0x02,0xe0,0x06,0xcc,0xcc,0xcc,0xcc,0xcd,0xdd,0xe2,0x25,0x55,0x55,0x7f,0x44,
+0x44,0xe1,0x01,0x23,0x02,0xf0,0x3e,0x00,0x03,0xbe,0x01,0x0a,0x0f,0x00,0x04,0x6b,
+0x02,0x01,0xb1,0x04,0x0c,0x66,0x02,0x1a,0x0f,0x66,0x02,0xd5,0x0f,0x72,0x22,0x22,
+0x32,0x00,0x00,0x00,0xbe,0xff,0xff,0xfe,0xd0,0x72,0x00,0xf4,0x00,0x32,0x22,0x11,
+0x11,0x22,0x22,0x30,0x6e,0xef,0xff,0xff,0xee,0xee,0xed,0x10,0x53,0x00,0x30,0x04,
+0x44,0x7f,0x7f,0x00,0x75,0x03,0xde,0xee,0xdd,0xdd,0xf0,0x00,0xd7,0x01,0xf3,0x01,
+0x22,0x23,0x33,0x36,0xf0,0x00,0x00,0x3f,0xfe,0xee,0xee,0xeb,0x00,0x00,0x04,0xf1,
+0x1a,0x00,0xc3,0x42,0x22,0x33,0x44,0x10,0x00,0x01,0xdf,0xff,0xff,0xfe,0xd6,0xf5,
+0x02,0xf0,0x02,0x60,0x0c,0xdd,0xdd,0xeb,0x00,0x4e,0x00,0xf6,0x44,0x33,0x10,0x03,
+0xe0,0x1f,0x30,0x00,0x5f,0x01,0x02,0xf1,0x01,0x02,0x0d,0x00,0xd3,0x00,0xfe,0xdd,
+0xef,0xf3,0x03,0xe0,0x02,0x44,0x43,0x21,0x00,0x3e,0x32,0x02,0xc2,0x11,0x11,0x23,
+0x46,0x83,0x3e,0x0e,0xff,0xff,0xdc,0xa8,0x23,0x66,0x02,0x11,0x3e,0x47,0x03,0x2e,
+0x03,0xe0,0x0d,0x00,0x12,0x3f,0x8d,0x02,0x11,0xf0,0x9a,0x02,0x11,0x06,0x7c,0x01,
 0x12,0xd3,0x7c,0x01,0x1f,0x32,0x7c,0x01,0x0a,0x22,0x34,0x20,0x7c,0x01,0x1f,0xe8,
-0x96,0x0c,0x0f,0x12,0x30,0x30,0x05,0x12,0xf3,0xa1,0x03,0x07,0x0f,0x00,0x03,0x96,
-0x0c,0x17,0xe4,0x96,0x0c,0x0f,0x7c,0x01,0x20,0x40,0x01,0x44,0x33,0x33,0x81,0x07,
-0x80,0x5c,0xdd,0xfe,0xdd,0xdf,0xdc,0xcb,0x10,0x77,0x0e,0x01,0x49,0x08,0x42,0xc9,
-0x44,0x4f,0x72,0x7c,0x01,0x23,0xde,0xf0,0x3b,0x2b,0x02,0x9d,0x0d,0x1f,0x38,0x9d,
-0x0d,0x0b,0x2e,0xd5,0x00,0x59,0x05,0x0e,0xb3,0x0e,0x0e,0x90,0x1a,0x02,0x0f,0x06,
-0x00,0xc1,0x12,0x07,0xd2,0x1f,0x0b,0x01,0x00,0x30,0x7f,0xff,0xee,0x1a,0x30,0x03,
-0x1d,0x0d,0x1f,0x20,0xd2,0x04,0x1d,0x36,0x33,0x33,0x21,0xf1,0x17,0x11,0x33,0x16,
-0x0d,0x0f,0x59,0x05,0x32,0x04,0x01,0x00,0x13,0xcf,0x77,0x01,0x12,0x62,0x96,0x00,
-0x0b,0x84,0x10,0x12,0xf6,0xee,0x0f,0x10,0x0c,0xf0,0x43,0x0d,0x94,0x0f,0x02,0x2b,
-0x06,0x54,0xc1,0x25,0x55,0x44,0x44,0xf8,0x42,0x01,0xec,0x0a,0x04,0xd0,0x0f,0x0f,
-0x3b,0x01,0x02,0x10,0x0f,0x34,0x01,0x11,0x50,0x0b,0x14,0x01,0x34,0x01,0x03,0x0e,
-0x01,0x03,0x87,0x00,0x13,0x0d,0xea,0x08,0x13,0xd7,0xba,0x0d,0x12,0x81,0x9b,0x0f,
-0x16,0x9e,0x11,0x15,0x00,0x49,0x09,0x01,0xc4,0x19,0x2b,0x20,0x6f,0xcb,0x1a,0x20,
-0x03,0x33,0x9f,0x05,0x10,0x00,0x91,0x48,0x18,0xef,0x9b,0x0f,0x33,0x34,0x44,0x48,
-0xfe,0x01,0x17,0xea,0x4b,0x1a,0xcf,0x53,0x33,0x44,0x45,0x10,0x00,0x01,0xce,0xee,
-0xed,0xdd,0xd5,0x85,0x02,0x0e,0x13,0x50,0x29,0x11,0x0f,0x95,0x01,0x02,0x1e,0x22,
-0x95,0x01,0x0f,0x67,0x06,0x0b,0x1a,0x5e,0x32,0x0e,0x1a,0xf6,0x67,0x06,0xe7,0x92,
-0x09,0x99,0x99,0x90,0x00,0xe4,0x3f,0x88,0x87,0x60,0x00,0xe4,0x3e,0xf9,0x0a,0x0d,
-0x06,0x00,0x1e,0xe5,0x06,0x00,0xa3,0x3f,0xa9,0xab,0xce,0x40,0xe5,0x05,0x77,0x65,
-0x42,0xb2,0x08,0x08,0x06,0x00,0x0e,0xff,0x0a,0x71,0x73,0x2e,0xdd,0xdd,0xd0,0x00,
-0xc7,0x92,0x0a,0x11,0xc7,0x42,0x00,0x03,0x06,0x00,0x1a,0x5e,0x06,0x00,0xc3,0x02,
-0x00,0xc6,0x3f,0xdd,0xef,0xfd,0x00,0xc6,0x02,0x33,0x31,0x47,0x11,0x00,0xf7,0x16,
-0x30,0x3a,0xcc,0xb6,0x2f,0x2e,0x51,0x43,0x6d,0xc0,0x00,0x0f,0x26,0x25,0x00,0x03,
-0x0e,0x13,0xb7,0x25,0x25,0x83,0x09,0xe5,0x22,0x4c,0xe1,0x00,0x00,0x7c,0x24,0x25,
-0x01,0xcd,0x19,0xf8,0x06,0x33,0x20,0x33,0x31,0x0f,0x30,0x00,0x0f,0xed,0xa3,0xfd,
-0xd7,0x0f,0x40,0x00,0x0f,0x30,0x03,0xf0,0x00,0x0e,0x08,0x00,0x1a,0x04,0x08,0x00,
-0x10,0x20,0x08,0x00,0x22,0xff,0xf1,0x08,0x00,0x46,0x63,0x20,0x0f,0x20,0x18,0x00,
-0x00,0xb5,0x19,0xd5,0x0f,0x63,0x24,0xf3,0x34,0x0d,0x40,0x00,0x0a,0xdd,0xa1,0xcd,
-0xdb,0xc5,0x19,0x0f,0xcd,0x19,0x13,0xf5,0x0b,0x03,0x01,0x75,0x76,0x06,0x76,0x03,
-0xe0,0x3e,0xeb,0x93,0xf9,0x91,0x3e,0x03,0xee,0x30,0x2f,0x00,0x03,0xe0,0x3e,0xe3,
-0x02,0xf0,0x00,0x0d,0x00,0xd0,0xf3,0x03,0xf0,0x00,0x3f,0x8a,0xef,0x30,0x3f,0x00,
-0x03,0xf9,0xae,0x0d,0x00,0x20,0x3e,0x03,0x0d,0x00,0x12,0x02,0x1a,0x00,0xe1,0x2e,
-0x03,0xee,0x64,0x3f,0x44,0x32,0xe0,0x3e,0x8c,0xc3,0xbc,0xb6,0x2e,0xb5,0x07,0x21,
-0x02,0xe0,0xb0,0x01,0x02,0x0d,0x00,0x23,0x03,0xf0,0x0d,0x00,0x04,0xf6,0x13,0x50,
-0x12,0x22,0x00,0x22,0x22,0x9c,0x2b,0x40,0xf6,0x6f,0xff,0xf3,0x0e,0x05,0x22,0x07,
-0xc0,0x1d,0x05,0x00,0x62,0x0f,0x0f,0x0f,0x00,0x04,0x40,0x0e,0xff,0xfb,0x5f,0x34,
-0x27,0x20,0x02,0x21,0x3f,0x00,0x00,0x47,0x00,0x27,0xb0,0x00,0xba,0x07,0x02,0xc8,
-0x07,0x0c,0xbb,0x09,0xc1,0x2e,0xff,0xe0,0xdf,0xff,0x50,0x00,0x04,0xf2,0x21,0x1f,
-0x42,0x87,0x2d,0x22,0x02,0xf1,0x14,0x09,0x01,0xa2,0x0f,0x04,0x0f,0x00,0xb7,0xf2,
-0x12,0x1f,0x42,0x21,0x00,0x00,0x2e,0xff,0xe3,0xdf,0xdb,0x24,0x03,0xbb,0x02,0x02,
-0x4e,0x07,0x8e,0xe5,0x15,0x55,0x55,0x5f,0x74,0x44,0x43,0x81,0x11,0x0e,0x0f,0x00,
-0x0b,0x4a,0x1f,0xf0,0x01,0x02,0x90,0xaf,0xfb,0x1d,0xee,0x80,0x4e,0x0d,0x72,0x12,
+0x7c,0x01,0x02,0xa0,0xdd,0xde,0xd0,0x25,0x55,0xf7,0x54,0x4e,0x74,0x32,0x63,0x06,
+0x02,0x30,0x05,0x12,0xf3,0xa1,0x03,0x07,0x0f,0x00,0x11,0x40,0x33,0x06,0x21,0x00,
+0xe4,0x27,0x06,0x2f,0x00,0x02,0x7c,0x01,0x24,0x40,0x01,0x44,0x33,0x33,0x81,0x07,
+0xb1,0x5c,0xdd,0xfe,0xdd,0xdf,0xdc,0xcb,0x10,0x00,0x0a,0x70,0x53,0x00,0x52,0x04,
+0xc9,0x44,0x4f,0x72,0x7c,0x01,0x13,0xde,0x7c,0x01,0x80,0x6f,0x00,0x00,0x00,0x23,
+0x33,0x33,0x38,0xf8,0x00,0x4f,0xee,0xee,0xee,0xdb,0x7c,0x01,0x03,0x2f,0xd5,0x00,
+0x59,0x05,0x05,0x16,0xf2,0x4a,0x05,0x0e,0x0f,0x00,0x11,0x00,0x0f,0x06,0x00,0x90,
+0x00,0x23,0x44,0x33,0x12,0x00,0x0e,0x01,0x00,0x91,0x7f,0xff,0xee,0xee,0xee,0xff,
+0xff,0x21,0x33,0x01,0x00,0x1f,0x20,0xd2,0x04,0x1d,0x12,0x33,0xd2,0x04,0x02,0x86,
+0x01,0x20,0x33,0x22,0x01,0x00,0x0f,0x59,0x05,0x32,0x04,0x01,0x00,0x13,0xcf,0x77,
+0x01,0x12,0x62,0x96,0x00,0x28,0xf4,0x00,0x5a,0x07,0xa0,0x00,0xf6,0x11,0x11,0x12,
+0x10,0x00,0x00,0x0c,0xff,0x10,0x04,0x0b,0x01,0x00,0x12,0x07,0x2b,0x06,0x85,0xc1,
+0x25,0x55,0x44,0x44,0x55,0x55,0x55,0x18,0x00,0x13,0x0c,0x85,0x06,0x1f,0xf3,0x3b,
+0x01,0x02,0x10,0x0f,0x34,0x01,0x20,0x50,0x00,0x44,0x07,0x01,0x34,0x01,0x03,0x0e,
+0x01,0x03,0x87,0x00,0x13,0x0d,0xea,0x08,0x22,0xd7,0x00,0x70,0x07,0xc5,0x81,0x11,
+0x12,0x22,0x00,0x00,0x00,0x9e,0xff,0xff,0xfe,0xe2,0x61,0x00,0x20,0x21,0x11,0x01,
+0x00,0x21,0x20,0x6f,0x06,0x01,0x25,0xfe,0x20,0xd7,0x05,0x10,0x33,0x9f,0x05,0x67,
+0x00,0x03,0xff,0xff,0xff,0xef,0x7a,0x03,0x43,0x23,0x34,0x44,0x48,0xfe,0x01,0x53,
+0xea,0x00,0x00,0x03,0xf1,0x0a,0x01,0xcf,0x53,0x33,0x44,0x45,0x10,0x00,0x01,0xce,
+0xee,0xed,0xdd,0xd5,0x85,0x02,0x0e,0x03,0x0f,0x00,0x1f,0xef,0x95,0x01,0x02,0x1e,
+0x22,0x95,0x01,0x0f,0x67,0x06,0x0b,0x16,0x5e,0x67,0x06,0x5a,0x05,0xf8,0x32,0x38,
+0xf6,0x67,0x06,0xd1,0x92,0x09,0x99,0x99,0x90,0x00,0xe4,0x3f,0x88,0x87,0x60,0x00,
+0xe4,0xe0,0x03,0x2f,0xe4,0x4e,0x06,0x00,0x03,0x1e,0xe5,0x06,0x00,0xa3,0x3f,0xa9,
+0xab,0xce,0x40,0xe5,0x05,0x77,0x65,0x42,0xb2,0x08,0x08,0x06,0x00,0x11,0xe4,0x06,
+0x00,0x11,0xe3,0x06,0x00,0x02,0xa4,0x01,0x71,0x73,0x2e,0xdd,0xdd,0xd0,0x00,0xc7,
+0x92,0x0a,0x11,0xc7,0x42,0x00,0x03,0x06,0x00,0x1a,0x5e,0x06,0x00,0xf1,0x00,0x02,
+0x00,0xc6,0x3f,0xdd,0xef,0xfd,0x00,0xc6,0x02,0x33,0x31,0x00,0x00,0xc6,0x3c,0x00,
+0xd0,0x52,0x00,0x00,0x3a,0xcc,0xb6,0x00,0x00,0x06,0xf8,0x43,0x6d,0xc0,0x23,0x01,
+0x90,0x01,0xe5,0x00,0x2f,0x10,0x00,0x00,0xb7,0x00,0xa7,0x04,0xd2,0xe6,0x00,0x09,
+0xe5,0x22,0x4c,0xe1,0x00,0x00,0x7c,0xee,0xc8,0x10,0x55,0x06,0x00,0xc0,0x02,0xf8,
+0x05,0x20,0x33,0x31,0x0f,0x30,0x00,0x0f,0xed,0xa3,0xfd,0xd7,0x0f,0x40,0x00,0x0f,
+0x30,0x03,0xf0,0x00,0x0e,0x08,0x00,0x1a,0x04,0x08,0x00,0x10,0x20,0x08,0x00,0x22,
+0xff,0xf1,0x08,0x00,0x47,0x63,0x20,0x0f,0x20,0x18,0x00,0xf3,0x02,0x0d,0x40,0x00,
+0x0f,0x63,0x24,0xf3,0x34,0x0d,0x40,0x00,0x0a,0xdd,0xa1,0xcd,0xdb,0x0d,0xb3,0x02,
+0x05,0x08,0x00,0x1f,0x50,0x08,0x00,0x03,0x22,0x04,0x10,0x9e,0x01,0xf5,0x0a,0x01,
+0x75,0x76,0x06,0x76,0x03,0xe0,0x3e,0xeb,0x93,0xf9,0x91,0x3e,0x03,0xee,0x30,0x2f,
+0x00,0x03,0xe0,0x3e,0xe3,0x02,0xf0,0x00,0x0d,0x00,0xd0,0xf3,0x03,0xf0,0x00,0x3f,
+0x8a,0xef,0x30,0x3f,0x00,0x03,0xf9,0xae,0x0d,0x00,0x20,0x3e,0x03,0x0d,0x00,0x12,
+0x02,0x1a,0x00,0xe1,0x2e,0x03,0xee,0x64,0x3f,0x44,0x32,0xe0,0x3e,0x8c,0xc3,0xbc,
+0xb6,0x2e,0xb5,0x07,0x21,0x02,0xe0,0xb0,0x01,0x02,0x0d,0x00,0x23,0x03,0xf0,0x0d,
+0x00,0x12,0xf0,0x77,0x00,0xe0,0x00,0x12,0x22,0x00,0x22,0x22,0x00,0x00,0x0f,0xff,
+0xf6,0x6f,0xff,0xf3,0x0e,0x05,0x22,0x07,0xc0,0x1d,0x05,0x3f,0x7c,0x00,0x00,0x0f,
+0x00,0x05,0xa0,0x0e,0xff,0xfb,0x5f,0xff,0xf7,0x00,0x00,0x02,0x21,0x3f,0x00,0x00,
+0x47,0x00,0x27,0xb0,0x00,0xba,0x07,0x02,0xc8,0x07,0x0c,0xbb,0x09,0xd0,0x2e,0xff,
+0xe0,0xdf,0xff,0x50,0x00,0x04,0xf2,0x21,0x1f,0x42,0x20,0xfb,0x07,0x22,0x02,0xf1,
+0x14,0x09,0x00,0x9f,0x01,0x05,0x0f,0x00,0xdb,0xf2,0x12,0x1f,0x42,0x21,0x00,0x00,
+0x2e,0xff,0xe3,0xdf,0xff,0x90,0xdb,0x03,0x12,0x03,0x4e,0x07,0x71,0xe5,0x15,0x55,
+0x55,0x5f,0x74,0x44,0xc8,0x02,0x03,0xce,0x03,0x01,0x0c,0x08,0x0f,0x0f,0x00,0x06,
+0x16,0x02,0x16,0x03,0xf0,0x00,0x90,0xaf,0xfb,0x1d,0xee,0x80,0x4e,0x0d,0x72,0x12,
 0xf3,0x21,0x03,0xe0,0xd5,0x78,0x07,0x64,0x3e,0x0d,0x50,0x02,0xf0,0x00,0x0d,0x00,
 0xc4,0x0c,0xec,0xc2,0xfc,0xca,0x03,0xe0,0x25,0x54,0x04,0x55,0x20,0xc7,0x06,0x20,
 0x22,0x22,0xc7,0x06,0x5f,0x2e,0xee,0xff,0xdc,0xa7,0xc7,0x06,0x0a,0x21,0x04,0xe0,
-0x0a,0x00,0x15,0x4e,0xc7,0x06,0x14,0x05,0x99,0x30,0x40,0x04,0x44,0x45,0x50,0x61,
-0x03,0x43,0x0d,0xdd,0xdd,0xf2,0xc5,0x1a,0x06,0x08,0x00,0x16,0x4f,0x08,0x00,0xc0,
-0x03,0x44,0x45,0xf2,0x00,0x4f,0x11,0x10,0x0f,0xee,0xee,0xd1,0x99,0x30,0x22,0x0f,
-0x30,0x1f,0x05,0x1e,0x0f,0x08,0x00,0xb0,0x02,0x10,0x3f,0x00,0x00,0x0e,0xed,0xde,
-0xff,0x70,0x3f,0xfc,0x03,0x2f,0x32,0x10,0x99,0x30,0x0e,0x24,0x05,0x00,0xa5,0x23,
-0x00,0x5e,0x07,0x13,0xe2,0xdb,0x2d,0x33,0xf3,0x00,0x5f,0x81,0x03,0x16,0x4e,0x08,
-0x00,0x10,0x0c,0x4a,0x34,0x10,0x4e,0x15,0x13,0x62,0x32,0x20,0x00,0x4f,0xff,0xf0,
-0x17,0x0f,0x72,0x22,0x10,0x0e,0x50,0x01,0x25,0x20,0x20,0x00,0x30,0xec,0x40,0x4f,
-0x80,0x13,0x06,0xb3,0x1b,0x02,0x99,0x30,0x12,0x10,0x99,0x30,0x03,0xf3,0x0b,0x0d,
-0x08,0x00,0x01,0x68,0x05,0x1a,0x10,0x2c,0x21,0x11,0x27,0xc1,0x07,0x30,0xf2,0x00,
-0x5e,0x17,0x00,0x43,0x22,0xf4,0x00,0x5e,0x17,0x04,0x10,0x4e,0x9b,0x03,0x21,0x44,
-0xf4,0x88,0x00,0x30,0xed,0xdd,0xd2,0x88,0x00,0x13,0x0f,0x88,0x00,0x01,0x08,0x00,
-0x00,0x18,0x00,0xd3,0x84,0x45,0x79,0x50,0x4e,0x00,0x00,0x08,0xcc,0xca,0x74,0x10,
-0x4e,0x50,0x00,0x11,0x18,0x94,0x06,0x02,0x60,0x00,0x13,0x1f,0x11,0x16,0x13,0x1f,
-0xd3,0x1c,0x2a,0x1f,0x10,0x08,0x00,0x00,0x59,0x27,0x10,0xee,0x78,0x02,0x46,0x55,
-0x55,0x54,0x42,0xb9,0x31,0x01,0x90,0x00,0x13,0x4e,0x90,0x00,0x13,0x4e,0x90,0x00,
-0x13,0x4f,0x90,0x00,0x74,0x4f,0x22,0x10,0x0e,0xed,0xdd,0xc2,0x90,0x00,0x00,0x18,
-0x00,0x0f,0x90,0x00,0x0a,0x02,0x8b,0x2f,0x30,0xbd,0xc9,0x30,0x98,0x00,0x40,0xea,
-0x53,0x49,0xf5,0xb2,0x0a,0x12,0xa0,0xf6,0x2d,0x00,0x59,0x07,0x13,0x2f,0x93,0x2f,
-0x20,0x6f,0x00,0x2e,0x42,0x31,0x42,0x38,0xf7,0x05,0x47,0x34,0xcd,0xca,0x40,0xcb,
-0x26,0xd0,0x16,0x06,0x77,0x77,0x10,0x1f,0x00,0x5d,0x1a,0xbb,0xaf,0x50,0x1f,0x0f,
-0x0c,0x30,0x0d,0x50,0x1f,0x09,0x20,0x17,0x0e,0x07,0x00,0xe0,0x03,0x55,0x6e,0x50,
-0x1f,0x44,0x7d,0x0e,0xed,0xdc,0x30,0x1f,0xdd,0xdd,0x57,0x00,0x3c,0x1f,0x00,0x4d,
-0x07,0x00,0x90,0x01,0x30,0x1f,0x00,0x4d,0x0c,0xfe,0xff,0xd4,0x38,0x00,0x31,0x22,
-0x10,0x00,0x3f,0x00,0x1e,0x00,0x07,0x00,0x07,0x44,0x27,0xf0,0x07,0x20,0x03,0x22,
-0xaa,0xab,0xa0,0x0e,0x30,0xa8,0x16,0x77,0x7f,0x10,0xf4,0x0a,0x80,0x00,0x01,0xf1,
-0x0e,0x40,0xa9,0x93,0x1a,0xe1,0xe5,0x1a,0x94,0xff,0xff,0xf1,0x0e,0xff,0xf8,0x5e,
-0x11,0x00,0x00,0xe5,0x36,0x0f,0xf1,0x01,0x0e,0x40,0xa8,0x5e,0x44,0x57,0x90,0xe4,
-0x0a,0x81,0xbc,0xcb,0xa7,0x0d,0x40,0xa8,0x8d,0x0e,0x05,0x36,0x0f,0x1f,0x0a,0x36,
-0x0f,0x0a,0x27,0x0e,0x40,0xa4,0x2b,0x11,0x17,0xf4,0x06,0x33,0x20,0x04,0xe0,0x82,
-0x01,0x11,0x11,0x21,0x00,0x50,0x04,0xff,0xfd,0x01,0x22,0x0f,0x00,0x85,0x21,0x00,
-0xef,0xff,0xfe,0x30,0x04,0xe0,0x78,0x01,0x20,0xf4,0x00,0x3e,0x3a,0xe3,0xeb,0x0e,
-0x84,0x45,0x7a,0x40,0x3f,0x44,0x20,0x8c,0xcc,0x98,0x61,0x03,0x6c,0x17,0x10,0x19,
-0xe6,0x07,0x37,0x8c,0xdc,0x82,0x7d,0x01,0x12,0xba,0xe6,0x06,0x04,0x7c,0x01,0x11,
-0xc8,0x0f,0x34,0x05,0x7b,0x01,0x44,0x03,0xac,0xdc,0xa4,0xd9,0x10,0x10,0x18,0xee,
-0x11,0x50,0x2f,0x19,0x99,0x9b,0xd0,0x2a,0x00,0x1b,0x05,0x06,0x00,0xd1,0x06,0x66,
-0x6a,0xd2,0xcc,0xdf,0x5f,0xdd,0xdc,0x90,0x55,0x7f,0x5d,0x97,0x0a,0x0b,0x06,0x00,
-0xc4,0x02,0x00,0x2f,0x4f,0xdd,0xef,0xff,0x50,0x2f,0x02,0x33,0x32,0xe4,0x0b,0x08,
-0x06,0x00,0x27,0x1e,0x00,0x2f,0x24,0x10,0x06,0xa7,0x26,0x61,0x02,0xf1,0x02,0x33,
-0x2d,0x50,0x13,0x05,0x10,0xd5,0x0d,0x00,0xd1,0x22,0x2d,0x51,0x55,0x6f,0x14,0xff,
-0xff,0xe4,0x4c,0xdd,0xf1,0x5e,0x39,0x00,0x21,0x15,0xe0,0x37,0x0c,0xa0,0x5e,0x44,
-0x56,0x8a,0x00,0x2f,0x01,0xbc,0xcb,0xa9,0xbe,0x04,0x03,0x7b,0x29,0xb4,0xcd,0xdd,
-0xdd,0xde,0xa0,0x00,0x1f,0x54,0x44,0x44,0x7f,0x2c,0x2a,0x24,0x1f,0x10,0x5c,0x05,
-0x00,0x0d,0x00,0x11,0xdb,0x51,0x1e,0x20,0x24,0x55,0xa8,0x1a,0x01,0xe3,0x01,0x06,
-0x75,0x00,0x18,0x60,0x75,0x00,0x30,0x52,0x66,0x7f,0x75,0x00,0x26,0x4b,0xcc,0x75,
-0x00,0xf5,0x01,0x01,0x30,0x02,0xf0,0x4f,0xdd,0xef,0xfc,0x00,0x2f,0x00,0x23,0x32,
-0x10,0x00,0x01,0xf7,0x0a,0x00,0xfc,0x35,0x10,0xb0,0xed,0x11,0x00,0x40,0x0e,0x00,
-0x43,0x27,0x92,0xe0,0x00,0x1f,0x44,0x44,0x44,0x6e,0x00,0x01,0xc7,0x1e,0x52,0x1f,
-0x11,0x11,0x11,0x4e,0xc4,0x08,0x12,0xa0,0xbd,0x1d,0xf0,0x00,0x29,0x08,0x99,0x9a,
-0x10,0x0f,0x30,0x5d,0x07,0x98,0x8f,0x40,0x0f,0x30,0x5d,0xdb,0x01,0x03,0x07,0x00,
-0x15,0x0e,0x07,0x00,0xe1,0x05,0x88,0x8f,0x57,0x8f,0x30,0x5d,0x0e,0xca,0xa9,0x39,
-0x9f,0x30,0x5d,0x1c,0x2e,0x0b,0x07,0x00,0xe1,0x4d,0x0e,0x60,0x13,0x51,0x0e,0x30,
-0x4d,0x0b,0xff,0xfd,0xb3,0x0e,0x30,0xb4,0x02,0x03,0x07,0x00,0x28,0x0f,0x20,0x07,
-0x00,0x37,0x0d,0x10,0x4d,0x07,0x06,0xf0,0x01,0x02,0x03,0x20,0xaa,0xab,0x90,0x05,
-0xd0,0xa8,0x06,0x77,0x9e,0x00,0x5e,0x0a,0x80,0xf7,0x1c,0xf1,0x05,0xe0,0xa9,0x00,
-0x00,0x4e,0x15,0x8e,0x0a,0x94,0xff,0xff,0xe4,0xcd,0xe0,0xa8,0x5e,0x11,0x10,0x00,
-0x4e,0xd0,0x02,0xf1,0x01,0x04,0xe0,0xa8,0x5e,0x44,0x46,0x92,0x4e,0x0a,0x81,0xbc,
-0xcc,0xa7,0x14,0xe0,0xa8,0x33,0x01,0xcf,0x05,0x30,0x00,0x13,0x33,0x34,0x44,0x30,
-0x00,0x09,0xee,0xee,0xd0,0x02,0x14,0xf0,0x00,0x02,0x00,0x30,0x04,0x44,0x42,0x00,
-0x3f,0x03,0xe0,0x5d,0xdd,0xfb,0x00,0x3f,0x1e,0x06,0x13,0xab,0x07,0x00,0xe0,0x01,
-0x5f,0x03,0xf0,0x3e,0xef,0xfb,0x5f,0xff,0x03,0xf0,0x5e,0x33,0x20,0x15,0x00,0x00,
-0x72,0x01,0x02,0x07,0x00,0xf2,0x01,0x10,0x3f,0x03,0xe0,0x4f,0xdd,0xef,0x90,0x3e,
-0x03,0xe0,0x02,0x33,0x10,0x00,0x4e,0xd3,0x02,0x21,0x4e,0x04,0x33,0x22,0x32,0x29,
-0x04,0xd0,0x71,0x00,0x14,0x10,0x78,0x00,0x03,0x07,0x00,0x30,0x0d,0xfd,0xdd,0x46,
-0x15,0x53,0x01,0x43,0x33,0x33,0x22,0x2d,0x16,0x11,0x08,0xc7,0x02,0x15,0x09,0xc7,
+0x0a,0x00,0x15,0x4e,0xc7,0x06,0x11,0x05,0x41,0x00,0x10,0x15,0x7f,0x07,0x20,0x45,
+0x50,0x61,0x03,0x61,0x0d,0xdd,0xdd,0xf2,0x00,0x4e,0x16,0x00,0x06,0x08,0x00,0x16,
+0x4f,0x08,0x00,0xf2,0x03,0x03,0x44,0x45,0xf2,0x00,0x4f,0x11,0x10,0x0f,0xee,0xee,
+0xd1,0x00,0x3f,0xff,0xf2,0x0f,0x30,0x1f,0x05,0x1e,0x0f,0x08,0x00,0xb0,0x02,0x10,
+0x3f,0x00,0x00,0x0e,0xed,0xde,0xff,0x70,0x3f,0xfc,0x03,0x24,0x32,0x10,0x47,0x05,
+0x0f,0x08,0x00,0x06,0x13,0x05,0x08,0x00,0x20,0x28,0x00,0x5e,0x07,0x30,0xe2,0x00,
+0x5e,0x70,0x00,0x43,0x43,0xf3,0x00,0x5f,0x81,0x03,0x15,0x4e,0x08,0x00,0x00,0x5a,
+0x05,0x10,0xf3,0x08,0x00,0x81,0x0e,0x73,0x32,0x20,0x00,0x4f,0xff,0xf0,0x22,0x07,
+0x82,0x4e,0x22,0x10,0x0e,0x50,0x01,0x25,0x20,0x20,0x00,0x20,0xec,0x40,0xb8,0x00,
+0x15,0x11,0x20,0x0a,0x11,0x00,0x40,0x00,0x56,0x0e,0x10,0x00,0x00,0x3c,0xf3,0x0b,
+0x0d,0x08,0x00,0x01,0x68,0x05,0x12,0x10,0xad,0x04,0x13,0x32,0x38,0x00,0x11,0x27,
+0xc1,0x07,0x30,0xf2,0x00,0x5e,0x17,0x00,0x43,0x22,0xf4,0x00,0x5e,0x17,0x04,0x10,
+0x4e,0x9b,0x03,0x21,0x44,0xf4,0x88,0x00,0x30,0xed,0xdd,0xd2,0x88,0x00,0x13,0x0f,
+0x88,0x00,0x01,0x08,0x00,0x00,0x18,0x00,0xd3,0x84,0x45,0x79,0x50,0x4e,0x00,0x00,
+0x08,0xcc,0xca,0x74,0x10,0x4e,0x50,0x00,0x11,0x18,0x94,0x06,0x02,0x60,0x00,0x10,
+0x1f,0x8c,0x05,0x03,0xef,0x05,0x13,0x3e,0x88,0x00,0x09,0x08,0x00,0xe0,0xdc,0xcc,
+0xcc,0xee,0x00,0x00,0x00,0x04,0x55,0x55,0x54,0x42,0x00,0x00,0x10,0x00,0x01,0x00,
+0xf1,0x02,0x17,0x00,0x00,0x0d,0xff,0xff,0xf2,0x00,0x4e,0x00,0x00,0x01,0x33,0x22,
+0xf4,0x00,0x4e,0x16,0x00,0xf0,0x0a,0xe4,0x00,0x4f,0x00,0x00,0x02,0x33,0x44,0xf4,
+0x00,0x4f,0x22,0x10,0x0e,0xed,0xdd,0xc2,0x00,0x4f,0xff,0xf0,0x0f,0x40,0x00,0x00,
+0x18,0x00,0x00,0x08,0x00,0x00,0x28,0x00,0xd2,0x0e,0x84,0x45,0x79,0x50,0x4e,0x00,
+0x00,0x08,0xcc,0xca,0x74,0x10,0x38,0x00,0x01,0x50,0x00,0xf0,0x1f,0x00,0x00,0x18,
+0xbd,0xc9,0x30,0x00,0x00,0x00,0x02,0xea,0x53,0x49,0xf5,0x00,0x00,0x00,0x0b,0xa0,
+0x00,0x00,0x6e,0x00,0x00,0x00,0x0e,0x50,0x00,0x00,0x2f,0x00,0x00,0x00,0x0c,0x80,
+0x00,0x00,0x6f,0x00,0x00,0x00,0x04,0xf9,0x42,0x38,0xf7,0x30,0x00,0x42,0x3a,0xcd,
+0xca,0x40,0x3f,0x00,0xf0,0x09,0x04,0x00,0x16,0x06,0x77,0x77,0x10,0x1f,0x00,0x5d,
+0x1a,0xbb,0xaf,0x50,0x1f,0x00,0x5d,0x00,0x00,0x0d,0x50,0x1f,0x00,0x4d,0x3d,0x00,
+0x06,0x07,0x00,0xe0,0x03,0x55,0x6e,0x50,0x1f,0x44,0x7d,0x0e,0xed,0xdc,0x30,0x1f,
+0xdd,0xdd,0x57,0x00,0x3c,0x1f,0x00,0x4d,0x07,0x00,0x90,0x01,0x30,0x1f,0x00,0x4d,
+0x0c,0xfe,0xff,0xd4,0x38,0x00,0x31,0x22,0x10,0x00,0x3f,0x00,0x1e,0x00,0x07,0x00,
+0x03,0x79,0x00,0x00,0x05,0x00,0xf0,0x2e,0x20,0x03,0x22,0xaa,0xab,0xa0,0x0e,0x30,
+0xa8,0x16,0x77,0x7f,0x10,0xf4,0x0a,0x80,0x00,0x01,0xf1,0x0e,0x40,0xa9,0x00,0x00,
+0x2f,0x10,0xe5,0x1a,0x94,0xff,0xff,0xf1,0x0e,0xff,0xf8,0x5e,0x11,0x00,0x00,0xe5,
+0x0a,0x85,0xe0,0x00,0x00,0x0e,0x40,0xa8,0x5e,0x44,0x57,0x90,0xe4,0x0a,0x81,0xbc,
+0xcb,0xa7,0x0d,0x40,0xa8,0x41,0x00,0xf2,0x00,0x40,0x05,0x30,0x00,0x23,0x33,0x44,
+0x44,0x30,0x00,0x0a,0xee,0xed,0xdd,0xdf,0xd5,0x00,0x33,0xe5,0x00,0x00,0xfd,0x00,
+0x06,0x0d,0x00,0x02,0x1a,0x00,0x14,0xa2,0x33,0x01,0x63,0xdf,0xff,0xff,0x20,0x04,
+0xe0,0x82,0x01,0x11,0x11,0x21,0x00,0x50,0x04,0xff,0xfd,0x01,0x22,0x0f,0x00,0x85,
+0x21,0x00,0xef,0xff,0xfe,0x30,0x04,0xe0,0x78,0x01,0x10,0xf4,0xaf,0x00,0xf2,0x01,
+0xfe,0xeb,0x0e,0x84,0x45,0x7a,0x40,0x3f,0x44,0x20,0x8c,0xcc,0x98,0x61,0x03,0xe0,
+0xc6,0x00,0x87,0x19,0x00,0x00,0x00,0x01,0x8c,0xdc,0x82,0x7d,0x01,0x56,0xba,0x00,
+0x00,0x07,0xd0,0x7c,0x01,0x56,0xc8,0x00,0x00,0x06,0xe0,0x7b,0x01,0x43,0x03,0xac,
+0xdc,0xa4,0xba,0x01,0xb0,0x09,0x18,0x99,0x99,0x70,0x00,0x2f,0x19,0x99,0x9b,0xd0,
+0x2a,0x00,0x1b,0x05,0x06,0x00,0xd0,0x06,0x66,0x6a,0xd2,0xcc,0xdf,0x5f,0xdd,0xdc,
+0x90,0x55,0x7f,0x5d,0x30,0x00,0x1b,0x2f,0x06,0x00,0xc2,0x02,0x00,0x2f,0x4f,0xdd,
+0xef,0xff,0x50,0x2f,0x02,0x33,0x32,0x6c,0x00,0x0a,0x06,0x00,0x26,0x1e,0x00,0x01,
+0x00,0xf0,0x03,0x05,0x06,0xff,0xff,0xf4,0x00,0x02,0xf1,0x02,0x33,0x2d,0x50,0x00,
+0x2f,0x10,0x00,0x00,0xd5,0x0d,0x00,0xd1,0x22,0x2d,0x51,0x55,0x6f,0x14,0xff,0xff,
+0xe4,0x4c,0xdd,0xf1,0x5e,0x39,0x00,0x20,0x15,0xe0,0xca,0x00,0xe1,0xf0,0x5e,0x44,
+0x56,0x8a,0x00,0x2f,0x01,0xbc,0xcb,0xa9,0x50,0x02,0xf0,0x41,0x00,0xf0,0x09,0x07,
+0x00,0x00,0xcd,0xdd,0xdd,0xde,0xa0,0x00,0x1f,0x54,0x44,0x44,0x7f,0x00,0x01,0xf1,
+0x00,0x00,0x04,0xe0,0x00,0x1f,0x10,0x21,0x01,0x13,0x02,0x0d,0x00,0xb2,0xdb,0xbb,
+0xcc,0xdd,0x00,0x00,0x24,0x55,0x54,0x43,0x10,0xe3,0x01,0x06,0x75,0x00,0x18,0x60,
+0x75,0x00,0x30,0x52,0x66,0x7f,0x75,0x00,0x26,0x4b,0xcc,0x75,0x00,0xf4,0x02,0x01,
+0x30,0x02,0xf0,0x4f,0xdd,0xef,0xfc,0x00,0x2f,0x00,0x23,0x32,0x10,0x00,0x01,0xd0,
+0xb9,0x00,0xf1,0x16,0xd0,0x00,0x00,0x01,0xb0,0x00,0x1f,0x00,0x00,0x00,0x3e,0x00,
+0x02,0xfe,0xee,0xee,0xee,0xe0,0x00,0x1f,0x44,0x44,0x44,0x6e,0x00,0x01,0xf0,0x00,
+0x00,0x03,0xe0,0x00,0x1f,0x11,0x11,0x11,0x4e,0xd0,0x01,0x20,0xff,0xa0,0x30,0x00,
+0xf0,0x02,0x06,0x00,0x29,0x08,0x99,0x9a,0x10,0x0f,0x30,0x5d,0x07,0x98,0x8f,0x40,
+0x0f,0x30,0x5d,0xdb,0x01,0x03,0x07,0x00,0x15,0x0e,0x07,0x00,0xe0,0x05,0x88,0x8f,
+0x57,0x8f,0x30,0x5d,0x0e,0xca,0xa9,0x39,0x9f,0x30,0x5d,0xab,0x01,0x1b,0x0e,0x07,
+0x00,0xe1,0x4d,0x0e,0x60,0x13,0x51,0x0e,0x30,0x4d,0x0b,0xff,0xfd,0xb3,0x0e,0x30,
+0xb4,0x02,0x03,0x07,0x00,0x28,0x0f,0x20,0x07,0x00,0x23,0x0d,0x10,0xd0,0x02,0x11,
+0x02,0x05,0x00,0xf1,0x18,0x03,0x20,0xaa,0xab,0x90,0x05,0xd0,0xa8,0x06,0x77,0x9e,
+0x00,0x5e,0x0a,0x80,0x00,0x03,0xe0,0x04,0xe0,0xa9,0x00,0x00,0x4e,0x15,0x8e,0x0a,
+0x94,0xff,0xff,0xe4,0xcd,0xe0,0xa8,0x5e,0x11,0x10,0x00,0x4e,0xd0,0x02,0xf1,0x01,
+0x04,0xe0,0xa8,0x5e,0x44,0x46,0x92,0x4e,0x0a,0x81,0xbc,0xcc,0xa7,0x14,0xe0,0xa8,
+0x33,0x01,0xcf,0x05,0x30,0x00,0x13,0x33,0x34,0x44,0x30,0x00,0x09,0xee,0xee,0xd0,
+0x02,0x14,0xf3,0x05,0x02,0x00,0x30,0x04,0x44,0x42,0x00,0x3f,0x03,0xe0,0x5d,0xdd,
+0xfb,0x00,0x3f,0x03,0xf0,0x00,0x00,0xab,0x07,0x00,0xe0,0x01,0x5f,0x03,0xf0,0x3e,
+0xef,0xfb,0x5f,0xff,0x03,0xf0,0x5e,0x33,0x20,0x15,0x00,0x00,0x72,0x01,0x02,0x07,
+0x00,0xf2,0x01,0x10,0x3f,0x03,0xe0,0x4f,0xdd,0xef,0x90,0x3e,0x03,0xe0,0x02,0x33,
+0x10,0x00,0x4e,0xd3,0x02,0xa2,0x4e,0x04,0xe0,0x00,0x0d,0x40,0x00,0x29,0x04,0xd0,
+0x71,0x00,0x14,0x10,0x78,0x00,0x03,0x07,0x00,0xd2,0x0d,0xfd,0xdd,0xee,0xff,0xe0,
+0x00,0x01,0x43,0x33,0x33,0x22,0x10,0xc7,0x02,0x11,0x08,0xc7,0x02,0x15,0x09,0xc7,
 0x02,0x85,0x12,0x4f,0x00,0x00,0x05,0xd2,0xff,0xff,0xc7,0x02,0x30,0xd0,0x00,0x2f,
-0xc7,0x02,0x02,0xbb,0x02,0x31,0x11,0x4f,0x5d,0xbf,0x24,0x10,0x5d,0x5d,0x00,0x0f,
-0xc7,0x02,0x1d,0xc1,0x06,0x05,0xcc,0xcc,0xd3,0x00,0x02,0xf0,0x14,0x54,0x4e,0x50,
-0x1f,0x00,0x31,0xd5,0x6f,0xff,0x7e,0x31,0x60,0x11,0x3f,0x04,0xff,0xff,0xf5,0xba,
-0x02,0x50,0x21,0x10,0x03,0x88,0x9f,0x0b,0x16,0xe3,0x39,0x9a,0xf0,0x5e,0x22,0x24,
-0x66,0x00,0x2f,0x02,0xef,0xfe,0xdb,0x60,0xc7,0x02,0x80,0x1a,0x00,0x00,0x33,0x34,
-0x44,0x44,0x20,0x84,0x26,0x22,0xed,0xee,0x1b,0x03,0x08,0x88,0x10,0x27,0x04,0xf0,
-0x0a,0x22,0x22,0x02,0xa0,0x21,0x00,0x01,0x75,0x00,0x80,0x03,0xf1,0x16,0x66,0x6e,
-0x61,0x33,0x6f,0xc7,0x02,0xf0,0x01,0x6d,0xde,0xf1,0x04,0x44,0x5e,0x50,0x00,0x2f,
-0x14,0xfc,0xcc,0xc3,0x14,0x35,0xf0,0x85,0x37,0x90,0xdd,0xef,0x05,0xe1,0x11,0x24,
-0x60,0x02,0xf0,0x79,0x1f,0x02,0x16,0x07,0x00,0xed,0x52,0x12,0x00,0x93,0x1d,0x01,
-0x0b,0x21,0x00,0xa1,0x1d,0x20,0x10,0x4f,0xac,0x0c,0x51,0x23,0x36,0xe0,0x00,0x2f,
-0x98,0x34,0x03,0x98,0x00,0x20,0x2f,0x32,0xc3,0x36,0x00,0xc7,0x02,0x20,0xee,0xe4,
-0x93,0x24,0x10,0x45,0x52,0x04,0x00,0xe3,0x28,0x1d,0x70,0xeb,0x26,0x10,0x1e,0x58,
-0x4c,0x00,0x34,0x1b,0x02,0xda,0x12,0x23,0x2f,0x10,0xbc,0x0e,0x33,0x11,0x11,0x22,
-0xad,0x0e,0x13,0xed,0x46,0x21,0x22,0x00,0x00,0xb2,0x31,0x07,0x1e,0x12,0x53,0x23,
-0x6e,0x22,0x22,0x22,0x1e,0x12,0x11,0xf1,0x28,0x07,0x10,0x43,0x9f,0x1e,0x49,0xee,
-0xdd,0xde,0xe0,0xd9,0x1b,0x22,0x36,0xe0,0xf9,0x13,0x17,0xeb,0x3a,0x1d,0x41,0x73,
-0x33,0x33,0x34,0x2d,0x00,0x33,0xfe,0xdd,0xc3,0x9f,0x01,0x00,0x41,0x05,0x25,0x24,
-0xf2,0x63,0x27,0x04,0x7d,0x37,0x01,0xf2,0x06,0x9f,0x55,0x66,0x00,0x00,0x03,0xcd,
-0xdd,0xdc,0xcc,0x46,0x09,0x0b,0x01,0xef,0x18,0x06,0x68,0x1d,0x04,0x18,0x0d,0x03,
-0xae,0x0d,0x12,0x7b,0xdb,0x0d,0x22,0x28,0xb0,0xda,0x00,0x17,0xe9,0xd2,0x1a,0x10,
-0x72,0x72,0x12,0x02,0x27,0x0d,0x1c,0xd1,0x08,0x14,0x14,0x7f,0xeb,0x26,0x00,0xba,
-0x1d,0x5a,0x22,0x10,0x00,0x0a,0x00,0xe1,0x0f,0x03,0x0f,0x0b,0x13,0xf1,0x0f,0x00,
-0x00,0x37,0x08,0x11,0x40,0xf8,0x00,0x21,0x33,0x20,0x3e,0x08,0x20,0x34,0x56,0xbe,
-0x0c,0x06,0x16,0x01,0x12,0x4e,0xbb,0x1b,0x20,0xff,0xe0,0x70,0x19,0x02,0x6f,0x36,
-0x52,0xe7,0x11,0x11,0x12,0x30,0x9e,0x16,0x24,0xee,0x30,0x78,0x00,0x91,0x15,0x44,
-0x44,0x5f,0x43,0x44,0x55,0x05,0xbc,0x11,0x23,0x15,0xb1,0xbc,0x0f,0x11,0xef,0x6f,
-0x01,0x00,0x38,0x08,0x30,0x22,0x2f,0x20,0x4c,0x28,0x20,0x12,0x22,0x1a,0x56,0x00,
-0x3f,0x08,0x43,0x10,0x00,0x03,0xf2,0x4a,0x09,0x52,0x42,0x22,0x33,0x34,0x20,0x9d,
-0x0f,0x12,0xe8,0x87,0x00,0x1e,0x43,0x87,0x00,0x03,0x9d,0x01,0x1b,0x0e,0x9d,0x01,
-0x20,0x84,0x44,0xdb,0x0d,0x63,0x00,0x8c,0xdd,0xfd,0xcc,0xb3,0xe3,0x00,0x00,0xa3,
-0x0f,0x62,0x46,0xf5,0x44,0x44,0x50,0x7e,0x25,0x0b,0x07,0xf7,0x27,0x03,0x44,0x1c,
-0x22,0x06,0xf3,0x17,0x01,0x02,0x68,0x0e,0x41,0x03,0xea,0x09,0xf4,0x3d,0x36,0x01,
-0x0e,0x3b,0x53,0x09,0xc3,0x00,0x00,0x02,0x3d,0x1e,0x04,0xd2,0x01,0x10,0x51,0x6f,
-0x53,0x4f,0xcc,0xcc,0xbf,0x60,0x95,0x02,0x02,0x12,0xf6,0x95,0x02,0x16,0x22,0x80,
-0x12,0x00,0x95,0x02,0x13,0x12,0x95,0x02,0x08,0x4b,0x0f,0x32,0x58,0x00,0x0c,0xb0,
-0x2d,0x20,0x01,0xf1,0x95,0x02,0x46,0x9c,0x33,0x3f,0x32,0x95,0x02,0x00,0x08,0x02,
-0x13,0x10,0xe2,0x28,0x12,0x30,0x05,0x0a,0x16,0xe3,0x51,0x2e,0x50,0x1c,0xdd,0xdd,
-0xdd,0xf3,0xba,0x11,0x47,0x44,0x44,0x33,0x00,0x5c,0x24,0x30,0x33,0x33,0x47,0xd5,
-0x32,0x4a,0xde,0xdd,0xdc,0xc8,0xd7,0x0b,0x11,0x11,0x94,0x52,0x00,0xbc,0x01,0x4f,
-0x01,0x11,0x11,0x4f,0xf9,0x23,0x0a,0x03,0x53,0x09,0x01,0x7d,0x24,0x01,0xe4,0x09,
-0x10,0x42,0x85,0x11,0x37,0xee,0xdd,0xde,0x8d,0x02,0x00,0xa5,0x29,0x12,0xb0,0x7f,
-0x01,0x1a,0xd8,0x1c,0x03,0x11,0x58,0x1c,0x03,0x35,0xee,0xed,0xc1,0xad,0x04,0x03,
-0xf7,0x2b,0x75,0x14,0x43,0x33,0x4f,0x64,0x33,0x33,0x10,0x10,0x50,0x0d,0x10,0x0e,
-0x10,0x2b,0x13,0x34,0x41,0x22,0x22,0x25,0xe0,0x45,0x0a,0x27,0xfe,0xfe,0x7e,0x31,
-0x57,0x42,0x22,0x22,0x6e,0x00,0xd2,0x06,0x01,0x0e,0x01,0x13,0x0f,0x67,0x0f,0x15,
-0x11,0x40,0x03,0x15,0xf3,0x0c,0x01,0x55,0x2f,0x54,0x44,0x43,0x30,0x0b,0x01,0x5e,
-0x2f,0x43,0x33,0x34,0x76,0x0a,0x01,0x00,0xc0,0x2a,0x02,0x16,0x03,0x76,0xfd,0x01,
-0x11,0xf4,0x11,0x0e,0x50,0xab,0x12,0x03,0xa3,0x12,0x19,0xf2,0x07,0x00,0x30,0x60,
-0x00,0x05,0x85,0x01,0x02,0xb1,0x2b,0x0f,0x05,0x01,0x05,0x47,0xee,0xee,0xed,0xd8,
-0x08,0x2b,0x56,0xed,0xdd,0xdd,0xee,0x10,0xe6,0x10,0x0b,0x05,0x01,0x51,0x9c,0x33,
-0x3f,0x73,0x33,0x35,0x32,0x11,0xf4,0xdc,0x3b,0x32,0xee,0xef,0xfd,0xb9,0x01,0x01,
-0x24,0x14,0x12,0x10,0xe7,0x0c,0x12,0xf1,0x8e,0x01,0x60,0x1f,0xdd,0xcc,0xdd,0xee,
-0x00,0x4c,0x08,0x32,0x55,0x44,0x20,0x8c,0x01,0x20,0x83,0x00,0x27,0x2f,0x2e,0xdd,
-0xdf,0x11,0x05,0x12,0x0d,0x7c,0x02,0x5a,0x01,0xf4,0x33,0x32,0x22,0x7c,0x11,0x22,
-0x01,0x30,0x5b,0x21,0x01,0x14,0x0c,0x0e,0xcc,0x1f,0x00,0x41,0x27,0x01,0x8b,0x30,
-0x15,0x11,0x41,0x27,0x12,0x11,0x92,0x3e,0x13,0xff,0x3d,0x18,0x10,0x00,0x23,0x2f,
-0x01,0x3c,0x00,0x22,0x1b,0x80,0x85,0x01,0x00,0xcc,0x35,0x0b,0x89,0x1f,0x13,0xef,
-0x9c,0x01,0x03,0x54,0x1f,0x02,0x68,0x00,0x13,0x7f,0x8f,0x45,0x22,0x01,0x11,0x95,
-0x23,0x2e,0x07,0x20,0x88,0x20,0x07,0x02,0x13,0x12,0xff,0x52,0x3d,0x03,0x3b,0x01,
-0x20,0x02,0x33,0x69,0x31,0x01,0x31,0x44,0x17,0xcf,0xa2,0x20,0x21,0xbd,0xdd,0x12,
-0x08,0x21,0x0e,0x74,0xf0,0x01,0x04,0x4b,0x00,0x00,0x68,0x41,0x24,0xfb,0x00,0x79,
-0x00,0x30,0x24,0x43,0x33,0xe5,0x2a,0x30,0x08,0xcc,0xcc,0xcd,0x21,0x17,0xb0,0x87,
-0x01,0x31,0xef,0xff,0xa0,0x30,0x12,0x23,0x32,0x8c,0x54,0x05,0x12,0xc0,0x82,0x04,
-0x17,0xe9,0x10,0x03,0x00,0x1f,0x14,0x12,0x00,0x82,0x04,0x10,0xd2,0x2d,0x00,0x30,
-0x44,0x44,0x41,0xcb,0x56,0x45,0xdd,0xdd,0xcf,0x80,0x0e,0x01,0x00,0xfe,0x01,0x10,
-0x3b,0x0e,0x01,0x47,0xee,0xee,0xee,0xd6,0x1f,0x14,0x41,0x53,0x22,0x23,0x69,0x2b,
-0x02,0x26,0xee,0xed,0x77,0x00,0x02,0x7a,0x04,0x31,0xd1,0x14,0x44,0x01,0x00,0x05,
-0x78,0x01,0x12,0x3e,0x4a,0x3d,0x31,0x05,0xf4,0x44,0xfe,0x01,0x01,0x95,0x08,0x02,
-0x65,0x30,0x00,0x86,0x08,0x13,0x4f,0x9a,0x28,0x12,0x45,0x9a,0x28,0x01,0x68,0x0b,
-0xa2,0x19,0x99,0x9a,0x80,0x00,0x3e,0x18,0x98,0x8a,0xe0,0xee,0x17,0x01,0x93,0x3c,
-0x05,0x0c,0x00,0xd1,0x18,0x88,0x8b,0xe0,0x00,0x3e,0x5f,0xba,0xaa,0x70,0x00,0x3e,
-0x5e,0xca,0x00,0x09,0x06,0x00,0xb7,0x11,0x12,0x35,0x20,0x3f,0x3f,0xff,0xfe,0xdb,
-0x30,0x3f,0xf8,0x03,0x17,0x3e,0x06,0x00,0x18,0x2d,0x09,0x10,0x10,0x3e,0xac,0x07,
-0x40,0x3f,0x02,0x33,0x25,0xee,0x2b,0x00,0x1d,0x01,0x30,0x4f,0x02,0x22,0x0c,0x00,
-0x10,0x4f,0x18,0x00,0x18,0x4f,0x5a,0x00,0x00,0x28,0x0b,0x63,0x20,0x3f,0x1b,0xcc,
-0xb9,0x64,0x54,0x00,0x11,0x19,0xac,0x02,0x31,0x31,0x00,0x6f,0xe8,0x2b,0x01,0x12,
-0x1d,0x0d,0x06,0x00,0x11,0x5d,0x06,0x00,0x12,0x39,0x09,0x3d,0xb3,0x02,0xcc,0xcc,
-0xcb,0x00,0x04,0xf0,0x04,0x55,0x46,0xf0,0xa1,0x29,0x03,0xaf,0x29,0x90,0x3f,0x02,
-0xde,0xee,0xff,0x00,0x03,0xf0,0x5e,0xbe,0x3a,0x31,0x3f,0x05,0xe0,0x2c,0x10,0xe0,
-0x5e,0x00,0x00,0x13,0x10,0x3e,0x03,0xfe,0xee,0xff,0xe4,0x03,0xe0,0x01,0x88,0x06,
-0x14,0x4e,0xde,0x07,0x54,0x0d,0x10,0x00,0x00,0x3d,0x9c,0x02,0x27,0x1f,0x20,0x7f,
-0x14,0x03,0x16,0x0f,0x06,0x97,0x03,0x20,0x04,0x03,0x8f,0x05,0x21,0x03,0xf0,0xe2,
-0x00,0x04,0x75,0x00,0x01,0xe3,0x00,0x22,0x3f,0x04,0x1a,0x00,0x02,0xde,0x00,0x12,
-0x05,0xd3,0x11,0x02,0xe5,0x00,0x55,0x01,0xbc,0xcb,0x96,0x40,0xd8,0x11,0x12,0x01,
-0x0d,0x0c,0x51,0x3f,0x54,0x44,0x44,0x8e,0xb6,0x03,0x21,0x05,0xe0,0xc4,0x03,0x14,
-0x5e,0x0d,0x00,0x85,0x2f,0xdb,0xbb,0xcc,0xdc,0x00,0x00,0x34,0x0d,0x0c,0x20,0x27,
-0x3f,0x3e,0x01,0x11,0x5e,0x74,0x00,0x11,0x5e,0xe2,0x00,0x11,0x5e,0x73,0x00,0x11,
-0x5e,0x56,0x01,0x21,0x5d,0x5e,0x1a,0x01,0x00,0xe0,0x00,0x20,0x00,0x5d,0x0f,0x0a,
-0x83,0x20,0x5d,0x02,0x33,0x22,0x20,0x00,0x3b,0x0e,0x2c,0x00,0xde,0x00,0x11,0x49,
-0xd3,0x30,0x11,0x5c,0x79,0x02,0x71,0xfc,0x00,0x0f,0x64,0x44,0x44,0x8c,0x12,0x00,
-0x71,0x6c,0x00,0x0f,0x31,0x11,0x11,0x7b,0x08,0x04,0x13,0xf8,0xb0,0x2d,0x63,0xef,
-0xff,0xfd,0x00,0x04,0xe0,0xc3,0x01,0x00,0xe1,0x00,0x22,0x04,0xf0,0xc4,0x01,0x10,
-0x04,0x25,0x3e,0x12,0x04,0xe1,0x00,0x31,0x4e,0x05,0xe0,0x3c,0x01,0xc6,0x5e,0x33,
-0x34,0x68,0x10,0x4e,0x02,0xde,0xed,0xcb,0x81,0x04,0x93,0x2c,0x21,0x01,0xd2,0x93,
-0x2c,0x21,0x5f,0x10,0xe0,0x15,0x11,0xf3,0xb1,0x06,0x21,0xfa,0xf4,0x0a,0x49,0x21,
-0x06,0xf6,0x21,0x5b,0x92,0x04,0xe9,0x00,0x07,0xb2,0x00,0x00,0x02,0xb4,0xe6,0x47,
-0x01,0x56,0x01,0x24,0x05,0xe0,0xe2,0x00,0x00,0x75,0x00,0x11,0xe0,0x75,0x00,0x31,
-0x4e,0x04,0xff,0x8f,0x00,0x0a,0x75,0x00,0x13,0x32,0x75,0x00,0x23,0xb9,0x60,0x94,
-0x31,0x70,0x3a,0x00,0x00,0x01,0x7b,0xdc,0x93,0x52,0x3f,0x31,0x53,0x48,0xf6,0xba,
-0x42,0x20,0x05,0xf0,0xa2,0x29,0x00,0xcf,0x01,0x11,0xba,0x9c,0x0a,0x50,0x03,0xf9,
-0x31,0x26,0xf9,0x13,0x37,0x23,0xed,0xb6,0x1d,0x2a,0x00,0x84,0x1f,0x30,0x30,0x00,
-0x3f,0x2e,0x34,0x22,0xdf,0x20,0x52,0x14,0x30,0xe3,0x00,0x3f,0x30,0x04,0x11,0x0e,
-0x61,0x14,0x12,0x30,0x0f,0x00,0x10,0xe3,0x0f,0x00,0x21,0xf3,0x22,0x0f,0x00,0x30,
-0x2f,0xff,0xe3,0x0f,0x00,0x40,0x02,0xf0,0x00,0x0e,0x96,0x18,0x12,0x2f,0xf4,0x05,
-0x00,0x0f,0x00,0x50,0x42,0x22,0xe3,0x00,0x2f,0x80,0x09,0x2f,0xee,0x20,0x4a,0x1a,
-0x0b,0x1a,0x02,0x2b,0x2b,0x10,0x05,0x30,0x22,0xb1,0xff,0x20,0x0c,0x70,0x00,0xf5,
-0x22,0x2f,0x40,0x0c,0x70,0x53,0x06,0x03,0x07,0x00,0x13,0x0b,0x07,0x00,0x21,0xff,
-0xfd,0x07,0x00,0x32,0x92,0x21,0xe3,0x15,0x00,0x60,0xdf,0xee,0xff,0x20,0x0b,0x70,
-0x77,0x2c,0x04,0xc1,0x31,0x21,0x05,0x20,0x83,0x09,0x00,0x24,0x06,0x06,0x70,0x3b,
-0x0a,0x7e,0x0c,0x0a,0x07,0x00,0x13,0x0b,0xa8,0x19,0x60,0x70,0x00,0x09,0xcc,0xcd,
-0xc1,0x74,0x01,0x60,0xf7,0x44,0x4f,0x30,0x05,0xe0,0x5c,0x0a,0x10,0xf3,0x67,0x03,
-0x10,0xf3,0x56,0x15,0x12,0xd0,0x0f,0x00,0x13,0x4e,0x0f,0x00,0x20,0xff,0xfe,0x05,
-0x01,0x00,0xe7,0x11,0xb4,0xd7,0x55,0x5e,0x40,0x04,0xd0,0x00,0x08,0xcc,0xbb,0xa1,
-0x95,0x10,0x22,0x05,0xd0,0x84,0x1c,0x12,0x5d,0x0f,0x2b,0x26,0x05,0xc0,0x60,0x0b,
-0x19,0xf1,0x3b,0x0a,0x10,0x01,0xb6,0x22,0x16,0xe0,0x0a,0x12,0x01,0xc5,0x1a,0x41,
-0x00,0x0b,0xee,0xef,0x69,0x12,0x00,0x06,0x01,0x02,0x87,0x00,0x11,0xe4,0x78,0x00,
-0x00,0x5e,0x10,0x20,0xf3,0x32,0x0f,0x00,0x00,0x62,0x41,0x01,0x0f,0x00,0x33,0xe0,
-0x00,0x0e,0x1e,0x00,0x00,0x09,0x01,0x30,0x04,0xc0,0x00,0xce,0x03,0x13,0x21,0xd2,
-0x05,0x00,0x06,0x09,0x12,0x56,0xb2,0x06,0x20,0x09,0x90,0x62,0x38,0x10,0x30,0x4f,
-0x2e,0x21,0x38,0x83,0xd4,0x36,0x21,0x3f,0x88,0x5e,0x2e,0x90,0x08,0xa0,0x0a,0x60,
-0x00,0x08,0xec,0xd8,0x7c,0xf0,0x34,0x53,0x15,0x54,0x11,0xce,0xeb,0xf0,0x08,0x04,
-0xf0,0x07,0x10,0x40,0x8f,0x00,0x11,0xe1,0x8f,0x00,0x25,0x32,0x2f,0x16,0x01,0x12,
-0x5e,0x07,0x01,0x30,0x05,0xe2,0x21,0x0f,0x00,0x00,0x61,0x41,0x00,0x0c,0x02,0x00,
-0x8f,0x00,0x21,0x51,0x11,0x8f,0x00,0x48,0xbf,0xff,0xfe,0x20,0x71,0x37,0x20,0x23,
-0x33,0x95,0x0a,0x00,0x68,0x19,0x03,0xd1,0x04,0x01,0xa7,0x05,0x00,0x3c,0x18,0x12,
-0x7e,0x78,0x18,0x26,0xff,0xa0,0x58,0x2f,0x10,0xf3,0x6f,0x33,0x03,0xb9,0x43,0x1f,
+0xc7,0x02,0x02,0xbb,0x02,0x20,0x11,0x4f,0xbb,0x02,0x30,0xff,0xff,0x5d,0x5d,0x00,
+0x0f,0xc7,0x02,0x1d,0xc1,0x06,0x05,0xcc,0xcc,0xd3,0x00,0x02,0xf0,0x14,0x54,0x4e,
+0x50,0x1f,0x00,0x40,0xd5,0x6f,0xff,0xf0,0xb2,0x04,0x60,0x11,0x3f,0x04,0xff,0xff,
+0xf5,0xba,0x02,0xf3,0x08,0x21,0x10,0x03,0x88,0x9f,0x05,0xd0,0x00,0x00,0x39,0x9a,
+0xf0,0x5e,0x22,0x24,0x66,0x00,0x2f,0x02,0xef,0xfe,0xdb,0x60,0xc7,0x02,0xe2,0x1a,
+0x00,0x00,0x33,0x34,0x44,0x44,0x20,0x00,0x3e,0xee,0xee,0xed,0xee,0x1b,0x03,0x02,
+0x1a,0x00,0x12,0x4f,0xb3,0x02,0x02,0x0d,0x00,0x12,0x4e,0xd3,0x01,0x12,0xa0,0x21,
+0x00,0x01,0x75,0x00,0x80,0x03,0xf1,0x16,0x66,0x6e,0x61,0x33,0x6f,0xc7,0x02,0xf0,
+0x00,0x6d,0xde,0xf1,0x04,0x44,0x5e,0x50,0x00,0x2f,0x14,0xfc,0xcc,0xc3,0x14,0x35,
+0x4e,0x01,0xf1,0x01,0x06,0xdd,0xef,0x05,0xe1,0x11,0x24,0x60,0x02,0xf0,0x3f,0xff,
+0xfe,0xc9,0x00,0x3f,0x3a,0x00,0x80,0x01,0x90,0x00,0x00,0x11,0x11,0x11,0x10,0xf0,
+0x00,0xf3,0x08,0xff,0xff,0xd0,0x00,0x01,0x11,0x11,0x10,0x4f,0x00,0x00,0x12,0x22,
+0x23,0x36,0xe0,0x00,0x2f,0xff,0xff,0xff,0xfa,0x00,0x98,0x00,0x51,0x2f,0x32,0x22,
+0x23,0x33,0xc7,0x02,0x90,0xee,0xe4,0x00,0x03,0x44,0x44,0x45,0x82,0x00,0x71,0x03,
+0x32,0xcc,0xcf,0x70,0xf9,0x00,0x12,0xb7,0x07,0x00,0xf0,0x02,0x0b,0x70,0x00,0x00,
+0x1e,0xff,0xff,0xff,0xf7,0x00,0x00,0x02,0xf3,0x22,0x22,0x11,0x00,0x2b,0x05,0x02,
+0xac,0x00,0x51,0xf2,0x11,0x11,0x22,0x20,0x5c,0x06,0x21,0xff,0xed,0x12,0x00,0x12,
+0x30,0x33,0x00,0x13,0x3e,0x6f,0x05,0x01,0xd9,0x03,0x81,0x22,0x23,0x6e,0x22,0x22,
+0x22,0x07,0xff,0x01,0x00,0xe3,0xf1,0x00,0x01,0x33,0x33,0x33,0x43,0x00,0x00,0x00,
+0x8d,0xee,0xdd,0xde,0xd1,0x04,0x00,0x07,0x01,0xc1,0x23,0x33,0x33,0x36,0xe0,0x00,
+0x00,0x0d,0xfe,0xee,0xee,0xeb,0x9c,0x06,0x02,0x01,0x02,0x41,0x73,0x33,0x33,0x34,
+0x2d,0x00,0x33,0xfe,0xdd,0xc3,0x9f,0x01,0x00,0x41,0x05,0x61,0x24,0xf2,0x22,0x33,
+0x30,0x7e,0x52,0x00,0x24,0xee,0x40,0xa9,0x01,0xd2,0x04,0x55,0x55,0x55,0x66,0x00,
+0x00,0x03,0xcd,0xdd,0xdc,0xcc,0xf3,0x13,0x00,0x13,0x0f,0x91,0x00,0x0b,0x0f,0x00,
+0x16,0xe1,0xdf,0x01,0x00,0x2c,0x01,0x54,0x20,0x00,0x00,0x00,0xcf,0xcd,0x03,0x40,
+0x00,0x00,0x7b,0x00,0x2f,0x01,0x32,0x22,0x28,0xb0,0xda,0x00,0x15,0xe9,0x01,0x03,
+0x50,0x00,0x0e,0x72,0x22,0x22,0x8f,0x00,0x51,0x9e,0xff,0xff,0xfe,0xd1,0x5a,0x06,
+0x02,0x09,0x01,0x00,0x9a,0x04,0x22,0x00,0x7f,0xe2,0x00,0xb3,0x20,0x11,0x11,0x11,
+0x11,0x12,0x22,0x10,0x00,0x0a,0x00,0x25,0x01,0x02,0x08,0x00,0x03,0x34,0x01,0x23,
+0x03,0xf1,0x0f,0x00,0x51,0xfe,0xee,0xee,0xff,0x40,0xf8,0x00,0x30,0x33,0x20,0x00,
+0x16,0x01,0x66,0x34,0x56,0x00,0x00,0x00,0x8e,0x16,0x01,0x00,0x10,0x02,0x40,0xbf,
+0xff,0xff,0xff,0x16,0x01,0xf0,0x00,0x72,0x22,0x22,0x21,0x00,0x00,0x00,0xe7,0x11,
+0x11,0x12,0x30,0x00,0x00,0x09,0xf7,0x00,0x14,0x30,0x78,0x00,0xf4,0x00,0x15,0x44,
+0x44,0x5f,0x43,0x44,0x55,0x05,0xbc,0xcc,0xcc,0xcc,0xcc,0xbb,0xb1,0xd8,0x00,0x20,
+0x01,0xef,0x6f,0x01,0x00,0xe1,0x07,0x30,0x33,0x22,0x2f,0x62,0x00,0x51,0x11,0x12,
+0x22,0xf2,0x00,0x02,0x02,0x43,0xfe,0x10,0x00,0x03,0x96,0x00,0xd2,0x3f,0x42,0x22,
+0x33,0x34,0x20,0x00,0x01,0xdf,0xff,0xff,0xfe,0xe8,0x87,0x00,0x1e,0x43,0x87,0x00,
+0x03,0x9d,0x01,0x1b,0x0e,0x9d,0x01,0xc4,0x84,0x44,0x44,0x45,0x10,0x00,0x00,0x8c,
+0xdd,0xfd,0xcc,0xb3,0xe3,0x00,0xa1,0x01,0x44,0x44,0x46,0xf5,0x44,0x44,0x50,0x7e,
+0xdd,0x01,0x00,0x16,0x10,0x69,0x01,0x22,0x1f,0x30,0x4f,0x03,0x12,0xf3,0x17,0x01,
+0x21,0xfe,0xe2,0x0f,0x01,0x20,0xea,0x09,0xea,0x06,0xd6,0x08,0xf8,0x00,0x06,0xf8,
+0x00,0x00,0x09,0xc3,0x00,0x00,0x02,0xc6,0x33,0x00,0x00,0xd2,0x01,0x9f,0x51,0x00,
+0x00,0x00,0xcc,0xcc,0xcc,0xbf,0x60,0x95,0x02,0x02,0x12,0xf6,0x95,0x02,0x15,0x22,
+0xba,0x03,0x01,0x95,0x02,0x13,0x12,0x95,0x02,0x17,0xfd,0xe8,0x01,0x40,0x58,0x00,
+0x0c,0x00,0x6a,0x00,0x30,0xb0,0x01,0xf1,0x95,0x02,0x46,0x9c,0x33,0x3f,0x32,0x95,
+0x02,0x00,0x08,0x02,0x22,0x10,0x00,0x33,0x03,0x10,0x30,0x0d,0x00,0x33,0x00,0x00,
+0xe3,0xe5,0x00,0xf7,0x00,0x30,0x00,0x00,0x1c,0xdd,0xdd,0xdd,0xf3,0x00,0x00,0x02,
+0xf5,0x44,0x44,0x33,0x69,0x00,0xd9,0xf4,0x33,0x33,0x47,0x70,0x00,0x00,0x0b,0xde,
+0xdd,0xdc,0xc8,0x00,0x01,0x00,0x32,0x11,0x22,0x09,0x5a,0x00,0x62,0xe0,0x01,0x11,
+0x11,0x4f,0x00,0xf9,0x01,0x13,0xf0,0x72,0x01,0x0a,0x0f,0x00,0x13,0x4e,0xae,0x01,
+0x00,0xea,0x04,0x00,0xac,0x01,0x96,0x33,0x42,0x00,0x00,0x00,0xbe,0xee,0xdd,0xde,
+0x8d,0x02,0x00,0x7f,0x01,0x22,0x39,0xb0,0x7f,0x01,0x1a,0xd8,0x1c,0x03,0x11,0x58,
+0x1c,0x03,0x35,0xee,0xed,0xc1,0xad,0x04,0x11,0xee,0x01,0x00,0x80,0xe2,0x14,0x43,
+0x33,0x4f,0x64,0x33,0x33,0x5a,0x00,0x12,0xf2,0x33,0x06,0xf4,0x04,0x0e,0x10,0x2b,
+0x00,0x00,0x01,0xf4,0x22,0x22,0x25,0xe0,0x00,0x00,0x1f,0xff,0xff,0xfe,0xfe,0x00,
+0x52,0x07,0x77,0x00,0x1f,0x42,0x22,0x22,0x6e,0x00,0xd2,0x06,0x01,0x0e,0x01,0x20,
+0x0f,0xff,0x34,0x0a,0x01,0x0d,0x01,0x15,0xf3,0x47,0x03,0x03,0x0c,0x01,0x55,0x2f,
+0x54,0x44,0x43,0x30,0x0b,0x01,0x5d,0x2f,0x43,0x33,0x34,0x76,0x0a,0x01,0x00,0x74,
+0x02,0x12,0x22,0x16,0x03,0x71,0xfd,0x01,0x11,0xf4,0x11,0x0e,0x50,0x43,0x00,0x04,
+0x07,0x00,0x00,0xb8,0x03,0x19,0xf2,0x07,0x00,0x41,0x60,0x00,0x05,0x10,0x05,0x01,
+0x2f,0x44,0x30,0x05,0x01,0x07,0x46,0xee,0xee,0xed,0xd8,0x92,0x03,0x92,0x0d,0xed,
+0xdd,0xdd,0xee,0x10,0x00,0x00,0x13,0x47,0x03,0x0c,0x05,0x01,0x91,0x9c,0x33,0x3f,
+0x73,0x33,0x00,0x00,0x07,0xb0,0x50,0x09,0x52,0x1e,0xff,0xee,0xef,0xfd,0xb9,0x01,
+0x61,0x36,0xf0,0x00,0x00,0x3f,0x10,0x8e,0x01,0x22,0x03,0xf1,0x8e,0x01,0x60,0x1f,
+0xdd,0xcc,0xdd,0xee,0x00,0x4c,0x08,0x32,0x55,0x44,0x20,0x8c,0x01,0x8e,0x83,0x00,
+0x00,0x00,0xce,0xee,0xdd,0xdf,0x11,0x05,0x12,0x0d,0x7c,0x02,0x50,0x01,0xf4,0x33,
+0x32,0x22,0xdc,0x02,0x02,0x7c,0x00,0x00,0x6c,0x01,0x50,0x01,0x30,0x00,0x00,0x0e,
+0xf4,0x00,0x20,0x10,0x00,0x7c,0x05,0x1d,0x00,0x01,0x00,0x91,0x6e,0xee,0xef,0xff,
+0xff,0xfe,0xee,0x11,0x33,0x01,0x00,0x13,0x30,0xae,0x05,0x20,0x00,0x00,0x34,0x00,
+0x03,0x69,0x00,0x21,0xa8,0x00,0x3c,0x00,0x21,0x1b,0x80,0x85,0x01,0x00,0x7a,0x05,
+0x29,0x01,0xf3,0x45,0x03,0x23,0x00,0xef,0x9c,0x01,0x21,0x22,0x22,0x12,0x07,0x02,
+0x68,0x00,0x03,0x82,0x04,0x41,0x10,0x01,0x11,0x11,0x54,0x00,0x37,0x07,0x20,0x00,
+0xbf,0x07,0x04,0x4e,0x07,0x23,0x00,0xf5,0x0f,0x00,0x54,0xff,0xee,0xee,0xff,0x30,
+0x3b,0x01,0x00,0x09,0x0c,0x10,0x44,0x85,0x01,0x43,0xbd,0xdd,0xdd,0xcf,0x53,0x05,
+0x12,0xe4,0x0f,0x00,0x00,0x12,0x08,0x21,0x0e,0x74,0xf0,0x01,0x04,0x4b,0x00,0x64,
+0x0b,0xff,0xff,0xff,0xfb,0x00,0x79,0x00,0xf7,0x00,0x24,0x43,0x33,0x33,0x33,0x34,
+0x44,0x08,0xcc,0xcc,0xdd,0xdc,0xcc,0xcc,0xb0,0x87,0x01,0x10,0xef,0x4f,0x02,0x53,
+0x03,0x33,0x33,0x32,0x8c,0x54,0x05,0x12,0xc0,0x82,0x04,0x16,0xe9,0x10,0x03,0x00,
+0x82,0x04,0x22,0x44,0x00,0x82,0x04,0x10,0xd2,0x2d,0x00,0xb5,0x44,0x44,0x41,0x00,
+0x00,0x00,0xdd,0xdd,0xdd,0xcf,0x80,0x0e,0x01,0x00,0xfe,0x01,0x10,0x3b,0x0e,0x01,
+0x43,0xee,0xee,0xee,0xd6,0xd4,0x02,0x00,0x0e,0x01,0x41,0x53,0x22,0x23,0x69,0x2b,
+0x02,0x26,0xee,0xed,0x77,0x00,0x02,0x7a,0x04,0x31,0xd1,0x14,0x44,0x01,0x00,0x04,
+0x78,0x01,0x00,0x7e,0x07,0x71,0xff,0xfc,0x00,0x00,0x05,0xf4,0x44,0xfe,0x01,0x12,
+0x5e,0x8c,0x03,0x21,0x05,0xe0,0xd3,0x09,0x31,0x00,0x4f,0xcb,0x49,0x0a,0x63,0x00,
+0x45,0x55,0x55,0x44,0x10,0x68,0x0b,0xa0,0x19,0x99,0x9a,0x80,0x00,0x3e,0x18,0x98,
+0x8a,0xe0,0xd2,0x06,0x11,0x04,0x06,0x00,0x15,0x05,0x0c,0x00,0xd1,0x18,0x88,0x8b,
+0xe0,0x00,0x3e,0x5f,0xba,0xaa,0x70,0x00,0x3e,0x5e,0xca,0x00,0x09,0x06,0x00,0xb7,
+0x11,0x12,0x35,0x20,0x3f,0x3f,0xff,0xfe,0xdb,0x30,0x3f,0xf8,0x03,0x17,0x3e,0x06,
+0x00,0x17,0x2d,0x15,0x02,0x20,0x03,0x3e,0xac,0x07,0x71,0x3f,0x02,0x33,0x25,0xf0,
+0x00,0x4f,0x1d,0x01,0x30,0x4f,0x02,0x22,0x0c,0x00,0x10,0x4f,0x18,0x00,0x18,0x4f,
+0x5a,0x00,0x00,0x28,0x0b,0x63,0x20,0x3f,0x1b,0xcc,0xb9,0x64,0x54,0x00,0x11,0x19,
+0xac,0x02,0x62,0x31,0x00,0x6f,0xee,0xee,0xee,0xf2,0x04,0x1d,0x5e,0x06,0x00,0x11,
+0x5d,0x06,0x00,0x11,0x39,0x06,0x00,0xc1,0x16,0x02,0xcc,0xcc,0xcb,0x00,0x04,0xf0,
+0x04,0x55,0x46,0xf0,0x43,0x00,0x10,0x3f,0x8d,0x01,0x00,0x04,0x00,0xe0,0x3f,0x02,
+0xde,0xee,0xff,0x00,0x03,0xf0,0x5e,0x32,0x22,0x10,0x00,0x3f,0x1b,0x01,0xf4,0x04,
+0x00,0x03,0xe0,0x5e,0x00,0x00,0x13,0x10,0x3e,0x03,0xfe,0xee,0xff,0xe4,0x03,0xe0,
+0x01,0x22,0x21,0xb4,0x04,0x00,0xb5,0x09,0x44,0x10,0x00,0x00,0x3d,0x9c,0x02,0x02,
+0x04,0x03,0x03,0x9b,0x01,0x10,0x0f,0xdf,0x06,0x17,0x10,0x97,0x03,0x20,0x04,0x03,
+0x8f,0x05,0x21,0x03,0xf0,0xe2,0x00,0x04,0x75,0x00,0x01,0xe3,0x00,0x22,0x3f,0x04,
+0x1a,0x00,0x02,0xde,0x00,0x02,0x75,0x00,0x12,0xf0,0xe5,0x00,0x73,0x01,0xbc,0xcb,
+0x96,0x40,0x03,0xf0,0xbc,0x0d,0x12,0x01,0x0d,0x0c,0x51,0x3f,0x54,0x44,0x44,0x8e,
+0xb6,0x03,0x21,0x05,0xe0,0xc4,0x03,0x14,0x5e,0x0d,0x00,0x85,0x2f,0xdb,0xbb,0xcc,
+0xdc,0x00,0x00,0x34,0x0d,0x0c,0x20,0x27,0x3f,0x3e,0x01,0x11,0x5e,0x74,0x00,0x11,
+0x5e,0xe2,0x00,0x11,0x5e,0x73,0x00,0x11,0x5e,0x56,0x01,0x21,0x5d,0x5e,0x1a,0x01,
+0x00,0xe0,0x00,0x20,0x00,0x5d,0x0f,0x0a,0x83,0x20,0x5d,0x02,0x33,0x22,0x20,0x00,
+0x3b,0x94,0x01,0x00,0xde,0x00,0x71,0x49,0x00,0x0f,0x20,0x00,0x00,0x5c,0x79,0x02,
+0x71,0xfc,0x00,0x0f,0x64,0x44,0x44,0x8c,0x12,0x00,0x71,0x6c,0x00,0x0f,0x31,0x11,
+0x11,0x7b,0x08,0x04,0x12,0xf8,0xc2,0x01,0x73,0x03,0xef,0xff,0xfd,0x00,0x04,0xe0,
+0xc3,0x01,0x00,0xe1,0x00,0x22,0x04,0xf0,0xc4,0x01,0x62,0x04,0xff,0xff,0xfc,0x00,
+0x04,0xe1,0x00,0x31,0x4e,0x05,0xe0,0x3c,0x01,0xd5,0x5e,0x33,0x34,0x68,0x10,0x4e,
+0x02,0xde,0xed,0xcb,0x81,0x04,0xe0,0x0a,0x06,0x30,0x01,0xd2,0x03,0x86,0x0c,0x11,
+0x5f,0xbf,0x00,0x21,0x0c,0xf3,0xb1,0x06,0x20,0xfa,0xf4,0x0b,0x0d,0xf0,0x02,0xf5,
+0x06,0xf6,0x00,0x00,0x0a,0xf4,0x00,0x04,0xe9,0x00,0x07,0xb2,0x00,0x00,0x02,0xb4,
+0x10,0x00,0x01,0x00,0xf0,0x0d,0x26,0x03,0xff,0xff,0xfd,0x00,0x05,0xe0,0x02,0x33,
+0x25,0xf0,0x00,0x5e,0x00,0x00,0x00,0x3f,0x00,0x04,0xe0,0x02,0x22,0x25,0xf0,0x00,
+0x4e,0x04,0x1a,0x00,0x30,0x04,0xe0,0x5e,0x27,0x00,0x50,0x4e,0x05,0xe0,0x00,0x00,
+0x0d,0x00,0xc1,0x32,0x34,0x68,0x10,0x4e,0x02,0xde,0xed,0xb9,0x60,0x04,0xd0,0x41,
+0x00,0xf1,0x20,0x3a,0x00,0x00,0x01,0x7b,0xdc,0x93,0x00,0x00,0x01,0xeb,0x53,0x48,
+0xf6,0x00,0x00,0xac,0x00,0x00,0x05,0xf0,0x00,0x0c,0x70,0x00,0x00,0x1f,0x20,0x00,
+0xba,0x00,0x00,0x04,0xf0,0x00,0x03,0xf9,0x31,0x26,0xf9,0x00,0x00,0x03,0xad,0xed,
+0xb6,0x00,0x01,0x00,0xf0,0x06,0x40,0x00,0x02,0x33,0x34,0x30,0x00,0x3f,0x00,0x00,
+0xee,0xdd,0xdf,0x20,0x03,0xf0,0x00,0x0e,0x40,0x00,0xe3,0x0f,0x00,0x40,0xe4,0x00,
+0x0e,0x30,0x0f,0x00,0x12,0x30,0x0f,0x00,0x10,0xe3,0x0f,0x00,0x21,0xf3,0x22,0x0f,
+0x00,0x30,0x2f,0xff,0xe3,0x0f,0x00,0xf0,0x00,0x02,0xf0,0x00,0x0e,0x20,0x00,0xe4,
+0x00,0x2f,0x00,0x00,0xf2,0x00,0x0e,0x40,0x0f,0x00,0x30,0x42,0x22,0xe3,0x0f,0x00,
+0x62,0xcf,0xff,0xee,0x20,0x02,0xf0,0x61,0x00,0x12,0x2f,0x07,0x00,0x0f,0x0f,0x00,
+0x04,0x12,0x06,0x07,0x00,0xf4,0x05,0x05,0x30,0x00,0xbe,0xee,0xff,0x20,0x0c,0x70,
+0x00,0xf5,0x22,0x2f,0x40,0x0c,0x70,0x00,0xf3,0x00,0x0e,0x07,0x00,0x13,0x0b,0x07,
+0x00,0x21,0xff,0xfd,0x07,0x00,0x32,0x92,0x21,0xe3,0x15,0x00,0xd2,0xdf,0xee,0xff,
+0x20,0x0b,0x70,0x00,0x12,0x22,0x10,0x00,0x0b,0x70,0x46,0x00,0xf1,0x00,0x20,0x00,
+0x00,0x23,0x33,0x33,0x33,0x00,0x00,0x07,0xfe,0xee,0xee,0xef,0x40,0x15,0x00,0x2f,
+0x0e,0x50,0x07,0x00,0x07,0x22,0x0b,0x20,0x8d,0x00,0x60,0x70,0x00,0x09,0xcc,0xcd,
+0xc1,0x74,0x01,0xf2,0x06,0xf7,0x44,0x4f,0x30,0x05,0xe0,0x00,0x0f,0x30,0x00,0xf3,
+0x00,0x5d,0x00,0x00,0xf3,0x00,0x0f,0x30,0x04,0xd0,0x0f,0x00,0x13,0x4e,0x0f,0x00,
+0x21,0xff,0xfe,0x05,0x01,0xf3,0x01,0x4e,0x22,0x10,0xd7,0x55,0x5e,0x40,0x04,0xd0,
+0x00,0x08,0xcc,0xbb,0xa1,0x00,0x4d,0xc9,0x00,0x60,0xd0,0x00,0x00,0x01,0x00,0x00,
+0x3c,0x00,0xa2,0x02,0xf1,0x00,0x00,0x05,0xc0,0x00,0x00,0x2f,0x10,0x65,0x00,0x13,
+0xf1,0x01,0x01,0x02,0x0f,0x00,0xe2,0x01,0xff,0xee,0xee,0xef,0xe0,0x00,0x00,0x02,
+0x33,0x33,0x33,0x32,0x00,0x13,0x00,0x60,0x60,0x00,0x0b,0xee,0xef,0xf2,0x87,0x00,
+0x00,0x06,0x01,0x02,0x87,0x00,0x12,0xe4,0x78,0x00,0x51,0x0e,0x40,0x04,0xf3,0x32,
+0x0f,0x00,0x31,0x4f,0xff,0xe0,0x0f,0x00,0x33,0xe0,0x00,0x0e,0x1e,0x00,0x00,0x09,
+0x01,0x92,0x04,0xc0,0x00,0x01,0x22,0x21,0x00,0x21,0x00,0xd8,0x00,0xf0,0x09,0xff,
+0xf1,0x00,0x00,0x56,0x00,0x01,0x11,0x11,0x00,0x00,0x09,0x90,0x03,0xef,0xff,0xff,
+0x30,0x00,0x99,0x00,0x00,0x38,0x83,0x0f,0x00,0xf2,0x0b,0x00,0x3f,0x88,0xf2,0x00,
+0x00,0x99,0x00,0x08,0xa0,0x0a,0x60,0x00,0x08,0xec,0xd8,0x7c,0x00,0xc5,0x00,0x00,
+0x15,0x54,0x11,0xce,0xeb,0x3d,0x00,0x23,0x11,0x00,0x8f,0x00,0x10,0x40,0x8f,0x00,
+0x11,0xe1,0x8f,0x00,0x25,0x32,0x2f,0x16,0x01,0x12,0x5e,0x07,0x01,0x31,0x05,0xe2,
+0x21,0x0f,0x00,0x30,0x4f,0xff,0xd0,0x0c,0x02,0x00,0x8f,0x00,0x21,0x51,0x11,0x8f,
+0x00,0x62,0xbf,0xff,0xfe,0x20,0x04,0xe0,0x44,0x00,0x21,0x28,0x00,0x92,0x01,0x92,
+0x34,0x20,0x00,0x00,0x3f,0xff,0xff,0xee,0xfd,0x25,0x01,0x00,0xc1,0x02,0xf2,0x01,
+0x01,0x22,0x22,0x22,0x7e,0x00,0x00,0x03,0xff,0xff,0xff,0xff,0xa0,0x00,0x00,0x4f,
+0x1a,0x00,0xef,0x04,0xf3,0x22,0x22,0x33,0x30,0x00,0x00,0x1e,0xff,0xff,0xfe,0xee,
 0x30,0x16,0x01,0x11,0x14,0xe3,0x16,0x01,0x14,0xd0,0x16,0x01,0x13,0x40,0x16,0x01,
-0x12,0xef,0xa1,0x11,0x00,0xe4,0x04,0x16,0x3c,0x9c,0x05,0x40,0x1c,0xcc,0xcc,0xdd,
-0x35,0x1c,0x32,0x44,0x44,0x44,0x1d,0x0f,0x32,0x02,0xde,0x30,0x0e,0x39,0x11,0x20,
-0x3a,0x3c,0xe0,0xe8,0xed,0x40,0x00,0x00,0x04,0xce,0x70,0x00,0x7e,0xc2,0x00,0x00,
-0x54,0x19,0x00,0x13,0x40,0xf0,0x2a,0x41,0x70,0x66,0x66,0x50,0x14,0x22,0x12,0xaf,
-0xed,0x21,0x11,0xf0,0xed,0x21,0xf0,0x0c,0x1f,0x00,0xf3,0x03,0xe5,0xd0,0x01,0xf0,
-0x0f,0x30,0x3e,0x5c,0x00,0x1f,0x00,0xf6,0x47,0xe5,0xc0,0x01,0xf0,0x0f,0xdc,0xde,
-0x5c,0x00,0x1f,0x27,0x00,0x20,0xc0,0x01,0x27,0x00,0x03,0x0d,0x00,0xa9,0xe8,0x78,
-0xf1,0x0e,0x30,0x3e,0x18,0x88,0x98,0x00,0x14,0x22,0x09,0x0d,0x00,0x18,0xd3,0xae,
-0x3c,0xf0,0x1b,0x50,0x01,0x42,0xee,0xef,0xe1,0x0f,0x40,0x7f,0x5e,0x22,0x2e,0x30,
-0xe4,0x06,0xf5,0xd0,0x00,0xe3,0x0e,0x50,0x6f,0x5d,0x00,0x0e,0x30,0xd7,0x27,0xf6,
-0xc0,0x00,0xe3,0x0d,0xff,0xff,0x5c,0x00,0x0e,0x30,0xd5,0x08,0xf5,0x0d,0x00,0xf4,
-0x00,0x50,0x8f,0x4f,0xee,0xff,0x10,0xd5,0x08,0xf0,0x22,0x22,0x00,0x08,0x30,0x7d,
-0xf2,0x00,0x11,0x1d,0x3b,0x26,0x21,0x02,0xf0,0x03,0x30,0x20,0x2f,0xfe,0xfb,0x04,
-0x81,0x02,0xf4,0x44,0x44,0x38,0xc0,0x00,0x2f,0xce,0x20,0x61,0x02,0xf1,0x11,0x11,
-0x17,0xc0,0xe7,0x08,0x11,0xf7,0x75,0x00,0xe2,0x02,0x82,0xee,0xef,0xe2,0x0f,0x40,
-0x5e,0x5e,0x22,0x2f,0x30,0xe4,0x04,0x75,0x00,0x10,0x4f,0x75,0x00,0x28,0xd6,0x15,
-0x75,0x00,0x12,0x04,0x75,0x00,0xd1,0x4f,0x4f,0xee,0xff,0x20,0xd5,0x04,0xe0,0x22,
-0x22,0x10,0x0b,0x40,0xf7,0x04,0x31,0x20,0x03,0xc0,0x6e,0x31,0x01,0x3b,0x06,0x11,
-0x60,0xf7,0x04,0x21,0xfe,0x20,0x11,0x54,0x90,0x9e,0x30,0x00,0x00,0x06,0xf7,0x00,
-0x7f,0x60,0x3e,0x5f,0x00,0x45,0x3e,0x13,0x71,0x19,0x47,0xf0,0x00,0x00,0x00,0x81,
-0x7a,0xaa,0xba,0x10,0x00,0xe3,0xd9,0x66,0x5f,0x30,0x00,0xe3,0x7c,0x04,0x09,0x06,
-0x00,0xe4,0xe4,0xe3,0x00,0x0e,0x3a,0xcc,0xf4,0xe3,0x00,0x0e,0x34,0x65,0xf4,0xe3,
-0x12,0x00,0x01,0x06,0x00,0x00,0xf0,0x01,0xbe,0xe8,0x66,0x6f,0x30,0x00,0xe4,0x7a,
-0xaa,0x99,0x10,0x00,0xb4,0x24,0x1d,0xe3,0xc1,0x19,0x50,0x06,0x02,0xbb,0xbb,0xc9,
-0x98,0x06,0x70,0x76,0x69,0xe0,0x00,0x3f,0x05,0xd0,0xe8,0x1f,0x43,0xf0,0x5d,0x00,
-0x04,0x0d,0x00,0xd0,0x4f,0xff,0xf0,0x5d,0x00,0x03,0xe0,0x12,0x4f,0x04,0xd0,0x00,
-0x3e,0x92,0x18,0x80,0x44,0x46,0xe0,0x00,0x3f,0x01,0xcc,0xcc,0x34,0x00,0x04,0xf3,
-0x07,0x11,0x10,0x6a,0x08,0x00,0x48,0x04,0x1e,0x2d,0x60,0x11,0x06,0xe3,0x46,0x00,
-0xf5,0x22,0x03,0xcc,0x12,0x50,0x02,0xee,0xef,0xfc,0x00,0x47,0x11,0x41,0x25,0xe0,
-0x00,0x2f,0x75,0x00,0x10,0x02,0x75,0x00,0xb0,0xe7,0xdd,0xef,0x05,0xd0,0x00,0x3e,
-0x13,0x46,0xf0,0x4d,0x52,0x00,0xc4,0x2f,0x04,0xe1,0x11,0x4f,0x00,0x03,0xf0,0x1f,
-0xff,0xff,0xc0,0x7b,0x0f,0x11,0x30,0x26,0x04,0x11,0x21,0x10,0x31,0x24,0xef,0xd0,
-0x60,0x06,0x11,0x12,0xc8,0x0d,0x02,0x9d,0x44,0x03,0xa9,0x07,0x24,0x1f,0x41,0x05,
-0x10,0x07,0xea,0x35,0x00,0x87,0x79,0xd0,0xa1,0x89,0x99,0x70,0x04,0xe0,0x3e,0x4e,
-0x77,0x8f,0x00,0x4e,0x04,0xbc,0x02,0x30,0x04,0xe0,0x4e,0xbc,0x02,0x20,0x3e,0x04,
-0xbc,0x02,0xe1,0x03,0xe0,0x4e,0x5c,0x00,0x1f,0xbb,0xce,0x04,0xe5,0xc0,0x01,0xf6,
-0x68,0x0d,0x00,0x00,0x1a,0x00,0x14,0xc0,0x1a,0x00,0xf1,0x02,0x00,0x3e,0x03,0xe5,
-0xe7,0x77,0xf1,0x03,0xe0,0x3e,0x19,0x99,0x98,0x00,0x3e,0x03,0xe0,0x7f,0x26,0x12,
-0x3e,0x6a,0x3f,0x07,0x0d,0x00,0x17,0x3b,0xd0,0x24,0x00,0x9a,0x08,0x30,0xbb,0xbb,
-0xc8,0x2a,0x07,0x50,0x77,0x79,0xe0,0x00,0x4f,0xf1,0x00,0x21,0x0f,0xff,0x66,0x01,
-0x24,0x11,0x5f,0x73,0x01,0x00,0xf1,0x00,0x10,0x3f,0x66,0x01,0xa0,0x19,0x9a,0xe0,
-0x3e,0x11,0x14,0xe1,0x89,0xae,0x01,0x8b,0x0a,0x03,0x3e,0x04,0x11,0x4d,0xfe,0x27,
-0x02,0x7f,0x05,0x25,0x00,0x3a,0x9a,0x08,0x17,0x30,0x28,0x1d,0x01,0x9a,0x08,0x18,
-0x20,0x66,0x01,0x01,0x13,0x15,0xd1,0x4e,0x5e,0x88,0x8a,0xe0,0x22,0x6f,0x5d,0x00,
-0x04,0xe3,0xff,0xff,0xd9,0x01,0x14,0x4f,0x06,0x00,0xf6,0x02,0x03,0xe1,0x88,0xae,
-0x4d,0x00,0x03,0xe1,0x78,0xae,0x3f,0xee,0xef,0xd0,0x00,0x4e,0x02,0x04,0x09,0x10,
-0x16,0x07,0x17,0x81,0xc8,0x20,0x00,0x02,0xeb,0x53,0x49,0xf4,0x7e,0x46,0x11,0x8c,
-0x7a,0x1c,0x11,0x4f,0x5d,0x31,0x10,0x7d,0x3c,0x07,0x00,0x77,0x1c,0x41,0x3b,0xee,
-0xdb,0x50,0xc0,0x1c,0x16,0x30,0x44,0x3c,0x12,0x4e,0xb6,0x39,0x22,0x04,0xe0,0x35,
-0x3c,0x12,0x5e,0x0f,0x00,0x1a,0x05,0x0f,0x00,0x01,0xec,0x04,0x00,0xf9,0x1e,0x04,
-0x16,0x2c,0x2e,0x03,0x90,0x97,0x1a,0x0e,0x52,0x24,0x02,0xf8,0x2b,0x12,0xef,0xfb,
-0x01,0x10,0x0e,0x9e,0x4a,0x02,0xe1,0x02,0x17,0x04,0x0f,0x00,0x32,0xdf,0xee,0xee,
-0x96,0x2b,0x22,0x3f,0x21,0xc0,0x51,0x03,0x52,0x24,0x2f,0x4f,0x32,0xf9,0x1e,0x07,
-0x03,0x8d,0x2e,0x00,0xca,0x0b,0x1f,0x15,0xad,0x3c,0x0b,0x29,0xa0,0x00,0x87,0x00,
-0x12,0xe0,0x78,0x00,0x12,0x3e,0x87,0x00,0x17,0x03,0x0f,0x00,0x50,0xdd,0xcc,0xcc,
-0xde,0xe0,0x16,0x20,0x3c,0x5f,0x54,0x31,0xf4,0x06,0x04,0x52,0x24,0x21,0x02,0x22,
-0x8a,0x1e,0x02,0x11,0x3b,0x08,0x2e,0x21,0x01,0x31,0x64,0x00,0xcd,0x49,0x22,0xf5,
-0x00,0x24,0x09,0x00,0x8e,0x04,0xd9,0x2b,0xe4,0x00,0x03,0xeb,0x10,0x00,0x07,0x81,
-0x00,0x00,0x01,0x85,0x53,0x3a,0x00,0x60,0x2d,0x52,0x4f,0x33,0x32,0x22,0x6e,0xb0,
-0x00,0x22,0x05,0xd0,0xb0,0x00,0x17,0x5d,0x0f,0x00,0x42,0x10,0x00,0x11,0x6d,0x08,
-0x10,0x2c,0xfe,0xa0,0xfe,0x00,0x12,0x7c,0x7f,0x21,0x52,0x62,0x55,0x55,0x57,0xf4,
-0xc4,0x20,0x1f,0x3f,0xdb,0x0f,0x11,0x19,0x00,0xb2,0x20,0x12,0xef,0x44,0x39,0x52,
-0x0f,0x52,0x22,0x22,0xb8,0xa8,0x3e,0x21,0x0a,0x80,0x38,0x3b,0x00,0xe7,0x0c,0x00,
-0x7d,0x24,0x00,0xe7,0x0c,0x5c,0x0c,0xee,0xee,0xee,0xd5,0x7f,0x00,0x15,0x08,0x0e,
-0x01,0x50,0x22,0x2d,0x82,0x22,0x22,0xe4,0x03,0x12,0xc6,0x44,0x04,0x22,0x0c,0x60,
-0xd7,0x0d,0x1e,0xc5,0xe5,0x30,0x02,0xe6,0x0d,0x06,0x07,0x20,0x07,0x95,0x01,0x22,
-0xff,0xa0,0x11,0x13,0x12,0x7a,0xd9,0x0f,0x10,0x07,0x0f,0x00,0x42,0x51,0x11,0x11,
-0x8a,0x0d,0x13,0x06,0x32,0x2e,0x12,0x06,0xa2,0x2f,0x81,0xd0,0x13,0x34,0xba,0x44,
-0x4f,0x73,0x32,0xb1,0x00,0x01,0x05,0x22,0x16,0xba,0x05,0x22,0x13,0xd0,0xdb,0x0e,
-0x03,0x05,0x22,0x12,0xd0,0x07,0x20,0x1b,0xd9,0x05,0x22,0x03,0xe6,0x0d,0x13,0xd4,
-0xd5,0x1a,0xc0,0x1a,0xaa,0xab,0x90,0x00,0x3e,0x4f,0x56,0x67,0xf0,0x00,0x3e,0xda,
-0x04,0x0a,0x06,0x00,0x1f,0x4d,0x06,0x00,0x06,0x10,0x03,0x24,0x00,0xa8,0x66,0x68,
-0xf0,0x00,0x3e,0x1a,0xaa,0x99,0x70,0x00,0x5f,0x0d,0x17,0x2f,0x0c,0x00,0x17,0x2e,
-0xde,0x25,0x14,0x19,0x4a,0x05,0x2e,0x22,0x25,0xbf,0x05,0x0a,0x59,0x04,0x00,0xbf,
-0x05,0x01,0xe8,0x03,0x20,0x3f,0x00,0x5c,0x0f,0x03,0xcd,0x01,0x12,0x05,0x27,0x0a,
-0x11,0x10,0xd8,0x00,0x18,0xfd,0x9f,0x3e,0x1e,0x5e,0x0d,0x00,0x23,0x03,0xa0,0x34,
-0x06,0x01,0x75,0x00,0x12,0xf1,0xbf,0x05,0x21,0x15,0xd0,0xb6,0x18,0x00,0x75,0x00,
-0x00,0x0d,0x00,0x00,0x5b,0x18,0x0e,0xbf,0x05,0x06,0xc4,0x15,0x02,0x0b,0x12,0x01,
-0xbf,0x05,0x01,0x5b,0x00,0x00,0xd4,0x1c,0xb5,0x23,0x44,0x44,0x47,0xf0,0x00,0x1f,
-0xfe,0xee,0xee,0xe9,0xbf,0x05,0x39,0x51,0x22,0x22,0xbf,0x05,0x11,0x29,0x75,0x00,
-0x12,0x04,0xea,0x00,0x11,0x4f,0xdd,0x00,0x12,0x04,0xea,0x00,0x05,0x0d,0x00,0x00,
-0x75,0x00,0x02,0xa9,0x06,0x12,0x04,0xea,0x00,0x11,0x4f,0xea,0x00,0x11,0x04,0x97,
-0x05,0x02,0x1f,0x35,0x30,0xf1,0x01,0x80,0x06,0x14,0x02,0x54,0x01,0x02,0x66,0x5f,
-0x21,0xc4,0xf9,0x3e,0x4d,0xc0,0x02,0xdb,0x00,0x00,0x3e,0xa0,0x00,0x01,0xbd,0x10,
-0x04,0x40,0x0b,0x2f,0x07,0x5f,0x01,0x0f,0x75,0x00,0x1b,0x16,0x4e,0x75,0x00,0x02,
-0x3a,0x4d,0x10,0x8b,0xd2,0x1a,0x11,0x01,0x49,0x05,0x21,0x00,0xac,0x48,0x4e,0x21,
-0x0c,0x70,0xcc,0x01,0x10,0xba,0xce,0x1a,0x00,0x4b,0x05,0x10,0x37,0x17,0x63,0x33,
-0xbe,0xed,0xa4,0x85,0x1c,0x03,0x57,0x0d,0x81,0x6d,0x33,0x26,0xe0,0x00,0x3f,0x06,
-0xc0,0xc7,0x01,0x32,0x6c,0x00,0x03,0x0d,0x00,0x00,0xc7,0x01,0x11,0x5c,0x0d,0x00,
-0x30,0x03,0xff,0xff,0xfb,0x01,0x01,0xb6,0x05,0x12,0x3e,0x8f,0x03,0x10,0x40,0x41,
-0x56,0x15,0xee,0x20,0x02,0x00,0x60,0x49,0x10,0xda,0x20,0x2c,0x31,0x34,0xaf,0x70,
-0xf1,0x02,0x00,0xe4,0x3e,0xb0,0x7e,0xff,0x71,0x00,0x00,0x6c,0xfb,0x50,0x5b,0xfb,
-0x50,0xd0,0x09,0x22,0x01,0x56,0x3d,0x52,0x00,0x66,0x09,0x10,0x05,0xf8,0x15,0x60,
+0x20,0xef,0xff,0x87,0x00,0x00,0x16,0x01,0x35,0x00,0x3c,0x00,0x01,0x00,0xd1,0x1c,
+0xcc,0xcc,0xdd,0xd6,0x00,0x00,0x00,0x44,0x44,0x44,0xdf,0x40,0x98,0x01,0x21,0xde,
+0x30,0x89,0x02,0x11,0xff,0x0c,0x02,0xf0,0x00,0x4d,0xe8,0xed,0x40,0x00,0x00,0x04,
+0xce,0x70,0x00,0x7e,0xc2,0x00,0x00,0x54,0x19,0x00,0x02,0x47,0x02,0xf0,0x24,0x30,
+0x01,0x70,0x66,0x66,0x50,0x0e,0x30,0x3e,0x4f,0x99,0xaf,0x00,0xe3,0x03,0xe5,0xd0,
+0x00,0xf0,0x0e,0x30,0x3e,0x5d,0x00,0x1f,0x00,0xf3,0x03,0xe5,0xd0,0x01,0xf0,0x0f,
+0x30,0x3e,0x5c,0x00,0x1f,0x00,0xf6,0x47,0xe5,0xc0,0x01,0xf0,0x0f,0xdc,0xde,0x5c,
+0x00,0x1f,0x27,0x00,0x20,0xc0,0x01,0x27,0x00,0x03,0x0d,0x00,0xd0,0xe8,0x78,0xf1,
+0x0e,0x30,0x3e,0x18,0x88,0x98,0x00,0xe3,0x03,0xe0,0x86,0x02,0x20,0x30,0x3e,0x5b,
+0x00,0x09,0x0d,0x00,0x32,0xd3,0x03,0xe0,0x0a,0x01,0x00,0x05,0x00,0xf0,0x1b,0x50,
+0x01,0x42,0xee,0xef,0xe1,0x0f,0x40,0x7f,0x5e,0x22,0x2e,0x30,0xe4,0x06,0xf5,0xd0,
+0x00,0xe3,0x0e,0x50,0x6f,0x5d,0x00,0x0e,0x30,0xd7,0x27,0xf6,0xc0,0x00,0xe3,0x0d,
+0xff,0xff,0x5c,0x00,0x0e,0x30,0xd5,0x08,0xf5,0x0d,0x00,0xf4,0x00,0x50,0x8f,0x4f,
+0xee,0xff,0x10,0xd5,0x08,0xf0,0x22,0x22,0x00,0x08,0x30,0x7d,0xf2,0x00,0x51,0x1d,
+0x00,0x00,0x00,0x59,0x71,0x03,0xf1,0x00,0x07,0xc0,0x00,0x2f,0xfe,0xee,0xee,0xfc,
+0x00,0x02,0xf4,0x44,0x44,0x38,0xc0,0x8c,0x03,0xe1,0x6c,0x00,0x02,0xf1,0x11,0x11,
+0x17,0xc0,0x00,0x0e,0xff,0xff,0xff,0xf7,0x75,0x00,0xe2,0x02,0x82,0xee,0xef,0xe2,
+0x0f,0x40,0x5e,0x5e,0x22,0x2f,0x30,0xe4,0x04,0x75,0x00,0x10,0x4f,0x75,0x00,0x28,
+0xd6,0x15,0x75,0x00,0x12,0x04,0x75,0x00,0xe0,0x4f,0x4f,0xee,0xff,0x20,0xd5,0x04,
+0xe0,0x22,0x22,0x10,0x0b,0x40,0x4e,0xb1,0x01,0x71,0x20,0x03,0xc0,0x00,0x00,0x00,
+0xa9,0x7d,0x00,0x20,0x0f,0x60,0x06,0x00,0x30,0x08,0xfe,0x20,0xf7,0x01,0xf1,0x08,
+0xf5,0x9e,0x30,0x00,0x00,0x06,0xf7,0x00,0x7f,0x60,0x00,0x09,0xf5,0x00,0x00,0x4e,
+0x70,0x00,0x71,0x00,0x00,0x00,0x15,0x29,0x00,0xd0,0x81,0x7a,0xaa,0xba,0x10,0x00,
+0xe3,0xd9,0x66,0x5f,0x30,0x00,0xe3,0x7c,0x04,0x09,0x06,0x00,0xe4,0xe4,0xe3,0x00,
+0x0e,0x3a,0xcc,0xf4,0xe3,0x00,0x0e,0x34,0x65,0xf4,0xe3,0x12,0x00,0x01,0x06,0x00,
+0x00,0xf0,0x01,0xc1,0xe8,0x66,0x6f,0x30,0x00,0xe4,0x7a,0xaa,0x99,0x10,0x00,0xe4,
+0x4e,0x00,0x02,0x06,0x00,0x1d,0xe3,0x06,0x00,0x12,0x10,0x75,0x04,0xf3,0x08,0x02,
+0xbb,0xbb,0xc9,0x00,0x03,0xf0,0x5e,0x76,0x69,0xe0,0x00,0x3f,0x05,0xd0,0x00,0x4e,
+0x00,0x03,0xf0,0x5d,0x00,0x04,0x0d,0x00,0xf0,0x0a,0x4f,0xff,0xf0,0x5d,0x00,0x03,
+0xe0,0x12,0x4f,0x04,0xd0,0x00,0x3e,0x00,0x03,0xf0,0x3e,0x44,0x46,0xe0,0x00,0x3f,
+0x01,0xcc,0xcc,0x34,0x00,0x01,0x41,0x00,0x11,0x3e,0x4a,0x00,0x21,0x03,0xe0,0x48,
+0x04,0x48,0x2d,0x00,0x00,0xe5,0x55,0x04,0x02,0x0d,0x00,0xc2,0x0d,0xfe,0xee,0xee,
+0xff,0x30,0x00,0x13,0x33,0x33,0x32,0x10,0xd1,0x01,0x40,0x02,0xee,0xef,0xfc,0x75,
+0x00,0x51,0x33,0x25,0xe0,0x00,0x2f,0x75,0x00,0x10,0x02,0x75,0x00,0xb0,0xe7,0xdd,
+0xef,0x05,0xd0,0x00,0x3e,0x13,0x46,0xf0,0x4d,0x52,0x00,0xc0,0x2f,0x04,0xe1,0x11,
+0x4f,0x00,0x03,0xf0,0x1f,0xff,0xff,0xc0,0x68,0x00,0x01,0x7c,0x02,0x01,0x26,0x04,
+0x71,0x21,0x00,0x01,0xff,0xff,0xff,0xef,0xeb,0x05,0x00,0xe1,0x02,0xe1,0x12,0x33,
+0x33,0x36,0xe0,0x00,0x1f,0xff,0xff,0xff,0xfa,0x00,0x01,0xf2,0x16,0x00,0xd6,0x1f,
+0x41,0x22,0x23,0x33,0x00,0x00,0xdf,0xff,0xff,0xff,0xe3,0x00,0x01,0x00,0xf0,0x00,
+0x15,0x01,0xa1,0x89,0x99,0x70,0x04,0xe0,0x3e,0x4e,0x77,0x8f,0x00,0x4e,0x04,0xbc,
+0x02,0x30,0x04,0xe0,0x4e,0xbc,0x02,0x20,0x3e,0x04,0xbc,0x02,0xe1,0x03,0xe0,0x4e,
+0x5c,0x00,0x1f,0xbb,0xce,0x04,0xe5,0xc0,0x01,0xf6,0x68,0x0d,0x00,0x00,0x1a,0x00,
+0x14,0xc0,0x1a,0x00,0xf1,0x01,0x00,0x3e,0x03,0xe5,0xe7,0x77,0xf1,0x03,0xe0,0x3e,
+0x19,0x99,0x98,0x00,0x3e,0x03,0x80,0x06,0x21,0xd0,0x3e,0x30,0x03,0x08,0x0d,0x00,
+0x13,0x3b,0xbc,0x02,0x11,0x02,0x06,0x00,0xe0,0x16,0x02,0xbb,0xbb,0xc8,0x00,0x04,
+0xf0,0x5e,0x77,0x79,0xe0,0x00,0x4f,0xf1,0x00,0x21,0x0f,0xff,0x66,0x01,0x24,0x11,
+0x5f,0x73,0x01,0x00,0xf1,0x00,0x10,0x3f,0x66,0x01,0xe2,0x19,0x9a,0xe0,0x3e,0x11,
+0x14,0xe1,0x89,0xae,0x01,0xff,0xff,0xfb,0x00,0x3e,0x04,0x00,0x53,0x05,0x31,0x20,
+0x00,0x00,0x7f,0x05,0x00,0xdc,0x06,0x22,0x01,0xf3,0xe4,0x00,0x01,0xaf,0x03,0x03,
+0x0d,0x00,0x10,0x0f,0x66,0x01,0x18,0x20,0x66,0x01,0xf1,0x03,0x18,0x99,0x99,0x70,
+0x00,0x4e,0x5e,0x88,0x8a,0xe0,0x22,0x6f,0x5d,0x00,0x04,0xe3,0xff,0xff,0xd9,0x01,
+0x14,0x4f,0x06,0x00,0xf0,0x02,0x03,0xe1,0x88,0xae,0x4d,0x00,0x03,0xe1,0x78,0xae,
+0x3f,0xee,0xef,0xd0,0x00,0x4e,0x02,0x20,0x04,0x12,0x4e,0xb1,0x00,0xf0,0x06,0x00,
+0x00,0x18,0xbd,0xc8,0x20,0x00,0x02,0xeb,0x53,0x49,0xf4,0x00,0x0a,0xb0,0x00,0x00,
+0x8c,0x00,0x0d,0x70,0x9c,0x04,0x50,0x0b,0x90,0x00,0x00,0x7d,0x3c,0x07,0xf0,0x02,
+0x38,0xf6,0x00,0x00,0x3b,0xee,0xdb,0x50,0x00,0x02,0x22,0x22,0x22,0x30,0x00,0x00,
+0x04,0xbf,0x04,0x12,0x90,0x41,0x00,0x10,0x99,0x95,0x07,0x01,0x61,0x05,0x22,0x00,
+0x5e,0x0f,0x00,0x1a,0x05,0x0f,0x00,0x01,0xec,0x04,0x20,0x80,0x00,0x97,0x05,0x02,
+0x64,0x05,0x22,0x03,0x90,0xa0,0x01,0x13,0x6d,0x0c,0x07,0x00,0xdb,0x01,0x91,0x24,
+0x44,0x44,0x9d,0x44,0x44,0x44,0x09,0xdd,0x01,0x00,0x11,0xd2,0x28,0x05,0x52,0x31,
+0x00,0x00,0x00,0xef,0xfb,0x01,0x21,0x0e,0x40,0x18,0x01,0x00,0xe1,0x02,0x17,0x04,
+0x0f,0x00,0x40,0xdf,0xee,0xee,0xff,0x75,0x03,0x44,0x22,0x3f,0x21,0x10,0x5f,0x07,
+0x00,0xa4,0x00,0x61,0x4f,0x32,0x22,0x22,0x08,0xff,0x01,0x00,0x2b,0xf2,0x00,0x01,
+0x00,0xc3,0x4f,0xff,0xff,0xff,0xfe,0x00,0x00,0x00,0x12,0x22,0x22,0x15,0x8e,0x07,
+0x04,0x86,0x05,0x0a,0x0f,0x00,0x39,0x02,0xa0,0x00,0x87,0x00,0x12,0xe0,0x78,0x00,
+0x12,0x3e,0x87,0x00,0x17,0x03,0x0f,0x00,0x40,0xdd,0xcc,0xcc,0xde,0xd4,0x06,0x4c,
+0x44,0x5f,0x54,0x31,0xf4,0x06,0x13,0x07,0x87,0x00,0x43,0x02,0x22,0x21,0x11,0x01,
+0x01,0x13,0x91,0x1e,0x00,0x02,0x86,0x07,0x22,0x0a,0xf4,0x06,0x01,0x20,0xfa,0xf5,
+0x07,0x00,0x30,0x07,0xf5,0x06,0x8e,0x04,0xd5,0x2b,0xe4,0x00,0x03,0xeb,0x10,0x00,
+0x07,0x81,0x00,0x00,0x01,0x85,0xbb,0x00,0xd2,0x02,0xef,0xff,0xff,0xff,0xb0,0x00,
+0x00,0x4f,0x33,0x32,0x22,0x6e,0xb0,0x00,0x22,0x05,0xd0,0xb0,0x00,0x17,0x5d,0x0f,
+0x00,0x70,0x10,0x00,0x11,0x6d,0x00,0x00,0x02,0xe8,0x00,0x1c,0xa0,0xfe,0x00,0xe0,
+0x7c,0xcc,0xcc,0xcc,0xcc,0xdd,0xde,0x62,0x55,0x55,0x57,0xf4,0x44,0x44,0x54,0x02,
+0x12,0x3f,0x19,0x00,0x03,0xe3,0x03,0x0c,0x0f,0x00,0x13,0x4e,0x38,0x00,0x18,0x20,
+0x45,0x00,0x00,0x87,0x00,0x90,0x60,0x00,0x00,0x0f,0x52,0x22,0x22,0xb8,0x00,0x06,
+0x09,0xb0,0x00,0x0a,0x80,0x00,0x00,0x0f,0x20,0x00,0x00,0xa8,0x00,0xaf,0x06,0xac,
+0x22,0x3b,0x80,0x00,0x00,0x0c,0xee,0xee,0xee,0xd5,0x7f,0x00,0x15,0x08,0x0e,0x01,
+0x50,0x22,0x2d,0x82,0x22,0x22,0xe4,0x03,0x12,0xc6,0x44,0x04,0x11,0x0c,0x32,0x05,
+0x31,0xf5,0x00,0xc5,0xe0,0x02,0x12,0x40,0x2f,0x00,0x22,0xf4,0x00,0x62,0x04,0x60,
+0xff,0xee,0xee,0xff,0x50,0x00,0xf0,0x02,0x29,0x33,0x20,0x95,0x01,0x00,0x44,0x07,
+0x00,0x27,0x03,0x20,0x7a,0x00,0x18,0x07,0x20,0x00,0x07,0x0f,0x00,0x50,0x51,0x11,
+0x11,0x8a,0x00,0x8d,0x09,0x34,0xff,0xfe,0x80,0x78,0x00,0x30,0x06,0xdd,0xdc,0xf8,
+0x00,0x81,0xd0,0x13,0x34,0xba,0x44,0x4f,0x73,0x32,0xb1,0x00,0x10,0xe4,0xf3,0x01,
+0xc2,0xba,0x44,0x4f,0x72,0x00,0x00,0x03,0xde,0xee,0xdd,0xde,0xd0,0x2b,0x00,0x12,
+0x6e,0xbc,0x07,0xd3,0x38,0xd0,0x00,0x00,0x3f,0xee,0xee,0xee,0xd9,0x00,0x00,0x04,
+0xf1,0x18,0x02,0xc2,0x42,0x22,0x33,0x44,0x00,0x00,0x01,0xdf,0xff,0xff,0xfe,0xd4,
+0x13,0x00,0xd0,0x18,0x1a,0xaa,0xab,0x90,0x00,0x3e,0x4f,0x56,0x67,0xf0,0x00,0x3e,
+0xda,0x04,0x0a,0x06,0x00,0x1f,0x4d,0x06,0x00,0x06,0x10,0x03,0x24,0x00,0xb7,0x66,
+0x68,0xf0,0x00,0x3e,0x1a,0xaa,0x99,0x70,0x00,0x3f,0x7c,0x01,0x17,0x2f,0x0c,0x00,
+0x12,0x2e,0x0c,0x08,0x01,0x06,0x00,0x14,0x19,0x4a,0x05,0x2e,0x22,0x25,0xbf,0x05,
+0x0a,0x59,0x04,0x00,0xbf,0x05,0x01,0xe8,0x03,0x54,0x3f,0x00,0x22,0x22,0x10,0xcd,
+0x01,0x12,0x05,0x27,0x0a,0x11,0x10,0xd8,0x00,0x15,0xfd,0x93,0x08,0x12,0x00,0xaa,
+0x03,0x0b,0x0d,0x00,0x23,0x03,0xa0,0x34,0x06,0x01,0x75,0x00,0x12,0xf1,0xbf,0x05,
+0x11,0x15,0xbf,0x05,0x11,0xf1,0x75,0x00,0x20,0x2f,0x15,0x68,0x00,0x1e,0x02,0xbf,
+0x05,0x03,0xbb,0x00,0x21,0x01,0x90,0xbf,0x05,0x12,0x42,0xbf,0x05,0x02,0x5b,0x00,
+0xe5,0x5f,0x00,0x00,0x23,0x44,0x44,0x47,0xf0,0x00,0x1f,0xfe,0xee,0xee,0xe9,0xbf,
+0x05,0x39,0x51,0x22,0x22,0xbf,0x05,0x11,0x29,0x75,0x00,0x12,0x04,0xea,0x00,0x11,
+0x4f,0xdd,0x00,0x12,0x04,0xea,0x00,0x05,0x0d,0x00,0x00,0x75,0x00,0x02,0xa9,0x06,
+0x12,0x04,0xea,0x00,0x11,0x4f,0xea,0x00,0x11,0x04,0x97,0x05,0x01,0xb6,0x02,0x30,
+0x03,0xf1,0x01,0xff,0x01,0x12,0x8e,0x54,0x01,0x11,0xf7,0x13,0x08,0xf0,0x03,0xc4,
+0xf9,0x00,0x00,0x00,0x2d,0xc1,0x02,0xdb,0x00,0x00,0x3e,0xa0,0x00,0x01,0xbd,0x10,
+0x04,0x69,0x02,0x17,0x62,0x5f,0x01,0x0f,0x75,0x00,0x1b,0x16,0x4e,0x75,0x00,0x91,
+0x00,0x00,0x17,0x00,0x00,0x01,0x8b,0xdc,0x82,0x87,0x0c,0x21,0x49,0xf4,0x87,0x0c,
+0x21,0x08,0xd0,0x87,0x0c,0x20,0x3f,0x00,0x87,0x0c,0x20,0x06,0xe0,0x4b,0x05,0x92,
+0x37,0xf7,0x00,0x00,0x03,0xbe,0xed,0xa4,0x00,0x34,0x00,0x30,0x04,0xff,0xff,0x75,
+0x00,0x81,0x6d,0x33,0x26,0xe0,0x00,0x3f,0x06,0xc0,0xc7,0x01,0x32,0x6c,0x00,0x03,
+0x0d,0x00,0x00,0xc7,0x01,0x11,0x5c,0x0d,0x00,0x30,0x03,0xff,0xff,0xfb,0x01,0x01,
+0xb6,0x05,0x12,0x3e,0x8f,0x03,0x65,0x40,0x00,0x00,0x5e,0xff,0xee,0x20,0x02,0xc1,
+0x2c,0xdd,0xdd,0xdd,0xda,0x00,0x00,0x34,0x44,0x34,0xaf,0x70,0xf1,0x02,0xf0,0x00,
+0x30,0x00,0x00,0x01,0x7e,0xff,0x71,0x00,0x00,0x6c,0xfb,0x50,0x5b,0xfb,0x50,0xd0,
+0x09,0x21,0x01,0x56,0x2f,0x00,0x30,0x60,0x00,0x04,0x0d,0x02,0x90,0x1f,0x10,0x00,
 0xf3,0x00,0x03,0xe0,0x01,0xf1,0x42,0x03,0x10,0x3e,0x2c,0x0d,0x10,0xf3,0x6c,0x00,
-0x11,0xf2,0x0f,0x00,0x00,0xce,0x03,0x10,0xfe,0x35,0x1a,0xb1,0xf5,0x33,0x0f,0x63,
-0x33,0x5e,0x00,0x0f,0xff,0xf5,0xe4,0x1e,0x00,0x00,0xf5,0x04,0x12,0x4d,0x97,0x25,
-0x20,0x04,0xd0,0x0f,0x00,0x30,0x52,0x11,0x6d,0x0f,0x00,0x69,0xae,0xff,0xfe,0x90,
-0x00,0xf2,0x42,0x3f,0x2e,0x00,0xf2,0xc1,0x16,0x02,0x12,0x1b,0x00,0x84,0x4a,0x10,
-0x07,0x71,0x0d,0x42,0x0d,0x40,0x0b,0x80,0xe7,0x0c,0x05,0x07,0x00,0xf0,0x00,0xfe,
-0xee,0xef,0x30,0x0a,0x92,0x10,0xf6,0x33,0x3f,0x30,0x0a,0xff,0xf7,0xe3,0xbc,0x3b,
-0xf1,0x00,0x80,0x00,0xe3,0x00,0x0f,0x20,0x0a,0x80,0x00,0xde,0xee,0xef,0x10,0x0b,
-0x70,0xf4,0x43,0x23,0x0a,0x70,0xd7,0x3c,0x04,0xfc,0x0c,0x1f,0x08,0xfc,0x0c,0x0d,
-0x18,0x40,0xfc,0x0c,0x20,0x01,0x60,0x65,0x4b,0x12,0xb2,0xd7,0x0b,0x31,0x0d,0x40,
+0x11,0xf2,0x0f,0x00,0x00,0xce,0x03,0xf1,0x01,0xfe,0xee,0xee,0xe0,0x00,0xf5,0x33,
+0x0f,0x63,0x33,0x5e,0x00,0x0f,0xff,0xf5,0xe4,0x1e,0x00,0x00,0xf5,0x04,0x30,0x4d,
+0x00,0x0f,0x01,0x0d,0x20,0x04,0xd0,0x0f,0x00,0x30,0x52,0x11,0x6d,0x0f,0x00,0x53,
+0xae,0xff,0xfe,0x90,0x00,0x6d,0x05,0x13,0x0f,0x2e,0x04,0x04,0x0f,0x00,0x02,0xd2,
+0x0a,0x00,0xa1,0x03,0x01,0xe3,0x04,0x00,0xbc,0x00,0x30,0x03,0x00,0x07,0x71,0x0d,
+0x42,0x0d,0x40,0x0b,0x80,0xe7,0x0c,0x05,0x07,0x00,0xf0,0x14,0xfe,0xee,0xef,0x30,
+0x0a,0x92,0x10,0xf6,0x33,0x3f,0x30,0x0a,0xff,0xf7,0xe3,0x00,0x0f,0x30,0x0a,0x80,
+0x00,0xe3,0x00,0x0f,0x20,0x0a,0x80,0x00,0xde,0xee,0xef,0x10,0x0b,0x70,0x00,0x07,
+0x01,0x22,0x0a,0x70,0x13,0x05,0x14,0x10,0xfc,0x0c,0x1f,0x08,0xfc,0x0c,0x0d,0x17,
+0x40,0xfc,0x0c,0x00,0x5f,0x0b,0x42,0x0d,0x30,0x00,0xb2,0xd7,0x0b,0x31,0x0d,0x40,
 0x04,0x5f,0x0b,0x10,0xd4,0x39,0x02,0x31,0xf9,0x77,0x7e,0x0f,0x00,0x30,0xa9,0x99,
 0xf3,0x6b,0x01,0x10,0xf3,0x01,0x0e,0x03,0xfc,0x0c,0x30,0x3e,0x22,0x10,0x89,0x00,
-0x20,0x03,0xe0,0x6a,0x1f,0x11,0xf1,0x0a,0x46,0x28,0x11,0x10,0x06,0x3b,0x22,0x01,
-0xb0,0xa0,0x06,0x12,0x4f,0x95,0x01,0x0c,0x51,0x06,0x07,0xfc,0x0c,0x13,0x31,0x73,
-0x06,0x00,0x75,0x33,0x26,0x0c,0x30,0xf3,0x0d,0x30,0xf4,0x11,0x1e,0x07,0x00,0x00,
-0xc3,0x15,0x30,0x0b,0xa4,0x41,0x7d,0x00,0x30,0x0b,0xfe,0xe6,0x05,0x01,0x60,0x0b,
-0x70,0x00,0xe4,0x11,0x1f,0xfa,0x0d,0x34,0xae,0xee,0xec,0xfa,0x0d,0x22,0x06,0x30,
-0x1c,0x40,0x02,0x92,0x07,0x07,0xfe,0x00,0x11,0x34,0x67,0x4b,0x21,0x05,0xfe,0x6d,
-0x28,0x24,0x05,0xf0,0x9e,0x3d,0x32,0x22,0x33,0x20,0xf4,0x36,0x19,0x90,0xe2,0x14,
-0x10,0x50,0x54,0x0a,0x12,0xa5,0x0c,0x01,0x40,0x0c,0x60,0x04,0xe0,0x47,0x36,0x10,
-0xc6,0xd0,0x00,0x00,0xe8,0x05,0x40,0x04,0xf4,0x43,0x0f,0xa6,0x05,0x70,0x4f,0xee,
-0xc0,0xe3,0x00,0x0d,0x50,0x6b,0x0c,0x30,0x41,0x11,0xd5,0x1e,0x00,0x35,0xae,0xee,
-0xed,0xf2,0x0c,0x11,0x29,0x52,0x41,0x30,0x02,0x22,0x10,0x97,0x05,0x32,0xd2,0xef,
-0xff,0x11,0x01,0x00,0x6c,0x1c,0x31,0x02,0x25,0xf0,0x9f,0x42,0x21,0xfe,0xeb,0x0f,
-0x00,0x12,0xf2,0xe2,0x04,0x31,0x0f,0x42,0x22,0xae,0x07,0x51,0xcf,0xff,0xe5,0x00,
-0x1c,0xac,0x39,0x30,0x00,0x03,0x80,0x11,0x02,0x31,0x30,0x05,0xd0,0x92,0x01,0x21,
-0x05,0xd0,0x13,0x01,0x20,0x05,0xe0,0x11,0x02,0xc0,0x40,0x05,0xe2,0x21,0xf5,0x33,
-0x3f,0x30,0x05,0xff,0xfd,0xe3,0x85,0x0d,0x11,0xe0,0x11,0x02,0x21,0x05,0xd0,0x11,
-0x02,0x21,0x05,0xd0,0x11,0x02,0x23,0x04,0xd0,0xbf,0x0d,0x00,0x87,0x03,0x20,0xcb,
-0x71,0x43,0x05,0x40,0xa5,0x45,0xaf,0x30,0x4c,0x51,0x01,0xb6,0x48,0x12,0xf4,0xa8,
-0x08,0x12,0xf6,0x66,0x1e,0x30,0x7f,0x62,0x13,0xb8,0x62,0x24,0x05,0xce,0x8a,0x03,
-0xf8,0x08,0x40,0x01,0x75,0x10,0x00,0x80,0x0f,0x00,0x4d,0xe5,0x00,0x2f,0x01,0xf0,
-0x04,0xdd,0x50,0x02,0xf0,0x1f,0x00,0x4d,0xd5,0x0d,0x00,0xf0,0x02,0xdf,0xff,0xff,
-0x01,0xf4,0x47,0xdd,0x61,0x14,0xe0,0x1f,0xdd,0xdd,0xd5,0x00,0x3e,0x00,0x1a,0x00,
-0x52,0x03,0xe0,0x0f,0x00,0x4d,0x0d,0x00,0x30,0xdc,0x95,0x58,0x0d,0x00,0x51,0x6b,
-0xbb,0xb7,0x00,0xf0,0x8e,0x00,0x12,0x0f,0x1f,0x0f,0x02,0xa8,0x39,0x36,0x0f,0x10,
-0x4e,0x0d,0x00,0x04,0xc7,0x1f,0x70,0x00,0x60,0x3b,0x00,0x0a,0x30,0xe4,0x53,0x05,
-0xf1,0x11,0x0c,0x50,0xe4,0x01,0xf1,0x5c,0x00,0x0d,0x50,0xe5,0x01,0xf2,0x5e,0xaa,
-0xbf,0x50,0xd6,0x12,0xf2,0x5e,0x66,0x6e,0x40,0xdf,0xff,0xf1,0x5c,0x00,0x0e,0x40,
-0xd6,0x01,0x07,0x00,0xf2,0x02,0xd5,0x01,0xf1,0x4e,0x77,0x7f,0x30,0xd5,0x01,0xf1,
-0x18,0x99,0x98,0x00,0xd5,0x01,0xf1,0x0d,0x4f,0x10,0x80,0xf5,0x18,0x65,0x44,0x44,
-0x10,0x00,0x08,0xee,0xc9,0x06,0x2e,0x05,0xe0,0x07,0x00,0x04,0xcb,0x2b,0x03,0x82,
-0x09,0x20,0x08,0x81,0x30,0x49,0x20,0x2e,0xf3,0x3c,0x01,0x20,0x2e,0xf3,0x1f,0x01,
-0x11,0x2e,0x03,0x04,0x20,0x2e,0xf5,0x04,0x05,0xe0,0x2e,0xee,0xee,0xee,0xd0,0xaa,
-0xbe,0xe3,0x00,0x03,0xd0,0x66,0x8e,0xe3,0x0f,0x2c,0x18,0x2f,0x06,0x00,0x92,0xe9,
-0x77,0x79,0xd0,0x00,0x2f,0x59,0x99,0x99,0x51,0x1c,0x0e,0x82,0x1c,0x0a,0xbe,0x06,
-0x50,0x16,0x04,0xc0,0x00,0x1e,0xa4,0x06,0x00,0xf7,0x01,0x50,0x3f,0x05,0xc0,0x00,
-0x2f,0xcb,0x06,0x20,0x88,0x8a,0x0d,0x00,0x50,0xe8,0x88,0x9f,0x3a,0xab,0xea,0x04,
-0x42,0xf1,0x66,0x8f,0x05,0xf7,0x04,0x11,0x4c,0xd8,0x06,0x44,0x02,0xef,0xff,0xfa,
-0xe3,0x2c,0x02,0x7d,0x0c,0x12,0x04,0x7d,0x0c,0x1f,0x3d,0x7d,0x0c,0x11,0x41,0x30,
-0x00,0x04,0x04,0x68,0x00,0x11,0xf1,0x75,0x00,0xf2,0x07,0x2f,0x15,0xe6,0x77,0x8f,
-0x00,0x02,0xf1,0x5e,0x99,0x9a,0xf7,0xdd,0xef,0x15,0xc0,0x00,0x3f,0x13,0x45,0xf0,
-0x5c,0xbe,0x06,0xa4,0xc1,0x11,0x5e,0x00,0x03,0xf0,0x2e,0xee,0xee,0x90,0xbe,0x06,
-0x18,0x80,0x7d,0x0c,0x05,0xbe,0x06,0x11,0x12,0xbb,0x37,0x03,0x7d,0x0c,0x12,0xf4,
-0xbe,0x06,0x11,0x62,0x7d,0x0c,0x17,0xcf,0x7d,0x0c,0x11,0x03,0x05,0x00,0x41,0x05,
-0xd0,0x00,0x1d,0xec,0x0c,0x01,0x7c,0x00,0x30,0xc0,0x00,0x2f,0x7c,0x00,0xd0,0xbb,
-0xbc,0xf0,0x22,0x4f,0x15,0xe6,0x66,0x8f,0x5f,0xff,0xf0,0x5c,0x99,0x07,0x31,0x2f,
-0x04,0xc0,0x13,0x0d,0x30,0x3f,0xee,0xee,0x23,0x00,0x37,0x12,0x22,0x20,0xc5,0x1f,
-0x11,0xbd,0x2d,0x14,0x20,0x0f,0x85,0x3a,0x20,0x03,0xc1,0x02,0x24,0x0f,0x40,0x5b,
-0x21,0x00,0x0b,0x01,0x16,0xdc,0x3a,0x20,0x10,0x01,0xf1,0x00,0x11,0x2a,0x60,0x08,
-0x12,0x4f,0x06,0x00,0x30,0x4e,0x33,0x36,0x7d,0x15,0x50,0xcc,0xcd,0xf2,0xdd,0xef,
-0x72,0x08,0x31,0x44,0x7f,0x4d,0xc2,0x06,0x11,0x4d,0xd5,0x06,0x10,0x2f,0x3d,0x09,
-0x14,0x4e,0xe6,0x52,0x05,0x0e,0x27,0x31,0x2c,0x00,0x0e,0x62,0x00,0xb3,0x0e,0xff,
-0xfe,0xff,0xfe,0x00,0x0e,0x63,0x33,0x33,0x5e,0xe8,0x0a,0x20,0x0e,0x51,0x32,0x20,
-0x13,0x0b,0x16,0x52,0xa0,0x00,0x60,0x09,0x27,0x20,0x01,0xa0,0x0f,0x30,0xe3,0xa2,
-0x25,0x90,0xf3,0x0f,0x3d,0x50,0x02,0xf0,0x0f,0x30,0xf3,0x0d,0x00,0xd1,0xe3,0x0f,
-0x3d,0x72,0x24,0xf0,0x0e,0x30,0xf3,0xdf,0xee,0xff,0xbb,0x1a,0x00,0x40,0xf6,0x6e,
-0x30,0xe3,0x24,0x03,0x74,0xe3,0x0e,0x3d,0x50,0x03,0xe0,0x0e,0x0d,0x00,0x30,0x3c,
-0xa7,0x79,0x0d,0x00,0x61,0x48,0x99,0x85,0x00,0xe3,0x0e,0xaa,0x5a,0x02,0x9a,0x4f,
-0x31,0xf3,0x0e,0x30,0x46,0x06,0x11,0xe4,0x2e,0x32,0x03,0x0d,0x51,0x12,0x20,0x4c,
-0x02,0x62,0x40,0x3b,0x00,0x07,0x30,0x4d,0x31,0x03,0x40,0x4e,0x02,0xf1,0x5c,0x07,
-0x00,0x80,0x01,0xf2,0x5f,0xbb,0xbf,0x83,0x6e,0x01,0x31,0x03,0x22,0xed,0xee,0x46,
-0x03,0xf2,0x02,0x3f,0x01,0xf1,0x4c,0x00,0x0d,0x40,0x3f,0x01,0xf1,0x3f,0xff,0xfe,
-0x20,0x4f,0x01,0xf1,0xeb,0x0c,0x12,0xa0,0x49,0x31,0x10,0x10,0x31,0x05,0x01,0x8d,
-0x05,0x02,0xe3,0x1d,0x00,0x73,0x2d,0x40,0x37,0xe0,0x00,0x05,0x80,0x11,0x15,0xa0,
-0x34,0x03,0x11,0xf2,0x96,0x11,0x21,0x02,0xef,0x5d,0x1e,0x02,0xaf,0x07,0x31,0xc0,
-0x00,0x09,0x0a,0x08,0x00,0x60,0x01,0x00,0xc5,0x02,0xd2,0x0b,0xbd,0xf0,0x5d,0x44,
-0x46,0xf0,0x77,0x9f,0x05,0xfc,0xcc,0xdf,0xaf,0x07,0x02,0xdf,0x02,0xb3,0x3e,0x08,
-0x8a,0xe0,0x4c,0x00,0x03,0xe0,0x78,0xae,0x03,0xdc,0x0d,0x00,0xfd,0x0b,0x12,0x4d,
-0xc5,0x02,0x02,0x24,0x20,0x1f,0x3a,0xc5,0x02,0x07,0x16,0x40,0x37,0x32,0x27,0x00,
-0x03,0x3a,0x03,0xc2,0x33,0x6f,0x05,0xd1,0x22,0x4f,0x4e,0xee,0xf0,0x5f,0xff,0xff,
-0x68,0x00,0x12,0x3f,0x75,0x00,0x30,0xe3,0xbb,0xcf,0xc5,0x02,0x28,0x16,0x68,0xc5,
-0x02,0x2f,0x02,0xd0,0xc5,0x02,0x28,0x23,0x00,0x05,0x68,0x53,0x12,0xf3,0x0f,0x29,
-0x22,0x0f,0x30,0x22,0x48,0x52,0xf5,0x33,0x33,0x3d,0x60,0xc6,0x18,0x12,0xf5,0xe4,
-0x07,0x01,0x1e,0x00,0x12,0x20,0x1d,0x38,0x50,0xf4,0x22,0x21,0x1e,0x40,0x70,0x67,
-0x03,0x2c,0x5b,0x04,0x01,0x00,0x16,0x4c,0xec,0x0d,0x00,0x80,0x00,0x70,0x8d,0x33,
-0x33,0x33,0x0a,0xff,0xff,0x5d,0x19,0x11,0xe2,0x65,0x29,0x12,0x23,0x72,0x3b,0x00,
-0xc1,0x0b,0x56,0x0c,0x72,0x22,0x22,0x8a,0xce,0x1e,0x22,0x0d,0x50,0xdf,0x0b,0x92,
-0xc7,0x22,0x22,0x28,0xa0,0x00,0x00,0x09,0xef,0x04,0x59,0x05,0x77,0x07,0x17,0x5e,
-0x57,0x0c,0x12,0x01,0xb2,0x45,0x0f,0xec,0x0d,0x23,0x00,0x87,0x00,0x17,0x24,0x87,
-0x00,0x12,0x60,0x78,0x00,0x13,0xdf,0x87,0x00,0x10,0x61,0x2b,0x17,0x01,0xe5,0x00,
-0x10,0x07,0xcb,0x67,0x03,0x34,0x17,0x46,0x01,0x27,0xe2,0x21,0x36,0x0b,0x8b,0x33,
-0x32,0x27,0xe2,0x22,0x22,0x20,0x7f,0x12,0x48,0x2f,0x0b,0x40,0xc4,0x1a,0x09,0x21,
-0x0d,0xff,0x6f,0x53,0x04,0xde,0x0c,0x52,0x09,0x40,0x00,0x00,0x2b,0x87,0x00,0x10,
-0x03,0x37,0x1f,0x02,0x64,0x4e,0x62,0x00,0xd8,0x55,0x55,0x57,0xe0,0x0e,0x01,0x12,
-0x3e,0x1d,0x01,0x11,0xef,0xfa,0x0e,0x35,0x5f,0x22,0x20,0xb0,0x0d,0x90,0x7f,0xfe,
-0xee,0xef,0xee,0xef,0xff,0x20,0x11,0x49,0x5d,0x16,0x11,0xa9,0x2c,0x07,0x08,0x0f,
-0x21,0x0f,0x30,0x0e,0x01,0x22,0x23,0xf2,0x02,0x2e,0x26,0xed,0x10,0xe5,0x2c,0x0a,
-0x46,0x1f,0x10,0x04,0x91,0x1c,0x06,0x0e,0x01,0x13,0x0d,0x95,0x01,0x1a,0xdf,0x95,
-0x01,0x1f,0xd7,0x95,0x01,0x04,0x13,0x4e,0xcf,0x31,0x11,0xfe,0xbe,0x49,0x01,0x01,
-0x00,0x00,0x17,0x00,0x13,0xd2,0x75,0x01,0x12,0x10,0xfc,0x2d,0x12,0xf7,0x08,0x23,
-0x21,0xe6,0xf8,0x25,0x01,0x30,0xe3,0x03,0xeb,0x16,0x25,0x51,0xc1,0x00,0x01,0xbe,
-0x20,0x27,0x68,0x26,0x00,0x53,0x40,0x02,0x12,0xd4,0xb1,0x52,0x00,0x3b,0x01,0x11,
-0xd5,0x7a,0x54,0x32,0x22,0x2d,0x50,0xa4,0x1c,0x12,0xf5,0x90,0x0f,0x22,0x0d,0x50,
-0xe3,0x09,0x10,0xd5,0x3e,0x74,0x30,0x54,0x44,0x4e,0x3a,0x42,0x46,0xcc,0xdd,0xcc,
-0xc1,0x3d,0x0f,0x10,0x11,0x83,0x31,0x21,0x33,0x09,0x08,0x2e,0x2f,0xee,0xd0,0x44,
-0x4d,0x07,0x0b,0xd5,0x1e,0x17,0x60,0x5e,0x45,0x00,0x01,0x03,0x26,0x06,0x90,0x1c,
-0x02,0x04,0xa3,0x02,0x12,0x62,0x1d,0x01,0x13,0xc5,0x3a,0x02,0x43,0xfe,0xee,0xed,
-0xe9,0x0a,0x1f,0x06,0x65,0x09,0x03,0x25,0x51,0x51,0x5c,0xcc,0xcd,0xde,0xed,0x36,
-0x30,0x21,0x00,0xa8,0xfe,0x00,0x32,0x50,0x0a,0x80,0x5a,0x59,0x21,0xa8,0x00,0x26,
-0x3a,0x28,0x02,0x10,0x9b,0x4b,0x00,0x23,0x03,0x02,0x7f,0x1c,0x04,0x33,0x0a,0x03,
-0x1b,0x3b,0x22,0x03,0xc0,0xf4,0x00,0x13,0x4d,0x95,0x01,0x12,0xd0,0x87,0x00,0x12,
-0x5d,0xa3,0x02,0x22,0x04,0xd0,0x88,0x2f,0x13,0xfb,0x34,0x31,0x00,0x15,0x2c,0x01,
-0xd3,0x21,0x21,0x06,0xef,0x70,0x22,0x15,0xe5,0xe1,0x00,0x43,0x22,0x26,0xe2,0x22,
-0x2a,0x03,0x25,0xff,0x10,0x01,0x1e,0x00,0x34,0x00,0x21,0x4f,0x20,0xbb,0x11,0x28,
-0xfe,0xd1,0xa7,0x16,0x10,0x23,0xdc,0x1f,0x10,0x2d,0x43,0x00,0x07,0x8e,0x3d,0x12,
-0xb5,0x33,0x3a,0x00,0x16,0x01,0x13,0x2e,0x16,0x01,0x12,0xe0,0xc8,0x03,0x16,0x4e,
-0xc9,0x02,0x13,0x0b,0x67,0x58,0x0f,0x8f,0x00,0x01,0x1c,0xe2,0x79,0x10,0x01,0x38,
-0x75,0x00,0xef,0x12,0x02,0x34,0x22,0x12,0x2f,0x2e,0x18,0x10,0x02,0x1e,0x31,0x07,
-0x19,0x45,0x12,0xf3,0x7c,0x1e,0x14,0x1e,0x4b,0x22,0x06,0xa5,0x01,0x21,0x0b,0x50,
-0x71,0x3b,0x22,0x00,0xc6,0xa4,0x02,0x25,0x2c,0x60,0xee,0x1e,0x22,0x00,0xd5,0xa9,
-0x00,0x22,0x0d,0x50,0x1e,0x00,0x50,0xd8,0x54,0x44,0x4d,0x50,0x1b,0x2a,0x37,0xdd,
-0xcc,0xc2,0xf4,0x1f,0x00,0x2d,0x02,0x12,0x32,0x57,0x04,0x00,0x4b,0x32,0x12,0xe4,
-0x12,0x2e,0x22,0x0e,0x30,0xd5,0x39,0x1a,0xe3,0x0f,0x00,0x03,0x10,0x20,0x12,0x07,
-0xa7,0x78,0x13,0x05,0x9d,0x3a,0x12,0xf3,0x91,0x02,0x00,0x72,0x03,0x13,0xd5,0x38,
-0x05,0x00,0xf2,0x29,0x02,0x38,0x05,0x22,0x01,0xf1,0x1e,0x00,0x21,0x1f,0x10,0xbe,
-0x02,0x13,0x01,0x38,0x05,0x14,0x0d,0xc8,0x3c,0x0e,0x01,0x00,0x00,0xb9,0x42,0x10,
-0xff,0x77,0x1f,0x14,0x31,0x1d,0x32,0x07,0x1c,0x03,0x22,0x04,0xc0,0x1c,0x03,0x13,
-0x4d,0x17,0x11,0x10,0xd0,0x92,0x55,0x32,0x22,0x22,0x6d,0x1c,0x03,0x10,0x05,0x1d,
-0x02,0x0a,0x0e,0x02,0x20,0x11,0x11,0xd9,0x20,0x01,0x9b,0x13,0x05,0x88,0x4f,0x03,
-0x8b,0x74,0x12,0x00,0xdf,0x1e,0x0c,0x0e,0x02,0x11,0x10,0x64,0x0c,0x00,0x7f,0x01,
-0x13,0x5f,0x20,0x06,0x03,0x0e,0x02,0x17,0x2e,0x0e,0x02,0x90,0x02,0x01,0x40,0x00,
-0x06,0x10,0x03,0xe0,0x5d,0x96,0x00,0x00,0x97,0x10,0x41,0x0d,0x40,0x03,0xf0,0x0d,
-0x00,0x11,0x2f,0x53,0x49,0x30,0x02,0xf0,0x5f,0x6f,0x00,0xa0,0x2f,0x05,0xe2,0x22,
-0x2e,0x30,0x02,0xf0,0x4e,0x00,0x57,0x1b,0x01,0xd4,0x19,0x05,0x0d,0x00,0x70,0xe2,
-0x11,0x1f,0x30,0x03,0xf0,0x2d,0x08,0x01,0x18,0x3f,0x8b,0x12,0x0e,0x0d,0x00,0x04,
-0x04,0x3c,0x51,0x15,0x04,0xc0,0x00,0x0e,0x96,0x07,0x12,0x01,0x96,0x07,0x11,0x1f,
-0x5b,0x0a,0x13,0x89,0x5b,0x0a,0x01,0x21,0x07,0x06,0x75,0x0a,0x20,0xe0,0x4c,0x45,
-0x00,0x27,0x4e,0x03,0x72,0x15,0x15,0x4e,0x96,0x07,0x11,0x40,0x35,0x19,0x09,0x2b,
-0x28,0x16,0xf4,0x96,0x07,0x09,0x72,0x15,0x08,0x75,0x00,0x40,0x3f,0x05,0xd1,0x22,
-0x89,0x07,0x05,0x96,0x07,0x15,0x2f,0x75,0x00,0x80,0x04,0xc1,0x11,0x4f,0x00,0x04,
-0xf0,0x2e,0x58,0x08,0x03,0x1e,0x27,0x02,0x5b,0x0a,0x02,0x5e,0x03,0x03,0xd8,0x16,
-0x14,0x6e,0x74,0x12,0x11,0x4f,0xe7,0x70,0x04,0xe3,0x37,0x01,0xdd,0x26,0x08,0xe2,
-0x47,0x05,0x3e,0x1c,0xd4,0x04,0x05,0x10,0x40,0x50,0x0f,0x40,0x00,0x3e,0x0c,0x43,
-0xe0,0xd3,0x08,0x00,0x13,0x0e,0x08,0x00,0x00,0xeb,0x49,0x04,0x08,0x00,0xf5,0x08,
+0x90,0x03,0xe0,0x00,0x0c,0xff,0xff,0xf1,0x00,0x3e,0xd4,0x06,0x05,0xff,0x01,0x00,
+0x3c,0x00,0x22,0x01,0xb0,0xa0,0x06,0x12,0x4f,0x95,0x01,0x0c,0x51,0x06,0x07,0xfc,
+0x0c,0x13,0x31,0x73,0x06,0x66,0x20,0x00,0xe3,0x00,0x0c,0x30,0xf3,0x0d,0x30,0xf4,
+0x11,0x1e,0x07,0x00,0x70,0xff,0xff,0xff,0x30,0x0b,0xa4,0x41,0x7d,0x00,0x30,0x0b,
+0xfe,0xe6,0x05,0x01,0x60,0x0b,0x70,0x00,0xe4,0x11,0x1f,0xfa,0x0d,0x34,0xae,0xee,
+0xec,0xfa,0x0d,0x82,0x06,0x30,0x00,0x00,0x33,0x33,0x33,0x44,0x92,0x07,0x07,0xfe,
+0x00,0xe3,0x34,0x44,0x44,0x4e,0x50,0x00,0x05,0xfe,0xee,0xee,0xed,0x10,0x00,0x05,
+0xff,0x03,0x51,0xf2,0x22,0x22,0x33,0x20,0x45,0x06,0xa0,0xfe,0x90,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0xf0,0x29,0x00,0x00,0x00,0x00,0x01,0x50,0x00,0x0e,0x30,
+0x00,0xa5,0x00,0x5e,0x00,0x00,0xf3,0x00,0x0c,0x60,0x04,0xe0,0x00,0x0f,0x41,0x11,
+0xc6,0x00,0x4e,0x00,0x00,0xff,0xff,0xff,0x60,0x04,0xf4,0x43,0x0f,0x30,0x00,0xc6,
+0x00,0x4f,0xee,0xc0,0xe3,0x00,0x0d,0x50,0x04,0xe0,0x00,0x0e,0x41,0x11,0xd5,0x1e,
+0x00,0x71,0xae,0xee,0xed,0x20,0x04,0xe0,0x00,0x01,0x00,0xf0,0x01,0x29,0x00,0x00,
+0x01,0x22,0x21,0x02,0x22,0x10,0x00,0x00,0xef,0xff,0xd2,0xef,0xff,0x14,0x00,0xf1,
+0x01,0x4e,0x00,0x01,0xf0,0x00,0x00,0x02,0x25,0xf0,0x00,0x1f,0x00,0x00,0x0e,0xfe,
+0xeb,0x0f,0x00,0xf1,0x19,0xf2,0x00,0x00,0x00,0x2f,0x00,0x00,0x0f,0x42,0x22,0x00,
+0x02,0xf0,0x00,0x00,0xcf,0xff,0xe5,0x00,0x1c,0x00,0x00,0x40,0x00,0x01,0x00,0x03,
+0x80,0x00,0xe3,0x00,0x0d,0x30,0x05,0xd0,0x00,0xf3,0x00,0x0d,0x40,0x07,0x00,0xf1,
+0x20,0x0e,0x40,0x05,0xe0,0x00,0xfe,0xee,0xef,0x40,0x05,0xe2,0x21,0xf5,0x33,0x3f,
+0x30,0x05,0xff,0xfd,0xe3,0x00,0x0f,0x30,0x05,0xe0,0x00,0xe3,0x00,0x0f,0x20,0x05,
+0xd0,0x00,0xde,0xee,0xef,0x10,0x05,0xd0,0x00,0x02,0x22,0x21,0x00,0x04,0xd0,0x00,
+0xcd,0x00,0xf0,0x0c,0x40,0x00,0x00,0x01,0x8b,0xcb,0x71,0x00,0x00,0x00,0x3f,0xa5,
+0x45,0xaf,0x30,0x00,0x00,0xd8,0x00,0x00,0x09,0xb0,0x00,0x00,0xf4,0x00,0x00,0xad,
+0x00,0xf2,0x03,0xf6,0x00,0x00,0x07,0xd0,0x00,0x00,0x7f,0x62,0x13,0x8f,0x60,0x00,
+0x00,0x05,0xce,0xed,0xa4,0xc1,0x00,0xf8,0x08,0x40,0x01,0x75,0x10,0x00,0x80,0x0f,
+0x00,0x4d,0xe5,0x00,0x2f,0x01,0xf0,0x04,0xdd,0x50,0x02,0xf0,0x1f,0x00,0x4d,0xd5,
+0x0d,0x00,0xf0,0x02,0xdf,0xff,0xff,0x01,0xf4,0x47,0xdd,0x61,0x14,0xe0,0x1f,0xdd,
+0xdd,0xd5,0x00,0x3e,0x00,0x1a,0x00,0x52,0x03,0xe0,0x0f,0x00,0x4d,0x0d,0x00,0x30,
+0xdc,0x95,0x58,0x0d,0x00,0x51,0x6b,0xbb,0xb7,0x00,0xf0,0x8e,0x00,0x30,0x0f,0x00,
+0x4d,0x5b,0x00,0x11,0xf0,0x25,0x01,0x36,0x0f,0x10,0x4e,0x0d,0x00,0x30,0x00,0x00,
+0x04,0x05,0x00,0xf1,0x1d,0x20,0x00,0x60,0x3b,0x00,0x0a,0x30,0xe4,0x02,0xf1,0x5d,
+0x00,0x0c,0x50,0xe4,0x01,0xf1,0x5c,0x00,0x0d,0x50,0xe5,0x01,0xf2,0x5e,0xaa,0xbf,
+0x50,0xd6,0x12,0xf2,0x5e,0x66,0x6e,0x40,0xdf,0xff,0xf1,0x5c,0x00,0x0e,0x40,0xd6,
+0x01,0x07,0x00,0xf0,0x02,0xd5,0x01,0xf1,0x4e,0x77,0x7f,0x30,0xd5,0x01,0xf1,0x18,
+0x99,0x98,0x00,0xd5,0x01,0xf1,0x46,0x00,0xf2,0x01,0x41,0x00,0x80,0x00,0x01,0x33,
+0x33,0x44,0x44,0x10,0x00,0x08,0xee,0xee,0xdd,0xde,0x09,0x01,0x3e,0x05,0xe0,0x00,
+0x07,0x00,0x12,0x06,0x1c,0x00,0x21,0x03,0x90,0x07,0x00,0x80,0x08,0x81,0x00,0x02,
+0x90,0x00,0x2e,0xf3,0x3c,0x01,0x00,0x06,0x00,0x10,0xe0,0x06,0x00,0xf0,0x07,0x03,
+0xe0,0x00,0x2e,0xf5,0x22,0x25,0xe0,0x00,0x2e,0xee,0xee,0xee,0xd0,0xaa,0xbe,0xe3,
+0x00,0x03,0xd0,0x66,0x8e,0x06,0x00,0x28,0x00,0x2f,0x06,0x00,0xc1,0xe9,0x77,0x79,
+0xd0,0x00,0x2f,0x59,0x99,0x99,0x50,0x00,0x2f,0x4e,0x00,0x0e,0x06,0x00,0x12,0x2e,
+0x92,0x01,0x01,0x06,0x00,0x90,0x16,0x04,0xc0,0x00,0x1e,0x00,0x03,0xf0,0x5d,0xf7,
+0x01,0xb0,0x3f,0x05,0xc0,0x00,0x2f,0x00,0x03,0xf0,0x5e,0x88,0x8a,0x0d,0x00,0xf0,
+0x05,0xe8,0x88,0x9f,0x3a,0xab,0xf0,0x5c,0x00,0x03,0xf1,0x66,0x8f,0x05,0xc0,0x00,
+0x3e,0x00,0x03,0xf0,0x4c,0x8e,0x00,0x72,0x3f,0x02,0xef,0xff,0xfa,0x00,0x03,0xbb,
+0x00,0x41,0x3e,0x00,0x00,0x10,0xc3,0x01,0x81,0x0e,0x50,0x00,0x00,0x3d,0x00,0x00,
+0xe5,0x16,0x00,0x00,0x0d,0x00,0x14,0x00,0x0d,0x00,0xf1,0x04,0x0d,0xfe,0xee,0xee,
+0xff,0x30,0x00,0x13,0x33,0x33,0x32,0x10,0x00,0x00,0x00,0x30,0x00,0x04,0x04,0x68,
+0x00,0x11,0xf1,0x75,0x00,0xf0,0x07,0x2f,0x15,0xe6,0x77,0x8f,0x00,0x02,0xf1,0x5e,
+0x99,0x9a,0xf7,0xdd,0xef,0x15,0xc0,0x00,0x3f,0x13,0x45,0xf0,0x5c,0x5f,0x00,0xe2,
+0x2f,0x04,0xc1,0x11,0x5e,0x00,0x03,0xf0,0x2e,0xee,0xee,0x90,0x00,0x3f,0xb5,0x00,
+0xd2,0x80,0x00,0x02,0x33,0x33,0x33,0x21,0x00,0x01,0xff,0xff,0xff,0xef,0x82,0x00,
+0xf1,0x02,0x5f,0x00,0x00,0x12,0x33,0x33,0x37,0xf0,0x00,0x1f,0xff,0xff,0xff,0xfa,
+0x00,0x01,0xf4,0x16,0x00,0x50,0x1f,0x62,0x22,0x23,0x33,0xc9,0x02,0x52,0xff,0xff,
+0xe3,0x00,0x00,0x5f,0x01,0x01,0x05,0x00,0x73,0x05,0xd0,0x00,0x1d,0x00,0x02,0xf0,
+0x7c,0x00,0x30,0xc0,0x00,0x2f,0x7c,0x00,0xb0,0xbb,0xbc,0xf0,0x22,0x4f,0x15,0xe6,
+0x66,0x8f,0x5f,0xff,0x7c,0x00,0xd0,0xf0,0x00,0x2f,0x04,0xc0,0x00,0x4e,0x00,0x02,
+0xf0,0x3f,0xee,0xee,0x23,0x00,0x73,0x12,0x22,0x20,0x00,0x01,0xd0,0x00,0x01,0x00,
+0xb4,0xbd,0xdd,0xdd,0xde,0xa0,0x00,0x0f,0x85,0x44,0x44,0x7f,0xc1,0x02,0x20,0x0f,
+0x40,0x59,0x03,0x03,0x0d,0x00,0xd0,0x0e,0xdc,0xbb,0xcc,0xdd,0x00,0x00,0x24,0x55,
+0x54,0x43,0x10,0x01,0xf1,0x00,0x20,0x2a,0x4d,0x6e,0x00,0x12,0x4f,0x06,0x00,0xf0,
+0x04,0x4e,0x33,0x36,0xf0,0x00,0x4f,0x4f,0xcc,0xcd,0xf2,0xdd,0xef,0x4d,0x00,0x03,
+0xf0,0x44,0x7f,0x4d,0xee,0x00,0x20,0x4f,0x4d,0x3b,0x00,0x71,0x4f,0x2f,0xff,0xff,
+0xa0,0x00,0x4e,0x67,0x00,0x13,0x2a,0x6f,0x00,0x71,0x0d,0x40,0x00,0x00,0x2c,0x00,
+0x0e,0x62,0x00,0xb1,0x0e,0xff,0xfe,0xff,0xfe,0x00,0x0e,0x63,0x33,0x33,0x5e,0x12,
+0x00,0x90,0x3e,0x00,0x0e,0x51,0x11,0x11,0x4e,0x00,0x0b,0xfc,0x00,0x00,0x2d,0x00,
+0xf0,0x07,0x60,0x09,0x27,0x20,0x01,0xa0,0x0f,0x30,0xe3,0xd5,0x00,0x2f,0x00,0xf3,
+0x0f,0x3d,0x50,0x02,0xf0,0x0f,0x30,0xf3,0x0d,0x00,0xd1,0xe3,0x0f,0x3d,0x72,0x24,
+0xf0,0x0e,0x30,0xf3,0xdf,0xee,0xff,0xbb,0x1a,0x00,0x40,0xf6,0x6e,0x30,0xe3,0x24,
+0x03,0x74,0xe3,0x0e,0x3d,0x50,0x03,0xe0,0x0e,0x0d,0x00,0x30,0x3c,0xa7,0x79,0x0d,
+0x00,0x70,0x48,0x99,0x85,0x00,0xe3,0x0e,0x30,0xce,0x01,0x11,0x30,0x43,0x01,0x11,
+0xf3,0x0d,0x00,0x30,0x0f,0x20,0xe4,0x0d,0x00,0x42,0xd1,0x0d,0x30,0x00,0x2c,0x03,
+0x01,0x4c,0x02,0x62,0x40,0x3b,0x00,0x07,0x30,0x4d,0x31,0x03,0x40,0x4e,0x02,0xf1,
+0x5c,0x07,0x00,0x80,0x01,0xf2,0x5f,0xbb,0xbf,0x83,0x6e,0x01,0x31,0x03,0x22,0xed,
+0xee,0x46,0x03,0xf2,0x00,0x3f,0x01,0xf1,0x4c,0x00,0x0d,0x40,0x3f,0x01,0xf1,0x3f,
+0xff,0xfe,0x20,0x4f,0x2a,0x03,0xf3,0x00,0x16,0x00,0xa0,0x00,0x00,0x22,0x22,0x23,
+0x32,0x10,0x00,0x04,0xff,0xff,0xee,0xd8,0x01,0x00,0x92,0x03,0xc5,0x22,0x23,0x33,
+0x37,0xe0,0x00,0x05,0xff,0xff,0xfe,0xee,0xa0,0x34,0x03,0xc1,0xf2,0x22,0x22,0x33,
+0x30,0x00,0x02,0xef,0xff,0xff,0xee,0xe4,0x12,0x00,0x72,0x17,0x04,0xc0,0x00,0x09,
+0x00,0x04,0xd4,0x01,0x10,0x4f,0xc5,0x02,0xf2,0x00,0x0b,0xbd,0xf0,0x5d,0x44,0x46,
+0xf0,0x77,0x9f,0x05,0xfc,0xcc,0xdf,0x00,0x03,0xd4,0x01,0x10,0x3f,0xc5,0x02,0xd0,
+0x08,0x8a,0xe0,0x4c,0x00,0x03,0xe0,0x78,0xae,0x03,0xff,0xff,0xfb,0x64,0x00,0x52,
+0x11,0x11,0x00,0x00,0x4d,0xc5,0x02,0x11,0xd0,0xb8,0x02,0x1f,0x3a,0xc5,0x02,0x07,
+0x11,0x40,0xc5,0x02,0x12,0x20,0x4e,0x02,0x07,0x3a,0x03,0xc2,0x33,0x6f,0x05,0xd1,
+0x22,0x4f,0x4e,0xee,0xf0,0x5f,0xff,0xff,0x68,0x00,0x12,0x3f,0x75,0x00,0x30,0xe3,
+0xbb,0xcf,0xc5,0x02,0x28,0x16,0x68,0xc5,0x02,0x2f,0x02,0xd0,0xc5,0x02,0x28,0x21,
+0x00,0x05,0x5b,0x04,0x00,0x14,0x06,0xf1,0x0b,0x00,0x0d,0x50,0x00,0x00,0x0f,0x30,
+0x00,0x00,0xc5,0x00,0x00,0x00,0xf5,0x33,0x33,0x3d,0x60,0x00,0x00,0x0f,0xee,0xee,
+0xee,0xf5,0x00,0xd0,0x05,0x01,0x1e,0x00,0xf7,0x05,0x20,0x00,0x00,0xd5,0x00,0x00,
+0x00,0xf4,0x22,0x21,0x1e,0x40,0x00,0x00,0x0c,0xef,0xff,0xff,0xe2,0x00,0x01,0x00,
+0x25,0x4c,0x00,0x80,0x04,0x00,0x80,0x00,0xf2,0x13,0x8d,0x33,0x33,0x33,0x0a,0xff,
+0xff,0xee,0xee,0xef,0xff,0xe2,0x00,0x04,0x10,0x00,0x00,0x23,0x00,0x00,0x00,0xc6,
+0x00,0x00,0x07,0xa0,0x00,0x00,0x0c,0x72,0x22,0x22,0x8a,0x00,0x8d,0x00,0x12,0xa0,
+0x5e,0x00,0xf4,0x01,0x7a,0x00,0x00,0x00,0xc7,0x22,0x22,0x28,0xa0,0x00,0x00,0x09,
+0xef,0xff,0xff,0xe6,0xb6,0x01,0x00,0x01,0x00,0x10,0x5e,0xc9,0x04,0x11,0xff,0x01,
+0x00,0x31,0xf2,0x01,0x11,0x01,0x00,0x05,0x76,0x00,0x50,0x4f,0xff,0xff,0xff,0xfe,
+0x72,0x00,0x43,0x22,0x22,0x15,0xf0,0x13,0x00,0x12,0x00,0xf4,0x01,0x0a,0x0f,0x00,
+0x31,0x02,0xa0,0x00,0x87,0x00,0x17,0x24,0x87,0x00,0x12,0x60,0x78,0x00,0x13,0xdf,
+0x87,0x00,0x51,0x61,0x11,0x11,0x7b,0x00,0xe5,0x00,0x00,0x1e,0x00,0x00,0x07,0x03,
+0x10,0xf8,0x91,0x02,0x35,0x27,0xe2,0x21,0x87,0x00,0x92,0x00,0x33,0x32,0x27,0xe2,
+0x22,0x22,0x20,0x7f,0x8f,0x00,0x14,0x20,0x87,0x00,0x37,0x0b,0x40,0x00,0xe1,0x01,
+0x04,0xef,0x01,0x23,0x00,0xf5,0x76,0x03,0x60,0xff,0xee,0xee,0xff,0x70,0x00,0xf2,
+0x01,0x92,0x33,0x20,0x00,0x00,0x09,0x40,0x00,0x00,0x2b,0x87,0x00,0x00,0xfa,0x04,
+0xd2,0x0d,0xdc,0xcc,0xcc,0xde,0x00,0x00,0x00,0xd8,0x55,0x55,0x57,0xe0,0x0e,0x01,
+0x12,0x3e,0x1d,0x01,0x91,0xef,0xc0,0x00,0x00,0x00,0x22,0x5f,0x22,0x20,0x25,0x02,
+0x00,0xd0,0x00,0xe0,0x7f,0xfe,0xee,0xef,0xee,0xef,0xff,0x20,0x11,0x22,0x22,0x22,
+0x21,0x11,0x92,0x07,0x11,0x22,0x1e,0x00,0x01,0x1c,0x01,0x02,0x6d,0x00,0x21,0x0f,
+0x30,0x0e,0x01,0xd2,0x23,0xf2,0x00,0x00,0x3f,0xff,0xff,0xff,0xed,0x10,0x00,0x03,
+0xf1,0x1a,0x00,0xd2,0x3f,0x42,0x22,0x33,0x34,0x20,0x00,0x01,0xdf,0xff,0xff,0xfe,
+0xe8,0x0e,0x01,0x16,0x13,0x0e,0x01,0x13,0x0d,0x95,0x01,0x1a,0xdf,0x95,0x01,0x1f,
+0xd7,0x95,0x01,0x04,0x00,0x58,0x04,0xa1,0x07,0xee,0xee,0xef,0xfe,0xee,0xee,0xe2,
+0x13,0x33,0x01,0x00,0x00,0x17,0x00,0x13,0xd2,0x75,0x01,0x11,0x10,0x07,0x00,0x21,
+0x0c,0xf7,0x07,0x00,0x31,0x09,0xe6,0xf8,0x25,0x01,0xe0,0xe3,0x03,0xeb,0x10,0x00,
+0x00,0x4e,0xc1,0x00,0x01,0xbe,0x20,0x00,0x05,0x24,0x01,0x16,0x53,0x40,0x02,0x52,
+0xd4,0x00,0x00,0x0c,0x40,0x3b,0x01,0x00,0x67,0x02,0xb0,0xe6,0x22,0x22,0x2d,0x50,
+0x00,0x00,0x0e,0xff,0xff,0xff,0x46,0x01,0x12,0xe4,0x92,0x00,0x22,0x0e,0x40,0x1e,
+0x00,0xc5,0xe8,0x54,0x44,0x4e,0x40,0x00,0x00,0x09,0xcc,0xdd,0xcc,0xc1,0x42,0x00,
+0xa0,0x02,0x11,0x11,0x11,0x22,0x22,0x33,0x09,0xff,0xff,0xe5,0x03,0x1e,0xd0,0x0b,
+0x02,0x0b,0x0f,0x00,0x22,0x4e,0x00,0x09,0x06,0x16,0x60,0xc4,0x06,0x01,0x01,0x03,
+0x26,0x06,0x90,0x1c,0x02,0x04,0xa3,0x02,0x12,0x62,0x1d,0x01,0x13,0xc5,0x3a,0x02,
+0x40,0xfe,0xee,0xed,0xe9,0x72,0x00,0x03,0xf6,0x00,0x02,0x48,0x00,0x11,0x55,0x01,
+0x00,0x80,0x50,0x5c,0xcc,0xcd,0xde,0xed,0xdd,0xdc,0x02,0x01,0x11,0xa8,0xfe,0x00,
+0x40,0x50,0x0a,0x80,0x00,0xdf,0x02,0x02,0x0f,0x00,0x31,0x0d,0x60,0x02,0x1d,0x01,
+0x22,0xd6,0x00,0x23,0x01,0x00,0x23,0x03,0x86,0xa0,0x00,0x00,0x03,0x33,0x33,0x33,
+0x31,0x0e,0x01,0x52,0xc4,0x00,0x00,0x03,0xc0,0xf4,0x00,0x13,0x4d,0x95,0x01,0x12,
+0xd0,0x87,0x00,0x12,0x5d,0xa3,0x02,0x20,0x04,0xd0,0x3c,0x00,0x00,0x79,0x04,0x02,
+0x06,0x02,0xb0,0x00,0x00,0x02,0x21,0x11,0x11,0x11,0x12,0x22,0x06,0xef,0x00,0x01,
+0x25,0xee,0xe5,0xe1,0x00,0x43,0x22,0x26,0xe2,0x22,0x2a,0x03,0x22,0xff,0x10,0xaa,
+0x00,0x12,0xf2,0x34,0x00,0x40,0x4f,0x20,0x00,0x03,0x2c,0x01,0x16,0xd1,0x1b,0x01,
+0x80,0xf3,0x22,0x23,0x33,0x42,0x00,0x00,0x2d,0x43,0x00,0x16,0x80,0x8f,0x00,0x11,
+0xb5,0x6b,0x04,0x01,0x16,0x01,0x13,0x2e,0x16,0x01,0x12,0xe0,0xc8,0x03,0x16,0x4e,
+0xc9,0x02,0x00,0x32,0x03,0x1f,0xfc,0x8f,0x00,0x04,0x00,0x2b,0x04,0x02,0xb3,0x04,
+0x02,0xc9,0x02,0x01,0xd9,0x01,0x80,0xff,0x00,0x00,0x01,0xf3,0x22,0x22,0x21,0x4f,
+0x08,0x80,0x33,0x33,0x33,0x32,0x00,0x00,0x02,0xff,0x93,0x08,0x04,0x5e,0x08,0xa0,
+0x00,0x02,0xf3,0x33,0x33,0x33,0x30,0x00,0x00,0x1e,0x43,0x00,0x02,0x25,0x06,0x04,
+0xa5,0x01,0x20,0x0b,0x50,0x4b,0x01,0x01,0x7c,0x00,0x00,0xa4,0x02,0x20,0x2c,0x60,
+0x67,0x03,0x32,0xff,0xff,0xf6,0x1e,0x01,0x22,0x0c,0x60,0x3c,0x01,0x10,0xc6,0x58,
+0x03,0xb6,0x54,0x44,0x4d,0x50,0x00,0x00,0x08,0xcc,0xdd,0xcc,0xc2,0xad,0x01,0x10,
+0x11,0x2d,0x02,0x12,0x32,0x57,0x04,0x20,0xfe,0xd0,0x61,0x02,0x21,0x0d,0x50,0xa0,
+0x06,0x01,0x60,0x02,0x2a,0x00,0xe3,0x0f,0x00,0x12,0xf3,0xd3,0x03,0x43,0x07,0x00,
+0x00,0x61,0x38,0x05,0x12,0x40,0x38,0x05,0x22,0x0e,0x40,0x72,0x03,0x13,0xd5,0x38,
+0x05,0x42,0x50,0x00,0x00,0x1f,0x38,0x05,0x22,0x01,0xf1,0x1e,0x00,0x21,0x1f,0x10,
+0xbe,0x02,0x13,0x01,0x38,0x05,0x00,0xa5,0x00,0x2f,0xe1,0x00,0x01,0x00,0x04,0x10,
+0x9f,0xb3,0x06,0x32,0xff,0xff,0x31,0x50,0x03,0x18,0x20,0x1c,0x03,0x22,0x04,0xc0,
+0x1c,0x03,0x00,0x0e,0x02,0x12,0xef,0x0e,0x02,0x52,0x0e,0x52,0x22,0x22,0x6d,0x1c,
+0x03,0x10,0x05,0x1d,0x02,0x0a,0x0e,0x02,0x72,0x11,0x11,0x00,0x01,0x11,0x22,0x03,
+0xa9,0x04,0x15,0xf4,0x4b,0x00,0x11,0x12,0x1e,0x00,0x3e,0x00,0x2f,0xff,0x0e,0x02,
+0x01,0x33,0x07,0x10,0xff,0x7f,0x01,0x13,0x5f,0x20,0x06,0x03,0x0e,0x02,0x17,0x2e,
+0x0e,0x02,0x90,0x02,0x01,0x40,0x00,0x06,0x10,0x03,0xe0,0x5d,0x96,0x00,0x81,0x3f,
+0x05,0xd0,0x00,0x0d,0x40,0x03,0xf0,0x0d,0x00,0x90,0x2f,0x05,0xe0,0x00,0x0d,0x40,
+0x02,0xf0,0x5f,0x6f,0x00,0x90,0x2f,0x05,0xe2,0x22,0x2e,0x30,0x02,0xf0,0x4e,0x4b,
+0x01,0x10,0x2f,0xc9,0x08,0x06,0x0d,0x00,0x70,0xe2,0x11,0x1f,0x30,0x03,0xf0,0x2d,
+0x08,0x01,0x17,0x3f,0x12,0x02,0x0f,0x0d,0x00,0x01,0x12,0x00,0x58,0x05,0x51,0x15,
+0x04,0xc0,0x00,0x0e,0x96,0x07,0x12,0x01,0x96,0x07,0x11,0x1f,0x5b,0x0a,0x13,0x89,
+0x5b,0x0a,0x01,0x21,0x07,0x06,0x75,0x0a,0x20,0xe0,0x4c,0x45,0x00,0x14,0x4e,0x96,
+0x07,0x03,0xeb,0x03,0x02,0x96,0x07,0x00,0x92,0x01,0x15,0x3c,0x96,0x07,0x02,0x5e,
+0x00,0x16,0xf4,0x96,0x07,0x14,0x20,0x5b,0x0a,0x00,0x0c,0x03,0x08,0x75,0x00,0x40,
+0x3f,0x05,0xd1,0x22,0x89,0x07,0x05,0x96,0x07,0x15,0x2f,0x75,0x00,0xa4,0x04,0xc1,
+0x11,0x4f,0x00,0x04,0xf0,0x2e,0xfe,0xee,0x6e,0x09,0x12,0x02,0x5b,0x0a,0x02,0x5e,
+0x03,0x12,0xef,0xec,0x09,0x81,0x6e,0x00,0x00,0x23,0x33,0x33,0x38,0xd0,0x88,0x03,
+0x14,0xf9,0x84,0x04,0x20,0x4f,0x32,0x96,0x07,0x00,0x80,0x08,0x19,0xfe,0x4d,0x07,
+0xf4,0x01,0x06,0x00,0x00,0x04,0x05,0x10,0x40,0x50,0x0f,0x40,0x00,0x3e,0x0c,0x43,
+0xe0,0xd3,0x08,0x00,0x14,0x0e,0x08,0x00,0x34,0x50,0x00,0x3f,0x08,0x00,0xf5,0x08,
 0xef,0x43,0xfe,0xf3,0x0e,0x73,0x20,0x3f,0x3d,0x43,0xf3,0xe2,0x0e,0xff,0xd0,0x3f,
-0x0c,0x43,0xf0,0xe2,0x0e,0x40,0x00,0x08,0x00,0xff,0x05,0x0d,0x43,0xf0,0xe2,0x0d,
-0x40,0x00,0x2f,0x1d,0x32,0xf1,0xf2,0x0d,0x40,0x00,0x1e,0xfe,0x11,0xef,0xe0,0x1e,
-0x31,0x1c,0x00,0xf9,0x02,0xe7,0x0b,0x01,0x61,0x80,0xb1,0x2f,0x10,0x00,0x0f,0x13,
-0xd3,0xc0,0xe2,0x1f,0x08,0x00,0xf0,0x05,0xcc,0xd3,0xfc,0xf2,0x1f,0x54,0x30,0x0f,
-0x78,0xc3,0xd5,0xf2,0x1f,0xee,0xb0,0x0f,0x24,0xc3,0xc0,0xf2,0x18,0x00,0xc4,0x35,
-0xc3,0xc1,0xf1,0x1f,0x10,0x00,0x0b,0xff,0x81,0xef,0xd0,0x87,0x2e,0x11,0x0a,0x19,
-0x27,0x02,0x3f,0x24,0x12,0x0a,0xde,0x23,0x05,0x9a,0x05,0x00,0xf8,0x47,0x13,0x7f,
-0x89,0x01,0x23,0xe9,0x00,0xfd,0x5f,0x01,0xc3,0x7b,0x02,0xc4,0x5e,0x00,0xd8,0x05,
-0x00,0xcb,0x63,0x0a,0xa2,0x4d,0xf1,0x06,0x90,0x1a,0x07,0x08,0x30,0x2f,0x0f,0x11,
-0xf2,0xe0,0xb5,0x02,0xf0,0xf1,0x1f,0x2e,0x0b,0x50,0x2f,0x0f,0x21,0x0d,0x00,0xf1,
-0x00,0xf4,0x4f,0x2e,0x2c,0x50,0x2f,0x0f,0xee,0xf2,0xfe,0xf5,0x02,0xf0,0xf2,0x2e,
-0x1a,0x00,0x40,0x22,0xe1,0xe0,0xb5,0x0d,0x00,0x31,0x1e,0x0c,0x40,0x0d,0x00,0xe4,
-0xc4,0x02,0xf0,0xf6,0x7e,0x1e,0x4d,0x40,0x2f,0x09,0xcc,0x80,0xac,0xb1,0x72,0x28,
-0x08,0xc9,0x1d,0x12,0x2f,0x24,0x03,0x08,0x85,0x39,0x13,0x29,0xe9,0x06,0x13,0x5e,
-0xf3,0x10,0x13,0x4e,0x45,0x03,0x02,0x94,0x12,0x02,0xcd,0x00,0x13,0x05,0x08,0x00,
-0x22,0x09,0xf6,0x08,0x00,0x31,0x0e,0xcd,0x00,0xf1,0x60,0x31,0x4f,0x1e,0x40,0x61,
-0x5f,0x31,0xc9,0x07,0xc0,0xa2,0x21,0x30,0xe1,0x00,0xe5,0x08,0x00,0x00,0xef,0x54,
-0x00,0x08,0x00,0x10,0x6a,0xda,0x54,0x03,0x1d,0x19,0x0f,0xf1,0x60,0x16,0x12,0x07,
-0x81,0x08,0x22,0x03,0xf0,0xfc,0x04,0x12,0x3f,0x4c,0x18,0x21,0x02,0xf0,0xc1,0x29,
-0x00,0xc1,0x00,0x00,0xed,0x6c,0xe0,0x02,0xff,0xfd,0x00,0x5f,0x5f,0x40,0x00,0x2f,
-0x32,0x10,0x1e,0x60,0x5e,0xc5,0x1e,0x61,0x1d,0xa0,0x00,0x6e,0x20,0x2f,0x03,0x18,
-0x32,0x55,0x02,0xf0,0x42,0x1a,0x24,0x09,0x00,0x42,0x14,0x00,0xce,0x3e,0x08,0xd7,
-0x1c,0x06,0x38,0x14,0x0c,0x0f,0x00,0x13,0x03,0x83,0x16,0x13,0x2a,0x64,0x43,0x13,
-0x4f,0x09,0x09,0x13,0x3f,0xce,0x18,0x10,0x3f,0xd0,0x02,0x03,0x65,0x4b,0x22,0x0c,
-0xf6,0x08,0x00,0x10,0x5f,0xca,0x7c,0x60,0xee,0xe0,0x01,0xe7,0x07,0xe1,0x0f,0x01,
-0x61,0x0c,0xa0,0x00,0x8d,0x10,0x3e,0x07,0x4f,0x33,0x07,0x50,0x3e,0x0a,0x0c,0x13,
-0x3e,0xdb,0x00,0x13,0x3e,0xd5,0x08,0x18,0x2a,0xd8,0x60,0x0b,0x08,0x00,0x21,0x0f,
-0xfe,0xd0,0x4b,0x06,0xdf,0x30,0x11,0x10,0xf6,0x18,0x01,0x90,0x00,0x02,0x0a,0x40,
-0x03,0x15,0x4a,0x12,0xf2,0x08,0x00,0x22,0x07,0xf1,0xaf,0x01,0x31,0x0d,0xfa,0x00,
-0xda,0x5f,0x30,0x7e,0x3e,0x70,0xf8,0x1e,0x31,0x03,0xf4,0x03,0x20,0x62,0x40,0x2e,
-0x70,0x00,0x3e,0xf3,0x1b,0x67,0xb6,0x00,0x00,0x02,0x30,0x3d,0x6f,0x02,0x00,0x6d,
-0x21,0x13,0x2b,0x00,0x13,0x01,0x98,0x00,0x00,0xc2,0x25,0x00,0x08,0x00,0x48,0x43,
-0x33,0x32,0x5e,0x18,0x00,0x03,0x29,0x58,0x14,0x0d,0x4c,0x0d,0x13,0x00,0x90,0x00,
-0x13,0xc5,0x96,0x07,0x13,0xd5,0x37,0x02,0x03,0x3f,0x02,0x22,0x05,0xf0,0x08,0x00,
-0x40,0x0c,0xf8,0x00,0x00,0xec,0x4c,0x30,0x5f,0x5f,0x50,0x90,0x00,0x30,0x01,0xe6,
-0x05,0x9f,0x1f,0x00,0xab,0x01,0x10,0x5e,0xff,0x31,0x52,0xb9,0x00,0x00,0x04,0x50,
-0xcc,0x04,0x03,0x70,0x01,0x40,0x17,0xbd,0xb8,0x20,0x48,0x00,0x52,0xec,0x64,0x5a,
-0xf4,0x00,0x4f,0x7d,0x12,0x8d,0x5f,0x63,0x02,0x70,0x01,0x12,0x90,0xef,0x16,0x02,
-0xe2,0x19,0x00,0x4a,0x21,0x02,0x9a,0x60,0x01,0xc3,0x0e,0x10,0x16,0xc2,0x15,0x32,
-0x2f,0x00,0x5c,0x5c,0x55,0x10,0x5c,0x45,0x06,0x00,0x07,0x00,0x21,0x06,0xc0,0x07,
-0x00,0x21,0x08,0xa0,0x07,0x00,0xf1,0x01,0x0c,0xe0,0x00,0x3f,0x33,0x8c,0x00,0x0f,
-0xf4,0x00,0x3f,0xee,0xec,0x00,0x6d,0x8b,0x15,0x00,0xf0,0x0c,0xd6,0x1f,0x20,0x2f,
-0x00,0x5c,0x05,0xe0,0x09,0xa0,0x2f,0x00,0x5c,0x0e,0x40,0x01,0xf2,0x2f,0x00,0x5c,
-0x89,0x00,0x00,0x79,0x2f,0x00,0x5c,0xc0,0x55,0x00,0x54,0x00,0x08,0x07,0x00,0x17,
-0x5d,0x07,0x00,0x02,0x17,0x1d,0x00,0xda,0x5f,0x00,0xd7,0x5b,0x32,0x0e,0x30,0xb8,
-0x4f,0x5f,0x10,0xa8,0x87,0x05,0x30,0x0e,0x40,0xa9,0x41,0x03,0x60,0x0e,0x51,0xa9,
-0x00,0x09,0xf6,0x60,0x4e,0xf2,0x0c,0x00,0x1f,0x9f,0x20,0x0e,0x50,0xa8,0x00,0xbb,
-0x09,0xc0,0x0e,0x40,0xa8,0x08,0xe1,0x00,0xca,0x0e,0x40,0xa8,0x4e,0x20,0x00,0x0a,
-0x1e,0x40,0x14,0x2e,0x00,0x41,0x0a,0x02,0xe5,0x30,0x00,0x02,0x27,0x1f,0xdd,0x6f,
-0x56,0x02,0x19,0xe5,0x6a,0x18,0x12,0xa2,0xf9,0x0c,0x10,0x74,0xd4,0x08,0x32,0x0f,
-0x40,0xc7,0x7e,0x00,0x12,0xb8,0x7e,0x00,0x11,0xb8,0x5f,0x5e,0x51,0x51,0xb8,0x00,
-0x0a,0xf7,0x7e,0x00,0x30,0x2f,0x9f,0x20,0x15,0x00,0xd0,0xbb,0x08,0xd0,0x0e,0x40,
-0xb7,0x08,0xe1,0x00,0xbb,0x0e,0x40,0xb7,0x7e,0x00,0x35,0x1c,0x30,0xa6,0x12,0x02,
-0x90,0x3d,0xdd,0xdd,0xde,0xd2,0x00,0x00,0x6e,0x44,0x29,0x45,0x13,0x00,0x8f,0x07,
-0x0a,0x07,0x00,0x30,0x5f,0xcb,0xbb,0xea,0x2b,0x14,0x03,0x2e,0x45,0x30,0x03,0x00,
-0x43,0xfc,0x00,0x31,0x1f,0x20,0xa9,0x2a,0x61,0x20,0x20,0xa9,0x7e,0x00,0x50,0x0f,
-0x20,0x99,0x00,0x03,0xa9,0x15,0x10,0xa9,0x43,0x1e,0x00,0xd6,0x60,0x30,0x1f,0xae,
-0x10,0xcf,0x60,0xf2,0x05,0xbb,0x0a,0xb0,0x0f,0x20,0x99,0x08,0xe1,0x00,0xd9,0x0f,
-0x20,0x98,0x4e,0x20,0x00,0x1a,0x1f,0x20,0xa8,0xf6,0x03,0x15,0x97,0xb7,0x4a,0x40,
-0x03,0xcf,0xee,0xfc,0xe8,0x28,0x42,0x81,0x00,0x19,0xe0,0x4c,0x7f,0x11,0xe4,0xf8,
-0x01,0x00,0xf5,0x00,0xb6,0x1d,0xb4,0x12,0x5c,0xc0,0x00,0x00,0x01,0x9d,0xed,0xb6,
-0xbb,0x20,0x13,0x0b,0x39,0x80,0x13,0xd6,0x9f,0x63,0x51,0x30,0x00,0x04,0xfd,0xdb,
-0x91,0x7f,0x52,0x3f,0x54,0x30,0x00,0xdf,0x1a,0x44,0x21,0x6e,0x2d,0xfd,0x63,0xf2,
-0x06,0x3f,0x50,0x2e,0x60,0x03,0xfa,0xa8,0x2e,0x70,0x00,0x2e,0x50,0x3f,0x77,0x49,
-0x60,0x00,0x00,0x13,0x04,0xe0,0x0e,0x05,0x12,0x4e,0x0c,0x1b,0x02,0xa1,0x50,0x12,
-0x8e,0x1f,0x05,0x22,0x1e,0xf5,0x12,0x0d,0x21,0xd8,0xf6,0xe7,0x4d,0x32,0xe2,0x05,
-0xf9,0xd0,0x64,0x00,0x93,0x17,0x22,0x06,0x60,0x0d,0x55,0x01,0x9b,0x12,0x41,0x10,
-0x00,0x0a,0x50,0xbf,0x1e,0x11,0xc6,0x68,0x09,0x21,0x0d,0x60,0x0d,0x00,0x11,0xf4,
-0x0d,0x00,0x20,0x1f,0x40,0xc3,0x00,0x30,0x06,0xfa,0x0a,0x52,0x54,0xe0,0xac,0xf1,
-0x12,0x22,0xe4,0x00,0x1f,0x4b,0x80,0x00,0x0e,0x40,0x08,0xc0,0x77,0x61,0x30,0x02,
-0xf3,0x00,0x1c,0x61,0x10,0xb9,0x21,0x2c,0x6f,0xe4,0x3d,0x00,0x00,0x07,0x60,0x24,
-0x53,0x07,0x03,0x0d,0x00,0x03,0xac,0x22,0x02,0x33,0x37,0x11,0xd6,0x9c,0x01,0x21,
-0x0d,0x60,0x33,0x5a,0x10,0xd6,0x8a,0x32,0xf0,0x0f,0x35,0x5d,0x60,0x00,0x2f,0xd0,
-0x0a,0xdc,0xf5,0x00,0x0a,0xcd,0x80,0x00,0x0d,0x50,0x05,0xf2,0x2e,0x60,0x00,0xd5,
-0x03,0xf5,0x00,0x3f,0x50,0x0d,0x52,0xe6,0x34,0x08,0x22,0xd5,0x12,0x3a,0x5f,0x21,
-0x00,0x12,0x94,0x0a,0x1e,0x09,0xf9,0x5e,0x0e,0x85,0x30,0x11,0xb2,0x33,0x06,0x21,
-0x06,0x10,0x2f,0x23,0x11,0xf4,0x62,0x41,0x21,0x0e,0x40,0xf9,0x3e,0x10,0xe4,0xd5,
-0x3a,0xf0,0x0f,0x55,0x5e,0x40,0x00,0x3f,0xd0,0x1c,0xcc,0xf4,0x00,0x0b,0xac,0x90,
-0x00,0x0e,0x40,0x06,0xe1,0x2f,0x40,0x00,0xe4,0x04,0xf4,0x00,0x4e,0x30,0x0e,0x42,
-0xe5,0xf3,0x1b,0x23,0xe4,0x13,0x4e,0x00,0x11,0x06,0xdd,0x00,0x01,0xd2,0x61,0x1f,
-0x20,0x29,0x09,0x01,0x12,0x02,0x7c,0x3c,0x15,0x02,0x54,0x10,0x12,0x06,0xaa,0x0c,
-0x11,0xf4,0xa1,0x1d,0x21,0x0e,0x40,0xa6,0x18,0x50,0xe4,0x00,0x02,0xfa,0x02,0x52,
-0x01,0x20,0xbb,0xe5,0x47,0x62,0xf3,0x05,0x6e,0x14,0xe2,0x00,0x0e,0x40,0x4f,0x40,
-0x07,0xe1,0x00,0xe4,0x3f,0x50,0x00,0x07,0xa0,0x0e,0x43,0x30,0xdb,0x06,0x01,0xe8,
-0x3b,0x00,0xbf,0x44,0x20,0xff,0xf3,0x0d,0x00,0x31,0x10,0x0e,0x40,0xf3,0x28,0x11,
-0xf4,0x63,0x5e,0x14,0xfe,0x0e,0x54,0x10,0x06,0x0e,0x54,0x11,0x10,0xd4,0x44,0x14,
-0xe7,0x17,0x13,0x24,0x03,0x80,0xea,0x00,0x21,0x0f,0x40,0x79,0x52,0x10,0xe4,0x13,
-0x40,0xd0,0x45,0x5e,0x40,0x00,0x2f,0xc0,0x0c,0xdc,0xf4,0x00,0x0a,0xbd,0x80,0xf5,
-0x15,0xa1,0xf2,0x2e,0x50,0x00,0xe4,0x04,0xf5,0x00,0x4f,0x40,0xea,0x00,0x30,0x4b,
-0x00,0xe4,0x5f,0x01,0x00,0xdd,0x00,0x21,0x00,0x39,0xa9,0x63,0x41,0x5f,0x95,0x47,
-0xea,0x66,0x21,0x21,0x02,0xf3,0x55,0x07,0x20,0x0d,0x60,0x15,0x02,0x00,0xcd,0x10,
-0x40,0x8e,0x62,0x25,0xdc,0xe0,0x21,0x33,0xed,0xc6,0x00,0xd7,0x32,0x70,0x00,0x04,
-0xa0,0x00,0x0f,0x30,0x4d,0xba,0x04,0x00,0xd0,0x32,0x21,0x07,0xb0,0x07,0x00,0x20,
-0x08,0x90,0xb4,0x32,0x00,0xfd,0x55,0x00,0x07,0x00,0xf0,0x08,0x0e,0xd0,0xbe,0xef,
-0x40,0x5d,0x00,0x2f,0xf3,0x23,0x3e,0x40,0x4d,0x00,0x9a,0xa9,0x00,0x0e,0x40,0x4d,
-0x00,0xf4,0x3f,0x07,0x00,0xfb,0x03,0x08,0xb0,0x0c,0x60,0x0e,0x30,0x4d,0x2e,0x20,
-0x04,0xe0,0x0e,0x30,0x4d,0x97,0x00,0x00,0xa2,0xd7,0x32,0x04,0xde,0x32,0x12,0x4e,
-0x03,0x06,0x18,0x3d,0xd7,0x32,0x02,0xc8,0x04,0x30,0x0f,0x30,0xb8,0xfb,0x01,0x18,
-0x0f,0xc8,0x04,0xf0,0x00,0x15,0x5f,0x40,0xa9,0x00,0x09,0xf7,0x2b,0xbf,0x40,0xa8,
-0x00,0x1f,0x8f,0x20,0x97,0x35,0x60,0xbb,0x08,0xd1,0x0d,0x50,0xa8,0x4a,0x04,0x20,
-0x0d,0x50,0xc8,0x04,0x27,0x09,0x1d,0xc8,0x04,0x12,0x35,0x62,0x5f,0x4f,0xad,0xcc,
-0xcc,0xcc,0xc8,0x04,0x17,0x12,0x27,0xc8,0x04,0x10,0x4d,0x4a,0x04,0x01,0x07,0x00,
-0x11,0xf5,0xd9,0x00,0xf1,0x01,0x03,0xf2,0x02,0x2e,0x40,0x4e,0x00,0x07,0xf4,0x3f,
-0xff,0x40,0x4d,0x00,0x0e,0xdd,0x15,0x00,0xd0,0x7e,0x1c,0x90,0x0e,0x40,0x4d,0x03,
-0xf4,0x02,0xe6,0x0d,0x50,0x4d,0xe3,0x06,0x30,0x1d,0x40,0x4d,0x0f,0x11,0x00,0xe5,
-0x44,0x22,0x00,0x42,0x07,0x00,0x73,0xc8,0x00,0x04,0x00,0x49,0x00,0x00,0x20,0x2d,
-0x03,0x07,0x00,0x02,0xdd,0x58,0x00,0x91,0x51,0x36,0xef,0xfa,0x00,0xb8,0x12,0x30,
-0x01,0x00,0x21,0x76,0x53,0x32,0x0f,0x30,0xb7,0xfc,0x00,0x30,0xb7,0x00,0x01,0xd1,
-0x17,0xf0,0x16,0xa7,0x00,0x05,0xf3,0x3f,0xff,0x40,0xa7,0x00,0x0c,0xec,0x02,0x2e,
-0x40,0xa8,0x00,0x5f,0x1c,0x90,0x0d,0x50,0xa8,0x02,0xe6,0x01,0xe7,0x0d,0x50,0xa7,
-0x1d,0x90,0x00,0x3e,0x2d,0x50,0xa7,0x37,0x01,0x04,0x21,0x20,0x96,0xcb,0x1f,0x11,
-0x33,0x2c,0x5c,0x26,0xfe,0xee,0xf5,0x00,0x01,0xf6,0x44,0x00,0x0e,0x0d,0x32,0xfe,
-0xee,0xd2,0x89,0x60,0x00,0x9f,0x60,0x01,0x40,0x47,0x24,0x00,0x6f,0x41,0x47,0x30,
-0x06,0x00,0x38,0x4f,0x07,0x32,0x0f,0x40,0x5e,0xfc,0x00,0x12,0x5e,0x7a,0x01,0xf1,
-0x1c,0x5e,0x00,0x04,0xf2,0x2c,0xcf,0x40,0x5e,0x00,0x0a,0xf8,0x04,0x5e,0x40,0x4e,
-0x00,0x2f,0x6f,0x40,0x0d,0x50,0x4e,0x00,0xca,0x06,0xe2,0x0d,0x50,0x5e,0x0a,0xd0,
-0x00,0x9d,0x0d,0x50,0x5e,0x4c,0x10,0x00,0x06,0x1c,0x30,0x5d,0x3d,0x3e,0x02,0x48,
-0x29,0x12,0xe6,0xbf,0x02,0x12,0xf3,0x93,0x0f,0x12,0xfc,0x8d,0x0d,0x21,0x3c,0xd1,
-0xbd,0x1f,0x00,0x63,0x6f,0x30,0x01,0xcd,0x20,0x39,0x73,0x01,0x2b,0x10,0x11,0x33,
-0xd5,0x03,0x21,0x02,0x60,0x9b,0x58,0x00,0xc1,0x36,0x12,0x7c,0x13,0x09,0x30,0xaa,
-0x00,0x6e,0x82,0x13,0x30,0xe7,0x00,0x03,0x68,0x14,0x11,0xfd,0x15,0x00,0xd0,0x0d,
-0x9d,0x90,0x15,0x58,0xe0,0x00,0x8e,0x02,0xf5,0x5b,0xcd,0xe0,0xcc,0x07,0xb4,0x30,
-0x05,0xe0,0x3f,0x40,0x00,0x05,0xd0,0x05,0xd0,0x22,0x56,0x27,0x11,0x60,0x07,0x00,
-0x21,0x01,0xf2,0xb5,0x17,0x03,0x31,0x1d,0x0a,0x07,0x00,0x00,0xd1,0x4c,0x00,0xf9,
-0x26,0x13,0x23,0x9c,0x0c,0x1a,0x06,0x3a,0x4e,0x13,0x5f,0x84,0x12,0x22,0xf2,0x00,
-0x29,0x73,0x11,0xc0,0x99,0x02,0x21,0xe7,0x1e,0x84,0x60,0xc0,0xea,0x00,0x2d,0xb0,
-0x00,0x00,0x03,0xe9,0x00,0x00,0x1c,0xd2,0x30,0x01,0x12,0x14,0x85,0x05,0x2f,0x05,
-0xd0,0xa2,0x21,0x0f,0x03,0xea,0x0a,0x02,0x4f,0x19,0x10,0x00,0xf0,0x7d,0x12,0x20,
-0xa7,0x55,0x21,0xbd,0x10,0x07,0x00,0x20,0x30,0xae,0x21,0x5f,0x50,0xdd,0x20,0x00,
-0x7f,0x70,0xf2,0x4f,0x47,0x4c,0x00,0x2a,0x20,0x5a,0x00,0x19,0x5d,0x0d,0x20,0x00,
-0x0c,0x10,0x1f,0x21,0xb6,0x13,0x23,0x03,0x6e,0x17,0x06,0x78,0x0a,0x13,0x9c,0x5e,
-0x21,0x12,0xf6,0x06,0x26,0x21,0xa5,0xf6,0xe2,0x0d,0x30,0xa0,0x04,0xf9,0xb5,0x01,
-0x70,0x70,0x15,0x02,0xcd,0x10,0x00,0x05,0x34,0x1a,0x13,0x40,0x87,0x00,0x00,0x5a,
-0x0c,0x70,0x48,0xe4,0x44,0x44,0x40,0x7e,0xee,0x88,0x2f,0x25,0xed,0x10,0x9b,0x40,
-0x1e,0x20,0x78,0x33,0x06,0xc5,0x2e,0x1a,0x0f,0x94,0x20,0x03,0x50,0x3a,0x07,0x0e,
-0x01,0x12,0x10,0x34,0x84,0x21,0xcc,0x10,0xd8,0x3f,0x20,0x41,0xcd,0x9f,0x2e,0x21,
-0xce,0x30,0x9d,0x83,0x54,0xc8,0x00,0x4c,0x00,0x4c,0x0e,0x01,0x00,0xe5,0x02,0x4d,
-0x7d,0x22,0x22,0x23,0xb0,0x22,0x03,0x1f,0x39,0x50,0x03,0xfb,0x53,0x5b,0xf3,0xe2,
-0x54,0x02,0x1a,0x6a,0x22,0x0e,0x60,0xb6,0x00,0x12,0xc9,0x39,0x6a,0x52,0x03,0xf9,
-0x32,0x49,0xf4,0xed,0x61,0x25,0x82,0x00,0x8b,0x1b,0x11,0xc4,0xb9,0x07,0x11,0xe4,
-0xfc,0x37,0x10,0xf2,0x06,0x00,0x21,0x07,0xf2,0xc2,0x17,0x10,0xec,0x06,0x00,0x10,
-0x9d,0x66,0x03,0xf1,0x03,0x06,0xf2,0x02,0xe8,0x00,0x3e,0x6e,0x30,0x00,0x2e,0x40,
-0x3e,0x62,0x00,0xb0,0x01,0x10,0x3e,0x93,0x10,0x07,0x06,0x00,0xed,0x20,0x3e,0x9c,
-0xcc,0xfd,0xef,0xe4,0x3e,0x34,0x44,0x43,0x20,0x00,0x3e,0xff,0x2d,0x16,0x01,0xcf,
-0x61,0x04,0x2c,0x22,0x13,0x6e,0x38,0x01,0x12,0xf5,0xc2,0x07,0x00,0x58,0x4d,0x00,
-0x2f,0x78,0x11,0x07,0x1d,0x33,0x30,0xf5,0x00,0x06,0x54,0x76,0x5b,0xc2,0x00,0x00,
-0x03,0xc7,0x4f,0x22,0x04,0x95,0x22,0x1f,0x22,0x95,0x22,0x15,0x1a,0x3f,0x95,0x22,
-0x17,0x29,0xa6,0x02,0x01,0x2a,0x84,0x02,0xcd,0x43,0x12,0xea,0xff,0x02,0x30,0x62,
-0xdb,0x10,0xe2,0x72,0xcf,0x50,0x01,0xbd,0x30,0x00,0x00,0xdb,0x20,0x00,0x00,0x6e,
-0x20,0x95,0x22,0x07,0x20,0x2e,0x62,0x00,0x11,0x12,0x40,0x2a,0x08,0x10,0x1f,0xd9,
-0x06,0x01,0x16,0x0c,0x01,0x2c,0x08,0x0b,0xd1,0x2a,0x1b,0x1f,0x9c,0x42,0x0f,0x0f,
-0x03,0x06,0x1a,0x20,0x0f,0x03,0x00,0xa1,0x77,0x10,0xa6,0xa1,0x0b,0x16,0x20,0xf5,
-0x43,0x03,0xd9,0x58,0x00,0x13,0x36,0x02,0xe3,0x60,0x05,0x4a,0x57,0x08,0x3c,0x2b,
-0x0b,0x2a,0x24,0x19,0xf6,0x2a,0x24,0x14,0x80,0x2a,0x24,0x1a,0x1a,0x2b,0x03,0x13,
-0x7e,0x95,0x01,0x12,0xd0,0x3c,0x00,0x21,0xfd,0xa0,0xc4,0x00,0x30,0xe6,0x2e,0x80,
-0x07,0x00,0x50,0xe9,0x00,0x3e,0x90,0x00,0x8f,0x2d,0x31,0x00,0x2e,0xb1,0xc7,0x13,
-0x3f,0x00,0x18,0x40,0x7d,0x12,0x04,0x12,0x6f,0x9a,0x44,0x16,0x10,0x7d,0x12,0x13,
-0x19,0x77,0x01,0x13,0xe0,0x85,0x44,0x02,0x20,0x03,0x21,0xae,0x9e,0xd5,0x35,0xf2,
-0x00,0xbe,0x30,0x7f,0x60,0x00,0x00,0x06,0xfb,0x10,0x00,0x4d,0xc1,0x00,0x00,0x63,
-0x9a,0x4f,0x20,0x21,0x11,0x2f,0x08,0x2e,0x20,0x7f,0x8c,0x43,0x20,0x34,0x30,0x92,
-0x2a,0x24,0xee,0xee,0xb1,0x35,0x12,0x3f,0xaa,0x12,0x22,0x25,0xf0,0x2c,0x3e,0x16,
-0xec,0x83,0x36,0x53,0x1f,0x41,0x11,0x22,0x23,0xf4,0x14,0x18,0xe4,0xa1,0x00,0x1a,
-0x16,0x8f,0x00,0x22,0xce,0x10,0xb7,0x00,0x12,0xdb,0x07,0x00,0x20,0x51,0xdc,0x06,
-0x02,0x20,0xaf,0x50,0xb9,0x78,0x66,0x00,0xda,0x20,0x00,0x00,0x5d,0x7f,0x00,0x11,
-0x32,0xf6,0x5a,0x21,0x05,0xee,0x8b,0x14,0x18,0xe1,0xf4,0x65,0x25,0x01,0x50,0xdf,
-0x5d,0x00,0x71,0x33,0x22,0x37,0xd0,0x86,0x59,0x13,0xed,0xdf,0x5d,0x00,0x0f,0x00,
-0x16,0x11,0xdf,0x5d,0x1f,0x90,0x87,0x00,0x2a,0x12,0x13,0x87,0x00,0x25,0x07,0xee,
-0x12,0x15,0x0f,0x4d,0x52,0x2b,0x20,0x08,0x10,0xf9,0x08,0x22,0x00,0xe3,0x58,0x0a,
-0x11,0x30,0x23,0x42,0x10,0xe3,0x30,0x07,0x00,0x0d,0x00,0x12,0x0c,0x65,0x0a,0x20,
-0xff,0x10,0xfd,0x09,0x20,0x5e,0xd7,0x0d,0x00,0x20,0x0c,0x95,0x45,0x2c,0x30,0x03,
-0xf2,0x0d,0x1f,0x47,0x70,0xc8,0x00,0x4f,0x10,0x0e,0x40,0x6d,0x54,0x0e,0x6a,0xe4,
-0x0e,0x30,0x00,0x02,0xc0,0x42,0x0b,0x1e,0x40,0x4f,0x0b,0x04,0x2a,0x6c,0x22,0x00,
-0x05,0x42,0x0b,0x11,0x6c,0x95,0x09,0x12,0x09,0x0d,0x00,0x11,0xd8,0x0d,0x00,0x20,
-0x3f,0xe0,0x0d,0x00,0x30,0x0b,0xac,0xa0,0x98,0x5d,0xd0,0xe1,0x1d,0x80,0x00,0xd6,
-0x06,0xf3,0x00,0x2e,0x70,0x0d,0x64,0xe3,0x4d,0x02,0x12,0xd6,0xe4,0x02,0x13,0x30,
-0x3b,0x6a,0x25,0x0a,0xff,0x42,0x0b,0x18,0xf5,0x58,0x45,0x1b,0xf5,0xcd,0x4d,0x11,
-0x01,0x6f,0x6a,0x00,0x42,0x0b,0x12,0xe5,0xea,0x00,0x01,0xc7,0x5d,0x00,0x0d,0x00,
-0x11,0xc8,0xa9,0x12,0x20,0x2f,0xe0,0x4f,0x0f,0x30,0x0a,0xcc,0xa0,0xbc,0x20,0xd0,
-0xf3,0x1e,0x60,0x00,0xd5,0x02,0xe6,0x00,0x3f,0x40,0x0d,0x52,0xe7,0x24,0x05,0x24,
-0xe5,0x13,0xce,0x5e,0x02,0x81,0x58,0x11,0xf1,0xc4,0x0b,0x27,0x3f,0x10,0xe6,0x38,
-0x0e,0x42,0x0b,0x02,0xc7,0x7a,0x02,0x44,0x0f,0x00,0x9b,0x0f,0x12,0x5f,0x6e,0x03,
-0x12,0x8c,0x07,0x00,0x12,0xdd,0x6b,0x5b,0x20,0xec,0x90,0x07,0x00,0x30,0x1e,0x61,
-0xe6,0x07,0x00,0xe4,0xca,0x00,0x3f,0x40,0x04,0xf0,0x1c,0xb0,0x00,0x04,0xe0,0x04,
-0xe0,0x16,0xb6,0x5d,0x02,0xf5,0x06,0x12,0x05,0xee,0x5b,0x00,0x42,0x35,0x21,0x04,
-0xe0,0x66,0x3b,0x22,0x47,0xe0,0x15,0x00,0x14,0xa0,0x46,0x02,0x80,0x06,0xf4,0x33,
-0x44,0x44,0x51,0x00,0x02,0x27,0x4a,0x18,0xc3,0xf3,0x00,0x1b,0xe4,0x35,0x0c,0x11,
-0xd8,0x0d,0x00,0x21,0x4f,0xf2,0xb1,0x16,0x10,0x88,0xd0,0x14,0xe0,0x0a,0xc0,0x0b,
-0xb0,0x00,0xe4,0x09,0xd1,0x00,0x0c,0xa0,0x0e,0x43,0xb1,0x1d,0x08,0x2e,0xd3,0x00,
-0x92,0x6d,0x11,0x60,0x52,0x07,0x11,0xd6,0xc0,0x00,0x12,0x0d,0x0d,0x00,0x0c,0x92,
-0x6d,0x10,0x01,0x93,0x09,0x0a,0x68,0x01,0x27,0x09,0xa0,0xdd,0x01,0x20,0x4f,0xf2,
-0x34,0x00,0x70,0x0d,0x89,0xc0,0x00,0x0d,0x50,0x09,0x75,0x00,0x90,0xd5,0x09,0xe1,
-0x00,0x0c,0x90,0x0d,0x54,0xc1,0x75,0x00,0x23,0xd5,0x00,0x18,0x6c,0x21,0x00,0x29,
-0xc0,0x0b,0x80,0x4f,0x95,0x47,0xeb,0x00,0x00,0x0e,0x80,0xb3,0x0b,0x21,0x01,0xf2,
-0x4f,0x5b,0x00,0xe0,0x01,0x10,0xe5,0x99,0x21,0x20,0x25,0xcd,0x5b,0x55,0x14,0xee,
-0x34,0x63,0x63,0x00,0x00,0x00,0x95,0x00,0x2c,0x2e,0x46,0x11,0x3e,0x31,0x17,0x00,
-0x9c,0x22,0x11,0x1f,0x71,0x1c,0x11,0x5d,0x08,0x00,0x31,0xe8,0x00,0x6e,0x08,0x00,
-0xfa,0x27,0xfa,0x00,0x8f,0x10,0x1f,0x20,0x00,0x02,0xfe,0x00,0xbf,0x50,0x0f,0xff,
-0xf2,0x06,0xdf,0x20,0xfc,0x90,0x0f,0x43,0x20,0x0a,0x8b,0x73,0xe4,0xe0,0x0f,0x10,
-0x00,0x0f,0x36,0xca,0x90,0xf3,0x0f,0x10,0x00,0x7c,0x01,0xff,0x10,0xa8,0x0f,0x10,
-0x00,0xc4,0x00,0xa9,0x00,0x39,0x0f,0x10,0xb4,0x24,0x0e,0x08,0x00,0x07,0xd0,0x0b,
-0x42,0x74,0x00,0x06,0x50,0xcb,0x53,0x12,0xb8,0x8c,0x02,0x21,0x0e,0x60,0xe7,0x7a,
-0x21,0x01,0xfa,0xee,0x2d,0xf0,0x0b,0x00,0x6f,0xf1,0x00,0x00,0x01,0xf5,0xe5,0x0e,
-0x8c,0x90,0x00,0x00,0xab,0x06,0xd7,0xe1,0x3f,0x20,0x00,0x4e,0x10,0x0b,0xf5,0x00,
-0x7c,0xe9,0x23,0x16,0x14,0xe0,0x7c,0x0e,0x14,0x57,0x26,0xef,0xfe,0x14,0x57,0x16,
-0x20,0x45,0x20,0x03,0x48,0x13,0x31,0x49,0xa5,0x00,0xb1,0x74,0x50,0xf8,0x7e,0x70,
-0x00,0x4e,0x0b,0x03,0x00,0xc2,0x16,0x03,0xe4,0x07,0x11,0x4e,0x8f,0x01,0x10,0xc6,
-0xa0,0x44,0x20,0x7b,0x00,0xd2,0x60,0x21,0xff,0xf2,0x10,0x00,0x06,0x20,0x00,0x00,
-0xbe,0x31,0x10,0xf1,0x08,0x00,0x41,0x09,0xd5,0x5e,0x80,0xbf,0x07,0x25,0x7c,0xc7,
-0xe0,0x3c,0x1f,0x00,0x50,0x14,0x0d,0x13,0x18,0x24,0x57,0x50,0x70,0x00,0x09,0xfd,
-0xf9,0x83,0x07,0x30,0x6e,0x20,0x2e,0xd0,0x34,0x60,0xc7,0x00,0x08,0xa0,0x02,0xf0,
-0x88,0x0f,0x11,0xb0,0x07,0x00,0xf0,0x00,0x05,0xc0,0x02,0xff,0xfd,0xc7,0x00,0x07,
-0xa0,0x02,0xf3,0x21,0x7d,0x10,0x1e,0x18,0x33,0x31,0x0b,0xfd,0xf8,0x29,0x05,0x25,
-0x23,0x10,0xf9,0x32,0x14,0x70,0x42,0x14,0x10,0x05,0x22,0x0f,0x0e,0xaa,0x22,0x0c,
-0x07,0x00,0x03,0x3f,0x14,0x00,0xcb,0x27,0x30,0x3a,0xca,0x20,0x9a,0x02,0x60,0x2f,
-0x84,0x9e,0x10,0x04,0xf0,0x7d,0x02,0x10,0xc8,0x0f,0x00,0x11,0xd5,0xae,0x67,0x00,
-0xf7,0x02,0x30,0x6c,0x00,0x3f,0x0f,0x00,0x90,0x06,0xb0,0x03,0xff,0xfd,0x0b,0x90,
-0x00,0x98,0x3b,0x14,0x41,0x4f,0x51,0x5f,0x20,0xad,0x10,0x28,0xfd,0x40,0x45,0x08,
-0x13,0x01,0xff,0x1a,0x00,0x4e,0x0c,0x03,0x41,0x6b,0x0e,0xa0,0x1d,0x00,0x5e,0x2c,
-0x29,0xef,0xf0,0x15,0x45,0x00,0x51,0x5e,0x30,0x3a,0xdb,0x30,0x78,0x00,0x60,0x3f,
-0x83,0x8f,0x20,0x04,0xf0,0x46,0x63,0x33,0xb8,0x00,0x3f,0x87,0x00,0xa1,0xf3,0x32,
-0x0e,0x40,0x00,0x5c,0x00,0x3f,0xff,0xe1,0x87,0x00,0x01,0x1e,0x00,0x11,0xb7,0x25,
-0x11,0x30,0x85,0xae,0x10,0x04,0x1b,0x33,0x3a,0xc9,0x10,0x9f,0x0b,0x31,0x09,0xcb,
-0xa1,0x33,0x0a,0x20,0x13,0x33,0x35,0x1d,0x00,0xb4,0x19,0x10,0x50,0x92,0x00,0x21,
-0x3a,0xb6,0x0f,0x00,0x31,0x1e,0x74,0xe4,0x86,0x4f,0xfa,0x03,0xd0,0x09,0x80,0x00,
-0x04,0xfc,0xcc,0x2f,0x10,0xb6,0x00,0x00,0x05,0x54,0x20,0x8f,0xec,0x00,0xec,0x61,
-0x10,0x04,0x2a,0x03,0x11,0xec,0x52,0x61,0x41,0x05,0xf6,0x26,0xf2,0x5e,0x63,0x10,
-0x70,0xb5,0x8d,0x01,0xaf,0x0a,0x61,0x6b,0x00,0x3f,0x55,0x50,0x0f,0x92,0x00,0x60,
-0xdd,0xc2,0x0c,0x80,0x00,0x99,0x8b,0x00,0x41,0x04,0xf7,0x47,0xf2,0x0b,0x01,0x39,
-0x4b,0xda,0x30,0xe4,0x01,0x12,0x01,0x42,0x5f,0x01,0x57,0x3b,0x18,0xff,0x79,0x17,
-0x00,0x30,0x7f,0x03,0xb4,0x45,0x18,0xfb,0x5d,0x15,0x21,0x63,0x34,0x3a,0x3d,0x61,
-0x0b,0xee,0xed,0xdd,0xdc,0x40,0x24,0x02,0x00,0x1f,0x01,0x30,0x9f,0xdf,0x90,0xc9,
-0x00,0x00,0x25,0x02,0x20,0x04,0xe0,0x8e,0x00,0x12,0x8a,0x87,0x02,0x22,0x06,0xb0,
-0x8f,0x49,0x10,0x5c,0x52,0x15,0x00,0x27,0x02,0x61,0x04,0xf2,0x21,0x07,0xd1,0x01,
-0xa0,0x02,0x00,0x28,0x02,0x10,0x03,0x19,0x27,0x11,0x31,0xda,0x23,0x05,0x37,0x1f,
-0x30,0xdd,0xdd,0xdd,0x9d,0x33,0x20,0xf7,0x54,0x33,0x2a,0x01,0x81,0x0b,0x12,0x4f,
-0x90,0x0b,0x13,0x04,0x0f,0x00,0x10,0x4e,0x84,0x4d,0x46,0xcb,0xbc,0xcd,0xd0,0x34,
-0x76,0x0f,0x87,0x00,0x18,0x2e,0xf0,0xc7,0x87,0x00,0x13,0x04,0x87,0x00,0x04,0x13,
-0x23,0x03,0x47,0x65,0x12,0x1c,0xea,0x20,0x10,0x02,0x78,0x00,0x03,0x85,0x67,0x52,
-0xf6,0x44,0x44,0x46,0xf0,0x20,0x04,0x10,0x3f,0x96,0x00,0x46,0x11,0x11,0x14,0xe0,
-0xd3,0x15,0x00,0x87,0x00,0x1f,0x60,0x87,0x00,0x02,0x13,0x4f,0x87,0x00,0x29,0xf2,
-0x21,0x87,0x00,0x2e,0xf0,0x00,0x87,0x00,0x06,0x9d,0x03,0x16,0x50,0xac,0x46,0x92,
-0x2e,0xb5,0x34,0x9f,0x50,0x00,0x00,0x0b,0xb0,0x71,0x0b,0x12,0xd6,0x96,0x00,0x22,
-0x0b,0x90,0xaa,0x46,0x50,0x3f,0x94,0x23,0x8f,0x70,0x26,0x39,0x01,0xa9,0x46,0x00,
-0x87,0x00,0x21,0x03,0x50,0xb9,0x03,0x21,0x07,0xc0,0x86,0x00,0x21,0x07,0xc0,0xb9,
-0x03,0x21,0x07,0xc0,0x85,0x00,0x30,0x07,0xd2,0x21,0xb9,0x03,0x11,0x07,0xb9,0x03,
-0x00,0x15,0x00,0x00,0xb9,0x03,0x21,0x06,0xc0,0x83,0x00,0x21,0x06,0xc0,0xb9,0x03,
-0x29,0x05,0xa0,0x40,0x70,0x10,0xe0,0xe5,0x20,0x01,0xb0,0x3b,0x20,0x0a,0x20,0xc1,
-0x12,0x02,0x38,0x37,0x04,0x07,0x00,0x83,0x02,0x5e,0x85,0x55,0xf8,0x62,0x00,0x07,
-0xcb,0x5d,0x00,0xb9,0x00,0xf1,0x2c,0x06,0x30,0x17,0x95,0x00,0x0e,0x40,0xc7,0x2e,
-0xa7,0xe8,0x00,0xf4,0x0b,0x88,0xb0,0x03,0xf1,0x0e,0x40,0xb8,0xc6,0x00,0x0e,0x40,
-0xe6,0x1b,0x8d,0x50,0x00,0xc5,0x0d,0xff,0xf8,0xc6,0x00,0x0d,0x30,0xd5,0x0b,0x89,
-0x90,0x01,0xf1,0x0d,0x50,0xb8,0x2f,0x75,0xc9,0x00,0xd5,0x0b,0x70,0x3b,0xc8,0x00,
-0x0d,0x50,0xab,0x3c,0x00,0x8a,0x77,0x10,0x3c,0x46,0x15,0x00,0xf5,0x3a,0x41,0x44,
-0x4f,0x40,0x00,0x52,0x5f,0x01,0x1f,0x04,0x14,0x0e,0x0d,0x00,0x10,0x04,0xaa,0x06,
-0x16,0x30,0x43,0x15,0x05,0x3c,0x05,0x13,0x4e,0x3c,0x05,0x13,0x4f,0x3c,0x05,0x12,
-0x4f,0x3c,0x05,0x00,0xbd,0x78,0x11,0x4e,0x4d,0x67,0x21,0x33,0x10,0x2c,0x05,0x11,
-0x3f,0x9f,0x3d,0x01,0xab,0x03,0x04,0x10,0x00,0x02,0x20,0x00,0x20,0x55,0x40,0x3c,
-0x05,0x00,0x05,0x7a,0x01,0x3c,0x05,0x13,0x3f,0x3c,0x05,0x0f,0x7c,0x19,0x0d,0x14,
-0x2f,0xaa,0x46,0x05,0x91,0x02,0x00,0x83,0x01,0x13,0x04,0x3c,0x05,0x30,0xf1,0x10,
-0xc7,0x5c,0x6c,0x30,0xff,0xfe,0xe4,0x26,0x04,0x20,0xf1,0x10,0x83,0x01,0x01,0x51,
-0x05,0x50,0x07,0xa0,0x03,0xf3,0x32,0x83,0x01,0x31,0x03,0xfe,0xeb,0x14,0x03,0x02,
-0x3c,0x05,0x04,0xf1,0x59,0x11,0xb0,0x0d,0x0a,0x20,0x10,0x00,0xe8,0x37,0x20,0xcd,
-0xfc,0xca,0x0c,0x41,0x30,0x00,0x09,0xe0,0xf8,0x17,0x00,0x9d,0x02,0x12,0xaa,0x25,
-0x0b,0x51,0x3f,0x94,0x33,0x6e,0xb0,0x2b,0x70,0x14,0xa6,0x0a,0x0a,0x02,0x8d,0x27,
-0xd0,0x01,0x9d,0xc6,0x00,0x00,0x2e,0x0d,0x91,0x3e,0x50,0x00,0x2e,0x5d,0xdf,0x01,
-0x20,0x2e,0x98,0xe8,0x0d,0x70,0x2e,0xb6,0x00,0x00,0xf2,0x44,0x6e,0x06,0x00,0x30,
-0xcd,0xde,0xb7,0x12,0x00,0x20,0x2f,0x8a,0xab,0x00,0x20,0x2f,0x3f,0x79,0x19,0xbf,
-0x2f,0x09,0xea,0xcd,0x10,0x00,0x2f,0x00,0x36,0x50,0x00,0xe7,0x27,0x13,0xf1,0x06,
-0x00,0x3c,0xfd,0x60,0x00,0x04,0xf0,0x1f,0x82,0x5f,0x40,0x00,0x3f,0x07,0xc0,0x00,
-0x8b,0x00,0x03,0xf0,0xa8,0x44,0x18,0x80,0x0b,0x70,0x00,0x2f,0x2f,0xff,0xf0,0xa8,
-0x64,0x34,0xb0,0x5f,0x07,0xd0,0x00,0x7b,0x00,0x03,0xe0,0x1e,0x93,0x6f,0x6d,0x2c,
-0x3b,0x2a,0xdb,0x40,0x8c,0x1d,0x02,0xe9,0x26,0x14,0x3d,0xd1,0x12,0x18,0x0f,0x8c,
-0x1d,0x1c,0x0e,0x8c,0x1d,0x40,0x03,0x00,0x3b,0xed,0x75,0x00,0xf1,0x0c,0x2f,0x72,
-0x4e,0x60,0x00,0x3f,0x09,0xa0,0x00,0x6c,0x00,0x03,0xf0,0xc6,0x00,0x03,0xe1,0xdd,
-0xef,0x0c,0x70,0x00,0x2f,0x03,0x46,0xf0,0x9b,0xb8,0x18,0x40,0x02,0xf9,0x46,0xe5,
-0x5c,0x3a,0x24,0xbd,0xb5,0xfe,0x20,0x23,0x01,0x50,0x8c,0x1d,0x01,0x40,0x2b,0x14,
-0xc0,0x9b,0x10,0x00,0xa2,0x5f,0x04,0x8c,0x1d,0x03,0x89,0x06,0x2f,0x4f,0x22,0x8c,
-0x1d,0x03,0x30,0x29,0x03,0xbe,0x27,0x17,0x01,0x7b,0x00,0x30,0x4e,0x9a,0x00,0xc3,
-0x2d,0x01,0x7a,0x00,0x81,0xee,0xc7,0x00,0x02,0xf0,0x34,0x7e,0x9b,0x12,0x00,0x67,
-0x2f,0x94,0x6e,0x50,0x00,0x4e,0x78,0x00,0x04,0xe6,0x04,0x11,0x2c,0xd1,0x3c,0x02,
-0xd1,0x68,0x11,0x4f,0x9f,0x3b,0x00,0xe3,0x68,0x17,0x7c,0xe3,0x68,0x11,0x5c,0x60,
-0x1f,0x02,0x2a,0x23,0x41,0x38,0x00,0x03,0xbe,0x9d,0x16,0x01,0x6e,0x00,0x21,0x6d,
-0x00,0x6f,0x00,0x21,0x6d,0x00,0x70,0x00,0x21,0xed,0x00,0x71,0x00,0x21,0x8c,0x00,
-0x72,0x00,0x21,0x6c,0x00,0x73,0x00,0x21,0x6c,0x00,0x74,0x00,0x03,0xbb,0x57,0x15,
-0x5a,0x9d,0x67,0x50,0x98,0x00,0x77,0x01,0xf0,0x81,0x22,0x10,0x88,0x77,0x05,0x30,
-0xaf,0xee,0xf8,0xeb,0x62,0x50,0xaa,0x44,0xb8,0x0a,0xf9,0x15,0x00,0xf3,0x01,0x98,
-0x2e,0x3f,0x30,0x00,0xa8,0x11,0xa8,0xb7,0x07,0xd0,0x00,0x7e,0xff,0xe6,0xb0,0xb7,
-0x08,0x60,0x37,0x00,0x03,0xcf,0xe7,0x00,0x5b,0x00,0x90,0x71,0x4e,0x60,0x00,0x6c,
-0x00,0x8b,0x00,0x07,0x69,0x00,0x60,0xb7,0x00,0x04,0xf3,0xcd,0xec,0x76,0x67,0x80,
-0xf1,0x44,0x9c,0x00,0x9a,0x00,0x05,0xd0,0x8a,0x07,0xc2,0x40,0x1d,0x70,0x00,0x6c,
-0x00,0x06,0xfe,0xfa,0x00,0x00,0x6b,0xa6,0x2d,0x16,0x5a,0x34,0x01,0x41,0x95,0x00,
-0x09,0x50,0x57,0x13,0x21,0x0d,0x60,0xe2,0x75,0x00,0xd0,0x17,0xf5,0x09,0x08,0xfc,
-0x00,0x8f,0xd1,0x00,0x00,0x2f,0x4c,0xa2,0xf4,0xcc,0x00,0x01,0xd7,0x01,0xdf,0x80,
-0x0b,0xc0,0x03,0x70,0x00,0x37,0xec,0x80,0x11,0x20,0xd1,0x26,0xf0,0x04,0x3e,0x01,
-0x9d,0xb3,0x00,0x3e,0x04,0xe0,0xac,0x58,0xf1,0x03,0xe0,0x4e,0x1f,0x20,0x0c,0x70,
-0x3e,0x78,0x63,0x11,0x8a,0xb2,0x35,0x91,0x06,0xd4,0x6e,0x04,0xe6,0xc0,0x00,0x5f,
-0xdd,0x0d,0x00,0xf2,0x0d,0xb0,0x3f,0x03,0xe3,0xf0,0x00,0x89,0x03,0xf0,0x3e,0x0e,
-0x40,0x0d,0x50,0x2f,0x03,0xe0,0x7d,0x5a,0xd0,0x02,0xf0,0x3e,0x00,0x6b,0x92,0x00,
-0x2f,0x82,0x4f,0x02,0x75,0x4f,0x09,0x0d,0x00,0x12,0x3e,0x6d,0x03,0x21,0x30,0x1a,
-0x1e,0x02,0xf2,0x2f,0x03,0x10,0x4b,0xc8,0x00,0x04,0xd0,0xb7,0x4f,0x64,0xdb,0x00,
-0x4e,0x0b,0x7a,0x80,0x04,0xf1,0x04,0xe0,0xa7,0xd5,0x00,0x1f,0x41,0x5e,0x0a,0x7d,
-0x50,0x00,0xff,0xff,0xe0,0xa8,0xb7,0x00,0x2f,0x10,0x3f,0x0a,0x86,0xd0,0x09,0xc0,
-0x03,0xf0,0xa7,0x0a,0xff,0xe2,0x00,0x3f,0x0a,0x70,0x02,0x20,0x00,0x01,0x60,0x64,
-0x00,0x01,0xb2,0x59,0x18,0xbf,0xb2,0x59,0x20,0x12,0x23,0xbc,0x14,0x12,0x0c,0xb2,
-0x59,0x12,0xd7,0x5f,0x06,0x11,0x92,0xb2,0x59,0x15,0x9f,0xfb,0x5b,0x13,0x19,0xaf,
-0x03,0x20,0xad,0xc5,0xaf,0x03,0xf0,0x03,0x81,0x3e,0x40,0x00,0x2e,0x5c,0x00,0x07,
-0xb1,0xbb,0xce,0xa8,0x00,0x03,0xf0,0x66,0x8e,0xb6,0xf0,0x05,0x21,0x2e,0xb6,0xbb,
-0x03,0x11,0xb7,0x5c,0x2a,0xf1,0x00,0x89,0x00,0x05,0xd1,0xdd,0xdf,0x3f,0x10,0x0d,
-0x80,0x44,0x6f,0x09,0xea,0xdd,0xaf,0x03,0x1f,0x40,0xaf,0x03,0x0c,0x00,0x71,0x0e,
-0x00,0xcc,0x37,0xf0,0x05,0x07,0xfd,0xfa,0x00,0x00,0x4e,0x3f,0x30,0x2e,0x50,0x23,
-0x6e,0xa9,0x00,0x08,0xb3,0xee,0xee,0xc6,0x00,0xef,0x30,0x10,0xc6,0xde,0x0e,0xe0,
-0x4e,0xa9,0x00,0x07,0xa2,0x77,0x9e,0x4f,0x30,0x1d,0x53,0x99,0xbe,0x07,0x32,0x83,
-0x11,0x4e,0x36,0x00,0x13,0x4d,0xaa,0x1b,0x0c,0xb3,0x3f,0x17,0x6e,0xa7,0x3f,0x17,
-0x5d,0x41,0x14,0x13,0x49,0x30,0x00,0x30,0x2a,0xca,0x30,0x20,0x7c,0xf0,0x06,0x94,
-0x8f,0x20,0x00,0x5e,0x08,0xb0,0x00,0xa9,0x0f,0xff,0xe0,0xc6,0x00,0x06,0xc0,0x11,
-0x5e,0x0d,0x50,0x00,0x95,0x2a,0x10,0xc6,0x60,0x0c,0xe1,0x4e,0x09,0xa0,0x00,0x99,
-0x19,0x9b,0xe0,0x3f,0x72,0x6f,0x31,0x88,0xad,0xdf,0x08,0x24,0x04,0xd0,0x53,0x00,
-0x11,0x20,0x34,0x13,0x11,0x4f,0xf5,0x3d,0x1e,0x04,0x80,0x48,0x01,0xda,0x32,0x21,
-0xff,0x10,0xdb,0x73,0x0e,0x1b,0x04,0x20,0x22,0x5f,0x1b,0x04,0x41,0x5f,0xff,0xf0,
-0xc6,0x54,0x31,0x20,0x0c,0x70,0xa7,0x21,0x00,0x1b,0x04,0x30,0xc3,0x99,0xaf,0x1b,
-0x04,0x28,0x38,0x8a,0x1b,0x04,0x2f,0x02,0x90,0x1b,0x04,0x29,0x11,0x01,0x02,0x2c,
-0x20,0xef,0xf8,0x5d,0x01,0xc1,0x50,0x3e,0x60,0x34,0x7e,0xaa,0x00,0x07,0xc0,0xcd,
-0xee,0xc6,0x7b,0x2b,0x00,0x80,0x00,0x00,0x5d,0x01,0xcb,0x06,0xc1,0x98,0xbe,0x4f,
-0x30,0x1d,0x51,0x77,0xae,0x07,0xfe,0x5d,0x01,0x10,0x03,0x8d,0x1d,0x20,0xd9,0x20,
-0xd9,0x0f,0x21,0x4a,0xf3,0x73,0x81,0x11,0x9b,0xe3,0x0c,0x11,0x5e,0x28,0x0d,0xda,
-0x9c,0x00,0x07,0xf7,0x21,0x39,0xf4,0x00,0x00,0x5b,0xee,0xda,0x30,0x1f,0x03,0x11,
-0xad,0x1f,0x03,0x14,0xbc,0x1f,0x03,0x20,0xa7,0x9e,0x1f,0x03,0xe2,0x8e,0x9a,0xe0,
-0x4e,0x6c,0x00,0x06,0xc0,0x3e,0x04,0xe6,0xb0,0x00,0x5c,0x2c,0x03,0xf0,0x05,0xc0,
-0x3f,0x04,0xe3,0xe0,0x00,0x8e,0xbc,0xf0,0x4e,0x0f,0x30,0x0d,0x86,0x8f,0x04,0xe0,
-0x7d,0x5a,0xe0,0x87,0x52,0x48,0x7b,0x92,0x00,0x3f,0x94,0x52,0x09,0x0d,0x00,0x07,
-0x1f,0x03,0x31,0x18,0xcd,0xc7,0xd1,0x1b,0x40,0xb4,0x24,0xdb,0x00,0x15,0x7b,0x00,
-0x8b,0x19,0x01,0x0d,0x18,0x22,0x0c,0x60,0x7c,0x25,0x12,0xa7,0x6e,0x44,0x00,0xab,
-0x30,0x13,0x07,0x1e,0x00,0x41,0x0e,0xc5,0x47,0xe9,0xe3,0x02,0x25,0xcd,0xb4,0xad,
-0x2f,0x06,0x2d,0x02,0x01,0xc2,0x13,0x00,0xd7,0x05,0x50,0x8d,0x22,0x22,0x21,0x09,
-0x67,0x09,0x0a,0xbf,0x37,0x00,0xf1,0x65,0x00,0xfc,0x06,0x31,0xdf,0xd4,0x00,0x4e,
-0x99,0x32,0x06,0xf2,0x00,0xe6,0x0f,0x12,0x70,0xaa,0x4f,0x11,0xd6,0x62,0x11,0x30,
-0x12,0x9f,0x10,0x00,0x1a,0x38,0xff,0xeb,0x30,0x16,0x16,0x12,0x5d,0x55,0x43,0x5c,
-0xde,0xfd,0xdd,0xdd,0xd2,0x55,0x43,0x04,0x08,0x71,0x0b,0xf7,0x75,0x04,0x81,0x0e,
-0x03,0xe9,0x15,0x13,0x03,0x9a,0x0d,0x41,0x29,0xcc,0xb7,0x10,0x69,0x09,0x32,0x34,
-0xbd,0x00,0x78,0x09,0x12,0xe4,0x84,0x56,0x00,0xf4,0x00,0x21,0x09,0xd1,0x27,0x1d,
-0x52,0x00,0x0a,0xfe,0xdf,0xe6,0xbe,0x0d,0x10,0x20,0x47,0x18,0x45,0x10,0x04,0xe0,
-0x01,0x84,0x56,0x04,0xaa,0x26,0x00,0x92,0x73,0x2a,0x44,0x54,0xfe,0x59,0x22,0x3f,
-0x00,0xe6,0x4a,0x12,0xf0,0x39,0x3e,0x17,0xeb,0x84,0x56,0x09,0x82,0x58,0x00,0x27,
-0x00,0x12,0x10,0x34,0x5b,0x20,0xdf,0xc4,0x07,0x00,0x12,0xe3,0x0e,0x01,0x12,0xd7,
-0x7f,0x01,0x22,0x0c,0x80,0xb5,0x18,0x40,0x6f,0x63,0x34,0xbe,0x27,0x00,0x44,0x5b,
-0xef,0xc8,0x10,0x51,0x18,0x00,0x98,0x04,0x1e,0x6d,0x84,0x56,0x02,0x4d,0x25,0x12,
-0x30,0x92,0x26,0x01,0xf0,0x12,0x36,0x32,0x22,0x36,0xf0,0x12,0x08,0xe4,0x78,0x1a,
-0x6d,0xe4,0x78,0x10,0x07,0xe6,0x38,0x21,0xcd,0x80,0x16,0x12,0x21,0xad,0x44,0x96,
-0x7e,0x22,0x02,0xf2,0x3d,0x15,0x01,0x01,0x26,0x20,0x0e,0x40,0x92,0x06,0x51,0x0c,
-0x50,0x0d,0x40,0x00,0xea,0x25,0x00,0x56,0x24,0x10,0xe8,0x64,0x3a,0xa1,0xb9,0x92,
-0x00,0x2d,0xff,0xd2,0x00,0x0d,0xa8,0x82,0x7d,0x6e,0x01,0x6e,0x24,0x13,0x3d,0x08,
-0x00,0x15,0x4e,0x08,0x00,0xf6,0x01,0x13,0x0d,0x40,0x00,0x6d,0xdd,0xdf,0xef,0xfc,
-0x1d,0x40,0x00,0x13,0x44,0x33,0x21,0x96,0x24,0x0b,0x08,0x00,0x17,0x01,0xf1,0x22,
-0x31,0x2b,0xff,0xd3,0x21,0x0c,0x31,0xd9,0x00,0x7e,0x96,0x53,0x00,0xd1,0x41,0x11,
-0x0f,0x49,0x63,0x40,0x0c,0x50,0x0f,0x30,0x5e,0x76,0x20,0x1f,0x20,0x54,0x08,0x31,
-0x4c,0x77,0xd8,0xdd,0x78,0x00,0x5d,0x9a,0x22,0x0f,0x63,0x9f,0x21,0x10,0x0f,0x42,
-0x30,0xb8,0x6f,0x46,0x89,0x0f,0x30,0x00,0x6d,0xdd,0xdd,0xca,0x85,0xc5,0x78,0x22,
-0x07,0x60,0x42,0x34,0x13,0x0b,0x16,0x0b,0x0c,0x08,0x00,0x13,0x0a,0x2d,0x02,0x00,
-0x96,0x33,0x15,0x22,0xd9,0x53,0xf1,0x06,0x4b,0xdb,0x20,0x00,0x4e,0x05,0xf6,0x39,
-0xe1,0x00,0x3e,0x0d,0x70,0x00,0xb8,0x00,0x3e,0x0f,0x20,0x00,0x6b,0x06,0x00,0xf0,
-0x04,0x6c,0x00,0x3e,0x0e,0x40,0x00,0x89,0x00,0x3e,0x08,0xc1,0x03,0xe3,0x00,0x3e,
-0x00,0xaf,0xef,0x70,0x7e,0x17,0x11,0x20,0x84,0x17,0x1f,0xe0,0x90,0x17,0x1d,0x01,
-0x96,0x12,0xa1,0x9f,0xfe,0x60,0x00,0x5e,0x00,0x9c,0x10,0x3e,0x40,0x02,0x5e,0x50,
-0x79,0x00,0x4e,0x00,0xf2,0x70,0x0c,0xb0,0xe0,0x0e,0x50,0x00,0xa9,0x00,0x4e,0x00,
-0x5e,0x86,0xae,0xb6,0x33,0x21,0x3a,0xf7,0x02,0x5e,0x10,0x3f,0xd7,0x01,0xb5,0x33,
-0x36,0xf4,0x68,0x90,0x4e,0x1d,0xde,0xdd,0xcb,0x85,0x86,0x09,0x21,0x05,0x70,0x1c,
-0x0f,0x12,0x9a,0xc8,0x0a,0x16,0xa0,0xf5,0x7b,0x20,0x00,0x08,0xe4,0x00,0x14,0xb0,
-0x02,0x5e,0x04,0x07,0x04,0x32,0xb5,0x25,0xda,0x39,0x85,0x0f,0x07,0x04,0x0c,0x19,
-0xf2,0x07,0x04,0x13,0xa4,0x47,0x26,0x12,0x80,0x9b,0x48,0x22,0x0f,0x20,0x8f,0x03,
-0x10,0xf2,0x16,0x19,0x44,0xc8,0x22,0x2f,0x42,0x84,0x4a,0x15,0xf2,0xf1,0x02,0x12,
-0x08,0xf1,0x02,0x21,0x08,0xe2,0x9f,0x6b,0x01,0x78,0x03,0x12,0x50,0xf1,0x02,0x10,
-0xe5,0xee,0x17,0x21,0x73,0x35,0x7f,0x1a,0x03,0x00,0x48,0x03,0xf2,0x65,0x20,0x00,
-0xd5,0x95,0x02,0x04,0x29,0x4b,0x02,0x69,0x8a,0x16,0x11,0xb5,0x14,0x21,0x8e,0xff,
-0x77,0x97,0x52,0xad,0x40,0x01,0x7f,0x40,0x68,0x14,0x12,0x99,0x6c,0x0a,0x30,0x0a,
-0x90,0x00,0x9a,0x58,0x30,0x38,0xf3,0x00,0xe2,0x02,0x22,0xed,0xa3,0x24,0x70,0x11,
-0x30,0x65,0x02,0x30,0xed,0xce,0xd3,0x53,0x04,0x42,0xe3,0x00,0x08,0xe0,0x87,0x00,
-0x03,0xbc,0x73,0x02,0x55,0x2a,0x02,0x0b,0x00,0x20,0x07,0xf3,0x72,0x21,0x00,0x1a,
-0x12,0x22,0xef,0xc3,0x6d,0x2b,0x07,0x4b,0x4c,0x12,0x6c,0xf5,0x18,0x51,0x02,0x55,
-0x55,0x58,0xf4,0x76,0x70,0x0f,0x90,0x2c,0x13,0x04,0xf5,0x18,0x14,0x23,0xff,0x03,
-0x12,0xc3,0x43,0x9f,0x34,0x08,0xe1,0x00,0x8b,0x13,0x01,0x11,0x05,0x12,0xd6,0x2c,
-0x16,0x20,0x6f,0x10,0x3b,0x16,0x22,0xee,0xfd,0xf4,0x41,0x1f,0x21,0x8a,0x3b,0x03,
-0x12,0x72,0x8a,0x3b,0x12,0xd6,0x6a,0x0b,0x02,0xde,0x27,0x12,0xf4,0x80,0x67,0x0c,
-0x6f,0x6c,0x12,0xff,0xf2,0x4d,0x1f,0x13,0x0d,0x05,0x0e,0x1e,0x50,0x0d,0x05,0x02,
-0xc1,0x05,0x11,0x21,0x5c,0x4e,0x22,0x20,0x7e,0x88,0x2d,0x18,0x20,0x0b,0x5f,0x0f,
-0x0d,0x05,0x0f,0x04,0x1a,0x00,0x1f,0x32,0x0d,0x05,0x04,0x27,0xef,0xd4,0x0d,0x05,
-0x1d,0xc8,0x0d,0x05,0x11,0x9f,0x0d,0x05,0x00,0x58,0x07,0x05,0x24,0x40,0x02,0x0c,
-0x06,0x00,0x1b,0x06,0x45,0xfe,0xdd,0xdd,0xc1,0x25,0x09,0x40,0x22,0x24,0xf2,0x23,
-0xe5,0x96,0x02,0x86,0x28,0x13,0x03,0xfe,0x04,0x11,0x3f,0xb7,0x53,0x05,0x0f,0x00,
-0x56,0x2f,0xdc,0xcc,0xcd,0xed,0x0a,0x72,0x06,0x87,0x00,0x22,0xde,0xd6,0x1c,0x02,
-0x22,0x04,0xf3,0x87,0x00,0x22,0x0b,0x80,0x04,0x00,0x11,0xd7,0xa3,0x02,0x30,0x34,
-0x9f,0x20,0x87,0x00,0x14,0xdd,0xbb,0x07,0x0f,0x03,0x1a,0x3d,0x10,0x10,0x6c,0x09,
-0x94,0x8f,0xff,0x70,0x00,0x4e,0x07,0xd2,0x03,0xe4,0x62,0x04,0x03,0x74,0x04,0xe0,
-0x30,0x00,0x7b,0x00,0x3e,0x0a,0xa0,0x01,0xe5,0x00,0x3e,0x01,0xbf,0xdf,0x0f,0x14,
-0x22,0x02,0x30,0x44,0x04,0xd1,0x01,0x32,0x3e,0xad,0xdd,0xde,0xff,0xd7,0x3e,0x23,
-0x45,0xf3,0x10,0xdb,0x3b,0x91,0x02,0x44,0x6e,0x00,0x02,0xf0,0x08,0xdd,0xee,0x19,
-0x17,0x11,0x3f,0x69,0x10,0x04,0x06,0x00,0x03,0x7f,0x12,0x20,0x23,0x10,0xd0,0x2a,
-0x30,0x1c,0xed,0xf9,0x11,0x01,0x41,0xba,0x00,0x1d,0x60,0x24,0x3a,0x22,0x07,0xa0,
-0x07,0x00,0x20,0xb0,0x03,0x15,0x00,0x82,0x2e,0x50,0x03,0xe0,0x00,0x1b,0xfe,0xf7,
-0xe4,0x11,0x10,0x00,0x6f,0x87,0xd0,0x33,0x34,0x56,0x8a,0x23,0xe0,0x3d,0xdd,0xfd,
-0xba,0x85,0x03,0xe0,0x35,0x02,0x21,0x34,0x46,0x07,0x00,0x10,0xbd,0x01,0x1a,0x11,
-0x61,0x31,0x2e,0x21,0x07,0xa0,0x50,0x39,0x28,0x08,0xa0,0x24,0x7a,0x16,0x07,0x48,
-0x7b,0x20,0x22,0x20,0x70,0x01,0x00,0x43,0x08,0xd3,0x3d,0xee,0xfb,0x10,0x05,0xe0,
-0x00,0xe6,0x00,0x0b,0x90,0x04,0xe0,0xed,0x04,0xb2,0x00,0xca,0x42,0x4d,0x70,0x04,
-0xe0,0x00,0x19,0xcd,0xc6,0x5a,0x0e,0xf1,0x02,0x01,0x35,0x04,0xe0,0x3e,0xee,0xef,
-0xff,0xdb,0x24,0xe0,0x02,0x32,0xf5,0x00,0x12,0x25,0x70,0x00,0x10,0xdf,0xfc,0x05,
-0x11,0xa2,0x8f,0x17,0x00,0x18,0x34,0x49,0x35,0x40,0x00,0x06,0x18,0x34,0x30,0x05,
-0xef,0xff,0xd2,0x3c,0x21,0x07,0xc2,0x31,0x04,0x21,0x07,0xd2,0x11,0x34,0x10,0x03,
-0x11,0x34,0x10,0xe3,0x8a,0x03,0xf1,0x12,0x01,0x30,0x17,0x00,0x5e,0xff,0x80,0x07,
-0xc0,0x3e,0x02,0xf4,0x02,0xe4,0x07,0xc0,0x3e,0x08,0xa0,0x00,0x89,0x07,0xc0,0x3e,
-0x0a,0x80,0x00,0x6b,0x07,0xc0,0x3e,0x09,0x90,0x0e,0x00,0x70,0x04,0xe1,0x01,0xe5,
-0x07,0xc0,0x3e,0x0d,0x12,0x00,0x07,0x00,0x60,0x01,0x32,0x00,0x07,0xc0,0x3e,0x52,
-0x1f,0xd1,0x27,0xc0,0x3e,0x1e,0xff,0xff,0xec,0x67,0xc0,0x3e,0x01,0x23,0xf0,0x15,
-0x00,0x41,0x02,0xf0,0x04,0x49,0x07,0x00,0x21,0x2b,0xce,0x07,0x00,0x25,0x00,0x07,
-0x07,0x00,0x00,0x10,0x06,0x24,0x06,0xb0,0x96,0x52,0x03,0xc4,0x28,0x12,0x7f,0xe6,
-0x01,0xc3,0x04,0xf3,0x00,0x3e,0x0e,0x50,0x00,0x98,0x00,0x3e,0x0f,0x10,0x5a,0x06,
-0x10,0x6b,0x42,0x5b,0xe4,0x00,0xa8,0x00,0x3e,0x05,0xe6,0x38,0xe1,0x00,0x3e,0x00,
-0x5c,0xda,0x10,0xb9,0x4b,0xc1,0x12,0x22,0x23,0x46,0x85,0x3e,0xbe,0xee,0xfd,0xca,
-0x83,0x3e,0xce,0x01,0x0e,0x06,0x00,0x14,0x3f,0xfd,0x61,0x12,0x30,0x1d,0x14,0x22,
-0x24,0x30,0x0d,0x4d,0x22,0xcd,0xf6,0x6e,0x04,0x22,0x03,0xf4,0xe7,0x03,0x17,0x08,
-0x7f,0x80,0x12,0xc8,0xd9,0x80,0x22,0x07,0xf4,0x08,0x99,0x45,0x07,0xef,0xef,0xd6,
-0x68,0x0c,0x0b,0xf5,0x04,0x60,0x52,0x55,0x5e,0x95,0x54,0x8e,0x57,0x18,0x12,0xd6,
-0x94,0x08,0x22,0x0d,0x60,0x04,0x0a,0x0b,0x0f,0x00,0x11,0xd5,0x71,0x18,0x01,0x6f,
-0x19,0x11,0x00,0x6e,0x04,0x11,0xb6,0xfe,0x03,0x32,0x84,0x35,0xcb,0x6e,0x04,0x13,
-0x01,0xf4,0x08,0x21,0x0f,0x30,0x6e,0x04,0x01,0x29,0x95,0x11,0x0a,0x20,0x0a,0x00,
-0x80,0x7a,0x16,0x10,0x6e,0x04,0x02,0x7b,0x09,0x11,0xed,0xbf,0x66,0x01,0xf8,0x3f,
-0x4a,0x8d,0x44,0x4f,0x61,0xf8,0x3f,0x12,0x6d,0x6e,0x04,0x01,0xf8,0x3f,0x02,0x8c,
-0x0d,0x05,0x89,0x05,0x1a,0x32,0xf8,0x3f,0x31,0x29,0xcd,0xb5,0x87,0x00,0x32,0xa4,
-0x36,0xe7,0xfb,0x07,0x22,0x05,0xf0,0x22,0x05,0x13,0x0f,0xef,0x2f,0x12,0xe5,0x1d,
-0x1b,0x10,0x0e,0x0f,0xa6,0x03,0x1e,0x00,0x32,0x2f,0xa4,0x48,0x62,0x29,0x2e,0xdc,
-0xa3,0x1a,0x6f,0x08,0xcf,0x6e,0x04,0x06,0x18,0x2d,0x34,0x30,0xe5,0x05,0x37,0xe4,
-0x00,0x08,0xf3,0x06,0x22,0x0d,0x70,0x58,0x30,0x43,0x7e,0x30,0x00,0x7f,0xe5,0x05,
-0x1e,0x30,0xe5,0x05,0x20,0xfe,0xee,0x1d,0x22,0x10,0x02,0x74,0x17,0x00,0xe5,0x4f,
-0x04,0xe3,0x89,0x0e,0x9c,0x49,0x0a,0xda,0x1e,0x01,0xc1,0x3b,0x07,0xe5,0x05,0x12,
-0x00,0xe5,0x05,0x13,0xcc,0xeb,0x08,0x0a,0xe5,0x05,0x11,0x06,0xe5,0x05,0x12,0xfd,
-0xe5,0x05,0x11,0x01,0x33,0x00,0x01,0x7e,0x34,0x0d,0xea,0x1d,0x00,0x58,0x31,0x23,
-0x22,0x21,0x12,0x44,0x08,0xf0,0x64,0x12,0x22,0xcc,0x50,0x02,0xea,0x1d,0x05,0x77,
-0x01,0x20,0x43,0x34,0x76,0x88,0x10,0x01,0xbb,0x29,0x1f,0xc5,0xf2,0x0a,0x0d,0x14,
-0x0d,0xe5,0x05,0x21,0x73,0x35,0xf2,0x0a,0x49,0x4a,0xcd,0xc7,0x10,0x76,0x61,0x33,
-0x33,0x33,0x33,0xf3,0x06,0x18,0xe2,0xc1,0x7d,0x13,0x33,0xe5,0x05,0x16,0xff,0x44,
-0x51,0x0b,0x53,0x51,0x00,0xe5,0x05,0x13,0xee,0xe5,0x05,0x1f,0x20,0x79,0x0b,0x15,
-0x15,0x5f,0x87,0x00,0x17,0xc8,0x87,0x00,0x02,0xdf,0x19,0x14,0x07,0xf8,0x36,0x0c,
-0xe2,0x1d,0x30,0x9f,0xdc,0xef,0x53,0x0b,0x21,0x9d,0x20,0x69,0x8e,0x22,0x0e,0x60,
-0xde,0x7c,0x12,0xd7,0xbf,0x3c,0x41,0x06,0xf7,0x32,0x39,0x50,0x5b,0x37,0xbd,0xec,
-0x93,0x59,0x0a,0xd1,0x30,0x00,0x4e,0x04,0xf7,0x38,0xf1,0x00,0x4e,0x0b,0x80,0x00,
-0xb7,0xdf,0x05,0x02,0xff,0x03,0x11,0x5c,0x0c,0x00,0xc0,0x7a,0x00,0x3e,0x0c,0x70,
-0x00,0xc6,0x00,0x3e,0x04,0xf6,0x49,0xb7,0x40,0x16,0x4b,0x05,0x04,0x02,0x06,0x00,
-0xb8,0x01,0x11,0x12,0x35,0x73,0x3e,0xcf,0xff,0xfe,0xdb,0x93,0x18,0x00,0x08,0x8f,
-0x42,0x02,0xa0,0x5e,0x04,0x34,0x29,0xc0,0x79,0x82,0x00,0x00,0xe4,0x0c,0xc7,0xae,
-0x20,0x00,0xe4,0x6e,0xdd,0x02,0x20,0xe4,0xb8,0xb0,0x01,0x20,0xe4,0xd5,0xa2,0x0a,
-0x20,0xe4,0xe4,0x88,0x14,0x11,0xe3,0x0c,0x00,0x20,0xe3,0xb7,0x18,0x00,0x20,0xe3,
-0x7c,0x24,0x00,0xaa,0xe3,0x1e,0x94,0x8f,0x30,0x00,0xe3,0x02,0xac,0xa3,0x96,0x48,
-0x0e,0x6e,0x6d,0x20,0x71,0x00,0x78,0x8d,0x40,0x73,0x06,0xfd,0xfb,0x7d,0x70,0x51,
-0x40,0x1c,0x70,0x00,0xd6,0x51,0x12,0x20,0xd6,0xb7,0x12,0x06,0x11,0xd6,0xef,0x10,
-0x20,0xd6,0x9a,0x10,0x10,0x30,0xc6,0x4f,0x30,0xda,0x00,0x30,0x08,0xfd,0xfa,0x72,
-0x09,0x24,0x13,0x20,0xbe,0x80,0x13,0x41,0x81,0x29,0x33,0x9f,0xee,0xee,0x76,0x11,
-0x0f,0xdb,0x62,0x05,0x11,0xb2,0x06,0x00,0x71,0x51,0x03,0xcf,0xd6,0x00,0x00,0xd5,
-0xaf,0x14,0x20,0xd5,0x7c,0x3b,0x1e,0x11,0xd5,0xae,0x14,0x11,0xd5,0x6c,0x00,0x20,
-0xd5,0xa8,0x78,0x00,0x20,0xd5,0x7d,0xd9,0x04,0x11,0xd5,0xac,0x14,0x44,0xd5,0x02,
-0xad,0xb4,0x07,0x71,0x11,0xd4,0x15,0x1c,0x11,0xd4,0x3f,0x03,0x13,0xc3,0x45,0x03,
-0x07,0x06,0x00,0x00,0xeb,0x33,0x27,0xef,0xf8,0x75,0x29,0x11,0x30,0xbe,0x13,0x11,
-0xd6,0xbd,0x13,0x11,0xd5,0xbc,0x13,0x11,0xc5,0x0a,0x10,0x20,0xc5,0xc7,0x6c,0x00,
-0x21,0xc5,0x9b,0x12,0x00,0x01,0xb8,0x13,0x11,0xd5,0x88,0x10,0x02,0x66,0x00,0x13,
-0xb3,0x29,0x77,0x00,0x65,0x83,0x13,0xf3,0xc0,0x00,0x00,0x12,0x00,0x11,0xe4,0x85,
-0x10,0x01,0xa8,0x4c,0x03,0x84,0x10,0x3b,0x31,0x00,0x2e,0x72,0x67,0x11,0x51,0x72,
-0x00,0x80,0xe5,0x2f,0x72,0x6f,0x40,0x00,0xd5,0xaa,0x40,0x24,0x20,0xd5,0xc6,0x66,
-0x0f,0x20,0xd5,0xc7,0x5b,0x1e,0x20,0xd5,0x9a,0x5a,0x02,0xa4,0xd5,0x2f,0x84,0x7f,
-0x40,0x00,0xe4,0x02,0xbd,0xb4,0x1a,0x01,0xd1,0x92,0x00,0x22,0x22,0x01,0x22,0x20,
-0x07,0xff,0xff,0x48,0xef,0xf4,0xe6,0x03,0x80,0xc5,0x00,0x12,0x2d,0x50,0x00,0xc5,
-0x07,0x67,0x35,0x11,0xc5,0x8b,0x07,0xd1,0xd5,0x08,0xb2,0x22,0x20,0x00,0xd5,0x05,
-0xef,0xfe,0xc0,0x00,0xa3,0xb6,0x01,0x1f,0x83,0xb6,0x01,0x27,0x00,0xae,0x88,0x01,
-0x54,0x26,0x11,0x5f,0x51,0x72,0x02,0xd5,0x17,0x08,0x06,0x00,0x11,0x4f,0x24,0x2d,
-0x06,0xe0,0x17,0x11,0x32,0xd8,0x00,0x11,0xb7,0x4a,0x01,0x11,0xb7,0x4a,0x01,0x11,
+0x0c,0x43,0xf0,0xe2,0x0e,0x40,0x00,0x08,0x00,0xf3,0x06,0x0d,0x43,0xf0,0xe2,0x0d,
+0x40,0x00,0x2f,0x1d,0x32,0xf1,0xf2,0x0d,0x40,0x00,0x1e,0xfe,0x11,0xef,0xe0,0x0d,
+0xb0,0x06,0x05,0x08,0x00,0x1f,0x50,0x08,0x00,0x03,0x12,0x04,0x0b,0x01,0x00,0xf9,
+0x02,0xe7,0x0b,0x01,0x61,0x80,0xb1,0x2f,0x10,0x00,0x0f,0x13,0xd3,0xc0,0xe2,0x1f,
+0x08,0x00,0xf0,0x05,0xcc,0xd3,0xfc,0xf2,0x1f,0x54,0x30,0x0f,0x78,0xc3,0xd5,0xf2,
+0x1f,0xee,0xb0,0x0f,0x24,0xc3,0xc0,0xf2,0x18,0x00,0xd3,0x35,0xc3,0xc1,0xf1,0x1f,
+0x10,0x00,0x0b,0xff,0x81,0xef,0xd0,0x1f,0x48,0x00,0x30,0x0a,0x00,0x00,0xc9,0x0c,
+0x20,0x33,0x42,0x0c,0x00,0x56,0xff,0xff,0xfe,0xfe,0x00,0x9a,0x05,0x21,0x01,0x44,
+0x05,0x0b,0x01,0x89,0x01,0x10,0xe9,0x08,0x00,0x13,0x80,0x8c,0x00,0x11,0xa2,0xba,
+0x08,0x20,0x00,0x09,0xaa,0x03,0x1b,0x40,0x32,0x03,0xf1,0x07,0x80,0x90,0x1a,0x07,
+0x08,0x30,0x2f,0x0f,0x11,0xf2,0xe0,0xb5,0x02,0xf0,0xf1,0x1f,0x2e,0x0b,0x50,0x2f,
+0x0f,0x21,0x0d,0x00,0xf1,0x00,0xf4,0x4f,0x2e,0x2c,0x50,0x2f,0x0f,0xee,0xf2,0xfe,
+0xf5,0x02,0xf0,0xf2,0x2e,0x1a,0x00,0x40,0x22,0xe1,0xe0,0xb5,0x0d,0x00,0x31,0x1e,
+0x0c,0x40,0x0d,0x00,0xe0,0xc4,0x02,0xf0,0xf6,0x7e,0x1e,0x4d,0x40,0x2f,0x09,0xcc,
+0x80,0xac,0xb1,0xaf,0x0e,0x05,0xdb,0x0c,0x09,0x0d,0x00,0x27,0x01,0xe0,0xe9,0x0c,
+0x13,0x29,0xe9,0x06,0x22,0x5e,0x00,0x04,0x04,0x13,0x4e,0x45,0x03,0x10,0x4e,0xbe,
+0x02,0x12,0xf1,0xcd,0x00,0x13,0x05,0x08,0x00,0x22,0x09,0xf6,0x08,0x00,0x20,0x0e,
+0xcd,0x8f,0x07,0xd0,0xf2,0x00,0x4f,0x1e,0x40,0x00,0x3f,0x33,0x20,0x00,0xc9,0x07,
+0xc0,0xe6,0x07,0x61,0x04,0xe1,0x00,0xe5,0x00,0x3e,0xda,0x03,0x10,0x6e,0x08,0x00,
+0x73,0x6a,0x00,0x00,0x0a,0x30,0x3e,0x00,0xb0,0x07,0x0f,0x08,0x00,0x0a,0x50,0x00,
+0x00,0x02,0x00,0x00,0x10,0x00,0x01,0x00,0xf0,0x38,0x07,0x00,0x00,0x00,0x0b,0x40,
+0x00,0x03,0xf0,0x00,0x00,0x00,0xd5,0x00,0x00,0x3f,0x00,0x00,0x00,0x1f,0x30,0x00,
+0x02,0xf0,0x00,0x00,0x05,0xf0,0x00,0x00,0x2f,0x00,0x00,0x00,0xcf,0x80,0x00,0x02,
+0xff,0xfd,0x00,0x5f,0x5f,0x40,0x00,0x2f,0x32,0x10,0x1e,0x60,0x5e,0x20,0x02,0xf0,
+0x00,0x1d,0xa0,0x00,0x6e,0x20,0x2f,0x00,0x0b,0x90,0x00,0x00,0x55,0x02,0xf0,0x00,
+0x10,0x4b,0x00,0xf1,0x02,0x09,0x00,0x00,0x00,0x23,0x33,0x33,0x33,0x10,0x00,0x00,
+0x5f,0xee,0xee,0xee,0xfd,0x00,0x01,0x00,0x22,0x05,0xe0,0x08,0x00,0x1f,0x5e,0x0f,
+0x00,0x02,0x22,0x03,0xa0,0x08,0x00,0x22,0x2a,0x00,0x80,0x00,0x10,0x4f,0x08,0x00,
+0x12,0xe5,0x88,0x00,0x22,0x01,0xf3,0x08,0x00,0x22,0x06,0xf0,0x08,0x00,0x22,0x0c,
+0xf6,0x08,0x00,0xf0,0x11,0x5f,0x7f,0x30,0x00,0x3f,0xee,0xe0,0x01,0xe7,0x07,0xe1,
+0x00,0x3f,0x33,0x20,0x0c,0xa0,0x00,0x8d,0x10,0x3e,0x00,0x00,0xab,0x00,0x00,0x07,
+0x50,0x3e,0x00,0x00,0x20,0x43,0x00,0x13,0x3e,0xdb,0x00,0x00,0x08,0x00,0x22,0x0f,
+0x30,0x60,0x00,0x22,0x1f,0x30,0x6c,0x00,0x0c,0x08,0x00,0x50,0x0f,0xfe,0xee,0xee,
+0xfe,0x70,0x00,0x70,0x33,0x33,0x33,0x32,0x00,0x00,0x00,0xce,0x00,0x13,0x16,0x90,
+0x00,0x01,0xa7,0x00,0x12,0xe4,0x08,0x00,0x22,0x02,0xf2,0x08,0x00,0xf0,0x0c,0x07,
+0xf1,0x00,0x00,0x4e,0x00,0x00,0x00,0x0d,0xfa,0x00,0x00,0x4f,0xff,0xe0,0x00,0x7e,
+0x3e,0x70,0x00,0x4e,0x22,0x10,0x03,0xf4,0x03,0xf5,0x18,0x00,0xf6,0x00,0x2e,0x70,
+0x00,0x3e,0x40,0x4e,0x00,0x00,0xb6,0x00,0x00,0x02,0x30,0x3d,0x00,0x01,0x00,0x50,
+0x0d,0x10,0x00,0x00,0x2b,0x70,0x00,0x13,0x20,0x98,0x00,0x40,0xee,0xee,0xee,0xee,
+0x08,0x00,0x48,0x43,0x33,0x32,0x5e,0x18,0x00,0x40,0x31,0x11,0x11,0x5e,0x30,0x00,
+0x43,0xff,0xff,0xff,0xfa,0x3c,0x00,0x01,0x90,0x00,0x12,0xc5,0x78,0x00,0x00,0x98,
+0x00,0x13,0x4e,0x20,0x01,0x22,0x4e,0x00,0xa9,0x01,0x10,0x4e,0x20,0x01,0x10,0xf8,
+0x90,0x00,0x50,0xf0,0x00,0x5f,0x5f,0x50,0x90,0x00,0x70,0x01,0xe6,0x05,0xf3,0x00,
+0x4e,0x00,0xab,0x01,0xb1,0x5e,0x20,0x4e,0x00,0x00,0xb9,0x00,0x00,0x04,0x50,0x4e,
+0xde,0x00,0x03,0x70,0x01,0x40,0x17,0xbd,0xb8,0x20,0x48,0x00,0x40,0xec,0x64,0x5a,
+0xf4,0x07,0x02,0x93,0xc0,0x00,0x00,0x8d,0x00,0x00,0x00,0x0e,0x60,0x70,0x01,0x40,
+0x90,0x00,0x00,0x6e,0xa4,0x01,0x40,0xf9,0x31,0x38,0xf6,0x30,0x00,0x43,0x3a,0xde,
+0xda,0x40,0xb7,0x01,0xf1,0x04,0x00,0x16,0x00,0x01,0x90,0x00,0x2f,0x00,0x5c,0x00,
+0x04,0xe0,0x00,0x3f,0x00,0x5c,0x00,0x05,0xd0,0x07,0x00,0x21,0x06,0xc0,0x07,0x00,
+0x21,0x08,0xa0,0x07,0x00,0xf1,0x01,0x0c,0xe0,0x00,0x3f,0x33,0x8c,0x00,0x0f,0xf4,
+0x00,0x3f,0xee,0xec,0x00,0x6d,0x8b,0x15,0x00,0xf0,0x0c,0xd6,0x1f,0x20,0x2f,0x00,
+0x5c,0x05,0xe0,0x09,0xa0,0x2f,0x00,0x5c,0x0e,0x40,0x01,0xf2,0x2f,0x00,0x5c,0x89,
+0x00,0x00,0x79,0x2f,0x00,0x5c,0x8e,0x00,0x00,0x54,0x00,0x08,0x07,0x00,0x17,0x5d,
+0x07,0x00,0x40,0x00,0x00,0x15,0x00,0x89,0x01,0xf0,0x32,0x00,0x32,0x00,0x00,0x93,
+0x00,0x0e,0x30,0xb8,0x00,0x00,0xe6,0x00,0x0e,0x40,0xa8,0x00,0x00,0xf4,0x00,0x0e,
+0x40,0xa9,0x00,0x03,0xf1,0x00,0x0e,0x51,0xa9,0x00,0x09,0xf6,0x00,0x0e,0xff,0xf8,
+0x00,0x1f,0x9f,0x20,0x0e,0x50,0xa8,0x00,0xbb,0x09,0xc0,0x0e,0x40,0xa8,0x08,0xe1,
+0x00,0xca,0x0e,0x40,0xa8,0x4e,0x20,0x00,0x0a,0x1e,0x40,0xa8,0x46,0x00,0x30,0x04,
+0x00,0x53,0xb0,0x02,0x90,0x44,0x44,0x30,0x00,0x00,0xce,0xee,0xdd,0xdd,0x03,0x01,
+0x02,0x7d,0x02,0x0e,0x07,0x00,0x03,0x1c,0x00,0x11,0xa2,0xc2,0x02,0x92,0x00,0x74,
+0x00,0x00,0xb5,0x00,0x0f,0x40,0xc7,0x7e,0x00,0x12,0xb8,0x7e,0x00,0x30,0xb8,0x00,
+0x04,0x7e,0x00,0x41,0xb8,0x00,0x0a,0xf7,0x7e,0x00,0x30,0x2f,0x9f,0x20,0x15,0x00,
+0xd0,0xbb,0x08,0xd0,0x0e,0x40,0xb7,0x08,0xe1,0x00,0xbb,0x0e,0x40,0xb7,0x7e,0x00,
+0x35,0x1c,0x30,0xa6,0x12,0x02,0xf2,0x00,0x3d,0xdd,0xdd,0xde,0xd2,0x00,0x00,0x6e,
+0x44,0x44,0x44,0xf4,0x00,0x00,0x6d,0x6b,0x02,0x0a,0x07,0x00,0xc2,0x5f,0xcb,0xbb,
+0xcc,0xf3,0x00,0x00,0x03,0x55,0x54,0x44,0x20,0x7a,0x01,0x10,0x43,0xfc,0x00,0x30,
+0x1f,0x20,0xa9,0x7e,0x00,0x01,0x07,0x00,0x50,0xf4,0x00,0x0f,0x20,0x99,0xfc,0x00,
+0xf2,0x17,0x0f,0x30,0xa9,0x00,0x09,0xf5,0x00,0x0f,0xff,0xf9,0x00,0x1f,0xae,0x10,
+0x0f,0x30,0x99,0x00,0xbb,0x0a,0xb0,0x0f,0x20,0x99,0x08,0xe1,0x00,0xd9,0x0f,0x20,
+0x98,0x4e,0x20,0x00,0x1a,0x1f,0x20,0xa8,0xf6,0x03,0x11,0x97,0xf1,0x02,0x10,0x10,
+0x52,0x00,0xe2,0xcf,0xee,0xfc,0x30,0x00,0x00,0x2f,0x81,0x00,0x19,0xe0,0x00,0x00,
+0x7e,0x77,0x00,0x12,0x6e,0xf5,0x00,0xb2,0x1d,0xb4,0x12,0x5c,0xc0,0x00,0x00,0x01,
+0x9d,0xed,0xb6,0xb2,0x00,0x10,0x28,0x28,0x02,0x30,0x60,0x00,0x04,0xc6,0x03,0x11,
+0xd6,0x77,0x02,0x00,0x47,0x03,0xe1,0x04,0xfd,0xdb,0x00,0x05,0xf2,0x00,0x00,0x3f,
+0x54,0x30,0x00,0xdf,0xb0,0x4d,0x04,0x30,0x6e,0x2d,0x80,0x45,0x02,0xf1,0x05,0x3f,
+0x50,0x2e,0x60,0x03,0xfa,0xa8,0x2e,0x70,0x00,0x2e,0x50,0x3f,0x77,0x49,0x60,0x00,
+0x00,0x13,0x04,0x02,0x04,0x12,0x01,0xcb,0x02,0x40,0x02,0xf1,0x03,0xd0,0x08,0x00,
+0x30,0x8e,0x00,0x01,0x07,0x00,0x21,0x1e,0xf5,0x66,0x00,0x21,0x0b,0xd8,0x70,0x02,
+0xf2,0x05,0x1b,0xe2,0x05,0xf9,0x00,0x00,0x00,0x2d,0xc1,0x00,0x02,0xdb,0x00,0x00,
+0x06,0x60,0x00,0x00,0x00,0x82,0x87,0x00,0xf1,0x03,0x08,0x10,0x00,0x0a,0x50,0x00,
+0x00,0xe3,0x00,0x00,0xc6,0x00,0x00,0x0e,0x30,0x00,0x0d,0x60,0x0d,0x00,0x11,0xf4,
+0x0d,0x00,0x20,0x1f,0x40,0xc3,0x00,0xf3,0x1f,0x06,0xfa,0x0a,0xff,0xff,0x40,0x00,
+0xac,0xf1,0x12,0x22,0xe4,0x00,0x1f,0x4b,0x80,0x00,0x0e,0x40,0x08,0xc0,0x4f,0x10,
+0x00,0xe4,0x02,0xf3,0x00,0xc9,0x00,0x0e,0x40,0xb9,0x00,0x03,0xf2,0x00,0xe4,0x3d,
+0x00,0x00,0x07,0x60,0x0e,0x40,0x00,0xe7,0x03,0x00,0xfe,0x02,0x02,0x16,0x04,0x18,
+0xe3,0x0d,0x00,0x22,0x10,0x00,0x77,0x02,0x31,0x00,0x04,0xb0,0xf7,0x00,0x20,0x6d,
+0x00,0x72,0x00,0x21,0x08,0xc0,0x0d,0x00,0xf1,0x17,0xc8,0x00,0x35,0x5d,0x60,0x00,
+0x2f,0xd0,0x0a,0xdc,0xf5,0x00,0x0a,0xcd,0x80,0x00,0x0d,0x50,0x05,0xf2,0x2e,0x60,
+0x00,0xd5,0x03,0xf5,0x00,0x3f,0x50,0x0d,0x52,0xe6,0x00,0x00,0x3c,0x00,0xd5,0x12,
+0x76,0x01,0xe7,0x20,0x00,0x12,0x33,0x33,0x33,0x30,0x00,0x09,0xfe,0xee,0xee,0xef,
+0x40,0x61,0x02,0x28,0x0e,0x50,0x0d,0x00,0x02,0x1a,0x00,0x20,0xb2,0x00,0x14,0x01,
+0x51,0x06,0x10,0x00,0x05,0xc0,0xda,0x00,0x11,0x6c,0x1a,0x00,0x21,0x09,0xa0,0xa9,
+0x00,0xf3,0x17,0xd7,0x00,0x55,0x5e,0x40,0x00,0x3f,0xd0,0x1c,0xcc,0xf4,0x00,0x0b,
+0xac,0x90,0x00,0x0e,0x40,0x06,0xe1,0x2f,0x40,0x00,0xe4,0x04,0xf4,0x00,0x4e,0x30,
+0x0e,0x42,0xe5,0x00,0x00,0x5d,0x00,0xe4,0x13,0x4e,0x00,0x11,0x06,0xdd,0x00,0x00,
+0x96,0x01,0x21,0x0a,0x20,0xda,0x03,0x12,0x00,0xf0,0x05,0x13,0x00,0x0d,0x00,0xb1,
+0x02,0xfe,0xee,0xee,0xff,0x80,0x00,0x02,0x33,0x33,0x32,0x64,0x02,0x00,0x31,0x00,
+0x21,0x07,0xa0,0x75,0x00,0x11,0x99,0x41,0x00,0x20,0x0c,0x70,0x41,0x00,0x30,0x02,
+0xfa,0x02,0x52,0x01,0xf1,0x0a,0xbb,0xe5,0x02,0x22,0xe4,0x00,0x6e,0x14,0xe2,0x00,
+0x0e,0x40,0x4f,0x40,0x07,0xe1,0x00,0xe4,0x3f,0x50,0x00,0x07,0xa0,0x0e,0x43,0x2c,
+0x01,0x60,0xd2,0x00,0x00,0x11,0x11,0x12,0x03,0x06,0x40,0xff,0xff,0xff,0xf3,0x0d,
+0x00,0x60,0x10,0x0e,0x40,0x00,0x03,0x33,0xe2,0x02,0x82,0x06,0xff,0xff,0xff,0xfe,
+0x10,0x00,0x6e,0x64,0x00,0xb3,0xf2,0x22,0x23,0x33,0x10,0x00,0x3e,0xff,0xff,0xee,
+0xe7,0x54,0x04,0x34,0x00,0x03,0x80,0xea,0x00,0x51,0x0f,0x40,0x00,0x07,0xb0,0xea,
+0x00,0xe0,0xb8,0x00,0x45,0x5e,0x40,0x00,0x2f,0xc0,0x0c,0xdc,0xf4,0x00,0x0a,0xbd,
+0xc7,0x01,0xb1,0x05,0xf2,0x2e,0x50,0x00,0xe4,0x04,0xf5,0x00,0x4f,0x40,0xea,0x00,
+0x30,0x4b,0x00,0xe4,0x5f,0x01,0x00,0xdd,0x00,0x40,0x00,0x39,0xcc,0xa5,0x22,0x06,
+0xd0,0x95,0x47,0xea,0x00,0x00,0x0f,0x60,0x00,0x02,0xf3,0x00,0x03,0xf1,0xad,0x01,
+0x00,0x15,0x02,0xe3,0x01,0xf4,0x00,0x00,0x8e,0x62,0x25,0xdc,0x00,0x00,0x00,0x6c,
+0xed,0xc6,0xe9,0x00,0x80,0x29,0x00,0x04,0xa0,0x00,0x0f,0x30,0x4d,0xba,0x04,0x30,
+0x0f,0x30,0x5d,0x76,0x00,0x00,0x07,0x00,0x91,0x08,0x90,0x00,0x0e,0x30,0x5d,0x00,
+0x0b,0x80,0x07,0x00,0xf0,0x08,0x0e,0xd0,0xbe,0xef,0x40,0x5d,0x00,0x2f,0xf3,0x23,
+0x3e,0x40,0x4d,0x00,0x9a,0xa9,0x00,0x0e,0x40,0x4d,0x00,0xf4,0x3f,0x07,0x00,0xf2,
+0x06,0x08,0xb0,0x0c,0x60,0x0e,0x30,0x4d,0x2e,0x20,0x04,0xe0,0x0e,0x30,0x4d,0x97,
+0x00,0x00,0xa2,0x0e,0x30,0x4d,0x3b,0x02,0x11,0x4d,0x5d,0x06,0x03,0x07,0x00,0x22,
+0x20,0x4e,0x03,0x06,0x03,0x11,0x06,0x17,0x02,0xc8,0x04,0x30,0x0f,0x30,0xb8,0xfb,
+0x01,0x18,0x0f,0xc8,0x04,0xf0,0x0a,0x15,0x5f,0x40,0xa9,0x00,0x09,0xf7,0x2b,0xbf,
+0x40,0xa8,0x00,0x1f,0x8f,0x20,0x0d,0x40,0xa8,0x00,0xbb,0x08,0xd1,0x0d,0x50,0xa8,
+0x4a,0x04,0x20,0x0d,0x50,0xc8,0x04,0x27,0x09,0x1d,0xc8,0x04,0xbf,0x35,0x55,0x55,
+0x55,0x50,0x00,0x00,0xad,0xcc,0xcc,0xcc,0xc8,0x04,0x17,0x12,0x27,0xc8,0x04,0x10,
+0x4d,0x4a,0x04,0x01,0x07,0x00,0x11,0xf5,0xd9,0x00,0xf1,0x01,0x03,0xf2,0x02,0x2e,
+0x40,0x4e,0x00,0x07,0xf4,0x3f,0xff,0x40,0x4d,0x00,0x0e,0xdd,0x15,0x00,0xd0,0x7e,
+0x1c,0x90,0x0e,0x40,0x4d,0x03,0xf4,0x02,0xe6,0x0d,0x50,0x4d,0xe3,0x06,0x40,0x1d,
+0x40,0x4d,0x24,0xd2,0x00,0x52,0x40,0x5d,0x00,0x00,0x42,0x07,0x00,0x50,0xc8,0x00,
+0x04,0x00,0x49,0x07,0x00,0x01,0x01,0x00,0x03,0x07,0x00,0x12,0xc7,0x07,0x00,0x84,
+0xbf,0xee,0xee,0xef,0xfa,0x00,0x00,0x13,0x64,0x02,0xa2,0x01,0x00,0x21,0x00,0x00,
+0xa4,0x00,0x0f,0x30,0xb7,0xfc,0x00,0x10,0xb7,0xcf,0x06,0xf0,0x18,0x0e,0x40,0xa7,
+0x00,0x05,0xf3,0x3f,0xff,0x40,0xa7,0x00,0x0c,0xec,0x02,0x2e,0x40,0xa8,0x00,0x5f,
+0x1c,0x90,0x0d,0x50,0xa8,0x02,0xe6,0x01,0xe7,0x0d,0x50,0xa7,0x1d,0x90,0x00,0x3e,
+0x2d,0x50,0xa7,0x37,0x01,0x04,0xf6,0x00,0x20,0x96,0x00,0x00,0x02,0x22,0x22,0x33,
+0x20,0x00,0x00,0x8f,0xff,0xfe,0xee,0xf5,0x00,0xf2,0x00,0x02,0x22,0x33,0x33,0xe5,
+0x00,0x00,0x9f,0xff,0xfe,0xee,0xd2,0x00,0x00,0x9a,0x18,0x00,0x30,0x9b,0x22,0x22,
+0xdb,0x07,0x52,0x6f,0xff,0xff,0xee,0xe9,0xf8,0x01,0x10,0x38,0x4f,0x07,0x32,0x0f,
+0x40,0x5e,0xfc,0x00,0x12,0x5e,0x7a,0x01,0xf1,0x1b,0x5e,0x00,0x04,0xf2,0x2c,0xcf,
+0x40,0x5e,0x00,0x0a,0xf8,0x04,0x5e,0x40,0x4e,0x00,0x2f,0x6f,0x40,0x0d,0x50,0x4e,
+0x00,0xca,0x06,0xe2,0x0d,0x50,0x5e,0x0a,0xd0,0x00,0x9d,0x0d,0x50,0x5e,0x4c,0x10,
+0x00,0x06,0x1c,0x30,0x8f,0x06,0x30,0x21,0x00,0x3b,0x07,0x00,0x12,0xe6,0xbf,0x02,
+0x11,0xf3,0x07,0x00,0x21,0x0c,0xfc,0x07,0x00,0x30,0x9f,0x3c,0xd1,0x92,0x02,0xd0,
+0xf4,0x00,0xae,0x30,0x00,0x01,0xcd,0x20,0x00,0x07,0xf4,0x00,0x01,0xc0,0x04,0x11,
+0x33,0xd5,0x03,0x91,0x02,0x60,0x00,0x00,0x7c,0x00,0x00,0x06,0xe0,0x07,0x00,0x00,
+0x13,0x09,0xf1,0x00,0xaa,0x00,0x6e,0xef,0xe0,0x00,0x00,0xe7,0x00,0x03,0x37,0xe0,
+0x00,0x05,0xfd,0x15,0x00,0xd0,0x0d,0x9d,0x90,0x15,0x58,0xe0,0x00,0x8e,0x02,0xf5,
+0x5b,0xcd,0xe0,0xcc,0x07,0xb1,0x30,0x05,0xe0,0x3f,0x40,0x00,0x05,0xd0,0x05,0xd0,
+0x22,0xc1,0x01,0x41,0xd0,0x00,0x00,0x60,0x07,0x00,0x61,0x01,0xf2,0x00,0x00,0x03,
+0x90,0x07,0x00,0x2b,0x00,0x00,0x07,0x00,0x61,0x00,0xff,0xee,0xee,0xff,0xf1,0x9a,
+0x09,0x22,0x32,0x10,0xdc,0x03,0x08,0x1e,0x00,0x22,0x5f,0x00,0x72,0x05,0x12,0xf2,
+0x9e,0x09,0x21,0xfd,0xc0,0x99,0x02,0x30,0xe7,0x1e,0xb0,0x24,0x00,0xc0,0xea,0x00,
+0x2d,0xb0,0x00,0x00,0x03,0xe9,0x00,0x00,0x1c,0xd2,0x30,0x01,0x12,0x14,0x85,0x05,
+0x11,0x05,0xb3,0x05,0x02,0xa3,0x06,0x00,0x52,0x00,0x00,0x0f,0x00,0x91,0x24,0x44,
+0x44,0x9d,0x44,0x44,0x44,0x09,0xdd,0x01,0x00,0x62,0xd2,0x00,0x00,0x00,0x29,0x00,
+0x61,0x0a,0x03,0x2d,0x00,0x12,0xde,0x5b,0x04,0x31,0x9e,0xbd,0x10,0x07,0x00,0xf7,
+0x04,0x30,0xae,0x30,0x00,0x00,0x03,0xdd,0x20,0x00,0x7f,0x70,0x00,0x00,0xa7,0x00,
+0x4c,0x00,0x2a,0x20,0x5a,0x00,0x10,0x5d,0xe3,0x01,0x11,0xff,0x01,0x00,0x85,0xf2,
+0x02,0x22,0x11,0x11,0x11,0x12,0x21,0x35,0x07,0x40,0x4f,0xff,0xff,0xff,0xaf,0x09,
+0x53,0x12,0x22,0x22,0x15,0xf0,0x13,0x00,0x02,0x07,0x00,0x1a,0x04,0x0f,0x00,0x23,
+0x02,0xa0,0x57,0x04,0x08,0x78,0x0a,0x12,0x9c,0x07,0x00,0x21,0x2f,0xf6,0x07,0x00,
+0x21,0x1d,0xa5,0x08,0x00,0x40,0x4e,0xa0,0x04,0xf9,0xb5,0x01,0xc4,0x70,0x15,0x02,
+0xcd,0x10,0x00,0x05,0x10,0x05,0xd0,0x00,0x40,0x87,0x00,0xf4,0x01,0x01,0x44,0x44,
+0x48,0xe4,0x44,0x44,0x40,0x7e,0xee,0xed,0xdd,0xdd,0xee,0xed,0x10,0x87,0x00,0x22,
+0x0c,0x20,0x08,0x00,0x13,0xf3,0x45,0x0a,0x12,0x30,0x57,0x01,0x04,0x0f,0x00,0x00,
+0x76,0x01,0x11,0x50,0xf0,0x02,0x21,0x33,0x20,0x6c,0x09,0x0b,0x0e,0x01,0x02,0x48,
+0x00,0x21,0x8e,0xcc,0x08,0x00,0xc0,0x8f,0x41,0xcd,0x20,0x00,0x00,0x02,0xce,0x30,
+0x00,0x9f,0x60,0x39,0x03,0x34,0x4c,0x00,0x4c,0x0e,0x01,0x00,0xe5,0x02,0x44,0x7d,
+0x22,0x22,0x23,0x0e,0x01,0x05,0x07,0x01,0x40,0x01,0x8c,0xdc,0x82,0xdf,0x00,0x30,
+0xfb,0x53,0x5b,0x74,0x00,0x52,0xbb,0x00,0x00,0x0a,0xb0,0xbc,0x09,0x00,0xb6,0x00,
+0x50,0xc9,0x00,0x00,0x09,0xc0,0xbb,0x09,0x30,0x32,0x49,0xf4,0x26,0x00,0x23,0xad,
+0xec,0x3a,0x07,0x00,0x97,0x01,0x11,0xc4,0xb9,0x07,0x10,0xe4,0x6e,0x0a,0x20,0x02,
+0xf2,0x06,0x00,0x11,0x07,0x06,0x00,0x20,0x0e,0xec,0x06,0x00,0x10,0x9d,0x66,0x03,
+0xf7,0x08,0x06,0xf2,0x02,0xe8,0x00,0x3e,0x6e,0x30,0x00,0x2e,0x40,0x3e,0x62,0x00,
+0xb0,0x01,0x10,0x3e,0x00,0x01,0xf1,0x00,0x00,0x06,0x00,0xe7,0x20,0x3e,0x9c,0xcc,
+0xfd,0xef,0xe4,0x3e,0x34,0x44,0x43,0x20,0x00,0x3e,0x4d,0x06,0x12,0x3e,0x9e,0x00,
+0x01,0x99,0x04,0x08,0x6b,0x06,0x23,0x00,0x6e,0x38,0x01,0x12,0xf5,0xc2,0x07,0x21,
+0xf8,0xf4,0x3c,0x02,0x30,0xf5,0x07,0xf4,0x0e,0x00,0xc3,0xf5,0x00,0x06,0xf7,0x00,
+0x00,0x0d,0xc2,0x00,0x00,0x03,0xc7,0xc3,0x0b,0x05,0x01,0x00,0xc1,0x7c,0xcc,0xcc,
+0xcc,0xcc,0xdd,0xde,0x22,0x55,0x55,0x57,0xf4,0xae,0x09,0x2a,0x00,0x3f,0x5a,0x00,
+0x0f,0x0f,0x00,0x03,0x04,0x46,0x00,0x16,0x29,0xa6,0x02,0x00,0x01,0x00,0x12,0xcd,
+0x07,0x00,0x22,0x6f,0xea,0xff,0x02,0xfa,0x03,0x62,0xdb,0x10,0x00,0x00,0x01,0x9f,
+0x50,0x01,0xbd,0x30,0x00,0x00,0xdb,0x20,0x00,0x00,0x6e,0x7d,0x00,0x08,0x88,0x02,
+0x82,0x22,0x2e,0x62,0x22,0x22,0x00,0x00,0x40,0x2a,0x08,0x10,0x1f,0xd9,0x06,0x01,
+0x16,0x0c,0x11,0xe3,0x52,0x02,0x03,0x25,0x08,0x13,0xf1,0x5d,0x0c,0x1b,0xfe,0x01,
+0x02,0x0f,0x0f,0x03,0x05,0x1b,0x20,0x0f,0x03,0x40,0x80,0x00,0x00,0xa6,0xa1,0x0b,
+0x05,0x87,0x00,0x12,0x7f,0x80,0x00,0x72,0x21,0x33,0x22,0x24,0xf2,0x22,0x22,0x23,
+0x0b,0x02,0x01,0x00,0x02,0x35,0x08,0x04,0x7a,0x00,0x22,0x0a,0xf4,0xe8,0x00,0x21,
+0xfa,0xf5,0x68,0x00,0x10,0xf6,0x51,0x01,0xe0,0x00,0x2b,0xe4,0x00,0x03,0xeb,0x10,
+0x00,0x07,0x80,0x00,0x00,0x01,0x85,0x18,0x00,0x1a,0x1a,0x2b,0x03,0x13,0x7e,0x95,
+0x01,0x12,0xd0,0x3c,0x00,0x21,0xfd,0xa0,0xc4,0x00,0x30,0xe6,0x2e,0x80,0x07,0x00,
+0xc0,0xe9,0x00,0x3e,0x90,0x00,0x00,0x04,0xe9,0x00,0x00,0x2e,0xb1,0x2b,0x06,0x33,
+0x00,0x00,0x18,0x00,0x0c,0x0d,0x01,0x00,0xb3,0x6f,0xff,0xee,0xee,0xee,0xff,0xff,
+0x10,0x33,0x33,0x33,0xf1,0x00,0x13,0x19,0x77,0x01,0x03,0x78,0x03,0x12,0xdf,0x20,
+0x03,0x30,0xae,0x9e,0x30,0x1e,0x02,0xf0,0x00,0xbe,0x30,0x7f,0x60,0x00,0x00,0x06,
+0xfb,0x10,0x00,0x4d,0xc1,0x00,0x00,0x63,0xec,0x02,0x40,0x10,0x00,0x21,0x11,0x2f,
+0x08,0x12,0x20,0xf0,0x00,0x15,0xfe,0x00,0x01,0xd6,0x03,0x33,0x33,0x34,0x30,0x00,
+0x00,0x02,0xde,0xee,0xee,0xde,0xe0,0xe2,0x01,0xc2,0x01,0x22,0x22,0x25,0xf0,0x00,
+0x00,0x1f,0xff,0xff,0xff,0xec,0x9c,0x0d,0x01,0x77,0x01,0x40,0x41,0x11,0x22,0x23,
+0x6f,0x00,0x48,0xff,0xff,0xff,0xe4,0xa1,0x00,0x1a,0x16,0x8f,0x00,0x22,0xce,0x10,
+0xb7,0x00,0x12,0xdb,0x07,0x00,0x20,0x51,0xdc,0x06,0x02,0xc6,0xaf,0x50,0x00,0xae,
+0x40,0x00,0x00,0xda,0x20,0x00,0x00,0x5d,0x7f,0x00,0x80,0x32,0x22,0x22,0x22,0x23,
+0x33,0x05,0xee,0x96,0x00,0x25,0xee,0xe1,0x51,0x00,0x52,0x70,0x00,0x00,0x01,0x50,
+0x8c,0x01,0xf1,0x02,0x4d,0x00,0x00,0x02,0xf4,0x33,0x33,0x37,0xd0,0x00,0x00,0x2f,
+0xee,0xee,0xee,0xed,0x00,0x40,0x0f,0x10,0x04,0x0f,0x00,0xcf,0x11,0x11,0x11,0x5d,
+0x00,0x00,0x01,0xef,0xff,0xff,0xff,0x90,0x87,0x00,0x2a,0x12,0x13,0x87,0x00,0x12,
+0x07,0x87,0x00,0x16,0xe2,0xd9,0x00,0x31,0x03,0x43,0x00,0x43,0x04,0x30,0xdc,0xdf,
+0xa0,0x51,0x04,0x82,0x20,0x00,0x2d,0x90,0x00,0x00,0x0d,0x70,0x07,0x04,0x12,0xc8,
+0x71,0x02,0xe0,0x05,0xf8,0x32,0x38,0xf5,0x00,0x00,0x00,0x04,0xad,0xed,0x93,0x00,
+0x00,0x10,0x00,0x01,0x00,0xf1,0x03,0x08,0x10,0x00,0x04,0xa0,0x00,0x00,0xe3,0x00,
+0x00,0x6c,0x00,0x00,0x0e,0x30,0x00,0x07,0xc0,0x0d,0x00,0x11,0x9a,0x0d,0x00,0xf0,
+0x00,0x0c,0xa0,0x00,0x00,0xe4,0x00,0x00,0xff,0x10,0x00,0x0e,0x40,0x00,0x5e,0xd7,
+0x0d,0x00,0xf1,0x11,0x0c,0x95,0xe0,0x00,0x0e,0x40,0x03,0xf2,0x0d,0x70,0x00,0xe4,
+0x00,0xc8,0x00,0x4f,0x10,0x0e,0x40,0x6d,0x00,0x00,0xb9,0x00,0xe4,0x0e,0x30,0x00,
+0x02,0xc0,0x0e,0x40,0x55,0x00,0x11,0xe4,0x06,0x00,0x0a,0x0d,0x00,0x11,0x30,0x07,
+0x00,0x11,0x10,0x06,0x00,0x81,0x05,0x10,0x00,0x05,0xb0,0x00,0x00,0xd6,0x75,0x00,
+0x42,0x0d,0x60,0x00,0x09,0x0d,0x00,0x11,0xd8,0x0d,0x00,0x20,0x3f,0xe0,0x0d,0x00,
+0xf1,0x0a,0x0b,0xac,0xa0,0x00,0x0d,0x60,0x07,0xe1,0x1d,0x80,0x00,0xd6,0x06,0xf3,
+0x00,0x2e,0x70,0x0d,0x64,0xe3,0x00,0x00,0x19,0x00,0xd6,0x41,0x00,0xe2,0x0a,0x30,
+0x00,0x12,0x33,0x33,0x33,0x20,0x00,0x0a,0xff,0xee,0xee,0xef,0x68,0x00,0x11,0xf5,
+0x06,0x00,0x28,0x0f,0x50,0x0d,0x00,0x02,0x1a,0x00,0xe2,0xa2,0x00,0x00,0x01,0x00,
+0x00,0x09,0x20,0x00,0x05,0xc0,0x00,0x00,0xe5,0xea,0x00,0x41,0x50,0x00,0x08,0xb0,
+0x0d,0x00,0xf1,0x19,0xc8,0x00,0x00,0x0d,0x50,0x00,0x2f,0xe0,0x00,0x00,0xd5,0x00,
+0x0a,0xcc,0xa0,0x00,0x0d,0x50,0x04,0xf3,0x1e,0x60,0x00,0xd5,0x02,0xe6,0x00,0x3f,
+0x40,0x0d,0x52,0xe7,0x00,0x00,0x4e,0x00,0xe5,0x13,0x00,0x00,0x34,0x00,0x20,0x03,
+0x00,0x34,0x00,0x81,0x02,0xf1,0x00,0x00,0x07,0x20,0x00,0x3f,0xcd,0x00,0x21,0x03,
+0xf1,0x64,0x00,0x11,0x3f,0x06,0x00,0xc1,0x02,0xfe,0xee,0xee,0xff,0x80,0x00,0x02,
+0x33,0x33,0x32,0x20,0x75,0x00,0x21,0x01,0x60,0x1b,0x00,0xc2,0x05,0xf0,0x00,0x00,
+0x5f,0x00,0x00,0x04,0xf0,0x00,0x00,0x8c,0x07,0x00,0x11,0xdd,0x07,0x00,0x30,0x05,
+0xec,0x90,0x07,0x00,0x30,0x1e,0x61,0xe6,0x07,0x00,0xe1,0xca,0x00,0x3f,0x40,0x04,
+0xf0,0x1c,0xb0,0x00,0x04,0xe0,0x04,0xe0,0x16,0x5d,0x00,0xe1,0xd0,0x00,0x00,0x11,
+0x11,0x12,0x21,0x00,0x00,0x05,0xff,0xff,0xff,0xff,0x0e,0x00,0xa2,0x11,0x04,0xe0,
+0x00,0x00,0x33,0x34,0x44,0x47,0xe0,0x15,0x00,0x41,0xa0,0x00,0x06,0xe0,0x7d,0x00,
+0xd8,0x06,0xf4,0x33,0x44,0x44,0x51,0x00,0x02,0xde,0xee,0xdd,0xdd,0xc3,0xf3,0x00,
+0x12,0xe4,0xf3,0x00,0x32,0x40,0x00,0x09,0xd0,0x01,0x11,0xd8,0x0d,0x00,0x20,0x4f,
+0xf2,0x0d,0x00,0xf0,0x0a,0x0d,0x88,0xd0,0x00,0x0e,0x40,0x0a,0xc0,0x0b,0xb0,0x00,
+0xe4,0x09,0xd1,0x00,0x0c,0xa0,0x0e,0x43,0xb1,0x00,0x00,0x06,0x00,0xd3,0x53,0x00,
+0x00,0x44,0x00,0xf0,0x00,0x2c,0xdd,0xdd,0xdd,0xd3,0x00,0x04,0xf5,0x44,0x44,0x4e,
+0x60,0x00,0x4f,0x00,0x9c,0x01,0x00,0xc0,0x00,0x12,0x0d,0x0d,0x00,0xe1,0xd5,0x00,
+0x03,0xfc,0xbb,0xbc,0xcf,0x40,0x00,0x03,0x45,0x54,0x44,0x30,0x31,0x00,0x1b,0x08,
+0x68,0x01,0x27,0x09,0xa0,0xdd,0x01,0x20,0x4f,0xf2,0x34,0x00,0x70,0x0d,0x89,0xc0,
+0x00,0x0d,0x50,0x09,0x75,0x00,0x90,0xd5,0x09,0xe1,0x00,0x0c,0x90,0x0d,0x54,0xc1,
+0x75,0x00,0x10,0xd5,0x75,0x00,0x00,0xb6,0x00,0xf0,0x0a,0x00,0x29,0xcc,0xa5,0x00,
+0x00,0x00,0x4f,0x95,0x47,0xeb,0x00,0x00,0x0e,0x80,0x00,0x01,0xf4,0x00,0x01,0xf2,
+0x00,0x00,0x0c,0x70,0xe0,0x01,0x00,0x5b,0x00,0xb1,0x7f,0x62,0x25,0xcd,0x00,0x00,
+0x00,0x5c,0xee,0xc7,0x00,0x01,0x00,0xf0,0x0b,0x0b,0x00,0x00,0x00,0x95,0x00,0x2c,
+0x00,0x2f,0x10,0x00,0x00,0xb7,0x00,0x3e,0x00,0x1f,0x10,0x00,0x00,0xc6,0x00,0x4e,
+0x00,0x1f,0x20,0x70,0x00,0x11,0x5d,0x08,0x00,0x31,0xe8,0x00,0x6e,0x08,0x00,0xf2,
+0x28,0xfa,0x00,0x8f,0x10,0x1f,0x20,0x00,0x02,0xfe,0x00,0xbf,0x50,0x0f,0xff,0xf2,
+0x06,0xdf,0x20,0xfc,0x90,0x0f,0x43,0x20,0x0a,0x8b,0x73,0xe4,0xe0,0x0f,0x10,0x00,
+0x0f,0x36,0xca,0x90,0xf3,0x0f,0x10,0x00,0x7c,0x01,0xff,0x10,0xa8,0x0f,0x10,0x00,
+0xc4,0x00,0xa9,0x00,0x39,0x0f,0x10,0x00,0x52,0x02,0x1f,0x20,0x08,0x00,0x0b,0x10,
+0x02,0x05,0x00,0x51,0x74,0x00,0x06,0x50,0x00,0xef,0x00,0x12,0xb8,0x8c,0x02,0x90,
+0x0e,0x60,0x00,0x00,0x00,0x2f,0x80,0x01,0xfa,0x71,0x03,0xf2,0x13,0xfe,0x00,0x6f,
+0xf1,0x00,0x00,0x01,0xf5,0xe5,0x0e,0x8c,0x90,0x00,0x00,0xab,0x06,0xd7,0xe1,0x3f,
+0x20,0x00,0x4e,0x10,0x0b,0xf5,0x00,0x7c,0x00,0x04,0x20,0x00,0x14,0x00,0x00,0xc3,
+0x02,0x0e,0x01,0x00,0x91,0x7e,0xee,0xef,0xfe,0xee,0xee,0xee,0x21,0x33,0x01,0x00,
+0x02,0x72,0x00,0x13,0x03,0x1c,0x00,0x61,0x5e,0x00,0x00,0x00,0x49,0xa5,0x08,0x00,
+0x60,0x06,0xf8,0x7e,0x70,0x00,0x4e,0x0b,0x03,0x20,0x03,0xf0,0x08,0x00,0x10,0x4e,
+0xe8,0x01,0x11,0x4e,0x8f,0x01,0x60,0xc6,0x00,0x4f,0x11,0x10,0x7b,0x23,0x01,0x31,
+0x4f,0xff,0xf2,0x10,0x00,0x07,0x20,0x00,0x40,0x0f,0x30,0x04,0xf1,0x08,0x00,0xe3,
+0x09,0xd5,0x5e,0x80,0x00,0x3e,0x00,0x00,0x00,0x7c,0xc7,0x00,0x00,0x3e,0x60,0x00,
+0x04,0x08,0x00,0x1f,0x3f,0x08,0x00,0x04,0x10,0x18,0x8c,0x00,0xf1,0x0f,0x10,0x00,
+0x00,0x70,0x00,0x09,0xfd,0xf9,0x00,0x03,0xf0,0x00,0x6e,0x20,0x2e,0x40,0x03,0xf0,
+0x00,0xc7,0x00,0x08,0xa0,0x02,0xf0,0x00,0xe4,0x00,0x06,0xb0,0x07,0x00,0xf1,0x0e,
+0x05,0xc0,0x02,0xff,0xfd,0xc7,0x00,0x07,0xa0,0x02,0xf3,0x21,0x7d,0x10,0x1e,0x40,
+0x02,0xf0,0x00,0x0b,0xfd,0xf8,0x00,0x02,0xf0,0x00,0x00,0x23,0x10,0x07,0x00,0x20,
+0x00,0x00,0x46,0x00,0xd2,0x00,0x23,0x33,0x33,0x33,0x10,0x00,0x05,0xfe,0xee,0xee,
+0xef,0xd0,0x35,0x04,0x1f,0xe0,0x07,0x00,0x07,0x22,0x03,0xa0,0xaf,0x02,0x60,0x80,
+0x00,0x00,0x3a,0xca,0x20,0x9a,0x02,0x90,0x2f,0x84,0x9e,0x10,0x04,0xf0,0x00,0x09,
+0xa0,0xa5,0x04,0x00,0x04,0x02,0x40,0x07,0xb0,0x03,0xf0,0xf7,0x02,0x30,0x6c,0x00,
+0x3f,0x0f,0x00,0xf4,0x09,0x06,0xb0,0x03,0xff,0xfd,0x0b,0x90,0x00,0x98,0x00,0x3f,
+0x33,0x20,0x4f,0x51,0x5f,0x20,0x03,0xf0,0x00,0x00,0x6e,0xfd,0x40,0xd1,0x00,0x21,
+0x03,0xf0,0xcd,0x02,0x00,0x10,0x01,0x00,0x70,0x02,0x21,0x02,0xa0,0xcc,0x02,0x01,
+0x01,0x00,0x12,0xe5,0x07,0x00,0x04,0x0f,0x00,0x40,0xdf,0xee,0xee,0xef,0x2d,0x00,
+0x52,0x33,0x33,0x33,0x32,0x00,0x87,0x00,0x60,0x70,0x00,0x00,0x3a,0xdb,0x30,0x78,
+0x00,0xd3,0x3f,0x83,0x8f,0x20,0x04,0xf0,0x00,0x0a,0xa0,0x00,0xb8,0x00,0x3f,0x87,
+0x00,0xa1,0xf3,0x32,0x0e,0x40,0x00,0x5c,0x00,0x3f,0xff,0xe1,0x87,0x00,0x01,0x1e,
+0x00,0x10,0xb7,0x1e,0x00,0xd2,0x3f,0x85,0xae,0x10,0x03,0xe0,0x00,0x00,0x3a,0xc9,
+0x10,0x00,0x06,0x0b,0x03,0xf0,0x03,0xcb,0xa1,0x00,0x00,0x17,0x00,0x00,0x13,0x33,
+0x00,0x00,0x04,0xe0,0x00,0xef,0xff,0xff,0x50,0x92,0x00,0x21,0x3a,0xb6,0x0f,0x00,
+0x30,0x1e,0x74,0xe4,0xa1,0x00,0xf3,0x03,0x03,0xd0,0x09,0x80,0x00,0x04,0xfc,0xcc,
+0x2f,0x10,0xb6,0x00,0x00,0x05,0x54,0x20,0x8f,0xec,0x87,0x00,0x04,0x38,0x02,0x10,
+0x04,0x2a,0x03,0x20,0xec,0x40,0x90,0x00,0x61,0x05,0xf6,0x26,0xf2,0x00,0x4f,0x4a,
+0x03,0x30,0x99,0x00,0x4f,0xf4,0x01,0x71,0x00,0x6b,0x00,0x3f,0x55,0x50,0x0f,0x92,
+0x00,0x60,0xdd,0xc2,0x0c,0x80,0x00,0x99,0x8b,0x00,0x41,0x04,0xf7,0x47,0xf2,0x0b,
+0x01,0x39,0x4b,0xda,0x30,0xe4,0x01,0xd3,0x01,0x22,0x22,0x33,0x31,0x00,0x00,0x00,
+0x1f,0xff,0xff,0xfe,0xff,0x18,0x00,0x22,0x4f,0x00,0xff,0x00,0x12,0x6f,0x18,0x00,
+0x20,0xff,0xfb,0x08,0x00,0x12,0x30,0x1c,0x00,0xe1,0x1f,0x63,0x34,0x44,0x45,0x10,
+0x00,0x00,0x0b,0xee,0xed,0xdd,0xdc,0x40,0x24,0x02,0x00,0x1f,0x01,0x30,0x9f,0xdf,
+0x90,0xc9,0x00,0x00,0x25,0x02,0x20,0x04,0xe0,0x8e,0x00,0x12,0x8a,0x87,0x02,0x51,
+0x06,0xb0,0x04,0xf0,0x00,0x1f,0x01,0x30,0x4f,0xff,0xe0,0x27,0x02,0x61,0x04,0xf2,
+0x21,0x07,0xd1,0x01,0xa0,0x02,0x00,0x28,0x02,0x00,0x1f,0x01,0x56,0x02,0x31,0x00,
+0x00,0x3d,0x16,0x03,0xd1,0x0b,0xdd,0xdd,0xdd,0xeb,0x00,0x00,0x00,0xf7,0x54,0x44,
+0x47,0xf0,0xd2,0x00,0x01,0x91,0x00,0x12,0xf3,0x68,0x05,0x22,0x0f,0x30,0xc4,0x01,
+0xdf,0xfd,0xcb,0xbc,0xcd,0xd0,0x00,0x00,0x02,0x45,0x55,0x44,0x31,0x00,0x87,0x00,
+0x1a,0x2e,0xf0,0xc7,0x87,0x00,0x13,0x04,0x87,0x00,0x16,0x2a,0x87,0x00,0xa1,0x0d,
+0x20,0x00,0x00,0x1c,0x00,0x00,0x00,0xf2,0x00,0xc6,0x02,0xd2,0x0f,0xee,0xee,0xee,
+0xef,0x00,0x00,0x00,0xf6,0x44,0x44,0x46,0xf0,0x20,0x04,0x10,0x3f,0x96,0x00,0xb3,
+0x11,0x11,0x14,0xe0,0x00,0x00,0x0d,0xff,0xff,0xff,0xfa,0x87,0x00,0x1f,0x60,0x87,
+0x00,0x02,0x13,0x4f,0x87,0x00,0x29,0xf2,0x21,0x87,0x00,0x2e,0xf0,0x00,0x87,0x00,
+0x06,0x9d,0x03,0x10,0x50,0xa5,0x01,0x20,0xbd,0xc9,0x7b,0x01,0xc1,0x2e,0xb5,0x34,
+0x9f,0x50,0x00,0x00,0x0b,0xb0,0x00,0x00,0x6e,0xb5,0x05,0x01,0x96,0x00,0x50,0x0b,
+0x90,0x00,0x00,0x6f,0xb6,0x03,0xb2,0x94,0x23,0x8f,0x70,0x00,0x00,0x00,0x39,0xcd,
+0xca,0x40,0x87,0x00,0x21,0x03,0x50,0xb9,0x03,0x21,0x07,0xc0,0x86,0x00,0x21,0x07,
+0xc0,0xb9,0x03,0x21,0x07,0xc0,0x85,0x00,0x30,0x07,0xd2,0x21,0xb9,0x03,0x11,0x07,
+0xb9,0x03,0x00,0x15,0x00,0x00,0xb9,0x03,0x21,0x06,0xc0,0x83,0x00,0x21,0x06,0xc0,
+0xb9,0x03,0x24,0x05,0xa0,0x08,0x01,0x10,0x06,0x94,0x06,0x00,0xa2,0x06,0xa2,0x32,
+0x22,0x22,0x10,0x00,0x00,0x0a,0x20,0x00,0xb2,0x0c,0x08,0x15,0xe3,0x07,0x00,0xd2,
+0x02,0x5e,0x85,0x55,0xf8,0x62,0x00,0x07,0xcc,0xcc,0xcc,0xcb,0xa4,0xb9,0x00,0xf0,
+0x2d,0x06,0x30,0x17,0x95,0x00,0x0e,0x40,0xc7,0x2e,0xa7,0xe8,0x00,0xf4,0x0b,0x88,
+0xb0,0x03,0xf1,0x0e,0x40,0xb8,0xc6,0x00,0x0e,0x40,0xe6,0x1b,0x8d,0x50,0x00,0xc5,
+0x0d,0xff,0xf8,0xc6,0x00,0x0d,0x30,0xd5,0x0b,0x89,0x90,0x01,0xf1,0x0d,0x50,0xb8,
+0x2f,0x75,0xc9,0x00,0xd5,0x0b,0x70,0x3b,0xc8,0x00,0x0d,0x50,0xb7,0x41,0x00,0xf1,
+0x01,0x30,0x03,0x20,0x00,0x3c,0xdd,0xdd,0xde,0xd2,0x00,0x05,0xf4,0x44,0x44,0x4f,
+0x40,0x10,0x05,0x11,0xe4,0x1f,0x04,0x14,0x0e,0x0d,0x00,0x10,0x04,0xaa,0x06,0x6a,
+0x30,0x00,0x03,0x55,0x54,0x44,0x3c,0x05,0x13,0x4e,0x3c,0x05,0x13,0x4f,0x3c,0x05,
+0x13,0x4f,0x3c,0x05,0x31,0x3f,0xff,0xe0,0x0e,0x02,0x30,0x3f,0x33,0x10,0x2c,0x05,
+0x00,0xc1,0x01,0x22,0x7b,0x00,0xab,0x03,0x04,0x10,0x00,0x02,0x20,0x00,0x21,0x55,
+0x40,0x3c,0x05,0x31,0x3f,0xdd,0xc0,0x3c,0x05,0x13,0x3f,0x3c,0x05,0x1f,0x3f,0x34,
+0x05,0x0c,0x13,0x2f,0x08,0x00,0x15,0x09,0x91,0x02,0x00,0x83,0x01,0x13,0x04,0x3c,
+0x05,0x20,0xf1,0x10,0x83,0x01,0x40,0x03,0xff,0xfe,0xe4,0x26,0x04,0x20,0xf1,0x10,
+0x83,0x01,0x01,0x51,0x05,0x50,0x07,0xa0,0x03,0xf3,0x32,0x83,0x01,0x31,0x03,0xfe,
+0xeb,0x14,0x03,0x02,0x3c,0x05,0x22,0x03,0xf0,0x82,0x06,0x10,0xb0,0x4e,0x00,0x10,
+0x43,0xb0,0x06,0xc0,0x07,0xfe,0xcd,0xfc,0x20,0x00,0x00,0x6e,0x30,0x00,0x09,0xe0,
+0xa4,0x09,0x01,0x9d,0x02,0x50,0xaa,0x00,0x00,0x02,0xf2,0x02,0x02,0x93,0x33,0x6e,
+0xb0,0x00,0x00,0x02,0x9c,0xdc,0xa6,0x86,0x00,0x11,0x08,0x06,0x00,0xe0,0x2e,0x01,
+0x9d,0xc6,0x00,0x00,0x2e,0x0d,0x91,0x3e,0x50,0x00,0x2e,0x5d,0xdf,0x01,0xd0,0x2e,
+0x98,0x00,0x01,0xf1,0x00,0x2e,0xb6,0x00,0x00,0xf2,0x44,0x6e,0x06,0x00,0x30,0xcd,
+0xde,0xb7,0x12,0x00,0x20,0x2f,0x8a,0xab,0x00,0xf4,0x01,0x2f,0x3f,0x20,0x0c,0xa0,
+0x00,0x2f,0x09,0xea,0xcd,0x10,0x00,0x2f,0x00,0x36,0x50,0xd6,0x00,0x0e,0x06,0x00,
+0x17,0x2e,0x95,0x04,0xf0,0x07,0x16,0x00,0x3c,0xfd,0x60,0x00,0x04,0xf0,0x1f,0x82,
+0x5f,0x40,0x00,0x3f,0x07,0xc0,0x00,0x8b,0x00,0x03,0xf0,0xa8,0xd0,0x02,0xf1,0x10,
+0x3f,0x0b,0x70,0x00,0x2f,0x2f,0xff,0xf0,0xa8,0x00,0x03,0xe0,0x12,0x5f,0x07,0xd0,
+0x00,0x7b,0x00,0x03,0xe0,0x1e,0x93,0x6f,0x30,0x00,0x3e,0x00,0x2a,0xdb,0x40,0xf3,
+0x02,0x02,0xb3,0x01,0x11,0x10,0x04,0x05,0x21,0x0f,0x40,0x0d,0x04,0x18,0xf4,0xf0,
+0x09,0x12,0xf4,0xa0,0x05,0x00,0x8c,0x09,0x73,0x20,0x00,0x13,0x33,0x33,0x32,0x10,
+0xef,0x01,0x20,0x3b,0xed,0x75,0x00,0xf0,0x0c,0x2f,0x72,0x4e,0x60,0x00,0x3f,0x09,
+0xa0,0x00,0x6c,0x00,0x03,0xf0,0xc6,0x00,0x03,0xe1,0xdd,0xef,0x0c,0x70,0x00,0x2f,
+0x03,0x46,0xf0,0x9b,0xf0,0x00,0xb1,0x3f,0x02,0xf9,0x46,0xe5,0x00,0x04,0xe0,0x02,
+0xbd,0xb5,0x1b,0x02,0x00,0xb5,0x00,0x31,0x50,0x00,0x02,0x72,0x07,0x61,0x04,0xff,
+0xff,0xff,0xef,0xc0,0x14,0x00,0x11,0x5d,0xa3,0x06,0x84,0x37,0xd0,0x00,0x4f,0xff,
+0xff,0xff,0xf9,0x89,0x06,0xc8,0x4f,0x22,0x22,0x23,0x33,0x00,0x02,0xef,0xff,0xff,
+0xfe,0xe2,0xbb,0x07,0x71,0x29,0x03,0xbe,0xd6,0x00,0x00,0x4e,0x7b,0x00,0x20,0x4e,
+0x9a,0x67,0x00,0x11,0x4e,0x7a,0x00,0x81,0xee,0xc7,0x00,0x02,0xf0,0x34,0x7e,0x9b,
+0x12,0x00,0x67,0x2f,0x94,0x6e,0x50,0x00,0x4e,0x78,0x00,0x04,0xe6,0x04,0x10,0x2c,
+0xab,0x03,0x00,0x14,0x00,0x00,0x0a,0x04,0xa3,0xee,0xee,0xee,0xfc,0x00,0x4e,0x44,
+0x44,0x44,0x7c,0x12,0x00,0xb1,0x4e,0x11,0x11,0x11,0x5c,0x00,0x2e,0xff,0xff,0xff,
+0xf7,0x2e,0x00,0x21,0x38,0x00,0x6d,0x00,0x21,0x6d,0x00,0x6e,0x00,0x21,0x6d,0x00,
+0x6f,0x00,0x21,0x6d,0x00,0x70,0x00,0x21,0xed,0x00,0x71,0x00,0x21,0x8c,0x00,0x72,
+0x00,0x21,0x6c,0x00,0x73,0x00,0x21,0x6c,0x00,0x74,0x00,0x12,0x6c,0x6d,0x00,0x24,
+0x5a,0x00,0xaa,0x0b,0xa0,0x98,0x00,0x77,0x01,0xf0,0x00,0x00,0xa8,0x00,0x88,0x77,
+0x05,0xc0,0xaf,0xee,0xf8,0x06,0xf1,0x00,0x00,0xaa,0x44,0xb8,0x0a,0xf9,0x15,0x00,
+0xf3,0x01,0x98,0x2e,0x3f,0x30,0x00,0xa8,0x11,0xa8,0xb7,0x07,0xd0,0x00,0x7e,0xff,
+0xe6,0xb0,0xb7,0x08,0x60,0x37,0x00,0x03,0xcf,0xe7,0x00,0x5b,0x00,0x90,0x71,0x4e,
+0x60,0x00,0x6c,0x00,0x8b,0x00,0x07,0x69,0x00,0xf0,0x03,0xb7,0x00,0x04,0xf3,0xcd,
+0xec,0x00,0xb7,0x00,0x03,0xf1,0x44,0x9c,0x00,0x9a,0x00,0x05,0xd0,0x8a,0x07,0xf5,
+0x01,0x40,0x1d,0x70,0x00,0x6c,0x00,0x06,0xfe,0xfa,0x00,0x00,0x6b,0x00,0x00,0x02,
+0x10,0x7e,0x00,0x11,0x00,0xd0,0x09,0x10,0x09,0x53,0x00,0x10,0xe6,0x49,0x09,0x00,
+0x02,0x0a,0xf2,0x10,0x1f,0x40,0x00,0x00,0x08,0xfc,0x00,0x8f,0xd1,0x00,0x00,0x2f,
+0x4c,0xa2,0xf4,0xcc,0x00,0x01,0xd7,0x01,0xdf,0x80,0x0b,0xc0,0x03,0x70,0x00,0x37,
+0x00,0x00,0x60,0x35,0x00,0x10,0x20,0x03,0x03,0xf1,0x18,0xd0,0x3e,0x01,0x9d,0xb3,
+0x00,0x3e,0x04,0xe0,0xac,0x58,0xf1,0x03,0xe0,0x4e,0x1f,0x20,0x0c,0x70,0x3e,0x04,
+0xe4,0xe0,0x00,0x8a,0x03,0xe0,0x4e,0x5c,0x00,0x06,0xd4,0x6e,0x04,0xe6,0xc0,0x00,
+0x5f,0xdd,0x0d,0x00,0xf0,0x10,0xb0,0x3f,0x03,0xe3,0xf0,0x00,0x89,0x03,0xf0,0x3e,
+0x0e,0x40,0x0d,0x50,0x2f,0x03,0xe0,0x7d,0x5a,0xd0,0x02,0xf0,0x3e,0x00,0x6b,0x92,
+0x00,0x2f,0x03,0xe0,0x00,0x38,0x05,0x01,0x5f,0x05,0x09,0x0d,0x00,0x12,0x3e,0x6d,
+0x03,0x21,0x30,0x1a,0x1e,0x02,0xf0,0x2d,0x03,0x10,0x4b,0xc8,0x00,0x04,0xd0,0xb7,
+0x4f,0x64,0xdb,0x00,0x4e,0x0b,0x7a,0x80,0x04,0xf1,0x04,0xe0,0xa7,0xd5,0x00,0x1f,
+0x41,0x5e,0x0a,0x7d,0x50,0x00,0xff,0xff,0xe0,0xa8,0xb7,0x00,0x2f,0x10,0x3f,0x0a,
+0x86,0xd0,0x09,0xc0,0x03,0xf0,0xa7,0x0a,0xff,0xe2,0x00,0x3f,0x0a,0x70,0x02,0x20,
+0x00,0x01,0x60,0x64,0x51,0x07,0x94,0x23,0x32,0x00,0x00,0xbf,0xff,0xfe,0xee,0xf4,
+0x58,0x08,0xe2,0x12,0x23,0x33,0x33,0xe5,0x00,0x0c,0xff,0xff,0xee,0xed,0x20,0x00,
+0xd7,0x5f,0x06,0xb1,0x92,0x22,0x23,0x33,0x20,0x00,0x9f,0xff,0xff,0xee,0xe9,0x11,
+0x00,0x13,0x19,0xaf,0x03,0x20,0xad,0xc5,0xaf,0x03,0xf0,0x03,0x81,0x3e,0x40,0x00,
+0x2e,0x5c,0x00,0x07,0xb1,0xbb,0xce,0xa8,0x00,0x03,0xf0,0x66,0x8e,0xb6,0xf0,0x05,
+0x21,0x2e,0xb6,0xbb,0x03,0x10,0xb7,0x0c,0x00,0xf1,0x01,0x2f,0x89,0x00,0x05,0xd1,
+0xdd,0xdf,0x3f,0x10,0x0d,0x80,0x44,0x6f,0x09,0xea,0xdd,0xaf,0x03,0x1f,0x40,0xaf,
+0x03,0x0d,0xf0,0x0e,0x00,0x00,0x13,0x10,0x00,0x00,0x03,0x07,0xfd,0xfa,0x00,0x00,
+0x4e,0x3f,0x30,0x2e,0x50,0x23,0x6e,0xa9,0x00,0x08,0xb3,0xee,0xee,0xc6,0x00,0x05,
+0xd0,0xc4,0x02,0xf0,0x04,0x04,0xd0,0x00,0x4e,0xa9,0x00,0x07,0xa2,0x77,0x9e,0x4f,
+0x30,0x1d,0x53,0x99,0xbe,0x07,0xfd,0xf8,0xbe,0x02,0x00,0x36,0x00,0x11,0x4d,0x40,
+0x00,0x11,0x15,0x3b,0x03,0x71,0x31,0x00,0x6f,0xee,0xee,0xee,0xfd,0x12,0x00,0x14,
+0x6e,0x40,0x03,0x05,0x06,0x00,0x11,0x6d,0x06,0x00,0x13,0x49,0x30,0x00,0xf0,0x12,
+0x2a,0xca,0x30,0x00,0x05,0xe0,0x1f,0x94,0x8f,0x20,0x00,0x5e,0x08,0xb0,0x00,0xa9,
+0x0f,0xff,0xe0,0xc6,0x00,0x06,0xc0,0x11,0x5e,0x0d,0x50,0x00,0x4d,0x00,0x04,0xe0,
+0xc6,0x60,0x0c,0xe1,0x4e,0x09,0xa0,0x00,0x99,0x19,0x9b,0xe0,0x3f,0x72,0x6f,0x31,
+0x88,0xad,0xdf,0x08,0x24,0x04,0xd0,0x53,0x00,0x20,0x20,0x00,0x9e,0x00,0x00,0x06,
+0x08,0x11,0x3a,0x05,0x08,0x03,0xa4,0x08,0x14,0x00,0x0d,0x00,0x60,0x3f,0xee,0xee,
+0xee,0xff,0x10,0xc0,0x03,0x1e,0x22,0x1b,0x04,0x20,0x22,0x5f,0x1b,0x04,0x40,0x5f,
+0xff,0xf0,0xc6,0x6e,0x08,0x10,0x3f,0x1b,0x04,0x20,0x00,0x03,0x1b,0x04,0x30,0xc3,
+0x99,0xaf,0x1b,0x04,0x28,0x38,0x8a,0x1b,0x04,0x2f,0x02,0x90,0x1b,0x04,0x29,0x10,
+0x01,0x7c,0x00,0x30,0x05,0xef,0xf8,0x5d,0x01,0xc0,0x50,0x3e,0x60,0x34,0x7e,0xaa,
+0x00,0x07,0xc0,0xcd,0xee,0xc6,0xda,0x04,0x10,0x4f,0x80,0x00,0x00,0x5d,0x01,0xca,
+0x06,0xc1,0x98,0xbe,0x4f,0x30,0x1d,0x51,0x77,0xae,0x07,0xfe,0x5d,0x01,0x00,0xc2,
+0x06,0xf1,0x01,0x3a,0xde,0xd9,0x20,0x00,0x05,0xf8,0x32,0x4a,0xf3,0x00,0x0f,0x70,
+0x00,0x00,0x9b,0xe3,0x0c,0x11,0x5e,0x28,0x0d,0xd0,0x9c,0x00,0x07,0xf7,0x21,0x39,
+0xf4,0x00,0x00,0x5b,0xee,0xda,0x30,0x11,0x00,0x01,0x00,0xf0,0x43,0x20,0x00,0x00,
+0x00,0x02,0xd0,0x3e,0x01,0xad,0xb3,0x00,0x3e,0x04,0xe0,0xbc,0x58,0xf1,0x03,0xe0,
+0x4e,0x1f,0x20,0x0c,0xa7,0x9e,0x04,0xe4,0xe0,0x00,0x8e,0x9a,0xe0,0x4e,0x6c,0x00,
+0x06,0xc0,0x3e,0x04,0xe6,0xb0,0x00,0x5c,0x03,0xe0,0x4e,0x5c,0x00,0x06,0xc0,0x3f,
+0x04,0xe3,0xe0,0x00,0x8e,0xbc,0xf0,0x4e,0x0f,0x30,0x0d,0x86,0x8f,0x04,0xe0,0x7d,
+0x5a,0xe0,0x03,0xf0,0x3e,0x00,0x7b,0x92,0x00,0x3f,0x03,0xe0,0x00,0x00,0x00,0x0d,
+0x00,0x2a,0x00,0x00,0x0d,0x00,0x30,0x3e,0x03,0xf0,0x07,0x00,0x70,0x30,0x1a,0x00,
+0x00,0x18,0xcd,0xc7,0x0b,0x00,0xf3,0x17,0x1e,0xb4,0x24,0xdb,0x00,0x00,0x00,0x09,
+0xd0,0x00,0x02,0xf3,0x00,0x00,0x00,0xc7,0x00,0x00,0x0c,0x60,0x00,0x00,0x0d,0x60,
+0x00,0x00,0xa7,0x00,0x00,0x00,0xb7,0x00,0x00,0x0b,0x70,0x00,0x00,0x07,0x1e,0x00,
+0x40,0x0e,0xc5,0x47,0xe9,0x35,0x00,0x31,0x19,0xcd,0xb4,0xb5,0x00,0x22,0x01,0x40,
+0xbd,0x00,0x12,0x5d,0x07,0x00,0xf6,0x06,0x06,0xd0,0x00,0x00,0x00,0x13,0x33,0x33,
+0x8d,0x22,0x22,0x21,0x09,0xee,0xee,0xee,0xef,0xff,0xff,0xf2,0x00,0x01,0x00,0x20,
+0x23,0x20,0x06,0x00,0x40,0x07,0xfe,0xdf,0xd4,0x07,0x00,0x30,0xe4,0x00,0x06,0x1d,
+0x00,0xf0,0x0c,0xc8,0x00,0x00,0x0d,0x70,0x00,0x00,0x0c,0x80,0x00,0x00,0xd6,0x00,
+0x00,0x00,0x6f,0x51,0x12,0x9f,0x10,0x00,0x00,0x00,0x6c,0xff,0xeb,0x30,0x2e,0x00,
+0x26,0x05,0xe0,0x62,0x00,0xa1,0x06,0xdd,0xdd,0xde,0xfd,0xdd,0xdd,0xd2,0x14,0x44,
+0x01,0x00,0x05,0x58,0x00,0x22,0x0b,0x70,0x08,0x00,0x12,0xc8,0x07,0x00,0x13,0x0c,
+0x0f,0x00,0x13,0xc7,0x1e,0x00,0xb0,0xff,0xee,0xee,0xff,0x50,0x00,0x00,0x03,0x33,
+0x33,0x33,0x81,0x00,0x40,0x29,0xcc,0xb7,0x10,0x17,0x01,0x30,0x94,0x34,0xbd,0x1e,
+0x00,0x82,0x90,0x00,0x00,0xe4,0x00,0x00,0x00,0xd7,0xf4,0x00,0x40,0x09,0xd1,0x00,
+0x05,0x96,0x00,0x41,0x0a,0xfe,0xdf,0xe6,0x3e,0x00,0x10,0x5e,0x33,0x00,0x90,0x21,
+0x10,0x04,0xe0,0x01,0x11,0x20,0x6f,0xff,0x01,0x00,0x24,0xfe,0x30,0x78,0x00,0xd2,
+0x04,0x44,0x44,0x44,0x54,0x00,0x00,0x03,0xde,0xee,0xdd,0xdd,0xf0,0x13,0x00,0xf3,
+0x05,0x3f,0x00,0x00,0x00,0x12,0x22,0x23,0x36,0xf0,0x00,0x00,0x3f,0xff,0xff,0xee,
+0xeb,0x00,0x00,0x03,0xf1,0x1a,0x00,0xd0,0x42,0x22,0x33,0x44,0x10,0x00,0x01,0xdf,
+0xff,0xff,0xfe,0xd5,0x00,0x27,0x00,0x11,0x10,0x0e,0x01,0x30,0xee,0xdf,0xc4,0x07,
+0x00,0x12,0xe3,0x0e,0x01,0x12,0xd7,0x7f,0x01,0x00,0x0e,0x01,0x10,0xe6,0x0e,0x01,
+0x30,0x63,0x34,0xbe,0x27,0x00,0x41,0x5b,0xef,0xc8,0x10,0x0e,0x01,0x10,0xd0,0x75,
+0x01,0x71,0x22,0x22,0x6d,0x22,0x22,0x22,0x08,0x8e,0x00,0x07,0x61,0x01,0x10,0x40,
+0xd9,0x01,0xf2,0x1e,0x00,0x00,0x1f,0x10,0x00,0x00,0x4d,0x00,0x00,0x02,0xf4,0x32,
+0x22,0x36,0xd0,0x00,0x00,0x2f,0xee,0xee,0xee,0xed,0x00,0x00,0x01,0xf1,0x00,0x00,
+0x04,0xe0,0x00,0x00,0x1f,0x31,0x11,0x11,0x6d,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,
+0x90,0x38,0x00,0xf0,0x00,0x07,0x10,0x00,0x00,0x07,0xcd,0x80,0x00,0x0e,0x40,0x00,
+0x00,0xad,0x44,0xc9,0x08,0x00,0x70,0x02,0xf2,0x00,0x1f,0x10,0x0e,0x40,0x70,0x00,
+0xc0,0x0d,0x40,0x0e,0x40,0x00,0x06,0xc0,0x00,0x0c,0x50,0x0d,0x40,0x42,0x00,0xf0,
+0x0c,0x0e,0x30,0x0d,0x40,0x00,0x00,0xe8,0x00,0x8c,0x00,0x0d,0xb9,0x92,0x00,0x2d,
+0xff,0xd2,0x00,0x0d,0xa8,0x82,0x00,0x00,0x22,0x00,0x00,0x0d,0x81,0x00,0x13,0x3d,
+0x08,0x00,0x15,0x4e,0x08,0x00,0xf3,0x03,0x13,0x0d,0x40,0x00,0x6d,0xdd,0xdf,0xef,
+0xfc,0x1d,0x40,0x00,0x13,0x44,0x33,0x21,0x00,0x0d,0x35,0x02,0x0c,0x08,0x00,0x23,
+0x01,0x00,0x90,0x00,0xe0,0x00,0x00,0x00,0x2b,0xff,0xd3,0x00,0x0f,0x30,0x00,0x00,
+0xd9,0x00,0x7e,0x08,0x00,0xd0,0x02,0xf0,0x00,0x0e,0x30,0x0f,0x30,0x00,0x03,0xf0,
+0x00,0x0c,0x50,0x18,0x00,0xf0,0x0c,0xe2,0x00,0x1f,0x20,0x0f,0x40,0x00,0x00,0x4c,
+0x77,0xd8,0x00,0x0f,0xff,0xe0,0x00,0x00,0x6f,0x20,0x00,0x0f,0x63,0x20,0x00,0x00,
+0x3e,0x00,0x30,0x00,0xe3,0x13,0x33,0x6f,0x46,0x89,0x0f,0x30,0x00,0x6d,0xdd,0xdd,
+0xca,0x85,0x0f,0xb1,0x01,0x00,0x08,0x00,0xa3,0x07,0x60,0x00,0x00,0x0b,0x20,0x00,
+0x00,0x0b,0xa0,0x1d,0x02,0x0b,0x08,0x00,0x13,0x0a,0x2d,0x02,0x53,0x00,0x33,0x33,
+0x33,0x22,0x90,0x00,0xf1,0x08,0x28,0x00,0x4b,0xdb,0x20,0x00,0x4e,0x05,0xf6,0x39,
+0xe1,0x00,0x3e,0x0d,0x70,0x00,0xb8,0x00,0x3e,0x0f,0x20,0x00,0x6b,0x06,0x00,0xf1,
+0x08,0x6c,0x00,0x3e,0x0e,0x40,0x00,0x89,0x00,0x3e,0x08,0xc1,0x03,0xe3,0x00,0x3e,
+0x00,0xaf,0xef,0x70,0x00,0x3e,0x00,0x01,0x89,0x00,0x21,0x01,0xe0,0x06,0x00,0x13,
+0xf1,0x06,0x00,0xe5,0x20,0x3e,0x9c,0xcc,0xfd,0xef,0xe4,0x3e,0x34,0x44,0x43,0x20,
+0x00,0x3e,0x2e,0x02,0x01,0xb3,0x00,0x05,0xfe,0x00,0xf0,0x1e,0x01,0x60,0x00,0x9f,
+0xfe,0x60,0x00,0x5e,0x00,0x9c,0x10,0x3e,0x40,0x04,0xe0,0x0f,0x30,0x00,0x79,0x00,
+0x4e,0x00,0xf2,0x00,0x06,0xb0,0x04,0xe0,0x0e,0x50,0x00,0xa9,0x00,0x4e,0x00,0x5e,
+0x86,0xae,0x20,0x04,0xe0,0x00,0x3a,0xf7,0x10,0x65,0x01,0x10,0x3f,0xd7,0x01,0xb0,
+0x33,0x36,0xf4,0x68,0x90,0x4e,0x1d,0xde,0xdd,0xcb,0x85,0xe4,0x01,0x01,0x77,0x01,
+0x81,0x05,0x70,0x00,0x00,0x02,0xa0,0x00,0x9a,0x0f,0x00,0x12,0x09,0xdf,0x00,0x02,
+0x0d,0x00,0x10,0x08,0xe4,0x00,0x76,0xb0,0x00,0x02,0x33,0x33,0x32,0x21,0x07,0x04,
+0x30,0xb5,0x25,0xda,0x1c,0x00,0x0f,0x07,0x04,0x0e,0x19,0xf2,0x07,0x04,0x11,0xa4,
+0x08,0x03,0x41,0x10,0x00,0x80,0x00,0x26,0x00,0x22,0x0f,0x20,0x8f,0x03,0xb6,0xf2,
+0x00,0x00,0x02,0x22,0xc8,0x22,0x2f,0x42,0x22,0x09,0xa6,0x02,0x02,0xf1,0x02,0x12,
+0x08,0xf1,0x02,0x53,0x08,0xe2,0x00,0x06,0xf1,0x78,0x03,0x12,0x50,0xf1,0x02,0x80,
+0xe5,0x00,0x00,0x00,0x5f,0x73,0x35,0xbd,0x27,0x00,0x51,0xdd,0xdd,0xcf,0x40,0x00,
+0x1b,0x00,0x10,0xe4,0x35,0x00,0x10,0xd5,0x95,0x02,0x12,0x07,0x4b,0x00,0x30,0xf1,
+0x01,0x22,0x01,0x00,0x10,0x11,0x18,0x00,0x11,0x10,0xd1,0x00,0x30,0x8e,0xff,0xfc,
+0xb3,0x01,0xf0,0x0d,0xad,0x40,0x01,0x7f,0x40,0x00,0x00,0x0f,0x50,0x00,0x00,0x99,
+0x00,0x00,0x00,0xf4,0x00,0x00,0x0a,0x90,0x00,0x00,0x09,0xe5,0x22,0x38,0xf3,0x00,
+0xe2,0x02,0x21,0xed,0xa3,0x2e,0x00,0x21,0x34,0x30,0x65,0x02,0x30,0xed,0xce,0xd3,
+0x53,0x04,0x42,0xe3,0x00,0x08,0xe0,0x87,0x00,0x00,0xff,0x02,0x92,0x0e,0x50,0x00,
+0x00,0xc6,0x00,0x00,0x00,0xd8,0x0b,0x00,0x50,0x07,0xf3,0x00,0x19,0xe0,0xad,0x00,
+0x31,0xfe,0xef,0xc3,0x3c,0x00,0x26,0x22,0x10,0xce,0x04,0xe0,0x6c,0xcc,0xcc,0xcc,
+0xcc,0xdd,0xde,0x02,0x55,0x55,0x58,0xf4,0x44,0x44,0xf9,0x00,0x13,0x4f,0x17,0x04,
+0x03,0x0c,0x04,0x0b,0x0f,0x00,0x26,0x4e,0x00,0xe9,0x05,0x00,0x0d,0x05,0x04,0xff,
+0x03,0x10,0xc3,0x87,0x00,0x42,0xf4,0x00,0x08,0xe1,0x78,0x00,0x22,0x0d,0x60,0x11,
+0x05,0x10,0xd6,0xd9,0x00,0x30,0x20,0x00,0x6f,0x27,0x00,0x31,0x8f,0xee,0xfd,0x24,
+0x03,0x26,0x02,0x21,0x7f,0x00,0x04,0xff,0x03,0x70,0x02,0x22,0x22,0x2d,0x72,0x22,
+0x22,0xfb,0x03,0x11,0xd6,0xe6,0x02,0x10,0x40,0x50,0x01,0x00,0xff,0x00,0x12,0xc4,
+0x0f,0x00,0x02,0x2f,0x00,0x13,0xf4,0x04,0x03,0x00,0xfc,0x01,0x11,0x40,0xa5,0x05,
+0x0f,0x0d,0x05,0x0c,0x1e,0x50,0x0d,0x05,0x02,0xc1,0x05,0x81,0x21,0x11,0x11,0x11,
+0x11,0x12,0x20,0x7e,0x0c,0x05,0x20,0xee,0x20,0x5b,0x06,0x02,0x0d,0x05,0x1f,0x7f,
+0x0d,0x05,0x10,0x04,0x1a,0x00,0x1f,0x32,0x0d,0x05,0x04,0x27,0xef,0xd4,0x0d,0x05,
+0x1d,0xc8,0x0d,0x05,0x11,0x9f,0x0d,0x05,0x35,0xde,0xd9,0x20,0x07,0x01,0x12,0x15,
+0x0c,0x06,0x00,0x1b,0x06,0x82,0xfe,0xdd,0xdd,0xc1,0x00,0x00,0x00,0x2f,0xaa,0x01,
+0x20,0x24,0xf2,0x62,0x01,0x52,0x2f,0xff,0xff,0xfe,0xfe,0x85,0x05,0x00,0x1a,0x03,
+0x21,0x3f,0x10,0x88,0x01,0x04,0x0f,0x00,0xd8,0x2f,0xdc,0xcc,0xcd,0xed,0x00,0x00,
+0x00,0x35,0x55,0x55,0x44,0x10,0x87,0x00,0x22,0xde,0xd6,0x1c,0x02,0x22,0x04,0xf3,
+0x87,0x00,0x22,0x0b,0x80,0x04,0x00,0x11,0xd7,0xa3,0x02,0x30,0x34,0x9f,0x20,0x87,
+0x00,0x35,0xdd,0xda,0x30,0x87,0x00,0x12,0x7f,0x8e,0x01,0x85,0x21,0x33,0x22,0x24,
+0xf2,0x22,0x22,0x20,0x87,0x00,0x32,0x00,0x00,0x50,0x07,0x00,0x22,0x2f,0x10,0x60,
+0x04,0x12,0xf4,0x29,0x07,0x21,0xfa,0xf5,0x69,0x00,0x30,0xf6,0x06,0xf7,0xed,0x04,
+0xc2,0xe4,0x00,0x03,0xeb,0x10,0x00,0x07,0x80,0x00,0x00,0x01,0x85,0xd6,0x02,0xb4,
+0x15,0x00,0x8f,0xff,0x70,0x00,0x4e,0x07,0xd2,0x03,0xe4,0x62,0x04,0x03,0x74,0x04,
+0xf2,0x05,0x30,0x00,0x7b,0x00,0x3e,0x0a,0xa0,0x01,0xe5,0x00,0x3e,0x01,0xbf,0xdf,
+0x80,0x00,0x3e,0x00,0x02,0x30,0x44,0x04,0xd0,0x01,0x32,0x3e,0xad,0xdd,0xde,0xff,
+0xd7,0x3e,0x23,0x45,0xf3,0x10,0x18,0x00,0xd0,0xf0,0x02,0x44,0x6e,0x00,0x02,0xf0,
+0x08,0xdd,0xee,0x00,0x02,0xf1,0x8f,0x01,0x26,0x02,0xf0,0x06,0x00,0x01,0xb4,0x01,
+0x01,0x87,0x02,0x60,0x02,0x80,0x00,0x1c,0xed,0xf9,0x11,0x01,0xb2,0xba,0x00,0x1d,
+0x60,0x03,0xe0,0x00,0xf2,0x00,0x07,0xa0,0x07,0x00,0x20,0xb0,0x03,0x15,0x00,0x90,
+0x2e,0x50,0x03,0xe0,0x00,0x1b,0xfe,0xf7,0x00,0x4a,0x08,0xf0,0x04,0x02,0x00,0x00,
+0x03,0xe0,0x03,0x33,0x34,0x56,0x8a,0x23,0xe0,0x3d,0xdd,0xfd,0xba,0x85,0x03,0xe0,
+0x35,0x02,0x21,0x34,0x46,0x07,0x00,0x70,0xbd,0xde,0xe0,0x00,0x00,0x61,0x00,0x2a,
+0x00,0x82,0x07,0xa0,0x00,0x00,0x01,0xb0,0x00,0x08,0x7b,0x04,0x03,0x07,0x00,0xd0,
+0x07,0xff,0xee,0xee,0xef,0xf2,0x00,0x00,0x23,0x33,0x33,0x22,0x20,0x70,0x01,0x00,
+0x43,0x08,0xd3,0x3d,0xee,0xfb,0x10,0x05,0xe0,0x00,0xe6,0x00,0x0b,0x90,0x04,0xe0,
+0xed,0x04,0xc1,0x00,0xca,0x42,0x4d,0x70,0x04,0xe0,0x00,0x19,0xcd,0xc6,0x00,0xd4,
+0x04,0xf1,0x02,0x01,0x35,0x04,0xe0,0x3e,0xee,0xef,0xff,0xdb,0x24,0xe0,0x02,0x32,
+0xf5,0x00,0x12,0x25,0x70,0x00,0x10,0xdf,0xfc,0x05,0xf1,0x03,0xa2,0x00,0x00,0x03,
+0xd0,0x00,0x00,0x22,0x22,0x23,0x35,0x40,0x00,0x06,0xff,0xff,0xee,0xef,0x05,0x05,
+0x00,0x38,0x00,0x91,0x05,0xef,0xff,0xff,0xff,0xc0,0x00,0x07,0xc2,0x31,0x04,0xd0,
+0x07,0xd2,0x22,0x22,0x33,0x30,0x00,0x03,0xef,0xff,0xff,0xee,0xe3,0x8a,0x03,0xf1,
+0x12,0x01,0x30,0x17,0x00,0x5e,0xff,0x80,0x07,0xc0,0x3e,0x02,0xf4,0x02,0xe4,0x07,
+0xc0,0x3e,0x08,0xa0,0x00,0x89,0x07,0xc0,0x3e,0x0a,0x80,0x00,0x6b,0x07,0xc0,0x3e,
+0x09,0x90,0x0e,0x00,0xb0,0x04,0xe1,0x01,0xe5,0x07,0xc0,0x3e,0x00,0x9f,0xdf,0x90,
+0x07,0x00,0x50,0x01,0x32,0x00,0x07,0xc0,0x71,0x01,0xe1,0x24,0x27,0xc0,0x3e,0x1e,
+0xff,0xff,0xec,0x67,0xc0,0x3e,0x01,0x23,0xf0,0x15,0x00,0x41,0x02,0xf0,0x04,0x49,
+0x07,0x00,0x21,0x2b,0xce,0x07,0x00,0x25,0x00,0x07,0x07,0x00,0x00,0x10,0x06,0x33,
+0x06,0xb0,0x3e,0x15,0x04,0x01,0xe6,0x01,0x32,0x16,0x00,0x7f,0xe6,0x01,0xe4,0x04,
+0xf3,0x00,0x3e,0x0e,0x50,0x00,0x98,0x00,0x3e,0x0f,0x10,0x00,0x6b,0xec,0x01,0xf3,
+0x01,0x0d,0x50,0x00,0xa8,0x00,0x3e,0x05,0xe6,0x38,0xe1,0x00,0x3e,0x00,0x5c,0xda,
+0x10,0x2a,0x06,0xd1,0x3e,0x12,0x22,0x23,0x46,0x85,0x3e,0xbe,0xee,0xfd,0xca,0x83,
+0x3e,0xce,0x01,0x0e,0x06,0x00,0x11,0x3f,0x6b,0x03,0x11,0x3f,0x11,0x08,0x10,0x18,
+0xab,0x00,0x11,0x30,0x77,0x02,0x32,0xee,0xcd,0xf6,0x6e,0x04,0x22,0x03,0xf4,0xe7,
+0x03,0x22,0x08,0xa0,0xea,0x04,0x12,0x6c,0xe8,0x02,0x90,0x07,0xb0,0x00,0x00,0x07,
+0xf4,0x00,0x05,0xf5,0xab,0x01,0x31,0xef,0xef,0xd6,0x70,0x00,0x1e,0x13,0xf5,0x04,
+0x80,0x52,0x55,0x5e,0x95,0x54,0x8e,0x44,0x30,0xa7,0x04,0x01,0x94,0x08,0x22,0x0d,
+0x60,0x04,0x0a,0x0b,0x0f,0x00,0x42,0xd5,0x00,0x05,0xc0,0xdc,0x06,0x21,0x01,0x00,
+0x6e,0x04,0x11,0xb6,0xfe,0x03,0x32,0x84,0x35,0xcb,0x6e,0x04,0x13,0x01,0xf4,0x08,
+0x21,0x0f,0x30,0x6e,0x04,0x22,0x07,0xf1,0x6e,0x04,0x11,0xd4,0x0b,0x07,0x26,0x23,
+0x10,0x6e,0x04,0x02,0x7b,0x09,0x20,0xed,0x00,0x8a,0x08,0x10,0xe4,0x40,0x01,0x42,
+0x8d,0x44,0x4f,0x61,0x6e,0x04,0x22,0xde,0xd0,0x9b,0x00,0x12,0x6d,0x6e,0x04,0x22,
+0x38,0xd0,0x6e,0x04,0x17,0xe9,0x89,0x05,0x00,0x6e,0x04,0x12,0x00,0x6e,0x04,0x10,
+0xd4,0x87,0x00,0x21,0xcd,0xb5,0x87,0x00,0x32,0xa4,0x36,0xe7,0xfb,0x07,0x22,0x05,
+0xf0,0x22,0x05,0x22,0x0f,0x40,0x8b,0x00,0x00,0x8a,0x06,0x12,0xe4,0x12,0x06,0x13,
+0x0a,0x1e,0x00,0x40,0x2f,0xa4,0x48,0xf6,0x35,0x00,0x4f,0x3a,0xdc,0xa3,0x00,0x01,
+0x00,0x05,0x10,0x8f,0xa4,0x00,0x40,0xee,0xee,0x21,0x33,0x01,0x00,0x2d,0x34,0x30,
+0xe5,0x05,0x37,0xe4,0x00,0x08,0xf3,0x06,0x00,0xe5,0x05,0x00,0xfc,0x04,0x43,0x7e,
+0x30,0x00,0x7f,0xe5,0x05,0x1e,0x30,0xe5,0x05,0xd5,0xfe,0xee,0xee,0xee,0xff,0xf1,
+0x02,0x23,0x33,0x33,0x33,0x32,0x22,0x3d,0x06,0x12,0x1f,0x93,0x01,0x29,0x02,0xf1,
+0x5d,0x04,0x04,0x0f,0x00,0x69,0x1f,0xfe,0xee,0xef,0xff,0x00,0xe5,0x05,0x12,0x00,
+0xe5,0x05,0x13,0xcc,0xeb,0x08,0x0a,0xe5,0x05,0x11,0x06,0xe5,0x05,0x12,0xfd,0xe5,
+0x05,0x22,0x01,0x33,0xe5,0x05,0x62,0x00,0x00,0x01,0x11,0x20,0x7f,0xf2,0x0a,0x05,
+0x6f,0x05,0x80,0x01,0x11,0x11,0x22,0x21,0x00,0x00,0x03,0x16,0x00,0x07,0xe6,0x06,
+0x33,0x22,0x22,0x33,0xe5,0x05,0x27,0xff,0xec,0x77,0x01,0xcf,0x43,0x34,0x44,0x45,
+0x20,0x00,0x01,0xce,0xee,0xdd,0xdd,0xc5,0xf2,0x0a,0x0d,0x14,0x0d,0xe5,0x05,0x21,
+0x73,0x35,0xf2,0x0a,0x36,0x4a,0xcd,0xc7,0x77,0x02,0x73,0x02,0x22,0x22,0x22,0x33,
+0x33,0x33,0xf3,0x06,0x15,0xe2,0x18,0x00,0x00,0x17,0x00,0x03,0xe5,0x05,0x12,0xff,
+0xd6,0x05,0x22,0x03,0xf0,0xe5,0x05,0x16,0x3f,0x0f,0x00,0x00,0xe5,0x05,0x13,0xee,
+0xe5,0x05,0x1f,0x20,0x79,0x0b,0x15,0x15,0x5f,0x87,0x00,0x17,0xc8,0x87,0x00,0x11,
+0x33,0x01,0x00,0x20,0x07,0xff,0xc5,0x04,0x07,0x87,0x00,0x31,0x00,0x03,0x43,0x07,
+0x00,0x30,0x9f,0xdc,0xef,0x53,0x0b,0xc2,0x9d,0x20,0x00,0x3e,0x80,0x00,0x00,0x0e,
+0x60,0x00,0x00,0x7c,0x5a,0x00,0x90,0x09,0xb0,0x00,0x00,0x06,0xf7,0x32,0x39,0xf4,
+0xba,0x02,0x37,0xbd,0xec,0x93,0x59,0x0a,0xd1,0x30,0x00,0x4e,0x04,0xf7,0x38,0xf1,
+0x00,0x4e,0x0b,0x80,0x00,0xb7,0xdf,0x05,0x02,0xff,0x03,0x11,0x5c,0x0c,0x00,0xf6,
+0x02,0x7a,0x00,0x3e,0x0c,0x70,0x00,0xc6,0x00,0x3e,0x04,0xf6,0x49,0xd0,0x00,0x3e,
+0x00,0x4b,0x05,0x04,0x02,0x06,0x00,0xb8,0x01,0x11,0x12,0x35,0x73,0x3e,0xcf,0xff,
+0xfe,0xdb,0x93,0x18,0x00,0x17,0x3f,0x06,0x00,0x11,0x05,0x06,0x00,0x02,0xab,0x06,
+0xe0,0xe3,0x00,0x79,0x82,0x00,0x00,0xe4,0x0c,0xc7,0xae,0x20,0x00,0xe4,0x6e,0xdd,
+0x02,0x20,0xe4,0xb8,0xb0,0x01,0x20,0xe4,0xd5,0xa2,0x0a,0x71,0xe4,0xe4,0x00,0x00,
+0xf2,0x00,0xe3,0x0c,0x00,0x20,0xe3,0xb7,0x18,0x00,0x20,0xe3,0x7c,0x24,0x00,0xa0,
+0xe3,0x1e,0x94,0x8f,0x30,0x00,0xe3,0x02,0xac,0xa3,0x42,0x00,0x24,0x00,0x00,0x06,
+0x00,0x1d,0xe4,0x06,0x00,0xf0,0x05,0x71,0x00,0x03,0x20,0x00,0x00,0x73,0x06,0xfd,
+0xfb,0x00,0x00,0xd6,0x3f,0x40,0x1c,0x70,0x00,0xd6,0x9a,0x12,0x04,0x50,0xd6,0xb7,
+0x00,0x03,0xe0,0x06,0x00,0x20,0x02,0xf0,0x12,0x00,0x60,0x04,0xd0,0x00,0xc6,0x4f,
+0x30,0xda,0x00,0x30,0x08,0xfd,0xfa,0x72,0x09,0x51,0x13,0x20,0x00,0x00,0xc5,0x42,
+0x00,0xc2,0x41,0x00,0x12,0x33,0x33,0x33,0x30,0x00,0x9f,0xee,0xee,0xee,0x2c,0x07,
+0x1d,0xe5,0x06,0x00,0x02,0x6c,0x00,0x11,0xb2,0x06,0x00,0xf0,0x05,0x51,0x03,0xcf,
+0xd6,0x00,0x00,0xd5,0x1f,0x82,0x5f,0x40,0x00,0xd5,0x7c,0x00,0x08,0xb0,0x00,0xd5,
+0xa8,0xf9,0x05,0x11,0xd5,0x6c,0x00,0x20,0xd5,0xa8,0x78,0x00,0x20,0xd5,0x7d,0xd9,
+0x04,0xa2,0xd5,0x1e,0x93,0x6f,0x30,0x00,0xd5,0x02,0xad,0xb4,0x78,0x03,0x51,0x00,
+0x00,0xd4,0x00,0x02,0x06,0x00,0x00,0x3f,0x03,0x13,0xc3,0x45,0x03,0x08,0x06,0x00,
+0xb0,0x1f,0xee,0xee,0xef,0xf8,0x00,0x02,0x33,0x33,0x32,0x20,0x10,0x00,0x01,0x00,
+0xf1,0x11,0x30,0x03,0xbe,0xd6,0x00,0x00,0xd6,0x2f,0x72,0x4e,0x60,0x00,0xd5,0x9a,
+0x00,0x06,0xc0,0x00,0xc5,0xc6,0x00,0x03,0xe0,0x00,0xc5,0xc7,0x00,0x02,0xf0,0x00,
+0xc5,0x9b,0x12,0x00,0xc1,0x2f,0x94,0x6e,0x50,0x00,0xd5,0x02,0xbd,0xb5,0x00,0x00,
+0xd5,0x36,0x00,0xd1,0xb3,0x00,0x02,0x33,0x33,0x33,0x10,0x00,0x4f,0xff,0xff,0xfe,
+0xf3,0x12,0x00,0x11,0xe4,0x12,0x00,0x10,0xe4,0x12,0x00,0x41,0xff,0xe1,0x00,0x5e,
+0x14,0x00,0xc6,0x4f,0x22,0x22,0x23,0x31,0x00,0x2e,0xff,0xff,0xff,0xe8,0x00,0x01,
+0x00,0x11,0x51,0x72,0x00,0xf0,0x08,0xe5,0x2f,0x72,0x6f,0x40,0x00,0xd5,0xaa,0x00,
+0x0a,0xb0,0x00,0xd5,0xc6,0x00,0x06,0xd0,0x00,0xd5,0xc7,0x00,0x06,0xe0,0x84,0x00,
+0xd0,0x09,0xb0,0x00,0xd5,0x2f,0x84,0x7f,0x40,0x00,0xe4,0x02,0xbd,0xb4,0x5a,0x00,
+0x00,0x01,0x00,0xf0,0x3e,0x92,0x00,0x22,0x22,0x01,0x22,0x20,0x07,0xff,0xff,0x48,
+0xef,0xf4,0x00,0x00,0x0d,0x50,0x00,0xc5,0x00,0x12,0x2d,0x50,0x00,0xc5,0x07,0xff,
+0xee,0x30,0x00,0xc5,0x08,0xa0,0x00,0x00,0x00,0xd5,0x08,0xb2,0x22,0x20,0x00,0xd5,
+0x05,0xef,0xfe,0xc0,0x00,0xa3,0x00,0x03,0x20,0x00,0x00,0x83,0x06,0xfd,0xfb,0x00,
+0x00,0xd6,0x3f,0x40,0x1c,0x70,0x00,0xd6,0x9a,0x00,0x05,0xd0,0x00,0xd6,0xb7,0x00,
+0x03,0xe0,0x06,0x00,0x20,0x02,0xf0,0x12,0x00,0xf3,0x07,0x04,0xd0,0x00,0xc6,0x4f,
+0x30,0x0c,0x70,0x00,0xc6,0x08,0xfd,0xfa,0x00,0x00,0xc6,0x00,0x13,0x20,0x00,0x00,
+0xc5,0xaa,0x00,0xb1,0x3c,0xdd,0xdd,0xdd,0xd2,0x00,0x5f,0x54,0x44,0x44,0xf4,0xd2,
+0x00,0x19,0xe4,0x06,0x00,0xb1,0x4f,0xcb,0xbb,0xcc,0xf3,0x00,0x03,0x55,0x54,0x44,
+0x20,0x2e,0x00,0x11,0x32,0xd8,0x00,0x11,0xb7,0x4a,0x01,0x11,0xb7,0x4a,0x01,0x11,
 0xb7,0x4a,0x01,0x11,0xb7,0x4a,0x01,0x21,0xb7,0x9b,0x12,0x00,0x01,0x4a,0x01,0x11,
-0xb7,0x4a,0x01,0x02,0xf5,0x54,0x04,0x10,0x17,0x00,0x17,0x4d,0x11,0x94,0x50,0x0b,
-0x11,0xb6,0x75,0x15,0x11,0xf6,0x75,0x15,0x11,0xd6,0x12,0x00,0x11,0xd6,0x75,0x15,
-0x11,0xd6,0x4a,0x01,0x13,0xe2,0xbb,0x64,0xf0,0x05,0x5d,0xfe,0x60,0x00,0x0c,0x60,
-0x4f,0x61,0x5f,0x40,0x00,0xc6,0x0b,0x80,0x00,0x9a,0x00,0x0c,0x60,0xe4,0x62,0x00,
-0x90,0xc6,0x0e,0x40,0x00,0x5d,0x00,0x0c,0x60,0xc7,0xac,0x08,0x90,0xc6,0x06,0xe2,
-0x02,0xe4,0x00,0x0c,0x60,0x08,0xca,0x11,0x11,0xc6,0x5e,0x78,0x27,0x0b,0x50,0x19,
-0x30,0x11,0xc1,0x60,0x05,0x20,0x3f,0x10,0xba,0xac,0x10,0x07,0x29,0x1a,0xf0,0x04,
-0xec,0x00,0xef,0x90,0x00,0x07,0xd1,0xd9,0x7d,0x3e,0x80,0x03,0xf3,0x01,0xef,0x20,
-0x2e,0x70,0x64,0x75,0x4d,0x14,0x15,0x8c,0x0f,0x50,0x22,0x23,0x30,0x00,0x5d,0xb8,
-0x84,0x22,0xef,0x50,0xc1,0x08,0x03,0x9b,0x62,0x12,0x6d,0x21,0x05,0x24,0x0b,0x80,
-0x5e,0x7b,0x01,0x0f,0x00,0x12,0xae,0x41,0x32,0x91,0x3f,0xe6,0x00,0x03,0xf3,0x32,
-0x00,0x0c,0x86,0xe2,0x53,0x60,0x06,0xe0,0x0d,0x70,0x03,0xe0,0xcc,0x8e,0x31,0x4f,
-0x20,0x3e,0x7c,0x6b,0x10,0x99,0x1d,0x63,0x00,0x23,0x0a,0x0f,0x61,0x25,0x0b,0x16,
-0x02,0x54,0x23,0x41,0x06,0x99,0xaa,0xb3,0x60,0x1c,0x53,0x77,0x67,0xf6,0x00,0x3f,
-0xdb,0x22,0x11,0x3f,0xf3,0x0d,0x03,0xb7,0x46,0x10,0x9e,0x77,0x13,0x70,0xd0,0x00,
-0x05,0xff,0x50,0x00,0x3f,0x5d,0x46,0x10,0x65,0x60,0x1c,0x00,0x6c,0x9c,0x31,0x8d,
-0x10,0x3f,0x27,0xa2,0x20,0x09,0x60,0x43,0x6a,0x04,0xef,0x16,0x04,0xfe,0x42,0x13,
-0x2e,0x1d,0x31,0x07,0xa4,0x28,0x2e,0x00,0x5e,0x08,0x00,0x07,0xf4,0x53,0x01,0x96,
-0x1b,0x41,0x02,0x34,0x45,0x50,0xe8,0x1c,0x3b,0xdd,0xcd,0xf5,0x90,0x00,0x12,0x60,
-0x08,0x00,0x12,0xbd,0xcf,0x00,0x21,0x08,0xef,0x45,0x32,0x40,0x00,0x7f,0x38,0xd1,
-0x0a,0x1e,0x40,0x07,0xf4,0x00,0xbb,0x14,0x01,0x63,0x5e,0x30,0x00,0x0c,0x50,0x3e,
-0xef,0x4f,0x13,0x3e,0x2c,0x1a,0x13,0x3e,0xea,0x0c,0x17,0x2a,0xf2,0x0c,0x2a,0x0f,
-0x30,0xde,0x68,0x2e,0x0e,0xfe,0x24,0x63,0x11,0x04,0xea,0x3c,0x30,0xf4,0x00,0x4f,
-0x4f,0x7a,0x13,0x15,0x34,0x64,0x21,0x0b,0xb0,0x08,0x00,0x00,0x53,0x10,0x10,0x3f,
-0x3f,0x3e,0x10,0xfc,0x9b,0x01,0x51,0xe2,0x00,0x1e,0xae,0x80,0x15,0x93,0x20,0xea,
-0x03,0x48,0x01,0x00,0xf5,0x80,0xbf,0x3f,0x40,0x3f,0x00,0x00,0x25,0x00,0x00,0x02,
-0x20,0x1c,0x80,0x1d,0x30,0x03,0x20,0x01,0x42,0x0a,0xde,0xee,0xf5,0x14,0x63,0x43,
-0x23,0xf4,0x00,0x3f,0xcd,0x94,0x11,0x3f,0x95,0x04,0x02,0x01,0x80,0x00,0xed,0x9e,
-0x00,0xbd,0x93,0x10,0x07,0xb0,0x01,0x61,0x22,0x20,0x00,0x4f,0x55,0xf2,0xc9,0x22,
-0x13,0xf6,0xb0,0x01,0x40,0x50,0x00,0x08,0x50,0xe4,0x63,0x06,0xa7,0x18,0x22,0x13,
-0x21,0xc3,0x3d,0x31,0xfd,0xdf,0xc3,0xcd,0x9b,0x01,0xf3,0x01,0x01,0x77,0x24,0x23,
-0x0f,0x40,0x08,0x00,0x10,0x30,0x4c,0x2a,0x31,0x31,0x24,0xcd,0xa6,0x09,0x34,0xde,
-0xec,0x81,0x1f,0x01,0xe0,0x17,0x00,0x34,0x45,0x20,0x0e,0x30,0x4e,0x05,0xdd,0xde,
-0xb0,0x0f,0x30,0xdd,0x1c,0x11,0x90,0x07,0x00,0x00,0x5b,0x60,0x01,0xa1,0x20,0x01,
-0x07,0x00,0xf1,0x00,0xa9,0x00,0x0f,0x64,0x7e,0x00,0x01,0xf7,0x00,0x0f,0xdc,0xde,
-0x00,0x07,0xfc,0x15,0x00,0xf1,0x12,0x0e,0x6f,0x30,0x0e,0x30,0x4e,0x00,0x8c,0x09,
-0xb0,0x0e,0x30,0x4e,0x02,0xf3,0x01,0xf2,0x0e,0x30,0x4e,0x0b,0x90,0x00,0x8a,0x0e,
-0x30,0x4e,0x08,0x00,0x00,0x06,0x0e,0x30,0x0d,0x03,0x0c,0x07,0x00,0x06,0x1f,0x0b,
-0x01,0x7d,0x2d,0xb1,0x06,0x77,0x88,0x40,0x0e,0x30,0xb8,0x09,0x99,0x8e,0xa0,0x45,
-0x32,0x21,0x2f,0x40,0x26,0x63,0x11,0xac,0x45,0x32,0x12,0x04,0x45,0x32,0x30,0x0d,
-0xde,0x10,0x45,0x32,0x32,0xac,0x0b,0xb0,0x45,0x32,0x12,0xd7,0x45,0x32,0x5b,0x2c,
-0x0e,0x40,0xa8,0x12,0x45,0x32,0x1f,0xde,0x45,0x32,0x17,0x00,0x39,0x00,0xa0,0x45,
-0x66,0x77,0x10,0x00,0xe2,0x0a,0xbb,0xbb,0xf5,0xdc,0x84,0x00,0xfc,0x03,0x11,0xe2,
-0x8d,0x50,0x00,0x32,0x25,0x11,0xd7,0x05,0x07,0xf0,0x00,0x3f,0x11,0x65,0x5f,0x30,
-0x00,0x0a,0xe0,0x4c,0xcc,0xf3,0x00,0x02,0xff,0x40,0x1a,0x00,0x21,0xb9,0x9b,0xed,
-0x65,0xf0,0x04,0x11,0xf3,0x00,0x0d,0x30,0x1e,0x60,0x08,0xb0,0x00,0xd4,0x0a,0xa0,
-0x00,0x1e,0x30,0x0d,0x40,0x90,0x86,0x2d,0x1f,0xd3,0x1f,0x92,0x0c,0xc2,0x04,0x10,
-0x48,0x99,0xaa,0x50,0x00,0xc7,0x04,0x77,0x76,0xea,0x7b,0x48,0x11,0x30,0x7d,0x11,
-0x10,0xb0,0x56,0x11,0x50,0x06,0xf2,0x06,0xbb,0xe7,0x68,0x00,0xf0,0x02,0x25,0x6d,
-0x70,0x01,0xda,0x8e,0x10,0x00,0xb7,0x01,0xdb,0x00,0xac,0x00,0x0c,0x71,0xda,0x44,
-0x1c,0x20,0xc7,0x16,0x18,0x04,0x21,0x0a,0x50,0xee,0x39,0x00,0x99,0x37,0x03,0x47,
-0x5c,0x0f,0x80,0x25,0x0c,0x01,0xf5,0x25,0xa1,0x37,0x78,0x89,0x30,0x00,0xd5,0x05,
-0x99,0x88,0xf8,0x14,0x0a,0x40,0x3f,0x20,0x00,0xd5,0x29,0x0a,0x00,0x0d,0x00,0xf0,
-0x00,0x05,0xf2,0x07,0xaa,0xe5,0x00,0x01,0xef,0x20,0x46,0x7e,0x50,0x00,0xcb,0xac,
-0xd6,0x06,0xf0,0x01,0xbd,0x01,0xd9,0x00,0x0d,0x50,0xbc,0x10,0x02,0xf4,0x00,0xd4,
-0x19,0x00,0x00,0x03,0x12,0x14,0x12,0x02,0xd8,0x06,0x11,0xf1,0xdd,0x00,0x27,0x2f,
-0x10,0x8f,0x0a,0x12,0x2f,0xdd,0x87,0x0c,0xc2,0x30,0xb2,0x03,0x00,0xbe,0xef,0xff,
-0x50,0x00,0xf5,0x01,0x22,0x14,0x7f,0x3b,0x11,0xbc,0x87,0x01,0xf2,0x11,0x5f,0x20,
-0xbd,0xdf,0x50,0x00,0x3f,0xe1,0x02,0x33,0xe5,0x00,0x2e,0x9b,0xc0,0x00,0x0e,0x50,
-0x3e,0xa0,0x0c,0xb0,0x00,0xe5,0x3f,0x80,0x00,0x1c,0x70,0x0e,0x42,0x40,0xfa,0x07,
-0x12,0x01,0x35,0x47,0x14,0xcf,0x7c,0x7e,0x00,0xab,0x0b,0x11,0x24,0xd0,0x84,0x12,
-0x0d,0x33,0x47,0x03,0x9b,0x19,0x20,0x93,0x33,0x82,0x0a,0x62,0x8e,0xee,0xed,0xdd,
-0xd7,0x00,0xef,0x8f,0xa1,0x6d,0xde,0xef,0xa0,0x00,0xd6,0x01,0x33,0x22,0xe9,0xf0,
-0x09,0x20,0x4f,0x20,0xf0,0x11,0xf0,0x11,0x0d,0xa0,0x02,0x2d,0x60,0x00,0x08,0xf2,
-0x08,0xff,0xf6,0x00,0x04,0xfe,0x90,0x00,0x0c,0x60,0x03,0xf7,0x2e,0x60,0x00,0xc6,
-0x04,0xf8,0x00,0x4f,0x30,0x0c,0x61,0xf6,0x89,0x52,0x23,0xc6,0x01,0x20,0x27,0x20,
-0x04,0x45,0xc9,0x2f,0x52,0x05,0xfd,0xdd,0xdd,0xdf,0xfc,0x92,0x12,0xe5,0xcd,0x1e,
-0x1c,0x50,0xcd,0x1e,0x02,0x0a,0x2b,0x00,0x36,0x7d,0x10,0x5e,0x04,0x3e,0x50,0xa8,
-0x01,0x33,0x22,0xda,0x69,0x4d,0x00,0x03,0x86,0x10,0xa8,0x2f,0xb3,0xf0,0x0f,0x24,
+0xb7,0x4a,0x01,0x11,0xb7,0x36,0x00,0x14,0xa6,0x6c,0x00,0xf1,0x07,0x00,0x00,0x00,
+0x94,0x00,0x4e,0x00,0x00,0x00,0xb6,0x00,0x4f,0xee,0xee,0xee,0xf6,0x00,0x4e,0x44,
+0x44,0x44,0xd6,0x12,0x00,0x71,0xd6,0x00,0x4e,0x11,0x11,0x11,0xd6,0x4a,0x01,0x11,
+0xe2,0x2e,0x00,0xf0,0x07,0x52,0x00,0x5d,0xfe,0x60,0x00,0x0c,0x60,0x4f,0x61,0x5f,
+0x40,0x00,0xc6,0x0b,0x80,0x00,0x9a,0x00,0x0c,0x60,0xe4,0x62,0x00,0xf0,0x09,0xc6,
+0x0e,0x40,0x00,0x5d,0x00,0x0c,0x60,0xc7,0x00,0x07,0xa0,0x00,0xc6,0x06,0xe2,0x02,
+0xe4,0x00,0x0c,0x60,0x08,0xfe,0xf8,0xdc,0x00,0x64,0x01,0x21,0x00,0x00,0x0b,0x50,
+0x88,0x01,0xf1,0x1d,0x0d,0x10,0x00,0xc1,0x00,0x00,0x02,0xf1,0x00,0x3f,0x10,0x00,
+0x00,0x7f,0x10,0x07,0xe0,0x00,0x00,0x0d,0xec,0x00,0xef,0x90,0x00,0x07,0xd1,0xd9,
+0x7d,0x3e,0x80,0x03,0xf3,0x01,0xef,0x20,0x2e,0x70,0x64,0x00,0x06,0x40,0x00,0x15,
+0x31,0x00,0xf1,0x06,0x40,0x00,0x00,0x22,0x23,0x30,0x00,0x5d,0x00,0x00,0xaf,0xff,
+0xef,0x50,0x04,0xe0,0x00,0x00,0x00,0x01,0xf2,0xa1,0x00,0xd1,0x00,0x6d,0x00,0x04,
+0xf0,0x00,0x00,0x00,0x0b,0x80,0x00,0x4f,0x00,0x54,0x00,0x01,0x0f,0x00,0xf2,0x22,
+0xae,0x00,0x00,0x3f,0xff,0xf2,0x00,0x3f,0xe6,0x00,0x03,0xf3,0x32,0x00,0x0c,0x86,
+0xe0,0x00,0x3e,0x00,0x00,0x06,0xe0,0x0d,0x70,0x03,0xe0,0x00,0x02,0xf4,0x00,0x4f,
+0x20,0x3e,0x00,0x00,0xb8,0x00,0x00,0x99,0x03,0xe0,0x00,0x03,0x00,0x00,0x00,0x10,
+0x3f,0x99,0x00,0x22,0x03,0xf0,0x08,0x00,0x0b,0x0f,0x00,0x13,0x02,0xb8,0x00,0x70,
+0x16,0x00,0x00,0x06,0x99,0xaa,0xb3,0x6a,0x00,0x42,0x05,0x77,0x67,0xf6,0x27,0x00,
+0x22,0x06,0xe0,0x08,0x00,0x22,0x1e,0x70,0x08,0x00,0xf0,0x03,0x9e,0x00,0x00,0x3f,
+0xee,0xd0,0x00,0x05,0xff,0x50,0x00,0x3f,0x33,0x10,0x00,0x3f,0x65,0xf2,0x18,0x00,
+0x40,0x03,0xf8,0x00,0x8d,0x66,0x00,0x71,0x2f,0x70,0x00,0x09,0x60,0x3e,0x00,0x76,
+0x00,0x41,0x00,0x2c,0x00,0x00,0xbc,0x02,0x93,0x31,0x00,0x00,0x00,0x2e,0xee,0xee,
+0xee,0xee,0x68,0x00,0x13,0x5f,0x08,0x00,0x1f,0x5e,0x08,0x00,0x04,0x13,0x39,0x08,
+0x00,0x70,0x2a,0x00,0x00,0x02,0x34,0x45,0x50,0x90,0x00,0x4b,0x0c,0xdd,0xcd,0xf5,
+0x90,0x00,0x12,0x60,0x08,0x00,0x12,0xbd,0xcf,0x00,0xf0,0x04,0x08,0xef,0x30,0x00,
+0x3f,0xee,0xe0,0x00,0x7f,0x38,0xd1,0x00,0x3f,0x33,0x20,0x07,0xf4,0x00,0xbb,0x14,
+0x01,0x90,0x5e,0x30,0x00,0x0c,0x50,0x3e,0x00,0x00,0x11,0x2b,0x00,0x10,0x3e,0xf4,
+0x00,0x03,0x08,0x00,0x21,0x0f,0x40,0x60,0x00,0x01,0x08,0x00,0x10,0x00,0x08,0x00,
+0x13,0x30,0x08,0x00,0x03,0x10,0x00,0xd3,0x0e,0xfe,0xee,0xee,0xff,0x10,0x00,0x00,
+0x01,0x33,0x33,0x33,0x32,0x90,0x00,0x70,0x04,0x00,0x00,0x0c,0xef,0xff,0xf4,0x90,
+0x00,0x41,0x01,0x21,0x15,0xf2,0x92,0x01,0x32,0x00,0x0b,0xb0,0x08,0x00,0x90,0x6f,
+0x20,0x00,0x3f,0x33,0x30,0x00,0x02,0xfc,0x9b,0x01,0x50,0xe2,0x00,0x1e,0xae,0x80,
+0x98,0x00,0x31,0x02,0xea,0x03,0x48,0x01,0xe0,0x2e,0x90,0x00,0x3f,0x40,0x3f,0x00,
+0x00,0x25,0x00,0x00,0x02,0x20,0x1c,0xe0,0x01,0x21,0x22,0x22,0x18,0x01,0x53,0x1f,
+0xff,0xff,0xfe,0xff,0x60,0x00,0x22,0x4f,0x00,0x70,0x00,0x12,0x6f,0x18,0x00,0x20,
+0xff,0xfb,0x08,0x00,0x03,0x98,0x00,0xe5,0x1f,0x63,0x34,0x44,0x45,0x10,0x00,0x00,
+0x0b,0xee,0xed,0xdd,0xdc,0x40,0x20,0x01,0x60,0x0a,0xde,0xee,0xf5,0x00,0x4f,0x67,
+0x01,0x22,0x23,0xf4,0x10,0x01,0x22,0x08,0xd0,0x08,0x00,0x22,0x2f,0x50,0x08,0x00,
+0x10,0xbe,0x90,0x00,0x30,0xe0,0x00,0x07,0xb0,0x01,0x51,0x22,0x20,0x00,0x4f,0x55,
+0xb0,0x01,0x23,0x05,0xf6,0xb0,0x01,0x53,0x50,0x00,0x08,0x50,0x4e,0x03,0x02,0x11,
+0x3d,0x56,0x00,0x21,0x13,0x21,0x07,0x00,0x40,0x4c,0xfd,0xdf,0xc3,0xc0,0x01,0x11,
+0xf7,0xf3,0x01,0x32,0x00,0x07,0xd0,0x1c,0x01,0x22,0x07,0xd0,0x2c,0x01,0x50,0x01,
+0xea,0x31,0x24,0xcd,0x28,0x00,0x44,0x29,0xde,0xec,0x81,0x1f,0x01,0xf1,0x04,0x17,
+0x00,0x34,0x45,0x20,0x0e,0x30,0x4e,0x05,0xdd,0xde,0xb0,0x0f,0x30,0x4e,0x00,0x00,
+0x0b,0x90,0x07,0x00,0x21,0x0e,0x40,0x07,0x00,0x21,0x4e,0x00,0x07,0x00,0xf1,0x00,
+0xa9,0x00,0x0f,0x64,0x7e,0x00,0x01,0xf7,0x00,0x0f,0xdc,0xde,0x00,0x07,0xfc,0x15,
+0x00,0xf1,0x12,0x0e,0x6f,0x30,0x0e,0x30,0x4e,0x00,0x8c,0x09,0xb0,0x0e,0x30,0x4e,
+0x02,0xf3,0x01,0xf2,0x0e,0x30,0x4e,0x0b,0x90,0x00,0x8a,0x0e,0x30,0x4e,0x08,0x00,
+0x00,0x06,0x0e,0x30,0x0d,0x03,0x0c,0x07,0x00,0x15,0x3e,0x98,0x01,0x00,0xc2,0x00,
+0xf1,0x32,0x32,0x06,0x77,0x88,0x40,0x0e,0x30,0xb8,0x09,0x99,0x8e,0xa0,0x0e,0x40,
+0xa8,0x00,0x00,0x2f,0x40,0x0e,0x40,0xa9,0x00,0x00,0xac,0x00,0x0e,0x51,0xa9,0x00,
+0x04,0xf6,0x00,0x0e,0xff,0xf8,0x00,0x0d,0xde,0x10,0x0e,0x50,0xa8,0x00,0xac,0x0b,
+0xb0,0x0e,0x40,0xa8,0x08,0xe1,0x00,0xd7,0x0e,0x40,0xa8,0x4e,0x20,0x00,0x2c,0x0e,
+0x40,0xa8,0x12,0x4b,0x00,0xf2,0x00,0x53,0x00,0x00,0x23,0x33,0x44,0x44,0x30,0x00,
+0x00,0xde,0xee,0xdd,0xdd,0xf4,0x62,0x00,0x1f,0xe5,0x07,0x00,0x01,0x03,0x1c,0x00,
+0x13,0xa2,0x84,0x00,0xe0,0x45,0x66,0x77,0x10,0x00,0xe2,0x0a,0xbb,0xbb,0xf5,0x00,
+0x0e,0x20,0x00,0xfc,0x03,0xf0,0x10,0xe2,0x00,0x00,0x07,0xc0,0x00,0x0e,0x30,0x00,
+0x00,0xd7,0x00,0x00,0xe3,0x00,0x00,0x3f,0x11,0x65,0x5f,0x30,0x00,0x0a,0xe0,0x4c,
+0xcc,0xf3,0x00,0x02,0xff,0x40,0x1a,0x00,0x20,0xb9,0x9b,0x1a,0x00,0xf2,0x0a,0x4e,
+0x11,0xf3,0x00,0x0d,0x30,0x1e,0x60,0x08,0xb0,0x00,0xd4,0x0a,0xa0,0x00,0x1e,0x30,
+0x0d,0x40,0x90,0x00,0x00,0x42,0x00,0xd3,0x4f,0x04,0x02,0x03,0x02,0x03,0x0d,0x00,
+0x17,0x20,0xf1,0x05,0xf1,0x06,0x04,0x10,0x48,0x99,0xaa,0x50,0x00,0xc7,0x04,0x77,
+0x76,0xea,0x00,0x0c,0x70,0x00,0x00,0x3f,0x30,0x00,0xb7,0x93,0x02,0x80,0x0b,0x70,
+0x00,0x06,0xf2,0x06,0xbb,0xe7,0x68,0x00,0xf0,0x08,0x25,0x6d,0x70,0x01,0xda,0x8e,
+0x10,0x00,0xb7,0x01,0xdb,0x00,0xac,0x00,0x0c,0x71,0xda,0x00,0x00,0xb9,0x00,0xc7,
+0x16,0x18,0x04,0x20,0x0a,0x50,0x89,0x02,0x82,0x22,0x10,0x00,0x0b,0xff,0xff,0xff,
+0xff,0x68,0x00,0x12,0xf5,0x08,0x03,0x18,0x50,0x0d,0x00,0x17,0x40,0xea,0x00,0xc0,
+0x05,0x10,0x37,0x78,0x89,0x30,0x00,0xd5,0x05,0x99,0x88,0xf8,0x2e,0x06,0x30,0x00,
+0x3f,0x20,0xbc,0x06,0x20,0x0b,0xa0,0x0d,0x00,0xf0,0x00,0x05,0xf2,0x07,0xaa,0xe5,
+0x00,0x01,0xef,0x20,0x46,0x7e,0x50,0x00,0xcb,0xac,0xd6,0x06,0xf2,0x06,0xbd,0x01,
+0xd9,0x00,0x0d,0x50,0xbc,0x10,0x02,0xf4,0x00,0xd4,0x19,0x00,0x00,0x03,0x30,0x0d,
+0x40,0x00,0x02,0xd8,0x06,0x11,0xf1,0xdd,0x00,0x32,0x2f,0x10,0x00,0xdb,0x04,0x01,
+0xb7,0x02,0x01,0x0d,0x00,0x10,0x01,0x7e,0x03,0x10,0x80,0x3d,0x04,0x22,0x32,0x20,
+0xab,0x04,0xf1,0x02,0x00,0xbe,0xef,0xff,0x50,0x00,0xf5,0x01,0x22,0x14,0xf3,0x00,
+0x0e,0x50,0x00,0x00,0xbc,0x87,0x01,0xf1,0x10,0x5f,0x20,0xbd,0xdf,0x50,0x00,0x3f,
+0xe1,0x02,0x33,0xe5,0x00,0x2e,0x9b,0xc0,0x00,0x0e,0x50,0x3e,0xa0,0x0c,0xb0,0x00,
+0xe5,0x3f,0x80,0x00,0x1c,0x70,0x0e,0x42,0xb7,0x00,0x11,0xb2,0x54,0x03,0x82,0x44,
+0x00,0x00,0xcf,0xff,0xff,0xfe,0xf4,0xdd,0x03,0xe0,0x40,0x00,0x24,0x44,0x44,0x44,
+0xe4,0x00,0x0d,0xfe,0xee,0xee,0xed,0x10,0x9f,0x01,0x00,0x5b,0x01,0xa2,0x93,0x33,
+0x44,0x45,0x20,0x00,0x8e,0xee,0xed,0xdd,0x11,0x00,0xf2,0x2e,0x08,0x30,0x6d,0xde,
+0xef,0xa0,0x00,0xd6,0x01,0x33,0x22,0xe9,0x00,0x0c,0x60,0x00,0x00,0x4f,0x20,0x00,
+0xc6,0x00,0x00,0x0d,0xa0,0x02,0x2d,0x60,0x00,0x08,0xf2,0x08,0xff,0xf6,0x00,0x04,
+0xfe,0x90,0x00,0x0c,0x60,0x03,0xf7,0x2e,0x60,0x00,0xc6,0x04,0xf8,0x00,0x4f,0x30,
+0x0c,0x61,0xf6,0x00,0x00,0x59,0x00,0xc6,0x01,0x2b,0x01,0xd1,0x00,0x04,0x45,0x55,
+0x55,0x50,0x00,0x05,0xfd,0xdd,0xdd,0xdf,0x50,0xf9,0x04,0x50,0xe5,0x00,0x05,0xe0,
+0x00,0xc3,0x00,0x02,0xec,0x06,0x91,0x04,0xfc,0xbb,0xbc,0xcf,0x30,0x00,0x03,0x55,
+0x73,0x02,0x00,0xea,0x00,0xf1,0x2d,0x20,0x5e,0xee,0xef,0xa0,0x00,0xa8,0x01,0x33,
+0x22,0xda,0x00,0x0a,0x80,0x00,0x00,0x3f,0x40,0x00,0xa8,0x00,0x00,0x0c,0xb0,0x24,
 0x4c,0x80,0x00,0x07,0xf3,0x08,0xdd,0xf8,0x00,0x04,0xfd,0xc0,0x00,0x0a,0x80,0x03,
-0xf7,0x0d,0xa0,0x00,0xa8,0x04,0xf7,0x00,0x1e,0x70,0x0a,0x80,0xe5,0xc2,0x67,0x12,
-0xa7,0x76,0x0b,0x11,0x10,0xf3,0x06,0x11,0x84,0x09,0x0f,0x23,0x0a,0x60,0xf4,0x06,
-0x50,0x04,0xe4,0x44,0x44,0x4d,0x4f,0x24,0x00,0xae,0x13,0x67,0x04,0xe1,0x11,0x11,
-0x1c,0x60,0xf6,0x06,0xc0,0x08,0x20,0x7d,0xde,0xef,0x70,0x00,0xe5,0x01,0x33,0x22,
-0xe7,0x5f,0x01,0x00,0xcf,0x57,0x10,0xd6,0x67,0x0b,0xf0,0x04,0x12,0x2e,0x60,0x00,
-0x07,0xf1,0x0b,0xff,0xf6,0x00,0x03,0xff,0x60,0x00,0x0d,0x50,0x01,0xe9,0x4f,0x16,
-0x09,0xd3,0xda,0x00,0x7e,0x10,0x0d,0x51,0xe9,0x00,0x00,0x87,0x00,0xd5,0x05,0x24,
-0x3a,0x00,0x7f,0x34,0x41,0x30,0x00,0x00,0x2b,0x38,0x04,0x20,0x0d,0xa1,0xbe,0x0c,
-0x12,0x03,0xf7,0x3c,0x21,0x3f,0x10,0x2d,0x03,0xb2,0xcc,0x41,0x14,0xcd,0x00,0x00,
-0x01,0x8d,0xee,0xc9,0x10,0x1d,0x01,0xc1,0x91,0x03,0x66,0x67,0x10,0x0d,0x40,0xe3,
-0x07,0xbb,0xbf,0x50,0x98,0x93,0x21,0x0f,0x30,0x07,0x00,0x12,0x5f,0xa6,0x93,0x12,
-0xa9,0x07,0x00,0xc0,0xf4,0x39,0x9f,0x40,0xe3,0x00,0x06,0xf4,0x27,0x7e,0x40,0xe3,
-0xa4,0x37,0x00,0x15,0x00,0x30,0x5f,0x3f,0x10,0x07,0x00,0x30,0xd8,0x0b,0x80,0x3f,
-0x00,0xf2,0x04,0xe0,0x03,0xf1,0x0d,0x40,0xe3,0x1f,0x40,0x00,0xa7,0x0d,0x40,0xe3,
-0x16,0x00,0x00,0x13,0x0c,0x40,0x78,0x9f,0x04,0xf3,0x93,0x12,0xe4,0x8f,0x26,0x0a,
-0xf3,0x93,0x11,0x02,0xf3,0x93,0xa1,0x5b,0x04,0xe0,0x08,0xdc,0xce,0xf0,0x06,0xc0,
-0x4f,0x66,0x2d,0x30,0x5c,0x04,0xf0,0xfd,0x00,0x10,0x16,0x0f,0x00,0xf0,0x0d,0x1e,
-0xc0,0xbf,0xfd,0x04,0xf0,0x00,0x0b,0xce,0x60,0x05,0xd0,0x4f,0x00,0x07,0xe1,0x4f,
-0x30,0x5d,0x04,0xf0,0x05,0xf3,0x00,0x7d,0x05,0xd0,0x4e,0xd0,0x00,0x23,0x72,0x5d,
-0xfb,0x34,0x23,0x20,0x4e,0xcf,0x18,0x11,0x10,0x9c,0x82,0x03,0x64,0x07,0x12,0xe2,
-0x92,0x2e,0x21,0xba,0xe3,0x07,0x00,0x30,0xc1,0x08,0xf5,0xd6,0x13,0x11,0xb0,0xef,
-0xaa,0x25,0x09,0x50,0xbb,0x90,0x30,0x04,0x00,0x55,0x38,0x04,0x51,0xf2,0x0a,0xbb,
-0xbb,0xf3,0x11,0x15,0x11,0x4f,0xde,0x1f,0x30,0x08,0xb0,0x67,0x8b,0xa9,0x42,0xe6,
-0x0a,0xbb,0xf2,0xdc,0x68,0x40,0x20,0x00,0x0b,0xd0,0x1a,0x00,0xe0,0x03,0xff,0x30,
-0x11,0x1e,0x30,0x00,0xc8,0xaa,0x0f,0xff,0xf3,0x00,0x5e,0x09,0x96,0xf0,0x00,0x30,
-0x1e,0x50,0x0a,0x90,0x00,0xe3,0x0b,0x90,0x00,0x1f,0x20,0x0e,0x30,0x90,0xc3,0x08,
-0x18,0xf3,0xcc,0x26,0x12,0xf2,0xf3,0x02,0x16,0x10,0x3e,0x62,0x11,0x12,0x51,0xaa,
-0x05,0x78,0x06,0x22,0x3f,0x70,0x41,0x64,0x12,0xb0,0xb1,0x00,0x12,0xd1,0xea,0x5b,
-0x21,0xfd,0x20,0xd6,0x06,0x30,0xa2,0xbe,0x40,0x53,0x36,0x11,0x60,0x7c,0xaa,0x67,
-0xc8,0x10,0x02,0x00,0x2a,0x60,0x3a,0x08,0x08,0xb5,0x14,0x11,0x24,0x16,0x80,0x06,
-0x32,0x30,0x13,0x0c,0xc9,0x15,0x42,0x01,0x11,0x19,0xf8,0x06,0x1f,0x02,0x89,0x81,
+0xf7,0x0d,0xa0,0x00,0xa8,0x04,0xf7,0x00,0x1e,0x70,0x0a,0x80,0xe5,0x00,0x00,0x27,
+0x00,0xa7,0x00,0x3c,0x01,0x11,0x10,0xf3,0x06,0x20,0x84,0x00,0x48,0x06,0x23,0x0a,
+0x60,0xf4,0x06,0x61,0x04,0xe4,0x44,0x44,0x4d,0x70,0x54,0x06,0x87,0xc7,0x00,0x04,
+0xe1,0x11,0x11,0x1c,0x60,0xf6,0x06,0xc1,0x08,0x20,0x7d,0xde,0xef,0x70,0x00,0xe5,
+0x01,0x33,0x22,0xe7,0x5f,0x01,0xf1,0x1d,0x5f,0x10,0x00,0xd6,0x00,0x00,0x0d,0x80,
+0x12,0x2e,0x60,0x00,0x07,0xf1,0x0b,0xff,0xf6,0x00,0x03,0xff,0x60,0x00,0x0d,0x50,
+0x01,0xe9,0x4f,0x30,0x00,0xd5,0x02,0xda,0x00,0x7e,0x10,0x0d,0x51,0xe9,0x00,0x00,
+0x87,0x00,0xd5,0x05,0x3c,0x01,0x10,0x50,0xbb,0x04,0x51,0x10,0x30,0x00,0x00,0x2b,
+0x38,0x04,0x81,0x0d,0xa1,0x00,0x08,0xf1,0x00,0x03,0xf1,0x6c,0x01,0x21,0x3f,0x10,
+0x2d,0x03,0xb2,0xcc,0x41,0x14,0xcd,0x00,0x00,0x01,0x8d,0xee,0xc9,0x10,0x1d,0x01,
+0xf0,0x00,0x91,0x03,0x66,0x67,0x10,0x0d,0x40,0xe3,0x07,0xbb,0xbf,0x50,0x0d,0x40,
+0xe3,0x59,0x04,0x01,0x07,0x00,0x21,0x5f,0x00,0x07,0x00,0x12,0xa9,0x07,0x00,0xf1,
+0x00,0xf4,0x39,0x9f,0x40,0xe3,0x00,0x06,0xf4,0x27,0x7e,0x40,0xe3,0x00,0x0d,0xfa,
+0x15,0x00,0x30,0x5f,0x3f,0x10,0x07,0x00,0x30,0xd8,0x0b,0x80,0x3f,0x00,0xf0,0x05,
+0xe0,0x03,0xf1,0x0d,0x40,0xe3,0x1f,0x40,0x00,0xa7,0x0d,0x40,0xe3,0x16,0x00,0x00,
+0x13,0x0c,0x40,0xe3,0x62,0x00,0x03,0x07,0x00,0x21,0x0d,0x40,0xe9,0x08,0x32,0x09,
+0x20,0xe3,0x36,0x03,0x14,0x20,0xf6,0x06,0xd0,0x13,0x44,0x54,0x00,0x5b,0x04,0xe0,
+0x08,0xdc,0xce,0xf0,0x06,0xc0,0x7d,0x05,0x50,0xc9,0x00,0x5c,0x04,0xf0,0xfd,0x00,
+0x10,0x16,0x0f,0x00,0xf0,0x0d,0x1e,0xc0,0xbf,0xfd,0x04,0xf0,0x00,0x0b,0xce,0x60,
+0x05,0xd0,0x4f,0x00,0x07,0xe1,0x4f,0x30,0x5d,0x04,0xf0,0x05,0xf3,0x00,0x7d,0x05,
+0xd0,0x4e,0xd0,0x00,0x41,0x72,0x5d,0x04,0xe0,0x71,0x01,0x10,0x20,0x8f,0x04,0x00,
+0x69,0x09,0x01,0xd8,0x00,0x13,0xbb,0x64,0x07,0x02,0x5a,0x01,0x31,0x1d,0xba,0xe3,
+0x07,0x00,0x20,0xc1,0x08,0x4b,0x03,0xd3,0x4e,0xb0,0x00,0x05,0xf7,0x00,0x00,0x09,
+0x50,0x00,0x00,0x02,0x90,0x38,0x04,0x10,0x55,0x38,0x04,0x81,0xf2,0x0a,0xbb,0xbb,
+0xf3,0x00,0x0f,0x20,0x05,0x06,0xe0,0xf2,0x00,0x00,0x08,0xb0,0x67,0x7f,0x20,0x00,
+0x00,0xe6,0x0a,0xbb,0xf2,0x13,0x00,0x00,0x1a,0x00,0x20,0x0b,0xd0,0x1a,0x00,0xf0,
+0x12,0x03,0xff,0x30,0x11,0x1e,0x30,0x00,0xc8,0xaa,0x0f,0xff,0xf3,0x00,0x5e,0x02,
+0xf2,0x00,0x0e,0x30,0x1e,0x50,0x0a,0x90,0x00,0xe3,0x0b,0x90,0x00,0x1f,0x20,0x0e,
+0x30,0x90,0xc3,0x08,0x12,0xf3,0xb6,0x03,0x02,0xe9,0x00,0x12,0xf2,0xf3,0x02,0x14,
+0x10,0x35,0x04,0x30,0x11,0x11,0x12,0x0c,0x00,0x15,0xbf,0x78,0x06,0x31,0x3f,0x70,
+0x00,0x51,0x07,0x12,0xb0,0xb1,0x00,0x11,0xd1,0x07,0x00,0x31,0x2d,0xfd,0x20,0xd6,
+0x06,0xf7,0x04,0xa2,0xbe,0x40,0x00,0x00,0x03,0xcf,0x60,0x00,0x7f,0x90,0x00,0x00,
+0xc8,0x10,0x02,0x00,0x2a,0x60,0x3a,0x08,0x12,0x4f,0x88,0x04,0x00,0x94,0x08,0x00,
+0x52,0x03,0x81,0x7f,0x44,0x44,0x44,0x09,0xdd,0xdd,0xdd,0xde,0x09,0x50,0x0c,0xff,
+0xff,0xff,0xf2,0x1f,0x01,0x41,0x11,0x19,0xf8,0x00,0x5f,0x06,0x11,0xe5,0x2e,0x01,
 0x30,0x9f,0xdf,0x81,0x37,0x06,0xc5,0xfb,0x20,0x4c,0xe8,0x00,0x00,0x0a,0x72,0x03,
-0xb0,0x04,0x94,0xfd,0x07,0x47,0x11,0x11,0x15,0xe1,0xea,0x7d,0x21,0x11,0x00,0x71,
-0x34,0x09,0xcc,0x8e,0x12,0xf0,0xcc,0x8e,0x1f,0x5f,0xdc,0x7f,0x03,0x15,0xf0,0x7f,
-0x3a,0x00,0x50,0x57,0x03,0x80,0x00,0x22,0x18,0xf8,0x7e,0x1f,0x11,0xf5,0x80,0x00,
-0x31,0x8f,0xdf,0x70,0x80,0x00,0xb7,0x30,0x5d,0xe7,0x00,0x00,0x0b,0x82,0x02,0x70,
-0x04,0xa4,0x95,0x1a,0x00,0x91,0x10,0x00,0x09,0x18,0xa7,0xef,0xdd,0xdd,0xdd,0x22,
-0x55,0x55,0x44,0x44,0x45,0xea,0x7d,0x1f,0xc2,0x6a,0x7e,0x0b,0x19,0xfe,0x82,0x8c,
-0x0f,0x00,0x01,0x21,0x47,0x22,0x22,0x26,0xe2,0x83,0x8a,0x05,0xeb,0x17,0x12,0x01,
-0x87,0x16,0x40,0x09,0xfd,0xce,0xf9,0x7d,0x0f,0x42,0xd2,0x00,0x03,0xe7,0x9d,0x05,
-0x22,0x07,0xc0,0x3b,0x0e,0x11,0x9b,0x0d,0x0f,0x31,0x24,0x9f,0x40,0xf2,0x14,0x27,
-0xc9,0x30,0x9b,0x48,0x00,0x61,0x14,0x11,0x4e,0x32,0x3d,0x13,0xf9,0xa4,0x37,0x12,
-0xf5,0xf8,0x0d,0x13,0x0b,0x7b,0x55,0x12,0x7f,0x61,0x18,0x22,0x05,0xff,0xe2,0x09,
-0x30,0x4f,0x64,0xf4,0x0a,0x23,0xe3,0x05,0xf6,0x00,0x7e,0x20,0x3f,0xdd,0xc0,0x2e,
-0x40,0x62,0x08,0x90,0x3f,0xa5,0x42,0x0b,0x08,0x00,0x20,0x12,0x3f,0x16,0x94,0x30,
-0xfe,0xdf,0xfb,0x3a,0x7e,0x3d,0x45,0x44,0x31,0x1a,0x23,0x17,0x2e,0x20,0x1d,0x51,
-0x0d,0xee,0xef,0xff,0xf0,0x76,0x11,0x22,0x13,0xe9,0x15,0x00,0x12,0xdc,0x88,0x03,
-0x13,0xdd,0xab,0x32,0x01,0xf6,0x20,0x40,0x2b,0xe5,0x05,0xec,0x04,0x34,0x20,0x91,
-0x00,0x10,0xac,0x11,0x04,0x2a,0x60,0x06,0xdc,0x73,0xd5,0x43,0x33,0x44,0x45,0x55,
-0x60,0x7d,0xdd,0xdd,0xef,0xcc,0xcc,0xcb,0x58,0x75,0x0f,0x41,0x30,0x0d,0x02,0x63,
-0x1f,0x06,0x10,0x02,0x22,0x17,0xf9,0x76,0x86,0x12,0xf6,0x8d,0x15,0x20,0xee,0x60,
-0xd0,0x31,0x30,0xed,0x40,0x6e,0x2c,0x42,0x5f,0xa4,0x00,0x00,0x06,0xc5,0x7a,0x80,
-0x08,0x12,0xe7,0x7a,0x80,0x22,0x0e,0x50,0xcc,0x64,0x12,0xe5,0xdb,0x53,0x2f,0x0b,
-0x30,0xfc,0x5a,0x04,0x0f,0x10,0x02,0x0a,0x11,0xe4,0xff,0x00,0x30,0xaf,0xcf,0x91,
-0x2a,0x12,0xcb,0xfa,0x20,0x3c,0xf8,0x10,0x00,0x09,0x71,0x00,0x00,0x03,0x93,0x12,
-0x8f,0x00,0x1b,0x63,0x12,0x6f,0x5e,0x44,0x13,0x03,0x28,0x29,0x21,0x9f,0x74,0xe7,
-0x59,0x42,0xd8,0x78,0xdc,0x10,0x25,0xb9,0x12,0xba,0xb9,0x34,0x22,0x05,0xd0,0xe8,
-0x3b,0x10,0x8c,0xc9,0x01,0x41,0x83,0x23,0x9f,0x50,0xe7,0x3b,0x29,0xc9,0x30,0x80,
-0x00,0x13,0x18,0x80,0x00,0x13,0xf5,0x90,0x02,0x16,0x80,0x10,0x03,0x54,0x0a,0x82,
-0x00,0x00,0x04,0x7a,0x6b,0x01,0xbb,0x00,0x01,0xf4,0x8e,0x00,0x8f,0x07,0x0e,0xf4,
-0x8e,0x0f,0x90,0x03,0x1b,0x04,0x35,0x62,0x33,0xdf,0xff,0xfe,0x35,0x62,0x22,0x8f,
-0x80,0xe5,0x00,0x01,0x3d,0x01,0xc2,0x9f,0xc8,0xed,0x60,0x00,0x00,0x2c,0xf9,0x30,
-0x00,0x5b,0xe6,0x9e,0x1c,0x20,0x01,0x10,0x2b,0x12,0x11,0x22,0x62,0x47,0x01,0x80,
-0x00,0x1f,0x10,0x4b,0x1d,0x0b,0x00,0x30,0x66,0x13,0x25,0x59,0x12,0x16,0xfd,0xc8,
-0x53,0x00,0x57,0x41,0x22,0x34,0x10,0xb4,0x2f,0x17,0xe6,0x6f,0x28,0x02,0xd0,0x38,
-0x00,0x0f,0x01,0x12,0xf9,0x1f,0x04,0x12,0xf6,0x1f,0x04,0x20,0xef,0x70,0x7e,0x27,
-0xc6,0xec,0x40,0x5d,0xe6,0x00,0x00,0x0a,0x93,0x00,0x00,0x05,0xb5,0x80,0x02,0x00,
-0x01,0x00,0x97,0x33,0x30,0x6d,0xdd,0xdd,0xdd,0xde,0xee,0xee,0xe9,0x14,0x0f,0x9f,
-0x03,0x02,0x13,0xf6,0x9f,0x03,0x14,0x70,0x9f,0x03,0x1c,0x23,0x9f,0x03,0xb0,0x05,
-0x00,0x36,0x67,0x78,0x10,0x00,0xf4,0x07,0xbb,0xaa,0xaf,0x36,0x01,0x3b,0x02,0x12,
-0xe5,0x35,0x0a,0x11,0x50,0x56,0x1b,0x10,0xd5,0x48,0x0a,0x00,0x5d,0x07,0x21,0x0a,
-0xd0,0xa4,0x2d,0x20,0xff,0x50,0x0d,0x00,0x20,0xb9,0x8d,0x0d,0x00,0xf0,0x05,0x5e,
+0xb0,0x04,0x94,0xfd,0x07,0x91,0x11,0x11,0x15,0xe1,0x00,0x00,0x00,0x8f,0xff,0x01,
+0x00,0x21,0x20,0x11,0x13,0x00,0x15,0x10,0xef,0x04,0x00,0x15,0x00,0x11,0xf0,0x3c,
+0x07,0x2e,0x21,0x5f,0xd2,0x08,0x04,0x89,0x00,0x01,0x1a,0x07,0x00,0x2a,0x07,0x13,
+0xef,0x80,0x00,0x12,0x18,0x80,0x00,0x21,0x2c,0xf5,0x80,0x00,0x31,0x8f,0xdf,0x70,
+0x80,0x00,0xb0,0x30,0x5d,0xe7,0x00,0x00,0x0b,0x82,0x02,0x70,0x04,0xa4,0x18,0x00,
+0x22,0x5d,0x00,0xde,0x04,0x10,0xd0,0x75,0x09,0xe5,0xdd,0xdd,0xef,0xdd,0xdd,0xdd,
+0x22,0x55,0x55,0x44,0x44,0x45,0x55,0x40,0x70,0x05,0x1a,0xc2,0x2c,0x08,0x02,0x67,
+0x01,0x05,0xa3,0x07,0x56,0xff,0xfe,0xee,0xef,0xf5,0x32,0x08,0x0f,0x00,0x01,0x21,
+0x74,0x22,0x22,0x26,0xe2,0x11,0x11,0x10,0x00,0x01,0x02,0xd0,0x03,0x00,0x04,0x00,
+0x21,0x34,0x30,0xc3,0x02,0xb1,0xfd,0xce,0xf9,0x00,0x00,0x00,0x0a,0xd2,0x00,0x03,
+0xe7,0x9d,0x05,0x00,0x60,0x06,0x60,0x00,0x0e,0x60,0x00,0x00,0x9b,0xac,0x01,0x30,
+0x73,0x24,0x9f,0xac,0x00,0x53,0x5b,0xde,0xc9,0x30,0x00,0x1f,0x01,0x01,0x54,0x00,
+0x10,0x20,0xf7,0x03,0x42,0x09,0xff,0xff,0xf9,0x53,0x0a,0x41,0x02,0xf5,0x00,0x3e,
+0xba,0x08,0x12,0xc0,0x08,0x00,0x21,0x7f,0x20,0x08,0x00,0x22,0x05,0xff,0xe2,0x09,
+0xf0,0x05,0x4f,0x64,0xf4,0x00,0x3f,0x55,0x40,0x05,0xf6,0x00,0x7e,0x20,0x3f,0xdd,
+0xc0,0x2e,0x40,0x62,0x08,0x90,0x5f,0x01,0x00,0x11,0x04,0x0b,0x08,0x00,0xf4,0x01,
+0x12,0x3f,0x00,0x00,0x8c,0xcc,0xfe,0xdf,0xfb,0x3f,0x00,0x00,0x24,0x45,0x44,0x31,
+0x87,0x01,0x05,0x08,0x00,0x35,0x2e,0x00,0x00,0xc4,0x00,0x40,0x0d,0xee,0xef,0xff,
+0x9f,0x01,0x42,0x12,0x22,0x13,0xe9,0x15,0x00,0x12,0xdc,0x88,0x03,0x12,0xdd,0x79,
+0x01,0x20,0xfd,0xf7,0x07,0x00,0xf3,0x02,0x2b,0xe5,0x05,0xec,0x20,0x00,0x00,0x8f,
+0x91,0x00,0x00,0x8f,0x40,0x00,0x04,0x10,0x00,0xbc,0x09,0x01,0x31,0x00,0xff,0x00,
+0x44,0x43,0x33,0x44,0x45,0x55,0x60,0x7d,0xdd,0xdd,0xef,0xcc,0xcc,0xcb,0x10,0xd1,
+0x0a,0x06,0x0b,0x0f,0x00,0x39,0x19,0x00,0x00,0x10,0x02,0x21,0x17,0xf9,0x11,0x00,
+0x31,0x1b,0xf6,0x00,0xff,0x00,0x10,0xee,0xd2,0x02,0xeb,0x17,0xed,0x40,0x6e,0xd5,
+0x00,0x00,0x0c,0xa4,0x00,0x00,0x06,0xc5,0x00,0x01,0x00,0x04,0x90,0x01,0x40,0x22,
+0x22,0x22,0xe7,0x4f,0x01,0x11,0x04,0x24,0x05,0x32,0x00,0x01,0xf1,0x0b,0x08,0x46,
+0x2f,0x20,0x0b,0x30,0xc2,0x06,0x03,0xc3,0x06,0x4f,0x00,0x01,0xff,0xee,0x10,0x02,
+0x0c,0x11,0xe4,0xff,0x00,0xf4,0x04,0xaf,0xcf,0x91,0x00,0x00,0x00,0x3a,0xfa,0x20,
+0x3c,0xf8,0x10,0x00,0x09,0x71,0x00,0x00,0x03,0x93,0x78,0x00,0x21,0x07,0xee,0x01,
+0x00,0x80,0xe2,0x14,0x43,0x33,0x6f,0x33,0x33,0x33,0xd3,0x00,0x12,0xe0,0xda,0x00,
+0x20,0x9f,0x74,0x07,0x00,0xf2,0x01,0x1c,0xd8,0x78,0xdc,0x10,0x00,0x00,0x0a,0xc0,
+0x00,0x00,0xba,0x00,0x00,0x00,0xe6,0xbf,0x02,0x50,0x0c,0x90,0x00,0x00,0x8c,0xc9,
+0x01,0x40,0x83,0x23,0x9f,0x50,0x5b,0x00,0x02,0x10,0x02,0x06,0x80,0x00,0x13,0x18,
+0x80,0x00,0x13,0xf5,0x90,0x02,0x16,0x80,0x10,0x03,0x42,0x0a,0x82,0x00,0x00,0x10,
+0x03,0x13,0x00,0x8d,0x0a,0x50,0x22,0x22,0x22,0x20,0x8f,0x8f,0x07,0x28,0xff,0xff,
+0x7b,0x08,0x0f,0x90,0x03,0x1f,0x22,0x00,0x11,0xcb,0x03,0x52,0xdf,0xff,0xfe,0xff,
+0x70,0x57,0x01,0x12,0x80,0xe5,0x00,0x01,0x3d,0x01,0xc1,0x9f,0xc8,0xed,0x60,0x00,
+0x00,0x2c,0xf9,0x30,0x00,0x5b,0xe6,0x12,0x0d,0x00,0xc9,0x06,0x21,0x22,0x22,0x80,
+0x00,0x21,0x7f,0xff,0x80,0x00,0x06,0x09,0x04,0x70,0x44,0x44,0x44,0x54,0x00,0x00,
+0x03,0xa2,0x09,0x07,0x71,0x00,0x50,0x01,0x11,0x12,0x25,0xf0,0xef,0x0a,0x73,0xff,
+0xff,0xfd,0x00,0x00,0x04,0xf1,0xa4,0x04,0xf0,0x06,0x32,0x22,0x23,0x34,0x10,0x00,
+0x01,0xef,0xff,0xff,0xff,0xe6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+0x00,0x0b,0xff,0xff,0xff,0xf3,0x00,0x00,0x00,0x01,0x11,0x18,0xf9,0x00,0x01,0x00,
+0x30,0x2c,0xf6,0x00,0x0f,0x00,0xf3,0x05,0x8f,0xef,0x70,0x00,0x00,0x00,0x18,0xec,
+0x40,0x5d,0xe6,0x00,0x00,0x0a,0x93,0x00,0x00,0x05,0xb5,0x00,0x01,0x00,0x20,0x01,
+0x44,0x01,0x00,0xb5,0x33,0x30,0x6d,0xdd,0xdd,0xdd,0xde,0xee,0xee,0x10,0x00,0x01,
+0x00,0x20,0x34,0x30,0x06,0x00,0x30,0x09,0xfd,0xce,0x4b,0x00,0xf3,0x14,0x0a,0xd2,
+0x00,0x03,0xe7,0x00,0x00,0x00,0xf6,0x00,0x00,0x07,0xc0,0x00,0x00,0x0e,0x70,0x00,
+0x00,0x9b,0x00,0x00,0x00,0x6f,0x73,0x23,0x9f,0x40,0x00,0x00,0x00,0x5b,0xde,0xc9,
+0x30,0x37,0x00,0xf1,0x06,0x05,0x00,0x36,0x67,0x78,0x10,0x00,0xf4,0x07,0xbb,0xaa,
+0xf4,0x00,0x0e,0x40,0x00,0x00,0x2f,0x10,0x00,0xe5,0x36,0x00,0xf0,0x03,0x0e,0x50,
+0x00,0x00,0xc7,0x00,0x00,0xd5,0x00,0x00,0x3f,0x10,0x00,0x0d,0x50,0x00,0x0a,0xd0,
+0x0d,0x00,0x30,0x03,0xff,0x50,0x0d,0x00,0x20,0xb9,0x8d,0x0d,0x00,0xf1,0x0a,0x5e,
 0x11,0xe6,0x00,0x0d,0x50,0x1e,0x50,0x06,0xe1,0x00,0xd5,0x0b,0x80,0x00,0x0b,0x80,
-0x0d,0x50,0x50,0xd6,0x06,0x18,0xd5,0xb5,0x41,0x19,0xd5,0xec,0x8f,0x03,0x35,0x0a,
-0xa1,0x58,0x99,0xaa,0x40,0x00,0xd6,0x05,0x77,0x77,0xf8,0x40,0x1a,0x03,0xec,0x07,
-0x11,0x90,0xc2,0x2f,0x11,0xf0,0x96,0x15,0xf1,0x0a,0xfe,0x60,0x00,0x0d,0x60,0x04,
-0xf5,0x4f,0x30,0x00,0xd6,0x05,0xf7,0x00,0x6e,0x20,0x0d,0x62,0xf5,0x00,0x00,0x88,
-0x00,0xd6,0x02,0x96,0x18,0x13,0x40,0x27,0x64,0x11,0x0d,0x35,0x0a,0x00,0x0c,0x00,
-0x1e,0x01,0xb8,0x25,0x04,0x0d,0x00,0x12,0xb2,0xc3,0x18,0x02,0x35,0x0a,0x11,0xf4,
-0x35,0x0a,0x01,0x9c,0x8d,0x11,0x20,0x31,0x9d,0x11,0xa0,0xd0,0x3a,0x11,0xf1,0xd0,
-0x3a,0x20,0xff,0x50,0x60,0x5f,0xd0,0xe8,0x6f,0x20,0x00,0xe4,0x02,0xea,0x00,0x9d,
-0x00,0x0e,0x41,0xe8,0xc6,0x0e,0x20,0xe4,0x04,0xaa,0x0a,0x00,0x97,0x30,0x05,0xc9,
-0x9c,0x2f,0x0d,0x20,0xc9,0x9c,0x06,0x17,0x90,0x35,0x0a,0x01,0xc0,0x09,0x11,0x90,
-0xc0,0x09,0x32,0xe8,0x00,0x0c,0xea,0x00,0x11,0xc6,0xb9,0x9f,0x21,0x0c,0x60,0x81,
-0xbb,0xf3,0x0c,0xc6,0x00,0x08,0xfb,0xc0,0x00,0x0c,0x60,0x06,0xf4,0x0d,0x90,0x00,
-0xc6,0x07,0xf4,0x00,0x2e,0x60,0x0c,0x60,0xd3,0x00,0x00,0x26,0x00,0xc6,0x1b,0x9b,
-0x03,0x48,0x93,0x03,0xc0,0x09,0x1f,0x5e,0xc0,0x09,0x08,0x02,0xc9,0x9c,0x00,0xfd,
-0x24,0x10,0x5d,0x35,0x0a,0x11,0xb8,0xc0,0x09,0x21,0x0b,0x80,0x35,0x0a,0x10,0xa9,
-0x5f,0x01,0x00,0x60,0x1c,0x20,0x09,0xf3,0x72,0x25,0xf7,0x05,0x06,0xfb,0xd0,0x00,
-0x0a,0x80,0x05,0xf5,0x0c,0xa0,0x00,0xa8,0x06,0xf5,0x00,0x1e,0x70,0x0b,0x80,0xd4,
-0xc0,0x09,0x1f,0x00,0xc0,0x09,0x06,0x22,0x60,0x00,0x62,0x47,0x0c,0xc0,0x09,0x00,
-0x02,0x0d,0x40,0x02,0x23,0x01,0x23,0xd2,0x97,0x32,0x4f,0xff,0x6c,0x0e,0x8f,0x51,
-0x0f,0x40,0x09,0xa0,0x0f,0x54,0x02,0x41,0x0c,0x70,0x0e,0x40,0x4c,0x22,0x01,0x7f,
-0x90,0x51,0x9a,0x00,0x3f,0x00,0x0e,0xda,0x9b,0xf0,0x02,0x7f,0x00,0x0e,0xff,0xf2,
-0x03,0xff,0x00,0xcf,0x50,0x0e,0x63,0x20,0x08,0xbd,0x51,0xfa,0x36,0x8f,0x50,0x0e,
-0x58,0xb7,0xc2,0xf1,0x6c,0x29,0xf4,0x05,0x01,0xfe,0x50,0xc7,0x0e,0x40,0x00,0xb7,
-0x00,0xae,0x00,0x5d,0x0e,0x40,0x00,0x50,0x00,0x12,0x00,0x03,0x20,0x85,0x0d,0xeb,
-0xa2,0x1a,0x50,0x95,0x1f,0xf0,0x05,0x30,0x52,0x03,0x44,0x04,0x43,0x03,0xe0,0xc5,
-0x0c,0xdf,0x6c,0xef,0x03,0xe0,0xc5,0x00,0x1f,0x10,0x5e,0x07,0x00,0x30,0x3f,0x00,
-0x8c,0x07,0x00,0x30,0x5c,0x00,0xa9,0x07,0x00,0xf2,0x28,0x99,0x00,0xd6,0x03,0xe4,
-0xd5,0x00,0xc8,0x01,0xf6,0x03,0xfe,0xf5,0x01,0xfc,0x05,0xfb,0x03,0xe0,0xc5,0x05,
-0xdf,0x19,0xcf,0x03,0xe0,0xc5,0x0a,0x8b,0x6e,0x4d,0x53,0xe0,0xc5,0x0f,0x26,0xde,
-0x08,0xa3,0xe0,0xc5,0x5c,0x01,0xf9,0x01,0xf3,0xe0,0xc5,0x44,0x00,0x61,0x00,0x53,
-0xe0,0xc5,0x10,0x74,0x01,0x07,0x00,0x00,0xf8,0x27,0x01,0x5d,0x75,0x17,0xc6,0x29,
-0xa0,0xe0,0x00,0x20,0x32,0x06,0x78,0x27,0x86,0x03,0xe0,0xb8,0x08,0xaf,0x49,0xbe,
-0x90,0x28,0x30,0x2f,0x00,0x7b,0x07,0x00,0xf2,0x1a,0x6c,0x00,0xa7,0x03,0xf4,0xb8,
+0x0d,0x50,0x50,0x00,0x00,0x02,0x00,0xd5,0x5b,0x00,0x21,0x0d,0x50,0x07,0x00,0x02,
+0x0d,0x00,0x36,0x0c,0x50,0x00,0x01,0x00,0xf0,0x0a,0x04,0x10,0x58,0x99,0xaa,0x40,
+0x00,0xd6,0x05,0x77,0x77,0xf8,0x00,0x0d,0x60,0x00,0x00,0x5f,0x10,0x00,0xd6,0x00,
+0x00,0x0d,0x90,0x0d,0x00,0xf0,0x12,0x09,0xf0,0x00,0x00,0xd6,0x00,0x05,0xfe,0x60,
+0x00,0x0d,0x60,0x04,0xf5,0x4f,0x30,0x00,0xd6,0x05,0xf7,0x00,0x6e,0x20,0x0d,0x62,
+0xf5,0x00,0x00,0x88,0x00,0xd6,0x02,0x00,0xe0,0x00,0x10,0x40,0x36,0x01,0x90,0x11,
+0x00,0x00,0x0d,0xff,0xff,0xff,0xff,0x30,0x0c,0x00,0x21,0x01,0xf4,0x5b,0x00,0x21,
+0x0f,0x40,0x07,0x00,0x09,0x0d,0x00,0x11,0xb2,0x06,0x00,0xc1,0x06,0x10,0x37,0x78,
+0x89,0x30,0x00,0xf4,0x05,0x99,0x88,0xf8,0xea,0x00,0x80,0x3f,0x20,0x00,0xe4,0x00,
+0x00,0x0c,0xa0,0x0d,0x00,0x51,0x06,0xf1,0x00,0x00,0xe4,0xdd,0x00,0xf0,0x0e,0x0e,
+0x40,0x02,0xe8,0x6f,0x20,0x00,0xe4,0x02,0xea,0x00,0x9d,0x00,0x0e,0x41,0xe8,0x00,
+0x00,0xb8,0x00,0xe4,0x04,0x00,0x00,0x00,0x10,0x0e,0x30,0x00,0x7d,0x00,0xa2,0xe3,
+0x00,0x03,0xf0,0x00,0x00,0x0d,0x20,0x00,0x4f,0xcc,0x00,0x11,0xf0,0x07,0x00,0x02,
+0x0d,0x00,0xc1,0x03,0xfe,0xee,0xee,0xff,0x90,0x00,0x02,0x33,0x33,0x32,0x20,0x11,
+0x00,0xe2,0x08,0x30,0x6d,0xde,0xef,0x90,0x00,0xd6,0x01,0x33,0x22,0xe8,0x00,0x0c,
+0xea,0x00,0x50,0xc6,0x00,0x00,0x1e,0x80,0x0d,0x00,0xf1,0x10,0x0a,0xf2,0x00,0x00,
+0xc6,0x00,0x08,0xfb,0xc0,0x00,0x0c,0x60,0x06,0xf4,0x0d,0x90,0x00,0xc6,0x07,0xf4,
+0x00,0x2e,0x60,0x0c,0x60,0xd3,0x00,0x00,0x26,0x00,0xc6,0x41,0x00,0xf2,0x0c,0x07,
+0x20,0x00,0x04,0x44,0x44,0x55,0x50,0x00,0x05,0xfd,0xdd,0xdd,0xdf,0x50,0x00,0x5e,
+0x00,0x00,0x00,0xe5,0x00,0x05,0xe0,0x00,0x00,0x0e,0x0d,0x00,0xd2,0xe4,0x00,0x04,
+0xfc,0xbb,0xbc,0xcf,0x30,0x00,0x03,0x55,0x54,0x44,0xd6,0x01,0xf1,0x06,0x02,0x10,
+0x5d,0xde,0xef,0xa0,0x00,0xb8,0x01,0x33,0x22,0xda,0x00,0x0b,0x80,0x00,0x00,0x4f,
+0x20,0x00,0xa9,0x5f,0x01,0xf2,0x13,0x0a,0x90,0x00,0x09,0xf3,0x00,0x00,0xa8,0x00,
+0x06,0xfb,0xd0,0x00,0x0a,0x80,0x05,0xf5,0x0c,0xa0,0x00,0xa8,0x06,0xf5,0x00,0x1e,
+0x70,0x0b,0x80,0xd4,0x00,0x00,0x27,0x00,0xa7,0x66,0x02,0xf0,0x0f,0x00,0x00,0x3c,
+0x00,0x00,0x00,0x84,0x00,0x04,0xe0,0x00,0x00,0x0a,0x60,0x00,0x4f,0xee,0xee,0xee,
+0xf6,0x00,0x04,0xe4,0x44,0x44,0x4d,0x60,0x00,0x4e,0x00,0xb6,0x00,0xc2,0x04,0xe1,
+0x11,0x11,0x1c,0x60,0x00,0x2e,0xff,0xff,0xff,0xe2,0x08,0x01,0xf0,0x02,0x00,0x00,
+0x02,0x23,0x01,0x23,0x10,0x0f,0x30,0x00,0x4f,0xff,0x6c,0xff,0xc0,0x0f,0x40,0x80,
+0x01,0x31,0x09,0xa0,0x0f,0x54,0x02,0x20,0x0c,0x70,0x72,0x01,0x40,0x5e,0x00,0x0f,
+0x30,0x08,0x00,0x31,0x9a,0x00,0x3f,0x5f,0x02,0xf2,0x26,0xda,0x00,0x7f,0x00,0x0e,
+0xff,0xf2,0x03,0xff,0x00,0xcf,0x50,0x0e,0x63,0x20,0x08,0xbd,0x51,0xfa,0xa0,0x0e,
+0x40,0x00,0x0e,0x58,0xb7,0xc2,0xf1,0x0e,0x40,0x00,0x5e,0x01,0xfe,0x50,0xc7,0x0e,
+0x40,0x00,0xb7,0x00,0xae,0x00,0x5d,0x0e,0x40,0x00,0x50,0x00,0x12,0x00,0x03,0x0e,
+0xd4,0x01,0x01,0x40,0x00,0x08,0x08,0x00,0x23,0x0d,0x50,0x22,0x03,0x03,0x64,0x02,
+0xf0,0x05,0x30,0x52,0x03,0x44,0x04,0x43,0x03,0xe0,0xc5,0x0c,0xdf,0x6c,0xef,0x03,
+0xe0,0xc5,0x00,0x1f,0x10,0x5e,0x07,0x00,0x30,0x3f,0x00,0x8c,0x07,0x00,0x30,0x5c,
+0x00,0xa9,0x07,0x00,0xf1,0x28,0x99,0x00,0xd6,0x03,0xe4,0xd5,0x00,0xc8,0x01,0xf6,
+0x03,0xfe,0xf5,0x01,0xfc,0x05,0xfb,0x03,0xe0,0xc5,0x05,0xdf,0x19,0xcf,0x03,0xe0,
+0xc5,0x0a,0x8b,0x6e,0x4d,0x53,0xe0,0xc5,0x0f,0x26,0xde,0x08,0xa3,0xe0,0xc5,0x5c,
+0x01,0xf9,0x01,0xf3,0xe0,0xc5,0x44,0x00,0x61,0x00,0x53,0xe0,0xc5,0xec,0x01,0x03,
+0x07,0x00,0x21,0xf0,0xc6,0x74,0x01,0x22,0xe0,0xc6,0x78,0x00,0x11,0x41,0x06,0x00,
+0xf0,0x05,0x20,0x32,0x06,0x78,0x27,0x86,0x03,0xe0,0xb8,0x08,0xaf,0x49,0xbe,0x03,
+0xf0,0xa8,0x00,0x2f,0x00,0x7b,0x07,0x00,0xf1,0x1a,0x6c,0x00,0xa7,0x03,0xf4,0xb8,
 0x00,0xb9,0x00,0xf6,0x03,0xfd,0xe8,0x01,0xfe,0x06,0xfd,0x03,0xf0,0xa8,0x07,0xbc,
 0x5c,0x6d,0x33,0xf0,0xa8,0x0e,0x45,0xee,0x06,0xb3,0xf0,0xa8,0x5b,0x00,0xc6,0x00,
-0xa3,0xf0,0xa8,0x95,0x11,0x11,0x53,0xd4,0x08,0x00,0x62,0x66,0x2f,0xbe,0xed,0x0a,
-0x0e,0x12,0x02,0xe2,0x3d,0x10,0x10,0x13,0x4a,0x21,0xfb,0x6f,0x96,0x68,0x42,0x1f,
-0x50,0x02,0xf3,0x24,0x10,0x10,0xc8,0x05,0x03,0xf0,0x00,0xfe,0x20,0x9f,0xc0,0x00,
-0x00,0x05,0xe3,0x7d,0x8d,0x1b,0xc1,0x00,0x01,0xe3,0x08,0xb1,0x13,0x70,0x44,0x36,
-0x00,0xb6,0x16,0x1f,0x8d,0xc1,0x79,0x10,0x4e,0x22,0x22,0x21,0x15,0xe6,0x06,0x0d,
-0x26,0x39,0x00,0x1c,0x20,0xa0,0x9e,0xe9,0x9e,0xe9,0x00,0x4e,0x01,0x2b,0x91,0x2a,
-0x29,0x1b,0x30,0xe5,0x00,0xd5,0x84,0x90,0xf8,0x16,0x10,0x3f,0x20,0x04,0xe0,0x08,
-0xf5,0x08,0xf7,0x00,0x4e,0x00,0xec,0xb0,0xea,0xd0,0x04,0xe0,0x7c,0x2f,0x8d,0x0f,
-0x30,0x4e,0x0e,0x40,0xaf,0x40,0x8a,0x04,0xe2,0x80,0x02,0x80,0x00,0x50,0x4e,0x14,
-0x51,0x36,0x31,0x00,0x03,0xbc,0x2f,0x03,0x3a,0x58,0x05,0xa1,0x25,0x06,0x0d,0x00,
-0x32,0x39,0x01,0x20,0x4d,0x94,0x22,0x6e,0xfe,0xef,0x4e,0x21,0x01,0x11,0x9f,0x2f,
-0x30,0xdd,0xdd,0xee,0x9f,0x85,0x42,0x14,0x44,0x48,0xf1,0x8d,0x04,0x10,0xab,0x74,
-0x04,0x00,0x3b,0x9d,0x00,0x81,0x1e,0x00,0xd1,0x2a,0x51,0x0d,0x82,0x31,0x00,0x02,
-0x5a,0xad,0x41,0x80,0x00,0xcf,0xc0,0xac,0x04,0x50,0x7e,0x3f,0x50,0x00,0xc5,0xfa,
-0x0c,0x40,0x6e,0x00,0x0c,0x50,0xea,0x11,0xba,0xc9,0x00,0xc5,0x00,0x09,0x70,0x00,
-0x02,0xc0,0x0c,0x60,0xc5,0x94,0x09,0x0f,0x00,0x00,0x49,0x9f,0x32,0x00,0x65,0x33,
-0x9d,0x39,0x31,0x7b,0xcc,0x40,0x2e,0x03,0x12,0x11,0xff,0x08,0x10,0x0e,0x0f,0x4a,
-0x02,0xa8,0x0b,0x12,0xe1,0x2b,0x01,0x21,0x3f,0x50,0xee,0x43,0x30,0x02,0xef,0x20,
-0x4d,0x74,0x61,0x00,0x2e,0x9a,0xe1,0x00,0x4e,0x1d,0x3b,0x31,0xad,0x20,0x3e,0x15,
-0x0b,0x33,0x07,0x70,0x3e,0x19,0x11,0x17,0x17,0xe9,0x6a,0x22,0x0f,0xff,0x5e,0x44,
-0x04,0xa0,0x2e,0x08,0x08,0x00,0x0f,0xd6,0xa4,0x01,0x50,0xdc,0xaa,0x30,0x00,0x39,
-0x24,0x8e,0x10,0x51,0x39,0x04,0x40,0x06,0x78,0x88,0x92,0x27,0x00,0x31,0x89,0x98,
-0xaf,0xe8,0x13,0x00,0x85,0x09,0x30,0x4f,0x88,0x60,0xb2,0x39,0x71,0x04,0xfa,0xa8,
-0x00,0x05,0xff,0x40,0xeb,0xa5,0x50,0xf5,0x7f,0x30,0x04,0xe0,0x46,0x39,0xb7,0x6f,
-0x30,0x4d,0x00,0x05,0xd3,0x00,0x00,0x44,0x04,0xd0,0x11,0x48,0x12,0xb0,0xd3,0x9c,
-0x11,0xaa,0x01,0x9c,0x00,0x70,0xbd,0x20,0xea,0x00,0x0d,0xc3,0x20,0x40,0x6e,0xe0,
-0x69,0x50,0xe5,0x6f,0x4e,0x54,0xf5,0xe3,0x0f,0x40,0x7f,0x90,0x04,0xf3,0x80,0x30,
-0x10,0x60,0x91,0x29,0x21,0x75,0x33,0xe1,0x4d,0x31,0x08,0xbc,0xc3,0x78,0x25,0x00,
-0x16,0x01,0x21,0x6d,0x00,0x89,0x30,0x01,0x87,0x25,0x40,0x07,0xe1,0x00,0x6d,0xa4,
-0x48,0x50,0xf5,0x00,0x06,0xff,0xfc,0x22,0xb9,0x20,0x00,0x6d,0xbd,0x12,0xf5,0x04,
-0xbc,0x10,0x06,0xd0,0x00,0x03,0xea,0x00,0xbc,0x10,0x6d,0x00,0x03,0xf7,0x00,0x00,
-0x86,0x05,0xc0,0xc9,0x77,0x00,0x48,0x99,0x30,0xdd,0x50,0x00,0x87,0x6f,0x22,0x4c,
-0xf3,0x51,0x09,0x12,0xe3,0x25,0x02,0x11,0xf2,0x97,0x02,0x30,0xbe,0x8d,0xe5,0xd0,
-0x09,0x91,0xe8,0x10,0x07,0xec,0x30,0x00,0x04,0x50,0x00,0xc1,0xc1,0x11,0x22,0x46,
-0xa4,0x51,0x00,0x9e,0xfe,0x00,0x0f,0x8f,0x0d,0x00,0x07,0x00,0xb1,0x05,0xcc,0xcd,
-0x90,0x0f,0x20,0xe3,0x01,0x55,0x5a,0xc0,0x15,0x00,0x21,0x0c,0x80,0x07,0x00,0x50,
-0x1f,0x30,0x0f,0x64,0xe3,0xca,0x08,0xe0,0x0f,0xdc,0xf3,0x00,0x00,0xfb,0x00,0x0f,
-0x30,0xe3,0x00,0x08,0xef,0x20,0x07,0x00,0x30,0x2f,0x3b,0x80,0x07,0x00,0xf2,0x03,
-0xc9,0x03,0xf1,0x0f,0x30,0xe3,0x07,0xd0,0x00,0xa8,0x0f,0x30,0xe3,0x0b,0x20,0x00,
-0x18,0x0f,0x51,0x52,0x0a,0x07,0x00,0x14,0x0e,0xf8,0x0d,0x11,0x40,0x05,0x01,0x11,
-0x02,0x04,0x01,0x21,0x00,0xd5,0x03,0x01,0x61,0x0d,0x50,0xef,0xff,0xef,0x80,0x43,
-0x4d,0x10,0xf3,0xc5,0x04,0x50,0x01,0xe9,0x02,0x44,0xd5,0xb1,0xba,0xf5,0x08,0xad,
-0xdf,0x50,0x01,0xcc,0xcb,0x00,0x00,0xd5,0x03,0xeb,0x01,0xe9,0x00,0x0d,0x55,0xf8,
-0x00,0x02,0xe5,0x00,0xd5,0x23,0x81,0x24,0x11,0x55,0x4a,0xa1,0x02,0x93,0x7c,0x00,
-0x6c,0x3c,0x00,0x76,0x45,0x10,0xf9,0x06,0x00,0x20,0xdb,0x03,0xc4,0x7f,0x11,0xea,
-0x25,0x3e,0x16,0xe6,0x83,0x8d,0x02,0x98,0x02,0x50,0x02,0x00,0x07,0xbc,0xc4,0x36,
-0x04,0xb0,0x11,0x22,0x30,0x00,0x0e,0x50,0xbf,0xff,0xef,0xa0,0x00,0x60,0x7e,0x02,
-0x7c,0x00,0xf6,0x0d,0xe6,0x0a,0xdd,0xf5,0x00,0x02,0xdf,0x60,0x24,0x4e,0x50,0x03,
-0xe9,0x5f,0x30,0x00,0xd5,0x06,0xf7,0x00,0x7e,0x20,0x0d,0x54,0xe4,0x00,0x00,0x66,
-0xd6,0x07,0x00,0x67,0x0f,0x1f,0x20,0x67,0x0f,0x15,0x90,0x34,0x20,0x00,0x04,0x10,
-0x82,0x00,0x7c,0xee,0x70,0x56,0x03,0xff,0xa2,0x40,0x06,0xee,0xff,0xb0,0x3d,0x0f,
-0x31,0x33,0x39,0xc0,0x60,0x0f,0x21,0x0d,0x70,0x07,0x00,0xf1,0x07,0x2f,0x20,0x0c,
-0x50,0xe3,0x00,0x00,0x9b,0x1c,0xcf,0x50,0xe3,0x00,0x01,0xfb,0x04,0x5d,0x50,0xe3,
-0x00,0x0a,0xdf,0x15,0x00,0x30,0x3f,0x2a,0xa0,0x07,0x00,0xf2,0x03,0xd8,0x02,0xf2,
-0x0c,0x50,0xe3,0x09,0xc0,0x00,0x99,0x0b,0x50,0xe3,0x0a,0x10,0x00,0x16,0x0b,0x54,
-0x00,0x03,0x07,0x00,0x13,0x0c,0x0e,0x00,0x25,0x30,0xd4,0x67,0x0f,0x22,0x55,0x32,
-0xc4,0x27,0x37,0xbd,0xdd,0x40,0x9b,0x96,0x11,0xee,0xd3,0x49,0x00,0xb2,0x7e,0x22,
-0x7f,0x40,0xba,0x04,0x18,0x80,0xd7,0xac,0x11,0x7f,0x1f,0x71,0x30,0x04,0xce,0x40,
-0x04,0x0c,0x60,0x1c,0xe7,0x00,0x00,0x3c,0xe2,0x18,0x21,0x12,0x3a,0x79,0x02,0x07,
-0x52,0x3e,0x00,0x78,0x0a,0x63,0x37,0xd2,0x22,0x22,0x20,0xaf,0x9f,0x0b,0x10,0x02,
-0x61,0x80,0x80,0x03,0x02,0x9c,0xca,0x00,0x00,0x4d,0x01,0x32,0x67,0x20,0x4e,0x2f,
-0xef,0x7d,0x11,0x3e,0x68,0x08,0x10,0x3e,0xc6,0xa2,0x00,0x1c,0x3d,0x10,0xfc,0x01,
-0x16,0xf5,0x01,0x6e,0x4d,0xa0,0x00,0x3e,0x07,0xe3,0x01,0xe8,0x00,0x3e,0x6d,0x20,
-0x50,0x2d,0x20,0x0e,0x1f,0x0f,0x80,0x25,0x17,0x13,0x01,0xc4,0x09,0x34,0xef,0xed,
-0x40,0x78,0x11,0x01,0x15,0x03,0x21,0xcc,0xcc,0x07,0x70,0x38,0x54,0x7f,0xa0,0x5b,
-0xad,0x21,0x7f,0xd0,0x2b,0x02,0x30,0xde,0x9f,0xc2,0x18,0x1f,0x70,0xe7,0x00,0x2a,
-0xf9,0x10,0x00,0x1a,0xb0,0x09,0x19,0x83,0xbc,0x7e,0x45,0x22,0x23,0x30,0x8f,0x2b,
-0x23,0x1b,0x06,0x98,0x3f,0x1d,0xc0,0x9b,0x85,0x00,0x01,0x00,0x15,0x47,0x5c,0x5a,
-0x11,0x00,0x8b,0x3b,0x18,0xff,0xed,0x09,0x11,0xdf,0xbc,0x5f,0x00,0xa3,0x09,0x21,
-0x6f,0xb1,0x7d,0x01,0x02,0xb7,0xad,0x11,0x3a,0x10,0xaf,0x90,0x06,0xcf,0xa3,0x04,
-0xce,0x81,0x00,0x00,0x95,0xc0,0x05,0x10,0x40,0x41,0x6f,0x00,0x46,0x6f,0x05,0xcf,
-0x52,0x45,0x11,0x13,0xf1,0x11,0x49,0x2c,0x00,0xb7,0x01,0x32,0xfe,0xff,0xe0,0x19,
-0x29,0x1a,0x5f,0x19,0x72,0x1a,0x3f,0x0f,0x00,0x11,0x09,0x17,0x01,0x12,0x21,0x8f,
-0x00,0x19,0xbd,0x8f,0x00,0x51,0xce,0xee,0xee,0xee,0x60,0xb9,0x01,0x22,0x6f,0xc1,
-0x7d,0x0c,0x11,0x80,0x91,0x34,0x21,0xff,0xe4,0xd5,0x0c,0xc9,0xc4,0x07,0xec,0x50,
-0x00,0x00,0xc8,0x20,0x00,0x00,0x7c,0x40,0x44,0x20,0x20,0xcc,0xcc,0x76,0x8d,0x12,
-0xe9,0x76,0xa2,0x02,0x75,0x08,0x1f,0xb0,0x7c,0x0d,0x19,0x0f,0x1e,0x01,0x0e,0x21,
-0x8f,0xa0,0xe8,0x05,0x01,0x67,0xb4,0xd6,0x15,0xaf,0xb7,0xde,0x94,0x00,0x00,0x0c,
-0xa6,0x10,0x00,0x27,0xb4,0x1a,0x6e,0x10,0xed,0xf5,0x0b,0x52,0xe1,0x02,0x23,0x33,
-0x6f,0xa6,0x50,0x22,0x04,0xf0,0xf3,0x47,0x32,0xef,0xee,0xed,0x6a,0x67,0x00,0xd5,
-0x1e,0x01,0xba,0x75,0x03,0x96,0x71,0x00,0xa3,0x6d,0x34,0x21,0x11,0x10,0xf1,0x67,
-0x12,0x41,0xbb,0x50,0x27,0xfe,0x50,0x8b,0x0b,0x03,0x9a,0x69,0x0f,0xb4,0x01,0x06,
-0x17,0xb0,0xb4,0x01,0x13,0x2a,0xb4,0x01,0x43,0xa2,0x04,0xce,0x80,0xb4,0x01,0x22,
-0x30,0x00,0xeb,0x1e,0x40,0x30,0x8f,0xff,0xee,0xb1,0x3d,0x07,0xb2,0x9f,0x14,0x5f,
-0x3f,0x27,0x10,0xe6,0x92,0x01,0x42,0xe3,0x00,0x05,0xe6,0x31,0x10,0x13,0x08,0x55,
-0x40,0x12,0xaa,0x31,0x10,0x20,0xae,0x20,0xb7,0x1e,0x27,0xdd,0xc7,0xcc,0x0c,0x30,
-0xae,0xcc,0x40,0xdd,0x3e,0x21,0x13,0x30,0xc6,0x56,0x10,0x12,0x3e,0x07,0x50,0xcf,
-0xfe,0xef,0x70,0x03,0xe7,0x63,0x30,0xe1,0x00,0x3e,0x9c,0xba,0x00,0x87,0x0e,0x20,
-0x4d,0xb9,0xc2,0x28,0x70,0xae,0x60,0x07,0xf3,0x03,0xe0,0x27,0xd7,0x15,0x11,0x3e,
-0x77,0x23,0x30,0x13,0xe0,0xef,0xab,0x3d,0x50,0x3e,0x01,0x12,0x2f,0x64,0x05,0x37,
-0x11,0x01,0x8b,0x40,0x00,0xcd,0x2c,0x03,0x0d,0x00,0x12,0x3f,0x0d,0x00,0x11,0xf0,
-0xd3,0x74,0x14,0x3f,0xfb,0x65,0x0f,0xbf,0x02,0x0f,0x02,0x66,0xb0,0x02,0x0b,0x01,
-0x30,0x4b,0xfc,0xf9,0x86,0x2a,0x80,0xde,0x92,0x03,0xbf,0x91,0x00,0x00,0x84,0x1d,
-0x1f,0x1a,0x30,0xac,0x0f,0x13,0xfe,0x26,0x90,0x15,0x10,0x75,0x1f,0x01,0x63,0x9c,
-0x02,0xbf,0x02,0x1f,0x6f,0xac,0x0e,0x0a,0x10,0x18,0x66,0x09,0x01,0x9d,0x0d,0x36,
-0x08,0xef,0xfc,0x04,0x3d,0xa2,0x9b,0xbb,0xcc,0xa0,0x00,0xe4,0x04,0x66,0x65,0xcc,
-0x7d,0x54,0x31,0x60,0x00,0xd5,0xc9,0xc8,0x21,0x0d,0x50,0x2c,0xaf,0x10,0xd5,0x9e,
-0xb4,0x00,0x0d,0x00,0x20,0x3f,0xda,0x0d,0x00,0xf1,0x04,0x1e,0x82,0xf4,0x00,0x0d,
-0x40,0x0c,0xb0,0x07,0xd0,0x00,0xd4,0x09,0xc0,0x00,0x0b,0x90,0x0d,0x40,0x02,0x38,
+0xa3,0xf0,0xa8,0x46,0x00,0xf2,0x00,0x40,0x53,0x00,0x00,0x24,0x44,0x44,0x44,0x40,
+0x00,0x00,0xbe,0xed,0xdd,0xdd,0xd5,0x02,0x00,0x9f,0x03,0x0e,0x07,0x00,0x03,0x1c,
+0x00,0x11,0xb2,0x01,0x01,0xf0,0x00,0x10,0x00,0x00,0x0c,0xfe,0xfb,0x6f,0xff,0xa0,
+0x00,0x00,0x00,0x1f,0x50,0x02,0x64,0x04,0x40,0x0b,0xb0,0x00,0xc8,0x05,0x03,0xf0,
+0x05,0xfe,0x20,0x9f,0xc0,0x00,0x00,0x05,0xe3,0x7d,0x8d,0x1b,0xc1,0x00,0x01,0xe3,
+0x00,0x9e,0x10,0x08,0x70,0x67,0x02,0x10,0xd0,0xc4,0x00,0x81,0x22,0x22,0x8d,0x22,
+0x22,0x22,0x08,0xff,0x01,0x00,0x2b,0xf2,0x00,0x01,0x00,0x10,0x3f,0x16,0x00,0x83,
+0x00,0x00,0x00,0x22,0x22,0x21,0x15,0xf0,0x13,0x00,0x02,0x07,0x00,0x00,0x11,0x03,
+0x06,0x05,0x03,0x33,0x00,0x02,0xa0,0x8b,0x01,0xf2,0x2c,0x60,0x9e,0xe9,0x9e,0xe9,
+0x00,0x4e,0x01,0x2b,0x91,0x2a,0x90,0x04,0xe0,0x00,0xe5,0x00,0xd5,0x00,0x4e,0x00,
+0x3f,0x10,0x3f,0x20,0x04,0xe0,0x08,0xf5,0x08,0xf7,0x00,0x4e,0x00,0xec,0xb0,0xea,
+0xd0,0x04,0xe0,0x7c,0x2f,0x8d,0x0f,0x30,0x4e,0x0e,0x40,0xaf,0x40,0x8a,0x04,0xe2,
+0x80,0x02,0x80,0x00,0x50,0x4e,0x41,0x00,0x10,0x80,0x4b,0x03,0x21,0x33,0x31,0x58,
+0x03,0x21,0xef,0xd0,0x14,0x00,0x12,0x5e,0xb7,0x04,0x02,0x0d,0x00,0x18,0x5d,0x0d,
+0x00,0x20,0x39,0x01,0x74,0x03,0x61,0x61,0x00,0x00,0x6e,0xfe,0xd0,0x17,0x02,0x20,
+0x01,0x11,0x7e,0x04,0xc2,0x06,0xdd,0xdd,0xee,0x10,0x0d,0x50,0x00,0x14,0x44,0x48,
+0xf1,0x8d,0x04,0x10,0xab,0x74,0x04,0x00,0x1a,0x01,0x20,0x00,0xd6,0x33,0x05,0xf1,
+0x01,0xe0,0x00,0x0d,0x82,0x31,0x00,0x02,0xf7,0x00,0x00,0xdf,0xff,0x80,0x00,0xcf,
+0xc0,0xac,0x04,0xa0,0x7e,0x3f,0x50,0x00,0xc5,0x00,0x00,0x3f,0x40,0x6e,0x0f,0x00,
+0xe2,0x1e,0x60,0x00,0xc9,0x00,0xc5,0x00,0x09,0x70,0x00,0x02,0xc0,0x0c,0x60,0xde,
+0x00,0x03,0xf0,0x01,0x0b,0x0f,0x00,0xf1,0x00,0x06,0x20,0x00,0x00,0x65,0x33,0x00,
+0x00,0x17,0x00,0x00,0x00,0x7b,0xcc,0x40,0x2e,0x03,0x30,0x11,0x22,0x20,0x08,0x00,
+0x61,0x0e,0xff,0xff,0xf6,0x00,0x4e,0x25,0x00,0x12,0xe1,0x2b,0x01,0xf0,0x03,0x3f,
+0x50,0x00,0x4f,0xff,0xe0,0x00,0x02,0xef,0x20,0x00,0x4f,0x22,0x10,0x00,0x2e,0x9a,
+0xe1,0x20,0x00,0xe0,0x03,0xe9,0x00,0xad,0x20,0x3e,0x00,0x00,0x3f,0x70,0x00,0x07,
+0x70,0x3e,0x50,0x05,0x12,0x00,0x50,0x00,0x00,0x0c,0x01,0x10,0x42,0xd7,0x04,0x40,
+0xff,0xee,0xee,0xfe,0x08,0x00,0x12,0x30,0x73,0x01,0x08,0x08,0x00,0x10,0x4e,0x08,
+0x00,0x40,0xdc,0xbb,0xcc,0xdd,0x30,0x00,0xf0,0x02,0x45,0x55,0x44,0x31,0x00,0x00,
+0x00,0xdc,0xaa,0x30,0x00,0x39,0x00,0x00,0x01,0x45,0x51,0x39,0x04,0x40,0x06,0x78,
+0x88,0x92,0x27,0x00,0x60,0x89,0x98,0xaf,0x50,0x04,0xe0,0x1b,0x02,0xf1,0x00,0xc0,
+0x00,0x4f,0x88,0x60,0x00,0x07,0xf2,0x00,0x04,0xfa,0xa8,0x00,0x05,0xff,0xb5,0x00,
+0xf6,0x06,0x06,0xf5,0x7f,0x30,0x04,0xe0,0x00,0x08,0xf5,0x00,0x6f,0x30,0x4d,0x00,
+0x05,0xd3,0x00,0x00,0x44,0x04,0xd0,0x0c,0x02,0x40,0x06,0xb0,0x00,0x7b,0x08,0x00,
+0x40,0xaa,0x00,0x0a,0xa0,0x85,0x03,0x30,0x90,0x00,0xea,0x16,0x00,0xf2,0x1b,0xef,
+0x40,0x6e,0xf6,0x00,0x00,0x01,0xe5,0x6f,0x4e,0x54,0xf5,0x00,0x00,0xb9,0x00,0x7f,
+0x90,0x04,0xf3,0x00,0x06,0x00,0x00,0x60,0x00,0x02,0x10,0x00,0x75,0x33,0x00,0x00,
+0x13,0x00,0x00,0x08,0xbc,0xc3,0x00,0x06,0xd0,0x16,0x01,0x90,0x6d,0x00,0x00,0xef,
+0xff,0xff,0x50,0x06,0xd0,0x83,0x02,0xf0,0x01,0xe1,0x00,0x6d,0x33,0x20,0x00,0x03,
+0xf5,0x00,0x06,0xff,0xfc,0x00,0x02,0xee,0x10,0x1e,0x00,0xf4,0x08,0x02,0xea,0xbc,
+0x10,0x06,0xd0,0x00,0x03,0xea,0x00,0xbc,0x10,0x6d,0x00,0x03,0xf7,0x00,0x00,0x86,
+0x05,0xc0,0x00,0x02,0x87,0x00,0xc1,0xbc,0xcc,0xcd,0xdd,0x50,0x00,0x00,0x03,0x44,
+0x44,0x4c,0xf3,0x11,0x00,0x22,0x1b,0xe3,0x25,0x02,0x11,0xf2,0x97,0x02,0x20,0xbe,
+0x8d,0x1e,0x03,0x80,0x2b,0xe8,0x10,0x07,0xec,0x30,0x00,0x04,0x21,0x04,0x40,0x55,
+0x00,0x00,0x22,0xac,0x04,0x70,0x71,0x00,0x9e,0xfe,0x00,0x0f,0x20,0x2e,0x00,0x00,
+0x07,0x00,0xb1,0x05,0xcc,0xcd,0x90,0x0f,0x20,0xe3,0x01,0x55,0x5a,0xc0,0x15,0x00,
+0x21,0x0c,0x80,0x07,0x00,0xf0,0x08,0x1f,0x30,0x0f,0x64,0xe3,0x00,0x00,0x8c,0x00,
+0x0f,0xdc,0xf3,0x00,0x00,0xfb,0x00,0x0f,0x30,0xe3,0x00,0x08,0xef,0x20,0x07,0x00,
+0x30,0x2f,0x3b,0x80,0x07,0x00,0xf2,0x04,0xc9,0x03,0xf1,0x0f,0x30,0xe3,0x07,0xd0,
+0x00,0xa8,0x0f,0x30,0xe3,0x0b,0x20,0x00,0x18,0x0f,0x30,0x54,0x00,0x09,0x07,0x00,
+0x11,0x0e,0x69,0x00,0x00,0xd1,0x03,0x01,0x05,0x01,0x11,0x02,0x04,0x01,0x21,0x00,
+0xd5,0x03,0x01,0x60,0x0d,0x50,0xef,0xff,0xef,0x80,0x99,0x02,0x20,0x04,0xf3,0xc5,
+0x04,0xf1,0x11,0x01,0xe9,0x02,0x44,0xd5,0x00,0x01,0xdf,0x10,0xad,0xdf,0x50,0x01,
+0xcc,0xcb,0x00,0x00,0xd5,0x03,0xeb,0x01,0xe9,0x00,0x0d,0x55,0xf8,0x00,0x02,0xe5,
+0x00,0xd5,0x23,0xec,0x04,0x11,0x40,0xcb,0x00,0x10,0xd4,0x0b,0x00,0x11,0x70,0x7d,
+0x05,0x11,0xf9,0x2f,0x03,0x20,0xec,0xf9,0x06,0x00,0xf4,0x02,0xdb,0x03,0xeb,0x00,
+0x00,0x04,0xea,0x00,0x01,0xcd,0x20,0x00,0xe6,0x00,0x00,0x00,0x8a,0x2e,0x01,0x11,
+0x65,0x7c,0x00,0x30,0x07,0xbc,0xc4,0x36,0x04,0xa0,0x11,0x22,0x30,0x00,0x0e,0x50,
+0xbf,0xff,0xef,0xa0,0x7c,0x00,0x12,0x02,0x7c,0x00,0xf7,0x0d,0xe6,0x0a,0xdd,0xf5,
+0x00,0x02,0xdf,0x60,0x24,0x4e,0x50,0x03,0xe9,0x5f,0x30,0x00,0xd5,0x06,0xf7,0x00,
+0x7e,0x20,0x0d,0x54,0xe4,0x00,0x00,0x66,0xd6,0x07,0xf0,0x06,0x01,0x33,0x10,0x20,
+0x00,0x00,0x2b,0xfd,0xdf,0xc3,0x00,0x00,0x0d,0xa1,0x00,0x08,0xf1,0x00,0x03,0xf1,
+0x00,0x47,0x07,0x21,0x3f,0x10,0x8a,0x04,0xf2,0x0a,0xcc,0x41,0x14,0xcd,0x00,0x00,
+0x01,0x8d,0xee,0xc9,0x10,0x00,0x34,0x20,0x00,0x04,0x10,0x82,0x00,0x7c,0xee,0x00,
+0x0c,0x50,0xe4,0xbd,0x00,0xc0,0xe3,0x06,0xee,0xff,0xb0,0x0d,0x40,0xe3,0x00,0x33,
+0x39,0xc0,0x07,0x00,0x31,0x00,0x0d,0x70,0x07,0x00,0xf1,0x07,0x2f,0x20,0x0c,0x50,
+0xe3,0x00,0x00,0x9b,0x1c,0xcf,0x50,0xe3,0x00,0x01,0xfb,0x04,0x5d,0x50,0xe3,0x00,
+0x0a,0xdf,0x15,0x00,0x30,0x3f,0x2a,0xa0,0x07,0x00,0xf2,0x03,0xd8,0x02,0xf2,0x0c,
+0x50,0xe3,0x09,0xc0,0x00,0x99,0x0b,0x50,0xe3,0x0a,0x10,0x00,0x16,0x0b,0x54,0x00,
+0x03,0x07,0x00,0x13,0x0c,0x0e,0x00,0x32,0x30,0xd4,0x00,0x86,0x05,0x32,0x00,0x00,
+0x55,0x89,0x07,0x46,0x07,0xbd,0xdd,0x40,0xbe,0x02,0x51,0x02,0xee,0xee,0xee,0xe9,
+0x51,0x03,0x32,0x22,0x7f,0x40,0xba,0x04,0x12,0x80,0x07,0x00,0x02,0xba,0x04,0x30,
+0x7f,0xee,0x40,0x55,0x01,0xf7,0x04,0xce,0x40,0x8f,0x91,0x00,0x00,0x1c,0xe7,0x00,
+0x00,0x3c,0xe2,0x00,0x00,0x50,0x00,0x3a,0x00,0x02,0x6f,0x04,0x01,0x7d,0x04,0x92,
+0x01,0x22,0x22,0x37,0xd2,0x22,0x22,0x20,0xaf,0x34,0x05,0xf0,0x0a,0x20,0x02,0x74,
+0x32,0x00,0x00,0x03,0x02,0x9c,0xca,0x00,0x00,0x4d,0x01,0x12,0x22,0x10,0x00,0x4e,
+0x2f,0xff,0xef,0xf0,0x00,0x3e,0x68,0x08,0x00,0x06,0x00,0xf0,0x10,0x9e,0x10,0x00,
+0x3e,0x00,0x07,0xfc,0x00,0x00,0x3e,0x00,0x6e,0x4d,0xa0,0x00,0x3e,0x07,0xe3,0x01,
+0xe8,0x00,0x3e,0x6d,0x20,0x50,0x2d,0x20,0x3e,0x00,0x02,0xf0,0x18,0x00,0x20,0x02,
+0xf1,0x06,0x00,0xf7,0x02,0x01,0xf1,0x00,0x20,0x3e,0x9c,0xcc,0xfd,0xef,0xe4,0x3e,
+0x34,0x44,0x43,0x20,0x00,0x3e,0x70,0x05,0x14,0x3e,0xe9,0x06,0x13,0x01,0xc4,0x09,
+0x32,0xef,0xed,0x40,0x13,0x00,0x12,0x10,0x15,0x03,0x20,0xcc,0xcc,0xbf,0x00,0x42,
+0x55,0x54,0x7f,0xa0,0x30,0x00,0x12,0xc0,0xd6,0x00,0x11,0xd0,0x2b,0x02,0xe0,0xde,
+0x9f,0xc2,0x00,0x00,0x00,0x6c,0xe7,0x00,0x2a,0xf9,0x10,0x00,0x1a,0xb0,0x09,0x15,
+0x83,0x19,0x01,0x80,0x21,0x11,0x11,0x11,0x22,0x23,0x30,0x8f,0xcc,0x00,0x63,0xfe,
+0xee,0x20,0x00,0x00,0x06,0xec,0x00,0x13,0x6d,0xf7,0x03,0x12,0xc0,0x08,0x00,0x1a,
+0x6c,0x0f,0x00,0x13,0x47,0xd7,0x09,0x12,0x20,0x86,0x00,0x28,0xbe,0xff,0xed,0x09,
+0x51,0xdf,0xff,0xff,0xff,0x60,0xaf,0x09,0x21,0x6f,0xb1,0x7d,0x01,0x11,0xbf,0xb3,
+0x02,0x30,0x3a,0xfd,0xf8,0x42,0x00,0x80,0xcf,0xa3,0x04,0xce,0x81,0x00,0x00,0x95,
+0xc0,0x05,0x40,0x40,0x00,0x11,0x10,0x2f,0x05,0x23,0x10,0x7f,0x4e,0x01,0x51,0x00,
+0x11,0x13,0xf1,0x11,0x45,0x00,0x13,0x2f,0xb7,0x01,0xb2,0xfe,0xff,0xe0,0x00,0x00,
+0x03,0x33,0x33,0x33,0x5f,0x10,0x7a,0x06,0x13,0xf1,0x89,0x06,0x0a,0x0f,0x00,0x11,
+0x09,0x17,0x01,0x12,0x21,0x8f,0x00,0x19,0xbd,0x8f,0x00,0x51,0xce,0xee,0xee,0xee,
+0x60,0xb9,0x01,0x21,0x6f,0xc1,0x1f,0x00,0x11,0x9f,0xfb,0x01,0x30,0x18,0xff,0xe4,
+0x40,0x00,0xc5,0x9f,0xc4,0x07,0xec,0x50,0x00,0x00,0xc8,0x20,0x00,0x00,0x7c,0x31,
+0x02,0x21,0x6c,0xcc,0x01,0x00,0x85,0x12,0x55,0x55,0x55,0xe9,0x55,0x55,0x50,0x75,
+0x08,0x12,0xb0,0x7d,0x07,0x40,0x2f,0x20,0x0b,0x30,0x9e,0x00,0x03,0x7c,0x00,0x22,
+0x2f,0x10,0x77,0x00,0x50,0xff,0xee,0xee,0xef,0xf5,0x2c,0x03,0x3f,0x33,0x33,0x32,
+0x1e,0x01,0x11,0x21,0x8f,0xa0,0xe8,0x05,0x10,0xef,0x1e,0x00,0xd5,0x15,0xaf,0xb7,
+0xde,0x94,0x00,0x00,0x0c,0xa6,0x10,0x00,0x27,0xb4,0x74,0x05,0x20,0xee,0xed,0xf5,
+0x0b,0x85,0xe1,0x02,0x23,0x33,0x6f,0x22,0x22,0x21,0x7c,0x0a,0xc2,0x3d,0xdd,0xef,
+0xee,0xed,0x00,0x00,0x00,0x44,0x44,0x44,0x36,0x89,0x07,0x80,0x11,0x4f,0x00,0x00,
+0x02,0xff,0xff,0xff,0x2d,0x01,0x21,0x4f,0x21,0x55,0x01,0x90,0x04,0xf3,0x22,0x22,
+0x33,0x41,0x00,0x00,0x1e,0xda,0x01,0x07,0x81,0x00,0x03,0x96,0x00,0x1f,0x02,0xb4,
+0x01,0x06,0x17,0xb0,0xb4,0x01,0x13,0x2a,0xb4,0x01,0x43,0xa2,0x04,0xce,0x80,0xb4,
+0x01,0xf6,0x02,0x30,0x00,0x22,0x22,0x22,0x33,0x33,0x33,0x30,0x8f,0xff,0xee,0xff,
+0xee,0xee,0xee,0x20,0x0e,0x08,0x02,0xa3,0x01,0x40,0x08,0xee,0xdf,0xe6,0x92,0x01,
+0x30,0xe3,0x00,0x05,0x08,0x00,0x90,0xf5,0x00,0x00,0x08,0xb0,0x00,0x00,0x0e,0x60,
+0x3c,0x06,0x00,0x92,0x0c,0x20,0x24,0xae,0x82,0x00,0x37,0x4a,0xdd,0xc7,0xcc,0x0c,
+0x90,0xae,0xcc,0x40,0x00,0x29,0x00,0x00,0x13,0x30,0x81,0x0a,0x20,0x11,0x12,0x3e,
+0x07,0xa0,0xcf,0xfe,0xef,0x70,0x03,0xe0,0x00,0x00,0x09,0xe1,0xff,0x02,0xf0,0x09,
+0x0a,0xf5,0x00,0x03,0xe0,0x00,0x4d,0xb9,0xe3,0x00,0x3e,0x00,0xae,0x60,0x07,0xf3,
+0x03,0xe0,0x27,0x00,0x00,0x03,0x30,0x3e,0x60,0x01,0xf1,0x04,0x35,0x13,0xe0,0xef,
+0xff,0xff,0xff,0xe4,0x3e,0x01,0x12,0x2f,0x64,0x10,0x03,0xe0,0x00,0x01,0xf2,0x33,
+0x03,0x33,0x1f,0x20,0x00,0x0d,0x00,0x11,0x3f,0x0d,0x00,0x00,0xa7,0x00,0x15,0xe1,
+0xc3,0x08,0x1f,0x30,0xbf,0x02,0x10,0x11,0xb0,0x63,0x02,0x02,0x0b,0x01,0xc0,0x4b,
+0xfc,0xf9,0x10,0x00,0x00,0x07,0xde,0x92,0x03,0xbf,0x91,0x2a,0x0b,0x44,0x00,0x00,
+0x28,0x30,0x33,0x00,0x21,0x8f,0xff,0x40,0x03,0x21,0x20,0x22,0x01,0x00,0x05,0xd8,
+0x00,0x44,0x03,0xee,0xee,0xee,0xbf,0x02,0x1a,0x6f,0x39,0x09,0x28,0x3f,0x00,0x4c,
+0x0c,0x20,0x00,0x18,0x66,0x09,0x01,0x9d,0x0d,0x30,0x08,0xef,0xfc,0xe3,0x0b,0x01,
+0x45,0x06,0xb1,0x40,0x9b,0xbb,0xcc,0xa0,0x00,0xe4,0x04,0x66,0x65,0xcc,0x86,0x05,
+0x20,0x0e,0x60,0x93,0x05,0x21,0x06,0xf1,0x0d,0x00,0x11,0xe8,0x69,0x0d,0x20,0x8f,
+0x20,0x0d,0x00,0x20,0x3f,0xda,0x0d,0x00,0xf0,0x05,0x1e,0x82,0xf4,0x00,0x0d,0x40,
+0x0c,0xb0,0x07,0xd0,0x00,0xd4,0x09,0xc0,0x00,0x0b,0x90,0x0d,0x40,0xa1,0x48,0x08,
 0x0f,0x9d,0x0d,0x09,0x90,0x65,0x33,0x10,0x00,0x02,0x00,0x06,0xbc,0xc5,0xfb,0x0d,
-0xa0,0x11,0x22,0x31,0x00,0x0c,0x70,0xbf,0xff,0xef,0xb0,0x08,0x0e,0x21,0x02,0xf6,
-0x52,0x29,0x10,0xcc,0xdc,0x1c,0x00,0xf8,0xb7,0x00,0x18,0x5e,0x10,0xad,0xd2,0x17,
-0x70,0xcd,0x10,0xbc,0x00,0x0b,0x72,0xea,0x28,0x0d,0x20,0xc7,0x14,0x28,0x0d,0x21,
-0x0c,0x70,0x22,0x06,0x11,0x31,0x22,0x06,0x11,0xd4,0x22,0x06,0x24,0x07,0xf2,0x35,
-0x47,0x00,0xa9,0x03,0x11,0xe6,0x22,0x06,0x20,0xbe,0x10,0x22,0x06,0x29,0xd9,0x20,
-0xb5,0xaf,0x01,0x54,0x7e,0x23,0xfe,0xff,0x4a,0x0a,0x13,0x5e,0x08,0x00,0x13,0x9a,
-0x21,0x01,0x01,0x60,0x1a,0x14,0x1e,0xf2,0x61,0x32,0x11,0x2f,0x50,0xb5,0xaf,0x12,
-0x9c,0xb5,0xaf,0x22,0x04,0xf2,0x49,0x01,0x12,0x2e,0x29,0x3d,0x22,0x01,0xd8,0x59,
-0x01,0x23,0x0d,0x80,0xb4,0x70,0x0f,0x40,0x35,0x11,0x15,0x02,0x48,0x1a,0xb2,0x02,
-0x44,0x45,0x51,0x0e,0x20,0x4d,0x09,0xdd,0xdc,0xf6,0x41,0x7a,0x11,0xf3,0x07,0x00,
-0x21,0x02,0xf0,0x07,0x00,0xf0,0x02,0x06,0xd0,0x0f,0x20,0x4d,0x1a,0xbb,0xbe,0x80,
-0x0f,0x31,0x5d,0x05,0x66,0x8f,0x20,0x0f,0xef,0x0f,0x11,0xaa,0x6b,0x7a,0x21,0x03,
-0xf2,0x07,0x00,0x21,0x0d,0x80,0x07,0x00,0x10,0xad,0xfe,0x07,0x31,0x4d,0x06,0xf2,
-0x07,0x00,0x21,0x0e,0x30,0x07,0x00,0x02,0x13,0x08,0x09,0x48,0x1a,0x28,0x20,0x4e,
-0xb0,0xa4,0xd1,0x28,0x16,0x67,0x77,0x84,0x00,0x5d,0x2a,0xaa,0x99,0xda,0x00,0x5d,
-0x92,0x21,0x11,0x5d,0x08,0x44,0x11,0x5d,0xa9,0x0b,0xd1,0x5d,0x7f,0xff,0xff,0x71,
-0x33,0x7d,0x00,0x11,0x7e,0x09,0xfe,0xfd,0x81,0xa9,0x11,0x5e,0xa9,0x43,0x30,0x5e,
-0x00,0x7e,0xd8,0x6f,0x20,0x05,0xe3,0x9c,0x06,0x01,0xd3,0x9c,0x2c,0x5d,0x32,0x1f,
-0x31,0x18,0x5d,0x1c,0x59,0x03,0xa0,0x13,0xa1,0x13,0x34,0x45,0x20,0x00,0xe4,0x0a,
-0xdd,0xcc,0xec,0x17,0x0f,0x21,0x0c,0xa0,0x71,0x02,0xe0,0xf7,0x00,0x0e,0x40,0xde,
-0xee,0xef,0x22,0x22,0xe4,0x02,0x23,0x3d,0xb1,0xe0,0xab,0x11,0x08,0xe6,0x3d,0x20,
-0x08,0xf4,0x8b,0x02,0x21,0x2c,0xe4,0x0f,0x9e,0x1f,0x91,0xe0,0xab,0x24,0x50,0x03,
-0x10,0x8e,0xee,0xff,0x1c,0x9e,0x30,0x32,0x21,0x9d,0x36,0x1a,0x00,0x2e,0x01,0xe1,
-0xb7,0x0c,0xdd,0xde,0xf2,0x34,0x4c,0x70,0x24,0x45,0xf8,0x0c,0xdd,0xf7,0x6a,0x02,
-0x40,0x0b,0x70,0x01,0xcc,0x2e,0x18,0x21,0x06,0xe9,0x69,0x0b,0x01,0xc9,0x24,0x11,
-0x84,0x38,0x27,0x12,0x31,0x0e,0x4a,0x06,0x99,0x8c,0x01,0xc9,0x97,0x12,0x06,0xfc,
-0x23,0x05,0x0e,0x4a,0x12,0x22,0x1c,0x9e,0x08,0xcb,0x97,0x00,0xf5,0x17,0x10,0xad,
-0xde,0x18,0x72,0xe5,0x02,0x32,0x22,0xac,0x00,0x0e,0xcb,0x2b,0xe0,0xe5,0x07,0x77,
-0x78,0xf3,0x22,0x2e,0x51,0x9a,0xa9,0xec,0x0e,0xff,0xf5,0x4a,0x1d,0x00,0x1a,0x00,
-0x00,0x1c,0x08,0x30,0xe5,0x02,0xce,0xb5,0x01,0x26,0x41,0xe7,0xbb,0xaa,0x0f,0x5c,
-0xac,0x1f,0x00,0xfa,0x17,0xc2,0xbd,0xde,0xee,0x70,0x00,0xe4,0x02,0x33,0x32,0xc8,
-0x00,0x0e,0xf5,0x2b,0x40,0xe4,0x07,0x88,0x8a,0x29,0x84,0x60,0x89,0x99,0xf8,0x0b,
-0xdd,0xf4,0x29,0x4f,0x60,0x34,0x4e,0x40,0x00,0x7e,0x20,0x68,0x00,0x10,0x9e,0x8c,
-0x77,0x21,0x42,0xda,0xae,0xad,0x71,0x24,0x00,0x00,0x05,0x40,0x0d,0x40,0xf1,0x26,
-0x00,0x32,0x78,0x00,0xbd,0x34,0x00,0x3c,0xb8,0x02,0x0b,0xc0,0x12,0xcc,0x70,0xcb,
-0x30,0xbd,0x10,0x00,0xdf,0x17,0x30,0x9e,0x20,0x02,0xee,0x10,0x12,0x66,0x77,0x63,
-0xd1,0x2a,0x02,0x55,0x55,0x61,0x03,0xe0,0x3e,0x06,0xcc,0xcb,0xf6,0x03,0xfe,0x83,
-0x11,0xf3,0x07,0x00,0x21,0x02,0xf0,0x07,0x00,0xf0,0x02,0x06,0xd0,0x03,0xe0,0x3e,
-0x0b,0xcc,0xce,0x83,0x47,0xe0,0x3e,0x03,0x44,0x6f,0x2a,0xdd,0x15,0x00,0x10,0x9c,
-0x5c,0x84,0x01,0xe6,0x4a,0x20,0xe0,0x3e,0x52,0x1b,0x00,0x07,0x00,0x20,0x7e,0x10,
-0x07,0x00,0x30,0x04,0xf4,0x00,0x07,0x00,0x00,0x2d,0x04,0x02,0x4d,0x00,0x0a,0x07,
-0x00,0x00,0x0d,0x32,0x0f,0xc5,0x02,0x0f,0xa0,0xf5,0x77,0xad,0x00,0x00,0x07,0xd3,
-0xaa,0xcd,0x7f,0xb8,0x75,0x40,0x5d,0x00,0x11,0x7e,0x95,0x02,0x04,0xc5,0x02,0x9f,
-0x1e,0xee,0xee,0x00,0x7e,0x10,0x03,0x33,0x7e,0xc5,0x02,0x1c,0x2c,0x07,0x20,0xd4,
-0x01,0xd1,0x9c,0xff,0xf5,0x03,0x44,0x44,0xf4,0x36,0x6e,0x51,0xcd,0xdd,0xfd,0x26,
-0x0f,0x21,0x4f,0x30,0xad,0x01,0x70,0x50,0x2d,0xdd,0xf5,0x00,0x9f,0x40,0xd4,0x01,
-0x01,0x5f,0x01,0x23,0xe4,0x02,0xb3,0x00,0x0f,0xd4,0x01,0x1a,0x12,0x01,0x2f,0x79,
-0x13,0x03,0x97,0x6a,0x06,0xac,0x2e,0x01,0xba,0x2e,0x00,0x8e,0x02,0x01,0xd8,0xcf,
-0x46,0xee,0xee,0xef,0x90,0x8f,0x75,0x04,0xfa,0x31,0x22,0x06,0xa0,0x86,0x22,0x12,
-0x8c,0x58,0x1d,0x17,0x08,0x9d,0xa4,0x00,0xe2,0xaa,0x18,0xfd,0xe2,0xaa,0x03,0xcd,
-0xa2,0x05,0x60,0x99,0x0a,0x6a,0x7b,0x00,0xbb,0x1f,0x12,0xfa,0x7e,0x4a,0x22,0x09,
-0x90,0x6a,0x19,0x10,0x75,0x20,0x03,0x25,0x3f,0x52,0x27,0xa4,0x07,0xf6,0x44,0x11,
-0x44,0x7b,0x8c,0x10,0x02,0xfe,0xb8,0x07,0x78,0x06,0x43,0x44,0x44,0x45,0x57,0x82,
-0x88,0x18,0xda,0x82,0x88,0x13,0x34,0x82,0x88,0x12,0xdd,0x44,0x7c,0x24,0x11,0x12,
-0x54,0xa3,0x12,0x70,0x7c,0x13,0x1a,0xb8,0xcd,0xa2,0x11,0xb8,0xe1,0x06,0x32,0xef,
-0xff,0x70,0xbb,0x76,0x1e,0xd6,0xd4,0x99,0x07,0xdc,0x40,0x18,0x20,0x63,0x58,0x01,
-0x88,0x2c,0x13,0x32,0x52,0x97,0x08,0x77,0x07,0x12,0xc0,0x09,0x58,0x11,0x6f,0xb9,
-0x15,0x36,0x22,0x26,0xe0,0xc7,0x83,0x07,0x86,0x0b,0x42,0x4a,0x00,0x00,0x33,0x3d,
-0xa4,0x50,0x3d,0xde,0xee,0xee,0xee,0xb7,0xbb,0x0a,0xf0,0x00,0x01,0xc3,0x00,0x07,
-0x53,0x49,0x00,0x27,0x71,0x12,0xf3,0xf0,0x00,0x1f,0xdc,0x8d,0x5c,0x06,0x08,0x79,
-0x6a,0x12,0x80,0xd0,0x27,0x16,0xaa,0xac,0xa8,0x11,0x3f,0x8d,0x35,0x00,0x86,0x01,
-0x23,0x11,0x1b,0xff,0x00,0x15,0xb6,0x40,0x06,0x1b,0x9e,0x6f,0x98,0x03,0x01,0x00,
-0x00,0x9f,0x09,0x20,0x55,0x30,0x89,0x94,0x33,0xdd,0xdd,0xee,0x3c,0x6b,0x12,0xe0,
-0x21,0x05,0x16,0x5e,0x4b,0x6b,0x00,0x78,0x24,0x12,0xec,0x51,0x77,0x03,0x8e,0x75,
-0x0f,0x0d,0x06,0x10,0x0e,0x48,0x03,0x0f,0x0d,0x06,0x26,0xb0,0x10,0x7c,0xdd,0xdd,
-0xc0,0x00,0xc7,0x02,0x44,0x33,0x7f,0x98,0x05,0x00,0xaf,0x25,0xb1,0xc7,0x0a,0xcc,
-0xcc,0xf5,0x00,0x0c,0x70,0x34,0x55,0xeb,0x11,0x16,0x80,0xae,0x10,0x00,0x0c,0x70,
-0x01,0xcc,0x10,0x92,0xae,0x02,0x98,0x05,0x19,0x62,0xb4,0xa3,0x13,0x5e,0xa8,0x5f,
-0x05,0xb4,0xa3,0x30,0xe5,0x00,0x06,0xe4,0x1e,0x0f,0x98,0x05,0x0c,0x03,0x48,0x97,
-0x20,0x0e,0x40,0xf5,0x20,0x1e,0x70,0x48,0x97,0x03,0x0e,0x00,0x60,0x11,0x11,0x00,
-0x0d,0x61,0x20,0x96,0x01,0x42,0x0c,0xff,0xf8,0xf5,0x80,0x11,0x0d,0x4f,0x97,0xef,
-0x21,0x0c,0x50,0x00,0xde,0xed,0xef,0xf8,0x0c,0x50,0x00,0x03,0x33,0x21,0x48,0x97,
-0x11,0x20,0x00,0x40,0xfd,0x3f,0x10,0xe7,0x8f,0x01,0x42,0xe7,0x44,0x43,0x10,0xb3,
-0x3f,0x12,0x00,0x0f,0x00,0x90,0x44,0x20,0x04,0xf2,0x21,0x0f,0xee,0xed,0xd7,0xc6,
-0x22,0x11,0xf4,0xb6,0x09,0x00,0x9b,0x62,0x31,0x24,0x50,0x3f,0xc3,0x1c,0x14,0xc8,
-0xc5,0x09,0x13,0x2b,0xc8,0x5b,0x07,0x6f,0x86,0x00,0x63,0x45,0x12,0xf0,0x6a,0x23,
-0x13,0x6f,0x67,0xa1,0x15,0xb0,0xae,0x1b,0x22,0x01,0xf5,0x84,0x73,0x06,0x0d,0xb7,
-0x00,0x9b,0x51,0x30,0xbd,0xdd,0xde,0xfe,0x00,0x00,0x86,0x00,0x22,0x0d,0x60,0xfe,
-0x00,0x00,0xb3,0x97,0xc1,0x33,0x20,0x0d,0x60,0x00,0xff,0xee,0xed,0x70,0x0d,0xff,
-0xf7,0xe9,0x00,0x03,0x4d,0x98,0xd3,0x60,0x00,0xe8,0x44,0x56,0x85,0x0c,0x60,0x00,
-0x8c,0xcc,0xb8,0x52,0xd4,0x00,0x15,0x07,0x9f,0x75,0x12,0x04,0x7d,0xa6,0x00,0x84,
-0x00,0x12,0x0c,0x63,0x53,0x07,0x07,0x00,0x30,0xfc,0xcc,0xcc,0x8f,0xbf,0x54,0x55,
-0x55,0x55,0x43,0x00,0x7b,0x73,0xe1,0x67,0x67,0x72,0x0e,0x30,0x3e,0x3f,0xaa,0xaa,
-0x40,0xe3,0x03,0xe4,0xf0,0xe1,0x22,0x11,0x4e,0x3a,0x73,0x00,0x6b,0x9e,0x00,0x95,
-0x73,0xc9,0x66,0x66,0x20,0xe5,0x25,0xe4,0xfb,0xbb,0xa3,0x0e,0xff,0xfe,0x1a,0x00,
-0x03,0x0d,0x00,0xae,0xf1,0x23,0x55,0x0e,0x30,0x3e,0x2e,0xff,0xec,0x80,0x7b,0x73,
-0x06,0x0d,0x00,0x18,0xf0,0x59,0x86,0xe1,0x21,0xbb,0xbb,0xb4,0x0e,0x30,0xa8,0x4f,
-0x66,0x65,0x10,0xe3,0x0a,0x84,0x67,0x3f,0x00,0x8f,0x95,0x11,0x00,0x59,0x86,0x70,
-0xf5,0x0e,0xff,0xf8,0x4e,0x11,0x10,0xa9,0x95,0x02,0x59,0x86,0x30,0x4f,0x44,0x58,
-0x59,0x86,0x5b,0xbd,0xcb,0x96,0x0e,0x30,0x59,0x86,0x1f,0x0b,0x59,0x86,0x17,0xf1,
-0x00,0x02,0x22,0xef,0xef,0xf6,0x0f,0x20,0xa9,0x4f,0x22,0x22,0x00,0xe4,0x09,0x94,
-0x5b,0x00,0xe1,0x9a,0x4e,0x22,0x22,0x00,0xe6,0x2a,0xa4,0xff,0xff,0xe4,0x0e,0xff,
-0xf9,0x62,0x9f,0x03,0x1a,0x00,0x20,0x99,0x4f,0xce,0x86,0x71,0x09,0x91,0xbd,0xcb,
-0x96,0x0d,0x40,0x35,0xaa,0x00,0xc5,0xd5,0x00,0xbf,0x00,0x01,0x54,0x0c,0x00,0x76,
-0x02,0x51,0x4f,0x55,0x55,0x55,0xd5,0x54,0x01,0x27,0xcf,0x50,0x23,0x17,0x26,0x1d,
-0x50,0x23,0x17,0x00,0x1b,0x7b,0xa1,0x99,0x91,0x00,0x2e,0x4f,0x88,0x88,0x70,0x00,
-0x2e,0x1a,0x09,0x0a,0x06,0x00,0xc1,0x88,0x88,0x23,0x77,0x9e,0x4f,0x99,0x98,0x15,
-0xab,0xbe,0x4e,0x95,0x0a,0x08,0x06,0x00,0xbf,0x4f,0x44,0x45,0x69,0x30,0x2f,0x1b,
-0xdd,0xcc,0xb9,0x20,0x17,0x3f,0x11,0xc6,0x06,0x01,0xaa,0xaa,0xaa,0x10,0x03,0xf0,
-0x4f,0x77,0x77,0x50,0x20,0x7a,0x00,0xe2,0x2d,0xb7,0x5f,0x05,0xff,0xff,0xfc,0x0e,
-0xff,0xf0,0x5e,0x11,0x11,0x3a,0x7a,0x00,0x59,0x79,0x6f,0x3f,0x02,0xce,0xdd,0xcb,
-0x81,0xfe,0x66,0x26,0x00,0xbc,0x6d,0x70,0xed,0xdd,0xde,0x20,0x03,0xf0,0x4f,0x5f,
-0x34,0x24,0x2f,0x05,0xa2,0x86,0xb2,0x45,0x31,0x77,0x8f,0x05,0xfd,0xdd,0xc9,0x1a,
-0xab,0xf0,0x47,0x86,0x03,0x80,0x83,0x10,0x2f,0x11,0xd1,0x0b,0x80,0x83,0x12,0x01,
-0xb7,0x0e,0x07,0x80,0x83,0x04,0x39,0x64,0x23,0x02,0xf1,0x2d,0xb8,0x07,0x80,0x83,
-0x01,0x39,0x04,0x01,0x75,0x00,0x22,0x02,0xf1,0x75,0x00,0x02,0x17,0x87,0xd4,0xf1,
-0x5e,0x22,0x22,0x11,0x98,0x9f,0x15,0xff,0xff,0xeb,0x19,0x9a,0x75,0x00,0x03,0xbc,
-0x86,0x40,0xed,0xef,0xff,0x10,0xbc,0x86,0x14,0x45,0x3a,0x79,0x15,0x04,0x31,0x87,
-0x11,0x64,0x31,0x87,0x12,0xf2,0x24,0x87,0x01,0x9c,0x8c,0x03,0x0d,0x00,0x1b,0x0f,
-0x31,0x87,0xf1,0x01,0x60,0x09,0x26,0x99,0x99,0x50,0x0e,0x30,0xe4,0xda,0x88,0x84,
-0x00,0xf3,0x0e,0x3e,0xae,0x64,0x20,0xf3,0xe5,0xdc,0x02,0x21,0x0f,0x3e,0x96,0x86,
-0xe1,0xf3,0xeb,0x99,0x80,0x78,0xf3,0x0f,0x3e,0xa8,0x86,0x19,0x9f,0x30,0xe3,0x1a,
-0x00,0x12,0x0e,0x1a,0x00,0x04,0x0d,0x00,0xb2,0x73,0x45,0x82,0x0e,0x30,0xe3,0x8e,
-0xed,0xb9,0x20,0xe3,0x7e,0x66,0x12,0x30,0x1d,0x9f,0x28,0x0e,0x40,0x8b,0x66,0x16,
-0x40,0x30,0x07,0x10,0x02,0x2a,0x03,0x30,0xb2,0x05,0xd0,0x2a,0x03,0x41,0x00,0x5e,
-0x0a,0x84,0x99,0x86,0x42,0xa9,0x4e,0x00,0x00,0xb3,0x86,0x40,0xc4,0xcd,0xe0,0xa8,
-0x21,0x89,0x13,0x4e,0x1a,0x00,0x01,0x2a,0x03,0x11,0x4e,0x2a,0x03,0x1c,0x04,0xb3,
-0x86,0x0f,0x83,0x89,0x17,0x01,0xb3,0x86,0x10,0x44,0x94,0x3b,0x82,0x3f,0xdd,0xdc,
-0x20,0x3f,0x03,0xf0,0x4f,0x97,0x86,0x10,0x4e,0x1e,0x05,0x41,0x03,0xf0,0x4f,0xee,
-0xb3,0x86,0x52,0x4f,0x33,0x20,0x02,0x5f,0x15,0x00,0x01,0x1c,0x00,0x20,0x01,0x30,
-0x31,0x00,0x30,0xee,0xff,0xc0,0xb3,0x86,0x19,0x32,0xb3,0x86,0x22,0x0a,0x30,0xb3,
-0x86,0x1e,0x60,0x32,0x6d,0x0e,0xb3,0x86,0xf4,0x00,0x02,0x04,0x22,0xee,0xee,0xe3,
-0x05,0xd0,0xb8,0x4f,0x33,0x32,0x00,0x4e,0x0b,0xd9,0x00,0xc1,0x22,0x32,0x27,0x9e,
-0x0a,0x84,0xff,0xfe,0xa3,0xbc,0xf0,0xa8,0x74,0x00,0x00,0xf3,0x00,0x40,0x13,0x03,
-0xf0,0xa8,0x73,0x00,0x94,0x3f,0x0a,0x80,0x23,0x21,0x00,0x02,0xb0,0xa7,0x8e,0x05,
-0x12,0x4f,0x29,0x0c,0x10,0x11,0x41,0x06,0x00,0x59,0x85,0x22,0x33,0xe5,0x77,0x67,
-0x05,0xc2,0x98,0x17,0xf2,0xc2,0x98,0x00,0x75,0x00,0x50,0x06,0x42,0xee,0xef,0xf3,
-0x75,0x00,0x28,0x22,0x22,0x68,0x01,0x1f,0x10,0x68,0x01,0x05,0x93,0x34,0x57,0x80,
-0x4e,0x0a,0x81,0xcd,0xdc,0xa7,0x68,0x01,0x31,0x17,0x05,0x30,0x8c,0x3f,0x14,0x20,
-0x84,0xac,0x1f,0x5f,0x42,0x44,0x0c,0x03,0xb2,0x83,0x6d,0x02,0xfc,0xcd,0xdc,0xcb,
-0x50,0xbb,0x7b,0x12,0x3f,0xc0,0x00,0x22,0x02,0xf3,0x01,0x97,0x05,0x8c,0x62,0x41,
-0x22,0x22,0x34,0x30,0x02,0x1d,0x2f,0xfe,0xec,0xf9,0x66,0x08,0x00,0xd2,0x19,0x15,
-0x0a,0xd2,0x19,0x03,0x01,0x1f,0x12,0xcf,0x2a,0xae,0x04,0x9e,0x09,0x43,0xe7,0x22,
-0x22,0x23,0x04,0x63,0x17,0xe5,0x26,0x82,0x12,0x71,0x24,0x53,0x13,0xaf,0x64,0xa1,
-0x09,0x2c,0x93,0x0c,0xb8,0x85,0x2a,0x09,0x10,0xb7,0x37,0x0b,0x43,0x86,0x0a,0xc6,
-0x37,0x04,0x27,0x66,0x12,0xef,0x9d,0x3c,0x04,0x2d,0x00,0x40,0xfc,0xcc,0xcc,0xcc,
-0x0f,0x00,0x33,0x86,0x66,0x55,0xcf,0x62,0x02,0x07,0x2b,0x00,0xe7,0x55,0x00,0xd7,
-0x6d,0x25,0xf2,0x21,0xb5,0x0a,0x10,0x06,0x31,0xa9,0x32,0xee,0xee,0xe1,0xeb,0x65,
-0x15,0x32,0x4f,0x7b,0x00,0x4b,0xc3,0x01,0x85,0x71,0x42,0x40,0x00,0x4e,0x80,0x1e,
-0x17,0x12,0x6d,0xd3,0x30,0x20,0x07,0xd0,0x9d,0xd1,0x21,0x32,0x37,0xb1,0xce,0x14,
-0xbd,0x85,0x6d,0x05,0x65,0x94,0x12,0x40,0x65,0x94,0x17,0x10,0xc3,0x00,0x12,0xed,
-0x75,0x54,0x12,0xf7,0xb1,0x97,0x05,0x74,0x94,0x02,0x77,0x01,0x00,0x4c,0x68,0x1b,
-0xda,0xc0,0x84,0x14,0x12,0x3c,0x3a,0x0f,0xc0,0x84,0x1b,0x03,0xfe,0x01,0x23,0x01,
-0xfd,0xfe,0x01,0x0b,0x2b,0x33,0x02,0x72,0x66,0x23,0x02,0xf4,0x99,0x64,0x15,0x10,
-0xf2,0x96,0x22,0x46,0x80,0xfe,0x01,0x2f,0xdb,0x10,0xe5,0x4b,0x07,0x00,0x88,0x08,
-0x15,0x11,0xe5,0x4b,0x07,0xce,0x94,0x16,0x50,0xce,0x94,0x51,0xd9,0x55,0x55,0x55,
-0x10,0x15,0x84,0x26,0xcc,0xb4,0xdd,0x94,0x21,0x0c,0xfe,0xf7,0x83,0x01,0x5a,0x21,
-0x1e,0x00,0x20,0xb1,0x05,0x62,0x67,0x02,0xb9,0x20,0x32,0xcc,0xcc,0xdd,0x08,0x82,
-0x3f,0x54,0x46,0xf1,0xf2,0x33,0x09,0x28,0x00,0x50,0x86,0x21,0x01,0xf0,0x29,0x04,
-0xbf,0x94,0x12,0xf7,0x85,0x02,0x20,0x0f,0xff,0xa7,0x46,0x09,0x62,0x97,0x13,0x31,
-0x62,0x97,0x06,0x5c,0x76,0x03,0x15,0x22,0x12,0x6e,0xe2,0x0c,0x15,0x10,0x7e,0x34,
-0x1a,0x20,0x19,0x95,0x0e,0xd5,0x75,0x07,0xbb,0x83,0x08,0x55,0x95,0x23,0x40,0x00,
-0x91,0x04,0x00,0x9e,0x7f,0x32,0xdd,0xde,0x50,0xa7,0x87,0x13,0x30,0x1b,0x03,0x00,
-0xe0,0x22,0x18,0xef,0xd6,0x99,0x21,0x6d,0xdd,0x55,0x36,0x1b,0x20,0x18,0x65,0x01,
-0x00,0x0d,0x12,0xd0,0x00,0x0d,0x12,0x5f,0xa5,0x0d,0x04,0x0d,0x22,0x17,0xeb,0x47,
-0xb8,0x0c,0x4b,0x3a,0x05,0x19,0x08,0x4f,0x3f,0x89,0x98,0x81,0x19,0x08,0x02,0xce,
-0x77,0x77,0x71,0x00,0x2e,0x4f,0xbb,0xba,0x92,0x00,0x2e,0x4e,0x19,0x08,0x60,0x10,
-0x11,0x35,0x20,0x2f,0x2e,0x8a,0x91,0x0f,0x19,0x08,0x11,0x20,0x18,0x2e,0xf4,0x91,
-0x11,0x3f,0x2e,0x07,0x04,0x1c,0x83,0x00,0x63,0x79,0x20,0x3f,0x5f,0x4d,0x42,0x06,
-0x8e,0x83,0xd3,0x02,0x00,0x3f,0x4f,0xed,0xee,0xff,0x50,0x3f,0x02,0x33,0x34,0x53,
-0xc0,0x02,0x13,0x18,0x8f,0x1d,0x1e,0x3f,0x34,0x83,0x0b,0x06,0x00,0x13,0x3a,0x5a,
-0x07,0x00,0xbd,0x20,0x10,0x45,0xb1,0x08,0x61,0x4d,0xed,0xdd,0xdc,0x60,0x2f,0x69,
-0x0b,0x02,0x62,0x8e,0x00,0xcc,0x94,0x04,0x08,0x00,0x14,0x1f,0x08,0x00,0x22,0x42,
-0x20,0x08,0x00,0x21,0xff,0xe4,0x25,0x0a,0x01,0x18,0x00,0x05,0x08,0x00,0x11,0xe0,
-0x5b,0xb4,0x61,0xd4,0x14,0xe2,0x20,0x1f,0x10,0xcb,0xa0,0x1f,0xd1,0x5e,0x92,0x05,
-0x05,0x59,0xc0,0x1a,0x20,0xf2,0x92,0x11,0x15,0x20,0x5f,0x31,0xee,0x60,0x5e,0x98,
-0x00,0x11,0x33,0xac,0x00,0x31,0xc1,0x01,0xd0,0x08,0x00,0xb1,0xf2,0x02,0xf0,0x00,
-0x4e,0x33,0x20,0x00,0xf1,0x02,0xf0,0xcd,0xc0,0x10,0xf1,0x32,0x43,0x00,0x18,0x00,
-0x42,0x03,0xe1,0x10,0x4e,0x45,0x06,0x22,0xc0,0x4e,0x80,0x73,0x08,0xe7,0x7e,0x01,
-0x0e,0x2d,0x13,0x2b,0xf2,0x04,0x09,0x83,0x61,0x10,0x64,0xfc,0x8e,0x07,0x18,0x00,
-0x11,0x31,0xff,0x8e,0x08,0x83,0x61,0xf0,0x06,0x03,0x00,0x61,0x16,0x66,0x66,0x64,
-0x0e,0x30,0xd4,0x3b,0xcb,0xbb,0xb8,0x0f,0x30,0xd4,0x00,0x30,0x02,0x10,0x07,0x00,
-0x30,0xc5,0x0b,0x60,0x07,0x00,0x25,0xd5,0x0c,0x07,0x00,0x20,0x63,0xe4,0x07,0x00,
-0x31,0x0e,0xdd,0xf4,0x07,0x00,0x00,0x23,0x00,0x26,0x0c,0x50,0x07,0x00,0xc2,0x04,
-0xd8,0x4e,0x86,0x0e,0x30,0xd4,0x3c,0xcc,0xcc,0xb9,0x1e,0xfc,0x1a,0x14,0x0e,0x07,
-0x00,0x1e,0xd5,0x07,0x00,0x04,0xa4,0x20,0x30,0x03,0x10,0xde,0x00,0x48,0x20,0xd6,
-0x02,0x41,0x05,0x50,0x0c,0x60,0x0b,0x30,0x0f,0xb6,0x0a,0xf3,0x0f,0xd4,0x01,0xf0,
-0x4d,0xdf,0x60,0x0d,0x40,0x1f,0x00,0x44,0xd6,0x00,0xd4,0x02,0xf0,0x00,0x0c,0x60,
-0x0d,0x51,0x3f,0x33,0x00,0xd5,0x0e,0xff,0xff,0xee,0xc0,0x32,0x06,0x11,0x51,0x61,
-0x0c,0x21,0x31,0x00,0x4d,0xab,0x14,0xf3,0x35,0x08,0x02,0x25,0x34,0x12,0x08,0x93,
-0x03,0x12,0x8b,0x92,0x03,0x11,0xc2,0xf2,0x36,0x1c,0x5f,0x99,0x9b,0x30,0x04,0x10,
-0xcd,0x6b,0x4d,0xb3,0xc6,0x03,0x44,0x44,0x53,0x10,0x0c,0x60,0x0c,0x40,0x1f,0x7c,
-0x00,0x20,0x02,0x2d,0x7c,0x00,0x30,0x05,0xff,0xf6,0x0d,0x00,0x00,0x7c,0x00,0x00,
-0xd5,0x02,0xe4,0xc6,0x0c,0xfd,0xdd,0xfe,0xe0,0x0c,0x50,0x34,0x43,0x33,0x20,0x00,
-0xc5,0x57,0x28,0x02,0x13,0xa6,0x21,0x07,0xd5,0xa5,0x4b,0x02,0x08,0xa6,0x01,0xed,
-0x24,0x10,0x40,0x7b,0x26,0x00,0x6e,0x4c,0x56,0xfc,0xbb,0xcc,0xcf,0x30,0x16,0xa6,
-0xf0,0x08,0x01,0x50,0x83,0x07,0x77,0x77,0x87,0x04,0xd0,0xd5,0x1a,0xbb,0xba,0xa8,
-0x04,0xd0,0xd4,0x00,0x30,0x03,0x10,0x04,0xd0,0x45,0x01,0x10,0x60,0x07,0x00,0x14,
-0xd5,0x07,0x00,0x30,0x50,0x47,0xe0,0x07,0x00,0x31,0x53,0xcd,0xe0,0x0e,0x00,0x62,
-0x04,0xe0,0xd4,0x00,0xc5,0x0d,0x07,0x00,0x00,0xb9,0x75,0xb1,0xd4,0x05,0xd9,0x6e,
-0x97,0x04,0xd0,0xd4,0x0a,0xbb,0xaa,0x46,0x00,0x01,0x98,0x7d,0x17,0xd5,0x07,0x00,
-0x22,0x05,0xc0,0x0e,0x00,0x28,0xa0,0xc5,0xd5,0xc9,0xf0,0x05,0x20,0x42,0x0a,0xbb,
-0xbc,0xcb,0x04,0xd0,0xb8,0x05,0x66,0x66,0x54,0x04,0xe0,0xb8,0x00,0xd2,0x0d,0x30,
-0x31,0x08,0x41,0xf3,0x0e,0x42,0x58,0x07,0x00,0x21,0x35,0xcd,0x07,0x00,0x01,0x15,
-0x00,0xf4,0x05,0xe3,0x0e,0x20,0x04,0xf0,0xa8,0x0a,0xfb,0xaf,0xcc,0x04,0xf0,0xa8,
-0x06,0x66,0x65,0x42,0x03,0xe0,0xb7,0x13,0x22,0x00,0x1d,0x10,0x40,0x56,0x50,0x00,
-0x01,0xb9,0x8c,0x03,0xdb,0x04,0x0f,0x07,0x00,0x09,0x12,0xb2,0x03,0x03,0xf0,0x05,
-0x12,0xbb,0xbb,0xbc,0xc4,0x00,0xe5,0x16,0x66,0x66,0x55,0x10,0x0d,0x50,0x0a,0x30,
-0x1d,0x05,0xbb,0xf5,0xe0,0x01,0x31,0x26,0x6e,0x50,0x64,0x01,0x10,0xd5,0x0d,0x00,
-0x11,0x36,0x0d,0x00,0xe3,0x05,0xaa,0xf4,0x03,0xd6,0x36,0xf5,0x50,0x0d,0x44,0xdd,
-0xdc,0xcb,0xb9,0xf6,0x14,0x15,0x0e,0x33,0x2f,0x00,0xfd,0x4d,0x05,0xb3,0x54,0x0f,
-0xf5,0x5f,0x0b,0xf0,0x05,0x10,0xab,0xbb,0xbb,0xca,0x00,0xe4,0x05,0x66,0x66,0x65,
-0x20,0x0e,0x40,0x0c,0x40,0x0d,0x07,0xff,0xf4,0xd9,0x01,0x40,0x13,0x3e,0x40,0x0d,
-0xf3,0x01,0x10,0xe4,0x0d,0x00,0xf1,0x01,0x6b,0xbf,0x40,0x0c,0x40,0x2f,0x02,0x44,
-0xf4,0x5e,0xff,0xef,0xff,0xe0,0x0e,0x40,0xfa,0x3c,0x15,0xe4,0xea,0x43,0x30,0x4a,
-0xdc,0xa5,0xcc,0x06,0x30,0x74,0x47,0xea,0xb3,0x21,0x00,0xd0,0x41,0x11,0x03,0x3e,
-0xa3,0x00,0x34,0xde,0x00,0x1c,0x5b,0x21,0xae,0x52,0x80,0x5f,0x33,0x7d,0xee,0xc7,
-0x47,0x6b,0x01,0x9d,0x07,0x02,0xc0,0x22,0x10,0x53,0x95,0x56,0x01,0xee,0x0e,0x12,
-0xe3,0xa4,0x21,0x11,0x0e,0x87,0x28,0x03,0x71,0xbe,0x12,0xc7,0xf0,0x16,0x11,0xff,
-0x5a,0x6f,0x00,0xae,0x05,0x2f,0x11,0x11,0x2e,0x7e,0x16,0x11,0x11,0xf7,0xac,0x21,
-0x07,0xff,0xa7,0x12,0x00,0x70,0x58,0x13,0x0a,0xca,0x45,0x12,0xf1,0xd9,0x45,0x23,
-0x1f,0x32,0x10,0xa5,0x15,0xe3,0xf0,0x07,0x28,0x11,0x00,0x95,0x45,0x1f,0x20,0x95,
-0x45,0x2a,0x12,0xef,0x3d,0x06,0x03,0xf0,0x00,0x23,0x09,0xff,0x4a,0x28,0x11,0x53,
-0x32,0x01,0x00,0x66,0x14,0x12,0xd4,0xe0,0x42,0x2d,0x0d,0x40,0x0f,0x00,0x01,0xf0,
-0x00,0x12,0xf9,0xf0,0x00,0x01,0x13,0xcf,0x32,0x40,0x00,0x72,0xc1,0x13,0x22,0x0e,
-0x50,0xd0,0x13,0x10,0xe5,0x60,0xad,0x63,0xca,0x44,0x4e,0x74,0x44,0x07,0x16,0x8a,
-0x05,0xa2,0x5c,0x02,0x6f,0x29,0x00,0x4d,0x6d,0x22,0x13,0x10,0x8b,0x57,0x12,0xf0,
-0x6b,0x02,0x22,0x1f,0x10,0x71,0x07,0x10,0xf1,0xe9,0x00,0x42,0xe5,0x11,0x2f,0x32,
-0x85,0x8b,0x02,0xfa,0xae,0x0e,0x7b,0x5b,0x1f,0xee,0x86,0x42,0x23,0x03,0xf0,0x00,
-0x12,0x0d,0xdc,0x1c,0x00,0xbf,0x39,0x12,0x09,0xe9,0x07,0x29,0x01,0xf1,0x87,0x00,
-0x08,0x0f,0x00,0x61,0x0c,0xdf,0xdd,0xdd,0xfe,0xe5,0xa2,0x78,0x08,0x97,0xb9,0x0b,
-0xeb,0xb3,0x01,0x28,0xa1,0x20,0xff,0x21,0xb5,0x3c,0x00,0xb5,0x13,0x0f,0xe0,0x01,
-0x06,0x02,0x5a,0x00,0x16,0xc7,0xe0,0x01,0x08,0xf9,0x9d,0x26,0x00,0x00,0xe0,0x01,
-0x09,0x2a,0x2a,0x0f,0x94,0xad,0x0f,0x08,0xfa,0x3d,0x0a,0x1d,0x08,0xf1,0x03,0x0a,
-0x12,0x99,0x99,0x99,0xa7,0x00,0xf3,0x29,0xa9,0x99,0x98,0x60,0x0e,0x30,0x03,0x00,
-0x05,0x38,0x03,0x10,0x00,0x92,0x83,0x41,0x0d,0x40,0x0f,0x30,0x0d,0x00,0x1e,0xf3,
-0x0d,0x00,0x01,0x32,0x7b,0x11,0xd4,0x40,0x7b,0xbf,0x2d,0x62,0x2f,0x54,0x10,0xe4,
-0x4e,0xee,0xee,0xdd,0xc3,0x57,0x59,0x07,0x28,0x0d,0x40,0x57,0x59,0xf1,0x02,0x11,
-0xbb,0xbb,0xbb,0xc6,0x00,0xe4,0x06,0x66,0x66,0x65,0x10,0x0e,0x40,0x0a,0x30,0x1d,
-0x75,0x00,0x21,0x02,0xf0,0x5b,0x00,0x1c,0x2f,0x0d,0x00,0x61,0x03,0xd6,0x35,0xf4,
-0x50,0x0e,0x2f,0x04,0x15,0x10,0xa5,0x59,0x02,0x2d,0x29,0x12,0x02,0x2d,0x29,0x0f,
-0x2f,0x04,0x11,0x0f,0x91,0x06,0x06,0x01,0x08,0x06,0x02,0x22,0x06,0x04,0x91,0x06,
-0x12,0x23,0x91,0x06,0x13,0xc2,0x91,0x06,0x1f,0x82,0x91,0x06,0x2d,0x21,0x08,0x30,
-0x91,0x06,0x11,0xd6,0x91,0x06,0x12,0x0d,0x91,0x06,0x11,0xd6,0x7c,0x00,0x38,0x0d,
-0x60,0x0d,0x0d,0x00,0xd1,0x0c,0x40,0x2f,0x01,0x00,0xd5,0x4e,0xff,0xef,0xff,0xf2,
-0x0d,0x50,0x43,0x03,0x15,0xd5,0xf9,0x25,0x02,0xd4,0xc7,0x42,0x7f,0x74,0x46,0xdb,
-0x99,0xc3,0x32,0xf4,0x00,0x03,0x7a,0x13,0x12,0x2f,0xa4,0x3f,0x21,0xae,0x52,0x6b,
-0x58,0x10,0x7d,0x75,0x9e,0x13,0x11,0xbb,0x5b,0x53,0xaf,0xfe,0xd1,0x00,0x4e,0xe6,
-0x3d,0x12,0x4e,0xef,0x27,0x20,0x30,0x4e,0x08,0x18,0x42,0xcc,0xcc,0xc0,0x4f,0x13,
-0x62,0x01,0x30,0x02,0x31,0x2d,0xef,0xa0,0x08,0x00,0x60,0xe7,0x00,0xc8,0x00,0x3f,
-0x22,0x51,0x47,0x10,0x4e,0xfe,0x1c,0x40,0x07,0xa0,0x00,0x1f,0x50,0x01,0x04,0x08,
-0x00,0x10,0x05,0xce,0x08,0x10,0x3f,0x9a,0x45,0x21,0x13,0xe6,0x08,0x00,0x3f,0x1b,
-0xfe,0x70,0x12,0x9c,0x16,0x00,0xff,0x03,0x21,0xec,0xb6,0xb4,0xb2,0x51,0x02,0x44,
-0x20,0x00,0xb7,0x77,0xa2,0x31,0x31,0x0b,0x80,0x8e,0x00,0x70,0x50,0xb8,0x00,0x00,
-0x01,0x68,0x50,0x21,0x04,0xf0,0x06,0x02,0xe8,0x5a,0xc0,0x00,0xa9,0x22,0x10,0xa8,
-0x00,0x0d,0x40,0x0a,0xff,0xfd,0x0b,0x60,0x00,0xb6,0x00,0xa8,0x62,0x01,0x20,0x1f,
-0x30,0x2f,0x34,0x31,0xbe,0xdf,0x80,0xf0,0x18,0x5a,0x12,0x00,0x00,0x09,0x60,0xf0,
-0xc0,0x11,0x30,0x4c,0x17,0x23,0x21,0xe6,0x3c,0x09,0x1e,0x60,0x8a,0xaf,0x01,0x0f,
-0x3c,0x51,0x00,0x00,0x67,0x55,0x30,0xf4,0x26,0x52,0x48,0xaa,0x70,0x00,0x5e,0x35,
-0x00,0x22,0x00,0x4e,0x5d,0x17,0x11,0x60,0x7f,0xb4,0x12,0x31,0x1b,0x04,0x31,0xad,
-0xad,0x70,0xaf,0x26,0x90,0xc0,0x01,0xe2,0x00,0x4f,0x66,0x50,0x0a,0x80,0x63,0x3b,
-0x60,0xcc,0xb0,0x09,0x90,0x00,0xc5,0x2f,0x01,0x32,0x04,0xe2,0x04,0x6c,0x27,0x32,
-0x7f,0xfe,0x40,0x67,0x01,0x02,0x51,0x45,0x01,0xc9,0x7c,0x13,0x4e,0x40,0x25,0x17,
-0x2a,0x8b,0x00,0x04,0x08,0x00,0x50,0x0c,0xec,0xcc,0xcc,0xcc,0x58,0x91,0x47,0x55,
-0x55,0x55,0x54,0x02,0x30,0x53,0xaf,0xfe,0x90,0x00,0x17,0x4e,0x0b,0x11,0x5e,0x90,
-0x00,0x33,0xed,0x60,0x5e,0xc7,0x70,0x10,0x4e,0xa8,0x06,0x21,0xfd,0x40,0xfc,0xca,
-0x21,0xe4,0x16,0xa4,0xcb,0x20,0x0b,0x70,0x88,0x00,0x61,0x33,0x10,0x0b,0x60,0x00,
-0xc5,0xa8,0x00,0x51,0xd1,0x04,0xf2,0x00,0x3e,0x28,0x00,0x15,0x50,0x6c,0x55,0x01,
-0x1d,0x58,0x02,0x37,0xa6,0x00,0x3c,0x0c,0x23,0x22,0x6e,0x36,0x71,0x22,0x6e,0x00,
-0xe6,0x1c,0x17,0xfb,0xb1,0x3a,0x40,0x5f,0x32,0x33,0x34,0xfb,0x45,0x10,0x2c,0x85,
-0x39,0x17,0x30,0x33,0x21,0x21,0xcb,0x80,0xb5,0x3a,0x00,0xb8,0x01,0x11,0x5e,0x47,
-0x02,0x32,0x43,0x10,0x5e,0x47,0x02,0x01,0x4d,0x29,0x31,0x18,0xa7,0x10,0x49,0x9d,
-0x30,0xe6,0x27,0xd0,0x98,0x00,0x70,0x09,0x90,0x00,0xb5,0x00,0x4f,0x33,0xde,0x7d,
-0x30,0xa6,0x00,0x4e,0xf0,0x2d,0x22,0x01,0xe4,0x3c,0x95,0x22,0xde,0x80,0x0a,0x6c,
-0x00,0xf9,0x4e,0x07,0xea,0x95,0x14,0x0f,0x41,0x9d,0x12,0x41,0xc7,0x0a,0x05,0x49,
-0x9d,0x04,0x62,0x6c,0x03,0x41,0x9d,0x17,0x03,0x41,0x9d,0x04,0x98,0x00,0x1b,0x2a,
-0x98,0x00,0x2e,0x4e,0x00,0x98,0x00,0x72,0xe5,0x16,0xd0,0x00,0x4f,0xdd,0xc0,0x98,
-0x00,0x2f,0x55,0x40,0x98,0x00,0x02,0x18,0x3e,0x98,0x00,0x03,0xad,0x1f,0x00,0xd1,
-0x07,0x01,0x61,0xac,0x43,0x63,0x33,0x33,0x5f,0x3f,0x0e,0x13,0xef,0x77,0x0b,0x22,
-0x2f,0x00,0x33,0x84,0x10,0x4f,0x46,0x05,0x47,0xdd,0xee,0xdd,0xd9,0x98,0x00,0x53,
-0xbe,0xcb,0x70,0x00,0x29,0x98,0x00,0x20,0x4e,0x00,0xfa,0xd0,0x24,0x33,0x00,0x98,
-0x00,0x10,0x4f,0x23,0x2f,0x21,0xda,0x20,0x40,0x02,0x30,0xe5,0x37,0xe0,0x30,0x01,
-0x40,0x0a,0x70,0x00,0xd4,0x30,0x01,0x11,0x0a,0xd0,0x01,0x01,0xb8,0xc1,0x02,0x1e,
-0x3d,0x32,0x9f,0xef,0x60,0x58,0x02,0x14,0x20,0xbd,0x3a,0x12,0x23,0x89,0xd0,0x40,
-0x8f,0xed,0xef,0xa1,0x2f,0x1a,0x47,0xd2,0x00,0x01,0xbb,0x02,0x6d,0x02,0xe8,0x86,
-0x01,0x5e,0x41,0x31,0x37,0xe9,0x00,0xfa,0x22,0x21,0xca,0x50,0xe6,0x03,0x00,0xa2,
-0x80,0x41,0x00,0xbf,0xfe,0x60,0xb4,0xac,0x10,0x11,0xbb,0xac,0xb0,0x39,0x99,0x99,
-0x87,0x0f,0x20,0x3e,0x37,0x77,0x77,0x77,0x15,0x00,0xf0,0x1e,0x04,0x63,0x00,0x0e,
-0x20,0x3e,0x00,0x9d,0xae,0x70,0x0e,0x20,0x3e,0x03,0xf1,0x04,0xf0,0x0e,0x42,0x5e,
-0x07,0xb0,0x00,0xe3,0x0e,0xff,0xfe,0x08,0x90,0x00,0xc4,0x0e,0x20,0x3e,0x07,0xa0,
-0x00,0xd3,0x0e,0x20,0x3e,0x04,0xe0,0x02,0xf1,0x2a,0x00,0x30,0xcc,0x7d,0x90,0x07,
-0x00,0x42,0x07,0x85,0x00,0x0e,0xc4,0xa0,0x04,0x07,0x00,0x13,0x30,0x0e,0x00,0x14,
-0x3f,0xb0,0x1d,0xf0,0x1a,0x28,0x54,0x20,0x02,0x00,0x12,0x00,0x17,0xab,0x70,0x0c,
-0x60,0x8a,0x03,0x44,0x44,0x43,0x0c,0x70,0x8a,0x0b,0xcc,0xcc,0xcc,0x4c,0x70,0x7b,
-0x00,0x05,0x97,0x10,0x0c,0x70,0x7b,0x00,0xaa,0x58,0xe1,0x0c,0xff,0xfa,0xed,0x3e,
-0xf0,0x02,0x0c,0x71,0x7a,0x03,0xe0,0x00,0x97,0x0c,0x70,0x7a,0x00,0xe5,0x02,0xe3,
-0x0c,0x60,0x7a,0x82,0x55,0x33,0x0b,0x50,0x7a,0x88,0x30,0x0f,0xdc,0xcc,0x23,0x01,
-0x7b,0x04,0x11,0xb7,0x4a,0x59,0x02,0x93,0x01,0xf1,0x08,0x05,0x88,0x88,0x88,0x73,
-0x04,0xe1,0x10,0x59,0x99,0x99,0x99,0x40,0x4f,0xff,0xd0,0x05,0xbd,0xa2,0x00,0x04,
-0xe1,0x10,0x91,0x01,0x10,0x4e,0xe5,0x4b,0x20,0x0d,0x40,0xbe,0xc8,0x00,0x90,0x01,
-0xa5,0x3f,0xff,0xc0,0x6c,0x00,0x3f,0x20,0x03,0xe1,0x10,0x8f,0x01,0x01,0xf5,0x47,
-0x06,0x8e,0x01,0x56,0x08,0xfe,0xde,0xfa,0x10,0x8d,0x01,0x12,0xe6,0x8a,0x06,0x03,
-0x8c,0x01,0x00,0x17,0x31,0x26,0x7e,0x90,0x8b,0x01,0x10,0x16,0xd7,0x9c,0x53,0x90,
-0x02,0xad,0xee,0x80,0xa2,0x03,0xf0,0x03,0x02,0xe1,0xbb,0xbb,0xbb,0xbb,0x60,0x2e,
-0x05,0x55,0x55,0x55,0x52,0x02,0xe0,0x00,0x17,0x96,0x53,0x0f,0xf0,0x0a,0x1d,0xa7,
-0xcb,0x00,0x02,0xe0,0x08,0xb0,0x00,0xe3,0x00,0x2e,0x00,0xd4,0x00,0x09,0x89,0xdd,
-0xe0,0x0f,0x20,0x00,0x89,0x35,0x7e,0x24,0xd7,0x40,0x90,0x02,0xe0,0x0b,0xd5,0x29,
-0x50,0x2e,0x00,0x3f,0x74,0xbd,0x04,0x07,0x34,0x3a,0xc8,0x10,0xc9,0x71,0x17,0xe0,
-0x94,0x0f,0x2a,0x02,0xe0,0xcf,0x32,0x51,0xfc,0xbb,0x10,0x00,0x74,0x6c,0x35,0xf0,
-0x03,0x0b,0x70,0x34,0x44,0x43,0x32,0x00,0xb7,0x1c,0xcc,0xcc,0xcc,0xb0,0x0b,0x70,
-0x00,0x59,0x82,0xc1,0x09,0xc0,0x8d,0x78,0xf3,0x00,0x0b,0x70,0x1f,0x20,0x07,0xa3,
-0xfe,0xf7,0x02,0x25,0x41,0x02,0x3c,0x70,0x1f,0x7c,0x40,0xa4,0x00,0xb9,0x23,0xd6,
-0x00,0x0b,0x60,0x01,0x9e,0xd7,0x8c,0x1c,0x10,0x01,0xc5,0xc8,0x00,0x17,0x0a,0x58,
-0x05,0xf3,0x33,0x22,0x2e,0x3a,0x30,0x00,0xb2,0x5f,0x20,0xcc,0xcc,0x04,0x6e,0x00,
-0xef,0xc0,0x06,0xe0,0x2d,0x20,0xdb,0xb3,0x80,0x01,0x00,0x4a,0x32,0x20,0x04,0xf0,
-0x05,0x02,0x70,0x20,0x04,0xf0,0x2c,0xcc,0xcc,0xcc,0xc1,0x5a,0x31,0x19,0xcc,0x80,
-0x57,0x60,0x50,0x33,0xc9,0x00,0x04,0xe0,0x80,0x74,0x30,0x0e,0xff,0xe0,0xc1,0x0f,
-0x20,0x01,0x26,0x07,0x49,0x10,0x9c,0x24,0x17,0x31,0x3d,0xef,0xd2,0x5b,0x1a,0x19,
-0x11,0x39,0x58,0x51,0x08,0xfd,0xcd,0xfb,0x10,0x60,0xa6,0x21,0x1b,0xb0,0x2f,0x4c,
-0x21,0x02,0xf0,0xb9,0x47,0x01,0xe5,0x38,0x30,0x82,0x12,0x6e,0x0e,0x64,0x14,0xbe,
-0x0b,0x6e,0x00,0x3f,0x10,0x60,0xbb,0x40,0x00,0x50,0x43,0x00,0xea,0x2f,0xf0,0x03,
-0xe0,0xb7,0x0d,0xee,0xee,0xed,0x23,0xe0,0xb7,0x01,0x22,0x32,0x22,0x03,0xe0,0xa7,
-0x00,0x4e,0x03,0x26,0xf0,0x04,0xa7,0x01,0xe3,0x03,0xf4,0xcd,0xe0,0xa7,0x04,0xc0,
-0x00,0xc7,0x46,0xe0,0xa8,0x03,0xd0,0x00,0xd5,0x1c,0x0d,0x30,0xe7,0x37,0xf1,0x07,
-0x00,0x34,0x2a,0xdb,0x30,0x2a,0x0d,0x22,0x30,0x32,0xbb,0x14,0x12,0xd2,0xea,0x62,
-0x01,0xc8,0x69,0x01,0x07,0x00,0x12,0xbf,0xb6,0x09,0x12,0xc9,0x71,0x00,0x12,0xcb,
-0xc8,0x69,0x11,0x7f,0xfe,0x15,0x30,0x16,0x42,0x20,0xa5,0x90,0x61,0x2a,0xcd,0xc1,
-0x00,0x05,0xe0,0x3e,0x16,0x30,0x05,0xe0,0x0e,0x03,0x0a,0x01,0x4a,0x8f,0x01,0xb2,
-0x1d,0x50,0x1b,0xff,0xb1,0x0f,0xff,0x65,0x4a,0xb0,0xca,0x01,0x16,0xe0,0x00,0xf1,
-0x00,0x4f,0x00,0x05,0xd0,0x0a,0x01,0x20,0x00,0x05,0x9d,0x84,0xf1,0x00,0x5e,0x1f,
-0xff,0xd0,0x00,0x9b,0x34,0xd7,0x02,0x37,0xd0,0x00,0x08,0xdc,0x70,0x4e,0x48,0x11,
-0x10,0x29,0x29,0x01,0x51,0x69,0x14,0x70,0x56,0x64,0x13,0x02,0x51,0x69,0x87,0xfd,
-0xbb,0xbb,0xcd,0xd3,0x00,0x00,0x46,0xce,0xb5,0x62,0x03,0xfd,0xbb,0x30,0x00,0x29,
-0x87,0x01,0xb0,0xe0,0x89,0x99,0x99,0x97,0x00,0x4e,0x08,0x88,0x88,0x89,0x5c,0x4a,
-0xc1,0x38,0x72,0x00,0xcc,0xde,0x00,0x7e,0x88,0xe5,0x04,0x58,0xe0,0x95,0x82,0x10,
-0x4e,0x2d,0x11,0x30,0x01,0x15,0xe0,0x73,0xa6,0x20,0xff,0xfe,0x79,0x00,0x62,0x00,
-0x15,0xe0,0x00,0x8c,0xc7,0xd5,0x53,0x20,0x01,0x21,0xcf,0x01,0x11,0x7e,0x12,0x15,
-0x11,0x9e,0x11,0x15,0x00,0x6c,0x13,0x13,0x5d,0x93,0x82,0x00,0x1b,0xa7,0x10,0x49,
-0x66,0xcd,0x30,0xac,0xdb,0x93,0x15,0x93,0x02,0x5e,0xad,0x42,0x03,0xac,0xdd,0xa0,
-0x69,0x0b,0x14,0x10,0x16,0x79,0x17,0xf6,0xa5,0x1d,0x40,0xcf,0xfe,0x91,0x00,0xde,
-0x06,0x32,0x00,0x1a,0xc0,0x75,0x4f,0x11,0x1f,0x16,0xcd,0x01,0xe7,0x13,0x00,0x0b,
-0x47,0x21,0xd9,0x00,0x84,0x46,0x17,0xb5,0xdf,0x14,0x03,0xc3,0x0b,0x57,0x22,0x22,
-0x25,0xe1,0x11,0xdb,0x29,0x1b,0x00,0x72,0x25,0x00,0xd8,0x43,0x05,0xc4,0x2a,0x13,
-0x07,0xc1,0x0d,0x50,0x03,0x22,0x34,0x32,0x32,0x71,0x00,0x41,0xee,0xdf,0xa1,0x00,
-0x3c,0xc2,0x22,0x1b,0xa0,0xb9,0x1e,0x01,0x7d,0x2b,0x41,0xe9,0x43,0x5d,0x80,0xb8,
-0x68,0x21,0xfa,0x50,0xe5,0x01,0x10,0x7d,0xcf,0x64,0x20,0xde,0xee,0x07,0x20,0x11,
-0xd1,0xea,0x17,0x22,0x54,0x00,0xeb,0x17,0x06,0x22,0x74,0x22,0x03,0xef,0xd2,0x0b,
-0x12,0x5f,0xfe,0x0c,0x01,0x53,0x78,0x12,0x40,0x53,0x78,0x2f,0xed,0x40,0x8f,0x00,
-0x0d,0x10,0x02,0x0c,0x36,0x00,0x8f,0x00,0x00,0xd4,0x33,0x0e,0x8f,0x00,0x41,0xe8,
-0x32,0x4d,0x80,0xea,0xec,0x25,0xfb,0x60,0x60,0x1f,0x63,0x07,0xff,0xfe,0xef,0xfe,
-0xef,0x04,0x50,0x20,0x21,0x11,0x6f,0x01,0x01,0x65,0x69,0x52,0x08,0xe7,0x43,0x5a,
-0xe2,0xab,0x14,0x22,0x0a,0x90,0xaf,0x06,0x10,0xaa,0xcf,0x08,0x21,0x52,0x23,0x4c,
-0xec,0x21,0x7c,0xde,0x2d,0xed,0x31,0x26,0x43,0x30,0x5d,0x25,0x53,0x2a,0xcc,0xc2,
-0x00,0x1f,0xd0,0x18,0x21,0x1f,0x10,0x52,0x14,0x11,0xe0,0xeb,0x0c,0x13,0x22,0xc3,
-0xa4,0x21,0xee,0xd3,0x1d,0x13,0x30,0xe6,0x00,0x7d,0x08,0x00,0x00,0xb2,0x1a,0x50,
-0x10,0x1f,0x65,0x40,0x03,0x09,0x85,0x71,0x1f,0xdd,0xc1,0x00,0xca,0x33,0xba,0x28,
-0x00,0x32,0x19,0xdd,0x80,0x23,0x0d,0x13,0x31,0x2d,0x13,0x12,0xb6,0xb0,0xc7,0x51,
-0x11,0xc8,0x24,0x67,0x1f,0x1b,0xbd,0x2d,0xed,0xb7,0xab,0xa5,0x16,0x10,0x42,0x94,
-0x24,0x02,0x10,0x08,0x0e,0x45,0xf3,0x00,0x0b,0x10,0xeb,0x17,0x10,0x1e,0x89,0x56,
-0x20,0x0f,0x30,0xad,0x22,0x11,0x11,0xd3,0xcb,0x40,0x3d,0xff,0xe5,0x00,0x10,0x00,
-0x60,0xe7,0x00,0x5f,0x10,0x0f,0x63,0x11,0x61,0x20,0x0f,0x20,0x36,0x03,0x31,0xe6,
-0x12,0x7e,0x96,0x15,0x32,0x3b,0xef,0xa2,0xf6,0x17,0xb0,0x8a,0x01,0x33,0x0f,0x30,
-0x00,0x6e,0xee,0xff,0xff,0xd9,0x36,0x53,0x00,0x84,0x02,0x22,0x09,0x10,0xfe,0x08,
-0x14,0x21,0x80,0x02,0x0e,0xd5,0x13,0x09,0x08,0x00,0x17,0x0b,0xf5,0x33,0x32,0x0d,
-0xfe,0xd3,0x1e,0x08,0x20,0x12,0x20,0x68,0x00,0x50,0x0b,0xbc,0xcc,0xcb,0xb2,0x16,
-0x54,0x40,0x66,0x66,0x66,0x61,0xed,0x0c,0x31,0x18,0xdd,0xa2,0xe8,0x0c,0x30,0xd9,
-0x22,0x8e,0x08,0x00,0x01,0x77,0x95,0x40,0x0d,0x73,0x30,0x01,0x3e,0x54,0x71,0x0d,
-0xff,0xe1,0x00,0x7e,0x99,0xe7,0x15,0x19,0x31,0x02,0xbc,0x20,0x10,0x2f,0xc1,0x11,
-0x9b,0x34,0x67,0x0d,0x50,0x00,0x6f,0xff,0xfe,0xdb,0x96,0xf9,0x2e,0x12,0x10,0x35,
-0x19,0x22,0x0a,0x90,0xbe,0x1e,0x04,0x0d,0xc0,0x04,0x08,0x00,0x10,0x0a,0xa8,0x32,
-0x22,0x60,0x00,0xc7,0xca,0x0b,0x98,0x00,0x22,0x07,0x10,0x4f,0x02,0x00,0x30,0x01,
-0x50,0xee,0xee,0xee,0xd3,0x0f,0x25,0x1a,0x21,0x33,0x22,0x16,0x54,0x50,0x6e,0xdd,
-0xe6,0x00,0x0f,0xc6,0x54,0x00,0x65,0xd2,0x40,0xa7,0x70,0x02,0xf1,0x08,0x00,0x62,
-0xb9,0x80,0x00,0x7e,0xdd,0xf7,0x16,0x0b,0x13,0x9a,0x7f,0xb3,0x30,0x9b,0x35,0x77,
-0x9c,0x77,0x62,0xee,0xed,0xcb,0x85,0x0d,0x40,0x4a,0x3d,0x13,0x24,0x55,0x14,0x17,
-0xef,0xc2,0x0a,0x23,0x0a,0xee,0xe3,0x17,0x12,0x92,0xd4,0x10,0x31,0x0d,0x92,0x12,
-0xd8,0x6e,0x10,0x08,0xf0,0x4b,0x1a,0xa0,0x98,0x00,0x01,0x22,0x11,0x20,0x02,0x20,
-0x98,0x00,0x71,0x0c,0xcc,0xcc,0xcc,0xb1,0x0f,0x30,0xb3,0x0e,0x01,0x0b,0xcd,0x31,
-0x2b,0xef,0xc3,0x25,0x0e,0x31,0xe7,0x00,0x5f,0xe8,0x27,0x00,0xc8,0x01,0x80,0x0e,
-0xb8,0x80,0x00,0xf6,0x12,0x7e,0x00,0xa0,0x00,0x00,0xc8,0x01,0x21,0x0e,0x50,0x64,
-0x30,0xf2,0x01,0x12,0x0e,0x50,0x00,0x5c,0xcc,0xef,0xdf,0xea,0x0e,0x50,0x00,0x13,
-0x43,0x32,0x10,0x7f,0xd6,0x40,0x18,0xcd,0xcb,0x70,0x5f,0x00,0x43,0xeb,0x54,0x46,
-0xdc,0x67,0x34,0x00,0xfe,0x20,0x13,0x08,0xc3,0x43,0x61,0x02,0xea,0x43,0x36,0xdd,
-0x00,0xe2,0x4c,0x20,0xca,0x60,0x64,0x02,0xc0,0x53,0x30,0x00,0x01,0x30,0x01,0x9b,
-0xcc,0x40,0x00,0x5c,0x01,0x27,0x18,0x20,0x05,0xc1,0xb0,0x03,0x00,0x1c,0x6f,0x10,
-0x12,0x5f,0x13,0x30,0x02,0xce,0xde,0xb9,0x59,0x50,0xc9,0x00,0x4f,0x10,0x04,0xc5,
-0x79,0x50,0xd4,0x00,0x4d,0x00,0xf2,0x16,0x95,0xb0,0xd0,0x09,0xc3,0x29,0xc0,0x00,
-0x4d,0x00,0x08,0xdd,0x91,0xf7,0x47,0x21,0x01,0x20,0x02,0x05,0x10,0x89,0x34,0x00,
-0x71,0x11,0x09,0xa2,0x45,0x70,0x4d,0x0f,0x6e,0xb2,0x14,0xd0,0xf0,0x90,0x06,0x41,
-0x24,0x15,0x17,0xfb,0x04,0x12,0x04,0xfb,0x04,0x02,0xe3,0x15,0x02,0xbe,0x10,0x19,
-0xf5,0xfb,0x04,0x13,0x90,0xfb,0x04,0x12,0xb0,0xcb,0x08,0x08,0xfb,0x04,0x29,0x6e,
-0x63,0xfb,0x04,0x12,0x0b,0xab,0x60,0x00,0x48,0x75,0x00,0x71,0xce,0x45,0x2f,0x52,
-0x22,0xf5,0xa5,0x81,0x16,0x10,0xb8,0x2f,0x13,0xff,0xad,0x24,0x20,0x12,0x20,0x2a,
-0x0a,0x00,0xd0,0x13,0x43,0xb2,0x00,0x00,0x24,0xeb,0xa1,0x22,0x02,0x8b,0x51,0x61,
-0x51,0xf9,0x43,0x6d,0x70,0x00,0x74,0x5f,0x12,0x2f,0xcc,0x11,0x01,0x18,0x1c,0x41,
-0x6e,0x51,0x13,0xca,0x9c,0x2e,0x10,0xef,0xe7,0x2a,0x07,0xd2,0x69,0x32,0x33,0x33,
-0x44,0x08,0x81,0x2f,0xdd,0xd1,0x96,0x3c,0x0e,0x12,0x18,0x82,0x05,0x13,0x53,0xff,
-0x00,0xf0,0x07,0xd8,0x00,0x01,0x50,0x04,0x66,0x66,0x66,0x62,0x05,0xe0,0x05,0x77,
-0x77,0x77,0x84,0x04,0xe0,0x00,0x06,0xbc,0xb5,0x4e,0x04,0x30,0xac,0x42,0x4d,0xa6,
-0x89,0x40,0xc8,0x00,0x0a,0x80,0x79,0x0e,0x30,0xcb,0xec,0x10,0xea,0x07,0x10,0x23,
-0x6a,0x04,0xc0,0x03,0x33,0x33,0x46,0x89,0x14,0xe0,0x3d,0xed,0xfe,0xcb,0x86,0x15,
-0x00,0x12,0x98,0xaa,0x52,0x11,0x54,0xf3,0x98,0x00,0xa3,0x5a,0x10,0xfc,0x82,0x65,
-0x10,0x32,0xbf,0x25,0x00,0xb9,0x14,0xb3,0x59,0xe0,0x00,0x02,0xfc,0xcc,0xcc,0xbb,
-0x70,0x00,0x02,0x83,0x96,0x12,0xdf,0xdc,0x50,0x0f,0x14,0x01,0x45,0x21,0x14,0x33,
-0x67,0x9d,0x60,0x06,0xde,0xef,0xfe,0xee,0xfe,0x70,0x53,0x12,0xb8,0x18,0x1a,0x22,
-0x0b,0x80,0x21,0x15,0x04,0x0f,0x00,0x12,0x70,0x70,0x1c,0x15,0x64,0xca,0x1c,0x11,
-0x00,0xe3,0x4e,0x00,0x26,0x0c,0x00,0x1e,0x03,0x80,0x04,0xe0,0x8b,0xcc,0xcc,0xbb,
-0x60,0x4e,0x20,0x01,0x60,0x63,0x04,0xe0,0x00,0x7c,0xdc,0xe7,0x21,0x70,0x9c,0x31,
-0x4e,0x40,0x04,0xe0,0x0d,0x09,0x51,0xc1,0x4e,0x00,0xa9,0x00,0x1d,0x50,0x04,0xe0,
-0x01,0xbe,0xee,0x70,0x9a,0x8b,0x01,0xe8,0x56,0x90,0x33,0x45,0x68,0xa0,0x4e,0x1c,
-0xdd,0xdc,0xba,0xe8,0x56,0x11,0x12,0x0c,0x07,0x01,0xdb,0x56,0x1a,0x40,0xe8,0x56,
-0x12,0x8f,0x6d,0x1b,0x02,0x46,0x5c,0x20,0x05,0x21,0xb3,0x7d,0x44,0x02,0xbe,0xff,
-0x80,0x71,0xc7,0x80,0xe1,0xaa,0xaa,0xaa,0xaa,0x50,0x3e,0x06,0x7c,0x00,0x50,0x03,
-0xe0,0x00,0x06,0x85,0x74,0x0d,0x90,0x1d,0xb8,0xda,0x00,0x03,0xe0,0x08,0xb0,0x01,
-0x05,0x2f,0x51,0xd4,0x00,0x0a,0x70,0x03,0x80,0x0a,0x20,0x00,0x3e,0x80,0x0a,0x40,
-0x70,0x03,0xe0,0x0b,0x57,0x6b,0x50,0x3e,0x00,0x4f,0x63,0xac,0x0b,0x0b,0x2b,0x4b,
-0xd9,0xcc,0xc7,0x1e,0x3e,0x80,0x0a,0x04,0x01,0x00,0x1f,0xfa,0x24,0x13,0x03,0x04,
-0x83,0xc3,0x17,0xee,0x14,0x00,0x7a,0xf9,0xf7,0x00,0xfd,0xf7,0x00,0xf4,0xa7,0xcc,
-0x05,0x10,0x1b,0x3d,0x03,0x00,0x03,0x15,0x00,0x2f,0xe7,0x00,0x01,0x00,0x14,0x1f,
-0xdf,0x1d,0x00,0x09,0x13,0xee,0x34,0x1c,0x83,0x00,0xfe,0x00,0x00,0xed,0xfd,0xf3,
-0xf6,0xfa,0x8d,0x00,0x0f,0x00,0x4c,0xfd,0xfe,0xf9,0xfb,0x8e,0x00,0x10,0xfc,0x1b,
-0xee,0x08,0x39,0xde,0x06,0x19,0x00,0x0b,0x0a,0x00,0x19,0xfe,0x1f,0x00,0x15,0xfd,
-0xc6,0xbe,0x11,0xfd,0x23,0x00,0x4d,0xfd,0x00,0xfd,0xfa,0x6a,0xb2,0x09,0xf3,0x00,
-0x05,0x3a,0x00,0x11,0xfd,0x33,0x00,0x25,0xfd,0xfc,0x2f,0x00,0x11,0xdd,0xfd,0x00,
-0x15,0xd9,0x23,0x00,0x20,0xfb,0xfd,0x1f,0x00,0x02,0x04,0x00,0x0b,0x42,0x00,0x10,
-0xfc,0x08,0x00,0x0a,0x17,0x00,0x0e,0x96,0x00,0x0f,0x01,0x00,0x07,0x10,0xf7,0x5e,
-0x00,0x09,0xe5,0x00,0x01,0x64,0x00,0x31,0xfd,0xfa,0xf7,0x01,0x33,0x04,0x69,0x00,
-0x97,0xf6,0x00,0x00,0xd7,0xf8,0xe6,0xeb,0x00,0xdd,0xcf,0x01,0x27,0xec,0xf2,0xcf,
-0xa9,0x23,0x00,0xec,0x15,0xd1,0x61,0xfb,0x00,0xfc,0x00,0xfe,0xfe,0x1d,0x01,0x1d,
-0x02,0xe9,0x01,0x00,0x30,0x02,0x29,0xfc,0xfd,0x71,0x00,0x0e,0x01,0x00,0x10,0xf4,
-0xb5,0x00,0x1f,0xf9,0x69,0x02,0x02,0xb1,0xe0,0xde,0x00,0x00,0xf4,0xfc,0xdc,0xfe,
-0x02,0x00,0x02,0x5d,0x00,0xd2,0xef,0xf1,0x00,0xf0,0xf1,0xf5,0xef,0x00,0xf2,0xf5,
-0xf8,0xf5,0xf7,0x12,0x01,0x66,0xdf,0xfb,0x00,0x00,0xf5,0xfe,0x23,0x01,0x50,0xf9,
-0xf9,0x00,0x00,0xf9,0x2a,0xf9,0x01,0xe4,0xc3,0x01,0x7d,0x02,0x22,0xee,0xf7,0x4f,
-0x00,0x13,0x02,0x56,0x0a,0x23,0xfb,0xfb,0x62,0x01,0x07,0x64,0x0a,0x14,0xf9,0xe7,
-0x01,0x15,0x02,0xf3,0x01,0x01,0xa4,0x01,0x13,0xfb,0x0f,0x00,0xf0,0x0a,0x03,0xf9,
-0xe1,0xf8,0x00,0x00,0xf2,0xfc,0xf2,0xfe,0x03,0xf2,0x03,0x03,0x02,0x03,0x00,0x03,
-0xf5,0xf6,0xfd,0xfa,0xf6,0xfa,0xf7,0xf5,0x01,0x36,0xfd,0xfc,0x03,0xb4,0x0a,0x1a,
-0xfc,0x8e,0x01,0x02,0xea,0x01,0x1d,0xfc,0xa6,0x01,0x0f,0xa9,0x01,0x03,0x1f,0xf6,
-0x29,0x01,0x09,0x1b,0xfe,0x97,0x02,0x0f,0x23,0x00,0x02,0x03,0x8c,0x01,0x0f,0x01,
-0x00,0x0d,0x1f,0xfe,0x1d,0x00,0x0f,0x1e,0x02,0xa2,0x03,0x19,0x03,0x7e,0x00,0x13,
-0x03,0xc4,0xc1,0x0f,0x01,0x00,0x1f,0x0a,0xfd,0x00,0x1f,0xec,0x8c,0x00,0x0b,0x22,
-0xfd,0xfe,0x96,0x01,0x1c,0xee,0x22,0x02,0x20,0xfd,0x02,0x49,0x00,0x10,0x07,0x4c,
-0x04,0x0f,0x6c,0x00,0x13,0x17,0x02,0xaa,0x04,0x05,0x60,0x00,0x2c,0xfe,0x02,0x0d,
-0x01,0x1f,0xee,0xd2,0x00,0x23,0x1f,0xfd,0x73,0x01,0x0f,0x1f,0xfe,0x3b,0x00,0x1a,
-0x14,0x01,0x8f,0xac,0x02,0x7b,0xc7,0x2d,0x05,0x00,0xbf,0xb8,0xf2,0x0b,0x07,0x08,
-0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,
-0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x28,0xab,0x70,0x1b,0x1c,0x00,0x1d,0x1e,
-0x00,0x1f,0x82,0x12,0xe9,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,
-0x26,0x24,0x27,0x85,0xd5,0x0f,0x01,0x00,0xff,0xb9,0x02,0x33,0x02,0x20,0x03,0x02,
-0x2e,0x02,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x52,0x09,0x00,0x0a,0x00,0x0b,0x18,
-0x0d,0x12,0x0c,0x20,0x0d,0xa2,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,
-0x69,0x35,0x73,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x7b,0x22,0xc2,0x1a,0x19,0x17,
-0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x17,0x8d,0x0f,0x01,0x00,0xff,0xba,
-0x50,0x00,0x00,0x00,0x00,0x00,
+0xa0,0x11,0x22,0x31,0x00,0x0c,0x70,0xbf,0xff,0xef,0xb0,0x08,0x0e,0xf0,0x00,0x02,
+0xf6,0x00,0x0b,0x70,0x00,0x00,0xcc,0x00,0x00,0xb7,0x00,0x00,0xbf,0x40,0x0d,0x00,
+0xd0,0xae,0xad,0x10,0x00,0xb7,0x01,0xcd,0x10,0xbc,0x00,0x0b,0x72,0xea,0x28,0x0d,
+0x20,0xc7,0x14,0x28,0x0d,0x21,0x0c,0x70,0x22,0x06,0x11,0x31,0x22,0x06,0x11,0xd4,
+0x22,0x06,0x21,0x07,0xf2,0x9b,0x03,0x21,0x0d,0x60,0xa9,0x03,0x11,0xe6,0x22,0x06,
+0x20,0xbe,0x10,0x22,0x06,0x12,0xd9,0x75,0x01,0x11,0x15,0x27,0x09,0x10,0x22,0x7a,
+0x08,0x43,0x0c,0xff,0xfe,0xff,0x4a,0x0a,0x13,0x5e,0x08,0x00,0x00,0x30,0x0c,0x02,
+0xe5,0x0a,0x11,0x3f,0xc2,0x02,0x11,0xc0,0x10,0x00,0x50,0x11,0x2f,0x50,0x00,0x3f,
+0xa7,0x0a,0x92,0x9c,0x00,0x00,0x3f,0x33,0x20,0x00,0x04,0xf2,0x49,0x01,0x21,0x2e,
+0x60,0x08,0x00,0x22,0x01,0xd8,0x59,0x01,0x22,0x0d,0x80,0x08,0x00,0x17,0x05,0x69,
+0x01,0x0c,0x08,0x00,0x02,0x60,0x04,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0xf1,0x0a,
+0x00,0x00,0x00,0x00,0x04,0x00,0x17,0x02,0x44,0x45,0x51,0x0e,0x20,0x4d,0x09,0xdd,
+0xdc,0xf6,0x0f,0x20,0x4d,0x00,0x00,0x00,0xf3,0x07,0x00,0x21,0x02,0xf0,0x07,0x00,
+0xf0,0x08,0x06,0xd0,0x0f,0x20,0x4d,0x1a,0xbb,0xbe,0x80,0x0f,0x31,0x5d,0x05,0x66,
+0x8f,0x20,0x0f,0xff,0xfd,0x00,0x00,0xaa,0x00,0x1c,0x00,0x21,0x03,0xf2,0x07,0x00,
+0x21,0x0d,0x80,0x07,0x00,0x81,0xad,0x00,0x00,0x0e,0x20,0x4d,0x06,0xf2,0x07,0x00,
+0x21,0x0e,0x30,0x07,0x00,0x20,0x00,0x00,0x07,0x00,0x11,0x4e,0x07,0x00,0x27,0x30,
+0x4e,0x0e,0x00,0x00,0x79,0x00,0x00,0x01,0x00,0xf0,0x02,0x28,0x16,0x67,0x77,0x84,
+0x00,0x5d,0x2a,0xaa,0x99,0xda,0x00,0x5d,0x00,0x00,0x00,0xd7,0x06,0x00,0x20,0x01,
+0xf3,0x06,0x00,0xf0,0x0a,0x07,0xd0,0x00,0x5d,0x7f,0xff,0xff,0x71,0x33,0x7d,0x00,
+0x11,0x7e,0x09,0xfe,0xfd,0x00,0x01,0xe6,0x00,0x00,0x5e,0x00,0x0a,0xb0,0x06,0x00,
+0xd0,0x7e,0x10,0x00,0x00,0x5e,0x05,0xe3,0x00,0x00,0x00,0x5d,0x4e,0x30,0x06,0x00,
+0x20,0x32,0x00,0x06,0x00,0x1c,0x00,0x06,0x00,0x26,0x4c,0x00,0x01,0x00,0xf0,0x28,
+0x03,0x00,0x13,0x34,0x45,0x20,0x00,0xe4,0x0a,0xdd,0xcc,0xec,0x00,0x0e,0x40,0x00,
+0x00,0x0c,0xa0,0x00,0xe4,0x00,0x00,0x00,0xf7,0x00,0x0e,0x40,0xde,0xee,0xef,0x22,
+0x22,0xe4,0x02,0x23,0x3d,0xb1,0xef,0xff,0x40,0x00,0x08,0xf2,0x00,0x00,0xe4,0x00,
+0x08,0xf4,0x00,0x00,0x0e,0x40,0x2c,0x23,0x00,0x50,0xe4,0x0e,0x91,0x00,0x00,0x34,
+0x00,0xe2,0x03,0x00,0x00,0x00,0xe3,0x00,0x03,0xf0,0x00,0x00,0x0a,0x10,0x00,0x4f,
+0xc9,0x00,0x11,0xf0,0x07,0x00,0x12,0x4f,0x64,0x00,0xb2,0xfe,0xee,0xee,0xff,0x70,
+0x00,0x02,0x33,0x32,0x22,0x10,0x11,0x00,0xf0,0x00,0x10,0x8e,0xee,0xff,0xc0,0x00,
+0xc7,0x01,0x32,0x21,0x9d,0x00,0x0c,0x70,0x00,0x2e,0x01,0xf0,0x14,0xb7,0x0c,0xdd,
+0xde,0xf2,0x34,0x4c,0x70,0x24,0x45,0xf8,0x0c,0xdd,0xf7,0x00,0x00,0xcc,0x00,0x00,
+0x0b,0x70,0x01,0xcc,0x00,0x00,0x00,0xc7,0x06,0xe9,0x00,0x00,0x00,0x0c,0x60,0xa3,
+0x3b,0x00,0xe1,0x84,0x00,0x00,0x22,0x22,0x23,0x31,0x00,0x00,0x5f,0xff,0xff,0xff,
+0xf4,0x4e,0x00,0xf1,0x02,0x0e,0x50,0x00,0x02,0x33,0x33,0x33,0xe5,0x00,0x06,0xff,
+0xff,0xff,0xfe,0x20,0x00,0x6e,0x16,0x00,0xd7,0x06,0xf2,0x22,0x22,0x33,0x20,0x00,
+0x3e,0xff,0xff,0xff,0xe9,0x00,0x01,0x00,0xc0,0x05,0x10,0xad,0xee,0xef,0xa0,0x00,
+0xe5,0x02,0x32,0x22,0xac,0x3b,0x00,0xf0,0x07,0x00,0x0c,0x80,0x00,0xe5,0x07,0x77,
+0x78,0xf3,0x22,0x2e,0x51,0x9a,0xa9,0xec,0x0e,0xff,0xf5,0x00,0x00,0x6f,0x20,0x1a,
+0x00,0x70,0x7f,0x40,0x00,0x00,0xe5,0x02,0xce,0xb5,0x01,0x20,0x41,0xe7,0x3b,0x00,
+0x11,0xd4,0x41,0x00,0xf1,0x00,0x01,0x00,0x00,0x2c,0xdd,0xdd,0xdd,0xd3,0x00,0x04,
+0xf5,0x44,0x44,0x4e,0x50,0xe4,0x00,0xa1,0xd5,0x00,0x05,0xf0,0x00,0x00,0x0d,0x50,
+0x00,0x5f,0x0d,0x00,0xc1,0x03,0xfc,0xbb,0xbc,0xcf,0x40,0x00,0x03,0x45,0x54,0x44,
+0x30,0x34,0x00,0xc1,0x09,0x20,0xbd,0xde,0xee,0x70,0x00,0xe4,0x02,0x33,0x32,0xc8,
+0x66,0x01,0xf0,0x0c,0x0f,0x50,0x00,0xe4,0x07,0x88,0x8a,0xf0,0x00,0x0d,0x40,0x89,
+0x99,0xf8,0x0b,0xdd,0xf4,0x00,0x00,0x8d,0x00,0x34,0x4e,0x40,0x00,0x7e,0x20,0x68,
+0x00,0x80,0x9e,0x20,0x00,0x00,0x0d,0x42,0xda,0x10,0x75,0x00,0xf1,0x03,0x24,0x00,
+0x00,0x05,0x40,0x0d,0x40,0x00,0x00,0x00,0xc8,0x00,0xb3,0x00,0x00,0x00,0x1f,0x40,
+0x52,0x00,0x11,0xfb,0xcd,0x00,0xf1,0x08,0xf5,0xcc,0x10,0x00,0x00,0x05,0xf6,0x00,
+0xbd,0x10,0x00,0x08,0xf5,0x00,0x00,0x9e,0x20,0x02,0xb2,0x00,0x00,0x00,0x66,0x75,
+0x00,0xf0,0x01,0x60,0x2a,0x02,0x55,0x55,0x61,0x03,0xe0,0x3e,0x06,0xcc,0xcb,0xf6,
+0x03,0xe0,0x3e,0xc5,0x02,0x01,0x07,0x00,0x21,0x02,0xf0,0x07,0x00,0xf0,0x02,0x06,
+0xd0,0x03,0xe0,0x3e,0x0b,0xcc,0xce,0x83,0x47,0xe0,0x3e,0x03,0x44,0x6f,0x2a,0xdd,
+0x15,0x00,0x20,0x9c,0x00,0x1c,0x00,0x21,0x02,0xf3,0x07,0x00,0x21,0x0b,0xa0,0x07,
+0x00,0x20,0x7e,0x10,0x07,0x00,0x30,0x04,0xf4,0x00,0x07,0x00,0x42,0x0c,0x50,0x00,
+0x00,0x4d,0x00,0x0b,0x07,0x00,0x3f,0x02,0xd0,0x3e,0xc5,0x02,0x0f,0xf0,0x03,0xf5,
+0x77,0xad,0x00,0x00,0x07,0xd3,0xaa,0xcd,0x7f,0xff,0xff,0x70,0x00,0x5d,0x00,0x11,
+0x7e,0x95,0x02,0x04,0xc5,0x02,0x9f,0x1e,0xee,0xee,0x00,0x7e,0x10,0x03,0x33,0x7e,
+0xc5,0x02,0x1c,0x2c,0x07,0x20,0xd4,0x01,0xf1,0x05,0x9c,0xff,0xf5,0x03,0x44,0x44,
+0xf4,0x36,0x6e,0x51,0xcd,0xdd,0xfd,0x00,0x00,0xe5,0x00,0x00,0x4f,0x30,0xad,0x01,
+0x70,0x50,0x2d,0xdd,0xf5,0x00,0x9f,0x40,0xd4,0x01,0x01,0x5f,0x01,0x23,0xe4,0x02,
+0xb3,0x00,0x0f,0xd4,0x01,0x1a,0xd2,0x01,0x11,0x11,0x12,0x20,0x00,0x00,0x03,0xff,
+0xff,0xff,0xff,0x90,0x84,0x00,0x22,0x9a,0x00,0xea,0x01,0x21,0xa0,0x00,0x8e,0x02,
+0x83,0xaa,0x00,0x00,0x04,0xef,0xee,0xee,0xef,0x1e,0x00,0x12,0xa8,0x07,0x00,0x20,
+0x0b,0x70,0x9a,0x02,0x30,0xa0,0x00,0xc5,0x0d,0x00,0x30,0x8c,0x00,0x0d,0xe1,0x00,
+0x22,0x08,0xb0,0x1c,0x00,0x11,0x8b,0x14,0x00,0x81,0xcc,0xde,0xfd,0xdd,0xdd,0xdc,
+0x23,0x55,0x01,0x00,0xf2,0x00,0x50,0x00,0x01,0x11,0x22,0x22,0x20,0x00,0x00,0x00,
+0xef,0xff,0xff,0xff,0xa0,0x28,0x00,0xf1,0x01,0x7b,0x00,0x00,0x00,0x12,0x22,0x22,
+0x28,0xb0,0x00,0x00,0x1f,0xff,0xff,0xfe,0xfa,0xed,0x02,0x21,0x00,0x09,0x69,0x00,
+0x30,0xf2,0x00,0x75,0x20,0x03,0x82,0x3f,0x52,0x22,0x22,0x20,0x8f,0xff,0xff,0x10,
+0x03,0x04,0xea,0x03,0xc2,0x44,0x44,0x44,0x43,0x00,0x00,0x02,0xef,0xff,0xee,0xee,
+0xf0,0x13,0x00,0xf3,0x05,0x3f,0x00,0x00,0x00,0x44,0x44,0x45,0x57,0xf0,0x00,0x00,
+0x3f,0xee,0xee,0xee,0xda,0x00,0x00,0x03,0xf1,0x1a,0x00,0xc0,0x53,0x34,0x44,0x45,
+0x10,0x00,0x01,0xce,0xee,0xdd,0xdd,0xc3,0x11,0x00,0x01,0xf0,0x00,0x30,0x04,0xff,
+0xff,0xb7,0x01,0x00,0xff,0x00,0x23,0x00,0xb8,0xd2,0x00,0x11,0x80,0x08,0x00,0x00,
+0x0f,0x00,0x40,0x03,0xee,0xee,0xef,0x1e,0x00,0x52,0x03,0x33,0x33,0x32,0xd6,0x16,
+0x00,0x22,0x0d,0x50,0x08,0x00,0x12,0xe4,0x07,0x00,0x13,0x0f,0x8d,0x00,0x15,0x20,
+0xba,0x01,0x21,0x9f,0xff,0x01,0x00,0x30,0x21,0x32,0x22,0x01,0x00,0x06,0x18,0x00,
+0xc0,0xdf,0xff,0xff,0xff,0xc0,0x00,0x00,0x01,0x22,0x22,0x22,0x6f,0x7e,0x00,0x41,
+0x11,0x22,0x26,0xe0,0xf0,0x00,0x23,0xff,0xfe,0xc7,0x03,0x12,0xd0,0x08,0x00,0x40,
+0x4a,0x00,0x00,0x33,0x3b,0x00,0xab,0x33,0x30,0x3d,0xde,0xee,0xee,0xee,0xdd,0xdd,
+0x40,0xf0,0x00,0x01,0xc3,0x00,0x13,0xf3,0x80,0x00,0x82,0x30,0x00,0x00,0x23,0x33,
+0x33,0x34,0xf3,0xf0,0x00,0x26,0xdc,0x10,0xf0,0x00,0xc6,0x42,0x22,0x33,0x34,0x20,
+0x00,0x01,0xdf,0xff,0xff,0xfe,0xe8,0x59,0x02,0x00,0x77,0x01,0x82,0x80,0x00,0x00,
+0x02,0x22,0x22,0x22,0xaa,0xe0,0x01,0x00,0x68,0x01,0x51,0x3f,0xff,0xff,0xff,0xf9,
+0x86,0x01,0x23,0x11,0x1b,0xff,0x00,0x12,0xb6,0x07,0x00,0x51,0x02,0x00,0x00,0x9e,
+0xee,0x01,0x00,0x21,0x21,0x33,0x01,0x00,0x15,0x30,0x4b,0x00,0xc2,0x44,0x44,0x44,
+0x55,0x30,0x00,0x00,0x4f,0xdd,0xdd,0xdd,0xee,0x20,0x05,0x22,0x05,0xe0,0x21,0x05,
+0x12,0x5e,0x0f,0x00,0x00,0xd2,0x00,0xef,0x4f,0xcb,0xbb,0xcc,0xec,0x00,0x00,0x00,
+0x45,0x55,0x55,0x43,0x10,0x00,0x0d,0x06,0x14,0x0e,0x48,0x03,0x0f,0x0d,0x06,0x26,
+0xb1,0x10,0x7c,0xdd,0xdd,0xc0,0x00,0xc7,0x02,0x44,0x33,0x7f,0x98,0x05,0xf0,0x0a,
+0x09,0xb0,0x00,0xc7,0x0a,0xcc,0xcc,0xf5,0x00,0x0c,0x70,0x34,0x55,0xeb,0x00,0x00,
+0xc7,0x00,0x00,0xae,0x10,0x00,0x0c,0x70,0x01,0x77,0x04,0x22,0xc7,0x07,0x98,0x05,
+0x13,0x62,0xd3,0x01,0xb4,0x33,0x33,0x34,0x44,0x00,0x00,0x5e,0xee,0xee,0xee,0xf5,
+0x98,0x05,0x00,0x84,0x01,0x7f,0xe5,0x00,0x06,0xfe,0xee,0xee,0xed,0x98,0x05,0x0c,
+0xf0,0x01,0x05,0x10,0x00,0x24,0x44,0x44,0x10,0x0e,0x40,0x00,0xde,0xee,0xdd,0x70,
+0x0d,0x50,0xb3,0x03,0x16,0x00,0x07,0x00,0x13,0xe4,0x0e,0x00,0x60,0x11,0x11,0x00,
+0x0d,0x61,0x20,0x96,0x01,0x41,0x0c,0xff,0xf8,0xf5,0x7f,0x00,0x20,0x00,0xf4,0x07,
+0x00,0x17,0x50,0x07,0x00,0xe0,0x21,0x0c,0x50,0x00,0xde,0xed,0xef,0xf8,0x0c,0x50,
+0x00,0x03,0x33,0x21,0x23,0x00,0x12,0x00,0x2a,0x00,0x0e,0x07,0x00,0x13,0x04,0x66,
+0x01,0x60,0x40,0x00,0x0b,0xdd,0xdd,0xe7,0x8f,0x01,0x61,0xe7,0x44,0x43,0x10,0x04,
+0xf0,0xa5,0x05,0x02,0x0f,0x00,0xe0,0x44,0x20,0x04,0xf2,0x21,0x0f,0xee,0xed,0xd7,
+0x00,0x3f,0xff,0xe0,0xf4,0x26,0x01,0xf3,0x00,0xf0,0x00,0x0e,0x51,0x11,0x24,0x50,
+0x3f,0x00,0x00,0xbf,0xff,0xfe,0xc8,0x03,0x4d,0x03,0x21,0x2b,0x00,0x19,0x03,0x26,
+0x11,0x00,0xa8,0x02,0x51,0x11,0x11,0x11,0x04,0xf0,0xc6,0x02,0x50,0x33,0x6f,0x00,
+0x00,0x01,0xea,0x02,0x00,0xb6,0x03,0x12,0x30,0x48,0x06,0x30,0xf5,0x22,0x22,0x20,
+0x02,0x62,0x0c,0xff,0xff,0xfe,0xee,0x40,0x1c,0x01,0x50,0x10,0x00,0xbd,0xdd,0xde,
+0xfe,0x00,0x00,0x86,0x00,0x22,0x0d,0x60,0xfe,0x00,0xf1,0x01,0x60,0x00,0xe7,0x33,
+0x33,0x20,0x0d,0x60,0x00,0xff,0xee,0xed,0x70,0x0d,0xff,0xf7,0xe9,0x00,0x32,0x72,
+0x20,0xf4,0xc6,0x00,0xd3,0xe8,0x44,0x56,0x85,0x0c,0x60,0x00,0x8c,0xcc,0xb8,0x52,
+0x0c,0x60,0x0e,0x05,0x01,0xe6,0x02,0x13,0x33,0xb0,0x03,0x10,0x60,0x5e,0x02,0x00,
+0x2a,0x00,0x29,0x04,0xe0,0x07,0x00,0xb2,0xfc,0xcc,0xcc,0xdf,0x50,0x00,0x00,0x55,
+0x55,0x55,0x43,0xc1,0x00,0xf0,0x02,0x30,0x01,0x70,0x67,0x67,0x72,0x0e,0x30,0x3e,
+0x3f,0xaa,0xaa,0x40,0xe3,0x03,0xe4,0xf0,0xa0,0x08,0x20,0x3e,0x4e,0xdd,0x07,0x31,
+0x03,0xe4,0xe0,0x0d,0x00,0xd9,0x4f,0x66,0x66,0x20,0xe5,0x25,0xe4,0xfb,0xbb,0xa3,
+0x0e,0xff,0xfe,0x1a,0x00,0x03,0x0d,0x00,0xd1,0xf1,0x23,0x55,0x0e,0x30,0x3e,0x2e,
+0xff,0xec,0x80,0xe3,0x03,0xe0,0xe1,0x08,0x01,0x15,0x06,0x0b,0x0d,0x00,0x16,0xf0,
+0x28,0x06,0xf0,0x02,0x20,0x03,0x21,0xbb,0xbb,0xb4,0x0e,0x30,0xa8,0x4f,0x66,0x65,
+0x10,0xe3,0x0a,0x84,0xe0,0x52,0x08,0xf3,0x04,0xa9,0x4e,0x00,0x01,0x00,0xe5,0x1a,
+0x94,0xff,0xff,0xf5,0x0e,0xff,0xf8,0x4e,0x11,0x10,0x00,0xe4,0x1a,0x00,0xe1,0xa8,
+0x4f,0x44,0x58,0x90,0xe4,0x0a,0x81,0xbd,0xcb,0x96,0x0e,0x30,0xa8,0xba,0x01,0xe2,
+0x05,0x30,0x00,0x23,0x33,0x44,0x44,0x30,0x00,0x0b,0xee,0xed,0xdd,0xdf,0x49,0x01,
+0x14,0xe5,0x81,0x02,0x07,0x0d,0x00,0x02,0x1a,0x00,0x12,0xa2,0xa8,0x03,0xe1,0x22,
+0xef,0xef,0xf6,0x0f,0x20,0xa9,0x4f,0x22,0x22,0x00,0xe4,0x09,0x94,0x5b,0x00,0xe0,
+0x9a,0x4e,0x22,0x22,0x00,0xe6,0x2a,0xa4,0xff,0xff,0xe4,0x0e,0xff,0xf9,0xd0,0x00,
+0x04,0x1a,0x00,0xe1,0x99,0x4f,0x44,0x57,0x90,0xe4,0x09,0x91,0xbd,0xcb,0x96,0x0d,
+0x40,0x99,0x75,0x00,0x41,0x04,0x30,0x00,0x04,0xf6,0x02,0x21,0x03,0xe0,0x76,0x02,
+0x51,0x4f,0x55,0x55,0x55,0xd5,0x54,0x01,0x30,0xcf,0x50,0x00,0x3c,0x00,0xe1,0xc6,
+0x00,0x04,0xe1,0x11,0x11,0x1d,0x50,0x00,0x2e,0xff,0xff,0xff,0xe2,0x75,0x00,0xd1,
+0x19,0x19,0x99,0x99,0x91,0x00,0x2e,0x4f,0x88,0x88,0x70,0x00,0x2e,0x1a,0x09,0x0a,
+0x06,0x00,0xb1,0x88,0x88,0x23,0x77,0x9e,0x4f,0x99,0x98,0x15,0xab,0xbe,0x0f,0x0a,
+0x18,0x2f,0x06,0x00,0xc1,0x4f,0x44,0x45,0x69,0x30,0x2f,0x1b,0xdd,0xcc,0xb9,0x20,
+0x2f,0x4e,0x00,0x0e,0x06,0x00,0x14,0x2e,0x9f,0x08,0x00,0x4a,0x02,0xf1,0x00,0x01,
+0xaa,0xaa,0xaa,0x10,0x03,0xf0,0x4f,0x77,0x77,0x50,0x00,0x3f,0x05,0xe0,0xb7,0x02,
+0xe0,0x5e,0x00,0x00,0x00,0x23,0x5f,0x05,0xff,0xff,0xfc,0x0e,0xff,0xf0,0x5e,0xaa,
+0x02,0x05,0x1a,0x00,0xc1,0x33,0x34,0x68,0x10,0x3f,0x02,0xce,0xdd,0xcb,0x81,0x03,
+0xe0,0x41,0x00,0x50,0x3e,0x00,0x00,0x10,0x00,0x2c,0x02,0x00,0x45,0x01,0x1f,0x3d,
+0x52,0x01,0x02,0x10,0x0d,0xd7,0x09,0x72,0x30,0x00,0x13,0x33,0x33,0x32,0x10,0x75,
+0x00,0xd1,0x02,0xed,0xdd,0xde,0x20,0x03,0xf0,0x4f,0x44,0x44,0x20,0x00,0x2f,0x5b,
+0x00,0xe1,0x02,0xf0,0x5e,0x44,0x45,0x31,0x77,0x8f,0x05,0xfd,0xdd,0xc9,0x1a,0xab,
+0x82,0x00,0xf2,0x00,0x00,0x2f,0x05,0xe1,0x11,0x24,0x60,0x02,0xf0,0x2f,0xff,0xff,
+0xfd,0x10,0x3f,0xb5,0x00,0x11,0x90,0x2d,0x03,0x12,0x10,0x24,0x03,0x10,0xe0,0x48,
+0x03,0x20,0x10,0x4f,0x61,0x05,0x31,0x23,0x36,0xf0,0x4e,0x03,0x32,0xfa,0x00,0x02,
+0xaa,0x05,0x51,0x1f,0x42,0x22,0x23,0x33,0x20,0x06,0x22,0xee,0xe4,0x39,0x04,0x01,
+0x75,0x00,0x22,0x02,0xf1,0x75,0x00,0x11,0x15,0x75,0x00,0xd4,0xf1,0x5e,0x22,0x22,
+0x11,0x98,0x9f,0x15,0xff,0xff,0xeb,0x19,0x9a,0x75,0x00,0xf5,0x03,0xe0,0x00,0x01,
+0x30,0x02,0xf0,0x4f,0xed,0xef,0xff,0x10,0x2f,0x00,0x23,0x32,0x45,0x20,0x02,0x87,
+0x02,0xe1,0xcd,0xdd,0xdd,0xde,0xa0,0x00,0x1f,0x64,0x44,0x44,0x7f,0x00,0x01,0xf2,
+0xf7,0x00,0x54,0x1f,0x20,0x00,0x00,0x4e,0x0d,0x00,0xa2,0x0f,0xdb,0xbb,0xcc,0xdd,
+0x00,0x00,0x24,0x55,0x54,0x96,0x05,0xf0,0x02,0x60,0x09,0x26,0x99,0x99,0x50,0x0e,
+0x30,0xe4,0xda,0x88,0x84,0x00,0xf3,0x0e,0x3e,0x50,0x5b,0x06,0x20,0xf3,0xe5,0xdc,
+0x02,0x30,0x0f,0x3e,0x50,0xe9,0x02,0xe1,0xf3,0xeb,0x99,0x80,0x78,0xf3,0x0f,0x3e,
+0xa8,0x86,0x19,0x9f,0x30,0xe3,0x1a,0x00,0x12,0x0e,0x1a,0x00,0x04,0x0d,0x00,0xd1,
+0x73,0x45,0x82,0x0e,0x30,0xe3,0x8e,0xed,0xb9,0x20,0xe3,0x0e,0x30,0x9c,0x06,0x11,
+0xe4,0xc2,0x07,0x21,0x0e,0x40,0x29,0x07,0x01,0x0d,0x00,0x36,0xd1,0x0d,0x40,0x30,
+0x07,0x10,0x02,0x2a,0x03,0x30,0xb2,0x05,0xd0,0x2a,0x03,0x21,0x00,0x5e,0x10,0x03,
+0xf3,0x06,0x04,0xe0,0xa9,0x4e,0x00,0x00,0x15,0x8e,0x0a,0x94,0xff,0xff,0xc4,0xcd,
+0xe0,0xa8,0x4e,0x11,0x00,0x00,0x4e,0x1a,0x00,0x01,0x2a,0x03,0x11,0x4e,0x2a,0x03,
+0x31,0x04,0xe0,0xa8,0xe9,0x00,0x10,0x05,0xad,0x01,0x5f,0x34,0x44,0x30,0x00,0x0a,
+0x2a,0x03,0x16,0xf0,0x03,0x02,0x00,0x30,0x04,0x44,0x44,0x00,0x3f,0x03,0xe0,0x3f,
+0xdd,0xdc,0x20,0x3f,0x03,0xf0,0x4f,0x2d,0x07,0x30,0x03,0xf0,0x4e,0x1e,0x05,0xe2,
+0x03,0xf0,0x4f,0xee,0xfb,0x5f,0xff,0x03,0xf0,0x4f,0x33,0x20,0x02,0x5f,0x15,0x00,
+0x01,0x1c,0x00,0x20,0x01,0x30,0x31,0x00,0xb2,0xee,0xff,0xc0,0x3e,0x03,0xe0,0x02,
+0x32,0x10,0x00,0x4e,0x55,0x02,0xd8,0x4e,0x04,0xe0,0x00,0x0a,0x30,0x00,0x29,0x04,
+0xd0,0x00,0x0e,0x60,0x78,0x00,0x03,0x07,0x00,0x40,0x0d,0xfd,0xdd,0xee,0xfd,0x01,
+0x32,0x43,0x33,0x33,0x29,0x0c,0xf4,0x00,0x02,0x04,0x22,0xee,0xee,0xe3,0x05,0xd0,
+0xb8,0x4f,0x33,0x32,0x00,0x4e,0x0b,0xd9,0x00,0xc1,0x22,0x32,0x27,0x9e,0x0a,0x84,
+0xff,0xfe,0xa3,0xbc,0xf0,0xa8,0x74,0x00,0x00,0xf3,0x00,0x40,0x13,0x03,0xf0,0xa8,
+0x73,0x00,0x94,0x3f,0x0a,0x80,0x23,0x21,0x00,0x02,0xb0,0xa7,0x8e,0x05,0x12,0x4f,
+0x29,0x0c,0x11,0x11,0x41,0x06,0x70,0x02,0x22,0x23,0x33,0xe5,0x00,0x05,0x73,0x05,
+0x32,0x20,0x00,0x5e,0x41,0x02,0x50,0xf2,0x22,0x23,0x33,0x20,0xa8,0x03,0x21,0xee,
+0xe9,0x75,0x00,0x50,0x06,0x42,0xee,0xef,0xf3,0x75,0x00,0x28,0x22,0x22,0x68,0x01,
+0x1f,0x10,0x68,0x01,0x05,0x93,0x34,0x57,0x80,0x4e,0x0a,0x81,0xcd,0xdc,0xa7,0x68,
+0x01,0x30,0x17,0x05,0x30,0xf3,0x05,0x22,0x23,0x20,0x80,0x05,0x11,0x40,0x41,0x0a,
+0x10,0xe4,0xef,0x07,0x00,0x5b,0x01,0x11,0x5e,0x0d,0x00,0x10,0x04,0x4e,0x0a,0xf4,
+0x06,0x30,0x00,0x03,0x55,0x54,0x44,0x20,0x00,0x04,0x55,0x55,0x55,0x51,0x00,0x00,
+0x02,0xfc,0xcd,0xdc,0xcb,0x50,0xce,0x03,0x24,0x00,0x02,0xa5,0x09,0x02,0xc0,0x00,
+0x66,0x02,0xf3,0x33,0x32,0x21,0x00,0x1e,0x00,0xc8,0xf3,0x22,0x22,0x34,0x30,0x00,
+0x00,0x0d,0xff,0xff,0xfe,0xec,0xe0,0x0c,0x03,0xd0,0x07,0x20,0x06,0xd0,0xa1,0x08,
+0x72,0x33,0x33,0x8d,0x22,0x22,0x22,0x0a,0x65,0x09,0x13,0xf2,0x64,0x03,0x76,0x00,
+0x00,0xcf,0xff,0xff,0xff,0x50,0x9e,0x09,0x40,0xe7,0x22,0x22,0x23,0x86,0x01,0x45,
+0xff,0xff,0xff,0xe5,0x06,0x02,0x50,0x00,0x0d,0x71,0x11,0x12,0x71,0x00,0x11,0xaf,
+0xb6,0x06,0x00,0x7b,0x03,0x02,0x9f,0x09,0x00,0x14,0x03,0x22,0x00,0x7f,0x53,0x00,
+0xa3,0x20,0x11,0x11,0x11,0x11,0x12,0x22,0x10,0x00,0x09,0x48,0x07,0x16,0xf4,0x69,
+0x09,0x00,0x01,0x00,0x04,0x78,0x09,0x60,0xff,0xee,0xee,0xff,0x40,0x00,0x2b,0x04,
+0x22,0x33,0x20,0xd6,0x09,0x03,0xd5,0x0a,0x26,0xfe,0x30,0x2d,0x00,0x40,0xfc,0xcc,
+0xcc,0xcc,0x0f,0x00,0x46,0x86,0x66,0x55,0x40,0x3c,0x00,0x50,0x0e,0xfe,0xee,0xef,
+0xfa,0xf1,0x00,0x35,0x25,0xf2,0x21,0xb5,0x0a,0x91,0x06,0xee,0xee,0xee,0xfe,0xee,
+0xee,0xe1,0x13,0x65,0x09,0x11,0x32,0xa1,0x0a,0x01,0x1d,0x00,0x30,0x7d,0xff,0xfd,
+0x92,0x09,0xc1,0x8e,0x40,0x00,0x4e,0x80,0x00,0x00,0x0d,0x70,0x00,0x00,0x6d,0x34,
+0x09,0x00,0x2c,0x09,0xf0,0x00,0x00,0x06,0xf6,0x32,0x37,0xf6,0x00,0x00,0x00,0x05,
+0xbd,0xed,0xa4,0x00,0x00,0x14,0x00,0x01,0x00,0xf2,0x01,0xcf,0xff,0xff,0xff,0x40,
+0x00,0x00,0x0f,0x62,0x22,0x22,0x10,0x00,0x00,0x00,0xf4,0x16,0x00,0xc0,0x0f,0xed,
+0xdd,0xdd,0xd2,0x00,0x00,0x00,0xf7,0x44,0x44,0x43,0x0f,0x00,0x12,0x40,0x17,0x00,
+0xd9,0xf6,0x22,0x22,0x34,0x30,0x00,0x00,0x0a,0xff,0xff,0xee,0xda,0x00,0x01,0x00,
+0x41,0x11,0x12,0x09,0xff,0x01,0x00,0x52,0xf2,0x01,0x11,0x11,0x4f,0x14,0x00,0x22,
+0x03,0xf0,0x08,0x00,0x1a,0x3f,0x0f,0x00,0x12,0x4e,0x07,0x00,0x20,0x01,0x50,0x06,
+0x00,0xf1,0x02,0x04,0x55,0x55,0x55,0x51,0x00,0x00,0x01,0xfd,0xcd,0xdc,0xcb,0x50,
+0x00,0x00,0x2f,0x10,0x1c,0x00,0x22,0x02,0xf1,0x24,0x00,0xd5,0x2f,0xff,0xff,0xff,
+0xf5,0x00,0x00,0x02,0xf4,0x22,0x22,0x21,0x00,0x1e,0x00,0x00,0x0f,0x00,0x92,0x46,
+0x80,0x00,0x00,0x0d,0xff,0xff,0xfe,0xdb,0x13,0x00,0x0e,0x01,0x00,0x91,0x7e,0xee,
+0xef,0xff,0xff,0xff,0xfe,0x11,0x33,0x01,0x00,0x73,0x20,0x00,0x00,0x22,0x22,0x22,
+0x20,0xf0,0x00,0x52,0x50,0x00,0x00,0x0d,0x70,0x27,0x00,0xf2,0x01,0xd9,0x55,0x55,
+0x55,0x10,0x00,0x00,0x0d,0xed,0xdd,0xcc,0xb4,0x00,0x00,0x00,0xd7,0x16,0x00,0x50,
+0x0c,0xfe,0xee,0xef,0xfd,0xa4,0x00,0x02,0x78,0x00,0x02,0x01,0x00,0x21,0x07,0xee,
+0x01,0x00,0x22,0xe2,0x13,0x53,0x00,0x05,0x18,0x00,0xc3,0x2c,0xcc,0xcc,0xdd,0xdd,
+0x00,0x00,0x00,0x45,0x55,0x54,0x46,0xb8,0x00,0x1b,0x1f,0xc7,0x00,0x03,0xa5,0x00,
+0x10,0x50,0x29,0x01,0x20,0x11,0x11,0x0e,0x00,0x92,0xdf,0xff,0xff,0xff,0x30,0x00,
+0x00,0x0f,0x50,0x1a,0x00,0x40,0xf7,0x22,0x22,0x23,0x68,0x01,0x83,0xff,0xff,0xfe,
+0xe4,0x00,0x00,0x00,0xf5,0x86,0x01,0xc5,0x72,0x22,0x22,0x31,0x00,0x00,0x00,0xbe,
+0xff,0xff,0xfe,0xa0,0x70,0x00,0x30,0x33,0x33,0x33,0xcc,0x00,0x11,0x6e,0x6f,0x01,
+0x15,0xfe,0x00,0x01,0x10,0x08,0xde,0x00,0x07,0x3c,0x00,0x03,0xb3,0x01,0x03,0xd1,
+0x01,0x40,0x0e,0xff,0xee,0xee,0x71,0x00,0x12,0x13,0x0d,0x01,0x13,0x01,0x0e,0x01,
+0x12,0xdf,0xfe,0x01,0x22,0x0e,0x60,0x26,0x00,0xf5,0x0c,0xee,0xdd,0xdd,0xde,0x50,
+0x00,0x00,0x0e,0x84,0x44,0x44,0x30,0x00,0x00,0x00,0xe7,0x22,0x22,0x23,0x10,0x00,
+0x00,0x0a,0xef,0xff,0xff,0xea,0x7f,0x00,0x85,0x6d,0xdd,0xcc,0xcc,0xcc,0xdd,0xde,
+0x20,0x59,0x01,0x03,0xde,0x01,0xf4,0x0f,0xee,0xee,0xef,0xff,0xd0,0x00,0x00,0x03,
+0x33,0x33,0x32,0x5f,0x00,0x00,0x00,0x12,0x22,0x22,0x25,0xf0,0x00,0x00,0x3f,0xff,
+0xff,0xff,0xeb,0x00,0x00,0x04,0x0b,0x02,0xc2,0x32,0x22,0x33,0x44,0x10,0x00,0x01,
+0xdf,0xff,0xff,0xfe,0xd5,0x13,0x00,0xd1,0x19,0x19,0x99,0x99,0x91,0x00,0x2e,0x3f,
+0x89,0x98,0x81,0x00,0x2e,0x3a,0x02,0x0a,0x06,0x00,0xc1,0x77,0x77,0x71,0x00,0x2e,
+0x4f,0xbb,0xba,0x92,0x00,0x2e,0x4e,0x4d,0x01,0x08,0x06,0x00,0xc2,0x4f,0x10,0x11,
+0x35,0x20,0x2f,0x2e,0xff,0xff,0xec,0x40,0x2f,0x6b,0x01,0x0d,0x06,0x00,0x12,0x2e,
+0x6e,0x02,0x01,0x06,0x00,0xe1,0x18,0x2e,0xdd,0xdd,0xe2,0x00,0x3f,0x4f,0x44,0x44,
+0x20,0x00,0x3f,0x5e,0x91,0x00,0xa5,0x5e,0x22,0x22,0x30,0x00,0x3f,0x5f,0xff,0xfe,
+0xe2,0x12,0x00,0xf3,0x00,0x00,0x00,0x02,0x00,0x3f,0x4f,0xed,0xee,0xff,0x50,0x3f,
+0x02,0x33,0x34,0x53,0xc0,0x02,0xd1,0x18,0x00,0x02,0x33,0x33,0x33,0x31,0x00,0x3f,
+0xee,0xee,0xee,0xfd,0x12,0x00,0x1f,0x5e,0x06,0x00,0x04,0x21,0x3a,0x00,0xda,0x02,
+0xf0,0x00,0x00,0x00,0x04,0x44,0x44,0x45,0x20,0x2f,0x00,0x00,0x4d,0xed,0xdd,0xdc,
+0x60,0x8e,0x00,0x31,0x40,0x00,0x60,0x0d,0x02,0x35,0xe3,0x02,0xf0,0x08,0x00,0x14,
+0x1f,0x08,0x00,0x22,0x42,0x20,0x08,0x00,0x53,0xff,0xe4,0x00,0xe3,0x03,0x18,0x00,
+0x05,0x08,0x00,0x10,0xe0,0x08,0x00,0xe3,0x01,0xd4,0x14,0xe2,0x20,0x1f,0x10,0x00,
+0x5f,0xff,0xff,0xfe,0xd1,0x1f,0xfa,0x01,0x0d,0x08,0x00,0x1a,0x20,0x08,0x00,0x13,
+0x05,0xa1,0x01,0x91,0x15,0x00,0x00,0x3d,0xdd,0xdd,0xee,0x60,0x5e,0x98,0x00,0x11,
+0x33,0xac,0x00,0x31,0xc1,0x01,0xd0,0x08,0x00,0xf1,0x04,0xf2,0x02,0xf0,0x00,0x4e,
+0x33,0x20,0x00,0xf1,0x02,0xf0,0x00,0x4f,0xff,0xd0,0x00,0xf1,0x03,0xe0,0xa7,0x03,
+0xf0,0x01,0xf2,0x03,0xe1,0x10,0x4e,0x00,0x00,0x4f,0xff,0xff,0xff,0xc0,0x4e,0x00,
+0x00,0x01,0xbb,0x02,0x17,0x3c,0x65,0x03,0x50,0x0d,0x20,0x00,0x00,0x2b,0x6d,0x02,
+0x40,0x30,0x00,0x00,0x3e,0x08,0x00,0x00,0x21,0x03,0x00,0x08,0x00,0x48,0x64,0x44,
+0x44,0x6e,0x18,0x00,0x51,0x31,0x11,0x11,0x4e,0x00,0xb2,0x03,0x23,0xff,0xfa,0x30,
+0x02,0xf0,0x05,0x00,0x61,0x16,0x66,0x66,0x64,0x0e,0x30,0xd4,0x3b,0xcb,0xbb,0xb8,
+0x0f,0x30,0xd4,0x00,0x30,0x02,0x10,0x07,0x00,0x30,0xc5,0x0b,0x60,0x07,0x00,0x25,
+0xd5,0x0c,0x07,0x00,0x20,0x63,0xe4,0x07,0x00,0x31,0x0e,0xdd,0xf4,0x07,0x00,0x00,
+0x23,0x00,0x26,0x0c,0x50,0x07,0x00,0xe1,0x04,0xd8,0x4e,0x86,0x0e,0x30,0xd4,0x3c,
+0xcc,0xcc,0xb9,0x1e,0x30,0xd4,0xec,0x02,0x04,0x07,0x00,0x1e,0xd5,0x07,0x00,0x32,
+0x00,0x00,0x41,0x7f,0x00,0xf2,0x25,0x10,0xde,0xee,0xee,0xfc,0x00,0xd6,0x02,0x33,
+0x33,0x32,0x00,0x0c,0x60,0x0b,0x30,0x0f,0x00,0x00,0xc6,0x00,0xd4,0x01,0xf0,0x4d,
+0xdf,0x60,0x0d,0x40,0x1f,0x00,0x44,0xd6,0x00,0xd4,0x02,0xf0,0x00,0x0c,0x60,0x0d,
+0x51,0x3f,0x33,0x00,0xd5,0x0e,0xff,0xff,0xee,0xc0,0x0d,0xad,0x03,0x40,0x51,0x00,
+0x00,0x23,0x09,0x02,0x62,0x00,0x7f,0xff,0xff,0xfe,0xf3,0x5e,0x03,0x11,0x40,0x1d,
+0x02,0x32,0xe4,0x00,0x08,0x93,0x03,0x12,0x8b,0x92,0x03,0x41,0xc2,0x22,0x22,0x33,
+0xae,0x01,0x28,0xff,0xe8,0x9b,0x04,0xf3,0x03,0x04,0x10,0xcd,0xdd,0xdd,0xeb,0x00,
+0xc6,0x03,0x44,0x44,0x53,0x10,0x0c,0x60,0x0c,0x40,0x1f,0x7c,0x00,0x20,0x02,0x2d,
+0x7c,0x00,0x30,0x05,0xff,0xf6,0x0d,0x00,0x00,0x7c,0x00,0x00,0xd5,0x02,0xe3,0xc6,
+0x0c,0xfd,0xdd,0xfe,0xe0,0x0c,0x50,0x34,0x43,0x33,0x20,0x00,0xc5,0x3c,0x01,0x30,
+0x00,0x4d,0xdd,0xa1,0x05,0xf1,0x00,0x07,0xd5,0x44,0x44,0x4f,0x40,0x00,0x7c,0x00,
+0x00,0x00,0xe4,0x00,0x07,0xc0,0x89,0x00,0x11,0x8c,0x0d,0x00,0xc2,0x06,0xfc,0xbb,
+0xcc,0xcf,0x30,0x00,0x04,0x55,0x54,0x44,0x20,0x6e,0x05,0xf0,0x06,0x83,0x07,0x77,
+0x77,0x87,0x04,0xd0,0xd5,0x1a,0xbb,0xba,0xa8,0x04,0xd0,0xd4,0x00,0x30,0x03,0x10,
+0x04,0xd0,0x45,0x01,0x10,0x60,0x07,0x00,0x14,0xd5,0x07,0x00,0x30,0x50,0x47,0xe0,
+0x07,0x00,0x31,0x53,0xcd,0xe0,0x0e,0x00,0x63,0x04,0xe0,0xd4,0x00,0xc5,0x0d,0x07,
+0x00,0xe1,0x40,0x04,0xe0,0xd4,0x05,0xd9,0x6e,0x97,0x04,0xd0,0xd4,0x0a,0xbb,0xaa,
+0x46,0x00,0x00,0xcf,0x00,0x27,0xd0,0xd5,0x07,0x00,0x22,0x05,0xc0,0x0e,0x00,0x22,
+0xa0,0xc5,0xed,0x00,0x02,0x96,0x02,0xf1,0x0d,0x20,0x42,0x0a,0xbb,0xbc,0xcb,0x04,
+0xd0,0xb8,0x05,0x66,0x66,0x54,0x04,0xe0,0xb8,0x00,0xd2,0x0d,0x30,0x04,0xe0,0xa8,
+0x00,0xf3,0x0e,0x42,0x58,0x07,0x00,0x21,0x35,0xcd,0x07,0x00,0x01,0x15,0x00,0xf1,
+0x05,0xe3,0x0e,0x20,0x04,0xf0,0xa8,0x0a,0xfb,0xaf,0xcc,0x04,0xf0,0xa8,0x06,0x66,
+0x65,0x42,0x03,0xe0,0xb7,0x46,0x00,0x20,0x40,0x53,0x66,0x05,0x93,0x55,0x56,0x50,
+0x00,0x01,0xcc,0xcc,0xcc,0xbb,0xdb,0x04,0x0f,0x07,0x00,0x09,0x12,0xb2,0x03,0x03,
+0xf0,0x05,0x12,0xbb,0xbb,0xbc,0xc4,0x00,0xe5,0x16,0x66,0x66,0x55,0x10,0x0d,0x50,
+0x0a,0x30,0x1d,0x05,0xbb,0xf5,0xe0,0x01,0x31,0x26,0x6e,0x50,0x64,0x01,0x10,0xd5,
+0x0d,0x00,0x11,0x36,0x0d,0x00,0xf5,0x01,0x05,0xaa,0xf4,0x03,0xd6,0x36,0xf5,0x50,
+0x0d,0x44,0xdd,0xdc,0xcb,0xb9,0x00,0xd4,0xe0,0x01,0x01,0x57,0x01,0x97,0x02,0xf0,
+0x00,0x00,0x0b,0x20,0x00,0x3f,0x10,0xd1,0x06,0x12,0x3f,0xec,0x05,0x60,0xfe,0xee,
+0xee,0xff,0x80,0x00,0x50,0x02,0x02,0x79,0x03,0xf0,0x06,0x06,0x10,0xab,0xbb,0xbb,
+0xca,0x00,0xe4,0x05,0x66,0x66,0x65,0x20,0x0e,0x40,0x0c,0x40,0x0d,0x07,0xff,0xf4,
+0xd9,0x01,0x40,0x13,0x3e,0x40,0x0d,0xf3,0x01,0x10,0xe4,0x0d,0x00,0xf0,0x04,0x6b,
+0xbf,0x40,0x0c,0x40,0x2f,0x02,0x44,0xf4,0x5e,0xff,0xef,0xff,0xe0,0x0e,0x40,0x22,
+0x22,0x11,0x1a,0x00,0x01,0x70,0x06,0x60,0x10,0x00,0x00,0x4a,0xdc,0xa5,0xcc,0x06,
+0xa1,0x74,0x47,0xea,0x00,0x00,0x1f,0x50,0x00,0x02,0xf2,0x75,0x00,0xf0,0x05,0x0e,
+0x50,0x00,0x2f,0x30,0x00,0x01,0xf3,0x00,0x00,0xae,0x52,0x25,0xdc,0x00,0x00,0x00,
+0x7d,0xee,0xc7,0x9e,0x03,0x30,0x11,0x11,0x11,0x9d,0x07,0x00,0x86,0x07,0x70,0x00,
+0x00,0x00,0x53,0x00,0x08,0x10,0xcc,0x06,0x50,0x60,0x00,0xe3,0x00,0x00,0x62,0x02,
+0x22,0x0e,0x30,0x0f,0x00,0x01,0x5f,0x00,0x10,0xc7,0xd5,0x00,0x20,0x00,0x0c,0x2d,
+0x00,0x11,0xf8,0xae,0x05,0x21,0x11,0x11,0xd4,0x00,0x13,0x90,0xe6,0x05,0x12,0x00,
+0xc5,0x00,0xd1,0xd0,0x00,0x00,0x00,0x24,0x44,0x44,0x9d,0x44,0x44,0x44,0x09,0xdd,
+0x01,0x00,0x11,0xd2,0x69,0x00,0x50,0x21,0x00,0x00,0x07,0xff,0x17,0x04,0x61,0x00,
+0x00,0x00,0x63,0x00,0x0a,0x35,0x07,0x21,0x70,0x00,0xf0,0x06,0x61,0xc8,0x00,0x1f,
+0x32,0x00,0x00,0x0f,0x08,0x15,0xe3,0xf0,0x07,0x82,0x11,0x00,0x04,0xe0,0x01,0x11,
+0x20,0x6f,0xb5,0x06,0x04,0x36,0x06,0x00,0x8a,0x04,0x97,0x44,0x54,0x00,0x00,0x03,
+0xde,0xee,0xdd,0xdd,0x2e,0x08,0x42,0x12,0x22,0x23,0x36,0x3d,0x06,0x63,0xee,0xeb,
+0x00,0x00,0x03,0xf1,0x1a,0x00,0x12,0x42,0x3d,0x06,0x12,0xef,0x3d,0x06,0x03,0xf0,
+0x00,0x01,0x69,0x00,0x11,0xf3,0xf0,0x00,0x10,0x07,0xf0,0x00,0x22,0x0b,0x70,0xb5,
+0x01,0x4d,0xb7,0x00,0x0d,0x40,0x0f,0x00,0x01,0xf0,0x00,0x12,0xf9,0xf0,0x00,0x10,
+0x10,0x1a,0x02,0x30,0x40,0x00,0x72,0x1e,0x00,0x40,0xb8,0x00,0x0e,0x50,0x2d,0x00,
+0xd2,0x80,0x00,0xe5,0x00,0x00,0x14,0x44,0xca,0x44,0x4e,0x74,0x44,0x07,0xf0,0x00,
+0x14,0xd1,0xac,0x00,0x01,0x3c,0x00,0x81,0xf0,0x00,0x00,0x02,0x21,0x11,0x13,0x10,
+0x52,0x04,0x22,0x00,0xf0,0x6b,0x02,0x22,0x1f,0x10,0x71,0x07,0x10,0xf1,0xe9,0x00,
+0x41,0xe5,0x11,0x2f,0x32,0xca,0x07,0x3c,0xff,0xff,0xe5,0x95,0x08,0x20,0x7c,0xcc,
+0x3c,0x07,0x71,0xee,0x02,0x55,0x55,0x58,0xf4,0x44,0x99,0x03,0x03,0x2b,0x09,0x04,
+0x20,0x07,0x0b,0x0f,0x00,0x13,0x4e,0x38,0x00,0x02,0xc3,0x03,0x02,0xf0,0x00,0x10,
+0x0d,0x5a,0x00,0x72,0xe0,0x00,0x00,0x00,0x71,0x00,0x09,0xe9,0x07,0x29,0x01,0xf1,
+0x87,0x00,0x08,0x0f,0x00,0xef,0x0c,0xdf,0xdd,0xdd,0xfe,0xe5,0x00,0x00,0x34,0x44,
+0x44,0x33,0x32,0x00,0x01,0x00,0x04,0x30,0x9e,0xef,0xff,0x1e,0x08,0x8f,0x21,0x33,
+0x33,0x32,0x22,0x33,0x33,0x30,0xe0,0x01,0x07,0x02,0x5a,0x00,0x16,0xc7,0xe0,0x01,
+0x15,0xe2,0x44,0x00,0x46,0x21,0x11,0x00,0x00,0xe0,0x01,0x18,0x10,0xe0,0x01,0x1a,
+0x43,0xe0,0x01,0x21,0x4f,0x00,0x40,0x05,0x31,0x37,0xf0,0x00,0x4b,0x07,0x17,0xdb,
+0xfd,0x00,0x0e,0x1d,0x08,0xf1,0x03,0x0a,0x12,0x99,0x99,0x99,0xa7,0x00,0xf3,0x29,
+0xa9,0x99,0x98,0x60,0x0e,0x30,0x03,0x00,0x05,0x38,0x03,0x91,0x00,0xe3,0x00,0x0e,
+0x40,0x0d,0x40,0x0f,0x30,0x0d,0x00,0x2e,0xf3,0x00,0x0d,0x00,0x11,0x20,0x0d,0x00,
+0xf2,0x01,0xf2,0x00,0x0e,0x40,0x2d,0x62,0x2f,0x54,0x10,0xe4,0x4e,0xee,0xee,0xdd,
+0xc3,0x0e,0x14,0x09,0x02,0x5f,0x03,0x09,0x0d,0x00,0x27,0x0d,0x40,0xad,0x04,0xf1,
+0x03,0x05,0x11,0xbb,0xbb,0xbb,0xc6,0x00,0xe4,0x06,0x66,0x66,0x65,0x10,0x0e,0x40,
+0x0a,0x30,0x1d,0x75,0x00,0x21,0x02,0xf0,0x5b,0x00,0x1c,0x2f,0x0d,0x00,0x61,0x03,
+0xd6,0x35,0xf4,0x50,0x0e,0x2f,0x04,0x13,0x10,0x5b,0x00,0x11,0x30,0x2f,0x04,0x11,
+0xe3,0x2f,0x04,0x1f,0x0d,0x2f,0x04,0x13,0x0f,0x91,0x06,0x06,0x01,0x08,0x06,0x02,
+0x22,0x06,0x04,0x91,0x06,0x12,0x23,0x91,0x06,0x13,0xc2,0x91,0x06,0x1f,0x82,0x91,
+0x06,0x2d,0x21,0x08,0x30,0x91,0x06,0x11,0xd6,0x91,0x06,0x12,0x0d,0x91,0x06,0x11,
+0xd6,0x7c,0x00,0x38,0x0d,0x60,0x0d,0x0d,0x00,0xd1,0x0c,0x40,0x2f,0x01,0x00,0xd5,
+0x4e,0xff,0xef,0xff,0xf2,0x0d,0x50,0x43,0x03,0x12,0xd5,0x27,0x04,0x50,0x20,0x00,
+0x00,0x4a,0xcc,0xab,0x04,0x41,0x7f,0x74,0x46,0xdb,0xab,0x04,0x21,0x01,0xf4,0xf1,
+0x00,0x20,0x0c,0x60,0xab,0x04,0x21,0x00,0xe5,0xab,0x04,0x11,0xcd,0xab,0x04,0x30,
+0xc8,0x10,0x00,0x6b,0x04,0x72,0x16,0x00,0x00,0x00,0xaf,0xfe,0xd1,0xe4,0x02,0x41,
+0x12,0x10,0x00,0x4e,0x69,0x04,0xb1,0x44,0x30,0x4e,0x00,0x00,0x8c,0xcc,0xcc,0xcc,
+0xc0,0x4f,0x57,0x02,0x02,0x30,0x02,0x31,0x2d,0xef,0xa0,0x08,0x00,0x80,0xe7,0x00,
+0xc8,0x00,0x3f,0x22,0x20,0x04,0x9e,0x08,0x70,0x3f,0xff,0xf2,0x07,0xa0,0x00,0x1f,
+0x50,0x01,0x04,0x08,0x00,0x10,0x05,0xce,0x08,0x00,0x60,0x01,0x31,0xd8,0x13,0xe6,
+0x08,0x00,0x34,0x1b,0xfe,0x70,0x7e,0x0c,0x0f,0x08,0x00,0x06,0x16,0x05,0x08,0x01,
+0xf1,0x06,0x0b,0xec,0xb6,0x00,0x08,0x40,0x00,0x00,0x02,0x44,0x20,0x00,0xb7,0x00,
+0x02,0x44,0x44,0x44,0x31,0x0b,0x80,0x8e,0x00,0x70,0x50,0xb8,0x00,0x00,0x01,0x68,
+0x50,0x21,0x04,0xf0,0x06,0x02,0xe8,0x5a,0xc0,0x00,0xa9,0x22,0x10,0xa8,0x00,0x0d,
+0x40,0x0a,0xff,0xfd,0x0b,0x60,0x00,0xb6,0x00,0xa8,0x62,0x01,0xb0,0x1f,0x30,0x0a,
+0x80,0x00,0x00,0xbe,0xdf,0x80,0x00,0xa8,0xd2,0x00,0x46,0x00,0x00,0x09,0x60,0x3c,
+0x0c,0x12,0xff,0xf0,0x0b,0x53,0x02,0x22,0x22,0x21,0xe6,0x3c,0x09,0x03,0x1e,0x00,
+0x13,0xd5,0xa1,0x0b,0x03,0x0a,0x0c,0xf2,0x02,0x92,0x00,0x00,0x00,0x67,0x55,0x30,
+0x00,0x17,0x00,0x00,0x00,0x48,0xaa,0x70,0x00,0x5e,0x35,0x00,0x00,0x1f,0x01,0x60,
+0x9e,0xee,0xee,0xee,0x60,0x4e,0x3d,0x02,0x12,0x31,0x1b,0x04,0x30,0xad,0xad,0x70,
+0x08,0x00,0xf0,0x05,0x06,0xc0,0x01,0xe2,0x00,0x4f,0x66,0x50,0x0a,0x80,0x00,0xb6,
+0x00,0x4f,0xcc,0xb0,0x09,0x90,0x00,0xc5,0x2f,0x01,0x41,0x04,0xe2,0x04,0xe1,0x37,
+0x01,0x32,0x7f,0xfe,0x40,0x67,0x01,0x12,0x10,0x38,0x00,0x22,0x06,0x30,0x08,0x00,
+0x00,0x05,0x0d,0x17,0x2a,0x8b,0x00,0x04,0x08,0x00,0xd1,0x0c,0xec,0xcc,0xcc,0xcc,
+0x10,0x00,0x00,0x02,0x55,0x55,0x55,0x54,0xbd,0x05,0x02,0x01,0x00,0x53,0xaf,0xfe,
+0x90,0x00,0x17,0x4e,0x0b,0x11,0x5e,0x90,0x00,0x31,0xed,0x60,0x5e,0x4d,0x05,0x11,
+0x22,0x50,0x00,0x21,0x7e,0xfd,0x68,0x00,0xa0,0x05,0xe4,0x16,0xf1,0x00,0x4f,0xff,
+0xe0,0x0b,0x70,0x88,0x00,0x61,0x33,0x10,0x0b,0x60,0x00,0xc5,0xa8,0x00,0x51,0xd1,
+0x04,0xf2,0x00,0x3e,0x28,0x00,0x11,0x50,0x08,0x00,0x04,0x99,0x0b,0x21,0x4e,0xff,
+0x61,0x0c,0x00,0x3c,0x0c,0x22,0x22,0x6e,0x77,0x0d,0x01,0x08,0x00,0x00,0xa9,0x02,
+0x10,0xfb,0x08,0x00,0x03,0x2c,0x00,0xe6,0x5f,0x32,0x33,0x34,0x44,0x10,0x00,0x00,
+0x2c,0xee,0xed,0xdd,0xdc,0x30,0xb8,0x01,0x62,0xae,0xcb,0x80,0x00,0x39,0x00,0xb8,
+0x01,0x11,0x5e,0x47,0x02,0x42,0x43,0x10,0x5e,0x00,0xb9,0x01,0x10,0x4e,0xbb,0x0b,
+0x11,0xa7,0x5f,0x02,0x40,0x02,0xe6,0x27,0xd0,0x98,0x00,0xc0,0x09,0x90,0x00,0xb5,
+0x00,0x4f,0x33,0x20,0x0b,0x70,0x00,0xa6,0x18,0x00,0x41,0x07,0xc0,0x01,0xe4,0xc0,
+0x00,0x31,0xbf,0xde,0x80,0x08,0x00,0x22,0x01,0x20,0x17,0x02,0x00,0xad,0x0d,0x22,
+0x20,0x00,0xcd,0x05,0x10,0xfe,0x53,0x0b,0x12,0x41,0xc7,0x0a,0x00,0x5b,0x0b,0x17,
+0x3e,0x08,0x00,0x50,0x0f,0xdc,0xcc,0xcc,0xee,0xc0,0x00,0x5a,0x55,0x55,0x54,0x42,
+0x00,0x98,0x00,0x1b,0x2a,0x98,0x00,0x2e,0x4e,0x00,0x98,0x00,0x72,0xe5,0x16,0xd0,
+0x00,0x4f,0xdd,0xc0,0x98,0x00,0x2f,0x55,0x40,0x98,0x00,0x02,0x18,0x3e,0x98,0x00,
+0x00,0x54,0x00,0x02,0x68,0x04,0x20,0x00,0x1f,0x80,0x00,0x43,0x63,0x33,0x33,0x5f,
+0x3f,0x0e,0x13,0xef,0x77,0x0b,0x10,0x2f,0x08,0x00,0xe0,0x52,0x22,0x22,0x4f,0x00,
+0x00,0x00,0x0a,0xdd,0xee,0xdd,0xd9,0x00,0x00,0x14,0x00,0x01,0x00,0xf0,0x04,0xbe,
+0xcb,0x70,0x00,0x29,0x00,0x00,0x00,0x02,0x44,0x20,0x00,0x4e,0x00,0x00,0x14,0x44,
+0x43,0x33,0x08,0x00,0xf0,0x15,0x8c,0xcc,0xcc,0xcc,0x50,0x4f,0x00,0x00,0x00,0x5b,
+0xda,0x20,0x00,0x4f,0x00,0x00,0x04,0xe5,0x37,0xe0,0x00,0x4f,0xff,0xe0,0x0a,0x70,
+0x00,0xd4,0x00,0x4f,0x33,0x20,0x0a,0x70,0x00,0xc5,0x18,0x00,0x40,0x06,0xc0,0x03,
+0xf2,0x30,0x00,0x41,0x00,0x9f,0xef,0x60,0x08,0x00,0x51,0x00,0x20,0x00,0x00,0x3d,
+0x5a,0x00,0x30,0x23,0x20,0x01,0x07,0x00,0xf0,0x0c,0x8f,0xed,0xef,0xa1,0x00,0x00,
+0x00,0x09,0xd2,0x00,0x01,0xbb,0x00,0x00,0x00,0x0e,0x60,0x00,0x00,0x3f,0x00,0x00,
+0x00,0x0d,0x70,0x00,0x00,0x60,0x00,0x50,0x06,0xf7,0x32,0x37,0xe9,0x28,0x00,0xf0,
+0x17,0x4a,0xdd,0xca,0x50,0x00,0x00,0x00,0x21,0x00,0x00,0x03,0x00,0x07,0x00,0xbf,
+0xfe,0x60,0x0f,0x20,0x3e,0x00,0x00,0x11,0x00,0x0f,0x20,0x3e,0x39,0x99,0x99,0x87,
+0x0f,0x20,0x3e,0x37,0x77,0x77,0x77,0x15,0x00,0xf0,0x1e,0x04,0x63,0x00,0x0e,0x20,
+0x3e,0x00,0x9d,0xae,0x70,0x0e,0x20,0x3e,0x03,0xf1,0x04,0xf0,0x0e,0x42,0x5e,0x07,
+0xb0,0x00,0xe3,0x0e,0xff,0xfe,0x08,0x90,0x00,0xc4,0x0e,0x20,0x3e,0x07,0xa0,0x00,
+0xd3,0x0e,0x20,0x3e,0x04,0xe0,0x02,0xf1,0x2a,0x00,0x30,0xcc,0x7d,0x90,0x07,0x00,
+0x21,0x07,0x85,0x38,0x00,0x25,0x00,0x00,0x07,0x00,0x13,0x30,0x0e,0x00,0x12,0x3f,
+0x0c,0x01,0xf2,0x38,0x04,0x00,0x28,0x54,0x20,0x02,0x00,0x12,0x00,0x17,0xab,0x70,
+0x0c,0x60,0x8a,0x03,0x44,0x44,0x43,0x0c,0x70,0x8a,0x0b,0xcc,0xcc,0xcc,0x4c,0x70,
+0x7b,0x00,0x05,0x97,0x10,0x0c,0x70,0x7b,0x00,0xaa,0x58,0xe1,0x0c,0xff,0xfa,0x02,
+0xf0,0x00,0xb7,0x0c,0x71,0x7a,0x03,0xe0,0x00,0x97,0x0c,0x70,0x7a,0x00,0xe5,0x02,
+0xe3,0x0c,0x60,0x7a,0x00,0x3c,0xfd,0x60,0x0b,0x50,0x7a,0x4d,0x00,0x10,0x34,0xd4,
+0x00,0xf5,0x1d,0xcc,0xa5,0x00,0x00,0x00,0x08,0xf8,0x44,0x8e,0xa0,0x00,0x00,0x3f,
+0x40,0x00,0x02,0xf4,0x00,0x00,0x6e,0x00,0x00,0x00,0xc6,0x00,0x00,0x4f,0x10,0x00,
+0x01,0xf4,0x00,0x00,0x0b,0xd5,0x22,0x5d,0xc0,0x00,0x00,0x00,0x7c,0xed,0xb7,0x93,
+0x01,0x64,0x0b,0xec,0xb7,0x00,0x01,0x70,0x93,0x01,0xf0,0x08,0x05,0x88,0x88,0x88,
+0x73,0x04,0xe1,0x10,0x59,0x99,0x99,0x99,0x40,0x4f,0xff,0xd0,0x05,0xbd,0xa2,0x00,
+0x04,0xe1,0x10,0x91,0x01,0x00,0x71,0x01,0x71,0xa7,0x00,0x0d,0x40,0x03,0xe0,0x00,
+0x90,0x01,0xa5,0x3f,0xff,0xc0,0x6c,0x00,0x3f,0x20,0x03,0xe1,0x10,0x8f,0x01,0x56,
+0x02,0x00,0x00,0x03,0xe0,0x8e,0x01,0x56,0x08,0xfe,0xde,0xfa,0x10,0x8d,0x01,0x56,
+0xe6,0x00,0x00,0x03,0xf0,0x8c,0x01,0x56,0x6f,0x73,0x23,0x7e,0x90,0x8b,0x01,0xc1,
+0x16,0x32,0x10,0x00,0x01,0x90,0x02,0xad,0xee,0x80,0x00,0x3e,0x99,0x00,0xf2,0x3a,
+0x02,0xe1,0xbb,0xbb,0xbb,0xbb,0x60,0x2e,0x05,0x55,0x55,0x55,0x52,0x02,0xe0,0x00,
+0x17,0x96,0x00,0x00,0x2e,0x00,0x1d,0xa7,0xcb,0x00,0x02,0xe0,0x08,0xb0,0x00,0xe3,
+0x00,0x2e,0x00,0xd4,0x00,0x09,0x89,0xdd,0xe0,0x0f,0x20,0x00,0x89,0x35,0x7e,0x00,
+0xe3,0x00,0x09,0x90,0x02,0xe0,0x0b,0x80,0x00,0xd5,0x00,0x2e,0x00,0x3f,0x74,0xbd,
+0x00,0x02,0xf0,0x00,0x3a,0xc8,0x10,0x00,0x2f,0x4e,0x00,0x11,0xe0,0x07,0x00,0x18,
+0x2e,0x0d,0x00,0x04,0x01,0x00,0xf1,0x38,0x04,0xfc,0xbb,0x10,0x00,0x74,0x00,0x01,
+0x34,0x30,0x00,0x0b,0x70,0x34,0x44,0x43,0x32,0x00,0xb7,0x1c,0xcc,0xcc,0xcc,0xb0,
+0x0b,0x70,0x00,0x59,0x82,0x00,0x00,0xb7,0x00,0x8d,0x78,0xf3,0x00,0x0b,0x70,0x1f,
+0x20,0x07,0xa3,0xfe,0xf7,0x03,0xe0,0x00,0x4d,0x02,0x3c,0x70,0x1f,0x00,0x06,0xc0,
+0x00,0xb7,0x00,0xb9,0x23,0xd6,0x00,0x0b,0x60,0x01,0x9e,0xd7,0x00,0x00,0xb6,0x4c,
+0x00,0xf5,0x19,0x01,0x00,0x00,0x3e,0xff,0xff,0xff,0xf3,0x00,0x05,0xf3,0x33,0x22,
+0x2e,0x50,0x00,0x5e,0x00,0x00,0x00,0xe5,0x00,0x05,0xe0,0x00,0x00,0x0e,0x40,0x00,
+0x4f,0xcc,0xcc,0xcc,0xf3,0x00,0x00,0x34,0x44,0x44,0x43,0x7d,0x00,0x31,0x3f,0xdb,
+0xb3,0x80,0x01,0x50,0x34,0x30,0x00,0x04,0xf0,0x05,0x02,0x40,0x20,0x04,0xf0,0x2c,
+0x7e,0x00,0xf0,0x1d,0x04,0xf0,0x00,0x19,0xcc,0x80,0x00,0x04,0xf0,0x00,0xca,0x33,
+0xc9,0x00,0x04,0xe0,0x01,0xf0,0x00,0x3f,0x0e,0xff,0xe0,0x02,0xf0,0x00,0x2f,0x01,
+0x26,0xe0,0x00,0xe6,0x00,0x9c,0x00,0x04,0xe0,0x00,0x3d,0xef,0xd2,0x00,0x04,0xe0,
+0xbb,0x02,0x90,0x00,0x02,0xb0,0x00,0x00,0x00,0x03,0x43,0x10,0x7a,0x01,0xf0,0x00,
+0xfd,0xcd,0xfb,0x10,0x00,0x00,0x8e,0x30,0x00,0x1b,0xb0,0x00,0x00,0xd8,0x00,0x0c,
+0x01,0x30,0x00,0xc8,0x00,0x4d,0x00,0xc5,0x00,0x5f,0x82,0x12,0x6e,0x90,0x00,0x00,
+0x04,0xbe,0xed,0xb6,0x85,0x00,0xf0,0x2c,0x5e,0xbb,0x40,0x00,0x50,0x43,0x00,0x00,
+0x12,0x00,0x03,0xe0,0xb7,0x0d,0xee,0xee,0xed,0x23,0xe0,0xb7,0x01,0x22,0x32,0x22,
+0x03,0xe0,0xa7,0x00,0x4e,0xef,0x70,0x03,0xe0,0xa7,0x01,0xe3,0x03,0xf4,0xcd,0xe0,
+0xa7,0x04,0xc0,0x00,0xc7,0x46,0xe0,0xa8,0x03,0xd0,0x00,0xd5,0x03,0xe0,0xb7,0x00,
+0xe7,0x37,0xf1,0x07,0x00,0x52,0x2a,0xdb,0x30,0x03,0xe0,0x53,0x02,0xf1,0x05,0x30,
+0x32,0x00,0x00,0xaf,0xff,0xff,0xff,0xd2,0x00,0x00,0x13,0x32,0x22,0x22,0xe5,0x00,
+0x00,0x02,0x22,0x07,0x00,0x82,0xbf,0xff,0xff,0xff,0xe2,0x00,0x00,0xc9,0x71,0x00,
+0xf0,0x19,0xcb,0x22,0x22,0x33,0x32,0x00,0x00,0x7f,0xff,0xff,0xee,0xe9,0x00,0x16,
+0x42,0x20,0x00,0x02,0x70,0x00,0x2a,0xcd,0xc1,0x00,0x05,0xe0,0x01,0x11,0x11,0x11,
+0x00,0x05,0xe0,0x0e,0xff,0xff,0xff,0xc0,0x05,0xe0,0x51,0x01,0x00,0x3e,0x01,0xf0,
+0x05,0x1b,0xff,0xb1,0x0f,0xff,0xe0,0x00,0xba,0x00,0xca,0x01,0x16,0xe0,0x00,0xf1,
+0x00,0x4f,0x00,0x05,0xd0,0x0a,0x01,0xf0,0x0d,0x00,0x05,0xd0,0x00,0xf2,0x00,0x5e,
+0x1f,0xff,0xd0,0x00,0x9b,0x34,0xd7,0x02,0x37,0xd0,0x00,0x08,0xdc,0x70,0x00,0x05,
+0xc0,0x00,0x00,0x10,0x00,0xa2,0x01,0x92,0x01,0xf2,0x00,0x00,0x03,0x70,0x00,0x02,
+0xf2,0xf8,0x01,0x12,0xf2,0xa4,0x01,0xc3,0xfd,0xbb,0xbb,0xcd,0xd3,0x00,0x00,0x46,
+0x55,0x55,0x55,0x40,0x02,0x01,0x62,0x03,0xfd,0xbb,0x30,0x00,0x29,0x87,0x01,0xf0,
+0x1f,0xe0,0x89,0x99,0x99,0x97,0x00,0x4e,0x08,0x88,0x88,0x89,0x70,0x04,0xe0,0x00,
+0x38,0x72,0x00,0xcc,0xde,0x00,0x7e,0x88,0xe5,0x04,0x58,0xe0,0x0f,0x30,0x05,0xe0,
+0x00,0x4e,0x02,0xf0,0x00,0x1f,0x01,0x15,0xe0,0x0f,0x20,0x04,0xf0,0xff,0xfe,0x79,
+0x00,0x90,0x00,0x15,0xe0,0x00,0x8c,0xc7,0x00,0x00,0x4d,0x5e,0x00,0x10,0x21,0xcf,
+0x01,0xf1,0x1b,0x7e,0xff,0xfd,0x80,0x00,0x00,0x9e,0x40,0x00,0x4e,0x80,0x00,0x0f,
+0x50,0x00,0x00,0x5d,0x00,0x00,0xf6,0x00,0x00,0x07,0xd0,0x00,0x06,0xf8,0x43,0x49,
+0xf5,0x00,0x00,0x04,0xac,0xdb,0x93,0x00,0x00,0x00,0x26,0x32,0x21,0x7e,0x00,0x30,
+0xac,0xdd,0xa0,0x3b,0x00,0x20,0x11,0x11,0xbe,0x01,0x00,0xfc,0x00,0x26,0xff,0xf6,
+0xa0,0x02,0x40,0x05,0xcf,0xfe,0x91,0x07,0x00,0x30,0xe4,0x00,0x1a,0xbe,0x03,0xc1,
+0xc7,0x00,0x00,0x1f,0x10,0x00,0x00,0x0c,0x60,0x00,0x02,0xf1,0x48,0x03,0x21,0x35,
+0xd9,0xd3,0x04,0x22,0xcd,0xb5,0xde,0x00,0x12,0x50,0x36,0x00,0x01,0x20,0x05,0x91,
+0x22,0x22,0x25,0xe1,0x11,0x11,0x10,0x7f,0xff,0x01,0x00,0x15,0x20,0x53,0x00,0x13,
+0x02,0xfa,0x02,0x32,0xef,0xfe,0xc0,0x35,0x00,0x00,0x78,0x00,0x10,0x07,0x24,0x00,
+0x00,0x31,0x01,0x40,0x22,0x34,0x32,0x32,0x71,0x00,0x30,0xee,0xdf,0xa1,0x9d,0x00,
+0x51,0xf4,0x00,0x1b,0xa0,0x00,0xc3,0x00,0x10,0x5d,0x2b,0x00,0x40,0xe9,0x43,0x5d,
+0x80,0x08,0x00,0x31,0x8c,0xfa,0x50,0xe5,0x01,0xf2,0x0a,0x7d,0x22,0x23,0x33,0x07,
+0xde,0xee,0xee,0xee,0xee,0xdd,0xd1,0x00,0x02,0x22,0x23,0x33,0x54,0x00,0x00,0x05,
+0xff,0xff,0xfe,0xee,0x66,0x03,0x00,0x03,0x03,0x20,0x03,0xef,0xcf,0x01,0x50,0x00,
+0x00,0x5f,0x22,0x22,0xe2,0x00,0xef,0x05,0xf3,0x22,0x23,0x33,0x40,0x00,0x00,0x2e,
+0xff,0xff,0xff,0xed,0x40,0x8f,0x00,0x0d,0x50,0x02,0x22,0x33,0x22,0x22,0x8f,0x00,
+0x4e,0xde,0xef,0x90,0x00,0x8f,0x00,0x40,0xe8,0x32,0x4d,0x80,0x43,0x00,0x31,0x9d,
+0xfb,0x60,0x3c,0x00,0x11,0x5d,0x3b,0x00,0xd0,0xfe,0xef,0xfe,0xef,0xff,0xf1,0x01,
+0x22,0x22,0x22,0x22,0x21,0x11,0x6f,0x01,0x20,0xdc,0x82,0x18,0x03,0xf0,0x0c,0xe7,
+0x43,0x5a,0xe2,0x00,0x00,0x00,0xf5,0x00,0x00,0x0a,0x90,0x00,0x00,0x0f,0x30,0x00,
+0x00,0xaa,0x00,0x00,0x00,0xad,0x52,0x23,0x8f,0x40,0x18,0x05,0x30,0xde,0xd9,0x30,
+0x95,0x01,0xc1,0x43,0x30,0x00,0x03,0x00,0x00,0x00,0x2a,0xcc,0xc2,0x00,0x1f,0x96,
+0x01,0x10,0x11,0x72,0x01,0x70,0x3f,0xff,0xff,0xff,0xe0,0x1f,0x10,0x56,0x01,0x02,
+0x82,0x01,0x30,0x3e,0xee,0xd3,0x08,0x00,0x70,0x01,0xe6,0x00,0x7d,0x00,0x1f,0x10,
+0x87,0x03,0xf1,0x02,0x0f,0x10,0x1f,0x65,0x40,0x03,0xf0,0x00,0x1f,0x00,0x1f,0xdd,
+0xc1,0x00,0xca,0x33,0xba,0x28,0x00,0x41,0x19,0xdd,0x80,0x00,0x38,0x00,0x12,0x31,
+0x38,0x00,0x00,0x2b,0x04,0x00,0x38,0x00,0x60,0x11,0xc8,0x24,0x67,0x1f,0x10,0x05,
+0x03,0x42,0xed,0xb7,0x1f,0x10,0x03,0x01,0x04,0x08,0x00,0x13,0x0f,0x08,0x00,0x10,
+0x06,0xdb,0x00,0x03,0x0c,0x00,0x54,0x0c,0xff,0xf3,0x00,0x0b,0x20,0x00,0xf0,0x00,
+0x30,0x00,0x1e,0xff,0xff,0xfe,0xe2,0x0f,0x30,0x00,0x01,0x11,0x22,0x11,0x10,0xcb,
+0x00,0x40,0x3d,0xff,0xe5,0x00,0x10,0x00,0xc0,0xe7,0x00,0x5f,0x10,0x0f,0x63,0x20,
+0x03,0xf0,0x00,0x0f,0x20,0x36,0x03,0xb1,0xe6,0x12,0x7e,0x00,0x0f,0x40,0x00,0x00,
+0x3b,0xef,0xa2,0xf3,0x00,0xf0,0x01,0x00,0x8a,0x01,0x33,0x0f,0x30,0x00,0x6e,0xee,
+0xff,0xff,0xd9,0x0f,0x30,0x00,0x02,0x84,0x02,0x50,0x09,0x10,0x00,0x00,0x01,0x2d,
+0x01,0x04,0x80,0x02,0x04,0x90,0x00,0x1f,0x20,0x08,0x00,0x03,0x12,0x0b,0xec,0x04,
+0x01,0x01,0x00,0x50,0x0d,0xfe,0xd3,0x00,0x05,0x09,0x00,0x20,0x12,0x20,0x68,0x00,
+0xf0,0x10,0x0b,0xbc,0xcc,0xcb,0xb2,0x0e,0x40,0x00,0x05,0x66,0x66,0x66,0x61,0x0e,
+0x40,0x00,0x00,0x18,0xdd,0xa2,0x00,0x0d,0x40,0x00,0x00,0xd9,0x22,0x8e,0x00,0x0d,
+0x40,0x05,0x06,0xf0,0x0a,0x0e,0x30,0x0d,0x73,0x30,0x01,0xf2,0x00,0x1f,0x10,0x0d,
+0xff,0xe1,0x00,0x7e,0x99,0xe7,0x00,0x0d,0x50,0x00,0x00,0x02,0xbc,0x20,0x08,0x00,
+0xd0,0x01,0x11,0x9b,0x34,0x67,0x0d,0x50,0x00,0x6f,0xff,0xfe,0xdb,0x96,0x18,0x00,
+0x00,0x0e,0x02,0x22,0x0d,0x50,0xb3,0x01,0x10,0x04,0x7c,0x00,0x00,0x07,0x02,0x07,
+0x08,0x00,0x50,0x0a,0xfe,0xee,0xee,0xef,0xfd,0x01,0x4b,0x33,0x33,0x33,0x33,0x98,
+0x00,0x22,0x07,0x10,0x4f,0x02,0x00,0x30,0x01,0x40,0xee,0xee,0xee,0xd3,0x20,0x01,
+0x40,0x22,0x33,0x22,0x20,0x10,0x01,0x60,0x6e,0xdd,0xe6,0x00,0x0f,0x40,0x16,0x04,
+0x70,0x2f,0x10,0x0e,0xa7,0x70,0x02,0xf1,0x08,0x00,0x80,0xb9,0x80,0x00,0x7e,0xdd,
+0xf7,0x00,0x0e,0x46,0x03,0x20,0x9a,0x00,0x08,0x00,0xe0,0x02,0x22,0x9b,0x35,0x77,
+0x0e,0x50,0x00,0x6e,0xee,0xed,0xcb,0x85,0x0d,0x28,0x02,0x40,0x11,0x11,0x12,0x24,
+0x60,0x00,0x53,0xff,0xff,0xff,0xef,0x60,0x6c,0x00,0xf0,0x02,0x60,0x00,0x00,0x0a,
+0xee,0xff,0xff,0xff,0x50,0x00,0x00,0x0d,0x92,0x22,0x11,0x11,0x00,0x08,0x00,0xca,
+0x12,0x22,0x33,0x20,0x00,0x00,0x08,0xff,0xff,0xff,0xee,0xa0,0x98,0x00,0x20,0x08,
+0x10,0xd9,0x01,0x10,0x20,0x98,0x00,0xd0,0x0c,0xcc,0xcc,0xcc,0xb1,0x0f,0x30,0x00,
+0x04,0x44,0x44,0x44,0x40,0x30,0x01,0x40,0x2b,0xef,0xc3,0x00,0x08,0x00,0x30,0xe7,
+0x00,0x5f,0x08,0x00,0x01,0xc8,0x01,0x80,0x0e,0xb8,0x80,0x00,0xf6,0x12,0x7e,0x00,
+0xa0,0x00,0x00,0xc8,0x01,0x01,0xa0,0x00,0xf0,0x05,0x8a,0x00,0x12,0x0e,0x50,0x00,
+0x5c,0xcc,0xef,0xdf,0xea,0x0e,0x50,0x00,0x13,0x43,0x32,0x10,0x00,0x0b,0xe0,0x01,
+0x40,0x18,0xcd,0xcb,0x70,0x5f,0x00,0x51,0xeb,0x54,0x46,0xdc,0x00,0x76,0x04,0x72,
+0x00,0x1f,0x30,0x00,0x00,0x08,0xd0,0xf3,0x02,0x50,0x02,0xea,0x43,0x36,0xdd,0x89,
+0x00,0x40,0x29,0xcd,0xca,0x60,0x64,0x02,0xb0,0x53,0x30,0x00,0x01,0x30,0x01,0x9b,
+0xcc,0x40,0x00,0x5c,0xed,0x02,0x30,0x10,0x05,0xc1,0xb0,0x03,0x20,0x30,0x5d,0x11,
+0x06,0xf1,0x1e,0x00,0x04,0xd0,0x02,0xce,0xde,0x50,0x00,0x4d,0x00,0xc9,0x00,0x4f,
+0x10,0x04,0xd0,0x1f,0x10,0x00,0xd4,0x00,0x4d,0x00,0xf2,0x00,0x0e,0x30,0x04,0xd0,
+0x09,0xc3,0x29,0xc0,0x00,0x4d,0x00,0x08,0xdd,0x91,0x00,0x04,0xd0,0x00,0x01,0x20,
+0x02,0x05,0x10,0x89,0x34,0x00,0xd1,0x11,0x09,0xa2,0x45,0x70,0x4d,0x0f,0xff,0xff,
+0xed,0xb8,0x04,0xd0,0xf6,0x00,0x12,0x4d,0xcc,0x04,0x02,0x0d,0x00,0x15,0x17,0xfb,
+0x04,0x12,0x04,0xfb,0x04,0x21,0x00,0x01,0xfb,0x04,0x10,0x0f,0x7b,0x02,0x19,0xf5,
+0xfb,0x04,0x13,0x90,0xfb,0x04,0x12,0xb0,0xcb,0x08,0x08,0xfb,0x04,0x29,0x6e,0x63,
+0xfb,0x04,0x40,0x0b,0x20,0x00,0xb2,0x08,0x00,0x11,0xf4,0xe6,0x00,0x73,0x22,0x2f,
+0x52,0x22,0xf5,0x22,0x20,0xfb,0x04,0x15,0x10,0x7f,0x01,0x52,0x05,0xff,0xdd,0x40,
+0x00,0xae,0x02,0x00,0x2a,0x0a,0xc0,0xcc,0xcc,0xcc,0xbb,0xb2,0x00,0x00,0x24,0x33,
+0x33,0x33,0x43,0x34,0x01,0x30,0x8b,0xca,0x40,0x65,0x04,0x30,0xf9,0x43,0x6d,0x43,
+0x01,0x21,0xb9,0x00,0x40,0x08,0x21,0x0b,0x70,0x42,0x07,0x50,0x00,0x6e,0x51,0x13,
+0xca,0x3b,0x00,0x36,0x6c,0xef,0xd8,0xa4,0x00,0x00,0xe8,0x06,0x80,0x33,0x33,0x44,
+0x07,0xee,0xee,0xef,0xfe,0x03,0x05,0x02,0x73,0x0a,0x12,0x00,0xee,0x08,0x1e,0x00,
+0x0f,0x00,0x12,0x18,0x82,0x05,0x13,0x53,0xff,0x00,0xf0,0x07,0xd8,0x00,0x01,0x50,
+0x04,0x66,0x66,0x66,0x62,0x05,0xe0,0x05,0x77,0x77,0x77,0x84,0x04,0xe0,0x00,0x06,
+0xbc,0xb5,0x4e,0x04,0xf0,0x03,0xac,0x42,0x4d,0x60,0x04,0xe0,0x00,0xc8,0x00,0x0a,
+0x80,0x04,0xe0,0x00,0x4e,0xcb,0xec,0x10,0xea,0x07,0x10,0x23,0x6a,0x04,0xc0,0x03,
+0x33,0x33,0x46,0x89,0x14,0xe0,0x3d,0xed,0xfe,0xcb,0x86,0x15,0x00,0x21,0x98,0x00,
+0x06,0x08,0xff,0x20,0x54,0x00,0x00,0x00,0x40,0x00,0x02,0xef,0xff,0xff,0xfc,0x70,
+0x00,0x00,0x23,0x32,0x22,0x26,0xe0,0x00,0x00,0x45,0x55,0x55,0x59,0xe0,0x00,0x02,
+0xfc,0xcc,0xcc,0xbb,0x70,0x00,0x02,0xf3,0x22,0x22,0x33,0x30,0x00,0x00,0xdf,0xff,
+0xff,0xee,0xe3,0x14,0x01,0x47,0x10,0x14,0x8b,0x03,0xd1,0x34,0x44,0x06,0xde,0xef,
+0xfe,0xee,0xfe,0xdd,0xc1,0x00,0x00,0xb8,0x82,0x04,0x76,0x00,0x0b,0x80,0x00,0xf4,
+0x00,0x00,0x0f,0x00,0x30,0x70,0x00,0xf3,0x0f,0x00,0x11,0x64,0x80,0x04,0x04,0x01,
+0x00,0x20,0x8f,0xee,0x26,0x0c,0x00,0x1e,0x03,0x80,0x04,0xe0,0x8b,0xcc,0xcc,0xbb,
+0x60,0x4e,0x20,0x01,0xf0,0x12,0x63,0x04,0xe0,0x00,0x7c,0xdc,0x50,0x00,0x4e,0x00,
+0x9c,0x31,0x4e,0x40,0x04,0xe0,0x0d,0x50,0x00,0x98,0x00,0x4e,0x00,0xa9,0x00,0x1d,
+0x50,0x04,0xe0,0x01,0xbe,0xee,0x70,0xf2,0x06,0x10,0x01,0x08,0x01,0xf1,0x00,0x33,
+0x33,0x45,0x68,0xa0,0x4e,0x1c,0xdd,0xdc,0xba,0x85,0x04,0xe0,0x00,0x12,0x0c,0x07,
+0x21,0x09,0xa0,0x1b,0x01,0x11,0x9a,0x61,0x00,0x22,0x09,0xa0,0x68,0x00,0xf2,0x09,
+0xfe,0xee,0xef,0xfd,0x00,0x00,0x23,0x33,0x33,0x22,0x10,0x00,0x05,0x21,0x00,0x00,
+0x02,0x80,0x02,0xbe,0xff,0x80,0x00,0x4e,0xaf,0x01,0x80,0xe1,0xaa,0xaa,0xaa,0xaa,
+0x50,0x3e,0x06,0x7c,0x00,0xf1,0x0c,0x03,0xe0,0x00,0x06,0x85,0x00,0x00,0x3e,0x00,
+0x1d,0xb8,0xda,0x00,0x03,0xe0,0x08,0xb0,0x01,0xe3,0x00,0x3e,0x00,0xd4,0x00,0x0a,
+0x70,0x03,0x80,0x0a,0x20,0x00,0x3e,0x80,0x0a,0xd0,0x70,0x03,0xe0,0x0b,0x70,0x00,
+0xe4,0x00,0x3e,0x00,0x4f,0x63,0xac,0x0b,0x0b,0x33,0x4b,0xd9,0x00,0xce,0x0a,0x12,
+0x03,0x0d,0x07,0x14,0x3e,0x80,0x0a,0x50,0x00,0x00,0x00,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -2700,11 +3154,30 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 176, .range_length = 55001, .glyph_id_start = 111, .list_length = 452, .type = 3, .unicode_list = 4504, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[71999] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 4559, .size = 4086, .comp_size = 3349 },
+{ .bitmap_start = 4086, .comp_offset = 7908, .size = 3959, .comp_size = 3137 },
+{ .bitmap_start = 8045, .comp_offset = 11045, .size = 4037, .comp_size = 2753 },
+{ .bitmap_start = 12082, .comp_offset = 13798, .size = 4024, .comp_size = 2652 },
+{ .bitmap_start = 16106, .comp_offset = 16450, .size = 3966, .comp_size = 2474 },
+{ .bitmap_start = 20072, .comp_offset = 18924, .size = 4057, .comp_size = 2756 },
+{ .bitmap_start = 24129, .comp_offset = 21680, .size = 3970, .comp_size = 2757 },
+{ .bitmap_start = 28099, .comp_offset = 24437, .size = 4061, .comp_size = 2815 },
+{ .bitmap_start = 32160, .comp_offset = 27252, .size = 4088, .comp_size = 2941 },
+{ .bitmap_start = 36248, .comp_offset = 30193, .size = 4078, .comp_size = 3014 },
+{ .bitmap_start = 40326, .comp_offset = 33207, .size = 4004, .comp_size = 2741 },
+{ .bitmap_start = 44330, .comp_offset = 35948, .size = 4003, .comp_size = 2995 },
+{ .bitmap_start = 48333, .comp_offset = 38943, .size = 3991, .comp_size = 3087 },
+{ .bitmap_start = 52324, .comp_offset = 42030, .size = 4073, .comp_size = 2887 },
+{ .bitmap_start = 56397, .comp_offset = 44917, .size = 4084, .comp_size = 2692 },
+{ .bitmap_start = 60481, .comp_offset = 47609, .size = 3352, .comp_size = 2692 },
+};
+
+static uint8_t etxUncompBuf[8166] __SDRAMFONTS;
 
 const etxLz4Font lv_font_ko_L = {
-.uncomp_size = 71767,
-.comp_size = 43030,
+.uncomp_size = 7934,
+.comp_size = 4559,
 .line_height = 21,
 .base_line = 5,
 .subpx = 0,
@@ -2717,12 +3190,13 @@ const etxLz4Font lv_font_ko_L = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 35,
-.glyph_bitmap = 5408,
-.class_pair_values = 69241,
-.left_class_mapping = 70641,
-.right_class_mapping = 71204,
+.class_pair_values = 5408,
+.left_class_mapping = 6808,
+.right_class_mapping = 7371,
+.block_num = 16,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 71999,
+.lvglFontBufSize = 8166,
 };
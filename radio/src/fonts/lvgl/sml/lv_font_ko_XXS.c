@@ -201,759 +201,849 @@ static const uint8_t lz4FontData[] ={
 0x00,0x13,0xb6,0x08,0x00,0x13,0xd4,0x08,0x00,0x13,0xf2,0x08,0x00,0x50,0x10,0x3b,
 0x00,0x0a,0x0b,0x68,0x0b,0x12,0x3b,0x58,0x00,0x13,0x58,0x08,0x00,0x21,0x74,0x3b,
 0xa8,0x00,0x32,0xfe,0x9d,0x3b,0x28,0x00,0x32,0xbb,0x3b,0x00,0x80,0x02,0x50,0x3b,
-0x10,0x08,0x09,0x06,0x98,0x13,0xf0,0xff,0xff,0xff,0xff,0x0b,0x72,0x1f,0xb5,0x21,
-0x50,0xab,0x54,0xab,0x58,0xab,0x60,0xab,0x62,0xab,0x65,0xab,0x69,0xab,0x6c,0xab,
-0x81,0xab,0xc0,0xab,0xc4,0xab,0xd0,0xab,0xdc,0xab,0xf0,0xab,0xf8,0xab,0xf9,0xab,
-0x00,0xac,0x0d,0xac,0x14,0xac,0x30,0xac,0x31,0xac,0x41,0xac,0x45,0xac,0x4c,0xac,
-0x50,0xac,0xa0,0xac,0xbc,0xac,0xbd,0xac,0xc5,0xac,0xdc,0xac,0x10,0xad,0x2c,0xad,
-0x30,0xad,0x48,0xad,0x49,0xad,0x4c,0xad,0x50,0xad,0x59,0xad,0x80,0xad,0x88,0xad,
-0x91,0xad,0x9c,0xad,0x0c,0xae,0x08,0xaf,0x94,0xaf,0xa4,0xaf,0xad,0xaf,0xe8,0xaf,
-0xf0,0xaf,0xf8,0xaf,0x04,0xb0,0x58,0xb0,0x60,0xb0,0x73,0xb0,0x74,0xb0,0xc8,0xb0,
-0xe2,0xb0,0x54,0xb1,0x5c,0xb1,0xc4,0xb1,0xe0,0xb1,0xe4,0xb1,0xf5,0xb1,0x18,0xb2,
-0x28,0xb2,0x29,0xb2,0x34,0xb2,0x38,0xb2,0x45,0xb2,0x50,0xb2,0xa4,0xb2,0xac,0xb2,
-0xbe,0xb2,0xc0,0xb2,0xc1,0xb2,0xc4,0xb2,0xc8,0xb2,0x14,0xb3,0x15,0xb3,0x29,0xb3,
-0x68,0xb3,0x6c,0xb3,0x78,0xb3,0xa0,0xb3,0xa8,0xb3,0xf4,0xb3,0x10,0xb4,0x18,0xb4,
-0x2c,0xb4,0x2d,0xb4,0x30,0xb4,0x34,0xb4,0x41,0xb4,0x64,0xb4,0x79,0xb4,0x80,0xb4,
-0x9c,0xb4,0x60,0xb5,0xec,0xb5,0x40,0xb6,0xcc,0xb6,0xd0,0xb6,0xdc,0xb6,0xe1,0xb6,
-0xe8,0xb6,0xe9,0xb6,0x19,0xb7,0x3c,0xb7,0x4c,0xb7,0x4d,0xb7,0x58,0xb7,0x59,0xb7,
-0x5c,0xb7,0x74,0xb7,0x75,0xb7,0x7c,0xb7,0xac,0xb7,0xad,0xb7,0xb0,0xb7,0xb4,0xb7,
-0xbf,0xb7,0x1c,0xb8,0x38,0xb8,0x49,0xb8,0xa8,0xb8,0xb8,0xb8,0xc4,0xb8,0xc8,0xb8,
-0xcc,0xb8,0xd4,0xb8,0xfc,0xb8,0xfd,0xb8,0x00,0xb9,0x0c,0xb9,0x0d,0xb9,0x0f,0xb9,
-0x11,0xb9,0x18,0xb9,0x19,0xb9,0x1c,0xb9,0x1e,0xb9,0x20,0xb9,0x2e,0xb9,0x34,0xb9,
-0x45,0xb9,0x47,0xb9,0x88,0xb9,0x8c,0xb9,0x90,0xb9,0xa4,0xb9,0xc4,0xb9,0xd5,0xb9,
-0xf8,0xb9,0xf9,0xb9,0x0b,0xba,0x84,0xba,0x88,0xba,0xfc,0xba,0x48,0xbb,0x49,0xbb,
-0x50,0xbb,0x5b,0xbb,0x5d,0xbb,0x5f,0xbb,0x64,0xbb,0x65,0xbb,0x68,0xbb,0x6c,0xbb,
-0x6d,0xbb,0x79,0xbb,0x80,0xbb,0x81,0xbb,0xd4,0xbb,0xd8,0xbb,0xdc,0xbb,0xe4,0xbb,
-0xe5,0xbb,0xf0,0xbb,0xf8,0xbb,0x10,0xbc,0x14,0xbc,0x44,0xbc,0x45,0xbc,0x48,0xbc,
-0x4c,0xbc,0x57,0xbc,0xd0,0xbc,0xd4,0xbc,0xd8,0xbc,0xe9,0xbc,0x40,0xbd,0x5c,0xbd,
-0x64,0xbd,0x94,0xbd,0x98,0xbd,0x9c,0xbd,0xb0,0xbd,0xb8,0xbd,0xe0,0xbf,0xfc,0xbf,
-0xfd,0xbf,0x00,0xc0,0x0d,0xc0,0x11,0xc0,0x18,0xc0,0x19,0xc0,0x28,0xc0,0x2d,0xc0,
-0x47,0xc0,0x6c,0xc0,0x6d,0xc0,0x70,0xc0,0x74,0xc0,0x81,0xc0,0x88,0xc0,0x89,0xc0,
-0x8c,0xc0,0x90,0xc0,0x9b,0xc0,0xa8,0xc0,0xdc,0xc0,0xdd,0xc0,0xe0,0xc0,0xf1,0xc0,
-0x30,0xc1,0x68,0xc1,0x6c,0xc1,0x7b,0xc1,0xf4,0xc1,0xfc,0xc1,0x05,0xc2,0x09,0xc2,
-0x2c,0xc2,0x2d,0xc2,0x30,0xc2,0x34,0xc2,0x3c,0xc2,0x41,0xc2,0x48,0xc2,0x40,0xc4,
-0x94,0xc4,0x95,0xc4,0x98,0xc4,0x9a,0xc4,0x9c,0xc4,0xa4,0xc4,0xa5,0xc4,0xa9,0xc4,
-0xae,0xc4,0xc0,0xc4,0xcc,0xc4,0xe1,0xc4,0x04,0xc5,0x08,0xc5,0x0c,0xc5,0x15,0xc5,
-0x16,0xc5,0x18,0xc5,0x20,0xc5,0x28,0xc5,0x3c,0xc5,0x3d,0xc5,0x40,0xc5,0x44,0xc5,
-0x51,0xc5,0x58,0xc5,0x74,0xc5,0x78,0xc5,0x7c,0xc5,0x85,0xc5,0x90,0xc5,0x94,0xc5,
-0xc8,0xc5,0xcc,0xc5,0xe4,0xc5,0xf9,0xc5,0x00,0xc6,0x04,0xc6,0x08,0xc6,0x10,0xc6,
-0x13,0xc6,0x1c,0xc6,0x20,0xc6,0x24,0xc6,0x38,0xc6,0x54,0xc6,0x70,0xc6,0x78,0xc6,
-0x8c,0xc6,0x90,0xc6,0x94,0xc6,0x9c,0xc6,0xa1,0xc6,0xa8,0xc6,0xc4,0xc6,0xc5,0xc6,
-0xc8,0xc6,0xcc,0xc6,0xcd,0xc6,0xd4,0xc6,0xd5,0xc6,0xd8,0xc6,0xe0,0xc6,0xe1,0xc6,
-0xe4,0xc6,0xe8,0xc6,0xf5,0xc6,0xfc,0xc6,0xfd,0xc6,0x50,0xc7,0x51,0xc7,0x54,0xc7,
-0x58,0xc7,0x60,0xc7,0x61,0xc7,0x65,0xc7,0x6c,0xc7,0x7f,0xc7,0x88,0xc7,0xc0,0xc7,
-0xc1,0xc7,0xc4,0xc7,0xd5,0xc7,0xdc,0xc7,0x4c,0xc8,0x50,0xc8,0x61,0xc8,0xd9,0xc8,
-0xe0,0xc8,0xed,0xc8,0x10,0xc9,0x11,0xc9,0x14,0xc9,0x20,0xc9,0x21,0xc9,0x2c,0xc9,
-0x48,0xc9,0x49,0xc9,0x0d,0xca,0x5d,0xcb,0x78,0xcb,0x88,0xcb,0x8c,0xcb,0x8e,0xcb,
-0x94,0xcb,0xfb,0xcb,0xfd,0xcb,0x04,0xcc,0x58,0xcc,0xac,0xcc,0xe4,0xcc,0xe5,0xcc,
-0xe8,0xcc,0xec,0xcc,0xf9,0xcc,0x38,0xcd,0x71,0xcd,0xa8,0xcd,0xbd,0xcd,0xc4,0xcd,
-0xe0,0xcd,0x34,0xce,0x38,0xce,0x3c,0xce,0x44,0xce,0x47,0xce,0x50,0xce,0x6c,0xce,
-0x7c,0xce,0xa4,0xce,0xac,0xce,0xbc,0xcf,0xc4,0xcf,0xcc,0xcf,0xf4,0xcf,0xfc,0xcf,
-0x10,0xd0,0x18,0xd0,0x20,0xd0,0x2c,0xd0,0x2d,0xd0,0x3d,0xd0,0x80,0xd0,0x84,0xd0,
-0x88,0xd0,0x90,0xd0,0x9c,0xd0,0x9d,0xd0,0xa0,0xd0,0xa4,0xd0,0xac,0xd0,0xf0,0xd0,
-0xf4,0xd0,0x05,0xd1,0x7c,0xd1,0x08,0xd2,0x09,0xd2,0x0c,0xd2,0x10,0xd2,0x40,0xd2,
-0x41,0xd2,0x5c,0xd2,0x6d,0xd2,0x78,0xd2,0xd4,0xd2,0xdc,0xd2,0xe8,0xd2,0xe9,0xd2,
-0x08,0xd3,0x19,0xd3,0x3c,0xd3,0x44,0xd3,0xac,0xd3,0xc8,0xd3,0x54,0xd4,0x5c,0xd4,
-0x8c,0xd4,0x90,0xd4,0x94,0xd4,0xa1,0xd4,0xa8,0xd4,0xa9,0xd4,0xac,0xd4,0xb0,0xd4,
-0xb8,0xd4,0xb9,0xd4,0xbd,0xd4,0xc4,0xd4,0xd9,0xd4,0xf5,0xd4,0x18,0xd5,0x28,0xd5,
-0x2d,0xd5,0x3c,0xd5,0x54,0xd5,0x65,0xd5,0x88,0xd5,0x90,0xd5,0x9d,0xd5,0xa4,0xd5,
-0xa5,0xd5,0xa8,0xd5,0xac,0xd5,0xb9,0xd5,0xdc,0xd5,0xf8,0xd5,0x14,0xd6,0x70,0xd6,
-0x84,0xd6,0xc0,0xd6,0xd8,0xd6,0x51,0xef,0x58,0xef,0x5b,0xef,0x5c,0xef,0x5d,0xef,
-0x61,0xef,0x63,0xef,0x65,0xef,0x69,0xef,0x6c,0xef,0x71,0xef,0x76,0xef,0x77,0xef,
-0x78,0xef,0x8e,0xef,0x93,0xef,0x98,0xef,0x9b,0xef,0x9c,0xef,0x9d,0xef,0xa1,0xef,
-0xa2,0xef,0xa3,0xef,0xa4,0xef,0xb7,0xef,0xb8,0xef,0xbe,0xef,0xc0,0xef,0xc1,0xef,
-0xc4,0xef,0xc7,0xef,0xc8,0xef,0xc9,0xef,0xcb,0xef,0xe3,0xef,0xe5,0xef,0x14,0xf0,
-0x15,0xf0,0x17,0xf0,0x19,0xf0,0x30,0xf0,0x37,0xf0,0x3a,0xf0,0x43,0xf0,0x6c,0xf0,
-0x74,0xf0,0xab,0xf0,0x3b,0xf1,0x90,0xf1,0x91,0xf1,0x92,0xf1,0x93,0xf1,0x94,0xf1,
-0xd7,0xf1,0xe3,0xf1,0x3d,0xf2,0x54,0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0x56,0x56,
-0x55,0x34,0x34,0x77,0x25,0x50,0x00,0x86,0x21,0xaa,0xc6,0x06,0x29,0x04,0xc8,0xc4,
-0x08,0x35,0x1a,0x04,0xf0,0x37,0x1a,0x00,0x2b,0x5b,0x04,0x80,0x50,0x0a,0xb3,0x01,
-0x01,0xc0,0x66,0x1c,0x00,0x6c,0x20,0x00,0x10,0x00,0x67,0x70,0x20,0x36,0x47,0x00,
-0x00,0x58,0x82,0x02,0x68,0x17,0x03,0x07,0x84,0x0b,0xa6,0x00,0xb6,0x50,0x1a,0xb0,
-0x48,0x34,0xb6,0x39,0x8b,0x80,0x96,0x03,0x50,0x90,0x46,0x06,0x40,0x64,0x03,0x70,
-0x09,0x00,0x14,0x71,0x01,0x80,0x0a,0x00,0x82,0x09,0x20,0xa0,0xa2,0x14,0xf0,0xff,
-0x0d,0x00,0x6d,0x92,0x37,0x80,0x00,0x00,0x01,0x80,0x00,0x1a,0x00,0x6a,0xda,0x20,
-0x1a,0x00,0x82,0x70,0x78,0x00,0x44,0x00,0x90,0x03,0x60,0x09,0x00,0x18,0x00,0x72,
-0x00,0x40,0x00,0x1a,0x97,0x07,0x30,0xb0,0x82,0x0b,0x07,0x40,0xb0,0x1a,0x97,0x00,
-0x18,0xb1,0x0b,0x00,0xb0,0x0b,0x00,0xb0,0x3a,0x98,0x04,0x10,0xb0,0x00,0x65,0x00,
-0x76,0x00,0x6c,0x88,0x10,0x3a,0x97,0x31,0x0b,0x04,0xc6,0x30,0x0b,0x3a,0x97,0x00,
-0x98,0x00,0x68,0x80,0x28,0x38,0x08,0x8a,0xc2,0x00,0x38,0x00,0x0d,0xaa,0x01,0xd9,
-0x60,0x01,0x0b,0x12,0x30,0x91,0x0a,0x98,0x00,0x06,0x82,0x03,0xb9,0x50,0x75,0x0b,
-0x06,0x50,0xa0,0x0a,0x97,0x00,0x69,0x9d,0x10,0x02,0x80,0x00,0x91,0x00,0x28,0x00,
-0x0a,0x10,0x00,0x1a,0x97,0x05,0x60,0xb0,0x1c,0xb7,0x07,0x30,0xb0,0x3a,0x99,0x00,
-0x3a,0x95,0x82,0x0b,0x19,0x8c,0x00,0x1b,0x07,0xa2,0x43,0x00,0x00,0x43,0x52,0x00,
-0x00,0x52,0x91,0x00,0x02,0x85,0x8a,0x10,0x07,0xa3,0x00,0x01,0x39,0x97,0x00,0x00,
-0x39,0x97,0x58,0x20,0x01,0x8a,0x3a,0x71,0x10,0x00,0x5a,0xb2,0x20,0x56,0x02,0x90,
-0x04,0x10,0x06,0x10,0x03,0x87,0x87,0x01,0x80,0x77,0x26,0x62,0x81,0x90,0x88,0x0a,
-0x09,0x08,0x36,0x87,0xa7,0x40,0x67,0x75,0x00,0x00,0xe2,0x00,0x05,0x79,0x00,0x0b,
-0x0a,0x10,0x3c,0x9b,0x70,0xa1,0x00,0xb0,0x5b,0x9a,0x15,0x60,0x74,0x5b,0x9c,0x15,
-0x60,0x47,0x5b,0x9b,0x20,0x09,0x9a,0x46,0x60,0x07,0x83,0x00,0x06,0x60,0x07,0x09,
-0x9a,0x30,0x5b,0x99,0x15,0x60,0x29,0x56,0x00,0xc5,0x60,0x39,0x5b,0x9a,0x10,0x5b,
-0x99,0x25,0x60,0x00,0x5b,0x97,0x05,0x60,0x00,0x5b,0x99,0x20,0x1a,0x00,0x02,0x0d,
-0x00,0xf2,0x0a,0x56,0x00,0x00,0x09,0x9a,0x55,0x60,0x04,0x83,0x19,0xa5,0x70,0x0c,
-0x08,0x99,0x70,0x56,0x00,0xb0,0x56,0x00,0xb0,0x5b,0x99,0xe0,0x09,0x00,0x10,0x47,
-0x01,0x00,0x20,0x00,0x0c,0x02,0x00,0xf1,0x06,0x50,0x0b,0x5a,0xa5,0x56,0x08,0x50,
-0x56,0x95,0x00,0x5d,0xc0,0x00,0x57,0x3a,0x00,0x56,0x04,0x90,0x56,0x00,0x42,0x00,
-0x01,0x54,0x00,0xf0,0x1f,0x00,0x5d,0x00,0x0d,0x55,0xc4,0x05,0xc5,0x56,0xa0,0xb6,
-0x55,0x67,0x77,0x65,0x56,0x1e,0x16,0x50,0x5c,0x00,0xb0,0x5b,0x80,0xb0,0x56,0x94,
-0xb0,0x56,0x0b,0xc0,0x56,0x02,0xf0,0x09,0x9a,0x30,0x66,0x00,0xc0,0x83,0x00,0xb0,
-0x66,0x00,0xc0,0x9e,0x00,0x73,0x9a,0x45,0x60,0x1b,0x5b,0x89,0x35,0x84,0x00,0xf1,
-0x23,0x30,0x65,0x00,0xc0,0x92,0x00,0xc0,0x65,0x00,0xc0,0x09,0x9c,0x40,0x00,0x02,
-0x80,0x5b,0x9a,0x25,0x60,0x47,0x5b,0xab,0x15,0x60,0xb0,0x56,0x04,0x70,0x2a,0x89,
-0x16,0x60,0x22,0x06,0x97,0x05,0x10,0x65,0x3a,0x9a,0x20,0x79,0xe9,0x50,0x0c,0x00,
-0x00,0xc0,0x00,0x05,0x00,0xf2,0x31,0x74,0x01,0xa7,0x40,0x1a,0x74,0x01,0xa6,0x50,
-0x2a,0x1a,0x9a,0x20,0xa1,0x00,0xb4,0x70,0x65,0x0a,0x0a,0x00,0x65,0x80,0x00,0xe1,
-0x00,0xa1,0x0d,0x10,0xb5,0x63,0xb6,0x38,0x1a,0x82,0xa7,0x30,0xba,0x09,0xb0,0x08,
-0x70,0x4a,0x00,0x67,0x07,0x60,0x95,0xa0,0x02,0xf2,0x00,0xa6,0xa0,0x67,0x07,0x70,
-0x93,0x06,0x61,0xa0,0xb0,0x06,0xb2,0x46,0x00,0xf2,0x02,0x59,0x9e,0x40,0x04,0x80,
-0x02,0xa0,0x00,0xb1,0x00,0x9b,0x99,0x40,0x59,0x06,0x40,0x64,0x03,0x00,0xf1,0x01,
-0x05,0x90,0x91,0x00,0x37,0x00,0x0a,0x00,0x05,0x50,0x00,0xa0,0x00,0x40,0x86,0x38,
-0x01,0x00,0xf0,0x33,0x96,0x05,0x00,0x1b,0x60,0x82,0xa0,0x88,0x85,0x47,0x39,0x96,
-0x18,0x7b,0x83,0x0b,0x4b,0x9b,0x74,0x00,0x07,0xa9,0x80,0x74,0x0a,0x07,0x40,0xa0,
-0x7a,0x98,0x00,0x19,0x97,0x82,0x04,0x92,0x03,0x2a,0x96,0x00,0x0b,0x2b,0x8d,0x83,
-0x0b,0x82,0x0b,0x2a,0x8d,0x19,0x97,0x89,0x8a,0x94,0x00,0x2b,0x87,0x08,0x71,0xa0,
-0x7d,0x41,0xa0,0x1a,0x01,0xa0,0x19,0x00,0xc0,0x83,0x0b,0x2b,0x9d,0x18,0x97,0x74,
-0x00,0x7a,0xa8,0x74,0x0b,0x02,0x00,0x71,0x43,0x65,0x65,0x65,0x65,0x04,0x20,0x79,
-0x00,0xf0,0x01,0x42,0xb2,0x74,0x00,0x07,0x48,0x60,0x7b,0x70,0x07,0x8b,0x00,0x74,
-0x39,0x00,0x65,0x01,0x00,0xe4,0x7a,0xaa,0x9b,0x37,0x40,0xc0,0x47,0x74,0x0b,0x04,
-0x77,0x40,0xb0,0x47,0x36,0x00,0xf0,0x02,0x19,0x98,0x08,0x20,0x91,0x82,0x09,0x11,
-0xa8,0x70,0x7a,0x88,0x07,0x40,0xa0,0x74,0x0b,0x89,0x00,0x24,0x00,0x00,0x7a,0x00,
-0xf2,0x0b,0x00,0x0b,0x00,0x07,0xb5,0x74,0x07,0x40,0x74,0x00,0x3a,0xa5,0x49,0x32,
-0x22,0x68,0x3a,0x96,0x38,0x09,0xc2,0x38,0x02,0x80,0x0c,0x30,0x3f,0x00,0xf0,0x28,
-0x2b,0x9c,0xa1,0x38,0x46,0x82,0x0a,0xa0,0x08,0x60,0xa0,0x77,0x0a,0x64,0x99,0x45,
-0x1b,0x77,0xa1,0x0c,0x22,0xb0,0x75,0x66,0x0a,0xa0,0x0a,0xa0,0x75,0x57,0xa1,0x37,
-0x46,0x81,0x09,0x80,0x08,0x30,0x69,0x00,0x59,0xc7,0x02,0xb0,0x0b,0x10,0x8b,0x86,
-0x00,0x00,0x75,0x0b,0x00,0xb0,0x96,0x27,0x03,0x41,0x75,0x00,0x00,0x54,0x01,0x00,
-0xf2,0x20,0x22,0x00,0x08,0x30,0x29,0x01,0xa0,0x0a,0x40,0xa0,0x29,0x08,0x30,0x00,
-0x00,0x19,0x70,0x74,0x23,0x95,0x00,0x00,0x20,0x00,0x00,0x00,0xc9,0x00,0x1b,0xaa,
-0xa5,0x90,0x18,0x00,0x00,0x86,0x1d,0xaa,0x93,0xa0,0x00,0x00,0xba,0x00,0x00,0x00,
-0x40,0x9a,0x1b,0xf0,0x24,0x4f,0x00,0x00,0x04,0x98,0xaa,0xa6,0x0c,0x00,0x00,0x18,
-0x05,0x76,0xaa,0xb8,0x00,0x6e,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x07,0x20,0x00,
-0x08,0x7b,0x10,0x08,0x60,0x1b,0x11,0xad,0x08,0xb5,0x00,0xa0,0x91,0x00,0x0a,0x09,
-0x10,0x00,0xaa,0xd1,0x00,0x00,0x6a,0xa0,0x0b,0x00,0x00,0x12,0x00,0xd2,0x8d,0x08,
-0x94,0x0a,0x60,0x1c,0x20,0x0b,0x3a,0x30,0x00,0x0c,0x50,0xe5,0x1b,0xf1,0x20,0x06,
-0x60,0x00,0x00,0x0d,0xd0,0x00,0x00,0x77,0x87,0x00,0x00,0xd0,0x0d,0x00,0x08,0x60,
-0x06,0x80,0x1f,0xee,0xee,0xf1,0x00,0x02,0xa4,0x00,0x79,0xc1,0xc0,0x77,0x0f,0xd9,
-0x0b,0x02,0xf6,0xa0,0xb0,0x32,0x0b,0x08,0x50,0x05,0x90,0x08,0xbb,0x80,0x34,0x00,
-0xf1,0x40,0x13,0x32,0x00,0x02,0x6c,0xf6,0x60,0x09,0x52,0x71,0xa2,0x1b,0x00,0x00,
-0x66,0x0b,0x00,0x00,0x65,0x07,0x70,0x02,0xb0,0x00,0x8a,0xaa,0x20,0x00,0x02,0x10,
-0x00,0x00,0x30,0x00,0x00,0x0a,0xbd,0xab,0x40,0x1c,0x28,0x70,0x93,0x0c,0xbb,0x30,
-0x19,0x0b,0x01,0x00,0x19,0x07,0x60,0x00,0xa3,0x00,0x6b,0xba,0x30,0x06,0xcc,0xc8,
-0x0c,0x30,0x65,0x0d,0x01,0xb0,0x3e,0x3a,0x00,0xb8,0x7c,0x00,0xb2,0x1b,0x00,0x4b,
-0xb5,0x54,0x00,0xf1,0x71,0x99,0x10,0x57,0xdd,0x85,0x71,0x55,0x17,0x71,0x66,0x17,
-0x72,0xbb,0x37,0x70,0x00,0x07,0x47,0xff,0x84,0x00,0x66,0x10,0x00,0x01,0x30,0x06,
-0x08,0xdb,0xc0,0x99,0xc0,0x00,0x07,0x05,0x80,0x00,0x71,0x81,0x00,0x0b,0xab,0x00,
-0x00,0x30,0x7e,0xdc,0x00,0x00,0x01,0x00,0x68,0x86,0x66,0x77,0x53,0x9a,0x77,0x78,
-0xec,0x73,0x30,0x06,0x79,0x80,0x06,0x76,0x60,0x06,0x9c,0xc7,0x79,0x00,0x28,0x96,
-0x00,0x04,0xa9,0x85,0xb0,0x0c,0x07,0x80,0x66,0x19,0x05,0x63,0x19,0x0b,0x8b,0x5a,
-0x88,0x07,0xb2,0x03,0xd2,0x00,0x6b,0xba,0x20,0x02,0x97,0x00,0x00,0x0a,0x14,0x73,
-0x30,0x0b,0x02,0xbf,0xf4,0x04,0xde,0x9f,0xf5,0x08,0x5a,0xff,0xe0,0x0a,0x5f,0xff,
-0xf5,0x0d,0xcb,0xbb,0xb4,0x43,0x01,0xf0,0x02,0x03,0x90,0x00,0x16,0x65,0x9a,0x00,
-0x1a,0xaa,0xaa,0x60,0x05,0xfe,0xef,0xf2,0x00,0x49,0x14,0x00,0x12,0x70,0x29,0x01,
-0xf0,0x0b,0x04,0x72,0x00,0x00,0x04,0x77,0x80,0x00,0x04,0x66,0x20,0x00,0x54,0x93,
-0x00,0x0c,0x47,0x4b,0x00,0x1f,0x3d,0x3e,0x00,0x03,0x85,0x93,0xd8,0x00,0x92,0xa0,
-0x07,0xc3,0xa0,0x08,0x5a,0xa0,0x00,0x0a,0x03,0x00,0xf1,0x2b,0xaa,0xaa,0xa9,0x00,
-0x46,0x10,0x00,0x05,0x40,0x87,0x20,0x08,0x00,0x01,0x80,0x35,0x6a,0xb5,0x70,0x60,
-0x37,0x40,0x62,0x34,0x0b,0x90,0x24,0x06,0x77,0x77,0x70,0x00,0x00,0x0a,0x00,0x00,
-0x00,0x1d,0x81,0x02,0xb9,0xb7,0x80,0x09,0x10,0xb5,0x80,0x0a,0x00,0x2d,0x00,0x09,
-0x00,0x1c,0x00,0x27,0x00,0x1c,0x6c,0x00,0xf0,0x01,0x37,0x33,0x73,0x27,0x05,0xe0,
-0x10,0x00,0x29,0x82,0x01,0x8b,0x38,0x20,0x39,0x98,0x87,0x00,0xf1,0x08,0x77,0x28,
-0x00,0x00,0x52,0x80,0x00,0x08,0x08,0x72,0x06,0x30,0x70,0x04,0x50,0x07,0x00,0x10,
-0x00,0x80,0x00,0x00,0x06,0xb0,0x1d,0xf0,0x08,0x68,0x28,0x00,0x00,0x71,0x80,0x00,
-0x17,0x08,0x71,0x37,0x00,0x80,0x01,0x20,0x07,0x00,0x08,0x00,0x00,0x00,0x97,0x77,
-0xc4,0x1d,0xf2,0x06,0x03,0x79,0x28,0x00,0x00,0x80,0x87,0x10,0x64,0x07,0x00,0x43,
-0x00,0x40,0x00,0x58,0x7a,0x00,0x07,0x77,0x90,0x1c,0x00,0x00,0x01,0x00,0xf1,0x0a,
-0x20,0x02,0x79,0x38,0x00,0x00,0x71,0x87,0x10,0x37,0x07,0x00,0x46,0x00,0x60,0x00,
-0x67,0x78,0x00,0x08,0x00,0x80,0x00,0x96,0x6a,0x1e,0x00,0xf1,0x09,0x27,0x82,0x70,
-0x00,0x06,0x28,0x00,0x02,0x80,0x87,0x13,0x60,0x06,0x00,0x06,0x05,0x60,0x00,0xa7,
-0x7c,0x00,0x09,0x7b,0x35,0x75,0x00,0x12,0x78,0x75,0x00,0xf0,0x05,0x18,0x08,0x72,
-0x37,0x00,0x70,0x00,0x07,0x74,0x00,0x08,0x10,0x80,0x00,0x73,0x09,0x00,0x00,0x56,
-0x10,0x59,0x00,0x31,0x03,0x79,0x38,0x79,0x00,0xf4,0x01,0x55,0x08,0x00,0x44,0x00,
-0x50,0x00,0x77,0x77,0x00,0x09,0x77,0x60,0x00,0xa7,0x77,0x65,0x1e,0xf0,0x04,0x47,
-0x67,0x07,0x00,0x87,0x07,0x03,0x57,0x77,0x08,0x07,0x07,0x45,0x07,0x07,0x40,0x07,
-0x07,0x00,0xe7,0x0c,0xf0,0x09,0x00,0x15,0x60,0x56,0x00,0x90,0xba,0x04,0x50,0x77,
-0x36,0x00,0x67,0x00,0x17,0x62,0x00,0x90,0x08,0x00,0x90,0x18,0x00,0x16,0xaf,0x02,
-0xf2,0x03,0x17,0x75,0x07,0x00,0x17,0x07,0x00,0x73,0x57,0x02,0x61,0x27,0x18,0x00,
-0x07,0x10,0x00,0x07,0x01,0x01,0xf2,0x06,0x37,0x90,0x70,0x00,0x80,0x70,0x03,0x65,
-0xb0,0x46,0x00,0x70,0x02,0x00,0x70,0x08,0x00,0x00,0x08,0x77,0x70,0xdf,0x00,0xf2,
-0x07,0x37,0x91,0x80,0x00,0x95,0xb0,0x05,0x50,0x70,0x44,0x00,0x70,0x04,0x77,0x70,
-0x08,0x00,0x80,0x07,0x66,0xb0,0x00,0xdd,0x00,0xf3,0x05,0x70,0x77,0x00,0x80,0x77,
-0x00,0x87,0x77,0x05,0x30,0x77,0x18,0x00,0x77,0x30,0x00,0x77,0x00,0x00,0x67,0x01,
-0x1f,0xf1,0x01,0x78,0x07,0x80,0x00,0x90,0x78,0x00,0x55,0x78,0x80,0x45,0x00,0x88,
-0x00,0x03,0x04,0x3e,0x03,0x52,0x46,0x97,0x90,0x01,0x01,0x3b,0x00,0xe5,0x75,0x07,
-0x00,0x18,0x77,0x00,0x71,0x07,0x03,0x63,0x67,0x27,0x00,0x17,0x89,0x00,0xf0,0x01,
-0x17,0x74,0x07,0x00,0x45,0x78,0x01,0x93,0x77,0x27,0x00,0x07,0x02,0x77,0x74,0x00,
-0x88,0x01,0x22,0x07,0x00,0xd3,0x01,0xf3,0x05,0x82,0x70,0x00,0x83,0xb1,0x05,0x55,
-0xb0,0x43,0x00,0x50,0x04,0x87,0xa0,0x05,0x77,0x90,0x08,0x77,0x71,0x1b,0x00,0xf2,
-0x05,0x90,0x80,0x00,0x84,0xc0,0x04,0x56,0xb0,0x46,0x00,0x80,0x00,0x77,0x40,0x06,
-0x20,0x80,0x06,0x40,0x90,0x46,0x01,0xf2,0x03,0x37,0x70,0x77,0x00,0x84,0x77,0x00,
-0x72,0x78,0x06,0x57,0x78,0x17,0x00,0x78,0x40,0x00,0x78,0xa4,0x00,0x31,0x06,0x77,
-0x50,0x5d,0x00,0x10,0x10,0x11,0x02,0xd0,0x00,0x00,0x80,0x00,0x06,0x7a,0x77,0x70,
-0x05,0x77,0xa0,0x00,0x02,0x0e,0x00,0x82,0x30,0x05,0x78,0x77,0x70,0x06,0x77,0x70,
-0x7d,0x00,0x10,0x60,0x64,0x00,0x00,0x1c,0x00,0xf3,0x02,0x10,0x70,0x00,0x80,0x30,
-0x57,0x97,0x77,0x05,0x00,0x40,0x09,0x77,0xb0,0x09,0x77,0xa0,0x18,0x00,0x20,0x30,
-0x80,0x18,0x00,0xa3,0x87,0x76,0x01,0x77,0x20,0x08,0x00,0x80,0x08,0x21,0x7c,0x00,
-0xf5,0x06,0x04,0x77,0x37,0x00,0x00,0x08,0x70,0x00,0x20,0x77,0x00,0x07,0x16,0x77,
-0x10,0x70,0x07,0x00,0x68,0x77,0x80,0xd0,0x00,0x51,0x00,0x00,0x01,0x77,0x67,0x20,
-0x00,0x82,0x70,0x57,0x71,0x5b,0x77,0x80,0x00,0x10,0x76,0x02,0x21,0x77,0x77,0x9d,
-0x00,0x00,0x9c,0x02,0xd2,0x80,0x06,0x17,0x70,0x06,0x17,0x00,0x59,0x8a,0x77,0x04,
-0x77,0x90,0x39,0x00,0x51,0x70,0x03,0x66,0x67,0x71,0x28,0x00,0x02,0xbc,0x02,0x31,
-0x06,0x77,0xa0,0x0b,0x00,0x91,0x30,0x57,0x8a,0x77,0x06,0x8a,0x70,0x00,0x00,0x03,
-0x00,0x00,0x97,0x00,0xf1,0x06,0xa2,0x00,0x00,0x06,0x20,0x34,0x44,0x54,0x01,0x33,
-0x93,0x20,0x07,0xa3,0x76,0x00,0x89,0x00,0x70,0x0b,0x72,0xee,0x02,0x03,0x09,0x02,
-0xb0,0x07,0x07,0x24,0x49,0x17,0x15,0x54,0x77,0x01,0x10,0x07,0x66,0x01,0x30,0x77,
-0x74,0x00,0x06,0x00,0x30,0x07,0x00,0x08,0x1b,0x00,0xc0,0x00,0x02,0x17,0x37,0xb5,
-0x27,0x00,0x80,0x07,0x00,0x70,0x07,0x2b,0x04,0x20,0x77,0x75,0x7d,0x00,0x00,0x73,
-0x00,0x70,0x66,0x67,0x84,0x00,0x80,0x80,0x00,0x34,0x00,0x61,0x60,0x60,0x00,0x06,
-0x77,0x90,0x18,0x00,0xd4,0x50,0x57,0xa7,0xa7,0x02,0x80,0x70,0x08,0x10,0x10,0x09,
-0x77,0x71,0xc0,0x00,0x03,0x8c,0x00,0x44,0x57,0x77,0x76,0x05,0xc0,0x00,0x34,0x30,
-0x05,0x77,0x5a,0x01,0x11,0x10,0x1e,0x00,0x00,0xab,0x00,0x13,0x80,0x43,0x00,0x31,
-0x77,0x77,0x04,0x95,0x01,0x40,0x09,0x77,0x71,0x05,0xd8,0x00,0xe1,0x70,0x23,0x33,
-0x53,0x23,0x44,0x33,0x06,0x77,0xa0,0x07,0x66,0x90,0x0a,0xee,0x01,0x01,0x49,0x00,
-0x01,0xf0,0x00,0x64,0x77,0x77,0x05,0x00,0x50,0x0a,0x87,0x01,0x00,0xbc,0x00,0x11,
-0x76,0xbc,0x00,0x67,0x53,0x07,0x01,0x80,0x07,0x08,0xdd,0x02,0xca,0x27,0x83,0x70,
-0x00,0x71,0x71,0x06,0x60,0x70,0x32,0x00,0x40,0x39,0x02,0xf3,0x08,0x01,0x27,0x82,
-0x08,0x00,0x71,0x08,0x03,0x70,0x07,0x46,0x00,0x05,0x06,0x00,0x05,0x07,0x77,0x87,
-0x07,0x66,0x76,0x00,0xd8,0x05,0xf3,0x08,0x67,0x48,0x00,0x00,0x81,0x78,0x00,0x02,
-0x54,0x48,0x71,0x07,0x08,0x07,0x00,0x06,0x17,0x07,0x00,0x00,0x20,0x07,0x00,0xc1,
-0x01,0xf1,0x00,0x38,0x56,0x07,0x08,0x08,0x07,0x08,0x09,0x77,0x25,0x44,0x07,0x60,
-0x80,0x07,0x1a,0x00,0xf7,0x00,0x07,0x05,0x93,0x75,0x00,0x07,0x00,0x70,0x00,0x70,
-0x16,0x04,0x67,0x67,0x82,0xa7,0x01,0x70,0x17,0x55,0x70,0x00,0x08,0x07,0x10,0x39,
-0x01,0x60,0x43,0x08,0x00,0x01,0x00,0x10,0xc5,0x04,0xd0,0x17,0x95,0xa0,0x00,0x80,
-0x70,0x01,0x20,0x40,0x57,0x77,0x77,0x06,0x5b,0x03,0x24,0x70,0x0a,0xcc,0x00,0xf3,
-0x05,0x17,0xa5,0xb0,0x00,0x70,0x80,0x24,0x32,0x52,0x34,0x44,0x44,0x08,0x77,0x60,
-0x0a,0x77,0x70,0x0a,0x77,0x47,0x05,0x11,0x05,0x60,0x04,0x50,0x80,0x08,0x00,0x09,
-0x70,0x07,0x00,0x22,0x77,0x37,0x99,0x01,0x11,0x07,0xb4,0x00,0x01,0x1c,0x00,0xa0,
-0x97,0x08,0x44,0x47,0x00,0x13,0x30,0x50,0x00,0x68,0xac,0x04,0x16,0x80,0x33,0x04,
-0x14,0x10,0x20,0x00,0x91,0x01,0x17,0x00,0x37,0x62,0x60,0x00,0x77,0x76,0x10,0x00,
-0x24,0xa6,0x69,0x92,0x02,0x40,0x50,0x07,0x07,0x80,0x03,0x00,0x84,0x78,0x80,0x07,
-0x07,0x75,0x68,0x07,0x01,0x53,0x04,0x02,0x77,0x00,0xc5,0x08,0x00,0x08,0x08,0x05,
-0x78,0x07,0x00,0x08,0x0a,0x67,0x08,0x9a,0x03,0x10,0x06,0x6d,0x1f,0xf2,0x01,0x78,
-0x09,0x23,0x08,0x05,0x53,0x05,0x02,0x87,0x76,0x03,0x77,0x76,0x04,0x87,0x75,0x04,
-0x04,0x10,0x08,0xf8,0x1f,0xf3,0x04,0x79,0x0b,0x77,0x08,0x00,0x35,0x34,0x04,0x79,
-0x85,0x00,0x58,0x60,0x02,0x70,0x46,0x00,0x47,0x60,0x69,0x00,0x40,0x08,0x07,0x80,
-0x6b,0x6f,0x00,0x26,0x76,0x78,0x69,0x00,0x12,0x04,0x32,0x01,0x00,0x39,0x01,0xb2,
-0x58,0x77,0x00,0x00,0x43,0x00,0x06,0x79,0x97,0x70,0x07,0x15,0x00,0xf2,0x02,0x04,
-0x7b,0x70,0x05,0x77,0xa7,0x70,0x06,0x77,0x71,0x00,0x25,0x05,0x00,0x08,0xa7,0xb3,
-0xf2,0x00,0x01,0x1c,0x00,0x12,0x09,0x1e,0x01,0x55,0x47,0x7a,0x77,0x00,0x00,0x63,
-0x03,0x13,0x01,0x4d,0x02,0xfd,0x01,0x60,0x24,0x44,0x44,0x13,0x39,0x32,0x05,0x78,
-0xa0,0x07,0x67,0x90,0x0a,0x77,0x81,0x37,0x00,0x30,0x59,0x87,0xb7,0x97,0x01,0x21,
-0x04,0x30,0x0e,0x00,0x02,0x84,0x02,0x10,0x08,0x6c,0x02,0x02,0xbe,0x02,0x23,0x77,
-0x07,0x0f,0x00,0x53,0x60,0x57,0x77,0x77,0x02,0x55,0x00,0x21,0x70,0x06,0x09,0x00,
-0x10,0x04,0x15,0x00,0x93,0x76,0x00,0x66,0x10,0x08,0x10,0x90,0x08,0x20,0xf9,0x03,
-0x10,0x05,0x41,0x03,0x12,0x07,0x4a,0x03,0x65,0x0a,0x67,0x07,0x01,0x00,0x07,0xf6,
-0x03,0x12,0x06,0x47,0x01,0xe8,0x00,0x07,0x08,0x77,0x07,0x01,0x77,0x74,0x04,0x40,
-0x08,0x03,0x96,0x77,0x1b,0x00,0x00,0x0c,0x01,0xb3,0x76,0x05,0x03,0x30,0x06,0x04,
-0x97,0x77,0x04,0x86,0x66,0x3b,0x07,0x22,0x77,0x17,0xf4,0x01,0x87,0x08,0x71,0x80,
-0x00,0x70,0x07,0x77,0x47,0xf4,0x01,0x34,0x05,0x77,0x08,0x1c,0x00,0x25,0x67,0x74,
-0x46,0x04,0x26,0xa7,0x77,0x1c,0x00,0xf7,0x03,0x83,0x08,0x00,0x08,0x40,0x37,0x63,
-0x50,0x00,0x60,0x06,0x00,0x0a,0x77,0xb0,0x00,0x97,0x7a,0x43,0x06,0x05,0xf0,0x01,
-0x45,0x76,0x68,0x07,0x00,0xf0,0x01,0x00,0x72,0x00,0xd4,0x80,0x00,0x88,0x02,0x7b,
-0x80,0x00,0x87,0x66,0x48,0x01,0x00,0x70,0xc0,0x00,0xf4,0x04,0x57,0x70,0x70,0x80,
-0x07,0xb0,0x82,0x22,0x70,0x25,0x41,0x50,0x05,0x77,0xa0,0x06,0x77,0x90,0x09,0x86,
-0x05,0xf3,0x06,0x67,0x72,0x52,0x80,0x06,0xa2,0x80,0x00,0x61,0x37,0x75,0x51,0x05,
-0x77,0x71,0x00,0x60,0x60,0x06,0xb7,0xb2,0x68,0x00,0x11,0x47,0x68,0x00,0x02,0xef,
-0x01,0x19,0x77,0x58,0x02,0xf2,0x03,0x57,0x37,0x08,0x80,0x3a,0x08,0x80,0x29,0x07,
-0x57,0x67,0x07,0x03,0x56,0x63,0x00,0x11,0x18,0xff,0x01,0x00,0x1b,0x00,0x13,0x38,
-0x25,0x02,0x11,0x67,0x8b,0x02,0x64,0x07,0x00,0x01,0x07,0x77,0x75,0x1b,0x00,0xa0,
-0x08,0x80,0x6b,0x08,0x80,0x18,0x08,0x37,0x55,0x05,0x73,0x02,0x53,0x77,0x76,0x06,
-0x77,0x75,0xd7,0x05,0x12,0x70,0x41,0x00,0xd0,0x57,0x76,0x00,0x00,0x35,0x00,0x06,
-0x78,0x97,0x70,0x09,0x77,0x50,0xaa,0x01,0x51,0x8a,0x70,0x56,0x78,0x66,0x7b,0x04,
-0x45,0x71,0x00,0x00,0x60,0x15,0x00,0x21,0x57,0x89,0xbf,0x01,0x16,0x20,0xbf,0x01,
-0xf2,0x06,0x00,0x47,0x73,0x70,0x08,0x00,0x07,0x00,0x80,0x00,0x70,0x03,0x77,0x48,
-0x00,0x03,0x50,0x80,0x07,0x88,0x79,0x72,0x01,0x01,0x01,0x00,0x21,0x0a,0x76,0xa9,
-0x01,0x50,0xa6,0x08,0x36,0xb7,0x18,0xf5,0x03,0x56,0x30,0x01,0x04,0x97,0x73,0x18,
-0x00,0xd0,0xb6,0x08,0x46,0x96,0x18,0x02,0x77,0x73,0x06,0x20,0x07,0x05,0x87,0x87,
-0x01,0x00,0x4c,0x07,0x0f,0xa4,0x02,0x05,0x10,0x00,0x18,0x00,0xc2,0x50,0x09,0x77,
-0x70,0x23,0x33,0x33,0x24,0x4a,0x43,0x05,0x78,0xeb,0x04,0x13,0x81,0x1b,0x00,0x10,
-0x76,0xca,0x04,0x90,0x09,0x77,0x07,0x00,0x01,0x17,0x37,0xb5,0x17,0x8f,0x05,0x10,
-0x80,0x8f,0x05,0x3f,0x08,0x77,0x60,0xbf,0x02,0x06,0x08,0x52,0x00,0x92,0x36,0x85,
-0xa4,0x06,0x87,0xb0,0x07,0x66,0x80,0x3d,0x05,0x32,0x06,0x77,0x40,0xda,0x02,0x30,
-0x06,0x77,0x60,0xb1,0x01,0x23,0x77,0x77,0x06,0x01,0x41,0x77,0x70,0x56,0x66,0x1b,
-0x01,0x00,0xe4,0x00,0x61,0x60,0x08,0x77,0x50,0x00,0x80,0xff,0x02,0x02,0x6b,0x09,
-0x01,0xaf,0x00,0x02,0x42,0x00,0x00,0x4e,0x03,0x90,0x09,0x77,0x70,0x22,0x22,0x22,
-0x34,0x55,0x44,0x98,0x05,0x13,0x77,0x98,0x05,0x05,0x49,0x00,0x23,0x57,0x66,0x4f,
-0x01,0x14,0x07,0x4f,0x01,0x30,0x47,0x71,0x70,0x5e,0x08,0x01,0x03,0x00,0x34,0x77,
-0x74,0x80,0x1a,0x06,0x02,0x4e,0x02,0x20,0x80,0x80,0x14,0x05,0xb5,0x70,0x47,0x74,
-0x70,0x00,0x67,0x30,0x07,0x10,0x80,0x07,0x44,0x03,0xf3,0x01,0x75,0x68,0x00,0x80,
-0x80,0x80,0x08,0x08,0x08,0x71,0x80,0x80,0x70,0x08,0x78,0x78,0x80,0x06,0x00,0x37,
-0x00,0xf4,0x01,0x45,0x73,0x77,0x70,0x70,0x77,0x70,0x70,0xaa,0x70,0x70,0x77,0x74,
-0x94,0x77,0x01,0x79,0x08,0xf2,0x01,0x08,0x56,0x71,0x02,0x50,0x80,0x00,0x25,0x08,
-0x00,0x00,0x76,0x67,0x10,0x00,0x24,0xfe,0x01,0x20,0x67,0x71,0x63,0x00,0x3f,0x0a,
-0x78,0x72,0x7e,0x01,0x02,0x71,0x57,0x67,0x07,0x80,0x70,0x07,0x67,0x63,0x01,0x35,
-0x47,0xb5,0x17,0xf2,0x06,0x00,0x04,0x03,0x10,0x78,0x0c,0x08,0x60,0x80,0x04,0x7b,
-0x08,0x72,0x80,0x15,0x09,0x43,0x17,0x00,0x37,0x41,0x5d,0x02,0x11,0x10,0x24,0x03,
-0x11,0x79,0x20,0x00,0x70,0x07,0x77,0x08,0x71,0x77,0x73,0x70,0x7a,0x03,0x00,0x54,
-0x0a,0x02,0x1a,0x0a,0xf4,0x06,0x04,0x7a,0x08,0x00,0x02,0x80,0x80,0x08,0x65,0x08,
-0x71,0x56,0x63,0x70,0x00,0x57,0x77,0x00,0x08,0x00,0x70,0x7a,0x03,0xf1,0x05,0x01,
-0x00,0x20,0x03,0x6a,0x08,0x00,0x47,0xa0,0x87,0x18,0x00,0x08,0x00,0x58,0x84,0x70,
-0x00,0x16,0x74,0x8a,0x05,0x21,0x57,0x68,0xcf,0x08,0x01,0xd9,0x09,0xb6,0x37,0x97,
-0x79,0x80,0x07,0x07,0x83,0x47,0x07,0x14,0x27,0x2e,0x03,0xda,0x37,0x77,0x08,0x13,
-0x88,0x48,0x83,0x27,0x38,0x57,0x78,0x08,0x02,0x2e,0x03,0xb8,0x04,0x79,0x07,0x00,
-0x24,0xa0,0x87,0x18,0x21,0x08,0x71,0x52,0x00,0x11,0x67,0x37,0x00,0x01,0x39,0x02,
-0xb2,0x37,0xb1,0x77,0x80,0x00,0x07,0x83,0x43,0x07,0x14,0x31,0x1b,0x07,0xf7,0x01,
-0x10,0x37,0xb0,0x71,0x37,0xb2,0xb1,0x80,0x00,0x71,0x47,0x74,0x60,0x04,0x77,0x80,
-0xdd,0x09,0x35,0x10,0x37,0xa0,0x1b,0x00,0x20,0x50,0x06,0x14,0x02,0x43,0xb0,0x07,
-0x66,0xa0,0x85,0x00,0x10,0x60,0xf8,0x09,0xb6,0x37,0x96,0x77,0x80,0x00,0x77,0x83,
-0x40,0x77,0x14,0x20,0xf8,0x09,0xf8,0x00,0x37,0x60,0x78,0x13,0x84,0x88,0x83,0x21,
-0x88,0x57,0x71,0x78,0x02,0x55,0x64,0xa0,0x00,0xf3,0x04,0x37,0x60,0x87,0x00,0x71,
-0x87,0x77,0x45,0x87,0x77,0x60,0x87,0x01,0x00,0x77,0x06,0x20,0x01,0x05,0x29,0x06,
-0x01,0x9f,0x00,0x87,0x81,0x77,0x37,0xb0,0x07,0x80,0x01,0x77,0x9f,0x00,0xf2,0x03,
-0x00,0x37,0xa0,0x70,0x13,0x92,0xa0,0x84,0x32,0xb0,0x67,0x74,0x70,0x03,0x56,0x60,
-0x00,0x11,0x3d,0x02,0x01,0x33,0x00,0xf4,0x00,0xa1,0x91,0x26,0xb1,0x91,0x81,0x14,
-0xb0,0x37,0x63,0x50,0x04,0x77,0x90,0x04,0xd5,0x07,0x40,0x05,0x77,0x50,0x00,0x48,
-0x07,0x10,0x50,0x75,0x03,0x52,0x24,0x00,0x57,0x8a,0x77,0xa4,0x09,0xf1,0x00,0x07,
-0x77,0x80,0x08,0x78,0x70,0x23,0x39,0x33,0x24,0x44,0x43,0x06,0x77,0xb0,0x48,0x00,
-0x70,0x10,0x04,0x77,0xa0,0x06,0x88,0x90,0x4d,0x03,0x10,0x16,0xa5,0x08,0x15,0x08,
-0xe6,0x02,0x30,0x57,0x7a,0x00,0x16,0x00,0xf4,0x02,0x57,0xa7,0x00,0x47,0x69,0x66,
-0x00,0x67,0x79,0x00,0x06,0x66,0x90,0x00,0xa7,0x78,0x10,0x35,0x02,0x21,0x37,0x7b,
-0x59,0x07,0x61,0x76,0x76,0x10,0x57,0x7b,0x77,0x58,0x0e,0x62,0x6a,0x10,0x00,0x75,
-0x08,0x20,0x74,0x05,0x15,0x70,0x82,0x00,0x60,0x01,0x42,0x20,0x58,0xa9,0x96,0xcc,
-0x08,0xcb,0x67,0x7a,0x00,0x09,0x22,0x20,0x00,0x35,0x54,0x00,0x47,0x79,0x82,0x02,
-0x11,0x04,0x9e,0x00,0x92,0x07,0x77,0x70,0x57,0x77,0x77,0x03,0x16,0x30,0xd3,0x08,
-0x00,0xe8,0x08,0x24,0x67,0x79,0x34,0x00,0x58,0x58,0x87,0x97,0x00,0x53,0xe2,0x03,
-0x05,0x34,0x00,0x61,0x45,0x55,0x55,0x23,0x85,0x62,0x34,0x00,0x21,0xb0,0x00,0x8f,
-0x06,0x00,0xc9,0x25,0x01,0x00,0x04,0x02,0xe2,0x03,0xb0,0x05,0x77,0x90,0x07,0x77,
-0x80,0x09,0x33,0x30,0x02,0x44,0x34,0x09,0x02,0x5e,0x09,0x02,0x42,0x00,0xd7,0x08,
-0x77,0x60,0x06,0x77,0x70,0x57,0x76,0x66,0x06,0x77,0x90,0x06,0x76,0x04,0x03,0x2f,
-0x01,0xb4,0x77,0x70,0x35,0x55,0x54,0x23,0x33,0x32,0x0a,0x88,0xb0,0x98,0x08,0xf2,
-0x00,0x04,0x78,0x07,0x00,0x80,0x73,0x7b,0x07,0x80,0x00,0x78,0x33,0x37,0x13,0x31,
-0x16,0x06,0xc1,0x47,0xb0,0x70,0x37,0xb0,0x70,0x80,0x00,0x70,0x57,0x73,0x70,0xfd,
-0x00,0x06,0xe0,0x03,0xd0,0x47,0x90,0x70,0x02,0x90,0x70,0x85,0x40,0x70,0x77,0x74,
-0x70,0x01,0x58,0x03,0x12,0x10,0x58,0x0c,0x07,0x33,0x00,0x00,0x55,0x0c,0x44,0x07,
-0x00,0x80,0x08,0x55,0x0c,0x05,0x1b,0x00,0x2c,0x47,0x73,0x78,0x02,0x62,0x47,0xb0,
-0x80,0x37,0xb0,0x80,0x36,0x00,0x93,0x00,0x04,0x40,0x00,0x79,0x00,0x06,0x51,0x91,
-0xa6,0x0c,0x04,0x1b,0x00,0xf3,0x00,0x58,0x83,0x70,0x00,0x67,0x50,0x06,0x20,0x80,
-0x05,0x30,0x90,0x00,0x46,0x20,0xc6,0x03,0x00,0xb5,0x06,0x94,0x07,0x08,0x82,0x70,
-0x70,0x70,0x07,0x7b,0x07,0x49,0x04,0x30,0x57,0x90,0x70,0x28,0x28,0x71,0x70,0x80,
-0x77,0x14,0x67,0x07,0x00,0xfe,0x04,0x17,0x08,0xe6,0x05,0x40,0x05,0x79,0x08,0x00,
-0x31,0x00,0x5a,0x07,0x07,0x71,0x57,0x90,0xde,0x03,0xb1,0x20,0x07,0x7b,0x08,0x00,
-0x80,0x80,0x87,0x27,0x08,0x07,0x48,0x09,0xd1,0x41,0x8a,0x30,0x07,0x04,0x60,0x00,
-0xa4,0x85,0x20,0x01,0x03,0x50,0x68,0x09,0x10,0x7a,0x3c,0x00,0x81,0x87,0x17,0x28,
-0x08,0x00,0x25,0x50,0x50,0x41,0x02,0x09,0x34,0x0e,0x03,0x40,0x00,0x71,0x17,0x08,
-0x08,0x00,0x37,0x60,0x60,0xab,0x06,0x20,0x19,0x30,0xf2,0x08,0x12,0x01,0x21,0x00,
-0xf2,0x06,0x46,0x65,0x17,0x70,0x75,0x27,0x70,0x75,0x88,0x70,0x75,0x27,0x77,0x95,
-0x27,0x00,0x05,0x27,0x00,0x04,0x17,0x3b,0x04,0xf3,0x06,0x57,0x84,0x37,0x70,0x74,
-0x78,0x70,0x73,0x57,0x37,0x62,0x35,0x01,0x50,0x05,0x02,0xb8,0x78,0x01,0x96,0x67,
-0xcb,0x04,0x21,0x84,0x38,0x1b,0x00,0xd4,0x68,0x47,0x73,0x38,0x00,0x05,0x02,0x00,
-0x1c,0x30,0x02,0x90,0x65,0xb8,0x01,0xc2,0x70,0x70,0x77,0x07,0x5b,0x70,0x70,0x77,
-0x5a,0x07,0x01,0x10,0xb8,0x01,0xe0,0x57,0x90,0x07,0x80,0x70,0x27,0x70,0x71,0x57,
-0x67,0xa0,0x07,0x01,0x00,0x5f,0x07,0x11,0x06,0x04,0x0c,0x01,0x1b,0x00,0x93,0x70,
-0x80,0x73,0xb0,0x71,0x80,0x70,0x26,0x60,0x33,0x0b,0x14,0x07,0x7f,0x0a,0x21,0x46,
-0x60,0x7c,0x05,0x10,0x97,0x06,0x00,0x26,0x75,0x90,0x7c,0x05,0x03,0x36,0x00,0x90,
-0x74,0xb0,0x70,0x71,0x90,0x57,0x93,0xa0,0x01,0x31,0x05,0x04,0xee,0x01,0xf0,0x09,
-0x80,0x06,0x80,0x81,0x77,0x70,0x71,0x77,0x47,0x70,0x07,0x00,0x56,0x51,0x05,0x30,
-0x35,0x05,0x40,0x55,0x00,0x46,0x40,0x07,0x18,0x07,0x11,0x08,0xa7,0x04,0x15,0x67,
-0xad,0x07,0x01,0x4c,0x06,0x78,0xb0,0x08,0x00,0x70,0x04,0x8a,0x60,0xb0,0x07,0x10,
-0x00,0x91,0x0f,0x11,0x7b,0x46,0x05,0x43,0x47,0xb6,0x00,0x67,0x77,0x03,0x71,0x5a,
-0x00,0x00,0x66,0x19,0x10,0x01,0x65,0x07,0x62,0x90,0x00,0x80,0x07,0x10,0x09,0x2d,
-0x02,0x28,0x47,0x7b,0x65,0x03,0x02,0x1c,0x00,0x00,0xc1,0x09,0x00,0x7e,0x0c,0x01,
-0xe2,0x0d,0x24,0x50,0x00,0xb8,0x08,0xf3,0x0a,0x97,0x7a,0x10,0x08,0x77,0xa1,0x03,
-0x44,0x44,0x40,0x25,0x83,0x92,0x00,0x68,0x7a,0x20,0x07,0x66,0x81,0x00,0xa7,0x78,
-0x20,0x00,0xf0,0x00,0x25,0x80,0x70,0x01,0x00,0x52,0x75,0xa0,0x70,0x01,0x10,0x25,
-0x07,0x10,0x10,0xed,0x00,0x01,0x1b,0x00,0x4a,0x37,0x70,0x70,0x04,0xf6,0x02,0x00,
+0x10,0x08,0x09,0x06,0x98,0x13,0xf8,0xff,0xff,0xff,0xf7,0x72,0x1f,0xb5,0x21,0x50,
+0xab,0x54,0xab,0x58,0xab,0x60,0xab,0x62,0xab,0x65,0xab,0x69,0xab,0x6c,0xab,0x81,
+0xab,0xc0,0xab,0xc4,0xab,0xd0,0xab,0xdc,0xab,0xf0,0xab,0xf8,0xab,0xf9,0xab,0x00,
+0xac,0x0d,0xac,0x14,0xac,0x30,0xac,0x31,0xac,0x41,0xac,0x45,0xac,0x4c,0xac,0x50,
+0xac,0xa0,0xac,0xbc,0xac,0xbd,0xac,0xc5,0xac,0xdc,0xac,0x10,0xad,0x2c,0xad,0x30,
+0xad,0x48,0xad,0x49,0xad,0x4c,0xad,0x50,0xad,0x59,0xad,0x80,0xad,0x88,0xad,0x91,
+0xad,0x9c,0xad,0x0c,0xae,0x08,0xaf,0x94,0xaf,0xa4,0xaf,0xad,0xaf,0xe8,0xaf,0xf0,
+0xaf,0xf8,0xaf,0x04,0xb0,0x58,0xb0,0x60,0xb0,0x73,0xb0,0x74,0xb0,0xc8,0xb0,0xe2,
+0xb0,0x54,0xb1,0x5c,0xb1,0xc4,0xb1,0xe0,0xb1,0xe4,0xb1,0xf5,0xb1,0x18,0xb2,0x28,
+0xb2,0x29,0xb2,0x34,0xb2,0x38,0xb2,0x45,0xb2,0x50,0xb2,0xa4,0xb2,0xac,0xb2,0xbe,
+0xb2,0xc0,0xb2,0xc1,0xb2,0xc4,0xb2,0xc8,0xb2,0x14,0xb3,0x15,0xb3,0x29,0xb3,0x68,
+0xb3,0x6c,0xb3,0x78,0xb3,0xa0,0xb3,0xa8,0xb3,0xf4,0xb3,0x10,0xb4,0x18,0xb4,0x2c,
+0xb4,0x2d,0xb4,0x30,0xb4,0x34,0xb4,0x41,0xb4,0x64,0xb4,0x79,0xb4,0x80,0xb4,0x9c,
+0xb4,0x60,0xb5,0xec,0xb5,0x40,0xb6,0xcc,0xb6,0xd0,0xb6,0xdc,0xb6,0xe1,0xb6,0xe8,
+0xb6,0xe9,0xb6,0x19,0xb7,0x3c,0xb7,0x4c,0xb7,0x4d,0xb7,0x58,0xb7,0x59,0xb7,0x5c,
+0xb7,0x74,0xb7,0x75,0xb7,0x7c,0xb7,0xac,0xb7,0xad,0xb7,0xb0,0xb7,0xb4,0xb7,0xbf,
+0xb7,0x1c,0xb8,0x38,0xb8,0x49,0xb8,0xa8,0xb8,0xb8,0xb8,0xc4,0xb8,0xc8,0xb8,0xcc,
+0xb8,0xd4,0xb8,0xfc,0xb8,0xfd,0xb8,0x00,0xb9,0x0c,0xb9,0x0d,0xb9,0x0f,0xb9,0x11,
+0xb9,0x18,0xb9,0x19,0xb9,0x1c,0xb9,0x1e,0xb9,0x20,0xb9,0x2e,0xb9,0x34,0xb9,0x45,
+0xb9,0x47,0xb9,0x88,0xb9,0x8c,0xb9,0x90,0xb9,0xa4,0xb9,0xc4,0xb9,0xd5,0xb9,0xf8,
+0xb9,0xf9,0xb9,0x0b,0xba,0x84,0xba,0x88,0xba,0xfc,0xba,0x48,0xbb,0x49,0xbb,0x50,
+0xbb,0x5b,0xbb,0x5d,0xbb,0x5f,0xbb,0x64,0xbb,0x65,0xbb,0x68,0xbb,0x6c,0xbb,0x6d,
+0xbb,0x79,0xbb,0x80,0xbb,0x81,0xbb,0xd4,0xbb,0xd8,0xbb,0xdc,0xbb,0xe4,0xbb,0xe5,
+0xbb,0xf0,0xbb,0xf8,0xbb,0x10,0xbc,0x14,0xbc,0x44,0xbc,0x45,0xbc,0x48,0xbc,0x4c,
+0xbc,0x57,0xbc,0xd0,0xbc,0xd4,0xbc,0xd8,0xbc,0xe9,0xbc,0x40,0xbd,0x5c,0xbd,0x64,
+0xbd,0x94,0xbd,0x98,0xbd,0x9c,0xbd,0xb0,0xbd,0xb8,0xbd,0xe0,0xbf,0xfc,0xbf,0xfd,
+0xbf,0x00,0xc0,0x0d,0xc0,0x11,0xc0,0x18,0xc0,0x19,0xc0,0x28,0xc0,0x2d,0xc0,0x47,
+0xc0,0x6c,0xc0,0x6d,0xc0,0x70,0xc0,0x74,0xc0,0x81,0xc0,0x88,0xc0,0x89,0xc0,0x8c,
+0xc0,0x90,0xc0,0x9b,0xc0,0xa8,0xc0,0xdc,0xc0,0xdd,0xc0,0xe0,0xc0,0xf1,0xc0,0x30,
+0xc1,0x68,0xc1,0x6c,0xc1,0x7b,0xc1,0xf4,0xc1,0xfc,0xc1,0x05,0xc2,0x09,0xc2,0x2c,
+0xc2,0x2d,0xc2,0x30,0xc2,0x34,0xc2,0x3c,0xc2,0x41,0xc2,0x48,0xc2,0x40,0xc4,0x94,
+0xc4,0x95,0xc4,0x98,0xc4,0x9a,0xc4,0x9c,0xc4,0xa4,0xc4,0xa5,0xc4,0xa9,0xc4,0xae,
+0xc4,0xc0,0xc4,0xcc,0xc4,0xe1,0xc4,0x04,0xc5,0x08,0xc5,0x0c,0xc5,0x15,0xc5,0x16,
+0xc5,0x18,0xc5,0x20,0xc5,0x28,0xc5,0x3c,0xc5,0x3d,0xc5,0x40,0xc5,0x44,0xc5,0x51,
+0xc5,0x58,0xc5,0x74,0xc5,0x78,0xc5,0x7c,0xc5,0x85,0xc5,0x90,0xc5,0x94,0xc5,0xc8,
+0xc5,0xcc,0xc5,0xe4,0xc5,0xf9,0xc5,0x00,0xc6,0x04,0xc6,0x08,0xc6,0x10,0xc6,0x13,
+0xc6,0x1c,0xc6,0x20,0xc6,0x24,0xc6,0x38,0xc6,0x54,0xc6,0x70,0xc6,0x78,0xc6,0x8c,
+0xc6,0x90,0xc6,0x94,0xc6,0x9c,0xc6,0xa1,0xc6,0xa8,0xc6,0xc4,0xc6,0xc5,0xc6,0xc8,
+0xc6,0xcc,0xc6,0xcd,0xc6,0xd4,0xc6,0xd5,0xc6,0xd8,0xc6,0xe0,0xc6,0xe1,0xc6,0xe4,
+0xc6,0xe8,0xc6,0xf5,0xc6,0xfc,0xc6,0xfd,0xc6,0x50,0xc7,0x51,0xc7,0x54,0xc7,0x58,
+0xc7,0x60,0xc7,0x61,0xc7,0x65,0xc7,0x6c,0xc7,0x7f,0xc7,0x88,0xc7,0xc0,0xc7,0xc1,
+0xc7,0xc4,0xc7,0xd5,0xc7,0xdc,0xc7,0x4c,0xc8,0x50,0xc8,0x61,0xc8,0xd9,0xc8,0xe0,
+0xc8,0xed,0xc8,0x10,0xc9,0x11,0xc9,0x14,0xc9,0x20,0xc9,0x21,0xc9,0x2c,0xc9,0x48,
+0xc9,0x49,0xc9,0x0d,0xca,0x5d,0xcb,0x78,0xcb,0x88,0xcb,0x8c,0xcb,0x8e,0xcb,0x94,
+0xcb,0xfb,0xcb,0xfd,0xcb,0x04,0xcc,0x58,0xcc,0xac,0xcc,0xe4,0xcc,0xe5,0xcc,0xe8,
+0xcc,0xec,0xcc,0xf9,0xcc,0x38,0xcd,0x71,0xcd,0xa8,0xcd,0xbd,0xcd,0xc4,0xcd,0xe0,
+0xcd,0x34,0xce,0x38,0xce,0x3c,0xce,0x44,0xce,0x47,0xce,0x50,0xce,0x6c,0xce,0x7c,
+0xce,0xa4,0xce,0xac,0xce,0xbc,0xcf,0xc4,0xcf,0xcc,0xcf,0xf4,0xcf,0xfc,0xcf,0x10,
+0xd0,0x18,0xd0,0x20,0xd0,0x2c,0xd0,0x2d,0xd0,0x3d,0xd0,0x80,0xd0,0x84,0xd0,0x88,
+0xd0,0x90,0xd0,0x9c,0xd0,0x9d,0xd0,0xa0,0xd0,0xa4,0xd0,0xac,0xd0,0xf0,0xd0,0xf4,
+0xd0,0x05,0xd1,0x7c,0xd1,0x08,0xd2,0x09,0xd2,0x0c,0xd2,0x10,0xd2,0x40,0xd2,0x41,
+0xd2,0x5c,0xd2,0x6d,0xd2,0x78,0xd2,0xd4,0xd2,0xdc,0xd2,0xe8,0xd2,0xe9,0xd2,0x08,
+0xd3,0x19,0xd3,0x3c,0xd3,0x44,0xd3,0xac,0xd3,0xc8,0xd3,0x54,0xd4,0x5c,0xd4,0x8c,
+0xd4,0x90,0xd4,0x94,0xd4,0xa1,0xd4,0xa8,0xd4,0xa9,0xd4,0xac,0xd4,0xb0,0xd4,0xb8,
+0xd4,0xb9,0xd4,0xbd,0xd4,0xc4,0xd4,0xd9,0xd4,0xf5,0xd4,0x18,0xd5,0x28,0xd5,0x2d,
+0xd5,0x3c,0xd5,0x54,0xd5,0x65,0xd5,0x88,0xd5,0x90,0xd5,0x9d,0xd5,0xa4,0xd5,0xa5,
+0xd5,0xa8,0xd5,0xac,0xd5,0xb9,0xd5,0xdc,0xd5,0xf8,0xd5,0x14,0xd6,0x70,0xd6,0x84,
+0xd6,0xc0,0xd6,0xd8,0xd6,0x51,0xef,0x58,0xef,0x5b,0xef,0x5c,0xef,0x5d,0xef,0x61,
+0xef,0x63,0xef,0x65,0xef,0x69,0xef,0x6c,0xef,0x71,0xef,0x76,0xef,0x77,0xef,0x78,
+0xef,0x8e,0xef,0x93,0xef,0x98,0xef,0x9b,0xef,0x9c,0xef,0x9d,0xef,0xa1,0xef,0xa2,
+0xef,0xa3,0xef,0xa4,0xef,0xb7,0xef,0xb8,0xef,0xbe,0xef,0xc0,0xef,0xc1,0xef,0xc4,
+0xef,0xc7,0xef,0xc8,0xef,0xc9,0xef,0xcb,0xef,0xe3,0xef,0xe5,0xef,0x14,0xf0,0x15,
+0xf0,0x17,0xf0,0x19,0xf0,0x30,0xf0,0x37,0xf0,0x3a,0xf0,0x43,0xf0,0x6c,0xf0,0x74,
+0xf0,0xab,0xf0,0x3b,0xf1,0x90,0xf1,0x91,0xf1,0x92,0xf1,0x93,0xf1,0x94,0xf1,0xd7,
+0xf1,0xe3,0xf1,0x3d,0xf2,0x54,0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0x00,0x01,0x00,
+0x2f,0xfe,0x00,0x01,0x00,0x03,0x1b,0xf9,0x08,0x00,0x00,0x01,0x00,0xce,0xfd,0xfc,
+0x00,0xff,0xfc,0x00,0xfb,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x2f,0x01,0x01,0x17,
+0x00,0x01,0x2f,0xf5,0x00,0x01,0x00,0x15,0x1e,0xf2,0x1e,0x00,0x0e,0x90,0x00,0xb1,
+0xfc,0x00,0xff,0x00,0x00,0xf8,0xff,0xfb,0xfc,0x00,0xfa,0x11,0x00,0x00,0x0f,0x00,
+0x4d,0xff,0xff,0xfd,0xfe,0x7b,0x00,0x10,0xfe,0x1a,0x00,0x1f,0xfd,0x4a,0x00,0x01,
+0x1c,0xfe,0x0a,0x00,0x19,0xff,0x1f,0x00,0x03,0x0e,0x00,0x13,0xfa,0x0b,0x00,0x00,
+0x48,0x00,0x2a,0xff,0xfd,0x23,0x00,0x0d,0xfa,0x00,0x05,0x3c,0x00,0x11,0xff,0x34,
+0x00,0x26,0xff,0xfe,0x30,0x00,0x11,0xf1,0x04,0x01,0x15,0xf0,0x24,0x00,0x20,0xfe,
+0xff,0x20,0x00,0x01,0x2b,0x00,0x0d,0x44,0x00,0x10,0xfe,0x08,0x00,0x0e,0x91,0x01,
+0x0c,0x9b,0x00,0x0f,0x01,0x00,0x07,0x1b,0xfc,0xd1,0x01,0x10,0xfe,0x6b,0x00,0x00,
+0x70,0x00,0x11,0xfc,0x0f,0x00,0x14,0xeb,0x6c,0x00,0x97,0xfc,0x00,0x00,0xef,0xfd,
+0xf5,0xf7,0x00,0xf1,0xdc,0x01,0x25,0xf8,0xfa,0x0c,0x00,0x73,0xec,0x00,0x00,0x00,
+0xf7,0x00,0xf4,0x43,0x00,0x10,0xfe,0xac,0x00,0x00,0x7c,0x00,0x0f,0xe0,0x01,0x02,
+0x10,0xfd,0xd2,0x00,0x1f,0xfe,0x97,0x00,0x0b,0x1e,0xfb,0x8c,0x01,0x05,0x7f,0x01,
+0x93,0xf2,0xf2,0x00,0x00,0xfb,0xfe,0xf1,0xff,0x01,0x40,0x02,0xd3,0xf9,0xfa,0x00,
+0xf9,0xfa,0xfb,0xf9,0x00,0xfa,0xfc,0xfc,0xfb,0xfc,0x1a,0x01,0x66,0xf2,0xfe,0x00,
+0x00,0xfb,0xff,0x2b,0x01,0x62,0xfd,0xfd,0x00,0x00,0xfd,0xfe,0x4c,0x01,0x22,0x00,
+0x01,0x24,0x00,0x22,0xf8,0xfc,0x63,0x00,0x13,0x01,0x24,0x00,0x23,0xfe,0xfe,0x6c,
+0x01,0x08,0xa1,0x01,0x14,0xfd,0x76,0x00,0x15,0x01,0x82,0x00,0x02,0xb0,0x01,0x04,
+0x92,0x00,0xe0,0x01,0xfd,0xf3,0xfd,0x00,0x00,0xfa,0xfe,0xfa,0xff,0x01,0xfa,0x01,
+0x01,0x92,0x00,0x70,0xfb,0xfc,0xff,0xfe,0xfc,0xfe,0xfc,0xd3,0x01,0x36,0xff,0xfe,
+0x01,0xc5,0x00,0x09,0xa8,0x01,0x14,0xff,0x48,0x00,0x1e,0xfe,0xb2,0x01,0x1f,0xff,
+0xab,0x01,0x07,0x0f,0xe9,0x01,0x0d,0x1f,0xfe,0x24,0x00,0x0b,0x2e,0xff,0xff,0x14,
+0x02,0x0f,0x38,0x02,0x1f,0x14,0xff,0x80,0x02,0x1e,0x01,0xd7,0x02,0x1a,0xff,0xa1,
+0x02,0x2f,0xfa,0x00,0x01,0x00,0x24,0x0b,0x81,0x00,0x1f,0xf8,0xd8,0x00,0x10,0x1d,
+0x01,0x28,0x00,0x00,0xd0,0x01,0x01,0x93,0x00,0x10,0x03,0x2b,0x02,0x0f,0x6f,0x00,
+0x15,0x1b,0x01,0xc4,0x04,0x02,0xa7,0x03,0x1d,0x01,0x14,0x01,0x1f,0xf8,0xd8,0x00,
+0x24,0x1f,0xff,0x24,0x00,0x26,0x0f,0x3d,0x00,0x07,0x12,0x01,0x44,0x1d,0x9c,0x02,
+0x03,0x00,0x00,0x00,0x04,0x00,0x04,0x05,0x21,0x00,0x00,0xd3,0x09,0xf1,0x09,0x09,
+0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,
+0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,0xff,0x0d,0x1a,0x1b,0x1c,0x00,0x1d,
+0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,
+0x24,0x25,0x26,0x24,0x27,0x28,0x00,0x01,0x00,0xff,0xfe,0x0a,0x75,0x02,0x20,0x03,
+0x02,0x70,0x02,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,
+0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xa0,0x0b,0x00,0x0d,0x0e,0x0f,0x10,
+0x11,0x12,0x13,0x14,0xd7,0x1f,0x91,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,
+0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,
+0x1f,0x22,0x00,0x00,0x23,0x73,0x00,0x02,0x1f,0x24,0x6f,0x02,0xff,0xe9,0x50,0x00,
+0x00,0x00,0x00,0x00,0xf0,0xff,0x6f,0x56,0x56,0x55,0x34,0x34,0x77,0x25,0x50,0x00,
+0x86,0x21,0xaa,0xc6,0x06,0x29,0x04,0xc8,0xc4,0x08,0x35,0x00,0x00,0x00,0x00,0x1a,
+0x00,0x2b,0x5b,0x04,0x80,0x50,0x0a,0xb3,0x01,0x01,0xc0,0x66,0x1c,0x00,0x6c,0x20,
+0x00,0x10,0x00,0x67,0x70,0x20,0x36,0x47,0x00,0x00,0x58,0x82,0x02,0x68,0x17,0x03,
+0x07,0x84,0x0b,0xa6,0x00,0xb6,0x50,0x1a,0xb0,0x48,0x34,0xb6,0x39,0x8b,0x80,0x96,
+0x03,0x50,0x90,0x46,0x06,0x40,0x64,0x03,0x70,0x09,0x00,0x14,0x71,0x01,0x80,0x0a,
+0x00,0x82,0x09,0x20,0xa0,0x37,0x05,0x00,0x08,0x00,0x6d,0x92,0x37,0x80,0x00,0x00,
+0x01,0x80,0x00,0x1a,0x00,0x6a,0xda,0x20,0x1a,0x00,0x82,0x70,0x78,0x00,0x44,0x00,
+0x90,0x03,0x60,0x09,0x00,0x18,0x00,0x72,0x00,0x40,0x00,0x1a,0x97,0x07,0x30,0xb0,
+0x82,0x0b,0x07,0x40,0xb0,0x1a,0x97,0x00,0x18,0xb1,0x0b,0x00,0xb0,0x0b,0x00,0xb0,
+0x3a,0x98,0x04,0x10,0xb0,0x00,0x65,0x00,0x76,0x00,0x6c,0x88,0x10,0x3a,0x97,0x31,
+0x0b,0x04,0xc6,0x30,0x0b,0x3a,0x97,0x00,0x98,0x00,0x68,0x80,0x28,0x38,0x08,0x8a,
+0xc2,0x00,0x38,0x00,0x0d,0xaa,0x01,0xd9,0x60,0x01,0x0b,0x12,0x30,0x91,0x0a,0x98,
+0x00,0x06,0x82,0x03,0xb9,0x50,0x75,0x0b,0x06,0x50,0xa0,0x0a,0x97,0x00,0x69,0x9d,
+0x10,0x02,0x80,0x00,0x91,0x00,0x28,0x00,0x0a,0x10,0x00,0x1a,0x97,0x05,0x60,0xb0,
+0x1c,0xb7,0x07,0x30,0xb0,0x3a,0x99,0x00,0x3a,0x95,0x82,0x0b,0x19,0x8c,0x00,0x1b,
+0x07,0xa2,0x43,0x00,0x00,0x43,0x52,0x00,0x00,0x52,0x91,0x00,0x02,0x85,0x8a,0x10,
+0x07,0xa3,0x00,0x01,0x39,0x97,0x00,0x00,0x39,0x97,0x58,0x20,0x01,0x8a,0x3a,0x71,
+0x10,0x00,0x5a,0xb2,0x20,0x56,0x02,0x90,0x04,0x10,0x06,0x10,0x03,0x87,0x87,0x01,
+0x80,0x77,0x26,0x62,0x81,0x90,0x88,0x0a,0x09,0x08,0x36,0x87,0xa7,0x40,0x67,0x75,
+0x00,0x00,0xe2,0x00,0x05,0x79,0x00,0x0b,0x0a,0x10,0x3c,0x9b,0x70,0xa1,0x00,0xb0,
+0x5b,0x9a,0x15,0x60,0x74,0x5b,0x9c,0x15,0x60,0x47,0x5b,0x9b,0x20,0x09,0x9a,0x46,
+0x60,0x07,0x83,0x00,0x06,0x60,0x07,0x09,0x9a,0x30,0x5b,0x99,0x15,0x60,0x29,0x56,
+0x00,0xc5,0x60,0x39,0x5b,0x9a,0x10,0x5b,0x99,0x25,0x60,0x00,0x5b,0x97,0x05,0x60,
+0x00,0x5b,0x99,0x20,0x1a,0x00,0x02,0x0d,0x00,0xf2,0x0a,0x56,0x00,0x00,0x09,0x9a,
+0x55,0x60,0x04,0x83,0x19,0xa5,0x70,0x0c,0x08,0x99,0x70,0x56,0x00,0xb0,0x56,0x00,
+0xb0,0x5b,0x99,0xe0,0x09,0x00,0x10,0x47,0x01,0x00,0x20,0x00,0x0c,0x02,0x00,0xf1,
+0x06,0x50,0x0b,0x5a,0xa5,0x56,0x08,0x50,0x56,0x95,0x00,0x5d,0xc0,0x00,0x57,0x3a,
+0x00,0x56,0x04,0x90,0x56,0x00,0x42,0x00,0x01,0x54,0x00,0xf0,0x1f,0x00,0x5d,0x00,
+0x0d,0x55,0xc4,0x05,0xc5,0x56,0xa0,0xb6,0x55,0x67,0x77,0x65,0x56,0x1e,0x16,0x50,
+0x5c,0x00,0xb0,0x5b,0x80,0xb0,0x56,0x94,0xb0,0x56,0x0b,0xc0,0x56,0x02,0xf0,0x09,
+0x9a,0x30,0x66,0x00,0xc0,0x83,0x00,0xb0,0x66,0x00,0xc0,0x9e,0x00,0x73,0x9a,0x45,
+0x60,0x1b,0x5b,0x89,0x35,0x84,0x00,0xf1,0x23,0x30,0x65,0x00,0xc0,0x92,0x00,0xc0,
+0x65,0x00,0xc0,0x09,0x9c,0x40,0x00,0x02,0x80,0x5b,0x9a,0x25,0x60,0x47,0x5b,0xab,
+0x15,0x60,0xb0,0x56,0x04,0x70,0x2a,0x89,0x16,0x60,0x22,0x06,0x97,0x05,0x10,0x65,
+0x3a,0x9a,0x20,0x79,0xe9,0x50,0x0c,0x00,0x00,0xc0,0x00,0x05,0x00,0xf2,0x31,0x74,
+0x01,0xa7,0x40,0x1a,0x74,0x01,0xa6,0x50,0x2a,0x1a,0x9a,0x20,0xa1,0x00,0xb4,0x70,
+0x65,0x0a,0x0a,0x00,0x65,0x80,0x00,0xe1,0x00,0xa1,0x0d,0x10,0xb5,0x63,0xb6,0x38,
+0x1a,0x82,0xa7,0x30,0xba,0x09,0xb0,0x08,0x70,0x4a,0x00,0x67,0x07,0x60,0x95,0xa0,
+0x02,0xf2,0x00,0xa6,0xa0,0x67,0x07,0x70,0x93,0x06,0x61,0xa0,0xb0,0x06,0xb2,0x46,
+0x00,0xf2,0x02,0x59,0x9e,0x40,0x04,0x80,0x02,0xa0,0x00,0xb1,0x00,0x9b,0x99,0x40,
+0x59,0x06,0x40,0x64,0x03,0x00,0xf1,0x01,0x05,0x90,0x91,0x00,0x37,0x00,0x0a,0x00,
+0x05,0x50,0x00,0xa0,0x00,0x40,0x86,0x38,0x01,0x00,0xf0,0x33,0x96,0x05,0x00,0x1b,
+0x60,0x82,0xa0,0x88,0x85,0x47,0x39,0x96,0x18,0x7b,0x83,0x0b,0x4b,0x9b,0x74,0x00,
+0x07,0xa9,0x80,0x74,0x0a,0x07,0x40,0xa0,0x7a,0x98,0x00,0x19,0x97,0x82,0x04,0x92,
+0x03,0x2a,0x96,0x00,0x0b,0x2b,0x8d,0x83,0x0b,0x82,0x0b,0x2a,0x8d,0x19,0x97,0x89,
+0x8a,0x94,0x00,0x2b,0x87,0x08,0x71,0xa0,0x7d,0x41,0xa0,0x1a,0x01,0xa0,0x19,0x00,
+0xc0,0x83,0x0b,0x2b,0x9d,0x18,0x97,0x74,0x00,0x7a,0xa8,0x74,0x0b,0x02,0x00,0x71,
+0x43,0x65,0x65,0x65,0x65,0x04,0x20,0x79,0x00,0xf0,0x01,0x42,0xb2,0x74,0x00,0x07,
+0x48,0x60,0x7b,0x70,0x07,0x8b,0x00,0x74,0x39,0x00,0x65,0x01,0x00,0xe4,0x7a,0xaa,
+0x9b,0x37,0x40,0xc0,0x47,0x74,0x0b,0x04,0x77,0x40,0xb0,0x47,0x36,0x00,0xf0,0x02,
+0x19,0x98,0x08,0x20,0x91,0x82,0x09,0x11,0xa8,0x70,0x7a,0x88,0x07,0x40,0xa0,0x74,
+0x0b,0x89,0x00,0x24,0x00,0x00,0x7a,0x00,0xf2,0x0b,0x00,0x0b,0x00,0x07,0xb5,0x74,
+0x07,0x40,0x74,0x00,0x3a,0xa5,0x49,0x32,0x22,0x68,0x3a,0x96,0x38,0x09,0xc2,0x38,
+0x02,0x80,0x0c,0x30,0x3f,0x00,0xf0,0x28,0x2b,0x9c,0xa1,0x38,0x46,0x82,0x0a,0xa0,
+0x08,0x60,0xa0,0x77,0x0a,0x64,0x99,0x45,0x1b,0x77,0xa1,0x0c,0x22,0xb0,0x75,0x66,
+0x0a,0xa0,0x0a,0xa0,0x75,0x57,0xa1,0x37,0x46,0x81,0x09,0x80,0x08,0x30,0x69,0x00,
+0x59,0xc7,0x02,0xb0,0x0b,0x10,0x8b,0x86,0x00,0x00,0x75,0x0b,0x00,0xb0,0x96,0x27,
+0x03,0x41,0x75,0x00,0x00,0x54,0x01,0x00,0xf0,0x59,0x22,0x00,0x08,0x30,0x29,0x01,
+0xa0,0x0a,0x40,0xa0,0x29,0x08,0x30,0x00,0x00,0x19,0x70,0x74,0x23,0x95,0x00,0x00,
+0x20,0x00,0x00,0x00,0xc9,0x00,0x1b,0xaa,0xa5,0x90,0x18,0x00,0x00,0x86,0x1d,0xaa,
+0x93,0xa0,0x00,0x00,0xba,0x00,0x00,0x00,0x40,0x00,0x00,0x02,0x00,0x00,0x00,0x4f,
+0x00,0x00,0x04,0x98,0xaa,0xa6,0x0c,0x00,0x00,0x18,0x05,0x76,0xaa,0xb8,0x00,0x6e,
+0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x07,0x20,0x00,0x08,0x7b,0x10,0x08,0x60,0x1b,
+0x11,0xad,0x08,0xb5,0x00,0xa0,0x91,0x00,0x0a,0x09,0x10,0x00,0xaa,0xd1,0x00,0x00,
+0x6a,0xa0,0x0b,0x00,0x00,0x12,0x00,0xe1,0x8d,0x08,0x94,0x0a,0x60,0x1c,0x20,0x0b,
+0x3a,0x30,0x00,0x0c,0x50,0x00,0x01,0x00,0xf1,0x20,0x06,0x60,0x00,0x00,0x0d,0xd0,
+0x00,0x00,0x77,0x87,0x00,0x00,0xd0,0x0d,0x00,0x08,0x60,0x06,0x80,0x1f,0xee,0xee,
+0xf1,0x00,0x02,0xa4,0x00,0x79,0xc1,0xc0,0x77,0x0f,0xd9,0x0b,0x02,0xf6,0xa0,0xb0,
+0x32,0x0b,0x08,0x50,0x05,0x90,0x08,0xbb,0x80,0x34,0x00,0xf1,0x40,0x13,0x32,0x00,
+0x02,0x6c,0xf6,0x60,0x09,0x52,0x71,0xa2,0x1b,0x00,0x00,0x66,0x0b,0x00,0x00,0x65,
+0x07,0x70,0x02,0xb0,0x00,0x8a,0xaa,0x20,0x00,0x02,0x10,0x00,0x00,0x30,0x00,0x00,
+0x0a,0xbd,0xab,0x40,0x1c,0x28,0x70,0x93,0x0c,0xbb,0x30,0x19,0x0b,0x01,0x00,0x19,
+0x07,0x60,0x00,0xa3,0x00,0x6b,0xba,0x30,0x06,0xcc,0xc8,0x0c,0x30,0x65,0x0d,0x01,
+0xb0,0x3e,0x3a,0x00,0xb8,0x7c,0x00,0xb2,0x1b,0x00,0x4b,0xb5,0x54,0x00,0xf1,0x71,
+0x99,0x10,0x57,0xdd,0x85,0x71,0x55,0x17,0x71,0x66,0x17,0x72,0xbb,0x37,0x70,0x00,
+0x07,0x47,0xff,0x84,0x00,0x66,0x10,0x00,0x01,0x30,0x06,0x08,0xdb,0xc0,0x99,0xc0,
+0x00,0x07,0x05,0x80,0x00,0x71,0x81,0x00,0x0b,0xab,0x00,0x00,0x30,0x7e,0xdc,0x00,
+0x00,0x01,0x00,0x68,0x86,0x66,0x77,0x53,0x9a,0x77,0x78,0xec,0x73,0x30,0x06,0x79,
+0x80,0x06,0x76,0x60,0x06,0x9c,0xc7,0x79,0x00,0x28,0x96,0x00,0x04,0xa9,0x85,0xb0,
+0x0c,0x07,0x80,0x66,0x19,0x05,0x63,0x19,0x0b,0x8b,0x5a,0x88,0x07,0xb2,0x03,0xd2,
+0x00,0x6b,0xba,0x20,0x02,0x97,0x00,0x00,0x0a,0x14,0x73,0x30,0x0b,0x02,0xbf,0xf4,
+0x04,0xde,0x9f,0xf5,0x08,0x5a,0xff,0xe0,0x0a,0x5f,0xff,0xf5,0x0d,0xcb,0xbb,0xb4,
+0x43,0x01,0xf0,0x02,0x03,0x90,0x00,0x16,0x65,0x9a,0x00,0x1a,0xaa,0xaa,0x60,0x05,
+0xfe,0xef,0xf2,0x00,0x49,0x14,0x00,0x12,0x70,0x29,0x01,0xf0,0x0b,0x04,0x72,0x00,
+0x00,0x04,0x77,0x80,0x00,0x04,0x66,0x20,0x00,0x54,0x93,0x00,0x0c,0x47,0x4b,0x00,
+0x1f,0x3d,0x3e,0x00,0x03,0x85,0x93,0xd8,0x00,0x92,0xa0,0x07,0xc3,0xa0,0x08,0x5a,
+0xa0,0x00,0x0a,0x03,0x00,0xf1,0x2b,0xaa,0xaa,0xa9,0x00,0x46,0x10,0x00,0x05,0x40,
+0x87,0x20,0x08,0x00,0x01,0x80,0x35,0x6a,0xb5,0x70,0x60,0x37,0x40,0x62,0x34,0x0b,
+0x90,0x24,0x06,0x77,0x77,0x70,0x00,0x00,0x0a,0x00,0x00,0x00,0x1d,0x81,0x02,0xb9,
+0xb7,0x80,0x09,0x10,0xb5,0x80,0x0a,0x00,0x2d,0x00,0x09,0x00,0x1c,0x00,0x27,0x00,
+0x1c,0x6c,0x00,0xf0,0x01,0x37,0x33,0x73,0x27,0x05,0xe0,0x10,0x00,0x29,0x82,0x01,
+0x8b,0x38,0x20,0x39,0x98,0x87,0x00,0xf0,0x08,0x77,0x28,0x00,0x00,0x52,0x80,0x00,
+0x08,0x08,0x72,0x06,0x30,0x70,0x04,0x50,0x07,0x00,0x10,0x00,0x80,0x00,0x00,0x06,
+0x2f,0x00,0xf2,0x22,0x02,0x68,0x28,0x00,0x00,0x71,0x80,0x00,0x17,0x08,0x71,0x37,
+0x00,0x80,0x01,0x20,0x07,0x00,0x08,0x00,0x00,0x00,0x97,0x77,0x00,0x00,0x00,0x10,
+0x03,0x79,0x28,0x00,0x00,0x80,0x87,0x10,0x64,0x07,0x00,0x43,0x00,0x40,0x00,0x58,
+0x7a,0x00,0x07,0x77,0x90,0x1c,0x00,0x00,0x01,0x00,0xf1,0x0a,0x20,0x02,0x79,0x38,
+0x00,0x00,0x71,0x87,0x10,0x37,0x07,0x00,0x46,0x00,0x60,0x00,0x67,0x78,0x00,0x08,
+0x00,0x80,0x00,0x96,0x6a,0x1e,0x00,0xf1,0x09,0x27,0x82,0x70,0x00,0x06,0x28,0x00,
+0x02,0x80,0x87,0x13,0x60,0x06,0x00,0x06,0x05,0x60,0x00,0xa7,0x7c,0x00,0x09,0x7b,
+0x35,0x75,0x00,0x12,0x78,0x75,0x00,0xf0,0x05,0x18,0x08,0x72,0x37,0x00,0x70,0x00,
+0x07,0x74,0x00,0x08,0x10,0x80,0x00,0x73,0x09,0x00,0x00,0x56,0x10,0x59,0x00,0x31,
+0x03,0x79,0x38,0x79,0x00,0xf4,0x00,0x55,0x08,0x00,0x44,0x00,0x50,0x00,0x77,0x77,
+0x00,0x09,0x77,0x60,0x00,0xa7,0x79,0x00,0xf0,0x21,0x00,0x47,0x67,0x07,0x00,0x87,
+0x07,0x03,0x57,0x77,0x08,0x07,0x07,0x45,0x07,0x07,0x40,0x07,0x07,0x00,0x06,0x07,
+0x00,0x00,0x00,0x15,0x60,0x56,0x00,0x90,0xba,0x04,0x50,0x77,0x36,0x00,0x67,0x00,
+0x17,0x62,0x00,0x90,0x08,0x00,0x90,0x18,0x00,0x16,0xaf,0x02,0xf2,0x03,0x17,0x75,
+0x07,0x00,0x17,0x07,0x00,0x73,0x57,0x02,0x61,0x27,0x18,0x00,0x07,0x10,0x00,0x07,
+0x01,0x01,0xf2,0x06,0x37,0x90,0x70,0x00,0x80,0x70,0x03,0x65,0xb0,0x46,0x00,0x70,
+0x02,0x00,0x70,0x08,0x00,0x00,0x08,0x77,0x70,0xdf,0x00,0xf2,0x07,0x37,0x91,0x80,
+0x00,0x95,0xb0,0x05,0x50,0x70,0x44,0x00,0x70,0x04,0x77,0x70,0x08,0x00,0x80,0x07,
+0x66,0xb0,0x00,0xdd,0x00,0xf2,0x07,0x70,0x77,0x00,0x80,0x77,0x00,0x87,0x77,0x05,
+0x30,0x77,0x18,0x00,0x77,0x30,0x00,0x77,0x00,0x00,0x67,0x00,0x00,0xdc,0x00,0xf1,
+0x00,0x07,0x80,0x00,0x90,0x78,0x00,0x55,0x78,0x80,0x45,0x00,0x88,0x00,0x03,0x04,
+0x3e,0x03,0x52,0x46,0x97,0x90,0x01,0x01,0x3b,0x00,0xe5,0x75,0x07,0x00,0x18,0x77,
+0x00,0x71,0x07,0x03,0x63,0x67,0x27,0x00,0x17,0x89,0x00,0xf0,0x01,0x17,0x74,0x07,
+0x00,0x45,0x78,0x01,0x93,0x77,0x27,0x00,0x07,0x02,0x77,0x74,0x00,0x88,0x01,0x22,
+0x07,0x00,0xd3,0x01,0xf3,0x05,0x82,0x70,0x00,0x83,0xb1,0x05,0x55,0xb0,0x43,0x00,
+0x50,0x04,0x87,0xa0,0x05,0x77,0x90,0x08,0x77,0x71,0x1b,0x00,0xf2,0x05,0x90,0x80,
+0x00,0x84,0xc0,0x04,0x56,0xb0,0x46,0x00,0x80,0x00,0x77,0x40,0x06,0x20,0x80,0x06,
+0x40,0x90,0x46,0x01,0xf2,0x03,0x37,0x70,0x77,0x00,0x84,0x77,0x00,0x72,0x78,0x06,
+0x57,0x78,0x17,0x00,0x78,0x40,0x00,0x78,0xa4,0x00,0x31,0x06,0x77,0x50,0x5d,0x00,
+0x10,0x10,0x11,0x02,0xd0,0x00,0x00,0x80,0x00,0x06,0x7a,0x77,0x70,0x05,0x77,0xa0,
+0x00,0x02,0x0e,0x00,0x82,0x30,0x05,0x78,0x77,0x70,0x06,0x77,0x70,0x7d,0x00,0x10,
+0x60,0x64,0x00,0x00,0x1c,0x00,0xf3,0x02,0x10,0x70,0x00,0x80,0x30,0x57,0x97,0x77,
+0x05,0x00,0x40,0x09,0x77,0xb0,0x09,0x77,0xa0,0x18,0x00,0x20,0x30,0x80,0x18,0x00,
+0xa3,0x87,0x76,0x01,0x77,0x20,0x08,0x00,0x80,0x08,0x21,0x7c,0x00,0xf5,0x06,0x04,
+0x77,0x37,0x00,0x00,0x08,0x70,0x00,0x20,0x77,0x00,0x07,0x16,0x77,0x10,0x70,0x07,
+0x00,0x68,0x77,0x80,0xd0,0x00,0x51,0x00,0x00,0x01,0x77,0x67,0x20,0x00,0x82,0x70,
+0x57,0x71,0x5b,0x77,0x80,0x00,0x10,0x76,0x02,0x21,0x77,0x77,0x9d,0x00,0x00,0x9c,
+0x02,0xd2,0x80,0x06,0x17,0x70,0x06,0x17,0x00,0x59,0x8a,0x77,0x04,0x77,0x90,0x39,
+0x00,0x51,0x70,0x03,0x66,0x67,0x71,0x28,0x00,0x02,0xbc,0x02,0x31,0x06,0x77,0xa0,
+0x0b,0x00,0x91,0x30,0x57,0x8a,0x77,0x06,0x8a,0x70,0x00,0x00,0x03,0x00,0x00,0x97,
+0x00,0xf1,0x06,0xa2,0x00,0x00,0x06,0x20,0x34,0x44,0x54,0x01,0x33,0x93,0x20,0x07,
+0xa3,0x76,0x00,0x89,0x00,0x70,0x0b,0x72,0xee,0x02,0x03,0x09,0x02,0xb0,0x07,0x07,
+0x24,0x49,0x17,0x15,0x54,0x77,0x01,0x10,0x07,0x66,0x01,0x30,0x77,0x74,0x00,0x06,
+0x00,0x30,0x07,0x00,0x08,0x1b,0x00,0xc0,0x00,0x02,0x17,0x37,0xb5,0x27,0x00,0x80,
+0x07,0x00,0x70,0x07,0x2b,0x04,0x20,0x77,0x75,0x7d,0x00,0x00,0x73,0x00,0x70,0x66,
+0x67,0x84,0x00,0x80,0x80,0x00,0x34,0x00,0x61,0x60,0x60,0x00,0x06,0x77,0x90,0x18,
+0x00,0xd4,0x50,0x57,0xa7,0xa7,0x02,0x80,0x70,0x08,0x10,0x10,0x09,0x77,0x71,0xc0,
+0x00,0x03,0x8c,0x00,0x44,0x57,0x77,0x76,0x05,0xc0,0x00,0x34,0x30,0x05,0x77,0x5a,
+0x01,0x11,0x10,0x1e,0x00,0x00,0xab,0x00,0x13,0x80,0x43,0x00,0x31,0x77,0x77,0x04,
+0x95,0x01,0x40,0x09,0x77,0x71,0x05,0xd8,0x00,0xe1,0x70,0x23,0x33,0x53,0x23,0x44,
+0x33,0x06,0x77,0xa0,0x07,0x66,0x90,0x0a,0xee,0x01,0x01,0x49,0x00,0x01,0xf0,0x00,
+0x64,0x77,0x77,0x05,0x00,0x50,0x0a,0x87,0x01,0x00,0xbc,0x00,0x11,0x76,0xbc,0x00,
+0x67,0x53,0x07,0x01,0x80,0x07,0x08,0xdd,0x02,0xca,0x27,0x83,0x70,0x00,0x71,0x71,
+0x06,0x60,0x70,0x32,0x00,0x40,0x39,0x02,0xf3,0x08,0x01,0x27,0x82,0x08,0x00,0x71,
+0x08,0x03,0x70,0x07,0x46,0x00,0x05,0x06,0x00,0x05,0x07,0x77,0x87,0x07,0x66,0x76,
+0x00,0xd8,0x05,0xf3,0x08,0x67,0x48,0x00,0x00,0x81,0x78,0x00,0x02,0x54,0x48,0x71,
+0x07,0x08,0x07,0x00,0x06,0x17,0x07,0x00,0x00,0x20,0x07,0x00,0xc1,0x01,0xf1,0x00,
+0x38,0x56,0x07,0x08,0x08,0x07,0x08,0x09,0x77,0x25,0x44,0x07,0x60,0x80,0x07,0x1a,
+0x00,0xf7,0x00,0x07,0x05,0x93,0x75,0x00,0x07,0x00,0x70,0x00,0x70,0x16,0x04,0x67,
+0x67,0x82,0xa7,0x01,0x70,0x17,0x55,0x70,0x00,0x08,0x07,0x10,0x39,0x01,0x60,0x43,
+0x08,0x00,0x01,0x00,0x10,0xc5,0x04,0xd0,0x17,0x95,0xa0,0x00,0x80,0x70,0x01,0x20,
+0x40,0x57,0x77,0x77,0x06,0x5b,0x03,0x24,0x70,0x0a,0xcc,0x00,0xf3,0x05,0x17,0xa5,
+0xb0,0x00,0x70,0x80,0x24,0x32,0x52,0x34,0x44,0x44,0x08,0x77,0x60,0x0a,0x77,0x70,
+0x0a,0x77,0x47,0x05,0x11,0x05,0x60,0x04,0x50,0x80,0x08,0x00,0x09,0x70,0x07,0x00,
+0x22,0x77,0x37,0x99,0x01,0x11,0x07,0xb4,0x00,0x01,0x1c,0x00,0xa0,0x97,0x08,0x44,
+0x47,0x00,0x13,0x30,0x50,0x00,0x68,0xac,0x04,0x16,0x80,0x33,0x04,0x14,0x10,0x20,
+0x00,0x91,0x01,0x17,0x00,0x37,0x62,0x60,0x00,0x77,0x76,0x10,0x00,0x24,0xa6,0x69,
+0x92,0x02,0x40,0x50,0x07,0x07,0x80,0x03,0x00,0x84,0x78,0x80,0x07,0x07,0x75,0x68,
+0x07,0x01,0x53,0x04,0x02,0x77,0x00,0xc4,0x08,0x00,0x08,0x08,0x05,0x78,0x07,0x00,
+0x08,0x0a,0x67,0x08,0x9a,0x03,0x00,0x73,0x00,0xf2,0x03,0x08,0x07,0x78,0x09,0x23,
+0x08,0x05,0x53,0x05,0x02,0x87,0x76,0x03,0x77,0x76,0x04,0x87,0x75,0x04,0x04,0xf3,
+0x09,0x08,0x00,0x08,0x07,0x07,0x79,0x0b,0x77,0x08,0x00,0x35,0x34,0x04,0x79,0x85,
+0x00,0x58,0x60,0x02,0x70,0x46,0x00,0x47,0x60,0x69,0x00,0x40,0x08,0x07,0x80,0x6b,
+0x6f,0x00,0x26,0x76,0x78,0x69,0x00,0x12,0x04,0x32,0x01,0x00,0x39,0x01,0xb2,0x58,
+0x77,0x00,0x00,0x43,0x00,0x06,0x79,0x97,0x70,0x07,0x15,0x00,0xf2,0x02,0x04,0x7b,
+0x70,0x05,0x77,0xa7,0x70,0x06,0x77,0x71,0x00,0x25,0x05,0x00,0x08,0xa7,0xb3,0xf2,
+0x00,0x01,0x1c,0x00,0x12,0x09,0x1e,0x01,0x55,0x47,0x7a,0x77,0x00,0x00,0x63,0x03,
+0x13,0x01,0x4d,0x02,0xfd,0x01,0x60,0x24,0x44,0x44,0x13,0x39,0x32,0x05,0x78,0xa0,
+0x07,0x67,0x90,0x0a,0x77,0x81,0x37,0x00,0x30,0x59,0x87,0xb7,0x97,0x01,0x21,0x04,
+0x30,0x0e,0x00,0x02,0x84,0x02,0x10,0x08,0x6c,0x02,0x02,0xbe,0x02,0x23,0x77,0x07,
+0x0f,0x00,0x53,0x60,0x57,0x77,0x77,0x02,0x55,0x00,0x21,0x70,0x06,0x09,0x00,0x10,
+0x04,0x15,0x00,0x93,0x76,0x00,0x66,0x10,0x08,0x10,0x90,0x08,0x20,0xf9,0x03,0x10,
+0x05,0x41,0x03,0x12,0x07,0x4a,0x03,0x65,0x0a,0x67,0x07,0x01,0x00,0x07,0xf6,0x03,
+0x12,0x06,0x47,0x01,0xe8,0x00,0x07,0x08,0x77,0x07,0x01,0x77,0x74,0x04,0x40,0x08,
+0x03,0x96,0x77,0x1b,0x00,0x00,0x0c,0x01,0xb3,0x76,0x05,0x03,0x30,0x06,0x04,0x97,
+0x77,0x04,0x86,0x66,0x3b,0x07,0x22,0x77,0x17,0xf4,0x01,0x87,0x08,0x71,0x80,0x00,
+0x70,0x07,0x77,0x47,0xf4,0x01,0x34,0x05,0x77,0x08,0x1c,0x00,0x25,0x67,0x74,0x46,
+0x04,0x26,0xa7,0x77,0x1c,0x00,0xf7,0x03,0x83,0x08,0x00,0x08,0x40,0x37,0x63,0x50,
+0x00,0x60,0x06,0x00,0x0a,0x77,0xb0,0x00,0x97,0x7a,0x43,0x06,0x05,0xf0,0x01,0x45,
+0x76,0x68,0x07,0x00,0xf0,0x01,0x00,0x72,0x00,0xd4,0x80,0x00,0x88,0x02,0x7b,0x80,
+0x00,0x87,0x66,0x48,0x01,0x00,0x70,0xc0,0x00,0xf4,0x04,0x57,0x70,0x70,0x80,0x07,
+0xb0,0x82,0x22,0x70,0x25,0x41,0x50,0x05,0x77,0xa0,0x06,0x77,0x90,0x09,0x86,0x05,
+0xf3,0x06,0x67,0x72,0x52,0x80,0x06,0xa2,0x80,0x00,0x61,0x37,0x75,0x51,0x05,0x77,
+0x71,0x00,0x60,0x60,0x06,0xb7,0xb2,0x68,0x00,0x11,0x47,0x68,0x00,0x02,0xef,0x01,
+0x19,0x77,0x58,0x02,0xf2,0x03,0x57,0x37,0x08,0x80,0x3a,0x08,0x80,0x29,0x07,0x57,
+0x67,0x07,0x03,0x56,0x63,0x00,0x11,0x18,0xff,0x01,0x00,0x1b,0x00,0x13,0x38,0x25,
+0x02,0x11,0x67,0x8b,0x02,0x64,0x07,0x00,0x01,0x07,0x77,0x75,0x1b,0x00,0xa0,0x08,
+0x80,0x6b,0x08,0x80,0x18,0x08,0x37,0x55,0x05,0x73,0x02,0x53,0x77,0x76,0x06,0x77,
+0x75,0xd7,0x05,0x12,0x70,0x41,0x00,0xd0,0x57,0x76,0x00,0x00,0x35,0x00,0x06,0x78,
+0x97,0x70,0x09,0x77,0x50,0xaa,0x01,0x51,0x8a,0x70,0x56,0x78,0x66,0x7b,0x04,0x45,
+0x71,0x00,0x00,0x60,0x15,0x00,0x21,0x57,0x89,0xbf,0x01,0x16,0x20,0xbf,0x01,0xf2,
+0x06,0x00,0x47,0x73,0x70,0x08,0x00,0x07,0x00,0x80,0x00,0x70,0x03,0x77,0x48,0x00,
+0x03,0x50,0x80,0x07,0x88,0x79,0x72,0x01,0x01,0x01,0x00,0x21,0x0a,0x76,0xa9,0x01,
+0x50,0xa6,0x08,0x36,0xb7,0x18,0xf5,0x03,0x56,0x30,0x01,0x04,0x97,0x73,0x18,0x00,
+0xd0,0xb6,0x08,0x46,0x96,0x18,0x02,0x77,0x73,0x06,0x20,0x07,0x05,0x87,0x87,0x01,
+0x00,0x4c,0x07,0x0f,0xa4,0x02,0x05,0x10,0x00,0x18,0x00,0xc2,0x50,0x09,0x77,0x70,
+0x23,0x33,0x33,0x24,0x4a,0x43,0x05,0x78,0xeb,0x04,0x13,0x81,0x1b,0x00,0x10,0x76,
+0xca,0x04,0x90,0x09,0x77,0x07,0x00,0x01,0x17,0x37,0xb5,0x17,0x8f,0x05,0x10,0x80,
+0x8f,0x05,0x3f,0x08,0x77,0x60,0xbf,0x02,0x06,0x08,0x52,0x00,0x92,0x36,0x85,0xa4,
+0x06,0x87,0xb0,0x07,0x66,0x80,0x3d,0x05,0x32,0x06,0x77,0x40,0xda,0x02,0x30,0x06,
+0x77,0x60,0xb1,0x01,0x23,0x77,0x77,0x06,0x01,0x41,0x77,0x70,0x56,0x66,0x1b,0x01,
+0x00,0xe4,0x00,0x61,0x60,0x08,0x77,0x50,0x00,0x80,0xff,0x02,0x02,0x6b,0x09,0x01,
+0xaf,0x00,0x02,0x42,0x00,0x00,0x4e,0x03,0x90,0x09,0x77,0x70,0x22,0x22,0x22,0x34,
+0x55,0x44,0x98,0x05,0x13,0x77,0x98,0x05,0x05,0x49,0x00,0x23,0x57,0x66,0x4f,0x01,
+0x14,0x07,0x4f,0x01,0x30,0x47,0x71,0x70,0x5e,0x08,0x01,0x03,0x00,0x34,0x77,0x74,
+0x80,0x1a,0x06,0x02,0x4e,0x02,0x20,0x80,0x80,0x14,0x05,0xb5,0x70,0x47,0x74,0x70,
+0x00,0x67,0x30,0x07,0x10,0x80,0x07,0x44,0x03,0xf3,0x01,0x75,0x68,0x00,0x80,0x80,
+0x80,0x08,0x08,0x08,0x71,0x80,0x80,0x70,0x08,0x78,0x78,0x80,0x06,0x00,0x37,0x00,
+0xf4,0x01,0x45,0x73,0x77,0x70,0x70,0x77,0x70,0x70,0xaa,0x70,0x70,0x77,0x74,0x94,
+0x77,0x01,0x79,0x08,0xf0,0x06,0x08,0x56,0x71,0x02,0x50,0x80,0x00,0x25,0x08,0x00,
+0x00,0x76,0x67,0x10,0x00,0x24,0x00,0x06,0x78,0x97,0x70,0xf3,0x09,0x09,0x67,0x71,
+0x00,0x80,0x80,0x00,0x0a,0x78,0x72,0x00,0x00,0x00,0x00,0x47,0x7a,0x77,0x00,0x00,
+0x80,0x00,0x00,0x07,0x00,0x01,0x00,0xf0,0x29,0x57,0x67,0x07,0x80,0x70,0x07,0x67,
+0x77,0x07,0x00,0x01,0x17,0x47,0xb5,0x17,0x00,0x80,0x07,0x00,0x70,0x07,0x00,0x00,
+0x01,0x00,0x00,0x00,0x04,0x78,0x08,0x00,0x00,0x80,0x80,0x04,0x7b,0x08,0x72,0x80,
+0x00,0x70,0x08,0x00,0x17,0x00,0x37,0x41,0x70,0x00,0x00,0x08,0x00,0x00,0x00,0x10,
+0x00,0x20,0x00,0x11,0x79,0x20,0x00,0xf1,0x02,0x07,0x77,0x08,0x71,0x77,0x73,0x70,
+0x00,0x10,0x07,0x00,0x07,0x00,0x10,0x00,0x97,0x77,0x1c,0x00,0xf1,0x08,0x7a,0x08,
+0x00,0x02,0x80,0x80,0x08,0x65,0x08,0x71,0x56,0x63,0x70,0x00,0x57,0x77,0x00,0x08,
+0x00,0x70,0x00,0x97,0x7a,0x74,0x00,0xf0,0x0c,0x01,0x00,0x20,0x03,0x6a,0x08,0x00,
+0x47,0xa0,0x87,0x18,0x00,0x08,0x00,0x58,0x84,0x70,0x00,0x16,0x74,0x00,0x08,0x00,
+0x80,0x00,0x57,0x68,0x1f,0x00,0xf3,0x05,0x37,0x67,0x07,0x00,0x87,0x07,0x37,0x97,
+0x79,0x80,0x07,0x07,0x83,0x47,0x07,0x14,0x27,0x07,0x00,0x06,0xb0,0x00,0xf2,0x03,
+0x37,0x77,0x08,0x13,0x88,0x48,0x83,0x27,0x38,0x57,0x78,0x08,0x02,0x56,0x63,0x00,
+0x11,0x18,0x90,0x00,0x01,0x8e,0x00,0x98,0x07,0x00,0x24,0xa0,0x87,0x18,0x21,0x08,
+0x71,0x52,0x00,0x11,0x67,0x37,0x00,0xf1,0x1d,0x80,0x07,0x00,0x80,0x07,0x37,0xb1,
+0x77,0x80,0x00,0x07,0x83,0x43,0x07,0x14,0x31,0x07,0x00,0x00,0x06,0x00,0x00,0x10,
+0x37,0xb0,0x71,0x37,0xb2,0xb1,0x80,0x00,0x71,0x47,0x74,0x60,0x04,0x77,0x80,0x08,
+0x00,0x80,0x07,0x66,0xb0,0x4e,0x00,0x35,0x10,0x37,0xa0,0x1b,0x00,0xa3,0x50,0x06,
+0x00,0x60,0x08,0x77,0xb0,0x07,0x66,0xa0,0x85,0x00,0xf4,0x05,0x60,0x77,0x00,0x80,
+0x77,0x37,0x96,0x77,0x80,0x00,0x77,0x83,0x40,0x77,0x14,0x20,0x77,0x00,0x00,0x67,
+0x1b,0x00,0xd8,0x78,0x13,0x84,0x88,0x83,0x21,0x88,0x57,0x71,0x78,0x02,0x55,0x64,
+0xa0,0x00,0xf4,0x08,0x37,0x60,0x87,0x00,0x71,0x87,0x77,0x45,0x87,0x77,0x60,0x87,
+0x01,0x00,0x77,0x06,0x20,0x01,0x05,0x87,0x75,0x00,0x00,0x9f,0x00,0x87,0x81,0x77,
+0x37,0xb0,0x07,0x80,0x01,0x77,0x9f,0x00,0xf1,0x04,0x00,0x37,0xa0,0x70,0x13,0x92,
+0xa0,0x84,0x32,0xb0,0x67,0x74,0x70,0x03,0x56,0x60,0x00,0x11,0x80,0xbc,0x01,0x01,
+0x33,0x00,0xf1,0x1a,0xa1,0x91,0x26,0xb1,0x91,0x81,0x14,0xb0,0x37,0x63,0x50,0x04,
+0x77,0x90,0x04,0x77,0x90,0x08,0x77,0x71,0x00,0x00,0x00,0x05,0x77,0x50,0x00,0x00,
+0x70,0x0a,0x77,0x50,0x08,0x77,0x70,0x00,0x24,0x00,0x57,0x8a,0x77,0x15,0x00,0xf1,
+0x01,0xa0,0x07,0x77,0x80,0x08,0x78,0x70,0x23,0x39,0x33,0x24,0x44,0x43,0x06,0x77,
+0xb0,0x48,0x00,0xf1,0x07,0x10,0x04,0x77,0xa0,0x06,0x88,0x90,0x08,0x77,0x60,0x00,
+0x16,0x00,0x57,0x77,0x76,0x08,0x00,0x00,0x0a,0x77,0x71,0x15,0x02,0x20,0x7a,0x00,
+0x16,0x00,0xf4,0x02,0x57,0xa7,0x00,0x47,0x69,0x66,0x00,0x67,0x79,0x00,0x06,0x66,
+0x90,0x00,0xa7,0x78,0x10,0x35,0x02,0xf1,0x0a,0x37,0x7b,0x00,0x07,0x77,0x80,0x00,
+0x76,0x76,0x10,0x57,0x7b,0x77,0x00,0x00,0x40,0x00,0x00,0x6a,0x10,0x00,0x75,0x08,
+0x20,0x00,0x6d,0x00,0x15,0x70,0x82,0x00,0xfb,0x07,0x01,0x42,0x20,0x58,0xa9,0x96,
+0x05,0x77,0xa0,0x00,0x67,0x7a,0x00,0x09,0x22,0x20,0x00,0x35,0x54,0x00,0x47,0x79,
+0x82,0x02,0x11,0x04,0x9e,0x00,0xf0,0x03,0x07,0x77,0x70,0x57,0x77,0x77,0x03,0x16,
+0x30,0x0a,0x77,0xb0,0x09,0x77,0xa0,0x05,0x77,0x90,0x78,0x00,0x03,0x34,0x00,0xac,
+0x58,0x87,0x97,0x00,0x53,0x08,0x00,0x04,0x30,0x70,0x34,0x00,0x61,0x45,0x55,0x55,
+0x23,0x85,0x62,0x34,0x00,0x11,0xb0,0x18,0x00,0x90,0x60,0x00,0x00,0x70,0x09,0x77,
+0x50,0x09,0x77,0x2b,0x00,0xf2,0x09,0x67,0x77,0x77,0x05,0x77,0x90,0x07,0x77,0x80,
+0x09,0x33,0x30,0x02,0x44,0x30,0x57,0x77,0x77,0x08,0x00,0x00,0x09,0x77,0x71,0x42,
+0x00,0xf2,0x03,0x08,0x77,0x60,0x06,0x77,0x70,0x57,0x76,0x66,0x06,0x77,0x90,0x06,
+0x66,0x90,0x0a,0x77,0x81,0x5d,0x00,0x03,0x2f,0x01,0xe2,0x77,0x70,0x35,0x55,0x54,
+0x23,0x33,0x32,0x0a,0x88,0xb0,0x0a,0x77,0xa0,0x77,0x00,0xf1,0x00,0x78,0x07,0x00,
+0x80,0x73,0x7b,0x07,0x80,0x00,0x78,0x33,0x37,0x13,0x31,0x70,0xc5,0x00,0xc0,0x47,
+0xb0,0x70,0x37,0xb0,0x70,0x80,0x00,0x70,0x57,0x73,0x70,0xfd,0x00,0x00,0xdd,0x00,
+0x03,0xa8,0x00,0xd0,0x47,0x90,0x70,0x02,0x90,0x70,0x85,0x40,0x70,0x77,0x74,0x70,
+0x01,0x58,0x03,0x10,0x10,0x97,0x01,0x0a,0x33,0x00,0x73,0x04,0x77,0x70,0x07,0x00,
+0x80,0x08,0x78,0x02,0x06,0x1b,0x00,0x2c,0x47,0x73,0x78,0x02,0x62,0x47,0xb0,0x80,
+0x37,0xb0,0x80,0x36,0x00,0x91,0x00,0x04,0x40,0x00,0x79,0x00,0x06,0x51,0x91,0x1a,
+0x00,0x24,0x20,0x37,0x1b,0x00,0xf3,0x00,0x58,0x83,0x70,0x00,0x67,0x50,0x06,0x20,
+0x80,0x05,0x30,0x90,0x00,0x46,0x20,0xc6,0x03,0xc0,0x70,0x70,0x80,0x07,0x07,0x08,
+0x82,0x70,0x70,0x70,0x07,0x7b,0xb3,0x00,0x10,0x70,0x60,0x02,0xf3,0x01,0x57,0x90,
+0x70,0x08,0x08,0x07,0x00,0x70,0x80,0x77,0x14,0x67,0x07,0x00,0x06,0x77,0xdb,0x03,
+0x04,0x63,0x01,0x40,0x05,0x79,0x08,0x00,0x31,0x00,0x5a,0x07,0x07,0x71,0x57,0x90,
+0xde,0x03,0xf0,0x0e,0x20,0x07,0x7b,0x08,0x00,0x80,0x80,0x87,0x27,0x08,0x07,0x00,
+0x37,0x62,0x60,0x00,0x41,0x8a,0x30,0x07,0x04,0x60,0x00,0xa4,0x85,0x20,0x01,0x03,
+0x50,0x3d,0x03,0x20,0x06,0x7a,0x3c,0x00,0x81,0x87,0x17,0x28,0x08,0x00,0x25,0x50,
+0x50,0x41,0x02,0x23,0x77,0x90,0x1a,0x04,0x07,0x40,0x00,0xf2,0x04,0x17,0x08,0x08,
+0x00,0x37,0x60,0x60,0x00,0x57,0x76,0x00,0x00,0x19,0x30,0x00,0x58,0x77,0x00,0x01,
+0x21,0x00,0xf2,0x06,0x46,0x65,0x17,0x70,0x75,0x27,0x70,0x75,0x88,0x70,0x75,0x27,
+0x77,0x95,0x27,0x00,0x05,0x27,0x00,0x04,0x17,0x3b,0x04,0xf3,0x06,0x57,0x84,0x37,
+0x70,0x74,0x78,0x70,0x73,0x57,0x37,0x62,0x35,0x01,0x50,0x05,0x02,0xb8,0x78,0x01,
+0x96,0x67,0xcb,0x04,0x21,0x84,0x38,0x1b,0x00,0xd4,0x68,0x47,0x73,0x38,0x00,0x05,
+0x02,0x00,0x1c,0x30,0x02,0x90,0x65,0xb8,0x01,0xc2,0x70,0x70,0x77,0x07,0x5b,0x70,
+0x70,0x77,0x5a,0x07,0x01,0x10,0xb8,0x01,0xf3,0x06,0x57,0x90,0x07,0x80,0x70,0x27,
+0x70,0x71,0x57,0x67,0xa0,0x07,0x01,0x00,0x07,0x07,0x00,0x01,0x06,0x77,0x74,0x4a,
+0x00,0xe1,0x90,0x70,0x80,0x73,0xb0,0x71,0x80,0x70,0x26,0x60,0x40,0x04,0x87,0xa0,
+0x44,0x02,0x13,0x70,0x9b,0x00,0x70,0x60,0x77,0x70,0x70,0x77,0x70,0x97,0x06,0x00,
+0x56,0x75,0x90,0x77,0x01,0x00,0xfd,0x03,0x00,0x36,0x00,0x90,0x74,0xb0,0x70,0x71,
+0x90,0x57,0x93,0xa0,0x01,0x31,0x05,0x04,0xee,0x01,0xf0,0x08,0x80,0x06,0x80,0x81,
+0x77,0x70,0x71,0x77,0x47,0x70,0x07,0x00,0x56,0x51,0x05,0x30,0x35,0x05,0x40,0x55,
+0x00,0x46,0x40,0x54,0x00,0x21,0x80,0x08,0xa7,0x04,0xb0,0x67,0x76,0x00,0x00,0x35,
+0x00,0x06,0x78,0x97,0x70,0x00,0xa1,0x02,0xa1,0xb0,0x08,0x00,0x70,0x04,0x8a,0x60,
+0x56,0x78,0x66,0x97,0x01,0x40,0x71,0x00,0x00,0x60,0x61,0x00,0x21,0x97,0x7b,0x46,
+0x05,0x43,0x47,0xb6,0x00,0x67,0x77,0x03,0x60,0x5a,0x00,0x00,0x66,0x19,0x10,0x36,
+0x01,0x82,0x08,0x77,0x90,0x00,0x80,0x07,0x10,0x09,0x2d,0x02,0x28,0x47,0x7b,0x65,
+0x03,0x02,0x1c,0x00,0x90,0x00,0x05,0x77,0x60,0x05,0x77,0x77,0x70,0x02,0xb6,0x05,
+0x12,0x50,0x07,0x03,0x00,0x55,0x00,0xf3,0x09,0x7a,0x10,0x08,0x77,0xa1,0x03,0x44,
+0x44,0x40,0x25,0x83,0x92,0x00,0x68,0x7a,0x20,0x07,0x66,0x81,0x00,0xa7,0x78,0x20,
+0x00,0xf0,0x00,0x25,0x80,0x70,0x01,0x00,0x30,0x75,0xa0,0x70,0x3d,0x01,0x00,0x23,
+0x02,0x10,0x10,0xed,0x00,0x01,0x1b,0x00,0x4a,0x37,0x70,0x70,0x04,0xf6,0x02,0x00,
 0x1b,0x00,0x21,0x70,0x70,0x3e,0x01,0x1b,0x50,0x3e,0x01,0x05,0x36,0x00,0x25,0x47,
 0x70,0xc3,0x02,0x14,0x90,0x1b,0x00,0x91,0x07,0x80,0x80,0x07,0x70,0x70,0x07,0x47,
 0x80,0x26,0x01,0x13,0x20,0x26,0x01,0x00,0xc7,0x03,0x10,0xa0,0x33,0x00,0xf0,0x03,
 0x77,0xb0,0x70,0x00,0x10,0x40,0x00,0x67,0x10,0x04,0x78,0xc0,0x03,0x8a,0x71,0x02,
-0x00,0x11,0xda,0x01,0x11,0x04,0xde,0x02,0xa7,0x08,0x7b,0x08,0x82,0x80,0x70,0x70,
-0x07,0x7a,0x07,0x27,0x07,0xa1,0x07,0x06,0x07,0x00,0x76,0xa0,0x87,0x17,0x07,0x07,
-0x66,0x02,0x00,0x64,0x01,0x09,0x79,0x04,0x00,0x86,0x1c,0x20,0x77,0xb0,0x1a,0x03,
-0x31,0x81,0x67,0xa0,0x76,0x0b,0x06,0xc0,0x06,0xf9,0x02,0x07,0x06,0x08,0x00,0x77,
-0xb0,0x87,0x17,0x18,0x08,0x00,0x25,0x40,0x50,0x00,0x68,0x89,0x4a,0x0c,0x00,0xf6,
-0x08,0x81,0x18,0x00,0x77,0xa1,0x87,0x17,0x17,0x18,0xe2,0x02,0x95,0x79,0x59,0x00,
-0x07,0x80,0x70,0x01,0xa7,0x17,0x20,0x00,0x22,0x07,0x08,0x7c,0x00,0xe4,0x08,0x00,
-0x37,0x70,0x70,0x00,0x06,0x62,0x00,0x07,0x10,0x90,0x00,0x81,0xdd,0x10,0x00,0x0a,
-0x1d,0xf0,0x01,0x70,0x80,0x70,0x77,0x08,0x7a,0x0b,0xb0,0x80,0x70,0x77,0x07,0x69,
-0x07,0x70,0x00,0x4a,0x02,0x14,0x06,0x7e,0x03,0x52,0x60,0x54,0x38,0x77,0xa4,0xcc,
-0x02,0x2a,0x47,0x01,0xe9,0x06,0x20,0x40,0x04,0x47,0x0a,0xb6,0x77,0x78,0x77,0x70,
-0x07,0x07,0x76,0x67,0x07,0x01,0x10,0x5e,0x0b,0x92,0x60,0x50,0x08,0x76,0xa0,0x08,
-0x70,0x72,0x77,0xd3,0x02,0x26,0x06,0x10,0xd3,0x02,0xb5,0x70,0x60,0x70,0x77,0xb3,
-0xb0,0x70,0x80,0x70,0x26,0x50,0x06,0x0e,0x12,0x70,0xeb,0x06,0x61,0x70,0x70,0x71,
-0x76,0xb2,0xb1,0xcb,0x01,0x1b,0x60,0xe3,0x10,0xf3,0x06,0x70,0x60,0x07,0x77,0xb1,
-0x77,0x70,0x70,0x07,0x36,0x60,0x05,0x06,0x00,0x06,0x07,0x77,0x77,0x07,0x66,0x66,
-0x87,0x00,0x70,0x40,0x77,0x80,0x70,0x77,0x87,0xb7,0x06,0x00,0x1a,0x76,0x09,0x03,
-0xf4,0x06,0x60,0x60,0x78,0x76,0xb7,0x88,0x70,0x70,0x88,0x27,0x50,0x55,0x01,0x77,
-0x77,0x02,0x87,0x77,0x03,0x97,0x76,0x1b,0x00,0xf4,0x02,0x80,0x77,0xb4,0xb0,0x70,
-0x72,0x90,0x67,0xa2,0x90,0x01,0x00,0x70,0x06,0x10,0x10,0x06,0x40,0x0b,0xc8,0x70,
-0x50,0x70,0x76,0xa2,0xb0,0x70,0x82,0xb0,0x26,0x50,0x50,0xa2,0x00,0x60,0x06,0x00,
-0x60,0x00,0x97,0x7a,0x90,0x0a,0x00,0x1c,0x10,0x24,0x00,0x23,0x27,0x03,0xc7,0x08,
-0x33,0x80,0x08,0x44,0x90,0x04,0x89,0x60,0x57,0x88,0x76,0x27,0x03,0x00,0x81,0x0e,
-0x00,0x41,0x06,0x54,0x78,0x70,0x57,0x9a,0x76,0x03,0x0d,0x01,0xfc,0x08,0xcc,0x84,
-0x48,0x00,0x08,0x44,0x90,0x00,0x36,0xb4,0x00,0x46,0x68,0xd6,0x06,0x35,0x07,0x00,
-0x60,0x35,0x00,0x92,0x00,0x14,0x00,0x00,0x79,0x00,0x07,0x42,0x91,0x18,0x00,0x01,
-0x77,0x03,0x50,0x22,0x80,0x00,0x24,0x44,0xbc,0x06,0x19,0x10,0x43,0x02,0x02,0x6c,
-0x00,0x50,0x06,0x66,0x70,0x57,0x77,0xe2,0x08,0x22,0x08,0x05,0x6c,0x00,0x00,0x9c,
-0x00,0xb9,0x09,0x44,0x90,0x04,0x77,0x50,0x36,0x6a,0x65,0x05,0x79,0x5e,0x06,0x03,
-0xb7,0x00,0xb2,0x77,0x60,0x36,0x6a,0x65,0x07,0x7a,0x70,0x0a,0x66,0x60,0x75,0x07,
-0x05,0x6a,0x00,0x87,0x90,0x00,0x24,0x43,0x00,0x58,0x87,0xa7,0xd4,0x0a,0x0b,0x03,
-0x01,0x23,0x00,0x00,0x99,0x0a,0x04,0x4c,0x00,0x30,0x50,0x46,0x66,0xc5,0x06,0x08,
-0x3b,0x0b,0x02,0x26,0x02,0x51,0x87,0x77,0x07,0x70,0x07,0xde,0x09,0x04,0x0e,0x10,
-0x41,0x60,0x50,0x70,0x76,0x4f,0x03,0x23,0x67,0xa0,0x93,0x06,0x05,0x9d,0x03,0x20,
-0x70,0x60,0x64,0x03,0x02,0x23,0x02,0x19,0x05,0x23,0x02,0xf7,0x03,0x00,0x04,0x44,
-0x38,0x00,0x77,0x75,0x70,0x09,0x99,0x87,0x70,0x77,0x75,0x70,0x08,0x98,0x87,0x67,
-0x03,0xf3,0x02,0x05,0x55,0x57,0x10,0x8a,0x8a,0x78,0x17,0x77,0x77,0x10,0x24,0x34,
-0x40,0x00,0x58,0x8a,0xed,0x05,0x04,0x2e,0x08,0x80,0x44,0x44,0x07,0x77,0x76,0x07,
-0x8b,0x8a,0x3d,0x02,0x55,0x79,0x79,0x07,0x02,0x02,0xb0,0x02,0x20,0x02,0x00,0x6c,
-0x13,0x00,0x04,0x05,0xc2,0x00,0xc2,0x0a,0x70,0x03,0x58,0x07,0x00,0x08,0x05,0x27,
-0x00,0xe9,0x02,0x10,0x06,0x90,0x00,0xcc,0x00,0x35,0x07,0x10,0x09,0x90,0x68,0x16,
-0x41,0x66,0x00,0x04,0xa0,0x06,0xf5,0x01,0x00,0x33,0x08,0x00,0x07,0x20,0x70,0x00,
-0x97,0x07,0x71,0x81,0x34,0x70,0x00,0x30,0xb4,0x14,0xd2,0x03,0x30,0x70,0x00,0x62,
-0x08,0x00,0x09,0x80,0x87,0x18,0x12,0x45,0x3b,0x01,0x23,0x7b,0x00,0x26,0x11,0xf0,
-0x02,0x02,0x20,0x70,0x00,0x62,0x07,0x00,0x0a,0x70,0x77,0x18,0x23,0x47,0x00,0x00,
-0x67,0x40,0x93,0x03,0x00,0x74,0x0b,0x21,0x05,0x61,0xcb,0x00,0x10,0x07,0x01,0x00,
-0xa7,0x0b,0x17,0x79,0x18,0x67,0x07,0x70,0x78,0x07,0x10,0xa8,0x0d,0xf8,0x00,0x00,
-0x50,0x78,0x03,0x60,0x9a,0x09,0x90,0x99,0x44,0x15,0x78,0x00,0x55,0x65,0x91,0x03,
-0xc0,0x00,0x60,0x78,0x04,0x60,0xbb,0x09,0x81,0x88,0x42,0x04,0x66,0x66,0x04,0x23,
-0x80,0x08,0xff,0x14,0x60,0x40,0x67,0x03,0x60,0xbb,0x08,0x18,0x00,0x10,0x78,0x02,
-0x04,0x43,0x81,0x18,0x00,0x81,0x89,0x14,0x00,0x57,0x00,0xb0,0x03,0x60,0x78,0x10,
-0x98,0x17,0x30,0x52,0x05,0x74,0x00,0x85,0x19,0x11,0x69,0xcb,0x05,0x05,0x8a,0x10,
-0x00,0x87,0x0b,0xb4,0x04,0x93,0x77,0x08,0x71,0x07,0x25,0x07,0x07,0x10,0x01,0x34,
-0x01,0xe8,0x70,0x07,0x02,0x73,0x78,0x08,0x81,0x07,0x52,0x05,0x07,0x03,0x77,0x73,
-0x20,0x14,0xd1,0x02,0x40,0x80,0x05,0x33,0xa0,0x09,0x82,0x90,0x62,0x35,0x80,0x02,
-0x54,0x01,0x05,0xbe,0x01,0xf8,0x00,0x02,0x30,0x70,0x06,0x46,0xb0,0x17,0x71,0x70,
-0x50,0x03,0x60,0x04,0x88,0x90,0xd9,0x01,0x00,0x36,0x00,0xf5,0x01,0x36,0xb0,0x09,
-0x80,0x80,0x71,0x14,0x80,0x00,0x57,0x40,0x06,0x30,0x90,0x06,0x30,0xc6,0x0f,0xf6,
-0x00,0x77,0x07,0x00,0x77,0x0b,0x27,0x77,0x18,0x50,0x77,0x70,0x80,0x77,0x10,0x10,
-0xe1,0x03,0x00,0x0d,0x01,0x50,0x64,0x88,0x09,0x91,0x88,0x0d,0x01,0x57,0x66,0x66,
-0x00,0x10,0x08,0x0d,0x01,0xd0,0x76,0x03,0x65,0x96,0x09,0x90,0x86,0x44,0x15,0x76,
-0x00,0x20,0x76,0x2e,0x03,0x24,0xb7,0x75,0x71,0x05,0xc1,0x07,0x80,0x03,0x75,0x97,
-0x00,0x98,0x17,0x70,0x43,0x04,0x56,0x26,0x02,0x44,0x77,0x78,0x00,0x0b,0x8b,0x00,
-0x02,0x20,0x00,0x60,0x65,0x98,0x00,0x89,0x07,0x80,0x58,0x00,0x60,0x00,0x32,0x20,
-0x00,0x09,0x70,0xe4,0x02,0x03,0x1f,0x00,0xc9,0x03,0x20,0x80,0x06,0x15,0xb0,0x09,
-0x75,0xb0,0x72,0x44,0x80,0xa6,0x15,0x00,0x65,0x34,0x96,0x70,0x00,0x02,0x86,0x40,
-0x00,0x60,0x15,0x20,0x48,0x07,0xb7,0x00,0x55,0x00,0x03,0x88,0x40,0x05,0x23,0x40,
-0x57,0x89,0x21,0x04,0x11,0x01,0x18,0x00,0x11,0x87,0x18,0x00,0x34,0x9a,0x77,0x00,
-0x71,0x13,0x08,0x30,0x00,0x60,0x67,0x89,0x77,0x00,0x67,0x20,0xd2,0x10,0x14,0x21,
-0x13,0x0f,0xa1,0x60,0x07,0x00,0x90,0x07,0x08,0x83,0x07,0x33,0x25,0x4a,0x0c,0x23,
-0xa7,0x27,0x78,0x01,0x00,0x56,0x03,0x7d,0xa1,0x00,0x06,0x60,0x82,0x00,0x10,0x5d,
-0x0d,0x00,0xaa,0x0d,0x61,0x00,0x01,0x99,0x20,0x07,0x00,0x39,0x11,0x68,0x07,0x00,
-0x08,0x04,0x00,0x0a,0x6a,0x00,0x20,0x00,0x40,0xa0,0x0b,0x10,0x14,0xfc,0x01,0x30,
-0x07,0x52,0x80,0xc6,0x07,0x10,0x14,0x1b,0x00,0x62,0x01,0x88,0x20,0x07,0x00,0x71,
-0x39,0x14,0x00,0xaf,0x00,0xc0,0x29,0x00,0x02,0x95,0x60,0x04,0x00,0x22,0x57,0x77,
-0x76,0x06,0x6d,0x04,0x03,0x73,0x10,0x00,0x1b,0x00,0xa0,0x02,0x80,0x00,0x01,0x96,
-0x50,0x00,0x50,0x03,0x20,0x81,0x04,0x94,0x50,0x03,0x10,0x0a,0x77,0xa2,0x00,0x97,
-0x79,0xbd,0x07,0x01,0xea,0x00,0x10,0x30,0x68,0x00,0x1d,0x77,0xe5,0x0f,0xf2,0x01,
-0x50,0x07,0x01,0x70,0x07,0x04,0x90,0x07,0x08,0x71,0x07,0x35,0x08,0x08,0x10,0x01,
-0x4a,0x02,0x00,0xb8,0x08,0xcc,0x03,0x70,0x08,0x08,0x82,0x08,0x52,0x05,0x08,0x03,
-0x77,0x74,0x62,0x02,0x7c,0x30,0x80,0x09,0x80,0x80,0x63,0x36,0x62,0x02,0xf4,0x04,
-0x01,0x60,0x07,0x05,0x70,0x08,0x08,0x63,0x07,0x50,0x03,0x06,0x04,0x88,0x85,0x05,
-0x77,0x75,0x08,0x79,0x06,0xb2,0x01,0x40,0x70,0x05,0x40,0x80,0x09,0x80,0x70,0x61,
-0x15,0x41,0x17,0x15,0x70,0xd1,0x0a,0x41,0x02,0x30,0x80,0x06,0x51,0x00,0x22,0x71,
-0x24,0x7d,0x02,0x14,0x80,0x7d,0x02,0xf2,0x03,0x20,0x00,0x70,0x78,0x00,0x08,0x07,
-0x80,0x02,0xa3,0xa7,0x71,0x59,0x79,0x70,0x08,0x39,0x4a,0xfa,0x03,0xe2,0x05,0x00,
-0x02,0x30,0x40,0x06,0x43,0x70,0x09,0x88,0x90,0x32,0x35,0x14,0x9e,0x12,0x00,0x4a,
-0x00,0x50,0x51,0x08,0x00,0x72,0x80,0xca,0x07,0x77,0x72,0x70,0x80,0x70,0x05,0x76,
-0x07,0x20,0x12,0xf4,0x01,0x00,0x29,0x91,0x60,0x07,0x01,0x66,0x10,0x70,0x16,0x68,
-0x10,0x66,0x06,0x00,0x06,0x83,0x16,0x15,0x70,0x86,0x16,0xc0,0x18,0x00,0x70,0x16,
-0x80,0x07,0x00,0x68,0x81,0x28,0x81,0x80,0xc8,0x14,0x14,0x09,0xfc,0x18,0xf1,0x0e,
-0x20,0x03,0x88,0x28,0x00,0x80,0x07,0x87,0x26,0x22,0x57,0x00,0x07,0x62,0x60,0x00,
-0x50,0x6a,0x30,0x08,0x02,0x70,0x00,0xa6,0x64,0x30,0x00,0x01,0x50,0xe0,0x36,0x00,
-0x3c,0x00,0x90,0x06,0x87,0x26,0x44,0x58,0x00,0x04,0x40,0x50,0x37,0x0d,0x00,0xd5,
-0x02,0x12,0xa7,0xfb,0x04,0x22,0x18,0x81,0x78,0x00,0x51,0x06,0x68,0x11,0x77,0x06,
-0xe6,0x15,0x24,0x90,0x06,0xa0,0x09,0x00,0xfd,0x00,0xf2,0x00,0x88,0x17,0x00,0x70,
-0x06,0x83,0x07,0x11,0x67,0x41,0x07,0x70,0x50,0x00,0x70,0x9c,0x12,0x25,0x96,0x6a,
-0x58,0x19,0xb0,0x77,0x28,0x00,0x70,0x07,0x87,0x17,0x22,0x58,0x00,0x07,0x42,0x08,
-0x11,0x73,0x1f,0x19,0x22,0x58,0x67,0x1c,0x00,0x90,0x26,0x10,0x70,0x07,0x68,0x17,
-0x12,0x56,0x10,0x3c,0x00,0x94,0x67,0x77,0x00,0x01,0x60,0x60,0x00,0x7a,0x7b,0xf8,
-0x01,0xf0,0x05,0x26,0x53,0x48,0x70,0x73,0xaa,0x71,0x83,0x58,0x07,0x42,0x46,0x00,
-0x77,0x75,0x01,0x60,0x08,0x01,0xa6,0x41,0x10,0x05,0x2b,0x01,0x01,0x99,0x08,0x77,
-0x70,0x80,0x85,0x15,0x76,0x07,0x20,0x2b,0x01,0x00,0x97,0x00,0xa0,0x77,0x17,0x00,
-0x70,0x07,0x78,0x17,0x12,0x57,0x81,0x77,0x00,0x95,0x05,0x74,0x00,0x07,0x30,0x80,
-0x00,0x38,0x78,0xae,0x0d,0xd2,0x40,0x07,0x45,0x44,0x07,0x70,0x08,0x77,0x70,0x17,
-0x07,0x18,0x81,0x97,0x04,0x11,0x07,0xee,0x00,0x90,0x08,0x71,0x17,0x28,0x70,0x07,
-0x58,0x18,0x81,0x54,0x06,0x53,0x04,0x40,0x01,0x04,0x97,0x02,0x02,0xd0,0x18,0x71,
-0x07,0x70,0x08,0x78,0x54,0x45,0x07,0x04,0x40,0x05,0x03,0x23,0x15,0x43,0x75,0x06,
-0x87,0x74,0xe8,0x15,0xf4,0x05,0x71,0x07,0x70,0x18,0x77,0x63,0x35,0x07,0x05,0x50,
-0x05,0x05,0x10,0x05,0x06,0x87,0x77,0x06,0x76,0x66,0x1b,0x00,0xf3,0x04,0x25,0x70,
-0x18,0x85,0x63,0x35,0x25,0x05,0x50,0x14,0x07,0x06,0x60,0x08,0x78,0xa2,0x08,0x6a,
-0x47,0x51,0x00,0xf3,0x05,0x80,0x25,0x70,0x37,0x85,0x62,0x44,0x25,0x06,0x60,0x14,
-0x00,0x40,0x40,0x00,0xb0,0xb0,0x07,0x4a,0x48,0xb6,0x0c,0xf7,0x00,0x20,0x67,0x53,
-0x80,0x77,0x70,0x77,0x77,0x60,0x81,0x77,0x18,0x80,0x77,0x00,0x96,0x08,0xf5,0x06,
-0x26,0x60,0x78,0x70,0x77,0x77,0x62,0x80,0x77,0x06,0x30,0x45,0x01,0x77,0x77,0x01,
-0x87,0x77,0x02,0xa7,0x76,0xd5,0x00,0x20,0x44,0x46,0x50,0x09,0x64,0x70,0x18,0x67,
-0x18,0x81,0x17,0x2d,0x07,0xcc,0x02,0x18,0x73,0x78,0x70,0x17,0x07,0x62,0x18,0x78,
-0x06,0x60,0x6f,0x05,0xc0,0x17,0x71,0x08,0x71,0x17,0x78,0x70,0x07,0x27,0x18,0x82,
-0x47,0x6b,0x09,0x36,0x30,0x01,0x05,0xf0,0x00,0x10,0x08,0xf0,0x00,0x2d,0x47,0x78,
-0xf0,0x00,0xf1,0x0a,0x02,0x18,0x82,0x78,0x70,0x16,0x08,0x62,0x27,0x78,0x07,0x60,
-0x07,0x00,0x57,0x60,0x03,0x60,0x26,0x02,0x80,0x55,0x00,0x36,0x40,0xba,0x00,0xc6,
-0x77,0x54,0x86,0x78,0x70,0x70,0x78,0x60,0x86,0x77,0x28,0x70,0xba,0x00,0x34,0x01,
-0x77,0x30,0x26,0x0c,0xf5,0x04,0x18,0x73,0x00,0x00,0x24,0x00,0x05,0x78,0xa7,0x70,
-0x04,0x87,0x60,0x08,0x00,0x80,0x01,0x89,0x20,0xe4,0x08,0xf0,0x02,0x08,0x77,0x71,
-0x05,0x86,0x50,0x00,0x81,0x08,0x00,0x00,0x6b,0x10,0x04,0x66,0x76,0x60,0x1a,0x19,
-0x35,0x76,0x69,0x00,0x11,0x08,0x00,0x1c,0x0f,0x03,0x34,0x00,0x10,0x89,0xc2,0x19,
-0x08,0x3b,0x18,0xf8,0x06,0x01,0x77,0x07,0x00,0x61,0x16,0x70,0x06,0x22,0x57,0x20,
-0x06,0x60,0x75,0x10,0x26,0x07,0x00,0x68,0x97,0x90,0xc8,0x04,0x00,0xac,0x1b,0xb2,
-0x06,0x10,0x68,0x00,0x01,0x88,0x18,0x70,0x06,0x99,0x79,0x36,0x05,0x16,0x90,0x68,
-0x15,0x40,0x74,0x25,0x08,0x08,0x03,0x00,0x90,0x03,0x72,0x25,0x00,0x70,0x25,0x37,
-0x97,0x45,0xe7,0x39,0x02,0x22,0x09,0x10,0x75,0x27,0x18,0x50,0x05,0x93,0x08,0x37,
-0xb7,0x32,0x07,0x67,0x06,0x20,0x00,0x05,0x87,0x73,0xd4,0x00,0x92,0x17,0x73,0x00,
-0x02,0x42,0x40,0x06,0x89,0x99,0x1d,0x14,0x00,0x46,0x09,0xf1,0x04,0x90,0x00,0x49,
-0x78,0x00,0x58,0x97,0xa6,0x00,0x05,0x62,0x00,0x08,0x10,0x90,0x00,0x67,0x68,0x00,
-0x72,0x18,0x11,0x76,0xfe,0x0c,0xa7,0x66,0x48,0x00,0x00,0x12,0x00,0x04,0x77,0xa7,
-0x71,0x0f,0x08,0x90,0x04,0x87,0x50,0x08,0x00,0x80,0x02,0x77,0x40,0x69,0x05,0x10,
-0x08,0x69,0x05,0x11,0x09,0x10,0x01,0x61,0x08,0x10,0x70,0x01,0x66,0x10,0x85,0x09,
-0x06,0x59,0x14,0x40,0x05,0x76,0x50,0x09,0x2d,0x00,0x60,0x20,0x47,0x79,0x76,0x05,
-0x7b,0xf0,0x0a,0x00,0x7a,0x03,0x06,0x24,0x01,0x4b,0x90,0x01,0x67,0x20,0x99,0x05,
-0x00,0x9d,0x06,0x40,0x75,0x07,0x08,0x07,0xf4,0x18,0x90,0x02,0x61,0x07,0x26,0xa6,
-0x37,0x00,0x82,0x78,0x15,0x06,0x03,0x7a,0x19,0x00,0x18,0x00,0xc2,0x06,0x74,0x07,
-0x47,0x97,0x27,0x00,0x63,0x78,0x03,0x20,0x03,0xfc,0x02,0xf3,0x05,0x08,0x77,0x08,
-0x09,0x57,0x07,0x57,0x87,0x28,0x00,0x75,0x78,0x01,0x87,0x75,0x01,0x77,0x77,0x03,
-0x97,0x0c,0x07,0xf3,0x07,0x28,0x71,0x67,0x70,0x44,0x67,0x46,0x82,0x67,0x03,0x33,
-0x67,0x4a,0x52,0x67,0x06,0x27,0x67,0x05,0x11,0x57,0x00,0x69,0x00,0x00,0x85,0x08,
-0x90,0x08,0x27,0x07,0x01,0x40,0x07,0x27,0xa7,0x37,0xba,0x0d,0x14,0x60,0x8a,0x01,
-0x21,0x48,0x75,0x35,0x01,0x20,0x66,0x58,0x04,0x01,0x93,0x05,0x99,0x7b,0x70,0x04,
-0x40,0x80,0x00,0x34,0xb3,0x16,0x20,0x76,0x60,0xce,0x08,0xf2,0x02,0x01,0x66,0x20,
-0x04,0x6a,0x6a,0x60,0x06,0x97,0xa2,0x00,0x76,0x68,0x10,0x0a,0x77,0x82,0xd6,0x03,
-0x14,0x20,0x71,0x01,0x24,0x27,0x73,0x41,0x0a,0x09,0x35,0x01,0x21,0x00,0x00,0xff,
-0x11,0xa1,0x70,0x04,0x76,0x60,0x08,0x10,0x80,0x01,0x66,0x10,0x12,0x15,0x06,0x79,
-0x1a,0x06,0x41,0x02,0x61,0x76,0x20,0x56,0x66,0x66,0x05,0xca,0x05,0x05,0x41,0x02,
-0x05,0x1b,0x00,0x06,0x0d,0x18,0x14,0x10,0x47,0x08,0x11,0x74,0x38,0x01,0x40,0x07,
-0x07,0x05,0x73,0x2b,0x04,0x10,0x47,0xb1,0x19,0x14,0x07,0x77,0x03,0xc5,0x70,0x44,
-0x54,0x70,0x70,0x07,0x70,0x70,0x16,0x70,0x18,0x81,0xbd,0x1b,0x00,0x5a,0x05,0x20,
-0x28,0x82,0x18,0x00,0x5c,0x62,0x25,0x70,0x06,0x60,0x5f,0x0e,0x80,0x18,0x81,0x07,
-0x71,0x16,0x07,0x70,0x06,0x7f,0x04,0x0d,0x7a,0x03,0xe7,0x70,0x70,0x06,0x70,0x54,
-0x45,0x70,0x04,0x40,0x50,0x03,0x87,0xa0,0x04,0x7a,0x0e,0xf4,0x06,0x28,0x80,0x07,
-0x70,0x54,0x07,0x53,0x82,0x07,0x04,0x30,0x05,0x07,0x93,0x75,0x07,0x90,0x07,0x0b,
-0x71,0x07,0x51,0x00,0x00,0x6c,0x00,0x90,0x61,0x16,0x70,0x07,0x70,0x60,0x03,0x77,
-0x70,0x86,0x15,0x24,0x76,0xb0,0xe6,0x03,0xf4,0x04,0x60,0x70,0x16,0x70,0x63,0x35,
-0x60,0x05,0x50,0x50,0x06,0x00,0x50,0x07,0x87,0xb0,0x07,0x76,0xa0,0x51,0x00,0xf3,
-0x04,0x43,0x70,0x34,0x43,0x61,0x53,0x43,0x06,0x50,0x33,0x00,0x40,0x40,0x02,0xa1,
-0xb0,0x08,0x3a,0x37,0xa9,0x08,0x02,0x39,0x15,0xa4,0x00,0x27,0x08,0x72,0x08,0x90,
-0x70,0x05,0x32,0x57,0x08,0x1b,0x00,0x1c,0x00,0x10,0x79,0x3a,0x03,0xf6,0x00,0x83,
-0x00,0x89,0x08,0x41,0x63,0x24,0x80,0x00,0x46,0x67,0x00,0x01,0x11,0x90,0x3e,0x09,
-0x01,0x20,0x00,0x00,0x2b,0x16,0x7a,0x88,0x07,0x71,0x63,0x44,0x70,0x00,0x8b,0x1f,
-0xc5,0x7c,0x08,0x00,0x02,0x70,0x87,0x22,0x88,0x18,0x00,0x40,0x03,0x6f,0x06,0x06,
-0x6a,0x0b,0x20,0x03,0x7a,0x5c,0x00,0xf1,0x07,0x70,0x00,0x78,0x07,0x71,0x54,0x44,
-0x70,0x00,0x05,0x64,0x00,0x06,0x30,0x80,0x00,0x73,0x08,0x00,0x00,0x56,0x20,0x76,
-0x1e,0xf3,0x05,0x63,0x37,0x00,0x83,0x47,0x03,0x53,0x99,0x08,0x73,0x47,0x35,0x74,
-0x47,0x30,0x15,0x47,0x00,0x03,0x37,0xcc,0x1e,0xac,0x90,0x78,0x00,0x90,0x99,0x08,
-0x90,0x99,0x53,0x24,0xdf,0x0a,0x11,0x47,0xbc,0x16,0xc2,0x02,0x66,0xb0,0x08,0x80,
-0x70,0x44,0x61,0x70,0x30,0x02,0x70,0x68,0x0d,0xf5,0x03,0x27,0x92,0x70,0x00,0x90,
-0x81,0x06,0x92,0xa1,0x54,0x26,0x70,0x03,0x55,0x60,0x01,0x22,0x90,0x9e,0x14,0x11,
-0x36,0x50,0x1f,0x77,0x07,0x74,0xb0,0x55,0x63,0x70,0x11,0x0a,0x11,0x00,0x36,0x00,
-0xe8,0xa3,0x07,0x00,0xa1,0x78,0x09,0x92,0x07,0x51,0x04,0x05,0x04,0x87,0x86,0x2a,
-0x08,0xd3,0x26,0x92,0x70,0x00,0x93,0xb0,0x09,0x91,0x70,0x61,0x04,0x60,0x03,0x88,
-0x0e,0x12,0xa0,0x0f,0x02,0x30,0x27,0xa2,0x60,0x1b,0x00,0x86,0x81,0x60,0x51,0x04,
-0x40,0x06,0x00,0x50,0x16,0x13,0x00,0xc4,0x15,0xc5,0x80,0x01,0x75,0xb0,0x08,0x90,
-0x70,0x61,0x23,0x80,0x00,0x56,0xc2,0x0a,0x15,0x20,0xa1,0x1f,0xe2,0x02,0x67,0x77,
-0x08,0x80,0x77,0x26,0x71,0x77,0x30,0x02,0x77,0x00,0x00,0x65,0x03,0xf3,0x07,0x12,
-0x37,0xa0,0x78,0x03,0x76,0x78,0x09,0x80,0x78,0x51,0x13,0x58,0x00,0x07,0x01,0x00,
-0x2a,0x70,0x02,0x80,0x26,0xed,0x00,0x85,0x84,0xa0,0x02,0x60,0x80,0x08,0x85,0xb0,
-0xed,0x00,0xf1,0x01,0x04,0x67,0x50,0x00,0x00,0x82,0x00,0x00,0x8a,0x20,0x00,0x72,
-0x16,0x10,0x00,0x26,0x61,0x0a,0xe5,0x04,0x7a,0x80,0x00,0x18,0xc2,0x00,0x06,0x24,
-0x51,0x05,0x67,0x86,0x60,0xd3,0x1d,0xc7,0x60,0x00,0x04,0x79,0x70,0x01,0x7c,0x20,
-0x06,0x23,0x51,0x67,0x5f,0x0a,0xf0,0x02,0x04,0x79,0xa0,0x00,0x07,0xb4,0x00,0x05,
-0x15,0x42,0x05,0x77,0xb7,0x70,0x00,0x57,0x20,0xaa,0x05,0x30,0x08,0x20,0x80,0xe4,
-0x04,0xf5,0x05,0x27,0x73,0x60,0x00,0x08,0x27,0x00,0x05,0xc1,0x70,0x04,0x62,0x77,
-0x82,0x00,0x80,0x70,0x05,0x79,0x79,0x77,0x1f,0x90,0x78,0x60,0x00,0x02,0xb0,0x00,
-0x06,0x75,0x80,0x61,0x0a,0x93,0x57,0x89,0x77,0x00,0x02,0x60,0x00,0x00,0x25,0xf2,
-0x16,0x92,0x70,0x00,0x6c,0x20,0x06,0x10,0x61,0x57,0x78,0xf5,0x04,0x00,0x5e,0x0a,
-0x90,0x04,0x7a,0x70,0x01,0x8c,0x20,0x06,0x00,0x51,0x2c,0x00,0x52,0x47,0x00,0x06,
-0x20,0x80,0xf3,0x09,0xd8,0x04,0x7a,0x70,0x00,0x28,0xb3,0x00,0x05,0x00,0x41,0x05,
-0x77,0x77,0xaf,0x00,0x00,0x49,0x00,0xb8,0x7c,0x80,0x05,0x89,0x60,0x23,0x11,0x21,
-0x46,0x66,0x65,0xf4,0x03,0x21,0x04,0x7a,0xca,0x00,0x2e,0x10,0x51,0xd6,0x03,0x01,
-0x15,0x02,0xc2,0x80,0x02,0x50,0x70,0x08,0x80,0x70,0x53,0x62,0x70,0x20,0x01,0x15,
-0x02,0x00,0xf2,0x14,0xde,0x01,0x80,0x71,0x09,0x80,0x70,0x72,0x33,0x70,0x03,0x45,
-0x60,0x02,0x15,0x02,0x6a,0x80,0x70,0x63,0x44,0x70,0x01,0x15,0x02,0x20,0x37,0x91,
-0x1b,0x00,0x7b,0x08,0x90,0x70,0x62,0x14,0x70,0x03,0x88,0x17,0x01,0x1b,0x00,0x6a,
-0x09,0x90,0x70,0x51,0x04,0x50,0xfa,0x01,0x00,0xa3,0x1e,0xf1,0x04,0x58,0x00,0x00,
-0x71,0x67,0x00,0x03,0x65,0x37,0x71,0x07,0x88,0x67,0x00,0x08,0x76,0x87,0x00,0x01,
-0x5d,0x04,0x11,0x05,0xbb,0x12,0xf7,0x01,0x72,0x77,0x08,0x43,0x77,0x08,0x71,0xb9,
-0x49,0xa4,0x77,0x77,0x77,0x77,0x21,0x12,0xa8,0x17,0xd9,0x72,0x78,0x07,0x61,0x99,
-0x39,0x94,0x88,0x65,0x45,0x77,0x01,0x66,0xa8,0x17,0x9a,0x06,0xa5,0xb0,0x07,0x86,
-0x80,0x12,0x45,0x21,0x57,0x10,0xea,0x01,0x29,0x47,0x07,0x09,0x08,0x07,0x1c,0x89,
-0x08,0x51,0x63,0x17,0x02,0x0c,0x08,0x30,0x01,0x74,0x08,0x9d,0x15,0xe6,0x00,0x09,
-0x08,0x00,0x06,0x70,0x87,0x13,0x77,0x17,0x00,0x40,0x03,0x70,0xd4,0x03,0x00,0xde,
-0x24,0xa3,0x00,0x37,0xc0,0x80,0x00,0x59,0x08,0x71,0x56,0x44,0x0d,0x19,0x05,0x23,
-0x23,0x12,0x02,0x7f,0x07,0xf3,0x06,0x24,0xa1,0x76,0x10,0x5a,0x07,0x30,0x55,0x15,
-0x70,0x00,0x04,0x05,0x00,0x03,0x82,0x90,0x00,0x85,0x94,0x50,0xb7,0x1e,0xf3,0x0b,
-0x01,0x87,0x08,0x00,0x13,0xb0,0x87,0x10,0x89,0x08,0x00,0x63,0x14,0x70,0x00,0x47,
-0x76,0x00,0x00,0x08,0x40,0x00,0x58,0x67,0x10,0x01,0xb3,0x00,0xf3,0x05,0x32,0x47,
-0x27,0xa3,0x47,0x00,0x83,0x98,0x06,0x73,0x47,0x17,0x73,0x47,0x30,0x14,0x47,0x00,
-0x02,0x47,0x1b,0x00,0xe0,0x80,0x07,0x15,0x94,0x07,0x03,0xc2,0x77,0x36,0x07,0x07,
-0x00,0x04,0x04,0x14,0x15,0x14,0x80,0x2d,0x05,0xbb,0x50,0x70,0x35,0xb0,0x70,0x06,
-0x85,0xb0,0x64,0x43,0x70,0x39,0x03,0xf3,0x06,0x06,0x31,0x57,0x27,0xa2,0x57,0x00,
-0x84,0x57,0x06,0x85,0x57,0x17,0x72,0x57,0x30,0x13,0x57,0x00,0x01,0x47,0xcc,0x00,
-0xf2,0x04,0x16,0x60,0x00,0x05,0x7a,0x50,0x00,0x04,0xb0,0x00,0x08,0x64,0x80,0x00,
-0x02,0x50,0x00,0x67,0x99,0x04,0x08,0xa0,0x50,0x07,0x17,0xa4,0x07,0x02,0xb0,0x07,
-0x27,0x27,0xbc,0x0e,0x06,0x23,0x0d,0xc1,0x66,0x00,0x00,0x57,0x74,0x00,0x00,0x09,
-0x20,0x00,0x58,0x86,0xfb,0x1f,0x93,0x78,0x87,0x70,0x00,0x44,0x00,0x00,0x03,0x40,
+0x00,0x11,0xda,0x01,0x11,0x04,0xde,0x02,0x94,0x08,0x7b,0x08,0x82,0x80,0x70,0x70,
+0x07,0x7a,0xde,0x02,0x00,0x52,0x00,0xa1,0x07,0x06,0x07,0x00,0x76,0xa0,0x87,0x17,
+0x07,0x07,0x66,0x02,0x00,0x64,0x01,0x09,0x79,0x04,0x60,0x06,0x06,0x07,0x00,0x77,
+0xb0,0x1a,0x03,0x40,0x81,0x67,0xa0,0x80,0xfe,0x02,0x06,0xc0,0x06,0xf1,0x02,0x07,
+0x06,0x08,0x00,0x77,0xb0,0x87,0x17,0x18,0x08,0x00,0x25,0x40,0x50,0x00,0x68,0x89,
+0xf1,0x04,0x24,0xa7,0x77,0x3c,0x00,0xa1,0x07,0x05,0x18,0x00,0x77,0xa1,0x87,0x17,
+0x17,0x18,0xe2,0x02,0x95,0x79,0x59,0x00,0x07,0x80,0x70,0x01,0xa7,0x17,0x20,0x00,
+0x22,0x07,0x08,0x7c,0x00,0xf2,0x03,0x08,0x00,0x37,0x70,0x70,0x00,0x06,0x62,0x00,
+0x07,0x10,0x90,0x00,0x81,0x09,0x00,0x00,0x56,0x3c,0x07,0xf0,0x03,0x04,0x07,0x70,
+0x80,0x70,0x77,0x08,0x7a,0x0b,0xb0,0x80,0x70,0x77,0x07,0x69,0x07,0x70,0x00,0x4a,
+0x02,0x14,0x06,0x7e,0x03,0x52,0x60,0x54,0x38,0x77,0xa4,0xcc,0x02,0x2a,0x47,0x01,
+0xe9,0x06,0xf5,0x03,0x40,0x04,0x07,0x80,0x07,0x07,0x77,0x78,0x77,0x70,0x07,0x07,
+0x76,0x67,0x07,0x01,0x10,0x07,0xd4,0x00,0x92,0x60,0x50,0x08,0x76,0xa0,0x08,0x70,
+0x72,0x77,0xd3,0x02,0x26,0x06,0x10,0xd3,0x02,0xb3,0x70,0x60,0x70,0x77,0xb3,0xb0,
+0x70,0x80,0x70,0x26,0x50,0xd3,0x02,0x13,0x08,0x95,0x01,0x71,0x10,0x70,0x70,0x71,
+0x76,0xb2,0xb1,0xcb,0x01,0x46,0x60,0x04,0x77,0x70,0x06,0x07,0x00,0x36,0x00,0xf3,
+0x04,0x07,0x77,0xb1,0x77,0x70,0x70,0x07,0x36,0x60,0x05,0x06,0x00,0x06,0x07,0x77,
+0x77,0x07,0x66,0x66,0x87,0x00,0x70,0x40,0x77,0x80,0x70,0x77,0x87,0xb7,0x06,0x00,
+0x1a,0x76,0x09,0x03,0xf4,0x06,0x60,0x60,0x78,0x76,0xb7,0x88,0x70,0x70,0x88,0x27,
+0x50,0x55,0x01,0x77,0x77,0x02,0x87,0x77,0x03,0x97,0x76,0x1b,0x00,0xf3,0x04,0x80,
+0x77,0xb4,0xb0,0x70,0x72,0x90,0x67,0xa2,0x90,0x01,0x00,0x70,0x06,0x10,0x10,0x06,
+0x77,0x71,0x6c,0x00,0xb8,0x50,0x70,0x76,0xa2,0xb0,0x70,0x82,0xb0,0x26,0x50,0x50,
+0xa2,0x00,0x30,0x06,0x00,0x60,0x39,0x08,0x94,0x07,0x00,0x80,0x00,0x77,0x77,0x00,
+0x00,0x23,0x27,0x03,0xc8,0x08,0x33,0x80,0x08,0x44,0x90,0x04,0x89,0x60,0x57,0x88,
+0x76,0x27,0x03,0x30,0x07,0x00,0x70,0x41,0x06,0x81,0x78,0x70,0x57,0x9a,0x76,0x01,
+0x00,0x00,0xf2,0x05,0x01,0xfc,0x08,0xcc,0x84,0x48,0x00,0x08,0x44,0x90,0x00,0x36,
+0xb4,0x00,0x46,0x68,0xd6,0x06,0x35,0x07,0x00,0x60,0x35,0x00,0x92,0x00,0x14,0x00,
+0x00,0x79,0x00,0x07,0x42,0x91,0x18,0x00,0x01,0x77,0x03,0x50,0x22,0x80,0x00,0x24,
+0x44,0xbc,0x06,0x19,0x10,0x43,0x02,0x02,0x6c,0x00,0x50,0x06,0x66,0x70,0x57,0x77,
+0xe2,0x08,0x22,0x08,0x05,0x6c,0x00,0x00,0x9c,0x00,0xb9,0x09,0x44,0x90,0x04,0x77,
+0x50,0x36,0x6a,0x65,0x05,0x79,0x5e,0x06,0x03,0xb7,0x00,0xb2,0x77,0x60,0x36,0x6a,
+0x65,0x07,0x7a,0x70,0x0a,0x66,0x60,0x75,0x07,0x05,0x6a,0x00,0xa5,0x90,0x00,0x24,
+0x43,0x00,0x58,0x87,0xa7,0x00,0x43,0xf2,0x06,0x0a,0x03,0x01,0x00,0x11,0x00,0x37,
+0x77,0x77,0x70,0x4c,0x00,0x30,0x50,0x46,0x66,0xc5,0x06,0x17,0x07,0x67,0x00,0x02,
+0x26,0x02,0x51,0x87,0x77,0x07,0x70,0x07,0xde,0x09,0x13,0x00,0x54,0x08,0x41,0x60,
+0x50,0x70,0x76,0x4f,0x03,0x23,0x67,0xa0,0x93,0x06,0x05,0x9d,0x03,0x20,0x70,0x60,
+0x64,0x03,0x02,0x23,0x02,0x19,0x05,0x23,0x02,0xf7,0x03,0x00,0x04,0x44,0x38,0x00,
+0x77,0x75,0x70,0x09,0x99,0x87,0x70,0x77,0x75,0x70,0x08,0x98,0x87,0x67,0x03,0xf3,
+0x02,0x05,0x55,0x57,0x10,0x8a,0x8a,0x78,0x17,0x77,0x77,0x10,0x24,0x34,0x40,0x00,
+0x58,0x8a,0xed,0x05,0x04,0x2e,0x08,0x80,0x44,0x44,0x07,0x77,0x76,0x07,0x8b,0x8a,
+0x3d,0x02,0x55,0x79,0x79,0x07,0x02,0x02,0xb0,0x02,0x20,0x02,0x00,0x26,0x05,0x00,
+0x04,0x05,0xc2,0x00,0xc2,0x0a,0x70,0x03,0x58,0x07,0x00,0x08,0x05,0x27,0x00,0xe9,
+0x02,0x10,0x06,0x90,0x00,0xcc,0x00,0x35,0x07,0x10,0x09,0x90,0x68,0x16,0x41,0x66,
+0x00,0x04,0xa0,0x06,0xf0,0x02,0x00,0x33,0x08,0x00,0x07,0x20,0x70,0x00,0x97,0x07,
+0x71,0x81,0x34,0x70,0x00,0x30,0x07,0x1e,0x00,0x00,0xbe,0x03,0xd2,0x03,0x30,0x70,
+0x00,0x62,0x08,0x00,0x09,0x80,0x87,0x18,0x12,0x45,0x3b,0x01,0x32,0x7b,0x00,0x09,
+0xc2,0x07,0xf0,0x02,0x02,0x20,0x70,0x00,0x62,0x07,0x00,0x0a,0x70,0x77,0x18,0x23,
+0x47,0x00,0x00,0x67,0x40,0x93,0x03,0x61,0x07,0x20,0x90,0x00,0x05,0x61,0xcb,0x00,
+0x10,0x07,0x01,0x00,0xb6,0x0b,0x17,0x79,0x18,0x67,0x07,0x70,0x78,0x07,0x10,0x07,
+0x7a,0x0a,0xf8,0x00,0x00,0x50,0x78,0x03,0x60,0x9a,0x09,0x90,0x99,0x44,0x15,0x78,
+0x00,0x55,0x65,0x91,0x03,0xc0,0x00,0x60,0x78,0x04,0x60,0xbb,0x09,0x81,0x88,0x42,
+0x04,0x66,0x66,0x04,0x51,0x80,0x08,0x00,0x96,0x6a,0x84,0x01,0x50,0x67,0x03,0x60,
+0xbb,0x08,0x18,0x00,0x10,0x78,0x02,0x04,0x20,0x81,0x18,0x03,0x00,0x10,0x16,0x22,
+0x07,0x00,0x57,0x00,0xf1,0x01,0x03,0x60,0x78,0x10,0x98,0x17,0x30,0x52,0x05,0x74,
+0x00,0x00,0x56,0x00,0x00,0x69,0xcb,0x05,0x14,0x00,0x6e,0x00,0x00,0x87,0x0b,0xb4,
+0x04,0x93,0x77,0x08,0x71,0x07,0x25,0x07,0x07,0x10,0x01,0x34,0x01,0xe1,0x70,0x07,
+0x02,0x73,0x78,0x08,0x81,0x07,0x52,0x05,0x07,0x03,0x77,0x73,0x83,0x00,0x03,0xa1,
+0x00,0xd1,0x02,0x40,0x80,0x05,0x33,0xa0,0x09,0x82,0x90,0x62,0x35,0x80,0x02,0x54,
+0x01,0x05,0xbe,0x01,0xf8,0x00,0x02,0x30,0x70,0x06,0x46,0xb0,0x17,0x71,0x70,0x50,
+0x03,0x60,0x04,0x88,0x90,0xd9,0x01,0x00,0x36,0x00,0xf2,0x02,0x36,0xb0,0x09,0x80,
+0x80,0x71,0x14,0x80,0x00,0x57,0x40,0x06,0x30,0x90,0x06,0x30,0x90,0xa4,0x04,0xf6,
+0x02,0x05,0x00,0x77,0x07,0x00,0x77,0x0b,0x27,0x77,0x18,0x50,0x77,0x70,0x80,0x77,
+0x10,0x10,0xe1,0x03,0x00,0x0d,0x01,0x50,0x64,0x88,0x09,0x91,0x88,0x0d,0x01,0x57,
+0x66,0x66,0x00,0x10,0x08,0x0d,0x01,0xd0,0x76,0x03,0x65,0x96,0x09,0x90,0x86,0x44,
+0x15,0x76,0x00,0x20,0x76,0x2e,0x03,0x24,0xb7,0x75,0x71,0x05,0xc1,0x07,0x80,0x03,
+0x75,0x97,0x00,0x98,0x17,0x70,0x43,0x04,0x56,0x26,0x02,0x44,0x77,0x78,0x00,0x0b,
+0x8b,0x00,0x02,0x20,0x00,0x60,0x65,0x98,0x00,0x89,0x07,0x80,0x58,0x00,0x60,0x00,
+0x32,0x20,0x00,0x09,0x70,0xe4,0x02,0x03,0x1f,0x00,0xd1,0x03,0x20,0x80,0x06,0x15,
+0xb0,0x09,0x75,0xb0,0x72,0x44,0x80,0x02,0x3a,0x02,0x03,0xc7,0x00,0xd6,0x05,0x00,
+0x00,0x05,0x70,0x00,0x02,0x86,0x40,0x00,0x60,0x15,0x20,0x48,0x07,0xb7,0x00,0x55,
+0x00,0x03,0x88,0x40,0x05,0x23,0x40,0x57,0x89,0x21,0x04,0x11,0x01,0x18,0x00,0x11,
+0x87,0x18,0x00,0x10,0x9a,0x4d,0x03,0x05,0x13,0x0a,0x05,0x30,0x00,0xc3,0x67,0x89,
+0x77,0x00,0x67,0x20,0x08,0x10,0x90,0x08,0x21,0x90,0xb0,0x05,0xa1,0x60,0x07,0x00,
+0x90,0x07,0x08,0x83,0x07,0x33,0x25,0x4a,0x0c,0x23,0xa7,0x27,0x78,0x01,0x00,0x56,
+0x03,0x50,0xa1,0x00,0x06,0x60,0x82,0x13,0x0d,0x0d,0x5d,0x0d,0xf8,0x04,0x00,0x45,
+0x00,0x01,0x99,0x20,0x07,0x00,0x60,0x57,0x77,0x77,0x02,0x07,0x00,0x08,0x04,0x00,
+0x0a,0x6a,0x00,0x20,0x00,0x40,0xa0,0x0b,0x10,0x14,0xfc,0x01,0x30,0x07,0x52,0x80,
+0xc6,0x07,0x10,0x14,0x1b,0x00,0x40,0x01,0x88,0x20,0x07,0xac,0x00,0x00,0x94,0x0b,
+0x00,0xaf,0x00,0xc0,0x29,0x00,0x02,0x95,0x60,0x04,0x00,0x22,0x57,0x77,0x76,0x06,
+0x6d,0x04,0x12,0x90,0xaf,0x00,0x00,0x1b,0x00,0xa0,0x02,0x80,0x00,0x01,0x96,0x50,
+0x00,0x50,0x03,0x20,0x81,0x04,0x94,0x50,0x03,0x10,0x0a,0x77,0xa2,0x00,0x97,0x79,
+0xbd,0x07,0x01,0xea,0x00,0x40,0x30,0x05,0x00,0x40,0x4a,0x00,0x74,0x66,0x10,0x08,
+0x20,0x90,0x08,0x20,0xd2,0x00,0xf2,0x01,0x50,0x07,0x01,0x70,0x07,0x04,0x90,0x07,
+0x08,0x71,0x07,0x35,0x08,0x08,0x10,0x01,0x4a,0x02,0x00,0xb8,0x08,0xcc,0x03,0x70,
+0x08,0x08,0x82,0x08,0x52,0x05,0x08,0x03,0x77,0x74,0x62,0x02,0x7c,0x30,0x80,0x09,
+0x80,0x80,0x63,0x36,0x62,0x02,0xf4,0x04,0x01,0x60,0x07,0x05,0x70,0x08,0x08,0x63,
+0x07,0x50,0x03,0x06,0x04,0x88,0x85,0x05,0x77,0x75,0x08,0x79,0x06,0xc1,0x01,0x40,
+0x70,0x05,0x40,0x80,0x09,0x80,0x70,0x61,0x15,0x70,0x5e,0x06,0x15,0x70,0xd1,0x0a,
+0x41,0x02,0x30,0x80,0x06,0x51,0x00,0x22,0x71,0x24,0x7d,0x02,0x14,0x80,0x7d,0x02,
+0xf2,0x03,0x20,0x00,0x70,0x78,0x00,0x08,0x07,0x80,0x02,0xa3,0xa7,0x71,0x59,0x79,
+0x70,0x08,0x39,0x4a,0xfa,0x03,0xe1,0x05,0x00,0x02,0x30,0x40,0x06,0x43,0x70,0x09,
+0x88,0x90,0x32,0x35,0x14,0x23,0x01,0x01,0x10,0x05,0x50,0x51,0x08,0x00,0x72,0x80,
+0xca,0x07,0x63,0x72,0x70,0x80,0x70,0x05,0x76,0x06,0x08,0x02,0xb8,0x00,0xf3,0x01,
+0x29,0x91,0x60,0x07,0x01,0x66,0x10,0x70,0x16,0x68,0x10,0x66,0x06,0x00,0x06,0x77,
+0xa1,0x01,0x04,0x76,0x02,0xf3,0x06,0x01,0x77,0x18,0x00,0x70,0x16,0x80,0x07,0x00,
+0x68,0x81,0x28,0x81,0x80,0x00,0x20,0x07,0x00,0x09,0x00,0x00,0xe8,0x0a,0xf1,0x0c,
+0x03,0x88,0x28,0x00,0x80,0x07,0x87,0x26,0x22,0x57,0x00,0x07,0x62,0x60,0x00,0x50,
+0x6a,0x30,0x08,0x02,0x70,0x00,0xa6,0x64,0x30,0x00,0x01,0xe8,0x0a,0x10,0x02,0x3c,
+0x00,0x90,0x06,0x87,0x26,0x44,0x58,0x00,0x04,0x40,0x50,0x37,0x0d,0x00,0xd5,0x02,
+0x12,0xa7,0xfb,0x04,0x22,0x18,0x81,0x78,0x00,0xc4,0x06,0x68,0x11,0x77,0x06,0x00,
+0x05,0x77,0x80,0x00,0x90,0x06,0xa0,0x09,0x00,0xfd,0x00,0xf3,0x05,0x88,0x17,0x00,
+0x70,0x06,0x83,0x07,0x11,0x67,0x41,0x07,0x70,0x50,0x00,0x70,0x06,0x00,0x0a,0x77,
+0xb0,0x39,0x04,0x00,0x7c,0x00,0xc0,0x02,0x77,0x28,0x00,0x70,0x07,0x87,0x17,0x22,
+0x58,0x00,0x07,0x42,0x08,0x82,0x73,0x00,0x08,0x10,0x80,0x00,0x58,0x67,0x1c,0x00,
+0x90,0x26,0x10,0x70,0x07,0x68,0x17,0x12,0x56,0x10,0x3c,0x00,0xe0,0x67,0x77,0x00,
+0x01,0x60,0x60,0x00,0x7a,0x7b,0x20,0x00,0x00,0x00,0x00,0xf2,0x0a,0x00,0x00,0x00,
+0x26,0x53,0x48,0x70,0x73,0xaa,0x71,0x83,0x58,0x07,0x42,0x46,0x00,0x77,0x75,0x01,
+0x60,0x08,0x01,0xa6,0x78,0x00,0x01,0x00,0xf3,0x09,0x51,0x08,0x00,0x72,0x80,0x87,
+0x17,0x07,0x08,0x00,0x70,0x80,0x85,0x15,0x76,0x07,0x20,0x00,0x00,0x70,0x00,0x00,
+0x07,0x00,0x01,0x00,0xf4,0x09,0x02,0x77,0x17,0x00,0x70,0x07,0x78,0x17,0x12,0x57,
+0x81,0x07,0x70,0x70,0x00,0x05,0x74,0x00,0x07,0x30,0x80,0x00,0x38,0x78,0x20,0x00,
+0xf1,0x00,0x04,0x40,0x07,0x45,0x44,0x07,0x70,0x08,0x77,0x70,0x17,0x07,0x18,0x81,
+0x07,0x3a,0x00,0x00,0x3d,0x00,0x90,0x18,0x81,0x08,0x71,0x17,0x28,0x70,0x07,0x58,
+0x15,0x00,0x82,0x10,0x07,0x04,0x40,0x01,0x04,0x97,0x74,0x33,0x00,0xf3,0x05,0x18,
+0x71,0x07,0x70,0x08,0x78,0x54,0x45,0x07,0x04,0x40,0x05,0x03,0x87,0x76,0x03,0x77,
+0x75,0x06,0x87,0x1b,0x00,0xf4,0x06,0x17,0x71,0x07,0x70,0x18,0x77,0x63,0x35,0x07,
+0x05,0x50,0x05,0x05,0x10,0x05,0x06,0x87,0x77,0x06,0x76,0x66,0x1b,0x00,0xf3,0x04,
+0x25,0x70,0x18,0x85,0x63,0x35,0x25,0x05,0x50,0x14,0x07,0x06,0x60,0x08,0x78,0xa2,
+0x08,0x6a,0x47,0x51,0x00,0xf2,0x05,0x80,0x25,0x70,0x37,0x85,0x62,0x44,0x25,0x06,
+0x60,0x14,0x00,0x40,0x40,0x00,0xb0,0xb0,0x07,0x4a,0x48,0x1b,0x00,0xf2,0x06,0x05,
+0x20,0x67,0x53,0x80,0x77,0x70,0x77,0x77,0x60,0x81,0x77,0x18,0x80,0x77,0x00,0x00,
+0x77,0x00,0x00,0x67,0x1b,0x00,0xf5,0x06,0x26,0x60,0x78,0x70,0x77,0x77,0x62,0x80,
+0x77,0x06,0x30,0x45,0x01,0x77,0x77,0x01,0x87,0x77,0x02,0xa7,0x76,0xd5,0x00,0xc1,
+0x44,0x46,0x77,0x70,0x07,0x07,0x70,0x18,0x67,0x18,0x81,0x17,0xd2,0x00,0xf5,0x07,
+0x06,0x00,0x00,0x02,0x18,0x73,0x78,0x70,0x17,0x07,0x62,0x18,0x78,0x06,0x60,0x07,
+0x03,0x77,0x73,0x00,0x00,0x08,0x2a,0x01,0xf6,0x04,0x17,0x71,0x08,0x71,0x17,0x78,
+0x70,0x07,0x27,0x18,0x82,0x47,0x01,0x00,0x07,0x06,0x30,0x01,0x05,0xf0,0x00,0x10,
+0x08,0xf0,0x00,0x2d,0x47,0x78,0xf0,0x00,0xf1,0x0a,0x02,0x18,0x82,0x78,0x70,0x16,
+0x08,0x62,0x27,0x78,0x07,0x60,0x07,0x00,0x57,0x60,0x03,0x60,0x26,0x02,0x80,0x55,
+0x00,0x36,0x40,0xba,0x00,0xc6,0x77,0x54,0x86,0x78,0x70,0x70,0x78,0x60,0x86,0x77,
+0x28,0x70,0xba,0x00,0xf1,0x13,0x01,0x77,0x30,0x00,0x80,0x08,0x00,0x08,0x00,0x80,
+0x00,0x18,0x73,0x00,0x00,0x24,0x00,0x05,0x78,0xa7,0x70,0x04,0x87,0x60,0x08,0x00,
+0x80,0x01,0x89,0x20,0x57,0x9a,0x76,0x01,0x97,0x00,0xf4,0x0c,0x08,0x77,0x71,0x05,
+0x86,0x50,0x00,0x81,0x08,0x00,0x00,0x6b,0x10,0x04,0x66,0x76,0x60,0x06,0x77,0xa0,
+0x00,0x76,0x69,0x00,0x0a,0x77,0x81,0xba,0x01,0x14,0x77,0x34,0x00,0xb2,0x89,0x77,
+0x05,0x00,0x40,0x0a,0x77,0xb0,0x09,0x77,0xa0,0x1b,0x00,0xf7,0x06,0x01,0x77,0x07,
+0x00,0x61,0x16,0x70,0x06,0x22,0x57,0x20,0x06,0x60,0x75,0x10,0x26,0x07,0x00,0x68,
+0x97,0x90,0x15,0x02,0xf1,0x02,0x00,0x02,0x78,0x28,0x00,0x06,0x10,0x68,0x00,0x01,
+0x88,0x18,0x70,0x06,0x99,0x79,0x00,0x73,0x00,0x61,0x90,0x00,0x00,0x00,0xa7,0x77,
+0x76,0x01,0x40,0x74,0x25,0x08,0x08,0x03,0x00,0xc2,0x03,0x72,0x25,0x00,0x70,0x25,
+0x37,0x97,0x45,0x00,0x00,0x15,0x3a,0x00,0xf7,0x06,0x07,0x75,0x08,0x08,0x07,0x08,
+0x05,0x93,0x08,0x37,0xb7,0x18,0x00,0x00,0x08,0x06,0x20,0x00,0x05,0x87,0x73,0xd4,
+0x00,0xa0,0x17,0x73,0x00,0x02,0x42,0x40,0x06,0x89,0x99,0x70,0x2e,0x00,0xf1,0x08,
+0x47,0x77,0x00,0x08,0x00,0x90,0x00,0x49,0x78,0x00,0x58,0x97,0xa6,0x00,0x05,0x62,
+0x00,0x08,0x10,0x90,0x00,0x67,0x68,0x4a,0x00,0xf0,0x02,0x38,0x76,0x00,0x08,0x00,
+0x70,0x00,0x66,0x48,0x00,0x00,0x12,0x00,0x04,0x77,0xa7,0x71,0x84,0x00,0x22,0x00,
+0x70,0xdc,0x00,0xf1,0x03,0x87,0x50,0x08,0x00,0x80,0x02,0x77,0x40,0x57,0x77,0x77,
+0x02,0x08,0x00,0x08,0x04,0x00,0x09,0x10,0x01,0xf2,0x00,0x08,0x10,0x70,0x01,0x66,
+0x10,0x36,0x6a,0x65,0x05,0x79,0xa0,0x07,0x66,0x90,0x0d,0x01,0x40,0x05,0x76,0x50,
+0x09,0x2d,0x00,0xd7,0x20,0x47,0x79,0x76,0x05,0x7b,0x70,0x08,0x00,0x80,0x0a,0x77,
+0xb0,0x24,0x01,0xf1,0x02,0x90,0x01,0x67,0x20,0x57,0x8a,0x77,0x00,0x14,0x00,0x00,
+0x69,0x00,0x07,0x52,0x80,0x01,0x1b,0x00,0xf3,0x06,0x06,0x75,0x07,0x08,0x07,0x07,
+0x08,0x08,0x07,0x02,0x61,0x07,0x26,0xa6,0x37,0x00,0x82,0x78,0x00,0x60,0x07,0xe4,
+0x00,0x10,0x76,0x18,0x00,0xc2,0x06,0x74,0x07,0x47,0x97,0x27,0x00,0x63,0x78,0x03,
+0x20,0x03,0xfc,0x02,0xf2,0x06,0x08,0x77,0x08,0x09,0x57,0x07,0x57,0x87,0x28,0x00,
+0x75,0x78,0x01,0x87,0x75,0x01,0x77,0x77,0x03,0x97,0x75,0x33,0x00,0xf4,0x07,0x28,
+0x71,0x67,0x70,0x44,0x67,0x46,0x82,0x67,0x03,0x33,0x67,0x4a,0x52,0x67,0x06,0x27,
+0x67,0x05,0x11,0x57,0x00,0x69,0x00,0xf5,0x00,0x07,0x07,0x07,0x08,0x27,0x07,0x01,
+0x40,0x07,0x27,0xa7,0x37,0x00,0x80,0x07,0x69,0x00,0x31,0x00,0x48,0x75,0x35,0x01,
+0x20,0x66,0x58,0x04,0x01,0xa2,0x05,0x99,0x7b,0x70,0x04,0x40,0x80,0x00,0x34,0x07,
+0xbc,0x00,0xf2,0x08,0x76,0x60,0x00,0x81,0x09,0x00,0x01,0x66,0x20,0x04,0x6a,0x6a,
+0x60,0x06,0x97,0xa2,0x00,0x76,0x68,0x10,0x0a,0x77,0x82,0xd6,0x03,0x14,0x20,0x71,
+0x01,0x21,0x27,0x73,0x65,0x00,0x39,0x77,0x77,0x70,0x35,0x01,0x01,0xd2,0x01,0xf2,
+0x02,0x0a,0x77,0x70,0x04,0x76,0x60,0x08,0x10,0x80,0x01,0x66,0x10,0x56,0x66,0x66,
+0x06,0x77,0x35,0x01,0x19,0x71,0x41,0x02,0xb5,0x76,0x20,0x56,0x66,0x66,0x05,0x77,
+0x70,0x08,0x00,0x70,0x41,0x02,0x05,0x1b,0x00,0x90,0x57,0x77,0x76,0x00,0x66,0x10,
+0x08,0x10,0x90,0xb9,0x01,0x21,0x56,0x10,0x1c,0x02,0x01,0x38,0x01,0x40,0x07,0x07,
+0x05,0x73,0x2b,0x04,0x35,0x47,0x77,0x37,0x59,0x02,0xf1,0x00,0x04,0x40,0x70,0x44,
+0x54,0x70,0x70,0x07,0x70,0x70,0x16,0x70,0x18,0x81,0x70,0xcd,0x01,0x02,0xd0,0x01,
+0x30,0x10,0x28,0x82,0x18,0x00,0xc3,0x62,0x25,0x70,0x06,0x60,0x70,0x04,0x77,0x70,
+0x00,0x00,0x80,0x1b,0x00,0x00,0x6a,0x04,0x60,0x07,0x71,0x16,0x07,0x70,0x06,0x7f,
+0x04,0x0d,0x7a,0x03,0xf3,0x04,0x70,0x70,0x06,0x70,0x54,0x45,0x70,0x04,0x40,0x50,
+0x03,0x87,0xa0,0x04,0x77,0x90,0x07,0x77,0x70,0x71,0x01,0xf4,0x05,0x80,0x07,0x70,
+0x54,0x07,0x53,0x82,0x07,0x04,0x30,0x05,0x07,0x93,0x75,0x07,0x90,0x07,0x0b,0x71,
+0x07,0x51,0x00,0x00,0x6c,0x00,0xf4,0x00,0x61,0x16,0x70,0x07,0x70,0x60,0x03,0x77,
+0x70,0x07,0x10,0x80,0x07,0x76,0xb0,0xe6,0x03,0xf4,0x04,0x60,0x70,0x16,0x70,0x63,
+0x35,0x60,0x05,0x50,0x50,0x06,0x00,0x50,0x07,0x87,0xb0,0x07,0x76,0xa0,0x51,0x00,
+0xf2,0x04,0x43,0x70,0x34,0x43,0x61,0x53,0x43,0x06,0x50,0x33,0x00,0x40,0x40,0x02,
+0xa1,0xb0,0x08,0x3a,0x37,0x1b,0x00,0xf1,0x03,0x03,0x78,0x08,0x00,0x00,0x80,0x80,
+0x00,0x27,0x08,0x72,0x08,0x90,0x70,0x05,0x32,0x57,0x00,0xc0,0x00,0x11,0x06,0x1c,
+0x00,0x10,0x79,0x3a,0x03,0xf1,0x01,0x83,0x00,0x89,0x08,0x41,0x63,0x24,0x80,0x00,
+0x46,0x67,0x00,0x01,0x11,0x90,0x00,0xcb,0x02,0x15,0x00,0x20,0x00,0xc1,0x80,0x70,
+0x00,0x88,0x07,0x71,0x63,0x44,0x70,0x00,0x20,0x07,0x1b,0x00,0x20,0x97,0x77,0x15,
+0x01,0xf4,0x0a,0x03,0x7c,0x08,0x00,0x02,0x70,0x87,0x22,0x88,0x18,0x00,0x40,0x03,
+0x50,0x00,0x57,0x7a,0x00,0x06,0x77,0x90,0x00,0x97,0x77,0x10,0x3c,0x00,0x10,0x7a,
+0x5c,0x00,0xf0,0x07,0x70,0x00,0x78,0x07,0x71,0x54,0x44,0x70,0x00,0x05,0x64,0x00,
+0x06,0x30,0x80,0x00,0x73,0x08,0x00,0x00,0x56,0x20,0x20,0x00,0xf3,0x05,0x27,0x63,
+0x37,0x00,0x83,0x47,0x03,0x53,0x99,0x08,0x73,0x47,0x35,0x74,0x47,0x30,0x15,0x47,
+0x00,0x03,0xb3,0x00,0xf5,0x03,0x27,0x90,0x78,0x00,0x90,0x99,0x08,0x90,0x99,0x53,
+0x24,0x78,0x00,0x55,0x65,0x00,0x11,0x18,0x94,0x00,0xf0,0x06,0x47,0x80,0x70,0x00,
+0x80,0x70,0x02,0x66,0xb0,0x08,0x80,0x70,0x44,0x61,0x70,0x30,0x02,0x70,0x00,0x00,
+0x60,0x33,0x00,0xf1,0x02,0x92,0x70,0x00,0x90,0x81,0x06,0x92,0xa1,0x54,0x26,0x70,
+0x03,0x55,0x60,0x01,0x22,0x90,0xe6,0x00,0x00,0x01,0x00,0x20,0x36,0x90,0x33,0x00,
+0xd4,0x07,0x74,0xb0,0x55,0x63,0x70,0x11,0x00,0x70,0x08,0x00,0x10,0x08,0x88,0x01,
+0xf3,0x06,0x27,0xa3,0x07,0x00,0xa1,0x78,0x09,0x92,0x07,0x51,0x04,0x05,0x04,0x87,
+0x86,0x05,0x77,0x75,0x08,0x77,0x74,0xa1,0x05,0xd0,0x92,0x70,0x00,0x93,0xb0,0x09,
+0x91,0x70,0x61,0x04,0x60,0x03,0x77,0x98,0x03,0x32,0x07,0x66,0xa0,0x0f,0x02,0x30,
+0x27,0xa2,0x60,0x1b,0x00,0xb5,0x81,0x60,0x51,0x04,0x40,0x06,0x00,0x50,0x08,0x77,
+0xb0,0x1b,0x00,0xf2,0x06,0x37,0xb0,0x80,0x01,0x75,0xb0,0x08,0x90,0x70,0x61,0x23,
+0x80,0x00,0x56,0x40,0x06,0x30,0x90,0x06,0x30,0x90,0xf1,0x00,0xf2,0x05,0x27,0x70,
+0x77,0x00,0x80,0x77,0x02,0x67,0x77,0x08,0x80,0x77,0x26,0x71,0x77,0x30,0x02,0x77,
+0x00,0x00,0x65,0x03,0xf3,0x07,0x12,0x37,0xa0,0x78,0x03,0x76,0x78,0x09,0x80,0x78,
+0x51,0x13,0x58,0x00,0x07,0x01,0x00,0x2a,0x70,0x02,0x80,0x26,0xed,0x00,0x85,0x84,
+0xa0,0x02,0x60,0x80,0x08,0x85,0xb0,0xed,0x00,0xf0,0x16,0x04,0x67,0x50,0x00,0x00,
+0x82,0x00,0x00,0x8a,0x20,0x00,0x72,0x16,0x10,0x00,0x26,0x00,0x06,0x78,0x97,0x70,
+0x04,0x7a,0x80,0x00,0x18,0xc2,0x00,0x06,0x24,0x51,0x05,0x67,0x86,0x60,0x06,0x77,
+0x45,0x07,0x10,0x10,0x1a,0x01,0xc1,0x04,0x79,0x70,0x01,0x7c,0x20,0x06,0x23,0x51,
+0x67,0x9a,0x77,0x29,0x05,0x00,0x8c,0x04,0xf0,0x02,0x04,0x79,0xa0,0x00,0x07,0xb4,
+0x00,0x05,0x15,0x42,0x05,0x77,0xb7,0x70,0x00,0x57,0x20,0xaa,0x05,0x30,0x08,0x20,
+0x80,0xe4,0x04,0xf0,0x04,0x27,0x73,0x60,0x00,0x08,0x27,0x00,0x05,0xc1,0x70,0x04,
+0x62,0x77,0x82,0x00,0x80,0x70,0x05,0x79,0x62,0x05,0x11,0x60,0x5a,0x05,0xf2,0x07,
+0x78,0x60,0x00,0x02,0xb0,0x00,0x06,0x75,0x80,0x00,0x10,0x00,0x00,0x57,0x89,0x77,
+0x00,0x02,0x60,0x00,0x00,0x25,0x3f,0x03,0xa3,0x79,0x70,0x00,0x6c,0x20,0x06,0x10,
+0x61,0x57,0x78,0xf5,0x04,0xc0,0x0a,0x77,0x71,0x04,0x7a,0x70,0x01,0x8c,0x20,0x06,
+0x00,0x51,0x2c,0x00,0x70,0x47,0x00,0x06,0x20,0x80,0x08,0x20,0x8a,0x03,0xd8,0x04,
+0x7a,0x70,0x00,0x28,0xb3,0x00,0x05,0x00,0x41,0x05,0x77,0x77,0xaf,0x00,0x00,0x49,
+0x00,0xb8,0x7c,0x80,0x05,0x89,0x60,0x23,0x11,0x21,0x46,0x66,0x65,0xf4,0x03,0x21,
+0x04,0x7a,0xca,0x00,0x2e,0x10,0x51,0xd6,0x03,0x01,0x15,0x02,0xc3,0x80,0x02,0x50,
+0x70,0x08,0x80,0x70,0x53,0x62,0x70,0x20,0x01,0x15,0x02,0xfe,0x01,0x47,0x90,0x70,
+0x01,0x80,0x71,0x09,0x80,0x70,0x72,0x33,0x70,0x03,0x45,0x60,0x02,0x15,0x02,0x6a,
+0x80,0x70,0x63,0x44,0x70,0x01,0x15,0x02,0x20,0x37,0x91,0x1b,0x00,0x91,0x08,0x90,
+0x70,0x62,0x14,0x70,0x03,0x77,0x80,0xfa,0x01,0x13,0xb0,0xdf,0x01,0x01,0x1b,0x00,
+0x69,0x09,0x90,0x70,0x51,0x04,0x50,0xfa,0x01,0x00,0xc5,0x04,0xf1,0x05,0x67,0x58,
+0x00,0x00,0x71,0x67,0x00,0x03,0x65,0x37,0x71,0x07,0x88,0x67,0x00,0x08,0x76,0x87,
+0x00,0x01,0x5d,0x04,0x10,0x05,0x1f,0x00,0xf6,0x02,0x46,0x72,0x77,0x08,0x43,0x77,
+0x08,0x71,0xb9,0x49,0xa4,0x77,0x77,0x77,0x77,0x21,0x12,0x0c,0x08,0xf8,0x00,0x37,
+0x72,0x78,0x07,0x61,0x99,0x39,0x94,0x88,0x65,0x45,0x77,0x01,0x66,0x64,0xef,0x02,
+0xc1,0x06,0xa5,0xb0,0x07,0x86,0x80,0x12,0x45,0x21,0x57,0x88,0x76,0x27,0x01,0x11,
+0x71,0xda,0x00,0xea,0x01,0x29,0x47,0x07,0x09,0x08,0x07,0x1c,0x89,0x08,0x51,0x63,
+0x17,0x02,0x0c,0x08,0xf7,0x06,0x01,0x74,0x08,0x00,0x47,0xb0,0x80,0x00,0x09,0x08,
+0x00,0x06,0x70,0x87,0x13,0x77,0x17,0x00,0x40,0x03,0x70,0xd4,0x03,0xf1,0x02,0x00,
+0x65,0x07,0x00,0x37,0xc0,0x80,0x00,0x59,0x08,0x71,0x56,0x44,0x70,0x00,0x57,0x77,
+0x89,0x05,0x22,0x96,0x6a,0x5b,0x07,0x02,0x7f,0x07,0xf2,0x07,0x24,0xa1,0x76,0x10,
+0x5a,0x07,0x30,0x55,0x15,0x70,0x00,0x04,0x05,0x00,0x03,0x82,0x90,0x00,0x85,0x94,
+0x50,0x00,0x04,0x01,0xf3,0x0b,0x01,0x87,0x08,0x00,0x13,0xb0,0x87,0x10,0x89,0x08,
+0x00,0x63,0x14,0x70,0x00,0x47,0x76,0x00,0x00,0x08,0x40,0x00,0x58,0x67,0x10,0x01,
+0xb3,0x00,0xf3,0x05,0x32,0x47,0x27,0xa3,0x47,0x00,0x83,0x98,0x06,0x73,0x47,0x17,
+0x73,0x47,0x30,0x14,0x47,0x00,0x02,0x47,0x1b,0x00,0xf4,0x04,0x80,0x07,0x15,0x94,
+0x07,0x03,0xc2,0x77,0x36,0x07,0x07,0x00,0x04,0x04,0x00,0x1c,0x30,0x02,0x80,0x2d,
+0x05,0xbb,0x50,0x70,0x35,0xb0,0x70,0x06,0x85,0xb0,0x64,0x43,0x70,0x39,0x03,0xf3,
+0x06,0x06,0x31,0x57,0x27,0xa2,0x57,0x00,0x84,0x57,0x06,0x85,0x57,0x17,0x72,0x57,
+0x30,0x13,0x57,0x00,0x01,0x47,0xcc,0x00,0xf2,0x04,0x16,0x60,0x00,0x05,0x7a,0x50,
+0x00,0x04,0xb0,0x00,0x08,0x64,0x80,0x00,0x02,0x50,0x00,0x67,0x99,0x04,0x08,0xf3,
+0x02,0x50,0x07,0x17,0xa4,0x07,0x02,0xb0,0x07,0x27,0x27,0x07,0x00,0x70,0x07,0x37,
+0xa7,0x27,0x20,0x01,0xf3,0x0b,0x66,0x00,0x00,0x57,0x74,0x00,0x00,0x09,0x20,0x00,
+0x58,0x86,0x00,0x01,0x00,0x10,0x06,0x78,0x87,0x70,0x00,0x44,0x00,0x00,0x03,0x40,
 0x1d,0x01,0xd0,0x00,0x04,0x77,0x50,0x00,0x2a,0x30,0x07,0x64,0x81,0x57,0x77,0x76,
-0x5e,0x03,0x50,0x77,0xb1,0x00,0x00,0x61,0x05,0x0c,0x02,0x1b,0x00,0x53,0x29,0x30,
-0x07,0x65,0x71,0x61,0x11,0x02,0x42,0x0d,0xf3,0x05,0x55,0x00,0x04,0x78,0x50,0x00,
-0x3a,0x40,0x06,0x41,0x61,0x47,0x7a,0x76,0x05,0x7b,0x80,0x06,0x66,0xa0,0xa7,0x06,
-0x06,0x4e,0x00,0xf0,0x01,0x71,0x57,0x78,0x77,0x00,0x58,0x00,0x07,0x32,0x90,0x08,
-0x11,0x90,0x00,0x55,0x10,0x21,0x05,0xd5,0x60,0x07,0x06,0x97,0x07,0x05,0x96,0x07,
-0x12,0x04,0x17,0x37,0xc7,0xdf,0x21,0x00,0x36,0x00,0xf1,0x03,0x00,0x47,0x75,0x00,
-0x00,0x2a,0x30,0x00,0x76,0x58,0x10,0x35,0x55,0x54,0x02,0x22,0x23,0x20,0x27,0x19,
-0x10,0x07,0x6f,0x0b,0x01,0x0a,0x06,0xf3,0x01,0x40,0x70,0x47,0xb1,0x70,0x00,0xa0,
-0x70,0x06,0x80,0x70,0x36,0x62,0x70,0x30,0x03,0xf1,0x02,0xbc,0x16,0x40,0x70,0x37,
-0xc0,0x70,0x05,0x90,0x70,0x65,0x44,0x46,0x01,0x03,0x72,0x25,0x63,0x03,0x6a,0x08,
-0x72,0x06,0x20,0x72,0x25,0x13,0x70,0x9c,0x02,0xf7,0x01,0x17,0x82,0x77,0x00,0x53,
-0x77,0x37,0xa0,0xaa,0x02,0x70,0x78,0x09,0x00,0x77,0x31,0xa8,0x0a,0x11,0x17,0xc8,
-0x21,0xa4,0x17,0xa5,0x57,0x00,0x80,0x18,0x08,0x10,0x07,0x11,0x62,0x0b,0xd9,0x47,
-0x91,0x70,0x24,0xa0,0x70,0x25,0x85,0xb0,0x48,0x00,0x70,0x12,0xa5,0x24,0xa0,0x00,
-0x36,0x82,0x70,0x37,0xb4,0xb0,0x07,0x40,0x70,0x1c,0x24,0x18,0x77,0xba,0x11,0xbc,
-0x20,0x47,0xa1,0x80,0x57,0xa5,0xb0,0x07,0x30,0x70,0x52,0xc0,0x24,0x00,0x05,0x23,
-0xf1,0x06,0x14,0x74,0x07,0x03,0xa1,0x77,0x18,0x10,0x07,0x10,0x06,0x06,0x00,0x1b,
-0x20,0x02,0x80,0x73,0x01,0x00,0x01,0x92,0x1a,0x00,0x3a,0x05,0x23,0x47,0x96,0xdb,
-0x24,0x1b,0x40,0x9f,0x00,0xb7,0x09,0x57,0x17,0xa3,0x27,0x00,0x83,0x67,0x08,0x10,
-0x17,0x9f,0x00,0xa8,0x80,0x56,0xa5,0xb0,0x06,0x56,0xb0,0x64,0x00,0x70,0x4c,0x1b,
-0x01,0x6c,0x1d,0x11,0x08,0xa9,0x23,0x10,0x03,0xdb,0x06,0x10,0x10,0x6a,0x24,0x01,
-0xa5,0x00,0x43,0xa0,0x01,0x81,0x40,0x66,0x08,0x04,0x47,0x1d,0x07,0x2d,0x00,0x01,
-0x3f,0x03,0x33,0x30,0x06,0x77,0x2d,0x00,0x71,0xb0,0x11,0x11,0x51,0x35,0x55,0x54,
-0x9f,0x04,0x12,0x80,0xc8,0x09,0x00,0x24,0x1a,0x20,0x57,0x7a,0xcb,0x0e,0x12,0x06,
-0x55,0x23,0x00,0xd0,0x01,0x05,0x43,0x22,0x02,0x48,0x01,0x30,0x08,0x17,0xa3,0x93,
-0x24,0x35,0x08,0x10,0x08,0xa9,0x00,0xc9,0x37,0x83,0x70,0x37,0xa1,0x70,0x04,0x60,
-0x70,0x34,0x00,0x40,0x2d,0x01,0x00,0xc7,0x08,0x21,0x18,0x00,0x55,0x22,0x24,0x18,
-0x71,0xf2,0x1c,0x16,0x51,0xf2,0x1c,0x00,0x2b,0x13,0xe2,0x18,0x00,0x87,0x71,0x87,
-0x18,0x00,0x18,0x00,0x37,0x73,0x60,0x00,0x57,0xd8,0x18,0x06,0x16,0x16,0xd5,0x06,
-0x77,0x18,0x00,0x81,0x10,0x80,0x08,0x66,0x18,0x71,0x56,0x64,0xf6,0x1c,0x1b,0xa7,
-0x70,0x20,0xb7,0x87,0x67,0x68,0x80,0x07,0x07,0x84,0x67,0x07,0x02,0x17,0x08,0x20,
-0x40,0x67,0x08,0x83,0x37,0xda,0x1c,0x1c,0x67,0xda,0x1c,0xf0,0x01,0x01,0x66,0x57,
-0x08,0x87,0x68,0x78,0x80,0x07,0x08,0x57,0x77,0x07,0x02,0x10,0x04,0x19,0x21,0x13,
-0x87,0xb9,0x0c,0x01,0x5c,0x1e,0xc3,0x70,0x77,0x56,0xb0,0x80,0x00,0x70,0x74,0x53,
-0x70,0x02,0x20,0x96,0x02,0x00,0x51,0x00,0xac,0x71,0x70,0x83,0x33,0x90,0x84,0x31,
-0x90,0x67,0x74,0xe9,0x13,0xd1,0x67,0x71,0x70,0x87,0x72,0xb0,0x80,0x01,0x70,0x26,
-0x63,0x40,0x03,0x3d,0x1c,0x13,0x07,0xe4,0x09,0xd3,0x10,0x77,0x71,0x71,0x87,0x72,
-0xb1,0x80,0x00,0x70,0x37,0x74,0x60,0x8a,0x05,0x14,0x76,0x9a,0x1a,0x10,0x50,0xf1,
-0x1c,0x20,0x87,0x37,0x06,0x00,0x57,0x74,0x50,0x77,0x13,0x10,0xfa,0x18,0x40,0x60,
-0x78,0x83,0x24,0xf7,0x1c,0x2c,0x67,0x70,0xf7,0x1c,0xf0,0x01,0x57,0x50,0x87,0x80,
+0x5e,0x03,0x83,0x77,0xb1,0x00,0x00,0x61,0x00,0x00,0x20,0x1b,0x00,0x94,0x29,0x30,
+0x07,0x65,0x71,0x57,0x77,0x77,0x00,0xe4,0x02,0xf3,0x06,0x00,0x55,0x00,0x04,0x78,
+0x50,0x00,0x3a,0x40,0x06,0x41,0x61,0x47,0x7a,0x76,0x05,0x7b,0x80,0x06,0x66,0xa0,
+0xa7,0x06,0x06,0x4e,0x00,0xf0,0x01,0x71,0x57,0x78,0x77,0x00,0x58,0x00,0x07,0x32,
+0x90,0x08,0x11,0x90,0x00,0x55,0x10,0x21,0x05,0xe0,0x60,0x07,0x06,0x97,0x07,0x05,
+0x96,0x07,0x12,0x04,0x17,0x37,0xc7,0x27,0x5b,0x07,0x22,0x70,0x07,0x36,0x00,0xf2,
+0x06,0x00,0x47,0x75,0x00,0x00,0x2a,0x30,0x00,0x76,0x58,0x10,0x35,0x55,0x54,0x02,
+0x22,0x23,0x20,0x06,0x77,0xb0,0xc2,0x00,0x11,0x20,0x0a,0x06,0xf3,0x01,0x40,0x70,
+0x47,0xb1,0x70,0x00,0xa0,0x70,0x06,0x80,0x70,0x36,0x62,0x70,0x30,0x03,0xf1,0x02,
+0xbc,0x16,0x40,0x70,0x37,0xc0,0x70,0x05,0x90,0x70,0x65,0x44,0x46,0x01,0xf3,0x06,
+0x03,0x77,0x28,0x00,0x00,0x52,0x80,0x03,0x6a,0x08,0x72,0x06,0x20,0x70,0x04,0x50,
+0x07,0x00,0x10,0x00,0x70,0x9c,0x02,0xf7,0x01,0x17,0x82,0x77,0x00,0x53,0x77,0x37,
+0xa0,0xaa,0x02,0x70,0x78,0x09,0x00,0x77,0x31,0xa8,0x0a,0xf4,0x01,0x17,0x76,0x07,
+0x00,0x08,0x07,0x17,0xa5,0x57,0x00,0x80,0x18,0x08,0x10,0x07,0x11,0x62,0x0b,0xd0,
+0x47,0x91,0x70,0x24,0xa0,0x70,0x25,0x85,0xb0,0x48,0x00,0x70,0x12,0x40,0x03,0x15,
+0x00,0x40,0x03,0xf4,0x03,0x36,0x82,0x70,0x37,0xb4,0xb0,0x07,0x40,0x70,0x43,0x00,
+0x50,0x04,0x77,0xa0,0x05,0x77,0x90,0x1b,0x00,0xe3,0x20,0x47,0xa1,0x80,0x57,0xa5,
+0xb0,0x07,0x30,0x70,0x52,0x00,0x70,0x04,0x55,0x05,0x04,0xdd,0x06,0xf0,0x08,0x75,
+0x07,0x14,0x74,0x07,0x03,0xa1,0x77,0x18,0x10,0x07,0x10,0x06,0x06,0x00,0x1b,0x20,
+0x02,0x80,0x73,0x01,0x00,0x01,0x20,0x03,0x10,0x80,0x3a,0x05,0xab,0x47,0x96,0x77,
+0x05,0x30,0x77,0x18,0x00,0x77,0x40,0x9f,0x00,0xb7,0x09,0x57,0x17,0xa3,0x27,0x00,
+0x83,0x67,0x08,0x10,0x17,0x9f,0x00,0x80,0x80,0x56,0xa5,0xb0,0x06,0x56,0xb0,0x64,
+0x69,0x00,0x06,0xc4,0x03,0x30,0x06,0x77,0x60,0x0b,0x03,0x00,0x8f,0x0a,0x10,0x03,
+0xdb,0x06,0x51,0x10,0x06,0x7a,0x77,0x70,0xa5,0x00,0x43,0xa0,0x01,0x81,0x40,0x66,
+0x08,0x13,0x77,0x72,0x04,0x07,0x2d,0x00,0x01,0x3f,0x03,0x33,0x30,0x06,0x77,0x2d,
+0x00,0x71,0xb0,0x11,0x11,0x51,0x35,0x55,0x54,0x9f,0x04,0x13,0x80,0xc8,0x09,0x20,
+0x77,0x90,0x04,0x07,0x30,0x00,0x00,0x50,0x26,0x00,0x30,0x06,0x77,0x70,0xd0,0x01,
+0x14,0x0a,0x93,0x08,0x02,0x48,0x01,0xa5,0x08,0x17,0xa3,0x08,0x00,0x80,0x08,0x08,
+0x10,0x08,0xa9,0x00,0xc9,0x37,0x83,0x70,0x37,0xa1,0x70,0x04,0x60,0x70,0x34,0x00,
+0x40,0x2d,0x01,0x00,0xc7,0x08,0xa0,0x18,0x00,0x80,0x00,0x80,0x08,0x77,0x18,0x71,
+0x80,0x62,0x01,0x43,0x17,0x00,0x37,0x51,0xc9,0x03,0x10,0x10,0x04,0x00,0xf1,0x02,
+0x07,0x77,0x18,0x00,0x87,0x71,0x87,0x18,0x00,0x18,0x00,0x37,0x73,0x60,0x00,0x57,
+0x79,0x81,0x07,0x02,0x04,0x0b,0x02,0x56,0x09,0xb3,0x18,0x00,0x81,0x10,0x80,0x08,
+0x66,0x18,0x71,0x56,0x64,0xe9,0x03,0x44,0x70,0x00,0xa7,0x7a,0x20,0x00,0xf3,0x05,
+0x47,0x67,0x07,0x80,0x07,0x07,0x87,0x67,0x68,0x80,0x07,0x07,0x84,0x67,0x07,0x02,
+0x17,0x07,0x00,0x06,0x44,0x04,0xf7,0x00,0x57,0x67,0x08,0x83,0x37,0x48,0x83,0x27,
+0x38,0x67,0x78,0x08,0x02,0x56,0x63,0x92,0x04,0xf3,0x07,0x01,0x66,0x57,0x08,0x87,
+0x68,0x78,0x80,0x07,0x08,0x57,0x77,0x07,0x02,0x10,0x04,0x04,0x97,0x77,0x04,0x87,
+0x76,0x51,0x00,0xf3,0x01,0x71,0x70,0x70,0x00,0x70,0x77,0x56,0xb0,0x80,0x00,0x70,
+0x74,0x53,0x70,0x02,0x20,0x96,0x02,0x00,0x51,0x00,0xa0,0x71,0x70,0x83,0x33,0x90,
+0x84,0x31,0x90,0x67,0x74,0x6f,0x05,0x00,0x95,0x0d,0x04,0xe7,0x00,0xf1,0x00,0x67,
+0x71,0x70,0x87,0x72,0xb0,0x80,0x01,0x70,0x26,0x63,0x40,0x03,0x77,0x90,0x27,0x09,
+0x12,0x71,0x6b,0x04,0xc3,0x77,0x71,0x71,0x87,0x72,0xb1,0x80,0x00,0x70,0x37,0x74,
+0x60,0x8a,0x05,0x04,0x0c,0x09,0x80,0x47,0x50,0x77,0x80,0x00,0x77,0x87,0x37,0x06,
+0x00,0x56,0x74,0x50,0x77,0x13,0x10,0x14,0x02,0xe9,0x57,0x60,0x78,0x83,0x24,0x88,
+0x83,0x21,0x88,0x67,0x70,0x78,0x02,0x55,0x4f,0x05,0xf0,0x01,0x57,0x50,0x87,0x80,
 0x00,0x87,0x87,0x46,0x87,0x77,0x70,0x87,0x00,0x00,0x77,0x05,0xae,0x09,0x03,0x04,
 0x0b,0xf4,0x04,0x66,0x50,0x78,0x87,0x46,0x88,0x80,0x10,0x88,0x37,0x60,0x56,0x01,
-0x77,0x76,0x02,0x77,0x77,0x03,0x91,0x0d,0x12,0x77,0x1b,0x00,0xe1,0x00,0x88,0x47,
-0x70,0x77,0x01,0x77,0x74,0x03,0x60,0x08,0x02,0xa6,0x78,0xa0,0x25,0x12,0x60,0x8d,
-0x1f,0x20,0x50,0x00,0x5b,0x20,0x11,0x13,0x20,0x23,0x10,0x08,0xef,0x1b,0x18,0x50,
-0xc7,0x1c,0x13,0x09,0x94,0x1f,0xf1,0x02,0x40,0x0a,0x77,0x50,0x07,0x78,0x60,0x56,
-0x8a,0x65,0x00,0x56,0x10,0x07,0x20,0x90,0x07,0xbf,0x06,0x00,0x2a,0x00,0x5e,0x97,
-0x76,0x00,0x08,0x11,0x90,0x1c,0x00,0x61,0x00,0x11,0x08,0x60,0x00,0x14,0x08,0xfd,
-0x22,0x04,0x50,0x20,0xb3,0x50,0x07,0x77,0x60,0x56,0x66,0x66,0x11,0x11,0x11,0x05,
-0xa0,0x04,0x50,0x10,0x09,0x77,0x50,0x0a,0x1b,0x00,0x12,0x60,0x2a,0x00,0x02,0x18,
-0x23,0x05,0x30,0x00,0x11,0x05,0x1b,0x23,0x0b,0x5c,0x1c,0x20,0x47,0x71,0xdc,0x1b,
-0x11,0x87,0x06,0x00,0x27,0x84,0x44,0xb1,0x01,0x00,0x7b,0x01,0x03,0x18,0x00,0x2c,
-0x37,0x73,0xf3,0x0a,0xf8,0x02,0x05,0x77,0x48,0x00,0x06,0x60,0x80,0x00,0x77,0x08,
-0x72,0x07,0x70,0x70,0x05,0xbb,0x57,0x7f,0x15,0xc1,0x77,0x38,0x00,0x06,0x70,0x85,
-0x10,0x77,0x07,0x20,0x47,0x75,0xe4,0x22,0x65,0x08,0x77,0xb0,0x00,0x76,0x6a,0xac,
-0x1d,0xf7,0x01,0x73,0x77,0x05,0x50,0x77,0x07,0x80,0xba,0x07,0x70,0x77,0x3a,0xb3,
-0x77,0x01,0x10,0x06,0x07,0xa0,0x84,0x07,0x07,0x72,0x78,0x07,0x71,0x07,0x36,0x64,
-0xa9,0x0e,0x34,0x04,0x77,0x75,0x2f,0x18,0x40,0x01,0x37,0x74,0x08,0x1b,0x00,0xe3,
-0x70,0x07,0x38,0x85,0x07,0x03,0x77,0x74,0x06,0x10,0x08,0x06,0x76,0x77,0xc3,0x00,
-0x11,0x72,0x51,0x00,0x20,0x75,0x87,0x51,0x00,0x19,0xa3,0x51,0x00,0x00,0x57,0x07,
-0xb8,0x74,0x88,0x07,0x71,0x88,0x49,0x83,0x78,0x00,0x66,0x75,0x18,0x14,0x30,0x37,
-0x75,0x08,0x53,0x15,0x60,0x70,0x78,0x3a,0xa5,0x07,0x01,0x35,0x22,0x15,0x00,0x20,
-0x10,0xf1,0x08,0x37,0x74,0x07,0x07,0x70,0x77,0x07,0x70,0x77,0x38,0x85,0x07,0x00,
-0x46,0x51,0x03,0x50,0x36,0x03,0x70,0x45,0x00,0x36,0x20,0x1b,0x94,0x23,0x14,0x00,
-0x03,0x52,0x50,0x00,0x78,0x78,0xcf,0x20,0x00,0x31,0x00,0xd0,0x8a,0x88,0x00,0x08,
-0xa8,0x90,0x01,0x11,0x81,0x20,0x36,0x66,0x65,0x5b,0x1e,0x17,0x07,0xc9,0x17,0xf1,
-0x05,0x77,0x70,0x02,0x31,0x40,0x03,0x42,0x50,0x07,0x87,0x81,0x02,0x52,0x50,0x58,
-0x98,0x97,0x05,0x87,0x82,0xd9,0x23,0x23,0xb7,0xb3,0x1a,0x1b,0x07,0xc3,0x17,0x00,
-0x63,0x00,0xa6,0x32,0x23,0x00,0x04,0x33,0x40,0x00,0x88,0x88,0x10,0x59,0x17,0xf0,
-0x00,0x00,0x09,0x9b,0x50,0x00,0x99,0xb6,0x00,0x33,0x33,0x32,0x04,0x45,0x44,0x30,
-0xf2,0x2a,0x20,0x76,0x78,0x1f,0x0d,0x04,0xc9,0x03,0x70,0x76,0x07,0x05,0x50,0x07,
-0x07,0x70,0x03,0x00,0x56,0x19,0xa4,0x07,0x12,0x21,0x84,0x19,0x01,0xe9,0x00,0x62,
-0x08,0x07,0x70,0x07,0x2a,0x96,0xe9,0x00,0x16,0x01,0xe9,0x00,0x10,0x84,0x33,0x00,
-0x00,0x70,0x01,0x1b,0x65,0x70,0x01,0x02,0x04,0x01,0x10,0x07,0x70,0x01,0x19,0x86,
-0x04,0x01,0x00,0x1c,0x00,0xf7,0x05,0x76,0x07,0x00,0x67,0x75,0x70,0x00,0x88,0x17,
-0x00,0x52,0x15,0x77,0x24,0x33,0x47,0x00,0x06,0x60,0x70,0xe4,0x25,0x00,0x49,0x12,
-0xd6,0x39,0x82,0x70,0x05,0x26,0x18,0x71,0x46,0x90,0x70,0x00,0x11,0x03,0x3f,0x05,
-0x01,0x20,0x00,0xf0,0x01,0x01,0x76,0x08,0x00,0x49,0x73,0x80,0x05,0x37,0x08,0x71,
-0x54,0x70,0x80,0x00,0x42,0x07,0x0e,0x14,0x30,0x8d,0x1d,0x00,0x20,0x00,0x10,0x87,
-0x40,0x00,0x80,0x80,0x06,0x37,0x18,0x71,0x37,0x80,0x70,0xc1,0x2b,0x07,0xd5,0x04,
-0x01,0x20,0x00,0xbe,0x18,0x00,0x49,0x82,0x80,0x05,0x37,0x18,0x81,0x36,0x80,0xcb,
-0x21,0x40,0x00,0x02,0x87,0x18,0x40,0x00,0x22,0x05,0x26,0x40,0x00,0x46,0x30,0x03,
-0x00,0x09,0xc9,0x12,0x01,0xa0,0x00,0x11,0x18,0x60,0x00,0x30,0x27,0x18,0x71,0xa9,
-0x2a,0x21,0x16,0x64,0xd5,0x0f,0x02,0xeb,0x21,0xf4,0x03,0x07,0x41,0x57,0x57,0x63,
-0x57,0x18,0x71,0x57,0x51,0x61,0xa9,0x44,0x81,0x67,0x04,0x31,0x67,0xa2,0x0b,0xf1,
-0x0a,0x00,0x17,0x63,0x37,0x49,0x76,0x47,0x55,0x94,0x98,0x37,0x84,0x37,0x00,0x37,
-0x61,0x01,0x80,0x36,0x01,0x80,0x45,0x00,0x26,0x40,0x72,0x00,0xe8,0x17,0x00,0x3a,
-0x82,0x87,0x16,0x26,0x18,0x71,0x38,0x90,0x70,0x00,0x06,0x52,0x00,0xf1,0x1e,0x06,
-0x70,0x15,0x57,0x76,0x15,0x08,0x72,0x15,0x24,0x08,0x85,0x16,0x16,0x15,0x05,0x70,
-0x15,0x00,0x00,0x15,0x04,0x40,0x02,0x37,0x84,0x07,0x04,0x50,0x07,0x27,0x55,0x78,
-0x27,0x54,0x07,0x03,0x50,0x03,0x07,0x87,0x86,0x06,0x76,0x76,0x84,0x0e,0xf1,0x0b,
-0x00,0x47,0x85,0x08,0x05,0x60,0x08,0x26,0x26,0x78,0x18,0x83,0x07,0x00,0x36,0x52,
-0x01,0x80,0x26,0x01,0x80,0x36,0x00,0x36,0x40,0x01,0xa7,0x0f,0xf2,0x03,0x29,0x81,
-0x77,0x52,0x76,0x78,0x27,0x80,0x67,0x01,0x77,0x75,0x02,0x77,0x66,0x03,0xa7,0x75,
-0xd7,0x00,0xf5,0x03,0x06,0x71,0x08,0x27,0x83,0x08,0x18,0x65,0x78,0x25,0x26,0x67,
-0x05,0x60,0x07,0x05,0x20,0x03,0xd0,0x21,0xf1,0x07,0x17,0x92,0x08,0x17,0x93,0x78,
-0x26,0x26,0x08,0x08,0x64,0x77,0x00,0x46,0x53,0x02,0x70,0x36,0x01,0x97,0x83,0x00,
-0x45,0x06,0xf4,0x02,0x02,0x89,0x20,0x03,0x88,0x40,0x07,0x21,0x70,0x07,0x11,0x70,
-0x00,0x67,0x00,0x57,0x8a,0x82,0x12,0xf4,0x01,0xab,0x50,0x02,0x88,0x40,0x06,0x31,
-0x80,0x23,0x8a,0x32,0x29,0xbb,0x93,0x05,0x77,0xd0,0x08,0x03,0x1b,0x00,0x71,0x30,
-0x06,0x31,0x70,0x00,0x68,0x00,0x51,0x04,0x40,0x70,0x06,0x76,0x70,0x84,0x00,0xf4,
-0x09,0x79,0x26,0x10,0x27,0x92,0x61,0x02,0x53,0x56,0x30,0x25,0x44,0x67,0x20,0x57,
-0x06,0x10,0x58,0x97,0x71,0x00,0x00,0x06,0x10,0xb4,0x11,0xf3,0x05,0x7a,0x35,0x10,
-0x18,0x83,0x52,0x03,0x52,0x65,0x92,0x06,0x91,0x62,0x05,0x77,0x54,0x10,0x05,0x77,
-0xa1,0x20,0x00,0x00,0xf7,0x00,0xf2,0x08,0x03,0x78,0x65,0x20,0x07,0x71,0x42,0x03,
-0x51,0x64,0x92,0x07,0x91,0x43,0x05,0x78,0x65,0x30,0x06,0x00,0x10,0x00,0x87,0x4e,
-0x0e,0xf1,0x0d,0x03,0x30,0x10,0x03,0x89,0x55,0x20,0x06,0x62,0x53,0x01,0x87,0x45,
-0x71,0x57,0xa6,0x62,0x00,0x47,0x78,0x10,0x04,0x77,0x92,0x00,0x87,0x77,0x20,0x40,
-0x00,0x83,0x60,0x10,0x04,0x77,0x65,0x20,0x07,0x72,0x60,0x00,0x50,0x53,0x05,0x77,
-0x64,0x20,0xde,0x2e,0x12,0x47,0xad,0x11,0x01,0x06,0x01,0xf4,0x01,0x34,0x27,0x93,
-0x24,0x17,0x26,0x24,0x16,0x25,0x24,0x04,0x80,0x24,0x48,0x97,0x44,0xb9,0x0c,0x63,
-0x00,0x03,0x89,0x20,0x03,0x89,0x06,0x01,0xf0,0x06,0x03,0x77,0x30,0x5a,0x99,0x96,
-0x00,0x76,0x00,0x06,0x77,0x61,0x01,0x77,0x10,0x07,0x11,0x70,0x04,0x76,0x40,0x78,
-0x05,0x13,0x25,0x2f,0x00,0xf1,0x09,0x03,0x61,0x00,0x37,0x66,0x25,0x07,0x65,0x25,
-0x08,0x74,0x25,0x58,0x87,0x35,0x01,0x10,0x12,0x04,0x99,0xb5,0x07,0xaa,0xa4,0x1b,
-0x03,0x07,0x36,0x00,0x01,0xc8,0x10,0x63,0x03,0x53,0x50,0x03,0x42,0x40,0xaa,0x0a,
-0xe1,0xa4,0x25,0x18,0x94,0x25,0x17,0x08,0x25,0x05,0x72,0x25,0x47,0x76,0x35,0x40,
-0x27,0x11,0x72,0xb2,0x30,0xf5,0x01,0x25,0x47,0x76,0x16,0x07,0x72,0x16,0x24,0x07,
-0x16,0x16,0x16,0x16,0x05,0x60,0x16,0xae,0x12,0xf0,0x01,0x26,0xbe,0x00,0x8d,0xff,
-0xff,0x00,0xff,0xe9,0x5f,0x00,0xf3,0x00,0x0f,0x00,0xf0,0x04,0x00,0xf0,0x07,0x0a,
-0xff,0xaf,0xf0,0x0a,0xfa,0xaf,0xa0,0x00,0x00,0xbd,0xcc,0xce,0xab,0x8b,0x00,0x07,
-0x58,0xcd,0x66,0x6a,0xac,0x04,0x00,0x00,0x0c,0x00,0x00,0x14,0x00,0xf0,0x01,0x34,
-0x14,0x44,0x43,0xff,0x7f,0xff,0xff,0xab,0x4b,0xbb,0xba,0xbc,0x5c,0xcc,0xcb,0x0c,
-0x00,0x43,0x67,0x17,0x88,0x86,0x14,0x00,0x00,0x7b,0x31,0xf0,0x01,0x9a,0x00,0x00,
-0x09,0xfa,0xa9,0x00,0x9f,0xa0,0xaf,0x99,0xfa,0x00,0x0a,0xff,0xa0,0x97,0x4c,0xf0,
-0x34,0x00,0x63,0x00,0x72,0xcf,0x4a,0xf4,0x1d,0xff,0x60,0x0a,0xff,0x30,0xaf,0x7d,
-0xf3,0xa6,0x01,0xb3,0x00,0x0c,0x51,0x00,0x1d,0x7d,0x6e,0x70,0x8d,0x0d,0x65,0xf1,
-0xc7,0x0d,0x60,0xe6,0xd7,0x06,0x20,0xe6,0x9d,0x00,0x04,0xf2,0x1e,0xc7,0x8f,0x80,
-0x01,0x9d,0xc6,0x00,0x00,0x0c,0xc0,0x00,0x18,0x8f,0xf8,0x81,0x8f,0xfe,0xef,0xf8,
-0x2f,0xe0,0x0e,0xf2,0x04,0x00,0x00,0x0c,0x00,0x00,0x14,0x00,0x30,0x00,0x0c,0xc0,
-0x32,0x09,0xf4,0x16,0x22,0x00,0x00,0xaf,0xaa,0xa0,0x01,0xda,0x6a,0xfa,0x03,0xe8,
-0xbf,0xb8,0xe3,0xb6,0xdf,0xff,0xd6,0xb0,0x8f,0xfb,0xff,0x80,0x08,0xfc,0x0c,0xf8,
-0x00,0x5b,0x80,0x8b,0x50,0x00,0x0f,0xf0,0x00,0x04,0x00,0xf0,0x17,0x07,0xff,0xff,
-0x70,0x00,0x9f,0xf9,0x00,0x78,0x7a,0xa7,0x87,0xff,0xfb,0xbf,0xff,0xff,0xff,0xfb,
-0xbf,0x05,0xff,0xff,0xf5,0x01,0xe3,0x00,0x03,0xe1,0xa8,0x00,0x00,0x08,0xaf,0xff,
-0x50,0x6f,0xff,0x01,0x00,0x10,0xfd,0x04,0x00,0x00,0x8e,0x01,0xf1,0x12,0x02,0xbf,
-0xfb,0x3f,0x2e,0x92,0x18,0xff,0x9a,0x00,0x6c,0xff,0x31,0x00,0x24,0x44,0x44,0x42,
-0x00,0x13,0xff,0xc6,0x00,0xb9,0xfe,0xa5,0x5b,0xd1,0xf2,0x8c,0xc8,0x10,0x30,0x3f,
-0x05,0x20,0x34,0xcf,0x35,0x00,0xf0,0x06,0xab,0xff,0x00,0x4f,0x00,0x01,0x00,0x09,
-0x00,0x34,0xcf,0x01,0xff,0xff,0x1b,0xff,0xff,0x1b,0xbb,0xff,0x01,0x80,0x32,0x01,
-0xb9,0x0c,0xf2,0x20,0x54,0x00,0x00,0x90,0x23,0xb3,0x34,0xcf,0x02,0xc3,0xbf,0xff,
-0xf1,0xb5,0x6c,0xff,0xff,0x1b,0x56,0xca,0xbf,0xf0,0x2c,0x3a,0x00,0x4f,0x02,0x3b,
-0x30,0x00,0x10,0x05,0x40,0xdf,0xff,0xff,0xfd,0xf0,0x7f,0xff,0xff,0xf8,0xcf,0xb1,
-0xbf,0xfb,0x5b,0xb4,0x00,0x10,0xdf,0x87,0x00,0xf1,0x10,0xb4,0x00,0x03,0xfb,0x00,
-0x0b,0xff,0x40,0x6f,0xff,0xd0,0xdf,0xff,0xf5,0xf8,0xff,0xf7,0xaa,0x8f,0xf2,0x1a,
-0xfd,0x40,0x40,0x00,0x2f,0x20,0x8f,0xf2,0x9f,0xff,0x7c,0x00,0xf2,0x15,0x5e,0xff,
-0xf2,0x2d,0xfb,0x10,0x19,0x00,0x00,0x00,0x0d,0xa1,0x00,0x00,0xff,0xf7,0x00,0x0f,
-0xff,0xfd,0x40,0xff,0xff,0xff,0xaf,0xff,0xff,0xfa,0xff,0xff,0xd4,0x0f,0xff,0x70,
-0x00,0xda,0x2b,0x03,0xb9,0x9b,0x90,0x9b,0x9f,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,
-0x07,0x00,0xae,0xf2,0x42,0x02,0x42,0x24,0x44,0x44,0x2f,0xff,0xff,0x01,0x00,0xc1,
-0xf8,0xbb,0xbb,0xb8,0x20,0x00,0x4f,0x80,0x2f,0xff,0x92,0xff,0x70,0x00,0x72,0xfe,
-0x5f,0xfd,0x22,0xf9,0x10,0x1b,0x2e,0x0c,0xf1,0x1b,0x8f,0x80,0x00,0x00,0x7f,0xff,
-0x70,0x00,0x5f,0xff,0xff,0x50,0x0e,0xff,0xff,0xfe,0x00,0x58,0x88,0x88,0x50,0x0f,
-0xff,0xff,0xff,0x00,0xab,0xbb,0xbb,0xa0,0x00,0x06,0x20,0x07,0xf4,0x07,0xf5,0x05,
-0xf5,0x00,0x2e,0xb0,0x03,0x00,0xf1,0x07,0x60,0x00,0x10,0x26,0x00,0x04,0xf6,0x00,
-0x05,0xf6,0x00,0x06,0xf5,0x00,0xbe,0x20,0xbe,0x10,0x6e,0x10,0x00,0x10,0x8a,0x2b,
-0xf0,0x01,0x03,0xf3,0x00,0x00,0x4f,0x40,0x07,0x8a,0xfa,0x87,0xef,0xff,0xff,0xe0,
-0x04,0xf4,0x0e,0x00,0x80,0x00,0x01,0xb1,0x00,0x78,0x88,0x88,0x7e,0x59,0x00,0xf1,
-0x0c,0x8c,0xcc,0x80,0x01,0xdd,0x16,0x3d,0xd1,0xcf,0x55,0xed,0x5f,0xcb,0xf5,0xdf,
-0xd5,0xfc,0x1d,0xd3,0x73,0xdd,0x10,0x08,0xdc,0xc8,0x10,0x1d,0x89,0x01,0xf1,0x11,
-0x5e,0x8c,0xcc,0xa2,0x00,0x00,0x2d,0xb4,0x49,0xf4,0x00,0x7a,0x1a,0xff,0x3f,0xe1,
-0x07,0xfa,0x06,0xf7,0xff,0x10,0x0a,0xf3,0x03,0xef,0x40,0x00,0x06,0xcc,0x71,0xbb,
-0x02,0x01,0x40,0x89,0x00,0x00,0x3e,0x2e,0x00,0x20,0x0c,0xfc,0x1e,0x03,0x30,0xfc,
-0xf6,0x00,0xad,0x49,0xf0,0x09,0xe0,0x00,0x00,0x8f,0xe0,0xef,0x80,0x00,0x2f,0xff,
-0x6f,0xff,0x20,0x0b,0xff,0xe2,0xef,0xfa,0x00,0xdf,0xff,0xff,0xff,0xd0,0x55,0x0c,
-0xf0,0x05,0x44,0x00,0x04,0xf5,0xef,0xb1,0xcf,0xfd,0x01,0x8c,0xd1,0xc1,0x01,0xdc,
-0x81,0xc1,0xef,0xc1,0xbf,0xfd,0x14,0x00,0x04,0x2d,0x0d,0xd3,0x04,0xe4,0x00,0x04,
-0xfc,0xf4,0x04,0xf8,0x08,0xf4,0xb8,0x00,0x08,0x3f,0x0a,0xd2,0x0b,0x80,0x00,0x8b,
-0x4f,0x80,0x8f,0x40,0x4f,0xcf,0x40,0x00,0x4e,0xa2,0x03,0xf1,0x12,0x94,0x14,0x44,
-0x40,0x00,0xbf,0xf8,0xbb,0xbf,0x10,0x08,0xb7,0x60,0x00,0xe1,0x00,0x0b,0x40,0x00,
-0x1e,0x20,0x00,0xb7,0x44,0x5e,0xfd,0x50,0x07,0xbb,0xb8,0x5f,0x80,0x00,0x50,0x00,
-0x43,0xdf,0xfb,0x00,0x00,0x81,0x02,0x05,0x01,0x00,0x01,0x06,0x02,0x30,0x09,0x90,
-0x00,0xbc,0x02,0x01,0xc4,0x02,0x03,0xd0,0x02,0x71,0x78,0x4f,0xf4,0x87,0xff,0xe8,
-0x8e,0xc8,0x02,0x04,0xa3,0x1f,0x63,0xea,0x00,0x00,0x00,0xef,0xe0,0xde,0x00,0xf3,
+0x77,0x76,0x02,0x77,0x77,0x03,0x91,0x0d,0x12,0x77,0x1b,0x00,0xc1,0x00,0x88,0x47,
+0x70,0x77,0x01,0x77,0x74,0x03,0x60,0x08,0x02,0xc1,0x0e,0x50,0x07,0x77,0x60,0x00,
+0x80,0xa8,0x0a,0xf2,0x0c,0x50,0x00,0x87,0x77,0x00,0x00,0x13,0x00,0x06,0x79,0x97,
+0x70,0x08,0x77,0x50,0x09,0x77,0x50,0x08,0x77,0x60,0x00,0x16,0x00,0x57,0x77,0x76,
+0x71,0x07,0x10,0x00,0x06,0x00,0xf1,0x02,0x40,0x0a,0x77,0x50,0x07,0x78,0x60,0x56,
+0x8a,0x65,0x00,0x56,0x10,0x07,0x20,0x90,0x07,0xbf,0x06,0x00,0x2a,0x00,0xd1,0x97,
+0x76,0x00,0x08,0x11,0x20,0x00,0x35,0x54,0x00,0x47,0x79,0x77,0xa3,0x06,0x12,0x07,
+0xcb,0x0b,0x00,0xc9,0x0a,0x00,0x60,0x00,0x02,0x14,0x02,0x00,0x76,0x04,0x00,0x49,
+0x00,0x00,0x61,0x00,0xa3,0x07,0x77,0x60,0x56,0x66,0x66,0x11,0x11,0x11,0x05,0xa0,
+0x04,0x50,0x10,0x09,0x77,0x50,0x0a,0x1b,0x00,0x12,0x60,0x2a,0x00,0x01,0x79,0x00,
+0x15,0x70,0x30,0x00,0xa4,0x05,0x77,0x60,0x57,0x77,0x76,0x06,0x77,0x90,0x06,0x79,
+0x0c,0x02,0xb1,0x01,0x41,0x80,0x00,0x70,0x87,0x06,0x00,0x27,0x84,0x44,0xb1,0x01,
+0x00,0x7b,0x01,0x03,0x18,0x00,0x2c,0x37,0x73,0xf3,0x0a,0xf0,0x0a,0x05,0x77,0x48,
+0x00,0x06,0x60,0x80,0x00,0x77,0x08,0x72,0x07,0x70,0x70,0x05,0xbb,0x57,0x00,0x00,
+0x00,0x70,0x00,0x00,0x06,0x00,0xf3,0x0d,0x00,0x00,0x00,0x05,0x77,0x38,0x00,0x06,
+0x70,0x85,0x10,0x77,0x07,0x20,0x47,0x75,0x50,0x00,0x60,0x06,0x00,0x08,0x77,0xb0,
+0x00,0x76,0x6a,0x00,0x01,0x00,0xf3,0x06,0x37,0x73,0x77,0x05,0x50,0x77,0x07,0x80,
+0xba,0x07,0x70,0x77,0x3a,0xb3,0x77,0x01,0x10,0x77,0x00,0x00,0x67,0x1b,0x00,0xf1,
+0x05,0x84,0x07,0x07,0x72,0x78,0x07,0x71,0x07,0x36,0x64,0x05,0x03,0x87,0x76,0x04,
+0x77,0x75,0x06,0x77,0x74,0x1a,0x00,0x40,0x01,0x37,0x74,0x08,0x1b,0x00,0xe2,0x70,
+0x07,0x38,0x85,0x07,0x03,0x77,0x74,0x06,0x10,0x08,0x06,0x76,0x77,0x36,0x00,0x21,
+0x47,0x72,0x51,0x00,0x20,0x75,0x87,0x51,0x00,0x1a,0xa3,0x51,0x00,0xf3,0x05,0x72,
+0x78,0x07,0x74,0x88,0x07,0x71,0x88,0x49,0x83,0x78,0x00,0x66,0x75,0x00,0x10,0x08,
+0x00,0x00,0x08,0x1b,0x00,0xf3,0x05,0x75,0x08,0x07,0x70,0x78,0x07,0x70,0x78,0x3a,
+0xa5,0x07,0x01,0x00,0x07,0x05,0x30,0x00,0x04,0x97,0x74,0x1b,0x00,0xf0,0x1d,0x74,
+0x07,0x07,0x70,0x77,0x07,0x70,0x77,0x38,0x85,0x07,0x00,0x46,0x51,0x03,0x50,0x36,
+0x03,0x70,0x45,0x00,0x36,0x40,0x07,0x77,0x70,0x00,0x23,0x14,0x00,0x03,0x52,0x50,
+0x00,0x78,0x78,0x10,0x00,0x24,0x00,0x06,0x78,0x97,0x70,0x31,0x00,0xf0,0x09,0x8a,
+0x88,0x00,0x08,0xa8,0x90,0x01,0x11,0x81,0x20,0x36,0x66,0x65,0x00,0x67,0x7a,0x00,
+0x07,0x66,0x90,0x00,0xa7,0x78,0x10,0x1c,0x00,0xf1,0x0d,0x07,0x77,0x70,0x02,0x31,
+0x40,0x03,0x42,0x50,0x07,0x87,0x81,0x02,0x52,0x50,0x58,0x98,0x97,0x05,0x87,0x82,
+0x00,0x07,0x07,0x00,0x06,0xb7,0xb3,0xbe,0x00,0x93,0x7b,0x77,0x10,0x00,0x80,0x00,
+0x00,0x07,0x00,0x2e,0x00,0xa0,0x00,0x32,0x23,0x00,0x04,0x33,0x40,0x00,0x88,0x88,
+0x40,0x00,0x31,0x06,0x77,0x77,0x63,0x00,0xf2,0x07,0x09,0x9b,0x50,0x00,0x99,0xb6,
+0x00,0x33,0x33,0x32,0x04,0x45,0x44,0x30,0x07,0x77,0x90,0x00,0x76,0x78,0x00,0x0a,
+0x1c,0x00,0x00,0x46,0x00,0x70,0x76,0x07,0x05,0x50,0x07,0x07,0x70,0x03,0x00,0x64,
+0x19,0xa4,0x07,0x12,0x21,0x07,0x52,0x00,0x02,0xe9,0x00,0x62,0x08,0x07,0x70,0x07,
+0x2a,0x96,0xe9,0x00,0x16,0x01,0xe9,0x00,0x10,0x84,0x33,0x00,0x00,0x70,0x01,0x1b,
+0x65,0x70,0x01,0x02,0x04,0x01,0x10,0x07,0x70,0x01,0x19,0x86,0x04,0x01,0x00,0x1c,
+0x00,0xf4,0x05,0x76,0x07,0x00,0x67,0x75,0x70,0x00,0x88,0x17,0x00,0x52,0x15,0x77,
+0x24,0x33,0x47,0x00,0x06,0x60,0x70,0x6f,0x00,0xf3,0x09,0x01,0x00,0x00,0x02,0x88,
+0x17,0x00,0x39,0x82,0x70,0x05,0x26,0x18,0x71,0x46,0x90,0x70,0x00,0x11,0x03,0x00,
+0x06,0x77,0xa0,0x78,0x01,0x00,0x20,0x00,0xf5,0x09,0x01,0x76,0x08,0x00,0x49,0x73,
+0x80,0x05,0x37,0x08,0x71,0x54,0x70,0x80,0x00,0x42,0x08,0x00,0x08,0x00,0x30,0x00,
+0x97,0x77,0x20,0x00,0x10,0x87,0x40,0x00,0xf7,0x02,0x80,0x06,0x37,0x18,0x71,0x37,
+0x80,0x70,0x00,0x67,0x78,0x00,0x06,0x77,0x90,0x00,0xa7,0x20,0x00,0xf5,0x07,0x18,
+0x00,0x49,0x82,0x80,0x05,0x37,0x18,0x81,0x36,0x80,0x70,0x00,0x57,0x77,0x00,0x08,
+0x00,0x70,0x00,0x97,0x7a,0x80,0x00,0x20,0x87,0x18,0x40,0x00,0x22,0x05,0x26,0x40,
+0x00,0x96,0x30,0x03,0x00,0x09,0x77,0xb0,0x00,0x96,0x6a,0xa0,0x00,0x11,0x18,0x60,
+0x00,0xf1,0x01,0x27,0x18,0x71,0x37,0x90,0x80,0x00,0x16,0x64,0x00,0x08,0x10,0x90,
+0x00,0x57,0x68,0x80,0x01,0xf2,0x05,0x41,0x57,0x57,0x63,0x57,0x18,0x71,0x57,0x51,
+0x61,0xa9,0x44,0x81,0x67,0x04,0x31,0x67,0x00,0x00,0x57,0x12,0x01,0xf1,0x09,0x17,
+0x63,0x37,0x49,0x76,0x47,0x55,0x94,0x98,0x37,0x84,0x37,0x00,0x37,0x61,0x01,0x80,
+0x36,0x01,0x80,0x45,0x00,0x26,0x40,0x72,0x00,0xe8,0x17,0x00,0x3a,0x82,0x87,0x16,
+0x26,0x18,0x71,0x38,0x90,0x70,0x00,0x06,0x52,0x00,0xf0,0x3b,0x06,0x70,0x15,0x57,
+0x76,0x15,0x08,0x72,0x15,0x24,0x08,0x85,0x16,0x16,0x15,0x05,0x70,0x15,0x00,0x00,
+0x15,0x04,0x40,0x02,0x37,0x84,0x07,0x04,0x50,0x07,0x27,0x55,0x78,0x27,0x54,0x07,
+0x03,0x50,0x03,0x07,0x87,0x86,0x06,0x76,0x76,0x00,0x00,0x00,0x04,0x40,0x00,0x47,
+0x85,0x08,0x05,0x60,0x08,0x26,0x26,0x78,0x18,0x83,0x07,0x00,0x36,0x52,0x01,0x80,
+0x26,0x01,0x80,0x36,0x00,0x36,0x6a,0x00,0xf2,0x06,0x28,0x71,0x67,0x29,0x81,0x77,
+0x52,0x76,0x78,0x27,0x80,0x67,0x01,0x77,0x75,0x02,0x77,0x66,0x03,0xa7,0x75,0xd7,
+0x00,0xf3,0x06,0x06,0x71,0x08,0x27,0x83,0x08,0x18,0x65,0x78,0x25,0x26,0x67,0x05,
+0x60,0x07,0x05,0x20,0x03,0x05,0x87,0x75,0xbb,0x00,0xf0,0x05,0x92,0x08,0x17,0x93,
+0x78,0x26,0x26,0x08,0x08,0x64,0x77,0x00,0x46,0x53,0x02,0x70,0x36,0x01,0x97,0x83,
+0x19,0x00,0xf2,0x05,0x10,0x00,0x02,0x89,0x20,0x03,0x88,0x40,0x07,0x21,0x70,0x07,
+0x11,0x70,0x00,0x67,0x00,0x57,0x8a,0x76,0x33,0x00,0xf7,0x06,0x04,0xab,0x50,0x02,
+0x88,0x40,0x06,0x31,0x80,0x23,0x8a,0x32,0x29,0xbb,0x93,0x05,0x77,0xa0,0x0a,0x77,
+0x71,0x1b,0x00,0xf0,0x01,0x30,0x06,0x31,0x70,0x00,0x68,0x00,0x57,0x77,0x76,0x06,
+0x77,0x70,0x06,0x76,0x70,0x84,0x00,0xf3,0x09,0x79,0x26,0x10,0x27,0x92,0x61,0x02,
+0x53,0x56,0x30,0x25,0x44,0x67,0x20,0x57,0x06,0x10,0x58,0x97,0x71,0x00,0x00,0x06,
+0x10,0xa4,0x02,0xf3,0x06,0x02,0x7a,0x35,0x10,0x18,0x83,0x52,0x03,0x52,0x65,0x92,
+0x06,0x91,0x62,0x05,0x77,0x54,0x10,0x05,0x77,0xa1,0x20,0x00,0x00,0xf7,0x00,0xf1,
+0x09,0x03,0x78,0x65,0x20,0x07,0x71,0x42,0x03,0x51,0x64,0x92,0x07,0x91,0x43,0x05,
+0x78,0x65,0x30,0x06,0x00,0x10,0x00,0x87,0x77,0x20,0x00,0xf1,0x0d,0x03,0x30,0x10,
+0x03,0x89,0x55,0x20,0x06,0x62,0x53,0x01,0x87,0x45,0x71,0x57,0xa6,0x62,0x00,0x47,
+0x78,0x10,0x04,0x77,0x92,0x00,0x87,0x77,0x20,0x40,0x00,0x83,0x60,0x10,0x04,0x77,
+0x65,0x20,0x07,0x72,0x60,0x00,0xa1,0x53,0x05,0x77,0x64,0x20,0x04,0x77,0x80,0x00,
+0x47,0x86,0x01,0x02,0x06,0x01,0xf2,0x04,0x34,0x27,0x93,0x24,0x17,0x26,0x24,0x16,
+0x25,0x24,0x04,0x80,0x24,0x48,0x97,0x44,0x00,0x00,0x25,0x1b,0x00,0x53,0x03,0x89,
+0x20,0x03,0x89,0x06,0x01,0xf3,0x0b,0x03,0x77,0x30,0x5a,0x99,0x96,0x00,0x76,0x00,
+0x06,0x77,0x61,0x01,0x77,0x10,0x07,0x11,0x70,0x04,0x76,0x40,0x57,0x77,0x77,0x00,
+0x25,0x2f,0x00,0xf1,0x09,0x03,0x61,0x00,0x37,0x66,0x25,0x07,0x65,0x25,0x08,0x74,
+0x25,0x58,0x87,0x35,0x01,0x10,0x12,0x04,0x99,0xb5,0x07,0xaa,0xa4,0x1b,0x03,0x07,
+0x36,0x00,0x10,0x77,0x36,0x00,0x62,0x03,0x53,0x50,0x03,0x42,0x40,0x66,0x00,0xf0,
+0x06,0x16,0xa4,0x25,0x18,0x94,0x25,0x17,0x08,0x25,0x05,0x72,0x25,0x47,0x76,0x35,
+0x07,0x00,0x01,0x07,0x77,0x72,0x23,0x02,0xf2,0x05,0x60,0x25,0x47,0x76,0x16,0x07,
+0x72,0x16,0x24,0x07,0x16,0x16,0x16,0x16,0x05,0x60,0x16,0x00,0x00,0x15,0x33,0x00,
+0xf0,0x01,0x26,0xbe,0x00,0x8d,0xff,0xff,0x00,0xff,0xe9,0x5f,0x00,0xf3,0x00,0x0f,
+0x00,0xf0,0x04,0x00,0xf0,0x07,0x0a,0xff,0xaf,0xf0,0x0a,0xfa,0xaf,0xa0,0x00,0x00,
+0xbd,0xcc,0xce,0xab,0x8b,0x00,0x07,0x58,0xcd,0x66,0x6a,0xac,0x04,0x00,0x00,0x0c,
+0x00,0x00,0x14,0x00,0xf0,0x01,0x34,0x14,0x44,0x43,0xff,0x7f,0xff,0xff,0xab,0x4b,
+0xbb,0xba,0xbc,0x5c,0xcc,0xcb,0x0c,0x00,0x44,0x67,0x17,0x88,0x86,0x14,0x00,0xf0,
+0x4b,0x00,0x00,0x00,0x9a,0x00,0x00,0x09,0xfa,0xa9,0x00,0x9f,0xa0,0xaf,0x99,0xfa,
+0x00,0x0a,0xff,0xa0,0x00,0x00,0x99,0x00,0x00,0x63,0x00,0x72,0xcf,0x4a,0xf4,0x1d,
+0xff,0x60,0x0a,0xff,0x30,0xaf,0x7d,0xf3,0xa6,0x01,0xb3,0x00,0x0c,0x51,0x00,0x1d,
+0x7d,0x6e,0x70,0x8d,0x0d,0x65,0xf1,0xc7,0x0d,0x60,0xe6,0xd7,0x06,0x20,0xe6,0x9d,
+0x00,0x04,0xf2,0x1e,0xc7,0x8f,0x80,0x01,0x9d,0xc6,0x00,0x00,0x0c,0xc0,0x00,0x18,
+0x8f,0xf8,0x81,0x8f,0xfe,0xef,0xf8,0x2f,0xe0,0x0e,0xf2,0x04,0x00,0x00,0x0c,0x00,
+0x00,0x14,0x00,0x00,0x1c,0x00,0xf4,0x19,0x00,0x00,0x30,0x22,0x00,0x00,0xaf,0xaa,
+0xa0,0x01,0xda,0x6a,0xfa,0x03,0xe8,0xbf,0xb8,0xe3,0xb6,0xdf,0xff,0xd6,0xb0,0x8f,
+0xfb,0xff,0x80,0x08,0xfc,0x0c,0xf8,0x00,0x5b,0x80,0x8b,0x50,0x00,0x0f,0xf0,0x00,
+0x04,0x00,0xf0,0x17,0x07,0xff,0xff,0x70,0x00,0x9f,0xf9,0x00,0x78,0x7a,0xa7,0x87,
+0xff,0xfb,0xbf,0xff,0xff,0xff,0xfb,0xbf,0x05,0xff,0xff,0xf5,0x01,0xe3,0x00,0x03,
+0xe1,0xa8,0x00,0x00,0x08,0xaf,0xff,0x50,0x6f,0xff,0x01,0x00,0x10,0xfd,0x04,0x00,
+0x00,0x8e,0x01,0xf1,0x12,0x02,0xbf,0xfb,0x3f,0x2e,0x92,0x18,0xff,0x9a,0x00,0x6c,
+0xff,0x31,0x00,0x24,0x44,0x44,0x42,0x00,0x13,0xff,0xc6,0x00,0xb9,0xfe,0xa5,0x5b,
+0xd1,0xf2,0x8c,0xc8,0x10,0x30,0x3f,0x05,0x20,0x34,0xcf,0x35,0x00,0xf1,0x08,0xab,
+0xff,0x00,0x4f,0x00,0x01,0x00,0x09,0x00,0x34,0xcf,0x01,0xff,0xff,0x1b,0xff,0xff,
+0x1b,0xbb,0xff,0x01,0x00,0x4f,0x40,0x03,0xf2,0x22,0x00,0x00,0x54,0x00,0x00,0x90,
+0x23,0xb3,0x34,0xcf,0x02,0xc3,0xbf,0xff,0xf1,0xb5,0x6c,0xff,0xff,0x1b,0x56,0xca,
+0xbf,0xf0,0x2c,0x3a,0x00,0x4f,0x02,0x3b,0x30,0x00,0x10,0x05,0x40,0xdf,0xff,0xff,
+0xfd,0xf0,0x7f,0xff,0xff,0xf8,0xcf,0xb1,0xbf,0xfb,0x5b,0xb4,0x00,0x10,0xdf,0x87,
+0x00,0xf1,0x10,0xb4,0x00,0x03,0xfb,0x00,0x0b,0xff,0x40,0x6f,0xff,0xd0,0xdf,0xff,
+0xf5,0xf8,0xff,0xf7,0xaa,0x8f,0xf2,0x1a,0xfd,0x40,0x40,0x00,0x2f,0x20,0x8f,0xf2,
+0x9f,0xff,0x7c,0x00,0xf2,0x15,0x5e,0xff,0xf2,0x2d,0xfb,0x10,0x19,0x00,0x00,0x00,
+0x0d,0xa1,0x00,0x00,0xff,0xf7,0x00,0x0f,0xff,0xfd,0x40,0xff,0xff,0xff,0xaf,0xff,
+0xff,0xfa,0xff,0xff,0xd4,0x0f,0xff,0x70,0x00,0xda,0x2b,0x03,0xb9,0x9b,0x90,0x9b,
+0x9f,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0x07,0x00,0xae,0xf2,0x42,0x02,0x42,0x24,
+0x44,0x44,0x2f,0xff,0xff,0x01,0x00,0xc1,0xf8,0xbb,0xbb,0xb8,0x20,0x00,0x4f,0x80,
+0x2f,0xff,0x92,0xff,0x70,0x00,0x90,0xfe,0x5f,0xfd,0x22,0xf9,0x10,0x1b,0x00,0x00,
+0x1f,0x03,0xf1,0x1b,0x8f,0x80,0x00,0x00,0x7f,0xff,0x70,0x00,0x5f,0xff,0xff,0x50,
+0x0e,0xff,0xff,0xfe,0x00,0x58,0x88,0x88,0x50,0x0f,0xff,0xff,0xff,0x00,0xab,0xbb,
+0xbb,0xa0,0x00,0x06,0x20,0x07,0xf4,0x07,0xf5,0x05,0xf5,0x00,0x2e,0xb0,0x03,0x00,
+0xf0,0x1c,0x60,0x00,0x10,0x26,0x00,0x04,0xf6,0x00,0x05,0xf6,0x00,0x06,0xf5,0x00,
+0xbe,0x20,0xbe,0x10,0x6e,0x10,0x00,0x10,0x00,0x00,0x04,0x00,0x00,0x03,0xf3,0x00,
+0x00,0x4f,0x40,0x07,0x8a,0xfa,0x87,0xef,0xff,0xff,0xe0,0x04,0xf4,0x0e,0x00,0x80,
+0x00,0x01,0xb1,0x00,0x78,0x88,0x88,0x7e,0x59,0x00,0xf1,0x0c,0x8c,0xcc,0x80,0x01,
+0xdd,0x16,0x3d,0xd1,0xcf,0x55,0xed,0x5f,0xcb,0xf5,0xdf,0xd5,0xfc,0x1d,0xd3,0x73,
+0xdd,0x10,0x08,0xdc,0xc8,0x10,0x1d,0x89,0x01,0xf1,0x11,0x5e,0x8c,0xcc,0xa2,0x00,
+0x00,0x2d,0xb4,0x49,0xf4,0x00,0x7a,0x1a,0xff,0x3f,0xe1,0x07,0xfa,0x06,0xf7,0xff,
+0x10,0x0a,0xf3,0x03,0xef,0x40,0x00,0x06,0xcc,0x71,0xbb,0x02,0x01,0x40,0x89,0x00,
+0x00,0x3e,0x2e,0x00,0x20,0x0c,0xfc,0x1e,0x03,0xf0,0x28,0xfc,0xf6,0x00,0x00,0x00,
+0xed,0x0d,0xe0,0x00,0x00,0x8f,0xe0,0xef,0x80,0x00,0x2f,0xff,0x6f,0xff,0x20,0x0b,
+0xff,0xe2,0xef,0xfa,0x00,0xdf,0xff,0xff,0xff,0xd0,0x00,0x00,0x00,0x20,0x44,0x00,
+0x04,0xf5,0xef,0xb1,0xcf,0xfd,0x01,0x8c,0xd1,0xc1,0x01,0xdc,0x81,0xc1,0xef,0xc1,
+0xbf,0xfd,0x14,0x00,0x00,0x1c,0x00,0x01,0x1e,0x04,0xd2,0xe4,0x00,0x04,0xfc,0xf4,
+0x04,0xf8,0x08,0xf4,0xb8,0x00,0x08,0xb0,0x5b,0x03,0xd2,0x0b,0x80,0x00,0x8b,0x4f,
+0x80,0x8f,0x40,0x4f,0xcf,0x40,0x00,0x4e,0xa2,0x03,0xf1,0x12,0x94,0x14,0x44,0x40,
+0x00,0xbf,0xf8,0xbb,0xbf,0x10,0x08,0xb7,0x60,0x00,0xe1,0x00,0x0b,0x40,0x00,0x1e,
+0x20,0x00,0xb7,0x44,0x5e,0xfd,0x50,0x07,0xbb,0xb8,0x5f,0x80,0x00,0x50,0x00,0x43,
+0xdf,0xfb,0x00,0x00,0x81,0x02,0x05,0x01,0x00,0x01,0x06,0x02,0x30,0x09,0x90,0x00,
+0xbc,0x02,0x01,0xc4,0x02,0x03,0xd0,0x02,0x71,0x78,0x4f,0xf4,0x87,0xff,0xe8,0x8e,
+0xc8,0x02,0x03,0x87,0x04,0x73,0x07,0xea,0x00,0x00,0x00,0xef,0xe0,0xde,0x00,0xf3,
 0x33,0x4f,0x70,0x00,0x00,0x1d,0xe0,0x07,0xdc,0x4d,0xf3,0x00,0xef,0xff,0xe3,0x00,
 0x0a,0xec,0x70,0x00,0x00,0x03,0x00,0x00,0x00,0xcd,0xc0,0x2d,0xc0,0xe7,0xf2,0xee,
 0x20,0x4b,0xff,0xe2,0x00,0x04,0xff,0xa0,0x00,0xcd,0xf9,0xf9,0x00,0xe7,0xe0,0x7f,
@@ -972,66 +1062,28 @@ static const uint8_t lz4FontData[] ={
 0x03,0xdf,0x18,0x81,0x88,0x1f,0xfe,0xaa,0xca,0xae,0xff,0xea,0xac,0xaa,0xef,0xf1,
 0x80,0x00,0x81,0xd1,0x03,0x01,0x01,0x00,0xf0,0x07,0x4b,0xc0,0x00,0x00,0x5c,0xff,
 0xb0,0x00,0x6e,0xff,0xff,0x40,0x0d,0xff,0xff,0xfc,0x00,0x06,0x88,0xcf,0xf5,0x00,
-0x02,0x02,0x00,0x05,0x00,0x00,0xa1,0x0a,0x13,0x5d,0x2a,0x00,0x9b,0xff,0xf8,0xb0,
-0xff,0xf8,0xfb,0xff,0xfc,0x88,0x11,0x03,0xf0,0x0d,0x00,0x04,0x77,0x40,0x00,0x09,
-0xff,0xcc,0xff,0x90,0xcd,0x40,0x00,0x04,0xdc,0x20,0x4b,0xff,0xb4,0x02,0x01,0xfa,
-0x55,0xaf,0x10,0x00,0x00,0x21,0x38,0x00,0x10,0xee,0x05,0x00,0x20,0x87,0x00,0x31,
-0x04,0xc0,0x44,0x40,0xfb,0xbb,0xbb,0xbb,0xda,0xf7,0xee,0xee,0xee,0x5f,0x4e,0x01,
-0xb9,0x2f,0xf5,0x66,0x66,0x66,0xab,0x8b,0xbb,0xbb,0xbb,0xb3,0x1e,0x00,0x10,0x70,
-0x1e,0x00,0x10,0x80,0x1e,0x00,0x1e,0x54,0x1e,0x00,0xcd,0xe0,0x00,0x5f,0xf8,0xff,
-0xf0,0x00,0x2f,0xf5,0x66,0x64,0x44,0x1e,0x00,0xcc,0xe7,0x00,0x00,0x5f,0xf8,0xf8,
-0x00,0x00,0x2f,0xf5,0x65,0x44,0x1e,0x00,0x60,0xd8,0xf0,0x00,0x00,0x00,0x5f,0x05,
-0x00,0x61,0x2f,0xf4,0x44,0x44,0x44,0xad,0x1e,0x00,0x04,0x2c,0x02,0x10,0xd8,0x05,
-0x00,0xf1,0x03,0x36,0x40,0x00,0x09,0xb1,0x91,0x11,0x17,0x20,0xef,0x88,0xd8,0x88,
-0xd9,0x02,0x20,0x06,0x48,0x87,0x22,0x14,0xec,0xe5,0x0d,0xf3,0x1d,0xdd,0xc3,0x04,
-0xff,0x3e,0xd0,0x9c,0xb5,0x5f,0x2b,0xf7,0x1a,0xf4,0xbf,0x81,0xbf,0x39,0xc9,0x64,
-0xf2,0x4f,0xf3,0xde,0x00,0x6d,0xed,0x30,0x78,0xdf,0xd8,0x77,0x88,0x88,0x87,0x8f,
-0xff,0xff,0x88,0xcc,0x8c,0xc8,0x8c,0xc8,0xcc,0x07,0x00,0x30,0x85,0xff,0xff,0x4f,
-0x01,0xf1,0x00,0x7d,0x30,0x00,0x00,0x4b,0xfd,0x00,0x00,0x7f,0x9b,0x70,0x00,0x7f,
-0xff,0x40,0x24,0x04,0x00,0x04,0x00,0x65,0x0e,0xff,0x70,0x00,0x00,0xee,0x08,0x1f,
-0xd2,0xaf,0xff,0xff,0xfc,0x0b,0xff,0x9c,0xc9,0xff,0xaf,0xff,0xc1,0x1c,0x05,0x00,
-0x01,0x0f,0x00,0x01,0x19,0x00,0xf3,0x02,0x07,0xff,0xfe,0x17,0xb6,0x27,0xc3,0xfe,
-0xb9,0xbe,0x3f,0xff,0xff,0xf3,0xff,0xff,0xff,0x07,0x00,0x50,0x3c,0xff,0xff,0xe1,
-0x00,0xcd,0x02,0xc0,0x23,0x00,0x02,0xf0,0x2e,0x92,0x22,0x5f,0x0d,0xff,0xff,0xff,
-0x09,0x00,0x4b,0x21,0x00,0x23,0x00,0x01,0x00,0x2f,0xfe,0x00,0x01,0x00,0x03,0x1b,
-0xf9,0x08,0x00,0x00,0x01,0x00,0x72,0xfd,0xfc,0x00,0xff,0xfc,0x00,0xfb,0xf5,0x08,
-0x0d,0x01,0x00,0x2f,0x01,0x01,0x17,0x00,0x01,0x2f,0xf5,0x00,0x01,0x00,0x15,0x1e,
-0xf2,0x1e,0x00,0x0e,0x90,0x00,0xb3,0xfc,0x00,0xff,0x00,0x00,0xf8,0xff,0xfb,0xfc,
-0x00,0xfa,0x85,0x02,0x00,0x12,0x04,0x2d,0xfd,0xfe,0x7b,0x00,0x10,0xfe,0x1a,0x00,
-0x05,0xd5,0x02,0x0e,0xf2,0x00,0x07,0x0a,0x00,0x19,0xff,0x1f,0x00,0x03,0x0e,0x00,
-0x13,0xfa,0x0b,0x00,0x00,0x48,0x00,0x3f,0xff,0xfd,0xff,0x9c,0x00,0x0a,0x05,0x7c,
-0x00,0x00,0x30,0x08,0x00,0x07,0x00,0x16,0xfe,0x30,0x00,0x11,0xf1,0x04,0x01,0x15,
-0xf0,0x24,0x00,0x20,0xfe,0xff,0x20,0x00,0x01,0x2b,0x00,0x0d,0x44,0x00,0x10,0xfe,
-0x08,0x00,0x0e,0x91,0x01,0x0c,0x9b,0x00,0x0f,0x01,0x00,0x07,0x1b,0xfc,0xd1,0x01,
-0x10,0xfe,0x6b,0x00,0x00,0x70,0x00,0x11,0xfc,0x0f,0x00,0x14,0xeb,0x6c,0x00,0x97,
-0xfc,0x00,0x00,0xef,0xfd,0xf5,0xf7,0x00,0xf1,0xdc,0x01,0x25,0xf8,0xfa,0x0c,0x00,
-0x00,0xdf,0x02,0x33,0xf7,0x00,0xf4,0x43,0x00,0x10,0xfe,0xac,0x00,0x00,0x7c,0x00,
-0x0f,0xe0,0x01,0x02,0x10,0xfd,0xd2,0x00,0x1f,0xfe,0x97,0x00,0x0b,0x1e,0xfb,0x8c,
-0x01,0x05,0x7f,0x01,0x93,0xf2,0xf2,0x00,0x00,0xfb,0xfe,0xf1,0xff,0x01,0x40,0x02,
-0xd3,0xf9,0xfa,0x00,0xf9,0xfa,0xfb,0xf9,0x00,0xfa,0xfc,0xfc,0xfb,0xfc,0x1a,0x01,
-0x66,0xf2,0xfe,0x00,0x00,0xfb,0xff,0x2b,0x01,0x62,0xfd,0xfd,0x00,0x00,0xfd,0xfe,
-0x4c,0x01,0x22,0x00,0x01,0x24,0x00,0x22,0xf8,0xfc,0x63,0x00,0x13,0x01,0x24,0x00,
-0x23,0xfe,0xfe,0x6c,0x01,0x08,0xa1,0x01,0x14,0xfd,0x76,0x00,0x15,0x01,0x82,0x00,
-0x02,0xb0,0x01,0x04,0x92,0x00,0xe0,0x01,0xfd,0xf3,0xfd,0x00,0x00,0xfa,0xfe,0xfa,
-0xff,0x01,0xfa,0x01,0x01,0x92,0x00,0x70,0xfb,0xfc,0xff,0xfe,0xfc,0xfe,0xfc,0xd3,
-0x01,0x36,0xff,0xfe,0x01,0xc5,0x00,0x09,0xa8,0x01,0x14,0xff,0x48,0x00,0x1e,0xfe,
-0xb2,0x01,0x1f,0xff,0xab,0x01,0x07,0x0f,0xe9,0x01,0x0d,0x1f,0xfe,0x24,0x00,0x0b,
-0x2e,0xff,0xff,0x14,0x02,0x0f,0x38,0x02,0x1f,0x14,0xff,0x80,0x02,0x1e,0x01,0xd7,
-0x02,0x1a,0xff,0xa1,0x02,0x2f,0xfa,0x00,0x01,0x00,0x24,0x0b,0x81,0x00,0x1f,0xf8,
-0xd8,0x00,0x10,0x1d,0x01,0x28,0x00,0x00,0xd0,0x01,0x01,0x93,0x00,0x10,0x03,0x2b,
-0x02,0x0f,0x6f,0x00,0x15,0x1b,0x01,0xc4,0x04,0x02,0xa7,0x03,0x1d,0x01,0x14,0x01,
-0x1f,0xf8,0xd8,0x00,0x24,0x1f,0xff,0x24,0x00,0x26,0x0f,0x3d,0x00,0x07,0x12,0x01,
-0x36,0x59,0x21,0x02,0x03,0x83,0x35,0x2c,0x04,0x05,0x21,0x00,0x00,0xc5,0x45,0xf1,
-0x0a,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,
-0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x00,0xbc,0x41,0x70,0x1b,0x1c,0x00,
-0x1d,0x1e,0x00,0x1f,0x34,0x09,0xff,0x01,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,
-0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x00,0x01,0x00,0xff,0xfe,0x0a,0x75,0x02,0x20,
-0x03,0x02,0x70,0x02,0x10,0x06,0xf4,0x2c,0x0a,0x01,0x00,0x50,0x09,0x00,0x0a,0x00,
-0x0b,0xbc,0x0b,0x10,0x00,0xaa,0x41,0x00,0x08,0x00,0xa2,0x0b,0x00,0x0d,0x0e,0x0f,
-0x10,0x11,0x12,0x13,0x14,0x34,0x0f,0x62,0x16,0x00,0x17,0x17,0x17,0x18,0xf7,0x2c,
-0xe0,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0xaa,
-0x2b,0x0f,0x01,0x00,0x01,0x1f,0x24,0x6f,0x02,0xff,0xe9,0x50,0x00,0x00,0x00,0x00,
-0x00,
+0x02,0x02,0x00,0x05,0x00,0x53,0x60,0x00,0x00,0x00,0x5d,0x2a,0x00,0x9b,0xff,0xf8,
+0xb0,0xff,0xf8,0xfb,0xff,0xfc,0x88,0x11,0x03,0xf0,0x0d,0x00,0x04,0x77,0x40,0x00,
+0x09,0xff,0xcc,0xff,0x90,0xcd,0x40,0x00,0x04,0xdc,0x20,0x4b,0xff,0xb4,0x02,0x01,
+0xfa,0x55,0xaf,0x10,0x00,0x00,0x21,0x38,0x00,0x10,0xee,0x05,0x00,0x20,0x87,0x00,
+0x31,0x04,0xc0,0x44,0x40,0xfb,0xbb,0xbb,0xbb,0xda,0xf7,0xee,0xee,0xee,0x5f,0x4e,
+0x01,0xb9,0x2f,0xf5,0x66,0x66,0x66,0xab,0x8b,0xbb,0xbb,0xbb,0xb3,0x1e,0x00,0x10,
+0x70,0x1e,0x00,0x10,0x80,0x1e,0x00,0x1e,0x54,0x1e,0x00,0xcd,0xe0,0x00,0x5f,0xf8,
+0xff,0xf0,0x00,0x2f,0xf5,0x66,0x64,0x44,0x1e,0x00,0xcc,0xe7,0x00,0x00,0x5f,0xf8,
+0xf8,0x00,0x00,0x2f,0xf5,0x65,0x44,0x1e,0x00,0x60,0xd8,0xf0,0x00,0x00,0x00,0x5f,
+0x05,0x00,0x61,0x2f,0xf4,0x44,0x44,0x44,0xad,0x1e,0x00,0x04,0x2c,0x02,0x10,0xd8,
+0x05,0x00,0xf0,0x04,0x36,0x40,0x00,0x09,0xb1,0x91,0x11,0x17,0x20,0xef,0x88,0xd8,
+0x88,0xd9,0x02,0x20,0x06,0x48,0x70,0x18,0x03,0x13,0xec,0x25,0x00,0xf3,0x1e,0x06,
+0xdd,0xc3,0x04,0xff,0x3e,0xd0,0x9c,0xb5,0x5f,0x2b,0xf7,0x1a,0xf4,0xbf,0x81,0xbf,
+0x39,0xc9,0x64,0xf2,0x4f,0xf3,0xde,0x00,0x6d,0xed,0x30,0x78,0xdf,0xd8,0x77,0x88,
+0x88,0x87,0x8f,0xff,0xff,0x88,0xcc,0x8c,0xc8,0x8c,0xc8,0xcc,0x07,0x00,0x30,0x85,
+0xff,0xff,0x4f,0x01,0xf1,0x00,0x7d,0x30,0x00,0x00,0x4b,0xfd,0x00,0x00,0x7f,0x9b,
+0x70,0x00,0x7f,0xff,0x40,0x24,0x04,0x00,0x04,0x00,0x74,0x0e,0xff,0x70,0x00,0x00,
+0xee,0x70,0x8e,0x01,0xd2,0xaf,0xff,0xff,0xfc,0x0b,0xff,0x9c,0xc9,0xff,0xaf,0xff,
+0xc1,0x1c,0x05,0x00,0x01,0x0f,0x00,0x01,0x19,0x00,0xf3,0x02,0x07,0xff,0xfe,0x17,
+0xb6,0x27,0xc3,0xfe,0xb9,0xbe,0x3f,0xff,0xff,0xf3,0xff,0xff,0xff,0x07,0x00,0x50,
+0x3c,0xff,0xff,0xe1,0x00,0xcd,0x02,0x90,0x23,0x00,0x02,0xf0,0x2e,0x92,0x22,0x5f,
+0x0d,0x6b,0x02,0x90,0x2e,0x92,0x22,0x21,0x00,0x23,0x00,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -1041,11 +1093,18 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 176, .range_length = 63475, .glyph_id_start = 115, .list_length = 514, .type = 3, .unicode_list = 5032, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[24368] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 4836, .size = 4075, .comp_size = 3431 },
+{ .bitmap_start = 4075, .comp_offset = 8267, .size = 4081, .comp_size = 3088 },
+{ .bitmap_start = 8156, .comp_offset = 11355, .size = 4076, .comp_size = 3259 },
+{ .bitmap_start = 12232, .comp_offset = 14614, .size = 3114, .comp_size = 2695 },
+};
+
+static uint8_t etxUncompBuf[9022] __SDRAMFONTS;
 
 const etxLz4Font lv_font_ko_XXS = {
-.uncomp_size = 24104,
-.comp_size = 16465,
+.uncomp_size = 8758,
+.comp_size = 4836,
 .line_height = 10,
 .base_line = 2,
 .subpx = 0,
@@ -1058,12 +1117,13 @@ const etxLz4Font lv_font_ko_XXS = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 36,
-.glyph_bitmap = 6060,
-.class_pair_values = 21406,
-.left_class_mapping = 22846,
-.right_class_mapping = 23475,
+.class_pair_values = 6060,
+.left_class_mapping = 7500,
+.right_class_mapping = 8129,
+.block_num = 4,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 24368,
+.lvglFontBufSize = 9022,
 };
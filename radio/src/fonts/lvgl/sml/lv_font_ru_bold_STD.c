@@ -98,664 +98,678 @@ static const uint8_t lz4FontData[] ={
 0x00,0x22,0x40,0x28,0x08,0x00,0x13,0x8d,0x08,0x00,0x13,0xda,0x08,0x00,0x22,0x27,
 0x29,0xa8,0x00,0xa2,0x85,0x29,0x60,0x0b,0x0b,0x0e,0x00,0xfe,0xd2,0x29,0x60,0x00,
 0x22,0x26,0x2a,0xa8,0x00,0xa2,0x88,0x2a,0x40,0x10,0x11,0x0a,0x00,0x00,0xdd,0x2a,
-0x60,0x00,0x60,0x23,0x2b,0x10,0x0d,0x0e,0x09,0x80,0x07,0xf2,0xff,0x8f,0xd1,0x1b,
-0x14,0x1e,0xb0,0xeb,0xb7,0xeb,0xba,0xeb,0xbb,0xeb,0xbc,0xeb,0xc0,0xeb,0xc2,0xeb,
-0xc4,0xeb,0xc8,0xeb,0xcb,0xeb,0xd0,0xeb,0xd5,0xeb,0xd6,0xeb,0xd7,0xeb,0xed,0xeb,
-0xf2,0xeb,0xf7,0xeb,0xfa,0xeb,0xfb,0xeb,0xfc,0xeb,0x00,0xec,0x01,0xec,0x02,0xec,
-0x03,0xec,0x16,0xec,0x17,0xec,0x1d,0xec,0x1f,0xec,0x20,0xec,0x23,0xec,0x26,0xec,
-0x27,0xec,0x28,0xec,0x2a,0xec,0x42,0xec,0x44,0xec,0x73,0xec,0x74,0xec,0x76,0xec,
-0x78,0xec,0x8f,0xec,0x96,0xec,0x99,0xec,0xa2,0xec,0xcb,0xec,0xd3,0xec,0x0a,0xed,
-0x9a,0xed,0xef,0xed,0xf0,0xed,0xf1,0xed,0xf2,0xed,0xf3,0xed,0x36,0xee,0x42,0xee,
-0x9c,0xee,0xb3,0xee,0x09,0xf1,0x71,0xf3,0x51,0xf4,0x2f,0xc1,0xfb,0x1f,0xb0,0xfa,
-0x0f,0xa0,0xf9,0x06,0x31,0xd9,0x1e,0xa0,0x9a,0x8b,0x9a,0x8b,0x98,0x89,0x43,0x44,
-0x00,0x1f,0x0b,0x70,0x00,0x5d,0x0f,0x30,0x2f,0xff,0xff,0xf7,0x01,0xb8,0x6d,0x10,
-0x00,0xe4,0x7a,0x00,0x8f,0xff,0xff,0xf0,0x15,0xf2,0xd6,0x20,0x06,0xc0,0xf2,0x00,
-0x08,0xa2,0xf0,0x00,0x00,0x09,0x70,0x00,0x05,0xdb,0x30,0x09,0xfe,0xff,0x40,0xfd,
-0x02,0xfb,0x0f,0xe1,0x04,0x40,0x7f,0xf8,0x10,0x00,0x4b,0xfe,0x31,0x41,0x04,0xfb,
-0x4f,0x90,0x1f,0xc0,0xdf,0xce,0xf7,0x01,0x8e,0xc5,0x00,0x00,0xb5,0x00,0x0a,0xfc,
-0x10,0x00,0x00,0x5e,0x2c,0x80,0xb3,0x00,0x5e,0x0b,0x96,0xc0,0x00,0x0c,0xfe,0x4e,
-0x20,0x00,0x00,0x10,0xb7,0x00,0x00,0x00,0x06,0xc5,0xdd,0x50,0x00,0x2e,0x2e,0x77,
-0xf0,0x00,0xa7,0x0e,0x65,0xf0,0x00,0x00,0x06,0xee,0x70,0x01,0xbf,0xd5,0x00,0x00,
-0x9f,0x9d,0xf0,0x00,0x0a,0xf0,0x9f,0x00,0x00,0x4f,0xdf,0x50,0x00,0x05,0xff,0x90,
-0x66,0x04,0xfb,0xbf,0x6e,0xb0,0x8f,0x50,0xdf,0xf6,0x04,0xfd,0x6a,0xff,0x30,0x06,
-0xdf,0xe9,0xfd,0x10,0x9b,0x9b,0x9a,0x44,0x00,0x01,0x00,0x02,0xe2,0x00,0xd9,0x00,
-0x7f,0x10,0x0d,0xb0,0x00,0xf7,0x00,0x2f,0x60,0x03,0xf5,0x00,0x2f,0x60,0x00,0xf8,
-0x00,0x0b,0xc0,0x00,0x4f,0x30,0x00,0xad,0x10,0x00,0x91,0x10,0x00,0x9a,0x00,0x2e,
-0x70,0x07,0xf1,0x02,0xf6,0x00,0xea,0x00,0xdc,0x00,0xcd,0x00,0xdc,0x00,0xf9,0x03,
-0xf4,0x0a,0xd0,0x5f,0x30,0x74,0x00,0x00,0x99,0x00,0x43,0x88,0x23,0x8e,0xfe,0xf8,
-0x02,0xff,0x20,0x0d,0x79,0xc0,0x05,0x01,0x50,0x00,0x4b,0x40,0x00,0x05,0xf6,0x00,
-0x00,0x5f,0x60,0x0a,0xff,0xff,0xfb,0x6a,0xcf,0xca,0x70,0x0e,0x00,0xf0,0x17,0x00,
-0x1f,0x72,0xf6,0x5f,0x26,0x70,0x02,0x22,0x04,0xff,0xf4,0x15,0x55,0x10,0x1d,0x91,
-0xea,0x00,0x00,0xd8,0x00,0x03,0xf2,0x00,0x08,0xd0,0x00,0x0d,0x70,0x00,0x3f,0x20,
-0x00,0x8c,0x00,0x00,0xe7,0x11,0x00,0xf8,0x22,0x09,0xc0,0x00,0x0e,0x70,0x00,0x02,
-0xbf,0xd6,0x00,0xdf,0x8c,0xf5,0x3f,0x90,0x1f,0xa5,0xf7,0x00,0xfd,0x6f,0x70,0x0f,
-0xd5,0xf7,0x00,0xfc,0x3f,0x90,0x2f,0xa0,0xdf,0x8c,0xf5,0x02,0xbf,0xd7,0x00,0x02,
-0x8d,0x1c,0xff,0xf1,0x95,0xcf,0x10,0x0c,0xf1,0x00,0x05,0x00,0xf0,0xb5,0x04,0xcf,
-0xe8,0x02,0xfe,0x8c,0xf6,0x7f,0x50,0x3f,0xa0,0x00,0x06,0xf7,0x00,0x03,0xfd,0x00,
-0x03,0xee,0x10,0x03,0xee,0x20,0x02,0xef,0x97,0x77,0x6f,0xff,0xff,0xf0,0x05,0xdf,
-0xd7,0x03,0xfe,0x8c,0xf6,0x38,0x30,0x3f,0x90,0x01,0x29,0xf6,0x00,0x8f,0xfa,0x00,
-0x02,0x59,0xf7,0x5a,0x30,0x1f,0xc4,0xfe,0x8b,0xf8,0x05,0xdf,0xe8,0x00,0x00,0x02,
-0xff,0x10,0x00,0x0b,0xff,0x10,0x00,0x5f,0xff,0x10,0x01,0xea,0xcf,0x10,0x09,0xe1,
-0xcf,0x10,0x3f,0x82,0xcf,0x30,0x9f,0xff,0xff,0xf1,0x35,0x55,0xdf,0x50,0x00,0x00,
-0xcf,0x10,0x0a,0xff,0xff,0x90,0xbf,0x88,0x85,0x0d,0xc0,0x00,0x00,0xff,0xff,0xb1,
-0x09,0x95,0x9f,0x90,0x00,0x00,0xfd,0x2a,0x60,0x0f,0xd0,0xef,0x8b,0xf8,0x03,0xcf,
-0xe8,0x00,0x00,0x2a,0xe9,0x00,0x3f,0xfa,0x50,0x0d,0xe2,0x10,0x03,0xfd,0xef,0xd2,
-0x5f,0xe6,0x9f,0xb5,0xf7,0x00,0xee,0x3f,0x90,0x0e,0xe0,0xcf,0x9b,0xf9,0x01,0xae,
-0xe9,0x00,0x9f,0xff,0xff,0xe4,0x88,0x89,0xfb,0x00,0x00,0x7f,0x30,0x00,0x0e,0xc0,
-0x00,0x07,0xf5,0x00,0x00,0xee,0x00,0x00,0x6f,0x70,0x00,0x0d,0xf1,0x00,0x05,0xf9,
-0x00,0x00,0x44,0x00,0xf0,0x30,0xef,0x8c,0xf6,0x2f,0xa0,0x3f,0x90,0xee,0x38,0xf6,
-0x04,0xff,0xfc,0x01,0xed,0x69,0xf7,0x5f,0x70,0x0f,0xc2,0xfe,0x8b,0xf9,0x05,0xcf,
-0xe9,0x00,0x02,0xcf,0xd5,0x01,0xef,0x8d,0xf3,0x5f,0x80,0x3f,0x96,0xf6,0x01,0xfc,
-0x3f,0xc2,0x7f,0xc0,0x9f,0xfe,0xfa,0x00,0x23,0x7f,0x50,0x09,0xbf,0xc0,0x01,0xfd,
-0x80,0x00,0x1e,0xa1,0xd9,0x15,0x03,0x71,0x01,0xd9,0x1e,0xa0,0x2e,0x82,0xe8,0xa1,
-0x0a,0xf2,0x2e,0x85,0x0f,0x91,0xf6,0x6d,0x00,0x10,0x00,0x01,0x7a,0x02,0x9f,0xfb,
-0x8f,0xe9,0x40,0x9f,0xd7,0x10,0x04,0xbf,0xfa,0x00,0x02,0x9c,0x00,0x00,0x00,0x2f,
-0xff,0xff,0x81,0x88,0x88,0x84,0x18,0x88,0x88,0x42,0xff,0xff,0xf8,0x3b,0x40,0x00,
-0x03,0xff,0xd6,0x00,0x00,0x6b,0xff,0x30,0x04,0x9f,0xf4,0x2e,0xff,0x92,0x03,0xd6,
-0xe4,0x0a,0xf0,0x44,0x08,0xef,0xb2,0x7f,0xca,0xfc,0x69,0x10,0xee,0x00,0x06,0xf9,
-0x00,0x5f,0xb0,0x00,0xbf,0x00,0x00,0x12,0x00,0x00,0xbc,0x00,0x00,0xcd,0x00,0x00,
-0x04,0xbe,0xfd,0x70,0x00,0x00,0x8e,0x61,0x13,0xbc,0x00,0x05,0xe2,0x00,0x00,0x0b,
-0x70,0x0d,0x60,0x3c,0xea,0x14,0xd0,0x3f,0x11,0xf8,0x4f,0x21,0xf0,0x5e,0x07,0xe0,
-0x3f,0x00,0xf1,0x6c,0x0a,0xb0,0x5f,0x03,0xf0,0x6d,0x09,0xd1,0xbf,0x2a,0x90,0x2f,
-0x12,0xde,0x6b,0xfa,0x00,0x0d,0x90,0x57,0x00,0xf0,0x60,0x03,0xea,0x42,0x36,0x00,
-0x00,0x00,0x29,0xdf,0xea,0x00,0x00,0x00,0x0b,0xf7,0x00,0x00,0x01,0xff,0xd0,0x00,
-0x00,0x7f,0xcf,0x30,0x00,0x0d,0xe2,0xf9,0x00,0x03,0xf8,0x0c,0xf0,0x00,0x9f,0xa8,
-0xcf,0x50,0x0f,0xff,0xff,0xfb,0x06,0xf8,0x00,0x0c,0xf2,0xcf,0x30,0x00,0x7f,0x80,
-0x2f,0xff,0xfc,0x50,0x2f,0xe8,0x9f,0xf3,0x2f,0xb0,0x07,0xf7,0x2f,0xc1,0x2b,0xf3,
-0x2f,0xff,0xff,0xa0,0x2f,0xc4,0x4a,0xf6,0x2f,0xb0,0x04,0xfa,0x2f,0xe8,0x8d,0xf6,
-0x2f,0xff,0xfd,0x80,0x00,0x8e,0xfd,0x60,0x00,0xaf,0xc9,0xdf,0x70,0x2f,0xd0,0x00,
-0xfe,0x06,0xf8,0x00,0x01,0x20,0x7f,0x70,0x00,0x00,0x09,0x00,0xf1,0x14,0x10,0x2f,
-0xc0,0x00,0xfe,0x00,0xbf,0xc9,0xdf,0x70,0x00,0x9e,0xfd,0x60,0x00,0x2f,0xff,0xe9,
-0x10,0x2f,0xe8,0xbf,0xd0,0x2f,0xb0,0x08,0xf8,0x2f,0xb0,0x02,0xfc,0x2f,0xb0,0x00,
-0xfe,0x08,0x00,0x00,0x10,0x00,0x31,0xe8,0xbf,0xd1,0x20,0x00,0xe0,0xff,0xff,0xf0,
-0x2f,0xe8,0x88,0x80,0x2f,0xb0,0x00,0x00,0x2f,0xd8,0x88,0xd7,0x03,0x11,0x60,0x0c,
-0x00,0x00,0x04,0x00,0x00,0x18,0x00,0x00,0x20,0x00,0xf1,0x03,0xff,0xff,0xd2,0xfe,
-0x88,0x87,0x2f,0xb0,0x00,0x02,0xfe,0x88,0x83,0x2f,0xff,0xff,0x62,0xfb,0x21,0x00,
-0x22,0x02,0xfb,0x28,0x00,0xf0,0x19,0x00,0x7d,0xfd,0x80,0x00,0x9f,0xd9,0xcf,0xa0,
-0x1f,0xe0,0x00,0xab,0x05,0xf9,0x00,0x11,0x10,0x6f,0x80,0x8f,0xff,0x25,0xf9,0x02,
-0x4d,0xf2,0x1f,0xe0,0x00,0xcf,0x20,0x9f,0xd9,0xaf,0xf1,0x00,0x7d,0xfe,0xb3,0x2d,
-0x00,0x61,0x9f,0x52,0xfb,0x00,0x09,0xf5,0x09,0x00,0x86,0xfe,0x88,0x8c,0xf5,0x2f,
-0xff,0xff,0xff,0x12,0x00,0x04,0x09,0x00,0x46,0x50,0x0f,0xd0,0xfd,0x03,0x00,0x00,
-0x36,0x01,0x4a,0x70,0x00,0x07,0xf7,0x07,0x00,0xf0,0x0c,0x8c,0x20,0x8f,0x66,0xfd,
-0x9f,0xf2,0x08,0xef,0xc4,0x00,0x2f,0xb0,0x07,0xfc,0x02,0xfb,0x04,0xfe,0x10,0x2f,
-0xb2,0xef,0x30,0x02,0xfc,0xcf,0xfa,0x00,0xf6,0x06,0xf5,0x00,0x02,0xff,0xbf,0xe1,
-0x00,0x2f,0xc0,0x8f,0xa0,0x02,0xfb,0x00,0xdf,0x50,0x2f,0xb0,0x03,0xfe,0x10,0xb4,
-0x00,0x0b,0x07,0x00,0xf0,0x48,0xfe,0x88,0x86,0x2f,0xff,0xff,0xc0,0x2f,0xf7,0x00,
-0x02,0xff,0x82,0xff,0xd0,0x00,0x7f,0xf8,0x2f,0xef,0x30,0x0d,0xef,0x82,0xfa,0xf9,
-0x03,0xf9,0xf8,0x2f,0xaa,0xe0,0x9f,0x5f,0x82,0xfa,0x4f,0x5e,0xa5,0xf8,0x2f,0xb0,
-0xee,0xf4,0x5f,0x82,0xfb,0x08,0xfe,0x05,0xf8,0x2f,0xb0,0x2f,0x80,0x5f,0x80,0x2f,
-0xf1,0x00,0x9f,0x52,0xff,0xa0,0x09,0xf5,0x2f,0xff,0x40,0x9f,0x52,0xfc,0xed,0x09,
-0xf5,0x2f,0xb6,0xf8,0x9f,0x52,0xfb,0x0c,0xfb,0xf5,0x2f,0xb0,0x2f,0xdb,0x00,0x10,
-0x8f,0xd2,0x00,0xf0,0x0b,0xdf,0x50,0x00,0x7d,0xfd,0x70,0x00,0x9f,0xda,0xdf,0x80,
-0x2f,0xe0,0x00,0xef,0x15,0xf9,0x00,0x09,0xf5,0x7f,0x70,0x00,0x8f,0x66,0xf8,0xf2,
-0x00,0x81,0xd0,0x00,0xef,0x10,0x9f,0xd9,0xdf,0x90,0x24,0x00,0xf5,0x09,0x2f,0xff,
-0xfd,0x70,0x2f,0xe9,0x9d,0xf8,0x2f,0xb0,0x01,0xfd,0x2f,0xb0,0x05,0xfc,0x2f,0xff,
-0xff,0xf4,0x2f,0xe8,0x86,0x10,0x95,0x01,0x02,0x71,0x01,0x12,0x60,0x4d,0x00,0x5f,
-0xd0,0x01,0xef,0x16,0xf8,0x4d,0x00,0x01,0xe0,0x80,0x00,0x7d,0xff,0xf3,0x00,0x00,
-0x00,0x3e,0xf1,0x00,0x00,0x00,0x13,0x56,0x00,0xe0,0x60,0x02,0xfe,0x89,0xef,0x50,
-0x2f,0xb0,0x05,0xf9,0x02,0xfb,0x00,0x8f,0xd9,0x01,0xff,0x35,0xc1,0x02,0xfe,0x8d,
-0xf4,0x00,0x2f,0xb0,0x4f,0xc0,0x02,0xfb,0x00,0xcf,0x40,0x2f,0xb0,0x04,0xfc,0x00,
-0x03,0xbf,0xfc,0x40,0x1e,0xf9,0x9f,0xf2,0x3f,0xb0,0x05,0xc5,0x0e,0xf9,0x30,0x00,
-0x01,0xaf,0xfd,0x40,0x00,0x01,0x6e,0xf3,0x7e,0x60,0x06,0xf7,0x2f,0xf9,0x8e,0xf4,
-0x03,0xbe,0xfd,0x50,0xcf,0xff,0xff,0xfc,0x68,0x8f,0xf8,0x86,0x00,0x0f,0xf0,0x00,
-0x04,0x00,0x05,0x4f,0x4f,0xa0,0x01,0xfd,0x04,0x00,0x01,0xf0,0x49,0x2f,0xc0,0x03,
-0xfb,0x0c,0xfb,0x9e,0xf5,0x01,0x9e,0xfd,0x50,0xcf,0x40,0x00,0xdf,0x46,0xf9,0x00,
-0x2f,0xe0,0x1f,0xe0,0x06,0xf8,0x00,0xbf,0x30,0xbf,0x30,0x05,0xf8,0x0f,0xd0,0x00,
-0x0f,0xc5,0xf7,0x00,0x00,0xaf,0xbf,0x20,0x00,0x04,0xff,0xc0,0x00,0x00,0x0e,0xf6,
-0x00,0x00,0xaf,0x30,0x3f,0x90,0x0d,0xf1,0x7f,0x60,0x7f,0xd0,0x0f,0xd0,0x3f,0x90,
-0xbf,0xf1,0x3f,0x90,0x0f,0xc0,0xeb,0xf5,0x6f,0x50,0x0c,0xf3,0xf5,0xe8,0x9f,0x20,
-0x08,0xf9,0xf1,0xac,0xce,0x2d,0x00,0xf0,0x25,0x6f,0xfa,0x00,0x01,0xff,0x80,0x2f,
-0xf7,0x00,0x00,0xdf,0x40,0x0e,0xf3,0x00,0x7f,0xa0,0x06,0xfc,0x00,0xdf,0x30,0xef,
-0x20,0x04,0xfc,0x8f,0x80,0x00,0x0a,0xff,0xe0,0x00,0x00,0x3f,0xf8,0x00,0x00,0x0b,
-0xff,0xe1,0x00,0x05,0xfc,0x8f,0x90,0x00,0xef,0x30,0xef,0x30,0x8f,0x24,0x00,0xf0,
-0x06,0xbf,0x50,0x04,0xfc,0x03,0xfc,0x00,0xcf,0x30,0x0a,0xf3,0x3f,0xb0,0x00,0x2f,
-0xba,0xf2,0x00,0x00,0x9f,0xfa,0xb0,0x03,0x12,0x20,0xcf,0x00,0x31,0x00,0xff,0x00,
-0x09,0x00,0x00,0xe8,0x06,0xfd,0x1a,0xf6,0x48,0x88,0x9f,0xf2,0x00,0x00,0xaf,0x60,
-0x00,0x06,0xfa,0x00,0x00,0x2f,0xe1,0x00,0x00,0xcf,0x40,0x00,0x08,0xf8,0x00,0x00,
-0x4f,0xf8,0x88,0x84,0x8f,0xff,0xff,0xf8,0x01,0x10,0x3f,0xf8,0x3f,0xb2,0x3f,0x90,
-0x02,0x00,0x70,0xa1,0x3f,0xf8,0x14,0x42,0xcf,0x10,0x0f,0x05,0xf9,0x0d,0x1f,0xd0,
-0x00,0x0a,0xf3,0x00,0x04,0xf9,0x00,0x00,0xdf,0x00,0x00,0x7f,0x60,0x00,0x1f,0xc0,
-0x00,0x0b,0xf2,0x00,0x05,0xf8,0x11,0x1e,0xfd,0x4f,0xfa,0x02,0xf0,0x33,0xfd,0x2f,
-0xde,0xfd,0x44,0x30,0x00,0x74,0x00,0x04,0xfe,0x00,0x0a,0xbf,0x50,0x1f,0x49,0xc0,
-0x8e,0x03,0xf3,0x22,0x22,0x21,0xff,0xff,0xfc,0x55,0x55,0x53,0x4f,0x90,0x05,0xf4,
-0x05,0xdf,0xd4,0x03,0xfc,0x6e,0xf1,0x25,0x20,0xaf,0x30,0x7d,0xef,0xf4,0x6f,0x92,
-0xaf,0x47,0xfb,0x7e,0xf4,0x0a,0xfd,0xaf,0x60,0x4f,0x80,0x00,0x04,0xf8,0x00,0x00,
-0x07,0x00,0xf0,0x15,0xfb,0xde,0x90,0x4f,0xf9,0xcf,0x74,0xf9,0x01,0xfc,0x4f,0x80,
-0x0f,0xd4,0xf8,0x01,0xfc,0x4f,0xf8,0xcf,0x74,0xf9,0xde,0x90,0x03,0xcf,0xd5,0x01,
-0xfe,0x8e,0xf2,0x7f,0x60,0x3b,0x48,0xf4,0x88,0x00,0xf0,0x01,0x27,0x31,0xfe,0x8d,
-0xf3,0x03,0xcf,0xd5,0x00,0x00,0x00,0x3f,0x90,0x00,0x03,0xf9,0x07,0x00,0xf0,0x0a,
-0x5d,0xea,0xf9,0x2f,0xe9,0xdf,0x97,0xf6,0x04,0xf9,0x8f,0x40,0x3f,0x97,0xf5,0x03,
-0xf9,0x2f,0xd6,0xcf,0x90,0x5d,0xe9,0xf9,0x03,0xab,0x05,0xf3,0x17,0x8c,0xf3,0x6f,
-0x70,0x3f,0x88,0xff,0xff,0xfa,0x6f,0x93,0x33,0x21,0xef,0x99,0xe4,0x02,0xbf,0xe9,
-0x00,0x01,0xbf,0x90,0x9f,0xb5,0x0c,0xf1,0x0d,0xff,0xf6,0x4d,0xf6,0x20,0xcf,0x00,
-0x0c,0xf0,0x00,0x05,0x00,0xf0,0x1b,0x04,0xde,0x9f,0xb1,0xff,0x9c,0xfb,0x6f,0x70,
-0x2f,0xb8,0xf4,0x02,0xfb,0x6f,0x60,0x2f,0xb1,0xff,0x8c,0xfb,0x04,0xde,0xaf,0xb0,
-0x20,0x04,0xfa,0x0d,0xb7,0xdf,0x40,0x7d,0xfd,0x60,0x5f,0x80,0x00,0x05,0xf8,0x00,
-0x00,0x07,0x00,0xf4,0x01,0xfa,0xcf,0xa0,0x5f,0xe8,0xcf,0x65,0xf8,0x04,0xf9,0x5f,
-0x80,0x3f,0x95,0xf8,0x03,0x07,0x00,0x83,0x2e,0x82,0xd7,0x00,0x03,0xfa,0x3f,0xa3,
-0x03,0x00,0x89,0x02,0xf8,0x02,0xd7,0x00,0x00,0x03,0xfa,0x02,0x00,0x96,0xf9,0x5c,
-0xf7,0x9f,0xa0,0x4f,0x80,0x00,0x00,0x04,0x00,0xf5,0x0b,0xbf,0x60,0x4f,0x89,0xf9,
-0x00,0x4f,0xef,0xb0,0x00,0x4f,0xff,0xc0,0x00,0x4f,0xda,0xf6,0x00,0x4f,0x81,0xef,
-0x20,0x4f,0x80,0x5f,0xb0,0x4b,0x00,0x02,0x03,0x00,0xf7,0x0c,0x4f,0x9c,0xfb,0x4d,
-0xfa,0x04,0xff,0x8d,0xff,0x9c,0xf5,0x4f,0x80,0x5f,0x80,0x5f,0x84,0xf8,0x04,0xf8,
-0x04,0xf8,0x4f,0x80,0x4f,0x80,0x4f,0x0b,0x00,0xb6,0x80,0x5f,0x9c,0xfb,0x05,0xff,
-0x8c,0xf6,0x5f,0x80,0x4f,0x9c,0x00,0x00,0x07,0x00,0x50,0x90,0x03,0xcf,0xd6,0x01,
-0xa7,0x07,0xf0,0x10,0x60,0x1f,0xc8,0xf4,0x00,0xee,0x6f,0x60,0x1f,0xc1,0xfe,0x8c,
-0xf5,0x03,0xcf,0xd6,0x00,0x4f,0xbd,0xe9,0x04,0xfe,0x7b,0xf7,0x4f,0x80,0x1f,0xc4,
-0xf8,0x00,0xfd,0x07,0x00,0x30,0xff,0x8c,0xf7,0x15,0x00,0x02,0xa5,0x01,0x00,0x07,
-0x00,0xd0,0x05,0xde,0x8f,0x92,0xfe,0x8d,0xf9,0x7f,0x60,0x3f,0x98,0xf4,0x03,0x07,
-0x00,0x00,0x0e,0x00,0x34,0x05,0xde,0xaf,0x8c,0x01,0x01,0x07,0x00,0xc2,0x04,0xfa,
-0xd9,0x4f,0xfc,0x64,0xf9,0x00,0x4f,0x80,0x04,0xf8,0x05,0x00,0xf0,0x06,0x07,0xef,
-0xc4,0x04,0xfb,0x5e,0xf0,0x5f,0xa2,0x23,0x00,0x8f,0xfe,0x60,0x24,0x04,0xdf,0x16,
-0xfa,0x5d,0xf1,0x18,0x05,0xf1,0x08,0x07,0x70,0x00,0xfe,0x00,0xff,0xff,0x15,0xff,
-0x50,0x0f,0xe0,0x00,0xfe,0x00,0x0f,0xe0,0x00,0xdf,0x81,0x05,0xee,0x10,0xb5,0x00,
-0x26,0x04,0xf9,0x07,0x00,0x00,0x67,0x00,0xf2,0x5d,0x08,0xee,0x9f,0x90,0xcf,0x20,
-0x9f,0x46,0xf6,0x0d,0xf0,0x1f,0xb2,0xfa,0x00,0xcf,0x6f,0x40,0x06,0xfe,0xf0,0x00,
-0x1f,0xfa,0x00,0x00,0xcf,0x50,0x00,0xbf,0x00,0xf9,0x08,0xf3,0x7f,0x45,0xfd,0x0b,
-0xf0,0x3f,0x79,0xff,0x2e,0xb0,0x0e,0xae,0x8f,0x9f,0x70,0x0b,0xff,0x3a,0xff,0x30,
-0x07,0xfe,0x06,0xff,0x00,0x03,0xf9,0x01,0xfb,0x00,0x7f,0x70,0xcf,0x20,0xee,0x7f,
-0x90,0x05,0xff,0xe1,0x00,0x0f,0xfa,0x00,0x07,0xff,0xf2,0x01,0xee,0x5f,0xa0,0x9f,
-0x60,0xbf,0x30,0xdf,0x20,0x9f,0x57,0xf7,0x0e,0xf0,0x2f,0xb3,0xfa,0x00,0xdf,0x8f,
-0x50,0x07,0xff,0xf0,0x00,0x2f,0x55,0x00,0xf0,0x08,0x0b,0xf0,0x00,0x29,0xf9,0x00,
-0x03,0xfc,0x10,0x00,0x7f,0xff,0xff,0x13,0x77,0xbf,0xb0,0x00,0x1e,0xe1,0x00,0x0c,
-0xf4,0x4d,0x03,0xf6,0x1b,0x04,0xff,0x87,0x71,0x8f,0xff,0xff,0x20,0x00,0x16,0x00,
-0x1e,0xc0,0x07,0xf3,0x00,0x8f,0x10,0x09,0xf1,0x01,0xce,0x00,0xbf,0x40,0x03,0xec,
-0x00,0x09,0xf0,0x00,0x8f,0x10,0x07,0xf2,0x00,0x2f,0xa0,0x00,0x39,0x00,0xe3,0x01,
-0x00,0xf0,0x16,0x43,0x00,0x8f,0x40,0x0e,0xb0,0x0c,0xd0,0x0c,0xd0,0x09,0xf3,0x01,
-0xef,0x08,0xf6,0x0c,0xe0,0x0c,0xd0,0x0d,0xc0,0x6f,0x60,0x65,0x00,0x07,0xec,0x30,
-0xba,0x2f,0xbc,0xf9,0xf7,0x2a,0x10,0x9e,0x3c,0x05,0x10,0x30,0x9d,0x07,0xf0,0x15,
-0x4f,0x50,0x00,0x00,0x00,0x04,0xee,0x40,0x0c,0xff,0xff,0xfc,0x3e,0x40,0xe4,0x22,
-0x22,0x00,0x4e,0x3e,0x20,0x00,0x00,0x00,0x8d,0xe3,0x11,0x11,0x00,0x3e,0x4d,0xff,
-0xff,0xfb,0x3e,0x40,0x21,0x00,0x10,0x50,0x2c,0x00,0x10,0x60,0x74,0x08,0x24,0x40,
-0x00,0x3c,0x00,0x10,0x5f,0x0b,0x00,0x20,0x4e,0xe4,0x05,0x00,0x11,0x3c,0x3f,0x00,
-0xf0,0x08,0x02,0x22,0x24,0xed,0x80,0x00,0x00,0x00,0x2e,0x4e,0x30,0x01,0x11,0x13,
-0xe0,0x4e,0x3b,0xff,0xff,0xfd,0x00,0x5e,0xe4,0x2c,0x00,0x21,0x6f,0x40,0x4e,0x13,
-0x01,0x68,0x08,0x20,0x2b,0x20,0x24,0x00,0xf3,0x15,0xee,0x20,0x00,0x00,0x2e,0xa0,
-0xae,0x20,0x00,0x1d,0xa0,0x00,0xad,0x10,0x1d,0xd4,0x00,0x04,0xdd,0x13,0xcc,0xf2,
-0x02,0xfc,0xc3,0x00,0x0f,0x20,0x2f,0x00,0x00,0x00,0xf2,0x02,0xf0,0x00,0x0b,0x00,
-0xe0,0xf3,0x13,0xf0,0x00,0x00,0x0d,0xff,0xfd,0x00,0x00,0x00,0x0c,0xff,0xfc,0x11,
-0x00,0x3d,0x23,0xf0,0x00,0x27,0x00,0xf0,0x0a,0x33,0xf2,0x02,0xf3,0x30,0x3f,0xfd,
-0x10,0x1d,0xff,0x30,0x6e,0x30,0x00,0x3e,0x60,0x00,0x5e,0x40,0x4e,0x50,0x00,0x00,
-0x4e,0x8e,0x76,0x00,0x26,0x3c,0x30,0xd4,0x13,0x11,0xa0,0x91,0x00,0x00,0xd2,0x00,
-0x20,0x0e,0xfe,0x61,0x0b,0xf0,0x15,0xf4,0xf6,0x00,0x00,0x00,0xe9,0x09,0xe0,0x00,
-0x00,0x7f,0x10,0x1f,0x70,0x00,0x1f,0x80,0x00,0x8f,0x10,0x08,0xe0,0x00,0x00,0xe8,
-0x01,0xfc,0x88,0x88,0x8c,0xf1,0x9f,0xff,0xff,0xff,0xff,0xca,0x08,0xf0,0x2e,0x3b,
-0xc5,0x00,0x00,0x02,0x1e,0x86,0xf2,0x00,0x4d,0xf7,0xf0,0x0d,0x50,0x4f,0x60,0x7f,
-0xb9,0xf1,0x0e,0x60,0x09,0xff,0xe6,0x04,0xe0,0x00,0xcf,0xa1,0xd4,0x5c,0x00,0x0e,
-0x60,0x0c,0x63,0xe0,0x01,0x20,0x00,0xe4,0x0e,0x60,0x00,0x00,0x6e,0x00,0x4f,0x70,
-0x00,0x7f,0x50,0x00,0x4d,0xfe,0xfd,0x40,0x00,0x00,0x02,0x42,0x3b,0x01,0xf0,0x0b,
-0x11,0x10,0x00,0x00,0x00,0xbf,0xff,0x72,0x00,0x08,0xc1,0xdf,0xc3,0xf5,0x04,0x98,
-0x02,0xe2,0x07,0xb4,0x5d,0x00,0x01,0x00,0x1b,0x4d,0x5f,0x00,0xf0,0x3e,0xbe,0x68,
-0x00,0x00,0x00,0x09,0x6a,0xd0,0x00,0x00,0x00,0xb9,0x1a,0xa0,0x00,0x00,0x9d,0x00,
-0x88,0xc4,0x25,0xb9,0x60,0x00,0x69,0xe9,0xf6,0x70,0x00,0x00,0x05,0x25,0x00,0x00,
-0x00,0x28,0x01,0x32,0x00,0x00,0x01,0xee,0xef,0xef,0xd5,0x00,0x0d,0x90,0xbc,0x10,
-0x5f,0x70,0x0b,0xc1,0x0b,0xd0,0x03,0xf3,0x07,0xfd,0x1a,0xc0,0x00,0x99,0x0b,0x7a,
-0xfc,0x10,0x00,0x5c,0x0b,0x60,0x61,0x00,0x00,0x5c,0x08,0xe4,0x00,0xf3,0x04,0x89,
-0x01,0xf4,0x00,0x00,0x02,0xf3,0x00,0x6f,0x60,0x00,0x5e,0x70,0x00,0x04,0xdf,0xef,
-0xd5,0x00,0x8a,0x00,0xf0,0x20,0x0c,0xee,0xee,0xee,0x10,0x01,0xfa,0x66,0x6b,0xb0,
-0x00,0x6f,0x10,0x00,0xd5,0x00,0x0b,0xb0,0x00,0x5e,0x00,0x00,0x7e,0x00,0x6d,0x40,
-0x00,0x2d,0xf3,0x7b,0x10,0x00,0x0d,0x8b,0x3d,0xd0,0x00,0x03,0xf0,0xd4,0x8e,0x30,
-0x00,0x3f,0x15,0x10,0xf3,0xc8,0x0b,0x60,0x8d,0x00,0x00,0x02,0xdf,0xfd,0xba,0x01,
-0x20,0x33,0x00,0xa8,0x00,0xc0,0xaa,0x60,0x00,0x00,0xef,0xfa,0x10,0xcb,0xbb,0xba,
-0xaa,0xbc,0xd8,0x09,0xf0,0x03,0xc0,0x5f,0xff,0xd0,0xbc,0x00,0x22,0x21,0x0c,0xc0,
-0x13,0x33,0x20,0xcc,0x05,0xee,0xec,0x0c,0x64,0x02,0xd0,0xc9,0xcb,0xde,0xed,0xb9,
-0x00,0x0e,0xff,0xa0,0x00,0x00,0x56,0x63,0x38,0x00,0xf0,0x2a,0x57,0x62,0x04,0x00,
-0x06,0xef,0xff,0xf1,0xad,0x47,0xfb,0x30,0x24,0x0a,0x39,0xfa,0x00,0x00,0x00,0xa2,
-0x03,0xc5,0x00,0x00,0x0a,0x20,0x00,0xc8,0x00,0x00,0xa2,0x00,0x98,0x00,0x00,0x0a,
-0x22,0xc6,0x00,0x00,0x00,0xa7,0xcf,0xb0,0x00,0x00,0x0a,0xa0,0x5f,0xc5,0x23,0x50,
-0x20,0x00,0x4d,0xff,0xff,0x49,0x0a,0xf0,0x19,0x54,0x00,0x89,0x99,0x99,0x99,0x8c,
-0x2f,0xd1,0x11,0x2b,0xb0,0x65,0x06,0xef,0xfb,0x0b,0x93,0xdf,0xff,0xb0,0xfd,0x00,
-0x69,0xdb,0x02,0x20,0x00,0x0b,0xb0,0xeb,0x00,0x00,0xbb,0x0f,0xd0,0x00,0x0b,0xb0,
-0x76,0x09,0x00,0x81,0xe0,0x00,0x0b,0xea,0xff,0xaa,0xaa,0xe0,0xf2,0x01,0xf0,0x2b,
-0x18,0xde,0xd8,0x10,0x00,0x3e,0xad,0x6a,0xbe,0x30,0x1e,0x70,0xc5,0x70,0x7e,0x18,
-0xb0,0x0c,0x57,0x00,0xb8,0xc5,0x00,0xbd,0x60,0x05,0xce,0x30,0x24,0x06,0x90,0x2e,
-0xd4,0x4b,0xe3,0xe7,0xc7,0xd9,0xcb,0x8b,0x04,0xc6,0xd9,0x2f,0xa9,0x00,0x00,0xbf,
-0x20,0x5f,0x71,0x01,0x7e,0x50,0x00,0x3b,0xff,0xfb,0x37,0x02,0xf2,0x32,0x20,0x00,
-0x00,0x03,0xbd,0x80,0x00,0x00,0x03,0xe6,0x4b,0xb0,0x00,0x00,0xa7,0x00,0x0f,0x12,
-0x62,0x0a,0x60,0x00,0xe7,0xff,0xf4,0x6d,0x10,0x6d,0xbf,0xff,0xb0,0x9f,0xef,0x7a,
-0xff,0xfa,0x07,0xe9,0xcf,0xff,0xfe,0x23,0xe1,0x4f,0xff,0xff,0xe1,0x96,0x1e,0xff,
-0xff,0xff,0x8c,0x38,0xff,0xff,0xff,0xfb,0xcf,0xfd,0xdd,0xdd,0xdd,0x90,0x11,0x77,
-0x02,0x20,0x61,0x00,0x6b,0x03,0x11,0xd2,0x06,0x00,0xf1,0x05,0xe3,0x00,0x02,0x43,
-0x33,0x37,0xe3,0x00,0xaf,0xff,0xff,0xff,0xf4,0x03,0x66,0x66,0x66,0x66,0x60,0x09,
-0x67,0x02,0x90,0x08,0xf9,0x88,0x88,0x95,0x00,0x07,0xd1,0x00,0x99,0x02,0x01,0x06,
-0x00,0x25,0x05,0x90,0xb9,0x02,0x20,0x68,0x50,0xc1,0x01,0xf0,0x24,0x48,0xc9,0x10,
-0x00,0x00,0x8c,0xa4,0x4c,0x30,0x00,0x03,0x22,0x8b,0x20,0x00,0x00,0x5a,0xc5,0x10,
-0x00,0x06,0x86,0x97,0x30,0x00,0x1c,0xb0,0x10,0xab,0x00,0x0a,0xf2,0x7f,0x82,0xf9,
-0x00,0xaf,0x29,0xfa,0x1f,0x90,0x01,0xda,0x04,0x09,0xd1,0x00,0x01,0x8b,0x9a,0x81,
-0x76,0x02,0xfa,0x0a,0xfd,0x10,0x0d,0x63,0x36,0x9d,0x10,0xd3,0x00,0xb0,0xbd,0x0d,
-0x30,0x0a,0xc9,0xe3,0xd3,0x00,0x00,0x0d,0x3d,0x30,0x00,0x00,0xd3,0x09,0x00,0x60,
-0x40,0x00,0x00,0xd3,0xcf,0xff,0x74,0x04,0x01,0xbc,0x0b,0x10,0x53,0x06,0x00,0xf0,
-0x2b,0xa9,0x6a,0x90,0x00,0x00,0x06,0x70,0x00,0x8d,0xc7,0x00,0x0a,0x10,0x00,0x00,
-0x09,0x40,0x1d,0x10,0x00,0x47,0x33,0x90,0xa3,0x38,0xcf,0xda,0x33,0x80,0xc0,0x68,
-0x58,0x00,0x04,0xb0,0xb0,0x00,0x4f,0x90,0x00,0xa2,0xa1,0x00,0xdf,0xf3,0x00,0x83,
-0x2c,0x20,0x00,0x00,0x01,0xc0,0x02,0xbb,0xbb,0xbb,0xbb,0x3f,0x01,0x11,0x4d,0xf2,
-0x00,0xf0,0x1b,0xf0,0x87,0x00,0x00,0x00,0x7f,0x2f,0x40,0x19,0xd8,0x6e,0xae,0x30,
-0x0a,0xb3,0x7b,0x60,0xd4,0x01,0xf1,0x00,0x9b,0x4f,0x20,0x5b,0x00,0x01,0xbf,0x60,
-0x08,0x70,0x00,0x04,0xf0,0x00,0xa5,0x00,0x00,0x4f,0x00,0x0c,0x30,0x0b,0x00,0x10,
-0xe2,0x0b,0x00,0x02,0x01,0x00,0xd0,0x07,0xe8,0x01,0xe0,0xd2,0x1e,0x0d,0x20,0x8e,
-0x80,0x00,0x09,0xff,0xb4,0x03,0xf0,0x28,0xbf,0x50,0x00,0x00,0x5f,0x3d,0xb0,0x00,
-0x00,0xad,0x07,0xf1,0x00,0x01,0xf9,0x14,0xf6,0x00,0x06,0xff,0xff,0xfc,0x00,0x0c,
-0xe4,0x44,0xaf,0x20,0x2f,0xa0,0x00,0x3f,0x80,0x7f,0x50,0x00,0x0f,0xd0,0x2f,0xff,
-0xff,0xf9,0x02,0xfd,0x77,0x77,0x40,0x2f,0xc0,0x00,0x00,0x02,0xfc,0x22,0x10,0x06,
-0x0d,0xf0,0x04,0xfb,0x12,0xfd,0x55,0x5a,0xfa,0x2f,0xc0,0x00,0x1f,0xd2,0xfd,0x77,
-0x7c,0xf9,0x2f,0xff,0xff,0xe8,0x17,0x00,0xf0,0x16,0xc4,0x02,0xfd,0x66,0x8f,0xf1,
-0x2f,0xc0,0x00,0xaf,0x32,0xfc,0x11,0x3d,0xe0,0x2f,0xff,0xff,0xf5,0x02,0xfd,0x44,
-0x5a,0xf6,0x2f,0xc0,0x00,0x2f,0xb2,0xfd,0x66,0x6b,0xf8,0x2f,0xff,0xff,0xd8,0x29,
-0x00,0x50,0xf1,0x2f,0xd7,0x77,0x70,0x51,0x00,0x0f,0x04,0x00,0x05,0x20,0x00,0x3f,
-0xa6,0x04,0xd0,0x5f,0xb8,0xfd,0x00,0x00,0x8f,0x40,0xfd,0x00,0x00,0xbf,0x10,0xfd,
-0xfb,0x0d,0xf6,0x0b,0xfd,0x00,0x02,0xfa,0x00,0xfd,0x00,0x07,0xf6,0x00,0xfd,0x00,
+0x60,0x00,0x60,0x23,0x2b,0x10,0x0d,0x0e,0x09,0x80,0x07,0xf8,0x6e,0xd1,0x1b,0x14,
+0x1e,0xb0,0xeb,0xb7,0xeb,0xba,0xeb,0xbb,0xeb,0xbc,0xeb,0xc0,0xeb,0xc2,0xeb,0xc4,
+0xeb,0xc8,0xeb,0xcb,0xeb,0xd0,0xeb,0xd5,0xeb,0xd6,0xeb,0xd7,0xeb,0xed,0xeb,0xf2,
+0xeb,0xf7,0xeb,0xfa,0xeb,0xfb,0xeb,0xfc,0xeb,0x00,0xec,0x01,0xec,0x02,0xec,0x03,
+0xec,0x16,0xec,0x17,0xec,0x1d,0xec,0x1f,0xec,0x20,0xec,0x23,0xec,0x26,0xec,0x27,
+0xec,0x28,0xec,0x2a,0xec,0x42,0xec,0x44,0xec,0x73,0xec,0x74,0xec,0x76,0xec,0x78,
+0xec,0x8f,0xec,0x96,0xec,0x99,0xec,0xa2,0xec,0xcb,0xec,0xd3,0xec,0x0a,0xed,0x9a,
+0xed,0xef,0xed,0xf0,0xed,0xf1,0xed,0xf2,0xed,0xf3,0xed,0x36,0xee,0x42,0xee,0x9c,
+0xee,0xb3,0xee,0x09,0xf1,0x71,0xf3,0x51,0xf4,0x00,0x01,0x00,0x2f,0xfa,0x00,0x01,
+0x00,0x2d,0x13,0xfc,0x08,0x00,0x08,0x58,0x00,0xbf,0xfb,0xfa,0x00,0xfe,0xf7,0x00,
+0xf7,0x00,0x00,0x00,0x01,0x5c,0x00,0x2a,0x4f,0x02,0x04,0x00,0x02,0x40,0x00,0x29,
+0x2f,0xe3,0x00,0x01,0x00,0x3f,0x1f,0xe7,0x48,0x00,0x34,0x03,0x30,0x01,0xb2,0xf8,
+0x00,0xfe,0x00,0x00,0xf4,0xfe,0xf8,0xfc,0x00,0xf1,0x3b,0x01,0x7f,0xff,0x00,0x00,
+0xfe,0xff,0xfb,0xfd,0x3a,0x01,0x28,0x3f,0xfd,0x00,0xfe,0xd9,0x01,0x2e,0x1c,0xfd,
+0x0a,0x00,0x19,0xff,0x1f,0x00,0x1f,0xfe,0xee,0x00,0x21,0x00,0x35,0x00,0x7f,0xf7,
+0x00,0xfe,0x00,0xfe,0xfc,0xfe,0x44,0x01,0x34,0x15,0x02,0x90,0x00,0x11,0xfe,0x5e,
+0x00,0x2f,0xfe,0xfd,0x5a,0x00,0x21,0x75,0xe4,0x00,0x00,0x00,0xed,0x00,0xeb,0x4e,
+0x00,0x20,0xfd,0xfe,0x4a,0x00,0x01,0x55,0x00,0x0f,0x98,0x00,0x28,0x10,0xfd,0x08,
+0x00,0x1f,0xfd,0xe6,0x00,0x31,0x1f,0xfe,0xbd,0x02,0x37,0x19,0xef,0xdb,0x01,0x01,
+0x0c,0x00,0x10,0xfd,0x62,0x00,0x2f,0xfc,0xfa,0x5a,0x03,0x24,0xa6,0x02,0xfa,0x00,
+0x00,0xeb,0xfe,0xeb,0xf7,0x00,0xe4,0x1c,0x00,0x3f,0xff,0xf4,0xfb,0x9b,0x00,0x20,
+0x72,0xd7,0x00,0x00,0x00,0xee,0x00,0xed,0x05,0x03,0x51,0x00,0xfc,0x00,0xff,0xff,
+0x75,0x02,0x1f,0x01,0x02,0x04,0x2b,0x10,0xfd,0xce,0x01,0x1f,0xfc,0x3f,0x01,0x35,
+0x10,0xfb,0x8c,0x01,0x0f,0xdd,0x00,0x21,0x09,0x6f,0x05,0xc0,0xe6,0xe4,0x00,0x00,
+0xf4,0xfd,0xea,0xfe,0x02,0x00,0x02,0x02,0xde,0x00,0xdf,0xef,0xf7,0x00,0xf7,0xeb,
+0xf9,0xf8,0x00,0xf9,0xf8,0xfb,0xf8,0xfa,0x6a,0x02,0x1e,0x66,0xea,0xf0,0x00,0x00,
+0xf8,0xff,0x11,0x00,0x50,0xfb,0xfc,0x00,0x00,0xfb,0xd8,0x01,0x18,0xff,0x21,0x03,
+0x0f,0x4e,0x00,0x15,0x22,0xf1,0xfa,0xd2,0x05,0x03,0x7e,0x04,0x33,0x01,0xfd,0xfd,
+0x10,0x03,0x1f,0x00,0xcd,0x05,0x22,0x14,0xf0,0x70,0x02,0x15,0x01,0x70,0x02,0x02,
+0xa8,0x03,0x0f,0xc9,0x01,0x1f,0xf0,0x0a,0x02,0xfb,0xe9,0xf1,0x00,0x00,0xf1,0xfd,
+0xf6,0xfe,0x02,0xf6,0x02,0x02,0x01,0x02,0x00,0x02,0xfa,0xf9,0xfe,0xfc,0xf9,0xfc,
+0xfa,0x4f,0x04,0x2f,0xfe,0xfd,0xea,0x00,0x18,0x06,0xc1,0x01,0x2a,0x01,0xfd,0x67,
+0x03,0x02,0x9c,0x00,0x1f,0xfd,0xaa,0x03,0x29,0x1f,0xfe,0xee,0x03,0x4a,0x0f,0x5e,
+0x00,0x1e,0x0f,0xcc,0x00,0x0a,0x1f,0xff,0xe3,0x04,0x1d,0x1f,0xff,0x4a,0x07,0x3a,
+0x1f,0xff,0x6b,0x00,0x3a,0x1e,0x02,0xed,0x02,0x19,0x02,0x30,0x01,0x0f,0x0c,0x03,
+0x1a,0x1f,0xf8,0x3a,0x08,0x40,0x0f,0xd7,0x05,0x35,0x1f,0xf7,0x56,0x00,0x0b,0x2f,
+0xfe,0xfe,0xac,0x06,0x1e,0x1c,0xee,0x36,0x02,0x20,0xfe,0x02,0x06,0x04,0x10,0x05,
+0xa1,0x04,0x0f,0x01,0x00,0x33,0x1f,0xfd,0x48,0x07,0x26,0x1c,0xef,0xe1,0x00,0x2f,
+0xff,0x01,0x65,0x03,0x28,0x1f,0xf3,0xd4,0x01,0x4e,0x1f,0xfc,0x4e,0x00,0x3a,0x1f,
+0xfe,0x43,0x00,0x6f,0x0f,0x01,0x00,0x11,0xfa,0x01,0x08,0x00,0x00,0x03,0x00,0xfd,
+0xfd,0xfb,0xf6,0xf8,0xfb,0x00,0xf0,0xfb,0x00,0x03,0xef,0x01,0x04,0x52,0x05,0x1f,
+0x03,0x7c,0x03,0x15,0x30,0xfb,0xfd,0xfb,0x37,0x00,0x7f,0xfb,0xfb,0xfd,0xfb,0xf8,
+0xfb,0xfb,0x4d,0x02,0x2b,0xee,0xf6,0xfd,0xf8,0xfd,0xfb,0x00,0xfb,0x00,0xf8,0xf8,
+0xf8,0xfb,0xf8,0xf8,0xbe,0x07,0x00,0xe1,0x06,0x1f,0xf8,0x40,0x02,0x17,0x10,0xfb,
+0x40,0x06,0x15,0xfd,0x83,0x00,0x10,0xfd,0x5a,0x00,0x10,0xf5,0x67,0x00,0x30,0xf8,
+0xfb,0xf6,0x36,0x04,0x12,0xf8,0xc2,0x00,0x1f,0xf8,0x53,0x00,0x15,0x13,0x03,0x07,
+0x00,0x06,0x53,0x00,0x35,0x03,0x00,0x05,0x19,0x00,0x1f,0x03,0x88,0x01,0x1c,0x11,
+0x03,0x92,0x00,0x21,0x05,0x05,0x0a,0x00,0x1f,0x03,0x80,0x03,0x2c,0x11,0xfb,0xea,
+0x00,0x40,0xfb,0xf8,0xf8,0xfb,0x93,0x01,0x0f,0x24,0x02,0x30,0x00,0x88,0x00,0x40,
+0x05,0x05,0xfd,0x00,0x1c,0x16,0x0a,0x12,0x02,0x0f,0x28,0x0b,0x2c,0x1f,0x05,0xcd,
+0x02,0x3a,0x1e,0x03,0x6e,0x02,0x0f,0xa1,0x00,0x18,0x33,0xfb,0xfd,0xfd,0x2d,0x01,
+0x00,0x37,0x01,0x02,0x39,0x00,0x1f,0xfb,0xe4,0x00,0x26,0x70,0xee,0xf3,0xfd,0xfd,
+0xf3,0xfd,0xfd,0x56,0x00,0x22,0xfd,0xf8,0xd9,0x09,0x01,0x84,0x02,0x0a,0xc8,0x08,
+0x0f,0x5e,0x00,0x14,0x00,0x3f,0x00,0x10,0xfd,0x5c,0x03,0x00,0x09,0x00,0x33,0xf8,
+0xfb,0xfd,0xa8,0x03,0x19,0x03,0x0e,0x0c,0x1f,0xfd,0x0c,0x03,0x18,0x11,0x05,0x24,
+0x02,0x03,0x2f,0x07,0x11,0xfd,0xf0,0x00,0xb0,0xf6,0x00,0x00,0xf8,0xf3,0xf5,0x00,
+0xf3,0xfd,0xf8,0xf3,0x07,0x03,0x01,0x52,0x00,0x1f,0xfb,0x2b,0x0a,0x12,0x24,0xf5,
+0x00,0x67,0x02,0x10,0xf8,0x4d,0x00,0x00,0x79,0x02,0xc4,0xf3,0xf3,0xfd,0xf6,0xf8,
+0xf3,0xf6,0xf8,0xf3,0xf8,0xf8,0xf3,0xf1,0x00,0x2f,0xf8,0xf6,0xea,0x00,0x12,0x14,
+0xf5,0x8b,0x03,0x21,0xf8,0xfd,0xa5,0x03,0x0e,0xfd,0x09,0x0f,0xc1,0x06,0x1e,0x13,
+0xfb,0xe0,0x03,0x1f,0xfb,0x1f,0x02,0x29,0x0f,0x19,0x03,0x05,0x0b,0x11,0x03,0x0f,
+0xbe,0x02,0x36,0x0f,0xf4,0x03,0x1d,0x30,0xfd,0xf8,0xfb,0x1a,0x02,0x8f,0xfb,0xeb,
+0x00,0x00,0xf5,0xf0,0xf8,0xf8,0x31,0x0d,0x2d,0x14,0xfb,0x5c,0x05,0x25,0xfd,0xfb,
+0x07,0x03,0x1f,0x03,0x86,0x01,0x24,0x34,0xfb,0xfb,0xfb,0x69,0x02,0x34,0x00,0xf8,
+0xfd,0xcf,0x01,0x0e,0x4e,0x00,0x0f,0x3f,0x01,0x37,0x1f,0xfb,0x2e,0x0e,0x2c,0x01,
+0xb9,0x03,0x03,0x87,0x0e,0x00,0x0c,0x01,0x0f,0x5f,0x03,0x1a,0x0c,0x41,0x07,0x01,
+0x8b,0x0d,0x11,0xfd,0x89,0x02,0x11,0xfd,0xc0,0x03,0x0f,0x78,0x02,0x29,0x13,0xf8,
+0xdf,0x00,0x03,0x01,0x10,0x0f,0x38,0x01,0x37,0x01,0xdf,0x01,0x0f,0x54,0x00,0x28,
+0x05,0x4f,0x03,0x12,0xfd,0xf9,0x00,0x0e,0x3f,0x04,0x0f,0x95,0x00,0x1d,0x02,0x92,
+0x00,0x03,0xed,0x00,0x0f,0xd4,0x01,0x29,0x26,0xfd,0xfb,0x92,0x00,0x01,0xce,0x02,
+0x04,0x86,0x01,0x0f,0x3a,0x01,0x2e,0x16,0xfd,0x7c,0x05,0x1f,0xfd,0x38,0x01,0x28,
+0x1a,0xfd,0xc7,0x05,0x0f,0xea,0x00,0x28,0x18,0xfd,0x8c,0x01,0x00,0x4e,0x00,0x0f,
+0xe6,0x04,0x2d,0x17,0xfd,0x0c,0x03,0x10,0xfb,0x0c,0x03,0x0e,0x6b,0x06,0x0f,0x5a,
+0x03,0x23,0x01,0x13,0x03,0x0f,0x4e,0x00,0x27,0x0b,0xaa,0x0a,0x04,0xa0,0x00,0x0f,
+0xea,0x0c,0x2a,0x07,0xd1,0x01,0x1f,0x05,0x34,0x0d,0x2d,0x32,0xfb,0xfd,0x03,0x3b,
+0x01,0x8f,0x00,0xfd,0xfb,0x03,0x00,0xfd,0x03,0x00,0x38,0x01,0x27,0x02,0x3f,0x04,
+0x02,0x05,0x08,0x03,0xe4,0x01,0x0f,0x98,0x08,0x27,0x02,0x9d,0x00,0x05,0x52,0x03,
+0x01,0xf3,0x0b,0x1f,0xfb,0x22,0x02,0x26,0x0f,0x0e,0x0a,0x3b,0x0f,0xf8,0x0a,0x2d,
+0x0f,0x92,0x09,0x0c,0x0e,0x30,0x0f,0x0f,0x86,0x01,0x1d,0x07,0x0c,0x03,0x05,0xf2,
+0x03,0x0f,0xd4,0x01,0x27,0x02,0x12,0x06,0x05,0x64,0x07,0x04,0x74,0x0a,0x03,0x39,
+0x15,0x10,0x02,0x0e,0x01,0x3e,0x04,0x00,0x04,0x8a,0x02,0x30,0x06,0x07,0x08,0x06,
+0x1c,0xf1,0x05,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,
+0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,0xff,0x0c,0x1a,0x1b,0x1c,0x00,0x1d,
+0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,
+0x24,0x25,0x26,0x24,0x27,0x28,0x8e,0x00,0x04,0xff,0x2f,0x29,0x2a,0x2b,0x2c,0x2d,
+0x00,0x2e,0x2f,0x00,0x00,0x30,0x31,0x32,0x00,0x33,0x00,0x34,0x35,0x36,0x37,0x38,
+0x39,0x3a,0x00,0x00,0x3b,0x00,0x3c,0x3d,0x3e,0x00,0x3f,0x40,0x41,0x42,0x43,0x44,
+0x45,0x46,0x00,0x00,0x47,0x48,0x49,0x00,0x4a,0x00,0x4b,0x4c,0x4d,0x4e,0x4f,0x50,
+0x51,0x00,0x00,0x52,0x00,0x00,0x53,0x54,0x55,0x9a,0x01,0x2e,0x02,0xf2,0x00,0x20,
+0x03,0x02,0xed,0x00,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,
+0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xf1,0x08,0x0b,0x00,0x0d,0x0e,
+0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,
+0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,
+0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x73,0x00,0x02,0xf0,0x09,0x24,0x00,0x00,
+0x00,0x25,0x00,0x26,0x27,0x00,0x00,0x00,0x28,0x29,0x00,0x2a,0x2b,0x00,0x2c,0x2d,
+0x2e,0x2f,0x30,0x00,0x31,0x1c,0x00,0x33,0x32,0x00,0x33,0x01,0x01,0x64,0x3b,0x36,
+0x37,0x3c,0x3d,0x3e,0xff,0x00,0xdf,0x47,0x37,0x48,0x37,0x41,0x49,0x4a,0x4a,0x4b,
+0x4c,0x4d,0x00,0x4e,0xec,0x00,0x25,0x50,0x00,0x00,0x00,0x00,0x00,0xf2,0xff,0x13,
+0x2f,0xc1,0xfb,0x1f,0xb0,0xfa,0x0f,0xa0,0xf9,0x06,0x31,0xd9,0x1e,0xa0,0x9a,0x8b,
+0x9a,0x8b,0x98,0x89,0x43,0x44,0x00,0x1f,0x0b,0x70,0x00,0x5d,0x0f,0x30,0x2f,0xff,
+0xff,0xf7,0x01,0xb8,0x6d,0x10,0x00,0xe4,0x7a,0x00,0x8f,0xff,0xff,0xf0,0x15,0xf2,
+0xd6,0x20,0x06,0xc0,0xf2,0x00,0x08,0xa2,0xf0,0x00,0x00,0x09,0x70,0x00,0x05,0xdb,
+0x30,0x09,0xfe,0xff,0x40,0xfd,0x02,0xfb,0x0f,0xe1,0x04,0x40,0x7f,0xf8,0x10,0x00,
+0x4b,0xfe,0x31,0x41,0x04,0xfb,0x4f,0x90,0x1f,0xc0,0xdf,0xce,0xf7,0x01,0x8e,0xc5,
+0x00,0x00,0xb5,0x00,0x0a,0xfc,0x10,0x00,0x00,0x5e,0x2c,0x80,0xb3,0x00,0x5e,0x0b,
+0x96,0xc0,0x00,0x0c,0xfe,0x4e,0x20,0x00,0x00,0x10,0xb7,0x00,0x00,0x00,0x06,0xc5,
+0xdd,0x50,0x00,0x2e,0x2e,0x77,0xf0,0x00,0xa7,0x0e,0x65,0xf0,0x00,0x00,0x06,0xee,
+0x70,0x01,0xbf,0xd5,0x00,0x00,0x9f,0x9d,0xf0,0x00,0x0a,0xf0,0x9f,0x00,0x00,0x4f,
+0xdf,0x50,0x00,0x05,0xff,0x90,0x66,0x04,0xfb,0xbf,0x6e,0xb0,0x8f,0x50,0xdf,0xf6,
+0x04,0xfd,0x6a,0xff,0x30,0x06,0xdf,0xe9,0xfd,0x10,0x9b,0x9b,0x9a,0x44,0x00,0x01,
+0x00,0x02,0xe2,0x00,0xd9,0x00,0x7f,0x10,0x0d,0xb0,0x00,0xf7,0x00,0x2f,0x60,0x03,
+0xf5,0x00,0x2f,0x60,0x00,0xf8,0x00,0x0b,0xc0,0x00,0x4f,0x30,0x00,0xad,0x10,0x00,
+0x91,0x10,0x00,0x9a,0x00,0x2e,0x70,0x07,0xf1,0x02,0xf6,0x00,0xea,0x00,0xdc,0x00,
+0xcd,0x00,0xdc,0x00,0xf9,0x03,0xf4,0x0a,0xd0,0x5f,0x30,0x74,0x00,0x00,0x99,0x00,
+0x43,0x88,0x23,0x8e,0xfe,0xf8,0x02,0xff,0x20,0x0d,0x79,0xc0,0x05,0x01,0x50,0x00,
+0x4b,0x40,0x00,0x05,0xf6,0x00,0x00,0x5f,0x60,0x0a,0xff,0xff,0xfb,0x6a,0xcf,0xca,
+0x70,0x0e,0x00,0xf0,0x17,0x00,0x1f,0x72,0xf6,0x5f,0x26,0x70,0x02,0x22,0x04,0xff,
+0xf4,0x15,0x55,0x10,0x1d,0x91,0xea,0x00,0x00,0xd8,0x00,0x03,0xf2,0x00,0x08,0xd0,
+0x00,0x0d,0x70,0x00,0x3f,0x20,0x00,0x8c,0x00,0x00,0xe7,0x11,0x00,0xf8,0x22,0x09,
+0xc0,0x00,0x0e,0x70,0x00,0x02,0xbf,0xd6,0x00,0xdf,0x8c,0xf5,0x3f,0x90,0x1f,0xa5,
+0xf7,0x00,0xfd,0x6f,0x70,0x0f,0xd5,0xf7,0x00,0xfc,0x3f,0x90,0x2f,0xa0,0xdf,0x8c,
+0xf5,0x02,0xbf,0xd7,0x00,0x02,0x8d,0x1c,0xff,0xf1,0x95,0xcf,0x10,0x0c,0xf1,0x00,
+0x05,0x00,0xf0,0xb5,0x04,0xcf,0xe8,0x02,0xfe,0x8c,0xf6,0x7f,0x50,0x3f,0xa0,0x00,
+0x06,0xf7,0x00,0x03,0xfd,0x00,0x03,0xee,0x10,0x03,0xee,0x20,0x02,0xef,0x97,0x77,
+0x6f,0xff,0xff,0xf0,0x05,0xdf,0xd7,0x03,0xfe,0x8c,0xf6,0x38,0x30,0x3f,0x90,0x01,
+0x29,0xf6,0x00,0x8f,0xfa,0x00,0x02,0x59,0xf7,0x5a,0x30,0x1f,0xc4,0xfe,0x8b,0xf8,
+0x05,0xdf,0xe8,0x00,0x00,0x02,0xff,0x10,0x00,0x0b,0xff,0x10,0x00,0x5f,0xff,0x10,
+0x01,0xea,0xcf,0x10,0x09,0xe1,0xcf,0x10,0x3f,0x82,0xcf,0x30,0x9f,0xff,0xff,0xf1,
+0x35,0x55,0xdf,0x50,0x00,0x00,0xcf,0x10,0x0a,0xff,0xff,0x90,0xbf,0x88,0x85,0x0d,
+0xc0,0x00,0x00,0xff,0xff,0xb1,0x09,0x95,0x9f,0x90,0x00,0x00,0xfd,0x2a,0x60,0x0f,
+0xd0,0xef,0x8b,0xf8,0x03,0xcf,0xe8,0x00,0x00,0x2a,0xe9,0x00,0x3f,0xfa,0x50,0x0d,
+0xe2,0x10,0x03,0xfd,0xef,0xd2,0x5f,0xe6,0x9f,0xb5,0xf7,0x00,0xee,0x3f,0x90,0x0e,
+0xe0,0xcf,0x9b,0xf9,0x01,0xae,0xe9,0x00,0x9f,0xff,0xff,0xe4,0x88,0x89,0xfb,0x00,
+0x00,0x7f,0x30,0x00,0x0e,0xc0,0x00,0x07,0xf5,0x00,0x00,0xee,0x00,0x00,0x6f,0x70,
+0x00,0x0d,0xf1,0x00,0x05,0xf9,0x00,0x00,0x44,0x00,0xf0,0x3c,0xef,0x8c,0xf6,0x2f,
+0xa0,0x3f,0x90,0xee,0x38,0xf6,0x04,0xff,0xfc,0x01,0xed,0x69,0xf7,0x5f,0x70,0x0f,
+0xc2,0xfe,0x8b,0xf9,0x05,0xcf,0xe9,0x00,0x02,0xcf,0xd5,0x01,0xef,0x8d,0xf3,0x5f,
+0x80,0x3f,0x96,0xf6,0x01,0xfc,0x3f,0xc2,0x7f,0xc0,0x9f,0xfe,0xfa,0x00,0x23,0x7f,
+0x50,0x09,0xbf,0xc0,0x01,0xfd,0x80,0x00,0x1e,0xa1,0xd9,0x00,0x00,0x00,0x00,0x01,
+0xd9,0x1e,0xa0,0x2e,0x82,0xe8,0x00,0x01,0x00,0xf1,0x2f,0x85,0x0f,0x91,0xf6,0x6d,
+0x00,0x10,0x00,0x01,0x7a,0x02,0x9f,0xfb,0x8f,0xe9,0x40,0x9f,0xd7,0x10,0x04,0xbf,
+0xfa,0x00,0x02,0x9c,0x00,0x00,0x00,0x2f,0xff,0xff,0x81,0x88,0x88,0x84,0x18,0x88,
+0x88,0x42,0xff,0xff,0xf8,0x3b,0x40,0x00,0x03,0xff,0xd6,0x00,0x00,0x6b,0xff,0x30,
+0x04,0x9f,0xf4,0x2e,0xff,0x92,0x03,0xd6,0x00,0x01,0x00,0xf0,0x44,0x08,0xef,0xb2,
+0x7f,0xca,0xfc,0x69,0x10,0xee,0x00,0x06,0xf9,0x00,0x5f,0xb0,0x00,0xbf,0x00,0x00,
+0x12,0x00,0x00,0xbc,0x00,0x00,0xcd,0x00,0x00,0x04,0xbe,0xfd,0x70,0x00,0x00,0x8e,
+0x61,0x13,0xbc,0x00,0x05,0xe2,0x00,0x00,0x0b,0x70,0x0d,0x60,0x3c,0xea,0x14,0xd0,
+0x3f,0x11,0xf8,0x4f,0x21,0xf0,0x5e,0x07,0xe0,0x3f,0x00,0xf1,0x6c,0x0a,0xb0,0x5f,
+0x03,0xf0,0x6d,0x09,0xd1,0xbf,0x2a,0x90,0x2f,0x12,0xde,0x6b,0xfa,0x00,0x0d,0x90,
+0x57,0x00,0xf0,0x60,0x03,0xea,0x42,0x36,0x00,0x00,0x00,0x29,0xdf,0xea,0x00,0x00,
+0x00,0x0b,0xf7,0x00,0x00,0x01,0xff,0xd0,0x00,0x00,0x7f,0xcf,0x30,0x00,0x0d,0xe2,
+0xf9,0x00,0x03,0xf8,0x0c,0xf0,0x00,0x9f,0xa8,0xcf,0x50,0x0f,0xff,0xff,0xfb,0x06,
+0xf8,0x00,0x0c,0xf2,0xcf,0x30,0x00,0x7f,0x80,0x2f,0xff,0xfc,0x50,0x2f,0xe8,0x9f,
+0xf3,0x2f,0xb0,0x07,0xf7,0x2f,0xc1,0x2b,0xf3,0x2f,0xff,0xff,0xa0,0x2f,0xc4,0x4a,
+0xf6,0x2f,0xb0,0x04,0xfa,0x2f,0xe8,0x8d,0xf6,0x2f,0xff,0xfd,0x80,0x00,0x8e,0xfd,
+0x60,0x00,0xaf,0xc9,0xdf,0x70,0x2f,0xd0,0x00,0xfe,0x06,0xf8,0x00,0x01,0x20,0x7f,
+0x70,0x00,0x00,0x09,0x00,0xf1,0x14,0x10,0x2f,0xc0,0x00,0xfe,0x00,0xbf,0xc9,0xdf,
+0x70,0x00,0x9e,0xfd,0x60,0x00,0x2f,0xff,0xe9,0x10,0x2f,0xe8,0xbf,0xd0,0x2f,0xb0,
+0x08,0xf8,0x2f,0xb0,0x02,0xfc,0x2f,0xb0,0x00,0xfe,0x08,0x00,0x00,0x10,0x00,0x31,
+0xe8,0xbf,0xd1,0x20,0x00,0xe0,0xff,0xff,0xf0,0x2f,0xe8,0x88,0x80,0x2f,0xb0,0x00,
+0x00,0x2f,0xd8,0x88,0xd7,0x03,0x11,0x60,0x0c,0x00,0x00,0x04,0x00,0x00,0x18,0x00,
+0x00,0x20,0x00,0xf1,0x03,0xff,0xff,0xd2,0xfe,0x88,0x87,0x2f,0xb0,0x00,0x02,0xfe,
+0x88,0x83,0x2f,0xff,0xff,0x62,0xfb,0x21,0x00,0x22,0x02,0xfb,0x28,0x00,0xf0,0x19,
+0x00,0x7d,0xfd,0x80,0x00,0x9f,0xd9,0xcf,0xa0,0x1f,0xe0,0x00,0xab,0x05,0xf9,0x00,
+0x11,0x10,0x6f,0x80,0x8f,0xff,0x25,0xf9,0x02,0x4d,0xf2,0x1f,0xe0,0x00,0xcf,0x20,
+0x9f,0xd9,0xaf,0xf1,0x00,0x7d,0xfe,0xb3,0x2d,0x00,0x61,0x9f,0x52,0xfb,0x00,0x09,
+0xf5,0x09,0x00,0x86,0xfe,0x88,0x8c,0xf5,0x2f,0xff,0xff,0xff,0x12,0x00,0x04,0x09,
+0x00,0x46,0x50,0x0f,0xd0,0xfd,0x03,0x00,0x00,0x36,0x01,0x4a,0x70,0x00,0x07,0xf7,
+0x07,0x00,0xf0,0x0c,0x8c,0x20,0x8f,0x66,0xfd,0x9f,0xf2,0x08,0xef,0xc4,0x00,0x2f,
+0xb0,0x07,0xfc,0x02,0xfb,0x04,0xfe,0x10,0x2f,0xb2,0xef,0x30,0x02,0xfc,0xcf,0xfa,
+0x00,0xf6,0x06,0xf5,0x00,0x02,0xff,0xbf,0xe1,0x00,0x2f,0xc0,0x8f,0xa0,0x02,0xfb,
+0x00,0xdf,0x50,0x2f,0xb0,0x03,0xfe,0x10,0xb4,0x00,0x0b,0x07,0x00,0xf0,0x48,0xfe,
+0x88,0x86,0x2f,0xff,0xff,0xc0,0x2f,0xf7,0x00,0x02,0xff,0x82,0xff,0xd0,0x00,0x7f,
+0xf8,0x2f,0xef,0x30,0x0d,0xef,0x82,0xfa,0xf9,0x03,0xf9,0xf8,0x2f,0xaa,0xe0,0x9f,
+0x5f,0x82,0xfa,0x4f,0x5e,0xa5,0xf8,0x2f,0xb0,0xee,0xf4,0x5f,0x82,0xfb,0x08,0xfe,
+0x05,0xf8,0x2f,0xb0,0x2f,0x80,0x5f,0x80,0x2f,0xf1,0x00,0x9f,0x52,0xff,0xa0,0x09,
+0xf5,0x2f,0xff,0x40,0x9f,0x52,0xfc,0xed,0x09,0xf5,0x2f,0xb6,0xf8,0x9f,0x52,0xfb,
+0x0c,0xfb,0xf5,0x2f,0xb0,0x2f,0xdb,0x00,0x10,0x8f,0xd2,0x00,0xf0,0x0b,0xdf,0x50,
+0x00,0x7d,0xfd,0x70,0x00,0x9f,0xda,0xdf,0x80,0x2f,0xe0,0x00,0xef,0x15,0xf9,0x00,
+0x09,0xf5,0x7f,0x70,0x00,0x8f,0x66,0xf8,0xf2,0x00,0x81,0xd0,0x00,0xef,0x10,0x9f,
+0xd9,0xdf,0x90,0x24,0x00,0xf5,0x09,0x2f,0xff,0xfd,0x70,0x2f,0xe9,0x9d,0xf8,0x2f,
+0xb0,0x01,0xfd,0x2f,0xb0,0x05,0xfc,0x2f,0xff,0xff,0xf4,0x2f,0xe8,0x86,0x10,0x95,
+0x01,0x02,0x71,0x01,0x12,0x60,0x4d,0x00,0x5f,0xd0,0x01,0xef,0x16,0xf8,0x4d,0x00,
+0x01,0xe0,0x80,0x00,0x7d,0xff,0xf3,0x00,0x00,0x00,0x3e,0xf1,0x00,0x00,0x00,0x13,
+0x56,0x00,0xe0,0x60,0x02,0xfe,0x89,0xef,0x50,0x2f,0xb0,0x05,0xf9,0x02,0xfb,0x00,
+0x8f,0xd9,0x01,0xff,0x35,0xc1,0x02,0xfe,0x8d,0xf4,0x00,0x2f,0xb0,0x4f,0xc0,0x02,
+0xfb,0x00,0xcf,0x40,0x2f,0xb0,0x04,0xfc,0x00,0x03,0xbf,0xfc,0x40,0x1e,0xf9,0x9f,
+0xf2,0x3f,0xb0,0x05,0xc5,0x0e,0xf9,0x30,0x00,0x01,0xaf,0xfd,0x40,0x00,0x01,0x6e,
+0xf3,0x7e,0x60,0x06,0xf7,0x2f,0xf9,0x8e,0xf4,0x03,0xbe,0xfd,0x50,0xcf,0xff,0xff,
+0xfc,0x68,0x8f,0xf8,0x86,0x00,0x0f,0xf0,0x00,0x04,0x00,0x05,0x4f,0x4f,0xa0,0x01,
+0xfd,0x04,0x00,0x01,0xf0,0x49,0x2f,0xc0,0x03,0xfb,0x0c,0xfb,0x9e,0xf5,0x01,0x9e,
+0xfd,0x50,0xcf,0x40,0x00,0xdf,0x46,0xf9,0x00,0x2f,0xe0,0x1f,0xe0,0x06,0xf8,0x00,
+0xbf,0x30,0xbf,0x30,0x05,0xf8,0x0f,0xd0,0x00,0x0f,0xc5,0xf7,0x00,0x00,0xaf,0xbf,
+0x20,0x00,0x04,0xff,0xc0,0x00,0x00,0x0e,0xf6,0x00,0x00,0xaf,0x30,0x3f,0x90,0x0d,
+0xf1,0x7f,0x60,0x7f,0xd0,0x0f,0xd0,0x3f,0x90,0xbf,0xf1,0x3f,0x90,0x0f,0xc0,0xeb,
+0xf5,0x6f,0x50,0x0c,0xf3,0xf5,0xe8,0x9f,0x20,0x08,0xf9,0xf1,0xac,0xce,0x2d,0x00,
+0xf0,0x25,0x6f,0xfa,0x00,0x01,0xff,0x80,0x2f,0xf7,0x00,0x00,0xdf,0x40,0x0e,0xf3,
+0x00,0x7f,0xa0,0x06,0xfc,0x00,0xdf,0x30,0xef,0x20,0x04,0xfc,0x8f,0x80,0x00,0x0a,
+0xff,0xe0,0x00,0x00,0x3f,0xf8,0x00,0x00,0x0b,0xff,0xe1,0x00,0x05,0xfc,0x8f,0x90,
+0x00,0xef,0x30,0xef,0x30,0x8f,0x24,0x00,0xf0,0x06,0xbf,0x50,0x04,0xfc,0x03,0xfc,
+0x00,0xcf,0x30,0x0a,0xf3,0x3f,0xb0,0x00,0x2f,0xba,0xf2,0x00,0x00,0x9f,0xfa,0xb0,
+0x03,0x12,0x20,0xcf,0x00,0x31,0x00,0xff,0x00,0x09,0x00,0x00,0xe8,0x06,0xfd,0x1a,
+0xf6,0x48,0x88,0x9f,0xf2,0x00,0x00,0xaf,0x60,0x00,0x06,0xfa,0x00,0x00,0x2f,0xe1,
+0x00,0x00,0xcf,0x40,0x00,0x08,0xf8,0x00,0x00,0x4f,0xf8,0x88,0x84,0x8f,0xff,0xff,
+0xf8,0x01,0x10,0x3f,0xf8,0x3f,0xb2,0x3f,0x90,0x02,0x00,0x70,0xa1,0x3f,0xf8,0x14,
+0x42,0xcf,0x10,0x0f,0x05,0xf9,0x0d,0x1f,0xd0,0x00,0x0a,0xf3,0x00,0x04,0xf9,0x00,
+0x00,0xdf,0x00,0x00,0x7f,0x60,0x00,0x1f,0xc0,0x00,0x0b,0xf2,0x00,0x05,0xf8,0x11,
+0x1e,0xfd,0x4f,0xfa,0x02,0xf0,0x33,0xfd,0x2f,0xde,0xfd,0x44,0x30,0x00,0x74,0x00,
+0x04,0xfe,0x00,0x0a,0xbf,0x50,0x1f,0x49,0xc0,0x8e,0x03,0xf3,0x22,0x22,0x21,0xff,
+0xff,0xfc,0x55,0x55,0x53,0x4f,0x90,0x05,0xf4,0x05,0xdf,0xd4,0x03,0xfc,0x6e,0xf1,
+0x25,0x20,0xaf,0x30,0x7d,0xef,0xf4,0x6f,0x92,0xaf,0x47,0xfb,0x7e,0xf4,0x0a,0xfd,
+0xaf,0x60,0x4f,0x80,0x00,0x04,0xf8,0x00,0x00,0x07,0x00,0xf0,0x15,0xfb,0xde,0x90,
+0x4f,0xf9,0xcf,0x74,0xf9,0x01,0xfc,0x4f,0x80,0x0f,0xd4,0xf8,0x01,0xfc,0x4f,0xf8,
+0xcf,0x74,0xf9,0xde,0x90,0x03,0xcf,0xd5,0x01,0xfe,0x8e,0xf2,0x7f,0x60,0x3b,0x48,
+0xf4,0x88,0x00,0xf0,0x01,0x27,0x31,0xfe,0x8d,0xf3,0x03,0xcf,0xd5,0x00,0x00,0x00,
+0x3f,0x90,0x00,0x03,0xf9,0x07,0x00,0xf0,0x0a,0x5d,0xea,0xf9,0x2f,0xe9,0xdf,0x97,
+0xf6,0x04,0xf9,0x8f,0x40,0x3f,0x97,0xf5,0x03,0xf9,0x2f,0xd6,0xcf,0x90,0x5d,0xe9,
+0xf9,0x03,0xab,0x05,0xf3,0x17,0x8c,0xf3,0x6f,0x70,0x3f,0x88,0xff,0xff,0xfa,0x6f,
+0x93,0x33,0x21,0xef,0x99,0xe4,0x02,0xbf,0xe9,0x00,0x01,0xbf,0x90,0x9f,0xb5,0x0c,
+0xf1,0x0d,0xff,0xf6,0x4d,0xf6,0x20,0xcf,0x00,0x0c,0xf0,0x00,0x05,0x00,0xf0,0x1b,
+0x04,0xde,0x9f,0xb1,0xff,0x9c,0xfb,0x6f,0x70,0x2f,0xb8,0xf4,0x02,0xfb,0x6f,0x60,
+0x2f,0xb1,0xff,0x8c,0xfb,0x04,0xde,0xaf,0xb0,0x20,0x04,0xfa,0x0d,0xb7,0xdf,0x40,
+0x7d,0xfd,0x60,0x5f,0x80,0x00,0x05,0xf8,0x00,0x00,0x07,0x00,0xf4,0x01,0xfa,0xcf,
+0xa0,0x5f,0xe8,0xcf,0x65,0xf8,0x04,0xf9,0x5f,0x80,0x3f,0x95,0xf8,0x03,0x07,0x00,
+0x83,0x2e,0x82,0xd7,0x00,0x03,0xfa,0x3f,0xa3,0x03,0x00,0x89,0x02,0xf8,0x02,0xd7,
+0x00,0x00,0x03,0xfa,0x02,0x00,0x96,0xf9,0x5c,0xf7,0x9f,0xa0,0x4f,0x80,0x00,0x00,
+0x04,0x00,0xf5,0x0b,0xbf,0x60,0x4f,0x89,0xf9,0x00,0x4f,0xef,0xb0,0x00,0x4f,0xff,
+0xc0,0x00,0x4f,0xda,0xf6,0x00,0x4f,0x81,0xef,0x20,0x4f,0x80,0x5f,0xb0,0x4b,0x00,
+0x02,0x03,0x00,0xf7,0x0c,0x4f,0x9c,0xfb,0x4d,0xfa,0x04,0xff,0x8d,0xff,0x9c,0xf5,
+0x4f,0x80,0x5f,0x80,0x5f,0x84,0xf8,0x04,0xf8,0x04,0xf8,0x4f,0x80,0x4f,0x80,0x4f,
+0x0b,0x00,0xb6,0x80,0x5f,0x9c,0xfb,0x05,0xff,0x8c,0xf6,0x5f,0x80,0x4f,0x9c,0x00,
+0x00,0x07,0x00,0x50,0x90,0x03,0xcf,0xd6,0x01,0xa7,0x07,0xf0,0x10,0x60,0x1f,0xc8,
+0xf4,0x00,0xee,0x6f,0x60,0x1f,0xc1,0xfe,0x8c,0xf5,0x03,0xcf,0xd6,0x00,0x4f,0xbd,
+0xe9,0x04,0xfe,0x7b,0xf7,0x4f,0x80,0x1f,0xc4,0xf8,0x00,0xfd,0x07,0x00,0x30,0xff,
+0x8c,0xf7,0x15,0x00,0x02,0xa5,0x01,0x00,0x07,0x00,0xd0,0x05,0xde,0x8f,0x92,0xfe,
+0x8d,0xf9,0x7f,0x60,0x3f,0x98,0xf4,0x03,0x07,0x00,0x00,0x0e,0x00,0x34,0x05,0xde,
+0xaf,0x8c,0x01,0x01,0x07,0x00,0xc2,0x04,0xfa,0xd9,0x4f,0xfc,0x64,0xf9,0x00,0x4f,
+0x80,0x04,0xf8,0x05,0x00,0xf0,0x06,0x07,0xef,0xc4,0x04,0xfb,0x5e,0xf0,0x5f,0xa2,
+0x23,0x00,0x8f,0xfe,0x60,0x24,0x04,0xdf,0x16,0xfa,0x5d,0xf1,0x18,0x05,0xf1,0x08,
+0x07,0x70,0x00,0xfe,0x00,0xff,0xff,0x15,0xff,0x50,0x0f,0xe0,0x00,0xfe,0x00,0x0f,
+0xe0,0x00,0xdf,0x81,0x05,0xee,0x10,0xb5,0x00,0x26,0x04,0xf9,0x07,0x00,0x00,0x67,
+0x00,0xf2,0x5d,0x08,0xee,0x9f,0x90,0xcf,0x20,0x9f,0x46,0xf6,0x0d,0xf0,0x1f,0xb2,
+0xfa,0x00,0xcf,0x6f,0x40,0x06,0xfe,0xf0,0x00,0x1f,0xfa,0x00,0x00,0xcf,0x50,0x00,
+0xbf,0x00,0xf9,0x08,0xf3,0x7f,0x45,0xfd,0x0b,0xf0,0x3f,0x79,0xff,0x2e,0xb0,0x0e,
+0xae,0x8f,0x9f,0x70,0x0b,0xff,0x3a,0xff,0x30,0x07,0xfe,0x06,0xff,0x00,0x03,0xf9,
+0x01,0xfb,0x00,0x7f,0x70,0xcf,0x20,0xee,0x7f,0x90,0x05,0xff,0xe1,0x00,0x0f,0xfa,
+0x00,0x07,0xff,0xf2,0x01,0xee,0x5f,0xa0,0x9f,0x60,0xbf,0x30,0xdf,0x20,0x9f,0x57,
+0xf7,0x0e,0xf0,0x2f,0xb3,0xfa,0x00,0xdf,0x8f,0x50,0x07,0xff,0xf0,0x00,0x2f,0x55,
+0x00,0xf0,0x08,0x0b,0xf0,0x00,0x29,0xf9,0x00,0x03,0xfc,0x10,0x00,0x7f,0xff,0xff,
+0x13,0x77,0xbf,0xb0,0x00,0x1e,0xe1,0x00,0x0c,0xf4,0x4d,0x03,0xf6,0x1b,0x04,0xff,
+0x87,0x71,0x8f,0xff,0xff,0x20,0x00,0x16,0x00,0x1e,0xc0,0x07,0xf3,0x00,0x8f,0x10,
+0x09,0xf1,0x01,0xce,0x00,0xbf,0x40,0x03,0xec,0x00,0x09,0xf0,0x00,0x8f,0x10,0x07,
+0xf2,0x00,0x2f,0xa0,0x00,0x39,0x00,0xe3,0x01,0x00,0xf0,0x16,0x43,0x00,0x8f,0x40,
+0x0e,0xb0,0x0c,0xd0,0x0c,0xd0,0x09,0xf3,0x01,0xef,0x08,0xf6,0x0c,0xe0,0x0c,0xd0,
+0x0d,0xc0,0x6f,0x60,0x65,0x00,0x07,0xec,0x30,0xba,0x2f,0xbc,0xf9,0xf7,0x2a,0x10,
+0x9e,0x3c,0x05,0x10,0x30,0x9d,0x07,0xf0,0x15,0x4f,0x50,0x00,0x00,0x00,0x04,0xee,
+0x40,0x0c,0xff,0xff,0xfc,0x3e,0x40,0xe4,0x22,0x22,0x00,0x4e,0x3e,0x20,0x00,0x00,
+0x00,0x8d,0xe3,0x11,0x11,0x00,0x3e,0x4d,0xff,0xff,0xfb,0x3e,0x40,0x21,0x00,0x10,
+0x50,0x2c,0x00,0x10,0x60,0x74,0x08,0x24,0x40,0x00,0x3c,0x00,0x10,0x5f,0x0b,0x00,
+0x20,0x4e,0xe4,0x05,0x00,0x11,0x3c,0x3f,0x00,0xf0,0x08,0x02,0x22,0x24,0xed,0x80,
+0x00,0x00,0x00,0x2e,0x4e,0x30,0x01,0x11,0x13,0xe0,0x4e,0x3b,0xff,0xff,0xfd,0x00,
+0x5e,0xe4,0x2c,0x00,0x11,0x6f,0x37,0x00,0x11,0x40,0x68,0x08,0x20,0x2b,0x20,0x24,
+0x00,0xf3,0x15,0xee,0x20,0x00,0x00,0x2e,0xa0,0xae,0x20,0x00,0x1d,0xa0,0x00,0xad,
+0x10,0x1d,0xd4,0x00,0x04,0xdd,0x13,0xcc,0xf2,0x02,0xfc,0xc3,0x00,0x0f,0x20,0x2f,
+0x00,0x00,0x00,0xf2,0x02,0xf0,0x00,0x0b,0x00,0xe0,0xf3,0x13,0xf0,0x00,0x00,0x0d,
+0xff,0xfd,0x00,0x00,0x00,0x0c,0xff,0xfc,0x11,0x00,0x3d,0x23,0xf0,0x00,0x27,0x00,
+0xf0,0x0a,0x33,0xf2,0x02,0xf3,0x30,0x3f,0xfd,0x10,0x1d,0xff,0x30,0x6e,0x30,0x00,
+0x3e,0x60,0x00,0x5e,0x40,0x4e,0x50,0x00,0x00,0x4e,0x8e,0x76,0x00,0x35,0x3c,0x30,
+0x00,0x01,0x00,0x11,0xa0,0x91,0x00,0x00,0xd2,0x00,0x20,0x0e,0xfe,0x61,0x0b,0xf0,
+0x15,0xf4,0xf6,0x00,0x00,0x00,0xe9,0x09,0xe0,0x00,0x00,0x7f,0x10,0x1f,0x70,0x00,
+0x1f,0x80,0x00,0x8f,0x10,0x08,0xe0,0x00,0x00,0xe8,0x01,0xfc,0x88,0x88,0x8c,0xf1,
+0x9f,0xff,0xff,0xff,0xff,0xca,0x08,0xf0,0x2e,0x3b,0xc5,0x00,0x00,0x02,0x1e,0x86,
+0xf2,0x00,0x4d,0xf7,0xf0,0x0d,0x50,0x4f,0x60,0x7f,0xb9,0xf1,0x0e,0x60,0x09,0xff,
+0xe6,0x04,0xe0,0x00,0xcf,0xa1,0xd4,0x5c,0x00,0x0e,0x60,0x0c,0x63,0xe0,0x01,0x20,
+0x00,0xe4,0x0e,0x60,0x00,0x00,0x6e,0x00,0x4f,0x70,0x00,0x7f,0x50,0x00,0x4d,0xfe,
+0xfd,0x40,0x00,0x00,0x02,0x42,0x3b,0x01,0xf0,0x0b,0x11,0x10,0x00,0x00,0x00,0xbf,
+0xff,0x72,0x00,0x08,0xc1,0xdf,0xc3,0xf5,0x04,0x98,0x02,0xe2,0x07,0xb4,0x5d,0x00,
+0x01,0x00,0x1b,0x4d,0x5f,0x00,0xf0,0x3e,0xbe,0x68,0x00,0x00,0x00,0x09,0x6a,0xd0,
+0x00,0x00,0x00,0xb9,0x1a,0xa0,0x00,0x00,0x9d,0x00,0x88,0xc4,0x25,0xb9,0x60,0x00,
+0x69,0xe9,0xf6,0x70,0x00,0x00,0x05,0x25,0x00,0x00,0x00,0x28,0x01,0x32,0x00,0x00,
+0x01,0xee,0xef,0xef,0xd5,0x00,0x0d,0x90,0xbc,0x10,0x5f,0x70,0x0b,0xc1,0x0b,0xd0,
+0x03,0xf3,0x07,0xfd,0x1a,0xc0,0x00,0x99,0x0b,0x7a,0xfc,0x10,0x00,0x5c,0x0b,0x60,
+0x61,0x00,0x00,0x5c,0x08,0xe4,0x00,0xf3,0x04,0x89,0x01,0xf4,0x00,0x00,0x02,0xf3,
+0x00,0x6f,0x60,0x00,0x5e,0x70,0x00,0x04,0xdf,0xef,0xd5,0x00,0x8a,0x00,0xf0,0x20,
+0x0c,0xee,0xee,0xee,0x10,0x01,0xfa,0x66,0x6b,0xb0,0x00,0x6f,0x10,0x00,0xd5,0x00,
+0x0b,0xb0,0x00,0x5e,0x00,0x00,0x7e,0x00,0x6d,0x40,0x00,0x2d,0xf3,0x7b,0x10,0x00,
+0x0d,0x8b,0x3d,0xd0,0x00,0x03,0xf0,0xd4,0x8e,0x30,0x00,0x3f,0x15,0x10,0xf3,0xc8,
+0x0b,0x60,0x8d,0x00,0x00,0x02,0xdf,0xfd,0xba,0x01,0x20,0x33,0x00,0xa8,0x00,0xc0,
+0xaa,0x60,0x00,0x00,0xef,0xfa,0x10,0xcb,0xbb,0xba,0xaa,0xbc,0xd8,0x09,0xf0,0x03,
+0xc0,0x5f,0xff,0xd0,0xbc,0x00,0x22,0x21,0x0c,0xc0,0x13,0x33,0x20,0xcc,0x05,0xee,
+0xec,0x0c,0x64,0x02,0xd0,0xc9,0xcb,0xde,0xed,0xb9,0x00,0x0e,0xff,0xa0,0x00,0x00,
+0x56,0x63,0x38,0x00,0xf0,0x2a,0x57,0x62,0x04,0x00,0x06,0xef,0xff,0xf1,0xad,0x47,
+0xfb,0x30,0x24,0x0a,0x39,0xfa,0x00,0x00,0x00,0xa2,0x03,0xc5,0x00,0x00,0x0a,0x20,
+0x00,0xc8,0x00,0x00,0xa2,0x00,0x98,0x00,0x00,0x0a,0x22,0xc6,0x00,0x00,0x00,0xa7,
+0xcf,0xb0,0x00,0x00,0x0a,0xa0,0x5f,0xc5,0x23,0x50,0x20,0x00,0x4d,0xff,0xff,0x49,
+0x0a,0xf0,0x19,0x54,0x00,0x89,0x99,0x99,0x99,0x8c,0x2f,0xd1,0x11,0x2b,0xb0,0x65,
+0x06,0xef,0xfb,0x0b,0x93,0xdf,0xff,0xb0,0xfd,0x00,0x69,0xdb,0x02,0x20,0x00,0x0b,
+0xb0,0xeb,0x00,0x00,0xbb,0x0f,0xd0,0x00,0x0b,0xb0,0x76,0x09,0x00,0x81,0xe0,0x00,
+0x0b,0xea,0xff,0xaa,0xaa,0xe0,0xf2,0x01,0xf0,0x2b,0x18,0xde,0xd8,0x10,0x00,0x3e,
+0xad,0x6a,0xbe,0x30,0x1e,0x70,0xc5,0x70,0x7e,0x18,0xb0,0x0c,0x57,0x00,0xb8,0xc5,
+0x00,0xbd,0x60,0x05,0xce,0x30,0x24,0x06,0x90,0x2e,0xd4,0x4b,0xe3,0xe7,0xc7,0xd9,
+0xcb,0x8b,0x04,0xc6,0xd9,0x2f,0xa9,0x00,0x00,0xbf,0x20,0x5f,0x71,0x01,0x7e,0x50,
+0x00,0x3b,0xff,0xfb,0x37,0x02,0xf2,0x32,0x20,0x00,0x00,0x03,0xbd,0x80,0x00,0x00,
+0x03,0xe6,0x4b,0xb0,0x00,0x00,0xa7,0x00,0x0f,0x12,0x62,0x0a,0x60,0x00,0xe7,0xff,
+0xf4,0x6d,0x10,0x6d,0xbf,0xff,0xb0,0x9f,0xef,0x7a,0xff,0xfa,0x07,0xe9,0xcf,0xff,
+0xfe,0x23,0xe1,0x4f,0xff,0xff,0xe1,0x96,0x1e,0xff,0xff,0xff,0x8c,0x38,0xff,0xff,
+0xff,0xfb,0xcf,0xfd,0xdd,0xdd,0xdd,0x90,0x11,0x77,0x02,0x20,0x61,0x00,0x6b,0x03,
+0x11,0xd2,0x06,0x00,0xf1,0x05,0xe3,0x00,0x02,0x43,0x33,0x37,0xe3,0x00,0xaf,0xff,
+0xff,0xff,0xf4,0x03,0x66,0x66,0x66,0x66,0x60,0x09,0x67,0x02,0x90,0x08,0xf9,0x88,
+0x88,0x95,0x00,0x07,0xd1,0x00,0x99,0x02,0x01,0x06,0x00,0x25,0x05,0x90,0xb9,0x02,
+0x20,0x68,0x50,0xc1,0x01,0xf0,0x24,0x48,0xc9,0x10,0x00,0x00,0x8c,0xa4,0x4c,0x30,
+0x00,0x03,0x22,0x8b,0x20,0x00,0x00,0x5a,0xc5,0x10,0x00,0x06,0x86,0x97,0x30,0x00,
+0x1c,0xb0,0x10,0xab,0x00,0x0a,0xf2,0x7f,0x82,0xf9,0x00,0xaf,0x29,0xfa,0x1f,0x90,
+0x01,0xda,0x04,0x09,0xd1,0x00,0x01,0x8b,0x9a,0x81,0x76,0x02,0xfa,0x0a,0xfd,0x10,
+0x0d,0x63,0x36,0x9d,0x10,0xd3,0x00,0xb0,0xbd,0x0d,0x30,0x0a,0xc9,0xe3,0xd3,0x00,
+0x00,0x0d,0x3d,0x30,0x00,0x00,0xd3,0x09,0x00,0x60,0x40,0x00,0x00,0xd3,0xcf,0xff,
+0x74,0x04,0x01,0xbc,0x0b,0x10,0x53,0x06,0x00,0xf0,0x2b,0xa9,0x6a,0x90,0x00,0x00,
+0x06,0x70,0x00,0x8d,0xc7,0x00,0x0a,0x10,0x00,0x00,0x09,0x40,0x1d,0x10,0x00,0x47,
+0x33,0x90,0xa3,0x38,0xcf,0xda,0x33,0x80,0xc0,0x68,0x58,0x00,0x04,0xb0,0xb0,0x00,
+0x4f,0x90,0x00,0xa2,0xa1,0x00,0xdf,0xf3,0x00,0x83,0x2c,0x20,0x00,0x00,0x01,0xc0,
+0x02,0xbb,0xbb,0xbb,0xbb,0x3f,0x01,0x11,0x4d,0xf2,0x00,0xf0,0x1b,0xf0,0x87,0x00,
+0x00,0x00,0x7f,0x2f,0x40,0x19,0xd8,0x6e,0xae,0x30,0x0a,0xb3,0x7b,0x60,0xd4,0x01,
+0xf1,0x00,0x9b,0x4f,0x20,0x5b,0x00,0x01,0xbf,0x60,0x08,0x70,0x00,0x04,0xf0,0x00,
+0xa5,0x00,0x00,0x4f,0x00,0x0c,0x30,0x0b,0x00,0x10,0xe2,0x0b,0x00,0x02,0x01,0x00,
+0xd0,0x07,0xe8,0x01,0xe0,0xd2,0x1e,0x0d,0x20,0x8e,0x80,0x00,0x09,0xff,0xb4,0x03,
+0xf0,0x28,0xbf,0x50,0x00,0x00,0x5f,0x3d,0xb0,0x00,0x00,0xad,0x07,0xf1,0x00,0x01,
+0xf9,0x14,0xf6,0x00,0x06,0xff,0xff,0xfc,0x00,0x0c,0xe4,0x44,0xaf,0x20,0x2f,0xa0,
+0x00,0x3f,0x80,0x7f,0x50,0x00,0x0f,0xd0,0x2f,0xff,0xff,0xf9,0x02,0xfd,0x77,0x77,
+0x40,0x2f,0xc0,0x00,0x00,0x02,0xfc,0x22,0x10,0x06,0x0d,0xf0,0x05,0xfb,0x12,0xfd,
+0x55,0x5a,0xfa,0x2f,0xc0,0x00,0x1f,0xd2,0xfd,0x77,0x7c,0xf9,0x2f,0xff,0xff,0xe8,
+0x00,0xff,0x26,0x2f,0xff,0xff,0xc4,0x02,0xfd,0x66,0x8f,0xf1,0x2f,0xc0,0x00,0xaf,
+0x32,0xfc,0x11,0x3d,0xe0,0x2f,0xff,0xff,0xf5,0x02,0xfd,0x44,0x5a,0xf6,0x2f,0xc0,
+0x00,0x2f,0xb2,0xfd,0x66,0x6b,0xf8,0x2f,0xff,0xff,0xd8,0x00,0x2f,0xff,0xff,0xf1,
+0x2f,0xd7,0x77,0x70,0x2f,0xc0,0x00,0x00,0x04,0x00,0x05,0xf7,0x22,0x00,0x3f,0xff,
+0xfd,0x00,0x00,0x5f,0xb8,0xfd,0x00,0x00,0x8f,0x40,0xfd,0x00,0x00,0xbf,0x10,0xfd,
+0x00,0x00,0xee,0x00,0xfd,0x00,0x02,0xfa,0x00,0xfd,0x00,0x07,0xf6,0x00,0xfd,0x00,
 0x7e,0xf9,0x88,0xfe,0x80,0xef,0xff,0xff,0xff,0xf0,0xeb,0x00,0x00,0x09,0x05,0x00,
-0x00,0x5e,0x0c,0x10,0xfe,0xb2,0x00,0x13,0x60,0xb2,0x00,0x10,0x22,0x94,0x0c,0x60,
-0xf8,0x02,0xfd,0x55,0x55,0x20,0x12,0x00,0x00,0x1b,0x00,0x20,0x71,0x2f,0x9a,0x01,
-0xf2,0x0d,0x07,0xf6,0x00,0xfc,0x00,0xaf,0x30,0x0d,0xf1,0x0f,0xc0,0x4f,0xa0,0x00,
-0x4f,0xa0,0xfc,0x0d,0xf1,0x00,0x00,0xaf,0x5f,0xc8,0xf6,0x00,0x00,0x06,0xba,0x01,
-0xf1,0x5f,0xee,0x2f,0xd4,0xfb,0x00,0x00,0x8f,0x50,0xfc,0x09,0xf5,0x00,0x2f,0xc0,
-0x0f,0xc0,0x1f,0xe0,0x0b,0xf3,0x00,0xfc,0x00,0x7f,0x80,0x01,0xae,0xfc,0x40,0x0d,
-0xf8,0x7e,0xf1,0x3d,0x60,0x08,0xf4,0x00,0x01,0x3d,0xe1,0x00,0x0b,0xfe,0x40,0x00,
-0x03,0x6c,0xf3,0x4b,0x30,0x05,0xf8,0x3f,0xe8,0x8e,0xf4,0x04,0xcf,0xfc,0x50,0x2f,
-0x80,0x00,0xef,0x72,0xf8,0x00,0x7f,0xf7,0x2f,0x80,0x1f,0xcf,0x72,0xf8,0x09,0xf4,
-0xf7,0x2f,0x82,0xf8,0x3f,0x72,0xf8,0xbe,0x03,0xf7,0x2f,0xcf,0x60,0x3f,0x72,0xff,
-0xd0,0x03,0xf7,0x2f,0xf4,0x00,0x3f,0x70,0x00,0xcb,0x05,0xf2,0x00,0x03,0xce,0xd7,
-0xa7,0x01,0xf0,0x47,0x02,0xf8,0x00,0x0e,0xf7,0x2f,0x80,0x07,0xff,0x72,0xf8,0x01,
-0xfc,0xf7,0x2f,0x80,0x9f,0x4f,0x72,0xf8,0x2f,0x83,0xf7,0x2f,0x8b,0xe0,0x3f,0x72,
-0xfc,0xf6,0x03,0xf7,0x2f,0xfd,0x00,0x3f,0x72,0xff,0x40,0x03,0xf7,0x2f,0xc0,0x09,
-0xf5,0x2f,0xc0,0x3f,0xa0,0x2f,0xc0,0xcf,0x10,0x2f,0xc8,0xf6,0x00,0x2f,0xff,0xf2,
-0x00,0x2f,0xc3,0xfb,0x00,0x2f,0xb0,0x9f,0x50,0x2f,0xb0,0x0e,0xe1,0x2f,0xb0,0x06,
-0xfa,0x00,0xdf,0xff,0xff,0x40,0x0f,0xe8,0x8c,0xf4,0xa2,0x0b,0xf1,0x43,0x40,0x4f,
-0x90,0x08,0xf4,0x07,0xf7,0x00,0x8f,0x40,0xaf,0x40,0x08,0xf4,0x0e,0xf1,0x00,0x8f,
-0x4b,0xfb,0x00,0x08,0xf4,0xed,0x20,0x00,0x8f,0x40,0x2f,0xf8,0x00,0x0b,0xff,0x2f,
-0xfd,0x00,0x0f,0xff,0x2f,0xcf,0x20,0x4f,0xcf,0x2f,0x9f,0x70,0x9d,0xbf,0x2f,0x8b,
-0xd0,0xe8,0xbf,0x2f,0x86,0xf5,0xf3,0xbf,0x2f,0x81,0xfd,0xe0,0xbf,0x2f,0x80,0xbf,
-0x80,0xbf,0x2f,0x80,0x6f,0x30,0xbf,0x2f,0xc0,0x00,0x5f,0x82,0xfc,0x00,0x05,0xf8,
-0x09,0x00,0x40,0xfe,0x99,0x9b,0xf8,0x4f,0x01,0x06,0x12,0x00,0x04,0x09,0x00,0xf0,
-0x19,0x80,0x00,0x5c,0xff,0xc6,0x00,0x08,0xfe,0x98,0xef,0x90,0x1f,0xe1,0x00,0x1e,
-0xf2,0x5f,0x90,0x00,0x07,0xf7,0x7f,0x70,0x00,0x06,0xf8,0x5f,0x80,0x00,0x07,0xf7,
-0x1f,0xe1,0x00,0x0e,0xf2,0x07,0xfe,0x88,0xdf,0x28,0x00,0x20,0xc5,0x00,0x44,0x00,
-0xdf,0x72,0xfe,0x88,0x8b,0xf7,0x2f,0xb0,0x00,0x5f,0x72,0xfb,0x00,0x05,0x09,0x00,
-0x04,0xf3,0x14,0x70,0x2f,0xff,0xfe,0xa1,0x02,0xfd,0x77,0xaf,0xc0,0x2f,0xc0,0x00,
-0xcf,0x22,0xfc,0x00,0x0b,0xf2,0x2f,0xc2,0x25,0xfe,0x02,0xff,0xff,0xfe,0x40,0x2f,
-0xd5,0x54,0x00,0x02,0xfc,0x00,0x44,0x02,0xf1,0x03,0x00,0x6c,0xff,0xc5,0x00,0x09,
-0xfe,0x88,0xef,0x60,0x2f,0xe1,0x00,0x1c,0x70,0x6f,0x80,0x00,0xeb,0x0d,0x01,0x10,
-0x0a,0x20,0x00,0x00,0x93,0x00,0x20,0xa0,0x08,0x1e,0x00,0x40,0x00,0x5c,0xff,0xc4,
-0x2a,0x01,0x50,0xfc,0x67,0x7f,0xf7,0x75,0xd6,0x08,0x0f,0x04,0x00,0x05,0xf0,0x01,
-0xbf,0x30,0x00,0xee,0x02,0xfc,0x00,0x5f,0x70,0x07,0xf6,0x0c,0xe0,0x00,0x0d,0xe4,
-0x6a,0x09,0xf1,0x04,0xff,0x10,0x00,0x00,0xbf,0x80,0x00,0x00,0x0c,0xf1,0x00,0x01,
-0xcc,0xf8,0x00,0x00,0x3e,0xf9,0x00,0xd4,0x07,0x30,0x70,0x00,0x00,0xcd,0x07,0xf2,
-0x12,0x40,0x2f,0xe6,0x8f,0x96,0xef,0x37,0xf7,0x05,0xf7,0x05,0xf8,0x7f,0x60,0x5f,
-0x70,0x5f,0x93,0xfd,0x36,0xf7,0x3c,0xf4,0x05,0xef,0xff,0xff,0xf6,0x00,0x00,0x27,
-0xf9,0x30,0x2c,0x00,0x00,0xdf,0x0c,0xf0,0x17,0xee,0x10,0xaf,0x40,0x9f,0x50,0x01,
-0xed,0x4f,0xb0,0x00,0x04,0xff,0xf1,0x00,0x00,0x0e,0xfc,0x00,0x00,0x09,0xfc,0xf5,
-0x00,0x04,0xfa,0x1e,0xe1,0x00,0xdf,0x10,0x5f,0x90,0x9f,0x60,0x00,0xbf,0x40,0x5e,
-0x03,0x1f,0x20,0x05,0x00,0x0c,0x40,0xe8,0x88,0xdf,0x93,0x4f,0x01,0x10,0xf6,0x7a,
-0x04,0x07,0x05,0x00,0x95,0x4f,0x80,0x00,0x9f,0x44,0xf8,0x00,0x09,0xf4,0x09,0x00,
-0xff,0x15,0x1f,0xe3,0x13,0xcf,0x40,0x8f,0xff,0xfe,0xf4,0x00,0x13,0x30,0x9f,0x40,
-0x00,0x00,0x09,0xf4,0x00,0x00,0x00,0x9f,0x40,0x2f,0xa0,0x06,0xf7,0x00,0x9f,0x32,
-0xfa,0x00,0x6f,0x70,0x09,0xf3,0x0d,0x00,0x0e,0x80,0xfd,0x88,0xbf,0xb8,0x8d,0xf3,
-0x2f,0xff,0x01,0x00,0x8f,0x30,0x2f,0xa0,0x08,0xf4,0x00,0xee,0x00,0x07,0x00,0x18,
-0x62,0xd8,0x8c,0xfa,0x88,0xff,0x81,0x3f,0x00,0x12,0xf2,0xab,0x04,0x0b,0x07,0x00,
-0x01,0xce,0x01,0x19,0xfd,0x06,0x00,0x50,0xc2,0x21,0x00,0x00,0xfd,0x9c,0x04,0x80,
-0x00,0xfd,0x2f,0xd5,0x55,0xcf,0x60,0xfd,0x71,0x02,0x70,0x90,0xfd,0x2f,0xd7,0x78,
-0xdf,0x50,0x18,0x00,0x12,0xd6,0x2a,0x00,0x05,0x0d,0x02,0x0f,0xba,0x04,0x09,0xb0,
-0x02,0xae,0xfd,0x80,0x01,0xef,0x98,0xcf,0xc0,0x4c,0x50,0x88,0x0d,0xf0,0x02,0x12,
-0x26,0xf9,0x00,0x0a,0xff,0xff,0xb0,0x00,0x35,0x58,0xf9,0x4d,0x40,0x00,0xaf,0x52,
-0x1b,0x00,0x00,0x24,0x00,0x00,0x49,0x00,0xb0,0x7d,0xfe,0xa1,0x02,0xfc,0x00,0xaf,
-0xb6,0x8f,0xe1,0x2f,0x80,0x02,0x80,0x7f,0x82,0xfe,0x9b,0xf7,0x00,0x02,0xfc,0xe6,
-0x10,0xf1,0x07,0x00,0x1f,0xd2,0xfc,0x06,0xf7,0x00,0x02,0xfb,0x2f,0xc0,0x2f,0xd0,
-0x00,0x9f,0x72,0xfc,0x00,0x9f,0xd8,0xaf,0xd0,0x34,0x00,0xf0,0x05,0x91,0x00,0x04,
-0xcf,0xff,0xff,0x71,0xff,0x87,0x7a,0xf7,0x4f,0x90,0x00,0x6f,0x71,0xfd,0x32,0x27,
-0xf7,0x03,0x02,0xf1,0x21,0x70,0x0b,0xf7,0x59,0xf7,0x04,0xfb,0x00,0x6f,0x70,0xdf,
-0x20,0x06,0xf7,0x7f,0x90,0x00,0x6f,0x70,0x05,0xdf,0xd6,0x00,0x1f,0xc3,0xcf,0x20,
-0x01,0x00,0x7f,0x50,0x0a,0xef,0xff,0x50,0x8f,0x70,0x7f,0x50,0x8f,0x84,0xdf,0x80,
-0x1c,0xfc,0x2c,0xf4,0x00,0xce,0x06,0xf8,0x3c,0xac,0xf2,0x02,0xef,0xda,0x81,0x0c,
-0x80,0x00,0x00,0x2d,0x5d,0xfd,0x40,0x5c,0xe5,0x4e,0xf1,0x6f,0x90,0x07,0xf6,0x5f,
-0x70,0x05,0xf7,0x3f,0x90,0x07,0xf5,0x0d,0xf5,0x5e,0xe1,0x02,0xbf,0xeb,0x30,0x1f,
-0xff,0xfd,0x70,0x1f,0xb2,0x2c,0xf3,0x1f,0xb0,0x0b,0xf2,0x1f,0xff,0xff,0x70,0x1f,
-0xb2,0x2a,0xf4,0x1f,0xb1,0x29,0xf6,0x1f,0xff,0xfe,0x90,0x1f,0xff,0xf1,0x1f,0xc3,
-0x30,0x1f,0xb0,0x00,0x03,0x00,0xf0,0x0c,0x00,0xcf,0xff,0xf1,0x00,0x0e,0xc3,0xcf,
-0x10,0x01,0xf9,0x0b,0xf1,0x00,0x4f,0x60,0xbf,0x10,0x09,0xf2,0x0b,0xf1,0x03,0xee,
-0x33,0xcf,0x40,0x66,0x05,0x91,0x0e,0xa0,0x00,0x08,0xf0,0xea,0x00,0x00,0x8f,0x09,
-0x00,0xf0,0x06,0x03,0xcf,0xe6,0x01,0xed,0x38,0xf3,0x5f,0x70,0x0f,0x97,0xff,0xff,
-0xfb,0x5f,0x82,0x22,0x11,0xed,0x46,0xd5,0x8e,0x13,0xff,0x58,0x0c,0xe0,0x3f,0x60,
-0xbe,0x00,0x3f,0x73,0xf6,0x4f,0x60,0x00,0xaf,0x5f,0x7d,0xd0,0x00,0x04,0xff,0xff,
-0xf7,0x00,0x00,0xce,0x3f,0x6b,0xe0,0x00,0x4f,0x73,0xf6,0x3f,0x80,0x0d,0xf0,0x3f,
-0x60,0xcf,0x10,0x07,0xef,0xc2,0x05,0xf6,0x4f,0xb0,0x01,0x02,0xfa,0x00,0x0a,0xfd,
-0x10,0x00,0x15,0xfd,0x06,0xf6,0x4f,0xe0,0x09,0xef,0xc4,0x00,0x1f,0x90,0x1e,0xf1,
-0x1f,0x90,0x9f,0xf1,0x1f,0x92,0xfd,0xf1,0x1f,0x8b,0xc8,0xf1,0x1f,0xcf,0x39,0xf1,
-0x1f,0xfa,0x09,0xf1,0x1f,0xf1,0x09,0xf1,0x03,0x70,0x06,0x40,0x05,0xf2,0x1f,0x60,
-0x00,0x8d,0xd9,0x28,0x00,0x0a,0xf0,0x4d,0x1f,0xb0,0x8f,0x31,0xfb,0x0f,0xa0,0x1f,
-0xb8,0xf2,0x01,0xff,0xfa,0x00,0x1f,0xb9,0xf2,0x01,0xfb,0x1f,0xa0,0x1f,0xb0,0x9f,
-0x30,0x00,0xff,0xff,0xf5,0x01,0xfa,0x38,0xf5,0x04,0xf6,0x07,0xf5,0x06,0xf4,0x07,
-0xf5,0x09,0xf1,0x07,0xf5,0x3e,0xd0,0x07,0xf5,0xde,0x40,0x07,0xf5,0x1f,0xf6,0x00,
-0xcf,0xb1,0xfe,0xb0,0x1f,0xfb,0x1f,0xbf,0x16,0xed,0xb1,0xf7,0xe5,0xa9,0xdb,0x1f,
-0x79,0xaf,0x4d,0xb1,0xf7,0x4f,0xf0,0xdb,0x1f,0x70,0xfa,0x0d,0xb0,0x1f,0xb0,0x0d,
-0xf1,0xfb,0x00,0xdf,0x07,0x00,0x63,0xff,0xff,0xff,0x1f,0xc3,0x3e,0x0e,0x00,0xf0,
-0x02,0xf0,0x02,0xbe,0xeb,0x20,0x0e,0xe5,0x5f,0xd0,0x5f,0x80,0x09,0xf4,0x7f,0x60,
-0x07,0xf6,0x08,0x00,0x00,0x10,0x00,0xb7,0x02,0xbe,0xea,0x10,0x1f,0xff,0xff,0xf1,
-0xfc,0x33,0xef,0x3c,0x00,0x03,0x35,0x00,0xf1,0x10,0x1f,0xaa,0xfd,0x40,0x1f,0xf5,
-0x3e,0xf1,0x1f,0xc0,0x08,0xf4,0x1f,0xb0,0x07,0xf6,0x1f,0xd0,0x09,0xf4,0x1f,0xf7,
-0x5f,0xe0,0x1f,0xba,0xfd,0x40,0x1f,0xa0,0x00,0x90,0x01,0x00,0x04,0x00,0xc0,0x02,
-0xbf,0xe8,0x00,0xee,0x58,0xf7,0x5f,0x70,0x05,0x37,0xf6,0x29,0x04,0x40,0x06,0x51,
-0xee,0x48,0x3a,0x15,0x00,0xf1,0x08,0x68,0x23,0xcf,0x43,0x00,0xbf,0x10,0x03,0x00,
-0xf1,0x0c,0xbf,0x20,0x0d,0xf0,0x5f,0x70,0x2f,0x90,0x0e,0xc0,0x7f,0x40,0x09,0xf1,
-0xbe,0x00,0x03,0xf6,0xf8,0x00,0x00,0xce,0xf2,0x00,0x00,0x6f,0xd0,0x66,0x04,0x61,
-0x15,0xee,0x10,0x00,0x4f,0xd4,0x66,0x06,0x12,0x10,0x6b,0x06,0x00,0x1e,0x03,0xf0,
-0x00,0x80,0x00,0x00,0x6e,0xe7,0xf9,0xbf,0xb0,0x1f,0xd4,0xbf,0xe5,0xaf,0x76,0xf7,
-0x7e,0x0d,0xc0,0x7f,0x60,0x2f,0x80,0x0f,0xd6,0xf7,0x04,0xf9,0x02,0xfb,0x2f,0x16,
-0x00,0x62,0x70,0x6e,0xe7,0xf9,0xcf,0xa0,0x2c,0x00,0x07,0x37,0x00,0xf1,0x0d,0x7f,
-0x70,0x4f,0xa0,0x0b,0xf2,0xdd,0x00,0x01,0xef,0xf3,0x00,0x00,0x9f,0xc0,0x00,0x03,
-0xfd,0xf6,0x00,0x0d,0xe1,0xcf,0x20,0x8f,0x40,0x2f,0xc0,0xe6,0x00,0x0c,0x04,0x00,
-0x20,0xc3,0x3e,0x8c,0x02,0x10,0xfe,0xa5,0x0b,0x04,0x04,0x00,0xf0,0x05,0x7f,0x40,
-0x2f,0xa7,0xf4,0x02,0xfa,0x7f,0x40,0x2f,0xa6,0xf8,0x15,0xfa,0x1e,0xff,0xef,0xa0,
-0x03,0x12,0x09,0x11,0x6f,0xa0,0x1f,0x90,0x6f,0x30,0xce,0x05,0x00,0x02,0xfd,0x05,
-0xa3,0x8f,0x63,0xde,0x1f,0xff,0xff,0xff,0xfe,0x1f,0x90,0x6f,0x40,0xce,0x01,0xf9,
-0x06,0xf4,0x0c,0xe0,0x0b,0x00,0x60,0xfa,0x38,0xf6,0x3c,0xf2,0x1f,0x54,0x04,0x10,
-0xd0,0xaf,0x00,0x20,0xbd,0x00,0x5d,0x0b,0x02,0x0b,0x00,0x70,0xcf,0xff,0x60,0x00,
-0x02,0x38,0xf6,0xbd,0x0c,0x10,0x60,0xeb,0x07,0xf0,0x01,0xfe,0xb3,0x00,0x6f,0x72,
-0x4f,0xd0,0x06,0xf7,0x14,0xfd,0x00,0x6f,0xff,0xfc,0x30,0x79,0x01,0x72,0x9f,0x31,
-0xfb,0x00,0x00,0x09,0xf3,0x0b,0x00,0xf1,0x06,0xff,0xfe,0xd8,0x09,0xf3,0x1f,0xb2,
-0x2a,0xf5,0x9f,0x31,0xfb,0x12,0xaf,0x59,0xf3,0x1f,0xff,0xfe,0x80,0x9f,0x27,0x00,
-0x05,0x04,0x00,0x30,0xff,0xed,0x80,0x21,0x00,0x40,0x1f,0xb1,0x2a,0xf5,0x1e,0x00,
-0xff,0x51,0x06,0xdf,0xc4,0x04,0xfa,0x4c,0xf2,0x36,0x10,0x4f,0x80,0x03,0xff,0xfa,
-0x35,0x13,0x6f,0x85,0xf9,0x4b,0xf2,0x06,0xdf,0xc4,0x00,0x1f,0xb0,0x07,0xef,0xc3,
-0x01,0xfb,0x07,0xf7,0x2c,0xf1,0x1f,0xb0,0xee,0x00,0x5f,0x71,0xff,0xff,0xd0,0x04,
-0xf8,0x1f,0xc3,0xfe,0x00,0x6f,0x71,0xfb,0x09,0xf8,0x4d,0xf1,0x1f,0xb0,0x09,0xef,
-0xc3,0x00,0x08,0xef,0xff,0xa5,0xfa,0x23,0xfa,0x5f,0x80,0x1f,0xa0,0xaf,0xff,0xfa,
-0x05,0xf7,0x3f,0xa1,0xed,0x01,0xfa,0xaf,0x30,0x1f,0xa0,0x05,0xf0,0x9c,0x00,0x26,
-0x03,0x40,0x80,0x03,0x06,0xf1,0x12,0x00,0x10,0x0d,0xf9,0x1f,0xfd,0x0b,0xf7,0x01,
-0x00,0x00,0x01,0xfb,0x50,0x00,0x07,0xcf,0xe8,0x20,0x00,0x4e,0xf7,0x08,0xdf,0xd8,
-0x11,0xfa,0x40,0x00,0x09,0x88,0x88,0x31,0x16,0x06,0x00,0x01,0x00,0x10,0x10,0x05,
-0x00,0xa0,0x16,0xaf,0xf0,0x00,0x00,0x03,0x7c,0xff,0xff,0xf0,0x4e,0x0c,0x00,0x07,
-0x00,0x50,0x0b,0xff,0xff,0xfe,0xac,0x07,0x00,0x90,0xd8,0x30,0x09,0xf0,0x00,0x0b,
-0xf1,0x00,0x00,0x07,0x00,0x1b,0xe0,0x07,0x00,0xf0,0x03,0x3d,0xff,0xf0,0x03,0x6c,
-0xe0,0x00,0xcf,0xff,0xf0,0xaf,0xff,0xe0,0x00,0x5f,0xff,0x80,0xdf,0x67,0x01,0x41,
-0x21,0x00,0x2a,0xda,0xf0,0x0a,0xf1,0x3b,0x80,0x9c,0xcc,0xcc,0xcc,0x40,0x8f,0xdf,
-0xb7,0x77,0x77,0xfe,0xdf,0xd0,0xc7,0x00,0x00,0x0d,0x50,0xde,0x8e,0x70,0x00,0x00,
-0xdb,0x8e,0xe5,0xdb,0x77,0x77,0x7f,0x95,0xed,0x1c,0xeb,0xbb,0xbb,0xf6,0x1d,0xfc,
-0xf7,0x00,0x00,0x0d,0xdc,0xfd,0x0c,0x70,0x00,0x00,0xd5,0x0d,0xfa,0xe9,0x33,0x33,
-0x3e,0xca,0xfc,0x3d,0xff,0xff,0xff,0xf8,0x3c,0x35,0x52,0x05,0x55,0x55,0x55,0x3f,
-0xff,0xc6,0x16,0x06,0x20,0xfc,0x6f,0x05,0x00,0xcf,0xee,0x94,0xee,0xee,0xee,0xec,
-0x34,0x42,0x04,0x44,0x44,0x44,0x1a,0x00,0x14,0x30,0xfd,0xff,0xa4,0x06,0x00,0x01,
-0xf0,0x00,0x11,0x29,0xf1,0x00,0x21,0x2e,0xfc,0x06,0x00,0x31,0xff,0x90,0x50,0x06,
-0x00,0x20,0xaf,0xc0,0x06,0x00,0xa0,0x0c,0xff,0xc0,0x2e,0xff,0x90,0x00,0x1c,0xff,
-0xce,0xa0,0x0e,0x12,0x1c,0xa6,0x0e,0x31,0x1c,0xff,0x90,0x34,0x02,0x04,0x37,0x0c,
-0xf0,0x07,0x09,0xf5,0x00,0x06,0xf8,0xdf,0xf5,0x06,0xff,0xc2,0xef,0xf9,0xff,0xd1,
-0x02,0xef,0xff,0xd1,0x00,0x08,0xff,0xf7,0x2a,0x0a,0xf0,0x05,0xf5,0x06,0xff,0xe4,
-0xef,0xf5,0xef,0xe1,0x02,0xef,0xd4,0xa1,0x00,0x02,0xb4,0x00,0x00,0x02,0x50,0x00,
-0xef,0x0c,0xf0,0x1e,0xbf,0x40,0x30,0x00,0x01,0xcf,0x1b,0xf4,0x7f,0x80,0x00,0xbf,
-0xd0,0xbf,0x45,0xff,0x40,0x4f,0xe1,0x0b,0xf4,0x07,0xfd,0x09,0xf8,0x00,0xbf,0x40,
-0x0e,0xf2,0xcf,0x40,0x0b,0xf4,0x00,0xbf,0x4b,0xf4,0x00,0x9e,0x30,0x0b,0xf4,0x9f,
-0x80,0x16,0x14,0x10,0x23,0x74,0x0a,0xc0,0x8f,0xc0,0x0a,0xfe,0x40,0x01,0x8f,0xf4,
-0x00,0x0c,0xff,0xed,0xac,0x01,0x40,0x07,0xef,0xff,0xc3,0x4f,0x00,0x21,0x12,0x10,
-0x87,0x00,0x11,0x21,0x06,0x00,0x01,0x8b,0x15,0xd1,0x10,0x3f,0xff,0x70,0x11,0x00,
-0x7f,0xbf,0xff,0xff,0xce,0xb0,0x1f,0xf5,0x00,0xf1,0x14,0x53,0xff,0xff,0x82,0x5f,
-0xff,0xf7,0x03,0xff,0xc0,0x00,0x7f,0xf8,0x00,0x3f,0xfa,0x00,0x06,0xff,0x70,0x2c,
-0xff,0xf4,0x01,0xdf,0xfe,0x42,0xff,0xff,0xfe,0xff,0xff,0xf6,0x0a,0xff,0x10,0x01,
-0x50,0x05,0x07,0xff,0xfa,0x13,0x8d,0x14,0x11,0xff,0x4a,0x10,0x21,0x46,0x50,0x55,
-0x00,0x40,0x25,0x00,0x36,0x20,0x9f,0x10,0x30,0xfc,0x1a,0xf6,0x2a,0x09,0xf1,0x15,
-0xe9,0xfe,0xcf,0x60,0x00,0x00,0xaf,0xc3,0x64,0xff,0xf6,0x00,0x01,0xcf,0xa3,0xef,
-0xa3,0xdf,0x90,0x03,0xef,0x75,0xff,0xff,0xc3,0xcf,0xb0,0xdf,0x48,0xff,0xff,0xff,
-0xe3,0x9f,0x72,0x27,0xb4,0x07,0xe0,0x50,0x00,0x9f,0xff,0xcb,0xef,0xff,0x30,0x00,
-0x09,0xff,0xf1,0x07,0xff,0x0b,0x04,0xa1,0xff,0x10,0x7f,0xff,0x30,0x00,0x07,0xff,
-0xe0,0x06,0xd2,0x07,0x21,0x04,0x54,0x60,0x00,0x10,0x1f,0x2c,0x09,0x00,0x46,0x19,
-0x1d,0x20,0x07,0x00,0x50,0x47,0x8f,0xff,0x87,0x40,0x39,0x00,0x00,0x7c,0x01,0x00,
-0x7e,0x07,0x10,0xfa,0x1c,0x00,0x10,0xaf,0xf0,0x0e,0xf2,0x03,0x46,0x66,0x3a,0xfa,
-0x36,0x66,0x50,0xff,0xff,0xf4,0x54,0xff,0xff,0xf2,0xff,0xff,0xff,0xcf,0x07,0x00,
-0x60,0xff,0xf3,0xb8,0xf2,0x9b,0xbb,0x01,0x00,0xa2,0xa0,0x00,0x08,0xaa,0xaa,0xaa,
-0xa4,0x00,0x00,0x08,0x43,0x08,0x20,0x03,0xfb,0x58,0x00,0x40,0xd0,0x00,0xdf,0x10,
-0xe3,0x03,0x40,0x80,0x8f,0x60,0x00,0x2f,0x10,0xf1,0x02,0x3f,0xfe,0xee,0x40,0x00,
-0x9e,0xee,0xf9,0xff,0xff,0xfc,0x44,0x5f,0xff,0xff,0xaf,0xff,0x01,0x00,0x22,0xfa,
-0xff,0x01,0x00,0x12,0x9a,0x07,0x00,0x11,0xf5,0x19,0x03,0xf0,0x0f,0x07,0x90,0x00,
-0x6d,0xff,0xfb,0x40,0xcf,0x00,0xbf,0xfd,0xbd,0xff,0xac,0xf0,0xbf,0xd3,0x00,0x03,
-0xcf,0xff,0x4f,0xd1,0x00,0x07,0xaa,0xff,0xf9,0xf5,0x00,0x7c,0x05,0x72,0x01,0x00,
-0x00,0x00,0x11,0x11,0x10,0x1a,0x02,0x01,0xae,0x00,0xf0,0x0b,0x4f,0x9f,0xff,0xab,
-0x70,0x00,0x0d,0xf4,0xff,0xfb,0x20,0x00,0x3c,0xfb,0x0f,0xcb,0xff,0xca,0xcf,0xfc,
-0x10,0xfc,0x05,0xcf,0xff,0xd7,0xbd,0x1c,0x02,0xbd,0x01,0x80,0x05,0x20,0x00,0x06,
-0xf7,0x01,0x16,0xff,0xd7,0x15,0x24,0xff,0xff,0x07,0x00,0xe0,0x8a,0xcc,0xef,0xf8,
-0x00,0x02,0xef,0x80,0x00,0x02,0xe7,0x00,0x00,0x01,0x2f,0x01,0x21,0x20,0x00,0xe5,
-0x1a,0xf0,0x00,0x01,0x16,0xff,0x80,0x00,0xef,0xff,0xff,0x82,0xb1,0xff,0xff,0xff,
-0x80,0xc9,0x05,0x00,0x10,0x9b,0x69,0x0b,0xa0,0xf3,0xbd,0xdf,0xff,0x80,0x10,0x00,
-0x03,0xef,0x80,0x90,0x17,0x22,0x70,0x00,0x36,0x00,0x07,0x01,0x00,0x22,0x04,0xc2,
-0x6d,0x00,0x30,0x0b,0xe1,0x00,0xdb,0x1b,0x30,0xb7,0x0c,0xb0,0x4b,0x00,0xb0,0x05,
-0xf5,0x2f,0x3f,0xff,0xff,0xf8,0x2c,0x17,0xd0,0xb8,0x4b,0x00,0xb1,0xba,0x2f,0x18,
-0xbf,0xff,0xff,0xf8,0x09,0xb1,0xf2,0x7b,0x55,0x00,0x30,0x5e,0x0a,0x9a,0x89,0x00,
-0x30,0x2e,0x80,0xe4,0x8d,0x00,0x40,0x0c,0xa0,0x8d,0x00,0x91,0x00,0x31,0x10,0x7f,
-0x30,0x5f,0x00,0x24,0x4f,0x40,0x36,0x04,0x11,0x9f,0x29,0x01,0x40,0x9f,0xf9,0xbf,
-0xff,0xaa,0x03,0x30,0x00,0xdf,0xff,0x4d,0x00,0x90,0x0d,0xff,0xf8,0xaf,0xff,0xff,
-0x9b,0xff,0xf8,0x1d,0x01,0x20,0x6d,0xf8,0x4d,0x08,0x20,0x40,0x17,0xc9,0x01,0x11,
-0xa0,0xc8,0x01,0x72,0xfd,0xaa,0xaa,0xaa,0xaa,0xad,0xfa,0x72,0x01,0x02,0xbf,0x12,
-0x00,0x38,0x12,0x50,0x0c,0xfb,0x00,0x00,0x03,0x31,0x02,0x30,0xdf,0xff,0xc0,0x0c,
-0x17,0x10,0x70,0x05,0x0a,0xf0,0x09,0x2a,0xff,0xff,0xff,0xf9,0xef,0xef,0xff,0xff,
-0xdf,0xb7,0xff,0xff,0xfe,0xce,0x2d,0xff,0xff,0xb5,0xfc,0x36,0xff,0xf3,0x07,0xb9,
-0x04,0xf0,0x11,0x02,0x89,0x72,0x00,0x06,0x40,0x00,0x02,0x42,0xfa,0x00,0x03,0xef,
-0x2f,0xa0,0x04,0xff,0xf2,0xfa,0x05,0xff,0xff,0x2f,0xa6,0xff,0xff,0xf2,0xfe,0xff,
-0xff,0xff,0x2f,0xff,0x01,0xf1,0x07,0xfc,0xdf,0xff,0xff,0x2f,0xa1,0xdf,0xff,0xf2,
-0xfa,0x01,0xcf,0xff,0x2f,0xa0,0x00,0xbf,0xf2,0xf9,0x00,0x00,0x9c,0xbd,0x00,0x11,
-0x24,0x06,0x00,0x22,0xef,0xc3,0xb5,0x01,0x11,0x91,0x06,0x00,0x21,0xff,0x70,0x06,
-0x00,0x31,0xfd,0x40,0x00,0x9d,0x00,0x12,0x10,0x87,0x0a,0x11,0xff,0x61,0x02,0x10,
-0xff,0x65,0x06,0x11,0x50,0xe1,0x00,0x00,0x1e,0x00,0x10,0xb2,0x2a,0x00,0x10,0xd4,
-0x36,0x00,0x10,0xf7,0x42,0x00,0x11,0x48,0xd4,0x01,0xff,0x03,0x26,0x66,0x10,0x16,
-0x66,0x30,0xef,0xff,0xc0,0xaf,0xff,0xf1,0xff,0xff,0xe0,0xbf,0xff,0xf2,0x06,0x00,
-0x19,0xb0,0xd0,0xbf,0xff,0xf2,0xaf,0xff,0x80,0x6e,0xff,0xc0,0x26,0xbd,0x10,0x30,
-0x50,0xef,0xff,0xc9,0x10,0x01,0x7e,0x00,0x1f,0xf6,0x06,0x00,0x1c,0x11,0xf5,0xd2,
+0x90,0x2f,0xff,0xff,0xfe,0x02,0xfd,0x77,0x77,0x60,0x49,0x00,0xe0,0x02,0xfc,0x22,
+0x22,0x10,0x2f,0xff,0xff,0xf8,0x02,0xfd,0x55,0x55,0x20,0x12,0x00,0x00,0x1b,0x00,
+0xf0,0x13,0x71,0x2f,0xff,0xff,0xff,0x20,0x07,0xf6,0x00,0xfc,0x00,0xaf,0x30,0x0d,
+0xf1,0x0f,0xc0,0x4f,0xa0,0x00,0x4f,0xa0,0xfc,0x0d,0xf1,0x00,0x00,0xaf,0x5f,0xc8,
+0xf6,0x00,0x00,0x06,0x20,0x00,0xf0,0x62,0x00,0x00,0xee,0x2f,0xd4,0xfb,0x00,0x00,
+0x8f,0x50,0xfc,0x09,0xf5,0x00,0x2f,0xc0,0x0f,0xc0,0x1f,0xe0,0x0b,0xf3,0x00,0xfc,
+0x00,0x7f,0x80,0x01,0xae,0xfc,0x40,0x0d,0xf8,0x7e,0xf1,0x3d,0x60,0x08,0xf4,0x00,
+0x01,0x3d,0xe1,0x00,0x0b,0xfe,0x40,0x00,0x03,0x6c,0xf3,0x4b,0x30,0x05,0xf8,0x3f,
+0xe8,0x8e,0xf4,0x04,0xcf,0xfc,0x50,0x2f,0x80,0x00,0xef,0x72,0xf8,0x00,0x7f,0xf7,
+0x2f,0x80,0x1f,0xcf,0x72,0xf8,0x09,0xf4,0xf7,0x2f,0x82,0xf8,0x3f,0x72,0xf8,0xbe,
+0x03,0xf7,0x2f,0xcf,0x60,0x3f,0x72,0xff,0xd0,0x03,0xf7,0x2f,0xf4,0x00,0x3f,0x70,
+0x00,0xcb,0x05,0xf2,0x00,0x03,0xce,0xd7,0x00,0x01,0x00,0xf1,0x9d,0x02,0xf8,0x00,
+0x0e,0xf7,0x2f,0x80,0x07,0xff,0x72,0xf8,0x01,0xfc,0xf7,0x2f,0x80,0x9f,0x4f,0x72,
+0xf8,0x2f,0x83,0xf7,0x2f,0x8b,0xe0,0x3f,0x72,0xfc,0xf6,0x03,0xf7,0x2f,0xfd,0x00,
+0x3f,0x72,0xff,0x40,0x03,0xf7,0x2f,0xc0,0x09,0xf5,0x2f,0xc0,0x3f,0xa0,0x2f,0xc0,
+0xcf,0x10,0x2f,0xc8,0xf6,0x00,0x2f,0xff,0xf2,0x00,0x2f,0xc3,0xfb,0x00,0x2f,0xb0,
+0x9f,0x50,0x2f,0xb0,0x0e,0xe1,0x2f,0xb0,0x06,0xfa,0x00,0xdf,0xff,0xff,0x40,0x0f,
+0xe8,0x8c,0xf4,0x02,0xfb,0x00,0x8f,0x40,0x4f,0x90,0x08,0xf4,0x07,0xf7,0x00,0x8f,
+0x40,0xaf,0x40,0x08,0xf4,0x0e,0xf1,0x00,0x8f,0x4b,0xfb,0x00,0x08,0xf4,0xed,0x20,
+0x00,0x8f,0x40,0x2f,0xf8,0x00,0x0b,0xff,0x2f,0xfd,0x00,0x0f,0xff,0x2f,0xcf,0x20,
+0x4f,0xcf,0x2f,0x9f,0x70,0x9d,0xbf,0x2f,0x8b,0xd0,0xe8,0xbf,0x2f,0x86,0xf5,0xf3,
+0xbf,0x2f,0x81,0xfd,0xe0,0xbf,0x2f,0x80,0xbf,0x80,0xbf,0x2f,0x80,0x6f,0x30,0xbf,
+0x2f,0xc0,0x00,0x5f,0x82,0xfc,0x00,0x05,0xf8,0x09,0x00,0x40,0xfe,0x99,0x9b,0xf8,
+0x4f,0x01,0x06,0x12,0x00,0x04,0x09,0x00,0xf0,0x19,0x80,0x00,0x5c,0xff,0xc6,0x00,
+0x08,0xfe,0x98,0xef,0x90,0x1f,0xe1,0x00,0x1e,0xf2,0x5f,0x90,0x00,0x07,0xf7,0x7f,
+0x70,0x00,0x06,0xf8,0x5f,0x80,0x00,0x07,0xf7,0x1f,0xe1,0x00,0x0e,0xf2,0x07,0xfe,
+0x88,0xdf,0x28,0x00,0x20,0xc5,0x00,0x44,0x00,0xdf,0x72,0xfe,0x88,0x8b,0xf7,0x2f,
+0xb0,0x00,0x5f,0x72,0xfb,0x00,0x05,0x09,0x00,0x04,0xf3,0x14,0x70,0x2f,0xff,0xfe,
+0xa1,0x02,0xfd,0x77,0xaf,0xc0,0x2f,0xc0,0x00,0xcf,0x22,0xfc,0x00,0x0b,0xf2,0x2f,
+0xc2,0x25,0xfe,0x02,0xff,0xff,0xfe,0x40,0x2f,0xd5,0x54,0x00,0x02,0xfc,0x00,0x44,
+0x02,0xf0,0x0b,0x00,0x6c,0xff,0xc5,0x00,0x09,0xfe,0x88,0xef,0x60,0x2f,0xe1,0x00,
+0x1c,0x70,0x6f,0x80,0x00,0x00,0x00,0x7f,0x70,0x00,0x00,0x00,0x5f,0x0a,0x00,0x00,
+0x93,0x00,0x20,0xa0,0x08,0x1e,0x00,0x40,0x00,0x5c,0xff,0xc4,0x2a,0x01,0x9f,0xfc,
+0x67,0x7f,0xf7,0x75,0x00,0x0f,0xe0,0x00,0x04,0x00,0x05,0xf1,0x17,0xbf,0x30,0x00,
+0xee,0x02,0xfc,0x00,0x5f,0x70,0x07,0xf6,0x0c,0xe0,0x00,0x0d,0xe4,0xf8,0x00,0x00,
+0x4f,0xff,0x10,0x00,0x00,0xbf,0x80,0x00,0x00,0x0c,0xf1,0x00,0x01,0xcc,0xf8,0x00,
+0x00,0x3e,0xf9,0xc7,0x01,0xf3,0x1a,0x5f,0x70,0x00,0x00,0x3c,0xff,0xff,0xfc,0x40,
+0x2f,0xe6,0x8f,0x96,0xef,0x37,0xf7,0x05,0xf7,0x05,0xf8,0x7f,0x60,0x5f,0x70,0x5f,
+0x93,0xfd,0x36,0xf7,0x3c,0xf4,0x05,0xef,0xff,0xff,0xf6,0x00,0x00,0x27,0xf9,0x30,
+0x2c,0x00,0xf0,0x1a,0x4f,0xa0,0x01,0xee,0x10,0xaf,0x40,0x9f,0x50,0x01,0xed,0x4f,
+0xb0,0x00,0x04,0xff,0xf1,0x00,0x00,0x0e,0xfc,0x00,0x00,0x09,0xfc,0xf5,0x00,0x04,
+0xfa,0x1e,0xe1,0x00,0xdf,0x10,0x5f,0x90,0x9f,0x60,0x00,0xbf,0x40,0x5e,0x03,0x1f,
+0x20,0x05,0x00,0x0c,0x61,0xe8,0x88,0xdf,0x93,0x2f,0xff,0x62,0x00,0x27,0x00,0x03,
+0x05,0x00,0x95,0x4f,0x80,0x00,0x9f,0x44,0xf8,0x00,0x09,0xf4,0x09,0x00,0xff,0x15,
+0x1f,0xe3,0x13,0xcf,0x40,0x8f,0xff,0xfe,0xf4,0x00,0x13,0x30,0x9f,0x40,0x00,0x00,
+0x09,0xf4,0x00,0x00,0x00,0x9f,0x40,0x2f,0xa0,0x06,0xf7,0x00,0x9f,0x32,0xfa,0x00,
+0x6f,0x70,0x09,0xf3,0x0d,0x00,0x0e,0x80,0xfd,0x88,0xbf,0xb8,0x8d,0xf3,0x2f,0xff,
+0x01,0x00,0x8f,0x30,0x2f,0xa0,0x08,0xf4,0x00,0xee,0x00,0x07,0x00,0x18,0x62,0xd8,
+0x8c,0xfa,0x88,0xff,0x81,0x3f,0x00,0x11,0xf2,0x3d,0x01,0x1b,0x07,0x07,0x00,0x01,
+0xce,0x01,0x19,0xfd,0x06,0x00,0x20,0xc2,0x21,0x06,0x00,0xb0,0xff,0xff,0xf9,0x00,
+0xfd,0x2f,0xd5,0x55,0xcf,0x60,0xfd,0x71,0x02,0x70,0x90,0xfd,0x2f,0xd7,0x78,0xdf,
+0x50,0x18,0x00,0x12,0xd6,0x2a,0x00,0x04,0x0d,0x02,0x00,0x08,0x04,0x10,0x10,0x63,
+0x02,0xf0,0x25,0xfb,0x12,0xfd,0x55,0x5a,0xfa,0x2f,0xc0,0x00,0x1f,0xd2,0xfd,0x77,
+0x7c,0xf9,0x2f,0xff,0xff,0xe8,0x00,0x02,0xae,0xfd,0x80,0x01,0xef,0x98,0xcf,0xc0,
+0x4c,0x50,0x00,0xaf,0x60,0x00,0x12,0x26,0xf9,0x00,0x0a,0xff,0xff,0xb0,0x00,0x35,
+0x58,0xf9,0x4d,0x40,0x00,0xaf,0x52,0x1b,0x00,0x00,0x24,0x00,0x00,0x49,0x00,0xb0,
+0x7d,0xfe,0xa1,0x02,0xfc,0x00,0xaf,0xb6,0x8f,0xe1,0x2f,0x80,0x02,0xf1,0x13,0x7f,
+0x82,0xfe,0x9b,0xf7,0x00,0x02,0xfc,0x2f,0xff,0xff,0x60,0x00,0x1f,0xd2,0xfc,0x06,
+0xf7,0x00,0x02,0xfb,0x2f,0xc0,0x2f,0xd0,0x00,0x9f,0x72,0xfc,0x00,0x9f,0xd8,0xaf,
+0xd0,0x34,0x00,0xf0,0x05,0x91,0x00,0x04,0xcf,0xff,0xff,0x71,0xff,0x87,0x7a,0xf7,
+0x4f,0x90,0x00,0x6f,0x71,0xfd,0x32,0x27,0xf7,0x03,0x02,0xf1,0x20,0x70,0x0b,0xf7,
+0x59,0xf7,0x04,0xfb,0x00,0x6f,0x70,0xdf,0x20,0x06,0xf7,0x7f,0x90,0x00,0x6f,0x70,
+0x05,0xdf,0xd6,0x00,0x1f,0xc3,0xcf,0x20,0x01,0x00,0x7f,0x50,0x0a,0xef,0xff,0x50,
+0x8f,0x70,0x7f,0x50,0x8f,0x84,0xdf,0x80,0x1c,0xfc,0x2c,0xf4,0x0f,0x01,0xf8,0x3d,
+0x06,0xac,0xf2,0x02,0xef,0xda,0x81,0x0c,0x80,0x00,0x00,0x2d,0x5d,0xfd,0x40,0x5c,
+0xe5,0x4e,0xf1,0x6f,0x90,0x07,0xf6,0x5f,0x70,0x05,0xf7,0x3f,0x90,0x07,0xf5,0x0d,
+0xf5,0x5e,0xe1,0x02,0xbf,0xeb,0x30,0x1f,0xff,0xfd,0x70,0x1f,0xb2,0x2c,0xf3,0x1f,
+0xb0,0x0b,0xf2,0x1f,0xff,0xff,0x70,0x1f,0xb2,0x2a,0xf4,0x1f,0xb1,0x29,0xf6,0x1f,
+0xff,0xfe,0x90,0x1f,0xff,0xf1,0x1f,0xc3,0x30,0x1f,0xb0,0x00,0x03,0x00,0xf0,0x0c,
+0x00,0xcf,0xff,0xf1,0x00,0x0e,0xc3,0xcf,0x10,0x01,0xf9,0x0b,0xf1,0x00,0x4f,0x60,
+0xbf,0x10,0x09,0xf2,0x0b,0xf1,0x03,0xee,0x33,0xcf,0x40,0x66,0x05,0x91,0x0e,0xa0,
+0x00,0x08,0xf0,0xea,0x00,0x00,0x8f,0x09,0x00,0xff,0x71,0x03,0xcf,0xe6,0x01,0xed,
+0x38,0xf3,0x5f,0x70,0x0f,0x97,0xff,0xff,0xfb,0x5f,0x82,0x22,0x11,0xed,0x46,0xd5,
+0x03,0xcf,0xe8,0x00,0x0c,0xe0,0x3f,0x60,0xbe,0x00,0x3f,0x73,0xf6,0x4f,0x60,0x00,
+0xaf,0x5f,0x7d,0xd0,0x00,0x04,0xff,0xff,0xf7,0x00,0x00,0xce,0x3f,0x6b,0xe0,0x00,
+0x4f,0x73,0xf6,0x3f,0x80,0x0d,0xf0,0x3f,0x60,0xcf,0x10,0x07,0xef,0xc2,0x05,0xf6,
+0x4f,0xb0,0x01,0x02,0xfa,0x00,0x0a,0xfd,0x10,0x00,0x15,0xfd,0x06,0xf6,0x4f,0xe0,
+0x09,0xef,0xc4,0x00,0x1f,0x90,0x1e,0xf1,0x1f,0x90,0x9f,0xf1,0x1f,0x92,0xfd,0xf1,
+0x1f,0x8b,0xc8,0xf1,0x1f,0xcf,0x39,0xf1,0x1f,0xfa,0x09,0xf1,0x1f,0xf1,0x09,0xf1,
+0x03,0x70,0x06,0x40,0x05,0xf2,0x1f,0x60,0x00,0x8d,0xd9,0x28,0x00,0x0a,0xf0,0x4d,
+0x1f,0xb0,0x8f,0x31,0xfb,0x0f,0xa0,0x1f,0xb8,0xf2,0x01,0xff,0xfa,0x00,0x1f,0xb9,
+0xf2,0x01,0xfb,0x1f,0xa0,0x1f,0xb0,0x9f,0x30,0x00,0xff,0xff,0xf5,0x01,0xfa,0x38,
+0xf5,0x04,0xf6,0x07,0xf5,0x06,0xf4,0x07,0xf5,0x09,0xf1,0x07,0xf5,0x3e,0xd0,0x07,
+0xf5,0xde,0x40,0x07,0xf5,0x1f,0xf6,0x00,0xcf,0xb1,0xfe,0xb0,0x1f,0xfb,0x1f,0xbf,
+0x16,0xed,0xb1,0xf7,0xe5,0xa9,0xdb,0x1f,0x79,0xaf,0x4d,0xb1,0xf7,0x4f,0xf0,0xdb,
+0x1f,0x70,0xfa,0x0d,0xb0,0x1f,0xb0,0x0d,0xf1,0xfb,0x00,0xdf,0x07,0x00,0x63,0xff,
+0xff,0xff,0x1f,0xc3,0x3e,0x0e,0x00,0xf0,0x02,0xf0,0x02,0xbe,0xeb,0x20,0x0e,0xe5,
+0x5f,0xd0,0x5f,0x80,0x09,0xf4,0x7f,0x60,0x07,0xf6,0x08,0x00,0x00,0x10,0x00,0xb7,
+0x02,0xbe,0xea,0x10,0x1f,0xff,0xff,0xf1,0xfc,0x33,0xef,0x3c,0x00,0x03,0x35,0x00,
+0xf1,0x10,0x1f,0xaa,0xfd,0x40,0x1f,0xf5,0x3e,0xf1,0x1f,0xc0,0x08,0xf4,0x1f,0xb0,
+0x07,0xf6,0x1f,0xd0,0x09,0xf4,0x1f,0xf7,0x5f,0xe0,0x1f,0xba,0xfd,0x40,0x1f,0xa0,
+0x00,0x90,0x01,0x00,0x04,0x00,0xc0,0x02,0xbf,0xe8,0x00,0xee,0x58,0xf7,0x5f,0x70,
+0x05,0x37,0xf6,0x29,0x04,0x50,0x06,0x51,0xee,0x48,0xf8,0x68,0x01,0x98,0xaf,0xff,
+0xff,0x23,0xcf,0x43,0x00,0xbf,0x10,0x03,0x00,0xf1,0x0c,0xbf,0x20,0x0d,0xf0,0x5f,
+0x70,0x2f,0x90,0x0e,0xc0,0x7f,0x40,0x09,0xf1,0xbe,0x00,0x03,0xf6,0xf8,0x00,0x00,
+0xce,0xf2,0x00,0x00,0x6f,0xd0,0x66,0x04,0x61,0x15,0xee,0x10,0x00,0x4f,0xd4,0x66,
+0x06,0x12,0x10,0x6b,0x06,0x00,0x1e,0x03,0xf0,0x10,0x80,0x00,0x00,0x6e,0xe7,0xf9,
+0xbf,0xb0,0x1f,0xd4,0xbf,0xe5,0xaf,0x76,0xf7,0x03,0xf9,0x01,0xfb,0x7f,0x60,0x2f,
+0x80,0x0f,0xd6,0xf7,0x04,0xf9,0x02,0xfb,0x2f,0x16,0x00,0x62,0x70,0x6e,0xe7,0xf9,
+0xcf,0xa0,0x2c,0x00,0x07,0x37,0x00,0xf1,0x0d,0x7f,0x70,0x4f,0xa0,0x0b,0xf2,0xdd,
+0x00,0x01,0xef,0xf3,0x00,0x00,0x9f,0xc0,0x00,0x03,0xfd,0xf6,0x00,0x0d,0xe1,0xcf,
+0x20,0x8f,0x40,0x2f,0xc0,0xe6,0x00,0x0c,0x04,0x00,0x20,0xc3,0x3e,0x8c,0x02,0x54,
+0xfe,0x00,0x00,0x00,0xbe,0x04,0x00,0xff,0x0f,0x7f,0x40,0x2f,0xa7,0xf4,0x02,0xfa,
+0x7f,0x40,0x2f,0xa6,0xf8,0x15,0xfa,0x1e,0xff,0xef,0xa0,0x03,0x12,0xfa,0x00,0x00,
+0x2f,0xa0,0x1f,0x90,0x6f,0x30,0xce,0x05,0x00,0x02,0xfd,0x05,0xa3,0x8f,0x63,0xde,
+0x1f,0xff,0xff,0xff,0xfe,0x1f,0x90,0x6f,0x40,0xce,0x01,0xf9,0x06,0xf4,0x0c,0xe0,
+0x0b,0x00,0x60,0xfa,0x38,0xf6,0x3c,0xf2,0x1f,0x54,0x04,0x10,0xd0,0xaf,0x00,0x10,
+0xbd,0x05,0x00,0x12,0x0b,0x0b,0x00,0x60,0xcf,0xff,0x60,0x00,0x02,0x38,0x13,0x05,
+0x20,0x6f,0x60,0xeb,0x07,0xf0,0x01,0xfe,0xb3,0x00,0x6f,0x72,0x4f,0xd0,0x06,0xf7,
+0x14,0xfd,0x00,0x6f,0xff,0xfc,0x30,0x79,0x01,0x72,0x9f,0x31,0xfb,0x00,0x00,0x09,
+0xf3,0x0b,0x00,0xf1,0x06,0xff,0xfe,0xd8,0x09,0xf3,0x1f,0xb2,0x2a,0xf5,0x9f,0x31,
+0xfb,0x12,0xaf,0x59,0xf3,0x1f,0xff,0xfe,0x80,0x9f,0x27,0x00,0x05,0x04,0x00,0x30,
+0xff,0xed,0x80,0x21,0x00,0x40,0x1f,0xb1,0x2a,0xf5,0x1e,0x00,0xff,0x51,0x06,0xdf,
+0xc4,0x04,0xfa,0x4c,0xf2,0x36,0x10,0x4f,0x80,0x03,0xff,0xfa,0x35,0x13,0x6f,0x85,
+0xf9,0x4b,0xf2,0x06,0xdf,0xc4,0x00,0x1f,0xb0,0x07,0xef,0xc3,0x01,0xfb,0x07,0xf7,
+0x2c,0xf1,0x1f,0xb0,0xee,0x00,0x5f,0x71,0xff,0xff,0xd0,0x04,0xf8,0x1f,0xc3,0xfe,
+0x00,0x6f,0x71,0xfb,0x09,0xf8,0x4d,0xf1,0x1f,0xb0,0x09,0xef,0xc3,0x00,0x08,0xef,
+0xff,0xa5,0xfa,0x23,0xfa,0x5f,0x80,0x1f,0xa0,0xaf,0xff,0xfa,0x05,0xf7,0x3f,0xa1,
+0xed,0x01,0xfa,0xaf,0x30,0x1f,0xa0,0x05,0xf0,0x9c,0x00,0x26,0x03,0x40,0x80,0x03,
+0x06,0xf1,0x12,0x00,0x10,0x0d,0xf9,0x1f,0xfd,0x0b,0xf7,0x01,0x00,0x00,0x01,0xfb,
+0x50,0x00,0x07,0xcf,0xe8,0x20,0x00,0x4e,0xf7,0x08,0xdf,0xd8,0x11,0xfa,0x40,0x00,
+0x09,0x88,0x88,0x31,0x16,0x06,0x00,0x01,0x00,0x10,0x10,0x05,0x00,0xc1,0x16,0xaf,
+0xf0,0x00,0x00,0x03,0x7c,0xff,0xff,0xf0,0x00,0x06,0x4c,0x09,0x60,0x00,0x0b,0xff,
+0xff,0xfe,0xac,0x07,0x00,0x90,0xd8,0x30,0x09,0xf0,0x00,0x0b,0xf1,0x00,0x00,0x07,
+0x00,0x1b,0xe0,0x07,0x00,0xf0,0x03,0x3d,0xff,0xf0,0x03,0x6c,0xe0,0x00,0xcf,0xff,
+0xf0,0xaf,0xff,0xe0,0x00,0x5f,0xff,0x80,0xdf,0x67,0x01,0x50,0x21,0x00,0x2a,0xda,
+0x20,0x57,0x00,0xf1,0x3b,0x80,0x9c,0xcc,0xcc,0xcc,0x40,0x8f,0xdf,0xb7,0x77,0x77,
+0xfe,0xdf,0xd0,0xc7,0x00,0x00,0x0d,0x50,0xde,0x8e,0x70,0x00,0x00,0xdb,0x8e,0xe5,
+0xdb,0x77,0x77,0x7f,0x95,0xed,0x1c,0xeb,0xbb,0xbb,0xf6,0x1d,0xfc,0xf7,0x00,0x00,
+0x0d,0xdc,0xfd,0x0c,0x70,0x00,0x00,0xd5,0x0d,0xfa,0xe9,0x33,0x33,0x3e,0xca,0xfc,
+0x3d,0xff,0xff,0xff,0xf8,0x3c,0x35,0x52,0x05,0x55,0x55,0x55,0x3f,0xff,0xc6,0x16,
+0x06,0x20,0xfc,0x6f,0x05,0x00,0xcf,0xee,0x94,0xee,0xee,0xee,0xec,0x34,0x42,0x04,
+0x44,0x44,0x44,0x1a,0x00,0x14,0x30,0xfd,0xff,0xa4,0x06,0x00,0x01,0xf0,0x00,0x11,
+0x29,0xf1,0x00,0x21,0x2e,0xfc,0x06,0x00,0x31,0xff,0x90,0x50,0x06,0x00,0x20,0xaf,
+0xc0,0x06,0x00,0xf0,0x04,0x0c,0xff,0xc0,0x2e,0xff,0x90,0x00,0x1c,0xff,0xce,0xff,
+0x90,0x00,0x00,0x1c,0xff,0xff,0x90,0x00,0x07,0x00,0x11,0x90,0x34,0x02,0x22,0x90,
+0x00,0x01,0x00,0xf0,0x07,0x09,0xf5,0x00,0x06,0xf8,0xdf,0xf5,0x06,0xff,0xc2,0xef,
+0xf9,0xff,0xd1,0x02,0xef,0xff,0xd1,0x00,0x08,0xff,0xf7,0x2a,0x0a,0xf0,0x04,0xf5,
+0x06,0xff,0xe4,0xef,0xf5,0xef,0xe1,0x02,0xef,0xd4,0xa1,0x00,0x02,0xb4,0x00,0x00,
+0x02,0x50,0x31,0x00,0xf0,0x1e,0x20,0xbf,0x40,0x30,0x00,0x01,0xcf,0x1b,0xf4,0x7f,
+0x80,0x00,0xbf,0xd0,0xbf,0x45,0xff,0x40,0x4f,0xe1,0x0b,0xf4,0x07,0xfd,0x09,0xf8,
+0x00,0xbf,0x40,0x0e,0xf2,0xcf,0x40,0x0b,0xf4,0x00,0xbf,0x4b,0xf4,0x00,0x9e,0x30,
+0x0b,0xf4,0x9f,0x59,0x03,0x20,0xff,0x23,0x74,0x0a,0xc0,0x8f,0xc0,0x0a,0xfe,0x40,
+0x01,0x8f,0xf4,0x00,0x0c,0xff,0xed,0xac,0x01,0x40,0x07,0xef,0xff,0xc3,0x4f,0x00,
+0x21,0x12,0x10,0x87,0x00,0x11,0x21,0x06,0x00,0x20,0xff,0xf3,0xc2,0x01,0xc1,0x3f,
+0xff,0x70,0x11,0x00,0x7f,0xbf,0xff,0xff,0xce,0xb0,0x1f,0xf5,0x00,0xf1,0x14,0x53,
+0xff,0xff,0x82,0x5f,0xff,0xf7,0x03,0xff,0xc0,0x00,0x7f,0xf8,0x00,0x3f,0xfa,0x00,
+0x06,0xff,0x70,0x2c,0xff,0xf4,0x01,0xdf,0xfe,0x42,0xff,0xff,0xfe,0xff,0xff,0xf6,
+0x0a,0xff,0x10,0x01,0xb0,0x05,0x07,0xff,0xfa,0x13,0x20,0x00,0x00,0x0f,0xff,0x40,
+0x4e,0x00,0x21,0x46,0x50,0x55,0x00,0x30,0x25,0x00,0x36,0xbe,0x01,0x40,0x4f,0xfc,
+0x1a,0xf6,0x2a,0x09,0xf1,0x15,0xe9,0xfe,0xcf,0x60,0x00,0x00,0xaf,0xc3,0x64,0xff,
+0xf6,0x00,0x01,0xcf,0xa3,0xef,0xa3,0xdf,0x90,0x03,0xef,0x75,0xff,0xff,0xc3,0xcf,
+0xb0,0xdf,0x48,0xff,0xff,0xff,0xe3,0x9f,0x72,0x27,0xb4,0x07,0xe0,0x50,0x00,0x9f,
+0xff,0xcb,0xef,0xff,0x30,0x00,0x09,0xff,0xf1,0x07,0xff,0x0b,0x04,0xa1,0xff,0x10,
+0x7f,0xff,0x30,0x00,0x07,0xff,0xe0,0x06,0xd2,0x07,0x21,0x04,0x54,0x60,0x00,0x31,
+0x1f,0xff,0x10,0x3a,0x04,0x2d,0xff,0x20,0x07,0x00,0x50,0x47,0x8f,0xff,0x87,0x40,
+0x39,0x00,0x00,0x7c,0x01,0x00,0x7e,0x07,0x10,0xfa,0x1c,0x00,0xf2,0x08,0xaf,0xff,
+0xa0,0x00,0x00,0x46,0x66,0x3a,0xfa,0x36,0x66,0x50,0xff,0xff,0xf4,0x54,0xff,0xff,
+0xf2,0xff,0xff,0xff,0xcf,0x07,0x00,0x60,0xff,0xf3,0xb8,0xf2,0x9b,0xbb,0x01,0x00,
+0xa2,0xa0,0x00,0x08,0xaa,0xaa,0xaa,0xa4,0x00,0x00,0x08,0x43,0x08,0x20,0x03,0xfb,
+0x58,0x00,0x40,0xd0,0x00,0xdf,0x10,0xe3,0x03,0x30,0x80,0x8f,0x60,0x4c,0x00,0xf1,
+0x03,0xbf,0x3f,0xfe,0xee,0x40,0x00,0x9e,0xee,0xf9,0xff,0xff,0xfc,0x44,0x5f,0xff,
+0xff,0xaf,0xff,0x01,0x00,0x22,0xfa,0xff,0x01,0x00,0x12,0x9a,0x07,0x00,0x11,0xf5,
+0x19,0x03,0xf0,0x0f,0x07,0x90,0x00,0x6d,0xff,0xfb,0x40,0xcf,0x00,0xbf,0xfd,0xbd,
+0xff,0xac,0xf0,0xbf,0xd3,0x00,0x03,0xcf,0xff,0x4f,0xd1,0x00,0x07,0xaa,0xff,0xf9,
+0xf5,0x00,0x7c,0x05,0x72,0x01,0x00,0x00,0x00,0x11,0x11,0x10,0x1a,0x02,0x01,0xae,
+0x00,0xf3,0x0e,0x4f,0x9f,0xff,0xab,0x70,0x00,0x0d,0xf4,0xff,0xfb,0x20,0x00,0x3c,
+0xfb,0x0f,0xcb,0xff,0xca,0xcf,0xfc,0x10,0xfc,0x05,0xcf,0xff,0xd7,0x00,0x09,0x70,
+0xbd,0x01,0xe4,0x05,0x20,0x00,0x06,0xf7,0x01,0x16,0xff,0x8f,0xff,0xff,0xf8,0xff,
+0xff,0x07,0x00,0xe0,0x8a,0xcc,0xef,0xf8,0x00,0x02,0xef,0x80,0x00,0x02,0xe7,0x00,
+0x00,0x01,0x2f,0x01,0x10,0x20,0xb8,0x00,0xf0,0x02,0x70,0x00,0x01,0x16,0xff,0x80,
+0x00,0xef,0xff,0xff,0x82,0xb1,0xff,0xff,0xff,0x80,0xc9,0x05,0x00,0x10,0x9b,0x69,
+0x0b,0x90,0xf3,0xbd,0xdf,0xff,0x80,0x10,0x00,0x03,0xef,0x35,0x02,0x32,0x3e,0x70,
+0x00,0x36,0x00,0x07,0x01,0x00,0x22,0x04,0xc2,0x6d,0x00,0xa0,0x0b,0xe1,0x00,0x00,
+0x06,0xf7,0x00,0xb7,0x0c,0xb0,0x4b,0x00,0xb0,0x05,0xf5,0x2f,0x3f,0xff,0xff,0xf8,
+0x2c,0x17,0xd0,0xb8,0x4b,0x00,0xb1,0xba,0x2f,0x18,0xbf,0xff,0xff,0xf8,0x09,0xb1,
+0xf2,0x7b,0x55,0x00,0x30,0x5e,0x0a,0x9a,0x89,0x00,0x30,0x2e,0x80,0xe4,0x8d,0x00,
+0x40,0x0c,0xa0,0x8d,0x00,0x91,0x00,0x31,0x10,0x7f,0x30,0x5f,0x00,0x24,0x4f,0x40,
+0x36,0x04,0x11,0x9f,0x29,0x01,0x40,0x9f,0xf9,0xbf,0xff,0xaa,0x03,0x30,0x00,0xdf,
+0xff,0x4d,0x00,0x90,0x0d,0xff,0xf8,0xaf,0xff,0xff,0x9b,0xff,0xf8,0x1d,0x01,0x20,
+0x6d,0xf8,0x4d,0x08,0x20,0x40,0x17,0xc9,0x01,0x11,0xa0,0xc8,0x01,0x61,0xfd,0xaa,
+0xaa,0xaa,0xaa,0xad,0x6c,0x01,0x00,0x2c,0x01,0x10,0x40,0xe0,0x00,0x80,0x50,0x00,
+0x00,0x0c,0xfb,0x00,0x00,0x03,0x31,0x02,0x80,0xdf,0xff,0xc0,0x00,0x8f,0xff,0xff,
+0x70,0x05,0x0a,0xf0,0x09,0x2a,0xff,0xff,0xff,0xf9,0xef,0xef,0xff,0xff,0xdf,0xb7,
+0xff,0xff,0xfe,0xce,0x2d,0xff,0xff,0xb5,0xfc,0x36,0xff,0xf3,0x07,0xb9,0x04,0xf0,
+0x11,0x02,0x89,0x72,0x00,0x06,0x40,0x00,0x02,0x42,0xfa,0x00,0x03,0xef,0x2f,0xa0,
+0x04,0xff,0xf2,0xfa,0x05,0xff,0xff,0x2f,0xa6,0xff,0xff,0xf2,0xfe,0xff,0xff,0xff,
+0x2f,0xff,0x01,0xf1,0x07,0xfc,0xdf,0xff,0xff,0x2f,0xa1,0xdf,0xff,0xf2,0xfa,0x01,
+0xcf,0xff,0x2f,0xa0,0x00,0xbf,0xf2,0xf9,0x00,0x00,0x9c,0xbd,0x00,0x11,0x24,0x06,
+0x00,0x22,0xef,0xc3,0xb5,0x01,0x11,0x91,0x06,0x00,0x21,0xff,0x70,0x06,0x00,0x31,
+0xfd,0x40,0x00,0x9d,0x00,0x12,0x10,0x87,0x0a,0x11,0xff,0x61,0x02,0x10,0xff,0x65,
+0x06,0x11,0x50,0xe1,0x00,0x00,0x1e,0x00,0x10,0xb2,0x2a,0x00,0x10,0xd4,0x36,0x00,
+0x10,0xf7,0x42,0x00,0x11,0x48,0xd4,0x01,0xff,0x03,0x26,0x66,0x10,0x16,0x66,0x30,
+0xef,0xff,0xc0,0xaf,0xff,0xf1,0xff,0xff,0xe0,0xbf,0xff,0xf2,0x06,0x00,0x19,0xf0,
+0x02,0xd0,0xbf,0xff,0xf2,0xaf,0xff,0x80,0x6e,0xff,0xc0,0x26,0x66,0x66,0x66,0x66,
+0x50,0xef,0x6d,0x00,0x11,0xf4,0x7e,0x00,0x1f,0xf6,0x06,0x00,0x1c,0x11,0xf5,0xd2,
 0x02,0xf3,0x09,0xd1,0x05,0x00,0x00,0x06,0x45,0xfb,0x00,0x01,0xfc,0x6f,0xfc,0x10,
 0x1f,0xc6,0xff,0xfd,0x11,0xfc,0x6f,0xff,0xfd,0x3f,0xc6,0x12,0x05,0x00,0x1d,0x05,
-0xf4,0x05,0xfa,0xfc,0x6f,0xff,0xf7,0x1f,0xc6,0xff,0xf6,0x01,0xfc,0x6f,0xf5,0x00,
-0x1f,0xc3,0xe4,0x00,0x00,0xfb,0x3a,0x02,0x21,0x52,0x00,0xb0,0x01,0x30,0xe2,0x00,
-0x00,0x8d,0x03,0x20,0xd1,0x00,0xa3,0x18,0x00,0x07,0x00,0x00,0x3b,0x00,0x30,0xc0,
-0x00,0x5f,0x62,0x00,0x21,0xb0,0x0e,0x6f,0x00,0x90,0x40,0x8e,0xee,0xee,0xee,0xee,
-0xc1,0x02,0x44,0x01,0x00,0x12,0x00,0x82,0x00,0x11,0x0f,0x07,0x00,0x30,0x60,0xcf,
-0xff,0x1e,0x04,0x01,0x63,0x06,0x00,0x87,0x18,0xa1,0x00,0xbf,0xf2,0x00,0x0b,0xff,
-0x30,0x00,0xbf,0xf3,0x07,0x00,0x20,0x2f,0xf9,0x74,0x07,0x54,0x80,0x00,0x00,0x6f,
-0xf8,0x09,0x00,0x50,0xf4,0x00,0x00,0x05,0xb0,0xc4,0x02,0xb2,0x1e,0xc0,0x00,0x00,
-0x1e,0xfc,0x00,0x00,0x02,0xef,0xc0,0xab,0x05,0x01,0x09,0x00,0x20,0x7f,0xf4,0xc8,
-0x04,0x31,0x00,0x6f,0xf7,0x07,0x00,0x00,0x8f,0x19,0x20,0x0a,0x70,0xa1,0x00,0x11,
-0x17,0x94,0x02,0x2f,0x8f,0xe0,0x06,0x00,0x01,0x15,0xdf,0xc1,0x01,0x8f,0xff,0xf5,
-0x36,0x66,0xbf,0xf6,0x66,0x50,0x2a,0x00,0x01,0x20,0x4d,0x90,0x4e,0x14,0x39,0x11,
-0x11,0x11,0x30,0x00,0xc0,0x35,0x55,0x55,0x55,0x55,0x40,0x00,0x00,0x5a,0xcd,0xc8,
-0x20,0xae,0x13,0xf3,0x33,0xd7,0x69,0xff,0x90,0x00,0x04,0xff,0xa0,0x01,0x02,0xef,
-0xc1,0x02,0xff,0xf1,0x02,0xfc,0x16,0xff,0xb0,0xcf,0xfb,0x05,0xaf,0xf9,0x1f,0xff,
-0x6d,0xff,0xb1,0xff,0xff,0xb1,0xff,0xf7,0x4f,0xfe,0x0b,0xff,0xf5,0x5f,0xfc,0x00,
-0x6f,0xf9,0x08,0xa5,0x1d,0xfd,0x20,0x00,0x5e,0xfb,0x53,0x6e,0xfb,0x10,0x00,0x00,
-0x07,0xce,0xfe,0xa4,0x00,0x00,0x32,0x5e,0x01,0x23,0x0e,0xf5,0x09,0x00,0xe0,0x3e,
-0xf9,0x05,0xac,0xdb,0x71,0x00,0x00,0x00,0x1b,0xff,0xfd,0x76,0xaf,0x4e,0x02,0xf0,
-0x20,0x08,0xff,0x31,0x30,0x4f,0xfa,0x00,0x00,0x32,0x04,0xef,0xbf,0xc0,0x9f,0xf8,
-0x00,0x0e,0xf5,0x02,0xcf,0xff,0x64,0xff,0xf3,0x01,0xff,0xf6,0x00,0x9f,0xf8,0x4f,
-0xff,0x40,0x06,0xff,0xc0,0x00,0x6f,0xeb,0xff,0xa0,0x00,0x09,0xff,0x60,0x00,0x3e,
-0xc9,0x1a,0x50,0x07,0xff,0xa4,0x30,0x1b,0x65,0x00,0x73,0x02,0x8d,0xff,0x80,0x08,
-0xfe,0x30,0xfc,0x03,0x32,0xef,0x20,0x00,0x49,0x10,0x01,0x19,0x04,0x03,0xb7,0x03,
-0x22,0x0d,0xf8,0x08,0x00,0x12,0x7f,0x75,0x05,0x21,0x01,0xff,0x99,0x03,0x00,0x69,
-0x05,0x01,0x55,0x0c,0x31,0x3f,0xf5,0x1a,0x25,0x07,0xf0,0x06,0xcf,0xf4,0x0a,0xff,
-0x60,0x00,0x00,0x05,0xff,0xf5,0x0a,0xff,0xe1,0x00,0x00,0x0e,0xff,0xf6,0x0b,0xff,
-0xf9,0x04,0x02,0x10,0xfd,0x3e,0x17,0xf2,0x02,0x02,0xff,0xff,0xf3,0x09,0xff,0xff,
-0xb0,0x0a,0xff,0xff,0xf7,0x1c,0xff,0xff,0xf4,0x0e,0x34,0x05,0x40,0xf8,0x04,0x9a,
-0xaa,0x01,0x00,0x11,0x91,0x5a,0x00,0x21,0x70,0x00,0x51,0x00,0x50,0xa0,0xef,0xfa,
-0x00,0x05,0x66,0x05,0xf0,0x02,0xf9,0x04,0xff,0xff,0xfb,0x11,0x3f,0xa4,0xff,0x84,
-0xfc,0x00,0x00,0x33,0xff,0x90,0x19,0xd5,0x01,0xd0,0xa2,0x01,0x70,0x00,0x02,0xef,
-0xa4,0xf6,0x3f,0xa0,0xef,0xff,0xb0,0x8d,0x05,0x00,0xdd,0x00,0x20,0xff,0xfb,0x51,
-0x05,0x21,0x14,0xfc,0x41,0x00,0x15,0x19,0xd6,0x04,0x20,0x5f,0xa0,0xcd,0x04,0x01,
-0x11,0x06,0x40,0x5f,0xfa,0xff,0xa0,0xa3,0x21,0xf0,0x01,0x3f,0xfa,0x00,0x4f,0xf9,
-0x00,0x03,0xff,0xa0,0xbf,0x90,0x00,0x00,0x3f,0xf1,0x15,0xdd,0x0e,0x21,0x30,0x01,
-0x9f,0x04,0xf0,0x08,0x9f,0x50,0x00,0x00,0x1d,0xe1,0x8f,0xf5,0x00,0x01,0xdf,0xd0,
-0x08,0xff,0x50,0x1d,0xfd,0x10,0x00,0x8f,0xf6,0xdf,0xd1,0x61,0x01,0x20,0xfd,0x10,
-0xf8,0x01,0x02,0x0c,0x14,0x10,0x10,0xf4,0x1c,0x13,0x10,0x14,0x01,0x21,0xfd,0x18,
-0xe2,0x03,0xf0,0x00,0x6f,0xff,0xfd,0x4a,0xaa,0xaa,0xfb,0x00,0x0c,0xda,0xf7,0xf4,
-0x00,0x00,0x0e,0xfa,0x09,0x00,0x72,0x14,0x00,0x54,0x12,0x23,0xf1,0x00,0x11,0x00,
-0xc0,0x10,0x00,0x02,0xe6,0xeb,0x9d,0x00,0x09,0xf9,0x99,0x99,0x4d,0x44,0x01,0x52,
-0x7f,0xff,0xff,0xfb,0x1d,0x4c,0x01,0x10,0x00,0x81,0x17,0x05,0x01,0x00,0x40,0x6b,
-0xcc,0xc7,0x00,0x60,0x07,0x42,0xff,0xf8,0x22,0x22,0x54,0x04,0x00,0xb8,0x06,0x0f,
-0x01,0x00,0x11,0x05,0x26,0x05,0x02,0x1d,0x18,0x01,0x0c,0x1c,0x01,0x88,0x03,0x21,
-0x80,0x00,0xe2,0x06,0x11,0xf8,0xc7,0x01,0x01,0xb8,0x04,0x5f,0x69,0x9f,0xff,0x99,
-0x60,0x52,0x07,0x03,0x50,0x46,0x66,0x2f,0xff,0x26,0x36,0x07,0x30,0x46,0x76,0x4f,
-0x69,0x04,0x2e,0xfc,0xbc,0x36,0x07,0x14,0x00,0x85,0x16,0x22,0x00,0x01,0x70,0x07,
-0x31,0x07,0xff,0xff,0xa7,0x02,0x02,0x32,0x09,0x12,0x0c,0x15,0x00,0x32,0x00,0xbf,
-0xf6,0x07,0x00,0x00,0x05,0x01,0x01,0xb1,0x03,0xf0,0x04,0x01,0x50,0x00,0x4f,0xfd,
-0x00,0x03,0xaf,0xf8,0x07,0xff,0xf2,0x00,0x0e,0xff,0xff,0xef,0xfe,0x30,0x37,0x0a,
-0x21,0xff,0xc2,0xa0,0x00,0x01,0x1d,0x17,0x21,0x98,0x62,0x67,0x01,0x10,0x84,0xc5,
-0x01,0xf1,0x05,0x8f,0xff,0x60,0x00,0xaf,0xf3,0xec,0x2e,0xc0,0x1c,0xff,0xa0,0xde,
-0x9f,0xd1,0xdf,0xfa,0x00,0x3e,0xff,0x80,0x02,0x31,0x2d,0xff,0xfa,0x68,0x09,0x10,
-0xf7,0x0b,0x00,0x00,0x41,0x0f,0xf0,0x0f,0xcf,0xaf,0xd2,0xef,0xf6,0x00,0xfb,0x0d,
-0xd0,0x2e,0xff,0x60,0xbf,0xef,0x80,0x02,0xef,0xf3,0x19,0xc8,0x00,0x00,0x16,0x40,
-0x00,0x02,0x66,0x66,0x12,0x00,0x64,0x00,0xf1,0x01,0x3f,0x40,0x00,0x0c,0xff,0xff,
-0x3f,0xf2,0xdf,0x6c,0xff,0xff,0x53,0x31,0xff,0x7c,0xfe,0x04,0x0f,0x06,0x00,0x0b,
-0x10,0x7b,0xd3,0x03,0x71,0xff,0xc2,0x33,0x33,0x33,0x20,0xff,0xd6,0x13,0xc2,0x8a,
-0xaa,0xaa,0xa9,0x00,0x00,0x49,0x99,0x99,0x99,0x60,0x00,0xc4,0x06,0x01,0x9c,0x1d,
-0x20,0x80,0xfa,0x1c,0x06,0x11,0xf3,0x06,0x00,0x72,0xf5,0xfe,0xaa,0xaa,0xaa,0xff,
-0xf5,0x0f,0x04,0x40,0xff,0xff,0x80,0x4f,0x06,0x00,0x20,0x10,0x0c,0x06,0x00,0x20,
-0x50,0x1e,0x06,0x00,0x51,0xfb,0xef,0xff,0xf5,0x9f,0x70,0x05,0x74,0xcd,0xdd,0xdd,
-0xdd,0xdd,0xd4,0xef,0x3d,0x08,0x05,0x01,0x00,0x7f,0xbc,0xcc,0xcc,0xcc,0xcc,0xc3,
-0xff,0x18,0x00,0x10,0x10,0x6b,0x12,0x00,0x22,0xcb,0x6f,0xfe,0x01,0x02,0x5e,0x07,
-0x11,0x95,0x0e,0x00,0x70,0x65,0xf9,0x3d,0xff,0xff,0xfd,0x39,0x03,0x00,0x20,0xf9,
-0x3d,0x10,0x00,0x11,0xa4,0x17,0x00,0x2c,0xb7,0xbf,0x2b,0x02,0x80,0x55,0x55,0x20,
-0x00,0x03,0xff,0xff,0x90,0x72,0x03,0x10,0x40,0x84,0x01,0x00,0xda,0x03,0x40,0xfc,
-0x44,0x40,0x0c,0xd2,0x0b,0x12,0x0e,0xa0,0x07,0x01,0x76,0x0d,0x20,0x8f,0xf6,0xc9,
-0x01,0x10,0xc0,0xc3,0x06,0x10,0x30,0xe6,0x1c,0x00,0xf4,0x01,0x10,0xf1,0x3e,0x03,
-0x14,0x50,0x9f,0x00,0xb0,0x35,0x6e,0xf7,0x54,0x00,0x00,0xff,0xf9,0x8f,0xff,0x10,
-0x1d,0x01,0x00,0x06,0x00,0xb0,0xfa,0x24,0x44,0x01,0x00,0xff,0xf4,0xef,0xff,0x3e,
-0x20,0x9b,0x06,0x20,0x3f,0xe2,0x06,0x00,0x21,0x43,0x31,0xa7,0x06,0x18,0xf6,0x06,
-0x00,0x22,0x23,0x30,0x74,0x12,0x02,0x06,0x00,0x72,0x7a,0xaa,0xaa,0xa2,0x00,0x00,
-0x03,0xfa,0x09,0x20,0x70,0x00,0xc9,0x0a,0x21,0xfa,0x10,0x50,0x06,0x40,0xd0,0x00,
-0x01,0xff,0x16,0x10,0x10,0x04,0xdb,0x17,0x21,0x00,0x07,0x92,0x0a,0x01,0xb6,0x17,
-0x21,0x00,0x0d,0x43,0x12,0x11,0x7f,0xb6,0x0d,0x02,0x0b,0x07,0x20,0x13,0x33,0xb9,
-0x01,0x41,0x00,0x00,0xcf,0xf2,0xc4,0x0b,0x51,0x50,0x00,0x00,0x5a,0xaa,0x01,0x00,
-0x12,0x2f,0x03,0x01,0xf0,0x1a,0xf9,0xfa,0x0d,0x01,0xb0,0xd0,0xa2,0x0f,0xaf,0xeb,
-0xfb,0xcf,0xbf,0xbe,0xcb,0xfa,0xff,0xe1,0x98,0x1c,0x1c,0x15,0xff,0xaf,0xfd,0x08,
-0x70,0xb0,0xb0,0x3f,0xfa,0xff,0xdf,0xdd,0xdd,0xdd,0xfd,0xdf,0xaf,0xa0,0xd0,0x1b,
-0x19,0xa8,0xfa,0xfe,0xaf,0xaa,0xaa,0xaa,0xeb,0xaf,0x9a,0xff,0x80,0x01,0x12,0x41,
-0x66,0x12,0x20,0xef,0xd0,0x09,0x03,0x11,0x8f,0x18,0x1b,0x70,0x29,0xff,0xff,0xff,
-0x50,0x00,0x03,0x69,0x01,0x10,0xe0,0xc7,0x13,0x00,0xae,0x00,0x00,0xdd,0x06,0x00,
-0x45,0x01,0x12,0x9e,0x10,0x08,0x00,0x8f,0x04,0x00,0xa6,0x13,0x00,0x9c,0x04,0x03,
-0xf3,0x13,0x02,0x7f,0x03,0x13,0x05,0x0f,0x04,0x22,0x4f,0xf3,0x5f,0x00,0x70,0x76,
-0x00,0x00,0x00,0x34,0x44,0x43,0x4f,0x01,0x20,0xfb,0x8a,0x05,0x00,0xc1,0x8f,0xa0,
-0xff,0xff,0xfb,0x7f,0xf8,0xff,0xff,0xfc,0x11,0x11,0xaa,0x0c,0x0f,0x05,0x00,0x10,
-0x50,0xbd,0xdd,0xdd,0xdd,0xd8,0x9f,0x01,0x22,0x54,0x10,0xd9,0x14,0xf0,0x17,0xff,
-0xff,0xd8,0x10,0x00,0x04,0xef,0xff,0xdb,0xbc,0xff,0xff,0x70,0x08,0xff,0xd6,0x10,
-0x00,0x00,0x4b,0xff,0xb0,0xbf,0x70,0x00,0x13,0x32,0x00,0x05,0xed,0x10,0x30,0x06,
-0xdf,0xff,0xfe,0x80,0x01,0xa1,0x25,0x40,0xfc,0xce,0xff,0xd2,0x69,0x0f,0x50,0x60,
-0x00,0x04,0xde,0x10,0x23,0x05,0x22,0x03,0x40,0xfc,0x0d,0x11,0x04,0xc6,0x00,0x00,
-0x8b,0x09,0x22,0xfa,0x00,0x06,0x04,0x10,0xac,0x72,0x04,0x03,0x19,0x0b,0x31,0xd2,
-0x0f,0xea,0x68,0x01,0xc1,0xcf,0x90,0xfa,0x48,0x88,0x88,0x88,0x88,0x65,0xff,0x1f,
-0xa9,0x3d,0x0c,0x32,0x1a,0xf1,0xfa,0xfa,0x02,0xc0,0xaf,0x1f,0xa5,0x99,0x99,0x99,
-0x99,0x98,0x5f,0xf1,0xfd,0x99,0x01,0x00,0x33,0x9b,0xfa,0x0b,0x98,0x02,0x06,0x24,
-0x1c,0x0f,0x4d,0x00,0x03,0x22,0x30,0x05,0x4d,0x00,0x23,0xf7,0x00,0x4d,0x00,0x22,
-0x70,0x01,0x4d,0x00,0x2f,0x94,0x00,0x4d,0x00,0x1e,0x22,0x00,0x00,0x4d,0x00,0x23,
-0xf0,0x00,0x4d,0x00,0x22,0x00,0x00,0x4d,0x00,0x2f,0x90,0x00,0x4d,0x00,0x1d,0x23,
-0x85,0x00,0x4d,0x00,0x22,0xa0,0x00,0x4d,0x00,0x23,0xfa,0x00,0x4d,0x00,0x2f,0x60,
-0x00,0x4d,0x00,0x1d,0x12,0x00,0x0b,0x02,0x00,0xcc,0x11,0x02,0x4d,0x00,0x02,0x62,
-0x01,0x13,0xaf,0x11,0x00,0x0f,0x4d,0x00,0x09,0x00,0x01,0x00,0x23,0x5c,0x50,0x95,
-0x02,0x12,0xfc,0x3f,0x1a,0x11,0xd0,0x11,0x00,0x31,0x64,0x00,0xa5,0x56,0x09,0xf0,
-0x0a,0xbf,0xf6,0x4e,0x21,0x11,0x11,0x17,0xd3,0x0f,0xff,0xec,0xce,0xec,0xcc,0xcc,
-0xef,0xe1,0x7f,0xe3,0x00,0x2d,0x00,0x00,0x06,0x80,0xd9,0x01,0x32,0x97,0x0a,0xa6,
-0x44,0x00,0x14,0xcc,0x98,0x06,0x29,0x2f,0xfa,0x5c,0x00,0x20,0x01,0x10,0x89,0x00,
-0xf0,0x38,0xff,0xe8,0x00,0x00,0xdf,0xf8,0xcf,0xf8,0x00,0x7f,0xff,0x81,0xdf,0xf1,
-0x0c,0xfa,0xf8,0x52,0xdf,0x60,0xff,0x64,0x78,0x3a,0xf8,0x0f,0xff,0x50,0x08,0xff,
-0xa1,0xff,0xff,0x12,0xff,0xfa,0x0f,0xff,0x41,0x15,0xff,0xa0,0xef,0x46,0x88,0x48,
-0xf8,0x0b,0xfc,0xf8,0x42,0xef,0x50,0x5f,0xff,0x82,0xef,0xf1,0x00,0xaf,0xfa,0xef,
-0xf6,0x00,0x00,0x5a,0xdc,0xa4,0x00,0x00,0x01,0x8e,0x1c,0x62,0x78,0x8b,0xff,0xfe,
-0x88,0x82,0x53,0x03,0x71,0x12,0x22,0x22,0x22,0x22,0x20,0x3f,0x84,0x1b,0xbf,0x3f,
-0xfc,0xfc,0xfe,0xdf,0x90,0x3f,0xd5,0xf4,0xeb,0x7f,0x06,0x00,0x07,0x61,0xe6,0xf5,
-0xec,0x8f,0x90,0x2f,0x54,0x03,0x52,0x07,0x9a,0xaa,0xaa,0xa9,0x95,0x07,0x12,0x14,
-0xf7,0x00,0x22,0xef,0xa0,0x89,0x06,0x10,0xf9,0x0d,0x00,0x30,0xc3,0xdf,0xff,0x3b,
-0x09,0x30,0xfd,0x3d,0xf5,0x1a,0x00,0x40,0xff,0xd3,0x50,0x00,0x49,0x06,0x02,0x0d,
-0x00,0x21,0xff,0x60,0x0d,0x00,0x15,0xf6,0x0d,0x00,0x12,0x0b,0xe8,0x10,0x11,0x0d,
-0x0d,0x00,0x22,0x00,0x0f,0xf5,0x10,0x23,0x08,0x86,0x66,0x01,0x10,0x8b,0x73,0x05,
-0x14,0xb6,0xb8,0x01,0xf0,0x0d,0xf2,0x00,0xbf,0xff,0xf8,0xbf,0xf6,0xef,0xff,0x40,
-0xbf,0xff,0xff,0x10,0xa4,0x09,0xff,0xf4,0xaf,0xff,0xff,0xfd,0x10,0x07,0xff,0xff,
-0x4d,0xff,0x21,0x09,0xf3,0x07,0xbf,0xff,0xf4,0x1d,0xff,0xff,0xf4,0x06,0x10,0xbf,
-0xff,0x40,0x1d,0xff,0xff,0x47,0xfd,0x2b,0xff,0xf4,0x00,0x1d,0xb7,0x01,0x00,0x2f,
-0x10,0x01,0xcf,0x06,0x50,0x08,0x99,0x99,0x70,0x00,0x52,0x0d,0x60,0x0a,0xd0,0xd0,
-0xd0,0xeb,0x9f,0x05,0x00,0x60,0xff,0xd1,0xd1,0xd1,0xeb,0xff,0xe6,0x04,0x0f,0x05,
-0x00,0x0b,0x10,0xef,0xc6,0x05,0x52,0x5c,0xdd,0xdd,0xdd,0xb2,0x9f,0x00,0x10,0xb0,
-0x37,0x05,0x00,0xd0,0x20,0x20,0x9f,0x10,0x28,0x24,0x72,0x0a,0xff,0x21,0x11,0x11,
-0x1f,0xf0,0xad,0x00,0x12,0xf0,0x22,0x06,0x21,0xd0,0x08,0x4d,0x0f,0x00,0x6b,0x1f,
-0x02,0xd5,0x01,0x1d,0x00,0x01,0x00,0x2f,0xfa,0x00,0x01,0x00,0x2d,0x13,0xfc,0x08,
-0x00,0x17,0xf4,0x14,0x00,0x7e,0xfb,0xfa,0x00,0xfe,0xf7,0x00,0xf7,0x73,0x00,0x0f,
-0x01,0x00,0x1c,0x4f,0x02,0x04,0x00,0x02,0x40,0x00,0x29,0x2f,0xe3,0x00,0x01,0x00,
-0x3f,0x1f,0xe7,0x48,0x00,0x34,0x03,0x30,0x01,0xb2,0xf8,0x00,0xfe,0x00,0x00,0xf4,
-0xfe,0xf8,0xfc,0x00,0xf1,0x3b,0x01,0x7f,0xff,0x00,0x00,0xfe,0xff,0xfb,0xfd,0x3a,
-0x01,0x28,0x3f,0xfd,0x00,0xfe,0xd9,0x01,0x2e,0x1c,0xfd,0x0a,0x00,0x19,0xff,0x1f,
-0x00,0x1f,0xfe,0xee,0x00,0x21,0x00,0x35,0x00,0x7f,0xf7,0x00,0xfe,0x00,0xfe,0xfc,
-0xfe,0x44,0x01,0x34,0x15,0x02,0x90,0x00,0x11,0xfe,0x5e,0x00,0x2f,0xfe,0xfd,0x5a,
-0x00,0x21,0x00,0x34,0x23,0x35,0xed,0x00,0xeb,0x4e,0x00,0x20,0xfd,0xfe,0x4a,0x00,
-0x01,0x55,0x00,0x0f,0x98,0x00,0x28,0x20,0xfd,0x00,0x47,0x1e,0x0f,0xe6,0x00,0x31,
-0x1f,0xfe,0xbd,0x02,0x37,0x19,0xef,0xdb,0x01,0x01,0x0c,0x00,0x10,0xfd,0x62,0x00,
-0x2f,0xfc,0xfa,0x5a,0x03,0x23,0x00,0x6b,0x1f,0x76,0x00,0xeb,0xfe,0xeb,0xf7,0x00,
-0xe4,0x1c,0x00,0x3f,0xff,0xf4,0xfb,0x9b,0x00,0x20,0x20,0xd7,0x00,0xbd,0x1f,0x12,
-0xed,0x05,0x03,0x30,0x00,0xfc,0x00,0xa5,0x07,0x00,0xa8,0x07,0x0f,0x02,0x04,0x2b,
-0x10,0xfd,0xce,0x01,0x1f,0xfc,0x3f,0x01,0x35,0x10,0xfb,0x8c,0x01,0x0f,0xdd,0x00,
-0x21,0x09,0x6f,0x05,0xc0,0xe6,0xe4,0x00,0x00,0xf4,0xfd,0xea,0xfe,0x02,0x00,0x02,
-0x02,0xde,0x00,0xdf,0xef,0xf7,0x00,0xf7,0xeb,0xf9,0xf8,0x00,0xf9,0xf8,0xfb,0xf8,
-0xfa,0x6a,0x02,0x1e,0x66,0xea,0xf0,0x00,0x00,0xf8,0xff,0x11,0x00,0x50,0xfb,0xfc,
-0x00,0x00,0xfb,0xd8,0x01,0x18,0xff,0x21,0x03,0x0f,0x4e,0x00,0x15,0x00,0x84,0x08,
-0x16,0xfc,0xb8,0x05,0x33,0x01,0xfd,0xfd,0x10,0x03,0x1f,0x00,0xcd,0x05,0x22,0x14,
-0xf0,0x70,0x02,0x15,0x01,0x70,0x02,0x02,0xa8,0x03,0x0f,0xc9,0x01,0x1f,0xf0,0x0a,
-0x02,0xfb,0xe9,0xf1,0x00,0x00,0xf1,0xfd,0xf6,0xfe,0x02,0xf6,0x02,0x02,0x01,0x02,
-0x00,0x02,0xfa,0xf9,0xfe,0xfc,0xf9,0xfc,0xfa,0x4f,0x04,0x3f,0xfe,0xfd,0x02,0xc6,
-0x01,0x19,0x05,0xe6,0x08,0x1a,0xfd,0x67,0x03,0x02,0x9c,0x00,0x1f,0xfd,0xaa,0x03,
-0x29,0x1f,0xfe,0xee,0x03,0x4a,0x0f,0x5e,0x00,0x1e,0x0f,0xcc,0x00,0x0a,0x1f,0xff,
-0xe3,0x04,0x1d,0x1f,0xff,0x4a,0x07,0x3a,0x1f,0xff,0x6b,0x00,0x3a,0x1e,0x02,0xed,
-0x02,0x19,0x02,0x30,0x01,0x0f,0x0c,0x03,0x1a,0x1f,0xf8,0x3a,0x08,0x40,0x0f,0xd7,
-0x05,0x35,0x1f,0xf7,0x56,0x00,0x0b,0x2f,0xfe,0xfe,0xac,0x06,0x1e,0x1c,0xee,0x36,
-0x02,0x20,0xfe,0x02,0x06,0x04,0x10,0x05,0xa1,0x04,0x0f,0x01,0x00,0x33,0x1f,0xfd,
-0x48,0x07,0x26,0x1c,0xef,0xe1,0x00,0x2f,0xff,0x01,0x65,0x03,0x28,0x1f,0xf3,0xd4,
-0x01,0x4e,0x1f,0xfc,0x4e,0x00,0x3a,0x1f,0xfe,0x43,0x00,0x6f,0x0f,0x01,0x00,0x11,
-0x10,0x08,0xc5,0x11,0xba,0xfd,0xfd,0xfb,0xf6,0xf8,0xfb,0x00,0xf0,0xfb,0x00,0x03,
-0xef,0x01,0x04,0x52,0x05,0x1f,0x03,0x7c,0x03,0x15,0x30,0xfb,0xfd,0xfb,0x37,0x00,
-0x7f,0xfb,0xfb,0xfd,0xfb,0xf8,0xfb,0xfb,0x4d,0x02,0x2b,0xee,0xf6,0xfd,0xf8,0xfd,
-0xfb,0x00,0xfb,0x00,0xf8,0xf8,0xf8,0xfb,0xf8,0xf8,0xbe,0x07,0x00,0xe1,0x06,0x1f,
-0xf8,0x40,0x02,0x17,0x10,0xfb,0x40,0x06,0x15,0xfd,0x83,0x00,0x10,0xfd,0x5a,0x00,
-0x10,0xf5,0x67,0x00,0x30,0xf8,0xfb,0xf6,0x36,0x04,0x12,0xf8,0xc2,0x00,0x1f,0xf8,
-0x53,0x00,0x15,0x13,0x03,0x07,0x00,0x06,0x53,0x00,0x35,0x03,0x00,0x05,0x19,0x00,
-0x1f,0x03,0x88,0x01,0x1c,0x11,0x03,0x92,0x00,0x21,0x05,0x05,0x0a,0x00,0x1f,0x03,
-0x80,0x03,0x2c,0x11,0xfb,0xea,0x00,0x40,0xfb,0xf8,0xf8,0xfb,0x93,0x01,0x0f,0x24,
-0x02,0x30,0x00,0x88,0x00,0x40,0x05,0x05,0xfd,0x00,0x7e,0x41,0x0a,0x12,0x02,0x0f,
-0x28,0x0b,0x2c,0x1f,0x05,0xcd,0x02,0x3a,0x1e,0x03,0x6e,0x02,0x0f,0xa1,0x00,0x18,
-0x33,0xfb,0xfd,0xfd,0x2d,0x01,0x00,0x37,0x01,0x02,0x39,0x00,0x1f,0xfb,0xe4,0x00,
-0x26,0x70,0xee,0xf3,0xfd,0xfd,0xf3,0xfd,0xfd,0x56,0x00,0x22,0xfd,0xf8,0xd9,0x09,
-0x01,0x84,0x02,0x0a,0xc8,0x08,0x0f,0x5e,0x00,0x14,0x00,0x3f,0x00,0x10,0xfd,0x5c,
-0x03,0x00,0x09,0x00,0x33,0xf8,0xfb,0xfd,0xa8,0x03,0x19,0x03,0x0e,0x0c,0x1f,0xfd,
-0x0c,0x03,0x18,0x11,0x05,0x24,0x02,0x03,0x2f,0x07,0x11,0xfd,0xf0,0x00,0xb0,0xf6,
-0x00,0x00,0xf8,0xf3,0xf5,0x00,0xf3,0xfd,0xf8,0xf3,0x07,0x03,0x01,0x52,0x00,0x1f,
-0xfb,0x2b,0x0a,0x12,0x24,0xf5,0x00,0x67,0x02,0x10,0xf8,0x4d,0x00,0x00,0x79,0x02,
-0xc4,0xf3,0xf3,0xfd,0xf6,0xf8,0xf3,0xf6,0xf8,0xf3,0xf8,0xf8,0xf3,0xf1,0x00,0x2f,
-0xf8,0xf6,0xea,0x00,0x12,0x14,0xf5,0x8b,0x03,0x21,0xf8,0xfd,0xa5,0x03,0x0e,0xfd,
-0x09,0x0f,0xc1,0x06,0x1e,0x13,0xfb,0xe0,0x03,0x1f,0xfb,0x1f,0x02,0x29,0x0f,0x19,
-0x03,0x05,0x0b,0x11,0x03,0x0f,0xbe,0x02,0x36,0x0f,0xf4,0x03,0x1d,0x30,0xfd,0xf8,
-0xfb,0x1a,0x02,0x8f,0xfb,0xeb,0x00,0x00,0xf5,0xf0,0xf8,0xf8,0x31,0x0d,0x2d,0x14,
-0xfb,0x5c,0x05,0x25,0xfd,0xfb,0x07,0x03,0x1f,0x03,0x86,0x01,0x24,0x34,0xfb,0xfb,
-0xfb,0x69,0x02,0x34,0x00,0xf8,0xfd,0xcf,0x01,0x0e,0x4e,0x00,0x0f,0x3f,0x01,0x37,
-0x1f,0xfb,0x2e,0x0e,0x2c,0x01,0xb9,0x03,0x03,0x87,0x0e,0x00,0x0c,0x01,0x0f,0x5f,
-0x03,0x1a,0x0c,0x41,0x07,0x01,0x8b,0x0d,0x11,0xfd,0x89,0x02,0x11,0xfd,0xc0,0x03,
-0x0f,0x78,0x02,0x29,0x13,0xf8,0xdf,0x00,0x03,0x01,0x10,0x0f,0x38,0x01,0x37,0x01,
-0xdf,0x01,0x0f,0x54,0x00,0x28,0x05,0x4f,0x03,0x12,0xfd,0xf9,0x00,0x0e,0x3f,0x04,
-0x0f,0x95,0x00,0x1d,0x02,0x92,0x00,0x03,0xed,0x00,0x0f,0xd4,0x01,0x29,0x26,0xfd,
-0xfb,0x92,0x00,0x01,0xce,0x02,0x04,0x86,0x01,0x0f,0x3a,0x01,0x2e,0x16,0xfd,0x7c,
-0x05,0x1f,0xfd,0x38,0x01,0x28,0x1a,0xfd,0xc7,0x05,0x0f,0xea,0x00,0x28,0x18,0xfd,
-0x8c,0x01,0x00,0x4e,0x00,0x0f,0xe6,0x04,0x2d,0x17,0xfd,0x0c,0x03,0x10,0xfb,0x0c,
-0x03,0x0e,0x6b,0x06,0x0f,0x5a,0x03,0x23,0x01,0x13,0x03,0x0f,0x4e,0x00,0x27,0x0b,
-0xaa,0x0a,0x04,0xa0,0x00,0x0f,0xea,0x0c,0x2a,0x07,0xd1,0x01,0x1f,0x05,0x34,0x0d,
-0x2d,0x32,0xfb,0xfd,0x03,0x3b,0x01,0x8f,0x00,0xfd,0xfb,0x03,0x00,0xfd,0x03,0x00,
-0x38,0x01,0x27,0x02,0x3f,0x04,0x02,0x05,0x08,0x03,0xe4,0x01,0x0f,0x98,0x08,0x27,
-0x02,0x9d,0x00,0x05,0x52,0x03,0x01,0xf3,0x0b,0x1f,0xfb,0x22,0x02,0x26,0x0f,0x0e,
-0x0a,0x3b,0x0f,0xf8,0x0a,0x2d,0x0f,0x92,0x09,0x0c,0x0e,0x30,0x0f,0x0f,0x86,0x01,
-0x1d,0x07,0x0c,0x03,0x05,0xf2,0x03,0x0f,0xd4,0x01,0x27,0x02,0x12,0x06,0x05,0x64,
-0x07,0x04,0x74,0x0a,0x03,0x39,0x15,0x20,0x02,0x03,0xc6,0x1d,0x2e,0x00,0x04,0x8a,
-0x02,0x30,0x06,0x07,0x08,0x68,0x47,0xf2,0x05,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,
-0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x90,0x1c,0x70,
-0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x94,0x37,0xff,0x00,0x1f,0x1f,0x21,0x1b,0x00,
-0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x8e,0x00,0x04,0xf1,0x27,0x29,
-0x2a,0x2b,0x2c,0x2d,0x00,0x2e,0x2f,0x00,0x00,0x30,0x31,0x32,0x00,0x33,0x00,0x34,
-0x35,0x36,0x37,0x38,0x39,0x3a,0x00,0x00,0x3b,0x00,0x3c,0x3d,0x3e,0x00,0x3f,0x40,
-0x41,0x42,0x43,0x44,0x45,0x46,0x00,0x00,0x47,0x48,0x49,0x00,0x4a,0x00,0x4b,0x4c,
-0x4d,0x4e,0x4f,0x50,0x51,0x51,0x26,0x3f,0x53,0x54,0x55,0x9a,0x01,0x2e,0x02,0xf2,
-0x00,0x20,0x03,0x02,0xed,0x00,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,
-0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xd0,0x0b,0x00,0x0d,
-0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0xe9,0x2c,0x62,0x00,0x17,0x17,
-0x17,0x18,0x17,0x5c,0x24,0xff,0x01,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,
-0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x73,0x00,0x02,0x11,0x24,0x12,0x2b,0x20,0x26,
-0x27,0x2f,0x3a,0xe0,0x29,0x00,0x2a,0x2b,0x00,0x2c,0x2d,0x2e,0x2f,0x30,0x00,0x31,
-0x00,0x00,0xd1,0x25,0x13,0x33,0x01,0x01,0x64,0x3b,0x36,0x37,0x3c,0x3d,0x3e,0xff,
-0x00,0xdf,0x47,0x37,0x48,0x37,0x41,0x49,0x4a,0x4a,0x4b,0x4c,0x4d,0x00,0x4e,0xec,
-0x00,0x25,0x50,0x00,0x00,0x00,0x00,0x00,
+0xf0,0x0a,0xfa,0xfc,0x6f,0xff,0xf7,0x1f,0xc6,0xff,0xf6,0x01,0xfc,0x6f,0xf5,0x00,
+0x1f,0xc3,0xe4,0x00,0x00,0xfb,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x52,
+0x00,0x01,0x00,0x20,0xaf,0xe2,0x06,0x00,0x80,0x9f,0xff,0xd1,0x00,0x00,0x00,0x8f,
+0xff,0x07,0x00,0xe0,0x6f,0xff,0xff,0xff,0xc0,0x00,0x5f,0xff,0xff,0xff,0xff,0xb0,
+0x0e,0xff,0x01,0x00,0x90,0x40,0x8e,0xee,0xee,0xee,0xee,0xc1,0x02,0x44,0x01,0x00,
+0x11,0x00,0x13,0x00,0x21,0xf5,0x0f,0x07,0x00,0x20,0x60,0xcf,0x06,0x00,0xf1,0x05,
+0xe3,0x00,0x00,0x00,0x10,0x00,0x00,0x0b,0xf2,0x00,0x00,0xbf,0xf2,0x00,0x0b,0xff,
+0x30,0x00,0xbf,0xf3,0x07,0x00,0xb4,0x2f,0xf9,0x00,0x00,0x06,0xff,0x80,0x00,0x00,
+0x6f,0xf8,0x09,0x00,0xf4,0x08,0xf4,0x00,0x00,0x05,0xb0,0x01,0x00,0x00,0x00,0x1e,
+0xc0,0x00,0x00,0x1e,0xfc,0x00,0x00,0x02,0xef,0xc0,0x00,0x00,0x2e,0x09,0x00,0x91,
+0x7f,0xf4,0x00,0x06,0xff,0x70,0x00,0x6f,0xf7,0x07,0x00,0x60,0x2f,0xf7,0x00,0x00,
+0x0a,0x70,0xa1,0x00,0x30,0x17,0x40,0x00,0xa1,0x00,0x1f,0xe0,0x06,0x00,0x01,0x10,
+0xdf,0x84,0x00,0x12,0xf3,0x97,0x00,0x6f,0x36,0x66,0xbf,0xf6,0x66,0x50,0x2a,0x00,
+0x01,0x99,0x4d,0x90,0x00,0x00,0x01,0x11,0x11,0x11,0x11,0x30,0x00,0xf2,0x44,0x35,
+0x55,0x55,0x55,0x55,0x40,0x00,0x00,0x5a,0xcd,0xc8,0x20,0x00,0x00,0x02,0xdf,0xd7,
+0x69,0xff,0x90,0x00,0x04,0xff,0xa0,0x01,0x02,0xef,0xc1,0x02,0xff,0xf1,0x02,0xfc,
+0x16,0xff,0xb0,0xcf,0xfb,0x05,0xaf,0xf9,0x1f,0xff,0x6d,0xff,0xb1,0xff,0xff,0xb1,
+0xff,0xf7,0x4f,0xfe,0x0b,0xff,0xf5,0x5f,0xfc,0x00,0x6f,0xf9,0x08,0xa5,0x1d,0xfd,
+0x20,0x00,0x5e,0xfb,0x53,0x6e,0xfb,0x10,0x00,0x00,0x07,0xce,0xfe,0xa4,0x00,0x00,
+0x32,0x00,0x01,0x00,0x23,0x0e,0xf5,0x09,0x00,0xf0,0x3b,0x3e,0xf9,0x05,0xac,0xdb,
+0x71,0x00,0x00,0x00,0x1b,0xff,0xfd,0x76,0xaf,0xf7,0x00,0x00,0x00,0x08,0xff,0x31,
+0x30,0x4f,0xfa,0x00,0x00,0x32,0x04,0xef,0xbf,0xc0,0x9f,0xf8,0x00,0x0e,0xf5,0x02,
+0xcf,0xff,0x64,0xff,0xf3,0x01,0xff,0xf6,0x00,0x9f,0xf8,0x4f,0xff,0x40,0x06,0xff,
+0xc0,0x00,0x6f,0xeb,0xff,0xa0,0x00,0x09,0xff,0x60,0x00,0x3e,0xff,0xc0,0x00,0x00,
+0x07,0xff,0xa4,0x30,0x1b,0x65,0x00,0x72,0x02,0x8d,0xff,0x80,0x08,0xfe,0x30,0x5b,
+0x00,0x32,0x04,0xef,0x20,0x09,0x00,0x10,0x02,0x24,0x01,0x22,0x01,0x40,0x0d,0x00,
+0x22,0x0d,0xf8,0x08,0x00,0x21,0x7f,0xff,0x1e,0x00,0x40,0x01,0xff,0xff,0xa0,0x08,
+0x00,0x40,0x0a,0xff,0xff,0xf4,0x08,0x00,0x40,0x3f,0xf5,0x1a,0xfd,0x08,0x00,0xf0,
+0x06,0xcf,0xf4,0x0a,0xff,0x60,0x00,0x00,0x05,0xff,0xf5,0x0a,0xff,0xe1,0x00,0x00,
+0x0e,0xff,0xf6,0x0b,0xff,0xf9,0x04,0x02,0xf2,0x06,0xfd,0x8f,0xff,0xff,0x20,0x02,
+0xff,0xff,0xf3,0x09,0xff,0xff,0xb0,0x0a,0xff,0xff,0xf7,0x1c,0xff,0xff,0xf4,0x09,
+0x02,0x50,0xff,0xf8,0x04,0x9a,0xaa,0x01,0x00,0x11,0x91,0x5a,0x00,0x21,0x70,0x00,
+0x51,0x00,0xf0,0x0b,0xa0,0xef,0xfa,0x00,0x05,0xff,0xff,0xaf,0xff,0xf9,0x04,0xff,
+0xff,0xfb,0x11,0x3f,0xa4,0xff,0x84,0xfc,0x00,0x00,0x33,0xff,0x90,0x19,0xd5,0x01,
+0xe0,0xa2,0x01,0x70,0x00,0x02,0xef,0xa4,0xf6,0x3f,0xa0,0xef,0xff,0xb0,0x5f,0x27,
+0x00,0xb1,0xc0,0x00,0x6f,0xff,0xfb,0x11,0x10,0x00,0x00,0x14,0xfc,0x41,0x00,0x10,
+0x19,0x4c,0x00,0x01,0x0a,0x00,0x30,0x5f,0xa0,0x00,0x92,0x00,0x10,0xfa,0x0b,0x00,
+0xf1,0x0d,0xfa,0xff,0xa0,0x00,0x05,0xff,0x90,0x3f,0xfa,0x00,0x4f,0xf9,0x00,0x03,
+0xff,0xa0,0xbf,0x90,0x00,0x00,0x3f,0xf1,0x15,0x00,0x00,0x00,0x03,0x30,0x2e,0x00,
+0xf0,0x09,0x10,0x9f,0x50,0x00,0x00,0x1d,0xe1,0x8f,0xf5,0x00,0x01,0xdf,0xd0,0x08,
+0xff,0x50,0x1d,0xfd,0x10,0x00,0x8f,0xf6,0xdf,0xd1,0x61,0x01,0x20,0xfd,0x10,0xf8,
+0x01,0x20,0xd1,0x00,0x4f,0x00,0x00,0x0b,0x00,0x23,0x7d,0x10,0x14,0x01,0xf3,0x15,
+0xfd,0x18,0xff,0xff,0xff,0x80,0x00,0x6f,0xff,0xfd,0x4a,0xaa,0xaa,0xfb,0x00,0x0c,
+0xda,0xf7,0xf4,0x00,0x00,0x0e,0xb0,0x00,0x00,0x9f,0x11,0x00,0x00,0x00,0xeb,0x00,
+0x00,0x09,0xf1,0x00,0x11,0x00,0xc0,0x10,0x00,0x02,0xe6,0xeb,0x9d,0x00,0x09,0xf9,
+0x99,0x99,0x4d,0x44,0x01,0x72,0x7f,0xff,0xff,0xfb,0x1d,0xff,0xa0,0x49,0x00,0x35,
+0x1d,0xa0,0x00,0x01,0x00,0xd2,0x6b,0xcc,0xc7,0x00,0x00,0x00,0x0f,0xff,0xff,0xf8,
+0x22,0x22,0x10,0x28,0x01,0x2f,0xcf,0xff,0x01,0x00,0x12,0x11,0xfa,0x06,0x00,0x00,
+0xef,0x00,0x02,0xd2,0x01,0x12,0x08,0xbb,0x01,0x31,0x8f,0xff,0x80,0x27,0x02,0x21,
+0xff,0xf8,0xc7,0x01,0xe2,0xff,0xff,0x70,0x00,0x00,0x69,0x9f,0xff,0x99,0x60,0x00,
+0x00,0x00,0x2f,0xd6,0x01,0x08,0x07,0x00,0xf1,0x06,0x46,0x66,0x2f,0xff,0x26,0x66,
+0x50,0xff,0xff,0x46,0x76,0x4f,0xff,0xf2,0xff,0xff,0xfc,0xbc,0xff,0xff,0xf2,0xe4,
+0x02,0x40,0xb8,0xf2,0x9b,0xbb,0x01,0x00,0x02,0xad,0x00,0x21,0x33,0x00,0x10,0x02,
+0x00,0x70,0x00,0x00,0x52,0x02,0x11,0xff,0xa7,0x02,0x11,0xff,0x0d,0x02,0x12,0x0c,
+0x15,0x00,0x32,0x00,0xbf,0xf6,0x07,0x00,0x00,0x05,0x01,0x01,0xb1,0x03,0xf1,0x0a,
+0x01,0x50,0x00,0x4f,0xfd,0x00,0x03,0xaf,0xf8,0x07,0xff,0xf2,0x00,0x0e,0xff,0xff,
+0xef,0xfe,0x30,0x00,0x0b,0xff,0xff,0xff,0xc2,0xa0,0x00,0x10,0xd5,0x7c,0x02,0x21,
+0x98,0x62,0x67,0x01,0x10,0x84,0xc5,0x01,0xf1,0x05,0x8f,0xff,0x60,0x00,0xaf,0xf3,
+0xec,0x2e,0xc0,0x1c,0xff,0xa0,0xde,0x9f,0xd1,0xdf,0xfa,0x00,0x3e,0xff,0x80,0x02,
+0x11,0x2d,0x61,0x00,0x60,0x1c,0xff,0xf7,0x00,0x00,0x2d,0x38,0x04,0xf0,0x10,0x00,
+0xcf,0xaf,0xd2,0xef,0xf6,0x00,0xfb,0x0d,0xd0,0x2e,0xff,0x60,0xbf,0xef,0x80,0x02,
+0xef,0xf3,0x19,0xc8,0x00,0x00,0x16,0x40,0x00,0x02,0x66,0x66,0x12,0x00,0x64,0x00,
+0xff,0x05,0x3f,0x40,0x00,0x0c,0xff,0xff,0x3f,0xf2,0xdf,0x6c,0xff,0xff,0x53,0x31,
+0xff,0x7c,0xff,0xff,0xff,0xf6,0x06,0x00,0x0c,0x10,0x7b,0xd3,0x03,0x60,0xff,0xc2,
+0x33,0x33,0x33,0x20,0x00,0x01,0xe1,0x20,0x00,0x8a,0xaa,0xaa,0xa9,0x00,0x00,0x49,
+0x99,0x99,0x99,0x60,0x00,0xc0,0x02,0x20,0x00,0xfa,0x02,0x01,0x10,0x80,0x8d,0x00,
+0x21,0xef,0xf3,0x06,0x00,0x72,0xf5,0xfe,0xaa,0xaa,0xaa,0xff,0xf5,0x0f,0x04,0x40,
+0xff,0xff,0x80,0x4f,0x06,0x00,0x20,0x10,0x0c,0x06,0x00,0x20,0x50,0x1e,0x06,0x00,
+0x50,0xfb,0xef,0xff,0xf5,0x9f,0x1e,0x00,0x81,0xd1,0xcd,0xdd,0xdd,0xdd,0xdd,0xd4,
+0xef,0x2a,0x00,0x17,0x00,0x01,0x00,0x7f,0xbc,0xcc,0xcc,0xcc,0xcc,0xc3,0xff,0x18,
+0x00,0x10,0x10,0x6b,0x12,0x00,0x22,0xcb,0x6f,0xfe,0x01,0x11,0x9f,0x06,0x00,0x11,
+0x95,0x0e,0x00,0x70,0x65,0xf9,0x3d,0xff,0xff,0xfd,0x39,0x03,0x00,0x20,0xf9,0x3d,
+0x10,0x00,0x11,0xa4,0x17,0x00,0x2c,0xb7,0xbf,0x2b,0x02,0x80,0x55,0x55,0x20,0x00,
+0x03,0xff,0xff,0x90,0x72,0x03,0x10,0x40,0x84,0x01,0x00,0xda,0x03,0x90,0xfc,0x44,
+0x40,0x0c,0xff,0xff,0xff,0xf0,0x0e,0xdd,0x02,0x40,0x0d,0xff,0xff,0xfe,0x45,0x02,
+0x10,0xf6,0xc9,0x01,0xa0,0xc0,0x00,0x00,0x00,0xff,0x30,0x00,0x00,0x03,0xfa,0xf4,
+0x01,0x10,0xf1,0x3e,0x03,0x14,0x50,0x9f,0x00,0xb0,0x35,0x6e,0xf7,0x54,0x00,0x00,
+0xff,0xf9,0x8f,0xff,0x10,0x1d,0x01,0x00,0x06,0x00,0xf0,0x02,0xfa,0x24,0x44,0x01,
+0x00,0xff,0xf4,0xef,0xff,0x3e,0x20,0xff,0xf4,0xff,0xff,0x3f,0xe2,0x06,0x00,0x41,
+0x43,0x31,0xff,0xf4,0x5f,0x01,0x07,0x06,0x00,0x20,0x23,0x30,0x06,0x00,0x22,0x00,
+0x00,0x06,0x00,0x71,0x7a,0xaa,0xaa,0xa2,0x00,0x00,0x03,0x56,0x00,0x20,0x1f,0x70,
+0x6a,0x00,0x31,0xef,0xfa,0x10,0x50,0x06,0x10,0xd0,0x80,0x04,0x80,0xff,0xf7,0x00,
+0x04,0xff,0xff,0xff,0xfb,0x75,0x02,0x40,0xff,0xfd,0x00,0x09,0x6d,0x00,0x20,0x00,
+0x0d,0x06,0x00,0x20,0x30,0x7f,0x06,0x00,0x11,0xd0,0x53,0x01,0x30,0xf4,0x13,0x33,
+0xb9,0x01,0x40,0x00,0x00,0xcf,0xf2,0x48,0x00,0x61,0x29,0x50,0x00,0x00,0x5a,0xaa,
+0x01,0x00,0x12,0x2f,0x03,0x01,0xf8,0x28,0xf9,0xfa,0x0d,0x01,0xb0,0xd0,0xa2,0x0f,
+0xaf,0xeb,0xfb,0xcf,0xbf,0xbe,0xcb,0xfa,0xff,0xe1,0x98,0x1c,0x1c,0x15,0xff,0xaf,
+0xfd,0x08,0x70,0xb0,0xb0,0x3f,0xfa,0xff,0xdf,0xdd,0xdd,0xdd,0xfd,0xdf,0xaf,0xa0,
+0xd0,0x00,0x00,0x0a,0x20,0xfa,0xfe,0xaf,0xaa,0xaa,0xaa,0xeb,0xaf,0x9a,0xff,0x80,
+0x01,0x31,0x41,0x00,0x00,0x9e,0x00,0x10,0xd0,0x09,0x03,0x30,0x8f,0xff,0xfc,0x68,
+0x00,0x60,0xff,0xff,0xff,0x50,0x00,0x03,0x69,0x01,0x41,0xe0,0x00,0x3c,0xff,0xae,
+0x00,0x00,0xdd,0x06,0x00,0x45,0x01,0x21,0x9e,0xff,0x2e,0x04,0x00,0x8f,0x04,0x31,
+0xff,0xf1,0x00,0x9c,0x04,0x12,0xf9,0xa9,0x04,0x02,0x7f,0x03,0x13,0x05,0x0f,0x04,
+0x22,0x4f,0xf3,0x5f,0x00,0x70,0x76,0x00,0x00,0x00,0x34,0x44,0x43,0x4f,0x01,0x20,
+0xfb,0x8a,0x05,0x00,0xc0,0x8f,0xa0,0xff,0xff,0xfb,0x7f,0xf8,0xff,0xff,0xfc,0x11,
+0x11,0x4c,0x00,0x1f,0xfc,0x05,0x00,0x10,0x50,0xbd,0xdd,0xdd,0xdd,0xd8,0x9f,0x01,
+0x11,0x54,0xb5,0x04,0xf0,0x2a,0x6c,0xff,0xff,0xff,0xd8,0x10,0x00,0x04,0xef,0xff,
+0xdb,0xbc,0xff,0xff,0x70,0x08,0xff,0xd6,0x10,0x00,0x00,0x4b,0xff,0xb0,0xbf,0x70,
+0x00,0x13,0x32,0x00,0x05,0xed,0x10,0x30,0x06,0xdf,0xff,0xfe,0x80,0x01,0x10,0x00,
+0x0b,0xff,0xfc,0xce,0xff,0xd2,0x00,0x00,0x00,0xbe,0x60,0x00,0x04,0xde,0x10,0x23,
+0x05,0x41,0x03,0x40,0x00,0x10,0x2a,0x06,0x22,0xff,0x80,0xa2,0x00,0x32,0x6f,0xfa,
+0x00,0x06,0x04,0x20,0xac,0x30,0xfd,0x07,0x02,0x1d,0x01,0x31,0xd2,0x0f,0xea,0x68,
+0x01,0xd0,0xcf,0x90,0xfa,0x48,0x88,0x88,0x88,0x88,0x65,0xff,0x1f,0xa9,0xff,0xab,
+0x01,0x32,0x1a,0xf1,0xfa,0xfa,0x02,0xc0,0xaf,0x1f,0xa5,0x99,0x99,0x99,0x99,0x98,
+0x5f,0xf1,0xfd,0x99,0x01,0x00,0x33,0x9b,0xfa,0x0b,0x98,0x02,0x03,0x8b,0x06,0x0f,
+0x4d,0x00,0x06,0x22,0x30,0x05,0x4d,0x00,0x23,0xf7,0x00,0x4d,0x00,0x22,0x70,0x01,
+0x4d,0x00,0x2f,0x94,0x00,0x4d,0x00,0x1e,0x22,0x00,0x00,0x4d,0x00,0x23,0xf0,0x00,
+0x4d,0x00,0x22,0x00,0x00,0x4d,0x00,0x2f,0x90,0x00,0x4d,0x00,0x1d,0x23,0x85,0x00,
+0x4d,0x00,0x22,0xa0,0x00,0x4d,0x00,0x23,0xfa,0x00,0x4d,0x00,0x2f,0x60,0x00,0x4d,
+0x00,0x1d,0x22,0x00,0x00,0x4d,0x00,0x01,0x0c,0x02,0x00,0x4d,0x00,0x02,0x62,0x01,
+0x13,0xaf,0x11,0x00,0x0f,0x4d,0x00,0x09,0x00,0x01,0x00,0x23,0x5c,0x50,0x95,0x02,
+0x02,0x0e,0x07,0x21,0x03,0xd0,0x11,0x00,0x31,0x64,0x00,0xa5,0x56,0x09,0xf0,0x0a,
+0xbf,0xf6,0x4e,0x21,0x11,0x11,0x17,0xd3,0x0f,0xff,0xec,0xce,0xec,0xcc,0xcc,0xef,
+0xe1,0x7f,0xe3,0x00,0x2d,0x00,0x00,0x06,0x80,0xd9,0x01,0x32,0x97,0x0a,0xa6,0x44,
+0x00,0x14,0xcc,0x98,0x06,0x29,0x2f,0xfa,0x5c,0x00,0x20,0x01,0x10,0x89,0x00,0xf2,
+0x42,0xff,0xe8,0x00,0x00,0xdf,0xf8,0xcf,0xf8,0x00,0x7f,0xff,0x81,0xdf,0xf1,0x0c,
+0xfa,0xf8,0x52,0xdf,0x60,0xff,0x64,0x78,0x3a,0xf8,0x0f,0xff,0x50,0x08,0xff,0xa1,
+0xff,0xff,0x12,0xff,0xfa,0x0f,0xff,0x41,0x15,0xff,0xa0,0xef,0x46,0x88,0x48,0xf8,
+0x0b,0xfc,0xf8,0x42,0xef,0x50,0x5f,0xff,0x82,0xef,0xf1,0x00,0xaf,0xfa,0xef,0xf6,
+0x00,0x00,0x5a,0xdc,0xa4,0x00,0x00,0x01,0x56,0x63,0x00,0x00,0x78,0x8b,0xff,0xfe,
+0x88,0x82,0x53,0x03,0x70,0x12,0x22,0x22,0x22,0x22,0x20,0x3f,0x0c,0x00,0xcf,0x90,
+0x3f,0xfc,0xfc,0xfe,0xdf,0x90,0x3f,0xd5,0xf4,0xeb,0x7f,0x06,0x00,0x07,0x61,0xe6,
+0xf5,0xec,0x8f,0x90,0x2f,0x54,0x03,0x52,0x07,0x9a,0xaa,0xaa,0xa9,0x95,0x07,0x12,
+0x14,0xf7,0x00,0x22,0xef,0xa0,0x89,0x06,0x10,0xf9,0x0d,0x00,0x30,0xc3,0xdf,0xff,
+0x3b,0x09,0x30,0xfd,0x3d,0xf5,0x1a,0x00,0x40,0xff,0xd3,0x50,0x00,0x49,0x06,0x02,
+0x0d,0x00,0x21,0xff,0x60,0x0d,0x00,0x15,0xf6,0x0d,0x00,0x11,0x0b,0x0d,0x00,0x00,
+0x51,0x04,0x11,0x60,0x88,0x07,0x11,0xf6,0x4b,0x07,0x13,0x86,0x66,0x01,0x10,0x8b,
+0x73,0x05,0x14,0xb6,0xb8,0x01,0xf0,0x0d,0xf2,0x00,0xbf,0xff,0xf8,0xbf,0xf6,0xef,
+0xff,0x40,0xbf,0xff,0xff,0x10,0xa4,0x09,0xff,0xf4,0xaf,0xff,0xff,0xfd,0x10,0x07,
+0xff,0xff,0x4d,0xff,0x21,0x09,0xf4,0x07,0xbf,0xff,0xf4,0x1d,0xff,0xff,0xf4,0x06,
+0x10,0xbf,0xff,0x40,0x1d,0xff,0xff,0x47,0xfd,0x2b,0xff,0xf4,0x00,0x1d,0xb7,0x01,
+0x31,0x1c,0xff,0xff,0xcf,0x06,0xf0,0x00,0x08,0x99,0x99,0x70,0x00,0xbf,0xff,0xff,
+0xf8,0x0a,0xd0,0xd0,0xd0,0xeb,0x9f,0x05,0x00,0x60,0xff,0xd1,0xd1,0xd1,0xeb,0xff,
+0xe6,0x04,0x0f,0x05,0x00,0x0b,0x10,0xef,0xc6,0x05,0x52,0x5c,0xdd,0xdd,0xdd,0xb2,
+0x9f,0x00,0x11,0xb0,0x37,0x05,0x20,0x0b,0xf0,0x70,0x08,0xa2,0x00,0x0f,0xf0,0x0a,
+0xff,0x21,0x11,0x11,0x1f,0xf0,0xad,0x00,0x12,0xf0,0x22,0x06,0x42,0xd0,0x08,0xff,
+0x10,0xbe,0x08,0x02,0x07,0x00,0x60,0x01,0x00,0x00,0x00,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -768,11 +782,17 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 1105, .range_length = 62546, .glyph_id_start = 179, .list_length = 63, .type = 3, .unicode_list = 1936, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[20642] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 3101, .size = 4062, .comp_size = 3716 },
+{ .bitmap_start = 4062, .comp_offset = 6817, .size = 4034, .comp_size = 3306 },
+{ .bitmap_start = 8096, .comp_offset = 10123, .size = 3010, .comp_size = 2162 },
+};
+
+static uint8_t etxUncompBuf[9536] __SDRAMFONTS;
 
 const etxLz4Font lv_font_ru_bold_STD = {
-.uncomp_size = 20282,
-.comp_size = 12056,
+.uncomp_size = 9176,
+.comp_size = 3101,
 .line_height = 15,
 .base_line = 3,
 .subpx = 0,
@@ -785,12 +805,13 @@ const etxLz4Font lv_font_ru_bold_STD = {
 .bitmap_format = 0,
 .left_class_cnt = 85,
 .right_class_cnt = 78,
-.glyph_bitmap = 2062,
-.class_pair_values = 13168,
-.left_class_mapping = 19798,
-.right_class_mapping = 20040,
+.class_pair_values = 2062,
+.left_class_mapping = 8692,
+.right_class_mapping = 8934,
+.block_num = 3,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 20642,
+.lvglFontBufSize = 9536,
 };
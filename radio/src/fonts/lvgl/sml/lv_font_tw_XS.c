@@ -253,8 +253,8 @@ static const uint8_t lz4FontData[] ={
 0x43,0x07,0x00,0x00,0xdd,0x08,0x00,0x22,0x0b,0x8e,0x08,0x00,0x13,0x39,0x08,0x00,
 0x13,0x67,0x08,0x00,0x10,0x95,0x08,0x00,0x00,0x48,0x09,0x12,0x8e,0x58,0x00,0x22,
 0x02,0x8f,0x08,0x00,0x22,0x34,0x8f,0xa8,0x00,0x22,0x71,0x8f,0xc8,0x00,0x22,0xa5,
-0x8f,0x60,0x00,0x60,0xd1,0x8f,0x10,0x0a,0x0b,0x07,0x88,0x19,0xf1,0xff,0xff,0xff,
-0xff,0xff,0x9c,0x72,0x1f,0xb5,0x21,0x51,0x2f,0x50,0x4d,0x5a,0x4d,0x5b,0x4d,0x5d,
+0x8f,0x60,0x00,0x60,0xd1,0x8f,0x10,0x0a,0x0b,0x07,0x88,0x19,0xf8,0xff,0xff,0xff,
+0xff,0xff,0x75,0x72,0x1f,0xb5,0x21,0x51,0x2f,0x50,0x4d,0x5a,0x4d,0x5b,0x4d,0x5d,
 0x4d,0x76,0x4d,0x7d,0x4d,0x82,0x4d,0x89,0x4d,0x8b,0x4d,0x9b,0x4d,0xa8,0x4d,0xdc,
 0x4d,0xf4,0x4d,0xfb,0x4d,0xfe,0x4d,0x1b,0x4e,0x26,0x4e,0x35,0x4e,0x40,0x4e,0x46,
 0x4e,0x4b,0x4e,0x4d,0x4e,0x60,0x4e,0x7f,0x4e,0x98,0x4e,0x9d,0x4e,0x9e,0x4e,0x9f,
@@ -342,595 +342,645 @@ static const uint8_t lz4FontData[] ={
 0xef,0x14,0xf0,0x15,0xf0,0x17,0xf0,0x19,0xf0,0x30,0xf0,0x37,0xf0,0x3a,0xf0,0x43,
 0xf0,0x6c,0xf0,0x74,0xf0,0xab,0xf0,0x3b,0xf1,0x90,0xf1,0x91,0xf1,0x92,0xf1,0x93,
 0xf1,0x94,0xf1,0xd7,0xf1,0xe3,0xf1,0x3d,0xf2,0x54,0xf2,0xaa,0xf4,0x12,0xf7,0xf2,
-0xf7,0x2c,0x2b,0x2b,0x2b,0x2b,0x17,0x00,0x2b,0x55,0xa5,0x59,0x32,0x60,0x00,0x55,
-0x55,0x00,0x08,0x29,0x20,0x0c,0xec,0xec,0x00,0x0b,0x0b,0x00,0x00,0xa0,0xa0,0x05,
-0xce,0xcd,0x80,0x05,0x56,0x50,0x00,0x82,0x92,0x33,0x1f,0xf0,0x85,0x74,0x00,0x05,
-0xdc,0x30,0x1d,0x14,0xd0,0x2c,0x00,0x80,0x0b,0xa3,0x00,0x00,0x5c,0x70,0x23,0x00,
-0xd0,0x4b,0x01,0xe0,0x09,0xed,0x50,0x00,0x83,0x00,0x1b,0xb1,0x00,0x07,0x45,0x63,
-0x70,0x64,0x55,0xa0,0x01,0xa9,0x65,0x00,0x00,0x0a,0x6a,0x40,0x08,0x3b,0x0b,0x01,
-0x90,0xb0,0xb0,0x00,0x08,0xa6,0x05,0xdc,0x10,0x00,0xd1,0x67,0x00,0x0c,0x3a,0x40,
-0x00,0x5f,0x70,0x00,0x1d,0xa9,0x07,0x07,0x80,0xc8,0x90,0x59,0x02,0xf4,0x00,0x9b,
-0xc9,0xc0,0x73,0x73,0x41,0x00,0x71,0x04,0x90,0x0b,0x10,0x1c,0x00,0x4a,0x00,0x59,
-0x00,0x49,0x00,0x2b,0x00,0x0d,0x00,0x09,0x40,0x01,0xb0,0x00,0x21,0x81,0x03,0xa0,
-0x0b,0x20,0x67,0x04,0xa0,0x2b,0x03,0xb0,0x49,0x08,0x50,0xc0,0x76,0x03,0x00,0x03,
-0x80,0x07,0x69,0x80,0x3b,0xe5,0x01,0xca,0x30,0x13,0x13,0x00,0x00,0x83,0x00,0x00,
-0xa4,0x03,0x00,0x32,0x9f,0xff,0xf3,0x09,0x00,0xf6,0x28,0x67,0x85,0x70,0xad,0x70,
-0x01,0x3b,0x00,0x1a,0x00,0x74,0x00,0xb0,0x02,0x90,0x08,0x40,0x0c,0x00,0x38,0x00,
-0x83,0x00,0x60,0x00,0x08,0xdc,0x30,0x2c,0x03,0xc0,0x58,0x00,0xe0,0x67,0x00,0xd0,
-0x67,0x00,0xd0,0x58,0x00,0xe0,0x2c,0x03,0xb0,0x07,0xdc,0x30,0x03,0x98,0x2b,0x99,
-0x00,0x59,0x02,0x00,0xf0,0x6e,0x09,0xdd,0x30,0x5a,0x03,0xc0,0x32,0x01,0xd0,0x00,
-0x07,0x80,0x00,0x3c,0x00,0x01,0xd2,0x00,0x0b,0x40,0x00,0x6f,0xdd,0xd3,0x0a,0xdd,
-0x35,0x80,0x2c,0x00,0x04,0xb0,0x1d,0xf2,0x00,0x04,0xb2,0x20,0x0e,0x5a,0x03,0xc0,
-0xad,0xc2,0x00,0x0d,0x60,0x00,0x7e,0x60,0x01,0xc8,0x60,0x0a,0x38,0x60,0x4a,0x08,
-0x60,0xad,0xde,0xe5,0x00,0x08,0x60,0x00,0x08,0x60,0x0a,0xff,0xf0,0x0c,0x10,0x00,
-0x0d,0x00,0x00,0x0e,0xdd,0x50,0x04,0x02,0xe0,0x00,0x00,0xb2,0x1c,0x00,0xd1,0x06,
-0xdd,0x60,0x01,0xae,0x10,0x0b,0x80,0x00,0x1d,0x00,0x00,0x4c,0xcd,0x40,0x5d,0x12,
-0xe0,0x49,0x00,0xc1,0x1d,0x01,0xd0,0x05,0xdd,0x40,0x8d,0xdd,0xf2,0x00,0x01,0xc0,
-0x00,0x07,0x60,0x34,0x00,0x70,0x49,0x00,0x00,0xb3,0x00,0x01,0xd0,0x4a,0x00,0xf0,
-0x5b,0x09,0xdd,0x40,0x3c,0x02,0xd0,0x2c,0x03,0xc0,0x09,0xef,0x30,0x3c,0x03,0xc0,
-0x67,0x00,0xd0,0x4b,0x02,0xd0,0x08,0xdd,0x40,0x09,0xdc,0x15,0xa0,0x5a,0x76,0x00,
-0xd4,0xb0,0x4f,0x08,0xd8,0xe0,0x00,0x3c,0x00,0x0b,0x60,0x7e,0x70,0x3a,0x01,0x00,
-0x00,0x01,0x3a,0x58,0x01,0x00,0x00,0x12,0x58,0x84,0x30,0x00,0x18,0x40,0x8d,0x70,
-0x9c,0x10,0x00,0x7d,0x81,0x00,0x08,0x40,0x3e,0xee,0xb0,0x00,0x00,0x3e,0xee,0xb0,
-0x49,0x10,0x00,0x6d,0x91,0x00,0x0a,0xc1,0x7d,0x81,0x48,0x10,0x00,0x1c,0xea,0x08,
-0x60,0xb3,0x00,0x0a,0x30,0x04,0xc0,0x00,0xd1,0x00,0x27,0xdc,0x01,0xf0,0x7c,0x3a,
-0x00,0x00,0x3b,0xbb,0x80,0x00,0x3a,0x00,0x04,0x90,0x0b,0x02,0xba,0x18,0x22,0x80,
-0xb1,0x92,0x35,0x55,0x1a,0x0a,0x12,0x76,0x44,0x80,0xb0,0x36,0x56,0x38,0x0d,0x07,
-0x31,0xa0,0xb9,0x7a,0x80,0x09,0x50,0x00,0x00,0x00,0x07,0xba,0xa0,0x00,0x00,0x5d,
-0x00,0x00,0x0a,0xd2,0x00,0x00,0xd5,0x80,0x00,0x59,0x0d,0x00,0x0a,0x30,0xb3,0x00,
-0xfd,0xde,0x80,0x59,0x00,0x1d,0x0b,0x40,0x00,0xb3,0x2f,0xdd,0xb0,0x2c,0x00,0x96,
-0x2c,0x00,0xa5,0x2f,0xde,0xc0,0x2c,0x00,0x97,0x2c,0x00,0x5a,0x2c,0x00,0x97,0x2f,
-0xdd,0xa0,0x03,0xcd,0xb2,0x00,0xd3,0x05,0xb0,0x4a,0x00,0x09,0x06,0x80,0x00,0x00,
-0x68,0x00,0x00,0x04,0xa0,0x00,0x80,0x0d,0x30,0x5b,0x00,0x3c,0xdb,0x10,0x2f,0xed,
-0x70,0x2c,0x00,0xb6,0x2c,0x00,0x2c,0x2c,0x00,0x0e,0x03,0x00,0x00,0x09,0x00,0xd1,
-0xb6,0x2f,0xde,0x70,0x2f,0xdd,0xd4,0x2c,0x00,0x00,0x2c,0x00,0x00,0x55,0x00,0x14,
-0x00,0x0c,0x00,0x47,0xd4,0x2f,0xdd,0xd3,0x0f,0x00,0x15,0xa0,0x0c,0x00,0xa1,0x03,
-0xcd,0xc2,0x00,0xd3,0x04,0xc0,0x4b,0x00,0x06,0x64,0x00,0xf0,0x05,0x06,0xde,0x14,
-0xb0,0x00,0xd1,0x0d,0x40,0x1e,0x10,0x2c,0xed,0x60,0x2c,0x00,0x0a,0x42,0xc0,0x00,
-0xa4,0x07,0x00,0x36,0xfd,0xdd,0xf4,0x0e,0x00,0x00,0x07,0x00,0x13,0x1d,0x01,0x00,
-0x53,0x00,0x03,0xc0,0x00,0x3c,0x05,0x00,0xf5,0x15,0xc3,0x00,0x3b,0x96,0x07,0x91,
-0xcd,0xb1,0x2c,0x00,0x7a,0x02,0xc0,0x4d,0x00,0x2c,0x2d,0x20,0x02,0xcd,0x60,0x00,
-0x2f,0xad,0x00,0x02,0xc0,0x89,0x00,0x2c,0x00,0xd4,0x02,0xc0,0x03,0xd0,0x79,0x00,
-0x08,0x03,0x00,0xf1,0x52,0x2f,0xdd,0xd1,0x2f,0x30,0x00,0x7e,0x2f,0x90,0x00,0xde,
-0x2b,0xd0,0x03,0xbe,0x2b,0x94,0x09,0x5e,0x2c,0x4a,0x0d,0x0e,0x2c,0x0d,0x59,0x0e,
-0x2c,0x08,0xe4,0x0e,0x2c,0x02,0xe0,0x0e,0x2f,0x10,0x0a,0x42,0xfa,0x00,0xa4,0x2c,
-0xd3,0x0a,0x42,0xc4,0xc0,0xa4,0x2c,0x0b,0x6a,0x42,0xc0,0x2e,0xb4,0x2c,0x00,0x8f,
-0x42,0xc0,0x00,0xe4,0x02,0xce,0xb1,0x00,0xd4,0x05,0xc0,0x4b,0x00,0x0d,0x26,0x80,
-0x00,0xa4,0x68,0x00,0x0a,0x44,0xb0,0x00,0xd2,0x0d,0x40,0x5c,0x00,0x2c,0xeb,0x10,
-0x2f,0xed,0xc2,0x2c,0x00,0x5b,0x22,0x01,0x46,0x5b,0x2f,0xdd,0xb2,0xf8,0x00,0xf1,
-0x16,0xce,0xb1,0x00,0xd3,0x06,0xb0,0x4a,0x00,0x0d,0x17,0x70,0x00,0xb3,0x77,0x00,
-0x0b,0x35,0xa0,0x00,0xd1,0x0d,0x30,0x6b,0x00,0x3c,0xef,0x40,0x00,0x00,0x4d,0x10,
-0x00,0x00,0x00,0x2f,0xee,0xa0,0x8e,0x01,0xfe,0x1f,0x4a,0x2c,0x00,0xa7,0x2f,0xde,
-0xa0,0x2c,0x04,0xb0,0x2c,0x00,0xc3,0x2c,0x00,0x4b,0x07,0xdd,0x80,0x3c,0x00,0xb5,
-0x5b,0x00,0x22,0x0b,0xb5,0x00,0x00,0x3a,0xd1,0x32,0x00,0x87,0x6a,0x00,0x96,0x08,
-0xdd,0xa0,0xad,0xee,0xda,0x00,0x77,0x00,0x03,0x00,0x38,0x59,0x00,0x1d,0x03,0x00,
-0xf0,0x45,0x4a,0x00,0x2c,0x1d,0x10,0x79,0x05,0xde,0xa1,0xb4,0x00,0x0e,0x15,0x90,
-0x04,0xb0,0x1e,0x00,0x96,0x00,0xb3,0x0d,0x10,0x06,0x83,0xb0,0x00,0x1d,0x86,0x00,
-0x00,0xbe,0x10,0x00,0x06,0xc0,0x00,0x95,0x00,0xf0,0x06,0x86,0x80,0x4f,0x40,0x95,
-0x2b,0x08,0x98,0x0c,0x10,0xe0,0xc1,0xb0,0xd0,0x0b,0x3c,0x0c,0x3a,0x00,0x89,0x80,
-0x89,0x70,0x04,0xf4,0x04,0xf4,0x00,0x1f,0x00,0x0f,0x00,0x6b,0x00,0x7a,0x0d,0x41,
-0xe2,0x04,0xd9,0x80,0x00,0xbe,0x37,0x00,0xf6,0x08,0x04,0xc8,0x90,0x0d,0x30,0xe2,
-0x6a,0x00,0x6b,0xa5,0x00,0x6a,0x3d,0x00,0xd2,0x0b,0x45,0xb0,0x03,0xcc,0x30,0x00,
-0xbb,0x88,0x00,0xf6,0x0e,0x7d,0xdd,0xf6,0x00,0x01,0xe1,0x00,0x0b,0x50,0x00,0x4c,
-0x00,0x00,0xd2,0x00,0x08,0x80,0x00,0x2d,0x00,0x00,0x9f,0xdd,0xd8,0x4d,0x74,0xa0,
-0x4a,0x04,0x03,0x00,0x60,0x4e,0x70,0xa3,0x00,0x04,0x90,0x5c,0x03,0x40,0x94,0x00,
-0x03,0xa0,0x08,0x00,0x94,0x85,0x00,0x02,0xa0,0x00,0x06,0x00,0xcc,0x0e,0x01,0x00,
-0xf4,0x63,0xcc,0x06,0x90,0x0c,0xc0,0x2a,0x84,0x85,0x2a,0xdd,0xdd,0x60,0x44,0x00,
-0xc1,0x09,0xdc,0x22,0x60,0x4a,0x07,0xbc,0xb5,0xa0,0x3b,0x69,0x07,0xb0,0xcd,0x9b,
-0x59,0x00,0x00,0x59,0x00,0x00,0x5c,0xcd,0x40,0x5c,0x02,0xd0,0x59,0x00,0xc1,0x59,
-0x00,0xc1,0x5c,0x02,0xd0,0x5b,0xce,0x40,0x08,0xdc,0x34,0xb0,0x2c,0x86,0x00,0x17,
-0x60,0x00,0x4b,0x02,0xb0,0x8d,0xc2,0x00,0x00,0xe0,0x00,0x0e,0x09,0xda,0xe4,0xb0,
-0x2e,0x76,0x00,0xe7,0x60,0x0e,0x4b,0x02,0xe0,0x9c,0xae,0x07,0xdc,0x33,0xa0,0x2c,
-0x7e,0xdd,0xd7,0x70,0x00,0x4c,0x01,0x60,0x8d,0xd4,0x03,0xd6,0x0c,0x30,0x0d,0x00,
-0x8f,0xc1,0x0e,0x00,0x02,0x00,0x43,0x09,0xda,0xe4,0xc0,0x30,0x00,0xf1,0x09,0x03,
-0xe0,0x9e,0xae,0x03,0x03,0xc0,0x9d,0xc3,0x59,0x00,0x05,0x90,0x00,0x5b,0xbe,0x45,
-0xc0,0x3c,0x59,0x01,0xd5,0x90,0x1d,0x05,0x00,0x31,0x3a,0x00,0x3a,0x01,0x00,0x62,
-0x04,0x90,0x00,0x04,0x90,0x49,0x03,0x00,0x32,0x05,0x94,0xe4,0x9b,0x00,0xf3,0x04,
-0x59,0x0b,0x60,0x59,0x89,0x00,0x5d,0xe0,0x00,0x5d,0xb6,0x00,0x59,0x1d,0x10,0x59,
-0x05,0xb0,0x3a,0x01,0x00,0xf5,0x03,0x5b,0xcd,0x5b,0xe8,0x05,0xb0,0x3f,0x10,0xe0,
-0x59,0x01,0xd0,0x0d,0x15,0x90,0x1d,0x00,0xd1,0x09,0x00,0x0b,0x61,0x00,0xf6,0x08,
-0x07,0xdd,0x40,0x4c,0x02,0xd0,0x86,0x00,0xb2,0x76,0x00,0xb3,0x3c,0x01,0xe0,0x07,
-0xdd,0x40,0x5c,0xbd,0x40,0x5b,0x01,0xf1,0x00,0x32,0x5c,0xcd,0x40,0x6e,0x00,0x36,
-0x09,0xda,0xd4,0xe3,0x00,0x21,0x9d,0xae,0xf7,0x00,0x55,0x00,0x00,0x5c,0xd3,0x5c,
-0x46,0x05,0xf6,0x0c,0x0a,0xdc,0x14,0xa0,0x56,0x1d,0x82,0x00,0x05,0xc5,0x67,0x05,
-0x90,0xad,0xc2,0x07,0x00,0xe0,0xbf,0xa0,0xe0,0x0e,0x00,0xe0,0x0e,0x00,0xac,0x71,
-0x00,0xf4,0x66,0x3b,0x04,0xd0,0xbd,0xad,0xb3,0x06,0x75,0x80,0xb2,0x1c,0x0d,0x00,
-0xb6,0x80,0x06,0xe3,0x00,0x1e,0x00,0xa3,0x0c,0x30,0xb2,0x67,0x0e,0x80,0xd0,0x2b,
-0x47,0xc3,0xa0,0x0d,0x92,0xb8,0x60,0x0a,0xd0,0x6f,0x20,0x06,0x90,0x2e,0x00,0x79,
-0x0a,0x60,0xd5,0xc0,0x04,0xf3,0x00,0x5f,0x40,0x0d,0x3d,0x08,0x80,0x97,0xb3,0x08,
-0x76,0x80,0xc2,0x1d,0x1c,0x00,0xb7,0x70,0x06,0xf2,0x00,0x1d,0x00,0x06,0x70,0x08,
-0xd1,0x00,0x7d,0xdf,0x70,0x02,0xd0,0x00,0xb4,0x00,0x6a,0x00,0x1d,0x10,0x08,0xed,
-0xd8,0x00,0x82,0x06,0x80,0x0a,0x40,0x0a,0x30,0x0c,0x10,0xaa,0x00,0x0c,0x10,0x0a,
-0x30,0x0a,0x40,0x06,0x80,0x00,0x82,0x29,0x01,0x00,0xf5,0x6f,0x14,0x82,0x00,0x2c,
-0x00,0x0e,0x00,0x0d,0x00,0x0b,0x30,0x04,0xf0,0x0b,0x20,0x0d,0x00,0x0e,0x00,0x2c,
-0x00,0x82,0x00,0x0b,0xd6,0x0b,0x13,0x70,0x9e,0x80,0x00,0x00,0xa3,0x00,0x00,0x00,
-0x0d,0xd3,0x00,0xed,0xdd,0xc2,0xd3,0x0d,0x00,0x00,0x02,0xd2,0xd0,0x00,0x00,0x4c,
-0x1c,0xdd,0xde,0x3d,0x10,0x00,0x00,0xdd,0x10,0x00,0x00,0x08,0x20,0x00,0x00,0x02,
-0xb0,0x00,0x00,0x02,0xde,0x00,0x00,0x02,0xd3,0xad,0xdd,0xe2,0xd3,0x00,0x00,0x0d,
-0x1d,0x50,0x00,0x00,0xd0,0x1c,0x5c,0xdd,0xdc,0x00,0x1c,0xf0,0x00,0x00,0x00,0x19,
-0x00,0x00,0x00,0x01,0x10,0x00,0x00,0x2d,0xd2,0x00,0x02,0xd3,0x3d,0x20,0x2d,0x30,
-0x03,0xd2,0x8d,0xe0,0x0e,0xd8,0x00,0xd0,0x0d,0x00,0x04,0x00,0xb8,0xdd,0xdd,0x00,
-0x00,0x11,0x11,0x00,0x00,0xdb,0xbd,0x00,0x18,0x00,0xf3,0x00,0xaf,0xc0,0x0c,0xfa,
-0x1c,0x50,0x05,0xc1,0x01,0xc5,0x5c,0x10,0x00,0x1c,0xc1,0xb8,0x26,0x40,0x22,0x00,
-0x00,0x00,0xff,0x02,0xf1,0x0f,0x00,0x03,0xee,0x30,0x00,0x00,0x0c,0x77,0xb0,0x00,
-0x00,0x4e,0x00,0xe4,0x00,0x00,0xc5,0x00,0x6c,0x00,0x05,0xe2,0x22,0x2e,0x50,0x0d,
-0xff,0xff,0xff,0xd0,0x2b,0x00,0xf1,0x10,0x01,0x4d,0xd3,0x05,0xd8,0xc3,0x4b,0x3d,
-0x10,0xff,0xf5,0xa5,0x02,0xfe,0x78,0xb2,0x05,0x90,0x2b,0x96,0x00,0x00,0x69,0x2d,
-0x30,0x03,0xd1,0x03,0xcd,0xdc,0x30,0x98,0x00,0xf0,0x1f,0x08,0xcc,0x61,0x00,0x01,
-0xd3,0xee,0x3d,0x10,0x0b,0x70,0x44,0x07,0xb0,0x1a,0x20,0x00,0x01,0xc1,0x1a,0x10,
-0x00,0x01,0xb1,0x0b,0x50,0x00,0x05,0x90,0x04,0xc5,0x00,0x5a,0x60,0x00,0x4a,0xec,
-0x95,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x10,0x77,0x00,0xf0,0x17,0xeb,0xcd,0x91,
-0x00,0x1e,0x29,0xb1,0x4d,0x30,0x0c,0x90,0xb7,0x02,0xc0,0x0d,0x9c,0xc1,0x00,0xc2,
-0x0d,0x05,0x10,0x00,0xb3,0x0a,0x50,0x00,0x01,0xd0,0x02,0xd3,0x00,0x1b,0x50,0x00,
-0x2b,0xdd,0xd5,0x7f,0x00,0x10,0x00,0xd7,0x00,0xf2,0x11,0x10,0x00,0xef,0xff,0xf4,
-0x03,0xe0,0x00,0xd0,0x07,0x90,0x08,0x70,0x06,0xc0,0x97,0x00,0x4c,0xc5,0xd0,0x00,
-0x94,0x97,0xb2,0x00,0x77,0x00,0xd0,0x00,0x0b,0xcd,0x50,0x56,0x00,0xf0,0x10,0x04,
-0x43,0x00,0x00,0x0f,0xfc,0x00,0x1c,0x98,0x88,0x88,0x18,0x02,0x22,0x09,0x18,0x3b,
-0xba,0x09,0x08,0x15,0x54,0x09,0x08,0x27,0x76,0x09,0x0c,0x99,0x99,0x88,0x1c,0x00,
-0x31,0x00,0x02,0x21,0xd6,0x00,0xf2,0x39,0x20,0x04,0xcf,0xf8,0xb8,0x6f,0x71,0x32,
-0x91,0xb9,0x00,0x00,0x90,0x05,0xa0,0x00,0x90,0x09,0x50,0x00,0x92,0xd4,0x00,0x00,
-0xb9,0x9d,0x30,0x00,0x30,0x08,0xfe,0xfa,0x00,0x00,0x13,0x30,0x14,0x44,0x44,0x41,
-0x85,0xf8,0x44,0x58,0x90,0x62,0x7e,0xf8,0x91,0xf6,0x4d,0xf8,0x90,0x62,0x00,0x08,
-0x91,0xf6,0x00,0x08,0x90,0x83,0x00,0x08,0x90,0xe6,0x00,0x08,0x89,0xfc,0x99,0x98,
-0x4f,0x01,0xf2,0x17,0x3b,0xee,0xb2,0x00,0x04,0xd3,0x99,0x3d,0x40,0x0d,0x20,0x99,
-0x02,0xd0,0x1c,0x00,0x76,0x20,0xc2,0x1b,0x1a,0x97,0xa7,0xc2,0x0c,0xa9,0x51,0x8a,
-0xd0,0x03,0xf6,0x00,0x3d,0x30,0x00,0x2a,0xee,0xa2,0x2c,0x00,0xf1,0x1e,0x03,0xdd,
-0x90,0x00,0x00,0x0d,0x20,0x86,0x02,0x00,0x0d,0x00,0x49,0xef,0xa0,0x09,0x84,0xc9,
-0xff,0xf0,0x00,0xde,0xeb,0xff,0xb0,0x09,0x55,0xff,0xff,0x70,0x0c,0x1f,0xff,0xff,
-0xe0,0x0e,0xdf,0xff,0xff,0xf0,0x00,0x01,0x22,0x22,0x10,0xff,0x00,0x10,0x0a,0x28,
-0x07,0xf0,0x0d,0xa5,0x00,0x9a,0xa9,0x9f,0x60,0x89,0x99,0x99,0x92,0x2e,0xff,0xff,
-0xfe,0x02,0xd6,0x44,0x44,0x00,0x2c,0x20,0x00,0x00,0x01,0x90,0x00,0x00,0x00,0xd3,
-0x00,0xf0,0x15,0x05,0x8a,0x50,0x00,0x00,0x8a,0x76,0x70,0x00,0x08,0x63,0x70,0x00,
-0x15,0x58,0x50,0x00,0x4d,0x21,0x7a,0x00,0x0e,0x88,0xf1,0xf5,0x00,0x9b,0x49,0x2f,
-0x20,0x00,0x89,0x79,0x30,0x00,0x00,0x46,0x08,0xf3,0x01,0xea,0x00,0xd0,0x09,0x6a,
-0x0d,0x00,0x69,0xc2,0xd0,0x00,0x0a,0x2d,0x00,0x00,0xa2,0x07,0x00,0x42,0xed,0xdd,
-0xde,0x10,0xa0,0x00,0x30,0x3a,0x89,0x00,0xb2,0x27,0x20,0xaa,0x30,0x5b,0x00,0xf1,
-0x0e,0xa0,0x09,0x24,0x8c,0xd3,0x90,0x08,0x18,0x66,0x00,0x91,0x08,0x00,0x9f,0x10,
-0x26,0x08,0x20,0x67,0x30,0x45,0x00,0x88,0x89,0x99,0x80,0x00,0x00,0x00,0x52,0x00,
-0xf5,0x0d,0xe2,0x40,0x00,0x00,0x01,0xf4,0xc0,0x00,0x7d,0x7d,0x8d,0x20,0x03,0xb0,
-0x2e,0x1c,0x20,0x08,0x40,0x06,0xf8,0x00,0x0b,0x00,0x00,0xe2,0x00,0x0c,0x05,0x00,
-0x01,0x01,0x00,0xf1,0x22,0x0a,0x80,0x55,0x91,0x1a,0x90,0x04,0x14,0xf9,0x2e,0x70,
-0x02,0x00,0x00,0x1a,0xb5,0x00,0x00,0x09,0xe0,0x08,0xc8,0x10,0x15,0x00,0x00,0x1c,
-0xcc,0xb0,0x00,0x00,0x3c,0x10,0x05,0xd1,0x00,0x41,0x01,0x11,0x11,0x11,0x10,0x3b,
-0xbb,0xbb,0xbb,0xb9,0x00,0x00,0x28,0x0a,0x06,0x05,0x00,0x3b,0x9c,0xbb,0x90,0x14,
-0x00,0x51,0x2a,0xaa,0xdb,0xaa,0xa7,0x32,0x00,0x80,0x2b,0xbb,0xbb,0xbb,0xb7,0x00,
-0x00,0x56,0x19,0x00,0x10,0x58,0x05,0x00,0x80,0x5d,0xb3,0x00,0x00,0x00,0x56,0x2c,
-0x80,0x14,0x00,0x13,0x50,0x19,0x00,0x04,0x05,0x00,0x80,0x0b,0xbb,0xbb,0xbb,0xb5,
-0x00,0x00,0x1d,0xf1,0x00,0xf0,0x01,0xc9,0x10,0x00,0x00,0x09,0xa9,0xb6,0x00,0x01,
-0xc7,0x39,0x09,0x90,0x1d,0x40,0x39,0x0e,0x06,0x37,0x39,0x00,0x00,0x05,0x00,0xf0,
-0x1d,0x32,0x00,0x06,0x00,0x00,0x2b,0x00,0x3a,0x00,0x09,0x9d,0x99,0xca,0x93,0x01,
-0x15,0x83,0xa1,0x10,0x04,0x53,0x71,0x90,0xb0,0x00,0xb3,0x71,0x94,0x80,0x00,0xb4,
-0x71,0x99,0x20,0x00,0x34,0x71,0x94,0x00,0x2a,0xab,0xda,0xda,0xa6,0x8c,0x00,0xd4,
-0x11,0x00,0x09,0x20,0x00,0xbb,0xbe,0xcb,0xb5,0xb0,0x09,0x20,0x37,0x04,0x00,0x40,
-0xeb,0xbe,0xcb,0xc7,0x18,0x00,0x05,0x04,0x00,0xf0,0x14,0x0a,0x20,0x00,0x08,0xba,
-0xeb,0xaa,0xb0,0x84,0x1a,0x31,0x1b,0x04,0x88,0xd9,0x88,0x60,0xab,0xbe,0xbb,0xbb,
-0x2b,0x00,0xa2,0x00,0x92,0xda,0xae,0xba,0xad,0x26,0x00,0xa2,0x00,0x41,0x24,0x00,
-0xf3,0x1f,0x00,0x00,0xca,0xaa,0xad,0x40,0x00,0xb0,0x80,0x06,0x40,0x00,0xb0,0x3b,
-0x16,0x40,0x00,0xb0,0x03,0x16,0x40,0x2b,0xeb,0xbb,0xbd,0xc7,0x00,0xb0,0x00,0x06,
-0x40,0x03,0x80,0x00,0x06,0x40,0x0c,0x20,0x00,0x06,0x40,0x38,0x00,0x03,0xbc,0x20,
-0xdd,0x03,0x10,0x50,0x05,0x00,0xd0,0x5b,0x00,0x00,0x06,0x99,0x9c,0xa9,0x91,0x01,
-0x11,0x4a,0x11,0x10,0x8b,0x2a,0x61,0x00,0x02,0xaa,0xbd,0xaa,0x80,0x9c,0x09,0x01,
-0x0f,0x00,0x01,0x05,0x00,0x53,0x2b,0xbb,0xce,0xbb,0xb7,0x32,0x00,0x00,0x8f,0x05,
-0x80,0x99,0x9c,0x99,0x40,0x01,0x11,0x11,0x2d,0x4b,0x00,0x10,0xb5,0xb4,0x01,0xff,
-0x3f,0x60,0x00,0x00,0x01,0xc6,0x00,0x00,0x00,0x4c,0x40,0x00,0x00,0x0b,0xaa,0x21,
-0x01,0x21,0x25,0x03,0x8a,0xaa,0x94,0x00,0x01,0x23,0x58,0x00,0x06,0x99,0xc8,0x42,
-0x00,0x47,0x77,0xb9,0x77,0x70,0x24,0x57,0xa7,0x94,0x40,0x09,0xa7,0x73,0xa9,0x60,
-0x00,0x47,0x84,0xa1,0x20,0x5a,0x99,0xec,0x9a,0xb0,0x00,0x4a,0x85,0xa1,0x00,0x3b,
-0xa0,0x73,0x2c,0x70,0x43,0x00,0x73,0x00,0x71,0x04,0xcc,0xcc,0xcc,0x90,0x00,0x01,
-0x00,0x05,0x80,0x2c,0xcc,0xcc,0xcc,0xc8,0x00,0x00,0x40,0x0c,0x00,0xf2,0x44,0x93,
-0x00,0x00,0x5b,0xbb,0xbb,0xbb,0xb0,0x00,0x75,0x00,0x94,0x00,0x09,0x81,0x00,0x2a,
-0x60,0x25,0x1b,0x03,0xc0,0x70,0x00,0x05,0x8c,0x30,0x00,0x00,0x01,0xeb,0x00,0x00,
-0x03,0x8b,0x25,0xc7,0x30,0x58,0x30,0x00,0x04,0x91,0x00,0x00,0x20,0x00,0x00,0x24,
-0x44,0xc6,0x44,0x40,0x35,0x55,0x55,0x55,0x50,0x04,0xb8,0x88,0x8d,0x00,0x03,0xa7,
-0x77,0x7b,0x00,0x06,0x99,0x99,0x99,0x00,0x00,0x00,0x49,0x82,0x00,0x6a,0xaa,0xdb,
-0xaa,0xa2,0x32,0x02,0x11,0x29,0xfd,0x04,0xf0,0x16,0x51,0x00,0x00,0x6a,0xaa,0xcc,
-0xaa,0xa1,0x00,0x55,0x55,0x55,0x00,0x00,0xc3,0x33,0x3c,0x00,0x00,0xa8,0x88,0x89,
-0x00,0x49,0x88,0x88,0x88,0xa0,0x65,0x09,0x99,0x70,0xa0,0x00,0x1a,0x00,0xb0,0xd7,
-0x07,0x78,0xb0,0x81,0x4b,0x70,0x00,0xaa,0xb0,0xa7,0x00,0x20,0x03,0xe0,0x05,0x00,
-0xf0,0x02,0xa4,0xa1,0x00,0x00,0x08,0xa0,0x02,0xc6,0x00,0x3c,0x52,0x00,0x03,0x7c,
-0x00,0x00,0xc0,0x30,0x00,0x10,0x0b,0xf3,0x02,0x90,0x03,0x90,0x00,0xb0,0x00,0x01,
-0xc2,0x00,0x0b,0x4b,0x0c,0x00,0x16,0x00,0xf1,0x1d,0xa1,0x10,0xb0,0x00,0x04,0x80,
-0xb0,0xb1,0x50,0x1e,0x20,0xb4,0xea,0xc0,0xbc,0x48,0xe6,0xb0,0xb0,0x19,0x32,0xb0,
-0xb0,0xb0,0x09,0x20,0xb0,0xb9,0x90,0x09,0x20,0xb0,0xa0,0x00,0x09,0x20,0xb0,0x00,
-0x64,0x09,0x20,0x9b,0xaa,0xb1,0x6c,0x05,0xf1,0x19,0x60,0x40,0x02,0x90,0x2a,0x08,
-0x50,0x47,0x02,0xa0,0x0c,0x05,0x60,0x2a,0x00,0x10,0x93,0x02,0xa0,0x00,0x0c,0x00,
-0x2a,0x18,0x14,0xb0,0x04,0xeb,0x31,0xda,0x60,0x53,0x05,0xd3,0x0a,0x50,0x01,0x91,
-0x00,0x06,0x8f,0x00,0xf3,0x18,0x1a,0x28,0x80,0x00,0x07,0x4b,0x10,0xe9,0xe1,0xe1,
-0xa0,0x0b,0x0b,0xad,0x1a,0x00,0xb0,0xb2,0x91,0xa0,0x0b,0x0b,0x09,0x1a,0x12,0xb0,
-0xb0,0x92,0xe9,0x2b,0x8b,0x09,0x10,0x00,0xb0,0x00,0x91,0x00,0x0b,0xbd,0x00,0xf1,
-0x0f,0x66,0x51,0xb0,0x00,0x00,0xc0,0xc2,0xc1,0x10,0x09,0xa2,0xd9,0xe9,0x92,0x3b,
-0x96,0x20,0xb0,0x00,0x01,0x96,0x99,0xe9,0x97,0x01,0x90,0x11,0xc1,0x11,0x01,0xba,
-0x00,0x05,0x05,0x00,0x12,0x00,0xfa,0x05,0x01,0x4e,0x03,0xe0,0x13,0x6a,0xb0,0x00,
-0xc5,0x97,0xc1,0x00,0x08,0xb0,0x00,0xb0,0x00,0x5b,0x05,0x00,0x60,0x20,0xb9,0xbb,
-0xeb,0xb7,0x00,0x0a,0x00,0x03,0x05,0x00,0xf7,0x2b,0x11,0xc1,0x10,0x00,0xb4,0x99,
-0x99,0x95,0x00,0x23,0x02,0x03,0x00,0x00,0x93,0x0c,0x08,0x20,0x01,0xb0,0x67,0x03,
-0x90,0x0b,0x93,0xc0,0x00,0xa4,0x3a,0x99,0xab,0xbb,0x99,0x02,0x90,0x08,0x30,0xb0,
-0x01,0x90,0x0a,0x00,0xb0,0x01,0x90,0x1a,0x01,0x90,0x01,0x90,0xa3,0x03,0x80,0x01,
-0x96,0x60,0x7b,0x30,0x5d,0x01,0xf2,0x1d,0x47,0x0c,0x29,0x00,0x00,0xb1,0x0b,0x03,
-0x60,0x05,0xc3,0x5c,0x9a,0xb2,0x2d,0xb6,0x6a,0x61,0x40,0x22,0xb0,0x05,0x67,0x60,
-0x00,0xb0,0x01,0xc9,0x00,0x00,0xb0,0x06,0xf1,0x12,0x00,0xb2,0xb8,0x77,0x36,0x00,
-0xb6,0x20,0x0a,0xd2,0x32,0x00,0xf1,0x1f,0x04,0x00,0x60,0x00,0x06,0x50,0x49,0x00,
-0x00,0xc1,0xbd,0xcb,0xb0,0x6b,0x19,0x00,0x0b,0x2d,0xa1,0x90,0x00,0xb1,0x2a,0x1e,
-0xbb,0xbe,0x00,0xa1,0x90,0x00,0xb0,0x0a,0x19,0x00,0x0b,0x00,0xa1,0xea,0xaa,0xe0,
-0x0a,0x19,0x00,0x0a,0x00,0x02,0xaf,0x04,0xf0,0x13,0xc0,0x0a,0x00,0x00,0x00,0x79,
-0xac,0xda,0xaa,0x30,0x3f,0x10,0xb0,0x50,0x00,0x0b,0xb1,0x8d,0xae,0xaa,0x00,0x09,
-0x89,0xb0,0xb0,0xb0,0x00,0x92,0x0b,0x0b,0x0b,0x00,0x09,0x10,0x0b,0x00,0x51,0x91,
-0x08,0x0b,0x76,0x00,0x3f,0x01,0x13,0x00,0x6a,0x00,0x00,0x22,0x03,0xf0,0x07,0x65,
-0x00,0xc0,0x00,0x00,0xc1,0xbb,0xcb,0xb3,0x0a,0xb0,0x21,0x01,0x40,0x39,0xb0,0x55,
-0x04,0x80,0x00,0xb0,0x29,0x99,0x03,0x10,0x0b,0x2c,0x00,0xf0,0x18,0x0a,0x0b,0x00,
-0x00,0xb5,0x99,0x9d,0x96,0x00,0xb1,0x22,0x22,0x21,0x00,0x13,0x00,0x02,0x60,0x00,
-0x93,0x8a,0xbd,0x50,0x01,0xc0,0xb0,0x0b,0x00,0x0a,0xa0,0xb0,0x0b,0x00,0x5a,0xa0,
-0xeb,0xbe,0xb8,0x11,0x0a,0x00,0xf3,0x05,0x01,0xa0,0xb0,0x09,0x10,0x01,0xa0,0xb0,
-0x36,0x42,0x01,0xa0,0xb2,0x94,0x98,0x01,0xa3,0xc7,0x26,0x96,0x69,0x00,0x50,0x01,
-0x40,0x00,0x00,0x75,0x69,0x00,0x50,0xc4,0xaa,0xba,0xa6,0x0a,0x5a,0x01,0x12,0x39,
-0x64,0x01,0x38,0xbb,0xeb,0xb3,0x73,0x01,0x00,0x23,0x00,0x60,0xb6,0xaa,0xaa,0xa8,
-0x00,0x13,0x37,0x00,0xa0,0x87,0x99,0x99,0x97,0x00,0xc0,0x11,0x11,0xc1,0x09,0x1c,
-0x00,0xf6,0x03,0x3c,0xb1,0xd9,0xd0,0xb0,0x01,0xb1,0x90,0xa0,0xb0,0x00,0xb1,0xda,
-0xe0,0xb0,0x00,0xb1,0x90,0x3a,0x00,0x40,0x6b,0xb0,0x00,0x02,0xd8,0x01,0xf4,0x04,
-0x57,0x0c,0x00,0x00,0x00,0xc1,0x5e,0xbb,0xb9,0x09,0xc1,0xc0,0xb0,0x00,0x3a,0xb7,
-0x30,0xea,0xa6,0x25,0x00,0x77,0xe9,0x96,0x00,0xb0,0x00,0xc1,0x11,0x6e,0x00,0x06,
-0x01,0x00,0x30,0x05,0x70,0x0b,0x1a,0x04,0xc0,0x88,0xd8,0x88,0x00,0xaa,0x29,0x9e,
-0x99,0x70,0x58,0xa4,0x60,0xdf,0x00,0xd0,0x4c,0x9e,0x9a,0xb0,0x00,0xa0,0x70,0xb0,
-0x00,0x00,0x0a,0x06,0xb7,0x3f,0x06,0x60,0x4d,0xb6,0x10,0x00,0x0a,0x98,0x6e,0x00,
-0x20,0x00,0x37,0x71,0x05,0xf2,0x17,0xcd,0xbb,0xb5,0x00,0x83,0x37,0x0b,0x00,0x00,
-0xe3,0x37,0x2e,0x10,0x0a,0x5a,0x7c,0xb3,0xc2,0x05,0x05,0xdd,0xa0,0x11,0x00,0x5b,
-0x47,0x88,0x00,0x1b,0x90,0x37,0x07,0xb3,0x14,0x00,0x37,0x00,0x23,0x1b,0x08,0xf7,
-0x1d,0x9b,0xeb,0x50,0x64,0x09,0x13,0x80,0x09,0x64,0x2f,0x07,0xdb,0x39,0x64,0x9d,
-0x0b,0x0a,0x29,0x64,0x0b,0x58,0x1c,0x09,0x64,0x0b,0x23,0xc9,0x09,0x64,0x0b,0x00,
-0x93,0x04,0x64,0x0b,0x04,0xa0,0x00,0x64,0x0b,0x1b,0x00,0x09,0xb2,0x9b,0x00,0xf0,
-0x05,0x57,0x0b,0x0a,0x00,0x00,0xc1,0x0b,0x0b,0x00,0x07,0x94,0xbe,0xbe,0xb5,0x4c,
-0x90,0x0b,0x0a,0x00,0x12,0x05,0x00,0xf6,0x05,0x01,0x97,0xbb,0xbb,0xb6,0x01,0x90,
-0x16,0x06,0x00,0x01,0x90,0xa3,0x04,0xa0,0x01,0x96,0x60,0x00,0x83,0x36,0x00,0xf3,
-0x1e,0x01,0x92,0x79,0xb3,0x30,0x08,0x88,0xc0,0xb0,0xa0,0x1e,0x10,0xb0,0xb1,0x30,
-0xae,0x59,0xe9,0xda,0x90,0x5a,0x00,0xb1,0x83,0x90,0x0a,0x38,0xea,0x7c,0x30,0x0a,
-0x33,0xb0,0x5a,0x10,0x0a,0x00,0xb4,0xbb,0x44,0x0a,0x1a,0x95,0x07,0xc1,0x06,0x04,
-0x00,0x05,0x00,0xf0,0x01,0x75,0xea,0xaa,0xe0,0x01,0xc0,0xb0,0x00,0xb0,0x0b,0xa0,
-0xd9,0x99,0xe0,0x57,0xa0,0x27,0x01,0xf2,0x09,0xa7,0xaa,0xea,0xa6,0x00,0xa0,0x09,
-0xe9,0x00,0x00,0xa0,0x67,0xb7,0x50,0x00,0xa8,0xa0,0xb0,0xb5,0x00,0xa4,0x00,0xb0,
-0x03,0x37,0x00,0x30,0x11,0x00,0x20,0x7a,0x2f,0xf3,0x11,0xb0,0x00,0x00,0xb6,0x99,
-0xb9,0x96,0x09,0x90,0x11,0x11,0x10,0x3c,0x90,0x78,0x88,0x70,0x01,0x90,0x67,0x77,
-0x60,0x00,0x90,0x99,0x99,0x90,0x00,0x90,0xa0,0x00,0xa0,0x05,0x00,0xf1,0x5a,0xd9,
-0x99,0xc0,0x00,0x40,0x04,0x10,0x00,0x02,0x90,0x0e,0x76,0x60,0x09,0x20,0xac,0x35,
-0xb0,0x3f,0x09,0x53,0xbb,0x10,0xbc,0x0b,0x7a,0x79,0xa3,0x1a,0x0a,0x22,0x92,0x01,
-0x0a,0x0a,0x26,0x39,0x10,0x0a,0x0a,0x19,0x71,0xa2,0x0a,0x00,0x02,0x7c,0x40,0x0a,
-0x00,0xa9,0x40,0x00,0x00,0x50,0x05,0x20,0x00,0x04,0x88,0x8b,0xc8,0x84,0x09,0x3b,
-0x12,0x11,0x20,0x2f,0x0a,0x35,0x00,0xa0,0xad,0x0a,0x84,0x99,0xd4,0x2b,0x0c,0xe1,
-0x40,0xa0,0x0b,0x0a,0xa0,0xa0,0xa0,0x0b,0x28,0x90,0x33,0xa0,0x0b,0x64,0x90,0x00,
-0xa0,0x0b,0x81,0x90,0x2a,0x60,0x00,0x05,0x76,0x02,0xf0,0x10,0x8b,0xaa,0xaa,0xe0,
-0x00,0xa2,0xa0,0x06,0x0a,0x00,0x4f,0x0a,0x59,0xc8,0xa0,0x0c,0xc0,0xa0,0x08,0x0a,
-0x00,0x1a,0x0a,0x0c,0x89,0xa0,0x00,0xa0,0xa0,0x80,0x9a,0xf6,0x17,0xd2,0x85,0xa0,
-0x00,0xa0,0xba,0xaa,0xae,0x00,0x0a,0x0a,0x00,0x00,0x90,0x1c,0x04,0xf2,0x1d,0xb0,
-0x05,0x70,0x00,0x05,0x77,0xb9,0x9c,0xa0,0x1e,0x20,0xa0,0x0b,0x00,0xad,0x25,0x96,
-0x7b,0x51,0x19,0x24,0x44,0x44,0x41,0x09,0x13,0xca,0xab,0x60,0x09,0x14,0x60,0x03,
-0x70,0x09,0x14,0xc8,0x8a,0x70,0x09,0x14,0x71,0x15,0x70,0xdb,0x01,0xf2,0x1d,0xaa,
-0xb9,0x48,0x91,0x0a,0x18,0x26,0x0a,0x91,0x3f,0x2d,0x8c,0x5a,0x91,0xac,0x14,0x60,
-0x4a,0x91,0x0a,0x25,0xd5,0x2a,0x91,0x0a,0x13,0xc3,0x1a,0x91,0x0a,0x00,0xb4,0x40,
-0x91,0x0a,0x5c,0xd9,0x30,0x91,0x0a,0x32,0x00,0x0a,0xc0,0x36,0x01,0xf2,0x0f,0xb8,
-0x8b,0xc8,0x80,0x06,0x51,0x19,0x31,0x10,0x2e,0x16,0xb9,0x9a,0x60,0x9b,0x16,0xa8,
-0x8a,0x60,0x09,0x16,0x51,0x14,0x60,0x09,0x16,0xa7,0x79,0x60,0x09,0x0f,0x00,0x83,
-0x40,0x03,0x60,0x09,0x5c,0xba,0xab,0xc3,0x08,0x02,0xf3,0x44,0x02,0xc1,0x00,0x00,
-0xc5,0xb8,0x88,0xb5,0x06,0xb4,0x84,0x44,0x95,0x2c,0xa5,0x85,0x55,0x51,0x12,0xa5,
-0xda,0xcc,0xa7,0x00,0xa6,0xc1,0x77,0x17,0x00,0xa8,0xaa,0xcc,0xa7,0x00,0xa9,0x91,
-0x77,0x17,0x00,0xa7,0x91,0x77,0x75,0x00,0x40,0x02,0x40,0x00,0x00,0xb8,0x9a,0xe9,
-0x94,0x06,0x50,0x66,0x66,0x40,0x2f,0x11,0xa2,0x23,0xa0,0xac,0x11,0x98,0x88,0x60,
-0x09,0x1b,0x88,0x88,0x96,0x09,0x19,0x99,0x99,0x86,0x09,0x10,0x00,0xa0,0x00,0x05,
-0x00,0x22,0x5a,0x70,0x68,0x0a,0xf3,0x19,0x29,0xd9,0xd0,0x1a,0x09,0x2a,0x0a,0x09,
-0xa2,0xf0,0xd9,0xd0,0x9a,0xbc,0x0a,0x1b,0x09,0xa2,0xa0,0xc8,0xd0,0x9a,0x0a,0x0a,
-0x1b,0x09,0xa0,0xa0,0x99,0x90,0x6a,0x0a,0x0a,0x2b,0x00,0xa0,0xa5,0x40,0x51,0x6c,
-0x62,0x02,0xf0,0x16,0x95,0x3a,0x20,0x07,0x37,0xb9,0x8c,0x60,0x0e,0x4a,0xdc,0xbd,
-0xa2,0x9e,0x06,0xa0,0x00,0x00,0x4a,0x7f,0xbb,0xc9,0xb0,0x0a,0x28,0x99,0xb7,0xb0,
-0x0a,0x07,0xaa,0xc8,0xb0,0x0a,0x07,0x33,0x70,0x05,0x00,0x23,0x76,0x80,0x96,0x02,
-0xf4,0x20,0xb7,0x69,0xa6,0x61,0x00,0x66,0x58,0xab,0x87,0x00,0x2f,0x19,0x68,0xa6,
-0xc0,0x0b,0xb1,0x98,0x9b,0x7c,0x00,0x09,0x24,0x48,0xa9,0x90,0x00,0x92,0x65,0x54,
-0xc6,0x20,0x09,0x4a,0xc9,0x9e,0x93,0x00,0x91,0x0b,0x20,0xb0,0x00,0x09,0x10,0x14,
-0x9b,0xcd,0x02,0xf0,0x25,0x0a,0x2a,0x32,0xc2,0x00,0x05,0x75,0xc6,0x5d,0x51,0x01,
-0xe1,0x05,0xac,0x80,0x00,0xbc,0x17,0x89,0xb7,0xc0,0x01,0x91,0x69,0xac,0x8b,0x00,
-0x09,0x15,0x79,0xb7,0x70,0x00,0x91,0x38,0xac,0x86,0x00,0x09,0x10,0x03,0x80,0x00,
-0x00,0x92,0x99,0xac,0x99,0x30,0x00,0x20,0x21,0x15,0x05,0xf2,0x1c,0xd9,0xa2,0x00,
-0x06,0x7a,0x41,0xb1,0x00,0x1e,0x7e,0x8b,0xa8,0xb0,0xad,0x19,0x9d,0x98,0xa0,0x19,
-0x14,0xba,0x02,0x50,0x09,0x36,0x4a,0xbd,0x10,0x09,0x3a,0x67,0xb7,0x30,0x09,0x14,
-0xa3,0xa1,0xc2,0x09,0x46,0x2a,0x60,0x11,0x69,0x00,0xf8,0x22,0x40,0x50,0x05,0x00,
-0x02,0xa8,0xda,0x8d,0x80,0x09,0x33,0x48,0xa4,0x30,0x4f,0x02,0x47,0x94,0x20,0xbc,
-0x38,0xac,0xaa,0x92,0x0a,0x38,0xd4,0x65,0x80,0x0a,0x48,0xd8,0xab,0x93,0x0a,0x25,
-0xd9,0x4a,0x80,0x0a,0x34,0xc0,0x3e,0x13,0x0a,0x06,0xb2,0x94,0xb4,0x44,0x04,0xf3,
+0xf7,0x00,0x01,0x00,0x2f,0xfd,0x00,0x01,0x00,0x03,0x13,0xf8,0x08,0x00,0x08,0x2e,
+0x00,0xce,0xfc,0xfb,0x00,0xfe,0xfb,0x00,0xfa,0x00,0x00,0x00,0x01,0x00,0x01,0x00,
+0x4e,0x02,0x01,0x00,0x02,0x16,0x00,0x2f,0xf3,0x00,0x01,0x00,0x15,0x1f,0xef,0x1e,
+0x00,0x0a,0x03,0x88,0x00,0xb1,0xfb,0x00,0xff,0x00,0x00,0xf6,0xff,0xf9,0xfb,0x00,
+0xf9,0x11,0x00,0x00,0x0f,0x00,0x4d,0xff,0xff,0xfc,0xfd,0x92,0x00,0x6f,0xfe,0x00,
+0xfe,0x00,0x00,0xfc,0x4a,0x00,0x01,0x1c,0xfe,0x0a,0x00,0x19,0xff,0x1f,0x00,0x16,
+0xff,0x00,0x01,0x13,0xfe,0x48,0x00,0x3f,0xfe,0xfd,0xfe,0x9c,0x00,0x0a,0x15,0x02,
+0x3c,0x00,0x11,0xff,0x3f,0x00,0x26,0xff,0xfe,0x30,0x00,0x11,0xee,0x04,0x01,0x15,
+0xeb,0x24,0x00,0x00,0x4b,0x00,0x13,0xfe,0x04,0x00,0x08,0x01,0x00,0x13,0x01,0x70,
+0x00,0x1f,0x01,0x6b,0x00,0x08,0x1f,0xfe,0x43,0x01,0x0d,0x1b,0xfb,0x25,0x00,0x12,
+0xfe,0x67,0x00,0x31,0xfe,0xfd,0xfb,0x0f,0x00,0x14,0xe6,0x6c,0x00,0x97,0xfb,0x00,
+0x00,0xeb,0xfc,0xf2,0xf5,0x00,0xed,0x08,0x02,0x25,0xf6,0xf9,0x0c,0x00,0x75,0xe7,
+0x00,0x00,0x00,0xf5,0x00,0xf0,0x48,0x01,0x21,0xff,0xff,0x17,0x01,0x1f,0x01,0xf7,
+0x01,0x01,0x10,0xfd,0x63,0x00,0x1f,0xfd,0x97,0x00,0x0b,0x3e,0xfa,0x00,0xff,0x8c,
+0x01,0x03,0x7b,0x02,0xb1,0xef,0xee,0x00,0x00,0xfa,0xfe,0xed,0xff,0x01,0x00,0x01,
+0x60,0x00,0xd3,0xf7,0xf8,0x00,0xf7,0xf8,0xfa,0xf7,0x00,0xf9,0xfa,0xfc,0xfa,0xfb,
+0x5e,0x01,0x66,0xee,0xfd,0x00,0x00,0xfa,0xff,0x2b,0x01,0x50,0xfc,0xfd,0x00,0x00,
+0xfc,0x44,0x01,0x14,0xff,0x8b,0x02,0x42,0x01,0x00,0xf6,0xfb,0x51,0x00,0x13,0x01,
+0x24,0x00,0x04,0x68,0x01,0x27,0xff,0x00,0xaf,0x02,0x14,0xfc,0x20,0x01,0x15,0x01,
+0x51,0x01,0x27,0xfe,0x00,0x8c,0x01,0xf0,0x00,0xfe,0x02,0xfc,0xf0,0xfc,0x00,0x00,
+0xf9,0xfe,0xf9,0xff,0x01,0xf9,0x01,0x01,0x92,0x00,0x90,0xfa,0xfb,0xfe,0xfd,0xfb,
+0xfd,0xfb,0xfe,0xfd,0x4c,0x01,0x16,0x01,0xc5,0x00,0x09,0xa8,0x01,0x03,0x48,0x00,
+0x08,0xf8,0x01,0x06,0x9e,0x02,0x0f,0xab,0x01,0x07,0x0f,0x01,0x00,0x06,0x1f,0xff,
+0xf0,0x01,0x10,0x11,0xff,0x97,0x01,0x0e,0x5f,0x00,0x0f,0x4f,0x00,0x07,0x0f,0x1d,
+0x00,0x0a,0x1e,0x01,0xbd,0x03,0x19,0x01,0x81,0x00,0x16,0x01,0x14,0x04,0x0f,0x01,
+0x00,0x1e,0x0b,0xc9,0x00,0x1f,0xf5,0x90,0x00,0x0b,0x05,0xd7,0x01,0x1c,0xf6,0x31,
+0x02,0x11,0xff,0x93,0x00,0x10,0x04,0x2b,0x02,0x0f,0x6f,0x00,0x15,0x17,0x01,0xcc,
+0x04,0x06,0xa7,0x03,0x1d,0x01,0x14,0x01,0x1f,0xf6,0xd8,0x00,0x24,0x1f,0xfe,0x7d,
+0x01,0x10,0x1f,0xff,0x3d,0x00,0x1c,0x03,0x8c,0x01,0x30,0x02,0x03,0x00,0xed,0x00,
+0x2d,0x04,0x05,0x21,0x00,0xf1,0x0c,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,
+0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,
+0x18,0x19,0x20,0x00,0xff,0x0d,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,
+0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,
+0x28,0x00,0x01,0x00,0xff,0xff,0xc5,0x02,0x33,0x03,0x20,0x03,0x02,0x2e,0x03,0x4b,
+0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,
+0x21,0x0c,0x00,0x08,0x00,0xf1,0x08,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,
+0x14,0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,
+0xff,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,
+0x00,0x00,0x23,0x73,0x00,0x02,0x1f,0x24,0x2d,0x03,0xff,0xff,0xa8,0x50,0x00,0x00,
+0x00,0x00,0x00,0xf0,0x1a,0x2c,0x2b,0x2b,0x2b,0x2b,0x17,0x00,0x2b,0x55,0xa5,0x59,
+0x32,0x60,0x00,0x55,0x55,0x00,0x08,0x29,0x20,0x0c,0xec,0xec,0x00,0x0b,0x0b,0x00,
+0x00,0xa0,0xa0,0x05,0xce,0xcd,0x80,0x05,0x56,0x50,0x00,0x82,0x92,0x00,0x01,0x00,
+0xf0,0x85,0x74,0x00,0x05,0xdc,0x30,0x1d,0x14,0xd0,0x2c,0x00,0x80,0x0b,0xa3,0x00,
+0x00,0x5c,0x70,0x23,0x00,0xd0,0x4b,0x01,0xe0,0x09,0xed,0x50,0x00,0x83,0x00,0x1b,
+0xb1,0x00,0x07,0x45,0x63,0x70,0x64,0x55,0xa0,0x01,0xa9,0x65,0x00,0x00,0x0a,0x6a,
+0x40,0x08,0x3b,0x0b,0x01,0x90,0xb0,0xb0,0x00,0x08,0xa6,0x05,0xdc,0x10,0x00,0xd1,
+0x67,0x00,0x0c,0x3a,0x40,0x00,0x5f,0x70,0x00,0x1d,0xa9,0x07,0x07,0x80,0xc8,0x90,
+0x59,0x02,0xf4,0x00,0x9b,0xc9,0xc0,0x73,0x73,0x41,0x00,0x71,0x04,0x90,0x0b,0x10,
+0x1c,0x00,0x4a,0x00,0x59,0x00,0x49,0x00,0x2b,0x00,0x0d,0x00,0x09,0x40,0x01,0xb0,
+0x00,0x21,0x81,0x03,0xa0,0x0b,0x20,0x67,0x04,0xa0,0x2b,0x03,0xb0,0x49,0x08,0x50,
+0xc0,0x76,0x03,0x00,0x03,0x80,0x07,0x69,0x80,0x3b,0xe5,0x01,0xca,0x30,0x13,0x13,
+0x00,0x00,0x83,0x00,0x00,0xa4,0x03,0x00,0x32,0x9f,0xff,0xf3,0x09,0x00,0xf6,0x28,
+0x67,0x85,0x70,0xad,0x70,0x01,0x3b,0x00,0x1a,0x00,0x74,0x00,0xb0,0x02,0x90,0x08,
+0x40,0x0c,0x00,0x38,0x00,0x83,0x00,0x60,0x00,0x08,0xdc,0x30,0x2c,0x03,0xc0,0x58,
+0x00,0xe0,0x67,0x00,0xd0,0x67,0x00,0xd0,0x58,0x00,0xe0,0x2c,0x03,0xb0,0x07,0xdc,
+0x30,0x03,0x98,0x2b,0x99,0x00,0x59,0x02,0x00,0xf0,0x6e,0x09,0xdd,0x30,0x5a,0x03,
+0xc0,0x32,0x01,0xd0,0x00,0x07,0x80,0x00,0x3c,0x00,0x01,0xd2,0x00,0x0b,0x40,0x00,
+0x6f,0xdd,0xd3,0x0a,0xdd,0x35,0x80,0x2c,0x00,0x04,0xb0,0x1d,0xf2,0x00,0x04,0xb2,
+0x20,0x0e,0x5a,0x03,0xc0,0xad,0xc2,0x00,0x0d,0x60,0x00,0x7e,0x60,0x01,0xc8,0x60,
+0x0a,0x38,0x60,0x4a,0x08,0x60,0xad,0xde,0xe5,0x00,0x08,0x60,0x00,0x08,0x60,0x0a,
+0xff,0xf0,0x0c,0x10,0x00,0x0d,0x00,0x00,0x0e,0xdd,0x50,0x04,0x02,0xe0,0x00,0x00,
+0xb2,0x1c,0x00,0xd1,0x06,0xdd,0x60,0x01,0xae,0x10,0x0b,0x80,0x00,0x1d,0x00,0x00,
+0x4c,0xcd,0x40,0x5d,0x12,0xe0,0x49,0x00,0xc1,0x1d,0x01,0xd0,0x05,0xdd,0x40,0x8d,
+0xdd,0xf2,0x00,0x01,0xc0,0x00,0x07,0x60,0x34,0x00,0x70,0x49,0x00,0x00,0xb3,0x00,
+0x01,0xd0,0x4a,0x00,0xf0,0x5b,0x09,0xdd,0x40,0x3c,0x02,0xd0,0x2c,0x03,0xc0,0x09,
+0xef,0x30,0x3c,0x03,0xc0,0x67,0x00,0xd0,0x4b,0x02,0xd0,0x08,0xdd,0x40,0x09,0xdc,
+0x15,0xa0,0x5a,0x76,0x00,0xd4,0xb0,0x4f,0x08,0xd8,0xe0,0x00,0x3c,0x00,0x0b,0x60,
+0x7e,0x70,0x3a,0x01,0x00,0x00,0x01,0x3a,0x58,0x01,0x00,0x00,0x12,0x58,0x84,0x30,
+0x00,0x18,0x40,0x8d,0x70,0x9c,0x10,0x00,0x7d,0x81,0x00,0x08,0x40,0x3e,0xee,0xb0,
+0x00,0x00,0x3e,0xee,0xb0,0x49,0x10,0x00,0x6d,0x91,0x00,0x0a,0xc1,0x7d,0x81,0x48,
+0x10,0x00,0x1c,0xea,0x08,0x60,0xb3,0x00,0x0a,0x30,0x04,0xc0,0x00,0xd1,0x00,0x27,
+0xdc,0x01,0xf0,0x7c,0x3a,0x00,0x00,0x3b,0xbb,0x80,0x00,0x3a,0x00,0x04,0x90,0x0b,
+0x02,0xba,0x18,0x22,0x80,0xb1,0x92,0x35,0x55,0x1a,0x0a,0x12,0x76,0x44,0x80,0xb0,
+0x36,0x56,0x38,0x0d,0x07,0x31,0xa0,0xb9,0x7a,0x80,0x09,0x50,0x00,0x00,0x00,0x07,
+0xba,0xa0,0x00,0x00,0x5d,0x00,0x00,0x0a,0xd2,0x00,0x00,0xd5,0x80,0x00,0x59,0x0d,
+0x00,0x0a,0x30,0xb3,0x00,0xfd,0xde,0x80,0x59,0x00,0x1d,0x0b,0x40,0x00,0xb3,0x2f,
+0xdd,0xb0,0x2c,0x00,0x96,0x2c,0x00,0xa5,0x2f,0xde,0xc0,0x2c,0x00,0x97,0x2c,0x00,
+0x5a,0x2c,0x00,0x97,0x2f,0xdd,0xa0,0x03,0xcd,0xb2,0x00,0xd3,0x05,0xb0,0x4a,0x00,
+0x09,0x06,0x80,0x00,0x00,0x68,0x00,0x00,0x04,0xa0,0x00,0x80,0x0d,0x30,0x5b,0x00,
+0x3c,0xdb,0x10,0x2f,0xed,0x70,0x2c,0x00,0xb6,0x2c,0x00,0x2c,0x2c,0x00,0x0e,0x03,
+0x00,0x00,0x09,0x00,0xd1,0xb6,0x2f,0xde,0x70,0x2f,0xdd,0xd4,0x2c,0x00,0x00,0x2c,
+0x00,0x00,0x55,0x00,0x14,0x00,0x0c,0x00,0x47,0xd4,0x2f,0xdd,0xd3,0x0f,0x00,0x15,
+0xa0,0x0c,0x00,0xa1,0x03,0xcd,0xc2,0x00,0xd3,0x04,0xc0,0x4b,0x00,0x06,0x64,0x00,
+0xf0,0x05,0x06,0xde,0x14,0xb0,0x00,0xd1,0x0d,0x40,0x1e,0x10,0x2c,0xed,0x60,0x2c,
+0x00,0x0a,0x42,0xc0,0x00,0xa4,0x07,0x00,0x36,0xfd,0xdd,0xf4,0x0e,0x00,0x00,0x07,
+0x00,0x13,0x1d,0x01,0x00,0x53,0x00,0x03,0xc0,0x00,0x3c,0x05,0x00,0xf5,0x15,0xc3,
+0x00,0x3b,0x96,0x07,0x91,0xcd,0xb1,0x2c,0x00,0x7a,0x02,0xc0,0x4d,0x00,0x2c,0x2d,
+0x20,0x02,0xcd,0x60,0x00,0x2f,0xad,0x00,0x02,0xc0,0x89,0x00,0x2c,0x00,0xd4,0x02,
+0xc0,0x03,0xd0,0x79,0x00,0x08,0x03,0x00,0xf1,0x52,0x2f,0xdd,0xd1,0x2f,0x30,0x00,
+0x7e,0x2f,0x90,0x00,0xde,0x2b,0xd0,0x03,0xbe,0x2b,0x94,0x09,0x5e,0x2c,0x4a,0x0d,
+0x0e,0x2c,0x0d,0x59,0x0e,0x2c,0x08,0xe4,0x0e,0x2c,0x02,0xe0,0x0e,0x2f,0x10,0x0a,
+0x42,0xfa,0x00,0xa4,0x2c,0xd3,0x0a,0x42,0xc4,0xc0,0xa4,0x2c,0x0b,0x6a,0x42,0xc0,
+0x2e,0xb4,0x2c,0x00,0x8f,0x42,0xc0,0x00,0xe4,0x02,0xce,0xb1,0x00,0xd4,0x05,0xc0,
+0x4b,0x00,0x0d,0x26,0x80,0x00,0xa4,0x68,0x00,0x0a,0x44,0xb0,0x00,0xd2,0x0d,0x40,
+0x5c,0x00,0x2c,0xeb,0x10,0x2f,0xed,0xc2,0x2c,0x00,0x5b,0x22,0x01,0x46,0x5b,0x2f,
+0xdd,0xb2,0xf8,0x00,0xf1,0x16,0xce,0xb1,0x00,0xd3,0x06,0xb0,0x4a,0x00,0x0d,0x17,
+0x70,0x00,0xb3,0x77,0x00,0x0b,0x35,0xa0,0x00,0xd1,0x0d,0x30,0x6b,0x00,0x3c,0xef,
+0x40,0x00,0x00,0x4d,0x10,0x00,0x00,0x00,0x2f,0xee,0xa0,0x8e,0x01,0xfe,0x1f,0x4a,
+0x2c,0x00,0xa7,0x2f,0xde,0xa0,0x2c,0x04,0xb0,0x2c,0x00,0xc3,0x2c,0x00,0x4b,0x07,
+0xdd,0x80,0x3c,0x00,0xb5,0x5b,0x00,0x22,0x0b,0xb5,0x00,0x00,0x3a,0xd1,0x32,0x00,
+0x87,0x6a,0x00,0x96,0x08,0xdd,0xa0,0xad,0xee,0xda,0x00,0x77,0x00,0x03,0x00,0x38,
+0x59,0x00,0x1d,0x03,0x00,0xf0,0x45,0x4a,0x00,0x2c,0x1d,0x10,0x79,0x05,0xde,0xa1,
+0xb4,0x00,0x0e,0x15,0x90,0x04,0xb0,0x1e,0x00,0x96,0x00,0xb3,0x0d,0x10,0x06,0x83,
+0xb0,0x00,0x1d,0x86,0x00,0x00,0xbe,0x10,0x00,0x06,0xc0,0x00,0x95,0x00,0xf0,0x06,
+0x86,0x80,0x4f,0x40,0x95,0x2b,0x08,0x98,0x0c,0x10,0xe0,0xc1,0xb0,0xd0,0x0b,0x3c,
+0x0c,0x3a,0x00,0x89,0x80,0x89,0x70,0x04,0xf4,0x04,0xf4,0x00,0x1f,0x00,0x0f,0x00,
+0x6b,0x00,0x7a,0x0d,0x41,0xe2,0x04,0xd9,0x80,0x00,0xbe,0x37,0x00,0xf6,0x08,0x04,
+0xc8,0x90,0x0d,0x30,0xe2,0x6a,0x00,0x6b,0xa5,0x00,0x6a,0x3d,0x00,0xd2,0x0b,0x45,
+0xb0,0x03,0xcc,0x30,0x00,0xbb,0x88,0x00,0xf6,0x0e,0x7d,0xdd,0xf6,0x00,0x01,0xe1,
+0x00,0x0b,0x50,0x00,0x4c,0x00,0x00,0xd2,0x00,0x08,0x80,0x00,0x2d,0x00,0x00,0x9f,
+0xdd,0xd8,0x4d,0x74,0xa0,0x4a,0x04,0x03,0x00,0x60,0x4e,0x70,0xa3,0x00,0x04,0x90,
+0x5c,0x03,0x40,0x94,0x00,0x03,0xa0,0x08,0x00,0x94,0x85,0x00,0x02,0xa0,0x00,0x06,
+0x00,0xcc,0x0e,0x01,0x00,0xf4,0x63,0xcc,0x06,0x90,0x0c,0xc0,0x2a,0x84,0x85,0x2a,
+0xdd,0xdd,0x60,0x44,0x00,0xc1,0x09,0xdc,0x22,0x60,0x4a,0x07,0xbc,0xb5,0xa0,0x3b,
+0x69,0x07,0xb0,0xcd,0x9b,0x59,0x00,0x00,0x59,0x00,0x00,0x5c,0xcd,0x40,0x5c,0x02,
+0xd0,0x59,0x00,0xc1,0x59,0x00,0xc1,0x5c,0x02,0xd0,0x5b,0xce,0x40,0x08,0xdc,0x34,
+0xb0,0x2c,0x86,0x00,0x17,0x60,0x00,0x4b,0x02,0xb0,0x8d,0xc2,0x00,0x00,0xe0,0x00,
+0x0e,0x09,0xda,0xe4,0xb0,0x2e,0x76,0x00,0xe7,0x60,0x0e,0x4b,0x02,0xe0,0x9c,0xae,
+0x07,0xdc,0x33,0xa0,0x2c,0x7e,0xdd,0xd7,0x70,0x00,0x4c,0x01,0x60,0x8d,0xd4,0x03,
+0xd6,0x0c,0x30,0x0d,0x00,0x8f,0xc1,0x0e,0x00,0x02,0x00,0x43,0x09,0xda,0xe4,0xc0,
+0x30,0x00,0xf1,0x09,0x03,0xe0,0x9e,0xae,0x03,0x03,0xc0,0x9d,0xc3,0x59,0x00,0x05,
+0x90,0x00,0x5b,0xbe,0x45,0xc0,0x3c,0x59,0x01,0xd5,0x90,0x1d,0x05,0x00,0x31,0x3a,
+0x00,0x3a,0x01,0x00,0x62,0x04,0x90,0x00,0x04,0x90,0x49,0x03,0x00,0x32,0x05,0x94,
+0xe4,0x9b,0x00,0xf3,0x04,0x59,0x0b,0x60,0x59,0x89,0x00,0x5d,0xe0,0x00,0x5d,0xb6,
+0x00,0x59,0x1d,0x10,0x59,0x05,0xb0,0x3a,0x01,0x00,0xf5,0x03,0x5b,0xcd,0x5b,0xe8,
+0x05,0xb0,0x3f,0x10,0xe0,0x59,0x01,0xd0,0x0d,0x15,0x90,0x1d,0x00,0xd1,0x09,0x00,
+0x0b,0x61,0x00,0xf6,0x08,0x07,0xdd,0x40,0x4c,0x02,0xd0,0x86,0x00,0xb2,0x76,0x00,
+0xb3,0x3c,0x01,0xe0,0x07,0xdd,0x40,0x5c,0xbd,0x40,0x5b,0x01,0xf1,0x00,0x32,0x5c,
+0xcd,0x40,0x6e,0x00,0x36,0x09,0xda,0xd4,0xe3,0x00,0x21,0x9d,0xae,0xf7,0x00,0x55,
+0x00,0x00,0x5c,0xd3,0x5c,0x46,0x05,0xf6,0x0c,0x0a,0xdc,0x14,0xa0,0x56,0x1d,0x82,
+0x00,0x05,0xc5,0x67,0x05,0x90,0xad,0xc2,0x07,0x00,0xe0,0xbf,0xa0,0xe0,0x0e,0x00,
+0xe0,0x0e,0x00,0xac,0x71,0x00,0xf4,0x66,0x3b,0x04,0xd0,0xbd,0xad,0xb3,0x06,0x75,
+0x80,0xb2,0x1c,0x0d,0x00,0xb6,0x80,0x06,0xe3,0x00,0x1e,0x00,0xa3,0x0c,0x30,0xb2,
+0x67,0x0e,0x80,0xd0,0x2b,0x47,0xc3,0xa0,0x0d,0x92,0xb8,0x60,0x0a,0xd0,0x6f,0x20,
+0x06,0x90,0x2e,0x00,0x79,0x0a,0x60,0xd5,0xc0,0x04,0xf3,0x00,0x5f,0x40,0x0d,0x3d,
+0x08,0x80,0x97,0xb3,0x08,0x76,0x80,0xc2,0x1d,0x1c,0x00,0xb7,0x70,0x06,0xf2,0x00,
+0x1d,0x00,0x06,0x70,0x08,0xd1,0x00,0x7d,0xdf,0x70,0x02,0xd0,0x00,0xb4,0x00,0x6a,
+0x00,0x1d,0x10,0x08,0xed,0xd8,0x00,0x82,0x06,0x80,0x0a,0x40,0x0a,0x30,0x0c,0x10,
+0xaa,0x00,0x0c,0x10,0x0a,0x30,0x0a,0x40,0x06,0x80,0x00,0x82,0x29,0x01,0x00,0xf5,
+0x6f,0x14,0x82,0x00,0x2c,0x00,0x0e,0x00,0x0d,0x00,0x0b,0x30,0x04,0xf0,0x0b,0x20,
+0x0d,0x00,0x0e,0x00,0x2c,0x00,0x82,0x00,0x0b,0xd6,0x0b,0x13,0x70,0x9e,0x80,0x00,
+0x00,0xa3,0x00,0x00,0x00,0x0d,0xd3,0x00,0xed,0xdd,0xc2,0xd3,0x0d,0x00,0x00,0x02,
+0xd2,0xd0,0x00,0x00,0x4c,0x1c,0xdd,0xde,0x3d,0x10,0x00,0x00,0xdd,0x10,0x00,0x00,
+0x08,0x20,0x00,0x00,0x02,0xb0,0x00,0x00,0x02,0xde,0x00,0x00,0x02,0xd3,0xad,0xdd,
+0xe2,0xd3,0x00,0x00,0x0d,0x1d,0x50,0x00,0x00,0xd0,0x1c,0x5c,0xdd,0xdc,0x00,0x1c,
+0xf0,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x01,0x10,0x00,0x00,0x2d,0xd2,0x00,0x02,
+0xd3,0x3d,0x20,0x2d,0x30,0x03,0xd2,0x8d,0xe0,0x0e,0xd8,0x00,0xd0,0x0d,0x00,0x04,
+0x00,0xb8,0xdd,0xdd,0x00,0x00,0x11,0x11,0x00,0x00,0xdb,0xbd,0x00,0x18,0x00,0xf2,
+0x01,0xaf,0xc0,0x0c,0xfa,0x1c,0x50,0x05,0xc1,0x01,0xc5,0x5c,0x10,0x00,0x1c,0xc1,
+0x00,0x01,0x00,0x40,0x22,0x00,0x00,0x00,0xff,0x02,0xf1,0x0f,0x00,0x03,0xee,0x30,
+0x00,0x00,0x0c,0x77,0xb0,0x00,0x00,0x4e,0x00,0xe4,0x00,0x00,0xc5,0x00,0x6c,0x00,
+0x05,0xe2,0x22,0x2e,0x50,0x0d,0xff,0xff,0xff,0xd0,0x2b,0x00,0xf1,0x10,0x01,0x4d,
+0xd3,0x05,0xd8,0xc3,0x4b,0x3d,0x10,0xff,0xf5,0xa5,0x02,0xfe,0x78,0xb2,0x05,0x90,
+0x2b,0x96,0x00,0x00,0x69,0x2d,0x30,0x03,0xd1,0x03,0xcd,0xdc,0x30,0x98,0x00,0xf0,
+0x1f,0x08,0xcc,0x61,0x00,0x01,0xd3,0xee,0x3d,0x10,0x0b,0x70,0x44,0x07,0xb0,0x1a,
+0x20,0x00,0x01,0xc1,0x1a,0x10,0x00,0x01,0xb1,0x0b,0x50,0x00,0x05,0x90,0x04,0xc5,
+0x00,0x5a,0x60,0x00,0x4a,0xec,0x95,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x10,0x77,
+0x00,0xf0,0x17,0xeb,0xcd,0x91,0x00,0x1e,0x29,0xb1,0x4d,0x30,0x0c,0x90,0xb7,0x02,
+0xc0,0x0d,0x9c,0xc1,0x00,0xc2,0x0d,0x05,0x10,0x00,0xb3,0x0a,0x50,0x00,0x01,0xd0,
+0x02,0xd3,0x00,0x1b,0x50,0x00,0x2b,0xdd,0xd5,0x7f,0x00,0x10,0x00,0xd7,0x00,0xf2,
+0x11,0x10,0x00,0xef,0xff,0xf4,0x03,0xe0,0x00,0xd0,0x07,0x90,0x08,0x70,0x06,0xc0,
+0x97,0x00,0x4c,0xc5,0xd0,0x00,0x94,0x97,0xb2,0x00,0x77,0x00,0xd0,0x00,0x0b,0xcd,
+0x50,0x56,0x00,0xf0,0x10,0x04,0x43,0x00,0x00,0x0f,0xfc,0x00,0x1c,0x98,0x88,0x88,
+0x18,0x02,0x22,0x09,0x18,0x3b,0xba,0x09,0x08,0x15,0x54,0x09,0x08,0x27,0x76,0x09,
+0x0c,0x99,0x99,0x88,0x1c,0x00,0x31,0x00,0x02,0x21,0xd6,0x00,0xf2,0x39,0x20,0x04,
+0xcf,0xf8,0xb8,0x6f,0x71,0x32,0x91,0xb9,0x00,0x00,0x90,0x05,0xa0,0x00,0x90,0x09,
+0x50,0x00,0x92,0xd4,0x00,0x00,0xb9,0x9d,0x30,0x00,0x30,0x08,0xfe,0xfa,0x00,0x00,
+0x13,0x30,0x14,0x44,0x44,0x41,0x85,0xf8,0x44,0x58,0x90,0x62,0x7e,0xf8,0x91,0xf6,
+0x4d,0xf8,0x90,0x62,0x00,0x08,0x91,0xf6,0x00,0x08,0x90,0x83,0x00,0x08,0x90,0xe6,
+0x00,0x08,0x89,0xfc,0x99,0x98,0x4f,0x01,0xf2,0x17,0x3b,0xee,0xb2,0x00,0x04,0xd3,
+0x99,0x3d,0x40,0x0d,0x20,0x99,0x02,0xd0,0x1c,0x00,0x76,0x20,0xc2,0x1b,0x1a,0x97,
+0xa7,0xc2,0x0c,0xa9,0x51,0x8a,0xd0,0x03,0xf6,0x00,0x3d,0x30,0x00,0x2a,0xee,0xa2,
+0x2c,0x00,0xf1,0x1e,0x03,0xdd,0x90,0x00,0x00,0x0d,0x20,0x86,0x02,0x00,0x0d,0x00,
+0x49,0xef,0xa0,0x09,0x84,0xc9,0xff,0xf0,0x00,0xde,0xeb,0xff,0xb0,0x09,0x55,0xff,
+0xff,0x70,0x0c,0x1f,0xff,0xff,0xe0,0x0e,0xdf,0xff,0xff,0xf0,0x00,0x01,0x22,0x22,
+0x10,0xff,0x00,0x10,0x0a,0x28,0x07,0xf0,0x0d,0xa5,0x00,0x9a,0xa9,0x9f,0x60,0x89,
+0x99,0x99,0x92,0x2e,0xff,0xff,0xfe,0x02,0xd6,0x44,0x44,0x00,0x2c,0x20,0x00,0x00,
+0x01,0x90,0x00,0x00,0x00,0xd3,0x00,0xf0,0x15,0x05,0x8a,0x50,0x00,0x00,0x8a,0x76,
+0x70,0x00,0x08,0x63,0x70,0x00,0x15,0x58,0x50,0x00,0x4d,0x21,0x7a,0x00,0x0e,0x88,
+0xf1,0xf5,0x00,0x9b,0x49,0x2f,0x20,0x00,0x89,0x79,0x30,0x00,0x00,0x46,0x08,0xf3,
+0x01,0xea,0x00,0xd0,0x09,0x6a,0x0d,0x00,0x69,0xc2,0xd0,0x00,0x0a,0x2d,0x00,0x00,
+0xa2,0x07,0x00,0x42,0xed,0xdd,0xde,0x10,0xa0,0x00,0x90,0x3a,0x89,0x00,0x00,0x00,
+0xa0,0x02,0xaa,0x30,0x5b,0x00,0xf1,0x0e,0xa0,0x09,0x24,0x8c,0xd3,0x90,0x08,0x18,
+0x66,0x00,0x91,0x08,0x00,0x9f,0x10,0x26,0x08,0x20,0x67,0x30,0x45,0x00,0x88,0x89,
+0x99,0x80,0x00,0x00,0x00,0x52,0x00,0xf5,0x0d,0xe2,0x40,0x00,0x00,0x01,0xf4,0xc0,
+0x00,0x7d,0x7d,0x8d,0x20,0x03,0xb0,0x2e,0x1c,0x20,0x08,0x40,0x06,0xf8,0x00,0x0b,
+0x00,0x00,0xe2,0x00,0x0c,0x05,0x00,0x01,0x01,0x00,0xf1,0x22,0x0a,0x80,0x55,0x91,
+0x1a,0x90,0x04,0x14,0xf9,0x2e,0x70,0x02,0x00,0x00,0x1a,0xb5,0x00,0x00,0x09,0xe0,
+0x08,0xc8,0x10,0x15,0x00,0x00,0x1c,0xcc,0xb0,0x00,0x00,0x3c,0x10,0x05,0xd1,0x00,
+0x41,0x01,0x11,0x11,0x11,0x10,0x3b,0xbb,0xbb,0xbb,0xb9,0x00,0x00,0x28,0x0a,0x06,
+0x05,0x00,0x3b,0x9c,0xbb,0x90,0x14,0x00,0x51,0x2a,0xaa,0xdb,0xaa,0xa7,0x32,0x00,
+0x80,0x2b,0xbb,0xbb,0xbb,0xb7,0x00,0x00,0x56,0x19,0x00,0x10,0x58,0x05,0x00,0x80,
+0x5d,0xb3,0x00,0x00,0x00,0x56,0x2c,0x80,0x14,0x00,0x13,0x50,0x19,0x00,0x04,0x05,
+0x00,0x80,0x0b,0xbb,0xbb,0xbb,0xb5,0x00,0x00,0x1d,0xf1,0x00,0xf0,0x01,0xc9,0x10,
+0x00,0x00,0x09,0xa9,0xb6,0x00,0x01,0xc7,0x39,0x09,0x90,0x1d,0x40,0x39,0x0e,0x06,
+0x37,0x39,0x00,0x00,0x05,0x00,0xf0,0x1d,0x32,0x00,0x06,0x00,0x00,0x2b,0x00,0x3a,
+0x00,0x09,0x9d,0x99,0xca,0x93,0x01,0x15,0x83,0xa1,0x10,0x04,0x53,0x71,0x90,0xb0,
+0x00,0xb3,0x71,0x94,0x80,0x00,0xb4,0x71,0x99,0x20,0x00,0x34,0x71,0x94,0x00,0x2a,
+0xab,0xda,0xda,0xa6,0x8c,0x00,0xd4,0x11,0x00,0x09,0x20,0x00,0xbb,0xbe,0xcb,0xb5,
+0xb0,0x09,0x20,0x37,0x04,0x00,0x40,0xeb,0xbe,0xcb,0xc7,0x18,0x00,0x05,0x04,0x00,
+0xf0,0x14,0x0a,0x20,0x00,0x08,0xba,0xeb,0xaa,0xb0,0x84,0x1a,0x31,0x1b,0x04,0x88,
+0xd9,0x88,0x60,0xab,0xbe,0xbb,0xbb,0x2b,0x00,0xa2,0x00,0x92,0xda,0xae,0xba,0xad,
+0x26,0x00,0xa2,0x00,0x41,0x24,0x00,0xf3,0x1f,0x00,0x00,0xca,0xaa,0xad,0x40,0x00,
+0xb0,0x80,0x06,0x40,0x00,0xb0,0x3b,0x16,0x40,0x00,0xb0,0x03,0x16,0x40,0x2b,0xeb,
+0xbb,0xbd,0xc7,0x00,0xb0,0x00,0x06,0x40,0x03,0x80,0x00,0x06,0x40,0x0c,0x20,0x00,
+0x06,0x40,0x38,0x00,0x03,0xbc,0x20,0xdd,0x03,0x10,0x50,0x05,0x00,0xf1,0x08,0x5b,
+0x00,0x00,0x06,0x99,0x9c,0xa9,0x91,0x01,0x11,0x4a,0x11,0x10,0x00,0x00,0x29,0x00,
+0x00,0x02,0xaa,0xbd,0xaa,0x80,0x9c,0x09,0x01,0x0f,0x00,0x01,0x05,0x00,0x53,0x2b,
+0xbb,0xce,0xbb,0xb7,0x32,0x00,0x00,0x8f,0x05,0x80,0x99,0x9c,0x99,0x40,0x01,0x11,
+0x11,0x2d,0x4b,0x00,0x10,0xb5,0xb4,0x01,0xff,0x3f,0x60,0x00,0x00,0x01,0xc6,0x00,
+0x00,0x00,0x4c,0x40,0x00,0x00,0x0b,0xaa,0x21,0x01,0x21,0x25,0x03,0x8a,0xaa,0x94,
+0x00,0x01,0x23,0x58,0x00,0x06,0x99,0xc8,0x42,0x00,0x47,0x77,0xb9,0x77,0x70,0x24,
+0x57,0xa7,0x94,0x40,0x09,0xa7,0x73,0xa9,0x60,0x00,0x47,0x84,0xa1,0x20,0x5a,0x99,
+0xec,0x9a,0xb0,0x00,0x4a,0x85,0xa1,0x00,0x3b,0xa0,0x73,0x2c,0x70,0x43,0x00,0x73,
+0x00,0x71,0x04,0xcc,0xcc,0xcc,0x90,0x00,0x01,0x00,0x05,0x80,0x2c,0xcc,0xcc,0xcc,
+0xc8,0x00,0x00,0x40,0x0c,0x00,0xf2,0x44,0x93,0x00,0x00,0x5b,0xbb,0xbb,0xbb,0xb0,
+0x00,0x75,0x00,0x94,0x00,0x09,0x81,0x00,0x2a,0x60,0x25,0x1b,0x03,0xc0,0x70,0x00,
+0x05,0x8c,0x30,0x00,0x00,0x01,0xeb,0x00,0x00,0x03,0x8b,0x25,0xc7,0x30,0x58,0x30,
+0x00,0x04,0x91,0x00,0x00,0x20,0x00,0x00,0x24,0x44,0xc6,0x44,0x40,0x35,0x55,0x55,
+0x55,0x50,0x04,0xb8,0x88,0x8d,0x00,0x03,0xa7,0x77,0x7b,0x00,0x06,0x99,0x99,0x99,
+0x00,0x00,0x00,0x49,0x82,0x00,0x6a,0xaa,0xdb,0xaa,0xa2,0x32,0x02,0x11,0x29,0xfd,
+0x04,0xf0,0x16,0x51,0x00,0x00,0x6a,0xaa,0xcc,0xaa,0xa1,0x00,0x55,0x55,0x55,0x00,
+0x00,0xc3,0x33,0x3c,0x00,0x00,0xa8,0x88,0x89,0x00,0x49,0x88,0x88,0x88,0xa0,0x65,
+0x09,0x99,0x70,0xa0,0x00,0x1a,0x00,0xb0,0xd7,0x07,0x78,0xb0,0x81,0x4b,0x70,0x00,
+0xaa,0xb0,0xa7,0x00,0x20,0x03,0xe0,0x05,0x00,0xf0,0x02,0xa4,0xa1,0x00,0x00,0x08,
+0xa0,0x02,0xc6,0x00,0x3c,0x52,0x00,0x03,0x7c,0x00,0x00,0xc0,0x30,0x00,0x10,0x0b,
+0xf3,0x02,0x90,0x03,0x90,0x00,0xb0,0x00,0x01,0xc2,0x00,0x0b,0x4b,0x0c,0x00,0x16,
+0x00,0xf1,0x1d,0xa1,0x10,0xb0,0x00,0x04,0x80,0xb0,0xb1,0x50,0x1e,0x20,0xb4,0xea,
+0xc0,0xbc,0x48,0xe6,0xb0,0xb0,0x19,0x32,0xb0,0xb0,0xb0,0x09,0x20,0xb0,0xb9,0x90,
+0x09,0x20,0xb0,0xa0,0x00,0x09,0x20,0xb0,0x00,0x64,0x09,0x20,0x9b,0xaa,0xb1,0x6c,
+0x05,0xf1,0x19,0x60,0x40,0x02,0x90,0x2a,0x08,0x50,0x47,0x02,0xa0,0x0c,0x05,0x60,
+0x2a,0x00,0x10,0x93,0x02,0xa0,0x00,0x0c,0x00,0x2a,0x18,0x14,0xb0,0x04,0xeb,0x31,
+0xda,0x60,0x53,0x05,0xd3,0x0a,0x50,0x01,0x91,0x00,0x06,0x8f,0x00,0xf3,0x18,0x1a,
+0x28,0x80,0x00,0x07,0x4b,0x10,0xe9,0xe1,0xe1,0xa0,0x0b,0x0b,0xad,0x1a,0x00,0xb0,
+0xb2,0x91,0xa0,0x0b,0x0b,0x09,0x1a,0x12,0xb0,0xb0,0x92,0xe9,0x2b,0x8b,0x09,0x10,
+0x00,0xb0,0x00,0x91,0x00,0x0b,0xbd,0x00,0xf1,0x0f,0x66,0x51,0xb0,0x00,0x00,0xc0,
+0xc2,0xc1,0x10,0x09,0xa2,0xd9,0xe9,0x92,0x3b,0x96,0x20,0xb0,0x00,0x01,0x96,0x99,
+0xe9,0x97,0x01,0x90,0x11,0xc1,0x11,0x01,0xba,0x00,0x05,0x05,0x00,0x12,0x00,0xfa,
+0x05,0x01,0x4e,0x03,0xe0,0x13,0x6a,0xb0,0x00,0xc5,0x97,0xc1,0x00,0x08,0xb0,0x00,
+0xb0,0x00,0x5b,0x05,0x00,0x60,0x20,0xb9,0xbb,0xeb,0xb7,0x00,0x0a,0x00,0x03,0x05,
+0x00,0xf7,0x2b,0x11,0xc1,0x10,0x00,0xb4,0x99,0x99,0x95,0x00,0x23,0x02,0x03,0x00,
+0x00,0x93,0x0c,0x08,0x20,0x01,0xb0,0x67,0x03,0x90,0x0b,0x93,0xc0,0x00,0xa4,0x3a,
+0x99,0xab,0xbb,0x99,0x02,0x90,0x08,0x30,0xb0,0x01,0x90,0x0a,0x00,0xb0,0x01,0x90,
+0x1a,0x01,0x90,0x01,0x90,0xa3,0x03,0x80,0x01,0x96,0x60,0x7b,0x30,0x5d,0x01,0xf2,
+0x1d,0x47,0x0c,0x29,0x00,0x00,0xb1,0x0b,0x03,0x60,0x05,0xc3,0x5c,0x9a,0xb2,0x2d,
+0xb6,0x6a,0x61,0x40,0x22,0xb0,0x05,0x67,0x60,0x00,0xb0,0x01,0xc9,0x00,0x00,0xb0,
+0x06,0xf1,0x12,0x00,0xb2,0xb8,0x77,0x36,0x00,0xb6,0x20,0x0a,0xd2,0x32,0x00,0xf1,
+0x1f,0x04,0x00,0x60,0x00,0x06,0x50,0x49,0x00,0x00,0xc1,0xbd,0xcb,0xb0,0x6b,0x19,
+0x00,0x0b,0x2d,0xa1,0x90,0x00,0xb1,0x2a,0x1e,0xbb,0xbe,0x00,0xa1,0x90,0x00,0xb0,
+0x0a,0x19,0x00,0x0b,0x00,0xa1,0xea,0xaa,0xe0,0x0a,0x19,0x00,0x0a,0x00,0x02,0xaf,
+0x04,0xf0,0x13,0xc0,0x0a,0x00,0x00,0x00,0x79,0xac,0xda,0xaa,0x30,0x3f,0x10,0xb0,
+0x50,0x00,0x0b,0xb1,0x8d,0xae,0xaa,0x00,0x09,0x89,0xb0,0xb0,0xb0,0x00,0x92,0x0b,
+0x0b,0x0b,0x00,0x09,0x10,0x0b,0x00,0x51,0x91,0x08,0x0b,0x76,0x00,0x3f,0x01,0x13,
+0x00,0x6a,0x00,0x00,0x22,0x03,0xf0,0x07,0x65,0x00,0xc0,0x00,0x00,0xc1,0xbb,0xcb,
+0xb3,0x0a,0xb0,0x21,0x01,0x40,0x39,0xb0,0x55,0x04,0x80,0x00,0xb0,0x29,0x99,0x03,
+0x10,0x0b,0x2c,0x00,0xf0,0x18,0x0a,0x0b,0x00,0x00,0xb5,0x99,0x9d,0x96,0x00,0xb1,
+0x22,0x22,0x21,0x00,0x13,0x00,0x02,0x60,0x00,0x93,0x8a,0xbd,0x50,0x01,0xc0,0xb0,
+0x0b,0x00,0x0a,0xa0,0xb0,0x0b,0x00,0x5a,0xa0,0xeb,0xbe,0xb8,0x11,0x0a,0x00,0xf3,
+0x05,0x01,0xa0,0xb0,0x09,0x10,0x01,0xa0,0xb0,0x36,0x42,0x01,0xa0,0xb2,0x94,0x98,
+0x01,0xa3,0xc7,0x26,0x96,0x69,0x00,0x50,0x01,0x40,0x00,0x00,0x75,0x69,0x00,0x50,
+0xc4,0xaa,0xba,0xa6,0x0a,0x5a,0x01,0x12,0x39,0x64,0x01,0x38,0xbb,0xeb,0xb3,0x73,
+0x01,0x00,0x23,0x00,0x60,0xb6,0xaa,0xaa,0xa8,0x00,0x13,0x37,0x00,0xa0,0x87,0x99,
+0x99,0x97,0x00,0xc0,0x11,0x11,0xc1,0x09,0x1c,0x00,0xf6,0x03,0x3c,0xb1,0xd9,0xd0,
+0xb0,0x01,0xb1,0x90,0xa0,0xb0,0x00,0xb1,0xda,0xe0,0xb0,0x00,0xb1,0x90,0x3a,0x00,
+0x40,0x6b,0xb0,0x00,0x02,0xd8,0x01,0xf4,0x04,0x57,0x0c,0x00,0x00,0x00,0xc1,0x5e,
+0xbb,0xb9,0x09,0xc1,0xc0,0xb0,0x00,0x3a,0xb7,0x30,0xea,0xa6,0x25,0x00,0x76,0xe9,
+0x96,0x00,0xb0,0x00,0xc1,0x11,0x34,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x11,0x00,
+0x01,0x00,0xf6,0x82,0x05,0x70,0x0b,0x00,0x00,0x00,0xb5,0x88,0xd8,0x88,0x00,0xaa,
+0x29,0x9e,0x99,0x70,0x58,0xa4,0x60,0xb0,0x0b,0x00,0x0a,0x4c,0x9e,0x9a,0xb0,0x00,
+0xa0,0x70,0xb0,0x00,0x00,0x0a,0x06,0xb7,0x00,0x00,0x00,0xa0,0x4d,0xb6,0x10,0x00,
+0x0a,0x98,0x00,0x6b,0xb0,0x00,0x00,0x37,0x00,0x00,0x0b,0xbb,0xcd,0xbb,0xb5,0x00,
+0x83,0x37,0x0b,0x00,0x00,0xe3,0x37,0x2e,0x10,0x0a,0x5a,0x7c,0xb3,0xc2,0x05,0x05,
+0xdd,0xa0,0x11,0x00,0x5b,0x47,0x88,0x00,0x1b,0x90,0x37,0x07,0xb3,0x14,0x00,0x37,
+0x00,0x23,0x00,0x10,0x00,0x00,0x00,0x03,0x9b,0xeb,0x50,0x64,0x09,0x13,0x80,0x09,
+0x64,0x2f,0x07,0xdb,0x39,0x64,0x9d,0x0b,0x0a,0x29,0x64,0x0b,0x58,0x1c,0x09,0x64,
+0x0b,0x23,0xc9,0x09,0x64,0x0b,0x00,0x93,0x04,0x64,0x0b,0x04,0xa0,0x00,0x64,0x0b,
+0x1b,0x00,0x09,0xb2,0x00,0x01,0x00,0xf0,0x05,0x57,0x0b,0x0a,0x00,0x00,0xc1,0x0b,
+0x0b,0x00,0x07,0x94,0xbe,0xbe,0xb5,0x4c,0x90,0x0b,0x0a,0x00,0x12,0x05,0x00,0xf6,
+0x05,0x01,0x97,0xbb,0xbb,0xb6,0x01,0x90,0x16,0x06,0x00,0x01,0x90,0xa3,0x04,0xa0,
+0x01,0x96,0x60,0x00,0x83,0x36,0x00,0xf2,0x1e,0x01,0x92,0x79,0xb3,0x30,0x08,0x88,
+0xc0,0xb0,0xa0,0x1e,0x10,0xb0,0xb1,0x30,0xae,0x59,0xe9,0xda,0x90,0x5a,0x00,0xb1,
+0x83,0x90,0x0a,0x38,0xea,0x7c,0x30,0x0a,0x33,0xb0,0x5a,0x10,0x0a,0x00,0xb4,0xbb,
+0x44,0x0a,0x1a,0x95,0x07,0xc1,0x33,0x00,0x10,0x03,0x05,0x00,0xf2,0x1d,0x75,0xea,
+0xaa,0xe0,0x01,0xc0,0xb0,0x00,0xb0,0x0b,0xa0,0xd9,0x99,0xe0,0x57,0xa0,0x00,0xb0,
+0x00,0x00,0xa7,0xaa,0xea,0xa6,0x00,0xa0,0x09,0xe9,0x00,0x00,0xa0,0x67,0xb7,0x50,
+0x00,0xa8,0xa0,0xb0,0xb5,0x00,0xa4,0x00,0xb0,0x03,0x37,0x00,0xf3,0x18,0x11,0x00,
+0x20,0x00,0x00,0x83,0x01,0xb0,0x00,0x00,0xb6,0x99,0xb9,0x96,0x09,0x90,0x11,0x11,
+0x10,0x3c,0x90,0x78,0x88,0x70,0x01,0x90,0x67,0x77,0x60,0x00,0x90,0x99,0x99,0x90,
+0x00,0x90,0xa0,0x00,0xa0,0x05,0x00,0xf0,0x5a,0xd9,0x99,0xc0,0x00,0x40,0x04,0x10,
+0x00,0x02,0x90,0x0e,0x76,0x60,0x09,0x20,0xac,0x35,0xb0,0x3f,0x09,0x53,0xbb,0x10,
+0xbc,0x0b,0x7a,0x79,0xa3,0x1a,0x0a,0x22,0x92,0x01,0x0a,0x0a,0x26,0x39,0x10,0x0a,
+0x0a,0x19,0x71,0xa2,0x0a,0x00,0x02,0x7c,0x40,0x0a,0x00,0xa9,0x40,0x00,0x00,0x50,
+0x05,0x20,0x00,0x04,0x88,0x8b,0xc8,0x84,0x09,0x3b,0x12,0x11,0x20,0x2f,0x0a,0x35,
+0x00,0xa0,0xad,0x0a,0x84,0x99,0xd4,0x2b,0x0c,0xe1,0x40,0xa0,0x0b,0x0a,0xa0,0xa0,
+0xa0,0x0b,0x28,0x90,0x33,0xa0,0x0b,0x64,0x90,0x00,0xa0,0x0b,0x81,0x90,0x2a,0x60,
+0x00,0x05,0x9b,0x00,0xf2,0x54,0x04,0x8b,0xaa,0xaa,0xe0,0x00,0xa2,0xa0,0x06,0x0a,
+0x00,0x4f,0x0a,0x59,0xc8,0xa0,0x0c,0xc0,0xa0,0x08,0x0a,0x00,0x1a,0x0a,0x0c,0x89,
+0xa0,0x00,0xa0,0xa0,0x80,0x9a,0x00,0x0a,0x0a,0x08,0x85,0xa0,0x00,0xa0,0xba,0xaa,
+0xae,0x00,0x0a,0x0a,0x00,0x00,0x90,0x00,0x00,0x01,0x00,0x00,0x00,0xb0,0x05,0x70,
+0x00,0x05,0x77,0xb9,0x9c,0xa0,0x1e,0x20,0xa0,0x0b,0x00,0xad,0x25,0x96,0x7b,0x51,
+0x19,0x24,0x44,0x44,0x41,0x09,0x13,0xca,0xab,0x60,0x09,0x14,0x60,0x03,0x70,0x09,
+0x14,0xc8,0x8a,0x70,0x09,0x14,0x71,0x15,0x70,0xdb,0x01,0xf2,0x1d,0xaa,0xb9,0x48,
+0x91,0x0a,0x18,0x26,0x0a,0x91,0x3f,0x2d,0x8c,0x5a,0x91,0xac,0x14,0x60,0x4a,0x91,
+0x0a,0x25,0xd5,0x2a,0x91,0x0a,0x13,0xc3,0x1a,0x91,0x0a,0x00,0xb4,0x40,0x91,0x0a,
+0x5c,0xd9,0x30,0x91,0x0a,0x32,0x00,0x0a,0xc0,0x36,0x01,0xf2,0x0f,0xb8,0x8b,0xc8,
+0x80,0x06,0x51,0x19,0x31,0x10,0x2e,0x16,0xb9,0x9a,0x60,0x9b,0x16,0xa8,0x8a,0x60,
+0x09,0x16,0x51,0x14,0x60,0x09,0x16,0xa7,0x79,0x60,0x09,0x0f,0x00,0x83,0x40,0x03,
+0x60,0x09,0x5c,0xba,0xab,0xc3,0x08,0x02,0xf3,0x44,0x02,0xc1,0x00,0x00,0xc5,0xb8,
+0x88,0xb5,0x06,0xb4,0x84,0x44,0x95,0x2c,0xa5,0x85,0x55,0x51,0x12,0xa5,0xda,0xcc,
+0xa7,0x00,0xa6,0xc1,0x77,0x17,0x00,0xa8,0xaa,0xcc,0xa7,0x00,0xa9,0x91,0x77,0x17,
+0x00,0xa7,0x91,0x77,0x75,0x00,0x40,0x02,0x40,0x00,0x00,0xb8,0x9a,0xe9,0x94,0x06,
+0x50,0x66,0x66,0x40,0x2f,0x11,0xa2,0x23,0xa0,0xac,0x11,0x98,0x88,0x60,0x09,0x1b,
+0x88,0x88,0x96,0x09,0x19,0x99,0x99,0x86,0x09,0x10,0x00,0xa0,0x00,0x05,0x00,0x31,
+0x5a,0x70,0x00,0xc8,0x00,0xf3,0x19,0x29,0xd9,0xd0,0x1a,0x09,0x2a,0x0a,0x09,0xa2,
+0xf0,0xd9,0xd0,0x9a,0xbc,0x0a,0x1b,0x09,0xa2,0xa0,0xc8,0xd0,0x9a,0x0a,0x0a,0x1b,
+0x09,0xa0,0xa0,0x99,0x90,0x6a,0x0a,0x0a,0x2b,0x00,0xa0,0xa5,0x40,0x51,0x6c,0x62,
+0x02,0xf0,0x16,0x95,0x3a,0x20,0x07,0x37,0xb9,0x8c,0x60,0x0e,0x4a,0xdc,0xbd,0xa2,
+0x9e,0x06,0xa0,0x00,0x00,0x4a,0x7f,0xbb,0xc9,0xb0,0x0a,0x28,0x99,0xb7,0xb0,0x0a,
+0x07,0xaa,0xc8,0xb0,0x0a,0x07,0x33,0x70,0x05,0x00,0x23,0x76,0x80,0x96,0x02,0xf4,
+0x20,0xb7,0x69,0xa6,0x61,0x00,0x66,0x58,0xab,0x87,0x00,0x2f,0x19,0x68,0xa6,0xc0,
+0x0b,0xb1,0x98,0x9b,0x7c,0x00,0x09,0x24,0x48,0xa9,0x90,0x00,0x92,0x65,0x54,0xc6,
+0x20,0x09,0x4a,0xc9,0x9e,0x93,0x00,0x91,0x0b,0x20,0xb0,0x00,0x09,0x10,0x14,0x9b,
+0xcd,0x02,0xf2,0x54,0x0a,0x2a,0x32,0xc2,0x00,0x05,0x75,0xc6,0x5d,0x51,0x01,0xe1,
+0x05,0xac,0x80,0x00,0xbc,0x17,0x89,0xb7,0xc0,0x01,0x91,0x69,0xac,0x8b,0x00,0x09,
+0x15,0x79,0xb7,0x70,0x00,0x91,0x38,0xac,0x86,0x00,0x09,0x10,0x03,0x80,0x00,0x00,
+0x92,0x99,0xac,0x99,0x30,0x00,0x20,0x21,0x00,0x00,0x00,0xc0,0xd9,0xa2,0x00,0x06,
+0x7a,0x41,0xb1,0x00,0x1e,0x7e,0x8b,0xa8,0xb0,0xad,0x19,0x9d,0x98,0xa0,0x19,0x14,
+0xba,0x02,0x50,0x09,0x36,0x4a,0xbd,0x10,0x09,0x3a,0x67,0xb7,0x30,0x09,0x14,0xa3,
+0xa1,0xc2,0x09,0x46,0x2a,0x60,0x11,0x69,0x00,0xf7,0x23,0x40,0x50,0x05,0x00,0x02,
+0xa8,0xda,0x8d,0x80,0x09,0x33,0x48,0xa4,0x30,0x4f,0x02,0x47,0x94,0x20,0xbc,0x38,
+0xac,0xaa,0x92,0x0a,0x38,0xd4,0x65,0x80,0x0a,0x48,0xd8,0xab,0x93,0x0a,0x25,0xd9,
+0x4a,0x80,0x0a,0x34,0xc0,0x3e,0x13,0x0a,0x06,0xb2,0x94,0xb4,0x00,0x01,0x00,0xf3,
 0x21,0xb2,0x81,0x98,0x10,0x00,0x68,0xc8,0x88,0x8d,0x00,0x2e,0x37,0xb7,0x7c,0x50,
 0x0b,0xb1,0x18,0x66,0x80,0x00,0x19,0x1a,0x77,0x79,0x70,0x00,0x91,0xa6,0x66,0x87,
 0x00,0x09,0x1a,0x66,0x68,0x70,0x00,0x91,0x4a,0x99,0xb3,0x00,0x09,0x4a,0x70,0x07,
-0xa0,0xa9,0x03,0xf3,0x1d,0x95,0x10,0x53,0x61,0x07,0x66,0x76,0xcb,0xa0,0x0e,0x14,
+0xa0,0xa9,0x03,0xf0,0x20,0x95,0x10,0x53,0x61,0x07,0x66,0x76,0xcb,0xa0,0x0e,0x14,
 0x41,0x6a,0x50,0x9e,0x09,0x96,0xbc,0x93,0x3a,0x08,0x86,0xf9,0x80,0x0a,0x19,0x96,
 0xb1,0xb0,0x0a,0x17,0x81,0xa7,0xd0,0x0a,0x1c,0xc1,0xa8,0xd0,0x0a,0x16,0x81,0xa1,
-0xa0,0xe1,0x0c,0x10,0x2b,0x7b,0x04,0xf2,0x18,0xbc,0xbb,0xb6,0x00,0x0b,0x30,0x52,
-0x00,0x00,0x95,0x00,0x2c,0x30,0x05,0xdc,0xdb,0xe9,0xc1,0x00,0x07,0x50,0xb0,0x10,
-0x00,0x0b,0x20,0xb0,0x03,0x00,0x5a,0x00,0xb0,0x0b,0x0b,0xa0,0x00,0xbb,0xc6,0x01,
-0xda,0x03,0xf0,0x0f,0x64,0x02,0x10,0x03,0xa0,0x64,0x0c,0x10,0x00,0x52,0x64,0x44,
-0x00,0x5b,0xbb,0xdc,0xbb,0xb0,0x00,0x0a,0x15,0x50,0x00,0x00,0x0c,0x05,0x50,0x00,
-0x00,0x2a,0x05,0x00,0x82,0xc3,0x05,0x60,0x41,0x4c,0x40,0x02,0xcb,0x0d,0x04,0xf7,
-0x1e,0x09,0x99,0xad,0x99,0x94,0x01,0x11,0x49,0x11,0x10,0x00,0xaa,0xbd,0xaa,0x40,
-0x00,0xb0,0x00,0x05,0x60,0x00,0xb1,0x11,0x16,0x60,0x00,0x9c,0xba,0xd9,0x40,0x00,
-0x0a,0x21,0x90,0x01,0x00,0x5a,0x01,0x90,0x0b,0x1c,0x90,0x00,0xcb,0xc6,0x04,0x01,
-0x10,0x0b,0x8d,0x06,0x20,0x02,0xd1,0x0b,0x00,0x10,0x9a,0x05,0x00,0xf1,0x0d,0xda,
-0x30,0x00,0x00,0x04,0xa2,0xb0,0x00,0x00,0x0c,0x20,0x95,0x00,0x00,0x88,0x00,0x1d,
-0x20,0x09,0xa0,0x00,0x03,0xd3,0x26,0x00,0x00,0x00,0x23,0x31,0x00,0x10,0x84,0x35,
-0x00,0xf0,0x07,0x10,0x00,0xdb,0xbe,0xeb,0xbe,0xb0,0x0c,0xc0,0x0b,0xb0,0x57,0x66,
-0x0b,0xb5,0xb0,0x0c,0x5b,0xc6,0x00,0x01,0x6b,0x7e,0x08,0x71,0xb0,0x00,0x04,0xbb,
-0x00,0x00,0x12,0xd6,0x0d,0xf2,0x0c,0x10,0x00,0x00,0x1b,0x33,0xc1,0x00,0x05,0xc3,
-0x00,0x2c,0x50,0x69,0xba,0xaa,0xab,0xa7,0x00,0x00,0x55,0x00,0x00,0x00,0xaa,0xcc,
-0xaa,0x00,0x0a,0x00,0x20,0x00,0x55,0x3b,0x0b,0x23,0xcc,0xaa,0x91,0x0c,0x30,0x1c,
-0x00,0xc1,0xcf,0x10,0xf1,0x00,0x3a,0x00,0x05,0xb0,0x10,0x08,0x80,0x2c,0x00,0xc2,
-0x00,0xa5,0x01,0x06,0x90,0x19,0x00,0x10,0x93,0x41,0x14,0x61,0x2d,0x10,0x07,0xec,
-0xbb,0xaa,0x87,0x01,0xf0,0x00,0x70,0x00,0xb0,0x00,0x66,0x00,0x38,0xe8,0x88,0xbb,
-0x80,0x00,0xca,0xaa,0xc5,0x1f,0x06,0x26,0x55,0x00,0x0a,0x00,0xc0,0x7a,0xab,0xab,
-0xba,0xa2,0x03,0xa8,0x02,0xa7,0x10,0x58,0x20,0x27,0x11,0x60,0xba,0x99,0x9c,0x40,
-0x00,0xb9,0x05,0x00,0xd0,0xb1,0x11,0x18,0x40,0x00,0xb8,0x77,0x7b,0x40,0x00,0xb8,
-0x88,0x8c,0x27,0x01,0xe0,0x07,0x40,0x2a,0xac,0xaa,0xcb,0xa7,0x01,0x9a,0x00,0x4b,
-0x60,0x1a,0x30,0x1b,0x35,0xe6,0x0a,0x07,0x30,0x00,0x0c,0xae,0xbd,0xcc,0x60,0x0b,
-0x0a,0x07,0x34,0x60,0x0a,0x00,0xf6,0x41,0x0b,0x0a,0x18,0x45,0x70,0x8a,0xab,0xaa,
-0xba,0xa3,0x01,0xa7,0x00,0xb8,0x00,0x5a,0x30,0x00,0x05,0xa0,0x00,0x40,0x00,0x05,
-0x00,0x01,0x6a,0x11,0x6a,0x10,0x08,0x8b,0xaa,0xc8,0x83,0x05,0x9c,0xbb,0xc9,0x60,
-0x02,0x27,0x75,0x93,0xa1,0x17,0x7a,0xa9,0xb8,0xc4,0x06,0x9c,0xbb,0xca,0x90,0x00,
-0x4e,0x53,0xd7,0x00,0x06,0xa6,0x53,0x77,0xa2,0x27,0x06,0x53,0x70,0x36,0x05,0xdc,
-0xdb,0xeb,0xd0,0x05,0x53,0x70,0xa0,0xb0,0x05,0x00,0x5a,0x3d,0xdc,0xdb,0xeb,0xe9,
-0x14,0x00,0x00,0x05,0x00,0x21,0xa8,0xa0,0x49,0x0f,0xf0,0x1a,0x1a,0x00,0xa2,0x39,
-0x00,0x08,0x52,0xea,0xac,0xa5,0x00,0x4c,0x90,0x19,0x00,0x00,0x68,0xda,0xbd,0xa3,
-0x00,0x32,0x90,0x19,0x00,0x02,0xa1,0xda,0xbd,0xa3,0x09,0x31,0x90,0x19,0x00,0x1c,
-0x01,0xda,0xbe,0xa7,0x01,0x28,0x0d,0xf1,0x16,0x31,0x0a,0x20,0x05,0x07,0x30,0xa2,
-0x00,0xb0,0x73,0x0a,0x20,0x0b,0x07,0xcb,0xec,0xbb,0xb0,0x10,0x0a,0x20,0x01,0x0c,
-0x00,0xa2,0x00,0xa2,0xc0,0x0a,0x20,0x0a,0x2e,0xbb,0xec,0xbb,0xe2,0x00,0xf6,0x0b,
-0x00,0x06,0x00,0x20,0xaa,0xad,0x04,0x04,0xf0,0x0b,0x00,0xa4,0x00,0xc0,0x5a,0xb2,
-0xb1,0xb7,0x3b,0xb0,0x29,0xda,0x0b,0xb8,0x82,0xa4,0x8b,0xb1,0x29,0x70,0x1b,0xea,
-0xaa,0xaa,0xae,0x00,0x4f,0x0a,0x10,0x02,0x2f,0x06,0x30,0x3b,0x00,0xa3,0x82,0x01,
-0xe0,0x1c,0x00,0x09,0x80,0x00,0x05,0xb0,0x4b,0xbb,0xbb,0xbb,0x74,0x00,0x04,0x83,
-0x07,0x00,0x8d,0x16,0x20,0x00,0x0c,0x5d,0x0d,0x73,0xb4,0x00,0x0c,0x00,0x1c,0x50,
-0x0b,0x5d,0x02,0xf1,0x1e,0x09,0x10,0xbb,0xbb,0xb1,0x09,0x11,0x06,0x40,0xa1,0x5d,
-0xca,0x07,0x30,0xa1,0x4a,0x10,0x08,0x20,0xb0,0x09,0x10,0x0b,0x00,0xb0,0x09,0x26,
-0x1b,0x00,0xc0,0x0c,0xc6,0x57,0x00,0xc0,0x05,0x02,0xc1,0x00,0xc0,0x00,0x0b,0x20,
-0x9c,0x50,0x32,0x00,0x31,0x1b,0xec,0xba,0xf2,0x0a,0xf2,0x16,0x47,0x1a,0x01,0xfa,
-0xa5,0x47,0x1a,0x07,0x50,0x55,0x47,0x1a,0x1b,0x40,0xa2,0x47,0x1a,0x01,0x6b,0xb0,
-0x47,0x1a,0x00,0x0b,0x40,0x23,0x1a,0x00,0x87,0x00,0x00,0x1a,0x0a,0x70,0x00,0x05,
-0xb7,0x8a,0x03,0x01,0xc5,0x00,0xf0,0x0b,0xb0,0x99,0x99,0x90,0x2a,0xb8,0x12,0xc1,
-0xb0,0x00,0x37,0x01,0xa0,0xb0,0x00,0xb5,0x12,0x80,0xb0,0x08,0xf9,0x05,0x50,0xb0,
-0x39,0xcb,0xd3,0x0a,0x20,0xb0,0x1b,0x3a,0x08,0x72,0xa4,0x00,0xb0,0x00,0xb5,0x60,
-0x6b,0x69,0x00,0xf5,0x1a,0x0e,0xaa,0xd0,0x00,0xb0,0xa0,0x0b,0x0b,0x0b,0x0c,0x33,
-0xb0,0xb0,0xb0,0x7d,0x76,0x0b,0x0b,0x00,0xd7,0x70,0xb0,0xb0,0x3a,0x3b,0x0b,0x0b,
-0x06,0x40,0xa0,0x50,0xb0,0xb0,0x0b,0x00,0x0b,0x64,0x4a,0x70,0x2b,0xc0,0x25,0x03,
-0xf4,0x34,0x16,0x8a,0x81,0x10,0xa1,0x02,0x29,0x00,0x91,0xa1,0x15,0x7c,0x54,0x91,
-0xa1,0x14,0x9d,0x53,0x91,0xa1,0x00,0xcd,0x80,0x91,0xa1,0x07,0x79,0x65,0x91,0xa1,
-0x3b,0x29,0x00,0x20,0xa1,0x11,0x19,0x00,0x00,0xa1,0x00,0x19,0x00,0x1b,0xc0,0x2d,
-0xdd,0xb8,0x00,0xa2,0x78,0x62,0x89,0x0a,0x27,0x86,0x28,0x90,0xa4,0x9a,0x95,0xaa,
-0x0a,0x6b,0xba,0x8b,0xa0,0x12,0x00,0xf2,0x51,0x40,0xa2,0x78,0x62,0x80,0x0a,0x27,
-0x86,0x96,0x1b,0xa0,0x1a,0xeb,0xa9,0x20,0xb0,0x1b,0x09,0x08,0x1b,0x0a,0x87,0xc6,
-0x81,0xb0,0x65,0x72,0x68,0x1b,0x01,0x1b,0x11,0x81,0xb0,0x99,0xe9,0x78,0x1b,0x00,
-0x0b,0x00,0x61,0xb0,0x26,0xec,0xa0,0x0b,0x29,0x62,0x00,0x0b,0xb0,0x08,0x29,0x00,
-0x22,0xa0,0x1d,0xbe,0xa6,0x45,0xb0,0x56,0x4b,0x22,0x55,0xb0,0x37,0x8c,0x77,0x55,
-0xb0,0x08,0x8d,0x85,0x45,0xb0,0x0b,0x3b,0x2a,0x45,0xb0,0x09,0x19,0x0a,0x00,0xb0,
-0x09,0x19,0x87,0x00,0xb0,0x00,0x19,0x00,0x0b,0xb5,0x00,0xf4,0x17,0x0d,0xaa,0xac,
-0x11,0xb0,0xa0,0x00,0xa4,0x4b,0x0d,0xaa,0xa8,0x44,0xb0,0xa0,0x90,0x04,0x4b,0x0a,
-0xde,0xac,0x44,0xb0,0xa7,0xa0,0x94,0x4b,0x28,0x7a,0x0a,0x11,0xb6,0x45,0xa5,0x50,
-0x0b,0x60,0x0a,0x2e,0x00,0x30,0x20,0x00,0x03,0xa3,0x17,0xf0,0x04,0x1b,0x00,0x2a,
-0xad,0xaa,0xcc,0xa7,0x01,0x33,0x30,0x10,0x40,0x09,0x76,0xd0,0xb0,0xb0,0x09,0x99,
-0x05,0x00,0x21,0x10,0xa0,0x0a,0x00,0x10,0xa0,0x0a,0x00,0x72,0x00,0xb0,0x09,0x18,
-0xb0,0x1a,0xc0,0x82,0x09,0xf0,0x17,0x30,0x82,0x11,0x19,0x00,0x8d,0x80,0x46,0x19,
-0x04,0xb5,0xb5,0x46,0x19,0x18,0x06,0x52,0x46,0x19,0x14,0x4c,0x57,0x46,0x19,0x04,
-0x8f,0x53,0x46,0x19,0x02,0xab,0xa3,0x11,0x19,0x2b,0x1a,0x05,0x00,0xf3,0x0a,0xf6,
-0x1b,0x07,0xb6,0x4a,0xaa,0xaa,0x10,0xb0,0x56,0x66,0x34,0x4b,0x0a,0x22,0x58,0x44,
-0xb0,0xa9,0x9a,0x74,0x4b,0x06,0x66,0x65,0x44,0xb1,0xa2,0xb2,0xb4,0x4b,0x1c,0x8d,
-0x8d,0x22,0xb1,0xd9,0xd9,0xd0,0x0b,0x18,0x00,0x0a,0x1b,0x74,0x01,0xf4,0x19,0x07,
-0xa1,0x02,0x0b,0x08,0x85,0xa4,0xa0,0xb5,0x75,0x95,0x1a,0x0b,0x0a,0x55,0xb0,0xa0,
-0xb0,0xa5,0x5b,0x0a,0x0b,0x0a,0x88,0x80,0xa0,0xb0,0xab,0x8c,0x12,0x0b,0x65,0xc9,
-0xd1,0x00,0xb2,0x08,0x08,0x12,0xbc,0x30,0x00,0x41,0xb0,0x00,0x5a,0xda,0x36,0x0c,
-0xf4,0x12,0xbb,0xeb,0xe1,0x01,0x90,0x02,0x90,0xb0,0x01,0x90,0x04,0x70,0xb0,0x01,
-0xb7,0x18,0x30,0xb0,0x7c,0x94,0x1c,0x00,0xb0,0x10,0x00,0xb4,0x00,0xb0,0x00,0x0b,
-0x50,0x6b,0x60,0x30,0x00,0xf6,0x16,0x22,0x24,0xbe,0xba,0x5a,0x6d,0x00,0xb0,0xb5,
-0x50,0xb0,0x29,0x0b,0x55,0x0b,0x03,0x70,0xb5,0x50,0xb0,0x55,0x0b,0x55,0x0b,0x0a,
-0x21,0xa5,0x50,0xb1,0xc0,0x48,0x5d,0xbe,0x66,0x8c,0x25,0x50,0x75,0x0a,0xf7,0x1e,
-0x58,0xc6,0x20,0xb0,0x00,0x8b,0xeb,0xb2,0xb0,0x00,0x36,0xc7,0x6a,0xeb,0xe1,0x74,
-0xa3,0xb0,0xa0,0xa1,0x78,0xc8,0xc0,0xa0,0xa0,0x47,0xc8,0x82,0x80,0xb0,0x48,0xd9,
-0x88,0x50,0xb0,0x02,0xb7,0x8d,0x00,0xb0,0x78,0x64,0xb3,0x4b,0x70,0xa1,0x09,0x10,
-0x76,0xaa,0x02,0xd0,0xdb,0xbb,0xbb,0xc0,0x1c,0x31,0x11,0x00,0xb0,0x44,0xe9,0x9e,
-0x00,0xad,0x09,0x50,0x01,0xa0,0x00,0xea,0xac,0xb8,0x0b,0x50,0x00,0x79,0x20,0x00,
-0xb0,0x03,0x0f,0x63,0xab,0xbb,0xbb,0xd3,0x00,0x10,0x93,0x05,0xf0,0x0c,0x07,0xdb,
-0xbb,0xbb,0xe7,0xd1,0x03,0x42,0x0b,0x3a,0x4a,0xb0,0xa0,0xb0,0xa0,0x8c,0x2a,0x0b,
-0x0a,0x67,0x07,0xa0,0xb0,0xa9,0x99,0x9d,0x0b,0xdb,0x0f,0x00,0xe0,0x0a,0x17,0xb5,
-0x1c,0x0d,0x20,0x3a,0x0c,0xcf,0x06,0xf0,0x1b,0x0c,0x00,0x53,0x06,0xe0,0x0c,0x03,
-0xc1,0x3c,0xc0,0x0c,0x3d,0x20,0x22,0xc0,0x0d,0xb1,0x00,0x00,0xc2,0xbe,0x00,0x00,
-0x00,0xc4,0x3c,0x00,0x08,0x00,0xc0,0x0c,0x00,0x1a,0x00,0xc0,0x09,0xcb,0xc4,0xeb,
-0xbe,0xbe,0xbb,0xc2,0x1a,0xf0,0x05,0x00,0xb0,0x28,0x0b,0x00,0x0b,0x05,0x60,0xb0,
-0x10,0xb0,0xa2,0x0b,0x0a,0x0b,0x79,0x00,0xab,0xa0,0xb3,0x1e,0x03,0xf1,0x02,0xbb,
-0xbb,0xbb,0xb4,0xea,0xaa,0xaa,0xaa,0x0b,0x01,0x98,0x84,0x00,0xb0,0x19,0x03,0x70,
-0x09,0x00,0xf1,0x03,0xb3,0x99,0x4a,0x87,0x0b,0x45,0x35,0xa0,0xa0,0xb3,0x98,0x4a,
-0x77,0x0e,0x99,0x99,0x99,0x94,0x62,0x10,0x03,0x20,0x03,0x70,0xb5,0x38,0x00,0x09,
-0x8c,0x00,0x38,0x2f,0x04,0xe0,0x38,0x00,0x29,0x9e,0x99,0xac,0x96,0x02,0x2b,0x22,
-0x59,0x21,0x00,0x39,0x14,0x00,0xd3,0x94,0x00,0x38,0x00,0x04,0xb0,0x00,0x38,0x00,
-0x1b,0x10,0x00,0x38,0xb5,0x00,0xf4,0x07,0x70,0x28,0x03,0x60,0x00,0xa2,0x28,0x0b,
-0x20,0x00,0x23,0x28,0x05,0x00,0x06,0xbb,0xce,0xbb,0xb1,0x00,0x00,0x28,0x07,0x10,
-0x00,0x0a,0x00,0x06,0x05,0x00,0xf3,0x1e,0x08,0x20,0x05,0x50,0x00,0x08,0x22,0x8c,
-0x88,0x90,0x7d,0xa3,0x57,0x02,0x70,0x08,0x25,0x60,0x49,0x10,0x08,0x22,0x80,0x0a,
-0x00,0x08,0x4b,0xcc,0x9d,0xd0,0x08,0x26,0x39,0x27,0xa0,0x08,0x2a,0x09,0x82,0xa0,
-0x08,0x65,0x79,0x64,0xa0,0x92,0x00,0x10,0x73,0x05,0x00,0x31,0x7c,0xbb,0x50,0x0a,
-0x00,0x50,0x2b,0xbb,0xdc,0xbb,0xb7,0xe8,0x1b,0x00,0x73,0x0d,0x10,0x92,0xf2,0x1b,
-0x20,0x3b,0xa0,0x0f,0x00,0x11,0x10,0x14,0x00,0xf0,0x08,0x0a,0xba,0xac,0xba,0xa4,
-0x0a,0x13,0x4d,0x33,0x20,0x0a,0x1c,0x66,0x66,0xb0,0x0a,0x1d,0x88,0x88,0xb0,0x0b,
-0x0a,0x00,0x4d,0x0d,0xf2,0x03,0x9e,0x99,0x70,0x1b,0x08,0x1b,0x08,0x10,0x58,0x77,
-0x0b,0x02,0xa0,0x52,0x50,0xac,0x00,0x31,0x77,0x09,0xf0,0x1b,0x3a,0x31,0xa2,0x00,
-0x02,0xc9,0x98,0x8a,0x10,0x05,0x74,0x54,0x93,0x60,0x0b,0x9c,0x9a,0xd8,0xa2,0x02,
-0x97,0x45,0x7a,0x30,0x48,0x79,0x54,0x61,0x75,0x00,0x37,0x95,0x18,0x00,0x00,0x32,
-0x48,0x92,0x00,0x00,0xa9,0x51,0x64,0x05,0xf0,0x06,0xaa,0xaa,0x40,0x03,0xa1,0x41,
-0x19,0x30,0x00,0xa1,0x86,0x0b,0x00,0x00,0x39,0x05,0x75,0x00,0x00,0x09,0x54,0xa9,
-0x00,0xe0,0xcc,0x00,0x00,0x00,0x08,0xaa,0x91,0x00,0x28,0xc5,0x00,0x5b,0xa3,0x34,
-0x3f,0x13,0x20,0x09,0xce,0x9e,0x05,0x10,0x1c,0x54,0x0d,0xf1,0x11,0x2f,0x21,0xea,
-0xa1,0x00,0x3b,0x80,0x11,0xc0,0x00,0x74,0xb2,0x05,0x80,0x00,0xc0,0x2c,0x3b,0x00,
-0x05,0x90,0x07,0xf5,0x00,0x2d,0x14,0xaa,0x4c,0xc4,0x01,0x05,0x20,0x8f,0x07,0x72,
-0x02,0x20,0x00,0x9a,0xab,0xa8,0x30,0x1b,0x0d,0xf1,0x13,0xb1,0x11,0x11,0x00,0x01,
-0xdc,0xa9,0x9b,0x80,0x02,0x93,0x80,0x0b,0x10,0x03,0x80,0xa3,0x59,0x00,0x06,0x60,
-0x1c,0xc0,0x00,0x0a,0x22,0x9a,0xb8,0x10,0x0a,0x5a,0x30,0x04,0xa4,0x1b,0x01,0xf2,
-0x1c,0x6e,0xad,0xb5,0x55,0x50,0x0b,0x08,0x3a,0x86,0xc0,0x0d,0xad,0x34,0x50,0xa0,
-0x0b,0x08,0x31,0x91,0x90,0x0d,0xad,0x30,0xb7,0x40,0x0b,0x08,0x30,0x6d,0x00,0x2d,
-0x8d,0xc0,0x7d,0x00,0x46,0x38,0x34,0xa5,0x90,0x00,0x08,0x4b,0x33,0x01,0x10,0x00,
-0xea,0x01,0x40,0xb9,0x99,0x99,0x9c,0x16,0x08,0x0c,0x04,0x00,0x40,0xbb,0xbb,0xbb,
-0xbc,0x08,0x00,0x40,0x07,0xbb,0xbb,0xbb,0xdd,0x10,0x51,0xc0,0x09,0x20,0x00,0x0c,
-0x09,0x00,0x42,0x08,0xbb,0xbb,0xbd,0x8d,0x01,0xd3,0x87,0x02,0xc2,0x00,0x98,0x00,
-0x01,0xc3,0x55,0x00,0x00,0x01,0x80,0x21,0x13,0xf0,0x00,0x00,0x05,0x60,0x01,0xaa,
-0xa9,0x05,0x60,0x02,0x90,0x0b,0x05,0x60,0x02,0x80,0x05,0x00,0x60,0xda,0xad,0x05,
-0x60,0x02,0x70,0xb8,0x08,0x11,0x00,0x05,0x00,0x00,0x19,0x19,0x10,0x06,0x23,0x01,
-0xf1,0x15,0x50,0x30,0x00,0x05,0x70,0x07,0x80,0x05,0xd6,0x77,0x8e,0x60,0x46,0x43,
-0x32,0x19,0x00,0xaa,0xaa,0xaa,0x10,0x0c,0x11,0x11,0xa2,0x00,0xb0,0x00,0x09,0x20,
-0x0e,0xbb,0xbb,0xe2,0x00,0xb0,0xcc,0x12,0x00,0xdb,0x03,0x00,0x3c,0x01,0x52,0x1b,
-0xbb,0xeb,0xbb,0xb6,0xe4,0x06,0x10,0x3b,0x13,0x00,0xb0,0xcd,0xbb,0xbb,0xb0,0x0b,
-0x6a,0x00,0x00,0xb0,0x24,0x1a,0xf9,0x03,0x51,0x1e,0xbb,0xbb,0xc0,0x00,0x0a,0x00,
-0x02,0x3e,0x03,0x10,0x8a,0x65,0x00,0xd2,0x77,0x90,0x00,0x04,0xc5,0x00,0x4c,0x40,
-0x4b,0x7a,0xaa,0xa6,0xa3,0xb8,0x00,0x30,0xea,0xaa,0xae,0x25,0x00,0x15,0x0c,0x0a,
-0x00,0xf0,0x03,0x0b,0x00,0xeb,0xbb,0xbb,0xbe,0xb1,0x44,0x44,0x2b,0xb2,0x55,0x55,
-0x2b,0xb0,0x99,0x99,0x0b,0x48,0x06,0x01,0x04,0x00,0x50,0xda,0xab,0x0b,0xb0,0x20,
-0xff,0x08,0xf0,0x14,0x01,0xbb,0x00,0x04,0x30,0x00,0x00,0x03,0xfa,0x99,0x70,0x07,
-0xa2,0x11,0x85,0x03,0x73,0x80,0x69,0x00,0x00,0x07,0xd7,0x00,0x00,0x4a,0xfc,0x99,
-0x90,0x67,0xc1,0x11,0x1c,0x00,0x0a,0x4b,0x00,0x00,0x5e,0x07,0x00,0x09,0x00,0x00,
-0x26,0x04,0x92,0x20,0x06,0xaa,0xab,0x97,0x30,0x0a,0x10,0x00,0x12,0x14,0x11,0xb3,
-0x29,0x11,0xb0,0x0c,0x0b,0xbb,0xbb,0x80,0x0c,0x0b,0x00,0x00,0xc0,0x2b,0x05,0x00,
-0x71,0x87,0x0e,0xaa,0xaa,0xc0,0x80,0x0c,0xdf,0x00,0x01,0x2a,0x0d,0x20,0x10,0x00,
-0xf5,0x19,0x41,0xbb,0xce,0xbb,0xbb,0x77,0x09,0x62,0xaa,0xaa,0x0b,0xb0,0xa0,0x0a,
+0xa0,0x00,0x00,0x22,0x34,0x00,0x10,0x2b,0x7b,0x04,0xf2,0x18,0xbc,0xbb,0xb6,0x00,
+0x0b,0x30,0x52,0x00,0x00,0x95,0x00,0x2c,0x30,0x05,0xdc,0xdb,0xe9,0xc1,0x00,0x07,
+0x50,0xb0,0x10,0x00,0x0b,0x20,0xb0,0x03,0x00,0x5a,0x00,0xb0,0x0b,0x0b,0xa0,0x00,
+0xbb,0xc6,0x01,0xda,0x03,0xf0,0x0f,0x64,0x02,0x10,0x03,0xa0,0x64,0x0c,0x10,0x00,
+0x52,0x64,0x44,0x00,0x5b,0xbb,0xdc,0xbb,0xb0,0x00,0x0a,0x15,0x50,0x00,0x00,0x0c,
+0x05,0x50,0x00,0x00,0x2a,0x05,0x00,0x82,0xc3,0x05,0x60,0x41,0x4c,0x40,0x02,0xcb,
+0x0d,0x04,0xf7,0x1e,0x09,0x99,0xad,0x99,0x94,0x01,0x11,0x49,0x11,0x10,0x00,0xaa,
+0xbd,0xaa,0x40,0x00,0xb0,0x00,0x05,0x60,0x00,0xb1,0x11,0x16,0x60,0x00,0x9c,0xba,
+0xd9,0x40,0x00,0x0a,0x21,0x90,0x01,0x00,0x5a,0x01,0x90,0x0b,0x1c,0x90,0x00,0xcb,
+0xc6,0x04,0x01,0x70,0x0b,0x30,0x00,0x00,0x00,0x02,0xd1,0x0b,0x00,0x10,0x9a,0x05,
+0x00,0xf1,0x0d,0xda,0x30,0x00,0x00,0x04,0xa2,0xb0,0x00,0x00,0x0c,0x20,0x95,0x00,
+0x00,0x88,0x00,0x1d,0x20,0x09,0xa0,0x00,0x03,0xd3,0x26,0x00,0x00,0x00,0x23,0x31,
+0x00,0x10,0x84,0x35,0x00,0xf0,0x06,0x10,0x00,0xdb,0xbe,0xeb,0xbe,0xb0,0x0c,0xc0,
+0x0b,0xb0,0x57,0x66,0x0b,0xb5,0xb0,0x0c,0x5b,0xc6,0x00,0x01,0x64,0x05,0x80,0x0b,
+0xb0,0x00,0x04,0xbb,0x00,0x00,0x12,0x2a,0x00,0xf2,0x0d,0xbb,0x10,0x00,0x00,0x1b,
+0x33,0xc1,0x00,0x05,0xc3,0x00,0x2c,0x50,0x69,0xba,0xaa,0xab,0xa7,0x00,0x00,0x55,
+0x00,0x00,0x00,0xaa,0xcc,0xaa,0x00,0x0a,0x00,0x00,0x05,0x00,0x52,0x2a,0xaa,0xcc,
+0xaa,0xa2,0x8c,0x00,0xf1,0x07,0x1c,0x00,0xc1,0x00,0x00,0x94,0x00,0x3a,0x00,0x05,
+0xb0,0x10,0x08,0x80,0x2c,0x00,0xc2,0x00,0xa5,0x01,0x06,0x90,0x19,0x00,0xb1,0x93,
+0x00,0x00,0xb3,0x00,0x2d,0x10,0x07,0xec,0xbb,0xaa,0x87,0x01,0xf0,0x03,0x70,0x00,
+0xb0,0x00,0x66,0x00,0x38,0xe8,0x88,0xbb,0x80,0x00,0xca,0xaa,0xc5,0x00,0x00,0xb0,
+0x4c,0x00,0x05,0x0a,0x00,0xf0,0x07,0x7a,0xab,0xab,0xba,0xa2,0x03,0xa8,0x02,0xa7,
+0x10,0x58,0x20,0x00,0x04,0x90,0x00,0xba,0x99,0x9c,0x40,0x00,0xb9,0x05,0x00,0xd0,
+0xb1,0x11,0x18,0x40,0x00,0xb8,0x77,0x7b,0x40,0x00,0xb8,0x88,0x8c,0x27,0x01,0xf6,
+0x11,0x07,0x40,0x2a,0xac,0xaa,0xcb,0xa7,0x01,0x9a,0x00,0x4b,0x60,0x1a,0x30,0x00,
+0x00,0x66,0x00,0x0a,0x07,0x30,0x00,0x0c,0xae,0xbd,0xcc,0x60,0x0b,0x0a,0x07,0x34,
+0x60,0x0a,0x00,0xf6,0x41,0x0b,0x0a,0x18,0x45,0x70,0x8a,0xab,0xaa,0xba,0xa3,0x01,
+0xa7,0x00,0xb8,0x00,0x5a,0x30,0x00,0x05,0xa0,0x00,0x40,0x00,0x05,0x00,0x01,0x6a,
+0x11,0x6a,0x10,0x08,0x8b,0xaa,0xc8,0x83,0x05,0x9c,0xbb,0xc9,0x60,0x02,0x27,0x75,
+0x93,0xa1,0x17,0x7a,0xa9,0xb8,0xc4,0x06,0x9c,0xbb,0xca,0x90,0x00,0x4e,0x53,0xd7,
+0x00,0x06,0xa6,0x53,0x77,0xa2,0x27,0x06,0x53,0x70,0x36,0x05,0xdc,0xdb,0xeb,0xd0,
+0x05,0x53,0x70,0xa0,0xb0,0x05,0x00,0x5a,0x3d,0xdc,0xdb,0xeb,0xe9,0x14,0x00,0x00,
+0x05,0x00,0xf0,0x49,0xa8,0xa0,0x00,0x00,0x11,0x11,0x00,0x1a,0x00,0xa2,0x39,0x00,
+0x08,0x52,0xea,0xac,0xa5,0x00,0x4c,0x90,0x19,0x00,0x00,0x68,0xda,0xbd,0xa3,0x00,
+0x32,0x90,0x19,0x00,0x02,0xa1,0xda,0xbd,0xa3,0x09,0x31,0x90,0x19,0x00,0x1c,0x01,
+0xda,0xbe,0xa7,0x01,0x01,0x90,0x00,0x00,0x31,0x0a,0x20,0x05,0x07,0x30,0xa2,0x00,
+0xb0,0x73,0x0a,0x20,0x0b,0x07,0xcb,0xec,0xbb,0xb0,0x10,0x0a,0x20,0x01,0x0c,0x00,
+0xa2,0x00,0xa2,0xc0,0x0a,0x20,0x0a,0x2e,0xbb,0xec,0xbb,0xe2,0xa1,0x03,0x11,0x20,
+0xa7,0x03,0x20,0xaa,0xad,0x04,0x04,0xf0,0x0a,0x00,0xa4,0x00,0xc0,0x5a,0xb2,0xb1,
+0xb7,0x3b,0xb0,0x29,0xda,0x0b,0xb8,0x82,0xa4,0x8b,0xb1,0x29,0x70,0x1b,0xea,0xaa,
+0xaa,0xae,0xeb,0x01,0x20,0x00,0x02,0x2f,0x06,0x30,0x3b,0x00,0xa3,0x82,0x01,0xe0,
+0x1c,0x00,0x09,0x80,0x00,0x05,0xb0,0x4b,0xbb,0xbb,0xbb,0x74,0x00,0x04,0x83,0x07,
+0xf3,0x02,0x08,0x40,0x0c,0x00,0x00,0x0c,0x00,0x0c,0x00,0x00,0xb4,0x00,0x0c,0x00,
+0x1c,0x50,0x0b,0x5d,0x02,0xf1,0x1e,0x09,0x10,0xbb,0xbb,0xb1,0x09,0x11,0x06,0x40,
+0xa1,0x5d,0xca,0x07,0x30,0xa1,0x4a,0x10,0x08,0x20,0xb0,0x09,0x10,0x0b,0x00,0xb0,
+0x09,0x26,0x1b,0x00,0xc0,0x0c,0xc6,0x57,0x00,0xc0,0x05,0x02,0xc1,0x00,0xc0,0x00,
+0x0b,0x20,0x9c,0x50,0x32,0x00,0xf2,0x1e,0x1b,0xec,0xba,0x00,0x1a,0x00,0xb0,0x00,
+0x47,0x1a,0x01,0xfa,0xa5,0x47,0x1a,0x07,0x50,0x55,0x47,0x1a,0x1b,0x40,0xa2,0x47,
+0x1a,0x01,0x6b,0xb0,0x47,0x1a,0x00,0x0b,0x40,0x23,0x1a,0x00,0x87,0x00,0x00,0x1a,
+0x0a,0x70,0x00,0x05,0xb7,0x8a,0x03,0x01,0xc5,0x00,0xf2,0x1c,0xb0,0x99,0x99,0x90,
+0x2a,0xb8,0x12,0xc1,0xb0,0x00,0x37,0x01,0xa0,0xb0,0x00,0xb5,0x12,0x80,0xb0,0x08,
+0xf9,0x05,0x50,0xb0,0x39,0xcb,0x09,0x20,0xb0,0x00,0xb0,0x1b,0x00,0xb0,0x00,0xb0,
+0xa4,0x00,0xb0,0x00,0xb5,0x60,0x6b,0x69,0x00,0xf5,0x1a,0x0e,0xaa,0xd0,0x00,0xb0,
+0xa0,0x0b,0x0b,0x0b,0x0c,0x33,0xb0,0xb0,0xb0,0x7d,0x76,0x0b,0x0b,0x00,0xd7,0x70,
+0xb0,0xb0,0x3a,0x3b,0x0b,0x0b,0x06,0x40,0xa0,0x50,0xb0,0xb0,0x0b,0x00,0x0b,0x64,
+0x4a,0x70,0x2b,0xc0,0x25,0x03,0xf4,0x34,0x16,0x8a,0x81,0x10,0xa1,0x02,0x29,0x00,
+0x91,0xa1,0x15,0x7c,0x54,0x91,0xa1,0x14,0x9d,0x53,0x91,0xa1,0x00,0xcd,0x80,0x91,
+0xa1,0x07,0x79,0x65,0x91,0xa1,0x3b,0x29,0x00,0x20,0xa1,0x11,0x19,0x00,0x00,0xa1,
+0x00,0x19,0x00,0x1b,0xc0,0x2d,0xdd,0xb8,0x00,0xa2,0x78,0x62,0x89,0x0a,0x27,0x86,
+0x28,0x90,0xa4,0x9a,0x95,0xaa,0x0a,0x6b,0xba,0x8b,0xa0,0x12,0x00,0xf2,0x51,0x40,
+0xa2,0x78,0x62,0x80,0x0a,0x27,0x86,0x96,0x1b,0xa0,0x1a,0xeb,0xa9,0x20,0xb0,0x1b,
+0x09,0x08,0x1b,0x0a,0x87,0xc6,0x81,0xb0,0x65,0x72,0x68,0x1b,0x01,0x1b,0x11,0x81,
+0xb0,0x99,0xe9,0x78,0x1b,0x00,0x0b,0x00,0x61,0xb0,0x26,0xec,0xa0,0x0b,0x29,0x62,
+0x00,0x0b,0xb0,0x08,0x29,0x00,0x22,0xa0,0x1d,0xbe,0xa6,0x45,0xb0,0x56,0x4b,0x22,
+0x55,0xb0,0x37,0x8c,0x77,0x55,0xb0,0x08,0x8d,0x85,0x45,0xb0,0x0b,0x3b,0x2a,0x45,
+0xb0,0x09,0x19,0x0a,0x00,0xb0,0x09,0x19,0x87,0x00,0xb0,0x00,0x19,0x00,0x0b,0xb5,
+0x00,0xf4,0x17,0x0d,0xaa,0xac,0x11,0xb0,0xa0,0x00,0xa4,0x4b,0x0d,0xaa,0xa8,0x44,
+0xb0,0xa0,0x90,0x04,0x4b,0x0a,0xde,0xac,0x44,0xb0,0xa7,0xa0,0x94,0x4b,0x28,0x7a,
+0x0a,0x11,0xb6,0x45,0xa5,0x50,0x0b,0x60,0x0a,0x2e,0x00,0x10,0x20,0x4a,0x08,0xf0,
+0x06,0x49,0x00,0x1b,0x00,0x2a,0xad,0xaa,0xcc,0xa7,0x01,0x33,0x30,0x10,0x40,0x09,
+0x76,0xd0,0xb0,0xb0,0x09,0x99,0x05,0x00,0x21,0x10,0xa0,0x0a,0x00,0x10,0xa0,0x0a,
+0x00,0x72,0x00,0xb0,0x09,0x18,0xb0,0x1a,0xc0,0x82,0x09,0xf6,0x45,0x30,0x82,0x11,
+0x19,0x00,0x8d,0x80,0x46,0x19,0x04,0xb5,0xb5,0x46,0x19,0x18,0x06,0x52,0x46,0x19,
+0x14,0x4c,0x57,0x46,0x19,0x04,0x8f,0x53,0x46,0x19,0x02,0xab,0xa3,0x11,0x19,0x2b,
+0x1a,0x05,0x00,0x19,0x00,0x0a,0x00,0x07,0xb6,0x4a,0xaa,0xaa,0x10,0xb0,0x56,0x66,
+0x34,0x4b,0x0a,0x22,0x58,0x44,0xb0,0xa9,0x9a,0x74,0x4b,0x06,0x66,0x65,0x44,0xb1,
+0xa2,0xb2,0xb4,0x4b,0x1c,0x8d,0x8d,0x22,0xb1,0xd9,0xd9,0xd0,0x0b,0x18,0x00,0x0a,
+0x1b,0x74,0x01,0xf4,0x19,0x07,0xa1,0x02,0x0b,0x08,0x85,0xa4,0xa0,0xb5,0x75,0x95,
+0x1a,0x0b,0x0a,0x55,0xb0,0xa0,0xb0,0xa5,0x5b,0x0a,0x0b,0x0a,0x88,0x80,0xa0,0xb0,
+0xab,0x8c,0x12,0x0b,0x65,0xc9,0xd1,0x00,0xb2,0x08,0x08,0x12,0xbc,0x30,0x00,0xf4,
+0x1b,0xb0,0x00,0x5a,0xda,0x00,0xb0,0x00,0x01,0x90,0xbb,0xeb,0xe1,0x01,0x90,0x02,
+0x90,0xb0,0x01,0x90,0x04,0x70,0xb0,0x01,0xb7,0x18,0x30,0xb0,0x7c,0x94,0x1c,0x00,
+0xb0,0x10,0x00,0xb4,0x00,0xb0,0x00,0x0b,0x50,0x6b,0x60,0x30,0x00,0xf5,0x17,0x22,
+0x24,0xbe,0xba,0x5a,0x6d,0x00,0xb0,0xb5,0x50,0xb0,0x29,0x0b,0x55,0x0b,0x03,0x70,
+0xb5,0x50,0xb0,0x55,0x0b,0x55,0x0b,0x0a,0x21,0xa5,0x50,0xb1,0xc0,0x48,0x5d,0xbe,
+0x66,0x8c,0x25,0x50,0xb0,0x91,0x00,0xf7,0x1e,0x58,0xc6,0x20,0xb0,0x00,0x8b,0xeb,
+0xb2,0xb0,0x00,0x36,0xc7,0x6a,0xeb,0xe1,0x74,0xa3,0xb0,0xa0,0xa1,0x78,0xc8,0xc0,
+0xa0,0xa0,0x47,0xc8,0x82,0x80,0xb0,0x48,0xd9,0x88,0x50,0xb0,0x02,0xb7,0x8d,0x00,
+0xb0,0x78,0x64,0xb3,0x4b,0x70,0xa1,0x09,0x10,0x76,0xaa,0x02,0xd0,0xdb,0xbb,0xbb,
+0xc0,0x1c,0x31,0x11,0x00,0xb0,0x44,0xe9,0x9e,0x00,0xad,0x09,0xc0,0x01,0xa0,0x00,
+0xea,0xac,0x04,0x80,0x00,0xb0,0x00,0x79,0x20,0xb3,0x09,0x83,0x29,0x00,0xab,0xbb,
+0xbb,0xd3,0x00,0x10,0x93,0x05,0xf0,0x10,0x07,0xdb,0xbb,0xbb,0xe7,0xd1,0x03,0x42,
+0x0b,0x3a,0x4a,0xb0,0xa0,0xb0,0xa0,0x8c,0x2a,0x0b,0x0a,0x67,0x07,0xa0,0xb0,0xa9,
+0x99,0x9d,0x0b,0x01,0x11,0x11,0x11,0xe0,0x0a,0x13,0xb5,0x8f,0x06,0x00,0x05,0x00,
+0x20,0x3a,0x0c,0xcf,0x06,0xf0,0x33,0x0c,0x00,0x53,0x06,0xe0,0x0c,0x03,0xc1,0x3c,
+0xc0,0x0c,0x3d,0x20,0x22,0xc0,0x0d,0xb1,0x00,0x00,0xc2,0xbe,0x00,0x00,0x00,0xc4,
+0x3c,0x00,0x08,0x00,0xc0,0x0c,0x00,0x1a,0x00,0xc0,0x09,0xcb,0xc4,0xeb,0xbe,0xbe,
+0xbb,0x0b,0x01,0x90,0xb0,0x00,0xb0,0x28,0x0b,0x00,0x0b,0x05,0x60,0xb0,0x10,0xb0,
+0xa2,0x0b,0x0a,0x0b,0x79,0x00,0xab,0xa0,0xb3,0x1e,0x03,0xf1,0x02,0xbb,0xbb,0xbb,
+0xb4,0xea,0xaa,0xaa,0xaa,0x0b,0x01,0x98,0x84,0x00,0xb0,0x19,0x03,0x70,0x09,0x00,
+0xf4,0x07,0xb3,0x99,0x4a,0x87,0x0b,0x45,0x35,0xa0,0xa0,0xb3,0x98,0x4a,0x77,0x0e,
+0x99,0x99,0x99,0x94,0x11,0x11,0x11,0x11,0x20,0x03,0x70,0xb5,0x38,0x00,0x09,0x8c,
+0x00,0x38,0x2f,0x04,0xe0,0x38,0x00,0x29,0x9e,0x99,0xac,0x96,0x02,0x2b,0x22,0x59,
+0x21,0x00,0x39,0x14,0x00,0xd3,0x94,0x00,0x38,0x00,0x04,0xb0,0x00,0x38,0x00,0x1b,
+0x10,0x00,0x38,0xb5,0x00,0xf1,0x0e,0x70,0x28,0x03,0x60,0x00,0xa2,0x28,0x0b,0x20,
+0x00,0x23,0x28,0x05,0x00,0x06,0xbb,0xce,0xbb,0xb1,0x00,0x00,0x28,0x00,0x00,0x2b,
+0xbb,0xce,0xbb,0xb7,0x0a,0x00,0x06,0x05,0x00,0xf3,0x1e,0x08,0x20,0x05,0x50,0x00,
+0x08,0x22,0x8c,0x88,0x90,0x7d,0xa3,0x57,0x02,0x70,0x08,0x25,0x60,0x49,0x10,0x08,
+0x22,0x80,0x0a,0x00,0x08,0x4b,0xcc,0x9d,0xd0,0x08,0x26,0x39,0x27,0xa0,0x08,0x2a,
+0x09,0x82,0xa0,0x08,0x65,0x79,0x64,0xa0,0x92,0x00,0x10,0x73,0x05,0x00,0x31,0x7c,
+0xbb,0x50,0x0a,0x00,0x30,0x2b,0xbb,0xdc,0x55,0x00,0x10,0x74,0x14,0x00,0x80,0x79,
+0x92,0x00,0x00,0x00,0x74,0x3b,0xa0,0x0f,0x00,0x11,0x10,0x14,0x00,0xf0,0x05,0x0a,
+0xba,0xac,0xba,0xa4,0x0a,0x13,0x4d,0x33,0x20,0x0a,0x1c,0x66,0x66,0xb0,0x0a,0x1d,
+0x88,0x88,0xb0,0xc2,0x0b,0xf2,0x06,0xb0,0x0b,0x09,0x9e,0x99,0x70,0x1b,0x08,0x1b,
+0x08,0x10,0x58,0x77,0x0b,0x02,0xa0,0x52,0x50,0xac,0x00,0x31,0x77,0x09,0xf0,0x1b,
+0x3a,0x31,0xa2,0x00,0x02,0xc9,0x98,0x8a,0x10,0x05,0x74,0x54,0x93,0x60,0x0b,0x9c,
+0x9a,0xd8,0xa2,0x02,0x97,0x45,0x7a,0x30,0x48,0x79,0x54,0x61,0x75,0x00,0x37,0x95,
+0x18,0x00,0x00,0x32,0x48,0x92,0x00,0x00,0xa9,0x51,0x64,0x05,0xf0,0x06,0xaa,0xaa,
+0x40,0x03,0xa1,0x41,0x19,0x30,0x00,0xa1,0x86,0x0b,0x00,0x00,0x39,0x05,0x75,0x00,
+0x00,0x09,0x54,0xa9,0x00,0xf0,0x07,0xcc,0x00,0x00,0x00,0x08,0xaa,0x91,0x00,0x28,
+0xc5,0x00,0x5b,0xa3,0x34,0x00,0x00,0x00,0x21,0x09,0xce,0xbb,0xe2,0xef,0x06,0xf1,
+0x14,0xc0,0x00,0x00,0x2f,0x21,0xea,0xa1,0x00,0x3b,0x80,0x11,0xc0,0x00,0x74,0xb2,
+0x05,0x80,0x00,0xc0,0x2c,0x3b,0x00,0x05,0x90,0x07,0xf5,0x00,0x2d,0x14,0xaa,0x4c,
+0xc4,0x01,0x05,0x20,0x8f,0x07,0x81,0x02,0x20,0x00,0x9a,0xab,0xa8,0x30,0x00,0xa6,
+0x02,0xf1,0x13,0xb1,0x11,0x11,0x00,0x01,0xdc,0xa9,0x9b,0x80,0x02,0x93,0x80,0x0b,
+0x10,0x03,0x80,0xa3,0x59,0x00,0x06,0x60,0x1c,0xc0,0x00,0x0a,0x22,0x9a,0xb8,0x10,
+0x0a,0x5a,0x30,0x04,0xa4,0x1b,0x01,0xf2,0x1c,0x6e,0xad,0xb5,0x55,0x50,0x0b,0x08,
+0x3a,0x86,0xc0,0x0d,0xad,0x34,0x50,0xa0,0x0b,0x08,0x31,0x91,0x90,0x0d,0xad,0x30,
+0xb7,0x40,0x0b,0x08,0x30,0x6d,0x00,0x2d,0x8d,0xc0,0x7d,0x00,0x46,0x38,0x34,0xa5,
+0x90,0x00,0x08,0x4b,0x33,0x01,0x10,0x00,0xea,0x01,0x40,0xb9,0x99,0x99,0x9c,0x16,
+0x08,0x0c,0x04,0x00,0x40,0xbb,0xbb,0xbb,0xbc,0x08,0x00,0xd1,0x07,0xbb,0xbb,0xbb,
+0x00,0x92,0x00,0x00,0xc0,0x09,0x20,0x00,0x0c,0x09,0x00,0x42,0x08,0xbb,0xbb,0xbd,
+0x8d,0x01,0xf0,0x03,0x87,0x02,0xc2,0x00,0x98,0x00,0x01,0xc3,0x55,0x00,0x00,0x01,
+0x80,0x2b,0xbb,0xbb,0xbb,0xb7,0x3f,0x04,0xd0,0x60,0x01,0xaa,0xa9,0x05,0x60,0x02,
+0x90,0x0b,0x05,0x60,0x02,0x80,0x05,0x00,0x60,0xda,0xad,0x05,0x60,0x02,0x70,0xb8,
+0x08,0x11,0x00,0x05,0x00,0x50,0x03,0xcc,0x30,0x00,0x06,0x23,0x01,0xf1,0x13,0x50,
+0x30,0x00,0x05,0x70,0x07,0x80,0x05,0xd6,0x77,0x8e,0x60,0x46,0x43,0x32,0x19,0x00,
+0xaa,0xaa,0xaa,0x10,0x0c,0x11,0x11,0xa2,0x00,0xb0,0x00,0x09,0x20,0x0e,0xbb,0xbb,
+0xe2,0x09,0x00,0x20,0x00,0x00,0xdb,0x03,0x00,0x3c,0x01,0x52,0x1b,0xbb,0xeb,0xbb,
+0xb6,0xe4,0x06,0x10,0x3b,0x13,0x00,0xb0,0xcd,0xbb,0xbb,0xb0,0x0b,0x6a,0x00,0x00,
+0xb0,0x24,0x1a,0xf9,0x03,0x51,0x1e,0xbb,0xbb,0xc0,0x00,0x0a,0x00,0x02,0x3e,0x03,
+0x10,0x8a,0x65,0x00,0xd2,0x77,0x90,0x00,0x04,0xc5,0x00,0x4c,0x40,0x4b,0x7a,0xaa,
+0xa6,0xa3,0xb8,0x00,0x30,0xea,0xaa,0xae,0x25,0x00,0x15,0x0c,0x0a,0x00,0xf0,0x03,
+0x0b,0x00,0xeb,0xbb,0xbb,0xbe,0xb1,0x44,0x44,0x2b,0xb2,0x55,0x55,0x2b,0xb0,0x99,
+0x99,0x0b,0x48,0x06,0x01,0x04,0x00,0x50,0xda,0xab,0x0b,0xb0,0x20,0xff,0x08,0xf0,
+0x14,0x01,0xbb,0x00,0x04,0x30,0x00,0x00,0x03,0xfa,0x99,0x70,0x07,0xa2,0x11,0x85,
+0x03,0x73,0x80,0x69,0x00,0x00,0x07,0xd7,0x00,0x00,0x4a,0xfc,0x99,0x90,0x67,0xc1,
+0x11,0x1c,0x00,0x0a,0x4b,0x00,0x00,0x5e,0x07,0x00,0x09,0x00,0x00,0x26,0x04,0x71,
+0x20,0x06,0xaa,0xab,0x97,0x30,0x0a,0xfc,0x03,0x50,0xbb,0xbb,0xbb,0xb3,0x0b,0x7d,
+0x00,0xb0,0x0c,0x0b,0xbb,0xbb,0x80,0x0c,0x0b,0x00,0x00,0xc0,0x2b,0x05,0x00,0x71,
+0x87,0x0e,0xaa,0xaa,0xc0,0x80,0x0c,0xdf,0x00,0x01,0x2a,0x0d,0xa1,0x10,0x00,0x00,
+0x0d,0x00,0x00,0xbb,0xce,0xbb,0xbb,0x77,0x09,0x62,0xaa,0xaa,0x0b,0xb0,0xa0,0x0a,
 0x04,0x00,0x50,0xda,0xaa,0x0b,0xb0,0x30,0x8c,0x00,0xf0,0x05,0x05,0xbb,0x0b,0xbb,
 0xbf,0xcb,0xb5,0x00,0x00,0xab,0x20,0x00,0x00,0x5c,0x79,0x6b,0x50,0x1d,0x81,0x29,
-0x44,0x07,0x11,0x14,0xdd,0x00,0x10,0xab,0x45,0x09,0xd1,0x04,0x70,0x00,0xe9,0x99,
-0x9b,0x70,0x00,0xc1,0x11,0x15,0x70,0x00,0xc4,0x0f,0x10,0x01,0xb8,0x09,0xe0,0x4b,
-0x42,0xb4,0x00,0x2c,0x91,0x68,0x18,0xc3,0x01,0xaa,0xab,0xa6,0x10,0x5d,0x02,0xf2,
-0x00,0x00,0x00,0xaa,0xac,0xda,0x00,0x01,0xa0,0x00,0x0b,0x00,0x01,0xd9,0x99,0x9e,
-0x0a,0x00,0x02,0x7b,0x15,0xc0,0x06,0x60,0x00,0x0a,0xbb,0xbb,0xbb,0xa0,0xa1,0x00,
-0x00,0x1a,0x09,0x00,0x20,0x80,0xb0,0xca,0x00,0xf4,0x00,0x6c,0xaa,0xaa,0xc0,0xc6,
-0x50,0x00,0x0b,0x68,0x6c,0xaa,0xaa,0xc9,0x16,0x50,0xff,0x11,0x20,0x73,0x0c,0x0f,
-0x05,0xd2,0xae,0xaa,0x90,0x0a,0x20,0x0c,0x00,0x00,0x1b,0xaa,0xae,0xaa,0xa6,0x19,
-0x00,0x40,0xda,0xaa,0xac,0x60,0x91,0x00,0x50,0x60,0x00,0xd9,0x99,0x9b,0xbc,0x0a,
-0xf2,0x33,0x15,0x60,0x00,0x03,0x40,0x00,0x02,0xad,0x92,0x7a,0xaa,0x00,0x83,0x0b,
-0x10,0xb4,0xad,0xba,0xb0,0x0b,0x00,0xe6,0x0b,0x00,0xb0,0x5e,0xc2,0xb0,0x0b,0x0b,
-0x84,0xab,0x00,0xb7,0x68,0x30,0xb0,0x0b,0x20,0x83,0x0b,0xbb,0xe0,0x08,0x30,0x10,
-0x00,0xe9,0xa7,0xb9,0x9e,0xe8,0x97,0xb8,0x8e,0xc1,0x37,0xb1,0x1c,0xd7,0x73,0x57,
-0x7d,0xb0,0x89,0x96,0x0f,0x01,0x71,0xb0,0x0a,0x0b,0xb0,0xb9,0x96,0x0c,0x9a,0x0a,
-0x30,0x20,0x00,0x21,0x76,0x0a,0xf1,0x1b,0x82,0x00,0x0c,0xaa,0xe0,0xc8,0x73,0x0a,
-0x00,0xa1,0xd3,0xc1,0x0c,0xaa,0xc8,0xd1,0xc0,0x0b,0x00,0x02,0x58,0x90,0x0a,0xd9,
-0xd2,0x1e,0x30,0x39,0xa0,0x82,0x1e,0x10,0x75,0xd9,0xd2,0xa5,0xb0,0x51,0xa0,0x89,
-0x40,0x66,0x9b,0x00,0xf1,0x19,0x06,0x97,0xc5,0xa7,0xc0,0x06,0x97,0xb5,0xa7,0xc0,
-0x01,0x88,0x88,0x88,0x50,0x02,0x91,0x49,0x12,0xb0,0x02,0xc9,0xad,0x99,0xb0,0x02,
-0xc8,0x9c,0x88,0xb0,0x01,0x33,0x5a,0x33,0x20,0x18,0x88,0xac,0x88,0x85,0xaf,0x04,
-0xf2,0x1d,0x09,0x96,0x9a,0xcc,0xa0,0x0a,0x0a,0x98,0xba,0x60,0x0a,0x0a,0x93,0x76,
-0x20,0x0a,0x0a,0x99,0xcb,0x80,0x0a,0x0a,0x94,0x87,0x33,0x0e,0xba,0x46,0x78,0x6b,
-0x06,0x00,0x98,0x73,0x6a,0x00,0x02,0x78,0x23,0x28,0x00,0x03,0x11,0x06,0x8f,0x0c,
-0xe0,0x08,0xba,0x94,0xca,0xd0,0x08,0x21,0x94,0x50,0xb0,0x06,0xaa,0xa4,0xba,0x1d,
-0x13,0xf0,0x0c,0x4a,0x00,0x2a,0xaf,0xaa,0xeb,0xa7,0x04,0xc5,0x00,0x2b,0x71,0x2b,
-0xb8,0xb5,0xb8,0xd5,0x05,0x50,0xb5,0x50,0xb0,0x05,0xca,0xa5,0xca,0xb0,0x82,0x02,
-0x10,0x1b,0x91,0x01,0xf0,0x03,0xb0,0x8a,0xaa,0x0b,0x1b,0x0b,0x00,0xb0,0xb1,0xb0,
-0xb0,0x0b,0x0b,0x1b,0x0b,0xaa,0xd0,0xb1,0x09,0x02,0x60,0x1e,0xbb,0xbb,0xbb,0xe1,
-0xb0,0xa3,0x0b,0x00,0xc1,0x09,0x50,0x1a,0x00,0x07,0x00,0x91,0xb6,0x07,0xf0,0x08,
-0x1a,0x7a,0xcd,0xa9,0x91,0xa0,0x08,0xb1,0x09,0x1a,0x02,0xb1,0xa1,0x91,0xa4,0x91,
-0x02,0x89,0x1d,0x99,0x99,0x99,0xd1,0x48,0x06,0x10,0x10,0x52,0x00,0xf2,0x00,0xb0,
-0x04,0x30,0x0b,0xb6,0x9c,0xb9,0x6b,0xb0,0x05,0x40,0x0b,0xb0,0xc9,0x9c,0x39,0x01,
-0xb0,0x98,0x89,0x0b,0xe9,0x99,0x99,0x9e,0xb1,0x11,0x11,0x1c,0x4d,0x00,0xf0,0x15,
-0x0b,0x03,0x80,0x00,0xa0,0xb2,0xd9,0x8d,0x2a,0x0b,0x63,0xba,0x20,0xa0,0xb7,0xa7,
-0x6a,0x8b,0x0b,0x30,0x88,0x11,0xa0,0xb0,0x89,0x62,0x0a,0x0b,0x11,0x15,0x81,0xb0,
-0xe8,0x88,0x88,0x8d,0x57,0x02,0xf3,0x39,0xae,0x1b,0x00,0x09,0x45,0xa1,0xb6,0x88,
-0xd8,0x8a,0x1b,0x47,0x89,0x44,0xa1,0xb6,0x8a,0x6b,0x0a,0x1b,0x14,0x77,0x93,0xa1,
-0xb5,0x36,0x88,0x8a,0x1e,0x88,0x98,0x88,0xd1,0xb1,0x11,0x11,0x1a,0x10,0xea,0xac,
-0xba,0xae,0x1b,0x06,0xc7,0x80,0xa1,0xb4,0x7c,0x7b,0x6a,0x1b,0x09,0x66,0x82,0xa1,
-0xb0,0xa6,0x98,0x2a,0x1b,0x4a,0x6d,0x65,0xa1,0xb3,0x97,0xd7,0x5a,0x1e,0x88,0x8e,
-0x29,0x00,0x00,0x7b,0x00,0xf5,0x10,0x1b,0x08,0x66,0xa0,0xa1,0xb0,0x86,0x6a,0x0a,
-0x1b,0x39,0x66,0x85,0xa1,0xb3,0xc9,0x9b,0x5a,0x1b,0x3c,0x99,0xb5,0xa1,0xb4,0x82,
-0x28,0x4a,0x1e,0x98,0x88,0x89,0x29,0x00,0xf1,0x17,0xac,0x5b,0x0b,0x77,0x94,0x55,
-0xb0,0x97,0xa8,0x35,0x5b,0x67,0x7c,0x77,0x75,0xb4,0xa8,0x87,0xa5,0x5b,0x45,0xa7,
-0x5a,0x55,0xb4,0x8a,0xa6,0xa5,0x5e,0x99,0x99,0x99,0xb5,0xc1,0x11,0x11,0x16,0x50,
-0xb6,0x02,0x00,0x2e,0x1d,0x80,0x00,0x1b,0xbd,0xcb,0xbb,0xb6,0x00,0x2b,0xd5,0x05,
-0x00,0xd5,0x12,0x67,0x0a,0xe0,0xbb,0xeb,0xb1,0x27,0xdd,0x12,0x00,0x05,0x00,0x42,
-0xb5,0xbb,0xeb,0xb6,0x2d,0x1a,0x30,0x0a,0x00,0x0a,0x53,0x12,0xf0,0x13,0x81,0xa1,
-0x33,0x03,0xbe,0x98,0x5d,0xb7,0x90,0x00,0xa3,0xd8,0xb0,0x29,0x00,0x0a,0x19,0x1a,
-0x02,0x80,0x01,0xda,0x81,0xa4,0xb5,0x03,0xe8,0x08,0x18,0x00,0x20,0x12,0x00,0x82,
-0xec,0x02,0x31,0x04,0xca,0xab,0x67,0x16,0x00,0xc8,0x14,0x12,0x29,0x05,0x00,0x30,
-0x4a,0xd8,0x84,0x0a,0x00,0x50,0x84,0x2e,0xb8,0x01,0x90,0x0a,0x00,0xf3,0x02,0xca,
-0x84,0x29,0x00,0x4c,0x71,0x84,0x29,0x00,0x10,0x01,0x95,0x3a,0x11,0x00,0x07,0x99,
-0xc6,0x19,0xf1,0x17,0x01,0xa0,0x05,0x70,0x00,0x01,0xa0,0x0d,0xa9,0x97,0x3b,0xe9,
-0xa3,0x00,0x0a,0x01,0xa0,0x48,0x40,0x0a,0x01,0xa0,0x00,0xa3,0x19,0x01,0xa7,0x10,
-0x29,0x58,0x08,0xd4,0x29,0xa1,0x37,0x26,0x00,0x53,0x42,0x0d,0x22,0x6a,0xb1,0x2d,
-0x09,0xf0,0x07,0xea,0xe7,0x63,0x91,0x00,0xa0,0xb0,0x63,0x91,0x0a,0xea,0xea,0x63,
-0x91,0x02,0x90,0xb0,0x21,0x91,0x0a,0x10,0xa1,0x85,0x13,0x10,0x1a,0x70,0x17,0x60,
-0xbe,0xaa,0x70,0x00,0x00,0x2a,0x6d,0x0d,0xf1,0x21,0xaa,0xaa,0xa7,0x01,0x94,0x10,
-0xb0,0x00,0x06,0xb8,0x45,0xc5,0x30,0x4a,0xca,0x94,0xc5,0xa0,0x08,0x17,0x21,0xb1,
-0x90,0x0b,0xad,0x7a,0xb1,0xa0,0x00,0x82,0x02,0xe4,0xa0,0x4a,0xdb,0x97,0x45,0xa1,
-0x00,0x82,0x1c,0x00,0xb8,0x00,0x82,0x73,0x00,0x45,0x5f,0x00,0xf1,0x00,0x02,0xc2,
-0x22,0x77,0x10,0x16,0xd6,0x66,0xa9,0x50,0x00,0xb8,0x88,0xb5,0x00,0x05,0x00,0xf0,
-0x31,0x7a,0xea,0xaa,0xcc,0xa3,0x02,0xb0,0x10,0x3a,0x00,0x6c,0x89,0xda,0x96,0xc2,
-0x30,0x00,0x91,0x00,0x10,0x09,0x99,0xda,0x99,0x50,0x08,0xca,0x6b,0xaa,0xe0,0x01,
-0x83,0x0a,0x00,0xb0,0x3a,0xcb,0x9a,0x0a,0xa0,0x07,0x17,0x2b,0x88,0x81,0x1c,0xbe,
-0x7a,0xa1,0xb0,0x00,0x82,0x0a,0x56,0xa0,0x4a,0xdb,0x9a,0x0e,0x30,0x00,0x82,0x0a,
-0x5c,0x0f,0x00,0x27,0xa0,0x66,0x8a,0x0e,0xf0,0x01,0x19,0x07,0x9e,0x99,0x50,0x01,
-0x90,0xa0,0xa0,0x29,0x02,0xce,0x8c,0x9d,0x9a,0x90,0x0b,0x00,0xf7,0x0e,0x19,0x00,
-0x19,0x09,0xaf,0xa9,0x60,0x01,0x92,0x05,0xf1,0x91,0x01,0x7e,0x70,0xa9,0x77,0x80,
-0x27,0x00,0x66,0x96,0x57,0x00,0x00,0x57,0x06,0xa9,0xa0,0x3c,0x00,0xf3,0x04,0x0a,
-0x02,0x45,0xc4,0x41,0x0a,0x01,0x69,0x96,0x51,0x8e,0xb2,0xc5,0x55,0xa0,0x0a,0x00,
-0xc7,0x77,0x05,0x00,0xe0,0x41,0xc7,0x77,0xa0,0x6c,0x79,0xda,0xaa,0xd5,0x20,0x01,
-0x96,0x09,0x60,0xe4,0x1c,0x11,0x62,0x32,0x00,0xf7,0x45,0x91,0x08,0x40,0xa0,0x09,
-0x17,0x87,0xb8,0x77,0xdb,0xa5,0x29,0x79,0x09,0x19,0x26,0xb4,0x90,0x91,0x35,0x55,
-0x53,0x09,0x42,0xd9,0x9d,0x16,0xb7,0x2d,0x77,0xc1,0x10,0x01,0xd8,0x8c,0x10,0x00,
-0x1a,0x00,0x91,0x0c,0x9a,0xa9,0x9a,0x92,0x0a,0xaa,0xa8,0x09,0x90,0x0a,0x76,0x68,
-0xad,0xb2,0x0a,0x97,0x78,0x2e,0x00,0x0a,0xca,0xa9,0x77,0x60,0x0a,0xa0,0x4c,0xa0,
-0xc3,0x19,0x99,0xeb,0xa9,0x81,0x55,0x00,0x08,0x10,0x00,0x84,0x88,0x8c,0x98,0xce,
-0x13,0x01,0x18,0x15,0xf0,0x10,0x02,0xeb,0xc2,0xc0,0x00,0x08,0x30,0xc0,0xc1,0x00,
-0x2b,0x21,0xc0,0xdc,0x30,0x33,0xba,0x70,0xc1,0xc3,0x00,0x0e,0x10,0xc0,0x12,0x00,
-0x87,0x00,0xc0,0x00,0x07,0x23,0x00,0x12,0x49,0xd1,0x05,0x10,0x51,0x06,0x04,0xf5,
-0x1a,0xfa,0xa8,0x00,0x03,0xb6,0x00,0xb3,0x00,0x04,0x18,0x8c,0x40,0x00,0x01,0x5b,
-0xa7,0xa0,0x00,0x0b,0x72,0x6c,0xaa,0xe2,0x00,0x5c,0x91,0x06,0x70,0x00,0x40,0x1b,
-0xa8,0x00,0x00,0x36,0xba,0x30,0x00,0x0b,0x85,0x00,0x16,0x1a,0x10,0x48,0xeb,0x06,
-0x10,0xdd,0x4f,0x07,0x20,0x9e,0x20,0xe8,0x09,0xf0,0x03,0x90,0x00,0x00,0x07,0x70,
-0xb1,0x00,0x00,0x4c,0x00,0x3c,0x10,0x09,0xb0,0x00,0x05,0xd4,0x05,0xb7,0x0f,0x30,
-0x08,0xbb,0xbb,0x5e,0x09,0x13,0x38,0x32,0x00,0x90,0x0b,0xbb,0xdd,0xbb,0xb6,0x00,
-0x00,0xad,0x10,0xd8,0x01,0xc0,0x80,0x00,0x00,0x2c,0x20,0x87,0x00,0x08,0xc2,0x00,
-0x08,0xb4,0x2d,0x00,0x1d,0x24,0x5a,0x00,0x10,0x8e,0x5a,0x00,0xf0,0x0a,0xc3,0xa0,
-0x00,0x00,0x05,0x80,0xb2,0x00,0x00,0x2d,0x90,0x3c,0x00,0x06,0xc2,0x5b,0x05,0xc2,
-0x18,0x00,0x05,0x10,0x36,0x00,0x82,0x55,0x00,0xc0,0xeb,0xce,0xbb,0x90,0x09,0x40,
-0x38,0x00,0x00,0x06,0x00,0x47,0x6d,0x09,0x10,0xde,0x37,0x00,0xf1,0x03,0xc9,0x50,
-0x00,0x00,0x08,0x80,0xc2,0x00,0x03,0xb8,0x00,0x2c,0x61,0x19,0x20,0x00,0x00,0x67,
-0x5a,0x00,0x02,0xe0,0x09,0xf0,0x08,0x73,0x39,0x0a,0x00,0x00,0xe2,0x39,0x1d,0x10,
-0x08,0x6b,0x7c,0xb5,0xb1,0x07,0x00,0xba,0x50,0x23,0x00,0x09,0x61,0xc1,0xff,0x00,
-0x20,0x2c,0x60,0x2d,0x00,0x12,0x66,0xd6,0x02,0xf8,0x1c,0x40,0x25,0x55,0x40,0x1a,
-0x21,0x24,0x4a,0x90,0x7e,0x9d,0x00,0x3a,0x00,0x19,0x0b,0x00,0x92,0x00,0x56,0x19,
-0xab,0xec,0xb3,0x3c,0x94,0x00,0x92,0x00,0x03,0xf4,0x00,0x92,0x00,0x0b,0x4b,0x00,
-0x92,0x00,0x94,0x00,0x0a,0xc1,0x1d,0x19,0x10,0x80,0x93,0x1a,0xf0,0x1c,0x61,0x07,
-0x44,0x20,0x4d,0x9d,0x1a,0x01,0xb0,0x0a,0x0a,0xbc,0xbb,0xc5,0x0a,0x19,0x10,0x00,
-0x12,0x1b,0x95,0x4c,0x99,0xe0,0x00,0xd8,0x45,0x00,0xb0,0x1b,0x44,0x5b,0x88,0xd0,
-0x37,0x00,0x47,0x11,0xb0,0x02,0xbb,0xbb,0xbb,0xae,0x0b,0x60,0x6b,0x10,0x00,0x00,
-0x0b,0x70,0xcc,0x18,0x02,0xa5,0x00,0x11,0xb8,0x0a,0x00,0x03,0x05,0x00,0x10,0x2a,
-0xd0,0x06,0x13,0xc6,0xd2,0x1a,0xf0,0x02,0x28,0x88,0xbb,0x88,0x80,0x59,0x22,0x22,
-0x22,0xc0,0x35,0x7b,0xbb,0xb4,0x80,0x00,0x00,0x48,0x13,0x00,0xf8,0x23,0x02,0xa6,
-0x11,0x02,0x34,0x09,0x10,0x74,0x95,0x02,0x11,0xc2,0x5d,0x0d,0x00,0x40,0x03,0x60,
-0x90,0x00,0x00,0x1b,0xbe,0xbb,0x6b,0x04,0x00,0x13,0x00,0xf3,0x04,0xb3,0x6a,0xad,
-0xb0,0x0b,0xd0,0x00,0x67,0x00,0x35,0xb4,0xbb,0xeb,0xb8,0x00,0xb0,0x00,0xa1,0x00,
-0x05,0x00,0x14,0x2a,0x00,0x0d,0xf0,0x1b,0x11,0x02,0x00,0x00,0x06,0x82,0xba,0x58,
-0xc0,0x06,0x95,0x77,0x48,0xb0,0x05,0xa6,0xaa,0x58,0xa0,0x0c,0x99,0x99,0x89,0xc5,
-0x09,0x58,0x88,0x85,0x57,0x00,0x00,0x18,0x60,0x00,0x29,0x99,0xbc,0x99,0x96,0x00,
-0x00,0x46,0x9f,0x06,0x13,0xb4,0x6c,0x0c,0x21,0x06,0x60,0xa1,0x08,0x00,0x90,0x09,
-0x90,0x08,0x10,0x03,0x30,0x0a,0x25,0xba,0x30,0x0a,0x00,0x17,0xb2,0x10,0x00,0x03,
-0x0a,0x20,0x00,0x0c,0x05,0xcb,0xbb,0xd6,0x60,0x00,0x00,0x8e,0x01,0xf1,0x16,0x0c,
-0xaa,0xaa,0xaa,0xd4,0x0b,0x00,0xa0,0x00,0x84,0x0b,0xbc,0xeb,0xbb,0xb5,0x00,0x2b,
-0x00,0x95,0x00,0x00,0x7c,0x54,0xc0,0x00,0x00,0x01,0xbf,0xa2,0x00,0x03,0x8c,0x70,
-0x4c,0x91,0x04,0x30,0x0b,0x1b,0xf2,0x03,0x52,0x00,0x00,0x06,0x66,0xab,0x66,0x62,
-0x0b,0x44,0x44,0x44,0x95,0x0a,0x6a,0xaa,0xa9,0x75,0xb1,0x0f,0x10,0xbb,0xd2,0x00,
-0x42,0x0c,0x01,0xa0,0x00,0x05,0x00,0x98,0x77,0x01,0xa0,0x0b,0x1b,0x80,0x00,0xcb,
-0xb6,0xb6,0x19,0x10,0x2b,0x70,0x0f,0x30,0xaa,0xaa,0xe1,0xb7,0x0c,0x90,0xb1,0x01,
-0x69,0xae,0x99,0x40,0x00,0x62,0x0b,0xf2,0x17,0xb0,0x0e,0xaa,0x70,0x00,0xe7,0x0b,
-0x00,0x00,0x09,0x5b,0x6b,0xa6,0x09,0x24,0x8d,0xcb,0x9b,0x13,0x10,0x34,0x34,0x0b,
-0xf0,0x14,0xbe,0xaa,0xa3,0x0b,0x05,0x00,0x50,0x74,0x02,0x96,0x15,0x4b,0x30,0x09,
-0x50,0xbb,0x41,0xa0,0x00,0x3b,0x20,0x96,0x00,0x1a,0xfc,0xaa,0xaf,0xc4,0x15,0xa1,
-0x00,0x0b,0x12,0x00,0xa1,0x65,0x05,0x30,0xab,0xaa,0xad,0x05,0x14,0x00,0xff,0x12,
-0xf1,0x1c,0xcb,0x99,0x91,0x0b,0x57,0x77,0x77,0x91,0x49,0xd7,0xaa,0x7d,0x94,0x00,
-0xa6,0x98,0x69,0x00,0x00,0xa6,0x66,0x69,0x10,0x00,0xd6,0x66,0x6c,0x20,0x00,0xd7,
-0x77,0x7c,0x20,0x00,0x8d,0x88,0xd9,0x00,0x08,0x83,0x00,0x27,0x80,0xa8,0x1e,0xf6,
-0x1e,0x0a,0xaa,0xbc,0xaa,0xa2,0x0a,0x15,0x62,0x22,0x73,0x01,0xb3,0x04,0x6c,0x10,
-0x00,0xb8,0x64,0x8d,0x00,0x00,0x9a,0x87,0x7b,0x00,0x00,0x6e,0x99,0x99,0x80,0x1b,
-0x83,0x45,0x60,0xb0,0x02,0x92,0x99,0x35,0xb0,0x00,0x70,0x52,0x5a,0x70,0xad,0x20,
-0xf2,0x0a,0x07,0x77,0xae,0x77,0x75,0x0b,0x28,0x32,0x92,0x2b,0x04,0x7c,0x87,0xc7,
+0x44,0x07,0x11,0x14,0xdd,0x00,0x10,0xab,0x45,0x09,0xf0,0x00,0x04,0x70,0x00,0xe9,
+0x99,0x9b,0x70,0x00,0xc1,0x11,0x15,0x70,0x00,0x00,0x13,0x9c,0x03,0x00,0xb8,0x09,
+0xe0,0x4b,0x42,0xb4,0x00,0x2c,0x91,0x68,0x18,0xc3,0x01,0xaa,0xab,0xa6,0x10,0x5d,
+0x02,0xf2,0x00,0x00,0x00,0xaa,0xac,0xda,0x00,0x01,0xa0,0x00,0x0b,0x00,0x01,0xd9,
+0x99,0x9e,0x0a,0x00,0x20,0x00,0x00,0x3f,0x0a,0xc0,0x06,0x60,0x00,0x0a,0xbb,0xbb,
+0xbb,0xa0,0xa1,0x00,0x00,0x1a,0x09,0x00,0x20,0x80,0xb0,0xca,0x00,0xf3,0x02,0x6c,
+0xaa,0xaa,0xc0,0xc6,0x50,0x00,0x0b,0x68,0x6c,0xaa,0xaa,0xc9,0x16,0x50,0x00,0x0b,
+0x9a,0x03,0x10,0x0c,0x0f,0x05,0xd2,0xae,0xaa,0x90,0x0a,0x20,0x0c,0x00,0x00,0x1b,
+0xaa,0xae,0xaa,0xa6,0x19,0x00,0x40,0xda,0xaa,0xac,0x60,0x91,0x00,0xb0,0x60,0x00,
+0xd9,0x99,0x9b,0x60,0x00,0xb1,0x11,0x15,0x60,0xf0,0x75,0x00,0x03,0x40,0x00,0x02,
+0xad,0x92,0x7a,0xaa,0x00,0x83,0x0b,0x10,0xb4,0xad,0xba,0xb0,0x0b,0x00,0xe6,0x0b,
+0x00,0xb0,0x5e,0xc2,0xb0,0x0b,0x0b,0x84,0xab,0x00,0xb7,0x68,0x30,0xb0,0x0b,0x20,
+0x83,0x0b,0xbb,0xe0,0x08,0x30,0x10,0x00,0xe9,0xa7,0xb9,0x9e,0xe8,0x97,0xb8,0x8e,
+0xc1,0x37,0xb1,0x1c,0xd7,0x73,0x57,0x7d,0xb0,0x89,0x96,0x0b,0xb0,0xa0,0x0a,0x0b,
+0xb0,0xb0,0x0a,0x0b,0xb0,0xb9,0x96,0x0c,0xb0,0x00,0x04,0xbb,0x00,0x20,0x00,0x21,
+0x00,0x00,0x55,0x00,0x82,0x00,0x0c,0xaa,0xe0,0xc8,0x73,0x0a,0x00,0xa1,0xd3,0xc1,
+0x0c,0xaa,0xc8,0xd1,0xc0,0x0b,0x00,0x02,0x58,0x90,0x0a,0xd9,0xd2,0x1e,0x30,0x39,
+0xa0,0x82,0x1e,0x10,0x75,0xd9,0xd2,0xa5,0xb0,0x51,0xa0,0x89,0x40,0x66,0x00,0x01,
+0x00,0xf1,0x4b,0x06,0x97,0xc5,0xa7,0xc0,0x06,0x97,0xb5,0xa7,0xc0,0x01,0x88,0x88,
+0x88,0x50,0x02,0x91,0x49,0x12,0xb0,0x02,0xc9,0xad,0x99,0xb0,0x02,0xc8,0x9c,0x88,
+0xb0,0x01,0x33,0x5a,0x33,0x20,0x18,0x88,0xac,0x88,0x85,0x00,0x00,0x28,0x00,0x00,
+0x09,0x96,0x9a,0xcc,0xa0,0x0a,0x0a,0x98,0xba,0x60,0x0a,0x0a,0x93,0x76,0x20,0x0a,
+0x0a,0x99,0xcb,0x80,0x0a,0x0a,0x94,0x87,0x33,0x0e,0xba,0x46,0x78,0x6b,0x06,0x00,
+0x98,0x73,0x6a,0x00,0x02,0x78,0x23,0x28,0x00,0x03,0x11,0x06,0xb4,0x5f,0x00,0xf0,
+0x42,0x08,0xba,0x94,0xca,0xd0,0x08,0x21,0x94,0x50,0xb0,0x06,0xaa,0xa4,0xba,0xb0,
+0x00,0x00,0xc0,0x4a,0x00,0x2a,0xaf,0xaa,0xeb,0xa7,0x04,0xc5,0x00,0x2b,0x71,0x2b,
+0xb8,0xb5,0xb8,0xd5,0x05,0x50,0xb5,0x50,0xb0,0x05,0xca,0xa5,0xca,0xb0,0xeb,0xbb,
+0xbb,0xbe,0x1b,0x00,0x00,0x00,0xb1,0xb0,0x8a,0xaa,0x0b,0x1b,0x0b,0x00,0xb0,0xb1,
+0xb0,0xb0,0x0b,0x0b,0x1b,0x0b,0xaa,0xd0,0xb1,0xb0,0x00,0x00,0x0b,0x1e,0xbb,0xbb,
+0xbb,0xe1,0x09,0x00,0xf0,0x1b,0x10,0xea,0xaa,0xaa,0xae,0x1a,0x00,0x07,0x00,0x91,
+0xa0,0x00,0xb0,0x09,0x1a,0x7a,0xcd,0xa9,0x91,0xa0,0x08,0xb1,0x09,0x1a,0x02,0xb1,
+0xa1,0x91,0xa4,0x91,0x02,0x89,0x1d,0x99,0x99,0x99,0xd1,0xb0,0x00,0x00,0x0a,0x10,
+0x52,0x00,0xf2,0x00,0xb0,0x04,0x30,0x0b,0xb6,0x9c,0xb9,0x6b,0xb0,0x05,0x40,0x0b,
+0xb0,0xc9,0x9c,0x39,0x01,0xb0,0x98,0x89,0x0b,0xe9,0x99,0x99,0x9e,0xb1,0x11,0x11,
+0x1c,0x4d,0x00,0xf3,0x61,0x0b,0x03,0x80,0x00,0xa0,0xb2,0xd9,0x8d,0x2a,0x0b,0x63,
+0xba,0x20,0xa0,0xb7,0xa7,0x6a,0x8b,0x0b,0x30,0x88,0x11,0xa0,0xb0,0x89,0x62,0x0a,
+0x0b,0x11,0x15,0x81,0xb0,0xe8,0x88,0x88,0x8d,0x00,0xea,0xaa,0xab,0xae,0x1b,0x00,
+0x09,0x45,0xa1,0xb6,0x88,0xd8,0x8a,0x1b,0x47,0x89,0x44,0xa1,0xb6,0x8a,0x6b,0x0a,
+0x1b,0x14,0x77,0x93,0xa1,0xb5,0x36,0x88,0x8a,0x1e,0x88,0x98,0x88,0xd1,0xb1,0x11,
+0x11,0x1a,0x10,0xea,0xac,0xba,0xae,0x1b,0x06,0xc7,0x80,0xa1,0xb4,0x7c,0x7b,0x6a,
+0x1b,0x09,0x66,0x82,0xa1,0xb0,0xa6,0x98,0x2a,0x1b,0x4a,0x6d,0x65,0xa1,0xb3,0x97,
+0xd7,0x5a,0x1e,0x88,0x8e,0x29,0x00,0x00,0x7b,0x00,0xf5,0x10,0x1b,0x08,0x66,0xa0,
+0xa1,0xb0,0x86,0x6a,0x0a,0x1b,0x39,0x66,0x85,0xa1,0xb3,0xc9,0x9b,0x5a,0x1b,0x3c,
+0x99,0xb5,0xa1,0xb4,0x82,0x28,0x4a,0x1e,0x98,0x88,0x89,0x29,0x00,0xf6,0x3b,0xac,
+0x5b,0x0b,0x77,0x94,0x55,0xb0,0x97,0xa8,0x35,0x5b,0x67,0x7c,0x77,0x75,0xb4,0xa8,
+0x87,0xa5,0x5b,0x45,0xa7,0x5a,0x55,0xb4,0x8a,0xa6,0xa5,0x5e,0x99,0x99,0x99,0xb5,
+0xc1,0x11,0x11,0x16,0x50,0x00,0x00,0x30,0x00,0x00,0x00,0x02,0xa0,0x00,0x00,0x1b,
+0xbd,0xcb,0xbb,0xb6,0x00,0x2b,0x00,0x10,0x00,0x00,0xb3,0x00,0xb0,0x00,0x0a,0xe0,
+0xbb,0xeb,0xb1,0x27,0xb0,0x00,0xb0,0x00,0x00,0x05,0x00,0x60,0xb5,0xbb,0xeb,0xb6,
+0x00,0x00,0x23,0x00,0xf1,0x22,0x0a,0x00,0x0a,0x00,0x00,0x00,0xa0,0x81,0xa1,0x33,
+0x03,0xbe,0x98,0x5d,0xb7,0x90,0x00,0xa3,0xd8,0xb0,0x29,0x00,0x0a,0x19,0x1a,0x02,
+0x80,0x01,0xda,0x81,0xa4,0xb5,0x03,0xe8,0x08,0x18,0x00,0x20,0x12,0x00,0x82,0x00,
+0x0b,0x00,0x00,0x04,0xca,0xab,0x90,0xde,0x01,0x42,0x01,0x90,0x00,0x29,0x05,0x00,
+0x30,0x4a,0xd8,0x84,0x0a,0x00,0x50,0x84,0x2e,0xb8,0x01,0x90,0x0a,0x00,0xf2,0x04,
+0xca,0x84,0x29,0x00,0x4c,0x71,0x84,0x29,0x00,0x10,0x01,0x95,0x3a,0x11,0x00,0x07,
+0x99,0x99,0x98,0x32,0x00,0xf1,0x1d,0xa0,0x05,0x70,0x00,0x01,0xa0,0x0d,0xa9,0x97,
+0x3b,0xe9,0xa3,0x00,0x0a,0x01,0xa0,0x48,0x40,0x0a,0x01,0xa0,0x00,0xa3,0x19,0x01,
+0xa7,0x10,0x29,0x58,0x08,0xd4,0x29,0xa1,0x37,0x26,0x00,0x53,0x00,0x55,0x00,0x00,
+0x00,0x6a,0xb1,0x32,0x00,0xf1,0x4b,0x07,0xea,0xe7,0x63,0x91,0x00,0xa0,0xb0,0x63,
+0x91,0x0a,0xea,0xea,0x63,0x91,0x02,0x90,0xb0,0x21,0x91,0x0a,0x10,0xa1,0x09,0xb0,
+0x00,0x00,0x1a,0x00,0x00,0x02,0xaa,0xbe,0xaa,0x70,0x00,0x00,0x2a,0x00,0x00,0x2a,
+0xaa,0xaa,0xaa,0xa7,0x01,0x94,0x10,0xb0,0x00,0x06,0xb8,0x45,0xc5,0x30,0x4a,0xca,
+0x94,0xc5,0xa0,0x08,0x17,0x21,0xb1,0x90,0x0b,0xad,0x7a,0xb1,0xa0,0x00,0x82,0x02,
+0xe4,0xa0,0x4a,0xdb,0x97,0x45,0xa1,0x00,0x82,0x1c,0x00,0xb8,0x00,0x82,0x73,0x00,
+0x45,0x5f,0x00,0xf1,0x00,0x02,0xc2,0x22,0x77,0x10,0x16,0xd6,0x66,0xa9,0x50,0x00,
+0xb8,0x88,0xb5,0x00,0x05,0x00,0xf0,0x31,0x7a,0xea,0xaa,0xcc,0xa3,0x02,0xb0,0x10,
+0x3a,0x00,0x6c,0x89,0xda,0x96,0xc2,0x30,0x00,0x91,0x00,0x10,0x09,0x99,0xda,0x99,
+0x50,0x08,0xca,0x6b,0xaa,0xe0,0x01,0x83,0x0a,0x00,0xb0,0x3a,0xcb,0x9a,0x0a,0xa0,
+0x07,0x17,0x2b,0x88,0x81,0x1c,0xbe,0x7a,0xa1,0xb0,0x00,0x82,0x0a,0x56,0xa0,0x4a,
+0xdb,0x9a,0x0e,0x30,0x00,0x82,0x0a,0x5c,0x0f,0x00,0x36,0xa0,0x66,0x00,0x01,0x00,
+0xf0,0x01,0x19,0x07,0x9e,0x99,0x50,0x01,0x90,0xa0,0xa0,0x29,0x02,0xce,0x8c,0x9d,
+0x9a,0x90,0x0b,0x00,0xf7,0x0e,0x19,0x00,0x19,0x09,0xaf,0xa9,0x60,0x01,0x92,0x05,
+0xf1,0x91,0x01,0x7e,0x70,0xa9,0x77,0x80,0x27,0x00,0x66,0x96,0x57,0x00,0x00,0x57,
+0x06,0xa9,0xa0,0x3c,0x00,0xf3,0x04,0x0a,0x02,0x45,0xc4,0x41,0x0a,0x01,0x69,0x96,
+0x51,0x8e,0xb2,0xc5,0x55,0xa0,0x0a,0x00,0xc7,0x77,0x05,0x00,0xf1,0x04,0x41,0xc7,
+0x77,0xa0,0x6c,0x79,0xda,0xaa,0xd5,0x20,0x01,0x96,0x09,0x60,0x00,0x08,0x20,0x00,
+0x62,0x32,0x00,0xf7,0x46,0x91,0x08,0x40,0xa0,0x09,0x17,0x87,0xb8,0x77,0xdb,0xa5,
+0x29,0x79,0x09,0x19,0x26,0xb4,0x90,0x91,0x35,0x55,0x53,0x09,0x42,0xd9,0x9d,0x16,
+0xb7,0x2d,0x77,0xc1,0x10,0x01,0xd8,0x8c,0x10,0x00,0x1a,0x00,0x91,0x0c,0x9a,0xa9,
+0x9a,0x92,0x0a,0xaa,0xa8,0x09,0x90,0x0a,0x76,0x68,0xad,0xb2,0x0a,0x97,0x78,0x2e,
+0x00,0x0a,0xca,0xa9,0x77,0x60,0x0a,0xa0,0x4c,0xa0,0xc3,0x19,0x99,0xeb,0xa9,0x81,
+0x55,0x00,0x08,0x10,0x00,0x84,0x88,0x8c,0x98,0x83,0x92,0x00,0xf0,0x14,0xb0,0x00,
+0xc0,0x00,0x02,0xeb,0xc2,0xc0,0x00,0x08,0x30,0xc0,0xc1,0x00,0x2b,0x21,0xc0,0xdc,
+0x30,0x33,0xba,0x70,0xc1,0xc3,0x00,0x0e,0x10,0xc0,0x12,0x00,0x87,0x00,0xc0,0x00,
+0x07,0x23,0x00,0x80,0x49,0x00,0x00,0xc0,0x00,0x00,0x00,0x51,0x06,0x04,0xf1,0x19,
+0xfa,0xa8,0x00,0x03,0xb6,0x00,0xb3,0x00,0x04,0x18,0x8c,0x40,0x00,0x01,0x5b,0xa7,
+0xa0,0x00,0x0b,0x72,0x6c,0xaa,0xe2,0x00,0x5c,0x91,0x06,0x70,0x00,0x40,0x1b,0xa8,
+0x00,0x00,0x36,0xba,0x30,0x00,0x0b,0x85,0x60,0x00,0x10,0x39,0x05,0x00,0xf3,0x1f,
+0x48,0x00,0x00,0x1b,0xbb,0xdd,0xbb,0xb7,0x00,0x00,0x9e,0x20,0x00,0x00,0x00,0xc4,
+0x90,0x00,0x00,0x07,0x70,0xb1,0x00,0x00,0x4c,0x00,0x3c,0x10,0x09,0xb0,0x00,0x05,
+0xd4,0x05,0x00,0x00,0x00,0x23,0x08,0xbb,0xbb,0xbb,0xb1,0x00,0x00,0x38,0x32,0x00,
+0x90,0x0b,0xbb,0xdd,0xbb,0xb6,0x00,0x00,0xad,0x10,0xd8,0x01,0xc0,0x80,0x00,0x00,
+0x2c,0x20,0x87,0x00,0x08,0xc2,0x00,0x08,0xb4,0x2d,0x00,0x1d,0x24,0x5a,0x00,0x10,
+0x8e,0x5a,0x00,0xf0,0x0a,0xc3,0xa0,0x00,0x00,0x05,0x80,0xb2,0x00,0x00,0x2d,0x90,
+0x3c,0x00,0x06,0xc2,0x5b,0x05,0xc2,0x18,0x00,0x05,0x10,0x36,0x00,0x82,0x55,0x00,
+0xf0,0x02,0xeb,0xce,0xbb,0x90,0x09,0x40,0x38,0x00,0x00,0x06,0x00,0x47,0x00,0x00,
+0x2b,0xbb,0xde,0x37,0x00,0xf1,0x03,0xc9,0x50,0x00,0x00,0x08,0x80,0xc2,0x00,0x03,
+0xb8,0x00,0x2c,0x61,0x19,0x20,0x00,0x00,0x67,0x5a,0x00,0xf0,0x0e,0x2b,0xbb,0xce,
+0xbb,0xb7,0x00,0x73,0x39,0x0a,0x00,0x00,0xe2,0x39,0x1d,0x10,0x08,0x6b,0x7c,0xb5,
+0xb1,0x07,0x00,0xba,0x50,0x23,0x00,0x09,0x61,0xc1,0xff,0x00,0x20,0x2c,0x60,0x2d,
+0x00,0x12,0x66,0xd6,0x02,0xf7,0x1c,0x40,0x25,0x55,0x40,0x1a,0x21,0x24,0x4a,0x90,
+0x7e,0x9d,0x00,0x3a,0x00,0x19,0x0b,0x00,0x92,0x00,0x56,0x19,0xab,0xec,0xb3,0x3c,
+0x94,0x00,0x92,0x00,0x03,0xf4,0x00,0x92,0x00,0x0b,0x4b,0x00,0x92,0x00,0x94,0x00,
+0x0a,0xc1,0x7b,0x01,0xf0,0x2b,0x03,0x80,0x00,0xb0,0x00,0x06,0x61,0x07,0x44,0x20,
+0x4d,0x9d,0x1a,0x01,0xb0,0x0a,0x0a,0xbc,0xbb,0xc5,0x0a,0x19,0x10,0x00,0x12,0x1b,
+0x95,0x4c,0x99,0xe0,0x00,0xd8,0x45,0x00,0xb0,0x1b,0x44,0x5b,0x88,0xd0,0x37,0x00,
+0x47,0x11,0xb0,0x02,0xbb,0xbb,0xbb,0x70,0x00,0x00,0x00,0x6b,0x10,0x00,0x00,0x0b,
+0x09,0x00,0x12,0x1a,0xa5,0x00,0x11,0xb8,0x0a,0x00,0x02,0x05,0x00,0x00,0x3a,0x03,
+0x30,0x00,0x0b,0xc6,0x0a,0x00,0xf0,0x06,0x50,0x00,0x00,0x28,0x88,0xbb,0x88,0x80,
+0x59,0x22,0x22,0x22,0xc0,0x35,0x7b,0xbb,0xb4,0x80,0x00,0x00,0x06,0x8a,0x02,0xd2,
+0x68,0x00,0x00,0x5b,0xbb,0xdc,0xbb,0xb0,0x00,0x00,0x74,0x00,0x00,0x05,0x00,0x20,
+0x0a,0xc2,0x0a,0x00,0x10,0x20,0x40,0x03,0x60,0x90,0x00,0x00,0x1b,0xbe,0xbb,0x6b,
+0x04,0x00,0x13,0x00,0xf3,0x04,0xb3,0x6a,0xad,0xb0,0x0b,0xd0,0x00,0x67,0x00,0x35,
+0xb4,0xbb,0xeb,0xb8,0x00,0xb0,0x00,0xa1,0x00,0x05,0x00,0x23,0x2a,0xc0,0xc4,0x00,
+0xf0,0x1b,0x11,0x02,0x00,0x00,0x06,0x82,0xba,0x58,0xc0,0x06,0x95,0x77,0x48,0xb0,
+0x05,0xa6,0xaa,0x58,0xa0,0x0c,0x99,0x99,0x89,0xc5,0x09,0x58,0x88,0x85,0x57,0x00,
+0x00,0x18,0x60,0x00,0x29,0x99,0xbc,0x99,0x96,0x00,0x00,0x46,0x9f,0x06,0x10,0xb4,
+0xf6,0x00,0x00,0x09,0x00,0x21,0x60,0x00,0xcd,0x05,0xf2,0x0c,0x00,0x00,0x0c,0x08,
+0x10,0x03,0x30,0x0a,0x25,0xba,0x30,0x0a,0xb6,0x10,0x00,0x0a,0x10,0x00,0x03,0x0a,
+0x20,0x00,0x0c,0x05,0xcb,0xbb,0xd6,0x60,0x00,0x00,0x8e,0x01,0xf1,0x2d,0x0c,0xaa,
+0xaa,0xaa,0xd4,0x0b,0x00,0xa0,0x00,0x84,0x0b,0xbc,0xeb,0xbb,0xb5,0x00,0x2b,0x00,
+0x95,0x00,0x00,0x7c,0x54,0xc0,0x00,0x00,0x01,0xbf,0xa2,0x00,0x03,0x8c,0x70,0x4c,
+0x91,0x04,0x30,0x00,0x00,0x40,0x00,0x00,0x52,0x00,0x00,0x06,0x66,0xab,0x66,0x62,
+0x0b,0x44,0x44,0x44,0x95,0x0a,0x6a,0xaa,0xa9,0x75,0x44,0x00,0x20,0x1b,0xbb,0xd2,
+0x00,0x42,0x0c,0x01,0xa0,0x00,0x05,0x00,0x93,0x77,0x01,0xa0,0x0b,0x1b,0x80,0x00,
+0xcb,0xb6,0x64,0x00,0x40,0x01,0x00,0x00,0x00,0xf1,0x00,0xf3,0x19,0x0e,0xaa,0xaa,
+0xaa,0xe1,0x0b,0x01,0x11,0x11,0xb1,0x01,0x69,0xae,0x99,0x40,0x00,0x62,0x0b,0x00,
+0x00,0x00,0xc1,0x0e,0xaa,0x70,0x00,0xe7,0x0b,0x00,0x00,0x09,0x5b,0x6b,0x00,0x00,
+0x3b,0x00,0x8d,0xcb,0xb4,0x37,0x00,0xf0,0x19,0x34,0x00,0x00,0x0a,0xaa,0xbe,0xaa,
+0xa3,0x0b,0x05,0x00,0x50,0x74,0x02,0x96,0x15,0x4b,0x30,0x09,0x50,0xbb,0x41,0xa0,
+0x00,0x3b,0x20,0x96,0x00,0x1a,0xfc,0xaa,0xaf,0xc4,0x15,0xa1,0x00,0x0b,0x12,0x00,
+0xa1,0x65,0x05,0x41,0xab,0xaa,0xad,0x00,0xa3,0x00,0xf0,0x21,0x09,0x99,0xcb,0x99,
+0x91,0x0b,0x57,0x77,0x77,0x91,0x49,0xd7,0xaa,0x7d,0x94,0x00,0xa6,0x98,0x69,0x00,
+0x00,0xa6,0x66,0x69,0x10,0x00,0xd6,0x66,0x6c,0x20,0x00,0xd7,0x77,0x7c,0x20,0x00,
+0x8d,0x88,0xd9,0x00,0x08,0x83,0x00,0x27,0x80,0x00,0x00,0x21,0x64,0x00,0xf3,0x1c,
+0xbc,0xaa,0xa2,0x0a,0x15,0x62,0x22,0x73,0x01,0xb3,0x04,0x6c,0x10,0x00,0xb8,0x64,
+0x8d,0x00,0x00,0x9a,0x87,0x7b,0x00,0x00,0x6e,0x99,0x99,0x80,0x1b,0x83,0x45,0x60,
+0xb0,0x02,0x92,0x99,0x35,0xb0,0x00,0x70,0x52,0x5a,0x70,0x9b,0x00,0xf2,0x0d,0x22,
+0x00,0x00,0x07,0x77,0xae,0x77,0x75,0x0b,0x28,0x32,0x92,0x2b,0x04,0x7c,0x87,0xc7,
 0x72,0x00,0xb7,0x77,0x79,0x80,0x00,0xc7,0x77,0x78,0x90,0x05,0x00,0xe4,0x8c,0x87,
 0xcc,0x60,0x00,0x3c,0x00,0xb3,0xa7,0x1a,0x91,0x00,0xa9,0x99,0x92,0x02,0x12,0x75,
-0x05,0x00,0x90,0x2b,0xbb,0xbb,0xdc,0xb7,0x00,0x10,0x00,0x75,0x6e,0x06,0x10,0x75,
-0xe8,0x0b,0x10,0x75,0xc9,0x09,0x14,0x75,0x23,0x00,0x26,0x8c,0xd2,0xc4,0x02,0xf6,
+0x05,0x00,0x70,0x2b,0xbb,0xbb,0xdc,0xb7,0x00,0x10,0x0f,0x00,0x10,0xb3,0x05,0x00,
+0x10,0x1c,0x05,0x00,0x34,0x04,0x10,0x75,0x23,0x00,0x26,0x8c,0xd2,0xc4,0x02,0xf7,
 0x1a,0x70,0x49,0x9c,0x60,0x03,0x70,0x25,0x09,0x4b,0xbc,0xd8,0x0b,0x2d,0x01,0x03,
 0x70,0x01,0xd9,0x09,0x33,0x70,0x00,0xc8,0x01,0xa3,0x70,0x06,0x8b,0x20,0x43,0x70,
-0x5b,0x02,0x20,0x03,0x70,0x10,0x00,0x00,0x8c,0x50,0xf9,0x02,0x00,0x9b,0x13,0xf7,
-0x1a,0xa0,0x0b,0x77,0xa0,0x01,0xa0,0x0b,0x88,0xa9,0xaa,0xe7,0x0b,0x66,0xa2,0x10,
+0x5b,0x02,0x20,0x03,0x70,0x10,0x00,0x00,0x8c,0x50,0xf9,0x02,0xf7,0x1d,0x84,0x00,
+0x00,0xa0,0x0b,0x77,0xa0,0x01,0xa0,0x0b,0x88,0xa9,0xaa,0xe7,0x0b,0x66,0xa2,0x10,
 0xa0,0x0a,0x22,0xa2,0x90,0xa0,0x3a,0xae,0xa0,0xa2,0xa0,0x00,0x94,0xa0,0x00,0xa0,
 0x1a,0x50,0xa0,0x00,0xa0,0x22,0x2a,0x70,0x5b,0x70,0x3c,0x05,0xf6,0x1d,0x0a,0x01,
 0xda,0x83,0x0a,0x0b,0x78,0x63,0xa1,0x0e,0xaa,0x17,0x5d,0x30,0x00,0x0a,0x49,0x92,
@@ -944,1528 +994,1538 @@ static const uint8_t lz4FontData[] ={
 0x99,0xda,0x91,0x00,0xa5,0x00,0x82,0x00,0x00,0x06,0x09,0xc1,0x00,0x7f,0x03,0xf2,
 0x09,0x80,0x1a,0x06,0x10,0x01,0xc0,0x1a,0x03,0x90,0x06,0x70,0x1a,0x00,0xb2,0x0c,
 0x10,0x1a,0x00,0x58,0x26,0x00,0x1a,0x00,0x0a,0x98,0x03,0x40,0x0a,0xc7,0x00,0x00,
-0xf6,0x02,0x10,0xc0,0x49,0x05,0x03,0x05,0x00,0xb0,0xfb,0xbb,0xbb,0xc0,0x01,0xb0,
-0x07,0x50,0x00,0x03,0x80,0xf4,0x28,0x30,0x50,0x00,0x87,0x2c,0x0b,0x30,0x0a,0x81,
-0x25,0x73,0x14,0x70,0x0b,0xaa,0xaa,0xaa,0xb0,0x0b,0x00,0xe1,0x0d,0xf1,0x12,0xaa,
-0xaa,0xbc,0x70,0x0b,0x27,0xac,0x83,0x00,0x0b,0x12,0x2c,0x69,0x40,0x0b,0x5a,0x9d,
-0x31,0x20,0x0b,0x25,0x7e,0xaa,0x80,0x38,0x65,0x3b,0x00,0x42,0x92,0x00,0x0a,0xaa,
-0x57,0x04,0x00,0xc3,0x0d,0x70,0xad,0x20,0xa1,0x00,0x00,0x82,0x0a,0x79,0x0c,0xf0,
-0x0c,0xb7,0x66,0x66,0x66,0x0c,0x33,0x33,0x33,0xc0,0xb0,0xd9,0x9a,0x0b,0x29,0x0a,
-0x00,0xa0,0xb8,0x30,0xe9,0x96,0x2a,0x50,0x01,0x00,0x8b,0x40,0x5b,0x00,0x30,0xc0,
-0x0b,0x00,0x87,0x01,0xf3,0x12,0xab,0xba,0xac,0x80,0x0b,0x04,0x60,0x0b,0x00,0x0b,
-0x5a,0xea,0xad,0xa0,0x0b,0x00,0xb0,0x19,0x00,0x0b,0x8b,0xda,0xbd,0xa3,0x48,0x0a,
-0x30,0x19,0x00,0x82,0x96,0x00,0x19,0x7f,0x15,0x00,0x8d,0x00,0x00,0x58,0x03,0xf2,
-0x15,0xb0,0x0c,0x68,0xa6,0xc6,0x50,0x0b,0x6b,0xd9,0xe9,0x90,0x0b,0x02,0x80,0xb0,
-0x00,0x0b,0x9d,0xbc,0xba,0xa2,0x1a,0x0b,0x03,0x7a,0x40,0x66,0x0c,0x58,0x69,0x20,
-0x70,0x29,0x51,0x01,0x82,0x2d,0x0a,0x4c,0xbb,0xce,0xbb,0xb2,0x1b,0x20,0x05,0x05,
-0x00,0x02,0xbb,0x04,0x10,0x04,0xb2,0x0b,0x00,0x50,0x0c,0x20,0x5b,0xbe,0x1f,0x0c,
-0x15,0x29,0x84,0x02,0x60,0xca,0xbd,0xcb,0x90,0x03,0x90,0xa3,0x0d,0x50,0x20,0x09,
-0x20,0x00,0x87,0x35,0x0d,0xf1,0x23,0x50,0x9b,0xbe,0xcb,0xb3,0x00,0x13,0x00,0x05,
-0x00,0x02,0x4c,0x33,0x89,0x30,0x05,0x77,0xba,0x77,0x71,0x02,0xaa,0xdc,0xaa,0x70,
-0x02,0x22,0xc2,0x22,0x21,0x18,0x8d,0xa8,0x88,0x84,0x00,0x3e,0xba,0xaa,0x90,0x05,
-0xc1,0x03,0x80,0x00,0x1a,0x69,0x9a,0xc9,0x95,0x10,0x0e,0x41,0x3b,0xbb,0xbb,0xbe,
-0xa7,0x0c,0x20,0x00,0x06,0x05,0x00,0x92,0x0b,0x99,0x99,0x9e,0x00,0x0b,0x21,0x11,
-0x17,0xe7,0x0b,0x00,0x05,0x00,0xb0,0x82,0x0b,0x10,0x00,0x00,0xb1,0x06,0xcb,0xbb,
-0xbc,0x80,0x03,0x05,0xf1,0x1a,0x00,0x03,0x99,0x44,0xb6,0x00,0x02,0x5a,0xdb,0xa3,
-0x00,0x08,0x58,0x60,0x18,0x10,0x6a,0xbe,0xaa,0xaa,0xa1,0x00,0xc3,0x37,0x00,0x00,
-0x2b,0xea,0xbd,0xac,0x50,0x52,0xb0,0x37,0x05,0x50,0x00,0xb0,0x37,0x6b,0x30,0xa9,
-0x1b,0xf0,0x12,0x00,0x92,0x93,0x79,0x10,0x19,0xea,0xdb,0xcd,0xa6,0x06,0x80,0xc9,
-0x78,0x86,0x0b,0x99,0x99,0x99,0xa4,0x0b,0x00,0x13,0x00,0x37,0x03,0xb9,0xad,0x9a,
-0x82,0x00,0xb0,0x28,0xe5,0x05,0x20,0x28,0x5b,0x8f,0x05,0x00,0x98,0x09,0xf0,0x16,
-0xa0,0x92,0x0a,0xb9,0x9c,0x8b,0x93,0xb3,0x88,0x88,0x66,0x43,0x64,0x00,0x0b,0x21,
-0x03,0x88,0xd8,0x60,0x03,0xaa,0xae,0xaa,0x70,0x56,0x00,0xb0,0x1a,0x05,0x60,0x0b,
-0x39,0x90,0x00,0x00,0xb0,0xc4,0x1a,0xa1,0xb9,0x99,0xd1,0x5b,0xd8,0xa5,0x77,0xa1,
-0x83,0x98,0x05,0x00,0xf3,0x3a,0x41,0x22,0x40,0x83,0x98,0x7a,0x99,0xc0,0x83,0x99,
-0x79,0x88,0xc0,0x52,0xa5,0x79,0x77,0xc0,0x02,0x90,0x74,0x11,0xb0,0x02,0x90,0x7a,
-0x99,0xb0,0x03,0x60,0x00,0xc6,0x61,0x5b,0xc8,0x24,0xc5,0x40,0x84,0x68,0x77,0x55,
-0xb0,0x84,0x68,0x79,0x88,0xc0,0x84,0x68,0x74,0x22,0xb0,0x84,0x68,0x77,0x66,0xb0,
-0x54,0x95,0x7b,0xaa,0xb0,0x03,0x60,0x28,0x07,0x30,0x03,0x63,0x90,0x01,0xb1,0xea,
-0x09,0xf2,0x2b,0x99,0x99,0x92,0x5b,0xd8,0x79,0x99,0x80,0x82,0x99,0x90,0x00,0xa0,
-0x82,0x99,0x69,0x99,0x70,0x82,0x99,0x99,0x99,0x91,0x82,0x99,0x80,0xa0,0x81,0x52,
-0xa5,0xc9,0xd9,0xd1,0x01,0x90,0x80,0xa0,0x81,0x01,0x90,0xc9,0x99,0xd1,0x19,0x9e,
-0x99,0xcb,0x95,0x00,0x78,0x77,0x87,0x40,0x00,0xc4,0x44,0x46,0x80,0x05,0x00,0xf2,
-0x09,0x7a,0xc7,0x77,0x40,0x29,0xcd,0xaa,0xad,0xa6,0x2b,0xe9,0xad,0x9d,0xc6,0x02,
-0xa0,0x28,0x08,0x31,0x00,0xa0,0x28,0x4b,0x00,0xc3,0x07,0xf3,0x04,0x50,0x29,0x03,
-0x30,0x00,0x92,0x29,0x0b,0x10,0x00,0x35,0x29,0x27,0x00,0x2a,0xaa,0xbd,0xaa,0xa7,
-0xfa,0x01,0x19,0x29,0x05,0x00,0xf3,0x1c,0x80,0x46,0x08,0x00,0x07,0x48,0x37,0xa6,
-0x80,0x08,0xb4,0x29,0x58,0x70,0x0a,0xa8,0x6b,0x8c,0x74,0x28,0xca,0x9e,0x9c,0xa6,
-0x01,0xb2,0x16,0x76,0x40,0x00,0xdb,0x10,0xcb,0x00,0x06,0x73,0x56,0xe7,0x09,0x1b,
-0x00,0xb6,0x09,0xac,0x05,0x00,0xb1,0x17,0xf0,0x15,0x03,0x33,0x5c,0x33,0x31,0x0c,
-0x77,0x77,0x77,0x73,0x0b,0x19,0x99,0xad,0x20,0x0b,0x01,0x86,0x92,0x00,0x0b,0x69,
-0x9e,0xd9,0x92,0x0b,0x00,0x0c,0x03,0xc0,0x0a,0x00,0x0b,0x07,0x20,0x56,0xd9,0x01,
-0x35,0x71,0x04,0xab,0x05,0x04,0x10,0x06,0xdc,0x21,0xf0,0x01,0x9e,0x99,0x94,0x0b,
-0x11,0x61,0x16,0x10,0x0b,0x79,0xe9,0x9e,0x93,0x0b,0x00,0xb0,0x82,0x20,0xf5,0x3a,
+0xf6,0x02,0x10,0xc0,0x49,0x05,0x03,0x05,0x00,0xf0,0x14,0xfb,0xbb,0xbb,0xc0,0x01,
+0xb0,0x07,0x50,0x00,0x03,0x80,0x01,0xd0,0x00,0x07,0x50,0x00,0x87,0x00,0x0d,0x00,
+0x00,0x0a,0x81,0x25,0x00,0x00,0x00,0x55,0x0b,0xaa,0xaa,0xaa,0xb0,0x0b,0xa3,0x05,
+0xf2,0x14,0x0b,0xaa,0xaa,0xbc,0x70,0x0b,0x27,0xac,0x83,0x00,0x0b,0x12,0x2c,0x69,
+0x40,0x0b,0x5a,0x9d,0x31,0x20,0x0b,0x25,0x7e,0xaa,0x80,0x38,0x65,0x3b,0x00,0x42,
+0x92,0x00,0x0a,0xaa,0xc1,0x22,0x01,0xf0,0x19,0xaa,0xaa,0xad,0x20,0xa1,0x00,0x00,
+0x82,0x0a,0xaa,0xaa,0xaa,0x10,0xb7,0x66,0x66,0x66,0x0c,0x33,0x33,0x33,0xc0,0xb0,
+0xd9,0x9a,0x0b,0x29,0x0a,0x00,0xa0,0xb8,0x30,0xe9,0x96,0x2a,0x50,0x01,0x00,0x8b,
+0x40,0x5b,0x00,0x30,0xc0,0x0b,0x00,0x87,0x01,0xf2,0x12,0xab,0xba,0xac,0x80,0x0b,
+0x04,0x60,0x0b,0x00,0x0b,0x5a,0xea,0xad,0xa0,0x0b,0x00,0xb0,0x19,0x00,0x0b,0x8b,
+0xda,0xbd,0xa3,0x48,0x0a,0x30,0x19,0x00,0x82,0x96,0x00,0x19,0x46,0x01,0x01,0x8d,
+0x00,0x00,0x58,0x03,0xf2,0x15,0xb0,0x0c,0x68,0xa6,0xc6,0x50,0x0b,0x6b,0xd9,0xe9,
+0x90,0x0b,0x02,0x80,0xb0,0x00,0x0b,0x9d,0xbc,0xba,0xa2,0x1a,0x0b,0x03,0x7a,0x40,
+0x66,0x0c,0x58,0x69,0x20,0x70,0x29,0x51,0x01,0x82,0x2d,0x0a,0x43,0xbb,0xce,0xbb,
+0xb2,0xa6,0x05,0x0e,0x05,0x00,0x02,0xbb,0x04,0x40,0x04,0x10,0x00,0x00,0xf6,0x03,
+0x85,0x00,0x5b,0xbe,0xbb,0xbb,0xb0,0x00,0x29,0x84,0x02,0xf0,0x3f,0xca,0xbd,0xcb,
+0x90,0x03,0x90,0x09,0x20,0x00,0x0c,0x20,0x09,0x20,0x00,0x87,0x00,0x09,0x20,0x00,
+0x50,0x9b,0xbe,0xcb,0xb3,0x00,0x13,0x00,0x05,0x00,0x02,0x4c,0x33,0x89,0x30,0x05,
+0x77,0xba,0x77,0x71,0x02,0xaa,0xdc,0xaa,0x70,0x02,0x22,0xc2,0x22,0x21,0x18,0x8d,
+0xa8,0x88,0x84,0x00,0x3e,0xba,0xaa,0x90,0x05,0xc1,0x03,0x80,0x00,0x1a,0x69,0x9a,
+0xc9,0x95,0x00,0x11,0x11,0x11,0x11,0x3b,0xbb,0xbb,0xbe,0x52,0x00,0x30,0x0c,0x00,
+0x06,0x05,0x00,0xa0,0x0b,0x99,0x99,0x9e,0x00,0x0b,0x21,0x11,0x17,0x00,0xff,0x00,
+0x01,0x05,0x00,0xb0,0x82,0x0b,0x10,0x00,0x00,0xb1,0x06,0xcb,0xbb,0xbc,0x80,0x03,
+0x05,0xf0,0x40,0x00,0x03,0x99,0x44,0xb6,0x00,0x02,0x5a,0xdb,0xa3,0x00,0x08,0x58,
+0x60,0x18,0x10,0x6a,0xbe,0xaa,0xaa,0xa1,0x00,0xc3,0x37,0x00,0x00,0x2b,0xea,0xbd,
+0xac,0x50,0x52,0xb0,0x37,0x05,0x50,0x00,0xb0,0x37,0x6b,0x30,0x00,0x00,0x37,0x00,
+0x00,0x00,0x92,0x93,0x79,0x10,0x19,0xea,0xdb,0xcd,0xa6,0x06,0x80,0xc9,0x78,0x86,
+0x0b,0x99,0x99,0x99,0xa4,0x0b,0x00,0x13,0x00,0x37,0x03,0xb9,0xad,0x9a,0x82,0x00,
+0xb0,0x28,0xe5,0x05,0x20,0x28,0x5b,0x8f,0x05,0x00,0x98,0x09,0xf1,0x24,0xa0,0x92,
+0x0a,0xb9,0x9c,0x8b,0x93,0xb3,0x88,0x88,0x66,0x43,0x64,0x00,0x0b,0x21,0x03,0x88,
+0xd8,0x60,0x03,0xaa,0xae,0xaa,0x70,0x56,0x00,0xb0,0x1a,0x05,0x60,0x0b,0x39,0x90,
+0x00,0x00,0xb0,0x10,0x00,0x02,0x90,0xb9,0x99,0xd1,0x5b,0xd8,0xa5,0x77,0xa1,0x83,
+0x98,0x05,0x00,0xf3,0x3a,0x41,0x22,0x40,0x83,0x98,0x7a,0x99,0xc0,0x83,0x99,0x79,
+0x88,0xc0,0x52,0xa5,0x79,0x77,0xc0,0x02,0x90,0x74,0x11,0xb0,0x02,0x90,0x7a,0x99,
+0xb0,0x03,0x60,0x00,0xc6,0x61,0x5b,0xc8,0x24,0xc5,0x40,0x84,0x68,0x77,0x55,0xb0,
+0x84,0x68,0x79,0x88,0xc0,0x84,0x68,0x74,0x22,0xb0,0x84,0x68,0x77,0x66,0xb0,0x54,
+0x95,0x7b,0xaa,0xb0,0x03,0x60,0x28,0x07,0x30,0x03,0x63,0x90,0x01,0xb1,0xea,0x09,
+0xf2,0x2b,0x99,0x99,0x92,0x5b,0xd8,0x79,0x99,0x80,0x82,0x99,0x90,0x00,0xa0,0x82,
+0x99,0x69,0x99,0x70,0x82,0x99,0x99,0x99,0x91,0x82,0x99,0x80,0xa0,0x81,0x52,0xa5,
+0xc9,0xd9,0xd1,0x01,0x90,0x80,0xa0,0x81,0x01,0x90,0xc9,0x99,0xd1,0x19,0x9e,0x99,
+0xcb,0x95,0x00,0x78,0x77,0x87,0x40,0x00,0xc4,0x44,0x46,0x80,0x05,0x00,0xf2,0x09,
+0x7a,0xc7,0x77,0x40,0x29,0xcd,0xaa,0xad,0xa6,0x2b,0xe9,0xad,0x9d,0xc6,0x02,0xa0,
+0x28,0x08,0x31,0x00,0xa0,0x28,0x4b,0x00,0xc3,0x07,0xf3,0x04,0x50,0x29,0x03,0x30,
+0x00,0x92,0x29,0x0b,0x10,0x00,0x35,0x29,0x27,0x00,0x2a,0xaa,0xbd,0xaa,0xa7,0xfa,
+0x01,0x19,0x29,0x05,0x00,0xf4,0x1c,0x80,0x46,0x08,0x00,0x07,0x48,0x37,0xa6,0x80,
+0x08,0xb4,0x29,0x58,0x70,0x0a,0xa8,0x6b,0x8c,0x74,0x28,0xca,0x9e,0x9c,0xa6,0x01,
+0xb2,0x16,0x76,0x40,0x00,0xdb,0x10,0xcb,0x00,0x06,0x73,0x56,0xe7,0x09,0x1b,0x00,
+0xb6,0x09,0xac,0x05,0xf0,0x18,0x12,0x00,0x00,0x03,0x33,0x5c,0x33,0x31,0x0c,0x77,
+0x77,0x77,0x73,0x0b,0x19,0x99,0xad,0x20,0x0b,0x01,0x86,0x92,0x00,0x0b,0x69,0x9e,
+0xd9,0x92,0x0b,0x00,0x0c,0x03,0xc0,0x0a,0x00,0x0b,0x07,0x20,0x56,0xd9,0x01,0x34,
+0x71,0x04,0xab,0x05,0x04,0x00,0xfc,0x01,0xf4,0x50,0x06,0x99,0x9e,0x99,0x94,0x0b,
+0x11,0x61,0x16,0x10,0x0b,0x79,0xe9,0x9e,0x93,0x0b,0x00,0xb0,0x0b,0x00,0x0b,0x00,
 0xa9,0x98,0x00,0x0b,0x59,0x99,0x9a,0x50,0x1b,0x02,0xb2,0x4b,0x10,0x56,0x03,0x7e,
 0xe5,0x10,0x52,0x96,0x30,0x15,0x94,0x00,0x00,0x25,0x00,0x00,0x09,0xaa,0xae,0xaa,
 0xa4,0x0a,0x12,0x31,0x14,0x00,0x0a,0x96,0x78,0x55,0x00,0x0a,0x59,0xa5,0xaa,0xd5,
 0x0a,0xa4,0x4b,0xd5,0xb0,0x0a,0x89,0x99,0x1a,0x90,0x29,0x89,0x99,0x0b,0x40,0x55,
-0x84,0x09,0x59,0xa0,0x71,0x80,0x5b,0x90,0x56,0xf9,0x1e,0x80,0x60,0x5a,0xe1,0xaa,
-0xe6,0x20,0x02,0x90,0xa7,0x0b,0xf0,0x0b,0x20,0x60,0xb1,0x10,0x1c,0xb7,0xa0,0xb8,
-0x81,0x02,0x65,0xa0,0xb0,0x00,0x0b,0xa1,0xa0,0xb0,0x00,0x07,0xc0,0x8a,0xba,0xa2,
-0x09,0xd7,0x3e,0x22,0x51,0x07,0xbb,0xbb,0xb2,0x10,0x16,0x13,0xf3,0x1b,0xe3,0x9b,
-0xb9,0x40,0x01,0x93,0x38,0x75,0xa0,0x07,0x35,0x69,0x97,0xb1,0x09,0xd4,0x9b,0xb9,
-0x60,0x02,0xa2,0x7a,0xa7,0x50,0x08,0xa1,0x27,0x72,0x10,0x08,0x78,0x9b,0xb9,0x90,
-0x0a,0xc4,0x04,0x40,0x00,0x56,0x18,0xba,0x83,0x18,0x70,0x09,0xbe,0xbb,0xcd,0xb4,
-0x00,0x0b,0xc8,0x08,0x05,0x05,0x00,0x90,0x2b,0xbe,0xbb,0xcd,0xb7,0x00,0x1b,0x00,
-0x47,0x36,0x07,0xb5,0x47,0x00,0x02,0xd0,0x00,0x47,0x00,0x0b,0x20,0x00,0x47,0xb9,
-0x1d,0x71,0xa4,0x80,0x2b,0xbb,0xbc,0xeb,0xc7,0x7b,0x10,0x90,0x01,0x11,0x10,0xc0,
-0x00,0x08,0xae,0xa5,0xb0,0x96,0x02,0x10,0x83,0x05,0x00,0xf0,0x00,0x48,0x04,0x02,
-0x6e,0xb8,0x0c,0x0a,0x09,0x52,0x00,0x04,0xd7,0x7b,0xbb,0xa0,0x74,0x1f,0xf2,0x0e,
-0x0b,0x4b,0xbb,0xa0,0x0b,0x83,0x00,0x00,0x0b,0xca,0xaa,0x70,0x0b,0x00,0x03,0x90,
-0x0b,0x00,0x03,0x80,0x0b,0x00,0x06,0x60,0x0b,0x05,0xbc,0x10,0x0b,0x71,0x04,0x31,
-0xb8,0xaa,0xe0,0x7f,0x0c,0x60,0x0d,0xaa,0x78,0xba,0xa0,0x0b,0xa8,0x03,0xf3,0x0a,
-0x09,0xaa,0xc6,0xaa,0xd1,0x09,0x92,0xb5,0xa4,0xa0,0x00,0x4a,0xa0,0x2a,0xe0,0x1b,
-0x75,0x88,0x92,0xb0,0x00,0x8b,0x30,0x69,0x90,0x6a,0x07,0xf2,0x20,0x02,0x30,0x00,
-0x3a,0xaa,0x0a,0x15,0x10,0x00,0x0a,0x79,0x58,0xb0,0x1b,0xaa,0x66,0xb3,0x62,0x37,
-0x00,0x79,0xe9,0x90,0x5b,0x86,0xa0,0xb0,0xb0,0x02,0x2b,0xb9,0xe9,0xe0,0x00,0x0a,
-0x00,0xb1,0x50,0x00,0x28,0x01,0xb3,0xd1,0x07,0xb5,0xcb,0xa9,0xe7,0x1f,0xf0,0x15,
-0x6a,0xe3,0xbc,0x6a,0xd0,0x00,0xa3,0xbb,0x69,0xc0,0x6a,0xb0,0x88,0x88,0x70,0x72,
-0x00,0xb3,0xc3,0xb0,0x8b,0xa0,0xc6,0xc6,0xc0,0x00,0xa0,0xb9,0xd9,0x90,0x00,0xa5,
-0x88,0xd8,0x83,0x00,0x52,0x1e,0x37,0x3b,0x80,0x00,0x6f,0x0b,0xf8,0x1d,0x40,0x3c,
-0xdb,0xe8,0x08,0x80,0x03,0x70,0xb0,0xb6,0x00,0x03,0x70,0xb0,0x00,0x52,0x5c,0xda,
-0xea,0x07,0x90,0x04,0x60,0xb0,0xa7,0x00,0x06,0x50,0xb0,0x10,0x45,0x08,0x30,0xb0,
-0x02,0xc0,0x0c,0x00,0xb0,0x5c,0x10,0x55,0x00,0xb5,0x6b,0x23,0xf2,0x1c,0x0c,0x88,
-0x99,0x04,0xa0,0x0c,0x77,0x89,0x7a,0x00,0x09,0x89,0x86,0x40,0x31,0x39,0xad,0x98,
-0x05,0xa0,0x07,0x88,0x84,0x99,0x00,0x0b,0x00,0x37,0x20,0x22,0x08,0x9d,0x93,0x01,
-0xc1,0x0b,0x1a,0x82,0x2b,0x30,0x23,0x87,0x05,0x51,0x03,0x00,0x77,0x10,0xf0,0x0f,
-0xb0,0x00,0x2b,0x30,0xaa,0xea,0xa2,0x00,0xa5,0x22,0xc2,0x22,0x08,0xb4,0x66,0x6a,
-0x95,0x57,0xb4,0x88,0x8b,0xb5,0x00,0xb0,0x52,0x17,0x61,0x00,0xb0,0x59,0xf5,0x20,
-0x20,0x09,0x06,0xc8,0x19,0x21,0x8c,0x20,0x7e,0x26,0x60,0x01,0xc1,0xca,0xaa,0xc0,
-0x2c,0xf9,0x17,0x60,0x01,0x84,0xc9,0x99,0xc0,0x04,0x1a,0x1f,0xf3,0x0a,0x3c,0xb0,
-0xca,0xda,0x80,0x11,0xb0,0xb0,0x91,0xa1,0x00,0xb0,0xb0,0x4c,0x20,0x00,0xb0,0xb3,
-0x4a,0x60,0x00,0xb0,0xd8,0x30,0x77,0x64,0x00,0xf0,0x1e,0x08,0x40,0x00,0x0a,0x30,
-0x86,0x19,0x30,0x02,0x86,0x9c,0x83,0x40,0x05,0xb3,0xdc,0x99,0xc2,0x3a,0xb1,0x2c,
-0x10,0x16,0x00,0xb1,0xbc,0x9b,0xa0,0x00,0xb7,0x4a,0x5c,0x10,0x00,0xb0,0x28,0xea,
-0x20,0x00,0xb8,0x93,0x04,0xa8,0x00,0x41,0x9d,0x07,0xf1,0x0e,0xa2,0xaa,0xaa,0xa6,
-0x3a,0x22,0x72,0x91,0xa0,0x00,0xb4,0x94,0x76,0x50,0x09,0xb1,0xa2,0x94,0x80,0x57,
-0xa0,0x54,0x73,0x82,0x00,0xa1,0xaa,0xaa,0xa3,0x31,0x01,0x02,0x05,0x00,0x41,0xa8,
-0xaa,0xea,0xa8,0x9e,0x01,0xf1,0x50,0x01,0xb1,0x39,0x07,0x40,0x1b,0x30,0x87,0x0c,
-0x20,0x11,0x95,0xa8,0x99,0xb2,0x07,0xb7,0x10,0xb0,0x16,0x59,0xa0,0x70,0xa0,0x00,
-0x00,0xa0,0xc0,0xaa,0xa2,0x00,0xa0,0xf2,0xa0,0x00,0x00,0xa7,0x6b,0xc0,0x00,0x00,
-0xb8,0x03,0x9a,0xa6,0x00,0x51,0x33,0x00,0x00,0x04,0x90,0xba,0x99,0x96,0x3a,0x26,
-0xb4,0x44,0x40,0x00,0xc7,0xb5,0x55,0xc0,0x09,0xb0,0xa7,0x77,0xd0,0x57,0xa0,0x8a,
-0x88,0xb0,0x00,0xa0,0x3e,0x88,0x70,0x00,0xa4,0xab,0x18,0x70,0x00,0xa1,0x17,0xfc,
-0x10,0x00,0xa7,0xb7,0x14,0x98,0x95,0x14,0x60,0x09,0x46,0x99,0xc9,0x30,0x67,0xef,
-0x18,0xf8,0x12,0x13,0x8b,0x99,0xe9,0x92,0x1e,0x2b,0x25,0xc5,0x30,0x9b,0x1b,0x76,
-0x44,0xb0,0x09,0x1b,0x7a,0x88,0xb0,0x09,0x1b,0x79,0x77,0xb0,0x09,0x39,0x79,0x88,
-0xb0,0x09,0x46,0x74,0x4b,0x21,0xf7,0x1e,0x09,0x44,0x84,0x19,0x00,0x85,0x38,0x88,
-0x4a,0x42,0x06,0x6b,0xbb,0x87,0xb4,0x2e,0x16,0x66,0xe4,0xa0,0xbc,0x14,0x44,0x68,
-0xb0,0x0a,0x0b,0x9a,0x0b,0x70,0x0a,0x09,0x0b,0x4b,0x30,0x0a,0x19,0x1a,0x6a,0xa0,
-0x0a,0x53,0x03,0x90,0x56,0xcd,0x01,0xf0,0x20,0xa3,0x33,0xc3,0x32,0x0a,0x42,0x55,
-0xc5,0x53,0x23,0x74,0xdb,0x9c,0xa5,0x02,0xc0,0xa8,0x39,0x55,0x2c,0xb0,0x55,0x55,
-0x52,0x22,0xb5,0x99,0xb9,0x97,0x00,0xb0,0x23,0xa0,0x40,0x00,0xb7,0x49,0x22,0x75,
-0x00,0xb7,0x0b,0x9a,0x26,0x00,0x03,0x30,0x9b,0x01,0x10,0xa6,0xa7,0x02,0x90,0x09,
-0x50,0x00,0x03,0x0b,0x00,0x02,0x40,0x0b,0xd6,0x12,0x00,0xe0,0x12,0xe4,0x93,0x38,
-0x0b,0x00,0x06,0x57,0x23,0x0b,0x00,0x0b,0x01,0x00,0x0b,0xbb,0x9c,0x1c,0x20,0x08,
-0x50,0xde,0x19,0xf2,0x16,0x8a,0x0b,0x30,0x00,0x07,0x02,0x58,0x00,0x09,0x1c,0x02,
-0xc5,0x20,0x0c,0x0c,0x2c,0x22,0xb0,0x48,0x0d,0xb1,0x00,0x93,0x31,0x5e,0x10,0x05,
-0x25,0x2b,0x8c,0x00,0x0b,0x00,0x22,0x09,0xcb,0xc7,0x6d,0x01,0xf0,0x09,0x04,0xc4,
-0xab,0xeb,0xb0,0x18,0xaa,0x00,0xb0,0xb0,0x45,0xa2,0x00,0xb0,0xb0,0x11,0xa5,0xbb,
-0xfb,0xd9,0x00,0xa0,0x06,0xd5,0x8d,0x07,0x40,0x1c,0x00,0x00,0xa0,0x54,0x02,0x47,
-0xa8,0x70,0x00,0x5a,0xc3,0x00,0xf0,0x0a,0x4b,0x11,0x11,0x10,0x02,0xc9,0xe9,0xe9,
-0xd0,0x0b,0x18,0x53,0x90,0xb0,0x01,0x96,0x2b,0x10,0xb0,0x00,0x20,0xb1,0x6b,0x60,
-0x00,0xdd,0x03,0xf3,0x00,0x09,0x39,0x0b,0x10,0xa0,0x0a,0x19,0x02,0x18,0x74,0x13,
-0x0c,0xaa,0xb8,0x12,0x2d,0x01,0xf0,0x05,0x50,0x80,0x00,0x03,0xc8,0x45,0x9d,0x10,
-0x03,0x65,0x54,0x34,0x60,0x00,0xe9,0x99,0x9e,0x00,0x00,0xd9,0x05,0x00,0xf2,0x04,
-0x01,0xa1,0x00,0x00,0x04,0x23,0x5c,0x02,0x30,0x0c,0x37,0x03,0x15,0xb0,0x27,0x1c,
-0xba,0xb5,0x52,0xfe,0x17,0xf0,0x01,0x2f,0x99,0x92,0x00,0x02,0xb1,0x01,0xc0,0x00,
-0x0a,0x9a,0xaa,0xaa,0x90,0x00,0x57,0x25,0x0a,0xf7,0x36,0x11,0x11,0x13,0x90,0x00,
-0x99,0xba,0x99,0x60,0x01,0x24,0x4a,0x00,0x70,0x09,0x59,0x06,0x46,0x57,0x07,0x0c,
-0xaa,0xab,0x06,0x02,0x90,0x0a,0x00,0x00,0x06,0xb6,0xae,0xaa,0xa7,0x1a,0x99,0x19,
-0x07,0x00,0x47,0x93,0x56,0x69,0x15,0x13,0x90,0x93,0x79,0x63,0x02,0x91,0xb4,0x4c,
-0x70,0x02,0x9a,0x30,0x7c,0x20,0x02,0x94,0x03,0xb1,0xb1,0x02,0x90,0x3a,0x10,0x38,
-0x40,0x2b,0x33,0x66,0xb8,0x66,0x41,0x26,0x83,0xe8,0x88,0x8e,0x00,0x00,0xd7,0x77,
-0x7d,0x0a,0x00,0xf0,0x2b,0x11,0x93,0x11,0x00,0x05,0x34,0x1b,0x03,0x80,0x1b,0x56,
-0x04,0x17,0xb1,0x34,0x2c,0xba,0xb5,0x31,0x0a,0x05,0x68,0xb6,0x60,0x4b,0x84,0x8a,
-0xc8,0x70,0x8a,0x44,0x36,0x93,0x31,0x8a,0x05,0x55,0x55,0x52,0x1a,0x05,0xb9,0x99,
-0xa0,0x0a,0x05,0xa8,0x88,0xa0,0x0a,0x05,0xb8,0x89,0xa0,0x0a,0x05,0x50,0x00,0x05,
-0x00,0x21,0x2a,0x70,0x18,0x06,0xb0,0x06,0x99,0xad,0x99,0x90,0x00,0x0b,0x00,0x75,
-0x00,0x09,0xf7,0x17,0x70,0x00,0xc8,0x88,0x8b,0x40,0x00,0xd7,0x42,0x1d,0x01,0x0a,
-0x00,0xe2,0x12,0x77,0x01,0x20,0x08,0x4b,0x06,0x33,0xb0,0x07,0x09,0x99,0xb3,0x32,
-0x16,0x06,0xf2,0x1d,0x99,0x99,0xdc,0xb4,0x0b,0x24,0x43,0xb0,0x40,0x0b,0x36,0x64,
-0xb3,0x80,0x0b,0x6a,0x98,0x7c,0x10,0x2a,0x77,0x68,0x9b,0x16,0x64,0x12,0x45,0x55,
-0xb3,0x02,0x34,0x48,0x01,0x30,0x0c,0x57,0x07,0x17,0xb0,0x34,0x2c,0x99,0x97,0x31,
-0x4c,0x1a,0xf4,0x4a,0x84,0x35,0x76,0x50,0x3b,0x88,0xa7,0x70,0x51,0x0a,0x77,0x92,
-0x99,0x80,0x0c,0x77,0xb5,0x55,0x80,0x0c,0x66,0xb5,0xa4,0x21,0x0a,0x07,0x93,0xb9,
-0xb1,0x03,0x01,0x66,0x00,0x60,0x2a,0x46,0x07,0x32,0xb0,0x42,0x2c,0x99,0xb2,0x42,
-0x01,0x90,0xb7,0x77,0xd0,0x04,0xb4,0xb6,0x66,0xd0,0x17,0x99,0x67,0x77,0x80,0x45,
-0x95,0xac,0x8c,0x97,0x12,0x94,0xac,0x7b,0x97,0x01,0x94,0x99,0x99,0x91,0x01,0x90,
-0x49,0x07,0x90,0x01,0x90,0x09,0xec,0x10,0x01,0x98,0xa6,0x25,0xb8,0x2f,0x24,0xf5,
-0x20,0x00,0x00,0x08,0x99,0x9e,0xa9,0x94,0x0a,0x08,0x29,0x26,0x00,0x0a,0x5a,0x9b,
-0x7d,0x71,0x0c,0xac,0xaa,0x6c,0x60,0x0a,0x0a,0x4a,0x7c,0x60,0x0a,0x08,0x3b,0x88,
-0x72,0x19,0x01,0x27,0xa2,0x20,0x55,0x65,0xb0,0x34,0xb0,0x81,0x80,0x99,0x99,0x43,
-0x24,0x02,0xf4,0x4c,0x10,0x09,0x77,0x96,0xaa,0x60,0x09,0x66,0x91,0x93,0x50,0x09,
-0x99,0x94,0xb6,0x30,0x2c,0x99,0xc7,0x8a,0x73,0x07,0x47,0x66,0x49,0x90,0x26,0xa3,
-0x55,0x77,0x13,0x01,0x02,0x7a,0x02,0x10,0x0b,0x2a,0x07,0x23,0xb0,0x35,0x0b,0x99,
-0xb2,0x44,0x00,0x00,0x07,0x48,0x50,0x08,0xbb,0xbd,0xcb,0xd4,0x0c,0x00,0x05,0x60,
-0x20,0x0c,0xaa,0x83,0x74,0x90,0x0c,0x00,0xb1,0xab,0x20,0x0b,0x00,0xa0,0xc8,0x00,
-0x0b,0x5a,0x72,0xe4,0x26,0x48,0x01,0x2c,0x3a,0x45,0x82,0x00,0x92,0x07,0xc1,0xeb,
-0x0b,0x80,0x85,0x80,0x0b,0xbb,0xbc,0xdb,0xc6,0x00,0x53,0x15,0xd0,0x07,0xba,0xd0,
-0xc0,0xc0,0x07,0x20,0xb0,0xc6,0x80,0x06,0xaa,0xc0,0xdc,0x0c,0xd2,0x41,0xb8,0x06,
-0x0a,0xcb,0x8b,0x7c,0x0a,0x03,0x00,0x85,0x05,0xd6,0x8d,0x11,0xf8,0x1d,0x4b,0x31,
-0xc4,0x60,0x04,0x5c,0x41,0xc0,0x61,0x2a,0xbb,0xaa,0xea,0xa6,0x03,0xa9,0x41,0xc0,
-0x70,0x0d,0x8a,0x73,0xa2,0xa0,0x19,0x9b,0x93,0x7c,0x30,0x06,0x9b,0x83,0x5b,0x05,
-0x06,0xac,0xa6,0xbc,0x0a,0x06,0x20,0x0b,0x24,0xc6,0xef,0x20,0xf6,0x21,0xd8,0x70,
-0xa7,0x20,0x09,0x8d,0x89,0x2a,0x06,0x00,0xa6,0xc7,0x88,0xea,0x80,0x0a,0x09,0x75,
-0x3b,0x05,0x00,0xa7,0x77,0x70,0xb5,0x50,0x09,0x96,0x68,0x09,0xb0,0x01,0x88,0x78,
-0x70,0x87,0x30,0x54,0x26,0x92,0x5b,0xa8,0x05,0x39,0x98,0x89,0x08,0x90,0x8d,0x0c,
-0x81,0x00,0x05,0x8a,0xaa,0x61,0x00,0xc2,0x00,0xcc,0x0d,0x30,0xa9,0x00,0xc0,0x3c,
-0x0b,0x00,0x75,0x53,0x90,0xda,0xaa,0xaa,0xb0,0x56,0x00,0x00,0x01,0x0b,0x4c,0x10,
-0x14,0x50,0x32,0x01,0x60,0x07,0x9b,0x92,0x8b,0xa2,0x0c,0x8d,0x0e,0x30,0x0e,0xaa,
-0x96,0xf8,0x15,0xf3,0x0c,0xa6,0xcb,0xd5,0x0e,0xab,0xa7,0x41,0x90,0x0a,0x00,0x08,
-0x21,0x90,0x29,0x00,0x0b,0x11,0x90,0x66,0x00,0x1b,0x01,0x90,0x81,0x00,0x73,0x01,
-0x65,0x00,0x00,0xba,0x17,0x40,0x07,0xaa,0xeb,0xaa,0x52,0x1e,0x40,0x01,0xb0,0x0b,
-0x88,0x83,0x19,0xf5,0x0d,0x33,0x33,0x33,0x20,0x0b,0x89,0xe2,0xa9,0xe0,0x0b,0x64,
-0xa0,0x83,0xa0,0x0a,0x07,0xd0,0x08,0xd0,0x46,0x97,0xb2,0xb5,0xb0,0x81,0x06,0xb0,
-0x07,0xc0,0x04,0x71,0x14,0x20,0x05,0xaa,0xbd,0x96,0x20,0xf8,0x08,0x5a,0x06,0xbb,
-0xbe,0xbb,0xb1,0x52,0x2a,0x17,0xb8,0x16,0x09,0x20,0x1b,0xc6,0x99,0x0b,0xa0,0x56,
-0x66,0x63,0x49,0xd9,0x21,0x1c,0x10,0x12,0xb1,0xd8,0x17,0x00,0xd4,0x28,0x74,0x16,
-0xeb,0x10,0x0c,0x00,0x57,0xb0,0x0f,0x00,0x01,0x05,0x00,0x44,0x1b,0x80,0x09,0xb9,
-0xc9,0x11,0xf1,0x1b,0x0b,0x18,0x00,0x49,0xd8,0x0a,0x14,0x60,0x02,0xb1,0xbe,0xc9,
-0x71,0x00,0xb0,0x06,0x51,0x60,0x16,0xeb,0x04,0x89,0x30,0x47,0xb0,0x01,0xd9,0x00,
-0x00,0xb0,0x02,0xf2,0x13,0x00,0xb0,0x5b,0x6a,0x57,0x1a,0x80,0x70,0x07,0x46,0x21,
-0x02,0xcb,0x0f,0xa0,0x18,0xe7,0x7a,0xba,0xa5,0x01,0xc1,0x03,0x00,0x50,0xec,0x1b,
-0x90,0xb0,0x18,0xe8,0x0b,0x03,0x80,0x13,0xb0,0x09,0x38,0x2b,0xa5,0x06,0x3a,0x00,
-0x00,0xb2,0x99,0x9d,0x97,0x09,0x90,0x41,0x1b,0xf0,0x11,0xb0,0xab,0xbb,0xb2,0x38,
-0xd8,0xa1,0x00,0x00,0x12,0xc2,0xab,0xbb,0x90,0x00,0xb0,0xa1,0x00,0xa0,0x16,0xeb,
-0xa1,0x00,0xa0,0x36,0xb0,0xab,0xaa,0xa0,0x00,0xb0,0xa1,0x23,0x00,0xf0,0x1a,0xa3,
-0x11,0x10,0x1a,0x80,0x69,0x99,0x94,0x00,0xb0,0x00,0xc3,0x00,0x02,0xc2,0x06,0x8a,
-0x00,0x17,0xd7,0x5a,0x02,0xb1,0x00,0xb1,0xaa,0xaa,0x77,0x02,0xda,0x01,0x11,0x00,
-0x39,0xd1,0x6b,0x99,0xc0,0x00,0xb0,0x65,0x37,0x08,0x63,0x6b,0x99,0xc0,0x0a,0x90,
-0x65,0xe7,0x05,0xf4,0x1d,0x07,0x30,0x11,0xb1,0x10,0x7c,0xa2,0x66,0xd6,0x50,0x18,
-0x43,0x55,0xc5,0x51,0x07,0x43,0x55,0x5c,0x51,0x6d,0xb6,0x88,0x8d,0x92,0x48,0x30,
-0x62,0x1b,0x20,0x07,0x30,0x57,0x0a,0x00,0x07,0x30,0x08,0x0a,0x00,0x5c,0x10,0x00,
-0xac,0xf5,0x00,0xf0,0x18,0x73,0x25,0x40,0x38,0xe8,0x79,0x52,0x22,0x01,0xc1,0x68,
-0x44,0x95,0x00,0xb0,0x16,0x77,0x50,0x16,0xeb,0x4a,0xaa,0xa0,0x35,0xb0,0x74,0x11,
-0xb0,0x00,0xb0,0x79,0x77,0xd0,0x00,0xb0,0x7a,0x88,0xd0,0x0a,0x2d,0x0b,0x03,0x32,
-0x00,0xf3,0x1c,0x11,0xa3,0x11,0x39,0xe7,0xc5,0x85,0x5b,0x01,0xb1,0x92,0xa0,0x09,
-0x00,0xb2,0xac,0xca,0xa9,0x02,0xeb,0x0c,0x02,0xa0,0x4a,0xc0,0x69,0x07,0x50,0x00,
-0xb0,0x08,0xbc,0x00,0x00,0xb0,0x04,0xcb,0x80,0x0a,0x80,0xb8,0x00,0x78,0xe5,0x14,
-0xd0,0xba,0xaa,0xa5,0x29,0xd6,0xb4,0x77,0x71,0x02,0xb1,0xb1,0x33,0x30,0x0f,0x00,
-0xf6,0x0b,0xa6,0x06,0xe8,0xb5,0x47,0x22,0x38,0xa0,0xb5,0x48,0xa1,0x01,0xa0,0xb5,
-0x45,0x50,0x01,0xa3,0x85,0x75,0xb2,0x0a,0x85,0x48,0x81,0x26,0xc5,0x02,0xf2,0x1e,
-0x08,0x25,0x99,0xe9,0x91,0x5b,0x82,0x44,0xc4,0x30,0x3a,0x61,0x55,0xc5,0xb0,0x08,
-0x37,0x99,0xe9,0xe4,0x4c,0xc3,0x66,0xd6,0xb0,0x49,0x21,0x82,0xb2,0x10,0x08,0x25,
-0x90,0xd9,0x70,0x08,0x2a,0xa4,0xa0,0x00,0x5c,0x47,0x08,0xaa,0xa3,0x32,0x00,0xf0,
-0x1c,0x20,0x99,0x99,0xa0,0x4a,0x71,0x68,0x88,0xa0,0x3a,0x62,0x99,0x99,0xa0,0x08,
-0x35,0x77,0x77,0x72,0x5c,0xbd,0x21,0xb1,0x65,0x49,0x24,0xc9,0xd9,0xb1,0x08,0x20,
-0xa0,0xa0,0xa0,0x08,0x20,0xa0,0xa7,0x90,0x5c,0x10,0x00,0xa0,0xbd,0x01,0xf0,0x11,
-0x98,0x00,0x19,0xe7,0x59,0xa8,0x94,0x01,0xc1,0x00,0xa8,0x00,0x00,0xb0,0x5a,0xa8,
-0xa3,0x16,0xea,0x00,0xa8,0x00,0x14,0xb0,0x8b,0xa8,0xa5,0x00,0xb0,0x00,0xa8,0x10,
-0x05,0x00,0x53,0x00,0x09,0x90,0x00,0xa8,0x91,0x00,0xf2,0x4a,0x23,0x77,0x88,0x60,
-0x7c,0xa6,0x24,0x40,0x91,0x18,0x32,0x81,0x81,0xa0,0x08,0x20,0x70,0x67,0x20,0x7d,
-0x97,0xaa,0xea,0xa2,0x28,0x20,0x0b,0xe7,0x00,0x08,0x20,0xa4,0xaa,0x30,0x08,0x3b,
-0x60,0xa1,0xc3,0x5c,0x12,0x00,0xa0,0x01,0x09,0x10,0x15,0x71,0x10,0x2a,0x43,0xb9,
-0x8b,0x90,0x5c,0x70,0x35,0x1a,0x00,0x09,0x17,0xac,0xba,0xa2,0x0a,0xb0,0x0b,0x10,
-0x00,0x9d,0x28,0xcb,0x9e,0x93,0x09,0x10,0xd3,0x2a,0x00,0x09,0x10,0x1b,0xf8,0x00,
-0x5b,0x09,0xa6,0x06,0xa0,0x5f,0x00,0xf0,0x0d,0x21,0x23,0xb2,0x20,0x7d,0xba,0x64,
-0x44,0xb0,0x08,0x25,0x5a,0x1a,0x50,0x08,0x23,0xb1,0x02,0x80,0x3c,0xb2,0x99,0x99,
-0x40,0x7a,0x20,0x11,0xc1,0xcf,0x14,0x12,0xb0,0x05,0x00,0xf0,0x02,0x6c,0x09,0xaa,
-0xea,0xa1,0x08,0x30,0x72,0x91,0x00,0x7c,0xa3,0xda,0xdb,0xa3,0x18,0x49,0xa2,0x38,
-0xc0,0x49,0xda,0xea,0xa1,0x3b,0xc3,0xa0,0xb0,0x00,0x6a,0x30,0xda,0x1e,0x00,0xf0,
-0x22,0xa0,0xb0,0x00,0x08,0x30,0xda,0xea,0xa5,0x5c,0x10,0xa0,0x00,0x00,0x08,0x10,
-0x0a,0x0b,0x00,0x7d,0xa6,0x8d,0x7d,0x72,0x19,0x30,0x0a,0x0b,0x00,0x08,0x21,0xaf,
-0xaf,0x90,0x5d,0xb3,0xa0,0x90,0xb0,0x4a,0x11,0xea,0xda,0xd0,0x08,0x11,0xa0,0x90,
-0xb0,0x08,0x0a,0x00,0x21,0x6c,0x01,0xcc,0x08,0x01,0x8c,0x00,0xf7,0x1c,0xd8,0x88,
-0xb0,0x7c,0xa3,0xc7,0x77,0xb0,0x19,0x31,0xd8,0x88,0xb0,0x08,0x20,0x22,0x22,0x10,
-0x1b,0xc7,0x99,0xe9,0x92,0x9c,0x20,0x90,0xb0,0x00,0x08,0x23,0xc0,0xd8,0x60,0x08,
-0x29,0x96,0xb0,0x00,0x5c,0x38,0x06,0xaa,0xa4,0x62,0x08,0xf3,0x1d,0x11,0x98,0xd4,
-0x00,0x5d,0xa3,0x33,0xc3,0x30,0x19,0x34,0x66,0xd6,0x60,0x09,0x22,0x96,0xa5,0x60,
-0x5d,0xb7,0x60,0xa1,0x90,0x3a,0x15,0xc8,0xa7,0xb0,0x09,0x15,0x60,0xa0,0x80,0x09,
-0x15,0xc9,0xe9,0xb0,0x3c,0x05,0x60,0x00,0x80,0x4e,0x02,0xf3,0x1b,0x6a,0x88,0xd0,
-0x16,0xd4,0x69,0x77,0xd0,0x13,0xc2,0x6a,0x88,0xd0,0x00,0xb0,0x55,0x55,0x53,0x16,
-0xe9,0x6c,0x55,0x53,0x36,0xb0,0xcb,0xbc,0xb5,0x00,0xb5,0x4a,0x29,0x64,0x00,0xb0,
-0x85,0x83,0x72,0x0a,0x92,0x53,0x78,0xe4,0x02,0xf4,0x1d,0x20,0x1c,0x53,0x00,0x3a,
-0x60,0x93,0x85,0x00,0x3a,0x66,0xd9,0x99,0xc0,0x07,0x20,0x97,0x35,0x90,0x0a,0xc0,
-0xa8,0x09,0xa0,0x7c,0x30,0x91,0xa0,0xa0,0x07,0x27,0x9b,0xf9,0x94,0x07,0x20,0x1b,
-0x39,0x00,0x4c,0x19,0x92,0x03,0x94,0xb9,0x0b,0xf7,0x20,0x24,0x30,0x08,0x25,0xaa,
-0x85,0x50,0x5b,0x82,0xa4,0x58,0x30,0x4a,0x76,0xca,0xad,0x90,0x08,0x23,0x6a,0x44,
-0x41,0x09,0xa7,0xa8,0x55,0x51,0x9c,0x40,0xbc,0x9b,0x60,0x08,0x20,0xbb,0x3c,0x10,
-0x08,0x29,0x44,0xf9,0x00,0x5c,0x66,0x88,0x26,0xb2,0x85,0x02,0xf7,0x4a,0x20,0x08,
-0xb6,0x60,0x7c,0xa8,0x85,0x59,0x50,0x19,0x40,0x76,0xd6,0x00,0x08,0x36,0xda,0x10,
-0x00,0x4c,0xc3,0xba,0xd9,0x80,0x6a,0x24,0x61,0xb1,0x10,0x08,0x27,0x98,0xd8,0x93,
-0x08,0x21,0x90,0xb0,0xb0,0x5c,0x11,0x99,0x99,0xd0,0x08,0x11,0x2b,0x2c,0x20,0x08,
-0x15,0x7d,0x7d,0x70,0x6c,0x93,0x98,0x69,0x60,0x08,0x12,0xd8,0x89,0x90,0x2b,0xb5,
-0xc6,0x68,0x90,0x6b,0x20,0x23,0x92,0x10,0x08,0x19,0x9d,0xea,0x91,0x08,0x10,0x3a,
-0x29,0x00,0x6c,0x1a,0x91,0x04,0xb1,0x36,0x01,0xf7,0x1d,0x05,0x9b,0x88,0x00,0x6d,
-0x85,0xb4,0x3a,0x80,0x1a,0x3a,0xb3,0x4b,0xa0,0x09,0x36,0x59,0x9b,0x40,0x3c,0xb6,
-0x9b,0x78,0x50,0x6b,0x0b,0x01,0x77,0x40,0x09,0x08,0x99,0x97,0x40,0x09,0x00,0x27,
-0x6d,0x00,0x5b,0x04,0xb6,0xa6,0x60,0x9b,0x00,0xf3,0x48,0x24,0xa7,0xc5,0x30,0x5b,
-0x81,0xa1,0xa8,0x20,0x4a,0x78,0xab,0xec,0x92,0x08,0x30,0x58,0xba,0x10,0x4c,0xcb,
-0x81,0x82,0xb3,0x5a,0x22,0xc7,0xd7,0xb0,0x08,0x21,0xd8,0xd8,0xa0,0x08,0x21,0x90,
-0xa0,0xa0,0x5c,0x11,0xc8,0x88,0xa0,0x08,0x25,0xac,0x8c,0xd0,0x6c,0xa6,0x9c,0x9b,
-0xc0,0x19,0x42,0x77,0xd7,0x50,0x08,0x30,0x34,0xd3,0x20,0x4c,0xc7,0xba,0x9c,0x91,
-0x5a,0x23,0x9a,0x6c,0x50,0x08,0x21,0x34,0xd3,0x30,0x08,0x27,0x9a,0xe9,0x92,0x5c,
-0x10,0x01,0x99,0x14,0xf0,0x1c,0x49,0xd9,0x69,0x8d,0x00,0x3b,0xd9,0xb9,0x06,0xa2,
-0x27,0xb6,0x49,0x9b,0x40,0x69,0xc8,0x84,0xcb,0x20,0x2b,0xbb,0xbb,0x78,0x71,0x05,
-0x55,0xb6,0x44,0x10,0x05,0x55,0xb7,0x55,0x20,0x68,0x88,0xc9,0x88,0x82,0x00,0x08,
-0xc1,0x04,0x24,0xf2,0x1c,0xb8,0x8c,0x00,0x5c,0x80,0xb7,0x7c,0x00,0x1a,0x36,0x97,
-0x69,0x70,0x09,0x19,0x09,0x90,0x90,0x0b,0xdb,0x8b,0xa8,0xc0,0x4b,0x19,0xac,0xca,
-0xa1,0x09,0x10,0x4e,0xe5,0x00,0x09,0x15,0xb5,0x6a,0x50,0x3b,0x38,0x04,0x60,0x71,
-0x6a,0x11,0xf6,0x1e,0x00,0x08,0xa8,0x80,0x6d,0x79,0x9d,0x99,0xb3,0x1b,0x1a,0x5d,
-0x87,0x60,0x0a,0x0a,0x06,0x88,0xa0,0x3c,0xaa,0x69,0xa8,0x81,0x6c,0x0a,0x59,0x71,
-0x90,0x0a,0x0a,0x47,0xcb,0x50,0x0a,0x37,0x58,0x94,0xa1,0x5b,0x62,0x75,0xa1,0x04,
-0x00,0x2c,0x22,0xf7,0x1d,0x22,0x35,0xa3,0x30,0x2a,0x68,0xa4,0x64,0xa0,0x3a,0x72,
-0xab,0x8a,0x90,0x07,0x26,0x79,0x0b,0x20,0x3b,0xb4,0xb8,0x86,0x90,0x39,0x25,0x99,
-0x99,0x70,0x07,0x20,0x60,0xa5,0x00,0x07,0x24,0x90,0xa3,0x70,0x2b,0x16,0x09,0x80,
-0x60,0x63,0x01,0xf7,0x1d,0x0a,0x76,0x99,0xe2,0x4b,0x5b,0x13,0x79,0x50,0x3b,0x4a,
-0x98,0x08,0x60,0x09,0x0a,0x04,0xbb,0xc4,0x4c,0xbb,0xd4,0x2a,0x52,0x2a,0x5a,0xd7,
-0x8b,0xa3,0x09,0x03,0x92,0x8a,0x00,0x09,0x0a,0x9a,0xbb,0x00,0x5b,0x55,0x0a,0x2b,
-0x95,0x37,0x00,0xf3,0x1d,0x12,0x46,0xb4,0x42,0x4b,0x69,0x3a,0x29,0x21,0x4b,0x79,
-0x5d,0x8d,0x70,0x09,0x19,0x8b,0xaa,0x85,0x3c,0xca,0x67,0xc7,0x80,0x7b,0x19,0x95,
-0xb5,0xb0,0x09,0x19,0x92,0xa2,0xa0,0x09,0x46,0x5e,0x7d,0x70,0x5c,0x73,0xc3,0x03,
-0xc3,0x34,0x00,0x10,0x65,0x90,0x06,0x10,0xdd,0xb9,0x11,0x10,0x65,0xc3,0x11,0x51,
-0xdd,0xbb,0x20,0x00,0x93,0x16,0x28,0xf2,0x03,0x21,0xb2,0x00,0x00,0x01,0xdd,0x20,
-0x00,0x15,0x9c,0x66,0xc9,0x51,0x36,0x20,0x00,0x02,0x62,0x73,0x07,0xf2,0x1d,0x0b,
-0x06,0x50,0x00,0x0b,0x0b,0x0a,0xba,0xa5,0x0b,0x0b,0x1e,0x11,0xb0,0x0b,0x0b,0xaa,
-0x44,0x70,0x0b,0x0b,0x31,0xa9,0x30,0x0c,0x7e,0x00,0x9b,0x00,0x3c,0x5c,0x00,0x9b,
-0x00,0x00,0x0b,0x08,0x87,0x90,0x00,0x0b,0x77,0x00,0x75,0x98,0x16,0x31,0xbb,0xb9,
-0x0c,0xd5,0x28,0xc0,0xeb,0xb9,0x00,0x00,0x0b,0x98,0x0a,0x10,0x0b,0xbb,0xcc,0xc0,
-0xc1,0x1a,0x20,0x29,0x59,0xb6,0x0f,0xf0,0x06,0x4e,0x30,0x00,0xb2,0x78,0x05,0xf2,
-0x00,0x1f,0xa4,0x06,0xb2,0xc4,0x00,0x10,0x02,0x80,0x01,0x70,0x00,0x50,0x77,0x07,
-0xf3,0x1c,0x82,0x01,0xa0,0x00,0x5c,0xca,0xa5,0xdb,0xb6,0x04,0x60,0x0b,0x50,0xb0,
-0x05,0xdb,0x9d,0x92,0x80,0x05,0x54,0x92,0xb7,0x40,0x07,0x44,0x60,0x8c,0x00,0x09,
-0x25,0x60,0x7c,0x00,0x0c,0x06,0x55,0xb8,0x80,0x74,0x7c,0x8a,0x00,0x1b,0x2e,0xf0,
-0x21,0x91,0x02,0x80,0x00,0x4a,0xda,0x97,0xcb,0xb6,0x00,0xa2,0x1d,0x30,0xb0,0x00,
-0x91,0x7b,0x73,0x80,0x0d,0xcc,0xa0,0xb8,0x30,0x0a,0x02,0x80,0x9b,0x00,0x0a,0x02,
-0x80,0xab,0x00,0x0e,0xbb,0x8a,0x67,0x90,0x03,0x00,0x83,0x00,0x54,0x00,0x40,0x00,
-0x50,0x4a,0x31,0xf0,0x1c,0xb0,0x00,0x4a,0xaa,0x92,0xeb,0xb4,0x0b,0x16,0x57,0x50,
-0xb0,0x58,0x05,0x9d,0x82,0x80,0x25,0x8b,0x03,0xb7,0x40,0x00,0xa8,0x00,0x7c,0x00,
-0x02,0xab,0x30,0x9c,0x00,0x3b,0x11,0x49,0x74,0xb1,0x10,0x00,0x43,0x00,0x33,0x03,
-0x9e,0x1b,0xf3,0x1d,0x0c,0x33,0x31,0xa0,0x00,0x4a,0x66,0x66,0xb7,0x72,0xab,0x9a,
-0x6b,0x74,0xb1,0x0a,0x82,0xbc,0x93,0x70,0x8d,0xbb,0xd4,0xa8,0x30,0x37,0x73,0x70,
-0x7b,0x00,0x5c,0xcc,0xc2,0x8b,0x00,0x00,0x06,0x44,0x96,0x60,0x00,0x7b,0x3a,0x00,
-0x3d,0x28,0xf5,0x1d,0x85,0x70,0xb0,0x00,0x79,0xda,0xa3,0xea,0xa5,0x12,0x82,0x67,
-0x60,0xb0,0x1b,0x9a,0x5d,0xa1,0x90,0x04,0xa9,0x13,0xb6,0x60,0x05,0xec,0x50,0x6e,
-0x10,0x78,0x92,0x80,0x5d,0x00,0x10,0x82,0x03,0xc8,0x90,0x07,0xc1,0x5b,0x10,0x85,
-0xc9,0x0e,0xf1,0x4c,0x00,0x0e,0x9a,0xb0,0xc0,0x00,0x0b,0x00,0xb3,0xc7,0x76,0x0d,
-0x99,0xba,0x94,0xd4,0x0b,0x00,0xdd,0xb1,0xc0,0x0d,0x88,0xd2,0xb7,0x70,0x0e,0x9a,
-0xb0,0x4e,0x10,0x06,0x36,0x20,0x9e,0x40,0x2c,0x01,0xaa,0x81,0xc6,0x22,0x00,0x14,
-0x00,0x05,0x14,0xc3,0x82,0xb0,0x00,0x02,0xb7,0x84,0xeb,0xb6,0x7a,0xcd,0xac,0x60,
-0xc0,0x07,0xda,0x8a,0xb3,0x90,0x4c,0x4b,0x11,0xb8,0x50,0x31,0xa5,0x51,0x6e,0x00,
-0x8b,0xd8,0x60,0x8d,0x00,0x00,0x90,0x07,0xa7,0x90,0x07,0xb0,0x78,0x00,0x86,0x61,
-0x00,0xf3,0x4e,0x18,0xab,0x81,0xb0,0x00,0x06,0x9a,0x75,0xd9,0xe6,0x0b,0x9b,0xc5,
-0x99,0x50,0x01,0xcc,0x40,0x6f,0x30,0x1b,0x56,0x59,0x81,0xb7,0x06,0x99,0x89,0x88,
-0x81,0x01,0x52,0x5d,0xbb,0x40,0x00,0xa0,0x46,0x00,0x00,0x2a,0xea,0xbc,0xaa,0xa7,
-0x05,0x5b,0x63,0x43,0x00,0x3d,0x6c,0x99,0x8b,0xa5,0x0a,0x9d,0xb5,0xb0,0xa0,0x09,
-0x8c,0x88,0xd5,0x90,0x0c,0x7b,0x7a,0x2c,0x50,0x18,0xba,0x82,0x0d,0x00,0x05,0xa2,
-0x90,0x2d,0x40,0x03,0xbc,0x91,0xa1,0xb3,0x36,0x10,0x22,0x10,0x12,0x00,0x00,0x33,
-0x5f,0x17,0x80,0x2b,0xbb,0xbd,0xbb,0xb8,0x00,0x75,0x00,0x88,0x27,0x00,0xd8,0x17,
-0x20,0x05,0x92,0xac,0x03,0xf1,0x00,0x9d,0x20,0x00,0x00,0x05,0xc9,0xa1,0x00,0x06,
-0xc9,0x00,0x4c,0x93,0x17,0x10,0x57,0x17,0x01,0x00,0x23,0xf3,0x1a,0x01,0x20,0xb0,
-0x07,0x84,0xa2,0x95,0xb0,0x8d,0xaa,0x72,0x01,0xb0,0x00,0x73,0x06,0x90,0xb0,0x5a,
-0xdc,0xa0,0x42,0xb0,0x06,0x75,0x41,0x47,0xe8,0x2a,0x74,0xa8,0x74,0xb0,0x74,0x73,
-0x61,0x00,0xb0,0x05,0xc1,0x00,0xf5,0x05,0xf5,0x1e,0x0a,0x05,0x52,0x7a,0x91,0x6e,
-0xac,0xca,0x20,0x00,0x0b,0x6a,0x59,0x00,0x00,0x0b,0x27,0x59,0xbe,0xb6,0x0c,0x9b,
-0x59,0x09,0x10,0x1b,0x16,0x6a,0x09,0x10,0x7a,0x9a,0x8b,0x09,0x10,0x1b,0x0a,0x48,
-0x09,0x10,0x63,0x01,0xa1,0x09,0x10,0xcd,0x09,0xf1,0x1d,0x40,0x38,0xca,0x84,0xa9,
-0x60,0x08,0x16,0x57,0x40,0x00,0x29,0x6b,0x57,0x73,0x32,0x25,0xa7,0x58,0xa8,0xd4,
-0x49,0xca,0x98,0x40,0xa0,0x05,0x75,0x28,0x30,0xa0,0x1a,0x75,0x8a,0x10,0xa0,0x64,
-0x73,0x7c,0x00,0xa0,0x02,0xb1,0x36,0x5b,0x10,0xf4,0x1a,0x02,0x0a,0x73,0x73,0x49,
-0x71,0xbb,0x5b,0x59,0x00,0x0b,0xa8,0xa9,0x92,0x21,0xd9,0x99,0x9a,0x7c,0x4a,0x62,
-0x72,0x90,0xa0,0xbb,0x7b,0x59,0x0a,0x0b,0xb7,0xb7,0xa0,0xa0,0xda,0xba,0x88,0x0a,
-0x00,0x00,0x01,0x30,0x53,0x2b,0x10,0x2a,0xca,0x1a,0x60,0xbd,0xbb,0xb6,0x00,0x07,
-0x40,0x94,0x03,0xf0,0x00,0x51,0x11,0x00,0x00,0x0b,0xa9,0x9c,0x40,0x00,0x0b,0x00,
-0x08,0x30,0x00,0x67,0x5c,0x2c,0x10,0xc1,0x91,0x28,0x24,0x20,0x0b,0x03,0x0c,0x10,
-0x30,0x91,0x0d,0xf0,0x1a,0xa2,0x00,0x79,0x00,0x2b,0xcb,0x81,0xc9,0x40,0x04,0x70,
+0x84,0x09,0x59,0xa0,0x71,0x80,0x5b,0x90,0x56,0x6a,0x00,0x90,0x04,0x60,0x5a,0xe1,
+0xaa,0xe6,0x20,0x02,0x90,0xa7,0x0b,0xf0,0x14,0x20,0x60,0xb1,0x10,0x1c,0xb7,0xa0,
+0xb8,0x81,0x02,0x65,0xa0,0xb0,0x00,0x0b,0xa1,0xa0,0xb0,0x00,0x07,0xc0,0x8a,0xba,
+0xa2,0x09,0xd7,0x00,0x00,0x00,0x59,0x07,0xbb,0xbb,0xb2,0x10,0x34,0x00,0xf1,0x1e,
+0x3a,0xe3,0x9b,0xb9,0x40,0x01,0x93,0x38,0x75,0xa0,0x07,0x35,0x69,0x97,0xb1,0x09,
+0xd4,0x9b,0xb9,0x60,0x02,0xa2,0x7a,0xa7,0x50,0x08,0xa1,0x27,0x72,0x10,0x08,0x78,
+0x9b,0xb9,0x90,0x0a,0xc4,0x04,0x40,0x00,0x56,0x18,0xba,0xaa,0xa2,0x66,0x00,0x70,
+0x09,0xbe,0xbb,0xcd,0xb4,0x00,0x0b,0xc8,0x08,0x05,0x05,0x00,0x90,0x2b,0xbe,0xbb,
+0xcd,0xb7,0x00,0x1b,0x00,0x47,0x36,0x07,0x90,0x47,0x00,0x02,0xd0,0x00,0x47,0x00,
+0x0b,0x20,0x0f,0x00,0x03,0xe7,0x06,0x80,0xa4,0x80,0x2b,0xbb,0xbc,0xeb,0xc7,0x00,
+0x7a,0x04,0x90,0x01,0x11,0x10,0xc0,0x00,0x08,0xae,0xa5,0xb0,0x96,0x02,0x10,0x83,
+0x05,0x00,0xf2,0x21,0x48,0x04,0x02,0x6e,0xb8,0x0c,0x0a,0x09,0x52,0x00,0x04,0xd7,
+0x7b,0xbb,0xa0,0x0b,0x00,0x01,0xa0,0x0b,0x4b,0xbb,0xa0,0x0b,0x83,0x00,0x00,0x0b,
+0xca,0xaa,0x70,0x0b,0x00,0x03,0x90,0x0b,0x00,0x03,0x80,0x0b,0x00,0x06,0x60,0x0b,
+0x05,0xbc,0x10,0x0b,0x71,0x04,0x31,0xb8,0xaa,0xe0,0x7f,0x0c,0x60,0x0d,0xaa,0x78,
+0xba,0xa0,0x0b,0xa8,0x03,0xf3,0x0a,0x09,0xaa,0xc6,0xaa,0xd1,0x09,0x92,0xb5,0xa4,
+0xa0,0x00,0x4a,0xa0,0x2a,0xe0,0x1b,0x75,0x88,0x92,0xb0,0x00,0x8b,0x30,0x69,0x90,
+0x6a,0x07,0xf1,0x21,0x02,0x30,0x00,0x3a,0xaa,0x0a,0x15,0x10,0x00,0x0a,0x79,0x58,
+0xb0,0x1b,0xaa,0x66,0xb3,0x62,0x37,0x00,0x79,0xe9,0x90,0x5b,0x86,0xa0,0xb0,0xb0,
+0x02,0x2b,0xb9,0xe9,0xe0,0x00,0x0a,0x00,0xb1,0x50,0x00,0x28,0x01,0xb3,0xd1,0x07,
+0xb5,0xcb,0xa9,0x96,0xbc,0x00,0xf7,0x1c,0x6a,0xe3,0xbc,0x6a,0xd0,0x00,0xa3,0xbb,
+0x69,0xc0,0x6a,0xb0,0x88,0x88,0x70,0x72,0x00,0xb3,0xc3,0xb0,0x8b,0xa0,0xc6,0xc6,
+0xc0,0x00,0xa0,0xb9,0xd9,0x90,0x00,0xa5,0x88,0xd8,0x83,0x00,0xa0,0x00,0xb0,0x00,
+0x3b,0x80,0x00,0x6f,0x0b,0xf7,0x1e,0x40,0x3c,0xdb,0xe8,0x08,0x80,0x03,0x70,0xb0,
+0xb6,0x00,0x03,0x70,0xb0,0x00,0x52,0x5c,0xda,0xea,0x07,0x90,0x04,0x60,0xb0,0xa7,
+0x00,0x06,0x50,0xb0,0x10,0x45,0x08,0x30,0xb0,0x02,0xc0,0x0c,0x00,0xb0,0x5c,0x10,
+0x55,0x00,0xb5,0x90,0xa0,0x06,0xf0,0x1e,0x0c,0x88,0x99,0x04,0xa0,0x0c,0x77,0x89,
+0x7a,0x00,0x09,0x89,0x86,0x40,0x31,0x39,0xad,0x98,0x05,0xa0,0x07,0x88,0x84,0x99,
+0x00,0x0b,0x00,0x37,0x20,0x22,0x08,0x9d,0x93,0x01,0xc1,0x0b,0x1a,0x82,0x2b,0x30,
+0x23,0x87,0x05,0xb1,0x00,0x11,0x00,0x01,0x00,0xf0,0x16,0xb1,0x00,0xb0,0x00,0x2b,
+0x30,0xaa,0xea,0xa2,0x00,0xa5,0x22,0xc2,0x22,0x08,0xb4,0x66,0x6a,0x95,0x57,0xb4,
+0x88,0x8b,0xb5,0x00,0xb0,0x52,0x17,0x61,0x00,0xb0,0x59,0x06,0x40,0x00,0xb0,0x09,
+0x05,0x00,0xf3,0x26,0x00,0x8c,0x20,0x00,0x21,0x00,0x00,0x00,0x01,0xc1,0xca,0xaa,
+0xc0,0x2c,0x20,0xb0,0x00,0xb0,0x01,0x84,0xc9,0x99,0xc0,0x04,0xc0,0xb0,0x00,0xb0,
+0x3c,0xb0,0xca,0xda,0x80,0x11,0xb0,0xb0,0x91,0xa1,0x00,0xb0,0xb0,0x4c,0x20,0x00,
+0xb0,0xb3,0x4a,0x60,0x00,0xb0,0xd8,0x30,0x77,0x64,0x00,0xf2,0x44,0x08,0x40,0x00,
+0x0a,0x30,0x86,0x19,0x30,0x02,0x86,0x9c,0x83,0x40,0x05,0xb3,0xdc,0x99,0xc2,0x3a,
+0xb1,0x2c,0x10,0x16,0x00,0xb1,0xbc,0x9b,0xa0,0x00,0xb7,0x4a,0x5c,0x10,0x00,0xb0,
+0x28,0xea,0x20,0x00,0xb8,0x93,0x04,0xa8,0x00,0x41,0x00,0x00,0x00,0x03,0xa2,0xaa,
+0xaa,0xa6,0x3a,0x22,0x72,0x91,0xa0,0x00,0xb4,0x94,0x76,0x50,0x09,0xb1,0xa2,0x94,
+0x80,0x57,0xa0,0x54,0x73,0x82,0x00,0xa1,0xaa,0xaa,0xa3,0x00,0xa0,0x00,0xb0,0x00,
+0x05,0x00,0xf0,0x89,0xa8,0xaa,0xea,0xa8,0x00,0x00,0x01,0x00,0x00,0x01,0xb1,0x39,
+0x07,0x40,0x1b,0x30,0x87,0x0c,0x20,0x11,0x95,0xa8,0x99,0xb2,0x07,0xb7,0x10,0xb0,
+0x16,0x59,0xa0,0x70,0xa0,0x00,0x00,0xa0,0xc0,0xaa,0xa2,0x00,0xa0,0xf2,0xa0,0x00,
+0x00,0xa7,0x6b,0xc0,0x00,0x00,0xb8,0x03,0x9a,0xa6,0x00,0x51,0x33,0x00,0x00,0x04,
+0x90,0xba,0x99,0x96,0x3a,0x26,0xb4,0x44,0x40,0x00,0xc7,0xb5,0x55,0xc0,0x09,0xb0,
+0xa7,0x77,0xd0,0x57,0xa0,0x8a,0x88,0xb0,0x00,0xa0,0x3e,0x88,0x70,0x00,0xa4,0xab,
+0x18,0x70,0x00,0xa1,0x17,0xfc,0x10,0x00,0xa7,0xb7,0x14,0x98,0x00,0x10,0x00,0x00,
+0x00,0x09,0x46,0x99,0xc9,0x30,0x67,0x1b,0x00,0xb0,0x00,0x13,0x8b,0x99,0xe9,0x92,
+0x1e,0x2b,0x25,0xc5,0x30,0x9b,0x1b,0x76,0x44,0xb0,0x09,0x1b,0x7a,0x88,0xb0,0x09,
+0x1b,0x79,0x77,0xb0,0x09,0x39,0x79,0x88,0xb0,0x09,0x46,0x74,0x9c,0x00,0x04,0x01,
+0x00,0xf6,0x1f,0x09,0x44,0x84,0x19,0x00,0x85,0x38,0x88,0x4a,0x42,0x06,0x6b,0xbb,
+0x87,0xb4,0x2e,0x16,0x66,0xe4,0xa0,0xbc,0x14,0x44,0x68,0xb0,0x0a,0x0b,0x9a,0x0b,
+0x70,0x0a,0x09,0x0b,0x4b,0x30,0x0a,0x19,0x1a,0x6a,0xa0,0x0a,0x53,0x03,0x90,0x56,
+0x00,0x01,0x00,0xf0,0x20,0xa3,0x33,0xc3,0x32,0x0a,0x42,0x55,0xc5,0x53,0x23,0x74,
+0xdb,0x9c,0xa5,0x02,0xc0,0xa8,0x39,0x55,0x2c,0xb0,0x55,0x55,0x52,0x22,0xb5,0x99,
+0xb9,0x97,0x00,0xb0,0x23,0xa0,0x40,0x00,0xb7,0x49,0x22,0x75,0x00,0xb7,0x0b,0x9a,
+0x26,0x00,0x03,0x30,0x9b,0x01,0xf3,0x16,0xa6,0x00,0x00,0x00,0x02,0x09,0x50,0x00,
+0x03,0x0b,0x00,0x02,0x40,0x0b,0x0b,0x00,0x00,0xc0,0x0c,0x0b,0x00,0x00,0x93,0x38,
+0x0b,0x00,0x06,0x57,0x23,0x0b,0x00,0x0b,0x01,0x00,0x0b,0xbb,0xc6,0x5f,0x00,0xf2,
+0x1c,0x08,0x50,0x01,0x20,0x00,0x00,0x8a,0x0b,0x30,0x00,0x07,0x02,0x58,0x00,0x09,
+0x1c,0x02,0xc5,0x20,0x0c,0x0c,0x2c,0x22,0xb0,0x48,0x0d,0xb1,0x00,0x93,0x31,0x5e,
+0x10,0x05,0x25,0x2b,0x8c,0x00,0x0b,0x00,0x22,0x09,0xcb,0xc7,0x6d,0x01,0xf7,0x19,
+0x04,0xc4,0xab,0xeb,0xb0,0x18,0xaa,0x00,0xb0,0xb0,0x45,0xa2,0x00,0xb0,0xb0,0x11,
+0xa5,0xbb,0xfb,0xd9,0x00,0xa0,0x06,0xd5,0x00,0x00,0xa0,0x0b,0x1c,0x00,0x00,0xa0,
+0x87,0x05,0xb1,0x00,0xa8,0x70,0x00,0x5a,0xc3,0x00,0xf3,0x1d,0x4b,0x11,0x11,0x10,
+0x02,0xc9,0xe9,0xe9,0xd0,0x0b,0x18,0x53,0x90,0xb0,0x01,0x96,0x2b,0x10,0xb0,0x00,
+0x20,0xb1,0x6b,0x60,0x00,0x00,0x47,0x00,0x00,0x09,0x39,0x0b,0x10,0xa0,0x0a,0x19,
+0x02,0x18,0x74,0x13,0x0c,0xaa,0xb8,0x12,0x2d,0x01,0xf0,0x05,0x50,0x80,0x00,0x03,
+0xc8,0x45,0x9d,0x10,0x03,0x65,0x54,0x34,0x60,0x00,0xe9,0x99,0x9e,0x00,0x00,0xd9,
+0x05,0x00,0xf0,0x06,0x01,0xa1,0x00,0x00,0x04,0x23,0x5c,0x02,0x30,0x0c,0x37,0x03,
+0x15,0xb0,0x27,0x1c,0xba,0xb5,0x52,0x00,0x03,0x32,0x00,0xf3,0x4a,0x2f,0x99,0x92,
+0x00,0x02,0xb1,0x01,0xc0,0x00,0x0a,0x9a,0xaa,0xaa,0x90,0x00,0x57,0x77,0x78,0x90,
+0x00,0x11,0x11,0x13,0x90,0x00,0x99,0xba,0x99,0x60,0x01,0x24,0x4a,0x00,0x70,0x09,
+0x59,0x06,0x46,0x57,0x07,0x0c,0xaa,0xab,0x06,0x02,0x90,0x0a,0x00,0x00,0x06,0xb6,
+0xae,0xaa,0xa7,0x1a,0x99,0x19,0x07,0x00,0x47,0x93,0x56,0x69,0x15,0x13,0x90,0x93,
+0x79,0x63,0x02,0x91,0xb4,0x4c,0x70,0x02,0x9a,0x30,0x7c,0x20,0x02,0x94,0x03,0xb1,
+0xb1,0x02,0x90,0x3a,0x10,0x38,0xc4,0x00,0xf3,0x07,0x22,0x00,0x00,0x00,0x66,0xb8,
+0x66,0x00,0x00,0xc3,0x33,0x3c,0x00,0x00,0xe8,0x88,0x8e,0x00,0x00,0xd7,0x77,0x7d,
+0x0a,0x00,0xf0,0x2b,0x11,0x93,0x11,0x00,0x05,0x34,0x1b,0x03,0x80,0x1b,0x56,0x04,
+0x17,0xb1,0x34,0x2c,0xba,0xb5,0x31,0x0a,0x05,0x68,0xb6,0x60,0x4b,0x84,0x8a,0xc8,
+0x70,0x8a,0x44,0x36,0x93,0x31,0x8a,0x05,0x55,0x55,0x52,0x1a,0x05,0xb9,0x99,0xa0,
+0x0a,0x05,0xa8,0x88,0xa0,0x0a,0x05,0xb8,0x89,0xa0,0x0a,0x05,0x50,0x00,0x05,0x00,
+0xf2,0x11,0x2a,0x70,0x00,0x00,0x12,0x00,0x00,0x06,0x99,0xad,0x99,0x90,0x00,0x0b,
+0x00,0x75,0x00,0x09,0x99,0x99,0x99,0x94,0x00,0xc8,0x88,0x8b,0x40,0x00,0xd7,0x77,
+0x7b,0x40,0x0a,0x00,0xe1,0x12,0x77,0x01,0x20,0x08,0x4b,0x06,0x33,0xb0,0x07,0x09,
+0x99,0xb3,0x32,0x94,0x00,0xf1,0x1e,0x06,0x99,0x99,0xdc,0xb4,0x0b,0x24,0x43,0xb0,
+0x40,0x0b,0x36,0x64,0xb3,0x80,0x0b,0x6a,0x98,0x7c,0x10,0x2a,0x77,0x68,0x9b,0x16,
+0x64,0x12,0x45,0x55,0xb3,0x02,0x34,0x48,0x01,0x30,0x0c,0x57,0x07,0x17,0xb0,0x34,
+0x2c,0x99,0x97,0x31,0x32,0x00,0xf3,0x4b,0x05,0x84,0x35,0x76,0x50,0x3b,0x88,0xa7,
+0x70,0x51,0x0a,0x77,0x92,0x99,0x80,0x0c,0x77,0xb5,0x55,0x80,0x0c,0x66,0xb5,0xa4,
+0x21,0x0a,0x07,0x93,0xb9,0xb1,0x03,0x01,0x66,0x00,0x60,0x2a,0x46,0x07,0x32,0xb0,
+0x42,0x2c,0x99,0xb2,0x42,0x01,0x90,0xb7,0x77,0xd0,0x04,0xb4,0xb6,0x66,0xd0,0x17,
+0x99,0x67,0x77,0x80,0x45,0x95,0xac,0x8c,0x97,0x12,0x94,0xac,0x7b,0x97,0x01,0x94,
+0x99,0x99,0x91,0x01,0x90,0x49,0x07,0x90,0x01,0x90,0x09,0xec,0x10,0x01,0x98,0xa6,
+0x25,0xb8,0x27,0x01,0xf5,0x21,0x05,0x00,0x00,0x08,0x99,0x9e,0xa9,0x94,0x0a,0x08,
+0x29,0x26,0x00,0x0a,0x5a,0x9b,0x7d,0x71,0x0c,0xac,0xaa,0x6c,0x60,0x0a,0x0a,0x4a,
+0x7c,0x60,0x0a,0x08,0x3b,0x88,0x72,0x19,0x01,0x27,0xa2,0x20,0x55,0x65,0xb0,0x34,
+0xb0,0x81,0x80,0x99,0x99,0x43,0x24,0x02,0xf3,0x4c,0x10,0x09,0x77,0x96,0xaa,0x60,
+0x09,0x66,0x91,0x93,0x50,0x09,0x99,0x94,0xb6,0x30,0x2c,0x99,0xc7,0x8a,0x73,0x07,
+0x47,0x66,0x49,0x90,0x26,0xa3,0x55,0x77,0x13,0x01,0x02,0x7a,0x02,0x10,0x0b,0x2a,
+0x07,0x23,0xb0,0x35,0x0b,0x99,0xb2,0x44,0x00,0x00,0x07,0x48,0x50,0x08,0xbb,0xbd,
+0xcb,0xd4,0x0c,0x00,0x05,0x60,0x20,0x0c,0xaa,0x83,0x74,0x90,0x0c,0x00,0xb1,0xab,
+0x20,0x0b,0x00,0xa0,0xc8,0x00,0x0b,0x5a,0x72,0xe4,0x26,0x48,0x01,0x2c,0x3a,0x45,
+0x82,0x00,0x92,0x07,0xc1,0x62,0x00,0xf1,0x1c,0x03,0x85,0x80,0x0b,0xbb,0xbc,0xdb,
+0xc6,0x00,0x00,0x01,0xa0,0x00,0x07,0xba,0xd0,0xc0,0xc0,0x07,0x20,0xb0,0xc6,0x80,
+0x06,0xaa,0xc0,0xad,0x00,0x00,0x00,0x41,0xb8,0x06,0x0a,0xcb,0x8b,0x7c,0x0a,0x03,
+0x00,0x85,0x05,0xd6,0x30,0x00,0xf7,0x1f,0x02,0x4b,0x31,0xc4,0x60,0x04,0x5c,0x41,
+0xc0,0x61,0x2a,0xbb,0xaa,0xea,0xa6,0x03,0xa9,0x41,0xc0,0x70,0x0d,0x8a,0x73,0xa2,
+0xa0,0x19,0x9b,0x93,0x7c,0x30,0x06,0x9b,0x83,0x5b,0x05,0x06,0xac,0xa6,0xbc,0x0a,
+0x06,0x20,0x0b,0x24,0xc6,0x00,0x01,0x00,0xf5,0x21,0xd8,0x70,0xa7,0x20,0x09,0x8d,
+0x89,0x2a,0x06,0x00,0xa6,0xc7,0x88,0xea,0x80,0x0a,0x09,0x75,0x3b,0x05,0x00,0xa7,
+0x77,0x70,0xb5,0x50,0x09,0x96,0x68,0x09,0xb0,0x01,0x88,0x78,0x70,0x87,0x30,0x54,
+0x26,0x92,0x5b,0xa8,0x05,0x39,0x98,0x89,0x08,0x90,0x39,0x00,0xf4,0x18,0x03,0x00,
+0x05,0x8a,0xaa,0x61,0x00,0xc2,0x00,0x00,0x00,0x0e,0xaa,0xaa,0xa9,0x00,0xc0,0x00,
+0x00,0xb0,0x0b,0x00,0x00,0x0b,0x02,0xda,0xaa,0xaa,0xb0,0x56,0x00,0x00,0x01,0x0b,
+0x10,0x00,0x00,0x02,0x50,0x32,0x01,0xf4,0x1d,0x07,0x9b,0x92,0x8b,0xa2,0x0c,0x00,
+0x06,0x60,0x00,0x0e,0xaa,0x96,0x50,0x00,0x0b,0x00,0xa6,0xcb,0xd5,0x0e,0xab,0xa7,
+0x41,0x90,0x0a,0x00,0x08,0x21,0x90,0x29,0x00,0x0b,0x11,0x90,0x66,0x00,0x1b,0x01,
+0x90,0x81,0x00,0x73,0x01,0x65,0x00,0xf5,0x20,0x60,0x00,0x00,0x07,0xaa,0xeb,0xaa,
+0x70,0x0b,0x00,0x00,0x01,0xb0,0x0b,0x88,0x88,0x88,0xb0,0x0b,0x33,0x33,0x33,0x20,
+0x0b,0x89,0xe2,0xa9,0xe0,0x0b,0x64,0xa0,0x83,0xa0,0x0a,0x07,0xd0,0x08,0xd0,0x46,
+0x97,0xb2,0xb5,0xb0,0x81,0x06,0xb0,0x07,0xc0,0x04,0xf1,0x02,0x14,0x20,0x05,0xaa,
+0xbd,0x96,0x20,0x00,0x00,0x29,0x00,0x00,0x06,0xbb,0xbe,0xbb,0xb1,0x0a,0x00,0x01,
+0x05,0x00,0x56,0x2b,0xbb,0xce,0xbb,0xb8,0x0f,0x00,0x20,0x00,0x1b,0x0d,0x01,0xd0,
+0xa0,0x56,0x66,0x63,0x49,0xd9,0x21,0x1c,0x10,0x12,0xb1,0x00,0x0c,0x39,0x04,0x94,
+0x0c,0x00,0x16,0xeb,0x10,0x0c,0x00,0x57,0xb0,0x0f,0x00,0x01,0x05,0x00,0x43,0x1b,
+0x80,0x09,0xb9,0x62,0x00,0xf3,0x1d,0xb0,0x0b,0x18,0x00,0x49,0xd8,0x0a,0x14,0x60,
+0x02,0xb1,0xbe,0xc9,0x71,0x00,0xb0,0x06,0x51,0x60,0x16,0xeb,0x04,0x89,0x30,0x47,
+0xb0,0x01,0xd9,0x00,0x00,0xb0,0x02,0xf2,0x13,0x00,0xb0,0x5b,0x6a,0x57,0x1a,0x80,
+0x70,0x07,0xd1,0x32,0x00,0xf3,0x1c,0x00,0xa1,0x00,0x18,0xe7,0x7a,0xba,0xa5,0x01,
+0xc1,0x03,0x00,0x50,0x00,0xb0,0x0b,0x01,0xb0,0x18,0xe8,0x0b,0x03,0x80,0x13,0xb0,
+0x09,0x16,0x40,0x00,0xb0,0x06,0x3a,0x00,0x00,0xb2,0x99,0x9d,0x97,0x09,0x90,0x11,
+0x11,0x11,0x32,0x00,0xf0,0x10,0xab,0xbb,0xb2,0x38,0xd8,0xa1,0x00,0x00,0x12,0xc2,
+0xab,0xbb,0x90,0x00,0xb0,0xa1,0x00,0xa0,0x16,0xeb,0xa1,0x00,0xa0,0x36,0xb0,0xab,
+0xaa,0xa0,0x00,0xb0,0xa1,0x23,0x00,0xf3,0x24,0xa3,0x11,0x10,0x1a,0x80,0x69,0x99,
+0x94,0x00,0xb0,0x00,0xc3,0x00,0x02,0xc2,0x06,0x8a,0x00,0x17,0xd7,0x5a,0x02,0xb1,
+0x00,0xb1,0xaa,0xaa,0x77,0x02,0xda,0x01,0x11,0x00,0x39,0xd1,0x6b,0x99,0xc0,0x00,
+0xb0,0x65,0x00,0xb0,0x00,0xb0,0x6b,0x99,0xc0,0x0a,0x90,0x65,0xe7,0x05,0xf4,0x1d,
+0x07,0x30,0x11,0xb1,0x10,0x7c,0xa2,0x66,0xd6,0x50,0x18,0x43,0x55,0xc5,0x51,0x07,
+0x43,0x55,0x5c,0x51,0x6d,0xb6,0x88,0x8d,0x92,0x48,0x30,0x62,0x1b,0x20,0x07,0x30,
+0x57,0x0a,0x00,0x07,0x30,0x08,0x0a,0x00,0x5c,0x10,0x00,0xac,0xf5,0x00,0xf0,0x19,
+0x73,0x25,0x40,0x38,0xe8,0x79,0x52,0x22,0x01,0xc1,0x68,0x44,0x95,0x00,0xb0,0x16,
+0x77,0x50,0x16,0xeb,0x4a,0xaa,0xa0,0x35,0xb0,0x74,0x11,0xb0,0x00,0xb0,0x79,0x77,
+0xd0,0x00,0xb0,0x7a,0x88,0xd0,0x0a,0x90,0x0f,0x00,0x02,0x32,0x00,0xf1,0x1c,0x11,
+0xa3,0x11,0x39,0xe7,0xc5,0x85,0x5b,0x01,0xb1,0x92,0xa0,0x09,0x00,0xb2,0xac,0xca,
+0xa9,0x02,0xeb,0x0c,0x02,0xa0,0x4a,0xc0,0x69,0x07,0x50,0x00,0xb0,0x08,0xbc,0x00,
+0x00,0xb0,0x04,0xcb,0x80,0x0a,0x80,0xb8,0x00,0x78,0x31,0x00,0xf0,0x00,0x01,0xa0,
+0xba,0xaa,0xa5,0x29,0xd6,0xb4,0x77,0x71,0x02,0xb1,0xb1,0x33,0x30,0x0f,0x00,0xf6,
+0x0b,0xa6,0x06,0xe8,0xb5,0x47,0x22,0x38,0xa0,0xb5,0x48,0xa1,0x01,0xa0,0xb5,0x45,
+0x50,0x01,0xa3,0x85,0x75,0xb2,0x0a,0x85,0x48,0x81,0x26,0xc5,0x02,0xf2,0x1e,0x08,
+0x25,0x99,0xe9,0x91,0x5b,0x82,0x44,0xc4,0x30,0x3a,0x61,0x55,0xc5,0xb0,0x08,0x37,
+0x99,0xe9,0xe4,0x4c,0xc3,0x66,0xd6,0xb0,0x49,0x21,0x82,0xb2,0x10,0x08,0x25,0x90,
+0xd9,0x70,0x08,0x2a,0xa4,0xa0,0x00,0x5c,0x47,0x08,0xaa,0xa3,0x32,0x00,0xf0,0x1c,
+0x20,0x99,0x99,0xa0,0x4a,0x71,0x68,0x88,0xa0,0x3a,0x62,0x99,0x99,0xa0,0x08,0x35,
+0x77,0x77,0x72,0x5c,0xbd,0x21,0xb1,0x65,0x49,0x24,0xc9,0xd9,0xb1,0x08,0x20,0xa0,
+0xa0,0xa0,0x08,0x20,0xa0,0xa7,0x90,0x5c,0x10,0x00,0xa0,0xbd,0x01,0xf0,0x11,0x98,
+0x00,0x19,0xe7,0x59,0xa8,0x94,0x01,0xc1,0x00,0xa8,0x00,0x00,0xb0,0x5a,0xa8,0xa3,
+0x16,0xea,0x00,0xa8,0x00,0x14,0xb0,0x8b,0xa8,0xa5,0x00,0xb0,0x00,0xa8,0x10,0x05,
+0x00,0x53,0x00,0x09,0x90,0x00,0xa8,0x91,0x00,0xf2,0x4a,0x23,0x77,0x88,0x60,0x7c,
+0xa6,0x24,0x40,0x91,0x18,0x32,0x81,0x81,0xa0,0x08,0x20,0x70,0x67,0x20,0x7d,0x97,
+0xaa,0xea,0xa2,0x28,0x20,0x0b,0xe7,0x00,0x08,0x20,0xa4,0xaa,0x30,0x08,0x3b,0x60,
+0xa1,0xc3,0x5c,0x12,0x00,0xa0,0x01,0x09,0x10,0x15,0x71,0x10,0x2a,0x43,0xb9,0x8b,
+0x90,0x5c,0x70,0x35,0x1a,0x00,0x09,0x17,0xac,0xba,0xa2,0x0a,0xb0,0x0b,0x10,0x00,
+0x9d,0x28,0xcb,0x9e,0x93,0x09,0x10,0xd3,0x2a,0x00,0x09,0x10,0x1b,0xf8,0x00,0x5b,
+0x09,0xa6,0x06,0xa0,0x5f,0x00,0xf2,0x12,0x21,0x23,0xb2,0x20,0x7d,0xba,0x64,0x44,
+0xb0,0x08,0x25,0x5a,0x1a,0x50,0x08,0x23,0xb1,0x02,0x80,0x3c,0xb2,0x99,0x99,0x40,
+0x7a,0x20,0x11,0xc1,0x00,0x08,0x20,0x00,0xb0,0x05,0x00,0xf0,0x12,0x6c,0x09,0xaa,
+0xea,0xa1,0x08,0x30,0x72,0x91,0x00,0x7c,0xa3,0xda,0xdb,0xa3,0x18,0x49,0xb0,0xb0,
+0x00,0x08,0x49,0xda,0xea,0xa1,0x3b,0xc3,0xa0,0xb0,0x00,0x6a,0x30,0xda,0x1e,0x00,
+0xf0,0x22,0xa0,0xb0,0x00,0x08,0x30,0xda,0xea,0xa5,0x5c,0x10,0xa0,0x00,0x00,0x08,
+0x10,0x0a,0x0b,0x00,0x7d,0xa6,0x8d,0x7d,0x72,0x19,0x30,0x0a,0x0b,0x00,0x08,0x21,
+0xaf,0xaf,0x90,0x5d,0xb3,0xa0,0x90,0xb0,0x4a,0x11,0xea,0xda,0xd0,0x08,0x11,0xa0,
+0x90,0xb0,0x08,0x0a,0x00,0x21,0x6c,0x01,0xcc,0x08,0x01,0x8c,0x00,0xf7,0x1c,0xd8,
+0x88,0xb0,0x7c,0xa3,0xc7,0x77,0xb0,0x19,0x31,0xd8,0x88,0xb0,0x08,0x20,0x22,0x22,
+0x10,0x1b,0xc7,0x99,0xe9,0x92,0x9c,0x20,0x90,0xb0,0x00,0x08,0x23,0xc0,0xd8,0x60,
+0x08,0x29,0x96,0xb0,0x00,0x5c,0x38,0x06,0xaa,0xa4,0x62,0x08,0xf3,0x1d,0x11,0x98,
+0xd4,0x00,0x5d,0xa3,0x33,0xc3,0x30,0x19,0x34,0x66,0xd6,0x60,0x09,0x22,0x96,0xa5,
+0x60,0x5d,0xb7,0x60,0xa1,0x90,0x3a,0x15,0xc8,0xa7,0xb0,0x09,0x15,0x60,0xa0,0x80,
+0x09,0x15,0xc9,0xe9,0xb0,0x3c,0x05,0x60,0x00,0x80,0x4e,0x02,0xf3,0x1b,0x6a,0x88,
+0xd0,0x16,0xd4,0x69,0x77,0xd0,0x13,0xc2,0x6a,0x88,0xd0,0x00,0xb0,0x55,0x55,0x53,
+0x16,0xe9,0x6c,0x55,0x53,0x36,0xb0,0xcb,0xbc,0xb5,0x00,0xb5,0x4a,0x29,0x64,0x00,
+0xb0,0x85,0x83,0x72,0x0a,0x92,0x53,0x78,0xe4,0x02,0xf3,0x1d,0x20,0x1c,0x53,0x00,
+0x3a,0x60,0x93,0x85,0x00,0x3a,0x66,0xd9,0x99,0xc0,0x07,0x20,0x97,0x35,0x90,0x0a,
+0xc0,0xa8,0x09,0xa0,0x7c,0x30,0x91,0xa0,0xa0,0x07,0x27,0x9b,0xf9,0x94,0x07,0x20,
+0x1b,0x39,0x00,0x4c,0x19,0x92,0x03,0x94,0x98,0x00,0xf7,0x21,0x01,0x24,0x30,0x08,
+0x25,0xaa,0x85,0x50,0x5b,0x82,0xa4,0x58,0x30,0x4a,0x76,0xca,0xad,0x90,0x08,0x23,
+0x6a,0x44,0x41,0x09,0xa7,0xa8,0x55,0x51,0x9c,0x40,0xbc,0x9b,0x60,0x08,0x20,0xbb,
+0x3c,0x10,0x08,0x29,0x44,0xf9,0x00,0x5c,0x66,0x88,0x26,0xb2,0x85,0x02,0xf7,0x4a,
+0x20,0x08,0xb6,0x60,0x7c,0xa8,0x85,0x59,0x50,0x19,0x40,0x76,0xd6,0x00,0x08,0x36,
+0xda,0x10,0x00,0x4c,0xc3,0xba,0xd9,0x80,0x6a,0x24,0x61,0xb1,0x10,0x08,0x27,0x98,
+0xd8,0x93,0x08,0x21,0x90,0xb0,0xb0,0x5c,0x11,0x99,0x99,0xd0,0x08,0x11,0x2b,0x2c,
+0x20,0x08,0x15,0x7d,0x7d,0x70,0x6c,0x93,0x98,0x69,0x60,0x08,0x12,0xd8,0x89,0x90,
+0x2b,0xb5,0xc6,0x68,0x90,0x6b,0x20,0x23,0x92,0x10,0x08,0x19,0x9d,0xea,0x91,0x08,
+0x10,0x3a,0x29,0x00,0x6c,0x1a,0x91,0x04,0xb1,0x36,0x01,0xf7,0x1d,0x05,0x9b,0x88,
+0x00,0x6d,0x85,0xb4,0x3a,0x80,0x1a,0x3a,0xb3,0x4b,0xa0,0x09,0x36,0x59,0x9b,0x40,
+0x3c,0xb6,0x9b,0x78,0x50,0x6b,0x0b,0x01,0x77,0x40,0x09,0x08,0x99,0x97,0x40,0x09,
+0x00,0x27,0x6d,0x00,0x5b,0x04,0xb6,0xa6,0x60,0x9b,0x00,0xf2,0x49,0x24,0xa7,0xc5,
+0x30,0x5b,0x81,0xa1,0xa8,0x20,0x4a,0x78,0xab,0xec,0x92,0x08,0x30,0x58,0xba,0x10,
+0x4c,0xcb,0x81,0x82,0xb3,0x5a,0x22,0xc7,0xd7,0xb0,0x08,0x21,0xd8,0xd8,0xa0,0x08,
+0x21,0x90,0xa0,0xa0,0x5c,0x11,0xc8,0x88,0xa0,0x08,0x25,0xac,0x8c,0xd0,0x6c,0xa6,
+0x9c,0x9b,0xc0,0x19,0x42,0x77,0xd7,0x50,0x08,0x30,0x34,0xd3,0x20,0x4c,0xc7,0xba,
+0x9c,0x91,0x5a,0x23,0x9a,0x6c,0x50,0x08,0x21,0x34,0xd3,0x30,0x08,0x27,0x9a,0xe9,
+0x92,0x5c,0x10,0x01,0xc0,0x5f,0x00,0xf1,0x4b,0x49,0xd9,0x69,0x8d,0x00,0x3b,0xd9,
+0xb9,0x06,0xa2,0x27,0xb6,0x49,0x9b,0x40,0x69,0xc8,0x84,0xcb,0x20,0x2b,0xbb,0xbb,
+0x78,0x71,0x05,0x55,0xb6,0x44,0x10,0x05,0x55,0xb7,0x55,0x20,0x68,0x88,0xc9,0x88,
+0x82,0x00,0x08,0xc1,0x00,0x00,0x09,0x10,0xb8,0x8c,0x00,0x5c,0x80,0xb7,0x7c,0x00,
+0x1a,0x36,0x97,0x69,0x70,0x09,0x19,0x09,0x90,0x90,0x0b,0xdb,0x8b,0xa8,0xc0,0x4b,
+0x19,0xac,0xca,0xa1,0x09,0x10,0x4e,0xe5,0x00,0x09,0x15,0xb5,0x6a,0x50,0x3b,0x38,
+0x04,0x60,0x71,0x5f,0x00,0xf6,0x1e,0x0a,0x00,0x08,0xa8,0x80,0x6d,0x79,0x9d,0x99,
+0xb3,0x1b,0x1a,0x5d,0x87,0x60,0x0a,0x0a,0x06,0x88,0xa0,0x3c,0xaa,0x69,0xa8,0x81,
+0x6c,0x0a,0x59,0x71,0x90,0x0a,0x0a,0x47,0xcb,0x50,0x0a,0x37,0x58,0x94,0xa1,0x5b,
+0x62,0x75,0xa1,0x04,0xf5,0x00,0xf7,0x1e,0x07,0x22,0x35,0xa3,0x30,0x2a,0x68,0xa4,
+0x64,0xa0,0x3a,0x72,0xab,0x8a,0x90,0x07,0x26,0x79,0x0b,0x20,0x3b,0xb4,0xb8,0x86,
+0x90,0x39,0x25,0x99,0x99,0x70,0x07,0x20,0x60,0xa5,0x00,0x07,0x24,0x90,0xa3,0x70,
+0x2b,0x16,0x09,0x80,0x60,0x63,0x01,0xf7,0x1d,0x0a,0x76,0x99,0xe2,0x4b,0x5b,0x13,
+0x79,0x50,0x3b,0x4a,0x98,0x08,0x60,0x09,0x0a,0x04,0xbb,0xc4,0x4c,0xbb,0xd4,0x2a,
+0x52,0x2a,0x5a,0xd7,0x8b,0xa3,0x09,0x03,0x92,0x8a,0x00,0x09,0x0a,0x9a,0xbb,0x00,
+0x5b,0x55,0x0a,0x2b,0x95,0x37,0x00,0xf3,0x1d,0x12,0x46,0xb4,0x42,0x4b,0x69,0x3a,
+0x29,0x21,0x4b,0x79,0x5d,0x8d,0x70,0x09,0x19,0x8b,0xaa,0x85,0x3c,0xca,0x67,0xc7,
+0x80,0x7b,0x19,0x95,0xb5,0xb0,0x09,0x19,0x92,0xa2,0xa0,0x09,0x46,0x5e,0x7d,0x70,
+0x5c,0x73,0xc3,0x03,0xc3,0x34,0x00,0x10,0x65,0x90,0x06,0x31,0xdd,0xbb,0xb2,0x0a,
+0x00,0xf2,0x0f,0x08,0xbb,0xdd,0xbb,0x20,0x00,0x93,0x00,0x2b,0x00,0x00,0x0b,0x21,
+0xb2,0x00,0x00,0x01,0xdd,0x20,0x00,0x15,0x9c,0x66,0xc9,0x51,0x36,0x20,0x00,0x02,
+0x62,0x73,0x07,0xf0,0x26,0x0b,0x06,0x50,0x00,0x0b,0x0b,0x0a,0xba,0xa5,0x0b,0x0b,
+0x1e,0x11,0xb0,0x0b,0x0b,0xaa,0x44,0x70,0x0b,0x0b,0x31,0xa9,0x30,0x0c,0x7e,0x00,
+0x9b,0x00,0x3c,0x5c,0x00,0x9b,0x00,0x00,0x0b,0x08,0x87,0x90,0x00,0x0b,0x77,0x00,
+0x75,0x00,0x00,0x00,0x50,0x00,0x00,0xbb,0xb9,0x0c,0x3a,0x00,0xc0,0xb2,0xeb,0xb9,
+0x00,0x00,0x0b,0x98,0x0a,0x10,0x0b,0xbb,0xcc,0xfd,0x0c,0xf0,0x0d,0x00,0x29,0x59,
+0x00,0x0b,0x00,0x00,0x4e,0x30,0x00,0xb2,0x78,0x05,0xf2,0x00,0x1f,0xa4,0x06,0xb2,
+0xc4,0x00,0x10,0x02,0x80,0x01,0x70,0x00,0x50,0x77,0x07,0xf2,0x1d,0x82,0x01,0xa0,
+0x00,0x5c,0xca,0xa5,0xdb,0xb6,0x04,0x60,0x0b,0x50,0xb0,0x05,0xdb,0x9d,0x92,0x80,
+0x05,0x54,0x92,0xb7,0x40,0x07,0x44,0x60,0x8c,0x00,0x09,0x25,0x60,0x7c,0x00,0x0c,
+0x06,0x55,0xb8,0x80,0x74,0x7c,0x8a,0x00,0x96,0xcc,0x00,0xf0,0x1f,0x91,0x02,0x80,
+0x00,0x4a,0xda,0x97,0xcb,0xb6,0x00,0xa2,0x1d,0x30,0xb0,0x00,0x91,0x7b,0x73,0x80,
+0x0d,0xcc,0xa0,0xb8,0x30,0x0a,0x02,0x80,0x9b,0x00,0x0a,0x02,0x80,0xab,0x00,0x0e,
+0xbb,0x8a,0x67,0x90,0x03,0x00,0x83,0x00,0x54,0x00,0x40,0x9b,0x00,0xf2,0x4f,0x93,
+0x00,0xb0,0x00,0x4a,0xaa,0x92,0xeb,0xb4,0x0b,0x16,0x57,0x50,0xb0,0x58,0x05,0x9d,
+0x82,0x80,0x25,0x8b,0x03,0xb7,0x40,0x00,0xa8,0x00,0x7c,0x00,0x02,0xab,0x30,0x9c,
+0x00,0x3b,0x11,0x49,0x74,0xb1,0x10,0x00,0x43,0x00,0x33,0x03,0x00,0x00,0x30,0x00,
+0x0c,0x33,0x31,0xa0,0x00,0x4a,0x66,0x66,0xb7,0x72,0xab,0x9a,0x6b,0x74,0xb1,0x0a,
+0x82,0xbc,0x93,0x70,0x8d,0xbb,0xd4,0xa8,0x30,0x37,0x73,0x70,0x7b,0x00,0x5c,0xcc,
+0xc2,0x8b,0x00,0x00,0x06,0x44,0x96,0x60,0x00,0x7b,0x3a,0x00,0xa2,0x96,0x00,0xf4,
+0x1d,0x85,0x70,0xb0,0x00,0x79,0xda,0xa3,0xea,0xa5,0x12,0x82,0x67,0x60,0xb0,0x1b,
+0x9a,0x5d,0xa1,0x90,0x04,0xa9,0x13,0xb6,0x60,0x05,0xec,0x50,0x6e,0x10,0x78,0x92,
+0x80,0x5d,0x00,0x10,0x82,0x03,0xc8,0x90,0x07,0xc1,0x5b,0x10,0x85,0xca,0x01,0xf1,
+0x4d,0x40,0x00,0x0e,0x9a,0xb0,0xc0,0x00,0x0b,0x00,0xb3,0xc7,0x76,0x0d,0x99,0xba,
+0x94,0xd4,0x0b,0x00,0xdd,0xb1,0xc0,0x0d,0x88,0xd2,0xb7,0x70,0x0e,0x9a,0xb0,0x4e,
+0x10,0x06,0x36,0x20,0x9e,0x40,0x2c,0x01,0xaa,0x81,0xc6,0x22,0x00,0x14,0x00,0x05,
+0x14,0xc3,0x82,0xb0,0x00,0x02,0xb7,0x84,0xeb,0xb6,0x7a,0xcd,0xac,0x60,0xc0,0x07,
+0xda,0x8a,0xb3,0x90,0x4c,0x4b,0x11,0xb8,0x50,0x31,0xa5,0x51,0x6e,0x00,0x8b,0xd8,
+0x60,0x8d,0x00,0x00,0x90,0x07,0xa7,0x90,0x07,0xb0,0x78,0x00,0x86,0x61,0x00,0xf0,
+0x4e,0x18,0xab,0x81,0xb0,0x00,0x06,0x9a,0x75,0xd9,0xe6,0x0b,0x9b,0xc5,0x99,0x50,
+0x01,0xcc,0x40,0x6f,0x30,0x1b,0x56,0x59,0x81,0xb7,0x06,0x99,0x89,0x88,0x81,0x01,
+0x52,0x5d,0xbb,0x40,0x00,0xa0,0x46,0x00,0x00,0x2a,0xea,0xbc,0xaa,0xa7,0x05,0x5b,
+0x63,0x43,0x00,0x3d,0x6c,0x99,0x8b,0xa5,0x0a,0x9d,0xb5,0xb0,0xa0,0x09,0x8c,0x88,
+0xd5,0x90,0x0c,0x7b,0x7a,0x2c,0x50,0x18,0xba,0x82,0x0d,0x00,0x05,0xa2,0x90,0x2d,
+0x40,0x03,0xbc,0x91,0xa1,0xb3,0x36,0x10,0x22,0x10,0x12,0x00,0x00,0x33,0x61,0x00,
+0x10,0x2b,0x58,0x02,0x50,0xbd,0xbb,0xb8,0x00,0x75,0xbb,0x08,0x70,0x0c,0x00,0x67,
+0x00,0x00,0x05,0x92,0xac,0x03,0xf2,0x03,0x9d,0x20,0x00,0x00,0x05,0xc9,0xa1,0x00,
+0x06,0xc9,0x00,0x4c,0x93,0x17,0x10,0x00,0x00,0x34,0xf3,0x00,0xf3,0x1b,0x79,0x01,
+0x20,0xb0,0x07,0x84,0xa2,0x95,0xb0,0x8d,0xaa,0x72,0x01,0xb0,0x00,0x73,0x06,0x90,
+0xb0,0x5a,0xdc,0xa0,0x42,0xb0,0x06,0x75,0x41,0x47,0xe8,0x2a,0x74,0xa8,0x74,0xb0,
+0x74,0x73,0x61,0x00,0xb0,0x05,0xc1,0x00,0xf5,0x05,0xf5,0x1e,0x0a,0x05,0x52,0x7a,
+0x91,0x6e,0xac,0xca,0x20,0x00,0x0b,0x6a,0x59,0x00,0x00,0x0b,0x27,0x59,0xbe,0xb6,
+0x0c,0x9b,0x59,0x09,0x10,0x1b,0x16,0x6a,0x09,0x10,0x7a,0x9a,0x8b,0x09,0x10,0x1b,
+0x0a,0x48,0x09,0x10,0x63,0x01,0xa1,0x09,0x10,0xcd,0x09,0xf0,0x1f,0x40,0x38,0xca,
+0x84,0xa9,0x60,0x08,0x16,0x57,0x40,0x00,0x29,0x6b,0x57,0x73,0x32,0x25,0xa7,0x58,
+0xa8,0xd4,0x49,0xca,0x98,0x40,0xa0,0x05,0x75,0x28,0x30,0xa0,0x1a,0x75,0x8a,0x10,
+0xa0,0x64,0x73,0x7c,0x00,0xa0,0x02,0xb1,0x36,0x00,0xa0,0xf2,0x50,0x00,0x00,0x00,
+0x02,0x0a,0x73,0x73,0x49,0x71,0xbb,0x5b,0x59,0x00,0x0b,0xa8,0xa9,0x92,0x21,0xd9,
+0x99,0x9a,0x7c,0x4a,0x62,0x72,0x90,0xa0,0xbb,0x7b,0x59,0x0a,0x0b,0xb7,0xb7,0xa0,
+0xa0,0xda,0xba,0x88,0x0a,0x00,0x00,0x01,0x30,0xa0,0x00,0x00,0x22,0x00,0x00,0x00,
+0x00,0x2a,0x00,0x00,0x0b,0xbb,0xbd,0xbb,0xb6,0x00,0x07,0x40,0x00,0x00,0x00,0x09,
+0x51,0x11,0x00,0x00,0x0b,0xa9,0x9c,0x40,0x00,0x0b,0x00,0x08,0x30,0x00,0x67,0x00,
+0x09,0x10,0x03,0xc1,0x00,0x0c,0x00,0x1c,0x20,0x0b,0xb8,0x00,0x01,0x00,0xf1,0x22,
+0x30,0x00,0x03,0x00,0x00,0xa2,0x00,0x79,0x00,0x2b,0xcb,0x81,0xc9,0x40,0x04,0x70,
 0x1c,0x30,0xb5,0x04,0xda,0x84,0x50,0x05,0x05,0x55,0x60,0x4c,0x10,0x06,0x36,0x50,
-0x02,0x00,0x09,0x17,0x42,0x30,0x00,0x0b,0x08,0x21,0xa9,0x00,0x46,0x7c,0xbf,0x0a,
-0x11,0x00,0xed,0x38,0x10,0x03,0x4f,0x33,0xf2,0x1b,0x1b,0x11,0x10,0x8b,0xda,0xaa,
-0x99,0x93,0x0a,0x00,0xc5,0x55,0x50,0x0b,0xb9,0x15,0xc5,0xc0,0x0a,0x0b,0x25,0xa0,
-0x40,0x0a,0x0b,0x46,0xaa,0x90,0x0a,0x0b,0x68,0xa0,0x00,0x45,0x0a,0xaa,0xc0,0x00,
-0x92,0xb7,0x71,0xa9,0x75,0x08,0x41,0xbb,0xbb,0xbb,0x8b,0x0e,0x2b,0x60,0x00,0xbc,
-0x00,0x00,0x1b,0xeb,0x1d,0x23,0x01,0x0e,0x00,0x40,0xbe,0xbb,0xbb,0xcb,0x1e,0x10,
-0xf1,0x18,0xea,0xe0,0xcb,0xbe,0x1b,0x0b,0x0b,0x00,0x91,0xb0,0xb0,0xb6,0x6c,0x1e,
-0xae,0x0b,0x55,0xb1,0xb0,0xb0,0xc2,0x2a,0x1e,0xae,0x0c,0x66,0xc1,0x90,0x02,0x70,
-0x09,0x10,0x00,0xa2,0x00,0x91,0x00,0x56,0x00,0xde,0x26,0x00,0x70,0x21,0xf1,0x11,
-0x9a,0x80,0x01,0xd7,0x77,0x79,0x80,0x01,0xa1,0x11,0x14,0x80,0x00,0xb9,0x99,0x99,
-0x50,0x01,0xe2,0x27,0x11,0x10,0x0b,0x76,0x8c,0x66,0x60,0x02,0x89,0xad,0x99,0x40,
-0xe3,0x0a,0xf0,0x20,0x1a,0xaa,0xbd,0xaa,0xa6,0x77,0x40,0x0a,0x00,0x0b,0x1a,0x5b,
-0xea,0xb0,0xa0,0xa6,0x3a,0x0a,0x0d,0x9a,0x63,0xb0,0xa0,0xa0,0xbd,0xce,0xae,0x6a,
-0x0a,0x01,0xe7,0x00,0xea,0x90,0x75,0xb0,0x07,0x00,0x6a,0x04,0xb1,0x00,0x27,0x00,
-0x04,0x50,0x02,0xbf,0x0d,0x02,0x05,0x00,0x40,0xa3,0x33,0x38,0x40,0x87,0x34,0x11,
-0x10,0x42,0x00,0x30,0x00,0x92,0x28,0x4f,0x37,0xd2,0x2d,0xaa,0x70,0x06,0x8b,0x48,
-0x00,0x00,0x2a,0x03,0xac,0xba,0xa7,0x10,0x23,0x10,0xc0,0x67,0x5c,0xf0,0x0e,0x6a,
-0xea,0xa1,0xa0,0xb3,0x3c,0x33,0x1e,0xac,0x66,0x6a,0x94,0xa0,0xa7,0x77,0xaa,0x3a,
-0x0a,0x45,0x38,0x71,0xea,0xa0,0xb0,0x65,0x03,0x00,0x02,0x06,0xf6,0x1b,0x13,0xc3,
-0xfd,0x19,0xf0,0x04,0x29,0x00,0x58,0x00,0x07,0xba,0xdb,0xda,0xb1,0x00,0xb2,0x82,
-0x87,0x30,0x29,0xbb,0xdb,0xdc,0x96,0x65,0x00,0x60,0x20,0x00,0xc3,0x33,0x38,0x50,
-0xe5,0x21,0x10,0x50,0xa8,0x1b,0x02,0x0a,0x00,0xf3,0x40,0x07,0x98,0x88,0x8d,0x00,
-0x07,0x97,0x77,0x7d,0x00,0x06,0x98,0xa8,0x8a,0x00,0x69,0x99,0xea,0x99,0x91,0x01,
-0x77,0x77,0x76,0x00,0x04,0x71,0x11,0x1b,0x00,0x02,0x98,0xc9,0x87,0x00,0x04,0xb1,
-0x92,0x89,0x10,0x57,0x07,0xc1,0x02,0x90,0x27,0xb9,0x76,0x95,0x20,0x1c,0xba,0xb6,
-0x40,0x00,0x1b,0xb9,0xb7,0xbc,0xb4,0x3a,0xdb,0xaa,0x17,0x30,0x00,0x73,0x0b,0x07,
-0x30,0x00,0xa7,0x77,0x7a,0x00,0x00,0xd8,0x88,0x8e,0xcb,0x0b,0x00,0x9b,0x0f,0x00,
-0xab,0x0c,0x80,0x99,0xe9,0x9e,0x99,0xb1,0xc1,0x1c,0x1c,0x2a,0x21,0x40,0xeb,0xeb,
-0xbe,0xbe,0x08,0x00,0x04,0x0c,0x00,0x00,0x2c,0x21,0xe1,0x1a,0xaa,0xbe,0xaa,0xa5,
-0x01,0x88,0x9d,0x88,0x70,0x02,0x91,0x2a,0x11,0xdb,0x21,0x40,0xd0,0x02,0x80,0x1a,
-0xf1,0x33,0x50,0xbc,0x99,0x80,0x00,0x67,0xd4,0x01,0x92,0x1e,0xe4,0x00,0x00,0x1b,
-0xa4,0x17,0xbb,0xb8,0xa0,0x05,0xff,0x09,0x78,0x22,0x3c,0x31,0x03,0x88,0x32,0x4c,
-0x41,0x19,0xec,0x87,0xcf,0xa6,0x03,0xaa,0x54,0xb3,0xa0,0x19,0x77,0x8c,0x76,0x57,
-0xdd,0x00,0x01,0x71,0x06,0xa8,0x88,0x8d,0x00,0x06,0xa7,0xdd,0x00,0xf3,0x12,0x88,
-0x8c,0x00,0x69,0x99,0x99,0x99,0x92,0x0b,0x47,0x85,0x55,0x40,0x0b,0x47,0x8a,0x66,
-0xa0,0x0b,0x8a,0x71,0xab,0x20,0x4d,0x9c,0xd2,0xcc,0x20,0x33,0x14,0x9a,0x22,0xb2,
-0x32,0x1c,0x14,0xa0,0x32,0x1c,0xf0,0x01,0x2d,0x33,0x33,0x10,0x01,0xcb,0x66,0x69,
-0x60,0x1c,0x6d,0xaa,0xac,0x60,0x02,0x38,0x21,0x23,0x10,0x3d,0x2b,0x23,0x01,0x0a,
-0x00,0xf3,0x1c,0x38,0x00,0x9c,0x40,0x0a,0x05,0x56,0xca,0xe7,0xea,0xcc,0x73,0x0b,
-0x0b,0x7a,0x56,0xa8,0xe0,0xb1,0x65,0x65,0x1b,0x0c,0x9b,0x57,0x63,0xc1,0xb1,0x66,
-0x8a,0x8e,0x7a,0x99,0x8b,0x00,0xb1,0xc1,0xa2,0xc0,0x0b,0x84,0x02,0x77,0xc9,0x30,
-0x00,0x29,0x02,0x53,0x04,0xbb,0xce,0xbb,0xa0,0x1b,0x0d,0x10,0x39,0x38,0x02,0x50,
-0xef,0xba,0xa6,0x00,0x06,0xc8,0x25,0xc0,0x6a,0x29,0x4b,0x10,0x1b,0x80,0x29,0x03,
-0xc5,0x03,0x00,0x29,0x30,0x03,0x13,0x29,0x45,0x41,0xf7,0x0a,0x1a,0xab,0xee,0xda,
-0xa6,0x00,0x09,0x69,0xb1,0x00,0x00,0x39,0x29,0x3a,0x00,0x03,0xc1,0x29,0x09,0x90,
-0x2d,0x8b,0xce,0xbb,0x99,0x61,0x0d,0xf2,0x1d,0xb0,0x79,0x97,0x50,0x3a,0xe9,0xa0,
-0x00,0x00,0x03,0xd0,0xaa,0xaa,0xa0,0x07,0xd7,0xb8,0x30,0xc0,0x08,0xb5,0xb3,0x94,
-0x90,0x56,0xb0,0xb0,0xcb,0x20,0x40,0xb0,0xa0,0x7b,0x00,0x00,0xb5,0x65,0xc9,0x60,
-0x00,0xb9,0x5a,0x00,0x76,0xca,0x0e,0xf0,0x42,0xda,0xbd,0xab,0xa0,0x02,0x90,0x29,
-0x01,0xa0,0x02,0xd9,0xad,0x9a,0xa0,0x02,0xc6,0x7c,0x67,0xa0,0x00,0x33,0x5b,0x33,
-0x20,0x1a,0xab,0xff,0xda,0xa6,0x00,0x0a,0x7a,0xa4,0x00,0x06,0xb3,0x29,0x08,0xa3,
-0x16,0x00,0x29,0x00,0x25,0x00,0xb0,0x9a,0xeb,0xa9,0x18,0xd7,0x00,0xa0,0x00,0x04,
-0xe3,0x8a,0xeb,0xa8,0x04,0xf5,0xa0,0xb0,0x0b,0x08,0xb8,0xa0,0xc9,0x0b,0x19,0xb0,
-0xa4,0x78,0x5b,0x23,0xb0,0xa7,0x00,0x7b,0x00,0xb0,0x94,0x24,0x33,0xb0,0xa0,0x06,
-0xf3,0x03,0x00,0x1c,0x18,0x02,0x4b,0x00,0xf0,0x01,0x1b,0x48,0x85,0x00,0x07,0x91,
-0x28,0x05,0x82,0x12,0x89,0x88,0x8d,0x02,0x00,0x88,0x22,0x11,0x44,0x89,0x88,0x8d,
-0x00,0xdf,0x19,0x22,0xaa,0xa5,0x0b,0x00,0x11,0xa0,0xf6,0x21,0xf0,0x0c,0x8a,0xcb,
-0xa6,0x1a,0xe9,0x07,0x05,0x20,0x04,0xf1,0x56,0x00,0xb1,0x08,0xc9,0x79,0x07,0x64,
-0x19,0xa3,0x05,0x6b,0x00,0x63,0xa0,0x00,0xe6,0x89,0x3a,0x78,0x8c,0x50,0x00,0xa0,
-0xb4,0x01,0x87,0xed,0x1f,0xf0,0x10,0x0a,0x54,0x40,0x3a,0xe9,0x7c,0x25,0xc0,0x02,
-0xf2,0x65,0x9c,0x20,0x06,0xea,0x07,0xcb,0x30,0x0a,0xb7,0xc5,0x01,0x99,0x47,0xb0,
-0x7b,0xaa,0xc0,0x20,0xb0,0x73,0x93,0x0d,0x10,0x7b,0x76,0x2c,0x24,0x73,0x00,0x2f,
-0x0d,0xf0,0x1a,0xca,0xaa,0xa4,0x01,0xb1,0x90,0x00,0x00,0x39,0xe8,0x98,0xbc,0xa2,
-0x03,0xf4,0x90,0x37,0x00,0x09,0xb8,0x96,0xbc,0x90,0x38,0xb0,0x90,0x37,0x00,0x20,
-0xb0,0x98,0x88,0x82,0x00,0xb0,0xc9,0x99,0x95,0x00,0xb0,0x11,0x34,0x39,0x10,0x22,
-0xe1,0x1c,0xf0,0x36,0xbd,0x99,0x94,0x08,0x00,0x90,0x00,0x35,0x19,0x9e,0xa9,0xbc,
-0x95,0x00,0x7b,0x54,0xb1,0x00,0x03,0x59,0xc9,0xa9,0x60,0x1c,0xa9,0x9b,0x88,0xb5,
-0x01,0x17,0xcc,0xb2,0x11,0x03,0xa8,0x28,0x3c,0x61,0x2a,0x20,0x28,0x00,0x68,0x00,
-0xa0,0xa9,0x99,0xe0,0x00,0xb0,0xa5,0x44,0xc0,0x4b,0xe9,0xa4,0x44,0xc0,0x05,0xd0,
-0x78,0x88,0xa0,0x08,0xc8,0xaa,0xba,0xa2,0x37,0x09,0x2d,0x57,0x60,0xa3,0xaa,0xea,
-0xa5,0xa6,0x14,0x02,0x1e,0x05,0xf2,0x21,0x01,0x10,0x00,0x01,0xa0,0x0a,0x97,0x40,
-0x07,0x3a,0x7c,0x2a,0x50,0x1e,0x0a,0x54,0xb9,0x00,0x9e,0x0a,0x2a,0x9b,0x50,0x4a,
-0x0a,0x71,0x90,0x62,0x0a,0x0a,0x89,0xe9,0x90,0x0a,0x0a,0x63,0xa4,0x40,0x0a,0x02,
-0xb0,0xa0,0xb1,0x0a,0x01,0x18,0x90,0x10,0x79,0x09,0xf0,0x1a,0x26,0xaa,0xaf,0x60,
-0x4c,0xa0,0x02,0xb5,0x00,0x1a,0x67,0x97,0x69,0x90,0x0c,0xa7,0x77,0x52,0x80,0x2e,
-0x88,0x77,0x3b,0x50,0x99,0x29,0xc7,0x3b,0x80,0x37,0x23,0x4a,0x82,0x60,0x07,0x48,
-0xaa,0x88,0x82,0x07,0x31,0xc8,0x00,0xf3,0xd6,0x30,0x23,0x01,0x20,0x05,0x43,0xbb,
-0x37,0x20,0x0a,0x86,0x63,0x8a,0x83,0x07,0x84,0xba,0x98,0x90,0x08,0x78,0x74,0x69,
-0x44,0x09,0x68,0x9a,0x6b,0x87,0x29,0x9a,0xde,0xa9,0x96,0x00,0x09,0xaa,0xa2,0x00,
-0x06,0xb3,0x47,0x1a,0x93,0x16,0x00,0x47,0x00,0x35,0x00,0xa0,0x9a,0xdd,0xa9,0x03,
-0xb3,0x69,0xcc,0x96,0x27,0xe6,0xa0,0x88,0x0a,0x04,0xf1,0x89,0xaa,0x98,0x08,0xb9,
-0x27,0x77,0x73,0x28,0xa1,0x88,0x88,0x88,0x31,0xa0,0x15,0x65,0x60,0x00,0xa0,0xa2,
-0x55,0x67,0x00,0xa2,0x34,0xb2,0x06,0x00,0xb1,0x6d,0x6d,0x72,0x2a,0xe7,0x0b,0x0b,
-0x00,0x02,0xc0,0x97,0x47,0xa0,0x06,0xf4,0xb8,0x88,0xc0,0x0a,0xb9,0xb6,0x66,0xc0,
-0x29,0xb0,0x12,0xa2,0x20,0x32,0xb3,0x9b,0xec,0x94,0x00,0xb0,0x1b,0x1a,0x20,0x00,
-0xb5,0xa3,0x01,0xa5,0x00,0xa0,0x08,0x06,0x30,0x00,0xa0,0x78,0xd8,0x83,0x29,0xe8,
-0x37,0xd7,0x70,0x04,0xf2,0x9a,0xd9,0x94,0x08,0xb9,0x13,0xa9,0x00,0x19,0xa2,0x26,
-0xd1,0x81,0x52,0xa1,0x8b,0xbc,0x40,0x00,0xa0,0x84,0xb4,0x90,0x00,0xa3,0x46,0xb0,
-0x35,0x06,0x30,0x70,0x83,0x40,0x5c,0xb7,0x97,0xab,0xb1,0x09,0x41,0x94,0xa4,0x82,
-0x0d,0x98,0xbb,0xac,0x97,0x1d,0xb2,0x82,0xa2,0x90,0x78,0x37,0xe9,0xca,0xb5,0x46,
-0x32,0xd6,0x49,0x90,0x06,0x39,0x25,0x5f,0x15,0x06,0x76,0x07,0x63,0xb7,0xe0,0x01,
-0xf3,0x1c,0x3b,0x3c,0x31,0x00,0xb1,0x5c,0x5c,0x52,0x3a,0xe9,0x07,0x99,0x00,0x05,
-0xd2,0x88,0xc8,0x83,0x09,0xd9,0xb8,0xc8,0xc0,0x28,0xb2,0xb7,0xc7,0xc0,0x31,0xb0,
-0xb8,0xc8,0xd0,0x00,0xb0,0x39,0x08,0x50,0x00,0xb6,0xa1,0x00,0xa4,0x7b,0x02,0xf0,
-0x14,0x62,0xa0,0x81,0x00,0xa0,0x9b,0xd8,0xd6,0x2b,0xe9,0x85,0x55,0x59,0x03,0xe0,
-0x27,0x00,0xc0,0x07,0xc8,0x18,0x88,0x80,0x19,0xa2,0xb9,0xc9,0x98,0x32,0xa0,0xc8,
-0xd8,0x99,0x00,0xa0,0x11,0x23,0x21,0xa0,0xc9,0x52,0x3a,0x04,0x81,0x19,0xf2,0x1d,
-0x20,0x08,0xc1,0x00,0x29,0x62,0xa7,0x1a,0x71,0x3c,0x77,0x48,0x87,0x34,0x0d,0x84,
-0x9a,0x49,0xa0,0x2c,0x96,0x48,0x53,0x90,0x88,0x33,0x99,0x39,0x80,0x36,0x20,0xb2,
-0x0c,0x00,0x06,0x25,0x9b,0x4b,0x90,0x06,0x68,0x01,0xa0,0x44,0xbe,0x0a,0xf0,0x19,
-0x0c,0x8a,0x98,0xc2,0xb3,0xc8,0xa9,0x8c,0x3c,0x5c,0x89,0x98,0xc0,0xd6,0x95,0x88,
-0x59,0x2f,0x69,0x59,0xa6,0x98,0xb0,0x97,0x77,0x79,0x69,0x09,0x4d,0xc4,0x90,0x90,
-0x97,0x78,0x69,0x09,0x09,0x02,0x22,0xa0,0x9b,0x1e,0xf0,0x18,0x0e,0xaa,0xa5,0xb0,
-0x00,0xa5,0x78,0x0e,0xab,0x6a,0x80,0x94,0x81,0x55,0xa6,0x79,0x61,0xb5,0x0a,0x85,
-0x84,0x0d,0x00,0xa6,0x84,0x63,0xf3,0x0a,0x96,0x85,0x85,0xa0,0xd9,0x99,0x9a,0x08,
-0x70,0x00,0x03,0x2a,0x04,0x10,0x1a,0x9d,0x07,0x51,0x1a,0x00,0x00,0x04,0x70,0x05,
-0x00,0x33,0x1e,0xbb,0xb0,0x0a,0x00,0x04,0x05,0x00,0x34,0x7c,0xda,0xbe,0x66,0x19,
-0x20,0xbb,0xbb,0x0a,0x0b,0x01,0x3f,0x28,0x02,0x89,0x1d,0x00,0x05,0x00,0x54,0x0e,
-0xbb,0x80,0x00,0xb0,0x0f,0x00,0x52,0x29,0xe9,0xae,0x99,0x96,0xc5,0x3c,0x10,0x0b,
-0x70,0x12,0x10,0x0b,0x2a,0x30,0xb0,0x0b,0x10,0xc1,0xa2,0x0b,0x0d,0xa3,0xeb,0x30,
-0x0b,0x0b,0x6d,0x3f,0x02,0x14,0x00,0xe2,0x00,0xc0,0x05,0x0b,0x0c,0x52,0xc0,0x0a,
-0x4e,0xca,0x72,0xbb,0xc5,0x10,0xd7,0x09,0xe0,0x57,0x11,0x00,0x00,0xb0,0x5c,0x99,
-0x40,0x12,0xb1,0x77,0x11,0x10,0x59,0x1b,0x20,0xd0,0x00,0x93,0x75,0x06,0x40,0x07,
-0x80,0x75,0x3b,0x00,0x17,0x00,0x5a,0x0d,0x23,0x50,0xc7,0x00,0x00,0x5b,0x84,0x41,
-0x09,0x10,0xcd,0x43,0x3a,0x10,0x83,0x08,0x03,0xf0,0x01,0xe9,0x93,0xb0,0x72,0x08,
-0x51,0x92,0xc9,0x70,0x2a,0x80,0xc0,0xe4,0x00,0x00,0x6c,0xc7,0x28,0xd2,0x0d,0x10,
-0xb0,0x03,0x00,0xb4,0x00,0xc0,0x0a,0x1c,0x40,0x00,0xbb,0xdc,0x01,0xf1,0x1a,0x6d,
-0xba,0x56,0xb0,0x00,0x0a,0x10,0x7b,0xd8,0x80,0x0d,0xab,0xb2,0xb2,0x20,0x47,0x0c,
-0x40,0xb0,0x00,0xa8,0x69,0xab,0xfd,0xa3,0x11,0xc3,0x0a,0xda,0x00,0x01,0xb0,0x76,
-0xb4,0x90,0x0a,0x38,0x70,0xb0,0x74,0x65,0x42,0x09,0x10,0x04,0x26,0x03,0x50,0xa7,
-0x1a,0xae,0x00,0x0b,0xac,0x00,0xf0,0x00,0x0c,0xaa,0x2a,0x0a,0x20,0x0b,0x00,0x73,
-0x03,0x72,0x0c,0xaa,0x5c,0xab,0x70,0xd6,0x63,0xf7,0x01,0x40,0x4e,0xbb,0x33,0xab,
-0x00,0x2c,0x00,0x03,0xea,0x10,0x0b,0x00,0xaa,0x14,0xc2,0x2f,0x19,0x13,0x00,0x5b,
-0x31,0xa0,0x10,0x0c,0x11,0x0c,0x08,0x90,0x0c,0xaa,0x4c,0xb7,0x0f,0x00,0x16,0x20,
-0x19,0x00,0xa4,0xa0,0x0c,0x38,0x5c,0x00,0xb0,0x0e,0x94,0x08,0xbb,0x48,0x13,0x03,
-0x8d,0x05,0xf0,0x17,0x30,0x0b,0xbc,0x4d,0x08,0x80,0x00,0x0c,0x2f,0xa9,0x00,0x00,
-0x3a,0x2a,0xb1,0x00,0x00,0xa3,0x29,0x2b,0x00,0x07,0xa0,0x29,0x06,0xc1,0x1b,0x00,
-0x29,0x00,0x59,0x00,0x06,0xc6,0x00,0x00,0x09,0x60,0xa0,0x00,0xf0,0x01,0x60,0xb0,
-0xb0,0x40,0x11,0x00,0xb2,0xda,0xd0,0x19,0x67,0xe7,0xc0,0xb0,0x00,0x02,0x76,0x3a,
-0xf1,0x0d,0xa0,0xb0,0xb7,0xb0,0x02,0x90,0xb0,0xa0,0x00,0x0a,0x20,0xb0,0x00,0x46,
-0x09,0x00,0xab,0xaa,0xc2,0x04,0x00,0x15,0x00,0x00,0x05,0xc0,0x6d,0xaa,0xfa,0x3e,
-0xd0,0xb0,0x46,0x03,0xb0,0x00,0xb0,0x07,0x6a,0x20,0x7b,0x40,0x00,0x04,0xd7,0x16,
-0xf2,0x04,0xa0,0x67,0x08,0x60,0x04,0x70,0x09,0x9a,0x00,0x0c,0x01,0x7c,0xab,0x50,
-0x04,0x09,0x60,0x01,0x74,0x23,0x22,0x10,0x60,0xf9,0x08,0xf0,0x1a,0x30,0xb0,0x0b,
-0x00,0x41,0x03,0xa0,0x0d,0x62,0x2b,0x4a,0x10,0x02,0x41,0x00,0x09,0xdb,0xbd,0x80,
-0x01,0x90,0xa0,0x0c,0x10,0x08,0x30,0x1b,0xb3,0x00,0x2b,0x04,0xaa,0xba,0x40,0x22,
-0x38,0x10,0x02,0x83,0x07,0x70,0x91,0x00,0x10,0x43,0x39,0x25,0xa0,0x01,0xda,0xea,
-0xc4,0x07,0x81,0x90,0xb0,0x64,0x00,0x0a,0x00,0xf1,0x06,0x00,0x72,0x90,0xb0,0x74,
-0x02,0xa1,0x90,0xb0,0x64,0x0b,0x21,0xeb,0xeb,0xd4,0x03,0x01,0x90,0x00,0x64,0x01,
-0xed,0x0e,0xa0,0x90,0x6c,0xae,0x00,0x00,0x30,0x82,0x0b,0x00,0x34,0x36,0x02,0x70,
-0x07,0x69,0x50,0x05,0x93,0x00,0x00,0xd1,0x23,0x20,0xb1,0xb0,0x45,0x27,0xf0,0x11,
-0xb0,0x01,0xa0,0x1c,0x00,0xeb,0xbb,0xa0,0x02,0x00,0xb0,0x01,0xa0,0x08,0x60,0x03,
-0x70,0x00,0x00,0x24,0xbc,0xdb,0x80,0x42,0x00,0x03,0x70,0x00,0x2b,0x30,0x03,0x70,
-0xf1,0x1b,0xf0,0x09,0xcb,0xb1,0x00,0x80,0x1b,0x01,0x00,0x05,0x70,0x83,0x0b,0x00,
-0x0c,0x04,0xd6,0x8c,0x90,0x24,0x03,0x63,0x10,0x80,0x09,0x40,0x96,0x0a,0xf0,0x19,
-0x3a,0xbb,0xeb,0xd5,0x53,0x0a,0x00,0xa0,0xa0,0x08,0x2a,0xaa,0xea,0x70,0x00,0x0b,
-0x67,0x06,0x70,0x04,0x7a,0x0c,0x3d,0x10,0x0b,0x2a,0x03,0xf6,0x00,0x48,0x74,0x8b,
-0x5a,0xa2,0x11,0x42,0x50,0x00,0x33,0x04,0xe0,0x18,0x40,0x05,0xc1,0x01,0xb0,0xc5,
-0x14,0x40,0xca,0xa3,0x46,0x00,0xfb,0x07,0x01,0x5e,0x01,0x41,0x02,0xbb,0xeb,0xb0,
-0x65,0x05,0x20,0x02,0xa0,0xb8,0x1c,0x00,0xa9,0x2d,0x21,0x1b,0x0a,0x50,0x28,0x00,
-0x57,0x15,0x00,0x6e,0x25,0xf4,0x1c,0x03,0xb3,0xab,0x99,0x80,0x00,0x06,0xe3,0x07,
-0x80,0x17,0x06,0x1b,0x6b,0x00,0x06,0x90,0x2a,0xd8,0x20,0x00,0x08,0xa3,0x03,0xa7,
-0x00,0x66,0xda,0xaa,0xc0,0x01,0xb2,0x80,0x00,0xb0,0x0a,0x31,0xda,0xaa,0xd0,0x02,
-0x01,0x80,0x91,0x0b,0xf0,0x1a,0x60,0xb0,0xb0,0xa0,0x00,0x30,0xb0,0xb0,0xa0,0x21,
-0x03,0xb1,0xb2,0xa0,0x2b,0x49,0xb9,0xba,0xa0,0x00,0x37,0xb9,0xb7,0xe0,0x01,0x51,
-0xa1,0xb0,0xb0,0x07,0x42,0x80,0xb0,0xa0,0x0b,0x07,0x30,0xb0,0xa0,0x38,0x0a,0x10,
-0x07,0x02,0x35,0x3c,0x81,0x00,0x14,0x50,0x07,0xb3,0xab,0xd6,0x20,0xe3,0x06,0x92,
-0x54,0x09,0xaa,0xea,0xa4,0x09,0x50,0x01,0xa0,0xf2,0x06,0xf1,0x05,0x00,0x92,0xda,
-0xaa,0xb0,0x07,0x62,0x70,0x00,0xb0,0x2b,0x02,0xc8,0x88,0xb0,0x01,0x02,0x81,0x11,
-0xa0,0xc0,0x09,0xf3,0x1c,0x0b,0x40,0x04,0x70,0x00,0x00,0x59,0xbe,0xab,0xa3,0x43,
-0x00,0xa3,0x0a,0x40,0x18,0x48,0xa9,0x87,0xb1,0x00,0x01,0x74,0x47,0x10,0x00,0xa2,
-0x85,0x58,0x10,0x06,0x74,0x65,0x58,0x20,0x0d,0x1c,0x35,0x58,0x27,0x37,0x4a,0x00,
-0xc9,0x2a,0xf0,0x05,0x07,0x61,0x70,0xb0,0x54,0x00,0x40,0x82,0xb0,0xa0,0x27,0x00,
-0xbb,0xeb,0xb2,0x05,0x80,0xb0,0x00,0x82,0x6a,0x2c,0x40,0xd2,0x00,0x90,0xb0,0x69,
-0x0e,0xe1,0xea,0xaa,0xd2,0x09,0x40,0xb0,0x00,0x82,0x09,0x00,0xb0,0x0a,0xc1,0x01,
-0xe0,0x21,0xf0,0x06,0x7a,0xa9,0x9a,0xb0,0x00,0x2a,0x77,0x77,0xb0,0x30,0x0a,0x22,
-0x22,0xb0,0x3c,0x27,0xa9,0x9a,0x80,0x02,0x14,0xd2,0x23,0xf6,0x04,0x89,0xb8,0xb6,
-0x92,0x05,0x69,0x10,0xb4,0x00,0x0c,0x09,0x12,0xb0,0x08,0x46,0x0d,0xc8,0x8a,0xb5,
-0x54,0x31,0x51,0x05,0xb7,0xad,0xca,0xa3,0xc6,0x34,0x80,0x23,0x0b,0xbe,0xbb,0xb7,
-0x1a,0x40,0xa3,0xc7,0x40,0xf1,0x34,0x86,0x11,0xb4,0x01,0x76,0x59,0x42,0x73,0x07,
+0x02,0x00,0x09,0x17,0x42,0x30,0x00,0x0b,0x08,0x21,0xa9,0x00,0x46,0x7c,0x00,0x06,
+0x60,0x36,0x00,0xf1,0x23,0x01,0x10,0x03,0x00,0x00,0x03,0x90,0x1b,0x11,0x10,0x8b,
+0xda,0xaa,0x99,0x93,0x0a,0x00,0xc5,0x55,0x50,0x0b,0xb9,0x15,0xc5,0xc0,0x0a,0x0b,
+0x25,0xa0,0x40,0x0a,0x0b,0x46,0xaa,0x90,0x0a,0x0b,0x68,0xa0,0x00,0x45,0x0a,0xaa,
+0xc0,0x00,0x92,0xb7,0x71,0xa9,0xa3,0x37,0x00,0xf2,0x03,0xbb,0xbb,0xbb,0x8b,0x00,
+0x00,0x0b,0xb0,0x00,0x00,0xbc,0x00,0x00,0x1b,0xeb,0xbb,0xbb,0xbb,0x0e,0x00,0xf2,
+0x21,0xbe,0xbb,0xbb,0xcb,0xb0,0x00,0x00,0xa0,0xea,0xe0,0xcb,0xbe,0x1b,0x0b,0x0b,
+0x00,0x91,0xb0,0xb0,0xb6,0x6c,0x1e,0xae,0x0b,0x55,0xb1,0xb0,0xb0,0xc2,0x2a,0x1e,
+0xae,0x0c,0x66,0xc1,0x90,0x02,0x70,0x09,0x10,0x00,0xa2,0x00,0x91,0x00,0x56,0x00,
+0xbc,0x84,0x00,0xf2,0x4b,0xd9,0x99,0x9a,0x80,0x01,0xd7,0x77,0x79,0x80,0x01,0xa1,
+0x11,0x14,0x80,0x00,0xb9,0x99,0x99,0x50,0x01,0xe2,0x27,0x11,0x10,0x0b,0x76,0x8c,
+0x66,0x60,0x02,0x89,0xad,0x99,0x40,0x00,0x00,0x29,0x00,0x00,0x1a,0xaa,0xbd,0xaa,
+0xa6,0x77,0x40,0x0a,0x00,0x0b,0x1a,0x5b,0xea,0xb0,0xa0,0xa6,0x3a,0x0a,0x0d,0x9a,
+0x63,0xb0,0xa0,0xa0,0xbd,0xce,0xae,0x6a,0x0a,0x01,0xe7,0x00,0xea,0x90,0x75,0xb0,
+0x07,0x00,0x6a,0x04,0xb1,0x00,0x27,0x00,0x04,0x50,0x02,0xc8,0x88,0x8b,0x40,0x05,
+0x00,0x91,0xa3,0x33,0x38,0x40,0x00,0x55,0x55,0x55,0x10,0x42,0x00,0xf1,0x05,0x00,
+0x92,0x28,0x00,0x00,0x00,0xe2,0x2d,0xaa,0x70,0x06,0x8b,0x48,0x00,0x00,0x2a,0x03,
+0xac,0xba,0xa7,0x88,0x00,0xf1,0x19,0xea,0xc0,0x0b,0x00,0x0a,0x0a,0x6a,0xea,0xa1,
+0xa0,0xb3,0x3c,0x33,0x1e,0xac,0x66,0x6a,0x94,0xa0,0xa7,0x77,0xaa,0x3a,0x0a,0x45,
+0x38,0x71,0xea,0xa0,0xb0,0x65,0x03,0x00,0x02,0x06,0x50,0x00,0x00,0x08,0xc3,0xb4,
+0x00,0x00,0x92,0x00,0xf0,0x02,0x58,0x00,0x07,0xba,0xdb,0xda,0xb1,0x00,0xb2,0x82,
+0x87,0x30,0x29,0xbb,0xdb,0xdc,0x96,0x65,0x00,0xf2,0x00,0x20,0x00,0xc3,0x33,0x38,
+0x50,0x00,0xd9,0x99,0x9b,0x50,0x00,0xb0,0x00,0x06,0x0a,0x00,0xf0,0x5f,0x07,0x98,
+0x88,0x8d,0x00,0x07,0x97,0x77,0x7d,0x00,0x06,0x98,0xa8,0x8a,0x00,0x69,0x99,0xea,
+0x99,0x91,0x01,0x77,0x77,0x76,0x00,0x04,0x71,0x11,0x1b,0x00,0x02,0x98,0xc9,0x87,
+0x00,0x04,0xb1,0x92,0x89,0x10,0x57,0x07,0xc1,0x02,0x90,0x27,0xb9,0x76,0x95,0x20,
+0x1c,0xba,0xb6,0x40,0x00,0x1b,0xb9,0xb7,0xbc,0xb4,0x3a,0xdb,0xaa,0x17,0x30,0x00,
+0x73,0x0b,0x07,0x30,0x00,0xa7,0x77,0x7a,0x00,0x00,0xd8,0x88,0x8e,0x00,0x00,0xa0,
+0x00,0x0c,0x00,0x00,0xd9,0x99,0x9e,0x00,0x00,0xb0,0x0b,0x00,0x99,0xe9,0x9e,0x99,
+0xb1,0xc1,0x1c,0x1c,0xb0,0xb0,0x0b,0x0b,0xeb,0xeb,0xbe,0xbe,0x08,0x00,0x05,0x0c,
+0x00,0xf0,0x14,0x00,0x00,0x0b,0x1a,0xaa,0xbe,0xaa,0xa5,0x01,0x88,0x9d,0x88,0x70,
+0x02,0x91,0x2a,0x11,0xb0,0x02,0xc9,0xad,0x99,0xd0,0x02,0x80,0x1a,0x00,0xb0,0x01,
+0xc9,0xbc,0x99,0x80,0x00,0x67,0xd4,0x01,0x82,0x1e,0xe4,0x00,0x00,0x1b,0xa4,0x17,
+0xbb,0x4f,0x02,0xff,0x0a,0x03,0x78,0x22,0x3c,0x31,0x03,0x88,0x32,0x4c,0x41,0x19,
+0xec,0x87,0xcf,0xa6,0x03,0xaa,0x54,0xb3,0xa0,0x19,0x77,0x8c,0x76,0x57,0xdd,0x00,
+0x01,0x71,0x06,0xa8,0x88,0x8d,0x00,0x06,0xa7,0xdd,0x00,0xf0,0x15,0x88,0x8c,0x00,
+0x69,0x99,0x99,0x99,0x92,0x0b,0x47,0x85,0x55,0x40,0x0b,0x47,0x8a,0x66,0xa0,0x0b,
+0x8a,0x71,0xab,0x20,0x4d,0x9c,0xd2,0xcc,0x20,0x33,0x14,0x9a,0x22,0xb2,0x00,0x00,
+0x20,0x0f,0x03,0xf1,0x13,0xa0,0x00,0x00,0x1b,0xbe,0xbb,0xbb,0xb6,0x00,0x2d,0x33,
+0x33,0x10,0x01,0xcb,0x66,0x69,0x60,0x1c,0x6d,0xaa,0xac,0x60,0x02,0x38,0x00,0x04,
+0x60,0x00,0x3d,0xaa,0xac,0x60,0x00,0x0a,0x00,0xf1,0x1e,0x38,0x00,0x9c,0x40,0x0a,
+0x05,0x56,0xca,0xe7,0xea,0xcc,0x73,0x0b,0x0b,0x7a,0x56,0xa8,0xe0,0xb1,0x65,0x65,
+0x1b,0x0c,0x9b,0x57,0x63,0xc1,0xb1,0x66,0x8a,0x8e,0x7a,0x99,0x8b,0x00,0xb1,0xc1,
+0xa2,0xc0,0x0b,0x84,0x02,0x77,0x0a,0xc0,0x08,0x03,0x00,0x29,0x02,0x51,0x04,0xbb,
+0xce,0xbb,0xa0,0x0a,0x00,0x30,0x00,0x00,0x39,0x38,0x02,0xf3,0x08,0xef,0xba,0xa6,
+0x00,0x06,0xbc,0xb0,0x00,0x00,0x6a,0x29,0x4b,0x10,0x1b,0x80,0x29,0x03,0xc5,0x03,
+0x00,0x29,0x00,0x03,0x23,0x00,0xf3,0x0d,0x3a,0x00,0x00,0x1a,0xab,0xee,0xda,0xa6,
+0x00,0x09,0x69,0xb1,0x00,0x00,0x39,0x29,0x3a,0x00,0x03,0xc1,0x29,0x09,0x90,0x2d,
+0x8b,0xce,0xbb,0x99,0x23,0x00,0x00,0x05,0x00,0xf1,0x1d,0xb0,0x79,0x97,0x50,0x3a,
+0xe9,0xa0,0x00,0x00,0x03,0xd0,0xaa,0xaa,0xa0,0x07,0xd7,0xb8,0x30,0xc0,0x08,0xb5,
+0xb3,0x94,0x90,0x56,0xb0,0xb0,0xcb,0x20,0x40,0xb0,0xa0,0x7b,0x00,0x00,0xb5,0x65,
+0xc9,0x60,0x00,0xb9,0x5a,0x00,0x76,0x8a,0x00,0xf4,0x4a,0x02,0xda,0xbd,0xab,0xa0,
+0x02,0x90,0x29,0x01,0xa0,0x02,0xd9,0xad,0x9a,0xa0,0x02,0xc6,0x7c,0x67,0xa0,0x00,
+0x33,0x5b,0x33,0x20,0x1a,0xab,0xff,0xda,0xa6,0x00,0x0a,0x7a,0xa4,0x00,0x06,0xb3,
+0x29,0x08,0xa3,0x16,0x00,0x29,0x00,0x25,0x00,0xb0,0x9a,0xeb,0xa9,0x18,0xd7,0x00,
+0xa0,0x00,0x04,0xe3,0x8a,0xeb,0xa8,0x04,0xf5,0xa0,0xb0,0x0b,0x08,0xb8,0xa0,0xc9,
+0x0b,0x19,0xb0,0xa4,0x78,0x5b,0x23,0xb0,0xa7,0x00,0x7b,0x00,0xb0,0xa0,0x00,0x0b,
+0x00,0xb0,0xa0,0x06,0xf3,0x03,0x32,0x28,0x00,0x00,0x4b,0x00,0xf2,0x08,0x1b,0x48,
+0x85,0x00,0x07,0x91,0x28,0x05,0x82,0x12,0x89,0x88,0x8d,0x02,0x00,0x88,0x77,0x7d,
+0x00,0x00,0x89,0x88,0x8d,0x26,0x00,0x52,0x0a,0xaa,0xaa,0xaa,0xa5,0x0b,0x00,0xf6,
+0x1e,0xa0,0x00,0xb0,0x00,0x00,0xb0,0x8a,0xcb,0xa6,0x1a,0xe9,0x07,0x05,0x20,0x04,
+0xf1,0x56,0x00,0xb1,0x08,0xc9,0x79,0x07,0x64,0x19,0xa3,0x05,0x6b,0x00,0x63,0xa0,
+0x00,0xe6,0x00,0x00,0xa0,0x09,0x8c,0x50,0x00,0xa0,0xb4,0x01,0x87,0x00,0x01,0x00,
+0xf1,0x19,0xb0,0x0a,0x54,0x40,0x3a,0xe9,0x7c,0x25,0xc0,0x02,0xf2,0x65,0x9c,0x20,
+0x06,0xea,0x07,0xcb,0x30,0x0a,0xb7,0xc5,0x01,0x99,0x47,0xb0,0x7b,0xaa,0xc0,0x20,
+0xb0,0x73,0x00,0xb0,0x00,0xb0,0x7b,0xaa,0xd0,0x00,0x0a,0x00,0x02,0x32,0x00,0xf1,
+0x1c,0xca,0xaa,0xa4,0x01,0xb1,0x90,0x00,0x00,0x39,0xe8,0x98,0xbc,0xa2,0x03,0xf4,
+0x90,0x37,0x00,0x09,0xb8,0x96,0xbc,0x90,0x38,0xb0,0x90,0x37,0x00,0x20,0xb0,0x98,
+0x88,0x82,0x00,0xb0,0xc9,0x99,0x95,0x00,0xb0,0x11,0x11,0x10,0xf1,0x04,0xf2,0x41,
+0x09,0x99,0xbd,0x99,0x94,0x08,0x00,0x90,0x00,0x35,0x19,0x9e,0xa9,0xbc,0x95,0x00,
+0x7b,0x54,0xb1,0x00,0x03,0x59,0xc9,0xa9,0x60,0x1c,0xa9,0x9b,0x88,0xb5,0x01,0x17,
+0xcc,0xb2,0x11,0x03,0xa8,0x28,0x3c,0x61,0x2a,0x20,0x28,0x00,0x68,0x00,0xa0,0xa9,
+0x99,0xe0,0x00,0xb0,0xa5,0x44,0xc0,0x4b,0xe9,0xa4,0x44,0xc0,0x05,0xd0,0x78,0x88,
+0xa0,0x08,0xc8,0xaa,0xba,0xa2,0x37,0xa4,0x00,0xb0,0x00,0x60,0xa3,0xaa,0xea,0xa5,
+0xeb,0x00,0x01,0x05,0x00,0x02,0x1e,0x05,0xf1,0x21,0x01,0x10,0x00,0x01,0xa0,0x0a,
+0x97,0x40,0x07,0x3a,0x7c,0x2a,0x50,0x1e,0x0a,0x54,0xb9,0x00,0x9e,0x0a,0x2a,0x9b,
+0x50,0x4a,0x0a,0x71,0x90,0x62,0x0a,0x0a,0x89,0xe9,0x90,0x0a,0x0a,0x63,0xa4,0x40,
+0x0a,0x02,0xb0,0xa0,0xb1,0x0a,0x01,0x18,0x90,0x10,0x36,0x00,0xf0,0x1b,0x07,0x26,
+0xaa,0xaf,0x60,0x4c,0xa0,0x02,0xb5,0x00,0x1a,0x67,0x97,0x69,0x90,0x0c,0xa7,0x77,
+0x52,0x80,0x2e,0x88,0x77,0x3b,0x50,0x99,0x29,0xc7,0x3b,0x80,0x37,0x23,0x4a,0x82,
+0x60,0x07,0x48,0xaa,0x88,0x82,0x07,0x31,0xc8,0x00,0xf3,0xd6,0x30,0x23,0x01,0x20,
+0x05,0x43,0xbb,0x37,0x20,0x0a,0x86,0x63,0x8a,0x83,0x07,0x84,0xba,0x98,0x90,0x08,
+0x78,0x74,0x69,0x44,0x09,0x68,0x9a,0x6b,0x87,0x29,0x9a,0xde,0xa9,0x96,0x00,0x09,
+0xaa,0xa2,0x00,0x06,0xb3,0x47,0x1a,0x93,0x16,0x00,0x47,0x00,0x35,0x00,0xa0,0x9a,
+0xdd,0xa9,0x03,0xb3,0x69,0xcc,0x96,0x27,0xe6,0xa0,0x88,0x0a,0x04,0xf1,0x89,0xaa,
+0x98,0x08,0xb9,0x27,0x77,0x73,0x28,0xa1,0x88,0x88,0x88,0x31,0xa0,0x15,0x65,0x60,
+0x00,0xa0,0xa2,0x55,0x67,0x00,0xa2,0x34,0xb2,0x06,0x00,0xb1,0x6d,0x6d,0x72,0x2a,
+0xe7,0x0b,0x0b,0x00,0x02,0xc0,0x97,0x47,0xa0,0x06,0xf4,0xb8,0x88,0xc0,0x0a,0xb9,
+0xb6,0x66,0xc0,0x29,0xb0,0x12,0xa2,0x20,0x32,0xb3,0x9b,0xec,0x94,0x00,0xb0,0x1b,
+0x1a,0x20,0x00,0xb5,0xa3,0x01,0xa5,0x00,0xa0,0x08,0x06,0x30,0x00,0xa0,0x78,0xd8,
+0x83,0x29,0xe8,0x37,0xd7,0x70,0x04,0xf2,0x9a,0xd9,0x94,0x08,0xb9,0x13,0xa9,0x00,
+0x19,0xa2,0x26,0xd1,0x81,0x52,0xa1,0x8b,0xbc,0x40,0x00,0xa0,0x84,0xb4,0x90,0x00,
+0xa3,0x46,0xb0,0x35,0x06,0x30,0x70,0x83,0x40,0x5c,0xb7,0x97,0xab,0xb1,0x09,0x41,
+0x94,0xa4,0x82,0x0d,0x98,0xbb,0xac,0x97,0x1d,0xb2,0x82,0xa2,0x90,0x78,0x37,0xe9,
+0xca,0xb5,0x46,0x32,0xd6,0x49,0x90,0x06,0x39,0x25,0x5f,0x15,0x06,0x76,0x07,0x63,
+0xb7,0xe0,0x01,0xf3,0x1c,0x3b,0x3c,0x31,0x00,0xb1,0x5c,0x5c,0x52,0x3a,0xe9,0x07,
+0x99,0x00,0x05,0xd2,0x88,0xc8,0x83,0x09,0xd9,0xb8,0xc8,0xc0,0x28,0xb2,0xb7,0xc7,
+0xc0,0x31,0xb0,0xb8,0xc8,0xd0,0x00,0xb0,0x39,0x08,0x50,0x00,0xb6,0xa1,0x00,0xa4,
+0x7b,0x02,0xf6,0x1c,0x62,0xa0,0x81,0x00,0xa0,0x9b,0xd8,0xd6,0x2b,0xe9,0x85,0x55,
+0x59,0x03,0xe0,0x27,0x00,0xc0,0x07,0xc8,0x18,0x88,0x80,0x19,0xa2,0xb9,0xc9,0x98,
+0x32,0xa0,0xc8,0xd8,0x99,0x00,0xa0,0xa0,0xa0,0x19,0x00,0xa0,0xc9,0x99,0x99,0x7a,
+0x02,0xf1,0x1e,0x06,0x20,0x08,0xc1,0x00,0x29,0x62,0xa7,0x1a,0x71,0x3c,0x77,0x48,
+0x87,0x34,0x0d,0x84,0x9a,0x49,0xa0,0x2c,0x96,0x48,0x53,0x90,0x88,0x33,0x99,0x39,
+0x80,0x36,0x20,0xb2,0x0c,0x00,0x06,0x25,0x9b,0x4b,0x90,0x06,0x68,0x01,0xa0,0x44,
+0x32,0x00,0xf0,0x45,0x09,0x0c,0x8a,0x98,0xc2,0xb3,0xc8,0xa9,0x8c,0x3c,0x5c,0x89,
+0x98,0xc0,0xd6,0x95,0x88,0x59,0x2f,0x69,0x59,0xa6,0x98,0xb0,0x97,0x77,0x79,0x69,
+0x09,0x4d,0xc4,0x90,0x90,0x97,0x78,0x69,0x09,0x09,0x02,0x22,0xa0,0x00,0x00,0x04,
+0x10,0x0e,0xaa,0xa5,0xb0,0x00,0xa5,0x78,0x0e,0xab,0x6a,0x80,0x94,0x81,0x55,0xa6,
+0x79,0x61,0xb5,0x0a,0x85,0x84,0x0d,0x00,0xa6,0x84,0x63,0xf3,0x0a,0x96,0x85,0x85,
+0xa0,0xd9,0x99,0x9a,0x08,0x70,0x00,0x03,0x2a,0x04,0x10,0x1a,0x9d,0x07,0x51,0x1a,
+0x00,0x00,0x04,0x70,0x05,0x00,0x33,0x1e,0xbb,0xb0,0x0a,0x00,0x04,0x05,0x00,0x52,
+0x7c,0xda,0xbe,0xaa,0xa2,0x83,0x00,0x70,0xbb,0xbb,0xbb,0xb2,0x00,0x00,0x0b,0x77,
+0x02,0x10,0x0b,0x2d,0x01,0x01,0x05,0x00,0x54,0x0e,0xbb,0x80,0x00,0xb0,0x0f,0x00,
+0xf1,0x00,0x29,0xe9,0xae,0x99,0x96,0x01,0x11,0x11,0x11,0x11,0x00,0x0b,0x00,0xc0,
+0x00,0x05,0x00,0xf2,0x01,0x0b,0x0b,0x10,0xc1,0xa2,0x0b,0x0d,0xa3,0xeb,0x30,0x0b,
+0x0b,0x00,0xd0,0x00,0x0b,0x14,0x00,0xd2,0x00,0xc0,0x05,0x0b,0x0c,0x52,0xc0,0x0a,
+0x4e,0xca,0x72,0xbb,0xc5,0x96,0x02,0xf0,0x24,0x40,0x57,0x11,0x00,0x00,0xb0,0x5c,
+0x99,0x40,0x12,0xb1,0x77,0x11,0x10,0x59,0x99,0xcb,0x99,0x91,0x00,0x93,0x75,0x06,
+0x40,0x07,0x80,0x75,0x3b,0x00,0x17,0x00,0x5a,0xb1,0x00,0x00,0x38,0xc7,0x00,0x00,
+0x5b,0x84,0x00,0x00,0x00,0x2b,0xcd,0xbb,0xeb,0xb7,0x00,0x83,0x08,0x03,0xf2,0x12,
+0xe9,0x93,0xb0,0x72,0x08,0x51,0x92,0xc9,0x70,0x2a,0x80,0xc0,0xe4,0x00,0x00,0x6c,
+0x80,0xb0,0x00,0x00,0x0d,0x10,0xb0,0x03,0x00,0xb4,0x00,0xc0,0x0a,0x1c,0x40,0x00,
+0xbb,0xdc,0x01,0xf0,0x1b,0x6d,0xba,0x56,0xb0,0x00,0x0a,0x10,0x7b,0xd8,0x80,0x0d,
+0xab,0xb2,0xb2,0x20,0x47,0x0c,0x40,0xb0,0x00,0xa8,0x69,0xab,0xfd,0xa3,0x11,0xc3,
+0x0a,0xda,0x00,0x01,0xb0,0x76,0xb4,0x90,0x0a,0x38,0x70,0xb0,0x74,0x65,0x00,0x55,
+0x00,0x10,0x04,0x26,0x03,0x50,0xa7,0x1a,0xae,0x00,0x0b,0xac,0x00,0xf6,0x14,0x0c,
+0xaa,0x2a,0x0a,0x20,0x0b,0x00,0x73,0x03,0x72,0x0c,0xaa,0x5c,0xab,0x70,0x0b,0x00,
+0x0a,0x09,0x40,0x4e,0xbb,0x33,0xab,0x00,0x2c,0x00,0x03,0xea,0x10,0x0b,0x00,0xaa,
+0x14,0xc2,0xdc,0x01,0x32,0x0c,0x00,0x0c,0x05,0x00,0xa0,0x10,0x0c,0x11,0x0c,0x08,
+0x90,0x0c,0xaa,0x4c,0xb7,0x0f,0x00,0x16,0x20,0x19,0x00,0xb3,0xa0,0x0c,0x38,0x5c,
+0x00,0xb0,0x0e,0x94,0x08,0xbb,0x90,0x34,0x00,0x03,0x8d,0x05,0xf0,0x17,0x30,0x0b,
+0xbc,0x4d,0x08,0x80,0x00,0x0c,0x2f,0xa9,0x00,0x00,0x3a,0x2a,0xb1,0x00,0x00,0xa3,
+0x29,0x2b,0x00,0x07,0xa0,0x29,0x06,0xc1,0x1b,0x00,0x29,0x00,0x59,0x00,0x06,0xc6,
+0x00,0x00,0x09,0x60,0xa0,0x00,0xf1,0x4a,0x60,0xb0,0xb0,0x40,0x11,0x00,0xb2,0xda,
+0xd0,0x19,0x67,0xe7,0xc0,0xb0,0x00,0x02,0xb0,0xb0,0xb0,0x00,0xa0,0xb0,0xb7,0xb0,
+0x02,0x90,0xb0,0xa0,0x00,0x0a,0x20,0xb0,0x00,0x46,0x09,0x00,0xab,0xaa,0xc2,0x04,
+0x00,0x15,0x00,0x00,0x05,0xc0,0x6d,0xaa,0x90,0x00,0x00,0x92,0x00,0xb0,0x46,0x03,
+0xb0,0x00,0xb0,0x07,0x6a,0x20,0x7b,0x40,0x00,0x04,0xaa,0xaa,0x90,0x00,0xa0,0x67,
+0x08,0x60,0x04,0x70,0x09,0x9a,0x00,0x0c,0x01,0x7c,0xab,0x50,0x04,0x09,0x60,0x01,
+0x74,0x8f,0x00,0x20,0x1b,0x60,0xf9,0x08,0xf0,0x1a,0x30,0xb0,0x0b,0x00,0x41,0x03,
+0xa0,0x0d,0x62,0x2b,0x4a,0x10,0x02,0x41,0x00,0x09,0xdb,0xbd,0x80,0x01,0x90,0xa0,
+0x0c,0x10,0x08,0x30,0x1b,0xb3,0x00,0x2b,0x04,0xaa,0xba,0x40,0x22,0x38,0x10,0x02,
+0x83,0x07,0x70,0x91,0x00,0xf0,0x00,0x43,0x00,0xc0,0x00,0x02,0x01,0xda,0xea,0xc4,
+0x07,0x81,0x90,0xb0,0x64,0x00,0x0a,0x00,0xf0,0x06,0x00,0x72,0x90,0xb0,0x74,0x02,
+0xa1,0x90,0xb0,0x64,0x0b,0x21,0xeb,0xeb,0xd4,0x03,0x01,0x90,0x00,0x64,0x01,0x5f,
+0x00,0xb0,0x08,0x90,0x6c,0xae,0x00,0x00,0x30,0x82,0x0b,0x00,0x34,0x36,0x02,0x50,
+0x07,0x69,0x50,0x05,0x93,0x7c,0x09,0xf0,0x17,0x70,0x00,0xb1,0xb0,0x01,0xa0,0x05,
+0x70,0xb0,0x01,0xa0,0x1c,0x00,0xeb,0xbb,0xa0,0x02,0x00,0xb0,0x01,0xa0,0x08,0x60,
+0x03,0x70,0x00,0x00,0x24,0xbc,0xdb,0x80,0x42,0x00,0x03,0x70,0x00,0x2b,0x30,0x0f,
+0x00,0xf0,0x47,0x09,0xbe,0xcb,0xb1,0x00,0x80,0x1b,0x01,0x00,0x05,0x70,0x83,0x0b,
+0x00,0x0c,0x04,0xd6,0x8c,0x90,0x24,0x03,0x63,0x10,0x80,0x09,0x40,0x00,0xa0,0x00,
+0x00,0x3a,0xbb,0xeb,0xd5,0x53,0x0a,0x00,0xa0,0xa0,0x08,0x2a,0xaa,0xea,0x70,0x00,
+0x0b,0x67,0x06,0x70,0x04,0x7a,0x0c,0x3d,0x10,0x0b,0x2a,0x03,0xf6,0x00,0x48,0x74,
+0x8b,0x5a,0xa2,0x11,0x42,0x50,0x00,0x33,0x04,0x00,0x03,0x30,0x00,0x05,0xc1,0x01,
+0xb0,0x00,0x00,0x07,0xaa,0xca,0xa3,0x46,0x00,0xfb,0x07,0x01,0x5e,0x01,0x41,0x02,
+0xbb,0xeb,0xb0,0x65,0x05,0x10,0x02,0x05,0x00,0xa2,0x0a,0x30,0x00,0xb0,0x00,0x1b,
+0x0a,0xbb,0xeb,0xb6,0x44,0x08,0xf3,0x20,0x00,0x24,0x00,0x00,0x03,0xb3,0xab,0x99,
+0x80,0x00,0x06,0xe3,0x07,0x80,0x17,0x06,0x1b,0x6b,0x00,0x06,0x90,0x2a,0xd8,0x20,
+0x00,0x08,0xa3,0x03,0xa7,0x00,0x66,0xda,0xaa,0xc0,0x01,0xb2,0x80,0x00,0xb0,0x0a,
+0x31,0xda,0xaa,0xd0,0x02,0x01,0x80,0xac,0x05,0xf0,0x1b,0x0a,0x60,0xb0,0xb0,0xa0,
+0x00,0x30,0xb0,0xb0,0xa0,0x21,0x03,0xb1,0xb2,0xa0,0x2b,0x49,0xb9,0xba,0xa0,0x00,
+0x37,0xb9,0xb7,0xe0,0x01,0x51,0xa1,0xb0,0xb0,0x07,0x42,0x80,0xb0,0xa0,0x0b,0x07,
+0x30,0xb0,0xa0,0x38,0x0a,0x10,0x07,0x21,0x00,0x00,0x84,0x02,0x71,0x14,0x50,0x07,
+0xb3,0xab,0xd6,0x20,0xe3,0x06,0x92,0x54,0x09,0xaa,0xea,0xa4,0x09,0x50,0x01,0xa0,
+0xf2,0x06,0xf1,0x05,0x00,0x92,0xda,0xaa,0xb0,0x07,0x62,0x70,0x00,0xb0,0x2b,0x02,
+0xc8,0x88,0xb0,0x01,0x02,0x81,0x11,0xa0,0xc0,0x09,0xf2,0x1e,0x0b,0x40,0x04,0x70,
+0x00,0x00,0x59,0xbe,0xab,0xa3,0x43,0x00,0xa3,0x0a,0x40,0x18,0x48,0xa9,0x87,0xb1,
+0x00,0x01,0x74,0x47,0x10,0x00,0xa2,0x85,0x58,0x10,0x06,0x74,0x65,0x58,0x20,0x0d,
+0x1c,0x35,0x58,0x27,0x37,0x4a,0x00,0x06,0xb4,0x0f,0x06,0xf1,0x1d,0x61,0x70,0xb0,
+0x54,0x00,0x40,0x82,0xb0,0xa0,0x27,0x00,0xbb,0xeb,0xb2,0x05,0x80,0xb0,0x00,0x82,
+0x00,0x00,0xea,0xaa,0xd2,0x00,0x90,0xb0,0x00,0x82,0x01,0xa0,0xea,0xaa,0xd2,0x09,
+0x40,0xb0,0x00,0x82,0x09,0x00,0xb0,0x0a,0xc1,0xc2,0x01,0xf2,0x1e,0x1a,0x7a,0xa9,
+0x9a,0xb0,0x00,0x2a,0x77,0x77,0xb0,0x30,0x0a,0x22,0x22,0xb0,0x3c,0x27,0xa9,0x9a,
+0x80,0x02,0x14,0x00,0x40,0x00,0x00,0x89,0xb8,0xb6,0x92,0x05,0x69,0x10,0xb4,0x00,
+0x0c,0x09,0x12,0xb0,0x08,0x46,0x0d,0xc8,0x8a,0xb5,0x36,0x01,0x00,0x05,0x00,0xf2,
+0x4b,0x05,0xb7,0xad,0xca,0xa3,0x00,0x00,0x0a,0x20,0x00,0x23,0x0b,0xbe,0xbb,0xb7,
+0x1a,0x40,0xa3,0x0a,0x20,0x00,0x08,0x86,0x11,0xb4,0x01,0x76,0x59,0x42,0x73,0x07,
 0x45,0x49,0x56,0x92,0x0c,0x07,0x09,0x27,0x26,0x05,0x00,0x7c,0x00,0x00,0x07,0x54,
 0x68,0xb6,0x61,0x00,0x23,0x89,0xc8,0x80,0x35,0x03,0x35,0xa3,0x32,0x08,0x55,0x55,
 0x55,0x53,0x00,0x04,0xb9,0x99,0xb0,0x00,0xa4,0xb7,0x78,0xb0,0x04,0x74,0xb8,0x88,
-0xb0,0x0b,0x14,0x60,0x00,0xb0,0x07,0x04,0x60,0x2a,0x18,0x23,0x00,0x1b,0x03,0xf2,
-0x1b,0x37,0x91,0x00,0x1a,0xaa,0xbc,0xa4,0x34,0x0a,0x44,0x58,0x10,0x19,0x3a,0x34,
+0xb0,0x0b,0x14,0x60,0x00,0xb0,0x07,0x04,0x60,0x2a,0x70,0xa1,0x04,0xf2,0x1d,0x60,
+0x00,0x37,0x91,0x00,0x1a,0xaa,0xbc,0xa4,0x34,0x0a,0x44,0x58,0x10,0x19,0x3a,0x34,
 0x39,0x91,0x00,0x0a,0xa9,0x8a,0xb0,0x04,0x6a,0x80,0x8c,0x50,0x0a,0x48,0xa8,0x7e,
 0x14,0x1b,0x65,0x20,0x97,0x68,0x34,0x90,0x07,0x20,0xc4,0x32,0x00,0xf1,0x19,0x6c,
 0xae,0x22,0xa0,0x01,0xa2,0xb4,0x4a,0x46,0x0b,0x7d,0x44,0xa0,0x63,0xb5,0xc4,0x4a,
 0x00,0x0b,0x4c,0x44,0xa0,0x37,0xc8,0xd4,0x4a,0x09,0x26,0x37,0x00,0xa0,0xb1,0xb0,
-0xa1,0x0a,0x26,0x83,0x02,0x3a,0xc0,0xf8,0x08,0x01,0xbc,0x02,0xf0,0x01,0x9a,0xba,
-0xca,0xa4,0x00,0x1a,0x21,0xc2,0x10,0x43,0x0a,0x79,0x77,0xd0,0x1a,0x4a,0xe9,0x12,
-0xf2,0x31,0x0b,0x63,0x00,0xa0,0x01,0x6b,0x38,0xd8,0x80,0x07,0x5b,0x45,0xb0,0x90,
+0xa1,0x0a,0x26,0x83,0x02,0x3a,0xc0,0xf8,0x08,0x01,0xbc,0x02,0xf0,0x48,0x9a,0xba,
+0xca,0xa4,0x00,0x1a,0x21,0xc2,0x10,0x43,0x0a,0x79,0x77,0xd0,0x1a,0x4a,0x6a,0x88,
+0xd0,0x00,0x0b,0x63,0x00,0xa0,0x01,0x6b,0x38,0xd8,0x80,0x07,0x5b,0x45,0xb0,0x90,
 0x0b,0x57,0xb0,0xb0,0x94,0x25,0x90,0x27,0xb0,0x01,0x03,0x20,0x61,0x40,0x00,0x01,
 0x84,0xe8,0xe8,0x80,0x1a,0x4d,0x82,0xc2,0x20,0x02,0x47,0xb7,0xd7,0x50,0x00,0x85,
 0xb8,0xd8,0x60,0x06,0x74,0x95,0xc5,0x51,0x07,0x03,0x98,0x55,0x51,0x2a,0xaa,0xcd,
-0xaa,0xa7,0x10,0x26,0x23,0x00,0x46,0x64,0x00,0xf0,0x03,0x05,0xb1,0xd9,0xb9,0xb0,
-0x00,0x10,0xa1,0x90,0xb0,0x15,0x00,0xb9,0x75,0xb0,0x08,0x80,0xd8,0x2f,0x13,0xf6,
-0x08,0x22,0x22,0x20,0x00,0x75,0xbd,0xac,0xd1,0x01,0xa5,0x59,0x26,0x91,0x08,0x35,
-0x59,0x26,0x91,0x0b,0x2c,0xcd,0xbc,0xd9,0xb4,0x25,0xf2,0x1e,0x08,0x80,0xd9,0x99,
-0xa0,0x00,0x40,0xd8,0x70,0xa0,0x22,0x04,0xc4,0xb5,0xc3,0x1a,0x5c,0x44,0x44,0x4b,
-0x00,0x04,0xd9,0x99,0xb4,0x00,0x90,0xd8,0x88,0xb0,0x03,0x80,0xd8,0x88,0xb0,0x0b,
-0x20,0xa0,0x00,0xb0,0x07,0x00,0xa0,0x39,0x90,0x76,0x12,0xf0,0x1e,0x30,0x89,0x66,
-0x60,0x00,0x59,0xbd,0xbb,0xb4,0x43,0x0a,0x2a,0xa5,0xb6,0x0a,0x28,0x77,0x77,0x72,
-0x00,0x0b,0x35,0xa3,0x75,0x04,0x56,0xbb,0xd9,0xa1,0x0a,0x13,0x62,0x80,0xa0,0x2a,
-0x03,0x62,0x88,0x80,0x02,0x00,0x02,0x80,0x00,0x01,0xc4,0x01,0xf2,0xaa,0x09,0x89,
-0x9c,0xb9,0x94,0x00,0x20,0x70,0x06,0x00,0x10,0x0b,0x50,0x05,0x90,0x3b,0x59,0xb9,
-0x9b,0x81,0x00,0x05,0xb9,0x9b,0x40,0x01,0x70,0x77,0xa0,0x80,0x08,0x6b,0x90,0x2d,
-0x30,0x1a,0x01,0xb6,0x44,0xb3,0x02,0x01,0x73,0x00,0x12,0x08,0x7a,0xda,0xae,0xa5,
-0x00,0x00,0xa2,0x1b,0x00,0x43,0x00,0x6b,0xc8,0x00,0x09,0x28,0x9b,0xc9,0x91,0x00,
-0x0a,0x44,0x64,0x81,0x00,0x8a,0x76,0x6a,0x81,0x07,0x4a,0x9b,0xaa,0xb1,0x0b,0x0b,
-0x28,0x91,0xb1,0x25,0x0a,0x03,0x54,0xb0,0x09,0x58,0xd8,0x47,0x51,0x00,0x01,0xa1,
-0x54,0x00,0x32,0x2a,0xbc,0x57,0x42,0x1a,0x2a,0xbc,0x58,0xb2,0x00,0x25,0x68,0x53,
-0x90,0x03,0x68,0xd8,0x62,0x90,0x08,0x59,0xd9,0xb1,0x90,0x09,0x00,0x90,0xa0,0x90,
-0x23,0x00,0x90,0x50,0x90,0x12,0x00,0x50,0x14,0x00,0x09,0x5a,0xc7,0x45,0x00,0x00,
-0x48,0x3a,0x7c,0xa5,0x42,0x39,0x5b,0xc1,0x90,0x1a,0x3a,0x9c,0xe4,0x90,0x00,0x38,
-0xa5,0x38,0x90,0x04,0x5c,0x55,0x0b,0x60,0x0a,0x0b,0x9b,0x0b,0x30,0x19,0x19,0x0a,
-0x5a,0xc0,0x53,0xa3,0xa7,0xb0,0x57,0x77,0x07,0xf6,0x1d,0x50,0x07,0x97,0x50,0x00,
-0x19,0x8c,0xa8,0xb2,0x34,0x0a,0x5b,0x85,0x70,0x08,0x3a,0x03,0x77,0x40,0x00,0x0a,
-0x77,0xb7,0x80,0x02,0x6a,0x87,0xb6,0x90,0x08,0x4a,0x37,0xc6,0x40,0x0b,0x55,0x77,
-0x73,0x90,0x37,0x83,0x68,0x8a,0x42,0xd2,0x05,0xf4,0x1d,0x1a,0x27,0x28,0x45,0x40,
-0x01,0x59,0x4a,0x97,0x90,0x32,0x49,0x76,0x59,0x84,0x1b,0x65,0x6a,0xa5,0x73,0x00,
-0x54,0x28,0x75,0x43,0x02,0x36,0x77,0x77,0xa0,0x09,0x2a,0x87,0x77,0x50,0x0b,0x06,
-0x77,0x77,0xd0,0x26,0x00,0x00,0x88,0x82,0x3b,0x01,0xe0,0x21,0x10,0x38,0x5d,0x20,
-0xb0,0x47,0x00,0xb1,0x03,0x90,0x67,0x02,0xa0,0x0a,0x20,0x9b,0xed,0x30,0x70,0xca,
-0x20,0x00,0x00,0x08,0x72,0xb0,0xbf,0x30,0x73,0x4c,0x30,0x0c,0x60,0x00,0x02,0xa7,
-0x32,0x00,0x10,0x1b,0x33,0x0a,0xe0,0x1e,0x99,0x90,0x00,0x11,0x3b,0x11,0x10,0x01,
-0xd9,0x99,0x99,0xb0,0x01,0xff,0x22,0xf0,0x08,0x01,0xcb,0xbb,0xbb,0xa0,0x01,0x50,
-0x20,0x30,0x50,0x09,0x42,0x90,0xb0,0x81,0x17,0x00,0x70,0x51,0x23,0x00,0x20,0x03,
-0x6c,0x23,0xf5,0x1a,0x0c,0x00,0x00,0x1a,0xcc,0xbd,0xa5,0x00,0x00,0x01,0xc0,0x45,
-0x00,0x00,0x0b,0xb9,0xbc,0x40,0x00,0x87,0x00,0x08,0x20,0x1b,0xba,0xaa,0xaa,0xe0,
-0x88,0x34,0x23,0x80,0xb0,0x0a,0x1a,0x18,0x42,0xb0,0x27,0x05,0x01,0x01,0x26,0x00,
-0x7d,0x10,0x32,0x99,0xdb,0x99,0x15,0x31,0x02,0x08,0x1d,0xf3,0x0d,0xc3,0x33,0x33,
-0x32,0x00,0xd6,0x66,0x66,0x64,0x00,0xda,0xaa,0xaa,0xb2,0x04,0x24,0x22,0x60,0xa2,
-0x0a,0x19,0x27,0x52,0xc0,0x27,0x05,0x03,0x39,0x66,0x0a,0x10,0xa4,0x3b,0x01,0xf0,
-0x00,0xfa,0xdc,0xcd,0xc3,0x18,0xa0,0x93,0x66,0x40,0x09,0xea,0xdc,0xcd,0xc3,0x00,
-0x0a,0x00,0xf0,0x08,0x2a,0xea,0xdc,0xcd,0xc6,0x01,0x41,0x21,0x30,0x60,0x0a,0x33,
-0x70,0xb0,0xa4,0x15,0x01,0x40,0x50,0x15,0x00,0x14,0x04,0x6d,0x46,0xf2,0x1c,0x1b,
-0x21,0x10,0x04,0xd8,0x8d,0x88,0x82,0x3c,0xe9,0x9e,0x99,0x60,0x01,0xc2,0x2c,0x22,
-0x10,0x00,0xd6,0x6d,0x66,0x40,0x00,0xe9,0x9e,0x99,0x91,0x02,0x72,0x12,0x12,0x40,
-0x0a,0x16,0x43,0x80,0xb2,0x14,0x02,0x20,0x50,0x24,0x64,0x00,0xf5,0x1d,0x88,0x31,
-0x0b,0x80,0x00,0xb5,0xb4,0x0b,0x35,0x0b,0x59,0xc7,0xbe,0xa8,0x26,0x76,0x70,0x4f,
-0x10,0x00,0x7c,0x00,0xb5,0x80,0x09,0xb0,0x2b,0x40,0xa7,0x04,0x10,0x52,0x00,0x14,
-0x08,0x54,0x60,0xb0,0xa3,0x1a,0x02,0x70,0x90,0x1a,0xe5,0x1b,0xf3,0x1f,0x00,0x00,
-0xa0,0x24,0xd3,0x30,0x01,0xa4,0xa4,0x44,0xc0,0x17,0xa9,0xa8,0x88,0xd0,0x54,0xb3,
-0xa7,0x77,0xd0,0x11,0x90,0xa8,0x88,0xd0,0x03,0x90,0x03,0x70,0x00,0x06,0xb7,0x55,
-0x73,0x60,0x0b,0x08,0x67,0x02,0x85,0x55,0x05,0x1b,0x9b,0x35,0x6a,0x6f,0xf6,0x21,
-0x7c,0x6a,0xa0,0x00,0x19,0x29,0xa0,0x86,0x70,0x06,0xa9,0x5d,0x78,0xe2,0x03,0x4d,
-0x7b,0x34,0x45,0xb0,0x22,0x90,0x5b,0x88,0xd0,0x00,0x29,0x04,0xb9,0x9d,0x00,0x04,
-0x92,0x08,0x03,0x60,0x00,0x90,0x80,0xa1,0x93,0x00,0x37,0x02,0xac,0xae,0xa8,0x00,
-0x15,0x45,0xd0,0x07,0xbb,0xc5,0x99,0x91,0x0a,0x54,0x97,0x28,0x72,0x0a,0x54,0xa7,
-0x05,0x00,0xf3,0x0c,0x97,0xab,0xb2,0x0a,0x54,0xa7,0x20,0x00,0x0a,0x54,0xa7,0x30,
-0x45,0x09,0x54,0x68,0x99,0x81,0x55,0x54,0x0b,0x60,0x00,0x81,0x54,0x00,0x6b,0xe7,
-0x35,0x00,0x58,0x33,0x02,0x05,0x00,0x41,0xfb,0xbe,0xcb,0xb2,0x35,0x2c,0x90,0x01,
-0xea,0xaa,0xa5,0x00,0x02,0x91,0x11,0x68,0x68,0x0e,0x60,0x58,0x00,0x0c,0x10,0x00,
-0x58,0x3b,0x25,0x14,0x58,0xd7,0x27,0x40,0x09,0x88,0x83,0x0a,0x0c,0x42,0xf3,0x14,
-0x0d,0xac,0x4e,0xaa,0xb4,0x0b,0x00,0x0b,0xa0,0x64,0x0e,0xa9,0x0b,0xa1,0xa0,0x0a,
-0x0a,0x1a,0x58,0xa0,0x19,0x0a,0x28,0x0e,0x30,0x56,0x0a,0x75,0x8a,0xa0,0x71,0x0a,
-0xa6,0x60,0x48,0x5a,0x26,0x90,0xbb,0xec,0xa0,0x00,0x90,0x00,0x92,0x00,0x02,0x05,
-0x00,0xf0,0x07,0x06,0xca,0xaa,0xdb,0xa4,0x00,0x11,0x2c,0xc3,0x10,0x00,0x02,0xc2,
-0x92,0x00,0x00,0x5c,0x20,0x92,0x00,0x2c,0xa1,0x79,0x2b,0x13,0x00,0xa7,0x37,0x00,
-0x2e,0x4a,0xf0,0x0b,0x92,0x00,0x19,0xb1,0x5a,0xdb,0xa1,0x4b,0xe7,0x22,0xa4,0x21,
-0x61,0xb0,0x55,0x59,0x93,0x03,0xd9,0x9a,0xac,0xc5,0x6a,0xc0,0x24,0x05,0xfa,0x1a,
-0x70,0x15,0x50,0x00,0xb0,0x03,0x15,0x50,0x9f,0x21,0x12,0x30,0x96,0x00,0xf0,0x0d,
-0x0b,0x00,0xb2,0x80,0x0a,0x0b,0x00,0xb0,0x62,0x0d,0xac,0x89,0xe9,0x96,0x00,0x0b,
-0x11,0xd5,0x10,0x39,0x9c,0x00,0xe7,0x00,0x0a,0x1b,0x03,0x8a,0xa4,0x59,0xa5,0x29,
-0x30,0x1a,0x0b,0x69,0x02,0xc1,0x33,0x0c,0xb0,0x62,0x23,0x12,0x24,0x11,0x2a,0xf6,
-0x10,0xa6,0x04,0x00,0xa1,0x50,0x40,0x04,0xb6,0xda,0x57,0x70,0x00,0x22,0x67,0x34,
-0x00,0x07,0xa8,0xd8,0xe8,0xa0,0x03,0x03,0x47,0x21,0x32,0x2a,0xaa,0xbe,0xaa,0xa7,
-0x89,0x0e,0xf0,0x1f,0x3a,0xa9,0x0a,0x8b,0xb4,0x01,0x90,0x2a,0x0a,0x00,0x01,0x90,
-0x9a,0x0a,0x00,0x17,0xc5,0x8a,0x0a,0x00,0x05,0xb7,0x4b,0x6e,0xb2,0x01,0x91,0x0c,
-0x0a,0x00,0x01,0xa3,0x1a,0x0a,0x00,0x3b,0xa5,0xa3,0x1a,0x20,0x00,0x06,0x51,0x99,
-0x95,0x00,0xb3,0x23,0xf2,0x1e,0x4a,0xea,0x89,0x88,0xc2,0x00,0xa0,0x89,0x88,0xc2,
-0x01,0xb1,0x83,0x11,0x92,0x2a,0xe9,0x8a,0x99,0xd2,0x00,0xa0,0x82,0x00,0x92,0x00,
-0xb3,0x5e,0xae,0xa1,0x3a,0xd8,0x0d,0x0b,0x00,0x22,0x00,0x68,0x0b,0x07,0x00,0x09,
-0x90,0x0a,0xa8,0x68,0x49,0x40,0xc9,0xba,0xda,0xa9,0xdc,0x58,0x20,0x01,0x90,0x2b,
-0x23,0x41,0xa9,0x02,0xce,0x8a,0x0b,0x00,0xf3,0x36,0x7a,0xea,0xa6,0x00,0x0a,0x01,
-0x1b,0x21,0x00,0x01,0xd8,0x89,0xea,0x97,0x03,0xe9,0x20,0x0a,0x00,0x00,0x10,0x06,
-0xaa,0xeb,0xaa,0x00,0x8b,0xb4,0x70,0xc0,0xa0,0x08,0x23,0xa5,0xd4,0xb0,0x08,0x21,
-0x55,0x55,0x50,0x7d,0xb8,0xaa,0xca,0xa2,0x08,0x20,0x03,0x80,0x00,0x08,0x24,0xcd,
-0xad,0xe0,0x09,0x86,0x59,0x09,0xa0,0x79,0x45,0x59,0x09,0xa0,0x00,0x04,0x59,0xaa,
-0x0f,0x70,0x5a,0xa3,0xcc,0x8c,0xc2,0x08,0x12,0x05,0x00,0xf0,0x16,0x14,0x77,0x77,
-0x73,0x4d,0xb1,0x66,0x66,0x61,0x08,0x10,0xc4,0x44,0xc0,0x08,0x10,0xaa,0xb9,0xa0,
-0x1a,0xa4,0x98,0x39,0xa1,0x65,0x15,0x95,0x58,0x91,0x00,0x00,0x76,0x20,0x35,0x00,
-0x72,0x29,0xa2,0x11,0xb0,0xbd,0xaa,0xa2,0x09,0x41,0x3a,0x11,0x10,0x06,0x00,0x29,
-0xca,0x33,0x10,0xce,0x19,0x0a,0x1d,0x29,0x68,0x47,0x10,0x07,0xa5,0x33,0xe0,0xa1,
-0x0b,0x00,0x0b,0x0a,0x98,0xe8,0x88,0xb0,0xa3,0x1c,0x11,0x1b,0x0b,0xa3,0x0e,0xf1,
-0x03,0xcb,0xbe,0xbb,0xbb,0x0a,0x00,0xb0,0x00,0xb3,0x80,0x0b,0x00,0x0b,0x91,0x00,
-0xb0,0x9b,0x80,0xdb,0x06,0xe1,0xaa,0xdb,0xad,0x30,0x09,0x98,0xca,0x8c,0x30,0x09,
-0x10,0x82,0x09,0x30,0x0f,0x00,0xf0,0x02,0x00,0x4a,0x02,0xb1,0x00,0x29,0x96,0x00,
-0x9c,0x70,0x43,0x0b,0x00,0xb0,0x50,0x00,0x86,0xde,0x08,0x04,0xa1,0x08,0x01,0x18,
-0x26,0xf0,0x0d,0x0c,0xbc,0x05,0xd8,0x91,0x97,0x92,0xe6,0x2c,0x09,0x79,0x83,0xb9,
-0x40,0xdc,0xd0,0x2b,0xd2,0x09,0x79,0x8a,0x21,0x96,0x97,0x90,0xba,0xae,0x0d,0x65,
-0x00,0x40,0x60,0x00,0xba,0xae,0xf0,0x17,0xf0,0x0a,0xb0,0x03,0xc9,0xac,0x99,0xb0,
-0x03,0xc8,0xac,0x89,0xb0,0x03,0x82,0x49,0x22,0xb0,0x01,0x6d,0x66,0xb9,0x40,0x06,
-0xae,0xaa,0xdb,0xcb,0x0f,0x10,0x74,0x92,0x3a,0xf0,0x1f,0xcb,0xa7,0x00,0x5b,0x10,
-0x79,0x30,0x09,0x60,0x00,0x01,0x84,0x09,0x10,0xa0,0x82,0x0c,0xba,0xab,0xab,0xb5,
-0xb2,0x77,0x77,0x55,0x52,0x57,0x11,0x1b,0x11,0x03,0x98,0x88,0x70,0x04,0xa8,0x8c,
-0x88,0xa0,0x5b,0x88,0xd8,0x8c,0x05,0x60,0x0b,0xf8,0x0b,0xf0,0x47,0xe9,0x9b,0x00,
-0x00,0xbc,0xde,0xce,0x30,0x00,0xa7,0x8b,0x7b,0x30,0x08,0x77,0x84,0x68,0x64,0x0b,
-0x98,0xb7,0x7b,0x86,0x09,0xaa,0x97,0xaa,0xa3,0x0b,0x6a,0xaa,0xa9,0x83,0x00,0x68,
-0x66,0x6c,0x00,0x00,0x69,0x66,0x6c,0x00,0x18,0xba,0x88,0x8d,0x85,0x00,0x00,0x03,
-0x02,0x00,0x08,0x9d,0x49,0x87,0x20,0x07,0x99,0x01,0xa7,0x70,0x4c,0xe9,0x09,0x9d,
-0xa2,0x30,0x0a,0x19,0x09,0x10,0x07,0x9c,0x94,0x0b,0x80,0x0a,0x00,0x57,0x77,0x20,
-0x08,0x9d,0x48,0x71,0x14,0x83,0x06,0xe6,0x00,0x05,0xa8,0x89,0x3a,0x30,0x8d,0x45,
-0x00,0x6d,0x05,0x60,0x00,0x00,0x8b,0xcd,0xbb,0xc1,0x63,0x47,0x00,0x04,0x00,0x03,
-0x7e,0x33,0x08,0x0c,0x00,0x20,0x91,0x02,0x43,0x14,0xf0,0x0c,0xa3,0x02,0x80,0x00,
-0xbd,0xa8,0x6c,0xac,0x1a,0x00,0xbb,0x00,0x91,0xa0,0x0b,0x53,0x0a,0x0e,0xaa,0xa0,
-0xb0,0xa0,0xa0,0x0a,0x04,0x7b,0x0a,0x21,0x0a,0x30,0xea,0xa7,0x00,0x74,0x38,0x24,
-0x8b,0x70,0x24,0x04,0x10,0x23,0xfa,0x47,0xf2,0x10,0xb1,0x00,0x5a,0xad,0xaa,0xda,
-0xa0,0x00,0x13,0x01,0x30,0x00,0x03,0xb3,0x01,0x9b,0x30,0x4b,0x21,0x11,0x13,0x90,
-0x06,0xac,0xad,0x9d,0x00,0x06,0x38,0x29,0x1a,0x05,0x00,0x51,0x7c,0xbd,0xbd,0xbe,
-0xa3,0xe0,0x14,0xf1,0x14,0x5b,0xcb,0x90,0xa0,0x00,0x5b,0xaa,0x74,0xca,0xa3,0x55,
-0x00,0xaa,0x31,0x00,0x5a,0xba,0x62,0x2b,0x10,0x4a,0xa9,0x81,0x02,0x30,0x04,0x99,
-0x99,0x99,0x10,0x07,0x36,0x46,0x38,0x20,0x05,0x00,0x51,0x7d,0xcc,0xcc,0xcd,0xb3,
-0x04,0x33,0xf1,0x14,0x08,0xc9,0x49,0x9d,0x00,0x09,0x64,0x8a,0x08,0x72,0x6d,0x9a,
-0x89,0x88,0x40,0x18,0x63,0x66,0x69,0x00,0x83,0x28,0x99,0x9a,0x71,0x25,0x9b,0xa9,
-0x99,0x30,0x08,0x29,0x19,0x19,0x10,0x05,0x00,0xf0,0x0b,0x7d,0xad,0xad,0xad,0xa2,
-0x9c,0xbb,0xbb,0xf9,0x10,0x00,0x0c,0x9a,0x99,0x99,0xe9,0x31,0x11,0x1c,0x91,0x00,
-0x00,0xc9,0xbb,0xbb,0xbe,0x07,0x00,0x41,0xcb,0xbb,0xbf,0x91,0xc8,0x30,0x01,0xaa,
-0x03,0x80,0xcd,0xaa,0xa4,0x00,0x22,0x86,0x22,0x00,0x1f,0x22,0x30,0x50,0x00,0xc9,
-0x0a,0x13,0x83,0xb3,0x33,0x37,0x50,0x00,0xc6,0x66,0x69,0x0f,0x00,0x00,0x1e,0x0b,
-0x20,0x29,0x99,0x2a,0x46,0xf1,0x19,0xa0,0x7c,0xbb,0xe4,0x7c,0x78,0x30,0x0b,0x27,
-0xb3,0x8b,0x99,0xe0,0x9d,0x17,0x40,0x0b,0x0a,0xca,0x73,0x00,0xb8,0x5a,0x48,0xca,
-0xae,0x60,0xa0,0x73,0x00,0xb0,0x0a,0x07,0xca,0xae,0x00,0xa0,0x73,0x00,0xa0,0xad,
-0x1b,0xf0,0x02,0x04,0x99,0xe8,0x75,0x20,0x04,0x99,0xe9,0x99,0x90,0x01,0x26,0x92,
-0x22,0x20,0x19,0x9e,0xe9,0x47,0xf2,0x08,0x9d,0x88,0x88,0x70,0x0a,0x8c,0x88,0x89,
-0x90,0x14,0x2b,0x66,0x67,0x90,0x00,0x2a,0x22,0x24,0x90,0x00,0x2d,0x99,0x9a,0x19,
-0x44,0xf1,0x0a,0x04,0x44,0x6b,0x44,0x41,0x04,0x55,0x9a,0x55,0x52,0x00,0xb7,0x77,
-0x7c,0x30,0x00,0xb6,0x66,0x6b,0x30,0x00,0xb7,0x77,0x7b,0x30,0x0f,0x00,0xd1,0x1a,
-0xca,0xaa,0xac,0xb6,0x00,0x5a,0x10,0x69,0x40,0x09,0x50,0x00,0xb1,0x0c,0xf0,0x1b,
-0x02,0x42,0x0d,0xb8,0xa9,0xc6,0x62,0x08,0x27,0x46,0x72,0xa0,0x0d,0xb8,0xab,0xaa,
-0xc8,0x08,0x28,0x92,0x00,0x48,0x0d,0xb7,0x7a,0xb9,0xd6,0x08,0x2b,0xa6,0x96,0x90,
-0x0d,0xb8,0x1e,0x4a,0xd6,0x06,0x01,0xa6,0x00,0x90,0x42,0x0c,0x22,0x90,0x02,0xa2,
-0x26,0xf4,0x17,0x47,0x77,0x0d,0xdc,0x89,0x53,0xc7,0x58,0x30,0x91,0x0b,0x32,0x94,
-0x19,0x10,0xb5,0x9d,0xa9,0xa1,0x0b,0x00,0xc5,0x09,0x10,0xb0,0x1a,0x95,0x91,0x0b,
-0x0a,0x30,0x99,0xbb,0xe7,0x70,0x00,0x91,0x0a,0xd9,0x2f,0xf0,0x0f,0x11,0x10,0x4c,
-0xda,0x89,0xe9,0x92,0x06,0x50,0x46,0xd6,0x60,0x0a,0x10,0xa3,0xc3,0xb0,0x0e,0xa9,
-0xa8,0xe8,0xd0,0x7e,0x0a,0xa0,0xb0,0x90,0x3a,0x0a,0x79,0x67,0x11,0xd0,0x57,0x90,
-0x00,0x0b,0xa9,0x2d,0xa3,0x10,0x01,0x01,0x71,0x16,0x82,0x03,0x22,0xf3,0x1d,0x00,
-0x3b,0xca,0x78,0xd9,0x82,0x05,0x60,0xa5,0xa5,0x64,0x09,0x30,0x2d,0x2b,0x00,0x0d,
-0x96,0xbd,0x9e,0x92,0x4f,0x0b,0x7d,0x9d,0x90,0x5b,0x0a,0x29,0x0b,0x00,0x0a,0x5a,
-0x2c,0x8d,0x80,0x0a,0x43,0x2c,0x8d,0x84,0x00,0x00,0x29,0x53,0x20,0xf2,0x1e,0x6d,
-0xca,0x9a,0xca,0x90,0x09,0x20,0x88,0xb8,0x70,0x0b,0x00,0x84,0x94,0x20,0x1e,0xa8,
-0x8a,0xca,0x90,0x7c,0x0a,0x83,0x83,0x10,0x9a,0x0a,0x48,0x89,0xc3,0x0a,0x0a,0x85,
-0x66,0xa2,0x0c,0xa8,0x98,0x42,0xa0,0x02,0x01,0x21,0x09,0xa0,0x58,0x0b,0x00,0x14,
-0x04,0x06,0xab,0x08,0xd0,0x1b,0xbb,0xce,0xbb,0xb6,0x00,0x10,0x29,0x02,0x00,0x00,
-0xc1,0x29,0x68,0x50,0xb0,0x29,0x01,0xc0,0x2b,0x00,0x29,0x00,0x84,0x00,0x09,0xc7,
-0xc2,0x0f,0xf2,0x08,0x67,0x9d,0x93,0x01,0xdb,0x10,0x9f,0x40,0x08,0xa8,0x95,0x8b,
-0xb1,0x28,0x55,0x19,0x0a,0x37,0x00,0x77,0x66,0x78,0x30,0x4c,0x13,0xf0,0x29,0x31,
-0x19,0x05,0x00,0x03,0xb0,0x19,0x07,0x80,0x09,0x05,0xa7,0x00,0x72,0x26,0x97,0x00,
-0xb0,0x00,0x12,0xa0,0x33,0xb3,0x30,0x7b,0xea,0x83,0xb0,0xb0,0x05,0xd0,0xa0,0xb0,
-0x92,0x0a,0xd8,0x60,0xb0,0x40,0x38,0xa6,0x00,0xb4,0x80,0x92,0xa0,0x00,0x3b,0x10,
-0x00,0xa0,0x06,0xb2,0x00,0x00,0xa4,0x18,0x0d,0xf0,0x1b,0x15,0x05,0x00,0x00,0x2a,
-0xd4,0x0b,0x33,0x30,0x00,0xa0,0x59,0xd7,0xd1,0x4b,0xeb,0xb0,0xa1,0x70,0x02,0xe0,
-0x35,0xa3,0x40,0x08,0xca,0x36,0xa2,0xa0,0x19,0xa3,0x82,0xa0,0xb0,0x71,0xa0,0xb0,
-0xa0,0x92,0x00,0xa0,0x10,0x3e,0x27,0x11,0x07,0x76,0x02,0xf7,0x1f,0x70,0x00,0x2a,
-0xd3,0x09,0xd9,0x80,0x00,0xb0,0xb8,0x08,0x60,0x4a,0xe9,0x05,0xd8,0x00,0x06,0xe2,
-0x9a,0x76,0x00,0x09,0xd8,0x12,0xda,0xb5,0x28,0xb3,0x7a,0x20,0xc0,0x71,0xb0,0x31,
-0xbb,0x50,0x00,0xb0,0x04,0xb5,0x00,0x00,0xb2,0xb8,0x10,0x9f,0x30,0xf0,0x02,0x1a,
+0xaa,0xa7,0x00,0x00,0x46,0x5c,0x00,0x13,0x46,0x64,0x00,0xf2,0x1e,0x05,0xb1,0xd9,
+0xb9,0xb0,0x00,0x10,0xa1,0x90,0xb0,0x15,0x00,0xb9,0x75,0xb0,0x08,0x80,0xd8,0x78,
+0xb0,0x00,0x00,0x22,0x22,0x20,0x00,0x75,0xbd,0xac,0xd1,0x01,0xa5,0x59,0x26,0x91,
+0x08,0x35,0x59,0x26,0x91,0x0b,0x2c,0xcd,0xbc,0xd9,0x6b,0x0c,0x01,0x9b,0x00,0xf2,
+0x1c,0x80,0xd9,0x99,0xa0,0x00,0x40,0xd8,0x70,0xa0,0x22,0x04,0xc4,0xb5,0xc3,0x1a,
+0x5c,0x44,0x44,0x4b,0x00,0x04,0xd9,0x99,0xb4,0x00,0x90,0xd8,0x88,0xb0,0x03,0x80,
+0xd8,0x88,0xb0,0x0b,0x20,0xa0,0x00,0xb0,0x07,0x00,0xa0,0x39,0x79,0x04,0xf0,0x1f,
+0x08,0x30,0x89,0x66,0x60,0x00,0x59,0xbd,0xbb,0xb4,0x43,0x0a,0x2a,0xa5,0xb6,0x0a,
+0x28,0x77,0x77,0x72,0x00,0x0b,0x35,0xa3,0x75,0x04,0x56,0xbb,0xd9,0xa1,0x0a,0x13,
+0x62,0x80,0xa0,0x2a,0x03,0x62,0x88,0x80,0x02,0x00,0x02,0x80,0x00,0x01,0xc4,0x01,
+0xf2,0xaa,0x09,0x89,0x9c,0xb9,0x94,0x00,0x20,0x70,0x06,0x00,0x10,0x0b,0x50,0x05,
+0x90,0x3b,0x59,0xb9,0x9b,0x81,0x00,0x05,0xb9,0x9b,0x40,0x01,0x70,0x77,0xa0,0x80,
+0x08,0x6b,0x90,0x2d,0x30,0x1a,0x01,0xb6,0x44,0xb3,0x02,0x01,0x73,0x00,0x12,0x08,
+0x7a,0xda,0xae,0xa5,0x00,0x00,0xa2,0x1b,0x00,0x43,0x00,0x6b,0xc8,0x00,0x09,0x28,
+0x9b,0xc9,0x91,0x00,0x0a,0x44,0x64,0x81,0x00,0x8a,0x76,0x6a,0x81,0x07,0x4a,0x9b,
+0xaa,0xb1,0x0b,0x0b,0x28,0x91,0xb1,0x25,0x0a,0x03,0x54,0xb0,0x09,0x58,0xd8,0x47,
+0x51,0x00,0x01,0xa1,0x54,0x00,0x32,0x2a,0xbc,0x57,0x42,0x1a,0x2a,0xbc,0x58,0xb2,
+0x00,0x25,0x68,0x53,0x90,0x03,0x68,0xd8,0x62,0x90,0x08,0x59,0xd9,0xb1,0x90,0x09,
+0x00,0x90,0xa0,0x90,0x23,0x00,0x90,0x50,0x90,0x12,0x00,0x50,0x14,0x00,0x09,0x5a,
+0xc7,0x45,0x00,0x00,0x48,0x3a,0x7c,0xa5,0x42,0x39,0x5b,0xc1,0x90,0x1a,0x3a,0x9c,
+0xe4,0x90,0x00,0x38,0xa5,0x38,0x90,0x04,0x5c,0x55,0x0b,0x60,0x0a,0x0b,0x9b,0x0b,
+0x30,0x19,0x19,0x0a,0x5a,0xc0,0x53,0xa3,0xa7,0xb0,0x57,0x77,0x07,0xf6,0x1d,0x50,
+0x07,0x97,0x50,0x00,0x19,0x8c,0xa8,0xb2,0x34,0x0a,0x5b,0x85,0x70,0x08,0x3a,0x03,
+0x77,0x40,0x00,0x0a,0x77,0xb7,0x80,0x02,0x6a,0x87,0xb6,0x90,0x08,0x4a,0x37,0xc6,
+0x40,0x0b,0x55,0x77,0x73,0x90,0x37,0x83,0x68,0x8a,0x42,0xd2,0x05,0xf3,0x1e,0x1a,
+0x27,0x28,0x45,0x40,0x01,0x59,0x4a,0x97,0x90,0x32,0x49,0x76,0x59,0x84,0x1b,0x65,
+0x6a,0xa5,0x73,0x00,0x54,0x28,0x75,0x43,0x02,0x36,0x77,0x77,0xa0,0x09,0x2a,0x87,
+0x77,0x50,0x0b,0x06,0x77,0x77,0xd0,0x26,0x00,0x00,0x88,0x80,0x34,0x00,0x10,0x39,
+0x05,0x00,0xf3,0x17,0x38,0x00,0x00,0x00,0xc0,0x47,0x00,0xb1,0x03,0x90,0x67,0x02,
+0xa0,0x0a,0x20,0x9b,0x09,0x20,0x00,0x00,0xca,0x20,0x00,0x00,0x08,0x72,0xb0,0x00,
+0x00,0x8a,0x00,0x4c,0x30,0x0c,0x60,0x00,0x02,0xa7,0x32,0x00,0x10,0x1b,0x33,0x0a,
+0xf0,0x19,0x1e,0x99,0x90,0x00,0x11,0x3b,0x11,0x10,0x01,0xd9,0x99,0x99,0xb0,0x01,
+0x90,0x00,0x00,0xb0,0x01,0xcb,0xbb,0xbb,0xa0,0x01,0x50,0x20,0x30,0x50,0x09,0x42,
+0x90,0xb0,0x81,0x17,0x00,0x70,0x51,0x23,0x00,0x20,0x4f,0x03,0xf3,0x1d,0x92,0x0c,
+0x00,0x00,0x1a,0xcc,0xbd,0xa5,0x00,0x00,0x01,0xc0,0x45,0x00,0x00,0x0b,0xb9,0xbc,
+0x40,0x00,0x87,0x00,0x08,0x20,0x1b,0xba,0xaa,0xaa,0xe0,0x88,0x34,0x23,0x80,0xb0,
+0x0a,0x1a,0x18,0x42,0xb0,0x27,0x05,0x01,0x5b,0x60,0x64,0x00,0xa0,0x33,0x00,0x00,
+0x00,0x99,0xdb,0x99,0x00,0x00,0xb0,0xc7,0x07,0x10,0xe9,0x68,0x0d,0xf0,0x0e,0xc3,
+0x33,0x33,0x32,0x00,0xd6,0x66,0x66,0x64,0x00,0xda,0xaa,0xaa,0xb2,0x04,0x24,0x22,
+0x60,0xa2,0x0a,0x19,0x27,0x52,0xc0,0x27,0x05,0x03,0x39,0xb0,0x11,0x00,0x01,0x00,
+0xf0,0x05,0xa4,0x00,0x00,0x00,0x06,0xfa,0xdc,0xcd,0xc3,0x18,0xa0,0x93,0x66,0x40,
+0x09,0xea,0xdc,0xcd,0xc3,0x00,0x0a,0x00,0xf2,0x37,0x2a,0xea,0xdc,0xcd,0xc6,0x01,
+0x41,0x21,0x30,0x60,0x0a,0x33,0x70,0xb0,0xa4,0x15,0x01,0x40,0x50,0x15,0x00,0x14,
+0x04,0x00,0x00,0x00,0xa5,0x1b,0x21,0x10,0x04,0xd8,0x8d,0x88,0x82,0x3c,0xe9,0x9e,
+0x99,0x60,0x01,0xc2,0x2c,0x22,0x10,0x00,0xd6,0x6d,0x66,0x40,0x00,0xe9,0x9e,0x99,
+0x91,0x02,0x72,0x12,0x12,0x40,0x0a,0x16,0x43,0x80,0xb2,0x14,0x02,0x20,0x50,0x24,
+0x64,0x00,0xf3,0x1e,0x88,0x31,0x0b,0x80,0x00,0xb5,0xb4,0x0b,0x35,0x0b,0x59,0xc7,
+0xbe,0xa8,0x26,0x76,0x70,0x4f,0x10,0x00,0x7c,0x00,0xb5,0x80,0x09,0xb0,0x2b,0x40,
+0xa7,0x04,0x10,0x52,0x00,0x14,0x08,0x54,0x60,0xb0,0xa3,0x1a,0x02,0x70,0x90,0x1a,
+0x00,0x01,0x00,0xf2,0x20,0x10,0x00,0x00,0xa0,0x24,0xd3,0x30,0x01,0xa4,0xa4,0x44,
+0xc0,0x17,0xa9,0xa8,0x88,0xd0,0x54,0xb3,0xa7,0x77,0xd0,0x11,0x90,0xa8,0x88,0xd0,
+0x03,0x90,0x03,0x70,0x00,0x06,0xb7,0x55,0x73,0x60,0x0b,0x08,0x67,0x02,0x85,0x55,
+0x05,0x1b,0x9b,0x35,0x35,0x00,0xf4,0x21,0x90,0x7c,0x6a,0xa0,0x00,0x19,0x29,0xa0,
+0x86,0x70,0x06,0xa9,0x5d,0x78,0xe2,0x03,0x4d,0x7b,0x34,0x45,0xb0,0x22,0x90,0x5b,
+0x88,0xd0,0x00,0x29,0x04,0xb9,0x9d,0x00,0x04,0x92,0x08,0x03,0x60,0x00,0x90,0x80,
+0xa1,0x93,0x00,0x37,0x02,0xac,0xae,0xa8,0x6d,0x00,0xf0,0x01,0x50,0x00,0x00,0x07,
+0xbb,0xc5,0x99,0x91,0x0a,0x54,0x97,0x28,0x72,0x0a,0x54,0xa7,0x05,0x00,0xf2,0x0d,
+0x97,0xab,0xb2,0x0a,0x54,0xa7,0x20,0x00,0x0a,0x54,0xa7,0x30,0x45,0x09,0x54,0x68,
+0x99,0x81,0x55,0x54,0x0b,0x60,0x00,0x81,0x54,0x00,0x6b,0xb5,0x36,0x00,0x33,0xc0,
+0x09,0x20,0x05,0x00,0xf2,0x12,0xfb,0xbe,0xcb,0xb2,0x00,0xc0,0x00,0x00,0x00,0x01,
+0xea,0xaa,0xa5,0x00,0x02,0x91,0x11,0x68,0x00,0x06,0x50,0x00,0x58,0x00,0x0c,0x10,
+0x00,0x58,0x00,0x37,0x00,0x00,0x58,0x31,0x00,0xf1,0x1e,0x0a,0x0a,0x09,0x88,0x83,
+0x0a,0x0a,0x0b,0x00,0x00,0x0d,0xac,0x4e,0xaa,0xb4,0x0b,0x00,0x0b,0xa0,0x64,0x0e,
+0xa9,0x0b,0xa1,0xa0,0x0a,0x0a,0x1a,0x58,0xa0,0x19,0x0a,0x28,0x0e,0x30,0x56,0x0a,
+0x75,0x8a,0xa0,0x71,0x0a,0xa6,0x60,0x48,0x32,0x00,0xb0,0x08,0xbb,0xbb,0xec,0xa0,
+0x00,0x90,0x00,0x92,0x00,0x02,0x05,0x00,0xf2,0x0e,0x06,0xca,0xaa,0xdb,0xa4,0x00,
+0x11,0x2c,0xc3,0x10,0x00,0x02,0xc2,0x92,0x00,0x00,0x5c,0x20,0x92,0x00,0x2c,0xa1,
+0x00,0x92,0x00,0x03,0x00,0x1b,0xc0,0x64,0x00,0xf0,0x17,0x02,0xb0,0x00,0x92,0x00,
+0x19,0xb1,0x5a,0xdb,0xa1,0x4b,0xe7,0x22,0xa4,0x21,0x61,0xb0,0x55,0x59,0x93,0x03,
+0xd9,0x9a,0xac,0xc5,0x6a,0xc0,0x24,0x05,0x50,0x00,0xb0,0x0b,0x15,0x50,0x00,0xb0,
+0x03,0x05,0x00,0x32,0x00,0x8c,0x30,0x96,0x00,0xf3,0x1d,0x0b,0x00,0xb2,0x80,0x0a,
+0x0b,0x00,0xb0,0x62,0x0d,0xac,0x89,0xe9,0x96,0x00,0x0b,0x11,0xd5,0x10,0x39,0x9c,
+0x00,0xe7,0x00,0x0a,0x1b,0x03,0x8a,0x00,0x0a,0x0b,0x0a,0x29,0x30,0x1a,0x0b,0x69,
+0x02,0xc1,0x33,0x0c,0xb0,0x00,0x47,0x31,0x01,0xf1,0x1c,0x24,0x00,0x00,0x0a,0xaa,
+0xbe,0xaa,0xa6,0x04,0x00,0xa1,0x50,0x40,0x04,0xb6,0xda,0x57,0x70,0x00,0x22,0x67,
+0x34,0x00,0x07,0xa8,0xd8,0xe8,0xa0,0x03,0x03,0x47,0x21,0x32,0x2a,0xaa,0xbe,0xaa,
+0xa7,0x00,0x00,0x29,0x00,0x00,0x05,0x00,0xf2,0x4f,0x3a,0xa9,0x0a,0x8b,0xb4,0x01,
+0x90,0x2a,0x0a,0x00,0x01,0x90,0x9a,0x0a,0x00,0x17,0xc5,0x8a,0x0a,0x00,0x05,0xb7,
+0x4b,0x6e,0xb2,0x01,0x91,0x0c,0x0a,0x00,0x01,0xa3,0x1a,0x0a,0x00,0x3b,0xa5,0xa3,
+0x1a,0x20,0x00,0x06,0x51,0x99,0x95,0x00,0x00,0x01,0x11,0x10,0x4a,0xea,0x89,0x88,
+0xc2,0x00,0xa0,0x89,0x88,0xc2,0x01,0xb1,0x83,0x11,0x92,0x2a,0xe9,0x8a,0x99,0xd2,
+0x00,0xa0,0x82,0x00,0x92,0x00,0xb3,0x5e,0xae,0xa1,0x3a,0xd8,0x0d,0x0b,0x00,0x22,
+0x00,0x68,0x0b,0x07,0x00,0x09,0x90,0x0a,0xc8,0x01,0xf1,0x04,0x3b,0xc9,0xba,0xda,
+0xa9,0x00,0x0a,0x0a,0x0a,0x01,0x90,0x00,0xa0,0xb9,0xd9,0xa9,0x02,0xce,0x8a,0x0b,
+0x00,0xf2,0x37,0x7a,0xea,0xa6,0x00,0x0a,0x01,0x1b,0x21,0x00,0x01,0xd8,0x89,0xea,
+0x97,0x03,0xe9,0x20,0x0a,0x00,0x00,0x10,0x06,0xaa,0xeb,0xaa,0x00,0x8b,0xb4,0x70,
+0xc0,0xa0,0x08,0x23,0xa5,0xd4,0xb0,0x08,0x21,0x55,0x55,0x50,0x7d,0xb8,0xaa,0xca,
+0xa2,0x08,0x20,0x03,0x80,0x00,0x08,0x24,0xcd,0xad,0xe0,0x09,0x86,0x59,0x09,0xa0,
+0x79,0x45,0x59,0x09,0xa0,0x00,0x04,0x59,0x0a,0x5f,0x01,0x70,0x5a,0xa3,0xcc,0x8c,
+0xc2,0x08,0x12,0x05,0x00,0xf0,0x15,0x14,0x77,0x77,0x73,0x4d,0xb1,0x66,0x66,0x61,
+0x08,0x10,0xc4,0x44,0xc0,0x08,0x10,0xaa,0xb9,0xa0,0x1a,0xa4,0x98,0x39,0xa1,0x65,
+0x15,0x95,0x58,0x91,0x00,0x00,0x76,0x20,0x35,0x00,0x72,0xff,0x00,0xa0,0xea,0xbd,
+0xaa,0xa2,0x09,0x41,0x3a,0x11,0x10,0x06,0x09,0x01,0x56,0x01,0xbb,0xce,0xbb,0x90,
+0x18,0x01,0x01,0x05,0x00,0xf0,0x1f,0x2b,0xbb,0xce,0xbb,0xb7,0x07,0xbb,0xbb,0xbb,
+0x80,0xa1,0x0b,0x00,0x0b,0x0a,0x98,0xe8,0x88,0xb0,0xa3,0x1c,0x11,0x1b,0x0b,0x00,
+0xb0,0x00,0xb0,0xcb,0xbe,0xbb,0xbb,0x0a,0x00,0xb0,0x00,0xb3,0x80,0x0b,0x00,0x0b,
+0x91,0x00,0xb0,0x9b,0x80,0x35,0x00,0xf1,0x00,0x09,0xaa,0xdb,0xad,0x30,0x09,0x98,
+0xca,0x8c,0x30,0x09,0x10,0x82,0x09,0x30,0x0f,0x00,0xf4,0x09,0x00,0x4a,0x02,0xb1,
+0x00,0x29,0x96,0x00,0x9c,0x70,0x43,0x0b,0x00,0xb0,0x50,0x00,0x86,0x00,0xb0,0x00,
+0x0a,0x80,0x00,0xb0,0xe4,0x02,0xf0,0x0f,0x06,0x00,0x0c,0xbc,0x05,0xd8,0x91,0x97,
+0x92,0xe6,0x2c,0x09,0x79,0x83,0xb9,0x40,0xdc,0xd0,0x2b,0xd2,0x09,0x79,0x8a,0x21,
+0x96,0x97,0x90,0xba,0xae,0x0d,0x65,0x00,0xf2,0xaf,0x60,0x00,0xba,0xae,0x00,0x00,
+0x0a,0x00,0xb0,0x03,0xc9,0xac,0x99,0xb0,0x03,0xc8,0xac,0x89,0xb0,0x03,0x82,0x49,
+0x22,0xb0,0x01,0x6d,0x66,0xb9,0x40,0x06,0xae,0xaa,0xdb,0xa0,0x00,0x0b,0x00,0x74,
+0x00,0x2a,0xad,0xaa,0xcb,0xa7,0x00,0x5b,0x10,0x79,0x30,0x09,0x60,0x00,0x01,0x84,
+0x09,0x10,0xa0,0x82,0x0c,0xba,0xab,0xab,0xb5,0xb2,0x77,0x77,0x55,0x52,0x57,0x11,
+0x1b,0x11,0x03,0x98,0x88,0x70,0x04,0xa8,0x8c,0x88,0xa0,0x5b,0x88,0xd8,0x8c,0x05,
+0x60,0x0b,0x00,0xb0,0x5c,0x99,0xe9,0x9b,0x00,0x00,0xbc,0xde,0xce,0x30,0x00,0xa7,
+0x8b,0x7b,0x30,0x08,0x77,0x84,0x68,0x64,0x0b,0x98,0xb7,0x7b,0x86,0x09,0xaa,0x97,
+0xaa,0xa3,0x0b,0x6a,0xaa,0xa9,0x83,0x00,0x68,0x66,0x6c,0x00,0x00,0x69,0x66,0x6c,
+0x00,0x18,0xba,0x88,0x8d,0x85,0x00,0x00,0x03,0x02,0x00,0x08,0x9d,0x49,0x87,0x20,
+0x07,0x99,0x01,0xa7,0x70,0x4c,0xe9,0x09,0x9d,0xa2,0x30,0x0a,0x19,0x09,0x10,0x07,
+0x9c,0x94,0x0b,0x80,0x0a,0x00,0x57,0x77,0x20,0x08,0x9d,0x48,0x2a,0x00,0x00,0x0b,
+0x06,0xe6,0x00,0x05,0xa8,0x89,0x3a,0x30,0xe6,0x00,0x00,0xa1,0x04,0xb0,0x1b,0x00,
+0x00,0x8b,0xcd,0xbb,0xc1,0xb0,0x00,0x00,0xa1,0x04,0x00,0x4b,0xbb,0xbb,0xbb,0xe1,
+0x0c,0x00,0xf4,0x1f,0x91,0x02,0x10,0x03,0x00,0x00,0xa3,0x02,0x80,0x00,0xbd,0xa8,
+0x6c,0xac,0x1a,0x00,0xbb,0x00,0x91,0xa0,0x0b,0x53,0x0a,0x0e,0xaa,0xa0,0xb0,0xa0,
+0xa0,0x0a,0x04,0x7b,0x0a,0x00,0xa0,0x00,0xb0,0xea,0xa7,0x00,0x0b,0x0a,0x00,0x00,
+0x8b,0x70,0x24,0x04,0xf2,0x15,0x23,0x00,0x00,0x85,0x00,0xb1,0x00,0x5a,0xad,0xaa,
+0xda,0xa0,0x00,0x13,0x01,0x30,0x00,0x03,0xb3,0x01,0x9b,0x30,0x4b,0x21,0x11,0x13,
+0x90,0x06,0xac,0xad,0x9d,0x00,0x06,0x38,0x29,0x1a,0x05,0x00,0xf1,0x1e,0x7c,0xbd,
+0xbd,0xbe,0xa3,0x00,0x00,0x00,0x30,0x00,0x5b,0xcb,0x90,0xa0,0x00,0x5b,0xaa,0x74,
+0xca,0xa3,0x55,0x00,0xaa,0x31,0x00,0x5a,0xba,0x62,0x2b,0x10,0x4a,0xa9,0x81,0x02,
+0x30,0x04,0x99,0x99,0x99,0x10,0x07,0x36,0x46,0x38,0x20,0x05,0x00,0x70,0x7d,0xcc,
+0xcc,0xcd,0xb3,0x00,0x30,0xf3,0x03,0xf1,0x13,0xc9,0x49,0x9d,0x00,0x09,0x64,0x8a,
+0x08,0x72,0x6d,0x9a,0x89,0x88,0x40,0x18,0x63,0x66,0x69,0x00,0x83,0x28,0x99,0x9a,
+0x71,0x25,0x9b,0xa9,0x99,0x30,0x08,0x29,0x19,0x19,0x10,0x05,0x00,0xf0,0x0b,0x7d,
+0xad,0xad,0xad,0xa2,0x9c,0xbb,0xbb,0xf9,0x10,0x00,0x0c,0x9a,0x99,0x99,0xe9,0x31,
+0x11,0x1c,0x91,0x00,0x00,0xc9,0xbb,0xbb,0xbe,0x07,0x00,0x73,0xcb,0xbb,0xbf,0x91,
+0x00,0x00,0xc0,0xaa,0x03,0xf3,0x0c,0xcd,0xaa,0xa4,0x00,0x22,0x86,0x22,0x00,0x00,
+0xc8,0x88,0x8b,0x50,0x00,0xc9,0x99,0x9b,0x50,0x00,0xb3,0x33,0x37,0x50,0x00,0xc6,
+0x66,0x69,0x0f,0x00,0xf1,0x73,0xb0,0x00,0x06,0x60,0x29,0x99,0x99,0x99,0x97,0x00,
+0xa0,0x7c,0xbb,0xe4,0x7c,0x78,0x30,0x0b,0x27,0xb3,0x8b,0x99,0xe0,0x9d,0x17,0x40,
+0x0b,0x0a,0xca,0x73,0x00,0xb8,0x5a,0x48,0xca,0xae,0x60,0xa0,0x73,0x00,0xb0,0x0a,
+0x07,0xca,0xae,0x00,0xa0,0x73,0x00,0xa0,0x00,0x00,0x01,0x24,0x30,0x04,0x99,0xe8,
+0x75,0x20,0x04,0x99,0xe9,0x99,0x90,0x01,0x26,0x92,0x22,0x20,0x19,0x9e,0x99,0x99,
+0x95,0x00,0x9d,0x88,0x88,0x70,0x0a,0x8c,0x88,0x89,0x90,0x14,0x2b,0x66,0x67,0x90,
+0x00,0x2a,0x22,0x24,0x90,0x00,0x2d,0x99,0x9a,0x90,0x00,0x00,0x01,0x00,0x00,0x04,
+0x44,0x6b,0x44,0x41,0x04,0x55,0x9a,0x55,0x52,0x00,0xb7,0x77,0x7c,0x30,0x00,0xb6,
+0x66,0x6b,0x30,0x00,0xb7,0x77,0x7b,0x30,0x0f,0x00,0xf0,0x00,0x1a,0xca,0xaa,0xac,
+0xb6,0x00,0x5a,0x10,0x69,0x40,0x09,0x50,0x00,0x01,0x74,0xd0,0x04,0xf0,0x20,0x42,
+0x0d,0xb8,0xa9,0xc6,0x62,0x08,0x27,0x46,0x72,0xa0,0x0d,0xb8,0xab,0xaa,0xc8,0x08,
+0x28,0x92,0x00,0x48,0x0d,0xb7,0x7a,0xb9,0xd6,0x08,0x2b,0xa6,0x96,0x90,0x0d,0xb8,
+0x1e,0x4a,0xd6,0x06,0x01,0xa6,0x00,0x90,0x00,0x03,0x70,0x00,0x90,0x02,0xab,0x01,
+0xf3,0x19,0xb1,0x00,0x47,0x77,0x0d,0xdc,0x89,0x53,0xc7,0x58,0x30,0x91,0x0b,0x32,
+0x94,0x19,0x10,0xb5,0x9d,0xa9,0xa1,0x0b,0x00,0xc5,0x09,0x10,0xb0,0x1a,0x95,0x91,
+0x0b,0x0a,0x30,0x99,0xbb,0xe7,0x70,0x00,0x91,0x0a,0x1a,0x03,0xf1,0x53,0x11,0x11,
+0x10,0x4c,0xda,0x89,0xe9,0x92,0x06,0x50,0x46,0xd6,0x60,0x0a,0x10,0xa3,0xc3,0xb0,
+0x0e,0xa9,0xa8,0xe8,0xd0,0x7e,0x0a,0xa0,0xb0,0x90,0x3a,0x0a,0x79,0xe9,0x90,0x0a,
+0x0a,0x57,0x90,0x00,0x0b,0xa9,0x2d,0xa3,0x10,0x01,0x01,0x71,0x16,0x82,0x00,0x00,
+0x00,0x41,0x00,0x3b,0xca,0x78,0xd9,0x82,0x05,0x60,0xa5,0xa5,0x64,0x09,0x30,0x2d,
+0x2b,0x00,0x0d,0x96,0xbd,0x9e,0x92,0x4f,0x0b,0x7d,0x9d,0x90,0x5b,0x0a,0x29,0x0b,
+0x00,0x0a,0x5a,0x2c,0x8d,0x80,0x0a,0x43,0x2c,0x8d,0x84,0x00,0x00,0x29,0x11,0x11,
+0x67,0x00,0xf1,0x1e,0x6d,0xca,0x9a,0xca,0x90,0x09,0x20,0x88,0xb8,0x70,0x0b,0x00,
+0x84,0x94,0x20,0x1e,0xa8,0x8a,0xca,0x90,0x7c,0x0a,0x83,0x83,0x10,0x9a,0x0a,0x48,
+0x89,0xc3,0x0a,0x0a,0x85,0x66,0xa2,0x0c,0xa8,0x98,0x42,0xa0,0x02,0x01,0x21,0x09,
+0xa0,0x32,0x00,0x10,0x03,0x14,0x04,0x15,0x00,0x01,0x00,0xf1,0x99,0x1b,0xbb,0xce,
+0xbb,0xb6,0x00,0x10,0x29,0x02,0x00,0x00,0xc1,0x29,0x0a,0x40,0x06,0x80,0x29,0x01,
+0xc0,0x2b,0x00,0x29,0x00,0x84,0x00,0x09,0xc7,0x00,0x00,0x09,0xbb,0x67,0x9d,0x93,
+0x01,0xdb,0x10,0x9f,0x40,0x08,0xa8,0x95,0x8b,0xb1,0x28,0x55,0x19,0x0a,0x37,0x00,
+0x77,0x66,0x78,0x30,0x0a,0xaa,0xaa,0xaa,0xa5,0x00,0x31,0x19,0x05,0x00,0x03,0xb0,
+0x19,0x07,0x80,0x09,0x05,0xa7,0x00,0x72,0x26,0x97,0x00,0xb0,0x00,0x12,0xa0,0x33,
+0xb3,0x30,0x7b,0xea,0x83,0xb0,0xb0,0x05,0xd0,0xa0,0xb0,0x92,0x0a,0xd8,0x60,0xb0,
+0x40,0x38,0xa6,0x00,0xb4,0x80,0x92,0xa0,0x00,0x3b,0x10,0x00,0xa0,0x06,0xb2,0x00,
+0x00,0xa4,0xb6,0x00,0x00,0x00,0x15,0x05,0x00,0x00,0x2a,0xd4,0x0b,0x33,0x30,0x00,
+0xa0,0x59,0xd7,0xd1,0x4b,0xeb,0xb0,0xa1,0x70,0x02,0xe0,0x35,0xa3,0x40,0x08,0xca,
+0x36,0xa2,0xa0,0x19,0xa3,0x82,0xa0,0xb0,0x71,0xa0,0xb0,0xa0,0x92,0x00,0xa0,0x10,
+0xa0,0x00,0x00,0xa0,0x07,0x76,0x02,0xf2,0x1f,0x70,0x00,0x2a,0xd3,0x09,0xd9,0x80,
+0x00,0xb0,0xb8,0x08,0x60,0x4a,0xe9,0x05,0xd8,0x00,0x06,0xe2,0x9a,0x76,0x00,0x09,
+0xd8,0x12,0xda,0xb5,0x28,0xb3,0x7a,0x20,0xc0,0x71,0xb0,0x31,0xbb,0x50,0x00,0xb0,
+0x04,0xb5,0x00,0x00,0xb2,0xb8,0x10,0xe2,0x00,0x00,0x20,0x02,0xf0,0x03,0x00,0x1a,
 0xd5,0xaa,0xaa,0xd0,0x00,0xa0,0xa0,0x00,0xb0,0x38,0xd7,0x9a,0xaa,0xd0,0x16,0xd3,
-0xf0,0x04,0x50,0xf5,0x9a,0xea,0xa3,0x1a,0x97,0x31,0x61,0x74,0xa0,0x6a,0xea,0xa0,
-0x10,0x24,0x13,0x10,0xa2,0x33,0x13,0x00,0x2a,0x08,0xf0,0x14,0x39,0xc6,0x79,0x99,
-0x80,0x01,0xa0,0x72,0x92,0xa0,0x48,0xd7,0x15,0x85,0x10,0x17,0xc2,0x99,0xe9,0xc0,
-0x09,0xd7,0xa5,0xc5,0xc0,0x29,0xa4,0xa3,0xc3,0xc0,0x72,0xa3,0xda,0xc9,0xe5,0x50,
-0x00,0x00,0xaf,0x46,0xf2,0x12,0x06,0xa0,0x38,0xb4,0x67,0xd7,0x72,0x00,0xb0,0x58,
-0xe8,0x80,0x5b,0xeb,0x88,0x98,0x84,0x03,0xd0,0x69,0x88,0xb0,0x09,0xd9,0x79,0x77,
-0xd0,0x48,0xb3,0x78,0x66,0xd0,0x50,0x48,0x21,0x73,0x19,0x06,0x50,0x00,0xb4,0xb2,
-0x00,0x96,0x1e,0xf2,0x22,0x23,0x01,0x24,0x61,0x1a,0xd3,0xb8,0xa4,0x80,0x00,0x90,
-0x7a,0xb9,0xb0,0x3a,0xe8,0x33,0xb3,0x31,0x15,0xc3,0x66,0x66,0x63,0x07,0xe2,0x77,
-0x77,0xd0,0x0a,0xa7,0x56,0x66,0xc0,0x54,0x90,0x78,0xc7,0x70,0x00,0x92,0x8a,0x53,
-0xa0,0x00,0x95,0x29,0x9a,0x44,0x92,0x3c,0x10,0x2c,0x67,0x0d,0xe0,0xaa,0xab,0xab,
-0x04,0x50,0x63,0x1a,0x7a,0x80,0x00,0x6a,0x23,0xba,0xaa,0xf3,0x35,0x11,0xc0,0x47,
-0x10,0x01,0x9a,0x2a,0x52,0x0a,0xaa,0xae,0xaa,0xa7,0x8d,0x28,0x00,0x89,0x4d,0xf1,
-0x06,0x0e,0x89,0x98,0x98,0xb6,0x09,0x1b,0x20,0xa6,0x44,0x05,0xa2,0x14,0x36,0x90,
-0x00,0x00,0x47,0x47,0x00,0x2a,0x08,0x16,0xe0,0x01,0xc5,0x80,0x00,0x00,0x4c,0x20,
-0x88,0x20,0x0b,0x81,0x00,0x04,0xb7,0x58,0x2a,0x01,0x5c,0x44,0xf4,0x42,0xb0,0x82,
-0x07,0x54,0x77,0xa3,0x81,0x05,0xa2,0x2b,0x8b,0x88,0x8a,0x02,0x92,0xc7,0x71,0xc0,
-0x29,0x87,0x29,0x0c,0x02,0x90,0x6d,0x90,0xc0,0x29,0x84,0x04,0x2c,0x02,0xd8,0x88,
-0x88,0xb0,0x02,0x80,0x90,0xe0,0x73,0x4a,0xca,0xa5,0xe5,0xa3,0x03,0x04,0x45,0x55,
-0x51,0x09,0x29,0xaa,0xca,0xa5,0x09,0x45,0x01,0xd0,0x00,0x09,0x62,0xcd,0xad,0xc5,
-0x05,0xa6,0x98,0x09,0x45,0x5c,0x84,0x98,0x09,0x45,0x00,0x00,0x97,0x08,0xa3,0x96,
-0x19,0xf3,0x20,0x21,0x00,0x09,0xda,0x87,0xbb,0x92,0x04,0x25,0x21,0x43,0x40,0x2b,
-0xcd,0x98,0xcb,0xa4,0x06,0x88,0x55,0x88,0x80,0x0a,0x00,0x99,0x00,0xb0,0x07,0xcd,
-0x54,0xdd,0x80,0x04,0x6a,0x01,0x8a,0x00,0x08,0x3b,0xb7,0x4a,0x05,0x2a,0x06,0x59,
-0x08,0x98,0xba,0x1b,0xf3,0x21,0x02,0x30,0x00,0x06,0xc9,0x79,0xb9,0x94,0x2a,0x38,
-0x4a,0x0c,0x10,0x07,0x9a,0xaa,0x9b,0x60,0x00,0x11,0xa3,0x12,0xa0,0x06,0x97,0xc8,
-0x77,0x40,0x09,0xba,0xda,0xaa,0x90,0x00,0x0a,0xd1,0x00,0xc0,0x01,0xa4,0xa1,0x12,
-0xb0,0x1b,0x30,0xa1,0x58,0x20,0x37,0x00,0xf0,0x03,0x01,0x40,0x00,0x06,0xd9,0x98,
-0xc9,0x96,0x2a,0x47,0x2b,0x1b,0x00,0x03,0xaa,0xbd,0x9a,0x70,0x34,0x45,0xf0,0x04,
-0x11,0x28,0x88,0x88,0x9d,0x86,0x08,0x99,0x99,0xad,0x94,0x01,0x58,0x11,0x3a,0x10,
-0x00,0x09,0x60,0x30,0x07,0x31,0x27,0xb6,0x00,0xbc,0x05,0x90,0x0d,0xa9,0x7e,0xa9,
-0x91,0x84,0x91,0x93,0x47,0xc5,0x17,0x71,0x7c,0x20,0x06,0x96,0x66,0x6c,0x20,0x0a,
-0x00,0xf4,0x02,0x03,0x8c,0x77,0xc8,0x10,0x69,0xad,0x99,0xe9,0x92,0x01,0xb2,0x00,
-0xb0,0x00,0x3c,0x40,0x02,0x07,0xf0,0x0a,0x02,0x10,0x01,0x20,0x00,0x0a,0xa8,0x79,
-0xc8,0x83,0x48,0x28,0x39,0x0a,0x00,0x0a,0x88,0xaa,0x88,0xa1,0x0b,0x79,0x99,0x98,
-0x91,0xb3,0x12,0x00,0x1a,0x05,0x10,0x88,0x9d,0x18,0x26,0x99,0x40,0xf0,0x3a,0xf0,
-0x22,0x01,0x20,0x00,0x40,0x00,0x09,0xb9,0x86,0xd9,0x93,0x49,0x57,0x3a,0x1b,0x00,
-0x08,0x9b,0x83,0x9b,0x90,0x0b,0x22,0xb5,0x61,0xc0,0x0c,0x66,0xc5,0x50,0xb0,0x0c,
-0x99,0xb5,0x50,0xb0,0x0b,0x08,0x15,0x50,0xb0,0x0d,0x7c,0xb5,0x6b,0x80,0x19,0x40,
-0x66,0x50,0x9b,0x00,0xf3,0x20,0x10,0x00,0x0b,0xb9,0x8e,0xa9,0x93,0x66,0xa1,0x93,
-0x57,0x00,0x59,0xb9,0x96,0xac,0xa0,0x15,0xb5,0x39,0x10,0xb0,0x38,0xb4,0xa9,0x10,
-0xb0,0x3a,0xc8,0xa9,0x14,0xb0,0x17,0xc7,0x59,0x13,0x21,0x59,0xd9,0x9a,0x10,0x37,
-0x00,0x90,0x05,0xba,0xc2,0xff,0x00,0xf2,0x4e,0x8b,0xc9,0x97,0x2b,0x38,0x4b,0x0b,
-0x20,0x01,0x07,0xb7,0x92,0x10,0x05,0xaa,0x98,0xa8,0x94,0x16,0x98,0x73,0x88,0x73,
-0x01,0xa0,0xb6,0x50,0xb0,0x00,0xad,0x73,0xda,0x60,0x02,0xbb,0x25,0xca,0x50,0x19,
-0x01,0x76,0x00,0x66,0x00,0x40,0x01,0x20,0x00,0x08,0xc8,0x78,0xb8,0x81,0x5a,0x55,
-0x38,0x38,0x00,0x08,0xb2,0xb5,0xa4,0x70,0x6c,0xac,0xac,0xd8,0xa2,0x06,0xc1,0xb5,
-0x91,0x60,0x07,0xc1,0xb5,0x69,0x40,0x05,0xb1,0xa5,0x3d,0x00,0x03,0xb3,0xa6,0x8b,
-0x32,0x59,0x87,0x6c,0x55,0xc1,0x4c,0x04,0xf6,0x1d,0x83,0x60,0xb0,0x00,0x0a,0x86,
-0x70,0xb9,0x95,0x05,0x97,0x20,0xb2,0x11,0x29,0xea,0x70,0xb0,0x00,0x01,0xf8,0x1b,
-0xeb,0xb7,0x09,0xa8,0x97,0x00,0x0b,0x47,0x82,0x37,0x00,0x0b,0x00,0x82,0x2c,0x99,
-0xab,0x00,0x82,0x27,0x11,0x1a,0x74,0x04,0xf6,0x1c,0x13,0xa4,0x46,0xc7,0x62,0x08,
-0xb9,0x38,0xd9,0x81,0x06,0xc4,0x34,0xb4,0x42,0x3b,0xe8,0x45,0x55,0x53,0x06,0xf3,
-0x3b,0x99,0xd0,0x0a,0xba,0x4b,0x77,0xd0,0x47,0xa0,0x3b,0x88,0xd0,0x10,0xa0,0x36,
-0x00,0xb0,0x00,0xa0,0x36,0x02,0x26,0xf1,0x22,0x13,0x20,0x05,0xab,0xdb,0x97,0x30,
-0x00,0x07,0x60,0x35,0x00,0x00,0xbc,0x9a,0xb1,0x00,0x00,0x33,0xd8,0x0a,0x00,0x00,
-0x6c,0x42,0x3a,0x80,0x07,0xba,0x9d,0x65,0xa3,0x00,0x47,0x0a,0x2a,0x10,0x06,0xb0,
-0x0a,0x03,0xb1,0x05,0x04,0xb8,0x00,0x32,0x00,0x40,0x5e,0x19,0xf5,0x18,0x6b,0xbb,
+0xf0,0x04,0xd0,0xf5,0x9a,0xea,0xa3,0x1a,0xb8,0x00,0xb0,0x00,0x74,0xa0,0x6a,0xea,
+0x67,0x00,0x71,0xb0,0x00,0x00,0xa2,0xaa,0xea,0xa5,0x2a,0x08,0xf0,0x14,0x39,0xc6,
+0x79,0x99,0x80,0x01,0xa0,0x72,0x92,0xa0,0x48,0xd7,0x15,0x85,0x10,0x17,0xc2,0x99,
+0xe9,0xc0,0x09,0xd7,0xa5,0xc5,0xc0,0x29,0xa4,0xa3,0xc3,0xc0,0x72,0xa3,0xda,0xc9,
+0xe5,0x50,0x00,0xf2,0x24,0xa0,0x00,0xa0,0xa0,0x06,0xa0,0x38,0xb4,0x67,0xd7,0x72,
+0x00,0xb0,0x58,0xe8,0x80,0x5b,0xeb,0x88,0x98,0x84,0x03,0xd0,0x69,0x88,0xb0,0x09,
+0xd9,0x79,0x77,0xd0,0x48,0xb3,0x78,0x66,0xd0,0x50,0xb0,0x79,0x77,0xd0,0x00,0xb0,
+0x19,0x06,0x50,0x00,0xb4,0xb2,0x00,0x94,0x96,0x00,0xf1,0x22,0x23,0x01,0x24,0x61,
+0x1a,0xd3,0xb8,0xa4,0x80,0x00,0x90,0x7a,0xb9,0xb0,0x3a,0xe8,0x33,0xb3,0x31,0x15,
+0xc3,0x66,0x66,0x63,0x07,0xe2,0x77,0x77,0xd0,0x0a,0xa7,0x56,0x66,0xc0,0x54,0x90,
+0x78,0xc7,0x70,0x00,0x92,0x8a,0x53,0xa0,0x00,0x95,0x29,0x9a,0x44,0xbe,0x08,0xf1,
+0x08,0x00,0x2c,0x00,0x00,0xea,0xaa,0xaa,0xab,0xab,0x04,0x50,0x63,0x1a,0x7a,0x80,
+0x00,0x6a,0x23,0xba,0xaa,0xaa,0x70,0x00,0x27,0x08,0x11,0x0c,0x3f,0x08,0x40,0x00,
+0x0a,0xaa,0xae,0x25,0x07,0x10,0x01,0xf1,0x06,0xf0,0x75,0x4a,0x11,0x10,0x0e,0x89,
+0x98,0x98,0xb6,0x09,0x1b,0x20,0xa6,0x44,0x05,0xa2,0x14,0x36,0x90,0x00,0x00,0x47,
+0x47,0x00,0x2a,0xaa,0xef,0xba,0xa6,0x00,0x01,0xc5,0x80,0x00,0x00,0x4c,0x20,0x88,
+0x20,0x0b,0x81,0x00,0x04,0xb7,0x00,0x02,0x30,0x00,0x09,0x99,0xad,0x99,0x94,0xb0,
+0x82,0x07,0x54,0x77,0xa3,0x81,0x05,0xa2,0x2b,0x8b,0x88,0x8a,0x02,0x92,0xc7,0x71,
+0xc0,0x29,0x87,0x29,0x0c,0x02,0x90,0x6d,0x90,0xc0,0x29,0x84,0x04,0x2c,0x02,0xd8,
+0x88,0x88,0xb0,0x02,0x80,0x90,0xe0,0x73,0x4a,0xca,0xa5,0xe5,0xa3,0x03,0x04,0x45,
+0x55,0x51,0x09,0x29,0xaa,0xca,0xa5,0x09,0x45,0x01,0xd0,0x00,0x09,0x62,0xcd,0xad,
+0xc5,0x05,0xa6,0x98,0x09,0x45,0x5c,0x84,0x98,0x09,0x45,0x00,0x00,0x97,0x08,0xb3,
+0x04,0x01,0xb6,0x04,0xf2,0x20,0x21,0x00,0x09,0xda,0x87,0xbb,0x92,0x04,0x25,0x21,
+0x43,0x40,0x2b,0xcd,0x98,0xcb,0xa4,0x06,0x88,0x55,0x88,0x80,0x0a,0x00,0x99,0x00,
+0xb0,0x07,0xcd,0x54,0xdd,0x80,0x04,0x6a,0x01,0x8a,0x00,0x08,0x3b,0xb7,0x4a,0x05,
+0x2a,0x06,0x59,0x08,0x98,0x37,0x00,0xf3,0x22,0x40,0x02,0x30,0x00,0x06,0xc9,0x79,
+0xb9,0x94,0x2a,0x38,0x4a,0x0c,0x10,0x07,0x9a,0xaa,0x9b,0x60,0x00,0x11,0xa3,0x12,
+0xa0,0x06,0x97,0xc8,0x77,0x40,0x09,0xba,0xda,0xaa,0x90,0x00,0x0a,0xd1,0x00,0xc0,
+0x01,0xa4,0xa1,0x12,0xb0,0x1b,0x30,0xa1,0x58,0x20,0x37,0x00,0xf0,0x1a,0x01,0x40,
+0x00,0x06,0xd9,0x98,0xc9,0x96,0x2a,0x47,0x2b,0x1b,0x00,0x03,0xaa,0xbd,0x9a,0x70,
+0x01,0x11,0x49,0x11,0x11,0x28,0x88,0x88,0x9d,0x86,0x08,0x99,0x99,0xad,0x94,0x01,
+0x58,0x11,0x3a,0x10,0x00,0x09,0x60,0x30,0x07,0x31,0x27,0xb6,0x00,0xbc,0x05,0xf1,
+0x05,0x0d,0xa9,0x7e,0xa9,0x91,0x84,0x91,0x93,0x47,0x00,0x06,0xa7,0x77,0x7c,0x20,
+0x06,0x96,0x66,0x6c,0x20,0x0a,0x00,0xf4,0x02,0x03,0x8c,0x77,0xc8,0x10,0x69,0xad,
+0x99,0xe9,0x92,0x01,0xb2,0x00,0xb0,0x00,0x3c,0x40,0x02,0x07,0xf0,0x0e,0x02,0x10,
+0x01,0x20,0x00,0x0a,0xa8,0x79,0xc8,0x83,0x48,0x28,0x39,0x0a,0x00,0x0a,0x88,0xaa,
+0x88,0xa1,0x0b,0x79,0x99,0x98,0x91,0x00,0xc0,0x00,0x0b,0x1a,0x05,0x60,0x88,0x00,
+0x00,0xd9,0x99,0x99,0x30,0x00,0xf0,0x29,0x04,0x60,0x00,0xd9,0x99,0x9b,0x60,0x01,
+0x20,0x00,0x40,0x00,0x09,0xb9,0x86,0xd9,0x93,0x49,0x57,0x3a,0x1b,0x00,0x08,0x9b,
+0x83,0x9b,0x90,0x0b,0x22,0xb5,0x61,0xc0,0x0c,0x66,0xc5,0x50,0xb0,0x0c,0x99,0xb5,
+0x50,0xb0,0x0b,0x08,0x15,0x50,0xb0,0x0d,0x7c,0xb5,0x6b,0x80,0x19,0x40,0x66,0x50,
+0x9b,0x00,0xf3,0x20,0x10,0x00,0x0b,0xb9,0x8e,0xa9,0x93,0x66,0xa1,0x93,0x57,0x00,
+0x59,0xb9,0x96,0xac,0xa0,0x15,0xb5,0x39,0x10,0xb0,0x38,0xb4,0xa9,0x10,0xb0,0x3a,
+0xc8,0xa9,0x14,0xb0,0x17,0xc7,0x59,0x13,0x21,0x59,0xd9,0x9a,0x10,0x37,0x00,0x90,
+0x05,0xba,0xc2,0xff,0x00,0xf2,0x4e,0x8b,0xc9,0x97,0x2b,0x38,0x4b,0x0b,0x20,0x01,
+0x07,0xb7,0x92,0x10,0x05,0xaa,0x98,0xa8,0x94,0x16,0x98,0x73,0x88,0x73,0x01,0xa0,
+0xb6,0x50,0xb0,0x00,0xad,0x73,0xda,0x60,0x02,0xbb,0x25,0xca,0x50,0x19,0x01,0x76,
+0x00,0x66,0x00,0x40,0x01,0x20,0x00,0x08,0xc8,0x78,0xb8,0x81,0x5a,0x55,0x38,0x38,
+0x00,0x08,0xb2,0xb5,0xa4,0x70,0x6c,0xac,0xac,0xd8,0xa2,0x06,0xc1,0xb5,0x91,0x60,
+0x07,0xc1,0xb5,0x69,0x40,0x05,0xb1,0xa5,0x3d,0x00,0x03,0xb3,0xa6,0x8b,0x32,0x59,
+0x87,0x6c,0x55,0xc1,0x4c,0x04,0xf6,0x1d,0x83,0x60,0xb0,0x00,0x0a,0x86,0x70,0xb9,
+0x95,0x05,0x97,0x20,0xb2,0x11,0x29,0xea,0x70,0xb0,0x00,0x01,0xf8,0x1b,0xeb,0xb7,
+0x09,0xa8,0x97,0x00,0x0b,0x47,0x82,0x37,0x00,0x0b,0x00,0x82,0x2c,0x99,0xab,0x00,
+0x82,0x27,0x11,0x1a,0x74,0x04,0xf5,0x1e,0x13,0xa4,0x46,0xc7,0x62,0x08,0xb9,0x38,
+0xd9,0x81,0x06,0xc4,0x34,0xb4,0x42,0x3b,0xe8,0x45,0x55,0x53,0x06,0xf3,0x3b,0x99,
+0xd0,0x0a,0xba,0x4b,0x77,0xd0,0x47,0xa0,0x3b,0x88,0xd0,0x10,0xa0,0x36,0x00,0xb0,
+0x00,0xa0,0x36,0x07,0xb0,0x35,0x00,0xf0,0x21,0x20,0x05,0xab,0xdb,0x97,0x30,0x00,
+0x07,0x60,0x35,0x00,0x00,0xbc,0x9a,0xb1,0x00,0x00,0x33,0xd8,0x0a,0x00,0x00,0x6c,
+0x42,0x3a,0x80,0x07,0xba,0x9d,0x65,0xa3,0x00,0x47,0x0a,0x2a,0x10,0x06,0xb0,0x0a,
+0x03,0xb1,0x05,0x04,0xb8,0x00,0x32,0x00,0x40,0x9f,0x01,0xf4,0x19,0xa0,0x6b,0xbb,
 0xb2,0x0a,0x2a,0x00,0x83,0x00,0x8d,0xc4,0x00,0x83,0x00,0x16,0x77,0x00,0x83,0x00,
 0x5e,0x9d,0x20,0x83,0x00,0x33,0x25,0x10,0x83,0x00,0x47,0xa8,0x20,0x83,0x00,0x83,
-0x90,0xbb,0xec,0xb4,0x20,0xc6,0x50,0xf1,0x27,0x02,0x90,0x7e,0xac,0x60,0x09,0x1a,
-0x0b,0x08,0x20,0x6c,0xb4,0x0b,0x0b,0x00,0x26,0x95,0x0e,0x2a,0xd3,0x2c,0x6d,0x1e,
-0x80,0xc0,0x36,0x36,0x57,0xb6,0x80,0x36,0x99,0x74,0x4e,0x00,0x74,0xa4,0xc3,0xc8,
-0xa0,0x40,0x21,0x68,0x10,0x44,0x0b,0x99,0xe9,0x9e,0x00,0xb8,0x8e,0x88,0xe0,0x0d,
-0x2f,0xf1,0x0e,0x6a,0xe9,0xaa,0x90,0x04,0xca,0xa7,0x50,0x00,0x6b,0xd8,0x8b,0xb0,
-0x05,0x52,0xb2,0x23,0x10,0x6a,0x0a,0x29,0x70,0x47,0x07,0xc0,0x06,0x30,0x00,0x40,
-0xeb,0x33,0xf3,0x1c,0xac,0xeb,0xe1,0x09,0x26,0xa0,0xa0,0x91,0x5b,0xa0,0xa0,0xa0,
-0x91,0x37,0x62,0xa0,0xa0,0xa1,0x1a,0x29,0xab,0xea,0xe1,0x48,0x56,0xa0,0xa0,0x91,
-0x35,0x78,0xa0,0xa0,0x91,0x73,0x96,0xab,0xeb,0xe1,0x60,0x20,0xa0,0x00,0x91,0x3b,
-0x25,0xf4,0x1c,0x07,0x61,0x10,0x08,0x25,0x2d,0x8a,0xb0,0x3b,0x86,0xb9,0x5a,0x10,
-0x38,0xc2,0x00,0xe8,0x00,0x0b,0x49,0x5b,0x48,0xa1,0x59,0x69,0x51,0xa3,0x33,0x25,
-0x68,0x00,0x07,0x00,0x64,0x98,0x2a,0x92,0x00,0x51,0x40,0x00,0x29,0x80,0xea,0x1e,
-0x00,0x37,0x00,0xf6,0x1c,0x1d,0xaa,0xd0,0x08,0x29,0x19,0x00,0xb0,0x4b,0x75,0x1a,
-0x11,0xb0,0x38,0x93,0x1d,0x88,0xc0,0x1c,0x5c,0x29,0x00,0xb0,0x36,0x46,0x4d,0xaa,
-0xd0,0x26,0x99,0x19,0x00,0xb0,0x55,0x96,0x49,0x00,0xb0,0x62,0x60,0xbd,0xaa,0xe6,
-0x10,0x19,0xf1,0x19,0x07,0x36,0xab,0xeb,0xb4,0x4c,0xa3,0x00,0xb0,0x00,0x26,0x74,
-0x6a,0xdb,0xa0,0x2c,0x5b,0x00,0x00,0x00,0x36,0x47,0x6c,0xaa,0xc0,0x36,0x89,0x64,
-0x00,0xb0,0x74,0x95,0x6a,0x88,0xc0,0x40,0x10,0x65,0x11,0xb0,0x51,0x08,0xf1,0x23,
-0x04,0x50,0xac,0xca,0xd0,0x09,0x25,0x0b,0x10,0xb0,0x5a,0x91,0xa6,0x1b,0x50,0x37,
-0x52,0xca,0xda,0xe0,0x1a,0x68,0xa0,0x90,0xa0,0x45,0x24,0xaa,0xba,0xe0,0x16,0x77,
-0xa0,0x00,0x20,0x54,0x87,0xa0,0x00,0x54,0x50,0x40,0x5a,0xaa,0xb1,0x00,0x20,0x00,
-0x20,0x00,0x5e,0x24,0xf2,0x19,0x08,0x26,0xac,0xea,0xa3,0x3b,0x94,0x09,0x36,0x30,
-0x48,0xa1,0x6c,0x68,0xd0,0x0a,0x1a,0x77,0x54,0x73,0x6c,0x9c,0x0b,0x0a,0x00,0x13,
-0x45,0x0b,0x0a,0x00,0x55,0x88,0x47,0x0a,0x16,0x71,0x64,0xb0,0x0c,0xb4,0xa0,0x10,
-0x01,0x62,0x03,0xf5,0x1c,0x60,0x0a,0x0c,0xb7,0x08,0x36,0xae,0x79,0x63,0x3b,0xb1,
-0x0a,0x09,0x90,0x17,0xa1,0x9d,0x69,0xa0,0x0b,0x76,0x0a,0x09,0x63,0x38,0x47,0x9d,
-0x89,0x18,0x17,0x74,0x49,0x1a,0x38,0x56,0x78,0x83,0x0a,0x81,0x51,0x30,0xa0,0x09,
-0xee,0x1f,0x00,0x1c,0x38,0xf3,0x1b,0x8a,0xaa,0xa5,0x09,0x29,0x18,0x54,0x91,0x6c,
-0xb2,0x92,0xa4,0x70,0x16,0x75,0x74,0xa3,0x90,0x2c,0x6c,0x09,0x26,0x63,0x36,0x47,
-0x6a,0xba,0xa2,0x36,0x79,0x00,0x82,0x00,0x55,0x99,0x00,0x82,0x00,0x71,0x50,0xaa,
-0xdb,0x98,0x3e,0x00,0x23,0x0f,0xf2,0x1e,0x02,0x70,0x0c,0x99,0x60,0x08,0x35,0x29,
-0x04,0x60,0x4c,0xa0,0x49,0x9d,0x20,0x16,0x64,0xaa,0xae,0xa5,0x1b,0x6a,0x51,0x94,
-0x70,0x26,0x35,0x18,0x9d,0x50,0x26,0x78,0x08,0xe5,0x80,0x54,0x85,0xa3,0x91,0x86,
-0x41,0x10,0x09,0xc0,0x01,0x82,0x45,0xf0,0x1e,0x8d,0x86,0xda,0xd3,0x0d,0x78,0xa0,
-0xa2,0xb0,0x0d,0x79,0x90,0x3e,0x30,0x0c,0x8c,0x86,0xa5,0xb5,0x00,0x16,0x72,0x70,
-0x00,0x00,0x8b,0xd7,0x18,0x10,0x08,0xcc,0x8b,0x88,0xa1,0x00,0x74,0x0b,0x2a,0x40,
-0x08,0x22,0x99,0x00,0x71,0x00,0xfd,0x03,0xf0,0x1e,0x03,0x80,0x35,0xd4,0x40,0x09,
-0x26,0xa4,0x44,0xc0,0x5c,0xb1,0xa8,0x88,0xd0,0x27,0x72,0xa6,0x66,0xd0,0x2c,0x78,
-0x23,0xc3,0x60,0x36,0x46,0x9d,0xba,0xa0,0x27,0x86,0x38,0xbb,0x20,0x54,0x87,0xb1,
-0xb2,0xc2,0x60,0x32,0x18,0xb0,0x22,0xb5,0x0e,0x00,0xe9,0x38,0xf3,0x1b,0xa1,0x00,
-0x09,0x24,0xc8,0x88,0xd0,0x4b,0xa2,0xb6,0x66,0xc0,0x28,0x82,0xa2,0x22,0x20,0x2c,
-0x78,0xea,0xcc,0xa5,0x36,0x46,0xe4,0x77,0x35,0x38,0x96,0xdb,0xcc,0xb5,0x65,0x7b,
-0xa4,0x77,0x35,0x50,0x35,0x64,0x22,0x73,0x59,0x0a,0xf3,0x21,0x01,0x25,0x60,0x04,
-0x60,0x98,0xa4,0x70,0x09,0x37,0x55,0xa3,0x80,0x6b,0xa0,0x7b,0xbc,0xb2,0x17,0x54,
-0x28,0x52,0x21,0x2b,0x5b,0x7d,0x87,0x73,0x36,0x36,0x0e,0xa9,0x90,0x35,0x79,0x3a,
-0xa8,0x30,0x72,0x97,0xc3,0xbd,0x40,0x40,0x12,0x59,0x20,0x75,0xd9,0x32,0xf0,0x7d,
-0x11,0xa3,0x10,0x07,0x26,0x77,0xc8,0x73,0x4c,0xa3,0x99,0xda,0xb2,0x26,0x83,0x96,
-0x94,0xa2,0x1b,0x3a,0x94,0xa5,0x72,0x59,0x79,0x6a,0xfd,0x91,0x24,0x67,0x09,0xc9,
-0x30,0x64,0x88,0x96,0x91,0xa3,0x70,0x40,0x30,0x91,0x01,0x00,0x50,0x00,0x50,0x00,
-0x04,0x60,0x99,0xcb,0x96,0x09,0x37,0xa3,0x00,0x18,0x6b,0xa0,0x0b,0x9a,0x96,0x27,
-0x73,0x56,0x0a,0x00,0x1a,0x59,0xc4,0xc9,0xa7,0x58,0x57,0xd4,0xa0,0x27,0x34,0x58,
-0x64,0xc9,0xa7,0x72,0x84,0x64,0xc8,0x97,0x30,0x00,0x64,0xa1,0x37,0x03,0x50,0x35,
-0x80,0x80,0x08,0x21,0xa0,0xc0,0xb0,0x18,0x85,0x86,0x9b,0xb3,0x5b,0x70,0xa5,0x07,
-0x04,0x08,0x77,0xc1,0x6a,0x00,0x4a,0x86,0x92,0x7a,0x83,0x16,0x82,0x94,0x8a,0x00,
-0x47,0x86,0x99,0x9c,0x00,0x72,0x61,0xa8,0x09,0xa6,0x00,0x30,0x5f,0x00,0xf3,0x1d,
-0x50,0x59,0xd9,0x90,0x09,0x26,0x91,0xa6,0xa0,0x6c,0xa0,0x96,0x68,0xa0,0x15,0x54,
-0x93,0x88,0xa0,0x0b,0x99,0x9b,0x9a,0xd0,0x57,0x16,0x00,0x70,0x00,0x04,0x55,0x56,
-0x55,0x90,0x46,0x88,0x99,0x03,0x94,0x61,0x51,0x38,0x9a,0x41,0x72,0x44,0xf1,0x1a,
-0x88,0xc9,0x85,0x08,0x28,0x57,0xa8,0x71,0x4b,0xb2,0xb9,0x9b,0x87,0x27,0x84,0xca,
-0xac,0x98,0x2c,0x6a,0x67,0x77,0x82,0x36,0x47,0xa5,0x55,0xa3,0x27,0x68,0xa5,0x55,
-0xa3,0x54,0x87,0x5d,0x8b,0xa1,0x60,0x31,0xa4,0x7e,0x3a,0x00,0x0e,0x1b,0xf0,0x37,
-0x11,0xb2,0x10,0x07,0x20,0xc8,0x88,0xd0,0x19,0x46,0xb6,0x66,0xd0,0x6a,0xc0,0xb2,
-0x22,0x30,0x07,0x30,0xdc,0xcc,0xc1,0x4e,0x93,0xd6,0x77,0x71,0x00,0x35,0xbc,0xcc,
-0xc1,0x4b,0x88,0x76,0x77,0x71,0x21,0x08,0x36,0x77,0xa0,0x09,0x9a,0xb8,0xd8,0xc1,
-0x08,0x8a,0xb9,0xc8,0xb1,0x09,0x99,0xbc,0x99,0x93,0x00,0x34,0x97,0x44,0x10,0x00,
-0xb5,0x55,0x5a,0x40,0x00,0xc7,0x2a,0x2d,0x30,0xc6,0x66,0x6a,0x05,0x00,0x90,0x6b,
-0x40,0x18,0xd8,0x88,0x8c,0xa5,0x00,0x23,0x35,0x4a,0x91,0x3c,0x22,0x87,0x20,0x06,
-0x88,0x9c,0x88,0x81,0x0f,0x55,0x51,0x02,0x22,0x49,0x22,0x21,0x45,0x40,0xf0,0x02,
-0x0a,0xaa,0xcc,0xaa,0xa5,0x00,0x01,0xc7,0x70,0x00,0x03,0x7c,0x30,0x7a,0x61,0x18,
-0x40,0xb1,0x40,0xf0,0x81,0x13,0x00,0x34,0x00,0x06,0x8e,0x88,0xda,0x81,0x01,0x44,
-0x89,0x44,0x30,0x01,0x55,0x99,0x55,0x30,0x19,0x9a,0xcb,0xaa,0x96,0x07,0x9b,0x47,
-0x47,0x90,0x19,0xac,0x9b,0xc9,0x96,0x03,0x6b,0x72,0xc5,0x70,0x16,0x79,0x13,0xdb,
-0x05,0x03,0xa5,0x78,0x28,0xb7,0x00,0x24,0x40,0x00,0x00,0x2a,0xa7,0x58,0xd3,0x98,
-0x08,0x67,0x52,0x91,0x18,0x39,0xed,0x89,0x92,0x78,0x06,0xba,0x76,0xb0,0x88,0x57,
-0x52,0x40,0xb0,0x28,0x1c,0xba,0xb7,0xd2,0xb8,0x0b,0xa8,0xa3,0x92,0x18,0x0c,0xba,
-0xb0,0x90,0x08,0x08,0x00,0x85,0xa0,0xa5,0x2c,0x99,0x7a,0xa8,0xc2,0x03,0x99,0x71,
-0xb7,0xc2,0x18,0x99,0xbd,0xa7,0x81,0x05,0x84,0x98,0x47,0x70,0x05,0x84,0x88,0x47,
-0x70,0x03,0x7d,0x77,0xd8,0x40,0x07,0x7d,0x77,0xd7,0x71,0x28,0xae,0x88,0xeb,0x86,
-0x19,0x71,0x00,0x16,0xa2,0xf9,0x11,0xf0,0x0d,0x70,0x03,0xaa,0xea,0xad,0x40,0x00,
-0x00,0xb0,0xb4,0x00,0x2a,0xaa,0xee,0xaa,0xa6,0x00,0x5c,0xd6,0x55,0x20,0x2c,0x9b,
-0x33,0x37,0x60,0x00,0x1d,0xc2,0x41,0x10,0x19,0xc6,0x43,0xf0,0x19,0x1d,0xaa,0xab,
-0x60,0x01,0xb1,0x00,0x39,0x60,0x59,0xd8,0x59,0xc0,0x00,0x3a,0xe8,0x01,0xc6,0x81,
-0x00,0xa0,0x69,0xd4,0x20,0x7c,0xfa,0x20,0xb1,0x42,0x0a,0xe7,0x7c,0xea,0x73,0x48,
-0xba,0x10,0xb0,0x00,0x70,0xa5,0x40,0x30,0x00,0xa0,0x00,0x16,0x1d,0xf1,0x1c,0x5b,
-0xd9,0xd0,0x39,0xd8,0x67,0xb4,0xc0,0x1a,0xe9,0x56,0xa2,0xb0,0x00,0xb0,0x39,0xd9,
-0x90,0x4b,0xf9,0x79,0xd9,0x93,0x08,0xe7,0x80,0x93,0x55,0x1a,0xa7,0x94,0xc9,0x95,
-0x72,0xa0,0x85,0x42,0x95,0x00,0xa0,0x80,0x02,0xa3,0xe8,0x14,0xf2,0x1d,0x3e,0xbc,
-0x28,0x06,0x10,0x09,0x28,0xc7,0x5a,0x90,0x0b,0xa7,0x78,0x28,0x60,0x09,0x29,0xc7,
-0x9c,0xa4,0x0b,0xa8,0x61,0x64,0x13,0x09,0x27,0x90,0xa8,0x90,0x2c,0x9c,0x8b,0x9b,
-0xe0,0x25,0x47,0x06,0x58,0x20,0x00,0x27,0x59,0x08,0x06,0x03,0xf1,0x0f,0x26,0xb8,
-0x75,0xab,0x30,0x09,0xaa,0x7c,0x57,0xb3,0x0b,0x95,0xa3,0xb9,0x50,0x3a,0x66,0x57,
-0x9a,0x82,0x39,0xb8,0x89,0x8b,0x83,0x00,0xc7,0x77,0x7c,0x00,0x05,0x00,0x51,0x38,
-0xe9,0x99,0x9e,0x93,0xca,0x36,0x40,0x19,0x9d,0x0b,0x57,0x2f,0x72,0xb0,0x50,0x00,
-0x28,0xbd,0x0b,0x43,0x94,0x13,0x9f,0x9c,0xff,0x2f,0x43,0x18,0x1c,0x69,0x2f,0x01,
-0x06,0x13,0x38,0xb0,0x03,0xab,0x86,0x3c,0xf0,0x1d,0x94,0x05,0x60,0x40,0x1c,0x58,
-0xa5,0xb8,0x40,0x16,0x43,0x65,0x60,0x07,0x0b,0x99,0x92,0xca,0xb6,0x0b,0x22,0xb2,
-0x30,0x00,0x0c,0x55,0xb5,0x87,0xa1,0x0d,0x99,0xb5,0xa2,0x01,0x0a,0x00,0xb5,0x60,
-0x0a,0x0a,0x1a,0x82,0xba,0xb5,0xa1,0x02,0x40,0x50,0x0d,0xaa,0x3a,0x34,0x42,0xf6,
-0x17,0x65,0x00,0x20,0x0d,0xaa,0x65,0x9d,0x92,0x0a,0x0a,0x65,0x98,0x01,0x0a,0x1a,
-0x74,0xa5,0x97,0x0d,0x9a,0x83,0xa2,0x90,0x18,0x0a,0xa1,0xa0,0xa0,0x56,0x0a,0xb0,
-0xb7,0x83,0x81,0xaa,0x83,0xa2,0x18,0xba,0x12,0xf3,0x1c,0x0d,0xd3,0xa3,0x6b,0xd1,
-0x09,0x68,0x60,0x99,0x81,0x0d,0xc5,0x39,0x18,0x81,0x09,0x63,0x94,0x48,0x81,0x09,
-0x7a,0x50,0x88,0x81,0x0d,0xc4,0xda,0x98,0x81,0x16,0x63,0x80,0x99,0xb0,0x43,0x63,
-0xda,0x98,0x10,0x74,0xb1,0x80,0x3d,0x09,0x01,0x39,0x4b,0x20,0x07,0x50,0x08,0x45,
-0x5f,0xbc,0x19,0x00,0x00,0x0c,0x08,0x00,0x04,0xa0,0x0b,0x0b,0xbd,0xdb,0xbb,0xb4,
-0x00,0x0c,0x10,0x72,0xb0,0x3a,0x70,0x3d,0x30,0x06,0xca,0xaa,0x98,0xc1,0x55,0x1f,
-0x52,0x10,0x03,0xaa,0xbd,0xaa,0x59,0x10,0xa2,0x01,0x11,0x39,0x11,0x11,0x19,0x99,
-0x99,0x99,0x96,0xf8,0x0f,0xf0,0x2e,0x73,0xc6,0x5a,0xc0,0x07,0x21,0xb4,0x00,0xb0,
-0x07,0xb5,0xd9,0x4a,0xc0,0x06,0x30,0x48,0x20,0xb0,0x06,0xb5,0x87,0x6a,0xb0,0x06,
-0x51,0x98,0x32,0xa0,0x2a,0xab,0xaa,0xba,0xa7,0x00,0x88,0x00,0x8a,0x20,0x0a,0x30,
-0x00,0x02,0xa2,0x00,0x40,0x00,0x40,0x00,0x02,0xb2,0x00,0xa3,0x00,0x0c,0x7c,0x7a,
-0xbb,0xa7,0x0a,0x8a,0x20,0x12,0xb0,0x4a,0x0b,0x9a,0x90,0x6d,0x9d,0x0a,0x01,0x90,
-0x0a,0x7a,0x05,0x00,0xe4,0x6b,0x0a,0x01,0x90,0x47,0x0a,0x29,0x01,0x97,0x92,0x5b,
-0xa2,0x00,0xc8,0x33,0x0a,0xf4,0x1e,0x40,0x00,0x01,0xb1,0x00,0x76,0x00,0x0c,0x7c,
-0x8a,0xaa,0xa9,0x0a,0x8a,0x81,0x00,0x09,0x0a,0x4a,0x0a,0x00,0x20,0x6d,0x9d,0x0b,
-0x29,0x81,0x0a,0x7a,0x0b,0x81,0x00,0x0a,0x7a,0x0b,0x00,0x01,0x46,0x0a,0x0b,0x00,
-0x0a,0x91,0x5b,0x06,0x60,0x44,0x20,0x03,0x20,0xc6,0x21,0xe0,0xba,0xa1,0x00,0x00,
-0xa3,0x03,0xa0,0x00,0x1c,0xea,0xae,0xba,0x80,0x14,0x99,0x39,0x11,0x00,0x05,0x00,
-0x10,0xeb,0x29,0x39,0x10,0xa0,0x29,0x30,0x00,0x34,0x41,0x00,0x62,0x46,0xa2,0xb4,
-0x0a,0xae,0xaa,0xcc,0xa4,0x00,0x0b,0x14,0x65,0x81,0x15,0x02,0xae,0x20,0xf1,0x2f,
-0x80,0x38,0x01,0xa0,0x2b,0xdb,0xce,0xbb,0xd7,0x00,0x01,0xc8,0x70,0x00,0x01,0x6b,
-0x30,0x7a,0x40,0x1a,0x50,0x00,0x01,0x77,0x1a,0xae,0xaa,0xcc,0xa6,0x00,0x0a,0x00,
-0x64,0x00,0x00,0x77,0x99,0x99,0x96,0x02,0xc0,0x11,0x11,0xb1,0x2d,0xb2,0xca,0xd0,
-0xb0,0x12,0xb2,0x80,0xa0,0xb0,0x00,0xb2,0xd9,0xd0,0xb0,0x00,0xb1,0x40,0x52,0x42,
-0x40,0x6a,0x70,0x1a,0xae,0x5e,0x06,0xd0,0x09,0x00,0x77,0x30,0x07,0xaa,0xaa,0x86,
-0x40,0x02,0x50,0x73,0x02,0xd5,0x08,0x22,0x09,0x20,0x80,0x23,0xe2,0x07,0xbc,0xa1,
-0x00,0x04,0xb6,0x29,0x2b,0x81,0x29,0x10,0x29,0x00,0x56,0x5a,0x00,0xf0,0x13,0x68,
-0x00,0x43,0x00,0x04,0xca,0x99,0x99,0xc2,0x2b,0x7c,0x88,0x82,0x82,0x01,0x90,0xa0,
-0x00,0x91,0x05,0x99,0xd9,0x96,0xa1,0x00,0x80,0xa0,0x61,0xb0,0x00,0xc9,0xd9,0xc2,
-0xb0,0x43,0x41,0xf0,0x18,0x90,0x1a,0xae,0xaa,0xdc,0xa6,0x01,0x09,0x05,0x63,0x00,
-0x04,0xb2,0x4d,0x99,0xa0,0x01,0x15,0xbb,0x2a,0x50,0x1b,0x63,0x06,0xfb,0x10,0x00,
-0x25,0xc7,0x14,0xb8,0x00,0x93,0xb9,0x99,0xc0,0x06,0x70,0xb0,0x6c,0x03,0x32,0xb8,
-0x88,0xc0,0x5a,0x00,0xf0,0x0e,0x69,0x00,0x53,0x00,0x02,0xda,0xab,0xaa,0xb4,0x1c,
-0x86,0xc8,0xb4,0x64,0x23,0x77,0xc7,0x74,0x74,0x00,0xb5,0xb5,0x77,0x73,0x00,0xc6,
-0xc7,0x87,0x82,0x0a,0x00,0x60,0x91,0x00,0x40,0x30,0x4a,0xa0,0xb0,0x38,0xf1,0x15,
-0x96,0x00,0x07,0x26,0x43,0x00,0x02,0x88,0x9c,0x88,0x60,0x18,0x8a,0xab,0x99,0x85,
-0x00,0x6b,0x21,0x6b,0x10,0x02,0x98,0x87,0x77,0xa0,0x00,0xd9,0xc9,0xca,0x80,0x00,
-0xa0,0x81,0x72,0x80,0xd9,0x0f,0x01,0xe1,0x00,0xf2,0x45,0x05,0x7a,0x70,0x90,0x00,
-0x0a,0x6b,0x62,0xd9,0x91,0x0a,0x77,0xba,0x37,0x00,0x0a,0x2a,0x25,0x09,0x10,0x05,
-0x77,0x71,0x02,0x10,0x03,0xcb,0xbb,0xba,0x90,0x03,0x64,0x54,0x62,0x90,0x3b,0xcb,
-0xcb,0xca,0xd7,0x19,0x9e,0x99,0xea,0x95,0x00,0x07,0x00,0x94,0x90,0x08,0x8a,0xaa,
-0xbd,0xa7,0x0b,0xb6,0x89,0x58,0x52,0x01,0x98,0x8b,0x49,0xc0,0x5c,0xd7,0x45,0x6c,
-0xa0,0x09,0x97,0x69,0x1d,0x20,0x57,0x94,0x89,0xad,0x38,0x21,0x70,0x01,0xa0,0x83,
-0x1d,0x01,0xb9,0x00,0xf7,0x47,0x07,0x9a,0x73,0xaa,0xa1,0x0b,0x66,0xa5,0x96,0xb2,
-0x0b,0x77,0x96,0x97,0xc2,0x0b,0x16,0x7b,0x65,0x82,0x0b,0x0a,0x9a,0x96,0x82,0x0b,
-0x0b,0xac,0x96,0x82,0x0b,0x06,0x9b,0x80,0x82,0x0b,0x44,0x17,0x27,0xb0,0x1c,0x8b,
-0x00,0xb8,0x80,0x18,0x19,0x59,0xe9,0x95,0x0a,0xa8,0x81,0x71,0x45,0x5a,0xaa,0x97,
-0xd6,0x50,0x0a,0x00,0x91,0x79,0x90,0x0b,0xa8,0xa1,0x99,0x00,0x00,0x28,0xa3,0x4a,
-0x00,0x00,0x37,0x98,0x1a,0x08,0x05,0xb7,0x68,0x09,0xa6,0x00,0xe7,0x29,0xf1,0x1e,
-0x00,0x3e,0x66,0x00,0x09,0xd9,0x5c,0x83,0xb0,0x00,0x87,0x84,0x09,0xe1,0x00,0x08,
-0x78,0x49,0x86,0xa6,0x00,0xdc,0xd4,0x89,0xc8,0x50,0x03,0x92,0x07,0x8c,0x71,0x00,
-0x09,0x90,0x24,0xa2,0x00,0x29,0xdc,0x99,0xad,0x98,0x01,0x20,0x21,0xa4,0x5c,0xf0,
-0x1e,0x89,0xd8,0xd0,0x07,0xd7,0x88,0xd8,0xd0,0x0a,0x9a,0x82,0xb1,0xa0,0x08,0x79,
-0x4c,0xaa,0x80,0x0d,0xcd,0x3b,0xc9,0x20,0x04,0xa1,0x1a,0x62,0xc0,0x00,0xa9,0x8a,
-0xc8,0x85,0x18,0xdc,0x76,0x84,0x90,0x12,0x00,0x84,0xc1,0x52,0x00,0x42,0x2e,0x09,
-0x60,0xb0,0x6b,0xbb,0xb3,0x4b,0x12,0xc8,0x03,0x10,0x77,0x0f,0x00,0xb2,0xd0,0xbb,
-0xbe,0xb6,0x4c,0xb0,0x00,0x0a,0x00,0x21,0xb0,0x1d,0x48,0x05,0x05,0x00,0x23,0x04,
-0xbb,0xd6,0x15,0xa0,0x39,0xe9,0x4a,0xa4,0x96,0x12,0xa2,0x60,0x00,0x16,0xa8,0x55,
-0xf0,0x03,0x3f,0x0b,0x77,0xa9,0xd5,0xac,0x0b,0x89,0x90,0xb0,0x0a,0x38,0x8d,0x70,
-0xb0,0x0a,0x19,0x1a,0x6e,0x58,0x82,0x9d,0x91,0xb0,0x0a,0x00,0x0a,0x1b,0x60,0xf7,
-0x02,0xf3,0x12,0x31,0x35,0x40,0x00,0x0b,0x27,0xa5,0x19,0xa4,0x94,0x59,0xca,0x90,
-0x00,0x07,0x62,0x84,0x10,0x00,0x2f,0x1a,0xa7,0xa9,0xe5,0xac,0x0a,0xa7,0x90,0xb0,
-0x0a,0x07,0xb9,0x50,0x05,0x00,0x50,0x3a,0xdc,0xc0,0xb0,0x0a,0x1d,0x5d,0x02,0x63,
-0x01,0xf0,0x18,0xaa,0xda,0xaa,0x70,0x01,0x22,0xa4,0x22,0x00,0x04,0x77,0xc8,0x77,
-0x20,0x5a,0xaa,0xda,0xaa,0xa0,0x00,0x2b,0x4a,0x02,0x50,0x29,0xe3,0x06,0x8a,0x10,
-0x53,0x92,0x01,0xb5,0x00,0x00,0xca,0xb5,0x09,0xb2,0x4f,0x43,0x11,0x10,0xb4,0x24,
-0xf1,0x05,0x25,0x55,0xb9,0x55,0x50,0x24,0x44,0x44,0x44,0x40,0x00,0xd9,0x99,0x9c,
-0x00,0x49,0xd7,0x77,0x7d,0x91,0x0a,0x00,0xf0,0x06,0x00,0x2a,0x59,0x24,0x60,0x39,
-0xc7,0x01,0xc8,0x00,0x21,0x5a,0x99,0x3a,0x71,0x00,0x45,0x10,0x00,0x41,0x02,0x51,
-0x38,0xf1,0x3e,0x5a,0xc6,0xa9,0xda,0xb4,0x00,0x54,0xb0,0xa0,0x90,0x00,0xb7,0xba,
-0xea,0x90,0x0b,0xf7,0xaa,0x01,0xa0,0x64,0xb8,0xa5,0x79,0x50,0x00,0xb0,0xa0,0xbb,
-0x00,0x00,0xb4,0x54,0xbc,0x60,0x00,0xb7,0x58,0x00,0x85,0x03,0x80,0x00,0x93,0x83,
-0x39,0xb6,0xaa,0xdb,0xa8,0x02,0x75,0x01,0xa3,0x10,0x00,0xc4,0xb8,0xd9,0xa6,0x0b,
-0xe8,0xb9,0xda,0xb6,0x77,0xa8,0xa0,0x91,0x46,0x00,0xa0,0xb9,0xda,0xb6,0x00,0xa0,
-0x0a,0x00,0x32,0xa0,0x93,0xb4,0xfd,0x16,0x00,0x89,0x03,0x80,0x07,0x9d,0x5a,0xcb,
-0xa5,0x1a,0x9d,0x00,0x94,0x74,0xf2,0x0d,0x3a,0xcb,0xa3,0x37,0x09,0x26,0x00,0x00,
+0x90,0xbb,0xec,0xb4,0x20,0xb1,0x0b,0xf1,0x48,0x00,0x02,0x90,0x7e,0xac,0x60,0x09,
+0x1a,0x0b,0x08,0x20,0x6c,0xb4,0x0b,0x0b,0x00,0x26,0x95,0x0e,0x2a,0xd3,0x2c,0x6d,
+0x1e,0x80,0xc0,0x36,0x36,0x57,0xb6,0x80,0x36,0x99,0x74,0x4e,0x00,0x74,0xa4,0xc3,
+0xc8,0xa0,0x40,0x21,0x68,0x10,0x44,0x0b,0x99,0xe9,0x9e,0x00,0xb8,0x8e,0x88,0xe0,
+0x0b,0x00,0xb0,0x0b,0x00,0x6a,0xe9,0xaa,0x90,0x04,0xca,0xa7,0x50,0x00,0x6b,0xd8,
+0x8b,0xb0,0x05,0x52,0xb2,0x23,0x10,0x6a,0x0a,0x29,0x70,0x47,0x07,0xc0,0x06,0x30,
+0x8d,0x00,0xf2,0x1e,0x03,0x70,0xac,0xeb,0xe1,0x09,0x26,0xa0,0xa0,0x91,0x5b,0xa0,
+0xa0,0xa0,0x91,0x37,0x62,0xa0,0xa0,0xa1,0x1a,0x29,0xab,0xea,0xe1,0x48,0x56,0xa0,
+0xa0,0x91,0x35,0x78,0xa0,0xa0,0x91,0x73,0x96,0xab,0xeb,0xe1,0x60,0x20,0xa0,0x00,
+0x91,0xba,0x04,0xf3,0x1d,0xa0,0x07,0x61,0x10,0x08,0x25,0x2d,0x8a,0xb0,0x3b,0x86,
+0xb9,0x5a,0x10,0x38,0xc2,0x00,0xe8,0x00,0x0b,0x49,0x5b,0x48,0xa1,0x59,0x69,0x51,
+0xa3,0x33,0x25,0x68,0x00,0x07,0x00,0x64,0x98,0x2a,0x92,0x00,0x51,0x40,0x00,0x29,
+0x80,0xf9,0x02,0x01,0x37,0x00,0xf2,0x1c,0x1d,0xaa,0xd0,0x08,0x29,0x19,0x00,0xb0,
+0x4b,0x75,0x1a,0x11,0xb0,0x38,0x93,0x1d,0x88,0xc0,0x1c,0x5c,0x29,0x00,0xb0,0x36,
+0x46,0x4d,0xaa,0xd0,0x26,0x99,0x19,0x00,0xb0,0x55,0x96,0x49,0x00,0xb0,0x62,0x60,
+0xbd,0xaa,0xe6,0x37,0x00,0x00,0xfc,0x04,0xf1,0x19,0x07,0x36,0xab,0xeb,0xb4,0x4c,
+0xa3,0x00,0xb0,0x00,0x26,0x74,0x6a,0xdb,0xa0,0x2c,0x5b,0x00,0x00,0x00,0x36,0x47,
+0x6c,0xaa,0xc0,0x36,0x89,0x64,0x00,0xb0,0x74,0x95,0x6a,0x88,0xc0,0x40,0x10,0x65,
+0x11,0xb0,0x51,0x08,0xf0,0x24,0x04,0x50,0xac,0xca,0xd0,0x09,0x25,0x0b,0x10,0xb0,
+0x5a,0x91,0xa6,0x1b,0x50,0x37,0x52,0xca,0xda,0xe0,0x1a,0x68,0xa0,0x90,0xa0,0x45,
+0x24,0xaa,0xba,0xe0,0x16,0x77,0xa0,0x00,0x20,0x54,0x87,0xa0,0x00,0x54,0x50,0x40,
+0x5a,0xaa,0xb1,0x00,0x20,0x00,0x20,0x00,0x01,0x64,0x00,0xf1,0x19,0x08,0x26,0xac,
+0xea,0xa3,0x3b,0x94,0x09,0x36,0x30,0x48,0xa1,0x6c,0x68,0xd0,0x0a,0x1a,0x77,0x54,
+0x73,0x6c,0x9c,0x0b,0x0a,0x00,0x13,0x45,0x0b,0x0a,0x00,0x55,0x88,0x47,0x0a,0x16,
+0x71,0x64,0xb0,0x0c,0xb4,0xb5,0x05,0x02,0x62,0x03,0xf6,0x1d,0x60,0x0a,0x0c,0xb7,
+0x08,0x36,0xae,0x79,0x63,0x3b,0xb1,0x0a,0x09,0x90,0x17,0xa1,0x9d,0x69,0xa0,0x0b,
+0x76,0x0a,0x09,0x63,0x38,0x47,0x9d,0x89,0x18,0x17,0x74,0x49,0x1a,0x38,0x56,0x78,
+0x83,0x0a,0x81,0x51,0x30,0xa0,0x09,0x00,0x04,0x01,0xf2,0x1e,0x03,0x80,0x8a,0xaa,
+0xa5,0x09,0x29,0x18,0x54,0x91,0x6c,0xb2,0x92,0xa4,0x70,0x16,0x75,0x74,0xa3,0x90,
+0x2c,0x6c,0x09,0x26,0x63,0x36,0x47,0x6a,0xba,0xa2,0x36,0x79,0x00,0x82,0x00,0x55,
+0x99,0x00,0x82,0x00,0x71,0x50,0xaa,0xdb,0xa6,0x37,0x00,0xf2,0x21,0x20,0x03,0x00,
+0x00,0x02,0x70,0x0c,0x99,0x60,0x08,0x35,0x29,0x04,0x60,0x4c,0xa0,0x49,0x9d,0x20,
+0x16,0x64,0xaa,0xae,0xa5,0x1b,0x6a,0x51,0x94,0x70,0x26,0x35,0x18,0x9d,0x50,0x26,
+0x78,0x08,0xe5,0x80,0x54,0x85,0xa3,0x91,0x86,0x41,0x10,0x09,0xc0,0xa3,0x00,0xf0,
+0x1f,0x0d,0x8d,0x86,0xda,0xd3,0x0d,0x78,0xa0,0xa2,0xb0,0x0d,0x79,0x90,0x3e,0x30,
+0x0c,0x8c,0x86,0xa5,0xb5,0x00,0x16,0x72,0x70,0x00,0x00,0x8b,0xd7,0x18,0x10,0x08,
+0xcc,0x8b,0x88,0xa1,0x00,0x74,0x0b,0x2a,0x40,0x08,0x22,0x99,0x00,0x71,0x00,0xfd,
+0x03,0xf1,0x1e,0x03,0x80,0x35,0xd4,0x40,0x09,0x26,0xa4,0x44,0xc0,0x5c,0xb1,0xa8,
+0x88,0xd0,0x27,0x72,0xa6,0x66,0xd0,0x2c,0x78,0x23,0xc3,0x60,0x36,0x46,0x9d,0xba,
+0xa0,0x27,0x86,0x38,0xbb,0x20,0x54,0x87,0xb1,0xb2,0xc2,0x60,0x32,0x18,0xb0,0x22,
+0xb5,0x0e,0xf3,0x1e,0x03,0x80,0x00,0xa1,0x00,0x09,0x24,0xc8,0x88,0xd0,0x4b,0xa2,
+0xb6,0x66,0xc0,0x28,0x82,0xa2,0x22,0x20,0x2c,0x78,0xea,0xcc,0xa5,0x36,0x46,0xe4,
+0x77,0x35,0x38,0x96,0xdb,0xcc,0xb5,0x65,0x7b,0xa4,0x77,0x35,0x50,0x35,0x64,0x22,
+0x73,0x59,0x0a,0xf2,0x21,0x01,0x25,0x60,0x04,0x60,0x98,0xa4,0x70,0x09,0x37,0x55,
+0xa3,0x80,0x6b,0xa0,0x7b,0xbc,0xb2,0x17,0x54,0x28,0x52,0x21,0x2b,0x5b,0x7d,0x87,
+0x73,0x36,0x36,0x0e,0xa9,0x90,0x35,0x79,0x3a,0xa8,0x30,0x72,0x97,0xc3,0xbd,0x40,
+0x40,0x12,0x59,0x20,0x75,0x71,0x02,0xf0,0x1d,0x90,0x11,0xa3,0x10,0x07,0x26,0x77,
+0xc8,0x73,0x4c,0xa3,0x99,0xda,0xb2,0x26,0x83,0x96,0x94,0xa2,0x1b,0x3a,0x94,0xa5,
+0x72,0x59,0x79,0x6a,0xfd,0x91,0x24,0x67,0x09,0xc9,0x30,0x64,0x88,0x96,0x91,0xa3,
+0x70,0x40,0x30,0x91,0x01,0xf0,0x52,0x00,0x50,0x00,0x50,0x00,0x04,0x60,0x99,0xcb,
+0x96,0x09,0x37,0xa3,0x00,0x18,0x6b,0xa0,0x0b,0x9a,0x96,0x27,0x73,0x56,0x0a,0x00,
+0x1a,0x59,0xc4,0xc9,0xa7,0x58,0x57,0xd4,0xa0,0x27,0x34,0x58,0x64,0xc9,0xa7,0x72,
+0x84,0x64,0xc8,0x97,0x30,0x00,0x64,0xa1,0x37,0x03,0x50,0x35,0x80,0x80,0x08,0x21,
+0xa0,0xc0,0xb0,0x18,0x85,0x86,0x9b,0xb3,0x5b,0x70,0xa5,0x07,0x04,0x08,0x77,0xc1,
+0x6a,0x00,0x4a,0x86,0x92,0x7a,0x83,0x16,0x82,0x94,0x8a,0x00,0x47,0x86,0x99,0x9c,
+0x00,0x72,0x61,0xa8,0x09,0xa6,0x00,0x30,0x5f,0x00,0xf0,0x1e,0x50,0x59,0xd9,0x90,
+0x09,0x26,0x91,0xa6,0xa0,0x6c,0xa0,0x96,0x68,0xa0,0x15,0x54,0x93,0x88,0xa0,0x0b,
+0x99,0x9b,0x9a,0xd0,0x57,0x16,0x00,0x70,0x00,0x04,0x55,0x56,0x55,0x90,0x46,0x88,
+0x99,0x03,0x94,0x61,0x51,0x38,0x9a,0x41,0x00,0x01,0x00,0xf0,0x72,0x01,0x70,0x88,
+0xc9,0x85,0x08,0x28,0x57,0xa8,0x71,0x4b,0xb2,0xb9,0x9b,0x87,0x27,0x84,0xca,0xac,
+0x98,0x2c,0x6a,0x67,0x77,0x82,0x36,0x47,0xa5,0x55,0xa3,0x27,0x68,0xa5,0x55,0xa3,
+0x54,0x87,0x5d,0x8b,0xa1,0x60,0x31,0xa4,0x00,0x66,0x00,0x00,0x00,0x10,0x00,0x01,
+0xa0,0x11,0xb2,0x10,0x07,0x20,0xc8,0x88,0xd0,0x19,0x46,0xb6,0x66,0xd0,0x6a,0xc0,
+0xb2,0x22,0x30,0x07,0x30,0xdc,0xcc,0xc1,0x4e,0x93,0xd6,0x77,0x71,0x00,0x35,0xbc,
+0xcc,0xc1,0x4b,0x88,0x76,0x77,0x71,0x21,0x08,0x36,0x77,0xa0,0x09,0x9a,0xb8,0xd8,
+0xc1,0x08,0x8a,0xb9,0xc8,0xb1,0x09,0x99,0xbc,0x99,0x93,0x00,0x34,0x97,0x44,0x10,
+0x00,0xb5,0x55,0x5a,0x40,0x00,0xc7,0x77,0x7b,0x40,0x00,0xc6,0x66,0x6a,0x05,0x00,
+0xf1,0xff,0x75,0x6b,0x40,0x18,0xd8,0x88,0x8c,0xa5,0x00,0x23,0x00,0x05,0x00,0x01,
+0x3c,0x22,0x87,0x20,0x06,0x88,0x9c,0x88,0x81,0x02,0xaa,0xbd,0xaa,0x80,0x02,0x22,
+0x49,0x22,0x21,0x18,0x88,0xac,0x88,0x85,0x0a,0xaa,0xcc,0xaa,0xa5,0x00,0x01,0xc7,
+0x70,0x00,0x03,0x7c,0x30,0x7a,0x61,0x18,0x40,0x00,0x00,0x55,0x00,0x13,0x00,0x34,
+0x00,0x06,0x8e,0x88,0xda,0x81,0x01,0x44,0x89,0x44,0x30,0x01,0x55,0x99,0x55,0x30,
+0x19,0x9a,0xcb,0xaa,0x96,0x07,0x9b,0x47,0x47,0x90,0x19,0xac,0x9b,0xc9,0x96,0x03,
+0x6b,0x72,0xc5,0x70,0x16,0x79,0x13,0xdb,0x05,0x03,0xa5,0x78,0x28,0xb7,0x00,0x24,
+0x40,0x00,0x00,0x2a,0xa7,0x58,0xd3,0x98,0x08,0x67,0x52,0x91,0x18,0x39,0xed,0x89,
+0x92,0x78,0x06,0xba,0x76,0xb0,0x88,0x57,0x52,0x40,0xb0,0x28,0x1c,0xba,0xb7,0xd2,
+0xb8,0x0b,0xa8,0xa3,0x92,0x18,0x0c,0xba,0xb0,0x90,0x08,0x08,0x00,0x85,0xa0,0xa5,
+0x2c,0x99,0x7a,0xa8,0xc2,0x03,0x99,0x71,0xb7,0xc2,0x18,0x99,0xbd,0xa7,0x81,0x05,
+0x84,0x98,0x47,0x70,0x05,0x84,0x88,0x47,0x70,0x03,0x7d,0x77,0xd8,0x40,0x07,0x7d,
+0x77,0xd7,0x71,0x28,0xae,0x88,0xeb,0x86,0x19,0x71,0x00,0x16,0xa2,0x00,0x00,0xb0,
+0x00,0x70,0x03,0xaa,0xea,0xad,0x40,0x00,0x00,0xb0,0xb4,0x00,0x2a,0xaa,0xee,0xaa,
+0xa6,0x00,0x5c,0xd6,0x55,0x20,0x2c,0x9b,0x33,0x37,0x60,0x00,0x1d,0x99,0x9b,0x60,
+0x00,0x19,0x00,0x05,0x60,0x00,0x1d,0xaa,0xab,0x60,0x01,0xb1,0x00,0x39,0x60,0x59,
+0xd8,0x59,0xc0,0x00,0x3a,0xe8,0x01,0xc6,0x81,0x00,0xa0,0x69,0xd4,0x20,0x7c,0xfa,
+0x20,0xb1,0x42,0x0a,0xe7,0x7c,0xea,0x73,0x48,0xba,0x10,0xb0,0x00,0x70,0xa0,0x00,
+0xb0,0x09,0x00,0xa0,0x00,0xaa,0xa4,0x01,0xb1,0x5b,0xd9,0xd0,0x39,0xd8,0x67,0xb4,
+0xc0,0x1a,0xe9,0x56,0xa2,0xb0,0x00,0xb0,0x39,0xd9,0x90,0x4b,0xf9,0x79,0xd9,0x93,
+0x08,0xe7,0x80,0x93,0x55,0x1a,0xa7,0x94,0xc9,0x95,0x72,0xa0,0x85,0x42,0x95,0x00,
+0xa0,0x80,0x02,0xa3,0x00,0x00,0x02,0x00,0x00,0x3e,0xbc,0x28,0x06,0x10,0x09,0x28,
+0xc7,0x5a,0x90,0x0b,0xa7,0x78,0x28,0x60,0x09,0x29,0xc7,0x9c,0xa4,0x0b,0xa8,0x61,
+0x64,0x13,0x09,0x27,0x90,0xa8,0x90,0x2c,0x9c,0x8b,0x9b,0xe0,0x25,0x47,0x06,0x58,
+0x20,0x00,0x27,0x59,0x08,0x00,0x01,0x00,0xf1,0x0f,0x26,0xb8,0x75,0xab,0x30,0x09,
+0xaa,0x7c,0x57,0xb3,0x0b,0x95,0xa3,0xb9,0x50,0x3a,0x66,0x57,0x9a,0x82,0x39,0xb8,
+0x89,0x8b,0x83,0x00,0xc7,0x77,0x7c,0x00,0x05,0x00,0xf0,0x1d,0x38,0xe9,0x99,0x9e,
+0x93,0x00,0x00,0x00,0x0b,0x00,0x19,0x9d,0x0b,0x57,0x50,0x00,0x0a,0x0b,0x50,0x00,
+0x28,0xbd,0x0b,0x43,0x94,0x13,0x9f,0x9c,0xff,0x70,0x00,0xc1,0x11,0x1c,0x00,0x00,
+0xd7,0x77,0x7d,0x00,0x00,0xe8,0x88,0x8e,0x0d,0x01,0x76,0x0b,0x00,0x00,0xb0,0x03,
+0xab,0x00,0x01,0x00,0xf0,0x1e,0x03,0x94,0x05,0x60,0x40,0x1c,0x58,0xa5,0xb8,0x40,
+0x16,0x43,0x65,0x60,0x07,0x0b,0x99,0x92,0xca,0xb6,0x0b,0x22,0xb2,0x30,0x00,0x0c,
+0x55,0xb5,0x87,0xa1,0x0d,0x99,0xb5,0xa2,0x01,0x0a,0x00,0xb5,0x60,0x0a,0x0a,0x1a,
+0x82,0xba,0xb5,0xa1,0x02,0xf3,0x1f,0x50,0x0d,0xaa,0x3a,0xba,0x60,0x0a,0x0a,0x65,
+0x00,0x20,0x0d,0xaa,0x65,0x9d,0x92,0x0a,0x0a,0x65,0x98,0x01,0x0a,0x1a,0x74,0xa5,
+0x97,0x0d,0x9a,0x83,0xa2,0x90,0x18,0x0a,0xa1,0xa0,0xa0,0x56,0x0a,0xb0,0xb7,0x83,
+0x81,0xaa,0x83,0xa2,0x18,0x66,0x00,0xf3,0x20,0x10,0x00,0x00,0x0d,0xd3,0xa3,0x6b,
+0xd1,0x09,0x68,0x60,0x99,0x81,0x0d,0xc5,0x39,0x18,0x81,0x09,0x63,0x94,0x48,0x81,
+0x09,0x7a,0x50,0x88,0x81,0x0d,0xc4,0xda,0x98,0x81,0x16,0x63,0x80,0x99,0xb0,0x43,
+0x63,0xda,0x98,0x10,0x74,0xb1,0x80,0x98,0x36,0x00,0xff,0x00,0x01,0x20,0x00,0x00,
+0x07,0x50,0x00,0x1e,0xbb,0xbb,0xbc,0x19,0x00,0x00,0x0c,0x08,0x00,0x04,0xf1,0x1f,
+0x0b,0x0b,0xbd,0xdb,0xbb,0xb4,0x00,0x0c,0x10,0x72,0x00,0x00,0xb3,0x00,0x3d,0x30,
+0x06,0xca,0xaa,0x98,0xc1,0x00,0x00,0x28,0x00,0x10,0x03,0xaa,0xbd,0xaa,0x90,0x00,
+0x00,0x29,0x00,0x00,0x01,0x11,0x39,0x11,0x11,0x19,0x99,0x99,0x99,0x96,0x59,0x00,
+0xf0,0x3e,0x06,0x73,0xc6,0x5a,0xc0,0x07,0x21,0xb4,0x00,0xb0,0x07,0xb5,0xd9,0x4a,
+0xc0,0x06,0x30,0x48,0x20,0xb0,0x06,0xb5,0x87,0x6a,0xb0,0x06,0x51,0x98,0x32,0xa0,
+0x2a,0xab,0xaa,0xba,0xa7,0x00,0x88,0x00,0x8a,0x20,0x0a,0x30,0x00,0x02,0xa2,0x00,
+0x40,0x00,0x40,0x00,0x02,0xb2,0x00,0xa3,0x00,0x0c,0x7c,0x7a,0xbb,0xa7,0x0a,0x8a,
+0x00,0x00,0x00,0x0a,0x4a,0x0b,0x9a,0x90,0x6d,0x9d,0x0a,0x01,0x90,0x0a,0x7a,0x05,
+0x00,0xe2,0x6b,0x0a,0x01,0x90,0x47,0x0a,0x29,0x01,0x97,0x92,0x5b,0xa2,0x00,0xc8,
+0xbe,0x00,0xf3,0x22,0x30,0x00,0x40,0x00,0x01,0xb1,0x00,0x76,0x00,0x0c,0x7c,0x8a,
+0xaa,0xa9,0x0a,0x8a,0x81,0x00,0x09,0x0a,0x4a,0x0a,0x00,0x20,0x6d,0x9d,0x0b,0x29,
+0x81,0x0a,0x7a,0x0b,0x81,0x00,0x0a,0x7a,0x0b,0x00,0x01,0x46,0x0a,0x0b,0x00,0x0a,
+0x91,0x5b,0x06,0xaa,0xa6,0x91,0x01,0xf1,0x09,0x20,0x00,0x00,0x00,0x1e,0xba,0xa1,
+0x00,0x00,0xa3,0x03,0xa0,0x00,0x1c,0xea,0xae,0xba,0x80,0x14,0xa0,0x0b,0x00,0xb0,
+0x00,0x05,0x00,0xf2,0x8b,0xeb,0xbb,0xbb,0xb0,0x00,0xa0,0x00,0x00,0x05,0x00,0xb0,
+0x00,0x00,0x1a,0x00,0xaa,0xaa,0xaa,0xb4,0x0a,0xae,0xaa,0xcc,0xa4,0x00,0x0b,0x14,
+0x65,0x00,0x00,0x00,0x38,0x00,0x00,0x02,0xda,0xbd,0xab,0xa0,0x02,0x80,0x38,0x01,
+0xa0,0x2b,0xdb,0xce,0xbb,0xd7,0x00,0x01,0xc8,0x70,0x00,0x01,0x6b,0x30,0x7a,0x40,
+0x1a,0x50,0x00,0x01,0x77,0x1a,0xae,0xaa,0xcc,0xa6,0x00,0x0a,0x00,0x64,0x00,0x00,
+0x77,0x99,0x99,0x96,0x02,0xc0,0x11,0x11,0xb1,0x2d,0xb2,0xca,0xd0,0xb0,0x12,0xb2,
+0x80,0xa0,0xb0,0x00,0xb2,0xd9,0xd0,0xb0,0x00,0xb1,0x40,0x00,0xb0,0x00,0xb0,0x00,
+0x6a,0x70,0x1a,0xae,0xaa,0xdb,0xa6,0x00,0x09,0x00,0x77,0x30,0x07,0xaa,0xaa,0x86,
+0x40,0x02,0x50,0x73,0x02,0xb0,0x00,0xa0,0x36,0x09,0x20,0x1a,0xaa,0xbd,0xaa,0xa6,
+0x00,0x07,0xbc,0xa1,0x00,0x04,0xb6,0x29,0x2b,0x81,0x29,0x10,0x29,0x00,0x56,0x5a,
+0x00,0xf0,0x3e,0x68,0x00,0x43,0x00,0x04,0xca,0x99,0x99,0xc2,0x2b,0x7c,0x88,0x82,
+0x82,0x01,0x90,0xa0,0x00,0x91,0x05,0x99,0xd9,0x96,0xa1,0x00,0x80,0xa0,0x61,0xb0,
+0x00,0xc9,0xd9,0xc2,0xb0,0x00,0x00,0x00,0x19,0x90,0x1a,0xae,0xaa,0xdc,0xa6,0x01,
+0x09,0x05,0x63,0x00,0x04,0xb2,0x4d,0x99,0xa0,0x01,0x15,0xbb,0x2a,0x50,0x1b,0x63,
+0x06,0xfb,0x10,0x00,0x25,0xc7,0x14,0xb8,0x00,0x93,0xb9,0x99,0xc0,0x06,0x70,0xb0,
+0x6c,0x03,0x32,0xb8,0x88,0xc0,0x5a,0x00,0xf0,0x0e,0x69,0x00,0x53,0x00,0x02,0xda,
+0xab,0xaa,0xb4,0x1c,0x86,0xc8,0xb4,0x64,0x23,0x77,0xc7,0x74,0x74,0x00,0xb5,0xb5,
+0x77,0x73,0x00,0xc6,0xc7,0x87,0x82,0x0a,0x00,0xf1,0x24,0x91,0x00,0x40,0x30,0x4a,
+0xa0,0x19,0x9e,0x99,0xcb,0x96,0x00,0x07,0x26,0x43,0x00,0x02,0x88,0x9c,0x88,0x60,
+0x18,0x8a,0xab,0x99,0x85,0x00,0x6b,0x21,0x6b,0x10,0x02,0x98,0x87,0x77,0xa0,0x00,
+0xd9,0xc9,0xca,0x80,0x00,0xa0,0x81,0x72,0x80,0x29,0x99,0x99,0x99,0x97,0xe1,0x00,
+0xf1,0x46,0x05,0x7a,0x70,0x90,0x00,0x0a,0x6b,0x62,0xd9,0x91,0x0a,0x77,0xba,0x37,
+0x00,0x0a,0x2a,0x25,0x09,0x10,0x05,0x77,0x71,0x02,0x10,0x03,0xcb,0xbb,0xba,0x90,
+0x03,0x64,0x54,0x62,0x90,0x3b,0xcb,0xcb,0xca,0xd7,0x19,0x9e,0x99,0xea,0x95,0x00,
+0x07,0x00,0x94,0x90,0x08,0x8a,0xaa,0xbd,0xa7,0x0b,0xb6,0x89,0x58,0x52,0x01,0x98,
+0x8b,0x49,0xc0,0x5c,0xd7,0x45,0x6c,0xa0,0x09,0x97,0x69,0x1d,0x20,0x57,0x94,0x89,
+0xad,0x38,0x21,0x70,0x01,0xa0,0xb7,0xcb,0x01,0x01,0xb9,0x00,0xf7,0x46,0x07,0x9a,
+0x73,0xaa,0xa1,0x0b,0x66,0xa5,0x96,0xb2,0x0b,0x77,0x96,0x97,0xc2,0x0b,0x16,0x7b,
+0x65,0x82,0x0b,0x0a,0x9a,0x96,0x82,0x0b,0x0b,0xac,0x96,0x82,0x0b,0x06,0x9b,0x80,
+0x82,0x0b,0x44,0x17,0x27,0xb0,0x1c,0x8b,0x00,0xb8,0x80,0x18,0x19,0x59,0xe9,0x95,
+0x0a,0xa8,0x81,0x71,0x45,0x5a,0xaa,0x97,0xd6,0x50,0x0a,0x00,0x91,0x79,0x90,0x0b,
+0xa8,0xa1,0x99,0x00,0x00,0x28,0xa3,0x4a,0x00,0x00,0x37,0x98,0x1a,0x08,0x05,0xb7,
+0x68,0x09,0xa6,0xc1,0x03,0xf0,0x5b,0x09,0x00,0x3e,0x66,0x00,0x09,0xd9,0x5c,0x83,
+0xb0,0x00,0x87,0x84,0x09,0xe1,0x00,0x08,0x78,0x49,0x86,0xa6,0x00,0xdc,0xd4,0x89,
+0xc8,0x50,0x03,0x92,0x07,0x8c,0x71,0x00,0x09,0x90,0x24,0xa2,0x00,0x29,0xdc,0x99,
+0xad,0x98,0x01,0x20,0x21,0x01,0x90,0x00,0x00,0xa0,0x89,0xd8,0xd0,0x07,0xd7,0x88,
+0xd8,0xd0,0x0a,0x9a,0x82,0xb1,0xa0,0x08,0x79,0x4c,0xaa,0x80,0x0d,0xcd,0x3b,0xc9,
+0x20,0x04,0xa1,0x1a,0x62,0xc0,0x00,0xa9,0x8a,0xc8,0x85,0x18,0xdc,0x76,0x84,0x90,
+0x12,0x00,0x84,0xc1,0x52,0x00,0x42,0x00,0x00,0x00,0x04,0xb0,0x6b,0xbb,0xb3,0x4b,
+0x12,0xc8,0x03,0x10,0x77,0x0f,0x00,0xa0,0xd0,0xbb,0xbe,0xb6,0x4c,0xb0,0x00,0x0a,
+0x00,0x21,0x05,0x00,0x17,0x00,0x05,0x00,0x22,0x04,0xbb,0x95,0x00,0xf2,0x1e,0x0a,
+0x39,0xe9,0x4a,0xa4,0x96,0x12,0xa2,0x60,0x00,0x16,0x99,0x99,0x90,0x00,0x3f,0x0b,
+0x77,0xa9,0xd5,0xac,0x0b,0x89,0x90,0xb0,0x0a,0x38,0x8d,0x70,0xb0,0x0a,0x19,0x1a,
+0x00,0xb0,0x0a,0x19,0x9d,0x91,0xb0,0x0a,0x00,0x0a,0x1b,0x60,0xf7,0x02,0xf3,0x12,
+0x31,0x35,0x40,0x00,0x0b,0x27,0xa5,0x19,0xa4,0x94,0x59,0xca,0x90,0x00,0x07,0x62,
+0x84,0x10,0x00,0x2f,0x1a,0xa7,0xa9,0xe5,0xac,0x0a,0xa7,0x90,0xb0,0x0a,0x07,0xb9,
+0x50,0x05,0x00,0x92,0x3a,0xdc,0xc0,0xb0,0x0a,0x00,0x00,0x0a,0x80,0x63,0x01,0xf1,
+0x1a,0xaa,0xda,0xaa,0x70,0x01,0x22,0xa4,0x22,0x00,0x04,0x77,0xc8,0x77,0x20,0x5a,
+0xaa,0xda,0xaa,0xa0,0x00,0x2b,0x4a,0x02,0x50,0x29,0xe3,0x06,0x8a,0x10,0x53,0x92,
+0x01,0xb5,0x00,0x00,0xca,0xb5,0x09,0xb2,0x00,0x62,0x85,0x04,0xf1,0x08,0x20,0x00,
+0x00,0x25,0x55,0xb9,0x55,0x50,0x24,0x44,0x44,0x44,0x40,0x00,0xd9,0x99,0x9c,0x00,
+0x49,0xd7,0x77,0x7d,0x91,0x0a,0x00,0xf1,0x57,0x00,0x2a,0x59,0x24,0x60,0x39,0xc7,
+0x01,0xc8,0x00,0x21,0x5a,0x99,0x3a,0x71,0x00,0x45,0x10,0x00,0x41,0x02,0x80,0x00,
+0xa0,0x00,0x5a,0xc6,0xa9,0xda,0xb4,0x00,0x54,0xb0,0xa0,0x90,0x00,0xb7,0xba,0xea,
+0x90,0x0b,0xf7,0xaa,0x01,0xa0,0x64,0xb8,0xa5,0x79,0x50,0x00,0xb0,0xa0,0xbb,0x00,
+0x00,0xb4,0x54,0xbc,0x60,0x00,0xb7,0x58,0x00,0x85,0x03,0x80,0x00,0x93,0x83,0x39,
+0xb6,0xaa,0xdb,0xa8,0x02,0x75,0x01,0xa3,0x10,0x00,0xc4,0xb8,0xd9,0xa6,0x0b,0xe8,
+0xb9,0xda,0xb6,0x77,0xa8,0xa0,0x91,0x46,0x00,0xa0,0xb9,0xda,0xb6,0x00,0xa0,0x0a,
+0x00,0x32,0xa0,0x93,0xb4,0x27,0x01,0x00,0x89,0x03,0xf0,0x1b,0x07,0x9d,0x5a,0xcb,
+0xa5,0x1a,0x9d,0x00,0x64,0x00,0x0a,0x0a,0x3a,0xcb,0xa3,0x37,0x09,0x26,0x00,0x00,
 0x29,0x9b,0xed,0x99,0xa6,0x16,0xab,0x12,0x98,0x70,0x04,0x2a,0x36,0x4b,0x50,0x00,
-0x5a,0x62,0x00,0x57,0xdb,0x5e,0xf0,0x20,0x9d,0x83,0x72,0xa0,0x2b,0x8d,0x86,0x72,
-0xa0,0x05,0x7d,0x74,0x72,0xa0,0x09,0x0a,0x28,0x20,0xb0,0x05,0x09,0x78,0x0a,0xa0,
-0x19,0x9a,0xee,0xa9,0xb5,0x04,0x8b,0x22,0x89,0x70,0x16,0x59,0x56,0x4a,0x40,0x00,
-0x57,0x30,0x00,0x54,0x01,0x10,0x04,0x4f,0x0b,0xf2,0x1b,0x5c,0x77,0x73,0x4a,0xb7,
-0xc6,0x55,0x51,0x00,0x57,0xd6,0x55,0xd0,0x01,0xc5,0x98,0x77,0xd0,0x0b,0xe6,0x7a,
-0x97,0xa0,0x65,0xa9,0x1d,0xa9,0x80,0x00,0xa3,0xbb,0x29,0x60,0x00,0xa0,0x17,0xfb,
-0x10,0x00,0xa5,0xb5,0x14,0x58,0x02,0xf1,0x0f,0x6b,0xbe,0xbd,0xcb,0xb1,0x00,0x0a,
-0x08,0x20,0x00,0x0a,0xae,0xbd,0xba,0x70,0x0a,0x0a,0x08,0x20,0xa0,0x0a,0x29,0x08,
-0x31,0xa0,0x0c,0xa1,0x03,0xab,0xa0,0x5c,0x46,0x33,0x0e,0xaa,0xaa,0x0a,0x00,0xf0,
-0x11,0x0a,0xac,0xca,0xea,0xa5,0x05,0x9c,0xca,0xe9,0x90,0x08,0x25,0x50,0xa0,0xa1,
-0x08,0x9b,0xb9,0xd8,0xd1,0x00,0x13,0xa1,0x11,0x10,0x2a,0xaf,0xaa,0xbd,0xa6,0x00,
-0x8b,0x39,0x2c,0xf3,0x27,0x18,0xed,0xc6,0x10,0x0a,0x96,0x20,0x04,0xa1,0x08,0x8b,
-0xb8,0xd8,0x84,0x09,0x8a,0xa7,0xd7,0xc1,0x06,0x98,0xa8,0x97,0x90,0x03,0xa0,0xb8,
-0x88,0x82,0x1a,0x9c,0xd7,0x77,0xa0,0x07,0xa0,0xa9,0x99,0xc0,0x26,0x90,0x6e,0x99,
-0x60,0x00,0x95,0x59,0x6a,0x10,0x00,0x95,0x98,0x68,0x96,0xd3,0x09,0xf4,0x1c,0x6c,
-0xaa,0xd0,0x5b,0xda,0x68,0x55,0xc0,0x01,0x90,0x67,0x44,0xc0,0x47,0xc6,0x8b,0x99,
-0xd0,0x37,0xa4,0x74,0x00,0xb0,0x05,0xd1,0x4d,0xbe,0x90,0x09,0x4a,0x0b,0x0a,0x00,
-0x1b,0x05,0x3a,0x0a,0x12,0x82,0x04,0xb1,0x0c,0xb3,0x6c,0x06,0x00,0x9d,0x21,0xb0,
-0x1d,0x99,0xe0,0x29,0xac,0x2d,0x88,0xd0,0x00,0x39,0x1a,0x9e,0x59,0xf0,0x05,0x1d,
-0x99,0xd0,0x0b,0xea,0x19,0x00,0xa0,0x55,0xb6,0x3b,0xbe,0x90,0x00,0xb0,0x07,0x2a,
-0x00,0x00,0xb0,0x9b,0x6f,0x47,0xb2,0xb2,0x0a,0xb6,0x66,0x54,0xf3,0x1d,0x0b,0x06,
-0xb8,0x82,0x0b,0x0b,0x09,0x63,0x10,0x0b,0x0b,0x46,0x1b,0x00,0x02,0x9f,0x99,0x9d,
-0x10,0x00,0xb0,0x32,0x0c,0x00,0x00,0xb0,0x75,0x0c,0x00,0x00,0x60,0xa9,0x06,0x00,
-0x00,0x09,0xab,0x00,0x73,0x1a,0xb5,0x08,0xaa,0xc1,0xd4,0x2d,0x10,0x10,0x44,0x47,
-0xf0,0x06,0xae,0x30,0x02,0xd1,0x02,0xb0,0x01,0xde,0xaa,0xea,0xac,0x02,0xb0,0x0b,
-0x00,0xb0,0x0e,0xaa,0xea,0xac,0x01,0x09,0x00,0xd2,0x3d,0xaa,0xea,0xac,0x08,0x40,
-0x0b,0x00,0xb0,0xb0,0x00,0xb4,0xb9,0xd2,0x00,0x10,0x30,0x36,0x00,0xf4,0x1c,0xc9,
-0x19,0xda,0xc4,0x0b,0x0b,0x00,0xb0,0x73,0x6d,0xb9,0xab,0x77,0xc0,0x0a,0x52,0xa7,
-0x24,0x00,0x0b,0xa8,0xa8,0xce,0xa3,0x0b,0x75,0xa9,0x0a,0x00,0x0c,0x98,0xa9,0xae,
-0xa5,0x47,0x52,0x90,0x0a,0x00,0x72,0x17,0x80,0x0a,0xab,0x0f,0x10,0x00,0xb4,0x49,
-0xf4,0x1b,0x89,0xcc,0x98,0x19,0x27,0x86,0xbb,0x68,0x7c,0xcc,0x2d,0x43,0x32,0x08,
-0x89,0x8b,0xb9,0xa8,0x0b,0xbc,0x87,0xc7,0x38,0x0a,0x9a,0x53,0x86,0x48,0x0b,0xab,
-0x27,0xc9,0x47,0x45,0x78,0x35,0xcc,0x46,0x61,0x3a,0x34,0x24,0xd3,0x2d,0x10,0x32,
-0xfe,0x06,0x32,0x3c,0x11,0x10,0xfe,0x06,0xe0,0x79,0x99,0x99,0x20,0x00,0x12,0x22,
-0x22,0x00,0x00,0x57,0x77,0x77,0x10,0x0f,0x00,0x30,0x30,0x00,0xb0,0x65,0x07,0x42,
-0xb1,0x11,0x17,0x50,0x0b,0x15,0x01,0x40,0x01,0x10,0xa1,0x52,0x08,0xf0,0x0b,0xa9,
-0x80,0x0b,0x00,0x04,0x55,0x20,0x0b,0x00,0x03,0x44,0x3b,0xbe,0xb9,0x06,0x88,0x30,
-0x0b,0x00,0x07,0x9a,0x50,0x0b,0x00,0x0a,0x02,0x13,0x22,0x10,0x9a,0x05,0x00,0x00,
-0x7a,0x08,0x21,0x04,0x10,0x7a,0x0e,0xf0,0x22,0x4b,0xbb,0xb0,0x79,0x99,0x20,0x00,
-0xb0,0x27,0x75,0x00,0x00,0xb0,0x13,0x32,0x2b,0xbb,0xb0,0x37,0x76,0x37,0x00,0x60,
-0x3a,0x97,0x37,0x00,0x00,0x54,0x0a,0x37,0x00,0x43,0x5b,0x9b,0x38,0x00,0x73,0x55,
-0x00,0x1b,0xbb,0xb0,0x03,0x20,0x00,0x50,0x00,0x01,0x17,0x0c,0xf5,0x1a,0x49,0x99,
-0x8c,0xcb,0xb5,0x09,0x96,0x09,0x10,0x00,0x03,0x32,0x0b,0x99,0x90,0x07,0x74,0x0b,
-0x22,0xb0,0x1a,0x97,0x0a,0x00,0xb0,0x17,0x09,0x48,0x00,0xb0,0x1c,0x9a,0xc3,0x00,
-0xb0,0x17,0x03,0x90,0x8a,0x70,0x00,0x91,0x1e,0xf3,0x1e,0x04,0x70,0x0e,0xbe,0x00,
-0x68,0x98,0x29,0x0b,0x00,0x29,0x96,0xa4,0x0a,0x81,0x03,0x33,0x71,0x12,0x20,0x16,
-0x65,0xcb,0xab,0xa0,0x3a,0x97,0x2a,0x0b,0x20,0x45,0x0a,0x06,0xc6,0x00,0x4c,0x9b,
-0x6d,0xad,0x71,0x45,0x03,0xd4,0x04,0xd2,0x47,0x08,0x40,0x02,0x30,0x00,0x00,0xf7,
-0x17,0x90,0x59,0x99,0x7a,0xca,0xa1,0x08,0x87,0x00,0xb0,0xd6,0x62,0x90,0xb0,0x00,
-0x28,0x87,0x5b,0xeb,0xb0,0x09,0x98,0xbc,0x04,0x00,0x5c,0x07,0x60,0x0d,0x8b,0x78,
-0xe9,0x93,0x0a,0xfb,0x14,0xf1,0x21,0x01,0x10,0x02,0x10,0x00,0x02,0x80,0x0b,0x10,
-0x00,0x49,0xa9,0x3e,0xaa,0xc2,0x02,0x22,0xc2,0x00,0x92,0x06,0x65,0x8b,0x99,0x91,
-0x08,0x85,0x4a,0x69,0xa1,0x1a,0x97,0x46,0x19,0xa0,0x17,0x09,0x4d,0xb8,0xb0,0x1c,
-0x9a,0x22,0x00,0xb0,0x17,0x00,0x00,0x5f,0x1e,0x02,0xf4,0x0d,0x00,0x3a,0x1e,0xf3,
-0x1b,0x0b,0x70,0x27,0x97,0x56,0x6d,0x87,0x08,0x96,0x12,0x2b,0x21,0x03,0x32,0x67,
-0x6b,0x00,0x06,0x75,0x3c,0x3b,0x00,0x0a,0x98,0x0a,0x09,0x10,0x0a,0x0a,0x0b,0x69,
-0x44,0x0c,0x9b,0xea,0x43,0x88,0x0a,0x00,0x10,0x00,0xb7,0x09,0x46,0xf0,0x2c,0x26,
-0x8a,0x80,0x47,0xa7,0x34,0xb0,0x00,0x14,0x44,0x11,0xb1,0x10,0x17,0x75,0x69,0xe9,
-0x95,0x18,0x86,0x00,0xa0,0x00,0x2a,0x99,0x4b,0xba,0xd0,0x27,0x0a,0x44,0x00,0xb0,
-0x29,0x4b,0x45,0x11,0xb0,0x2a,0x54,0x4b,0x99,0xd0,0x02,0x20,0x12,0x00,0x50,0x01,
-0x90,0x0a,0x07,0x60,0x59,0x99,0x6d,0xad,0xa1,0x19,0x7c,0x5c,0xf4,0x0b,0x03,0x32,
-0x37,0xd7,0x60,0x17,0x75,0x14,0xc4,0x40,0x1a,0x99,0x11,0xb1,0x10,0x27,0x0a,0x68,
-0xd8,0x83,0x2c,0x9b,0x00,0xb0,0x00,0x27,0x1e,0x2d,0x00,0xd9,0x21,0xf2,0x1c,0xb2,
-0x00,0x39,0xb8,0x89,0xeb,0x98,0x05,0x53,0x00,0xb2,0x00,0x04,0x43,0x7a,0xeb,0xa7,
-0x0d,0xd8,0x00,0xc4,0x00,0x0a,0x98,0x44,0x07,0x52,0x09,0x09,0x7a,0x00,0x79,0x0d,
-0x9b,0x4a,0x01,0x8b,0x09,0x00,0x08,0xab,0x40,0x02,0x96,0x00,0xf3,0x1c,0x4a,0xdb,
-0xc4,0x59,0xa9,0x54,0xb0,0x73,0x16,0x64,0x62,0xa0,0x82,0x04,0x43,0x3c,0x29,0xb0,
-0x17,0x75,0x31,0x60,0x00,0x1a,0x98,0x58,0x74,0x70,0x27,0x0a,0x9a,0x02,0x94,0x2c,
-0x9c,0x8a,0x00,0xa7,0x27,0x00,0x07,0xab,0x50,0x84,0x2c,0x01,0xb1,0x03,0xf2,0x1d,
-0x7a,0xea,0xa4,0x58,0x98,0x48,0xc6,0x40,0x19,0x96,0x18,0x62,0xa0,0x03,0x32,0x4b,
-0x64,0xc2,0x17,0x75,0x66,0x66,0x63,0x2a,0x99,0x5a,0xaa,0xc0,0x27,0x0a,0x74,0x00,
-0xb0,0x2c,0x9b,0x7a,0x88,0xd0,0x27,0x00,0x75,0x11,0xb0,0x02,0x32,0x00,0xf3,0x1c,
-0x6b,0xaa,0xe0,0x58,0x98,0x63,0x00,0xb0,0x19,0x95,0x4a,0x99,0xb0,0x03,0x32,0x47,
-0x77,0x71,0x06,0x63,0x23,0xc3,0x30,0x2b,0x99,0x9a,0xea,0xa5,0x27,0x0a,0x03,0xd6,
-0x00,0x2c,0x9a,0x5d,0x1b,0x70,0x27,0x00,0xc4,0x01,0xb7,0x23,0x09,0xf1,0x21,0x03,
-0x05,0x00,0x01,0x80,0x19,0x05,0x50,0x59,0x99,0xa1,0x00,0xa4,0x19,0x96,0x9b,0xaa,
-0xc3,0x03,0x32,0x45,0x00,0xb0,0x17,0x74,0x4a,0x77,0xd0,0x1a,0x97,0x1a,0x4c,0x30,
-0x27,0x0a,0x0b,0x0a,0x02,0x2c,0x9a,0x7a,0x0b,0x09,0x27,0x02,0xd1,0x0b,0xa6,0x18,
-0x04,0x03,0xa0,0x00,0xf5,0x1a,0x9a,0xaa,0xd2,0x49,0xa8,0x81,0x91,0x72,0x05,0x53,
-0x84,0xc6,0x72,0x04,0x42,0x86,0xd8,0x82,0x08,0x85,0x81,0x22,0x62,0x0a,0x97,0x88,
-0x6b,0x62,0x08,0x09,0x98,0x7b,0x62,0x0d,0x9b,0x85,0x00,0x62,0x08,0x07,0x30,0xde,
-0x3d,0x01,0xfe,0x10,0xf1,0x1b,0x68,0xd8,0x82,0x48,0x98,0x37,0xd7,0x71,0x19,0x96,
-0x78,0xd8,0x84,0x03,0x32,0x15,0x55,0x40,0x17,0x74,0x39,0x55,0xc0,0x1a,0x98,0x3b,
-0x88,0xd0,0x27,0x0a,0x3b,0x77,0xd0,0x2c,0x9b,0x36,0x00,0xb0,0x27,0x00,0x36,0x07,
-0xf5,0x1c,0x00,0x0e,0x01,0x10,0x02,0xdc,0x00,0xf0,0x1b,0x7a,0x90,0x39,0xa8,0x8b,
-0x16,0x95,0x04,0x42,0x4d,0x78,0xd1,0x06,0x64,0xa2,0x33,0x38,0x08,0x85,0x2c,0x88,
-0xb0,0x0a,0x87,0x2c,0x99,0xb0,0x08,0x09,0x08,0x04,0x50,0x0d,0x9a,0x07,0x4a,0x10,
-0x08,0x00,0x9a,0xac,0x96,0xc4,0x2d,0xf6,0x1f,0x20,0x02,0x80,0x37,0x88,0x72,0x39,
-0xb8,0x76,0xcb,0x74,0x05,0x53,0x45,0x98,0x81,0x03,0x32,0x79,0xcb,0x94,0x09,0x96,
-0x46,0x66,0x62,0x09,0x96,0x3b,0x55,0xd0,0x09,0x09,0x3c,0x88,0xd0,0x0a,0x3a,0x38,
-0x00,0xb0,0x0b,0x64,0x3c,0x88,0xd0,0xa0,0x00,0xf1,0x0f,0x7d,0xce,0xb3,0xc6,0x62,
-0x1a,0x7a,0x8a,0xa8,0x81,0x5b,0x86,0x81,0xad,0x10,0x08,0x69,0x88,0x42,0x94,0x37,
-0x77,0xa8,0x77,0x71,0x01,0x66,0x66,0x66,0x00,0xa3,0x2c,0x10,0x05,0xda,0x2b,0x01,
-0x05,0x00,0xf3,0x23,0x02,0x00,0x11,0x03,0x00,0x09,0x11,0x6c,0x6d,0x50,0x7a,0x93,
-0x45,0x85,0x30,0x25,0x50,0x45,0x85,0x30,0x14,0x45,0x8a,0xc9,0x90,0x38,0x83,0x8c,
-0xb5,0x80,0x49,0xa6,0x8d,0xca,0x90,0x71,0x74,0x6d,0x9a,0x40,0x7a,0xc3,0x1a,0x4b,
-0x31,0x71,0x00,0x79,0x75,0x90,0x56,0x05,0x01,0xdf,0x02,0xf3,0x1c,0xbe,0xbe,0xb6,
-0x59,0xa9,0x2b,0x58,0x00,0x05,0x53,0xaa,0xaa,0x71,0x04,0x44,0xb9,0x99,0x60,0x18,
-0x85,0x59,0xaa,0x70,0x1a,0xa7,0x5a,0x88,0x82,0x27,0x0a,0x5c,0x7b,0xa0,0x2c,0x9a,
-0x27,0xec,0x30,0x27,0x00,0xf9,0x05,0xd8,0x32,0x00,0xf3,0x1c,0x68,0xba,0x83,0x3a,
-0xb9,0x38,0x98,0x81,0x05,0x53,0xa7,0xba,0x95,0x04,0x42,0xb6,0xba,0x95,0x08,0x85,
-0x48,0x77,0x80,0x0a,0x96,0x69,0x55,0xc0,0x09,0x09,0x6a,0x88,0xd0,0x0d,0x99,0x2b,
-0x68,0x80,0x09,0x02,0xd5,0x00,0x86,0xcc,0x10,0xf1,0x23,0x02,0x00,0x20,0x06,0x44,
+0x5a,0x62,0x00,0x57,0x00,0x01,0x32,0x00,0xf2,0x4e,0x9d,0x83,0x72,0xa0,0x2b,0x8d,
+0x86,0x72,0xa0,0x05,0x7d,0x74,0x72,0xa0,0x09,0x0a,0x28,0x20,0xb0,0x05,0x09,0x78,
+0x0a,0xa0,0x19,0x9a,0xee,0xa9,0xb5,0x04,0x8b,0x22,0x89,0x70,0x16,0x59,0x56,0x4a,
+0x40,0x00,0x57,0x30,0x00,0x54,0x01,0x10,0x04,0x00,0x00,0x01,0xa0,0x5c,0x77,0x73,
+0x4a,0xb7,0xc6,0x55,0x51,0x00,0x57,0xd6,0x55,0xd0,0x01,0xc5,0x98,0x77,0xd0,0x0b,
+0xe6,0x7a,0x97,0xa0,0x65,0xa9,0x1d,0xa9,0x80,0x00,0xa3,0xbb,0x29,0x60,0x00,0xa0,
+0x17,0xfb,0x10,0x00,0xa5,0xb5,0x14,0x58,0x02,0xf3,0x17,0x6b,0xbe,0xbd,0xcb,0xb1,
+0x00,0x0a,0x08,0x20,0x00,0x0a,0xae,0xbd,0xba,0x70,0x0a,0x0a,0x08,0x20,0xa0,0x0a,
+0x29,0x08,0x31,0xa0,0x0c,0xa1,0x03,0xab,0xa0,0x0a,0x00,0x00,0x00,0xa0,0x0e,0xaa,
+0xaa,0x0a,0x00,0xf2,0x4b,0x0a,0xac,0xca,0xea,0xa5,0x05,0x9c,0xca,0xe9,0x90,0x08,
+0x25,0x50,0xa0,0xa1,0x08,0x9b,0xb9,0xd8,0xd1,0x00,0x13,0xa1,0x11,0x10,0x2a,0xaf,
+0xaa,0xbd,0xa6,0x00,0x8b,0x21,0xb2,0x00,0x00,0x18,0xed,0xc6,0x10,0x0a,0x96,0x20,
+0x04,0xa1,0x08,0x8b,0xb8,0xd8,0x84,0x09,0x8a,0xa7,0xd7,0xc1,0x06,0x98,0xa8,0x97,
+0x90,0x03,0xa0,0xb8,0x88,0x82,0x1a,0x9c,0xd7,0x77,0xa0,0x07,0xa0,0xa9,0x99,0xc0,
+0x26,0x90,0x6e,0x99,0x60,0x00,0x95,0x59,0x6a,0x10,0x00,0x95,0x98,0x68,0x96,0x03,
+0x06,0xf5,0x1d,0x90,0x6c,0xaa,0xd0,0x5b,0xda,0x68,0x55,0xc0,0x01,0x90,0x67,0x44,
+0xc0,0x47,0xc6,0x8b,0x99,0xd0,0x37,0xa4,0x74,0x00,0xb0,0x05,0xd1,0x4d,0xbe,0x90,
+0x09,0x4a,0x0b,0x0a,0x00,0x1b,0x05,0x3a,0x0a,0x12,0x82,0x04,0xb1,0x0c,0xb3,0x6c,
+0x06,0xf6,0x1f,0x00,0x00,0xb0,0x1d,0x99,0xe0,0x29,0xac,0x2d,0x88,0xd0,0x00,0x39,
+0x1a,0x00,0xb0,0x00,0xc1,0x1d,0x99,0xd0,0x0b,0xea,0x19,0x00,0xa0,0x55,0xb6,0x3b,
+0xbe,0x90,0x00,0xb0,0x07,0x2a,0x00,0x00,0xb0,0x0a,0x0a,0x08,0x00,0xb2,0xb2,0x0a,
+0xb6,0x4c,0x03,0xf2,0x1e,0x0b,0x0b,0x06,0xb8,0x82,0x0b,0x0b,0x09,0x63,0x10,0x0b,
+0x0b,0x46,0x1b,0x00,0x02,0x9f,0x99,0x9d,0x10,0x00,0xb0,0x32,0x0c,0x00,0x00,0xb0,
+0x75,0x0c,0x00,0x00,0x60,0xa9,0x06,0x00,0x00,0x09,0xab,0x00,0x73,0x1a,0xb5,0x08,
+0xaa,0xc1,0x33,0x00,0xf0,0x0c,0x07,0x10,0x00,0x00,0x04,0xca,0xae,0x30,0x02,0xd1,
+0x02,0xb0,0x01,0xde,0xaa,0xea,0xac,0x02,0xb0,0x0b,0x00,0xb0,0x0e,0xaa,0xea,0xac,
+0x01,0x09,0x00,0xd2,0x3d,0xaa,0xea,0xac,0x08,0x40,0x0b,0x00,0xb0,0xb0,0x00,0xb4,
+0xb9,0xd2,0x00,0x10,0x30,0x36,0x00,0xf2,0x1c,0xc9,0x19,0xda,0xc4,0x0b,0x0b,0x00,
+0xb0,0x73,0x6d,0xb9,0xab,0x77,0xc0,0x0a,0x52,0xa7,0x24,0x00,0x0b,0xa8,0xa8,0xce,
+0xa3,0x0b,0x75,0xa9,0x0a,0x00,0x0c,0x98,0xa9,0xae,0xa5,0x47,0x52,0x90,0x0a,0x00,
+0x72,0x17,0x80,0x0a,0x68,0x00,0x20,0x02,0x10,0xec,0x03,0xf3,0x1d,0x96,0x89,0xcc,
+0x98,0x19,0x27,0x86,0xbb,0x68,0x7c,0xcc,0x2d,0x43,0x32,0x08,0x89,0x8b,0xb9,0xa8,
+0x0b,0xbc,0x87,0xc7,0x38,0x0a,0x9a,0x53,0x86,0x48,0x0b,0xab,0x27,0xc9,0x47,0x45,
+0x78,0x35,0xcc,0x46,0x61,0x3a,0x34,0x24,0xc3,0xd4,0x00,0x10,0x32,0xfe,0x06,0x32,
+0x3c,0x11,0x10,0xfe,0x06,0xe0,0x79,0x99,0x99,0x20,0x00,0x12,0x22,0x22,0x00,0x00,
+0x57,0x77,0x77,0x10,0x0f,0x00,0x30,0x30,0x00,0xb0,0x65,0x07,0x92,0xb1,0x11,0x17,
+0x50,0x00,0xc8,0x88,0x8b,0x50,0x40,0x01,0x10,0xa1,0x52,0x08,0xf0,0x10,0xa9,0x80,
+0x0b,0x00,0x04,0x55,0x20,0x0b,0x00,0x03,0x44,0x3b,0xbe,0xb9,0x06,0x88,0x30,0x0b,
+0x00,0x07,0x9a,0x50,0x0b,0x00,0x0a,0x02,0x70,0x0b,0x00,0x0a,0x9a,0x05,0x00,0x00,
+0x7a,0x08,0x20,0x04,0x10,0xa0,0x00,0xf2,0x4f,0x90,0x4b,0xbb,0xb0,0x79,0x99,0x20,
+0x00,0xb0,0x27,0x75,0x00,0x00,0xb0,0x13,0x32,0x2b,0xbb,0xb0,0x37,0x76,0x37,0x00,
+0x60,0x3a,0x97,0x37,0x00,0x00,0x54,0x0a,0x37,0x00,0x43,0x5b,0x9b,0x38,0x00,0x73,
+0x55,0x00,0x1b,0xbb,0xb0,0x03,0x20,0x00,0x50,0x00,0x01,0x80,0x00,0xa1,0x00,0x49,
+0x99,0x8c,0xcb,0xb5,0x09,0x96,0x09,0x10,0x00,0x03,0x32,0x0b,0x99,0x90,0x07,0x74,
+0x0b,0x22,0xb0,0x1a,0x97,0x0a,0x00,0xb0,0x17,0x09,0x48,0x00,0xb0,0x1c,0x9a,0xc3,
+0x00,0xb0,0x17,0x03,0x90,0x8a,0x70,0x04,0x01,0x10,0x00,0x7e,0x04,0xf3,0x1d,0x70,
+0x0e,0xbe,0x00,0x68,0x98,0x29,0x0b,0x00,0x29,0x96,0xa4,0x0a,0x81,0x03,0x33,0x71,
+0x12,0x20,0x16,0x65,0xcb,0xab,0xa0,0x3a,0x97,0x2a,0x0b,0x20,0x45,0x0a,0x06,0xc6,
+0x00,0x4c,0x9b,0x6d,0xad,0x71,0x45,0x03,0xd4,0x04,0xd2,0x47,0x08,0xf0,0x0f,0x02,
+0x30,0x00,0x00,0x80,0x00,0xb0,0x00,0x59,0x99,0x7a,0xca,0xa1,0x08,0x87,0x00,0xb0,
+0x00,0x02,0x21,0x00,0xb0,0x00,0x28,0x87,0x5b,0xeb,0xb0,0x09,0x98,0xbc,0x04,0x00,
+0x5c,0x07,0xf0,0x2d,0x0d,0x8b,0x78,0xe9,0x93,0x0a,0x00,0x11,0x11,0x10,0x01,0x10,
+0x02,0x10,0x00,0x02,0x80,0x0b,0x10,0x00,0x49,0xa9,0x3e,0xaa,0xc2,0x02,0x22,0xc2,
+0x00,0x92,0x06,0x65,0x8b,0x99,0x91,0x08,0x85,0x4a,0x69,0xa1,0x1a,0x97,0x46,0x19,
+0xa0,0x17,0x09,0x4d,0xb8,0xb0,0x1c,0x9a,0x22,0x00,0xb0,0x17,0x00,0x00,0x39,0x90,
+0x67,0x00,0x03,0xa9,0x01,0xf2,0x1d,0x80,0x00,0x0b,0x70,0x27,0x97,0x56,0x6d,0x87,
+0x08,0x96,0x12,0x2b,0x21,0x03,0x32,0x67,0x6b,0x00,0x06,0x75,0x3c,0x3b,0x00,0x0a,
+0x98,0x0a,0x09,0x10,0x0a,0x0a,0x0b,0x69,0x44,0x0c,0x9b,0xea,0x43,0x88,0x0a,0x00,
+0x10,0x00,0xb7,0xfb,0x04,0xf0,0x4b,0x80,0x26,0x8a,0x80,0x47,0xa7,0x34,0xb0,0x00,
+0x14,0x44,0x11,0xb1,0x10,0x17,0x75,0x69,0xe9,0x95,0x18,0x86,0x00,0xa0,0x00,0x2a,
+0x99,0x4b,0xba,0xd0,0x27,0x0a,0x44,0x00,0xb0,0x29,0x4b,0x45,0x11,0xb0,0x2a,0x54,
+0x4b,0x99,0xd0,0x02,0x20,0x12,0x00,0x50,0x01,0x90,0x0a,0x07,0x60,0x59,0x99,0x6d,
+0xad,0xa1,0x19,0x96,0x00,0xb0,0x00,0x03,0x32,0x37,0xd7,0x60,0x17,0x75,0x14,0xc4,
+0x40,0x1a,0x99,0x11,0xb1,0x10,0x27,0x0a,0x68,0xd8,0x83,0x2c,0x9b,0x00,0xb0,0x00,
+0x27,0x98,0x05,0x02,0x96,0x00,0xf2,0x1e,0xa0,0x00,0xb2,0x00,0x39,0xb8,0x89,0xeb,
+0x98,0x05,0x53,0x00,0xb2,0x00,0x04,0x43,0x7a,0xeb,0xa7,0x0d,0xd8,0x00,0xc4,0x00,
+0x0a,0x98,0x44,0x07,0x52,0x09,0x09,0x7a,0x00,0x79,0x0d,0x9b,0x4a,0x01,0x8b,0x09,
+0x00,0x08,0xab,0x40,0x02,0x96,0x00,0xf2,0x1c,0x4a,0xdb,0xc4,0x59,0xa9,0x54,0xb0,
+0x73,0x16,0x64,0x62,0xa0,0x82,0x04,0x43,0x3c,0x29,0xb0,0x17,0x75,0x31,0x60,0x00,
+0x1a,0x98,0x58,0x74,0x70,0x27,0x0a,0x9a,0x02,0x94,0x2c,0x9c,0x8a,0x00,0xa7,0x27,
+0x00,0x07,0xab,0x50,0x68,0x01,0x11,0x10,0xb1,0x03,0xf2,0x1d,0x7a,0xea,0xa4,0x58,
+0x98,0x48,0xc6,0x40,0x19,0x96,0x18,0x62,0xa0,0x03,0x32,0x4b,0x64,0xc2,0x17,0x75,
+0x66,0x66,0x63,0x2a,0x99,0x5a,0xaa,0xc0,0x27,0x0a,0x74,0x00,0xb0,0x2c,0x9b,0x7a,
+0x88,0xd0,0x27,0x00,0x75,0x11,0xb0,0x02,0x32,0x00,0xf3,0x1c,0x6b,0xaa,0xe0,0x58,
+0x98,0x63,0x00,0xb0,0x19,0x95,0x4a,0x99,0xb0,0x03,0x32,0x47,0x77,0x71,0x06,0x63,
+0x23,0xc3,0x30,0x2b,0x99,0x9a,0xea,0xa5,0x27,0x0a,0x03,0xd6,0x00,0x2c,0x9a,0x5d,
+0x1b,0x70,0x27,0x00,0xc4,0x01,0xb7,0x23,0x09,0xf1,0x21,0x03,0x05,0x00,0x01,0x80,
+0x19,0x05,0x50,0x59,0x99,0xa1,0x00,0xa4,0x19,0x96,0x9b,0xaa,0xc3,0x03,0x32,0x45,
+0x00,0xb0,0x17,0x74,0x4a,0x77,0xd0,0x1a,0x97,0x1a,0x4c,0x30,0x27,0x0a,0x0b,0x0a,
+0x02,0x2c,0x9a,0x7a,0x0b,0x09,0x27,0x02,0xd1,0x0b,0xa6,0x18,0x04,0x03,0xa0,0x00,
+0xf7,0x1c,0x9a,0xaa,0xd2,0x49,0xa8,0x81,0x91,0x72,0x05,0x53,0x84,0xc6,0x72,0x04,
+0x42,0x86,0xd8,0x82,0x08,0x85,0x81,0x22,0x62,0x0a,0x97,0x88,0x6b,0x62,0x08,0x09,
+0x98,0x7b,0x62,0x0d,0x9b,0x85,0x00,0x62,0x08,0x07,0x30,0x05,0xb1,0x27,0x0b,0xf0,
+0x1d,0x70,0x68,0xd8,0x82,0x48,0x98,0x37,0xd7,0x71,0x19,0x96,0x78,0xd8,0x84,0x03,
+0x32,0x15,0x55,0x40,0x17,0x74,0x39,0x55,0xc0,0x1a,0x98,0x3b,0x88,0xd0,0x27,0x0a,
+0x3b,0x77,0xd0,0x2c,0x9b,0x36,0x00,0xb0,0x27,0x00,0x36,0x07,0xc0,0x0d,0x02,0x00,
+0x0e,0x01,0x10,0x02,0xdc,0x00,0xf6,0x4d,0x7a,0x90,0x39,0xa8,0x8b,0x16,0x95,0x04,
+0x42,0x4d,0x78,0xd1,0x06,0x64,0xa2,0x33,0x38,0x08,0x85,0x2c,0x88,0xb0,0x0a,0x87,
+0x2c,0x99,0xb0,0x08,0x09,0x08,0x04,0x50,0x0d,0x9a,0x07,0x4a,0x10,0x08,0x00,0x9a,
+0xac,0x96,0x01,0x10,0x03,0x00,0x20,0x02,0x80,0x37,0x88,0x72,0x39,0xb8,0x76,0xcb,
+0x74,0x05,0x53,0x45,0x98,0x81,0x03,0x32,0x79,0xcb,0x94,0x09,0x96,0x46,0x66,0x62,
+0x09,0x96,0x3b,0x55,0xd0,0x09,0x09,0x3c,0x88,0xd0,0x0a,0x3a,0x38,0x00,0xb0,0x0b,
+0x64,0x3c,0x88,0xd0,0xa0,0x00,0xf2,0x18,0x7d,0xce,0xb3,0xc6,0x62,0x1a,0x7a,0x8a,
+0xa8,0x81,0x5b,0x86,0x81,0xad,0x10,0x08,0x69,0x88,0x42,0x94,0x37,0x77,0xa8,0x77,
+0x71,0x01,0x66,0x66,0x66,0x00,0x01,0x77,0x77,0x76,0x00,0x05,0xa7,0x77,0x7d,0x05,
+0x00,0xf3,0x23,0x02,0x00,0x11,0x03,0x00,0x09,0x11,0x6c,0x6d,0x50,0x7a,0x93,0x45,
+0x85,0x30,0x25,0x50,0x45,0x85,0x30,0x14,0x45,0x8a,0xc9,0x90,0x38,0x83,0x8c,0xb5,
+0x80,0x49,0xa6,0x8d,0xca,0x90,0x71,0x74,0x6d,0x9a,0x40,0x7a,0xc3,0x1a,0x4b,0x31,
+0x71,0x00,0x79,0x75,0x90,0x56,0x05,0x01,0xdf,0x02,0xf3,0x1c,0xbe,0xbe,0xb6,0x59,
+0xa9,0x2b,0x58,0x00,0x05,0x53,0xaa,0xaa,0x71,0x04,0x44,0xb9,0x99,0x60,0x18,0x85,
+0x59,0xaa,0x70,0x1a,0xa7,0x5a,0x88,0x82,0x27,0x0a,0x5c,0x7b,0xa0,0x2c,0x9a,0x27,
+0xec,0x30,0x27,0x00,0xf9,0x05,0xd8,0x32,0x00,0xf2,0x1c,0x68,0xba,0x83,0x3a,0xb9,
+0x38,0x98,0x81,0x05,0x53,0xa7,0xba,0x95,0x04,0x42,0xb6,0xba,0x95,0x08,0x85,0x48,
+0x77,0x80,0x0a,0x96,0x69,0x55,0xc0,0x09,0x09,0x6a,0x88,0xd0,0x0d,0x99,0x2b,0x68,
+0x80,0x09,0x02,0xd5,0x00,0x86,0x65,0x00,0xf0,0x24,0x20,0x02,0x00,0x20,0x06,0x44,
 0x7b,0x57,0x41,0x1c,0xb1,0x66,0x5b,0xa0,0x09,0x76,0x77,0x4a,0x85,0x18,0x55,0x97,
 0x77,0x45,0x35,0x67,0x96,0x95,0x76,0x00,0x4f,0x98,0x99,0x83,0x0a,0x79,0x51,0x96,
-0x00,0x03,0x57,0xcc,0xb6,0x41,0x27,0x41,0x00,0x02,0x64,0x00,0x03,0x64,0x6b,0xe1,
-0xa9,0x80,0x00,0x03,0xc3,0x17,0x81,0x10,0x0b,0xe8,0x88,0x88,0xc0,0x00,0x05,0x00,
-0xf1,0x04,0xc1,0x11,0x11,0xc0,0x00,0xd7,0x77,0x77,0xc0,0x00,0xe9,0x99,0x99,0xc0,
-0x00,0x59,0x10,0x49,0x30,0x47,0x19,0x40,0x0e,0x9e,0x00,0xa0,0x80,0x07,0x80,0xa2,
-0x10,0x0d,0x9d,0x00,0xa9,0x94,0x0a,0x62,0x48,0xf0,0x06,0x0d,0x8d,0x26,0xc6,0x60,
-0x0d,0x8d,0x56,0x00,0xb0,0x07,0x37,0x56,0x00,0xb0,0x2d,0x0a,0x6c,0x99,0xe0,0x45,
-0x7e,0x49,0x01,0xce,0x0b,0x00,0x0a,0x1b,0xf0,0x3f,0x00,0x09,0x41,0xa2,0xea,0xa7,
-0x09,0x82,0xa9,0x30,0xa0,0x09,0x82,0xbe,0x50,0x90,0x09,0x92,0xa1,0xa4,0x60,0x09,
-0xb0,0xa0,0x7c,0x10,0x01,0xa6,0x00,0x4d,0x10,0x0a,0x34,0x84,0xb3,0xb2,0x33,0x00,
-0x26,0x00,0x15,0x00,0x92,0x07,0xaa,0xd0,0x2a,0xdb,0x70,0x00,0xb0,0x12,0xa4,0x20,
-0x00,0xb0,0x38,0xba,0x89,0xba,0x90,0x08,0x56,0x18,0x20,0x00,0x0b,0x5a,0x78,0x20,
-0x55,0x1f,0x74,0x03,0xaa,0x91,0x47,0xe5,0x7e,0x44,0x42,0x3b,0xbb,0xbb,0xb6,0x5c,
-0x01,0xf0,0x14,0x63,0x0a,0xea,0xc4,0x0a,0xcb,0x80,0xa0,0x83,0x01,0x85,0x15,0x52,
-0xb1,0x18,0xab,0x86,0x06,0x50,0x08,0x46,0x1b,0x99,0xe0,0x0b,0x4b,0x7b,0x00,0xa0,
-0x0e,0x85,0x0b,0x99,0xd0,0x19,0x38,0x42,0x52,0x54,0x1a,0xcb,0xbb,0xb5,0x70,0x03,
-0x00,0x4f,0x46,0x00,0x1f,0x25,0x02,0x05,0x00,0x80,0x00,0xbb,0xbe,0xbb,0x80,0x00,
-0x52,0x0b,0x5d,0x33,0x31,0x0e,0xaa,0xa1,0xb6,0x48,0x30,0x08,0x59,0x7b,0xfc,0x1b,
-0x13,0x6c,0x0f,0x2e,0x81,0x0e,0xae,0x3d,0xbb,0xb4,0x0a,0x0a,0x38,0x0a,0x00,0xf0,
-0x1d,0xaa,0xa0,0x00,0x90,0x38,0x00,0xb0,0x09,0xa8,0x58,0x00,0xa0,0x0a,0x92,0x4d,
-0xbb,0xc0,0x0a,0x91,0x48,0x00,0x00,0x1d,0xda,0x69,0x11,0x11,0x34,0x00,0x29,0x99,
-0x95,0x0e,0xae,0x7b,0xaa,0xe0,0x0a,0x0a,0x76,0x22,0xb0,0x0e,0xae,0x02,0x18,0xf2,
-0x0e,0x90,0x78,0x55,0xc0,0x09,0xaa,0x87,0xb5,0x61,0x09,0x90,0x74,0x48,0xb2,0x09,
-0x95,0x84,0x0c,0x10,0x4d,0xa5,0x9a,0xa4,0xc3,0x00,0x00,0x54,0x00,0x23,0x22,0x01,
-0xd0,0xae,0x06,0xc8,0x70,0x0a,0x0a,0x2e,0x44,0x80,0x0e,0xae,0xb4,0xaa,0xf7,0x5e,
-0xd0,0xbb,0x00,0x09,0xa7,0x3b,0x55,0xd3,0x09,0x93,0x8d,0xaa,0xd4,0x09,0xcf,0x62,
-0xe0,0x2d,0xdb,0x2b,0x00,0xb0,0x34,0x00,0x0d,0x99,0xd0,0x0d,0xac,0x0a,0x1b,0xb8,
-0x34,0xf4,0x16,0x1b,0x85,0x0d,0xac,0x7d,0x1c,0xa0,0x01,0x90,0x0a,0x1b,0x00,0x08,
-0xb9,0x1c,0x1f,0x70,0x08,0x91,0xcc,0x0b,0x87,0x08,0x91,0x2b,0x0b,0x01,0x2d,0xda,
-0x67,0x0b,0x08,0x34,0x02,0xb0,0x0c,0xa7,0x7d,0x02,0xf3,0x1f,0x21,0x30,0x0d,0xa9,
-0x73,0x81,0x90,0x09,0x0c,0x91,0xb5,0xb0,0x0d,0xaa,0x3a,0x8b,0x74,0x00,0x90,0xa6,
-0x15,0x04,0x06,0xb6,0xe1,0x59,0x00,0x08,0xa3,0x81,0xa9,0xa3,0x08,0x91,0x72,0xc9,
-0x00,0x2c,0xd8,0x77,0xbc,0x00,0x23,0x00,0x79,0x09,0x2e,0x2d,0x01,0x71,0x41,0x80,
-0x56,0xc7,0x64,0x00,0x00,0xc4,0x44,0x4b,0x78,0x2f,0x20,0x8b,0x00,0xe5,0x10,0xa0,
-0x81,0x00,0xc2,0x22,0x2f,0x60,0x1a,0xca,0xaa,0xdc,0x64,0x3f,0xb3,0x3b,0x00,0x00,
-0x4a,0x90,0x0b,0x00,0x3c,0x71,0x0a,0xb8,0x58,0x0b,0xf0,0x01,0xaa,0xbd,0xaa,0xa3,
-0x00,0x44,0x6b,0x44,0x20,0x02,0xb5,0x7b,0x56,0xa0,0x02,0xc9,0xfb,0x2d,0xe1,0x80,
-0x29,0x01,0xa0,0x01,0x99,0xad,0x99,0x60,0x29,0x99,0xad,0x99,0x96,0x56,0x0e,0x02,
-0x60,0x0e,0xf2,0x1d,0x83,0x10,0x0a,0x00,0x17,0xb9,0x62,0x3c,0x31,0x0b,0xc9,0x9b,
-0x6c,0x78,0x0b,0xb7,0x9a,0x0a,0x18,0x09,0x82,0x9b,0x7d,0x88,0x08,0xca,0x6b,0x3b,
-0x58,0x39,0xca,0x9a,0x0a,0x18,0x00,0x72,0x0c,0xae,0xb8,0x00,0x72,0x0a,0x00,0x18,
-0x2e,0x20,0xf7,0x1d,0xa3,0x00,0xa1,0x00,0x36,0xb5,0x8b,0xbb,0xa2,0x69,0xcb,0x0c,
-0x06,0x50,0x7a,0xcc,0x98,0x02,0xc2,0x73,0x89,0x27,0x3b,0x10,0x49,0xd8,0x01,0xc8,
-0x00,0x7a,0xda,0x10,0xd7,0x00,0x01,0x90,0x1b,0x3b,0x60,0x01,0x90,0xb3,0x00,0x94,
-0x43,0x36,0xf2,0x1d,0x9e,0x96,0xb2,0x80,0x02,0x2c,0x22,0xb3,0x53,0x16,0x6c,0x66,
-0xc8,0x64,0x08,0x8d,0x88,0x83,0x91,0x07,0x7c,0x77,0x65,0xa0,0x09,0x6c,0x69,0x3e,
-0x30,0x06,0x6c,0x66,0x2e,0x04,0x19,0x9d,0x9a,0xcb,0x29,0x00,0x0a,0x07,0x41,0xb6,
-0x34,0x01,0xf0,0x45,0xa1,0x00,0xd3,0x00,0x59,0xd8,0x19,0x3a,0x40,0x49,0xca,0xbc,
-0x9a,0xd4,0x57,0xaa,0x10,0x00,0x00,0x57,0xba,0x9b,0xbd,0xd0,0x38,0xc8,0x96,0x69,
-0xa0,0x6a,0xda,0xa8,0x8b,0xb0,0x00,0x90,0x93,0x48,0x90,0x00,0x90,0x93,0x49,0xa0,
-0x13,0xa4,0x29,0x98,0xe0,0x16,0xb7,0x49,0x77,0xd0,0x0b,0xc9,0x96,0x66,0x62,0x0b,
-0xb7,0xaa,0x54,0xc2,0x09,0x81,0x98,0x98,0xd0,0x08,0xc9,0x58,0x87,0xd0,0x4a,0xdb,
-0x98,0x21,0xb1,0x00,0x91,0x4d,0xcb,0xe4,0xe2,0x15,0x14,0xb0,0x5f,0x00,0xf0,0x15,
-0xc4,0x00,0x49,0xd8,0x39,0x18,0x60,0x39,0xd9,0x7a,0x99,0x82,0x5a,0xcb,0x55,0x64,
-0x60,0x54,0x99,0x97,0xa7,0x90,0x28,0xc7,0x92,0x97,0x90,0x6a,0xda,0xa7,0xa7,0x90,
-0x00,0x90,0x90,0x90,0x5f,0x00,0xf4,0x20,0x73,0xa0,0x01,0xa0,0x35,0xc5,0x51,0x69,
-0xd9,0x57,0xd7,0x70,0x58,0xca,0x79,0xd8,0xc0,0x66,0xba,0x76,0xc4,0xb0,0x64,0xa9,
-0x23,0xb5,0xa0,0x59,0xca,0x68,0x8b,0x92,0x8a,0xda,0x9a,0x7c,0x82,0x00,0x90,0x0b,
-0x19,0x10,0x00,0x90,0x01,0x7c,0x10,0x4e,0x07,0xf3,0x15,0xb0,0x05,0xcb,0xa1,0x0b,
-0x00,0x0a,0x30,0x7b,0xea,0xe2,0xaa,0x58,0x1a,0x0b,0x25,0xa6,0x8b,0xea,0xe0,0x1a,
-0x89,0x2a,0x0b,0x6a,0xc5,0x81,0xa0,0xb0,0x08,0x27,0xbe,0xae,0x00,0x82,0x71,0x8d,
-0x00,0x10,0x20,0xaa,0x05,0xf0,0x18,0x91,0x2c,0x88,0xc0,0x5d,0xcb,0x4a,0x44,0xc0,
+0x00,0x03,0x57,0xcc,0xb6,0x41,0x27,0x41,0x00,0x02,0x64,0x00,0x03,0xa0,0x00,0xf1,
+0x00,0x2f,0xa9,0x80,0x00,0x03,0xc3,0x17,0x81,0x10,0x0b,0xe8,0x88,0x88,0xc0,0x00,
+0x05,0x00,0xf0,0x09,0xc1,0x11,0x11,0xc0,0x00,0xd7,0x77,0x77,0xc0,0x00,0xe9,0x99,
+0x99,0xc0,0x00,0x59,0x10,0x49,0x30,0x09,0x50,0x00,0x01,0x74,0xf0,0x7f,0x0e,0x9e,
+0x00,0xa0,0x00,0x0a,0x0a,0x00,0xa2,0x10,0x0d,0x9d,0x00,0xa9,0x94,0x0a,0x0b,0x00,
+0xa0,0x00,0x0d,0x8d,0x26,0xc6,0x60,0x0d,0x8d,0x56,0x00,0xb0,0x07,0x37,0x56,0x00,
+0xb0,0x2d,0x0a,0x6c,0x99,0xe0,0x45,0x00,0x47,0x11,0xb0,0x00,0x00,0x00,0x30,0x00,
+0x0e,0xaa,0xa0,0xb0,0x00,0x09,0x41,0xa2,0xea,0xa7,0x09,0x82,0xa9,0x30,0xa0,0x09,
+0x82,0xbe,0x50,0x90,0x09,0x92,0xa1,0xa4,0x60,0x09,0xb0,0xa0,0x7c,0x10,0x01,0xa6,
+0x00,0x4d,0x10,0x0a,0x34,0x84,0xb3,0xb2,0x33,0x00,0x26,0x00,0x15,0x00,0x92,0x07,
+0xaa,0xd0,0x2a,0xdb,0x70,0x00,0xb0,0x12,0xa4,0x20,0x00,0xb0,0x38,0xba,0x89,0xba,
+0x90,0x08,0x56,0x18,0x20,0x00,0x0b,0x5a,0x78,0x20,0x55,0x1f,0x74,0x03,0xaa,0x91,
+0x47,0xe5,0x00,0x00,0x00,0x82,0x3b,0xbb,0xbb,0xb6,0x10,0x00,0x01,0x00,0xf1,0x1d,
+0x63,0x0a,0xea,0xc4,0x0a,0xcb,0x80,0xa0,0x83,0x01,0x85,0x15,0x52,0xb1,0x18,0xab,
+0x86,0x06,0x50,0x08,0x46,0x1b,0x99,0xe0,0x0b,0x4b,0x7b,0x00,0xa0,0x0e,0x85,0x0b,
+0x99,0xd0,0x19,0xd7,0x00,0x00,0x00,0x54,0x1a,0xcb,0xbb,0xb5,0x31,0x00,0x92,0x01,
+0xeb,0xbb,0xbb,0xc0,0x01,0xa0,0x00,0x00,0x05,0x00,0xf1,0x0f,0x00,0xbb,0xbe,0xbb,
+0x80,0x00,0x52,0x0b,0x00,0x00,0x00,0xb2,0x0e,0xaa,0xa1,0x00,0xe7,0x0b,0x00,0x00,
+0x08,0x59,0x7b,0x00,0x00,0x1b,0x00,0x6c,0xbb,0xb8,0x32,0x00,0x81,0x0e,0xae,0x3d,
+0xbb,0xb4,0x0a,0x0a,0x38,0x0a,0x00,0xf2,0x3e,0xaa,0xa0,0x00,0x90,0x38,0x00,0xb0,
+0x09,0xa8,0x58,0x00,0xa0,0x0a,0x92,0x4d,0xbb,0xc0,0x0a,0x91,0x48,0x00,0x00,0x1d,
+0xda,0x69,0x11,0x11,0x34,0x00,0x29,0x99,0x95,0x0e,0xae,0x7b,0xaa,0xe0,0x0a,0x0a,
+0x76,0x22,0xb0,0x0e,0xae,0x79,0x77,0xd0,0x00,0x90,0x78,0x55,0xc0,0x09,0xaa,0x87,
+0xb5,0x61,0x09,0x90,0x74,0x48,0xb2,0x09,0x95,0x84,0x0c,0x10,0x4d,0xa5,0x9a,0xa4,
+0xc3,0x00,0x00,0x54,0x00,0x23,0x22,0x01,0xf2,0x4b,0xae,0x06,0xc8,0x70,0x0a,0x0a,
+0x2e,0x44,0x80,0x0e,0xae,0xb4,0xaa,0x00,0x00,0x90,0x00,0xbb,0x00,0x09,0xa7,0x3b,
+0x55,0xd3,0x09,0x93,0x8d,0xaa,0xd4,0x09,0x90,0x0a,0x00,0xb0,0x2d,0xdb,0x2b,0x00,
+0xb0,0x34,0x00,0x0d,0x99,0xd0,0x0d,0xac,0x0a,0x1b,0x00,0x09,0x0a,0x9a,0x1b,0x85,
+0x0d,0xac,0x7d,0x1c,0xa0,0x01,0x90,0x0a,0x1b,0x00,0x08,0xb9,0x1c,0x1f,0x70,0x08,
+0x91,0xcc,0x0b,0x87,0x08,0x91,0x2b,0x0b,0x01,0x2d,0xda,0x67,0x0b,0x08,0x34,0x02,
+0xb0,0x0c,0xa7,0x00,0x01,0x00,0xf3,0x21,0x02,0x21,0x30,0x0d,0xa9,0x73,0x81,0x90,
+0x09,0x0c,0x91,0xb5,0xb0,0x0d,0xaa,0x3a,0x8b,0x74,0x00,0x90,0xa6,0x15,0x04,0x06,
+0xb6,0xe1,0x59,0x00,0x08,0xa3,0x81,0xa9,0xa3,0x08,0x91,0x72,0xc9,0x00,0x2c,0xd8,
+0x77,0xbc,0x00,0x23,0x00,0x79,0x09,0xa5,0x37,0x00,0xf2,0x20,0x21,0x00,0x00,0x00,
+0x56,0xc7,0x64,0x00,0x00,0xc4,0x44,0x4b,0x00,0x00,0xd8,0x88,0x8b,0x00,0x00,0xc6,
+0x66,0x6b,0x81,0x00,0xc2,0x22,0x2f,0x60,0x1a,0xca,0xaa,0xdc,0x00,0x00,0x00,0x4b,
+0x3b,0x00,0x00,0x4a,0x90,0x0b,0x00,0x3c,0x71,0x0a,0xb8,0x35,0x00,0xf1,0x4b,0x09,
+0xaa,0xbd,0xaa,0xa3,0x00,0x44,0x6b,0x44,0x20,0x02,0xb5,0x7b,0x56,0xa0,0x02,0xc9,
+0xad,0x9a,0xa0,0x02,0x80,0x29,0x01,0xa0,0x01,0x99,0xad,0x99,0x60,0x29,0x99,0xad,
+0x99,0x96,0x01,0x11,0x39,0x11,0x11,0x00,0x00,0x29,0x00,0x00,0x01,0x83,0x10,0x0a,
+0x00,0x17,0xb9,0x62,0x3c,0x31,0x0b,0xc9,0x9b,0x6c,0x78,0x0b,0xb7,0x9a,0x0a,0x18,
+0x09,0x82,0x9b,0x7d,0x88,0x08,0xca,0x6b,0x3b,0x58,0x39,0xca,0x9a,0x0a,0x18,0x00,
+0x72,0x0c,0xae,0xb8,0x00,0x72,0x0a,0x00,0x18,0x5f,0x00,0xf5,0x1f,0x24,0xa3,0x00,
+0xa1,0x00,0x36,0xb5,0x8b,0xbb,0xa2,0x69,0xcb,0x0c,0x06,0x50,0x7a,0xcc,0x98,0x02,
+0xc2,0x73,0x89,0x27,0x3b,0x10,0x49,0xd8,0x01,0xc8,0x00,0x7a,0xda,0x10,0xd7,0x00,
+0x01,0x90,0x1b,0x3b,0x60,0x01,0x90,0xb3,0x00,0x94,0x00,0x01,0x00,0xf2,0x1e,0x07,
+0x9e,0x96,0xb2,0x80,0x02,0x2c,0x22,0xb3,0x53,0x16,0x6c,0x66,0xc8,0x64,0x08,0x8d,
+0x88,0x83,0x91,0x07,0x7c,0x77,0x65,0xa0,0x09,0x6c,0x69,0x3e,0x30,0x06,0x6c,0x66,
+0x2e,0x04,0x19,0x9d,0x9a,0xcb,0x29,0x00,0x0a,0x07,0x41,0xb6,0x34,0x01,0xf4,0x4a,
+0xa1,0x00,0xd3,0x00,0x59,0xd8,0x19,0x3a,0x40,0x49,0xca,0xbc,0x9a,0xd4,0x57,0xaa,
+0x10,0x00,0x00,0x57,0xba,0x9b,0xbd,0xd0,0x38,0xc8,0x96,0x69,0xa0,0x6a,0xda,0xa8,
+0x8b,0xb0,0x00,0x90,0x93,0x48,0x90,0x00,0x90,0x93,0x49,0xa0,0x13,0xa4,0x29,0x98,
+0xe0,0x16,0xb7,0x49,0x77,0xd0,0x0b,0xc9,0x96,0x66,0x62,0x0b,0xb7,0xaa,0x54,0xc2,
+0x09,0x81,0x98,0x98,0xd0,0x08,0xc9,0x58,0x87,0xd0,0x4a,0xdb,0x98,0x21,0xb1,0x00,
+0x91,0x4d,0xcb,0xe4,0x00,0x91,0x00,0x00,0xb0,0x5f,0x00,0xf0,0x15,0xc4,0x00,0x49,
+0xd8,0x39,0x18,0x60,0x39,0xd9,0x7a,0x99,0x82,0x5a,0xcb,0x55,0x64,0x60,0x54,0x99,
+0x97,0xa7,0x90,0x28,0xc7,0x92,0x97,0x90,0x6a,0xda,0xa7,0xa7,0x90,0x00,0x90,0x90,
+0x90,0x5f,0x00,0xf2,0x20,0x73,0xa0,0x01,0xa0,0x35,0xc5,0x51,0x69,0xd9,0x57,0xd7,
+0x70,0x58,0xca,0x79,0xd8,0xc0,0x66,0xba,0x76,0xc4,0xb0,0x64,0xa9,0x23,0xb5,0xa0,
+0x59,0xca,0x68,0x8b,0x92,0x8a,0xda,0x9a,0x7c,0x82,0x00,0x90,0x0b,0x19,0x10,0x00,
+0x90,0x01,0x7c,0x10,0x5f,0x00,0xf3,0x17,0x80,0x00,0xb0,0x05,0xcb,0xa1,0x0b,0x00,
+0x0a,0x30,0x7b,0xea,0xe2,0xaa,0x58,0x1a,0x0b,0x25,0xa6,0x8b,0xea,0xe0,0x1a,0x89,
+0x2a,0x0b,0x6a,0xc5,0x81,0xa0,0xb0,0x08,0x27,0xbe,0xae,0x00,0x82,0x71,0x8d,0x00,
+0xf2,0x22,0x20,0x00,0x00,0x00,0x03,0x91,0x2c,0x88,0xc0,0x5d,0xcb,0x4a,0x44,0xc0,
 0x09,0x30,0x7d,0xdd,0xd4,0x1b,0xa6,0x2a,0x11,0xb0,0x26,0xb7,0x1d,0x88,0xc0,0x00,
-0x97,0x3d,0x88,0xc0,0x6d,0xd7,0x29,0x00,0xb1,0x00,0x82,0xbd,0xcb,0xe4,0xf3,0x27,
-0x12,0xa0,0x54,0x01,0xf0,0x10,0x00,0x00,0xb6,0x40,0x06,0x73,0x44,0xd4,0xa2,0x00,
-0x13,0x5b,0xf7,0x52,0x4a,0x90,0x0a,0xca,0x00,0x00,0xb0,0x74,0xb3,0x90,0x00,0xb5,
-0xa0,0xb0,0x93,0x00,0xb7,0xf9,0x15,0x73,0x86,0x10,0x60,0x12,0x33,0x02,0x8a,0x81,
-0x2f,0xf1,0x14,0x0a,0x20,0xe9,0x99,0xb0,0x01,0xa0,0xd6,0x66,0xb0,0x00,0x00,0xc2,
-0x22,0xb0,0x3b,0x90,0xe9,0x99,0x90,0x00,0xb0,0xb1,0x94,0xb2,0x00,0xb0,0xb0,0x4d,
-0x20,0x00,0xb3,0xe9,0x31,0xb1,0xa4,0x0d,0x56,0x46,0x04,0xaa,0xaa,0xca,0xba,0x2e,
-0xf1,0x0a,0x0a,0x00,0x66,0x09,0x30,0x03,0x88,0xad,0xae,0xa5,0x00,0x02,0x50,0xb0,
-0x70,0x2a,0xb3,0x70,0xb0,0xb0,0x00,0xb3,0xc9,0xe9,0xe0,0x1a,0x62,0xf7,0x00,0x00,
-0xb0,0x2d,0x10,0x00,0x08,0xb6,0xc3,0x00,0x00,0x28,0x05,0xaa,0xaa,0xc8,0xfa,0x4a,
-0xf0,0x15,0x12,0x9a,0x9c,0xa0,0x02,0xa0,0x18,0xa9,0x00,0x00,0x03,0xb8,0xd9,0xc0,
-0x4a,0x83,0xc8,0xd8,0xd0,0x00,0xb3,0x81,0xb1,0xa0,0x00,0xb3,0xb6,0xc6,0xc0,0x00,
-0xc3,0x70,0xa5,0xc0,0x0a,0x97,0x6e,0x00,0x42,0x05,0xba,0x9a,0xc6,0xe0,0x10,0xf0,
-0x02,0x01,0x11,0xc1,0x10,0x05,0x85,0x66,0xd6,0x63,0x00,0x04,0xb9,0xe9,0xc0,0x4a,
-0x95,0x50,0x69,0x00,0xf2,0x08,0x9c,0xfa,0x90,0x00,0xb0,0x2b,0xdb,0x20,0x00,0xb5,
-0xc1,0xb1,0xc1,0x06,0xd6,0x00,0x90,0x10,0x48,0x08,0xaa,0x9a,0xb6,0x04,0x01,0x10,
-0x37,0x3a,0x1c,0xc0,0x91,0x33,0xc3,0x30,0x00,0x03,0xa5,0xd5,0xc0,0x3a,0xb3,0xb8,
-0x64,0x00,0x50,0xa6,0xd6,0xd0,0x00,0xb1,0x14,0x00,0xe7,0xb8,0x99,0xe9,0x96,0x08,
-0xd2,0x00,0xa0,0x00,0x48,0x19,0xba,0xab,0xca,0x31,0x0b,0xf3,0x1d,0x24,0xc9,0xb9,
-0xd2,0x01,0x94,0x78,0xd8,0x82,0x00,0x04,0x62,0xb2,0x82,0x29,0x65,0x76,0x66,0x92,
-0x02,0xb6,0x4c,0x8a,0x82,0x00,0xb9,0x19,0x19,0x82,0x00,0xba,0x07,0x76,0x92,0x04,
-0xa6,0x00,0x06,0x80,0x29,0x04,0x9a,0xaa,0xc9,0x5b,0x1e,0x00,0x02,0x35,0xf0,0x08,
-0x20,0x83,0xa2,0x00,0x01,0x92,0xfa,0xcc,0xa4,0x00,0x1d,0xc2,0xa3,0x20,0x2a,0x71,
-0xd6,0xc7,0x60,0x00,0xb0,0xea,0xda,0xf9,0x44,0x00,0x5a,0x02,0xb4,0xea,0xca,0xa6,
-0x07,0xb6,0x30,0x00,0x00,0x29,0x04,0xaa,0x37,0x00,0x00,0x53,0x07,0xf2,0x1e,0x05,
+0x97,0x3d,0x88,0xc0,0x6d,0xd7,0x29,0x00,0xb1,0x00,0x82,0xbd,0xcb,0xe4,0x00,0x82,
+0x00,0x00,0xa0,0x54,0x01,0xf2,0x1c,0x00,0x00,0xb6,0x40,0x06,0x73,0x44,0xd4,0xa2,
+0x00,0x13,0x5b,0xf7,0x52,0x4a,0x90,0x0a,0xca,0x00,0x00,0xb0,0x74,0xb3,0x90,0x00,
+0xb5,0xa0,0xb0,0x93,0x00,0xb7,0x00,0xb0,0x00,0x08,0x86,0x10,0x60,0x12,0x33,0x02,
+0x8a,0xaa,0x53,0x02,0xf3,0x1e,0x0a,0x20,0xe9,0x99,0xb0,0x01,0xa0,0xd6,0x66,0xb0,
+0x00,0x00,0xc2,0x22,0xb0,0x3b,0x90,0xe9,0x99,0x90,0x00,0xb0,0xb1,0x94,0xb2,0x00,
+0xb0,0xb0,0x4d,0x20,0x00,0xb3,0xe9,0x31,0xb1,0x09,0xa6,0x00,0x00,0x00,0x46,0x04,
+0xaa,0xaa,0xca,0xba,0x01,0xf6,0x21,0x30,0x01,0x10,0x0a,0x00,0x66,0x09,0x30,0x03,
+0x88,0xad,0xae,0xa5,0x00,0x02,0x50,0xb0,0x70,0x2a,0xb3,0x70,0xb0,0xb0,0x00,0xb3,
+0xc9,0xe9,0xe0,0x00,0xb0,0x05,0x70,0x00,0x00,0xb0,0x2d,0x10,0x00,0x08,0xb6,0xc3,
+0x00,0x00,0x28,0x05,0xaa,0xaa,0xc8,0xf4,0x01,0xf0,0x16,0x0a,0x12,0x9a,0x9c,0xa0,
+0x02,0xa0,0x18,0xa9,0x00,0x00,0x03,0xb8,0xd9,0xc0,0x4a,0x83,0xc8,0xd8,0xd0,0x00,
+0xb3,0x81,0xb1,0xa0,0x00,0xb3,0xb6,0xc6,0xc0,0x00,0xc3,0x70,0xa5,0xc0,0x0a,0x97,
+0x6e,0x00,0x41,0x05,0xba,0x9a,0xc6,0x32,0x00,0xf0,0x03,0x06,0x01,0x11,0xc1,0x10,
+0x05,0x85,0x66,0xd6,0x63,0x00,0x04,0xb9,0xe9,0xc0,0x4a,0x95,0x50,0x69,0x00,0xf2,
+0x08,0x9c,0xfa,0x90,0x00,0xb0,0x2b,0xdb,0x20,0x00,0xb5,0xc1,0xb1,0xc1,0x06,0xd6,
+0x00,0x90,0x10,0x48,0x08,0xaa,0x9a,0xb6,0x04,0x01,0xf0,0x02,0x37,0xaa,0xea,0xa5,
+0x00,0x91,0x33,0xc3,0x30,0x00,0x03,0xa5,0xd5,0xc0,0x3a,0xb3,0xb8,0x64,0x00,0x50,
+0xa6,0xd6,0xd0,0x00,0xb1,0x14,0x00,0xe6,0xb8,0x99,0xe9,0x96,0x08,0xd2,0x00,0xa0,
+0x00,0x48,0x19,0xba,0xab,0xca,0x9b,0x00,0xf3,0x1e,0x0b,0x24,0xc9,0xb9,0xd2,0x01,
+0x94,0x78,0xd8,0x82,0x00,0x04,0x62,0xb2,0x82,0x29,0x65,0x76,0x66,0x92,0x02,0xb6,
+0x4c,0x8a,0x82,0x00,0xb9,0x19,0x19,0x82,0x00,0xba,0x07,0x76,0x92,0x04,0xa6,0x00,
+0x06,0x80,0x29,0x04,0x9a,0xaa,0xc9,0x34,0x00,0xf0,0x10,0x11,0x00,0x00,0x0b,0x20,
+0x83,0xa2,0x00,0x01,0x92,0xfa,0xcc,0xa4,0x00,0x1d,0xc2,0xa3,0x20,0x2a,0x71,0xd6,
+0xc7,0x60,0x00,0xb0,0xea,0xda,0xa1,0x00,0xb0,0xb0,0x5a,0x02,0xb5,0xea,0xca,0xa6,
+0x07,0xb6,0x30,0x00,0x00,0x29,0x04,0xaa,0x37,0x00,0xf2,0x21,0x00,0x01,0x00,0x05,
 0x00,0xa0,0x2c,0x00,0x06,0x89,0xc9,0xc9,0x98,0x01,0x12,0xc8,0x46,0x96,0x3a,0xb2,
 0x7a,0x00,0xb0,0x00,0xb4,0x5a,0x69,0xd9,0x00,0xb7,0x2a,0x00,0x90,0x00,0xca,0x0a,
-0x00,0x90,0x06,0xa7,0x65,0x19,0x30,0x28,0x04,0xaa,0xaa,0xbc,0x3b,0x01,0xf2,0x1d,
+0x00,0x90,0x06,0xa7,0x65,0x19,0x30,0x28,0x04,0xaa,0xaa,0xbc,0x3b,0x01,0xf0,0x1e,
 0x1b,0x99,0x99,0xb6,0x03,0x98,0x89,0xd8,0x85,0x00,0x01,0x55,0xc5,0x40,0x14,0x33,
 0x94,0xc3,0xb0,0x26,0xb3,0xb8,0xd7,0xc0,0x00,0xb1,0x77,0xd7,0x70,0x00,0xb6,0x89,
-0xd8,0x84,0x0b,0x79,0x21,0x60,0x12,0x24,0x01,0x79,0xa9,0x95,0x55,0x28,0xf4,0x1d,
-0x60,0xa9,0x9b,0x40,0x00,0x80,0xa8,0x84,0x40,0x00,0x00,0xa0,0x84,0x40,0x3a,0xb5,
-0xb9,0x99,0xd0,0x00,0xb6,0x39,0x86,0x90,0x00,0xb6,0x39,0x07,0x90,0x00,0xb6,0x3a,
-0x95,0x90,0x0b,0xd8,0x20,0x04,0x70,0x56,0x08,0xba,0xab,0xc8,0xdb,0x01,0xf0,0x04,
-0x02,0x10,0x0a,0x00,0x56,0x0b,0x20,0x04,0x86,0x8a,0xd8,0x85,0x00,0x00,0x9b,0xc9,
-0x60,0x4c,0x80,0xda,0x45,0xa0,0xb0,0xd8,0x88,0xb0,0x00,0xb0,0xd7,0x77,0xb0,0x00,
-0x0a,0x00,0x01,0x8f,0x04,0x16,0x46,0xdb,0x01,0x00,0xf1,0x66,0xf7,0x1e,0x0a,0x51,
-0x89,0x8b,0x80,0x00,0x63,0x63,0x9a,0x00,0x02,0x14,0xad,0x51,0x10,0x29,0xb2,0xb8,
-0xd7,0x70,0x00,0xb5,0xb8,0xe8,0x84,0x00,0xb0,0x80,0xb0,0x80,0x00,0xc0,0xd8,0xd8,
-0xd0,0x0a,0xb8,0x11,0x11,0x10,0x38,0x05,0xba,0xab,0xc7,0x12,0x02,0xf9,0x17,0x26,
-0x98,0x88,0xb4,0x01,0xa6,0xa8,0x98,0xa3,0x00,0x07,0x58,0x75,0x90,0x18,0x68,0x78,
-0x76,0x93,0x02,0xb9,0x3c,0xa8,0x61,0x00,0xba,0x84,0x96,0x31,0x00,0xd7,0x67,0xb9,
-0x74,0x06,0xb6,0x00,0x42,0x40,0x01,0x00,0xae,0x01,0xf4,0x1a,0x28,0x89,0x79,0xa5,
-0x02,0xa8,0x98,0x7a,0x93,0x00,0x06,0x9a,0x6a,0x87,0x2b,0x81,0x4a,0x4a,0x41,0x00,
-0xb2,0x5c,0x5c,0x51,0x00,0xb7,0x9d,0x9d,0x95,0x00,0xb1,0x94,0x08,0x70,0x08,0x98,
-0x20,0x00,0x31,0x29,0x03,0xb7,0x02,0x10,0x04,0x26,0x37,0x70,0x05,0x90,0xd8,0x88,
-0xc0,0x00,0x50,0x05,0x00,0xf7,0x13,0x00,0xc7,0x76,0xb0,0x3a,0xb6,0x67,0xb6,0x74,
-0x00,0xb5,0x84,0x57,0x53,0x00,0xb5,0x7c,0x97,0x74,0x00,0xb0,0x78,0x69,0x70,0x0a,
-0xac,0x50,0x48,0x11,0x46,0x07,0xcb,0xab,0xdc,0xa5,0x00,0xf3,0x1d,0x2a,0x7c,0x9c,
-0x88,0x01,0xa8,0x9a,0x9b,0x96,0x00,0x05,0x53,0x95,0x80,0x3b,0xab,0xb6,0xe7,0xc5,
-0x01,0xa6,0x9c,0xb8,0xc3,0x01,0xa9,0x67,0x97,0xc3,0x02,0xb8,0x87,0xa8,0xd5,0x0b,
-0xa7,0x10,0x50,0x00,0x46,0x06,0xbb,0xab,0xcb,0x25,0x1b,0x02,0x4c,0x4d,0xf2,0x1a,
-0x8b,0xba,0x0b,0xba,0xc7,0x82,0x66,0x02,0x90,0xb0,0x82,0xb0,0x16,0xc7,0xc6,0x84,
-0xa0,0x03,0x33,0x33,0x82,0x74,0x0a,0xaa,0xb6,0x82,0x19,0x0b,0x00,0x47,0x86,0x97,
-0x0b,0xaa,0xc7,0x83,0x10,0x0b,0x00,0x46,0x82,0x36,0x00,0xf1,0x1e,0x4a,0xdd,0xa6,
-0xbb,0xd0,0x00,0x88,0x00,0x00,0xa0,0x2c,0xcc,0xb0,0x00,0xa0,0x26,0x66,0x95,0xaa,
-0xe0,0x2a,0x48,0xb7,0x30,0x60,0x29,0x22,0xa7,0x30,0x00,0x2a,0x66,0xb7,0x30,0x33,
-0x2c,0x99,0xb7,0x30,0x55,0x26,0x00,0x93,0xbb,0xc1,0x64,0x00,0xf5,0x1e,0x59,0xc5,
-0xac,0x8c,0xd0,0x54,0x8a,0xac,0x8c,0xd0,0x27,0x97,0x25,0xe5,0x30,0x8c,0xdb,0x23,
-0xe3,0x20,0x08,0xb0,0x9b,0x8b,0xa2,0x0a,0xb9,0x3a,0x3a,0x40,0x75,0x81,0x44,0xe4,
-0x40,0x51,0x80,0x68,0xf8,0x80,0x01,0x80,0x00,0xd0,0x00,0x87,0x3d,0x70,0x20,0x03,
-0x99,0xac,0x75,0x20,0x19,0xfa,0x05,0xf1,0x06,0x00,0x55,0x7b,0x55,0x30,0x02,0xa3,
-0x5a,0x34,0xa0,0x02,0xc7,0x9c,0x78,0xa0,0x01,0x97,0x9c,0x78,0x70,0x04,0x81,0x44,
-0x00,0xcd,0x33,0x11,0x29,0x23,0x00,0xf1,0x09,0xd7,0x77,0x7a,0x60,0x00,0xd6,0x66,
-0x69,0x60,0x00,0x87,0x77,0x78,0x30,0x18,0x88,0x88,0x88,0x86,0x02,0xb7,0x8c,0x77,
-0xb0,0x05,0x00,0xa2,0x01,0x77,0x8c,0x77,0x50,0x03,0x88,0x9c,0x88,0x70,0x2d,0x00,
-0x01,0x01,0x00,0x10,0x99,0x16,0x38,0xf2,0x17,0x74,0xb0,0x0b,0x00,0x1a,0xbb,0x50,
-0x0c,0x00,0x00,0x55,0x1c,0xcf,0xca,0x0a,0xcc,0x90,0x0b,0x00,0x06,0x55,0x70,0x0b,
-0x00,0x08,0x69,0x40,0x0b,0x00,0x03,0x9b,0x90,0x0b,0x00,0x18,0x51,0x00,0x0b,0xef,
-0x1b,0xf3,0x1a,0x04,0xd4,0x4b,0xea,0xd0,0x3b,0x0a,0x21,0x90,0xb0,0x5a,0xc8,0x03,
-0x80,0xb0,0x00,0x90,0x28,0xa5,0xa0,0x4a,0xda,0x3a,0x97,0x90,0x15,0x98,0x08,0x23,
-0x80,0x07,0x96,0x0b,0x04,0x60,0x3a,0xb8,0xbe,0xac,0xc6,0x10,0xa7,0x02,0xf2,0x20,
-0x00,0x00,0x04,0xd2,0x0a,0xaa,0x60,0x2b,0x1a,0x29,0x02,0x70,0x5a,0xc7,0x2a,0x9c,
-0x30,0x00,0x90,0x79,0x9d,0xa4,0x4a,0xda,0x53,0xa4,0x62,0x14,0x97,0x19,0x9b,0x70,
-0x08,0xa8,0x06,0xd6,0x50,0x05,0xca,0x94,0x90,0xa4,0x47,0x30,0x08,0xa0,0x01,0xf8,
-0x00,0xf3,0x1c,0xc1,0x0a,0x01,0x90,0x1a,0x3a,0x6d,0x89,0xd4,0x5a,0xc8,0x1b,0x12,
-0xa1,0x01,0xa1,0x69,0x99,0x96,0x38,0xc8,0x2a,0xaa,0xa1,0x15,0x98,0x18,0x00,0x82,
-0x07,0x96,0x2b,0x77,0xc2,0x3a,0xc8,0x2c,0x88,0xc2,0x11,0x00,0x18,0x11,0x91,0x01,
-0xf7,0x22,0x2a,0x3a,0x87,0xd9,0x40,0x07,0x27,0x76,0x3a,0x58,0x03,0xbc,0x4a,0x05,
-0xb7,0xa0,0x00,0x91,0xc5,0x8d,0xa5,0x02,0xad,0x72,0x65,0xb7,0x30,0x14,0x98,0xa4,
-0x2a,0x31,0x00,0x8a,0x6c,0x19,0xd9,0x70,0x03,0xc8,0xc9,0x08,0x00,0x02,0x95,0x72,
-0x4a,0xa9,0x80,0xcf,0x12,0xf3,0x50,0x02,0xc0,0x60,0xa0,0x70,0x3a,0x3a,0x57,0xa6,
-0x40,0x7a,0xc8,0x7a,0xa9,0xa0,0x00,0xa0,0x78,0x66,0xb0,0x5a,0xea,0x85,0x33,0xb0,
-0x33,0xa8,0x79,0x77,0xb0,0x17,0xa7,0x69,0x99,0xa0,0x27,0xd9,0x2a,0x18,0x50,0x23,
-0x00,0x91,0x00,0x72,0x00,0x30,0x00,0x30,0x00,0x06,0xd2,0x69,0xd9,0x92,0x4a,0x1b,
-0x19,0x07,0x30,0x7a,0xd8,0x9b,0xab,0x95,0x00,0xa0,0x49,0x99,0x90,0x5a,0xea,0x87,
-0x55,0xc0,0x34,0xa9,0x79,0x88,0xd0,0x17,0xa6,0x09,0x1b,0x00,0x04,0xdb,0x3b,0x0b,
-0x07,0x68,0x45,0xb2,0x0b,0xa6,0x9b,0x15,0x00,0x66,0x39,0xf0,0x1d,0xd1,0x46,0xd7,
-0x61,0x2b,0x1a,0x2a,0x28,0x60,0x4a,0xc7,0x8c,0x9c,0x95,0x01,0x91,0x48,0x97,0x90,
-0x28,0xc8,0x69,0xc7,0xd0,0x06,0x98,0x68,0xc6,0xc0,0x06,0x95,0x48,0xd8,0x81,0x05,
-0xed,0x00,0xa1,0x00,0x5a,0x40,0x88,0xd9,0x84,0x5a,0x06,0xf0,0x21,0x10,0x04,0xb0,
-0xcc,0x66,0x50,0x29,0x29,0xc9,0x5b,0x96,0x29,0xc4,0xc7,0xc9,0x70,0x04,0xa2,0x99,
-0x31,0x92,0x18,0xc6,0x89,0x70,0x11,0x25,0x88,0x8a,0xab,0xb4,0x08,0xa5,0x92,0x47,
-0x45,0x04,0xb7,0x92,0x47,0x45,0x2a,0x66,0xdb,0xbd,0xba,0x00,0x8b,0x38,0x1f,0x60,
-0x8a,0x99,0x99,0x10,0x00,0x84,0x6f,0x0f,0xf0,0x01,0x88,0x77,0x77,0x10,0x2a,0xdb,
-0xaa,0xaa,0xa7,0x00,0xa0,0x2a,0x04,0x90,0x00,0xa0,0xdb,0x30,0x40,0xd7,0xa6,0x5b,
-0x72,0x7e,0x4b,0xf2,0x02,0x55,0xea,0xab,0x6b,0xae,0xd7,0x7b,0x69,0x7d,0xc1,0x1b,
-0x64,0x1c,0xe9,0x98,0x5a,0x9e,0xa2,0x64,0x04,0x04,0x00,0x00,0xc2,0x5c,0xf0,0x3f,
-0x03,0xbb,0xe9,0x9b,0x7a,0x9e,0xe8,0x8b,0x7a,0x8e,0xb0,0x0b,0x72,0x0b,0xeb,0xba,
-0x6c,0xcf,0xb3,0x99,0xb9,0x4b,0xb0,0x04,0xf0,0x0b,0xb0,0x2b,0x90,0x0b,0xb5,0xb1,
-0x90,0x0b,0xb1,0x04,0xb3,0xbb,0xe8,0x8c,0x4b,0x8e,0xe8,0x8c,0x4b,0x8d,0xc2,0x2b,
-0x48,0x2c,0xd6,0x65,0x16,0x6d,0xb2,0xac,0xad,0x5b,0xb0,0x29,0x1a,0x0b,0xb4,0xac,
-0x9d,0x6b,0xb0,0x74,0x09,0x0b,0xb2,0x80,0x09,0x9c,0xe9,0xb5,0xa9,0x9e,0x04,0x00,
-0xc1,0xc3,0x75,0xa3,0x3c,0xd6,0x62,0x46,0x6d,0xb0,0xa8,0xa7,0x0b,0x04,0x00,0xf3,
-0x06,0xb8,0xa7,0x0b,0xb0,0xa0,0x47,0x0b,0xb2,0x42,0x94,0xab,0xe9,0x98,0xb9,0x9e,
-0xe8,0x98,0xb8,0x8e,0xc1,0x38,0xa4,0x5a,0x62,0x99,0x98,0x0b,0xb0,0xb4,0x4b,0x04,
-0x00,0xf0,0x21,0xc9,0x99,0x0c,0xb0,0x30,0x03,0xbb,0xd8,0x8b,0x6a,0x8b,0x5d,0x77,
-0xb6,0xa7,0xa5,0xd8,0x8b,0x6b,0x8b,0x5b,0x08,0x22,0x72,0x55,0xb6,0xb5,0x9b,0x25,
-0x5b,0x5b,0xa7,0xa8,0x55,0xb3,0x37,0x71,0x65,0x5b,0x28,0xa8,0x78,0x55,0xb0,0x84,
-0x80,0x5c,0x20,0x46,0x04,0xf0,0x11,0x0e,0xae,0x00,0x94,0x00,0xb4,0x8c,0xaa,0xaa,
-0xab,0xb1,0x90,0x00,0x0a,0xb8,0x50,0xb0,0x05,0x0b,0x0b,0x0c,0x4b,0x80,0xb0,0xc0,
-0xd7,0x10,0x0b,0xa5,0x0b,0x00,0x01,0x64,0x56,0x50,0xab,0x00,0x08,0xbb,0xb4,0x69,
-0x0c,0xf0,0x0f,0x0e,0xba,0x0c,0x00,0xa0,0xa6,0x54,0x80,0x0a,0x0a,0xb1,0xd6,0xaa,
-0xea,0xaa,0x8b,0x52,0x0a,0x0a,0x28,0x65,0xa1,0xa0,0xa2,0xa6,0x53,0x7a,0x0b,0x92,
-0x65,0xb2,0x22,0x70,0x50,0x0a,0x0a,0x00,0x54,0x0a,0xc0,0x72,0x36,0xf0,0x11,0x0e,
-0xbb,0x0c,0xa9,0x70,0xa6,0x6a,0xb0,0x96,0x0a,0xc0,0x33,0xe9,0x00,0xaa,0x38,0x95,
-0x89,0x4a,0x0a,0x8a,0xda,0xa3,0xb8,0xa6,0x09,0x10,0x0a,0x20,0xda,0xda,0xa6,0x87,
-0x68,0x23,0x0a,0x00,0x92,0x1e,0x02,0x05,0x0b,0xf5,0x19,0xac,0x8b,0xaa,0xc0,0xa2,
-0x88,0x20,0x0b,0x0a,0x82,0x8a,0x99,0xc0,0xa7,0x48,0x20,0x0b,0x0a,0x0a,0x8b,0xda,
-0x80,0xa0,0xb8,0x28,0x2a,0x2a,0x84,0x82,0x1e,0x20,0xa0,0x08,0x45,0x87,0x0a,0x00,
-0xaa,0x50,0x85,0x57,0x46,0xf5,0x1a,0x0e,0xba,0x02,0xd4,0x00,0xa6,0x51,0xa1,0xa4,
-0x0a,0xb2,0xc4,0x12,0xb5,0xab,0x13,0x8d,0x94,0x0a,0x29,0x33,0xc3,0x31,0xa1,0xb7,
-0x7d,0x77,0x3c,0x93,0x73,0xb2,0x90,0xa0,0x2b,0x0b,0x08,0x4a,0x01,0x18,0xc0,0x01,
-0xc6,0x47,0xf5,0x1a,0x0e,0xba,0x07,0xb5,0x00,0xa5,0x69,0x74,0x79,0x1a,0xb5,0x30,
-0x90,0x36,0xaa,0x26,0x88,0xc5,0x0a,0x19,0x46,0x6d,0x60,0xa1,0xa2,0x22,0x22,0x0b,
-0x95,0x9d,0xab,0x95,0xa0,0x05,0x71,0x69,0x0a,0x01,0xba,0x87,0x93,0xa2,0x0a,0xf4,
-0x16,0x0e,0xbb,0x0b,0x20,0x00,0xa5,0x62,0xda,0xb9,0x0a,0xb1,0xb1,0x0a,0x20,0xaa,
-0x64,0x53,0x50,0x0a,0x19,0xb4,0x49,0xe0,0xb4,0xab,0x43,0x4c,0x0a,0x51,0xb3,0x23,
-0xc0,0xa0,0x0c,0x99,0x9e,0x0a,0x09,0x37,0xf0,0x11,0x0e,0xb9,0xa0,0x0b,0x24,0x96,
-0x4c,0xa4,0xe8,0x19,0xb0,0xa0,0x0b,0x05,0x99,0x4e,0xa6,0xca,0x79,0x19,0x46,0xd5,
-0x50,0xa5,0x9a,0x44,0x4a,0x1a,0x61,0xb9,0x99,0xd1,0xc3,0x46,0x56,0x19,0x00,0xb9,
-0x99,0xd1,0xf5,0x00,0xf5,0x1a,0xb9,0x9a,0xaa,0xa5,0xa7,0x45,0x88,0x89,0x0a,0xb0,
+0xd8,0x84,0x0b,0x79,0x21,0x60,0x12,0x24,0x01,0x79,0xa9,0x95,0x01,0x32,0x00,0xf4,
+0x1e,0x08,0x60,0xa9,0x9b,0x40,0x00,0x80,0xa8,0x84,0x40,0x00,0x00,0xa0,0x84,0x40,
+0x3a,0xb5,0xb9,0x99,0xd0,0x00,0xb6,0x39,0x86,0x90,0x00,0xb6,0x39,0x07,0x90,0x00,
+0xb6,0x3a,0x95,0x90,0x0b,0xd8,0x20,0x04,0x70,0x56,0x08,0xba,0xab,0xc8,0xdb,0x01,
+0xf0,0x12,0x02,0x10,0x0a,0x00,0x56,0x0b,0x20,0x04,0x86,0x8a,0xd8,0x85,0x00,0x00,
+0x9b,0xc9,0x60,0x4c,0x80,0xb0,0x00,0xb0,0x01,0xb0,0xd8,0x88,0xb0,0x00,0xb0,0xd7,
+0x77,0xb0,0x00,0x0a,0x00,0x01,0x8f,0x04,0x17,0x46,0xdb,0x01,0xf7,0x21,0x02,0x60,
+0x00,0x0a,0x51,0x89,0x8b,0x80,0x00,0x63,0x63,0x9a,0x00,0x02,0x14,0xad,0x51,0x10,
+0x29,0xb2,0xb8,0xd7,0x70,0x00,0xb5,0xb8,0xe8,0x84,0x00,0xb0,0x80,0xb0,0x80,0x00,
+0xc0,0xd8,0xd8,0xd0,0x0a,0xb8,0x11,0x11,0x10,0x38,0x05,0xba,0xab,0xc7,0x12,0x02,
+0xf9,0x17,0x26,0x98,0x88,0xb4,0x01,0xa6,0xa8,0x98,0xa3,0x00,0x07,0x58,0x75,0x90,
+0x18,0x68,0x78,0x76,0x93,0x02,0xb9,0x3c,0xa8,0x61,0x00,0xba,0x84,0x96,0x31,0x00,
+0xd7,0x67,0xb9,0x74,0x06,0xb6,0x00,0x42,0x40,0x01,0x00,0xae,0x01,0xf4,0x1a,0x28,
+0x89,0x79,0xa5,0x02,0xa8,0x98,0x7a,0x93,0x00,0x06,0x9a,0x6a,0x87,0x2b,0x81,0x4a,
+0x4a,0x41,0x00,0xb2,0x5c,0x5c,0x51,0x00,0xb7,0x9d,0x9d,0x95,0x00,0xb1,0x94,0x08,
+0x70,0x08,0x98,0x20,0x00,0x31,0x29,0x03,0xb7,0x02,0xc0,0x04,0x00,0x00,0x60,0x00,
+0x05,0x90,0xd8,0x88,0xc0,0x00,0x50,0x05,0x00,0xf7,0x13,0x00,0xc7,0x76,0xb0,0x3a,
+0xb6,0x67,0xb6,0x74,0x00,0xb5,0x84,0x57,0x53,0x00,0xb5,0x7c,0x97,0x74,0x00,0xb0,
+0x78,0x69,0x70,0x0a,0xac,0x50,0x48,0x11,0x46,0x07,0xcb,0xab,0xdc,0xa5,0x00,0xf2,
+0x1d,0x2a,0x7c,0x9c,0x88,0x01,0xa8,0x9a,0x9b,0x96,0x00,0x05,0x53,0x95,0x80,0x3b,
+0xab,0xb6,0xe7,0xc5,0x01,0xa6,0x9c,0xb8,0xc3,0x01,0xa9,0x67,0x97,0xc3,0x02,0xb8,
+0x87,0xa8,0xd5,0x0b,0xa7,0x10,0x50,0x00,0x46,0x06,0xbb,0xab,0xcb,0x33,0x00,0x10,
+0x13,0x05,0x00,0xf2,0x1c,0x1a,0x00,0x8b,0xba,0x0b,0xba,0xc7,0x82,0x66,0x02,0x90,
+0xb0,0x82,0xb0,0x16,0xc7,0xc6,0x84,0xa0,0x03,0x33,0x33,0x82,0x74,0x0a,0xaa,0xb6,
+0x82,0x19,0x0b,0x00,0x47,0x86,0x97,0x0b,0xaa,0xc7,0x83,0x10,0x0b,0x00,0x46,0x82,
+0x36,0x00,0xf1,0x1e,0x4a,0xdd,0xa6,0xbb,0xd0,0x00,0x88,0x00,0x00,0xa0,0x2c,0xcc,
+0xb0,0x00,0xa0,0x26,0x66,0x95,0xaa,0xe0,0x2a,0x48,0xb7,0x30,0x60,0x29,0x22,0xa7,
+0x30,0x00,0x2a,0x66,0xb7,0x30,0x33,0x2c,0x99,0xb7,0x30,0x55,0x26,0x00,0x93,0xbb,
+0xc1,0x64,0x00,0xf5,0x1d,0x59,0xc5,0xac,0x8c,0xd0,0x54,0x8a,0xac,0x8c,0xd0,0x27,
+0x97,0x25,0xe5,0x30,0x8c,0xdb,0x23,0xe3,0x20,0x08,0xb0,0x9b,0x8b,0xa2,0x0a,0xb9,
+0x3a,0x3a,0x40,0x75,0x81,0x44,0xe4,0x40,0x51,0x80,0x68,0xf8,0x80,0x01,0x80,0x00,
+0xd0,0x7f,0x02,0x80,0x24,0x20,0x03,0x99,0xac,0x75,0x20,0x19,0xfa,0x05,0xf1,0x10,
+0x00,0x55,0x7b,0x55,0x30,0x02,0xa3,0x5a,0x34,0xa0,0x02,0xc7,0x9c,0x78,0xa0,0x01,
+0x97,0x9c,0x78,0x70,0x04,0x99,0xad,0x99,0x90,0x00,0x00,0x28,0x00,0x00,0x29,0x23,
+0x00,0xf1,0x09,0xd7,0x77,0x7a,0x60,0x00,0xd6,0x66,0x69,0x60,0x00,0x87,0x77,0x78,
+0x30,0x18,0x88,0x88,0x88,0x86,0x02,0xb7,0x8c,0x77,0xb0,0x05,0x00,0xa2,0x01,0x77,
+0x8c,0x77,0x50,0x03,0x88,0x9c,0x88,0x70,0x2d,0x00,0x01,0x01,0x00,0xf0,0x1f,0x99,
+0x00,0x0b,0x00,0x08,0x74,0xb0,0x0b,0x00,0x1a,0xbb,0x50,0x0c,0x00,0x00,0x55,0x1c,
+0xcf,0xca,0x0a,0xcc,0x90,0x0b,0x00,0x06,0x55,0x70,0x0b,0x00,0x08,0x69,0x40,0x0b,
+0x00,0x03,0x9b,0x90,0x0b,0x00,0x18,0x51,0x00,0x0b,0x00,0x00,0x50,0x9f,0x01,0xf3,
+0x19,0xd4,0x4b,0xea,0xd0,0x3b,0x0a,0x21,0x90,0xb0,0x5a,0xc8,0x03,0x80,0xb0,0x00,
+0x90,0x28,0xa5,0xa0,0x4a,0xda,0x3a,0x97,0x90,0x15,0x98,0x08,0x23,0x80,0x07,0x96,
+0x0b,0x04,0x60,0x3a,0xb8,0xbe,0xac,0xc6,0x10,0xa7,0x02,0xf2,0x20,0x00,0x00,0x04,
+0xd2,0x0a,0xaa,0x60,0x2b,0x1a,0x29,0x02,0x70,0x5a,0xc7,0x2a,0x9c,0x30,0x00,0x90,
+0x79,0x9d,0xa4,0x4a,0xda,0x53,0xa4,0x62,0x14,0x97,0x19,0x9b,0x70,0x08,0xa8,0x06,
+0xd6,0x50,0x05,0xca,0x94,0x90,0xa4,0x47,0x30,0x08,0xa0,0x01,0xf8,0x00,0xf3,0x1c,
+0xc1,0x0a,0x01,0x90,0x1a,0x3a,0x6d,0x89,0xd4,0x5a,0xc8,0x1b,0x12,0xa1,0x01,0xa1,
+0x69,0x99,0x96,0x38,0xc8,0x2a,0xaa,0xa1,0x15,0x98,0x18,0x00,0x82,0x07,0x96,0x2b,
+0x77,0xc2,0x3a,0xc8,0x2c,0x88,0xc2,0x11,0x00,0x18,0x11,0x91,0x01,0xf6,0x23,0x2a,
+0x3a,0x87,0xd9,0x40,0x07,0x27,0x76,0x3a,0x58,0x03,0xbc,0x4a,0x05,0xb7,0xa0,0x00,
+0x91,0xc5,0x8d,0xa5,0x02,0xad,0x72,0x65,0xb7,0x30,0x14,0x98,0xa4,0x2a,0x31,0x00,
+0x8a,0x6c,0x19,0xd9,0x70,0x03,0xc8,0xc9,0x08,0x00,0x02,0x95,0x72,0x4a,0xa9,0x80,
+0x00,0x01,0x00,0xf2,0x50,0x02,0xc0,0x60,0xa0,0x70,0x3a,0x3a,0x57,0xa6,0x40,0x7a,
+0xc8,0x7a,0xa9,0xa0,0x00,0xa0,0x78,0x66,0xb0,0x5a,0xea,0x85,0x33,0xb0,0x33,0xa8,
+0x79,0x77,0xb0,0x17,0xa7,0x69,0x99,0xa0,0x27,0xd9,0x2a,0x18,0x50,0x23,0x00,0x91,
+0x00,0x72,0x00,0x30,0x00,0x30,0x00,0x06,0xd2,0x69,0xd9,0x92,0x4a,0x1b,0x19,0x07,
+0x30,0x7a,0xd8,0x9b,0xab,0x95,0x00,0xa0,0x49,0x99,0x90,0x5a,0xea,0x87,0x55,0xc0,
+0x34,0xa9,0x79,0x88,0xd0,0x17,0xa6,0x09,0x1b,0x00,0x04,0xdb,0x3b,0x0b,0x07,0x68,
+0x45,0xb2,0x0b,0xa6,0xb1,0x03,0x00,0x37,0x00,0xf0,0x1e,0x03,0xd1,0x46,0xd7,0x61,
+0x2b,0x1a,0x2a,0x28,0x60,0x4a,0xc7,0x8c,0x9c,0x95,0x01,0x91,0x48,0x97,0x90,0x28,
+0xc8,0x69,0xc7,0xd0,0x06,0x98,0x68,0xc6,0xc0,0x06,0x95,0x48,0xd8,0x81,0x05,0xed,
+0x00,0xa1,0x00,0x5a,0x40,0x88,0xd9,0x84,0x5a,0x06,0xf7,0x60,0x10,0x04,0xb0,0xcc,
+0x66,0x50,0x29,0x29,0xc9,0x5b,0x96,0x29,0xc4,0xc7,0xc9,0x70,0x04,0xa2,0x99,0x31,
+0x92,0x18,0xc6,0x89,0x70,0x11,0x25,0x88,0x8a,0xab,0xb4,0x08,0xa5,0x92,0x47,0x45,
+0x04,0xb7,0x92,0x47,0x45,0x2a,0x66,0xdb,0xbd,0xba,0x00,0x8b,0x99,0x99,0x40,0x00,
+0x8a,0x99,0x99,0x10,0x00,0x84,0x22,0x22,0x00,0x00,0x88,0x77,0x77,0x10,0x2a,0xdb,
+0xaa,0xaa,0xa7,0x00,0xa0,0x2a,0x04,0x90,0x00,0xa0,0x06,0xc6,0x00,0x00,0xd7,0xa6,
+0x5b,0x72,0x00,0x83,0x00,0x00,0x55,0xea,0xab,0x6b,0xae,0xd7,0x7b,0x69,0x7d,0xc1,
+0x1b,0x64,0x1c,0xe9,0x98,0x5a,0x9e,0xb0,0x00,0x00,0x0b,0x04,0x00,0xf0,0x42,0x0c,
+0xb0,0x00,0x03,0xbb,0xe9,0x9b,0x7a,0x9e,0xe8,0x8b,0x7a,0x8e,0xb0,0x0b,0x72,0x0b,
+0xeb,0xba,0x6c,0xcf,0xb3,0x99,0xb9,0x4b,0xb0,0x04,0xf0,0x0b,0xb0,0x2b,0x90,0x0b,
+0xb5,0xb1,0x90,0x0b,0xb1,0x04,0xb3,0xbb,0xe8,0x8c,0x4b,0x8e,0xe8,0x8c,0x4b,0x8d,
+0xc2,0x2b,0x48,0x2c,0xd6,0x65,0x16,0x6d,0xb2,0xac,0xad,0x5b,0xb0,0x29,0x1a,0x0b,
+0xb4,0xac,0x9d,0x6b,0xb0,0x74,0x09,0x0b,0xb2,0x80,0x09,0x9c,0xe9,0xb5,0xa9,0x9e,
+0x04,0x00,0xc1,0xc3,0x75,0xa3,0x3c,0xd6,0x62,0x46,0x6d,0xb0,0xa8,0xa7,0x0b,0x04,
+0x00,0xf2,0x13,0xb8,0xa7,0x0b,0xb0,0xa0,0x47,0x0b,0xb2,0x42,0x94,0xab,0xe9,0x98,
+0xb9,0x9e,0xe8,0x98,0xb8,0x8e,0xc1,0x38,0xb1,0x1c,0xd7,0x73,0x57,0x7d,0xb0,0x99,
+0x98,0x0b,0xb0,0xb4,0x4b,0x04,0x00,0xf0,0x21,0xc9,0x99,0x0c,0xb0,0x30,0x03,0xbb,
+0xd8,0x8b,0x6a,0x8b,0x5d,0x77,0xb6,0xa7,0xa5,0xd8,0x8b,0x6b,0x8b,0x5b,0x08,0x22,
+0x72,0x55,0xb6,0xb5,0x9b,0x25,0x5b,0x5b,0xa7,0xa8,0x55,0xb3,0x37,0x71,0x65,0x5b,
+0x28,0xa8,0x78,0x55,0xb0,0x84,0x80,0x5c,0x20,0x46,0x04,0xf6,0x73,0x0e,0xae,0x00,
+0x94,0x00,0xb4,0x8c,0xaa,0xaa,0xab,0xb1,0x90,0x00,0x0a,0xb8,0x50,0xb0,0x05,0x0b,
+0x0b,0x0c,0x4b,0x80,0xb0,0xc0,0xd7,0x10,0x0b,0xa5,0x0b,0x00,0x01,0xb0,0x00,0xc0,
+0x00,0xab,0x00,0x08,0xbb,0xb4,0x00,0x00,0x10,0x00,0x0e,0xba,0x0c,0x00,0xa0,0xa6,
+0x54,0x80,0x0a,0x0a,0xb1,0xd6,0xaa,0xea,0xaa,0x8b,0x52,0x0a,0x0a,0x28,0x65,0xa1,
+0xa0,0xa2,0xa6,0x53,0x7a,0x0b,0x92,0x65,0x00,0xa0,0xa0,0x06,0x50,0x0a,0x0a,0x00,
+0x54,0x0a,0xc0,0x00,0x00,0x22,0x00,0x0e,0xbb,0x0c,0xa9,0x70,0xa6,0x6a,0xb0,0x96,
+0x0a,0xc0,0x33,0xe9,0x00,0xaa,0x38,0x95,0x89,0x4a,0x0a,0x8a,0xda,0xa3,0xb8,0xa6,
+0x09,0x10,0x0a,0x20,0xda,0xda,0xa6,0xa0,0x00,0x09,0x10,0x0a,0x00,0x00,0x91,0x62,
+0x02,0xf3,0x1a,0x0e,0xac,0x8b,0xaa,0xc0,0xa2,0x88,0x20,0x0b,0x0a,0x82,0x8a,0x99,
+0xc0,0xa7,0x48,0x20,0x0b,0x0a,0x0a,0x8b,0xda,0x80,0xa0,0xb8,0x28,0x2a,0x2a,0x84,
+0x82,0x1e,0x20,0xa0,0x08,0x45,0x87,0x0a,0x00,0xaa,0x50,0x85,0x30,0x00,0xf3,0x1c,
+0x03,0x00,0x0e,0xba,0x02,0xd4,0x00,0xa6,0x51,0xa1,0xa4,0x0a,0xb2,0xc4,0x12,0xb5,
+0xab,0x13,0x8d,0x94,0x0a,0x29,0x33,0xc3,0x31,0xa1,0xb7,0x7d,0x77,0x3c,0x93,0x73,
+0xb2,0x90,0xa0,0x2b,0x0b,0x08,0x4a,0x01,0x18,0xc0,0x01,0x32,0x00,0xf5,0x1c,0x05,
+0x00,0x0e,0xba,0x07,0xb5,0x00,0xa5,0x69,0x74,0x79,0x1a,0xb5,0x30,0x90,0x36,0xaa,
+0x26,0x88,0xc5,0x0a,0x19,0x46,0x6d,0x60,0xa1,0xa2,0x22,0x22,0x0b,0x95,0x9d,0xab,
+0x95,0xa0,0x05,0x71,0x69,0x0a,0x01,0xba,0x87,0x93,0xa2,0x0a,0xf2,0x18,0x0e,0xbb,
+0x0b,0x20,0x00,0xa5,0x62,0xda,0xb9,0x0a,0xb1,0xb1,0x0a,0x20,0xaa,0x64,0x53,0x50,
+0x0a,0x19,0xb4,0x49,0xe0,0xb4,0xab,0x43,0x4c,0x0a,0x51,0xb3,0x23,0xc0,0xa0,0x0c,
+0x99,0x9e,0x0a,0x00,0xa0,0xe9,0x08,0xf6,0x1a,0x0e,0xb9,0xa0,0x0b,0x24,0x96,0x4c,
+0xa4,0xe8,0x19,0xb0,0xa0,0x0b,0x05,0x99,0x4e,0xa6,0xca,0x79,0x19,0x46,0xd5,0x50,
+0xa5,0x9a,0x44,0x4a,0x1a,0x61,0xb9,0x99,0xd1,0x90,0x0a,0x00,0x08,0x19,0x00,0xb9,
+0x99,0xd1,0xf5,0x00,0xf4,0x1b,0xb9,0x9a,0xaa,0xa5,0xa7,0x45,0x88,0x89,0x0a,0xb0,
 0x73,0x22,0xb0,0xaa,0x23,0x66,0x66,0x0a,0x18,0xbb,0x9a,0xb5,0xa5,0x99,0x53,0x95,
-0x5b,0x61,0x97,0xc8,0x75,0xa0,0x09,0x0a,0x05,0x5a,0x00,0x90,0xa1,0xb3,0x00,0x87,
-0x3c,0xf5,0x1a,0x0d,0xab,0x89,0xe9,0x93,0x09,0x55,0x09,0x09,0x20,0x09,0xb2,0x99,
-0x99,0x96,0x09,0x84,0x78,0x88,0xb0,0x09,0x0a,0x88,0x77,0xd0,0x0a,0x68,0x78,0x97,
-0xb0,0x0a,0x32,0x88,0xd8,0x86,0x09,0x00,0x11,0xb1,0x11,0x09,0x65,0x10,0x00,0x2c,
-0x01,0xf3,0x1a,0x0d,0xba,0x58,0xd8,0x85,0x97,0x38,0x5b,0x77,0x2a,0xb0,0x0b,0x5b,
-0x63,0xaa,0x9a,0x26,0x66,0x29,0x28,0x93,0xa5,0xb2,0xa3,0x89,0x3c,0x9c,0x2a,0x61,
-0x93,0x94,0xa2,0x90,0x2c,0x63,0x27,0x09,0x09,0x15,0xaa,0xb8,0xa1,0x2d,0xf2,0x21,
-0x15,0x00,0x00,0x00,0xd9,0x8d,0x88,0x60,0x0a,0xb3,0x4c,0x33,0x20,0x38,0xc6,0x6d,
-0x66,0x20,0x01,0xd8,0x8d,0x88,0x30,0x01,0xd7,0x8d,0x77,0x71,0x01,0x63,0x68,0x33,
-0x30,0x29,0x9b,0xff,0xc9,0x96,0x01,0x7a,0x67,0x8a,0x30,0x2a,0x40,0x46,0x02,0x86,
-0xae,0x08,0xf0,0x79,0x5a,0x06,0x5a,0x00,0x1e,0x8d,0x7e,0x8d,0x80,0x4c,0x6c,0x7c,
-0x7c,0x60,0x0a,0x7c,0x5a,0x7c,0x60,0x06,0x78,0x75,0x78,0x71,0x09,0xcb,0x99,0xad,
-0x10,0x00,0x1b,0x52,0xa4,0x00,0x01,0x47,0xee,0x95,0x20,0x4a,0x84,0x00,0x26,0x90,
-0x00,0x50,0x00,0x43,0x00,0x49,0xca,0x92,0x89,0x10,0x06,0x65,0x78,0xcb,0xa4,0x09,
-0x97,0xaf,0x3a,0x00,0x0c,0x99,0xa7,0xbd,0x93,0x15,0xa6,0x56,0x3a,0x00,0x57,0xa6,
-0xb6,0xbe,0xa3,0x59,0xbb,0x96,0x3a,0x00,0x55,0x11,0xa6,0xbe,0xa6,0x54,0x04,0x96,
-0x30,0x00,0x03,0x88,0x8e,0x88,0x80,0x00,0xb8,0x88,0xe8,0x88,0x80,0x09,0x57,0x3b,
-0x57,0x49,0x00,0x07,0x74,0x86,0x75,0x00,0x00,0x27,0xa9,0xa5,0x00,0x02,0xb9,0x31,
-0x90,0x5a,0xa0,0x00,0x88,0x88,0x9e,0x60,0x00,0x00,0x69,0x6b,0xac,0x1f,0x00,0xb0,
-0x60,0xf2,0x47,0x39,0x99,0xe9,0x98,0x0b,0x88,0x8e,0x88,0x96,0xa5,0x73,0xb5,0x74,
-0x82,0x66,0x3b,0x56,0x41,0x19,0x88,0x98,0x86,0x02,0xb4,0x5c,0x44,0xb0,0x2b,0x34,
-0xc3,0x3b,0x01,0xb8,0x8d,0x88,0x68,0x00,0x00,0xb9,0x99,0x80,0x03,0x99,0xac,0x99,
-0x80,0x0b,0x88,0x9c,0x88,0x95,0x0a,0x67,0x58,0x77,0x66,0x01,0x77,0x58,0x77,0x40,
-0x08,0x88,0x89,0x88,0x84,0x02,0x22,0x77,0x22,0x21,0x05,0xba,0xc9,0xd9,0xd0,0x05,
-0x62,0x80,0xa0,0xb0,0x05,0x62,0x80,0xa5,0xb0,0x53,0x01,0xf2,0x4a,0x88,0x9d,0x88,
-0x80,0x0c,0x88,0x9d,0x88,0x88,0x09,0x67,0x49,0x67,0x48,0x00,0x66,0x47,0x66,0x40,
-0x06,0xa8,0x88,0x88,0x84,0x07,0x67,0x77,0x77,0x70,0x08,0x9e,0x8b,0xb8,0xc4,0x0c,
-0x0c,0x13,0x8c,0x70,0x35,0x3a,0x85,0x01,0x55,0x02,0x77,0x9c,0x77,0x60,0x0c,0x77,
-0x9c,0x77,0x96,0x05,0x9a,0x68,0xaa,0x63,0x04,0x96,0x79,0x69,0x80,0x09,0x49,0xa7,
-0x78,0xa1,0x06,0xa9,0xaa,0x9a,0xa0,0x00,0x35,0x28,0x26,0x00,0x02,0xaa,0x49,0xaa,
-0x40,0x1a,0x99,0xbd,0xb8,0xb5,0xac,0x02,0xf0,0x16,0xa7,0x56,0x78,0x91,0x08,0xca,
-0x57,0x61,0xa0,0x14,0xa6,0x4a,0x77,0x80,0x15,0x55,0x54,0xa5,0xb0,0x0a,0x9a,0x8a,
-0xda,0xd6,0x0a,0x89,0x73,0xa4,0xa0,0x0a,0x89,0x75,0xb6,0x50,0x09,0x02,0x70,0xbc,
-0x1a,0xd1,0x58,0xc0,0x00,0x00,0x0a,0x1a,0x10,0x00,0x4b,0xbe,0x1a,0xbb,0xa0,0x0a,
-0x00,0x51,0x2b,0xbe,0x1a,0xbb,0x80,0x0a,0x00,0xa1,0x11,0x1b,0x1a,0x31,0x10,0x59,
-0x9d,0x1a,0xa9,0x91,0x0f,0x00,0x01,0x05,0x00,0x03,0x99,0x59,0x10,0x75,0xb2,0x2d,
-0xf1,0x0e,0xdb,0xba,0xb1,0x0b,0x08,0x10,0xa0,0x92,0x0b,0x08,0xa9,0xc0,0x92,0x0b,
-0x08,0x64,0xb0,0x92,0x0b,0x08,0x53,0xb0,0x92,0x0b,0xad,0xba,0xea,0xd2,0x0b,0x9c,
-0x74,0x11,0x60,0x27,0x6c,0xf7,0x44,0x38,0xdb,0xd0,0x16,0x86,0x70,0x91,0xa0,0x57,
-0x77,0x74,0xa0,0xa0,0x2c,0x89,0x89,0xa0,0xa0,0x2b,0x8a,0x98,0xa0,0xa0,0x59,0xbb,
-0x71,0x90,0xa0,0x37,0x46,0x04,0x50,0xb0,0x39,0xbc,0x8b,0x00,0xb0,0x00,0x46,0x35,
-0x5b,0x50,0x00,0xa2,0x03,0xb4,0x30,0x18,0xd9,0x64,0xd4,0xb0,0x09,0xb9,0x7a,0xaa,
-0xa6,0x0d,0x8a,0x7c,0x55,0xa4,0x0b,0x36,0x7a,0x8a,0xa3,0x05,0xb6,0x39,0x9e,0x96,
-0x3b,0xec,0x98,0x0b,0x00,0x00,0x91,0x0a,0x9e,0x96,0xd2,0x71,0x00,0xf9,0x29,0x70,
-0x06,0xaa,0xbe,0xaa,0xa1,0x00,0x18,0x37,0x3c,0xe2,0x3d,0x43,0xa7,0x32,0x17,0x77,
-0x77,0x77,0x74,0x00,0x8a,0xaa,0xaa,0x30,0x08,0x3d,0x47,0xc9,0x99,0x9c,0x50,0x0a,
-0x00,0x10,0x20,0x59,0x4c,0xf0,0x23,0x65,0xb6,0x9c,0xa7,0x0a,0x75,0xa6,0x99,0x81,
-0x09,0xb6,0xba,0x89,0x09,0x07,0x64,0xb9,0x69,0x74,0x03,0x7a,0x8a,0x9a,0x60,0x18,
-0x8c,0x98,0xc9,0x85,0x00,0x76,0x66,0x68,0x30,0x00,0xb5,0x55,0x59,0x50,0x00,0xb6,
-0x66,0x6a,0x50,0x1a,0xaa,0xdc,0xaa,0xa1,0x01,0x60,0x44,0x60,0x03,0xa4,0x44,0x49,
-0x50,0x03,0x52,0x15,0x02,0x0a,0x00,0x00,0x05,0x00,0xf0,0x12,0x02,0xb9,0x99,0x9b,
-0x40,0x02,0x8b,0x00,0xa9,0x20,0x39,0x30,0x00,0x02,0x92,0x6b,0xea,0x8a,0xea,0xa3,
-0x00,0xb0,0x47,0xd7,0x70,0x00,0xb0,0x84,0x22,0xc0,0x00,0xb0,0x89,0x45,0x46,0xb0,
-0x85,0x33,0xc0,0x00,0xb0,0x86,0x44,0xc0,0x00,0xb0,0x79,0x29,0x49,0xa1,0x06,0x07,
-0x20,0x3b,0x85,0xb4,0x02,0xc3,0x00,0x01,0x85,0x11,0xf0,0x17,0xaa,0xea,0xa4,0x4b,
+0x5b,0x61,0x97,0xc8,0x75,0xa0,0x09,0x0a,0x05,0x5a,0x00,0x90,0xa1,0xb3,0x00,0x00,
+0x23,0x03,0xf4,0x1a,0x0d,0xab,0x89,0xe9,0x93,0x09,0x55,0x09,0x09,0x20,0x09,0xb2,
+0x99,0x99,0x96,0x09,0x84,0x78,0x88,0xb0,0x09,0x0a,0x88,0x77,0xd0,0x0a,0x68,0x78,
+0x97,0xb0,0x0a,0x32,0x88,0xd8,0x86,0x09,0x00,0x11,0xb1,0x11,0x09,0x0b,0x0a,0x01,
+0x2c,0x01,0xf3,0x19,0x0d,0xba,0x58,0xd8,0x85,0x97,0x38,0x5b,0x77,0x2a,0xb0,0x0b,
+0x5b,0x63,0xaa,0x9a,0x26,0x66,0x29,0x28,0x93,0xa5,0xb2,0xa3,0x89,0x3c,0x9c,0x2a,
+0x61,0x93,0x94,0xa2,0x90,0x2c,0x63,0x27,0x09,0x09,0x15,0xaa,0x66,0x0b,0xf2,0x22,
+0x33,0x15,0x00,0x00,0x00,0xd9,0x8d,0x88,0x60,0x0a,0xb3,0x4c,0x33,0x20,0x38,0xc6,
+0x6d,0x66,0x20,0x01,0xd8,0x8d,0x88,0x30,0x01,0xd7,0x8d,0x77,0x71,0x01,0x63,0x68,
+0x33,0x30,0x29,0x9b,0xff,0xc9,0x96,0x01,0x7a,0x67,0x8a,0x30,0x2a,0x40,0x46,0x02,
+0x86,0xae,0x08,0xf0,0x7a,0x5a,0x06,0x5a,0x00,0x1e,0x8d,0x7e,0x8d,0x80,0x4c,0x6c,
+0x7c,0x7c,0x60,0x0a,0x7c,0x5a,0x7c,0x60,0x06,0x78,0x75,0x78,0x71,0x09,0xcb,0x99,
+0xad,0x10,0x00,0x1b,0x52,0xa4,0x00,0x01,0x47,0xee,0x95,0x20,0x4a,0x84,0x00,0x26,
+0x90,0x00,0x50,0x00,0x43,0x00,0x49,0xca,0x92,0x89,0x10,0x06,0x65,0x78,0xcb,0xa4,
+0x09,0x97,0xaf,0x3a,0x00,0x0c,0x99,0xa7,0xbd,0x93,0x15,0xa6,0x56,0x3a,0x00,0x57,
+0xa6,0xb6,0xbe,0xa3,0x59,0xbb,0x96,0x3a,0x00,0x55,0x11,0xa6,0xbe,0xa6,0x54,0x04,
+0x96,0x30,0x00,0x03,0x88,0x8e,0x88,0x80,0x00,0xb8,0x88,0xe8,0x88,0x80,0x09,0x57,
+0x3b,0x57,0x49,0x00,0x07,0x74,0x86,0x75,0x00,0x00,0x27,0xa9,0xa5,0x00,0x02,0xb9,
+0x31,0x90,0x5a,0xa0,0x00,0x88,0x88,0x9e,0x60,0x00,0x00,0x69,0x6b,0x40,0x85,0x05,
+0xf2,0x4a,0xa4,0x00,0x00,0x39,0x99,0xe9,0x98,0x0b,0x88,0x8e,0x88,0x96,0xa5,0x73,
+0xb5,0x74,0x82,0x66,0x3b,0x56,0x41,0x19,0x88,0x98,0x86,0x02,0xb4,0x5c,0x44,0xb0,
+0x2b,0x34,0xc3,0x3b,0x01,0xb8,0x8d,0x88,0x68,0x00,0x00,0xb9,0x99,0x80,0x03,0x99,
+0xac,0x99,0x80,0x0b,0x88,0x9c,0x88,0x95,0x0a,0x67,0x58,0x77,0x66,0x01,0x77,0x58,
+0x77,0x40,0x08,0x88,0x89,0x88,0x84,0x02,0x22,0x77,0x22,0x21,0x05,0xba,0xc9,0xd9,
+0xd0,0x05,0x62,0x80,0xa0,0xb0,0x05,0x62,0x80,0xa5,0xb0,0x53,0x01,0xf2,0x4a,0x88,
+0x9d,0x88,0x80,0x0c,0x88,0x9d,0x88,0x88,0x09,0x67,0x49,0x67,0x48,0x00,0x66,0x47,
+0x66,0x40,0x06,0xa8,0x88,0x88,0x84,0x07,0x67,0x77,0x77,0x70,0x08,0x9e,0x8b,0xb8,
+0xc4,0x0c,0x0c,0x13,0x8c,0x70,0x35,0x3a,0x85,0x01,0x55,0x02,0x77,0x9c,0x77,0x60,
+0x0c,0x77,0x9c,0x77,0x96,0x05,0x9a,0x68,0xaa,0x63,0x04,0x96,0x79,0x69,0x80,0x09,
+0x49,0xa7,0x78,0xa1,0x06,0xa9,0xaa,0x9a,0xa0,0x00,0x35,0x28,0x26,0x00,0x02,0xaa,
+0x49,0xaa,0x40,0x1a,0x99,0xbd,0xb8,0xb5,0xac,0x02,0xf1,0x27,0xa7,0x56,0x78,0x91,
+0x08,0xca,0x57,0x61,0xa0,0x14,0xa6,0x4a,0x77,0x80,0x15,0x55,0x54,0xa5,0xb0,0x0a,
+0x9a,0x8a,0xda,0xd6,0x0a,0x89,0x73,0xa4,0xa0,0x0a,0x89,0x75,0xb6,0x50,0x09,0x02,
+0x70,0x81,0x00,0x09,0x0a,0x58,0xc0,0x00,0x00,0x0a,0x1a,0x10,0x00,0x4b,0xbe,0x1a,
+0xbb,0xa0,0x0a,0x00,0x51,0x2b,0xbe,0x1a,0xbb,0x80,0x0a,0x00,0xa1,0x11,0x1b,0x1a,
+0x31,0x10,0x59,0x9d,0x1a,0xa9,0x91,0x0f,0x00,0x01,0x05,0x00,0xf0,0x19,0x1b,0xbb,
+0xdd,0xbb,0xb7,0x00,0x00,0x75,0x00,0x00,0x08,0xbb,0xdb,0xba,0xb1,0x0b,0x08,0x10,
+0xa0,0x92,0x0b,0x08,0xa9,0xc0,0x92,0x0b,0x08,0x64,0xb0,0x92,0x0b,0x08,0x53,0xb0,
+0x92,0x0b,0xad,0xba,0xea,0xd2,0xb1,0x0e,0xf0,0x56,0x92,0x00,0x60,0x00,0x00,0x00,
+0x29,0xd9,0x38,0xdb,0xd0,0x16,0x86,0x70,0x91,0xa0,0x57,0x77,0x74,0xa0,0xa0,0x2c,
+0x89,0x89,0xa0,0xa0,0x2b,0x8a,0x98,0xa0,0xa0,0x59,0xbb,0x71,0x90,0xa0,0x37,0x46,
+0x04,0x50,0xb0,0x39,0xbc,0x8b,0x00,0xb0,0x00,0x46,0x35,0x5b,0x50,0x00,0xa2,0x03,
+0xb4,0x30,0x18,0xd9,0x64,0xd4,0xb0,0x09,0xb9,0x7a,0xaa,0xa6,0x0d,0x8a,0x7c,0x55,
+0xa4,0x0b,0x36,0x7a,0x8a,0xa3,0x05,0xb6,0x39,0x9e,0x96,0x3b,0xec,0x98,0x0b,0x00,
+0x00,0x91,0x0a,0x9e,0x96,0x00,0x91,0x00,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,
+0x19,0x00,0x00,0x24,0x00,0x00,0x06,0xaa,0xbe,0xaa,0xa1,0x00,0x18,0x00,0x29,0x00,
+0x03,0x3d,0x43,0xa7,0x32,0x17,0x77,0x77,0x77,0x74,0x00,0x8a,0xaa,0xaa,0x30,0x00,
+0xb0,0x00,0x06,0x50,0x00,0xc9,0x99,0x9c,0x50,0x0a,0x00,0xf2,0x36,0x20,0x12,0x00,
+0x00,0x06,0x65,0xb6,0x9c,0xa7,0x0a,0x75,0xa6,0x99,0x81,0x09,0xb6,0xba,0x89,0x09,
+0x07,0x64,0xb9,0x69,0x74,0x03,0x7a,0x8a,0x9a,0x60,0x18,0x8c,0x98,0xc9,0x85,0x00,
+0x76,0x66,0x68,0x30,0x00,0xb5,0x55,0x59,0x50,0x00,0xb6,0x66,0x6a,0x50,0x1a,0xaa,
+0xdc,0xaa,0xa1,0x01,0x55,0xb7,0x55,0x20,0x03,0xa4,0x44,0x49,0x50,0x03,0xc8,0x88,
+0x8b,0x50,0x0a,0x00,0x00,0x05,0x00,0xf0,0x7c,0x02,0xb9,0x99,0x9b,0x40,0x02,0x8b,
+0x00,0xa9,0x20,0x39,0x30,0x00,0x02,0x92,0x6b,0xea,0x8a,0xea,0xa3,0x00,0xb0,0x47,
+0xd7,0x70,0x00,0xb0,0x84,0x22,0xc0,0x00,0xb0,0x89,0x88,0xd0,0x00,0xb0,0x85,0x33,
+0xc0,0x00,0xb0,0x86,0x44,0xc0,0x00,0xb0,0x79,0x99,0xc0,0x00,0xb0,0x06,0x07,0x20,
+0x3b,0x85,0xb4,0x02,0xc3,0x00,0x01,0x00,0x00,0x10,0x00,0x00,0xaa,0xea,0xa4,0x4b,
 0xea,0x01,0xc1,0x10,0x02,0x90,0x87,0x66,0xd0,0x02,0x90,0x89,0x88,0xd0,0x02,0x90,
 0x94,0x33,0xc0,0x04,0xdb,0x96,0x55,0xc0,0x69,0x30,0x8a,0x99,0xd0,0x00,0x00,0x59,
-0x08,0x50,0xd8,0x35,0x22,0x73,0x01,0x1f,0x1a,0xf0,0x07,0x9a,0xbd,0xa3,0x09,0x81,
-0x94,0x99,0x50,0x09,0x81,0x9a,0x33,0xb0,0x09,0x81,0x9a,0x88,0xd0,0x09,0x81,0x99,
-0x22,0x0a,0x00,0x30,0x66,0xc0,0x28,0x0f,0x00,0xc0,0x54,0x41,0x93,0x64,0x60,0x50,
-0x00,0x67,0x00,0x63,0x00,0x11,0xf1,0x07,0xf3,0x1b,0xb3,0xaa,0xea,0xa5,0x4b,0x20,
-0x46,0xd6,0x61,0x00,0x03,0x94,0x33,0xa2,0x01,0xb3,0x99,0x88,0xc2,0x2c,0x30,0x94,
-0x33,0xa2,0x00,0x06,0xa5,0x44,0xa2,0x00,0xa5,0x89,0x99,0xb2,0x2b,0x60,0x59,0x06,
-0x70,0x22,0x06,0x60,0x78,0x5d,0xf0,0x0d,0x6a,0xad,0x8a,0xea,0xa3,0x09,0x84,0x38,
-0xe8,0x80,0x02,0xc3,0x55,0x00,0xb0,0x6a,0xcc,0xab,0x88,0xd0,0x00,0xb7,0x77,0x33,
-0xc0,0x00,0xb4,0x58,0xc8,0x00,0x10,0x5a,0xc8,0x00,0x82,0x09,0x07,0x40,0x3a,0x92,
-0xb3,0x00,0xa3,0x58,0x0a,0xf0,0x1f,0x63,0x09,0xbd,0xa3,0x09,0x6b,0x71,0x67,0x30,
-0x2b,0x96,0x39,0x65,0xc0,0x36,0xb7,0x69,0x98,0xd0,0x0b,0x72,0x89,0x43,0xb0,0x57,
-0x77,0x79,0x55,0xc0,0x10,0x4d,0x08,0x99,0xc0,0x03,0xb3,0x05,0x73,0x70,0x28,0x10,
-0x36,0x00,0x42,0x01,0x11,0x1f,0x28,0xf6,0x1d,0x7a,0x68,0xbb,0x83,0x0c,0x8a,0x56,
-0xba,0x80,0x0b,0x26,0x5a,0x00,0xb0,0x05,0x66,0x2b,0x77,0xd0,0x48,0xc8,0x7b,0x77,
-0xd0,0x0a,0x89,0x78,0x88,0xa0,0x0d,0x91,0x08,0x53,0x90,0x29,0xe2,0x47,0x00,0x64,
-0x71,0x2a,0xa9,0x99,0x94,0x49,0x23,0xf2,0x1e,0x39,0xca,0x8a,0xbc,0xa3,0x07,0x7a,
-0x14,0xa9,0x60,0x09,0x8a,0x3a,0x33,0xb0,0x2c,0x9a,0x9a,0x88,0xd0,0x28,0x69,0x0a,
-0x33,0xb0,0x28,0x27,0x3a,0x55,0xc0,0x37,0x93,0x4a,0x99,0xc0,0x73,0x2a,0x36,0x54,
-0x70,0x43,0x81,0x55,0x00,0x63,0xe6,0x12,0xf0,0x1e,0x97,0x58,0xaa,0xea,0x90,0x2a,
-0xcb,0x93,0x7c,0x53,0x00,0x3e,0x91,0xa4,0x34,0x90,0x3b,0x84,0x9a,0x98,0x99,0x00,
-0x16,0x53,0xa2,0x12,0x90,0x28,0xca,0xba,0x76,0x79,0x00,0x0c,0x70,0x99,0x99,0x80,
-0x08,0x76,0x85,0x80,0x93,0x02,0x40,0x0c,0x48,0xf3,0x1e,0x0d,0x77,0xd5,0xae,0xa7,
-0x0d,0x77,0xd1,0x5d,0x52,0x0d,0x77,0xd4,0x94,0x58,0x08,0x16,0x34,0xb8,0x98,0x3c,
-0x7b,0xb4,0x93,0x48,0x1a,0x69,0x98,0x94,0x58,0x27,0x67,0x88,0xb9,0x97,0x18,0x98,
-0x72,0x91,0x72,0x42,0x52,0x08,0x10,0x17,0x19,0x1c,0xf0,0x06,0x59,0xae,0x97,0x05,
+0x08,0x50,0x00,0x06,0x60,0x00,0x73,0x01,0x00,0x00,0x00,0x00,0x09,0x00,0x9a,0xbd,
+0xa3,0x09,0x81,0x94,0x99,0x50,0x09,0x81,0x9a,0x33,0xb0,0x09,0x81,0x9a,0x88,0xd0,
+0x09,0x81,0x99,0x22,0x0a,0x00,0x30,0x66,0xc0,0x28,0x0f,0x00,0xf0,0x2e,0x54,0x41,
+0x93,0x64,0x60,0x50,0x00,0x67,0x00,0x63,0x00,0x11,0x00,0x00,0x00,0x01,0xb3,0xaa,
+0xea,0xa5,0x4b,0x20,0x46,0xd6,0x61,0x00,0x03,0x94,0x33,0xa2,0x01,0xb3,0x99,0x88,
+0xc2,0x2c,0x30,0x94,0x33,0xa2,0x00,0x06,0xa5,0x44,0xa2,0x00,0xa5,0x89,0x99,0xb2,
+0x2b,0x60,0x59,0x06,0x70,0x22,0x06,0x60,0x00,0x45,0x00,0x01,0x00,0xf0,0x0d,0x6a,
+0xad,0x8a,0xea,0xa3,0x09,0x84,0x38,0xe8,0x80,0x02,0xc3,0x55,0x00,0xb0,0x6a,0xcc,
+0xab,0x88,0xd0,0x00,0xb7,0x77,0x33,0xc0,0x00,0xb4,0x58,0xc8,0x00,0x10,0x5a,0xc8,
+0x00,0x81,0x09,0x07,0x40,0x3a,0x92,0xb3,0x00,0xa3,0x32,0x00,0xf0,0x1f,0x04,0x63,
+0x09,0xbd,0xa3,0x09,0x6b,0x71,0x67,0x30,0x2b,0x96,0x39,0x65,0xc0,0x36,0xb7,0x69,
+0x98,0xd0,0x0b,0x72,0x89,0x43,0xb0,0x57,0x77,0x79,0x55,0xc0,0x10,0x4d,0x08,0x99,
+0xc0,0x03,0xb3,0x05,0x73,0x70,0x28,0x10,0x36,0x00,0x42,0x01,0x96,0x00,0xf1,0x1f,
+0x0c,0x7a,0x68,0xbb,0x83,0x0c,0x8a,0x56,0xba,0x80,0x0b,0x26,0x5a,0x00,0xb0,0x05,
+0x66,0x2b,0x77,0xd0,0x48,0xc8,0x7b,0x77,0xd0,0x0a,0x89,0x78,0x88,0xa0,0x0d,0x91,
+0x08,0x53,0x90,0x29,0xe2,0x47,0x00,0x64,0x71,0x2a,0xa9,0x99,0x94,0x00,0x01,0x00,
+0xf1,0x22,0x40,0x00,0x00,0x00,0x39,0xca,0x8a,0xbc,0xa3,0x07,0x7a,0x14,0xa9,0x60,
+0x09,0x8a,0x3a,0x33,0xb0,0x2c,0x9a,0x9a,0x88,0xd0,0x28,0x69,0x0a,0x33,0xb0,0x28,
+0x27,0x3a,0x55,0xc0,0x37,0x93,0x4a,0x99,0xc0,0x73,0x2a,0x36,0x54,0x70,0x43,0x81,
+0x55,0x00,0x63,0x61,0x01,0xf1,0x50,0x00,0x97,0x58,0xaa,0xea,0x90,0x2a,0xcb,0x93,
+0x7c,0x53,0x00,0x3e,0x91,0xa4,0x34,0x90,0x3b,0x84,0x9a,0x98,0x99,0x00,0x16,0x53,
+0xa2,0x12,0x90,0x28,0xca,0xba,0x76,0x79,0x00,0x0c,0x70,0x99,0x99,0x80,0x08,0x76,
+0x85,0x80,0x93,0x02,0x40,0x05,0x60,0x00,0x80,0x0d,0x77,0xd5,0xae,0xa7,0x0d,0x77,
+0xd1,0x5d,0x52,0x0d,0x77,0xd4,0x94,0x58,0x08,0x16,0x34,0xb8,0x98,0x3c,0x7b,0xb4,
+0x93,0x48,0x1a,0x69,0x98,0x94,0x58,0x27,0x67,0x88,0xb9,0x97,0x18,0x98,0x72,0x91,
+0x72,0x42,0x52,0x08,0x10,0x17,0x9a,0x00,0xf0,0x08,0x1a,0xae,0x59,0xae,0x97,0x05,
 0x67,0x04,0x7b,0x51,0x03,0xd2,0x0b,0x66,0x95,0x6a,0xcd,0x8a,0x19,0x55,0x00,0xb4,
-0x7a,0x05,0x00,0xf1,0x03,0x0a,0x29,0x55,0x00,0xb0,0x04,0x57,0x32,0x00,0xb0,0x03,
-0xb4,0xb0,0x0a,0x90,0x69,0x10,0x37,0xea,0x09,0xf7,0x4b,0x29,0xcb,0x98,0x9d,0x94,
-0x06,0x34,0x52,0x69,0x40,0x0a,0xbd,0x8a,0x46,0x92,0x1a,0x18,0x49,0x09,0x72,0x1b,
-0xa5,0x29,0x08,0x72,0x18,0x3a,0x29,0x27,0x72,0x3a,0x84,0x86,0x64,0x41,0x65,0x89,
-0x03,0xa3,0x90,0x53,0x20,0x56,0x00,0x25,0x09,0xaa,0xaa,0xd4,0x90,0x02,0x7a,0xb0,
-0x5e,0x70,0x29,0xb0,0xb0,0x1a,0x51,0x01,0xa0,0xb0,0x08,0xb6,0x5b,0xda,0xea,0xd3,
-0x60,0x03,0x70,0xb0,0x6b,0x70,0x06,0x50,0xb0,0x4b,0xb2,0x0c,0x00,0xb0,0x0c,0x03,
-0x65,0x00,0xb0,0x05,0xb6,0xe4,0x14,0xf0,0x36,0x95,0x59,0xd7,0xd0,0x58,0x58,0x5a,
-0xd8,0xb0,0x27,0xd6,0x68,0xd8,0x83,0x0b,0x3b,0x28,0x77,0x80,0x0c,0x6b,0x4a,0x77,
-0xd0,0x0d,0x89,0x49,0x66,0xc0,0x0a,0x17,0x4a,0x77,0xd0,0x2d,0xab,0x28,0x06,0x60,
-0x23,0x00,0x70,0x00,0x52,0x29,0xd9,0xa6,0xb9,0xe0,0x03,0x80,0xa5,0x50,0xb0,0x49,
-0x17,0x63,0x88,0x80,0x02,0xc8,0x8d,0x88,0x40,0x02,0xc7,0x7d,0x77,0x00,0x05,0x00,
-0xf6,0x2e,0x10,0x02,0xa8,0x8a,0x88,0xb0,0x0b,0x18,0x35,0x82,0xb0,0x46,0x08,0x06,
-0x19,0x90,0x0d,0xbb,0x60,0x0b,0x00,0x0d,0xbb,0x4c,0x9e,0x99,0x0a,0x65,0x1a,0x0b,
-0x0a,0x0d,0xaa,0x3c,0x5c,0x5a,0x0d,0xbb,0x68,0x5c,0x43,0x03,0x24,0xa9,0x59,0x00,
-0x29,0x87,0x91,0xe5,0x00,0x55,0x53,0x72,0xdb,0x20,0x20,0x3a,0x7a,0x12,0xa9,0x91,
-0x00,0xf0,0x1c,0x0d,0xcb,0x3d,0x88,0x84,0x0d,0xcb,0x1a,0x68,0xa0,0x0a,0x75,0x0a,
-0x73,0x80,0x0c,0xb9,0x1a,0x26,0x50,0x0d,0xcb,0x5a,0xa7,0xb5,0x03,0x34,0x9a,0x67,
-0x65,0x3a,0x67,0x8a,0xb8,0xb5,0x66,0x42,0x7a,0x21,0x20,0x10,0x2a,0x48,0xd5,0x62,
-0x04,0xf0,0x18,0xf2,0x1e,0x0d,0xcb,0x52,0xca,0x10,0x0d,0xcb,0x6e,0x67,0xd3,0x09,
-0x63,0x32,0x44,0x11,0x0d,0xcb,0x29,0x88,0xa0,0x0b,0xa8,0x46,0x87,0x80,0x05,0x67,
-0x98,0x67,0x90,0x3a,0x68,0x8b,0x05,0x40,0x67,0x43,0x8d,0x8a,0x80,0x10,0x2a,0xc2,
-0x47,0x62,0xd2,0x6d,0xf1,0x1d,0x97,0x68,0xbc,0x80,0x1b,0x77,0xa8,0xbb,0xc0,0x4b,
-0xab,0xb2,0x98,0xa0,0x93,0x3a,0x67,0x77,0x70,0x2d,0xa8,0x88,0x88,0x81,0x0c,0x87,
-0x4a,0x77,0xa0,0x0c,0x87,0x4a,0x78,0x90,0x09,0x07,0x08,0x38,0x20,0x09,0x65,0xde,
-0xee,0x93,0x67,0x10,0xf0,0x05,0x12,0x22,0xb5,0x22,0x20,0x46,0x66,0x66,0x66,0x60,
-0x01,0xd8,0x88,0x9b,0x00,0x01,0xc8,0x88,0x8a,0x00,0x53,0x1e,0xf1,0x06,0x70,0x37,
-0x26,0x66,0x50,0xb0,0x37,0x66,0x22,0xb0,0xb0,0x37,0x6b,0x88,0x80,0xb0,0x37,0x10,
-0x00,0x08,0x90,0x6c,0x44,0xf3,0x1e,0x09,0x96,0x68,0xc8,0x90,0x0b,0x1a,0x97,0x66,
-0xc0,0x0a,0x0a,0x94,0x22,0xb0,0x0a,0x0a,0x99,0x88,0x80,0x0a,0x0a,0x99,0x99,0x95,
-0x0e,0xba,0x8a,0x99,0xa4,0x07,0x01,0x55,0x67,0x45,0x00,0x06,0x49,0x72,0x64,0x00,
-0x07,0x03,0x06,0xb1,0xf1,0x3f,0xf2,0x76,0xbd,0xaa,0xa5,0x00,0x63,0x28,0x08,0x00,
-0x01,0xe4,0x7b,0x3e,0x30,0x0b,0x2e,0xbc,0xd1,0xa3,0x06,0xb6,0x65,0x2a,0x51,0x27,
-0x38,0x99,0xd4,0x57,0x04,0x75,0x97,0x80,0x00,0x00,0x16,0xb9,0xb6,0x00,0x08,0x84,
-0x00,0x06,0x60,0x0c,0xa9,0xc0,0x0b,0x60,0x0c,0x78,0xa0,0x0a,0x82,0x09,0x77,0x95,
-0x7c,0x74,0x08,0xba,0x82,0x5d,0x32,0x08,0xba,0x70,0x4f,0x00,0x28,0xcb,0x90,0x87,
-0x50,0x06,0x43,0x40,0xb0,0xa0,0x44,0x88,0x69,0x30,0x57,0x20,0x20,0x04,0x00,0x03,
-0x1c,0xc9,0xc0,0x0b,0x00,0x1c,0x87,0xa0,0x0c,0x22,0x19,0x94,0x90,0x0e,0x87,0x08,
-0xc9,0x70,0x0b,0x00,0x17,0xc8,0x77,0x9d,0x94,0x39,0xda,0x9a,0x10,0x37,0x04,0x34,
-0x6a,0x10,0x37,0x16,0x88,0x5a,0xa9,0xb7,0x41,0x20,0x0a,0x20,0x46,0xb1,0x03,0xf2,
-0x19,0x44,0x89,0x44,0x42,0x05,0x56,0x99,0x66,0x92,0x0a,0xbb,0x69,0x8a,0x60,0x08,
-0x29,0x36,0xa3,0xa1,0x25,0x94,0x13,0x68,0x26,0x00,0xc7,0x77,0x7d,0x10,0x00,0xd9,
-0x99,0x9d,0x10,0x04,0x70,0x00,0x0a,0x10,0x0b,0xd1,0x59,0x04,0x60,0x45,0xf0,0x0c,
-0x58,0x88,0xcb,0x88,0x80,0x01,0x77,0x12,0xc2,0x10,0x00,0x09,0x7c,0x30,0x00,0x00,
-0x28,0xdd,0x61,0x00,0x6c,0xa4,0x00,0x8a,0xd2,0x00,0x83,0x49,0x5e,0x10,0xa1,0x05,
-0x00,0x10,0xc0,0x1e,0x26,0x31,0x40,0x00,0xa1,0x67,0x00,0xf4,0x21,0x9c,0x10,0x00,
-0x16,0xbf,0xff,0xf2,0x00,0x3f,0xff,0xff,0xff,0x20,0x05,0xff,0xd9,0x41,0xf2,0x00,
-0x5f,0x20,0x00,0x1f,0x20,0x05,0xe0,0x00,0x01,0xf2,0x00,0x5e,0x00,0x07,0x9f,0x20,
-0x48,0xe0,0x07,0xff,0xf2,0xaf,0xfe,0x00,0x2b,0xd8,0x07,0xff,0x90,0x77,0x18,0xf1,
-0x1a,0x00,0x41,0x88,0x88,0x88,0x14,0xeb,0xe7,0x77,0x7e,0xbe,0xa2,0xd0,0x00,0x0d,
-0x2a,0xeb,0xe3,0x33,0x3e,0xbe,0xb4,0xfb,0xbb,0xbf,0x4b,0xd9,0xd0,0x00,0x0d,0x9d,
-0xb5,0xd0,0x00,0x0d,0x5b,0xb7,0xff,0xff,0xff,0x7b,0x9a,0x00,0xff,0x05,0xff,0xd6,
-0xff,0xff,0xff,0xff,0xe7,0xff,0xff,0xff,0x67,0x52,0x77,0x77,0x76,0xef,0xc6,0xff,
-0xff,0xfe,0x0f,0x00,0x01,0x51,0x78,0x63,0x88,0x88,0x87,0x5e,0x00,0x00,0x55,0x11,
-0xf0,0x09,0xfd,0x00,0x00,0x00,0x6f,0xf7,0x7c,0x10,0x06,0xff,0x70,0xdf,0xc1,0x6f,
-0xf7,0x00,0x1d,0xfe,0xff,0x70,0x00,0x01,0xdf,0xf7,0x41,0x02,0x12,0x60,0x0b,0x3d,
-0xf0,0x0c,0xd1,0x02,0xea,0xaf,0xd4,0xef,0x80,0xaf,0xff,0x80,0x02,0xff,0xf1,0x02,
-0xef,0xdf,0xd1,0xdf,0x80,0xaf,0xb6,0x70,0x00,0x85,0x00,0x00,0xa6,0x84,0x19,0xf4,
-0x1b,0xea,0x29,0x00,0x0e,0xe1,0xea,0x5f,0xa0,0x7f,0x40,0xea,0x08,0xf3,0xbd,0x00,
-0xea,0x01,0xf7,0xcc,0x00,0xb7,0x00,0xf8,0xaf,0x00,0x00,0x04,0xf6,0x4f,0xa0,0x00,
-0x1d,0xf1,0x09,0xfd,0x89,0xef,0x50,0x00,0x6d,0xff,0xc4,0x75,0x0e,0xfa,0x20,0x88,
-0x10,0x00,0x00,0x05,0xff,0x40,0x00,0x1e,0xcf,0xff,0xfc,0xd0,0x7f,0xff,0xdd,0xff,
-0xf7,0x2d,0xfa,0x00,0xbf,0xd1,0x0b,0xf7,0x00,0x8f,0xa0,0x6f,0xfe,0x55,0xef,0xf6,
-0x4f,0xff,0xff,0xff,0xf3,0x06,0x3a,0xff,0xa3,0x60,0x00,0x03,0xff,0x30,0x26,0x7a,
-0xf0,0x24,0x6f,0x90,0xf8,0x00,0x00,0x09,0xf8,0xec,0xf8,0x00,0x01,0xbe,0x5a,0x5c,
-0xf8,0x00,0x2d,0xd5,0xef,0xf6,0xaf,0x50,0xda,0x6f,0xff,0xff,0x87,0xf1,0x11,0xff,
-0xff,0xff,0xf5,0x10,0x02,0xff,0xc3,0x9f,0xf6,0x00,0x02,0xff,0xb0,0x7f,0xf6,0x00,
-0x01,0xbb,0x70,0x4b,0xb3,0x9a,0x36,0x00,0x26,0x7d,0x27,0xff,0x60,0x05,0x00,0x90,
-0x01,0xff,0xff,0xff,0x60,0x00,0x5f,0xff,0xfa,0x8c,0x00,0xf3,0x02,0xb0,0x00,0x8b,
-0xb9,0x8b,0x8b,0xb9,0xdf,0xff,0xff,0xfe,0xdf,0xcf,0xff,0xff,0xfc,0xbe,0x5b,0x07,
-0x91,0x44,0x44,0x30,0x00,0x01,0xef,0xff,0xff,0xf4,0xaf,0x6d,0xf0,0x06,0x8e,0x10,
-0x6e,0x10,0x00,0x00,0x0c,0xa0,0xee,0xcb,0x10,0x0a,0xcd,0xf2,0xff,0xff,0xb8,0x9f,
-0xff,0xf4,0xff,0x01,0x00,0x20,0xf4,0xcf,0x06,0x00,0xf0,0x23,0xe1,0x00,0x04,0x87,
-0x30,0x5f,0x02,0xdf,0xfe,0xfc,0x7f,0x1e,0xd3,0x00,0x3c,0xff,0x9f,0x10,0x05,0xfe,
-0xff,0x44,0x00,0x02,0x66,0x66,0x12,0x22,0x00,0x00,0x11,0xff,0xff,0x50,0x00,0xda,
-0xff,0xa3,0x10,0x08,0xf4,0xfc,0xfb,0x66,0xbf,0x80,0xf5,0x4c,0xff,0xd5,0xd4,0x6a,
-0x02,0x52,0x71,0x43,0xbf,0xab,0xdf,0xff,0x01,0x00,0x50,0x00,0x3e,0xf0,0x00,0x2c,
-0x14,0x00,0xf0,0x08,0x00,0x0b,0xf0,0x00,0xab,0xdf,0xf0,0x20,0xff,0xff,0xf0,0xa6,
-0xff,0xff,0xf0,0x59,0xff,0xff,0xf0,0x92,0x00,0x3e,0xf0,0x4f,0x0e,0x05,0x0b,0x06,
-0x30,0x70,0x00,0xaa,0x28,0x00,0x90,0x0a,0x4a,0x70,0xab,0xdf,0xf0,0x23,0xe2,0xe0,
-0x2c,0x00,0x20,0x95,0xc2,0x2e,0x00,0x20,0x76,0xc3,0x30,0x00,0xd1,0xc3,0xe1,0x00,
-0x3e,0xf0,0x09,0xa6,0xb0,0x00,0x02,0xc0,0x03,0x3e,0x53,0x2b,0x20,0xc3,0x00,0x28,
-0x20,0x30,0x42,0xff,0xef,0x64,0x01,0xf0,0x09,0x0d,0xff,0xef,0xff,0xf8,0x4e,0xfe,
-0x25,0xff,0xff,0x9d,0xe2,0x00,0x6f,0xf9,0x01,0x20,0x00,0x4f,0xf7,0x44,0x44,0x44,
-0x7f,0xd0,0x00,0x10,0xfc,0x57,0x40,0xf1,0x13,0x07,0xf5,0x00,0x00,0xef,0xc0,0x00,
-0x8f,0xff,0x60,0x3f,0xff,0xff,0x1b,0xff,0xff,0xf9,0xfb,0xff,0xff,0xdd,0x6e,0xff,
-0xfc,0x7e,0x59,0xff,0x60,0x9f,0xff,0x80,0x00,0x13,0x10,0x89,0x0b,0xf2,0x3a,0x70,
-0x03,0xe4,0xe7,0x04,0xff,0x5e,0x75,0xff,0xf5,0xec,0xff,0xff,0x5e,0xff,0xff,0xf5,
-0xea,0xef,0xff,0x5e,0x71,0xdf,0xf5,0xe7,0x01,0xcf,0x59,0x50,0x00,0x92,0x88,0x00,
-0x00,0x00,0x0f,0xfe,0x50,0x00,0x00,0xff,0xff,0xc3,0x00,0x0f,0xff,0xff,0xf9,0x10,
-0xff,0xff,0xff,0xfe,0x5f,0xff,0xff,0xff,0xfa,0xff,0xff,0xff,0xf8,0x0f,0xff,0xff,
-0xb2,0x00,0xff,0xfd,0x40,0x00,0x0e,0xf7,0x4b,0x13,0x03,0x2a,0x05,0xee,0xff,0x90,
-0xdf,0xf9,0xff,0xfc,0x0f,0xff,0xcf,0xff,0xc0,0xff,0xfc,0xff,0x09,0x00,0x71,0xfb,
-0x0f,0xff,0xb8,0xbb,0x50,0x8b,0xf4,0x09,0x00,0xab,0x80,0x10,0xf9,0x3f,0x01,0x01,
-0xbb,0x00,0x0f,0x09,0x00,0x03,0x12,0xb8,0xf3,0x7d,0xf3,0x12,0x00,0x0b,0xa0,0x00,
-0xe7,0xcf,0xb0,0x0e,0x7c,0xff,0xc1,0xe7,0xcf,0xff,0xdf,0x7c,0xff,0xff,0xf7,0xcf,
-0xff,0x9e,0x7c,0xff,0x70,0xe7,0xcf,0x60,0x0e,0x77,0x50,0x00,0x95,0x95,0x1d,0xe0,
-0xaf,0x60,0x00,0x00,0x09,0xff,0xf5,0x00,0x00,0x8f,0xff,0xff,0x40,0x06,0x2f,0x01,
-0x10,0x0e,0xb2,0x00,0x51,0x03,0x66,0x66,0x66,0x62,0x6f,0x00,0xa1,0x0f,0xff,0xff,
-0xff,0xfb,0x06,0x88,0x88,0x88,0x84,0xd7,0x02,0xf2,0x07,0xc7,0x00,0x1d,0xf5,0x01,
-0xdf,0x50,0x1d,0xf5,0x00,0x4f,0xd0,0x00,0x06,0xfc,0x00,0x00,0x6f,0xc0,0x00,0x06,
-0xf9,0x61,0x64,0xf0,0x07,0x3e,0x30,0x00,0x2e,0xf3,0x00,0x02,0xef,0x30,0x00,0x2e,
-0xe3,0x00,0x09,0xf8,0x00,0x8f,0xa0,0x08,0xfa,0x00,0x5f,0x34,0x84,0x03,0xdd,0x1f,
-0x20,0x8f,0x40,0xfe,0x30,0xb0,0x00,0x00,0x00,0x9f,0x50,0x00,0x9b,0xbd,0xfc,0xbb,
-0x6f,0x5c,0x00,0x50,0x13,0x3a,0xf7,0x33,0x10,0x12,0x00,0x02,0x1b,0x00,0x80,0x39,
-0x10,0x00,0xbd,0xdd,0xdd,0xdd,0x8e,0x86,0x00,0x03,0x06,0x35,0x10,0x8a,0x45,0x37,
-0xf2,0x1b,0xcf,0x84,0x6e,0xe3,0x00,0x1e,0xf5,0x08,0x72,0xff,0x40,0xbf,0xe0,0x2d,
-0xf5,0xbf,0xe0,0xdf,0xe3,0xff,0xf6,0xaf,0xf1,0x4f,0xf3,0xaf,0xd1,0xef,0x70,0x05,
-0xfd,0x31,0x2b,0xf7,0x00,0x00,0x19,0xdf,0xea,0x30,0x00,0xb6,0x49,0x15,0xf2,0x24,
-0xfa,0x16,0xaa,0x83,0x00,0x00,0x03,0xef,0xe6,0x49,0xfb,0x00,0x00,0x01,0xbe,0x49,
-0x28,0xfd,0x00,0x1d,0x40,0x8f,0xfe,0x1f,0xf9,0x04,0xff,0x50,0x5f,0xf1,0xff,0xb0,
-0x0a,0xfc,0x00,0x2d,0xdf,0xf2,0x00,0x0a,0xfa,0x10,0x1b,0xf7,0x00,0x00,0x04,0xbe,
-0xe4,0x08,0xf7,0x6e,0x00,0x15,0xf5,0xbd,0x31,0x12,0x02,0xa5,0x2c,0x20,0xbf,0xe1,
-0x06,0x00,0x11,0x4f,0xb3,0x04,0x30,0x0d,0xe7,0xcf,0xdb,0x26,0x20,0xfc,0x08,0x55,
-0x00,0xf0,0x03,0xef,0xd0,0x9f,0xf4,0x00,0x00,0x9f,0xff,0x5c,0xff,0xd0,0x00,0x2f,
-0xff,0xe1,0xaf,0xff,0x60,0x92,0x90,0x40,0xff,0xfe,0x00,0xef,0x89,0x01,0x40,0xf2,
-0x01,0x33,0x33,0xb2,0x3a,0x05,0x01,0x18,0xf3,0x15,0xc1,0xef,0xd1,0x03,0xef,0xfc,
-0x99,0xfb,0x2e,0xec,0xf8,0x00,0x54,0xde,0x25,0x70,0x00,0x0c,0xf4,0x01,0x10,0x00,
-0xbf,0x5c,0x78,0xd1,0xff,0xf6,0x0a,0xff,0xfd,0x78,0x60,0x00,0x7c,0xf6,0x9a,0x6c,
-0x13,0x30,0x9a,0x01,0xf0,0x19,0xaf,0xef,0x60,0x00,0xaf,0x90,0xcf,0x60,0x9f,0x80,
-0x00,0xcf,0x57,0x80,0x00,0x00,0xa4,0x11,0x00,0x00,0x02,0x0c,0xe2,0x00,0x05,0xf8,
-0x3f,0xe2,0x05,0xfd,0x10,0x3f,0xe7,0xfd,0x10,0x00,0x3f,0xfd,0x10,0x00,0xe2,0x32,
-0x03,0xdb,0x50,0xf0,0x07,0xcf,0xc3,0xff,0xff,0xf5,0x00,0xbe,0xfe,0xb3,0x44,0x4e,
-0x60,0x04,0x3f,0x34,0x00,0x00,0xd6,0x00,0x02,0xf2,0x00,0x75,0x89,0xf0,0x07,0x2f,
-0x20,0x00,0x8c,0xea,0xf1,0x01,0xff,0xff,0xf7,0xdf,0xf7,0x00,0x04,0x44,0x44,0x11,
-0xc7,0x00,0x58,0x88,0x20,0xb0,0x02,0x50,0xe4,0x44,0x41,0xff,0xff,0x3b,0x05,0x0e,
-0x01,0x00,0x02,0x59,0x02,0x02,0x90,0x3b,0xa0,0x03,0xff,0x40,0x00,0x00,0x3f,0xff,
-0xf4,0x00,0x02,0xe4,0x05,0x92,0x00,0x36,0xff,0x63,0x00,0x00,0x04,0xff,0x40,0x05,
-0x00,0xb5,0x9a,0xa5,0xff,0x5a,0xa9,0xff,0xff,0xdd,0xfe,0xdf,0xff,0x5c,0x04,0x00,
-0x01,0x00,0x10,0xa8,0xc2,0x03,0x20,0x5f,0xff,0x64,0x05,0x20,0xff,0xe0,0xdb,0x04,
-0x11,0xfa,0xa6,0x00,0x10,0x50,0x16,0x00,0xb0,0xd0,0x00,0x39,0x10,0x4f,0xf4,0x00,
-0xbf,0xfc,0x9f,0xf6,0xdc,0x02,0xa5,0xe4,0x00,0x00,0x9f,0xfd,0x81,0x00,0x00,0x01,
-0x31,0xe7,0x37,0xf5,0x30,0xfe,0x30,0x05,0xc6,0xe7,0xbb,0x05,0xff,0x4d,0xbd,0xb4,
-0xff,0x40,0x3c,0xff,0xff,0x40,0x00,0x08,0xff,0xb0,0x00,0x6f,0xff,0xdf,0x80,0x0e,
-0x7b,0xb2,0xef,0x80,0xdb,0xd9,0x02,0xef,0x73,0xca,0x10,0x02,0x72,0x00,0x5d,0xdd,
-0x48,0x00,0x08,0xff,0xf6,0xf8,0xcc,0x8f,0xff,0x84,0x3f,0xe8,0xff,0xff,0xfc,0xfe,
-0x8f,0xff,0xff,0xcf,0x09,0x00,0x10,0xe7,0x1e,0x03,0x40,0x46,0x66,0x66,0x3f,0xe7,
-0x04,0xf1,0x0d,0x34,0x44,0x43,0x00,0x00,0x02,0x22,0x22,0x00,0x0e,0xff,0xff,0xfe,
-0x20,0xf5,0x22,0x22,0xfe,0x1f,0x40,0x00,0x0e,0xf8,0xf7,0x44,0x44,0xff,0x9f,0x62,
-0x03,0xf0,0x07,0xf6,0x0c,0xff,0x9f,0xff,0x20,0x9f,0xf9,0xff,0xfc,0x7f,0xff,0x9a,
-0xdd,0xdd,0xdd,0xd4,0x67,0x77,0x77,0x77,0x4e,0xad,0x02,0x01,0x95,0x00,0x00,0x7a,
-0x0c,0x00,0xe3,0x01,0x11,0xb0,0xa7,0x62,0x40,0x55,0x55,0x55,0x3f,0x1b,0x00,0x01,
-0x4c,0x44,0x10,0x58,0x29,0x03,0x01,0x38,0x01,0x00,0xdc,0x02,0xf7,0x00,0xf6,0xc5,
-0xdf,0xff,0xfd,0x5c,0xfe,0x6a,0xff,0xa5,0xef,0xff,0xf9,0x55,0x9f,0x51,0x01,0xf0,
-0x06,0x03,0xaa,0xa2,0x00,0x07,0xff,0xf2,0x00,0x09,0xff,0xd0,0x00,0x0b,0xff,0xd8,
-0x81,0x0e,0xff,0xff,0xe1,0x0e,0xac,0x05,0xe1,0x05,0xfd,0x00,0x00,0x09,0xf4,0x00,
-0x00,0x0d,0xa0,0x00,0x00,0x0f,0x20,0xa5,0x03,0xf1,0x23,0x01,0x79,0x11,0x00,0x0f,
-0xfc,0x9f,0xf4,0x00,0xff,0xfd,0xcc,0x30,0x0f,0xfa,0x79,0x93,0x40,0xff,0x8e,0xff,
-0x6f,0x5f,0xf8,0xef,0xf7,0x64,0xff,0x8e,0xff,0xff,0xcf,0xf8,0xef,0xff,0xfc,0x46,
-0x3e,0xff,0xff,0xc0,0x00,0xdf,0xff,0xfc,0x00,0x02,0x44,0x44,0x20,0x2c,0x83,0x50,
-0x02,0xaf,0x81,0x00,0x02,0xdb,0x84,0x80,0x9f,0xff,0xff,0x50,0x0c,0xff,0xff,0xf8,
-0x97,0x02,0x51,0xa0,0x3f,0xff,0xff,0xfe,0xd8,0x03,0x00,0x03,0x09,0x42,0x20,0x00,
-0xbf,0x70,0x63,0x6d,0x00,0x2f,0x05,0x21,0x44,0x30,0xa0,0x00,0xf4,0x0f,0xf3,0xf4,
-0xa0,0xa0,0xb0,0xb0,0xf4,0xff,0xbe,0xae,0xae,0xaf,0xf4,0xff,0x3a,0x0a,0x0a,0x0f,
-0xf4,0xfb,0xea,0xaa,0xaa,0xea,0xf4,0xf7,0xb4,0x44,0x44,0xc4,0x06,0x06,0x00,0xda,
-0x0a,0x10,0x70,0xbb,0x49,0x00,0xd5,0x01,0xb0,0x4b,0xff,0xff,0x70,0x00,0x5d,0xff,
-0xff,0xff,0x10,0x0c,0x5b,0x00,0x60,0x00,0x0a,0xee,0xef,0xff,0xf2,0x08,0x09,0x21,
-0xff,0xa0,0x06,0x00,0x10,0x30,0x06,0x00,0x11,0xfb,0xa5,0x17,0x14,0xf4,0xef,0x19,
-0xf0,0x01,0xef,0xff,0x5b,0x00,0xff,0xff,0x6f,0xb0,0xff,0xff,0x68,0x83,0xff,0xff,
-0xfd,0xd6,0x24,0x05,0x1e,0xff,0x04,0x00,0x26,0xf7,0x00,0xa2,0x20,0xd0,0x05,0xbf,
-0xff,0xfd,0x81,0x00,0x2c,0xfe,0xa8,0x78,0xcf,0xf7,0x0d,0x19,0x00,0xe1,0x3c,0xf5,
-0x22,0x05,0xbe,0xfd,0x81,0x05,0x00,0x09,0xfe,0xa9,0xcf,0xe2,0xd8,0x61,0x01,0xb7,
-0x5a,0x11,0x8c,0x05,0x06,0x22,0x0f,0xf7,0x57,0x73,0x51,0x10,0x00,0x00,0xcf,0xff,
-0xcb,0x04,0xd0,0x75,0x55,0x55,0x55,0x5a,0xf2,0xf6,0xff,0xff,0xff,0xfd,0x4f,0x5f,
-0xa1,0x01,0x91,0xd1,0xf5,0xf5,0x77,0x77,0x77,0x76,0x8f,0x4f,0xfa,0x00,0x11,0xd0,
-0x06,0x01,0x17,0x41,0x2e,0x00,0x21,0x54,0x4a,0x2e,0x00,0x11,0x00,0x2e,0x00,0x21,
-0xf0,0x01,0x2e,0x00,0x1f,0x00,0x2e,0x00,0x05,0x21,0x54,0x44,0x2e,0x00,0x11,0x20,
-0x2e,0x00,0x21,0xf2,0x00,0x2e,0x00,0x1f,0x10,0x2e,0x00,0x05,0x21,0x54,0x44,0x2e,
-0x00,0x20,0x50,0x00,0x2e,0x00,0x21,0xf5,0x00,0x2e,0x00,0x2f,0x20,0x00,0x2e,0x00,
-0x02,0x40,0xfa,0x0f,0x74,0x44,0x2e,0x00,0x11,0xf4,0x87,0x04,0x11,0x5f,0x6a,0x31,
-0x11,0xf5,0x0d,0x00,0x0b,0x2e,0x00,0x00,0x0c,0x83,0x01,0x7d,0x7c,0x21,0xbd,0xf4,
-0x0a,0x24,0xf1,0x05,0x03,0x00,0x00,0x0a,0xf7,0x39,0x00,0x00,0x07,0x60,0xff,0xea,
-0xbf,0xaa,0xaa,0xdf,0x45,0xa3,0x00,0x93,0xf4,0x23,0x31,0x01,0xb8,0xfb,0xb2,0x15,
-0x25,0x9f,0xb0,0x78,0x25,0xf2,0x1c,0x6b,0xca,0x40,0x00,0x9f,0xf6,0xff,0x40,0x1f,
-0xff,0x26,0xfb,0x04,0xf6,0xb4,0x6b,0xf0,0x6f,0xf4,0x06,0xff,0x06,0xff,0x90,0xbf,
-0xf0,0x5f,0x95,0x34,0xcf,0x02,0xfb,0xf3,0x4d,0xc0,0x0c,0xff,0x3d,0xf7,0x00,0x1b,
-0xfe,0xf9,0x32,0x00,0x50,0x12,0x3b,0xca,0x22,0x1f,0xf8,0x02,0x50,0x36,0x66,0x66,
-0x66,0x16,0xf0,0x04,0x8a,0x6f,0x6f,0x6f,0x7f,0x26,0xf6,0xf6,0xf7,0x09,0x00,0x82,
-0x24,0xff,0xff,0xff,0xf1,0x03,0x44,0x44,0xa6,0x40,0x20,0x97,0x00,0xfe,0x05,0x10,
-0xf8,0x79,0x3f,0xc0,0xef,0xe0,0x00,0x00,0xbf,0xe5,0xd4,0x00,0x00,0xbf,0xff,0xe0,
-0x05,0x00,0x13,0xf4,0x05,0x00,0x30,0xaf,0xff,0xf4,0xea,0x06,0x10,0xf4,0xee,0x09,
-0x12,0xf4,0x83,0x72,0x01,0xef,0x10,0x00,0x87,0x17,0x30,0x00,0x08,0xff,0x57,0x03,
-0xf0,0x13,0x08,0xff,0xf9,0x6f,0x69,0xff,0x88,0xff,0xff,0xc1,0x21,0xcf,0xf8,0xdf,
-0xff,0xff,0x50,0x5f,0xff,0x82,0xef,0xff,0x71,0x91,0x7f,0xf8,0x02,0xef,0xfe,0xdf,
-0xde,0xff,0x70,0x02,0x85,0x04,0xf0,0x02,0xe3,0x01,0xdf,0xff,0xe5,0x1d,0x6c,0x5a,
-0xab,0xdf,0x3b,0x18,0x8b,0xff,0xdf,0xde,0xeb,0xae,0x00,0x0c,0x04,0x00,0x45,0xbf,
-0xff,0xff,0xf6,0xf8,0x18,0x00,0x68,0x6b,0x80,0x07,0xf0,0x0b,0xf2,0x00,0x00,0x8f,
-0x0b,0x69,0x00,0x30,0xf0,0x7f,0xfa,0x5f,0x83,0x22,0x6f,0x20,0x58,0x13,0x0c,0x01,
-0x00,0x1f,0xfd,0xe4,0x83,0x04,0x13,0xf8,0x08,0x00,0x17,0xf7,0x14,0x00,0x76,0xfc,
-0xfb,0x00,0xfe,0xfb,0x00,0xfa,0x6e,0x24,0x08,0x01,0x00,0x00,0xa9,0x80,0x1e,0x02,
-0x16,0x00,0x2f,0xf3,0x00,0x01,0x00,0x15,0x1f,0xef,0x1e,0x00,0x0a,0x03,0x88,0x00,
-0xc2,0xfb,0x00,0xff,0x00,0x00,0xf6,0xff,0xf9,0xfb,0x00,0xf9,0x00,0x4d,0x0b,0x00,
-0xfc,0x05,0x2d,0xfc,0xfd,0x92,0x00,0x6f,0xfe,0x00,0xfe,0x00,0x00,0xfc,0x4a,0x00,
-0x01,0x1c,0xfe,0x0a,0x00,0x19,0xff,0x1f,0x00,0x16,0xff,0x00,0x01,0x13,0xfe,0x48,
-0x00,0x3f,0xfe,0xfd,0xfe,0x9c,0x00,0x0a,0x15,0x02,0x3c,0x00,0x11,0xff,0x3f,0x00,
-0x26,0xff,0xfe,0x30,0x00,0x11,0xee,0x04,0x01,0x15,0xeb,0x24,0x00,0x00,0x4b,0x00,
-0x13,0xfe,0x04,0x00,0x08,0x01,0x00,0x13,0x01,0x70,0x00,0x1f,0x01,0x6b,0x00,0x08,
-0x1f,0xfe,0x43,0x01,0x0d,0x1b,0xfb,0x25,0x00,0x12,0xfe,0x67,0x00,0x31,0xfe,0xfd,
-0xfb,0x0f,0x00,0x14,0xe6,0x6c,0x00,0x97,0xfb,0x00,0x00,0xeb,0xfc,0xf2,0xf5,0x00,
-0xed,0x08,0x02,0x25,0xf6,0xf9,0x0c,0x00,0x75,0xe7,0x00,0x00,0x00,0xf5,0x00,0xf0,
-0x48,0x01,0x10,0xff,0x65,0x01,0x01,0x56,0x24,0x1e,0x00,0x40,0x02,0x00,0x63,0x00,
-0x1f,0xfd,0x97,0x00,0x0b,0x3e,0xfa,0x00,0xff,0x8c,0x01,0x03,0x7b,0x02,0xb1,0xef,
-0xee,0x00,0x00,0xfa,0xfe,0xed,0xff,0x01,0x00,0x01,0x60,0x00,0xd3,0xf7,0xf8,0x00,
-0xf7,0xf8,0xfa,0xf7,0x00,0xf9,0xfa,0xfc,0xfa,0xfb,0x5e,0x01,0x66,0xee,0xfd,0x00,
-0x00,0xfa,0xff,0x2b,0x01,0x50,0xfc,0xfd,0x00,0x00,0xfc,0x44,0x01,0x14,0xff,0x8b,
-0x02,0x42,0x01,0x00,0xf6,0xfb,0x51,0x00,0x13,0x01,0x24,0x00,0x04,0x68,0x01,0x27,
-0xff,0x00,0xaf,0x02,0x14,0xfc,0x20,0x01,0x15,0x01,0x51,0x01,0x27,0xfe,0x00,0x8c,
-0x01,0xf0,0x00,0xfe,0x02,0xfc,0xf0,0xfc,0x00,0x00,0xf9,0xfe,0xf9,0xff,0x01,0xf9,
-0x01,0x01,0x92,0x00,0x90,0xfa,0xfb,0xfe,0xfd,0xfb,0xfd,0xfb,0xfe,0xfd,0x4c,0x01,
-0x16,0x01,0xc5,0x00,0x09,0xa8,0x01,0x03,0x48,0x00,0x08,0xf8,0x01,0x06,0x9e,0x02,
-0x0f,0xab,0x01,0x07,0x0f,0x01,0x00,0x06,0x1f,0xff,0xf0,0x01,0x10,0x11,0xff,0x97,
-0x01,0x0e,0x5f,0x00,0x0f,0x4f,0x00,0x07,0x0f,0x1d,0x00,0x0a,0x1e,0x01,0xbd,0x03,
-0x19,0x01,0x81,0x00,0x16,0x01,0x14,0x04,0x0f,0x01,0x00,0x1e,0x0b,0xc9,0x00,0x1f,
-0xf5,0x90,0x00,0x0b,0x05,0xd7,0x01,0x1c,0xf6,0x31,0x02,0x11,0xff,0x93,0x00,0x10,
-0x04,0x2b,0x02,0x0f,0x6f,0x00,0x15,0x17,0x01,0xcc,0x04,0x06,0xa7,0x03,0x1d,0x01,
-0x14,0x01,0x1f,0xf6,0xd8,0x00,0x24,0x1f,0xfe,0x7d,0x01,0x10,0x1f,0xff,0x3d,0x00,
-0x1c,0x03,0x8c,0x01,0x21,0x02,0x03,0x04,0x1f,0x2d,0x04,0x05,0x21,0x00,0xf2,0x0c,
-0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,
-0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0xe2,0x13,0x70,0x1b,0x1c,
-0x00,0x1d,0x1e,0x00,0x1f,0xa5,0x08,0xe1,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,
-0x00,0x24,0x25,0x26,0x24,0x27,0x2f,0x7a,0x0f,0x01,0x00,0xff,0xff,0xc2,0x02,0x33,
-0x03,0x20,0x03,0x02,0x2e,0x03,0x33,0x06,0x07,0x06,0xc3,0x36,0x07,0xa7,0x32,0x11,
-0x0a,0x88,0x19,0x13,0x0b,0xea,0x3f,0x00,0x7e,0x6b,0xb0,0x0d,0x0e,0x0f,0x10,0x11,
-0x12,0x13,0x14,0x00,0x00,0x15,0x9e,0x7d,0x62,0x00,0x17,0x17,0x17,0x18,0x17,0x65,
-0x75,0xd4,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0xd4,
-0x83,0x0c,0x01,0x00,0x1f,0x24,0x2d,0x03,0xff,0xff,0xa8,0x50,0x00,0x00,0x00,0x00,
-0x00,
+0x7a,0x05,0x00,0xf5,0x63,0x0a,0x29,0x55,0x00,0xb0,0x04,0x57,0x32,0x00,0xb0,0x03,
+0xb4,0xb0,0x0a,0x90,0x69,0x10,0x37,0x00,0x50,0x00,0x00,0x00,0x29,0xcb,0x98,0x9d,
+0x94,0x06,0x34,0x52,0x69,0x40,0x0a,0xbd,0x8a,0x46,0x92,0x1a,0x18,0x49,0x09,0x72,
+0x1b,0xa5,0x29,0x08,0x72,0x18,0x3a,0x29,0x27,0x72,0x3a,0x84,0x86,0x64,0x41,0x65,
+0x89,0x03,0xa3,0x90,0x53,0x20,0x56,0x00,0x25,0x09,0xaa,0xaa,0xd4,0x90,0x02,0x7a,
+0xb0,0x5e,0x70,0x29,0xb0,0xb0,0x1a,0x51,0x01,0xa0,0xb0,0x08,0xb6,0x5b,0xda,0xea,
+0xd3,0x60,0x03,0x70,0xb0,0x6b,0x70,0x06,0x50,0xb0,0x4b,0xb2,0x0c,0x00,0xb0,0x0c,
+0x03,0x65,0x00,0xb0,0x05,0xb6,0x00,0x01,0x00,0xf0,0x37,0x03,0x95,0x59,0xd7,0xd0,
+0x58,0x58,0x5a,0xd8,0xb0,0x27,0xd6,0x68,0xd8,0x83,0x0b,0x3b,0x28,0x77,0x80,0x0c,
+0x6b,0x4a,0x77,0xd0,0x0d,0x89,0x49,0x66,0xc0,0x0a,0x17,0x4a,0x77,0xd0,0x2d,0xab,
+0x28,0x06,0x60,0x23,0x00,0x70,0x00,0x52,0x29,0xd9,0xa6,0xb9,0xe0,0x03,0x80,0xa5,
+0x50,0xb0,0x49,0x17,0x63,0x88,0x80,0x02,0xc8,0x8d,0x88,0x40,0x02,0xc7,0x7d,0x77,
+0x00,0x05,0x00,0xf6,0x2e,0x10,0x02,0xa8,0x8a,0x88,0xb0,0x0b,0x18,0x35,0x82,0xb0,
+0x46,0x08,0x06,0x19,0x90,0x0d,0xbb,0x60,0x0b,0x00,0x0d,0xbb,0x4c,0x9e,0x99,0x0a,
+0x65,0x1a,0x0b,0x0a,0x0d,0xaa,0x3c,0x5c,0x5a,0x0d,0xbb,0x68,0x5c,0x43,0x03,0x24,
+0xa9,0x59,0x00,0x29,0x87,0x91,0xe5,0x00,0x55,0x53,0x72,0xdb,0x20,0x20,0x3a,0x7a,
+0x12,0xa9,0x91,0x00,0xf4,0x1e,0x0d,0xcb,0x3d,0x88,0x84,0x0d,0xcb,0x1a,0x68,0xa0,
+0x0a,0x75,0x0a,0x73,0x80,0x0c,0xb9,0x1a,0x26,0x50,0x0d,0xcb,0x5a,0xa7,0xb5,0x03,
+0x34,0x9a,0x67,0x65,0x3a,0x67,0x8a,0xb8,0xb5,0x66,0x42,0x7a,0x21,0x20,0x10,0x2a,
+0x48,0x88,0x85,0x35,0x00,0xf1,0x20,0x32,0x00,0x0d,0xcb,0x52,0xca,0x10,0x0d,0xcb,
+0x6e,0x67,0xd3,0x09,0x63,0x32,0x44,0x11,0x0d,0xcb,0x29,0x88,0xa0,0x0b,0xa8,0x46,
+0x87,0x80,0x05,0x67,0x98,0x67,0x90,0x3a,0x68,0x8b,0x05,0x40,0x67,0x43,0x8d,0x8a,
+0x80,0x10,0x2a,0xc2,0x47,0x62,0x34,0x00,0xf1,0x82,0x1c,0x97,0x68,0xbc,0x80,0x1b,
+0x77,0xa8,0xbb,0xc0,0x4b,0xab,0xb2,0x98,0xa0,0x93,0x3a,0x67,0x77,0x70,0x2d,0xa8,
+0x88,0x88,0x81,0x0c,0x87,0x4a,0x77,0xa0,0x0c,0x87,0x4a,0x78,0x90,0x09,0x07,0x08,
+0x38,0x20,0x09,0x65,0xde,0xee,0x93,0x00,0x00,0x20,0x00,0x00,0x12,0x22,0xb5,0x22,
+0x20,0x46,0x66,0x66,0x66,0x60,0x01,0xd8,0x88,0x9b,0x00,0x01,0xc8,0x88,0x8a,0x00,
+0x29,0x99,0x99,0x99,0x70,0x37,0x26,0x66,0x50,0xb0,0x37,0x66,0x22,0xb0,0xb0,0x37,
+0x6b,0x88,0x80,0xb0,0x37,0x10,0x00,0x08,0x90,0x00,0x00,0x00,0x60,0x00,0x09,0x96,
+0x68,0xc8,0x90,0x0b,0x1a,0x97,0x66,0xc0,0x0a,0x0a,0x94,0x22,0xb0,0x0a,0x0a,0x99,
+0x88,0x80,0x0a,0x0a,0x99,0x99,0x95,0x0e,0xba,0x8a,0x99,0xa4,0x07,0x01,0x55,0x67,
+0x45,0x00,0x06,0x49,0x72,0x64,0x00,0x07,0x03,0x06,0xb1,0x96,0x00,0xf2,0x78,0x0a,
+0xaa,0xbd,0xaa,0xa5,0x00,0x63,0x28,0x08,0x00,0x01,0xe4,0x7b,0x3e,0x30,0x0b,0x2e,
+0xbc,0xd1,0xa3,0x06,0xb6,0x65,0x2a,0x51,0x27,0x38,0x99,0xd4,0x57,0x04,0x75,0x97,
+0x80,0x00,0x00,0x16,0xb9,0xb6,0x00,0x08,0x84,0x00,0x06,0x60,0x0c,0xa9,0xc0,0x0b,
+0x60,0x0c,0x78,0xa0,0x0a,0x82,0x09,0x77,0x95,0x7c,0x74,0x08,0xba,0x82,0x5d,0x32,
+0x08,0xba,0x70,0x4f,0x00,0x28,0xcb,0x90,0x87,0x50,0x06,0x43,0x40,0xb0,0xa0,0x44,
+0x88,0x69,0x30,0x57,0x20,0x20,0x04,0x00,0x03,0x1c,0xc9,0xc0,0x0b,0x00,0x1c,0x87,
+0xa0,0x0c,0x22,0x19,0x94,0x90,0x0e,0x87,0x08,0xc9,0x70,0x0b,0x00,0x17,0xc8,0x77,
+0x9d,0x94,0x39,0xda,0x9a,0x10,0x37,0x04,0x34,0x6a,0x10,0x37,0x16,0x88,0x5a,0xa9,
+0xb7,0x41,0x20,0x0a,0x20,0x46,0xb1,0x03,0xf3,0x1d,0x44,0x89,0x44,0x42,0x05,0x56,
+0x99,0x66,0x92,0x0a,0xbb,0x69,0x8a,0x60,0x08,0x29,0x36,0xa3,0xa1,0x25,0x94,0x13,
+0x68,0x26,0x00,0xc7,0x77,0x7d,0x10,0x00,0xd9,0x99,0x9d,0x10,0x04,0x70,0x00,0x0a,
+0x10,0x0b,0x00,0x00,0x0a,0x10,0x8a,0x01,0xf0,0x14,0x60,0x00,0x00,0x58,0x88,0xcb,
+0x88,0x80,0x01,0x77,0x12,0xc2,0x10,0x00,0x09,0x7c,0x30,0x00,0x00,0x28,0xdd,0x61,
+0x00,0x6c,0xa4,0x00,0x8a,0xd2,0x00,0x83,0x00,0xa1,0x00,0x00,0xa1,0x05,0x00,0x81,
+0xc0,0x00,0xa1,0x00,0x09,0x40,0x00,0xa1,0x67,0x00,0xf0,0x21,0x9c,0x10,0x00,0x16,
+0xbf,0xff,0xf2,0x00,0x3f,0xff,0xff,0xff,0x20,0x05,0xff,0xd9,0x41,0xf2,0x00,0x5f,
+0x20,0x00,0x1f,0x20,0x05,0xe0,0x00,0x01,0xf2,0x00,0x5e,0x00,0x07,0x9f,0x20,0x48,
+0xe0,0x07,0xff,0xf2,0xaf,0xfe,0x00,0x2b,0xd8,0x07,0xff,0x90,0xb0,0x04,0x01,0x70,
+0x00,0xf1,0x19,0x41,0x88,0x88,0x88,0x14,0xeb,0xe7,0x77,0x7e,0xbe,0xa2,0xd0,0x00,
+0x0d,0x2a,0xeb,0xe3,0x33,0x3e,0xbe,0xb4,0xfb,0xbb,0xbf,0x4b,0xd9,0xd0,0x00,0x0d,
+0x9d,0xb5,0xd0,0x00,0x0d,0x5b,0xb7,0xff,0xff,0xff,0x7b,0x9a,0x00,0xff,0x05,0xff,
+0xd6,0xff,0xff,0xff,0xff,0xe7,0xff,0xff,0xff,0x67,0x52,0x77,0x77,0x76,0xef,0xc6,
+0xff,0xff,0xfe,0x0f,0x00,0x01,0x51,0x78,0x63,0x88,0x88,0x87,0x5e,0x00,0xf0,0x0d,
+0x00,0x00,0x00,0x06,0xfd,0x00,0x00,0x00,0x6f,0xf7,0x7c,0x10,0x06,0xff,0x70,0xdf,
+0xc1,0x6f,0xf7,0x00,0x1d,0xfe,0xff,0x70,0x00,0x01,0xdf,0xf7,0x41,0x02,0x11,0x60,
+0x58,0x00,0xf3,0x3b,0x0c,0xd1,0x02,0xea,0xaf,0xd4,0xef,0x80,0xaf,0xff,0x80,0x02,
+0xff,0xf1,0x02,0xef,0xdf,0xd1,0xdf,0x80,0xaf,0xb6,0x70,0x00,0x85,0x00,0x00,0xa6,
+0x00,0x00,0x02,0xa0,0xea,0x29,0x00,0x0e,0xe1,0xea,0x5f,0xa0,0x7f,0x40,0xea,0x08,
+0xf3,0xbd,0x00,0xea,0x01,0xf7,0xcc,0x00,0xb7,0x00,0xf8,0xaf,0x00,0x00,0x04,0xf6,
+0x4f,0xa0,0x00,0x1d,0xf1,0x09,0xfd,0x89,0xef,0x50,0x00,0x6d,0xff,0xc4,0x43,0x01,
+0xf9,0x22,0x01,0x88,0x10,0x00,0x00,0x05,0xff,0x40,0x00,0x1e,0xcf,0xff,0xfc,0xd0,
+0x7f,0xff,0xdd,0xff,0xf7,0x2d,0xfa,0x00,0xbf,0xd1,0x0b,0xf7,0x00,0x8f,0xa0,0x6f,
+0xfe,0x55,0xef,0xf6,0x4f,0xff,0xff,0xff,0xf3,0x06,0x3a,0xff,0xa3,0x60,0x00,0x03,
+0xff,0x30,0x00,0x01,0x00,0xf7,0x2e,0x6f,0x90,0xf8,0x00,0x00,0x09,0xf8,0xec,0xf8,
+0x00,0x01,0xbe,0x5a,0x5c,0xf8,0x00,0x2d,0xd5,0xef,0xf6,0xaf,0x50,0xda,0x6f,0xff,
+0xff,0x87,0xf1,0x11,0xff,0xff,0xff,0xf5,0x10,0x02,0xff,0xc3,0x9f,0xf6,0x00,0x02,
+0xff,0xb0,0x7f,0xf6,0x00,0x01,0xbb,0x70,0x4b,0xb3,0x00,0x00,0x00,0x88,0x20,0x00,
+0x00,0x01,0xff,0x60,0x05,0x00,0x90,0x01,0xff,0xff,0xff,0x60,0x00,0x5f,0xff,0xfa,
+0x8c,0x00,0xf2,0x02,0xb0,0x00,0x8b,0xb9,0x8b,0x8b,0xb9,0xdf,0xff,0xff,0xfe,0xdf,
+0xcf,0xff,0xff,0xfc,0xbe,0x6c,0x00,0xf0,0x15,0x24,0x44,0x44,0x30,0x00,0x01,0xef,
+0xff,0xff,0xf4,0x00,0x0b,0xc0,0x00,0x00,0x8e,0x10,0x6e,0x10,0x00,0x00,0x0c,0xa0,
+0xee,0xcb,0x10,0x0a,0xcd,0xf2,0xff,0xff,0xb8,0x9f,0xff,0xf4,0xff,0x01,0x00,0x20,
+0xf4,0xcf,0x06,0x00,0xf2,0x25,0xe1,0x00,0x04,0x87,0x30,0x5f,0x02,0xdf,0xfe,0xfc,
+0x7f,0x1e,0xd3,0x00,0x3c,0xff,0x9f,0x10,0x05,0xfe,0xff,0x44,0x00,0x02,0x66,0x66,
+0x12,0x22,0x00,0x00,0x11,0xff,0xff,0x50,0x00,0xda,0xff,0xa3,0x10,0x08,0xf4,0xfc,
+0xfb,0x66,0xbf,0x80,0xf5,0x4c,0xff,0xd5,0x00,0x31,0x68,0x00,0x63,0x70,0x00,0xbf,
+0xab,0xdf,0xff,0x01,0x00,0x50,0x00,0x3e,0xf0,0x00,0x2c,0x14,0x00,0xf0,0x05,0x00,
+0x0b,0xf0,0x00,0xab,0xdf,0xf0,0x20,0xff,0xff,0xf0,0xa6,0xff,0xff,0xf0,0x59,0xff,
+0xff,0xf0,0x92,0x1d,0x00,0x35,0x00,0x02,0xc0,0x0b,0x06,0x30,0x70,0x00,0xaa,0x28,
+0x00,0x90,0x0a,0x4a,0x70,0xab,0xdf,0xf0,0x23,0xe2,0xe0,0x2c,0x00,0x20,0x95,0xc2,
+0x2e,0x00,0x20,0x76,0xc3,0x30,0x00,0xe0,0xc3,0xe1,0x00,0x3e,0xf0,0x09,0xa6,0xb0,
+0x00,0x02,0xc0,0x03,0x3e,0x20,0x36,0x00,0x10,0xc3,0xd6,0x00,0x40,0x44,0x42,0xff,
+0xef,0x64,0x01,0xf0,0x09,0x0d,0xff,0xef,0xff,0xf8,0x4e,0xfe,0x25,0xff,0xff,0x9d,
+0xe2,0x00,0x6f,0xf9,0x01,0x20,0x00,0x4f,0xf7,0x44,0x44,0x44,0x7f,0xd0,0x00,0xf1,
+0x17,0xfc,0x00,0x1a,0x00,0x00,0x07,0xf5,0x00,0x00,0xef,0xc0,0x00,0x8f,0xff,0x60,
+0x3f,0xff,0xff,0x1b,0xff,0xff,0xf9,0xfb,0xff,0xff,0xdd,0x6e,0xff,0xfc,0x7e,0x59,
+0xff,0x60,0x9f,0xff,0x80,0x00,0x13,0xa8,0x02,0xf0,0x3a,0x0e,0x70,0x03,0xe4,0xe7,
+0x04,0xff,0x5e,0x75,0xff,0xf5,0xec,0xff,0xff,0x5e,0xff,0xff,0xf5,0xea,0xef,0xff,
+0x5e,0x71,0xdf,0xf5,0xe7,0x01,0xcf,0x59,0x50,0x00,0x92,0x88,0x00,0x00,0x00,0x0f,
+0xfe,0x50,0x00,0x00,0xff,0xff,0xc3,0x00,0x0f,0xff,0xff,0xf9,0x10,0xff,0xff,0xff,
+0xfe,0x5f,0xff,0xff,0xff,0xfa,0xff,0xff,0xff,0xf8,0x0f,0xff,0xff,0xb2,0x00,0xff,
+0xfd,0x40,0x00,0x0e,0x77,0x02,0x15,0x11,0x2a,0x05,0xee,0xff,0x90,0xdf,0xf9,0xff,
+0xfc,0x0f,0xff,0xcf,0xff,0xc0,0xff,0xfc,0xff,0x09,0x00,0x82,0xfb,0x0f,0xff,0xb8,
+0xbb,0x50,0x8b,0xb5,0x2d,0x00,0x30,0xff,0xff,0xf9,0x3f,0x01,0x01,0xbb,0x00,0x0f,
+0x09,0x00,0x03,0x40,0xb8,0xbb,0xbb,0xbb,0x2d,0x00,0xf0,0x14,0x0b,0xa0,0x00,0xe7,
+0xcf,0xb0,0x0e,0x7c,0xff,0xc1,0xe7,0xcf,0xff,0xdf,0x7c,0xff,0xff,0xf7,0xcf,0xff,
+0x9e,0x7c,0xff,0x70,0xe7,0xcf,0x60,0x0e,0x77,0x50,0x00,0x95,0x00,0x00,0x02,0x53,
+0x00,0xe0,0xaf,0x60,0x00,0x00,0x09,0xff,0xf5,0x00,0x00,0x8f,0xff,0xff,0x40,0x06,
+0x2f,0x01,0x10,0x0e,0xb2,0x00,0x51,0x03,0x66,0x66,0x66,0x62,0x6f,0x00,0xa1,0x0f,
+0xff,0xff,0xff,0xfb,0x06,0x88,0x88,0x88,0x84,0xd7,0x02,0xf2,0x28,0xc7,0x00,0x1d,
+0xf5,0x01,0xdf,0x50,0x1d,0xf5,0x00,0x4f,0xd0,0x00,0x06,0xfc,0x00,0x00,0x6f,0xc0,
+0x00,0x06,0xf9,0x00,0x00,0x51,0x00,0x00,0x00,0x3e,0x30,0x00,0x2e,0xf3,0x00,0x02,
+0xef,0x30,0x00,0x2e,0xe3,0x00,0x09,0xf8,0x00,0x8f,0xa0,0x08,0xfa,0x00,0x5f,0xa0,
+0x00,0x06,0x00,0x00,0xa1,0x07,0xf0,0x02,0x8f,0x40,0x00,0x00,0x09,0xf5,0x00,0x00,
+0x00,0x9f,0x50,0x00,0x9b,0xbd,0xfc,0xbb,0x6f,0x5c,0x00,0x50,0x13,0x3a,0xf7,0x33,
+0x10,0x12,0x00,0x02,0x1b,0x00,0x80,0x39,0x10,0x00,0xbd,0xdd,0xdd,0xdd,0x8e,0x86,
+0x00,0x12,0x00,0xc2,0x04,0xf2,0x1f,0x8a,0x95,0x00,0x00,0x01,0xcf,0x84,0x6e,0xe3,
+0x00,0x1e,0xf5,0x08,0x72,0xff,0x40,0xbf,0xe0,0x2d,0xf5,0xbf,0xe0,0xdf,0xe3,0xff,
+0xf6,0xaf,0xf1,0x4f,0xf3,0xaf,0xd1,0xef,0x70,0x05,0xfd,0x31,0x2b,0xf7,0x00,0x00,
+0x19,0xdf,0xea,0x30,0x00,0x18,0x07,0xf2,0x25,0x06,0xfa,0x16,0xaa,0x83,0x00,0x00,
+0x03,0xef,0xe6,0x49,0xfb,0x00,0x00,0x01,0xbe,0x49,0x28,0xfd,0x00,0x1d,0x40,0x8f,
+0xfe,0x1f,0xf9,0x04,0xff,0x50,0x5f,0xf1,0xff,0xb0,0x0a,0xfc,0x00,0x2d,0xdf,0xf2,
+0x00,0x0a,0xfa,0x10,0x1b,0xf7,0x00,0x00,0x04,0xbe,0xe4,0x08,0xf7,0x6e,0x00,0x11,
+0xf5,0xc0,0x03,0x00,0x83,0x09,0x21,0x02,0xe6,0x0b,0x00,0x20,0xbf,0xe1,0x06,0x00,
+0x11,0x4f,0xb3,0x04,0x90,0x0d,0xe7,0xcf,0x20,0x00,0x00,0x07,0xfc,0x08,0x55,0x00,
+0xf0,0x0b,0xef,0xd0,0x9f,0xf4,0x00,0x00,0x9f,0xff,0x5c,0xff,0xd0,0x00,0x2f,0xff,
+0xe1,0xaf,0xff,0x60,0x0b,0xff,0xfe,0x2b,0xff,0xfe,0x00,0xef,0x89,0x01,0x75,0xf2,
+0x01,0x33,0x33,0x33,0x33,0x32,0xd4,0x03,0xf3,0x1e,0x07,0xc1,0xef,0xd1,0x03,0xef,
+0xfc,0x99,0xfb,0x2e,0xec,0xf8,0x00,0x54,0xde,0x25,0x70,0x00,0x0c,0xf4,0x01,0x10,
+0x00,0xbf,0x5c,0x78,0xd1,0xff,0xf6,0x0a,0xff,0xfd,0x78,0x60,0x00,0x7c,0xf6,0x00,
+0x00,0x00,0x05,0x60,0x00,0x00,0x30,0x9a,0x01,0xf1,0x1f,0xaf,0xef,0x60,0x00,0xaf,
+0x90,0xcf,0x60,0x9f,0x80,0x00,0xcf,0x57,0x80,0x00,0x00,0xa4,0x11,0x00,0x00,0x02,
+0x0c,0xe2,0x00,0x05,0xf8,0x3f,0xe2,0x05,0xfd,0x10,0x3f,0xe7,0xfd,0x10,0x00,0x3f,
+0xfd,0x10,0x00,0x00,0x3b,0x10,0x00,0x00,0x80,0x67,0x00,0xf0,0x21,0xcf,0xc3,0xff,
+0xff,0xf5,0x00,0xbe,0xfe,0xb3,0x44,0x4e,0x60,0x04,0x3f,0x34,0x00,0x00,0xd6,0x00,
+0x02,0xf2,0x00,0x00,0x0d,0x60,0x00,0x2f,0x20,0x00,0x8c,0xea,0xf1,0x01,0xff,0xff,
+0xf7,0xdf,0xf7,0x00,0x04,0x44,0x44,0x11,0xc7,0x00,0x58,0x88,0x20,0xb0,0x02,0x50,
+0xe4,0x44,0x41,0xff,0xff,0x3b,0x05,0x1e,0xff,0x01,0x00,0x02,0x26,0x03,0x20,0x00,
+0x33,0x67,0x08,0x90,0xff,0x40,0x00,0x00,0x3f,0xff,0xf4,0x00,0x02,0xe4,0x05,0x92,
+0x00,0x36,0xff,0x63,0x00,0x00,0x04,0xff,0x40,0x05,0x00,0xb5,0x9a,0xa5,0xff,0x5a,
+0xa9,0xff,0xff,0xdd,0xfe,0xdf,0xff,0x5c,0x04,0x00,0x01,0x00,0x10,0xa8,0xc2,0x03,
+0x20,0x5f,0xff,0x64,0x05,0x20,0xff,0xe0,0xdb,0x04,0x11,0xfa,0xa6,0x00,0x10,0x50,
+0x16,0x00,0xb0,0xd0,0x00,0x39,0x10,0x4f,0xf4,0x00,0xbf,0xfc,0x9f,0xf6,0xdc,0x02,
+0xa4,0xe4,0x00,0x00,0x9f,0xfd,0x81,0x00,0x00,0x01,0x31,0x3d,0x00,0xf5,0x31,0x06,
+0xfe,0x30,0x05,0xc6,0xe7,0xbb,0x05,0xff,0x4d,0xbd,0xb4,0xff,0x40,0x3c,0xff,0xff,
+0x40,0x00,0x08,0xff,0xb0,0x00,0x6f,0xff,0xdf,0x80,0x0e,0x7b,0xb2,0xef,0x80,0xdb,
+0xd9,0x02,0xef,0x73,0xca,0x10,0x02,0x72,0x00,0x5d,0xdd,0x48,0x00,0x08,0xff,0xf6,
+0xf8,0xcc,0x8f,0xff,0x84,0x3f,0xe8,0xff,0xff,0xfc,0xfe,0x8f,0xff,0xff,0xcf,0x09,
+0x00,0x10,0xe7,0x1e,0x03,0x40,0x46,0x66,0x66,0x3f,0xe7,0x04,0xf1,0x0d,0x34,0x44,
+0x43,0x00,0x00,0x02,0x22,0x22,0x00,0x0e,0xff,0xff,0xfe,0x20,0xf5,0x22,0x22,0xfe,
+0x1f,0x40,0x00,0x0e,0xf8,0xf7,0x44,0x44,0xff,0x9f,0x62,0x03,0xf0,0x07,0xf6,0x0c,
+0xff,0x9f,0xff,0x20,0x9f,0xf9,0xff,0xfc,0x7f,0xff,0x9a,0xdd,0xdd,0xdd,0xd4,0x67,
+0x77,0x77,0x77,0x4e,0xad,0x02,0x01,0x95,0x00,0x00,0x7a,0x0c,0x00,0xe3,0x01,0x10,
+0xb0,0x0e,0x00,0x50,0x45,0x55,0x55,0x55,0x3f,0x1b,0x00,0x60,0x11,0x11,0x11,0x11,
+0x00,0x58,0x29,0x03,0x01,0x38,0x01,0x00,0xdc,0x02,0xf7,0x00,0xf6,0xc5,0xdf,0xff,
+0xfd,0x5c,0xfe,0x6a,0xff,0xa5,0xef,0xff,0xf9,0x55,0x9f,0x51,0x01,0xf0,0x06,0x03,
+0xaa,0xa2,0x00,0x07,0xff,0xf2,0x00,0x09,0xff,0xd0,0x00,0x0b,0xff,0xd8,0x81,0x0e,
+0xff,0xff,0xe1,0x0e,0xac,0x05,0xe1,0x05,0xfd,0x00,0x00,0x09,0xf4,0x00,0x00,0x0d,
+0xa0,0x00,0x00,0x0f,0x20,0xa5,0x03,0xf0,0x2b,0x01,0x79,0x11,0x00,0x0f,0xfc,0x9f,
+0xf4,0x00,0xff,0xfd,0xcc,0x30,0x0f,0xfa,0x79,0x93,0x40,0xff,0x8e,0xff,0x6f,0x5f,
+0xf8,0xef,0xf7,0x64,0xff,0x8e,0xff,0xff,0xcf,0xf8,0xef,0xff,0xfc,0x46,0x3e,0xff,
+0xff,0xc0,0x00,0xdf,0xff,0xfc,0x00,0x02,0x44,0x44,0x20,0x00,0x01,0x90,0x00,0x00,
+0x02,0xaf,0x81,0xa9,0x01,0xa0,0xd0,0x00,0x9f,0xff,0xff,0x50,0x0c,0xff,0xff,0xf8,
+0x97,0x02,0x51,0xa0,0x3f,0xff,0xff,0xfe,0xd8,0x03,0x00,0x03,0x09,0x51,0x20,0x00,
+0xbf,0x70,0x00,0x6e,0x02,0x00,0x2f,0x05,0x21,0x44,0x30,0xa0,0x00,0xf4,0x0f,0xf3,
+0xf4,0xa0,0xa0,0xb0,0xb0,0xf4,0xff,0xbe,0xae,0xae,0xaf,0xf4,0xff,0x3a,0x0a,0x0a,
+0x0f,0xf4,0xfb,0xea,0xaa,0xaa,0xea,0xf4,0xf7,0xb4,0x44,0x44,0xc4,0x06,0x06,0x00,
+0xda,0x0a,0x00,0x3c,0x00,0x10,0x3a,0xd5,0x01,0xb0,0x4b,0xff,0xff,0x70,0x00,0x5d,
+0xff,0xff,0xff,0x10,0x0c,0x5b,0x00,0x60,0x00,0x0a,0xee,0xef,0xff,0xf2,0x08,0x09,
+0x21,0xff,0xa0,0x06,0x00,0x10,0x30,0x06,0x00,0x01,0x3c,0x01,0x20,0x08,0xf4,0xd8,
+0x01,0x00,0x88,0x09,0xf0,0x01,0xef,0xff,0x5b,0x00,0xff,0xff,0x6f,0xb0,0xff,0xff,
+0x68,0x83,0xff,0xff,0xfd,0xd6,0x24,0x05,0x1e,0xff,0x04,0x00,0x02,0x95,0x03,0x02,
+0x2b,0x08,0xd0,0x05,0xbf,0xff,0xfd,0x81,0x00,0x2c,0xfe,0xa8,0x78,0xcf,0xf7,0x0d,
+0x19,0x00,0xf0,0x05,0x3c,0xf5,0x22,0x05,0xbe,0xfd,0x81,0x05,0x00,0x09,0xfe,0xa9,
+0xcf,0xe2,0x00,0x00,0x37,0x00,0x00,0x38,0x2e,0x00,0x11,0x8c,0x05,0x06,0x12,0x0f,
+0x3c,0x00,0x61,0x58,0x10,0x00,0x00,0xcf,0xff,0xcb,0x04,0xd0,0x75,0x55,0x55,0x55,
+0x5a,0xf2,0xf6,0xff,0xff,0xff,0xfd,0x4f,0x5f,0xa1,0x01,0x91,0xd1,0xf5,0xf5,0x77,
+0x77,0x77,0x76,0x8f,0x4f,0xfa,0x00,0x11,0xd0,0x06,0x01,0x17,0x41,0x2e,0x00,0x21,
+0x54,0x4a,0x2e,0x00,0x11,0x00,0x2e,0x00,0x21,0xf0,0x01,0x2e,0x00,0x1f,0x00,0x2e,
+0x00,0x05,0x21,0x54,0x44,0x2e,0x00,0x11,0x20,0x2e,0x00,0x21,0xf2,0x00,0x2e,0x00,
+0x1f,0x10,0x2e,0x00,0x05,0x21,0x54,0x44,0x2e,0x00,0x20,0x50,0x00,0x2e,0x00,0x21,
+0xf5,0x00,0x2e,0x00,0x2f,0x20,0x00,0x2e,0x00,0x02,0x40,0xfa,0x0f,0x74,0x44,0x2e,
+0x00,0x11,0xf4,0x87,0x04,0x30,0x5f,0x40,0x00,0x2e,0x00,0x01,0x0d,0x00,0x0a,0x2e,
+0x00,0x00,0x12,0x00,0x20,0x5b,0x10,0xa8,0x03,0x11,0xbd,0x1e,0x00,0xf1,0x0d,0xa1,
+0x03,0x00,0x00,0x0a,0xf7,0x39,0x00,0x00,0x07,0x60,0xff,0xea,0xbf,0xaa,0xaa,0xdf,
+0x45,0xa3,0x00,0x93,0x00,0x04,0x10,0x00,0x00,0x01,0xb8,0x8d,0x01,0x44,0x02,0x9f,
+0xb0,0x00,0x9b,0x05,0xf2,0x1c,0x6b,0xca,0x40,0x00,0x9f,0xf6,0xff,0x40,0x1f,0xff,
+0x26,0xfb,0x04,0xf6,0xb4,0x6b,0xf0,0x6f,0xf4,0x06,0xff,0x06,0xff,0x90,0xbf,0xf0,
+0x5f,0x95,0x34,0xcf,0x02,0xfb,0xf3,0x4d,0xc0,0x0c,0xff,0x3d,0xf7,0x00,0x1b,0xfe,
+0xf9,0x32,0x00,0x50,0x12,0x3b,0xca,0x22,0x1f,0xf8,0x02,0x50,0x36,0x66,0x66,0x66,
+0x16,0xf0,0x04,0x8a,0x6f,0x6f,0x6f,0x7f,0x26,0xf6,0xf6,0xf7,0x09,0x00,0xa0,0x24,
+0xff,0xff,0xff,0xf1,0x03,0x44,0x44,0x42,0x00,0x50,0x00,0x00,0x00,0x00,0x97,0x05,
+0x00,0xf0,0x03,0x9f,0xf8,0x00,0x00,0x00,0xa5,0xef,0xe0,0x00,0x00,0xbf,0xe5,0xd4,
+0x00,0x00,0xbf,0xff,0xe0,0x05,0x00,0x13,0xf4,0x05,0x00,0x10,0xaf,0x05,0x00,0x10,
+0x0d,0x05,0x00,0x11,0x00,0x05,0x00,0x30,0x02,0x20,0x00,0x01,0x00,0xfc,0x38,0x05,
+0x88,0x88,0x88,0x86,0x00,0x08,0xff,0xff,0xff,0xff,0xf6,0x08,0xff,0xf9,0x6f,0x69,
+0xff,0x88,0xff,0xff,0xc1,0x21,0xcf,0xf8,0xdf,0xff,0xff,0x50,0x5f,0xff,0x82,0xef,
+0xff,0x71,0x91,0x7f,0xf8,0x02,0xef,0xfe,0xdf,0xde,0xff,0x70,0x02,0xdf,0xff,0xff,
+0xff,0xe3,0x01,0xdf,0xff,0xe5,0x1d,0x6c,0x5a,0xab,0xdf,0x3b,0x18,0x8b,0xff,0xdf,
+0xde,0xeb,0xff,0xff,0xff,0xfb,0x04,0x00,0x53,0xbf,0xff,0xff,0xf6,0x00,0x01,0x00,
+0xd0,0x0a,0x00,0x08,0x10,0x00,0x07,0xf0,0x0b,0xf2,0x00,0x00,0x8f,0x0b,0x69,0x00,
+0xf0,0x03,0xf0,0x7f,0xfa,0x99,0x99,0x99,0x00,0x6f,0x20,0x00,0x00,0x00,0x00,0x30,
+0x00,0x00,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -2475,11 +2535,24 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 176, .range_length = 63475, .glyph_id_start = 115, .list_length = 704, .type = 3, .unicode_list = 6552, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[48158] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 6067, .size = 4060, .comp_size = 3643 },
+{ .bitmap_start = 4060, .comp_offset = 9710, .size = 4075, .comp_size = 3755 },
+{ .bitmap_start = 8135, .comp_offset = 13465, .size = 4092, .comp_size = 3772 },
+{ .bitmap_start = 12227, .comp_offset = 17237, .size = 4076, .comp_size = 3846 },
+{ .bitmap_start = 16303, .comp_offset = 21083, .size = 4066, .comp_size = 3841 },
+{ .bitmap_start = 20369, .comp_offset = 24924, .size = 4075, .comp_size = 3897 },
+{ .bitmap_start = 24444, .comp_offset = 28821, .size = 4095, .comp_size = 3911 },
+{ .bitmap_start = 28539, .comp_offset = 32732, .size = 4083, .comp_size = 3875 },
+{ .bitmap_start = 32622, .comp_offset = 36607, .size = 4038, .comp_size = 3594 },
+{ .bitmap_start = 36660, .comp_offset = 40201, .size = 196, .comp_size = 171 },
+};
+
+static uint8_t etxUncompBuf[11302] __SDRAMFONTS;
 
 const etxLz4Font lv_font_tw_XS = {
-.uncomp_size = 47894,
-.comp_size = 39409,
+.uncomp_size = 11038,
+.comp_size = 6067,
 .line_height = 13,
 .base_line = 3,
 .subpx = 0,
@@ -2492,12 +2565,13 @@ const etxLz4Font lv_font_tw_XS = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 36,
-.glyph_bitmap = 7960,
-.class_pair_values = 44816,
-.left_class_mapping = 46256,
-.right_class_mapping = 47075,
+.class_pair_values = 7960,
+.left_class_mapping = 9400,
+.right_class_mapping = 10219,
+.block_num = 10,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 48158,
+.lvglFontBufSize = 11302,
 };
@@ -246,7 +246,7 @@ static const uint8_t lz4FontData[] ={
 0x13,0x7b,0x08,0x00,0x13,0x99,0x08,0x00,0x50,0xb7,0x5e,0x00,0x0a,0x0b,0x00,0x0b,
 0x12,0x5e,0x58,0x00,0x13,0xff,0x08,0x00,0x22,0x1b,0x5f,0x30,0x06,0x22,0x44,0x5f,
 0x28,0x00,0x50,0x62,0x5f,0x00,0x06,0x07,0x80,0x13,0x50,0x5f,0x10,0x08,0x09,0x06,
-0x88,0x19,0xf0,0xff,0xff,0xff,0xff,0xff,0x88,0x72,0x1f,0xb5,0x21,0x51,0x2f,0x50,
+0x88,0x19,0xf8,0xff,0xff,0xff,0xff,0xff,0x75,0x72,0x1f,0xb5,0x21,0x51,0x2f,0x50,
 0x4d,0x5a,0x4d,0x5b,0x4d,0x5d,0x4d,0x76,0x4d,0x7d,0x4d,0x82,0x4d,0x89,0x4d,0x8b,
 0x4d,0x9b,0x4d,0xa8,0x4d,0xdc,0x4d,0xf4,0x4d,0xfb,0x4d,0xfe,0x4d,0x1b,0x4e,0x26,
 0x4e,0x35,0x4e,0x40,0x4e,0x46,0x4e,0x4b,0x4e,0x4d,0x4e,0x60,0x4e,0x7f,0x4e,0x98,
@@ -334,129 +334,168 @@ static const uint8_t lz4FontData[] ={
 0xef,0xcb,0xef,0xe3,0xef,0xe5,0xef,0x14,0xf0,0x15,0xf0,0x17,0xf0,0x19,0xf0,0x30,
 0xf0,0x37,0xf0,0x3a,0xf0,0x43,0xf0,0x6c,0xf0,0x74,0xf0,0xab,0xf0,0x3b,0xf1,0x90,
 0xf1,0x91,0xf1,0x92,0xf1,0x93,0xf1,0x94,0xf1,0xd7,0xf1,0xe3,0xf1,0x3d,0xf2,0x54,
-0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0x56,0x56,0x55,0x34,0x34,0x77,0x25,0x50,0x00,
-0x86,0x21,0xaa,0xc6,0x06,0x29,0x04,0xc8,0xc4,0x08,0x35,0x96,0x05,0xf0,0x37,0x1a,
-0x00,0x2b,0x5b,0x04,0x80,0x50,0x0a,0xb3,0x01,0x01,0xc0,0x66,0x1c,0x00,0x6c,0x20,
-0x00,0x10,0x00,0x67,0x70,0x20,0x36,0x47,0x00,0x00,0x58,0x82,0x02,0x68,0x17,0x03,
-0x07,0x84,0x0b,0xa6,0x00,0xb6,0x50,0x1a,0xb0,0x48,0x34,0xb6,0x39,0x8b,0x80,0x96,
-0x03,0x50,0x90,0x46,0x06,0x40,0x64,0x03,0x70,0x09,0x00,0x14,0x71,0x01,0x80,0x0a,
-0x00,0x82,0x09,0x20,0xa0,0x0e,0x1c,0xf0,0xff,0x0d,0x00,0x6d,0x92,0x37,0x80,0x00,
-0x00,0x01,0x80,0x00,0x1a,0x00,0x6a,0xda,0x20,0x1a,0x00,0x82,0x70,0x78,0x00,0x44,
-0x00,0x90,0x03,0x60,0x09,0x00,0x18,0x00,0x72,0x00,0x40,0x00,0x1a,0x97,0x07,0x30,
-0xb0,0x82,0x0b,0x07,0x40,0xb0,0x1a,0x97,0x00,0x18,0xb1,0x0b,0x00,0xb0,0x0b,0x00,
-0xb0,0x3a,0x98,0x04,0x10,0xb0,0x00,0x65,0x00,0x76,0x00,0x6c,0x88,0x10,0x3a,0x97,
-0x31,0x0b,0x04,0xc6,0x30,0x0b,0x3a,0x97,0x00,0x98,0x00,0x68,0x80,0x28,0x38,0x08,
-0x8a,0xc2,0x00,0x38,0x00,0x0d,0xaa,0x01,0xd9,0x60,0x01,0x0b,0x12,0x30,0x91,0x0a,
-0x98,0x00,0x06,0x82,0x03,0xb9,0x50,0x75,0x0b,0x06,0x50,0xa0,0x0a,0x97,0x00,0x69,
-0x9d,0x10,0x02,0x80,0x00,0x91,0x00,0x28,0x00,0x0a,0x10,0x00,0x1a,0x97,0x05,0x60,
-0xb0,0x1c,0xb7,0x07,0x30,0xb0,0x3a,0x99,0x00,0x3a,0x95,0x82,0x0b,0x19,0x8c,0x00,
-0x1b,0x07,0xa2,0x43,0x00,0x00,0x43,0x52,0x00,0x00,0x52,0x91,0x00,0x02,0x85,0x8a,
-0x10,0x07,0xa3,0x00,0x01,0x39,0x97,0x00,0x00,0x39,0x97,0x58,0x20,0x01,0x8a,0x3a,
-0x71,0x10,0x00,0x5a,0xb2,0x20,0x56,0x02,0x90,0x04,0x10,0x06,0x10,0x03,0x87,0x87,
-0x01,0x80,0x77,0x26,0x62,0x81,0x90,0x88,0x0a,0x09,0x08,0x36,0x87,0xa7,0x40,0x67,
-0x75,0x00,0x00,0xe2,0x00,0x05,0x79,0x00,0x0b,0x0a,0x10,0x3c,0x9b,0x70,0xa1,0x00,
-0xb0,0x5b,0x9a,0x15,0x60,0x74,0x5b,0x9c,0x15,0x60,0x47,0x5b,0x9b,0x20,0x09,0x9a,
-0x46,0x60,0x07,0x83,0x00,0x06,0x60,0x07,0x09,0x9a,0x30,0x5b,0x99,0x15,0x60,0x29,
-0x56,0x00,0xc5,0x60,0x39,0x5b,0x9a,0x10,0x5b,0x99,0x25,0x60,0x00,0x5b,0x97,0x05,
-0x60,0x00,0x5b,0x99,0x20,0x1a,0x00,0x02,0x0d,0x00,0xf2,0x0a,0x56,0x00,0x00,0x09,
-0x9a,0x55,0x60,0x04,0x83,0x19,0xa5,0x70,0x0c,0x08,0x99,0x70,0x56,0x00,0xb0,0x56,
-0x00,0xb0,0x5b,0x99,0xe0,0x09,0x00,0x10,0x47,0x01,0x00,0x20,0x00,0x0c,0x02,0x00,
-0xf1,0x06,0x50,0x0b,0x5a,0xa5,0x56,0x08,0x50,0x56,0x95,0x00,0x5d,0xc0,0x00,0x57,
-0x3a,0x00,0x56,0x04,0x90,0x56,0x00,0x42,0x00,0x01,0x54,0x00,0xf0,0x1f,0x00,0x5d,
-0x00,0x0d,0x55,0xc4,0x05,0xc5,0x56,0xa0,0xb6,0x55,0x67,0x77,0x65,0x56,0x1e,0x16,
-0x50,0x5c,0x00,0xb0,0x5b,0x80,0xb0,0x56,0x94,0xb0,0x56,0x0b,0xc0,0x56,0x02,0xf0,
-0x09,0x9a,0x30,0x66,0x00,0xc0,0x83,0x00,0xb0,0x66,0x00,0xc0,0x9e,0x00,0x73,0x9a,
-0x45,0x60,0x1b,0x5b,0x89,0x35,0x84,0x00,0xf1,0x23,0x30,0x65,0x00,0xc0,0x92,0x00,
-0xc0,0x65,0x00,0xc0,0x09,0x9c,0x40,0x00,0x02,0x80,0x5b,0x9a,0x25,0x60,0x47,0x5b,
-0xab,0x15,0x60,0xb0,0x56,0x04,0x70,0x2a,0x89,0x16,0x60,0x22,0x06,0x97,0x05,0x10,
-0x65,0x3a,0x9a,0x20,0x79,0xe9,0x50,0x0c,0x00,0x00,0xc0,0x00,0x05,0x00,0xf2,0x31,
-0x74,0x01,0xa7,0x40,0x1a,0x74,0x01,0xa6,0x50,0x2a,0x1a,0x9a,0x20,0xa1,0x00,0xb4,
-0x70,0x65,0x0a,0x0a,0x00,0x65,0x80,0x00,0xe1,0x00,0xa1,0x0d,0x10,0xb5,0x63,0xb6,
-0x38,0x1a,0x82,0xa7,0x30,0xba,0x09,0xb0,0x08,0x70,0x4a,0x00,0x67,0x07,0x60,0x95,
-0xa0,0x02,0xf2,0x00,0xa6,0xa0,0x67,0x07,0x70,0x93,0x06,0x61,0xa0,0xb0,0x06,0xb2,
-0x46,0x00,0xf2,0x02,0x59,0x9e,0x40,0x04,0x80,0x02,0xa0,0x00,0xb1,0x00,0x9b,0x99,
-0x40,0x59,0x06,0x40,0x64,0x03,0x00,0xf1,0x01,0x05,0x90,0x91,0x00,0x37,0x00,0x0a,
-0x00,0x05,0x50,0x00,0xa0,0x00,0x40,0x86,0x38,0x01,0x00,0xf0,0x33,0x96,0x05,0x00,
-0x1b,0x60,0x82,0xa0,0x88,0x85,0x47,0x39,0x96,0x18,0x7b,0x83,0x0b,0x4b,0x9b,0x74,
-0x00,0x07,0xa9,0x80,0x74,0x0a,0x07,0x40,0xa0,0x7a,0x98,0x00,0x19,0x97,0x82,0x04,
-0x92,0x03,0x2a,0x96,0x00,0x0b,0x2b,0x8d,0x83,0x0b,0x82,0x0b,0x2a,0x8d,0x19,0x97,
-0x89,0x8a,0x94,0x00,0x2b,0x87,0x08,0x71,0xa0,0x7d,0x41,0xa0,0x1a,0x01,0xa0,0x19,
-0x00,0xc0,0x83,0x0b,0x2b,0x9d,0x18,0x97,0x74,0x00,0x7a,0xa8,0x74,0x0b,0x02,0x00,
-0x71,0x43,0x65,0x65,0x65,0x65,0x04,0x20,0x79,0x00,0xf0,0x01,0x42,0xb2,0x74,0x00,
-0x07,0x48,0x60,0x7b,0x70,0x07,0x8b,0x00,0x74,0x39,0x00,0x65,0x01,0x00,0xe4,0x7a,
-0xaa,0x9b,0x37,0x40,0xc0,0x47,0x74,0x0b,0x04,0x77,0x40,0xb0,0x47,0x36,0x00,0xf0,
-0x02,0x19,0x98,0x08,0x20,0x91,0x82,0x09,0x11,0xa8,0x70,0x7a,0x88,0x07,0x40,0xa0,
-0x74,0x0b,0x89,0x00,0x24,0x00,0x00,0x7a,0x00,0xf2,0x0b,0x00,0x0b,0x00,0x07,0xb5,
-0x74,0x07,0x40,0x74,0x00,0x3a,0xa5,0x49,0x32,0x22,0x68,0x3a,0x96,0x38,0x09,0xc2,
-0x38,0x02,0x80,0x0c,0x30,0x3f,0x00,0xf0,0x28,0x2b,0x9c,0xa1,0x38,0x46,0x82,0x0a,
-0xa0,0x08,0x60,0xa0,0x77,0x0a,0x64,0x99,0x45,0x1b,0x77,0xa1,0x0c,0x22,0xb0,0x75,
-0x66,0x0a,0xa0,0x0a,0xa0,0x75,0x57,0xa1,0x37,0x46,0x81,0x09,0x80,0x08,0x30,0x69,
-0x00,0x59,0xc7,0x02,0xb0,0x0b,0x10,0x8b,0x86,0x00,0x00,0x75,0x0b,0x00,0xb0,0x96,
-0x27,0x03,0x40,0x75,0x00,0x00,0x54,0x01,0x00,0x00,0x27,0x18,0xf2,0x1d,0x30,0x29,
-0x01,0xa0,0x0a,0x40,0xa0,0x29,0x08,0x30,0x00,0x00,0x19,0x70,0x74,0x23,0x95,0x00,
-0x00,0x20,0x00,0x00,0x00,0xc9,0x00,0x1b,0xaa,0xa5,0x90,0x18,0x00,0x00,0x86,0x1d,
-0xaa,0x93,0xa0,0x00,0x00,0xba,0x00,0x00,0x00,0x40,0x06,0x23,0xf0,0x24,0x4f,0x00,
-0x00,0x04,0x98,0xaa,0xa6,0x0c,0x00,0x00,0x18,0x05,0x76,0xaa,0xb8,0x00,0x6e,0x00,
-0x00,0x00,0x04,0x00,0x00,0x00,0x07,0x20,0x00,0x08,0x7b,0x10,0x08,0x60,0x1b,0x11,
-0xad,0x08,0xb5,0x00,0xa0,0x91,0x00,0x0a,0x09,0x10,0x00,0xaa,0xd1,0x00,0x00,0x6a,
-0xa0,0x0b,0x00,0x00,0x12,0x00,0xd2,0x8d,0x08,0x94,0x0a,0x60,0x1c,0x20,0x0b,0x3a,
-0x30,0x00,0x0c,0x50,0x51,0x23,0xf1,0x20,0x06,0x60,0x00,0x00,0x0d,0xd0,0x00,0x00,
-0x77,0x87,0x00,0x00,0xd0,0x0d,0x00,0x08,0x60,0x06,0x80,0x1f,0xee,0xee,0xf1,0x00,
-0x02,0xa4,0x00,0x79,0xc1,0xc0,0x77,0x0f,0xd9,0x0b,0x02,0xf6,0xa0,0xb0,0x32,0x0b,
-0x08,0x50,0x05,0x90,0x08,0xbb,0x80,0x34,0x00,0xf1,0x40,0x13,0x32,0x00,0x02,0x6c,
-0xf6,0x60,0x09,0x52,0x71,0xa2,0x1b,0x00,0x00,0x66,0x0b,0x00,0x00,0x65,0x07,0x70,
-0x02,0xb0,0x00,0x8a,0xaa,0x20,0x00,0x02,0x10,0x00,0x00,0x30,0x00,0x00,0x0a,0xbd,
-0xab,0x40,0x1c,0x28,0x70,0x93,0x0c,0xbb,0x30,0x19,0x0b,0x01,0x00,0x19,0x07,0x60,
-0x00,0xa3,0x00,0x6b,0xba,0x30,0x06,0xcc,0xc8,0x0c,0x30,0x65,0x0d,0x01,0xb0,0x3e,
-0x3a,0x00,0xb8,0x7c,0x00,0xb2,0x1b,0x00,0x4b,0xb5,0x54,0x00,0xf1,0x71,0x99,0x10,
-0x57,0xdd,0x85,0x71,0x55,0x17,0x71,0x66,0x17,0x72,0xbb,0x37,0x70,0x00,0x07,0x47,
-0xff,0x84,0x00,0x66,0x10,0x00,0x01,0x30,0x06,0x08,0xdb,0xc0,0x99,0xc0,0x00,0x07,
-0x05,0x80,0x00,0x71,0x81,0x00,0x0b,0xab,0x00,0x00,0x30,0x7e,0xdc,0x00,0x00,0x01,
-0x00,0x68,0x86,0x66,0x77,0x53,0x9a,0x77,0x78,0xec,0x73,0x30,0x06,0x79,0x80,0x06,
-0x76,0x60,0x06,0x9c,0xc7,0x79,0x00,0x28,0x96,0x00,0x04,0xa9,0x85,0xb0,0x0c,0x07,
-0x80,0x66,0x19,0x05,0x63,0x19,0x0b,0x8b,0x5a,0x88,0x07,0xb2,0x03,0xd2,0x00,0x6b,
-0xba,0x20,0x02,0x97,0x00,0x00,0x0a,0x14,0x73,0x30,0x0b,0x02,0xbf,0xf4,0x04,0xde,
-0x9f,0xf5,0x08,0x5a,0xff,0xe0,0x0a,0x5f,0xff,0xf5,0x0d,0xcb,0xbb,0xb4,0x43,0x01,
-0xf0,0x02,0x03,0x90,0x00,0x16,0x65,0x9a,0x00,0x1a,0xaa,0xaa,0x60,0x05,0xfe,0xef,
-0xf2,0x00,0x49,0x14,0x00,0x12,0x70,0x29,0x01,0xf0,0x0b,0x04,0x72,0x00,0x00,0x04,
-0x77,0x80,0x00,0x04,0x66,0x20,0x00,0x54,0x93,0x00,0x0c,0x47,0x4b,0x00,0x1f,0x3d,
-0x3e,0x00,0x03,0x85,0x93,0xd8,0x00,0x92,0xa0,0x07,0xc3,0xa0,0x08,0x5a,0xa0,0x00,
-0x0a,0x03,0x00,0xf1,0x2b,0xaa,0xaa,0xa9,0x00,0x46,0x10,0x00,0x05,0x40,0x87,0x20,
-0x08,0x00,0x01,0x80,0x35,0x6a,0xb5,0x70,0x60,0x37,0x40,0x62,0x34,0x0b,0x90,0x24,
-0x06,0x77,0x77,0x70,0x00,0x00,0x0a,0x00,0x00,0x00,0x1d,0x81,0x02,0xb9,0xb7,0x80,
-0x09,0x10,0xb5,0x80,0x0a,0x00,0x2d,0x00,0x09,0x00,0x1c,0x00,0x27,0x00,0x1c,0x6c,
-0x00,0xf1,0x0a,0x37,0x33,0x73,0x27,0x05,0xe0,0x10,0x00,0x29,0x82,0x01,0x8b,0x38,
-0x20,0x39,0x98,0x44,0x00,0xa4,0x00,0x20,0x4a,0xaa,0xaa,0xa8,0x38,0x00,0x05,0x04,
-0x00,0x24,0x99,0x90,0x0c,0x00,0x61,0x79,0x9d,0x99,0x93,0x00,0x00,0x08,0x00,0x30,
-0x92,0x00,0x09,0x14,0x00,0xa0,0xa3,0x00,0x00,0x09,0x08,0x70,0x00,0x09,0x00,0x10,
-0x10,0x00,0x00,0x04,0x00,0xf2,0x07,0x19,0x99,0xe9,0x96,0x00,0x05,0x90,0x00,0x00,
-0x3b,0x9a,0x10,0x06,0xa2,0x81,0xb2,0x26,0x01,0x80,0x05,0x00,0x01,0xe5,0x05,0x20,
-0x03,0x10,0x0b,0x00,0xf1,0x07,0x18,0x00,0x59,0xba,0xd9,0x91,0x05,0x53,0x90,0x70,
-0x09,0x53,0x94,0x50,0x05,0x63,0x96,0x00,0x68,0xba,0xd8,0x82,0x92,0x00,0x00,0x44,
-0x00,0xf1,0x01,0xa0,0x00,0xc8,0x8d,0x88,0x99,0x00,0x90,0x09,0xd9,0x9d,0x99,0x96,
-0x00,0x90,0x06,0x15,0x00,0x10,0x90,0x1c,0x00,0xf2,0x26,0x08,0x88,0xd8,0xa0,0xa1,
-0x1a,0x1a,0x04,0x66,0xc6,0x60,0xc8,0x8d,0x8a,0x49,0x00,0xa0,0x54,0x98,0x8d,0x88,
-0x30,0x00,0x90,0x00,0x02,0xb8,0x88,0xa0,0x02,0x66,0x50,0x90,0x02,0x60,0x50,0x90,
-0x3b,0xb9,0x99,0xd7,0x06,0x20,0x00,0x90,0x0a,0x00,0x00,0x90,0x44,0x00,0x38,0x80,
-0x56,0x01,0x00,0xdb,0x25,0x60,0xa0,0x00,0x08,0x9a,0xc9,0x93,0x88,0x00,0x44,0x05,
-0x99,0xc9,0x90,0x94,0x00,0x42,0x29,0x9a,0xc9,0x97,0x20,0x00,0x60,0x70,0x00,0x19,
-0x99,0x9b,0xa0,0xdf,0x06,0x40,0x00,0x01,0xa1,0x00,0x96,0x01,0xfb,0x1e,0x19,0xc2,
-0x00,0x01,0x41,0x17,0x99,0x84,0x00,0x01,0x35,0x20,0x07,0x7a,0x73,0x00,0x57,0x9b,
-0x99,0x71,0x17,0xa6,0x2c,0x70,0x25,0xa8,0x58,0x21,0x33,0xac,0xb9,0x70,0x19,0x76,
-0x39,0x60,0x63,0x06,0x20,0x63,0x06,0xaa,0xaa,0xa0,0x00,0x01,0x00,0xf0,0x15,0x3a,
-0xaa,0xaa,0xa7,0x00,0x06,0x00,0x00,0x69,0x9c,0xa9,0x91,0x01,0x60,0x07,0x00,0x39,
-0x30,0x16,0xa0,0x10,0x73,0x92,0x10,0x00,0x0b,0x70,0x00,0x04,0xa5,0x88,0x30,0x54,
-0x00,0x01,0x62,0x20,0x00,0xf0,0x0b,0x58,0x88,0x88,0x81,0x09,0x66,0x69,0x40,0x06,
-0x66,0x67,0x20,0x07,0x77,0xba,0x20,0x68,0x8c,0xa8,0x82,0x00,0x08,0x10,0x00,0x00,
-0x6b,0xb8,0x00,0xf1,0x0f,0x20,0x00,0x57,0x78,0x87,0x72,0x07,0x86,0x69,0x30,0x03,
-0x76,0x67,0x20,0x88,0x77,0x77,0xb1,0x30,0x87,0x95,0x20,0x00,0x90,0x26,0x21,0x49,
-0x20,0x1b,0xa1,0x69,0x00,0xf0,0x04,0x01,0x10,0x00,0x00,0x0a,0x90,0x00,0x02,0xa2,
-0x2a,0x20,0x69,0x30,0x03,0x96,0x00,0x90,0x09,0x00,0x04,0x00,0x00,0x6d,0x07,0x10,
-0x29,0x3c,0x01,0xf0,0x0a,0x60,0x09,0x00,0x07,0x44,0x09,0x00,0x1d,0x09,0x1c,0x97,
-0x9b,0x4d,0x79,0x08,0x09,0x19,0x09,0x27,0x09,0x09,0x05,0x84,0x09,0x09,0xdd,0x0d,
-0x30,0x88,0x97,0x00,0xd4,0x03,0xf1,0x0c,0x05,0x00,0x90,0x0a,0x07,0x40,0x80,0x0a,
-0x00,0x43,0x60,0x0a,0x00,0x07,0x20,0x0a,0x38,0x0c,0x00,0x0d,0x61,0x95,0xa0,0x00,
-0x0a,0x30,0x26,0x16,0x27,0xf0,0x01,0x31,0x50,0x00,0x08,0x58,0x1b,0x87,0x2d,0x34,
+0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0x00,0x01,0x00,0x2f,0xfe,0x00,0x01,0x00,0x03,
+0x1b,0xf9,0x08,0x00,0x00,0x01,0x00,0xce,0xfd,0xfc,0x00,0xff,0xfc,0x00,0xfb,0x00,
+0x00,0x00,0x01,0x00,0x01,0x00,0x2f,0x01,0x01,0x17,0x00,0x01,0x2f,0xf5,0x00,0x01,
+0x00,0x15,0x1e,0xf2,0x1e,0x00,0x0e,0x90,0x00,0xb1,0xfc,0x00,0xff,0x00,0x00,0xf8,
+0xff,0xfb,0xfc,0x00,0xfa,0x11,0x00,0x00,0x0f,0x00,0x4d,0xff,0xff,0xfd,0xfe,0x7b,
+0x00,0x10,0xfe,0x1a,0x00,0x1f,0xfd,0x4a,0x00,0x01,0x1c,0xfe,0x0a,0x00,0x19,0xff,
+0x1f,0x00,0x03,0x0e,0x00,0x13,0xfa,0x0b,0x00,0x00,0x48,0x00,0x2a,0xff,0xfd,0x23,
+0x00,0x0d,0xfa,0x00,0x05,0x3c,0x00,0x11,0xff,0x34,0x00,0x26,0xff,0xfe,0x30,0x00,
+0x11,0xf1,0x04,0x01,0x15,0xf0,0x24,0x00,0x20,0xfe,0xff,0x20,0x00,0x01,0x2b,0x00,
+0x0d,0x44,0x00,0x10,0xfe,0x08,0x00,0x0e,0x91,0x01,0x0c,0x9b,0x00,0x0f,0x01,0x00,
+0x07,0x1b,0xfc,0xd1,0x01,0x10,0xfe,0x6b,0x00,0x00,0x70,0x00,0x11,0xfc,0x0f,0x00,
+0x14,0xeb,0x6c,0x00,0x97,0xfc,0x00,0x00,0xef,0xfd,0xf5,0xf7,0x00,0xf1,0xdc,0x01,
+0x25,0xf8,0xfa,0x0c,0x00,0x73,0xec,0x00,0x00,0x00,0xf7,0x00,0xf4,0x43,0x00,0x10,
+0xfe,0xac,0x00,0x00,0x7c,0x00,0x0f,0xe0,0x01,0x02,0x10,0xfd,0xd2,0x00,0x1f,0xfe,
+0x97,0x00,0x0b,0x1e,0xfb,0x8c,0x01,0x05,0x7f,0x01,0x93,0xf2,0xf2,0x00,0x00,0xfb,
+0xfe,0xf1,0xff,0x01,0x40,0x02,0xd3,0xf9,0xfa,0x00,0xf9,0xfa,0xfb,0xf9,0x00,0xfa,
+0xfc,0xfc,0xfb,0xfc,0x1a,0x01,0x66,0xf2,0xfe,0x00,0x00,0xfb,0xff,0x2b,0x01,0x62,
+0xfd,0xfd,0x00,0x00,0xfd,0xfe,0x4c,0x01,0x22,0x00,0x01,0x24,0x00,0x22,0xf8,0xfc,
+0x63,0x00,0x13,0x01,0x24,0x00,0x23,0xfe,0xfe,0x6c,0x01,0x08,0xa1,0x01,0x14,0xfd,
+0x76,0x00,0x15,0x01,0x82,0x00,0x02,0xb0,0x01,0x04,0x92,0x00,0xe0,0x01,0xfd,0xf3,
+0xfd,0x00,0x00,0xfa,0xfe,0xfa,0xff,0x01,0xfa,0x01,0x01,0x92,0x00,0x70,0xfb,0xfc,
+0xff,0xfe,0xfc,0xfe,0xfc,0xd3,0x01,0x36,0xff,0xfe,0x01,0xc5,0x00,0x09,0xa8,0x01,
+0x14,0xff,0x48,0x00,0x1e,0xfe,0xb2,0x01,0x1f,0xff,0xab,0x01,0x07,0x0f,0xe9,0x01,
+0x0d,0x1f,0xfe,0x24,0x00,0x0b,0x2e,0xff,0xff,0x14,0x02,0x0f,0x38,0x02,0x1f,0x14,
+0xff,0x80,0x02,0x1e,0x01,0xd7,0x02,0x1a,0xff,0xa1,0x02,0x2f,0xfa,0x00,0x01,0x00,
+0x24,0x0b,0x81,0x00,0x1f,0xf8,0xd8,0x00,0x10,0x1d,0x01,0x28,0x00,0x00,0xd0,0x01,
+0x01,0x93,0x00,0x10,0x03,0x2b,0x02,0x0f,0x6f,0x00,0x15,0x1b,0x01,0xc4,0x04,0x02,
+0xa7,0x03,0x1d,0x01,0x14,0x01,0x1f,0xf8,0xd8,0x00,0x24,0x1f,0xff,0x24,0x00,0x26,
+0x0f,0x3d,0x00,0x07,0x12,0x01,0xb0,0x24,0x9c,0x02,0x03,0x00,0x00,0x00,0x04,0x00,
+0x04,0x05,0x21,0x00,0x00,0x4f,0x0b,0xf1,0x09,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,
+0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,
+0x19,0x20,0x00,0xff,0x0d,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,
+0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,
+0x00,0x01,0x00,0xff,0xff,0xc5,0x02,0x33,0x03,0x20,0x03,0x02,0x2e,0x03,0x4b,0x06,
+0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,
+0x0c,0x00,0x08,0x00,0xa0,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x01,
+0x28,0x91,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,
+0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,
+0x73,0x00,0x02,0x1f,0x24,0x2d,0x03,0xff,0xff,0xa8,0x50,0x00,0x00,0x00,0x00,0x00,
+0xf0,0xff,0x6f,0x56,0x56,0x55,0x34,0x34,0x77,0x25,0x50,0x00,0x86,0x21,0xaa,0xc6,
+0x06,0x29,0x04,0xc8,0xc4,0x08,0x35,0x00,0x00,0x00,0x00,0x1a,0x00,0x2b,0x5b,0x04,
+0x80,0x50,0x0a,0xb3,0x01,0x01,0xc0,0x66,0x1c,0x00,0x6c,0x20,0x00,0x10,0x00,0x67,
+0x70,0x20,0x36,0x47,0x00,0x00,0x58,0x82,0x02,0x68,0x17,0x03,0x07,0x84,0x0b,0xa6,
+0x00,0xb6,0x50,0x1a,0xb0,0x48,0x34,0xb6,0x39,0x8b,0x80,0x96,0x03,0x50,0x90,0x46,
+0x06,0x40,0x64,0x03,0x70,0x09,0x00,0x14,0x71,0x01,0x80,0x0a,0x00,0x82,0x09,0x20,
+0xa0,0x37,0x05,0x00,0x08,0x00,0x6d,0x92,0x37,0x80,0x00,0x00,0x01,0x80,0x00,0x1a,
+0x00,0x6a,0xda,0x20,0x1a,0x00,0x82,0x70,0x78,0x00,0x44,0x00,0x90,0x03,0x60,0x09,
+0x00,0x18,0x00,0x72,0x00,0x40,0x00,0x1a,0x97,0x07,0x30,0xb0,0x82,0x0b,0x07,0x40,
+0xb0,0x1a,0x97,0x00,0x18,0xb1,0x0b,0x00,0xb0,0x0b,0x00,0xb0,0x3a,0x98,0x04,0x10,
+0xb0,0x00,0x65,0x00,0x76,0x00,0x6c,0x88,0x10,0x3a,0x97,0x31,0x0b,0x04,0xc6,0x30,
+0x0b,0x3a,0x97,0x00,0x98,0x00,0x68,0x80,0x28,0x38,0x08,0x8a,0xc2,0x00,0x38,0x00,
+0x0d,0xaa,0x01,0xd9,0x60,0x01,0x0b,0x12,0x30,0x91,0x0a,0x98,0x00,0x06,0x82,0x03,
+0xb9,0x50,0x75,0x0b,0x06,0x50,0xa0,0x0a,0x97,0x00,0x69,0x9d,0x10,0x02,0x80,0x00,
+0x91,0x00,0x28,0x00,0x0a,0x10,0x00,0x1a,0x97,0x05,0x60,0xb0,0x1c,0xb7,0x07,0x30,
+0xb0,0x3a,0x99,0x00,0x3a,0x95,0x82,0x0b,0x19,0x8c,0x00,0x1b,0x07,0xa2,0x43,0x00,
+0x00,0x43,0x52,0x00,0x00,0x52,0x91,0x00,0x02,0x85,0x8a,0x10,0x07,0xa3,0x00,0x01,
+0x39,0x97,0x00,0x00,0x39,0x97,0x58,0x20,0x01,0x8a,0x3a,0x71,0x10,0x00,0x5a,0xb2,
+0x20,0x56,0x02,0x90,0x04,0x10,0x06,0x10,0x03,0x87,0x87,0x01,0x80,0x77,0x26,0x62,
+0x81,0x90,0x88,0x0a,0x09,0x08,0x36,0x87,0xa7,0x40,0x67,0x75,0x00,0x00,0xe2,0x00,
+0x05,0x79,0x00,0x0b,0x0a,0x10,0x3c,0x9b,0x70,0xa1,0x00,0xb0,0x5b,0x9a,0x15,0x60,
+0x74,0x5b,0x9c,0x15,0x60,0x47,0x5b,0x9b,0x20,0x09,0x9a,0x46,0x60,0x07,0x83,0x00,
+0x06,0x60,0x07,0x09,0x9a,0x30,0x5b,0x99,0x15,0x60,0x29,0x56,0x00,0xc5,0x60,0x39,
+0x5b,0x9a,0x10,0x5b,0x99,0x25,0x60,0x00,0x5b,0x97,0x05,0x60,0x00,0x5b,0x99,0x20,
+0x1a,0x00,0x02,0x0d,0x00,0xf2,0x0a,0x56,0x00,0x00,0x09,0x9a,0x55,0x60,0x04,0x83,
+0x19,0xa5,0x70,0x0c,0x08,0x99,0x70,0x56,0x00,0xb0,0x56,0x00,0xb0,0x5b,0x99,0xe0,
+0x09,0x00,0x10,0x47,0x01,0x00,0x20,0x00,0x0c,0x02,0x00,0xf1,0x06,0x50,0x0b,0x5a,
+0xa5,0x56,0x08,0x50,0x56,0x95,0x00,0x5d,0xc0,0x00,0x57,0x3a,0x00,0x56,0x04,0x90,
+0x56,0x00,0x42,0x00,0x01,0x54,0x00,0xf0,0x1f,0x00,0x5d,0x00,0x0d,0x55,0xc4,0x05,
+0xc5,0x56,0xa0,0xb6,0x55,0x67,0x77,0x65,0x56,0x1e,0x16,0x50,0x5c,0x00,0xb0,0x5b,
+0x80,0xb0,0x56,0x94,0xb0,0x56,0x0b,0xc0,0x56,0x02,0xf0,0x09,0x9a,0x30,0x66,0x00,
+0xc0,0x83,0x00,0xb0,0x66,0x00,0xc0,0x9e,0x00,0x73,0x9a,0x45,0x60,0x1b,0x5b,0x89,
+0x35,0x84,0x00,0xf1,0x23,0x30,0x65,0x00,0xc0,0x92,0x00,0xc0,0x65,0x00,0xc0,0x09,
+0x9c,0x40,0x00,0x02,0x80,0x5b,0x9a,0x25,0x60,0x47,0x5b,0xab,0x15,0x60,0xb0,0x56,
+0x04,0x70,0x2a,0x89,0x16,0x60,0x22,0x06,0x97,0x05,0x10,0x65,0x3a,0x9a,0x20,0x79,
+0xe9,0x50,0x0c,0x00,0x00,0xc0,0x00,0x05,0x00,0xf2,0x31,0x74,0x01,0xa7,0x40,0x1a,
+0x74,0x01,0xa6,0x50,0x2a,0x1a,0x9a,0x20,0xa1,0x00,0xb4,0x70,0x65,0x0a,0x0a,0x00,
+0x65,0x80,0x00,0xe1,0x00,0xa1,0x0d,0x10,0xb5,0x63,0xb6,0x38,0x1a,0x82,0xa7,0x30,
+0xba,0x09,0xb0,0x08,0x70,0x4a,0x00,0x67,0x07,0x60,0x95,0xa0,0x02,0xf2,0x00,0xa6,
+0xa0,0x67,0x07,0x70,0x93,0x06,0x61,0xa0,0xb0,0x06,0xb2,0x46,0x00,0xf2,0x02,0x59,
+0x9e,0x40,0x04,0x80,0x02,0xa0,0x00,0xb1,0x00,0x9b,0x99,0x40,0x59,0x06,0x40,0x64,
+0x03,0x00,0xf1,0x01,0x05,0x90,0x91,0x00,0x37,0x00,0x0a,0x00,0x05,0x50,0x00,0xa0,
+0x00,0x40,0x86,0x38,0x01,0x00,0xf0,0x33,0x96,0x05,0x00,0x1b,0x60,0x82,0xa0,0x88,
+0x85,0x47,0x39,0x96,0x18,0x7b,0x83,0x0b,0x4b,0x9b,0x74,0x00,0x07,0xa9,0x80,0x74,
+0x0a,0x07,0x40,0xa0,0x7a,0x98,0x00,0x19,0x97,0x82,0x04,0x92,0x03,0x2a,0x96,0x00,
+0x0b,0x2b,0x8d,0x83,0x0b,0x82,0x0b,0x2a,0x8d,0x19,0x97,0x89,0x8a,0x94,0x00,0x2b,
+0x87,0x08,0x71,0xa0,0x7d,0x41,0xa0,0x1a,0x01,0xa0,0x19,0x00,0xc0,0x83,0x0b,0x2b,
+0x9d,0x18,0x97,0x74,0x00,0x7a,0xa8,0x74,0x0b,0x02,0x00,0x71,0x43,0x65,0x65,0x65,
+0x65,0x04,0x20,0x79,0x00,0xf0,0x01,0x42,0xb2,0x74,0x00,0x07,0x48,0x60,0x7b,0x70,
+0x07,0x8b,0x00,0x74,0x39,0x00,0x65,0x01,0x00,0xe4,0x7a,0xaa,0x9b,0x37,0x40,0xc0,
+0x47,0x74,0x0b,0x04,0x77,0x40,0xb0,0x47,0x36,0x00,0xf0,0x02,0x19,0x98,0x08,0x20,
+0x91,0x82,0x09,0x11,0xa8,0x70,0x7a,0x88,0x07,0x40,0xa0,0x74,0x0b,0x89,0x00,0x24,
+0x00,0x00,0x7a,0x00,0xf2,0x0b,0x00,0x0b,0x00,0x07,0xb5,0x74,0x07,0x40,0x74,0x00,
+0x3a,0xa5,0x49,0x32,0x22,0x68,0x3a,0x96,0x38,0x09,0xc2,0x38,0x02,0x80,0x0c,0x30,
+0x3f,0x00,0xf0,0x28,0x2b,0x9c,0xa1,0x38,0x46,0x82,0x0a,0xa0,0x08,0x60,0xa0,0x77,
+0x0a,0x64,0x99,0x45,0x1b,0x77,0xa1,0x0c,0x22,0xb0,0x75,0x66,0x0a,0xa0,0x0a,0xa0,
+0x75,0x57,0xa1,0x37,0x46,0x81,0x09,0x80,0x08,0x30,0x69,0x00,0x59,0xc7,0x02,0xb0,
+0x0b,0x10,0x8b,0x86,0x00,0x00,0x75,0x0b,0x00,0xb0,0x96,0x27,0x03,0x41,0x75,0x00,
+0x00,0x54,0x01,0x00,0xf0,0x59,0x22,0x00,0x08,0x30,0x29,0x01,0xa0,0x0a,0x40,0xa0,
+0x29,0x08,0x30,0x00,0x00,0x19,0x70,0x74,0x23,0x95,0x00,0x00,0x20,0x00,0x00,0x00,
+0xc9,0x00,0x1b,0xaa,0xa5,0x90,0x18,0x00,0x00,0x86,0x1d,0xaa,0x93,0xa0,0x00,0x00,
+0xba,0x00,0x00,0x00,0x40,0x00,0x00,0x02,0x00,0x00,0x00,0x4f,0x00,0x00,0x04,0x98,
+0xaa,0xa6,0x0c,0x00,0x00,0x18,0x05,0x76,0xaa,0xb8,0x00,0x6e,0x00,0x00,0x00,0x04,
+0x00,0x00,0x00,0x07,0x20,0x00,0x08,0x7b,0x10,0x08,0x60,0x1b,0x11,0xad,0x08,0xb5,
+0x00,0xa0,0x91,0x00,0x0a,0x09,0x10,0x00,0xaa,0xd1,0x00,0x00,0x6a,0xa0,0x0b,0x00,
+0x00,0x12,0x00,0xe1,0x8d,0x08,0x94,0x0a,0x60,0x1c,0x20,0x0b,0x3a,0x30,0x00,0x0c,
+0x50,0x00,0x01,0x00,0xf1,0x20,0x06,0x60,0x00,0x00,0x0d,0xd0,0x00,0x00,0x77,0x87,
+0x00,0x00,0xd0,0x0d,0x00,0x08,0x60,0x06,0x80,0x1f,0xee,0xee,0xf1,0x00,0x02,0xa4,
+0x00,0x79,0xc1,0xc0,0x77,0x0f,0xd9,0x0b,0x02,0xf6,0xa0,0xb0,0x32,0x0b,0x08,0x50,
+0x05,0x90,0x08,0xbb,0x80,0x34,0x00,0xf1,0x40,0x13,0x32,0x00,0x02,0x6c,0xf6,0x60,
+0x09,0x52,0x71,0xa2,0x1b,0x00,0x00,0x66,0x0b,0x00,0x00,0x65,0x07,0x70,0x02,0xb0,
+0x00,0x8a,0xaa,0x20,0x00,0x02,0x10,0x00,0x00,0x30,0x00,0x00,0x0a,0xbd,0xab,0x40,
+0x1c,0x28,0x70,0x93,0x0c,0xbb,0x30,0x19,0x0b,0x01,0x00,0x19,0x07,0x60,0x00,0xa3,
+0x00,0x6b,0xba,0x30,0x06,0xcc,0xc8,0x0c,0x30,0x65,0x0d,0x01,0xb0,0x3e,0x3a,0x00,
+0xb8,0x7c,0x00,0xb2,0x1b,0x00,0x4b,0xb5,0x54,0x00,0xf1,0x71,0x99,0x10,0x57,0xdd,
+0x85,0x71,0x55,0x17,0x71,0x66,0x17,0x72,0xbb,0x37,0x70,0x00,0x07,0x47,0xff,0x84,
+0x00,0x66,0x10,0x00,0x01,0x30,0x06,0x08,0xdb,0xc0,0x99,0xc0,0x00,0x07,0x05,0x80,
+0x00,0x71,0x81,0x00,0x0b,0xab,0x00,0x00,0x30,0x7e,0xdc,0x00,0x00,0x01,0x00,0x68,
+0x86,0x66,0x77,0x53,0x9a,0x77,0x78,0xec,0x73,0x30,0x06,0x79,0x80,0x06,0x76,0x60,
+0x06,0x9c,0xc7,0x79,0x00,0x28,0x96,0x00,0x04,0xa9,0x85,0xb0,0x0c,0x07,0x80,0x66,
+0x19,0x05,0x63,0x19,0x0b,0x8b,0x5a,0x88,0x07,0xb2,0x03,0xd2,0x00,0x6b,0xba,0x20,
+0x02,0x97,0x00,0x00,0x0a,0x14,0x73,0x30,0x0b,0x02,0xbf,0xf4,0x04,0xde,0x9f,0xf5,
+0x08,0x5a,0xff,0xe0,0x0a,0x5f,0xff,0xf5,0x0d,0xcb,0xbb,0xb4,0x43,0x01,0xf0,0x02,
+0x03,0x90,0x00,0x16,0x65,0x9a,0x00,0x1a,0xaa,0xaa,0x60,0x05,0xfe,0xef,0xf2,0x00,
+0x49,0x14,0x00,0x12,0x70,0x29,0x01,0xf0,0x0b,0x04,0x72,0x00,0x00,0x04,0x77,0x80,
+0x00,0x04,0x66,0x20,0x00,0x54,0x93,0x00,0x0c,0x47,0x4b,0x00,0x1f,0x3d,0x3e,0x00,
+0x03,0x85,0x93,0xd8,0x00,0x92,0xa0,0x07,0xc3,0xa0,0x08,0x5a,0xa0,0x00,0x0a,0x03,
+0x00,0xf1,0x2b,0xaa,0xaa,0xa9,0x00,0x46,0x10,0x00,0x05,0x40,0x87,0x20,0x08,0x00,
+0x01,0x80,0x35,0x6a,0xb5,0x70,0x60,0x37,0x40,0x62,0x34,0x0b,0x90,0x24,0x06,0x77,
+0x77,0x70,0x00,0x00,0x0a,0x00,0x00,0x00,0x1d,0x81,0x02,0xb9,0xb7,0x80,0x09,0x10,
+0xb5,0x80,0x0a,0x00,0x2d,0x00,0x09,0x00,0x1c,0x00,0x27,0x00,0x1c,0x6c,0x00,0xf1,
+0x0a,0x37,0x33,0x73,0x27,0x05,0xe0,0x10,0x00,0x29,0x82,0x01,0x8b,0x38,0x20,0x39,
+0x98,0x44,0x00,0xa4,0x00,0x20,0x4a,0xaa,0xaa,0xa8,0x38,0x00,0x05,0x04,0x00,0x24,
+0x99,0x90,0x0c,0x00,0x61,0x79,0x9d,0x99,0x93,0x00,0x00,0x08,0x00,0x30,0x92,0x00,
+0x09,0x14,0x00,0xa0,0xa3,0x00,0x00,0x09,0x08,0x70,0x00,0x09,0x00,0x10,0x10,0x00,
+0x00,0x04,0x00,0xf2,0x07,0x19,0x99,0xe9,0x96,0x00,0x05,0x90,0x00,0x00,0x3b,0x9a,
+0x10,0x06,0xa2,0x81,0xb2,0x26,0x01,0x80,0x05,0x00,0x01,0xe5,0x05,0x20,0x03,0x10,
+0x0b,0x00,0xf1,0x07,0x18,0x00,0x59,0xba,0xd9,0x91,0x05,0x53,0x90,0x70,0x09,0x53,
+0x94,0x50,0x05,0x63,0x96,0x00,0x68,0xba,0xd8,0x82,0x92,0x00,0x00,0x44,0x00,0xf1,
+0x01,0xa0,0x00,0xc8,0x8d,0x88,0x99,0x00,0x90,0x09,0xd9,0x9d,0x99,0x96,0x00,0x90,
+0x06,0x15,0x00,0x10,0x90,0x1c,0x00,0xf2,0x25,0x08,0x88,0xd8,0xa0,0xa1,0x1a,0x1a,
+0x04,0x66,0xc6,0x60,0xc8,0x8d,0x8a,0x49,0x00,0xa0,0x54,0x98,0x8d,0x88,0x30,0x00,
+0x90,0x00,0x02,0xb8,0x88,0xa0,0x02,0x66,0x50,0x90,0x02,0x60,0x50,0x90,0x3b,0xb9,
+0x99,0xd7,0x06,0x20,0x00,0x90,0x0a,0x00,0x00,0x90,0x44,0x00,0x38,0x4b,0x02,0x00,
+0x76,0x01,0x70,0x02,0xa0,0x00,0x08,0x9a,0xc9,0x93,0x88,0x00,0x44,0x05,0x99,0xc9,
+0x90,0x94,0x00,0x42,0x29,0x9a,0xc9,0x97,0x20,0x00,0x60,0x70,0x00,0x19,0x99,0x9b,
+0xa0,0xdf,0x06,0x40,0x00,0x01,0xa1,0x00,0x96,0x01,0xfb,0x1e,0x19,0xc2,0x00,0x01,
+0x41,0x17,0x99,0x84,0x00,0x01,0x35,0x20,0x07,0x7a,0x73,0x00,0x57,0x9b,0x99,0x71,
+0x17,0xa6,0x2c,0x70,0x25,0xa8,0x58,0x21,0x33,0xac,0xb9,0x70,0x19,0x76,0x39,0x60,
+0x63,0x06,0x20,0x63,0x06,0xaa,0xaa,0xa0,0x00,0x01,0x00,0xf0,0x15,0x3a,0xaa,0xaa,
+0xa7,0x00,0x06,0x00,0x00,0x69,0x9c,0xa9,0x91,0x01,0x60,0x07,0x00,0x39,0x30,0x16,
+0xa0,0x10,0x73,0x92,0x10,0x00,0x0b,0x70,0x00,0x04,0xa5,0x88,0x30,0x54,0x00,0x01,
+0x62,0x20,0x00,0xf0,0x0b,0x58,0x88,0x88,0x81,0x09,0x66,0x69,0x40,0x06,0x66,0x67,
+0x20,0x07,0x77,0xba,0x20,0x68,0x8c,0xa8,0x82,0x00,0x08,0x10,0x00,0x00,0x6b,0xb8,
+0x00,0xf1,0x0f,0x20,0x00,0x57,0x78,0x87,0x72,0x07,0x86,0x69,0x30,0x03,0x76,0x67,
+0x20,0x88,0x77,0x77,0xb1,0x30,0x87,0x95,0x20,0x00,0x90,0x26,0x21,0x49,0x20,0x1b,
+0xa1,0x69,0x00,0xf0,0x04,0x01,0x10,0x00,0x00,0x0a,0x90,0x00,0x02,0xa2,0x2a,0x20,
+0x69,0x30,0x03,0x96,0x00,0x90,0x09,0x00,0x04,0x00,0x00,0x6d,0x07,0x10,0x29,0x3c,
+0x01,0xf0,0x11,0x60,0x09,0x00,0x07,0x44,0x09,0x00,0x1d,0x09,0x1c,0x97,0x9b,0x4d,
+0x79,0x08,0x09,0x19,0x09,0x27,0x09,0x09,0x05,0x84,0x09,0x09,0x00,0x09,0x09,0x06,
+0x88,0x97,0x00,0xd4,0x03,0xf0,0x0d,0x05,0x00,0x90,0x0a,0x07,0x40,0x80,0x0a,0x00,
+0x43,0x60,0x0a,0x00,0x07,0x20,0x0a,0x38,0x0c,0x00,0x0d,0x61,0x95,0xa0,0x00,0x0a,
+0x30,0x26,0x00,0x1b,0x01,0xf0,0x01,0x31,0x50,0x00,0x08,0x58,0x1b,0x87,0x2d,0x34,
 0x08,0x09,0x7a,0x34,0x08,0x09,0x09,0x04,0x00,0x60,0x6b,0x49,0x77,0x09,0x10,0x08,
 0x97,0x01,0x02,0x87,0x00,0xf2,0x04,0x84,0x09,0x00,0x07,0x3a,0x09,0x00,0x1e,0x1c,
 0x9d,0x93,0x8b,0x32,0x09,0x00,0x08,0x49,0x9d,0x97,0x1e,0x00,0x02,0x04,0x00,0x01,
@@ -544,1263 +583,1249 @@ static const uint8_t lz4FontData[] ={
 0x30,0x0b,0xb9,0x99,0xb0,0x00,0x00,0x00,0x31,0x04,0x40,0x09,0x00,0x5b,0xb9,0x9d,
 0x91,0x04,0xa8,0x8b,0x00,0x04,0x51,0x19,0x00,0x04,0x96,0x6b,0x00,0x6a,0xa8,0x8c,
 0x82,0x05,0x90,0x38,0x30,0x53,0x00,0x00,0x61,0x01,0xb7,0x77,0xa0,0x01,0xa5,0x55,
-0xa0,0x08,0x00,0xc0,0xb6,0x66,0xa0,0x29,0xb8,0x88,0xb6,0x03,0xa1,0x06,0x81,0x25,
-0xc5,0x2c,0xf0,0x00,0x52,0x80,0x00,0x0a,0xba,0xc8,0x70,0x17,0x52,0x80,0x90,0x1c,
-0xba,0xc8,0xa0,0x08,0x00,0xf0,0x2d,0x8a,0xa9,0xa9,0xa3,0x07,0x80,0x29,0x40,0x53,
-0x00,0x00,0x60,0x01,0x70,0x04,0x40,0x17,0xb9,0x9c,0x84,0x06,0x8b,0xa9,0x70,0x14,
-0x5a,0x87,0xb3,0x13,0x59,0x86,0xb3,0x07,0xcb,0xad,0x70,0x05,0x87,0x57,0x91,0x36,
-0x17,0x53,0x27,0x09,0x9c,0xab,0xb2,0x09,0x08,0x25,0x62,0x3c,0x8c,0x9b,0xb9,0x09,
-0x08,0x36,0x63,0x0c,0x00,0x02,0x04,0x00,0xf1,0x11,0x27,0xa1,0x31,0x06,0x07,0x00,
-0x19,0x0c,0x7b,0x73,0x04,0x79,0x09,0x00,0x00,0x8c,0x8c,0x83,0x04,0x18,0x09,0x00,
-0x0a,0x0c,0x8c,0x82,0x46,0x0c,0x8d,0x85,0x00,0x08,0x45,0x08,0xf1,0x0a,0x09,0x00,
-0xa0,0x90,0xa0,0x0a,0x0a,0x08,0x99,0xd9,0xb0,0x30,0x0a,0x01,0x1a,0x00,0xa0,0x54,
-0xd9,0x9d,0x9b,0x40,0x00,0x00,0x54,0x69,0x06,0xf1,0x08,0x88,0x9d,0x50,0x04,0x10,
-0x92,0x14,0x08,0x72,0xa7,0x29,0x08,0x37,0xc9,0x09,0x09,0x54,0x81,0x49,0x0c,0x8a,
-0x98,0x89,0x1b,0x08,0xf1,0x10,0x22,0x04,0x00,0x00,0xb0,0x07,0x30,0x07,0x50,0x00,
-0xa2,0x2a,0x9a,0x99,0x87,0x00,0x0a,0x00,0x90,0x00,0x38,0x00,0x80,0x00,0xa1,0x02,
-0x70,0x0a,0x30,0x7a,0x30,0x40,0x08,0xf4,0x0b,0x07,0xc9,0xb4,0x1b,0x92,0x90,0x53,
-0x4b,0x00,0xa0,0x63,0x09,0x00,0x90,0x72,0x0a,0x84,0x80,0x71,0x09,0x18,0x20,0x90,
-0x00,0x55,0x09,0x32,0x05,0xf1,0x0e,0x09,0x29,0xc9,0x79,0x09,0x04,0x95,0x29,0x09,
-0x09,0x26,0x59,0x09,0x15,0x8a,0x19,0x09,0x00,0x5b,0x04,0x09,0x00,0xc2,0x00,0x09,
-0x0b,0x30,0x00,0x87,0xd4,0x03,0xf3,0x06,0x03,0x33,0x30,0x5a,0x75,0xb5,0xb0,0x02,
-0x80,0x90,0x90,0x09,0x71,0x90,0x90,0x6e,0xa0,0x90,0x90,0x59,0x43,0x85,0x06,0x34,
-0x45,0x28,0x70,0x48,0x00,0xf1,0x04,0x0c,0x8c,0x17,0x09,0x0c,0x7c,0x18,0x09,0x03,
-0x72,0x18,0x09,0x04,0x8b,0x28,0x09,0x06,0x08,0x03,0x08,0x06,0x44,0x43,0x68,0x03,
-0x97,0x4e,0x2e,0xf0,0x0d,0x6a,0x80,0x09,0x34,0x80,0x35,0x96,0x8c,0x74,0x59,0x07,
-0xc1,0x35,0x90,0xa9,0x93,0x59,0x94,0x81,0x12,0x94,0x18,0x00,0x09,0x01,0x80,0x07,
-0xa0,0x6b,0x00,0xb1,0x2b,0xbb,0x99,0x07,0x25,0x56,0x89,0x07,0x7b,0xbb,0xca,0x08,
-0x00,0xc0,0x25,0x56,0x84,0x07,0x25,0x56,0x80,0x07,0x25,0x59,0x72,0x94,0x64,0x00,
-0xf0,0x2c,0x18,0xc9,0x79,0x09,0x07,0x38,0x39,0x09,0x07,0x85,0x59,0x09,0x07,0xb9,
-0x59,0x09,0x00,0x72,0x07,0x09,0x01,0x9b,0xa0,0x09,0x29,0x51,0x01,0x97,0x06,0x90,
-0x00,0x08,0x1d,0xc8,0x57,0x19,0x65,0xa2,0x27,0x19,0x36,0xb6,0x57,0x19,0x1a,0xc8,
-0x77,0x19,0x26,0x90,0x83,0x09,0x25,0x94,0x70,0x09,0x00,0x90,0x01,0x84,0x00,0xf2,
-0x20,0x26,0x0c,0x88,0xa3,0x26,0x0b,0x77,0xa8,0x26,0x0b,0x9b,0x68,0x26,0x0c,0x38,
-0x88,0x26,0x1b,0x38,0x84,0x26,0x46,0x2a,0x50,0x26,0x50,0x08,0x02,0xa4,0x00,0x60,
-0x02,0x40,0x26,0xc7,0x6c,0x75,0x04,0x44,0x12,0x32,0x0a,0x5a,0x18,0x53,0x0a,0x7b,
-0x04,0x00,0x71,0x08,0x07,0x11,0x53,0x08,0x3a,0x03,0xc0,0x04,0xf4,0x0d,0x21,0x08,
-0x00,0x81,0x9b,0x41,0x68,0x09,0x8a,0x26,0x86,0x23,0x62,0x68,0x46,0xc7,0x36,0x80,
-0x7b,0x60,0x28,0x84,0x85,0x10,0x82,0x08,0x00,0x5b,0x08,0x01,0xf5,0x0d,0x3f,0xff,
-0xb3,0x09,0x08,0x01,0x78,0x09,0x08,0x88,0x48,0x09,0x39,0xa7,0x98,0x09,0x39,0xb7,
-0xa4,0x09,0x3a,0xb7,0xa0,0x09,0x34,0x00,0x82,0x97,0xa5,0x06,0xf3,0x10,0xb1,0x00,
-0x53,0x18,0x69,0x38,0x53,0x46,0x97,0x08,0x53,0x0a,0x6b,0x08,0x53,0x0b,0x6b,0x08,
-0x53,0x1a,0x68,0x04,0x53,0x68,0x7b,0x10,0x53,0x26,0x07,0x14,0xa2,0xca,0x06,0x30,
-0x00,0x8e,0xb1,0x21,0x03,0x60,0xd9,0xb0,0x09,0x00,0x90,0x80,0xfd,0x07,0xc4,0x4c,
-0x93,0x70,0x90,0x41,0x0a,0x10,0x90,0x00,0x75,0x29,0x70,0x20,0x0a,0xf4,0x09,0x90,
-0x07,0xaa,0x6d,0x8a,0x91,0xa0,0x90,0x98,0x09,0x09,0x09,0x80,0x90,0x90,0x88,0x09,
-0x75,0x27,0xa8,0xda,0x4a,0x28,0x09,0x6b,0x00,0xf2,0x10,0x03,0x89,0x08,0x00,0xbe,
-0xd9,0x08,0x00,0x48,0x96,0x9d,0xc1,0x88,0x99,0x26,0x80,0x88,0x99,0x44,0x80,0x49,
-0xa6,0x91,0x90,0x03,0x75,0xb0,0x90,0x89,0x7b,0x26,0x08,0x02,0xf0,0x10,0x60,0x00,
+0xa0,0x08,0x00,0xf0,0x10,0xb6,0x66,0xa0,0x29,0xb8,0x88,0xb6,0x03,0xa1,0x06,0x81,
+0x25,0x00,0x00,0x15,0x00,0x52,0x80,0x00,0x0a,0xba,0xc8,0x70,0x17,0x52,0x80,0x90,
+0x1c,0xba,0xc8,0xa0,0x08,0x00,0xf0,0x2d,0x8a,0xa9,0xa9,0xa3,0x07,0x80,0x29,0x40,
+0x53,0x00,0x00,0x60,0x01,0x70,0x04,0x40,0x17,0xb9,0x9c,0x84,0x06,0x8b,0xa9,0x70,
+0x14,0x5a,0x87,0xb3,0x13,0x59,0x86,0xb3,0x07,0xcb,0xad,0x70,0x05,0x87,0x57,0x91,
+0x36,0x17,0x53,0x27,0x09,0x9c,0xab,0xb2,0x09,0x08,0x25,0x62,0x3c,0x8c,0x9b,0xb9,
+0x09,0x08,0x36,0x63,0x0c,0x00,0x02,0x04,0x00,0xf1,0x11,0x27,0xa1,0x31,0x06,0x07,
+0x00,0x19,0x0c,0x7b,0x73,0x04,0x79,0x09,0x00,0x00,0x8c,0x8c,0x83,0x04,0x18,0x09,
+0x00,0x0a,0x0c,0x8c,0x82,0x46,0x0c,0x8d,0x85,0x00,0x08,0x45,0x08,0xf1,0x0a,0x09,
+0x00,0xa0,0x90,0xa0,0x0a,0x0a,0x08,0x99,0xd9,0xb0,0x30,0x0a,0x01,0x1a,0x00,0xa0,
+0x54,0xd9,0x9d,0x9b,0x40,0x00,0x00,0x54,0x69,0x06,0xf1,0x08,0x88,0x9d,0x50,0x04,
+0x10,0x92,0x14,0x08,0x72,0xa7,0x29,0x08,0x37,0xc9,0x09,0x09,0x54,0x81,0x49,0x0c,
+0x8a,0x98,0x89,0x1b,0x08,0xf1,0x10,0x22,0x04,0x00,0x00,0xb0,0x07,0x30,0x07,0x50,
+0x00,0xa2,0x2a,0x9a,0x99,0x87,0x00,0x0a,0x00,0x90,0x00,0x38,0x00,0x80,0x00,0xa1,
+0x02,0x70,0x0a,0x30,0x7a,0x30,0x40,0x08,0xf4,0x0b,0x07,0xc9,0xb4,0x1b,0x92,0x90,
+0x53,0x4b,0x00,0xa0,0x63,0x09,0x00,0x90,0x72,0x0a,0x84,0x80,0x71,0x09,0x18,0x20,
+0x90,0x00,0x55,0x09,0x32,0x05,0xf1,0x0e,0x09,0x29,0xc9,0x79,0x09,0x04,0x95,0x29,
+0x09,0x09,0x26,0x59,0x09,0x15,0x8a,0x19,0x09,0x00,0x5b,0x04,0x09,0x00,0xc2,0x00,
+0x09,0x0b,0x30,0x00,0x87,0xd4,0x03,0xf3,0x06,0x03,0x33,0x30,0x5a,0x75,0xb5,0xb0,
+0x02,0x80,0x90,0x90,0x09,0x71,0x90,0x90,0x6e,0xa0,0x90,0x90,0x59,0x43,0x85,0x06,
+0x34,0x45,0x28,0x70,0x48,0x00,0xf1,0x04,0x0c,0x8c,0x17,0x09,0x0c,0x7c,0x18,0x09,
+0x03,0x72,0x18,0x09,0x04,0x8b,0x28,0x09,0x06,0x08,0x03,0x08,0x06,0x43,0x43,0x68,
+0x03,0x97,0x24,0x00,0xf0,0x0e,0x02,0x6a,0x80,0x09,0x34,0x80,0x35,0x96,0x8c,0x74,
+0x59,0x07,0xc1,0x35,0x90,0xa9,0x93,0x59,0x94,0x81,0x12,0x94,0x18,0x00,0x09,0x01,
+0x80,0x07,0xa0,0x6b,0x00,0xb1,0x2b,0xbb,0x99,0x07,0x25,0x56,0x89,0x07,0x7b,0xbb,
+0xca,0x08,0x00,0xc0,0x25,0x56,0x84,0x07,0x25,0x56,0x80,0x07,0x25,0x59,0x72,0x94,
+0x64,0x00,0xf0,0x2c,0x18,0xc9,0x79,0x09,0x07,0x38,0x39,0x09,0x07,0x85,0x59,0x09,
+0x07,0xb9,0x59,0x09,0x00,0x72,0x07,0x09,0x01,0x9b,0xa0,0x09,0x29,0x51,0x01,0x97,
+0x06,0x90,0x00,0x08,0x1d,0xc8,0x57,0x19,0x65,0xa2,0x27,0x19,0x36,0xb6,0x57,0x19,
+0x1a,0xc8,0x77,0x19,0x26,0x90,0x83,0x09,0x25,0x94,0x70,0x09,0x00,0x90,0x01,0x84,
+0x00,0xf0,0x0e,0x26,0x0c,0x88,0xa3,0x26,0x0b,0x77,0xa8,0x26,0x0b,0x9b,0x68,0x26,
+0x0c,0x38,0x88,0x26,0x1b,0x38,0x84,0x26,0x46,0x2a,0x50,0x26,0x50,0x08,0x02,0xa4,
+0xf2,0x03,0x00,0x60,0x02,0x40,0x26,0xc7,0x6c,0x75,0x04,0x44,0x12,0x32,0x0a,0x5a,
+0x18,0x53,0x0a,0x7b,0x04,0x00,0xf2,0x1a,0x08,0x07,0x11,0x53,0x08,0x3a,0x03,0xa1,
+0x00,0x00,0x00,0x00,0x21,0x08,0x00,0x81,0x9b,0x41,0x68,0x09,0x8a,0x26,0x86,0x23,
+0x62,0x68,0x46,0xc7,0x36,0x80,0x7b,0x60,0x28,0x84,0x85,0x10,0x82,0x08,0x00,0x5b,
+0x00,0x01,0x00,0xf4,0x0f,0x09,0x3f,0xff,0xb3,0x09,0x08,0x01,0x78,0x09,0x08,0x88,
+0x48,0x09,0x39,0xa7,0x98,0x09,0x39,0xb7,0xa4,0x09,0x3a,0xb7,0xa0,0x09,0x34,0x00,
+0x82,0x97,0x00,0x01,0x00,0xf2,0x10,0xb1,0x00,0x53,0x18,0x69,0x38,0x53,0x46,0x97,
+0x08,0x53,0x0a,0x6b,0x08,0x53,0x0b,0x6b,0x08,0x53,0x1a,0x68,0x04,0x53,0x68,0x7b,
+0x10,0x53,0x26,0x07,0x14,0xa2,0x25,0x00,0xf1,0x0f,0x90,0x00,0x8e,0xb1,0x90,0x00,
+0x09,0x09,0xd9,0xb0,0x09,0x00,0x90,0x80,0x09,0x00,0x90,0x90,0x4c,0x93,0x70,0x90,
+0x41,0x0a,0x10,0x90,0x00,0x75,0x29,0x70,0x6d,0x00,0x00,0x26,0x00,0xf4,0x08,0x07,
+0xaa,0x6d,0x8a,0x91,0xa0,0x90,0x98,0x09,0x09,0x09,0x80,0x90,0x90,0x88,0x09,0x75,
+0x27,0xa8,0xda,0x4a,0x28,0x09,0x6b,0x00,0xf1,0x11,0x03,0x89,0x08,0x00,0xbe,0xd9,
+0x08,0x00,0x48,0x96,0x9d,0xc1,0x88,0x99,0x26,0x80,0x88,0x99,0x44,0x80,0x49,0xa6,
+0x91,0x90,0x03,0x75,0xb0,0x90,0x89,0x7b,0x26,0x90,0x25,0x00,0xf0,0x10,0x60,0x00,
 0x00,0x06,0xb8,0x88,0x70,0x38,0x00,0x00,0x90,0x59,0x88,0x90,0x90,0x09,0x55,0x90,
 0x90,0x09,0x22,0x29,0x40,0x09,0x00,0x00,0x26,0x04,0xa8,0x88,0xb2,0x20,0x00,0xf5,
 0x0d,0x04,0xc8,0x88,0x96,0x2a,0x00,0x30,0x09,0x59,0x78,0x38,0x08,0x08,0x2c,0x48,
 0x18,0x08,0x60,0x48,0x27,0x06,0x88,0x86,0x45,0x00,0x00,0x08,0xa2,0xd8,0x00,0xf0,
 0x15,0xa0,0x90,0x00,0x07,0x30,0x90,0x62,0x2f,0x10,0x92,0xa0,0x9a,0x10,0xcb,0x10,
 0x08,0x15,0xd0,0x00,0x08,0x68,0x90,0x03,0x08,0x10,0x90,0x08,0x08,0x10,0xa9,0xb4,
-0xd9,0xd9,0xd9,0x59,0x09,0xc9,0x00,0xf0,0x01,0x90,0x09,0x54,0x09,0x08,0x97,0x00,
-0x57,0x2d,0x99,0x99,0x96,0x0c,0x8e,0xff,0x83,0x20,0x19,0xf6,0x01,0x08,0x06,0x77,
-0x00,0x08,0x98,0x79,0xb0,0x08,0x87,0x78,0xb0,0x0c,0x88,0x88,0x86,0x3b,0x0a,0xf0,
-0x03,0x48,0x10,0x19,0xc1,0x08,0x10,0x00,0x80,0x08,0x10,0x39,0xc9,0x9c,0x97,0x00,
-0x90,0x08,0x10,0x04,0x00,0x50,0x05,0x60,0x08,0x10,0x29,0x1b,0x0a,0x00,0x6a,0x07,
-0xf0,0x08,0x11,0x70,0x70,0x02,0x81,0x72,0x80,0x00,0x41,0x73,0x10,0x07,0x99,0xc9,
-0x92,0x00,0x02,0x80,0x00,0x28,0x89,0xc8,0x87,0xee,0x07,0x00,0x04,0x00,0x01,0x21,
-0x06,0xf1,0x0d,0x05,0xa9,0x93,0x5c,0x82,0x90,0x62,0x08,0x08,0x03,0x90,0x08,0x3b,
-0x76,0xb5,0x08,0x08,0x73,0x47,0x08,0x16,0x87,0x18,0x08,0x63,0x97,0x65,0x00,0x4e,
-0x05,0x60,0x30,0x00,0x00,0x05,0xa9,0x60,0x08,0x00,0x60,0x39,0x9b,0xb9,0x97,0x00,
-0x05,0x93,0x08,0x10,0x8a,0x10,0x00,0x10,0x51,0x14,0x00,0xc0,0x0c,0x88,0xc8,0x84,
-0x09,0x87,0x87,0xa0,0x09,0x97,0x77,0xb0,0x04,0x00,0xf2,0x5c,0x17,0x12,0x92,0x10,
-0x63,0xa1,0x90,0x90,0x62,0x36,0x90,0x33,0x00,0x34,0x12,0x00,0x05,0xb7,0x7a,0x40,
-0x08,0x44,0x38,0x50,0x28,0xb8,0x9c,0x73,0x39,0x87,0x36,0xa4,0x11,0x66,0x73,0x21,
-0x00,0x64,0x77,0x00,0x03,0x85,0x10,0x00,0x1c,0x99,0x99,0xa0,0x04,0x57,0x13,0x50,
-0x00,0xa0,0x5a,0x00,0x00,0x38,0x73,0x00,0x00,0x0b,0xb0,0x00,0x06,0xa3,0x3a,0x72,
-0x54,0x00,0x00,0x23,0x29,0xd9,0xa7,0x00,0x00,0xd1,0x6a,0x91,0x00,0xb6,0x00,0x90,
-0x03,0x58,0x24,0x60,0x09,0x10,0xba,0x00,0x66,0x39,0x77,0xa3,0x10,0x20,0x00,0x01,
-0x00,0x01,0x35,0x50,0x09,0x86,0x52,0x4d,0x0c,0xf1,0x1f,0xba,0x89,0x90,0x09,0x1b,
-0x07,0x30,0x09,0x06,0x98,0x00,0x27,0x18,0xa9,0x20,0x53,0x81,0x00,0x72,0x6c,0x9b,
-0x76,0x62,0x1b,0x96,0x71,0x72,0x17,0x26,0x46,0xb0,0x1b,0x96,0x0b,0x90,0x18,0x5a,
-0x0a,0x30,0x69,0x87,0x38,0x90,0x00,0x26,0x80,0xaa,0x0a,0x65,0xb9,0x99,0x9c,0x90,
-0x00,0x09,0x03,0x00,0xc2,0xc9,0x99,0x9d,0x90,0x00,0x09,0x0a,0x88,0x88,0xa0,0x09,
-0x00,0x19,0x0b,0xf2,0x10,0x06,0x99,0x99,0x60,0x00,0x61,0x07,0x00,0x07,0x60,0x04,
-0x90,0x34,0x00,0x00,0x33,0x15,0x55,0x55,0x54,0x14,0x44,0x44,0xb3,0x04,0x99,0x60,
-0x90,0x07,0x10,0x90,0x04,0x00,0x32,0x98,0x70,0x90,0x74,0x0c,0x30,0x49,0x90,0x00,
-0x88,0x18,0xf1,0x00,0x82,0x07,0x00,0x08,0x52,0x37,0x90,0x18,0x65,0x54,0x63,0x07,
-0x88,0x88,0x70,0x4c,0x00,0x21,0x99,0x99,0x50,0x00,0x22,0x00,0x03,0x1b,0x0d,0xf0,
-0x06,0x29,0xac,0x99,0x96,0x00,0x91,0x00,0x00,0x06,0xe8,0x88,0xc1,0x36,0x90,0x00,
-0x71,0x00,0x99,0x99,0xc1,0x00,0x08,0x00,0xf0,0x0c,0x03,0x40,0x00,0x00,0x3a,0x93,
-0x00,0x18,0x91,0x19,0x81,0x64,0x77,0x77,0x35,0x05,0x88,0x88,0x50,0x09,0x00,0x01,
-0x80,0x09,0x88,0x89,0x80,0x08,0x00,0xf0,0x0d,0x0c,0x88,0x88,0x97,0x08,0x57,0x77,
-0x37,0x08,0x38,0x76,0x17,0x08,0x62,0x08,0x17,0x08,0x69,0x8b,0x17,0x08,0x31,0x00,
-0x17,0x08,0x00,0x02,0x95,0x55,0x09,0xf1,0x15,0x1a,0x98,0xa7,0x29,0x60,0x19,0x00,
-0x02,0xc9,0x10,0x29,0xdc,0x88,0x81,0x19,0x00,0x09,0x00,0xc8,0x88,0xb0,0x09,0x00,
-0x09,0x01,0x23,0x57,0x60,0x0a,0x64,0x30,0x00,0x0b,0x99,0x99,0x95,0x2d,0x01,0xf0,
-0x34,0x69,0x88,0xb0,0x29,0x71,0x00,0x90,0x84,0x79,0x88,0xd0,0x60,0x71,0x00,0x90,
-0x00,0x63,0x00,0x08,0x8d,0x88,0x83,0x90,0x00,0x03,0x69,0x38,0x87,0x26,0x95,0x20,
-0x82,0x69,0x59,0x89,0x26,0x92,0x10,0x02,0x69,0x00,0x05,0xa4,0x18,0x89,0xe8,0x85,
-0x00,0x2b,0x87,0x10,0x29,0x71,0x81,0x96,0x04,0x89,0xd8,0x70,0x05,0x40,0x00,0x90,
-0x05,0xa8,0x88,0xb0,0x08,0x00,0x01,0xb0,0x00,0xf1,0x04,0x49,0x85,0x00,0x3a,0x65,
-0x55,0xa4,0x25,0x88,0x99,0x21,0x00,0x00,0x38,0x00,0x09,0x88,0x88,0x90,0x04,0x00,
-0x01,0xf0,0x00,0x60,0x20,0x00,0x06,0x8a,0xc8,0x80,0x0c,0x00,0xf2,0x05,0x0a,0x88,
-0x88,0x80,0x09,0x68,0x88,0x80,0x09,0x90,0x00,0x80,0x56,0xb8,0x88,0xc0,0x70,0x90,
-0x00,0x80,0xe7,0x0b,0x60,0x90,0x00,0x06,0xc8,0xd8,0x81,0xa1,0x05,0xf0,0x5e,0x28,
-0x88,0xa8,0x86,0x02,0x88,0x88,0x70,0x04,0x40,0x00,0x90,0x04,0xa8,0x88,0xb0,0x04,
-0x50,0x00,0x90,0x15,0x86,0x12,0x21,0x39,0x0a,0x6c,0x48,0xc8,0x80,0x90,0x6c,0x08,
-0x09,0x08,0xb8,0x80,0x97,0x39,0x18,0x09,0x20,0x90,0xa8,0xd0,0x09,0x02,0x01,0x0c,
-0x7b,0x68,0x79,0x0c,0x6a,0x68,0x69,0x0b,0x66,0x36,0x69,0x08,0x49,0x78,0x09,0x08,
-0x43,0x08,0x09,0x08,0x49,0x75,0x09,0x08,0x00,0x03,0x96,0x00,0x30,0x04,0x00,0x06,
-0xb6,0x09,0x00,0x09,0x19,0x3c,0xb6,0x0c,0x79,0x98,0x90,0x0a,0x77,0x18,0xa0,0x2c,
-0x26,0x16,0x70,0x79,0x9b,0x3a,0xa0,0x55,0x26,0xa1,0x37,0x00,0x8b,0x01,0xf0,0x08,
-0xcd,0x6d,0xe3,0x04,0x77,0x87,0x80,0x07,0x78,0xb7,0xc0,0x07,0x44,0x93,0xa0,0x02,
-0x46,0xa4,0x40,0x28,0x89,0xc8,0x86,0x15,0x03,0xf1,0x0d,0x78,0x8b,0x9d,0x92,0x80,
-0x8a,0x6c,0x60,0x80,0x8a,0x7c,0x70,0x80,0x8a,0x7c,0x74,0x88,0x55,0x55,0x58,0x00,
-0x25,0x66,0x47,0x00,0x40,0x23,0x93,0x78,0x03,0xf0,0xa2,0xa4,0xb7,0xa0,0x28,0x86,
-0x96,0x80,0x68,0x9c,0x9d,0x82,0x07,0x60,0x29,0x20,0x8c,0x95,0xa9,0xd3,0x07,0x25,
-0x80,0x90,0x0c,0x95,0xb8,0x90,0x89,0x99,0x99,0xd8,0x06,0x88,0x49,0x80,0x90,0x08,
-0x98,0x09,0x00,0x89,0x80,0x68,0x84,0x98,0x98,0x88,0x8d,0x80,0x00,0x00,0x90,0x88,
-0x8b,0x88,0xc8,0x00,0x90,0x08,0x84,0x8d,0x88,0x88,0x01,0xb7,0x08,0x82,0xa1,0x28,
-0x88,0x98,0x88,0x9c,0x80,0x00,0x00,0x80,0x0c,0x88,0xb8,0x89,0x08,0x77,0xc7,0x49,
-0x08,0x00,0x80,0x09,0x08,0x68,0x7c,0x09,0x08,0x57,0x6a,0x09,0x0c,0x88,0x88,0x89,
-0x08,0x00,0x00,0x09,0x89,0x9b,0x88,0xc8,0x2b,0x8b,0x59,0x83,0x3c,0xa0,0x98,0x77,
-0x63,0x8a,0x80,0x66,0x50,0x98,0x11,0x48,0x39,0x88,0x77,0x77,0xc0,0x88,0x8a,0xcc,
-0xc8,0x47,0x8a,0x79,0x83,0x75,0x76,0x98,0x36,0x5a,0x29,0x84,0x69,0xa7,0x98,0x87,
-0x97,0xac,0x81,0x00,0x00,0x90,0x89,0xef,0xea,0xc8,0x37,0xa7,0x99,0x80,0x85,0x56,
-0x98,0x2a,0xac,0x89,0x82,0xa5,0xb5,0x98,0x88,0x8d,0x8c,0x81,0x80,0x00,0xf1,0x05,
-0xcd,0xdb,0xc8,0x07,0x55,0x69,0x80,0xb8,0x89,0x98,0x0b,0x66,0x99,0x81,0xb6,0x87,
-0x98,0x99,0x77,0xac,0x19,0x00,0xf0,0x06,0xfe,0xec,0xc8,0x08,0x75,0x69,0x84,0x8c,
-0x88,0xa8,0x47,0x87,0x89,0x84,0x78,0x78,0x98,0x8a,0xaa,0x9c,0x81,0xc3,0x01,0x70,
-0x07,0x00,0x00,0x28,0x9d,0x88,0x86,0xaf,0x02,0xd0,0x04,0x90,0x08,0x00,0x3c,0x56,
-0x8d,0x83,0x13,0x50,0x09,0x00,0x03,0x04,0x00,0x21,0x68,0x8d,0x88,0x04,0x10,0x08,
-0x02,0x00,0xf0,0x05,0x03,0x08,0x00,0x5c,0x88,0x4c,0x78,0x08,0x2d,0x69,0x08,0x08,
-0x18,0x08,0x18,0x5c,0x78,0x03,0x75,0x20,0x19,0x00,0x21,0x04,0x98,0x01,0x09,0x04,
-0xda,0x0d,0x20,0x4b,0x76,0x88,0x30,0xf2,0x03,0x0b,0x84,0x08,0x18,0x09,0x00,0x3b,
-0x88,0x09,0x00,0x31,0x08,0x19,0x00,0x00,0x48,0x88,0x85,0xb1,0x05,0xf7,0x0b,0x91,
-0x00,0x09,0x01,0xd8,0x85,0x5d,0x8a,0x31,0x18,0x09,0x03,0x91,0x08,0x09,0x00,0x06,
-0x28,0x0a,0xa1,0x49,0x47,0x66,0x06,0x50,0x35,0x49,0x05,0xf0,0x2e,0x90,0x3c,0x9b,
-0x36,0x90,0x5c,0x9b,0x56,0x90,0x08,0x17,0x14,0x90,0x51,0x18,0x05,0x60,0x08,0x8c,
-0x98,0x40,0x00,0x07,0x10,0x00,0x78,0x88,0x88,0x83,0x01,0x80,0x17,0x00,0x28,0xc5,
-0x49,0x20,0x48,0xb7,0x7b,0xb0,0x07,0x35,0x46,0x80,0x28,0xc6,0x97,0x80,0x48,0xc7,
-0x79,0x90,0x00,0x80,0xa0,0x77,0x00,0x86,0x30,0x14,0xf5,0x05,0x00,0xbc,0x00,0x80,
-0x39,0xa7,0x7c,0x70,0x03,0xa7,0x7b,0x00,0x04,0x00,0xf0,0x01,0x8b,0xb9,0x9d,0x93,
-0x5d,0xc9,0x9d,0xa2,0x62,0x08,0x00,0x31,0x17,0x7c,0x87,0x60,0x99,0x02,0xf6,0x10,
-0x02,0x8c,0x5a,0x88,0x80,0x48,0xc7,0x91,0x85,0x00,0x74,0x4a,0x87,0x60,0x39,0xc6,
-0x99,0x35,0x04,0x8c,0x79,0x4c,0x00,0x00,0x80,0x95,0xd3,0x00,0x08,0x0a,0x90,0x53,
-0x0d,0xf4,0x11,0x07,0x11,0x3a,0x21,0x07,0x19,0x6b,0x68,0x3c,0x99,0x7c,0x78,0x07,
-0x18,0x07,0x08,0x07,0x15,0xad,0x94,0x08,0x90,0x98,0x74,0x59,0x23,0x79,0x97,0x00,
-0x19,0x08,0x89,0x28,0x00,0xf1,0x11,0x08,0x02,0x3a,0x31,0x08,0x05,0x89,0x63,0x3c,
-0x86,0x77,0xb0,0x08,0x06,0x76,0xb0,0x08,0x06,0xa9,0xd0,0x2b,0x8b,0x99,0xc6,0x11,
-0x05,0x61,0x91,0x00,0x03,0x00,0x03,0x24,0x00,0xf5,0x2c,0x03,0x61,0x60,0x08,0x09,
-0x9b,0xa0,0x4c,0x58,0x49,0xa0,0x08,0x0a,0x7c,0xa0,0x08,0x05,0x88,0x50,0x2b,0x69,
-0x66,0x80,0x20,0x09,0x77,0x80,0x00,0x09,0x00,0x70,0x0b,0xba,0x97,0xa7,0x08,0xa8,
-0x78,0xb9,0x0a,0xa9,0x73,0xb0,0x0a,0x95,0x8a,0x64,0x09,0x56,0xa4,0x08,0x34,0x67,
-0xc7,0x72,0x64,0x77,0xc7,0x76,0x95,0x36,0xf0,0x10,0x70,0x09,0x00,0x06,0xb9,0x29,
-0x00,0x09,0x08,0x1b,0x00,0x48,0x1b,0x0c,0x90,0x11,0xa8,0x09,0x38,0x00,0xa2,0x09,
-0x00,0x06,0x70,0x09,0x00,0x47,0x00,0x09,0x00,0xd1,0x01,0xf1,0x0c,0x01,0x88,0x8d,
-0x10,0x07,0x55,0x95,0x00,0x02,0x7a,0x84,0x00,0x28,0x37,0x98,0xd4,0x02,0x94,0x56,
-0x80,0x00,0x05,0xc5,0x00,0x29,0x84,0x00,0xe7,0x10,0x00,0x72,0x0a,0x01,0xeb,0x10,
-0xf0,0x05,0x07,0xc0,0x00,0x00,0x0a,0x37,0x00,0x00,0x84,0x0a,0x20,0x19,0x60,0x00,
-0x95,0x02,0x00,0x00,0x02,0x09,0x17,0x11,0x02,0x20,0x00,0x10,0x96,0x7a,0x0e,0x81,
-0x00,0x29,0x29,0x00,0x05,0xa0,0x05,0xa2,0x2e,0x0a,0x08,0x3c,0x00,0x13,0x06,0x3c,
-0x00,0xf0,0x08,0x69,0x09,0x10,0x07,0x85,0x71,0xb3,0x24,0x00,0x30,0x05,0x06,0x28,
-0x00,0x00,0x0c,0x8c,0x88,0x50,0x47,0x19,0x11,0x00,0x3f,0x07,0xe0,0x79,0x9e,0xc9,
-0x93,0x00,0x47,0x90,0x00,0x06,0x90,0x1a,0x40,0x64,0x00,0x86,0x04,0xf0,0x0b,0x10,
-0x00,0x68,0x8c,0x98,0x82,0x05,0x28,0x17,0x00,0x0b,0x39,0x2c,0x10,0x64,0x6b,0xb2,
-0x90,0x00,0x65,0xa1,0x00,0x18,0x70,0x1a,0x40,0x61,0x17,0x01,0x1d,0x14,0xf5,0x10,
-0x30,0x00,0x00,0x08,0x10,0x88,0xc5,0x2c,0x78,0x04,0x60,0x08,0x49,0x8c,0x97,0x1a,
-0x82,0x08,0x10,0x04,0xe0,0x07,0x10,0x07,0x87,0x07,0x10,0x46,0x00,0x5a,0x00,0x70,
-0x01,0xf1,0x10,0x00,0x54,0x00,0x08,0x00,0x91,0x30,0x5c,0xc5,0x50,0xa0,0x26,0x97,
-0x97,0x74,0x56,0x93,0x88,0x90,0x08,0xa5,0x20,0x90,0x3b,0x36,0x97,0xc0,0x63,0x05,
-0x30,0x90,0xd4,0x06,0x30,0x99,0x9b,0xc0,0x52,0x37,0x00,0xe8,0x02,0x50,0x39,0x99,
-0xd9,0x97,0x00,0x93,0x04,0x00,0x04,0x00,0x10,0x59,0xf3,0x07,0xf1,0x03,0x20,0x00,
-0x89,0x88,0x88,0xc1,0x62,0x88,0x87,0x51,0x00,0x01,0x83,0x00,0x58,0x8b,0xa8,0x81,
-0x7d,0x00,0x00,0x04,0x00,0x30,0x5b,0x10,0x00,0xec,0x05,0x22,0x29,0x9d,0xc8,0x05,
-0xd1,0x03,0x83,0x89,0xd1,0x3d,0x50,0x09,0x10,0x14,0x68,0x8d,0x87,0x03,0x1d,0x03,
-0x13,0x88,0x1b,0x38,0xf1,0x03,0x10,0x00,0x0a,0x97,0x6b,0xe1,0x08,0x59,0x85,0xc0,
+0xd9,0xd9,0xd9,0x59,0x09,0xc9,0x00,0xf5,0x15,0x90,0x09,0x54,0x09,0x08,0x97,0x00,
+0x57,0x2d,0x99,0x99,0x96,0x0c,0x8e,0xff,0x83,0x08,0x09,0x09,0x00,0x08,0x06,0x77,
+0x00,0x08,0x98,0x79,0xb0,0x08,0x87,0x78,0xb0,0x0c,0x88,0x88,0x86,0x55,0x00,0xf0,
+0x04,0x3a,0x48,0x10,0x19,0xc1,0x08,0x10,0x00,0x80,0x08,0x10,0x39,0xc9,0x9c,0x97,
+0x00,0x90,0x08,0x10,0x04,0x00,0x80,0x05,0x60,0x08,0x10,0x29,0x00,0x08,0x10,0x23,
+0x00,0xf0,0x0d,0x04,0x11,0x70,0x70,0x02,0x81,0x72,0x80,0x00,0x41,0x73,0x10,0x07,
+0x99,0xc9,0x92,0x00,0x02,0x80,0x00,0x28,0x89,0xc8,0x87,0x00,0x01,0x70,0x00,0x04,
+0x00,0xf1,0x11,0x08,0x00,0x26,0x00,0x08,0x05,0xa9,0x93,0x5c,0x82,0x90,0x62,0x08,
+0x08,0x03,0x90,0x08,0x3b,0x76,0xb5,0x08,0x08,0x73,0x47,0x08,0x16,0x87,0x18,0x08,
+0x63,0x97,0x65,0x68,0x00,0x70,0x05,0x30,0x00,0x00,0x05,0xa9,0x60,0x08,0x00,0xb0,
+0x39,0x9b,0xb9,0x97,0x00,0x05,0x50,0x00,0x00,0x05,0x8a,0x10,0x00,0x10,0x51,0x14,
+0x00,0xc0,0x0c,0x88,0xc8,0x84,0x09,0x87,0x87,0xa0,0x09,0x97,0x77,0xb0,0x04,0x00,
+0xf1,0x5c,0x17,0x12,0x92,0x10,0x63,0xa1,0x90,0x90,0x62,0x36,0x90,0x33,0x00,0x34,
+0x12,0x00,0x05,0xb7,0x7a,0x40,0x08,0x44,0x38,0x50,0x28,0xb8,0x9c,0x73,0x39,0x87,
+0x36,0xa4,0x11,0x66,0x73,0x21,0x00,0x64,0x77,0x00,0x03,0x85,0x10,0x00,0x1c,0x99,
+0x99,0xa0,0x04,0x57,0x13,0x50,0x00,0xa0,0x5a,0x00,0x00,0x38,0x73,0x00,0x00,0x0b,
+0xb0,0x00,0x06,0xa3,0x3a,0x72,0x54,0x00,0x00,0x23,0x29,0xd9,0xa7,0x00,0x00,0xd1,
+0x6a,0x91,0x00,0xb6,0x00,0x90,0x03,0x58,0x24,0x60,0x09,0x10,0xba,0x00,0x66,0x39,
+0x77,0xa3,0x10,0x20,0x00,0x01,0x00,0x01,0x35,0x50,0x09,0x86,0x52,0xe9,0x01,0xf0,
+0x21,0x09,0xba,0x89,0x90,0x09,0x1b,0x07,0x30,0x09,0x06,0x98,0x00,0x27,0x18,0xa9,
+0x20,0x53,0x81,0x00,0x72,0x6c,0x9b,0x76,0x62,0x1b,0x96,0x71,0x72,0x17,0x26,0x46,
+0xb0,0x1b,0x96,0x0b,0x90,0x18,0x5a,0x0a,0x30,0x69,0x87,0x38,0x90,0x00,0x26,0x80,
+0x26,0xd3,0x00,0x65,0xb9,0x99,0x9c,0x90,0x00,0x09,0x03,0x00,0xe0,0xc9,0x99,0x9d,
+0x90,0x00,0x09,0x0a,0x88,0x88,0xa0,0x09,0x00,0x00,0x90,0x04,0x00,0xf2,0x10,0x06,
+0x99,0x99,0x60,0x00,0x61,0x07,0x00,0x07,0x60,0x04,0x90,0x34,0x00,0x00,0x33,0x15,
+0x55,0x55,0x54,0x14,0x44,0x44,0xb3,0x04,0x99,0x60,0x90,0x07,0x10,0x90,0x04,0x00,
+0x31,0x98,0x70,0x90,0x8f,0x02,0xf1,0x08,0x00,0x49,0x90,0x00,0x06,0x00,0x00,0x00,
+0x82,0x07,0x00,0x08,0x52,0x37,0x90,0x18,0x65,0x54,0x63,0x07,0x88,0x88,0x70,0x4c,
+0x00,0x21,0x99,0x99,0x50,0x00,0xf0,0x0e,0x00,0x03,0x00,0x00,0x00,0x0a,0x00,0x00,
+0x29,0xac,0x99,0x96,0x00,0x91,0x00,0x00,0x06,0xe8,0x88,0xc1,0x36,0x90,0x00,0x71,
+0x00,0x99,0x99,0xc1,0x00,0x08,0x00,0xf0,0x0c,0x03,0x40,0x00,0x00,0x3a,0x93,0x00,
+0x18,0x91,0x19,0x81,0x64,0x77,0x77,0x35,0x05,0x88,0x88,0x50,0x09,0x00,0x01,0x80,
+0x09,0x88,0x89,0x80,0x08,0x00,0xf1,0x35,0x0c,0x88,0x88,0x97,0x08,0x57,0x77,0x37,
+0x08,0x38,0x76,0x17,0x08,0x62,0x08,0x17,0x08,0x69,0x8b,0x17,0x08,0x31,0x00,0x17,
+0x08,0x00,0x02,0x95,0x00,0x17,0x00,0x00,0x1a,0x98,0xa7,0x29,0x60,0x19,0x00,0x02,
+0xc9,0x10,0x29,0xdc,0x88,0x81,0x19,0x00,0x09,0x00,0xc8,0x88,0xb0,0x09,0x00,0x09,
+0x01,0x23,0x57,0x60,0x0a,0x64,0x30,0x00,0x0b,0x99,0x99,0x95,0x2d,0x01,0xf0,0x34,
+0x69,0x88,0xb0,0x29,0x71,0x00,0x90,0x84,0x79,0x88,0xd0,0x60,0x71,0x00,0x90,0x00,
+0x63,0x00,0x08,0x8d,0x88,0x83,0x90,0x00,0x03,0x69,0x38,0x87,0x26,0x95,0x20,0x82,
+0x69,0x59,0x89,0x26,0x92,0x10,0x02,0x69,0x00,0x05,0xa4,0x18,0x89,0xe8,0x85,0x00,
+0x2b,0x87,0x10,0x29,0x71,0x81,0x96,0x04,0x89,0xd8,0x70,0x05,0x40,0x00,0x90,0x05,
+0xa8,0x88,0xb0,0x08,0x00,0x01,0xb0,0x00,0xf1,0x04,0x49,0x85,0x00,0x3a,0x65,0x55,
+0xa4,0x25,0x88,0x99,0x21,0x00,0x00,0x38,0x00,0x09,0x88,0x88,0x90,0x04,0x00,0x01,
+0xf0,0x00,0x60,0x20,0x00,0x06,0x8a,0xc8,0x80,0x0c,0x00,0xf1,0x05,0x0a,0x88,0x88,
+0x80,0x09,0x68,0x88,0x80,0x09,0x90,0x00,0x80,0x56,0xb8,0x88,0xc0,0x70,0x90,0x00,
+0x80,0x59,0x02,0xf0,0x69,0x80,0x90,0x00,0x06,0xc8,0xd8,0x81,0x0a,0x00,0x90,0x00,
+0x28,0x88,0xa8,0x86,0x02,0x88,0x88,0x70,0x04,0x40,0x00,0x90,0x04,0xa8,0x88,0xb0,
+0x04,0x50,0x00,0x90,0x15,0x86,0x12,0x21,0x39,0x0a,0x6c,0x48,0xc8,0x80,0x90,0x6c,
+0x08,0x09,0x08,0xb8,0x80,0x97,0x39,0x18,0x09,0x20,0x90,0xa8,0xd0,0x09,0x02,0x01,
+0x0c,0x7b,0x68,0x79,0x0c,0x6a,0x68,0x69,0x0b,0x66,0x36,0x69,0x08,0x49,0x78,0x09,
+0x08,0x43,0x08,0x09,0x08,0x49,0x75,0x09,0x08,0x00,0x03,0x96,0x00,0x30,0x04,0x00,
+0x06,0xb6,0x09,0x00,0x09,0x19,0x3c,0xb6,0x0c,0x79,0x98,0x90,0x0a,0x77,0x18,0xa0,
+0x2c,0x26,0x16,0x70,0x79,0x9b,0x3a,0xa0,0x55,0x26,0xa1,0x37,0x00,0x8b,0x01,0xf0,
+0x08,0xcd,0x6d,0xe3,0x04,0x77,0x87,0x80,0x07,0x78,0xb7,0xc0,0x07,0x44,0x93,0xa0,
+0x02,0x46,0xa4,0x40,0x28,0x89,0xc8,0x86,0x15,0x03,0xf1,0x0d,0x78,0x8b,0x9d,0x92,
+0x80,0x8a,0x6c,0x60,0x80,0x8a,0x7c,0x70,0x80,0x8a,0x7c,0x74,0x88,0x55,0x55,0x58,
+0x00,0x25,0x66,0x47,0x00,0x40,0x23,0x93,0x78,0x03,0xf0,0xa2,0xa4,0xb7,0xa0,0x28,
+0x86,0x96,0x80,0x68,0x9c,0x9d,0x82,0x07,0x60,0x29,0x20,0x8c,0x95,0xa9,0xd3,0x07,
+0x25,0x80,0x90,0x0c,0x95,0xb8,0x90,0x89,0x99,0x99,0xd8,0x06,0x88,0x49,0x80,0x90,
+0x08,0x98,0x09,0x00,0x89,0x80,0x68,0x84,0x98,0x98,0x88,0x8d,0x80,0x00,0x00,0x90,
+0x88,0x8b,0x88,0xc8,0x00,0x90,0x08,0x84,0x8d,0x88,0x88,0x01,0xb7,0x08,0x82,0xa1,
+0x28,0x88,0x98,0x88,0x9c,0x80,0x00,0x00,0x80,0x0c,0x88,0xb8,0x89,0x08,0x77,0xc7,
+0x49,0x08,0x00,0x80,0x09,0x08,0x68,0x7c,0x09,0x08,0x57,0x6a,0x09,0x0c,0x88,0x88,
+0x89,0x08,0x00,0x00,0x09,0x89,0x9b,0x88,0xc8,0x2b,0x8b,0x59,0x83,0x3c,0xa0,0x98,
+0x77,0x63,0x8a,0x80,0x66,0x50,0x98,0x11,0x48,0x39,0x88,0x77,0x77,0xc0,0x88,0x8a,
+0xcc,0xc8,0x47,0x8a,0x79,0x83,0x75,0x76,0x98,0x36,0x5a,0x29,0x84,0x69,0xa7,0x98,
+0x87,0x97,0xac,0x81,0x00,0x00,0x90,0x89,0xef,0xea,0xc8,0x37,0xa7,0x99,0x80,0x85,
+0x56,0x98,0x2a,0xac,0x89,0x82,0xa5,0xb5,0x98,0x88,0x8d,0x8c,0x81,0x80,0x00,0xf1,
+0x05,0xcd,0xdb,0xc8,0x07,0x55,0x69,0x80,0xb8,0x89,0x98,0x0b,0x66,0x99,0x81,0xb6,
+0x87,0x98,0x99,0x77,0xac,0x19,0x00,0xf0,0x06,0xfe,0xec,0xc8,0x08,0x75,0x69,0x84,
+0x8c,0x88,0xa8,0x47,0x87,0x89,0x84,0x78,0x78,0x98,0x8a,0xaa,0x9c,0x81,0xc3,0x01,
+0x70,0x07,0x00,0x00,0x28,0x9d,0x88,0x86,0xaf,0x02,0xd0,0x04,0x90,0x08,0x00,0x3c,
+0x56,0x8d,0x83,0x13,0x50,0x09,0x00,0x03,0x04,0x00,0x21,0x68,0x8d,0x88,0x04,0x10,
+0x08,0x02,0x00,0xf0,0x05,0x03,0x08,0x00,0x5c,0x88,0x4c,0x78,0x08,0x2d,0x69,0x08,
+0x08,0x18,0x08,0x18,0x5c,0x78,0x03,0x75,0x20,0x19,0x00,0x32,0x04,0x98,0x98,0x24,
+0x00,0x11,0x09,0x04,0x00,0xf2,0x09,0x4b,0x76,0x09,0x00,0x08,0x08,0x0b,0x84,0x08,
+0x18,0x09,0x00,0x3b,0x88,0x09,0x00,0x31,0x08,0x19,0x00,0x00,0x48,0x88,0x85,0xb1,
+0x05,0xf7,0x0b,0x91,0x00,0x09,0x01,0xd8,0x85,0x5d,0x8a,0x31,0x18,0x09,0x03,0x91,
+0x08,0x09,0x00,0x06,0x28,0x0a,0xa1,0x49,0x47,0x66,0x06,0x50,0x35,0x49,0x05,0xf0,
+0x2e,0x90,0x3c,0x9b,0x36,0x90,0x5c,0x9b,0x56,0x90,0x08,0x17,0x14,0x90,0x51,0x18,
+0x05,0x60,0x08,0x8c,0x98,0x40,0x00,0x07,0x10,0x00,0x78,0x88,0x88,0x83,0x01,0x80,
+0x17,0x00,0x28,0xc5,0x49,0x20,0x48,0xb7,0x7b,0xb0,0x07,0x35,0x46,0x80,0x28,0xc6,
+0x97,0x80,0x48,0xc7,0x79,0x90,0x00,0x80,0xa0,0x77,0x00,0x86,0x30,0x14,0xf5,0x05,
+0x00,0xbc,0x00,0x80,0x39,0xa7,0x7c,0x70,0x03,0xa7,0x7b,0x00,0x04,0x00,0xf0,0x01,
+0x8b,0xb9,0x9d,0x93,0x5d,0xc9,0x9d,0xa2,0x62,0x08,0x00,0x31,0x17,0x7c,0x87,0x60,
+0x99,0x02,0xf5,0x11,0x02,0x8c,0x5a,0x88,0x80,0x48,0xc7,0x91,0x85,0x00,0x74,0x4a,
+0x87,0x60,0x39,0xc6,0x99,0x35,0x04,0x8c,0x79,0x4c,0x00,0x00,0x80,0x95,0xd3,0x00,
+0x08,0x0a,0x90,0x90,0x80,0x05,0xf4,0x11,0x07,0x11,0x3a,0x21,0x07,0x19,0x6b,0x68,
+0x3c,0x99,0x7c,0x78,0x07,0x18,0x07,0x08,0x07,0x15,0xad,0x94,0x08,0x90,0x98,0x74,
+0x59,0x23,0x79,0x97,0x00,0x19,0x08,0x89,0x28,0x00,0xf1,0x11,0x08,0x02,0x3a,0x31,
+0x08,0x05,0x89,0x63,0x3c,0x86,0x77,0xb0,0x08,0x06,0x76,0xb0,0x08,0x06,0xa9,0xd0,
+0x2b,0x8b,0x99,0xc6,0x11,0x05,0x61,0x91,0x00,0x03,0x00,0x03,0x24,0x00,0xf4,0x2c,
+0x03,0x61,0x60,0x08,0x09,0x9b,0xa0,0x4c,0x58,0x49,0xa0,0x08,0x0a,0x7c,0xa0,0x08,
+0x05,0x88,0x50,0x2b,0x69,0x66,0x80,0x20,0x09,0x77,0x80,0x00,0x09,0x00,0x70,0x0b,
+0xba,0x97,0xa7,0x08,0xa8,0x78,0xb9,0x0a,0xa9,0x73,0xb0,0x0a,0x95,0x8a,0x64,0x09,
+0x56,0xa4,0x08,0x34,0x67,0xc7,0x72,0x64,0x77,0xc7,0x76,0x68,0x00,0xf0,0x11,0x02,
+0x70,0x09,0x00,0x06,0xb9,0x29,0x00,0x09,0x08,0x1b,0x00,0x48,0x1b,0x0c,0x90,0x11,
+0xa8,0x09,0x38,0x00,0xa2,0x09,0x00,0x06,0x70,0x09,0x00,0x47,0x00,0x09,0x00,0xd1,
+0x01,0xf0,0x10,0x01,0x88,0x8d,0x10,0x07,0x55,0x95,0x00,0x02,0x7a,0x84,0x00,0x28,
+0x37,0x98,0xd4,0x02,0x94,0x56,0x80,0x00,0x05,0xc5,0x00,0x29,0x84,0x00,0x00,0x00,
+0x01,0x80,0x45,0x00,0xf3,0x0e,0x00,0x29,0x9a,0xc9,0x97,0x00,0x07,0xc0,0x00,0x00,
+0x0a,0x37,0x00,0x00,0x84,0x0a,0x20,0x19,0x60,0x00,0x95,0x02,0x00,0x00,0x02,0x09,
+0x9a,0xc9,0x93,0x20,0x00,0xf9,0x02,0x96,0x00,0x08,0xb1,0x00,0x00,0x29,0x29,0x00,
+0x05,0xa0,0x05,0xa2,0x25,0x00,0x00,0x15,0x3c,0x00,0x13,0x06,0x3c,0x00,0xf0,0x08,
+0x69,0x09,0x10,0x07,0x85,0x71,0xb3,0x24,0x00,0x30,0x05,0x06,0x28,0x00,0x00,0x0c,
+0x8c,0x88,0x50,0x47,0x19,0x11,0x00,0x3f,0x07,0xe0,0x79,0x9e,0xc9,0x93,0x00,0x47,
+0x90,0x00,0x06,0x90,0x1a,0x40,0x64,0x00,0x86,0x04,0xf0,0x0f,0x10,0x00,0x68,0x8c,
+0x98,0x82,0x05,0x28,0x17,0x00,0x0b,0x39,0x2c,0x10,0x64,0x6b,0xb2,0x90,0x00,0x65,
+0xa1,0x00,0x18,0x70,0x1a,0x40,0x52,0x00,0x00,0x52,0xe0,0x00,0xf5,0x11,0x06,0x30,
+0x00,0x00,0x08,0x10,0x88,0xc5,0x2c,0x78,0x04,0x60,0x08,0x49,0x8c,0x97,0x1a,0x82,
+0x08,0x10,0x04,0xe0,0x07,0x10,0x07,0x87,0x07,0x10,0x46,0x00,0x5a,0x00,0x70,0x01,
+0xf1,0x10,0x00,0x54,0x00,0x08,0x00,0x91,0x30,0x5c,0xc5,0x50,0xa0,0x26,0x97,0x97,
+0x74,0x56,0x93,0x88,0x90,0x08,0xa5,0x20,0x90,0x3b,0x36,0x97,0xc0,0x63,0x05,0x30,
+0x90,0xd4,0x06,0x61,0x99,0x9b,0xc0,0x00,0x00,0x78,0xbf,0x05,0x50,0x39,0x99,0xd9,
+0x97,0x00,0x93,0x04,0x00,0x04,0x00,0x10,0x59,0xf3,0x07,0xf1,0x03,0x20,0x00,0x89,
+0x88,0x88,0xc1,0x62,0x88,0x87,0x51,0x00,0x01,0x83,0x00,0x58,0x8b,0xa8,0x81,0x7d,
+0x00,0x00,0x04,0x00,0x30,0x5b,0x10,0x00,0xec,0x05,0x22,0x29,0x9d,0xc8,0x05,0xd1,
+0x03,0x83,0x89,0xd1,0x3d,0x50,0x09,0x10,0x14,0x68,0x8d,0x87,0x03,0x1d,0x03,0x12,
+0x88,0x85,0x00,0xf1,0x04,0x10,0x10,0x00,0x0a,0x97,0x6b,0xe1,0x08,0x59,0x85,0xc0,
 0x2a,0x77,0x77,0x88,0x13,0x66,0x9a,0x05,0x60,0x04,0xf0,0x01,0x03,0x50,0x00,0x00,
-0x29,0x40,0x00,0x00,0x01,0x50,0x00,0x09,0x89,0xd8,0x85,0x08,0xfc,0x02,0x91,0x60,
-0x05,0x40,0x00,0xb7,0xa6,0x00,0x00,0xb2,0xd7,0x12,0xf0,0x08,0x26,0x00,0x99,0x99,
-0xb3,0x00,0x03,0x30,0x00,0x0a,0x89,0xa8,0x95,0x07,0x08,0x00,0x26,0x18,0x9d,0x89,
-0x96,0x00,0xa1,0x58,0x13,0xf1,0x1a,0xb4,0x00,0x01,0x59,0x6a,0x80,0x07,0x30,0x00,
-0x42,0x00,0x05,0x10,0x00,0x69,0x9a,0xa9,0xa1,0x73,0x55,0x55,0x71,0x00,0x22,0x22,
-0x00,0x69,0xba,0xb9,0x92,0x00,0x81,0x71,0x00,0x00,0x90,0x71,0x14,0x59,0x20,0x59,
-0xa8,0x04,0x01,0x57,0x12,0xf4,0x0c,0x9b,0x99,0xb0,0x70,0x00,0x00,0x80,0x04,0x8d,
-0x88,0x00,0x08,0x19,0x88,0x30,0x0b,0x29,0x00,0x00,0x28,0x9a,0x00,0x00,0x91,0x2b,
-0x99,0x92,0x24,0x00,0xf2,0x49,0x88,0x88,0x88,0xb1,0x43,0x82,0x48,0x40,0x38,0x2b,
-0x82,0x70,0x05,0x90,0x39,0x20,0x9c,0x98,0x8d,0x92,0x06,0x10,0x09,0x00,0x06,0x98,
-0x8c,0x00,0x00,0x04,0x10,0x00,0x88,0x99,0x99,0xa5,0x6a,0xaa,0xba,0xb5,0x06,0x67,
-0x77,0x20,0x0a,0xaa,0xaa,0x80,0x0a,0x55,0x56,0x80,0x06,0xa7,0x8a,0x50,0x36,0x30,
-0x02,0x71,0x00,0x04,0x00,0x08,0x89,0x98,0x8c,0x36,0x63,0x69,0x40,0x86,0x36,0xb0,
-0x05,0xc6,0x67,0x01,0x98,0x88,0x7a,0x56,0x69,0x56,0x90,0x60,0x54,0x86,0x60,0x00,
-0xd1,0x10,0x00,0x87,0xa7,0x98,0x77,0x36,0xb6,0xa8,0x62,0x08,0x77,0x77,0x10,0x07,
-0xb3,0x08,0x87,0x88,0x80,0x00,0x90,0x94,0x93,0x59,0x20,0x77,0xcd,0x08,0x11,0x27,
-0x04,0x00,0xe2,0x79,0x99,0xac,0x93,0x04,0x00,0x27,0x00,0x05,0x70,0x27,0x00,0x00,
-0x90,0x14,0x00,0x35,0x00,0x09,0xa4,0xc1,0x10,0xf2,0x0d,0x5a,0xa7,0x00,0x90,0x32,
-0x46,0x99,0xd6,0x0a,0x91,0x30,0x90,0x04,0xb0,0x81,0x90,0x07,0xc1,0x16,0x90,0x48,
-0x15,0x00,0x90,0x20,0x00,0x08,0x90,0x50,0x06,0xf3,0x0e,0x00,0x80,0x0c,0x99,0x00,
-0x80,0x0b,0x7a,0x99,0xd6,0x0b,0x69,0x40,0x80,0x4c,0x8a,0x44,0x80,0x01,0x99,0x03,
-0x80,0x1a,0x18,0x00,0x80,0x41,0x67,0x08,0x74,0x06,0xf4,0x0f,0x35,0x00,0x80,0x85,
-0xa8,0xc2,0x88,0x94,0x6b,0x60,0x00,0x97,0x93,0x70,0x88,0xaa,0x88,0xc5,0x70,0x84,
-0x20,0x80,0x80,0x80,0x90,0x80,0x70,0x80,0x18,0x60,0x6d,0x00,0xf0,0x2b,0x57,0x75,
-0x00,0x90,0x3b,0x86,0x00,0x90,0x7b,0x8b,0x98,0xd3,0x2a,0x86,0x20,0x90,0x24,0x93,
-0x63,0x90,0x28,0xb6,0x04,0x90,0x04,0xa8,0x10,0x90,0x77,0x42,0x08,0x60,0x31,0x05,
-0x04,0x10,0x07,0x59,0xc9,0x71,0x68,0x3a,0x77,0x90,0x08,0x39,0x55,0x90,0x57,0x8b,
-0xaa,0x92,0x67,0x78,0x9d,0x82,0x03,0x60,0x4b,0x13,0x12,0x77,0x17,0x08,0x00,0x07,
-0x07,0xf1,0x0c,0x50,0x90,0x80,0x07,0x20,0x90,0x91,0x0b,0x00,0x90,0x28,0x45,0x00,
-0x90,0x0b,0x00,0x00,0x90,0x01,0x00,0x4a,0x60,0x00,0x09,0x99,0x99,0xb0,0x1c,0x07,
-0x32,0x99,0xb9,0x90,0xab,0x11,0x10,0x28,0xb6,0x02,0xf1,0x12,0x91,0x40,0x00,0x00,
-0x43,0x0c,0x88,0x88,0xc0,0x0c,0x88,0x8c,0x90,0x09,0x68,0xc4,0x00,0x09,0x47,0xd8,
-0x60,0x08,0x33,0xb6,0x82,0x46,0x98,0xb2,0x12,0x80,0x00,0xa8,0x93,0xbc,0x06,0xf1,
-0x28,0x77,0x77,0x70,0x0a,0x88,0x88,0x50,0x0b,0x77,0x77,0x80,0x08,0x37,0x74,0x90,
-0x07,0x80,0x08,0x90,0x52,0x88,0x75,0x90,0x40,0x00,0x06,0x90,0x0b,0x88,0x88,0xc1,
-0x0b,0x78,0x68,0xa1,0x09,0x7c,0x7b,0x92,0x09,0x09,0x09,0x00,0x0a,0x8c,0x8c,0x84,
-0x54,0x37,0x09,0x00,0x71,0x90,0x09,0x00,0x1c,0x00,0x70,0x8d,0x8d,0x80,0x09,0x8c,
-0x8c,0x82,0x18,0x00,0xf1,0x00,0x27,0x53,0x46,0x80,0x72,0x79,0x76,0x82,0x20,0x31,
-0x00,0x12,0x08,0x9a,0xb9,0xf3,0x14,0x08,0x04,0x00,0x10,0x39,0xcc,0x03,0xd0,0x22,
-0x00,0x00,0x00,0x73,0x00,0x00,0x58,0xd8,0x88,0x81,0x00,0x90,0x38,0x03,0x11,0xd9,
-0xb0,0x00,0xf0,0x17,0x75,0x00,0x90,0x00,0x53,0x99,0xd9,0x93,0x00,0x50,0x04,0x20,
-0x07,0xba,0x9c,0x83,0x03,0x59,0x85,0x50,0x01,0x3b,0x33,0x30,0x28,0xbb,0x88,0x86,
-0x02,0xa7,0x99,0x70,0x28,0x87,0xaa,0x75,0x00,0x00,0xe7,0x15,0x72,0x99,0x90,0x02,
-0x00,0x00,0x90,0x0b,0x08,0x09,0x20,0x60,0x09,0x48,0x04,0xf1,0x14,0x00,0x00,0x18,
-0x07,0xa9,0x99,0xb2,0x04,0x20,0x06,0x10,0x01,0x8d,0xd5,0x00,0x29,0x77,0x06,0x40,
-0x68,0xd8,0x88,0x82,0x09,0xb9,0xa8,0x50,0x78,0x33,0x50,0x90,0x05,0x33,0x57,0x70,
-0x28,0x03,0xf0,0x0c,0x88,0x43,0x80,0x2a,0xcc,0xba,0xc6,0x09,0x2a,0xa3,0xa6,0x19,
-0x66,0x66,0x74,0x1b,0xbb,0xcb,0xa9,0x05,0x31,0x70,0x90,0x05,0x31,0x76,0x90,0xa8,
-0x07,0xf0,0x0d,0x02,0x50,0x91,0x70,0x09,0xb9,0xca,0xa4,0x07,0x67,0x77,0x37,0x01,
-0x91,0x16,0x41,0x00,0x45,0xb5,0x10,0x08,0x98,0xd8,0xd0,0x08,0x00,0x94,0xb0,0x7c,
-0x01,0x10,0x06,0xab,0x03,0xf0,0x2e,0x19,0x99,0xb2,0x7b,0xc8,0x44,0x82,0x76,0x99,
-0xef,0xe2,0x76,0x96,0x65,0xb0,0x76,0x96,0x76,0xb0,0x06,0x16,0x54,0xa0,0x06,0x16,
-0x87,0xb0,0x07,0x00,0x08,0x00,0x18,0x20,0x0b,0x84,0x7a,0xa5,0x98,0xb0,0x77,0x65,
-0x86,0xc0,0x77,0x65,0x86,0xb0,0x57,0x65,0x97,0xc0,0x07,0x01,0x71,0x70,0x07,0x0a,
-0x10,0x84,0x05,0x20,0x4a,0x10,0xf0,0x17,0x88,0x85,0x7a,0xc4,0x85,0x93,0x75,0x92,
-0x87,0x82,0x75,0x97,0x7a,0x76,0x75,0x99,0x6b,0x68,0x05,0x29,0x08,0x08,0x05,0x29,
-0x77,0x78,0x00,0x90,0x35,0x00,0x57,0xb7,0x99,0x72,0x0b,0x88,0x89,0x70,0x04,0x00,
-0xf0,0x01,0x46,0xa8,0x66,0x62,0x7d,0xdc,0xce,0xb3,0x48,0x08,0x06,0x42,0x08,0x08,
-0x29,0x10,0x47,0x16,0x81,0x02,0x61,0x71,0x90,0x00,0x71,0x75,0x10,0x4c,0x01,0x03,
-0x75,0x0b,0x00,0x04,0x00,0xf3,0x12,0x03,0x33,0x54,0x20,0x08,0x63,0x79,0x81,0x1a,
-0x63,0x88,0x62,0x0b,0x97,0xab,0x95,0x28,0xc8,0xc8,0xb6,0x03,0xa0,0x56,0x70,0x08,
-0x66,0x3f,0x05,0x28,0x07,0x74,0xa8,0x00,0x7f,0x0c,0xf2,0x0b,0x0a,0x88,0xb8,0x85,
-0x09,0x47,0x78,0x70,0x09,0x06,0x78,0x00,0x09,0x88,0xca,0x94,0x17,0x00,0x90,0x90,
-0x54,0x00,0x90,0x10,0x70,0x08,0x4a,0x16,0x00,0x48,0x04,0xf3,0x2d,0x0b,0x8a,0x9a,
-0x83,0x0a,0x7c,0x7c,0x72,0x09,0x09,0x1a,0x00,0x08,0x06,0x66,0x00,0x27,0x9c,0x7b,
-0x50,0x63,0x08,0xb8,0x00,0x52,0x74,0x14,0x82,0x00,0x00,0x70,0x00,0x0c,0x79,0x89,
-0x84,0x09,0x68,0x78,0x00,0x09,0x8c,0x7c,0xa6,0x0a,0x76,0x8a,0x70,0x19,0x94,0x71,
-0xa0,0x46,0x86,0x75,0xa0,0x62,0x42,0x97,0x16,0x45,0x00,0xf2,0x0e,0x51,0x5b,0x56,
-0x8c,0x30,0x09,0x04,0x09,0x10,0x29,0xa8,0x0b,0x73,0x23,0x98,0x09,0x00,0x0c,0x48,
-0x8c,0x84,0x0c,0x80,0x00,0x00,0x74,0x3a,0x99,0x84,0x24,0x00,0xf2,0x0d,0x17,0x00,
-0x39,0xb4,0x8b,0xa3,0x07,0x37,0x8b,0xa7,0x08,0xb5,0x8b,0x81,0x24,0x95,0x8b,0x72,
-0x0b,0x57,0x8b,0x75,0x09,0x70,0x01,0x00,0x63,0x18,0x95,0x0c,0xc1,0x09,0xca,0x9d,
-0x94,0x00,0x62,0x09,0x00,0x28,0xba,0x8d,0x87,0x46,0x0b,0x94,0xa0,0x09,0x00,0x05,
-0x70,0x09,0x00,0x1a,0x00,0x75,0x0d,0xd3,0x46,0x90,0x00,0x00,0x36,0x43,0x29,0x99,
-0xac,0x97,0x09,0x99,0x58,0x6a,0x0b,0xb0,0x0a,0x01,0x00,0xa8,0x76,0x38,0x19,0x51,
-0x00,0xa8,0x00,0x8e,0x08,0xf1,0x07,0x98,0x09,0x05,0x89,0x80,0x90,0x90,0x00,0x09,
-0x0b,0x89,0x60,0x90,0x00,0x18,0x09,0x00,0x03,0x60,0x90,0x08,0xb2,0x41,0x00,0xf3,
-0x0e,0x18,0x8a,0x38,0x89,0x09,0x67,0x28,0x66,0x0c,0x86,0x4a,0x85,0x08,0x19,0x17,
-0x09,0x01,0x99,0x03,0x89,0x3a,0x79,0x4a,0x68,0x01,0x95,0x04,0x84,0x00,0x34,0x14,
-0xf1,0x0c,0x48,0xc0,0x90,0x40,0x15,0xa7,0x78,0x91,0x64,0x25,0x7c,0x80,0x79,0xa8,
-0x09,0x80,0x00,0x85,0x7c,0x90,0x00,0x90,0x09,0x90,0x08,0x89,0x9a,0x49,0x04,0xf4,
-0x0c,0x58,0x9b,0xa8,0xa1,0x57,0x7a,0xba,0xb0,0x80,0x09,0x58,0xa0,0x68,0x6a,0x79,
-0xb0,0x00,0x85,0x8a,0x60,0x01,0x87,0x9a,0x73,0x2a,0x30,0x25,0xfb,0x03,0xf5,0x0d,
-0x11,0x2b,0xac,0x72,0x91,0x05,0x28,0x16,0x02,0x3b,0xac,0x80,0x93,0x07,0x18,0x09,
-0x20,0x08,0x08,0x00,0x28,0x0a,0x08,0x03,0xa0,0x44,0x08,0x48,0x64,0x06,0xf0,0x28,
-0x0d,0xcc,0xa2,0x81,0x09,0x86,0x75,0x02,0x27,0x98,0x71,0x92,0x09,0x66,0x78,0x10,
-0x07,0x97,0x50,0x28,0x09,0x76,0x42,0xa0,0x24,0xa0,0x69,0x00,0x05,0x40,0x35,0x00,
-0x48,0x08,0xab,0x81,0x23,0x61,0x56,0x11,0x2e,0x37,0x78,0xb4,0x7a,0x38,0x89,0xc4,
-0x09,0x06,0x01,0x70,0x09,0x02,0x71,0x6d,0x17,0xf1,0x4a,0x50,0x00,0x10,0x00,0x00,
-0x19,0x1b,0x88,0xb0,0x33,0x5a,0x66,0xb0,0x2d,0x0b,0x88,0xb0,0x69,0x09,0x43,0x41,
-0x09,0x09,0x0b,0x60,0x09,0x09,0x26,0x70,0x09,0x0c,0x70,0x65,0x03,0x20,0x50,0x00,
-0x27,0x06,0x44,0x40,0x23,0x78,0xc4,0x50,0x2d,0x3c,0xa7,0xa4,0x49,0x05,0xb7,0x61,
-0x08,0x58,0x85,0x40,0x08,0x01,0xbc,0x10,0x08,0x59,0x21,0x86,0x01,0x20,0x00,0x00,
-0x19,0x29,0x99,0x97,0x43,0x69,0x37,0x81,0x1c,0x19,0x64,0x90,0x6a,0x04,0x26,0x24,
-0x08,0x08,0x8c,0x83,0x69,0x09,0xf1,0x54,0x48,0x8c,0x87,0x00,0x10,0x20,0x20,0x08,
-0x15,0x41,0x80,0x52,0x5a,0x98,0xa1,0x0b,0x63,0x28,0x16,0x7b,0x06,0x09,0x00,0x08,
-0x0b,0x0c,0x72,0x08,0x2b,0x58,0x00,0x08,0x70,0x69,0x85,0x03,0x24,0x20,0x00,0x37,
-0x0c,0x87,0x74,0x24,0xab,0x66,0xa0,0x3e,0x08,0x66,0xb0,0x59,0x04,0xc6,0x60,0x08,
-0x09,0xb7,0xa0,0x08,0x22,0x9c,0x10,0x08,0x49,0x54,0x95,0x04,0x11,0x35,0x60,0x36,
-0x2a,0x49,0x00,0x27,0x6b,0x7b,0x74,0x4d,0x27,0x8b,0x80,0x38,0x26,0xb6,0xb0,0x08,
-0x36,0xb6,0xb0,0x08,0x63,0xc7,0xc0,0x08,0x70,0x80,0x80,0x64,0x07,0xf4,0x10,0x07,
-0x05,0x20,0x64,0x67,0x68,0x10,0x18,0x8a,0x9a,0x97,0x4b,0x58,0x8e,0x63,0x58,0x37,
-0x55,0xb0,0x08,0x62,0x83,0xa0,0x08,0x80,0xba,0xa0,0x08,0x70,0x45,0x16,0x28,0x01,
-0xf0,0x06,0x05,0x53,0x48,0x32,0x37,0x15,0x78,0x53,0x32,0x6a,0xaa,0x85,0x0c,0x0b,
-0xaa,0x85,0x7b,0x27,0x77,0x75,0x08,0x69,0x34,0x92,0x26,0x65,0x72,0x08,0x61,0xa7,
-0x55,0x00,0x18,0xe9,0x1a,0xf2,0x04,0x02,0x90,0x10,0x40,0x08,0x90,0x00,0xa0,0x45,
-0x90,0x00,0x63,0x61,0x90,0x08,0x23,0x00,0x69,0x99,0x41,0x00,0xf1,0x0b,0x49,0x02,
-0x40,0x00,0x22,0x5a,0x10,0x06,0x90,0x67,0x20,0x45,0x94,0x80,0xa0,0x80,0xa8,0x00,
-0x73,0x19,0xd0,0x08,0x00,0x51,0x69,0x99,0xdf,0x16,0xf5,0x0d,0x19,0x38,0xd9,0x80,
-0x69,0x80,0x90,0x90,0x79,0x10,0x90,0x90,0x09,0x39,0xeb,0x96,0x09,0x00,0x9a,0x00,
-0x09,0x07,0x36,0x80,0x09,0x55,0x00,0x67,0xc2,0x0f,0xf0,0x18,0xab,0x9a,0xb0,0x36,
-0x55,0x82,0x90,0x06,0x74,0x70,0x90,0x01,0x09,0x18,0x60,0x02,0x34,0x50,0x30,0x45,
-0x90,0x63,0x91,0x40,0x98,0x8a,0x13,0x00,0x14,0x00,0x00,0x03,0x81,0x1a,0x30,0x08,
-0x87,0x66,0x80,0xa0,0x06,0xf0,0x14,0x07,0x78,0x77,0x70,0x00,0x0a,0x40,0x00,0x26,
-0x90,0x81,0x82,0x61,0xa8,0x8a,0x26,0x00,0x72,0x10,0x00,0x05,0x86,0xa6,0x00,0x3a,
-0x77,0x98,0x70,0x03,0x77,0x77,0x90,0x05,0x77,0x77,0x59,0x04,0xf2,0x1a,0x20,0x17,
-0x81,0x92,0x82,0x52,0x98,0x8a,0x15,0x09,0x00,0x80,0x00,0x1a,0x48,0xc8,0x85,0x69,
-0x83,0x53,0x10,0x69,0x17,0x58,0x34,0x09,0x09,0x88,0x61,0x09,0x46,0x2c,0x50,0x09,
-0x60,0x46,0x90,0x09,0x04,0x80,0x36,0x29,0x0a,0x71,0x00,0x00,0x08,0x77,0x7b,0x00,
-0x09,0x04,0x00,0xf1,0x17,0x7c,0x00,0x07,0x78,0x7a,0x00,0x00,0x09,0x10,0x10,0x36,
-0x81,0x53,0xa0,0x60,0xa8,0x88,0x40,0x08,0x13,0x77,0x31,0x09,0x45,0x88,0x52,0x78,
-0x76,0x99,0x61,0x78,0x47,0x77,0x74,0x18,0x0c,0x77,0xc0,0xfe,0x15,0xf2,0x18,0x0c,
-0x66,0xc0,0x08,0x08,0x04,0xa0,0x00,0x01,0x40,0x00,0x06,0xb8,0x7c,0x81,0x17,0x88,
-0x79,0x74,0x03,0x96,0x66,0x90,0x03,0x96,0x66,0xa0,0x01,0x6a,0x86,0x40,0x07,0x53,
-0x91,0x81,0x16,0x49,0x79,0x15,0x29,0x01,0xf2,0x0f,0x36,0x80,0x0b,0x77,0x8b,0x84,
-0x09,0x66,0x48,0x80,0x07,0xb6,0x79,0x60,0x54,0xb7,0x9c,0x57,0x50,0x02,0x40,0x52,
-0x06,0xa0,0x91,0x90,0x52,0x97,0x79,0x33,0x8c,0x01,0xf0,0x10,0x63,0x70,0x3d,0x7c,
-0x88,0x22,0x08,0x68,0x38,0x83,0x0b,0x5a,0x66,0x71,0x0b,0x5a,0x64,0x04,0x04,0x26,
-0x47,0x81,0x17,0x60,0x81,0x73,0x51,0x87,0x79,0x15,0x08,0xd8,0x01,0xf4,0x0c,0x2b,
-0xbb,0xe0,0x68,0x77,0x66,0x80,0x78,0x49,0xbb,0x86,0x08,0x27,0x77,0x63,0x08,0x2c,
-0x98,0xc0,0x08,0x00,0xbb,0x20,0x08,0x59,0x65,0x95,0x94,0x04,0xf3,0x0e,0x0c,0x9a,
-0xbb,0x75,0x09,0xb8,0xaa,0x62,0x0c,0xb8,0xbc,0x81,0x08,0x72,0xbc,0x83,0x17,0x20,
-0x81,0x00,0x44,0x76,0x26,0x81,0x73,0x37,0x79,0x46,0x00,0xfe,0x08,0xf2,0x2d,0x0b,
-0x99,0x48,0x70,0x0a,0x79,0x5b,0x50,0x2b,0x8a,0x8a,0x73,0x15,0x87,0x78,0x53,0x13,
-0x34,0x35,0x00,0x07,0x71,0x81,0x90,0x42,0x77,0x77,0x34,0x00,0x00,0x94,0x60,0x08,
-0x88,0xd8,0xc5,0x09,0x00,0x81,0x10,0x0c,0x87,0x63,0xa0,0x09,0x09,0x3a,0x50,0x08,
-0x09,0x1d,0x02,0x46,0x83,0xab,0x08,0x80,0x08,0x22,0xb5,0x43,0x00,0xf5,0x2f,0x55,
-0x91,0x18,0x88,0xaa,0x97,0x02,0x22,0x57,0x32,0x0a,0x8c,0x27,0x72,0x08,0x09,0x09,
-0x90,0x05,0x77,0x0c,0x20,0x05,0x89,0xad,0x38,0x14,0x15,0x60,0xa7,0x12,0xa2,0x46,
-0x50,0x26,0xc6,0x55,0x70,0x69,0xb8,0x9b,0x82,0x1c,0x97,0x47,0x60,0x9b,0xa9,0x29,
-0x70,0x1b,0x98,0x1b,0x11,0x1b,0xa9,0x5c,0x25,0x17,0x00,0xa1,0xb2,0xa9,0x03,0xf2,
-0x10,0x80,0x08,0x60,0x36,0xed,0x58,0x62,0x74,0xa6,0x9c,0x83,0x70,0x76,0x18,0x22,
-0x77,0xaa,0x28,0x80,0x77,0x6a,0x07,0x60,0x71,0x46,0x1c,0x67,0x56,0x99,0xa1,0xa4,
-0x39,0x0b,0x40,0x58,0x10,0x88,0x53,0xbf,0x0e,0x13,0x60,0x06,0x10,0x42,0x90,0x00,
-0x04,0x37,0x0e,0x1c,0xf1,0x10,0x00,0x26,0x01,0x53,0x0b,0x62,0x77,0x20,0x0c,0x88,
-0x71,0x00,0x09,0x09,0x89,0xd5,0x0c,0x87,0x80,0x90,0x08,0x00,0x90,0x90,0x36,0x00,
-0x90,0x90,0x61,0x05,0x40,0x78,0x08,0x00,0xa0,0x01,0xf1,0x0d,0x0b,0x88,0x98,0xb0,
-0x0b,0x77,0x77,0xc0,0x09,0x67,0x77,0x71,0x09,0x41,0x85,0x62,0x08,0x16,0x75,0x82,
-0x46,0x98,0xa9,0xa2,0x70,0x06,0x62,0xa1,0x63,0x00,0xb0,0x34,0x68,0x70,0x04,0x44,
-0x90,0x00,0x07,0x89,0xc8,0x83,0xa9,0x08,0x36,0x39,0x99,0xc9,0x74,0x0a,0x22,0x69,
-0x60,0x23,0x13,0x92,0x02,0x22,0x21,0x09,0x07,0x8d,0x83,0x7d,0x90,0xff,0x19,0x53,
-0x4c,0x91,0x09,0x00,0x3a,0x0b,0x1a,0x32,0x4a,0x00,0x9b,0x4b,0x02,0xf2,0x10,0x10,
-0x94,0x10,0x07,0x10,0x91,0x90,0x5c,0x95,0xc9,0x94,0x07,0x12,0x82,0x30,0x3b,0xa1,
-0x46,0x80,0x28,0x10,0x1d,0x10,0x07,0x12,0xbb,0x08,0x3a,0x08,0x12,0xb5,0x24,0x00,
-0xf0,0x01,0x26,0x00,0x07,0x12,0x38,0x31,0x4c,0x84,0x66,0x73,0x07,0x21,0x70,0xa0,
-0x4c,0x70,0xb0,0x10,0x74,0x92,0x60,0x07,0x27,0x8a,0x95,0x2a,0xbc,0x0c,0xf0,0x08,
-0x10,0x00,0x00,0x08,0x19,0x99,0x93,0x3a,0x6a,0x88,0x80,0x07,0x5a,0x00,0x80,0x6c,
+0x29,0x40,0x00,0x00,0x01,0x50,0x00,0x09,0x89,0xd8,0x85,0x08,0xfc,0x02,0x90,0x60,
+0x05,0x40,0x00,0xb7,0xa6,0x00,0x00,0xb2,0x2a,0x08,0xf1,0x36,0x00,0x26,0x00,0x99,
+0x99,0xb3,0x00,0x03,0x30,0x00,0x0a,0x89,0xa8,0x95,0x07,0x08,0x00,0x26,0x18,0x9d,
+0x89,0x96,0x00,0xa1,0x0a,0x00,0x00,0x79,0xb4,0x00,0x01,0x59,0x6a,0x80,0x07,0x30,
+0x00,0x42,0x00,0x05,0x10,0x00,0x69,0x9a,0xa9,0xa1,0x73,0x55,0x55,0x71,0x00,0x22,
+0x22,0x00,0x69,0xba,0xb9,0x92,0x00,0x81,0x71,0x00,0x00,0x90,0x71,0x14,0x59,0x20,
+0x59,0xa8,0x04,0x00,0xa8,0x00,0xf4,0x0d,0x69,0x9b,0x99,0xb0,0x70,0x00,0x00,0x80,
+0x04,0x8d,0x88,0x00,0x08,0x19,0x88,0x30,0x0b,0x29,0x00,0x00,0x28,0x9a,0x00,0x00,
+0x91,0x2b,0x99,0x92,0x24,0x00,0xf2,0x49,0x88,0x88,0x88,0xb1,0x43,0x82,0x48,0x40,
+0x38,0x2b,0x82,0x70,0x05,0x90,0x39,0x20,0x9c,0x98,0x8d,0x92,0x06,0x10,0x09,0x00,
+0x06,0x98,0x8c,0x00,0x00,0x04,0x10,0x00,0x88,0x99,0x99,0xa5,0x6a,0xaa,0xba,0xb5,
+0x06,0x67,0x77,0x20,0x0a,0xaa,0xaa,0x80,0x0a,0x55,0x56,0x80,0x06,0xa7,0x8a,0x50,
+0x36,0x30,0x02,0x71,0x00,0x04,0x00,0x08,0x89,0x98,0x8c,0x36,0x63,0x69,0x40,0x86,
+0x36,0xb0,0x05,0xc6,0x67,0x01,0x98,0x88,0x7a,0x56,0x69,0x56,0x90,0x60,0x54,0x86,
+0x60,0x00,0xd1,0x10,0x00,0x87,0xa7,0x98,0x77,0x36,0xb6,0xa8,0x62,0x08,0x77,0x77,
+0x10,0x07,0xb3,0x08,0x87,0x88,0x80,0x00,0x90,0x94,0x93,0x59,0x20,0x77,0xcd,0x08,
+0x11,0x27,0x04,0x00,0xe2,0x79,0x99,0xac,0x93,0x04,0x00,0x27,0x00,0x05,0x70,0x27,
+0x00,0x00,0x90,0x14,0x00,0x44,0x00,0x09,0xa4,0x00,0xfd,0x03,0xf2,0x0d,0x5a,0xa7,
+0x00,0x90,0x32,0x46,0x99,0xd6,0x0a,0x91,0x30,0x90,0x04,0xb0,0x81,0x90,0x07,0xc1,
+0x16,0x90,0x48,0x15,0x00,0x90,0x20,0x00,0x08,0x90,0x50,0x06,0xf3,0x0e,0x00,0x80,
+0x0c,0x99,0x00,0x80,0x0b,0x7a,0x99,0xd6,0x0b,0x69,0x40,0x80,0x4c,0x8a,0x44,0x80,
+0x01,0x99,0x03,0x80,0x1a,0x18,0x00,0x80,0x41,0x67,0x08,0x74,0x06,0xf4,0x0f,0x35,
+0x00,0x80,0x85,0xa8,0xc2,0x88,0x94,0x6b,0x60,0x00,0x97,0x93,0x70,0x88,0xaa,0x88,
+0xc5,0x70,0x84,0x20,0x80,0x80,0x80,0x90,0x80,0x70,0x80,0x18,0x60,0x6d,0x00,0xf2,
+0x30,0x57,0x75,0x00,0x90,0x3b,0x86,0x00,0x90,0x7b,0x8b,0x98,0xd3,0x2a,0x86,0x20,
+0x90,0x24,0x93,0x63,0x90,0x28,0xb6,0x04,0x90,0x04,0xa8,0x10,0x90,0x77,0x42,0x08,
+0x60,0x31,0x05,0x04,0x10,0x07,0x59,0xc9,0x71,0x68,0x3a,0x77,0x90,0x08,0x39,0x55,
+0x90,0x57,0x8b,0xaa,0x92,0x67,0x78,0x9d,0x82,0x03,0x60,0x09,0x00,0x00,0x60,0x77,
+0x17,0x08,0x00,0x07,0x07,0xf1,0x0c,0x50,0x90,0x80,0x07,0x20,0x90,0x91,0x0b,0x00,
+0x90,0x28,0x45,0x00,0x90,0x0b,0x00,0x00,0x90,0x01,0x00,0x4a,0x60,0x00,0x09,0x99,
+0x99,0xb0,0x1c,0x07,0xa0,0x99,0xb9,0x90,0x09,0x00,0x90,0x00,0x09,0x00,0x28,0xb6,
+0x02,0xf1,0x12,0x91,0x40,0x00,0x00,0x43,0x0c,0x88,0x88,0xc0,0x0c,0x88,0x8c,0x90,
+0x09,0x68,0xc4,0x00,0x09,0x47,0xd8,0x60,0x08,0x33,0xb6,0x82,0x46,0x98,0xb2,0x12,
+0x80,0x00,0xa8,0x93,0xbc,0x06,0xf1,0x28,0x77,0x77,0x70,0x0a,0x88,0x88,0x50,0x0b,
+0x77,0x77,0x80,0x08,0x37,0x74,0x90,0x07,0x80,0x08,0x90,0x52,0x88,0x75,0x90,0x40,
+0x00,0x06,0x90,0x0b,0x88,0x88,0xc1,0x0b,0x78,0x68,0xa1,0x09,0x7c,0x7b,0x92,0x09,
+0x09,0x09,0x00,0x0a,0x8c,0x8c,0x84,0x54,0x37,0x09,0x00,0x71,0x90,0x09,0x00,0x1c,
+0x00,0x70,0x8d,0x8d,0x80,0x09,0x8c,0x8c,0x82,0x18,0x00,0xf1,0x01,0x27,0x53,0x46,
+0x80,0x72,0x79,0x76,0x82,0x20,0x31,0x00,0x12,0x08,0x9a,0xb9,0x93,0xc4,0x03,0x07,
+0x04,0x00,0x10,0x39,0xcc,0x03,0xd0,0x22,0x00,0x00,0x00,0x73,0x00,0x00,0x58,0xd8,
+0x88,0x81,0x00,0x90,0x38,0x03,0x11,0xd9,0xb0,0x00,0xf0,0x15,0x75,0x00,0x90,0x00,
+0x53,0x99,0xd9,0x93,0x00,0x50,0x04,0x20,0x07,0xba,0x9c,0x83,0x03,0x59,0x85,0x50,
+0x01,0x3b,0x33,0x30,0x28,0xbb,0x88,0x86,0x02,0xa7,0x99,0x70,0x28,0x87,0xaa,0x75,
+0xac,0x00,0x92,0x19,0x99,0x99,0x90,0x02,0x00,0x00,0x90,0x0b,0x08,0x09,0x20,0x60,
+0x09,0x48,0x04,0xf1,0x14,0x00,0x00,0x18,0x07,0xa9,0x99,0xb2,0x04,0x20,0x06,0x10,
+0x01,0x8d,0xd5,0x00,0x29,0x77,0x06,0x40,0x68,0xd8,0x88,0x82,0x09,0xb9,0xa8,0x50,
+0x78,0x33,0x50,0x90,0x05,0x33,0x57,0x70,0x28,0x03,0xf0,0x0c,0x88,0x43,0x80,0x2a,
+0xcc,0xba,0xc6,0x09,0x2a,0xa3,0xa6,0x19,0x66,0x66,0x74,0x1b,0xbb,0xcb,0xa9,0x05,
+0x31,0x70,0x90,0x05,0x31,0x76,0x90,0xa8,0x07,0xf0,0x0d,0x02,0x50,0x91,0x70,0x09,
+0xb9,0xca,0xa4,0x07,0x67,0x77,0x37,0x01,0x91,0x16,0x41,0x00,0x45,0xb5,0x10,0x08,
+0x98,0xd8,0xd0,0x08,0x00,0x94,0xb0,0x7c,0x01,0x10,0x06,0xab,0x03,0xf0,0x58,0x19,
+0x99,0xb2,0x7b,0xc8,0x44,0x82,0x76,0x99,0xef,0xe2,0x76,0x96,0x65,0xb0,0x76,0x96,
+0x76,0xb0,0x06,0x16,0x54,0xa0,0x06,0x16,0x87,0xb0,0x07,0x00,0x08,0x00,0x18,0x20,
+0x0b,0x84,0x7a,0xa5,0x98,0xb0,0x77,0x65,0x86,0xc0,0x77,0x65,0x86,0xb0,0x57,0x65,
+0x97,0xc0,0x07,0x01,0x71,0x70,0x07,0x0a,0x10,0x84,0x05,0x20,0x00,0x00,0x05,0x25,
+0x88,0x85,0x7a,0xc4,0x85,0x93,0x75,0x92,0x87,0x82,0x75,0x97,0x7a,0x76,0x75,0x99,
+0x6b,0x68,0x05,0x29,0x08,0x08,0x05,0x29,0x77,0x78,0x00,0x90,0x35,0x00,0x57,0xb7,
+0x99,0x72,0x0b,0x88,0x89,0x70,0x04,0x00,0xf1,0x0d,0x46,0xa8,0x66,0x62,0x7d,0xdc,
+0xce,0xb3,0x48,0x08,0x06,0x42,0x08,0x08,0x29,0x10,0x08,0x9a,0xc9,0x93,0x02,0x61,
+0x71,0x90,0x00,0x71,0x75,0x10,0x4c,0x01,0x03,0x75,0x0b,0x00,0x04,0x00,0xf3,0x12,
+0x03,0x33,0x54,0x20,0x08,0x63,0x79,0x81,0x1a,0x63,0x88,0x62,0x0b,0x97,0xab,0x95,
+0x28,0xc8,0xc8,0xb6,0x03,0xa0,0x56,0x70,0x08,0x66,0x3f,0x05,0x28,0x07,0x74,0xa8,
+0x00,0x7f,0x0c,0xf1,0x0c,0x0a,0x88,0xb8,0x85,0x09,0x47,0x78,0x70,0x09,0x06,0x78,
+0x00,0x09,0x88,0xca,0x94,0x17,0x00,0x90,0x90,0x54,0x00,0x90,0x10,0x70,0x08,0xa0,
+0x23,0x00,0x00,0x48,0x04,0xf3,0x2d,0x0b,0x8a,0x9a,0x83,0x0a,0x7c,0x7c,0x72,0x09,
+0x09,0x1a,0x00,0x08,0x06,0x66,0x00,0x27,0x9c,0x7b,0x50,0x63,0x08,0xb8,0x00,0x52,
+0x74,0x14,0x82,0x00,0x00,0x70,0x00,0x0c,0x79,0x89,0x84,0x09,0x68,0x78,0x00,0x09,
+0x8c,0x7c,0xa6,0x0a,0x76,0x8a,0x70,0x19,0x94,0x71,0xa0,0x46,0x86,0x75,0xa0,0x62,
+0x42,0x97,0x16,0x45,0x00,0xf2,0x0e,0x51,0x5b,0x56,0x8c,0x30,0x09,0x04,0x09,0x10,
+0x29,0xa8,0x0b,0x73,0x23,0x98,0x09,0x00,0x0c,0x48,0x8c,0x84,0x0c,0x80,0x00,0x00,
+0x74,0x3a,0x99,0x84,0x24,0x00,0xf2,0x0d,0x17,0x00,0x39,0xb4,0x8b,0xa3,0x07,0x37,
+0x8b,0xa7,0x08,0xb5,0x8b,0x81,0x24,0x95,0x8b,0x72,0x0b,0x57,0x8b,0x75,0x09,0x70,
+0x01,0x00,0x63,0x18,0x95,0x0c,0xc1,0x09,0xca,0x9d,0x94,0x00,0x62,0x09,0x00,0x28,
+0xba,0x8d,0x87,0x46,0x0b,0x94,0xa0,0x09,0x00,0x05,0x70,0x09,0x00,0x1a,0x00,0x75,
+0x0d,0xd3,0x46,0x90,0x00,0x00,0x36,0x43,0x29,0x99,0xac,0x97,0x09,0x99,0x58,0x6a,
+0x0b,0xb0,0x0a,0x01,0x00,0xa8,0x76,0x38,0x19,0x51,0x00,0xa8,0x00,0x8e,0x08,0xf1,
+0x07,0x98,0x09,0x05,0x89,0x80,0x90,0x90,0x00,0x09,0x0b,0x89,0x60,0x90,0x00,0x18,
+0x09,0x00,0x03,0x60,0x90,0x08,0xb2,0x41,0x00,0xf3,0x0c,0x18,0x8a,0x38,0x89,0x09,
+0x67,0x28,0x66,0x0c,0x86,0x4a,0x85,0x08,0x19,0x17,0x09,0x01,0x99,0x03,0x89,0x3a,
+0x79,0x4a,0x68,0x01,0x95,0x04,0xa4,0x00,0xf1,0x0e,0x20,0x00,0x48,0xc0,0x90,0x40,
+0x15,0xa7,0x78,0x91,0x64,0x25,0x7c,0x80,0x79,0xa8,0x09,0x80,0x00,0x85,0x7c,0x90,
+0x00,0x90,0x09,0x90,0x08,0x89,0x9a,0x49,0x04,0xf4,0x0c,0x58,0x9b,0xa8,0xa1,0x57,
+0x7a,0xba,0xb0,0x80,0x09,0x58,0xa0,0x68,0x6a,0x79,0xb0,0x00,0x85,0x8a,0x60,0x01,
+0x87,0x9a,0x73,0x2a,0x30,0x25,0xfb,0x03,0xf5,0x0d,0x11,0x2b,0xac,0x72,0x91,0x05,
+0x28,0x16,0x02,0x3b,0xac,0x80,0x93,0x07,0x18,0x09,0x20,0x08,0x08,0x00,0x28,0x0a,
+0x08,0x03,0xa0,0x44,0x08,0x48,0x64,0x06,0xf1,0x85,0x0d,0xcc,0xa2,0x81,0x09,0x86,
+0x75,0x02,0x27,0x98,0x71,0x92,0x09,0x66,0x78,0x10,0x07,0x97,0x50,0x28,0x09,0x76,
+0x42,0xa0,0x24,0xa0,0x69,0x00,0x05,0x40,0x35,0x00,0x48,0x08,0xab,0x81,0x23,0x61,
+0x56,0x11,0x2e,0x37,0x78,0xb4,0x7a,0x38,0x89,0xc4,0x09,0x06,0x01,0x70,0x09,0x02,
+0x71,0x70,0x09,0x00,0x29,0x50,0x00,0x10,0x00,0x00,0x19,0x1b,0x88,0xb0,0x33,0x5a,
+0x66,0xb0,0x2d,0x0b,0x88,0xb0,0x69,0x09,0x43,0x41,0x09,0x09,0x0b,0x60,0x09,0x09,
+0x26,0x70,0x09,0x0c,0x70,0x65,0x03,0x20,0x50,0x00,0x27,0x06,0x44,0x40,0x23,0x78,
+0xc4,0x50,0x2d,0x3c,0xa7,0xa4,0x49,0x05,0xb7,0x61,0x08,0x58,0x85,0x40,0x08,0x01,
+0xbc,0x10,0x08,0x59,0x21,0x86,0x01,0x20,0x00,0x00,0x19,0x29,0x99,0x97,0x43,0x69,
+0x37,0x81,0x1c,0x19,0x64,0x90,0x6a,0x04,0x26,0x24,0x08,0x08,0x8c,0x83,0x69,0x09,
+0xf0,0x34,0x48,0x8c,0x87,0x00,0x10,0x20,0x20,0x08,0x15,0x41,0x80,0x52,0x5a,0x98,
+0xa1,0x0b,0x63,0x28,0x16,0x7b,0x06,0x09,0x00,0x08,0x0b,0x0c,0x72,0x08,0x2b,0x58,
+0x00,0x08,0x70,0x69,0x85,0x03,0x24,0x20,0x00,0x37,0x0c,0x87,0x74,0x24,0xab,0x66,
+0xa0,0x3e,0x08,0x66,0xb0,0x59,0x04,0xc6,0x60,0x08,0x09,0xb7,0xa0,0x08,0x22,0x9c,
+0x10,0x08,0x49,0x54,0x95,0xf3,0x36,0x04,0x11,0x35,0x60,0x36,0x2a,0x49,0x00,0x27,
+0x6b,0x7b,0x74,0x4d,0x27,0x8b,0x80,0x38,0x26,0xb6,0xb0,0x08,0x36,0xb6,0xb0,0x08,
+0x63,0xc7,0xc0,0x08,0x70,0x80,0x80,0x00,0x00,0x00,0x00,0x08,0x07,0x05,0x20,0x64,
+0x67,0x68,0x10,0x18,0x8a,0x9a,0x97,0x4b,0x58,0x8e,0x63,0x58,0x37,0x55,0xb0,0x08,
+0x62,0x83,0xa0,0x08,0x80,0xba,0xa0,0x08,0x70,0x45,0x16,0x00,0x01,0x00,0xf2,0x2c,
+0x05,0x53,0x48,0x32,0x37,0x15,0x78,0x53,0x32,0x6a,0xaa,0x85,0x0c,0x0b,0xaa,0x85,
+0x7b,0x27,0x77,0x75,0x08,0x00,0x23,0x00,0x08,0x26,0x65,0x72,0x08,0x61,0xa7,0x55,
+0x00,0x18,0x00,0x00,0x00,0x03,0x90,0x00,0x02,0x90,0x10,0x40,0x08,0x90,0x00,0xa0,
+0x45,0x90,0x00,0x63,0x61,0x90,0x08,0x23,0x00,0x69,0x99,0x41,0x00,0xf1,0x2c,0x49,
+0x02,0x40,0x00,0x22,0x5a,0x10,0x06,0x90,0x67,0x20,0x45,0x94,0x80,0xa0,0x80,0xa8,
+0x00,0x73,0x19,0xd0,0x08,0x00,0x51,0x69,0x99,0x00,0x09,0x00,0x90,0x00,0x19,0x38,
+0xd9,0x80,0x69,0x80,0x90,0x90,0x79,0x10,0x90,0x90,0x09,0x39,0xeb,0x96,0x09,0x00,
+0x9a,0x00,0x09,0x07,0x36,0x80,0x09,0x55,0x00,0x67,0x40,0x00,0xf1,0x70,0x60,0x00,
+0x00,0x06,0xab,0x9a,0xb0,0x36,0x55,0x82,0x90,0x06,0x74,0x70,0x90,0x01,0x09,0x18,
+0x60,0x02,0x34,0x50,0x30,0x45,0x90,0x63,0x91,0x40,0x98,0x8a,0x13,0x00,0x14,0x00,
+0x00,0x03,0x81,0x1a,0x30,0x08,0x87,0x66,0x80,0x08,0x77,0x77,0x90,0x07,0x78,0x77,
+0x70,0x00,0x0a,0x40,0x00,0x26,0x90,0x81,0x82,0x61,0xa8,0x8a,0x26,0x00,0x72,0x10,
+0x00,0x05,0x86,0xa6,0x00,0x3a,0x77,0x98,0x70,0x03,0x77,0x77,0x90,0x05,0x77,0x77,
+0x90,0x00,0x06,0x10,0x20,0x17,0x81,0x92,0x82,0x52,0x98,0x8a,0x15,0x09,0x00,0x80,
+0x00,0x1a,0x48,0xc8,0x85,0x69,0x83,0x53,0x10,0x69,0x17,0x58,0x34,0x09,0x09,0x88,
+0x61,0x09,0x46,0x2c,0x50,0x09,0x60,0x46,0x90,0x09,0x04,0x80,0x36,0x84,0x00,0x81,
+0x07,0x00,0x00,0x08,0x77,0x7b,0x00,0x09,0x04,0x00,0xf2,0x43,0x7c,0x00,0x07,0x78,
+0x7a,0x00,0x00,0x09,0x10,0x10,0x36,0x81,0x53,0xa0,0x60,0xa8,0x88,0x40,0x08,0x13,
+0x77,0x31,0x09,0x45,0x88,0x52,0x78,0x76,0x99,0x61,0x78,0x47,0x77,0x74,0x18,0x0c,
+0x77,0xc0,0x08,0x0b,0x66,0xb0,0x08,0x0c,0x66,0xc0,0x08,0x08,0x04,0xa0,0x00,0x01,
+0x40,0x00,0x06,0xb8,0x7c,0x81,0x17,0x88,0x79,0x74,0x03,0x96,0x66,0x90,0x03,0x96,
+0x66,0xa0,0x01,0x6a,0x86,0x40,0x07,0x53,0x91,0x81,0x16,0x49,0x79,0x15,0x29,0x01,
+0xf2,0x0f,0x36,0x80,0x0b,0x77,0x8b,0x84,0x09,0x66,0x48,0x80,0x07,0xb6,0x79,0x60,
+0x54,0xb7,0x9c,0x57,0x50,0x02,0x40,0x52,0x06,0xa0,0x91,0x90,0x52,0x97,0x79,0x33,
+0x8c,0x01,0xf0,0x10,0x63,0x70,0x3d,0x7c,0x88,0x22,0x08,0x68,0x38,0x83,0x0b,0x5a,
+0x66,0x71,0x0b,0x5a,0x64,0x04,0x04,0x26,0x47,0x81,0x17,0x60,0x81,0x73,0x51,0x87,
+0x79,0x15,0x08,0xd8,0x01,0xf3,0x0d,0x2b,0xbb,0xe0,0x68,0x77,0x66,0x80,0x78,0x49,
+0xbb,0x86,0x08,0x27,0x77,0x63,0x08,0x2c,0x98,0xc0,0x08,0x00,0xbb,0x20,0x08,0x59,
+0x65,0x95,0x00,0x51,0x01,0xf3,0x0d,0x0c,0x9a,0xbb,0x75,0x09,0xb8,0xaa,0x62,0x0c,
+0xb8,0xbc,0x81,0x08,0x72,0xbc,0x83,0x17,0x20,0x81,0x00,0x44,0x76,0x26,0x81,0x73,
+0x37,0x79,0x46,0xf7,0x01,0xf2,0x2e,0x10,0x0b,0x99,0x48,0x70,0x0a,0x79,0x5b,0x50,
+0x2b,0x8a,0x8a,0x73,0x15,0x87,0x78,0x53,0x13,0x34,0x35,0x00,0x07,0x71,0x81,0x90,
+0x42,0x77,0x77,0x34,0x00,0x00,0x94,0x60,0x08,0x88,0xd8,0xc5,0x09,0x00,0x81,0x10,
+0x0c,0x87,0x63,0xa0,0x09,0x09,0x3a,0x50,0x08,0x09,0x1d,0x02,0x46,0x83,0xab,0x08,
+0x80,0x08,0x22,0xb5,0x43,0x00,0xf4,0x30,0x55,0x91,0x18,0x88,0xaa,0x97,0x02,0x22,
+0x57,0x32,0x0a,0x8c,0x27,0x72,0x08,0x09,0x09,0x90,0x05,0x77,0x0c,0x20,0x05,0x89,
+0xad,0x38,0x14,0x15,0x60,0xa7,0x12,0xa2,0x46,0x50,0x26,0xc6,0x55,0x70,0x69,0xb8,
+0x9b,0x82,0x1c,0x97,0x47,0x60,0x9b,0xa9,0x29,0x70,0x1b,0x98,0x1b,0x11,0x1b,0xa9,
+0x5c,0x25,0x17,0x00,0xa1,0xb2,0x00,0x01,0x00,0xf1,0x10,0x80,0x08,0x60,0x36,0xed,
+0x58,0x62,0x74,0xa6,0x9c,0x83,0x70,0x76,0x18,0x22,0x77,0xaa,0x28,0x80,0x77,0x6a,
+0x07,0x60,0x71,0x46,0x1c,0x67,0x56,0x99,0xa1,0xa4,0x24,0x00,0xf0,0x09,0x02,0x58,
+0x10,0x88,0x53,0x00,0x09,0x88,0x88,0x60,0x90,0x00,0x09,0x0a,0x88,0x88,0xa0,0x90,
+0x00,0x04,0x37,0x00,0x00,0x04,0x1c,0x00,0xf0,0x10,0x26,0x01,0x53,0x0b,0x62,0x77,
+0x20,0x0c,0x88,0x71,0x00,0x09,0x09,0x89,0xd5,0x0c,0x87,0x80,0x90,0x08,0x00,0x90,
+0x90,0x36,0x00,0x90,0x90,0x61,0x05,0x40,0x90,0x40,0x00,0x00,0xa0,0x01,0xf1,0x0d,
+0x0b,0x88,0x98,0xb0,0x0b,0x77,0x77,0xc0,0x09,0x67,0x77,0x71,0x09,0x41,0x85,0x62,
+0x08,0x16,0x75,0x82,0x46,0x98,0xa9,0xa2,0x70,0x06,0x62,0xa1,0x63,0x00,0xf0,0x04,
+0x34,0x68,0x70,0x04,0x44,0x90,0x00,0x07,0x89,0xc8,0x83,0x00,0x00,0x80,0x00,0x39,
+0x99,0xc9,0x97,0x08,0x00,0x01,0x04,0x00,0x21,0x69,0x60,0x47,0x00,0xc0,0x09,0x02,
+0x22,0x21,0x09,0x07,0x8d,0x83,0x7d,0x90,0x09,0x00,0x02,0x00,0x62,0x4c,0x91,0x09,
+0x00,0x3a,0x00,0x0c,0x00,0x32,0x4a,0x00,0x9b,0x4b,0x02,0xf2,0x10,0x10,0x94,0x10,
+0x07,0x10,0x91,0x90,0x5c,0x95,0xc9,0x94,0x07,0x12,0x82,0x30,0x3b,0xa1,0x46,0x80,
+0x28,0x10,0x1d,0x10,0x07,0x12,0xbb,0x08,0x3a,0x08,0x12,0xb5,0x24,0x00,0xf3,0x0e,
+0x26,0x00,0x07,0x12,0x38,0x31,0x4c,0x84,0x66,0x73,0x07,0x21,0x70,0xa0,0x4c,0x70,
+0x90,0x90,0x07,0x10,0x92,0x60,0x07,0x27,0x8a,0x95,0x2a,0x00,0x00,0x48,0x00,0xf0,
+0x07,0x00,0x00,0x08,0x19,0x99,0x93,0x3a,0x6a,0x88,0x80,0x07,0x5a,0x00,0x80,0x6c,
 0x5a,0x88,0xc0,0x07,0x19,0x00,0x00,0x04,0x00,0xf2,0x15,0x3a,0x05,0x88,0x84,0x08,
 0x00,0x39,0x00,0x08,0x00,0xa9,0x20,0x5c,0x98,0x60,0xb2,0x08,0x37,0x77,0x54,0x5c,
 0x85,0x88,0x80,0x08,0x07,0x10,0x90,0x08,0x07,0x98,0xb0,0x2a,0x07,0x10,0x90,0x44,
 0x00,0xf2,0x0e,0x08,0x00,0x07,0x16,0xad,0xa4,0x4c,0x80,0x09,0x00,0x07,0x27,0x77,
 0xc6,0x4c,0x77,0x88,0xc6,0x07,0x11,0x50,0x80,0x07,0x10,0x90,0x80,0x2a,0x00,0x07,
-0x28,0x04,0xf1,0x0e,0x17,0x00,0x30,0x08,0x17,0x99,0x40,0x5c,0x97,0x10,0x44,0x08,
+0x28,0x04,0xf2,0x0f,0x17,0x00,0x30,0x08,0x17,0x99,0x40,0x5c,0x97,0x10,0x44,0x08,
 0x21,0x77,0x60,0x5c,0x77,0x87,0xb0,0x08,0x17,0x76,0xb0,0x08,0x17,0x77,0xc0,0x3a,
-0x07,0x08,0x10,0x00,0x86,0x07,0xf1,0x0d,0x00,0x08,0x28,0x8b,0x86,0x4b,0x77,0x52,
+0x07,0x00,0x24,0x00,0xf1,0x10,0x00,0x18,0x00,0x08,0x28,0x8b,0x86,0x4b,0x77,0x52,
 0x08,0x08,0x18,0xd8,0x85,0x2b,0xa3,0x70,0xa0,0x4a,0x05,0x96,0x50,0x08,0x00,0x5f,
-0x40,0x3a,0x08,0x70,0x48,0x08,0x01,0x9c,0x02,0xf5,0x0c,0x0a,0x88,0x83,0x4c,0x59,
-0x56,0x61,0x08,0x0a,0x99,0x84,0x5d,0x79,0x85,0x43,0x19,0x08,0x81,0xa0,0x08,0x08,
-0x82,0x80,0x29,0x44,0xa7,0x15,0xf0,0x01,0xf5,0x15,0x70,0x00,0x80,0x00,0x08,0x27,
-0x7c,0x76,0x03,0xb7,0x37,0xc7,0x70,0x07,0x47,0x7c,0x8c,0x05,0xc6,0x37,0xc7,0x60,
-0x07,0x07,0x1c,0x74,0x00,0x71,0xa5,0x80,0x00,0x2a,0x63,0x49,0x77,0x00,0x51,0x00,
-0xf1,0x09,0x06,0x99,0xc1,0x3b,0x57,0x99,0xc1,0x08,0x58,0x68,0x66,0x5c,0x49,0x7c,
-0x78,0x08,0x08,0x08,0x52,0x08,0x08,0x08,0xa1,0x2a,0xd8,0x0e,0xf1,0x07,0x84,0x40,
-0x2a,0x56,0xc4,0xa4,0x2a,0x50,0x84,0x40,0x08,0x26,0xc4,0xa4,0x5d,0x80,0x84,0x40,
-0x08,0x08,0xc4,0xa5,0x18,0x00,0xf5,0x34,0x00,0x84,0x40,0x07,0x03,0x46,0x92,0x07,
-0x06,0x64,0x04,0x4c,0x88,0x17,0x36,0x07,0x15,0x16,0x80,0x5c,0x68,0xae,0x96,0x07,
-0x00,0x9b,0x70,0x07,0x2a,0x28,0x66,0x2a,0x12,0x08,0x03,0x07,0x10,0x17,0x00,0x07,
-0x17,0xba,0xb6,0x3c,0x80,0x81,0x80,0x07,0x17,0x99,0x86,0x4c,0x88,0xc8,0x97,0x07,
-0x13,0x70,0x90,0x07,0x11,0x9d,0x50,0x1a,0x18,0x83,0x85,0x41,0x01,0xf0,0x2c,0x19,
-0xad,0xa9,0x3c,0x85,0x51,0x45,0x07,0x17,0x40,0x54,0x3c,0x84,0x8a,0x82,0x17,0x10,
-0x09,0x00,0x07,0x10,0x09,0x00,0x2a,0x18,0x8c,0x87,0x08,0x01,0x77,0x00,0x08,0x07,
-0x56,0x20,0x4c,0x8e,0x8c,0x73,0x08,0x6a,0x9c,0x82,0x4d,0x87,0x18,0x00,0x18,0x07,
-0x9c,0x82,0x08,0x07,0x9c,0x85,0x3a,0x07,0x10,0x00,0x85,0x12,0xf2,0x0b,0x08,0x27,
-0xc8,0xc6,0x2a,0x50,0x60,0x60,0x07,0x25,0x89,0x84,0x4c,0x78,0x08,0x27,0x07,0x19,
-0x6b,0x77,0x07,0x19,0x8c,0x97,0x2a,0x08,0x6c,0x1b,0x10,0x07,0x04,0x00,0xf3,0x0b,
-0x08,0x99,0xb3,0x2a,0x58,0x99,0xb3,0x07,0x35,0x66,0x64,0x5d,0x65,0x3a,0x21,0x07,
-0x09,0x0c,0x71,0x07,0x1a,0x68,0x00,0x2a,0x62,0x59,0xc6,0x0f,0xf3,0x0f,0x26,0xb0,
-0x08,0x05,0x7a,0x20,0x4c,0x68,0x8c,0x84,0x08,0x16,0x49,0x82,0x5c,0x59,0x08,0x44,
-0x08,0x0a,0x49,0x94,0x08,0x0b,0x8c,0xa4,0x29,0x08,0x00,0x34,0xc8,0x0b,0xf2,0x0e,
-0x00,0x06,0x17,0x99,0xd0,0x2a,0x67,0x99,0xd0,0x06,0x47,0x87,0x74,0x5c,0x66,0xa7,
-0x72,0x06,0x47,0x87,0x53,0x06,0x26,0x48,0x62,0x2b,0x15,0x65,0xa0,0xe9,0x0e,0xf2,
-0x0f,0x93,0x00,0x19,0x09,0x4a,0x00,0x6b,0x6c,0x89,0x90,0x08,0x07,0x66,0x80,0x8c,
-0x19,0x44,0x90,0x08,0x49,0xca,0x93,0x08,0x01,0x88,0x00,0x56,0x58,0x01,0x83,0x90,
-0x00,0xf2,0x4f,0x12,0x40,0x07,0x09,0x78,0x71,0x3b,0x79,0x9a,0xc3,0x07,0x17,0xc7,
-0x75,0x3c,0x81,0xc7,0x70,0x18,0x05,0xc1,0xa0,0x07,0x1a,0x2d,0x50,0x2a,0x75,0x95,
-0x87,0x07,0x10,0x2a,0x31,0x07,0x14,0x96,0xa3,0x4c,0x95,0x4a,0x50,0x07,0x37,0xc3,
-0x11,0x4c,0x67,0x6b,0x52,0x07,0x28,0x7c,0x77,0x07,0x15,0x08,0x06,0x2a,0x05,0x79,
-0x78,0x07,0x15,0xb5,0xb3,0x2a,0x62,0x83,0x81,0x19,0x59,0x88,0xa4,0x07,0x29,0x66,
-0x94,0x3c,0x86,0x79,0x83,0x07,0x27,0x9c,0x85,0x07,0x10,0xa5,0x50,0x2a,0x2a,0x30,
-0x67,0xd0,0x00,0xf2,0x0f,0x05,0x00,0x08,0x18,0x97,0x61,0x4c,0x4b,0x11,0xb3,0x08,
-0x67,0x8a,0xa5,0x5c,0x68,0x84,0x62,0x08,0x48,0x69,0xa1,0x08,0x01,0x78,0x90,0x38,
-0x08,0x69,0x91,0x7c,0x01,0xf0,0x15,0x25,0xa5,0x00,0x71,0x87,0xa6,0x20,0x3b,0x78,
-0xbd,0xc7,0x00,0x74,0x38,0x98,0x20,0x5c,0x7b,0x7a,0x7a,0x00,0x71,0x84,0xa4,0x70,
-0x07,0x18,0x3a,0x47,0x02,0xa0,0x86,0x67,0x70,0x07,0x10,0x11,0x03,0xf2,0x08,0xb9,
-0x98,0x3c,0x95,0x7c,0x74,0x07,0x13,0x6b,0x62,0x3b,0x87,0xb7,0xc5,0x07,0x15,0x7a,
-0x73,0x07,0x27,0x7c,0x75,0x2b,0xd0,0x1e,0x00,0xa8,0x0d,0xf3,0x0c,0x00,0x8d,0xdb,
-0xa8,0xa2,0x59,0x96,0x97,0x70,0x8a,0xa9,0x7b,0x61,0x38,0x8a,0x75,0x51,0x16,0x6b,
-0x76,0x40,0x56,0x6b,0x76,0x62,0x00,0x4a,0x68,0x02,0xf2,0x0c,0x02,0xa7,0x90,0x3b,
-0x37,0xb8,0xa3,0x08,0x07,0x68,0x07,0x2c,0x6b,0xb8,0x97,0x09,0x17,0xbf,0x85,0x08,
-0x05,0x8a,0x90,0x29,0x65,0x08,0x26,0xb0,0x00,0xf5,0x0f,0x72,0x00,0x08,0x02,0x8a,
-0x92,0x5c,0x3a,0xb8,0x84,0x08,0x19,0x66,0x61,0x6d,0x3a,0xb9,0x73,0x08,0x19,0x9a,
-0xa1,0x08,0x56,0x6b,0x71,0x38,0x83,0x58,0x04,0xd9,0x0e,0xf6,0x30,0x12,0x92,0x20,
-0x19,0x79,0x77,0xb0,0x6b,0x49,0x89,0x90,0x08,0x5a,0x27,0x40,0x7c,0x66,0x75,0x80,
-0x08,0x18,0xb8,0x50,0x08,0x17,0x83,0x60,0x46,0x52,0xa0,0x60,0x08,0x51,0x00,0x00,
-0x08,0x57,0x58,0xb3,0x4b,0x77,0x64,0x90,0x09,0x79,0x68,0xa6,0x6c,0x78,0x06,0x73,
-0x08,0x5c,0x77,0xa3,0x08,0x1c,0x89,0x60,0x38,0x81,0x94,0x94,0xb9,0x10,0xf4,0x0f,
-0x39,0x11,0x08,0x2a,0xa7,0xb4,0x3b,0x78,0xb6,0xc3,0x07,0x2a,0x8a,0x84,0x4c,0x79,
-0x8b,0x67,0x07,0x28,0x8b,0x57,0x07,0x63,0xc7,0xb3,0x1a,0x76,0x40,0x55,0x21,0x03,
-0x40,0x59,0x9c,0x99,0x91,0x08,0x00,0xf2,0x05,0x29,0x9c,0x99,0x30,0x03,0x70,0x0a,
-0x00,0x00,0x67,0xa2,0x00,0x15,0xa9,0xa8,0x40,0x65,0x10,0x03,0x72,0x4a,0x00,0xf0,
-0x13,0x91,0x80,0x00,0x08,0x09,0x55,0x00,0x00,0x90,0x99,0x9a,0xb0,0x09,0x0b,0xd5,
-0x73,0x00,0x90,0xa2,0x8a,0x00,0x1c,0x99,0x07,0x80,0x01,0x30,0x92,0xa9,0x10,0x00,
-0x0a,0xa0,0x08,0x06,0x1f,0xf2,0x2e,0x00,0x59,0xd0,0xa1,0x10,0x00,0x95,0xa7,0xb0,
-0x6a,0xaa,0x95,0x50,0x71,0x00,0x8a,0x10,0x72,0x40,0x4b,0x00,0x9a,0x44,0x86,0x60,
-0x00,0x05,0x00,0x40,0x02,0x50,0x25,0x00,0x59,0xb8,0x68,0x53,0x09,0x00,0xc4,0xa2,
-0x0a,0x8a,0xc4,0x90,0x09,0x09,0x19,0x80,0x09,0x08,0x0b,0x30,0x18,0x17,0x3a,0x80,
-0x73,0x98,0x70,0x66,0x20,0x1d,0xf1,0x4f,0x54,0x00,0x01,0x70,0x91,0x00,0x49,0xc8,
-0xd8,0xd5,0x01,0x76,0xc2,0xa0,0x3b,0x8a,0x19,0x80,0x35,0x08,0x0d,0x20,0x3b,0x87,
-0x96,0xa0,0x12,0x06,0x20,0x25,0x01,0x10,0x04,0x00,0x25,0xa4,0x28,0x00,0x18,0x56,
-0x69,0xc5,0x55,0x19,0xc2,0xa0,0x37,0x91,0x48,0x90,0x03,0xd0,0x0a,0x30,0x1a,0x37,
-0x48,0x80,0x40,0x03,0x50,0x25,0x05,0x00,0x23,0x00,0x4a,0x88,0x75,0x21,0xb8,0x75,
-0xb6,0xb2,0x46,0x4a,0xc3,0xa0,0x9a,0x8c,0x2a,0x70,0x73,0x58,0x0c,0x10,0x48,0x9b,
-0x69,0x70,0x01,0x95,0x80,0x53,0x64,0x00,0x60,0x96,0x27,0x00,0x24,0x98,0x55,0xd2,
-0x0b,0xf4,0x06,0xc6,0x54,0xa8,0xe3,0xa0,0x06,0xd1,0x39,0xa0,0x2a,0xb8,0x0a,0x50,
-0x61,0x71,0x2b,0x90,0x08,0x53,0xa1,0x46,0xf9,0x47,0xf3,0x2d,0x0c,0x7a,0x46,0x00,
-0x0b,0x6a,0xa9,0xc9,0x0b,0x7d,0xa5,0xa0,0x08,0x09,0x09,0xa0,0x0a,0x87,0x0a,0x50,
-0x19,0x19,0x66,0x93,0x31,0x02,0x40,0x05,0x06,0x24,0x47,0x00,0x4c,0xbc,0x65,0x00,
-0x49,0x9a,0xc9,0xc6,0x19,0xd8,0xc5,0xb0,0x76,0x81,0x0a,0xa0,0x48,0xc9,0x1b,0x40,
-0x23,0x70,0x4a,0xa0,0x08,0x54,0x80,0x56,0x92,0x06,0xf0,0x31,0x00,0x2a,0xda,0x8a,
-0x85,0x1b,0xcb,0x68,0x90,0x17,0xa5,0x58,0x84,0x06,0x87,0x97,0x73,0x05,0x68,0xed,
-0xa1,0x01,0x52,0x60,0x00,0x39,0xb9,0xb8,0x86,0x15,0xa4,0x07,0x00,0x6a,0xcc,0x4a,
-0x41,0x49,0xba,0x58,0xa1,0x56,0xb8,0x98,0x70,0x48,0x98,0x08,0x50,0x4b,0x78,0x08,
-0x30,0x0a,0xc3,0x36,0x80,0x44,0x02,0x40,0x12,0x00,0x02,0x20,0x66,0x1f,0xf2,0x28,
-0x00,0x28,0xc8,0x8a,0xb6,0x00,0x91,0x09,0x10,0x00,0x19,0x38,0x00,0x00,0x07,0xe0,
-0x00,0x01,0x88,0x4b,0x40,0x38,0x20,0x00,0x67,0x00,0xb0,0x10,0x90,0x09,0x59,0x39,
-0x90,0x8b,0x88,0x22,0x90,0x00,0x80,0x65,0x90,0x58,0xc8,0x03,0x91,0x16,0x87,0x69,
-0xd4,0x72,0x87,0x20,0x90,0x16,0x70,0x90,0x1e,0xf2,0x11,0x16,0x17,0x05,0xc3,0x6b,
+0x40,0x3a,0x08,0x70,0x75,0x24,0x00,0x00,0x04,0x00,0xf5,0x0c,0x0a,0x88,0x83,0x4c,
+0x59,0x56,0x61,0x08,0x0a,0x99,0x84,0x5d,0x79,0x85,0x43,0x19,0x08,0x81,0xa0,0x08,
+0x08,0x82,0x80,0x29,0x44,0xa7,0x15,0xf0,0x01,0xf5,0x15,0x70,0x00,0x80,0x00,0x08,
+0x27,0x7c,0x76,0x03,0xb7,0x37,0xc7,0x70,0x07,0x47,0x7c,0x8c,0x05,0xc6,0x37,0xc7,
+0x60,0x07,0x07,0x1c,0x74,0x00,0x71,0xa5,0x80,0x00,0x2a,0x63,0x49,0x77,0x00,0x51,
+0x00,0xf1,0x24,0x06,0x99,0xc1,0x3b,0x57,0x99,0xc1,0x08,0x58,0x68,0x66,0x5c,0x49,
+0x7c,0x78,0x08,0x08,0x08,0x52,0x08,0x08,0x08,0xa1,0x2a,0x00,0x08,0x00,0x08,0x00,
+0x84,0x40,0x2a,0x56,0xc4,0xa4,0x2a,0x50,0x84,0x40,0x08,0x26,0xc4,0xa4,0x5d,0x80,
+0x84,0x40,0x08,0x08,0xc4,0xa5,0x18,0x00,0xf5,0x34,0x00,0x84,0x40,0x07,0x03,0x46,
+0x92,0x07,0x06,0x64,0x04,0x4c,0x88,0x17,0x36,0x07,0x15,0x16,0x80,0x5c,0x68,0xae,
+0x96,0x07,0x00,0x9b,0x70,0x07,0x2a,0x28,0x66,0x2a,0x12,0x08,0x03,0x07,0x10,0x17,
+0x00,0x07,0x17,0xba,0xb6,0x3c,0x80,0x81,0x80,0x07,0x17,0x99,0x86,0x4c,0x88,0xc8,
+0x97,0x07,0x13,0x70,0x90,0x07,0x11,0x9d,0x50,0x1a,0x18,0x83,0x85,0x41,0x01,0xf3,
+0x4c,0x19,0xad,0xa9,0x3c,0x85,0x51,0x45,0x07,0x17,0x40,0x54,0x3c,0x84,0x8a,0x82,
+0x17,0x10,0x09,0x00,0x07,0x10,0x09,0x00,0x2a,0x18,0x8c,0x87,0x08,0x01,0x77,0x00,
+0x08,0x07,0x56,0x20,0x4c,0x8e,0x8c,0x73,0x08,0x6a,0x9c,0x82,0x4d,0x87,0x18,0x00,
+0x18,0x07,0x9c,0x82,0x08,0x07,0x9c,0x85,0x3a,0x07,0x10,0x00,0x07,0x10,0x90,0x90,
+0x08,0x27,0xc8,0xc6,0x2a,0x50,0x60,0x60,0x07,0x25,0x89,0x84,0x4c,0x78,0x08,0x27,
+0x07,0x19,0x6b,0x77,0x07,0x19,0x8c,0x97,0x2a,0x08,0x00,0x17,0x7c,0x04,0xf2,0x0e,
+0x00,0x07,0x08,0x99,0xb3,0x2a,0x58,0x99,0xb3,0x07,0x35,0x66,0x64,0x5d,0x65,0x3a,
+0x21,0x07,0x09,0x0c,0x71,0x07,0x1a,0x68,0x00,0x2a,0x62,0x59,0x86,0x0c,0x01,0xf0,
+0x0f,0x26,0xb0,0x08,0x05,0x7a,0x20,0x4c,0x68,0x8c,0x84,0x08,0x16,0x49,0x82,0x5c,
+0x59,0x08,0x44,0x08,0x0a,0x49,0x94,0x08,0x0b,0x8c,0xa4,0x29,0x08,0x00,0x34,0x24,
+0x00,0xf1,0x11,0x06,0x10,0x00,0x00,0x06,0x17,0x99,0xd0,0x2a,0x67,0x99,0xd0,0x06,
+0x47,0x87,0x74,0x5c,0x66,0xa7,0x72,0x06,0x47,0x87,0x53,0x06,0x26,0x48,0x62,0x2b,
+0x15,0x65,0xa0,0x48,0x00,0xf2,0x10,0x02,0x93,0x00,0x19,0x09,0x4a,0x00,0x6b,0x6c,
+0x89,0x90,0x08,0x07,0x66,0x80,0x8c,0x19,0x44,0x90,0x08,0x49,0xca,0x93,0x08,0x01,
+0x88,0x00,0x56,0x58,0x01,0x83,0x90,0x00,0xf2,0x4f,0x12,0x40,0x07,0x09,0x78,0x71,
+0x3b,0x79,0x9a,0xc3,0x07,0x17,0xc7,0x75,0x3c,0x81,0xc7,0x70,0x18,0x05,0xc1,0xa0,
+0x07,0x1a,0x2d,0x50,0x2a,0x75,0x95,0x87,0x07,0x10,0x2a,0x31,0x07,0x14,0x96,0xa3,
+0x4c,0x95,0x4a,0x50,0x07,0x37,0xc3,0x11,0x4c,0x67,0x6b,0x52,0x07,0x28,0x7c,0x77,
+0x07,0x15,0x08,0x06,0x2a,0x05,0x79,0x78,0x07,0x15,0xb5,0xb3,0x2a,0x62,0x83,0x81,
+0x19,0x59,0x88,0xa4,0x07,0x29,0x66,0x94,0x3c,0x86,0x79,0x83,0x07,0x27,0x9c,0x85,
+0x07,0x10,0xa5,0x50,0x2a,0x2a,0x30,0x67,0xd0,0x00,0xf2,0x0f,0x05,0x00,0x08,0x18,
+0x97,0x61,0x4c,0x4b,0x11,0xb3,0x08,0x67,0x8a,0xa5,0x5c,0x68,0x84,0x62,0x08,0x48,
+0x69,0xa1,0x08,0x01,0x78,0x90,0x38,0x08,0x69,0x91,0x7c,0x01,0xf0,0x15,0x25,0xa5,
+0x00,0x71,0x87,0xa6,0x20,0x3b,0x78,0xbd,0xc7,0x00,0x74,0x38,0x98,0x20,0x5c,0x7b,
+0x7a,0x7a,0x00,0x71,0x84,0xa4,0x70,0x07,0x18,0x3a,0x47,0x02,0xa0,0x86,0x67,0x70,
+0x07,0x10,0x11,0x03,0xf0,0x08,0xb9,0x98,0x3c,0x95,0x7c,0x74,0x07,0x13,0x6b,0x62,
+0x3b,0x87,0xb7,0xc5,0x07,0x15,0x7a,0x73,0x07,0x27,0x7c,0x75,0x2b,0x42,0x02,0x00,
+0xbc,0x06,0xf3,0x0e,0x30,0x00,0x00,0x8d,0xdb,0xa8,0xa2,0x59,0x96,0x97,0x70,0x8a,
+0xa9,0x7b,0x61,0x38,0x8a,0x75,0x51,0x16,0x6b,0x76,0x40,0x56,0x6b,0x76,0x62,0x00,
+0x4a,0x68,0x02,0xf2,0x0c,0x02,0xa7,0x90,0x3b,0x37,0xb8,0xa3,0x08,0x07,0x68,0x07,
+0x2c,0x6b,0xb8,0x97,0x09,0x17,0xbf,0x85,0x08,0x05,0x8a,0x90,0x29,0x65,0x08,0x26,
+0xb0,0x00,0xf4,0x0f,0x72,0x00,0x08,0x02,0x8a,0x92,0x5c,0x3a,0xb8,0x84,0x08,0x19,
+0x66,0x61,0x6d,0x3a,0xb9,0x73,0x08,0x19,0x9a,0xa1,0x08,0x56,0x6b,0x71,0x38,0x83,
+0x58,0x04,0xdc,0x02,0xf4,0x32,0x08,0x12,0x92,0x20,0x19,0x79,0x77,0xb0,0x6b,0x49,
+0x89,0x90,0x08,0x5a,0x27,0x40,0x7c,0x66,0x75,0x80,0x08,0x18,0xb8,0x50,0x08,0x17,
+0x83,0x60,0x46,0x52,0xa0,0x60,0x08,0x51,0x00,0x00,0x08,0x57,0x58,0xb3,0x4b,0x77,
+0x64,0x90,0x09,0x79,0x68,0xa6,0x6c,0x78,0x06,0x73,0x08,0x5c,0x77,0xa3,0x08,0x1c,
+0x89,0x60,0x38,0x81,0x94,0x94,0x00,0xfd,0x03,0xf4,0x10,0x11,0x39,0x11,0x08,0x2a,
+0xa7,0xb4,0x3b,0x78,0xb6,0xc3,0x07,0x2a,0x8a,0x84,0x4c,0x79,0x8b,0x67,0x07,0x28,
+0x8b,0x57,0x07,0x63,0xc7,0xb3,0x1a,0x76,0x40,0x55,0x21,0x03,0x40,0x59,0x9c,0x99,
+0x91,0x08,0x00,0xf2,0x05,0x29,0x9c,0x99,0x30,0x03,0x70,0x0a,0x00,0x00,0x67,0xa2,
+0x00,0x15,0xa9,0xa8,0x40,0x65,0x10,0x03,0x72,0x4a,0x00,0xf0,0x12,0x91,0x80,0x00,
+0x08,0x09,0x55,0x00,0x00,0x90,0x99,0x9a,0xb0,0x09,0x0b,0xd5,0x73,0x00,0x90,0xa2,
+0x8a,0x00,0x1c,0x99,0x07,0x80,0x01,0x30,0x92,0xa9,0x10,0x00,0x0a,0xa0,0xff,0x00,
+0xf1,0x2f,0x50,0x00,0x59,0xd0,0xa1,0x10,0x00,0x95,0xa7,0xb0,0x6a,0xaa,0x95,0x50,
+0x71,0x00,0x8a,0x10,0x72,0x40,0x4b,0x00,0x9a,0x44,0x86,0x60,0x00,0x05,0x00,0x40,
+0x02,0x50,0x25,0x00,0x59,0xb8,0x68,0x53,0x09,0x00,0xc4,0xa2,0x0a,0x8a,0xc4,0x90,
+0x09,0x09,0x19,0x80,0x09,0x08,0x0b,0x30,0x18,0x17,0x3a,0x80,0x73,0x98,0x70,0x66,
+0x61,0x05,0xf1,0x50,0x70,0x54,0x00,0x01,0x70,0x91,0x00,0x49,0xc8,0xd8,0xd5,0x01,
+0x76,0xc2,0xa0,0x3b,0x8a,0x19,0x80,0x35,0x08,0x0d,0x20,0x3b,0x87,0x96,0xa0,0x12,
+0x06,0x20,0x25,0x01,0x10,0x04,0x00,0x25,0xa4,0x28,0x00,0x18,0x56,0x69,0xc5,0x55,
+0x19,0xc2,0xa0,0x37,0x91,0x48,0x90,0x03,0xd0,0x0a,0x30,0x1a,0x37,0x48,0x80,0x40,
+0x03,0x50,0x25,0x05,0x00,0x23,0x00,0x4a,0x88,0x75,0x21,0xb8,0x75,0xb6,0xb2,0x46,
+0x4a,0xc3,0xa0,0x9a,0x8c,0x2a,0x70,0x73,0x58,0x0c,0x10,0x48,0x9b,0x69,0x70,0x01,
+0x95,0x80,0x53,0x64,0x00,0xf3,0x0f,0x96,0x27,0x00,0x24,0x98,0x55,0x00,0x57,0xb7,
+0x99,0xc6,0x54,0xa8,0xe3,0xa0,0x06,0xd1,0x39,0xa0,0x2a,0xb8,0x0a,0x50,0x61,0x71,
+0x2b,0x90,0x08,0x53,0xa1,0xda,0x06,0xf3,0x2f,0x02,0x00,0x0c,0x7a,0x46,0x00,0x0b,
+0x6a,0xa9,0xc9,0x0b,0x7d,0xa5,0xa0,0x08,0x09,0x09,0xa0,0x0a,0x87,0x0a,0x50,0x19,
+0x19,0x66,0x93,0x31,0x02,0x40,0x05,0x06,0x24,0x47,0x00,0x4c,0xbc,0x65,0x00,0x49,
+0x9a,0xc9,0xc6,0x19,0xd8,0xc5,0xb0,0x76,0x81,0x0a,0xa0,0x48,0xc9,0x1b,0x40,0x23,
+0x70,0x4a,0xa0,0x08,0x54,0x80,0x56,0x92,0x06,0xf1,0x6d,0x00,0x2a,0xda,0x8a,0x85,
+0x1b,0xcb,0x68,0x90,0x17,0xa5,0x58,0x84,0x06,0x87,0x97,0x73,0x05,0x68,0xed,0xa1,
+0x01,0x52,0x60,0x00,0x39,0xb9,0xb8,0x86,0x15,0xa4,0x07,0x00,0x6a,0xcc,0x4a,0x41,
+0x49,0xba,0x58,0xa1,0x56,0xb8,0x98,0x70,0x48,0x98,0x08,0x50,0x4b,0x78,0x08,0x30,
+0x0a,0xc3,0x36,0x80,0x44,0x02,0x40,0x12,0x00,0x02,0x20,0x00,0x00,0x01,0x90,0x00,
+0x28,0xc8,0x8a,0xb6,0x00,0x91,0x09,0x10,0x00,0x19,0x38,0x00,0x00,0x07,0xe0,0x00,
+0x01,0x88,0x4b,0x40,0x38,0x20,0x00,0x67,0x00,0xb0,0x10,0x90,0x09,0x59,0x39,0x90,
+0x8b,0x88,0x22,0x90,0x00,0x80,0x65,0x90,0x58,0xc8,0x03,0x91,0x16,0x87,0x69,0xd4,
+0x72,0x87,0x20,0x90,0x16,0x70,0x00,0xba,0x05,0xf1,0x11,0x16,0x17,0x05,0xc3,0x6b,
 0x9b,0x95,0x00,0x1a,0x67,0x80,0x00,0x19,0x57,0x98,0xc5,0x1a,0x67,0x80,0x80,0x7a,
-0x99,0x90,0x80,0x28,0x64,0x80,0x80,0x70,0x09,0x20,0x80,0x59,0x0c,0xf0,0x0f,0x02,
-0x61,0x39,0x9a,0x95,0x10,0x08,0x45,0x90,0x00,0x47,0xc7,0xa8,0xc5,0x48,0xc8,0x90,
-0x90,0x15,0x95,0x80,0x90,0x71,0x87,0x80,0x90,0x04,0x72,0x50,0x90,0xe6,0x07,0xf0,
-0x0d,0x87,0x59,0x18,0x51,0x88,0x79,0x38,0x10,0x87,0x78,0x3a,0xb3,0x86,0x58,0x27,
-0x80,0x88,0x6a,0x36,0x80,0x8b,0xba,0xa2,0x80,0x00,0x00,0x50,0x80,0x64,0x1d,0xf1,
-0x0d,0x18,0x88,0xc8,0x85,0x00,0x38,0x00,0x00,0x00,0x5c,0x99,0x60,0x00,0x72,0x00,
-0x90,0x00,0x90,0x01,0x80,0x03,0x80,0x03,0x60,0x2a,0x00,0x8a,0x20,0x4e,0x01,0xf1,
-0x0f,0x50,0x08,0x10,0x38,0xc7,0x1a,0x70,0x09,0x00,0xa1,0x66,0x09,0x88,0x35,0x04,
-0x08,0x08,0x05,0x60,0x08,0x17,0x00,0x00,0x08,0x26,0x4a,0x10,0x53,0xa3,0x02,0x66,
-0x06,0x00,0x25,0x06,0xf1,0x0d,0x7b,0xa9,0xa8,0x83,0x09,0x09,0x77,0x72,0x0c,0xc0,
-0x19,0x70,0x16,0x83,0x5c,0x80,0x25,0x85,0x58,0x00,0x61,0x88,0x89,0x00,0x75,0x97,
-0x3a,0x83,0xaf,0x25,0x52,0x99,0x99,0x90,0x00,0x09,0x06,0x00,0x05,0x09,0x00,0xf0,
-0x0a,0x88,0xb0,0xd8,0xd8,0x08,0x0b,0x4b,0x88,0xb0,0xa4,0xb8,0x08,0x1b,0x6c,0x88,
-0x73,0x51,0x94,0x00,0x80,0x09,0x00,0x44,0x05,0xa0,0xce,0x04,0xf1,0x06,0x97,0x77,
-0xb0,0x06,0x75,0x55,0xb0,0x03,0x97,0x77,0x60,0x08,0xa6,0x95,0x51,0x18,0x78,0xc7,
-0x60,0x00,0x01,0x1c,0x19,0xf3,0x2f,0x85,0x35,0x30,0x08,0x00,0x84,0x85,0x8c,0x80,
-0x80,0x89,0x08,0x80,0x88,0x89,0x08,0x80,0x80,0xa9,0x9d,0x93,0x88,0x80,0x89,0x10,
-0x60,0x06,0x61,0x90,0x00,0x33,0x00,0x23,0x07,0x87,0x77,0x90,0x07,0x65,0x55,0x90,
-0x04,0x88,0x88,0x50,0x16,0x97,0xa6,0x64,0x03,0x81,0xb8,0x80,0x08,0xa3,0x70,0x00,
-0x36,0x19,0x98,0x86,0x00,0x9f,0x24,0xf0,0x09,0x88,0xa6,0x8c,0x82,0x80,0x93,0x3a,
-0x32,0x88,0xb5,0x55,0xb3,0x80,0x98,0x88,0xc4,0x88,0xa5,0x50,0x90,0x70,0x00,0x90,
-0x90,0x06,0x1e,0xf0,0x45,0x01,0x40,0x06,0x00,0x28,0xb8,0xaa,0x70,0x09,0x53,0x85,
-0x30,0x69,0x99,0xa9,0x72,0x07,0x77,0x78,0x30,0x09,0x55,0x58,0x40,0x09,0x22,0x26,
-0x40,0x0a,0x77,0x7a,0x40,0x0c,0xcc,0xcd,0x60,0x09,0x67,0x67,0x50,0x57,0x7a,0x77,
-0x72,0x07,0x66,0x68,0x30,0x08,0x68,0x79,0x30,0x06,0x38,0x28,0x10,0x63,0x3a,0x01,
-0x80,0x00,0x80,0x03,0x82,0x5c,0xdc,0x76,0x20,0x47,0xa9,0x79,0xb4,0x39,0xc8,0xa0,
-0x80,0x03,0x87,0x87,0x50,0x07,0x53,0x33,0x90,0x04,0x00,0x00,0x98,0x00,0x21,0x00,
-0x90,0x3a,0x1e,0x30,0xd9,0xd9,0xd9,0xf7,0x1a,0x30,0xc8,0xd8,0xd8,0x07,0x00,0x00,
-0x0e,0x00,0x30,0x00,0x00,0x08,0x8d,0x01,0x80,0x07,0x88,0xc7,0xb2,0x07,0x77,0xc7,
-0xa2,0x08,0x00,0xc1,0x00,0x84,0x40,0x00,0x00,0x8d,0x10,0x00,0x19,0x84,0x89,0x97,
-0x8d,0x01,0xf0,0x2c,0xa2,0x1a,0x20,0x05,0xb4,0x3b,0x51,0x28,0xd7,0x6d,0x94,0x09,
-0x66,0x74,0x92,0x26,0x98,0x98,0x63,0x04,0x97,0x77,0x80,0x04,0x40,0x00,0x80,0x04,
-0xa7,0x78,0x80,0x0c,0xdd,0xdd,0x60,0x0a,0x66,0x68,0x50,0x68,0x78,0x77,0x72,0x0b,
-0x79,0x97,0x90,0x0b,0x78,0x74,0x70,0x3b,0x8c,0x2f,0x30,0x44,0x2a,0x92,0x93,0x47,
-0x12,0xf0,0x07,0x28,0x9c,0x88,0x86,0x00,0x92,0x00,0x00,0x04,0xe8,0x88,0xa0,0x38,
-0xa7,0x77,0xa0,0x00,0xa8,0x88,0xa0,0x00,0x90,0x02,0x00,0x20,0x08,0x80,0x1f,0x48,
-0xf1,0x0c,0x4a,0x6a,0x98,0xc0,0x0b,0x88,0x88,0xc0,0x09,0x37,0x80,0x80,0x0a,0x57,
-0x98,0xc0,0x79,0x99,0x80,0x80,0x19,0x63,0x80,0x80,0x81,0x07,0x64,0xcc,0x0e,0x00,
-0x80,0x01,0x41,0x06,0x9a,0xc9,0x91,0x6e,0x25,0x00,0x9d,0x1f,0xf5,0x00,0x0b,0xe4,
-0x00,0x00,0x94,0x89,0x20,0x1b,0x41,0x80,0xa6,0x12,0x01,0x80,0x03,0x8a,0x25,0xf1,
-0x04,0x9e,0xeb,0x96,0x00,0x65,0x8a,0x00,0x02,0x91,0x84,0x80,0x2a,0x9a,0xc9,0x99,
-0x00,0x01,0x80,0x01,0x3c,0x00,0xf1,0x10,0x11,0x46,0x91,0x3a,0x7a,0x42,0x00,0x1a,
-0x69,0x88,0x81,0x0d,0x99,0x80,0x90,0x3a,0x48,0x45,0xa0,0x77,0x18,0x0d,0x30,0x06,
-0x36,0x4b,0x60,0x06,0x85,0x70,0x56,0x4d,0x02,0xb1,0x98,0xc8,0xc0,0x07,0x88,0xc7,
-0xc0,0x06,0x88,0xc7,0xa0,0x8f,0x13,0xb1,0x3a,0xc8,0x00,0x06,0x91,0x84,0xa2,0x35,
-0x01,0x80,0x16,0xee,0x05,0xf1,0x0b,0x27,0x8c,0x86,0x3b,0x76,0x8c,0x85,0x0c,0x88,
-0x09,0x09,0x1d,0x69,0x2c,0x39,0x78,0x19,0x91,0x99,0x07,0x18,0x00,0x09,0x07,0x18,
-0x00,0xdc,0x01,0x00,0xbb,0x0f,0xf1,0x01,0x28,0x8a,0xd9,0x86,0x01,0x85,0x89,0x40,
-0x39,0x87,0x86,0x88,0x00,0xb3,0x36,0x60,0x04,0x00,0x72,0x66,0x66,0x20,0x18,0x88,
-0x88,0x85,0x2a,0x07,0xf4,0x0f,0x36,0x00,0x06,0x17,0x9c,0x95,0x4d,0x91,0x71,0x60,
-0x0c,0x79,0x30,0x93,0x1c,0x92,0x94,0x51,0x87,0x20,0x6b,0x00,0x16,0x10,0x9b,0x60,
-0x06,0x2a,0x20,0x66,0x86,0x05,0x00,0x46,0x09,0xf3,0x0b,0x07,0x14,0xcb,0xc0,0x5d,
-0xaa,0x95,0x40,0x0d,0x93,0x8a,0x61,0x4a,0x39,0x88,0x93,0x47,0x18,0x00,0x90,0x07,
-0x18,0x88,0xc0,0x07,0x18,0x39,0x22,0x00,0x94,0x00,0xf0,0x0a,0x1b,0x88,0x84,0x4c,
-0x89,0x5a,0x62,0x0d,0x99,0x6c,0x81,0x5a,0x29,0x08,0x00,0x47,0x19,0x7a,0x83,0x07,
-0x1b,0x88,0x85,0x07,0x10,0x81,0x20,0xf2,0x0f,0x51,0x10,0x1a,0x6a,0x66,0x69,0x28,
-0xab,0x7a,0x86,0x00,0xc6,0x68,0x00,0x16,0x79,0x88,0x82,0x28,0x8c,0xe9,0x86,0x01,
-0x95,0x89,0x40,0x39,0x11,0x70,0x58,0xc2,0x06,0xf3,0x04,0x77,0xc0,0x4b,0x79,0x55,
-0xb0,0x0c,0x54,0x77,0x70,0x2c,0x97,0x8c,0x81,0x77,0x28,0x8c,0x83,0x07,0x66,0x08,
-0x01,0x24,0x1c,0xf1,0x10,0x30,0x83,0x20,0x09,0x64,0xa6,0x90,0x1c,0x75,0x8a,0x10,
-0x8b,0x73,0x99,0x70,0x19,0x77,0x48,0x52,0x09,0x75,0x59,0x70,0x09,0x0a,0x17,0x91,
-0x09,0x02,0x74,0x11,0xc2,0x06,0xf0,0x09,0x38,0x8c,0x70,0x5c,0x67,0x86,0x80,0x3e,
-0x76,0x84,0x60,0x79,0x86,0x83,0x90,0x68,0x57,0x88,0x80,0x08,0x7a,0xa8,0x72,0x08,
-0x40,0x00,0xf1,0x10,0x02,0x30,0x50,0x06,0x5b,0xa5,0x54,0x1b,0x3b,0xa8,0xb1,0x09,
-0x89,0x75,0x76,0x16,0x58,0x86,0x75,0x27,0x8e,0xf9,0x76,0x03,0xa5,0x68,0x60,0x26,
-0x03,0x50,0x27,0x3a,0x08,0xf0,0x0c,0x18,0xca,0xa6,0x4b,0x89,0x98,0x78,0x0b,0x56,
-0x87,0x75,0x1c,0x83,0x77,0x72,0x77,0x17,0x7b,0x75,0x06,0x18,0x28,0x72,0x06,0x34,
-0x57,0x05,0xd2,0x07,0xf2,0x02,0x3b,0x72,0x83,0x81,0x1a,0x49,0x88,0xa4,0x0d,0x99,
-0x66,0x94,0x3d,0x56,0x79,0x82,0x68,0xd2,0x07,0xf1,0x36,0x60,0x07,0x3b,0x20,0x68,
-0x06,0x10,0x60,0x80,0x06,0x15,0x8a,0x83,0x4c,0x93,0x6c,0x61,0x0c,0x67,0xab,0x74,
-0x2c,0x82,0x79,0x31,0x77,0x27,0x6d,0x91,0x06,0x15,0x49,0x90,0x06,0x36,0x57,0x26,
-0x07,0x05,0x71,0x30,0x07,0x35,0x96,0x50,0x7c,0x89,0x86,0x80,0x3c,0x68,0xa9,0x82,
-0x69,0x6b,0xa9,0xb1,0x67,0x2b,0x18,0x80,0x07,0x74,0x5d,0x23,0x08,0x70,0x94,0xc3,
-0x48,0x01,0xf1,0x10,0x12,0x94,0x61,0x07,0x25,0xb7,0x92,0x4c,0x91,0x88,0x30,0x0c,
-0x47,0x7c,0x73,0x2d,0xaa,0x6b,0xb0,0x78,0x29,0x6b,0xb0,0x07,0x15,0xa8,0xa0,0x07,
-0x49,0x10,0x93,0xb8,0x01,0xf5,0x10,0x15,0x18,0x52,0x07,0x29,0xac,0xb6,0x4c,0x89,
-0x66,0x68,0x0c,0x53,0x74,0xa1,0x2c,0x76,0x99,0x94,0x77,0x19,0x4a,0x48,0x06,0x19,
-0x3a,0x38,0x06,0x1a,0x77,0x78,0xd3,0x0e,0xf5,0x0f,0x20,0x4a,0x00,0x07,0x44,0x93,
-0x92,0x1b,0x77,0x77,0x45,0x0a,0x78,0xa7,0x75,0x1b,0x59,0xa8,0x85,0x46,0x22,0x30,
-0x60,0x05,0x29,0x95,0xb1,0x05,0x73,0x18,0x76,0x09,0xf1,0x2d,0x08,0x6d,0x7e,0xe1,
-0x3c,0x96,0x7a,0xa1,0x0e,0x84,0x95,0x81,0x3b,0x85,0xa8,0x71,0x78,0x65,0xb8,0x71,
-0x07,0x65,0xa8,0x61,0x07,0x61,0x40,0x91,0x00,0x00,0x12,0x00,0x8a,0xec,0x6a,0x82,
-0x86,0x07,0x81,0x62,0x83,0x75,0x49,0x30,0x87,0x89,0x0c,0x10,0x87,0x9a,0x1a,0x70,
-0x88,0x88,0xa2,0x93,0x00,0x00,0x20,0x01,0xe9,0x21,0x41,0x01,0x80,0x00,0x09,0x04,
-0x00,0x33,0xc9,0x91,0x09,0x0c,0x00,0xf0,0x05,0x7d,0x9a,0xc9,0x93,0x09,0x99,0xd9,
-0x93,0x01,0x10,0x90,0x00,0x04,0x40,0xd9,0x90,0x04,0x40,0x90,0x00,0x04,0x00,0x32,
-0x2a,0xa8,0xc8,0xa0,0x02,0x21,0x71,0x90,0x04,0x00,0x90,0x08,0x71,0x91,0x82,0x08,
-0x79,0xba,0x40,0x08,0x0c,0x00,0x00,0x04,0x00,0x72,0x72,0x90,0x08,0x4d,0xa9,0x79,
-0x96,0xc1,0x00,0x90,0x40,0x00,0x06,0x15,0xb8,0x60,0x07,0x25,0x50,0x0f,0x11,0xe0,
-0x82,0x07,0x65,0x32,0x80,0x38,0x05,0x7a,0x00,0x00,0x49,0x80,0x00,0x69,0x9e,0x16,
-0xf4,0x0c,0xd9,0xac,0x96,0x02,0xc8,0x57,0x33,0x08,0x07,0x5b,0x90,0x36,0x7a,0x29,
-0x00,0x00,0x87,0x27,0x00,0x01,0xa0,0x27,0x07,0x2a,0x10,0x0b,0x98,0x61,0x17,0xf0,
-0x0a,0x6c,0x88,0x48,0x00,0x1b,0x6b,0x8c,0x81,0x73,0x89,0x7c,0x73,0x49,0xa0,0x9e,
-0x20,0x05,0x54,0x69,0x90,0x1b,0x49,0x08,0x56,0x72,0x2f,0x08,0xf4,0x10,0x11,0x00,
-0x00,0x09,0x61,0x98,0x80,0x0c,0x83,0x90,0x90,0x09,0x04,0x30,0x54,0x0c,0x84,0xb8,
-0xc0,0x0a,0x53,0x74,0x90,0x6c,0x41,0x2f,0x30,0x09,0x06,0x93,0x95,0x48,0x01,0x03,
-0xa2,0x26,0x00,0xa0,0x21,0x80,0xb3,0x0c,0x96,0xaa,0x20,0x09,0x00,0xa0,0x10,0x00,
-0x82,0x04,0x0a,0x24,0x90,0x08,0x2d,0x82,0x79,0x9b,0x0d,0x03,0xf4,0x03,0xf1,0x08,
-0x19,0x95,0xa0,0xa1,0x00,0x74,0xea,0x20,0x00,0xb1,0x89,0x00,0x05,0x61,0x83,0x90,
-0x3a,0x01,0x80,0x3a,0x00,0x1a,0x60,0x14,0x28,0x30,0x08,0x64,0x09,0x67,0x21,0xf2,
-0x24,0x87,0x48,0x4c,0x89,0x08,0x00,0x39,0x09,0x27,0x05,0x49,0x05,0x84,0x0a,0x09,
-0x00,0x09,0x35,0x07,0x88,0x97,0x06,0x02,0x40,0x00,0x04,0x46,0xa8,0xc1,0x31,0x0b,
-0x00,0x90,0x18,0x44,0x07,0x70,0x00,0x2b,0x98,0xd0,0x07,0x21,0xa7,0x60,0x19,0x05,
-0xab,0x60,0x11,0x44,0xda,0x0a,0xf0,0x1a,0x29,0x19,0x8d,0x00,0x00,0x09,0x09,0x10,
-0x57,0x64,0x02,0x72,0x00,0x3d,0x8a,0x90,0x08,0x16,0x4a,0x10,0x28,0x04,0xd9,0x10,
-0x41,0x84,0x02,0x82,0x09,0x10,0x09,0x00,0x02,0x50,0x09,0x00,0x20,0x0d,0x9d,0x99,
-0x18,0x8d,0x1f,0xd2,0x0c,0x8d,0x89,0x06,0x38,0x09,0x09,0x19,0x0d,0x9d,0x99,0x01,
-0x08,0x03,0x0a,0xf0,0x2d,0x08,0x36,0xa8,0x90,0x00,0x08,0x10,0x90,0x38,0x47,0x00,
-0x84,0x00,0x29,0x88,0xb1,0x07,0x39,0x00,0x71,0x38,0x0b,0x88,0xc1,0x10,0x09,0x00,
-0x71,0x08,0x30,0x09,0x00,0x00,0x46,0x8c,0x82,0x25,0x00,0x09,0x00,0x04,0x28,0x8c,
-0x85,0x00,0x40,0x82,0x00,0x04,0x51,0x70,0x90,0x0a,0x0b,0x98,0x96,0x01,0x00,0x00,
-0x02,0x60,0x00,0xf1,0x2d,0x01,0x58,0x8d,0x86,0x22,0x09,0x09,0x17,0x07,0x1c,0x8c,
-0x92,0x00,0x28,0x90,0xa0,0x06,0x66,0x4a,0x50,0x09,0x83,0x8a,0x92,0x02,0x45,0x10,
-0x16,0x03,0x00,0x22,0x00,0x04,0x60,0x08,0x00,0x00,0x08,0x9d,0x86,0x18,0x20,0x09,
-0x00,0x00,0x17,0x9d,0x93,0x01,0x80,0x09,0x00,0x08,0x10,0x09,0x00,0x09,0x39,0x9d,
-0x98,0xcf,0x01,0xf2,0x0e,0x04,0x20,0x00,0x03,0x6c,0x88,0xc0,0x21,0x56,0x88,0x40,
-0x07,0x15,0x99,0x61,0x00,0x8b,0x88,0xa3,0x06,0x38,0x00,0x90,0x19,0x0c,0x88,0xc0,
-0x01,0x08,0x48,0x04,0xf1,0x0d,0x19,0x18,0x08,0x44,0x00,0x08,0x09,0x44,0x58,0x79,
-0x5d,0x74,0x01,0x98,0x79,0xc4,0x06,0x18,0x08,0x54,0x09,0x17,0x08,0x44,0x54,0x71,
-0x08,0x44,0xb0,0x02,0xc0,0x22,0x57,0x92,0x00,0x43,0x39,0x00,0x24,0x29,0x9d,0x97,
-0x06,0x68,0x00,0xf1,0x20,0x35,0x8d,0x82,0x05,0x58,0x00,0x35,0x0a,0x09,0x77,0x95,
-0x01,0x08,0x00,0x45,0x05,0x00,0x13,0x00,0x03,0x78,0xab,0x86,0x12,0x03,0x70,0x90,
-0x08,0x2a,0x87,0x77,0x00,0x18,0x25,0x80,0x02,0x79,0x25,0x80,0x0a,0x2a,0x25,0x84,
-0x17,0x74,0x01,0x98,0x9f,0x13,0xf0,0x11,0x15,0x09,0x06,0x02,0x29,0x09,0x74,0x42,
-0x08,0x8d,0x94,0x08,0x09,0x11,0x28,0x01,0x1b,0x77,0x78,0x07,0x2c,0x88,0x88,0x0a,
-0x09,0x00,0x08,0x34,0x09,0x02,0x95,0x01,0x68,0x00,0xf1,0x0c,0x4c,0x77,0xb2,0x10,
-0x0b,0x55,0xa2,0x1a,0x18,0x77,0x81,0x01,0x15,0x05,0x02,0x01,0x7c,0x8a,0x82,0x09,
-0x19,0x09,0x04,0x17,0x1d,0x98,0x88,0xef,0x01,0x00,0x48,0x00,0xf1,0x2c,0x58,0xd8,
-0x81,0x30,0x89,0xc9,0x83,0x57,0x0a,0x06,0x40,0x00,0x93,0x70,0x93,0x08,0x45,0x95,
-0x80,0x36,0x80,0x88,0x53,0x50,0x06,0x70,0x00,0x45,0x23,0xa3,0x30,0x07,0x35,0xb5,
-0x50,0x10,0x36,0xc6,0x60,0x57,0x77,0x87,0x72,0x01,0x49,0x77,0xa0,0x09,0x49,0x66,
-0xa0,0x27,0x49,0x77,0xa0,0x61,0x44,0x06,0x80,0xec,0x00,0xf1,0x0f,0x00,0x09,0x81,
-0x02,0x68,0x8c,0x96,0x31,0x82,0x49,0x00,0x28,0x83,0x4a,0x62,0x02,0x88,0xb8,0x80,
-0x09,0x88,0xa7,0x51,0x27,0x83,0x2a,0x77,0x54,0x40,0x80,0x04,0x03,0xf1,0x11,0x24,
-0x00,0x00,0x08,0x08,0x98,0xa8,0x08,0x10,0x87,0xa8,0x08,0x37,0x83,0x98,0x08,0x01,
-0x83,0x98,0x08,0x09,0x58,0x75,0x08,0x17,0x82,0x90,0x08,0x53,0x80,0x43,0x86,0xc4,
-0x10,0x00,0x8c,0x00,0xf0,0x24,0x89,0x8b,0x83,0x40,0x77,0x88,0xa0,0x36,0x88,0x76,
-0xb0,0x02,0x96,0x78,0xb0,0x09,0x92,0x18,0x50,0x45,0x99,0x08,0x82,0x65,0x43,0x66,
-0x12,0x05,0x26,0x23,0x00,0x11,0x5c,0x7b,0x71,0x17,0x6b,0x6b,0x60,0x02,0x5b,0x6b,
-0x60,0x09,0x0d,0x9c,0x93,0x3a,0x8c,0xa9,0x97,0xbb,0x16,0x00,0x04,0x00,0x11,0x01,
-0x4f,0x11,0xf5,0x0b,0x98,0xa0,0x10,0x09,0x85,0x90,0x27,0x0a,0x78,0x90,0x01,0x38,
-0x88,0x81,0x08,0x54,0x77,0x71,0x09,0x34,0x77,0x71,0x54,0xaa,0xcb,0xb6,0x08,0x06,
-0xf1,0x0b,0x2c,0xeb,0x90,0x10,0x1a,0x29,0x91,0x39,0x95,0x55,0x59,0x00,0x0b,0x77,
-0xa0,0x06,0x2b,0x66,0xa0,0x09,0x0b,0x66,0xa0,0x24,0x09,0x03,0xd0,0x00,0xf1,0x91,
-0x35,0x08,0x57,0x70,0x05,0x8c,0xbc,0xc3,0x50,0x83,0xa7,0x95,0x25,0x77,0x97,0x82,
-0x04,0x87,0xc7,0x93,0x18,0x35,0x90,0x90,0x72,0x35,0x84,0x80,0x10,0x00,0x80,0x00,
-0x22,0x00,0x50,0x00,0x07,0x7a,0x79,0x72,0x20,0x88,0x24,0x90,0x45,0x67,0x44,0x80,
-0x01,0x29,0xc9,0x50,0x09,0x6a,0x09,0x80,0x63,0x29,0x54,0x91,0x20,0x06,0x20,0x01,
-0x53,0x09,0x05,0x30,0x06,0x7c,0x8b,0xa2,0x30,0x08,0xa9,0x20,0x45,0x78,0xc8,0x83,
-0x01,0x84,0x84,0x44,0x08,0x89,0x96,0x94,0x44,0x95,0xc5,0x84,0x60,0x80,0x80,0x83,
-0x24,0x08,0x00,0x54,0x05,0x6c,0x78,0x30,0x20,0x6a,0x77,0x11,0x35,0x89,0x98,0xa3,
-0x02,0x79,0x87,0x70,0x07,0x6b,0x77,0x70,0x16,0x08,0x17,0x70,0x30,0x08,0x22,0x70,
-0x22,0x06,0x05,0x00,0x06,0x88,0x89,0x21,0x20,0x96,0x9b,0x86,0x25,0x78,0xab,0x61,
-0x01,0x9b,0x75,0xa0,0x08,0x59,0x61,0xa0,0x26,0x70,0x88,0xb1,0x63,0x66,0x87,0x18,
-0x26,0x11,0xf0,0x10,0x00,0x90,0x00,0x17,0x47,0xcd,0xd3,0x42,0x74,0xb5,0x52,0x05,
-0x73,0x8b,0x90,0x02,0x87,0x6a,0xa0,0x09,0x85,0x78,0x80,0x27,0x83,0x58,0x50,0x64,
-0x66,0x96,0x64,0x24,0x00,0xf3,0x0f,0x32,0x30,0x40,0x30,0x06,0x95,0xa8,0x90,0x30,
-0x96,0x65,0x84,0x26,0x76,0x9a,0x44,0x02,0x56,0x88,0x80,0x09,0x56,0x55,0x70,0x27,
-0x36,0x66,0xb1,0x52,0x00,0x71,0x23,0x00,0xf8,0x04,0x00,0x73,0x00,0xf1,0x03,0x33,
-0x60,0x91,0x09,0x06,0x90,0x80,0x00,0x0a,0x71,0x00,0x00,0x75,0x0a,0x10,0x19,0x60,
-0x01,0xe0,0x04,0x00,0xca,0x28,0x40,0x00,0x04,0xb8,0x82,0x84,0x22,0x40,0x09,0x77,
-0x77,0x90,0x04,0x00,0xf4,0x1d,0x04,0x12,0x30,0x40,0x27,0x17,0x54,0x73,0x20,0x02,
-0x01,0x01,0x00,0x70,0x71,0x00,0x08,0xc8,0xd8,0x20,0x00,0x08,0x45,0x30,0x00,0x3a,
-0x77,0xc0,0x03,0xd8,0x88,0xc4,0x4a,0x10,0x24,0x18,0x08,0x35,0x86,0x36,0x07,0x04,
-0x24,0xa2,0x00,0x05,0x41,0x09,0x66,0x66,0x90,0x40,0x00,0x30,0x44,0x44,0x42,0x04,
-0x00,0xf1,0x3d,0x05,0x88,0x89,0x94,0x08,0x83,0x48,0x42,0x62,0x50,0x34,0xa0,0x04,
-0x20,0x00,0x00,0x1d,0x99,0xaa,0x90,0x79,0x34,0x85,0x30,0x4c,0xaa,0xcb,0xa0,0x08,
-0x34,0x85,0x30,0x69,0x88,0x88,0x92,0x36,0x62,0x90,0xa0,0x50,0x22,0x31,0x32,0x01,
-0x60,0x60,0x00,0x09,0x98,0xd8,0x81,0x7d,0x77,0xc7,0x50,0x19,0x44,0xb4,0x30,0x09,
-0x33,0xb3,0x20,0x08,0x77,0x87,0x81,0x28,0x43,0x81,0xa0,0x40,0x22,0x22,0x23,0xc7,
-0x00,0xf1,0x10,0xa3,0x08,0x70,0x08,0x6b,0x18,0x23,0x36,0x79,0x8e,0x95,0x25,0x93,
-0x0d,0x50,0x08,0x60,0x92,0xa2,0x24,0x05,0x20,0x24,0x19,0x16,0x53,0x82,0x31,0x04,
-0x03,0x04,0x38,0x04,0xf2,0x10,0x01,0x76,0x20,0x08,0x29,0x55,0xb0,0x78,0x89,0x66,
-0xb0,0x79,0x39,0x66,0xb0,0x09,0x06,0x86,0x80,0x0d,0x40,0x65,0x00,0x37,0x89,0x42,
-0x81,0x80,0x43,0x98,0x64,0x6a,0x05,0x00,0x8c,0x50,0xf2,0x0b,0xb3,0xa2,0x58,0x78,
-0xb7,0xc5,0x68,0x49,0x66,0x77,0x08,0x05,0x31,0x80,0x0a,0x22,0x97,0xa0,0x07,0x80,
-0x91,0x80,0x71,0x18,0xba,0xa5,0xa0,0x2f,0xf4,0x13,0x20,0x00,0x00,0xba,0x96,0x9b,
-0x90,0x08,0x88,0x62,0x67,0x00,0x88,0x86,0x99,0x60,0x08,0x88,0x73,0x04,0x00,0x78,
-0x47,0x88,0x60,0x35,0x80,0xa2,0x00,0x07,0x08,0x01,0x8a,0x90,0x43,0x1b,0x02,0x75,
-0x05,0x41,0x99,0xd9,0x91,0x09,0xb2,0x2f,0xd2,0x9a,0x00,0x08,0x00,0x0a,0x00,0x27,
-0x00,0x0a,0x00,0x71,0x00,0x0a,0xdb,0x05,0xf1,0x10,0x80,0x99,0x94,0x08,0x80,0x90,
-0x00,0x0c,0xb6,0xc8,0x84,0x09,0x00,0xa6,0x36,0x0c,0xa3,0x89,0x82,0x17,0x54,0x77,
-0xa0,0x45,0x58,0x49,0xb0,0x61,0x5b,0x74,0x28,0xb9,0x05,0xf3,0x0b,0x98,0x8d,0x80,
-0x07,0x20,0x09,0x00,0x0b,0x99,0x9d,0x94,0x00,0x03,0x99,0x00,0x00,0x4a,0x09,0x00,
-0x19,0x70,0x09,0x00,0x32,0x01,0x98,0x88,0x1e,0xf0,0x04,0x08,0x00,0x18,0x70,0xad,
-0xa6,0x3b,0xc5,0x3a,0x43,0x42,0x73,0x55,0xb5,0x16,0xc7,0x88,0xc8,0x25,0x38,0x16,
-0xf4,0x18,0x70,0x43,0x80,0x00,0x70,0x06,0xb0,0x00,0x80,0x81,0x00,0x80,0x80,0x83,
-0x80,0x78,0xa8,0xc9,0x91,0x00,0x90,0xa5,0x00,0x79,0xa0,0xb8,0x00,0x34,0x80,0x89,
-0x00,0x72,0x88,0x35,0x60,0x60,0xb6,0x00,0x81,0x38,0x1c,0xf1,0x05,0x58,0x8c,0x98,
-0x82,0x39,0x6a,0x95,0x70,0x02,0x39,0x54,0x00,0x58,0xab,0xa7,0x90,0x78,0x9b,0x99,
-0x93,0xd8,0x24,0x21,0x08,0x10,0x38,0x13,0xf1,0x0e,0x5c,0x80,0x98,0xc5,0x08,0x06,
-0x80,0x80,0x2b,0x47,0x80,0x90,0x1a,0x55,0x77,0xc3,0x08,0x03,0x50,0x80,0x4b,0x79,
-0x10,0x80,0x00,0x44,0x48,0x87,0x00,0x75,0x0c,0xf2,0x0a,0x76,0xa4,0x07,0x18,0x77,
-0xb4,0x4c,0x98,0x77,0xb4,0x07,0x18,0x87,0xb4,0x1a,0xa2,0x89,0x00,0x54,0x05,0x49,
-0x04,0x00,0x58,0x07,0x20,0x00,0xf0,0x05,0x89,0x8c,0x88,0x08,0x09,0x6b,0x68,0x4c,
-0x79,0x4a,0x48,0x08,0x02,0x3b,0x32,0x09,0x66,0x8d,0x86,0x6d,0xed,0x05,0x30,0x38,
-0x8d,0x88,0x9f,0x06,0xf1,0x0c,0x2a,0x57,0x09,0x08,0x07,0x05,0x88,0x84,0x2c,0x47,
-0x8b,0x86,0x07,0x06,0x9b,0x86,0x08,0x37,0x72,0x58,0x3b,0x67,0x72,0x58,0x00,0x07,
-0x72,0xad,0x04,0xf3,0x21,0x7c,0x4a,0xbb,0xc0,0x07,0x29,0x99,0x91,0x6c,0x28,0x88,
-0x70,0x07,0x09,0x11,0x90,0x08,0x09,0xca,0x80,0x88,0x7c,0x06,0x80,0x00,0x08,0x72,
-0x52,0x00,0x70,0x80,0x00,0x04,0x60,0x80,0x00,0x0b,0x99,0xc9,0x93,0x15,0x00,0x80,
-0x00,0x04,0x99,0xc9,0x91,0xf0,0x13,0x00,0xdd,0x0a,0xf0,0x0b,0x97,0x0a,0x89,0xc8,
-0xd0,0xa7,0x8c,0x7c,0x09,0x01,0x90,0x90,0xb8,0x9c,0x8d,0x08,0x00,0x80,0x91,0x60,
-0x08,0x09,0x71,0x00,0x86,0xa0,0x98,0x01,0xf3,0x0b,0x8c,0x88,0xa0,0x0a,0x5b,0x65,
-0xa0,0x08,0x9b,0xa8,0x80,0x01,0x90,0x2b,0x10,0x48,0x70,0x19,0xa5,0x00,0x90,0x19,
-0x00,0x09,0x40,0x19,0xca,0x2f,0xf3,0x8a,0x41,0x00,0x7a,0xb1,0xc8,0xb1,0x75,0x78,
-0x77,0x60,0x7a,0xb1,0x7a,0x70,0x75,0x76,0x98,0xa3,0x7a,0xb0,0x80,0x80,0x60,0x00,
-0xc8,0xc0,0x00,0x00,0x80,0x80,0x08,0x78,0xb7,0xc0,0x08,0x66,0xa5,0xb0,0x04,0xb9,
-0x7c,0x70,0x06,0xb9,0x7c,0x72,0x28,0xb9,0x8c,0x86,0x03,0x93,0x08,0x71,0x05,0x00,
-0x00,0x23,0x07,0x09,0x05,0x30,0x4b,0x9c,0x8d,0x81,0x82,0x55,0x54,0x62,0x24,0x62,
-0x2a,0x10,0x03,0x88,0x87,0x10,0x0b,0x5b,0x55,0x90,0x0c,0x6c,0x66,0x90,0x0c,0x7c,
-0x77,0x90,0x09,0x8c,0x8b,0x20,0x48,0x98,0xaa,0x70,0x8a,0xa7,0xbc,0xb1,0x57,0x66,
-0x66,0x90,0x35,0xb9,0x9b,0x30,0x05,0x75,0x5a,0x00,0x59,0x86,0x6b,0x62,0x00,0x00,
-0x20,0x10,0x00,0x89,0xa3,0x85,0x40,0x29,0xd4,0x59,0xd6,0x01,0x11,0x88,0x08,0x10,
-0x09,0x66,0x40,0x74,0x00,0x87,0x6a,0x6b,0x00,0x00,0x16,0x4b,0x50,0x00,0x49,0x59,
-0x69,0x68,0x02,0x52,0x81,0x00,0x79,0xd9,0x98,0x8c,0x0d,0x02,0x6a,0x25,0x02,0x06,
-0x00,0xf1,0x11,0x06,0x00,0x80,0x00,0x4c,0x81,0xd8,0x80,0x70,0x78,0x20,0x80,0x70,
-0x75,0x40,0x80,0x78,0xc0,0x74,0x80,0x70,0x70,0x04,0x80,0x79,0xa0,0x00,0x90,0x70,
-0x00,0x48,0x70,0x3d,0x02,0x21,0x20,0x04,0xfd,0x1d,0xf1,0x00,0x68,0x98,0x98,0x82,
-0x17,0x60,0x28,0x70,0x39,0x88,0x98,0x60,0x08,0x44,0x82,0x04,0x00,0x40,0x7c,0xaa,
-0xc9,0xb3,0x24,0x06,0xf0,0x0d,0x8c,0xeb,0x4a,0x83,0x82,0x29,0x72,0x00,0x87,0xb5,
-0x16,0x50,0x47,0x76,0x10,0x20,0x0b,0x9b,0xc8,0x70,0x09,0x26,0x80,0x70,0x7c,0x9b,
-0xc8,0xc3,0xb7,0x05,0xf2,0x16,0x2b,0x77,0xa8,0x70,0x7a,0x9a,0x97,0x91,0x45,0x37,
-0x77,0x30,0x80,0x69,0x86,0x82,0x0a,0x99,0xb8,0x60,0x08,0x43,0x81,0x70,0x6c,0xa9,
-0xc8,0xb3,0xa9,0x99,0x9a,0xa8,0x88,0x8a,0x90,0x00,0x09,0x06,0x00,0x60,0xa9,0x99,
-0x9a,0x90,0x00,0x09,0x46,0x1b,0xc1,0x18,0x8a,0xa8,0x85,0x03,0x98,0x87,0x80,0x03,
-0xa7,0x77,0xa0,0x04,0x00,0xb0,0x85,0x55,0xa0,0x03,0x73,0x33,0x90,0x38,0x88,0x88,
-0x87,0x47,0x0b,0xf0,0x29,0x71,0x79,0x8d,0x4c,0x68,0x98,0xd0,0xe6,0x71,0x09,0x6a,
-0x78,0x98,0xd7,0x71,0x71,0x09,0x07,0x17,0x98,0xd0,0x71,0x61,0x08,0x00,0x00,0x13,
-0x20,0x17,0x7c,0x64,0x10,0x17,0xa9,0x77,0x50,0x58,0xd7,0x77,0x72,0x0a,0xb7,0x77,
-0x70,0x84,0xb6,0x67,0x70,0x01,0xa6,0x67,0x70,0x01,0xb7,0x78,0x70,0x32,0x17,0xf1,
-0x0a,0x07,0x79,0xa7,0x74,0x02,0xb8,0x88,0x90,0x02,0xc9,0x99,0x90,0x02,0xa6,0x66,
-0x90,0x29,0xb7,0x77,0xc5,0x02,0x82,0x07,0x61,0x05,0x8a,0x06,0xf3,0x2b,0x01,0x30,
-0x78,0x8a,0x96,0x60,0x78,0x9b,0x89,0xb3,0x70,0x96,0x11,0x44,0x77,0x77,0xa9,0xa2,
-0x70,0xc7,0x88,0x90,0x78,0x38,0x24,0xa1,0x10,0x43,0x00,0x70,0x06,0x00,0x00,0x02,
-0xc9,0x79,0x8d,0x81,0x90,0x80,0x96,0x9d,0x99,0x09,0x02,0x90,0x80,0x90,0x69,0x58,
-0x09,0x0a,0x08,0x98,0xd8,0x30,0x08,0x08,0xb1,0x1a,0xf2,0x2c,0x10,0x5c,0x86,0x7c,
-0x75,0x08,0x09,0x7c,0x78,0x4b,0xa9,0x6c,0x68,0x87,0x78,0x7c,0x78,0x17,0x74,0x65,
-0x00,0x0b,0x91,0xe6,0x00,0x03,0x09,0x14,0x96,0x11,0x10,0x05,0x00,0x3c,0x69,0xb9,
-0x86,0x09,0x04,0xba,0x44,0x2c,0xab,0x8b,0x51,0x88,0x84,0xac,0x71,0x08,0x83,0x9b,
-0x61,0x0b,0x53,0x9c,0x74,0x00,0x03,0x44,0x2f,0xf0,0x0c,0x6c,0x89,0x7b,0x70,0x17,
-0x08,0x7b,0x71,0x5a,0x88,0x6b,0x61,0xc4,0x87,0x8b,0x92,0x44,0x85,0x35,0x91,0x3a,
-0x77,0x64,0x90,0x22,0x02,0x14,0x9b,0x0d,0x00,0x52,0x0f,0x00,0x29,0x00,0x00,0xa5,
-0x32,0xf0,0x16,0x92,0x04,0x18,0x14,0x00,0x0a,0x08,0x14,0x70,0x83,0x08,0x10,0xa0,
-0x10,0x7b,0x00,0x10,0x00,0x80,0x06,0x20,0x19,0xe7,0x6d,0xb4,0x28,0xa6,0x88,0x75,
-0x02,0x85,0x67,0x50,0x01,0x33,0x33,0x30,0x6b,0x0e,0xf2,0x57,0x05,0x60,0x83,0x80,
-0x17,0x18,0x60,0x34,0x37,0x90,0x08,0x00,0x29,0x02,0x28,0x50,0x7c,0x98,0x28,0x71,
-0x0d,0x59,0x08,0x14,0x5b,0x60,0x08,0x90,0x88,0x00,0x04,0x80,0x08,0x00,0x7a,0x00,
-0x08,0x3c,0x60,0x00,0x16,0x80,0x60,0x00,0x29,0x14,0xbb,0xa3,0x6c,0x9a,0x09,0x60,
-0x0c,0x34,0x39,0x60,0x2d,0x96,0x39,0x80,0x88,0x19,0x09,0x53,0x17,0x14,0x09,0x12,
-0x07,0x00,0x66,0x00,0x03,0x70,0x24,0x00,0x3a,0x24,0xa8,0xc0,0x3a,0x74,0x79,0x40,
-0x2c,0x67,0x79,0x00,0x1d,0x90,0x88,0xb5,0x88,0x17,0x63,0xb0,0x17,0x10,0x2d,0x20,
-0x07,0x29,0xd5,0x1f,0x00,0xf5,0x01,0xf1,0x05,0x2a,0x69,0x88,0xc1,0x3a,0x68,0x66,
-0xa1,0x0c,0x56,0x88,0x83,0x2d,0x90,0x09,0x00,0x98,0x14,0x8c,0x81,0x4d,0x15,0xf1,
-0x0c,0x28,0x8d,0x84,0x02,0x50,0x24,0x60,0x4b,0x29,0x66,0x60,0x4b,0x63,0x38,0x40,
-0x1c,0x48,0x7c,0xb0,0x2d,0x89,0x6b,0xb0,0x88,0x2c,0x8c,0xc3,0x60,0x2f,0xf2,0x14,
-0x08,0x01,0x90,0x02,0x80,0x09,0x00,0x4b,0x67,0xad,0xa2,0x5b,0xa6,0x69,0x62,0x0a,
-0x45,0x76,0xa0,0x2c,0xa7,0x76,0xb0,0x87,0x36,0x76,0xb0,0x06,0x22,0xa8,0x90,0x06,
-0x49,0x20,0x83,0x5d,0x1c,0xf0,0x0f,0x02,0x43,0x2b,0x45,0x99,0x72,0x3a,0x64,0x8c,
-0x85,0x1b,0x46,0xaa,0xa7,0x0d,0x92,0x55,0x58,0x68,0x13,0x77,0x55,0x26,0x15,0x59,
-0x14,0x06,0x26,0x87,0x86,0xf4,0x0b,0xf4,0x01,0x68,0x8b,0x98,0xa0,0x90,0x60,0x52,
-0x80,0x39,0x30,0x07,0x70,0x06,0x8a,0x88,0x20,0xed,0x34,0x40,0x58,0x8d,0x88,0x80,
-0x64,0x02,0xf0,0x0d,0x1b,0x88,0xa8,0x87,0x15,0x94,0x09,0x45,0x06,0x21,0x66,0x60,
-0x28,0x8a,0xbb,0x96,0x00,0x0b,0x82,0x00,0x02,0x94,0x09,0x61,0x16,0x10,0x00,0x25,
-0x43,0x0f,0xf1,0x0c,0x97,0xa8,0x98,0xb3,0x48,0x55,0x17,0x91,0x09,0x89,0x77,0x80,
-0x09,0x78,0x73,0x90,0x09,0x39,0xa0,0x90,0x09,0x65,0x33,0x90,0x0b,0x77,0x77,0xe1,
-0x34,0xf2,0x0d,0x17,0x39,0x09,0x08,0x46,0x76,0x89,0x85,0x33,0x88,0x9b,0x86,0x15,
-0x76,0x9b,0x85,0x06,0x89,0x73,0x48,0x5a,0x89,0x73,0x48,0x00,0x08,0x63,0x77,0x4d,
-0x32,0xf2,0x0f,0x05,0x00,0x29,0x88,0x78,0xa3,0x3b,0x99,0x8a,0xb4,0x08,0x66,0x66,
-0x72,0x0b,0x69,0x96,0x94,0x08,0x52,0x26,0x80,0x08,0x6a,0x72,0x82,0x44,0x55,0x80,
-0xa8,0x9b,0x0c,0xf1,0x0f,0x60,0x00,0x59,0xc8,0xac,0x82,0x48,0xaa,0x99,0x70,0x03,
-0x3a,0x43,0x90,0x0a,0x4a,0x44,0x30,0x08,0xaf,0x87,0xb0,0x04,0xa9,0x00,0x90,0x58,
-0x08,0x07,0x30,0x22,0x07,0xf0,0x09,0x10,0x42,0x00,0x1b,0xc9,0xcb,0x96,0x15,0xa9,
-0xb8,0x90,0x13,0x34,0x93,0x32,0x25,0x55,0x5a,0x64,0x18,0xa8,0x8b,0x95,0x00,0x75,
-0x0e,0xf1,0x03,0x04,0x6b,0x10,0x07,0x11,0x71,0x10,0x98,0xab,0x8c,0x61,0x19,0x66,
-0x67,0x60,0x0a,0x66,0x67,0xfe,0x1e,0xb3,0x03,0xb4,0x5a,0x20,0x59,0xc7,0x8b,0x72,
-0x4a,0x10,0x17,0x59,0x22,0xf0,0x0a,0x24,0x00,0x2b,0xc7,0x98,0xb5,0x18,0x88,0xb7,
-0x94,0x08,0x77,0x77,0x57,0x01,0xb7,0x77,0x90,0x01,0xa5,0x55,0x50,0x01,0x92,0x22,
-0x70,0x2e,0xf0,0x32,0xc0,0x06,0x00,0x15,0x00,0x3b,0xc8,0xa9,0xc6,0x28,0xa8,0x47,
-0xb4,0x0c,0x7c,0x55,0x09,0x0b,0x4b,0x54,0x09,0x0a,0x66,0x54,0x09,0x1c,0x9b,0x56,
-0x83,0x27,0x14,0x64,0x00,0x05,0x00,0x50,0x00,0x3b,0xba,0xac,0x72,0x87,0xbb,0x6c,
-0x80,0x37,0xa6,0x80,0x80,0x57,0xaa,0x80,0x90,0x47,0xa7,0x83,0x60,0x58,0xb7,0x80,
-0x25,0x00,0x70,0x78,0x92,0xc8,0x00,0xf1,0x2d,0x4a,0xc9,0xab,0x83,0x30,0x69,0x84,
-0x20,0x38,0x87,0x77,0x83,0x18,0x68,0x86,0x80,0x07,0x88,0x88,0x80,0x07,0xb2,0x8a,
-0x40,0x42,0x06,0x20,0x53,0x05,0x10,0x41,0x00,0x4a,0xc7,0xba,0x82,0x29,0x49,0x38,
-0x70,0x79,0xba,0xab,0x82,0x16,0x5a,0x38,0x60,0x07,0x5a,0x38,0x60,0x28,0x6b,0x6b,
-0x32,0x57,0x66,0xb3,0xa3,0x37,0x02,0xf5,0x0f,0x82,0x09,0x00,0x25,0x88,0x09,0x00,
-0x05,0x94,0x0a,0x87,0x39,0xc7,0x09,0x00,0x07,0xd3,0xba,0x88,0x36,0x96,0x70,0x09,
-0x10,0x81,0xc8,0x89,0x00,0x81,0x70,0x2c,0x2c,0xf2,0x11,0x27,0x22,0x3a,0x31,0x59,
-0x83,0x5b,0x52,0x2a,0x52,0x6c,0x61,0x5d,0x86,0x77,0x75,0x0e,0x64,0x97,0xa2,0x5b,
-0x54,0x96,0xa2,0x58,0x04,0x96,0xa2,0x07,0x04,0x42,0xa1,0xf7,0x06,0xf0,0x0f,0x35,
-0x60,0x07,0x8c,0x43,0x00,0x03,0xc8,0x9a,0x00,0x01,0x2c,0x84,0x50,0x04,0xd7,0x56,
-0xe1,0x05,0x84,0xa4,0x25,0x06,0x70,0x92,0x91,0x05,0x09,0x70,0x14,0x31,0x39,0xf3,
-0x0a,0x07,0x32,0x9c,0x96,0x5a,0xa2,0x07,0x10,0x19,0x63,0x07,0x10,0x6a,0x77,0x07,
-0x10,0x25,0x46,0x07,0x10,0x72,0x77,0x9c,0x97,0x10,0x28,0x30,0xf0,0x28,0x06,0x34,
-0xc8,0xc0,0x2a,0x91,0x90,0x80,0x18,0x62,0xb3,0x88,0x3c,0x87,0xa8,0x64,0x14,0x54,
-0x77,0x90,0x54,0x7a,0x5a,0xa3,0x20,0x14,0x50,0x05,0x0b,0x7c,0x89,0x60,0xa6,0xb6,
-0x76,0x06,0xc8,0xa8,0x30,0x6b,0xa4,0x60,0x1a,0xaa,0x88,0x60,0x54,0x74,0x80,0x45,
-0x2a,0x02,0x60,0x02,0x00,0xdd,0x11,0xf0,0x28,0x9c,0xc0,0x98,0x58,0x08,0x80,0x28,
-0x58,0x8c,0xc0,0x98,0x99,0x08,0x80,0x54,0x68,0x08,0x80,0x87,0x59,0x8c,0xc0,0x52,
-0x08,0x00,0x70,0x05,0x00,0x60,0x00,0x08,0x32,0xc8,0xa0,0x98,0x69,0x97,0x30,0x39,
-0x40,0x8b,0x30,0x99,0xa8,0x61,0x73,0x44,0x50,0x07,0x10,0x87,0x52,0x86,0x00,0x21,
-0xa6,0x13,0x10,0x20,0xda,0x24,0xf1,0x0b,0xc8,0xc0,0x29,0x81,0x80,0x80,0x3a,0x61,
-0xb7,0xc0,0x3c,0x86,0x80,0x80,0x23,0x34,0xc8,0xc0,0x45,0x76,0x80,0x80,0x61,0x56,
-0xc8,0xc5,0xdc,0x00,0xf1,0x11,0x60,0x08,0x00,0x08,0x24,0x8c,0x87,0x4b,0x90,0x08,
-0x00,0x08,0x52,0x89,0x85,0x4b,0x77,0x88,0x84,0x15,0x63,0x80,0x17,0x54,0x64,0xb7,
-0x87,0x30,0x00,0x90,0x27,0x02,0x4e,0x19,0xf6,0x2b,0xc8,0xb0,0x76,0x65,0x73,0x70,
-0x38,0x2a,0x8c,0xc0,0x77,0x78,0x8c,0xc0,0x23,0x58,0x00,0x40,0x66,0x68,0x00,0x22,
-0x53,0x15,0x88,0x91,0x05,0x00,0x41,0x00,0x08,0x37,0xab,0x82,0x66,0x70,0xa1,0x40,
-0x6b,0x27,0x97,0xc0,0x37,0x95,0x64,0x42,0x66,0x72,0x78,0x00,0x76,0x65,0x48,0x03,
-0x75,0x3a,0x07,0x94,0xbb,0x25,0xf4,0x0f,0x70,0x00,0x07,0x38,0xc9,0x96,0x78,0x50,
-0x76,0x62,0x18,0x37,0xc8,0x80,0x69,0x82,0x87,0x36,0x33,0x58,0x99,0x18,0x76,0x67,
-0x26,0x62,0x42,0x08,0x06,0x10,0x7c,0x5d,0xf1,0x0d,0x09,0x07,0x99,0x93,0x65,0x87,
-0x47,0x90,0x5b,0x38,0x55,0x80,0x8a,0xb2,0x46,0x41,0x43,0x55,0x8c,0x81,0x87,0x80,
-0x08,0x00,0x85,0x18,0x9c,0x84,0xc9,0x37,0x00,0x14,0x0b,0xf1,0x0b,0x22,0xb8,0xa0,
-0x78,0x55,0x88,0x60,0x18,0x48,0x8b,0x93,0x7a,0xa5,0x2d,0x81,0x33,0x40,0x7b,0x70,
-0x76,0x58,0x68,0x83,0x42,0x01,0x86,0xbf,0x5d,0xf0,0x2e,0x7d,0xd8,0xc8,0x90,0x76,
-0x74,0x4c,0x10,0x56,0x97,0x84,0x90,0x05,0xc9,0x71,0x00,0x18,0xc9,0x6a,0x50,0x14,
-0x39,0x17,0x20,0x35,0x3a,0x02,0x70,0x05,0x00,0x15,0x00,0x08,0x37,0x88,0xa0,0x88,
-0x68,0x77,0xc0,0x29,0x47,0x68,0xb0,0x88,0xa6,0x6a,0x70,0x44,0x51,0x8c,0x60,0x77,
-0x59,0x29,0x90,0x54,0x13,0x67,0x22,0x05,0x62,0x18,0xf2,0x0c,0x38,0x78,0xa0,0x67,
-0x69,0x55,0xa0,0x3a,0x39,0x22,0x20,0x79,0xac,0x8b,0xa4,0x44,0x5c,0x9b,0xb4,0x87,
-0x6b,0x37,0x64,0x53,0x27,0x33,0x73,0xa8,0x00,0xf4,0x0f,0x13,0x50,0x07,0x29,0x87,
-0x70,0x88,0x58,0x9b,0xc1,0x27,0x55,0xb6,0x62,0x77,0x81,0xc7,0x70,0x55,0x64,0xa5,
-0x60,0x76,0x59,0x6b,0x81,0x00,0x02,0x20,0x11,0xfb,0x1a,0xf1,0x2e,0x17,0x48,0x9c,
-0x93,0x98,0x57,0x8b,0x81,0x28,0x47,0x58,0xa2,0x99,0xa9,0x9c,0xa2,0x33,0x50,0xac,
-0x30,0x86,0x78,0x58,0x92,0x64,0x03,0x08,0x02,0x04,0x00,0x23,0x00,0x07,0x3b,0x88,
-0x78,0x78,0x57,0x87,0x77,0x39,0x49,0x07,0x30,0x88,0x9d,0x77,0x78,0x43,0x58,0x76,
-0x68,0x76,0x47,0x77,0x78,0x20,0x07,0x70,0x07,0x00,0x78,0x01,0xf1,0x2b,0x39,0x52,
-0x26,0x69,0x5b,0x95,0x69,0x09,0x60,0x65,0x49,0x9a,0x35,0xc5,0x23,0x57,0x54,0x80,
-0x77,0x67,0x88,0x80,0x75,0x28,0x73,0xa7,0x04,0x00,0x22,0x00,0x07,0x38,0x98,0xb0,
-0x87,0x57,0x9a,0x90,0x28,0x37,0x59,0x80,0x6a,0x96,0x88,0x90,0x30,0x30,0x26,0x30,
-0x77,0x78,0x74,0x81,0x64,0x14,0x98,0x72,0x11,0x04,0x00,0x44,0x0f,0xf0,0x0e,0x29,
-0xad,0xa2,0x88,0x69,0x98,0x82,0x29,0x48,0x87,0x72,0x78,0x9a,0xaa,0xd0,0x45,0x59,
-0x55,0xb0,0x87,0x57,0xb7,0xa0,0x31,0x06,0x10,0x42,0x04,0x10,0xf8,0x5a,0xf4,0x1b,
-0x79,0x77,0x57,0x89,0x77,0x77,0x3a,0x19,0x77,0x74,0x3b,0x6a,0x46,0x77,0x33,0x1b,
-0xaa,0xb8,0x3a,0x88,0x46,0x77,0x31,0x54,0x46,0x87,0x0b,0x8c,0x9b,0xa5,0x1a,0xab,
-0xda,0xa5,0x01,0x79,0x86,0x50,0x03,0x85,0x55,0x90,0x04,0x00,0xf0,0x71,0x29,0x97,
-0x77,0xc5,0x00,0x70,0x06,0x20,0x08,0xa9,0x9b,0x83,0x04,0x89,0xc8,0x80,0x14,0x45,
-0xa4,0x43,0x15,0x57,0x95,0x54,0x08,0x8d,0xd9,0x85,0x01,0x78,0x1a,0x40,0x28,0x30,
-0x00,0x56,0x00,0x60,0x06,0x00,0x27,0x89,0x98,0x70,0x06,0x7a,0x97,0x40,0x57,0x8a,
-0x98,0x72,0x36,0xc3,0x83,0x70,0x57,0xc7,0xa9,0xa2,0x68,0xc7,0x3d,0x21,0x07,0x75,
-0x86,0x93,0x00,0x23,0x00,0x00,0x39,0xa6,0x6a,0x78,0x3a,0xd8,0x68,0x68,0x29,0xa8,
-0x48,0x48,0x68,0xa7,0x3a,0x68,0x48,0xa9,0x58,0x48,0x49,0xaa,0x07,0x08,0x43,0x07,
-0x47,0x66,0x3b,0x79,0x98,0x86,0x09,0xbf,0xad,0xc6,0x09,0x69,0x96,0xb0,0x07,0x78,
-0x77,0x90,0x16,0xb6,0x6c,0x62,0x27,0xd7,0x7d,0x85,0x26,0x10,0x00,0x53,0x9b,0x35,
-0xf0,0x2d,0x08,0x8c,0x8a,0x40,0x00,0x08,0x56,0x00,0x68,0xae,0x98,0x82,0x29,0xd9,
-0x78,0x30,0x42,0xb7,0x79,0x50,0x01,0x70,0x04,0x50,0x01,0xc8,0x8a,0x50,0x07,0x10,
-0x06,0x80,0x6c,0x96,0xaa,0x00,0x4b,0x80,0x0b,0x61,0x07,0x15,0x9b,0x30,0x6e,0xb2,
-0x0a,0x63,0x2d,0xa7,0x9b,0x30,0x87,0x30,0x09,0x05,0x07,0x10,0x0a,0x84,0x5e,0x07,
-0xf0,0x0d,0x4b,0x57,0x8b,0xc0,0x4c,0x76,0x6a,0xb0,0x2a,0x24,0x7b,0x80,0x4e,0x88,
-0x7b,0x94,0x3d,0x98,0x08,0x84,0x99,0x08,0x97,0x94,0x08,0x07,0x00,0x83,0xe4,0x27,
-0xf3,0x0d,0x5b,0xc6,0x42,0x61,0x1a,0x99,0x74,0xb2,0x15,0x8c,0xa8,0x99,0x1a,0x93,
-0x43,0x13,0x16,0xa8,0xb6,0x87,0x68,0xa2,0xa6,0x54,0x00,0x85,0x56,0x30,0x93,0x26,
-0xf2,0x0a,0x00,0x4b,0xb9,0x97,0xa4,0x28,0x98,0x5b,0xb1,0x56,0x54,0x78,0x85,0x3a,
-0x97,0x77,0xb5,0x04,0xb9,0x99,0x80,0x39,0xa9,0x99,0xc5,0xb1,0x26,0xf5,0x0e,0x91,
-0x30,0x27,0xc0,0xa7,0x30,0x36,0xb0,0x76,0x90,0x04,0x77,0x77,0x00,0x09,0x44,0x4a,
-0x00,0x09,0x33,0x3a,0x00,0x09,0x66,0x6b,0x00,0x09,0x00,0x3b,0xd6,0x1c,0xf0,0x10,
-0x06,0x51,0x62,0x10,0x1a,0x19,0x69,0x81,0x27,0x67,0x72,0x04,0x0b,0x79,0x39,0x85,
-0x0b,0x5a,0x31,0x11,0x0c,0x7b,0x68,0x61,0x08,0x09,0x62,0x07,0x08,0x58,0x49,0xcf,
-0x0a,0xf5,0x12,0x22,0x00,0xca,0x48,0x86,0x20,0x0c,0xa4,0x87,0x94,0x00,0x84,0x48,
-0x87,0x40,0x0c,0xa5,0x78,0x85,0x00,0x64,0x66,0x86,0x20,0x35,0x49,0x39,0x57,0x06,
-0x2a,0xb1,0xa1,0x80,0x70,0x0e,0xf2,0x08,0xa7,0x76,0x8c,0x7a,0x87,0x59,0x77,0x37,
-0x68,0x77,0x7a,0x98,0x99,0x76,0x25,0x77,0x79,0x62,0x5b,0xb7,0x36,0x83,0x67,0xb2,
-0x32,0x51,0x42,0x00,0x68,0xc9,0x87,0x1f,0x09,0x12,0x8b,0x06,0x00,0x02,0x09,0x00,
-0xf0,0x01,0x18,0xac,0x89,0x84,0x00,0x80,0x08,0x40,0x07,0x98,0x87,0x92,0x04,0x78,
-0xc7,0x70,0x49,0x30,0x00,0x04,0x00,0x50,0x27,0x77,0x77,0x76,0x01,0x2e,0x0b,0xf0,
-0x16,0x3a,0x66,0xc0,0x09,0x5a,0x74,0xc0,0x08,0x34,0x83,0xb0,0x08,0x27,0x82,0xb0,
-0x3a,0x9a,0xa9,0xb7,0x04,0x80,0x08,0x70,0x14,0x00,0x00,0x33,0x01,0x60,0x08,0x00,
-0x0b,0x89,0x8c,0x85,0x09,0x58,0x49,0x14,0xf2,0x03,0x99,0xb0,0x3c,0x88,0x80,0x80,
-0x08,0x68,0x80,0x80,0x25,0x18,0x80,0x84,0x51,0x6a,0x40,0x97,0x6e,0x18,0xf1,0x0f,
-0x06,0x00,0x0a,0x96,0x8b,0x85,0x09,0x4a,0x50,0x08,0x08,0x47,0x41,0x11,0x3c,0x77,
-0x67,0x81,0x08,0x67,0x64,0x00,0x25,0x17,0x61,0x06,0x51,0x66,0x49,0x87,0x9c,0x00,
-0x00,0xab,0x10,0xf0,0x08,0x2a,0x79,0xa0,0x00,0x4e,0x98,0xd9,0x81,0x02,0x90,0x09,
-0x05,0x30,0x09,0x99,0xd9,0xb3,0x00,0x90,0x00,0x01,0x20,0x09,0x67,0x07,0xf0,0x09,
-0x49,0x88,0x89,0x80,0x00,0x81,0x09,0x00,0x18,0xc9,0x8c,0x85,0x00,0x32,0x74,0x00,
-0x07,0x99,0xc8,0xc0,0x07,0x12,0x70,0x90,0x11,0x15,0xf0,0x0e,0x00,0x59,0x29,0x20,
-0x29,0x40,0x01,0x77,0x00,0x71,0x09,0x00,0x28,0xc9,0x8c,0x86,0x00,0x85,0x58,0x54,
-0x07,0x53,0x33,0xa3,0x4c,0x3b,0x89,0x80,0x05,0x04,0x00,0xf0,0x00,0x36,0x00,0x80,
-0x05,0x30,0x07,0xa0,0x15,0x97,0x5b,0x54,0x14,0x96,0x4a,0x53,0xc0,0x2f,0xf2,0x05,
-0x06,0x15,0x30,0x91,0x02,0x41,0x61,0x50,0x28,0x9e,0xfb,0x86,0x03,0xa4,0x89,0x60,
-0x38,0x11,0x80,0x47,0x40,0x00,0xf4,0x0b,0x8d,0x86,0x06,0xb7,0x78,0x84,0x38,0xb7,
-0x76,0x36,0x03,0x28,0x00,0x35,0x08,0x8b,0x7a,0x64,0x04,0x9b,0x79,0x53,0x00,0x00,
-0x03,0xa1,0x60,0x00,0xf4,0x09,0x06,0x62,0xb9,0x81,0x22,0x38,0x96,0x60,0x07,0x15,
-0x98,0x84,0x00,0x7a,0x77,0xa4,0x09,0x18,0x00,0x71,0x15,0x08,0x77,0xb1,0x20,0x00,
-0xf0,0x09,0x05,0xb7,0x78,0x74,0x2b,0x6a,0x99,0x37,0x14,0x7a,0x78,0x27,0x06,0x7a,
-0x7b,0x36,0x06,0x7a,0x7b,0x45,0x02,0x01,0x05,0x92,0x20,0x00,0xf0,0x09,0x27,0xb9,
-0xac,0x75,0x04,0x67,0xb6,0x60,0x27,0x99,0x99,0x75,0x05,0xd8,0x7b,0xa0,0x04,0x79,
-0x88,0x90,0x06,0x27,0x33,0x90,0x6c,0x01,0x00,0xc3,0x18,0xf1,0x2d,0x28,0xc8,0x8c,
-0x86,0x0c,0xc8,0x3a,0x52,0x0b,0x8a,0x95,0x20,0x09,0xa6,0x21,0x60,0x06,0x79,0x98,
-0x90,0x08,0x07,0x62,0x90,0x3c,0x8c,0xb9,0xc7,0x15,0xa6,0x5b,0x53,0x14,0x95,0x4c,
-0x94,0x14,0xa8,0x8c,0x98,0x08,0x98,0x88,0x44,0x47,0x98,0x88,0xb0,0x07,0x9a,0xa5,
-0x90,0x57,0x68,0x8a,0x85,0x45,0x10,0x36,0x68,0x80,0x00,0xf0,0x0c,0xb8,0x8b,0x85,
-0x0c,0xab,0x6a,0xb5,0x0b,0x67,0x76,0x85,0x08,0x7a,0xca,0x45,0x08,0x78,0xbb,0x25,
-0x08,0x29,0xb5,0x25,0x09,0x71,0x65,0x83,0x93,0x04,0xf5,0x0d,0x67,0xa0,0x0b,0x61,
-0x45,0x78,0x8c,0x96,0x69,0x89,0x6b,0x52,0x37,0x29,0x07,0x70,0x14,0x99,0x59,0x40,
-0x00,0x89,0x63,0x44,0x08,0x87,0x62,0xa6,0x45,0x02,0xf1,0x0f,0x00,0x93,0x10,0x07,
-0x02,0xd8,0xa0,0x7b,0xb8,0x8a,0x20,0x76,0x64,0x78,0x72,0x7b,0x93,0x6b,0x61,0x27,
-0x41,0x5b,0x50,0x5c,0xb6,0x7c,0x73,0x20,0x11,0x08,0x01,0x15,0xf0,0x0d,0x3b,0x7a,
-0xdf,0xf0,0x76,0x79,0x5b,0xb0,0x75,0x72,0xb6,0x40,0x6b,0x84,0xb8,0x40,0x07,0x47,
-0xd7,0xc1,0x1a,0xb5,0x48,0x61,0x43,0x28,0x57,0x50,0xc4,0x24,0x50,0x28,0x05,0x88,
-0x82,0x41,0x15,0x37,0x85,0x19,0x9b,0xb4,0x9b,0x00,0x05,0x40,0x09,0x04,0x00,0x31,
-0x6a,0x10,0x00,0xb7,0x1e,0xf1,0x10,0x00,0x00,0x64,0x3b,0x95,0x84,0x18,0x79,0x85,
-0x00,0x4b,0x66,0x69,0xc5,0x58,0x36,0xb2,0x80,0x08,0x97,0xb3,0x80,0x08,0x57,0xc5,
-0x80,0x08,0x00,0x84,0x90,0x00,0x7d,0x16,0xf4,0x0f,0x41,0x00,0x46,0x5b,0x44,0x84,
-0x36,0x6b,0x74,0x00,0x3b,0x8b,0x89,0xc5,0x58,0x8b,0x86,0x80,0x08,0x4b,0x62,0x80,
-0x08,0x6c,0x96,0x80,0x08,0x00,0x14,0xa0,0xcb,0x1c,0xf1,0x0f,0x28,0x8c,0x88,0x70,
-0x07,0x7c,0x87,0x40,0x58,0x8c,0x98,0x81,0x01,0x93,0x81,0x70,0x79,0x70,0x5b,0x10,
-0x03,0xa8,0x35,0xa2,0x03,0x50,0x00,0x11,0x00,0x05,0x3f,0x3d,0xf0,0x0a,0x71,0x06,
-0x77,0x79,0x30,0x5c,0x76,0x69,0x92,0x05,0x8a,0xa8,0x30,0x05,0xb1,0x77,0x70,0x63,
-0xb5,0x69,0x71,0x00,0x73,0x00,0x32,0x28,0x28,0xf0,0x16,0x5a,0x67,0x9d,0x95,0x01,
-0x78,0x08,0x44,0x08,0x7a,0x8c,0x91,0x5e,0x98,0x80,0xa0,0x49,0x38,0x39,0x70,0x08,
-0x27,0x3e,0x50,0x08,0x56,0x70,0x66,0x07,0x00,0x09,0x82,0x18,0x48,0x8c,0x9a,0x26,
-0x99,0x13,0x90,0x5b,0x7c,0x88,0x3e,0x9a,0x6c,0x78,0x39,0x1a,0x4f,0x20,0x01,0x2f,
-0x3c,0x11,0x66,0x83,0x00,0xf1,0x10,0x53,0x09,0x00,0x0b,0xb7,0x9d,0x96,0x28,0xa3,
-0x09,0x00,0x27,0x45,0x87,0x63,0x37,0x78,0xc7,0x76,0x04,0x95,0x64,0x81,0x24,0xb3,
-0x57,0x81,0x00,0x74,0x00,0x15,0xe9,0x11,0xf1,0x30,0x80,0x00,0x80,0x89,0xc8,0x35,
-0x80,0x59,0xd9,0x35,0x80,0x41,0x89,0x04,0x80,0x57,0x7b,0x97,0x72,0x15,0x83,0x85,
-0x60,0x46,0x97,0x29,0x61,0x02,0x30,0x00,0x21,0x05,0x01,0x40,0x00,0x38,0x48,0x87,
-0x73,0x35,0x9d,0x66,0xa0,0x09,0x79,0x66,0xb0,0x6d,0x94,0xc7,0x70,0x38,0x37,0xb8,
-0xb0,0x08,0x14,0xab,0x10,0x08,0x29,0x64,0x94,0xa2,0x0b,0xf0,0x1c,0xba,0xd9,0x92,
-0x28,0xba,0xc8,0x80,0x44,0x80,0x80,0x90,0x48,0x80,0x89,0xc0,0x46,0x00,0x00,0x90,
-0x4b,0x88,0x88,0xc0,0x44,0x00,0x00,0x80,0x58,0xc9,0xc8,0x81,0x3a,0xb8,0xc7,0xb0,
-0x39,0xa8,0xa6,0x90,0x68,0xba,0x88,0x82,0xf6,0x43,0xf4,0x15,0x04,0xad,0xb7,0x30,
-0x45,0x20,0x01,0x50,0x1a,0xbd,0xbd,0xb6,0x08,0x7a,0x88,0x73,0x06,0x2a,0x87,0x74,
-0x26,0x9b,0x99,0xc1,0x2a,0x14,0xca,0xa0,0x06,0x47,0x97,0x60,0x06,0x49,0x86,0x87,
-0x2f,0x21,0xf5,0x0d,0x19,0x36,0x98,0xc0,0x2a,0x47,0x87,0xc0,0x6c,0x88,0x87,0xb0,
-0x0a,0x06,0x98,0xc0,0x09,0x80,0x88,0x00,0x36,0x53,0x78,0x01,0x80,0x19,0x06,0x94,
-0xb3,0x3b,0xf6,0x11,0x29,0x38,0x77,0xc0,0x03,0x4a,0x87,0x7c,0x00,0x09,0x48,0x77,
-0xc0,0x0a,0xc9,0x88,0x8c,0x00,0x19,0x00,0x88,0x00,0x00,0x90,0x35,0x80,0x40,0x09,
-0x28,0x06,0x95,0x00,0x99,0x23,0xf2,0x0e,0x73,0x00,0x09,0x80,0xca,0x82,0x06,0x73,
-0x43,0x60,0x03,0x88,0x88,0x50,0x05,0x13,0x20,0x90,0x05,0x17,0x40,0x90,0x00,0x2c,
-0xa0,0x12,0x19,0x92,0x88,0x9d,0x2c,0xf1,0x03,0x51,0x00,0x00,0x3b,0x79,0x80,0x4e,
-0x77,0xc7,0x90,0x98,0x8c,0x8b,0x09,0x00,0x80,0x90,0xa8,0x07,0x00,0x44,0x96,0x30,
-0x08,0x79,0x0a,0x08,0xf5,0x0d,0x08,0x96,0x5c,0x89,0x2c,0xb8,0x18,0x18,0x3c,0xbb,
-0x63,0xa4,0x08,0x67,0x86,0xb5,0x0b,0xbb,0x78,0xc7,0x24,0x67,0x00,0x80,0x60,0x29,
-0x00,0x80,0x2e,0x08,0xf1,0x0b,0x75,0x9b,0xa8,0x49,0xa6,0xc8,0x85,0x0a,0xac,0x79,
+0x99,0x90,0x80,0x28,0x64,0x80,0x80,0x70,0x09,0x20,0x80,0x10,0x01,0xf0,0x10,0x50,
+0x02,0x61,0x39,0x9a,0x95,0x10,0x08,0x45,0x90,0x00,0x47,0xc7,0xa8,0xc5,0x48,0xc8,
+0x90,0x90,0x15,0x95,0x80,0x90,0x71,0x87,0x80,0x90,0x04,0x72,0x50,0x90,0xe6,0x07,
+0xf1,0x2d,0x87,0x59,0x18,0x51,0x88,0x79,0x38,0x10,0x87,0x78,0x3a,0xb3,0x86,0x58,
+0x27,0x80,0x88,0x6a,0x36,0x80,0x8b,0xba,0xa2,0x80,0x00,0x00,0x50,0x80,0x00,0x02,
+0x60,0x00,0x18,0x88,0xc8,0x85,0x00,0x38,0x00,0x00,0x00,0x5c,0x99,0x60,0x00,0x72,
+0x00,0x90,0x00,0x90,0x01,0x80,0x03,0x80,0x03,0x60,0x2a,0x00,0x8a,0x20,0x4e,0x01,
+0xf1,0x0f,0x50,0x08,0x10,0x38,0xc7,0x1a,0x70,0x09,0x00,0xa1,0x66,0x09,0x88,0x35,
+0x04,0x08,0x08,0x05,0x60,0x08,0x17,0x00,0x00,0x08,0x26,0x4a,0x10,0x53,0xa3,0x02,
+0x66,0x06,0x00,0x25,0x06,0xf1,0x0c,0x7b,0xa9,0xa8,0x83,0x09,0x09,0x77,0x72,0x0c,
+0xc0,0x19,0x70,0x16,0x83,0x5c,0x80,0x25,0x85,0x58,0x00,0x61,0x88,0x89,0x00,0x75,
+0x97,0x3a,0x55,0x04,0x62,0x99,0x99,0x99,0x90,0x00,0x09,0x06,0x00,0x05,0x09,0x00,
+0xf0,0x0a,0x88,0xb0,0xd8,0xd8,0x08,0x0b,0x4b,0x88,0xb0,0xa4,0xb8,0x08,0x1b,0x6c,
+0x88,0x73,0x51,0x94,0x00,0x80,0x09,0x00,0x44,0x05,0xa0,0xce,0x04,0xf2,0x49,0x97,
+0x77,0xb0,0x06,0x75,0x55,0xb0,0x03,0x97,0x77,0x60,0x08,0xa6,0x95,0x51,0x18,0x78,
+0xc7,0x60,0x00,0x01,0x80,0x00,0x28,0x89,0xc8,0x85,0x35,0x30,0x08,0x00,0x84,0x85,
+0x8c,0x80,0x80,0x89,0x08,0x80,0x88,0x89,0x08,0x80,0x80,0xa9,0x9d,0x93,0x88,0x80,
+0x89,0x10,0x60,0x06,0x61,0x90,0x00,0x33,0x00,0x23,0x07,0x87,0x77,0x90,0x07,0x65,
+0x55,0x90,0x04,0x88,0x88,0x50,0x16,0x97,0xa6,0x64,0x03,0x81,0xb8,0x80,0x08,0xa3,
+0x70,0x00,0x36,0x19,0x98,0x86,0x00,0xc9,0x07,0xf0,0x62,0x00,0x88,0xa6,0x8c,0x82,
+0x80,0x93,0x3a,0x32,0x88,0xb5,0x55,0xb3,0x80,0x98,0x88,0xc4,0x88,0xa5,0x50,0x90,
+0x70,0x00,0x90,0x90,0x00,0x00,0x08,0x70,0x01,0x40,0x06,0x00,0x28,0xb8,0xaa,0x70,
+0x09,0x53,0x85,0x30,0x69,0x99,0xa9,0x72,0x07,0x77,0x78,0x30,0x09,0x55,0x58,0x40,
+0x09,0x22,0x26,0x40,0x0a,0x77,0x7a,0x40,0x0c,0xcc,0xcd,0x60,0x09,0x67,0x67,0x50,
+0x57,0x7a,0x77,0x72,0x07,0x66,0x68,0x30,0x08,0x68,0x79,0x30,0x06,0x38,0x28,0x10,
+0x63,0x3a,0x01,0x80,0x00,0x80,0x03,0x82,0x5c,0xdc,0x76,0x20,0x47,0xa9,0x79,0xb4,
+0x39,0xc8,0xa0,0x80,0x03,0x87,0x87,0x50,0x07,0x53,0x33,0x90,0x04,0x00,0x00,0x98,
+0x00,0x00,0x63,0x00,0xd0,0x09,0x09,0x00,0xd9,0xd9,0xd9,0x98,0x09,0x09,0x09,0xc8,
+0xd8,0xd8,0x07,0x00,0x00,0x0e,0x00,0x30,0x00,0x00,0x08,0x8d,0x01,0x80,0x07,0x88,
+0xc7,0xb2,0x07,0x77,0xc7,0xa2,0x08,0x00,0xc1,0x00,0x84,0x40,0x00,0x00,0x8d,0x10,
+0x00,0x19,0x84,0x89,0x97,0x8d,0x01,0xf0,0x46,0xa2,0x1a,0x20,0x05,0xb4,0x3b,0x51,
+0x28,0xd7,0x6d,0x94,0x09,0x66,0x74,0x92,0x26,0x98,0x98,0x63,0x04,0x97,0x77,0x80,
+0x04,0x40,0x00,0x80,0x04,0xa7,0x78,0x80,0x0c,0xdd,0xdd,0x60,0x0a,0x66,0x68,0x50,
+0x68,0x78,0x77,0x72,0x0b,0x79,0x97,0x90,0x0b,0x78,0x74,0x70,0x3b,0x8c,0x2f,0x30,
+0x44,0x2a,0x92,0x93,0x00,0x06,0x00,0x00,0x28,0x9c,0x88,0x86,0x00,0x92,0x00,0x00,
+0x04,0xe8,0x88,0xa0,0x38,0xa7,0x77,0xa0,0x00,0xa8,0x88,0xa0,0x00,0x90,0x02,0x00,
+0xf1,0x12,0x08,0x80,0x07,0x07,0x00,0x00,0x4a,0x6a,0x98,0xc0,0x0b,0x88,0x88,0xc0,
+0x09,0x37,0x80,0x80,0x0a,0x57,0x98,0xc0,0x79,0x99,0x80,0x80,0x19,0x63,0x80,0x80,
+0x81,0x07,0x64,0x3e,0x06,0x00,0x80,0x01,0x40,0x06,0x9a,0xc9,0x91,0x08,0x00,0xf0,
+0x05,0x29,0x99,0xc9,0x96,0x00,0x0b,0xe4,0x00,0x00,0x94,0x89,0x20,0x1b,0x41,0x80,
+0xa6,0x12,0x01,0x80,0x03,0x18,0x00,0x01,0x1c,0x00,0xf1,0x04,0x9e,0xeb,0x96,0x00,
+0x65,0x8a,0x00,0x02,0x91,0x84,0x80,0x2a,0x9a,0xc9,0x99,0x00,0x01,0x80,0x01,0x3c,
+0x00,0xf1,0x10,0x11,0x46,0x91,0x3a,0x7a,0x42,0x00,0x1a,0x69,0x88,0x81,0x0d,0x99,
+0x80,0x90,0x3a,0x48,0x45,0xa0,0x77,0x18,0x0d,0x30,0x06,0x36,0x4b,0x60,0x06,0x85,
+0x70,0x56,0x4d,0x02,0xf1,0x0c,0x98,0xc8,0xc0,0x07,0x88,0xc7,0xc0,0x06,0x88,0xc7,
+0xa0,0x28,0x89,0xc8,0x86,0x00,0x3a,0xc8,0x00,0x06,0x91,0x84,0xa2,0x35,0x01,0x80,
+0x16,0xee,0x05,0xf2,0x0d,0x27,0x8c,0x86,0x3b,0x76,0x8c,0x85,0x0c,0x88,0x09,0x09,
+0x1d,0x69,0x2c,0x39,0x78,0x19,0x91,0x99,0x07,0x18,0x00,0x09,0x07,0x18,0x00,0x86,
+0x00,0x8a,0x04,0xf1,0x02,0x00,0x28,0x8a,0xd9,0x86,0x01,0x85,0x89,0x40,0x39,0x87,
+0x86,0x88,0x00,0xb3,0x36,0x60,0x04,0x00,0x72,0x66,0x66,0x20,0x18,0x88,0x88,0x85,
+0x2a,0x07,0xf4,0x0f,0x36,0x00,0x06,0x17,0x9c,0x95,0x4d,0x91,0x71,0x60,0x0c,0x79,
+0x30,0x93,0x1c,0x92,0x94,0x51,0x87,0x20,0x6b,0x00,0x16,0x10,0x9b,0x60,0x06,0x2a,
+0x20,0x66,0x86,0x05,0x00,0x46,0x09,0xf2,0x0b,0x07,0x14,0xcb,0xc0,0x5d,0xaa,0x95,
+0x40,0x0d,0x93,0x8a,0x61,0x4a,0x39,0x88,0x93,0x47,0x18,0x00,0x90,0x07,0x18,0x88,
+0xc0,0x07,0x18,0xa9,0x03,0x01,0x94,0x00,0xf0,0x08,0x1b,0x88,0x84,0x4c,0x89,0x5a,
+0x62,0x0d,0x99,0x6c,0x81,0x5a,0x29,0x08,0x00,0x47,0x19,0x7a,0x83,0x07,0x1b,0x88,
+0x85,0x1c,0x00,0xf2,0x11,0x01,0x13,0x51,0x10,0x1a,0x6a,0x66,0x69,0x28,0xab,0x7a,
+0x86,0x00,0xc6,0x68,0x00,0x16,0x79,0x88,0x82,0x28,0x8c,0xe9,0x86,0x01,0x95,0x89,
+0x40,0x39,0x11,0x70,0x58,0xc2,0x06,0xf3,0x04,0x77,0xc0,0x4b,0x79,0x55,0xb0,0x0c,
+0x54,0x77,0x70,0x2c,0x97,0x8c,0x81,0x77,0x28,0x8c,0x83,0x07,0x66,0x08,0x00,0x01,
+0x00,0xf1,0x11,0x04,0x30,0x83,0x20,0x09,0x64,0xa6,0x90,0x1c,0x75,0x8a,0x10,0x8b,
+0x73,0x99,0x70,0x19,0x77,0x48,0x52,0x09,0x75,0x59,0x70,0x09,0x0a,0x17,0x91,0x09,
+0x02,0x74,0x11,0xc2,0x06,0xf0,0x09,0x38,0x8c,0x70,0x5c,0x67,0x86,0x80,0x3e,0x76,
+0x84,0x60,0x79,0x86,0x83,0x90,0x68,0x57,0x88,0x80,0x08,0x7a,0xa8,0x72,0x08,0x40,
+0x00,0xf1,0x10,0x02,0x30,0x50,0x06,0x5b,0xa5,0x54,0x1b,0x3b,0xa8,0xb1,0x09,0x89,
+0x75,0x76,0x16,0x58,0x86,0x75,0x27,0x8e,0xf9,0x76,0x03,0xa5,0x68,0x60,0x26,0x03,
+0x50,0x27,0x3a,0x08,0xf0,0x0c,0x18,0xca,0xa6,0x4b,0x89,0x98,0x78,0x0b,0x56,0x87,
+0x75,0x1c,0x83,0x77,0x72,0x77,0x17,0x7b,0x75,0x06,0x18,0x28,0x72,0x06,0x34,0x57,
+0x05,0xd2,0x07,0xf2,0x02,0x3b,0x72,0x83,0x81,0x1a,0x49,0x88,0xa4,0x0d,0x99,0x66,
+0x94,0x3d,0x56,0x79,0x82,0x68,0xd2,0x07,0xf1,0x36,0x60,0x07,0x3b,0x20,0x68,0x06,
+0x10,0x60,0x80,0x06,0x15,0x8a,0x83,0x4c,0x93,0x6c,0x61,0x0c,0x67,0xab,0x74,0x2c,
+0x82,0x79,0x31,0x77,0x27,0x6d,0x91,0x06,0x15,0x49,0x90,0x06,0x36,0x57,0x26,0x07,
+0x05,0x71,0x30,0x07,0x35,0x96,0x50,0x7c,0x89,0x86,0x80,0x3c,0x68,0xa9,0x82,0x69,
+0x6b,0xa9,0xb1,0x67,0x2b,0x18,0x80,0x07,0x74,0x5d,0x23,0x08,0x70,0x94,0xc3,0x48,
+0x01,0xf1,0x10,0x12,0x94,0x61,0x07,0x25,0xb7,0x92,0x4c,0x91,0x88,0x30,0x0c,0x47,
+0x7c,0x73,0x2d,0xaa,0x6b,0xb0,0x78,0x29,0x6b,0xb0,0x07,0x15,0xa8,0xa0,0x07,0x49,
+0x10,0x93,0xb8,0x01,0xf5,0x10,0x15,0x18,0x52,0x07,0x29,0xac,0xb6,0x4c,0x89,0x66,
+0x68,0x0c,0x53,0x74,0xa1,0x2c,0x76,0x99,0x94,0x77,0x19,0x4a,0x48,0x06,0x19,0x3a,
+0x38,0x06,0x1a,0x77,0x78,0xd3,0x0e,0xf5,0x0f,0x20,0x4a,0x00,0x07,0x44,0x93,0x92,
+0x1b,0x77,0x77,0x45,0x0a,0x78,0xa7,0x75,0x1b,0x59,0xa8,0x85,0x46,0x22,0x30,0x60,
+0x05,0x29,0x95,0xb1,0x05,0x73,0x18,0x76,0x09,0xf1,0x2c,0x08,0x6d,0x7e,0xe1,0x3c,
+0x96,0x7a,0xa1,0x0e,0x84,0x95,0x81,0x3b,0x85,0xa8,0x71,0x78,0x65,0xb8,0x71,0x07,
+0x65,0xa8,0x61,0x07,0x61,0x40,0x91,0x00,0x00,0x12,0x00,0x8a,0xec,0x6a,0x82,0x86,
+0x07,0x81,0x62,0x83,0x75,0x49,0x30,0x87,0x89,0x0c,0x10,0x87,0x9a,0x1a,0x70,0x88,
+0x88,0xa2,0x93,0x00,0x00,0x20,0xd0,0x02,0x51,0x01,0x01,0x80,0x00,0x09,0x04,0x00,
+0x33,0xc9,0x91,0x09,0x0c,0x00,0xf0,0x05,0x7d,0x9a,0xc9,0x93,0x09,0x99,0xd9,0x93,
+0x01,0x10,0x90,0x00,0x04,0x40,0xd9,0x90,0x04,0x40,0x90,0x00,0x04,0x00,0x32,0x2a,
+0xa8,0xc8,0xa0,0x02,0x21,0x71,0x90,0x04,0x00,0x90,0x08,0x71,0x91,0x82,0x08,0x79,
+0xba,0x40,0x08,0x0c,0x00,0x00,0x04,0x00,0x72,0x72,0x90,0x08,0x4d,0xa9,0x79,0x96,
+0xc1,0x00,0xf0,0x0f,0x40,0x00,0x06,0x15,0xb8,0x60,0x07,0x25,0x50,0x00,0x58,0x9b,
+0xa8,0x82,0x07,0x65,0x32,0x80,0x38,0x05,0x7a,0x00,0x00,0x49,0x80,0x00,0x69,0x50,
+0x00,0x00,0xf1,0x0e,0x29,0xd9,0xac,0x96,0x02,0xc8,0x57,0x33,0x08,0x07,0x5b,0x90,
+0x36,0x7a,0x29,0x00,0x00,0x87,0x27,0x00,0x01,0xa0,0x27,0x07,0x2a,0x10,0x0b,0x98,
+0x00,0x01,0x00,0xf3,0x30,0x08,0x00,0x6c,0x88,0x48,0x00,0x1b,0x6b,0x8c,0x81,0x73,
+0x89,0x7c,0x73,0x49,0xa0,0x9e,0x20,0x05,0x54,0x69,0x90,0x1b,0x49,0x08,0x56,0x72,
+0x00,0x08,0x00,0x00,0x11,0x00,0x00,0x09,0x61,0x98,0x80,0x0c,0x83,0x90,0x90,0x09,
+0x04,0x30,0x54,0x0c,0x84,0xb8,0xc0,0x0a,0x53,0x74,0x90,0x6c,0x41,0x2f,0x30,0x09,
+0x06,0x93,0x95,0x00,0x01,0x00,0x31,0x09,0x00,0x90,0x04,0x00,0xb0,0x0a,0x00,0x90,
+0xb3,0x0c,0x96,0xaa,0x20,0x09,0x00,0xa0,0x10,0x00,0x91,0x04,0x0a,0x24,0x90,0x08,
+0x2d,0x82,0x79,0xa4,0x25,0x00,0x21,0x01,0x80,0x04,0x00,0xf0,0x49,0x19,0x95,0xa0,
+0xa1,0x00,0x74,0xea,0x20,0x00,0xb1,0x89,0x00,0x05,0x61,0x83,0x90,0x3a,0x01,0x80,
+0x3a,0x00,0x1a,0x60,0x00,0x18,0x00,0x09,0x00,0x08,0x64,0x09,0x00,0x00,0x09,0x0c,
+0x87,0x48,0x4c,0x89,0x08,0x00,0x39,0x09,0x27,0x05,0x49,0x05,0x84,0x0a,0x09,0x00,
+0x09,0x35,0x07,0x88,0x97,0x06,0x02,0x40,0x00,0x04,0x46,0xa8,0xc1,0x31,0x0b,0x00,
+0x90,0x18,0x44,0x07,0x70,0x00,0x2b,0x98,0xd0,0x07,0x21,0xa7,0x60,0x19,0x05,0xab,
+0x60,0x11,0x44,0x00,0x34,0x63,0x00,0xf1,0x2d,0x29,0x19,0x8d,0x00,0x00,0x09,0x09,
+0x10,0x57,0x64,0x02,0x72,0x00,0x3d,0x8a,0x90,0x08,0x16,0x4a,0x10,0x28,0x04,0xd9,
+0x10,0x41,0x84,0x02,0x82,0x09,0x10,0x09,0x00,0x02,0x50,0x09,0x00,0x20,0x0d,0x9d,
+0x99,0x18,0x08,0x09,0x09,0x00,0x0c,0x8d,0x89,0x06,0x38,0x09,0x09,0x19,0x0d,0x9d,
+0x99,0x01,0x08,0x00,0x08,0x0e,0x01,0xf0,0x2c,0x36,0xa8,0x90,0x00,0x08,0x10,0x90,
+0x38,0x47,0x00,0x84,0x00,0x29,0x88,0xb1,0x07,0x39,0x00,0x71,0x38,0x0b,0x88,0xc1,
+0x10,0x09,0x00,0x71,0x08,0x30,0x09,0x00,0x00,0x46,0x8c,0x82,0x25,0x00,0x09,0x00,
+0x04,0x28,0x8c,0x85,0x00,0x40,0x82,0x00,0x04,0x51,0x70,0x90,0x0a,0x0b,0x98,0x96,
+0x01,0x00,0x00,0x02,0x60,0x00,0xf1,0x2c,0x01,0x58,0x8d,0x86,0x22,0x09,0x09,0x17,
+0x07,0x1c,0x8c,0x92,0x00,0x28,0x90,0xa0,0x06,0x66,0x4a,0x50,0x09,0x83,0x8a,0x92,
+0x02,0x45,0x10,0x16,0x03,0x00,0x22,0x00,0x04,0x60,0x08,0x00,0x00,0x08,0x9d,0x86,
+0x18,0x20,0x09,0x00,0x00,0x17,0x9d,0x93,0x01,0x80,0x09,0x00,0x08,0x10,0x09,0x00,
+0x09,0x39,0x9d,0x90,0x01,0xf0,0x11,0x05,0x04,0x20,0x00,0x03,0x6c,0x88,0xc0,0x21,
+0x56,0x88,0x40,0x07,0x15,0x99,0x61,0x00,0x8b,0x88,0xa3,0x06,0x38,0x00,0x90,0x19,
+0x0c,0x88,0xc0,0x01,0x08,0x00,0x90,0x24,0x00,0xf0,0x0d,0x19,0x18,0x08,0x44,0x00,
+0x08,0x09,0x44,0x58,0x79,0x5d,0x74,0x01,0x98,0x79,0xc4,0x06,0x18,0x08,0x54,0x09,
+0x17,0x08,0x44,0x54,0x71,0x08,0x44,0x20,0x00,0xd0,0x07,0x22,0x57,0x92,0x00,0x43,
+0x39,0x00,0x24,0x29,0x9d,0x97,0x06,0x68,0x00,0xf1,0x1f,0x35,0x8d,0x82,0x05,0x58,
+0x00,0x35,0x0a,0x09,0x77,0x95,0x01,0x08,0x00,0x45,0x05,0x00,0x13,0x00,0x03,0x78,
+0xab,0x86,0x12,0x03,0x70,0x90,0x08,0x2a,0x87,0x77,0x00,0x18,0x25,0x80,0x02,0x79,
+0x25,0x80,0x0a,0x2a,0x25,0x84,0x17,0x74,0x01,0x88,0x00,0xf0,0x12,0x18,0x15,0x09,
+0x06,0x02,0x29,0x09,0x74,0x42,0x08,0x8d,0x94,0x08,0x09,0x11,0x28,0x01,0x1b,0x77,
+0x78,0x07,0x2c,0x88,0x88,0x0a,0x09,0x00,0x08,0x34,0x09,0x02,0x95,0x01,0x68,0x00,
+0xf1,0x0c,0x4c,0x77,0xb2,0x10,0x0b,0x55,0xa2,0x1a,0x18,0x77,0x81,0x01,0x15,0x05,
+0x02,0x01,0x7c,0x8a,0x82,0x09,0x19,0x09,0x04,0x17,0x1d,0x98,0x88,0xef,0x01,0x00,
+0x48,0x00,0xf1,0x2c,0x58,0xd8,0x81,0x30,0x89,0xc9,0x83,0x57,0x0a,0x06,0x40,0x00,
+0x93,0x70,0x93,0x08,0x45,0x95,0x80,0x36,0x80,0x88,0x53,0x50,0x06,0x70,0x00,0x45,
+0x23,0xa3,0x30,0x07,0x35,0xb5,0x50,0x10,0x36,0xc6,0x60,0x57,0x77,0x87,0x72,0x01,
+0x49,0x77,0xa0,0x09,0x49,0x66,0xa0,0x27,0x49,0x77,0xa0,0x61,0x44,0x06,0x80,0xec,
+0x00,0xf0,0x10,0x00,0x09,0x81,0x02,0x68,0x8c,0x96,0x31,0x82,0x49,0x00,0x28,0x83,
+0x4a,0x62,0x02,0x88,0xb8,0x80,0x09,0x88,0xa7,0x51,0x27,0x83,0x2a,0x77,0x54,0x40,
+0x80,0x96,0x24,0x00,0xf0,0x11,0x24,0x00,0x00,0x08,0x08,0x98,0xa8,0x08,0x10,0x87,
+0xa8,0x08,0x37,0x83,0x98,0x08,0x01,0x83,0x98,0x08,0x09,0x58,0x75,0x08,0x17,0x82,
+0x90,0x08,0x53,0x80,0x43,0x86,0x24,0x00,0x10,0x10,0x8c,0x00,0xf0,0x28,0x89,0x8b,
+0x83,0x40,0x77,0x88,0xa0,0x36,0x88,0x76,0xb0,0x02,0x96,0x78,0xb0,0x09,0x92,0x18,
+0x50,0x45,0x99,0x08,0x82,0x65,0x43,0x66,0x12,0x05,0x26,0x23,0x00,0x11,0x5c,0x7b,
+0x71,0x17,0x6b,0x6b,0x60,0x02,0x5b,0x6b,0x60,0x09,0x0d,0x9c,0x93,0x3a,0x8c,0xa9,
+0x97,0x00,0x03,0x50,0x00,0x04,0x00,0x10,0x01,0x1c,0x02,0xf4,0x0c,0x2b,0x98,0xa0,
+0x10,0x09,0x85,0x90,0x27,0x0a,0x78,0x90,0x01,0x38,0x88,0x81,0x08,0x54,0x77,0x71,
+0x09,0x34,0x77,0x71,0x54,0xaa,0xcb,0xb6,0x08,0x03,0xf1,0x0c,0x07,0x2c,0xeb,0x90,
+0x10,0x1a,0x29,0x91,0x39,0x95,0x55,0x59,0x00,0x0b,0x77,0xa0,0x06,0x2b,0x66,0xa0,
+0x09,0x0b,0x66,0xa0,0x24,0x09,0x03,0xd0,0x00,0xf0,0x91,0x35,0x08,0x57,0x70,0x05,
+0x8c,0xbc,0xc3,0x50,0x83,0xa7,0x95,0x25,0x77,0x97,0x82,0x04,0x87,0xc7,0x93,0x18,
+0x35,0x90,0x90,0x72,0x35,0x84,0x80,0x10,0x00,0x80,0x00,0x22,0x00,0x50,0x00,0x07,
+0x7a,0x79,0x72,0x20,0x88,0x24,0x90,0x45,0x67,0x44,0x80,0x01,0x29,0xc9,0x50,0x09,
+0x6a,0x09,0x80,0x63,0x29,0x54,0x91,0x20,0x06,0x20,0x01,0x53,0x09,0x05,0x30,0x06,
+0x7c,0x8b,0xa2,0x30,0x08,0xa9,0x20,0x45,0x78,0xc8,0x83,0x01,0x84,0x84,0x44,0x08,
+0x89,0x96,0x94,0x44,0x95,0xc5,0x84,0x60,0x80,0x80,0x83,0x24,0x08,0x00,0x54,0x05,
+0x6c,0x78,0x30,0x20,0x6a,0x77,0x11,0x35,0x89,0x98,0xa3,0x02,0x79,0x87,0x70,0x07,
+0x6b,0x77,0x70,0x16,0x08,0x17,0x70,0x30,0x08,0x22,0x70,0x22,0x06,0x05,0x00,0x06,
+0x88,0x89,0x21,0x20,0x96,0x9b,0x86,0x25,0x78,0xab,0x61,0x01,0x9b,0x75,0xa0,0x08,
+0x59,0x61,0xa0,0x26,0x70,0x88,0xb1,0x63,0x66,0x87,0x18,0xa4,0x00,0xf0,0x11,0x26,
+0x00,0x90,0x00,0x17,0x47,0xcd,0xd3,0x42,0x74,0xb5,0x52,0x05,0x73,0x8b,0x90,0x02,
+0x87,0x6a,0xa0,0x09,0x85,0x78,0x80,0x27,0x83,0x58,0x50,0x64,0x66,0x96,0x64,0x24,
+0x00,0xf4,0x11,0x32,0x30,0x40,0x30,0x06,0x95,0xa8,0x90,0x30,0x96,0x65,0x84,0x26,
+0x76,0x9a,0x44,0x02,0x56,0x88,0x80,0x09,0x56,0x55,0x70,0x27,0x36,0x66,0xb1,0x52,
+0x00,0x26,0x90,0xf0,0x03,0x10,0x01,0x73,0x00,0xf1,0x04,0x33,0x60,0x91,0x09,0x06,
+0x90,0x80,0x00,0x0a,0x71,0x00,0x00,0x75,0x0a,0x10,0x19,0x60,0x01,0x86,0x20,0x00,
+0xf0,0x00,0x04,0x40,0x00,0x00,0x04,0xb8,0x82,0x00,0x05,0x50,0x00,0x09,0x77,0x77,
+0x90,0x04,0x00,0xf1,0x1e,0x04,0x12,0x30,0x40,0x27,0x17,0x54,0x73,0x20,0x02,0x01,
+0x01,0x00,0x70,0x71,0x00,0x08,0xc8,0xd8,0x20,0x00,0x08,0x45,0x30,0x00,0x3a,0x77,
+0xc0,0x03,0xd8,0x88,0xc4,0x4a,0x10,0x24,0x18,0x08,0x35,0x86,0x36,0x07,0x04,0x24,
+0xa2,0x00,0x31,0x03,0x61,0x40,0x00,0x09,0x66,0x66,0x90,0x40,0x00,0x30,0x44,0x44,
+0x42,0x04,0x00,0xf1,0x3d,0x05,0x88,0x89,0x94,0x08,0x83,0x48,0x42,0x62,0x50,0x34,
+0xa0,0x04,0x20,0x00,0x00,0x1d,0x99,0xaa,0x90,0x79,0x34,0x85,0x30,0x4c,0xaa,0xcb,
+0xa0,0x08,0x34,0x85,0x30,0x69,0x88,0x88,0x92,0x36,0x62,0x90,0xa0,0x50,0x22,0x31,
+0x32,0x01,0x60,0x60,0x00,0x09,0x98,0xd8,0x81,0x7d,0x77,0xc7,0x50,0x19,0x44,0xb4,
+0x30,0x09,0x33,0xb3,0x20,0x08,0x77,0x87,0x81,0x28,0x43,0x81,0xa0,0x40,0x22,0x22,
+0x23,0xc7,0x00,0xf1,0x10,0xa3,0x08,0x70,0x08,0x6b,0x18,0x23,0x36,0x79,0x8e,0x95,
+0x25,0x93,0x0d,0x50,0x08,0x60,0x92,0xa2,0x24,0x05,0x20,0x24,0x19,0x16,0x53,0x82,
+0x31,0x04,0x03,0x04,0x38,0x04,0xf2,0x10,0x01,0x76,0x20,0x08,0x29,0x55,0xb0,0x78,
+0x89,0x66,0xb0,0x79,0x39,0x66,0xb0,0x09,0x06,0x86,0x80,0x0d,0x40,0x65,0x00,0x37,
+0x89,0x42,0x81,0x80,0x43,0x98,0x64,0x6a,0x05,0xf1,0x0f,0x06,0x00,0x08,0x07,0xb3,
+0xa2,0x58,0x78,0xb7,0xc5,0x68,0x49,0x66,0x77,0x08,0x05,0x31,0x80,0x0a,0x22,0x97,
+0xa0,0x07,0x80,0x91,0x80,0x71,0x18,0xba,0xa5,0xd0,0x00,0xf3,0x14,0x37,0x20,0x00,
+0x00,0xba,0x96,0x9b,0x90,0x08,0x88,0x62,0x67,0x00,0x88,0x86,0x99,0x60,0x08,0x88,
+0x73,0x04,0x00,0x78,0x47,0x88,0x60,0x35,0x80,0xa2,0x00,0x07,0x08,0x01,0x8a,0x90,
+0x6b,0x02,0x12,0x90,0x75,0x05,0xf2,0x07,0x99,0xd9,0x91,0x09,0x00,0x00,0x00,0x0a,
+0x99,0x9a,0x00,0x08,0x00,0x0a,0x00,0x27,0x00,0x0a,0x00,0x71,0x00,0x0a,0xdb,0x05,
+0xf1,0x10,0x80,0x99,0x94,0x08,0x80,0x90,0x00,0x0c,0xb6,0xc8,0x84,0x09,0x00,0xa6,
+0x36,0x0c,0xa3,0x89,0x82,0x17,0x54,0x77,0xa0,0x45,0x58,0x49,0xb0,0x61,0x5b,0x74,
+0x28,0xb9,0x05,0xf2,0x0a,0x98,0x8d,0x80,0x07,0x20,0x09,0x00,0x0b,0x99,0x9d,0x94,
+0x00,0x03,0x99,0x00,0x00,0x4a,0x09,0x00,0x19,0x70,0x09,0x00,0x32,0x01,0x20,0x06,
+0xf1,0x31,0x02,0x70,0x08,0x00,0x18,0x70,0xad,0xa6,0x3b,0xc5,0x3a,0x43,0x42,0x73,
+0x55,0xb5,0x16,0xc7,0x88,0xc8,0x25,0x70,0x80,0x80,0x00,0x70,0x43,0x80,0x00,0x70,
+0x06,0xb0,0x00,0x80,0x81,0x00,0x80,0x80,0x83,0x80,0x78,0xa8,0xc9,0x91,0x00,0x90,
+0xa5,0x00,0x79,0xa0,0xb8,0x00,0x34,0x80,0x89,0x00,0x72,0x88,0x35,0x60,0x60,0xb6,
+0x00,0x81,0x45,0x00,0xf1,0x0c,0x06,0x10,0x00,0x58,0x8c,0x98,0x82,0x39,0x6a,0x95,
+0x70,0x02,0x39,0x54,0x00,0x58,0xab,0xa7,0x90,0x78,0x9b,0x99,0x93,0x00,0x08,0x10,
+0x00,0x04,0x00,0xf0,0x10,0x00,0x80,0x00,0x5c,0x80,0x98,0xc5,0x08,0x06,0x80,0x80,
+0x2b,0x47,0x80,0x90,0x1a,0x55,0x77,0xc3,0x08,0x03,0x50,0x80,0x4b,0x79,0x10,0x80,
+0x00,0x44,0x48,0x87,0x43,0x00,0xf2,0x0c,0x5c,0x99,0x76,0xa4,0x07,0x18,0x77,0xb4,
+0x4c,0x98,0x77,0xb4,0x07,0x18,0x87,0xb4,0x1a,0xa2,0x89,0x00,0x54,0x05,0x49,0x04,
+0x00,0x58,0x07,0x20,0x00,0xf0,0x05,0x89,0x8c,0x88,0x08,0x09,0x6b,0x68,0x4c,0x79,
+0x4a,0x48,0x08,0x02,0x3b,0x32,0x09,0x66,0x8d,0x86,0x6d,0xed,0x05,0x30,0x38,0x8d,
+0x88,0x9f,0x06,0xf1,0x0c,0x2a,0x57,0x09,0x08,0x07,0x05,0x88,0x84,0x2c,0x47,0x8b,
+0x86,0x07,0x06,0x9b,0x86,0x08,0x37,0x72,0x58,0x3b,0x67,0x72,0x58,0x00,0x07,0x72,
+0xad,0x04,0xf0,0x21,0x7c,0x4a,0xbb,0xc0,0x07,0x29,0x99,0x91,0x6c,0x28,0x88,0x70,
+0x07,0x09,0x11,0x90,0x08,0x09,0xca,0x80,0x88,0x7c,0x06,0x80,0x00,0x08,0x72,0x52,
+0x00,0x70,0x80,0x00,0x04,0x60,0x80,0x00,0x0b,0x99,0xc9,0x93,0x15,0x00,0x80,0x00,
+0x04,0x99,0xc9,0x91,0xb4,0x00,0x00,0x04,0x00,0xf0,0x0e,0x29,0x99,0xc9,0x97,0x0a,
+0x89,0xc8,0xd0,0xa7,0x8c,0x7c,0x09,0x01,0x90,0x90,0xb8,0x9c,0x8d,0x08,0x00,0x80,
+0x91,0x60,0x08,0x09,0x71,0x00,0x86,0xa0,0x98,0x01,0xf2,0x0b,0x8c,0x88,0xa0,0x0a,
+0x5b,0x65,0xa0,0x08,0x9b,0xa8,0x80,0x01,0x90,0x2b,0x10,0x48,0x70,0x19,0xa5,0x00,
+0x90,0x19,0x00,0x09,0x40,0x19,0x24,0x03,0xf3,0x8b,0x10,0x41,0x00,0x7a,0xb1,0xc8,
+0xb1,0x75,0x78,0x77,0x60,0x7a,0xb1,0x7a,0x70,0x75,0x76,0x98,0xa3,0x7a,0xb0,0x80,
+0x80,0x60,0x00,0xc8,0xc0,0x00,0x00,0x80,0x80,0x08,0x78,0xb7,0xc0,0x08,0x66,0xa5,
+0xb0,0x04,0xb9,0x7c,0x70,0x06,0xb9,0x7c,0x72,0x28,0xb9,0x8c,0x86,0x03,0x93,0x08,
+0x71,0x05,0x00,0x00,0x23,0x07,0x09,0x05,0x30,0x4b,0x9c,0x8d,0x81,0x82,0x55,0x54,
+0x62,0x24,0x62,0x2a,0x10,0x03,0x88,0x87,0x10,0x0b,0x5b,0x55,0x90,0x0c,0x6c,0x66,
+0x90,0x0c,0x7c,0x77,0x90,0x09,0x8c,0x8b,0x20,0x48,0x98,0xaa,0x70,0x8a,0xa7,0xbc,
+0xb1,0x57,0x66,0x66,0x90,0x35,0xb9,0x9b,0x30,0x05,0x75,0x5a,0x00,0x59,0x86,0x6b,
+0x62,0x00,0x00,0x20,0x10,0x00,0x89,0xa3,0x85,0x40,0x29,0xd4,0x59,0xd6,0x01,0x11,
+0x88,0x08,0x10,0x09,0x66,0x40,0x74,0x00,0x87,0x6a,0x6b,0x00,0x00,0x16,0x4b,0x50,
+0x00,0x49,0x59,0x69,0x68,0x02,0xe5,0x81,0x00,0x79,0xd9,0x98,0x90,0x00,0x09,0x90,
+0x00,0x09,0xb9,0x99,0x9c,0x06,0x00,0xf1,0x11,0x06,0x00,0x80,0x00,0x4c,0x81,0xd8,
+0x80,0x70,0x78,0x20,0x80,0x70,0x75,0x40,0x80,0x78,0xc0,0x74,0x80,0x70,0x70,0x04,
+0x80,0x79,0xa0,0x00,0x90,0x70,0x00,0x48,0x70,0x3d,0x02,0xf1,0x07,0x20,0x04,0x00,
+0x00,0x90,0x27,0x00,0x68,0x98,0x98,0x82,0x17,0x60,0x28,0x70,0x39,0x88,0x98,0x60,
+0x08,0x44,0x82,0x04,0x00,0x40,0x7c,0xaa,0xc9,0xb3,0x24,0x06,0xf0,0x0d,0x8c,0xeb,
+0x4a,0x83,0x82,0x29,0x72,0x00,0x87,0xb5,0x16,0x50,0x47,0x76,0x10,0x20,0x0b,0x9b,
+0xc8,0x70,0x09,0x26,0x80,0x70,0x7c,0x9b,0xc8,0xc3,0xb7,0x05,0xf2,0x16,0x2b,0x77,
+0xa8,0x70,0x7a,0x9a,0x97,0x91,0x45,0x37,0x77,0x30,0x80,0x69,0x86,0x82,0x0a,0x99,
+0xb8,0x60,0x08,0x43,0x81,0x70,0x6c,0xa9,0xc8,0xb3,0xa9,0x99,0x9a,0xa8,0x88,0x8a,
+0x90,0x00,0x09,0x06,0x00,0x30,0xa9,0x99,0x9a,0x15,0x03,0xf1,0x00,0x01,0x50,0x00,
+0x18,0x8a,0xa8,0x85,0x03,0x98,0x87,0x80,0x03,0xa7,0x77,0xa0,0x04,0x00,0xf1,0x55,
+0x85,0x55,0xa0,0x03,0x73,0x33,0x90,0x38,0x88,0x88,0x87,0x07,0x10,0x00,0x00,0x71,
+0x79,0x8d,0x4c,0x68,0x98,0xd0,0xe6,0x71,0x09,0x6a,0x78,0x98,0xd7,0x71,0x71,0x09,
+0x07,0x17,0x98,0xd0,0x71,0x61,0x08,0x00,0x00,0x13,0x20,0x17,0x7c,0x64,0x10,0x17,
+0xa9,0x77,0x50,0x58,0xd7,0x77,0x72,0x0a,0xb7,0x77,0x70,0x84,0xb6,0x67,0x70,0x01,
+0xa6,0x67,0x70,0x01,0xb7,0x78,0x70,0x00,0x00,0x60,0x00,0x07,0x79,0xa7,0x74,0x02,
+0xb8,0x88,0x90,0x02,0xc9,0x99,0x90,0x02,0xa6,0x66,0x90,0x29,0xb7,0x77,0xc5,0x02,
+0x82,0x07,0x61,0x05,0x8a,0x06,0xf2,0x2b,0x01,0x30,0x78,0x8a,0x96,0x60,0x78,0x9b,
+0x89,0xb3,0x70,0x96,0x11,0x44,0x77,0x77,0xa9,0xa2,0x70,0xc7,0x88,0x90,0x78,0x38,
+0x24,0xa1,0x10,0x43,0x00,0x70,0x06,0x00,0x00,0x02,0xc9,0x79,0x8d,0x81,0x90,0x80,
+0x96,0x9d,0x99,0x09,0x02,0x90,0x80,0x90,0x69,0x58,0x09,0x0a,0x08,0x98,0xd8,0x30,
+0x08,0x08,0x6e,0x01,0xf0,0x2b,0x11,0x10,0x5c,0x86,0x7c,0x75,0x08,0x09,0x7c,0x78,
+0x4b,0xa9,0x6c,0x68,0x87,0x78,0x7c,0x78,0x17,0x74,0x65,0x00,0x0b,0x91,0xe6,0x00,
+0x03,0x09,0x14,0x96,0x11,0x10,0x05,0x00,0x3c,0x69,0xb9,0x86,0x09,0x04,0xba,0x44,
+0x2c,0xab,0x8b,0x51,0x88,0x84,0xac,0x71,0x08,0x83,0x9b,0x61,0x0b,0x53,0x9c,0x74,
+0xab,0x06,0x00,0x01,0x00,0xf1,0x0d,0x6c,0x89,0x7b,0x70,0x17,0x08,0x7b,0x71,0x5a,
+0x88,0x6b,0x61,0xc4,0x87,0x8b,0x92,0x44,0x85,0x35,0x91,0x3a,0x77,0x64,0x90,0x22,
+0x02,0x14,0xa0,0xf2,0x03,0x21,0x99,0x99,0x29,0x00,0xf1,0x83,0x69,0x9c,0xa9,0x92,
+0x04,0x18,0x14,0x00,0x0a,0x08,0x14,0x70,0x83,0x08,0x10,0xa0,0x10,0x7b,0x00,0x10,
+0x00,0x80,0x06,0x20,0x19,0xe7,0x6d,0xb4,0x28,0xa6,0x88,0x75,0x02,0x85,0x67,0x50,
+0x01,0x33,0x33,0x30,0x18,0x88,0xc8,0x85,0x05,0x60,0x83,0x80,0x17,0x18,0x60,0x34,
+0x37,0x90,0x08,0x00,0x29,0x02,0x28,0x50,0x7c,0x98,0x28,0x71,0x0d,0x59,0x08,0x14,
+0x5b,0x60,0x08,0x90,0x88,0x00,0x04,0x80,0x08,0x00,0x7a,0x00,0x08,0x3c,0x60,0x00,
+0x16,0x80,0x60,0x00,0x29,0x14,0xbb,0xa3,0x6c,0x9a,0x09,0x60,0x0c,0x34,0x39,0x60,
+0x2d,0x96,0x39,0x80,0x88,0x19,0x09,0x53,0x17,0x14,0x09,0x12,0x07,0x00,0x66,0x00,
+0x03,0x70,0x24,0x00,0x3a,0x24,0xa8,0xc0,0x3a,0x74,0x79,0x40,0x2c,0x67,0x79,0x00,
+0x1d,0x90,0x88,0xb5,0x88,0x17,0x63,0xb0,0x17,0x10,0x2d,0x20,0x07,0x29,0x22,0x07,
+0x01,0xac,0x07,0xf1,0x4d,0x2a,0x69,0x88,0xc1,0x3a,0x68,0x66,0xa1,0x0c,0x56,0x88,
+0x83,0x2d,0x90,0x09,0x00,0x98,0x14,0x8c,0x81,0x17,0x10,0x09,0x00,0x07,0x28,0x8d,
+0x84,0x02,0x50,0x24,0x60,0x4b,0x29,0x66,0x60,0x4b,0x63,0x38,0x40,0x1c,0x48,0x7c,
+0xb0,0x2d,0x89,0x6b,0xb0,0x88,0x2c,0x8c,0xc3,0x08,0x08,0x00,0x80,0x08,0x08,0x01,
+0x90,0x02,0x80,0x09,0x00,0x4b,0x67,0xad,0xa2,0x5b,0xa6,0x69,0x62,0x0a,0x45,0x76,
+0xa0,0x2c,0xa7,0x76,0xb0,0x87,0x36,0x76,0xb0,0x06,0x22,0xa8,0x90,0x06,0x49,0x20,
+0x83,0x64,0x00,0xf1,0x26,0x20,0x02,0x43,0x2b,0x45,0x99,0x72,0x3a,0x64,0x8c,0x85,
+0x1b,0x46,0xaa,0xa7,0x0d,0x92,0x55,0x58,0x68,0x13,0x77,0x55,0x26,0x15,0x59,0x14,
+0x06,0x26,0x87,0x86,0x00,0x07,0x00,0x00,0x68,0x8b,0x98,0xa0,0x90,0x60,0x52,0x80,
+0x39,0x30,0x07,0x70,0x06,0x8a,0x88,0x20,0x00,0x09,0xe8,0x0a,0x50,0x00,0x58,0x8d,
+0x88,0x80,0x64,0x02,0xf1,0x4d,0x1b,0x88,0xa8,0x87,0x15,0x94,0x09,0x45,0x06,0x21,
+0x66,0x60,0x28,0x8a,0xbb,0x96,0x00,0x0b,0x82,0x00,0x02,0x94,0x09,0x61,0x16,0x10,
+0x00,0x25,0x00,0x06,0x00,0x00,0x97,0xa8,0x98,0xb3,0x48,0x55,0x17,0x91,0x09,0x89,
+0x77,0x80,0x09,0x78,0x73,0x90,0x09,0x39,0xa0,0x90,0x09,0x65,0x33,0x90,0x0b,0x77,
+0x77,0x90,0x06,0x00,0x09,0x00,0x17,0x39,0x09,0x08,0x46,0x76,0x89,0x85,0x33,0x88,
+0x9b,0x86,0x15,0x76,0x9b,0x85,0x06,0x89,0x73,0x48,0x5a,0x89,0x73,0x48,0x00,0x08,
+0x63,0x77,0xa4,0x00,0xf1,0x10,0x40,0x05,0x00,0x29,0x88,0x78,0xa3,0x3b,0x99,0x8a,
+0xb4,0x08,0x66,0x66,0x72,0x0b,0x69,0x96,0x94,0x08,0x52,0x26,0x80,0x08,0x6a,0x72,
+0x82,0x44,0x55,0x80,0xa8,0x6f,0x08,0xf1,0x10,0x00,0x60,0x00,0x59,0xc8,0xac,0x82,
+0x48,0xaa,0x99,0x70,0x03,0x3a,0x43,0x90,0x0a,0x4a,0x44,0x30,0x08,0xaf,0x87,0xb0,
+0x04,0xa9,0x00,0x90,0x58,0x08,0x07,0x30,0x22,0x07,0xf2,0x2f,0x10,0x42,0x00,0x1b,
+0xc9,0xcb,0x96,0x15,0xa9,0xb8,0x90,0x13,0x34,0x93,0x32,0x25,0x55,0x5a,0x64,0x18,
+0xa8,0x8b,0x95,0x00,0x85,0x07,0x10,0x00,0x04,0x6b,0x10,0x07,0x11,0x71,0x10,0x98,
+0xab,0x8c,0x61,0x19,0x66,0x67,0x60,0x0a,0x66,0x67,0x70,0x0b,0x88,0x89,0x70,0x03,
+0xb4,0x5a,0x20,0x59,0xc7,0x8b,0x72,0x4a,0x10,0x17,0xc1,0x05,0xf0,0x50,0x00,0x24,
+0x00,0x2b,0xc7,0x98,0xb5,0x18,0x88,0xb7,0x94,0x08,0x77,0x77,0x57,0x01,0xb7,0x77,
+0x90,0x01,0xa5,0x55,0x50,0x01,0x92,0x22,0xa0,0x01,0xb7,0x77,0xc0,0x06,0x00,0x15,
+0x00,0x3b,0xc8,0xa9,0xc6,0x28,0xa8,0x47,0xb4,0x0c,0x7c,0x55,0x09,0x0b,0x4b,0x54,
+0x09,0x0a,0x66,0x54,0x09,0x1c,0x9b,0x56,0x83,0x27,0x14,0x64,0x00,0x05,0x00,0x50,
+0x00,0x3b,0xba,0xac,0x72,0x87,0xbb,0x6c,0x80,0x37,0xa6,0x80,0x80,0x57,0xaa,0x80,
+0x90,0x47,0xa7,0x83,0x60,0x58,0xb7,0x80,0x25,0x00,0x70,0x78,0x92,0xc8,0x00,0xf1,
+0x2d,0x4a,0xc9,0xab,0x83,0x30,0x69,0x84,0x20,0x38,0x87,0x77,0x83,0x18,0x68,0x86,
+0x80,0x07,0x88,0x88,0x80,0x07,0xb2,0x8a,0x40,0x42,0x06,0x20,0x53,0x05,0x10,0x41,
+0x00,0x4a,0xc7,0xba,0x82,0x29,0x49,0x38,0x70,0x79,0xba,0xab,0x82,0x16,0x5a,0x38,
+0x60,0x07,0x5a,0x38,0x60,0x28,0x6b,0x6b,0x32,0x57,0x66,0xb3,0xa3,0x37,0x02,0xf4,
+0x10,0x82,0x09,0x00,0x25,0x88,0x09,0x00,0x05,0x94,0x0a,0x87,0x39,0xc7,0x09,0x00,
+0x07,0xd3,0xba,0x88,0x36,0x96,0x70,0x09,0x10,0x81,0xc8,0x89,0x00,0x81,0x70,0x09,
+0xa3,0x09,0xf2,0x11,0x27,0x22,0x3a,0x31,0x59,0x83,0x5b,0x52,0x2a,0x52,0x6c,0x61,
+0x5d,0x86,0x77,0x75,0x0e,0x64,0x97,0xa2,0x5b,0x54,0x96,0xa2,0x58,0x04,0x96,0xa2,
+0x07,0x04,0x42,0xa1,0xf7,0x06,0xf0,0x2c,0x35,0x60,0x07,0x8c,0x43,0x00,0x03,0xc8,
+0x9a,0x00,0x01,0x2c,0x84,0x50,0x04,0xd7,0x56,0xe1,0x05,0x84,0xa4,0x25,0x06,0x70,
+0x92,0x91,0x05,0x09,0x70,0x14,0x00,0x40,0x00,0x00,0x07,0x32,0x9c,0x96,0x5a,0xa2,
+0x07,0x10,0x19,0x63,0x07,0x10,0x6a,0x77,0x07,0x10,0x25,0x46,0x07,0x10,0x72,0x77,
+0x9c,0x97,0x10,0x40,0x00,0xf0,0x2a,0x30,0x00,0x00,0x06,0x34,0xc8,0xc0,0x2a,0x91,
+0x90,0x80,0x18,0x62,0xb3,0x88,0x3c,0x87,0xa8,0x64,0x14,0x54,0x77,0x90,0x54,0x7a,
+0x5a,0xa3,0x20,0x14,0x50,0x05,0x0b,0x7c,0x89,0x60,0xa6,0xb6,0x76,0x06,0xc8,0xa8,
+0x30,0x6b,0xa4,0x60,0x1a,0xaa,0x88,0x60,0x54,0x74,0x80,0x45,0x2a,0x02,0x60,0x02,
+0xb7,0x07,0xf1,0x4c,0x18,0x9c,0xc0,0x98,0x58,0x08,0x80,0x28,0x58,0x8c,0xc0,0x98,
+0x99,0x08,0x80,0x54,0x68,0x08,0x80,0x87,0x59,0x8c,0xc0,0x52,0x08,0x00,0x70,0x05,
+0x00,0x60,0x00,0x08,0x32,0xc8,0xa0,0x98,0x69,0x97,0x30,0x39,0x40,0x8b,0x30,0x99,
+0xa8,0x61,0x73,0x44,0x50,0x07,0x10,0x87,0x52,0x86,0x00,0x21,0x00,0x02,0x60,0x00,
+0x20,0x00,0x00,0x06,0x30,0xc8,0xc0,0x29,0x81,0x80,0x80,0x3a,0x61,0xb7,0xc0,0x3c,
+0x86,0x80,0x80,0x23,0x34,0xc8,0xc0,0x45,0x76,0x80,0x80,0x61,0x56,0xc8,0xc5,0xdc,
+0x00,0xf1,0x10,0x60,0x08,0x00,0x08,0x24,0x8c,0x87,0x4b,0x90,0x08,0x00,0x08,0x52,
+0x89,0x85,0x4b,0x77,0x88,0x84,0x15,0x63,0x80,0x17,0x54,0x64,0xb7,0x87,0x30,0x00,
+0x90,0x27,0x84,0x00,0xf4,0x2e,0x06,0xc8,0xb0,0x76,0x65,0x73,0x70,0x38,0x2a,0x8c,
+0xc0,0x77,0x78,0x8c,0xc0,0x23,0x58,0x00,0x40,0x66,0x68,0x00,0x22,0x53,0x15,0x88,
+0x91,0x05,0x00,0x41,0x00,0x08,0x37,0xab,0x82,0x66,0x70,0xa1,0x40,0x6b,0x27,0x97,
+0xc0,0x37,0x95,0x64,0x42,0x66,0x72,0x78,0x00,0x76,0x65,0x48,0x03,0x75,0x3a,0x07,
+0x94,0x00,0x00,0x5a,0x0e,0xf1,0x0f,0x70,0x00,0x07,0x38,0xc9,0x96,0x78,0x50,0x76,
+0x62,0x18,0x37,0xc8,0x80,0x69,0x82,0x87,0x36,0x33,0x58,0x99,0x18,0x76,0x67,0x26,
+0x62,0x42,0x08,0x06,0x10,0x8c,0x00,0x00,0x54,0x03,0xf1,0x0c,0x07,0x99,0x93,0x65,
+0x87,0x47,0x90,0x5b,0x38,0x55,0x80,0x8a,0xb2,0x46,0x41,0x43,0x55,0x8c,0x81,0x87,
+0x80,0x08,0x00,0x85,0x18,0x9c,0x84,0x27,0x0a,0x00,0x14,0x0b,0xf0,0x0c,0x22,0xb8,
+0xa0,0x78,0x55,0x88,0x60,0x18,0x48,0x8b,0x93,0x7a,0xa5,0x2d,0x81,0x33,0x40,0x7b,
+0x70,0x76,0x58,0x68,0x83,0x42,0x01,0x86,0x02,0x24,0x00,0xf2,0x4d,0x7d,0xd8,0xc8,
+0x90,0x76,0x74,0x4c,0x10,0x56,0x97,0x84,0x90,0x05,0xc9,0x71,0x00,0x18,0xc9,0x6a,
+0x50,0x14,0x39,0x17,0x20,0x35,0x3a,0x02,0x70,0x05,0x00,0x15,0x00,0x08,0x37,0x88,
+0xa0,0x88,0x68,0x77,0xc0,0x29,0x47,0x68,0xb0,0x88,0xa6,0x6a,0x70,0x44,0x51,0x8c,
+0x60,0x77,0x59,0x29,0x90,0x54,0x13,0x67,0x22,0x05,0x00,0x05,0x00,0x08,0x38,0x78,
+0xa0,0x67,0x69,0x55,0xa0,0x3a,0x39,0x22,0x20,0x79,0xac,0x8b,0xa4,0x44,0x5c,0x9b,
+0xb4,0x87,0x6b,0x37,0x64,0x53,0x27,0x33,0x73,0xa8,0x00,0xf2,0x0f,0x13,0x50,0x07,
+0x29,0x87,0x70,0x88,0x58,0x9b,0xc1,0x27,0x55,0xb6,0x62,0x77,0x81,0xc7,0x70,0x55,
+0x64,0xa5,0x60,0x76,0x59,0x6b,0x81,0x00,0x02,0x20,0x11,0xf0,0x00,0xf1,0x30,0x18,
+0x00,0x17,0x48,0x9c,0x93,0x98,0x57,0x8b,0x81,0x28,0x47,0x58,0xa2,0x99,0xa9,0x9c,
+0xa2,0x33,0x50,0xac,0x30,0x86,0x78,0x58,0x92,0x64,0x03,0x08,0x02,0x04,0x00,0x23,
+0x00,0x07,0x3b,0x88,0x78,0x78,0x57,0x87,0x77,0x39,0x49,0x07,0x30,0x88,0x9d,0x77,
+0x78,0x43,0x58,0x76,0x68,0x76,0x47,0x77,0x78,0x20,0x07,0x70,0x07,0x00,0x78,0x01,
+0xf0,0x2b,0x39,0x52,0x26,0x69,0x5b,0x95,0x69,0x09,0x60,0x65,0x49,0x9a,0x35,0xc5,
+0x23,0x57,0x54,0x80,0x77,0x67,0x88,0x80,0x75,0x28,0x73,0xa7,0x04,0x00,0x22,0x00,
+0x07,0x38,0x98,0xb0,0x87,0x57,0x9a,0x90,0x28,0x37,0x59,0x80,0x6a,0x96,0x88,0x90,
+0x30,0x30,0x26,0x30,0x77,0x78,0x74,0x81,0x64,0x14,0x98,0x72,0xf4,0x45,0x00,0x00,
+0x00,0x00,0x07,0x00,0x09,0x00,0x08,0x29,0xad,0xa2,0x88,0x69,0x98,0x82,0x29,0x48,
+0x87,0x72,0x78,0x9a,0xaa,0xd0,0x45,0x59,0x55,0xb0,0x87,0x57,0xb7,0xa0,0x31,0x06,
+0x10,0x42,0x04,0x10,0x06,0x00,0x08,0x08,0x79,0x77,0x57,0x89,0x77,0x77,0x3a,0x19,
+0x77,0x74,0x3b,0x6a,0x46,0x77,0x33,0x1b,0xaa,0xb8,0x3a,0x88,0x46,0x77,0x31,0x54,
+0x46,0x87,0x0b,0x8c,0x9b,0xa5,0x1a,0xab,0xda,0xa5,0x01,0x79,0x86,0x50,0x03,0x85,
+0x55,0x90,0x04,0x00,0xf0,0xf2,0x29,0x97,0x77,0xc5,0x00,0x70,0x06,0x20,0x08,0xa9,
+0x9b,0x83,0x04,0x89,0xc8,0x80,0x14,0x45,0xa4,0x43,0x15,0x57,0x95,0x54,0x08,0x8d,
+0xd9,0x85,0x01,0x78,0x1a,0x40,0x28,0x30,0x00,0x56,0x00,0x60,0x06,0x00,0x27,0x89,
+0x98,0x70,0x06,0x7a,0x97,0x40,0x57,0x8a,0x98,0x72,0x36,0xc3,0x83,0x70,0x57,0xc7,
+0xa9,0xa2,0x68,0xc7,0x3d,0x21,0x07,0x75,0x86,0x93,0x00,0x23,0x00,0x00,0x39,0xa6,
+0x6a,0x78,0x3a,0xd8,0x68,0x68,0x29,0xa8,0x48,0x48,0x68,0xa7,0x3a,0x68,0x48,0xa9,
+0x58,0x48,0x49,0xaa,0x07,0x08,0x43,0x07,0x47,0x66,0x3b,0x79,0x98,0x86,0x09,0xbf,
+0xad,0xc6,0x09,0x69,0x96,0xb0,0x07,0x78,0x77,0x90,0x16,0xb6,0x6c,0x62,0x27,0xd7,
+0x7d,0x85,0x26,0x10,0x00,0x53,0x00,0x08,0x00,0x50,0x08,0x8c,0x8a,0x40,0x00,0x08,
+0x56,0x00,0x68,0xae,0x98,0x82,0x29,0xd9,0x78,0x30,0x42,0xb7,0x79,0x50,0x01,0x70,
+0x04,0x50,0x01,0xc8,0x8a,0x50,0x07,0x10,0x06,0x80,0x6c,0x96,0xaa,0x00,0x4b,0x80,
+0x0b,0x61,0x07,0x15,0x9b,0x30,0x6e,0xb2,0x0a,0x63,0x2d,0xa7,0x9b,0x30,0x87,0x30,
+0x09,0x05,0x07,0x10,0x0a,0x84,0x08,0x00,0x00,0x00,0x4b,0x57,0x8b,0xc0,0x4c,0x76,
+0x6a,0xb0,0x2a,0x24,0x7b,0x80,0x4e,0x88,0x7b,0x94,0x3d,0x98,0x08,0x84,0x99,0x08,
+0x97,0x94,0x08,0x07,0x00,0x83,0x00,0x00,0x10,0x10,0x5b,0xc6,0x42,0x61,0x1a,0x99,
+0x74,0xb2,0x15,0x8c,0xa8,0x99,0x1a,0x93,0x43,0x13,0x16,0xa8,0xb6,0x87,0x68,0xa2,
+0xa6,0x54,0x00,0x85,0x56,0x30,0x00,0x01,0x00,0xf1,0x0c,0x80,0x00,0x00,0x4b,0xb9,
+0x97,0xa4,0x28,0x98,0x5b,0xb1,0x56,0x54,0x78,0x85,0x3a,0x97,0x77,0xb5,0x04,0xb9,
+0x99,0x80,0x39,0xa9,0x99,0xc5,0x1e,0x00,0xf4,0x10,0x80,0x91,0x30,0x27,0xc0,0xa7,
+0x30,0x36,0xb0,0x76,0x90,0x04,0x77,0x77,0x00,0x09,0x44,0x4a,0x00,0x09,0x33,0x3a,
+0x00,0x09,0x66,0x6b,0x00,0x09,0x00,0x3b,0x00,0x01,0x00,0xf4,0x35,0x06,0x51,0x62,
+0x10,0x1a,0x19,0x69,0x81,0x27,0x67,0x72,0x04,0x0b,0x79,0x39,0x85,0x0b,0x5a,0x31,
+0x11,0x0c,0x7b,0x68,0x61,0x08,0x09,0x62,0x07,0x08,0x58,0x49,0x87,0x00,0x00,0x00,
+0x22,0x00,0xca,0x48,0x86,0x20,0x0c,0xa4,0x87,0x94,0x00,0x84,0x48,0x87,0x40,0x0c,
+0xa5,0x78,0x85,0x00,0x64,0x66,0x86,0x20,0x35,0x49,0x39,0x57,0x06,0x2a,0xb1,0xa1,
+0x80,0x4c,0x00,0xf1,0x0a,0x07,0xa7,0x76,0x8c,0x7a,0x87,0x59,0x77,0x37,0x68,0x77,
+0x7a,0x98,0x99,0x76,0x25,0x77,0x79,0x62,0x5b,0xb7,0x36,0x83,0x67,0x70,0x1e,0x00,
+0xb2,0x42,0x00,0x68,0xc9,0x87,0x90,0x00,0x09,0xa8,0x88,0x8b,0x06,0x00,0x02,0x09,
+0x00,0xf0,0x05,0x18,0xac,0x89,0x84,0x00,0x80,0x08,0x40,0x07,0x98,0x87,0x92,0x04,
+0x78,0xc7,0x70,0x00,0x02,0x80,0x00,0x04,0x00,0xf0,0x35,0x27,0x77,0x77,0x76,0x01,
+0x88,0x00,0x00,0x09,0x3a,0x66,0xc0,0x09,0x5a,0x74,0xc0,0x08,0x34,0x83,0xb0,0x08,
+0x27,0x82,0xb0,0x3a,0x9a,0xa9,0xb7,0x04,0x80,0x08,0x70,0x14,0x00,0x00,0x33,0x01,
+0x60,0x08,0x00,0x0b,0x89,0x8c,0x85,0x09,0x58,0x00,0x00,0x08,0x38,0x99,0xb0,0x3c,
+0x88,0x80,0x80,0x08,0x68,0x80,0x80,0x25,0x18,0x80,0x84,0x51,0x6a,0x40,0x97,0x77,
+0x00,0xf1,0x11,0x01,0x50,0x06,0x00,0x0a,0x96,0x8b,0x85,0x09,0x4a,0x50,0x08,0x08,
+0x47,0x41,0x11,0x3c,0x77,0x67,0x81,0x08,0x67,0x64,0x00,0x25,0x17,0x61,0x06,0x51,
+0x66,0x49,0x87,0x9c,0x00,0xf0,0x49,0x44,0x00,0x00,0x00,0x2a,0x79,0xa0,0x00,0x4e,
+0x98,0xd9,0x81,0x02,0x90,0x09,0x05,0x30,0x09,0x99,0xd9,0xb3,0x00,0x90,0x00,0x01,
+0x20,0x09,0x00,0x00,0x09,0x00,0x49,0x88,0x89,0x80,0x00,0x81,0x09,0x00,0x18,0xc9,
+0x8c,0x85,0x00,0x32,0x74,0x00,0x07,0x99,0xc8,0xc0,0x07,0x12,0x70,0x90,0x28,0x8c,
+0xe9,0x86,0x00,0x59,0x29,0x20,0x29,0x40,0x01,0x77,0x00,0x71,0x09,0x00,0x28,0xc9,
+0x8c,0x86,0x00,0x85,0x58,0x54,0x07,0x53,0x33,0xa3,0x4c,0x3b,0x89,0x80,0x05,0x04,
+0x00,0xf2,0x18,0x36,0x00,0x80,0x05,0x30,0x07,0xa0,0x15,0x97,0x5b,0x54,0x14,0x96,
+0x4a,0x53,0x07,0x88,0x88,0x70,0x06,0x15,0x30,0x91,0x02,0x41,0x61,0x50,0x28,0x9e,
+0xfb,0x86,0x03,0xa4,0x89,0x60,0x38,0x11,0x80,0x47,0x40,0x00,0xf4,0x0b,0x8d,0x86,
+0x06,0xb7,0x78,0x84,0x38,0xb7,0x76,0x36,0x03,0x28,0x00,0x35,0x08,0x8b,0x7a,0x64,
+0x04,0x9b,0x79,0x53,0x00,0x00,0x03,0xa1,0x60,0x00,0xf4,0x09,0x06,0x62,0xb9,0x81,
+0x22,0x38,0x96,0x60,0x07,0x15,0x98,0x84,0x00,0x7a,0x77,0xa4,0x09,0x18,0x00,0x71,
+0x15,0x08,0x77,0xb1,0x20,0x00,0xf0,0x09,0x05,0xb7,0x78,0x74,0x2b,0x6a,0x99,0x37,
+0x14,0x7a,0x78,0x27,0x06,0x7a,0x7b,0x36,0x06,0x7a,0x7b,0x45,0x02,0x01,0x05,0x92,
+0x20,0x00,0xf0,0x09,0x27,0xb9,0xac,0x75,0x04,0x67,0xb6,0x60,0x27,0x99,0x99,0x75,
+0x05,0xd8,0x7b,0xa0,0x04,0x79,0x88,0x90,0x06,0x27,0x33,0x90,0x6c,0x01,0xf1,0x31,
+0x00,0x80,0x09,0x00,0x28,0xc8,0x8c,0x86,0x0c,0xc8,0x3a,0x52,0x0b,0x8a,0x95,0x20,
+0x09,0xa6,0x21,0x60,0x06,0x79,0x98,0x90,0x08,0x07,0x62,0x90,0x3c,0x8c,0xb9,0xc7,
+0x15,0xa6,0x5b,0x53,0x14,0x95,0x4c,0x94,0x14,0xa8,0x8c,0x98,0x08,0x98,0x88,0x44,
+0x47,0x98,0x88,0xb0,0x07,0x9a,0xa5,0x90,0x57,0x68,0x8a,0x85,0x45,0x10,0x36,0x68,
+0x80,0x00,0xf5,0x2c,0xb8,0x8b,0x85,0x0c,0xab,0x6a,0xb5,0x0b,0x67,0x76,0x85,0x08,
+0x7a,0xca,0x45,0x08,0x78,0xbb,0x25,0x08,0x29,0xb5,0x25,0x09,0x71,0x65,0x83,0x00,
+0x00,0x08,0x00,0x67,0xa0,0x0b,0x61,0x45,0x78,0x8c,0x96,0x69,0x89,0x6b,0x52,0x37,
+0x29,0x07,0x70,0x14,0x99,0x59,0x40,0x00,0x89,0x63,0x44,0x08,0x87,0x62,0xa6,0x45,
+0x02,0xf5,0x45,0x00,0x93,0x10,0x07,0x02,0xd8,0xa0,0x7b,0xb8,0x8a,0x20,0x76,0x64,
+0x78,0x72,0x7b,0x93,0x6b,0x61,0x27,0x41,0x5b,0x50,0x5c,0xb6,0x7c,0x73,0x20,0x11,
+0x08,0x00,0x07,0x00,0x00,0x00,0x3b,0x7a,0xdf,0xf0,0x76,0x79,0x5b,0xb0,0x75,0x72,
+0xb6,0x40,0x6b,0x84,0xb8,0x40,0x07,0x47,0xd7,0xc1,0x1a,0xb5,0x48,0x61,0x43,0x28,
+0x57,0x50,0x01,0x20,0x00,0x00,0x28,0x05,0x88,0x82,0x41,0x70,0x00,0x00,0x0b,0x19,
+0x9b,0xb4,0x9b,0x00,0x05,0x40,0x09,0x04,0x00,0x21,0x6a,0x10,0x64,0x00,0xf0,0x10,
+0x08,0x00,0x00,0x64,0x3b,0x95,0x84,0x18,0x79,0x85,0x00,0x4b,0x66,0x69,0xc5,0x58,
+0x36,0xb2,0x80,0x08,0x97,0xb3,0x80,0x08,0x57,0xc5,0x80,0x08,0x00,0x84,0x90,0x24,
+0x00,0xf1,0x11,0x04,0x02,0x41,0x00,0x46,0x5b,0x44,0x84,0x36,0x6b,0x74,0x00,0x3b,
+0x8b,0x89,0xc5,0x58,0x8b,0x86,0x80,0x08,0x4b,0x62,0x80,0x08,0x6c,0x96,0x80,0x08,
+0x00,0x14,0xa0,0xad,0x00,0xf1,0x70,0x08,0x00,0x00,0x28,0x8c,0x88,0x70,0x07,0x7c,
+0x87,0x40,0x58,0x8c,0x98,0x81,0x01,0x93,0x81,0x70,0x79,0x70,0x5b,0x10,0x03,0xa8,
+0x35,0xa2,0x03,0x50,0x00,0x11,0x00,0x05,0x20,0x00,0x57,0x78,0x87,0x71,0x06,0x77,
+0x79,0x30,0x5c,0x76,0x69,0x92,0x05,0x8a,0xa8,0x30,0x05,0xb1,0x77,0x70,0x63,0xb5,
+0x69,0x71,0x00,0x73,0x00,0x32,0x07,0x00,0x08,0x00,0x5a,0x67,0x9d,0x95,0x01,0x78,
+0x08,0x44,0x08,0x7a,0x8c,0x91,0x5e,0x98,0x80,0xa0,0x49,0x38,0x39,0x70,0x08,0x27,
+0x3e,0x50,0x08,0x56,0x70,0x66,0x07,0x00,0x09,0x82,0x18,0x48,0x8c,0x9a,0x26,0x80,
+0x09,0x00,0x08,0x5b,0x7c,0x88,0x3e,0x9a,0x6c,0x78,0x39,0x1a,0x7c,0x78,0x08,0x08,
+0x09,0x08,0x08,0x08,0x09,0x66,0x83,0x00,0xf0,0x10,0x53,0x09,0x00,0x0b,0xb7,0x9d,
+0x96,0x28,0xa3,0x09,0x00,0x27,0x45,0x87,0x63,0x37,0x78,0xc7,0x76,0x04,0x95,0x64,
+0x81,0x24,0xb3,0x57,0x81,0x00,0x74,0x00,0x15,0x24,0x00,0xf0,0x31,0x35,0x80,0x00,
+0x80,0x89,0xc8,0x35,0x80,0x59,0xd9,0x35,0x80,0x41,0x89,0x04,0x80,0x57,0x7b,0x97,
+0x72,0x15,0x83,0x85,0x60,0x46,0x97,0x29,0x61,0x02,0x30,0x00,0x21,0x05,0x01,0x40,
+0x00,0x38,0x48,0x87,0x73,0x35,0x9d,0x66,0xa0,0x09,0x79,0x66,0xb0,0x6d,0x94,0xc7,
+0x70,0x38,0x37,0xb8,0xb0,0x08,0x14,0xab,0x10,0x08,0x29,0x64,0x94,0x44,0x00,0xf3,
+0x45,0x69,0xba,0xd9,0x92,0x28,0xba,0xc8,0x80,0x44,0x80,0x80,0x90,0x48,0x80,0x89,
+0xc0,0x46,0x00,0x00,0x90,0x4b,0x88,0x88,0xc0,0x44,0x00,0x00,0x80,0x58,0xc9,0xc8,
+0x81,0x3a,0xb8,0xc7,0xb0,0x39,0xa8,0xa6,0x90,0x68,0xba,0x88,0x82,0x04,0x90,0x56,
+0x00,0x04,0xad,0xb7,0x30,0x45,0x20,0x01,0x50,0x1a,0xbd,0xbd,0xb6,0x08,0x7a,0x88,
+0x73,0x06,0x2a,0x87,0x74,0x26,0x9b,0x99,0xc1,0x2a,0x14,0xca,0xa0,0x06,0x47,0x97,
+0x60,0x06,0x49,0x86,0x87,0x43,0x01,0xf1,0x0e,0x00,0x19,0x36,0x98,0xc0,0x2a,0x47,
+0x87,0xc0,0x6c,0x88,0x87,0xb0,0x0a,0x06,0x98,0xc0,0x09,0x80,0x88,0x00,0x36,0x53,
+0x78,0x01,0x80,0x19,0x06,0x94,0x68,0x01,0xf5,0x15,0x20,0x00,0x00,0x00,0x29,0x38,
+0x77,0xc0,0x03,0x4a,0x87,0x7c,0x00,0x09,0x48,0x77,0xc0,0x0a,0xc9,0x88,0x8c,0x00,
+0x19,0x00,0x88,0x00,0x00,0x90,0x35,0x80,0x40,0x09,0x28,0x06,0x95,0x00,0x01,0x00,
+0xf1,0x10,0x80,0x73,0x00,0x09,0x80,0xca,0x82,0x06,0x73,0x43,0x60,0x03,0x88,0x88,
+0x50,0x05,0x13,0x20,0x90,0x05,0x17,0x40,0x90,0x00,0x2c,0xa0,0x12,0x19,0x92,0x88,
+0x92,0x24,0x00,0xf1,0x03,0x51,0x00,0x00,0x3b,0x79,0x80,0x4e,0x77,0xc7,0x90,0x98,
+0x8c,0x8b,0x09,0x00,0x80,0x90,0xa8,0x07,0x00,0x40,0x96,0x30,0x08,0x79,0x1f,0x00,
+0x10,0x02,0x99,0x00,0xf4,0x0c,0x96,0x5c,0x89,0x2c,0xb8,0x18,0x18,0x3c,0xbb,0x63,
+0xa4,0x08,0x67,0x86,0xb5,0x0b,0xbb,0x78,0xc7,0x24,0x67,0x00,0x80,0x60,0x29,0x00,
+0x80,0x24,0x00,0xf1,0x0d,0x09,0x75,0x9b,0xa8,0x49,0xa6,0xc8,0x85,0x0a,0xac,0x79,
 0x59,0x06,0x67,0xab,0x78,0x0a,0xa7,0x8a,0x58,0x33,0x67,0x3a,0x68,0x50,0x47,0x63,
-0x12,0x17,0x00,0x07,0x0d,0xf0,0x09,0x28,0x88,0xb8,0x86,0x01,0x77,0x77,0x40,0x00,
-0x33,0x33,0x20,0x00,0x44,0x44,0x20,0x03,0xa8,0x88,0x90,0x03,0x50,0x00,0x90,0x0b,
-0x0e,0x00,0x23,0x00,0x00,0xd9,0x2b,0xf2,0x03,0x38,0xa8,0x09,0x00,0x05,0x53,0x09,
-0x00,0x06,0x64,0x9d,0x95,0x04,0x42,0x09,0x00,0x0b,0x78,0x04,0x00,0x00,0x79,0x27,
-0x00,0xc6,0x2f,0xf4,0x2d,0x6b,0x85,0x88,0xc0,0x25,0x50,0x00,0x90,0x35,0x52,0x98,
-0xc0,0x24,0x44,0x50,0x30,0x88,0xb3,0x50,0x01,0x88,0xb3,0x50,0x26,0x80,0x01,0xa8,
-0xa2,0x06,0x00,0x05,0x00,0x5a,0x76,0x7c,0x73,0x37,0x50,0x90,0x00,0x24,0x30,0xba,
-0xa0,0x14,0x30,0x90,0x80,0x78,0xa1,0x70,0x90,0x78,0xaa,0x30,0x90,0x70,0x28,0x08,
-0x90,0xac,0x00,0xf2,0x0d,0x18,0x21,0xc9,0x80,0x5a,0x98,0x50,0xb3,0x25,0x48,0x44,
-0x40,0x13,0x39,0x96,0xc0,0x78,0xb0,0x96,0x60,0x78,0xb4,0xbb,0x82,0x70,0x0d,0x40,
-0x98,0x79,0x03,0xf1,0x0c,0x52,0x00,0x69,0x84,0x6a,0x51,0x37,0x72,0x3a,0x31,0x24,
-0x30,0x09,0x00,0x24,0x45,0xad,0xa1,0x69,0xb0,0x09,0x00,0x68,0xa6,0x7c,0x73,0x62,
-0xfa,0x08,0xf2,0x0f,0x40,0x00,0x18,0x23,0xa5,0x50,0x46,0x6a,0x33,0x91,0x36,0x59,
-0x8a,0x80,0x36,0x46,0x8a,0x80,0x77,0xa6,0x59,0x90,0x77,0xa4,0x32,0x90,0x70,0x00,
-0x07,0x90,0x64,0x15,0x01,0x96,0x31,0xf0,0x4a,0x60,0x49,0x84,0x5b,0x74,0x17,0x62,
-0x39,0x42,0x14,0x47,0x89,0x10,0x14,0x32,0x86,0x20,0x49,0xb0,0x74,0x40,0x49,0xbb,
-0xb4,0x77,0x43,0x02,0x00,0x84,0x03,0x00,0x01,0x40,0x17,0x24,0x8b,0x30,0x56,0x60,
-0x08,0x00,0x36,0x55,0x8c,0x83,0x36,0x51,0x29,0x20,0x78,0xb6,0x75,0xb0,0x72,0x96,
-0x30,0x90,0x75,0x46,0x97,0xc0,0x07,0x02,0x40,0x80,0x69,0x84,0xb5,0xa1,0x37,0x52,
-0x3a,0x31,0x24,0x33,0x8c,0x80,0x24,0x30,0x1a,0x10,0x78,0xb5,0x6c,0x63,0x78,0xb0,
-0x09,0x00,0xe9,0x41,0x04,0x1e,0x32,0xf0,0x0e,0x49,0x87,0x9c,0x84,0x15,0x40,0x08,
-0x00,0x26,0x55,0x9b,0x83,0x39,0x70,0x2a,0x00,0x49,0xa7,0x71,0x72,0x49,0xa5,0x80,
-0x98,0x42,0x00,0x88,0x41,0x02,0x85,0x11,0xf4,0x0c,0x76,0xac,0xa4,0x25,0x46,0x44,
-0x53,0x26,0x53,0x94,0x90,0x14,0x31,0x33,0x00,0x78,0xa6,0x86,0x71,0x78,0xb7,0x80,
-0x86,0x70,0x00,0x98,0x60,0x14,0x01,0xf1,0x0d,0x28,0x26,0xc8,0x72,0x59,0x83,0xb5,
-0x90,0x24,0x35,0xb5,0xb2,0x24,0x34,0x44,0x41,0x87,0xb8,0x77,0xb0,0x87,0x98,0x77,
-0xc0,0x80,0x08,0x00,0x90,0x20,0x00,0xf2,0x0c,0x36,0x98,0xb1,0x49,0x85,0x76,0x91,
-0x25,0x45,0x99,0x92,0x25,0x40,0x09,0x00,0x66,0xa7,0xae,0x84,0x68,0xb3,0xb6,0x80,
-0x61,0x0b,0x40,0x87,0x34,0x01,0xf4,0x0f,0x53,0x30,0x59,0x87,0x10,0x71,0x27,0x69,
-0x88,0xa4,0x14,0x35,0x10,0xa0,0x14,0x35,0xaa,0xd0,0x58,0xa0,0x98,0x00,0x58,0xb6,
-0x78,0x06,0x51,0x0c,0x17,0x85,0x68,0x00,0xf2,0x0c,0x4b,0x88,0x9c,0xa3,0x25,0x46,
-0x5b,0x63,0x26,0x56,0x69,0x73,0x14,0x36,0x46,0x53,0x59,0xa6,0x75,0x73,0x59,0xa7,
-0x64,0x53,0x52,0x33,0x01,0x90,0x02,0x03,0xce,0x32,0xf2,0x0d,0x38,0x46,0x9d,0x93,
-0x49,0x76,0x9d,0x94,0x24,0x31,0x66,0x60,0x14,0x33,0x85,0xa0,0x68,0xb3,0xa7,0xc0,
-0x68,0xb3,0x61,0x90,0x60,0x03,0x42,0xa0,0x4c,0x00,0xf5,0x2f,0x01,0x00,0x18,0x27,
-0xb4,0x82,0x4a,0x87,0x96,0xb3,0x25,0x46,0x88,0x73,0x15,0x43,0x40,0x80,0x56,0x91,
-0xa7,0xa0,0x58,0xa0,0x92,0x60,0x51,0x07,0xaa,0x84,0x07,0x00,0x70,0x50,0x4b,0x87,
-0xba,0x93,0x15,0x46,0x95,0x81,0x26,0x58,0xca,0xa4,0x14,0x32,0x88,0x80,0x59,0xa5,
-0x64,0xa0,0x54,0x85,0x63,0xa0,0x57,0x45,0x97,0xc0,0x6c,0x00,0xf6,0x30,0x52,0x36,
-0x00,0x4a,0x65,0xb7,0x91,0x87,0x68,0x2c,0x80,0x26,0x79,0x73,0x54,0x38,0xaa,0xaa,
-0x82,0x03,0x66,0x66,0x30,0x08,0x55,0x55,0x80,0x09,0x55,0x55,0x90,0x04,0x00,0x40,
-0x50,0x29,0x45,0x7b,0x73,0x26,0x53,0x6b,0x61,0x14,0x37,0x99,0x84,0x16,0x46,0xa7,
-0x54,0x48,0x97,0xca,0xb5,0x48,0x95,0x94,0xa3,0x42,0x04,0x87,0x55,0xb4,0x00,0x10,
-0x80,0xfa,0x09,0xf2,0x0a,0x52,0x25,0x4a,0x9c,0x72,0x26,0x5a,0x9c,0x81,0x25,0x45,
-0x9c,0x83,0x68,0xa6,0x97,0x91,0x68,0xa1,0xac,0x70,0x61,0x0d,0x81,0xa9,0x24,0x01,
-0xf2,0x0f,0x0a,0x00,0x4b,0x88,0xbc,0xb7,0x15,0x48,0x97,0x88,0x26,0x48,0x86,0x88,
-0x14,0x37,0x66,0x76,0x59,0x98,0x77,0x87,0x59,0x94,0xa4,0xb3,0x52,0x1c,0x20,0x3a,
-0x6a,0x18,0xf1,0x0f,0x30,0x50,0x4a,0x6a,0xa9,0x82,0x29,0x66,0x65,0x95,0x55,0x58,
-0x86,0x55,0x54,0x67,0x75,0x43,0x06,0xd7,0x7c,0x72,0x33,0x5c,0xc6,0x00,0x47,0x41,
-0x03,0x74,0xac,0x40,0xf0,0x00,0xa7,0xc1,0x00,0x4d,0x77,0x97,0x80,0x09,0x77,0x77,
-0xa0,0x09,0x66,0x66,0xa0,0x08,0x00,0x80,0x15,0x70,0x18,0x50,0x12,0x00,0x00,0x31,
-0xa5,0x07,0xf0,0x0d,0x78,0xc0,0x09,0x00,0x77,0xc0,0x0d,0x84,0x76,0xb0,0x09,0x00,
-0x71,0x95,0x99,0xb0,0x48,0x96,0x20,0x80,0x84,0x97,0x98,0xc0,0x80,0x06,0x30,0x80,
-0x9c,0x02,0xf0,0x0d,0x78,0x88,0x54,0x10,0x74,0x48,0x97,0xb3,0x74,0x4a,0xc0,0x80,
-0x75,0x48,0x63,0x70,0x67,0x16,0x0c,0x20,0x09,0x61,0x3a,0x70,0x72,0x06,0x70,0x45,
-0xd2,0x03,0xf3,0x0e,0x38,0xc6,0x68,0xc0,0x13,0x92,0x00,0x90,0x36,0xb6,0xa8,0x80,
-0x35,0xb6,0x80,0x13,0x47,0x80,0x78,0x93,0x6a,0x90,0x00,0x00,0x80,0x88,0x99,0x94,
-0x10,0x72,0x09,0xf1,0x10,0x01,0x8c,0x78,0xd8,0xa0,0x25,0xb5,0x65,0x58,0x01,0x49,
-0x28,0x79,0x40,0x17,0xb8,0xa0,0x09,0x02,0xc8,0x0b,0x77,0x90,0x48,0xb0,0x00,0x00,
-0x07,0x07,0xa9,0x99,0x0a,0x09,0x00,0xef,0x27,0x01,0x82,0x2f,0xf1,0x04,0x05,0x89,
-0xc8,0x70,0x04,0x60,0xc8,0x82,0x07,0x70,0x80,0x00,0x09,0x84,0x80,0x00,0x64,0x07,
-0xb9,0x35,0x02,0xf1,0x09,0x78,0xc3,0xb9,0x94,0x78,0xc3,0xb8,0x70,0x06,0x13,0x50,
-0x90,0x76,0xa7,0x50,0x90,0x76,0x13,0xa7,0x60,0xa9,0x75,0xa8,0x85,0x1c,0x00,0xf1,
-0x0c,0xc9,0x88,0xb0,0x78,0xc9,0x65,0xa0,0x16,0x09,0x66,0xb0,0x76,0x89,0x39,0x52,
-0x76,0x09,0x07,0x70,0xaa,0x8b,0x57,0xa1,0x10,0x06,0x40,0x12,0x4b,0x02,0xf2,0x30,
-0xc8,0x86,0xa6,0x30,0x0c,0x8c,0x97,0x90,0x00,0x28,0x02,0xaa,0x10,0x07,0xb8,0xd8,
-0x9d,0x00,0x78,0x09,0x00,0x80,0x2b,0xd7,0x90,0x08,0x02,0x30,0x0a,0x88,0x80,0x00,
-0x00,0x88,0x00,0x77,0xa2,0x88,0x21,0x78,0xa8,0x89,0x90,0x27,0x00,0x89,0x10,0x78,
-0x75,0x89,0x90,0x77,0x27,0x78,0x24,0x7a,0x96,0x48,0x04,0x63,0x29,0x07,0x85,0x50,
-0x0e,0xf4,0x0f,0x01,0x20,0x78,0x97,0x45,0x90,0x78,0xa7,0x98,0xa2,0x07,0x0b,0x44,
+0x96,0x68,0x00,0xf1,0x10,0x03,0x50,0x00,0x28,0x88,0xb8,0x86,0x01,0x77,0x77,0x40,
+0x00,0x33,0x33,0x20,0x00,0x44,0x44,0x20,0x03,0xa8,0x88,0x90,0x03,0x50,0x00,0x90,
+0x03,0xa7,0x77,0xa0,0x23,0x00,0xf2,0x06,0x60,0x09,0x00,0x38,0xa8,0x09,0x00,0x05,
+0x53,0x09,0x00,0x06,0x64,0x9d,0x95,0x04,0x42,0x09,0x00,0x0b,0x78,0x04,0x00,0xf4,
+0x35,0x08,0x00,0x09,0x00,0x03,0x00,0x00,0x00,0x6b,0x85,0x88,0xc0,0x25,0x50,0x00,
+0x90,0x35,0x52,0x98,0xc0,0x24,0x44,0x50,0x30,0x88,0xb3,0x50,0x01,0x88,0xb3,0x50,
+0x26,0x80,0x01,0xa8,0xa2,0x06,0x00,0x05,0x00,0x5a,0x76,0x7c,0x73,0x37,0x50,0x90,
+0x00,0x24,0x30,0xba,0xa0,0x14,0x30,0x90,0x80,0x78,0xa1,0x70,0x90,0x78,0xaa,0x30,
+0x90,0x70,0x28,0x08,0x90,0xac,0x00,0xf2,0x0d,0x18,0x21,0xc9,0x80,0x5a,0x98,0x50,
+0xb3,0x25,0x48,0x44,0x40,0x13,0x39,0x96,0xc0,0x78,0xb0,0x96,0x60,0x78,0xb4,0xbb,
+0x82,0x70,0x0d,0x40,0x98,0x79,0x03,0xf0,0x0c,0x52,0x00,0x69,0x84,0x6a,0x51,0x37,
+0x72,0x3a,0x31,0x24,0x30,0x09,0x00,0x24,0x45,0xad,0xa1,0x69,0xb0,0x09,0x00,0x68,
+0xa6,0x7c,0x73,0x62,0x11,0x03,0xf3,0x13,0x00,0x40,0x00,0x18,0x23,0xa5,0x50,0x46,
+0x6a,0x33,0x91,0x36,0x59,0x8a,0x80,0x36,0x46,0x8a,0x80,0x77,0xa6,0x59,0x90,0x77,
+0xa4,0x32,0x90,0x70,0x00,0x07,0x90,0x00,0x00,0x01,0x14,0x03,0xf3,0x4e,0x09,0x60,
+0x49,0x84,0x5b,0x74,0x17,0x62,0x39,0x42,0x14,0x47,0x89,0x10,0x14,0x32,0x86,0x20,
+0x49,0xb0,0x74,0x40,0x49,0xbb,0xb4,0x77,0x43,0x02,0x00,0x84,0x03,0x00,0x01,0x40,
+0x17,0x24,0x8b,0x30,0x56,0x60,0x08,0x00,0x36,0x55,0x8c,0x83,0x36,0x51,0x29,0x20,
+0x78,0xb6,0x75,0xb0,0x72,0x96,0x30,0x90,0x75,0x46,0x97,0xc0,0x07,0x02,0x40,0x80,
+0x69,0x84,0xb5,0xa1,0x37,0x52,0x3a,0x31,0x24,0x33,0x8c,0x80,0x24,0x30,0x1a,0x10,
+0x78,0xb5,0x6c,0x63,0x78,0xb0,0x09,0x00,0x70,0x00,0x09,0x64,0x00,0xf0,0x0f,0x08,
+0x00,0x49,0x87,0x9c,0x84,0x15,0x40,0x08,0x00,0x26,0x55,0x9b,0x83,0x39,0x70,0x2a,
+0x00,0x49,0xa7,0x71,0x72,0x49,0xa5,0x80,0x98,0x42,0x00,0x88,0x41,0xf0,0x00,0xf4,
+0x0d,0x5c,0x76,0xac,0xa4,0x25,0x46,0x44,0x53,0x26,0x53,0x94,0x90,0x14,0x31,0x33,
+0x00,0x78,0xa6,0x86,0x71,0x78,0xb7,0x80,0x86,0x70,0x00,0x98,0x60,0x14,0x01,0xf1,
+0x0d,0x28,0x26,0xc8,0x72,0x59,0x83,0xb5,0x90,0x24,0x35,0xb5,0xb2,0x24,0x34,0x44,
+0x41,0x87,0xb8,0x77,0xb0,0x87,0x98,0x77,0xc0,0x80,0x08,0x00,0x90,0x20,0x00,0xf2,
+0x0c,0x36,0x98,0xb1,0x49,0x85,0x76,0x91,0x25,0x45,0x99,0x92,0x25,0x40,0x09,0x00,
+0x66,0xa7,0xae,0x84,0x68,0xb3,0xb6,0x80,0x61,0x0b,0x40,0x87,0x34,0x01,0xf4,0x0f,
+0x53,0x30,0x59,0x87,0x10,0x71,0x27,0x69,0x88,0xa4,0x14,0x35,0x10,0xa0,0x14,0x35,
+0xaa,0xd0,0x58,0xa0,0x98,0x00,0x58,0xb6,0x78,0x06,0x51,0x0c,0x17,0x85,0x68,0x00,
+0xf4,0x0d,0x4b,0x88,0x9c,0xa3,0x25,0x46,0x5b,0x63,0x26,0x56,0x69,0x73,0x14,0x36,
+0x46,0x53,0x59,0xa6,0x75,0x73,0x59,0xa7,0x64,0x53,0x52,0x33,0x01,0x92,0xb7,0x02,
+0x00,0xec,0x01,0xf2,0x0d,0x38,0x46,0x9d,0x93,0x49,0x76,0x9d,0x94,0x24,0x31,0x66,
+0x60,0x14,0x33,0x85,0xa0,0x68,0xb3,0xa7,0xc0,0x68,0xb3,0x61,0x90,0x60,0x03,0x42,
+0xa0,0x4c,0x00,0xf5,0x2f,0x01,0x00,0x18,0x27,0xb4,0x82,0x4a,0x87,0x96,0xb3,0x25,
+0x46,0x88,0x73,0x15,0x43,0x40,0x80,0x56,0x91,0xa7,0xa0,0x58,0xa0,0x92,0x60,0x51,
+0x07,0xaa,0x84,0x07,0x00,0x70,0x50,0x4b,0x87,0xba,0x93,0x15,0x46,0x95,0x81,0x26,
+0x58,0xca,0xa4,0x14,0x32,0x88,0x80,0x59,0xa5,0x64,0xa0,0x54,0x85,0x63,0xa0,0x57,
+0x45,0x97,0xc0,0x6c,0x00,0xf6,0x30,0x52,0x36,0x00,0x4a,0x65,0xb7,0x91,0x87,0x68,
+0x2c,0x80,0x26,0x79,0x73,0x54,0x38,0xaa,0xaa,0x82,0x03,0x66,0x66,0x30,0x08,0x55,
+0x55,0x80,0x09,0x55,0x55,0x90,0x04,0x00,0x40,0x50,0x29,0x45,0x7b,0x73,0x26,0x53,
+0x6b,0x61,0x14,0x37,0x99,0x84,0x16,0x46,0xa7,0x54,0x48,0x97,0xca,0xb5,0x48,0x95,
+0x94,0xa3,0x42,0x04,0x87,0x55,0xb4,0x00,0xf2,0x0f,0x80,0x80,0x6a,0x96,0x88,0x52,
+0x25,0x4a,0x9c,0x72,0x26,0x5a,0x9c,0x81,0x25,0x45,0x9c,0x83,0x68,0xa6,0x97,0x91,
+0x68,0xa1,0xac,0x70,0x61,0x0d,0x81,0xa9,0x24,0x01,0xf0,0x0f,0x0a,0x00,0x4b,0x88,
+0xbc,0xb7,0x15,0x48,0x97,0x88,0x26,0x48,0x86,0x88,0x14,0x37,0x66,0x76,0x59,0x98,
+0x77,0x87,0x59,0x94,0xa4,0xb3,0x52,0x1c,0x20,0x3a,0x24,0x00,0xf0,0x25,0x05,0x04,
+0x30,0x50,0x4a,0x6a,0xa9,0x82,0x29,0x66,0x65,0x95,0x55,0x58,0x86,0x55,0x54,0x67,
+0x75,0x43,0x06,0xd7,0x7c,0x72,0x33,0x5c,0xc6,0x00,0x47,0x41,0x03,0x74,0x00,0x50,
+0x00,0x00,0x05,0xa7,0xc1,0x00,0x4d,0x77,0x97,0x80,0x09,0x77,0x77,0xa0,0x09,0x66,
+0x66,0xa0,0x08,0x00,0x80,0x15,0x70,0x18,0x50,0x12,0x00,0x00,0x31,0xa5,0x07,0xf0,
+0x0d,0x78,0xc0,0x09,0x00,0x77,0xc0,0x0d,0x84,0x76,0xb0,0x09,0x00,0x71,0x95,0x99,
+0xb0,0x48,0x96,0x20,0x80,0x84,0x97,0x98,0xc0,0x80,0x06,0x30,0x80,0x9c,0x02,0xf0,
+0x0d,0x78,0x88,0x54,0x10,0x74,0x48,0x97,0xb3,0x74,0x4a,0xc0,0x80,0x75,0x48,0x63,
+0x70,0x67,0x16,0x0c,0x20,0x09,0x61,0x3a,0x70,0x72,0x06,0x70,0x45,0xd2,0x03,0xf3,
+0x0e,0x38,0xc6,0x68,0xc0,0x13,0x92,0x00,0x90,0x36,0xb6,0xa8,0x80,0x35,0xb6,0x80,
+0x13,0x47,0x80,0x78,0x93,0x6a,0x90,0x00,0x00,0x80,0x88,0x99,0x94,0x10,0x72,0x09,
+0xf2,0x10,0x01,0x8c,0x78,0xd8,0xa0,0x25,0xb5,0x65,0x58,0x01,0x49,0x28,0x79,0x40,
+0x17,0xb8,0xa0,0x09,0x02,0xc8,0x0b,0x77,0x90,0x48,0xb0,0x00,0x00,0x07,0x07,0xa9,
+0x99,0x0a,0x09,0xf1,0x0c,0x09,0x88,0x88,0xb0,0x09,0x00,0x00,0x90,0x05,0x89,0xc8,
+0x70,0x04,0x60,0xc8,0x82,0x07,0x70,0x80,0x00,0x09,0x84,0x80,0x00,0x64,0x07,0xb9,
+0x35,0x02,0xf1,0x09,0x78,0xc3,0xb9,0x94,0x78,0xc3,0xb8,0x70,0x06,0x13,0x50,0x90,
+0x76,0xa7,0x50,0x90,0x76,0x13,0xa7,0x60,0xa9,0x75,0xa8,0x85,0x1c,0x00,0xf1,0x0c,
+0xc9,0x88,0xb0,0x78,0xc9,0x65,0xa0,0x16,0x09,0x66,0xb0,0x76,0x89,0x39,0x52,0x76,
+0x09,0x07,0x70,0xaa,0x8b,0x57,0xa1,0x10,0x06,0x40,0x12,0x4b,0x02,0xf1,0x31,0xc8,
+0x86,0xa6,0x30,0x0c,0x8c,0x97,0x90,0x00,0x28,0x02,0xaa,0x10,0x07,0xb8,0xd8,0x9d,
+0x00,0x78,0x09,0x00,0x80,0x2b,0xd7,0x90,0x08,0x02,0x30,0x0a,0x88,0x80,0x00,0x00,
+0x88,0x00,0x77,0xa2,0x88,0x21,0x78,0xa8,0x89,0x90,0x27,0x00,0x89,0x10,0x78,0x75,
+0x89,0x90,0x77,0x27,0x78,0x24,0x7a,0x96,0x48,0x04,0x63,0x29,0x07,0x85,0x00,0x46,
+0x02,0xf2,0x0f,0x01,0x20,0x78,0x97,0x45,0x90,0x78,0xa7,0x98,0xa2,0x07,0x0b,0x44,
 0x15,0x78,0x59,0x65,0x93,0x77,0x07,0x85,0x30,0x8b,0x87,0x9a,0x30,0x52,0x08,0x57,
-0x85,0xbe,0x31,0xf0,0x05,0x07,0x89,0x8b,0x00,0x08,0x77,0x7c,0x00,0x08,0x76,0x6b,
-0x80,0x4c,0x87,0x7c,0x20,0x00,0x03,0xaa,0x00,0x6e,0x00,0x44,0x69,0x21,0x9a,0x00,
-0xb3,0x1e,0xae,0x08,0x89,0xc8,0x84,0x06,0x88,0xb7,0xa0,0x07,0x88,0xee,0x36,0x00,
-0x90,0x22,0xf2,0x0b,0x39,0xd8,0x09,0x00,0x18,0xb7,0xac,0x87,0x29,0xa9,0x78,0x07,
-0x29,0xb9,0xac,0x87,0x26,0xb6,0x78,0x07,0x01,0x91,0xac,0x87,0x00,0x80,0x63,0x0c,
-0x00,0x4c,0x26,0xf5,0x0d,0x7c,0x97,0x8b,0x82,0x6b,0x81,0x70,0x60,0x8a,0xa9,0x50,
-0x93,0x79,0x82,0x86,0x40,0x3a,0x50,0x2c,0x00,0x6c,0x72,0x99,0x40,0x08,0x08,0x20,
-0x64,0xd5,0x05,0xf2,0x10,0x62,0x09,0x70,0x07,0xa9,0x49,0x35,0x27,0xa8,0x7c,0x75,
-0x08,0xb9,0x69,0x43,0x0b,0xba,0x89,0x90,0x08,0x97,0x77,0x61,0x17,0xa8,0x7b,0x77,
-0x00,0x52,0x72,0x77,0x4c,0x00,0xf0,0x0b,0x38,0x00,0x6c,0x82,0xa8,0x60,0x6b,0x9a,
-0x97,0xb4,0x8a,0xa5,0x88,0x80,0x8a,0xa7,0x66,0x61,0x2a,0x39,0xcc,0xc1,0x6c,0x78,
-0x66,0x61,0x35,0x26,0x20,0x01,0x70,0x11,0x3d,0xf2,0x0c,0x49,0x77,0x80,0x28,0xb7,
-0x68,0x86,0x03,0x9a,0x9a,0x34,0xa0,0x37,0x98,0x97,0x78,0x04,0x8b,0x79,0x55,0x90,
-0x01,0x73,0xdb,0xbc,0x00,0x17,0x42,0x23,0xf3,0x2e,0x00,0x6c,0x83,0xa4,0x60,0x5c,
-0x88,0xa8,0x91,0x8b,0xb5,0x28,0x50,0x7b,0xa8,0x6a,0x80,0x6c,0x79,0x7a,0x80,0x08,
-0x08,0x07,0x70,0x08,0x08,0x35,0x90,0x07,0x13,0x5b,0x51,0x6c,0x85,0x8c,0x80,0x7b,
-0x98,0x7b,0xb0,0x8a,0x98,0x7b,0xa0,0x77,0x57,0x6b,0xb0,0xae,0xd8,0x87,0x92,0x07,
-0x00,0xa2,0x50,0x07,0x00,0x28,0x30,0xc9,0x03,0xf4,0x0a,0x08,0xda,0x10,0x90,0x16,
-0x08,0x8c,0xc7,0x89,0x80,0x88,0x25,0x88,0x8c,0xc6,0x9a,0x90,0x88,0x02,0x58,0x8c,
-0xc0,0x25,0x80,0x08,0x8b,0x1a,0xf2,0x0b,0x3b,0x45,0x97,0xb0,0x39,0x49,0xfe,0xf3,
-0x7a,0xa4,0x73,0xa0,0x15,0x64,0x84,0xa0,0x5a,0xb6,0x97,0xb0,0x34,0x59,0xb9,0xd4,
-0x03,0x52,0x5d,0x06,0xf1,0x10,0x41,0x00,0x95,0x30,0x0a,0x34,0xb5,0x90,0x01,0x25,
-0xf9,0x40,0x6b,0x06,0xb9,0x20,0x09,0x38,0x90,0x90,0x09,0x40,0x90,0x10,0x4b,0xa2,
-0x00,0x10,0x40,0x17,0x88,0xca,0x16,0xf1,0x0c,0x28,0x0c,0x77,0xa0,0x02,0x0b,0x66,
-0xa0,0x5b,0x0c,0x87,0x90,0x09,0x09,0x39,0x70,0x09,0x1d,0x82,0x90,0x1a,0x52,0x00,
-0x10,0x70,0x48,0x88,0x4e,0x09,0xf4,0x11,0x31,0x07,0x03,0x50,0x19,0x5b,0x9d,0x83,
-0x00,0x11,0x90,0x30,0x5b,0x34,0x90,0x90,0x09,0x29,0xc8,0xb0,0x09,0x01,0x90,0x00,
-0x0a,0x5b,0x10,0x00,0x71,0x48,0x88,0xa5,0x5b,0x01,0xf1,0x0d,0x37,0x08,0xb9,0x90,
-0x03,0x17,0x9d,0x70,0x59,0x1b,0x7b,0xb0,0x09,0x1b,0x5a,0xb0,0x09,0x19,0x29,0x90,
-0x1a,0x53,0x04,0x60,0x70,0x48,0x79,0xb4,0x48,0x00,0xd0,0x00,0x90,0x00,0x1a,0x58,
-0xc8,0x83,0x01,0x38,0xc7,0x90,0x7b,0x43,0x48,0x00,0xc2,0xfc,0x70,0x09,0x45,0x92,
-0x80,0x28,0x50,0x20,0x00,0x70,0x38,0x48,0x00,0x10,0x16,0xfe,0x17,0xf0,0x05,0x67,
-0xc7,0x73,0x00,0x39,0xc7,0xb0,0x5c,0x39,0xc6,0xc0,0x09,0x28,0xc7,0x90,0x09,0x57,
-0xc7,0x74,0x27,0x24,0x00,0x34,0x48,0x89,0xb9,0x6c,0x00,0xf1,0x0d,0x38,0x49,0xd7,
-0xb0,0x02,0x56,0xb6,0x80,0x47,0x56,0x77,0x90,0x09,0x66,0x79,0x80,0x09,0x83,0x67,
-0x80,0x0a,0x60,0x04,0x50,0x72,0x38,0x88,0xa4,0xcb,0x19,0xf1,0x0e,0x06,0x25,0x00,
-0x09,0x1d,0x8d,0x83,0x00,0x9a,0x19,0x10,0x49,0x1b,0x6b,0x60,0x09,0x0c,0x7c,0x70,
-0x09,0x0c,0x8c,0x84,0x0b,0x54,0x00,0x00,0x72,0x38,0x2d,0x46,0x00,0xf4,0x6c,0xf1,
-0x0e,0x00,0x39,0x6c,0x7b,0x84,0x01,0x19,0x57,0x82,0x5c,0x18,0x80,0x90,0x09,0x34,
-0x87,0xc4,0x09,0x80,0x80,0x80,0x0a,0x75,0x25,0x20,0x71,0x48,0x89,0xb6,0x37,0x1a,
-0xf1,0x0c,0x87,0x98,0x85,0x04,0x49,0xca,0x82,0x58,0x1b,0xba,0xc0,0x09,0x1a,0xa8,
-0xb0,0x09,0x37,0xa8,0x73,0x39,0x71,0x41,0x01,0x40,0x16,0x88,0x84,0xa4,0x01,0xf1,
-0x0c,0x1a,0xe9,0x90,0x00,0x08,0x24,0x80,0x5c,0x39,0x77,0xa3,0x09,0x34,0xaa,0x43,
-0x09,0x34,0xa8,0x43,0x1b,0x62,0x00,0x70,0x80,0x59,0x88,0xa8,0x71,0x08,0xf1,0x04,
-0x05,0x02,0x30,0x19,0x49,0xab,0x83,0x00,0x07,0xb7,0x50,0x5c,0x0b,0x66,0xa0,0x09,
-0x0a,0x33,0x90,0x04,0x00,0x45,0x27,0x77,0x50,0x70,0x3c,0x01,0xf4,0x0f,0x33,0x00,
-0x29,0x37,0x97,0xb0,0x01,0x07,0x88,0x00,0x4b,0x3c,0x8a,0x62,0x09,0x39,0x7c,0x75,
-0x09,0x09,0x08,0x44,0x0a,0x47,0x77,0x72,0x71,0x48,0x89,0xa9,0xf4,0x00,0xf5,0x0d,
-0x28,0x5d,0xdd,0xe4,0x01,0x56,0x47,0x70,0x48,0x56,0x67,0x82,0x09,0x76,0x9b,0x71,
-0x09,0x8a,0x6b,0x63,0x0a,0x60,0x07,0x00,0x63,0x48,0x89,0xa6,0x24,0x00,0xf2,0x0c,
-0x8d,0xac,0xc7,0x01,0x65,0x79,0x56,0x49,0x2a,0x58,0x82,0x09,0x19,0x38,0x51,0x09,
-0x5b,0xab,0xa5,0x0a,0x74,0x00,0x53,0x72,0x37,0x88,0x99,0xf9,0x05,0xf6,0x0d,0x30,
-0x00,0x09,0x1d,0x99,0xb0,0x00,0x0c,0x99,0xb0,0x5c,0x56,0x88,0x64,0x09,0x5b,0x98,
-0xa4,0x09,0x05,0x96,0x60,0x1b,0xa5,0x06,0x40,0x70,0x5a,0x60,0x01,0xf4,0x0d,0x19,
-0x8d,0xee,0xd8,0x01,0x35,0x28,0x60,0x5c,0x7a,0x9b,0xb4,0x08,0x79,0x8b,0xb3,0x08,
-0x55,0x5a,0xb3,0x1a,0x73,0x28,0x64,0x80,0x59,0x88,0xaa,0x34,0x42,0xf1,0x0c,0x09,
-0xa9,0x5a,0x99,0x06,0x28,0x18,0x62,0x28,0x9a,0x68,0x81,0x07,0x88,0x38,0x07,0x08,
-0x02,0x68,0x48,0x0b,0x89,0x68,0x40,0x08,0x02,0x68,0x23,0x00,0xf0,0x0d,0x4b,0xc8,
-0x58,0x88,0x4b,0xba,0x00,0x09,0x47,0x57,0x69,0x89,0x47,0x39,0x81,0x06,0x48,0x6a,
-0x81,0x02,0x49,0x7a,0x81,0x08,0x42,0x07,0x49,0x97,0x8a,0x09,0xf2,0x09,0x6b,0x79,
-0xaa,0xb0,0x68,0x75,0xac,0x90,0x5d,0x68,0x9c,0x81,0x1e,0x70,0x73,0x30,0x79,0x35,
-0x8b,0x70,0x48,0x04,0x7b,0x60,0x9c,0x0b,0x01,0x39,0x4b,0xd0,0x10,0x6f,0xff,0xdb,
-0x92,0x07,0x7c,0x77,0x40,0x0b,0x6b,0x67,0x80,0x04,0x00,0x00,0x03,0x39,0x00,0xeb,
-0x09,0xf1,0x11,0x57,0x7c,0x87,0x72,0x05,0xcb,0xbb,0xb0,0x03,0x76,0x66,0x70,0x29,
-0xaa,0xaa,0xa5,0x07,0x77,0xb6,0xc0,0x04,0x66,0xa5,0x80,0x04,0x67,0xb6,0x61,0x27,
-0x78,0xb7,0x76,0x20,0x03,0xf0,0x01,0xc1,0x09,0x00,0x1a,0x29,0x09,0x00,0x27,0xc5,
-0x4b,0x42,0x17,0xc7,0x5b,0x53,0x03,0xd9,0x47,0xa1,0x87,0x09,0x00,0x04,0xb9,0x09,
-0x00,0x28,0x40,0x09,0x7b,0x4b,0xf3,0x0a,0x1b,0x84,0xb9,0xc0,0x89,0x71,0x80,0x90,
-0x5a,0x85,0xc8,0xa0,0x26,0x50,0x80,0x90,0x29,0x60,0x80,0x90,0x5a,0x89,0xc9,0xc4,
-0x00,0xa9,0x08,0xf1,0x0d,0x39,0x91,0xb7,0xa0,0x79,0x63,0x77,0x70,0x5b,0x87,0x7b,
+0x85,0x18,0x0a,0xf0,0x07,0x00,0x00,0x07,0x89,0x8b,0x00,0x08,0x77,0x7c,0x00,0x08,
+0x76,0x6b,0x80,0x4c,0x87,0x7c,0x20,0x00,0x03,0xaa,0x00,0x6e,0x00,0x32,0x69,0x21,
+0x9a,0xfe,0x01,0xf0,0x0c,0x01,0x70,0x00,0x08,0x89,0xc8,0x84,0x06,0x88,0xb7,0xa0,
+0x07,0x88,0xb7,0xc0,0x07,0x44,0x93,0xa0,0x02,0x46,0xa4,0x40,0x28,0x89,0xc8,0x86,
+0x1c,0x00,0xf2,0x11,0x00,0x80,0x08,0x00,0x39,0xd8,0x09,0x00,0x18,0xb7,0xac,0x87,
+0x29,0xa9,0x78,0x07,0x29,0xb9,0xac,0x87,0x26,0xb6,0x78,0x07,0x01,0x91,0xac,0x87,
+0x00,0x80,0x70,0x07,0x41,0x02,0xf5,0x0f,0x17,0x00,0x7c,0x97,0x8b,0x82,0x6b,0x81,
+0x70,0x60,0x8a,0xa9,0x50,0x93,0x79,0x82,0x86,0x40,0x3a,0x50,0x2c,0x00,0x6c,0x72,
+0x99,0x40,0x08,0x08,0x20,0x64,0xd5,0x05,0xf2,0x10,0x62,0x09,0x70,0x07,0xa9,0x49,
+0x35,0x27,0xa8,0x7c,0x75,0x08,0xb9,0x69,0x43,0x0b,0xba,0x89,0x90,0x08,0x97,0x77,
+0x61,0x17,0xa8,0x7b,0x77,0x00,0x52,0x72,0x77,0x4c,0x00,0xf0,0x0f,0x38,0x00,0x6c,
+0x82,0xa8,0x60,0x6b,0x9a,0x97,0xb4,0x8a,0xa5,0x88,0x80,0x8a,0xa7,0x66,0x61,0x2a,
+0x39,0xcc,0xc1,0x6c,0x78,0x66,0x61,0x08,0x07,0x66,0x80,0x93,0x00,0xf1,0x0e,0x02,
+0x6a,0x49,0x77,0x80,0x28,0xb7,0x68,0x86,0x03,0x9a,0x9a,0x34,0xa0,0x37,0x98,0x97,
+0x78,0x04,0x8b,0x79,0x55,0x90,0x01,0x73,0xdb,0xbc,0x00,0x17,0xb2,0x00,0xf3,0x2f,
+0x2a,0x00,0x6c,0x83,0xa4,0x60,0x5c,0x88,0xa8,0x91,0x8b,0xb5,0x28,0x50,0x7b,0xa8,
+0x6a,0x80,0x6c,0x79,0x7a,0x80,0x08,0x08,0x07,0x70,0x08,0x08,0x35,0x90,0x07,0x13,
+0x5b,0x51,0x6c,0x85,0x8c,0x80,0x7b,0x98,0x7b,0xb0,0x8a,0x98,0x7b,0xa0,0x77,0x57,
+0x6b,0xb0,0xae,0xd8,0x87,0x92,0x07,0x00,0xa2,0x50,0x07,0x00,0x28,0x30,0xc9,0x03,
+0xf1,0x0a,0x08,0xda,0x10,0x90,0x16,0x08,0x8c,0xc7,0x89,0x80,0x88,0x25,0x88,0x8c,
+0xc6,0x9a,0x90,0x88,0x02,0x58,0x8c,0xc0,0x25,0x80,0x08,0x37,0x01,0x00,0xc2,0x08,
+0xf2,0x0a,0x45,0x97,0xb0,0x39,0x49,0xfe,0xf3,0x7a,0xa4,0x73,0xa0,0x15,0x64,0x84,
+0xa0,0x5a,0xb6,0x97,0xb0,0x34,0x59,0xb9,0xd4,0x03,0x52,0x5d,0x06,0xf0,0x12,0x41,
+0x00,0x95,0x30,0x0a,0x34,0xb5,0x90,0x01,0x25,0xf9,0x40,0x6b,0x06,0xb9,0x20,0x09,
+0x38,0x90,0x90,0x09,0x40,0x90,0x10,0x4b,0xa2,0x00,0x10,0x40,0x17,0x88,0x81,0x00,
+0x9d,0x04,0xf1,0x0b,0x0c,0x77,0xa0,0x02,0x0b,0x66,0xa0,0x5b,0x0c,0x87,0x90,0x09,
+0x09,0x39,0x70,0x09,0x1d,0x82,0x90,0x1a,0x52,0x00,0x10,0x70,0x48,0x88,0x4e,0x09,
+0xf4,0x11,0x31,0x07,0x03,0x50,0x19,0x5b,0x9d,0x83,0x00,0x11,0x90,0x30,0x5b,0x34,
+0x90,0x90,0x09,0x29,0xc8,0xb0,0x09,0x01,0x90,0x00,0x0a,0x5b,0x10,0x00,0x71,0x48,
+0x88,0xa5,0x5b,0x01,0xf1,0x0d,0x37,0x08,0xb9,0x90,0x03,0x17,0x9d,0x70,0x59,0x1b,
+0x7b,0xb0,0x09,0x1b,0x5a,0xb0,0x09,0x19,0x29,0x90,0x1a,0x53,0x04,0x60,0x70,0x48,
+0x79,0xb4,0x48,0x00,0xd0,0x00,0x90,0x00,0x1a,0x58,0xc8,0x83,0x01,0x38,0xc7,0x90,
+0x7b,0x43,0x48,0x00,0xc2,0xfc,0x70,0x09,0x45,0x92,0x80,0x28,0x50,0x20,0x00,0x70,
+0x38,0x48,0x00,0xf0,0x0a,0x16,0x00,0x90,0x00,0x09,0x67,0xc7,0x73,0x00,0x39,0xc7,
+0xb0,0x5c,0x39,0xc6,0xc0,0x09,0x28,0xc7,0x90,0x09,0x57,0xc7,0x74,0x27,0x24,0x00,
+0x34,0x48,0x89,0xb9,0x6c,0x00,0xf0,0x0d,0x38,0x49,0xd7,0xb0,0x02,0x56,0xb6,0x80,
+0x47,0x56,0x77,0x90,0x09,0x66,0x79,0x80,0x09,0x83,0x67,0x80,0x0a,0x60,0x04,0x50,
+0x72,0x38,0x88,0xa4,0x20,0x00,0xf1,0x12,0x32,0x06,0x25,0x00,0x09,0x1d,0x8d,0x83,
+0x00,0x9a,0x19,0x10,0x49,0x1b,0x6b,0x60,0x09,0x0c,0x7c,0x70,0x09,0x0c,0x8c,0x84,
+0x0b,0x54,0x00,0x00,0x72,0x38,0x88,0x97,0x00,0x2e,0x04,0xf0,0x0f,0x05,0x00,0x39,
+0x6c,0x7b,0x84,0x01,0x19,0x57,0x82,0x5c,0x18,0x80,0x90,0x09,0x34,0x87,0xc4,0x09,
+0x80,0x80,0x80,0x0a,0x75,0x25,0x20,0x71,0x48,0x89,0xb6,0x23,0x00,0xf1,0x0d,0x26,
+0x87,0x98,0x85,0x04,0x49,0xca,0x82,0x58,0x1b,0xba,0xc0,0x09,0x1a,0xa8,0xb0,0x09,
+0x37,0xa8,0x73,0x39,0x71,0x41,0x01,0x40,0x16,0x88,0x84,0xa4,0x01,0xf1,0x0c,0x1a,
+0xe9,0x90,0x00,0x08,0x24,0x80,0x5c,0x39,0x77,0xa3,0x09,0x34,0xaa,0x43,0x09,0x34,
+0xa8,0x43,0x1b,0x62,0x00,0x70,0x80,0x59,0x88,0xa8,0x71,0x08,0xf1,0x04,0x05,0x02,
+0x30,0x19,0x49,0xab,0x83,0x00,0x07,0xb7,0x50,0x5c,0x0b,0x66,0xa0,0x09,0x0a,0x33,
+0x90,0x04,0x00,0x45,0x27,0x77,0x50,0x70,0x3c,0x01,0xf4,0x0f,0x33,0x00,0x29,0x37,
+0x97,0xb0,0x01,0x07,0x88,0x00,0x4b,0x3c,0x8a,0x62,0x09,0x39,0x7c,0x75,0x09,0x09,
+0x08,0x44,0x0a,0x47,0x77,0x72,0x71,0x48,0x89,0xa9,0xf4,0x00,0xf5,0x0d,0x28,0x5d,
+0xdd,0xe4,0x01,0x56,0x47,0x70,0x48,0x56,0x67,0x82,0x09,0x76,0x9b,0x71,0x09,0x8a,
+0x6b,0x63,0x0a,0x60,0x07,0x00,0x63,0x48,0x89,0xa6,0x24,0x00,0xf2,0x0c,0x8d,0xac,
+0xc7,0x01,0x65,0x79,0x56,0x49,0x2a,0x58,0x82,0x09,0x19,0x38,0x51,0x09,0x5b,0xab,
+0xa5,0x0a,0x74,0x00,0x53,0x72,0x37,0x88,0x99,0xf9,0x05,0xf6,0x0d,0x30,0x00,0x09,
+0x1d,0x99,0xb0,0x00,0x0c,0x99,0xb0,0x5c,0x56,0x88,0x64,0x09,0x5b,0x98,0xa4,0x09,
+0x05,0x96,0x60,0x1b,0xa5,0x06,0x40,0x70,0x5a,0x60,0x01,0xf1,0x0d,0x19,0x8d,0xee,
+0xd8,0x01,0x35,0x28,0x60,0x5c,0x7a,0x9b,0xb4,0x08,0x79,0x8b,0xb3,0x08,0x55,0x5a,
+0xb3,0x1a,0x73,0x28,0x64,0x80,0x59,0x88,0xaa,0x21,0x00,0xf1,0x0f,0x30,0x00,0x00,
+0x09,0xa9,0x5a,0x99,0x06,0x28,0x18,0x62,0x28,0x9a,0x68,0x81,0x07,0x88,0x38,0x07,
+0x08,0x02,0x68,0x48,0x0b,0x89,0x68,0x40,0x08,0x02,0x68,0x23,0x00,0xf0,0x0d,0x4b,
+0xc8,0x58,0x88,0x4b,0xba,0x00,0x09,0x47,0x57,0x69,0x89,0x47,0x39,0x81,0x06,0x48,
+0x6a,0x81,0x02,0x49,0x7a,0x81,0x08,0x42,0x07,0x49,0x97,0x8a,0x09,0xf0,0x11,0x6b,
+0x79,0xaa,0xb0,0x68,0x75,0xac,0x90,0x5d,0x68,0x9c,0x81,0x1e,0x70,0x73,0x30,0x79,
+0x35,0x8b,0x70,0x48,0x04,0x7b,0x60,0x08,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0xf0,
+0x01,0x00,0x00,0x13,0x10,0x6f,0xff,0xdb,0x92,0x07,0x7c,0x77,0x40,0x0b,0x6b,0x67,
+0x80,0x04,0x00,0xf0,0x59,0x17,0x7c,0x87,0x60,0x00,0x08,0x00,0x00,0x57,0x7c,0x87,
+0x72,0x05,0xcb,0xbb,0xb0,0x03,0x76,0x66,0x70,0x29,0xaa,0xaa,0xa5,0x07,0x77,0xb6,
+0xc0,0x04,0x66,0xa5,0x80,0x04,0x67,0xb6,0x61,0x27,0x78,0xb7,0x76,0x00,0x00,0x00,
+0x00,0x01,0xc1,0x09,0x00,0x1a,0x29,0x09,0x00,0x27,0xc5,0x4b,0x42,0x17,0xc7,0x5b,
+0x53,0x03,0x84,0x09,0x00,0x07,0x87,0x09,0x00,0x04,0xb9,0x09,0x00,0x28,0x40,0x09,
+0x00,0x02,0x10,0x00,0x00,0x1b,0x84,0xb9,0xc0,0x89,0x71,0x80,0x90,0x5a,0x85,0xc8,
+0xa0,0x26,0x50,0x80,0x90,0x29,0x60,0x80,0x90,0x5a,0x89,0xc9,0xc4,0x40,0x00,0xf0,
+0x11,0x04,0x00,0x40,0x00,0x39,0x91,0xb7,0xa0,0x79,0x63,0x77,0x70,0x5b,0x87,0x7b,
 0x83,0x27,0x44,0x4d,0x81,0x58,0x70,0x7a,0x60,0x19,0x88,0x47,0x83,0x66,0x20,0x85,
-0x02,0x00,0x02,0xf2,0x10,0x30,0x80,0x80,0x49,0x97,0xd9,0xd2,0x8a,0x71,0x91,0x90,
-0x38,0x55,0x77,0x73,0x48,0x73,0xa7,0xb0,0x39,0x73,0x96,0xb0,0x5a,0x73,0xa7,0xc0,
-0x10,0x03,0x50,0x80,0x6d,0x18,0xf6,0x13,0x44,0x67,0x10,0x28,0x89,0x77,0x88,0x05,
-0x96,0x81,0x99,0xb0,0x3b,0x77,0x89,0x93,0x02,0x74,0x77,0xaa,0x50,0x2a,0x6a,0x29,
-0xa6,0x03,0xc9,0x75,0x11,0x00,0x44,0x23,0x37,0x77,0x1b,0x38,0xf0,0x10,0x45,0x08,
-0x50,0x65,0x76,0x48,0x70,0x5a,0x86,0x88,0xb0,0x5b,0x88,0x87,0xc0,0x36,0x58,0x87,
-0xc0,0x58,0x87,0x87,0xc0,0x4a,0x84,0x71,0x70,0x20,0x05,0x00,0x22,0xe8,0x1e,0xf2,
-0x0b,0x39,0x96,0xa8,0xa2,0xa9,0x87,0xa9,0x93,0x4b,0x56,0x66,0x90,0x49,0x58,0x55,
-0xb0,0x68,0x74,0xaa,0x70,0x19,0x62,0x98,0x03,0x77,0x69,0x2a,0x08,0x00,0x10,0x11,
-0xf0,0x55,0x19,0x95,0xb8,0xc5,0x7a,0x76,0xb7,0xc7,0x29,0x54,0x79,0x66,0x38,0x75,
-0x7b,0x68,0x48,0x72,0x6b,0x64,0x08,0xa4,0x7c,0x74,0x69,0x36,0x7c,0x76,0x01,0x00,
-0x00,0x10,0x1b,0x5b,0xc5,0xb2,0x58,0x5b,0x9d,0x81,0x3b,0x69,0x94,0x35,0x37,0x46,
-0x98,0x73,0x48,0x67,0x54,0x27,0x18,0x67,0x54,0x27,0x49,0x6c,0xba,0x9b,0x04,0xa7,
-0x77,0x60,0x04,0xa7,0x77,0x40,0x04,0xa6,0x66,0x30,0x6b,0xaa,0xa8,0xa2,0x06,0x30,
-0x97,0x60,0x07,0x67,0x5a,0x60,0x05,0x41,0x00,0x33,0x0c,0x7a,0x69,0x79,0x0b,0x6a,
-0x67,0x69,0x0c,0x77,0x48,0x79,0x1b,0x38,0x06,0x04,0x00,0xf0,0x0f,0x03,0x97,0x0f,
-0xed,0x6e,0xe9,0x08,0x08,0x62,0x09,0x0e,0xbb,0x5c,0xb9,0x08,0x67,0xb8,0x29,0x08,
-0x05,0xd0,0x09,0x08,0x68,0x80,0x09,0x08,0x42,0xa3,0x96,0x0f,0x3d,0xf0,0x22,0x0b,
-0x5a,0x67,0x59,0x0b,0x87,0x48,0x79,0x08,0x4b,0x88,0x19,0x08,0x7c,0xaa,0x39,0x08,
-0x16,0x34,0x09,0x08,0x70,0x35,0x96,0xc7,0xa5,0x97,0x9b,0x6a,0x58,0x69,0xc7,0x85,
-0x97,0x99,0x0c,0x98,0x09,0x90,0xb6,0x80,0x99,0x25,0x18,0x09,0x94,0x05,0x48,0x60,
-0x51,0x00,0xf1,0x01,0x0a,0x39,0x64,0x39,0x0b,0x44,0x25,0x59,0x08,0x49,0x79,0x09,
-0x08,0x49,0x69,0x09,0x4c,0x3d,0x70,0x11,0x02,0x96,0x0c,0x9b,0x79,0xa7,0x04,0x00,
-0xf0,0x05,0x07,0x54,0x45,0x27,0x07,0x97,0x79,0x17,0x07,0x99,0x98,0x37,0x07,0x78,
-0x79,0x17,0x07,0x26,0x61,0x94,0x1c,0x05,0xf0,0x04,0x88,0xb8,0x8c,0x84,0x83,0x68,
-0x00,0x07,0x82,0x60,0x60,0x70,0x80,0x80,0xc7,0x10,0x84,0x60,0x80,0xce,0x10,0xf0,
-0x16,0x08,0x80,0x00,0xa9,0x93,0x00,0x05,0x20,0x90,0x89,0x79,0x00,0x90,0x84,0x5b,
-0x88,0xc3,0x83,0x98,0x30,0x90,0x80,0x87,0x63,0x90,0x84,0x57,0x03,0x90,0x80,0x07,
-0x00,0x90,0x80,0x07,0x08,0x70,0x29,0x0c,0xf0,0x09,0x88,0x94,0xa8,0xb0,0x84,0x46,
-0x9a,0x20,0x85,0x47,0x87,0x82,0x80,0x87,0x8c,0x81,0x86,0x58,0x09,0x00,0x80,0x08,
-0x8c,0x82,0xed,0x3a,0x04,0x01,0x00,0xf3,0x0d,0x0c,0xb7,0xb8,0xc0,0x08,0xb1,0x96,
-0xb0,0x08,0x93,0xb8,0xc0,0x07,0x18,0x56,0x23,0x09,0x83,0x56,0x80,0x07,0x01,0x64,
-0xa0,0x07,0x03,0xb3,0x46,0xc4,0x41,0xf4,0x0e,0x00,0x88,0x90,0x7a,0x20,0x84,0x49,
-0x30,0x85,0x84,0x32,0x7c,0x70,0x80,0x97,0x7c,0x74,0x85,0x45,0x19,0x60,0x80,0x19,
-0x09,0x46,0x80,0x21,0x77,0x03,0x14,0x34,0xf3,0x0d,0x88,0x93,0x88,0x10,0x83,0x74,
-0x52,0x72,0x82,0x46,0x7a,0x50,0x80,0x86,0x78,0x60,0x84,0x77,0xa8,0x72,0x80,0x08,
-0x23,0x80,0x80,0x2a,0x87,0x91,0x24,0x00,0xf0,0x0a,0x08,0x89,0x1b,0x88,0x84,0x48,
-0x06,0x38,0x17,0x77,0x87,0x80,0x8a,0x00,0x98,0x43,0xc7,0x7c,0x80,0x0c,0x77,0xc8,
-0x00,0x90,0x09,0x4e,0x27,0xf5,0x0c,0x78,0x8c,0x8b,0x51,0x74,0x2a,0x0a,0x03,0x72,
-0x7b,0x99,0x83,0x70,0x87,0x98,0x90,0x74,0x4b,0x66,0xc0,0x70,0x0a,0x11,0xa0,0x70,
-0x0b,0x77,0xab,0x09,0xf2,0x0c,0x89,0x8c,0xff,0xf3,0x84,0x18,0x44,0xa0,0x82,0x58,
-0x99,0x92,0x80,0x88,0x62,0x64,0x85,0x49,0x9b,0x74,0x80,0x08,0x08,0x34,0x80,0x08,
-0x08,0x3e,0x18,0x00,0x34,0x01,0xf6,0x08,0x95,0x89,0x82,0x83,0x57,0x98,0x85,0x82,
-0x58,0x66,0xa0,0x80,0x89,0x66,0xb0,0x84,0x54,0x6c,0x60,0x80,0x28,0x8c,0x85,0xf4,
-0x00,0xf1,0x0f,0x02,0x00,0x79,0x96,0xba,0x94,0x75,0x13,0xa9,0xb4,0x72,0x7a,0x47,
-0x71,0x70,0x88,0x86,0x92,0x75,0x48,0x86,0x92,0x70,0x1b,0x50,0x60,0x70,0x50,0x78,
-0x96,0x22,0x00,0xf0,0x67,0x42,0x40,0x00,0x1c,0x88,0xb7,0x70,0x8c,0x68,0xa6,0x50,
-0x0a,0x68,0xa6,0x50,0x0b,0xab,0xca,0xa3,0x58,0x8d,0xc7,0x72,0x05,0xa8,0x69,0x20,
-0x86,0x06,0x20,0x64,0x05,0x50,0x34,0x20,0x2b,0xb6,0xc8,0xa2,0x5b,0xb6,0xc8,0x91,
-0x0c,0xc8,0x8a,0xb3,0x19,0x99,0x99,0x61,0x00,0x86,0x3a,0x10,0x15,0x7a,0xb9,0x62,
-0x23,0x00,0x00,0x21,0x00,0x20,0x03,0x10,0x47,0x97,0x54,0x70,0x37,0xa8,0xc8,0xb4,
-0x3b,0x89,0xa7,0xb3,0x37,0xb7,0x80,0x80,0x77,0x77,0x87,0xb3,0x73,0x39,0x88,0xc5,
-0x70,0x19,0x70,0x00,0x4d,0xdf,0xdd,0xa0,0x83,0x59,0x35,0x80,0x04,0x6c,0x56,0x10,
-0x37,0x67,0x78,0x61,0x25,0x78,0x7a,0x30,0x00,0x57,0x92,0xdb,0x07,0xf1,0x29,0x00,
-0x2a,0xad,0xaa,0x80,0x85,0x8a,0x58,0x83,0x16,0x89,0x48,0x40,0x09,0x6d,0x66,0x80,
-0x0a,0x6b,0x66,0x90,0x0a,0x6c,0x66,0x46,0x00,0x06,0x77,0x84,0x0c,0xee,0xfe,0xe5,
-0x27,0x64,0x86,0x48,0x03,0x64,0x86,0x50,0x15,0x56,0x85,0x53,0x07,0x7b,0x99,0x93,
-0x09,0x08,0x16,0x43,0x09,0x08,0x16,0x3b,0x0b,0xf0,0x49,0x5d,0xde,0xed,0xc2,0x73,
+0x02,0x24,0x00,0xf0,0x12,0x08,0x30,0x80,0x80,0x49,0x97,0xd9,0xd2,0x8a,0x71,0x91,
+0x90,0x38,0x55,0x77,0x73,0x48,0x73,0xa7,0xb0,0x39,0x73,0x96,0xb0,0x5a,0x73,0xa7,
+0xc0,0x10,0x03,0x50,0x80,0x00,0x01,0x00,0xf4,0x15,0x81,0x44,0x67,0x10,0x28,0x89,
+0x77,0x88,0x05,0x96,0x81,0x99,0xb0,0x3b,0x77,0x89,0x93,0x02,0x74,0x77,0xaa,0x50,
+0x2a,0x6a,0x29,0xa6,0x03,0xc9,0x75,0x11,0x00,0x44,0x23,0x37,0x77,0x00,0x01,0x00,
+0xf1,0x31,0x08,0x45,0x08,0x50,0x65,0x76,0x48,0x70,0x5a,0x86,0x88,0xb0,0x5b,0x88,
+0x87,0xc0,0x36,0x58,0x87,0xc0,0x58,0x87,0x87,0xc0,0x4a,0x84,0x71,0x70,0x20,0x05,
+0x00,0x22,0x05,0x00,0x13,0x00,0x39,0x96,0xa8,0xa2,0xa9,0x87,0xa9,0x93,0x4b,0x56,
+0x66,0x90,0x49,0x58,0x55,0xb0,0x68,0x74,0xaa,0x70,0x19,0x62,0x98,0x03,0x77,0x69,
+0x17,0x85,0xb9,0x00,0xf6,0x5c,0x10,0x06,0x00,0x19,0x95,0xb8,0xc5,0x7a,0x76,0xb7,
+0xc7,0x29,0x54,0x79,0x66,0x38,0x75,0x7b,0x68,0x48,0x72,0x6b,0x64,0x08,0xa4,0x7c,
+0x74,0x69,0x36,0x7c,0x76,0x01,0x00,0x00,0x10,0x1b,0x5b,0xc5,0xb2,0x58,0x5b,0x9d,
+0x81,0x3b,0x69,0x94,0x35,0x37,0x46,0x98,0x73,0x48,0x67,0x54,0x27,0x18,0x67,0x54,
+0x27,0x49,0x6c,0xba,0x9b,0x04,0xa7,0x77,0x60,0x04,0xa7,0x77,0x40,0x04,0xa6,0x66,
+0x30,0x6b,0xaa,0xa8,0xa2,0x06,0x30,0x97,0x60,0x07,0x67,0x5a,0x60,0x05,0x41,0x00,
+0x33,0x0c,0x7a,0x69,0x79,0x0b,0x6a,0x67,0x69,0x0c,0x77,0x48,0x79,0x08,0x00,0x00,
+0x09,0x04,0x00,0xf0,0x44,0x03,0x97,0x0f,0xed,0x6e,0xe9,0x08,0x08,0x62,0x09,0x0e,
+0xbb,0x5c,0xb9,0x08,0x67,0xb8,0x29,0x08,0x05,0xd0,0x09,0x08,0x68,0x80,0x09,0x08,
+0x42,0xa3,0x96,0x0c,0x7b,0x68,0x79,0x0b,0x5a,0x67,0x59,0x0b,0x87,0x48,0x79,0x08,
+0x4b,0x88,0x19,0x08,0x7c,0xaa,0x39,0x08,0x16,0x34,0x09,0x08,0x70,0x35,0x96,0xc7,
+0xa5,0x97,0x9b,0x6a,0x58,0x69,0xc7,0x85,0x97,0x99,0x0c,0x98,0x09,0x90,0xb6,0x80,
+0x99,0x25,0x18,0x09,0x94,0x05,0x48,0x60,0x51,0x00,0xf0,0x0d,0x0a,0x39,0x64,0x39,
+0x0b,0x44,0x25,0x59,0x08,0x49,0x79,0x09,0x08,0x49,0x69,0x09,0x08,0x49,0x78,0x09,
+0x08,0x11,0x02,0x96,0x0c,0x9b,0x79,0xa7,0x04,0x00,0xf5,0x64,0x07,0x54,0x45,0x27,
+0x07,0x97,0x79,0x17,0x07,0x99,0x98,0x37,0x07,0x78,0x79,0x17,0x07,0x26,0x61,0x94,
+0x00,0x00,0x01,0x00,0x88,0xb8,0x8c,0x84,0x83,0x68,0x00,0x07,0x82,0x60,0x60,0x70,
+0x80,0x80,0xc7,0x10,0x84,0x60,0x80,0x00,0x80,0x00,0x80,0x08,0x80,0x00,0xa9,0x93,
+0x00,0x05,0x20,0x90,0x89,0x79,0x00,0x90,0x84,0x5b,0x88,0xc3,0x83,0x98,0x30,0x90,
+0x80,0x87,0x63,0x90,0x84,0x57,0x03,0x90,0x80,0x07,0x00,0x90,0x80,0x07,0x08,0x70,
+0x00,0x00,0x20,0x00,0x88,0x94,0xa8,0xb0,0x84,0x46,0x9a,0x20,0x85,0x47,0x87,0x82,
+0x80,0x87,0x8c,0x81,0x86,0x58,0x09,0x00,0x80,0x08,0x8c,0x82,0x80,0x00,0x09,0xad,
+0x01,0xf2,0x0d,0x0c,0xb7,0xb8,0xc0,0x08,0xb1,0x96,0xb0,0x08,0x93,0xb8,0xc0,0x07,
+0x18,0x56,0x23,0x09,0x83,0x56,0x80,0x07,0x01,0x64,0xa0,0x07,0x03,0xb3,0x46,0x22,
+0x00,0xf1,0x0f,0x03,0x00,0x88,0x90,0x7a,0x20,0x84,0x49,0x30,0x85,0x84,0x32,0x7c,
+0x70,0x80,0x97,0x7c,0x74,0x85,0x45,0x19,0x60,0x80,0x19,0x09,0x46,0x80,0x21,0x77,
+0x03,0x24,0x00,0x00,0x6c,0x00,0xf3,0x0c,0x93,0x88,0x10,0x83,0x74,0x52,0x72,0x82,
+0x46,0x7a,0x50,0x80,0x86,0x78,0x60,0x84,0x77,0xa8,0x72,0x80,0x08,0x23,0x80,0x80,
+0x2a,0x87,0x91,0x24,0x00,0xf4,0x2a,0x08,0x89,0x1b,0x88,0x84,0x48,0x06,0x38,0x17,
+0x77,0x87,0x80,0x8a,0x00,0x98,0x43,0xc7,0x7c,0x80,0x0c,0x77,0xc8,0x00,0x90,0x09,
+0x00,0x09,0x09,0x00,0x78,0x8c,0x8b,0x51,0x74,0x2a,0x0a,0x03,0x72,0x7b,0x99,0x83,
+0x70,0x87,0x98,0x90,0x74,0x4b,0x66,0xc0,0x70,0x0a,0x11,0xa0,0x70,0x0b,0x77,0xc0,
+0xac,0x00,0xf1,0x0d,0x89,0x8c,0xff,0xf3,0x84,0x18,0x44,0xa0,0x82,0x58,0x99,0x92,
+0x80,0x88,0x62,0x64,0x85,0x49,0x9b,0x74,0x80,0x08,0x08,0x34,0x80,0x08,0x08,0x83,
+0x22,0x00,0x00,0x34,0x01,0xf6,0x08,0x95,0x89,0x82,0x83,0x57,0x98,0x85,0x82,0x58,
+0x66,0xa0,0x80,0x89,0x66,0xb0,0x84,0x54,0x6c,0x60,0x80,0x28,0x8c,0x85,0xf4,0x00,
+0xf1,0x0f,0x02,0x00,0x79,0x96,0xba,0x94,0x75,0x13,0xa9,0xb4,0x72,0x7a,0x47,0x71,
+0x70,0x88,0x86,0x92,0x75,0x48,0x86,0x92,0x70,0x1b,0x50,0x60,0x70,0x50,0x78,0x96,
+0x22,0x00,0xf0,0xa4,0x42,0x40,0x00,0x1c,0x88,0xb7,0x70,0x8c,0x68,0xa6,0x50,0x0a,
+0x68,0xa6,0x50,0x0b,0xab,0xca,0xa3,0x58,0x8d,0xc7,0x72,0x05,0xa8,0x69,0x20,0x86,
+0x06,0x20,0x64,0x05,0x50,0x34,0x20,0x2b,0xb6,0xc8,0xa2,0x5b,0xb6,0xc8,0x91,0x0c,
+0xc8,0x8a,0xb3,0x19,0x99,0x99,0x61,0x00,0x86,0x3a,0x10,0x15,0x7a,0xb9,0x62,0x23,
+0x00,0x00,0x21,0x00,0x20,0x03,0x10,0x47,0x97,0x54,0x70,0x37,0xa8,0xc8,0xb4,0x3b,
+0x89,0xa7,0xb3,0x37,0xb7,0x80,0x80,0x77,0x77,0x87,0xb3,0x73,0x39,0x88,0xc5,0x70,
+0x19,0x70,0x00,0x4d,0xdf,0xdd,0xa0,0x83,0x59,0x35,0x80,0x04,0x6c,0x56,0x10,0x37,
+0x67,0x78,0x61,0x25,0x78,0x7a,0x30,0x00,0x57,0x92,0x00,0x00,0x00,0x62,0x00,0x2a,
+0xad,0xaa,0x80,0x85,0x8a,0x58,0x83,0x16,0x89,0x48,0x40,0x09,0x6d,0x66,0x80,0x0a,
+0x6b,0x66,0x90,0x0a,0x6c,0x66,0x46,0x00,0x06,0x77,0x84,0x0c,0xee,0xfe,0xe5,0x27,
+0x64,0x86,0x48,0x03,0x64,0x86,0x50,0x15,0x56,0x85,0x53,0x07,0x7b,0x99,0x93,0x09,
+0x08,0x16,0x43,0x09,0x08,0x16,0x92,0xb8,0x00,0xf0,0x49,0x5d,0xde,0xed,0xc2,0x73,
 0x58,0x45,0x64,0x0d,0xff,0xdf,0xa1,0x18,0x77,0x77,0x40,0x2a,0x97,0x86,0x83,0x83,
 0xa2,0x6a,0x80,0x51,0x74,0x10,0x43,0x3a,0xad,0xaa,0x80,0x54,0x68,0x46,0x51,0x2c,
 0xcc,0x9d,0x90,0x36,0x77,0x67,0x70,0x17,0x9b,0x6a,0x50,0x08,0x78,0x4a,0x10,0x6a,
 0x9c,0xb7,0xa2,0x01,0x91,0x46,0x83,0x16,0xb5,0x76,0x24,0x17,0xc5,0x76,0x61,0x28,
 0x87,0x5a,0x64,0x0b,0x69,0x8c,0x99,0x0a,0x58,0x8c,0x94,0x0b,0x68,0x08,0x00,0x07,
-0x46,0x79,0x00,0xa0,0x01,0x50,0x19,0x99,0x0d,0x98,0x00,0xa8,0x4c,0x30,0x99,0x0d,
-0x96,0x08,0x00,0x40,0x39,0x99,0x0d,0x99,0x08,0x00,0x00,0x04,0x00,0xf0,0x09,0x28,
+0x46,0x79,0x00,0xa0,0x01,0x40,0x19,0x99,0x0d,0x98,0x08,0x00,0x40,0x09,0x99,0x0d,
+0x96,0x08,0x00,0x40,0x39,0x99,0x0d,0x99,0x08,0x00,0x00,0x04,0x00,0xf0,0x0d,0x28,
 0x8a,0xb8,0x86,0x08,0x8b,0xa9,0x83,0x09,0x35,0x08,0x35,0x09,0x3a,0x78,0x35,0x09,
-0x39,0x68,0x35,0x0c,0xab,0x8c,0xa5,0xe3,0x22,0x11,0x02,0x2b,0x1c,0xf0,0x27,0x8c,
-0xb1,0x68,0x88,0x38,0x70,0x57,0x59,0x78,0x80,0x38,0xb6,0x48,0x80,0x77,0xb5,0x25,
-0x80,0x47,0xc7,0x80,0x80,0x00,0x92,0x55,0x80,0x00,0x80,0x1a,0x10,0x29,0xc6,0x7c,
-0x85,0x19,0xb7,0x89,0x88,0x1a,0x69,0xb6,0x69,0x1a,0x79,0x66,0xa5,0x26,0xb5,0xb7,
-0xc7,0x13,0xa2,0xa7,0xc6,0xed,0x02,0x04,0x82,0x09,0xf0,0x29,0x29,0xa8,0x8c,0x70,
-0x00,0x90,0x28,0x00,0x68,0x88,0x88,0x82,0x07,0x77,0x79,0x30,0x09,0x77,0x7a,0x40,
-0x09,0x00,0x04,0x40,0x09,0x88,0x8a,0x40,0x01,0x00,0x10,0x00,0x1a,0x5c,0xba,0xa7,
-0x19,0x9a,0x88,0x37,0x1b,0x3c,0x98,0x64,0x13,0x65,0x78,0x50,0x27,0xbb,0xbb,0x95,
-0x02,0x95,0x55,0x90,0x04,0x00,0xf4,0x05,0x48,0x8d,0x98,0x80,0x09,0x67,0x67,0x60,
-0x0a,0x77,0x78,0x70,0x0a,0x66,0x68,0x70,0x0b,0x77,0x79,0x70,0x9e,0x47,0xc2,0x6c,
-0x97,0x9b,0x72,0x07,0x17,0x77,0xa0,0x07,0x18,0x66,0xb0,0x04,0x00,0x91,0x77,0xc0,
-0x07,0x10,0x23,0x20,0x5a,0x38,0x20,0x54,0x01,0xf1,0x0b,0x5a,0x88,0xab,0x83,0x09,
-0x08,0x77,0xb0,0x09,0x08,0x66,0xb0,0x09,0x4a,0x66,0xb0,0x68,0x48,0x77,0xb0,0x00,
-0x05,0x42,0x70,0x00,0x22,0xb6,0x39,0xd4,0x00,0x76,0x73,0x8c,0x81,0x76,0x70,0xa8,
-0xa0,0x76,0x70,0xb6,0xb0,0x04,0x00,0x84,0x82,0x70,0x82,0x60,0x60,0x69,0x50,0x72,
-0x36,0x1b,0xf1,0x0d,0x07,0x37,0x9c,0x84,0x31,0x27,0x67,0x83,0x07,0x68,0x66,0x94,
-0x44,0x08,0x66,0x94,0x01,0xa9,0x77,0xa4,0x4a,0x15,0x61,0x70,0x20,0x34,0x00,0x14,
-0xea,0x0a,0xf1,0x00,0xb7,0x9a,0x71,0x4b,0x47,0x77,0x90,0x5b,0xbb,0x66,0xb0,0x09,
-0x69,0x66,0xb0,0x70,0x00,0x74,0x01,0x43,0x30,0x6a,0x19,0x10,0x91,0xe1,0x14,0xf1,
-0x0c,0x06,0xb6,0x8b,0x96,0x28,0x93,0x97,0x79,0x36,0xb5,0x96,0x69,0x44,0x98,0x96,
-0x69,0x30,0xd3,0x97,0x79,0x07,0x70,0x64,0x53,0x32,0x01,0x30,0x84,0x03,0xf4,0x0d,
-0x2a,0x78,0x7b,0x72,0x2a,0x77,0x96,0xb0,0x27,0x74,0xa7,0xc0,0x37,0xa4,0xa7,0xc0,
-0x17,0xb6,0x76,0x80,0x4b,0x72,0x80,0x82,0x71,0x87,0x77,0x83,0x38,0x10,0xf1,0x49,
-0x4b,0xa8,0x8c,0x96,0x1a,0xa3,0xa6,0x68,0x49,0x99,0xa7,0x78,0x56,0x62,0xa6,0x68,
-0x55,0x62,0xa7,0x78,0x81,0x75,0x72,0x62,0x24,0x13,0x20,0x04,0x01,0x81,0x00,0x00,
-0x16,0x86,0x8c,0x86,0x2b,0xe6,0x87,0x67,0x11,0x77,0xa6,0x68,0x37,0xba,0xa8,0x88,
-0x15,0xb2,0xa7,0x78,0x1a,0x47,0x62,0x53,0x20,0x03,0x20,0x04,0x7c,0xcc,0x7c,0x91,
-0x76,0x6a,0x86,0xb0,0x54,0x54,0x87,0xb0,0x79,0x79,0x86,0xb0,0x77,0x88,0xb7,0xb0,
-0x77,0x76,0x62,0x70,0x32,0x10,0x40,0x21,0xc4,0x00,0xf0,0x0c,0xb5,0x8b,0x71,0x4b,
-0x35,0x88,0x90,0x5b,0xb9,0x36,0x90,0x09,0x67,0x37,0x90,0x09,0x05,0x46,0x70,0x09,
-0x00,0x87,0x40,0x6a,0x08,0x30,0x80,0x6a,0x07,0xf5,0x29,0x28,0x98,0x6b,0x73,0x2b,
-0x9a,0x87,0x73,0x45,0x53,0x77,0x33,0x48,0x45,0x77,0x33,0x59,0x75,0x67,0x33,0x73,
-0x93,0x45,0x81,0x43,0x03,0x40,0x04,0x08,0x9a,0x8a,0x71,0x29,0x79,0x07,0x73,0x4b,
-0x9c,0x87,0x95,0x07,0x18,0x19,0x82,0x09,0x08,0x09,0xa3,0x0a,0x08,0x05,0x53,0x73,
-0x08,0x00,0x96,0xa9,0x04,0xf0,0x14,0x47,0x00,0x70,0x00,0x1b,0x94,0xbc,0x89,0x03,
-0x8a,0x59,0xca,0x80,0x0b,0x84,0x86,0x65,0x00,0xa7,0x4a,0x55,0x80,0x0b,0x81,0xb6,
-0x68,0x01,0xb9,0x4a,0x7a,0x40,0x25,0x05,0x40,0x16,0x68,0x19,0xf4,0x0e,0x00,0x2a,
-0x8a,0x88,0x88,0x48,0x37,0x57,0x75,0x08,0x76,0xb6,0x50,0x08,0x99,0xd9,0x40,0x08,
-0x98,0xc8,0x73,0x07,0x42,0x26,0x26,0x53,0x61,0x55,0x92,0xaa,0x0d,0xf5,0x0c,0x78,
-0xc4,0x2a,0x21,0x77,0xb9,0x3a,0x48,0x76,0xb9,0x3a,0x48,0x68,0xa8,0x4a,0x31,0x35,
-0x65,0x97,0x00,0x56,0x73,0xa9,0x00,0x21,0x87,0x54,0x3d,0x11,0xf0,0x0d,0x7a,0x8a,
-0x7a,0xa4,0x7a,0x89,0x35,0x90,0x7a,0x79,0x26,0x60,0x6a,0x99,0x77,0x96,0x46,0xa9,
-0x66,0x66,0x67,0x88,0x43,0x52,0x11,0x94,0x77,0x75,0x15,0x05,0xf3,0x0d,0x7a,0x80,
-0x98,0x50,0x79,0x66,0x76,0x73,0x7a,0x77,0x87,0x80,0x59,0xa8,0xa8,0xa1,0x47,0xa0,
-0x40,0x50,0x68,0x94,0xa5,0x80,0x22,0x86,0x2a,0x52,0x81,0x08,0xf1,0x0e,0x30,0x1c,
-0xc2,0x7b,0x81,0x3b,0xb6,0xac,0xb2,0x58,0x99,0xaa,0xa3,0x1a,0xb0,0x87,0x80,0x1a,
-0xb0,0xb6,0xa0,0x16,0x70,0x61,0x70,0x16,0x95,0xbc,0xa3,0x70,0x50,0xf0,0x0c,0x89,
-0x88,0x82,0x07,0x76,0x6a,0x10,0x05,0x76,0x69,0x10,0x68,0x77,0x77,0xb0,0x62,0xa7,
-0x85,0x90,0x62,0xb7,0x74,0x90,0x62,0x10,0x03,0x90,0x53,0x09,0xf4,0x0d,0x78,0x8a,
-0x77,0xa0,0x80,0x8a,0x66,0xa0,0x80,0x8a,0x88,0x70,0x80,0x8a,0x77,0x74,0x88,0x66,
-0x89,0x96,0x10,0x56,0x77,0x84,0x00,0x70,0x33,0xa1,0x77,0x0c,0xf0,0x0d,0x18,0xb9,
-0xc9,0xa5,0x05,0x95,0xb9,0x80,0x03,0x67,0x79,0x23,0x39,0x6e,0x78,0x87,0x06,0x87,
-0x46,0x00,0x00,0x4a,0x99,0x20,0x07,0x40,0x00,0x60,0xec,0x00,0xf0,0x0e,0x3a,0xac,
-0x08,0x60,0x37,0x99,0x3a,0x64,0x16,0xb6,0x2b,0x41,0x17,0xb7,0x0b,0x60,0x38,0x88,
-0x17,0x80,0x57,0x76,0x81,0x56,0x21,0x20,0x40,0x04,0x00,0xf5,0x34,0xf1,0x29,0xbb,
-0x09,0x00,0x46,0xa8,0x09,0x86,0x17,0xb6,0x09,0x00,0x27,0xb6,0xa9,0x95,0x38,0x88,
-0x80,0x26,0x48,0x65,0xa8,0x96,0x41,0x00,0x80,0x26,0x00,0x02,0x30,0x00,0x27,0x7a,
-0xa7,0x95,0x1b,0x96,0x79,0xa0,0x2a,0x93,0x6b,0xa7,0x23,0x20,0x01,0x33,0x04,0x96,
-0x67,0x70,0x07,0x87,0x78,0x70,0x18,0xd8,0x0c,0x01,0xc8,0x1c,0xf0,0x02,0x00,0x58,
-0xb8,0x9c,0x81,0x00,0x74,0x92,0x00,0x02,0x6d,0xb5,0x10,0x7a,0x70,0x19,0xa3,0x3e,
-0x27,0x55,0x04,0x50,0x09,0x00,0x0a,0x75,0x05,0xf0,0x01,0x26,0xbe,0x00,0x8d,0xff,
-0xff,0x00,0xff,0xe9,0x5f,0x00,0xf3,0x00,0x0f,0x00,0xf0,0x04,0x00,0xf0,0x07,0x0a,
-0xff,0xaf,0xf0,0x0a,0xfa,0xaf,0xa0,0x00,0x00,0xbd,0xcc,0xce,0xab,0x8b,0x00,0x07,
-0x58,0xcd,0x66,0x6a,0xac,0x04,0x00,0x00,0x0c,0x00,0x00,0x14,0x00,0xf0,0x01,0x34,
-0x14,0x44,0x43,0xff,0x7f,0xff,0xff,0xab,0x4b,0xbb,0xba,0xbc,0x5c,0xcc,0xcb,0x0c,
-0x00,0x43,0x67,0x17,0x88,0x86,0x14,0x00,0x00,0x22,0x55,0xf0,0x04,0x9a,0x00,0x00,
-0x09,0xfa,0xa9,0x00,0x9f,0xa0,0xaf,0x99,0xfa,0x00,0x0a,0xff,0xa0,0x00,0x00,0x99,
-0xea,0x40,0xf0,0x31,0x72,0xcf,0x4a,0xf4,0x1d,0xff,0x60,0x0a,0xff,0x30,0xaf,0x7d,
-0xf3,0xa6,0x01,0xb3,0x00,0x0c,0x51,0x00,0x1d,0x7d,0x6e,0x70,0x8d,0x0d,0x65,0xf1,
-0xc7,0x0d,0x60,0xe6,0xd7,0x06,0x20,0xe6,0x9d,0x00,0x04,0xf2,0x1e,0xc7,0x8f,0x80,
-0x01,0x9d,0xc6,0x00,0x00,0x0c,0xc0,0x00,0x18,0x8f,0xf8,0x81,0x8f,0xfe,0xef,0xf8,
-0x2f,0xe0,0x0e,0xf2,0x04,0x00,0x00,0x0c,0x00,0x00,0x14,0x00,0x30,0x00,0x0c,0xc0,
-0x2e,0x0a,0xf4,0x16,0x22,0x00,0x00,0xaf,0xaa,0xa0,0x01,0xda,0x6a,0xfa,0x03,0xe8,
-0xbf,0xb8,0xe3,0xb6,0xdf,0xff,0xd6,0xb0,0x8f,0xfb,0xff,0x80,0x08,0xfc,0x0c,0xf8,
-0x00,0x5b,0x80,0x8b,0x50,0x00,0x0f,0xf0,0x00,0x04,0x00,0xf0,0x17,0x07,0xff,0xff,
-0x70,0x00,0x9f,0xf9,0x00,0x78,0x7a,0xa7,0x87,0xff,0xfb,0xbf,0xff,0xff,0xff,0xfb,
-0xbf,0x05,0xff,0xff,0xf5,0x01,0xe3,0x00,0x03,0xe1,0xa8,0x00,0x00,0x08,0xaf,0xff,
-0x50,0x6f,0xff,0x01,0x00,0x10,0xfd,0x04,0x00,0x10,0x00,0xa4,0x4c,0xf2,0x10,0xbf,
-0xfb,0x3f,0x2e,0x92,0x18,0xff,0x9a,0x00,0x6c,0xff,0x31,0x00,0x24,0x44,0x44,0x42,
-0x00,0x13,0xff,0xc6,0x00,0xb9,0xfe,0xa5,0x5b,0xd1,0xf2,0x8c,0xc8,0x10,0x55,0x4b,
-0x20,0x34,0xcf,0x35,0x00,0xf2,0x08,0xab,0xff,0x00,0x4f,0x00,0x01,0x00,0x09,0x00,
-0x34,0xcf,0x01,0xff,0xff,0x1b,0xff,0xff,0x1b,0xbb,0xff,0x01,0x00,0x4f,0x78,0x12,
-0x00,0xbf,0x4b,0xf2,0x1d,0x90,0x23,0xb3,0x34,0xcf,0x02,0xc3,0xbf,0xff,0xf1,0xb5,
+0x39,0x68,0x35,0x0c,0xab,0x8c,0xa5,0x09,0x00,0x00,0x35,0xa2,0x04,0xf0,0x29,0x2b,
+0x77,0x8c,0xb1,0x68,0x88,0x38,0x70,0x57,0x59,0x78,0x80,0x38,0xb6,0x48,0x80,0x77,
+0xb5,0x25,0x80,0x47,0xc7,0x80,0x80,0x00,0x92,0x55,0x80,0x00,0x80,0x1a,0x10,0x29,
+0xc6,0x7c,0x85,0x19,0xb7,0x89,0x88,0x1a,0x69,0xb6,0x69,0x1a,0x79,0x66,0xa5,0x26,
+0xb5,0xb7,0xc7,0x13,0xa2,0xa7,0xc6,0xed,0x02,0x01,0xb3,0x01,0xf0,0x2c,0x06,0x00,
+0x00,0x29,0xa8,0x8c,0x70,0x00,0x90,0x28,0x00,0x68,0x88,0x88,0x82,0x07,0x77,0x79,
+0x30,0x09,0x77,0x7a,0x40,0x09,0x00,0x04,0x40,0x09,0x88,0x8a,0x40,0x01,0x00,0x10,
+0x00,0x1a,0x5c,0xba,0xa7,0x19,0x9a,0x88,0x37,0x1b,0x3c,0x98,0x64,0x13,0x65,0x78,
+0x50,0x27,0xbb,0xbb,0x95,0x02,0x95,0x55,0x90,0x04,0x00,0xf2,0x19,0x48,0x8d,0x98,
+0x80,0x09,0x67,0x67,0x60,0x0a,0x77,0x78,0x70,0x0a,0x66,0x68,0x70,0x0b,0x77,0x79,
+0x70,0x05,0x90,0x38,0x30,0x53,0x00,0x00,0x61,0x6c,0x97,0x9b,0x72,0x07,0x17,0x77,
+0xa0,0x07,0x18,0x66,0xb0,0x04,0x00,0x91,0x77,0xc0,0x07,0x10,0x23,0x20,0x5a,0x38,
+0x20,0x54,0x01,0xf0,0x0d,0x5a,0x88,0xab,0x83,0x09,0x08,0x77,0xb0,0x09,0x08,0x66,
+0xb0,0x09,0x4a,0x66,0xb0,0x68,0x48,0x77,0xb0,0x00,0x05,0x42,0x70,0x00,0x22,0x00,
+0x22,0x20,0x00,0xc4,0x76,0x73,0x8c,0x81,0x76,0x70,0xa8,0xa0,0x76,0x70,0xb6,0xb0,
+0x04,0x00,0x81,0x82,0x70,0x82,0x60,0x60,0x69,0x50,0x72,0xbc,0x00,0xf0,0x10,0x10,
+0x00,0x00,0x07,0x37,0x9c,0x84,0x31,0x27,0x67,0x83,0x07,0x68,0x66,0x94,0x44,0x08,
+0x66,0x94,0x01,0xa9,0x77,0xa4,0x4a,0x15,0x61,0x70,0x20,0x34,0x00,0x14,0x23,0x00,
+0xf1,0x01,0x78,0xb7,0x9a,0x71,0x4b,0x47,0x77,0x90,0x5b,0xbb,0x66,0xb0,0x09,0x69,
+0x66,0xb0,0x70,0x00,0x61,0x01,0x43,0x30,0x6a,0x19,0x10,0x3c,0x03,0x00,0x06,0x01,
+0xf1,0x0c,0x06,0xb6,0x8b,0x96,0x28,0x93,0x97,0x79,0x36,0xb5,0x96,0x69,0x44,0x98,
+0x96,0x69,0x30,0xd3,0x97,0x79,0x07,0x70,0x64,0x53,0x32,0x01,0x30,0x84,0x03,0xf3,
+0x0d,0x2a,0x78,0x7b,0x72,0x2a,0x77,0x96,0xb0,0x27,0x74,0xa7,0xc0,0x37,0xa4,0xa7,
+0xc0,0x17,0xb6,0x76,0x80,0x4b,0x72,0x80,0x82,0x71,0x87,0x77,0x83,0xa3,0x03,0xf1,
+0x4a,0x00,0x4b,0xa8,0x8c,0x96,0x1a,0xa3,0xa6,0x68,0x49,0x99,0xa7,0x78,0x56,0x62,
+0xa6,0x68,0x55,0x62,0xa7,0x78,0x81,0x75,0x72,0x62,0x24,0x13,0x20,0x04,0x01,0x81,
+0x00,0x00,0x16,0x86,0x8c,0x86,0x2b,0xe6,0x87,0x67,0x11,0x77,0xa6,0x68,0x37,0xba,
+0xa8,0x88,0x15,0xb2,0xa7,0x78,0x1a,0x47,0x62,0x53,0x20,0x03,0x20,0x04,0x7c,0xcc,
+0x7c,0x91,0x76,0x6a,0x86,0xb0,0x54,0x54,0x87,0xb0,0x79,0x79,0x86,0xb0,0x77,0x88,
+0xb7,0xb0,0x77,0x76,0x62,0x70,0x32,0x10,0x40,0x21,0xc4,0x00,0xf5,0x48,0xb5,0x8b,
+0x71,0x4b,0x35,0x88,0x90,0x5b,0xb9,0x36,0x90,0x09,0x67,0x37,0x90,0x09,0x05,0x46,
+0x70,0x09,0x00,0x87,0x40,0x6a,0x08,0x30,0x80,0x00,0x30,0x00,0x00,0x28,0x98,0x6b,
+0x73,0x2b,0x9a,0x87,0x73,0x45,0x53,0x77,0x33,0x48,0x45,0x77,0x33,0x59,0x75,0x67,
+0x33,0x73,0x93,0x45,0x81,0x43,0x03,0x40,0x04,0x08,0x9a,0x8a,0x71,0x29,0x79,0x07,
+0x73,0x4b,0x9c,0x87,0x95,0x07,0x18,0x19,0x82,0x09,0x08,0x09,0xa3,0x0a,0x08,0x05,
+0x53,0x73,0x08,0x00,0x96,0xa9,0x04,0xf3,0x35,0x47,0x00,0x70,0x00,0x1b,0x94,0xbc,
+0x89,0x03,0x8a,0x59,0xca,0x80,0x0b,0x84,0x86,0x65,0x00,0xa7,0x4a,0x55,0x80,0x0b,
+0x81,0xb6,0x68,0x01,0xb9,0x4a,0x7a,0x40,0x25,0x05,0x40,0x16,0x00,0x02,0x60,0x00,
+0x00,0x2a,0x8a,0x88,0x88,0x48,0x37,0x57,0x75,0x08,0x76,0xb6,0x50,0x08,0x99,0xd9,
+0x40,0x08,0x98,0xc8,0x73,0x07,0x42,0x26,0x26,0x53,0x61,0x55,0x92,0xa0,0x06,0xf4,
+0x0e,0x00,0x78,0xc4,0x2a,0x21,0x77,0xb9,0x3a,0x48,0x76,0xb9,0x3a,0x48,0x68,0xa8,
+0x4a,0x31,0x35,0x65,0x97,0x00,0x56,0x73,0xa9,0x00,0x21,0x87,0x54,0x95,0x70,0x00,
+0xf0,0x0d,0x7a,0x8a,0x7a,0xa4,0x7a,0x89,0x35,0x90,0x7a,0x79,0x26,0x60,0x6a,0x99,
+0x77,0x96,0x46,0xa9,0x66,0x66,0x67,0x88,0x43,0x52,0x11,0x94,0x77,0x75,0x15,0x05,
+0xf2,0x0d,0x7a,0x80,0x98,0x50,0x79,0x66,0x76,0x73,0x7a,0x77,0x87,0x80,0x59,0xa8,
+0xa8,0xa1,0x47,0xa0,0x40,0x50,0x68,0x94,0xa5,0x80,0x22,0x86,0x2a,0x52,0x42,0x00,
+0xf0,0x0f,0x19,0x30,0x1c,0xc2,0x7b,0x81,0x3b,0xb6,0xac,0xb2,0x58,0x99,0xaa,0xa3,
+0x1a,0xb0,0x87,0x80,0x1a,0xb0,0xb6,0xa0,0x16,0x70,0x61,0x70,0x16,0x95,0xbc,0xa3,
+0xd5,0x02,0xf2,0x2d,0x58,0x89,0x88,0x82,0x07,0x76,0x6a,0x10,0x05,0x76,0x69,0x10,
+0x68,0x77,0x77,0xb0,0x62,0xa7,0x85,0x90,0x62,0xb7,0x74,0x90,0x62,0x10,0x03,0x90,
+0x00,0x00,0x33,0x00,0x78,0x8a,0x77,0xa0,0x80,0x8a,0x66,0xa0,0x80,0x8a,0x88,0x70,
+0x80,0x8a,0x77,0x74,0x88,0x66,0x89,0x96,0x10,0x56,0x77,0x84,0x00,0x70,0x33,0xa1,
+0xf0,0x04,0xf0,0x0f,0x70,0x00,0x18,0xb9,0xc9,0xa5,0x05,0x95,0xb9,0x80,0x03,0x67,
+0x79,0x23,0x39,0x6e,0x78,0x87,0x06,0x87,0x46,0x00,0x00,0x4a,0x99,0x20,0x07,0x40,
+0x00,0x60,0xec,0x00,0xf0,0x4a,0x3a,0xac,0x08,0x60,0x37,0x99,0x3a,0x64,0x16,0xb6,
+0x2b,0x41,0x17,0xb7,0x0b,0x60,0x38,0x88,0x17,0x80,0x57,0x76,0x81,0x56,0x21,0x20,
+0x40,0x04,0x00,0x00,0x09,0x00,0x4a,0xbb,0x09,0x00,0x46,0xa8,0x09,0x86,0x17,0xb6,
+0x09,0x00,0x27,0xb6,0xa9,0x95,0x38,0x88,0x80,0x26,0x48,0x65,0xa8,0x96,0x41,0x00,
+0x80,0x26,0x00,0x02,0x30,0x00,0x27,0x7a,0xa7,0x95,0x1b,0x96,0x79,0xa0,0x2a,0x93,
+0x6b,0xa7,0x23,0x20,0x01,0x33,0x04,0x96,0x67,0x70,0x07,0x87,0x78,0x70,0x18,0x7d,
+0x00,0x00,0x01,0x00,0xf5,0x0d,0x05,0x10,0x00,0x58,0xb8,0x9c,0x81,0x00,0x74,0x92,
+0x00,0x02,0x6d,0xb5,0x10,0x7a,0x70,0x19,0xa3,0x01,0x80,0x09,0x00,0x04,0x50,0x09,
+0x00,0x0a,0x75,0x05,0xf0,0x01,0x26,0xbe,0x00,0x8d,0xff,0xff,0x00,0xff,0xe9,0x5f,
+0x00,0xf3,0x00,0x0f,0x00,0xf0,0x04,0x00,0xf0,0x07,0x0a,0xff,0xaf,0xf0,0x0a,0xfa,
+0xaf,0xa0,0x00,0x00,0xbd,0xcc,0xce,0xab,0x8b,0x00,0x07,0x58,0xcd,0x66,0x6a,0xac,
+0x04,0x00,0x00,0x0c,0x00,0x00,0x14,0x00,0xf0,0x01,0x34,0x14,0x44,0x43,0xff,0x7f,
+0xff,0xff,0xab,0x4b,0xbb,0xba,0xbc,0x5c,0xcc,0xcb,0x0c,0x00,0x44,0x67,0x17,0x88,
+0x86,0x14,0x00,0xf0,0x4b,0x00,0x00,0x00,0x9a,0x00,0x00,0x09,0xfa,0xa9,0x00,0x9f,
+0xa0,0xaf,0x99,0xfa,0x00,0x0a,0xff,0xa0,0x00,0x00,0x99,0x00,0x00,0x63,0x00,0x72,
+0xcf,0x4a,0xf4,0x1d,0xff,0x60,0x0a,0xff,0x30,0xaf,0x7d,0xf3,0xa6,0x01,0xb3,0x00,
+0x0c,0x51,0x00,0x1d,0x7d,0x6e,0x70,0x8d,0x0d,0x65,0xf1,0xc7,0x0d,0x60,0xe6,0xd7,
+0x06,0x20,0xe6,0x9d,0x00,0x04,0xf2,0x1e,0xc7,0x8f,0x80,0x01,0x9d,0xc6,0x00,0x00,
+0x0c,0xc0,0x00,0x18,0x8f,0xf8,0x81,0x8f,0xfe,0xef,0xf8,0x2f,0xe0,0x0e,0xf2,0x04,
+0x00,0x00,0x0c,0x00,0x00,0x14,0x00,0x20,0x00,0x0c,0x82,0x06,0xf4,0x17,0x30,0x22,
+0x00,0x00,0xaf,0xaa,0xa0,0x01,0xda,0x6a,0xfa,0x03,0xe8,0xbf,0xb8,0xe3,0xb6,0xdf,
+0xff,0xd6,0xb0,0x8f,0xfb,0xff,0x80,0x08,0xfc,0x0c,0xf8,0x00,0x5b,0x80,0x8b,0x50,
+0x00,0x0f,0xf0,0x00,0x04,0x00,0xf0,0x17,0x07,0xff,0xff,0x70,0x00,0x9f,0xf9,0x00,
+0x78,0x7a,0xa7,0x87,0xff,0xfb,0xbf,0xff,0xff,0xff,0xfb,0xbf,0x05,0xff,0xff,0xf5,
+0x01,0xe3,0x00,0x03,0xe1,0xa8,0x00,0x00,0x08,0xaf,0xff,0x50,0x6f,0xff,0x01,0x00,
+0x10,0xfd,0x04,0x00,0x00,0x67,0x07,0xf0,0x12,0x02,0xbf,0xfb,0x3f,0x2e,0x92,0x18,
+0xff,0x9a,0x00,0x6c,0xff,0x31,0x00,0x24,0x44,0x44,0x42,0x00,0x13,0xff,0xc6,0x00,
+0xb9,0xfe,0xa5,0x5b,0xd1,0xf2,0x8c,0xc8,0x10,0x30,0x48,0x01,0x30,0x09,0x34,0xcf,
+0x35,0x00,0xf0,0x0b,0xab,0xff,0x00,0x4f,0x00,0x01,0x00,0x09,0x00,0x34,0xcf,0x01,
+0xff,0xff,0x1b,0xff,0xff,0x1b,0xbb,0xff,0x01,0x00,0x4f,0x00,0x00,0x01,0x25,0x00,
+0xf2,0x20,0x54,0x00,0x00,0x90,0x23,0xb3,0x34,0xcf,0x02,0xc3,0xbf,0xff,0xf1,0xb5,
 0x6c,0xff,0xff,0x1b,0x56,0xca,0xbf,0xf0,0x2c,0x3a,0x00,0x4f,0x02,0x3b,0x30,0x00,
 0x10,0x05,0x40,0xdf,0xff,0xff,0xfd,0xf0,0x7f,0xff,0xff,0xf8,0xcf,0xb1,0xbf,0xfb,
 0x5b,0xb4,0x00,0x10,0xdf,0x87,0x00,0xf1,0x10,0xb4,0x00,0x03,0xfb,0x00,0x0b,0xff,
 0x40,0x6f,0xff,0xd0,0xdf,0xff,0xf5,0xf8,0xff,0xf7,0xaa,0x8f,0xf2,0x1a,0xfd,0x40,
-0x40,0x00,0x2f,0x20,0x8f,0xf2,0x9f,0xff,0x7c,0x00,0x70,0x5e,0xff,0xf2,0x2d,0xfb,
-0x10,0x19,0xa0,0x3b,0xf1,0x0b,0xa1,0x00,0x00,0xff,0xf7,0x00,0x0f,0xff,0xfd,0x40,
-0xff,0xff,0xff,0xaf,0xff,0xff,0xfa,0xff,0xff,0xd4,0x0f,0xff,0x70,0x00,0xda,0x10,
-0xf5,0x01,0xb9,0x9b,0x90,0x9b,0x9f,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0x07,0x00,
-0xae,0xf2,0x42,0x02,0x42,0x24,0x44,0x44,0x2f,0xff,0xff,0x01,0x00,0xc1,0xf8,0xbb,
-0xbb,0xb8,0x20,0x00,0x4f,0x80,0x2f,0xff,0x92,0xff,0x70,0x00,0x72,0xfe,0x5f,0xfd,
-0x22,0xf9,0x10,0x1b,0xf9,0x14,0xf0,0x01,0x8f,0x80,0x00,0x00,0x7f,0xff,0x70,0x00,
-0x5f,0xff,0xff,0x50,0x0e,0xff,0xff,0xfe,0xb2,0x53,0xf1,0x07,0x50,0x0f,0xff,0xff,
-0xff,0x00,0xab,0xbb,0xbb,0xa0,0x00,0x06,0x20,0x07,0xf4,0x07,0xf5,0x05,0xf5,0x00,
-0x2e,0xb0,0x03,0x00,0xf1,0x07,0x60,0x00,0x10,0x26,0x00,0x04,0xf6,0x00,0x05,0xf6,
-0x00,0x06,0xf5,0x00,0xbe,0x20,0xbe,0x10,0x6e,0x10,0x00,0x10,0x75,0x38,0xf0,0x01,
-0x03,0xf3,0x00,0x00,0x4f,0x40,0x07,0x8a,0xfa,0x87,0xef,0xff,0xff,0xe0,0x04,0xf4,
-0x0e,0x00,0x30,0x00,0x01,0xb1,0xe5,0x44,0x10,0x7e,0x59,0x00,0xf1,0x0c,0x8c,0xcc,
-0x80,0x01,0xdd,0x16,0x3d,0xd1,0xcf,0x55,0xed,0x5f,0xcb,0xf5,0xdf,0xd5,0xfc,0x1d,
-0xd3,0x73,0xdd,0x10,0x08,0xdc,0xc8,0x10,0x1d,0x89,0x01,0xf1,0x12,0x5e,0x8c,0xcc,
-0xa2,0x00,0x00,0x2d,0xb4,0x49,0xf4,0x00,0x7a,0x1a,0xff,0x3f,0xe1,0x07,0xfa,0x06,
-0xf7,0xff,0x10,0x0a,0xf3,0x03,0xef,0x40,0x00,0x06,0xcc,0x71,0xbb,0x10,0xb1,0x08,
-0x40,0x00,0x00,0x3e,0x30,0x65,0x09,0x10,0xfc,0xc5,0x06,0xf0,0x10,0xfc,0xf6,0x00,
-0x00,0x00,0xed,0x0d,0xe0,0x00,0x00,0x8f,0xe0,0xef,0x80,0x00,0x2f,0xff,0x6f,0xff,
-0x20,0x0b,0xff,0xe2,0xef,0xfa,0x00,0xdf,0xff,0xff,0xff,0xd0,0xa4,0x05,0xf0,0x05,
-0x44,0x00,0x04,0xf5,0xef,0xb1,0xcf,0xfd,0x01,0x8c,0xd1,0xc1,0x01,0xdc,0x81,0xc1,
-0xef,0xc1,0xbf,0xfd,0x14,0x00,0x03,0xf8,0x15,0xf2,0x00,0x00,0x04,0xe4,0x00,0x04,
-0xfc,0xf4,0x04,0xf8,0x08,0xf4,0xb8,0x00,0x08,0xb0,0x5b,0x03,0xd2,0x0b,0x80,0x00,
-0x8b,0x4f,0x80,0x8f,0x40,0x4f,0xcf,0x40,0x00,0x4e,0x97,0x53,0xf2,0x11,0x94,0x14,
-0x44,0x40,0x00,0xbf,0xf8,0xbb,0xbf,0x10,0x08,0xb7,0x60,0x00,0xe1,0x00,0x0b,0x40,
-0x00,0x1e,0x20,0x00,0xb7,0x44,0x5e,0xfd,0x50,0x07,0xbb,0xb8,0x5f,0x80,0x10,0x06,
-0x43,0xdf,0xfb,0x00,0x00,0x81,0x02,0x05,0x01,0x00,0x01,0x06,0x02,0x00,0xa0,0x4d,
-0x22,0x9f,0xf9,0xc4,0x02,0x03,0xd0,0x02,0x71,0x78,0x4f,0xf4,0x87,0xff,0xe8,0x8e,
-0xc8,0x02,0x04,0x9e,0x18,0x63,0xea,0x00,0x00,0x00,0xef,0xe0,0xde,0x00,0xf1,0x04,
-0x4f,0x70,0x00,0x00,0x1d,0xe0,0x07,0xdc,0x4d,0xf3,0x00,0xef,0xff,0xe3,0x00,0x0a,
-0xec,0x70,0x00,0xaf,0x15,0xf3,0x1b,0xcd,0xc0,0x2d,0xc0,0xe7,0xf2,0xee,0x20,0x4b,
-0xff,0xe2,0x00,0x04,0xff,0xa0,0x00,0xcd,0xf9,0xf9,0x00,0xe7,0xe0,0x7f,0x90,0x4a,
-0x40,0x04,0x50,0x00,0xff,0xf7,0x47,0x4f,0xff,0x47,0xf8,0xff,0xff,0xff,0x8f,0xff,
-0xff,0x07,0x00,0xf0,0x10,0xfb,0x78,0x88,0x7f,0xff,0xff,0x00,0x24,0x44,0x41,0x0f,
-0xbb,0xbb,0xe2,0xf0,0x00,0x0f,0xdf,0x44,0x44,0xff,0xff,0xfc,0xff,0xff,0xf9,0x09,
-0xff,0xff,0xd5,0xdf,0x20,0x02,0x30,0x01,0x11,0x11,0xf4,0x01,0xf0,0x06,0x01,0x11,
-0x11,0x05,0x55,0x55,0x55,0xcc,0xcc,0xcc,0xc0,0x11,0x11,0x10,0xff,0xff,0xff,0xf0,
-0x11,0x11,0x10,0xc1,0x00,0xf1,0x00,0x9f,0xff,0xff,0xf9,0xb7,0xff,0xff,0x7b,0xfe,
-0x7c,0xc7,0xef,0xff,0xfa,0xaf,0xd5,0x00,0xf1,0x3b,0x07,0xff,0x60,0x00,0xaf,0xf2,
-0x00,0x0c,0xff,0x87,0x00,0xef,0xff,0xb0,0x07,0x8e,0xf2,0x00,0x00,0xf8,0x00,0x00,
-0x3e,0x00,0x00,0x06,0x50,0x00,0x79,0xb9,0x70,0x0f,0xfc,0xff,0x00,0xff,0x68,0x83,
-0x0f,0xf8,0xff,0x8b,0xff,0x8f,0xf8,0x8f,0xf8,0xff,0xff,0x78,0x8f,0xff,0xf0,0x07,
-0xff,0xff,0x00,0x0d,0x00,0x00,0x4e,0xfe,0x30,0x0d,0xff,0xfd,0x00,0xff,0xff,0xf0,
-0x3f,0xff,0xff,0x3b,0xa3,0x00,0x41,0x88,0x60,0x04,0xf4,0xb7,0x01,0xf4,0x03,0xdf,
-0x18,0x81,0x88,0x1f,0xfe,0xaa,0xca,0xae,0xff,0xea,0xac,0xaa,0xef,0xf1,0x80,0x00,
-0x81,0xd1,0x03,0x02,0x41,0x0e,0xf0,0x06,0xc0,0x00,0x00,0x5c,0xff,0xb0,0x00,0x6e,
-0xff,0xff,0x40,0x0d,0xff,0xff,0xfc,0x00,0x06,0x88,0xcf,0xf5,0x00,0x02,0x02,0x00,
-0x05,0x00,0x10,0x60,0xb5,0x09,0x03,0x2a,0x00,0x9b,0xff,0xf8,0xb0,0xff,0xf8,0xfb,
-0xff,0xfc,0x88,0x11,0x03,0xf1,0x0c,0x00,0x04,0x77,0x40,0x00,0x09,0xff,0xcc,0xff,
-0x90,0xcd,0x40,0x00,0x04,0xdc,0x20,0x4b,0xff,0xb4,0x02,0x01,0xfa,0x55,0xaf,0x10,
-0x00,0x00,0x79,0x07,0x10,0xee,0x05,0x00,0x20,0x87,0x00,0x31,0x04,0xc0,0x44,0x40,
-0xfb,0xbb,0xbb,0xbb,0xda,0xf7,0xee,0xee,0xee,0x5f,0x4e,0x01,0xb9,0x2f,0xf5,0x66,
-0x66,0x66,0xab,0x8b,0xbb,0xbb,0xbb,0xb3,0x1e,0x00,0x10,0x70,0x1e,0x00,0x10,0x80,
-0x1e,0x00,0x1e,0x54,0x1e,0x00,0xcd,0xe0,0x00,0x5f,0xf8,0xff,0xf0,0x00,0x2f,0xf5,
-0x66,0x64,0x44,0x1e,0x00,0xcc,0xe7,0x00,0x00,0x5f,0xf8,0xf8,0x00,0x00,0x2f,0xf5,
-0x65,0x44,0x1e,0x00,0x60,0xd8,0xf0,0x00,0x00,0x00,0x5f,0x05,0x00,0x61,0x2f,0xf4,
-0x44,0x44,0x44,0xad,0x1e,0x00,0x04,0x2c,0x02,0x10,0xd8,0x05,0x00,0xf1,0x02,0x36,
-0x40,0x00,0x09,0xb1,0x91,0x11,0x17,0x20,0xef,0x88,0xd8,0x88,0xd9,0x02,0x20,0x06,
-0x8e,0x26,0x24,0x06,0xec,0x80,0x1d,0xf3,0x1d,0xdd,0xc3,0x04,0xff,0x3e,0xd0,0x9c,
-0xb5,0x5f,0x2b,0xf7,0x1a,0xf4,0xbf,0x81,0xbf,0x39,0xc9,0x64,0xf2,0x4f,0xf3,0xde,
-0x00,0x6d,0xed,0x30,0x78,0xdf,0xd8,0x77,0x88,0x88,0x87,0x8f,0xff,0xff,0x88,0xcc,
-0x8c,0xc8,0x8c,0xc8,0xcc,0x07,0x00,0x40,0x85,0xff,0xff,0xf5,0x67,0x20,0xe1,0x30,
-0x00,0x00,0x4b,0xfd,0x00,0x00,0x7f,0x9b,0x70,0x00,0x7f,0xff,0x40,0x24,0x04,0x00,
-0x04,0x00,0x74,0x0e,0xff,0x70,0x00,0x00,0xee,0x70,0x8e,0x01,0xd2,0xaf,0xff,0xff,
-0xfc,0x0b,0xff,0x9c,0xc9,0xff,0xaf,0xff,0xc1,0x1c,0x05,0x00,0x01,0x0f,0x00,0x01,
-0x19,0x00,0xf3,0x02,0x07,0xff,0xfe,0x17,0xb6,0x27,0xc3,0xfe,0xb9,0xbe,0x3f,0xff,
-0xff,0xf3,0xff,0xff,0xff,0x07,0x00,0x41,0x3c,0xff,0xff,0xe1,0x07,0x0d,0xc0,0x23,
-0x00,0x02,0xf0,0x2e,0x92,0x22,0x5f,0x0d,0xff,0xff,0xff,0x09,0x00,0x3c,0x21,0x00,
-0x23,0x69,0x58,0x2f,0xfe,0x00,0x01,0x00,0x03,0x1b,0xf9,0x08,0x00,0x00,0x01,0x00,
-0x73,0xfd,0xfc,0x00,0xff,0xfc,0x00,0xfb,0x06,0x13,0x0c,0x01,0x00,0x2f,0x01,0x01,
-0x17,0x00,0x01,0x2f,0xf5,0x00,0x01,0x00,0x15,0x1e,0xf2,0x1e,0x00,0x0e,0x90,0x00,
-0xb3,0xfc,0x00,0xff,0x00,0x00,0xf8,0xff,0xfb,0xfc,0x00,0xfa,0x85,0x02,0x00,0x12,
-0x04,0x2d,0xfd,0xfe,0x7b,0x00,0x10,0xfe,0x1a,0x00,0x05,0xd5,0x02,0x0e,0xf2,0x00,
-0x07,0x0a,0x00,0x19,0xff,0x1f,0x00,0x03,0x0e,0x00,0x13,0xfa,0x0b,0x00,0x00,0x48,
-0x00,0x3f,0xff,0xfd,0xff,0x9c,0x00,0x0a,0x05,0x7c,0x00,0x00,0x30,0x08,0x00,0x07,
-0x00,0x16,0xfe,0x30,0x00,0x11,0xf1,0x04,0x01,0x15,0xf0,0x24,0x00,0x20,0xfe,0xff,
-0x20,0x00,0x01,0x2b,0x00,0x0d,0x44,0x00,0x10,0xfe,0x08,0x00,0x0e,0x91,0x01,0x0c,
-0x9b,0x00,0x0f,0x01,0x00,0x07,0x1b,0xfc,0xd1,0x01,0x10,0xfe,0x6b,0x00,0x00,0x70,
-0x00,0x11,0xfc,0x0f,0x00,0x14,0xeb,0x6c,0x00,0x97,0xfc,0x00,0x00,0xef,0xfd,0xf5,
-0xf7,0x00,0xf1,0xdc,0x01,0x25,0xf8,0xfa,0x0c,0x00,0x00,0xdf,0x02,0x33,0xf7,0x00,
-0xf4,0x43,0x00,0x10,0xfe,0xac,0x00,0x00,0x7c,0x00,0x0f,0xe0,0x01,0x02,0x10,0xfd,
-0xd2,0x00,0x1f,0xfe,0x97,0x00,0x0b,0x1e,0xfb,0x8c,0x01,0x05,0x7f,0x01,0x93,0xf2,
-0xf2,0x00,0x00,0xfb,0xfe,0xf1,0xff,0x01,0x40,0x02,0xd3,0xf9,0xfa,0x00,0xf9,0xfa,
-0xfb,0xf9,0x00,0xfa,0xfc,0xfc,0xfb,0xfc,0x1a,0x01,0x66,0xf2,0xfe,0x00,0x00,0xfb,
-0xff,0x2b,0x01,0x62,0xfd,0xfd,0x00,0x00,0xfd,0xfe,0x4c,0x01,0x22,0x00,0x01,0x24,
-0x00,0x22,0xf8,0xfc,0x63,0x00,0x13,0x01,0x24,0x00,0x23,0xfe,0xfe,0x6c,0x01,0x08,
-0xa1,0x01,0x14,0xfd,0x76,0x00,0x15,0x01,0x82,0x00,0x02,0xb0,0x01,0x04,0x92,0x00,
-0xe0,0x01,0xfd,0xf3,0xfd,0x00,0x00,0xfa,0xfe,0xfa,0xff,0x01,0xfa,0x01,0x01,0x92,
-0x00,0x70,0xfb,0xfc,0xff,0xfe,0xfc,0xfe,0xfc,0xd3,0x01,0x36,0xff,0xfe,0x01,0xc5,
-0x00,0x09,0xa8,0x01,0x14,0xff,0x48,0x00,0x1e,0xfe,0xb2,0x01,0x1f,0xff,0xab,0x01,
-0x07,0x0f,0xe9,0x01,0x0d,0x1f,0xfe,0x24,0x00,0x0b,0x2e,0xff,0xff,0x14,0x02,0x0f,
-0x38,0x02,0x1f,0x14,0xff,0x80,0x02,0x1e,0x01,0xd7,0x02,0x1a,0xff,0xa1,0x02,0x2f,
-0xfa,0x00,0x01,0x00,0x24,0x0b,0x81,0x00,0x1f,0xf8,0xd8,0x00,0x10,0x1d,0x01,0x28,
-0x00,0x00,0xd0,0x01,0x01,0x93,0x00,0x10,0x03,0x2b,0x02,0x0f,0x6f,0x00,0x15,0x1b,
-0x01,0xc4,0x04,0x02,0xa7,0x03,0x1d,0x01,0x14,0x01,0x1f,0xf8,0xd8,0x00,0x24,0x1f,
-0xff,0x24,0x00,0x26,0x0f,0x3d,0x00,0x07,0x12,0x01,0x49,0x84,0x21,0x02,0x03,0x10,
-0x15,0x2c,0x04,0x05,0x21,0x00,0x00,0xe8,0x6a,0xf2,0x08,0x09,0x0a,0x0b,0x00,0x0c,
-0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,
-0x17,0x18,0x0b,0x2e,0x80,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x34,0x09,0xe1,
-0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0xaa,0x2f,
-0x0f,0x01,0x00,0xff,0xff,0xc2,0x02,0x33,0x03,0x20,0x03,0x02,0x2e,0x03,0x4b,0x06,
-0x07,0x06,0x08,0x1f,0x00,0x00,0xd9,0x0f,0x10,0x0b,0x7a,0x0c,0x10,0x00,0x0f,0x66,
-0x00,0x08,0x00,0xa0,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0xa7,0x50,
-0x00,0x04,0x1b,0x52,0x17,0x17,0x17,0x18,0x17,0x07,0x11,0xee,0x19,0x1a,0x19,0x17,
-0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x35,0x09,0x13,0x00,0x2d,0x36,
-0x0f,0x01,0x00,0xff,0xff,0xa6,0x50,0x00,0x00,0x00,0x00,0x00,
+0x40,0x00,0x2f,0x20,0x8f,0xf2,0x9f,0xff,0x7c,0x00,0xf1,0x16,0x5e,0xff,0xf2,0x2d,
+0xfb,0x10,0x19,0x00,0x00,0x00,0x0d,0xa1,0x00,0x00,0xff,0xf7,0x00,0x0f,0xff,0xfd,
+0x40,0xff,0xff,0xff,0xaf,0xff,0xff,0xfa,0xff,0xff,0xd4,0x0f,0xff,0x70,0x00,0xda,
+0x10,0xf5,0x01,0xb9,0x9b,0x90,0x9b,0x9f,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0x07,
+0x00,0xae,0xf2,0x42,0x02,0x42,0x24,0x44,0x44,0x2f,0xff,0xff,0x01,0x00,0xc1,0xf8,
+0xbb,0xbb,0xb8,0x20,0x00,0x4f,0x80,0x2f,0xff,0x92,0xff,0x70,0x00,0x71,0xfe,0x5f,
+0xfd,0x22,0xf9,0x10,0x1b,0xc1,0x04,0xf1,0x1c,0x00,0x8f,0x80,0x00,0x00,0x7f,0xff,
+0x70,0x00,0x5f,0xff,0xff,0x50,0x0e,0xff,0xff,0xfe,0x00,0x58,0x88,0x88,0x50,0x0f,
+0xff,0xff,0xff,0x00,0xab,0xbb,0xbb,0xa0,0x00,0x06,0x20,0x07,0xf4,0x07,0xf5,0x05,
+0xf5,0x00,0x2e,0xb0,0x03,0x00,0xf0,0x07,0x60,0x00,0x10,0x26,0x00,0x04,0xf6,0x00,
+0x05,0xf6,0x00,0x06,0xf5,0x00,0xbe,0x20,0xbe,0x10,0x6e,0x10,0x00,0x10,0x17,0x0b,
+0xf0,0x02,0x00,0x03,0xf3,0x00,0x00,0x4f,0x40,0x07,0x8a,0xfa,0x87,0xef,0xff,0xff,
+0xe0,0x04,0xf4,0x0e,0x00,0x80,0x00,0x01,0xb1,0x00,0x78,0x88,0x88,0x7e,0x59,0x00,
+0xf1,0x0c,0x8c,0xcc,0x80,0x01,0xdd,0x16,0x3d,0xd1,0xcf,0x55,0xed,0x5f,0xcb,0xf5,
+0xdf,0xd5,0xfc,0x1d,0xd3,0x73,0xdd,0x10,0x08,0xdc,0xc8,0x10,0x1d,0x89,0x01,0xf1,
+0x12,0x5e,0x8c,0xcc,0xa2,0x00,0x00,0x2d,0xb4,0x49,0xf4,0x00,0x7a,0x1a,0xff,0x3f,
+0xe1,0x07,0xfa,0x06,0xf7,0xff,0x10,0x0a,0xf3,0x03,0xef,0x40,0x00,0x06,0xcc,0x71,
+0xbb,0x10,0xb1,0x08,0x40,0x00,0x00,0x3e,0x30,0x65,0x09,0x10,0xfc,0xc5,0x06,0xf0,
+0x10,0xfc,0xf6,0x00,0x00,0x00,0xed,0x0d,0xe0,0x00,0x00,0x8f,0xe0,0xef,0x80,0x00,
+0x2f,0xff,0x6f,0xff,0x20,0x0b,0xff,0xe2,0xef,0xfa,0x00,0xdf,0xff,0xff,0xff,0xd0,
+0xa4,0x05,0xf0,0x05,0x44,0x00,0x04,0xf5,0xef,0xb1,0xcf,0xfd,0x01,0x8c,0xd1,0xc1,
+0x01,0xdc,0x81,0xc1,0xef,0xc1,0xbf,0xfd,0x14,0x00,0x01,0xc0,0x05,0x00,0x17,0x0b,
+0xd2,0xe4,0x00,0x04,0xfc,0xf4,0x04,0xf8,0x08,0xf4,0xb8,0x00,0x08,0xb0,0x5b,0x03,
+0xe1,0x0b,0x80,0x00,0x8b,0x4f,0x80,0x8f,0x40,0x4f,0xcf,0x40,0x00,0x4e,0x40,0x13,
+0x00,0xf2,0x11,0x94,0x14,0x44,0x40,0x00,0xbf,0xf8,0xbb,0xbf,0x10,0x08,0xb7,0x60,
+0x00,0xe1,0x00,0x0b,0x40,0x00,0x1e,0x20,0x00,0xb7,0x44,0x5e,0xfd,0x50,0x07,0xbb,
+0xb8,0x5f,0x80,0x10,0x06,0x43,0xdf,0xfb,0x00,0x00,0x81,0x02,0x05,0x01,0x00,0x01,
+0x06,0x02,0x30,0x09,0x90,0x00,0xbc,0x02,0x01,0xc4,0x02,0x03,0xd0,0x02,0x71,0x78,
+0x4f,0xf4,0x87,0xff,0xe8,0x8e,0xc8,0x02,0x03,0xd3,0x03,0x73,0x07,0xea,0x00,0x00,
+0x00,0xef,0xe0,0xde,0x00,0xf0,0x05,0x4f,0x70,0x00,0x00,0x1d,0xe0,0x07,0xdc,0x4d,
+0xf3,0x00,0xef,0xff,0xe3,0x00,0x0a,0xec,0x70,0x00,0x00,0x99,0x06,0xf3,0x1b,0xcd,
+0xc0,0x2d,0xc0,0xe7,0xf2,0xee,0x20,0x4b,0xff,0xe2,0x00,0x04,0xff,0xa0,0x00,0xcd,
+0xf9,0xf9,0x00,0xe7,0xe0,0x7f,0x90,0x4a,0x40,0x04,0x50,0x00,0xff,0xf7,0x47,0x4f,
+0xff,0x47,0xf8,0xff,0xff,0xff,0x8f,0xff,0xff,0x07,0x00,0xf0,0x10,0xfb,0x78,0x88,
+0x7f,0xff,0xff,0x00,0x24,0x44,0x41,0x0f,0xbb,0xbb,0xe2,0xf0,0x00,0x0f,0xdf,0x44,
+0x44,0xff,0xff,0xfc,0xff,0xff,0xf9,0x09,0xff,0xff,0xd5,0xdf,0x20,0x02,0x30,0x01,
+0x11,0x11,0xf4,0x01,0xf0,0x06,0x01,0x11,0x11,0x05,0x55,0x55,0x55,0xcc,0xcc,0xcc,
+0xc0,0x11,0x11,0x10,0xff,0xff,0xff,0xf0,0x11,0x11,0x10,0xc1,0x00,0xf1,0x00,0x9f,
+0xff,0xff,0xf9,0xb7,0xff,0xff,0x7b,0xfe,0x7c,0xc7,0xef,0xff,0xfa,0xaf,0xd5,0x00,
+0xf1,0x3b,0x07,0xff,0x60,0x00,0xaf,0xf2,0x00,0x0c,0xff,0x87,0x00,0xef,0xff,0xb0,
+0x07,0x8e,0xf2,0x00,0x00,0xf8,0x00,0x00,0x3e,0x00,0x00,0x06,0x50,0x00,0x79,0xb9,
+0x70,0x0f,0xfc,0xff,0x00,0xff,0x68,0x83,0x0f,0xf8,0xff,0x8b,0xff,0x8f,0xf8,0x8f,
+0xf8,0xff,0xff,0x78,0x8f,0xff,0xf0,0x07,0xff,0xff,0x00,0x0d,0x00,0x00,0x4e,0xfe,
+0x30,0x0d,0xff,0xfd,0x00,0xff,0xff,0xf0,0x3f,0xff,0xff,0x3b,0xa3,0x00,0x41,0x88,
+0x60,0x04,0xf4,0xb7,0x01,0xf4,0x03,0xdf,0x18,0x81,0x88,0x1f,0xfe,0xaa,0xca,0xae,
+0xff,0xea,0xac,0xaa,0xef,0xf1,0x80,0x00,0x81,0xd1,0x03,0x01,0x01,0x00,0xf0,0x07,
+0x4b,0xc0,0x00,0x00,0x5c,0xff,0xb0,0x00,0x6e,0xff,0xff,0x40,0x0d,0xff,0xff,0xfc,
+0x00,0x06,0x88,0xcf,0xf5,0x00,0x02,0x02,0x00,0x05,0x00,0x10,0x60,0xb5,0x09,0x03,
+0x2a,0x00,0x9b,0xff,0xf8,0xb0,0xff,0xf8,0xfb,0xff,0xfc,0x88,0x11,0x03,0xf1,0x0c,
+0x00,0x04,0x77,0x40,0x00,0x09,0xff,0xcc,0xff,0x90,0xcd,0x40,0x00,0x04,0xdc,0x20,
+0x4b,0xff,0xb4,0x02,0x01,0xfa,0x55,0xaf,0x10,0x00,0x00,0x79,0x07,0x10,0xee,0x05,
+0x00,0x20,0x87,0x00,0x31,0x04,0xc0,0x44,0x40,0xfb,0xbb,0xbb,0xbb,0xda,0xf7,0xee,
+0xee,0xee,0x5f,0x4e,0x01,0xb9,0x2f,0xf5,0x66,0x66,0x66,0xab,0x8b,0xbb,0xbb,0xbb,
+0xb3,0x1e,0x00,0x10,0x70,0x1e,0x00,0x10,0x80,0x1e,0x00,0x1e,0x54,0x1e,0x00,0xcd,
+0xe0,0x00,0x5f,0xf8,0xff,0xf0,0x00,0x2f,0xf5,0x66,0x64,0x44,0x1e,0x00,0xcc,0xe7,
+0x00,0x00,0x5f,0xf8,0xf8,0x00,0x00,0x2f,0xf5,0x65,0x44,0x1e,0x00,0x60,0xd8,0xf0,
+0x00,0x00,0x00,0x5f,0x05,0x00,0x61,0x2f,0xf4,0x44,0x44,0x44,0xad,0x1e,0x00,0x04,
+0x2c,0x02,0x10,0xd8,0x05,0x00,0xf0,0x04,0x36,0x40,0x00,0x09,0xb1,0x91,0x11,0x17,
+0x20,0xef,0x88,0xd8,0x88,0xd9,0x02,0x20,0x06,0x48,0x70,0x18,0x03,0x13,0xec,0x25,
+0x00,0xf3,0x1e,0x06,0xdd,0xc3,0x04,0xff,0x3e,0xd0,0x9c,0xb5,0x5f,0x2b,0xf7,0x1a,
+0xf4,0xbf,0x81,0xbf,0x39,0xc9,0x64,0xf2,0x4f,0xf3,0xde,0x00,0x6d,0xed,0x30,0x78,
+0xdf,0xd8,0x77,0x88,0x88,0x87,0x8f,0xff,0xff,0x88,0xcc,0x8c,0xc8,0x8c,0xc8,0xcc,
+0x07,0x00,0x30,0x85,0xff,0xff,0x4f,0x01,0xf1,0x00,0x7d,0x30,0x00,0x00,0x4b,0xfd,
+0x00,0x00,0x7f,0x9b,0x70,0x00,0x7f,0xff,0x40,0x24,0x04,0x00,0x04,0x00,0x74,0x0e,
+0xff,0x70,0x00,0x00,0xee,0x70,0x8e,0x01,0xd2,0xaf,0xff,0xff,0xfc,0x0b,0xff,0x9c,
+0xc9,0xff,0xaf,0xff,0xc1,0x1c,0x05,0x00,0x01,0x0f,0x00,0x01,0x19,0x00,0xf3,0x02,
+0x07,0xff,0xfe,0x17,0xb6,0x27,0xc3,0xfe,0xb9,0xbe,0x3f,0xff,0xff,0xf3,0xff,0xff,
+0xff,0x07,0x00,0x41,0x3c,0xff,0xff,0xe1,0x07,0x0d,0x90,0x23,0x00,0x02,0xf0,0x2e,
+0x92,0x22,0x5f,0x0d,0x6b,0x02,0x90,0x2e,0x92,0x22,0x21,0x00,0x23,0x00,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -1810,11 +1835,20 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 176, .range_length = 63475, .glyph_id_start = 115, .list_length = 704, .type = 3, .unicode_list = 6552, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[35775] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 5936, .size = 4062, .comp_size = 3872 },
+{ .bitmap_start = 4062, .comp_offset = 9808, .size = 4082, .comp_size = 3845 },
+{ .bitmap_start = 8144, .comp_offset = 13653, .size = 4095, .comp_size = 3901 },
+{ .bitmap_start = 12239, .comp_offset = 17554, .size = 4076, .comp_size = 3962 },
+{ .bitmap_start = 16315, .comp_offset = 21516, .size = 4091, .comp_size = 3907 },
+{ .bitmap_start = 20406, .comp_offset = 25423, .size = 4067, .comp_size = 3761 },
+};
+
+static uint8_t etxUncompBuf[11302] __SDRAMFONTS;
 
 const etxLz4Font lv_font_tw_XXS = {
-.uncomp_size = 35511,
-.comp_size = 28780,
+.uncomp_size = 11038,
+.comp_size = 5936,
 .line_height = 10,
 .base_line = 2,
 .subpx = 0,
@@ -1827,12 +1861,13 @@ const etxLz4Font lv_font_tw_XXS = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 36,
-.glyph_bitmap = 7960,
-.class_pair_values = 32433,
-.left_class_mapping = 33873,
-.right_class_mapping = 34692,
+.class_pair_values = 7960,
+.left_class_mapping = 9400,
+.right_class_mapping = 10219,
+.block_num = 6,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 35775,
+.lvglFontBufSize = 11302,
 };
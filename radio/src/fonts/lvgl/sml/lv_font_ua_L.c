@@ -80,630 +80,662 @@ static const uint8_t lz4FontData[] ={
 0x2d,0x40,0x05,0x07,0x0d,0xff,0x00,0x00,0x00,0x54,0x03,0x56,0x03,0x57,0x03,0x00,
 0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f,
 0x10,0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,0x1a,0x1b,0x1c,0x00,0x00,0x1d,
-0x00,0x1e,0x1f,0x9e,0x05,0xf1,0x39,0x20,0x00,0x21,0x22,0x7f,0x56,0xf5,0x6f,0x46,
-0xf4,0x6f,0x46,0xf4,0x5f,0x45,0xf3,0x5f,0x32,0x71,0x00,0x04,0xd4,0x5f,0x50,0xb9,
-0x3f,0x1b,0x83,0xf0,0xb7,0x3f,0x0b,0x63,0xe0,0x52,0x16,0x00,0x00,0x00,0xe6,0x02,
-0xf3,0x00,0x00,0x2f,0x20,0x6e,0x00,0x00,0x06,0xe0,0x0a,0xb0,0x03,0xff,0xff,0xff,
-0xff,0xf7,0x04,0x4e,0x94,0x4f,0x64,0x10,0x00,0xf5,0x03,0xf1,0x00,0x00,0x3f,0x1b,
-0x00,0xf0,0x0f,0xf0,0x09,0xc0,0x00,0xef,0xff,0xff,0xff,0xfc,0x03,0x3c,0xa3,0x3f,
-0x73,0x20,0x00,0xe6,0x02,0xf2,0x00,0x00,0x2f,0x30,0x5f,0x00,0x00,0x05,0xf0,0x08,
-0xc0,0x6f,0x00,0xf0,0x43,0x61,0x00,0x00,0x00,0x2f,0x40,0x00,0x00,0x16,0xf7,0x00,
-0x00,0x4f,0xff,0xff,0x40,0x1f,0xd3,0x04,0xee,0x05,0xf5,0x00,0x06,0xf5,0x6f,0x50,
-0x00,0x3d,0x63,0xfc,0x00,0x00,0x00,0x09,0xfe,0x71,0x00,0x00,0x06,0xef,0xfa,0x10,
-0x00,0x00,0x4b,0xfe,0x10,0x00,0x00,0x08,0xf7,0xca,0x00,0x00,0x1f,0x9c,0xf1,0x00,
-0x04,0xf8,0x5f,0xc4,0x36,0xef,0x20,0x6f,0xff,0xfe,0x40,0x00,0x06,0xf3,0x00,0x00,
-0x00,0x4f,0x10,0x00,0x02,0xbf,0xe7,0x56,0x00,0xf1,0x12,0x0d,0xa2,0x4f,0x40,0x04,
-0x30,0x00,0x0f,0x40,0x0c,0x70,0x1e,0x40,0x00,0x0e,0x80,0x2f,0x50,0xaa,0x00,0x00,
-0x04,0xef,0xf9,0x05,0xe1,0x00,0x00,0x00,0x01,0x00,0x1e,0x50,0x89,0x06,0x11,0xaa,
-0x06,0x00,0xf1,0x07,0x05,0xe1,0x4c,0xea,0x10,0x00,0x00,0x1e,0x52,0xf6,0x3b,0xc0,
-0x00,0x00,0xaa,0x06,0xd0,0x03,0xf0,0x00,0x05,0xe1,0x07,0x00,0x51,0x06,0x50,0x02,
-0xf6,0x2a,0xa7,0x00,0xf3,0x64,0x5d,0xfb,0x20,0x00,0x07,0xdf,0xd5,0x00,0x00,0x00,
-0x8f,0xa6,0xcf,0x40,0x00,0x00,0xdd,0x00,0x0f,0x90,0x00,0x00,0xed,0x00,0x3f,0x60,
-0x00,0x00,0x8f,0x65,0xec,0x00,0x00,0x00,0x0c,0xff,0x90,0x00,0x00,0x00,0x4e,0xff,
-0x30,0x00,0x10,0x05,0xfb,0x2e,0xe1,0x0a,0xe0,0x0e,0xe0,0x03,0xfd,0x0d,0xc0,0x0f,
-0xb0,0x00,0x5f,0xdf,0x70,0x0e,0xe0,0x00,0x08,0xff,0x10,0x05,0xfc,0x53,0x6e,0xff,
-0x70,0x00,0x3b,0xef,0xe9,0x2b,0xf5,0x0f,0x50,0xf5,0x0f,0x40,0xf3,0x05,0x00,0x00,
-0x01,0x90,0x00,0x0d,0xb0,0x00,0xad,0x00,0x04,0xf4,0x00,0x0b,0xd0,0x00,0x1f,0x80,
-0x00,0x6f,0x40,0x00,0x9f,0x10,0x00,0xbf,0x00,0x03,0x00,0x50,0xaf,0x00,0x00,0x7f,
-0x30,0x68,0x00,0x90,0x0e,0xb0,0x00,0x07,0xf2,0x00,0x00,0xda,0x00,0x0d,0x00,0xa1,
-0x04,0xe0,0x00,0x00,0x00,0x65,0x00,0x00,0x4f,0x50,0x15,0x00,0xf2,0x1e,0xdc,0x00,
-0x00,0x6f,0x30,0x00,0x1f,0x90,0x00,0x0c,0xd0,0x00,0x09,0xf1,0x00,0x08,0xf2,0x00,
-0x07,0xf3,0x00,0x08,0xf3,0x00,0x09,0xf2,0x00,0x0b,0xf0,0x00,0x0f,0xb0,0x00,0x3f,
-0x50,0x00,0x9e,0x00,0x02,0xf5,0x00,0x1d,0xa0,0x00,0x8a,0x86,0x07,0xf0,0x14,0x09,
-0xc0,0x00,0x00,0x08,0xc0,0x00,0x69,0x38,0xc1,0x77,0x6d,0xff,0xff,0xf9,0x00,0x4f,
-0xf6,0x00,0x00,0xcb,0xbd,0x00,0x08,0xf2,0x1e,0x90,0x01,0x40,0x04,0x20,0x00,0x00,
-0x5a,0x20,0xee,0x00,0x17,0x30,0x05,0x00,0x60,0x29,0x99,0xcf,0xa9,0x99,0x4f,0xeb,
-0x01,0x0b,0x19,0x00,0x01,0x05,0x00,0xf2,0x0c,0x0d,0xd0,0xdd,0x0f,0xa7,0xf3,0x25,
-0x00,0x01,0x11,0x1a,0xff,0xfe,0x24,0x44,0x30,0x6e,0x46,0xf4,0x00,0x00,0x06,0xf1,
-0x00,0x00,0x0c,0xb0,0xe3,0x01,0xf0,0x10,0x8e,0x00,0x00,0x00,0xe8,0x00,0x00,0x05,
-0xf2,0x00,0x00,0x0b,0xc0,0x00,0x00,0x1f,0x50,0x00,0x00,0x7e,0x00,0x00,0x00,0xe9,
-0x00,0x00,0x04,0xf3,0x00,0x00,0x0a,0x13,0x00,0xf0,0x1c,0x60,0x00,0x00,0x7f,0x10,
-0x00,0x00,0x55,0x00,0x00,0x00,0x02,0xae,0xfd,0x80,0x01,0xef,0x97,0xbf,0xa0,0x7f,
-0x50,0x00,0xaf,0x2c,0xf0,0x00,0x04,0xf6,0xed,0x00,0x00,0x2f,0x8e,0xc0,0x00,0x02,
-0xf9,0xfc,0x00,0x00,0x2f,0x9e,0x09,0x00,0x00,0x12,0x00,0xff,0x11,0x8b,0xf0,0x00,
-0x05,0xf6,0x7f,0x50,0x00,0xbf,0x20,0xef,0x96,0xbf,0x90,0x01,0xae,0xfd,0x70,0x00,
-0x00,0x04,0xab,0x29,0xef,0xfc,0x6e,0x93,0xfc,0x10,0x00,0xfc,0x00,0x03,0x00,0x08,
-0xf0,0x06,0x3b,0xef,0xd7,0x00,0x04,0xfe,0x87,0xbf,0xb0,0x0d,0xe1,0x00,0x0b,0xf3,
-0x1f,0xa0,0x00,0x06,0xf5,0x00,0x00,0x3d,0x01,0xc0,0x00,0x00,0x1e,0xa0,0x00,0x00,
-0x00,0xce,0x10,0x00,0x00,0x0b,0x59,0x02,0xf1,0x04,0xbf,0x40,0x00,0x00,0x0a,0xf4,
-0x00,0x00,0x00,0xaf,0x40,0x00,0x00,0x09,0xfa,0x66,0x66,0x65,0x0e,0x06,0x01,0xf0,
-0x01,0x4b,0xef,0xd7,0x00,0x06,0xfc,0x76,0xaf,0xb0,0x0e,0xd0,0x00,0x0a,0xf2,0x01,
-0x10,0x70,0x01,0xf0,0x04,0x00,0x12,0x7f,0x90,0x00,0x06,0xff,0xf9,0x00,0x00,0x01,
-0x45,0xaf,0x80,0x00,0x00,0x00,0x0a,0xf2,0x65,0x02,0x60,0xf6,0x1e,0x90,0x00,0x05,
-0xf6,0x69,0x00,0xa0,0xf2,0x05,0xfe,0x76,0xbf,0x90,0x00,0x4b,0xff,0xd6,0x87,0x01,
-0x70,0xcf,0x60,0x00,0x00,0x00,0x6f,0xf6,0x06,0x03,0xf0,0x15,0xdf,0x60,0x00,0x00,
-0x0b,0xd6,0xf6,0x00,0x00,0x06,0xf4,0x5f,0x60,0x00,0x01,0xfa,0x05,0xf6,0x00,0x00,
-0xbe,0x10,0x5f,0x60,0x00,0x5f,0x50,0x05,0xf6,0x00,0x1e,0xc1,0x11,0x6f,0x61,0x07,
-0x77,0x00,0x70,0xf4,0x24,0x44,0x44,0x8f,0x84,0x10,0x55,0x00,0x00,0x42,0x00,0x30,
-0x5f,0x60,0x00,0x17,0x00,0x60,0x80,0x9f,0x88,0x88,0x84,0x0b,0x17,0x02,0xf0,0x02,
-0xcc,0x00,0x00,0x00,0x0e,0xdc,0xff,0xa2,0x00,0xff,0xa8,0xbf,0xe1,0x03,0x30,0x00,
-0x8f,0x99,0x02,0x10,0xfd,0x16,0x03,0xf0,0x3f,0xe5,0xb1,0x00,0x00,0xed,0x3f,0x80,
-0x00,0x5f,0x80,0xaf,0xa6,0x8f,0xe1,0x00,0x7d,0xfe,0xa1,0x00,0x00,0x05,0xbe,0xd0,
-0x00,0x0b,0xfc,0x96,0x00,0x09,0xf5,0x00,0x00,0x02,0xf7,0x01,0x00,0x00,0x7f,0x7d,
-0xff,0xc2,0x0a,0xff,0x95,0x8f,0xe0,0xbf,0x50,0x00,0x7f,0x7c,0xf0,0x00,0x01,0xfb,
-0xbf,0x00,0x00,0x0f,0xb9,0xf3,0x00,0x01,0xfa,0x3f,0xb0,0x00,0x8f,0x50,0x9f,0xb6,
-0xaf,0xc0,0x00,0x7d,0xfe,0x90,0x00,0x0a,0x02,0x64,0xfd,0x16,0x66,0x66,0x67,0xf9,
-0x36,0x01,0x10,0x0e,0x36,0x01,0x10,0x7f,0x10,0x02,0x20,0xeb,0x00,0xc7,0x00,0x00,
-0x13,0x00,0x10,0xc0,0xe0,0x00,0x20,0x50,0x00,0x33,0x03,0x03,0xb2,0x00,0x20,0x0d,
-0xe0,0xac,0x03,0x12,0x70,0xe3,0x01,0xa0,0x02,0xfe,0x86,0xaf,0xc0,0x9f,0x40,0x00,
-0x9f,0x39,0xb4,0x02,0xf1,0x03,0x2f,0xc3,0x25,0xfc,0x00,0x3f,0xff,0xfc,0x00,0x1d,
-0xe7,0x59,0xf9,0x09,0xf2,0x00,0x08,0xf4,0xf5,0x01,0x90,0xd0,0x00,0x02,0xf9,0xbf,
-0x30,0x00,0x8f,0x52,0x2d,0x00,0x00,0x36,0x00,0xf2,0x1d,0x00,0x00,0x3b,0xef,0xc4,
-0x00,0x03,0xfe,0x87,0xdf,0x40,0x0b,0xf2,0x00,0x1e,0xd0,0x0f,0xb0,0x00,0x07,0xf3,
-0x0f,0xa0,0x00,0x05,0xf5,0x0e,0xe0,0x00,0x07,0xf6,0x07,0xfb,0x32,0x8f,0xf6,0x00,
-0x8f,0xff,0xc7,0xf4,0x00,0x01,0x32,0x9a,0x00,0xf5,0x04,0xd0,0x00,0x00,0x00,0x9f,
-0x50,0x00,0x16,0x8d,0xf9,0x00,0x00,0x2f,0xea,0x40,0x00,0x8f,0x38,0xe3,0x99,0x0a,
-0x87,0x8e,0x38,0xf3,0x0b,0xd0,0x0b,0xd0,0x00,0x01,0x00,0x90,0x0b,0xf0,0x0b,0xe0,
-0x0e,0xb0,0x5f,0x40,0x15,0x0d,0x00,0xf1,0x12,0x2a,0x30,0x00,0x04,0xbf,0xf3,0x00,
-0x5c,0xfe,0x82,0x03,0xef,0xb5,0x00,0x00,0x4f,0xe6,0x10,0x00,0x00,0x29,0xff,0xa3,
-0x00,0x00,0x01,0x8e,0xfd,0x20,0x00,0x00,0x07,0xe4,0x33,0x00,0xda,0x12,0x22,0x22,
-0x22,0x09,0xff,0xff,0xff,0xf2,0x35,0x55,0x55,0x55,0x12,0x00,0x10,0x25,0x12,0x00,
-0x10,0x97,0x0c,0x02,0xd0,0xff,0x92,0x00,0x00,0x03,0x9f,0xfb,0x40,0x00,0x00,0x06,
-0xcf,0xd1,0x46,0x00,0xb5,0x20,0x06,0xcf,0xe8,0x10,0x7f,0xfc,0x60,0x00,0x0b,0xa3,
-0x7d,0x00,0xe2,0x8d,0xfd,0x80,0x00,0xbf,0xb8,0xbf,0xa0,0x3f,0x90,0x00,0xbf,0x10,
-0x31,0x5b,0x01,0x10,0xde,0xc0,0x00,0xa1,0x60,0x00,0x00,0x9f,0x80,0x00,0x00,0x5f,
-0x90,0x00,0x6a,0x02,0x24,0x00,0x34,0x32,0x00,0x10,0x7d,0x18,0x05,0x20,0xe2,0x00,
-0x37,0x03,0x30,0x9d,0xff,0xd9,0x81,0x01,0x40,0x07,0xfb,0x63,0x35,0x2c,0x00,0x10,
-0x09,0x9d,0x00,0x70,0x2d,0x90,0x00,0x05,0xf3,0x00,0x00,0x7b,0x05,0xf3,0x40,0x00,
-0xe8,0x00,0x06,0xde,0xb3,0x00,0x99,0x00,0x4f,0x10,0x08,0xf6,0x3c,0xc0,0x04,0xe0,
-0x09,0xc0,0x02,0xf6,0x00,0xba,0x00,0x2f,0x00,0xc9,0x00,0x8e,0x00,0x0c,0x90,0x01,
-0xf1,0x0e,0x70,0x0c,0xb0,0x00,0xe7,0x00,0x1f,0x10,0xd7,0x00,0xd9,0x00,0x0f,0x60,
-0x03,0xe0,0x0c,0x80,0x0d,0xa0,0x03,0xf5,0x00,0x9a,0x00,0xab,0x00,0x8f,0x43,0xce,
-0xb2,0x6f,0x20,0x05,0xf1,0x01,0xbf,0xc3,0x3d,0xfc,0x40,0x00,0x0e,0x90,0x80,0x00,
-0x24,0x4f,0x70,0x09,0x00,0x40,0xc6,0x32,0x47,0x60,0x09,0x00,0x41,0x18,0xcf,0xfd,
-0xb4,0x12,0x00,0x21,0x0c,0xf2,0x97,0x00,0x11,0xff,0x2b,0x00,0x30,0x9f,0xae,0x00,
-0x8d,0x01,0x20,0x93,0xf5,0x0c,0x02,0x20,0xf3,0x0d,0x1c,0x02,0xf1,0x03,0xcd,0x00,
-0x6f,0x20,0x00,0x00,0x2f,0x70,0x01,0xf8,0x00,0x00,0x08,0xf3,0x22,0x2b,0xe0,0x00,
-0x32,0x06,0xa0,0x50,0x00,0x5f,0x75,0x55,0x55,0xec,0x00,0x0b,0xe0,0x5c,0x02,0x10,
-0x02,0x63,0x02,0x41,0x3f,0x80,0x8f,0x40,0x0a,0x01,0xf0,0x04,0x7f,0xff,0xff,0xd8,
-0x00,0x7f,0xa7,0x77,0xcf,0xc0,0x7f,0x50,0x00,0x0b,0xf3,0x7f,0x50,0x00,0x07,0x02,
-0x04,0xf0,0x38,0x09,0xf3,0x7f,0x61,0x12,0x7f,0xb0,0x7f,0xff,0xff,0xfd,0x10,0x7f,
-0x84,0x44,0x7e,0xd1,0x7f,0x50,0x00,0x04,0xf9,0x7f,0x50,0x00,0x01,0xfb,0x7f,0x50,
-0x00,0x06,0xf9,0x7f,0x96,0x67,0xaf,0xe2,0x7f,0xff,0xff,0xd9,0x10,0x00,0x29,0xef,
-0xea,0x30,0x00,0x4f,0xf9,0x79,0xef,0x50,0x1e,0xe1,0x00,0x01,0xee,0x07,0xf6,0x00,
-0x00,0x08,0xf5,0xbf,0x10,0x00,0x00,0x14,0x2d,0xf0,0xa2,0x00,0x24,0xee,0x00,0xa8,
-0x02,0x71,0x00,0xcf,0x00,0x00,0x00,0x13,0x18,0x21,0x00,0x10,0x1f,0x2c,0x00,0x80,
-0x00,0x5f,0xe9,0x79,0xef,0x50,0x00,0x3a,0x42,0x00,0xb0,0x7f,0xff,0xfd,0xa3,0x00,
-0x07,0xfa,0x77,0x9e,0xf7,0x00,0x8a,0x00,0x30,0xf4,0x07,0xf5,0x6a,0x02,0xb0,0x7f,
-0x50,0x00,0x00,0x9f,0x27,0xf5,0x00,0x00,0x07,0xf4,0x0b,0x00,0x25,0x6f,0x57,0x0b,
-0x00,0x10,0xaf,0x16,0x00,0x20,0x1f,0xd0,0x2c,0x00,0x62,0xf5,0x07,0xf9,0x66,0x9e,
-0xf7,0x42,0x00,0x00,0xd1,0x00,0x80,0xff,0xf1,0x7f,0xa7,0x77,0x77,0x70,0x7f,0x2a,
-0x03,0x07,0x05,0x00,0x31,0x61,0x11,0x11,0x1e,0x00,0x6c,0x30,0x7f,0x84,0x44,0x44,
-0x00,0x1e,0x00,0x50,0x96,0x66,0x66,0x61,0x7f,0x61,0x02,0x10,0x7f,0x7f,0x07,0x40,
-0xfa,0x77,0x77,0x76,0x18,0x00,0x23,0x07,0xf5,0x21,0x00,0x50,0x07,0xf6,0x11,0x11,
-0x10,0x1b,0x00,0x5a,0x07,0xf8,0x44,0x44,0x40,0x1b,0x00,0x14,0xf5,0x45,0x00,0xf0,
-0x09,0x00,0x3a,0xef,0xeb,0x40,0x00,0x5f,0xe9,0x78,0xef,0x70,0x1f,0xe1,0x00,0x00,
-0xcf,0x28,0xf5,0x00,0x00,0x03,0x94,0xbf,0x10,0x01,0x01,0xf0,0x01,0xf0,0x00,0x01,
-0x11,0x10,0xee,0x00,0x05,0xff,0xff,0x8d,0xf0,0x00,0x14,0x47,0xf8,0x16,0x00,0xf1,
-0x08,0x3f,0x86,0xf7,0x00,0x00,0x03,0xf8,0x0e,0xf3,0x00,0x00,0x5f,0x80,0x3e,0xfa,
-0x77,0xaf,0xe2,0x00,0x18,0xdf,0xfd,0x81,0x4d,0x00,0x20,0x0d,0xf7,0x57,0x00,0x1d,
-0xdf,0x0b,0x00,0x61,0xf6,0x11,0x11,0x11,0xdf,0x7f,0x24,0x08,0x5f,0xf8,0x44,0x44,
-0x44,0xef,0x2c,0x00,0x08,0x4c,0xf0,0x4f,0x74,0xf7,0x03,0x00,0x10,0x70,0x47,0x02,
-0x1f,0xf0,0x05,0x00,0x15,0xf0,0x04,0x5c,0x30,0x00,0x0d,0xf0,0x5f,0x90,0x00,0x3f,
-0xc0,0x0c,0xfb,0x79,0xff,0x30,0x00,0x8d,0xff,0xb3,0x9d,0x00,0xf0,0x07,0x02,0xee,
-0x27,0xf5,0x00,0x02,0xee,0x20,0x7f,0x50,0x01,0xdf,0x30,0x07,0xf5,0x01,0xdf,0x40,
-0x00,0x7f,0x50,0xcf,0x3b,0x02,0xf0,0x04,0xcf,0x70,0x00,0x00,0x7f,0xef,0xfc,0x00,
-0x00,0x07,0xff,0x78,0xf9,0x00,0x00,0x7f,0x80,0x0c,0xf5,0x20,0x01,0x20,0x1e,0xf3,
-0x37,0x00,0x20,0x3f,0xd1,0x2b,0x01,0x21,0x6f,0xb0,0xd5,0x01,0x1e,0x80,0x44,0x01,
-0x0f,0x09,0x00,0x0d,0x00,0x2d,0x06,0x00,0xfa,0x00,0x30,0xc0,0x7f,0xf1,0x26,0x05,
-0x30,0xff,0x07,0xff,0xce,0x00,0x40,0xef,0xf0,0x7f,0xfe,0xbb,0x05,0xf0,0x25,0xff,
-0x07,0xf9,0xf5,0x00,0x00,0x0c,0xea,0xf0,0x7f,0x4f,0xb0,0x00,0x02,0xf8,0xaf,0x07,
-0xf4,0x9f,0x20,0x00,0x9f,0x2b,0xf0,0x7f,0x42,0xf9,0x00,0x0f,0xb0,0xbf,0x07,0xf5,
-0x0b,0xf0,0x06,0xf4,0x0c,0xf0,0x7f,0x50,0x4f,0x60,0xdd,0x00,0xcf,0x07,0xf5,0x00,
-0xdd,0x4f,0x60,0x0f,0x00,0x31,0x07,0xfd,0xf0,0x0f,0x00,0x30,0x1f,0xf9,0x00,0x0f,
-0x00,0x80,0x00,0x9f,0x20,0x00,0xcf,0x00,0x7f,0xb0,0x4b,0x01,0x20,0xff,0x50,0x4b,
-0x01,0x70,0xff,0x10,0x00,0x0d,0xf7,0xfa,0xfb,0x0b,0x00,0x20,0x59,0xf6,0x61,0x01,
-0x20,0x0e,0xf2,0x61,0x01,0x20,0x4f,0xc0,0x6c,0x01,0x20,0x9f,0x60,0x6c,0x01,0x70,
-0xdf,0x2d,0xf7,0xf5,0x00,0x03,0xfc,0x0b,0x00,0x20,0x08,0xff,0x82,0x01,0x20,0x0d,
-0xff,0xb2,0x00,0xf0,0x09,0x3f,0xf0,0x00,0x29,0xdf,0xe9,0x20,0x00,0x3f,0xfa,0x8a,
-0xff,0x40,0x1e,0xe2,0x00,0x02,0xee,0x17,0xf6,0x00,0x00,0x05,0xf7,0xfc,0x01,0x30,
-0x0f,0xcd,0xe0,0x81,0x03,0x10,0xed,0x1c,0x02,0x20,0xfd,0xe0,0x28,0x03,0x01,0x16,
-0x00,0x20,0xc7,0xf7,0x21,0x00,0xf0,0x01,0x1e,0xe2,0x00,0x01,0xdf,0x10,0x3f,0xfa,
-0x89,0xff,0x50,0x00,0x29,0xdf,0xea,0x20,0xb8,0x02,0x80,0xeb,0x30,0x07,0xfa,0x77,
-0x79,0xff,0x50,0x80,0x01,0x10,0xfe,0x15,0x01,0x20,0x09,0xf3,0x64,0x00,0x20,0x8f,
-0x47,0x6f,0x00,0x80,0xf1,0x7f,0x61,0x11,0x3b,0xfa,0x07,0xff,0x7e,0x08,0x42,0x7f,
-0x84,0x44,0x30,0x36,0x01,0x02,0x96,0x02,0x06,0x0b,0x00,0x00,0x80,0x05,0x50,0xef,
-0xd9,0x20,0x00,0x4f,0x90,0x00,0x10,0x1f,0x90,0x00,0x60,0x18,0xf5,0x00,0x00,0x06,
-0xf6,0x98,0x03,0x20,0x1f,0xbe,0xb5,0x05,0x20,0xed,0xfc,0x54,0x04,0x20,0xee,0xd0,
-0xe6,0x06,0x10,0xdf,0x16,0x00,0x20,0xb8,0xf6,0xfc,0x02,0xf1,0x01,0x1f,0xe1,0x00,
-0x02,0xee,0x10,0x4f,0xf9,0x8a,0xfe,0x30,0x00,0x2a,0xef,0xef,0xd2,0x2c,0x07,0x01,
-0x32,0x07,0x12,0x2c,0x57,0x00,0x01,0x0b,0x04,0x61,0x07,0xfa,0x77,0x7b,0xfe,0x20,
-0x20,0x04,0x10,0x07,0x9d,0x03,0x00,0xe9,0x01,0xf0,0x04,0x03,0xf9,0x07,0xf6,0x11,
-0x26,0xef,0x20,0x7f,0xff,0xff,0xfc,0x30,0x07,0xf8,0x44,0x8f,0x70,0x00,0x30,0x01,
-0x60,0x10,0x07,0xf5,0x00,0x05,0xf8,0x0b,0x00,0x40,0x0d,0xf1,0x07,0xf5,0x87,0x05,
-0x00,0xa0,0x00,0xd0,0xcf,0x10,0x00,0x18,0xdf,0xeb,0x40,0x00,0x2e,0xfa,0x78,0xdf,
-0x80,0x25,0x08,0x90,0xbf,0x30,0xcf,0x00,0x00,0x04,0xe6,0x09,0xf7,0x64,0x00,0x30,
-0x1d,0xfc,0x61,0x0a,0x07,0x20,0xdf,0xfc,0x73,0x00,0x40,0x27,0xdf,0xa0,0x00,0x45,
-0x08,0x80,0x52,0xe8,0x00,0x00,0x04,0xf8,0x0e,0xe2,0xd2,0x05,0xc0,0x4f,0xfa,0x78,
-0xbf,0xd0,0x00,0x19,0xdf,0xec,0x70,0x00,0x8f,0x21,0x03,0x90,0xe3,0x77,0x78,0xfc,
-0x77,0x76,0x00,0x00,0x3f,0x30,0x05,0x10,0x03,0xf7,0x04,0x0f,0x0b,0x00,0x1e,0x00,
-0x94,0x01,0x7f,0xbf,0x1b,0xf1,0x00,0x00,0x0b,0xf1,0x0b,0x00,0x13,0x30,0x19,0xf3,
-0x00,0x33,0x03,0xf0,0x09,0xa0,0x00,0x05,0xfb,0x00,0xbf,0xc8,0x7a,0xfe,0x20,0x00,
-0x6c,0xff,0xd8,0x00,0x00,0x8f,0x60,0x00,0x00,0x04,0xfa,0x2f,0xb0,0xfc,0x08,0xe1,
-0x0c,0xf1,0x00,0x00,0x0f,0xd0,0x06,0xf6,0x00,0x00,0x5f,0x70,0x00,0xfc,0x64,0x00,
-0x90,0x9f,0x20,0x01,0xfb,0x00,0x00,0x3f,0x70,0x06,0xcc,0x01,0xd1,0xd0,0x0c,0xe0,
-0x00,0x00,0x07,0xf3,0x1f,0x90,0x00,0x00,0x01,0xf8,0x02,0x08,0x26,0xbe,0xdc,0x71,
-0x01,0x21,0x0e,0xf1,0x38,0x00,0xf0,0x04,0x05,0xf7,0x00,0x00,0x7f,0x51,0xfb,0x00,
-0x00,0xaf,0xb0,0x00,0x0b,0xf1,0x0d,0xe0,0x00,0x0e,0xff,0x44,0x0b,0xa0,0x8f,0x20,
-0x03,0xf9,0xf4,0x00,0x2f,0x90,0x04,0xf6,0x65,0x0e,0xf0,0x1c,0x06,0xf5,0x00,0x1f,
-0xa0,0x0d,0xb0,0xae,0x00,0xaf,0x10,0x00,0xce,0x01,0xf6,0x05,0xf2,0x0e,0xc0,0x00,
-0x08,0xf2,0x6f,0x20,0x1f,0x71,0xf8,0x00,0x00,0x4f,0x6b,0xd0,0x00,0xcb,0x5f,0x40,
-0x00,0x01,0xf9,0xf8,0x00,0x07,0xf9,0x5c,0x0a,0x50,0xef,0x30,0x00,0x3f,0xec,0x81,
-0x0a,0x00,0x38,0x06,0xb0,0x80,0x00,0x00,0x04,0xf9,0x00,0x00,0x09,0xf4,0x00,0x00,
-0xcc,0x04,0xd0,0x2f,0xe1,0x06,0xfa,0x00,0x00,0xbf,0x50,0x00,0xbf,0x50,0x06,0xfa,
-0x13,0x00,0x80,0x1e,0xe1,0x00,0x00,0x06,0xf9,0xaf,0x50,0xd3,0x09,0x11,0xfa,0xaf,
-0x06,0x11,0xf3,0xe3,0x05,0x10,0xfb,0x72,0x02,0xf0,0x15,0xf9,0xaf,0x60,0x00,0x00,
-0x2f,0xe0,0x1e,0xf1,0x00,0x00,0xcf,0x40,0x05,0xfb,0x00,0x07,0xf9,0x00,0x00,0xaf,
-0x60,0x2f,0xe1,0x00,0x00,0x1e,0xf1,0x9f,0x70,0x00,0x00,0x1f,0xe0,0x1e,0xe0,0xb2,
-0x01,0xf1,0x02,0x06,0xf8,0x00,0x02,0xfc,0x00,0x00,0xdf,0x10,0x0a,0xf3,0x00,0x00,
-0x4f,0x80,0x2f,0xa0,0x48,0x01,0x61,0x20,0x00,0x00,0x02,0xfc,0xf8,0xe4,0x06,0x15,
-0xe0,0x94,0x01,0x0f,0x06,0x00,0x04,0x20,0x1f,0xff,0xe1,0x06,0x40,0x77,0x77,0x77,
-0x7f,0x1c,0x07,0x01,0x29,0x02,0x20,0x04,0xfb,0x99,0x0c,0x23,0xee,0x10,0x6d,0x0a,
-0x30,0x00,0x7f,0x90,0x2c,0x00,0x10,0xd0,0x69,0x03,0x01,0x24,0x00,0x10,0xf6,0x31,
-0x07,0x10,0xfa,0x24,0x00,0x60,0xef,0x76,0x66,0x66,0x64,0x3f,0x42,0x00,0x9f,0xa0,
-0x01,0x11,0xaf,0xfd,0xaf,0x53,0xaf,0x10,0x02,0x00,0x08,0x90,0x21,0xaf,0xfd,0x24,
-0x43,0x6f,0x30,0x00,0x00,0x9a,0x01,0x50,0x0a,0xe0,0x00,0x00,0x04,0x59,0x03,0x10,
-0xdb,0x62,0x00,0x20,0x20,0x00,0x6e,0x0c,0x01,0x61,0x07,0x23,0x05,0xf4,0xb3,0x09,
-0x20,0x8f,0x10,0x8b,0x07,0x10,0x00,0x47,0x0c,0x02,0xbf,0x09,0x8f,0x74,0x11,0x10,
-0xef,0xf9,0x45,0xf9,0x02,0x02,0x00,0x08,0x90,0x13,0xf9,0xef,0xf9,0x44,0x42,0x00,
-0x05,0x50,0x23,0x01,0xf0,0x0e,0x00,0x00,0x7f,0xf6,0x00,0x00,0xe9,0xbd,0x00,0x05,
-0xf3,0x4f,0x30,0x0c,0xc0,0x0e,0xa0,0x3f,0x60,0x07,0xf1,0x11,0x11,0x11,0x11,0x0f,
-0xff,0xff,0xff,0xfc,0x05,0xf1,0x07,0x44,0x20,0x17,0x60,0x00,0x8f,0x40,0x00,0x8e,
-0x10,0x03,0xbe,0xfd,0x60,0x03,0xfd,0x76,0xcf,0x60,0x9d,0x10,0x00,0x41,0x0d,0xf1,
-0x0e,0xe0,0x04,0xbe,0xff,0xff,0x07,0xfb,0x53,0x3c,0xf0,0xed,0x00,0x00,0xcf,0x0e,
-0xd0,0x00,0x2e,0xf0,0x8f,0xc8,0x9f,0xff,0x00,0x7d,0xfd,0x58,0xd2,0xbf,0x94,0x09,
-0x00,0x1e,0x01,0x05,0x09,0x00,0xf0,0x02,0x3c,0xfe,0xa1,0x0b,0xff,0x97,0xbf,0xd0,
-0xbf,0x40,0x00,0x9f,0x6b,0xf0,0x00,0x01,0xfa,0xa7,0x0a,0xf0,0x1c,0xcb,0xf0,0x00,
-0x00,0xfc,0xbf,0x00,0x00,0x2f,0xab,0xf5,0x00,0x09,0xf5,0xbf,0xf9,0x7b,0xfc,0x0b,
-0xe3,0xcf,0xea,0x10,0x00,0x19,0xef,0xc6,0x00,0x01,0xef,0x86,0xbf,0x90,0x0a,0xf3,
-0x00,0x0a,0xf1,0x0f,0xc0,0x00,0x02,0x72,0x12,0x01,0x01,0x17,0x01,0x00,0x20,0x0d,
-0x30,0x01,0x31,0x0a,0x2e,0x0d,0x91,0x02,0xef,0x86,0xaf,0x80,0x00,0x2a,0xef,0xd6,
-0x19,0x0e,0x1c,0xf5,0x05,0x00,0xf4,0x06,0x3b,0xfe,0xa7,0xf5,0x02,0xff,0x97,0xbf,
-0xf5,0x0a,0xf4,0x00,0x09,0xf5,0x0f,0xd0,0x00,0x05,0xf5,0x1f,0xa0,0x05,0x00,0xf0,
-0x19,0x0f,0xc0,0x00,0x05,0xf5,0x0a,0xf2,0x00,0x08,0xf5,0x02,0xfe,0x64,0x9f,0xf5,
-0x00,0x2b,0xff,0xb6,0xf5,0x00,0x19,0xef,0xd6,0x00,0x01,0xdf,0x86,0xbf,0x70,0x09,
-0xf3,0x00,0x0b,0xf0,0x0e,0xc1,0x11,0x17,0xf4,0xfe,0x01,0x80,0xf5,0x1f,0xb4,0x44,
-0x44,0x41,0x0f,0xc0,0x13,0x0a,0xe0,0xf5,0x00,0x02,0x70,0x01,0xef,0x96,0x8f,0xd0,
-0x00,0x19,0xef,0xe9,0x10,0x9f,0x0e,0x70,0x00,0x9f,0xf9,0x00,0x7f,0xa5,0x30,0xd0,
-0x06,0x10,0xdd,0xdc,0x0b,0x71,0xf0,0x24,0xee,0x44,0x00,0x0d,0xd0,0x43,0x0b,0x0f,
-0x07,0x00,0x02,0x50,0x00,0x3b,0xfe,0xa5,0xf6,0x99,0x00,0x10,0xf6,0x99,0x00,0x10,
-0xf6,0x99,0x00,0x34,0xf6,0x1f,0xa0,0x05,0x00,0x01,0x0f,0x00,0x01,0x19,0x00,0x01,
-0x23,0x00,0x01,0xc6,0x00,0x10,0x00,0x93,0x08,0xe7,0x01,0x80,0x00,0x0d,0xf1,0x05,
-0xfc,0x77,0xcf,0x80,0x00,0x3b,0xef,0xc6,0x5b,0x01,0x05,0x09,0x00,0xfe,0x0b,0x2b,
-0xfe,0xa1,0x0b,0xfe,0xa7,0xaf,0xb0,0xbf,0x60,0x00,0xbf,0x0b,0xf0,0x00,0x08,0xf2,
-0xbf,0x00,0x00,0x8f,0x3b,0xf0,0x00,0x08,0xf3,0x09,0x00,0x87,0x7f,0x26,0xe2,0x00,
-0x08,0xf2,0x8f,0x28,0x03,0x00,0x60,0x20,0x00,0x9e,0x10,0x08,0xd1,0xe5,0x00,0x4f,
-0xf1,0x00,0xaf,0x10,0x05,0x00,0x05,0x5f,0x04,0x8f,0xd0,0x8f,0xc3,0x7e,0x00,0x01,
-0x50,0x00,0x06,0xfa,0x0b,0xf0,0x94,0x04,0xf9,0x14,0x05,0xfc,0x00,0x0b,0xf4,0xfd,
-0x10,0x00,0xbf,0xef,0x80,0x00,0x0b,0xfd,0xcf,0x40,0x00,0xbf,0x22,0xee,0x10,0x0b,
-0xf0,0x04,0xfb,0x00,0xbf,0x00,0x08,0xf7,0x0b,0xf0,0x00,0x0c,0xf3,0x78,0x00,0x04,
-0x03,0x00,0xf1,0x10,0xbe,0x3b,0xff,0xa1,0x2b,0xfe,0xb2,0x0b,0xfe,0x87,0xbf,0xcf,
-0xa7,0x9f,0xd0,0xbf,0x30,0x00,0xcf,0x80,0x00,0x9f,0x3b,0xf0,0x00,0x09,0xf3,0x00,
-0x06,0xf5,0xbf,0xb7,0x0e,0x30,0x5f,0x5b,0xf0,0x2a,0x0f,0x1f,0x05,0x0f,0x00,0x0d,
-0x0f,0x0b,0x01,0x19,0xf0,0x00,0x00,0x19,0xef,0xd8,0x00,0x01,0xdf,0x96,0xaf,0xc0,
-0x09,0xf4,0x00,0x07,0xf7,0xe8,0x01,0x60,0xfc,0x1f,0xa0,0x00,0x00,0xcf,0x6f,0x02,
-0x11,0xdf,0x0f,0x00,0x10,0x0a,0x19,0x00,0xfb,0x0c,0x01,0xef,0x96,0xaf,0xc0,0x00,
-0x19,0xef,0xd7,0x00,0xbe,0x5c,0xfe,0x91,0x0b,0xfe,0x64,0x9f,0xc0,0xbf,0x20,0x00,
-0x8f,0x5b,0xf0,0x00,0x02,0xce,0x02,0xdd,0xf3,0x00,0x0a,0xf5,0xbf,0xe8,0x6b,0xfc,
-0x0b,0xf4,0xcf,0xea,0x10,0x2b,0x01,0x00,0x01,0x02,0xb0,0xa6,0xf5,0x02,0xff,0x86,
-0xaf,0xf5,0x0b,0xf4,0x00,0x08,0x9a,0x02,0x10,0x06,0x95,0x02,0x02,0x05,0x00,0x00,
-0x9a,0x02,0x10,0x06,0xb3,0x02,0x12,0x08,0x23,0x00,0x31,0x00,0x3b,0xff,0x01,0x02,
-0x2e,0x06,0xf5,0x05,0x00,0x86,0xbf,0x5d,0xf2,0xbf,0xf9,0x71,0xbf,0x40,0x80,0x10,
-0x08,0x03,0x00,0xe0,0x00,0x4c,0xfe,0xb4,0x00,0x5f,0xc6,0x7e,0xf4,0x0b,0xf0,0x00,
-0x2f,0xb0,0x48,0x05,0xf0,0x11,0x01,0xcf,0xea,0x50,0x00,0x00,0x38,0xcf,0xe3,0x02,
-0x10,0x00,0x3f,0xb0,0xfc,0x00,0x00,0xec,0x07,0xfc,0x66,0xcf,0x60,0x05,0xcf,0xfc,
-0x50,0x00,0x85,0x00,0x01,0xfa,0x03,0x00,0x62,0xef,0xff,0xf8,0x45,0xfb,0x42,0x0c,
-0x00,0x08,0x03,0x00,0x60,0x00,0xef,0x74,0x00,0x4d,0xf7,0x35,0x01,0x14,0x2b,0x50,
-0x01,0x0e,0x09,0x00,0xf0,0x27,0x29,0xf3,0x00,0x0c,0xf2,0x3f,0xe7,0x8d,0xff,0x20,
-0x5d,0xfe,0x98,0xf2,0x8f,0x30,0x00,0x1f,0xa2,0xf9,0x00,0x06,0xf4,0x0c,0xe0,0x00,
-0xbe,0x00,0x6f,0x30,0x1f,0x90,0x01,0xf9,0x06,0xf3,0x00,0x0b,0xe0,0xbd,0x00,0x00,
-0x5f,0x5f,0x80,0x00,0x00,0xfe,0xf2,0x00,0x00,0x09,0xfc,0x00,0x24,0x11,0x00,0x89,
-0x0e,0xf1,0x2b,0xbe,0x00,0x00,0xfa,0x2f,0x80,0x01,0xff,0x40,0x04,0xf6,0x0d,0xc0,
-0x05,0xfe,0x90,0x08,0xf1,0x09,0xf0,0x0a,0xb9,0xe0,0x0c,0xc0,0x04,0xf4,0x0f,0x64,
-0xf3,0x0f,0x80,0x00,0xf8,0x4f,0x10,0xe8,0x4f,0x30,0x00,0xbd,0x9c,0x00,0x9d,0x8e,
-0x00,0x00,0x6f,0xf7,0x00,0x4f,0xea,0x00,0x00,0x1f,0xf2,0x00,0x0f,0xd5,0x06,0x00,
-0xb8,0x02,0xf0,0x06,0x3f,0xc0,0x00,0x6f,0x80,0x8f,0x60,0x1f,0xd0,0x00,0xde,0x1a,
-0xf3,0x00,0x03,0xfc,0xf9,0x00,0x00,0x08,0xfd,0xe7,0x05,0xf0,0x27,0xe1,0x00,0x00,
-0x4f,0xaf,0xa0,0x00,0x0e,0xe0,0x8f,0x50,0x09,0xf4,0x00,0xee,0x14,0xfa,0x00,0x04,
-0xfa,0x9f,0x30,0x00,0x3f,0x94,0xf9,0x00,0x08,0xf3,0x0e,0xe0,0x00,0xde,0x00,0x8f,
-0x40,0x3f,0x80,0x02,0xf9,0x08,0xf2,0x00,0x0c,0xe0,0xdd,0x00,0x00,0x7f,0x6f,0x70,
-0x00,0x01,0xff,0xfd,0x10,0x12,0xfc,0xb6,0x0f,0x32,0x00,0x07,0xf1,0x8c,0x05,0x72,
-0x18,0xcf,0x30,0x00,0x03,0xfd,0x50,0x19,0x06,0xd3,0x80,0x66,0x66,0x6e,0xf4,0x00,
-0x00,0x07,0xf8,0x00,0x00,0x03,0xfb,0x14,0x06,0x20,0xbf,0x40,0x97,0x0a,0xb0,0x00,
-0x00,0x3f,0xb0,0x00,0x00,0x1e,0xf7,0x66,0x66,0x43,0x53,0x13,0xd1,0x00,0x00,0x02,
-0x00,0x00,0x1b,0xf1,0x00,0x0c,0xe2,0x00,0x03,0xf8,0x64,0x0f,0x60,0x07,0xf4,0x00,
-0x00,0x7f,0x40,0x30,0x0e,0x92,0x04,0xed,0x00,0x06,0xff,0x20,0x00,0x17,0xfb,0x29,
-0x0e,0x20,0x7f,0x40,0x1c,0x00,0x00,0x5a,0x12,0x22,0x04,0xf7,0x35,0x04,0x7a,0x2e,
-0xd1,0x00,0x00,0x05,0x00,0x6f,0x01,0x00,0x60,0x38,0x10,0x00,0x00,0xae,0x40,0xb1,
-0x10,0x30,0x01,0xf9,0x00,0x94,0x05,0x10,0xed,0x5e,0x04,0x00,0x02,0x0d,0xa1,0x6f,
-0x81,0x00,0x09,0xfd,0x00,0x4f,0xb4,0x00,0xbf,0x12,0x00,0x11,0xed,0x1e,0x00,0xa1,
-0xfa,0x00,0x08,0xf4,0x00,0x8f,0x70,0x00,0x31,0x00,0xb5,0x04,0xf1,0x01,0x01,0x10,
-0x8f,0xfd,0x50,0x00,0xc9,0x6f,0x86,0xdf,0x93,0x7f,0x5b,0xc0,0x00,0x9f,0xf2,0x0d,
-0x21,0x14,0x20,0x6b,0x09,0x13,0x50,0x1f,0x0e,0x23,0x3f,0x30,0x5f,0x0f,0x12,0xfb,
-0x08,0x00,0x32,0x04,0xff,0xf4,0x09,0x00,0x41,0xcf,0xdf,0xc0,0x00,0x30,0x08,0x31,
-0xe1,0xef,0x50,0x7c,0x0d,0x31,0xf6,0x06,0xfd,0x84,0x05,0x31,0xfd,0x00,0x0d,0x0b,
-0x0a,0x50,0xdf,0x50,0x00,0x5f,0xd0,0x4b,0x10,0x12,0xc0,0x34,0x11,0x60,0x0e,0xf4,
-0x00,0x00,0x04,0xfe,0xe8,0x0e,0x00,0x4f,0x00,0xa1,0xf7,0x00,0x01,0xff,0x63,0x33,
-0x33,0x33,0x6f,0xf1,0x46,0x09,0x00,0x47,0x01,0x22,0x1f,0xff,0x01,0x00,0x11,0x10,
-0x7f,0x0e,0x11,0x89,0x56,0x00,0xf0,0x1a,0x03,0xff,0xff,0xb0,0x00,0x00,0x02,0x40,
-0xdf,0x30,0x9f,0x50,0x00,0x4d,0xff,0x4f,0xa0,0x02,0xf9,0x00,0x7f,0xf9,0x44,0xfe,
-0x10,0x6f,0x70,0x5f,0xd1,0x00,0x7f,0xfe,0xcf,0xe1,0x0e,0xf1,0x00,0x0a,0xff,0xff,
-0xd2,0xaa,0x08,0xf1,0x0e,0xdf,0xff,0x93,0xf4,0x8f,0x20,0x00,0x0f,0xfe,0x40,0x2f,
-0x8a,0xf0,0x00,0x03,0xfb,0x10,0x00,0xfa,0x8f,0x20,0x00,0x57,0x00,0x00,0x2f,0x85,
-0xf7,0x00,0xa3,0x0a,0x21,0x0e,0xe1,0xb5,0x07,0x30,0x00,0x6f,0xc1,0x09,0x03,0x60,
-0x60,0x00,0x8f,0xe7,0x32,0x37,0x84,0x08,0x50,0x5e,0xff,0xff,0xfe,0x50,0xde,0x00,
-0x21,0x78,0x74,0xd5,0x00,0x40,0x1a,0xbb,0xbb,0xb7,0x08,0x00,0xf1,0x13,0x40,0x6f,
+0x00,0x1e,0x1f,0x9e,0x05,0x58,0x20,0x00,0x21,0x22,0x00,0x01,0x00,0x2f,0xfa,0x00,
+0x01,0x00,0x29,0x13,0xf0,0x08,0x00,0x17,0xee,0x14,0x00,0xbf,0xf9,0xf7,0x00,0xfd,
+0xf7,0x00,0xf4,0x00,0x00,0x00,0x02,0x58,0x00,0x26,0x4f,0x03,0x03,0x00,0x03,0x3c,
+0x00,0x25,0x2f,0xe7,0x00,0x01,0x00,0x3b,0x1f,0xdf,0x44,0x00,0x30,0x03,0x20,0x01,
+0xb1,0xf7,0x00,0xfe,0x00,0x00,0xed,0xfd,0xf3,0xf6,0x00,0xf2,0x11,0x00,0x00,0x0f,
+0x00,0x4f,0xfd,0xfe,0xf9,0xfb,0x2a,0x01,0x24,0x6f,0xfc,0x00,0xfc,0x00,0x00,0xf8,
+0x96,0x00,0x27,0x1c,0xfc,0x0a,0x00,0x19,0xfe,0x1f,0x00,0x1f,0xfd,0x4c,0x00,0x19,
+0x13,0xf1,0x31,0x00,0x7f,0xfc,0x00,0xfd,0x00,0xfd,0xfa,0xfd,0x34,0x01,0x30,0x15,
+0x03,0x88,0x00,0x11,0xfd,0x5a,0x00,0x2f,0xfd,0xfc,0x56,0x00,0x1d,0x11,0xdd,0x0e,
+0x02,0x15,0xd9,0x4a,0x00,0x20,0xfb,0xfd,0x46,0x00,0x02,0x04,0x00,0x0f,0x90,0x00,
+0x23,0x10,0xfc,0x08,0x00,0x1f,0xfc,0xda,0x00,0x2d,0x1f,0xfd,0x99,0x02,0x33,0x10,
+0xf7,0xd3,0x00,0x09,0xcf,0x01,0x01,0xd9,0x00,0x3f,0xfd,0xfa,0xf7,0x45,0x00,0x18,
+0x14,0xce,0xde,0x00,0x97,0xf6,0x00,0x00,0xd7,0xf8,0xe6,0xeb,0x00,0xdd,0xca,0x03,
+0x2f,0xec,0xf2,0x93,0x00,0x1c,0x72,0xd0,0x00,0x00,0x00,0xec,0x00,0xe2,0x6e,0x01,
+0x51,0x00,0xfc,0x00,0xfe,0xfe,0x55,0x02,0x1f,0x02,0x0b,0x04,0x27,0x6f,0xfa,0x00,
+0xfc,0xfd,0x00,0xfb,0x2f,0x01,0x31,0x10,0xf4,0x78,0x01,0x1f,0xf9,0x87,0x00,0x26,
+0x00,0xdb,0x0a,0xa1,0xde,0x00,0x00,0xf4,0xfc,0xdc,0xfe,0x02,0x00,0x02,0xd2,0x00,
+0xdf,0xef,0xf1,0x00,0xf0,0xf1,0xf5,0xef,0x00,0xf2,0xf5,0xf8,0xf5,0xf7,0x4a,0x02,
+0x1a,0x66,0xdf,0xfb,0x00,0x00,0xf5,0xfe,0x11,0x00,0x90,0xf9,0xf9,0x00,0x00,0xf9,
+0xfc,0x00,0x00,0xfc,0x14,0x00,0x0f,0xfa,0x04,0x18,0x42,0x02,0x00,0xee,0xf7,0x9d,
+0x00,0x13,0x02,0x11,0x00,0x23,0xfb,0xfb,0xe8,0x02,0x1f,0x00,0x81,0x05,0x1e,0x14,
+0xf9,0x09,0x04,0x15,0x02,0x15,0x04,0x01,0x78,0x03,0x1f,0xfb,0x55,0x04,0x1b,0xf0,
+0x0a,0x03,0xf9,0xe1,0xf8,0x00,0x00,0xf2,0xfc,0xf2,0xfe,0x03,0xf2,0x03,0x03,0x02,
+0x03,0x00,0x03,0xf5,0xf6,0xfd,0xfa,0xf6,0xfa,0xf7,0x17,0x04,0x2f,0xfd,0xfc,0xd8,
+0x05,0x1e,0x2a,0x02,0xfc,0x3b,0x03,0x02,0x0c,0x04,0x1f,0xfc,0x7a,0x03,0x25,0x0f,
+0x7d,0x03,0x2a,0x1f,0xf6,0x1d,0x00,0x09,0x1f,0xfe,0x7c,0x05,0x23,0x0f,0x4a,0x00,
+0x02,0x1f,0xfe,0x4d,0x00,0x17,0x1f,0xfe,0xea,0x06,0x36,0x1f,0xfe,0x67,0x00,0x36,
+0x1e,0x02,0xc5,0x02,0x19,0x03,0xf3,0x00,0x1f,0x03,0x58,0x06,0x19,0x0f,0x01,0x00,
+0x48,0x0f,0x0e,0x02,0x22,0x1f,0xec,0x28,0x01,0x0b,0x2f,0xfd,0xfe,0x28,0x01,0x18,
+0x0a,0x3c,0x09,0x01,0x6b,0x04,0x20,0xfd,0x02,0x97,0x00,0x10,0x07,0x05,0x09,0x0f,
+0xe1,0x00,0x61,0x17,0x02,0xd8,0x09,0x05,0xd5,0x00,0x2f,0xfe,0x02,0x68,0x02,0x24,
+0x1f,0xee,0xbc,0x01,0x4a,0x1f,0xfd,0xf9,0x02,0x36,0x1f,0xfe,0x89,0x00,0x72,0x0f,
+0x01,0x00,0x06,0xde,0x0a,0x00,0xfd,0x07,0x00,0xf9,0xfd,0xf9,0xe8,0xf3,0xf6,0x00,
+0xe8,0x3e,0x03,0x3f,0xf9,0xfd,0x03,0xe5,0x05,0x17,0x01,0xaf,0x00,0x7e,0xfd,0xf2,
+0xf9,0xfd,0xf9,0xf2,0xfd,0x2a,0x02,0x1f,0xf9,0x0c,0x05,0x16,0xe8,0xf9,0xf9,0xf6,
+0xfd,0x00,0xf6,0x00,0xf6,0xec,0xf6,0xf6,0xf3,0xf2,0xf6,0x6d,0x02,0x11,0xfd,0x20,
+0x00,0x4f,0xfd,0x00,0xfd,0xf6,0x19,0x01,0x12,0x73,0xec,0xec,0x00,0xf9,0xef,0xf9,
+0xef,0x15,0x0b,0x40,0xf6,0xef,0x00,0xef,0x13,0x00,0x92,0x00,0xef,0x00,0x00,0xef,
+0xef,0xef,0xec,0xef,0x71,0x03,0x2f,0xef,0xec,0xae,0x09,0x1b,0x16,0xf9,0xad,0x05,
+0x16,0x0a,0x74,0x04,0x1f,0x07,0x10,0x07,0x1c,0x0f,0x57,0x03,0x33,0x01,0x79,0x08,
+0x35,0xfd,0x03,0x07,0xfa,0x04,0x18,0xfc,0x48,0x00,0x1f,0xfd,0x4b,0x00,0x1a,0x00,
+0x02,0x00,0x6f,0xf9,0xfd,0xfd,0x00,0xf9,0xfd,0x3e,0x03,0x30,0x11,0xfd,0xf8,0x09,
+0x0f,0x4c,0x05,0x39,0x0e,0xf8,0x05,0x0f,0x4a,0x00,0x21,0x00,0x99,0x00,0x09,0x3d,
+0x00,0x11,0x03,0x02,0x00,0x0f,0x2b,0x01,0x14,0x53,0xf9,0xf9,0xf9,0x00,0xfd,0xc3,
+0x01,0x37,0xf2,0xf9,0xf9,0xcc,0x01,0x1f,0xfd,0xc0,0x01,0x1c,0x71,0xec,0xec,0xfd,
+0xf9,0xef,0xfd,0xf9,0x2e,0x03,0x30,0xf2,0x00,0xf9,0x2c,0x01,0x24,0xe8,0xf3,0x1d,
+0x00,0x05,0x09,0x00,0x0f,0x43,0x01,0x11,0x00,0x93,0x00,0xa3,0xf6,0xfd,0xf9,0x00,
+0x00,0xf6,0xf6,0x00,0xef,0xf6,0xd9,0x00,0x1f,0x07,0x55,0x02,0x21,0x73,0xf6,0xf6,
+0x03,0xfd,0xf9,0x00,0xf2,0x79,0x00,0x20,0xf9,0xf2,0x88,0x00,0x10,0xef,0x8e,0x00,
+0x90,0xf3,0xf2,0xf3,0x00,0xe8,0xef,0xef,0x00,0xef,0x0c,0x00,0x1f,0xef,0xde,0x00,
+0x11,0x01,0xd3,0x00,0x14,0xf6,0x4a,0x00,0xf0,0x01,0x00,0xf9,0xef,0xf2,0xe8,0xec,
+0xf6,0xef,0xf2,0xf6,0xf2,0xec,0xf2,0xf2,0xec,0xf2,0x71,0x03,0x1f,0xf2,0xee,0x06,
+0x0c,0x04,0xde,0x00,0x13,0xf6,0x06,0x01,0x22,0xef,0xf2,0x0d,0x00,0x0e,0x32,0x09,
+0x0f,0x78,0x03,0x1a,0x01,0x96,0x00,0x1e,0xf6,0x62,0x02,0x0f,0xa0,0x04,0x19,0x0b,
+0xc5,0x03,0x1f,0x07,0xe8,0x02,0x36,0x0e,0xd2,0x02,0x0f,0x5c,0x00,0x16,0x00,0x33,
+0x05,0xbf,0xf6,0xf9,0xf9,0x00,0xf9,0xe2,0x00,0x00,0xf2,0xe8,0xf2,0x8a,0x0a,0x29,
+0x40,0xf3,0xf9,0x00,0xf2,0x29,0x03,0x32,0xef,0x00,0x00,0x7d,0x05,0x04,0x54,0x10,
+0x2f,0xf2,0xfd,0x19,0x09,0x3b,0x1f,0xf9,0x37,0x0d,0x25,0x11,0xf9,0x8d,0x00,0x11,
+0xfd,0x07,0x00,0x00,0x05,0x00,0x00,0xb4,0x04,0x2f,0xf6,0xf6,0x4c,0x00,0x21,0x20,
+0xfd,0xfd,0x04,0x00,0x11,0xfd,0xff,0x01,0x02,0x01,0x05,0x21,0xf9,0xfd,0xfe,0x00,
+0x0f,0x94,0x00,0x23,0x14,0xf9,0x49,0x02,0x1d,0xf9,0x18,0x04,0x0f,0xd5,0x05,0x1e,
+0x15,0xf9,0xe4,0x02,0x2a,0xf6,0xfd,0xfa,0x02,0x0f,0x51,0x02,0x28,0x1f,0x03,0x51,
+0x08,0x25,0x13,0xfd,0x21,0x01,0x04,0xdf,0x05,0x00,0x3a,0x01,0x0f,0x94,0x00,0x22,
+0x23,0x07,0x07,0x75,0x05,0x00,0x8d,0x00,0x00,0x09,0x00,0x2f,0x03,0x03,0x3c,0x03,
+0x39,0x1f,0xf9,0x94,0x02,0x28,0x1f,0xfd,0x5c,0x06,0x2b,0x06,0x0a,0x02,0x16,0xfd,
+0x4f,0x04,0x10,0xf9,0x54,0x02,0x0f,0x4a,0x00,0x27,0x01,0x94,0x00,0x17,0xf6,0x4a,
+0x00,0x1f,0xfd,0x5c,0x04,0x2d,0x1f,0x03,0x9f,0x0c,0x28,0x11,0xfd,0x8d,0x02,0x15,
+0x0a,0x9b,0x00,0x1f,0xfd,0x28,0x01,0x26,0x20,0xfd,0x03,0x4a,0x00,0x13,0x03,0xd8,
+0x00,0x11,0xfc,0x87,0x03,0x0f,0x2e,0x03,0x29,0x07,0xfc,0x01,0x12,0xf9,0x3f,0x03,
+0x0f,0x0c,0x04,0x23,0x01,0xd5,0x00,0x04,0x2a,0x08,0x00,0x0c,0x00,0x0f,0xbc,0x01,
+0x26,0x09,0x4a,0x00,0x0f,0x32,0x05,0x34,0x1f,0xfd,0x9a,0x02,0x2c,0x09,0x01,0x00,
+0x1e,0xe8,0x70,0x0e,0x0f,0xe4,0x02,0x1a,0x04,0x6c,0x01,0x02,0x0c,0x02,0x00,0x28,
+0x01,0x12,0x01,0xe0,0x11,0x10,0x02,0xa3,0x00,0x4d,0x04,0x00,0x04,0x05,0x36,0x00,
+0x02,0x45,0x18,0x20,0x00,0x0c,0x47,0x18,0x92,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,
+0x13,0x0d,0x4c,0x18,0x01,0x20,0x00,0x00,0x51,0x18,0x40,0x1d,0x1e,0x00,0x1f,0x4e,
+0x18,0xff,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,
+0x27,0x28,0x87,0x00,0x03,0xf5,0x2c,0x29,0x2a,0x2b,0x2c,0x2d,0x2e,0x2f,0x30,0x00,
+0x00,0x31,0x32,0x33,0x00,0x34,0x00,0x35,0x36,0x37,0x38,0x39,0x3a,0x3b,0x00,0x00,
+0x3c,0x3d,0x3e,0x00,0x3f,0x40,0x41,0x42,0x00,0x43,0x44,0x45,0x00,0x00,0x46,0x47,
+0x48,0x00,0x49,0x00,0x4a,0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x00,0x00,0x51,0x52,0x53,
+0x00,0x00,0xb0,0x00,0x20,0x03,0x02,0xab,0x00,0x4b,0x06,0x07,0x06,0x08,0x5d,0x00,
+0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0x24,
+0x0b,0x00,0x00,0x19,0xd1,0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,
+0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,
+0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0xb0,0x00,0x01,0xf2,0x02,0x24,0x00,0x00,0x00,
+0x25,0x00,0x26,0x27,0x00,0x00,0x00,0x28,0x29,0x00,0x2a,0x2b,0x00,0xbe,0x00,0x10,
+0x31,0x1c,0x00,0x33,0x32,0x33,0x34,0xbf,0x00,0xf0,0x08,0x3c,0x3d,0x3e,0x3f,0x40,
+0x41,0x3d,0x42,0x43,0x44,0x45,0x46,0x47,0x36,0x48,0x36,0x3d,0x49,0x3b,0x4a,0x00,
+0x00,0x00,0xf1,0x35,0x7f,0x56,0xf5,0x6f,0x46,0xf4,0x6f,0x46,0xf4,0x5f,0x45,0xf3,
+0x5f,0x32,0x71,0x00,0x04,0xd4,0x5f,0x50,0xb9,0x3f,0x1b,0x83,0xf0,0xb7,0x3f,0x0b,
+0x63,0xe0,0x52,0x16,0x00,0x00,0x00,0xe6,0x02,0xf3,0x00,0x00,0x2f,0x20,0x6e,0x00,
+0x00,0x06,0xe0,0x0a,0xb0,0x03,0xff,0xff,0xff,0xff,0xf7,0x04,0x4e,0x94,0x4f,0x64,
+0x10,0x00,0xf5,0x03,0xf1,0x00,0x00,0x3f,0x1b,0x00,0xf0,0x65,0xf0,0x09,0xc0,0x00,
+0xef,0xff,0xff,0xff,0xfc,0x03,0x3c,0xa3,0x3f,0x73,0x20,0x00,0xe6,0x02,0xf2,0x00,
+0x00,0x2f,0x30,0x5f,0x00,0x00,0x05,0xf0,0x08,0xc0,0x00,0x00,0x00,0x00,0x61,0x00,
+0x00,0x00,0x2f,0x40,0x00,0x00,0x16,0xf7,0x00,0x00,0x4f,0xff,0xff,0x40,0x1f,0xd3,
+0x04,0xee,0x05,0xf5,0x00,0x06,0xf5,0x6f,0x50,0x00,0x3d,0x63,0xfc,0x00,0x00,0x00,
+0x09,0xfe,0x71,0x00,0x00,0x06,0xef,0xfa,0x10,0x00,0x00,0x4b,0xfe,0x10,0x00,0x00,
+0x08,0xf7,0xca,0x00,0x00,0x1f,0x9c,0xf1,0x00,0x04,0xf8,0x5f,0xc4,0x36,0xef,0x20,
+0x6f,0xff,0xfe,0x40,0x00,0x06,0xf3,0x00,0x00,0x00,0x4f,0x10,0x00,0x02,0xbf,0xe7,
+0x56,0x00,0xf0,0x13,0x0d,0xa2,0x4f,0x40,0x04,0x30,0x00,0x0f,0x40,0x0c,0x70,0x1e,
+0x40,0x00,0x0e,0x80,0x2f,0x50,0xaa,0x00,0x00,0x04,0xef,0xf9,0x05,0xe1,0x00,0x00,
+0x00,0x01,0x00,0x1e,0x50,0x00,0x01,0x00,0x11,0xaa,0x06,0x00,0xf1,0x07,0x05,0xe1,
+0x4c,0xea,0x10,0x00,0x00,0x1e,0x52,0xf6,0x3b,0xc0,0x00,0x00,0xaa,0x06,0xd0,0x03,
+0xf0,0x00,0x05,0xe1,0x07,0x00,0x51,0x06,0x50,0x02,0xf6,0x2a,0xa7,0x00,0xf3,0x64,
+0x5d,0xfb,0x20,0x00,0x07,0xdf,0xd5,0x00,0x00,0x00,0x8f,0xa6,0xcf,0x40,0x00,0x00,
+0xdd,0x00,0x0f,0x90,0x00,0x00,0xed,0x00,0x3f,0x60,0x00,0x00,0x8f,0x65,0xec,0x00,
+0x00,0x00,0x0c,0xff,0x90,0x00,0x00,0x00,0x4e,0xff,0x30,0x00,0x10,0x05,0xfb,0x2e,
+0xe1,0x0a,0xe0,0x0e,0xe0,0x03,0xfd,0x0d,0xc0,0x0f,0xb0,0x00,0x5f,0xdf,0x70,0x0e,
+0xe0,0x00,0x08,0xff,0x10,0x05,0xfc,0x53,0x6e,0xff,0x70,0x00,0x3b,0xef,0xe9,0x2b,
+0xf5,0x0f,0x50,0xf5,0x0f,0x40,0xf3,0x05,0x00,0x00,0x01,0x90,0x00,0x0d,0xb0,0x00,
+0xad,0x00,0x04,0xf4,0x00,0x0b,0xd0,0x00,0x1f,0x80,0x00,0x6f,0x40,0x00,0x9f,0x10,
+0x00,0xbf,0x00,0x03,0x00,0x50,0xaf,0x00,0x00,0x7f,0x30,0x68,0x00,0x90,0x0e,0xb0,
+0x00,0x07,0xf2,0x00,0x00,0xda,0x00,0x0d,0x00,0xa1,0x04,0xe0,0x00,0x00,0x00,0x65,
+0x00,0x00,0x4f,0x50,0x15,0x00,0xf1,0x1f,0xdc,0x00,0x00,0x6f,0x30,0x00,0x1f,0x90,
+0x00,0x0c,0xd0,0x00,0x09,0xf1,0x00,0x08,0xf2,0x00,0x07,0xf3,0x00,0x08,0xf3,0x00,
+0x09,0xf2,0x00,0x0b,0xf0,0x00,0x0f,0xb0,0x00,0x3f,0x50,0x00,0x9e,0x00,0x02,0xf5,
+0x00,0x1d,0xa0,0x00,0x8a,0x00,0x01,0x00,0xf0,0x14,0x09,0xc0,0x00,0x00,0x08,0xc0,
+0x00,0x69,0x38,0xc1,0x77,0x6d,0xff,0xff,0xf9,0x00,0x4f,0xf6,0x00,0x00,0xcb,0xbd,
+0x00,0x08,0xf2,0x1e,0x90,0x01,0x40,0x04,0x20,0x00,0x00,0x5a,0x20,0xee,0x00,0x17,
+0x30,0x05,0x00,0x60,0x29,0x99,0xcf,0xa9,0x99,0x4f,0xeb,0x01,0x0b,0x19,0x00,0x01,
+0x05,0x00,0xf2,0x0c,0x0d,0xd0,0xdd,0x0f,0xa7,0xf3,0x25,0x00,0x01,0x11,0x1a,0xff,
+0xfe,0x24,0x44,0x30,0x6e,0x46,0xf4,0x00,0x00,0x06,0xf1,0x00,0x00,0x0c,0xb0,0xe3,
+0x01,0xf0,0x10,0x8e,0x00,0x00,0x00,0xe8,0x00,0x00,0x05,0xf2,0x00,0x00,0x0b,0xc0,
+0x00,0x00,0x1f,0x50,0x00,0x00,0x7e,0x00,0x00,0x00,0xe9,0x00,0x00,0x04,0xf3,0x00,
+0x00,0x0a,0x13,0x00,0xf0,0x1c,0x60,0x00,0x00,0x7f,0x10,0x00,0x00,0x55,0x00,0x00,
+0x00,0x02,0xae,0xfd,0x80,0x01,0xef,0x97,0xbf,0xa0,0x7f,0x50,0x00,0xaf,0x2c,0xf0,
+0x00,0x04,0xf6,0xed,0x00,0x00,0x2f,0x8e,0xc0,0x00,0x02,0xf9,0xfc,0x00,0x00,0x2f,
+0x9e,0x09,0x00,0x00,0x12,0x00,0xff,0x11,0x8b,0xf0,0x00,0x05,0xf6,0x7f,0x50,0x00,
+0xbf,0x20,0xef,0x96,0xbf,0x90,0x01,0xae,0xfd,0x70,0x00,0x00,0x04,0xab,0x29,0xef,
+0xfc,0x6e,0x93,0xfc,0x10,0x00,0xfc,0x00,0x03,0x00,0x08,0xf0,0x06,0x3b,0xef,0xd7,
+0x00,0x04,0xfe,0x87,0xbf,0xb0,0x0d,0xe1,0x00,0x0b,0xf3,0x1f,0xa0,0x00,0x06,0xf5,
+0x00,0x00,0x3d,0x01,0xc0,0x00,0x00,0x1e,0xa0,0x00,0x00,0x00,0xce,0x10,0x00,0x00,
+0x0b,0x59,0x02,0xf1,0x04,0xbf,0x40,0x00,0x00,0x0a,0xf4,0x00,0x00,0x00,0xaf,0x40,
+0x00,0x00,0x09,0xfa,0x66,0x66,0x65,0x0e,0x06,0x01,0xf0,0x01,0x4b,0xef,0xd7,0x00,
+0x06,0xfc,0x76,0xaf,0xb0,0x0e,0xd0,0x00,0x0a,0xf2,0x01,0x10,0x70,0x01,0xf0,0x04,
+0x00,0x12,0x7f,0x90,0x00,0x06,0xff,0xf9,0x00,0x00,0x01,0x45,0xaf,0x80,0x00,0x00,
+0x00,0x0a,0xf2,0x65,0x02,0x60,0xf6,0x1e,0x90,0x00,0x05,0xf6,0x69,0x00,0xa0,0xf2,
+0x05,0xfe,0x76,0xbf,0x90,0x00,0x4b,0xff,0xd6,0x87,0x01,0x70,0xcf,0x60,0x00,0x00,
+0x00,0x6f,0xf6,0x06,0x03,0xf0,0x15,0xdf,0x60,0x00,0x00,0x0b,0xd6,0xf6,0x00,0x00,
+0x06,0xf4,0x5f,0x60,0x00,0x01,0xfa,0x05,0xf6,0x00,0x00,0xbe,0x10,0x5f,0x60,0x00,
+0x5f,0x50,0x05,0xf6,0x00,0x1e,0xc1,0x11,0x6f,0x61,0x07,0x77,0x00,0x70,0xf4,0x24,
+0x44,0x44,0x8f,0x84,0x10,0x55,0x00,0x00,0x42,0x00,0x30,0x5f,0x60,0x00,0x17,0x00,
+0x60,0x80,0x9f,0x88,0x88,0x84,0x0b,0x17,0x02,0xf0,0x02,0xcc,0x00,0x00,0x00,0x0e,
+0xdc,0xff,0xa2,0x00,0xff,0xa8,0xbf,0xe1,0x03,0x30,0x00,0x8f,0x99,0x02,0x10,0xfd,
+0x16,0x03,0xf0,0x3f,0xe5,0xb1,0x00,0x00,0xed,0x3f,0x80,0x00,0x5f,0x80,0xaf,0xa6,
+0x8f,0xe1,0x00,0x7d,0xfe,0xa1,0x00,0x00,0x05,0xbe,0xd0,0x00,0x0b,0xfc,0x96,0x00,
+0x09,0xf5,0x00,0x00,0x02,0xf7,0x01,0x00,0x00,0x7f,0x7d,0xff,0xc2,0x0a,0xff,0x95,
+0x8f,0xe0,0xbf,0x50,0x00,0x7f,0x7c,0xf0,0x00,0x01,0xfb,0xbf,0x00,0x00,0x0f,0xb9,
+0xf3,0x00,0x01,0xfa,0x3f,0xb0,0x00,0x8f,0x50,0x9f,0xb6,0xaf,0xc0,0x00,0x7d,0xfe,
+0x90,0x00,0x0a,0x02,0x64,0xfd,0x16,0x66,0x66,0x67,0xf9,0x36,0x01,0x10,0x0e,0x36,
+0x01,0x10,0x7f,0x10,0x02,0x20,0xeb,0x00,0xc7,0x00,0x00,0x13,0x00,0x10,0xc0,0xe0,
+0x00,0x20,0x50,0x00,0x33,0x03,0x03,0xb2,0x00,0x20,0x0d,0xe0,0xac,0x03,0x12,0x70,
+0xe3,0x01,0xa0,0x02,0xfe,0x86,0xaf,0xc0,0x9f,0x40,0x00,0x9f,0x39,0xb4,0x02,0xf1,
+0x03,0x2f,0xc3,0x25,0xfc,0x00,0x3f,0xff,0xfc,0x00,0x1d,0xe7,0x59,0xf9,0x09,0xf2,
+0x00,0x08,0xf4,0xf5,0x01,0x90,0xd0,0x00,0x02,0xf9,0xbf,0x30,0x00,0x8f,0x52,0x2d,
+0x00,0x00,0x36,0x00,0xf2,0x1d,0x00,0x00,0x3b,0xef,0xc4,0x00,0x03,0xfe,0x87,0xdf,
+0x40,0x0b,0xf2,0x00,0x1e,0xd0,0x0f,0xb0,0x00,0x07,0xf3,0x0f,0xa0,0x00,0x05,0xf5,
+0x0e,0xe0,0x00,0x07,0xf6,0x07,0xfb,0x32,0x8f,0xf6,0x00,0x8f,0xff,0xc7,0xf4,0x00,
+0x01,0x32,0x9a,0x00,0xf4,0x05,0xd0,0x00,0x00,0x00,0x9f,0x50,0x00,0x16,0x8d,0xf9,
+0x00,0x00,0x2f,0xea,0x40,0x00,0x8f,0x38,0xe3,0x00,0x01,0x00,0x87,0x8e,0x38,0xf3,
+0x0b,0xd0,0x0b,0xd0,0x00,0x01,0x00,0x90,0x0b,0xf0,0x0b,0xe0,0x0e,0xb0,0x5f,0x40,
+0x15,0x0d,0x00,0xf1,0x12,0x2a,0x30,0x00,0x04,0xbf,0xf3,0x00,0x5c,0xfe,0x82,0x03,
+0xef,0xb5,0x00,0x00,0x4f,0xe6,0x10,0x00,0x00,0x29,0xff,0xa3,0x00,0x00,0x01,0x8e,
+0xfd,0x20,0x00,0x00,0x07,0xe4,0x33,0x00,0xda,0x12,0x22,0x22,0x22,0x09,0xff,0xff,
+0xff,0xf2,0x35,0x55,0x55,0x55,0x12,0x00,0x10,0x25,0x12,0x00,0x10,0x97,0x0c,0x02,
+0xd0,0xff,0x92,0x00,0x00,0x03,0x9f,0xfb,0x40,0x00,0x00,0x06,0xcf,0xd1,0x46,0x00,
+0xb5,0x20,0x06,0xcf,0xe8,0x10,0x7f,0xfc,0x60,0x00,0x0b,0xa3,0x7d,0x00,0xe2,0x8d,
+0xfd,0x80,0x00,0xbf,0xb8,0xbf,0xa0,0x3f,0x90,0x00,0xbf,0x10,0x31,0x5b,0x01,0x10,
+0xde,0xc0,0x00,0xa1,0x60,0x00,0x00,0x9f,0x80,0x00,0x00,0x5f,0x90,0x00,0x6a,0x02,
+0x24,0x00,0x34,0x32,0x00,0x10,0x7d,0x18,0x05,0x20,0xe2,0x00,0x37,0x03,0x30,0x9d,
+0xff,0xd9,0x81,0x01,0x40,0x07,0xfb,0x63,0x35,0x2c,0x00,0x10,0x09,0x9d,0x00,0x70,
+0x2d,0x90,0x00,0x05,0xf3,0x00,0x00,0x7b,0x05,0xf3,0x40,0x00,0xe8,0x00,0x06,0xde,
+0xb3,0x00,0x99,0x00,0x4f,0x10,0x08,0xf6,0x3c,0xc0,0x04,0xe0,0x09,0xc0,0x02,0xf6,
+0x00,0xba,0x00,0x2f,0x00,0xc9,0x00,0x8e,0x00,0x0c,0x90,0x01,0xf1,0x0e,0x70,0x0c,
+0xb0,0x00,0xe7,0x00,0x1f,0x10,0xd7,0x00,0xd9,0x00,0x0f,0x60,0x03,0xe0,0x0c,0x80,
+0x0d,0xa0,0x03,0xf5,0x00,0x9a,0x00,0xab,0x00,0x8f,0x43,0xce,0xb2,0x6f,0x20,0x05,
+0xf1,0x01,0xbf,0xc3,0x3d,0xfc,0x40,0x00,0x0e,0x90,0x80,0x00,0x24,0x4f,0x70,0x09,
+0x00,0x40,0xc6,0x32,0x47,0x60,0x09,0x00,0x41,0x18,0xcf,0xfd,0xb4,0x12,0x00,0x21,
+0x0c,0xf2,0x97,0x00,0x11,0xff,0x2b,0x00,0x30,0x9f,0xae,0x00,0x8d,0x01,0x20,0x93,
+0xf5,0x0c,0x02,0x20,0xf3,0x0d,0x1c,0x02,0xf1,0x03,0xcd,0x00,0x6f,0x20,0x00,0x00,
+0x2f,0x70,0x01,0xf8,0x00,0x00,0x08,0xf3,0x22,0x2b,0xe0,0x00,0x32,0x06,0xa0,0x50,
+0x00,0x5f,0x75,0x55,0x55,0xec,0x00,0x0b,0xe0,0x5c,0x02,0x10,0x02,0x63,0x02,0x41,
+0x3f,0x80,0x8f,0x40,0x0a,0x01,0xf0,0x04,0x7f,0xff,0xff,0xd8,0x00,0x7f,0xa7,0x77,
+0xcf,0xc0,0x7f,0x50,0x00,0x0b,0xf3,0x7f,0x50,0x00,0x07,0x02,0x04,0xf0,0x38,0x09,
+0xf3,0x7f,0x61,0x12,0x7f,0xb0,0x7f,0xff,0xff,0xfd,0x10,0x7f,0x84,0x44,0x7e,0xd1,
+0x7f,0x50,0x00,0x04,0xf9,0x7f,0x50,0x00,0x01,0xfb,0x7f,0x50,0x00,0x06,0xf9,0x7f,
+0x96,0x67,0xaf,0xe2,0x7f,0xff,0xff,0xd9,0x10,0x00,0x29,0xef,0xea,0x30,0x00,0x4f,
+0xf9,0x79,0xef,0x50,0x1e,0xe1,0x00,0x01,0xee,0x07,0xf6,0x00,0x00,0x08,0xf5,0xbf,
+0x10,0x00,0x00,0x14,0x2d,0xf0,0xa2,0x00,0x24,0xee,0x00,0xa8,0x02,0x71,0x00,0xcf,
+0x00,0x00,0x00,0x13,0x18,0x21,0x00,0x10,0x1f,0x2c,0x00,0x80,0x00,0x5f,0xe9,0x79,
+0xef,0x50,0x00,0x3a,0x42,0x00,0xb0,0x7f,0xff,0xfd,0xa3,0x00,0x07,0xfa,0x77,0x9e,
+0xf7,0x00,0x8a,0x00,0x30,0xf4,0x07,0xf5,0x6a,0x02,0xb0,0x7f,0x50,0x00,0x00,0x9f,
+0x27,0xf5,0x00,0x00,0x07,0xf4,0x0b,0x00,0x25,0x6f,0x57,0x0b,0x00,0x10,0xaf,0x16,
+0x00,0x20,0x1f,0xd0,0x2c,0x00,0x62,0xf5,0x07,0xf9,0x66,0x9e,0xf7,0x42,0x00,0x00,
+0xd1,0x00,0x80,0xff,0xf1,0x7f,0xa7,0x77,0x77,0x70,0x7f,0x2a,0x03,0x07,0x05,0x00,
+0x31,0x61,0x11,0x11,0x1e,0x00,0x6c,0x30,0x7f,0x84,0x44,0x44,0x00,0x1e,0x00,0x50,
+0x96,0x66,0x66,0x61,0x7f,0x61,0x02,0x10,0x7f,0x7f,0x07,0x40,0xfa,0x77,0x77,0x76,
+0x18,0x00,0x23,0x07,0xf5,0x21,0x00,0x50,0x07,0xf6,0x11,0x11,0x10,0x1b,0x00,0x5a,
+0x07,0xf8,0x44,0x44,0x40,0x1b,0x00,0x14,0xf5,0x45,0x00,0xf0,0x09,0x00,0x3a,0xef,
+0xeb,0x40,0x00,0x5f,0xe9,0x78,0xef,0x70,0x1f,0xe1,0x00,0x00,0xcf,0x28,0xf5,0x00,
+0x00,0x03,0x94,0xbf,0x10,0x01,0x01,0xf0,0x01,0xf0,0x00,0x01,0x11,0x10,0xee,0x00,
+0x05,0xff,0xff,0x8d,0xf0,0x00,0x14,0x47,0xf8,0x16,0x00,0xf1,0x08,0x3f,0x86,0xf7,
+0x00,0x00,0x03,0xf8,0x0e,0xf3,0x00,0x00,0x5f,0x80,0x3e,0xfa,0x77,0xaf,0xe2,0x00,
+0x18,0xdf,0xfd,0x81,0x4d,0x00,0x20,0x0d,0xf7,0x57,0x00,0x1d,0xdf,0x0b,0x00,0x61,
+0xf6,0x11,0x11,0x11,0xdf,0x7f,0x24,0x08,0x5f,0xf8,0x44,0x44,0x44,0xef,0x2c,0x00,
+0x08,0x4c,0xf0,0x4f,0x74,0xf7,0x03,0x00,0x10,0x70,0x47,0x02,0x1f,0xf0,0x05,0x00,
+0x15,0xf0,0x04,0x5c,0x30,0x00,0x0d,0xf0,0x5f,0x90,0x00,0x3f,0xc0,0x0c,0xfb,0x79,
+0xff,0x30,0x00,0x8d,0xff,0xb3,0x9d,0x00,0xf0,0x07,0x02,0xee,0x27,0xf5,0x00,0x02,
+0xee,0x20,0x7f,0x50,0x01,0xdf,0x30,0x07,0xf5,0x01,0xdf,0x40,0x00,0x7f,0x50,0xcf,
+0x3b,0x02,0xf0,0x04,0xcf,0x70,0x00,0x00,0x7f,0xef,0xfc,0x00,0x00,0x07,0xff,0x78,
+0xf9,0x00,0x00,0x7f,0x80,0x0c,0xf5,0x20,0x01,0x20,0x1e,0xf3,0x37,0x00,0x20,0x3f,
+0xd1,0x2b,0x01,0x21,0x6f,0xb0,0xd5,0x01,0x1e,0x80,0x44,0x01,0x0f,0x09,0x00,0x0d,
+0x00,0x2d,0x06,0x00,0xfa,0x00,0x30,0xc0,0x7f,0xf1,0x26,0x05,0x30,0xff,0x07,0xff,
+0xce,0x00,0x40,0xef,0xf0,0x7f,0xfe,0xbb,0x05,0xf0,0x25,0xff,0x07,0xf9,0xf5,0x00,
+0x00,0x0c,0xea,0xf0,0x7f,0x4f,0xb0,0x00,0x02,0xf8,0xaf,0x07,0xf4,0x9f,0x20,0x00,
+0x9f,0x2b,0xf0,0x7f,0x42,0xf9,0x00,0x0f,0xb0,0xbf,0x07,0xf5,0x0b,0xf0,0x06,0xf4,
+0x0c,0xf0,0x7f,0x50,0x4f,0x60,0xdd,0x00,0xcf,0x07,0xf5,0x00,0xdd,0x4f,0x60,0x0f,
+0x00,0x31,0x07,0xfd,0xf0,0x0f,0x00,0x30,0x1f,0xf9,0x00,0x0f,0x00,0x80,0x00,0x9f,
+0x20,0x00,0xcf,0x00,0x7f,0xb0,0x4b,0x01,0x20,0xff,0x50,0x4b,0x01,0x70,0xff,0x10,
+0x00,0x0d,0xf7,0xfa,0xfb,0x0b,0x00,0x20,0x59,0xf6,0x61,0x01,0x20,0x0e,0xf2,0x61,
+0x01,0x20,0x4f,0xc0,0x6c,0x01,0x20,0x9f,0x60,0x6c,0x01,0x70,0xdf,0x2d,0xf7,0xf5,
+0x00,0x03,0xfc,0x0b,0x00,0x20,0x08,0xff,0x82,0x01,0x20,0x0d,0xff,0xb2,0x00,0xf0,
+0x09,0x3f,0xf0,0x00,0x29,0xdf,0xe9,0x20,0x00,0x3f,0xfa,0x8a,0xff,0x40,0x1e,0xe2,
+0x00,0x02,0xee,0x17,0xf6,0x00,0x00,0x05,0xf7,0xfc,0x01,0x30,0x0f,0xcd,0xe0,0x81,
+0x03,0x10,0xed,0x1c,0x02,0x20,0xfd,0xe0,0x28,0x03,0x01,0x16,0x00,0x20,0xc7,0xf7,
+0x21,0x00,0xf0,0x01,0x1e,0xe2,0x00,0x01,0xdf,0x10,0x3f,0xfa,0x89,0xff,0x50,0x00,
+0x29,0xdf,0xea,0x20,0xb8,0x02,0x80,0xeb,0x30,0x07,0xfa,0x77,0x79,0xff,0x50,0x80,
+0x01,0x10,0xfe,0x15,0x01,0x20,0x09,0xf3,0x64,0x00,0x20,0x8f,0x47,0x6f,0x00,0x80,
+0xf1,0x7f,0x61,0x11,0x3b,0xfa,0x07,0xff,0x7e,0x08,0x42,0x7f,0x84,0x44,0x30,0x36,
+0x01,0x02,0x96,0x02,0x06,0x0b,0x00,0x00,0x80,0x05,0x50,0xef,0xd9,0x20,0x00,0x4f,
+0x90,0x00,0x10,0x1f,0x90,0x00,0x60,0x18,0xf5,0x00,0x00,0x06,0xf6,0x98,0x03,0x20,
+0x1f,0xbe,0xb5,0x05,0x20,0xed,0xfc,0x54,0x04,0x20,0xee,0xd0,0xe6,0x06,0x10,0xdf,
+0x16,0x00,0x20,0xb8,0xf6,0xfc,0x02,0xf1,0x01,0x1f,0xe1,0x00,0x02,0xee,0x10,0x4f,
+0xf9,0x8a,0xfe,0x30,0x00,0x2a,0xef,0xef,0xd2,0x2c,0x07,0x01,0x32,0x07,0x12,0x2c,
+0x57,0x00,0x01,0x0b,0x04,0x61,0x07,0xfa,0x77,0x7b,0xfe,0x20,0x20,0x04,0x10,0x07,
+0x9d,0x03,0x00,0xe9,0x01,0xf0,0x04,0x03,0xf9,0x07,0xf6,0x11,0x26,0xef,0x20,0x7f,
+0xff,0xff,0xfc,0x30,0x07,0xf8,0x44,0x8f,0x70,0x00,0x30,0x01,0x60,0x10,0x07,0xf5,
+0x00,0x05,0xf8,0x0b,0x00,0x40,0x0d,0xf1,0x07,0xf5,0x87,0x05,0x00,0xa0,0x00,0xd0,
+0xcf,0x10,0x00,0x18,0xdf,0xeb,0x40,0x00,0x2e,0xfa,0x78,0xdf,0x80,0x25,0x08,0x90,
+0xbf,0x30,0xcf,0x00,0x00,0x04,0xe6,0x09,0xf7,0x64,0x00,0x30,0x1d,0xfc,0x61,0x0a,
+0x07,0x20,0xdf,0xfc,0x73,0x00,0x40,0x27,0xdf,0xa0,0x00,0x45,0x08,0x80,0x52,0xe8,
+0x00,0x00,0x04,0xf8,0x0e,0xe2,0xd2,0x05,0xc0,0x4f,0xfa,0x78,0xbf,0xd0,0x00,0x19,
+0xdf,0xec,0x70,0x00,0x8f,0x21,0x03,0x90,0xe3,0x77,0x78,0xfc,0x77,0x76,0x00,0x00,
+0x3f,0x30,0x05,0x10,0x03,0xf7,0x04,0x0f,0x0b,0x00,0x1e,0x00,0x94,0x01,0x7f,0xbf,
+0x1b,0xf1,0x00,0x00,0x0b,0xf1,0x0b,0x00,0x13,0x30,0x19,0xf3,0x00,0x33,0x03,0xf0,
+0x09,0xa0,0x00,0x05,0xfb,0x00,0xbf,0xc8,0x7a,0xfe,0x20,0x00,0x6c,0xff,0xd8,0x00,
+0x00,0x8f,0x60,0x00,0x00,0x04,0xfa,0x2f,0xb0,0xfc,0x08,0xe1,0x0c,0xf1,0x00,0x00,
+0x0f,0xd0,0x06,0xf6,0x00,0x00,0x5f,0x70,0x00,0xfc,0x64,0x00,0x90,0x9f,0x20,0x01,
+0xfb,0x00,0x00,0x3f,0x70,0x06,0xcc,0x01,0xd1,0xd0,0x0c,0xe0,0x00,0x00,0x07,0xf3,
+0x1f,0x90,0x00,0x00,0x01,0xf8,0x02,0x08,0x26,0xbe,0xdc,0x71,0x01,0x21,0x0e,0xf1,
+0x38,0x00,0xf0,0x04,0x05,0xf7,0x00,0x00,0x7f,0x51,0xfb,0x00,0x00,0xaf,0xb0,0x00,
+0x0b,0xf1,0x0d,0xe0,0x00,0x0e,0xff,0x44,0x0b,0xf0,0x2a,0x8f,0x20,0x03,0xf9,0xf4,
+0x00,0x2f,0x90,0x04,0xf6,0x00,0x8f,0x1e,0x90,0x06,0xf5,0x00,0x1f,0xa0,0x0d,0xb0,
+0xae,0x00,0xaf,0x10,0x00,0xce,0x01,0xf6,0x05,0xf2,0x0e,0xc0,0x00,0x08,0xf2,0x6f,
+0x20,0x1f,0x71,0xf8,0x00,0x00,0x4f,0x6b,0xd0,0x00,0xcb,0x5f,0x40,0x00,0x01,0xf9,
+0xf8,0x00,0x07,0xf9,0x5c,0x0a,0x50,0xef,0x30,0x00,0x3f,0xec,0x81,0x0a,0x00,0x38,
+0x06,0xb0,0x80,0x00,0x00,0x04,0xf9,0x00,0x00,0x09,0xf4,0x00,0x00,0xcc,0x04,0xd0,
+0x2f,0xe1,0x06,0xfa,0x00,0x00,0xbf,0x50,0x00,0xbf,0x50,0x06,0xfa,0x13,0x00,0x80,
+0x1e,0xe1,0x00,0x00,0x06,0xf9,0xaf,0x50,0xd3,0x09,0x11,0xfa,0xaf,0x06,0x11,0xf3,
+0xe3,0x05,0x10,0xfb,0x72,0x02,0xf0,0x15,0xf9,0xaf,0x60,0x00,0x00,0x2f,0xe0,0x1e,
+0xf1,0x00,0x00,0xcf,0x40,0x05,0xfb,0x00,0x07,0xf9,0x00,0x00,0xaf,0x60,0x2f,0xe1,
+0x00,0x00,0x1e,0xf1,0x9f,0x70,0x00,0x00,0x1f,0xe0,0x1e,0xe0,0xb2,0x01,0xf1,0x02,
+0x06,0xf8,0x00,0x02,0xfc,0x00,0x00,0xdf,0x10,0x0a,0xf3,0x00,0x00,0x4f,0x80,0x2f,
+0xa0,0x48,0x01,0x61,0x20,0x00,0x00,0x02,0xfc,0xf8,0xe4,0x06,0x15,0xe0,0x94,0x01,
+0x0f,0x06,0x00,0x04,0x20,0x1f,0xff,0xe1,0x06,0x40,0x77,0x77,0x77,0x7f,0x1c,0x07,
+0x01,0x29,0x02,0x20,0x04,0xfb,0x99,0x0c,0x23,0xee,0x10,0x6d,0x0a,0x30,0x00,0x7f,
+0x90,0x2c,0x00,0x10,0xd0,0x69,0x03,0x01,0x24,0x00,0x10,0xf6,0x31,0x07,0x10,0xfa,
+0x24,0x00,0x60,0xef,0x76,0x66,0x66,0x64,0x3f,0x42,0x00,0x9f,0xa0,0x01,0x11,0xaf,
+0xfd,0xaf,0x53,0xaf,0x10,0x02,0x00,0x08,0x90,0x21,0xaf,0xfd,0x24,0x43,0x6f,0x30,
+0x00,0x00,0x9a,0x01,0x50,0x0a,0xe0,0x00,0x00,0x04,0x59,0x03,0x10,0xdb,0x62,0x00,
+0x20,0x20,0x00,0x6e,0x0c,0x01,0x61,0x07,0x23,0x05,0xf4,0xb3,0x09,0x20,0x8f,0x10,
+0x8b,0x07,0x10,0x00,0x47,0x0c,0x02,0xbf,0x09,0x8f,0x74,0x11,0x10,0xef,0xf9,0x45,
+0xf9,0x02,0x02,0x00,0x08,0x90,0x13,0xf9,0xef,0xf9,0x44,0x42,0x00,0x05,0x50,0x23,
+0x01,0xf0,0x0e,0x00,0x00,0x7f,0xf6,0x00,0x00,0xe9,0xbd,0x00,0x05,0xf3,0x4f,0x30,
+0x0c,0xc0,0x0e,0xa0,0x3f,0x60,0x07,0xf1,0x11,0x11,0x11,0x11,0x0f,0xff,0xff,0xff,
+0xfc,0x05,0xf1,0x07,0x44,0x20,0x17,0x60,0x00,0x8f,0x40,0x00,0x8e,0x10,0x03,0xbe,
+0xfd,0x60,0x03,0xfd,0x76,0xcf,0x60,0x9d,0x10,0x00,0x41,0x0d,0xf1,0x0e,0xe0,0x04,
+0xbe,0xff,0xff,0x07,0xfb,0x53,0x3c,0xf0,0xed,0x00,0x00,0xcf,0x0e,0xd0,0x00,0x2e,
+0xf0,0x8f,0xc8,0x9f,0xff,0x00,0x7d,0xfd,0x58,0xd2,0xbf,0x94,0x09,0x00,0x1e,0x01,
+0x05,0x09,0x00,0xf0,0x02,0x3c,0xfe,0xa1,0x0b,0xff,0x97,0xbf,0xd0,0xbf,0x40,0x00,
+0x9f,0x6b,0xf0,0x00,0x01,0xfa,0xa7,0x0a,0xf0,0x1c,0xcb,0xf0,0x00,0x00,0xfc,0xbf,
+0x00,0x00,0x2f,0xab,0xf5,0x00,0x09,0xf5,0xbf,0xf9,0x7b,0xfc,0x0b,0xe3,0xcf,0xea,
+0x10,0x00,0x19,0xef,0xc6,0x00,0x01,0xef,0x86,0xbf,0x90,0x0a,0xf3,0x00,0x0a,0xf1,
+0x0f,0xc0,0x00,0x02,0x72,0x12,0x01,0x01,0x17,0x01,0x00,0x20,0x0d,0x30,0x01,0x31,
+0x0a,0x2e,0x0d,0x91,0x02,0xef,0x86,0xaf,0x80,0x00,0x2a,0xef,0xd6,0x19,0x0e,0x1c,
+0xf5,0x05,0x00,0xf4,0x06,0x3b,0xfe,0xa7,0xf5,0x02,0xff,0x97,0xbf,0xf5,0x0a,0xf4,
+0x00,0x09,0xf5,0x0f,0xd0,0x00,0x05,0xf5,0x1f,0xa0,0x05,0x00,0xf0,0x19,0x0f,0xc0,
+0x00,0x05,0xf5,0x0a,0xf2,0x00,0x08,0xf5,0x02,0xfe,0x64,0x9f,0xf5,0x00,0x2b,0xff,
+0xb6,0xf5,0x00,0x19,0xef,0xd6,0x00,0x01,0xdf,0x86,0xbf,0x70,0x09,0xf3,0x00,0x0b,
+0xf0,0x0e,0xc1,0x11,0x17,0xf4,0xfe,0x01,0x80,0xf5,0x1f,0xb4,0x44,0x44,0x41,0x0f,
+0xc0,0x13,0x0a,0xe0,0xf5,0x00,0x02,0x70,0x01,0xef,0x96,0x8f,0xd0,0x00,0x19,0xef,
+0xe9,0x10,0x9f,0x0e,0x70,0x00,0x9f,0xf9,0x00,0x7f,0xa5,0x30,0xd0,0x06,0x10,0xdd,
+0xdc,0x0b,0x71,0xf0,0x24,0xee,0x44,0x00,0x0d,0xd0,0x43,0x0b,0x0f,0x07,0x00,0x02,
+0x50,0x00,0x3b,0xfe,0xa5,0xf6,0x99,0x00,0x10,0xf6,0x99,0x00,0x10,0xf6,0x99,0x00,
+0x34,0xf6,0x1f,0xa0,0x05,0x00,0x01,0x0f,0x00,0x01,0x19,0x00,0x01,0x23,0x00,0x01,
+0xc6,0x00,0x10,0x00,0x93,0x08,0xf0,0x00,0x01,0x80,0x00,0x0d,0xf1,0x05,0xfc,0x77,
+0xcf,0x80,0x00,0x3b,0xef,0xc6,0x00,0x96,0xbf,0x00,0x00,0x00,0x0b,0xf0,0x00,0x00,
+0x00,0x09,0x00,0xfe,0x0b,0x2b,0xfe,0xa1,0x0b,0xfe,0xa7,0xaf,0xb0,0xbf,0x60,0x00,
+0xbf,0x0b,0xf0,0x00,0x08,0xf2,0xbf,0x00,0x00,0x8f,0x3b,0xf0,0x00,0x08,0xf3,0x09,
+0x00,0x87,0x7f,0x26,0xe2,0x00,0x08,0xf2,0x8f,0x28,0x03,0x00,0xef,0x20,0x00,0x9e,
+0x10,0x08,0xd1,0x00,0x00,0x00,0x0a,0xf1,0x00,0xaf,0x10,0x05,0x00,0x05,0x57,0x04,
+0x8f,0xd0,0x8f,0xc3,0x75,0x00,0x06,0x09,0x00,0xf9,0x1c,0x06,0xfa,0x0b,0xf0,0x05,
+0xfb,0x00,0xbf,0x05,0xfc,0x00,0x0b,0xf4,0xfd,0x10,0x00,0xbf,0xef,0x80,0x00,0x0b,
+0xfd,0xcf,0x40,0x00,0xbf,0x22,0xee,0x10,0x0b,0xf0,0x04,0xfb,0x00,0xbf,0x00,0x08,
+0xf7,0x0b,0xf0,0x00,0x0c,0xf3,0x78,0x00,0x04,0x03,0x00,0xf0,0x0f,0xbe,0x3b,0xff,
+0xa1,0x2b,0xfe,0xb2,0x0b,0xfe,0x87,0xbf,0xcf,0xa7,0x9f,0xd0,0xbf,0x30,0x00,0xcf,
+0x80,0x00,0x9f,0x3b,0xf0,0x00,0x09,0xf3,0x00,0x06,0xf5,0xba,0x00,0x40,0x30,0x00,
+0x5f,0x5b,0xbd,0x00,0x2f,0x00,0x05,0x0f,0x00,0x0d,0x0f,0x0b,0x01,0x19,0xf1,0x0f,
+0x00,0x19,0xef,0xd8,0x00,0x01,0xdf,0x96,0xaf,0xc0,0x09,0xf4,0x00,0x07,0xf7,0x0f,
+0xc0,0x00,0x00,0xfc,0x1f,0xa0,0x00,0x00,0xcf,0x1f,0x90,0x00,0x00,0xdf,0x0f,0x00,
+0x10,0x0a,0x19,0x00,0xfe,0x28,0x01,0xef,0x96,0xaf,0xc0,0x00,0x19,0xef,0xd7,0x00,
+0xbe,0x5c,0xfe,0x91,0x0b,0xfe,0x64,0x9f,0xc0,0xbf,0x20,0x00,0x8f,0x5b,0xf0,0x00,
+0x02,0xfa,0xbf,0x00,0x00,0x0f,0xcb,0xf0,0x00,0x00,0xfc,0xbf,0x00,0x00,0x2f,0xab,
+0xf3,0x00,0x0a,0xf5,0xbf,0xe8,0x6b,0xfc,0x0b,0xf4,0xcf,0xea,0x10,0x2b,0x01,0xf4,
+0x07,0x00,0x3b,0xfe,0xa6,0xf5,0x02,0xff,0x86,0xaf,0xf5,0x0b,0xf4,0x00,0x08,0xf5,
+0x0f,0xd0,0x00,0x06,0xf5,0x1f,0xa0,0x05,0x00,0x60,0x0f,0xc0,0x00,0x06,0xf5,0x0a,
+0x19,0x00,0x01,0x23,0x00,0xae,0x00,0x3b,0xff,0xa7,0xf5,0x00,0x00,0x00,0x06,0xf5,
+0x05,0x00,0x80,0xbf,0x5d,0xf2,0xbf,0xf9,0x71,0xbf,0x40,0x5b,0x00,0x0e,0x03,0x00,
+0xf0,0x23,0x00,0x4c,0xfe,0xb4,0x00,0x5f,0xc6,0x7e,0xf4,0x0b,0xf0,0x00,0x2f,0xb0,
+0xaf,0x50,0x00,0x00,0x01,0xcf,0xea,0x50,0x00,0x00,0x38,0xcf,0xe3,0x02,0x10,0x00,
+0x3f,0xb0,0xfc,0x00,0x00,0xec,0x07,0xfc,0x66,0xcf,0x60,0x05,0xcf,0xfc,0x50,0x00,
+0x85,0x00,0x01,0xfa,0x03,0x00,0x62,0xef,0xff,0xf8,0x45,0xfb,0x42,0x0c,0x00,0x08,
+0x03,0x00,0x60,0x00,0xef,0x74,0x00,0x4d,0xf7,0x35,0x01,0x14,0x2b,0x50,0x01,0x0e,
+0x09,0x00,0xf0,0x6e,0x29,0xf3,0x00,0x0c,0xf2,0x3f,0xe7,0x8d,0xff,0x20,0x5d,0xfe,
+0x98,0xf2,0x8f,0x30,0x00,0x1f,0xa2,0xf9,0x00,0x06,0xf4,0x0c,0xe0,0x00,0xbe,0x00,
+0x6f,0x30,0x1f,0x90,0x01,0xf9,0x06,0xf3,0x00,0x0b,0xe0,0xbd,0x00,0x00,0x5f,0x5f,
+0x80,0x00,0x00,0xfe,0xf2,0x00,0x00,0x09,0xfc,0x00,0x00,0x00,0x3f,0x60,0x00,0x7f,
+0x30,0x00,0xbe,0x00,0x00,0xfa,0x2f,0x80,0x01,0xff,0x40,0x04,0xf6,0x0d,0xc0,0x05,
+0xfe,0x90,0x08,0xf1,0x09,0xf0,0x0a,0xb9,0xe0,0x0c,0xc0,0x04,0xf4,0x0f,0x64,0xf3,
+0x0f,0x80,0x00,0xf8,0x4f,0x10,0xe8,0x4f,0x30,0x00,0xbd,0x9c,0x00,0x9d,0x8e,0x00,
+0x00,0x6f,0xf7,0x00,0x4f,0xea,0x00,0x00,0x1f,0xf2,0x00,0x0f,0xf5,0x00,0x00,0x0d,
+0xd0,0xb8,0x02,0xf0,0x44,0x3f,0xc0,0x00,0x6f,0x80,0x8f,0x60,0x1f,0xd0,0x00,0xde,
+0x1a,0xf3,0x00,0x03,0xfc,0xf9,0x00,0x00,0x08,0xfd,0x00,0x00,0x00,0x9f,0xe1,0x00,
+0x00,0x4f,0xaf,0xa0,0x00,0x0e,0xe0,0x8f,0x50,0x09,0xf4,0x00,0xee,0x14,0xfa,0x00,
+0x04,0xfa,0x9f,0x30,0x00,0x3f,0x94,0xf9,0x00,0x08,0xf3,0x0e,0xe0,0x00,0xde,0x00,
+0x8f,0x40,0x3f,0x80,0x02,0xf9,0x08,0xf2,0x00,0x0c,0xe0,0xdd,0x00,0x00,0x7f,0x6f,
+0x70,0x00,0x01,0xff,0xf2,0x00,0x00,0x0b,0xa0,0x00,0xf1,0x5c,0x5f,0x60,0x00,0x00,
+0x07,0xf1,0x00,0x00,0x00,0xdb,0x00,0x00,0x18,0xcf,0x30,0x00,0x03,0xfd,0x50,0x00,
+0x00,0x1f,0xff,0xff,0xff,0x80,0x66,0x66,0x6e,0xf4,0x00,0x00,0x07,0xf8,0x00,0x00,
+0x03,0xfb,0x00,0x00,0x01,0xee,0x10,0x00,0x00,0xbf,0x40,0x00,0x00,0x7f,0x80,0x00,
+0x00,0x3f,0xb0,0x00,0x00,0x1e,0xf7,0x66,0x66,0x43,0xff,0xff,0xff,0xfc,0x00,0x00,
+0x02,0x00,0x00,0x1b,0xf1,0x00,0x0c,0xe2,0x00,0x03,0xf8,0x00,0x00,0x6f,0x50,0x00,
+0x07,0xf4,0x00,0x00,0x7f,0x40,0x00,0x08,0xf2,0x00,0x04,0xed,0x00,0x06,0xff,0x20,
+0x00,0x17,0xfb,0x00,0x00,0x09,0xf2,0x15,0x00,0x00,0x1c,0x00,0x51,0x6f,0x40,0x00,
+0x04,0xf7,0xd8,0x00,0x8a,0x00,0x2e,0xd1,0x00,0x00,0x05,0x00,0x6f,0x01,0x00,0xf1,
+0x15,0x38,0x10,0x00,0x00,0xae,0x40,0x00,0x0a,0xf2,0x00,0x01,0xf9,0x00,0x00,0xec,
+0x00,0x00,0xed,0x00,0x00,0xdd,0x00,0x00,0xcf,0x00,0x00,0x6f,0x81,0x00,0x09,0xfd,
+0x00,0x4f,0xb4,0x00,0xbf,0x12,0x00,0x11,0xed,0x1e,0x00,0xf0,0x18,0xfa,0x00,0x08,
+0xf4,0x00,0x8f,0x70,0x00,0x31,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x10,0x8f,0xfd,
+0x50,0x00,0xc9,0x6f,0x86,0xdf,0x93,0x7f,0x5b,0xc0,0x00,0x9f,0xff,0x90,0x00,0x00,
+0x00,0x14,0x20,0x00,0x01,0x00,0x22,0x50,0x00,0x01,0x00,0x22,0x3f,0x30,0x08,0x00,
+0x22,0x0b,0xfb,0x08,0x00,0x32,0x04,0xff,0xf4,0x09,0x00,0x31,0xcf,0xdf,0xc0,0x08,
+0x00,0x31,0x5f,0xe1,0xef,0x2c,0x00,0x40,0x0d,0xf6,0x06,0xfd,0x08,0x00,0x50,0x05,
+0xfd,0x00,0x0d,0xf5,0x09,0x00,0xf0,0x0b,0xdf,0x50,0x00,0x5f,0xd0,0x00,0x00,0x00,
+0x6f,0xc0,0x00,0x00,0xcf,0x60,0x00,0x00,0x0e,0xf4,0x00,0x00,0x04,0xfe,0x00,0x00,
+0x07,0xfb,0x4f,0x00,0xd1,0xf7,0x00,0x01,0xff,0x63,0x33,0x33,0x33,0x6f,0xf1,0x00,
+0x8f,0xff,0x01,0x00,0x32,0x80,0x1f,0xff,0x01,0x00,0x10,0x10,0x3e,0x00,0x21,0x02,
+0x89,0x56,0x00,0xf0,0x3a,0x03,0xff,0xff,0xb0,0x00,0x00,0x02,0x40,0xdf,0x30,0x9f,
+0x50,0x00,0x4d,0xff,0x4f,0xa0,0x02,0xf9,0x00,0x7f,0xf9,0x44,0xfe,0x10,0x6f,0x70,
+0x5f,0xd1,0x00,0x7f,0xfe,0xcf,0xe1,0x0e,0xf1,0x00,0x0a,0xff,0xff,0xd2,0x05,0xf7,
+0x00,0x00,0xdf,0xff,0x93,0xf4,0x8f,0x20,0x00,0x0f,0xfe,0x40,0x2f,0x8a,0xf0,0x00,
+0x03,0xfb,0x10,0x00,0xfa,0x8f,0x20,0x00,0x57,0x00,0x00,0x2f,0x85,0xf7,0x4d,0x00,
+0x50,0x07,0xf5,0x0e,0xe1,0x00,0xa1,0x01,0x30,0x00,0x6f,0xc1,0x09,0x03,0xe0,0x60,
+0x00,0x8f,0xe7,0x32,0x37,0xef,0x80,0x00,0x00,0x5e,0xff,0xff,0xfe,0x70,0x00,0x31,
+0x04,0x78,0x74,0xd5,0x00,0x40,0x1a,0xbb,0xbb,0xb7,0x08,0x00,0xf0,0x14,0x40,0x6f,
 0xff,0xff,0x23,0x60,0x00,0x00,0x6f,0x90,0xaf,0xff,0x72,0xef,0x30,0x00,0x13,0xec,
 0x00,0xcf,0xc0,0x1d,0x86,0x30,0x0b,0xf8,0x10,0x02,0xe2,0x00,0x0c,0xfb,0x00,0x9f,
-0x47,0x0f,0x41,0x6a,0x20,0x3a,0xa0,0x38,0x00,0x41,0xef,0x56,0xff,0x00,0x3f,0x09,
-0x22,0xd5,0x04,0x69,0x0f,0x41,0xa7,0x12,0xff,0x40,0x47,0x01,0x31,0xf3,0x0b,0x87,
-0xc4,0x13,0x40,0x66,0x00,0x0b,0xf7,0x26,0x01,0xf0,0x02,0xff,0x30,0x00,0xcd,0x8b,
-0x10,0x00,0x0a,0xb6,0xb0,0x00,0x00,0x1d,0xf8,0xe7,0xeb,0xdf,0x7f,0x00,0x51,0x8a,
-0x8f,0x6f,0xe3,0x80,0x66,0x01,0x21,0x92,0x76,0x07,0x00,0x14,0x60,0x75,0x01,0x40,
-0x99,0xdf,0xec,0x70,0x3f,0x01,0xf0,0x02,0xbf,0xfd,0xbb,0xef,0xe5,0x00,0x02,0xfe,
-0x20,0xbf,0xa0,0x00,0x4e,0xf6,0x00,0x5f,0xc0,0x9a,0x09,0xf0,0x08,0x1d,0xf3,0x00,
-0x9f,0xc1,0x00,0xaf,0x80,0x00,0x1f,0xc0,0x08,0xff,0xd1,0x1e,0xf4,0x00,0x00,0x8f,
-0x20,0xcd,0x6f,0xdd,0x17,0x0e,0x41,0xf6,0x0e,0xb0,0x5f,0xab,0x12,0x21,0x80,0xec,
-0x7c,0x10,0x10,0x02,0x7c,0x05,0x01,0xb7,0x01,0x11,0x50,0xe3,0x11,0x00,0x8d,0x04,
-0x00,0xc4,0x08,0x00,0x27,0x0b,0x30,0x04,0xfc,0x10,0xbf,0x01,0x70,0x10,0x00,0x06,
-0xff,0x84,0x23,0x5b,0x28,0x11,0x51,0x03,0xcf,0xff,0xff,0xf8,0x2f,0x00,0x31,0x26,
-0x77,0x40,0x08,0x00,0x62,0xbd,0xdd,0xdd,0xdd,0xdd,0x40,0x10,0x09,0xe0,0xe0,0x00,
-0x06,0xfe,0x21,0x11,0x13,0xf9,0x00,0x00,0xbf,0x80,0x00,0x00,0x79,0x01,0x11,0xf2,
-0x3e,0x12,0x61,0x04,0xfd,0x00,0x00,0x08,0xf6,0x44,0x0a,0x90,0x0a,0xf9,0x00,0x00,
-0x02,0xcf,0x60,0x1d,0xe4,0x50,0x10,0x11,0xec,0x58,0x13,0x50,0xdf,0x4c,0x90,0xff,
-0x80,0x87,0x09,0xf0,0x05,0xf4,0x6d,0xde,0x00,0x00,0x06,0xf3,0x3f,0x0c,0x59,0xf1,
-0x00,0x00,0x6f,0x53,0x60,0x10,0xaf,0x00,0x00,0xa0,0x0a,0x00,0xbf,0x0a,0x51,0x09,
-0xfb,0x31,0x5e,0xf3,0x7e,0x11,0x21,0xff,0xf5,0x07,0x02,0x31,0x89,0x71,0x00,0x16,
-0x02,0x40,0x77,0x77,0x60,0x00,0x77,0x16,0xf1,0x02,0xfe,0x00,0x00,0x01,0x15,0xff,
-0xff,0xe2,0x33,0x0e,0xff,0xff,0xfe,0xee,0xee,0xf4,0xf2,0xb9,0x10,0x11,0x4f,0xbc,
-0x02,0xe1,0xc4,0xe2,0x0e,0xff,0xff,0xf2,0x0c,0x5e,0x20,0x9a,0xaa,0xaa,0x10,0xc5,
-0x35,0x12,0x32,0x0c,0x5e,0x30,0x0d,0x00,0x02,0x1a,0x00,0x01,0xd4,0x02,0x03,0x1a,
-0x00,0x30,0x5d,0xee,0xee,0xdf,0x07,0x63,0x12,0x26,0xff,0xff,0xe1,0x10,0x5b,0x00,
-0x43,0x00,0x01,0x55,0x55,0x01,0x03,0x30,0x03,0x44,0x10,0x10,0x00,0xf0,0x08,0x9f,
-0xff,0xff,0xc2,0xa3,0x00,0x04,0xef,0xff,0xee,0xff,0x5e,0xf8,0x03,0xff,0xe6,0x00,
-0x01,0x40,0xe5,0xbe,0xef,0xc1,0xeb,0x01,0x21,0x30,0x5e,0x93,0x0a,0x12,0xe3,0x17,
-0x0a,0x60,0x0e,0x30,0x00,0x03,0xcc,0x20,0x0f,0x00,0x31,0x00,0x2d,0xb1,0x0f,0x00,
-0x21,0x6f,0x70,0x1e,0x00,0x20,0xae,0x30,0x1e,0x00,0x40,0x32,0xdf,0xe1,0x00,0x42,
-0x15,0x30,0xf8,0xef,0xb0,0x0f,0x00,0x82,0xe4,0x04,0xff,0xd6,0x00,0x02,0x40,0x91,
-0x5a,0x00,0x12,0x50,0x69,0x00,0x11,0xc1,0x78,0x00,0x50,0x54,0x10,0x00,0x0d,0xee,
-0x01,0x00,0xa0,0xed,0x01,0xf2,0x4f,0xfa,0x22,0x22,0x22,0xe1,0x1f,0x93,0x11,0xf2,
-0x1a,0x79,0xaf,0x11,0xf0,0x03,0x31,0x02,0xcf,0xff,0xf1,0x1f,0x00,0x12,0x04,0xff,
-0xff,0xff,0x11,0xf0,0x1f,0xfa,0x05,0xdf,0xff,0xf1,0x1f,0x02,0xff,0xb0,0x00,0x7a,
-0x9f,0x11,0xf0,0x09,0xa5,0x00,0x00,0x00,0xe1,0x1f,0x88,0x02,0x41,0x11,0xf0,0x1f,
-0xf9,0x0f,0x00,0x00,0x1e,0x00,0x00,0x0f,0x00,0x22,0x1b,0xc7,0x1e,0x00,0x22,0x67,
-0x40,0x1e,0x00,0x11,0xfb,0x0f,0x00,0x12,0x01,0x1e,0x00,0x90,0xfe,0xef,0xff,0xee,
-0xee,0xee,0xf0,0x01,0x22,0x01,0x00,0x10,0x21,0xf8,0x00,0x41,0x58,0x98,0x51,0x00,
-0x06,0x0f,0x02,0x09,0x02,0xf0,0x00,0x1d,0xfc,0x7f,0x3e,0x5b,0xfc,0x10,0x00,0x0c,
-0xf7,0x02,0xf3,0xe0,0x07,0xfc,0xf4,0x04,0xf0,0x35,0x2f,0x3e,0x00,0x07,0xf7,0x00,
-0xed,0x00,0x02,0xf3,0xe0,0x00,0x0d,0xe0,0x3f,0x70,0x00,0x2f,0xfd,0x00,0x00,0x6f,
-0x35,0xf4,0x00,0x00,0x22,0x15,0x20,0x03,0xf5,0x6f,0x30,0x07,0xf4,0x04,0xff,0x60,
-0x2f,0x65,0xf5,0x09,0xe8,0xf2,0xdb,0x4e,0xb6,0xf5,0x1f,0xab,0xd3,0xcc,0x03,0xcd,
-0x39,0xff,0x10,0xbf,0xb3,0xea,0x00,0x00,0x7f,0x8f,0xb0,0x02,0xfd,0xf8,0x21,0x03,
-0x90,0xf2,0x00,0x05,0xfe,0x40,0x00,0x00,0x4d,0xf5,0xf7,0x17,0x41,0xd9,0x89,0xdf,
-0xe4,0x26,0x13,0x23,0xff,0xfd,0xa8,0x12,0x22,0x10,0x00,0x08,0x02,0x12,0x60,0x0b,
-0x17,0x20,0xff,0xff,0x3c,0x13,0x00,0xf2,0x0b,0x11,0x4e,0x06,0x14,0x10,0xeb,0xd2,
-0x02,0x00,0x1e,0x0a,0xf0,0x06,0x70,0x00,0x00,0xf8,0x1b,0xff,0x80,0x00,0xf8,0x00,
-0x00,0x1f,0x8c,0xff,0xff,0x90,0x0c,0xe1,0x00,0x08,0xf7,0x55,0x04,0xd0,0x4f,0xd6,
-0x5a,0xfa,0x6f,0xff,0xff,0xf3,0x00,0x4d,0xff,0xff,0x64,0x0b,0x16,0x30,0x03,0xef,
-0xdb,0xb7,0x12,0x60,0x60,0x01,0xed,0x20,0x7f,0xff,0x67,0x04,0x31,0xaf,0x10,0x6f,
-0xe7,0x0b,0x40,0x0f,0x80,0x2f,0xff,0xaf,0x05,0x31,0x02,0xf5,0x0b,0x90,0x04,0x32,
-0xf1,0x3f,0x75,0x99,0x04,0x13,0x22,0xa1,0x04,0x45,0xf2,0x03,0x33,0x20,0xfb,0x13,
-0x13,0x60,0x28,0x05,0x13,0x90,0x4f,0x13,0x13,0xa0,0x10,0x00,0x13,0xb0,0x08,0x00,
-0xa2,0xc1,0x00,0x09,0x99,0x98,0x88,0x88,0xbf,0xd1,0x00,0x3d,0x00,0xb1,0xd2,0x0b,
-0xbb,0xbb,0xbb,0xbc,0xcc,0xcc,0xa0,0x16,0x66,0x01,0x00,0x22,0x60,0x6f,0x18,0x00,
-0xa4,0x00,0x5f,0xfe,0xde,0xee,0xff,0xff,0xf0,0x00,0x4f,0x3a,0x00,0x12,0xc0,0x08,
-0x00,0x13,0x3e,0x08,0x00,0x13,0x2e,0x08,0x00,0x16,0x2c,0x7c,0x00,0x01,0xc1,0x02,
-0x22,0xb9,0x40,0x09,0x00,0x41,0x57,0x9e,0xf9,0x10,0x24,0x01,0x41,0x20,0x03,0xbf,
-0x70,0x8d,0x04,0x41,0xfb,0x50,0x3d,0xb0,0x12,0x00,0x40,0x8e,0xd4,0x05,0x00,0xb9,
-0x06,0x31,0x71,0x06,0xd2,0xa3,0x05,0x32,0x7c,0xf8,0x00,0xdd,0x01,0x20,0x43,0x80,
-0xdd,0x01,0x40,0xf9,0x20,0x4c,0xd3,0x0b,0x04,0x50,0xf8,0x00,0x00,0x0c,0xf4,0xed,
-0x01,0xf0,0x0f,0x01,0xcf,0x80,0x4f,0xf1,0x00,0x00,0xff,0xd0,0x6f,0xff,0x11,0xff,
-0x70,0x00,0x0b,0xfe,0x04,0xff,0xe0,0x3f,0xf3,0x00,0x00,0x1e,0xf5,0x04,0x72,0x0a,
-0xf9,0x9f,0x14,0x31,0xf5,0x00,0x08,0xbe,0x0e,0x40,0x06,0xcd,0xcd,0xa4,0xf0,0x0f,
-0x40,0xaa,0xaa,0xaa,0x80,0x26,0x02,0x00,0x48,0x01,0xf0,0x0d,0x8f,0x00,0x00,0x15,
-0x6f,0xb0,0x08,0xf0,0x00,0x02,0xe0,0x8f,0xb0,0x8f,0x00,0x00,0x2f,0x33,0xcf,0x78,
-0xf0,0x00,0x02,0xdd,0xd6,0xf8,0x8f,0x00,0xbc,0x0b,0x11,0x88,0x82,0x04,0x0f,0x0d,
-0x00,0x16,0x61,0x88,0x88,0x88,0x88,0x8f,0x86,0x24,0x01,0x15,0xf6,0xf6,0x00,0x32,
-0x01,0x31,0x00,0xa9,0x05,0x31,0xfe,0xfc,0x20,0x7e,0x06,0xf0,0x08,0x91,0x00,0x8f,
-0x23,0x10,0x00,0x00,0x07,0xb0,0x00,0x00,0x9f,0xef,0x90,0x00,0x00,0xc5,0x00,0x00,
-0x01,0x30,0x2c,0x90,0x81,0x03,0x00,0xff,0x04,0xf2,0x15,0x10,0x06,0xe2,0x00,0x00,
-0x02,0x6a,0x00,0xd4,0x01,0xf3,0x00,0x26,0xae,0xff,0xf2,0x0d,0x40,0x7b,0x04,0xef,
-0xff,0xc8,0x40,0x01,0xf1,0x0b,0x60,0x2c,0x84,0x38,0x00,0x00,0x2d,0x70,0xb5,0x3b,
-0x18,0xf0,0x0f,0x3f,0x09,0x70,0x00,0x05,0xff,0xd0,0x00,0x00,0xd3,0x4d,0x00,0x01,
-0xef,0xff,0x60,0x00,0x0e,0x30,0xc8,0x00,0x14,0x44,0x43,0x00,0x03,0xf0,0x02,0xea,
-0x20,0x4e,0x01,0x90,0xd7,0x00,0x01,0x9f,0xfe,0xff,0xff,0xff,0xe6,0x88,0x00,0x43,
-0x22,0x11,0x11,0x10,0x94,0x00,0x13,0x49,0x33,0x04,0x23,0x06,0xf8,0x11,0x00,0x42,
-0x6f,0x80,0x8d,0x10,0x11,0x00,0x20,0x0e,0xd0,0x71,0x07,0x40,0x05,0xef,0xe5,0x96,
-0x71,0x1a,0x30,0x93,0xfd,0x8d,0x8b,0x1b,0x90,0xe7,0x8b,0x8f,0x20,0x2f,0x80,0x00,
-0x0a,0xf2,0x2f,0x15,0x31,0xf8,0x00,0x00,0xe8,0x16,0x40,0xef,0x20,0x00,0x4f,0x07,
-0x03,0x51,0xfe,0x40,0x00,0x07,0xf0,0x44,0x00,0x33,0x00,0x00,0xac,0x55,0x00,0x23,
-0x0c,0xa0,0x11,0x00,0x13,0xe8,0x11,0x00,0x22,0x0f,0x70,0x11,0x00,0x28,0x01,0xf6,
-0x77,0x00,0x10,0x00,0x39,0x05,0xf0,0x0e,0xeb,0x18,0xc3,0xb9,0xc6,0x04,0xd9,0xa0,
-0x8b,0x1d,0xfe,0x20,0x01,0x00,0x00,0x00,0x7c,0xef,0xdb,0x40,0x00,0x02,0xdf,0xc8,
-0x79,0xef,0xa0,0x00,0xdf,0xd9,0x14,0x11,0x70,0xb1,0x0e,0x31,0xa4,0x0c,0xf1,0x30,
-0x00,0x10,0xfe,0xea,0x20,0x40,0x00,0x0f,0xff,0xff,0xfa,0x00,0x83,0xee,0x44,0x44,
-0x43,0x00,0x00,0x0c,0xf1,0xc5,0x00,0x00,0xc7,0x06,0x20,0x00,0xdf,0xca,0x16,0x10,
-0x70,0x41,0x00,0x00,0x30,0x07,0x8c,0x6c,0xef,0xea,0x40,0x00,0x4f,0x84,0xf8,0x03,
-0x00,0x80,0x80,0xa6,0x03,0xa2,0xf9,0x04,0xf3,0x00,0x2e,0x11,0x0f,0x03,0x00,0x11,
-0x00,0xba,0x01,0x11,0xf9,0xa3,0x02,0x21,0xfe,0xf0,0x69,0x11,0x20,0x6f,0x60,0xc5,
-0x03,0x21,0xa0,0xec,0xee,0x0c,0x30,0x08,0xf3,0x00,0xba,0x08,0x20,0x2f,0x90,0xaf,
-0x16,0x00,0xd5,0x08,0x81,0x0b,0xf2,0x11,0x16,0xf6,0x00,0x02,0xff,0xa7,0x00,0x60,
-0x8f,0x64,0x44,0x44,0xaf,0x30,0x5a,0x01,0x50,0x02,0xfa,0x05,0xf7,0x00,0xb1,0x00,
-0x30,0xcf,0x10,0x00,0xb7,0x10,0x01,0x61,0x15,0x6b,0x07,0xf9,0x66,0x66,0x66,0x10,
-0x9b,0x12,0x00,0x61,0x15,0x11,0x10,0x48,0x12,0x72,0xfe,0x81,0x07,0xf8,0x44,0x45,
-0xaf,0xfb,0x15,0x20,0x57,0xf5,0x0f,0x13,0x01,0xf0,0x15,0x51,0x47,0xf9,0x66,0x67,
-0xbf,0x92,0x16,0x11,0x70,0x0f,0x13,0x61,0x40,0x07,0xf9,0x66,0x68,0xef,0x0f,0x13,
-0x15,0xfc,0x2d,0x16,0x80,0x01,0xfb,0x07,0xf6,0x11,0x14,0xce,0x20,0x48,0x00,0x10,
-0x40,0x48,0x00,0x21,0x9f,0xa0,0x38,0x16,0x20,0x67,0xf5,0x8d,0x00,0x00,0x0b,0x00,
-0xd1,0x7f,0x87,0xf9,0x66,0x67,0xaf,0xe1,0x7f,0xff,0xff,0xed,0x71,0x00,0xec,0x15,
-0x00,0x8f,0x00,0x0f,0x8d,0x14,0x1e,0x11,0x00,0x5b,0x17,0x10,0xe0,0xb2,0x13,0x61,
-0x77,0xee,0x00,0x00,0x02,0xf8,0xe3,0x16,0x40,0x4f,0x60,0x00,0xde,0xee,0x0f,0x00,
-0x0d,0x00,0x00,0x49,0x14,0x11,0xde,0xc7,0x07,0x00,0x0d,0x00,0x11,0xec,0x77,0x18,
-0x20,0x2f,0x90,0x0d,0x00,0x21,0x07,0xf5,0x0d,0x00,0x10,0xdf,0x17,0x17,0x81,0x06,
-0xaf,0xc7,0x77,0x77,0xef,0x73,0xdf,0x46,0x03,0x30,0x8d,0xd0,0x00,0x4b,0x00,0x11,
-0xdd,0x19,0x03,0x09,0x0d,0x00,0x11,0x80,0xf2,0x15,0x10,0x77,0xab,0x00,0x2e,0x63,
-0x7f,0x3a,0x01,0x03,0x9c,0x16,0x20,0xfe,0x07,0x17,0x10,0x1d,0x40,0x21,0x00,0x23,
-0xf9,0x66,0x3a,0x15,0x41,0xff,0xd0,0x1e,0xd0,0x2f,0x0c,0x41,0x5f,0x80,0x04,0xf8,
-0x3b,0x0c,0x90,0xed,0x00,0x00,0xaf,0x20,0x01,0xfa,0x00,0x09,0x45,0x04,0x60,0xc0,
-0x01,0xfa,0x00,0x4f,0x80,0x23,0x02,0x50,0x01,0xfa,0x01,0xec,0x00,0xc5,0x10,0x41,
-0x73,0xfa,0x3c,0xe2,0x3e,0x05,0x02,0x81,0x02,0x70,0x00,0x01,0xed,0x14,0xfb,0x25,
-0xf8,0xc8,0x02,0x60,0xf3,0x01,0xfa,0x00,0xbf,0x30,0xbb,0x13,0x80,0x01,0xfa,0x00,
-0x1f,0xd0,0x00,0x01,0xee,0x51,0x00,0x51,0x06,0xf9,0x00,0x0b,0xf4,0x63,0x00,0x41,
-0xcf,0x40,0x6f,0xa0,0x09,0x00,0x40,0x2f,0xe0,0x00,0x18,0xb5,0x13,0xc1,0x2d,0xfa,
-0x78,0xdf,0x70,0x0b,0xf5,0x00,0x00,0xef,0x00,0x68,0xc7,0x0e,0x03,0x8b,0x19,0x20,
-0x13,0xaf,0xea,0x01,0x00,0xe6,0x09,0x41,0x02,0x46,0xaf,0xa0,0x76,0x00,0x20,0x50,
-0x63,0x85,0x00,0xf1,0x01,0x1f,0xd2,0x00,0x00,0xaf,0x50,0x5f,0xf9,0x67,0xcf,0xb0,
-0x00,0x3a,0xdf,0xfc,0x60,0x68,0x11,0x20,0x4f,0xf1,0x06,0x00,0x10,0xdf,0x06,0x00,
-0x20,0x08,0xfb,0x06,0x00,0x20,0x3f,0xa7,0x06,0x00,0xd0,0xce,0x17,0xf1,0x7f,0x20,
-0x06,0xf6,0x07,0xf1,0x7f,0x20,0x1f,0xc0,0x06,0x00,0xd0,0xbf,0x20,0x07,0xf1,0x7f,
-0x25,0xf8,0x00,0x07,0xf1,0x7f,0x3e,0xd0,0x06,0x00,0x20,0xaf,0x40,0x06,0x00,0x20,
-0xfa,0x00,0x06,0x00,0x11,0xe1,0x31,0x0c,0x40,0x6f,0x10,0x05,0xf3,0x94,0x01,0x20,
-0x1c,0xe0,0x15,0x1f,0x22,0xfd,0x30,0x7c,0x0b,0x0f,0x66,0x00,0x3c,0x40,0x7f,0x50,
-0x00,0x0a,0xa9,0x15,0x10,0x4f,0xf1,0x16,0x50,0xed,0x00,0x7f,0x50,0x09,0x0c,0x17,
-0x90,0x4f,0x80,0x00,0x7f,0x65,0xfb,0x00,0x00,0x7f,0xbd,0x07,0xe0,0x7f,0x71,0xaf,
-0x30,0x00,0x7f,0x50,0x1e,0xd0,0x00,0x7f,0x50,0x06,0xf9,0xb4,0x01,0x10,0xbf,0xc4,
-0x01,0x21,0x2f,0xd0,0x4b,0x15,0x21,0x00,0x04,0xd2,0x09,0x70,0x6f,0x97,0x77,0xee,
-0x00,0x08,0xf2,0x40,0x02,0x10,0xaf,0x38,0x01,0x20,0x0c,0xe0,0x0b,0x00,0x10,0xfc,
-0x0b,0x00,0x10,0x1f,0x56,0x02,0x00,0x8e,0x0c,0x10,0xde,0x9e,0x0c,0x20,0x0d,0xe0,
-0x5b,0x01,0x30,0xde,0x01,0xfc,0xa5,0x1c,0x70,0xcf,0x50,0x00,0x00,0xde,0xce,0x80,
-0x6a,0x02,0x01,0x35,0x17,0x40,0x3f,0xf4,0x7f,0xf7,0x71,0x0d,0xf0,0x21,0xf4,0x7f,
-0xbd,0x00,0x00,0x00,0xec,0xf4,0x7f,0x6f,0x30,0x00,0x05,0xf7,0xf4,0x7f,0x2e,0x90,
-0x00,0x0b,0xc5,0xf4,0x7f,0x29,0xf0,0x00,0x1f,0x65,0xf4,0x7f,0x23,0xf6,0x00,0x7f,
-0x15,0xf4,0x7f,0x20,0xdc,0x00,0xda,0x05,0xf4,0x7f,0x20,0x6f,0x23,0xf4,0x07,0x00,
-0x30,0x1f,0x89,0xe0,0x07,0x00,0x30,0x0a,0xce,0x80,0x07,0x00,0x30,0x04,0xff,0x20,
-0x07,0x00,0x41,0x00,0xdc,0x00,0x05,0x90,0x19,0x2f,0x09,0xf2,0x06,0x00,0x06,0x40,
-0x62,0x22,0x22,0x2a,0x57,0x19,0x00,0x5d,0x19,0x5f,0x85,0x55,0x55,0x5b,0xf2,0x30,
-0x00,0x0b,0x00,0xc5,0x04,0xc0,0xeb,0x50,0x00,0x00,0x3d,0xfc,0x87,0x8d,0xfb,0x10,
-0x01,0xef,0xb1,0x0d,0x40,0xb0,0x08,0xf6,0x00,0x3c,0x15,0x20,0x0d,0xf0,0x93,0x04,
-0x10,0xfa,0xee,0x11,0x00,0x08,0x10,0x01,0x45,0x07,0x13,0xfd,0x0e,0x00,0x02,0x1c,
-0x00,0x31,0xf9,0x07,0xf7,0x9e,0x02,0x01,0x4c,0x05,0x93,0x7f,0xa0,0x00,0x2d,0xfc,
-0x86,0x8d,0xfb,0x00,0x54,0x00,0x02,0x85,0x00,0x00,0x1e,0x1a,0x11,0x7c,0x6d,0x00,
-0x1f,0x0a,0x06,0x00,0x2a,0x00,0x8c,0x04,0x20,0x80,0x07,0x97,0x04,0x11,0xc0,0xad,
-0x04,0x20,0x67,0xf5,0x80,0x00,0x00,0x0b,0x00,0x21,0x2f,0x97,0x58,0x17,0x60,0x7f,
-0x61,0x11,0x27,0xfe,0x17,0xb2,0x08,0x5f,0x20,0x7f,0x84,0x44,0x31,0x95,0x17,0x06,
-0x20,0x00,0x7c,0x9d,0x00,0x0a,0x04,0x06,0x00,0x41,0x06,0x11,0x83,0x87,0x19,0x01,
-0x71,0x1e,0x00,0x78,0x07,0x02,0x67,0x08,0x00,0x32,0x18,0x06,0x04,0x06,0x00,0x2b,
-0x06,0x40,0xc8,0x00,0xdf,0x70,0x60,0x15,0x33,0x02,0xdf,0xd8,0x04,0x06,0x41,0xda,
-0x30,0x00,0x9f,0xeb,0x00,0x82,0x36,0x66,0x7f,0xd6,0x66,0x61,0x00,0x00,0x2a,0x01,
-0x0f,0x06,0x00,0x27,0x01,0xf3,0x08,0x10,0xed,0x36,0x1d,0x00,0xb4,0x00,0x20,0xee,
-0x10,0x4e,0x0c,0x21,0x05,0xf9,0x0a,0x0f,0x21,0x0b,0xf2,0xef,0x14,0x31,0x2f,0xb0,
-0x7f,0xbd,0x20,0x21,0x6e,0xa0,0x63,0x0e,0x11,0xf2,0xcf,0x08,0x01,0x42,0x06,0x00,
-0x7e,0x16,0x04,0xd8,0x1c,0x30,0x98,0x7f,0xd0,0x9e,0x01,0x23,0xee,0xa1,0x0d,0x07,
-0x16,0xf1,0x21,0x00,0x10,0x8d,0xe3,0x18,0xf0,0x06,0x00,0xdf,0x95,0xbf,0x57,0xef,
-0x50,0x8f,0x70,0x0a,0xf1,0x01,0xee,0x0c,0xf0,0x00,0xaf,0x10,0x09,0xf3,0xee,0x27,
-0x00,0x22,0x7f,0x5c,0x0d,0x00,0xf5,0x09,0x8f,0x50,0x0a,0xf1,0x00,0xee,0x00,0xdf,
-0x61,0xaf,0x23,0xcf,0x50,0x01,0xaf,0xff,0xff,0xfd,0x40,0x00,0x00,0x02,0xbf,0x41,
-0x4e,0x00,0x21,0x0c,0xf2,0x71,0x07,0x21,0x2f,0xc0,0x5a,0x16,0x82,0x5f,0x80,0x00,
-0xcf,0x20,0x00,0x00,0x9f,0x14,0x05,0x31,0xde,0x4f,0xa0,0x40,0x1d,0x11,0xd0,0x42,
-0x01,0x11,0xfa,0x40,0x0b,0x30,0xfc,0xf5,0x00,0xea,0x16,0x20,0x0d,0xf2,0xdc,0x04,
-0x00,0x37,0x00,0x00,0xd5,0x04,0x50,0x7f,0x70,0x00,0x7f,0x70,0x0a,0x00,0x21,0x3f,
-0xb0,0x17,0x00,0x01,0xf0,0x01,0x00,0xa9,0x18,0x00,0xac,0x00,0x0f,0x0d,0x00,0x28,
-0x71,0xfa,0x77,0x77,0x77,0xcf,0x75,0x7f,0xed,0x05,0x02,0x4d,0x0a,0x12,0xfb,0xdb,
-0x01,0x0a,0x0d,0x00,0x00,0x9c,0x1d,0x30,0xaf,0x18,0xf4,0x33,0x00,0x0f,0x0b,0x00,
-0x03,0x00,0x8d,0x07,0xf5,0x03,0xaf,0x12,0xfe,0x52,0x24,0x7d,0xf1,0x05,0xff,0xff,
-0xfe,0xef,0x10,0x00,0x34,0x31,0x0a,0xf1,0x4b,0x01,0x04,0x0b,0x00,0x20,0x7f,0x50,
-0x72,0x06,0x40,0x0e,0xd7,0xf5,0x00,0xf5,0x1d,0x1f,0xed,0x0f,0x00,0x31,0x10,0xfa,
-0x54,0x19,0x32,0x77,0xed,0x7f,0x1b,0x0b,0x30,0xd0,0x7f,0x50,0x7e,0x11,0x20,0x4f,
-0x70,0xcf,0x19,0x10,0xf6,0x12,0x11,0x0f,0x11,0x00,0x3a,0x98,0xfa,0x77,0x7a,0xfa,
-0x77,0x79,0xfb,0x70,0x7f,0x80,0x10,0x10,0x00,0x96,0x23,0x02,0x01,0x00,0x1e,0x9f,
-0x11,0x00,0x0d,0xfc,0x06,0x0f,0x62,0x08,0x17,0x18,0x9f,0x62,0x08,0x00,0x11,0x00,
-0x40,0x7c,0xff,0xd9,0x20,0x09,0x00,0x50,0x1d,0xf8,0x44,0x6d,0xf6,0x09,0x00,0x20,
-0xce,0x20,0x14,0x02,0x10,0x7f,0x43,0x22,0x02,0xdf,0x1a,0x01,0x69,0x01,0x71,0x0b,
-0xf1,0x7f,0x62,0x2d,0xe0,0x00,0xc1,0x04,0x01,0x13,0x08,0x82,0x00,0x08,0xf4,0x7f,
-0x85,0x5e,0xf0,0x00,0xd3,0x04,0x01,0xb5,0x1f,0x01,0x69,0x1c,0x01,0x79,0x1f,0x90,
-0xa0,0x7f,0x50,0x01,0xef,0x60,0x00,0x01,0xdf,0x29,0x1b,0x60,0x3e,0xfc,0x76,0x9f,
-0xf5,0x00,0xb8,0x08,0x10,0x7c,0x98,0x1b,0x20,0x00,0x18,0x08,0x08,0x71,0x20,0x0d,
-0xfb,0x76,0x66,0x6c,0xf2,0x36,0x0a,0x40,0x9f,0x20,0x9f,0x30,0x47,0x00,0x21,0x06,
-0xf6,0x0d,0x00,0x90,0x1e,0xf6,0x21,0x11,0x1a,0xf2,0x00,0x2b,0xff,0x27,0x00,0x61,
-0x00,0x0a,0xf5,0x44,0x4b,0xf2,0xa6,0x19,0x00,0x6b,0x08,0x01,0x32,0x23,0x20,0x8f,
-0x60,0x0d,0x00,0x20,0x2f,0xd0,0x34,0x00,0x21,0x0c,0xf3,0x34,0x00,0x01,0x5a,0x23,
-0x82,0x00,0x4f,0xb5,0x48,0xf9,0x00,0x06,0xb1,0xd9,0x1d,0x00,0x39,0x01,0xf0,0x11,
-0x8d,0xef,0xff,0xf1,0x00,0xbf,0x83,0x22,0xaf,0x10,0x1f,0xa0,0x00,0x0b,0xf1,0x02,
-0xf9,0x00,0x03,0xff,0x10,0x0d,0xf5,0x37,0xd9,0xf7,0x10,0x2b,0xfe,0xb2,0x1d,0xf7,
-0x29,0x03,0xd0,0x20,0x00,0x04,0x9c,0xff,0x90,0x00,0xbf,0xda,0x74,0x10,0x0b,0xc2,
-0xbd,0x00,0x00,0x70,0x01,0xf0,0x01,0x8b,0x2a,0xef,0xc4,0x00,0xba,0xd7,0x35,0xdf,
-0x40,0xdf,0x60,0x00,0x1f,0xb0,0xef,0xdd,0x00,0x01,0xe8,0x08,0x10,0xce,0x05,0x00,
-0x10,0x9f,0x6b,0x06,0xf0,0x20,0x4f,0x50,0x00,0x2f,0xa0,0x0b,0xf7,0x46,0xef,0x20,
-0x00,0x8e,0xfe,0xa2,0x00,0xbf,0xff,0xfd,0x91,0x0b,0xf4,0x44,0x8f,0xa0,0xbf,0x00,
-0x00,0xde,0x0b,0xf0,0x00,0x4f,0x80,0xbf,0xff,0xff,0x90,0x0b,0xf2,0x23,0x6f,0xb0,
-0xbf,0x00,0x00,0x9f,0x2b,0x44,0x16,0x50,0xbf,0x33,0x36,0xfd,0x0b,0x45,0x1c,0x6e,
-0xbf,0xff,0xf6,0xbf,0x33,0x31,0x33,0x15,0x03,0x36,0x15,0x11,0x0a,0x6c,0x0c,0x30,
-0xcd,0x33,0x6f,0xc5,0x25,0x50,0x04,0xf6,0x00,0x01,0xf8,0x75,0x09,0x70,0x4f,0x50,
-0x04,0xf6,0x00,0x08,0xf2,0x0b,0x00,0x40,0xce,0x00,0x04,0xf6,0x12,0x07,0x81,0x4f,
-0x60,0x29,0xf6,0x33,0x36,0xf8,0x2d,0x31,0x0e,0x10,0xdb,0x83,0x01,0x20,0xcd,0xb0,
-0xd1,0x23,0x07,0x0b,0x00,0xf0,0x05,0x00,0x3b,0xef,0xd8,0x00,0x03,0xfd,0x53,0x7f,
-0xc0,0x0c,0xe1,0x00,0x06,0xf4,0x0f,0xa0,0x00,0x02,0xf9,0x61,0x0e,0x60,0xfa,0x2f,
-0xb3,0x33,0x33,0x32,0x94,0x03,0x00,0xdd,0x04,0xf0,0x16,0x02,0x92,0x03,0xfe,0x64,
-0x6e,0xe0,0x00,0x3a,0xef,0xe9,0x10,0x7f,0x30,0x07,0xf3,0x00,0x8f,0x30,0xbd,0x00,
-0x7f,0x30,0x3f,0x70,0x01,0xe9,0x07,0xf3,0x0d,0xb0,0x00,0x04,0xf7,0x8f,0x4a,0xd1,
-0xf2,0x1d,0x20,0xff,0xf9,0xfb,0x09,0xf0,0x07,0x9f,0x48,0xf2,0x00,0x00,0xeb,0x07,
-0xf3,0x1f,0xb0,0x00,0x8f,0x30,0x7f,0x30,0x8f,0x30,0x2f,0xb0,0x07,0xf3,0x00,0x62,
-0x11,0xe0,0x7f,0x30,0x07,0xf5,0x02,0xbe,0xfd,0x70,0x0e,0xd5,0x49,0xf7,0x05,0x20,
-0xed,0x03,0xa0,0x28,0xf5,0x00,0x0d,0xfe,0x50,0x00,0x03,0x5c,0xf5,0x00,0x1e,0xf1,
-0x37,0x39,0x10,0x00,0xde,0x2f,0xc5,0x49,0xf8,0x03,0xbe,0xfd,0x70,0xbf,0x00,0x00,
-0xcf,0x4b,0xf0,0x00,0x6f,0xf4,0xbf,0x00,0x0e,0xcf,0x4b,0xf0,0x08,0xe5,0xf4,0xbf,
-0x02,0xf5,0x4f,0x4b,0xe0,0xbc,0x04,0xf4,0xbe,0x4f,0x20,0x4f,0x4b,0xed,0x90,0x04,
-0xf4,0xbf,0xe1,0x00,0x4f,0x4b,0xf6,0x00,0x04,0xf4,0x0f,0x80,0x00,0xea,0x00,0xbe,
-0x20,0x6f,0x50,0x01,0xbf,0xff,0x80,0xc4,0x08,0x0f,0x3f,0x00,0x1a,0xf0,0x16,0xbf,
-0x00,0x0c,0xe1,0xbf,0x00,0x7f,0x30,0xbf,0x02,0xf7,0x00,0xbf,0x2d,0xb0,0x00,0xbf,
-0xff,0x50,0x00,0xbf,0x1c,0xd0,0x00,0xbf,0x04,0xf7,0x00,0xbf,0x00,0xbe,0x10,0xbf,
-0x00,0x3f,0x90,0xbf,0x0a,0x01,0x10,0x0f,0x2a,0x15,0x40,0x1f,0xa3,0x33,0xec,0x12,
-0x16,0x10,0xec,0x03,0x15,0x10,0xec,0xe6,0x1a,0x10,0xec,0x91,0x08,0x10,0xec,0x38,
-0x27,0x10,0xec,0x2d,0x0d,0xfe,0x34,0xec,0x3b,0xf2,0x00,0x00,0xec,0xde,0x60,0x00,
-0x00,0xec,0xbf,0xf1,0x00,0x00,0xef,0xcb,0xef,0x60,0x00,0x3f,0xec,0xbe,0xac,0x00,
-0x09,0xcd,0xcb,0xe5,0xf1,0x00,0xe7,0xdc,0xbf,0x0f,0x60,0x3f,0x1d,0xcb,0xf0,0xac,
-0x09,0xc0,0xdc,0xbf,0x05,0xf1,0xe7,0x0d,0xcb,0xf0,0x0f,0x8f,0x20,0xdc,0xbf,0x00,
-0xae,0xc0,0x0d,0xcb,0xf0,0x04,0xf7,0x00,0xdc,0xbf,0xbe,0x16,0x8e,0xff,0xff,0xff,
-0x2b,0xf3,0x33,0x39,0xf2,0x1b,0x00,0x00,0x03,0x28,0xc0,0x10,0x04,0xfd,0x54,0x7f,
-0xd0,0x0c,0xf1,0x00,0x06,0xf6,0x1f,0x74,0x0a,0x00,0x98,0x0c,0x11,0xfb,0x05,0x00,
-0xf0,0x05,0x0f,0xb0,0x00,0x02,0xf9,0x0c,0xf1,0x00,0x07,0xf5,0x03,0xfd,0x54,0x8f,
-0xc0,0x00,0x3b,0xff,0xd8,0x00,0x4d,0x00,0x40,0xbf,0x33,0x33,0xcf,0x52,0x02,0x0f,
-0x04,0x00,0x09,0xf3,0x00,0xbd,0x2b,0xff,0xb2,0x0b,0xfd,0x62,0x4e,0xe1,0xbf,0x60,
-0x00,0x5f,0x7b,0xf1,0x16,0x1b,0xff,0x08,0xbb,0xf0,0x00,0x00,0xfb,0xbf,0x10,0x00,
-0x1f,0xab,0xf6,0x00,0x06,0xf6,0xbf,0xd7,0x46,0xfe,0x0b,0xf2,0xbf,0xfb,0x20,0x48,
-0x18,0x01,0x60,0xff,0xc4,0x00,0x3f,0xc6,0x5b,0x60,0x17,0x41,0x0e,0xb0,0xfa,0x00,
-0xfe,0x0b,0x01,0x4d,0x05,0x01,0x25,0x1b,0xf0,0x08,0x10,0xcf,0x10,0x00,0xed,0x03,
-0xfd,0x65,0xbf,0x50,0x03,0xbf,0xfc,0x50,0xaf,0xff,0xff,0xff,0x62,0x33,0x9f,0x53,
-0x31,0x6d,0x28,0x02,0xf8,0x25,0x0f,0x09,0x00,0x06,0x00,0x70,0x0d,0x10,0x07,0xd7,
-0x26,0xe0,0x0c,0xe0,0x0e,0xc0,0x00,0x2f,0x80,0x09,0xf2,0x00,0x7f,0x20,0x02,0xf8,
-0xfe,0x16,0x20,0xce,0x02,0x4c,0x1f,0x70,0x48,0xe0,0x00,0x00,0x0e,0x9e,0x90,0x8d,
-0x11,0x50,0x30,0x00,0x00,0x02,0xfd,0xcb,0x03,0x22,0xf6,0x00,0xb4,0x1c,0x10,0x14,
-0x6d,0x0b,0x22,0x5f,0xe6,0x2f,0x05,0x13,0x07,0xa1,0x10,0x02,0xa7,0x07,0x01,0x87,
-0x29,0x05,0x0f,0x00,0xf0,0x08,0x8e,0xfb,0x2f,0x96,0xdf,0xd4,0x00,0x7f,0xa4,0x6c,
-0xfc,0xb4,0x5e,0xf2,0x0e,0xe0,0x00,0x6f,0xe0,0x00,0x4f,0x81,0xfa,0x09,0x14,0x00,
-0x5c,0x01,0x00,0x2d,0x00,0x30,0x0e,0xc2,0xf9,0x2d,0x00,0x00,0x90,0x19,0x00,0x25,
-0x08,0xfc,0x09,0x0f,0xb0,0xee,0x00,0x06,0xff,0x10,0x05,0xf8,0x08,0xfb,0x57,0xcf,
-0xdc,0x56,0xef,0x20,0x08,0xef,0xb2,0xf9,0x6d,0xfd,0x40,0x5a,0x00,0x09,0x0f,0x00,
-0x00,0x70,0x0c,0x90,0x2f,0xb0,0x09,0xf3,0x00,0xbe,0x10,0x00,0xdd,0x37,0x19,0x10,
-0x3f,0xb9,0x00,0x21,0x07,0xfe,0xeb,0x03,0xf0,0x08,0x20,0x00,0x00,0x5f,0x6d,0xc0,
-0x00,0x01,0xeb,0x03,0xf8,0x00,0x0b,0xe1,0x00,0x9f,0x40,0x6f,0x50,0x00,0x0d,0xe1,
-0xbf,0xc0,0x04,0x0f,0x05,0x00,0x11,0x50,0x33,0x33,0xaf,0x41,0xbf,0xe2,0x0d,0x00,
-0xd9,0x0b,0x0c,0x05,0x00,0x44,0xec,0x00,0x01,0xf9,0x04,0x00,0xe0,0xdc,0x00,0x01,
-0xf9,0xbf,0x41,0x26,0xf9,0x3e,0xff,0xea,0xf9,0x00,0x32,0xb1,0x17,0x06,0x04,0x00,
-0xdf,0xbf,0x00,0x03,0xf7,0x00,0x0c,0xeb,0xf0,0x00,0x3f,0x70,0x00,0xce,0x0d,0x00,
-0x15,0x61,0x33,0x35,0xf9,0x33,0x3c,0xeb,0xb4,0x06,0x20,0xfe,0xbf,0x91,0x04,0x40,
-0x0d,0xd0,0x0b,0xf0,0x9e,0x04,0x2f,0xdd,0x00,0x0f,0x00,0x1b,0x61,0x33,0x36,0xf8,
-0x33,0x3d,0xd3,0xee,0x12,0x00,0x22,0x13,0x02,0x21,0x16,0x12,0x30,0x6c,0x2b,0x0c,
-0x0f,0x00,0x0d,0xf6,0x1b,0x00,0x79,0x05,0x60,0x81,0x0b,0xf2,0x23,0x7f,0xb0,0xcf,
-0x02,0x00,0xdb,0x1b,0x70,0xf1,0xbf,0x22,0x37,0xfb,0x0b,0xff,0x05,0x03,0x00,0x32,
-0x28,0x90,0x70,0x0b,0xf0,0x01,0xfc,0x31,0x6f,0x90,0xbf,0x27,0x06,0x50,0xaf,0x1b,
-0xf0,0x0d,0xe0,0xcb,0x1b,0x10,0xff,0x38,0x09,0x30,0x6b,0xf3,0x3e,0xeb,0x1c,0xa0,
-0xbf,0x00,0xce,0x00,0x00,0x6f,0x5b,0xf0,0x08,0xf3,0x99,0x1f,0x72,0x00,0x1e,0xe6,
-0x4a,0xf8,0x0b,0xf0,0xd5,0x1d,0xc0,0x7d,0xff,0xff,0xf0,0x8f,0x93,0x22,0xbf,0x0d,
-0xe0,0x00,0x0b,0x66,0x1e,0x70,0xbf,0x0a,0xf6,0x00,0x0b,0xf0,0x1b,0x31,0x13,0xe0,
-0x1e,0xb2,0x2b,0xf0,0x0c,0xe1,0x00,0xbf,0x0a,0xf3,0x00,0x0b,0xf7,0xf6,0x91,0x00,
-0xf0,0x01,0x3b,0xef,0xd6,0x00,0x03,0xfb,0x54,0x8f,0x90,0x0c,0xe0,0x00,0x08,0xa0,
-0x0f,0xa0,0x0e,0x03,0x90,0xff,0xff,0x60,0x00,0x2f,0xa3,0x33,0x10,0x00,0xa5,0x03,
-0xf1,0x02,0x40,0x0c,0xf2,0x00,0x0c,0xf0,0x03,0xfd,0x64,0xaf,0x70,0x00,0x3b,0xff,
-0xd6,0x00,0x68,0x86,0x03,0x04,0x01,0x00,0x71,0x1f,0x70,0x6f,0x10,0xa4,0x04,0xa1,
-0x90,0x10,0x10,0xf7,0x29,0x21,0x0f,0x07,0x00,0x0a,0x09,0x01,0x00,0x2f,0xfa,0x00,
-0x01,0x00,0x29,0x13,0xf0,0x08,0x00,0x17,0xee,0x14,0x00,0x70,0xf9,0xf7,0x00,0xfd,
-0xf7,0x00,0xf4,0x56,0x03,0x0f,0x58,0x00,0x26,0x4f,0x03,0x03,0x00,0x03,0x3c,0x00,
-0x25,0x2f,0xe7,0x00,0x01,0x00,0x3b,0x1f,0xdf,0x44,0x00,0x30,0x03,0x20,0x01,0xb1,
-0xf7,0x00,0xfe,0x00,0x00,0xed,0xfd,0xf3,0xf6,0x00,0xf2,0x11,0x00,0x00,0x0f,0x00,
-0x4f,0xfd,0xfe,0xf9,0xfb,0x2a,0x01,0x24,0x10,0xfc,0xe0,0x0e,0x1f,0xf8,0x96,0x00,
-0x27,0x1c,0xfc,0x0a,0x00,0x19,0xfe,0x1f,0x00,0x1f,0xfd,0x4c,0x00,0x19,0x13,0xf1,
-0x31,0x00,0x7f,0xfc,0x00,0xfd,0x00,0xfd,0xfa,0xfd,0x34,0x01,0x30,0x15,0x03,0x88,
-0x00,0x11,0xfd,0x5a,0x00,0x2f,0xfd,0xfc,0x56,0x00,0x1d,0x11,0xdd,0x0e,0x02,0x15,
-0xd9,0x4a,0x00,0x20,0xfb,0xfd,0x46,0x00,0x02,0x04,0x00,0x0f,0x90,0x00,0x23,0x10,
-0xfc,0x08,0x00,0x1f,0xfc,0xda,0x00,0x2d,0x1f,0xfd,0x99,0x02,0x33,0x15,0xf7,0x13,
-0x0d,0x04,0xc5,0x01,0x01,0xd9,0x00,0x3f,0xfd,0xfa,0xf7,0x45,0x00,0x18,0x14,0xce,
-0xde,0x00,0x97,0xf6,0x00,0x00,0xd7,0xf8,0xe6,0xeb,0x00,0xdd,0xca,0x03,0x2f,0xec,
-0xf2,0x93,0x00,0x1c,0x20,0xd0,0x00,0xeb,0x08,0x13,0xe2,0xae,0x0d,0x41,0xfc,0x00,
-0xfe,0xfe,0x55,0x02,0x1f,0x02,0x0b,0x04,0x27,0x6f,0xfa,0x00,0xfc,0xfd,0x00,0xfb,
-0x2f,0x01,0x31,0x10,0xf4,0x78,0x01,0x1f,0xf9,0x87,0x00,0x26,0x00,0x4e,0x38,0xa1,
-0xde,0x00,0x00,0xf4,0xfc,0xdc,0xfe,0x02,0x00,0x02,0xd2,0x00,0xdf,0xef,0xf1,0x00,
-0xf0,0xf1,0xf5,0xef,0x00,0xf2,0xf5,0xf8,0xf5,0xf7,0x4a,0x02,0x1a,0x66,0xdf,0xfb,
-0x00,0x00,0xf5,0xfe,0x11,0x00,0x10,0xf9,0x2a,0x08,0x00,0x29,0x30,0x00,0x14,0x00,
-0x0f,0xfa,0x04,0x18,0x42,0x02,0x00,0xee,0xf7,0x9d,0x00,0x13,0x02,0x11,0x00,0x23,
-0xfb,0xfb,0xe8,0x02,0x1f,0x00,0x81,0x05,0x1e,0x14,0xf9,0x09,0x04,0x15,0x02,0x15,
-0x04,0x01,0x78,0x03,0x1f,0xfb,0x55,0x04,0x1b,0xf0,0x0a,0x03,0xf9,0xe1,0xf8,0x00,
-0x00,0xf2,0xfc,0xf2,0xfe,0x03,0xf2,0x03,0x03,0x02,0x03,0x00,0x03,0xf5,0xf6,0xfd,
-0xfa,0xf6,0xfa,0xf7,0x17,0x04,0x2f,0xfd,0xfc,0xd8,0x05,0x1e,0x2a,0x02,0xfc,0x3b,
-0x03,0x02,0x0c,0x04,0x1f,0xfc,0x7a,0x03,0x25,0x0f,0x7d,0x03,0x2a,0x1f,0xf6,0x1d,
-0x00,0x09,0x1f,0xfe,0x7c,0x05,0x23,0x0f,0x4a,0x00,0x02,0x1f,0xfe,0x4d,0x00,0x17,
-0x1f,0xfe,0xea,0x06,0x36,0x1f,0xfe,0x67,0x00,0x36,0x1e,0x02,0xc5,0x02,0x19,0x03,
-0xf3,0x00,0x1f,0x03,0x58,0x06,0x19,0x0f,0x01,0x00,0x48,0x0f,0x0e,0x02,0x22,0x1f,
-0xec,0x28,0x01,0x0b,0x2f,0xfd,0xfe,0x28,0x01,0x18,0x0a,0x3c,0x09,0x01,0x6b,0x04,
-0x20,0xfd,0x02,0x97,0x00,0x10,0x07,0x05,0x09,0x0f,0xe1,0x00,0x61,0x17,0x02,0xd8,
-0x09,0x05,0xd5,0x00,0x2f,0xfe,0x02,0x68,0x02,0x24,0x1f,0xee,0xbc,0x01,0x4a,0x1f,
-0xfd,0xf9,0x02,0x36,0x1f,0xfe,0x89,0x00,0x72,0x0f,0x01,0x00,0x06,0xde,0x0a,0x00,
-0xfd,0x07,0x00,0xf9,0xfd,0xf9,0xe8,0xf3,0xf6,0x00,0xe8,0x3e,0x03,0x3f,0xf9,0xfd,
-0x03,0xe5,0x05,0x17,0x01,0xaf,0x00,0x7e,0xfd,0xf2,0xf9,0xfd,0xf9,0xf2,0xfd,0x2a,
-0x02,0x1f,0xf9,0x0c,0x05,0x16,0xe8,0xf9,0xf9,0xf6,0xfd,0x00,0xf6,0x00,0xf6,0xec,
-0xf6,0xf6,0xf3,0xf2,0xf6,0x6d,0x02,0x11,0xfd,0x20,0x00,0x4f,0xfd,0x00,0xfd,0xf6,
-0x19,0x01,0x12,0x73,0xec,0xec,0x00,0xf9,0xef,0xf9,0xef,0x15,0x0b,0x70,0xf6,0xef,
-0x00,0xef,0x00,0xec,0xec,0x08,0x1b,0x62,0x00,0xef,0xef,0xef,0xec,0xef,0x71,0x03,
-0x2f,0xef,0xec,0xae,0x09,0x1b,0x16,0xf9,0xad,0x05,0x16,0x0a,0x74,0x04,0x1f,0x07,
-0x10,0x07,0x1c,0x0f,0x57,0x03,0x33,0x01,0x79,0x08,0x35,0xfd,0x03,0x07,0xfa,0x04,
-0x18,0xfc,0x48,0x00,0x1f,0xfd,0x4b,0x00,0x1a,0x00,0x02,0x00,0x6f,0xf9,0xfd,0xfd,
-0x00,0xf9,0xfd,0x3e,0x03,0x30,0x11,0xfd,0xf8,0x09,0x0f,0x4c,0x05,0x39,0x0e,0xf8,
-0x05,0x0f,0x4a,0x00,0x21,0x00,0x99,0x00,0x09,0x3d,0x00,0x11,0x03,0x02,0x00,0x0f,
-0x2b,0x01,0x14,0x53,0xf9,0xf9,0xf9,0x00,0xfd,0xc3,0x01,0x37,0xf2,0xf9,0xf9,0xcc,
-0x01,0x1f,0xfd,0xc0,0x01,0x1c,0x71,0xec,0xec,0xfd,0xf9,0xef,0xfd,0xf9,0x2e,0x03,
-0x40,0xf2,0x00,0xf9,0xf6,0x57,0x3a,0x14,0xf3,0x1d,0x00,0x05,0x09,0x00,0x0f,0x43,
-0x01,0x11,0x00,0x93,0x00,0xa3,0xf6,0xfd,0xf9,0x00,0x00,0xf6,0xf6,0x00,0xef,0xf6,
-0xd9,0x00,0x1f,0x07,0x55,0x02,0x21,0x73,0xf6,0xf6,0x03,0xfd,0xf9,0x00,0xf2,0x79,
-0x00,0x20,0xf9,0xf2,0x88,0x00,0x10,0xef,0x8e,0x00,0x90,0xf3,0xf2,0xf3,0x00,0xe8,
-0xef,0xef,0x00,0xef,0x0c,0x00,0x1f,0xef,0xde,0x00,0x11,0x01,0xd3,0x00,0x14,0xf6,
-0x4a,0x00,0xf0,0x01,0x00,0xf9,0xef,0xf2,0xe8,0xec,0xf6,0xef,0xf2,0xf6,0xf2,0xec,
-0xf2,0xf2,0xec,0xf2,0x71,0x03,0x00,0xac,0x14,0x0f,0xde,0x00,0x11,0x13,0xf6,0x06,
-0x01,0x22,0xef,0xf2,0x0d,0x00,0x0e,0x32,0x09,0x0f,0x78,0x03,0x1a,0x01,0x96,0x00,
-0x1e,0xf6,0x62,0x02,0x0f,0xa0,0x04,0x19,0x0b,0xc5,0x03,0x1f,0x07,0xe8,0x02,0x36,
-0x0e,0xd2,0x02,0x0f,0x5c,0x00,0x16,0x00,0x33,0x05,0xbf,0xf6,0xf9,0xf9,0x00,0xf9,
-0xe2,0x00,0x00,0xf2,0xe8,0xf2,0x8a,0x0a,0x29,0x40,0xf3,0xf9,0x00,0xf2,0x29,0x03,
-0x32,0xef,0x00,0x00,0x7d,0x05,0x04,0x54,0x10,0x2f,0xf2,0xfd,0x19,0x09,0x3b,0x1f,
-0xf9,0x37,0x0d,0x25,0x11,0xf9,0x8d,0x00,0x11,0xfd,0x07,0x00,0x00,0x05,0x00,0x00,
-0xb4,0x04,0x2f,0xf6,0xf6,0x4c,0x00,0x21,0x20,0xfd,0xfd,0x04,0x00,0x11,0xfd,0xff,
-0x01,0x02,0x01,0x05,0x21,0xf9,0xfd,0xfe,0x00,0x0f,0x94,0x00,0x23,0x14,0xf9,0x49,
-0x02,0x1d,0xf9,0x18,0x04,0x0f,0xd5,0x05,0x1e,0x15,0xf9,0xe4,0x02,0x2a,0xf6,0xfd,
-0xfa,0x02,0x0f,0x51,0x02,0x28,0x1f,0x03,0x51,0x08,0x25,0x13,0xfd,0x21,0x01,0x04,
-0xdf,0x05,0x00,0x3a,0x01,0x0f,0x94,0x00,0x22,0x23,0x07,0x07,0x75,0x05,0x00,0x8d,
-0x00,0x00,0x09,0x00,0x2f,0x03,0x03,0x3c,0x03,0x39,0x1f,0xf9,0x94,0x02,0x28,0x1f,
-0xfd,0x5c,0x06,0x2b,0x06,0x0a,0x02,0x16,0xfd,0x4f,0x04,0x10,0xf9,0x54,0x02,0x0f,
-0x4a,0x00,0x27,0x01,0x94,0x00,0x17,0xf6,0x4a,0x00,0x1f,0xfd,0x5c,0x04,0x2d,0x1f,
-0x03,0x9f,0x0c,0x28,0x11,0xfd,0x8d,0x02,0x15,0x0a,0x9b,0x00,0x1f,0xfd,0x28,0x01,
-0x26,0x20,0xfd,0x03,0x4a,0x00,0x13,0x03,0xd8,0x00,0x11,0xfc,0x87,0x03,0x0f,0x2e,
-0x03,0x29,0x07,0xfc,0x01,0x12,0xf9,0x3f,0x03,0x0f,0x0c,0x04,0x23,0x01,0xd5,0x00,
-0x04,0x2a,0x08,0x00,0x0c,0x00,0x0f,0xbc,0x01,0x26,0x09,0x4a,0x00,0x0f,0x32,0x05,
-0x34,0x1f,0xfd,0x9a,0x02,0x2c,0x09,0x01,0x00,0x1e,0xe8,0x70,0x0e,0x0f,0xe4,0x02,
-0x1a,0x04,0x6c,0x01,0x02,0x0c,0x02,0x11,0xf9,0xc4,0x25,0x11,0x02,0xe7,0x0d,0x10,
-0x03,0xd9,0x21,0x3d,0x00,0x04,0x05,0x36,0x00,0x02,0xb8,0x45,0x20,0x00,0x0c,0xba,
-0x45,0x92,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0xbf,0x45,0x01,0xbb,0x2a,
-0x00,0xc4,0x45,0x40,0x1d,0x1e,0x00,0x1f,0xc1,0x45,0xff,0x00,0x1f,0x1f,0x21,0x1b,
-0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x87,0x00,0x03,0xf5,0x2c,
-0x29,0x2a,0x2b,0x2c,0x2d,0x2e,0x2f,0x30,0x00,0x00,0x31,0x32,0x33,0x00,0x34,0x00,
-0x35,0x36,0x37,0x38,0x39,0x3a,0x3b,0x00,0x00,0x3c,0x3d,0x3e,0x00,0x3f,0x40,0x41,
-0x42,0x00,0x43,0x44,0x45,0x00,0x00,0x46,0x47,0x48,0x00,0x49,0x00,0x4a,0x4b,0x4c,
-0x4d,0x4e,0x4f,0x50,0x00,0x00,0x51,0x52,0x53,0x00,0x00,0xb0,0x00,0x20,0x03,0x02,
-0xab,0x00,0x4b,0x06,0x07,0x06,0x08,0x5d,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,
-0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0x24,0x0b,0x00,0x73,0x46,0x20,0x00,0x00,
-0x55,0x41,0x71,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,
-0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0xb0,
-0x00,0x01,0xf2,0x02,0x24,0x00,0x00,0x00,0x25,0x00,0x26,0x27,0x00,0x00,0x00,0x28,
-0x29,0x00,0x2a,0x2b,0x00,0xbe,0x00,0x01,0xba,0x2b,0x33,0x32,0x33,0x34,0xbf,0x00,
-0xf0,0x08,0x3c,0x3d,0x3e,0x3f,0x40,0x41,0x3d,0x42,0x43,0x44,0x45,0x46,0x47,0x36,
-0x48,0x36,0x3d,0x49,0x3b,0x4a,0x00,0x00,0x00,
+0x70,0x27,0x00,0x41,0x6a,0x20,0x3a,0xa0,0x38,0x00,0x31,0xef,0x56,0xff,0x08,0x00,
+0x41,0x0e,0xd5,0x04,0x90,0x09,0x00,0x41,0xa7,0x12,0xff,0x40,0x47,0x01,0x30,0xf3,
+0x0b,0x87,0x08,0x00,0x50,0x09,0x66,0x00,0x0b,0xf7,0x26,0x01,0xf0,0x02,0xff,0x30,
+0x00,0xcd,0x8b,0x10,0x00,0x0a,0xb6,0xb0,0x00,0x00,0x1d,0xf8,0xe7,0xeb,0xdf,0x7f,
+0x00,0x51,0x8a,0x8f,0x6f,0xe3,0x80,0x66,0x01,0x21,0x92,0x76,0x07,0x00,0x14,0x60,
+0x75,0x01,0x40,0x99,0xdf,0xec,0x70,0x3f,0x01,0xf0,0x2e,0xbf,0xfd,0xbb,0xef,0xe5,
+0x00,0x02,0xfe,0x20,0xbf,0xa0,0x00,0x4e,0xf6,0x00,0x5f,0xc0,0x00,0xaf,0xb0,0x00,
+0x1d,0xf3,0x00,0x9f,0xc1,0x00,0xaf,0x80,0x00,0x1f,0xc0,0x08,0xff,0xd1,0x1e,0xf4,
+0x00,0x00,0x8f,0x20,0xcd,0x6f,0xdd,0xf5,0x00,0x00,0x03,0xf6,0x0e,0xb0,0x5f,0xf6,
+0x00,0x00,0x00,0x2f,0x80,0xec,0x00,0x34,0x57,0x01,0x00,0x7c,0x05,0x01,0xb7,0x01,
+0x42,0x50,0x6f,0x50,0x00,0x8d,0x04,0x20,0xee,0x10,0x91,0x00,0x50,0xf8,0x00,0x04,
+0xfc,0x10,0xbf,0x01,0xf1,0x01,0x10,0x00,0x06,0xff,0x84,0x23,0x5b,0xfd,0x20,0x00,
+0x00,0x03,0xcf,0xff,0xff,0xf8,0x2f,0x00,0x31,0x26,0x77,0x40,0x08,0x00,0x71,0xbd,
+0xdd,0xdd,0xdd,0xdd,0x40,0x00,0xab,0x01,0xe0,0xe0,0x00,0x06,0xfe,0x21,0x11,0x13,
+0xf9,0x00,0x00,0xbf,0x80,0x00,0x00,0x79,0x01,0xe0,0xf2,0x00,0x00,0x0e,0xc0,0x00,
+0x04,0xfd,0x00,0x00,0x08,0xf6,0x00,0x00,0x9a,0x01,0xf0,0x00,0xf9,0x00,0x00,0x02,
+0xcf,0x60,0x1d,0xe4,0x00,0x00,0x02,0xff,0xec,0x0a,0xf2,0x17,0x02,0xf0,0x1c,0x4c,
+0x90,0xff,0x80,0x00,0x00,0x4f,0x80,0xf4,0x6d,0xde,0x00,0x00,0x06,0xf3,0x3f,0x0c,
+0x59,0xf1,0x00,0x00,0x6f,0x53,0x60,0x10,0xaf,0x00,0x00,0x01,0xfb,0x00,0x00,0x2f,
+0xb0,0x00,0x00,0x09,0xfb,0x31,0x5e,0xf3,0x00,0x00,0xda,0x01,0x11,0xf5,0x07,0x02,
+0x31,0x89,0x71,0x00,0x16,0x02,0x20,0x77,0x77,0x13,0x01,0xf0,0x04,0x4f,0xff,0xfe,
+0x00,0x00,0x01,0x15,0xff,0xff,0xe2,0x33,0x0e,0xff,0xff,0xfe,0xee,0xee,0xf4,0xf2,
+0x1e,0x00,0x21,0x0c,0x4f,0xbc,0x02,0xf1,0x00,0xc4,0xe2,0x0e,0xff,0xff,0xf2,0x0c,
+0x5e,0x20,0x9a,0xaa,0xaa,0x10,0xc5,0xe3,0x1a,0x00,0x22,0x5e,0x30,0x0d,0x00,0x02,
+0x1a,0x00,0x01,0xd4,0x02,0x03,0x1a,0x00,0xd3,0x5d,0xee,0xee,0xff,0xff,0xff,0xf5,
+0x12,0x26,0xff,0xff,0xe1,0x10,0x5b,0x00,0x43,0x00,0x01,0x55,0x55,0x01,0x03,0x30,
+0x03,0x44,0x10,0x10,0x00,0xf0,0x08,0x9f,0xff,0xff,0xc2,0xa3,0x00,0x04,0xef,0xff,
+0xee,0xff,0x5e,0xf8,0x03,0xff,0xe6,0x00,0x01,0x40,0xe5,0xbe,0xef,0xc1,0xeb,0x01,
+0x11,0x30,0xaa,0x00,0x51,0x00,0xe3,0x00,0x09,0xf7,0x0f,0x00,0x40,0x00,0x03,0xcc,
+0x20,0x0f,0x00,0x31,0x00,0x2d,0xb1,0x0f,0x00,0x21,0x6f,0x70,0x1e,0x00,0x20,0xae,
+0x30,0x1e,0x00,0x30,0x32,0xdf,0xe1,0x2d,0x00,0x40,0xe9,0xf8,0xef,0xb0,0x0f,0x00,
+0x82,0xe4,0x04,0xff,0xd6,0x00,0x02,0x40,0x91,0x5a,0x00,0x12,0x50,0x69,0x00,0x11,
+0xc1,0x78,0x00,0x50,0x54,0x10,0x00,0x0d,0xee,0x01,0x00,0xf2,0x28,0xed,0x01,0xf2,
+0x4f,0xfa,0x22,0x22,0x22,0xe1,0x1f,0x02,0xff,0x90,0x00,0x79,0xaf,0x11,0xf0,0x03,
+0x31,0x02,0xcf,0xff,0xf1,0x1f,0x00,0x12,0x04,0xff,0xff,0xff,0x11,0xf0,0x1f,0xfa,
+0x05,0xdf,0xff,0xf1,0x1f,0x02,0xff,0xb0,0x00,0x7a,0x9f,0x11,0xf0,0x09,0xa5,0x00,
+0x00,0x00,0xe1,0x1f,0x88,0x02,0x41,0x11,0xf0,0x1f,0xf9,0x0f,0x00,0x00,0x1e,0x00,
+0x00,0x0f,0x00,0x22,0x1b,0xc7,0x1e,0x00,0x22,0x67,0x40,0x1e,0x00,0x11,0xfb,0x0f,
+0x00,0x12,0x01,0x1e,0x00,0x90,0xfe,0xef,0xff,0xee,0xee,0xee,0xf0,0x01,0x22,0x01,
+0x00,0x10,0x21,0xf8,0x00,0x30,0x58,0x98,0x51,0x48,0x00,0x22,0x08,0xff,0x09,0x02,
+0xf0,0x00,0x1d,0xfc,0x7f,0x3e,0x5b,0xfc,0x10,0x00,0x0c,0xf7,0x02,0xf3,0xe0,0x07,
+0xfc,0xf4,0x04,0xf0,0x35,0x2f,0x3e,0x00,0x07,0xf7,0x00,0xed,0x00,0x02,0xf3,0xe0,
+0x00,0x0d,0xe0,0x3f,0x70,0x00,0x2f,0xfd,0x00,0x00,0x6f,0x35,0xf4,0x00,0x00,0x22,
+0x15,0x20,0x03,0xf5,0x6f,0x30,0x07,0xf4,0x04,0xff,0x60,0x2f,0x65,0xf5,0x09,0xe8,
+0xf2,0xdb,0x4e,0xb6,0xf5,0x1f,0xab,0xd3,0xcc,0x03,0xcd,0x39,0xff,0x10,0xbf,0xb3,
+0xea,0x00,0x00,0x7f,0x8f,0xb0,0x02,0xfd,0xf8,0x21,0x03,0xf0,0x02,0xf2,0x00,0x05,
+0xfe,0x40,0x00,0x00,0x4d,0xf5,0x00,0x00,0x04,0xef,0xd9,0x89,0xdf,0xe4,0x78,0x00,
+0x42,0x7d,0xff,0xfd,0x70,0x88,0x01,0x22,0x10,0x00,0x08,0x02,0x02,0x12,0x03,0x41,
+0x09,0xff,0xff,0xe2,0xd2,0x03,0x40,0xf9,0x00,0x4e,0xd0,0x09,0x00,0x40,0xeb,0x00,
+0x00,0x5f,0xb2,0x01,0xf0,0x07,0x1f,0x70,0x00,0x00,0xf8,0x1b,0xff,0x80,0x00,0xf8,
+0x00,0x00,0x1f,0x8c,0xff,0xff,0x90,0x0c,0xe1,0x00,0x08,0xf7,0x55,0x04,0xf0,0x0f,
+0x4f,0xd6,0x5a,0xfa,0x6f,0xff,0xff,0xf3,0x00,0x4d,0xff,0xff,0x64,0xff,0xff,0xff,
+0x00,0x03,0xef,0xdb,0xef,0xff,0xff,0xff,0x60,0x01,0xed,0x20,0x7f,0xff,0x67,0x04,
+0x30,0xaf,0x10,0x6f,0xd7,0x02,0x50,0x50,0x0f,0x80,0x2f,0xff,0xaf,0x05,0x31,0x02,
+0xf5,0x0b,0x90,0x04,0x32,0xf1,0x3f,0x75,0x99,0x04,0x13,0x22,0xa1,0x04,0x54,0xf2,
+0x03,0x33,0x20,0x00,0x01,0x00,0x13,0x60,0x28,0x05,0x12,0x90,0x08,0x00,0x23,0x4f,
+0xa0,0x10,0x00,0x13,0xb0,0x08,0x00,0xa2,0xc1,0x00,0x09,0x99,0x98,0x88,0x88,0xbf,
+0xd1,0x00,0x3d,0x00,0xb1,0xd2,0x0b,0xbb,0xbb,0xbb,0xbc,0xcc,0xcc,0xa0,0x16,0x66,
+0x01,0x00,0x22,0x60,0x6f,0x18,0x00,0xa4,0x00,0x5f,0xfe,0xde,0xee,0xff,0xff,0xf0,
+0x00,0x4f,0x3a,0x00,0x12,0xc0,0x08,0x00,0x13,0x3e,0x08,0x00,0x13,0x2e,0x08,0x00,
+0x16,0x2c,0x7c,0x00,0x01,0xc1,0x02,0x22,0xb9,0x40,0x09,0x00,0x41,0x57,0x9e,0xf9,
+0x10,0x24,0x01,0x41,0x20,0x03,0xbf,0x70,0x8d,0x04,0x41,0xfb,0x50,0x3d,0xb0,0x12,
+0x00,0x40,0x8e,0xd4,0x05,0x00,0xb9,0x06,0x31,0x71,0x06,0xd2,0xa3,0x05,0x32,0x7c,
+0xf8,0x00,0xdd,0x01,0x20,0x43,0x80,0xdd,0x01,0x40,0xf9,0x20,0x4c,0xd3,0x0b,0x04,
+0x50,0xf8,0x00,0x00,0x0c,0xf4,0xed,0x01,0xf0,0x0e,0x01,0xcf,0x80,0x4f,0xf1,0x00,
+0x00,0xff,0xd0,0x6f,0xff,0x11,0xff,0x70,0x00,0x0b,0xfe,0x04,0xff,0xe0,0x3f,0xf3,
+0x00,0x00,0x1e,0xf5,0x04,0x72,0x0a,0x50,0x02,0x60,0x2d,0xf5,0x00,0x08,0xf9,0x00,
+0x83,0x08,0xb0,0xcd,0xcd,0xa4,0x00,0x00,0x00,0x2a,0xaa,0xaa,0xaa,0x80,0x26,0x02,
+0x00,0x48,0x01,0xf0,0x0c,0x8f,0x00,0x00,0x15,0x6f,0xb0,0x08,0xf0,0x00,0x02,0xe0,
+0x8f,0xb0,0x8f,0x00,0x00,0x2f,0x33,0xcf,0x78,0xf0,0x00,0x02,0xdd,0xd6,0xf8,0x8f,
+0x33,0x00,0x21,0x0f,0x88,0x82,0x04,0x0f,0x0d,0x00,0x16,0x61,0x88,0x88,0x88,0x88,
+0x8f,0x86,0x24,0x01,0x15,0xf6,0xf6,0x00,0x32,0x01,0x31,0x00,0xa9,0x05,0x31,0xfe,
+0xfc,0x20,0x7e,0x06,0xf0,0x08,0x91,0x00,0x8f,0x23,0x10,0x00,0x00,0x07,0xb0,0x00,
+0x00,0x9f,0xef,0x90,0x00,0x00,0xc5,0x00,0x00,0x01,0x30,0x2c,0x90,0x81,0x03,0x00,
+0xff,0x04,0xf0,0x39,0x10,0x06,0xe2,0x00,0x00,0x02,0x6a,0x00,0xd4,0x01,0xf3,0x00,
+0x26,0xae,0xff,0xf2,0x0d,0x40,0x7b,0x04,0xef,0xff,0xc8,0x40,0x01,0xf1,0x0b,0x60,
+0x2c,0x84,0x38,0x00,0x00,0x2d,0x70,0xb5,0x00,0x00,0x0b,0xf3,0x00,0x00,0x3f,0x09,
+0x70,0x00,0x05,0xff,0xd0,0x00,0x00,0xd3,0x4d,0x00,0x01,0xef,0xff,0x60,0x00,0x0e,
+0x30,0xc8,0x00,0x14,0x44,0x43,0x00,0x03,0xf0,0x02,0xea,0x20,0x4e,0x01,0x90,0xd7,
+0x00,0x01,0x9f,0xfe,0xff,0xff,0xff,0xe6,0x88,0x00,0x43,0x22,0x11,0x11,0x10,0x94,
+0x00,0x13,0x49,0x33,0x04,0x23,0x06,0xf8,0x11,0x00,0x42,0x6f,0x80,0x8d,0x10,0x11,
+0x00,0x20,0x0e,0xd0,0x71,0x07,0xf0,0x06,0x05,0xef,0xe5,0x96,0x00,0x00,0x4e,0xff,
+0x93,0xfd,0x8d,0xf3,0x00,0x00,0x2f,0xe7,0x8b,0x8f,0x20,0x2f,0x80,0xbd,0x07,0xf0,
+0x00,0x08,0xf2,0x02,0xf8,0x00,0x00,0xf9,0x00,0x00,0x2f,0xea,0xef,0x20,0x00,0x4f,
+0x07,0x03,0x51,0xfe,0x40,0x00,0x07,0xf0,0x44,0x00,0x33,0x00,0x00,0xac,0x55,0x00,
+0x23,0x0c,0xa0,0x11,0x00,0x13,0xe8,0x11,0x00,0x22,0x0f,0x70,0x11,0x00,0x28,0x01,
+0xf6,0x77,0x00,0x10,0x00,0x39,0x05,0xf0,0x0d,0xeb,0x18,0xc3,0xb9,0xc6,0x04,0xd9,
+0xa0,0x8b,0x1d,0xfe,0x20,0x01,0x00,0x00,0x00,0x7c,0xef,0xdb,0x40,0x00,0x02,0xdf,
+0xc8,0x79,0xef,0xa0,0x00,0x6c,0x06,0x30,0xaf,0x70,0x7f,0xb2,0x02,0x31,0xa4,0x0c,
+0xf1,0x30,0x00,0x90,0xfe,0x11,0x11,0x11,0x00,0x00,0x0f,0xff,0xff,0xfa,0x00,0x83,
+0xee,0x44,0x44,0x43,0x00,0x00,0x0c,0xf1,0xc5,0x00,0x00,0xc7,0x06,0x70,0x00,0xdf,
+0x60,0x00,0x00,0x9f,0x70,0x41,0x00,0x00,0x30,0x07,0x8c,0x6c,0xef,0xea,0x40,0x00,
+0x4f,0x84,0xf8,0x03,0x00,0x70,0x80,0xa6,0x03,0xa2,0xf9,0x04,0xf3,0xb3,0x06,0x1f,
+0xf8,0x03,0x00,0x11,0x00,0xba,0x01,0x11,0xf9,0xa3,0x02,0x11,0xfe,0xee,0x01,0x30,
+0xaf,0x6f,0x60,0xc5,0x03,0x20,0xa0,0xec,0xdc,0x03,0x40,0xf4,0x08,0xf3,0x00,0xba,
+0x08,0x60,0x2f,0x90,0x00,0x00,0x4f,0x70,0xd5,0x08,0x81,0x0b,0xf2,0x11,0x16,0xf6,
+0x00,0x02,0xff,0xa7,0x00,0x60,0x8f,0x64,0x44,0x44,0xaf,0x30,0x5a,0x01,0x50,0x02,
+0xfa,0x05,0xf7,0x00,0xb1,0x00,0x20,0xcf,0x10,0xda,0x06,0x20,0x70,0x7f,0xa4,0x03,
+0x81,0x07,0xf9,0x66,0x66,0x66,0x10,0x7f,0x50,0xf8,0x07,0x00,0x5c,0x00,0x02,0x0b,
+0x00,0x10,0xf6,0xaf,0x01,0xb0,0x7f,0xff,0xff,0xfe,0x81,0x07,0xf8,0x44,0x45,0xaf,
+0xd0,0x16,0x00,0x80,0x9f,0x57,0xf5,0x00,0x00,0x05,0xf7,0x7f,0x17,0x01,0xb0,0x47,
+0xf9,0x66,0x67,0xbf,0xb0,0x7f,0xff,0xff,0xfd,0x70,0x27,0x00,0xd0,0xeb,0x40,0x07,
+0xf9,0x66,0x68,0xef,0x50,0x7f,0x50,0x00,0x02,0xfc,0x48,0x00,0x10,0x0e,0x32,0x00,
+0x80,0x01,0xfb,0x07,0xf6,0x11,0x14,0xce,0x20,0x48,0x00,0x10,0x40,0x48,0x00,0x20,
+0x9f,0xa0,0x3d,0x00,0x30,0x6f,0x67,0xf5,0x8d,0x00,0x00,0x0b,0x00,0xd0,0x7f,0x87,
+0xf9,0x66,0x67,0xaf,0xe1,0x7f,0xff,0xff,0xed,0x71,0x00,0x90,0x00,0x10,0xf7,0x8f,
+0x00,0x23,0x7f,0x50,0x8d,0x00,0x0f,0x09,0x00,0x15,0x00,0xc6,0x03,0x00,0x69,0x07,
+0xf0,0x02,0x00,0x0f,0xc7,0x77,0xee,0x00,0x00,0x02,0xf8,0x00,0x0d,0xe0,0x00,0x00,
+0x4f,0x60,0x00,0x3b,0x07,0x11,0xf4,0x0d,0x00,0x41,0x9f,0x20,0x00,0xde,0xc7,0x07,
+0x21,0x0d,0xe0,0xe4,0x09,0x20,0xde,0x00,0x31,0x01,0x20,0x0d,0xe0,0x45,0x00,0x00,
+0x0d,0x00,0xd1,0xdf,0x00,0x00,0x0d,0xe0,0x06,0xaf,0xc7,0x77,0x77,0xef,0x73,0xdf,
+0x46,0x03,0x30,0x8d,0xd0,0x00,0x4b,0x00,0x11,0xdd,0x19,0x03,0x09,0x0d,0x00,0x20,
+0x80,0x7f,0x20,0x00,0x10,0x77,0xab,0x00,0x2e,0x63,0x7f,0x3a,0x01,0x30,0x11,0x11,
+0x10,0x21,0x00,0x7d,0xfe,0x07,0xf8,0x44,0x44,0x44,0x40,0x21,0x00,0x00,0x37,0x00,
+0x21,0x65,0x7f,0x9d,0x01,0x21,0x1e,0xd0,0x2f,0x0c,0x41,0x5f,0x80,0x04,0xf8,0x3b,
+0x0c,0x90,0xed,0x00,0x00,0xaf,0x20,0x01,0xfa,0x00,0x09,0x45,0x04,0x60,0xc0,0x01,
+0xfa,0x00,0x4f,0x80,0x23,0x02,0x40,0x01,0xfa,0x01,0xec,0x40,0x00,0x51,0x8f,0x73,
+0xfa,0x3c,0xe2,0x3e,0x05,0x02,0x81,0x02,0x70,0x00,0x01,0xed,0x14,0xfb,0x25,0xf8,
+0xc8,0x02,0xf0,0x03,0xf3,0x01,0xfa,0x00,0xbf,0x30,0x00,0x00,0x5f,0x90,0x01,0xfa,
+0x00,0x1f,0xd0,0x00,0x01,0xee,0x51,0x00,0x51,0x06,0xf9,0x00,0x0b,0xf4,0x63,0x00,
+0x41,0xcf,0x40,0x6f,0xa0,0x09,0x00,0xf1,0x05,0x2f,0xe0,0x00,0x18,0xdf,0xfc,0x50,
+0x00,0x2d,0xfa,0x78,0xdf,0x70,0x0b,0xf5,0x00,0x00,0xef,0x00,0x68,0xc7,0x0e,0x11,
+0x00,0x07,0x01,0x30,0x00,0x13,0xaf,0xea,0x01,0x00,0xe6,0x09,0x41,0x02,0x46,0xaf,
+0xa0,0x76,0x00,0x20,0x50,0x63,0x85,0x00,0xf0,0x08,0x1f,0xd2,0x00,0x00,0xaf,0x50,
+0x5f,0xf9,0x67,0xcf,0xb0,0x00,0x3a,0xdf,0xfc,0x60,0x00,0x7f,0x20,0x00,0x00,0x4f,
+0xf1,0x06,0x00,0x10,0xdf,0x06,0x00,0x20,0x08,0xfb,0x06,0x00,0x20,0x3f,0xa7,0x06,
+0x00,0xd0,0xce,0x17,0xf1,0x7f,0x20,0x06,0xf6,0x07,0xf1,0x7f,0x20,0x1f,0xc0,0x06,
+0x00,0xd0,0xbf,0x20,0x07,0xf1,0x7f,0x25,0xf8,0x00,0x07,0xf1,0x7f,0x3e,0xd0,0x06,
+0x00,0x20,0xaf,0x40,0x06,0x00,0xb0,0xfa,0x00,0x00,0x07,0xf1,0x7f,0xe1,0x00,0x00,
+0x07,0xf1,0xf0,0x0f,0x00,0x6f,0x10,0x05,0xf3,0x00,0x00,0x2f,0x90,0x1c,0xe0,0x00,
+0x00,0x06,0xef,0xfd,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x7f,0x20,0x00,0x00,
+0x4f,0xf1,0x06,0x00,0x10,0xdf,0x06,0x00,0x20,0x08,0xfb,0x06,0x00,0x20,0x3f,0xa7,
+0x06,0x00,0xd0,0xce,0x17,0xf1,0x7f,0x20,0x06,0xf6,0x07,0xf1,0x7f,0x20,0x1f,0xc0,
+0x06,0x00,0xd0,0xbf,0x20,0x07,0xf1,0x7f,0x25,0xf8,0x00,0x07,0xf1,0x7f,0x3e,0xd0,
+0x06,0x00,0x20,0xaf,0x40,0x06,0x00,0x20,0xfa,0x00,0x06,0x00,0x11,0xe1,0x06,0x00,
+0xf0,0x4a,0x50,0x00,0x0a,0xf3,0x7f,0x50,0x00,0x4f,0x80,0x7f,0x50,0x00,0xed,0x00,
+0x7f,0x50,0x09,0xf3,0x00,0x7f,0x50,0x4f,0x80,0x00,0x7f,0x65,0xfb,0x00,0x00,0x7f,
+0xff,0xf8,0x00,0x00,0x7f,0x71,0xaf,0x30,0x00,0x7f,0x50,0x1e,0xd0,0x00,0x7f,0x50,
+0x06,0xf9,0x00,0x7f,0x50,0x00,0xbf,0x40,0x7f,0x50,0x00,0x2f,0xd0,0x7f,0x50,0x00,
+0x06,0xf9,0x00,0x04,0xff,0xff,0xff,0xe0,0x00,0x6f,0x97,0x77,0xee,0x00,0x08,0xf2,
+0x00,0x0d,0xe0,0x00,0xaf,0x00,0x00,0xde,0x00,0x0c,0xe0,0x0b,0x00,0x10,0xfc,0x0b,
+0x00,0x70,0x1f,0x90,0x00,0x0d,0xe0,0x04,0xf7,0x0b,0x00,0xf0,0x49,0x7f,0x40,0x00,
+0x0d,0xe0,0x0a,0xf1,0x00,0x00,0xde,0x01,0xfc,0x00,0x00,0x0d,0xe5,0xcf,0x50,0x00,
+0x00,0xde,0xce,0x80,0x00,0x00,0x0d,0xe0,0x7f,0xf1,0x00,0x00,0x00,0x3f,0xf4,0x7f,
+0xf7,0x00,0x00,0x00,0x9f,0xf4,0x7f,0xbd,0x00,0x00,0x00,0xec,0xf4,0x7f,0x6f,0x30,
+0x00,0x05,0xf7,0xf4,0x7f,0x2e,0x90,0x00,0x0b,0xc5,0xf4,0x7f,0x29,0xf0,0x00,0x1f,
+0x65,0xf4,0x7f,0x23,0xf6,0x00,0x7f,0x15,0xf4,0x7f,0x20,0xdc,0x00,0xda,0x05,0xf4,
+0x7f,0x20,0x6f,0x23,0xf4,0x07,0x00,0x30,0x1f,0x89,0xe0,0x07,0x00,0x30,0x0a,0xce,
+0x80,0x07,0x00,0x30,0x04,0xff,0x20,0x07,0x00,0xbf,0x00,0xdc,0x00,0x05,0xf4,0x7f,
+0x50,0x00,0x00,0x09,0xf2,0x06,0x00,0x06,0xff,0x02,0x62,0x22,0x22,0x2a,0xf2,0x7f,
+0xff,0xff,0xff,0xff,0xf2,0x7f,0x85,0x55,0x55,0x5b,0xf2,0x30,0x00,0x0b,0xf0,0x1d,
+0x00,0x00,0x6c,0xef,0xeb,0x50,0x00,0x00,0x3d,0xfc,0x87,0x8d,0xfb,0x10,0x01,0xef,
+0x40,0x00,0x00,0x7f,0xb0,0x08,0xf6,0x00,0x00,0x00,0x0a,0xf4,0x0d,0xf0,0x00,0x00,
+0x00,0x03,0xfa,0x0f,0xc0,0x00,0x00,0x00,0x00,0xfc,0x1f,0xb0,0x07,0x00,0x13,0xfd,
+0x0e,0x00,0x02,0x1c,0x00,0x30,0xf9,0x07,0xf7,0x2a,0x00,0xf3,0x00,0xf3,0x00,0xdf,
+0x50,0x00,0x00,0x7f,0xa0,0x00,0x2d,0xfc,0x86,0x8d,0xfb,0x00,0x54,0x00,0x03,0x85,
+0x00,0x41,0xa7,0x77,0x77,0x7c,0x6d,0x00,0x1f,0x0a,0x06,0x00,0x2b,0xa0,0xff,0xff,
+0xfd,0x80,0x07,0xf9,0x66,0x67,0xbf,0xc0,0x11,0x00,0x30,0x9f,0x67,0xf5,0x80,0x00,
+0x00,0x0b,0x00,0xf0,0x0a,0x2f,0x97,0xf5,0x00,0x00,0x06,0xf6,0x7f,0x61,0x11,0x27,
+0xfe,0x17,0xff,0xff,0xff,0xfc,0x20,0x7f,0x84,0x44,0x31,0x00,0x07,0xf5,0xa9,0x00,
+0x00,0x21,0x00,0x07,0x0b,0x00,0x00,0x01,0x00,0x10,0x7c,0x9d,0x00,0x61,0x02,0xdf,
+0xc8,0x79,0xef,0xa0,0xb8,0x00,0xb1,0xaf,0x70,0x7f,0x70,0x00,0x00,0x00,0x83,0x0c,
+0xf0,0x00,0xe2,0x00,0x01,0x06,0x00,0x02,0xe7,0x00,0x21,0x00,0xed,0x06,0x00,0x21,
+0x0c,0xf1,0x07,0x00,0xf0,0x04,0x6f,0x90,0x00,0x00,0x00,0xc8,0x00,0xdf,0x70,0x00,
+0x00,0xaf,0x60,0x02,0xdf,0xd8,0x79,0xef,0x80,0xeb,0x00,0x41,0xda,0x30,0x00,0x9f,
+0xeb,0x00,0x82,0x36,0x66,0x7f,0xd6,0x66,0x61,0x00,0x00,0x2a,0x01,0x0f,0x06,0x00,
+0x27,0x21,0x3f,0xc0,0x7a,0x00,0x21,0x9f,0x60,0xb4,0x00,0xf0,0x08,0xee,0x10,0x00,
+0x0e,0xc0,0x00,0x05,0xf9,0x00,0x07,0xf4,0x00,0x00,0x0b,0xf2,0x00,0xeb,0x00,0x00,
+0x00,0x2f,0xb0,0x7f,0x41,0x03,0x30,0x8f,0x6e,0xa0,0x34,0x00,0x20,0xdf,0xf2,0x06,
+0x00,0x21,0x05,0xf9,0xa5,0x00,0x20,0xaf,0x10,0x06,0x00,0x10,0x4f,0xd2,0x00,0x30,
+0x98,0x7f,0xd0,0x9e,0x01,0x22,0xee,0xa1,0xf8,0x00,0x26,0x0a,0xf1,0x21,0x00,0xf0,
+0x0b,0x8d,0xff,0xff,0xeb,0x30,0x00,0xdf,0x95,0xbf,0x57,0xef,0x50,0x8f,0x70,0x0a,
+0xf1,0x01,0xee,0x0c,0xf0,0x00,0xaf,0x10,0x09,0xf3,0xee,0x27,0x00,0x22,0x7f,0x5c,
+0x0d,0x00,0xf5,0x09,0x8f,0x50,0x0a,0xf1,0x00,0xee,0x00,0xdf,0x61,0xaf,0x23,0xcf,
+0x50,0x01,0xaf,0xff,0xff,0xfd,0x40,0x00,0x00,0x02,0xbf,0x41,0x4e,0x00,0xf1,0x08,
+0x0c,0xf2,0x00,0x00,0x06,0xf8,0x00,0x2f,0xc0,0x00,0x02,0xfc,0x00,0x00,0x5f,0x80,
+0x00,0xcf,0x20,0x00,0x00,0x9f,0x40,0x6a,0x01,0x20,0xde,0x4f,0x9d,0x00,0x31,0x02,
+0xff,0xd0,0x42,0x01,0x10,0xfa,0x06,0x00,0x20,0x08,0xfc,0x89,0x01,0x80,0x04,0xf9,
+0x0d,0xf2,0x00,0x00,0x01,0xed,0x37,0x00,0x90,0x00,0xbf,0x30,0x00,0x7f,0x70,0x00,
+0x7f,0x70,0x0a,0x00,0x21,0x3f,0xb0,0x17,0x00,0x01,0xf0,0x01,0x31,0xf1,0x07,0xf5,
+0xac,0x00,0x0f,0x0d,0x00,0x28,0x61,0xfa,0x77,0x77,0x77,0xcf,0x75,0x86,0x02,0x21,
+0xff,0xb0,0xfb,0x00,0x12,0xfb,0xdb,0x01,0x0a,0x0d,0x00,0x70,0x8f,0x40,0x00,0x00,
+0xaf,0x18,0xf4,0x33,0x00,0x0f,0x0b,0x00,0x03,0xf5,0x07,0x6f,0x60,0x00,0x00,0xaf,
+0x12,0xfe,0x52,0x24,0x7d,0xf1,0x05,0xff,0xff,0xfe,0xef,0x10,0x00,0x34,0x31,0x0a,
+0xf1,0x4b,0x01,0x04,0x0b,0x00,0x00,0x45,0x04,0xbf,0x90,0x00,0x0e,0xd7,0xf5,0x00,
+0x02,0xf9,0x00,0x00,0xed,0x0f,0x00,0x31,0x72,0xfa,0x77,0x78,0xfc,0x77,0x77,0xed,
+0xc3,0x00,0x10,0xff,0xa2,0x04,0xef,0x5f,0x60,0x00,0x4f,0x70,0x07,0xf5,0x00,0x05,
+0xf6,0x00,0x04,0xf7,0x00,0x11,0x00,0x3a,0x83,0xfa,0x77,0x7a,0xfa,0x77,0x79,0xfb,
+0x70,0x6e,0x00,0x22,0xff,0x10,0x36,0x02,0x11,0x09,0x36,0x02,0x00,0xc7,0x04,0x0e,
+0x11,0x00,0x0c,0x5d,0x03,0x08,0x0b,0x00,0x40,0xf6,0x11,0x10,0x00,0x03,0x04,0x81,
+0xfe,0x81,0x07,0xf8,0x44,0x45,0xaf,0xd0,0xb5,0x03,0x61,0x57,0xf5,0x00,0x00,0x05,
+0xf7,0x0b,0x00,0x10,0x47,0xcb,0x03,0x10,0xb0,0xd6,0x03,0x11,0x70,0x32,0x00,0x40,
+0x7c,0xff,0xd9,0x20,0x09,0x00,0x50,0x1d,0xf8,0x44,0x6d,0xf6,0x09,0x00,0x20,0xce,
+0x20,0x14,0x02,0x41,0x7f,0x50,0x05,0xf6,0x17,0x03,0x21,0x7f,0x50,0x69,0x01,0x60,
+0x0b,0xf1,0x7f,0x62,0x2d,0xe0,0x87,0x00,0x00,0x12,0x04,0x10,0xe0,0x55,0x02,0x62,
+0xf4,0x7f,0x85,0x5e,0xf0,0x00,0xd3,0x04,0x20,0x0c,0xf2,0x6d,0x02,0x50,0xf0,0x7f,
+0x50,0x07,0xf9,0x81,0x05,0xf0,0x03,0xa0,0x7f,0x50,0x01,0xef,0x60,0x00,0x01,0xdf,
+0x20,0x7f,0x50,0x00,0x3e,0xfc,0x76,0x9f,0xf5,0x5a,0x00,0xf0,0x06,0x01,0x7c,0xef,
+0xd9,0x20,0x00,0x00,0x18,0xdf,0xff,0xff,0xff,0x20,0x0d,0xfb,0x76,0x66,0x6c,0xf2,
+0x06,0xf8,0xd1,0x00,0x30,0x20,0x9f,0x30,0x47,0x00,0x21,0x06,0xf6,0x0d,0x00,0x90,
+0x1e,0xf6,0x21,0x11,0x1a,0xf2,0x00,0x2b,0xff,0x27,0x00,0x90,0x00,0x0a,0xf5,0x44,
+0x4b,0xf2,0x00,0x04,0xf9,0x1a,0x00,0x30,0x00,0xde,0x10,0x3b,0x05,0x20,0x8f,0x60,
+0x0d,0x00,0x20,0x2f,0xd0,0x34,0x00,0x31,0x0c,0xf3,0x00,0x1a,0x00,0xd1,0x4b,0xef,
+0xd7,0x00,0x00,0x4f,0xb5,0x48,0xf9,0x00,0x06,0xb1,0x00,0x52,0x04,0x00,0x39,0x01,
+0xf0,0x11,0x8d,0xef,0xff,0xf1,0x00,0xbf,0x83,0x22,0xaf,0x10,0x1f,0xa0,0x00,0x0b,
+0xf1,0x02,0xf9,0x00,0x03,0xff,0x10,0x0d,0xf5,0x37,0xd9,0xf7,0x10,0x2b,0xfe,0xb2,
+0x1d,0xf7,0x29,0x03,0xd0,0x20,0x00,0x04,0x9c,0xff,0x90,0x00,0xbf,0xda,0x74,0x10,
+0x0b,0xc2,0xbd,0x00,0x00,0x70,0x01,0xf0,0x01,0x8b,0x2a,0xef,0xc4,0x00,0xba,0xd7,
+0x35,0xdf,0x40,0xdf,0x60,0x00,0x1f,0xb0,0xef,0xdd,0x00,0x60,0xde,0x00,0x00,0x0b,
+0xf0,0xce,0x05,0x00,0x10,0x9f,0x6b,0x06,0xff,0x36,0x4f,0x50,0x00,0x2f,0xa0,0x0b,
+0xf7,0x46,0xef,0x20,0x00,0x8e,0xfe,0xa2,0x00,0xbf,0xff,0xfd,0x91,0x0b,0xf4,0x44,
+0x8f,0xa0,0xbf,0x00,0x00,0xde,0x0b,0xf0,0x00,0x4f,0x80,0xbf,0xff,0xff,0x90,0x0b,
+0xf2,0x23,0x6f,0xb0,0xbf,0x00,0x00,0x9f,0x2b,0xf0,0x00,0x09,0xf3,0xbf,0x33,0x36,
+0xfd,0x0b,0xff,0xff,0xd9,0x10,0xbf,0xff,0xf6,0xbf,0x33,0x31,0xbf,0x00,0x00,0x03,
+0x00,0x02,0xf0,0x0f,0x00,0x0a,0xff,0xff,0xf6,0x00,0x00,0xcd,0x33,0x6f,0x60,0x00,
+0x0e,0xb0,0x04,0xf6,0x00,0x01,0xf8,0x00,0x4f,0x60,0x00,0x4f,0x50,0x04,0xf6,0x00,
+0x08,0xf2,0x0b,0x00,0x40,0xce,0x00,0x04,0xf6,0x12,0x07,0x90,0x4f,0x60,0x29,0xf6,
+0x33,0x36,0xf8,0x2d,0xff,0x7f,0x05,0x10,0xdb,0x83,0x01,0x10,0xcd,0x65,0x03,0x17,
+0xcc,0x0b,0x00,0xf0,0x0f,0x00,0x3b,0xef,0xd8,0x00,0x03,0xfd,0x53,0x7f,0xc0,0x0c,
+0xe1,0x00,0x06,0xf4,0x0f,0xa0,0x00,0x02,0xf9,0x2f,0xff,0xff,0xff,0xfa,0x2f,0xb3,
+0x33,0x33,0x32,0x94,0x03,0x00,0xdd,0x04,0xf0,0x48,0x02,0x92,0x03,0xfe,0x64,0x6e,
+0xe0,0x00,0x3a,0xef,0xe9,0x10,0x7f,0x30,0x07,0xf3,0x00,0x8f,0x30,0xbd,0x00,0x7f,
+0x30,0x3f,0x70,0x01,0xe9,0x07,0xf3,0x0d,0xb0,0x00,0x04,0xf7,0x8f,0x4a,0xd1,0x00,
+0x00,0x0d,0xff,0xff,0xf9,0x00,0x00,0x06,0xf4,0x9f,0x48,0xf2,0x00,0x00,0xeb,0x07,
+0xf3,0x1f,0xb0,0x00,0x8f,0x30,0x7f,0x30,0x8f,0x30,0x2f,0xb0,0x07,0xf3,0x00,0xec,
+0x0a,0xf2,0x00,0x7f,0x30,0x07,0xf5,0x02,0xbe,0xfd,0x70,0x0e,0xd5,0x49,0xf7,0x05,
+0x20,0xed,0x03,0x90,0x28,0xf5,0x00,0x0d,0xfe,0x50,0x00,0x03,0x5c,0xa5,0x02,0xf1,
+0x38,0xee,0x39,0x10,0x00,0xde,0x2f,0xc5,0x49,0xf8,0x03,0xbe,0xfd,0x70,0xbf,0x00,
+0x00,0xcf,0x4b,0xf0,0x00,0x6f,0xf4,0xbf,0x00,0x0e,0xcf,0x4b,0xf0,0x08,0xe5,0xf4,
+0xbf,0x02,0xf5,0x4f,0x4b,0xe0,0xbc,0x04,0xf4,0xbe,0x4f,0x20,0x4f,0x4b,0xed,0x90,
+0x04,0xf4,0xbf,0xe1,0x00,0x4f,0x4b,0xf6,0x00,0x04,0xf4,0x0f,0x80,0x00,0xea,0x00,
+0xbe,0x20,0x6f,0x50,0x01,0xbf,0xff,0x80,0xc4,0x08,0x0f,0x3f,0x00,0x1a,0xf0,0x16,
+0xbf,0x00,0x0c,0xe1,0xbf,0x00,0x7f,0x30,0xbf,0x02,0xf7,0x00,0xbf,0x2d,0xb0,0x00,
+0xbf,0xff,0x50,0x00,0xbf,0x1c,0xd0,0x00,0xbf,0x04,0xf7,0x00,0xbf,0x00,0xbe,0x10,
+0xbf,0x00,0x3f,0x90,0xbf,0x0a,0x01,0xf0,0x09,0x0f,0xff,0xff,0xfc,0x00,0x1f,0xa3,
+0x33,0xec,0x00,0x3f,0x60,0x00,0xec,0x00,0x6f,0x40,0x00,0xec,0x00,0x8f,0x10,0x00,
+0xec,0x91,0x08,0xf6,0x46,0xec,0x00,0xdc,0x00,0x00,0xec,0x02,0xf8,0x00,0x00,0xec,
+0x3b,0xf2,0x00,0x00,0xec,0xde,0x60,0x00,0x00,0xec,0xbf,0xf1,0x00,0x00,0xef,0xcb,
+0xef,0x60,0x00,0x3f,0xec,0xbe,0xac,0x00,0x09,0xcd,0xcb,0xe5,0xf1,0x00,0xe7,0xdc,
+0xbf,0x0f,0x60,0x3f,0x1d,0xcb,0xf0,0xac,0x09,0xc0,0xdc,0xbf,0x05,0xf1,0xe7,0x0d,
+0xcb,0xf0,0x0f,0x8f,0x20,0xdc,0xbf,0x00,0xae,0xc0,0x0d,0xcb,0xf0,0x04,0xf7,0x00,
+0xdc,0xbf,0x00,0x00,0x8f,0x2b,0xf0,0x00,0x08,0xf2,0x09,0x00,0x8e,0xff,0xff,0xff,
+0x2b,0xf3,0x33,0x39,0xf2,0x1b,0x00,0xf1,0x0a,0x00,0x3b,0xef,0xe9,0x10,0x04,0xfd,
+0x54,0x7f,0xd0,0x0c,0xf1,0x00,0x06,0xf6,0x1f,0xa0,0x00,0x01,0xfa,0x2f,0x90,0x00,
+0x00,0xfb,0x05,0x00,0xf0,0x05,0x0f,0xb0,0x00,0x02,0xf9,0x0c,0xf1,0x00,0x07,0xf5,
+0x03,0xfd,0x54,0x8f,0xc0,0x00,0x3b,0xff,0xd8,0x00,0x4d,0x00,0x40,0xbf,0x33,0x33,
+0xcf,0x52,0x02,0x0f,0x04,0x00,0x09,0xf0,0x1f,0xbd,0x2b,0xff,0xb2,0x0b,0xfd,0x62,
+0x4e,0xe1,0xbf,0x60,0x00,0x5f,0x7b,0xf1,0x00,0x01,0xfa,0xbf,0x00,0x00,0x0f,0xbb,
+0xf0,0x00,0x00,0xfb,0xbf,0x10,0x00,0x1f,0xab,0xf6,0x00,0x06,0xf6,0xbf,0xd7,0x46,
+0xfe,0x0b,0xf2,0xbf,0xfb,0x20,0xbf,0x2d,0x02,0x00,0x5c,0x03,0x05,0x09,0x00,0xe0,
+0x00,0x3b,0xff,0xc4,0x00,0x3f,0xc6,0x5b,0xf4,0x0c,0xe0,0x00,0x0e,0xb0,0x6d,0x06,
+0x00,0x92,0x00,0x22,0x02,0xf9,0xef,0x05,0xf0,0x0b,0x01,0x10,0xcf,0x10,0x00,0xed,
+0x03,0xfd,0x65,0xbf,0x50,0x03,0xbf,0xfc,0x50,0xaf,0xff,0xff,0xff,0x62,0x33,0x9f,
+0x53,0x31,0x00,0x07,0xb6,0x03,0x00,0x4b,0x07,0x0f,0x09,0x00,0x07,0xf0,0x21,0xcf,
+0x00,0x00,0x07,0xf4,0x5f,0x60,0x00,0x0c,0xe0,0x0e,0xc0,0x00,0x2f,0x80,0x09,0xf2,
+0x00,0x7f,0x20,0x02,0xf8,0x00,0xdb,0x00,0x00,0xce,0x02,0xf5,0x00,0x00,0x5f,0x48,
+0xe0,0x00,0x00,0x0e,0x9e,0x90,0x00,0x00,0x09,0xff,0x30,0x00,0x00,0x02,0xfd,0xcb,
+0x03,0x01,0x3f,0x09,0xa2,0xe0,0x00,0x00,0x14,0xaf,0x50,0x00,0x00,0x5f,0xe6,0x2f,
+0x05,0x22,0x07,0x40,0x08,0x00,0x22,0xf9,0x00,0x79,0x06,0x17,0x90,0x0f,0x00,0xf1,
+0x0b,0x8e,0xfb,0x2f,0x96,0xdf,0xd4,0x00,0x7f,0xa4,0x6c,0xfc,0xb4,0x5e,0xf2,0x0e,
+0xe0,0x00,0x6f,0xe0,0x00,0x4f,0x81,0xfa,0x00,0x01,0xfb,0x5c,0x01,0x00,0x2d,0x00,
+0x31,0x0e,0xc2,0xf9,0x2d,0x00,0x30,0xfc,0x1f,0xa0,0x25,0x08,0xfc,0x09,0x0f,0xb0,
+0xee,0x00,0x06,0xff,0x10,0x05,0xf8,0x08,0xfb,0x57,0xcf,0xdc,0x56,0xef,0x20,0x08,
+0xef,0xb2,0xf9,0x6d,0xfd,0x40,0x5a,0x00,0x0a,0x0f,0x00,0xf0,0x02,0x4f,0x80,0x00,
+0x2f,0xb0,0x09,0xf3,0x00,0xbe,0x10,0x00,0xdd,0x06,0xf5,0x00,0x00,0x3f,0xb9,0x00,
+0x21,0x07,0xfe,0xeb,0x03,0xf0,0x08,0x20,0x00,0x00,0x5f,0x6d,0xc0,0x00,0x01,0xeb,
+0x03,0xf8,0x00,0x0b,0xe1,0x00,0x9f,0x40,0x6f,0x50,0x00,0x0d,0xe1,0xbf,0xc0,0x04,
+0x0f,0x05,0x00,0x11,0x40,0x33,0x33,0xaf,0x41,0xed,0x01,0x10,0xf7,0xd9,0x0b,0x0c,
+0x05,0x00,0x44,0xec,0x00,0x01,0xf9,0x04,0x00,0xf6,0x03,0xdc,0x00,0x01,0xf9,0xbf,
+0x41,0x26,0xf9,0x3e,0xff,0xea,0xf9,0x00,0x32,0x01,0xf9,0x00,0x00,0x04,0x00,0xdf,
+0xbf,0x00,0x03,0xf7,0x00,0x0c,0xeb,0xf0,0x00,0x3f,0x70,0x00,0xce,0x0d,0x00,0x15,
+0x61,0x33,0x35,0xf9,0x33,0x3c,0xeb,0xb4,0x06,0x20,0xfe,0xbf,0x91,0x04,0x40,0x0d,
+0xd0,0x0b,0xf0,0x9e,0x04,0x2f,0xdd,0x00,0x0f,0x00,0x1b,0x72,0x33,0x36,0xf8,0x33,
+0x3d,0xd3,0x0b,0xff,0x06,0x12,0xf3,0x36,0x01,0x31,0x5f,0x30,0x00,0x5d,0x09,0x0c,
+0x0f,0x00,0x0d,0x83,0x02,0x00,0x79,0x05,0x60,0x81,0x0b,0xf2,0x23,0x7f,0xb0,0xcf,
+0x02,0xb0,0x0b,0xf0,0x00,0x0c,0xf1,0xbf,0x22,0x37,0xfb,0x0b,0xff,0x05,0x03,0xd0,
+0x00,0x02,0xae,0xfd,0x70,0x0b,0xf0,0x01,0xfc,0x31,0x6f,0x90,0xbf,0x27,0x06,0xa0,
+0xaf,0x1b,0xf0,0x0d,0xe0,0x00,0x06,0xf5,0xbf,0xff,0x38,0x09,0xf0,0x3c,0x6b,0xf3,
+0x3e,0xd0,0x00,0x05,0xf6,0xbf,0x00,0xce,0x00,0x00,0x6f,0x5b,0xf0,0x08,0xf3,0x00,
+0x0b,0xf1,0xbf,0x00,0x1e,0xe6,0x4a,0xf8,0x0b,0xf0,0x00,0x2a,0xef,0xd6,0x00,0x00,
+0x7d,0xff,0xff,0xf0,0x8f,0x93,0x22,0xbf,0x0d,0xe0,0x00,0x0b,0xf0,0xed,0x00,0x00,
+0xbf,0x0a,0xf6,0x00,0x0b,0xf0,0x1b,0xff,0xff,0xff,0x00,0x1e,0xb2,0x2b,0xf0,0x0c,
+0xe1,0x00,0xbf,0x0a,0xf3,0x00,0x0b,0xf7,0xf6,0x91,0x00,0xf0,0x01,0x3b,0xef,0xd6,
+0x00,0x03,0xfb,0x54,0x8f,0x90,0x0c,0xe0,0x00,0x08,0xa0,0x0f,0xa0,0x0e,0x03,0x90,
+0xff,0xff,0x60,0x00,0x2f,0xa3,0x33,0x10,0x00,0xa5,0x03,0xf1,0x02,0x40,0x0c,0xf2,
+0x00,0x0c,0xf0,0x03,0xfd,0x64,0xaf,0x70,0x00,0x3b,0xff,0xd6,0x00,0x68,0x86,0x03,
+0x04,0x01,0x00,0x60,0x1f,0x70,0x6f,0x10,0xa4,0x04,0x35,0x0a,0x00,0x67,0x01,0x00,
+0x64,0x01,0x0f,0x07,0x00,0x04,0x50,0x00,0x00,0x3f,0x70,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -714,11 +746,17 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 1068, .range_length = 44, .glyph_id_start = 141, .list_length = 44, .type = 0, .unicode_list = 0, .glyph_id_ofs_list = 1416 },
 };
 
-static uint8_t etxUncompBuf[19885] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 2658, .size = 4086, .comp_size = 3349 },
+{ .bitmap_start = 4086, .comp_offset = 6007, .size = 4004, .comp_size = 3195 },
+{ .bitmap_start = 8090, .comp_offset = 9202, .size = 3545, .comp_size = 2538 },
+};
+
+static uint8_t etxUncompBuf[8250] __SDRAMFONTS;
 
 const etxLz4Font lv_font_ua_L = {
-.uncomp_size = 19589,
-.comp_size = 11225,
+.uncomp_size = 7954,
+.comp_size = 2658,
 .line_height = 22,
 .base_line = 5,
 .subpx = 0,
@@ -731,12 +769,13 @@ const etxLz4Font lv_font_ua_L = {
 .bitmap_format = 0,
 .left_class_cnt = 83,
 .right_class_cnt = 74,
-.glyph_bitmap = 1460,
-.class_pair_values = 13095,
-.left_class_mapping = 19237,
-.right_class_mapping = 19413,
+.class_pair_values = 1460,
+.left_class_mapping = 7602,
+.right_class_mapping = 7778,
+.block_num = 3,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 19885,
+.lvglFontBufSize = 8250,
 };
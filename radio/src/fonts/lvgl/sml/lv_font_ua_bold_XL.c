@@ -76,766 +76,828 @@ static const uint8_t lz4FontData[] ={
 0x25,0x2d,0x49,0x10,0x07,0x09,0x12,0xff,0x00,0x00,0x00,0x54,0x03,0x56,0x03,0x57,
 0x03,0x00,0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0d,
 0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,0x1a,0x1b,0x1c,0x00,
-0x00,0x1d,0x00,0x1e,0x1f,0x26,0x05,0xf2,0x15,0x20,0x00,0x21,0x22,0x6f,0xff,0x55,
-0xff,0xf4,0x5f,0xff,0x44,0xff,0xf3,0x4f,0xff,0x33,0xff,0xf2,0x3f,0xff,0x22,0xff,
-0xf1,0x2f,0xff,0x11,0xff,0xf0,0x1f,0xff,0x00,0xff,0xf0,0x0d,0xdc,0x50,0x05,0xe1,
-0x9d,0x90,0x5f,0xff,0x56,0xff,0xf5,0x0b,0xfb,0x00,0x3f,0xf4,0x3f,0xf3,0x02,0x00,
-0x71,0xf2,0x3f,0xf2,0x3f,0xf1,0x3f,0xf0,0x02,0x00,0xf1,0x27,0xe0,0x3f,0xd0,0x3f,
-0xc0,0x3f,0xc0,0x00,0x00,0x04,0xfe,0x00,0xbf,0x80,0x00,0x00,0x00,0x6f,0xc0,0x0d,
-0xf6,0x00,0x00,0x00,0x09,0xfa,0x00,0xff,0x30,0x00,0x00,0x00,0xbf,0x70,0x2f,0xf1,
-0x00,0x00,0x00,0x0e,0xf5,0x04,0xfe,0x00,0x00,0x13,0x33,0xff,0x53,0x9f,0xd3,0x31,
-0x04,0xff,0x01,0x00,0x21,0x60,0x4f,0x07,0x00,0xf1,0x11,0xf6,0x00,0x00,0x8f,0xa0,
-0x0f,0xf4,0x00,0x00,0x00,0x0b,0xf8,0x01,0xff,0x10,0x00,0x00,0x00,0xdf,0x50,0x4f,
-0xf0,0x00,0x00,0x33,0x3f,0xf5,0x38,0xfd,0x33,0x10,0x3f,0x25,0x00,0x22,0xf7,0x03,
-0x34,0x00,0x70,0x70,0x00,0x08,0xfb,0x00,0xff,0x40,0x59,0x00,0x26,0x80,0x1f,0x59,
-0x00,0xd1,0x00,0x01,0xff,0x20,0x7f,0xc0,0x00,0x00,0x00,0x3f,0xf0,0x0a,0xf9,0xb7,
-0x00,0x12,0x06,0x07,0x00,0x20,0x6f,0x90,0x06,0x00,0x20,0x18,0xfa,0x23,0x00,0xf0,
-0x0e,0xaf,0xff,0xff,0x90,0x00,0x01,0xef,0xff,0xff,0xff,0xc0,0x00,0xbf,0xff,0xdb,
-0xef,0xff,0x70,0x0f,0xff,0xb0,0x01,0xef,0xfd,0x02,0xff,0xf6,0x00,0x08,0xfb,0x00,
-0xf1,0x14,0x70,0x00,0x4a,0xaa,0x10,0xef,0xfe,0x20,0x00,0x00,0x00,0x07,0xff,0xff,
-0x92,0x00,0x00,0x00,0x0a,0xff,0xff,0xfb,0x20,0x00,0x00,0x06,0xef,0xff,0xff,0x60,
-0x00,0x00,0x00,0x5c,0xff,0x7b,0x00,0x60,0x05,0xff,0xfd,0x06,0x88,0x50,0x34,0x00,
-0xf0,0x06,0xcf,0xfc,0x00,0x00,0x6f,0xff,0x29,0xff,0xf3,0x00,0x0a,0xff,0xf1,0x3f,
-0xff,0xf9,0x7b,0xff,0xfc,0x00,0x9f,0xa8,0x00,0xd0,0x30,0x00,0x7f,0xff,0xff,0xfd,
-0x30,0x00,0x00,0x05,0xcf,0x93,0x00,0x49,0x00,0x11,0xf5,0x8f,0x00,0x80,0xaf,0x50,
-0x00,0x00,0x02,0xbf,0xfb,0x30,0x0c,0x00,0x50,0x02,0xff,0xff,0xff,0x20,0x09,0x00,
-0xf2,0x09,0x9f,0xe4,0x4e,0xf9,0x00,0x0a,0x80,0x00,0x0c,0xf9,0x00,0x8f,0xd0,0x03,
-0xff,0x20,0x00,0xdf,0x80,0x07,0xfd,0x00,0xdf,0x70,0x11,0x00,0x20,0x7f,0xd0,0x22,
-0x00,0x42,0x3e,0xfa,0x1f,0xf4,0x33,0x00,0x31,0x2a,0xfa,0x00,0x44,0x00,0x11,0x34,
-0x2b,0x01,0x00,0x2e,0x01,0x12,0x70,0x08,0x00,0x40,0x7f,0xd0,0x7d,0xfe,0x81,0x01,
-0xf1,0x15,0x1f,0xf3,0x9f,0xff,0xff,0xa0,0x00,0x00,0x0a,0xfa,0x1f,0xf9,0x29,0xff,
-0x20,0x00,0x04,0xfe,0x14,0xff,0x10,0x0f,0xf5,0x00,0x00,0xdf,0x60,0x5f,0xf0,0x00,
-0xff,0x60,0x00,0x7f,0xc0,0x04,0x11,0x00,0xc1,0x09,0xf3,0x00,0x1f,0xfa,0x28,0xff,
-0x20,0x00,0x01,0x00,0x00,0x33,0x00,0x00,0x01,0x00,0x02,0x44,0x00,0x31,0x3b,0xef,
-0xd7,0x0e,0x00,0x50,0x5f,0xff,0xff,0xfa,0x00,0x54,0x00,0x40,0xff,0xff,0xff,0xf5,
-0x56,0x01,0x31,0xff,0xe2,0x0a,0x29,0x00,0xe1,0x9f,0xf9,0x00,0x3f,0xfc,0x00,0x00,
-0x00,0x08,0xff,0xa0,0x05,0xff,0x90,0x2a,0x00,0x30,0x14,0xff,0xf3,0x2b,0x00,0x51,
-0xef,0xfd,0xff,0xf8,0x00,0x25,0x01,0x22,0xff,0xf7,0x44,0x00,0x00,0x10,0x00,0xf0,
-0x11,0x11,0x00,0x00,0x8f,0xff,0xff,0xf3,0x00,0xff,0xf0,0x00,0x6f,0xff,0x9e,0xff,
-0xe1,0x2f,0xff,0x00,0x0d,0xff,0xb0,0x3f,0xff,0xc8,0xff,0xc0,0x01,0xff,0xf7,0x00,
-0x5f,0x2d,0x00,0x30,0x1f,0xff,0x90,0x36,0x01,0x60,0x10,0x00,0xef,0xff,0x50,0x04,
-0xac,0x01,0x32,0x06,0xff,0xff,0x4c,0x01,0x11,0x09,0x08,0x00,0xd1,0xfe,0x10,0x00,
-0x04,0xae,0xff,0xd8,0x24,0xff,0xfb,0x00,0x3f,0xf5,0x02,0x00,0x12,0xf3,0x89,0x02,
-0x00,0xfe,0x07,0xf2,0x23,0x00,0x00,0x1c,0xe0,0x00,0x00,0xdf,0xf2,0x00,0x0a,0xff,
-0x40,0x00,0x4f,0xf8,0x00,0x00,0xcf,0xf0,0x00,0x03,0xff,0x90,0x00,0x09,0xff,0x40,
-0x00,0x0d,0xff,0x10,0x00,0x1f,0xfd,0x00,0x00,0x4f,0xfb,0x00,0x00,0x5f,0xfa,0x00,
-0x00,0x6f,0xf9,0x00,0x00,0x7f,0xf8,0x04,0x00,0x00,0x0c,0x00,0xa0,0x4f,0xfa,0x00,
-0x00,0x2f,0xfc,0x00,0x00,0x0e,0xff,0xf2,0x01,0xf0,0x10,0x30,0x00,0x04,0xff,0x70,
-0x00,0x00,0xef,0xd0,0x00,0x00,0x6f,0xf6,0x00,0x00,0x0d,0xfe,0x10,0x00,0x02,0xff,
-0xd1,0x00,0x00,0x4f,0xf1,0x00,0x00,0x02,0x70,0x04,0x65,0x02,0x80,0xa0,0x00,0x00,
-0x5f,0xfb,0x00,0x00,0x07,0x28,0x00,0x22,0xcf,0xf2,0x41,0x00,0x00,0x65,0x00,0xd0,
-0x08,0xff,0x70,0x00,0x05,0xff,0xb0,0x00,0x01,0xff,0xf0,0x00,0x00,0x0f,0x01,0xa2,
-0xdf,0xf4,0x00,0x00,0xcf,0xf6,0x00,0x00,0xbf,0xf6,0x08,0x00,0x90,0xdf,0xf5,0x00,
-0x00,0xef,0xf3,0x00,0x00,0xff,0x9d,0x00,0x91,0xd0,0x00,0x07,0xff,0x80,0x00,0x0c,
-0xff,0x20,0x7d,0x00,0xf1,0x02,0x9f,0xf4,0x00,0x04,0xff,0xa0,0x00,0x3e,0xfd,0x10,
-0x00,0x4f,0xd2,0x00,0x00,0x08,0x10,0x3c,0x01,0x11,0xf0,0x06,0x00,0x10,0xe0,0x06,
-0x00,0xf0,0x10,0x4f,0xd0,0x00,0x00,0x2e,0x82,0x3f,0xc0,0x3a,0x90,0x7f,0xff,0xcf,
-0xec,0xff,0xe0,0x28,0xcf,0xff,0xff,0xfc,0x70,0x00,0x03,0xff,0xf9,0x10,0x00,0x00,
-0x0c,0xfd,0x4c,0x02,0xf5,0x01,0x8f,0xf1,0xbf,0xc0,0x00,0x03,0xff,0x70,0x2f,0xf8,
-0x00,0x00,0x6c,0x00,0x08,0xc1,0x1d,0x09,0x31,0x06,0x77,0x30,0x9c,0x01,0x01,0x92,
-0x01,0x3a,0x0e,0xff,0x70,0x0d,0x00,0x72,0x01,0x55,0x55,0xef,0xfa,0x55,0x54,0x8f,
-0x03,0x12,0xe4,0x6c,0x01,0x02,0x0d,0x00,0x1e,0xe0,0x34,0x00,0x09,0x0d,0x00,0x00,
-0xb3,0x00,0xf4,0x06,0x4f,0xfa,0x04,0xff,0xa0,0x6f,0xf8,0x09,0xff,0x40,0xef,0xe0,
-0x5f,0xf5,0x00,0x57,0x00,0xaf,0xff,0xff,0xf3,0x04,0x00,0xb0,0x09,0xda,0x05,0xff,
-0xf6,0x6f,0xff,0x70,0xbf,0xb0,0x00,0xa5,0x00,0x01,0xaa,0x03,0x01,0x26,0x04,0x2e,
-0xf3,0x00,0x10,0x00,0x2f,0x0b,0xfe,0x10,0x00,0x02,0x10,0x90,0x10,0x00,0x14,0xf4,
-0x10,0x00,0x12,0x00,0x6f,0x02,0x10,0xf4,0x55,0x03,0x0f,0x10,0x00,0x03,0x11,0xa0,
-0xf2,0x00,0xa2,0xcf,0xfd,0x81,0x00,0x00,0x0b,0xff,0xff,0xff,0xe3,0x3f,0x02,0xf0,
-0x08,0xd0,0x01,0xff,0xfb,0x10,0x7f,0xff,0x60,0x7f,0xff,0x10,0x00,0xcf,0xfc,0x0a,
-0xff,0xd0,0x00,0x08,0xff,0xf0,0xcf,0xfb,0xc0,0x03,0x90,0x1d,0xff,0xb0,0x00,0x05,
-0xff,0xf2,0xdf,0xfb,0xad,0x02,0x2e,0x2d,0xff,0x0d,0x00,0x02,0x27,0x00,0x12,0x1a,
-0x34,0x00,0x11,0x6f,0x41,0x00,0x00,0x4e,0x00,0x42,0x6f,0xff,0x60,0x09,0x26,0x01,
-0x02,0x68,0x00,0x00,0x75,0x00,0x10,0x91,0x7d,0x00,0xb0,0x04,0xab,0x00,0x28,0xef,
-0xfc,0x5b,0xff,0xff,0xfc,0xff,0x04,0x00,0x50,0xfb,0xef,0xfc,0xb6,0x10,0x2b,0x04,
-0x0f,0x04,0x00,0x20,0x81,0x01,0x7c,0xef,0xd9,0x20,0x00,0x00,0x3e,0x81,0x03,0x01,
-0xbd,0x04,0xf0,0x0a,0xff,0x20,0x09,0xff,0xf7,0x00,0x9f,0xff,0x80,0x0e,0xff,0xb0,
-0x00,0x0e,0xff,0xb0,0x1f,0xff,0x70,0x00,0x0c,0xff,0xc0,0x02,0x22,0x84,0x02,0x11,
-0xa0,0x2a,0x02,0x21,0xff,0x50,0x19,0x04,0x11,0xfe,0x7a,0x04,0x00,0xb9,0x03,0x00,
-0x7e,0x03,0x11,0x90,0xc0,0x03,0x11,0xfc,0x21,0x00,0x00,0xd0,0x02,0x31,0x00,0x03,
-0xff,0xeb,0x04,0x11,0x2e,0xb8,0x03,0x21,0x01,0xdf,0xdb,0x04,0x11,0x0b,0xf7,0x01,
-0x22,0xf5,0x0c,0x9a,0x05,0x13,0x0c,0xa1,0x05,0x50,0x02,0x9d,0xff,0xd8,0x20,0x03,
-0x01,0x42,0xff,0xff,0xf4,0x00,0x8a,0x05,0x60,0x20,0x0b,0xff,0xf6,0x00,0x8f,0x85,
-0x00,0x70,0xa0,0x00,0x0d,0xff,0xc0,0x01,0x11,0x3c,0x00,0x12,0xc0,0x1e,0x02,0x10,
-0xa0,0xa2,0x04,0x10,0xaf,0xff,0x05,0x11,0x3f,0xdf,0x05,0x00,0x07,0x00,0x10,0x90,
-0x6a,0x00,0x33,0xef,0xff,0xfc,0x13,0x04,0x01,0x97,0x05,0x81,0x09,0xff,0xf0,0x04,
-0x44,0x10,0x00,0x07,0x7c,0x05,0x00,0x0e,0x00,0x72,0x0e,0xff,0xf5,0x00,0x6f,0xff,
-0xc0,0xf8,0x03,0x32,0x40,0x00,0x8f,0x1e,0x06,0x41,0x03,0xae,0xff,0xd9,0x29,0x05,
-0x12,0x03,0x8d,0x04,0x12,0x0c,0x07,0x00,0x21,0x6f,0xff,0xd6,0x05,0x11,0xef,0x07,
-0x00,0x12,0x09,0xa9,0x04,0x50,0x2f,0xfe,0xef,0xfa,0x00,0x6f,0x03,0x20,0xef,0xfa,
-0x82,0x04,0x30,0xc0,0xef,0xfa,0x90,0x00,0x10,0x30,0x07,0x00,0x90,0x8f,0xfa,0x00,
-0xef,0xfa,0x00,0x02,0xff,0xf1,0x07,0x00,0x30,0x0a,0xff,0x70,0x07,0x00,0x02,0x5c,
-0x06,0x22,0xfa,0x4f,0x07,0x00,0x03,0x0e,0x00,0x01,0xdb,0x02,0x01,0x06,0x00,0x0e,
-0x07,0x00,0x01,0xba,0x06,0x11,0xfb,0x09,0x01,0x32,0xff,0xb0,0x08,0x0d,0x00,0x72,
-0x9f,0xfa,0x11,0x11,0x11,0x00,0x0b,0x14,0x03,0x20,0xdf,0xf6,0x06,0x00,0x72,0x0f,
-0xff,0x78,0xbb,0x82,0x00,0x01,0x3d,0x01,0x20,0x2f,0xff,0x37,0x01,0x52,0x01,0x8d,
-0xe5,0x11,0x8f,0x21,0x01,0x11,0xaf,0xba,0x05,0x12,0x05,0x2f,0x05,0x50,0x3f,0xff,
-0x45,0x88,0x60,0x0d,0x00,0xd1,0x9f,0xff,0x10,0x00,0x9f,0xff,0x14,0xff,0xfb,0x10,
-0x5f,0xff,0xb0,0x87,0x01,0x32,0xf3,0x00,0x1c,0x01,0x01,0x41,0x05,0xbe,0xfd,0x92,
-0x00,0x01,0x10,0x9d,0x3f,0x01,0x40,0x1b,0xff,0xff,0xc0,0xb6,0x01,0x20,0xff,0xfc,
-0xf1,0x01,0x20,0xfa,0x41,0x88,0x04,0x11,0xf5,0xa0,0x00,0x12,0xf8,0xdc,0x01,0x70,
-0x39,0xde,0xc7,0x00,0x08,0xff,0xfe,0x9c,0x00,0x10,0xaf,0x48,0x00,0xa0,0xf8,0x0c,
-0xff,0xfb,0x20,0x6f,0xff,0xf0,0xcf,0xfe,0x07,0x02,0x90,0x4c,0xff,0xc0,0x00,0x02,
-0xff,0xf6,0xbf,0xfd,0xd6,0x05,0xf1,0x07,0x79,0xff,0xe0,0x00,0x02,0xff,0xf5,0x5f,
-0xff,0x40,0x00,0x7f,0xff,0x20,0xef,0xfd,0x20,0x5f,0xff,0xd0,0x06,0xff,0xe7,0x01,
-0x14,0x08,0x7d,0x01,0x20,0xfe,0xa3,0x55,0x00,0x01,0x15,0x00,0x03,0x07,0x00,0x02,
-0x29,0x01,0x12,0xf2,0x5e,0x02,0x12,0xb0,0x20,0x06,0x11,0x40,0x65,0x02,0x26,0xfe,
-0x00,0x26,0x04,0x32,0x05,0xff,0xf1,0xae,0x01,0x12,0xa0,0xe8,0x00,0x11,0x40,0xfc,
-0x00,0x21,0xfd,0x00,0xd4,0x03,0x00,0x22,0x00,0x00,0x41,0x07,0x05,0x31,0x02,0x00,
-0x15,0x02,0x01,0xa4,0x04,0x22,0xcf,0xfd,0xeb,0x01,0x12,0xf6,0x5f,0x00,0x12,0xf1,
-0x5f,0x00,0x01,0x30,0x02,0x20,0x07,0xcf,0x08,0x01,0x11,0x1d,0x0b,0x03,0x01,0x9b,
-0x02,0xf0,0x02,0xf1,0x03,0xff,0xfc,0x10,0x8f,0xff,0x80,0x6f,0xff,0x30,0x00,0xef,
-0xfb,0x06,0xff,0xf1,0x09,0x03,0xe2,0x4f,0xff,0x40,0x00,0xef,0xf9,0x00,0xef,0xfc,
-0x21,0x8f,0xff,0x30,0x03,0x35,0x08,0x10,0x06,0xb0,0x01,0x30,0x00,0x07,0xff,0xfc,
-0x07,0x00,0x31,0x05,0x50,0x5f,0xff,0x80,0xaf,0xfe,0xf6,0x06,0x81,0x0c,0xff,0xb0,
-0x00,0x06,0xff,0xf2,0xcf,0x0d,0x00,0x11,0x19,0x1a,0x00,0x11,0xe0,0xb1,0x01,0x01,
-0x94,0x06,0x80,0xff,0xf9,0x00,0x00,0x29,0xdf,0xfe,0xa4,0x3a,0x03,0x30,0xce,0xec,
-0x50,0x7c,0x01,0x00,0x48,0x00,0x10,0x0a,0x21,0x00,0x80,0x90,0x04,0xff,0xfa,0x10,
-0xaf,0xff,0x20,0xb8,0x01,0x31,0xff,0xf8,0x0d,0x17,0x00,0x30,0xd0,0xef,0xf9,0x05,
-0x01,0x00,0xd1,0x00,0x14,0x07,0x70,0x01,0x50,0x08,0xff,0xf8,0x00,0x4f,0x54,0x09,
-0x40,0xff,0xef,0xff,0xfe,0x55,0x00,0x92,0xfe,0xff,0xd0,0x00,0x3b,0xef,0xc5,0xbf,
-0xf9,0xda,0x00,0x10,0x50,0xe7,0x00,0x00,0x69,0x05,0x41,0x12,0x6c,0xff,0xf5,0x6a,
-0x01,0x10,0xfa,0x57,0x05,0x01,0x45,0x07,0x30,0x4f,0xec,0x82,0x94,0x03,0xaa,0xfb,
-0x06,0xff,0xf6,0x5f,0xff,0x60,0x9d,0xa0,0x00,0x01,0x00,0x21,0x09,0xd9,0x5d,0x05,
-0xe0,0x60,0xbf,0xb0,0x02,0xcf,0x90,0x09,0xff,0xf3,0x09,0xff,0xf3,0x01,0xbd,0x3e,
-0x05,0x0c,0x01,0x00,0x20,0x11,0x10,0x72,0x06,0x00,0x03,0x00,0xf7,0x00,0xe0,0x02,
-0xff,0xc0,0x05,0xff,0x80,0x0b,0xff,0x20,0x1f,0xf8,0x00,0x02,0x70,0x24,0x00,0x20,
-0x04,0xb2,0xe6,0x00,0xf0,0x09,0xdf,0xf2,0x00,0x00,0x18,0xef,0xff,0xf2,0x00,0x3a,
-0xff,0xff,0xff,0xc1,0x2b,0xff,0xff,0xfe,0x82,0x00,0x5f,0xff,0xfa,0x40,0x9f,0x01,
-0x12,0xc5,0xca,0x03,0x00,0x0d,0x00,0x30,0x7d,0xff,0xff,0x28,0x08,0x12,0x5c,0x06,
-0x02,0x12,0x3a,0x0c,0x02,0x33,0x18,0xe2,0x00,0x35,0x08,0x00,0x3a,0x01,0x08,0x06,
-0x00,0x0e,0x92,0x00,0x0e,0x24,0x00,0x21,0x78,0x10,0x42,0x02,0x21,0xfa,0x30,0xad,
-0x04,0xd1,0xfc,0x50,0x00,0x00,0x5e,0xff,0xff,0xfe,0x71,0x00,0x00,0x4a,0xff,0x3e,
-0x04,0x30,0x05,0xbf,0xff,0x81,0x07,0x90,0x7e,0xff,0xf1,0x00,0x06,0xcf,0xff,0xff,
-0xd0,0xa1,0x00,0x10,0xc5,0x23,0x04,0x10,0xa3,0x73,0x01,0x60,0x81,0x00,0x00,0x00,
-0x8d,0x60,0x42,0x00,0x03,0x16,0x09,0x70,0x18,0xdf,0xfd,0x92,0x00,0x01,0xdf,0x48,
-0x04,0x11,0x0c,0xa4,0x05,0xf1,0x03,0x3f,0xff,0xc2,0x19,0xff,0xf5,0x6f,0xff,0x30,
-0x01,0xff,0xf8,0x13,0x33,0x00,0x00,0xff,0xf7,0x10,0x05,0x10,0xf4,0xd5,0x00,0x00,
-0x51,0x03,0x11,0x02,0xf9,0x09,0x11,0x0d,0x96,0x03,0x11,0x6f,0xad,0x02,0x11,0xaf,
-0xf7,0x03,0x11,0xbf,0x89,0x02,0x26,0x12,0x20,0xbc,0x00,0x21,0x5d,0xb2,0x67,0x06,
-0x11,0xfb,0x06,0x00,0x01,0xd1,0x04,0x31,0x7e,0xd3,0x00,0xd7,0x02,0x42,0x7b,0xef,
-0xfd,0xa5,0x24,0x00,0x10,0x8f,0x74,0x00,0x10,0xd4,0x0a,0x00,0x61,0x1c,0xff,0xc6,
-0x21,0x23,0x8e,0x3f,0x0a,0x21,0xcf,0xf6,0x03,0x03,0x21,0xf4,0x00,0x96,0x08,0x00,
-0xf8,0x01,0xf0,0x0f,0xfd,0x00,0x00,0x3f,0xf7,0x00,0x00,0x02,0x20,0x00,0x01,0xef,
-0x50,0x00,0xaf,0xd0,0x00,0x05,0xef,0xff,0xa1,0x00,0x8f,0xb0,0x01,0xff,0x70,0x00,
-0x6f,0xff,0xe9,0x08,0xf0,0x1b,0xf0,0x05,0xff,0x20,0x02,0xff,0xb2,0x0d,0xfa,0x00,
-0x0f,0xf2,0x09,0xfd,0x00,0x0a,0xfe,0x10,0x0d,0xf9,0x00,0x0e,0xf4,0x0c,0xfa,0x00,
-0x1f,0xf9,0x00,0x0f,0xf8,0x00,0x0d,0xf5,0x0e,0xf8,0x00,0x5f,0xf5,0x00,0x0f,0xf7,
-0x0b,0x00,0xf0,0x08,0xf7,0x00,0x8f,0xf2,0x00,0x1f,0xf5,0x00,0x0e,0xf4,0x0e,0xf7,
-0x00,0xaf,0xf1,0x00,0x3f,0xf4,0x00,0x0f,0xf2,0x0e,0xf8,0x0b,0x00,0xf1,0x13,0x5f,
-0xf3,0x00,0x4f,0xe0,0x0c,0xfa,0x00,0x8f,0xf4,0x00,0xbf,0xf2,0x00,0xbf,0x90,0x09,
-0xfd,0x00,0x4f,0xfd,0x6a,0xff,0xf8,0x17,0xff,0x20,0x05,0xff,0x30,0x0c,0xff,0xff,
-0xcc,0xe3,0x09,0xd5,0xff,0xb0,0x01,0xaf,0xe9,0x01,0xaf,0xfb,0x40,0x00,0x00,0x8f,
-0xf6,0xf3,0x00,0x24,0x0d,0xff,0x2b,0x02,0x00,0x28,0x01,0x32,0x95,0x44,0x58,0x5b,
-0x08,0x11,0x1a,0x2d,0x06,0x02,0x18,0x00,0x53,0x28,0xce,0xff,0xda,0x50,0x8a,0x0a,
-0x23,0xff,0x40,0x36,0x00,0x23,0xf9,0x00,0xea,0x0a,0x14,0xf0,0x16,0x01,0x12,0x50,
-0x19,0x00,0x01,0x67,0x05,0x00,0xbc,0x08,0x02,0x1a,0x00,0x22,0x9f,0xfe,0x09,0x03,
-0x60,0x0e,0xff,0x90,0xcf,0xfb,0x00,0x00,0x03,0x21,0xf4,0x07,0xfb,0x03,0x62,0x9f,
-0xff,0x00,0x2f,0xff,0x60,0x24,0x04,0x20,0xdf,0xfc,0x19,0x00,0x30,0xf5,0x00,0x08,
-0x6f,0x02,0x13,0xaf,0x0f,0x0c,0x11,0x0f,0x08,0x00,0x10,0xfd,0x6f,0x0a,0x02,0x95,
-0x04,0xb1,0xbf,0xff,0x21,0x11,0x11,0x4f,0xff,0x80,0x1f,0xff,0xc0,0x8e,0x0a,0x31,
-0x06,0xff,0xf7,0x20,0x06,0x41,0xf3,0xbf,0xff,0x20,0x1f,0x05,0x40,0x90,0x6f,0xff,
-0xff,0xab,0x00,0x17,0x6f,0xcc,0x05,0x90,0xff,0xa0,0x6f,0xff,0x51,0x12,0x7f,0xff,
-0xf1,0xfa,0x01,0x30,0x08,0xff,0xf5,0x07,0x00,0x12,0x04,0x07,0x00,0x30,0x06,0xff,
-0xf3,0x07,0x00,0xb2,0x1d,0xff,0xe0,0x6f,0xff,0xcb,0xbc,0xff,0xff,0x30,0x6f,0xf5,
-0x00,0x02,0x38,0x00,0x10,0x80,0x1c,0x00,0x30,0x2b,0xff,0xf4,0x07,0x00,0x31,0x01,
-0xff,0xfa,0x39,0x02,0x22,0xef,0xfc,0x0e,0x00,0x82,0xfb,0x6f,0xff,0x40,0x01,0x3c,
-0xff,0xf8,0x2a,0x00,0x22,0xf1,0x6f,0xd6,0x06,0x10,0x6f,0x13,0x08,0x00,0xaf,0x02,
-0x52,0x6b,0xef,0xeb,0x60,0x00,0xa3,0x02,0x13,0xd3,0xda,0x07,0xa0,0xe2,0x00,0x9f,
-0xff,0xb4,0x24,0xaf,0xff,0xb0,0x2f,0x57,0x05,0x50,0xbf,0xff,0x17,0xff,0xf3,0xf3,
-0x00,0x30,0xf6,0xbf,0xff,0xd2,0x02,0x42,0x88,0x4d,0xff,0xd0,0x60,0x05,0x22,0xfc,
-0x00,0x66,0x06,0x18,0xc0,0x0f,0x00,0x13,0x0d,0x1e,0x00,0x01,0x2d,0x00,0x50,0x16,
-0x66,0x38,0xff,0xf3,0x84,0x05,0x40,0xf6,0x2f,0xff,0xa0,0x14,0x00,0xa2,0x20,0xbf,
-0xff,0xa3,0x24,0xaf,0xff,0xc0,0x01,0xef,0x27,0x01,0x22,0x02,0xdf,0xb3,0x08,0x51,
-0x00,0x7c,0xef,0xeb,0x70,0xdb,0x07,0x32,0xfd,0xa3,0x00,0x72,0x0b,0x11,0xfa,0xea,
-0x07,0x00,0x60,0x06,0x71,0x06,0xff,0xf5,0x12,0x5c,0xff,0xf8,0x10,0x03,0x31,0x0c,
-0xff,0xf2,0x2e,0x03,0x10,0x2f,0x41,0x01,0x10,0x40,0x5e,0x08,0x01,0x0f,0x00,0x10,
-0x0a,0x11,0x09,0x10,0x40,0xdb,0x01,0x40,0x26,0xff,0xf4,0x00,0x9c,0x01,0x07,0x0f,
-0x00,0x00,0xc0,0x05,0x08,0x2d,0x00,0x32,0x3f,0xff,0x90,0x4b,0x00,0x82,0xf3,0x06,
-0xff,0xf4,0x11,0x4c,0xff,0xf9,0x69,0x00,0x18,0xfd,0x78,0x00,0x10,0xfd,0x6e,0x05,
-0x02,0x2c,0x01,0x12,0x76,0xfb,0x0d,0x04,0x0d,0x00,0x52,0xf5,0x11,0x11,0x11,0x10,
-0x9b,0x03,0x02,0xb8,0x03,0x1b,0x00,0x0d,0x00,0x00,0x9c,0x06,0x03,0x3c,0x08,0x04,
-0x0d,0x00,0x0e,0x27,0x00,0x05,0x0d,0x00,0x02,0x4e,0x00,0x00,0x01,0x00,0x21,0x86,
-0xff,0x27,0x07,0x05,0xd2,0x01,0x00,0x01,0x00,0x12,0x26,0x4f,0x02,0x04,0x0d,0x00,
-0x0f,0x7c,0x00,0x22,0x00,0x18,0x08,0x0f,0x34,0x00,0x09,0x0c,0x0d,0x00,0x00,0x01,
-0x00,0x82,0x5b,0xef,0xfc,0x82,0x00,0x00,0x01,0xcf,0x7e,0x07,0x12,0xdf,0x6c,0x02,
-0xa0,0x8f,0xff,0xd4,0x13,0x8f,0xff,0xe0,0x1f,0xff,0xd0,0x5a,0x01,0x30,0x45,0xff,
-0xf6,0x43,0x07,0x11,0xf8,0x48,0x08,0x33,0x01,0x22,0x1b,0x5d,0x03,0x23,0xdf,0xfe,
-0x07,0x02,0x11,0xe0,0xb7,0x0d,0x21,0xdf,0xfe,0x14,0x03,0xb0,0xab,0xff,0xf0,0x00,
-0x4d,0xdd,0xff,0xfa,0x9f,0xff,0x20,0x32,0x02,0x11,0xa5,0x0e,0x03,0x50,0xff,0xfa,
-0x0f,0xff,0xe1,0x0f,0x00,0xa3,0xa0,0x8f,0xff,0xd5,0x11,0x3a,0xff,0xfa,0x00,0xcf,
-0x4f,0x03,0x10,0xbf,0xfc,0x0b,0x72,0x60,0x00,0x00,0x4a,0xef,0xfd,0xb6,0x96,0x00,
-0x00,0x98,0x09,0x0f,0x08,0x00,0x27,0x01,0x01,0x00,0x1e,0xf0,0x08,0x00,0x4f,0x41,
-0x11,0x11,0x1a,0x58,0x00,0x27,0x5f,0x3f,0xff,0x73,0xff,0xf7,0x05,0x00,0x17,0x12,
-0x70,0x18,0x09,0x21,0x60,0x00,0x4d,0x03,0x0f,0x0d,0x00,0x34,0x32,0x65,0xcc,0xc2,
-0x23,0x04,0xc2,0x50,0x00,0x8f,0xff,0x32,0xff,0xfd,0x41,0x6f,0xff,0xe0,0x0b,0xf2,
-0x09,0x10,0x1c,0x4e,0x02,0x00,0x33,0x08,0x00,0x3b,0x09,0x01,0x0c,0x04,0x12,0xef,
-0x29,0x04,0x31,0x0b,0xff,0xfc,0x10,0x00,0x30,0x6f,0xff,0xe1,0x08,0x00,0x21,0x02,
-0xff,0x0c,0x00,0x41,0x40,0x0d,0xff,0xf8,0x28,0x00,0x30,0x9f,0xff,0xc0,0x08,0x00,
-0x40,0x44,0xff,0xfe,0x10,0x08,0x00,0x31,0x5e,0xff,0xf4,0x1a,0x02,0x33,0xdf,0xff,
-0xb0,0x63,0x02,0x13,0xf3,0x08,0x00,0x11,0xfd,0x08,0x00,0x31,0xfe,0xdf,0xff,0xba,
-0x03,0x20,0xf3,0x3f,0x2b,0x05,0x01,0x8d,0x0c,0x11,0xfb,0x48,0x00,0x43,0x01,0xef,
-0xff,0x40,0x68,0x00,0x13,0xe0,0xbc,0x03,0x01,0xc4,0x03,0x00,0xbb,0x0b,0x11,0x20,
-0x44,0x01,0x3e,0x9f,0xff,0xc0,0x99,0x02,0x0f,0x0d,0x00,0x3f,0x06,0x63,0x03,0x18,
-0x06,0x01,0x02,0x22,0x00,0x6f,0x23,0x10,0x10,0xaf,0x38,0x05,0x11,0xfd,0x47,0x07,
-0x00,0x0a,0x00,0x10,0xff,0x2f,0x11,0x02,0x0a,0x00,0x10,0x80,0x7b,0x11,0x00,0x0a,
-0x00,0x00,0xf2,0x02,0x10,0x0f,0x0a,0x00,0x10,0xfe,0x37,0x0f,0x20,0x5f,0xfc,0x14,
-0x00,0x60,0x8f,0xf8,0x00,0x00,0xaf,0xf8,0x0a,0x00,0x20,0x3f,0xfd,0x67,0x0f,0x00,
-0x0a,0x00,0x60,0x0e,0xff,0x30,0x05,0xff,0xb2,0x0a,0x00,0x60,0x18,0xff,0x80,0x0a,
-0xff,0x63,0x0a,0x00,0x60,0x13,0xff,0xd0,0x0f,0xff,0x14,0x0a,0x00,0x60,0x20,0xdf,
-0xf2,0x5f,0xfb,0x04,0x0a,0x00,0x61,0x30,0x8f,0xf8,0xaf,0xf6,0x05,0x0a,0x00,0x71,
-0x3f,0xfd,0xff,0xf1,0x06,0xff,0xf4,0x80,0x01,0x22,0xff,0xb0,0x0a,0x00,0x41,0x08,
-0xff,0xff,0x50,0x0a,0x00,0x00,0x9c,0x01,0x22,0x00,0x06,0xd8,0x05,0x24,0xdf,0xfb,
-0x0a,0x00,0x22,0x7f,0xf5,0x0a,0x00,0x13,0x80,0x8e,0x02,0x13,0xf2,0x08,0x00,0x14,
-0xfa,0xee,0x02,0x13,0x30,0x08,0x00,0x13,0xc0,0x08,0x00,0x12,0xf6,0x08,0x00,0x22,
-0xef,0xfe,0x08,0x00,0x31,0x7f,0xff,0x80,0x08,0x00,0x41,0x49,0xff,0xf1,0x09,0x06,
-0x03,0x22,0xff,0xfa,0xd6,0x02,0x51,0x7f,0xff,0x39,0xff,0xf0,0x8a,0x00,0x11,0xc9,
-0x08,0x00,0x32,0x05,0xff,0xfe,0xee,0x02,0x22,0xcf,0xff,0x08,0x00,0x13,0x3f,0x08,
-0x00,0x13,0x09,0x08,0x00,0x23,0x01,0xff,0x0e,0x03,0x13,0x7f,0x08,0x00,0x30,0x0e,
-0xff,0xf0,0x3d,0x04,0x23,0xec,0x60,0xc5,0x0d,0x52,0xfd,0x20,0x00,0x00,0xcf,0x54,
-0x06,0x81,0x08,0xff,0xfd,0x52,0x4b,0xff,0xfb,0x00,0x3f,0x04,0x10,0xbf,0xa0,0x04,
-0x11,0x50,0xc7,0x05,0x21,0xaf,0xff,0x9f,0x0b,0x10,0xe0,0x72,0x0b,0x00,0xc8,0x05,
-0x12,0xef,0xd1,0x11,0x23,0xf2,0xff,0x08,0x00,0x04,0x10,0x00,0x04,0x20,0x00,0x04,
-0x30,0x00,0x01,0x40,0x00,0x60,0x1f,0xff,0xa0,0x1f,0xff,0xd1,0xc4,0x01,0x10,0x40,
-0x60,0x00,0x35,0x3a,0xff,0xfc,0x70,0x00,0x05,0x80,0x00,0x00,0xcd,0x04,0x12,0x70,
-0xb2,0x02,0x23,0xeb,0x60,0xce,0x11,0x13,0xd3,0xdc,0x05,0x73,0xe1,0x06,0xff,0xf5,
-0x11,0x14,0xcf,0x4d,0x06,0x41,0xef,0xff,0x06,0xff,0x17,0x09,0x18,0xf1,0x3e,0x06,
-0x12,0x0c,0x0f,0x00,0x57,0x29,0xff,0xfc,0x06,0xff,0x5b,0x05,0x21,0xff,0x60,0x0f,
-0x00,0x76,0xe9,0x20,0x00,0x6f,0xff,0x51,0x11,0x77,0x02,0x04,0x45,0x05,0x0f,0x0f,
-0x00,0x0b,0x1d,0x00,0x27,0x01,0x1f,0xdf,0x27,0x01,0x0b,0x22,0xbf,0xff,0x56,0x05,
-0x17,0xdf,0x27,0x01,0x00,0xaa,0x00,0x26,0xff,0xfb,0x27,0x01,0x00,0x10,0x00,0x04,
-0x20,0x00,0x04,0x30,0x00,0x04,0x40,0x00,0x01,0x50,0x00,0x03,0x27,0x01,0x35,0x4a,
-0xff,0xfb,0x70,0x00,0x02,0x6c,0x0f,0x11,0x60,0x90,0x00,0x22,0xef,0xff,0x6c,0x09,
-0x12,0x05,0x29,0x0f,0x00,0xf0,0x0f,0x12,0x60,0x53,0x0a,0x15,0xc5,0x84,0x09,0x09,
-0x47,0x01,0x13,0xd2,0x47,0x01,0x10,0xd0,0x47,0x01,0x42,0x25,0xef,0xff,0x50,0xb2,
-0x08,0x11,0xfa,0xed,0x00,0x31,0x0f,0xff,0xb0,0xed,0x00,0x03,0x0f,0x00,0x12,0x3f,
-0x7d,0x04,0x32,0x4d,0xff,0xf3,0x3c,0x00,0x03,0x76,0x07,0x12,0xf8,0x4b,0x00,0x01,
-0xc2,0x14,0x41,0x51,0x1a,0xff,0xf4,0x29,0x01,0x00,0x79,0x08,0x00,0x2d,0x00,0x41,
-0xaf,0xff,0x30,0x06,0xec,0x0f,0x22,0xfb,0x00,0xb9,0x04,0x13,0xf3,0x4b,0x00,0x02,
-0x5a,0x00,0x10,0xbf,0xac,0x03,0x41,0x4a,0xdf,0xfd,0x82,0x70,0x08,0x01,0xea,0x13,
-0x12,0xbf,0xfc,0x04,0xa0,0x4f,0xff,0xd4,0x11,0x6f,0xff,0xf0,0x08,0xff,0xf3,0x9c,
-0x02,0xc1,0x50,0x8f,0xff,0x20,0x00,0x02,0xbb,0xb5,0x06,0xff,0xfb,0x10,0xeb,0x0d,
-0x00,0x50,0x0c,0x02,0x47,0x0c,0x10,0xfc,0xe1,0x00,0x10,0x2c,0x12,0x02,0x00,0x56,
-0x05,0x22,0xaf,0xff,0xa6,0x01,0x61,0x16,0xdf,0xff,0xe0,0x01,0x11,0x56,0x00,0x30,
-0x41,0xff,0xf9,0x6f,0x05,0x40,0xf7,0x0e,0xff,0xd0,0x30,0x0c,0xa2,0x60,0x8f,0xff,
-0xb3,0x10,0x4e,0xff,0xf3,0x01,0xdf,0xb8,0x09,0x20,0x01,0xbf,0xbd,0x00,0x72,0x10,
-0x00,0x00,0x49,0xdf,0xfe,0xb5,0x71,0x0b,0x00,0xd5,0x00,0x12,0xff,0x01,0x00,0x13,
-0x8f,0x6a,0x06,0x70,0x11,0x11,0x3f,0xff,0x81,0x11,0x11,0x84,0x0a,0x11,0xf8,0x46,
-0x01,0x11,0x2f,0x5f,0x12,0x0f,0x0f,0x00,0x4e,0x30,0x9f,0xff,0x10,0xf5,0x01,0x31,
-0x09,0xff,0xf1,0x14,0x02,0x0f,0x0f,0x00,0x3f,0x30,0x07,0xff,0xf3,0x21,0x03,0xf2,
-0x01,0xf0,0x4f,0xff,0x90,0x00,0x02,0xff,0xfb,0x00,0xef,0xff,0x82,0x14,0xdf,0xff,
-0x60,0x07,0x0b,0x12,0xc0,0xdb,0x01,0x20,0xc1,0x00,0xba,0x11,0x20,0xeb,0x50,0x9a,
-0x03,0x11,0x40,0x66,0x05,0x31,0x16,0xff,0xf9,0xbd,0x06,0x11,0xc0,0x95,0x02,0x61,
-0x08,0xff,0xf7,0x00,0xcf,0xff,0x02,0x03,0x20,0x20,0x07,0xc4,0x01,0x00,0x34,0x0b,
-0x11,0x2f,0x12,0x0f,0x10,0xf7,0x15,0x00,0x01,0x38,0x0a,0x60,0x00,0x07,0xff,0xf4,
-0x00,0x0f,0x2f,0x00,0x10,0x2f,0xf4,0x0e,0x12,0xf7,0x6a,0x08,0x00,0x4f,0x08,0x00,
-0xfd,0x02,0x02,0x75,0x0a,0x32,0x3f,0xff,0x72,0x05,0x01,0x20,0xdf,0xfb,0x8b,0x0f,
-0x00,0x1a,0x00,0x12,0xfc,0x8e,0x0a,0x12,0x3f,0xc9,0x0e,0x00,0xe2,0x03,0x02,0xdf,
-0x0f,0x11,0x09,0x55,0x14,0x01,0x1a,0x00,0x03,0x17,0x0e,0x10,0xef,0x19,0x00,0x00,
-0x7f,0x10,0x40,0x00,0x0b,0xff,0x90,0x53,0x07,0x00,0xbf,0x12,0x11,0x0e,0x1e,0x15,
-0x80,0xf2,0x1f,0xff,0x80,0x00,0x2f,0xff,0xf1,0xf8,0x00,0x00,0x62,0x0f,0x70,0x5f,
-0xff,0xf4,0x00,0x0c,0xff,0xb0,0x2f,0x0f,0xf0,0x04,0x9f,0xff,0xf8,0x00,0x0f,0xff,
-0x80,0x06,0xff,0xf0,0x00,0xcf,0xff,0xfb,0x00,0x2f,0xff,0x50,0x03,0x5f,0x16,0x40,
-0xef,0xff,0x00,0x5f,0x91,0x0f,0x60,0xf6,0x03,0xff,0xac,0xff,0x20,0x90,0x10,0xf0,
-0x05,0xcf,0xf9,0x06,0xff,0x78,0xff,0x60,0xbf,0xfb,0x00,0x00,0x9f,0xfc,0x0a,0xff,
-0x35,0xff,0x90,0xef,0xf7,0xf3,0x02,0x52,0x0d,0xff,0x01,0xff,0xd1,0xd4,0x02,0x70,
-0x3f,0xfc,0x00,0xdf,0xf5,0xff,0xf1,0x39,0x03,0x50,0x9f,0xf8,0x00,0xaf,0xfb,0xa2,
-0x00,0x13,0x0c,0xe4,0x0b,0x11,0xa0,0xb3,0x00,0x10,0xf1,0xc6,0x11,0x11,0x70,0xa0,
-0x03,0x10,0xd0,0x90,0x06,0x11,0x40,0xd5,0x0c,0x10,0xa0,0xc3,0x03,0x02,0xc3,0x00,
-0x10,0x60,0x3f,0x04,0x02,0x7e,0x0b,0x10,0x20,0x88,0x03,0x00,0xb2,0x02,0x10,0xd0,
-0xf0,0x02,0x21,0xf3,0x0c,0xe1,0x18,0x70,0xff,0xa0,0x03,0xff,0xfe,0x00,0x01,0xf2,
-0x17,0x40,0xaf,0xff,0x70,0x08,0x15,0x01,0x10,0x2f,0xd1,0x09,0x10,0xf1,0x5f,0x00,
-0x20,0xf7,0x9f,0x5c,0x00,0x10,0x01,0x7b,0x09,0x02,0x3f,0x0d,0x02,0x54,0x0d,0x11,
-0x0e,0xe9,0x11,0x01,0x80,0x00,0x13,0x70,0x85,0x17,0x11,0xe0,0x2d,0x0d,0x02,0x5a,
-0x17,0x60,0x02,0xff,0xfd,0xef,0xff,0x10,0x47,0x04,0x40,0xf5,0x7f,0xff,0x90,0xc8,
-0x00,0x20,0xd0,0x0e,0x92,0x06,0x10,0xcf,0xc3,0x06,0x51,0xfa,0x00,0x05,0xff,0xfc,
-0x5c,0x01,0x40,0x0d,0xff,0xf4,0x00,0x55,0x13,0x30,0x7f,0xff,0xc0,0x97,0x04,0x20,
-0xf5,0xbf,0xbd,0x00,0x10,0x0d,0xef,0x19,0x10,0xb0,0x0a,0x02,0x41,0xb0,0x0c,0xff,
-0xf2,0xd0,0x03,0x30,0x04,0xff,0xf9,0x49,0x02,0x00,0x40,0x00,0x40,0x10,0x09,0xff,
-0xf3,0xc1,0x00,0x22,0x70,0x1f,0x34,0x00,0x11,0xe0,0xd1,0x0d,0x32,0x05,0xff,0xf5,
-0x6a,0x0c,0x13,0xdf,0xa0,0x00,0x02,0x9e,0x07,0x01,0xa8,0x00,0x12,0x50,0x69,0x05,
-0x13,0xfd,0xef,0x0d,0x1f,0xf9,0x08,0x00,0x20,0x12,0x1f,0xb2,0x03,0x12,0x31,0x07,
-0x00,0x23,0xf3,0x1f,0xf3,0x17,0x52,0x11,0x11,0x11,0x11,0xaf,0x0d,0x05,0x01,0xa7,
-0x0f,0x01,0xbc,0x00,0x02,0x3d,0x12,0x12,0xf7,0x3d,0x00,0x02,0x75,0x00,0x12,0xcf,
-0x5f,0x02,0x12,0x6f,0x40,0x05,0x12,0x1f,0x2a,0x01,0x12,0x0b,0x55,0x04,0x12,0x05,
-0x6e,0x0e,0x42,0x01,0xef,0xfe,0x10,0x77,0x08,0x12,0x60,0xc3,0x09,0x10,0xc1,0xa0,
-0x08,0x12,0x0e,0x71,0x00,0x22,0x61,0xff,0xec,0x14,0x13,0x1f,0x9c,0x1a,0x61,0x7d,
-0xdd,0xd9,0x8f,0xff,0xfb,0x03,0x00,0x1f,0x00,0x03,0x00,0x28,0x03,0x45,0x00,0x00,
-0xbb,0x0e,0x02,0xe4,0x02,0x00,0x9c,0x00,0x11,0x80,0x9b,0x00,0x11,0xe0,0x9a,0x00,
-0x16,0xf4,0x61,0x14,0x22,0x9f,0xff,0xe6,0x00,0x11,0x50,0xe5,0x00,0x11,0xb0,0x86,
-0x1a,0x16,0xf1,0x2e,0x13,0x26,0xbf,0xfd,0x26,0x13,0x32,0x0f,0xff,0x90,0x6d,0x06,
-0x01,0x92,0x0a,0x02,0xfe,0x13,0x12,0xfb,0x62,0x0f,0x11,0x10,0x8b,0x04,0x11,0x70,
-0xab,0x07,0xbf,0xd0,0xbd,0xdd,0xd5,0xdf,0xff,0xf7,0xdf,0xff,0xf7,0x01,0x03,0x00,
-0x28,0x11,0xbd,0x42,0x00,0x10,0xdf,0x86,0x00,0x01,0xb5,0x00,0x01,0xd9,0x06,0x30,
-0x0d,0xff,0xfc,0xc0,0x0f,0x10,0xcf,0x8b,0x0f,0xf2,0x11,0xf1,0xff,0x90,0x00,0x1f,
-0xfa,0x0a,0xff,0x00,0x07,0xff,0x40,0x5f,0xf6,0x00,0xdf,0xe0,0x00,0xef,0xc0,0x4f,
-0xf8,0x00,0x09,0xff,0x30,0xde,0xee,0xee,0xee,0xee,0xe1,0x4b,0x0d,0x02,0x06,0x00,
-0x30,0x1d,0xff,0xb0,0xad,0x03,0x70,0x00,0x4f,0xfe,0x10,0x00,0x6f,0xf9,0xd1,0x19,
-0x10,0xc6,0xec,0x09,0x00,0xd2,0x05,0x40,0x07,0xff,0xfe,0xce,0x92,0x04,0x10,0xfd,
-0xba,0x00,0x02,0x30,0x01,0x00,0x26,0x0f,0x51,0xff,0xff,0xf0,0x01,0xcf,0x37,0x0a,
-0x71,0xaf,0xff,0x83,0x28,0xff,0xf0,0x0f,0x27,0x1a,0x01,0xb5,0x1b,0x00,0x57,0x13,
-0x81,0xb0,0x03,0xef,0xff,0x00,0xcf,0xff,0xed,0x0e,0x14,0x00,0x65,0x13,0x83,0x20,
-0x02,0xae,0xfd,0x82,0xff,0xf6,0xaf,0xfe,0x16,0x01,0x09,0x02,0x0f,0x0d,0x00,0x02,
-0x90,0xe2,0xae,0xfc,0x50,0x00,0xaf,0xff,0xef,0xff,0x32,0x0a,0x01,0x5f,0x08,0x60,
-0xaf,0xff,0x91,0x06,0xff,0xfb,0x27,0x00,0x00,0xef,0x08,0x10,0xfe,0x6e,0x01,0x90,
-0x2a,0xff,0xe0,0x00,0x04,0xff,0xf3,0xaf,0xfe,0x31,0x02,0x30,0x3a,0xff,0xe0,0x2e,
-0x14,0x02,0x3b,0x14,0x11,0x0a,0x2e,0x14,0x21,0xb0,0xaf,0xee,0x0d,0x30,0x0a,0xff,
-0xdf,0x59,0x07,0x50,0xaf,0xf9,0x3b,0xff,0xc6,0xb3,0x01,0x41,0x8d,0xff,0xc7,0x00,
-0x2a,0x17,0x12,0xfc,0xdb,0x0f,0x80,0xfa,0x00,0x8f,0xff,0x60,0x1b,0xff,0xf1,0xc8,
-0x10,0x30,0x1f,0xff,0x41,0x14,0x04,0x30,0x44,0x41,0x2f,0xeb,0x01,0x00,0x80,0x15,
-0x02,0xb3,0x02,0x14,0x60,0x0b,0x02,0xa1,0xef,0xf4,0x08,0xff,0xf6,0x01,0xaf,0xff,
-0x10,0x1e,0x9b,0x10,0x01,0xa7,0x16,0x10,0xc0,0xd3,0x12,0x01,0x34,0x07,0x04,0x1d,
-0x02,0x00,0x98,0x0a,0x0f,0x0d,0x00,0x01,0x70,0x4c,0xff,0xb2,0xdf,0xfb,0x00,0x7f,
-0x69,0x14,0x10,0xb0,0xaa,0x15,0x00,0xd1,0x00,0x70,0xf7,0x01,0x8f,0xff,0xb0,0xef,
-0xfc,0x27,0x00,0x00,0x2f,0x18,0x50,0x0d,0xff,0xb2,0xff,0xf5,0x0d,0x00,0x00,0x82,
-0x00,0x31,0x0d,0xff,0xb1,0xef,0x05,0x40,0xfb,0x0e,0xff,0xc0,0x41,0x00,0x81,0x9f,
-0xff,0x70,0x18,0xff,0xfb,0x02,0xff,0xe4,0x16,0x00,0x48,0x06,0x70,0xdf,0xfb,0x00,
-0x04,0xcf,0xfb,0x38,0x68,0x00,0x40,0x6c,0xef,0xd8,0x10,0x9d,0x0e,0x00,0x3a,0x18,
-0x11,0xcf,0x89,0x0c,0x40,0x6f,0xff,0x81,0x06,0x30,0x18,0xb2,0xc0,0x00,0x0b,0xff,
-0xa0,0xff,0xfc,0x88,0x88,0xcf,0xfc,0x43,0x03,0x12,0xd1,0x99,0x11,0x01,0xaa,0x02,
-0x00,0x33,0x06,0xc2,0x10,0x00,0x03,0x00,0x07,0xff,0xfc,0x30,0x06,0xeb,0x00,0x0d,
-0xd6,0x0e,0x12,0x1c,0xf4,0x0f,0x21,0x06,0xbe,0x61,0x15,0x30,0x7c,0xff,0xc0,0x53,
-0x00,0x00,0x56,0x04,0x41,0xe0,0x0a,0xff,0xf4,0x2b,0x16,0x10,0x0a,0x5b,0x08,0x00,
-0x61,0x01,0x51,0x77,0xbe,0xff,0xfb,0xb5,0x02,0x03,0x11,0x0b,0x9e,0x09,0x0f,0x09,
-0x00,0x14,0x80,0x00,0x03,0xbe,0xfd,0x65,0xff,0xe0,0x05,0x18,0x02,0x22,0xfe,0x01,
-0xd2,0x1a,0x90,0x9f,0xff,0x91,0x05,0xff,0xfe,0x0e,0xff,0xd0,0x0f,0x02,0x20,0xff,
-0xf8,0x0f,0x02,0x30,0x2f,0xff,0x60,0x0f,0x02,0x20,0xff,0xf6,0x0d,0x00,0x52,0x0f,
-0xff,0x80,0x00,0x0a,0xee,0x09,0x91,0xaf,0xfe,0x08,0xff,0xf9,0x00,0x5f,0xff,0xe0,
-0xd2,0x00,0x03,0xbd,0x15,0xa0,0xe0,0x00,0x3b,0xef,0xc4,0xaf,0xfe,0x00,0x01,0x00,
-0xf8,0x18,0x20,0x06,0xe5,0xc0,0x05,0x11,0x02,0xdd,0x15,0x22,0x10,0x0a,0x51,0x0a,
-0x71,0x04,0xae,0xfe,0xc7,0x00,0x00,0xbf,0xf3,0x03,0x0f,0x06,0x00,0x07,0xb1,0x19,
-0xef,0xd8,0x00,0xbf,0xfd,0xdf,0xff,0xff,0xa0,0xbf,0xf1,0x04,0x11,0xbf,0x17,0x06,
-0x20,0xbf,0xfd,0xb7,0x09,0x10,0xbf,0xaa,0x01,0x02,0x06,0x00,0x1f,0xfb,0x06,0x00,
-0x17,0xa1,0x2c,0xf9,0x09,0xff,0xf3,0x8f,0xff,0x20,0x9c,0x60,0x3a,0x04,0x3f,0x7f,
-0xff,0x17,0x05,0x00,0x0a,0x40,0x10,0x00,0x02,0xdf,0xeb,0x00,0x20,0xf2,0x00,0x5b,
-0x08,0x22,0x01,0xab,0xbd,0x13,0x00,0x73,0x04,0x0f,0x04,0x00,0x25,0xef,0x1d,0xff,
-0xf0,0x2f,0xff,0xff,0xa0,0x2f,0xff,0xff,0x20,0x1d,0xfe,0xa2,0x75,0x03,0x03,0x0b,
-0x0d,0x00,0x50,0x7f,0xff,0xc0,0xaf,0xfe,0x90,0x1a,0xf1,0x03,0x0a,0xff,0xe0,0x2e,
-0xff,0xf2,0x00,0xaf,0xfe,0x0d,0xff,0xf5,0x00,0x0a,0xff,0xea,0xff,0xf7,0xe4,0x13,
-0x12,0xfb,0x1d,0x04,0x01,0x42,0x0b,0x00,0x07,0x07,0x10,0x0a,0xf6,0x0e,0x00,0x44,
-0x07,0x30,0x23,0xff,0xfb,0x41,0x00,0x30,0x09,0xff,0xf5,0x4e,0x00,0x41,0x0e,0xff,
-0xe1,0x0a,0xf8,0x10,0x31,0xa0,0xaf,0xfe,0xee,0x08,0x0f,0xfd,0x00,0x0d,0x0c,0x0c,
-0x01,0xf2,0x05,0xaf,0xfa,0x19,0xef,0xe9,0x00,0x4c,0xff,0xc5,0x00,0xaf,0xfd,0xef,
-0xff,0xff,0xb7,0xff,0xff,0xff,0x50,0x63,0x14,0x00,0x7e,0x00,0xa0,0xaf,0xff,0x81,
-0x08,0xff,0xff,0x60,0x1c,0xff,0xf1,0x5f,0x00,0x01,0x5d,0x07,0x11,0xf3,0x0a,0x00,
-0x10,0xf9,0xaa,0x14,0x0f,0x0a,0x00,0x3d,0x11,0xbf,0x8c,0x00,0x10,0xbf,0x88,0x00,
-0x21,0xb0,0xbf,0x5e,0x04,0x42,0xbf,0xff,0x81,0x07,0x1c,0x02,0x20,0xef,0xfa,0x06,
-0x00,0x12,0xdf,0x06,0x00,0x1f,0xfb,0x06,0x00,0x17,0x30,0x00,0x01,0x7c,0xbb,0x03,
-0x22,0x00,0x2d,0xf6,0x13,0x11,0xdf,0x5c,0x07,0x81,0x07,0xff,0xf8,0x00,0x7f,0xff,
-0xa0,0x0d,0xbd,0x03,0x21,0xf0,0x0f,0xbd,0x1e,0x10,0xf3,0x13,0x04,0x33,0x03,0xff,
-0xf4,0x07,0x00,0x12,0x1f,0x15,0x00,0x00,0x23,0x00,0x10,0x0a,0xd6,0x0b,0x53,0xf8,
-0x10,0x7f,0xff,0xa0,0x87,0x1c,0x23,0x00,0x2e,0x93,0x10,0xe0,0x7d,0xff,0xd8,0x10,
-0x00,0xaf,0xfa,0x3b,0xff,0xc5,0x00,0x0a,0xff,0xef,0xf2,0x09,0x04,0x15,0x05,0x00,
-0x2f,0x00,0x30,0xb0,0xaf,0xfe,0x61,0x08,0x16,0x0a,0x3c,0x05,0x36,0x5f,0xff,0x3a,
-0x56,0x05,0x11,0x6f,0x63,0x05,0x10,0x0b,0x5f,0x0e,0x11,0x80,0x7d,0x05,0x01,0xf3,
-0x1f,0x00,0x41,0x00,0x00,0x97,0x05,0x4f,0xe2,0xbf,0xfc,0x50,0x49,0x02,0x0e,0x10,
-0x00,0xa0,0x04,0x41,0x37,0xff,0xb0,0x07,0xad,0x04,0x12,0x03,0xba,0x04,0x10,0xaf,
-0x34,0x01,0x10,0xfb,0x24,0x1d,0x05,0xe1,0x04,0x02,0xee,0x04,0x03,0xfb,0x04,0x02,
-0x08,0x05,0x03,0x15,0x05,0x71,0x09,0xff,0xf8,0x00,0x8f,0xff,0xb0,0xfa,0x19,0x01,
-0x3c,0x05,0x11,0xff,0x49,0x05,0x1e,0xb3,0x63,0x05,0x0d,0x0d,0x00,0xf1,0x04,0xaf,
-0xfb,0x2b,0xfd,0xaf,0xfd,0xef,0xfc,0xaf,0xff,0xff,0xfc,0xaf,0xff,0xfb,0x98,0xaf,
-0xff,0x40,0x97,0x00,0x0f,0x04,0x00,0x0c,0x00,0xd6,0x1b,0x22,0xfe,0xb5,0x37,0x0d,
-0x70,0xa0,0x07,0xff,0xfc,0xae,0xff,0xf6,0x5a,0x00,0x20,0xdf,0xfc,0xc4,0x1d,0x62,
-0x46,0x65,0x09,0xff,0xfc,0x63,0x1d,0x16,0x60,0xe8,0x10,0x00,0x08,0xef,0xff,0x6b,
-0x0f,0x64,0x03,0x7c,0xff,0xfa,0x29,0x99,0xb1,0x04,0x80,0xaf,0xfd,0x0a,0xff,0xfc,
-0x9c,0xff,0xf8,0x88,0x05,0x00,0xb3,0x0b,0x01,0x4e,0x00,0x21,0x78,0x84,0x45,0x02,
-0x03,0x04,0x00,0x00,0x75,0x0b,0x10,0xfd,0x04,0x00,0x48,0x9b,0xff,0xfd,0xb9,0x18,
-0x00,0x0d,0x04,0x00,0x30,0xef,0xfc,0x10,0x8a,0x00,0x00,0x7e,0x1a,0x4f,0x00,0x05,
-0xcf,0xfc,0x7a,0x04,0x1d,0x03,0x06,0x00,0x10,0xfe,0x86,0x08,0x71,0x9f,0xff,0x60,
-0x18,0xff,0xfb,0x4f,0x4a,0x01,0x10,0x0b,0x79,0x05,0x90,0xfb,0x00,0x8d,0xfe,0xb3,
-0xaf,0xfb,0xbf,0xff,0xec,0x01,0x11,0x45,0x2b,0x23,0x10,0xf0,0x04,0x09,0x20,0xef,
-0xfa,0x0c,0x05,0x10,0x2f,0xae,0x0a,0x40,0xf0,0x07,0xff,0xf0,0x44,0x1c,0x20,0xbf,
-0xfa,0xb0,0x0b,0x90,0x0f,0xff,0x50,0x00,0x07,0xff,0xd3,0xff,0xf1,0xc9,0x08,0x22,
-0x9f,0xfb,0x72,0x0a,0x10,0x60,0xf2,0x09,0x01,0x0f,0x09,0x12,0x3f,0x74,0x19,0x01,
-0xfd,0x12,0x02,0x0c,0x18,0x21,0x8f,0xfd,0xeb,0x21,0xc0,0x8f,0xfd,0x4f,0xff,0x00,
-0x08,0xff,0xd0,0x00,0xbf,0xf9,0x1f,0xd2,0x18,0xf0,0x05,0xf1,0x00,0xef,0xf6,0x0d,
-0xff,0x60,0x1f,0xff,0xf6,0x01,0xff,0xf2,0x09,0xff,0x90,0x5f,0xff,0xfa,0x05,0x0d,
-0x06,0xf0,0x01,0xc0,0x9f,0xfd,0xfe,0x08,0xff,0xa0,0x01,0xff,0xf0,0xef,0xc7,0xff,
-0x3b,0xff,0x60,0xfd,0x0b,0xc1,0x73,0xff,0x7e,0xff,0x20,0x00,0x9f,0xfc,0xff,0x30,
-0xef,0xdf,0xa2,0x02,0x00,0xe3,0x0c,0x10,0xfb,0x81,0x00,0x30,0xfa,0x00,0x5f,0x3e,
-0x02,0x00,0x9b,0x1e,0x31,0x1f,0xff,0xf3,0x93,0x1c,0x00,0x78,0x0d,0x00,0xef,0x0a,
-0xf0,0x0e,0xc0,0x00,0x07,0xff,0xb0,0x00,0x4f,0xff,0x70,0x00,0xaf,0xff,0x20,0xcf,
-0xff,0x10,0x3f,0xff,0x80,0x03,0xff,0xf8,0x0b,0xff,0xe1,0x00,0x0a,0xff,0xf6,0x35,
-0x00,0x12,0x2f,0xd2,0x0b,0x11,0x9f,0x21,0x0b,0x23,0x01,0xff,0x2c,0x0d,0x12,0xfe,
-0x7c,0x10,0x10,0xf8,0xbb,0x09,0x30,0xfe,0xff,0xf1,0x1d,0x07,0x30,0x2f,0xff,0x90,
-0xc1,0x13,0x41,0x9f,0xff,0x20,0x0e,0xa9,0x20,0x11,0x07,0xe7,0x18,0x21,0xf4,0xcf,
-0x34,0x01,0x52,0x57,0xff,0xf4,0x00,0x0b,0x34,0x01,0x20,0xff,0xfa,0x1f,0x09,0x10,
-0x4f,0x34,0x01,0x21,0xf1,0x08,0x34,0x01,0x20,0x60,0xdf,0x34,0x01,0x21,0xfb,0x2f,
-0xaa,0x18,0x30,0xf7,0xff,0xf0,0x49,0x08,0x02,0x04,0x1f,0x01,0xa6,0x0c,0x12,0x06,
-0x34,0x0c,0x12,0x1f,0x6b,0x0b,0x13,0xbf,0x99,0x13,0x01,0x3c,0x03,0x02,0x81,0x1c,
-0x01,0xb0,0x0d,0x12,0x09,0x6a,0x0c,0x11,0x9f,0xce,0x03,0x32,0x07,0xee,0xb3,0xd6,
-0x0b,0x00,0x9f,0x07,0x07,0x06,0x00,0x21,0xf6,0x00,0x30,0x0c,0x04,0x48,0x0b,0x02,
-0x58,0x20,0x01,0x70,0x0b,0x02,0x84,0x0b,0x11,0x0c,0x3e,0x00,0x10,0x7f,0x97,0x01,
-0x11,0x03,0xa3,0x01,0x11,0x0d,0x01,0x08,0x17,0x1f,0x06,0x00,0xf6,0x09,0x00,0x00,
-0x01,0x73,0x00,0x00,0x5f,0xf9,0x00,0x03,0xff,0xf7,0x00,0x0c,0xff,0x80,0x00,0x1f,
-0xff,0x10,0x00,0x3f,0xff,0x00,0x04,0x00,0x00,0x7c,0x01,0x11,0xfd,0x9c,0x00,0x31,
-0x4d,0xff,0xf2,0x9d,0x00,0x51,0x6f,0xff,0xb0,0x00,0x03,0xb3,0x0d,0x69,0xfc,0x00,
-0x00,0x4f,0xfe,0x00,0x30,0x00,0x50,0x1f,0xff,0x00,0x00,0x0e,0x2f,0x02,0x00,0x50,
-0x11,0x61,0xaf,0xfb,0x00,0x00,0x06,0xe5,0x45,0x09,0x2f,0x4e,0xf4,0x03,0x00,0x09,
-0xf0,0x00,0x4d,0xf3,0x09,0x20,0x00,0x00,0x5f,0xf8,0x00,0x00,0x4e,0xff,0x70,0x00,
-0x04,0x35,0x01,0x63,0xef,0xf5,0x00,0x00,0xbf,0xf7,0x04,0x00,0x01,0x60,0x14,0x01,
-0xe4,0x24,0xf1,0x01,0x00,0x5f,0xfe,0x10,0x00,0x0c,0xff,0xe7,0x00,0x01,0xcf,0xfa,
-0x00,0x08,0xff,0xfa,0x9e,0x0b,0x22,0x8f,0xfa,0x20,0x00,0x14,0xbf,0x04,0x00,0x11,
-0xf7,0xdb,0x1b,0x50,0x01,0xff,0xf2,0x00,0x1b,0x3f,0x11,0x44,0xfd,0x10,0x00,0x1f,
-0x86,0x1d,0x70,0x7e,0xfc,0x40,0x00,0x06,0x87,0x09,0x3e,0x01,0x20,0x0d,0xfd,0x5f,
-0x04,0x60,0x81,0x7f,0xfa,0x7f,0xf9,0x06,0x1e,0x05,0x20,0xaf,0xf1,0x6f,0x03,0xb0,
-0xb0,0x57,0x60,0x00,0x02,0xbf,0xe9,0x00,0x01,0xaf,0xe7,0x74,0x0e,0xd0,0x70,0x4f,
-0xb0,0x1e,0xe0,0x6f,0x50,0x0b,0xf1,0x4f,0xb0,0x1e,0xf0,0x10,0x00,0x40,0x01,0xae,
-0xd7,0x00,0xe4,0x10,0x42,0xff,0xc9,0x30,0x00,0xf4,0x10,0x22,0xff,0x90,0x43,0x12,
-0x00,0x1a,0x0a,0x91,0x9f,0xff,0xc4,0x00,0x15,0xdf,0xff,0x50,0x2f,0x43,0x1f,0x22,
-0xcf,0xfa,0x31,0x0c,0x23,0x03,0x61,0x66,0x08,0x00,0x84,0x01,0x42,0xfe,0xee,0xee,
-0xe5,0x80,0x0f,0x01,0x45,0x03,0x05,0xcb,0x01,0x13,0xdf,0x22,0x00,0x12,0x0b,0x3f,
-0x18,0x12,0x30,0xd7,0x0b,0x41,0x00,0x6f,0xd6,0x01,0x7f,0x16,0x91,0x2e,0xff,0xd0,
-0x08,0xff,0xfe,0x51,0x01,0x6e,0x73,0x0f,0x02,0x30,0x12,0x02,0x49,0x23,0x10,0xf7,
-0x62,0x00,0x40,0x9c,0xff,0xfc,0x82,0x27,0x03,0x3f,0x45,0xff,0xf4,0x05,0x00,0x15,
-0xe3,0x8f,0xd0,0x00,0xff,0x68,0xfd,0x00,0x0f,0xf6,0x6c,0xa0,0x00,0xcc,0x50,0x06,
-0x1e,0x12,0x40,0x03,0x0d,0x0f,0x09,0x00,0x35,0x00,0xa2,0x02,0x22,0xf4,0x00,0x6b,
-0x27,0x02,0xf5,0x0d,0x00,0xf6,0x10,0x13,0xff,0x5c,0x13,0x32,0xee,0xff,0x50,0x3c,
-0x06,0x32,0xa9,0xff,0xb0,0x41,0x1b,0x32,0x54,0xff,0xf1,0x88,0x00,0x12,0x00,0x81,
-0x13,0x20,0xbf,0xfb,0x46,0x02,0x00,0xac,0x03,0x11,0xf5,0x48,0x10,0x10,0x00,0x54,
-0x20,0x10,0x0f,0x38,0x01,0x11,0x0c,0xe1,0x1f,0x14,0xc0,0xa8,0x0e,0x11,0xf2,0xa7,
-0x0f,0x02,0x0e,0x01,0xb2,0xcf,0xff,0xdd,0xdd,0xdd,0xef,0xfd,0x00,0x02,0xff,0xf7,
-0xe5,0x0d,0x01,0x95,0x04,0x00,0xe8,0x0d,0x00,0x37,0x07,0x01,0x8f,0x0a,0x32,0x3f,
-0xff,0x60,0xf3,0x21,0x01,0xec,0x1e,0x01,0x41,0x08,0x03,0xc2,0x01,0x20,0x5f,0xff,
-0x23,0x0d,0x14,0xe8,0xbf,0x00,0x02,0xcc,0x00,0x02,0xaf,0x00,0x0c,0x11,0x00,0x00,
-0xcb,0x01,0x53,0xed,0xc8,0x20,0x00,0x5f,0x0b,0x29,0x23,0x05,0xff,0x16,0x15,0x01,
-0x22,0x00,0x32,0x3a,0xff,0xfc,0x33,0x00,0x32,0x0d,0xff,0xf0,0x33,0x00,0x22,0x9f,
-0xff,0x11,0x00,0x13,0x0c,0x11,0x00,0x10,0x19,0x00,0x05,0x30,0xff,0xee,0xee,0x60,
-0x07,0x12,0x5f,0x5f,0x0f,0x21,0x40,0x05,0x07,0x00,0x22,0xc8,0x10,0x55,0x00,0x23,
-0xda,0x40,0x5d,0x00,0x00,0xf5,0x04,0x60,0xdc,0xcc,0xde,0xff,0xff,0x70,0x3a,0x00,
-0x00,0xcc,0x10,0x00,0x08,0x00,0x00,0xfd,0x15,0x03,0x08,0x00,0x13,0xc0,0x18,0x00,
-0x10,0x60,0x28,0x00,0x11,0xce,0x26,0x0b,0x02,0x41,0x1a,0x03,0x59,0x00,0x20,0x50,
-0x5f,0xa5,0x16,0x10,0x3b,0xfb,0x01,0x11,0x40,0x9d,0x0e,0x12,0x5f,0xb5,0x29,0x12,
-0xfe,0x08,0x00,0x20,0xdf,0xfd,0x08,0x00,0x00,0x52,0x03,0x00,0x40,0x00,0x24,0xcd,
-0xff,0x19,0x01,0x21,0xff,0x50,0x08,0x00,0x23,0xec,0x81,0x48,0x00,0x21,0xb5,0xff,
-0x48,0x06,0x02,0x25,0x01,0x36,0x95,0xff,0xf4,0x10,0x01,0x1f,0x05,0x0d,0x00,0x41,
-0x03,0xe2,0x02,0x14,0xf1,0x09,0x25,0x14,0xf1,0xc6,0x04,0x11,0xf1,0x2e,0x02,0x21,
-0x61,0x17,0x09,0x00,0x10,0x2f,0x1c,0x15,0x11,0xf1,0x6c,0x02,0x12,0x10,0x09,0x00,
-0x21,0x6f,0xff,0x29,0x02,0x00,0x62,0x12,0x03,0x09,0x00,0x23,0xcf,0xfa,0x09,0x00,
-0x21,0xff,0xf7,0x09,0x00,0x00,0xee,0x08,0x02,0x09,0x00,0x00,0xb7,0x05,0x01,0x09,
-0x00,0x11,0x0d,0x69,0x13,0x12,0xf1,0x59,0x1a,0x00,0x09,0x00,0x10,0x11,0xbb,0x1e,
-0x53,0x16,0xff,0xf2,0x10,0xcf,0xd9,0x01,0x2e,0xf5,0xcf,0x09,0x00,0x12,0xf4,0xe4,
-0x1d,0x0f,0x09,0x00,0x12,0x03,0x54,0x01,0x13,0x35,0x53,0x11,0x02,0x46,0x01,0x48,
+0x00,0x1d,0x00,0x1e,0x1f,0x26,0x05,0x58,0x20,0x00,0x21,0x22,0x00,0x01,0x00,0x2f,
+0xf4,0x00,0x01,0x00,0x29,0x13,0xf9,0x08,0x00,0x17,0xe9,0x14,0x00,0xbf,0xf6,0xf4,
+0x00,0xfc,0xee,0x00,0xee,0x00,0x00,0x00,0x02,0x58,0x00,0x26,0x4f,0x04,0x07,0x00,
+0x04,0x3c,0x00,0x25,0x2f,0xc8,0x00,0x01,0x00,0x3b,0x1f,0xd0,0x44,0x00,0x30,0x03,
+0x20,0x01,0xb1,0xf0,0x00,0xfc,0x00,0x00,0xe9,0xfd,0xf1,0xf8,0x00,0xe3,0x10,0x00,
+0x8f,0xf7,0xfe,0x00,0x00,0xfd,0xfe,0xf6,0xfa,0x2a,0x01,0x24,0x6f,0xfb,0x00,0xfb,
+0x00,0x00,0xf5,0x96,0x00,0x27,0x15,0xfb,0x0a,0x00,0x12,0xfa,0x07,0x00,0x19,0xfe,
+0x1f,0x00,0x1f,0xfd,0x4c,0x00,0x19,0x30,0xe8,0x00,0x00,0xdd,0x00,0x8f,0x00,0xef,
+0x00,0xfc,0x00,0xfc,0xf8,0xfc,0x34,0x01,0x30,0x05,0x01,0x02,0x21,0xfc,0xfc,0x5a,
+0x00,0x2f,0xfd,0xfb,0x56,0x00,0x1d,0x20,0xca,0x00,0x01,0x08,0x15,0xd7,0x4a,0x00,
+0x62,0xf9,0xfc,0x00,0x00,0xfc,0xfb,0x04,0x00,0x0f,0x90,0x00,0x23,0x00,0x28,0x01,
+0x2f,0x03,0xfb,0xda,0x00,0x2d,0x1f,0xfc,0x99,0x02,0x33,0x16,0xe0,0xb9,0x01,0x04,
+0xcf,0x01,0x10,0xfb,0x5e,0x00,0x2f,0xf8,0xf4,0x2e,0x03,0x20,0xa7,0x04,0xf4,0x00,
+0x00,0xd8,0xfb,0xd8,0xee,0x00,0xca,0x01,0x02,0x2f,0xe8,0xf6,0x93,0x00,0x1c,0x72,
+0xb1,0x00,0x00,0x00,0xdd,0x00,0xdc,0x08,0x04,0x51,0x00,0xf9,0x00,0xfe,0xfd,0x47,
+0x02,0x3f,0x03,0x00,0x03,0xe5,0x00,0x25,0x6f,0xfa,0x00,0xfb,0xfc,0x00,0xf9,0x2f,
+0x01,0x31,0x10,0xf6,0x78,0x01,0x1f,0xf7,0x3d,0x00,0x24,0x01,0x53,0x01,0xb1,0xce,
+0xcb,0x00,0x00,0xe9,0xfb,0xd6,0xfd,0x03,0x00,0x03,0xd2,0x00,0xdf,0xdf,0xef,0x00,
+0xef,0xd7,0xf3,0xf1,0x00,0xf3,0xf0,0xf7,0xf1,0xf4,0x4a,0x02,0x1a,0x56,0xd6,0xe1,
+0x00,0x00,0xf1,0x60,0x03,0xa0,0x03,0xf7,0xf7,0x00,0x00,0xf7,0xfa,0x00,0x00,0xfb,
+0x82,0x03,0x0f,0xfa,0x04,0x18,0x94,0x03,0x00,0xe4,0xf4,0x00,0x00,0xf8,0x00,0x00,
+0x61,0x01,0x73,0x02,0xfa,0xfa,0x00,0x00,0xfa,0xfc,0x64,0x02,0x0f,0x76,0x01,0x1b,
+0x14,0xe2,0x13,0x04,0x15,0x03,0x50,0x02,0x10,0xfc,0x50,0x02,0x1f,0xfa,0xb1,0x01,
+0x1b,0xf0,0x0a,0x04,0xf6,0xd3,0xe2,0x00,0x00,0xe3,0xfa,0xed,0xfd,0x03,0xed,0x04,
+0x03,0x03,0x04,0x00,0x04,0xf4,0xf3,0xfc,0xf8,0xf3,0xf8,0xf5,0x17,0x04,0x2f,0xfc,
+0xfa,0xd8,0x05,0x1e,0x09,0x70,0x03,0x13,0xfc,0x94,0x00,0x2f,0xfb,0xfb,0x7a,0x03,
+0x25,0x0f,0x7d,0x03,0x2a,0x0e,0x13,0x05,0x0f,0x30,0x05,0x25,0x0f,0x55,0x01,0x0a,
+0x3f,0xfe,0x00,0xfd,0x4d,0x00,0x17,0x0a,0xb5,0x05,0x0f,0xde,0x00,0x73,0x1e,0x03,
+0xc5,0x02,0x17,0x04,0x6f,0x06,0x0f,0xe4,0x02,0x18,0x1f,0xf0,0xce,0x07,0x3c,0x0f,
+0x8b,0x05,0x31,0x1f,0xef,0x28,0x01,0x0b,0x1f,0xfc,0x2b,0x01,0x17,0x00,0x6a,0x03,
+0x1c,0xde,0x1a,0x02,0x20,0xfc,0x04,0xf1,0x04,0x4f,0x0a,0x00,0x04,0x03,0xe1,0x00,
+0x30,0x0f,0xbd,0x03,0x1b,0x04,0x94,0x00,0x1c,0xdf,0xd5,0x00,0x2f,0xfd,0x03,0x01,
+0x02,0x1b,0x09,0x18,0x08,0x0f,0xbc,0x01,0x47,0x1f,0xf8,0xf9,0x02,0x36,0x0e,0xde,
+0x00,0x0f,0x56,0x04,0x57,0x0f,0x01,0x00,0x10,0xfa,0x00,0x0f,0x00,0x00,0x05,0x00,
+0xfb,0xfb,0xf6,0xec,0xf1,0xf6,0x00,0xe2,0x00,0x05,0xfe,0x04,0x0f,0x0d,0x05,0x19,
+0x50,0xf1,0x00,0xf6,0xfb,0xf6,0x34,0x00,0x5e,0xf6,0xf6,0xfb,0xf6,0xf1,0xe0,0x07,
+0x0f,0x4b,0x00,0x17,0xde,0xec,0xfb,0xf1,0xfb,0xf6,0x00,0xf6,0x00,0xf1,0xf1,0xf1,
+0xf6,0xf1,0x4a,0x00,0x00,0x8e,0x08,0x1f,0xf1,0x4a,0x00,0x13,0x20,0xe7,0xf6,0x9e,
+0x07,0x14,0xfb,0x7c,0x00,0x10,0xfb,0x55,0x00,0x10,0xec,0x62,0x00,0x60,0xf1,0xf6,
+0xec,0x00,0xf1,0x00,0x03,0x00,0x00,0x66,0x00,0x0f,0x4d,0x00,0x13,0x13,0x05,0x07,
+0x00,0x05,0x4f,0x00,0x35,0x05,0x00,0x0a,0x18,0x00,0x1f,0x05,0x74,0x01,0x19,0x11,
+0x05,0x8b,0x00,0x20,0x0a,0x0a,0x0a,0x00,0x1f,0x05,0x23,0x01,0x22,0x05,0x7a,0x08,
+0x00,0xde,0x00,0x01,0x25,0x01,0x2f,0xf1,0xf6,0x08,0x02,0x2d,0x00,0x81,0x00,0x55,
+0x0a,0x0a,0xfb,0x00,0x0a,0xea,0x00,0x0f,0x97,0x00,0x25,0x06,0x01,0x00,0x1f,0x0a,
+0xa8,0x02,0x36,0x1e,0x05,0x4e,0x02,0x0f,0x99,0x00,0x15,0x20,0xf6,0xfb,0xf9,0x01,
+0x02,0x30,0x01,0x12,0xf1,0x35,0x00,0x1f,0xf6,0xd8,0x00,0x23,0x70,0xdd,0xe7,0xfb,
+0xfb,0xe7,0xfb,0xfb,0x52,0x00,0x10,0xfb,0xf0,0x02,0x03,0x63,0x02,0x05,0x52,0x00,
+0x0f,0x30,0x01,0x16,0x00,0x3c,0x00,0x11,0xfb,0x30,0x03,0x20,0xf6,0xfb,0xbb,0x01,
+0x02,0x78,0x03,0x19,0x05,0x71,0x0b,0x1f,0xfb,0xe4,0x02,0x15,0x11,0x0a,0x08,0x02,
+0x00,0x83,0x03,0x00,0x7e,0x03,0x00,0x06,0x00,0xd0,0xec,0x00,0x00,0xf1,0xe7,0xec,
+0x00,0xe7,0xfb,0xf1,0xe7,0x00,0xf1,0xf4,0x00,0x2f,0xfb,0xf6,0xa7,0x09,0x11,0x00,
+0x37,0x00,0x05,0x4a,0x00,0x10,0xf6,0x58,0x02,0xc2,0xe7,0xe7,0xfb,0xec,0xf1,0xe7,
+0xec,0xf1,0xe7,0xf1,0xf1,0xe7,0xe5,0x00,0x2f,0xf1,0xec,0xde,0x00,0x11,0x01,0x4a,
+0x00,0x01,0x5d,0x03,0x00,0xe8,0x00,0x07,0xb0,0x02,0x0f,0x4d,0x0e,0x23,0x14,0xf6,
+0xad,0x03,0x0e,0x03,0x02,0x0f,0xf0,0x02,0x2a,0x0b,0xe9,0x02,0x0f,0x9a,0x02,0x32,
+0x0f,0xc0,0x03,0x1a,0xef,0xfb,0xf1,0xf6,0xf1,0xf6,0xfb,0x00,0xf6,0xd8,0x00,0x00,
+0xec,0xe2,0xf1,0x84,0x0c,0x29,0x11,0xf6,0x24,0x01,0x01,0x6d,0x01,0x23,0xf1,0xfb,
+0x6d,0x01,0x1e,0x05,0x72,0x01,0x0f,0xe5,0x00,0x32,0x1f,0xf6,0x2b,0x0d,0x28,0x01,
+0x3e,0x03,0x04,0x64,0x10,0x2f,0xf6,0xf6,0xc2,0x01,0x22,0x23,0xfb,0xfb,0x05,0x00,
+0x21,0xfb,0xfb,0x1e,0x02,0x10,0xfb,0x45,0x03,0x0f,0x0c,0x02,0x26,0x13,0xf1,0xd3,
+0x00,0x03,0xe6,0x0e,0x0f,0x28,0x01,0x33,0x1f,0xfb,0x17,0x02,0x28,0x05,0xd9,0x02,
+0x12,0xfb,0xed,0x00,0x09,0x43,0x03,0x0f,0x8d,0x00,0x1e,0x03,0x8a,0x00,0x04,0x6a,
+0x01,0x1f,0xf6,0x93,0x00,0x23,0x16,0xf6,0x8a,0x00,0x01,0x54,0x07,0x02,0x72,0x01,
+0x0f,0x2a,0x01,0x2c,0x1e,0xfb,0xea,0x04,0x0f,0x28,0x01,0x1d,0x1a,0xfb,0x31,0x05,
+0x0f,0xde,0x00,0x24,0x19,0xfb,0x78,0x01,0x1e,0xfb,0xf8,0x08,0x0f,0x3d,0x13,0x1c,
+0x05,0xe4,0x02,0x1f,0xf6,0xe4,0x02,0x26,0x0b,0x2e,0x03,0x01,0xeb,0x02,0x0f,0x4a,
+0x00,0x23,0x0b,0xd4,0x09,0x05,0xcf,0x01,0x0f,0xde,0x00,0x25,0x07,0xb9,0x01,0x1f,
+0x0a,0xe3,0x02,0x29,0x32,0xf6,0xfb,0x05,0x2b,0x01,0x7f,0x00,0xfb,0xf6,0x05,0x00,
+0xfb,0x05,0xce,0x05,0x24,0x02,0x07,0x04,0x02,0x52,0x07,0x03,0xcc,0x01,0x0f,0x72,
+0x01,0x24,0x01,0x46,0x00,0x05,0x26,0x03,0x01,0x95,0x07,0x0f,0x78,0x03,0x28,0x0f,
+0x40,0x09,0x32,0x0f,0x1e,0x0a,0x2a,0x0f,0xcb,0x08,0x0b,0x03,0x04,0x00,0x0f,0x72,
+0x01,0x24,0x02,0x78,0x05,0x04,0x4c,0x02,0x11,0xf6,0x0c,0x04,0x12,0x01,0x6e,0x16,
+0x21,0x02,0x03,0x87,0x0f,0x1e,0x04,0x01,0x05,0x02,0x45,0x18,0x20,0x00,0x0c,0x47,
+0x18,0x30,0x0c,0x0c,0x09,0xa0,0x19,0x22,0x13,0x0d,0x4c,0x18,0x01,0x20,0x00,0x00,
+0x51,0x18,0x40,0x1d,0x1e,0x00,0x1f,0x4e,0x18,0xf3,0x00,0x1f,0x1f,0x21,0x1b,0x00,
+0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x42,0x00,0xf6,0x2b,0x29,0x2a,
+0x2b,0x2c,0x2d,0x00,0x2e,0x2f,0x00,0x00,0x30,0x31,0x32,0x00,0x33,0x00,0x34,0x35,
+0x36,0x37,0x38,0x39,0x3a,0x00,0x00,0x3b,0x3c,0x3d,0x00,0x3e,0x3f,0x40,0x41,0x42,
+0x43,0x44,0x45,0x00,0x00,0x46,0x47,0x48,0x00,0x49,0x00,0x4a,0x4b,0x4c,0x4d,0x4e,
+0x4f,0x50,0x00,0x00,0x51,0x52,0x53,0x00,0xa1,0x00,0x20,0x03,0x02,0x9c,0x00,0x4b,
+0x06,0x07,0x06,0x08,0x9f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,
+0x21,0x0c,0x00,0x08,0x00,0x24,0x0b,0x00,0xf1,0x18,0xd1,0x00,0x00,0x15,0x00,0x00,
+0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xf1,0x02,0x19,0x19,0x1a,0x19,
+0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x16,0x00,0xf0,
+0x09,0x24,0x00,0x00,0x00,0x25,0x00,0x26,0x27,0x00,0x00,0x00,0x28,0x29,0x00,0x2a,
+0x2b,0x00,0x2c,0x2d,0x2e,0x2f,0x30,0x00,0x31,0x1c,0x00,0x23,0x32,0x33,0xaf,0x00,
+0x54,0x35,0x36,0x3b,0x3c,0x3d,0xae,0x00,0xb0,0x46,0x36,0x47,0x36,0x40,0x48,0x49,
+0x4a,0x00,0x00,0x00,0xf1,0x12,0x6f,0xff,0x55,0xff,0xf4,0x5f,0xff,0x44,0xff,0xf3,
+0x4f,0xff,0x33,0xff,0xf2,0x3f,0xff,0x22,0xff,0xf1,0x2f,0xff,0x11,0xff,0xf0,0x1f,
+0xff,0x00,0xff,0xf0,0x0d,0xdc,0x00,0x01,0x00,0xe1,0x9d,0x90,0x5f,0xff,0x56,0xff,
+0xf5,0x0b,0xfb,0x00,0x3f,0xf4,0x3f,0xf3,0x02,0x00,0x71,0xf2,0x3f,0xf2,0x3f,0xf1,
+0x3f,0xf0,0x02,0x00,0xf1,0x27,0xe0,0x3f,0xd0,0x3f,0xc0,0x3f,0xc0,0x00,0x00,0x04,
+0xfe,0x00,0xbf,0x80,0x00,0x00,0x00,0x6f,0xc0,0x0d,0xf6,0x00,0x00,0x00,0x09,0xfa,
+0x00,0xff,0x30,0x00,0x00,0x00,0xbf,0x70,0x2f,0xf1,0x00,0x00,0x00,0x0e,0xf5,0x04,
+0xfe,0x00,0x00,0x13,0x33,0xff,0x53,0x9f,0xd3,0x31,0x04,0xff,0x01,0x00,0x21,0x60,
+0x4f,0x07,0x00,0xf1,0x11,0xf6,0x00,0x00,0x8f,0xa0,0x0f,0xf4,0x00,0x00,0x00,0x0b,
+0xf8,0x01,0xff,0x10,0x00,0x00,0x00,0xdf,0x50,0x4f,0xf0,0x00,0x00,0x33,0x3f,0xf5,
+0x38,0xfd,0x33,0x10,0x3f,0x25,0x00,0x22,0xf7,0x03,0x34,0x00,0x70,0x70,0x00,0x08,
+0xfb,0x00,0xff,0x40,0x59,0x00,0x26,0x80,0x1f,0x59,0x00,0xd1,0x00,0x01,0xff,0x20,
+0x7f,0xc0,0x00,0x00,0x00,0x3f,0xf0,0x0a,0xf9,0xb7,0x00,0x12,0x06,0x07,0x00,0x20,
+0x6f,0x90,0x06,0x00,0x20,0x18,0xfa,0x23,0x00,0xf0,0x0e,0xaf,0xff,0xff,0x90,0x00,
+0x01,0xef,0xff,0xff,0xff,0xc0,0x00,0xbf,0xff,0xdb,0xef,0xff,0x70,0x0f,0xff,0xb0,
+0x01,0xef,0xfd,0x02,0xff,0xf6,0x00,0x08,0xfb,0x00,0xf1,0x14,0x70,0x00,0x4a,0xaa,
+0x10,0xef,0xfe,0x20,0x00,0x00,0x00,0x07,0xff,0xff,0x92,0x00,0x00,0x00,0x0a,0xff,
+0xff,0xfb,0x20,0x00,0x00,0x06,0xef,0xff,0xff,0x60,0x00,0x00,0x00,0x5c,0xff,0x7b,
+0x00,0x60,0x05,0xff,0xfd,0x06,0x88,0x50,0x34,0x00,0xf0,0x06,0xcf,0xfc,0x00,0x00,
+0x6f,0xff,0x29,0xff,0xf3,0x00,0x0a,0xff,0xf1,0x3f,0xff,0xf9,0x7b,0xff,0xfc,0x00,
+0x9f,0xa8,0x00,0xd0,0x30,0x00,0x7f,0xff,0xff,0xfd,0x30,0x00,0x00,0x05,0xcf,0x93,
+0x00,0x49,0x00,0x11,0xf5,0x8f,0x00,0x80,0xaf,0x50,0x00,0x00,0x02,0xbf,0xfb,0x30,
+0x0c,0x00,0x50,0x02,0xff,0xff,0xff,0x20,0x09,0x00,0xf2,0x09,0x9f,0xe4,0x4e,0xf9,
+0x00,0x0a,0x80,0x00,0x0c,0xf9,0x00,0x8f,0xd0,0x03,0xff,0x20,0x00,0xdf,0x80,0x07,
+0xfd,0x00,0xdf,0x70,0x11,0x00,0x20,0x7f,0xd0,0x22,0x00,0x42,0x3e,0xfa,0x1f,0xf4,
+0x33,0x00,0x31,0x2a,0xfa,0x00,0x44,0x00,0x11,0x34,0x2b,0x01,0x00,0x2e,0x01,0x12,
+0x70,0x08,0x00,0x40,0x7f,0xd0,0x7d,0xfe,0x81,0x01,0xf1,0x15,0x1f,0xf3,0x9f,0xff,
+0xff,0xa0,0x00,0x00,0x0a,0xfa,0x1f,0xf9,0x29,0xff,0x20,0x00,0x04,0xfe,0x14,0xff,
+0x10,0x0f,0xf5,0x00,0x00,0xdf,0x60,0x5f,0xf0,0x00,0xff,0x60,0x00,0x7f,0xc0,0x04,
+0x11,0x00,0xc1,0x09,0xf3,0x00,0x1f,0xfa,0x28,0xff,0x20,0x00,0x01,0x00,0x00,0x33,
+0x00,0x00,0x01,0x00,0x02,0x44,0x00,0x31,0x3b,0xef,0xd7,0x0e,0x00,0x50,0x5f,0xff,
+0xff,0xfa,0x00,0x54,0x00,0x40,0xff,0xff,0xff,0xf5,0x56,0x01,0x31,0xff,0xe2,0x0a,
+0x29,0x00,0xe1,0x9f,0xf9,0x00,0x3f,0xfc,0x00,0x00,0x00,0x08,0xff,0xa0,0x05,0xff,
+0x90,0x2a,0x00,0x30,0x14,0xff,0xf3,0x2b,0x00,0x51,0xef,0xfd,0xff,0xf8,0x00,0x25,
+0x01,0x22,0xff,0xf7,0x44,0x00,0x00,0x10,0x00,0xf0,0x11,0x11,0x00,0x00,0x8f,0xff,
+0xff,0xf3,0x00,0xff,0xf0,0x00,0x6f,0xff,0x9e,0xff,0xe1,0x2f,0xff,0x00,0x0d,0xff,
+0xb0,0x3f,0xff,0xc8,0xff,0xc0,0x01,0xff,0xf7,0x00,0x5f,0x2d,0x00,0x30,0x1f,0xff,
+0x90,0x36,0x01,0x60,0x10,0x00,0xef,0xff,0x50,0x04,0xac,0x01,0x32,0x06,0xff,0xff,
+0x4c,0x01,0x11,0x09,0x08,0x00,0xd1,0xfe,0x10,0x00,0x04,0xae,0xff,0xd8,0x24,0xff,
+0xfb,0x00,0x3f,0xf5,0x02,0x00,0x12,0xf3,0x89,0x02,0xf2,0x27,0x00,0x00,0x00,0x40,
+0x00,0x00,0x1c,0xe0,0x00,0x00,0xdf,0xf2,0x00,0x0a,0xff,0x40,0x00,0x4f,0xf8,0x00,
+0x00,0xcf,0xf0,0x00,0x03,0xff,0x90,0x00,0x09,0xff,0x40,0x00,0x0d,0xff,0x10,0x00,
+0x1f,0xfd,0x00,0x00,0x4f,0xfb,0x00,0x00,0x5f,0xfa,0x00,0x00,0x6f,0xf9,0x00,0x00,
+0x7f,0xf8,0x04,0x00,0x00,0x0c,0x00,0xa0,0x4f,0xfa,0x00,0x00,0x2f,0xfc,0x00,0x00,
+0x0e,0xff,0xf2,0x01,0xf0,0x10,0x30,0x00,0x04,0xff,0x70,0x00,0x00,0xef,0xd0,0x00,
+0x00,0x6f,0xf6,0x00,0x00,0x0d,0xfe,0x10,0x00,0x02,0xff,0xd1,0x00,0x00,0x4f,0xf1,
+0x00,0x00,0x02,0x70,0x04,0x65,0x02,0x80,0xa0,0x00,0x00,0x5f,0xfb,0x00,0x00,0x07,
+0x28,0x00,0x22,0xcf,0xf2,0x41,0x00,0x00,0x65,0x00,0xd0,0x08,0xff,0x70,0x00,0x05,
+0xff,0xb0,0x00,0x01,0xff,0xf0,0x00,0x00,0x0f,0x01,0xa2,0xdf,0xf4,0x00,0x00,0xcf,
+0xf6,0x00,0x00,0xbf,0xf6,0x08,0x00,0x90,0xdf,0xf5,0x00,0x00,0xef,0xf3,0x00,0x00,
+0xff,0x9d,0x00,0x91,0xd0,0x00,0x07,0xff,0x80,0x00,0x0c,0xff,0x20,0x7d,0x00,0xf1,
+0x02,0x9f,0xf4,0x00,0x04,0xff,0xa0,0x00,0x3e,0xfd,0x10,0x00,0x4f,0xd2,0x00,0x00,
+0x08,0x10,0x3c,0x01,0x11,0xf0,0x06,0x00,0x10,0xe0,0x06,0x00,0xf0,0x10,0x4f,0xd0,
+0x00,0x00,0x2e,0x82,0x3f,0xc0,0x3a,0x90,0x7f,0xff,0xcf,0xec,0xff,0xe0,0x28,0xcf,
+0xff,0xff,0xfc,0x70,0x00,0x03,0xff,0xf9,0x10,0x00,0x00,0x0c,0xfd,0x4c,0x02,0xf4,
+0x02,0x8f,0xf1,0xbf,0xc0,0x00,0x03,0xff,0x70,0x2f,0xf8,0x00,0x00,0x6c,0x00,0x08,
+0xc1,0x00,0x01,0x00,0x31,0x06,0x77,0x30,0x9c,0x01,0x01,0x92,0x01,0x3a,0x0e,0xff,
+0x70,0x0d,0x00,0x72,0x01,0x55,0x55,0xef,0xfa,0x55,0x54,0x8f,0x03,0x12,0xe4,0x6c,
+0x01,0x02,0x0d,0x00,0x1e,0xe0,0x34,0x00,0x09,0x0d,0x00,0x00,0xb3,0x00,0xf4,0x06,
+0x4f,0xfa,0x04,0xff,0xa0,0x6f,0xf8,0x09,0xff,0x40,0xef,0xe0,0x5f,0xf5,0x00,0x57,
+0x00,0xaf,0xff,0xff,0xf3,0x04,0x00,0xb0,0x09,0xda,0x05,0xff,0xf6,0x6f,0xff,0x70,
+0xbf,0xb0,0x00,0xa5,0x00,0x01,0xaa,0x03,0x01,0x26,0x04,0x2e,0xf3,0x00,0x10,0x00,
+0x2f,0x0b,0xfe,0x10,0x00,0x02,0x10,0x90,0x10,0x00,0x14,0xf4,0x10,0x00,0x12,0x00,
+0x6f,0x02,0x10,0xf4,0x55,0x03,0x0f,0x10,0x00,0x03,0x11,0xa0,0xf2,0x00,0xa2,0xcf,
+0xfd,0x81,0x00,0x00,0x0b,0xff,0xff,0xff,0xe3,0x3f,0x02,0xf0,0x08,0xd0,0x01,0xff,
+0xfb,0x10,0x7f,0xff,0x60,0x7f,0xff,0x10,0x00,0xcf,0xfc,0x0a,0xff,0xd0,0x00,0x08,
+0xff,0xf0,0xcf,0xfb,0xc0,0x03,0x90,0x1d,0xff,0xb0,0x00,0x05,0xff,0xf2,0xdf,0xfb,
+0xad,0x02,0x2e,0x2d,0xff,0x0d,0x00,0x02,0x27,0x00,0x12,0x1a,0x34,0x00,0x11,0x6f,
+0x41,0x00,0x00,0x4e,0x00,0x42,0x6f,0xff,0x60,0x09,0x26,0x01,0x02,0x68,0x00,0x00,
+0x75,0x00,0x10,0x91,0x7d,0x00,0xb0,0x04,0xab,0x00,0x28,0xef,0xfc,0x5b,0xff,0xff,
+0xfc,0xff,0x04,0x00,0x50,0xfb,0xef,0xfc,0xb6,0x10,0x2b,0x04,0x0f,0x04,0x00,0x20,
+0x81,0x01,0x7c,0xef,0xd9,0x20,0x00,0x00,0x3e,0x81,0x03,0x01,0xbd,0x04,0xf0,0x0a,
+0xff,0x20,0x09,0xff,0xf7,0x00,0x9f,0xff,0x80,0x0e,0xff,0xb0,0x00,0x0e,0xff,0xb0,
+0x1f,0xff,0x70,0x00,0x0c,0xff,0xc0,0x02,0x22,0x84,0x02,0x11,0xa0,0x2a,0x02,0x21,
+0xff,0x50,0x19,0x04,0x11,0xfe,0x7a,0x04,0x00,0xb9,0x03,0x00,0x7e,0x03,0x11,0x90,
+0xc0,0x03,0x11,0xfc,0x21,0x00,0x00,0xd0,0x02,0x31,0x00,0x03,0xff,0xeb,0x04,0x11,
+0x2e,0xb8,0x03,0x21,0x01,0xdf,0xdb,0x04,0x11,0x0b,0xf7,0x01,0x22,0xf5,0x0c,0x9a,
+0x05,0x13,0x0c,0xa1,0x05,0x50,0x02,0x9d,0xff,0xd8,0x20,0x03,0x01,0x42,0xff,0xff,
+0xf4,0x00,0x8a,0x05,0x60,0x20,0x0b,0xff,0xf6,0x00,0x8f,0x85,0x00,0x70,0xa0,0x00,
+0x0d,0xff,0xc0,0x01,0x11,0x3c,0x00,0x12,0xc0,0x1e,0x02,0x10,0xa0,0xa2,0x04,0x10,
+0xaf,0xff,0x05,0x11,0x3f,0xdf,0x05,0x00,0x07,0x00,0x10,0x90,0x6a,0x00,0x33,0xef,
+0xff,0xfc,0x13,0x04,0x01,0x97,0x05,0x81,0x09,0xff,0xf0,0x04,0x44,0x10,0x00,0x07,
+0x7c,0x05,0x00,0x0e,0x00,0x72,0x0e,0xff,0xf5,0x00,0x6f,0xff,0xc0,0xf8,0x03,0x32,
+0x40,0x00,0x8f,0x1e,0x06,0x41,0x03,0xae,0xff,0xd9,0x29,0x05,0x12,0x03,0x8d,0x04,
+0x12,0x0c,0x07,0x00,0x21,0x6f,0xff,0xd6,0x05,0x11,0xef,0x07,0x00,0x12,0x09,0xa9,
+0x04,0x50,0x2f,0xfe,0xef,0xfa,0x00,0x6f,0x03,0x20,0xef,0xfa,0x82,0x04,0x30,0xc0,
+0xef,0xfa,0x90,0x00,0x10,0x30,0x07,0x00,0x90,0x8f,0xfa,0x00,0xef,0xfa,0x00,0x02,
+0xff,0xf1,0x07,0x00,0x30,0x0a,0xff,0x70,0x07,0x00,0x02,0x5c,0x06,0x22,0xfa,0x4f,
+0x07,0x00,0x03,0x0e,0x00,0x01,0xdb,0x02,0x01,0x06,0x00,0x0e,0x07,0x00,0x01,0xba,
+0x06,0x11,0xfb,0x09,0x01,0x32,0xff,0xb0,0x08,0x0d,0x00,0x72,0x9f,0xfa,0x11,0x11,
+0x11,0x00,0x0b,0x14,0x03,0x20,0xdf,0xf6,0x06,0x00,0x72,0x0f,0xff,0x78,0xbb,0x82,
+0x00,0x01,0x3d,0x01,0x20,0x2f,0xff,0x37,0x01,0x52,0x01,0x8d,0xe5,0x11,0x8f,0x21,
+0x01,0x11,0xaf,0xba,0x05,0x12,0x05,0x2f,0x05,0x50,0x3f,0xff,0x45,0x88,0x60,0x0d,
+0x00,0xd1,0x9f,0xff,0x10,0x00,0x9f,0xff,0x14,0xff,0xfb,0x10,0x5f,0xff,0xb0,0x87,
+0x01,0x32,0xf3,0x00,0x1c,0x01,0x01,0x41,0x05,0xbe,0xfd,0x92,0x00,0x01,0x10,0x9d,
+0x3f,0x01,0x40,0x1b,0xff,0xff,0xc0,0xb6,0x01,0x20,0xff,0xfc,0xf1,0x01,0x20,0xfa,
+0x41,0x88,0x04,0x11,0xf5,0xa0,0x00,0x12,0xf8,0xdc,0x01,0x70,0x39,0xde,0xc7,0x00,
+0x08,0xff,0xfe,0x9c,0x00,0x10,0xaf,0x48,0x00,0xa0,0xf8,0x0c,0xff,0xfb,0x20,0x6f,
+0xff,0xf0,0xcf,0xfe,0x07,0x02,0x90,0x4c,0xff,0xc0,0x00,0x02,0xff,0xf6,0xbf,0xfd,
+0xd6,0x05,0xf1,0x07,0x79,0xff,0xe0,0x00,0x02,0xff,0xf5,0x5f,0xff,0x40,0x00,0x7f,
+0xff,0x20,0xef,0xfd,0x20,0x5f,0xff,0xd0,0x06,0xff,0xe7,0x01,0x14,0x08,0x7d,0x01,
+0x20,0xfe,0xa3,0x55,0x00,0x01,0x15,0x00,0x03,0x07,0x00,0x02,0x29,0x01,0x12,0xf2,
+0x5e,0x02,0x12,0xb0,0x20,0x06,0x11,0x40,0x65,0x02,0x26,0xfe,0x00,0x26,0x04,0x32,
+0x05,0xff,0xf1,0xae,0x01,0x12,0xa0,0xe8,0x00,0x11,0x40,0xfc,0x00,0x21,0xfd,0x00,
+0xd4,0x03,0x00,0x22,0x00,0x00,0x41,0x07,0x05,0x31,0x02,0x00,0x15,0x02,0x01,0xa4,
+0x04,0x22,0xcf,0xfd,0xeb,0x01,0x12,0xf6,0x5f,0x00,0x12,0xf1,0x5f,0x00,0x01,0x30,
+0x02,0x20,0x07,0xcf,0x08,0x01,0x11,0x1d,0x0b,0x03,0x01,0x9b,0x02,0xf0,0x02,0xf1,
+0x03,0xff,0xfc,0x10,0x8f,0xff,0x80,0x6f,0xff,0x30,0x00,0xef,0xfb,0x06,0xff,0xf1,
+0x09,0x03,0xe2,0x4f,0xff,0x40,0x00,0xef,0xf9,0x00,0xef,0xfc,0x21,0x8f,0xff,0x30,
+0x03,0x35,0x08,0x10,0x06,0xb0,0x01,0x30,0x00,0x07,0xff,0xfc,0x07,0x00,0x31,0x05,
+0x50,0x5f,0xff,0x80,0xaf,0xfe,0xf6,0x06,0x81,0x0c,0xff,0xb0,0x00,0x06,0xff,0xf2,
+0xcf,0x0d,0x00,0x11,0x19,0x1a,0x00,0x11,0xe0,0xb1,0x01,0x01,0x94,0x06,0x80,0xff,
+0xf9,0x00,0x00,0x29,0xdf,0xfe,0xa4,0x3a,0x03,0x30,0xce,0xec,0x50,0x7c,0x01,0x00,
+0x48,0x00,0x10,0x0a,0x21,0x00,0x80,0x90,0x04,0xff,0xfa,0x10,0xaf,0xff,0x20,0xb8,
+0x01,0x31,0xff,0xf8,0x0d,0x17,0x00,0x30,0xd0,0xef,0xf9,0x05,0x01,0x00,0xd1,0x00,
+0x14,0x07,0x70,0x01,0x50,0x08,0xff,0xf8,0x00,0x4f,0x54,0x09,0x40,0xff,0xef,0xff,
+0xfe,0x55,0x00,0x92,0xfe,0xff,0xd0,0x00,0x3b,0xef,0xc5,0xbf,0xf9,0xda,0x00,0x10,
+0x50,0xe7,0x00,0x00,0x69,0x05,0x41,0x12,0x6c,0xff,0xf5,0x6a,0x01,0x10,0xfa,0x57,
+0x05,0x01,0x45,0x07,0x30,0x4f,0xec,0x82,0x94,0x03,0xaa,0xfb,0x06,0xff,0xf6,0x5f,
+0xff,0x60,0x9d,0xa0,0x00,0x01,0x00,0x21,0x09,0xd9,0x5d,0x05,0xe0,0x60,0xbf,0xb0,
+0x02,0xcf,0x90,0x09,0xff,0xf3,0x09,0xff,0xf3,0x01,0xbd,0x3e,0x05,0x0c,0x01,0x00,
+0x20,0x11,0x10,0x72,0x06,0x00,0x03,0x00,0xf7,0x00,0xe0,0x02,0xff,0xc0,0x05,0xff,
+0x80,0x0b,0xff,0x20,0x1f,0xf8,0x00,0x02,0x70,0x24,0x00,0x20,0x04,0xb2,0xe6,0x00,
+0xf0,0x09,0xdf,0xf2,0x00,0x00,0x18,0xef,0xff,0xf2,0x00,0x3a,0xff,0xff,0xff,0xc1,
+0x2b,0xff,0xff,0xfe,0x82,0x00,0x5f,0xff,0xfa,0x40,0x9f,0x01,0x12,0xc5,0xca,0x03,
+0x00,0x0d,0x00,0x30,0x7d,0xff,0xff,0x28,0x08,0x12,0x5c,0x06,0x02,0x12,0x3a,0x0c,
+0x02,0x33,0x18,0xe2,0x00,0x35,0x08,0x00,0x3a,0x01,0x08,0x06,0x00,0x0e,0x92,0x00,
+0x0e,0x24,0x00,0x21,0x78,0x10,0x42,0x02,0x21,0xfa,0x30,0xad,0x04,0xd1,0xfc,0x50,
+0x00,0x00,0x5e,0xff,0xff,0xfe,0x71,0x00,0x00,0x4a,0xff,0x3e,0x04,0x30,0x05,0xbf,
+0xff,0x81,0x07,0x90,0x7e,0xff,0xf1,0x00,0x06,0xcf,0xff,0xff,0xd0,0xa1,0x00,0x10,
+0xc5,0x23,0x04,0x10,0xa3,0x73,0x01,0x60,0x81,0x00,0x00,0x00,0x8d,0x60,0x42,0x00,
+0x03,0x16,0x09,0x70,0x18,0xdf,0xfd,0x92,0x00,0x01,0xdf,0x48,0x04,0x11,0x0c,0xa4,
+0x05,0xf1,0x03,0x3f,0xff,0xc2,0x19,0xff,0xf5,0x6f,0xff,0x30,0x01,0xff,0xf8,0x13,
+0x33,0x00,0x00,0xff,0xf7,0x10,0x05,0x10,0xf4,0xd5,0x00,0x00,0x51,0x03,0x11,0x02,
+0xf9,0x09,0x11,0x0d,0x96,0x03,0x11,0x6f,0xad,0x02,0x11,0xaf,0xf7,0x03,0x11,0xbf,
+0x89,0x02,0x26,0x12,0x20,0xbc,0x00,0x21,0x5d,0xb2,0x67,0x06,0x11,0xfb,0x06,0x00,
+0x01,0xd1,0x04,0x31,0x7e,0xd3,0x00,0xd7,0x02,0x42,0x7b,0xef,0xfd,0xa5,0x24,0x00,
+0x10,0x8f,0x74,0x00,0x10,0xd4,0x0a,0x00,0x61,0x1c,0xff,0xc6,0x21,0x23,0x8e,0x3f,
+0x0a,0x21,0xcf,0xf6,0x03,0x03,0x21,0xf4,0x00,0x96,0x08,0x00,0xf8,0x01,0xf0,0x0f,
+0xfd,0x00,0x00,0x3f,0xf7,0x00,0x00,0x02,0x20,0x00,0x01,0xef,0x50,0x00,0xaf,0xd0,
+0x00,0x05,0xef,0xff,0xa1,0x00,0x8f,0xb0,0x01,0xff,0x70,0x00,0x6f,0xff,0xe9,0x08,
+0xf0,0x1b,0xf0,0x05,0xff,0x20,0x02,0xff,0xb2,0x0d,0xfa,0x00,0x0f,0xf2,0x09,0xfd,
+0x00,0x0a,0xfe,0x10,0x0d,0xf9,0x00,0x0e,0xf4,0x0c,0xfa,0x00,0x1f,0xf9,0x00,0x0f,
+0xf8,0x00,0x0d,0xf5,0x0e,0xf8,0x00,0x5f,0xf5,0x00,0x0f,0xf7,0x0b,0x00,0xf0,0x08,
+0xf7,0x00,0x8f,0xf2,0x00,0x1f,0xf5,0x00,0x0e,0xf4,0x0e,0xf7,0x00,0xaf,0xf1,0x00,
+0x3f,0xf4,0x00,0x0f,0xf2,0x0e,0xf8,0x0b,0x00,0xf1,0x13,0x5f,0xf3,0x00,0x4f,0xe0,
+0x0c,0xfa,0x00,0x8f,0xf4,0x00,0xbf,0xf2,0x00,0xbf,0x90,0x09,0xfd,0x00,0x4f,0xfd,
+0x6a,0xff,0xf8,0x17,0xff,0x20,0x05,0xff,0x30,0x0c,0xff,0xff,0xcc,0xe3,0x09,0xd5,
+0xff,0xb0,0x01,0xaf,0xe9,0x01,0xaf,0xfb,0x40,0x00,0x00,0x8f,0xf6,0xf3,0x00,0x24,
+0x0d,0xff,0x2b,0x02,0x00,0x28,0x01,0x32,0x95,0x44,0x58,0x5b,0x08,0x11,0x1a,0x2d,
+0x06,0x02,0x18,0x00,0x53,0x28,0xce,0xff,0xda,0x50,0x8a,0x0a,0x23,0xff,0x40,0x36,
+0x00,0x23,0xf9,0x00,0xea,0x0a,0x14,0xf0,0x16,0x01,0x12,0x50,0x19,0x00,0x01,0x67,
+0x05,0x00,0xbc,0x08,0x02,0x1a,0x00,0x22,0x9f,0xfe,0x09,0x03,0x60,0x0e,0xff,0x90,
+0xcf,0xfb,0x00,0x00,0x03,0x21,0xf4,0x07,0xfb,0x03,0x62,0x9f,0xff,0x00,0x2f,0xff,
+0x60,0x24,0x04,0x20,0xdf,0xfc,0x19,0x00,0x30,0xf5,0x00,0x08,0x6f,0x02,0x13,0xaf,
+0x0f,0x0c,0x11,0x0f,0x08,0x00,0x10,0xfd,0x6f,0x0a,0x02,0x95,0x04,0xb1,0xbf,0xff,
+0x21,0x11,0x11,0x4f,0xff,0x80,0x1f,0xff,0xc0,0x8e,0x0a,0x31,0x06,0xff,0xf7,0x20,
+0x06,0x41,0xf3,0xbf,0xff,0x20,0x1f,0x05,0x40,0x90,0x6f,0xff,0xff,0xab,0x00,0x17,
+0x6f,0xcc,0x05,0x90,0xff,0xa0,0x6f,0xff,0x51,0x12,0x7f,0xff,0xf1,0xfa,0x01,0x30,
+0x08,0xff,0xf5,0x07,0x00,0x12,0x04,0x07,0x00,0x30,0x06,0xff,0xf3,0x07,0x00,0xb2,
+0x1d,0xff,0xe0,0x6f,0xff,0xcb,0xbc,0xff,0xff,0x30,0x6f,0xf5,0x00,0x02,0x38,0x00,
+0x10,0x80,0x1c,0x00,0x30,0x2b,0xff,0xf4,0x07,0x00,0x31,0x01,0xff,0xfa,0x39,0x02,
+0x22,0xef,0xfc,0x0e,0x00,0x82,0xfb,0x6f,0xff,0x40,0x01,0x3c,0xff,0xf8,0x2a,0x00,
+0x22,0xf1,0x6f,0xd6,0x06,0x10,0x6f,0x13,0x08,0x00,0xaf,0x02,0x52,0x6b,0xef,0xeb,
+0x60,0x00,0xa3,0x02,0x13,0xd3,0xda,0x07,0xa0,0xe2,0x00,0x9f,0xff,0xb4,0x24,0xaf,
+0xff,0xb0,0x2f,0x57,0x05,0x50,0xbf,0xff,0x17,0xff,0xf3,0xf3,0x00,0x30,0xf6,0xbf,
+0xff,0xd2,0x02,0x42,0x88,0x4d,0xff,0xd0,0x60,0x05,0x22,0xfc,0x00,0x66,0x06,0x18,
+0xc0,0x0f,0x00,0x13,0x0d,0x1e,0x00,0x01,0x2d,0x00,0x50,0x16,0x66,0x38,0xff,0xf3,
+0x84,0x05,0x40,0xf6,0x2f,0xff,0xa0,0x14,0x00,0xa2,0x20,0xbf,0xff,0xa3,0x24,0xaf,
+0xff,0xc0,0x01,0xef,0x27,0x01,0x22,0x02,0xdf,0xb3,0x08,0x51,0x00,0x7c,0xef,0xeb,
+0x70,0xdb,0x07,0x32,0xfd,0xa3,0x00,0x72,0x0b,0x11,0xfa,0xea,0x07,0x00,0x60,0x06,
+0x71,0x06,0xff,0xf5,0x12,0x5c,0xff,0xf8,0x10,0x03,0x31,0x0c,0xff,0xf2,0x2e,0x03,
+0x10,0x2f,0x41,0x01,0x10,0x40,0x5e,0x08,0x01,0x0f,0x00,0x10,0x0a,0x11,0x09,0x10,
+0x40,0xdb,0x01,0x40,0x26,0xff,0xf4,0x00,0x9c,0x01,0x07,0x0f,0x00,0x00,0xc0,0x05,
+0x08,0x2d,0x00,0x32,0x3f,0xff,0x90,0x4b,0x00,0x82,0xf3,0x06,0xff,0xf4,0x11,0x4c,
+0xff,0xf9,0x69,0x00,0x18,0xfd,0x78,0x00,0x10,0xfd,0x6e,0x05,0x02,0x2c,0x01,0x12,
+0x76,0xfb,0x0d,0x04,0x0d,0x00,0x52,0xf5,0x11,0x11,0x11,0x10,0x9b,0x03,0x02,0xb8,
+0x03,0x1b,0x00,0x0d,0x00,0x00,0x9c,0x06,0x03,0x3c,0x08,0x04,0x0d,0x00,0x0e,0x27,
+0x00,0x05,0x0d,0x00,0x02,0x4e,0x00,0x00,0x01,0x00,0x21,0x86,0xff,0x27,0x07,0x05,
+0xd2,0x01,0x00,0x01,0x00,0x12,0x26,0x4f,0x02,0x04,0x0d,0x00,0x0f,0x7c,0x00,0x22,
+0x00,0x18,0x08,0x0f,0x34,0x00,0x09,0x09,0x0d,0x00,0x50,0x40,0x00,0x00,0x00,0x00,
+0xf0,0x17,0x00,0x00,0x5b,0xef,0xfc,0x82,0x00,0x00,0x01,0xcf,0xff,0xff,0xff,0xf6,
+0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xf5,0x00,0x8f,0xff,0xd4,0x13,0x8f,0xff,0xe0,
+0x1f,0xff,0xd0,0x00,0x00,0x8f,0xff,0x45,0x1a,0x00,0xe0,0x01,0xff,0xf8,0xaf,0xff,
+0x10,0x00,0x00,0x01,0x22,0x1b,0xff,0xf0,0x00,0x01,0x00,0x21,0xdf,0xfe,0x07,0x00,
+0xf0,0x1a,0x0d,0xff,0xe0,0x00,0x5f,0xff,0xff,0xfa,0xdf,0xfe,0x00,0x05,0xff,0xff,
+0xff,0xab,0xff,0xf0,0x00,0x4d,0xdd,0xff,0xfa,0x9f,0xff,0x20,0x00,0x00,0x0f,0xff,
+0xa5,0xff,0xf7,0x00,0x00,0x00,0xff,0xfa,0x0f,0xff,0xe1,0x0f,0x00,0xb0,0xa0,0x8f,
+0xff,0xd5,0x11,0x3a,0xff,0xfa,0x00,0xcf,0xff,0x01,0x00,0xff,0x09,0x70,0x00,0xbf,
+0xff,0xff,0xff,0xfe,0x60,0x00,0x00,0x4a,0xef,0xfd,0xb6,0x00,0x00,0x6f,0xff,0x40,
+0x00,0x00,0x09,0xff,0xf0,0x08,0x00,0x27,0x01,0x01,0x00,0x1e,0xf0,0x08,0x00,0x4f,
+0x41,0x11,0x11,0x1a,0x58,0x00,0x27,0x5f,0x3f,0xff,0x73,0xff,0xf7,0x05,0x00,0x17,
+0x10,0x70,0x18,0x01,0x9f,0x4f,0xff,0x60,0x00,0x00,0x00,0x04,0xff,0xf6,0x0d,0x00,
+0x34,0xf1,0x07,0x65,0xcc,0xc2,0x00,0x04,0xff,0xf5,0x6f,0xff,0x50,0x00,0x8f,0xff,
+0x32,0xff,0xfd,0x41,0x6f,0xff,0xe0,0x0b,0xff,0xb7,0x01,0xb2,0x1c,0xff,0xff,0xff,
+0xf8,0x00,0x00,0x06,0xce,0xfe,0xa3,0x44,0x01,0x40,0x01,0xef,0xff,0x80,0x08,0x00,
+0x31,0x0b,0xff,0xfc,0x10,0x00,0x30,0x6f,0xff,0xe1,0x08,0x00,0x21,0x02,0xff,0x0c,
+0x00,0x41,0x40,0x0d,0xff,0xf8,0x28,0x00,0x30,0x9f,0xff,0xc0,0x08,0x00,0x40,0x44,
+0xff,0xfe,0x10,0x08,0x00,0x40,0x5e,0xff,0xf4,0x00,0x08,0x00,0x31,0xdf,0xff,0xb0,
+0x08,0x00,0x33,0xff,0xff,0xf3,0x08,0x00,0x11,0xfd,0x08,0x00,0x40,0xfe,0xdf,0xff,
+0x70,0x08,0x00,0x40,0xf3,0x3f,0xff,0xf1,0x08,0x00,0x41,0x60,0x09,0xff,0xfb,0x48,
+0x00,0x43,0x01,0xef,0xff,0x40,0x68,0x00,0x11,0xe0,0x08,0x00,0x31,0x0c,0xff,0xf8,
+0x08,0x00,0x41,0x03,0xff,0xff,0x20,0x44,0x01,0x31,0x9f,0xff,0xc0,0x08,0x00,0x21,
+0x00,0x06,0x64,0x00,0x1f,0x00,0x0d,0x00,0x44,0x42,0x11,0x11,0x11,0x10,0xf4,0x01,
+0x18,0x06,0x01,0x02,0x40,0x00,0x6f,0xff,0xf8,0x28,0x00,0x41,0xaf,0xff,0xf4,0x6f,
+0xcc,0x00,0x20,0x00,0xff,0x0a,0x00,0x52,0xff,0x30,0x00,0x00,0x05,0x0a,0x00,0x41,
+0x80,0x00,0x00,0x0a,0x0a,0x00,0x00,0xf2,0x02,0x10,0x0f,0x0a,0x00,0x70,0xfe,0xef,
+0xf3,0x00,0x00,0x5f,0xfc,0x14,0x00,0x60,0x8f,0xf8,0x00,0x00,0xaf,0xf8,0x0a,0x00,
+0x60,0x3f,0xfd,0x00,0x00,0xff,0xf3,0x0a,0x00,0x60,0x0e,0xff,0x30,0x05,0xff,0xb2,
+0x0a,0x00,0x60,0x18,0xff,0x80,0x0a,0xff,0x63,0x0a,0x00,0x60,0x13,0xff,0xd0,0x0f,
+0xff,0x14,0x0a,0x00,0x60,0x20,0xdf,0xf2,0x5f,0xfb,0x04,0x0a,0x00,0x61,0x30,0x8f,
+0xf8,0xaf,0xf6,0x05,0x0a,0x00,0x71,0x3f,0xfd,0xff,0xf1,0x06,0xff,0xf4,0x80,0x01,
+0x22,0xff,0xb0,0x0a,0x00,0x41,0x08,0xff,0xff,0x50,0x0a,0x00,0x00,0x9c,0x01,0x12,
+0x00,0x0a,0x00,0x34,0x00,0xdf,0xfb,0x0a,0x00,0x22,0x7f,0xf5,0x0a,0x00,0x13,0x80,
+0x8e,0x02,0x13,0xf2,0x08,0x00,0x14,0xfa,0xee,0x02,0x13,0x30,0x08,0x00,0x13,0xc0,
+0x08,0x00,0x12,0xf6,0x08,0x00,0x22,0xef,0xfe,0x08,0x00,0x31,0x7f,0xff,0x80,0x08,
+0x00,0x41,0x49,0xff,0xf1,0x09,0x06,0x03,0x22,0xff,0xfa,0xd6,0x02,0x51,0x7f,0xff,
+0x39,0xff,0xf0,0x8a,0x00,0x11,0xc9,0x08,0x00,0x32,0x05,0xff,0xfe,0xee,0x02,0x22,
+0xcf,0xff,0x08,0x00,0x13,0x3f,0x08,0x00,0x13,0x09,0x08,0x00,0x23,0x01,0xff,0x0e,
+0x03,0x13,0x7f,0x08,0x00,0x30,0x0e,0xff,0xf0,0x3d,0x04,0x10,0xec,0xa4,0x02,0x10,
+0x0b,0x23,0x02,0x22,0x20,0x00,0xd5,0x03,0xa1,0xe2,0x00,0x08,0xff,0xfd,0x52,0x4b,
+0xff,0xfb,0x00,0x3f,0x04,0x30,0xbf,0xff,0x40,0xb3,0x02,0xd0,0x00,0x2f,0xff,0x90,
+0xaf,0xff,0x00,0x00,0x00,0x0c,0xff,0xe0,0xcf,0x83,0x01,0xc3,0x0a,0xff,0xf0,0xef,
+0xfc,0x00,0x00,0x00,0x08,0xff,0xf2,0xff,0x08,0x00,0x04,0x10,0x00,0x04,0x20,0x00,
+0x04,0x30,0x00,0x01,0x40,0x00,0x60,0x1f,0xff,0xa0,0x1f,0xff,0xd1,0xc4,0x01,0x10,
+0x40,0x60,0x00,0x35,0x3a,0xff,0xfc,0x70,0x00,0x05,0x80,0x00,0x00,0xcd,0x04,0x12,
+0x70,0xb2,0x02,0x32,0xeb,0x60,0x00,0x03,0x02,0x22,0xd3,0x00,0x04,0x02,0x91,0xe1,
+0x06,0xff,0xf5,0x11,0x14,0xcf,0xff,0x90,0xbe,0x00,0x21,0xef,0xff,0x3b,0x02,0x31,
+0x09,0xff,0xf1,0x0f,0x00,0x30,0x8f,0xff,0x26,0x0f,0x00,0x12,0x0c,0x0f,0x00,0x42,
+0x29,0xff,0xfc,0x06,0x39,0x04,0x12,0x40,0x3c,0x00,0x11,0x60,0x0f,0x00,0x76,0xe9,
+0x20,0x00,0x6f,0xff,0x51,0x11,0x77,0x02,0x03,0x78,0x02,0x0f,0x0f,0x00,0x0c,0x1d,
+0x00,0x27,0x01,0x1f,0xdf,0x27,0x01,0x0b,0x22,0xbf,0xff,0x56,0x05,0x17,0xdf,0x27,
+0x01,0x00,0xaa,0x00,0x26,0xff,0xfb,0x27,0x01,0x00,0x10,0x00,0x04,0x20,0x00,0x04,
+0x30,0x00,0x04,0x40,0x00,0x01,0x50,0x00,0x03,0x27,0x01,0x10,0x4a,0x35,0x00,0x17,
+0xdf,0x27,0x01,0x21,0xff,0x60,0x90,0x00,0x12,0xef,0x56,0x04,0x00,0xff,0x02,0x11,
+0x90,0x09,0x00,0x31,0x3e,0xff,0x60,0x08,0x00,0x23,0x01,0xc5,0xb4,0x00,0x0b,0x47,
+0x01,0x13,0xd2,0x47,0x01,0x10,0xd0,0x47,0x01,0x40,0x25,0xef,0xff,0x50,0xde,0x00,
+0x31,0x04,0xff,0xfa,0xed,0x00,0x31,0x0f,0xff,0xb0,0xed,0x00,0x03,0x0f,0x00,0x12,
+0x3f,0x7d,0x04,0x32,0x4d,0xff,0xf3,0x3c,0x00,0x12,0xf9,0x3c,0x00,0x12,0xf8,0x4b,
+0x00,0x20,0xfc,0x00,0x47,0x01,0x31,0x1a,0xff,0xf4,0x29,0x01,0x31,0x2f,0xff,0xb0,
+0x29,0x01,0x30,0xaf,0xff,0x30,0x0f,0x00,0x42,0x03,0xff,0xfb,0x00,0xb9,0x04,0x13,
+0xf3,0x4b,0x00,0x02,0x5a,0x00,0x10,0xbf,0xac,0x03,0x61,0x4a,0xdf,0xfd,0x82,0x00,
+0x00,0x33,0x06,0x11,0xf7,0x07,0x00,0x00,0xf0,0x02,0xa0,0x4f,0xff,0xd4,0x11,0x6f,
+0xff,0xf0,0x08,0xff,0xf3,0x9c,0x02,0xe0,0x50,0x8f,0xff,0x20,0x00,0x02,0xbb,0xb5,
+0x06,0xff,0xfb,0x10,0x00,0x00,0xa6,0x02,0x10,0xfe,0x33,0x00,0x00,0xcf,0x02,0x10,
+0xfc,0xe1,0x00,0x10,0x2c,0x12,0x02,0x00,0x56,0x05,0x22,0xaf,0xff,0xa6,0x01,0x61,
+0x16,0xdf,0xff,0xe0,0x01,0x11,0x56,0x00,0x30,0x41,0xff,0xf9,0x6f,0x05,0x20,0xf7,
+0x0e,0x40,0x01,0xb1,0x5f,0xff,0x60,0x8f,0xff,0xb3,0x10,0x4e,0xff,0xf3,0x01,0x3f,
+0x01,0x40,0xfb,0x00,0x01,0xbf,0xbd,0x00,0x70,0x10,0x00,0x00,0x49,0xdf,0xfe,0xb5,
+0x33,0x02,0x11,0xff,0xd5,0x00,0x12,0xff,0x01,0x00,0x13,0x8f,0x6a,0x06,0xa2,0x11,
+0x11,0x3f,0xff,0x81,0x11,0x11,0x00,0x00,0x02,0x73,0x04,0x20,0x00,0x2f,0xbd,0x03,
+0x0f,0x0f,0x00,0x4f,0x30,0x9f,0xff,0x10,0xf5,0x01,0x31,0x09,0xff,0xf1,0x14,0x02,
+0x0f,0x0f,0x00,0x3f,0x30,0x07,0xff,0xf3,0x21,0x03,0xf1,0x02,0xf0,0x4f,0xff,0x90,
+0x00,0x02,0xff,0xfb,0x00,0xef,0xff,0x82,0x14,0xdf,0xff,0x60,0x05,0xf7,0x00,0x12,
+0xc0,0xdb,0x01,0x80,0xc1,0x00,0x00,0x02,0x9d,0xff,0xeb,0x50,0x9a,0x03,0x11,0x40,
+0x66,0x05,0x31,0x16,0xff,0xf9,0xbd,0x06,0x11,0xc0,0x95,0x02,0x61,0x08,0xff,0xf7,
+0x00,0xcf,0xff,0x02,0x03,0x40,0x20,0x07,0xff,0xf7,0xd5,0x03,0x11,0xc0,0x02,0x02,
+0x30,0x06,0xff,0xf7,0x15,0x00,0x00,0x86,0x01,0x91,0x20,0x00,0x07,0xff,0xf4,0x00,
+0x0f,0xff,0xd0,0xcc,0x02,0x32,0x04,0xff,0xf7,0x6a,0x08,0x00,0x4f,0x08,0x00,0xfd,
+0x02,0x31,0x0d,0xff,0xd0,0xcf,0x01,0x12,0x72,0x05,0x01,0x51,0xdf,0xfb,0x6f,0xff,
+0x30,0x17,0x03,0x33,0xfc,0xff,0xd0,0xe9,0x01,0x02,0x1e,0x01,0x21,0xef,0xff,0x19,
+0x00,0x00,0xc1,0x04,0x22,0xe0,0x00,0x1a,0x00,0x23,0xf9,0x00,0x1a,0x00,0x20,0x30,
+0x00,0x2c,0x02,0x50,0x20,0x00,0x0b,0xff,0x90,0x53,0x07,0x40,0x4f,0xff,0x50,0x00,
+0xf5,0x01,0xa0,0x07,0xff,0xf2,0x1f,0xff,0x80,0x00,0x2f,0xff,0xf1,0xf8,0x00,0xf0,
+0x3d,0x0d,0xff,0xb0,0x00,0x5f,0xff,0xf4,0x00,0x0c,0xff,0xb0,0x0a,0xff,0xe0,0x00,
+0x9f,0xff,0xf8,0x00,0x0f,0xff,0x80,0x06,0xff,0xf0,0x00,0xcf,0xff,0xfb,0x00,0x2f,
+0xff,0x50,0x03,0xff,0xf3,0x00,0xff,0xef,0xff,0x00,0x5f,0xff,0x10,0x00,0xff,0xf6,
+0x03,0xff,0xac,0xff,0x20,0x8f,0xfe,0x00,0x00,0xcf,0xf9,0x06,0xff,0x78,0xff,0x60,
+0xbf,0xfb,0x00,0x00,0x9f,0xfc,0x0a,0xff,0x35,0xff,0x90,0xef,0xf7,0xf3,0x02,0x52,
+0x0d,0xff,0x01,0xff,0xd1,0xd4,0x02,0x70,0x3f,0xfc,0x00,0xdf,0xf5,0xff,0xf1,0x39,
+0x03,0x70,0x9f,0xf8,0x00,0xaf,0xfb,0xff,0xe0,0x5b,0x01,0x20,0xff,0xf5,0x28,0x03,
+0x11,0xa0,0xb3,0x00,0x30,0xf1,0x00,0x2f,0x1e,0x09,0x00,0xa0,0x03,0x10,0xd0,0x90,
+0x06,0x10,0x40,0xe8,0x01,0x20,0xff,0xa0,0xc3,0x03,0x02,0xc3,0x00,0x31,0x60,0x00,
+0x08,0xca,0x06,0x00,0x32,0x01,0x00,0x88,0x03,0x00,0xb2,0x02,0x10,0xd0,0xf0,0x02,
+0x40,0xf3,0x0c,0xff,0xf6,0x9e,0x02,0x40,0xa0,0x03,0xff,0xfe,0xb6,0x05,0x60,0x20,
+0x00,0xaf,0xff,0x70,0x08,0x15,0x01,0x10,0x2f,0xd1,0x09,0x10,0xf1,0x5f,0x00,0x20,
+0xf7,0x9f,0x5c,0x00,0x10,0x01,0x7b,0x09,0x11,0x00,0x0b,0x01,0x22,0xff,0xf5,0x2d,
+0x03,0x23,0xff,0xc0,0x33,0x01,0x01,0xc2,0x08,0x13,0x1f,0x3b,0x01,0x10,0x9f,0x70,
+0x03,0x00,0x81,0x00,0x40,0xfd,0xef,0xff,0x10,0x47,0x04,0x40,0xf5,0x7f,0xff,0x90,
+0xc8,0x00,0x20,0xd0,0x0e,0x92,0x06,0x10,0xcf,0xc3,0x06,0x51,0xfa,0x00,0x05,0xff,
+0xfc,0x5c,0x01,0x30,0x0d,0xff,0xf4,0xef,0x00,0x40,0xc0,0x7f,0xff,0xc0,0x97,0x04,
+0x40,0xf5,0xbf,0xff,0x40,0x08,0x00,0x40,0xf2,0x3f,0xff,0xb0,0x0a,0x02,0x41,0xb0,
+0x0c,0xff,0xf2,0xd0,0x03,0x30,0x04,0xff,0xf9,0x49,0x02,0x00,0x40,0x00,0x40,0x10,
+0x09,0xff,0xf3,0xc1,0x00,0x22,0x70,0x1f,0x34,0x00,0x40,0xe0,0x7f,0xff,0x40,0xfc,
+0x00,0x31,0xf5,0xef,0xfc,0xe5,0x01,0x03,0xa0,0x00,0x02,0x9e,0x07,0x01,0xa8,0x00,
+0x12,0x50,0x69,0x05,0x22,0xfd,0x00,0x02,0x03,0x1f,0xf9,0x08,0x00,0x20,0x12,0x1f,
+0xb2,0x03,0x12,0x31,0x07,0x00,0x12,0xf3,0x0f,0x00,0x72,0xfe,0x10,0x11,0x11,0x11,
+0x11,0xaf,0x0d,0x05,0x12,0x3f,0x0f,0x01,0x10,0x0d,0xb1,0x00,0x02,0xbd,0x02,0x02,
+0x06,0x01,0x01,0x45,0x00,0x12,0xcf,0x5f,0x02,0x12,0x6f,0x40,0x05,0x12,0x1f,0x2a,
+0x01,0x32,0x0b,0xff,0xf4,0x56,0x05,0x11,0xfa,0x4c,0x05,0x32,0xef,0xfe,0x10,0x77,
+0x08,0x12,0x60,0xc3,0x09,0x10,0xc1,0xa0,0x08,0x12,0x0e,0x71,0x00,0x12,0x61,0x07,
+0x00,0x13,0xf6,0x87,0x00,0x71,0x60,0x7d,0xdd,0xd9,0x8f,0xff,0xfb,0x03,0x00,0x1f,
+0x00,0x03,0x00,0x28,0x03,0x45,0x00,0x33,0xdf,0xfc,0x00,0xe4,0x02,0x00,0x9c,0x00,
+0x11,0x80,0x9b,0x00,0x11,0xe0,0x9a,0x00,0x11,0xf4,0x40,0x02,0x12,0xfa,0xd8,0x01,
+0x02,0xe6,0x00,0x11,0x50,0xe5,0x00,0x00,0xf4,0x09,0x30,0x07,0xff,0xf1,0xb8,0x00,
+0x02,0xea,0x00,0x11,0xbf,0xe9,0x00,0x11,0x5f,0xe8,0x00,0x32,0x0f,0xff,0x90,0x6d,
+0x06,0x01,0x92,0x0a,0x11,0xf5,0x44,0x00,0x30,0xfb,0x00,0x00,0x69,0x02,0x11,0x10,
+0x8b,0x04,0x11,0x70,0xab,0x07,0xbf,0xd0,0xbd,0xdd,0xd5,0xdf,0xff,0xf7,0xdf,0xff,
+0xf7,0x01,0x03,0x00,0x28,0x11,0xbd,0x42,0x00,0x10,0xdf,0x86,0x00,0x01,0xb5,0x00,
+0x01,0xd9,0x06,0x10,0x0d,0x5f,0x02,0xf1,0x18,0x03,0xff,0xcf,0xf2,0x00,0x00,0xaf,
+0xf1,0xff,0x90,0x00,0x1f,0xfa,0x0a,0xff,0x00,0x07,0xff,0x40,0x5f,0xf6,0x00,0xdf,
+0xe0,0x00,0xef,0xc0,0x4f,0xf8,0x00,0x09,0xff,0x30,0xde,0xee,0xee,0xee,0xee,0xe1,
+0x52,0x01,0x12,0xf2,0x06,0x00,0x30,0x1d,0xff,0xb0,0xad,0x03,0xc0,0x00,0x4f,0xfe,
+0x10,0x00,0x6f,0xf9,0x00,0x04,0xae,0xff,0xc6,0xec,0x09,0x00,0xd2,0x05,0x40,0x07,
+0xff,0xfe,0xce,0x92,0x04,0x10,0xfd,0xba,0x00,0x02,0x30,0x01,0x91,0x00,0x00,0x6b,
+0xef,0xff,0xff,0xf0,0x01,0xcf,0x37,0x0a,0x60,0xaf,0xff,0x83,0x28,0xff,0xf0,0xfc,
+0x00,0xf1,0x15,0x7f,0xff,0x02,0xff,0xf6,0x00,0x08,0xff,0xf0,0x1f,0xff,0xb0,0x03,
+0xef,0xff,0x00,0xcf,0xff,0xed,0xff,0xff,0xf1,0x03,0xff,0xff,0xff,0xef,0xff,0x20,
+0x02,0xae,0xfd,0x82,0xff,0xf6,0xaf,0x4c,0x03,0x12,0x0a,0x09,0x02,0x0f,0x0d,0x00,
+0x02,0x90,0xe2,0xae,0xfc,0x50,0x00,0xaf,0xff,0xef,0xff,0x32,0x0a,0x01,0x5f,0x08,
+0x60,0xaf,0xff,0x91,0x06,0xff,0xfb,0x27,0x00,0x00,0xef,0x08,0x10,0xfe,0x6e,0x01,
+0x90,0x2a,0xff,0xe0,0x00,0x04,0xff,0xf3,0xaf,0xfe,0x31,0x02,0x90,0x3a,0xff,0xe0,
+0x00,0x06,0xff,0xf2,0xaf,0xfe,0xad,0x01,0x80,0x0a,0xff,0xf9,0x10,0x5f,0xff,0xb0,
+0xaf,0x3a,0x00,0x40,0xf4,0x0a,0xff,0xdf,0x59,0x07,0x50,0xaf,0xf9,0x3b,0xff,0xc6,
+0xb3,0x01,0x60,0x8d,0xff,0xc7,0x00,0x00,0x03,0x5f,0x07,0x00,0xfd,0x0b,0xf0,0x02,
+0xff,0xff,0xfa,0x00,0x8f,0xff,0x60,0x1b,0xff,0xf1,0x0e,0xff,0xa0,0x00,0x1f,0xff,
+0x41,0x14,0x04,0x20,0x44,0x41,0x08,0x01,0x00,0xc2,0x02,0x12,0xf5,0xb3,0x02,0x14,
+0x60,0x0b,0x02,0xa0,0xef,0xf4,0x08,0xff,0xf6,0x01,0xaf,0xff,0x10,0x1e,0x5c,0x00,
+0x10,0xa0,0x45,0x05,0x00,0xfb,0x02,0x21,0x18,0xdf,0x34,0x07,0x04,0x1d,0x02,0x00,
+0x98,0x0a,0x0f,0x0d,0x00,0x01,0x50,0x4c,0xff,0xb2,0xdf,0xfb,0x45,0x04,0x30,0xfe,
+0xff,0xb0,0x3a,0x00,0x00,0xd1,0x00,0x70,0xf7,0x01,0x8f,0xff,0xb0,0xef,0xfc,0x27,
+0x00,0x90,0x1f,0xff,0x70,0x00,0x0d,0xff,0xb2,0xff,0xf5,0x0d,0x00,0x00,0x82,0x00,
+0x31,0x0d,0xff,0xb1,0xef,0x05,0x40,0xfb,0x0e,0xff,0xc0,0x41,0x00,0x71,0x9f,0xff,
+0x70,0x18,0xff,0xfb,0x02,0x12,0x01,0x10,0xb0,0x48,0x06,0x70,0xdf,0xfb,0x00,0x04,
+0xcf,0xfb,0x38,0x68,0x00,0x41,0x6c,0xef,0xd8,0x10,0x9d,0x0e,0x41,0xfe,0x20,0x00,
+0xcf,0x89,0x0c,0xf2,0x04,0x6f,0xff,0x81,0x06,0xff,0xf5,0x0c,0xff,0xc0,0x00,0x0b,
+0xff,0xa0,0xff,0xfc,0x88,0x88,0xcf,0xfc,0x43,0x03,0x11,0xd1,0x06,0x00,0x11,0xfd,
+0xaa,0x02,0x00,0x33,0x06,0xc2,0x10,0x00,0x03,0x00,0x07,0xff,0xfc,0x30,0x06,0xeb,
+0x00,0x0d,0xd6,0x0e,0x11,0x1c,0x18,0x01,0xb0,0x00,0x06,0xbe,0xfe,0xa4,0x00,0x00,
+0x00,0x7c,0xff,0xc0,0x53,0x00,0x00,0x56,0x04,0x20,0xe0,0x0a,0x17,0x03,0x21,0xaf,
+0xfd,0x18,0x02,0x10,0xf7,0x61,0x01,0x51,0x77,0xbe,0xff,0xfb,0xb5,0x02,0x03,0x11,
+0x0b,0x9e,0x09,0x0f,0x09,0x00,0x14,0x80,0x00,0x03,0xbe,0xfd,0x65,0xff,0xe0,0x05,
+0x18,0x02,0x21,0xfe,0x01,0x91,0x00,0xa0,0xe0,0x9f,0xff,0x91,0x05,0xff,0xfe,0x0e,
+0xff,0xd0,0x0f,0x02,0x20,0xff,0xf8,0x0f,0x02,0x30,0x2f,0xff,0x60,0x0f,0x02,0x20,
+0xff,0xf6,0x0d,0x00,0x52,0x0f,0xff,0x80,0x00,0x0a,0xee,0x09,0x70,0xaf,0xfe,0x08,
+0xff,0xf9,0x00,0x5f,0xa8,0x05,0x01,0x9c,0x05,0x10,0x5f,0x54,0x01,0x90,0xe0,0x00,
+0x3b,0xef,0xc4,0xaf,0xfe,0x00,0x01,0x6e,0x01,0x30,0xc0,0x06,0xe5,0xc0,0x05,0x10,
+0x02,0x78,0x02,0x32,0xfe,0x10,0x0a,0x51,0x0a,0x60,0x04,0xae,0xfe,0xc7,0x00,0x00,
+0x6f,0xbf,0xfc,0x00,0x00,0x00,0x00,0x06,0x00,0x07,0xf0,0x0d,0x19,0xef,0xd8,0x00,
+0xbf,0xfd,0xdf,0xff,0xff,0xa0,0xbf,0xff,0xff,0xff,0xff,0xf3,0xbf,0xff,0x70,0x08,
+0xff,0xf8,0xbf,0xfd,0x00,0x00,0xff,0xfa,0x24,0x00,0x12,0xdf,0x06,0x00,0x1f,0xfb,
+0x06,0x00,0x17,0xff,0x03,0x2c,0xf9,0x09,0xff,0xf3,0x8f,0xff,0x20,0x9c,0x60,0x00,
+0x00,0x07,0xff,0xf1,0x7f,0xff,0x17,0x05,0x00,0x0a,0xf0,0x02,0x10,0x00,0x02,0xdf,
+0x80,0x00,0x0a,0xff,0xf2,0x00,0x09,0xff,0xf1,0x00,0x01,0xab,0x50,0x98,0x00,0x00,
+0x39,0x00,0x0f,0x04,0x00,0x26,0xf0,0x02,0x1d,0xff,0xf0,0x2f,0xff,0xff,0xa0,0x2f,
+0xff,0xff,0x20,0x1d,0xfe,0xa2,0x00,0xaf,0xfe,0x51,0x00,0x30,0x0a,0xff,0xe0,0x07,
+0x00,0x0f,0x0d,0x00,0x04,0xf0,0x12,0x7f,0xff,0xc0,0xaf,0xfe,0x00,0x4f,0xff,0xd1,
+0x0a,0xff,0xe0,0x2e,0xff,0xf2,0x00,0xaf,0xfe,0x0d,0xff,0xf5,0x00,0x0a,0xff,0xea,
+0xff,0xf7,0x00,0x00,0xaf,0xff,0xff,0xfb,0x27,0x00,0x31,0xff,0xff,0xd0,0x0d,0x00,
+0xf0,0x00,0xff,0x70,0x00,0x0a,0xff,0xfe,0xdf,0xff,0x20,0x00,0xaf,0xff,0x23,0xff,
+0xfb,0x41,0x00,0x30,0x09,0xff,0xf5,0x4e,0x00,0x30,0x0e,0xff,0xe1,0x4e,0x00,0x30,
+0x5f,0xff,0xa0,0x5b,0x00,0x3f,0xcf,0xff,0x40,0xfd,0x00,0x0d,0x0c,0x0c,0x01,0xf3,
+0x07,0xaf,0xfa,0x19,0xef,0xe9,0x00,0x4c,0xff,0xc5,0x00,0xaf,0xfd,0xef,0xff,0xff,
+0xb7,0xff,0xff,0xff,0x50,0xaf,0xff,0x01,0x00,0xd0,0xd0,0xaf,0xff,0x81,0x08,0xff,
+0xff,0x60,0x1c,0xff,0xf1,0xaf,0xfe,0xa0,0x01,0x41,0x00,0x05,0xff,0xf3,0x0a,0x00,
+0x5f,0xf9,0x00,0x04,0xff,0xf4,0x0a,0x00,0x3d,0x11,0xbf,0x8c,0x00,0x10,0xbf,0x88,
+0x00,0x11,0xb0,0x1c,0x02,0x52,0xf4,0xbf,0xff,0x81,0x07,0x1c,0x02,0x20,0xef,0xfa,
+0x06,0x00,0x12,0xdf,0x06,0x00,0x1f,0xfb,0x06,0x00,0x17,0xf0,0x17,0x00,0x01,0x7c,
+0xef,0xd8,0x10,0x00,0x00,0x2d,0xff,0xff,0xff,0xe3,0x00,0x00,0xdf,0xff,0xff,0xff,
+0xfe,0x10,0x07,0xff,0xf8,0x00,0x7f,0xff,0xa0,0x0d,0xff,0xc0,0x00,0x0b,0xff,0xf0,
+0x0f,0xff,0x70,0xd8,0x00,0x73,0x2f,0xff,0x50,0x00,0x03,0xff,0xf4,0x07,0x00,0x12,
+0x1f,0x15,0x00,0x00,0x23,0x00,0xc0,0x0a,0xff,0xf0,0x08,0xff,0xf8,0x10,0x7f,0xff,
+0xa0,0x01,0xef,0x96,0x00,0x30,0x20,0x00,0x2e,0xb8,0x02,0xf1,0x07,0x00,0x00,0x00,
+0x7d,0xff,0xd8,0x10,0x00,0xaf,0xfa,0x3b,0xff,0xc5,0x00,0x0a,0xff,0xef,0xff,0xff,
+0xf8,0x00,0xaf,0xb7,0x00,0x11,0x0a,0x2f,0x00,0x10,0xb0,0xda,0x00,0x20,0xbf,0xff,
+0xa0,0x01,0x30,0x06,0xff,0xf2,0x0d,0x00,0x72,0x5f,0xff,0x3a,0xff,0xe0,0x00,0x04,
+0x44,0x01,0x50,0x6f,0xff,0x2a,0xff,0xe0,0x80,0x00,0x71,0xaf,0xff,0x80,0x06,0xff,
+0xfb,0x0a,0x72,0x01,0x11,0x30,0x41,0x00,0x7f,0x80,0x0a,0xff,0xe2,0xbf,0xfc,0x50,
+0x49,0x02,0x0e,0xf1,0x00,0x00,0x00,0x04,0xcf,0xfb,0x37,0xff,0xb0,0x07,0xff,0xff,
+0xff,0xdf,0xfb,0x03,0x42,0x00,0x20,0xb0,0xaf,0x34,0x01,0xa0,0xfb,0x0e,0xff,0xb0,
+0x00,0x0d,0xff,0xb1,0xff,0xf7,0x05,0x01,0x00,0xd4,0x00,0x50,0x0d,0xff,0xb2,0xff,
+0xf5,0x0d,0x00,0x00,0xda,0x00,0x41,0x0d,0xff,0xb0,0xef,0x3b,0x03,0xa0,0x09,0xff,
+0xf8,0x00,0x8f,0xff,0xb0,0x2f,0xff,0xff,0x73,0x02,0x11,0x7f,0x41,0x00,0x90,0x00,
+0x4c,0xff,0xb3,0xdf,0xfb,0x00,0x00,0x00,0x27,0x00,0x00,0x07,0x00,0x0f,0x0d,0x00,
+0x03,0xf1,0x04,0xaf,0xfb,0x2b,0xfd,0xaf,0xfd,0xef,0xfc,0xaf,0xff,0xff,0xfc,0xaf,
+0xff,0xfb,0x98,0xaf,0xff,0x40,0x97,0x00,0x0f,0x04,0x00,0x0d,0x70,0x00,0x05,0xbe,
+0xfe,0xb5,0x00,0x00,0xe1,0x01,0x70,0xa0,0x07,0xff,0xfc,0xae,0xff,0xf6,0x5a,0x00,
+0xf0,0x13,0xdf,0xfc,0x0d,0xff,0xa0,0x00,0x46,0x65,0x09,0xff,0xfc,0x63,0x00,0x00,
+0x01,0xdf,0xff,0xff,0xe8,0x10,0x00,0x08,0xef,0xff,0xff,0xd1,0x00,0x00,0x03,0x7c,
+0xff,0xfa,0x29,0x99,0x3e,0x00,0xe1,0x2f,0xff,0x60,0x00,0xaf,0xfd,0x0a,0xff,0xfc,
+0x9c,0xff,0xf8,0x00,0xcf,0xad,0x00,0x11,0x06,0x4e,0x00,0x21,0x78,0x84,0x45,0x02,
+0x04,0x04,0x00,0x40,0xef,0xff,0xff,0xfd,0x04,0x00,0x48,0x9b,0xff,0xfd,0xb9,0x18,
+0x00,0x0d,0x04,0x00,0x30,0xef,0xfc,0x10,0x8a,0x00,0x8f,0x00,0x4f,0xff,0xff,0x00,
+0x05,0xcf,0xfc,0x7a,0x04,0x1d,0x03,0x06,0x00,0xc1,0xfe,0x00,0x00,0xef,0xfb,0x9f,
+0xff,0x60,0x18,0xff,0xfb,0x4f,0x4a,0x01,0xe0,0x0b,0xff,0xff,0xff,0xef,0xfb,0x00,
+0x8d,0xfe,0xb3,0xaf,0xfb,0xbf,0xff,0xec,0x01,0x30,0x45,0xff,0xf3,0x49,0x02,0x60,
+0x1f,0xff,0x80,0x00,0xef,0xfa,0x0c,0x05,0xf1,0x14,0x2f,0xff,0x50,0x06,0xff,0xf0,
+0x07,0xff,0xf0,0x00,0x1f,0xff,0x40,0xbf,0xfa,0x00,0x00,0xcf,0xf9,0x0f,0xff,0x50,
+0x00,0x07,0xff,0xd3,0xff,0xf1,0x00,0x00,0x2f,0xff,0x9f,0xfb,0x00,0xaf,0x02,0x50,
+0x60,0x00,0x00,0x08,0xff,0x13,0x00,0x51,0x00,0x3f,0xff,0xfc,0x00,0x14,0x00,0x20,
+0x70,0x00,0x14,0x00,0xf1,0x43,0xf2,0x00,0x00,0x8f,0xfd,0x00,0x03,0xff,0x90,0x00,
+0x8f,0xfd,0x4f,0xff,0x00,0x08,0xff,0xd0,0x00,0xbf,0xf9,0x1f,0xff,0x30,0x0c,0xff,
+0xf1,0x00,0xef,0xf6,0x0d,0xff,0x60,0x1f,0xff,0xf6,0x01,0xff,0xf2,0x09,0xff,0x90,
+0x5f,0xff,0xfa,0x05,0xff,0xe0,0x05,0xff,0xc0,0x9f,0xfd,0xfe,0x08,0xff,0xa0,0x01,
+0xff,0xf0,0xef,0xc7,0xff,0x3b,0xff,0x60,0x00,0xdf,0xf5,0xff,0x73,0xff,0x7e,0xff,
+0x20,0x00,0x9f,0xfc,0xff,0x30,0xef,0xdf,0xa2,0x02,0x50,0xfe,0x00,0x9f,0xff,0xfb,
+0x81,0x00,0x30,0xfa,0x00,0x5f,0x3e,0x02,0x70,0x0e,0xff,0xf5,0x00,0x1f,0xff,0xf3,
+0x7a,0x02,0xf0,0x19,0xf1,0x00,0x0c,0xff,0xf0,0x00,0x00,0x06,0xff,0xc0,0x00,0x07,
+0xff,0xb0,0x00,0x4f,0xff,0x70,0x00,0xaf,0xff,0x20,0xcf,0xff,0x10,0x3f,0xff,0x80,
+0x03,0xff,0xf8,0x0b,0xff,0xe1,0x00,0x0a,0xff,0xf6,0xff,0xf7,0x3e,0x00,0x10,0xff,
+0xea,0x01,0x71,0x9f,0xff,0xff,0x50,0x00,0x00,0x01,0xc7,0x04,0x21,0x00,0x3f,0x13,
+0x00,0x10,0x0b,0x26,0x03,0x40,0x00,0x04,0xff,0xfe,0xd3,0x00,0xf1,0x0b,0xdf,0xfe,
+0x2f,0xff,0x90,0x00,0x6f,0xff,0x60,0x9f,0xff,0x20,0x0e,0xff,0xd0,0x01,0xff,0xfb,
+0x07,0xff,0xf5,0x00,0x08,0xff,0xf4,0xcf,0x34,0x01,0x51,0x57,0xff,0xf4,0x00,0x0b,
+0x34,0x01,0x00,0x7b,0x04,0x40,0xcf,0xfd,0x00,0x4f,0x34,0x01,0x21,0xf1,0x08,0x34,
+0x01,0x20,0x60,0xdf,0x34,0x01,0x80,0xfb,0x2f,0xff,0x40,0x00,0x06,0xff,0xf7,0x98,
+0x00,0x51,0x1f,0xff,0xef,0xfa,0x00,0x59,0x02,0x10,0x40,0xa5,0x00,0x01,0x29,0x03,
+0x31,0x1f,0xff,0xf9,0x76,0x06,0x00,0x13,0x00,0x22,0x00,0x06,0x3c,0x03,0x11,0xbf,
+0x13,0x00,0x91,0x6f,0xff,0x30,0x00,0x00,0x09,0xff,0xff,0xc0,0xa8,0x00,0x10,0xf3,
+0x02,0x06,0x20,0xee,0xb3,0x19,0x00,0x10,0x0e,0xc2,0x01,0x17,0xfa,0x06,0x00,0x50,
+0xf6,0x00,0x00,0x00,0x4f,0xfd,0x02,0x40,0x01,0xef,0xfe,0x10,0x08,0x01,0x11,0xf5,
+0x3f,0x00,0xa1,0x90,0x00,0x00,0x02,0xff,0xfd,0x00,0x00,0x00,0x0c,0x3e,0x00,0x10,
+0x7f,0x97,0x01,0x11,0x03,0xa3,0x01,0x10,0x0d,0x36,0x00,0x27,0xfd,0x1f,0x06,0x00,
+0xf6,0x09,0x00,0x00,0x01,0x73,0x00,0x00,0x5f,0xf9,0x00,0x03,0xff,0xf7,0x00,0x0c,
+0xff,0x80,0x00,0x1f,0xff,0x10,0x00,0x3f,0xff,0x00,0x04,0x00,0x00,0x7c,0x01,0x11,
+0xfd,0x9c,0x00,0x31,0x4d,0xff,0xf2,0x9d,0x00,0xf9,0x01,0x6f,0xff,0xb0,0x00,0x03,
+0xef,0xf7,0x00,0x00,0x6f,0xfc,0x00,0x00,0x4f,0xfe,0x00,0x30,0x00,0x20,0x1f,0xff,
+0xa9,0x00,0x00,0x2f,0x02,0x90,0xe2,0x00,0x00,0xaf,0xfb,0x00,0x00,0x06,0xe5,0xbc,
+0x00,0x3f,0xef,0x4e,0xf4,0x03,0x00,0x09,0xf0,0x00,0x4d,0xf3,0x09,0x20,0x00,0x00,
+0x5f,0xf8,0x00,0x00,0x4e,0xff,0x70,0x00,0x04,0x35,0x01,0x63,0xef,0xf5,0x00,0x00,
+0xbf,0xf7,0x04,0x00,0xf2,0x12,0xf8,0x00,0x00,0xaf,0xf8,0x00,0x00,0x9f,0xf9,0x00,
+0x00,0x5f,0xfe,0x10,0x00,0x0c,0xff,0xe7,0x00,0x01,0xcf,0xfa,0x00,0x08,0xff,0xfa,
+0x00,0x3f,0xff,0x50,0x00,0x8f,0xfa,0x20,0x00,0x13,0xbf,0x04,0x00,0x00,0x34,0x00,
+0xf2,0x03,0xcf,0xf6,0x00,0x01,0xff,0xf2,0x00,0x1b,0xff,0xb0,0x00,0x6f,0xfd,0x10,
+0x00,0x1f,0x80,0x00,0x01,0x00,0x70,0x7e,0xfc,0x40,0x00,0x06,0x87,0x09,0x3e,0x01,
+0x20,0x0d,0xfd,0x5f,0x04,0x60,0x81,0x7f,0xfa,0x7f,0xf9,0x06,0x1e,0x05,0x20,0xaf,
+0xf1,0x6f,0x03,0xf0,0x0d,0xb0,0x57,0x60,0x00,0x02,0xbf,0xe9,0x00,0x01,0xaf,0xe7,
+0x00,0x0c,0xff,0xff,0x70,0x4f,0xb0,0x1e,0xe0,0x6f,0x50,0x0b,0xf1,0x4f,0xb0,0x1e,
+0xf0,0x10,0x00,0xe1,0x01,0xae,0xd7,0x00,0x00,0x00,0x49,0xdf,0xff,0xc9,0x30,0x00,
+0x00,0x01,0x0f,0x06,0x11,0x90,0xc0,0x05,0x00,0x38,0x04,0xf1,0x03,0x00,0x9f,0xff,
+0xc4,0x00,0x15,0xdf,0xff,0x50,0x2f,0xff,0xa0,0x00,0x00,0x00,0xcf,0xfa,0x07,0x22,
+0x03,0x23,0x03,0x61,0x66,0x08,0x00,0x84,0x01,0x30,0xfe,0xee,0xee,0x14,0x01,0x00,
+0xb3,0x05,0x00,0x45,0x03,0x05,0xcb,0x01,0x12,0xdf,0x22,0x00,0x00,0x5a,0x02,0x00,
+0x07,0x00,0x00,0x69,0x01,0x10,0x50,0xd1,0x01,0x30,0xd6,0x01,0xff,0xdf,0x01,0xb0,
+0x2e,0xff,0xd0,0x08,0xff,0xfe,0x51,0x01,0x6e,0xff,0xf4,0x98,0x00,0x11,0xff,0xb0,
+0x02,0x10,0x09,0x08,0x00,0x10,0xf7,0x62,0x00,0x40,0x9c,0xff,0xfc,0x82,0x27,0x03,
+0x3f,0x45,0xff,0xf4,0x05,0x00,0x15,0xd2,0x8f,0xd0,0x00,0xff,0x68,0xfd,0x00,0x0f,
+0xf6,0x6c,0xa0,0x00,0xcc,0x6d,0x08,0x7f,0x5f,0xff,0x40,0x00,0x05,0xff,0xf4,0x09,
+0x00,0x37,0x00,0xa2,0x02,0x01,0x07,0x00,0x00,0x30,0x08,0x12,0xfa,0x09,0x00,0x31,
+0xff,0xff,0xff,0x08,0x00,0x52,0x05,0xff,0xee,0xff,0x50,0x3c,0x06,0x12,0xa9,0xc4,
+0x05,0x52,0x0f,0xff,0x54,0xff,0xf1,0x88,0x00,0x31,0x00,0xff,0xf6,0x14,0x03,0x10,
+0xfb,0x46,0x02,0x00,0xac,0x03,0x50,0xf5,0x00,0x5f,0xff,0x10,0x2c,0x03,0x50,0xf1,
+0x00,0x0f,0xff,0x60,0xde,0x02,0x30,0xb0,0x00,0x0a,0x26,0x03,0x11,0x1f,0x0d,0x01,
+0x10,0xf2,0xea,0x02,0x03,0x0e,0x01,0xb1,0xcf,0xff,0xdd,0xdd,0xdd,0xef,0xfd,0x00,
+0x02,0xff,0xf7,0x01,0x03,0x10,0x20,0x95,0x04,0x00,0x29,0x00,0x10,0x80,0x37,0x07,
+0x00,0x62,0x01,0x20,0xd0,0x3f,0x43,0x00,0x00,0x49,0x07,0x11,0x5f,0x35,0x00,0x00,
+0x41,0x08,0x03,0xc2,0x01,0x74,0x5f,0xff,0xee,0xee,0xee,0xee,0xe8,0xbf,0x00,0x02,
+0xcc,0x00,0x02,0xaf,0x00,0x0c,0x11,0x00,0x00,0xcb,0x01,0x52,0xed,0xc8,0x20,0x00,
+0x5f,0x3c,0x00,0x23,0x70,0x05,0x9f,0x08,0x11,0x40,0x22,0x00,0x32,0x3a,0xff,0xfc,
+0x33,0x00,0x32,0x0d,0xff,0xf0,0x33,0x00,0x22,0x9f,0xff,0x11,0x00,0x13,0x0c,0x11,
+0x00,0x10,0x19,0x00,0x05,0x30,0xff,0xee,0xee,0x60,0x07,0x02,0x44,0x00,0x31,0xfe,
+0x40,0x05,0x07,0x00,0x22,0xc8,0x10,0x55,0x00,0x23,0xda,0x40,0x5d,0x00,0x00,0xf5,
+0x04,0x61,0xdc,0xcc,0xde,0xff,0xff,0x70,0x3a,0x00,0x31,0x5f,0xff,0xd0,0x08,0x00,
+0x33,0x0c,0xff,0xe0,0x08,0x00,0x13,0xc0,0x18,0x00,0x10,0x60,0x28,0x00,0x33,0xce,
+0xff,0xf9,0x38,0x00,0x23,0x70,0x00,0x59,0x00,0x10,0x50,0x20,0x00,0x42,0x01,0x3b,
+0xff,0xf4,0x8b,0x00,0x22,0xef,0xfb,0x08,0x00,0x22,0xbf,0xfe,0x08,0x00,0x20,0xdf,
+0xfd,0x08,0x00,0x00,0x52,0x03,0x00,0x40,0x00,0x24,0xcd,0xff,0x19,0x01,0x21,0xff,
+0x50,0x08,0x00,0x23,0xec,0x81,0x48,0x00,0x21,0xb5,0xff,0x48,0x06,0x02,0x25,0x01,
+0x36,0x95,0xff,0xf4,0x10,0x01,0x1f,0x05,0x0d,0x00,0x41,0x03,0xe2,0x02,0x12,0xf1,
+0xa1,0x05,0x02,0x09,0x00,0x14,0x0d,0x09,0x00,0x41,0x0f,0xff,0x61,0x17,0x09,0x00,
+0x30,0x2f,0xff,0x30,0x17,0x02,0x00,0x6c,0x02,0x12,0x10,0x09,0x00,0x32,0x6f,0xff,
+0x00,0x09,0x00,0x23,0x9f,0xfc,0x09,0x00,0x23,0xcf,0xfa,0x09,0x00,0x21,0xff,0xf7,
+0x09,0x00,0x00,0xee,0x08,0x02,0x09,0x00,0x00,0xb7,0x05,0x01,0x09,0x00,0x00,0xef,
+0x07,0x01,0x09,0x00,0x31,0x4f,0xff,0x60,0x09,0x00,0xa3,0x11,0xbf,0xff,0x21,0x11,
+0x16,0xff,0xf2,0x10,0xcf,0xd9,0x01,0x2e,0xf5,0xcf,0x09,0x00,0x02,0xa8,0x00,0x1f,
+0xbf,0x09,0x00,0x12,0x03,0x54,0x01,0x12,0x35,0x07,0x00,0x12,0xf3,0x46,0x01,0x48,
 0xee,0x25,0xff,0xf4,0x58,0x02,0x1c,0x05,0x0f,0x00,0x10,0xfe,0x25,0x00,0x22,0x60,
 0x5f,0xde,0x02,0x13,0x05,0x6c,0x02,0x0e,0x2d,0x00,0x0f,0x3c,0x00,0x07,0x37,0xea,
-0x5f,0xff,0xbd,0x01,0x20,0xff,0xfb,0xcc,0x23,0x00,0x23,0x01,0x01,0xd7,0x0f,0x10,
-0xaf,0xf8,0x0f,0x12,0xff,0x8e,0x17,0x11,0x1e,0xf6,0x06,0x01,0xf4,0x0e,0x00,0x67,
-0x1f,0x00,0x0c,0x00,0x12,0x09,0x3e,0x01,0x10,0xfc,0x0c,0x00,0x01,0xb9,0x1b,0x00,
-0x06,0x00,0x23,0x6f,0xff,0x16,0x24,0x10,0x09,0x91,0x1d,0x01,0x5b,0x16,0x01,0x53,
-0x0e,0x33,0xcf,0xff,0xbf,0x98,0x20,0x12,0xdf,0xbb,0x1d,0x01,0x86,0x12,0x00,0x75,
-0x27,0x13,0xfd,0x5a,0x24,0x00,0x5f,0x18,0x00,0x0d,0x24,0x02,0x1a,0x11,0x22,0x6f,
-0xff,0x83,0x11,0x11,0x01,0x03,0x17,0x00,0x3c,0x27,0x01,0xb9,0x17,0x00,0x0c,0x00,
-0x01,0x4f,0x15,0x14,0x2f,0x90,0x00,0x10,0xfc,0x2b,0x07,0x04,0xa8,0x00,0x22,0x50,
-0x04,0x9f,0x1b,0x10,0x00,0x95,0x14,0x12,0x0c,0x6b,0x1b,0x11,0x00,0x23,0x15,0x00,
-0x26,0x1d,0x13,0x94,0x02,0x17,0x10,0xfa,0x07,0x00,0x41,0xfd,0xdf,0xff,0xf8,0x13,
-0x07,0x30,0x2e,0xff,0xe0,0xfc,0x03,0x00,0xc2,0x10,0x20,0x03,0x63,0xf4,0x01,0x01,
-0x72,0x07,0x02,0x8b,0x20,0x22,0x0a,0xef,0x13,0x15,0x12,0xbf,0x73,0x04,0x12,0x0b,
-0x28,0x2c,0x62,0x00,0x00,0x15,0xef,0xfe,0x00,0x15,0x21,0x40,0xf5,0x05,0xbf,0x10,
-0x70,0x02,0x10,0x74,0x56,0x00,0x10,0x03,0x87,0x27,0x82,0xfa,0x10,0x03,0xdf,0xff,
-0x20,0x3f,0xff,0xff,0x05,0x12,0x4e,0x3b,0x04,0x60,0x00,0x17,0xce,0xff,0xd9,0x30,
-0x30,0x07,0x00,0x6d,0x04,0x11,0xf4,0x08,0x00,0x12,0x8f,0x08,0x00,0x22,0x01,0xff,
-0x08,0x00,0x12,0x0a,0x08,0x00,0x00,0x18,0x27,0x11,0xf4,0x58,0x07,0x40,0xf7,0xdf,
-0xf4,0x5f,0x2e,0x09,0x11,0xe0,0x10,0x00,0x31,0x0c,0xff,0x60,0x08,0x00,0x31,0x4f,
-0xfd,0x00,0x08,0x00,0x21,0xdf,0xf5,0x08,0x00,0x00,0xda,0x08,0x00,0x08,0x00,0x30,
-0x0e,0xff,0x40,0x08,0x00,0x41,0xfc,0x7f,0xfb,0x00,0x10,0x00,0x21,0xef,0xf2,0x08,
-0x00,0x01,0x7c,0x00,0x01,0x08,0x00,0x12,0x20,0x08,0x00,0x22,0xf9,0x00,0x08,0x00,
-0x11,0xf1,0x08,0x00,0xa0,0x00,0x07,0x86,0x00,0x00,0x58,0x70,0x00,0x00,0x0c,0x4b,
-0x01,0x10,0xe0,0x53,0x0e,0x20,0xa1,0x18,0x06,0x10,0x00,0xaa,0x0a,0x20,0xfd,0x10,
-0x08,0x01,0x37,0xac,0xca,0x60,0x0b,0x24,0x0f,0xc0,0x00,0x7c,0x11,0x5f,0x4a,0x19,
-0x00,0x25,0x1c,0x01,0x25,0x07,0x10,0x5f,0x48,0x1d,0x00,0x5e,0x1c,0x10,0xf4,0xb0,
-0x02,0x00,0x0f,0x00,0x30,0x09,0xff,0xe1,0xfa,0x02,0x00,0xd7,0x02,0x00,0x0f,0x00,
-0x21,0xdf,0xfc,0x1c,0x15,0x01,0x5f,0x22,0x12,0x5f,0x86,0x02,0x01,0x36,0x03,0x10,
-0x10,0x0f,0x00,0x12,0xa5,0x89,0x28,0x02,0x8a,0x20,0x10,0x5f,0xe1,0x1b,0x10,0xd0,
-0x36,0x03,0x00,0x94,0x19,0x00,0x5a,0x00,0x00,0x39,0x0a,0x00,0x0f,0x00,0x21,0x01,
-0xff,0x69,0x00,0x00,0xca,0x27,0x00,0x78,0x00,0x00,0xd0,0x0e,0x03,0xd5,0x02,0x00,
-0x16,0x0e,0x02,0x08,0x00,0x12,0x01,0x08,0x00,0x00,0x3c,0x09,0x42,0x11,0x11,0xaf,
-0xfe,0x41,0x28,0x22,0x9f,0xfe,0x46,0x27,0x22,0x9f,0xfe,0x0e,0x14,0x22,0x9f,0xfe,
-0x3d,0x13,0x20,0x9f,0xfe,0x06,0x1a,0x01,0x08,0x00,0x01,0x70,0x14,0x22,0x9f,0xfe,
-0x16,0x2a,0x22,0x9f,0xfe,0x03,0x03,0x22,0x9f,0xfe,0x28,0x22,0x51,0x9f,0xfe,0x01,
-0xff,0xfb,0x08,0x00,0x31,0x4c,0xff,0xf7,0x08,0x00,0x33,0xef,0xff,0xf1,0x08,0x00,
-0x11,0x80,0x08,0x00,0x22,0xdf,0xd6,0xa1,0x23,0x10,0x5f,0x50,0x07,0x00,0x0b,0x08,
-0x10,0x25,0xce,0x23,0x00,0x8e,0x00,0x21,0xf2,0x5f,0x63,0x0a,0x10,0x6f,0x13,0x00,
-0x00,0x64,0x03,0x10,0x0b,0x13,0x00,0x10,0xfc,0x38,0x2d,0xf0,0x0a,0xff,0xbf,0xff,
-0x25,0xff,0xda,0xff,0x20,0x00,0x4f,0xf7,0xff,0xf2,0x5f,0xfd,0x5f,0xf7,0x00,0x09,
-0xff,0x4f,0xff,0x25,0xff,0xd1,0x99,0x01,0xf0,0x05,0xe0,0xff,0xf2,0x5f,0xfe,0x0c,
-0xff,0x10,0x3f,0xfa,0x0f,0xff,0x25,0xff,0xe0,0x7f,0xf6,0x07,0xff,0x50,0x13,0x00,
-0x51,0x03,0xff,0xa0,0xcf,0xf0,0x13,0x00,0x50,0x0e,0xfe,0x1f,0xfb,0x00,0x13,0x00,
-0x51,0x00,0x9f,0xf8,0xff,0x60,0x13,0x00,0x10,0x04,0x84,0x05,0x01,0x13,0x00,0x41,
-0x0e,0xff,0xfc,0x00,0x13,0x00,0x00,0x49,0x17,0x01,0x13,0x00,0x00,0xa2,0x2b,0x03,
-0x13,0x00,0x10,0x0f,0x3f,0x11,0x10,0xf2,0x8f,0x04,0x00,0x38,0x03,0x0f,0x08,0x00,
-0x1f,0x02,0x04,0x16,0x0e,0x08,0x00,0x6f,0x51,0x11,0x11,0x14,0xff,0xf6,0x58,0x00,
-0x25,0x06,0x1d,0x25,0x11,0x08,0x72,0x1b,0x13,0x20,0x2e,0x1b,0x20,0xff,0xe3,0xf4,
-0x14,0x91,0x61,0x00,0x4c,0xff,0xfd,0x00,0x1f,0xff,0xe2,0xb5,0x08,0x42,0x80,0x7f,
-0xff,0x50,0xc1,0x16,0x23,0xbf,0xff,0xf3,0x04,0x23,0xef,0xfc,0xc7,0x1c,0x01,0xd2,
-0x08,0x00,0xf0,0x15,0x01,0x7c,0x26,0x00,0x75,0x02,0x14,0xdf,0x1b,0x00,0x00,0xaf,
-0x04,0x01,0xcd,0x04,0x01,0x80,0x0b,0x00,0xc4,0x1c,0x11,0x1f,0x27,0x05,0x11,0xaf,
-0x2d,0x1d,0x54,0x71,0x00,0x3b,0xff,0xfb,0x34,0x25,0x11,0xd1,0xde,0x30,0x03,0x82,
-0x25,0x11,0x28,0x43,0x04,0x04,0x53,0x08,0x1e,0xf4,0x08,0x00,0x01,0xfa,0x00,0x13,
-0xf4,0xca,0x00,0x0f,0x08,0x00,0x57,0x00,0xea,0x02,0x13,0xc7,0x26,0x09,0x91,0xfe,
-0x20,0x5f,0xff,0xfe,0xee,0xff,0xff,0xfe,0x1b,0x03,0x13,0x3c,0x58,0x01,0x51,0x1f,
-0xff,0xb5,0xff,0xf4,0xc8,0x0a,0x12,0x5f,0x00,0x1f,0x00,0x0f,0x00,0x00,0x52,0x26,
-0x01,0xc0,0x03,0x14,0xdf,0xf6,0x06,0x22,0xa0,0x5f,0x07,0x00,0x01,0x9c,0x06,0x3f,
-0xca,0x40,0x00,0xc9,0x06,0x14,0x13,0xf4,0x9d,0x04,0x21,0x39,0xdf,0x20,0x01,0x02,
-0x3b,0x01,0x14,0xb1,0x69,0x06,0xd1,0xc0,0x00,0x9f,0xff,0xd5,0x10,0x15,0xdf,0xff,
-0x80,0x2f,0xff,0xd1,0xd9,0x04,0x11,0x07,0x32,0x00,0x43,0x02,0xa6,0x10,0xbf,0x92,
-0x10,0x02,0xfb,0x09,0x06,0x3d,0x2c,0x02,0x8f,0x03,0x1e,0x00,0x79,0x0b,0x31,0x10,
-0x00,0x7f,0x1d,0x0a,0x30,0x2f,0xb5,0x01,0x90,0x2d,0x00,0x68,0x25,0x03,0x15,0x02,
-0x13,0xf9,0x8e,0x2d,0x13,0xfc,0x38,0x02,0x01,0xf9,0x31,0x44,0x8c,0xef,0xfd,0x93,
-0x3f,0x02,0x23,0xff,0xfb,0x17,0x08,0x30,0xae,0xee,0xee,0xd9,0x09,0x14,0xe0,0xfa,
-0x17,0x03,0x8b,0x0a,0x0f,0x0f,0x00,0x4e,0x00,0x76,0x02,0x00,0x8a,0x24,0x00,0x39,
-0x07,0x00,0x02,0x14,0x00,0xf9,0x0a,0x00,0x75,0x07,0x21,0x00,0xef,0x3e,0x2f,0x21,
-0x20,0x00,0xc3,0x20,0x11,0xfa,0x31,0x0a,0x00,0x9f,0x1b,0x00,0xdc,0x06,0x02,0x32,
-0x2c,0x22,0xaf,0xfe,0x33,0x2c,0x42,0x1f,0xff,0xdf,0xfd,0x77,0x14,0x03,0x48,0x28,
-0x13,0xef,0xc6,0x26,0x12,0x5f,0x01,0x1f,0x00,0xa9,0x04,0x06,0x77,0x00,0x33,0x01,
-0xb6,0x7e,0x37,0x19,0x02,0x39,0x1f,0x11,0x0b,0x21,0x14,0x00,0x6a,0x23,0x15,0xfd,
-0xa0,0x28,0x00,0x3e,0x10,0x03,0x01,0x00,0x04,0x9b,0x28,0x20,0x4a,0xdf,0x3b,0x1f,
-0x13,0x70,0x57,0x25,0x00,0xe4,0x30,0x00,0xc9,0x01,0xe0,0xfb,0xaf,0xff,0xcb,0xef,
-0xff,0xf3,0x00,0x7f,0xff,0xb1,0x00,0xff,0xf5,0x8a,0x14,0x11,0x0d,0xed,0x0b,0x10,
-0x50,0xc4,0x1b,0x20,0xff,0xfa,0x3f,0x00,0x00,0x63,0x03,0x30,0x1f,0xff,0x80,0x15,
-0x00,0x00,0x88,0x08,0x01,0x2e,0x11,0x10,0xf5,0x1d,0x06,0x00,0x2b,0x17,0x00,0x15,
-0x00,0x01,0xb5,0x23,0x10,0x40,0x15,0x00,0x10,0x0e,0x5b,0x2b,0x50,0xfe,0x61,0x0f,
-0xff,0x50,0x49,0x05,0x03,0xb0,0x20,0x00,0x9e,0x00,0x11,0x04,0x7a,0x0d,0x02,0xf3,
-0x07,0x6f,0x47,0x9a,0xff,0xfc,0xa8,0x61,0xa8,0x00,0x04,0x10,0x1e,0xfa,0x00,0x11,
-0x02,0x7b,0x0b,0x11,0x60,0x5b,0x01,0x00,0x29,0x2e,0x00,0x0d,0x00,0x00,0x59,0x28,
-0x10,0x00,0x72,0x00,0x00,0x25,0x09,0x02,0xfe,0x08,0x52,0x0c,0xff,0xd2,0xff,0xf9,
-0x87,0x01,0x03,0xd5,0x1a,0x23,0x7f,0xff,0x50,0x00,0x04,0x60,0x1d,0x04,0x11,0x00,
-0x13,0x1f,0x56,0x1c,0x52,0x0b,0xff,0xe5,0xff,0xf8,0x36,0x04,0x00,0xf4,0x15,0x01,
-0xe6,0x08,0x11,0x1f,0x23,0x06,0x20,0xff,0x20,0xaa,0x1f,0x00,0x93,0x06,0x00,0xdb,
-0x1d,0x00,0x41,0x26,0x00,0xa9,0x01,0x12,0xf8,0x56,0x2e,0x13,0x0a,0x4f,0x05,0x00,
-0x00,0x0d,0x0f,0x09,0x00,0x63,0x00,0x83,0x04,0x53,0x1c,0xff,0xb1,0x10,0x5f,0x54,
-0x01,0x1e,0xf1,0x09,0x00,0x04,0x48,0x01,0x0f,0x09,0x00,0x12,0x21,0xaf,0xfd,0x0e,
-0x01,0x31,0xea,0xff,0xd0,0x91,0x0c,0x0f,0x0f,0x00,0x12,0x32,0xe8,0xff,0xf1,0xbe,
-0x0c,0x00,0x3b,0x08,0x71,0x4d,0xff,0xe0,0xff,0xff,0xfd,0xce,0x91,0x04,0x02,0x54,
-0x18,0x53,0x03,0xad,0xff,0xdb,0x83,0xfa,0x03,0x13,0x0b,0x80,0x01,0x0f,0x0f,0x00,
-0x0d,0x00,0x1f,0x03,0x12,0x03,0xae,0x21,0x33,0x75,0xff,0xf2,0x21,0x2f,0x2f,0xff,
-0xf7,0x17,0x00,0x79,0x30,0x31,0x11,0x14,0xf9,0x28,0x45,0x1f,0xff,0x75,0xff,0x01,
-0x00,0x26,0xf7,0x5f,0x0c,0x00,0x0a,0x17,0x00,0x00,0x2a,0x20,0x02,0x82,0x08,0x12,
-0x05,0x1f,0x0f,0x00,0x90,0x06,0x2f,0xe0,0x00,0x19,0x00,0x85,0xa4,0x31,0x11,0x17,
-0xff,0xf1,0x11,0x11,0x9f,0xfe,0x11,0x48,0x0f,0x08,0xfa,0x06,0x01,0x01,0x00,0x18,
-0x45,0x19,0x00,0x06,0xb1,0x0a,0x15,0x0c,0x49,0x24,0x00,0xfb,0x05,0x0f,0x19,0x00,
-0x14,0x0f,0xd7,0x0f,0x08,0x0f,0xf9,0x0f,0x6d,0x12,0x40,0xba,0x2e,0x13,0x92,0x72,
-0x00,0x01,0x22,0x00,0x02,0x9e,0x0a,0x04,0x30,0x24,0x00,0x0c,0x00,0x71,0x2f,0xff,
-0xf8,0x10,0x05,0xef,0xff,0xd9,0x0f,0x01,0xb0,0x20,0x12,0x2f,0x15,0x10,0x01,0xfc,
-0x13,0x10,0x08,0x5e,0x0e,0x12,0x40,0xfb,0x22,0x13,0x03,0x24,0x02,0x01,0xd5,0x04,
-0x03,0xde,0x2f,0x12,0xf4,0x32,0x2f,0x06,0x0c,0x00,0x00,0xf9,0x0f,0x22,0x51,0x14,
-0x02,0x0d,0x02,0xb3,0x07,0x24,0xff,0xf9,0x3c,0x00,0x12,0x40,0xcb,0x2a,0x12,0x08,
-0x7a,0x04,0x01,0x6e,0x27,0x03,0x6c,0x00,0x30,0x0e,0xff,0xf9,0x84,0x00,0x01,0xf8,
-0x00,0x13,0x03,0x57,0x05,0x01,0xb4,0x00,0x14,0x3e,0x7d,0x10,0x11,0x40,0x59,0x2d,
-0x00,0x9c,0x12,0x00,0xf2,0x18,0x01,0x25,0x01,0x32,0x03,0xef,0xff,0x82,0x33,0x11,
-0xef,0x04,0x01,0x00,0x1c,0x1a,0x11,0xc3,0x62,0x2e,0x13,0x0a,0xc5,0x0f,0x32,0x40,
-0xbf,0xff,0x73,0x2e,0x32,0x09,0xff,0xf2,0x11,0x00,0x31,0x4f,0xff,0xc2,0x11,0x00,
-0x20,0x00,0xaf,0x33,0x00,0x13,0xef,0x8b,0x34,0x12,0xff,0xff,0x2c,0x02,0x9c,0x34,
-0x31,0x0a,0xff,0xf3,0x22,0x00,0x20,0x04,0xff,0x41,0x38,0x00,0xb4,0x00,0x21,0xff,
-0x10,0x11,0x00,0x00,0x81,0x09,0x00,0x11,0x00,0x01,0x62,0x23,0x01,0x66,0x00,0x11,
-0xf5,0x55,0x00,0x32,0x44,0xff,0xfc,0x66,0x00,0x01,0xc5,0x38,0x12,0x10,0xd4,0x07,
-0x20,0xfe,0x20,0x63,0x25,0x10,0x56,0x2f,0x07,0x23,0x7c,0xcc,0x32,0x33,0x00,0x81,
-0x03,0x10,0x30,0xb9,0x23,0x00,0x5d,0x19,0x13,0x03,0x02,0x39,0x30,0xdf,0xfe,0x30,
-0x41,0x07,0x00,0x76,0x07,0x10,0x4f,0xd6,0x32,0x10,0xf5,0x73,0x01,0x00,0x94,0x06,
-0x01,0xec,0x29,0x70,0xff,0xfe,0x66,0xde,0xcf,0xfb,0x50,0xd7,0x09,0x93,0x47,0xff,
-0xff,0x10,0x06,0xdf,0xea,0x20,0x0a,0x6f,0x08,0x10,0x25,0x72,0x3a,0x70,0x7a,0xdf,
-0xff,0xc0,0x00,0x03,0xcf,0xba,0x08,0x00,0xaf,0x0b,0x71,0xfe,0xca,0x60,0x03,0xff,
-0xfb,0x73,0x82,0x37,0x11,0x20,0x71,0x00,0x90,0xf1,0x02,0x56,0x63,0x00,0x00,0x7f,
-0x90,0xaf,0xb5,0x30,0x21,0xaf,0x5b,0x74,0x00,0x81,0xcf,0x9f,0xe4,0x01,0x6f,0xff,
-0xc0,0xdf,0x76,0x28,0x10,0xf1,0x0e,0x24,0x11,0x04,0x71,0x0a,0x00,0x3e,0x34,0x12,
-0xcf,0x07,0x00,0x21,0x9f,0xfd,0xd3,0x07,0x01,0x10,0x0f,0x00,0xb3,0x21,0x10,0x80,
-0x3d,0x06,0x50,0x08,0xff,0xfb,0x78,0xdf,0xa1,0x18,0x12,0xff,0xe4,0x16,0x10,0xae,
-0x42,0x09,0x10,0x4f,0xc8,0x08,0x12,0x92,0x48,0x34,0x00,0x60,0x01,0x80,0x63,0x34,
-0x8f,0xff,0xd0,0x4f,0xff,0x30,0xb6,0x0c,0x01,0x07,0x00,0x00,0x0e,0x00,0x51,0x53,
-0x33,0x7f,0xff,0x50,0x23,0x00,0x12,0xa3,0x2a,0x00,0x20,0xfc,0x30,0x1c,0x00,0x60,
-0x3b,0xff,0xe1,0x4f,0xff,0x30,0xa3,0x04,0x01,0x07,0x00,0x00,0x21,0x24,0x62,0x53,
-0x34,0x6d,0xff,0xf1,0x4f,0x0e,0x03,0x21,0x4f,0xff,0x35,0x2e,0x00,0x07,0x00,0x30,
-0xb4,0xff,0xff,0x7b,0x18,0x30,0x86,0x66,0x44,0x26,0x07,0x11,0x4f,0xcb,0x39,0x0f,
-0x09,0x00,0x14,0x02,0xe3,0x09,0x12,0xfa,0xa6,0x0e,0x01,0x08,0x00,0x30,0xef,0xf9,
-0x66,0xbc,0x09,0x00,0xd7,0x15,0x11,0xdf,0x88,0x0f,0x31,0xf0,0x00,0xdf,0xa9,0x10,
-0x11,0xd0,0x08,0x00,0x10,0x09,0x92,0x30,0x12,0xfa,0x1b,0x31,0x22,0xdf,0xfa,0x03,
-0x35,0x22,0xdf,0xfa,0x1d,0x10,0x02,0x94,0x17,0x01,0x08,0x00,0x93,0x57,0xff,0xfa,
-0x66,0x66,0xef,0xfc,0x62,0xdf,0x4c,0x0c,0x05,0x08,0x00,0x11,0xf2,0xde,0x08,0x0f,
-0x08,0x00,0x0e,0x00,0x19,0x1f,0x34,0xd9,0x10,0x00,0x6c,0x1b,0x90,0xdf,0xfc,0x55,
-0xaf,0xfe,0x10,0x06,0xff,0xe1,0x71,0x36,0x11,0x0b,0x9e,0x38,0x22,0xc0,0x0e,0x85,
-0x06,0x01,0x0a,0x31,0x00,0xc7,0x1b,0x53,0xa3,0x33,0x33,0x33,0x30,0x55,0x35,0x01,
-0x0b,0x1f,0x31,0x10,0x00,0x06,0x55,0x1d,0x63,0x90,0x00,0xdf,0xff,0x86,0xaf,0xb9,
-0x1b,0x11,0xf5,0xa6,0x20,0x21,0xd9,0x20,0x88,0x17,0x20,0xaf,0xf6,0x07,0x00,0xc0,
-0x4f,0xff,0x10,0x0a,0xff,0x60,0x04,0xff,0xe1,0x00,0xbf,0xf8,0x13,0x00,0xb0,0xcf,
-0xf7,0x00,0x03,0xff,0xf1,0x0a,0xff,0x60,0x4f,0xfe,0x09,0x08,0x20,0x80,0xaf,0x4f,
-0x19,0x00,0x03,0x03,0x54,0x4a,0xff,0x68,0xff,0xc0,0xe6,0x32,0x12,0xf3,0x17,0x0e,
-0x04,0xfa,0x0e,0x60,0xd0,0xaf,0xf6,0x2f,0xff,0x10,0x0a,0x37,0x30,0x0a,0xff,0x60,
-0x64,0x18,0xa0,0x6f,0xfe,0x00,0xaf,0xf6,0x03,0xff,0xf2,0x00,0x0e,0xd1,0x1b,0x40,
-0x60,0x0c,0xff,0xa0,0xed,0x12,0x20,0xaf,0xf6,0x9d,0x05,0x01,0x8b,0x37,0x40,0x60,
-0x00,0xef,0xfa,0xc3,0x09,0x12,0xa2,0x0d,0x31,0x50,0x50,0x0a,0xff,0xc5,0x5c,0xf0,
-0x25,0x21,0x10,0x02,0x90,0x03,0x01,0xa0,0x17,0x40,0x24,0x7e,0xff,0x70,0x70,0x00,
-0x11,0xc4,0x76,0x00,0x01,0x31,0x11,0x50,0x3b,0xff,0xf2,0x00,0x23,0xa9,0x06,0x40,
-0x2f,0xfe,0x10,0x01,0xe5,0x36,0x21,0xd7,0x7d,0xe5,0x03,0x00,0x22,0x11,0x30,0x18,
-0xcf,0xfe,0x12,0x02,0x00,0xac,0x00,0x50,0xa4,0xff,0xf0,0x00,0x0a,0xe4,0x37,0x00,
-0x4c,0x03,0x11,0xa4,0x2f,0x26,0x00,0x0d,0x00,0x20,0x4f,0xfd,0x0d,0x00,0x60,0x0d,
-0xfe,0x8f,0xfa,0x4f,0xfe,0x21,0x26,0xe0,0xa4,0xff,0xe0,0xef,0xe0,0x8f,0xfa,0x4f,
-0xfc,0x7f,0xf5,0x08,0xff,0xa4,0x96,0x0a,0x10,0x8f,0x18,0x38,0x10,0x40,0x0d,0x00,
-0x21,0xff,0xb0,0x0d,0x00,0x20,0xf3,0x00,0x0d,0x00,0x01,0x4b,0x38,0xf1,0x0a,0x01,
-0x88,0x40,0x00,0x07,0x85,0x00,0x1f,0xfb,0x00,0x02,0xff,0xa0,0x00,0xcf,0xf3,0x00,
-0xaf,0xf5,0x00,0x03,0xff,0xfd,0xef,0xfc,0xae,0x38,0x14,0xd7,0xf8,0x05,0x0f,0x82,
-0x00,0x48,0x10,0x4f,0x17,0x34,0xf0,0x0f,0xf2,0x4f,0xff,0x20,0x0a,0xff,0xa0,0x4f,
-0xff,0x20,0x1f,0xff,0x20,0x4f,0xff,0x20,0x9f,0xf9,0x00,0x4f,0xff,0x21,0xff,0xf2,
-0x00,0x4f,0xff,0x3c,0xff,0x80,0x13,0x03,0x11,0xfd,0xbc,0x37,0x00,0x8a,0x0f,0x81,
-0xff,0x49,0xff,0xa0,0x00,0x4f,0xff,0x22,0x1e,0x00,0x30,0x20,0xaf,0xfa,0x06,0x00,
-0x40,0x2f,0xff,0x30,0x4f,0xca,0x39,0x41,0xb0,0x4f,0xff,0x20,0x02,0x08,0x12,0xff,
-0xd9,0x1d,0x12,0x2f,0xe3,0x16,0x50,0x04,0xff,0xe6,0x66,0x9f,0xc6,0x0b,0x11,0xfc,
-0x3d,0x07,0x11,0x08,0xaf,0x16,0x10,0x20,0xf0,0x18,0x00,0x0f,0x00,0x31,0x0d,0xff,
-0x50,0x0f,0x00,0x21,0xff,0xf3,0x0f,0x00,0x21,0x2f,0xff,0xf3,0x0b,0x10,0x05,0xe1,
-0x10,0x00,0xc9,0x1f,0x10,0xf9,0x0f,0x00,0x10,0x23,0x3a,0x26,0x00,0x41,0x3b,0x02,
-0xc4,0x29,0x10,0x2c,0x58,0x05,0x10,0x05,0xb7,0x00,0x11,0xf6,0x42,0x24,0x11,0x4f,
-0x63,0x1b,0x00,0x08,0x00,0x10,0xff,0x9b,0x07,0xf0,0x0f,0xfc,0x4f,0xfc,0xff,0x50,
-0x00,0xcf,0xcf,0xfc,0x4f,0xfb,0xdf,0xa0,0x01,0xff,0x9f,0xfc,0x4f,0xfb,0x8f,0xe0,
-0x05,0xff,0x5f,0xfc,0x4f,0xfc,0x4f,0xf4,0x0a,0x06,0x00,0x50,0xfc,0x0e,0xf8,0x0e,
-0xf8,0x08,0x00,0x40,0x0a,0xfd,0x3f,0xf3,0x08,0x00,0x40,0x05,0xff,0x7f,0xe0,0x08,
-0x00,0x40,0x01,0xff,0xdf,0xa0,0x08,0x00,0x41,0x00,0xbf,0xff,0x50,0x08,0x00,0x30,
-0x7f,0xff,0x10,0x08,0x00,0x00,0x5b,0x3d,0x20,0x4f,0xfc,0xe6,0x03,0x50,0x1f,0xff,
-0x54,0xff,0xf3,0xd9,0x17,0x0f,0x0d,0x00,0x02,0x52,0xf8,0x77,0x77,0xff,0xf5,0x51,
-0x04,0x12,0x54,0x6a,0x15,0x0f,0x34,0x00,0x0f,0x01,0x0d,0x00,0x01,0x4e,0x2c,0x13,
-0x81,0x9b,0x19,0x10,0xf4,0xb8,0x0b,0x40,0xb7,0x9f,0xff,0xf2,0x3d,0x27,0x41,0x00,
-0x2f,0xff,0xa0,0xa7,0x1e,0x20,0x9f,0xff,0x10,0x0d,0x00,0xfd,0x1e,0x00,0x0d,0x23,
-0x00,0xa5,0x06,0x21,0xff,0xf9,0xe7,0x07,0x01,0x81,0x14,0x51,0x6f,0xff,0x20,0xaf,
-0xfe,0xcc,0x25,0x00,0x5d,0x29,0x11,0x03,0xf6,0x0d,0x20,0xfa,0x79,0x84,0x19,0x10,
-0x1c,0x21,0x06,0x10,0x30,0x29,0x1e,0x00,0x50,0x22,0x0b,0x9d,0x00,0x3e,0x86,0x66,
-0x7f,0x9d,0x00,0x0f,0x0d,0x00,0x24,0x50,0x5f,0xff,0x02,0xae,0xfd,0x59,0x06,0x01,
-0x7d,0x38,0x50,0x4f,0xff,0xee,0x88,0xef,0x88,0x05,0x30,0xe1,0x00,0x2f,0x4e,0x39,
-0x12,0x80,0xa4,0x05,0x00,0x0e,0x08,0x00,0x70,0x02,0x00,0x78,0x12,0x05,0x07,0x00,
-0x03,0x15,0x00,0x02,0x23,0x00,0x00,0x31,0x00,0x00,0x4b,0x02,0x30,0xed,0x78,0xef,
-0xe3,0x05,0x30,0x6f,0xff,0xff,0x8f,0x02,0x62,0x23,0xbe,0xfd,0x60,0x00,0x4f,0xea,
-0x40,0x0f,0x07,0x00,0x09,0x00,0x8a,0x34,0x22,0xea,0x30,0xdf,0x39,0x10,0xf6,0x86,
-0x05,0x20,0x98,0xcf,0x08,0x2f,0x10,0xf5,0x3c,0x0e,0x00,0xc6,0x04,0x33,0x04,0x99,
-0x90,0xd4,0x04,0x03,0x53,0x24,0x03,0x07,0x00,0x05,0xe9,0x04,0x62,0xe0,0x00,0x05,
-0xdd,0xd0,0x06,0x31,0x00,0x40,0x00,0xdf,0xff,0x97,0xf4,0x2a,0x13,0x2d,0xed,0x1a,
-0x10,0x7c,0xe9,0x04,0x11,0x4f,0x31,0x08,0x02,0x06,0x00,0x80,0x26,0x66,0xcf,0xfe,
-0x66,0x63,0x00,0x00,0xc2,0x06,0x0f,0x06,0x00,0x29,0x21,0x9f,0xff,0xc1,0x08,0x11,
-0x3f,0x34,0x14,0x10,0xf3,0xbc,0x1f,0x60,0x09,0xff,0xd0,0x07,0xff,0xe0,0x24,0x3f,
-0x11,0x01,0x50,0x2d,0x10,0x20,0x0b,0x03,0x12,0x7f,0xbc,0x1c,0x20,0xcf,0xf6,0xb0,
-0x00,0x12,0x31,0x07,0x18,0x30,0x85,0xff,0xa0,0x45,0x07,0x13,0xd9,0x19,0x19,0x01,
-0x20,0x0c,0x02,0x8c,0x14,0x00,0x37,0x2a,0x02,0xa9,0x1a,0x01,0x0c,0x0f,0x00,0x99,
-0x21,0x04,0x53,0x2c,0x42,0x07,0xad,0xff,0xf8,0xf9,0x0e,0x11,0xc0,0xf0,0x11,0x14,
-0xe8,0x6b,0x04,0x24,0x24,0x42,0x0a,0x00,0x2f,0xaf,0xf8,0x0a,0x00,0x1a,0xa0,0x6d,
-0xfe,0x90,0xaf,0xf8,0x09,0xef,0xd5,0x00,0x07,0xc1,0x20,0xf0,0x01,0xf8,0xcf,0xff,
-0xff,0x60,0x2f,0xff,0xe8,0x8f,0xef,0xfe,0xe8,0x8f,0xff,0xf1,0x8f,0xf9,0x14,0x00,
-0x04,0x00,0x20,0xf6,0xcf,0x7d,0x22,0x01,0x9d,0x24,0x22,0xef,0xfa,0x3c,0x1e,0x43,
-0xcf,0xfc,0xff,0xf9,0x09,0x1d,0x16,0xfd,0x0a,0x00,0x04,0x1e,0x00,0x42,0xdf,0xfc,
-0xcf,0xfd,0x1f,0x39,0x30,0xff,0xf9,0x8f,0x31,0x19,0x00,0x04,0x00,0x14,0xf5,0x5a,
-0x00,0x00,0xb9,0x23,0x50,0xff,0xfb,0xaf,0xf8,0xdf,0xa5,0x0e,0x8f,0x7d,0xfd,0x80,
-0xaf,0xf8,0x19,0xef,0xc4,0xbe,0x00,0x1f,0x00,0x3b,0x19,0x00,0x22,0x13,0x00,0x92,
-0x15,0x10,0x3f,0xc9,0x1f,0x11,0xfa,0x77,0x07,0x32,0x3f,0xff,0x46,0x63,0x01,0x11,
-0xdf,0x03,0x0f,0x12,0xdf,0xeb,0x12,0x12,0x3f,0x5e,0x09,0x11,0x7f,0x90,0x09,0x10,
-0x02,0x4f,0x42,0x00,0xb8,0x06,0x10,0xac,0x84,0x03,0x70,0x7f,0xfe,0x12,0xff,0xf5,
-0x00,0x02,0xd2,0x3e,0x50,0xfe,0x10,0x0c,0xff,0xc0,0x1b,0x18,0x11,0x7f,0xc9,0x2b,
-0x12,0xf6,0x29,0x03,0x23,0x50,0x04,0xee,0x03,0x0f,0x0f,0x00,0x32,0x53,0xf8,0x66,
-0x67,0xff,0xf9,0xfe,0x44,0x24,0xff,0x24,0xb9,0x38,0x02,0x36,0x12,0x12,0x20,0x24,
-0x12,0x0f,0x0f,0x00,0x05,0x01,0x17,0x25,0x1f,0xfc,0x06,0x00,0x06,0x10,0xf8,0x06,
-0x00,0x71,0xdf,0xfe,0x30,0x15,0xdf,0xfc,0xaf,0x41,0x09,0xb1,0x1e,0xff,0xff,0xfe,
-0xef,0xfc,0x01,0x8a,0x97,0x30,0xaf,0x77,0x12,0x0f,0x06,0x00,0x01,0x21,0x4f,0xff,
-0xdd,0x08,0x50,0x2f,0xff,0x04,0xff,0xf0,0x56,0x1f,0x3f,0x02,0xff,0xf0,0x13,0x00,
-0x44,0x60,0xf6,0x66,0x8f,0xff,0x66,0x67,0x13,0x00,0x03,0x01,0x00,0x14,0x04,0x09,
-0x00,0x06,0x26,0x00,0x1f,0x10,0x0a,0x00,0x53,0x85,0x66,0x68,0xff,0xf6,0x66,0x7f,
-0xff,0x75,0x8b,0x00,0x16,0xfd,0x0a,0x00,0x04,0x64,0x02,0x1f,0x2f,0x0a,0x00,0x16,
-0x12,0x4f,0x7e,0x2c,0x0f,0x07,0x00,0x0b,0x33,0x53,0x32,0x20,0xc7,0x05,0x13,0xc6,
-0xce,0x05,0x10,0x80,0x1c,0x00,0x32,0x3c,0xff,0xf1,0x86,0x0a,0x00,0xdf,0x0a,0x00,
-0x17,0x06,0x00,0xdf,0x0a,0x34,0x7e,0xff,0xe0,0x2c,0x0b,0x00,0x92,0x00,0x00,0x3a,
-0x0b,0x01,0x14,0x0c,0x01,0xc7,0x04,0x00,0xac,0x1f,0x01,0x6c,0x31,0x00,0xb6,0x2d,
-0x60,0xfe,0x88,0xef,0xff,0x30,0x4f,0xf0,0x22,0x30,0xe1,0x00,0x1e,0xb0,0x05,0x20,
-0x30,0x2f,0x26,0x47,0x00,0x55,0x00,0x24,0x87,0x9f,0x51,0x00,0x01,0xd6,0x07,0x01,
-0x3a,0x0b,0x06,0x0a,0x00,0x24,0x30,0x5f,0x1e,0x00,0x03,0x32,0x00,0x11,0xf0,0x46,
-0x00,0x51,0xe0,0x00,0x1e,0xff,0xb0,0x64,0x0c,0x30,0xfd,0x78,0xef,0x56,0x08,0x11,
-0x30,0x12,0x0e,0x14,0xf4,0x82,0x00,0x21,0xd8,0x10,0xab,0x05,0x00,0x27,0x01,0x12,
-0x1d,0x2e,0x01,0x61,0xaf,0xff,0x94,0x33,0xaf,0xfd,0xe4,0x06,0x20,0x9f,0xfd,0xfc,
-0x0a,0x00,0x07,0x00,0x30,0x9f,0xff,0x50,0x07,0x00,0x12,0x2e,0x23,0x00,0x22,0x01,
-0x9f,0x58,0x01,0x51,0x9f,0xfd,0x22,0xaf,0xfd,0x6d,0x10,0x21,0x9f,0xfd,0xde,0x11,
-0x21,0x9f,0xfd,0x90,0x18,0x50,0x9f,0xfd,0x01,0xff,0xf9,0x1f,0x00,0x11,0x0b,0xcd,
-0x18,0x18,0xfd,0x0d,0x06,0x16,0xf7,0x0d,0x06,0x11,0xf3,0x0d,0x06,0x00,0xcc,0x0c,
-0x61,0x88,0x70,0x0e,0xff,0xc6,0x66,0xd3,0x38,0x01,0x0b,0x14,0x14,0x0f,0xde,0x20,
-0x14,0xb0,0xf6,0x0a,0x39,0x05,0xee,0xe0,0x0d,0x06,0x1c,0x30,0x0d,0x06,0x62,0x24,
-0xff,0xf2,0x2a,0xaa,0x10,0x52,0x17,0x11,0xf2,0x0f,0x00,0x0f,0x05,0x00,0x08,0xf5,
-0x00,0x20,0x7f,0xf2,0x02,0xff,0x77,0xff,0x20,0x2f,0xf7,0x5c,0xc1,0x02,0xcc,0x60,
-0xa7,0x0d,0x01,0xd6,0x14,0x0f,0x09,0x00,0x23,0x08,0x01,0x00,0x2f,0xf4,0x00,0x01,
-0x00,0x29,0x04,0x60,0x3f,0x17,0xe9,0x14,0x00,0x70,0xf6,0xf4,0x00,0xfc,0xee,0x00,
-0xee,0xeb,0x04,0x0f,0x58,0x00,0x26,0x4f,0x04,0x07,0x00,0x04,0x3c,0x00,0x25,0x2f,
-0xc8,0x00,0x01,0x00,0x3b,0x1f,0xd0,0x44,0x00,0x30,0x03,0x20,0x01,0xb1,0xf0,0x00,
-0xfc,0x00,0x00,0xe9,0xfd,0xf1,0xf8,0x00,0xe3,0x10,0x00,0x8f,0xf7,0xfe,0x00,0x00,
-0xfd,0xfe,0xf6,0xfa,0x2a,0x01,0x24,0x6f,0xfb,0x00,0xfb,0x00,0x00,0xf5,0x96,0x00,
-0x27,0x15,0xfb,0x0a,0x00,0x03,0x2a,0x18,0x19,0xfe,0x1f,0x00,0x1f,0xfd,0x4c,0x00,
-0x19,0x00,0x0f,0x08,0x10,0xfc,0xbc,0x0e,0x6f,0x00,0xfc,0x00,0xfc,0xf8,0xfc,0x34,
-0x01,0x30,0x05,0x01,0x02,0x21,0xfc,0xfc,0x5a,0x00,0x2f,0xfd,0xfb,0x56,0x00,0x1d,
-0x20,0xca,0x00,0x7f,0x51,0x15,0xd7,0x4a,0x00,0x62,0xf9,0xfc,0x00,0x00,0xfc,0xfb,
-0x04,0x00,0x0f,0x90,0x00,0x23,0x10,0xfa,0x2a,0x12,0x1f,0xfb,0xda,0x00,0x2d,0x1f,
-0xfc,0x99,0x02,0x33,0x16,0xe0,0xb9,0x01,0x04,0xcf,0x01,0x10,0xfb,0x5e,0x00,0x2f,
-0xf8,0xf4,0x2e,0x03,0x20,0xa7,0x04,0xf4,0x00,0x00,0xd8,0xfb,0xd8,0xee,0x00,0xca,
-0x01,0x02,0x2f,0xe8,0xf6,0x93,0x00,0x1c,0x72,0xb1,0x00,0x00,0x00,0xdd,0x00,0xdc,
-0x08,0x04,0x51,0x00,0xf9,0x00,0xfe,0xfd,0x47,0x02,0x3f,0x03,0x00,0x03,0xe5,0x00,
-0x25,0x6f,0xfa,0x00,0xfb,0xfc,0x00,0xf9,0x2f,0x01,0x31,0x10,0xf6,0x78,0x01,0x1f,
-0xf7,0x3d,0x00,0x24,0x01,0x53,0x01,0xb1,0xce,0xcb,0x00,0x00,0xe9,0xfb,0xd6,0xfd,
-0x03,0x00,0x03,0xd2,0x00,0xdf,0xdf,0xef,0x00,0xef,0xd7,0xf3,0xf1,0x00,0xf3,0xf0,
-0xf7,0xf1,0xf4,0x4a,0x02,0x1a,0x56,0xd6,0xe1,0x00,0x00,0xf1,0x60,0x03,0xa0,0x03,
-0xf7,0xf7,0x00,0x00,0xf7,0xfa,0x00,0x00,0xfb,0x82,0x03,0x0f,0xfa,0x04,0x18,0x61,
-0x03,0x00,0xe4,0xf4,0x00,0x00,0xfc,0x14,0x03,0x24,0x43,0x63,0xfa,0xfa,0x00,0x00,
-0xfa,0xfc,0x64,0x02,0x0f,0x76,0x01,0x1b,0x14,0xe2,0x13,0x04,0x15,0x03,0x50,0x02,
-0x10,0xfc,0x50,0x02,0x1f,0xfa,0xb1,0x01,0x1b,0xf0,0x0a,0x04,0xf6,0xd3,0xe2,0x00,
-0x00,0xe3,0xfa,0xed,0xfd,0x03,0xed,0x04,0x03,0x03,0x04,0x00,0x04,0xf4,0xf3,0xfc,
-0xf8,0xf3,0xf8,0xf5,0x17,0x04,0x2f,0xfc,0xfa,0xd8,0x05,0x1e,0x09,0x70,0x03,0x13,
-0xfc,0x94,0x00,0x2f,0xfb,0xfb,0x7a,0x03,0x25,0x0f,0x7d,0x03,0x2a,0x0e,0x13,0x05,
-0x0f,0x30,0x05,0x25,0x0f,0x55,0x01,0x0a,0x3f,0xfe,0x00,0xfd,0x4d,0x00,0x17,0x0a,
-0xb5,0x05,0x0f,0xde,0x00,0x73,0x1e,0x03,0xc5,0x02,0x17,0x04,0x6f,0x06,0x0f,0xe4,
-0x02,0x18,0x1f,0xf0,0xce,0x07,0x3c,0x0f,0x8b,0x05,0x31,0x1f,0xef,0x28,0x01,0x0b,
-0x1f,0xfc,0x2b,0x01,0x17,0x00,0x6a,0x03,0x1c,0xde,0x1a,0x02,0x20,0xfc,0x04,0xf1,
-0x04,0x4f,0x0a,0x00,0x04,0x03,0xe1,0x00,0x30,0x0f,0xbd,0x03,0x1b,0x04,0x94,0x00,
-0x1c,0xdf,0xd5,0x00,0x2f,0xfd,0x03,0x01,0x02,0x1b,0x09,0x18,0x08,0x0f,0xbc,0x01,
-0x47,0x1f,0xf8,0xf9,0x02,0x36,0x0e,0xde,0x00,0x0f,0x56,0x04,0x57,0x0f,0x01,0x00,
-0x10,0xfa,0x00,0x0f,0x00,0x00,0x05,0x00,0xfb,0xfb,0xf6,0xec,0xf1,0xf6,0x00,0xe2,
-0x00,0x05,0xfe,0x04,0x0f,0x0d,0x05,0x19,0x50,0xf1,0x00,0xf6,0xfb,0xf6,0x34,0x00,
-0x5e,0xf6,0xf6,0xfb,0xf6,0xf1,0xe0,0x07,0x0f,0x4b,0x00,0x17,0xde,0xec,0xfb,0xf1,
-0xfb,0xf6,0x00,0xf6,0x00,0xf1,0xf1,0xf1,0xf6,0xf1,0x4a,0x00,0x00,0x8e,0x08,0x1f,
-0xf1,0x4a,0x00,0x13,0x20,0xe7,0xf6,0x9e,0x07,0x14,0xfb,0x7c,0x00,0x10,0xfb,0x55,
-0x00,0x10,0xec,0x62,0x00,0x60,0xf1,0xf6,0xec,0x00,0xf1,0x00,0x03,0x00,0x00,0x66,
-0x00,0x0f,0x4d,0x00,0x13,0x13,0x05,0x07,0x00,0x05,0x4f,0x00,0x35,0x05,0x00,0x0a,
-0x18,0x00,0x1f,0x05,0x74,0x01,0x19,0x11,0x05,0x8b,0x00,0x20,0x0a,0x0a,0x0a,0x00,
-0x1f,0x05,0x23,0x01,0x22,0x05,0x7a,0x08,0x00,0xde,0x00,0x01,0x25,0x01,0x2f,0xf1,
-0xf6,0x08,0x02,0x2d,0x00,0x81,0x00,0x55,0x0a,0x0a,0xfb,0x00,0x0a,0xea,0x00,0x0f,
-0x97,0x00,0x25,0x06,0x01,0x00,0x1f,0x0a,0xa8,0x02,0x36,0x1e,0x05,0x4e,0x02,0x0f,
-0x99,0x00,0x15,0x20,0xf6,0xfb,0xf9,0x01,0x02,0x30,0x01,0x12,0xf1,0x35,0x00,0x1f,
-0xf6,0xd8,0x00,0x23,0x70,0xdd,0xe7,0xfb,0xfb,0xe7,0xfb,0xfb,0x52,0x00,0x10,0xfb,
-0xf0,0x02,0x03,0x63,0x02,0x05,0x52,0x00,0x0f,0x30,0x01,0x16,0x00,0x3c,0x00,0x11,
-0xfb,0x30,0x03,0x20,0xf6,0xfb,0xbb,0x01,0x12,0x05,0xfe,0x26,0x09,0x71,0x0b,0x1f,
-0xfb,0xe4,0x02,0x15,0x11,0x0a,0x08,0x02,0x00,0x83,0x03,0x00,0x7e,0x03,0x00,0x06,
-0x00,0xd0,0xec,0x00,0x00,0xf1,0xe7,0xec,0x00,0xe7,0xfb,0xf1,0xe7,0x00,0xf1,0xf4,
-0x00,0x2f,0xfb,0xf6,0xa7,0x09,0x11,0x00,0x37,0x00,0x05,0x4a,0x00,0x10,0xf6,0x58,
-0x02,0xc2,0xe7,0xe7,0xfb,0xec,0xf1,0xe7,0xec,0xf1,0xe7,0xf1,0xf1,0xe7,0xe5,0x00,
-0x2f,0xf1,0xec,0xde,0x00,0x11,0x01,0x4a,0x00,0x01,0x5d,0x03,0x00,0xe8,0x00,0x07,
-0xb0,0x02,0x0f,0x4d,0x0e,0x23,0x14,0xf6,0xad,0x03,0x0e,0x03,0x02,0x0f,0xf0,0x02,
-0x2a,0x0b,0xe9,0x02,0x0f,0x9a,0x02,0x32,0x0f,0xc0,0x03,0x1a,0xef,0xfb,0xf1,0xf6,
-0xf1,0xf6,0xfb,0x00,0xf6,0xd8,0x00,0x00,0xec,0xe2,0xf1,0x84,0x0c,0x29,0x11,0xf6,
-0x24,0x01,0x01,0x6d,0x01,0x23,0xf1,0xfb,0x6d,0x01,0x1e,0x05,0x72,0x01,0x0f,0xe5,
-0x00,0x32,0x1f,0xf6,0x2b,0x0d,0x28,0x01,0x3e,0x03,0x04,0x64,0x10,0x2f,0xf6,0xf6,
-0xc2,0x01,0x22,0x23,0xfb,0xfb,0x05,0x00,0x21,0xfb,0xfb,0x1e,0x02,0x10,0xfb,0x45,
-0x03,0x0f,0x0c,0x02,0x26,0x13,0xf1,0xd3,0x00,0x03,0xe6,0x0e,0x0f,0x28,0x01,0x33,
-0x1f,0xfb,0x17,0x02,0x28,0x05,0xd9,0x02,0x12,0xfb,0xed,0x00,0x09,0x43,0x03,0x0f,
-0x8d,0x00,0x1e,0x03,0x8a,0x00,0x04,0x6a,0x01,0x1f,0xf6,0x93,0x00,0x23,0x16,0xf6,
-0x8a,0x00,0x01,0x54,0x07,0x02,0x72,0x01,0x0f,0x2a,0x01,0x2c,0x1e,0xfb,0xea,0x04,
-0x0f,0x28,0x01,0x1d,0x1a,0xfb,0x31,0x05,0x0f,0xde,0x00,0x24,0x19,0xfb,0x78,0x01,
-0x1e,0xfb,0xf8,0x08,0x0f,0x3d,0x13,0x1c,0x05,0xe4,0x02,0x1f,0xf6,0xe4,0x02,0x26,
-0x0b,0x2e,0x03,0x01,0xeb,0x02,0x0f,0x4a,0x00,0x23,0x0b,0xd4,0x09,0x05,0xcf,0x01,
-0x0f,0xde,0x00,0x25,0x07,0xb9,0x01,0x1f,0x0a,0xe3,0x02,0x29,0x32,0xf6,0xfb,0x05,
-0x2b,0x01,0x7f,0x00,0xfb,0xf6,0x05,0x00,0xfb,0x05,0xce,0x05,0x24,0x02,0x07,0x04,
-0x02,0x52,0x07,0x03,0xcc,0x01,0x0f,0x72,0x01,0x24,0x01,0x46,0x00,0x05,0x26,0x03,
-0x01,0x95,0x07,0x0f,0x78,0x03,0x28,0x0f,0x40,0x09,0x32,0x0f,0x1e,0x0a,0x2a,0x0f,
-0xcb,0x08,0x0b,0x03,0x04,0x00,0x0f,0x72,0x01,0x24,0x02,0x78,0x05,0x04,0x4c,0x02,
-0x21,0xf6,0xf1,0x8d,0x46,0x02,0x6e,0x16,0x21,0x02,0x03,0x87,0x0f,0x1e,0x04,0x01,
-0x05,0x02,0xc3,0x61,0x20,0x00,0x0c,0xc5,0x61,0x30,0x0c,0x0c,0x09,0x1e,0x63,0x22,
-0x13,0x0d,0xca,0x61,0x01,0x7c,0x55,0x00,0xcf,0x61,0x40,0x1d,0x1e,0x00,0x1f,0xcc,
-0x61,0xf3,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,
-0x27,0x28,0x42,0x00,0xf6,0x2b,0x29,0x2a,0x2b,0x2c,0x2d,0x00,0x2e,0x2f,0x00,0x00,
-0x30,0x31,0x32,0x00,0x33,0x00,0x34,0x35,0x36,0x37,0x38,0x39,0x3a,0x00,0x00,0x3b,
-0x3c,0x3d,0x00,0x3e,0x3f,0x40,0x41,0x42,0x43,0x44,0x45,0x00,0x00,0x46,0x47,0x48,
-0x00,0x49,0x00,0x4a,0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x00,0x00,0x51,0x52,0x53,0x00,
-0xa1,0x00,0x20,0x03,0x02,0x9c,0x00,0x4c,0x06,0x07,0x06,0x08,0x7c,0x58,0x60,0x00,
-0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0x24,0x0b,0x00,0x6f,
-0x62,0x30,0x00,0x00,0x15,0xcb,0x4b,0x61,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,
-0xf2,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,
-0x00,0x00,0x23,0xb4,0x1e,0x00,0xa0,0x26,0x30,0x00,0x26,0x27,0x88,0x30,0xc0,0x29,
-0x00,0x2a,0x2b,0x00,0x2c,0x2d,0x2e,0x2f,0x30,0x00,0x31,0x1c,0x00,0x23,0x32,0x33,
-0xaf,0x00,0x54,0x35,0x36,0x3b,0x3c,0x3d,0xae,0x00,0xb0,0x46,0x36,0x47,0x36,0x40,
-0x48,0x49,0x4a,0x00,0x00,0x00,
+0x5f,0xff,0xbd,0x01,0x50,0xff,0xfb,0x03,0xff,0xf6,0x23,0x01,0x00,0x37,0x02,0x71,
+0xd0,0x00,0xaf,0xfe,0x10,0x00,0x6f,0xd7,0x06,0x31,0x40,0x00,0x1e,0xf6,0x06,0x00,
+0xd5,0x0a,0x00,0x69,0x03,0x10,0xf3,0x0c,0x00,0x12,0x09,0x3e,0x01,0x10,0xfc,0x0c,
+0x00,0x10,0x3f,0xe2,0x07,0x00,0x06,0x00,0x20,0x6f,0xff,0xf6,0x06,0x01,0x9e,0x01,
+0x41,0xf2,0x6f,0xff,0x08,0x68,0x06,0x00,0x36,0x07,0x31,0xcf,0xff,0xbf,0x23,0x00,
+0x04,0x10,0x05,0x21,0x80,0x00,0xde,0x06,0x62,0xfc,0xff,0xff,0xfd,0xff,0xf1,0xc4,
+0x06,0x51,0x90,0x6f,0xff,0x00,0xef,0xe9,0x06,0x50,0x8f,0xff,0x10,0x6f,0xff,0x9e,
+0x03,0x00,0xde,0x03,0x10,0xf9,0x60,0x00,0x00,0x1c,0x0a,0x00,0x71,0x00,0x00,0x0c,
+0x00,0x10,0x07,0x55,0x00,0x14,0x2f,0x90,0x00,0x10,0xfc,0x2b,0x07,0x04,0xa8,0x00,
+0x20,0x50,0x04,0xfb,0x04,0x11,0x6f,0x6a,0x06,0x10,0xd0,0x56,0x08,0x01,0x0c,0x00,
+0x10,0x06,0xed,0x03,0x52,0x4a,0xef,0xfd,0x94,0x00,0xc4,0x09,0x10,0xfa,0x07,0x00,
+0x41,0xfd,0xdf,0xff,0xf8,0x13,0x07,0x31,0x2e,0xff,0xe0,0xfc,0x03,0x50,0x7f,0xff,
+0x00,0x03,0x63,0xf4,0x01,0x12,0xe0,0x9b,0x00,0x10,0xf7,0x7f,0x04,0x32,0xef,0xff,
+0xf8,0x8d,0x07,0x22,0xf6,0x00,0x69,0x02,0x20,0xfd,0x30,0x09,0x00,0x22,0x15,0xef,
+0xcd,0x0a,0x60,0x03,0xff,0xf5,0x05,0xbf,0x10,0x70,0x02,0x30,0x74,0xff,0xfa,0x0f,
+0x00,0xb2,0xf6,0x0c,0xff,0xfa,0x10,0x03,0xdf,0xff,0x20,0x3f,0xff,0xff,0x05,0x12,
+0x4e,0x3b,0x04,0x60,0x00,0x17,0xce,0xff,0xd9,0x30,0x30,0x07,0x00,0x6d,0x04,0x11,
+0xf4,0x08,0x00,0x12,0x8f,0x08,0x00,0x22,0x01,0xff,0x08,0x00,0x13,0x0a,0x08,0x00,
+0x41,0x2f,0xfe,0xef,0xf4,0x58,0x07,0x40,0xf7,0xdf,0xf4,0x5f,0x2e,0x09,0x11,0xe0,
+0x10,0x00,0x31,0x0c,0xff,0x60,0x08,0x00,0x31,0x4f,0xfd,0x00,0x08,0x00,0x21,0xdf,
+0xf5,0x08,0x00,0x00,0xda,0x08,0x00,0x08,0x00,0x30,0x0e,0xff,0x40,0x08,0x00,0x41,
+0xfc,0x7f,0xfb,0x00,0x10,0x00,0x21,0xef,0xf2,0x08,0x00,0x01,0x7c,0x00,0x01,0x08,
+0x00,0x12,0x20,0x08,0x00,0x22,0xf9,0x00,0x08,0x00,0x11,0xf1,0x08,0x00,0xa0,0x00,
+0x07,0x86,0x00,0x00,0x58,0x70,0x00,0x00,0x0c,0x4b,0x01,0x10,0xe0,0x53,0x0e,0x20,
+0xa1,0x18,0xb5,0x06,0x00,0xaa,0x0a,0x20,0xfd,0x10,0x08,0x01,0x45,0xac,0xca,0x60,
+0x00,0x01,0x00,0x0f,0xc0,0x00,0x78,0x50,0x00,0x00,0x00,0xef,0xf4,0xf0,0x00,0x5f,
+0xff,0x40,0x00,0x04,0xff,0xf6,0x05,0xff,0xf4,0x00,0x00,0xdf,0xfc,0x00,0x0f,0x00,
+0x30,0x6f,0xff,0x30,0x0f,0x00,0x30,0x1e,0xff,0x90,0x0f,0x00,0xb0,0x09,0xff,0xe1,
+0x00,0x05,0xff,0xf4,0x03,0xff,0xf6,0x00,0x0f,0x00,0xa0,0xdf,0xfc,0x00,0x00,0x05,
+0xff,0xf5,0xbf,0xff,0x20,0x0f,0x00,0x30,0xff,0xff,0x80,0x0f,0x00,0x40,0xff,0xff,
+0xff,0x10,0x0f,0x00,0x40,0xa5,0xef,0xfa,0x00,0x2d,0x00,0x31,0x06,0xff,0xf4,0x2d,
+0x00,0x40,0x0d,0xff,0xd0,0x00,0x4b,0x00,0x31,0x3f,0xff,0x80,0x5a,0x00,0x30,0xaf,
+0xff,0x20,0x0f,0x00,0x22,0x01,0xff,0x69,0x00,0x31,0x07,0xff,0xf5,0x78,0x00,0x60,
+0x0e,0xff,0xe1,0x00,0x00,0xdf,0x46,0x00,0x42,0xfe,0x00,0x00,0xff,0x08,0x00,0x13,
+0x01,0x08,0x00,0xf1,0x04,0x03,0xff,0xf7,0x11,0x11,0xaf,0xfe,0x00,0x05,0xff,0xf3,
+0x00,0x00,0x9f,0xfe,0x00,0x08,0xff,0xf1,0x08,0x00,0x31,0x0a,0xff,0xf0,0x08,0x00,
+0x31,0x0c,0xff,0xd0,0x08,0x00,0x31,0x0f,0xff,0xb0,0x08,0x00,0x31,0x1f,0xff,0x80,
+0x08,0x00,0x31,0x4f,0xff,0x50,0x08,0x00,0x31,0x7f,0xff,0x20,0x08,0x00,0x30,0xbf,
+0xff,0x00,0x08,0x00,0x31,0x01,0xff,0xfb,0x08,0x00,0x31,0x4c,0xff,0xf7,0x08,0x00,
+0x33,0xef,0xff,0xf1,0x08,0x00,0x11,0x80,0x08,0x00,0x31,0xdf,0xd6,0x00,0x08,0x00,
+0xe0,0x5f,0xff,0xfa,0x00,0x00,0x00,0x0c,0xff,0xff,0x25,0xff,0xff,0xf0,0x00,0x8e,
+0x00,0x80,0xf2,0x5f,0xff,0xff,0x40,0x00,0x00,0x6f,0x13,0x00,0x50,0xef,0xf9,0x00,
+0x00,0x0b,0x13,0x00,0xf0,0x27,0xfc,0xef,0xd0,0x00,0x00,0xff,0xbf,0xff,0x25,0xff,
+0xda,0xff,0x20,0x00,0x4f,0xf7,0xff,0xf2,0x5f,0xfd,0x5f,0xf7,0x00,0x09,0xff,0x4f,
+0xff,0x25,0xff,0xd1,0xff,0xc0,0x00,0xef,0xe0,0xff,0xf2,0x5f,0xfe,0x0c,0xff,0x10,
+0x3f,0xfa,0x0f,0xff,0x25,0xff,0xe0,0x7f,0xf6,0x07,0xff,0x50,0x13,0x00,0x51,0x03,
+0xff,0xa0,0xcf,0xf0,0x13,0x00,0x50,0x0e,0xfe,0x1f,0xfb,0x00,0x13,0x00,0x51,0x00,
+0x9f,0xf8,0xff,0x60,0x13,0x00,0x42,0x04,0xff,0xff,0xf1,0x13,0x00,0x41,0x0e,0xff,
+0xfc,0x00,0x13,0x00,0x42,0x00,0xaf,0xff,0x70,0x13,0x00,0x33,0x05,0xff,0xf2,0x13,
+0x00,0x30,0x0f,0xfd,0x00,0x13,0x00,0x00,0x97,0x00,0x3f,0x03,0xff,0xf6,0x08,0x00,
+0x1f,0x01,0x01,0x00,0x1e,0xf6,0x08,0x00,0x6f,0x51,0x11,0x11,0x14,0xff,0xf6,0x58,
+0x00,0x25,0xb0,0x00,0x00,0x28,0xce,0xff,0xda,0x50,0x00,0x00,0x00,0x08,0x50,0x00,
+0x51,0xfc,0x20,0x00,0x00,0xbf,0x5a,0x00,0xf0,0x07,0xe3,0x00,0x07,0xff,0xfe,0x61,
+0x00,0x4c,0xff,0xfd,0x00,0x1f,0xff,0xe2,0x00,0x00,0x00,0xaf,0xff,0x80,0x7f,0xff,
+0x29,0x00,0x31,0x1f,0xff,0xe0,0xa0,0x01,0x60,0x00,0x09,0xff,0xf2,0xef,0xfc,0x09,
+0x00,0x31,0x06,0xff,0xf4,0x82,0x01,0x41,0x00,0x04,0xff,0xf5,0xb3,0x01,0x00,0x75,
+0x02,0x14,0xdf,0x1b,0x00,0x31,0xbf,0xff,0x10,0x2d,0x00,0x41,0xf1,0x7f,0xff,0x70,
+0x3f,0x00,0x41,0xd0,0x1f,0xff,0xf3,0x51,0x00,0x70,0x60,0x06,0xff,0xff,0x71,0x00,
+0x3b,0x33,0x00,0x11,0xaf,0x75,0x00,0x40,0xd1,0x00,0x00,0x07,0x08,0x00,0x00,0x4d,
+0x00,0x00,0x99,0x00,0x43,0xd9,0x30,0x00,0x00,0xea,0x00,0x1e,0xf4,0x08,0x00,0x01,
+0xfa,0x00,0x13,0xf4,0xca,0x00,0x0f,0x08,0x00,0x57,0x00,0xea,0x02,0x32,0xc7,0x00,
+0x05,0xf3,0x02,0x81,0x20,0x5f,0xff,0xfe,0xee,0xff,0xff,0xfe,0x1b,0x03,0x13,0x3c,
+0x58,0x01,0x60,0x1f,0xff,0xb5,0xff,0xf4,0x00,0xa3,0x03,0x01,0x0f,0x00,0x12,0x0e,
+0x0f,0x00,0x31,0x03,0xff,0xf9,0xc0,0x03,0x32,0xdf,0xff,0x35,0xc3,0x00,0x22,0xa0,
+0x5f,0x07,0x00,0x81,0x05,0xff,0xfe,0xee,0xee,0xca,0x40,0x00,0x2d,0x00,0x01,0x93,
+0x03,0x00,0x07,0x00,0x0f,0x0f,0x00,0x0c,0x41,0x00,0x00,0x39,0xdf,0x20,0x01,0x02,
+0x3b,0x01,0x13,0xb1,0x94,0x03,0xc0,0xff,0xc0,0x00,0x9f,0xff,0xd5,0x10,0x15,0xdf,
+0xff,0x80,0x2f,0x4f,0x01,0x41,0x00,0xcf,0xff,0x07,0x32,0x00,0x52,0x02,0xa6,0x10,
+0xbf,0xfe,0x39,0x00,0x32,0x0d,0xff,0xc0,0x09,0x00,0x22,0xef,0xfa,0x08,0x00,0x01,
+0x8f,0x03,0x00,0x01,0x00,0x02,0xb4,0x01,0x00,0x2f,0x03,0x10,0xf0,0x07,0x00,0xe0,
+0x10,0x00,0x7f,0xff,0x60,0x00,0x00,0x00,0x2f,0xb5,0x01,0xff,0xfe,0x20,0x62,0x03,
+0x13,0xf2,0x15,0x02,0x10,0xf9,0x52,0x03,0x00,0x30,0x02,0x03,0x38,0x02,0x10,0xfa,
+0x62,0x00,0x44,0x8c,0xef,0xfd,0x93,0x3f,0x02,0x32,0xff,0xfb,0xff,0x01,0x00,0xb1,
+0xae,0xee,0xee,0xff,0xff,0xee,0xee,0xe0,0x00,0x00,0x2f,0xff,0x01,0x21,0x00,0x02,
+0xcd,0x03,0x0f,0x0f,0x00,0x4e,0x01,0x76,0x02,0x60,0x01,0xff,0xf8,0x2f,0xff,0x90,
+0x55,0x02,0x40,0xf1,0x08,0xff,0xf2,0x8a,0x01,0x40,0x90,0x00,0xef,0xfb,0x4c,0x01,
+0x80,0x20,0x00,0x6f,0xff,0x40,0x00,0xcf,0xfa,0xd5,0x00,0x40,0xc0,0x03,0xff,0xf3,
+0x9f,0x01,0x21,0xf5,0x0a,0x08,0x01,0x51,0xaf,0xfe,0x1f,0xff,0x40,0xa9,0x02,0x41,
+0xdf,0xfd,0x00,0x00,0x92,0x02,0x12,0xf5,0x2f,0x01,0x23,0xff,0xd0,0x8a,0x01,0x00,
+0x15,0x01,0x01,0xa9,0x04,0x06,0x77,0x00,0x62,0x01,0xb6,0x7e,0xff,0xe0,0x00,0x60,
+0x05,0x11,0x60,0x43,0x01,0x02,0x0a,0x03,0x31,0x06,0xce,0xfd,0x9d,0x00,0x02,0x68,
+0x01,0x14,0x50,0x0b,0x00,0x03,0x53,0x00,0x20,0x00,0x4a,0xb6,0x01,0x62,0xeb,0x70,
+0x00,0x00,0x01,0xcf,0x30,0x01,0x10,0xe4,0xc9,0x01,0xb0,0xfb,0xaf,0xff,0xcb,0xef,
+0xff,0xf3,0x00,0x7f,0xff,0xb1,0x2a,0x00,0x61,0x7f,0xff,0xc0,0x0d,0xff,0xf1,0x3f,
+0x00,0x50,0xbf,0xff,0x20,0xff,0xfa,0x3f,0x00,0x00,0x63,0x03,0x00,0x3f,0x05,0x00,
+0x15,0x00,0x50,0x3f,0xff,0x70,0xff,0xf9,0x15,0x00,0x00,0x1d,0x06,0x30,0x0e,0xff,
+0xc0,0x15,0x00,0x00,0xe0,0x00,0x30,0x9f,0xff,0x40,0x15,0x00,0xa0,0x0e,0xff,0xe0,
+0x02,0xff,0xfe,0x61,0x0f,0xff,0x50,0x49,0x05,0x12,0x06,0x99,0x01,0x00,0x9e,0x00,
+0x21,0x04,0xef,0x0a,0x00,0x10,0xf8,0x89,0x00,0x6f,0x47,0x9a,0xff,0xfc,0xa8,0x61,
+0xa8,0x00,0x04,0x30,0x1e,0xff,0xd0,0xe8,0x00,0x12,0xfa,0xfb,0x00,0x00,0x5b,0x01,
+0x31,0xaf,0xff,0x10,0x0d,0x00,0x70,0x01,0xff,0xfa,0x00,0x0e,0xff,0xc0,0xe9,0x03,
+0x41,0xf3,0x08,0xff,0xf3,0x87,0x05,0x32,0xd2,0xff,0xf9,0x87,0x01,0x30,0xef,0xfe,
+0x10,0x09,0x00,0x23,0x7f,0xff,0x50,0x00,0x11,0xff,0x22,0x01,0x06,0x11,0x00,0x11,
+0x1f,0x44,0x06,0x00,0x2c,0x01,0x11,0xe5,0x85,0x00,0x10,0x05,0x83,0x01,0x10,0xf2,
+0x6a,0x01,0x31,0xfc,0x00,0x1f,0x23,0x06,0x40,0xff,0x20,0x00,0x7f,0xe1,0x00,0x00,
+0xf1,0x05,0x60,0xdf,0xfe,0x00,0x0d,0xff,0xe0,0xa9,0x01,0x21,0xf8,0x07,0x97,0x00,
+0x13,0x0a,0x4f,0x05,0x4f,0x0c,0xff,0xb0,0x00,0x09,0x00,0x63,0x00,0x83,0x04,0x53,
+0x1c,0xff,0xb1,0x10,0x5f,0x54,0x01,0x1e,0xf1,0x09,0x00,0x04,0x48,0x01,0x0f,0x09,
+0x00,0x12,0x21,0xaf,0xfd,0x0e,0x01,0x11,0xea,0x69,0x02,0x2f,0xbf,0xfe,0x0f,0x00,
+0x12,0x31,0xe8,0xff,0xf1,0x0f,0x00,0xc1,0x5f,0xff,0xa0,0x00,0x00,0x4d,0xff,0xe0,
+0xff,0xff,0xfd,0xce,0x91,0x04,0x01,0x01,0x00,0x63,0xe0,0x03,0xad,0xff,0xdb,0x83,
+0xfa,0x03,0x13,0x0b,0x80,0x01,0x0f,0x0f,0x00,0x0d,0x30,0x5f,0xff,0x20,0xea,0x04,
+0x00,0x09,0x02,0x10,0x75,0x90,0x01,0x10,0x3f,0xf1,0x00,0x2f,0xff,0xf7,0x17,0x00,
+0x79,0xb5,0x31,0x11,0x14,0xff,0xf5,0x11,0x11,0x1f,0xff,0x75,0xff,0x01,0x00,0x26,
+0xf7,0x5f,0x0c,0x00,0x0a,0x17,0x00,0x32,0x20,0x00,0x07,0x82,0x08,0x00,0x90,0x07,
+0x00,0x80,0x02,0x00,0x90,0x06,0x2f,0xe0,0x00,0x19,0x00,0x85,0xa3,0x31,0x11,0x17,
+0xff,0xf1,0x11,0x11,0x9f,0xfe,0x11,0xc6,0x01,0x09,0xfa,0x06,0x01,0x01,0x00,0x18,
+0x45,0x19,0x00,0x04,0xad,0x03,0x00,0x96,0x02,0x16,0x40,0x0d,0x00,0x1f,0xcf,0x19,
+0x00,0x14,0x03,0x5a,0x06,0x06,0x5b,0x06,0x0f,0x11,0x00,0x18,0x00,0xbb,0x06,0x34,
+0xed,0xc8,0x20,0xa6,0x07,0x14,0x70,0xb1,0x00,0x02,0x55,0x00,0x32,0x3a,0xff,0xfc,
+0x33,0x00,0x32,0x0d,0xff,0xf0,0x33,0x00,0x22,0x9f,0xff,0x11,0x00,0x13,0x0c,0x11,
+0x00,0x60,0x19,0xff,0xfa,0x05,0xff,0xff,0x24,0x06,0x32,0xff,0x30,0x5f,0x53,0x07,
+0x21,0x40,0x05,0x07,0x00,0x22,0xc8,0x10,0x66,0x00,0x53,0x01,0x7b,0xef,0xfd,0x92,
+0x72,0x00,0x01,0x22,0x00,0x02,0x9e,0x0a,0x02,0xc7,0x04,0x11,0xf9,0x0c,0x00,0x80,
+0x2f,0xff,0xf8,0x10,0x05,0xef,0xff,0x50,0x0c,0x00,0x30,0x9f,0xff,0x70,0x7b,0x04,
+0x20,0xd0,0x5f,0xfc,0x04,0x11,0xfd,0xd8,0x08,0x51,0xf3,0x5f,0xff,0x40,0x02,0x61,
+0x04,0x13,0x03,0x24,0x02,0x01,0xd5,0x04,0x00,0x8f,0x07,0x04,0x3e,0x01,0x27,0xff,
+0xfb,0x0c,0x00,0x73,0xfa,0x5f,0xff,0x51,0x14,0xff,0xf6,0x24,0x00,0x00,0x48,0x00,
+0x14,0xf9,0x3c,0x00,0x10,0x40,0x86,0x04,0x00,0x54,0x00,0x12,0xf2,0x7c,0x0b,0x15,
+0x80,0x6c,0x00,0x30,0x0e,0xff,0xf9,0x84,0x00,0x01,0xf8,0x00,0x13,0x03,0x57,0x05,
+0x01,0xb4,0x00,0x11,0x3e,0x18,0x01,0x03,0x32,0x01,0x40,0x6b,0xef,0xfc,0x82,0x2d,
+0x06,0x21,0x7c,0xef,0x25,0x01,0x22,0x03,0xef,0xc1,0x01,0x22,0x01,0xef,0x04,0x01,
+0x40,0x40,0x7f,0xff,0xc3,0x46,0x09,0x21,0xf4,0x0a,0xd5,0x03,0x30,0x4f,0xff,0x40,
+0x6a,0x09,0x00,0x11,0x00,0x32,0x09,0xff,0xf2,0x11,0x00,0x31,0x4f,0xff,0xc2,0x11,
+0x00,0x20,0x00,0xaf,0x33,0x00,0x54,0xef,0xff,0x40,0x00,0x8f,0x05,0x02,0x12,0x2f,
+0x7a,0x01,0x41,0x00,0x0a,0xff,0xf3,0x22,0x00,0x10,0x04,0xb8,0x00,0x10,0x4f,0xb4,
+0x00,0x21,0xff,0x10,0x11,0x00,0x00,0x81,0x09,0x00,0x11,0x00,0x33,0x1f,0xff,0xd0,
+0x66,0x00,0x11,0xf5,0x55,0x00,0x10,0x44,0xc8,0x07,0x02,0x33,0x00,0x42,0xae,0xff,
+0xd8,0x10,0xd4,0x07,0x10,0xfe,0x7a,0x03,0x20,0xfb,0x56,0x2f,0x07,0x43,0x7c,0xcc,
+0x00,0x05,0xa6,0x04,0xa3,0x3f,0xff,0x30,0x00,0x02,0x9d,0xff,0xff,0xff,0xf3,0xe6,
+0x00,0x50,0x30,0x00,0xdf,0xfe,0x30,0x41,0x07,0x00,0x76,0x07,0x60,0x4f,0xff,0x30,
+0x03,0xff,0xf5,0x73,0x01,0x00,0x94,0x06,0x20,0x01,0xef,0x3c,0x01,0x60,0xfe,0x66,
+0xde,0xcf,0xfb,0x50,0xd7,0x09,0x93,0x47,0xff,0xff,0x10,0x06,0xdf,0xea,0x20,0x0a,
+0x6f,0x08,0xc0,0x25,0x50,0x00,0x00,0x02,0x7a,0xdf,0xff,0xc0,0x00,0x03,0xcf,0xba,
+0x08,0x00,0xaf,0x0b,0x70,0xfe,0xca,0x60,0x03,0xff,0xfb,0x73,0x22,0x02,0x21,0xfd,
+0x20,0x71,0x00,0xf1,0x00,0xf1,0x02,0x56,0x63,0x00,0x00,0x7f,0x90,0xaf,0xff,0xff,
+0xd4,0x00,0xaf,0x5b,0x74,0x00,0xa0,0xcf,0x9f,0xe4,0x01,0x6f,0xff,0xc0,0xdf,0xff,
+0x40,0x58,0x0a,0x21,0xdf,0xff,0x7a,0x0a,0x20,0xdf,0xfc,0xa4,0x06,0x22,0xf6,0xcf,
+0x07,0x00,0x21,0x9f,0xfd,0xd3,0x07,0x21,0x6f,0xff,0x9b,0x06,0x30,0x1f,0xff,0x80,
+0x3d,0x06,0x92,0x08,0xff,0xfb,0x78,0xdf,0xff,0x60,0x00,0xaf,0xf6,0x06,0x20,0x04,
+0xae,0x42,0x09,0x10,0x4f,0xc8,0x08,0x11,0x92,0x07,0x00,0x10,0xff,0x60,0x01,0x80,
+0x63,0x34,0x8f,0xff,0xd0,0x4f,0xff,0x30,0xb6,0x0c,0x01,0x07,0x00,0x00,0x0e,0x00,
+0x51,0x53,0x33,0x7f,0xff,0x50,0x23,0x00,0x12,0xa3,0x2a,0x00,0x20,0xfc,0x30,0x1c,
+0x00,0x60,0x3b,0xff,0xe1,0x4f,0xff,0x30,0xa3,0x04,0x02,0x07,0x00,0x92,0xf5,0x4f,
+0xff,0x53,0x34,0x6d,0xff,0xf1,0x4f,0x0e,0x03,0x00,0x07,0x00,0x21,0xfd,0xa4,0x31,
+0x00,0x10,0xb4,0x73,0x07,0x50,0x4f,0xff,0x86,0x66,0x44,0x26,0x07,0x00,0x2e,0x00,
+0x1f,0x04,0x09,0x00,0x15,0x02,0xe3,0x09,0x11,0xfa,0xcd,0x09,0x02,0x08,0x00,0x50,
+0xef,0xf9,0x66,0xef,0xfa,0xdf,0x08,0x40,0xf2,0x00,0xdf,0xfa,0xe8,0x00,0x11,0xf0,
+0x08,0x00,0x31,0x06,0xff,0xd0,0x08,0x00,0x31,0x09,0xff,0xa0,0x08,0x00,0x31,0x0d,
+0xff,0x70,0x08,0x00,0x00,0xd0,0x08,0x00,0x08,0x00,0x00,0x0d,0x01,0x00,0x08,0x00,
+0x21,0xcf,0xfb,0x08,0x00,0x93,0x57,0xff,0xfa,0x66,0x66,0xef,0xfc,0x62,0xdf,0x4c,
+0x0c,0x05,0x08,0x00,0x11,0xf2,0xde,0x08,0x0f,0x08,0x00,0x0e,0x90,0x00,0x00,0x7c,
+0xff,0xd9,0x10,0x00,0x00,0x2e,0x0f,0x02,0x00,0x3d,0x0a,0xf2,0x04,0x55,0xaf,0xfe,
+0x10,0x06,0xff,0xe1,0x00,0x0b,0xff,0x70,0x0b,0xff,0xb0,0x00,0x05,0xff,0xc0,0x0e,
+0x85,0x06,0x11,0x0f,0x07,0x00,0xb2,0xf0,0x0f,0xff,0xa3,0x33,0x33,0x33,0x30,0x0e,
+0xff,0xa0,0x70,0x06,0x10,0xd0,0x63,0x0a,0xe0,0x06,0xff,0xf5,0x00,0x0a,0xff,0x90,
+0x00,0xdf,0xff,0x86,0xaf,0xff,0x20,0x4d,0x00,0x00,0x96,0x02,0xc0,0x01,0x8d,0xff,
+0xd9,0x20,0x00,0x0c,0xff,0x80,0x00,0xaf,0xf6,0x07,0x00,0xc0,0x4f,0xff,0x10,0x0a,
+0xff,0x60,0x04,0xff,0xe1,0x00,0xbf,0xf8,0x13,0x00,0xb0,0xcf,0xf7,0x00,0x03,0xff,
+0xf1,0x0a,0xff,0x60,0x4f,0xfe,0x09,0x08,0x60,0x80,0xaf,0xf6,0x0d,0xff,0x60,0x03,
+0x03,0x31,0x4a,0xff,0x68,0xdf,0x0a,0x01,0x16,0x03,0x12,0xf3,0x17,0x0e,0x04,0xfa,
+0x0e,0x40,0xd0,0xaf,0xf6,0x2f,0x17,0x0a,0xf0,0x12,0xdf,0xf6,0x0a,0xff,0x60,0xbf,
+0xf9,0x00,0x00,0x6f,0xfe,0x00,0xaf,0xf6,0x03,0xff,0xf2,0x00,0x0e,0xff,0x80,0x0a,
+0xff,0x60,0x0c,0xff,0xa0,0x06,0xff,0xf1,0x00,0xaf,0xf6,0x9d,0x05,0x90,0xef,0xfa,
+0x00,0x0a,0xff,0x60,0x00,0xef,0xfa,0xc3,0x09,0x30,0xa2,0x00,0x01,0x1e,0x01,0xb1,
+0x50,0x0a,0xff,0xc5,0x5c,0xff,0xf0,0x0d,0xff,0x10,0x02,0x90,0x03,0x10,0x04,0xc0,
+0x05,0x40,0x24,0x7e,0xff,0x70,0x70,0x00,0x11,0xc4,0x76,0x00,0x10,0xfd,0x93,0x0b,
+0x50,0x3b,0xff,0xf2,0x00,0x23,0xa9,0x06,0xa2,0x2f,0xfe,0x10,0x01,0xff,0xf8,0x0c,
+0xff,0xd7,0x7d,0xe5,0x03,0x80,0xff,0x90,0x00,0x18,0xcf,0xfe,0xa4,0x00,0xf1,0x03,
+0x4f,0xff,0x00,0x00,0x2f,0xff,0xa4,0xff,0xf0,0x00,0x0a,0xff,0xfa,0x4f,0xff,0x00,
+0x03,0xff,0x0d,0x00,0x11,0xcf,0x0d,0x00,0x20,0x4f,0xfd,0x0d,0x00,0xf0,0x13,0x0d,
+0xfe,0x8f,0xfa,0x4f,0xfe,0x06,0xff,0x78,0xff,0xa4,0xff,0xe0,0xef,0xe0,0x8f,0xfa,
+0x4f,0xfc,0x7f,0xf5,0x08,0xff,0xa4,0xff,0xdf,0xfd,0x00,0x8f,0xfa,0x4f,0xff,0xff,
+0x40,0x0d,0x00,0x21,0xff,0xb0,0x0d,0x00,0x20,0xf3,0x00,0x0d,0x00,0xf3,0x16,0xfa,
+0x00,0x00,0x8f,0xfa,0x01,0x88,0x40,0x00,0x07,0x85,0x00,0x1f,0xfb,0x00,0x02,0xff,
+0xa0,0x00,0xcf,0xf3,0x00,0xaf,0xf5,0x00,0x03,0xff,0xfd,0xef,0xfc,0x00,0x00,0x03,
+0xae,0xff,0xd7,0x00,0x01,0x00,0x0f,0x82,0x00,0x48,0xf0,0x1a,0x4f,0xff,0x20,0x02,
+0xff,0xf2,0x4f,0xff,0x20,0x0a,0xff,0xa0,0x4f,0xff,0x20,0x1f,0xff,0x20,0x4f,0xff,
+0x20,0x9f,0xf9,0x00,0x4f,0xff,0x21,0xff,0xf2,0x00,0x4f,0xff,0x3c,0xff,0x80,0x00,
+0x4f,0xff,0xff,0xfd,0x00,0x06,0x00,0xc1,0xff,0x20,0x00,0x4f,0xff,0x49,0xff,0xa0,
+0x00,0x4f,0xff,0x22,0x1e,0x00,0x30,0x20,0xaf,0xfa,0x06,0x00,0xf1,0x04,0x2f,0xff,
+0x30,0x4f,0xff,0x20,0x0b,0xff,0xb0,0x4f,0xff,0x20,0x03,0xff,0xf4,0x00,0x00,0xff,
+0xff,0x2d,0x00,0x10,0x2f,0x07,0x00,0xf1,0x0c,0xf2,0x00,0x04,0xff,0xe6,0x66,0x9f,
+0xff,0x20,0x00,0x6f,0xfc,0x00,0x05,0xff,0xf2,0x00,0x08,0xff,0xa0,0x00,0x5f,0xff,
+0x20,0x00,0xbf,0xf7,0x0f,0x00,0x31,0x0d,0xff,0x50,0x0f,0x00,0x21,0xff,0xf3,0x0f,
+0x00,0x30,0x2f,0xff,0x00,0x0f,0x00,0x31,0x05,0xff,0xd0,0x0f,0x00,0x20,0xaf,0xf9,
+0x0f,0x00,0x40,0x23,0x7f,0xff,0x40,0x0f,0x00,0x30,0xcf,0xff,0xd0,0x0f,0x00,0x60,
+0x2c,0xff,0xc2,0x00,0x00,0x05,0xb7,0x00,0xc0,0xf6,0x00,0x00,0x0d,0xff,0xfc,0x4f,
+0xff,0xfb,0x00,0x00,0x2f,0x08,0x00,0xf0,0x14,0xff,0x00,0x00,0x7f,0xff,0xfc,0x4f,
+0xfc,0xff,0x50,0x00,0xcf,0xcf,0xfc,0x4f,0xfb,0xdf,0xa0,0x01,0xff,0x9f,0xfc,0x4f,
+0xfb,0x8f,0xe0,0x05,0xff,0x5f,0xfc,0x4f,0xfc,0x4f,0xf4,0x0a,0x06,0x00,0x50,0xfc,
+0x0e,0xf8,0x0e,0xf8,0x08,0x00,0x40,0x0a,0xfd,0x3f,0xf3,0x08,0x00,0x40,0x05,0xff,
+0x7f,0xe0,0x08,0x00,0x40,0x01,0xff,0xdf,0xa0,0x08,0x00,0x41,0x00,0xbf,0xff,0x50,
+0x08,0x00,0x31,0x7f,0xff,0x10,0x08,0x00,0xff,0x03,0x2f,0xfc,0x00,0x4f,0xfc,0x4f,
+0xff,0x30,0x00,0x1f,0xff,0x54,0xff,0xf3,0x00,0x01,0xff,0xf5,0x0d,0x00,0x02,0x30,
+0xf8,0x77,0x77,0x0d,0x00,0x00,0x01,0x00,0x11,0x54,0x06,0x00,0x0f,0x27,0x00,0x03,
+0x0e,0x0d,0x00,0xc0,0x00,0x00,0x5b,0xef,0xec,0x81,0x00,0x00,0x01,0xbf,0xff,0xff,
+0x42,0x01,0xf0,0x11,0xbf,0xff,0xb7,0x9f,0xff,0xf2,0x00,0x5f,0xff,0x70,0x00,0x2f,
+0xff,0xa0,0x0a,0xff,0xe0,0x00,0x00,0x9f,0xff,0x00,0xef,0xfb,0x00,0x00,0x06,0xff,
+0xf2,0x0f,0xff,0x90,0x07,0x01,0x30,0x40,0xff,0xf9,0x07,0x01,0xfb,0x1f,0xf4,0x0e,
+0xff,0xb0,0x00,0x00,0x6f,0xff,0x20,0xaf,0xfe,0x00,0x00,0x0a,0xff,0xf0,0x04,0xff,
+0xf7,0x00,0x03,0xff,0xf9,0x00,0x0b,0xff,0xfa,0x79,0xff,0xfe,0x10,0x00,0x1c,0xff,
+0xff,0xff,0xfe,0x30,0x00,0x00,0x05,0xbe,0xfe,0xc7,0x00,0x00,0x9d,0x00,0x3e,0x86,
+0x66,0x7f,0x9d,0x00,0x0f,0x0d,0x00,0x24,0xc0,0x5f,0xff,0x02,0xae,0xfd,0x70,0x00,
+0x4f,0xff,0x4f,0xff,0xff,0x18,0x02,0xf0,0x00,0xee,0x88,0xef,0xff,0x50,0x4f,0xff,
+0xe1,0x00,0x2f,0xff,0xc0,0x4f,0xff,0x80,0x9c,0x00,0x51,0x4f,0xff,0x40,0x00,0x06,
+0x70,0x02,0x45,0x00,0x05,0xff,0xf3,0x07,0x00,0x03,0x15,0x00,0x02,0x23,0x00,0x00,
+0x31,0x00,0x00,0x4b,0x02,0xa0,0xed,0x78,0xef,0xff,0x40,0x4f,0xff,0x6f,0xff,0xff,
+0x8f,0x02,0x40,0x23,0xbe,0xfd,0x60,0x6c,0x02,0x02,0x10,0x03,0x0f,0x07,0x00,0x07,
+0xb0,0x00,0x00,0x7c,0xef,0xea,0x30,0x00,0x00,0x1d,0xff,0xff,0x1e,0x02,0xf0,0x08,
+0xcf,0xff,0x98,0xcf,0xff,0x40,0x05,0xff,0xf5,0x00,0x0c,0xff,0xc0,0x0b,0xff,0xd0,
+0x00,0x04,0x99,0x90,0x0e,0xff,0xa0,0x28,0x00,0x01,0x46,0x01,0x05,0x07,0x00,0x03,
+0x15,0x00,0x82,0x0b,0xff,0xe0,0x00,0x05,0xdd,0xd0,0x06,0x31,0x00,0x92,0x00,0xdf,
+0xff,0x97,0xcf,0xff,0x40,0x00,0x2d,0x4d,0x00,0x52,0x00,0x7c,0xff,0xd9,0x20,0x42,
+0x01,0x12,0xf8,0x06,0x00,0xcf,0x26,0x66,0xcf,0xfe,0x66,0x63,0x00,0x00,0x9f,0xfd,
+0x00,0x00,0x06,0x00,0x28,0x00,0xdc,0x01,0xf0,0x11,0x00,0x00,0xff,0xf9,0x3f,0xff,
+0x40,0x00,0x04,0xff,0xf3,0x0d,0xff,0xa0,0x00,0x09,0xff,0xd0,0x07,0xff,0xe0,0x00,
+0x0e,0xff,0x70,0x01,0xff,0xf4,0x00,0x2f,0xff,0x20,0x0b,0x03,0x90,0x7f,0xfc,0x00,
+0x00,0x4f,0xfe,0x00,0xcf,0xf6,0xb0,0x00,0x80,0x31,0xff,0xf1,0x00,0x00,0x08,0xff,
+0x85,0xb9,0x00,0xd0,0x02,0xff,0xd9,0xff,0x40,0x00,0x00,0x00,0xbf,0xfe,0xfe,0x00,
+0x00,0x1c,0x02,0x12,0xf9,0xd4,0x00,0x30,0xf3,0x00,0x00,0x14,0x02,0x12,0xd0,0xe9,
+0x00,0x11,0x70,0x6f,0x00,0x81,0xff,0x10,0x00,0x00,0x07,0xad,0xff,0xf8,0xee,0x00,
+0x84,0xff,0xc0,0x00,0x00,0x00,0x09,0xff,0xe8,0x6b,0x04,0x24,0x24,0x42,0x0a,0x00,
+0x2f,0xaf,0xf8,0x0a,0x00,0x1a,0xf0,0x13,0x6d,0xfe,0x90,0xaf,0xf8,0x09,0xef,0xd5,
+0x00,0x07,0xff,0xff,0xfc,0xaf,0xf8,0xcf,0xff,0xff,0x60,0x2f,0xff,0xe8,0x8f,0xef,
+0xfe,0xe8,0x8f,0xff,0xf1,0x8f,0xff,0x30,0x05,0xff,0x04,0x00,0xf2,0x08,0xf6,0xcf,
+0xfd,0x00,0x00,0xef,0xfd,0x00,0x00,0xff,0xfa,0xef,0xfa,0x00,0x00,0xbf,0xf9,0x00,
+0x00,0xcf,0xfc,0xff,0xf9,0x46,0x00,0x26,0xbf,0xfd,0x0a,0x00,0x04,0x1e,0x00,0x30,
+0xdf,0xfc,0xcf,0x2e,0x00,0x10,0xfc,0x1e,0x01,0x50,0x8f,0xff,0x30,0x06,0xff,0x04,
+0x00,0x15,0xf5,0x5a,0x00,0xff,0x05,0xe0,0x09,0xff,0xff,0xfb,0xaf,0xf8,0xdf,0xff,
+0xff,0x50,0x00,0x7d,0xfd,0x80,0xaf,0xf8,0x19,0xef,0xc4,0xbe,0x00,0x20,0xf2,0x0a,
+0x4f,0xff,0x60,0x00,0x09,0xff,0xf2,0x09,0xff,0xe1,0x00,0x3f,0xff,0x60,0x00,0xdf,
+0xfa,0x00,0xcf,0xfb,0x00,0x00,0x3f,0xff,0x46,0x63,0x01,0x90,0xdf,0xff,0x50,0x00,
+0x00,0x00,0xdf,0xff,0xfa,0x2c,0x00,0x10,0x3f,0x14,0x00,0x00,0x67,0x04,0x20,0xf5,
+0x00,0x78,0x01,0x00,0x62,0x03,0x40,0x00,0x0c,0xff,0xac,0x84,0x03,0xd0,0x7f,0xfe,
+0x12,0xff,0xf5,0x00,0x02,0xff,0xf6,0x00,0x8f,0xfe,0x10,0x3f,0x02,0xa2,0x0e,0xff,
+0xb0,0x7f,0xff,0x20,0x00,0x04,0xff,0xf6,0x29,0x03,0x23,0x50,0x04,0xee,0x03,0x0f,
+0x0f,0x00,0x32,0x62,0xf8,0x66,0x67,0xff,0xf9,0x60,0xd1,0x03,0x22,0xff,0x24,0x07,
+0x00,0x11,0xf2,0xd6,0x00,0x13,0x0d,0x0c,0x03,0x1f,0xdf,0x0f,0x00,0x05,0x6f,0xff,
+0xf7,0x00,0x00,0xaf,0xfc,0x06,0x00,0x06,0x10,0xf8,0x06,0x00,0x70,0xdf,0xfe,0x30,
+0x15,0xdf,0xfc,0xaf,0x56,0x00,0xd1,0xfc,0x1e,0xff,0xff,0xfe,0xef,0xfc,0x01,0x8a,
+0x97,0x30,0xaf,0xfc,0x37,0x01,0x1e,0xfc,0x06,0x00,0x01,0x99,0x06,0xef,0xf0,0x00,
+0x2f,0xff,0x04,0xff,0xf0,0x00,0x3f,0xff,0x00,0x02,0xff,0xf0,0x13,0x00,0x44,0x60,
+0xf6,0x66,0x8f,0xff,0x66,0x67,0x13,0x00,0x03,0x01,0x00,0x14,0x04,0x09,0x00,0x06,
+0x26,0x00,0x1f,0x10,0x0a,0x00,0x53,0x85,0x66,0x68,0xff,0xf6,0x66,0x7f,0xff,0x75,
+0x8b,0x00,0x16,0xfd,0x0a,0x00,0x04,0x64,0x02,0x1f,0x2f,0x0a,0x00,0x16,0x00,0xdb,
+0x01,0x01,0x8f,0x02,0x0f,0x07,0x00,0x09,0x33,0x53,0x32,0x20,0xc7,0x05,0x13,0xc6,
+0xce,0x05,0x10,0x80,0x1c,0x00,0x30,0x3c,0xff,0xf1,0x07,0x00,0x30,0x04,0xff,0xf4,
+0x07,0x00,0x10,0x05,0x07,0x00,0x52,0x53,0x34,0x7e,0xff,0xe0,0x23,0x00,0x20,0x40,
+0x4f,0x92,0x00,0x11,0x92,0x46,0x00,0x22,0x02,0x9d,0xc7,0x04,0x30,0x30,0x00,0x6f,
+0xd8,0x04,0x00,0x0a,0x00,0x50,0x04,0xff,0xfe,0x88,0xef,0xc6,0x07,0x60,0x30,0x0c,
+0xff,0xe1,0x00,0x1e,0xb0,0x05,0x60,0x30,0x2f,0xff,0x70,0x00,0x08,0x55,0x00,0x24,
+0x87,0x9f,0x51,0x00,0x01,0xd6,0x07,0x38,0x03,0xff,0xf5,0x0a,0x00,0x24,0x30,0x5f,
+0x1e,0x00,0x03,0x32,0x00,0x11,0xf0,0x46,0x00,0x30,0xe0,0x00,0x1e,0xc5,0x05,0x80,
+0x30,0x03,0xff,0xfd,0x78,0xef,0xff,0x20,0x6e,0x00,0x11,0x5f,0xdb,0x06,0x03,0x82,
+0x00,0x21,0xd8,0x10,0xab,0x05,0x00,0x27,0x01,0x12,0x1d,0x2e,0x01,0x61,0xaf,0xff,
+0x94,0x33,0xaf,0xfd,0xe4,0x06,0x20,0x9f,0xfd,0x84,0x03,0x00,0x07,0x00,0x30,0x9f,
+0xff,0x50,0x07,0x00,0x12,0x2e,0x23,0x00,0x22,0x01,0x9f,0x58,0x01,0x90,0x9f,0xfd,
+0x22,0xaf,0xfd,0x00,0x03,0xff,0xf4,0x1c,0x00,0x30,0x0c,0xff,0xb0,0x07,0x00,0x00,
+0x69,0x03,0x50,0x9f,0xfd,0x01,0xff,0xf9,0x1f,0x00,0x32,0x0b,0xff,0xf1,0x59,0x05,
+0x06,0x0d,0x06,0x16,0xf7,0x0d,0x06,0x12,0xf3,0x0d,0x06,0xa0,0xc0,0x00,0x03,0x88,
+0x70,0x0e,0xff,0xc6,0x66,0x20,0x1d,0x05,0x35,0xff,0xff,0x60,0x07,0x00,0x00,0x52,
+0x07,0x00,0x1f,0x05,0x00,0x85,0x08,0x29,0xee,0xe0,0x0d,0x06,0x1c,0x30,0x0d,0x06,
+0x60,0x24,0xff,0xf2,0x2a,0xaa,0x10,0x2f,0x00,0x10,0x04,0xc4,0x06,0x1f,0x24,0x05,
+0x00,0x0a,0xf2,0x01,0x20,0x7f,0xf2,0x02,0xff,0x77,0xff,0x20,0x2f,0xf7,0x5c,0xc1,
+0x02,0xcc,0x60,0x00,0x51,0x04,0x5f,0x30,0x00,0x03,0xff,0xf3,0x09,0x00,0x1f,0x50,
+0x00,0x03,0xff,0xf3,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -845,11 +907,19 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 1068, .range_length = 44, .glyph_id_start = 126, .list_length = 44, .type = 0, .unicode_list = 0, .glyph_id_ofs_list = 1296 },
 };
 
-static uint8_t etxUncompBuf[26882] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 2580, .size = 3987, .comp_size = 2892 },
+{ .bitmap_start = 3987, .comp_offset = 5472, .size = 4043, .comp_size = 2512 },
+{ .bitmap_start = 8030, .comp_offset = 7984, .size = 4025, .comp_size = 2493 },
+{ .bitmap_start = 12055, .comp_offset = 10477, .size = 4041, .comp_size = 2289 },
+{ .bitmap_start = 16096, .comp_offset = 12766, .size = 2718, .comp_size = 1559 },
+};
+
+static uint8_t etxUncompBuf[8068] __SDRAMFONTS;
 
 const etxLz4Font lv_font_ua_bold_XL = {
-.uncomp_size = 26618,
-.comp_size = 13334,
+.uncomp_size = 7804,
+.comp_size = 2580,
 .line_height = 30,
 .base_line = 6,
 .subpx = 0,
@@ -862,12 +932,13 @@ const etxLz4Font lv_font_ua_bold_XL = {
 .bitmap_format = 0,
 .left_class_cnt = 83,
 .right_class_cnt = 74,
-.glyph_bitmap = 1340,
-.class_pair_values = 20154,
-.left_class_mapping = 26296,
-.right_class_mapping = 26457,
+.class_pair_values = 1340,
+.left_class_mapping = 7482,
+.right_class_mapping = 7643,
+.block_num = 5,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 26882,
+.lvglFontBufSize = 8068,
 };
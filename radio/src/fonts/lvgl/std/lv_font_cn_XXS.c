@@ -242,1844 +242,1899 @@ static const uint8_t lz4FontData[] ={
 0x03,0x08,0x00,0x13,0x58,0x08,0x00,0x13,0x82,0x08,0x00,0x13,0xac,0x08,0x00,0x10,
 0xd6,0x08,0x00,0x52,0x08,0x00,0xff,0x06,0x75,0x58,0x00,0x13,0x2e,0x08,0x00,0x22,
 0x56,0x75,0xa8,0x00,0x22,0x88,0x75,0x28,0x00,0x22,0xb2,0x75,0x60,0x00,0x60,0xd5,
-0x75,0x10,0x09,0x0a,0x07,0xd0,0x18,0xf4,0xff,0xff,0xff,0xff,0xff,0xff,0x13,0x72,
-0x1f,0xb5,0x21,0x51,0x2f,0x50,0x4d,0x5a,0x4d,0x5b,0x4d,0x5d,0x4d,0x5e,0x4d,0x7a,
-0x4d,0x7d,0x4d,0x82,0x4d,0x89,0x4d,0x8a,0x4d,0x8b,0x4d,0x99,0x4d,0x9b,0x4d,0x9c,
-0x4d,0xa0,0x4d,0xa8,0x4d,0xdc,0x4d,0xde,0x4d,0xf4,0x4d,0xfb,0x4d,0xfe,0x4d,0x15,
-0x4e,0x1b,0x4e,0x1e,0x4e,0x26,0x4e,0x35,0x4e,0x3a,0x4e,0x40,0x4e,0x46,0x4e,0x4b,
-0x4e,0x4d,0x4e,0x60,0x4e,0x70,0x4e,0x7f,0x4e,0x9d,0x4e,0x9e,0x4e,0x9f,0x4e,0xa3,
-0x4e,0xa5,0x4e,0xac,0x4e,0xcf,0x4e,0xdb,0x4e,0xeb,0x4e,0xf7,0x4e,0x14,0x4f,0x2d,
-0x4f,0x31,0x4f,0x3e,0x4f,0x3f,0x4f,0x5d,0x4f,0x62,0x4f,0x8c,0x4f,0x9f,0x4f,0xac,
-0x4f,0xcf,0x4f,0xf8,0x4f,0x1f,0x50,0x95,0x50,0x99,0x50,0x9b,0x50,0xb5,0x50,0xb8,
-0x50,0xbc,0x50,0xc0,0x50,0xc3,0x50,0xc6,0x50,0xc7,0x50,0xc8,0x50,0xcc,0x50,0xd5,
-0x50,0xdc,0x50,0xe9,0x50,0x02,0x51,0x16,0x51,0x1f,0x51,0x30,0x51,0x4a,0x51,0x4b,
-0x51,0x4d,0x51,0x56,0x51,0x57,0x51,0x67,0x51,0x6b,0x51,0x6d,0x51,0x70,0x51,0x79,
-0x51,0x7b,0x51,0x80,0x51,0x86,0x51,0x87,0x51,0x89,0x51,0x9d,0x51,0xbf,0x51,0xef,
-0x51,0xf0,0x51,0xf8,0x51,0x55,0x52,0x58,0x52,0x66,0x52,0x89,0x52,0x8a,0x52,0x97,
-0x52,0x9a,0x52,0x9f,0x52,0xa5,0x52,0xb1,0x52,0xbb,0x52,0xd2,0x52,0xdb,0x52,0xef,
-0x52,0x12,0x53,0x19,0x53,0x1a,0x53,0x1c,0x53,0x1d,0x53,0x21,0x53,0x26,0x53,0x28,
-0x53,0x30,0x53,0x33,0x53,0x3a,0x53,0x3f,0x53,0x40,0x53,0x43,0x53,0x47,0x53,0x58,
-0x53,0x5c,0x53,0x5d,0x53,0x5e,0x53,0x61,0x53,0x67,0x53,0x76,0x53,0x7b,0x53,0x7f,
-0x53,0x9a,0x53,0xb8,0x53,0xcd,0x53,0xdc,0x53,0x1d,0x54,0xb8,0x55,0x2e,0x56,0x30,
-0x56,0x44,0x56,0x4a,0x56,0x4d,0x56,0x4e,0x56,0x56,0x56,0x78,0x56,0x80,0x56,0x90,
-0x56,0x97,0x56,0xa7,0x56,0xdb,0x56,0x4a,0x57,0xbb,0x57,0xee,0x57,0x40,0x58,0x57,
-0x58,0x5d,0x58,0x66,0x58,0x6a,0x58,0x77,0x58,0x79,0x58,0x7a,0x58,0x81,0x58,0x89,
-0x58,0xcd,0x58,0x1b,0x59,0xa0,0x5a,0xa7,0x5a,0xa8,0x5a,0xb6,0x5a,0xd3,0x5a,0xd9,
-0x5a,0xdc,0x5a,0xea,0x5a,0xee,0x5a,0x09,0x5b,0x0d,0x5b,0x48,0x5b,0x49,0x5b,0x4c,
-0x5b,0x54,0x5b,0x56,0x5b,0x5f,0x5b,0x8a,0x5b,0x8e,0x5b,0x90,0x5b,0x9f,0x5b,0xa5,
-0x5b,0x35,0x5d,0x36,0x5d,0x3e,0x5d,0x42,0x5d,0x53,0x5d,0x5c,0x5d,0x76,0x5d,0x77,
-0x5d,0x88,0x5d,0x8d,0x5d,0x95,0x5d,0xa5,0x5d,0xc3,0x5d,0xc6,0x5d,0xdf,0x5d,0xe4,
-0x5d,0xf6,0x5d,0x46,0x5e,0x4a,0x5e,0x50,0x5e,0x52,0x5e,0x5f,0x5e,0x65,0x5e,0x81,
-0x5e,0x89,0x5e,0x8a,0x5e,0xa3,0x5e,0xa5,0x5e,0xb2,0x5e,0xc1,0x5e,0xd4,0x5e,0xd5,
-0x5e,0xd8,0x5e,0xfa,0x5e,0xfe,0x5e,0x07,0x5f,0x13,0x5f,0x15,0x5f,0x27,0x5f,0x3b,
-0x5f,0x4d,0x5f,0x51,0x5f,0x70,0x5f,0x75,0x5f,0x8b,0x5f,0xb2,0x5f,0xbf,0x5f,0xfc,
-0x5f,0x15,0x60,0x5f,0x60,0x6f,0x60,0xb2,0x60,0x5f,0x61,0x60,0x61,0x66,0x61,0x7a,
-0x61,0x90,0x61,0x97,0x61,0x9b,0x61,0xa3,0x61,0xb7,0x61,0xb9,0x61,0xbb,0x61,0xbc,
-0x61,0xce,0x61,0xf4,0x61,0xf5,0x61,0x19,0x62,0x22,0x62,0x2f,0x62,0x38,0x62,0x39,
-0x62,0x4e,0x62,0x51,0x62,0x57,0x62,0x59,0x62,0x7f,0x62,0xb2,0x62,0xbe,0x62,0xc7,
-0x62,0xe2,0x62,0xf5,0x62,0xf7,0x62,0xf8,0x62,0x1f,0x63,0x20,0x63,0x22,0x63,0x44,
-0x63,0x97,0x63,0xc8,0x63,0xfd,0x63,0x1d,0x64,0x36,0x64,0x7f,0x64,0x86,0x64,0x89,
-0x64,0x8e,0x64,0x95,0x64,0x98,0x64,0x9f,0x64,0xa1,0x64,0xa9,0x64,0xc0,0x64,0xc4,
-0x64,0xd7,0x64,0xec,0x64,0xfd,0x64,0xff,0x64,0x00,0x65,0x09,0x65,0x1b,0x65,0x30,
-0x65,0x35,0x65,0x46,0x65,0x5e,0x65,0x6f,0x65,0x70,0x65,0x7f,0x65,0x8e,0x65,0xbe,
-0x65,0xbf,0x65,0xd2,0x65,0x42,0x66,0x44,0x66,0x4f,0x66,0x50,0x66,0x59,0x66,0x6f,
-0x66,0x7a,0x66,0x7c,0x66,0x8a,0x66,0x96,0x66,0xb1,0x66,0xb5,0x66,0xcf,0x66,0xd1,
-0x66,0xec,0x66,0x14,0x67,0x35,0x67,0x57,0x67,0x5f,0x67,0x71,0x67,0x87,0x67,0x8c,
-0x67,0x96,0x67,0x10,0x68,0x71,0x69,0x7a,0x69,0x77,0x6a,0xb2,0x6a,0xb3,0x6a,0xb4,
-0x6a,0xb5,0x6a,0xcb,0x6a,0xda,0x6a,0x05,0x6b,0x24,0x6b,0x84,0x6b,0xb0,0x6b,0xf1,
-0x6b,0x09,0x6c,0x0f,0x6c,0x25,0x6c,0x32,0x6c,0x38,0x6c,0x6b,0x6c,0x82,0x6c,0x8b,
-0x6c,0x91,0x6c,0x9b,0x6c,0xd8,0x6c,0x47,0x6d,0x4b,0x6d,0x55,0x6d,0x60,0x6d,0x79,
-0x6d,0x88,0x6d,0xce,0x6d,0xe0,0x6d,0x21,0x6e,0x2a,0x6e,0x2e,0x6e,0x31,0x6e,0x34,
-0x6e,0x10,0x6f,0xbb,0x6f,0xbf,0x6f,0xc5,0x6f,0x09,0x70,0x76,0x70,0x86,0x70,0xd4,
-0x70,0x7c,0x71,0x97,0x71,0x98,0x71,0xa9,0x71,0xc9,0x71,0x06,0x72,0xd7,0x72,0xff,
-0x72,0x00,0x73,0x3d,0x73,0x56,0x73,0xae,0x73,0x6f,0x74,0x78,0x74,0x85,0x74,0x9c,
-0x74,0xb5,0x74,0xcd,0x75,0xd4,0x75,0x1a,0x76,0x21,0x76,0x26,0x76,0x28,0x76,0x3e,
-0x76,0x44,0x76,0x48,0x76,0x5b,0x76,0x6f,0x76,0xfc,0x76,0x35,0x77,0x51,0x77,0xbc,
-0x77,0xbe,0x77,0x8a,0x78,0xd1,0x78,0x0b,0x79,0x22,0x79,0x3f,0x79,0x40,0x79,0x4b,
-0x79,0x5b,0x79,0x83,0x79,0xca,0x79,0xd1,0x79,0xe7,0x79,0x2e,0x7a,0x3f,0x7a,0x7c,
-0x7a,0x99,0x7a,0xce,0x7a,0xe7,0x7a,0xf1,0x7a,0xcb,0x7b,0xe8,0x7b,0x0e,0x7c,0x4b,
-0x7c,0x77,0x7c,0x7f,0x7c,0xf2,0x7d,0xf7,0x7d,0x05,0x7e,0x0f,0x7e,0x13,0x7e,0x14,
-0x7e,0x16,0x7e,0x18,0x7e,0x1f,0x7e,0x21,0x7e,0x23,0x7e,0x2d,0x7e,0x2f,0x7e,0x3d,
-0x7e,0x4f,0x7e,0x63,0x7e,0x66,0x7e,0x79,0x7e,0xbe,0x7e,0xde,0x7e,0x4b,0x7f,0x4c,
-0x7f,0x55,0x7f,0x67,0x7f,0x76,0x7f,0xa4,0x7f,0x1c,0x80,0x4d,0x80,0x59,0x80,0x6a,
-0x80,0x3a,0x81,0x43,0x81,0x7a,0x81,0x85,0x81,0xc2,0x81,0xd2,0x81,0x41,0x82,0x53,
-0x82,0xc7,0x82,0x2c,0x83,0x54,0x83,0x8d,0x83,0xb1,0x83,0x2d,0x84,0x1f,0x85,0x52,
-0x86,0x0a,0x87,0x9c,0x87,0xb5,0x87,0xb8,0x87,0xc0,0x87,0xfb,0x87,0x15,0x88,0xcf,
-0x88,0xd1,0x88,0xd6,0x88,0x14,0x89,0x16,0x89,0x18,0x89,0x22,0x89,0x33,0x89,0x36,
-0x89,0x50,0x89,0xb6,0x8a,0xf1,0x8a,0xf4,0x8a,0xfe,0x8a,0x00,0x8b,0x0e,0x8b,0x0f,
-0x8b,0x11,0x8b,0x25,0x8b,0x2d,0x8b,0x32,0x8b,0x36,0x8b,0x3d,0x8b,0x3f,0x8b,0x44,
-0x8b,0x47,0x8b,0x4b,0x8b,0x53,0x8b,0x81,0x8b,0x6f,0x8c,0x75,0x8c,0x84,0x8c,0xc7,
-0x8c,0xd5,0x8c,0x03,0x8d,0x2d,0x8d,0x2f,0x8d,0x3f,0x8d,0x43,0x8d,0x7a,0x8d,0xfb,
-0x8d,0xb6,0x8e,0xbc,0x8e,0xbe,0x8e,0xc4,0x8e,0xcd,0x8e,0xd3,0x8e,0xe1,0x8e,0xe3,
-0x8e,0x09,0x8f,0x17,0x8f,0x20,0x8f,0x2b,0x8f,0x2e,0x8f,0x2f,0x8f,0x40,0x8f,0x50,
-0x8f,0x56,0x8f,0x59,0x8f,0x6a,0x8f,0x6f,0x8f,0x8b,0x8f,0xa3,0x8f,0xb5,0x8f,0x38,
-0x90,0x9d,0x90,0x17,0x91,0x1a,0x91,0x1d,0x91,0x1f,0x91,0xc4,0x91,0xd8,0x93,0xef,
-0x93,0xfe,0x93,0x51,0x94,0x69,0x94,0x7e,0x94,0xac,0x94,0xcf,0x94,0x38,0x95,0x3d,
-0x95,0x3e,0x95,0x42,0x95,0x44,0x95,0x84,0x95,0x86,0x95,0x90,0x95,0x94,0x95,0x9d,
-0x95,0xa0,0x95,0xb4,0x95,0xc7,0x95,0xdf,0x95,0xe4,0x95,0xec,0x95,0x16,0x96,0x46,
-0x96,0x50,0x96,0x57,0x96,0xa9,0x96,0xae,0x96,0xb2,0x96,0x39,0x97,0x43,0x97,0xc5,
-0x97,0xc6,0x97,0xc9,0x97,0xca,0x97,0xcb,0x97,0xd4,0x97,0xe1,0x97,0xe8,0x97,0xec,
-0x97,0x2e,0x98,0xd8,0x98,0xc1,0x99,0xc6,0x99,0xce,0x99,0xdc,0x99,0x28,0x9a,0x73,
-0x9d,0xf6,0x9d,0x28,0x9e,0xa0,0x9e,0x51,0xef,0x58,0xef,0x5b,0xef,0x5c,0xef,0x5d,
-0xef,0x61,0xef,0x63,0xef,0x65,0xef,0x69,0xef,0x6c,0xef,0x71,0xef,0x76,0xef,0x77,
-0xef,0x78,0xef,0x8e,0xef,0x93,0xef,0x98,0xef,0x9b,0xef,0x9c,0xef,0x9d,0xef,0xa1,
-0xef,0xa2,0xef,0xa3,0xef,0xa4,0xef,0xb7,0xef,0xb8,0xef,0xbe,0xef,0xc0,0xef,0xc1,
-0xef,0xc4,0xef,0xc7,0xef,0xc8,0xef,0xc9,0xef,0xcb,0xef,0xe3,0xef,0xe5,0xef,0x14,
-0xf0,0x15,0xf0,0x17,0xf0,0x19,0xf0,0x30,0xf0,0x37,0xf0,0x3a,0xf0,0x43,0xf0,0x6c,
-0xf0,0x74,0xf0,0xab,0xf0,0x3b,0xf1,0x90,0xf1,0x91,0xf1,0x92,0xf1,0x93,0xf1,0x94,
-0xf1,0xd7,0xf1,0xe3,0xf1,0x3d,0xf2,0x54,0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0x49,
-0x39,0x38,0x38,0x26,0x00,0x28,0x66,0x66,0x55,0x11,0x10,0x00,0x90,0xa0,0x00,0xa0,
-0x90,0x1a,0xdb,0xc4,0x02,0x76,0x30,0x4c,0xbd,0xa0,0x08,0x1a,0x00,0x0a,0x0a,0x00,
-0x00,0x70,0x00,0x6e,0x70,0x2b,0x09,0x53,0xb0,0x23,0x08,0xc5,0x00,0x01,0xb5,0x65,
-0x04,0x81,0xc9,0xc2,0x00,0xa0,0x00,0x2a,0x80,0x00,0x07,0x19,0x0a,0x00,0x72,0x96,
-0x50,0x01,0x87,0xa0,0x00,0x00,0x83,0x98,0x00,0x28,0x63,0x72,0x02,0x02,0xaa,0x00,
-0x08,0xb9,0x00,0x0d,0x0b,0x00,0x0c,0x6b,0x00,0x09,0xe0,0x00,0x59,0x68,0x91,0x75,
-0x0a,0xc0,0x1a,0x9b,0xc3,0x81,0x80,0x10,0x00,0x20,0x38,0x0b,0x02,0x90,0x57,0x06,
-0x60,0x57,0x01,0xb0,0x0a,0x10,0x19,0x00,0x00,0x20,0x07,0x40,0x0c,0x00,0x93,0x06,
-0x60,0x57,0x06,0x50,0xa2,0x1a,0x08,0x20,0x00,0x00,0x06,0x40,0x8b,0xa7,0x0b,0xa0,
-0x34,0x61,0x00,0xa0,0x00,0x0d,0x00,0x8c,0xfc,0x90,0x0d,0x00,0x00,0xd0,0x00,0x75,
-0x92,0x10,0x9a,0x30,0x37,0x00,0x74,0x00,0xb0,0x03,0x70,0x09,0x10,0x0a,0x00,0x55,
-0x00,0xa0,0x00,0x0a,0xba,0x04,0x80,0x75,0x75,0x04,0x88,0x50,0x48,0x75,0x04,0x74,
-0x80,0x75,0x0a,0xba,0x00,0x05,0xc3,0x27,0xa3,0x00,0x93,0x02,0x00,0xf1,0x5c,0x1a,
-0xbb,0x07,0x50,0x85,0x10,0x08,0x40,0x02,0xb0,0x00,0xc2,0x00,0xb3,0x00,0x6e,0xbb,
-0x70,0x0b,0xba,0x06,0x50,0x84,0x00,0x09,0x30,0x3c,0xa0,0x00,0x08,0x56,0x40,0x76,
-0x1b,0xaa,0x00,0x00,0x2f,0x00,0x0a,0xe0,0x03,0x8d,0x00,0xb1,0xd0,0x57,0x0d,0x09,
-0xbb,0xf9,0x00,0x0d,0x00,0x0c,0xcc,0x60,0xc0,0x00,0x0e,0xba,0x10,0x30,0x68,0x00,
-0x02,0xa3,0x90,0x48,0x09,0xbb,0x10,0x03,0xb8,0x00,0xb1,0x00,0x4c,0xa9,0x05,0xa0,
-0x76,0x66,0x03,0x93,0xa0,0x67,0x08,0xbb,0x00,0x7b,0xbc,0x90,0x00,0x83,0x00,0x0c,
-0x00,0x06,0x60,0x00,0xc1,0x00,0x39,0x00,0x0a,0x30,0x8c,0x00,0xf1,0x2a,0x85,0x39,
-0x09,0x30,0xbc,0xb0,0x58,0x07,0x66,0x60,0x57,0x0b,0xbb,0x10,0x0a,0xb9,0x06,0x60,
-0xa3,0x84,0x06,0x65,0x80,0x97,0x09,0xab,0x50,0x00,0xb1,0x07,0xb4,0x00,0x47,0x00,
-0x00,0x00,0x47,0x65,0x00,0x00,0x00,0x66,0x92,0x10,0x00,0x4a,0x4b,0x81,0x6b,0x50,
-0x00,0x7b,0x00,0x00,0x3b,0xbb,0x30,0x05,0x00,0x90,0x59,0x10,0x00,0x3a,0x91,0x02,
-0x8b,0x25,0xb3,0xdf,0x06,0xf1,0x43,0x3c,0xc5,0x62,0x0d,0x00,0x2b,0x00,0xc2,0x05,
-0x70,0x00,0x00,0x05,0x50,0x00,0x79,0x99,0x20,0x07,0x40,0x00,0x90,0x19,0x06,0x94,
-0x26,0x54,0x28,0x28,0x09,0x72,0x73,0x37,0x08,0x63,0x82,0x56,0x17,0x36,0x3a,0x7a,
-0x91,0x0a,0x10,0x00,0x00,0x01,0x99,0x94,0x00,0x00,0x97,0x00,0x00,0xbb,0x00,0x04,
-0x68,0x20,0x0a,0x13,0x80,0x0e,0xbb,0xd0,0x56,0x00,0x83,0xb2,0x00,0x49,0x4e,0xbc,
-0x50,0x49,0x00,0xd0,0x49,0x01,0xb0,0x4d,0xbe,0x09,0x00,0xf0,0x17,0x00,0xd0,0x4e,
-0xbc,0x60,0x06,0xcb,0x80,0x2c,0x00,0xa3,0x67,0x00,0x11,0x76,0x00,0x00,0x67,0x00,
-0x11,0x2c,0x00,0xa3,0x05,0xbb,0x70,0x4e,0xbb,0x30,0x49,0x01,0xc0,0x49,0x00,0x94,
-0x49,0x00,0x75,0x06,0x00,0xf4,0x08,0x01,0xd0,0x4e,0xbc,0x30,0x4e,0xbb,0x84,0x90,
-0x00,0x49,0x00,0x04,0xeb,0xb4,0x49,0x00,0x04,0x90,0x00,0x4e,0xbb,0x90,0x12,0x00,
-0x21,0xdb,0xb2,0x12,0x00,0xf2,0x0c,0x49,0x00,0x00,0x05,0xcb,0x90,0x2c,0x00,0x84,
-0x67,0x00,0x00,0x76,0x09,0xb6,0x67,0x00,0x67,0x1c,0x00,0x77,0x05,0xcb,0xa1,0x49,
-0x00,0x3a,0x03,0x00,0x35,0x4e,0xbb,0xca,0x0c,0x00,0x03,0x01,0x00,0x53,0x00,0x09,
-0x40,0x00,0x94,0x05,0x00,0xf2,0x0b,0x4a,0x20,0xb2,0x3c,0xb8,0x00,0x49,0x01,0xc2,
-0x49,0x0b,0x40,0x49,0x96,0x00,0x4e,0xf3,0x00,0x4c,0x2d,0x00,0x49,0x06,0x90,0x49,
-0x00,0x72,0x00,0x06,0x05,0x00,0xf0,0x4b,0x4e,0xbb,0x70,0x4f,0x00,0x02,0xf1,0x4e,
-0x60,0x08,0xe1,0x49,0xb0,0x0c,0xb1,0x49,0xb1,0x48,0xb1,0x49,0x57,0xa2,0xb1,0x49,
-0x0c,0xc0,0xb1,0x49,0x09,0x60,0xb1,0x4d,0x00,0x2a,0x4f,0x70,0x2a,0x49,0xc1,0x2a,
-0x49,0x4a,0x2a,0x49,0x0a,0x7a,0x49,0x01,0xea,0x49,0x00,0x7a,0x05,0xcc,0x70,0x2c,
-0x00,0xa4,0x67,0x00,0x49,0x75,0x00,0x2a,0x67,0x00,0x49,0x2c,0x00,0xa4,0x05,0xcc,
-0x80,0x4e,0xbc,0x70,0x49,0x00,0xb2,0x49,0x00,0x84,0x49,0x00,0xc2,0x4e,0xbb,0x60,
-0x49,0x00,0xc5,0x00,0x10,0x06,0x2a,0x00,0xf1,0x0a,0xa3,0x66,0x00,0x48,0x85,0x00,
-0x39,0x76,0x00,0x48,0x2c,0x00,0xa4,0x06,0xcd,0xc0,0x00,0x00,0x85,0x00,0x00,0x00,
-0x4e,0xbc,0x60,0x43,0x01,0xfb,0x16,0xd0,0x4e,0xbe,0x30,0x49,0x0a,0x40,0x49,0x02,
-0xb0,0x49,0x00,0xb2,0x0a,0xbc,0x35,0x80,0x1d,0x4b,0x10,0x00,0x5d,0xb2,0x00,0x04,
-0xc8,0x60,0x0d,0x0a,0xbc,0x50,0x8b,0xeb,0xb1,0x00,0xb1,0x00,0x03,0x00,0x37,0x67,
-0x00,0x94,0x03,0x00,0xf0,0x09,0x93,0x3a,0x00,0xc1,0x08,0xbc,0x60,0xb3,0x00,0x77,
-0x58,0x00,0xc1,0x0d,0x02,0xc0,0x0b,0x37,0x60,0x05,0x8d,0x10,0x00,0xeb,0x2f,0x21,
-0xf3,0x30,0xa3,0x07,0x80,0x2a,0x66,0x0b,0xb0,0x57,0x2a,0x0b,0xa0,0x93,0x0c,0x38,
-0x64,0xc0,0x0b,0x83,0x28,0xc0,0x08,0xd0,0x0d,0x90,0x04,0xb0,0x0a,0x50,0x69,0x00,
-0xd1,0x0c,0x38,0x70,0x03,0xdd,0x00,0x00,0xd7,0x00,0x04,0xbd,0x00,0x0d,0x27,0x80,
-0x78,0x00,0xd2,0xb4,0x00,0xd1,0x3c,0x06,0x90,0x0a,0x4d,0x10,0x02,0xf8,0x00,0x00,
-0xc2,0x70,0x00,0x80,0x6b,0xbc,0xd0,0x00,0x09,0x50,0x00,0x3b,0x12,0x00,0xe3,0x07,
-0x70,0x00,0x2c,0x00,0x00,0x9d,0xbb,0xb0,0x4c,0x35,0x70,0x57,0x05,0x03,0x00,0xf2,
-0x03,0x4c,0x30,0xa2,0x00,0x48,0x00,0x0c,0x00,0x07,0x40,0x01,0xa0,0x00,0xb1,0x00,
-0x56,0xa9,0x1b,0x01,0x00,0xf0,0x0e,0xa9,0x04,0x10,0x0c,0x80,0x29,0xb0,0x83,0x74,
-0xab,0xbb,0x00,0x42,0x01,0xb0,0x0a,0xba,0x02,0x40,0xa3,0x09,0x9d,0x37,0x60,0xa3,
-0x3c,0xbb,0x40,0x66,0xe6,0x02,0xf2,0x32,0x6b,0xbb,0x16,0x80,0x67,0x66,0x03,0x96,
-0x80,0x67,0x6b,0xbb,0x10,0x0a,0xba,0x06,0x60,0x53,0x93,0x00,0x06,0x60,0x42,0x0a,
-0xaa,0x00,0x00,0x06,0x70,0x00,0x67,0x0b,0xbc,0x76,0x70,0x77,0x84,0x06,0x76,0x60,
-0x77,0x0a,0xab,0x70,0x09,0xba,0x06,0x70,0x84,0x9c,0xbb,0x56,0x60,0x10,0x0a,0xba,
-0x10,0x07,0xb1,0x0d,0x00,0x7e,0x80,0x0d,0x00,0x02,0x00,0x22,0x0b,0xbb,0x28,0x00,
-0xa2,0x70,0x77,0x0b,0xbc,0x60,0x20,0x85,0x1a,0xba,0x00,0x5e,0x00,0xf0,0x00,0xbc,
-0x16,0x80,0x85,0x66,0x07,0x56,0x60,0x75,0x66,0x07,0x50,0x46,0x00,0x58,0x01,0x00,
-0x34,0x04,0x50,0x00,0xb6,0x00,0x41,0x67,0x3d,0x30,0x67,0x67,0x00,0xd2,0x2c,0x16,
-0x8c,0x10,0x6e,0xc0,0x06,0x77,0x70,0x67,0x0b,0x30,0x58,0x01,0x00,0xc4,0x6b,0xbc,
-0x8b,0xb0,0x67,0x08,0x70,0x93,0x66,0x07,0x50,0x84,0x04,0x00,0x09,0x4f,0x00,0xf2,
-0x1d,0x0a,0xba,0x16,0x70,0x58,0x93,0x01,0xb6,0x60,0x58,0x0a,0xbb,0x00,0x6b,0xab,
-0x16,0x70,0x57,0x66,0x03,0x96,0x70,0x67,0x6c,0xab,0x16,0x60,0x00,0x66,0x00,0x00,
-0x0b,0xbb,0x66,0x70,0x76,0x84,0x06,0x66,0x70,0x76,0x0b,0xbc,0x60,0x8e,0x00,0xf3,
-0x0f,0x06,0xca,0x67,0x06,0x60,0x66,0x06,0x60,0x1b,0xb9,0x05,0x80,0x60,0x08,0xb7,
-0x04,0x30,0xb2,0x1b,0xba,0x00,0x1b,0x0a,0xe6,0x1b,0x01,0xb0,0x1b,0x00,0xc7,0x58,
-0x00,0xf0,0x31,0x55,0x70,0x85,0x1c,0xbc,0x50,0xb2,0x0c,0x05,0x71,0xa0,0x0b,0x65,
-0x00,0xac,0x00,0x04,0xa0,0x00,0xa1,0x1d,0x06,0x66,0x56,0xc2,0xa2,0x29,0xa4,0x7b,
-0x00,0xba,0x0c,0x90,0x09,0x60,0xa4,0x00,0x77,0x1c,0x00,0xca,0x40,0x06,0xd0,0x00,
-0xc9,0x40,0x76,0x0c,0x00,0xb2,0x0d,0x06,0x72,0xa0,0x1c,0x75,0x00,0xbd,0x00,0x05,
-0xa0,0x00,0x65,0xfa,0x03,0xf3,0x0d,0x6b,0xbf,0x00,0x09,0x60,0x04,0xa0,0x01,0xc1,
-0x00,0x8d,0xbb,0x10,0x02,0x90,0xa2,0x0c,0x00,0xc0,0x98,0x00,0xc0,0x0c,0x00,0xa2,
-0x02,0x90,0x36,0x01,0x00,0xf0,0x08,0x92,0x02,0xb0,0x0c,0x00,0xc0,0x07,0x90,0xc0,
-0x0c,0x02,0xb0,0x92,0x00,0x0a,0xa2,0x36,0x44,0x1a,0xb1,0x00,0x00,0x03,0x23,0x04,
-0xf0,0x0a,0xf4,0x00,0x09,0xaa,0xab,0xb3,0x00,0xb1,0x11,0x01,0xc2,0x0b,0x00,0x00,
-0x0a,0x40,0xdc,0xcc,0x88,0x60,0x00,0x00,0x1f,0x70,0x00,0xab,0x05,0x10,0x00,0xf7,
-0x23,0xf5,0x20,0x9b,0x00,0x00,0x07,0x7e,0xaa,0xa6,0x69,0x01,0x11,0x2b,0x95,0x00,
-0x00,0x1b,0x0a,0x3c,0xcc,0xc9,0x00,0xbb,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x04,
-0x10,0x00,0x00,0x78,0xa2,0x00,0x09,0x60,0x0a,0x30,0x8e,0x70,0x1b,0xf2,0x00,0xc0,
-0x29,0x00,0x04,0x00,0x78,0xec,0xc8,0x00,0x00,0xab,0xb6,0x00,0x14,0x00,0xc0,0x7c,
-0xb0,0x1e,0xb2,0x1b,0x30,0x08,0x70,0x00,0xb5,0xa6,0x00,0xbc,0x03,0x02,0x01,0x00,
-0x10,0x08,0x49,0x00,0xf5,0x26,0xf4,0x00,0x00,0x00,0xd7,0xd0,0x00,0x00,0x5b,0x0b,
-0x50,0x00,0x0d,0x20,0x2d,0x00,0x06,0xa0,0x00,0xa6,0x00,0xef,0xff,0xff,0xe0,0x00,
-0x00,0x59,0x20,0x07,0x6b,0x4c,0x1d,0x67,0xd7,0xba,0x40,0xaf,0xb6,0xc0,0x0c,0x60,
-0xcc,0x10,0x20,0x1c,0x4b,0x00,0x0b,0x40,0x5d,0xcd,0x50,0xa0,0x24,0xf3,0x38,0x03,
-0xdf,0xd4,0x10,0x05,0xa2,0xe2,0xa7,0x00,0xb1,0x01,0x01,0xb1,0x2b,0x00,0x00,0x0a,
-0x20,0xd1,0x00,0x00,0xc2,0x06,0xa1,0x01,0x89,0x00,0x06,0xaa,0xb8,0x00,0x00,0x01,
-0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x8d,0xcc,0xc6,0x00,0x2d,0x0a,0x70,0x97,
-0x00,0xdb,0x5b,0x00,0xc1,0x0c,0x4a,0x00,0x09,0x30,0xc0,0x00,0x00,0xc1,0x04,0xa0,
-0x00,0x88,0x00,0x05,0xcc,0xd7,0x4e,0x00,0xf2,0x0b,0x33,0x33,0x20,0x3f,0xbb,0xd8,
-0x09,0x80,0x0b,0x10,0xa5,0x07,0x80,0x3c,0x98,0x60,0x0b,0x47,0xaa,0x00,0xa4,0x04,
-0x90,0x02,0xcc,0xb1,0x20,0x00,0xf3,0x0b,0x46,0x40,0x02,0x4c,0xfd,0x52,0x83,0x33,
-0x22,0x88,0x0c,0xcb,0x08,0x80,0x22,0x20,0x88,0x09,0x98,0x08,0x88,0x88,0x87,0x70,
-0x0b,0xfb,0x41,0x00,0xf2,0x6f,0x12,0x04,0x02,0xbf,0xeb,0xb8,0xe7,0x00,0x08,0x07,
-0x70,0x00,0x80,0x09,0x30,0x08,0x2b,0x10,0x00,0xb7,0xd7,0x00,0x03,0x02,0xbf,0xeb,
-0x00,0x00,0x12,0x00,0x13,0x33,0x33,0x18,0x8f,0x44,0x68,0x81,0x53,0xef,0xa8,0x5f,
-0x05,0xa9,0x81,0x60,0x00,0x78,0x4e,0x00,0x07,0x83,0xb0,0x00,0x78,0xaf,0x87,0x78,
-0x00,0x17,0x97,0x00,0x00,0x3e,0x7e,0x7c,0x10,0x0d,0x30,0xd2,0x3b,0x02,0xb0,0x0c,
-0x10,0xc0,0x39,0x1a,0x3b,0x5b,0x00,0xda,0x83,0x79,0xd0,0x06,0xe3,0x00,0xb4,0x00,
-0x05,0xcc,0xb4,0x00,0x08,0x80,0x00,0x00,0x94,0x4a,0x00,0x00,0xb0,0x0b,0x4b,0x80,
-0xa3,0x3a,0xef,0xf4,0x1e,0xfa,0xef,0xf2,0x85,0x8f,0xff,0xb0,0xb3,0xff,0xff,0xf2,
-0xed,0xee,0xee,0xe4,0x84,0x00,0x10,0x2a,0x05,0x00,0xf0,0x05,0x3a,0x00,0x00,0xcc,
-0xcc,0xec,0x10,0x07,0x99,0x99,0x97,0x00,0x1d,0xec,0xdd,0xd0,0x00,0x1b,0x30,0x00,
-0x1e,0x01,0x03,0xa8,0x00,0xf2,0x26,0x01,0x86,0x10,0x00,0x00,0x17,0x68,0x70,0x00,
-0x00,0x36,0x94,0x00,0x00,0x17,0xa2,0x00,0x01,0x95,0x69,0x10,0x00,0xd5,0x98,0x7b,
-0x00,0x0c,0x68,0x77,0xa0,0x00,0x1a,0x77,0x90,0x00,0x0a,0xaa,0x91,0x02,0xa2,0x28,
-0xc1,0x29,0x00,0xc9,0xa2,0x90,0x00,0x0b,0x29,0x00,0x00,0xb2,0x07,0x00,0xf2,0x19,
-0xb1,0xeb,0xbb,0xbb,0x00,0x37,0x30,0x00,0x00,0x37,0x17,0x85,0x00,0x08,0x00,0x02,
-0x45,0x01,0x90,0x26,0xb2,0x80,0x62,0xaa,0x82,0x09,0x06,0x10,0x5e,0x00,0x71,0x27,
-0x07,0x93,0x07,0x00,0x58,0x88,0x88,0x60,0x24,0x02,0xf2,0x0e,0x00,0xb3,0x80,0x00,
-0x32,0x3e,0x88,0x00,0x6a,0x8b,0x2b,0x20,0x0b,0x00,0x7b,0xc0,0x00,0xa0,0x00,0xb3,
-0x00,0x37,0x00,0x0b,0x30,0x04,0x60,0x00,0xb3,0x8c,0x00,0xf0,0x16,0x19,0x56,0x39,
-0x19,0x50,0x3e,0x33,0xe3,0x66,0x10,0x00,0x49,0x91,0x16,0xa7,0x05,0x40,0x00,0x6a,
-0xaa,0x00,0x00,0x00,0x48,0x00,0x08,0x90,0x00,0x40,0x4b,0xbb,0xbb,0xbb,0x90,0x00,
-0x00,0xa0,0xbd,0x00,0x22,0x00,0x00,0x09,0x00,0x2a,0x0e,0xaa,0x12,0x00,0x52,0x02,
-0x99,0xad,0x99,0x97,0xfb,0x00,0x80,0xaa,0xca,0xaa,0x70,0x00,0x0b,0x00,0x00,0x33,
-0x26,0xa2,0x00,0x00,0x0b,0x6c,0x30,0x00,0x00,0xb0,0x1a,0x00,0x12,0x00,0x21,0xb0,
-0x00,0x09,0x00,0xf6,0x0c,0x1a,0xaa,0xbc,0xaa,0x50,0x00,0x0b,0x40,0x00,0x00,0x07,
-0xf6,0x20,0x00,0x07,0x9a,0x2b,0x50,0x1b,0x80,0xa0,0x09,0x60,0x30,0x0a,0x00,0x02,
-0x56,0x00,0x00,0x01,0x00,0xf0,0x00,0xb1,0x11,0x11,0x00,0xd8,0x88,0x87,0x03,0x70,
-0x00,0x00,0x04,0xaa,0xaa,0xad,0x3e,0x00,0xc2,0x5a,0xaa,0xaa,0x1a,0x00,0x00,0x00,
-0x37,0x00,0x00,0x5a,0xb2,0x25,0x00,0x00,0xe3,0x00,0xf6,0x02,0x2e,0x10,0x00,0x00,
-0x1b,0x3b,0x20,0x00,0x6c,0x16,0x1b,0x50,0x58,0x00,0xa0,0x07,0x60,0xab,0x00,0x05,
-0x09,0x00,0x12,0x0b,0x04,0x00,0x80,0xda,0xae,0xaa,0xd1,0xa0,0x0b,0x00,0x81,0x04,
-0x00,0xa6,0xea,0xae,0xaa,0xd1,0x30,0x0b,0x00,0x20,0x00,0x0b,0x20,0x00,0xf1,0x0d,
-0x69,0x9e,0x99,0x60,0xa0,0x0b,0x00,0xb0,0x79,0x8d,0x88,0x80,0x88,0x8d,0x88,0x80,
-0xb1,0x1b,0x11,0xa1,0xd9,0x9e,0x99,0xd1,0x40,0x0b,0x00,0x30,0x24,0x00,0xf2,0x13,
-0xd9,0x99,0xb7,0x00,0x0a,0x28,0x02,0x70,0x00,0xa0,0x37,0x27,0x02,0xae,0xaa,0xab,
-0xd7,0x01,0x80,0x00,0x27,0x00,0x55,0x00,0x02,0x70,0x0b,0x10,0x00,0x27,0x03,0x60,
-0x00,0x8a,0x1c,0x03,0xf3,0x19,0x02,0x41,0x90,0x00,0x00,0x0b,0x19,0x00,0x00,0x29,
-0x9a,0xd9,0x99,0x00,0x11,0x57,0x11,0xa0,0x00,0x08,0x44,0x0a,0x00,0x00,0xb0,0xa0,
-0xb0,0x00,0x85,0x03,0x2b,0x00,0x59,0x00,0x00,0xb0,0x39,0x00,0x07,0xb6,0x0f,0x02,
-0x01,0x1d,0x02,0x90,0x50,0x00,0x08,0xaa,0xbc,0xaa,0x20,0x00,0x0a,0xd5,0x00,0x71,
-0xa1,0x00,0x00,0x4a,0xad,0xaa,0x90,0x09,0x00,0x00,0x12,0x00,0x51,0x29,0x99,0x99,
-0x99,0x70,0x29,0x00,0xa0,0x30,0x0a,0x01,0x80,0x04,0x60,0x61,0x74,0x00,0x0a,0x92,
-0x00,0x80,0x3a,0x09,0x30,0x00,0x00,0x6b,0x60,0x00,0xb1,0x09,0x60,0x00,0x6b,0x40,
-0x4c,0x60,0x45,0x82,0x09,0x30,0x00,0x00,0x40,0xd1,0x00,0xf0,0x29,0x10,0x00,0x0a,
-0xaa,0xba,0xa7,0x00,0x00,0x00,0x1c,0x20,0x00,0x00,0x0b,0x30,0x00,0x00,0x1a,0x40,
-0x00,0x00,0x3b,0x20,0x00,0x01,0xad,0x50,0x00,0x11,0x33,0x06,0x9a,0xa9,0x40,0x00,
-0x00,0x50,0x00,0x00,0x19,0xbc,0x99,0x40,0x01,0x80,0x00,0x46,0x00,0x18,0x00,0x59,
-0x10,0x01,0xc9,0x99,0x99,0x8f,0x00,0x60,0x55,0x39,0x99,0x99,0x86,0x40,0xab,0x0f,
-0x43,0x00,0x00,0x02,0x9b,0x94,0x01,0xf2,0x40,0x02,0x44,0x00,0x7a,0x99,0x75,0x20,
-0x09,0x10,0x80,0x00,0x00,0xa0,0x0a,0x00,0x00,0x0b,0xaa,0xea,0xaa,0x30,0x03,0x0a,
-0x03,0x00,0x07,0x50,0xa0,0x57,0x03,0xa0,0x0a,0x00,0x93,0x20,0x0a,0xb0,0x01,0x20,
-0x00,0x01,0x24,0x61,0x00,0x68,0x7c,0x53,0x00,0x59,0x99,0xd9,0x99,0x10,0x05,0x1a,
-0x43,0x20,0x18,0xc1,0xa5,0xa4,0x04,0x7a,0x8e,0x7a,0xa1,0x00,0x56,0xa8,0x20,0x03,
-0xb7,0x0a,0x0a,0x80,0x52,0x00,0xa0,0x05,0x0f,0x03,0x5d,0x5a,0xaa,0xaa,0xa0,0x00,
-0x01,0x00,0xc0,0x2b,0xbb,0xbb,0xbb,0x80,0x06,0xaa,0xcb,0xaa,0x00,0x00,0x08,0x28,
-0x00,0x70,0x82,0x00,0x02,0xaa,0xad,0xba,0xa7,0x09,0x00,0x05,0x12,0x00,0x30,0x00,
-0x03,0xab,0x3e,0x01,0xf1,0x3f,0x10,0x00,0x00,0x11,0x3a,0x11,0x10,0x59,0x99,0x99,
-0x99,0x10,0x2b,0x10,0x49,0x00,0x3b,0x51,0x05,0x4b,0x00,0x01,0x92,0xa0,0x00,0x00,
-0x06,0xd1,0x00,0x00,0x16,0xa7,0xb4,0x00,0x6a,0x40,0x01,0x6a,0x10,0x00,0x01,0x40,
-0x00,0x05,0x99,0x9b,0x99,0x91,0x04,0x87,0x77,0x80,0x00,0x75,0x22,0x2a,0x10,0x03,
-0x66,0x66,0x60,0x00,0x78,0x8b,0xd9,0x10,0x69,0x9a,0xe9,0x99,0x20,0x00,0x19,0x00,
-0x00,0x00,0x49,0x70,0x6f,0x29,0xf2,0x16,0x00,0x06,0x99,0x9c,0x99,0x91,0x02,0x86,
-0x66,0x80,0x00,0x3b,0x77,0x7c,0x00,0x25,0x55,0x55,0x55,0x07,0x74,0x44,0x44,0xb0,
-0x10,0x4b,0x8c,0x11,0x00,0x09,0x20,0x81,0x41,0x4a,0x50,0x06,0xab,0xa9,0x00,0x10,
-0x23,0xa1,0x01,0xf6,0x14,0x7a,0xaa,0xa3,0x02,0xa0,0x90,0x08,0x21,0xd9,0x0a,0x00,
-0xa0,0x45,0x90,0x64,0x38,0x00,0x19,0x00,0xaa,0x00,0x01,0x90,0x0a,0x90,0x00,0x19,
-0x08,0x89,0x70,0x01,0x9a,0x50,0x06,0x80,0xb1,0x02,0xf3,0x12,0x3e,0x20,0x00,0x00,
-0x49,0x1b,0x30,0x02,0x98,0x00,0x09,0xa3,0x62,0x70,0x01,0x62,0x30,0x0b,0x00,0x18,
-0x00,0x00,0xc0,0x01,0x80,0x00,0x58,0x00,0x18,0x00,0x39,0x00,0x01,0x2c,0x00,0xf1,
-0x3e,0x0b,0x00,0x28,0x00,0x00,0xb0,0x04,0x60,0x00,0x0b,0x00,0x65,0x00,0x00,0xf5,
-0x09,0x70,0x00,0x37,0xb1,0xcb,0x00,0x08,0x32,0x98,0x73,0x01,0xb0,0x0c,0x21,0xb0,
-0x64,0x06,0x50,0x03,0x50,0x00,0x70,0x0a,0x00,0x00,0x47,0x30,0xa0,0x00,0x0c,0x2a,
-0x0a,0x28,0x06,0xf0,0xa7,0xe7,0xb0,0x8b,0x6e,0x3a,0x0a,0x00,0xa0,0xa0,0xa0,0xb0,
-0x0a,0x0a,0x02,0x47,0x30,0xa0,0xa0,0x00,0x55,0x0a,0x05,0xa9,0x9a,0x10,0x52,0x00,
-0xb1,0x70,0x40,0x09,0x10,0x0b,0x05,0x60,0xa0,0x00,0xb0,0x09,0x3e,0x02,0xf2,0x04,
-0xa0,0x00,0xb0,0x10,0x55,0x00,0x0b,0x99,0x1c,0x90,0x01,0xa2,0x1b,0x35,0x80,0x00,
-0x0a,0x30,0x07,0x29,0x00,0xf2,0x15,0x1a,0x51,0x80,0x60,0x08,0x39,0x19,0x1a,0x03,
-0xf0,0x55,0x02,0x80,0x9b,0x01,0xa0,0x83,0x00,0xa0,0x08,0x49,0x00,0x0a,0x00,0x1f,
-0x20,0x00,0xa0,0x1a,0x7b,0x10,0x0a,0x59,0x10,0x2b,0x40,0x99,0x2a,0xf2,0x0d,0x30,
-0x00,0x05,0x5a,0x66,0x99,0x0c,0x09,0x0a,0x0a,0x7e,0x09,0x0a,0x0a,0x4a,0x09,0x0a,
-0x0a,0x0a,0x09,0x1a,0x0a,0x0a,0x3d,0x7a,0x5b,0x0a,0x00,0x02,0x00,0x01,0x01,0x00,
-0xf2,0x0f,0x0a,0x22,0xa0,0x00,0x05,0x68,0x2a,0x00,0x00,0xd1,0xca,0xea,0xa0,0x7f,
-0x29,0x0a,0x00,0x06,0xa0,0x10,0xa0,0x00,0x0a,0x3a,0xae,0xaa,0x30,0xa0,0x00,0xa0,
-0x28,0x00,0x24,0xa0,0x00,0x08,0x02,0xf6,0x41,0x22,0x00,0x03,0x00,0x0a,0x68,0xba,
-0x70,0x04,0xa1,0x19,0x00,0x02,0xd9,0x00,0x90,0x00,0x43,0x9a,0xad,0xaa,0x60,0x19,
-0x00,0x90,0x00,0x01,0x90,0x09,0x00,0x00,0x19,0x11,0xa2,0x10,0x01,0x96,0x88,0x88,
-0x40,0x00,0x40,0x10,0x20,0x00,0x29,0x0a,0x17,0x20,0x0a,0x13,0x90,0x28,0x05,0xf1,
-0xd1,0x00,0x85,0x5a,0x26,0xbc,0x9b,0x30,0xa0,0x06,0x40,0xa0,0x0a,0x00,0xa1,0x19,
-0x00,0xa0,0x38,0x02,0x70,0x0a,0x19,0x05,0xb3,0x57,0x02,0xf2,0x19,0x05,0x50,0xa7,
-0x30,0x00,0xb0,0x0a,0x09,0x00,0x59,0x35,0xd8,0xa6,0x2d,0x97,0x6c,0x23,0x12,0x39,
-0x00,0xa1,0xb0,0x01,0x90,0x07,0xc2,0x00,0x19,0x00,0x9a,0x02,0x01,0x92,0xa5,0xb0,
-0x90,0x19,0x71,0x03,0xc7,0x2e,0x00,0xf3,0x18,0x60,0x05,0x00,0x00,0x37,0x9a,0xc9,
-0x90,0x0b,0x10,0x82,0x00,0x07,0xf4,0x9e,0xa9,0x94,0x6a,0x01,0xa0,0x00,0x00,0xa0,
-0x3a,0xac,0xa0,0x0a,0x00,0x21,0xb1,0x00,0xa0,0x05,0xe3,0x00,0x0a,0x00,0x03,0x90,
-0xac,0x2b,0xf1,0x08,0x05,0x00,0x01,0x80,0x47,0x00,0x08,0x2c,0xaa,0x99,0x2f,0x0a,
-0x00,0x0a,0xac,0x0a,0x00,0x0a,0x0a,0x0d,0xaa,0xaa,0x0a,0x08,0x00,0x60,0x99,0x9a,
-0x0a,0x0a,0x00,0x09,0x24,0x00,0x20,0x00,0x29,0xf0,0x00,0xe0,0x29,0xaa,0xaa,0x07,
-0xe1,0x24,0x04,0x40,0x49,0x11,0x80,0x72,0x00,0x91,0x1c,0x00,0xf2,0x27,0x10,0xa0,
-0xa0,0x00,0x93,0x88,0x9c,0x82,0x09,0x11,0x11,0x11,0x00,0x00,0x30,0x00,0x24,0x00,
-0x38,0x69,0xac,0x40,0x0a,0x1a,0x00,0x90,0x05,0xf0,0x90,0x0a,0x00,0x8a,0x0b,0x99,
-0xd9,0x30,0xa0,0x90,0x09,0x00,0x0a,0x09,0x00,0x90,0x00,0xa0,0xa0,0x86,0x56,0x0a,
-0x0c,0x83,0x5b,0x20,0x7a,0x00,0x10,0x13,0x56,0x00,0xf1,0x06,0xb0,0x00,0x09,0x4a,
-0xac,0xaa,0x25,0xf1,0x00,0xa0,0x00,0x79,0x10,0x0a,0x00,0x00,0x91,0x89,0xe9,0x90,
-0x09,0x09,0x00,0xf0,0x1d,0x00,0xa0,0x00,0x09,0x49,0x99,0x99,0x30,0x01,0x80,0x09,
-0x00,0x00,0x65,0x00,0x90,0x00,0x0d,0x5a,0xae,0xaa,0x37,0xf0,0x09,0xe5,0x00,0x5a,
-0x02,0x7a,0xa0,0x00,0xa0,0xa1,0x95,0x70,0x0a,0x88,0x9d,0x9a,0x40,0xa0,0x00,0x90,
-0x00,0xa6,0x00,0x01,0x16,0x04,0x50,0x00,0x38,0xaa,0xaa,0xa4,0x43,0x04,0x81,0x06,
-0xe0,0x99,0xa0,0xa0,0x5a,0x0a,0x09,0x56,0x02,0x71,0xa0,0x0a,0x0b,0x88,0x0a,0x00,
-0xa0,0xff,0x03,0xf1,0x0b,0x05,0xa9,0x00,0x00,0x40,0x20,0x00,0x00,0x19,0x0b,0x00,
-0x00,0x09,0x25,0xbe,0xaa,0x45,0xf2,0xb0,0xa0,0x00,0x79,0x32,0x0e,0x99,0x20,0x72,
-0x00,0x42,0x10,0x0e,0x99,0x30,0x09,0x00,0x18,0x0a,0xd9,0x03,0x01,0x3e,0x00,0x60,
-0x59,0xbb,0xeb,0xb3,0x00,0xd0,0x09,0x01,0xf6,0x37,0xe0,0xd9,0xd9,0xd0,0x06,0xa0,
-0x90,0xa0,0xa0,0x00,0xa0,0xa9,0xd8,0x80,0x00,0xa0,0x86,0x70,0x00,0x00,0xa0,0x1e,
-0x91,0x00,0x00,0xa4,0xa2,0x29,0xa2,0x02,0x50,0x00,0x05,0x40,0x86,0xcb,0x72,0x54,
-0x0c,0x09,0x10,0x95,0x46,0xe0,0xba,0x89,0x54,0x4a,0x46,0x46,0x95,0x40,0x96,0x7a,
-0x29,0x54,0x09,0x00,0xc0,0x75,0x40,0x90,0x74,0x00,0x54,0x09,0x38,0x00,0x5b,0x20,
-0x5e,0x00,0xf0,0x16,0x0a,0x09,0x00,0x06,0x60,0xa0,0x90,0x00,0xd2,0xae,0xad,0xa3,
-0x9f,0x00,0xa0,0x90,0x05,0xa0,0x0a,0x09,0x00,0x0a,0x3a,0xca,0xca,0x40,0xa0,0x05,
-0x04,0x00,0x0a,0x09,0x50,0x39,0x00,0xa2,0x80,0x45,0x04,0x00,0xfd,0x08,0xf6,0x18,
-0x40,0x00,0x04,0x40,0x96,0x97,0x97,0x44,0x0c,0x43,0x78,0x84,0x48,0xc4,0x38,0x88,
-0x44,0x38,0x43,0x88,0x84,0x40,0x84,0x47,0x88,0x44,0x08,0x14,0x63,0x34,0x40,0x80,
-0x76,0x40,0x44,0x08,0x45,0x07,0x2a,0x5f,0x00,0xf3,0x18,0x19,0x17,0x7a,0x50,0x07,
-0xaa,0xb0,0xa7,0x20,0xd0,0x09,0x0a,0x13,0x7f,0x59,0xd9,0xd9,0x47,0xa0,0x09,0x09,
-0x41,0x0a,0x16,0xe9,0x99,0x00,0xa4,0x5a,0x0a,0x40,0x0a,0x00,0x96,0xc4,0x80,0xa1,
-0x97,0x60,0xd8,0x05,0x00,0x48,0x05,0xe0,0x28,0xb9,0x99,0xc0,0x0b,0x1a,0x00,0x0a,
-0x07,0xe0,0x99,0xc9,0x90,0x6a,0xe7,0x02,0xf5,0x03,0xa4,0x9c,0xfc,0x93,0x0a,0x01,
-0xab,0xa0,0x00,0xa2,0xb2,0xa2,0xb1,0x0a,0x41,0x0a,0x02,0x30,0xc5,0x01,0xf1,0x10,
-0x46,0x01,0x90,0x00,0x0b,0x38,0x88,0x88,0x26,0xe0,0x68,0x88,0x50,0x5a,0x05,0x66,
-0x64,0x00,0x90,0x12,0x22,0x10,0x09,0x0b,0x88,0x8a,0x00,0x90,0x90,0x00,0x90,0x09,
-0x00,0xf2,0x6b,0x00,0x40,0x04,0x00,0x00,0x56,0x08,0xb8,0x81,0x0c,0x05,0xb6,0x2a,
-0x06,0xf4,0x61,0xbd,0x20,0x6a,0x49,0x83,0x57,0x50,0xa4,0x46,0x74,0x30,0x0a,0x44,
-0x48,0x64,0x20,0xa1,0x11,0x38,0x80,0x0a,0x01,0xb7,0x20,0x00,0x00,0x30,0x05,0x00,
-0x00,0x57,0x99,0xd9,0x95,0x0b,0x46,0x21,0x03,0x04,0xe3,0x67,0x69,0xd4,0x5a,0x38,
-0xd1,0x09,0x00,0x93,0x89,0x44,0x90,0x09,0x44,0x90,0x79,0x00,0x98,0x19,0x00,0x90,
-0x09,0x70,0x90,0x68,0x00,0x00,0x50,0x06,0x00,0x00,0x38,0x99,0xd9,0x92,0x0b,0x12,
-0x50,0x44,0x06,0xf0,0x08,0x0a,0x10,0x5a,0x29,0x99,0x99,0x40,0xa0,0x59,0x99,0x60,
-0x0a,0x08,0x10,0x0a,0x00,0xa0,0x89,0x88,0xa0,0x0a,0x08,0x21,0x1a,0xbe,0x04,0xf2,
-0x14,0x38,0xaa,0x79,0x53,0x0a,0x09,0x16,0x95,0x36,0xd4,0xa8,0x99,0x53,0x49,0x00,
-0xa0,0x95,0x30,0x93,0x8d,0x89,0x53,0x09,0x00,0xa3,0x35,0x30,0x94,0xad,0x90,0x53,
-0x09,0x32,0x00,0x6b,0x30,0x01,0xf1,0x0d,0x09,0x00,0xb0,0x00,0x04,0x89,0x9d,0x99,
-0x20,0xc1,0x13,0xa2,0x20,0x6f,0x09,0x55,0x5a,0x04,0xa0,0x97,0x77,0xa0,0x09,0x09,
-0x77,0x7a,0x00,0x90,0x09,0x00,0x70,0x00,0x09,0x00,0x94,0xd9,0x99,0xd4,0xd1,0x00,
-0xf1,0x11,0x02,0x88,0x8d,0x87,0x0b,0x19,0x00,0x09,0x7f,0x0d,0x99,0x98,0x5a,0x0c,
-0x9a,0xaa,0x0a,0x0c,0x47,0x78,0x0a,0x3a,0xac,0xcc,0x0a,0x67,0x47,0x78,0x0a,0x74,
-0x47,0x7a,0x39,0x03,0xf3,0x90,0x19,0x88,0xb9,0x86,0x09,0x22,0x87,0x79,0x04,0xf0,
-0x3a,0x77,0xc0,0x5a,0x05,0x55,0x55,0x40,0x92,0x93,0x33,0x39,0x09,0x02,0x8c,0x97,
-0x00,0x90,0x00,0x72,0x00,0x09,0x00,0x6b,0x10,0x00,0x00,0x74,0x28,0x16,0x00,0x65,
-0x29,0x82,0x90,0x0d,0x2c,0x99,0x99,0x86,0xf1,0x95,0x55,0x57,0x6a,0x00,0x44,0x43,
-0x00,0xa3,0xab,0xca,0xa7,0x0a,0x00,0xb1,0x36,0x00,0xa0,0x88,0x46,0xe1,0x0a,0x09,
-0x76,0x44,0x70,0x02,0x60,0x05,0x33,0x10,0x84,0x94,0xba,0xa0,0x0b,0x04,0x05,0x66,
-0x06,0xd8,0x77,0xbd,0xa3,0x69,0x09,0x1c,0x30,0x00,0x90,0x9a,0xc8,0xc0,0x09,0x09,
-0x1b,0x6c,0x00,0x91,0xe4,0xc8,0xd0,0x09,0x01,0x09,0x09,0x00,0x00,0x40,0x50,0x00,
-0x00,0x28,0x6a,0x97,0x00,0x09,0x7e,0x8c,0x99,0x04,0xf2,0x90,0x90,0x90,0x7b,0x07,
-0xe9,0x88,0x00,0xa2,0x96,0xa6,0x80,0x0a,0x17,0x7b,0x85,0x00,0xa1,0x59,0x83,0xa2,
-0x0a,0x36,0x4a,0x00,0x20,0x06,0x04,0x00,0x9f,0x06,0xf0,0x14,0x30,0x00,0x1a,0xae,
-0xaa,0xaa,0x60,0x06,0x60,0x1a,0x10,0x05,0xe9,0xaa,0xbc,0x10,0x11,0xb0,0xa1,0x21,
-0x00,0x0b,0x0a,0x10,0x10,0x08,0x50,0xa1,0x0a,0x0a,0x70,0x06,0xaa,0x70,0x10,0xb9,
-0x06,0x00,0x0a,0x03,0x41,0x93,0x0a,0x06,0x60,0x17,0x08,0x81,0x02,0x0a,0x02,0x00,
-0x6a,0xae,0xad,0xaa,0xc0,0x11,0xd1,0x00,0x46,0x0a,0x00,0x00,0x1b,0x00,0xa0,0x20,
-0x5b,0x20,0x0a,0xab,0x93,0x05,0x00,0x1f,0x05,0x51,0x01,0x99,0x9d,0xa9,0x95,0xd1,
-0x08,0xf2,0x0c,0x2c,0x99,0x99,0x90,0x02,0x70,0x00,0x09,0x00,0x1a,0xe9,0xda,0x60,
-0x00,0x0b,0x0a,0x00,0x00,0x08,0x60,0xa0,0x09,0x2b,0x60,0x07,0xaa,0x70,0x52,0x08,
-0x00,0x04,0x00,0x10,0xb0,0xb2,0x07,0x10,0xb0,0x22,0x09,0xf2,0x07,0x50,0x00,0x00,
-0x07,0x5b,0x00,0x00,0x00,0xc0,0x57,0x00,0x00,0xa4,0x00,0xb2,0x01,0x94,0x00,0x01,
-0xc3,0x33,0x00,0x4f,0x08,0x00,0xaf,0x10,0xf2,0x00,0x70,0x00,0x00,0x39,0x06,0x80,
-0x00,0x99,0x00,0x04,0xb3,0x34,0x99,0xd9,0x95,0x42,0x09,0x31,0x89,0xd9,0x94,0x42,
-0x09,0xd0,0x09,0x99,0xda,0x99,0x50,0x00,0x01,0x02,0x00,0x00,0x07,0x50,0x58,0x56,
-0x00,0xe0,0xa3,0x01,0xc2,0x18,0x01,0xc2,0x23,0x08,0x40,0x02,0x30,0x02,0xa0,0x34,
-0xba,0x0e,0x60,0xb2,0x00,0x9d,0xaa,0xaa,0xb0,0x5f,0x05,0xe6,0x10,0x01,0x40,0x00,
-0x60,0x00,0x0a,0x10,0x74,0x00,0x3a,0xba,0xae,0xa9,0xf6,0x03,0x31,0x8a,0xaa,0xaa,
-0x21,0x01,0x54,0x07,0xaa,0xaa,0xaa,0xa2,0x1e,0x03,0xb0,0x41,0x00,0x05,0x60,0x0b,
-0x00,0x06,0xac,0xac,0xca,0x10,0xe4,0x08,0x10,0x19,0x69,0x00,0xe1,0x11,0x2d,0xa1,
-0x10,0x00,0x1b,0x46,0x80,0x00,0x7c,0x30,0x06,0xc5,0x04,0x3e,0x0c,0xa0,0x90,0x00,
-0x90,0x05,0xce,0xbb,0xce,0xb0,0x00,0x90,0xbb,0x04,0xf0,0x30,0x88,0x99,0x00,0x00,
-0xc6,0x67,0x90,0x00,0x0a,0x22,0x39,0x00,0x7a,0xba,0x9a,0xb9,0x20,0x5a,0x30,0x88,
-0x20,0x55,0x00,0x00,0x17,0x00,0x00,0xd8,0x88,0xa7,0x00,0x0c,0x77,0x79,0x70,0x00,
-0xc8,0x88,0x97,0x00,0x0b,0x33,0x36,0x70,0x00,0xb4,0x44,0x77,0x02,0x9b,0xb9,0xab,
-0xa7,0x03,0xa5,0x01,0x98,0x11,0x71,0x00,0x00,0x35,0x00,0xd2,0x01,0xf0,0x12,0x89,
-0xda,0xd9,0x50,0x0a,0x09,0x09,0x19,0x00,0xc8,0xd8,0xc9,0x90,0x0a,0x1a,0x29,0x29,
-0x00,0xa0,0x90,0x91,0x90,0x8a,0xba,0xab,0xaa,0x40,0x5b,0x20,0x6a,0x30,0x56,0x00,
-0x90,0x07,0xf0,0x07,0x80,0x00,0x71,0x01,0x8b,0xb8,0x9d,0x84,0x01,0x1b,0x1b,0x11,
-0x00,0x58,0xd8,0xd8,0xb0,0x29,0x9d,0x9d,0x9d,0x60,0x04,0x05,0xe0,0x06,0xbf,0x8e,
-0xc6,0x00,0x4a,0xb0,0xa8,0x70,0x27,0x0a,0x0a,0x04,0x70,0x2c,0x01,0x00,0x04,0x00,
-0xf0,0x04,0xea,0xae,0xaa,0xd2,0xa0,0x0a,0x00,0x72,0xa0,0x2d,0x50,0x72,0xa0,0xb1,
-0x85,0x72,0xab,0x30,0x09,0x83,0x08,0xf2,0x19,0x72,0xa0,0x00,0x0a,0xb1,0x0b,0x9b,
-0x5b,0xb6,0x00,0xa0,0xa5,0x53,0x60,0x0a,0x0a,0x55,0x36,0x08,0xda,0xdc,0xbb,0xc3,
-0x0a,0x0a,0x63,0x36,0x00,0x90,0xa8,0x13,0x60,0x54,0x0a,0xa0,0x36,0x09,0x08,0x97,
-0x3a,0x4f,0x07,0xf0,0x0e,0x0d,0x9b,0x99,0x99,0xa0,0x72,0x80,0x00,0x07,0x00,0x6b,
-0x99,0x95,0x00,0x0a,0x75,0x55,0x40,0x00,0x22,0x22,0x3b,0x00,0x99,0x99,0x93,0xa0,
-0x00,0x00,0x82,0x12,0x33,0x03,0x9b,0x20,0x76,0x08,0x10,0x0a,0x53,0x0b,0xf2,0x0f,
+0x75,0x10,0x09,0x0a,0x07,0xd0,0x18,0xf8,0xff,0xff,0xff,0xff,0xff,0x47,0x72,0x1f,
+0xb5,0x21,0x51,0x2f,0x50,0x4d,0x5a,0x4d,0x5b,0x4d,0x5d,0x4d,0x5e,0x4d,0x7a,0x4d,
+0x7d,0x4d,0x82,0x4d,0x89,0x4d,0x8a,0x4d,0x8b,0x4d,0x99,0x4d,0x9b,0x4d,0x9c,0x4d,
+0xa0,0x4d,0xa8,0x4d,0xdc,0x4d,0xde,0x4d,0xf4,0x4d,0xfb,0x4d,0xfe,0x4d,0x15,0x4e,
+0x1b,0x4e,0x1e,0x4e,0x26,0x4e,0x35,0x4e,0x3a,0x4e,0x40,0x4e,0x46,0x4e,0x4b,0x4e,
+0x4d,0x4e,0x60,0x4e,0x70,0x4e,0x7f,0x4e,0x9d,0x4e,0x9e,0x4e,0x9f,0x4e,0xa3,0x4e,
+0xa5,0x4e,0xac,0x4e,0xcf,0x4e,0xdb,0x4e,0xeb,0x4e,0xf7,0x4e,0x14,0x4f,0x2d,0x4f,
+0x31,0x4f,0x3e,0x4f,0x3f,0x4f,0x5d,0x4f,0x62,0x4f,0x8c,0x4f,0x9f,0x4f,0xac,0x4f,
+0xcf,0x4f,0xf8,0x4f,0x1f,0x50,0x95,0x50,0x99,0x50,0x9b,0x50,0xb5,0x50,0xb8,0x50,
+0xbc,0x50,0xc0,0x50,0xc3,0x50,0xc6,0x50,0xc7,0x50,0xc8,0x50,0xcc,0x50,0xd5,0x50,
+0xdc,0x50,0xe9,0x50,0x02,0x51,0x16,0x51,0x1f,0x51,0x30,0x51,0x4a,0x51,0x4b,0x51,
+0x4d,0x51,0x56,0x51,0x57,0x51,0x67,0x51,0x6b,0x51,0x6d,0x51,0x70,0x51,0x79,0x51,
+0x7b,0x51,0x80,0x51,0x86,0x51,0x87,0x51,0x89,0x51,0x9d,0x51,0xbf,0x51,0xef,0x51,
+0xf0,0x51,0xf8,0x51,0x55,0x52,0x58,0x52,0x66,0x52,0x89,0x52,0x8a,0x52,0x97,0x52,
+0x9a,0x52,0x9f,0x52,0xa5,0x52,0xb1,0x52,0xbb,0x52,0xd2,0x52,0xdb,0x52,0xef,0x52,
+0x12,0x53,0x19,0x53,0x1a,0x53,0x1c,0x53,0x1d,0x53,0x21,0x53,0x26,0x53,0x28,0x53,
+0x30,0x53,0x33,0x53,0x3a,0x53,0x3f,0x53,0x40,0x53,0x43,0x53,0x47,0x53,0x58,0x53,
+0x5c,0x53,0x5d,0x53,0x5e,0x53,0x61,0x53,0x67,0x53,0x76,0x53,0x7b,0x53,0x7f,0x53,
+0x9a,0x53,0xb8,0x53,0xcd,0x53,0xdc,0x53,0x1d,0x54,0xb8,0x55,0x2e,0x56,0x30,0x56,
+0x44,0x56,0x4a,0x56,0x4d,0x56,0x4e,0x56,0x56,0x56,0x78,0x56,0x80,0x56,0x90,0x56,
+0x97,0x56,0xa7,0x56,0xdb,0x56,0x4a,0x57,0xbb,0x57,0xee,0x57,0x40,0x58,0x57,0x58,
+0x5d,0x58,0x66,0x58,0x6a,0x58,0x77,0x58,0x79,0x58,0x7a,0x58,0x81,0x58,0x89,0x58,
+0xcd,0x58,0x1b,0x59,0xa0,0x5a,0xa7,0x5a,0xa8,0x5a,0xb6,0x5a,0xd3,0x5a,0xd9,0x5a,
+0xdc,0x5a,0xea,0x5a,0xee,0x5a,0x09,0x5b,0x0d,0x5b,0x48,0x5b,0x49,0x5b,0x4c,0x5b,
+0x54,0x5b,0x56,0x5b,0x5f,0x5b,0x8a,0x5b,0x8e,0x5b,0x90,0x5b,0x9f,0x5b,0xa5,0x5b,
+0x35,0x5d,0x36,0x5d,0x3e,0x5d,0x42,0x5d,0x53,0x5d,0x5c,0x5d,0x76,0x5d,0x77,0x5d,
+0x88,0x5d,0x8d,0x5d,0x95,0x5d,0xa5,0x5d,0xc3,0x5d,0xc6,0x5d,0xdf,0x5d,0xe4,0x5d,
+0xf6,0x5d,0x46,0x5e,0x4a,0x5e,0x50,0x5e,0x52,0x5e,0x5f,0x5e,0x65,0x5e,0x81,0x5e,
+0x89,0x5e,0x8a,0x5e,0xa3,0x5e,0xa5,0x5e,0xb2,0x5e,0xc1,0x5e,0xd4,0x5e,0xd5,0x5e,
+0xd8,0x5e,0xfa,0x5e,0xfe,0x5e,0x07,0x5f,0x13,0x5f,0x15,0x5f,0x27,0x5f,0x3b,0x5f,
+0x4d,0x5f,0x51,0x5f,0x70,0x5f,0x75,0x5f,0x8b,0x5f,0xb2,0x5f,0xbf,0x5f,0xfc,0x5f,
+0x15,0x60,0x5f,0x60,0x6f,0x60,0xb2,0x60,0x5f,0x61,0x60,0x61,0x66,0x61,0x7a,0x61,
+0x90,0x61,0x97,0x61,0x9b,0x61,0xa3,0x61,0xb7,0x61,0xb9,0x61,0xbb,0x61,0xbc,0x61,
+0xce,0x61,0xf4,0x61,0xf5,0x61,0x19,0x62,0x22,0x62,0x2f,0x62,0x38,0x62,0x39,0x62,
+0x4e,0x62,0x51,0x62,0x57,0x62,0x59,0x62,0x7f,0x62,0xb2,0x62,0xbe,0x62,0xc7,0x62,
+0xe2,0x62,0xf5,0x62,0xf7,0x62,0xf8,0x62,0x1f,0x63,0x20,0x63,0x22,0x63,0x44,0x63,
+0x97,0x63,0xc8,0x63,0xfd,0x63,0x1d,0x64,0x36,0x64,0x7f,0x64,0x86,0x64,0x89,0x64,
+0x8e,0x64,0x95,0x64,0x98,0x64,0x9f,0x64,0xa1,0x64,0xa9,0x64,0xc0,0x64,0xc4,0x64,
+0xd7,0x64,0xec,0x64,0xfd,0x64,0xff,0x64,0x00,0x65,0x09,0x65,0x1b,0x65,0x30,0x65,
+0x35,0x65,0x46,0x65,0x5e,0x65,0x6f,0x65,0x70,0x65,0x7f,0x65,0x8e,0x65,0xbe,0x65,
+0xbf,0x65,0xd2,0x65,0x42,0x66,0x44,0x66,0x4f,0x66,0x50,0x66,0x59,0x66,0x6f,0x66,
+0x7a,0x66,0x7c,0x66,0x8a,0x66,0x96,0x66,0xb1,0x66,0xb5,0x66,0xcf,0x66,0xd1,0x66,
+0xec,0x66,0x14,0x67,0x35,0x67,0x57,0x67,0x5f,0x67,0x71,0x67,0x87,0x67,0x8c,0x67,
+0x96,0x67,0x10,0x68,0x71,0x69,0x7a,0x69,0x77,0x6a,0xb2,0x6a,0xb3,0x6a,0xb4,0x6a,
+0xb5,0x6a,0xcb,0x6a,0xda,0x6a,0x05,0x6b,0x24,0x6b,0x84,0x6b,0xb0,0x6b,0xf1,0x6b,
+0x09,0x6c,0x0f,0x6c,0x25,0x6c,0x32,0x6c,0x38,0x6c,0x6b,0x6c,0x82,0x6c,0x8b,0x6c,
+0x91,0x6c,0x9b,0x6c,0xd8,0x6c,0x47,0x6d,0x4b,0x6d,0x55,0x6d,0x60,0x6d,0x79,0x6d,
+0x88,0x6d,0xce,0x6d,0xe0,0x6d,0x21,0x6e,0x2a,0x6e,0x2e,0x6e,0x31,0x6e,0x34,0x6e,
+0x10,0x6f,0xbb,0x6f,0xbf,0x6f,0xc5,0x6f,0x09,0x70,0x76,0x70,0x86,0x70,0xd4,0x70,
+0x7c,0x71,0x97,0x71,0x98,0x71,0xa9,0x71,0xc9,0x71,0x06,0x72,0xd7,0x72,0xff,0x72,
+0x00,0x73,0x3d,0x73,0x56,0x73,0xae,0x73,0x6f,0x74,0x78,0x74,0x85,0x74,0x9c,0x74,
+0xb5,0x74,0xcd,0x75,0xd4,0x75,0x1a,0x76,0x21,0x76,0x26,0x76,0x28,0x76,0x3e,0x76,
+0x44,0x76,0x48,0x76,0x5b,0x76,0x6f,0x76,0xfc,0x76,0x35,0x77,0x51,0x77,0xbc,0x77,
+0xbe,0x77,0x8a,0x78,0xd1,0x78,0x0b,0x79,0x22,0x79,0x3f,0x79,0x40,0x79,0x4b,0x79,
+0x5b,0x79,0x83,0x79,0xca,0x79,0xd1,0x79,0xe7,0x79,0x2e,0x7a,0x3f,0x7a,0x7c,0x7a,
+0x99,0x7a,0xce,0x7a,0xe7,0x7a,0xf1,0x7a,0xcb,0x7b,0xe8,0x7b,0x0e,0x7c,0x4b,0x7c,
+0x77,0x7c,0x7f,0x7c,0xf2,0x7d,0xf7,0x7d,0x05,0x7e,0x0f,0x7e,0x13,0x7e,0x14,0x7e,
+0x16,0x7e,0x18,0x7e,0x1f,0x7e,0x21,0x7e,0x23,0x7e,0x2d,0x7e,0x2f,0x7e,0x3d,0x7e,
+0x4f,0x7e,0x63,0x7e,0x66,0x7e,0x79,0x7e,0xbe,0x7e,0xde,0x7e,0x4b,0x7f,0x4c,0x7f,
+0x55,0x7f,0x67,0x7f,0x76,0x7f,0xa4,0x7f,0x1c,0x80,0x4d,0x80,0x59,0x80,0x6a,0x80,
+0x3a,0x81,0x43,0x81,0x7a,0x81,0x85,0x81,0xc2,0x81,0xd2,0x81,0x41,0x82,0x53,0x82,
+0xc7,0x82,0x2c,0x83,0x54,0x83,0x8d,0x83,0xb1,0x83,0x2d,0x84,0x1f,0x85,0x52,0x86,
+0x0a,0x87,0x9c,0x87,0xb5,0x87,0xb8,0x87,0xc0,0x87,0xfb,0x87,0x15,0x88,0xcf,0x88,
+0xd1,0x88,0xd6,0x88,0x14,0x89,0x16,0x89,0x18,0x89,0x22,0x89,0x33,0x89,0x36,0x89,
+0x50,0x89,0xb6,0x8a,0xf1,0x8a,0xf4,0x8a,0xfe,0x8a,0x00,0x8b,0x0e,0x8b,0x0f,0x8b,
+0x11,0x8b,0x25,0x8b,0x2d,0x8b,0x32,0x8b,0x36,0x8b,0x3d,0x8b,0x3f,0x8b,0x44,0x8b,
+0x47,0x8b,0x4b,0x8b,0x53,0x8b,0x81,0x8b,0x6f,0x8c,0x75,0x8c,0x84,0x8c,0xc7,0x8c,
+0xd5,0x8c,0x03,0x8d,0x2d,0x8d,0x2f,0x8d,0x3f,0x8d,0x43,0x8d,0x7a,0x8d,0xfb,0x8d,
+0xb6,0x8e,0xbc,0x8e,0xbe,0x8e,0xc4,0x8e,0xcd,0x8e,0xd3,0x8e,0xe1,0x8e,0xe3,0x8e,
+0x09,0x8f,0x17,0x8f,0x20,0x8f,0x2b,0x8f,0x2e,0x8f,0x2f,0x8f,0x40,0x8f,0x50,0x8f,
+0x56,0x8f,0x59,0x8f,0x6a,0x8f,0x6f,0x8f,0x8b,0x8f,0xa3,0x8f,0xb5,0x8f,0x38,0x90,
+0x9d,0x90,0x17,0x91,0x1a,0x91,0x1d,0x91,0x1f,0x91,0xc4,0x91,0xd8,0x93,0xef,0x93,
+0xfe,0x93,0x51,0x94,0x69,0x94,0x7e,0x94,0xac,0x94,0xcf,0x94,0x38,0x95,0x3d,0x95,
+0x3e,0x95,0x42,0x95,0x44,0x95,0x84,0x95,0x86,0x95,0x90,0x95,0x94,0x95,0x9d,0x95,
+0xa0,0x95,0xb4,0x95,0xc7,0x95,0xdf,0x95,0xe4,0x95,0xec,0x95,0x16,0x96,0x46,0x96,
+0x50,0x96,0x57,0x96,0xa9,0x96,0xae,0x96,0xb2,0x96,0x39,0x97,0x43,0x97,0xc5,0x97,
+0xc6,0x97,0xc9,0x97,0xca,0x97,0xcb,0x97,0xd4,0x97,0xe1,0x97,0xe8,0x97,0xec,0x97,
+0x2e,0x98,0xd8,0x98,0xc1,0x99,0xc6,0x99,0xce,0x99,0xdc,0x99,0x28,0x9a,0x73,0x9d,
+0xf6,0x9d,0x28,0x9e,0xa0,0x9e,0x51,0xef,0x58,0xef,0x5b,0xef,0x5c,0xef,0x5d,0xef,
+0x61,0xef,0x63,0xef,0x65,0xef,0x69,0xef,0x6c,0xef,0x71,0xef,0x76,0xef,0x77,0xef,
+0x78,0xef,0x8e,0xef,0x93,0xef,0x98,0xef,0x9b,0xef,0x9c,0xef,0x9d,0xef,0xa1,0xef,
+0xa2,0xef,0xa3,0xef,0xa4,0xef,0xb7,0xef,0xb8,0xef,0xbe,0xef,0xc0,0xef,0xc1,0xef,
+0xc4,0xef,0xc7,0xef,0xc8,0xef,0xc9,0xef,0xcb,0xef,0xe3,0xef,0xe5,0xef,0x14,0xf0,
+0x15,0xf0,0x17,0xf0,0x19,0xf0,0x30,0xf0,0x37,0xf0,0x3a,0xf0,0x43,0xf0,0x6c,0xf0,
+0x74,0xf0,0xab,0xf0,0x3b,0xf1,0x90,0xf1,0x91,0xf1,0x92,0xf1,0x93,0xf1,0x94,0xf1,
+0xd7,0xf1,0xe3,0xf1,0x3d,0xf2,0x54,0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0x00,0x01,
+0x00,0x2f,0xfd,0x00,0x01,0x00,0x03,0x1b,0xf8,0x08,0x00,0x00,0x01,0x00,0xce,0xfc,
+0xfc,0x00,0xff,0xfc,0x00,0xfa,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x4e,0x01,0x01,
+0x00,0x02,0x16,0x00,0x2f,0xf4,0x00,0x01,0x00,0x15,0x1e,0xf0,0x1e,0x00,0x0e,0x90,
+0x00,0xb1,0xfc,0x00,0xff,0x00,0x00,0xf7,0xff,0xfa,0xfb,0x00,0xf9,0x11,0x00,0x00,
+0x0f,0x00,0x4d,0xff,0xff,0xfc,0xfe,0x92,0x00,0x30,0xfe,0x00,0xfe,0x2e,0x00,0x1e,
+0x00,0x01,0x00,0x1c,0xfe,0x0a,0x00,0x19,0xff,0x1f,0x00,0x03,0x0e,0x00,0x13,0xf9,
+0x0b,0x00,0x10,0xfe,0x02,0x00,0x2f,0xfd,0xfe,0x9c,0x00,0x0a,0x15,0x01,0x3c,0x00,
+0x11,0xff,0x34,0x00,0x39,0xff,0xfe,0xfe,0xd6,0x00,0x35,0xf4,0x00,0xed,0x24,0x00,
+0x20,0xfe,0xff,0x20,0x00,0x4e,0x00,0x00,0xfe,0xfe,0x44,0x00,0x10,0xfe,0x08,0x00,
+0x0f,0x6b,0x00,0x08,0x1f,0xfe,0x43,0x01,0x0d,0x1b,0xfc,0x25,0x00,0x12,0xfe,0x67,
+0x00,0x22,0xfe,0xfd,0x09,0x01,0x14,0xe8,0x6c,0x00,0x97,0xfb,0x00,0x00,0xed,0xfc,
+0xf4,0xf6,0x00,0xef,0x08,0x02,0x25,0xf7,0xfa,0x0c,0x00,0x75,0xe9,0x00,0x00,0x00,
+0xf6,0x00,0xf2,0x48,0x01,0x21,0xff,0xff,0x0c,0x01,0x1f,0x01,0xf7,0x01,0x01,0x10,
+0xfd,0xd2,0x00,0x0f,0x99,0x00,0x0c,0x3e,0xfa,0x00,0xff,0x69,0x02,0x03,0x12,0x00,
+0xb1,0xf1,0xf0,0x00,0x00,0xfa,0xfe,0xef,0xff,0x01,0x00,0x01,0x60,0x00,0xd3,0xf8,
+0xf9,0x00,0xf8,0xf9,0xfb,0xf8,0x00,0xf9,0xfb,0xfc,0xfb,0xfc,0x1a,0x01,0x66,0xf0,
+0xfd,0x00,0x00,0xfb,0xff,0x2b,0x01,0x62,0xfd,0xfd,0x00,0x00,0xfd,0xfe,0x4c,0x01,
+0x22,0x00,0x01,0x24,0x00,0x22,0xf7,0xfc,0x51,0x00,0x13,0x01,0x24,0x00,0x23,0xfe,
+0xfe,0x6c,0x01,0x08,0xa1,0x01,0x14,0xfd,0x20,0x01,0x15,0x01,0x51,0x01,0x02,0xb0,
+0x01,0x04,0x30,0x01,0xe0,0x01,0xfd,0xf1,0xfc,0x00,0x00,0xf9,0xfe,0xf9,0xff,0x01,
+0xf9,0x01,0x01,0x92,0x00,0xe6,0xfb,0xfb,0xfe,0xfd,0xfb,0xfd,0xfc,0xfe,0xfd,0xff,
+0x00,0xfe,0xfe,0x01,0xc5,0x00,0x2a,0x01,0xfe,0x34,0x02,0x0c,0xf8,0x01,0x09,0x19,
+0x00,0x1e,0x00,0x01,0x00,0x1f,0xfb,0x31,0x01,0x09,0x1f,0xff,0xf0,0x01,0x10,0x11,
+0xff,0x97,0x01,0x0e,0x5f,0x00,0x0f,0x4f,0x00,0x07,0x0f,0x1d,0x00,0x0a,0x1e,0x01,
+0xdd,0x01,0x19,0x01,0x81,0x00,0x12,0x01,0x14,0x03,0x0f,0x01,0x00,0x22,0x0b,0x81,
+0x00,0x1f,0xf6,0xd8,0x00,0x10,0x00,0x8e,0x00,0x1c,0xf7,0x31,0x02,0x20,0xff,0x01,
+0x4b,0x00,0x10,0x04,0x2b,0x02,0x0f,0x6f,0x00,0x15,0x1b,0x01,0xc4,0x04,0x02,0xa7,
+0x03,0x1d,0x01,0x14,0x01,0x1f,0xf7,0xd8,0x00,0x24,0x1f,0xff,0x24,0x00,0x26,0x0f,
+0x3d,0x00,0x07,0x03,0x49,0x05,0x30,0x02,0x03,0x00,0xed,0x00,0x2d,0x04,0x05,0x21,
+0x00,0xf1,0x0c,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,
+0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,
+0xff,0x0d,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,
+0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x00,0x01,0x00,
+0xff,0xff,0xae,0x02,0x1c,0x03,0x20,0x03,0x02,0x17,0x03,0x4b,0x06,0x07,0x06,0x08,
+0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,
+0x00,0xf1,0x08,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,
+0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,
+0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x73,
+0x00,0x02,0x1f,0x24,0x16,0x03,0xff,0xff,0x91,0x50,0x00,0x00,0x00,0x00,0x00,0xf4,
+0xbd,0x49,0x39,0x38,0x38,0x26,0x00,0x28,0x66,0x66,0x55,0x11,0x10,0x00,0x90,0xa0,
+0x00,0xa0,0x90,0x1a,0xdb,0xc4,0x02,0x76,0x30,0x4c,0xbd,0xa0,0x08,0x1a,0x00,0x0a,
+0x0a,0x00,0x00,0x70,0x00,0x6e,0x70,0x2b,0x09,0x53,0xb0,0x23,0x08,0xc5,0x00,0x01,
+0xb5,0x65,0x04,0x81,0xc9,0xc2,0x00,0xa0,0x00,0x2a,0x80,0x00,0x07,0x19,0x0a,0x00,
+0x72,0x96,0x50,0x01,0x87,0xa0,0x00,0x00,0x83,0x98,0x00,0x28,0x63,0x72,0x02,0x02,
+0xaa,0x00,0x08,0xb9,0x00,0x0d,0x0b,0x00,0x0c,0x6b,0x00,0x09,0xe0,0x00,0x59,0x68,
+0x91,0x75,0x0a,0xc0,0x1a,0x9b,0xc3,0x81,0x80,0x10,0x00,0x20,0x38,0x0b,0x02,0x90,
+0x57,0x06,0x60,0x57,0x01,0xb0,0x0a,0x10,0x19,0x00,0x00,0x20,0x07,0x40,0x0c,0x00,
+0x93,0x06,0x60,0x57,0x06,0x50,0xa2,0x1a,0x08,0x20,0x00,0x00,0x06,0x40,0x8b,0xa7,
+0x0b,0xa0,0x34,0x61,0x00,0xa0,0x00,0x0d,0x00,0x8c,0xfc,0x90,0x0d,0x00,0x00,0xd0,
+0x00,0x75,0x92,0x10,0x9a,0x30,0x37,0x00,0x74,0x00,0xb0,0x03,0x70,0x09,0x10,0x0a,
+0x00,0x55,0x00,0xa0,0x00,0x0a,0xba,0x04,0x80,0x75,0x75,0x04,0x88,0x50,0x48,0x75,
+0x04,0x74,0x80,0x75,0x0a,0xba,0x00,0x05,0xc3,0x27,0xa3,0x00,0x93,0x02,0x00,0xf1,
+0x5c,0x1a,0xbb,0x07,0x50,0x85,0x10,0x08,0x40,0x02,0xb0,0x00,0xc2,0x00,0xb3,0x00,
+0x6e,0xbb,0x70,0x0b,0xba,0x06,0x50,0x84,0x00,0x09,0x30,0x3c,0xa0,0x00,0x08,0x56,
+0x40,0x76,0x1b,0xaa,0x00,0x00,0x2f,0x00,0x0a,0xe0,0x03,0x8d,0x00,0xb1,0xd0,0x57,
+0x0d,0x09,0xbb,0xf9,0x00,0x0d,0x00,0x0c,0xcc,0x60,0xc0,0x00,0x0e,0xba,0x10,0x30,
+0x68,0x00,0x02,0xa3,0x90,0x48,0x09,0xbb,0x10,0x03,0xb8,0x00,0xb1,0x00,0x4c,0xa9,
+0x05,0xa0,0x76,0x66,0x03,0x93,0xa0,0x67,0x08,0xbb,0x00,0x7b,0xbc,0x90,0x00,0x83,
+0x00,0x0c,0x00,0x06,0x60,0x00,0xc1,0x00,0x39,0x00,0x0a,0x30,0x8c,0x00,0xf1,0x2a,
+0x85,0x39,0x09,0x30,0xbc,0xb0,0x58,0x07,0x66,0x60,0x57,0x0b,0xbb,0x10,0x0a,0xb9,
+0x06,0x60,0xa3,0x84,0x06,0x65,0x80,0x97,0x09,0xab,0x50,0x00,0xb1,0x07,0xb4,0x00,
+0x47,0x00,0x00,0x00,0x47,0x65,0x00,0x00,0x00,0x66,0x92,0x10,0x00,0x4a,0x4b,0x81,
+0x6b,0x50,0x00,0x7b,0x00,0x00,0x3b,0xbb,0x30,0x05,0x00,0xf1,0x50,0x59,0x10,0x00,
+0x3a,0x91,0x02,0x8b,0x25,0xb3,0x00,0x00,0x00,0x00,0x3c,0xc5,0x62,0x0d,0x00,0x2b,
+0x00,0xc2,0x05,0x70,0x00,0x00,0x05,0x50,0x00,0x79,0x99,0x20,0x07,0x40,0x00,0x90,
+0x19,0x06,0x94,0x26,0x54,0x28,0x28,0x09,0x72,0x73,0x37,0x08,0x63,0x82,0x56,0x17,
+0x36,0x3a,0x7a,0x91,0x0a,0x10,0x00,0x00,0x01,0x99,0x94,0x00,0x00,0x97,0x00,0x00,
+0xbb,0x00,0x04,0x68,0x20,0x0a,0x13,0x80,0x0e,0xbb,0xd0,0x56,0x00,0x83,0xb2,0x00,
+0x49,0x4e,0xbc,0x50,0x49,0x00,0xd0,0x49,0x01,0xb0,0x4d,0xbe,0x09,0x00,0xf0,0x17,
+0x00,0xd0,0x4e,0xbc,0x60,0x06,0xcb,0x80,0x2c,0x00,0xa3,0x67,0x00,0x11,0x76,0x00,
+0x00,0x67,0x00,0x11,0x2c,0x00,0xa3,0x05,0xbb,0x70,0x4e,0xbb,0x30,0x49,0x01,0xc0,
+0x49,0x00,0x94,0x49,0x00,0x75,0x06,0x00,0xf4,0x08,0x01,0xd0,0x4e,0xbc,0x30,0x4e,
+0xbb,0x84,0x90,0x00,0x49,0x00,0x04,0xeb,0xb4,0x49,0x00,0x04,0x90,0x00,0x4e,0xbb,
+0x90,0x12,0x00,0x21,0xdb,0xb2,0x12,0x00,0xf2,0x0c,0x49,0x00,0x00,0x05,0xcb,0x90,
+0x2c,0x00,0x84,0x67,0x00,0x00,0x76,0x09,0xb6,0x67,0x00,0x67,0x1c,0x00,0x77,0x05,
+0xcb,0xa1,0x49,0x00,0x3a,0x03,0x00,0x35,0x4e,0xbb,0xca,0x0c,0x00,0x03,0x01,0x00,
+0x53,0x00,0x09,0x40,0x00,0x94,0x05,0x00,0xf2,0x0b,0x4a,0x20,0xb2,0x3c,0xb8,0x00,
+0x49,0x01,0xc2,0x49,0x0b,0x40,0x49,0x96,0x00,0x4e,0xf3,0x00,0x4c,0x2d,0x00,0x49,
+0x06,0x90,0x49,0x00,0x72,0x00,0x06,0x05,0x00,0xf0,0x4b,0x4e,0xbb,0x70,0x4f,0x00,
+0x02,0xf1,0x4e,0x60,0x08,0xe1,0x49,0xb0,0x0c,0xb1,0x49,0xb1,0x48,0xb1,0x49,0x57,
+0xa2,0xb1,0x49,0x0c,0xc0,0xb1,0x49,0x09,0x60,0xb1,0x4d,0x00,0x2a,0x4f,0x70,0x2a,
+0x49,0xc1,0x2a,0x49,0x4a,0x2a,0x49,0x0a,0x7a,0x49,0x01,0xea,0x49,0x00,0x7a,0x05,
+0xcc,0x70,0x2c,0x00,0xa4,0x67,0x00,0x49,0x75,0x00,0x2a,0x67,0x00,0x49,0x2c,0x00,
+0xa4,0x05,0xcc,0x80,0x4e,0xbc,0x70,0x49,0x00,0xb2,0x49,0x00,0x84,0x49,0x00,0xc2,
+0x4e,0xbb,0x60,0x49,0x00,0xc5,0x00,0x10,0x06,0x2a,0x00,0xf1,0x0a,0xa3,0x66,0x00,
+0x48,0x85,0x00,0x39,0x76,0x00,0x48,0x2c,0x00,0xa4,0x06,0xcd,0xc0,0x00,0x00,0x85,
+0x00,0x00,0x00,0x4e,0xbc,0x60,0x43,0x01,0xfb,0x16,0xd0,0x4e,0xbe,0x30,0x49,0x0a,
+0x40,0x49,0x02,0xb0,0x49,0x00,0xb2,0x0a,0xbc,0x35,0x80,0x1d,0x4b,0x10,0x00,0x5d,
+0xb2,0x00,0x04,0xc8,0x60,0x0d,0x0a,0xbc,0x50,0x8b,0xeb,0xb1,0x00,0xb1,0x00,0x03,
+0x00,0x37,0x67,0x00,0x94,0x03,0x00,0xf3,0x4c,0x93,0x3a,0x00,0xc1,0x08,0xbc,0x60,
+0xb3,0x00,0x77,0x58,0x00,0xc1,0x0d,0x02,0xc0,0x0b,0x37,0x60,0x05,0x8d,0x10,0x00,
+0xeb,0x00,0x00,0xa6,0x00,0xa3,0x07,0x80,0x2a,0x66,0x0b,0xb0,0x57,0x2a,0x0b,0xa0,
+0x93,0x0c,0x38,0x64,0xc0,0x0b,0x83,0x28,0xc0,0x08,0xd0,0x0d,0x90,0x04,0xb0,0x0a,
+0x50,0x69,0x00,0xd1,0x0c,0x38,0x70,0x03,0xdd,0x00,0x00,0xd7,0x00,0x04,0xbd,0x00,
+0x0d,0x27,0x80,0x78,0x00,0xd2,0xb4,0x00,0xd1,0x3c,0x06,0x90,0x0a,0x4d,0x10,0x02,
+0xf8,0x00,0x00,0xc2,0x70,0x00,0x80,0x6b,0xbc,0xd0,0x00,0x09,0x50,0x00,0x3b,0x12,
+0x00,0xe3,0x07,0x70,0x00,0x2c,0x00,0x00,0x9d,0xbb,0xb0,0x4c,0x35,0x70,0x57,0x05,
+0x03,0x00,0xf2,0x03,0x4c,0x30,0xa2,0x00,0x48,0x00,0x0c,0x00,0x07,0x40,0x01,0xa0,
+0x00,0xb1,0x00,0x56,0xa9,0x1b,0x01,0x00,0xf0,0x0e,0xa9,0x04,0x10,0x0c,0x80,0x29,
+0xb0,0x83,0x74,0xab,0xbb,0x00,0x42,0x01,0xb0,0x0a,0xba,0x02,0x40,0xa3,0x09,0x9d,
+0x37,0x60,0xa3,0x3c,0xbb,0x40,0x66,0xe6,0x02,0xf2,0x32,0x6b,0xbb,0x16,0x80,0x67,
+0x66,0x03,0x96,0x80,0x67,0x6b,0xbb,0x10,0x0a,0xba,0x06,0x60,0x53,0x93,0x00,0x06,
+0x60,0x42,0x0a,0xaa,0x00,0x00,0x06,0x70,0x00,0x67,0x0b,0xbc,0x76,0x70,0x77,0x84,
+0x06,0x76,0x60,0x77,0x0a,0xab,0x70,0x09,0xba,0x06,0x70,0x84,0x9c,0xbb,0x56,0x60,
+0x10,0x0a,0xba,0x10,0x07,0xb1,0x0d,0x00,0x7e,0x80,0x0d,0x00,0x02,0x00,0x22,0x0b,
+0xbb,0x28,0x00,0xa2,0x70,0x77,0x0b,0xbc,0x60,0x20,0x85,0x1a,0xba,0x00,0x5e,0x00,
+0xf0,0x00,0xbc,0x16,0x80,0x85,0x66,0x07,0x56,0x60,0x75,0x66,0x07,0x50,0x46,0x00,
+0x58,0x01,0x00,0x34,0x04,0x50,0x00,0xb6,0x00,0x41,0x67,0x3d,0x30,0x67,0x67,0x00,
+0xd2,0x2c,0x16,0x8c,0x10,0x6e,0xc0,0x06,0x77,0x70,0x67,0x0b,0x30,0x58,0x01,0x00,
+0xc4,0x6b,0xbc,0x8b,0xb0,0x67,0x08,0x70,0x93,0x66,0x07,0x50,0x84,0x04,0x00,0x09,
+0x4f,0x00,0xf2,0x1d,0x0a,0xba,0x16,0x70,0x58,0x93,0x01,0xb6,0x60,0x58,0x0a,0xbb,
+0x00,0x6b,0xab,0x16,0x70,0x57,0x66,0x03,0x96,0x70,0x67,0x6c,0xab,0x16,0x60,0x00,
+0x66,0x00,0x00,0x0b,0xbb,0x66,0x70,0x76,0x84,0x06,0x66,0x70,0x76,0x0b,0xbc,0x60,
+0x8e,0x00,0xf3,0x0f,0x06,0xca,0x67,0x06,0x60,0x66,0x06,0x60,0x1b,0xb9,0x05,0x80,
+0x60,0x08,0xb7,0x04,0x30,0xb2,0x1b,0xba,0x00,0x1b,0x0a,0xe6,0x1b,0x01,0xb0,0x1b,
+0x00,0xc7,0x58,0x00,0xf0,0x31,0x55,0x70,0x85,0x1c,0xbc,0x50,0xb2,0x0c,0x05,0x71,
+0xa0,0x0b,0x65,0x00,0xac,0x00,0x04,0xa0,0x00,0xa1,0x1d,0x06,0x66,0x56,0xc2,0xa2,
+0x29,0xa4,0x7b,0x00,0xba,0x0c,0x90,0x09,0x60,0xa4,0x00,0x77,0x1c,0x00,0xca,0x40,
+0x06,0xd0,0x00,0xc9,0x40,0x76,0x0c,0x00,0xb2,0x0d,0x06,0x72,0xa0,0x1c,0x75,0x00,
+0xbd,0x00,0x05,0xa0,0x00,0x65,0xfa,0x03,0xf3,0x0d,0x6b,0xbf,0x00,0x09,0x60,0x04,
+0xa0,0x01,0xc1,0x00,0x8d,0xbb,0x10,0x02,0x90,0xa2,0x0c,0x00,0xc0,0x98,0x00,0xc0,
+0x0c,0x00,0xa2,0x02,0x90,0x36,0x01,0x00,0xf0,0x08,0x92,0x02,0xb0,0x0c,0x00,0xc0,
+0x07,0x90,0xc0,0x0c,0x02,0xb0,0x92,0x00,0x0a,0xa2,0x36,0x44,0x1a,0xb1,0x00,0x00,
+0x03,0x23,0x04,0xf0,0x0a,0xf4,0x00,0x09,0xaa,0xab,0xb3,0x00,0xb1,0x11,0x01,0xc2,
+0x0b,0x00,0x00,0x0a,0x40,0xdc,0xcc,0x88,0x60,0x00,0x00,0x1f,0x70,0x00,0xab,0x05,
+0xf5,0x25,0x00,0x02,0x00,0x00,0x00,0x9b,0x00,0x00,0x07,0x7e,0xaa,0xa6,0x69,0x01,
+0x11,0x2b,0x95,0x00,0x00,0x1b,0x0a,0x3c,0xcc,0xc9,0x00,0xbb,0x00,0x00,0x00,0x16,
+0x00,0x00,0x00,0x04,0x10,0x00,0x00,0x78,0xa2,0x00,0x09,0x60,0x0a,0x30,0x8e,0x70,
+0x1b,0xf2,0x00,0xc0,0x29,0x00,0x04,0x00,0x78,0xec,0xc8,0x00,0x00,0xab,0xb6,0x00,
+0x14,0x00,0xc0,0x7c,0xb0,0x1e,0xb2,0x1b,0x30,0x08,0x70,0x00,0xb5,0xa6,0x00,0xbc,
+0x03,0x02,0x01,0x00,0x10,0x08,0x49,0x00,0xf4,0x27,0xf4,0x00,0x00,0x00,0xd7,0xd0,
+0x00,0x00,0x5b,0x0b,0x50,0x00,0x0d,0x20,0x2d,0x00,0x06,0xa0,0x00,0xa6,0x00,0xef,
+0xff,0xff,0xe0,0x00,0x00,0x59,0x20,0x07,0x6b,0x4c,0x1d,0x67,0xd7,0xba,0x40,0xaf,
+0xb6,0xc0,0x0c,0x60,0xcc,0x10,0x20,0x1c,0x4b,0x00,0x0b,0x40,0x5d,0xcd,0x50,0x00,
+0x01,0x00,0xf3,0x38,0x03,0xdf,0xd4,0x10,0x05,0xa2,0xe2,0xa7,0x00,0xb1,0x01,0x01,
+0xb1,0x2b,0x00,0x00,0x0a,0x20,0xd1,0x00,0x00,0xc2,0x06,0xa1,0x01,0x89,0x00,0x06,
+0xaa,0xb8,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x8d,0xcc,0xc6,
+0x00,0x2d,0x0a,0x70,0x97,0x00,0xdb,0x5b,0x00,0xc1,0x0c,0x4a,0x00,0x09,0x30,0xc0,
+0x00,0x00,0xc1,0x04,0xa0,0x00,0x88,0x00,0x05,0xcc,0xd7,0x4e,0x00,0xf2,0x0b,0x33,
+0x33,0x20,0x3f,0xbb,0xd8,0x09,0x80,0x0b,0x10,0xa5,0x07,0x80,0x3c,0x98,0x60,0x0b,
+0x47,0xaa,0x00,0xa4,0x04,0x90,0x02,0xcc,0xb1,0x20,0x00,0xf3,0x0b,0x46,0x40,0x02,
+0x4c,0xfd,0x52,0x83,0x33,0x22,0x88,0x0c,0xcb,0x08,0x80,0x22,0x20,0x88,0x09,0x98,
+0x08,0x88,0x88,0x87,0x70,0x0b,0xfb,0x41,0x00,0xf2,0x6f,0x12,0x04,0x02,0xbf,0xeb,
+0xb8,0xe7,0x00,0x08,0x07,0x70,0x00,0x80,0x09,0x30,0x08,0x2b,0x10,0x00,0xb7,0xd7,
+0x00,0x03,0x02,0xbf,0xeb,0x00,0x00,0x12,0x00,0x13,0x33,0x33,0x18,0x8f,0x44,0x68,
+0x81,0x53,0xef,0xa8,0x5f,0x05,0xa9,0x81,0x60,0x00,0x78,0x4e,0x00,0x07,0x83,0xb0,
+0x00,0x78,0xaf,0x87,0x78,0x00,0x17,0x97,0x00,0x00,0x3e,0x7e,0x7c,0x10,0x0d,0x30,
+0xd2,0x3b,0x02,0xb0,0x0c,0x10,0xc0,0x39,0x1a,0x3b,0x5b,0x00,0xda,0x83,0x79,0xd0,
+0x06,0xe3,0x00,0xb4,0x00,0x05,0xcc,0xb4,0x00,0x08,0x80,0x00,0x00,0x94,0x4a,0x00,
+0x00,0xb0,0x0b,0x4b,0x80,0xa3,0x3a,0xef,0xf4,0x1e,0xfa,0xef,0xf2,0x85,0x8f,0xff,
+0xb0,0xb3,0xff,0xff,0xf2,0xed,0xee,0xee,0xe4,0x84,0x00,0x10,0x2a,0x05,0x00,0xf0,
+0x05,0x3a,0x00,0x00,0xcc,0xcc,0xec,0x10,0x07,0x99,0x99,0x97,0x00,0x1d,0xec,0xdd,
+0xd0,0x00,0x1b,0x30,0x00,0x1e,0x01,0x03,0xa8,0x00,0xf2,0x26,0x01,0x86,0x10,0x00,
+0x00,0x17,0x68,0x70,0x00,0x00,0x36,0x94,0x00,0x00,0x17,0xa2,0x00,0x01,0x95,0x69,
+0x10,0x00,0xd5,0x98,0x7b,0x00,0x0c,0x68,0x77,0xa0,0x00,0x1a,0x77,0x90,0x00,0x0a,
+0xaa,0x91,0x02,0xa2,0x28,0xc1,0x29,0x00,0xc9,0xa2,0x90,0x00,0x0b,0x29,0x00,0x00,
+0xb2,0x07,0x00,0xf2,0x19,0xb1,0xeb,0xbb,0xbb,0x00,0x37,0x30,0x00,0x00,0x37,0x17,
+0x85,0x00,0x08,0x00,0x02,0x45,0x01,0x90,0x26,0xb2,0x80,0x62,0xaa,0x82,0x09,0x06,
+0x10,0x5e,0x00,0x71,0x27,0x07,0x93,0x07,0x00,0x58,0x88,0x88,0x60,0x24,0x02,0xf2,
+0x0e,0x00,0xb3,0x80,0x00,0x32,0x3e,0x88,0x00,0x6a,0x8b,0x2b,0x20,0x0b,0x00,0x7b,
+0xc0,0x00,0xa0,0x00,0xb3,0x00,0x37,0x00,0x0b,0x30,0x04,0x60,0x00,0xb3,0x8c,0x00,
+0xf0,0x16,0x19,0x56,0x39,0x19,0x50,0x3e,0x33,0xe3,0x66,0x10,0x00,0x49,0x91,0x16,
+0xa7,0x05,0x40,0x00,0x6a,0xaa,0x00,0x00,0x00,0x48,0x00,0x08,0x90,0x00,0x40,0x4b,
+0xbb,0xbb,0xbb,0x90,0x00,0x00,0xa0,0xbd,0x00,0x22,0x00,0x00,0x09,0x00,0x2a,0x0e,
+0xaa,0x12,0x00,0x52,0x02,0x99,0xad,0x99,0x97,0xfb,0x00,0x60,0xaa,0xca,0xaa,0x70,
+0x00,0x0b,0x0b,0x00,0xc2,0xc6,0x00,0x00,0x00,0x0b,0x6c,0x30,0x00,0x00,0xb0,0x1a,
+0x00,0x12,0x00,0x21,0xb0,0x00,0x09,0x00,0xf6,0x0c,0x1a,0xaa,0xbc,0xaa,0x50,0x00,
+0x0b,0x40,0x00,0x00,0x07,0xf6,0x20,0x00,0x07,0x9a,0x2b,0x50,0x1b,0x80,0xa0,0x09,
+0x60,0x30,0x0a,0x00,0x02,0x56,0x00,0x00,0x01,0x00,0xf0,0x00,0xb1,0x11,0x11,0x00,
+0xd8,0x88,0x87,0x03,0x70,0x00,0x00,0x04,0xaa,0xaa,0xad,0x3e,0x00,0xc2,0x5a,0xaa,
+0xaa,0x1a,0x00,0x00,0x00,0x37,0x00,0x00,0x5a,0xb2,0x25,0x00,0x00,0xe3,0x00,0xf6,
+0x02,0x2e,0x10,0x00,0x00,0x1b,0x3b,0x20,0x00,0x6c,0x16,0x1b,0x50,0x58,0x00,0xa0,
+0x07,0x60,0xab,0x00,0x05,0x09,0x00,0x12,0x0b,0x04,0x00,0x80,0xda,0xae,0xaa,0xd1,
+0xa0,0x0b,0x00,0x81,0x04,0x00,0xa6,0xea,0xae,0xaa,0xd1,0x30,0x0b,0x00,0x20,0x00,
+0x0b,0x20,0x00,0xf1,0x0d,0x69,0x9e,0x99,0x60,0xa0,0x0b,0x00,0xb0,0x79,0x8d,0x88,
+0x80,0x88,0x8d,0x88,0x80,0xb1,0x1b,0x11,0xa1,0xd9,0x9e,0x99,0xd1,0x40,0x0b,0x00,
+0x30,0x24,0x00,0xf2,0x13,0xd9,0x99,0xb7,0x00,0x0a,0x28,0x02,0x70,0x00,0xa0,0x37,
+0x27,0x02,0xae,0xaa,0xab,0xd7,0x01,0x80,0x00,0x27,0x00,0x55,0x00,0x02,0x70,0x0b,
+0x10,0x00,0x27,0x03,0x60,0x00,0x8a,0x1c,0x03,0xf3,0x19,0x02,0x41,0x90,0x00,0x00,
+0x0b,0x19,0x00,0x00,0x29,0x9a,0xd9,0x99,0x00,0x11,0x57,0x11,0xa0,0x00,0x08,0x44,
+0x0a,0x00,0x00,0xb0,0xa0,0xb0,0x00,0x85,0x03,0x2b,0x00,0x59,0x00,0x00,0xb0,0x39,
+0x00,0x07,0xb6,0x0f,0x02,0x01,0x1d,0x02,0x90,0x50,0x00,0x08,0xaa,0xbc,0xaa,0x20,
+0x00,0x0a,0xd5,0x00,0x71,0xa1,0x00,0x00,0x4a,0xad,0xaa,0x90,0x09,0x00,0x00,0x12,
+0x00,0x51,0x29,0x99,0x99,0x99,0x70,0x29,0x00,0xa0,0x30,0x0a,0x01,0x80,0x04,0x60,
+0x61,0x74,0x00,0x0a,0x92,0x00,0x80,0x3a,0x09,0x30,0x00,0x00,0x6b,0x60,0x00,0xb1,
+0x09,0x60,0x00,0x6b,0x40,0x4c,0x60,0x45,0x82,0x09,0x30,0x00,0x00,0x40,0xd1,0x00,
+0xf0,0x29,0x10,0x00,0x0a,0xaa,0xba,0xa7,0x00,0x00,0x00,0x1c,0x20,0x00,0x00,0x0b,
+0x30,0x00,0x00,0x1a,0x40,0x00,0x00,0x3b,0x20,0x00,0x01,0xad,0x50,0x00,0x11,0x33,
+0x06,0x9a,0xa9,0x40,0x00,0x00,0x50,0x00,0x00,0x19,0xbc,0x99,0x40,0x01,0x80,0x00,
+0x46,0x00,0x18,0x00,0x59,0x10,0x01,0xc9,0x99,0x99,0x8f,0x00,0x50,0x55,0x39,0x99,
+0x99,0x86,0x46,0x00,0x53,0x72,0x00,0x00,0x02,0x9b,0x94,0x01,0xf2,0x40,0x02,0x44,
+0x00,0x7a,0x99,0x75,0x20,0x09,0x10,0x80,0x00,0x00,0xa0,0x0a,0x00,0x00,0x0b,0xaa,
+0xea,0xaa,0x30,0x03,0x0a,0x03,0x00,0x07,0x50,0xa0,0x57,0x03,0xa0,0x0a,0x00,0x93,
+0x20,0x0a,0xb0,0x01,0x20,0x00,0x01,0x24,0x61,0x00,0x68,0x7c,0x53,0x00,0x59,0x99,
+0xd9,0x99,0x10,0x05,0x1a,0x43,0x20,0x18,0xc1,0xa5,0xa4,0x04,0x7a,0x8e,0x7a,0xa1,
+0x00,0x56,0xa8,0x20,0x03,0xb7,0x0a,0x0a,0x80,0x52,0x00,0xa0,0x05,0x0f,0x03,0x5d,
+0x5a,0xaa,0xaa,0xa0,0x00,0x01,0x00,0xc0,0x2b,0xbb,0xbb,0xbb,0x80,0x06,0xaa,0xcb,
+0xaa,0x00,0x00,0x08,0x28,0x00,0x70,0x82,0x00,0x02,0xaa,0xad,0xba,0xa7,0x09,0x00,
+0x05,0x12,0x00,0x30,0x00,0x03,0xab,0x3e,0x01,0xf0,0x41,0x10,0x00,0x00,0x11,0x3a,
+0x11,0x10,0x59,0x99,0x99,0x99,0x10,0x2b,0x10,0x49,0x00,0x3b,0x51,0x05,0x4b,0x00,
+0x01,0x92,0xa0,0x00,0x00,0x06,0xd1,0x00,0x00,0x16,0xa7,0xb4,0x00,0x6a,0x40,0x01,
+0x6a,0x10,0x00,0x01,0x40,0x00,0x05,0x99,0x9b,0x99,0x91,0x04,0x87,0x77,0x80,0x00,
+0x75,0x22,0x2a,0x10,0x03,0x66,0x66,0x60,0x00,0x78,0x8b,0xd9,0x10,0x69,0x9a,0xe9,
+0x99,0x20,0x00,0x19,0x00,0x00,0x00,0x49,0x70,0x00,0x00,0x15,0x01,0xf2,0x15,0x06,
+0x99,0x9c,0x99,0x91,0x02,0x86,0x66,0x80,0x00,0x3b,0x77,0x7c,0x00,0x25,0x55,0x55,
+0x55,0x07,0x74,0x44,0x44,0xb0,0x10,0x4b,0x8c,0x11,0x00,0x09,0x20,0x81,0x41,0x4a,
+0x50,0x06,0xab,0xa9,0x00,0x10,0x23,0xa1,0x01,0xf6,0x14,0x7a,0xaa,0xa3,0x02,0xa0,
+0x90,0x08,0x21,0xd9,0x0a,0x00,0xa0,0x45,0x90,0x64,0x38,0x00,0x19,0x00,0xaa,0x00,
+0x01,0x90,0x0a,0x90,0x00,0x19,0x08,0x89,0x70,0x01,0x9a,0x50,0x06,0x80,0xb1,0x02,
+0xf3,0x12,0x3e,0x20,0x00,0x00,0x49,0x1b,0x30,0x02,0x98,0x00,0x09,0xa3,0x62,0x70,
+0x01,0x62,0x30,0x0b,0x00,0x18,0x00,0x00,0xc0,0x01,0x80,0x00,0x58,0x00,0x18,0x00,
+0x39,0x00,0x01,0x2c,0x00,0xf1,0x3e,0x0b,0x00,0x28,0x00,0x00,0xb0,0x04,0x60,0x00,
+0x0b,0x00,0x65,0x00,0x00,0xf5,0x09,0x70,0x00,0x37,0xb1,0xcb,0x00,0x08,0x32,0x98,
+0x73,0x01,0xb0,0x0c,0x21,0xb0,0x64,0x06,0x50,0x03,0x50,0x00,0x70,0x0a,0x00,0x00,
+0x47,0x30,0xa0,0x00,0x0c,0x2a,0x0a,0x28,0x06,0xf0,0xa7,0xe7,0xb0,0x8b,0x6e,0x3a,
+0x0a,0x00,0xa0,0xa0,0xa0,0xb0,0x0a,0x0a,0x02,0x47,0x30,0xa0,0xa0,0x00,0x55,0x0a,
+0x05,0xa9,0x9a,0x10,0x52,0x00,0xb1,0x70,0x40,0x09,0x10,0x0b,0x05,0x60,0xa0,0x00,
+0xb0,0x09,0x3e,0x02,0xf2,0x04,0xa0,0x00,0xb0,0x10,0x55,0x00,0x0b,0x99,0x1c,0x90,
+0x01,0xa2,0x1b,0x35,0x80,0x00,0x0a,0x30,0x07,0x29,0x00,0xf2,0x14,0x1a,0x51,0x80,
+0x60,0x08,0x39,0x19,0x1a,0x03,0xf0,0x55,0x02,0x80,0x9b,0x01,0xa0,0x83,0x00,0xa0,
+0x08,0x49,0x00,0x0a,0x00,0x1f,0x20,0x00,0xa0,0x1a,0x7b,0x10,0x0a,0x59,0x10,0x2b,
+0x46,0x06,0xf2,0x0e,0x50,0x30,0x00,0x05,0x5a,0x66,0x99,0x0c,0x09,0x0a,0x0a,0x7e,
+0x09,0x0a,0x0a,0x4a,0x09,0x0a,0x0a,0x0a,0x09,0x1a,0x0a,0x0a,0x3d,0x7a,0x5b,0x0a,
+0x00,0x02,0x00,0x01,0x01,0x00,0xf2,0x0f,0x0a,0x22,0xa0,0x00,0x05,0x68,0x2a,0x00,
+0x00,0xd1,0xca,0xea,0xa0,0x7f,0x29,0x0a,0x00,0x06,0xa0,0x10,0xa0,0x00,0x0a,0x3a,
+0xae,0xaa,0x30,0xa0,0x00,0xa0,0x28,0x00,0x24,0xa0,0x00,0x08,0x02,0xf6,0x41,0x22,
+0x00,0x03,0x00,0x0a,0x68,0xba,0x70,0x04,0xa1,0x19,0x00,0x02,0xd9,0x00,0x90,0x00,
+0x43,0x9a,0xad,0xaa,0x60,0x19,0x00,0x90,0x00,0x01,0x90,0x09,0x00,0x00,0x19,0x11,
+0xa2,0x10,0x01,0x96,0x88,0x88,0x40,0x00,0x40,0x10,0x20,0x00,0x29,0x0a,0x17,0x20,
+0x0a,0x13,0x90,0x28,0x05,0xf1,0xd1,0x00,0x85,0x5a,0x26,0xbc,0x9b,0x30,0xa0,0x06,
+0x40,0xa0,0x0a,0x00,0xa1,0x19,0x00,0xa0,0x38,0x02,0x70,0x0a,0x19,0x05,0xb3,0x57,
+0x02,0xf2,0x19,0x05,0x50,0xa7,0x30,0x00,0xb0,0x0a,0x09,0x00,0x59,0x35,0xd8,0xa6,
+0x2d,0x97,0x6c,0x23,0x12,0x39,0x00,0xa1,0xb0,0x01,0x90,0x07,0xc2,0x00,0x19,0x00,
+0x9a,0x02,0x01,0x92,0xa5,0xb0,0x90,0x19,0x71,0x03,0xc7,0x2e,0x00,0xf2,0x18,0x60,
+0x05,0x00,0x00,0x37,0x9a,0xc9,0x90,0x0b,0x10,0x82,0x00,0x07,0xf4,0x9e,0xa9,0x94,
+0x6a,0x01,0xa0,0x00,0x00,0xa0,0x3a,0xac,0xa0,0x0a,0x00,0x21,0xb1,0x00,0xa0,0x05,
+0xe3,0x00,0x0a,0x00,0x03,0x90,0x2d,0x00,0xf1,0x09,0x40,0x05,0x00,0x01,0x80,0x47,
+0x00,0x08,0x2c,0xaa,0x99,0x2f,0x0a,0x00,0x0a,0xac,0x0a,0x00,0x0a,0x0a,0x0d,0xaa,
+0xaa,0x0a,0x08,0x00,0x60,0x99,0x9a,0x0a,0x0a,0x00,0x09,0x24,0x00,0x20,0x00,0x29,
+0xf0,0x00,0xe0,0x29,0xaa,0xaa,0x07,0xe1,0x24,0x04,0x40,0x49,0x11,0x80,0x72,0x00,
+0x91,0x1c,0x00,0xf2,0x27,0x10,0xa0,0xa0,0x00,0x93,0x88,0x9c,0x82,0x09,0x11,0x11,
+0x11,0x00,0x00,0x30,0x00,0x24,0x00,0x38,0x69,0xac,0x40,0x0a,0x1a,0x00,0x90,0x05,
+0xf0,0x90,0x0a,0x00,0x8a,0x0b,0x99,0xd9,0x30,0xa0,0x90,0x09,0x00,0x0a,0x09,0x00,
+0x90,0x00,0xa0,0xa0,0x86,0x56,0x0a,0x0c,0x83,0x5b,0x20,0x7a,0x00,0x10,0x13,0x56,
+0x00,0xf1,0x06,0xb0,0x00,0x09,0x4a,0xac,0xaa,0x25,0xf1,0x00,0xa0,0x00,0x79,0x10,
+0x0a,0x00,0x00,0x91,0x89,0xe9,0x90,0x09,0x09,0x00,0xf0,0x1d,0x00,0xa0,0x00,0x09,
+0x49,0x99,0x99,0x30,0x01,0x80,0x09,0x00,0x00,0x65,0x00,0x90,0x00,0x0d,0x5a,0xae,
+0xaa,0x37,0xf0,0x09,0xe5,0x00,0x5a,0x02,0x7a,0xa0,0x00,0xa0,0xa1,0x95,0x70,0x0a,
+0x88,0x9d,0x9a,0x40,0xa0,0x00,0x90,0x00,0xa6,0x00,0x01,0x16,0x04,0x50,0x00,0x38,
+0xaa,0xaa,0xa4,0x43,0x04,0x81,0x06,0xe0,0x99,0xa0,0xa0,0x5a,0x0a,0x09,0x56,0x02,
+0x71,0xa0,0x0a,0x0b,0x88,0x0a,0x00,0xa0,0xff,0x03,0xf1,0x0b,0x05,0xa9,0x00,0x00,
+0x40,0x20,0x00,0x00,0x19,0x0b,0x00,0x00,0x09,0x25,0xbe,0xaa,0x45,0xf2,0xb0,0xa0,
+0x00,0x79,0x32,0x0e,0x99,0x20,0x72,0x00,0x42,0x10,0x0e,0x99,0x30,0x09,0x00,0x18,
+0x0a,0xd9,0x03,0x01,0x3e,0x00,0x60,0x59,0xbb,0xeb,0xb3,0x00,0xd0,0x09,0x01,0xf6,
+0x37,0xe0,0xd9,0xd9,0xd0,0x06,0xa0,0x90,0xa0,0xa0,0x00,0xa0,0xa9,0xd8,0x80,0x00,
+0xa0,0x86,0x70,0x00,0x00,0xa0,0x1e,0x91,0x00,0x00,0xa4,0xa2,0x29,0xa2,0x02,0x50,
+0x00,0x05,0x40,0x86,0xcb,0x72,0x54,0x0c,0x09,0x10,0x95,0x46,0xe0,0xba,0x89,0x54,
+0x4a,0x46,0x46,0x95,0x40,0x96,0x7a,0x29,0x54,0x09,0x00,0xc0,0x75,0x40,0x90,0x74,
+0x00,0x54,0x09,0x38,0x00,0x5b,0x20,0x5e,0x00,0xf0,0x16,0x0a,0x09,0x00,0x06,0x60,
+0xa0,0x90,0x00,0xd2,0xae,0xad,0xa3,0x9f,0x00,0xa0,0x90,0x05,0xa0,0x0a,0x09,0x00,
+0x0a,0x3a,0xca,0xca,0x40,0xa0,0x05,0x04,0x00,0x0a,0x09,0x50,0x39,0x00,0xa2,0x80,
+0x45,0x04,0x00,0xfd,0x08,0xf6,0x18,0x40,0x00,0x04,0x40,0x96,0x97,0x97,0x44,0x0c,
+0x43,0x78,0x84,0x48,0xc4,0x38,0x88,0x44,0x38,0x43,0x88,0x84,0x40,0x84,0x47,0x88,
+0x44,0x08,0x14,0x63,0x34,0x40,0x80,0x76,0x40,0x44,0x08,0x45,0x07,0x2a,0x5f,0x00,
+0xf3,0x18,0x19,0x17,0x7a,0x50,0x07,0xaa,0xb0,0xa7,0x20,0xd0,0x09,0x0a,0x13,0x7f,
+0x59,0xd9,0xd9,0x47,0xa0,0x09,0x09,0x41,0x0a,0x16,0xe9,0x99,0x00,0xa4,0x5a,0x0a,
+0x40,0x0a,0x00,0x96,0xc4,0x80,0xa1,0x97,0x60,0xd8,0x05,0x00,0x48,0x05,0xe0,0x28,
+0xb9,0x99,0xc0,0x0b,0x1a,0x00,0x0a,0x07,0xe0,0x99,0xc9,0x90,0x6a,0xe7,0x02,0xf5,
+0x03,0xa4,0x9c,0xfc,0x93,0x0a,0x01,0xab,0xa0,0x00,0xa2,0xb2,0xa2,0xb1,0x0a,0x41,
+0x0a,0x02,0x30,0xc5,0x01,0xf0,0x15,0x46,0x01,0x90,0x00,0x0b,0x38,0x88,0x88,0x26,
+0xe0,0x68,0x88,0x50,0x5a,0x05,0x66,0x64,0x00,0x90,0x12,0x22,0x10,0x09,0x0b,0x88,
+0x8a,0x00,0x90,0x90,0x00,0x90,0x09,0x0b,0x88,0x8a,0x00,0xf0,0x96,0x00,0x40,0x04,
+0x00,0x00,0x56,0x08,0xb8,0x81,0x0c,0x05,0xb6,0x2a,0x06,0xf4,0x61,0xbd,0x20,0x6a,
+0x49,0x83,0x57,0x50,0xa4,0x46,0x74,0x30,0x0a,0x44,0x48,0x64,0x20,0xa1,0x11,0x38,
+0x80,0x0a,0x01,0xb7,0x20,0x00,0x00,0x30,0x05,0x00,0x00,0x57,0x99,0xd9,0x95,0x0b,
+0x46,0x21,0x03,0x04,0xe3,0x67,0x69,0xd4,0x5a,0x38,0xd1,0x09,0x00,0x93,0x89,0x44,
+0x90,0x09,0x44,0x90,0x79,0x00,0x98,0x19,0x00,0x90,0x09,0x70,0x90,0x68,0x00,0x00,
+0x50,0x06,0x00,0x00,0x38,0x99,0xd9,0x92,0x0b,0x12,0x50,0x44,0x06,0xf0,0x08,0x0a,
+0x10,0x5a,0x29,0x99,0x99,0x40,0xa0,0x59,0x99,0x60,0x0a,0x08,0x10,0x0a,0x00,0xa0,
+0x89,0x88,0xa0,0x0a,0x08,0x21,0x1a,0x00,0x00,0x10,0x00,0x00,0x00,0x38,0xaa,0x79,
+0x53,0x0a,0x09,0x16,0x95,0x36,0xd4,0xa8,0x99,0x53,0x49,0x00,0xa0,0x95,0x30,0x93,
+0x8d,0x89,0x53,0x09,0x00,0xa3,0x35,0x30,0x94,0xad,0x90,0x53,0x09,0x32,0x00,0x6b,
+0x20,0x00,0x01,0x00,0xf1,0x0d,0x09,0x00,0xb0,0x00,0x04,0x89,0x9d,0x99,0x20,0xc1,
+0x13,0xa2,0x20,0x6f,0x09,0x55,0x5a,0x04,0xa0,0x97,0x77,0xa0,0x09,0x09,0x77,0x7a,
+0x00,0x90,0x09,0x00,0x70,0x00,0x09,0x00,0x94,0xd9,0x99,0xd4,0xd1,0x00,0xf2,0xb4,
+0x02,0x88,0x8d,0x87,0x0b,0x19,0x00,0x09,0x7f,0x0d,0x99,0x98,0x5a,0x0c,0x9a,0xaa,
+0x0a,0x0c,0x47,0x78,0x0a,0x3a,0xac,0xcc,0x0a,0x67,0x47,0x78,0x0a,0x74,0x47,0x7a,
+0x00,0x40,0x05,0x00,0x00,0x19,0x88,0xb9,0x86,0x09,0x22,0x87,0x79,0x04,0xf0,0x3a,
+0x77,0xc0,0x5a,0x05,0x55,0x55,0x40,0x92,0x93,0x33,0x39,0x09,0x02,0x8c,0x97,0x00,
+0x90,0x00,0x72,0x00,0x09,0x00,0x6b,0x10,0x00,0x00,0x74,0x28,0x16,0x00,0x65,0x29,
+0x82,0x90,0x0d,0x2c,0x99,0x99,0x86,0xf1,0x95,0x55,0x57,0x6a,0x00,0x44,0x43,0x00,
+0xa3,0xab,0xca,0xa7,0x0a,0x00,0xb1,0x36,0x00,0xa0,0x88,0x46,0xe1,0x0a,0x09,0x76,
+0x44,0x70,0x02,0x60,0x05,0x33,0x10,0x84,0x94,0xba,0xa0,0x0b,0x04,0x05,0x66,0x06,
+0xd8,0x77,0xbd,0xa3,0x69,0x09,0x1c,0x30,0x00,0x90,0x9a,0xc8,0xc0,0x09,0x09,0x1b,
+0x6c,0x00,0x91,0xe4,0xc8,0xd0,0x09,0x01,0x09,0x09,0x00,0x00,0x40,0x50,0x00,0x00,
+0x28,0x6a,0x97,0x00,0x09,0x7e,0x8c,0x99,0x04,0xf2,0x90,0x90,0x90,0x7b,0x07,0xe9,
+0x88,0x00,0xa2,0x96,0xa6,0x80,0x0a,0x17,0x7b,0x85,0x00,0xa1,0x59,0x83,0xa2,0x0a,
+0x36,0x4a,0x00,0xf5,0x00,0xf0,0x19,0x00,0x40,0x00,0x00,0x00,0x08,0x30,0x00,0x1a,
+0xae,0xaa,0xaa,0x60,0x06,0x60,0x1a,0x10,0x05,0xe9,0xaa,0xbc,0x10,0x11,0xb0,0xa1,
+0x21,0x00,0x0b,0x0a,0x10,0x10,0x08,0x50,0xa1,0x0a,0x0a,0x70,0x06,0xaa,0x70,0x4a,
+0x01,0xf2,0x1a,0x01,0x00,0xa0,0x00,0x00,0x93,0x0a,0x06,0x60,0x00,0xb0,0xa0,0xb0,
+0x00,0x02,0x0a,0x02,0x00,0x6a,0xae,0xad,0xaa,0x10,0x00,0x90,0xa0,0x00,0x00,0x46,
+0x0a,0x00,0x00,0x1b,0x00,0xa0,0x20,0x5b,0x20,0x0a,0xab,0x10,0x5a,0x00,0x80,0xa0,
+0x00,0x01,0x99,0x9d,0xa9,0x95,0x00,0x36,0x00,0xf1,0x0c,0x2c,0x99,0x99,0x90,0x02,
+0x70,0x00,0x09,0x00,0x1a,0xe9,0xda,0x60,0x00,0x0b,0x0a,0x00,0x00,0x08,0x60,0xa0,
+0x09,0x2b,0x60,0x07,0xaa,0x70,0x2c,0x00,0x10,0x01,0x04,0x00,0x50,0xb0,0x00,0x00,
+0x00,0x02,0x05,0x00,0xf0,0x2b,0x2e,0x50,0x00,0x00,0x07,0x5b,0x00,0x00,0x00,0xc0,
+0x57,0x00,0x00,0xa4,0x00,0xb2,0x01,0x94,0x00,0x01,0xc3,0x33,0x00,0x00,0x01,0x30,
+0x00,0x00,0x30,0x00,0x00,0x00,0x3c,0x70,0x00,0x00,0x39,0x06,0x80,0x00,0x99,0x00,
+0x04,0xb3,0x34,0x99,0xd9,0x95,0x60,0x00,0x0a,0x00,0x00,0x00,0x89,0xd9,0x94,0x00,
+0x09,0x00,0xd0,0x09,0x99,0xda,0x99,0x50,0x00,0x01,0x02,0x00,0x00,0x07,0x50,0x58,
+0x56,0x00,0xf0,0x08,0xa3,0x01,0xc2,0x18,0x01,0xc2,0x23,0x08,0x40,0x02,0x30,0x02,
+0xa0,0x34,0x00,0x00,0xb1,0x00,0xb2,0x00,0x9d,0xaa,0xaa,0x6a,0x00,0xf5,0x01,0x05,
+0x10,0x01,0x40,0x00,0x60,0x00,0x0a,0x10,0x74,0x00,0x3a,0xba,0xae,0xa9,0x00,0x01,
+0x00,0x31,0x8a,0xaa,0xaa,0x21,0x01,0x52,0x07,0xaa,0xaa,0xaa,0xa2,0x13,0x00,0xf0,
+0x03,0x30,0x00,0x41,0x00,0x05,0x60,0x0b,0x00,0x06,0xac,0xac,0xca,0x10,0x00,0x0a,
+0x10,0x00,0x19,0x69,0x00,0xf0,0x0c,0x11,0x2d,0xa1,0x10,0x00,0x1b,0x46,0x80,0x00,
+0x7c,0x30,0x06,0xc5,0x04,0x00,0x00,0x00,0x20,0x00,0x90,0x00,0x90,0x05,0xce,0xbb,
+0xce,0xb0,0x09,0x00,0xf0,0x32,0x00,0x0d,0x88,0x99,0x00,0x00,0xc6,0x67,0x90,0x00,
+0x0a,0x22,0x39,0x00,0x7a,0xba,0x9a,0xb9,0x20,0x5a,0x30,0x88,0x20,0x55,0x00,0x00,
+0x17,0x00,0x00,0xd8,0x88,0xa7,0x00,0x0c,0x77,0x79,0x70,0x00,0xc8,0x88,0x97,0x00,
+0x0b,0x33,0x36,0x70,0x00,0xb4,0x44,0x77,0x02,0x9b,0xb9,0xab,0xa7,0x03,0xa5,0x01,
+0x98,0x11,0x71,0x00,0x00,0x35,0x00,0xd2,0x01,0xf0,0x3e,0x89,0xda,0xd9,0x50,0x0a,
+0x09,0x09,0x19,0x00,0xc8,0xd8,0xc9,0x90,0x0a,0x1a,0x29,0x29,0x00,0xa0,0x90,0x91,
+0x90,0x8a,0xba,0xab,0xaa,0x40,0x5b,0x20,0x6a,0x30,0x56,0x00,0x00,0x18,0x00,0x00,
+0x80,0x00,0x71,0x01,0x8b,0xb8,0x9d,0x84,0x01,0x1b,0x1b,0x11,0x00,0x58,0xd8,0xd8,
+0xb0,0x29,0x9d,0x9d,0x9d,0x60,0x00,0xa0,0xa0,0xa0,0x06,0xbf,0x8e,0xc6,0x00,0x4a,
+0xb0,0xa8,0x70,0x27,0x0a,0x0a,0x04,0x70,0x2c,0x01,0x00,0x04,0x00,0xf1,0x31,0xea,
+0xae,0xaa,0xd2,0xa0,0x0a,0x00,0x72,0xa0,0x2d,0x50,0x72,0xa0,0xb1,0x85,0x72,0xab,
+0x30,0x09,0x92,0xa0,0x00,0x00,0x72,0xa0,0x00,0x0a,0xb1,0x0b,0x9b,0x5b,0xb6,0x00,
+0xa0,0xa5,0x53,0x60,0x0a,0x0a,0x55,0x36,0x08,0xda,0xdc,0xbb,0xc3,0x0a,0x0a,0x63,
+0x36,0x00,0x90,0xa8,0x13,0x60,0x54,0x0a,0xa0,0x36,0x09,0x08,0x97,0x3a,0x40,0x14,
+0x01,0xf2,0x14,0x0d,0x9b,0x99,0x99,0xa0,0x72,0x80,0x00,0x07,0x00,0x6b,0x99,0x95,
+0x00,0x0a,0x75,0x55,0x40,0x00,0x22,0x22,0x3b,0x00,0x99,0x99,0x93,0xa0,0x00,0x00,
+0x00,0x47,0x00,0x00,0x03,0x9b,0x68,0x02,0x10,0x23,0x73,0x00,0xf1,0x11,0xb0,0x00,
 0xa0,0x00,0x03,0x5a,0x9d,0x9a,0x30,0x00,0x90,0xa0,0x54,0x00,0x09,0x0a,0x05,0x40,
-0x27,0xd9,0xd9,0xc4,0x09,0x13,0x0a,0x01,0x12,0x90,0x00,0xa0,0x00,0x21,0x7d,0x07,
-0xf4,0x15,0x31,0x20,0x04,0x70,0x65,0x19,0x00,0x0a,0x2d,0x99,0xd9,0x30,0x0a,0xc3,
-0x3b,0x30,0x00,0x3a,0x44,0xc4,0x00,0x74,0xa9,0x9d,0x91,0x0b,0x0a,0x00,0xa0,0x05,
-0x60,0xa9,0x9d,0x95,0x00,0x09,0xcf,0x0d,0xf2,0x19,0x00,0x00,0x38,0x70,0x63,0x00,
-0x03,0x67,0x00,0x98,0x99,0xac,0x92,0x00,0x85,0x76,0x85,0x00,0x08,0x48,0x59,0x90,
-0x09,0x98,0x07,0xc5,0x02,0x79,0x78,0x9d,0x02,0x82,0x93,0x09,0x94,0x64,0x43,0x05,
-0x40,0xc2,0x2f,0x00,0x23,0xba,0xaa,0xba,0x07,0x00,0x89,0x00,0x10,0x0b,0x09,0x00,
-0x00,0x61,0x0c,0xd4,0x1a,0x00,0x0a,0x03,0x08,0x40,0x00,0xa0,0x94,0x90,0x00,0x0b,
-0xb6,0xca,0x08,0xf2,0x0e,0x00,0x40,0x0b,0x00,0x50,0x91,0x0b,0x00,0xb0,0x92,0x0b,
-0x00,0xb0,0x59,0x9e,0x99,0x60,0x80,0x0b,0x00,0x70,0xb0,0x0b,0x00,0xa1,0xea,0xae,
-0xaa,0xe1,0xf0,0x0a,0x10,0x91,0x34,0x04,0x61,0x10,0x00,0x05,0xaa,0xdb,0xaa,0x09,
-0x00,0xf5,0x03,0x1a,0xaa,0xdb,0xaa,0x60,0x21,0x09,0x10,0x40,0x06,0x40,0x91,0x0a,
-0x00,0x6c,0xad,0xba,0xc0,0x1e,0x0c,0xf1,0x0d,0x19,0x99,0xaf,0x40,0x20,0x03,0xa3,
-0x02,0xa7,0x1a,0x08,0x39,0xa1,0x5c,0xa4,0x09,0xa6,0x8b,0x3a,0x29,0xa3,0x5b,0x01,
-0x49,0xd9,0xa9,0x99,0xa9,0x7a,0x04,0x20,0x00,0x01,0x6e,0x0d,0xf0,0x04,0x74,0x00,
-0x03,0xa0,0x00,0xb1,0x02,0xc0,0x00,0x02,0xb1,0x57,0xae,0xaa,0xe4,0x10,0x00,0xb0,
-0x0a,0x45,0x01,0xa2,0xa0,0x00,0x1b,0x10,0x0b,0x00,0x4b,0x20,0x7a,0x70,0x33,0x06,
-0xf5,0x14,0x05,0xaa,0x9b,0x10,0xa2,0x21,0x80,0x90,0x8e,0x82,0x27,0x0a,0x00,0xa0,
-0x04,0x60,0xa0,0x0a,0x01,0x63,0x0a,0x00,0xca,0x5b,0x00,0xa0,0x07,0x05,0x70,0x0b,
-0x00,0x02,0x90,0x5b,0x60,0x5f,0x06,0xf6,0x15,0x04,0xad,0xaa,0x21,0xa0,0x04,0x60,
-0x05,0x4a,0x00,0x9a,0xaa,0x54,0xa0,0x29,0x02,0x75,0x4a,0x03,0x49,0x93,0x54,0xa0,
-0x00,0x5b,0x03,0x3a,0x00,0x1b,0x20,0x00,0xa0,0x1b,0x20,0x00,0x7b,0xf6,0x02,0xf2,
-0x19,0x06,0x80,0x00,0x36,0x00,0xbb,0x20,0x83,0x60,0x84,0x1b,0x0a,0x36,0x58,0x00,
-0x65,0xa3,0x62,0xa8,0x9a,0x0a,0x36,0x0a,0x01,0x80,0xa3,0x60,0xa2,0x93,0x04,0x36,
-0x0a,0x00,0x54,0x03,0x60,0x79,0x9b,0x16,0xa4,0xb4,0x03,0x10,0x20,0xbb,0x00,0xf5,
-0x14,0x08,0xba,0xa8,0x29,0xab,0x0a,0x00,0xa0,0x08,0x40,0xa0,0x09,0x03,0xd9,0x1a,
-0x01,0x92,0xbd,0xb0,0xa0,0x28,0x11,0xa3,0x56,0x03,0x70,0x0a,0x0b,0x10,0x55,0x00,
-0xa5,0x62,0x9a,0x10,0xbf,0x0f,0xf5,0x14,0xdc,0x6a,0x85,0x80,0x08,0x96,0x28,0x78,
-0x02,0xab,0x96,0xa7,0x80,0x3b,0xba,0x7b,0x78,0x00,0x89,0x71,0x87,0x80,0x17,0x98,
-0x08,0x28,0x04,0x59,0x80,0x80,0x80,0x73,0xa8,0x66,0x3b,0x8b,0x00,0xf1,0x14,0x02,
-0x6c,0x60,0x0a,0x49,0xc2,0x04,0x2a,0x00,0x92,0x06,0x2a,0x48,0xe9,0x86,0x2a,0x02,
-0xfa,0x06,0x2a,0x0a,0xa3,0x86,0x2a,0x77,0x91,0x01,0x0a,0x20,0x91,0x00,0x0a,0x00,
-0x91,0x00,0x4d,0x0b,0xf4,0x16,0x80,0xd9,0x9a,0x02,0x18,0x09,0x00,0xa1,0x91,0x80,
+0x27,0xd9,0xd9,0xc4,0x09,0x13,0x0a,0x01,0x12,0x90,0x00,0xa0,0x00,0x21,0x9b,0x00,
+0xf3,0x16,0x00,0x31,0x20,0x04,0x70,0x65,0x19,0x00,0x0a,0x2d,0x99,0xd9,0x30,0x0a,
+0xc3,0x3b,0x30,0x00,0x3a,0x44,0xc4,0x00,0x74,0xa9,0x9d,0x91,0x0b,0x0a,0x00,0xa0,
+0x05,0x60,0xa9,0x9d,0x95,0x00,0x09,0xa6,0x01,0xf2,0x1a,0x03,0x00,0x00,0x38,0x70,
+0x63,0x00,0x03,0x67,0x00,0x98,0x99,0xac,0x92,0x00,0x85,0x76,0x85,0x00,0x08,0x48,
+0x59,0x90,0x09,0x98,0x07,0xc5,0x02,0x79,0x78,0x9d,0x02,0x82,0x93,0x09,0x94,0x64,
+0x43,0x05,0x40,0xc2,0x2f,0x00,0x54,0xba,0xaa,0xa0,0x00,0x0a,0x89,0x00,0x10,0x0b,
+0x09,0x00,0xf2,0x02,0xc0,0x00,0xa0,0x00,0x1a,0x00,0x0a,0x03,0x08,0x40,0x00,0xa0,
+0x94,0x90,0x00,0x0b,0xb6,0x29,0x00,0xf0,0x17,0x0b,0x00,0x00,0x40,0x0b,0x00,0x50,
+0x91,0x0b,0x00,0xb0,0x92,0x0b,0x00,0xb0,0x59,0x9e,0x99,0x60,0x80,0x0b,0x00,0x70,
+0xb0,0x0b,0x00,0xa1,0xea,0xae,0xaa,0xe1,0x00,0x00,0x00,0xa1,0x00,0x00,0x91,0x34,
+0x04,0x61,0x10,0x00,0x05,0xaa,0xdb,0xaa,0x09,0x00,0xf1,0x03,0x1a,0xaa,0xdb,0xaa,
+0x60,0x21,0x09,0x10,0x40,0x06,0x40,0x91,0x0a,0x00,0x6c,0xad,0xba,0xc0,0x69,0x01,
+0x00,0x01,0x00,0xf1,0x0d,0x19,0x99,0xaf,0x40,0x20,0x03,0xa3,0x02,0xa7,0x1a,0x08,
+0x39,0xa1,0x5c,0xa4,0x09,0xa6,0x8b,0x3a,0x29,0xa3,0x5b,0x01,0x49,0xd9,0xa9,0x99,
+0xa9,0x7a,0x04,0x00,0x01,0x03,0xf0,0x06,0x0a,0x20,0x74,0x00,0x03,0xa0,0x00,0xb1,
+0x02,0xc0,0x00,0x02,0xb1,0x57,0xae,0xaa,0xe4,0x10,0x00,0xb0,0x0a,0x45,0x01,0x92,
+0xa0,0x00,0x1b,0x10,0x0b,0x00,0x4b,0x20,0x7a,0x2c,0x03,0xf4,0x15,0x0a,0x05,0xaa,
+0x9b,0x10,0xa2,0x21,0x80,0x90,0x8e,0x82,0x27,0x0a,0x00,0xa0,0x04,0x60,0xa0,0x0a,
+0x01,0x63,0x0a,0x00,0xca,0x5b,0x00,0xa0,0x07,0x05,0x70,0x0b,0x00,0x02,0x90,0x5b,
+0x60,0xc7,0x02,0xf6,0x16,0x0a,0x04,0xad,0xaa,0x21,0xa0,0x04,0x60,0x05,0x4a,0x00,
+0x9a,0xaa,0x54,0xa0,0x29,0x02,0x75,0x4a,0x03,0x49,0x93,0x54,0xa0,0x00,0x5b,0x03,
+0x3a,0x00,0x1b,0x20,0x00,0xa0,0x1b,0x20,0x00,0x7b,0xf6,0x02,0xf2,0x19,0x06,0x80,
+0x00,0x36,0x00,0xbb,0x20,0x83,0x60,0x84,0x1b,0x0a,0x36,0x58,0x00,0x65,0xa3,0x62,
+0xa8,0x9a,0x0a,0x36,0x0a,0x01,0x80,0xa3,0x60,0xa2,0x93,0x04,0x36,0x0a,0x00,0x54,
+0x03,0x60,0x79,0x9b,0x16,0xa4,0xb4,0x03,0x10,0x20,0xbb,0x00,0xf3,0x14,0x08,0xba,
+0xa8,0x29,0xab,0x0a,0x00,0xa0,0x08,0x40,0xa0,0x09,0x03,0xd9,0x1a,0x01,0x92,0xbd,
+0xb0,0xa0,0x28,0x11,0xa3,0x56,0x03,0x70,0x0a,0x0b,0x10,0x55,0x00,0xa5,0x62,0x9a,
+0x10,0x5d,0x00,0xf5,0x16,0x08,0x00,0xdc,0x6a,0x85,0x80,0x08,0x96,0x28,0x78,0x02,
+0xab,0x96,0xa7,0x80,0x3b,0xba,0x7b,0x78,0x00,0x89,0x71,0x87,0x80,0x17,0x98,0x08,
+0x28,0x04,0x59,0x80,0x80,0x80,0x73,0xa8,0x66,0x3b,0x8b,0x00,0xf0,0x15,0x02,0x6c,
+0x60,0x0a,0x49,0xc2,0x04,0x2a,0x00,0x92,0x06,0x2a,0x48,0xe9,0x86,0x2a,0x02,0xfa,
+0x06,0x2a,0x0a,0xa3,0x86,0x2a,0x77,0x91,0x01,0x0a,0x20,0x91,0x00,0x0a,0x00,0x91,
+0x00,0xab,0x85,0x00,0xf4,0x16,0x80,0xd9,0x9a,0x02,0x18,0x09,0x00,0xa1,0x91,0x80,
 0xb8,0x88,0x19,0x18,0x02,0xb2,0x11,0x91,0x82,0x8d,0x8b,0x19,0x18,0x01,0x90,0xa1,
 0x61,0x80,0x74,0x0a,0x00,0x18,0x39,0x2a,0x50,0x5a,0x60,0x0e,0x01,0xf1,0x11,0x4a,
 0xc9,0x97,0x3a,0x08,0x17,0x36,0x3a,0x2c,0x88,0xa6,0x3a,0x00,0x81,0x06,0x3a,0x28,
 0xc9,0x86,0x3a,0x00,0x81,0x23,0x1a,0x05,0xce,0xb0,0x0a,0x58,0x40,0x00,0x9b,0x04,
-0x01,0xf4,0x14,0x90,0x00,0x09,0x3b,0xc7,0x52,0x6a,0x93,0xa3,0x22,0x6a,0x79,0xd9,
+0x01,0xf2,0x12,0x90,0x00,0x09,0x3b,0xc7,0x52,0x6a,0x93,0xa3,0x22,0x6a,0x79,0xd9,
 0x94,0x6a,0x25,0xb6,0x52,0x6a,0x56,0xb4,0xa2,0x6a,0x53,0x90,0x90,0x0a,0x53,0x95,
-0x90,0x0a,0x00,0x90,0x00,0x9b,0x9d,0x09,0xf3,0x13,0x40,0xd9,0x9c,0x43,0x54,0x0d,
-0x99,0xb4,0x95,0x40,0x90,0x30,0x09,0x54,0x0b,0x9d,0x93,0x95,0x40,0xb5,0x94,0x49,
-0x54,0x29,0x59,0x44,0x45,0x46,0x44,0x97,0x10,0x54,0x50,0x09,0x5d,0x06,0xf2,0x16,
-0x02,0x02,0x70,0x0a,0x09,0x8a,0x13,0x3a,0x05,0xaa,0x45,0x4a,0x35,0x62,0x35,0x4a,
-0x39,0xca,0x95,0x4a,0x05,0x76,0x25,0x4a,0x0a,0x73,0x91,0x0a,0x64,0x72,0x70,0x0a,
-0x02,0xa1,0x00,0x6c,0x00,0xca,0x0b,0xf5,0x16,0x32,0x00,0x16,0x71,0x1c,0x21,0x27,
-0x77,0x77,0x77,0x50,0x79,0x96,0x32,0x71,0x0a,0x34,0x85,0x48,0x10,0xa4,0x58,0x54,
-0x81,0x0a,0x89,0x85,0x48,0x10,0xa0,0x18,0x00,0x81,0x0a,0x09,0x60,0x7c,0x27,0x01,
-0xf4,0x16,0xa2,0x99,0x99,0x63,0x0a,0x09,0x88,0xb2,0xa0,0xa0,0xa4,0x49,0x2a,0x0a,
-0x03,0x44,0x40,0xa0,0xa0,0xc8,0xc9,0x8a,0x0a,0x0c,0x7c,0x78,0x50,0xa0,0xc8,0xc9,
-0x80,0x0a,0x09,0x00,0x18,0x4a,0x70,0xc9,0x08,0xb0,0x04,0xcd,0xb0,0xa0,0x00,0x00,
-0x90,0x8e,0xaa,0x70,0x09,0x5b,0x02,0xf3,0x05,0x90,0x0c,0x00,0xa0,0x0a,0x43,0x90,
-0x09,0x3b,0xc7,0x75,0x02,0x81,0x10,0x1b,0x00,0x46,0x00,0x0b,0x23,0xbd,0x05,0x02,
-0x8d,0x0e,0xf3,0x12,0x68,0x80,0x1a,0xda,0xa9,0x3a,0x10,0x18,0x0a,0x80,0x91,0x03,
-0x70,0xa8,0x09,0x10,0x55,0x19,0x80,0x91,0x08,0x32,0x78,0x09,0x10,0xb0,0x55,0xaa,
-0xd1,0x28,0x8b,0x18,0x09,0xdb,0x01,0x50,0x09,0x10,0x03,0x99,0x90,0x0f,0x03,0xf2,
-0x0e,0x6c,0x77,0x06,0xa9,0x94,0xb3,0xb0,0x09,0x10,0x0a,0x0a,0x00,0x90,0x90,0x90,
-0xa0,0x28,0x4c,0x28,0x0a,0x07,0xa6,0x5a,0x30,0xa0,0x00,0x00,0x95,0xa7,0x2c,0x00,
-0x30,0x14,0x00,0x00,0x28,0x04,0xf0,0x03,0x50,0x06,0x84,0x44,0x4c,0x02,0x9b,0x99,
-0x80,0xa0,0x00,0xa0,0x0a,0x0a,0x00,0x0d,0x99,0x90,0x94,0x03,0x30,0xa5,0x00,0x0a,
-0x78,0x00,0x60,0xaa,0xaa,0xab,0x60,0x00,0x52,0xbb,0x0f,0xf7,0x0f,0x99,0x99,0x94,
-0x09,0x30,0x10,0x04,0x76,0xb2,0x08,0x22,0x36,0x19,0x2a,0x90,0x94,0x60,0x91,0xaa,
-0x39,0x45,0x09,0x52,0x03,0x95,0x40,0x69,0x99,0x95,0x73,0xea,0x0d,0x00,0x1e,0x09,
-0xf0,0x12,0x70,0xa0,0x00,0x00,0xb0,0x0a,0x03,0x30,0x6b,0x00,0xa1,0xd1,0x2c,0xa0,
-0x0b,0xb5,0x02,0x2a,0x00,0xf6,0x00,0x00,0xa3,0xcb,0x00,0x00,0x0a,0x62,0xa0,0x07,
-0x00,0xa0,0x0b,0x05,0x0a,0xa3,0xba,0xb5,0xea,0xda,0xda,0xa6,0xa0,0xa0,0x90,0x00,
-0x04,0x00,0xf0,0x19,0x05,0xa7,0x50,0x86,0x77,0xa5,0x00,0x03,0x30,0xea,0xaa,0xaa,
-0xa5,0xd9,0x99,0x99,0x94,0xa3,0x10,0x08,0x10,0xa1,0xb2,0x48,0x00,0xa0,0x1b,0xb0,
-0x00,0xa0,0x1b,0xb2,0x00,0xa3,0xc2,0x1c,0x10,0xa5,0x10,0x02,0x20,0x00,0x12,0xa6,
-0x6a,0x00,0xf0,0x08,0x6b,0x0a,0x00,0x0a,0xd9,0x00,0xa0,0x00,0x14,0x60,0x0a,0x00,
-0x00,0x46,0x00,0xa0,0x02,0xab,0xca,0xae,0xa7,0x00,0x74,0x1f,0x0a,0x20,0x10,0x0a,
-0x3f,0x16,0x34,0xa0,0x02,0xa0,0x49,0x0c,0xf1,0x03,0x03,0x40,0xa0,0x07,0x00,0x0c,
-0x0a,0x05,0x70,0x00,0x71,0xa0,0x80,0x00,0x7a,0xae,0xaa,0xa2,0x84,0x10,0x4a,0xaa,
-0xae,0xaa,0xa7,0xf4,0x0f,0xf3,0x18,0x08,0x10,0x09,0x00,0x00,0x81,0x01,0xa1,0x00,
-0x5d,0xa5,0xad,0x9a,0x00,0x81,0x22,0x90,0xb1,0x08,0x1a,0x47,0x0b,0x80,0x83,0xa7,
-0x30,0x9a,0x08,0x33,0xa0,0x18,0x50,0x81,0x74,0x03,0x70,0x08,0x47,0x09,0x49,0x10,
-0xf1,0x02,0x41,0x00,0x41,0x00,0x02,0x90,0x2b,0x00,0x06,0xa8,0xd8,0x8c,0x00,0x6a,
-0x8d,0x88,0xd0,0x43,0x0c,0x96,0x38,0x8d,0x88,0x70,0x29,0x99,0xd9,0x99,0x70,0x4a,
-0x10,0x20,0x02,0x80,0xd5,0x09,0x00,0x09,0x00,0x21,0xd9,0x95,0x09,0x00,0xd0,0x7a,
-0xab,0xda,0xaa,0x20,0x00,0x29,0x20,0x00,0x00,0x02,0xa7,0xa4,0x88,0x0b,0xd0,0x40,
-0x00,0x02,0x90,0x00,0x00,0x09,0xab,0xca,0xac,0x00,0x00,0x28,0x9c,0x00,0x20,0x80,
-0x0a,0x09,0x00,0x51,0xb0,0x00,0x02,0x83,0xa8,0x32,0x00,0xe5,0x01,0x13,0x91,0x11,
-0x12,0x88,0x88,0x88,0x86,0x09,0xba,0xaa,0xaa,0x40,0xb4,0x00,0x18,0xb0,0x09,0x00,
-0x23,0x56,0x00,0xc1,0x11,0x55,0x0d,0xaa,0xac,0xaa,0x80,0x23,0x0d,0xf0,0x55,0xa6,
-0xaa,0xea,0xa3,0x09,0x00,0x0a,0x43,0x03,0x70,0x00,0xa0,0x70,0x74,0x88,0x8d,0x88,
-0x63,0x01,0x11,0x11,0x11,0x0b,0x99,0xac,0x99,0x40,0xa2,0x8b,0xb8,0x60,0x0a,0x47,
-0x22,0x2a,0x00,0xa4,0x95,0x55,0xb0,0x0a,0x39,0x8a,0x88,0x01,0x90,0x70,0xa5,0x10,
-0x55,0x94,0x0a,0x1a,0x06,0x15,0x29,0x70,0x32,0x00,0x05,0x01,0x00,0x00,0x19,0x51,
-0x98,0x00,0x07,0x9d,0x76,0x67,0x06,0x99,0xe9,0xa9,0x92,0x02,0xb1,0x65,0x90,0x06,
-0xa8,0x83,0x64,0xb2,0x10,0x69,0x81,0x60,0x00,0x03,0x47,0x93,0x00,0x04,0x85,0x10,
-0x00,0x00,0x1a,0x97,0x01,0xf2,0x60,0x36,0x22,0x05,0x50,0x00,0xa0,0xa2,0xa0,0x00,
-0x04,0x70,0x66,0x00,0x00,0x08,0x79,0x00,0x00,0x00,0x7d,0x70,0x00,0x05,0xb5,0x05,
-0xb7,0x15,0x60,0x00,0x00,0x43,0x2a,0xea,0xae,0x20,0x00,0x0b,0x20,0xb0,0x00,0x00,
-0xb8,0x0b,0xac,0x00,0x0a,0xa0,0x02,0x80,0x02,0x83,0xa0,0xa2,0x00,0x93,0x07,0xc5,
-0x00,0x59,0x06,0xb8,0xb6,0x03,0x04,0x50,0x00,0x52,0x4a,0xab,0x6b,0xab,0x20,0x00,
-0xa3,0x70,0x90,0x1a,0x1a,0x09,0x0a,0x00,0x4c,0x60,0xa4,0x60,0x00,0xc5,0x05,0xd0,
-0x00,0x39,0xb0,0x7d,0x00,0x2b,0x03,0x89,0x29,0x14,0x20,0x16,0x00,0x24,0x00,0x00,
-0x02,0x51,0x00,0x89,0x99,0x74,0x22,0x0c,0x60,0xab,0xba,0xab,0x30,0x0a,0x19,0x4d,
-0x06,0xf3,0x50,0x93,0x67,0x00,0x0a,0x00,0xca,0x00,0x04,0x53,0xa8,0x99,0x30,0x51,
-0x71,0x00,0x27,0x00,0x00,0x20,0x60,0x30,0x00,0x37,0x1a,0x07,0x50,0x0a,0x99,0xc7,
-0x89,0x20,0x22,0xb4,0x22,0x20,0x00,0x2f,0xaa,0xb5,0x00,0x0a,0x96,0x0c,0x00,0x09,
-0x80,0x9b,0x40,0x06,0x60,0x6a,0x9b,0x50,0x00,0x64,0x00,0x27,0x50,0x3d,0x9d,0x96,
-0x66,0x30,0xa0,0x92,0xb4,0x75,0x0a,0x8d,0x18,0x27,0x20,0xa8,0xd1,0x47,0xa0,0x0a,
-0x09,0x10,0xc7,0x01,0xb7,0xd9,0x0c,0x50,0x27,0x49,0x18,0x5b,0x20,0x00,0x95,0x70,
-0x28,0x00,0xdd,0x0d,0xf2,0x17,0x00,0x01,0x99,0x9c,0xa9,0x95,0x00,0x5a,0x09,0x42,
-0x00,0x83,0xa0,0x91,0xa1,0x03,0x07,0x06,0x01,0x10,0x5d,0xa9,0x9d,0x50,0x00,0x1a,
-0x38,0x80,0x00,0x04,0x8c,0xc5,0x20,0x19,0x51,0x00,0x59,0x60,0xc1,0x06,0xf6,0x1f,
-0xff,0xea,0x00,0x07,0xb9,0x57,0xaa,0x10,0x69,0xa0,0x89,0xa0,0x0b,0x7a,0x9b,0x7a,
-0x50,0x86,0x88,0x88,0x36,0x00,0xa5,0x55,0xa2,0x00,0x0a,0x66,0x6b,0x20,0x17,0xc7,
-0x77,0xb8,0x50,0x8a,0xaa,0xaa,0x9a,0x00,0x00,0x0b,0xa0,0x00,0x00,0xba,0x07,0x00,
-0xb3,0xca,0xaa,0xaa,0xda,0x00,0x00,0x0a,0x09,0xaa,0xaa,0xa9,0x36,0x0d,0x01,0x90,
-0x03,0x03,0xf2,0x10,0xf0,0x19,0x0a,0x40,0x3a,0x10,0x1b,0x40,0x00,0x2b,0x13,0x10,
-0x00,0x00,0x22,0x2a,0xaa,0xaa,0xac,0x70,0x00,0x00,0x01,0x90,0x04,0xba,0xb4,0x19,
-0x00,0x54,0x05,0x51,0x90,0x05,0x40,0x55,0x19,0x00,0x5c,0xaa,0x31,0x90,0xf3,0x06,
-0x00,0x12,0x16,0x30,0x60,0x00,0x05,0x07,0x08,0xf2,0x09,0x04,0x00,0x02,0x80,0x05,
-0x80,0x2e,0xa9,0x99,0xb6,0x01,0x00,0x00,0x04,0x09,0xaa,0xaa,0xe0,0x09,0x10,0x00,
-0xb0,0x09,0xba,0x08,0x00,0x00,0xe8,0x10,0x01,0x41,0x02,0x60,0x1a,0xad,0xaa,0xaa,
-0x60,0x02,0x3d,0x00,0xf0,0x03,0xbb,0xaa,0xaa,0x00,0xaa,0x40,0x00,0xa0,0x34,0x54,
-0x00,0x0a,0x00,0x05,0xca,0xaa,0xe0,0x00,0x09,0x00,0xf6,0x08,0x08,0xa9,0x99,0xd1,
-0x00,0x8a,0x99,0x9d,0x10,0x12,0x22,0x22,0x22,0x04,0x6d,0x66,0x66,0x61,0x02,0xd8,
-0x88,0x80,0x00,0xb0,0x13,0x34,0x19,0xa5,0x00,0x9a,0x15,0x00,0xf1,0x02,0x10,0xca,
-0xad,0x11,0x91,0x02,0xa3,0x00,0x1c,0xca,0x99,0xaa,0x90,0x01,0x18,0x00,0x51,0xc9,
-0x99,0x99,0x00,0x00,0x9c,0x03,0x32,0xe9,0x99,0x9a,0x0a,0x00,0xf0,0x26,0xea,0xaa,
-0xaa,0xa8,0xa3,0x77,0x77,0x28,0xa0,0x11,0x11,0x28,0xa0,0xd8,0x89,0x18,0xa0,0x90,
-0x0a,0x18,0xa0,0xd9,0x98,0x18,0xa0,0x50,0x00,0x18,0xa0,0x00,0x04,0xa5,0x00,0x04,
-0x20,0x00,0x00,0x4f,0xa9,0xa4,0x08,0x80,0x00,0xa1,0x14,0x4a,0x2a,0x30,0x00,0x2a,
-0xb1,0x00,0x3b,0x3e,0x00,0x00,0x3d,0x00,0x13,0xb9,0x08,0x00,0x30,0x00,0x02,0x43,
-0x18,0x02,0x22,0x20,0x0a,0x67,0x08,0x21,0xaa,0xa5,0x93,0x00,0xf4,0x00,0xb3,0xc9,
-0x99,0xc0,0x0b,0x36,0x00,0x0a,0x07,0x73,0xc9,0x99,0xc0,0x71,0x36,0x13,0x04,0x20,
-0x06,0x00,0x77,0x03,0xf1,0x0e,0x00,0xda,0xaa,0xaa,0xb6,0xa0,0x00,0x00,0x36,0xa0,
-0xd9,0xa8,0x36,0xa0,0x90,0x18,0x36,0xa0,0xd9,0xa7,0x36,0xa0,0x50,0x00,0x36,0xa0,
-0x00,0x08,0xb4,0x60,0x07,0xf2,0x0d,0xaa,0x39,0x9a,0xa0,0x18,0x71,0x80,0x18,0x01,
-0x87,0x19,0x03,0x60,0x18,0x72,0xd9,0xab,0x31,0xa9,0x10,0x00,0x45,0x1a,0x45,0x99,
-0x97,0x30,0x10,0x7f,0x08,0x13,0x9a,0x5e,0x08,0xf0,0x05,0xcd,0x99,0x50,0x00,0x5f,
-0x43,0x00,0x04,0xb7,0xa1,0x7a,0x22,0x81,0x09,0x00,0x25,0x01,0xa9,0xa9,0x97,0xba,
-0x03,0x90,0xa0,0x02,0xc8,0x88,0x9a,0x00,0x28,0x00,0x01,0xd9,0x09,0x00,0x83,0x07,
-0xf0,0x07,0x8a,0x30,0x00,0x05,0xb5,0x82,0x99,0x20,0x27,0x65,0x69,0x53,0x60,0x00,
-0x44,0x45,0xc1,0x00,0x01,0x88,0x8d,0xa6,0x25,0x04,0x62,0x0a,0x00,0x02,0xc8,0x88,
-0x8a,0x0a,0x00,0x02,0x03,0x17,0xf3,0x0d,0xb0,0x00,0x0a,0x99,0x99,0x9a,0x0a,0x44,
-0x44,0x4a,0x0a,0x55,0x55,0x53,0x0a,0x7a,0x99,0x9a,0x0b,0x91,0x00,0x0a,0x47,0x9a,
-0x99,0x9c,0x81,0x91,0xcb,0x00,0xf0,0x03,0x80,0x64,0x00,0x00,0x1c,0x06,0x40,0x00,
-0x08,0xa9,0xcb,0x99,0x00,0x91,0x17,0x51,0x11,0x17,0xb7,0x06,0xf3,0x23,0x1a,0x99,
-0x9a,0x70,0x01,0x90,0x00,0x09,0x00,0x1d,0x99,0x99,0x90,0x01,0x90,0x00,0x19,0x00,
-0x0a,0xa9,0xd9,0x9c,0x0a,0x38,0xd8,0x4a,0x0a,0x11,0xa1,0x1a,0x0a,0x46,0x66,0x5a,
-0x0a,0x2a,0x89,0x3a,0x0a,0x26,0x05,0x4a,0x28,0x2b,0x88,0x2a,0x72,0x00,0x01,0x9a,
-0xe1,0x02,0x00,0xc5,0x0b,0xf0,0x0f,0x90,0x00,0x06,0xc6,0x26,0xc5,0x05,0x63,0x77,
-0x72,0x65,0x0a,0x9a,0x2b,0x9a,0x00,0x90,0x92,0x70,0xa0,0x0a,0x3a,0x27,0x0a,0x00,
-0xb6,0x52,0x78,0x50,0x02,0x5b,0x03,0xf0,0x15,0x00,0x15,0x00,0x00,0x59,0xd4,0x5a,
-0xa9,0x00,0xa0,0x63,0x0a,0x7a,0xe9,0x93,0x0a,0x07,0xe2,0x63,0x0a,0x19,0xaa,0x73,
-0x0a,0xa2,0xa1,0x73,0x0a,0x20,0xa0,0x6b,0xac,0x00,0xa0,0x10,0x02,0x65,0x01,0xf1,
-0x15,0x05,0x97,0x02,0xb0,0x00,0x80,0x9a,0x88,0x8c,0x28,0x09,0x83,0x76,0x72,0x80,
-0x98,0x70,0x77,0x28,0x59,0x87,0x07,0x72,0x85,0x38,0x78,0x67,0x20,0x00,0x80,0x00,
-0x72,0x00,0x08,0x00,0x3b,0xc1,0x06,0xf2,0x16,0x1c,0x9b,0x4b,0x9a,0x01,0x93,0xa4,
-0x73,0xa0,0x05,0x5a,0x39,0x93,0x06,0x9b,0xc9,0xcb,0x92,0x08,0x80,0x03,0xa4,0x07,
-0xd9,0xb5,0xba,0xc2,0x09,0x0a,0x54,0x18,0x00,0xc9,0xb5,0xb9,0x80,0xea,0x04,0x03,
-0x81,0x0a,0xa0,0xd9,0x9a,0x0a,0xa0,0xa0,0x0a,0x08,0x00,0x00,0x10,0x00,0x04,0x18,
-0x00,0xf2,0x32,0xd9,0x9b,0x99,0x9a,0x90,0x0a,0x00,0x0a,0x98,0x9d,0x99,0x3a,0x90,
-0x0d,0x20,0x0a,0x90,0x75,0x93,0x0a,0x96,0x70,0x0a,0x2a,0xd9,0x88,0x88,0x8a,0x90,
-0x00,0x00,0x0a,0x0d,0x99,0xb9,0x99,0xa0,0x96,0x8d,0x88,0x3a,0x09,0x14,0xc4,0x40,
-0xa0,0x91,0x3b,0x33,0x0a,0x09,0x88,0xd8,0xa6,0xa0,0x90,0x0a,0x28,0x2a,0x0d,0x88,
-0xa8,0x88,0xa0,0x90,0x44,0x00,0xf0,0x26,0xa8,0xa0,0x0a,0x00,0x18,0xa6,0x8d,0x88,
-0x58,0xa1,0x8d,0x86,0x18,0xa2,0x60,0x0a,0x18,0xa2,0x97,0x78,0x18,0xd8,0x88,0x88,
-0x98,0xa0,0x00,0x00,0x28,0xd9,0x99,0x99,0xa9,0xa5,0x9a,0x99,0x29,0xa0,0x09,0x00,
-0x19,0xa3,0x9d,0x98,0x19,0xa0,0x09,0x18,0x19,0xa6,0x89,0x88,0x49,0x18,0x00,0xf1,
-0x39,0xa0,0x00,0x00,0x19,0xd9,0xab,0x99,0x9a,0xa0,0x9a,0x89,0x0a,0xa8,0x86,0x83,
-0x0a,0xa3,0x89,0x97,0x2a,0xa6,0x28,0x52,0x3a,0xa0,0x87,0x60,0x0a,0xa0,0x12,0x67,
-0x0a,0xd8,0x88,0x88,0x8a,0x0d,0x88,0x88,0x8a,0x70,0x95,0x97,0x7a,0x37,0x09,0x37,
-0x77,0x63,0x70,0x98,0x88,0x8c,0x37,0x09,0x80,0x90,0x93,0x70,0x93,0x59,0x96,0x37,
-0x0a,0x95,0x00,0x75,0x70,0xd8,0x88,0x88,0xa7,0x9e,0x14,0x00,0x6f,0x10,0xf1,0x11,
-0x1a,0xbd,0xaa,0xaa,0x60,0x09,0x20,0x32,0x00,0x08,0xa3,0x8b,0xa8,0x23,0x7a,0x01,
-0x75,0x10,0x00,0xa0,0x06,0x40,0x00,0x0a,0x00,0x64,0x00,0x00,0xa7,0xac,0xba,0x60,
-0xb3,0x0a,0x10,0x90,0x2f,0x11,0xf2,0x14,0x01,0x0a,0x00,0x07,0xd9,0x64,0xb8,0xb0,
-0x09,0x17,0xdd,0x0a,0x00,0x92,0xb4,0xa0,0xa0,0x09,0x36,0x3a,0x0a,0x08,0xb7,0x63,
-0x14,0x84,0x10,0x05,0x40,0x04,0x50,0x00,0x2a,0x99,0xb1,0x2d,0x02,0xf2,0x18,0x00,
-0x18,0x00,0x08,0x00,0x01,0x80,0x03,0xa4,0x22,0x18,0x00,0x1a,0x34,0x71,0xda,0x50,
-0x80,0x47,0x18,0x00,0x08,0x77,0x71,0x80,0x07,0xb5,0x47,0x18,0x00,0x20,0x04,0x72,
-0x90,0x00,0x03,0x99,0x99,0x95,0x81,0x08,0x40,0x05,0x50,0x00,0x0a,0xff,0x1a,0xf0,
-0x0a,0xd9,0x78,0x44,0xb0,0x0a,0x08,0x60,0x09,0x00,0xa0,0x02,0xb0,0x90,0x0a,0x22,
-0x02,0x79,0x02,0xc9,0x17,0x91,0x90,0x73,0x04,0x40,0x82,0x02,0x26,0x7a,0x60,0xff,
-0x07,0xe0,0x81,0x00,0xa0,0x00,0x08,0x12,0x5c,0x54,0x05,0xca,0x36,0xc6,0xb0,0x08,
-0x82,0x08,0xf0,0x07,0x81,0x79,0xd9,0xd4,0x09,0xa1,0x3c,0x60,0x07,0x81,0x0a,0x1a,
-0x00,0x00,0x1a,0x50,0x2b,0x20,0x02,0x20,0x00,0x12,0xc7,0x04,0xf1,0x0c,0x02,0xca,
-0xd7,0x81,0xa0,0x5c,0xad,0x88,0x1a,0x00,0x90,0xa0,0x81,0xa0,0x28,0x09,0x00,0x2a,
-0x03,0x00,0x38,0x06,0x30,0x08,0x99,0xd9,0x93,0xd4,0x06,0x20,0x79,0x99,0x55,0x16,
-0xf2,0x18,0xa0,0x01,0x90,0x03,0xae,0xaa,0xbe,0xa0,0x00,0xd7,0x78,0x90,0x00,0x0c,
-0x44,0x59,0x00,0x00,0xc4,0x45,0x90,0x07,0x9d,0x88,0x9d,0x93,0x5c,0xa9,0xb8,0xaa,
-0x24,0x10,0x09,0x00,0x20,0x08,0x89,0xd8,0x86,0x7f,0x00,0xf0,0x14,0x90,0x12,0xa3,
-0x20,0x09,0x04,0x7c,0x77,0x25,0xd9,0x29,0x97,0x90,0x09,0x12,0xb7,0x7b,0x00,0x90,
-0x2a,0x66,0xa0,0x09,0x12,0xa6,0x6b,0x03,0xc9,0xac,0x99,0xd5,0x21,0x02,0x91,0x57,
-0x2a,0x1b,0x12,0x43,0x2d,0x00,0xf0,0x13,0x0a,0x06,0x50,0x09,0x06,0xb9,0xd9,0x05,
-0xd8,0x84,0x84,0x90,0x0a,0x08,0x58,0x58,0x00,0x90,0x78,0x98,0x90,0x09,0x02,0x97,
-0x77,0x04,0xc8,0x4a,0x77,0xa0,0x10,0x04,0xa7,0x7a,0x59,0x08,0x00,0xad,0x09,0x00,
-0x45,0x0f,0xf1,0x09,0x99,0x95,0x02,0x44,0xb5,0x44,0x00,0x24,0x44,0x44,0x40,0x05,
-0xb9,0xd9,0x9d,0x00,0x64,0x09,0x00,0xa0,0x08,0x99,0x99,0x9d,0x7a,0x07,0x12,0x33,
-0x8b,0x0a,0x00,0xd7,0x00,0xf2,0x13,0xb9,0x9b,0x00,0x2b,0x89,0x2b,0x40,0x00,0x25,
-0xcc,0xa5,0x20,0x8c,0x94,0x34,0x8a,0x50,0xa5,0x5c,0x59,0x50,0x0a,0x98,0xd8,0xb5,
-0x00,0xa0,0x0a,0x05,0x50,0x0a,0x99,0x99,0xb5,0x2a,0x13,0xf0,0x16,0x4d,0x88,0x88,
-0x82,0x39,0x87,0x77,0x75,0x00,0x0c,0x77,0x77,0xa0,0x00,0xc7,0x66,0x6a,0x00,0x08,
-0xc7,0x77,0x30,0x09,0x79,0x26,0xa0,0x01,0x47,0xab,0xb8,0x63,0x35,0x30,0x00,0x03,
-0x30,0x03,0xa9,0x15,0x10,0x75,0x28,0x0d,0xf1,0x0c,0xab,0x6a,0x00,0x03,0x90,0x73,
-0xa6,0x00,0x97,0x3b,0x0a,0x78,0x00,0x09,0x90,0xa0,0x63,0x00,0xb2,0x0a,0x00,0x00,
-0x96,0x00,0xa0,0x00,0x75,0x07,0x04,0xf1,0x16,0x01,0x50,0x00,0x00,0x02,0xcb,0x9a,
-0x00,0x08,0x94,0x09,0x50,0x00,0x00,0xbb,0x70,0x00,0x1a,0xb5,0x7f,0x99,0x30,0x04,
-0xb7,0x02,0xb0,0x00,0x60,0x88,0xb1,0x00,0x13,0x7a,0x70,0x00,0x19,0x63,0xa5,0x00,
-0x16,0xa1,0xac,0x05,0x70,0x02,0xaa,0xaf,0xca,0xa7,0x00,0x01,0xa3,0x05,0xf4,0x07,
-0x84,0x93,0x00,0x00,0x3a,0x01,0xb0,0x00,0x6b,0x00,0x05,0xb2,0x16,0x00,0x00,0x02,
-0x50,0x09,0xaa,0xca,0xaa,0x20,0x29,0x00,0xf1,0x05,0x01,0xaa,0xbf,0xca,0xa6,0x00,
-0x03,0xba,0x00,0x00,0x01,0xc1,0x65,0x00,0x04,0xc3,0x00,0x97,0x02,0x81,0x53,0x19,
-0x1d,0xa0,0x4d,0x00,0xf1,0x06,0xba,0x00,0x00,0x00,0x75,0x83,0x00,0x00,0x2d,0x11,
-0xb0,0x00,0x4c,0x4b,0x15,0xa1,0x29,0x10,0x25,0x04,0x80,0x9e,0x10,0x10,0x1b,0x71,
-0x10,0x60,0xba,0xea,0xaa,0x00,0xa0,0x0b,0xf6,0x19,0xf1,0x03,0xea,0xaa,0x70,0x00,
-0x2b,0x90,0x00,0x00,0x1c,0x26,0x60,0x00,0x6b,0x30,0x08,0xa4,0x15,0x00,0x84,0x06,
-0x03,0xd1,0x0d,0xf2,0x10,0x09,0xaa,0xda,0xaa,0x30,0x0a,0x0a,0x08,0x30,0x00,0x81,
-0xb1,0x80,0x02,0x99,0xaf,0xc9,0x96,0x00,0x07,0x5a,0x20,0x00,0x07,0x90,0x1b,0x50,
-0x1a,0x50,0x00,0x06,0x73,0x02,0xf7,0x18,0x54,0x02,0x22,0x30,0x07,0x20,0x69,0x9e,
-0x25,0xda,0x90,0x06,0x50,0x0a,0x09,0x00,0xb0,0x01,0x81,0x9a,0xae,0xa6,0x2b,0x84,
-0x00,0xa0,0x00,0x3f,0x20,0x0a,0x00,0x09,0x6b,0x00,0xa0,0x06,0x60,0x02,0xa8,0x48,
-0x14,0x10,0x90,0xf1,0x14,0xf0,0x18,0x00,0x37,0x20,0x08,0xda,0x2a,0x03,0x80,0x17,
-0x78,0xc8,0x9e,0x15,0x3a,0x23,0x10,0x22,0x58,0xa0,0xc9,0x9c,0x00,0x7b,0x19,0x00,
-0xa0,0x4b,0x23,0xc8,0x8c,0x07,0x20,0x09,0x11,0xa0,0x04,0xaa,0xaa,0xca,0x09,0x05,
-0xa5,0x00,0x00,0x00,0x93,0x00,0x03,0xaa,0xad,0xba,0xa8,0x9a,0x00,0x01,0x09,0x00,
-0x22,0x02,0xab,0x28,0x0c,0x60,0x04,0xaa,0xae,0xaa,0xa0,0x74,0xcd,0x40,0x40,0x09,
-0xaa,0xd7,0x20,0x3e,0x20,0x56,0x05,0xaa,0xae,0xaa,0xa1,0x55,0x0a,0x20,0x2a,0x80,
-0x94,0x09,0xa0,0x30,0x00,0x01,0x99,0xda,0x99,0x95,0x00,0x48,0x00,0xe1,0x19,0xf2,
-0x09,0x99,0xa0,0x0a,0xa0,0x01,0x92,0x04,0x59,0x79,0xbc,0x98,0x00,0x90,0x04,0x60,
-0x00,0x09,0x00,0x36,0x00,0x00,0x90,0x6b,0x40,0x73,0x0d,0xf6,0x0b,0x10,0x60,0x05,
-0x00,0x2a,0x1a,0x27,0x60,0x0b,0x77,0x77,0x78,0x80,0x58,0x99,0x99,0x26,0x00,0x00,
-0x59,0x30,0x02,0x99,0x9e,0x99,0x96,0x56,0x00,0x22,0x49,0xa0,0x78,0x0f,0x40,0x11,
-0x19,0x41,0x10,0x99,0x04,0x40,0x72,0x00,0x00,0x16,0x9d,0x0e,0x30,0x0b,0x9a,0x71,
-0xc1,0x19,0x00,0x93,0x01,0x51,0x55,0x06,0xba,0xaa,0xc1,0x17,0x1e,0xf1,0x15,0x89,
-0x9e,0xa9,0x93,0x0a,0x01,0x50,0x05,0x50,0x20,0x74,0x00,0x11,0x1a,0xbd,0xaa,0xea,
-0x60,0x0a,0x40,0x75,0x00,0x00,0x39,0xac,0x00,0x00,0x04,0xa7,0x6c,0x60,0x08,0x61,
-0x00,0x07,0x10,0xf8,0x05,0xd1,0x77,0x7e,0x87,0x73,0x09,0x22,0x22,0x26,0x60,0x48,
-0x99,0x99,0x33,0x8c,0x00,0x60,0x9a,0xd9,0xe9,0x96,0x00,0x38,0xcf,0x11,0x63,0x30,
-0xa0,0x07,0x1a,0x60,0x08,0x29,0x12,0x00,0x56,0x00,0x60,0x0a,0xaa,0xda,0xaa,0x60,
-0x0a,0x25,0x04,0x80,0x03,0x8a,0xba,0xa3,0x30,0x00,0x30,0xa0,0x06,0x02,0xb0,0xa9,
-0x96,0x00,0x02,0xe0,0xa0,0x00,0x00,0x09,0x5a,0xb0,0x52,0x41,0x10,0xba,0x8d,0x1a,
-0x04,0x32,0x00,0xf2,0x14,0x99,0x9d,0xb9,0x93,0x0a,0x42,0x24,0x04,0x60,0x21,0x95,
-0x50,0x01,0x02,0xb1,0x63,0x00,0x00,0x89,0x8c,0x98,0x85,0x00,0x06,0x97,0x40,0x00,
-0x49,0x90,0x07,0xa2,0x04,0x10,0x00,0x01,0x88,0x00,0xf0,0x0d,0xa9,0x9d,0x99,0xa2,
-0x09,0x25,0x04,0x36,0x30,0x5a,0x1b,0x27,0x70,0x03,0x1a,0x39,0x32,0x00,0x8f,0x98,
-0x8e,0xa2,0x15,0xa1,0x11,0xa2,0x20,0x09,0xff,0x00,0x32,0xb9,0x99,0xd0,0x6e,0x16,
-0xf2,0x15,0xa9,0x9c,0x99,0x97,0x18,0x3a,0x3a,0x42,0x90,0x04,0xb4,0xb4,0x30,0x00,
-0xa9,0x99,0xa4,0x00,0x0a,0x07,0x07,0x60,0x00,0xa0,0xa1,0x76,0x00,0x01,0x97,0x50,
-0x09,0x18,0xa3,0x1a,0x99,0x80,0x1e,0x0d,0x03,0xfc,0x19,0x50,0x7a,0xaa,0xad,0xba,
-0x20,0x09,0x00,0x50,0x06,0x40,0x08,0x20,0x00,0xa1,0x17,0x24,0x00,0x34,0x17,0x1a,
-0x25,0x05,0xbc,0x26,0x02,0xf1,0x15,0x54,0x05,0xbb,0x80,0x05,0x40,0x10,0x18,0x9a,
-0xcc,0x42,0x95,0x50,0x05,0x40,0x07,0xc1,0x72,0x54,0x00,0x1d,0x01,0x95,0x40,0x09,
-0x95,0x05,0x54,0x05,0x90,0x50,0x05,0x40,0x20,0x00,0x07,0x03,0x0c,0x00,0x0e,0x09,
-0xf2,0x07,0x9a,0x00,0x8a,0x99,0x99,0x90,0x07,0x51,0x11,0x16,0x40,0x06,0x77,0x7a,
-0x60,0x29,0x99,0x99,0xe9,0x60,0x09,0x20,0x8a,0x13,0x53,0x00,0x00,0x15,0x98,0x00,
-0xd8,0x14,0x20,0x00,0xa0,0xf6,0x0a,0xf2,0x10,0x00,0xb7,0xc6,0xaa,0xe6,0x0a,0x2b,
-0x00,0x0a,0x00,0xb6,0xc1,0x90,0xa0,0x6b,0xae,0x08,0x1a,0x00,0x1a,0xa0,0x11,0xa0,
-0x2a,0x29,0x00,0x0a,0x04,0x15,0xb0,0x39,0x60,0x01,0x00,0xc9,0x0f,0xf6,0x15,0x01,
-0x0a,0x08,0xc9,0xa4,0x38,0xa6,0x66,0x3b,0x00,0x5a,0x02,0xc8,0x20,0x00,0xa5,0x61,
-0x0a,0x00,0x9b,0x8a,0x99,0xd7,0x64,0xa0,0xa1,0x0a,0x00,0x0a,0x02,0x60,0xa0,0x00,
-0xa0,0x03,0x97,0x21,0x1d,0xf1,0x08,0x02,0x40,0xb0,0x51,0x00,0x74,0x0b,0x03,0x80,
-0x0b,0x00,0xb0,0x0b,0x02,0xa0,0x0b,0x00,0x65,0x62,0x00,0xb0,0x02,0x90,0x9c,0x03,
-0x40,0x4a,0xa0,0x00,0x00,0x35,0x0c,0x00,0xb8,0x02,0x30,0xa0,0x09,0x10,0x4b,0x0a,
-0x60,0xac,0xba,0x70,0x0a,0x00,0x1a,0x3e,0x00,0xc0,0x92,0x00,0x56,0x00,0x01,0xb3,
-0x08,0x00,0x00,0x01,0x94,0x0b,0xcd,0x04,0xf2,0x10,0xb9,0x99,0x99,0xd0,0x0a,0x03,
-0x69,0x70,0x00,0xa4,0x5b,0x24,0x30,0x0a,0x6a,0xd8,0x52,0x00,0x91,0x3c,0x9a,0xa2,
-0x46,0x86,0xc0,0x02,0x38,0x10,0x06,0x99,0xa3,0x81,0x0a,0xf6,0x14,0x99,0x99,0xb6,
-0x00,0xa8,0x88,0x8a,0x60,0x0a,0x22,0x22,0x22,0x00,0xb8,0x88,0x88,0xd0,0x09,0x39,
-0x8a,0x0a,0x00,0x94,0x40,0x90,0xa0,0x63,0x4a,0x89,0x0a,0x05,0x00,0x00,0x49,0x80,
-0x4d,0x00,0xf3,0x09,0x06,0x30,0x81,0x00,0xa6,0x9b,0x8d,0x82,0x0a,0x01,0x80,0xa0,
-0x00,0xa9,0xbc,0x9d,0x94,0x46,0x0b,0x10,0xa0,0x07,0x1a,0x40,0x88,0x09,0x06,0x29,
-0x00,0xfe,0x10,0x16,0x41,0xa1,0x00,0xa5,0xa9,0x7c,0x71,0x0a,0x9b,0xb9,0xd9,0x40,
-0xa0,0xa0,0x94,0x80,0x46,0x1b,0x56,0xc5,0x05,0x03,0x73,0x00,0x54,0x08,0xaa,0xaa,
-0xaa,0x30,0xa1,0x1d,0x00,0x09,0x00,0x51,0x3a,0xaa,0xeb,0xaa,0x70,0x79,0x05,0x00,
-0x5f,0x09,0x51,0x5a,0xcc,0xaa,0xaa,0x10,0xa4,0x03,0x60,0xca,0xaa,0xa9,0x00,0x45,
-0x02,0x58,0x1e,0xf0,0x22,0x27,0x00,0x08,0x50,0x02,0x70,0x00,0x51,0xaa,0xbd,0xaa,
-0x20,0x00,0x30,0x00,0x50,0x00,0x48,0xa5,0x6c,0x51,0x03,0x44,0xc4,0x44,0x10,0x39,
-0xbc,0x99,0x80,0x17,0x7a,0xa7,0x77,0x40,0x35,0xc3,0x33,0x32,0x03,0xc8,0x9d,0x99,
-0x02,0xa8,0x88,0xd8,0x85,0x00,0x4b,0x19,0x40,0x9a,0xaa,0xaa,0x90,0x56,0x0b,0x00,
-0x3c,0x1a,0x30,0xaa,0xaa,0xaa,0xbf,0x04,0xd2,0x10,0xa0,0x00,0x00,0x07,0xa0,0x00,
-0x00,0x29,0x6b,0xaa,0xaa,0xb2,0x78,0x11,0x40,0x74,0x00,0x00,0x2a,0xb3,0x15,0xf0,
-0x08,0x08,0x42,0x50,0x00,0x05,0xfa,0xbc,0xac,0x23,0x9a,0x02,0x70,0x72,0x00,0xa0,
-0x27,0x07,0x20,0x09,0x02,0x77,0x90,0x00,0x28,0x09,0xf2,0x15,0x03,0x20,0x00,0x60,
-0x00,0x16,0xa9,0xc3,0x00,0x19,0xad,0x37,0xa2,0x06,0x99,0xe9,0x99,0x92,0x00,0xb1,
-0x40,0x00,0x01,0xbd,0x9d,0x9a,0x70,0x64,0x80,0xa0,0x28,0x00,0x28,0x0a,0x29,0x50,
-0xcd,0x00,0xe0,0xa0,0x90,0x54,0x02,0x9d,0x9d,0x9b,0xb6,0x00,0x50,0x40,0x32,0x00,
-0x99,0x74,0x0f,0xf5,0x03,0x00,0xa0,0x02,0x70,0x3c,0x9d,0x99,0xa1,0x00,0x90,0xa0,
-0x0a,0x00,0x08,0x0a,0x09,0x60,0x00,0xec,0x1a,0xf2,0x18,0x37,0x00,0x92,0x10,0x04,
-0x80,0x09,0x98,0x07,0xac,0x87,0xd9,0x70,0x73,0x78,0x83,0x09,0x07,0x37,0x88,0x81,
-0x90,0x73,0x78,0x88,0x19,0x06,0x39,0x57,0xa0,0x80,0x03,0x70,0x58,0x92,0x00,0x37,
-0x68,0x00,0x7e,0x03,0xf0,0x08,0x17,0x0a,0x04,0x50,0x5c,0x5c,0x5b,0x62,0xc5,0x55,
-0x55,0x85,0x89,0x77,0x7c,0x34,0x0a,0x77,0x7d,0x00,0x02,0x2b,0x22,0xb2,0x0e,0xa0,
-0xc0,0x63,0x0a,0x08,0xa0,0x00,0x0a,0x01,0x00,0x04,0x93,0x06,0xf2,0x15,0x45,0x0d,
-0x88,0xa5,0x7b,0xb7,0xa6,0x67,0x58,0x45,0x8a,0x88,0x85,0x84,0x58,0x88,0x8a,0x18,
-0x45,0x8b,0x77,0xb1,0x74,0x94,0xa5,0x5a,0x10,0x45,0x0a,0x33,0x91,0x04,0x50,0xb8,
-0x8c,0x10,0x29,0x00,0xf0,0x45,0x28,0x88,0x83,0x7a,0xa6,0x97,0x7a,0x08,0x45,0x8a,
-0x88,0xc0,0x84,0x58,0x33,0x33,0x18,0x45,0xb9,0xb6,0x94,0x74,0x97,0xbc,0x8b,0x40,
-0x45,0x25,0x80,0x54,0x04,0x52,0xb8,0x8b,0x40,0x00,0x18,0x02,0x70,0x01,0x89,0xc8,
-0x9c,0x85,0x02,0x96,0x66,0x68,0x00,0x3a,0x66,0x66,0xa0,0x02,0x8a,0x76,0x67,0x03,
-0xab,0xeb,0xbb,0xa7,0x18,0xd9,0xb8,0xcb,0x51,0x2a,0x0a,0x04,0x63,0x00,0xa0,0xa1,
-0x93,0x00,0x08,0xaa,0xda,0xaa,0x20,0x06,0x0a,0x02,0x27,0x15,0x53,0x92,0x00,0x03,
-0x1a,0x04,0x1d,0x06,0x09,0xf0,0x01,0x40,0x40,0x00,0x41,0x00,0x58,0x13,0x80,0x09,
-0xac,0x9b,0xd9,0x40,0x02,0x70,0x0a,0x5d,0x01,0x30,0xa0,0x02,0xac,0xf3,0x0f,0x50,
-0x83,0x00,0xa0,0x00,0x1c,0xd9,0x1e,0x14,0x20,0x1f,0x01,0x00,0xb7,0x10,0xf4,0x13,
-0xaa,0xab,0xca,0xa5,0x0a,0x27,0x77,0x74,0x00,0xa0,0x33,0x3a,0x10,0x0a,0x01,0x8e,
-0x20,0x00,0xa8,0x99,0xd9,0xd3,0x18,0x00,0x0a,0x28,0x05,0x40,0x00,0xa0,0x00,0x80,
-0x05,0x98,0xee,0x03,0xf2,0x13,0x71,0x00,0x00,0x89,0x9c,0xb9,0x94,0x0a,0x00,0x20,
-0x03,0x00,0xa6,0x18,0x20,0xb0,0x0a,0x37,0x36,0x37,0x00,0xa0,0xa0,0x89,0x10,0x28,
-0x03,0x01,0x90,0x06,0x49,0x99,0xcb,0x95,0x6c,0x19,0x00,0x72,0x04,0xf0,0x14,0x89,
-0x9d,0xb9,0x94,0x0a,0x08,0x00,0x80,0x00,0xa8,0xd8,0x8d,0x83,0x0a,0x09,0x77,0xc0,
-0x00,0xa7,0x88,0x88,0x50,0x18,0x08,0x52,0xb2,0x06,0x43,0x6d,0xd8,0x41,0x31,0x52,
-0x00,0x15,0x2d,0x00,0x70,0x26,0x24,0x9c,0x29,0x9c,0x40,0x06,0x69,0x00,0xf4,0x0c,
-0xd9,0x29,0x0d,0x84,0x01,0x72,0x90,0xa0,0x00,0x9a,0x09,0x0a,0x00,0x07,0x90,0xc9,
-0xc9,0x60,0x8d,0x40,0x00,0x00,0x48,0x19,0xaa,0xaa,0x71,0x12,0x12,0xf1,0x15,0x03,
-0x9d,0x38,0xd8,0x90,0x05,0x57,0x7d,0x7c,0x30,0xc9,0x48,0xd8,0xc0,0x00,0x92,0x3b,
-0x33,0x01,0x89,0x24,0xc4,0x40,0x09,0x58,0x8d,0x88,0x30,0x87,0x20,0x00,0x00,0x64,
-0x07,0xaa,0x99,0x1d,0x06,0xf0,0x12,0x4a,0xda,0xac,0xba,0x00,0x09,0x10,0x64,0x00,
-0x00,0x91,0x06,0x40,0x07,0xad,0xaa,0xcb,0xa2,0x00,0xb0,0x06,0x40,0x00,0x1a,0x00,
-0x64,0x00,0x0a,0x40,0x06,0x40,0x06,0x60,0x18,0x0a,0x01,0x31,0x17,0x00,0x97,0x04,
-0xf0,0x06,0x7a,0x99,0x99,0xa0,0x07,0x30,0x00,0x02,0x50,0x19,0x99,0x99,0xa2,0x00,
-0x42,0x00,0x70,0x02,0x9d,0xa9,0x9d,0x8f,0x0b,0x45,0xa0,0x01,0xc2,0x00,0x5e,0x1b,
-0x20,0x0b,0x37,0x66,0x01,0x60,0x81,0x2a,0xaa,0xad,0xaa,0x70,0x08,0x05,0x90,0x09,
-0xbb,0xa6,0x40,0x00,0x05,0x50,0x36,0x00,0x6f,0x29,0xb0,0x30,0x18,0xba,0x3a,0x19,
-0x19,0x52,0x00,0x2b,0x80,0x00,0x90,0x0e,0x30,0x99,0xc0,0x0a,0x8e,0x0e,0x40,0x0b,
-0x99,0x80,0x0a,0x93,0x0e,0x31,0x1a,0x99,0xd0,0x10,0x00,0x01,0x04,0x00,0x21,0xab,
-0x50,0x53,0x00,0x70,0x39,0x9d,0x39,0x9d,0x00,0x99,0xd1,0x1a,0x00,0xf4,0x09,0x37,
-0x00,0x01,0xc9,0xa4,0xb9,0xa1,0x09,0x3a,0x19,0x29,0x00,0x09,0xc0,0x19,0xc0,0x4a,
-0x6b,0x4a,0x5a,0x00,0x19,0x80,0x38,0x13,0x06,0xf0,0x0a,0x20,0x02,0x06,0x9c,0x0a,
-0x08,0x30,0x11,0xa5,0x99,0xd9,0x08,0x98,0x81,0xa0,0xa0,0x90,0x08,0x8d,0x7c,0x05,
-0x8b,0x67,0xd7,0xa0,0x01,0x06,0x10,0x30,0xf2,0x1b,0x23,0x4a,0x60,0xa7,0x00,0xf2,
-0x15,0x49,0xc2,0xd8,0x8a,0x00,0x08,0x2b,0x55,0xa0,0x4a,0x91,0x3b,0x32,0x06,0x20,
-0x3b,0xd8,0xc0,0x5b,0xd4,0x6a,0x09,0x00,0x0a,0x28,0xd9,0x90,0x00,0xa0,0x0a,0x1b,
-0x00,0x99,0x7a,0xa9,0xa4,0xa3,0x01,0xf0,0x04,0x0b,0x00,0x66,0x50,0xb0,0x56,0x09,
-0x0b,0x09,0x07,0x99,0xe9,0x97,0x01,0x11,0x11,0xb4,0x99,0x99,0x9e,0x12,0x70,0xb8,
-0x99,0x99,0x9b,0x11,0x11,0x11,0x2e,0x05,0x00,0x59,0x0a,0xf0,0x13,0x9b,0x80,0x03,
-0x77,0x77,0x97,0x00,0x12,0x22,0x26,0x60,0x19,0x99,0xe9,0x9a,0x60,0x59,0x0c,0x56,
-0x90,0x00,0x37,0xd9,0x80,0x00,0x8a,0x4b,0x09,0x71,0x02,0x09,0xa0,0x03,0x50,0x60,
-0x07,0xf6,0x15,0x06,0xd9,0xd9,0x08,0x50,0x09,0x08,0x19,0x40,0x00,0x90,0x81,0x00,
-0x90,0x7d,0x9d,0xa2,0xb3,0x00,0xa0,0x81,0x71,0x11,0x0a,0x08,0x10,0x0b,0x14,0x80,
-0x81,0x2b,0x30,0x91,0x08,0x3a,0x10,0xd5,0x24,0xf2,0x14,0xee,0xec,0x06,0x80,0x39,
-0x44,0xb8,0x60,0x00,0x4a,0x43,0x00,0x80,0x59,0x99,0x92,0xa3,0x02,0xa5,0x5a,0x51,
-0x11,0x19,0xc9,0x50,0x0b,0x13,0x78,0x46,0x1a,0x30,0x53,0xb0,0x5a,0x20,0x39,0x19,
-0xf0,0x2a,0x48,0x49,0x9b,0xa0,0x18,0x30,0x02,0xb0,0x00,0x1b,0x17,0x9a,0x60,0x1c,
-0x88,0x20,0x05,0x41,0x38,0x49,0xda,0x90,0x01,0x80,0x09,0x10,0x00,0x18,0x00,0x91,
-0x00,0x01,0x89,0x9d,0xa9,0x50,0x00,0xa0,0x01,0x80,0x00,0x0a,0x42,0x9a,0xd9,0x50,
-0x24,0x51,0x01,0x80,0x00,0x02,0xb7,0x9a,0xd9,0x90,0x2c,0x16,0x0e,0xd0,0x23,0x86,
-0x99,0x9d,0x90,0x01,0x80,0x91,0x0a,0x00,0x01,0x80,0x28,0x05,0x00,0x22,0x01,0x99,
-0x29,0x0e,0xf0,0x17,0xa2,0xa9,0x99,0xa0,0x62,0x5a,0x88,0x8a,0x00,0x94,0xa0,0x00,
-0xa0,0x7e,0x1a,0x9a,0x98,0x04,0x91,0xa0,0x91,0x90,0x08,0x1a,0x05,0xb2,0x00,0x81,
-0xa2,0x3b,0x40,0x08,0x1b,0x93,0x09,0x30,0x03,0x20,0xfa,0x23,0xf2,0x13,0xc8,0x7b,
-0x10,0x52,0x5d,0x89,0xc8,0x30,0xb1,0x90,0x37,0x00,0x8d,0x09,0xb9,0x9c,0x01,0x90,
-0x9b,0x77,0xc0,0x09,0x18,0xb6,0x6b,0x00,0x94,0x5b,0x77,0xc0,0x09,0x52,0xa0,0x09,
-0xcd,0x0a,0xf0,0x09,0x30,0x80,0x80,0x01,0xa2,0x28,0x4a,0x00,0x73,0x74,0x87,0xc7,
-0x40,0xa4,0x88,0x8a,0x64,0x7e,0x37,0x79,0xa9,0x11,0x90,0xb9,0xbe,0x1c,0xb6,0x39,
-0x58,0x00,0x93,0x74,0x7a,0xa0,0x09,0x71,0x07,0x23,0xfe,0x0b,0xf1,0x1c,0x45,0x11,
-0xb1,0x10,0x2a,0x29,0x9d,0x99,0x38,0x14,0x79,0xc8,0x80,0x08,0x38,0x70,0x79,0x05,
-0xf0,0x89,0x79,0x90,0x69,0x38,0x89,0x88,0x30,0x90,0x01,0x90,0x20,0x09,0x37,0x84,
-0x2a,0x00,0x96,0x0a,0x8a,0x32,0x00,0x05,0x20,0xc7,0x10,0x30,0x00,0x00,0x05,0x20,
-0x32,0xf3,0x05,0x80,0x00,0xa0,0x0a,0x18,0x00,0x09,0x21,0xa1,0x80,0x03,0x47,0x24,
-0x19,0x00,0xa0,0x40,0x00,0xba,0xaa,0x52,0x00,0x10,0x95,0x74,0x03,0xf6,0x0e,0x85,
-0x83,0x00,0x20,0xa0,0x29,0x00,0x0a,0x0a,0x1b,0x39,0x00,0xa0,0xba,0x10,0x92,0x34,
-0x2e,0x20,0x22,0x70,0x8a,0xa0,0x09,0x10,0x23,0x0a,0xaa,0xb0,0x23,0x04,0x32,0x29,
-0x99,0xda,0x73,0x13,0xf5,0x08,0x06,0x99,0xa9,0x99,0x10,0x00,0x1b,0x10,0x00,0x06,
-0x54,0x2b,0x08,0x00,0x95,0x50,0x04,0x94,0x14,0x2b,0x99,0xb1,0x60,0x2e,0x20,0xf4,
-0x0e,0x5a,0x87,0xae,0xaa,0x08,0xa4,0x00,0xa0,0xa0,0x3a,0x2a,0xad,0xae,0x40,0xa0,
-0x05,0xe2,0x00,0x0a,0x00,0xa2,0xa0,0x00,0xa0,0x58,0x09,0x70,0x0a,0x49,0xe9,0x26,
-0xf5,0x19,0x41,0x00,0x00,0x00,0x1e,0x99,0x99,0x70,0x1b,0x1a,0x1a,0x0a,0x02,0x28,
-0x54,0x60,0xa0,0x07,0x53,0xa0,0x28,0x00,0x00,0x63,0x48,0x10,0x06,0x70,0xa1,0x15,
-0x04,0x5a,0x01,0x35,0x91,0x40,0x79,0x99,0x82,0x20,0x03,0x0b,0xf0,0x14,0x29,0x99,
-0xed,0x99,0x60,0x00,0x65,0x92,0x00,0x00,0x6b,0x61,0xc4,0x01,0xb6,0x06,0x50,0x88,
-0x05,0x43,0x93,0x07,0x00,0xb5,0x40,0x63,0x93,0x16,0x2b,0x99,0xb2,0x60,0x00,0x03,
-0x20,0xdb,0x17,0xd0,0x2a,0x20,0x06,0xb9,0x88,0x8a,0x20,0x0a,0x88,0x88,0x70,0x00,
-0x80,0x4f,0x11,0xf0,0x04,0x9b,0x88,0x50,0x01,0x12,0xb5,0x02,0x00,0xa6,0x40,0x62,
-0x75,0x17,0x3b,0x99,0xb2,0x70,0x00,0x53,0x5d,0x1b,0xf0,0x19,0x88,0xd0,0x00,0x5f,
-0x98,0xac,0x80,0x01,0x13,0x33,0x3a,0x10,0x03,0x55,0x55,0xb1,0x00,0x78,0x99,0x8a,
-0x10,0x00,0x22,0x90,0x23,0x04,0x7a,0x07,0x25,0xb0,0x70,0x79,0x99,0x65,0x10,0x00,
-0x22,0x00,0x40,0x00,0xa0,0x28,0x40,0x00,0xbc,0xac,0xb8,0xeb,0x11,0x51,0xb0,0x01,
-0xda,0xaa,0xab,0xa2,0x27,0xd2,0x05,0x25,0x2a,0x07,0x10,0x93,0x70,0x32,0x49,0x13,
-0x1c,0x99,0xb3,0xbe,0x04,0xf3,0x19,0x43,0x08,0x10,0x00,0x04,0x30,0x90,0x00,0x00,
-0x9a,0x9d,0x9a,0x94,0x2a,0x92,0x90,0x90,0x04,0x73,0x27,0x98,0x72,0x04,0x37,0x66,
-0x99,0x00,0x45,0x90,0x4d,0x10,0x04,0x61,0x0b,0x38,0x00,0x43,0x0a,0x20,0x65,0x7a,
-0x01,0xf2,0x64,0x61,0x00,0x00,0x0a,0x8b,0x88,0x80,0x00,0xc7,0x77,0x7a,0x00,0x0b,
-0x33,0x33,0xa0,0x00,0xb4,0x44,0x4a,0x00,0x08,0x8c,0x88,0x60,0x02,0x21,0x75,0x05,
-0x10,0xb6,0x40,0x62,0x58,0x24,0x3b,0x99,0xb2,0x40,0x00,0xc7,0x77,0xa6,0x00,0x0b,
-0x66,0x69,0x60,0x00,0xc7,0x77,0x96,0x01,0x8a,0xc8,0x8d,0x86,0x06,0xe9,0x88,0xa9,
-0x00,0x20,0x0a,0x20,0x60,0x0a,0x39,0x26,0x3a,0x12,0x50,0xb8,0x88,0x16,0x09,0x01,
-0x1b,0x11,0x00,0x91,0x88,0xd8,0x82,0x4b,0x86,0x7d,0x77,0x07,0x93,0x88,0xc8,0x84,
-0x49,0x05,0x88,0x88,0x00,0x90,0x95,0x55,0xb0,0x09,0x09,0x33,0x3b,0x00,0x90,0x98,
-0x77,0xc0,0x09,0x09,0x00,0x79,0x62,0x05,0xf0,0x07,0x69,0xa9,0x9b,0x81,0x06,0x8c,
-0x67,0xc6,0x40,0x28,0x88,0x88,0x51,0x00,0xc6,0x66,0x78,0x00,0x0c,0x77,0x78,0x80,
-0xdd,0x00,0x94,0x00,0x84,0x83,0x63,0x91,0x07,0x0b,0x99,0x81,0x8b,0x28,0xf1,0x17,
-0xa7,0x40,0x08,0x88,0x8d,0x9c,0x40,0xa6,0x77,0x90,0x60,0x0a,0x57,0x66,0x85,0x01,
-0x99,0x18,0x3d,0x04,0x74,0x45,0x59,0x6a,0x51,0x03,0x1a,0x00,0x10,0x0a,0x90,0x53,
-0x5b,0x04,0x37,0x98,0x88,0x32,0xce,0x02,0xf3,0x15,0x91,0x8d,0xcc,0x80,0x6a,0x88,
-0x76,0x68,0x07,0x94,0x88,0x88,0x80,0x49,0x0b,0xa4,0xab,0x00,0x91,0x99,0x99,0x60,
-0x09,0x02,0xa1,0x93,0x00,0x90,0x07,0xea,0x00,0x09,0x4b,0x62,0x6c,0x10,0x8f,0x05,
-0xf0,0x16,0x63,0x04,0x99,0x70,0xa0,0xa0,0x11,0x0a,0x0b,0x57,0x31,0xa4,0x89,0xd5,
-0x51,0x06,0xd2,0x0b,0x0b,0x00,0x1f,0x10,0x89,0x50,0x09,0x6a,0x06,0xb0,0x17,0x80,
-0x34,0xbc,0x38,0x10,0x00,0x70,0x4d,0x4b,0x27,0xf0,0x08,0xa2,0x00,0x00,0x02,0x81,
-0xa0,0x0c,0xaa,0xbd,0xaa,0x50,0xa0,0x00,0xa0,0x50,0x0c,0x9d,0x0b,0x38,0x00,0xa0,
-0xa0,0xba,0x4e,0x20,0xb3,0x70,0x33,0x87,0x67,0xaa,0x18,0x72,0x05,0x70,0x6c,0x30,
-0x66,0x05,0xf2,0x16,0x48,0x00,0x55,0x55,0xc5,0x95,0x16,0x66,0x6d,0x76,0x40,0x69,
+0x90,0x0a,0x00,0x90,0x28,0x00,0x00,0x3e,0x04,0xf3,0x13,0x40,0xd9,0x9c,0x43,0x54,
+0x0d,0x99,0xb4,0x95,0x40,0x90,0x30,0x09,0x54,0x0b,0x9d,0x93,0x95,0x40,0xb5,0x94,
+0x49,0x54,0x29,0x59,0x44,0x45,0x46,0x44,0x97,0x10,0x54,0x50,0x09,0x5d,0x06,0xf1,
+0x15,0x02,0x02,0x70,0x0a,0x09,0x8a,0x13,0x3a,0x05,0xaa,0x45,0x4a,0x35,0x62,0x35,
+0x4a,0x39,0xca,0x95,0x4a,0x05,0x76,0x25,0x4a,0x0a,0x73,0x91,0x0a,0x64,0x72,0x70,
+0x0a,0x02,0xa1,0x00,0x6c,0x53,0x00,0xf5,0x18,0x50,0x00,0x32,0x00,0x16,0x71,0x1c,
+0x21,0x27,0x77,0x77,0x77,0x50,0x79,0x96,0x32,0x71,0x0a,0x34,0x85,0x48,0x10,0xa4,
+0x58,0x54,0x81,0x0a,0x89,0x85,0x48,0x10,0xa0,0x18,0x00,0x81,0x0a,0x09,0x60,0x7c,
+0x27,0x01,0xf3,0x16,0xa2,0x99,0x99,0x63,0x0a,0x09,0x88,0xb2,0xa0,0xa0,0xa4,0x49,
+0x2a,0x0a,0x03,0x44,0x40,0xa0,0xa0,0xc8,0xc9,0x8a,0x0a,0x0c,0x7c,0x78,0x50,0xa0,
+0xc8,0xc9,0x80,0x0a,0x09,0x00,0x18,0x4a,0x70,0xfe,0x00,0xc0,0x00,0x04,0xcd,0xb0,
+0xa0,0x00,0x00,0x90,0x8e,0xaa,0x70,0x09,0x5b,0x02,0xf3,0x05,0x90,0x0c,0x00,0xa0,
+0x0a,0x43,0x90,0x09,0x3b,0xc7,0x75,0x02,0x81,0x10,0x1b,0x00,0x46,0x00,0x0b,0x23,
+0xbd,0x05,0x11,0xa0,0x30,0x00,0xf3,0x12,0x68,0x80,0x1a,0xda,0xa9,0x3a,0x10,0x18,
+0x0a,0x80,0x91,0x03,0x70,0xa8,0x09,0x10,0x55,0x19,0x80,0x91,0x08,0x32,0x78,0x09,
+0x10,0xb0,0x55,0xaa,0xd1,0x28,0x8b,0x18,0x09,0xdb,0x01,0x50,0x09,0x10,0x03,0x99,
+0x90,0x0f,0x03,0xf2,0x0e,0x6c,0x77,0x06,0xa9,0x94,0xb3,0xb0,0x09,0x10,0x0a,0x0a,
+0x00,0x90,0x90,0x90,0xa0,0x28,0x4c,0x28,0x0a,0x07,0xa6,0x5a,0x30,0xa0,0x00,0x00,
+0x95,0xa7,0x2c,0x00,0x30,0x14,0x00,0x00,0x28,0x04,0xf0,0x03,0x50,0x06,0x84,0x44,
+0x4c,0x02,0x9b,0x99,0x80,0xa0,0x00,0xa0,0x0a,0x0a,0x00,0x0d,0x99,0x90,0x94,0x03,
+0x30,0xa5,0x00,0x0a,0x78,0x00,0xf6,0x1d,0xaa,0xaa,0xab,0x60,0x00,0x52,0x00,0x00,
+0x00,0x0e,0x99,0x99,0x94,0x09,0x30,0x10,0x04,0x76,0xb2,0x08,0x22,0x36,0x19,0x2a,
+0x90,0x94,0x60,0x91,0xaa,0x39,0x45,0x09,0x52,0x03,0x95,0x40,0x69,0x99,0x95,0x73,
+0x00,0x00,0x02,0x9b,0xbd,0x02,0xf3,0x21,0x04,0x70,0xa0,0x00,0x00,0xb0,0x0a,0x03,
+0x30,0x6b,0x00,0xa1,0xd1,0x2c,0xa0,0x0b,0xb5,0x02,0x2a,0x00,0xf6,0x00,0x00,0xa3,
+0xcb,0x00,0x00,0x0a,0x62,0xa0,0x07,0x00,0xa0,0x0b,0x00,0xa0,0x0a,0x00,0xba,0xb5,
+0xea,0xda,0xda,0xa6,0xa0,0xa0,0x90,0x00,0x04,0x00,0xf0,0x19,0x05,0xa7,0x50,0x86,
+0x77,0xa5,0x00,0x03,0x30,0xea,0xaa,0xaa,0xa5,0xd9,0x99,0x99,0x94,0xa3,0x10,0x08,
+0x10,0xa1,0xb2,0x48,0x00,0xa0,0x1b,0xb0,0x00,0xa0,0x1b,0xb2,0x00,0xa3,0xc2,0x1c,
+0x10,0xa5,0x10,0x02,0x20,0x00,0x12,0xa6,0x6a,0x00,0xf0,0x14,0x6b,0x0a,0x00,0x0a,
+0xd9,0x00,0xa0,0x00,0x14,0x60,0x0a,0x00,0x00,0x46,0x00,0xa0,0x02,0xab,0xca,0xae,
+0xa7,0x00,0x74,0x00,0xa0,0x00,0x0a,0x10,0x0a,0x00,0x04,0x90,0x00,0xa0,0x02,0x69,
+0x04,0x02,0xa3,0x04,0xf0,0x02,0x40,0xa0,0x07,0x00,0x0c,0x0a,0x05,0x70,0x00,0x71,
+0xa0,0x80,0x00,0x7a,0xae,0xaa,0xa2,0x5e,0x01,0x54,0x02,0xaa,0xae,0xaa,0xa7,0x67,
+0x01,0x02,0x70,0x01,0xf2,0x19,0x08,0x10,0x09,0x00,0x00,0x81,0x01,0xa1,0x00,0x5d,
+0xa5,0xad,0x9a,0x00,0x81,0x22,0x90,0xb1,0x08,0x1a,0x47,0x0b,0x80,0x83,0xa7,0x30,
+0x9a,0x08,0x33,0xa0,0x18,0x50,0x81,0x74,0x03,0x70,0x08,0x47,0x09,0xb2,0x57,0x00,
+0xf5,0x10,0x41,0x00,0x41,0x00,0x02,0x90,0x2b,0x00,0x06,0xa8,0xd8,0x8c,0x00,0x6a,
+0x8d,0x88,0xd0,0x06,0x40,0xa0,0x0a,0x00,0x38,0x8d,0x88,0x70,0x29,0x99,0xd9,0x99,
+0x70,0x56,0x00,0x70,0x00,0x02,0x80,0x00,0x00,0x00,0x28,0x09,0x00,0x21,0xd9,0x95,
+0x09,0x00,0xf0,0x0f,0x7a,0xab,0xda,0xaa,0x20,0x00,0x29,0x20,0x00,0x00,0x02,0xa7,
+0xa4,0x00,0x00,0x29,0x00,0x40,0x00,0x02,0x90,0x00,0x00,0x09,0xab,0xca,0xac,0x00,
+0x00,0x28,0x9c,0x00,0x20,0x80,0x0a,0x09,0x00,0x51,0xb0,0x00,0x02,0x83,0xa8,0x32,
+0x00,0xe5,0x01,0x13,0x91,0x11,0x12,0x88,0x88,0x88,0x86,0x09,0xba,0xaa,0xaa,0x40,
+0xb4,0x00,0x18,0xb0,0x09,0x00,0x10,0x56,0x81,0x01,0x10,0x10,0x12,0x06,0x30,0xaa,
+0xac,0xaa,0xd5,0x01,0x02,0x69,0x05,0xf0,0x55,0xa6,0xaa,0xea,0xa3,0x09,0x00,0x0a,
+0x43,0x03,0x70,0x00,0xa0,0x70,0x74,0x88,0x8d,0x88,0x63,0x01,0x11,0x11,0x11,0x0b,
+0x99,0xac,0x99,0x40,0xa2,0x8b,0xb8,0x60,0x0a,0x47,0x22,0x2a,0x00,0xa4,0x95,0x55,
+0xb0,0x0a,0x39,0x8a,0x88,0x01,0x90,0x70,0xa5,0x10,0x55,0x94,0x0a,0x1a,0x06,0x15,
+0x29,0x70,0x32,0x00,0x05,0x01,0x00,0x00,0x19,0x51,0x98,0x00,0x07,0x9d,0x76,0x67,
+0x06,0x99,0xe9,0xa9,0x92,0x02,0xb1,0x65,0x90,0x06,0xa8,0x83,0x64,0xb2,0x10,0x69,
+0x81,0x60,0x00,0x03,0x47,0x93,0x00,0x04,0x85,0x10,0x00,0x00,0x1a,0x97,0x01,0xf1,
+0x61,0x36,0x22,0x05,0x50,0x00,0xa0,0xa2,0xa0,0x00,0x04,0x70,0x66,0x00,0x00,0x08,
+0x79,0x00,0x00,0x00,0x7d,0x70,0x00,0x05,0xb5,0x05,0xb7,0x15,0x60,0x00,0x00,0x43,
+0x2a,0xea,0xae,0x20,0x00,0x0b,0x20,0xb0,0x00,0x00,0xb8,0x0b,0xac,0x00,0x0a,0xa0,
+0x02,0x80,0x02,0x83,0xa0,0xa2,0x00,0x93,0x07,0xc5,0x00,0x59,0x06,0xb8,0xb6,0x03,
+0x04,0x50,0x00,0x52,0x4a,0xab,0x6b,0xab,0x20,0x00,0xa3,0x70,0x90,0x1a,0x1a,0x09,
+0x0a,0x00,0x4c,0x60,0xa4,0x60,0x00,0xc5,0x05,0xd0,0x00,0x39,0xb0,0x7d,0x00,0x2b,
+0x03,0x89,0x29,0x14,0x20,0x16,0x00,0x24,0x00,0x00,0x02,0x51,0x00,0x89,0x99,0x74,
+0x10,0xf8,0x00,0x60,0xab,0xba,0xab,0x30,0x0a,0x19,0x4d,0x06,0xf3,0x4f,0x93,0x67,
+0x00,0x0a,0x00,0xca,0x00,0x04,0x53,0xa8,0x99,0x30,0x51,0x71,0x00,0x27,0x00,0x00,
+0x20,0x60,0x30,0x00,0x37,0x1a,0x07,0x50,0x0a,0x99,0xc7,0x89,0x20,0x22,0xb4,0x22,
+0x20,0x00,0x2f,0xaa,0xb5,0x00,0x0a,0x96,0x0c,0x00,0x09,0x80,0x9b,0x40,0x06,0x60,
+0x6a,0x9b,0x50,0x00,0x64,0x00,0x27,0x50,0x3d,0x9d,0x96,0x66,0x30,0xa0,0x92,0xb4,
+0x75,0x0a,0x8d,0x18,0x27,0x20,0xa8,0xd1,0x47,0xa0,0x0a,0x09,0x10,0xc7,0x01,0xb7,
+0xd9,0x0c,0x50,0x27,0x49,0x18,0x5b,0x20,0x00,0x95,0x70,0x28,0xe0,0x02,0xf2,0x18,
+0x60,0x00,0x01,0x99,0x9c,0xa9,0x95,0x00,0x5a,0x09,0x42,0x00,0x83,0xa0,0x91,0xa1,
+0x03,0x07,0x06,0x01,0x10,0x5d,0xa9,0x9d,0x50,0x00,0x1a,0x38,0x80,0x00,0x04,0x8c,
+0xc5,0x20,0x19,0x51,0x00,0x59,0x60,0xc1,0x06,0xf6,0x1f,0xff,0xea,0x00,0x07,0xb9,
+0x57,0xaa,0x10,0x69,0xa0,0x89,0xa0,0x0b,0x7a,0x9b,0x7a,0x50,0x86,0x88,0x88,0x36,
+0x00,0xa5,0x55,0xa2,0x00,0x0a,0x66,0x6b,0x20,0x17,0xc7,0x77,0xb8,0x50,0x8a,0xaa,
+0xaa,0x9a,0x00,0x00,0x0b,0xa0,0x00,0x00,0xba,0x07,0x00,0xb0,0xca,0xaa,0xaa,0xda,
+0x00,0x00,0x0a,0x09,0xaa,0xaa,0xa9,0x3f,0x02,0x13,0xa0,0x90,0x03,0x22,0xaa,0xa0,
+0x43,0x04,0xf0,0x18,0x40,0x3a,0x10,0x1b,0x40,0x00,0x2b,0x13,0x10,0x00,0x00,0x22,
+0x2a,0xaa,0xaa,0xac,0x70,0x00,0x00,0x01,0x90,0x04,0xba,0xb4,0x19,0x00,0x54,0x05,
+0x51,0x90,0x05,0x40,0x55,0x19,0x00,0x5c,0xaa,0x31,0x90,0xf3,0x06,0x70,0x00,0x00,
+0x00,0x9b,0x60,0x00,0x05,0x07,0x08,0xf2,0x09,0x04,0x00,0x02,0x80,0x05,0x80,0x2e,
+0xa9,0x99,0xb6,0x01,0x00,0x00,0x04,0x09,0xaa,0xaa,0xe0,0x09,0x10,0x00,0xb0,0x09,
+0xba,0x08,0x00,0x32,0x00,0x01,0x40,0x41,0x02,0x60,0x1a,0xad,0xaa,0xaa,0x60,0x02,
+0x3d,0x00,0xf0,0x03,0xbb,0xaa,0xaa,0x00,0xaa,0x40,0x00,0xa0,0x34,0x54,0x00,0x0a,
+0x00,0x05,0xca,0xaa,0xe0,0x00,0x09,0x00,0xf2,0x07,0x08,0xa9,0x99,0xd1,0x00,0x8a,
+0x99,0x9d,0x10,0x12,0x22,0x22,0x22,0x04,0x6d,0x66,0x66,0x61,0x02,0xd8,0x88,0x80,
+0xaf,0x07,0x01,0x86,0x02,0x24,0x19,0xa5,0x0c,0x04,0x10,0x33,0xf1,0x02,0xe1,0xca,
+0x00,0x00,0x00,0x5a,0x02,0xa3,0x00,0x1c,0xca,0x99,0xaa,0x90,0x01,0x18,0x00,0x51,
+0xc9,0x99,0x99,0x00,0x00,0x9c,0x03,0x32,0xe9,0x99,0x9a,0x0a,0x00,0xf0,0x26,0xea,
+0xaa,0xaa,0xa8,0xa3,0x77,0x77,0x28,0xa0,0x11,0x11,0x28,0xa0,0xd8,0x89,0x18,0xa0,
+0x90,0x0a,0x18,0xa0,0xd9,0x98,0x18,0xa0,0x50,0x00,0x18,0xa0,0x00,0x04,0xa5,0x00,
+0x04,0x20,0x00,0x00,0x4f,0xa9,0xa4,0x08,0x80,0x00,0xa1,0x14,0x4a,0x2a,0x30,0x00,
+0x2a,0xb1,0x00,0x3b,0x3e,0x00,0x00,0x3d,0x00,0x13,0xb9,0x08,0x00,0x30,0x00,0x02,
+0x43,0x18,0x02,0x22,0x20,0x0a,0x67,0x08,0x21,0xaa,0xa5,0x93,0x00,0xf4,0x00,0xb3,
+0xc9,0x99,0xc0,0x0b,0x36,0x00,0x0a,0x07,0x73,0xc9,0x99,0xc0,0x71,0x36,0x13,0x04,
+0x20,0x06,0x00,0x77,0x03,0xf1,0x0e,0x00,0xda,0xaa,0xaa,0xb6,0xa0,0x00,0x00,0x36,
+0xa0,0xd9,0xa8,0x36,0xa0,0x90,0x18,0x36,0xa0,0xd9,0xa7,0x36,0xa0,0x50,0x00,0x36,
+0xa0,0x00,0x08,0xb4,0x60,0x07,0xf2,0x0d,0xaa,0x39,0x9a,0xa0,0x18,0x71,0x80,0x18,
+0x01,0x87,0x19,0x03,0x60,0x18,0x72,0xd9,0xab,0x31,0xa9,0x10,0x00,0x45,0x1a,0x45,
+0x99,0x97,0x30,0x10,0x7f,0x08,0x13,0x9a,0x5e,0x08,0xf0,0x05,0xcd,0x99,0x50,0x00,
+0x5f,0x43,0x00,0x04,0xb7,0xa1,0x7a,0x22,0x81,0x09,0x00,0x25,0x01,0xa9,0xa9,0x97,
+0xba,0x03,0x90,0xa0,0x02,0xc8,0x88,0x9a,0x00,0x28,0x00,0x01,0xd9,0x09,0x00,0x83,
+0x07,0xf0,0x07,0x8a,0x30,0x00,0x05,0xb5,0x82,0x99,0x20,0x27,0x65,0x69,0x53,0x60,
+0x00,0x44,0x45,0xc1,0x00,0x01,0x88,0x8d,0xa6,0x25,0x04,0x62,0x0a,0x00,0x02,0xc8,
+0x88,0x8a,0x0a,0x00,0x00,0xc5,0x0a,0x00,0x51,0x01,0xf3,0x0b,0x0a,0x99,0x99,0x9a,
+0x0a,0x44,0x44,0x4a,0x0a,0x55,0x55,0x53,0x0a,0x7a,0x99,0x9a,0x0b,0x91,0x00,0x0a,
+0x47,0x9a,0x99,0x9c,0x81,0x91,0xcb,0x00,0xf0,0x03,0x80,0x64,0x00,0x00,0x1c,0x06,
+0x40,0x00,0x08,0xa9,0xcb,0x99,0x00,0x91,0x17,0x51,0x11,0x17,0xb7,0x06,0xf3,0x23,
+0x1a,0x99,0x9a,0x70,0x01,0x90,0x00,0x09,0x00,0x1d,0x99,0x99,0x90,0x01,0x90,0x00,
+0x19,0x00,0x0a,0xa9,0xd9,0x9c,0x0a,0x38,0xd8,0x4a,0x0a,0x11,0xa1,0x1a,0x0a,0x46,
+0x66,0x5a,0x0a,0x2a,0x89,0x3a,0x0a,0x26,0x05,0x4a,0x28,0x2b,0x88,0x2a,0x72,0x00,
+0x01,0x9a,0xe1,0x02,0x00,0xc5,0x0b,0xf0,0x0f,0x90,0x00,0x06,0xc6,0x26,0xc5,0x05,
+0x63,0x77,0x72,0x65,0x0a,0x9a,0x2b,0x9a,0x00,0x90,0x92,0x70,0xa0,0x0a,0x3a,0x27,
+0x0a,0x00,0xb6,0x52,0x78,0x50,0x02,0x5b,0x03,0xf0,0x15,0x00,0x15,0x00,0x00,0x59,
+0xd4,0x5a,0xa9,0x00,0xa0,0x63,0x0a,0x7a,0xe9,0x93,0x0a,0x07,0xe2,0x63,0x0a,0x19,
+0xaa,0x73,0x0a,0xa2,0xa1,0x73,0x0a,0x20,0xa0,0x6b,0xac,0x00,0xa0,0x10,0x02,0x65,
+0x01,0xf1,0x15,0x05,0x97,0x02,0xb0,0x00,0x80,0x9a,0x88,0x8c,0x28,0x09,0x83,0x76,
+0x72,0x80,0x98,0x70,0x77,0x28,0x59,0x87,0x07,0x72,0x85,0x38,0x78,0x67,0x20,0x00,
+0x80,0x00,0x72,0x00,0x08,0x00,0x3b,0xc1,0x06,0xf2,0x16,0x1c,0x9b,0x4b,0x9a,0x01,
+0x93,0xa4,0x73,0xa0,0x05,0x5a,0x39,0x93,0x06,0x9b,0xc9,0xcb,0x92,0x08,0x80,0x03,
+0xa4,0x07,0xd9,0xb5,0xba,0xc2,0x09,0x0a,0x54,0x18,0x00,0xc9,0xb5,0xb9,0x80,0xea,
+0x04,0x03,0x81,0x0a,0xa0,0xd9,0x9a,0x0a,0xa0,0xa0,0x0a,0x08,0x00,0x00,0x10,0x00,
+0x04,0x18,0x00,0xf2,0x32,0xd9,0x9b,0x99,0x9a,0x90,0x0a,0x00,0x0a,0x98,0x9d,0x99,
+0x3a,0x90,0x0d,0x20,0x0a,0x90,0x75,0x93,0x0a,0x96,0x70,0x0a,0x2a,0xd9,0x88,0x88,
+0x8a,0x90,0x00,0x00,0x0a,0x0d,0x99,0xb9,0x99,0xa0,0x96,0x8d,0x88,0x3a,0x09,0x14,
+0xc4,0x40,0xa0,0x91,0x3b,0x33,0x0a,0x09,0x88,0xd8,0xa6,0xa0,0x90,0x0a,0x28,0x2a,
+0x0d,0x88,0xa8,0x88,0xa0,0x90,0x44,0x00,0xf0,0x26,0xa8,0xa0,0x0a,0x00,0x18,0xa6,
+0x8d,0x88,0x58,0xa1,0x8d,0x86,0x18,0xa2,0x60,0x0a,0x18,0xa2,0x97,0x78,0x18,0xd8,
+0x88,0x88,0x98,0xa0,0x00,0x00,0x28,0xd9,0x99,0x99,0xa9,0xa5,0x9a,0x99,0x29,0xa0,
+0x09,0x00,0x19,0xa3,0x9d,0x98,0x19,0xa0,0x09,0x18,0x19,0xa6,0x89,0x88,0x49,0x18,
+0x00,0xf0,0x3b,0xa0,0x00,0x00,0x19,0xd9,0xab,0x99,0x9a,0xa0,0x9a,0x89,0x0a,0xa8,
+0x86,0x83,0x0a,0xa3,0x89,0x97,0x2a,0xa6,0x28,0x52,0x3a,0xa0,0x87,0x60,0x0a,0xa0,
+0x12,0x67,0x0a,0xd8,0x88,0x88,0x8a,0x0d,0x88,0x88,0x8a,0x70,0x95,0x97,0x7a,0x37,
+0x09,0x37,0x77,0x63,0x70,0x98,0x88,0x8c,0x37,0x09,0x80,0x90,0x93,0x70,0x93,0x59,
+0x96,0x37,0x0a,0x95,0x00,0x75,0x70,0xd8,0x88,0x88,0xa7,0x00,0x01,0x13,0x01,0xf0,
+0x14,0x82,0x00,0x00,0x1a,0xbd,0xaa,0xaa,0x60,0x09,0x20,0x32,0x00,0x08,0xa3,0x8b,
+0xa8,0x23,0x7a,0x01,0x75,0x10,0x00,0xa0,0x06,0x40,0x00,0x0a,0x00,0x64,0x00,0x00,
+0xa7,0xac,0xba,0x60,0xf0,0x1f,0x00,0x00,0x01,0x00,0x00,0x90,0x00,0xa0,0x00,0x09,
+0x01,0x0a,0x00,0x07,0xd9,0x64,0xb8,0xb0,0x09,0x17,0xdd,0x0a,0x00,0x92,0xb4,0xa0,
+0xa0,0x09,0x36,0x3a,0x0a,0x08,0xb7,0x63,0x14,0x84,0x10,0x05,0x40,0x04,0x50,0x00,
+0x2a,0x99,0xb1,0x00,0x01,0x00,0xf1,0x19,0x80,0x00,0x18,0x00,0x08,0x00,0x01,0x80,
+0x03,0xa4,0x22,0x18,0x00,0x1a,0x34,0x71,0xda,0x50,0x80,0x47,0x18,0x00,0x08,0x77,
+0x71,0x80,0x07,0xb5,0x47,0x18,0x00,0x20,0x04,0x72,0x90,0x00,0x03,0x99,0x99,0x95,
+0x2d,0x00,0xf5,0x1a,0xa0,0x05,0x50,0x00,0x0a,0x00,0xc7,0x66,0x07,0xd9,0x78,0x44,
+0xb0,0x0a,0x08,0x60,0x09,0x00,0xa0,0x02,0xb0,0x90,0x0a,0x22,0x02,0x79,0x02,0xc9,
+0x17,0x91,0x90,0x73,0x04,0x40,0x0a,0x00,0x00,0x00,0x7a,0x60,0x00,0x01,0x00,0xf2,
+0x6a,0x81,0x00,0xa0,0x00,0x08,0x12,0x5c,0x54,0x05,0xca,0x36,0xc6,0xb0,0x08,0x10,
+0x0a,0x0a,0x00,0x81,0x79,0xd9,0xd4,0x09,0xa1,0x3c,0x60,0x07,0x81,0x0a,0x1a,0x00,
+0x00,0x1a,0x50,0x2b,0x20,0x02,0x20,0x00,0x12,0x00,0x00,0x00,0x0a,0x02,0xca,0xd7,
+0x81,0xa0,0x5c,0xad,0x88,0x1a,0x00,0x90,0xa0,0x81,0xa0,0x28,0x09,0x00,0x2a,0x03,
+0x00,0x38,0x06,0x30,0x08,0x99,0xd9,0x93,0x00,0x00,0x0a,0x00,0x00,0x79,0x99,0x99,
+0x99,0x30,0x00,0xa0,0x01,0x90,0x03,0xae,0xaa,0xbe,0xa0,0x00,0xd7,0x78,0x90,0x00,
+0x0c,0x44,0x59,0x00,0x00,0xc4,0x45,0x90,0x07,0x9d,0x88,0x9d,0x93,0x5c,0xa9,0xb8,
+0xaa,0x24,0x10,0x09,0x00,0x20,0x08,0x89,0xd8,0x86,0x7f,0x00,0xf2,0x19,0x90,0x12,
+0xa3,0x20,0x09,0x04,0x7c,0x77,0x25,0xd9,0x29,0x97,0x90,0x09,0x12,0xb7,0x7b,0x00,
+0x90,0x2a,0x66,0xa0,0x09,0x12,0xa6,0x6b,0x03,0xc9,0xac,0x99,0xd5,0x21,0x02,0x91,
+0x57,0x00,0x00,0x70,0x00,0x43,0x2d,0x00,0xf0,0x18,0x0a,0x06,0x50,0x09,0x06,0xb9,
+0xd9,0x05,0xd8,0x84,0x84,0x90,0x0a,0x08,0x58,0x58,0x00,0x90,0x78,0x98,0x90,0x09,
+0x02,0x97,0x77,0x04,0xc8,0x4a,0x77,0xa0,0x10,0x04,0xa7,0x7a,0x00,0x00,0x46,0x00,
+0xa0,0x62,0x01,0xf1,0x12,0x01,0x99,0x9d,0x99,0x95,0x02,0x44,0xb5,0x44,0x00,0x24,
+0x44,0x44,0x40,0x05,0xb9,0xd9,0x9d,0x00,0x64,0x09,0x00,0xa0,0x08,0x99,0x99,0x9d,
+0x00,0xb0,0x00,0x00,0x00,0x33,0x52,0x00,0x10,0x05,0xd7,0x00,0xf0,0x63,0xb9,0x9b,
+0x00,0x2b,0x89,0x2b,0x40,0x00,0x25,0xcc,0xa5,0x20,0x8c,0x94,0x34,0x8a,0x50,0xa5,
+0x5c,0x59,0x50,0x0a,0x98,0xd8,0xb5,0x00,0xa0,0x0a,0x05,0x50,0x0a,0x99,0x99,0xb5,
+0x00,0x00,0x50,0x00,0x00,0x00,0x4d,0x88,0x88,0x82,0x39,0x87,0x77,0x75,0x00,0x0c,
+0x77,0x77,0xa0,0x00,0xc7,0x66,0x6a,0x00,0x08,0xc7,0x77,0x30,0x09,0x79,0x26,0xa0,
+0x01,0x47,0xab,0xb8,0x63,0x35,0x30,0x00,0x03,0x30,0x03,0x70,0x0a,0x00,0x00,0x75,
+0x00,0xa0,0x00,0x0b,0xab,0x6a,0x00,0x03,0x90,0x73,0xa6,0x00,0x97,0x3b,0x0a,0x78,
+0x00,0x09,0x90,0xa0,0x63,0x00,0xb2,0x0a,0x00,0x00,0x96,0x00,0xa0,0x00,0x75,0x00,
+0x85,0x01,0xf1,0x16,0x01,0x50,0x00,0x00,0x02,0xcb,0x9a,0x00,0x08,0x94,0x09,0x50,
+0x00,0x00,0xbb,0x70,0x00,0x1a,0xb5,0x7f,0x99,0x30,0x04,0xb7,0x02,0xb0,0x00,0x60,
+0x88,0xb1,0x00,0x13,0x7a,0x70,0x00,0x19,0x63,0xa5,0x00,0x50,0xa1,0x00,0x00,0x00,
+0x0b,0x09,0x00,0xf4,0x14,0xb0,0x00,0x02,0xaa,0xaf,0xca,0xa7,0x00,0x01,0xca,0x00,
+0x00,0x00,0x84,0x93,0x00,0x00,0x3a,0x01,0xb0,0x00,0x6b,0x00,0x05,0xb2,0x16,0x00,
+0x00,0x02,0x50,0x09,0xaa,0xca,0xaa,0x20,0x29,0x00,0xfd,0x0b,0x01,0xaa,0xbf,0xca,
+0xa6,0x00,0x03,0xba,0x00,0x00,0x01,0xc1,0x65,0x00,0x04,0xc3,0x00,0x97,0x02,0x81,
+0x00,0x00,0x37,0x00,0x00,0xa0,0x4d,0x00,0xf2,0x57,0xba,0x00,0x00,0x00,0x75,0x83,
+0x00,0x00,0x2d,0x11,0xb0,0x00,0x4c,0x4b,0x15,0xa1,0x29,0x10,0x25,0x04,0x80,0x00,
+0x90,0xa0,0x00,0x00,0x1b,0x0a,0x00,0x00,0x08,0xba,0xea,0xaa,0x00,0xa0,0x0b,0x00,
+0x00,0x2a,0xaa,0xea,0xaa,0x70,0x00,0x2b,0x90,0x00,0x00,0x1c,0x26,0x60,0x00,0x6b,
+0x30,0x08,0xa4,0x15,0x00,0x00,0x01,0x40,0x00,0x00,0x91,0x00,0x00,0x00,0x09,0x10,
+0x00,0x09,0xaa,0xda,0xaa,0x30,0x0a,0x0a,0x08,0x30,0x00,0x81,0xb1,0x80,0x02,0x99,
+0xaf,0xc9,0x96,0x00,0x07,0x5a,0x20,0x00,0x07,0x90,0x1b,0x50,0x1a,0x50,0x00,0x06,
+0x73,0x02,0xf5,0x18,0x54,0x02,0x22,0x30,0x07,0x20,0x69,0x9e,0x25,0xda,0x90,0x06,
+0x50,0x0a,0x09,0x00,0xb0,0x01,0x81,0x9a,0xae,0xa6,0x2b,0x84,0x00,0xa0,0x00,0x3f,
+0x20,0x0a,0x00,0x09,0x6b,0x00,0xa0,0x06,0x60,0x02,0xa8,0x9f,0x02,0x00,0xca,0x01,
+0xf0,0x1a,0xb0,0x00,0x09,0x00,0x37,0x20,0x08,0xda,0x2a,0x03,0x80,0x17,0x78,0xc8,
+0x9e,0x15,0x3a,0x23,0x10,0x22,0x58,0xa0,0xc9,0x9c,0x00,0x7b,0x19,0x00,0xa0,0x4b,
+0x23,0xc8,0x8c,0x07,0x20,0x09,0x11,0xa0,0x04,0xaa,0xaa,0x16,0x01,0xb5,0x89,0x00,
+0x00,0x00,0x93,0x00,0x03,0xaa,0xad,0xba,0xa8,0x9a,0x00,0x01,0x09,0x00,0x40,0x02,
+0xab,0x00,0x00,0xc7,0x01,0xf2,0x08,0x04,0xaa,0xae,0xaa,0xa0,0x74,0x00,0x00,0x0a,
+0x01,0x09,0xaa,0xd7,0x20,0x00,0x00,0x85,0x00,0x05,0xaa,0xae,0xaa,0xa1,0x19,0x01,
+0x00,0x98,0x01,0xf0,0x00,0x2a,0x80,0x00,0x00,0x00,0x04,0x30,0x00,0x01,0x99,0xda,
+0x99,0x95,0x00,0x48,0x2f,0x01,0xf1,0x0a,0x19,0x99,0xa0,0x0a,0xa0,0x01,0x92,0x04,
+0x59,0x79,0xbc,0x98,0x00,0x90,0x04,0x60,0x00,0x09,0x00,0x36,0x00,0x00,0x90,0x6b,
+0x40,0xa2,0x00,0xf6,0x0c,0x02,0x10,0x60,0x05,0x00,0x2a,0x1a,0x27,0x60,0x0b,0x77,
+0x77,0x78,0x80,0x58,0x99,0x99,0x26,0x00,0x00,0x59,0x30,0x02,0x99,0x9e,0x99,0x96,
+0x56,0x00,0x10,0x49,0x09,0x00,0xf1,0x0a,0x03,0x00,0x00,0x11,0x19,0x41,0x10,0xd8,
+0x88,0x88,0x98,0x72,0x00,0x00,0x16,0x0b,0x00,0x4b,0x20,0x0b,0x9a,0x71,0x00,0x0b,
+0x10,0x93,0x01,0x50,0x55,0x06,0xba,0xaa,0xc1,0xed,0x02,0xf1,0x28,0x00,0x89,0x9e,
+0xa9,0x93,0x0a,0x01,0x50,0x05,0x50,0x20,0x74,0x00,0x11,0x1a,0xbd,0xaa,0xea,0x60,
+0x0a,0x40,0x75,0x00,0x00,0x39,0xac,0x00,0x00,0x04,0xa7,0x6c,0x60,0x08,0x61,0x00,
+0x07,0x10,0x00,0x00,0x60,0x00,0x00,0x77,0x7e,0x87,0x73,0x09,0x22,0x22,0x26,0x60,
+0x48,0x99,0x99,0x33,0x8c,0x00,0xf1,0x03,0x9a,0xd9,0xe9,0x96,0x00,0x38,0x0a,0x00,
+0x00,0x09,0x30,0xa0,0x07,0x1a,0x60,0x08,0xaa,0x70,0x47,0x01,0x00,0x56,0x00,0x60,
+0x0a,0xaa,0xda,0xaa,0x60,0x0a,0x25,0x04,0x80,0x03,0x8a,0xba,0xa3,0x30,0x00,0x30,
+0xa0,0x06,0x02,0xf5,0x04,0xa9,0x96,0x00,0x02,0xe0,0xa0,0x00,0x00,0x09,0x5a,0xb0,
+0x00,0x00,0x39,0x02,0xba,0xaa,0x90,0x00,0x32,0x00,0xf2,0x14,0x99,0x9d,0xb9,0x93,
+0x0a,0x42,0x24,0x04,0x60,0x21,0x95,0x50,0x01,0x02,0xb1,0x63,0x00,0x00,0x89,0x8c,
+0x98,0x85,0x00,0x06,0x97,0x40,0x00,0x49,0x90,0x07,0xa2,0x04,0x10,0x00,0x01,0x88,
+0x00,0xf0,0x0d,0xa9,0x9d,0x99,0xa2,0x09,0x25,0x04,0x36,0x30,0x5a,0x1b,0x27,0x70,
+0x03,0x1a,0x39,0x32,0x00,0x8f,0x98,0x8e,0xa2,0x15,0xa1,0x11,0xa2,0x20,0x09,0xff,
+0x00,0x41,0xb9,0x99,0xd0,0x00,0x44,0x03,0xf1,0x16,0xa9,0x9c,0x99,0x97,0x18,0x3a,
+0x3a,0x42,0x90,0x04,0xb4,0xb4,0x30,0x00,0xa9,0x99,0xa4,0x00,0x0a,0x07,0x07,0x60,
+0x00,0xa0,0xa1,0x76,0x00,0x01,0x97,0x50,0x09,0x18,0xa3,0x1a,0x99,0x80,0x10,0x7f,
+0x00,0xc0,0x08,0x20,0x00,0x00,0x00,0x82,0x00,0x7a,0xaa,0xad,0xba,0x20,0x09,0x00,
+0xb3,0x06,0x40,0x08,0x20,0x00,0x0b,0x10,0x82,0x00,0x00,0x34,0x1b,0x00,0x35,0x00,
+0x05,0xbc,0x26,0x02,0xf2,0x16,0x54,0x05,0xbb,0x80,0x05,0x40,0x10,0x18,0x9a,0xcc,
+0x42,0x95,0x50,0x05,0x40,0x07,0xc1,0x72,0x54,0x00,0x1d,0x01,0x95,0x40,0x09,0x95,
+0x05,0x54,0x05,0x90,0x50,0x05,0x40,0x20,0x00,0x07,0xb2,0x58,0x00,0xf0,0x0d,0xa9,
+0x99,0x9a,0x00,0x8a,0x99,0x99,0x90,0x07,0x51,0x11,0x16,0x40,0x06,0x77,0x7a,0x60,
+0x29,0x99,0x99,0xe9,0x60,0x09,0x20,0x0a,0x00,0x00,0x1b,0xaf,0x01,0x22,0x15,0x98,
+0x53,0x00,0xf3,0x18,0x09,0x00,0x00,0xa0,0x0b,0xac,0x00,0x0a,0x00,0xb7,0xc6,0xaa,
+0xe6,0x0a,0x2b,0x00,0x0a,0x00,0xb6,0xc1,0x90,0xa0,0x6b,0xae,0x08,0x1a,0x00,0x1a,
+0xa0,0x11,0xa0,0x2a,0x29,0x00,0x0a,0x04,0x15,0xb0,0x39,0x60,0x01,0xf1,0x18,0xa0,
+0x08,0x40,0x01,0x0a,0x08,0xc9,0xa4,0x38,0xa6,0x66,0x3b,0x00,0x5a,0x02,0xc8,0x20,
+0x00,0xa5,0x61,0x0a,0x00,0x9b,0x8a,0x99,0xd7,0x64,0xa0,0xa1,0x0a,0x00,0x0a,0x02,
+0x60,0xa0,0x00,0xa0,0x03,0x97,0x78,0x03,0x01,0xee,0x01,0xf1,0x08,0x02,0x40,0xb0,
+0x51,0x00,0x74,0x0b,0x03,0x80,0x0b,0x00,0xb0,0x0b,0x02,0xa0,0x0b,0x00,0x65,0x62,
+0x00,0xb0,0x02,0x90,0x9c,0x03,0x10,0x4a,0x90,0x01,0x30,0xba,0xaa,0xaa,0xb8,0x02,
+0xd0,0xa0,0x09,0x10,0x00,0x0a,0x00,0xaa,0xac,0xba,0x70,0x0a,0x00,0x1a,0x3e,0x00,
+0xc0,0x92,0x00,0x56,0x00,0x01,0xb3,0x08,0x00,0x00,0x01,0x94,0x0b,0xcd,0x04,0xf1,
+0x10,0xb9,0x99,0x99,0xd0,0x0a,0x03,0x69,0x70,0x00,0xa4,0x5b,0x24,0x30,0x0a,0x6a,
+0xd8,0x52,0x00,0x91,0x3c,0x9a,0xa2,0x46,0x86,0xc0,0x02,0x38,0x10,0x06,0x99,0xa3,
+0x9e,0x00,0xf6,0x15,0x0a,0x99,0x99,0xb6,0x00,0xa8,0x88,0x8a,0x60,0x0a,0x22,0x22,
+0x22,0x00,0xb8,0x88,0x88,0xd0,0x09,0x39,0x8a,0x0a,0x00,0x94,0x40,0x90,0xa0,0x63,
+0x4a,0x89,0x0a,0x05,0x00,0x00,0x49,0x80,0x4d,0x00,0xf2,0x0a,0x06,0x30,0x81,0x00,
+0xa6,0x9b,0x8d,0x82,0x0a,0x01,0x80,0xa0,0x00,0xa9,0xbc,0x9d,0x94,0x46,0x0b,0x10,
+0xa0,0x07,0x1a,0x40,0x0a,0xeb,0x00,0x06,0x29,0x00,0xf1,0x10,0x16,0x41,0xa1,0x00,
+0xa5,0xa9,0x7c,0x71,0x0a,0x9b,0xb9,0xd9,0x40,0xa0,0xa0,0x94,0x80,0x46,0x1b,0x56,
+0xc5,0x05,0x03,0x73,0x00,0x54,0x08,0xaa,0xaa,0xaa,0x30,0xf9,0x02,0x05,0x02,0x03,
+0x04,0x09,0x00,0x51,0x3a,0xaa,0xeb,0xaa,0x70,0x79,0x05,0x91,0x01,0xa0,0x00,0x00,
+0x5a,0xcc,0xaa,0xaa,0x10,0xa4,0x03,0xf0,0x32,0xca,0xaa,0xa9,0x00,0x45,0x02,0x70,
+0x00,0x0b,0x00,0x27,0x00,0x08,0x50,0x02,0x70,0x00,0x51,0xaa,0xbd,0xaa,0x20,0x00,
+0x30,0x00,0x50,0x00,0x48,0xa5,0x6c,0x51,0x03,0x44,0xc4,0x44,0x10,0x39,0xbc,0x99,
+0x80,0x17,0x7a,0xa7,0x77,0x40,0x35,0xc3,0x33,0x32,0x03,0xc8,0x9d,0x99,0x02,0xa8,
+0x88,0xd8,0x85,0x00,0x11,0x11,0x11,0x00,0x9a,0xaa,0xba,0x02,0x90,0x01,0x90,0x90,
+0x00,0x01,0x90,0xaa,0xaa,0xaa,0xbf,0x04,0xf0,0x00,0x10,0xa0,0x00,0x00,0x07,0xa0,
+0x00,0x00,0x29,0x6b,0xaa,0xaa,0xb2,0x00,0x01,0x36,0x02,0xf2,0x38,0x74,0x00,0x00,
+0x2a,0xae,0xaa,0xaa,0x60,0x08,0x42,0x50,0x00,0x05,0xfa,0xbc,0xac,0x23,0x9a,0x02,
+0x70,0x72,0x00,0xa0,0x27,0x07,0x20,0x09,0x02,0x77,0x90,0x00,0x00,0x27,0x00,0x00,
+0x03,0x20,0x00,0x60,0x00,0x16,0xa9,0xc3,0x00,0x19,0xad,0x37,0xa2,0x06,0x99,0xe9,
+0x99,0x92,0x00,0xb1,0x40,0x00,0x01,0xbd,0x9d,0x9a,0x70,0x64,0x80,0xa0,0x28,0x00,
+0x28,0x0a,0x29,0x50,0xcd,0x00,0xf0,0x02,0xa0,0x90,0x54,0x02,0x9d,0x9d,0x9b,0xb6,
+0x00,0x50,0x40,0x32,0x00,0x99,0x99,0x99,0x94,0x6e,0x07,0xe2,0x70,0x3c,0x9d,0x99,
+0xa1,0x00,0x90,0xa0,0x0a,0x00,0x08,0x0a,0x09,0x60,0x29,0x00,0x20,0x00,0x00,0x7b,
+0x05,0xf2,0x16,0x92,0x10,0x04,0x80,0x09,0x98,0x07,0xac,0x87,0xd9,0x70,0x73,0x78,
+0x83,0x09,0x07,0x37,0x88,0x81,0x90,0x73,0x78,0x88,0x19,0x06,0x39,0x57,0xa0,0x80,
+0x03,0x70,0x58,0x92,0x00,0x37,0x68,0x00,0x7e,0x03,0xf0,0x16,0x17,0x0a,0x04,0x50,
+0x5c,0x5c,0x5b,0x62,0xc5,0x55,0x55,0x85,0x89,0x77,0x7c,0x34,0x0a,0x77,0x7d,0x00,
+0x02,0x2b,0x22,0x00,0x6a,0x8d,0x88,0xc0,0x63,0x0a,0x08,0xa0,0x00,0x0a,0x01,0x00,
+0x04,0x93,0x06,0xf2,0x15,0x45,0x0d,0x88,0xa5,0x7b,0xb7,0xa6,0x67,0x58,0x45,0x8a,
+0x88,0x85,0x84,0x58,0x88,0x8a,0x18,0x45,0x8b,0x77,0xb1,0x74,0x94,0xa5,0x5a,0x10,
+0x45,0x0a,0x33,0x91,0x04,0x50,0xb8,0x8c,0x10,0x29,0x00,0xf3,0x4e,0x28,0x88,0x83,
+0x7a,0xa6,0x97,0x7a,0x08,0x45,0x8a,0x88,0xc0,0x84,0x58,0x33,0x33,0x18,0x45,0xb9,
+0xb6,0x94,0x74,0x97,0xbc,0x8b,0x40,0x45,0x25,0x80,0x54,0x04,0x52,0xb8,0x8b,0x40,
+0x00,0x18,0x02,0x70,0x01,0x89,0xc8,0x9c,0x85,0x02,0x96,0x66,0x68,0x00,0x3a,0x66,
+0x66,0xa0,0x02,0x8a,0x76,0x67,0x03,0xab,0xeb,0xbb,0xa7,0x18,0xd9,0xb8,0xcb,0x51,
+0x2a,0x0a,0x04,0x63,0x00,0xa0,0xa1,0x93,0x00,0x08,0xaa,0xda,0xaa,0x20,0x06,0x0a,
+0x02,0x60,0x00,0xa0,0xa0,0x92,0x00,0x03,0x1a,0x04,0x1d,0x06,0x09,0xf0,0x01,0xe0,
+0x40,0x00,0x41,0x00,0x05,0x70,0x0b,0x00,0x09,0xac,0x9b,0xd9,0x40,0x02,0x17,0x07,
+0xf5,0x04,0x27,0x00,0xa0,0x02,0xac,0xca,0xae,0xa7,0x00,0x83,0x00,0xa0,0x00,0x1c,
+0x00,0x0a,0x00,0x0b,0x20,0x1f,0x01,0xf4,0x16,0x52,0x00,0x00,0xaa,0xab,0xca,0xa5,
+0x0a,0x27,0x77,0x74,0x00,0xa0,0x33,0x3a,0x10,0x0a,0x01,0x8e,0x20,0x00,0xa8,0x99,
+0xd9,0xd3,0x18,0x00,0x0a,0x28,0x05,0x40,0x00,0xa0,0x00,0x80,0x05,0x98,0xee,0x03,
+0xf1,0x14,0x71,0x00,0x00,0x89,0x9c,0xb9,0x94,0x0a,0x00,0x20,0x03,0x00,0xa6,0x18,
+0x20,0xb0,0x0a,0x37,0x36,0x37,0x00,0xa0,0xa0,0x89,0x10,0x28,0x03,0x01,0x90,0x06,
+0x49,0x99,0xcb,0x95,0x30,0x29,0x00,0x00,0x72,0x04,0xf0,0x14,0x89,0x9d,0xb9,0x94,
+0x0a,0x08,0x00,0x80,0x00,0xa8,0xd8,0x8d,0x83,0x0a,0x09,0x77,0xc0,0x00,0xa7,0x88,
+0x88,0x50,0x18,0x08,0x52,0xb2,0x06,0x43,0x6d,0xd8,0x41,0x31,0x52,0x00,0x15,0x2d,
+0x00,0x70,0x26,0x24,0x9c,0x29,0x9c,0x40,0x06,0x69,0x00,0xf2,0x0d,0xd9,0x29,0x0d,
+0x84,0x01,0x72,0x90,0xa0,0x00,0x9a,0x09,0x0a,0x00,0x07,0x90,0xc9,0xc9,0x60,0x8d,
+0x40,0x00,0x00,0x48,0x19,0xaa,0xaa,0x71,0x00,0x4e,0x03,0xf1,0x16,0x00,0x03,0x9d,
+0x38,0xd8,0x90,0x05,0x57,0x7d,0x7c,0x30,0xc9,0x48,0xd8,0xc0,0x00,0x92,0x3b,0x33,
+0x01,0x89,0x24,0xc4,0x40,0x09,0x58,0x8d,0x88,0x30,0x87,0x20,0x00,0x00,0x64,0x07,
+0xaa,0x99,0x1d,0x06,0xf2,0x14,0x4a,0xda,0xac,0xba,0x00,0x09,0x10,0x64,0x00,0x00,
+0x91,0x06,0x40,0x07,0xad,0xaa,0xcb,0xa2,0x00,0xb0,0x06,0x40,0x00,0x1a,0x00,0x64,
+0x00,0x0a,0x40,0x06,0x40,0x06,0x60,0x00,0x64,0x54,0x00,0x10,0x07,0x97,0x04,0xf2,
+0x0d,0x7a,0x99,0x99,0xa0,0x07,0x30,0x00,0x02,0x50,0x19,0x99,0x99,0xa2,0x00,0x42,
+0x00,0x70,0x02,0x9d,0xa9,0x9d,0x97,0x02,0xb0,0x00,0xa0,0x01,0xc2,0x5d,0x01,0x01,
+0x80,0x03,0x10,0x37,0x66,0x01,0x60,0x81,0x2a,0xaa,0xad,0xaa,0x70,0x08,0x05,0xf0,
+0x08,0x09,0xbb,0xa6,0x40,0x00,0x05,0x50,0x36,0x00,0x00,0x55,0x00,0xa0,0x30,0x18,
+0xba,0x3a,0x19,0x19,0x52,0x00,0x2b,0x80,0xa9,0x00,0xf1,0x04,0x09,0x99,0xc0,0x0a,
+0x00,0x00,0xa0,0x0a,0x0b,0x99,0x80,0x0a,0x0a,0x00,0x00,0x0a,0x1a,0x99,0xd0,0x10,
+0x00,0x01,0x04,0x00,0x21,0xab,0x50,0x53,0x00,0x70,0x39,0x9d,0x39,0x9d,0x00,0x99,
+0xd1,0x1a,0x00,0xf4,0x09,0x37,0x00,0x01,0xc9,0xa4,0xb9,0xa1,0x09,0x3a,0x19,0x29,
+0x00,0x09,0xc0,0x19,0xc0,0x4a,0x6b,0x4a,0x5a,0x00,0x19,0x80,0x38,0x13,0x06,0xf0,
+0x0a,0x20,0x02,0x06,0x9c,0x0a,0x08,0x30,0x11,0xa5,0x99,0xd9,0x08,0x98,0x81,0xa0,
+0xa0,0x90,0x08,0x8d,0x7c,0x05,0x8b,0x67,0xd7,0xa0,0x01,0x06,0x73,0x30,0x0a,0x00,
+0xa0,0x00,0x4a,0x60,0xa7,0x00,0xf2,0x15,0x49,0xc2,0xd8,0x8a,0x00,0x08,0x2b,0x55,
+0xa0,0x4a,0x91,0x3b,0x32,0x06,0x20,0x3b,0xd8,0xc0,0x5b,0xd4,0x6a,0x09,0x00,0x0a,
+0x28,0xd9,0x90,0x00,0xa0,0x0a,0x1b,0x00,0x99,0x7a,0xa9,0xa4,0xa3,0x01,0xf0,0x0f,
+0x0b,0x00,0x66,0x50,0xb0,0x56,0x09,0x0b,0x09,0x07,0x99,0xe9,0x97,0x01,0x11,0x11,
+0xb4,0x99,0x99,0x9b,0x00,0x00,0x00,0xb8,0x99,0x99,0x9b,0x11,0x11,0x11,0x2e,0x05,
+0x00,0x59,0x0a,0xf0,0x13,0x9b,0x80,0x03,0x77,0x77,0x97,0x00,0x12,0x22,0x26,0x60,
+0x19,0x99,0xe9,0x9a,0x60,0x59,0x0c,0x56,0x90,0x00,0x37,0xd9,0x80,0x00,0x8a,0x4b,
+0x09,0x71,0x02,0x09,0xa0,0x03,0x50,0x60,0x07,0xf5,0x15,0x06,0xd9,0xd9,0x08,0x50,
+0x09,0x08,0x19,0x40,0x00,0x90,0x81,0x00,0x90,0x7d,0x9d,0xa2,0xb3,0x00,0xa0,0x81,
+0x71,0x11,0x0a,0x08,0x10,0x0b,0x14,0x80,0x81,0x2b,0x30,0x91,0x08,0x3a,0x10,0x34,
+0x06,0xf0,0x17,0x03,0xee,0xec,0x06,0x80,0x39,0x44,0xb8,0x60,0x00,0x4a,0x43,0x00,
+0x80,0x59,0x99,0x92,0xa3,0x02,0xa5,0x5a,0x51,0x11,0x19,0xc9,0x50,0x0b,0x13,0x78,
+0x46,0x1a,0x30,0x53,0xb0,0x5a,0x20,0x00,0x00,0x1d,0x02,0xf0,0x3b,0x48,0x49,0x9b,
+0xa0,0x18,0x30,0x02,0xb0,0x00,0x1b,0x17,0x9a,0x60,0x1c,0x88,0x20,0x05,0x41,0x38,
+0x49,0xda,0x90,0x01,0x80,0x09,0x10,0x00,0x18,0x00,0x91,0x00,0x01,0x89,0x9d,0xa9,
+0x50,0x00,0xa0,0x01,0x80,0x00,0x0a,0x42,0x9a,0xd9,0x50,0x24,0x51,0x01,0x80,0x00,
+0x02,0xb7,0x9a,0xd9,0x90,0x2c,0x80,0x00,0x0a,0x00,0x23,0x86,0x99,0x9d,0x90,0x01,
+0x80,0x91,0x0a,0x00,0x01,0x80,0x28,0x05,0x00,0x40,0x01,0x99,0x00,0x00,0x8c,0x04,
+0xf2,0x3d,0xa2,0xa9,0x99,0xa0,0x62,0x5a,0x88,0x8a,0x00,0x94,0xa0,0x00,0xa0,0x7e,
+0x1a,0x9a,0x98,0x04,0x91,0xa0,0x91,0x90,0x08,0x1a,0x05,0xb2,0x00,0x81,0xa2,0x3b,
+0x40,0x08,0x1b,0x93,0x09,0x30,0x03,0x20,0x02,0x45,0x01,0x90,0xc8,0x7b,0x10,0x52,
+0x5d,0x89,0xc8,0x30,0xb1,0x90,0x37,0x00,0x8d,0x09,0xb9,0x9c,0x01,0x90,0x9b,0x77,
+0xc0,0x09,0x18,0xb6,0x6b,0x00,0x94,0x5b,0x77,0xc0,0x09,0x52,0xa0,0x09,0xcd,0x0a,
+0xf6,0x18,0x30,0x80,0x80,0x01,0xa2,0x28,0x4a,0x00,0x73,0x74,0x87,0xc7,0x40,0xa4,
+0x88,0x8a,0x64,0x7e,0x37,0x79,0xa9,0x11,0x90,0xb9,0x47,0xa0,0x09,0x09,0x39,0x58,
+0x00,0x93,0x74,0x7a,0xa0,0x09,0x71,0x07,0x23,0xfe,0x0b,0xf0,0x1c,0x45,0x11,0xb1,
+0x10,0x2a,0x29,0x9d,0x99,0x38,0x14,0x79,0xc8,0x80,0x08,0x38,0x70,0x79,0x05,0xf0,
+0x89,0x79,0x90,0x69,0x38,0x89,0x88,0x30,0x90,0x01,0x90,0x20,0x09,0x37,0x84,0x2a,
+0x00,0x96,0x0a,0x8a,0x32,0x00,0x05,0x20,0x4f,0x02,0xf3,0x0d,0x40,0x00,0x00,0x05,
+0x07,0x00,0x00,0x82,0x80,0x00,0xa0,0x0a,0x18,0x00,0x09,0x21,0xa1,0x80,0x03,0x47,
+0x24,0x19,0x00,0xa0,0x40,0x00,0xba,0xaa,0x52,0x00,0x10,0x95,0x74,0x03,0xf6,0x0e,
+0x85,0x83,0x00,0x20,0xa0,0x29,0x00,0x0a,0x0a,0x1b,0x39,0x00,0xa0,0xba,0x10,0x92,
+0x34,0x2e,0x20,0x22,0x70,0x8a,0xa0,0x09,0x10,0x23,0x0a,0xaa,0xb0,0x23,0x04,0x41,
+0x29,0x99,0xda,0x99,0x35,0x04,0xf0,0x0b,0x06,0x99,0xa9,0x99,0x10,0x00,0x1b,0x10,
+0x00,0x06,0x54,0x2b,0x08,0x00,0x95,0x50,0x04,0x94,0x14,0x2b,0x99,0xb1,0x60,0x0a,
+0x00,0x0a,0x2c,0x00,0xf2,0x12,0xa0,0x00,0x5a,0x87,0xae,0xaa,0x08,0xa4,0x00,0xa0,
+0xa0,0x3a,0x2a,0xad,0xae,0x40,0xa0,0x05,0xe2,0x00,0x0a,0x00,0xa2,0xa0,0x00,0xa0,
+0x58,0x09,0x70,0x0a,0x49,0x00,0x09,0x87,0x09,0xf5,0x19,0x41,0x00,0x00,0x00,0x1e,
+0x99,0x99,0x70,0x1b,0x1a,0x1a,0x0a,0x02,0x28,0x54,0x60,0xa0,0x07,0x53,0xa0,0x28,
+0x00,0x00,0x63,0x48,0x10,0x06,0x70,0xa1,0x15,0x04,0x5a,0x01,0x35,0x91,0x40,0x79,
+0x99,0x82,0x20,0x03,0x0b,0xf0,0x11,0x29,0x99,0xed,0x99,0x60,0x00,0x65,0x92,0x00,
+0x00,0x6b,0x61,0xc4,0x01,0xb6,0x06,0x50,0x88,0x05,0x43,0x93,0x07,0x00,0xb5,0x40,
+0x63,0x93,0x16,0x2b,0x99,0xb2,0x60,0x0a,0x06,0xf0,0x00,0x00,0x06,0x80,0x2a,0x20,
+0x06,0xb9,0x88,0x8a,0x20,0x0a,0x88,0x88,0x70,0x00,0xd0,0x01,0xf2,0x54,0x08,0x9b,
+0x88,0x50,0x01,0x12,0xb5,0x02,0x00,0xa6,0x40,0x62,0x75,0x17,0x3b,0x99,0xb2,0x70,
+0x00,0x53,0x00,0x00,0x00,0x3c,0x88,0xd0,0x00,0x5f,0x98,0xac,0x80,0x01,0x13,0x33,
+0x3a,0x10,0x03,0x55,0x55,0xb1,0x00,0x78,0x99,0x8a,0x10,0x00,0x22,0x90,0x23,0x04,
+0x7a,0x07,0x25,0xb0,0x70,0x79,0x99,0x65,0x10,0x00,0x22,0x00,0x40,0x00,0x01,0xb0,
+0x1b,0x00,0x00,0xbc,0xac,0xb8,0x00,0x19,0x00,0x00,0xb0,0x01,0xda,0xaa,0xab,0x00,
+0x00,0x08,0x00,0x00,0x05,0x25,0x2a,0x07,0x10,0x93,0x70,0x32,0x49,0x13,0x1c,0x99,
+0xb3,0xbe,0x04,0xf3,0x19,0x43,0x08,0x10,0x00,0x04,0x30,0x90,0x00,0x00,0x9a,0x9d,
+0x9a,0x94,0x2a,0x92,0x90,0x90,0x04,0x73,0x27,0x98,0x72,0x04,0x37,0x66,0x99,0x00,
+0x45,0x90,0x4d,0x10,0x04,0x61,0x0b,0x38,0x00,0x43,0x0a,0x20,0x65,0x7a,0x01,0xf2,
+0x64,0x61,0x00,0x00,0x0a,0x8b,0x88,0x80,0x00,0xc7,0x77,0x7a,0x00,0x0b,0x33,0x33,
+0xa0,0x00,0xb4,0x44,0x4a,0x00,0x08,0x8c,0x88,0x60,0x02,0x21,0x75,0x05,0x10,0xb6,
+0x40,0x62,0x58,0x24,0x3b,0x99,0xb2,0x40,0x00,0xc7,0x77,0xa6,0x00,0x0b,0x66,0x69,
+0x60,0x00,0xc7,0x77,0x96,0x01,0x8a,0xc8,0x8d,0x86,0x06,0xe9,0x88,0xa9,0x00,0x20,
+0x0a,0x20,0x60,0x0a,0x39,0x26,0x3a,0x12,0x50,0xb8,0x88,0x16,0x09,0x01,0x1b,0x11,
+0x00,0x91,0x88,0xd8,0x82,0x4b,0x86,0x7d,0x77,0x07,0x93,0x88,0xc8,0x84,0x49,0x05,
+0x88,0x88,0x00,0x90,0x95,0x55,0xb0,0x09,0x09,0x33,0x3b,0x00,0x90,0x98,0x77,0xc0,
+0x09,0x09,0x00,0x79,0x62,0x05,0xf0,0x07,0x69,0xa9,0x9b,0x81,0x06,0x8c,0x67,0xc6,
+0x40,0x28,0x88,0x88,0x51,0x00,0xc6,0x66,0x78,0x00,0x0c,0x77,0x78,0x80,0xdd,0x00,
+0xa3,0x00,0x84,0x83,0x63,0x91,0x07,0x0b,0x99,0x81,0x40,0xa4,0x00,0xf1,0x17,0xa7,
+0x40,0x08,0x88,0x8d,0x9c,0x40,0xa6,0x77,0x90,0x60,0x0a,0x57,0x66,0x85,0x01,0x99,
+0x18,0x3d,0x04,0x74,0x45,0x59,0x6a,0x51,0x03,0x1a,0x00,0x10,0x0a,0x90,0x53,0x5b,
+0x04,0x37,0x98,0x88,0x32,0xce,0x02,0xf3,0x15,0x91,0x8d,0xcc,0x80,0x6a,0x88,0x76,
+0x68,0x07,0x94,0x88,0x88,0x80,0x49,0x0b,0xa4,0xab,0x00,0x91,0x99,0x99,0x60,0x09,
+0x02,0xa1,0x93,0x00,0x90,0x07,0xea,0x00,0x09,0x4b,0x62,0x6c,0x10,0x8f,0x05,0xf3,
+0x40,0x63,0x04,0x99,0x70,0xa0,0xa0,0x11,0x0a,0x0b,0x57,0x31,0xa4,0x89,0xd5,0x51,
+0x06,0xd2,0x0b,0x0b,0x00,0x1f,0x10,0x89,0x50,0x09,0x6a,0x06,0xb0,0x17,0x80,0x34,
+0xbc,0x38,0x10,0x00,0x70,0x4d,0x30,0x00,0x00,0x37,0xa2,0x00,0x00,0x02,0x81,0xa0,
+0x0c,0xaa,0xbd,0xaa,0x50,0xa0,0x00,0xa0,0x50,0x0c,0x9d,0x0b,0x38,0x00,0xa0,0xa0,
+0xba,0x00,0x0a,0x0a,0x09,0x70,0x33,0x87,0x67,0xaa,0x18,0x72,0x05,0x70,0x6c,0x30,
+0x66,0x05,0xf0,0x17,0x48,0x00,0x55,0x55,0xc5,0x95,0x16,0x66,0x6d,0x76,0x40,0x69,
 0x94,0x91,0x71,0x09,0x02,0x77,0x4a,0x00,0xa9,0xa7,0x4d,0x20,0x00,0x00,0x14,0xc0,
-0x41,0x8b,0xaa,0xcb,0x19,0x03,0x01,0xa0,0x2c,0xfe,0x09,0xf6,0x19,0x16,0x51,0x93,
-0x60,0x08,0xba,0x79,0x17,0x32,0x8b,0xa8,0xc9,0x96,0x03,0x47,0x07,0x42,0x10,0xc9,
-0xc8,0x55,0xa0,0x2c,0x7b,0x62,0xa7,0x00,0x86,0xb6,0x0e,0x13,0x08,0x8c,0x87,0xc1,
-0x80,0x80,0x05,0x71,0xb7,0xd6,0x0c,0xf5,0x15,0x7a,0xa3,0x8a,0xa2,0x0b,0x10,0x29,
-0x00,0x00,0xd8,0xd2,0xa4,0x42,0x0a,0x0a,0x2b,0x5c,0x30,0xd9,0x93,0x70,0xa0,0x19,
-0x00,0x55,0x0a,0x04,0x60,0x0a,0x10,0xa0,0x71,0x02,0x90,0x0a,0x00,0xc3,0x06,0x40,
-0x79,0x9d,0x99,0x80,0x51,0x14,0x00,0x75,0x09,0xf6,0x08,0x80,0x0a,0x78,0x87,0x8a,
-0x00,0xa5,0x29,0x44,0x80,0x0a,0x07,0xa0,0x6b,0x04,0x79,0x7a,0x88,0xa0,0x72,0x06,
-0x90,0x4b,0xb9,0x25,0x32,0x59,0x9d,0x85,0xe6,0x12,0x20,0x7a,0xad,0x34,0x17,0x10,
-0x91,0x0c,0x0d,0x17,0xaa,0x0c,0x0d,0x12,0x4a,0x52,0x05,0x03,0x85,0x03,0x54,0x0c,
-0xce,0xc7,0x3a,0xe9,0x76,0x16,0x63,0xb6,0x00,0xa0,0x03,0xbd,0x30,0x74,0x03,0x10,
-0x0a,0x23,0x22,0x36,0x70,0x1a,0xc0,0xb4,0x00,0xf2,0x19,0x72,0x09,0x10,0x00,0x07,
+0x41,0x8b,0xaa,0xcb,0x19,0x03,0x01,0xa0,0x2c,0x70,0x10,0x00,0x01,0x00,0xf5,0x1a,
+0x16,0x51,0x93,0x60,0x08,0xba,0x79,0x17,0x32,0x8b,0xa8,0xc9,0x96,0x03,0x47,0x07,
+0x42,0x10,0xc9,0xc8,0x55,0xa0,0x2c,0x7b,0x62,0xa7,0x00,0x86,0xb6,0x0e,0x13,0x08,
+0x8c,0x87,0xc1,0x80,0x80,0x05,0x71,0xb7,0x00,0x01,0x00,0xf3,0x14,0x7a,0xa3,0x8a,
+0xa2,0x0b,0x10,0x29,0x00,0x00,0xd8,0xd2,0xa4,0x42,0x0a,0x0a,0x2b,0x5c,0x30,0xd9,
+0x93,0x70,0xa0,0x19,0x00,0x55,0x0a,0x04,0x60,0x0a,0x10,0xa0,0x71,0x02,0x90,0x0a,
+0x2a,0x00,0xf3,0x17,0x50,0x00,0x00,0x79,0x9d,0x99,0x80,0x0a,0x00,0x00,0x0a,0x00,
+0xb9,0x99,0x99,0x80,0x0a,0x78,0x87,0x8a,0x00,0xa5,0x29,0x44,0x80,0x0a,0x07,0xa0,
+0x6b,0x04,0x79,0x7a,0x88,0xa0,0x72,0x06,0x90,0x4b,0x2d,0x00,0xf0,0x01,0x02,0x44,
+0x00,0x59,0x9d,0x85,0x10,0x00,0x00,0x91,0x00,0x00,0x7a,0xad,0xaa,0xa2,0x09,0x00,
+0x51,0x03,0xaa,0xad,0xaa,0xa8,0x12,0x00,0x73,0x00,0x09,0x10,0x00,0x00,0x4a,0xb0,
+0x2c,0x00,0xf0,0x0a,0xa0,0x00,0x00,0x00,0x0a,0x0c,0xce,0xc7,0x3a,0xe9,0x00,0xa0,
+0x00,0x0a,0x00,0x0a,0x00,0x00,0xb6,0x00,0xa0,0x03,0xbd,0x30,0x0a,0x1b,0x00,0x02,
+0x12,0x00,0x46,0x09,0x70,0x1a,0xc0,0xb4,0x00,0xf1,0x19,0x72,0x09,0x10,0x00,0x07,
 0x20,0x81,0x00,0x06,0xca,0x9d,0xa9,0x10,0x07,0x20,0x90,0x91,0x00,0x77,0x7b,0x09,
 0x10,0x7d,0x61,0xe6,0x91,0x00,0x72,0x37,0x6a,0x10,0x07,0x2a,0x10,0x64,0x63,0xb6,
-0x50,0x01,0xb4,0x67,0x0b,0xf8,0x17,0x10,0x06,0x30,0x00,0x81,0x14,0x6a,0x42,0x6d,
-0xa5,0xa7,0x77,0x40,0x81,0x45,0x00,0x00,0x08,0x65,0x50,0x00,0x07,0xe6,0x63,0x00,
-0x00,0x08,0x18,0x20,0x00,0x00,0x81,0xb0,0x00,0x00,0x4b,0x37,0x00,0x8c,0x00,0x90,
-0x09,0xcc,0xc8,0x3a,0xd8,0x00,0x01,0x80,0x0a,0x98,0x1d,0x50,0xc8,0x5a,0xab,0x83,
-0x9c,0x5f,0x05,0x10,0xa0,0x12,0x00,0x53,0x08,0xaa,0xa8,0x09,0x80,0x31,0x25,0x11,
-0x09,0x16,0x0e,0xf0,0x08,0x8a,0xbd,0x10,0x7d,0x91,0x39,0x10,0x00,0x90,0x7e,0xaa,
-0xa1,0x0a,0x71,0x82,0x89,0x09,0xe4,0x38,0x63,0xa0,0x09,0x09,0x41,0x19,0xf2,0x21,
-0x0a,0x20,0xa0,0x5b,0x08,0x21,0xa5,0x00,0x07,0x20,0x92,0x40,0x00,0x72,0x08,0x1b,
-0x20,0x7c,0xa2,0x85,0x67,0x00,0x72,0x6b,0x95,0x30,0x08,0x72,0x47,0x55,0x09,0xd7,
-0x01,0xaa,0x00,0x07,0x20,0x0e,0x21,0x00,0x72,0x1a,0xa6,0x73,0x4b,0x07,0x10,0x9b,
-0x80,0x07,0xf3,0x13,0x20,0x09,0x00,0x07,0x20,0x06,0x40,0x7d,0xb5,0xca,0xae,0x07,
-0x23,0x70,0x0a,0x08,0x85,0xc9,0x9d,0x9c,0x54,0x60,0x05,0x07,0x26,0x30,0x00,0x07,
-0x29,0x00,0x00,0x4b,0x27,0x00,0x28,0x00,0x00,0x0a,0x01,0xfa,0x14,0x6b,0x99,0xc0,
-0x8d,0xb8,0x33,0x4a,0x00,0x72,0x63,0x35,0x10,0x07,0x68,0xdb,0x9d,0x09,0xd7,0x75,
-0x92,0xa0,0x07,0x26,0x37,0xb3,0x00,0x72,0x64,0x7d,0x40,0x6c,0x16,0xa6,0x09,0x20,
-0x61,0x11,0xf0,0x06,0x10,0x07,0x10,0x06,0xda,0x6a,0xaa,0xa2,0x08,0x10,0x60,0x16,
-0x00,0x99,0x1a,0x04,0x60,0x6c,0x30,0x81,0x72,0x4b,0x1b,0xa3,0x00,0x08,0x18,0x88,
-0xd8,0x43,0xc1,0x11,0x11,0x10,0x37,0x01,0x00,0x32,0x00,0x61,0x6b,0xaa,0xa3,0x7d,
-0xa8,0x30,0x09,0x00,0xc0,0xa0,0x09,0x89,0x30,0x09,0x08,0xc3,0x6b,0x99,0xa0,0x08,
-0x16,0x12,0x00,0x83,0x64,0x11,0x10,0x5b,0x03,0x99,0x99,0x50,0x8c,0x00,0xf6,0x40,
-0x01,0x00,0x72,0x57,0x20,0xa0,0x5c,0xa5,0x5a,0x0a,0x00,0x72,0x54,0x82,0xa0,0x07,
-0x75,0x41,0x28,0x07,0xd6,0x54,0x25,0x80,0x07,0x25,0xb8,0xaa,0x00,0x72,0x95,0x58,
-0x46,0x3b,0x00,0x0a,0x00,0x60,0x0a,0x01,0x39,0x22,0x00,0xa0,0x54,0xa0,0xa0,0x6d,
-0x8b,0x7d,0x67,0x20,0xa0,0x27,0x72,0x21,0x0a,0x60,0xba,0x9b,0x08,0xe3,0x2c,0x65,
-0x70,0x0a,0x1b,0x0a,0xb0,0x00,0xa5,0x24,0xbb,0x30,0x4b,0x05,0x80,0x0a,0x40,0x60,
-0x01,0xf0,0x0b,0x6d,0x9b,0xa0,0x7d,0xa1,0x57,0xb1,0x00,0x90,0x07,0xba,0x30,0x09,
-0x58,0x34,0x18,0x36,0xd3,0x37,0xd7,0x50,0x09,0x08,0x9d,0x99,0x30,0xbd,0x12,0x14,
-0x5c,0x8e,0x08,0xf2,0x19,0x08,0x10,0x0b,0x00,0x00,0x81,0x04,0xa8,0x00,0x8d,0xb3,
-0xb0,0x84,0x00,0x82,0xcb,0x9a,0xc2,0x09,0x82,0x00,0x00,0x07,0xd4,0x4b,0x9a,0x70,
-0x08,0x14,0x50,0x37,0x00,0x81,0x4b,0x9a,0x70,0x4c,0x04,0x50,0x37,0x3c,0x01,0x00,
-0xab,0x19,0xf2,0x14,0x71,0x39,0xd9,0x80,0x7d,0xc1,0x0a,0x00,0x00,0x71,0x79,0xd9,
+0x50,0x01,0xb4,0x2d,0x00,0xf8,0x18,0x08,0x10,0x06,0x30,0x00,0x81,0x14,0x6a,0x42,
+0x6d,0xa5,0xa7,0x77,0x40,0x81,0x45,0x00,0x00,0x08,0x65,0x50,0x00,0x07,0xe6,0x63,
+0x00,0x00,0x08,0x18,0x20,0x00,0x00,0x81,0xb0,0x00,0x00,0x4b,0x37,0x00,0x8c,0x00,
+0x70,0x09,0xcc,0xc8,0x3a,0xd8,0x00,0x01,0xeb,0x00,0xc0,0x18,0x00,0xc8,0x5a,0xab,
+0x83,0x9c,0x10,0x00,0x18,0x00,0xa0,0x12,0x00,0x90,0x08,0xaa,0xa8,0x09,0x80,0x00,
+0x01,0x80,0x00,0xc5,0x00,0x00,0x05,0x00,0xf1,0x3d,0x90,0x8a,0xbd,0x10,0x7d,0x91,
+0x39,0x10,0x00,0x90,0x7e,0xaa,0xa1,0x0a,0x71,0x82,0x89,0x09,0xe4,0x38,0x63,0xa0,
+0x09,0x09,0x0a,0x0a,0x00,0x90,0x0a,0x20,0xa0,0x5b,0x08,0x21,0xa5,0x00,0x07,0x20,
+0x92,0x40,0x00,0x72,0x08,0x1b,0x20,0x7c,0xa2,0x85,0x67,0x00,0x72,0x6b,0x95,0x30,
+0x08,0x72,0x47,0x55,0x09,0xd7,0x01,0xaa,0x00,0x07,0x20,0x0e,0x21,0x00,0x72,0x1a,
+0xa6,0x73,0x4b,0x07,0x10,0x9b,0x82,0x00,0xf3,0x14,0x07,0x20,0x09,0x00,0x07,0x20,
+0x06,0x40,0x7d,0xb5,0xca,0xae,0x07,0x23,0x70,0x0a,0x08,0x85,0xc9,0x9d,0x9c,0x54,
+0x60,0x05,0x07,0x26,0x30,0x00,0x07,0x29,0x00,0x00,0x4b,0x27,0x00,0x28,0x00,0x00,
+0x0a,0x01,0xf5,0x14,0x6b,0x99,0xc0,0x8d,0xb8,0x33,0x4a,0x00,0x72,0x63,0x35,0x10,
+0x07,0x68,0xdb,0x9d,0x09,0xd7,0x75,0x92,0xa0,0x07,0x26,0x37,0xb3,0x00,0x72,0x64,
+0x7d,0x40,0x6c,0x16,0xa6,0x09,0x20,0x37,0x01,0xf3,0x19,0x81,0x00,0xa0,0x00,0x08,
+0x10,0x07,0x10,0x06,0xda,0x6a,0xaa,0xa2,0x08,0x10,0x60,0x16,0x00,0x99,0x1a,0x04,
+0x60,0x6c,0x30,0x81,0x72,0x00,0x81,0x06,0x3a,0x00,0x08,0x18,0x88,0xd8,0x43,0xc1,
+0x11,0x11,0x10,0x37,0x01,0x00,0x32,0x00,0x61,0x6b,0xaa,0xa3,0x7d,0xa8,0x30,0x09,
+0x00,0xc0,0xa0,0x09,0x89,0x30,0x09,0x08,0xc3,0x6b,0x99,0xa0,0x08,0x16,0x12,0x00,
+0x83,0x64,0x11,0x10,0x5b,0x03,0x99,0x99,0x50,0x8c,0x00,0xf6,0x40,0x01,0x00,0x72,
+0x57,0x20,0xa0,0x5c,0xa5,0x5a,0x0a,0x00,0x72,0x54,0x82,0xa0,0x07,0x75,0x41,0x28,
+0x07,0xd6,0x54,0x25,0x80,0x07,0x25,0xb8,0xaa,0x00,0x72,0x95,0x58,0x46,0x3b,0x00,
+0x0a,0x00,0x60,0x0a,0x01,0x39,0x22,0x00,0xa0,0x54,0xa0,0xa0,0x6d,0x8b,0x7d,0x67,
+0x20,0xa0,0x27,0x72,0x21,0x0a,0x60,0xba,0x9b,0x08,0xe3,0x2c,0x65,0x70,0x0a,0x1b,
+0x0a,0xb0,0x00,0xa5,0x24,0xbb,0x30,0x4b,0x05,0x80,0x0a,0x40,0x60,0x01,0xf0,0x10,
+0x6d,0x9b,0xa0,0x7d,0xa1,0x57,0xb1,0x00,0x90,0x07,0xba,0x30,0x09,0x58,0x34,0x18,
+0x36,0xd3,0x37,0xd7,0x50,0x09,0x08,0x9d,0x99,0x30,0x90,0x00,0xa0,0x00,0x5c,0x2f,
+0x02,0x02,0xb0,0x00,0xf2,0x17,0x0b,0x00,0x00,0x81,0x04,0xa8,0x00,0x8d,0xb3,0xb0,
+0x84,0x00,0x82,0xcb,0x9a,0xc2,0x09,0x82,0x00,0x00,0x07,0xd4,0x4b,0x9a,0x70,0x08,
+0x14,0x50,0x37,0x00,0x81,0x4b,0x9a,0x70,0x4c,0x04,0x50,0x37,0x3c,0x01,0xf2,0x18,
+0x10,0x09,0x00,0x00,0x71,0x39,0xd9,0x80,0x7d,0xc1,0x0a,0x00,0x00,0x71,0x79,0xd9,
 0x93,0x08,0x80,0x00,0x72,0x07,0xc4,0x79,0x9c,0xa2,0x07,0x10,0x90,0x72,0x00,0x71,
 0x07,0x27,0x20,0x3b,0x00,0x06,0xb1,0x5a,0x00,0xf4,0x18,0x13,0x60,0x01,0x00,0x81,
 0x3a,0x9b,0x50,0x7d,0xa5,0x91,0x03,0x20,0x81,0x1c,0x88,0xb2,0x08,0x51,0x12,0x21,
 0x07,0xd7,0x5b,0x88,0xd0,0x08,0x13,0xa7,0x7c,0x00,0x81,0x3b,0x77,0xc0,0x4b,0x03,
-0x60,0x0a,0x65,0x01,0xf0,0x16,0x91,0x00,0x08,0x15,0x8b,0xb8,0x47,0xda,0xb3,0x83,
+0x60,0x0a,0x65,0x01,0xf1,0x17,0x91,0x00,0x08,0x15,0x8b,0xb8,0x47,0xda,0xb3,0x83,
 0x48,0x08,0x13,0x1a,0x00,0x30,0x84,0xad,0xaa,0xd6,0x6d,0x92,0xb0,0x47,0x02,0x81,
-0x1a,0x7b,0x10,0x08,0x10,0x1c,0xc4,0x04,0xb0,0x79,0x20,0x2b,0x30,0x04,0x8e,0x0c,
-0xa0,0xa9,0x99,0x90,0x6d,0x8a,0x49,0x98,0x00,0xa0,0xa0,0xe2,0x1c,0xf6,0x05,0xbc,
-0xd9,0x18,0xe5,0xa4,0x68,0x80,0x0a,0x0a,0x46,0x64,0x00,0xa0,0x94,0x75,0xa0,0x3b,
-0x26,0x8a,0x35,0xc4,0x01,0xf5,0x19,0xa0,0x08,0x51,0x00,0x0a,0x02,0xb8,0xc4,0x07,
-0xe9,0xd9,0x8d,0x60,0x0a,0x07,0x3a,0x1a,0x00,0xb8,0x73,0xa0,0xa0,0x8d,0x3b,0xad,
-0x9d,0x30,0xa0,0x04,0xb7,0x00,0x0a,0x02,0xa0,0x84,0x04,0xa4,0x90,0x00,0x84,0x70,
-0x2d,0xf1,0x05,0x00,0x80,0x8a,0x99,0xd0,0x5c,0x89,0xa9,0x9d,0x00,0x80,0x81,0x0a,
-0x00,0x09,0x89,0x98,0xd8,0x58,0xe4,0x13,0x0c,0xb7,0xa9,0x9d,0x00,0x82,0x99,0x00,
-0x90,0x4b,0x53,0xa8,0x8c,0x14,0x01,0xf2,0x14,0x68,0xd8,0x83,0x5c,0x93,0x7c,0x79,
-0x00,0x71,0x78,0xd8,0xd5,0x1a,0xb1,0x2b,0x2a,0x06,0xb2,0x47,0xc6,0x60,0x07,0x18,
-0x39,0x88,0x00,0x72,0xa9,0xa0,0x00,0x3b,0x54,0x3a,0x89,0x40,0x6e,0x01,0xf1,0x0e,
-0x09,0x80,0x00,0x81,0x01,0x98,0x10,0x6d,0xa4,0x99,0x8a,0x50,0x81,0x00,0x98,0x00,
-0x08,0x54,0x99,0x89,0x48,0xd7,0x11,0x98,0x10,0x08,0x14,0x89,0x89,0x12,0x00,0x43,
-0x3b,0x00,0x09,0x80,0x15,0x1b,0xf6,0x14,0x6b,0xdc,0xb3,0x5d,0xa0,0x80,0x44,0x00,
-0x81,0x6a,0x9d,0x84,0x08,0x71,0x29,0x11,0x07,0xd4,0x8d,0x9a,0xb5,0x08,0x12,0xc0,
-0x92,0x00,0x81,0x04,0xdd,0x10,0x3b,0x09,0x94,0x3a,0x20,0x83,0x00,0xf0,0x09,0x69,
-0xda,0x96,0x5c,0xa9,0x33,0x31,0xa0,0x71,0x2b,0x16,0x80,0x07,0x66,0x20,0x04,0x26,
-0xd6,0x39,0xd9,0x90,0x07,0x10,0x0a,0x6e,0x0b,0x40,0xa0,0x00,0x3b,0x09,0x7d,0x05,
-0xf0,0x17,0x10,0x92,0x60,0x00,0x91,0x1b,0x0a,0x00,0x7d,0xa9,0xda,0xda,0x30,0x94,
-0xd9,0x3b,0x30,0x0a,0xa4,0xa5,0xc5,0x16,0xb1,0x3c,0x9d,0x92,0x09,0x13,0x70,0xa0,
-0x00,0x91,0x3c,0x9d,0x95,0x4c,0x03,0x70,0xa8,0x00,0xd0,0xa0,0x09,0x00,0x81,0x4c,
-0x56,0xb4,0x5c,0xa5,0xc5,0x6b,0x40,0x81,0xba,0x00,0xf6,0x07,0x77,0xac,0xba,0x67,
-0xe6,0x62,0x74,0x36,0x08,0x16,0xac,0xba,0x60,0x81,0x6a,0xcb,0xa6,0x3b,0x06,0x10,
-0x03,0x60,0xf3,0x02,0xf1,0x15,0x5a,0x88,0xc0,0x6d,0xa6,0x86,0x6b,0x00,0x81,0x38,
-0x88,0x90,0x09,0x87,0x8a,0x88,0x37,0xd4,0x23,0x90,0x00,0x08,0x17,0x59,0x88,0x00,
-0x81,0x98,0xa0,0x00,0x4b,0x44,0x1a,0x89,0x50,0x00,0x83,0x14,0xf3,0x17,0x57,0xa8,
-0x00,0xa0,0x36,0x94,0x00,0x5d,0x86,0x6a,0x86,0x10,0xa0,0x23,0x75,0x20,0x0a,0x58,
-0x87,0x7b,0x08,0xe4,0xa0,0x63,0x80,0x0a,0x0a,0x98,0x7c,0x00,0xa0,0xa9,0xca,0xc0,
-0x3b,0x0a,0x00,0x08,0x9d,0x02,0xf4,0x17,0x01,0x34,0x00,0x81,0x78,0xa5,0x80,0x6d,
-0xa3,0x57,0x37,0x00,0x81,0x6c,0x98,0x82,0x08,0x48,0xd8,0x88,0x47,0xd7,0x0d,0x88,
-0x80,0x08,0x12,0xc7,0x56,0x00,0x81,0xa1,0xad,0x00,0x4b,0x65,0xa6,0x4a,0x4d,0x03,
-0xf0,0x14,0x35,0x00,0x72,0x78,0xa5,0x60,0x4c,0xa4,0x58,0x19,0x00,0x72,0x3c,0x9a,
-0xa2,0x07,0x98,0x09,0x00,0x06,0xc5,0x88,0xd8,0x85,0x07,0x24,0x09,0x04,0x00,0x72,
-0x98,0xd8,0xd0,0x3b,0x00,0x00,0x08,0x00,0xc2,0x27,0xf3,0x14,0x81,0x9d,0xae,0xa2,
-0x5c,0xa5,0xaa,0xa8,0x00,0x81,0x74,0x33,0xa0,0x08,0x58,0x87,0x7b,0x05,0xc6,0x47,
-0xc7,0x50,0x08,0x28,0x9e,0xa8,0x20,0x81,0x09,0x3a,0x00,0x4b,0x1b,0x50,0x2a,0x5c,
-0x01,0xf3,0x17,0x14,0x8b,0x00,0x71,0x69,0xc4,0x70,0x6c,0xa1,0x89,0x46,0x00,0x83,
-0x7b,0xfd,0x84,0x09,0x96,0x89,0x28,0x27,0xc3,0x88,0xb8,0xb2,0x07,0x16,0x8c,0x6c,
-0x00,0x71,0x65,0xa2,0xa0,0x3b,0x06,0x97,0x7c,0x94,0x02,0xf6,0x15,0x0c,0x7a,0x50,
-0x5d,0x70,0xa7,0x84,0x00,0xa0,0x98,0x6a,0x93,0x0a,0x48,0x37,0x86,0x35,0xd5,0x67,
-0x87,0x71,0x0a,0x08,0xbf,0xd8,0x30,0xa0,0x3a,0xa7,0x60,0x2b,0x47,0x09,0x05,0x40,
-0x00,0x05,0x0d,0xf5,0x17,0x90,0x00,0x07,0x1a,0xaa,0xaa,0x95,0xda,0x5b,0x69,0x77,
-0x07,0x18,0x75,0x88,0x10,0x76,0x4b,0x46,0xa0,0x5d,0x58,0x34,0x42,0x70,0x71,0x39,
-0xd8,0x92,0x07,0x16,0x49,0x0a,0x01,0xb0,0x63,0xa0,0x24,0x6f,0x09,0x41,0x4a,0xaa,
-0xea,0xaa,0x09,0x00,0xf3,0x08,0x0b,0xda,0xaa,0xe2,0x00,0x0b,0x10,0x49,0x00,0x00,
-0x1b,0x79,0x00,0x00,0x16,0xba,0xa4,0x10,0x79,0x40,0x01,0x6a,0x20,0xeb,0x02,0xf0,
-0x3b,0xb0,0x00,0x08,0x0a,0x1b,0x00,0x00,0xa0,0xa5,0xd9,0xb6,0x0a,0x0a,0xb8,0x0a,
-0x00,0xa0,0xb9,0xa1,0x90,0x0a,0x1a,0x05,0xa4,0x02,0xe9,0xa0,0x1e,0x00,0x01,0x0a,
-0x1a,0x79,0x00,0x00,0xaa,0x10,0x57,0x00,0x00,0x04,0x00,0x00,0xaa,0xc0,0xb0,0x00,
-0x00,0x0a,0x2c,0x8c,0x50,0x88,0xda,0xb0,0xb0,0x0a,0x11,0x58,0x39,0x00,0xa0,0x00,
-0x2e,0x20,0x0b,0x5a,0x04,0xe2,0x01,0xc5,0x07,0xa1,0xb4,0x04,0x0e,0xf1,0x1a,0x20,
-0x01,0x20,0x05,0x00,0x00,0x28,0x10,0xb0,0x00,0x6d,0x88,0x4d,0x9c,0x60,0xa0,0x09,
-0xa0,0xb0,0x0b,0x9c,0xbc,0x28,0x00,0xa0,0xa0,0x7b,0x30,0x0a,0x0a,0x03,0xd0,0x04,
-0x70,0xa1,0xba,0x60,0x92,0xa8,0xb2,0x08,0x0c,0x02,0x02,0x27,0x0e,0xf0,0x3e,0x03,
-0x90,0x00,0x8a,0xc9,0xac,0xac,0x60,0x27,0x1e,0x70,0xa0,0x4a,0xca,0x3b,0x47,0x06,
-0x20,0x90,0x8c,0x10,0x62,0x09,0x07,0xc0,0x06,0xb9,0x99,0x85,0xa1,0x10,0x04,0x30,
-0x02,0x30,0x00,0x40,0x00,0x40,0x00,0x3a,0x53,0x36,0x00,0x18,0x79,0x47,0xab,0x80,
-0xb0,0x45,0xd0,0x81,0x38,0x29,0x7b,0x4a,0x00,0x0b,0x70,0x0b,0x70,0x00,0xab,0x00,
-0xd4,0x01,0x91,0x43,0x94,0x92,0x12,0x00,0x61,0x00,0x50,0x03,0xa3,0x12,0xf2,0x14,
-0xc6,0x65,0x72,0x00,0x48,0x22,0x2b,0x9a,0x55,0xcb,0xb7,0xe0,0x90,0x0a,0x76,0xa8,
-0x49,0x05,0xcb,0xba,0x0b,0x50,0x2b,0xbb,0x90,0xd2,0x00,0x00,0x81,0x73,0xa0,0x00,
-0x6a,0x54,0x05,0xc9,0x07,0xf2,0x19,0x87,0x34,0x60,0x00,0x08,0x37,0x74,0x00,0x4a,
-0xdb,0x9a,0xab,0x60,0x58,0x47,0xf0,0xa0,0x09,0x9b,0x6a,0x5b,0x00,0x1c,0xa0,0x0c,
-0x70,0x2a,0xa5,0x90,0xc2,0x02,0x18,0x20,0x6a,0x90,0x05,0xb1,0x78,0x04,0x60,0x9a,
-0x14,0xf1,0x18,0x64,0x50,0x00,0xbe,0xba,0x83,0x00,0x01,0xa8,0x5b,0xac,0x63,0x7a,
-0xb9,0xf1,0xb0,0x09,0xbc,0x97,0x6b,0x03,0x85,0x60,0x0d,0x60,0x3a,0xda,0xa0,0xd2,
-0x00,0x08,0x10,0x88,0xa0,0x04,0xb0,0x76,0x05,0x60,0x9b,0x0b,0xf1,0x38,0x82,0x54,
-0x40,0x00,0x88,0x62,0x83,0x00,0x39,0xec,0x8c,0xab,0x62,0xaa,0x57,0xe2,0xa0,0x00,
-0x70,0x44,0x7a,0x01,0xab,0xa5,0x0b,0x50,0x08,0x69,0x00,0xc4,0x00,0x4a,0xa2,0xa2,
-0xa3,0x24,0x00,0x62,0x00,0x50,0x00,0x80,0x05,0x30,0x02,0x8c,0x95,0xba,0x96,0x0b,
-0xb8,0xbd,0x2a,0x00,0x9e,0xb4,0x1d,0x40,0x16,0x51,0x47,0x26,0x60,0xae,0xee,0xee,
-0xe1,0x01,0x21,0xb9,0x94,0xd8,0x24,0x20,0x39,0xd9,0xab,0x1e,0x22,0x00,0x60,0x83,
-0x26,0xd2,0x3a,0xda,0xaa,0xcb,0x80,0x08,0x30,0x0b,0x00,0x00,0x1b,0x05,0x70,0xe0,
-0x07,0xf4,0x26,0x05,0xca,0x10,0x00,0x4a,0x80,0x3b,0x72,0x27,0x10,0x00,0x04,0x60,
-0x00,0x57,0x01,0x0a,0x00,0x3a,0x86,0x59,0xa0,0x4e,0x65,0x90,0x4a,0x01,0x39,0x61,
-0x81,0xa0,0x29,0xca,0x81,0x7a,0x00,0x37,0x41,0x02,0xc9,0x0b,0x74,0x8b,0x8c,0x14,
-0x77,0x28,0x00,0xa0,0x04,0xb1,0x00,0x0a,0x6f,0x15,0xf6,0x12,0x87,0x95,0x96,0x6b,
-0x83,0x95,0x95,0x90,0x00,0xb9,0xe8,0xaa,0xa8,0x97,0xc6,0x90,0x90,0xb6,0x92,0x90,
-0x90,0x90,0x30,0xa0,0x90,0xb9,0x98,0x80,0x90,0x00,0x03,0x40,0x90,0x9b,0x15,0xf2,
-0x16,0x63,0x05,0xc4,0x3d,0x8b,0x9b,0x61,0x00,0xa1,0x73,0x90,0x00,0x0a,0x8b,0x3b,
-0x99,0x60,0xa8,0xb3,0xa0,0xa0,0x09,0x06,0x39,0x09,0x05,0xaa,0xa9,0x90,0x90,0x0a,
-0x1a,0x56,0x09,0x02,0x60,0x1b,0xd3,0x10,0x00,0x2a,0x16,0xf4,0x15,0x04,0x05,0x9d,
-0x85,0xa8,0x40,0x08,0x09,0x37,0x00,0x06,0xca,0xb7,0xb7,0x74,0x00,0xa0,0x38,0x2a,
-0x16,0x9d,0x97,0x60,0x90,0x36,0x98,0x55,0x09,0x09,0x19,0x6b,0x10,0x90,0x05,0x70,
-0x90,0x96,0x2a,0x22,0x08,0x20,0x5c,0x27,0x21,0x00,0xb0,0x1d,0x1f,0xf2,0x04,0xb6,
-0x00,0x02,0x70,0x04,0x60,0x00,0x82,0x00,0x55,0x00,0x3a,0x00,0x07,0x20,0x1b,0x10,
-0x5a,0xa0,0x56,0x00,0xf2,0x18,0x10,0x04,0x00,0x00,0x19,0x05,0x94,0x42,0x5d,0xaa,
-0xb4,0x44,0x20,0xa0,0x2a,0xaa,0xa4,0x0a,0x99,0x10,0x96,0x10,0x90,0x98,0x1d,0x92,
-0x09,0x18,0x92,0x90,0x02,0x72,0x8a,0x99,0x00,0x73,0xa8,0x44,0xb9,0xe3,0x03,0x00,
-0xb7,0x10,0x04,0x7c,0x1f,0x80,0x02,0x99,0xae,0xc9,0x96,0x00,0x05,0x87,0x70,0x1c,
-0xb3,0x70,0x00,0x00,0xa5,0x28,0x00,0xa2,0xc4,0x00,0xba,0xa7,0xc6,0x26,0x61,0xad,
-0x09,0x10,0x00,0xa0,0x91,0xd1,0x1d,0x40,0xe0,0x91,0x00,0x0a,0x0e,0x00,0x30,0x9a,
-0xaa,0xae,0x07,0x00,0x20,0x01,0x11,0xfd,0x1c,0x80,0xb0,0x00,0xa0,0x09,0x0a,0x8a,
-0xae,0x80,0x84,0x39,0xd0,0x0d,0x9b,0x38,0x0a,0x00,0x90,0xa0,0x93,0xa0,0x0d,0x9b,
-0x00,0x0a,0x37,0x15,0x00,0x92,0x2e,0xb2,0xa8,0x00,0x0d,0x9a,0x2d,0x99,0xa0,0x90,
-0x92,0x80,0x0a,0x09,0x00,0xd1,0x93,0x70,0x0a,0x09,0x0a,0x5c,0x99,0xa0,0xd9,0x67,
-0x30,0x0a,0x01,0x4a,0x25,0x32,0x82,0x04,0xa7,0x88,0x0e,0x81,0xb8,0x88,0x8b,0x00,
+0x1a,0x7b,0x10,0x08,0x10,0x1c,0xc4,0x04,0xb0,0x79,0x20,0x85,0x2d,0x00,0x11,0x0a,
+0x73,0x02,0xf6,0x13,0xa9,0x99,0x90,0x6d,0x8a,0x49,0x98,0x00,0xa0,0xa0,0x00,0x00,
+0x0a,0x4a,0xbc,0xd9,0x18,0xe5,0xa4,0x68,0x80,0x0a,0x0a,0x46,0x64,0x00,0xa0,0x94,
+0x75,0xa0,0x3b,0x26,0x8a,0x35,0xc4,0x01,0xf2,0x19,0xa0,0x08,0x51,0x00,0x0a,0x02,
+0xb8,0xc4,0x07,0xe9,0xd9,0x8d,0x60,0x0a,0x07,0x3a,0x1a,0x00,0xb8,0x73,0xa0,0xa0,
+0x8d,0x3b,0xad,0x9d,0x30,0xa0,0x04,0xb7,0x00,0x0a,0x02,0xa0,0x84,0x04,0xa4,0x90,
+0x00,0x84,0xba,0x00,0x00,0x05,0x00,0xf7,0x14,0x80,0x8a,0x99,0xd0,0x5c,0x89,0xa9,
+0x9d,0x00,0x80,0x81,0x0a,0x00,0x09,0x89,0x98,0xd8,0x58,0xe4,0xa0,0x0a,0x00,0x08,
+0x0a,0xa9,0x9d,0x00,0x82,0x99,0x00,0x90,0x4b,0x53,0xa8,0x8c,0x14,0x01,0xf2,0x14,
+0x68,0xd8,0x83,0x5c,0x93,0x7c,0x79,0x00,0x71,0x78,0xd8,0xd5,0x1a,0xb1,0x2b,0x2a,
+0x06,0xb2,0x47,0xc6,0x60,0x07,0x18,0x39,0x88,0x00,0x72,0xa9,0xa0,0x00,0x3b,0x54,
+0x3a,0x89,0x40,0x6e,0x01,0xf1,0x0e,0x09,0x80,0x00,0x81,0x01,0x98,0x10,0x6d,0xa4,
+0x99,0x8a,0x50,0x81,0x00,0x98,0x00,0x08,0x54,0x99,0x89,0x48,0xd7,0x11,0x98,0x10,
+0x08,0x14,0x89,0x89,0x12,0x00,0x40,0x3b,0x00,0x09,0x80,0x29,0x00,0x00,0x3e,0x02,
+0xf6,0x13,0xdc,0xb3,0x5d,0xa0,0x80,0x44,0x00,0x81,0x6a,0x9d,0x84,0x08,0x71,0x29,
+0x11,0x07,0xd4,0x8d,0x9a,0xb5,0x08,0x12,0xc0,0x92,0x00,0x81,0x04,0xdd,0x10,0x3b,
+0x09,0x94,0x3a,0x20,0x83,0x00,0xf0,0x08,0x69,0xda,0x96,0x5c,0xa9,0x33,0x31,0xa0,
+0x71,0x2b,0x16,0x80,0x07,0x66,0x20,0x04,0x26,0xd6,0x39,0xd9,0x90,0x07,0x10,0xa9,
+0x01,0xf0,0x20,0x00,0xa0,0x00,0x3b,0x09,0x99,0x99,0x60,0x09,0x10,0x92,0x60,0x00,
+0x91,0x1b,0x0a,0x00,0x7d,0xa9,0xda,0xda,0x30,0x94,0xd9,0x3b,0x30,0x0a,0xa4,0xa5,
+0xc5,0x16,0xb1,0x3c,0x9d,0x92,0x09,0x13,0x70,0xa0,0x00,0x91,0x3c,0x9d,0x95,0x4c,
+0x03,0x70,0xa8,0x00,0xd0,0xa0,0x09,0x00,0x81,0x4c,0x56,0xb4,0x5c,0xa5,0xc5,0x6b,
+0x40,0x81,0xba,0x00,0xf6,0x07,0x77,0xac,0xba,0x67,0xe6,0x62,0x74,0x36,0x08,0x16,
+0xac,0xba,0x60,0x81,0x6a,0xcb,0xa6,0x3b,0x06,0x10,0x03,0x60,0xf3,0x02,0xf1,0x14,
+0x5a,0x88,0xc0,0x6d,0xa6,0x86,0x6b,0x00,0x81,0x38,0x88,0x90,0x09,0x87,0x8a,0x88,
+0x37,0xd4,0x23,0x90,0x00,0x08,0x17,0x59,0x88,0x00,0x81,0x98,0xa0,0x00,0x4b,0x44,
+0x1a,0x89,0x50,0xbb,0x01,0xf3,0x18,0x02,0x57,0xa8,0x00,0xa0,0x36,0x94,0x00,0x5d,
+0x86,0x6a,0x86,0x10,0xa0,0x23,0x75,0x20,0x0a,0x58,0x87,0x7b,0x08,0xe4,0xa0,0x63,
+0x80,0x0a,0x0a,0x98,0x7c,0x00,0xa0,0xa9,0xca,0xc0,0x3b,0x0a,0x00,0x08,0x9d,0x02,
+0xf4,0x17,0x01,0x34,0x00,0x81,0x78,0xa5,0x80,0x6d,0xa3,0x57,0x37,0x00,0x81,0x6c,
+0x98,0x82,0x08,0x48,0xd8,0x88,0x47,0xd7,0x0d,0x88,0x80,0x08,0x12,0xc7,0x56,0x00,
+0x81,0xa1,0xad,0x00,0x4b,0x65,0xa6,0x4a,0x4d,0x03,0xf0,0x16,0x35,0x00,0x72,0x78,
+0xa5,0x60,0x4c,0xa4,0x58,0x19,0x00,0x72,0x3c,0x9a,0xa2,0x07,0x98,0x09,0x00,0x06,
+0xc5,0x88,0xd8,0x85,0x07,0x24,0x09,0x04,0x00,0x72,0x98,0xd8,0xd0,0x3b,0x00,0x00,
+0x0a,0xdd,0x00,0xf3,0x16,0xa0,0x00,0x81,0x9d,0xae,0xa2,0x5c,0xa5,0xaa,0xa8,0x00,
+0x81,0x74,0x33,0xa0,0x08,0x58,0x87,0x7b,0x05,0xc6,0x47,0xc7,0x50,0x08,0x28,0x9e,
+0xa8,0x20,0x81,0x09,0x3a,0x00,0x4b,0x1b,0x50,0x2a,0x5c,0x01,0xf3,0x17,0x14,0x8b,
+0x00,0x71,0x69,0xc4,0x70,0x6c,0xa1,0x89,0x46,0x00,0x83,0x7b,0xfd,0x84,0x09,0x96,
+0x89,0x28,0x27,0xc3,0x88,0xb8,0xb2,0x07,0x16,0x8c,0x6c,0x00,0x71,0x65,0xa2,0xa0,
+0x3b,0x06,0x97,0x7c,0x94,0x02,0xf5,0x14,0x0c,0x7a,0x50,0x5d,0x70,0xa7,0x84,0x00,
+0xa0,0x98,0x6a,0x93,0x0a,0x48,0x37,0x86,0x35,0xd5,0x67,0x87,0x71,0x0a,0x08,0xbf,
+0xd8,0x30,0xa0,0x3a,0xa7,0x60,0x2b,0x47,0x09,0x05,0x40,0x94,0x02,0xf3,0x19,0x71,
+0x00,0x90,0x00,0x07,0x1a,0xaa,0xaa,0x95,0xda,0x5b,0x69,0x77,0x07,0x18,0x75,0x88,
+0x10,0x76,0x4b,0x46,0xa0,0x5d,0x58,0x34,0x42,0x70,0x71,0x39,0xd8,0x92,0x07,0x16,
+0x49,0x0a,0x01,0xb0,0x63,0xa0,0x24,0x5e,0x05,0x61,0x00,0x00,0x4a,0xaa,0xea,0xaa,
+0x09,0x00,0xf3,0x08,0x0b,0xda,0xaa,0xe2,0x00,0x0b,0x10,0x49,0x00,0x00,0x1b,0x79,
+0x00,0x00,0x16,0xba,0xa4,0x10,0x79,0x40,0x01,0x6a,0x20,0xeb,0x02,0xf1,0x69,0xb0,
+0x00,0x08,0x0a,0x1b,0x00,0x00,0xa0,0xa5,0xd9,0xb6,0x0a,0x0a,0xb8,0x0a,0x00,0xa0,
+0xb9,0xa1,0x90,0x0a,0x1a,0x05,0xa4,0x02,0xe9,0xa0,0x1e,0x00,0x01,0x0a,0x1a,0x79,
+0x00,0x00,0xaa,0x10,0x57,0x00,0x00,0x04,0x00,0x00,0xaa,0xc0,0xb0,0x00,0x00,0x0a,
+0x2c,0x8c,0x50,0x88,0xda,0xb0,0xb0,0x0a,0x11,0x58,0x39,0x00,0xa0,0x00,0x2e,0x20,
+0x0b,0x5a,0x04,0xe2,0x01,0xc5,0x07,0xa1,0xb4,0x00,0x00,0x40,0x00,0x20,0x01,0x20,
+0x05,0x00,0x00,0x28,0x10,0xb0,0x00,0x6d,0x88,0x4d,0x9c,0x60,0xa0,0x09,0xa0,0xb0,
+0x0b,0x9c,0xbc,0x28,0x00,0xa0,0xa0,0x7b,0x30,0x0a,0x0a,0x03,0xd0,0x04,0x70,0xa1,
+0xba,0x60,0x92,0xa8,0xb2,0x08,0x60,0xc0,0x06,0xf1,0x6b,0x70,0x0a,0x00,0x00,0x27,
+0x03,0x90,0x00,0x8a,0xc9,0xac,0xac,0x60,0x27,0x1e,0x70,0xa0,0x4a,0xca,0x3b,0x47,
+0x06,0x20,0x90,0x8c,0x10,0x62,0x09,0x07,0xc0,0x06,0xb9,0x99,0x85,0xa1,0x10,0x04,
+0x30,0x02,0x30,0x00,0x40,0x00,0x40,0x00,0x3a,0x53,0x36,0x00,0x18,0x79,0x47,0xab,
+0x80,0xb0,0x45,0xd0,0x81,0x38,0x29,0x7b,0x4a,0x00,0x0b,0x70,0x0b,0x70,0x00,0xab,
+0x00,0xd4,0x01,0x91,0x43,0x94,0x92,0x12,0x00,0x61,0x00,0x50,0x03,0x00,0x01,0x10,
+0x00,0xc6,0x65,0x72,0x00,0x48,0x22,0x2b,0x9a,0x55,0xcb,0xb7,0xe0,0x90,0x0a,0x76,
+0xa8,0x49,0x05,0xcb,0xba,0x0b,0x50,0x2b,0xbb,0x90,0xd2,0x00,0x00,0x81,0x73,0xa0,
+0x00,0x6a,0x54,0x05,0x70,0xfd,0x00,0xf1,0x1a,0x87,0x34,0x60,0x00,0x08,0x37,0x74,
+0x00,0x4a,0xdb,0x9a,0xab,0x60,0x58,0x47,0xf0,0xa0,0x09,0x9b,0x6a,0x5b,0x00,0x1c,
+0xa0,0x0c,0x70,0x2a,0xa5,0x90,0xc2,0x02,0x18,0x20,0x6a,0x90,0x05,0xb1,0x78,0x04,
+0x60,0x00,0x24,0x05,0xf1,0x17,0x64,0x50,0x00,0xbe,0xba,0x83,0x00,0x01,0xa8,0x5b,
+0xac,0x63,0x7a,0xb9,0xf1,0xb0,0x09,0xbc,0x97,0x6b,0x03,0x85,0x60,0x0d,0x60,0x3a,
+0xda,0xa0,0xd2,0x00,0x08,0x10,0x88,0xa0,0x04,0xb0,0x76,0x05,0x2d,0x00,0xf0,0x46,
+0x05,0x82,0x54,0x40,0x00,0x88,0x62,0x83,0x00,0x39,0xec,0x8c,0xab,0x62,0xaa,0x57,
+0xe2,0xa0,0x00,0x70,0x44,0x7a,0x01,0xab,0xa5,0x0b,0x50,0x08,0x69,0x00,0xc4,0x00,
+0x4a,0xa2,0xa2,0xa3,0x24,0x00,0x62,0x00,0x50,0x00,0x80,0x05,0x30,0x02,0x8c,0x95,
+0xba,0x96,0x0b,0xb8,0xbd,0x2a,0x00,0x9e,0xb4,0x1d,0x40,0x16,0x51,0x47,0x26,0x60,
+0xae,0xee,0xee,0xe1,0x01,0x21,0xb9,0x94,0x00,0x09,0x09,0x00,0x00,0x39,0xd9,0xd9,
+0x99,0x70,0x00,0x00,0x60,0xe3,0x02,0xd0,0x30,0x00,0x3a,0xda,0xaa,0xcb,0x80,0x08,
+0x30,0x0b,0x00,0x00,0x1b,0xc6,0x00,0x00,0xe0,0x07,0xf4,0x24,0x05,0xca,0x10,0x00,
+0x4a,0x80,0x3b,0x72,0x27,0x10,0x00,0x04,0x60,0x00,0x57,0x01,0x0a,0x00,0x3a,0x86,
+0x59,0xa0,0x4e,0x65,0x90,0x4a,0x01,0x39,0x61,0x81,0xa0,0x29,0xca,0x81,0x7a,0x00,
+0x37,0x41,0x02,0xc9,0x0b,0x74,0x8b,0x8c,0x14,0x77,0x28,0x00,0xa0,0x04,0xb1,0xd1,
+0x05,0xf5,0x14,0x90,0x00,0x87,0x95,0x96,0x6b,0x83,0x95,0x95,0x90,0x00,0xb9,0xe8,
+0xaa,0xa8,0x97,0xc6,0x90,0x90,0xb6,0x92,0x90,0x90,0x90,0x30,0xa0,0x90,0xb9,0x98,
+0x80,0x90,0x00,0x03,0x40,0x90,0x82,0x02,0xf2,0x18,0x90,0x63,0x05,0xc4,0x3d,0x8b,
+0x9b,0x61,0x00,0xa1,0x73,0x90,0x00,0x0a,0x8b,0x3b,0x99,0x60,0xa8,0xb3,0xa0,0xa0,
+0x09,0x06,0x39,0x09,0x05,0xaa,0xa9,0x90,0x90,0x0a,0x1a,0x56,0x09,0x02,0x60,0x1b,
+0x00,0x31,0x00,0xf2,0x19,0x01,0x40,0x00,0x04,0x05,0x9d,0x85,0xa8,0x40,0x08,0x09,
+0x37,0x00,0x06,0xca,0xb7,0xb7,0x74,0x00,0xa0,0x38,0x2a,0x16,0x9d,0x97,0x60,0x90,
+0x36,0x98,0x55,0x09,0x09,0x19,0x6b,0x10,0x90,0x05,0x70,0x90,0x09,0xf3,0x08,0xa0,
+0x00,0x08,0x20,0x00,0x1a,0xae,0xaa,0xaa,0x60,0x00,0xaf,0x08,0xf2,0x06,0x0d,0xaa,
+0xb6,0x00,0x02,0x70,0x04,0x60,0x00,0x82,0x00,0x55,0x00,0x3a,0x00,0x07,0x20,0x1b,
+0x10,0x5a,0xa0,0x56,0x00,0xf2,0x18,0x10,0x04,0x00,0x00,0x19,0x05,0x94,0x42,0x5d,
+0xaa,0xb4,0x44,0x20,0xa0,0x2a,0xaa,0xa4,0x0a,0x99,0x10,0x96,0x10,0x90,0x98,0x1d,
+0x92,0x09,0x18,0x92,0x90,0x02,0x72,0x8a,0x99,0x00,0x73,0xa8,0x44,0xb9,0xe3,0x03,
+0x42,0xaa,0xda,0xaa,0x20,0xe9,0x00,0xf1,0x0a,0xb0,0x00,0x02,0x99,0xae,0xc9,0x96,
+0x00,0x05,0x87,0x00,0x00,0x00,0xb3,0x70,0x00,0x00,0xa5,0x28,0x00,0xa2,0xc4,0x00,
+0xba,0xa7,0x56,0x00,0xe0,0x8a,0xaa,0xad,0x09,0x10,0x00,0xa0,0x91,0x00,0x0a,0x09,
+0xaa,0xaa,0xe0,0x07,0x00,0x60,0x10,0x00,0xa0,0x9a,0xaa,0xae,0x07,0x00,0xf1,0x12,
+0x01,0x11,0x00,0x0a,0x00,0xea,0xb0,0x00,0xa0,0x09,0x0a,0x8a,0xae,0x80,0x90,0xa0,
+0x00,0xa0,0x0d,0x9b,0x38,0x0a,0x00,0x90,0xa0,0x93,0xa0,0x0d,0x9b,0x00,0x0a,0x00,
+0x70,0x70,0x03,0xc2,0x06,0xa8,0x00,0x0d,0x9a,0x2d,0x99,0xa0,0x90,0x92,0x80,0x0a,
+0x09,0x00,0xf2,0x05,0x93,0x70,0x0a,0x09,0x0a,0x5c,0x99,0xa0,0xd9,0x67,0x30,0x0a,
+0x01,0x00,0xb0,0x00,0xa0,0x00,0x82,0x04,0x6e,0x00,0x91,0x03,0xb8,0x88,0x8b,0x00,
 0x3a,0x77,0x77,0xa0,0x09,0x00,0xd0,0x09,0x02,0x00,0x00,0x0a,0xa6,0xc7,0x66,0x01,
-0x58,0x8d,0x98,0x50,0xb7,0x09,0x01,0x0e,0x28,0xf0,0x2d,0x01,0x10,0x01,0x80,0x00,
-0xed,0x40,0x18,0x00,0x08,0x44,0xba,0xdb,0x60,0x95,0x49,0x18,0x36,0x0c,0xa4,0x91,
-0x83,0x60,0x84,0x89,0xbe,0x88,0x0d,0xb4,0x0a,0x83,0x00,0x60,0x08,0x50,0xb2,0x00,
-0x05,0x30,0x01,0x60,0x04,0xa7,0x77,0x97,0x00,0x4a,0x77,0x79,0x70,0x03,0x98,0x88,
-0x86,0x02,0x99,0x99,0x99,0x96,0x00,0xe0,0x21,0xb3,0x1d,0x0a,0x99,0x80,0x07,0x97,
-0xa0,0x00,0x03,0xa0,0x6b,0xc5,0x31,0x80,0x0a,0x88,0x88,0xb3,0x00,0xa8,0x88,0x8b,
-0xf0,0x09,0xf3,0x05,0x63,0x00,0x69,0xd9,0xd8,0x20,0x0a,0x09,0x18,0x56,0x00,0x44,
-0x91,0x88,0x00,0x79,0x9d,0xad,0x99,0x30,0x54,0x0d,0xf1,0x05,0x60,0x00,0x7a,0xc8,
-0x9d,0x82,0x02,0x57,0x29,0x07,0x00,0x08,0x72,0x95,0x20,0x28,0x88,0x88,0x88,0x60,
-0xdf,0x0b,0x72,0xc8,0x88,0x98,0x00,0x09,0x00,0x01,0x09,0x00,0xf0,0x3b,0x0a,0x77,
-0x77,0xb3,0x00,0xa7,0x77,0x7a,0x30,0x04,0x78,0xb7,0x71,0x06,0x88,0x88,0x88,0x81,
-0x07,0x86,0x66,0xc0,0x00,0x58,0x7a,0x7a,0x00,0x05,0x80,0x94,0x81,0x06,0x61,0x87,
-0x01,0x90,0x00,0x60,0x00,0x25,0x12,0xba,0x86,0xa5,0x30,0x0d,0x9c,0x7a,0x89,0x40,
-0x24,0xa5,0x90,0x90,0x27,0x79,0x47,0x09,0x00,0x19,0x98,0x88,0x80,0x02,0xa5,0x55,
-0x5a,0x00,0x28,0x22,0x22,0xa0,0x02,0xb8,0xfa,0x2a,0x20,0xa0,0xa0,0xcb,0x3a,0xe3,
-0xba,0xea,0xea,0xba,0x0a,0x0a,0x0a,0xa0,0xa0,0xa0,0xad,0xae,0xae,0xae,0x07,0x00,
-0x00,0x5c,0x1f,0x01,0x40,0x28,0xf2,0x10,0x39,0x8c,0x98,0xa0,0x05,0x73,0xa5,0x3b,
-0x00,0x57,0x4b,0x54,0xb0,0x04,0xa8,0xd9,0x8a,0x00,0x0a,0x3c,0x00,0x00,0x00,0x3f,
-0x80,0x00,0x01,0xa9,0x35,0xaa,0xa7,0x1d,0x02,0xf0,0x1a,0xa1,0x01,0xa1,0x02,0x8d,
-0x73,0x8d,0x80,0x48,0xd8,0x59,0xd8,0x30,0x7b,0x30,0x99,0x40,0x59,0x28,0x96,0x29,
-0x40,0x68,0x66,0x6a,0x30,0x06,0x98,0x88,0xb3,0x00,0x63,0x00,0x07,0x30,0x06,0xa8,
-0x88,0xb3,0x00,0x09,0xbf,0x00,0xf4,0x10,0x97,0x66,0x6b,0x30,0x05,0x77,0x77,0x71,
-0x06,0xd8,0xd8,0x88,0x82,0x0b,0x7d,0x6b,0x8b,0x00,0xb7,0xd0,0xa6,0x40,0x3c,0x8d,
-0x48,0xe2,0x04,0x41,0xa7,0x51,0xa2,0x13,0x18,0xf0,0x04,0x96,0x00,0x39,0x00,0x00,
-0x00,0x0c,0xb9,0x99,0x60,0x09,0xc5,0x22,0x39,0x02,0x57,0x86,0x66,0x90,0xb8,0x11,
-0x30,0x00,0x07,0x20,0x9e,0x2a,0x30,0x04,0xa7,0x00,0xa4,0x05,0xf4,0x15,0x01,0xb4,
-0x87,0x9a,0x9a,0x1b,0x48,0x79,0x10,0xa0,0x98,0xb4,0x99,0x8a,0x09,0x8a,0x49,0x00,
-0xa0,0x91,0x64,0xaa,0x9a,0x4a,0x9a,0x8a,0x00,0xa0,0xa2,0xa2,0xa0,0x0a,0x38,0x02,
-0x84,0x2a,0x39,0x16,0x02,0x9d,0x05,0x14,0x05,0x9d,0x05,0xf5,0x08,0x2a,0xab,0xfc,
-0xaa,0x70,0x00,0x9d,0xb2,0x00,0x00,0x86,0xa2,0xb2,0x01,0xb6,0x0a,0x01,0xb5,0x12,
-0x00,0xa0,0x00,0x30,0x29,0x00,0xf0,0x0a,0x1a,0xaa,0xea,0xaa,0x60,0x00,0xaa,0x92,
-0x00,0x00,0x56,0xa2,0xa0,0x00,0x2b,0x0a,0x06,0x80,0x2b,0x8a,0xeb,0xa8,0x90,0x10,
-0x0a,0x59,0x1c,0x14,0xa0,0x51,0x00,0xf3,0x14,0x08,0xba,0x90,0x4a,0xe9,0x82,0x09,
-0x00,0x4d,0x08,0x20,0x90,0x08,0xc9,0x92,0x09,0x01,0x9a,0x4a,0x00,0x90,0x72,0xa0,
-0xb0,0x09,0x20,0x0a,0x28,0x00,0x98,0x00,0xa9,0x10,0x0c,0x90,0xef,0x03,0x00,0x8c,
-0x26,0x30,0xae,0xa4,0x5a,0x98,0x23,0x10,0x5d,0xf3,0x0b,0x40,0xcb,0xaa,0xea,0x82,
-0xcc,0x11,0x11,0x72,0xa5,0x1c,0x22,0x00,0x0a,0xae,0x1c,0x01,0xb0,0x15,0xf2,0x14,
-0x09,0xb9,0xa7,0x00,0x1b,0x97,0x1c,0x20,0x02,0x20,0xae,0x60,0x00,0x47,0x95,0x48,
-0xb9,0x11,0x89,0x9d,0x99,0x40,0x00,0x51,0x93,0x20,0x00,0x85,0x09,0x1b,0x10,0x15,
-0x08,0x70,0x24,0x53,0x00,0xf1,0x3e,0x89,0x9d,0xa9,0x93,0x00,0x70,0x90,0x26,0x00,
-0x09,0x29,0x09,0x10,0x2a,0xba,0xda,0xba,0x70,0x00,0x8d,0xb1,0x00,0x00,0x77,0x92,
-0xb1,0x01,0xa7,0x09,0x02,0xc4,0x13,0x00,0x90,0x00,0x50,0x00,0xa0,0x00,0x17,0x30,
-0x0a,0x0a,0xaa,0x61,0x2a,0xd7,0xa0,0x00,0x00,0x4d,0x0d,0xc9,0xb3,0x07,0xc7,0xa9,
-0x0a,0x11,0x8a,0x19,0x55,0xb0,0x52,0xa3,0x70,0xe3,0x00,0x0a,0x73,0x7a,0x80,0x00,
-0xa9,0x74,0x04,0x80,0xfb,0x1f,0x00,0x9d,0x06,0xf1,0x15,0x62,0x7d,0x9d,0x10,0x6c,
-0xa1,0x90,0x90,0x00,0xb7,0x0a,0x1d,0x90,0x0e,0xa1,0xe2,0x0b,0x07,0x93,0x18,0x84,
-0x80,0x76,0x26,0x37,0xc1,0x00,0x63,0xa0,0x9c,0x40,0x06,0x84,0x84,0x09,0x30,0x6c,
-0x05,0xf2,0x14,0xb9,0xd9,0x9c,0x00,0x5b,0x8d,0x98,0xc0,0x05,0x61,0xa2,0x1b,0x00,
-0x27,0x7c,0x77,0x60,0x29,0x9a,0xec,0x99,0x60,0x01,0xbb,0x86,0x00,0x06,0xb1,0x90,
-0x6a,0x32,0x60,0x09,0x00,0x15,0xc7,0x0b,0xf5,0x13,0x69,0xda,0x91,0x7d,0xb0,0x09,
-0x00,0x00,0xa4,0x7a,0xd9,0xd0,0x0e,0xa8,0x1b,0x1a,0x05,0xb4,0x92,0xa9,0xa0,0x87,
-0x27,0xa2,0x6c,0x00,0x72,0x72,0x00,0xa0,0x07,0x27,0x10,0x7b,0x85,0x1a,0xf0,0x13,
-0x02,0x99,0x9d,0x99,0x96,0x00,0x2a,0xb8,0x70,0x01,0x8b,0x16,0x07,0xd6,0x26,0x77,
-0x77,0x94,0x50,0x0b,0x55,0x5a,0x20,0x00,0xa2,0x22,0x92,0x00,0x05,0x77,0x77,0x10,
-0x09,0x99,0x95,0x0b,0x12,0xa0,0x68,0x28,0x30,0xa3,0x29,0xd8,0x94,0x3a,0xf0,0x09,
-0x09,0x9a,0x98,0x08,0xb9,0x00,0xa0,0x02,0x9a,0x17,0x2a,0x81,0x51,0xa0,0xa0,0xa3,
-0x60,0x0a,0x45,0x0a,0x0a,0x00,0xa0,0x1a,0x23,0x04,0xf1,0x0b,0x43,0x09,0x00,0x0a,
-0x01,0x92,0x80,0x1b,0xe7,0xab,0xcb,0x40,0x4e,0x10,0x00,0x00,0x08,0xb8,0x00,0x00,
-0x02,0x8a,0x16,0xaa,0xa0,0x31,0x44,0x00,0x34,0x3a,0xaa,0xa7,0x1b,0x15,0x00,0x83,
-0x20,0xf7,0x17,0xa0,0x00,0x07,0x23,0x5a,0x65,0x16,0xcb,0x58,0x69,0x61,0x0b,0x41,
-0x90,0x47,0x00,0xeb,0x87,0x05,0x91,0x6a,0x61,0x64,0xa0,0x09,0x72,0x00,0xd5,0x00,
-0x07,0x20,0x89,0xb2,0x00,0x72,0x94,0x02,0xa2,0xd5,0x1d,0xd0,0x17,0x01,0x90,0x08,
-0x10,0xb0,0x74,0x06,0xda,0x6a,0xbc,0xa0,0x0b,0xe8,0x13,0xd0,0xfa,0x39,0xd9,0x70,
-0x7a,0x30,0x0a,0x00,0x07,0x81,0x99,0xd9,0x92,0xee,0x2d,0x01,0x98,0x0c,0x02,0x5f,
-0x00,0xf0,0x14,0x08,0x20,0x00,0x07,0x20,0xdc,0xca,0x07,0xdb,0xac,0x17,0x50,0x0c,
-0x82,0x1c,0x90,0x01,0xe9,0x7a,0x58,0x92,0x98,0x37,0x99,0x97,0x14,0x72,0x45,0x00,
-0xa0,0x07,0x24,0xb9,0x9a,0x00,0x09,0x00,0x03,0xb0,0x0a,0x00,0x7b,0x08,0xf6,0x11,
-0xa9,0x99,0x94,0x8d,0xaa,0x69,0x99,0x00,0xb5,0x90,0x36,0x00,0x1e,0x9b,0x4a,0xb7,
-0x09,0x92,0x90,0x36,0x00,0x37,0x19,0x68,0x98,0x00,0x71,0xa8,0x88,0x85,0x07,0x10,
-0xba,0x00,0xf1,0x14,0xc0,0x00,0x07,0x20,0x78,0x90,0x07,0xec,0x59,0x05,0x80,0x0c,
-0x79,0x89,0x96,0x41,0xea,0x30,0x40,0x40,0x89,0x25,0x38,0x08,0x02,0x72,0x15,0x47,
-0x10,0x07,0x28,0x88,0xc8,0x20,0x72,0x7d,0x09,0xf0,0x0b,0xa0,0xa0,0x00,0x72,0x8d,
-0xae,0xa2,0x6d,0xb5,0x99,0x97,0x00,0xa5,0x74,0x33,0xa0,0x0e,0xb8,0x87,0x7b,0x06,
-0xb4,0x47,0xc7,0x50,0x67,0x54,0x09,0xf1,0x21,0x72,0x0a,0x3b,0x10,0x07,0x3c,0x40,
-0x2a,0x30,0x06,0x30,0x90,0x90,0x00,0x63,0x6e,0xbd,0xb0,0x5c,0xb3,0xb3,0xa4,0x00,
-0xb6,0x45,0xb5,0x51,0x0e,0xb8,0x8c,0x7b,0x07,0x94,0x77,0xc6,0xb0,0x46,0x36,0x8c,
-0x7b,0x00,0x63,0x08,0x07,0x30,0x06,0x39,0x10,0x5c,0x35,0x01,0x9b,0x1b,0xf6,0x16,
-0x00,0xb9,0x97,0x72,0x00,0x1b,0x11,0x5a,0x99,0xb1,0xa9,0x75,0x78,0x18,0x18,0x6b,
-0x11,0xb1,0x21,0x86,0xc0,0x0e,0x20,0x1a,0xa3,0x72,0xb7,0x01,0xc2,0x12,0x92,0xa2,
-0x08,0x88,0x87,0x01,0x70,0x95,0x2a,0x92,0x30,0x91,0x00,0x00,0x73,0x09,0xba,0xa0,
-0x07,0x09,0x00,0x20,0x10,0x00,0x09,0x00,0x51,0x07,0xcb,0x9d,0xa9,0x92,0x14,0x1a,
-0x00,0x63,0x1d,0x10,0x30,0x9c,0x06,0xb1,0x01,0x70,0x82,0x00,0x00,0x18,0x08,0xba,
-0x90,0x01,0x80,0x09,0x00,0x80,0x20,0x00,0x29,0xd9,0xca,0x99,0x60,0x11,0xc8,0x0d,
-0x00,0x6a,0x15,0x00,0xc4,0x04,0xb0,0x08,0x0a,0x0a,0x06,0x10,0xa0,0xe9,0xb9,0x70,
-0x0a,0x0a,0xe9,0x16,0x01,0xd6,0x04,0xb2,0x0a,0x00,0x30,0xa0,0xb4,0xb0,0x0a,0x5e,
-0xba,0x78,0xab,0x5e,0x39,0x00,0xe0,0x06,0xa0,0x35,0x0c,0x99,0x50,0x04,0x60,0xb0,
-0x00,0x06,0xbb,0x89,0x1c,0xf0,0x04,0x80,0xb0,0x25,0x00,0x95,0x0b,0x0b,0x10,0x14,
-0x00,0xbb,0x30,0x00,0x37,0xb8,0x00,0x00,0x57,0x30,0x96,0x1c,0xf0,0x14,0xdb,0xad,
-0xba,0x70,0x0b,0x00,0x81,0x00,0x04,0xc9,0xa8,0x29,0x31,0xb1,0x19,0x8b,0x30,0x12,
-0xba,0x38,0x20,0x00,0x03,0xb0,0x81,0x02,0x04,0xb1,0x08,0x20,0xa2,0x80,0x00,0x29,
-0x93,0x77,0x00,0xf1,0x12,0x04,0xcb,0x97,0x2a,0x00,0x09,0x43,0xca,0xd9,0x40,0xa5,
-0xd5,0x0a,0x00,0x67,0x49,0x9a,0xe9,0x73,0x3d,0x20,0xae,0x50,0x00,0xb0,0x84,0xa9,
-0x10,0x94,0x96,0x0a,0x2a,0x46,0x21,0x04,0x00,0x9b,0x3a,0xf6,0x15,0x88,0x40,0xd9,
-0x80,0x0c,0x87,0x18,0x08,0x00,0xa0,0x0a,0x30,0xa6,0x0c,0x98,0x68,0x88,0x00,0xa0,
-0x02,0x80,0xb0,0x3d,0x9a,0x09,0x86,0x03,0xb1,0x00,0x8f,0x40,0x0a,0x02,0xc5,0x19,
-0x80,0x01,0x0d,0x07,0xbd,0x33,0x95,0xa4,0x0c,0xaa,0x1c,0xb5,0x00,0xa0,0x00,0xd2,
-0x12,0x00,0xb5,0x08,0x0b,0x28,0x1b,0x01,0x80,0xe9,0x30,0xaa,0xb4,0x00,0xd5,0x00,
-0x03,0x65,0x1e,0xf0,0x0c,0x06,0x03,0xab,0x8d,0x3a,0x30,0x00,0x74,0xbc,0x40,0x00,
-0x0c,0x0b,0x47,0x00,0x09,0x50,0xb0,0x86,0x05,0x90,0x0b,0x00,0x77,0x00,0x0a,0xa0,
-0xcc,0x2d,0xf1,0x0e,0x0a,0x00,0x01,0xb7,0x20,0xa0,0x00,0x00,0x1a,0x0a,0x27,0x06,
-0x20,0xa6,0xd8,0xb0,0x07,0x6e,0x4a,0x0a,0x00,0x03,0xa0,0xa0,0xb0,0x06,0x4a,0x02,
-0x58,0xd6,0x34,0x42,0x44,0x05,0xa9,0x9b,0xce,0x01,0xf0,0x18,0xa6,0x0d,0x9d,0x00,
-0x00,0x12,0x80,0xa0,0x04,0x82,0xa2,0x05,0x94,0x02,0x1a,0x99,0x97,0x00,0x05,0x38,
-0x07,0x60,0x07,0x30,0x79,0x90,0x01,0xa0,0x5a,0x9a,0x50,0x12,0x45,0x00,0x05,0x30,
-0x0a,0x10,0x0a,0x96,0x39,0x00,0xf9,0x19,0xf3,0x0c,0xae,0xaa,0x04,0x91,0xa0,0xa0,
-0x90,0x03,0x2a,0x0a,0x09,0x00,0x01,0xaa,0xea,0xd0,0x04,0x6a,0x0a,0x09,0x01,0xb0,
-0xaa,0xea,0xd0,0x02,0x0a,0x09,0x2d,0xf0,0x10,0x01,0xa3,0x2c,0x9d,0x00,0x00,0x13,
-0x60,0xa0,0x06,0x30,0x92,0x0a,0x20,0x07,0x46,0x00,0x26,0x10,0x03,0xa9,0x9a,0x90,
-0x08,0x3a,0x00,0x19,0x04,0x80,0xa9,0x9a,0x54,0x05,0x30,0x18,0x00,0x09,0x1e,0x0d,
-0x10,0x3a,0xd6,0x04,0x50,0x05,0xad,0xaa,0x04,0x91,0x5a,0x20,0xf2,0x06,0x19,0xae,
-0xaa,0x40,0x06,0x03,0x70,0x00,0x04,0x60,0xa0,0x65,0x00,0xb0,0x7b,0x99,0xd0,0x03,
-0x02,0x20,0x03,0xe9,0x1c,0x10,0x69,0x7b,0x00,0xf0,0x11,0x0c,0x9d,0x9c,0x54,0x80,
-0xa0,0xa0,0x60,0x02,0x0c,0xd9,0x9c,0x00,0x14,0xa6,0x36,0x60,0x08,0x49,0x0a,0xb0,
-0x01,0xa6,0x37,0xaa,0x60,0x22,0x65,0x40,0x05,0x40,0x03,0x4d,0x05,0x10,0x4a,0x8b,
-0x1a,0xf0,0x03,0x08,0xab,0xba,0x62,0xa1,0x00,0x73,0x00,0x02,0x40,0x07,0x30,0x00,
-0x03,0x4a,0xcb,0xa2,0x00,0xff,0x17,0x92,0x74,0x00,0x73,0x00,0x0a,0x09,0x9c,0xb9,
-0x70,0xab,0x2d,0x00,0x62,0x13,0xf5,0x10,0x5c,0x99,0x80,0x00,0x2c,0x80,0x85,0x04,
-0x92,0x15,0xb8,0x00,0x02,0x38,0xa5,0x99,0x20,0x07,0xa9,0x99,0x92,0x05,0x6a,0x00,
-0x0a,0x01,0xb0,0xa9,0x99,0xb0,0x02,0x7f,0x35,0x10,0x76,0x20,0x49,0xf1,0x0d,0x10,
-0x90,0x90,0xa2,0x70,0x6b,0x2d,0x3a,0x04,0x49,0x98,0xaa,0xa0,0x05,0x57,0x59,0x5a,
-0x04,0x64,0x50,0x90,0xa0,0x90,0x81,0x09,0x0a,0x19,0x18,0xd7,0x1f,0x01,0x00,0x02,
-0x60,0x36,0x00,0x68,0x59,0xc8,0x30,0x7b,0x03,0xf0,0x14,0x04,0x92,0xaa,0xdb,0xa6,
-0x02,0x20,0x07,0x20,0x00,0x06,0x5a,0xba,0xb0,0x06,0x56,0x20,0x09,0x01,0xa0,0x69,
-0x88,0xc0,0x01,0x06,0x41,0x19,0x00,0x06,0x00,0x07,0x00,0x00,0x47,0x99,0x23,0x30,
-0xf3,0x0e,0x92,0x43,0x04,0x90,0x7b,0x67,0xd0,0x03,0x26,0x54,0x35,0x40,0x02,0x54,
-0x92,0x70,0x02,0x86,0x29,0x27,0x00,0xa1,0xa0,0x92,0x75,0x27,0x57,0x05,0x1b,0xcd,
-0x06,0x02,0xad,0x20,0xf2,0x16,0x08,0x03,0x8c,0x8c,0x34,0x80,0x00,0x87,0x84,0x48,
-0x2a,0x18,0x88,0x44,0x80,0x00,0x88,0x84,0x48,0x02,0x38,0x88,0x44,0x80,0x82,0x38,
-0x31,0x18,0x0a,0x05,0x76,0x00,0x81,0x63,0x70,0x71,0x86,0x83,0x25,0xf0,0x0d,0x05,
-0x0a,0x04,0x10,0x46,0x74,0xa0,0xb0,0x00,0x01,0x4a,0x14,0x05,0x90,0xaa,0xaa,0xd0,
-0x03,0x0a,0x66,0x6c,0x00,0x04,0xa2,0x22,0xb0,0x07,0x3a,0xa9,0x21,0x81,0xa0,0x00,
-0xa0,0x35,0x0a,0x00,0x9a,0x00,0x87,0x26,0xe0,0x86,0xb8,0x88,0xb0,0x00,0x0b,0x77,
-0x7b,0x04,0x70,0xb8,0x88,0xb0,0x07,0x16,0x03,0xf2,0x02,0x06,0xb9,0x4b,0x72,0x04,
-0x6a,0x00,0xc1,0x00,0xa0,0xa0,0x19,0x08,0x27,0x0e,0xb5,0xb9,0x46,0x0c,0x00,0x05,
-0x00,0x40,0x58,0x89,0xe9,0x94,0x4f,0x27,0xf0,0x09,0x02,0x73,0x9e,0xad,0xa7,0x04,
-0x14,0x82,0x2a,0x00,0x15,0x91,0x90,0x68,0x06,0x48,0x2a,0x97,0x30,0xb0,0x80,0x97,
-0x18,0x06,0x8a,0x41,0xf6,0x42,0x08,0x01,0x1a,0x21,0x00,0x38,0x78,0xd9,0x83,0x00,
-0x05,0x7c,0x87,0x12,0xa3,0x88,0xb8,0x86,0x01,0x14,0x88,0x88,0x00,0x05,0x86,0x55,
-0xb0,0x03,0x78,0x43,0x3b,0x00,0xa1,0x88,0x77,0xc0,0x07,0x08,0x10,0x6a,0x00,0x24,
-0x06,0x00,0x16,0x10,0x88,0xd9,0x89,0x30,0x00,0x17,0x06,0x20,0x05,0x45,0x64,0x68,
-0x64,0x03,0x9b,0xb9,0x29,0x00,0x30,0x35,0x81,0x90,0x0a,0x5b,0xcb,0x09,0x03,0x72,
-0x45,0xa0,0x90,0x61,0x03,0x76,0x09,0x95,0x31,0xf1,0x14,0x95,0xc9,0x9a,0x70,0x00,
-0x0c,0x88,0x97,0x07,0x70,0xb4,0x46,0x70,0x03,0x04,0x44,0x42,0x00,0x15,0xcc,0xaa,
-0xa0,0x08,0x47,0x83,0x49,0x01,0x91,0x78,0x34,0x90,0x63,0x9c,0xcb,0xbd,0xad,0x06,
-0xf2,0x19,0x11,0x05,0x02,0x20,0x01,0xa2,0x92,0x77,0x51,0x00,0x8c,0x9c,0x44,0x17,
-0x71,0x92,0x89,0xa0,0x02,0x3b,0xc0,0x74,0x00,0x54,0x59,0x8d,0x92,0x0a,0x62,0x90,
-0x90,0x04,0x69,0x09,0x09,0x00,0x74,0x58,0x84,0xb0,0xcf,0x04,0x00,0x04,0x27,0xf2,
-0x14,0xa2,0x8a,0xca,0x85,0x01,0x18,0x91,0x97,0x04,0x43,0x38,0x19,0x15,0x07,0x08,
-0x88,0x8a,0x00,0x51,0x57,0x77,0xb0,0x0a,0x0d,0x88,0x88,0x21,0xa0,0x00,0x00,0x81,
-0x13,0x00,0x01,0x8a,0x02,0x01,0xf1,0x15,0x85,0xd9,0x9c,0x95,0x00,0x0a,0x59,0xc7,
-0x15,0x90,0xaa,0x22,0x73,0x02,0x0a,0xa4,0x48,0x30,0x24,0x87,0x8b,0x82,0x08,0x56,
-0x71,0xa8,0x00,0xa8,0x59,0x0a,0x56,0x34,0x92,0x19,0x70,0x20,0xb0,0x00,0xf0,0x0e,
-0xa4,0x98,0x89,0x90,0x00,0x19,0x7a,0x09,0x06,0x56,0xb8,0xa8,0xb6,0x04,0x67,0x88,
-0x87,0x60,0x23,0xa6,0x66,0xa0,0x09,0x1a,0x77,0x7a,0x01,0xa0,0x90,0xab,0x06,0x22,
-0x02,0x87,0x7f,0x00,0x00,0xb9,0x02,0xf2,0x14,0x76,0x99,0xc9,0x95,0x00,0x05,0x61,
-0x67,0x03,0x83,0x68,0x45,0x56,0x03,0x19,0xb9,0xb5,0x00,0x04,0x3a,0x92,0x62,0x06,
-0x8b,0x70,0xb8,0x00,0xa1,0x39,0x62,0xb3,0x03,0x04,0x61,0x00,0x3c,0x0a,0xf0,0x11,
-0x85,0x55,0x90,0xa0,0x00,0x3b,0xbd,0x9d,0x72,0x60,0x33,0x50,0x60,0x03,0x3c,0x9d,
-0x99,0x90,0x04,0x88,0xd9,0x95,0x06,0x37,0x29,0x09,0x00,0xa0,0x72,0x94,0xb0,0x01,
-0x85,0x03,0x90,0x07,0x24,0xb5,0xa6,0x30,0x16,0x4b,0x5a,0x63,0x8f,0x2a,0xf0,0x1e,
-0x82,0xb2,0x04,0x69,0x00,0x02,0x1b,0xbb,0xda,0x70,0x04,0xa6,0x4b,0x27,0x04,0x7a,
-0x98,0xa8,0x70,0xb1,0xb4,0x61,0x47,0x06,0x0a,0x00,0x18,0x50,0x06,0x00,0x09,0x33,
-0x00,0x67,0x00,0xa6,0x61,0x00,0x0b,0x8d,0x89,0x52,0x91,0x97,0xc7,0x6b,0x54,0xf1,
-0x04,0x89,0x10,0x04,0x90,0x01,0x00,0x06,0x57,0x23,0x84,0x00,0xa6,0x56,0x84,0x54,
-0x26,0x94,0x1a,0x77,0x1f,0x0f,0xf5,0x1a,0x21,0x04,0x10,0x40,0x01,0xa6,0xb8,0x29,
+0x58,0x8d,0x98,0x50,0xb7,0x09,0xf2,0x43,0x01,0x99,0x9d,0xa9,0x95,0x01,0x10,0x01,
+0x80,0x00,0xed,0x40,0x18,0x00,0x08,0x44,0xba,0xdb,0x60,0x95,0x49,0x18,0x36,0x0c,
+0xa4,0x91,0x83,0x60,0x84,0x89,0xbe,0x88,0x0d,0xb4,0x0a,0x83,0x00,0x60,0x08,0x50,
+0xb2,0x00,0x05,0x30,0x01,0x60,0x04,0xa7,0x77,0x97,0x00,0x4a,0x77,0x79,0x70,0x03,
+0x98,0x88,0x86,0x02,0x99,0x99,0x99,0x96,0x00,0x70,0xa0,0x00,0x00,0x1d,0x0a,0x99,
+0x80,0x07,0x97,0xa0,0x00,0x03,0xa0,0x6b,0x99,0x97,0x05,0x07,0x70,0x88,0x88,0xb3,
+0x00,0xa8,0x88,0x8b,0xf0,0x09,0xf1,0x05,0x63,0x00,0x69,0xd9,0xd8,0x20,0x0a,0x09,
+0x18,0x56,0x00,0x44,0x91,0x88,0x00,0x79,0x9d,0xad,0x99,0x30,0x25,0x00,0xf2,0x13,
+0x41,0x00,0x60,0x00,0x7a,0xc8,0x9d,0x82,0x02,0x57,0x29,0x07,0x00,0x08,0x72,0x95,
+0x20,0x28,0x88,0x88,0x88,0x60,0x0c,0x77,0x78,0x80,0x00,0xc8,0x88,0x98,0x00,0x09,
+0x00,0x01,0x09,0x00,0xf0,0x3e,0x0a,0x77,0x77,0xb3,0x00,0xa7,0x77,0x7a,0x30,0x04,
+0x78,0xb7,0x71,0x06,0x88,0x88,0x88,0x81,0x07,0x86,0x66,0xc0,0x00,0x58,0x7a,0x7a,
+0x00,0x05,0x80,0x94,0x81,0x06,0x61,0x87,0x01,0x90,0x00,0x60,0x00,0x25,0x12,0xba,
+0x86,0xa5,0x30,0x0d,0x9c,0x7a,0x89,0x40,0x24,0xa5,0x90,0x90,0x27,0x79,0x47,0x09,
+0x00,0x19,0x98,0x88,0x80,0x02,0xa5,0x55,0x5a,0x00,0x28,0x22,0x22,0xa0,0x02,0xb8,
+0x88,0x8a,0x00,0x92,0x07,0xf4,0x02,0x0a,0x0a,0x00,0xba,0xea,0xea,0xba,0x0a,0x0a,
+0x0a,0xa0,0xa0,0xa0,0xad,0xae,0xae,0xae,0x07,0x00,0xf2,0x18,0x00,0x00,0xa0,0x19,
+0x99,0xda,0x99,0x50,0x39,0x8c,0x98,0xa0,0x05,0x73,0xa5,0x3b,0x00,0x57,0x4b,0x54,
+0xb0,0x04,0xa8,0xd9,0x8a,0x00,0x0a,0x3c,0x00,0x00,0x00,0x3f,0x80,0x00,0x01,0xa9,
+0x35,0xaa,0xa7,0x1d,0x02,0xf0,0x1a,0xa1,0x01,0xa1,0x02,0x8d,0x73,0x8d,0x80,0x48,
+0xd8,0x59,0xd8,0x30,0x7b,0x30,0x99,0x40,0x59,0x28,0x96,0x29,0x40,0x68,0x66,0x6a,
+0x30,0x06,0x98,0x88,0xb3,0x00,0x63,0x00,0x07,0x30,0x06,0xa8,0x88,0xb3,0x00,0x09,
+0xbf,0x00,0xf0,0x2f,0x97,0x66,0x6b,0x30,0x05,0x77,0x77,0x71,0x06,0xd8,0xd8,0x88,
+0x82,0x0b,0x7d,0x6b,0x8b,0x00,0xb7,0xd0,0xa6,0x40,0x3c,0x8d,0x48,0xe2,0x04,0x41,
+0xa7,0x51,0xa2,0x00,0x04,0x30,0x00,0x01,0x99,0xda,0x99,0x96,0x00,0x39,0x00,0x00,
+0x00,0x0c,0xb9,0x99,0x60,0x09,0xc5,0x22,0x39,0x02,0x57,0x86,0x66,0x90,0x00,0x7a,
+0x99,0x99,0x40,0x06,0x60,0x90,0x00,0x72,0x04,0xa7,0x00,0xa4,0x05,0xf2,0x15,0x01,
+0xb4,0x87,0x9a,0x9a,0x1b,0x48,0x79,0x10,0xa0,0x98,0xb4,0x99,0x8a,0x09,0x8a,0x49,
+0x00,0xa0,0x91,0x64,0xaa,0x9a,0x4a,0x9a,0x8a,0x00,0xa0,0xa2,0xa2,0xa0,0x0a,0x38,
+0x02,0x84,0x2a,0x72,0x04,0x04,0x9d,0x05,0x14,0x05,0x9d,0x05,0xf5,0x08,0x2a,0xab,
+0xfc,0xaa,0x70,0x00,0x9d,0xb2,0x00,0x00,0x86,0xa2,0xb2,0x01,0xb6,0x0a,0x01,0xb5,
+0x12,0x00,0xa0,0x00,0x30,0x29,0x00,0xf2,0x0c,0x1a,0xaa,0xea,0xaa,0x60,0x00,0xaa,
+0x92,0x00,0x00,0x56,0xa2,0xa0,0x00,0x2b,0x0a,0x06,0x80,0x2b,0x8a,0xeb,0xa8,0x90,
+0x10,0x0a,0x00,0x01,0x24,0x00,0x01,0x28,0x00,0xf2,0x14,0x08,0xba,0x90,0x4a,0xe9,
+0x82,0x09,0x00,0x4d,0x08,0x20,0x90,0x08,0xc9,0x92,0x09,0x01,0x9a,0x4a,0x00,0x90,
+0x72,0xa0,0xb0,0x09,0x20,0x0a,0x28,0x00,0x98,0x00,0xa9,0x10,0x0c,0x90,0xef,0x03,
+0x00,0xf1,0x09,0x90,0x08,0xae,0xa4,0x5a,0xd9,0x00,0xa0,0x00,0x5d,0xf3,0x0b,0x90,
+0xcb,0xaa,0xea,0x82,0x99,0x30,0x0a,0x00,0x72,0xe8,0x09,0x10,0x09,0x72,0x00,0x10,
+0x90,0x53,0x00,0x10,0x05,0x29,0x00,0xf2,0x13,0xb9,0xa7,0x00,0x1b,0x97,0x1c,0x20,
+0x02,0x20,0xae,0x60,0x00,0x47,0x95,0x48,0xb9,0x11,0x89,0x9d,0x99,0x40,0x00,0x51,
+0x93,0x20,0x00,0x85,0x09,0x1b,0x10,0x15,0x08,0x70,0x24,0x53,0x00,0xf1,0x3d,0x89,
+0x9d,0xa9,0x93,0x00,0x70,0x90,0x26,0x00,0x09,0x29,0x09,0x10,0x2a,0xba,0xda,0xba,
+0x70,0x00,0x8d,0xb1,0x00,0x00,0x77,0x92,0xb1,0x01,0xa7,0x09,0x02,0xc4,0x13,0x00,
+0x90,0x00,0x50,0x00,0xa0,0x00,0x17,0x30,0x0a,0x0a,0xaa,0x61,0x2a,0xd7,0xa0,0x00,
+0x00,0x4d,0x0d,0xc9,0xb3,0x07,0xc7,0xa9,0x0a,0x11,0x8a,0x19,0x55,0xb0,0x52,0xa3,
+0x70,0xe3,0x00,0x0a,0x73,0x7a,0x80,0x00,0xa9,0x74,0x04,0xf4,0x0b,0x10,0x06,0x9d,
+0x06,0xf1,0x15,0x62,0x7d,0x9d,0x10,0x6c,0xa1,0x90,0x90,0x00,0xb7,0x0a,0x1d,0x90,
+0x0e,0xa1,0xe2,0x0b,0x07,0x93,0x18,0x84,0x80,0x76,0x26,0x37,0xc1,0x00,0x63,0xa0,
+0x9c,0x40,0x06,0x84,0x84,0x09,0x30,0x6c,0x05,0xf2,0x14,0xb9,0xd9,0x9c,0x00,0x5b,
+0x8d,0x98,0xc0,0x05,0x61,0xa2,0x1b,0x00,0x27,0x7c,0x77,0x60,0x29,0x9a,0xec,0x99,
+0x60,0x01,0xbb,0x86,0x00,0x06,0xb1,0x90,0x6a,0x32,0x60,0x09,0x00,0x15,0xc7,0x0b,
+0xf4,0x14,0x69,0xda,0x91,0x7d,0xb0,0x09,0x00,0x00,0xa4,0x7a,0xd9,0xd0,0x0e,0xa8,
+0x1b,0x1a,0x05,0xb4,0x92,0xa9,0xa0,0x87,0x27,0xa2,0x6c,0x00,0x72,0x72,0x00,0xa0,
+0x07,0x27,0x10,0x7b,0x00,0x16,0x05,0xf0,0x13,0x02,0x99,0x9d,0x99,0x96,0x00,0x2a,
+0xb8,0x70,0x01,0x8b,0x16,0x07,0xd6,0x26,0x77,0x77,0x94,0x50,0x0b,0x55,0x5a,0x20,
+0x00,0xa2,0x22,0x92,0x00,0x05,0x77,0x77,0x10,0x09,0x99,0x95,0x0b,0x01,0x7c,0x01,
+0xf0,0x12,0x05,0xaa,0xa3,0x29,0xd8,0x00,0x00,0x00,0x4e,0x09,0x9a,0x98,0x08,0xb9,
+0x00,0xa0,0x02,0x9a,0x17,0x2a,0x81,0x51,0xa0,0xa0,0xa3,0x60,0x0a,0x45,0x0a,0x0a,
+0x00,0xa0,0x1a,0x23,0x04,0xf1,0x0b,0x43,0x09,0x00,0x0a,0x01,0x92,0x80,0x1b,0xe7,
+0xab,0xcb,0x40,0x4e,0x10,0x00,0x00,0x08,0xb8,0x00,0x00,0x02,0x8a,0x16,0xaa,0xa0,
+0x31,0x44,0x00,0x55,0x3a,0xaa,0xa7,0x00,0xa0,0x79,0x0d,0xf6,0x19,0x00,0xa0,0x00,
+0x07,0x23,0x5a,0x65,0x16,0xcb,0x58,0x69,0x61,0x0b,0x41,0x90,0x47,0x00,0xeb,0x87,
+0x05,0x91,0x6a,0x61,0x64,0xa0,0x09,0x72,0x00,0xd5,0x00,0x07,0x20,0x89,0xb2,0x00,
+0x72,0x94,0x02,0xa2,0x00,0x74,0x0c,0xf2,0x12,0x17,0x01,0x90,0x08,0x10,0xb0,0x74,
+0x06,0xda,0x6a,0xbc,0xa0,0x0b,0x50,0x0a,0x00,0x00,0xfa,0x39,0xd9,0x70,0x7a,0x30,
+0x0a,0x00,0x07,0x81,0x99,0xd9,0x92,0x08,0x10,0x0a,0x98,0x0c,0x02,0x5f,0x00,0xf0,
+0x14,0x08,0x20,0x00,0x07,0x20,0xdc,0xca,0x07,0xdb,0xac,0x17,0x50,0x0c,0x82,0x1c,
+0x90,0x01,0xe9,0x7a,0x58,0x92,0x98,0x37,0x99,0x97,0x14,0x72,0x45,0x00,0xa0,0x07,
+0x24,0xb9,0x9a,0x00,0x09,0x00,0x03,0xb0,0x0a,0x00,0x7b,0x08,0xf6,0x11,0xa9,0x99,
+0x94,0x8d,0xaa,0x69,0x99,0x00,0xb5,0x90,0x36,0x00,0x1e,0x9b,0x4a,0xb7,0x09,0x92,
+0x90,0x36,0x00,0x37,0x19,0x68,0x98,0x00,0x71,0xa8,0x88,0x85,0x07,0x10,0xba,0x00,
+0xf1,0x14,0xc0,0x00,0x07,0x20,0x78,0x90,0x07,0xec,0x59,0x05,0x80,0x0c,0x79,0x89,
+0x96,0x41,0xea,0x30,0x40,0x40,0x89,0x25,0x38,0x08,0x02,0x72,0x15,0x47,0x10,0x07,
+0x28,0x88,0xc8,0x20,0x72,0x7d,0x09,0xf0,0x0b,0xa0,0xa0,0x00,0x72,0x8d,0xae,0xa2,
+0x6d,0xb5,0x99,0x97,0x00,0xa5,0x74,0x33,0xa0,0x0e,0xb8,0x87,0x7b,0x06,0xb4,0x47,
+0xc7,0x50,0x67,0x54,0x09,0xf3,0x23,0x72,0x0a,0x3b,0x10,0x07,0x3c,0x40,0x2a,0x30,
+0x06,0x30,0x90,0x90,0x00,0x63,0x6e,0xbd,0xb0,0x5c,0xb3,0xb3,0xa4,0x00,0xb6,0x45,
+0xb5,0x51,0x0e,0xb8,0x8c,0x7b,0x07,0x94,0x77,0xc6,0xb0,0x46,0x36,0x8c,0x7b,0x00,
+0x63,0x08,0x07,0x30,0x06,0x39,0x10,0x0a,0x10,0x10,0x0f,0xf5,0x17,0x10,0x00,0xb9,
+0x97,0x72,0x00,0x1b,0x11,0x5a,0x99,0xb1,0xa9,0x75,0x78,0x18,0x18,0x6b,0x11,0xb1,
+0x21,0x86,0xc0,0x0e,0x20,0x1a,0xa3,0x72,0xb7,0x01,0xc2,0x12,0x92,0xa2,0x08,0x88,
+0x87,0x01,0x70,0x1e,0x0f,0xa2,0x05,0x30,0x91,0x00,0x00,0x73,0x09,0xba,0xa0,0x07,
+0x09,0x00,0x20,0x10,0x00,0x09,0x00,0xa0,0x07,0xcb,0x9d,0xa9,0x92,0x00,0x00,0x00,
+0x00,0x00,0xf1,0x05,0x09,0xaa,0xca,0xaa,0x30,0x00,0x08,0x20,0x00,0x01,0x70,0x82,
+0x00,0x00,0x18,0x08,0xba,0x90,0x01,0x80,0x09,0x00,0xf1,0x26,0x20,0x00,0x29,0xd9,
+0xca,0x99,0x60,0x11,0x11,0x11,0x10,0x00,0x0a,0x0a,0x00,0x00,0x00,0xa0,0xa0,0x00,
+0x08,0x0a,0x0a,0x06,0x10,0xa0,0xe9,0xb9,0x70,0x0a,0x0a,0x0b,0x20,0x00,0xa0,0xa0,
+0xa0,0x00,0x0a,0x0a,0x0a,0x00,0x30,0xa0,0xb4,0xb0,0x0a,0x5e,0xba,0x78,0xab,0x50,
+0x00,0x01,0x00,0xf0,0x3c,0xb0,0x00,0x00,0x35,0x0c,0x99,0x50,0x04,0x60,0xb0,0x00,
+0x06,0xbb,0xae,0xaa,0xa1,0x00,0x80,0xb0,0x25,0x00,0x95,0x0b,0x0b,0x10,0x14,0x00,
+0xbb,0x30,0x00,0x37,0xb8,0x00,0x00,0x57,0x30,0x00,0x00,0x00,0x2a,0xdb,0xad,0xba,
+0x70,0x0b,0x00,0x81,0x00,0x04,0xc9,0xa8,0x29,0x31,0xb1,0x19,0x8b,0x30,0x12,0xba,
+0x38,0x20,0x00,0x03,0xb0,0x81,0x02,0x04,0xb1,0x08,0x20,0xa2,0x80,0x00,0x29,0x93,
+0x77,0x00,0xf4,0x40,0x04,0xcb,0x97,0x2a,0x00,0x09,0x43,0xca,0xd9,0x40,0xa5,0xd5,
+0x0a,0x00,0x67,0x49,0x9a,0xe9,0x73,0x3d,0x20,0xae,0x50,0x00,0xb0,0x84,0xa9,0x10,
+0x94,0x96,0x0a,0x2a,0x46,0x00,0x00,0xa0,0x00,0x00,0x03,0x00,0x00,0x00,0x88,0x40,
+0xd9,0x80,0x0c,0x87,0x18,0x08,0x00,0xa0,0x0a,0x30,0xa6,0x0c,0x98,0x68,0x88,0x00,
+0xa0,0x02,0x80,0xb0,0x3d,0x9a,0x09,0x86,0x03,0xb1,0x00,0x8f,0x40,0x0a,0x02,0xc5,
+0x19,0x80,0x00,0x01,0x00,0x71,0xa0,0x00,0xa0,0x00,0x0a,0x00,0x0a,0x09,0x00,0x95,
+0xa4,0x0c,0xaa,0x1c,0xb5,0x00,0xa0,0x00,0xd2,0x12,0x00,0xb5,0x08,0x0b,0x28,0x1b,
+0x01,0x80,0xe9,0x30,0xaa,0xb4,0x00,0xd5,0x00,0x21,0x00,0x0b,0x09,0x00,0xf1,0x37,
+0x06,0x03,0xab,0x8d,0x3a,0x30,0x00,0x74,0xbc,0x40,0x00,0x0c,0x0b,0x47,0x00,0x09,
+0x50,0xb0,0x86,0x05,0x90,0x0b,0x00,0x77,0x00,0x0a,0xa0,0x00,0x00,0x17,0x00,0x0a,
+0x00,0x01,0xb7,0x20,0xa0,0x00,0x00,0x1a,0x0a,0x27,0x06,0x20,0xa6,0xd8,0xb0,0x07,
+0x6e,0x4a,0x0a,0x00,0x03,0xa0,0xa0,0xb0,0x06,0x4a,0x02,0x58,0x30,0xa0,0xa0,0x00,
+0x55,0x44,0x05,0xa9,0x9b,0x10,0x55,0x00,0xf0,0x1b,0xa6,0x0d,0x9d,0x00,0x00,0x12,
+0x80,0xa0,0x04,0x82,0xa2,0x05,0x94,0x02,0x1a,0x99,0x97,0x00,0x05,0x38,0x07,0x60,
+0x07,0x30,0x79,0x90,0x01,0xa0,0x5a,0x9a,0x50,0x12,0x45,0x00,0x05,0x30,0x0a,0x10,
+0x0a,0x00,0x00,0x3a,0xe3,0x00,0xf1,0x0f,0x07,0xae,0xaa,0x04,0x91,0xa0,0xa0,0x90,
+0x03,0x2a,0x0a,0x09,0x00,0x01,0xaa,0xea,0xd0,0x04,0x6a,0x0a,0x09,0x01,0xb0,0xaa,
+0xea,0xd0,0x02,0x0a,0x00,0x09,0x51,0x00,0xf0,0x19,0x01,0xa3,0x2c,0x9d,0x00,0x00,
+0x13,0x60,0xa0,0x06,0x30,0x92,0x0a,0x20,0x07,0x46,0x00,0x26,0x10,0x03,0xa9,0x9a,
+0x90,0x08,0x3a,0x00,0x19,0x04,0x80,0xa9,0x9a,0x90,0x10,0x0a,0x00,0x18,0x00,0x09,
+0x10,0x09,0x52,0x00,0xf0,0x14,0x90,0x00,0x00,0x05,0xad,0xaa,0x04,0x91,0x00,0x90,
+0x00,0x01,0x19,0xae,0xaa,0x40,0x06,0x03,0x70,0x00,0x04,0x60,0xa0,0x65,0x00,0xb0,
+0x7b,0x99,0xd0,0x03,0x02,0x20,0x03,0x20,0x09,0x0d,0x01,0x10,0x69,0x7b,0x00,0xf0,
+0x3b,0x0c,0x9d,0x9c,0x54,0x80,0xa0,0xa0,0x60,0x02,0x0c,0xd9,0x9c,0x00,0x14,0xa6,
+0x36,0x60,0x08,0x49,0x0a,0xb0,0x01,0xa6,0x37,0xaa,0x60,0x22,0x65,0x40,0x05,0x40,
+0x03,0x00,0x05,0x00,0x00,0x4a,0x00,0x74,0x00,0x00,0x08,0xab,0xba,0x62,0xa1,0x00,
+0x73,0x00,0x02,0x40,0x07,0x30,0x00,0x03,0x4a,0xcb,0xa2,0x00,0xa0,0x07,0x30,0x00,
+0x74,0x00,0x73,0x00,0x0a,0x09,0x9c,0xb9,0x70,0x00,0x00,0xaa,0x01,0xf1,0x14,0x50,
+0x00,0x00,0x69,0x5c,0x99,0x80,0x00,0x2c,0x80,0x85,0x04,0x92,0x15,0xb8,0x00,0x02,
+0x38,0xa5,0x99,0x20,0x07,0xa9,0x99,0x92,0x05,0x6a,0x00,0x0a,0x01,0xb0,0xa9,0x99,
+0xb0,0x02,0x88,0x01,0x00,0x01,0x00,0xf2,0x15,0x76,0x09,0x09,0x0a,0x00,0x10,0x90,
+0x90,0xa2,0x70,0x6b,0x2d,0x3a,0x04,0x49,0x98,0xaa,0xa0,0x05,0x57,0x59,0x5a,0x04,
+0x64,0x50,0x90,0xa0,0x90,0x81,0x09,0x0a,0x19,0x18,0x00,0x90,0xa0,0x56,0x00,0xf5,
+0x41,0x00,0x36,0x00,0x68,0x59,0xc8,0x30,0x00,0x00,0x07,0x20,0x04,0x92,0xaa,0xdb,
+0xa6,0x02,0x20,0x07,0x20,0x00,0x06,0x5a,0xba,0xb0,0x06,0x56,0x20,0x09,0x01,0xa0,
+0x69,0x88,0xc0,0x01,0x06,0x41,0x19,0x00,0x06,0x00,0x07,0x00,0x00,0x47,0x99,0xd9,
+0x94,0x00,0x00,0x92,0x43,0x04,0x90,0x7b,0x67,0xd0,0x03,0x26,0x54,0x35,0x40,0x02,
+0x54,0x92,0x70,0x02,0x86,0x29,0x27,0x00,0xa1,0xa0,0x92,0x75,0x27,0x57,0x05,0x1b,
+0x70,0x2a,0x02,0xf1,0x19,0xa1,0x00,0x00,0x08,0x03,0x8c,0x8c,0x34,0x80,0x00,0x87,
+0x84,0x48,0x2a,0x18,0x88,0x44,0x80,0x00,0x88,0x84,0x48,0x02,0x38,0x88,0x44,0x80,
+0x82,0x38,0x31,0x18,0x0a,0x05,0x76,0x00,0x81,0x63,0x70,0x71,0x86,0x2d,0x00,0xf0,
+0x1b,0x19,0x05,0x0a,0x04,0x10,0x46,0x74,0xa0,0xb0,0x00,0x01,0x4a,0x14,0x05,0x90,
+0xaa,0xaa,0xd0,0x03,0x0a,0x66,0x6c,0x00,0x04,0xa2,0x22,0xb0,0x07,0x3a,0x99,0x9d,
+0x00,0xb0,0xa0,0x00,0xa0,0x35,0x0a,0x00,0x9a,0x00,0x01,0x2e,0x00,0xe0,0x86,0xb8,
+0x88,0xb0,0x00,0x0b,0x77,0x7b,0x04,0x70,0xb8,0x88,0xb0,0x07,0x16,0x03,0xf0,0x03,
+0x06,0xb9,0x4b,0x72,0x04,0x6a,0x00,0xc1,0x00,0xa0,0xa0,0x19,0x08,0x27,0x0e,0xb5,
+0xb9,0x60,0x28,0x00,0x10,0x02,0x05,0x00,0xf3,0x65,0x58,0x89,0xe9,0x94,0x00,0x00,
+0x19,0x00,0x02,0x73,0x9e,0xad,0xa7,0x04,0x14,0x82,0x2a,0x00,0x15,0x91,0x90,0x68,
+0x06,0x48,0x2a,0x97,0x30,0xb0,0x80,0x97,0x18,0x06,0x00,0x97,0x00,0x00,0x08,0x01,
+0x1a,0x21,0x00,0x38,0x78,0xd9,0x83,0x00,0x05,0x7c,0x87,0x12,0xa3,0x88,0xb8,0x86,
+0x01,0x14,0x88,0x88,0x00,0x05,0x86,0x55,0xb0,0x03,0x78,0x43,0x3b,0x00,0xa1,0x88,
+0x77,0xc0,0x07,0x08,0x10,0x6a,0x00,0x24,0x06,0x00,0x16,0x10,0x88,0xd9,0x89,0x30,
+0x00,0x17,0x06,0x20,0x05,0x45,0x64,0x68,0x64,0x03,0x9b,0xb9,0x29,0x00,0x30,0x35,
+0x81,0x90,0x0a,0x5b,0xcb,0x09,0x03,0x72,0x45,0xa0,0x90,0x61,0x03,0x76,0x57,0x02,
+0x00,0x04,0x00,0xf0,0x15,0x95,0xc9,0x9a,0x70,0x00,0x0c,0x88,0x97,0x07,0x70,0xb4,
+0x46,0x70,0x03,0x04,0x44,0x42,0x00,0x15,0xcc,0xaa,0xa0,0x08,0x47,0x83,0x49,0x01,
+0x91,0x78,0x34,0x90,0x63,0x9c,0xcb,0xbd,0x30,0x2d,0x00,0xf2,0x1a,0x11,0x05,0x02,
+0x20,0x01,0xa2,0x92,0x77,0x51,0x00,0x8c,0x9c,0x44,0x17,0x71,0x92,0x89,0xa0,0x02,
+0x3b,0xc0,0x74,0x00,0x54,0x59,0x8d,0x92,0x0a,0x62,0x90,0x90,0x04,0x69,0x09,0x09,
+0x00,0x74,0x58,0x84,0xb0,0x00,0xd9,0x00,0xf2,0x17,0x06,0x00,0x00,0xa2,0x8a,0xca,
+0x85,0x01,0x18,0x91,0x97,0x04,0x43,0x38,0x19,0x15,0x07,0x08,0x88,0x8a,0x00,0x51,
+0x57,0x77,0xb0,0x0a,0x0d,0x88,0x88,0x21,0xa0,0x00,0x00,0x81,0x13,0x00,0x01,0x8a,
+0x02,0x01,0xf1,0x15,0x85,0xd9,0x9c,0x95,0x00,0x0a,0x59,0xc7,0x15,0x90,0xaa,0x22,
+0x73,0x02,0x0a,0xa4,0x48,0x30,0x24,0x87,0x8b,0x82,0x08,0x56,0x71,0xa8,0x00,0xa8,
+0x59,0x0a,0x56,0x34,0x92,0x19,0x70,0x20,0xb0,0x00,0xf2,0x14,0xa4,0x98,0x89,0x90,
+0x00,0x19,0x7a,0x09,0x06,0x56,0xb8,0xa8,0xb6,0x04,0x67,0x88,0x87,0x60,0x23,0xa6,
+0x66,0xa0,0x09,0x1a,0x77,0x7a,0x01,0xa0,0x90,0x00,0xa0,0x43,0x09,0x02,0x87,0x7f,
+0x00,0x00,0xb9,0x02,0xf1,0x16,0x76,0x99,0xc9,0x95,0x00,0x05,0x61,0x67,0x03,0x83,
+0x68,0x45,0x56,0x03,0x19,0xb9,0xb5,0x00,0x04,0x3a,0x92,0x62,0x06,0x8b,0x70,0xb8,
+0x00,0xa1,0x39,0x62,0xb3,0x03,0x04,0x61,0x00,0x30,0x00,0x7f,0x00,0xf0,0x10,0x55,
+0x90,0xa0,0x00,0x3b,0xbd,0x9d,0x72,0x60,0x33,0x50,0x60,0x03,0x3c,0x9d,0x99,0x90,
+0x04,0x88,0xd9,0x95,0x06,0x37,0x29,0x09,0x00,0xa0,0x72,0x94,0xb0,0x01,0x85,0x03,
+0xf0,0x43,0x07,0x24,0xb5,0xa6,0x30,0x16,0x4b,0x5a,0x63,0x00,0x1a,0xaa,0xaa,0x82,
+0xb2,0x04,0x69,0x00,0x02,0x1b,0xbb,0xda,0x70,0x04,0xa6,0x4b,0x27,0x04,0x7a,0x98,
+0xa8,0x70,0xb1,0xb4,0x61,0x47,0x06,0x0a,0x00,0x18,0x50,0x06,0x00,0x09,0x33,0x00,
+0x67,0x00,0xa6,0x61,0x00,0x0b,0x8d,0x89,0x52,0x91,0x97,0xc7,0x41,0x00,0x09,0x09,
+0x89,0x10,0x04,0x90,0x01,0x00,0x06,0x57,0x23,0x84,0x00,0xa6,0x56,0x84,0x54,0x26,
+0x94,0x1a,0x77,0x40,0x7a,0x00,0xf5,0x1a,0x21,0x04,0x10,0x40,0x01,0xa6,0xb8,0x29,
 0x00,0x00,0x86,0xa5,0xcb,0x56,0x38,0x17,0xb6,0x90,0x05,0x4c,0x88,0x9a,0x00,0x37,
 0xc7,0x38,0x80,0x09,0x2b,0xb1,0x75,0x02,0x65,0x38,0x1a,0xb0,0x72,0x94,0xa8,0x24,
-0x60,0xad,0x04,0xb0,0x01,0x0a,0x00,0x10,0x05,0x60,0xa0,0x0c,0x00,0xb1,0x1c,0xdc,
-0x60,0xf8,0x01,0xd1,0x40,0x00,0x00,0xc1,0x90,0x00,0x00,0xa5,0x05,0x90,0x03,0xb4,
-0x00,0x04,0xb4,0xa5,0x14,0xf2,0x12,0xab,0xa7,0x04,0xa6,0x00,0x81,0x01,0x5a,0x80,
-0x08,0x10,0x33,0xa1,0x00,0x81,0x00,0x2a,0x00,0x08,0x10,0x05,0xc5,0x00,0x81,0x00,
-0xb1,0x80,0x08,0x10,0x46,0x00,0x2b,0xc0,0x8b,0x19,0x90,0x99,0x99,0x9a,0x00,0x17,
-0x77,0x77,0xa0,0x06,0x09,0x00,0xf3,0x07,0x01,0x09,0x00,0x10,0x07,0x40,0xd0,0x38,
-0x00,0x50,0x69,0x74,0x00,0x03,0x99,0x03,0xa5,0x13,0x72,0x00,0x00,0x44,0x67,0x3d,
-0x21,0x99,0x91,0x09,0x00,0x40,0x8a,0xac,0xaa,0x70,0xfa,0x14,0x00,0x36,0x2a,0xf0,
-0x18,0x80,0x04,0x02,0x02,0x04,0x02,0xa0,0xa0,0xb0,0x91,0x51,0x05,0x04,0x01,0x20,
-0x00,0x43,0x25,0x00,0x00,0x0d,0x88,0xd8,0x83,0x0a,0xa2,0x2b,0x22,0x03,0x7c,0x88,
-0xd8,0x70,0x00,0xd8,0x8d,0x88,0x00,0x09,0x37,0x00,0xd1,0xc8,0x88,0x89,0x30,0x82,
-0x80,0x80,0xa1,0x18,0x06,0x15,0x32,0x70,0xb9,0x35,0xf0,0x18,0x0c,0x10,0x0a,0x70,
-0x05,0xba,0x80,0xa7,0x20,0xb5,0x78,0xad,0xa5,0x67,0x2b,0x04,0xd0,0x00,0x1d,0x30,
-0xa8,0x40,0x1b,0x50,0x86,0x0b,0x31,0x30,0x23,0x10,0x32,0x1a,0x0a,0x0a,0x0a,0x14,
-0x20,0x50,0x40,0xab,0x09,0x00,0x6f,0x00,0xf3,0x17,0x74,0x00,0x01,0x80,0xb9,0x9d,
-0x00,0x68,0x9b,0x77,0xd0,0x27,0xb5,0xa4,0x4b,0x04,0x48,0x0a,0x33,0xb0,0x04,0x70,
-0x6a,0x77,0x00,0x7d,0x43,0x66,0x30,0x0b,0x1a,0x82,0x08,0x45,0x50,0x54,0x99,0x55,
-0x2b,0x2e,0xf3,0x18,0x30,0x00,0x00,0x9c,0xb3,0xaa,0xa3,0x09,0x88,0x27,0x74,0x40,
-0x98,0x82,0xcb,0xa4,0x09,0x87,0x38,0x01,0x00,0x98,0x56,0x80,0x17,0x18,0x81,0x97,
-0x98,0x15,0x48,0x08,0x70,0x00,0x80,0x80,0x05,0xbb,0x60,0x45,0x37,0x33,0x00,0x09,
-0x10,0x04,0x00,0x50,0xba,0xaa,0xa9,0x09,0x10,0x48,0x3c,0x20,0xab,0x90,0x51,0x0a,
-0x20,0x38,0x00,0xa0,0x1b,0x02,0x19,0x0e,0xf2,0x1a,0x09,0x45,0x49,0xab,0x30,0x94,
-0x59,0x30,0x00,0x0a,0x56,0x90,0x00,0x00,0xc8,0x89,0xc9,0xb4,0x0a,0x00,0x99,0x18,
-0x20,0xd9,0x9a,0x46,0xc0,0x18,0x09,0xa0,0xc6,0x05,0x60,0xa9,0x3c,0x90,0x71,0x0c,
-0x7a,0x05,0x70,0x80,0x07,0x80,0xac,0xca,0x00,0x27,0x00,0x46,0x00,0x06,0xda,0x3e,
-0xf1,0x06,0x7a,0xab,0xfc,0xa4,0x00,0x02,0xb6,0x60,0x00,0x04,0xb1,0x46,0x00,0x2a,
-0x80,0x04,0x60,0x02,0x20,0x07,0xb3,0x91,0x06,0xf0,0x0c,0x01,0x7a,0x07,0x9d,0x94,
-0x2c,0xe6,0x00,0xa0,0x06,0x3a,0x2a,0xac,0xc8,0x30,0xa1,0x00,0x0a,0x02,0x9e,0x6a,
-0x99,0xd8,0x22,0xa0,0x55,0x0a,0xa3,0x0d,0x00,0x22,0x00,0x10,0xa9,0x04,0x1d,0xf1,
-0x17,0x13,0x03,0x1a,0x00,0xa0,0xa0,0x1a,0xa0,0x0a,0x03,0x00,0x4a,0x8a,0xea,0xa5,
-0x00,0xb0,0x0e,0x40,0x00,0x9c,0x02,0xa9,0x00,0x64,0xa0,0x83,0x91,0x00,0x0a,0x2b,
-0x02,0xa0,0x00,0xaa,0x10,0x04,0x70,0x92,0x0e,0xf2,0x07,0x99,0x9d,0xa9,0x96,0x07,
-0x14,0x67,0x17,0x00,0x26,0x8d,0x64,0x40,0x02,0x85,0x89,0x76,0x00,0x81,0xaa,0x66,
-0x64,0xc3,0x1a,0x04,0x64,0x24,0xf0,0x08,0x5c,0xa5,0xab,0xca,0x40,0x81,0x00,0xa1,
-0x00,0x4c,0x80,0x2f,0x90,0x00,0x82,0x1a,0xb2,0xa0,0x08,0x18,0x2a,0x07,0x20,0xec,
-0x2a,0x23,0x68,0x10,0x1d,0x1f,0xf2,0x15,0x2a,0xc7,0xc9,0x9c,0x10,0x09,0x0b,0x07,
-0x71,0x19,0xd4,0xb0,0x97,0x10,0x19,0x0b,0x19,0x71,0x00,0x90,0x83,0x75,0x10,0x0b,
-0x50,0x7a,0x01,0x3c,0xa4,0x38,0x90,0x80,0x00,0x5a,0x07,0x87,0xef,0x04,0x00,0xe0,
-0x11,0xf0,0x05,0xc9,0x09,0x7c,0x91,0x09,0x05,0x90,0xa0,0x00,0x90,0x89,0x0a,0x00,
-0x6d,0x88,0x95,0xd9,0x00,0x90,0x39,0x45,0x3a,0x50,0x90,0xa0,0x07,0xb8,0x84,0x2c,
-0x11,0xf0,0x07,0x19,0x99,0x30,0x6b,0x98,0xad,0x9d,0x00,0x90,0x79,0xd8,0xd0,0x4c,
-0x67,0x19,0x0a,0x02,0xb4,0x79,0xd9,0xc0,0x09,0x5c,0x03,0x60,0xa9,0x69,0xda,0x91,
-0x98,0x20,0x64,0x2b,0x10,0x99,0x79,0x46,0xf2,0x18,0x05,0x20,0x05,0xb9,0x54,0x52,
-0x90,0x09,0x05,0xab,0xac,0x02,0xb4,0x45,0x55,0x52,0x2b,0x42,0x3a,0x43,0x10,0x90,
-0x69,0xcb,0xb2,0x09,0x77,0x28,0x77,0x26,0xa5,0x72,0x87,0x72,0x00,0x07,0x28,0x7a,
-0x10,0x73,0x28,0xf0,0x02,0x91,0x00,0x00,0x0b,0x09,0x10,0x00,0x06,0xca,0xda,0xaa,
-0x30,0xc0,0x09,0x10,0x00,0x02,0xde,0x00,0x11,0x2a,0xa9,0x3e,0x03,0x2a,0x09,0x80,
-0x2a,0xaa,0xda,0xaa,0x70,0x09,0xaa,0xca,0xc4,0x32,0x11,0x0a,0xa8,0x2a,0x00,0x67,
-0x1e,0x41,0xaa,0xea,0xad,0x09,0x1c,0x1c,0x52,0xa0,0x0a,0x72,0x00,0xa2,0x5a,0x17,
-0x03,0x74,0x3f,0xf1,0x05,0xca,0xae,0xaa,0xb0,0xb1,0x1b,0x11,0xa0,0xc8,0x8d,0x88,
-0xb0,0xc9,0x9e,0x99,0xb0,0xb0,0x0b,0x00,0x14,0xfb,0x3c,0xd0,0x09,0xaa,0xc3,0x0a,
-0x88,0xd8,0x8a,0x00,0xa8,0x8d,0x88,0xa0,0x0a,0x98,0x1e,0xf1,0x04,0x6a,0xd9,0xea,
+0x60,0xad,0x04,0xf3,0x0f,0x01,0x0a,0x00,0x10,0x05,0x60,0xa0,0x0c,0x00,0xb1,0x1c,
+0x05,0x60,0x04,0x05,0xd1,0x40,0x00,0x00,0xc1,0x90,0x00,0x00,0xa5,0x05,0x90,0x03,
+0xb4,0x00,0x04,0xd6,0x04,0x00,0x3a,0x03,0xf1,0x14,0x0a,0x09,0xab,0xa7,0x04,0xa6,
+0x00,0x81,0x01,0x5a,0x80,0x08,0x10,0x33,0xa1,0x00,0x81,0x00,0x2a,0x00,0x08,0x10,
+0x05,0xc5,0x00,0x81,0x00,0xb1,0x80,0x08,0x10,0x46,0x00,0x2b,0xc0,0x2c,0x00,0xa0,
+0x05,0x99,0x99,0x9a,0x00,0x17,0x77,0x77,0xa0,0x06,0x09,0x00,0xf2,0x07,0x01,0x09,
+0x00,0x10,0x07,0x40,0xd0,0x38,0x00,0x50,0x69,0x74,0x00,0x03,0x99,0x03,0xa5,0x13,
+0x72,0x00,0x00,0x44,0x52,0x00,0x31,0x0e,0x99,0x91,0x09,0x00,0xf0,0x24,0x8a,0xac,
+0xaa,0x70,0x0a,0x00,0x00,0x18,0x00,0xaa,0xaa,0xaa,0x80,0x04,0x02,0x02,0x04,0x02,
+0xa0,0xa0,0xb0,0x91,0x51,0x05,0x04,0x01,0x20,0x00,0x43,0x25,0x00,0x00,0x0d,0x88,
+0xd8,0x83,0x0a,0xa2,0x2b,0x22,0x03,0x7c,0x88,0xd8,0x70,0x00,0xd8,0x8d,0x88,0x00,
+0x09,0x37,0x00,0xe0,0xc8,0x88,0x89,0x30,0x82,0x80,0x80,0xa1,0x18,0x06,0x15,0x32,
+0x70,0x00,0x29,0x05,0xf1,0x19,0x0c,0x10,0x0a,0x70,0x05,0xba,0x80,0xa7,0x20,0xb5,
+0x78,0xad,0xa5,0x67,0x2b,0x04,0xd0,0x00,0x1d,0x30,0xa8,0x40,0x1b,0x50,0x86,0x0b,
+0x31,0x30,0x23,0x10,0x32,0x1a,0x0a,0x0a,0x0a,0x14,0x20,0x50,0x40,0x24,0xa8,0x00,
+0xf2,0x19,0x18,0x00,0x74,0x00,0x01,0x80,0xb9,0x9d,0x00,0x68,0x9b,0x77,0xd0,0x27,
+0xb5,0xa4,0x4b,0x04,0x48,0x0a,0x33,0xb0,0x04,0x70,0x6a,0x77,0x00,0x7d,0x43,0x66,
+0x30,0x0b,0x1a,0x82,0x08,0x45,0x50,0x54,0x99,0x55,0x02,0x01,0xf3,0x18,0x04,0x30,
+0x00,0x00,0x9c,0xb3,0xaa,0xa3,0x09,0x88,0x27,0x74,0x40,0x98,0x82,0xcb,0xa4,0x09,
+0x87,0x38,0x01,0x00,0x98,0x56,0x80,0x17,0x18,0x81,0x97,0x98,0x15,0x48,0x08,0x70,
+0x00,0x80,0x80,0x05,0xbb,0x58,0x01,0x43,0x19,0x00,0x09,0x10,0x04,0x00,0xf0,0x08,
+0xba,0xaa,0xa9,0x09,0x10,0x00,0x00,0x0b,0xaa,0xab,0x90,0x0a,0x00,0x00,0x90,0x38,
+0x00,0x00,0x90,0x81,0x00,0x00,0x90,0x26,0x00,0xf1,0x1a,0x09,0x45,0x49,0xab,0x30,
+0x94,0x59,0x30,0x00,0x0a,0x56,0x90,0x00,0x00,0xc8,0x89,0xc9,0xb4,0x0a,0x00,0x99,
+0x18,0x20,0xd9,0x9a,0x46,0xc0,0x18,0x09,0xa0,0xc6,0x05,0x60,0xa9,0x3c,0x90,0x71,
+0x0c,0x7a,0x05,0x70,0x2d,0x00,0xf1,0x13,0xaa,0xac,0xca,0x00,0x27,0x00,0x46,0x00,
+0x06,0x30,0x04,0x60,0x00,0x7a,0xab,0xfc,0xa4,0x00,0x02,0xb6,0x60,0x00,0x04,0xb1,
+0x46,0x00,0x2a,0x80,0x04,0x60,0x02,0x20,0x07,0xb3,0x91,0x06,0xf0,0x0b,0x01,0x7a,
+0x07,0x9d,0x94,0x2c,0xe6,0x00,0xa0,0x06,0x3a,0x2a,0xac,0xc8,0x30,0xa1,0x00,0x0a,
+0x02,0x9e,0x6a,0x99,0xd8,0x22,0xa0,0x55,0x2b,0x05,0x10,0x70,0x22,0x00,0xf0,0x1d,
+0xa9,0x00,0x00,0xa0,0x0a,0x13,0x03,0x1a,0x00,0xa0,0xa0,0x1a,0xa0,0x0a,0x03,0x00,
+0x4a,0x8a,0xea,0xa5,0x00,0xb0,0x0e,0x40,0x00,0x9c,0x02,0xa9,0x00,0x64,0xa0,0x83,
+0x91,0x00,0x0a,0x2b,0x02,0xa0,0x00,0xaa,0x10,0x04,0x70,0x00,0x84,0x05,0xf0,0x0e,
+0x99,0x9d,0xa9,0x96,0x07,0x14,0x67,0x17,0x00,0x26,0x8d,0x64,0x40,0x02,0x85,0x89,
+0x76,0x00,0x81,0xaa,0x66,0x64,0x29,0x99,0xda,0x99,0x70,0x00,0x09,0x78,0x01,0xf2,
+0x12,0x91,0x00,0x00,0x5c,0xa5,0xab,0xca,0x40,0x81,0x00,0xa1,0x00,0x4c,0x80,0x2f,
+0x90,0x00,0x82,0x1a,0xb2,0xa0,0x08,0x18,0x2a,0x07,0x20,0x9a,0x00,0xa0,0x00,0x68,
+0x10,0x0a,0x44,0x02,0xf1,0x15,0x2a,0xc7,0xc9,0x9c,0x10,0x09,0x0b,0x07,0x71,0x19,
+0xd4,0xb0,0x97,0x10,0x19,0x0b,0x19,0x71,0x00,0x90,0x83,0x75,0x10,0x0b,0x50,0x7a,
+0x01,0x3c,0xa4,0x38,0x90,0x80,0x00,0x5a,0x07,0x87,0xef,0x04,0x00,0x20,0x01,0xf0,
+0x29,0x07,0xc9,0x09,0x7c,0x91,0x09,0x05,0x90,0xa0,0x00,0x90,0x89,0x0a,0x00,0x6d,
+0x88,0x95,0xd9,0x00,0x90,0x39,0x0a,0x00,0x09,0x10,0x90,0xa0,0x07,0xb8,0x84,0x0a,
+0x00,0x00,0x27,0x19,0x99,0x30,0x6b,0x98,0xad,0x9d,0x00,0x90,0x79,0xd8,0xd0,0x4c,
+0x67,0x19,0x0a,0x02,0xb4,0x79,0xd9,0xc0,0x09,0x5c,0x03,0xf2,0x26,0xa9,0x69,0xda,
+0x91,0x98,0x20,0x0a,0x00,0x00,0x02,0x99,0x99,0x94,0x00,0x00,0x05,0x20,0x05,0xb9,
+0x54,0x52,0x90,0x09,0x05,0xab,0xac,0x02,0xb4,0x45,0x55,0x52,0x2b,0x42,0x3a,0x43,
+0x10,0x90,0x69,0xcb,0xb2,0x09,0x77,0x28,0x77,0x26,0xa5,0x72,0x87,0x72,0x00,0x07,
+0x28,0x7a,0x6a,0x07,0xf0,0x03,0x80,0x91,0x00,0x00,0x0b,0x09,0x10,0x00,0x06,0xca,
+0xda,0xaa,0x30,0xc0,0x09,0x10,0x00,0x02,0xde,0x00,0x41,0x2a,0xad,0xaa,0x90,0xe7,
+0x00,0x00,0xf0,0x00,0xf0,0x02,0x2a,0xaa,0xda,0xaa,0x70,0x09,0xaa,0xca,0xab,0x0a,
+0x00,0xa0,0x0a,0x0a,0xa9,0xd9,0x9c,0x08,0x00,0xf1,0x01,0x0b,0xaa,0xea,0xad,0x09,
+0x00,0xa0,0x0a,0x18,0x00,0xa0,0x0a,0x72,0x00,0xa2,0x9b,0x4d,0x00,0x12,0x0b,0x04,
+0x00,0xf0,0x16,0xca,0xae,0xaa,0xb0,0xb1,0x1b,0x11,0xa0,0xc8,0x8d,0x88,0xb0,0xc9,
+0x9e,0x99,0xb0,0xb0,0x0b,0x00,0x14,0x00,0x0b,0x00,0x28,0x00,0x09,0xaa,0xc3,0x0a,
+0x88,0xd8,0x8a,0x00,0xa8,0x8d,0x88,0xa0,0x45,0x00,0xf4,0x07,0x00,0x6a,0xd9,0xea,
 0x60,0x03,0xb2,0x03,0xc4,0x05,0x75,0x50,0x56,0x65,0x00,0xa2,0x05,0x60,0x00,0x96,
-0x28,0x2f,0x03,0xb1,0x27,0xf1,0x15,0x06,0xaa,0x63,0xd9,0x90,0x73,0x48,0xc6,0x1a,
-0x07,0x34,0xa2,0xab,0x20,0x7a,0xa9,0x79,0x97,0x17,0x34,0xaa,0x99,0xb2,0x7a,0xa8,
-0x90,0x09,0x06,0x00,0x0a,0x99,0xc0,0x00,0x00,0x90,0x09,0x9e,0x12,0x20,0x05,0x70,
-0x4c,0x03,0x00,0x56,0x0d,0x51,0xa9,0x99,0x99,0xaa,0x00,0x72,0x08,0x12,0xaa,0x78,
-0x2a,0xf2,0x15,0xa0,0x04,0x00,0x31,0x00,0x09,0x00,0xb1,0x00,0xd9,0xd2,0xc9,0x9a,
-0x90,0x9a,0x10,0x0a,0xd9,0xd0,0x82,0x09,0x90,0x90,0x0b,0x19,0x90,0x90,0x01,0x27,
-0xd9,0xb0,0x00,0x46,0x90,0x00,0x29,0x2f,0x24,0x00,0x7f,0x22,0xf3,0x15,0x0a,0x10,
-0x64,0x00,0x69,0xaa,0x9b,0x99,0x10,0x07,0x10,0x75,0x00,0x3a,0x20,0x00,0x4a,0x00,
-0x99,0xda,0xcb,0x30,0x09,0x09,0x27,0x63,0x00,0x90,0x92,0x76,0x30,0x7d,0x9d,0xac,
-0xcb,0x30,0xd9,0x32,0xf1,0x40,0xa0,0x00,0x18,0x54,0x1b,0x00,0x01,0x85,0x47,0xa8,
-0x82,0x18,0x56,0xb2,0x50,0x01,0x51,0x22,0x00,0x10,0x08,0x9a,0x9a,0x94,0x00,0xa0,
-0x91,0x83,0x60,0x0a,0x09,0x18,0x36,0x07,0xd9,0xda,0xdb,0xc3,0x00,0x40,0x01,0x30,
-0x01,0x4b,0x64,0xa7,0x30,0x03,0x34,0xb3,0x32,0x00,0x68,0x8d,0x88,0x30,0x47,0x78,
-0xa7,0x77,0x10,0x79,0x99,0x99,0x30,0x09,0x09,0x18,0x36,0x00,0x90,0x91,0x83,0x60,
-0x7d,0x9d,0xac,0xbc,0x30,0x60,0x27,0xf0,0x06,0x3a,0xa9,0x8b,0x10,0x04,0x53,0x80,
-0x91,0x06,0xcb,0xa9,0x9d,0xa3,0x1b,0x03,0x72,0xa0,0x02,0x88,0x88,0xab,0x7f,0x00,
-0xc1,0x45,0x00,0x90,0x92,0x74,0x50,0x7d,0x9d,0xac,0xbb,0x30,0xaa,0x95,0x2e,0x1f,
-0x19,0x07,0x00,0x02,0x02,0xbf,0x02,0xb2,0x9e,0x99,0x95,0x00,0x66,0xc6,0x63,0x00,
-0x0a,0x33,0x34,0xb4,0x0f,0x04,0xc6,0x0f,0x00,0x24,0x07,0x21,0x90,0x39,0x78,0x40,
-0x11,0xa0,0x5a,0x3b,0xf0,0x0a,0xa9,0xa8,0x49,0xd8,0xa0,0x01,0x80,0x4a,0x0a,0xa9,
-0xa8,0x08,0xe4,0xa0,0x01,0x82,0x8a,0x7a,0x99,0xa8,0x61,0xa0,0xa0,0x01,0x80,0x1b,
-0x00,0x30,0x00,0xa0,0xa0,0x87,0x19,0xf2,0x17,0x01,0x34,0x00,0x58,0x9c,0x65,0x30,
-0x04,0x8c,0xa8,0x88,0x11,0x89,0xd9,0x88,0x85,0x00,0x9b,0x88,0x87,0x00,0x9c,0x97,
-0x77,0xb0,0x24,0x67,0x44,0x4b,0x00,0x06,0x63,0x33,0xa0,0x00,0x6a,0x88,0x8b,0x28,
-0x39,0xf1,0x02,0x99,0x9d,0x99,0x94,0x00,0x87,0xb7,0x74,0x00,0x0c,0x66,0x68,0x60,
-0x00,0xc6,0x66,0x96,0x09,0x00,0xc0,0x28,0xd8,0x88,0xab,0x60,0x06,0x60,0x29,0x40,
-0x08,0x30,0x00,0xd6,0x14,0xf1,0x17,0x01,0x23,0x08,0x99,0xa8,0xb4,0x60,0x80,0x84,
-0x48,0x44,0x08,0x99,0xc8,0x88,0xb3,0x80,0x89,0x74,0x79,0x18,0x8a,0xa8,0xb7,0x70,
-0x89,0xa4,0xd7,0x9a,0x08,0x00,0x95,0x03,0x40,0x00,0x35,0x00,0x34,0x56,0x2e,0xf2,
-0x14,0x00,0xa9,0x85,0xc9,0xa8,0x19,0x83,0x0a,0x01,0x92,0x27,0x20,0xa0,0x19,0x3a,
-0xda,0x8a,0x01,0x90,0x0b,0x30,0xa0,0x19,0x00,0xaa,0x2a,0x01,0x90,0x84,0x18,0xc9,
-0xa9,0x39,0x00,0x0a,0x2b,0x1a,0xf4,0x14,0x2b,0xc7,0x79,0x9a,0x00,0x63,0x05,0x20,
-0x90,0x0a,0x42,0x81,0x27,0x03,0xe5,0x89,0x9a,0xb3,0x3a,0x08,0x00,0x04,0x50,0x90,
-0x99,0x99,0x73,0x0a,0x95,0x00,0x08,0x10,0x30,0x00,0x09,0x65,0x0d,0xf0,0x18,0x11,
-0x11,0x07,0xda,0x78,0xd8,0x81,0x0a,0x04,0x8d,0x89,0x01,0xa4,0x66,0xb3,0xb0,0x9a,
-0x89,0x6b,0x4b,0x06,0x75,0x79,0xd8,0xa0,0x17,0x55,0x89,0x00,0x01,0xc9,0x3b,0xa2,
-0x00,0x02,0x07,0x21,0x7a,0x10,0x59,0x02,0xf2,0x14,0x02,0xbc,0x75,0xb9,0x80,0x06,
-0x31,0xc4,0xa6,0x20,0xa4,0x7c,0x5b,0x5a,0x2e,0x57,0xb8,0xd8,0xa3,0xa1,0x7a,0x0a,
-0x0a,0x09,0x17,0xc8,0xd8,0xa0,0xa9,0x98,0x09,0x0a,0x02,0x08,0x10,0x16,0x26,0x10,
-0x04,0x0e,0x30,0x02,0x31,0x43,0x00,0xca,0x12,0x00,0x26,0x04,0xf1,0x02,0xb0,0x91,
-0x65,0x00,0x75,0x09,0x10,0xb0,0x2a,0x00,0x91,0x06,0x60,0x01,0xac,0x00,0x00,0xed,
-0x38,0xf3,0x02,0x8d,0x95,0x8d,0x94,0x05,0xd8,0x27,0xc8,0x01,0x46,0x04,0x17,0x05,
-0x01,0xcc,0xcc,0xc8,0xa0,0x2e,0xc0,0xd9,0x99,0x50,0x2a,0x09,0x16,0x60,0x09,0x07,
-0xb0,0x06,0x30,0xc6,0x01,0xf0,0x1c,0x01,0x99,0x9c,0x99,0x95,0x02,0x55,0x67,0x18,
-0x00,0x37,0x76,0x73,0xa0,0x02,0x98,0xc9,0x87,0x00,0x89,0x9d,0x99,0x92,0x0a,0x09,
-0x15,0x26,0x30,0xa3,0xd9,0x98,0x63,0x0a,0x00,0x00,0x5a,0x10,0x03,0x78,0x00,0xa0,
-0x03,0x7b,0x85,0x44,0xf0,0x10,0xa0,0x82,0xa6,0x34,0xbe,0x9b,0x0a,0x09,0x07,0xd6,
-0x60,0xa1,0x42,0x8a,0x10,0x05,0xa2,0x51,0xa0,0x00,0x68,0x00,0x0a,0x02,0xa9,0x00,
-0x00,0xa6,0xb4,0x00,0x00,0x98,0x31,0xf1,0x3e,0x05,0x9c,0x39,0xaa,0xc0,0x00,0x90,
-0x90,0x0a,0x05,0xae,0x9a,0x00,0xa0,0x07,0xe4,0xaa,0xae,0x01,0x9a,0x80,0x00,0x00,
-0x72,0x90,0x36,0x27,0x00,0x09,0x0a,0x10,0xa0,0x00,0x91,0x80,0x05,0x30,0x00,0x24,
-0x04,0x00,0x00,0x9c,0x34,0xa5,0x54,0x00,0x90,0x95,0xc6,0x72,0xae,0x99,0x0a,0x21,
-0x04,0xe3,0x45,0xa9,0x00,0x8a,0x78,0x1a,0x45,0x45,0x90,0xa0,0xa0,0x90,0x09,0x02,
-0x0a,0x03,0x00,0x90,0x08,0x80,0x1c,0x3f,0xf2,0x13,0x05,0xc7,0x07,0xd9,0x70,0x06,
-0x36,0x83,0xa3,0x07,0xdb,0x46,0xb6,0x00,0x0d,0xb4,0x2a,0xc9,0x25,0xa6,0x39,0x30,
-0xb0,0x96,0x33,0x2a,0x95,0x00,0x63,0x01,0xa6,0x00,0x06,0x39,0x4b,0x0d,0x02,0x28,
-0x09,0xf1,0x0c,0x9c,0x3c,0x99,0xb5,0x00,0x90,0xa0,0x05,0x52,0x9d,0x66,0x77,0x72,
-0x06,0xe2,0x99,0xb9,0x60,0x9a,0x70,0x0a,0x00,0x55,0x90,0x79,0xd9,0x40,0x50,0x0b,
-0xf1,0x1d,0x94,0x99,0xd9,0x80,0x00,0x50,0x40,0x00,0x04,0xc7,0x3b,0x8b,0x00,0x06,
-0x3b,0x99,0xb3,0x06,0xdb,0x23,0x35,0x70,0x0c,0x90,0x44,0x67,0x02,0xc9,0x48,0x88,
-0x40,0x97,0x31,0x29,0x02,0x02,0x63,0xa9,0x34,0x90,0x06,0x54,0x98,0xa4,0x2c,0x2d,
-0x01,0xa8,0x05,0xf5,0x03,0x09,0x03,0x02,0x10,0xa0,0x48,0x70,0x3b,0x72,0x08,0x30,
-0x00,0x06,0x50,0x19,0x9e,0x99,0x70,0xf5,0x1f,0x00,0xa8,0x0f,0x10,0x60,0x3c,0x15,
-0x00,0x29,0x00,0xf2,0x11,0x94,0x09,0x07,0x04,0x33,0x70,0x5a,0x22,0x07,0x90,0x01,
-0x00,0xa2,0x91,0x02,0x99,0x9f,0xba,0x96,0x00,0x06,0x6a,0x10,0x00,0x28,0x80,0x2b,
-0x61,0x08,0x20,0x00,0x04,0x29,0x00,0xf3,0x14,0xa8,0x8b,0x88,0x95,0x07,0x88,0x03,
-0x95,0x40,0x87,0x6a,0x33,0xa2,0x04,0x88,0x64,0x4b,0x00,0x47,0xb7,0xa4,0xb0,0x04,
-0x62,0xbb,0x0b,0x00,0x47,0x82,0x24,0xb0,0x04,0xa7,0x77,0x7b,0xa8,0x1d,0x80,0x9b,
-0x99,0x92,0x00,0x55,0x00,0xb0,0x02,0xf5,0x33,0x91,0x00,0xc7,0x77,0x88,0x00,0x0d,
-0x88,0x89,0x80,0x10,0x0e,0x91,0x04,0x90,0xa0,0x09,0x2a,0x80,0x07,0x9a,0x60,0xc9,
-0x30,0x00,0xd0,0x10,0xf2,0x14,0x72,0x64,0x62,0xa0,0x69,0x99,0xbc,0xad,0x05,0x18,
-0x45,0x55,0x51,0x44,0x83,0x4b,0x54,0x12,0x68,0x79,0xdb,0xb1,0x04,0xaa,0x28,0x77,
-0x18,0xa7,0x92,0x87,0x71,0x00,0x08,0x27,0x6b,0x35,0x44,0x00,0xdf,0x3d,0xf0,0x04,
-0x9b,0x86,0xcb,0x84,0x46,0x34,0x71,0x52,0x00,0x78,0x8d,0x88,0xb0,0x05,0x98,0xd8,
-0x8b,0x00,0x90,0x37,0x21,0xc2,0x9d,0xe9,0x9d,0x00,0x18,0x6a,0x01,0xb0,0x1b,0x30,
-0xa1,0x84,0xa2,0x09,0x00,0x2d,0x00,0xf0,0x0d,0xac,0x98,0xdb,0x96,0x36,0x51,0xa1,
-0x71,0x00,0x49,0x9d,0x99,0x80,0x27,0x77,0xc7,0x77,0x50,0x22,0x22,0x2b,0x22,0x09,
-0xc9,0x99,0xd9,0x50,0x04,0xfb,0x23,0x32,0x03,0x29,0xa0,0x56,0x00,0xf2,0x3d,0x8b,
-0x99,0xca,0x85,0x28,0x45,0xb2,0x64,0x00,0x02,0xa5,0x86,0x00,0x2a,0x9a,0x88,0x9a,
-0x70,0x12,0x05,0x01,0x40,0x00,0xa0,0x91,0x73,0x00,0x06,0x23,0x3b,0x00,0x19,0x99,
-0x9b,0xc9,0x50,0x05,0x00,0x13,0x00,0x04,0xcc,0x8b,0xab,0x81,0x65,0xb8,0xb7,0xc2,
-0x00,0x97,0x66,0x6a,0x50,0x09,0x76,0x66,0xa5,0x00,0x68,0x76,0x89,0x30,0x68,0xba,
-0x8c,0xa8,0x20,0x2b,0x00,0x73,0x00,0x4b,0x10,0x07,0x30,0x20,0x08,0x00,0x21,0x0a,
-0xf0,0x06,0xba,0x87,0xba,0x72,0x34,0x42,0x90,0x60,0x00,0xd8,0x88,0x88,0xc1,0x05,
-0xc8,0x88,0xc4,0x00,0x0c,0x88,0x8b,0xa9,0x08,0xf0,0x13,0x83,0x00,0x09,0x00,0x02,
-0x70,0x00,0xd8,0x88,0x97,0x00,0x00,0x70,0xa0,0x34,0x00,0x09,0x3a,0x0a,0x00,0x19,
-0xaa,0xeb,0x99,0x50,0x27,0x9b,0x6a,0x60,0x1a,0x40,0x70,0x06,0x40,0xa1,0x01,0xf1,
-0x25,0x19,0x9b,0xed,0x99,0x50,0x03,0xc2,0x77,0x10,0x1a,0x81,0x00,0x49,0x70,0x10,
-0x91,0x09,0x10,0x06,0x29,0x90,0x91,0x00,0x27,0xa9,0x09,0xa9,0x33,0x6c,0x60,0x91,
-0x00,0x38,0xb5,0x09,0x10,0x00,0xad,0x5c,0x99,0xd0,0x74,0x94,0x80,0x09,0x01,0x09,
-0x0c,0x99,0xd0,0x00,0x90,0x36,0x16,0x03,0x55,0x02,0xf4,0x19,0x82,0x11,0xa1,0x10,
-0x88,0x85,0x8d,0x88,0x15,0xa9,0x07,0xd7,0x70,0x7c,0x95,0x8b,0x88,0x31,0xd5,0x08,
-0x88,0x70,0x3e,0xa1,0xc6,0x6b,0x0a,0x92,0x0c,0x77,0xb0,0x28,0x10,0x90,0x0a,0x00,
-0x81,0x09,0x07,0x90,0x32,0x1f,0xf1,0x17,0x52,0x00,0x89,0xcb,0x75,0x10,0x00,0x57,
-0x05,0x60,0x00,0x5c,0x9d,0x81,0x00,0x00,0x3c,0x40,0xa2,0x00,0xaf,0xaa,0x89,0xb0,
-0x01,0x60,0xa0,0x62,0x10,0x75,0x0a,0x05,0x90,0x14,0x09,0xb0,0x04,0x10,0x07,0x32,
-0xf1,0x39,0x97,0x2b,0xba,0xa0,0x09,0x72,0x3c,0xc2,0x00,0x13,0xb7,0x41,0x62,0x02,
-0xea,0x9a,0x10,0x00,0x18,0xc4,0x0a,0x40,0x0b,0xb8,0xd8,0x7a,0x10,0x19,0x0a,0x1a,
-0x20,0x19,0x08,0xa0,0x09,0x00,0x0a,0x88,0xd8,0x8b,0x00,0xa7,0x7c,0x77,0xa0,0x09,
-0x8a,0xb8,0x89,0x00,0x2b,0x95,0x91,0x00,0x03,0x9b,0x50,0xa2,0x00,0xaa,0x9d,0x87,
-0x90,0x03,0x80,0xa2,0x92,0x02,0x70,0x8a,0x01,0x90,0x3d,0x3e,0xf3,0x10,0x19,0x0a,
-0xaa,0xa6,0x09,0x16,0x00,0xa0,0x04,0xdb,0x50,0x0a,0x00,0x03,0x80,0x00,0xa0,0x02,
-0xe9,0x70,0x0a,0x00,0x01,0x01,0x00,0xa0,0x03,0xaa,0x7a,0xae,0xa8,0xcf,0x01,0x00,
-0xcc,0x11,0xf2,0x14,0x6d,0xad,0x20,0x27,0x41,0xa0,0xa0,0x0b,0xa9,0x0c,0x1d,0x90,
-0x09,0x20,0xe7,0x0a,0x08,0xc8,0x29,0xb6,0x60,0x11,0x68,0x54,0xd0,0x08,0x93,0xb4,
-0xb7,0xa0,0x00,0x04,0x60,0x03,0x20,0x62,0x28,0x03,0x5f,0x42,0xf3,0x0b,0x04,0x89,
-0x2a,0x0a,0x00,0x59,0x70,0xa0,0xd0,0x01,0xb4,0x1f,0x1e,0x30,0x58,0x55,0x8b,0x97,
-0x01,0x59,0xb2,0x92,0xb0,0x44,0x2a,0x19,0x3e,0x1a,0xf0,0x1a,0x80,0x0a,0x54,0x00,
-0x64,0x00,0xa0,0x70,0x09,0x26,0xae,0xa7,0x16,0xcc,0x10,0x91,0x42,0x05,0x51,0xad,
-0xa6,0x12,0xda,0x50,0x55,0x83,0x24,0x00,0x01,0xd5,0x02,0x8a,0x53,0xbc,0x04,0x23,
-0x04,0x81,0x3b,0x50,0x02,0x5d,0x17,0xf1,0x15,0x90,0x69,0xb7,0x71,0x17,0x42,0x93,
-0x22,0x09,0xa9,0x6d,0xc3,0x00,0x29,0x13,0x76,0x40,0x04,0xb8,0x48,0xba,0x80,0x54,
-0x11,0x76,0x47,0x03,0x98,0xa1,0x63,0x81,0x30,0x04,0x4b,0x11,0x20,0xf2,0x0b,0xf1,
-0x15,0x09,0x07,0xa9,0xd0,0x07,0x24,0x72,0x09,0x03,0xda,0x57,0xa9,0xd0,0x02,0x70,
-0x72,0x09,0x01,0xd9,0x77,0xa9,0xd0,0x01,0x00,0x72,0x09,0x01,0x69,0x87,0x20,0x90,
-0x26,0x13,0xca,0x9d,0x80,0xfa,0x00,0xf2,0x10,0x29,0x0e,0xae,0xaa,0x09,0x13,0x90,
-0x90,0xa6,0xca,0x59,0x09,0x0a,0x03,0x70,0xda,0xda,0xa3,0xe9,0x79,0x09,0x0a,0x12,
-0x00,0x90,0x90,0xa4,0x99,0x7d,0x9d,0x9a,0x13,0x05,0x00,0x09,0x40,0xf0,0x0f,0x64,
-0x05,0xd9,0x80,0x09,0x26,0xc7,0x37,0x08,0xbb,0x40,0x9b,0x00,0x16,0x31,0x98,0x6a,
-0x25,0xd9,0x63,0x75,0x14,0x21,0x00,0x10,0x51,0x05,0xa9,0x55,0x98,0xab,0x08,0x12,
-0x27,0xd6,0x29,0xf2,0x14,0x82,0x49,0x9c,0x70,0x18,0x32,0x03,0xa0,0x0b,0xab,0x28,
-0xaa,0x50,0x18,0x27,0x20,0x06,0x36,0xda,0x59,0xda,0x90,0x42,0x00,0x08,0x10,0x02,
-0x69,0x10,0x81,0x00,0x75,0x08,0x9d,0xa9,0xfa,0x00,0x20,0x62,0x09,0x44,0x15,0xf5,
-0x10,0x90,0xbb,0x62,0x73,0x6d,0x79,0x81,0x7a,0x95,0xd5,0x99,0x00,0x91,0x09,0x09,
-0x81,0x4d,0x96,0xc6,0x91,0x72,0x11,0x4b,0x39,0x18,0x4a,0x85,0x50,0xa8,0x11,0x00,
-0x4e,0x02,0x00,0xf9,0x14,0xf1,0x15,0x55,0x08,0x9d,0x86,0x0a,0x17,0x11,0xb1,0x15,
-0xdc,0x35,0x6c,0x63,0x04,0x70,0x34,0x44,0x23,0xe9,0x77,0x99,0xa3,0x01,0x02,0xa0,
-0x05,0x44,0xa9,0x5a,0x88,0xb4,0x00,0x00,0xa1,0x16,0x40,0x59,0x41,0xf0,0x08,0x45,
-0x06,0xc9,0x60,0x09,0x16,0xa0,0x73,0x07,0xbb,0x6d,0x9d,0xb5,0x15,0x40,0x90,0x84,
-0x53,0xda,0x5d,0x9b,0xa4,0x22,0x3b,0x14,0x60,0x6a,0x79,0x00,0x08,0x33,0x00,0x78,
-0x04,0x31,0x20,0x01,0x10,0xf4,0x08,0xf2,0x11,0x07,0x34,0x9d,0xa9,0x62,0xb7,0x62,
-0xa0,0x90,0x37,0xb1,0xda,0xac,0x50,0xa5,0x46,0x65,0x14,0x3a,0x61,0x45,0x72,0x00,
-0x48,0x59,0x27,0x26,0x26,0x18,0x70,0x6a,0x80,0xb6,0x42,0xf1,0x18,0x1a,0x10,0x00,
-0x90,0x28,0xd8,0x60,0x17,0x75,0x8d,0x88,0x19,0x98,0x01,0x11,0xa0,0x39,0x12,0x79,
-0x35,0x04,0xc8,0x27,0x73,0x00,0x52,0x16,0x8d,0x88,0x15,0x97,0x08,0x58,0x40,0x10,
-0x09,0x50,0x07,0x10,0x4d,0x26,0xf0,0xab,0x38,0x09,0x99,0xc2,0x09,0x23,0x67,0x7c,
-0x14,0xbb,0x29,0x99,0xd8,0x05,0x50,0x32,0x71,0x41,0xda,0x38,0x4a,0xa1,0x13,0x00,
-0x2b,0xd5,0x01,0x8a,0x6a,0x38,0x87,0x12,0x00,0x09,0x50,0x10,0x00,0x20,0x01,0x35,
-0x00,0x73,0x69,0xa5,0x80,0x09,0x23,0x77,0x28,0x09,0xaa,0x5c,0x98,0x83,0x18,0x37,
-0xc8,0x88,0x35,0xd9,0x2d,0x88,0x80,0x20,0x24,0xb8,0x66,0x06,0xa8,0xd2,0xbd,0x40,
-0x00,0x33,0x82,0x06,0x50,0x01,0x30,0x04,0x10,0x00,0x73,0x28,0xbb,0x80,0x08,0x45,
-0x50,0x09,0x07,0xba,0x4a,0x88,0x80,0x17,0x25,0xb9,0x99,0x14,0xd9,0x6b,0x76,0x61,
-0x11,0x29,0xac,0xbb,0x14,0xb7,0xa8,0x76,0x61,0x31,0x05,0x82,0x28,0x00,0x00,0x30,
-0x04,0x00,0x00,0x54,0x68,0xba,0x93,0x08,0x38,0x41,0x14,0x36,0xb9,0x18,0x7c,0x71,
-0x17,0x29,0x59,0xb9,0x04,0xd7,0x95,0x91,0x90,0x11,0x55,0x5b,0x6b,0x05,0x93,0x35,
-0xc7,0xc0,0x00,0x03,0x59,0x08,0x00,0x0a,0x7c,0x7c,0x8b,0x30,0x76,0x9a,0x87,0x82,
-0x18,0x88,0xd8,0x88,0x40,0x0a,0x78,0x78,0x60,0x00,0xb6,0x66,0x87,0x00,0x0b,0x66,
-0x68,0x70,0x09,0x00,0xf0,0x04,0x01,0x8c,0x77,0x79,0xb5,0x00,0x40,0x00,0x50,0x00,
-0x37,0x94,0x5c,0x41,0x04,0x55,0xb5,0x55,0x10,0xbd,0x04,0x00,0x2d,0x00,0xf0,0x4c,
-0x60,0x88,0x8d,0x88,0x85,0x00,0x06,0x9a,0x20,0x01,0x59,0x80,0x2a,0x83,0x15,0x10,
-0x00,0x02,0x30,0x01,0x35,0x00,0x00,0x58,0xb6,0x6c,0x6c,0x6b,0xcc,0x68,0x58,0x08,
-0xd5,0x6a,0x5b,0x83,0x85,0x19,0x09,0x79,0xbb,0x4d,0x5d,0x67,0xbb,0x48,0x38,0x68,
-0xcc,0x08,0x08,0x61,0x07,0x3a,0x3a,0x2c,0x8c,0x4c,0x8a,0x40,0x78,0xb2,0x88,0xa4,
-0x17,0x79,0xb8,0x79,0x10,0x87,0x6c,0x66,0xa0,0x04,0x99,0x79,0x95,0x01,0x79,0xa7,
-0xaa,0x72,0x27,0xcb,0x7b,0xd8,0x51,0x83,0x00,0x02,0x73,0x54,0x1a,0xf0,0x15,0x10,
-0x49,0xac,0x98,0x90,0x00,0x02,0x72,0xa0,0x02,0x99,0xac,0xdb,0x96,0x00,0x3a,0x92,
-0x11,0x02,0xbd,0x97,0x77,0x90,0x01,0x6a,0x88,0x99,0x00,0x06,0x40,0x01,0x90,0x00,
-0x6b,0x99,0x99,0x0a,0x02,0xf0,0x17,0x5a,0x03,0x9d,0x74,0xb8,0x10,0x01,0xa1,0x4a,
-0x00,0x01,0x7c,0x56,0xda,0x92,0x59,0xd9,0x19,0x00,0x00,0x7e,0x26,0xdb,0xb5,0x19,
-0xaa,0x4a,0x00,0x07,0x19,0x00,0x90,0x08,0x00,0x90,0x06,0x99,0x60,0x66,0x06,0xf0,
-0x16,0x01,0x6c,0x68,0x8c,0x97,0x01,0xa1,0x88,0xc8,0x70,0x8d,0x68,0x6b,0x77,0x26,
-0xc6,0x13,0xa3,0x10,0x6f,0x4a,0x8c,0x9b,0x09,0xb9,0x80,0x98,0x84,0x5a,0x09,0x97,
-0x7a,0x00,0xa0,0x80,0x04,0x90,0xaa,0x04,0xf0,0x13,0x04,0xda,0xc2,0x90,0xb0,0x09,
-0x18,0x6b,0xab,0x30,0xc8,0x82,0x2b,0x21,0x0c,0x98,0x89,0xd8,0x70,0x90,0x80,0x4d,
-0x00,0x1b,0x8d,0x29,0xa3,0x03,0x63,0x83,0xa0,0xc2,0x00,0x0a,0x10,0x2e,0x02,0xee,
-0x44,0xf0,0x06,0x02,0x02,0x88,0xc0,0xb8,0x91,0x26,0x6b,0x0a,0x33,0x60,0x00,0x30,
-0x13,0x30,0x00,0xc8,0x88,0x96,0x00,0x0d,0x03,0x41,0x60,0xd7,0x77,0x97,0x00,0x0a,
-0x00,0x28,0x3a,0x26,0x04,0xa4,0x00,0x16,0xf1,0x19,0x46,0x11,0x80,0x00,0x0a,0x1a,
-0x1a,0x8a,0x04,0xd9,0xc4,0xc2,0x00,0x02,0x23,0x29,0x01,0x80,0xc6,0xc0,0x79,0x92,
-0x0c,0x6c,0x19,0x27,0x00,0xd8,0xd1,0xc6,0x10,0x09,0x0a,0x19,0x00,0x90,0x95,0xa0,
-0xa9,0x95,0x2c,0x11,0xf5,0x14,0xd9,0x90,0x7a,0x30,0x09,0x09,0x59,0x60,0x00,0xd9,
-0xa1,0x0b,0x46,0x09,0x0a,0x88,0xf9,0x00,0xd9,0x94,0x4b,0x80,0x17,0x0a,0xa0,0xa9,
-0x24,0x50,0xd5,0x0a,0x1a,0x72,0x97,0x09,0x70,0x11,0x03,0xf0,0x12,0x00,0xdc,0x19,
-0x09,0xa9,0x09,0x76,0xd9,0x90,0x90,0xcb,0x19,0x09,0x09,0x08,0x78,0xda,0xa0,0x90,
-0xcc,0x17,0x59,0x09,0x16,0x75,0x7a,0x96,0x73,0x37,0x87,0x8a,0x00,0x62,0x5c,0x46,
-0x04,0x64,0x40,0xf1,0x03,0x14,0x91,0x11,0xa8,0x88,0x88,0xba,0x88,0x88,0x8b,0xa1,
-0x11,0x11,0xba,0x99,0x99,0x9b,0xa0,0xe5,0x37,0x20,0xab,0xa0,0xd6,0x2e,0xf3,0x06,
-0x9e,0xa9,0x99,0x40,0x06,0x60,0x29,0x00,0x05,0xd9,0x99,0xba,0x00,0x21,0x05,0x00,
-0x41,0x04,0x99,0xda,0x99,0x9c,0x21,0x22,0xa1,0x00,0x43,0x07,0xf3,0x19,0x50,0x02,
-0x20,0x00,0x7b,0x40,0x18,0x00,0x0a,0x49,0x99,0x99,0x50,0x97,0x90,0x88,0x50,0x5d,
-0x8a,0x09,0x0a,0x00,0xa4,0x90,0x90,0xa0,0x18,0x79,0x27,0x0a,0x04,0x50,0x96,0x40,
-0xa6,0x80,0x69,0xb0,0x0b,0x70,0xaa,0x0b,0xf0,0x0c,0x20,0x00,0x59,0x20,0x0a,0x00,
+0x00,0x56,0x5f,0x06,0xf0,0x1e,0x05,0x00,0x06,0xaa,0x63,0xd9,0x90,0x73,0x48,0xc6,
+0x1a,0x07,0x34,0xa2,0xab,0x20,0x7a,0xa9,0x79,0x97,0x17,0x34,0xaa,0x99,0xb2,0x7a,
+0xa8,0x90,0x09,0x06,0x00,0x0a,0x99,0xc0,0x00,0x00,0x90,0x09,0x00,0x00,0x04,0x00,
+0x00,0x05,0x70,0x4c,0x03,0x91,0xaa,0x00,0x00,0x0a,0xa9,0x99,0x99,0xaa,0x00,0x72,
+0x08,0x00,0x11,0x00,0x10,0xa0,0x27,0x09,0xf1,0x14,0x00,0x31,0x00,0x09,0x00,0xb1,
+0x00,0xd9,0xd2,0xc9,0x9a,0x90,0x9a,0x10,0x0a,0xd9,0xd0,0x82,0x09,0x90,0x90,0x0b,
+0x19,0x90,0x90,0x01,0x27,0xd9,0xb0,0x00,0x46,0x90,0x00,0x29,0xb2,0x70,0x00,0xf2,
+0x19,0x30,0x00,0x50,0x00,0x0a,0x10,0x64,0x00,0x69,0xaa,0x9b,0x99,0x10,0x07,0x10,
+0x75,0x00,0x3a,0x20,0x00,0x4a,0x00,0x99,0xda,0xcb,0x30,0x09,0x09,0x27,0x63,0x00,
+0x90,0x92,0x76,0x30,0x7d,0x9d,0xac,0xcb,0x30,0x9d,0x00,0xf0,0x5b,0x40,0xa0,0x00,
+0x18,0x54,0x1b,0x00,0x01,0x85,0x47,0xa8,0x82,0x18,0x56,0xb2,0x50,0x01,0x51,0x22,
+0x00,0x10,0x08,0x9a,0x9a,0x94,0x00,0xa0,0x91,0x83,0x60,0x0a,0x09,0x18,0x36,0x07,
+0xd9,0xda,0xdb,0xc3,0x00,0x40,0x01,0x30,0x01,0x4b,0x64,0xa7,0x30,0x03,0x34,0xb3,
+0x32,0x00,0x68,0x8d,0x88,0x30,0x47,0x78,0xa7,0x77,0x10,0x79,0x99,0x99,0x30,0x09,
+0x09,0x18,0x36,0x00,0x90,0x91,0x83,0x60,0x7d,0x9d,0xac,0xbc,0x30,0x00,0x01,0x40,
+0x00,0x00,0x3a,0xa9,0x8b,0x10,0x04,0x53,0x80,0x91,0x06,0xcb,0xa9,0x9d,0xa3,0x1b,
+0x03,0x72,0xa0,0x02,0x88,0x88,0xab,0x7f,0x00,0xff,0x03,0x45,0x00,0x90,0x92,0x74,
+0x50,0x7d,0x9d,0xac,0xbb,0x30,0xaa,0xaa,0xaa,0x9a,0x00,0x00,0x19,0x07,0x00,0x02,
+0x02,0xbf,0x02,0xf1,0x05,0x9e,0x99,0x95,0x00,0x66,0xc6,0x63,0x00,0x0a,0x33,0x34,
+0x80,0x00,0xc8,0x88,0x98,0x00,0x0c,0x77,0x78,0x09,0x00,0x00,0x24,0x07,0x62,0x90,
+0x39,0x99,0x99,0x99,0x70,0xe2,0x04,0xf0,0x0b,0x0a,0xa9,0xa8,0x49,0xd8,0xa0,0x01,
+0x80,0x4a,0x0a,0xa9,0xa8,0x08,0xe4,0xa0,0x01,0x82,0x8a,0x7a,0x99,0xa8,0x61,0xa0,
+0xa0,0x01,0x80,0x1b,0x00,0x10,0x00,0x09,0x00,0xf0,0x1d,0x00,0x00,0x01,0x34,0x00,
+0x58,0x9c,0x65,0x30,0x04,0x8c,0xa8,0x88,0x11,0x89,0xd9,0x88,0x85,0x00,0x9b,0x88,
+0x87,0x00,0x9c,0x97,0x77,0xb0,0x24,0x67,0x44,0x4b,0x00,0x06,0x63,0x33,0xa0,0x00,
+0x6a,0x88,0x8b,0x00,0x00,0x00,0x40,0x3a,0x03,0xf1,0x00,0x99,0x94,0x00,0x87,0xb7,
+0x74,0x00,0x0c,0x66,0x68,0x60,0x00,0xc6,0x66,0x96,0x09,0x00,0xf0,0x29,0x28,0xd8,
+0x88,0xab,0x60,0x06,0x60,0x29,0x40,0x08,0x30,0x00,0x05,0x40,0x00,0x00,0x01,0x23,
+0x08,0x99,0xa8,0xb4,0x60,0x80,0x84,0x48,0x44,0x08,0x99,0xc8,0x88,0xb3,0x80,0x89,
+0x74,0x79,0x18,0x8a,0xa8,0xb7,0x70,0x89,0xa4,0xd7,0x9a,0x08,0x00,0x95,0x03,0x40,
+0x00,0x35,0x00,0x34,0x00,0x04,0xb3,0x06,0xf1,0x14,0xa9,0x85,0xc9,0xa8,0x19,0x83,
+0x0a,0x01,0x92,0x27,0x20,0xa0,0x19,0x3a,0xda,0x8a,0x01,0x90,0x0b,0x30,0xa0,0x19,
+0x00,0xaa,0x2a,0x01,0x90,0x84,0x18,0xc9,0xa9,0x39,0x00,0x0a,0x01,0xbb,0x0a,0xf3,
+0x15,0x2b,0xc7,0x79,0x9a,0x00,0x63,0x05,0x20,0x90,0x0a,0x42,0x81,0x27,0x03,0xe5,
+0x89,0x9a,0xb3,0x3a,0x08,0x00,0x04,0x50,0x90,0x99,0x99,0x73,0x0a,0x95,0x00,0x08,
+0x10,0x30,0x00,0x09,0xa0,0x58,0x02,0xf0,0x18,0x11,0x11,0x07,0xda,0x78,0xd8,0x81,
+0x0a,0x04,0x8d,0x89,0x01,0xa4,0x66,0xb3,0xb0,0x9a,0x89,0x6b,0x4b,0x06,0x75,0x79,
+0xd8,0xa0,0x17,0x55,0x89,0x00,0x01,0xc9,0x3b,0xa2,0x00,0x02,0x07,0x21,0x7a,0x10,
+0x59,0x02,0xf1,0x16,0x02,0xbc,0x75,0xb9,0x80,0x06,0x31,0xc4,0xa6,0x20,0xa4,0x7c,
+0x5b,0x5a,0x2e,0x57,0xb8,0xd8,0xa3,0xa1,0x7a,0x0a,0x0a,0x09,0x17,0xc8,0xd8,0xa0,
+0xa9,0x98,0x09,0x0a,0x02,0x08,0x10,0x39,0x70,0x2f,0x05,0x31,0xaa,0xaa,0xa9,0x5d,
+0x00,0x51,0x2a,0xaa,0xaa,0xaa,0x60,0x26,0x04,0xf1,0x00,0xb0,0x91,0x65,0x00,0x75,
+0x09,0x10,0xb0,0x2a,0x00,0x91,0x06,0x60,0x01,0xac,0xe5,0x03,0xf2,0x04,0x90,0x00,
+0x8d,0x95,0x8d,0x94,0x05,0xd8,0x27,0xc8,0x01,0x46,0x04,0x17,0x05,0x01,0xcc,0xcc,
+0xc8,0x40,0x05,0xd0,0x99,0xd9,0x99,0x50,0x2a,0x09,0x16,0x60,0x09,0x07,0xb0,0x06,
+0x30,0xc6,0x01,0xf0,0x3c,0x01,0x99,0x9c,0x99,0x95,0x02,0x55,0x67,0x18,0x00,0x37,
+0x76,0x73,0xa0,0x02,0x98,0xc9,0x87,0x00,0x89,0x9d,0x99,0x92,0x0a,0x09,0x15,0x26,
+0x30,0xa3,0xd9,0x98,0x63,0x0a,0x00,0x00,0x5a,0x10,0x03,0x78,0x00,0xa0,0x03,0x7b,
+0x00,0x0a,0x20,0x00,0xa0,0x82,0xa6,0x34,0xbe,0x9b,0x0a,0x09,0x07,0xd6,0x60,0xa1,
+0x42,0x8a,0x10,0x05,0xa2,0x51,0xa0,0x00,0x68,0x00,0x0a,0x02,0xa9,0x00,0x00,0xa6,
+0xd4,0x06,0xf5,0x6b,0x24,0x00,0x00,0x05,0x9c,0x39,0xaa,0xc0,0x00,0x90,0x90,0x0a,
+0x05,0xae,0x9a,0x00,0xa0,0x07,0xe4,0xaa,0xae,0x01,0x9a,0x80,0x00,0x00,0x72,0x90,
+0x36,0x27,0x00,0x09,0x0a,0x10,0xa0,0x00,0x91,0x80,0x05,0x30,0x00,0x24,0x04,0x00,
+0x00,0x9c,0x34,0xa5,0x54,0x00,0x90,0x95,0xc6,0x72,0xae,0x99,0x0a,0x21,0x04,0xe3,
+0x45,0xa9,0x00,0x8a,0x78,0x1a,0x45,0x45,0x90,0xa0,0xa0,0x90,0x09,0x02,0x0a,0x03,
+0x00,0x90,0x08,0x80,0x00,0x00,0x40,0x05,0x00,0x05,0xc7,0x07,0xd9,0x70,0x06,0x36,
+0x83,0xa3,0x07,0xdb,0x46,0xb6,0x00,0x0d,0xb4,0x2a,0xc9,0x25,0xa6,0x39,0x30,0xb0,
+0x96,0x33,0x2a,0x95,0x00,0x63,0x01,0xa6,0x00,0x06,0x39,0x92,0x00,0x00,0x28,0x09,
+0xf1,0x0c,0x9c,0x3c,0x99,0xb5,0x00,0x90,0xa0,0x05,0x52,0x9d,0x66,0x77,0x72,0x06,
+0xe2,0x99,0xb9,0x60,0x9a,0x70,0x0a,0x00,0x55,0x90,0x79,0xd9,0x40,0x50,0x0b,0xf0,
+0x1d,0x94,0x99,0xd9,0x80,0x00,0x50,0x40,0x00,0x04,0xc7,0x3b,0x8b,0x00,0x06,0x3b,
+0x99,0xb3,0x06,0xdb,0x23,0x35,0x70,0x0c,0x90,0x44,0x67,0x02,0xc9,0x48,0x88,0x40,
+0x97,0x31,0x29,0x02,0x02,0x63,0xa9,0x34,0x90,0x06,0x54,0x98,0xa4,0xb9,0x04,0x02,
+0xa8,0x05,0xf1,0x03,0x09,0x03,0x02,0x10,0xa0,0x48,0x70,0x3b,0x72,0x08,0x30,0x00,
+0x06,0x50,0x19,0x9e,0x99,0x70,0x6c,0x07,0x00,0x87,0x04,0x81,0x09,0x99,0x99,0x99,
+0x60,0x00,0x00,0x60,0x29,0x00,0xf2,0x11,0x94,0x09,0x07,0x04,0x33,0x70,0x5a,0x22,
+0x07,0x90,0x01,0x00,0xa2,0x91,0x02,0x99,0x9f,0xba,0x96,0x00,0x06,0x6a,0x10,0x00,
+0x28,0x80,0x2b,0x61,0x08,0x20,0x00,0x04,0x29,0x00,0xf1,0x15,0xa8,0x8b,0x88,0x95,
+0x07,0x88,0x03,0x95,0x40,0x87,0x6a,0x33,0xa2,0x04,0x88,0x64,0x4b,0x00,0x47,0xb7,
+0xa4,0xb0,0x04,0x62,0xbb,0x0b,0x00,0x47,0x82,0x24,0xb0,0x04,0xa7,0x77,0x7b,0x00,
+0x64,0x03,0xf1,0x07,0x79,0x9b,0x99,0x92,0x00,0x55,0x00,0xb0,0x02,0x88,0x88,0x88,
+0x86,0x00,0xc7,0x77,0x88,0x00,0x0d,0x88,0x89,0x80,0x10,0x0e,0x81,0x04,0x90,0xa0,
+0x09,0x2a,0x80,0x07,0x9a,0x1b,0x07,0xf2,0x19,0x06,0x00,0x06,0x20,0x00,0x72,0x64,
+0x62,0xa0,0x69,0x99,0xbc,0xad,0x05,0x18,0x45,0x55,0x51,0x44,0x83,0x4b,0x54,0x12,
+0x68,0x79,0xdb,0xb1,0x04,0xaa,0x28,0x77,0x18,0xa7,0x92,0x87,0x71,0x00,0x08,0x27,
+0x6b,0x26,0x01,0xf0,0x07,0x30,0x05,0x00,0x00,0x9b,0x86,0xcb,0x84,0x46,0x34,0x71,
+0x52,0x00,0x78,0x8d,0x88,0xb0,0x05,0x98,0xd8,0x8b,0x00,0x48,0x07,0xd2,0x06,0x9d,
+0xe9,0x9d,0x00,0x18,0x6a,0x01,0xb0,0x1b,0x30,0xa1,0x84,0xa2,0x09,0x00,0x2d,0x00,
+0xf2,0x14,0xac,0x98,0xdb,0x96,0x36,0x51,0xa1,0x71,0x00,0x49,0x9d,0x99,0x80,0x27,
+0x77,0xc7,0x77,0x50,0x22,0x22,0x2b,0x22,0x09,0xc9,0x99,0xd9,0x50,0x04,0xa0,0x0a,
+0x00,0x00,0x03,0x29,0xa0,0x56,0x00,0xf2,0x3d,0x8b,0x99,0xca,0x85,0x28,0x45,0xb2,
+0x64,0x00,0x02,0xa5,0x86,0x00,0x2a,0x9a,0x88,0x9a,0x70,0x12,0x05,0x01,0x40,0x00,
+0xa0,0x91,0x73,0x00,0x06,0x23,0x3b,0x00,0x19,0x99,0x9b,0xc9,0x50,0x05,0x00,0x13,
+0x00,0x04,0xcc,0x8b,0xab,0x81,0x65,0xb8,0xb7,0xc2,0x00,0x97,0x66,0x6a,0x50,0x09,
+0x76,0x66,0xa5,0x00,0x68,0x76,0x89,0x30,0x68,0xba,0x8c,0xa8,0x20,0x2b,0x00,0x73,
+0x00,0x4b,0x10,0x07,0x30,0x20,0x08,0x00,0x21,0x0a,0xf0,0x06,0xba,0x87,0xba,0x72,
+0x34,0x42,0x90,0x60,0x00,0xd8,0x88,0x88,0xc1,0x05,0xc8,0x88,0xc4,0x00,0x0c,0x88,
+0x8b,0xa9,0x08,0xf0,0x13,0x83,0x00,0x09,0x00,0x02,0x70,0x00,0xd8,0x88,0x97,0x00,
+0x00,0x70,0xa0,0x34,0x00,0x09,0x3a,0x0a,0x00,0x19,0xaa,0xeb,0x99,0x50,0x27,0x9b,
+0x6a,0x60,0x1a,0x40,0x70,0x06,0x40,0xa1,0x01,0xf0,0x25,0x19,0x9b,0xed,0x99,0x50,
+0x03,0xc2,0x77,0x10,0x1a,0x81,0x00,0x49,0x70,0x10,0x91,0x09,0x10,0x06,0x29,0x90,
+0x91,0x00,0x27,0xa9,0x09,0xa9,0x33,0x6c,0x60,0x91,0x00,0x38,0xb5,0x09,0x10,0x00,
+0xad,0x5c,0x99,0xd0,0x74,0x94,0x80,0x09,0x01,0x09,0x0c,0x99,0xd0,0x00,0x90,0xf1,
+0x05,0x04,0x55,0x02,0xf3,0x19,0x82,0x11,0xa1,0x10,0x88,0x85,0x8d,0x88,0x15,0xa9,
+0x07,0xd7,0x70,0x7c,0x95,0x8b,0x88,0x31,0xd5,0x08,0x88,0x70,0x3e,0xa1,0xc6,0x6b,
+0x0a,0x92,0x0c,0x77,0xb0,0x28,0x10,0x90,0x0a,0x00,0x81,0x09,0x07,0x90,0x30,0x00,
+0xf0,0x18,0x02,0x52,0x00,0x89,0xcb,0x75,0x10,0x00,0x57,0x05,0x60,0x00,0x5c,0x9d,
+0x81,0x00,0x00,0x3c,0x40,0xa2,0x00,0xaf,0xaa,0x89,0xb0,0x01,0x60,0xa0,0x62,0x10,
+0x75,0x0a,0x05,0x90,0x14,0x09,0xb0,0x04,0x10,0xf0,0x63,0x00,0x72,0x00,0x00,0x00,
+0x97,0x2b,0xba,0xa0,0x09,0x72,0x3c,0xc2,0x00,0x13,0xb7,0x41,0x62,0x02,0xea,0x9a,
+0x10,0x00,0x18,0xc4,0x0a,0x40,0x0b,0xb8,0xd8,0x7a,0x10,0x19,0x0a,0x1a,0x20,0x19,
+0x08,0xa0,0x09,0x00,0x0a,0x88,0xd8,0x8b,0x00,0xa7,0x7c,0x77,0xa0,0x09,0x8a,0xb8,
+0x89,0x00,0x2b,0x95,0x91,0x00,0x03,0x9b,0x50,0xa2,0x00,0xaa,0x9d,0x87,0x90,0x03,
+0x80,0xa2,0x92,0x02,0x70,0x8a,0x01,0x90,0x00,0x40,0x00,0x00,0x00,0x19,0x0a,0xaa,
+0xa6,0x09,0x16,0x00,0xa0,0x04,0xdb,0x50,0x0a,0x00,0x03,0x80,0x00,0xa0,0x02,0xe9,
+0x70,0x0a,0x00,0x01,0x01,0x00,0xa0,0x03,0xaa,0x7a,0xae,0xa8,0x00,0x01,0x00,0xf1,
+0x1a,0x02,0x30,0x00,0x00,0x00,0x81,0x6d,0xad,0x20,0x27,0x41,0xa0,0xa0,0x0b,0xa9,
+0x0c,0x1d,0x90,0x09,0x20,0xe7,0x0a,0x08,0xc8,0x29,0xb6,0x60,0x11,0x68,0x54,0xd0,
+0x08,0x93,0xb4,0xb7,0xa0,0x00,0x04,0x60,0x03,0x20,0x2e,0x00,0xf1,0x15,0x37,0x0a,
+0x0a,0x00,0x09,0x10,0xa0,0xa0,0x04,0x89,0x2a,0x0a,0x00,0x59,0x70,0xa0,0xd0,0x01,
+0xb4,0x1f,0x1e,0x30,0x58,0x55,0x8b,0x97,0x01,0x59,0xb2,0x92,0xb0,0x44,0x2a,0x19,
+0x05,0x40,0x29,0x00,0xf0,0x43,0x80,0x0a,0x54,0x00,0x64,0x00,0xa0,0x70,0x09,0x26,
+0xae,0xa7,0x16,0xcc,0x10,0x91,0x42,0x05,0x51,0xad,0xa6,0x12,0xda,0x50,0x55,0x83,
+0x24,0x00,0x01,0xd5,0x02,0x8a,0x53,0xbc,0x04,0x23,0x04,0x81,0x3b,0x50,0x02,0x10,
+0x04,0x00,0x00,0x90,0x69,0xb7,0x71,0x17,0x42,0x93,0x22,0x09,0xa9,0x6d,0xc3,0x00,
+0x29,0x13,0x76,0x40,0x04,0xb8,0x48,0xba,0x80,0x54,0x11,0x76,0x47,0x03,0x98,0xa1,
+0x63,0x81,0x30,0x04,0x4b,0x11,0x20,0x00,0xa8,0x00,0xf1,0x15,0x09,0x07,0xa9,0xd0,
+0x07,0x24,0x72,0x09,0x03,0xda,0x57,0xa9,0xd0,0x02,0x70,0x72,0x09,0x01,0xd9,0x77,
+0xa9,0xd0,0x01,0x00,0x72,0x09,0x01,0x69,0x87,0x20,0x90,0x26,0x13,0xca,0x9d,0x80,
+0xfa,0x00,0xf0,0x3f,0x29,0x0e,0xae,0xaa,0x09,0x13,0x90,0x90,0xa6,0xca,0x59,0x09,
+0x0a,0x03,0x70,0xda,0xda,0xa3,0xe9,0x79,0x09,0x0a,0x12,0x00,0x90,0x90,0xa4,0x99,
+0x7d,0x9d,0x9a,0x00,0x00,0x90,0x00,0x90,0x00,0x40,0x05,0x00,0x00,0x64,0x05,0xd9,
+0x80,0x09,0x26,0xc7,0x37,0x08,0xbb,0x40,0x9b,0x00,0x16,0x31,0x98,0x6a,0x25,0xd9,
+0x63,0x75,0x14,0x21,0x00,0x10,0x51,0x05,0xa9,0x55,0x98,0x10,0x00,0x00,0x00,0x27,
+0x00,0x01,0xfc,0x00,0xf2,0x14,0x82,0x49,0x9c,0x70,0x18,0x32,0x03,0xa0,0x0b,0xab,
+0x28,0xaa,0x50,0x18,0x27,0x20,0x06,0x36,0xda,0x59,0xda,0x90,0x42,0x00,0x08,0x10,
+0x02,0x69,0x10,0x81,0x00,0x75,0x08,0x9d,0xa9,0xfa,0x00,0xf1,0x18,0x62,0x09,0x00,
+0x00,0x0a,0x00,0x90,0xbb,0x62,0x73,0x6d,0x79,0x81,0x7a,0x95,0xd5,0x99,0x00,0x91,
+0x09,0x09,0x81,0x4d,0x96,0xc6,0x91,0x72,0x11,0x4b,0x39,0x18,0x4a,0x85,0x50,0xa8,
+0x11,0x00,0x90,0x09,0x2c,0x00,0x00,0x88,0x00,0xf0,0x69,0xa0,0x00,0x55,0x08,0x9d,
+0x86,0x0a,0x17,0x11,0xb1,0x15,0xdc,0x35,0x6c,0x63,0x04,0x70,0x34,0x44,0x23,0xe9,
+0x77,0x99,0xa3,0x01,0x02,0xa0,0x05,0x44,0xa9,0x5a,0x88,0xb4,0x00,0x00,0xa1,0x16,
+0x40,0x00,0x50,0x06,0x00,0x00,0x45,0x06,0xc9,0x60,0x09,0x16,0xa0,0x73,0x07,0xbb,
+0x6d,0x9d,0xb5,0x15,0x40,0x90,0x84,0x53,0xda,0x5d,0x9b,0xa4,0x22,0x00,0x90,0x00,
+0x02,0x6a,0x79,0x00,0x08,0x33,0x00,0x99,0x99,0x60,0x00,0x20,0x01,0x10,0x00,0x0b,
+0x00,0x28,0x00,0x07,0x34,0x9d,0xa9,0x62,0xb7,0x62,0xa0,0x90,0x37,0xb1,0xda,0xac,
+0x50,0xa5,0x46,0x65,0x14,0x3a,0x61,0x45,0x72,0x00,0x48,0x59,0x27,0x26,0x26,0x18,
+0x70,0x6a,0x80,0x7e,0x00,0xf0,0x1b,0x04,0x40,0x1a,0x10,0x00,0x90,0x28,0xd8,0x60,
+0x17,0x75,0x8d,0x88,0x19,0x98,0x01,0x11,0xa0,0x39,0x12,0x79,0x35,0x04,0xc8,0x27,
+0x73,0x00,0x52,0x16,0x8d,0x88,0x15,0x97,0x08,0x58,0x40,0x10,0x09,0x50,0x07,0x10,
+0x00,0x03,0x01,0xf0,0xab,0x38,0x09,0x99,0xc2,0x09,0x23,0x67,0x7c,0x14,0xbb,0x29,
+0x99,0xd8,0x05,0x50,0x32,0x71,0x41,0xda,0x38,0x4a,0xa1,0x13,0x00,0x2b,0xd5,0x01,
+0x8a,0x6a,0x38,0x87,0x12,0x00,0x09,0x50,0x10,0x00,0x20,0x01,0x35,0x00,0x73,0x69,
+0xa5,0x80,0x09,0x23,0x77,0x28,0x09,0xaa,0x5c,0x98,0x83,0x18,0x37,0xc8,0x88,0x35,
+0xd9,0x2d,0x88,0x80,0x20,0x24,0xb8,0x66,0x06,0xa8,0xd2,0xbd,0x40,0x00,0x33,0x82,
+0x06,0x50,0x01,0x30,0x04,0x10,0x00,0x73,0x28,0xbb,0x80,0x08,0x45,0x50,0x09,0x07,
+0xba,0x4a,0x88,0x80,0x17,0x25,0xb9,0x99,0x14,0xd9,0x6b,0x76,0x61,0x11,0x29,0xac,
+0xbb,0x14,0xb7,0xa8,0x76,0x61,0x31,0x05,0x82,0x28,0x00,0x00,0x30,0x04,0x00,0x00,
+0x54,0x68,0xba,0x93,0x08,0x38,0x41,0x14,0x36,0xb9,0x18,0x7c,0x71,0x17,0x29,0x59,
+0xb9,0x04,0xd7,0x95,0x91,0x90,0x11,0x55,0x5b,0x6b,0x05,0x93,0x35,0xc7,0xc0,0x00,
+0x03,0x59,0x08,0x00,0x0a,0x7c,0x7c,0x8b,0x30,0x76,0x9a,0x87,0x82,0x18,0x88,0xd8,
+0x88,0x40,0x0a,0x78,0x78,0x60,0x00,0xb6,0x66,0x87,0x00,0x0b,0x66,0x68,0x70,0x09,
+0x00,0xf0,0x08,0x01,0x8c,0x77,0x79,0xb5,0x00,0x40,0x00,0x50,0x00,0x37,0x94,0x5c,
+0x41,0x04,0x55,0xb5,0x55,0x10,0x49,0x9d,0x99,0x80,0x2d,0x00,0xf0,0x74,0x60,0x88,
+0x8d,0x88,0x85,0x00,0x06,0x9a,0x20,0x01,0x59,0x80,0x2a,0x83,0x15,0x10,0x00,0x02,
+0x30,0x01,0x35,0x00,0x00,0x58,0xb6,0x6c,0x6c,0x6b,0xcc,0x68,0x58,0x08,0xd5,0x6a,
+0x5b,0x83,0x85,0x19,0x09,0x79,0xbb,0x4d,0x5d,0x67,0xbb,0x48,0x38,0x68,0xcc,0x08,
+0x08,0x61,0x07,0x3a,0x3a,0x2c,0x8c,0x4c,0x8a,0x40,0x78,0xb2,0x88,0xa4,0x17,0x79,
+0xb8,0x79,0x10,0x87,0x6c,0x66,0xa0,0x04,0x99,0x79,0x95,0x01,0x79,0xa7,0xaa,0x72,
+0x27,0xcb,0x7b,0xd8,0x51,0x83,0x00,0x02,0x73,0x00,0x02,0x70,0x04,0x10,0x49,0xac,
+0x98,0x90,0x00,0x02,0x72,0xa0,0x02,0x99,0xac,0xdb,0x96,0x00,0x3a,0x92,0x11,0x02,
+0xbd,0x97,0x77,0x90,0x01,0x6a,0x88,0x99,0x00,0x06,0x40,0x01,0x90,0x00,0x6b,0x99,
+0x99,0x0a,0x02,0xf1,0x69,0x5a,0x03,0x9d,0x74,0xb8,0x10,0x01,0xa1,0x4a,0x00,0x01,
+0x7c,0x56,0xda,0x92,0x59,0xd9,0x19,0x00,0x00,0x7e,0x26,0xdb,0xb5,0x19,0xaa,0x4a,
+0x00,0x07,0x19,0x00,0x90,0x08,0x00,0x90,0x06,0x99,0x60,0x00,0xa0,0x00,0x00,0x01,
+0x6c,0x68,0x8c,0x97,0x01,0xa1,0x88,0xc8,0x70,0x8d,0x68,0x6b,0x77,0x26,0xc6,0x13,
+0xa3,0x10,0x6f,0x4a,0x8c,0x9b,0x09,0xb9,0x80,0x98,0x84,0x5a,0x09,0x97,0x7a,0x00,
+0xa0,0x80,0x04,0x90,0x00,0x00,0x00,0x01,0x04,0xda,0xc2,0x90,0xb0,0x09,0x18,0x6b,
+0xab,0x30,0xc8,0x82,0x2b,0x21,0x0c,0x98,0x89,0xd8,0x70,0x90,0x80,0x4d,0x00,0x1b,
+0x8d,0x29,0xa3,0x03,0x63,0x83,0xa0,0xc2,0x00,0x0a,0xb0,0x02,0x90,0x89,0x02,0xf5,
+0x19,0x0a,0x0a,0x02,0x02,0x88,0xc0,0xb8,0x91,0x26,0x6b,0x0a,0x33,0x60,0x00,0x30,
+0x13,0x30,0x00,0xc8,0x88,0x96,0x00,0x0d,0x77,0x79,0x70,0x00,0xd7,0x77,0x97,0x00,
+0x0a,0x00,0x03,0x70,0x00,0xa0,0x04,0xa4,0x00,0x01,0x00,0xf5,0x41,0x46,0x11,0x80,
+0x00,0x0a,0x1a,0x1a,0x8a,0x04,0xd9,0xc4,0xc2,0x00,0x02,0x23,0x29,0x01,0x80,0xc6,
+0xc0,0x79,0x92,0x0c,0x6c,0x19,0x27,0x00,0xd8,0xd1,0xc6,0x10,0x09,0x0a,0x19,0x00,
+0x90,0x95,0xa0,0xa9,0x95,0x00,0x00,0x02,0x00,0x00,0xd9,0x90,0x7a,0x30,0x09,0x09,
+0x59,0x60,0x00,0xd9,0xa1,0x0b,0x46,0x09,0x0a,0x88,0xf9,0x00,0xd9,0x94,0x4b,0x80,
+0x17,0x0a,0xa0,0xa9,0x24,0x50,0xd5,0x0a,0x1a,0x72,0x97,0x09,0x70,0x11,0x03,0xf2,
+0x15,0x00,0xdc,0x19,0x09,0xa9,0x09,0x76,0xd9,0x90,0x90,0xcb,0x19,0x09,0x09,0x08,
+0x78,0xda,0xa0,0x90,0xcc,0x17,0x59,0x09,0x16,0x75,0x7a,0x96,0x73,0x37,0x87,0x8a,
+0x00,0x62,0xa0,0x00,0x90,0x2c,0x00,0xf0,0x29,0x03,0x00,0x00,0x14,0x91,0x11,0xa8,
+0x88,0x88,0xba,0x88,0x88,0x8b,0xa1,0x11,0x11,0xba,0x99,0x99,0x9b,0xa0,0x00,0x00,
+0xba,0xaa,0xaa,0xab,0xa0,0x00,0x00,0xa0,0x09,0x9e,0xa9,0x99,0x40,0x06,0x60,0x29,
+0x00,0x05,0xd9,0x99,0xba,0x00,0x21,0x05,0x00,0x41,0x04,0x99,0xda,0x99,0x00,0x00,
+0x0a,0x3c,0x00,0xf2,0x20,0xa1,0x00,0x02,0x88,0x88,0x88,0x86,0x00,0x50,0x02,0x20,
+0x00,0x7b,0x40,0x18,0x00,0x0a,0x49,0x99,0x99,0x50,0x97,0x90,0x88,0x50,0x5d,0x8a,
+0x09,0x0a,0x00,0xa4,0x90,0x90,0xa0,0x18,0x79,0x27,0x0a,0x04,0x50,0x96,0x40,0xa6,
+0x80,0x69,0xb0,0x0b,0x9f,0x00,0xf1,0x19,0x30,0x00,0x20,0x00,0x59,0x20,0x0a,0x00,
 0x0b,0x69,0xc8,0x88,0x90,0x97,0x96,0x20,0x06,0x5c,0x8a,0x09,0x18,0x10,0x94,0x90,
-0xd8,0x00,0x17,0x89,0x0a,0xf6,0x09,0x62,0xa0,0x09,0x80,0x68,0x0a,0x99,0x9d,0x0e,
-0x10,0x13,0x0e,0x08,0xf0,0x07,0xb9,0xa0,0x00,0x0a,0x40,0x56,0x00,0x08,0xd9,0x9d,
-0x9b,0x60,0x0a,0x00,0xa0,0x36,0x00,0xaa,0xab,0xab,0x60,0x0a,0xbb,0x00,0x10,0xa0,
-0x7d,0x04,0xf1,0x03,0xba,0x99,0xab,0x00,0x00,0x55,0x02,0x80,0x02,0x9b,0xc9,0xad,
-0x97,0x00,0x33,0x01,0x60,0x00,0x25,0x0b,0x22,0x0b,0x10,0x52,0x49,0x12,0x00,0x5b,
-0x49,0x13,0x5a,0x88,0x4c,0xf0,0x1d,0x36,0x00,0x90,0x01,0x9b,0xc9,0x9d,0x95,0x00,
-0x35,0x60,0x80,0x00,0x29,0x9d,0x99,0x70,0x04,0x50,0xa0,0x0a,0x02,0xbc,0x9e,0xa9,
-0xe6,0x00,0x04,0xaa,0x10,0x00,0x39,0x80,0x2b,0x72,0x17,0x10,0x00,0x03,0x50,0x00,
-0x37,0x00,0x90,0x52,0x00,0xf2,0x11,0x96,0x00,0x25,0x00,0x70,0x00,0x4a,0x2c,0xaa,
-0xc0,0x06,0x11,0x90,0x0a,0x00,0x25,0x29,0x09,0xb0,0x00,0x85,0x90,0x00,0x10,0x39,
-0x19,0x00,0x0a,0x0b,0x00,0xba,0x9a,0xa8,0x00,0x50,0x27,0x01,0x90,0x01,0x9a,0x2d,
-0x00,0xf0,0x09,0x45,0x00,0x50,0x00,0x1b,0x69,0x99,0xd7,0x0b,0x74,0x99,0x3a,0x03,
-0x67,0x81,0x45,0xa0,0x02,0x78,0x9a,0x5a,0x00,0x27,0x40,0x72,0x2e,0x80,0x02,0x99,
-0x00,0x03,0x4a,0x35,0xa3,0x21,0xbb,0x2d,0xf2,0x14,0x06,0x8c,0x9a,0xc7,0x00,0x42,
-0x06,0x00,0x80,0x02,0x80,0xa0,0x27,0x02,0x9b,0x9b,0x9c,0xa6,0x00,0x1b,0xca,0x40,
-0x00,0x5c,0x2a,0x09,0x92,0x38,0x00,0xa0,0x03,0x60,0x00,0x27,0x00,0x52,0x00,0xf0,
-0x0c,0x01,0xa3,0x01,0x40,0x00,0x9b,0x98,0x88,0xb4,0x36,0xb8,0x96,0x46,0x40,0x69,
-0x9c,0x88,0x63,0x00,0x41,0x71,0x47,0x20,0x1b,0x9b,0x96,0x91,0xa0,0x26,0x00,0x7b,
-0x00,0x11,0x80,0x29,0x00,0xf3,0x11,0x05,0x23,0x55,0x40,0x00,0x19,0x3e,0x99,0xc0,
-0x18,0x18,0x3b,0xb1,0x00,0x22,0x7a,0x65,0x97,0x00,0x94,0xc8,0x8d,0x00,0x84,0x27,
-0x00,0xa0,0x07,0x02,0xc8,0x8d,0x00,0x52,0x00,0xf2,0x0e,0x9d,0x96,0x01,0xc8,0x55,
-0x95,0x20,0xa5,0x49,0xa4,0x56,0x36,0x78,0xc7,0x74,0x50,0x39,0x6b,0x5a,0x55,0x03,
-0xa7,0xc6,0xa5,0x40,0x3a,0x7c,0x7a,0x63,0x52,0x00,0xf6,0x42,0x36,0x03,0x60,0x02,
-0x9a,0xc9,0xac,0x96,0x01,0x06,0x07,0x10,0x00,0x90,0xa1,0xc9,0x91,0x09,0x0a,0x91,
-0xa0,0x00,0x40,0x60,0x04,0x30,0x05,0xac,0x8c,0x8a,0x00,0x53,0x80,0x80,0xa0,0x3b,
-0xbd,0x9d,0x9d,0x70,0x00,0x27,0x05,0x40,0x01,0x8a,0xc8,0xbb,0xa5,0x03,0x47,0x46,
-0xcb,0x50,0x79,0x55,0x5c,0x54,0x08,0xa9,0xb5,0x96,0x35,0x9a,0x95,0x9a,0x90,0x08,
-0x89,0xb5,0x86,0x04,0x68,0x79,0x8c,0x67,0x33,0x40,0x08,0x19,0x70,0xff,0x31,0xf3,
-0x17,0x03,0x71,0x00,0x05,0x40,0xaa,0xc4,0x06,0xba,0xba,0x79,0x00,0x74,0x38,0x2d,
-0x90,0x07,0x43,0xb7,0x63,0x91,0x6b,0xa5,0x8d,0x96,0x00,0x55,0x64,0xb5,0x30,0x6c,
-0xba,0x8c,0x88,0x02,0x00,0x30,0x90,0x9b,0x23,0xf2,0x13,0x88,0xc7,0xc0,0x6b,0xa8,
+0xd8,0x00,0x17,0x89,0x0a,0x00,0x04,0x50,0x90,0xa0,0x09,0x80,0x68,0x0a,0x99,0x60,
+0x2d,0x00,0xf0,0x0c,0x13,0x00,0x00,0x00,0x0b,0xb9,0xa0,0x00,0x0a,0x40,0x56,0x00,
+0x08,0xd9,0x9d,0x9b,0x60,0x0a,0x00,0xa0,0x36,0x00,0xaa,0xab,0xab,0x60,0x0a,0xbb,
+0x00,0x10,0xa0,0x7d,0x04,0xf0,0x13,0xba,0x99,0xab,0x00,0x00,0x55,0x02,0x80,0x02,
+0x9b,0xc9,0xad,0x97,0x00,0x33,0x01,0x60,0x00,0x99,0x99,0x99,0x70,0x00,0x0b,0x10,
+0x0b,0x00,0x00,0xa0,0x00,0xb0,0x00,0x0a,0x00,0x09,0x00,0x22,0x5a,0x60,0xb4,0x00,
+0xf0,0x1d,0x36,0x00,0x90,0x01,0x9b,0xc9,0x9d,0x95,0x00,0x35,0x60,0x80,0x00,0x29,
+0x9d,0x99,0x70,0x04,0x50,0xa0,0x0a,0x02,0xbc,0x9e,0xa9,0xe6,0x00,0x04,0xaa,0x10,
+0x00,0x39,0x80,0x2b,0x72,0x17,0x10,0x00,0x03,0x50,0x00,0x37,0x00,0x90,0x52,0x00,
+0xf2,0x11,0x96,0x00,0x25,0x00,0x70,0x00,0x4a,0x2c,0xaa,0xc0,0x06,0x11,0x90,0x0a,
+0x00,0x25,0x29,0x09,0xb0,0x00,0x85,0x90,0x00,0x10,0x39,0x19,0x00,0x0a,0x0b,0x00,
+0xba,0x9a,0xa8,0x00,0x50,0x27,0x01,0x90,0x01,0x9a,0x2d,0x00,0xf2,0x3c,0x45,0x00,
+0x50,0x00,0x1b,0x69,0x99,0xd7,0x0b,0x74,0x99,0x3a,0x03,0x67,0x81,0x45,0xa0,0x02,
+0x78,0x9a,0x5a,0x00,0x27,0x40,0x00,0xa0,0x02,0x70,0x02,0x99,0x00,0x03,0x4a,0x35,
+0xa3,0x21,0x89,0xc8,0x9c,0x85,0x06,0x8c,0x9a,0xc7,0x00,0x42,0x06,0x00,0x80,0x02,
+0x80,0xa0,0x27,0x02,0x9b,0x9b,0x9c,0xa6,0x00,0x1b,0xca,0x40,0x00,0x5c,0x2a,0x09,
+0x92,0x38,0x00,0xa0,0x03,0x60,0x00,0x27,0x00,0x52,0x00,0xf0,0x10,0x01,0xa3,0x01,
+0x40,0x00,0x9b,0x98,0x88,0xb4,0x36,0xb8,0x96,0x46,0x40,0x69,0x9c,0x88,0x63,0x00,
+0x41,0x71,0x47,0x20,0x1b,0x9b,0x96,0x91,0x00,0x00,0x00,0x7a,0x7b,0x00,0x11,0x80,
+0x29,0x00,0xf3,0x11,0x05,0x23,0x55,0x40,0x00,0x19,0x3e,0x99,0xc0,0x18,0x18,0x3b,
+0xb1,0x00,0x22,0x7a,0x65,0x97,0x00,0x94,0xc8,0x8d,0x00,0x84,0x27,0x00,0xa0,0x07,
+0x02,0xc8,0x8d,0x00,0x52,0x00,0xf2,0x0e,0x9d,0x96,0x01,0xc8,0x55,0x95,0x20,0xa5,
+0x49,0xa4,0x56,0x36,0x78,0xc7,0x74,0x50,0x39,0x6b,0x5a,0x55,0x03,0xa7,0xc6,0xa5,
+0x40,0x3a,0x7c,0x7a,0x63,0x52,0x00,0xf5,0x42,0x36,0x03,0x60,0x02,0x9a,0xc9,0xac,
+0x96,0x01,0x06,0x07,0x10,0x00,0x90,0xa1,0xc9,0x91,0x09,0x0a,0x91,0xa0,0x00,0x40,
+0x60,0x04,0x30,0x05,0xac,0x8c,0x8a,0x00,0x53,0x80,0x80,0xa0,0x3b,0xbd,0x9d,0x9d,
+0x70,0x00,0x27,0x05,0x40,0x01,0x8a,0xc8,0xbb,0xa5,0x03,0x47,0x46,0xcb,0x50,0x79,
+0x55,0x5c,0x54,0x08,0xa9,0xb5,0x96,0x35,0x9a,0x95,0x9a,0x90,0x08,0x89,0xb5,0x86,
+0x04,0x68,0x79,0x8c,0x67,0x33,0x40,0x08,0x19,0x70,0xf0,0x02,0xf1,0x1a,0x54,0x03,
+0x71,0x00,0x05,0x40,0xaa,0xc4,0x06,0xba,0xba,0x79,0x00,0x74,0x38,0x2d,0x90,0x07,
+0x43,0xb7,0x63,0x91,0x6b,0xa5,0x8d,0x96,0x00,0x55,0x64,0xb5,0x30,0x6c,0xba,0x8c,
+0x88,0x02,0x00,0x30,0x90,0x00,0x08,0xff,0x06,0xf0,0x1f,0x88,0xc7,0xc0,0x6b,0xa8,
 0x8c,0x7c,0x08,0x68,0x69,0xc7,0xa0,0x86,0x81,0xb5,0x90,0x06,0xc9,0x29,0xa2,0x50,
-0x08,0x67,0xda,0x8b,0x24,0xbc,0x46,0x74,0x70,0x32,0x18,0x4b,0x16,0x84,0x1e,0x60,
-0x68,0x09,0x99,0x94,0x36,0x33,0x2a,0x02,0x90,0x3a,0xaa,0xa7,0x1b,0x90,0x00,0x45,
-0x03,0x39,0x76,0x2f,0x51,0x90,0x00,0x45,0x00,0x09,0x09,0x00,0x62,0x08,0xb3,0x00,
-0x04,0x40,0x0b,0x03,0x47,0xf1,0x05,0x59,0xac,0x0b,0x00,0x00,0x06,0x50,0xb8,0x00,
-0x02,0xe7,0x5b,0x4b,0x13,0xbc,0xb0,0xb0,0x34,0x40,0xa2,0x30,0x22,0x10,0xb0,0x48,
-0x32,0x02,0x3e,0x03,0x00,0xca,0x27,0xf0,0x0d,0x92,0x02,0x66,0xc6,0x65,0x00,0x12,
-0x2b,0x32,0x20,0x19,0x9c,0xdc,0x99,0x50,0x08,0x90,0x92,0xa1,0x2a,0xa3,0x03,0xd1,
-0x00,0x08,0x89,0x44,0xd5,0x00,0x4c,0x01,0xe9,0x0b,0xf1,0x16,0x05,0x88,0x8c,0x88,
-0x81,0x02,0x88,0x88,0x80,0x03,0x89,0x44,0x4b,0x51,0x27,0x83,0x33,0xb4,0x10,0x28,
-0xec,0xb8,0x20,0x05,0xc4,0x0a,0x85,0x06,0x5a,0x46,0x5b,0x50,0x00,0x86,0x30,0x06,
-0x20,0x28,0x07,0xf0,0x59,0x00,0x71,0x24,0xb4,0x40,0x09,0x9a,0x96,0xc6,0xc0,0x00,
-0x46,0xa0,0x90,0x60,0x01,0xd9,0xad,0x9a,0xa0,0x0b,0xc9,0x96,0x37,0x50,0x02,0x92,
-0x90,0xab,0x00,0x00,0x93,0x73,0xbb,0x20,0x00,0x95,0x68,0x01,0xa1,0x10,0xa0,0x06,
-0x30,0x02,0x9a,0x58,0xb9,0x81,0x03,0xd0,0x17,0x41,0x06,0x5b,0x28,0xa9,0x80,0x00,
-0x20,0xa0,0x00,0x06,0x88,0xbe,0x98,0x82,0x05,0xb5,0x18,0x75,0x05,0x4b,0x36,0x5b,
-0x40,0x01,0x95,0x20,0x05,0x20,0x6a,0xad,0xad,0xaa,0x20,0x00,0x91,0x80,0x00,0x2c,
-0xad,0xad,0x9c,0x02,0x74,0x51,0x80,0xa0,0x2a,0xa0,0x0b,0xac,0x02,0x0a,0x4e,0x60,
-0x2c,0x99,0x99,0x9c,0x02,0x70,0x82,0x1d,0xf6,0x39,0x9d,0x9d,0x99,0x50,0x88,0xd8,
-0xd8,0xa2,0x0a,0x0a,0x09,0x07,0x20,0x58,0xba,0x88,0x81,0x29,0x9d,0xa9,0xa9,0x60,
-0x0a,0x60,0x57,0x00,0x00,0x4b,0xed,0x72,0x00,0x97,0x40,0x03,0x82,0x1c,0xef,0xef,
-0xee,0x60,0xa6,0xc6,0xc7,0xa3,0x02,0x82,0xc7,0x77,0x31,0xa8,0xc9,0x66,0x80,0x07,
-0x84,0xb7,0x7b,0x02,0x85,0x0b,0xca,0x80,0x03,0x67,0x77,0x93,0x00,0x36,0x88,0x77,
-0x96,0x00,0x84,0x1c,0xf2,0x14,0x09,0x99,0xc1,0x3a,0xd8,0x90,0x27,0x10,0x09,0x09,
-0x09,0x71,0x5a,0xd9,0x90,0x97,0x10,0x3b,0x07,0x19,0x51,0x06,0x77,0x06,0xb0,0x10,
-0xa0,0x62,0x89,0x08,0x54,0x04,0x80,0x89,0x60,0xf0,0x1f,0x00,0x2d,0x00,0xf5,0x13,
-0x0a,0x99,0xb5,0x19,0xaa,0xa0,0x34,0x50,0x08,0x4a,0x09,0x45,0x04,0xe0,0xa1,0x94,
-0x53,0xdc,0x97,0x27,0x34,0x01,0x90,0x07,0xb0,0x10,0x09,0x03,0x79,0x08,0x00,0x94,
-0x70,0x98,0x1b,0x02,0x00,0xa6,0x31,0x90,0x00,0x0a,0x0a,0x1e,0x99,0x40,0xa0,0xa8,
-0x58,0xef,0x04,0xf3,0x09,0x20,0x00,0x3c,0x99,0x9c,0x10,0x03,0x70,0x90,0x81,0x00,
-0x37,0x0d,0x27,0x10,0x00,0x09,0x8a,0x03,0x41,0x9a,0x40,0xb9,0xb3,0xdf,0x27,0xf3,
-0x13,0x11,0x00,0x00,0x98,0x7c,0x60,0x08,0xe9,0xae,0xa9,0x06,0x90,0x90,0x0a,0x00,
+0x08,0x67,0xda,0x8b,0x24,0xbc,0x46,0x74,0x70,0x32,0x18,0x4b,0x16,0x00,0x00,0x50,
+0x00,0x00,0x00,0x68,0x09,0x99,0x94,0x36,0x33,0x2a,0x02,0xf1,0x03,0x3a,0xaa,0xa7,
+0x1b,0x90,0x00,0x45,0x03,0x39,0x00,0x04,0x50,0x00,0x90,0x00,0x45,0x00,0x09,0x09,
+0x00,0xf0,0x12,0x08,0xb3,0x00,0x04,0x40,0x0b,0x00,0x00,0x09,0x00,0xb0,0x00,0x59,
+0xac,0x0b,0x00,0x00,0x06,0x50,0xb8,0x00,0x02,0xe7,0x5b,0x4b,0x13,0xbc,0xb0,0xb0,
+0x34,0x40,0xa2,0x3b,0xd0,0x02,0x53,0xb0,0x00,0x00,0xa0,0x0b,0x3e,0x03,0xf0,0x15,
+0x79,0x9d,0x99,0x92,0x02,0x66,0xc6,0x65,0x00,0x12,0x2b,0x32,0x20,0x19,0x9c,0xdc,
+0x99,0x50,0x08,0x90,0x92,0xa1,0x2a,0xa3,0x03,0xd1,0x00,0x08,0x89,0x44,0xd5,0x00,
+0x65,0x00,0x00,0x30,0x7c,0x00,0xf1,0x16,0x05,0x88,0x8c,0x88,0x81,0x02,0x88,0x88,
+0x80,0x03,0x89,0x44,0x4b,0x51,0x27,0x83,0x33,0xb4,0x10,0x28,0xec,0xb8,0x20,0x05,
+0xc4,0x0a,0x85,0x06,0x5a,0x46,0x5b,0x50,0x00,0x86,0x30,0x06,0x20,0x28,0x07,0xf5,
+0xae,0x00,0x71,0x24,0xb4,0x40,0x09,0x9a,0x96,0xc6,0xc0,0x00,0x46,0xa0,0x90,0x60,
+0x01,0xd9,0xad,0x9a,0xa0,0x0b,0xc9,0x96,0x37,0x50,0x02,0x92,0x90,0xab,0x00,0x00,
+0x93,0x73,0xbb,0x20,0x00,0x95,0x68,0x01,0xa1,0x10,0xa0,0x06,0x30,0x02,0x9a,0x58,
+0xb9,0x81,0x03,0xd0,0x17,0x41,0x06,0x5b,0x28,0xa9,0x80,0x00,0x20,0xa0,0x00,0x06,
+0x88,0xbe,0x98,0x82,0x05,0xb5,0x18,0x75,0x05,0x4b,0x36,0x5b,0x40,0x01,0x95,0x20,
+0x05,0x20,0x6a,0xad,0xad,0xaa,0x20,0x00,0x91,0x80,0x00,0x2c,0xad,0xad,0x9c,0x02,
+0x74,0x51,0x80,0xa0,0x2a,0xa0,0x0b,0xac,0x02,0x80,0x00,0x00,0xa0,0x2c,0x99,0x99,
+0x9c,0x02,0x70,0x00,0x00,0xa0,0x19,0x9d,0x9d,0x99,0x50,0x88,0xd8,0xd8,0xa2,0x0a,
+0x0a,0x09,0x07,0x20,0x58,0xba,0x88,0x81,0x29,0x9d,0xa9,0xa9,0x60,0x0a,0x60,0x57,
+0x00,0x00,0x4b,0xed,0x72,0x00,0x97,0x40,0x03,0x82,0x1c,0xef,0xef,0xee,0x60,0xa6,
+0xc6,0xc7,0xa3,0x02,0x82,0xc7,0x77,0x31,0xa8,0xc9,0x66,0x80,0x07,0x84,0xb7,0x7b,
+0x02,0x85,0x0b,0xca,0x80,0x03,0x67,0x77,0x93,0x00,0x36,0x88,0x77,0x96,0x56,0x04,
+0xf1,0x15,0x00,0x09,0x09,0x99,0xc1,0x3a,0xd8,0x90,0x27,0x10,0x09,0x09,0x09,0x71,
+0x5a,0xd9,0x90,0x97,0x10,0x3b,0x07,0x19,0x51,0x06,0x77,0x06,0xb0,0x10,0xa0,0x62,
+0x89,0x08,0x54,0x04,0x80,0x89,0x11,0x03,0x20,0x01,0x10,0x2d,0x00,0xf6,0x14,0x0a,
+0x99,0xb5,0x19,0xaa,0xa0,0x34,0x50,0x08,0x4a,0x09,0x45,0x04,0xe0,0xa1,0x94,0x53,
+0xdc,0x97,0x27,0x34,0x01,0x90,0x07,0xb0,0x10,0x09,0x03,0x79,0x08,0x00,0x94,0x70,
+0x98,0x70,0x0c,0x05,0xb0,0xa0,0x90,0x00,0x0a,0x0a,0x1e,0x99,0x40,0xa0,0xa8,0x58,
+0xef,0x04,0xf2,0x09,0x20,0x00,0x3c,0x99,0x9c,0x10,0x03,0x70,0x90,0x81,0x00,0x37,
+0x0d,0x27,0x10,0x00,0x09,0x8a,0x03,0x41,0x9a,0x40,0xb9,0xb3,0x2d,0x00,0xf1,0x14,
+0x07,0x11,0x00,0x00,0x98,0x7c,0x60,0x08,0xe9,0xae,0xa9,0x06,0x90,0x90,0x0a,0x00,
 0xd9,0xd9,0x9d,0x01,0x90,0x90,0x0a,0x03,0xc9,0xd9,0x9d,0x07,0x30,0x90,0x0a,0x0a,
-0x00,0x91,0xaa,0x58,0x1a,0xf6,0x16,0x00,0x00,0x98,0x55,0xbb,0xb4,0x3c,0xaa,0x0a,
-0x27,0x35,0x97,0x89,0x66,0xc0,0x0a,0x9a,0x2b,0xb8,0x20,0x97,0x88,0x2a,0x00,0x0c,
-0xbc,0x69,0xd9,0x54,0x46,0x80,0x09,0x00,0x60,0x1a,0x00,0x90,0x86,0x00,0x10,0x64,
-0x2d,0x19,0xf6,0x14,0x87,0x01,0xb1,0x04,0xda,0x98,0x9d,0xb3,0x39,0x79,0x81,0x95,
-0x30,0xcb,0xc8,0x19,0x53,0x09,0x78,0x59,0xd9,0x20,0xbb,0xc0,0x0a,0x70,0x24,0x78,
-0x02,0xca,0x47,0x17,0xaa,0xa7,0x59,0xf6,0x29,0xf0,0x06,0x22,0x29,0x52,0x22,0x16,
-0x66,0x66,0x66,0x40,0x08,0x88,0x88,0x30,0x00,0x77,0x77,0x73,0x00,0x01,0x11,0x11,
-0x9b,0x50,0x21,0xa8,0x00,0x31,0x0a,0x00,0xfd,0x46,0x01,0x01,0x00,0xf0,0x09,0x34,
-0x80,0x45,0x00,0x0a,0x88,0x5c,0x68,0x13,0xc8,0x6a,0x4a,0x70,0x09,0x78,0x65,0xba,
-0x10,0x44,0x9b,0x73,0x54,0x02,0x88,0x37,0x07,0xe3,0x66,0x66,0x30,0x02,0xb6,0x66,
-0x6a,0x00,0x2b,0x66,0x66,0xa0,0x05,0x30,0x6a,0x41,0x01,0x28,0x1a,0x46,0xa9,0x4a,
-0xae,0xaa,0xd7,0x19,0x90,0xa4,0x00,0xa0,0x00,0x1f,0x80,0x0a,0x00,0x03,0x01,0x31,
-0x51,0x05,0x20,0x09,0x00,0x00,0xb8,0x21,0x00,0x47,0x3e,0x11,0xa7,0xc2,0x02,0xf0,
-0x07,0x0d,0x40,0x00,0x0a,0x01,0xb8,0x00,0x00,0xb6,0x64,0x91,0x00,0x4c,0x4b,0x02,
-0xa0,0x01,0x05,0x10,0x03,0x30,0x01,0x3f,0x06,0xb0,0x66,0x43,0x91,0x64,0x00,0x32,
-0x72,0x4a,0x13,0xa6,0x0a,0xfb,0x39,0x60,0x83,0x56,0x00,0x19,0x01,0xab,0x9d,0x34,
-0xc1,0x90,0x00,0x4d,0x59,0x57,0xa1,0x01,0x16,0x20,0x03,0x60,0x01,0x92,0x17,0x91,
-0x2a,0xaa,0xc0,0x00,0x40,0x00,0x0a,0x04,0xa7,0xa4,0x13,0x20,0xda,0xae,0x1a,0x0d,
-0x10,0x10,0x2a,0x1b,0x92,0x20,0x0e,0x7a,0x00,0x19,0x03,0x60,0x9a,0xac,0xa6,0x09,
-0xf0,0x16,0x57,0x09,0xa9,0x90,0x00,0x40,0xa0,0x0a,0x03,0x95,0x67,0x00,0x97,0x01,
-0x85,0x99,0x9a,0x30,0x18,0x0a,0x00,0xb0,0x01,0x94,0x2b,0xb4,0x00,0x5c,0x37,0xbb,
-0x82,0x02,0x05,0x30,0x03,0x70,0x02,0xfa,0x09,0x10,0x49,0xc1,0x47,0x51,0x23,0xad,
-0xaa,0x73,0xa7,0x75,0x3f,0xf5,0x05,0x1d,0xad,0x00,0x0a,0x02,0x70,0xa0,0x00,0xa6,
-0x63,0x0a,0x00,0x3e,0x4b,0x00,0xa0,0x03,0x27,0x51,0x98,0x6a,0x0e,0xf0,0x06,0x00,
-0x67,0x2a,0xac,0xa4,0x00,0x30,0x00,0x90,0x03,0xa7,0x06,0x09,0x00,0x00,0x90,0xa0,
-0xda,0x20,0x09,0x0a,0xfc,0x1d,0xf0,0x0c,0xa0,0x90,0x00,0x2e,0x5a,0x19,0x00,0x03,
-0x25,0x88,0x88,0x50,0x05,0x10,0x00,0xa7,0x00,0x1b,0x00,0x0a,0x36,0x00,0x17,0xaa,
-0xea,0x83,0xa6,0x47,0x13,0x30,0x94,0xa9,0x81,0x66,0x61,0xd1,0x30,0x00,0x90,0x90,
-0x55,0x10,0x2d,0x9d,0xb4,0x98,0x04,0x42,0x10,0x11,0x07,0x00,0x56,0x00,0xf2,0x00,
-0x44,0x01,0xa1,0x79,0xd6,0x20,0x01,0x10,0x0a,0x00,0x08,0xa0,0x9a,0xda,0xa3,0x58,
-0x1d,0xf2,0x2b,0x49,0xd9,0x80,0x08,0x58,0x30,0x0a,0x00,0xa9,0x74,0x11,0xb0,0x06,
-0x07,0xa8,0x8c,0x00,0x01,0x00,0x22,0x00,0x00,0x58,0x0a,0x42,0x21,0x00,0x24,0xa6,
-0x66,0xa3,0xa6,0x89,0x88,0x09,0x01,0x80,0xa2,0xa1,0x80,0x18,0x0b,0x5b,0x28,0x01,
-0xa5,0xc8,0xa3,0x60,0x3d,0x15,0x00,0x55,0x03,0x10,0x00,0x9b,0x10,0x56,0x00,0x40,
-0x40,0x04,0x10,0x58,0x0f,0x1c,0x50,0x32,0xab,0xcb,0x54,0xa7,0x8f,0x3e,0x50,0x90,
-0x9a,0xd9,0x20,0x09,0x09,0x00,0xc3,0xa6,0x9a,0xd9,0x70,0x1e,0x50,0x28,0x00,0x03,
-0x40,0x02,0x80,0xe2,0x20,0xf0,0x07,0x9b,0xc9,0x90,0x02,0x25,0xaa,0x83,0x07,0xa0,
-0x0a,0x04,0x60,0x08,0x49,0xb9,0xaa,0x30,0x81,0x59,0x99,0x70,0x08,0xf6,0x29,0x83,
-0xab,0xa1,0x00,0xa0,0x05,0x09,0x98,0x8b,0x1a,0x1a,0xf0,0x15,0x0b,0x99,0xb5,0x00,
-0x40,0xa3,0x38,0x53,0xa6,0x04,0x44,0x41,0x01,0x80,0x89,0xa8,0x40,0x18,0x38,0xab,
-0x88,0x01,0xa6,0x1b,0xb2,0x10,0x4c,0x49,0x52,0xb4,0x00,0x03,0x10,0x00,0x40,0x01,
-0x76,0x0b,0xf2,0x15,0x58,0x08,0x24,0x70,0x00,0x43,0xba,0xcb,0x03,0x97,0x45,0x00,
-0x90,0x00,0x94,0xb9,0x9d,0x00,0x09,0x04,0x6a,0x00,0x00,0xa6,0x72,0xa0,0x00,0x2f,
-0x4b,0x0a,0x07,0x04,0x3a,0x40,0x8a,0x80,0x89,0x13,0xf0,0x19,0x15,0x71,0x00,0x3a,
-0x38,0xab,0x84,0x00,0x20,0x79,0xa7,0x23,0xa6,0x47,0x9a,0x76,0x00,0x90,0x88,0x88,
-0x10,0x09,0x0b,0x44,0xa1,0x00,0x92,0xb3,0x3a,0x10,0x1e,0x5c,0x77,0xc1,0x03,0x40,
-0x90,0x5b,0x00,0x05,0x2b,0x05,0xf2,0x14,0x5a,0x19,0xbb,0x92,0x00,0x32,0x58,0x95,
-0x24,0xa6,0x15,0x45,0x75,0x00,0x82,0x56,0x93,0x00,0x08,0x08,0x29,0x00,0x00,0x97,
-0x8c,0xa8,0x60,0x1e,0x44,0xa4,0x80,0x03,0x27,0x70,0x02,0xb3,0x03,0xf0,0x12,0x77,
-0x3c,0x9b,0x9a,0x00,0x33,0x67,0xc4,0x94,0xb6,0x36,0x08,0x09,0x01,0x84,0x87,0x76,
-0x90,0x18,0x65,0xa7,0x69,0x01,0xbb,0x4b,0x87,0x90,0x2d,0xd1,0x50,0x09,0x04,0x29,
-0xdf,0x28,0x00,0xb0,0x11,0xf1,0x15,0x01,0x40,0x51,0x01,0xb3,0x9d,0x9d,0x92,0x02,
-0x15,0xa0,0x96,0x07,0xa0,0x6a,0x0a,0x60,0x08,0x58,0x88,0x88,0x40,0x80,0x88,0x88,
-0x90,0x08,0x49,0x77,0x7a,0x00,0xc8,0x98,0x88,0xa0,0x04,0x08,0x15,0x10,0x05,0xad,
-0x00,0xf0,0x01,0xc8,0x95,0x00,0x04,0xa0,0x0b,0x00,0x01,0x9d,0x99,0x99,0xa0,0x00,
-0xa0,0x70,0x0a,0x64,0x07,0xd0,0xa0,0x00,0x92,0x91,0x0a,0x00,0x15,0xa1,0x69,0x40,
-0x08,0x40,0x00,0x61,0x11,0x00,0x0c,0x09,0xf1,0x14,0xd0,0xa0,0x00,0x08,0x79,0x0c,
-0x9c,0x40,0x88,0x97,0x60,0x90,0x08,0x89,0x6a,0x18,0x00,0x88,0x90,0x78,0x30,0x05,
-0x84,0x01,0xe0,0x00,0x93,0x90,0x97,0x80,0x34,0x03,0x63,0x03,0x40,0xc7,0x15,0x30,
-0xd9,0xd0,0x0a,0x30,0x43,0xf5,0x0d,0xd9,0x80,0x88,0x90,0x0a,0x00,0x08,0x89,0x00,
-0xa0,0x00,0x89,0x97,0xa9,0x99,0x05,0xa5,0x71,0x00,0x90,0xb5,0xa8,0xa9,0x99,0x37,
-0x02,0x72,0x00,0x62,0x21,0x50,0x05,0x9d,0x94,0x99,0xb0,0x74,0x4f,0xf0,0x05,0x07,
-0x9d,0x96,0x99,0xb0,0x22,0x90,0x54,0x00,0x05,0x4c,0x97,0x50,0x52,0x68,0x90,0x2a,
-0x9a,0x08,0x9b,0x23,0x00,0x44,0x8c,0xaa,0xaa,0x31,0x2d,0x00,0xf0,0x0e,0x04,0x9d,
-0x95,0xca,0xc2,0x00,0x90,0x0a,0x09,0x16,0xad,0xaa,0x56,0x90,0x22,0x90,0x39,0x8a,
-0x04,0x5c,0x95,0x40,0xa0,0x5b,0x90,0x4a,0x8d,0x08,0x8b,0x23,0x00,0x41,0x7b,0xaa,
-0xaa,0x40,0x15,0x0a,0x00,0xdc,0x14,0x01,0x6c,0x42,0x00,0x09,0x00,0x10,0x12,0x44,
-0x22,0x50,0x60,0xd9,0x97,0x00,0x89,0xc8,0x38,0x82,0x76,0xa0,0x00,0x08,0x30,0x6b,
-0xaa,0xa3,0x6d,0x4a,0xf1,0x38,0x9c,0xba,0xaa,0x40,0x90,0x9a,0x00,0x00,0x09,0xd8,
-0xb9,0x9d,0x00,0x5a,0x2a,0x00,0x90,0x09,0xa5,0xba,0xad,0x00,0x99,0x1a,0x00,0x00,
-0x1c,0xc9,0xa1,0x11,0x02,0x40,0x06,0x88,0x85,0x0d,0x9c,0xa9,0x9d,0x00,0x90,0x9a,
-0x66,0xc0,0x09,0xd8,0x91,0x19,0x00,0x49,0x0a,0xaa,0xd0,0x08,0xa9,0x91,0x64,0x30,
-0x89,0x09,0x09,0x70,0x1c,0xc9,0xa3,0x59,0x02,0x30,0x0a,0x61,0x25,0xd4,0x09,0xf0,
-0x14,0xd9,0xc0,0xd9,0x80,0x09,0x09,0x89,0x27,0x00,0x9d,0x86,0x5b,0x00,0x05,0xa2,
-0x2b,0x98,0x00,0x8a,0x7c,0xb9,0xd6,0x08,0x90,0x53,0x0a,0x01,0xcd,0xa6,0x40,0xa0,
-0x24,0x00,0x5a,0x8d,0xa2,0x05,0xf4,0x18,0x81,0x00,0xd9,0x91,0x98,0x22,0x08,0x0a,
-0x89,0x86,0x60,0x9c,0x66,0xa8,0x90,0x03,0x80,0x09,0x83,0x00,0x7c,0x68,0x88,0xb3,
-0x07,0x84,0x67,0x82,0x60,0xad,0x77,0x28,0x15,0x35,0x14,0x70,0x5a,0x80,0x00,0x11,
-0x49,0xe0,0xc9,0xa4,0x5b,0x42,0x08,0x0c,0xa4,0x44,0xa0,0x9c,0x64,0x99,0x80,0x03,
-0x18,0x00,0xf1,0x03,0x8b,0x79,0x9d,0x97,0x08,0x80,0x61,0x96,0x11,0xbc,0x79,0x09,
-0x28,0x24,0x02,0x08,0x70,0x30,0xde,0x11,0xf3,0x13,0x0c,0x9a,0x9c,0x00,0x00,0xd7,
-0x77,0xd0,0x00,0x0b,0x11,0x1a,0x22,0x00,0xc7,0x77,0xca,0x02,0x9d,0x99,0x9d,0x10,
-0x00,0x00,0x69,0xb0,0x00,0x03,0xa5,0x0a,0x00,0x3b,0x60,0x3a,0xdf,0x2e,0x01,0x29,
-0x06,0xf0,0x02,0xa2,0x00,0x00,0x0a,0xbd,0xaa,0xaa,0x50,0x09,0x12,0x50,0x00,0x05,
-0xd9,0xbc,0x99,0x00,0x29,0x0b,0x50,0x2a,0xaa,0xbd,0xaa,0x60,0x09,0x00,0x00,0x0f,
-0x3d,0x00,0x6a,0x05,0xf0,0x03,0x60,0x04,0xad,0x97,0xad,0x92,0x07,0x10,0x07,0x20,
-0x00,0x87,0x09,0xda,0x95,0x2d,0xe9,0x0a,0x68,0x2a,0xa0,0x9a,0xe1,0x27,0xda,0x03,
-0x65,0x02,0x3a,0x00,0x8c,0xef,0x01,0x12,0x57,0x55,0x00,0xf0,0x05,0x50,0x01,0x70,
-0x03,0xbc,0x80,0x7b,0x10,0x07,0x10,0x18,0x17,0x00,0x87,0x08,0x00,0x35,0x1c,0xd9,
-0x25,0x3b,0x38,0xf0,0x07,0xca,0x20,0x16,0xda,0x2a,0x00,0x02,0x5a,0x02,0x80,0x08,
-0x00,0x90,0x0b,0x9a,0x50,0x01,0x80,0x00,0xa0,0x03,0xcd,0xf1,0x2b,0xf3,0x04,0x31,
-0x69,0xd9,0x60,0x96,0x09,0x09,0x09,0x2d,0xd9,0x90,0x90,0x90,0x08,0x1a,0x9d,0x99,
-0x39,0xc8,0x09,0x00,0x37,0x00,0x81,0x90,0x21,0x06,0xf0,0x0b,0x13,0x92,0x56,0x70,
-0x06,0x8c,0x85,0x57,0x22,0x89,0xc8,0xab,0x86,0x00,0x90,0x03,0x72,0x11,0xbd,0xaa,
-0x68,0x91,0x0a,0xac,0x92,0xb8,0x17,0x2a,0x92,0x21,0x1b,0xbe,0xa9,0xe3,0x80,0x00,
-0xa0,0xa1,0x43,0x30,0x00,0x48,0x0e,0xf1,0x15,0x01,0x5a,0x30,0x38,0x00,0x2a,0x75,
-0x99,0x99,0x40,0x86,0x05,0x60,0xa0,0x1c,0xd8,0x95,0x17,0x50,0x08,0x00,0x97,0x20,
-0x28,0xd8,0x05,0xc0,0x01,0x39,0x02,0xba,0x50,0x00,0x82,0xa1,0x08,0x63,0x20,0x00,
-0x1f,0x0e,0xf0,0x13,0x01,0x6a,0x47,0x87,0xd0,0x08,0x42,0x58,0x79,0x00,0x96,0x07,
-0x76,0x73,0x1d,0xd8,0x69,0x7c,0x00,0x08,0x06,0x41,0xa0,0x27,0xda,0x69,0x7c,0x01,
-0x39,0x1b,0xa9,0xd6,0x00,0x81,0xf3,0x05,0x02,0x9b,0x12,0xf1,0x18,0x10,0x07,0xd9,
-0x04,0x99,0x00,0x17,0x07,0xb3,0x5c,0x25,0x64,0x58,0x88,0x51,0x9b,0xc8,0x6a,0x87,
-0x00,0x36,0x78,0xb8,0x70,0x7b,0xb8,0x8b,0x87,0x00,0x35,0x71,0x81,0x70,0x03,0x57,
-0x39,0x39,0x00,0x38,0x9e,0x13,0x80,0x45,0xb4,0x40,0x00,0x16,0x8b,0x6d,0x08,0x8a,
-0x53,0xf0,0x01,0x09,0x00,0xa1,0x0a,0x00,0x90,0x39,0x00,0xa0,0x0a,0x2a,0x03,0xa7,
-0x04,0x99,0x00,0x41,0x53,0x22,0xaa,0xac,0x79,0x27,0x00,0x86,0x16,0x20,0x06,0x60,
-0x8b,0x16,0xf0,0x03,0x47,0xaa,0xad,0x80,0x00,0x00,0x20,0x19,0x00,0x2a,0x90,0xb1,
-0x19,0x00,0x00,0x90,0x24,0x19,0x0a,0x45,0xb2,0x68,0x00,0x2a,0x99,0x8b,0xc9,0x80,
-0x00,0x00,0x12,0x21,0x3d,0x0c,0xf0,0x0d,0x91,0x99,0x99,0x50,0x02,0x21,0x11,0x11,
-0x08,0x94,0x7d,0x77,0x71,0x09,0x02,0x80,0xa0,0x00,0x91,0xb3,0x39,0x50,0x09,0x29,
-0x76,0x49,0x03,0xa9,0x05,0x03,0x42,0x29,0x99,0xad,0x30,0xad,0x2e,0xf0,0x14,0xa0,
-0x18,0x00,0x04,0x80,0xa0,0x18,0x00,0x00,0x38,0xea,0xad,0x70,0x14,0x20,0xa0,0x18,
-0x00,0x16,0x98,0xea,0xad,0x90,0x00,0x91,0xa0,0x18,0x00,0x03,0xb6,0x20,0x05,0x00,
-0x0c,0xa6,0x9e,0x0b,0x44,0x07,0xa9,0x9a,0xc0,0xc6,0x36,0xf0,0x0f,0x00,0x02,0x91,
+0x00,0x91,0xaa,0x99,0x09,0x00,0x87,0x00,0xf6,0x14,0x98,0x55,0xbb,0xb4,0x3c,0xaa,
+0x0a,0x27,0x35,0x97,0x89,0x66,0xc0,0x0a,0x9a,0x2b,0xb8,0x20,0x97,0x88,0x2a,0x00,
+0x0c,0xbc,0x69,0xd9,0x54,0x46,0x80,0x09,0x00,0x60,0x1a,0x00,0x90,0x86,0x00,0xf2,
+0x19,0x64,0x00,0x0a,0x00,0x0a,0x87,0x01,0xb1,0x04,0xda,0x98,0x9d,0xb3,0x39,0x79,
+0x81,0x95,0x30,0xcb,0xc8,0x19,0x53,0x09,0x78,0x59,0xd9,0x20,0xbb,0xc0,0x0a,0x70,
+0x24,0x78,0x02,0xca,0x47,0x17,0xaa,0xa7,0x59,0x2f,0x00,0x00,0x7f,0x02,0xf1,0x0c,
+0x22,0x29,0x52,0x22,0x16,0x66,0x66,0x66,0x40,0x08,0x88,0x88,0x30,0x00,0x77,0x77,
+0x73,0x00,0x01,0x11,0x11,0x00,0x00,0xd9,0x99,0xa8,0x00,0x31,0x0a,0x32,0xc8,0x88,
+0x97,0x2c,0x00,0xf0,0x09,0x34,0x80,0x45,0x00,0x0a,0x88,0x5c,0x68,0x13,0xc8,0x6a,
+0x4a,0x70,0x09,0x78,0x65,0xba,0x10,0x44,0x9b,0x73,0x54,0x02,0x88,0x37,0x07,0xf1,
+0x05,0x66,0x66,0x30,0x02,0xb6,0x66,0x6a,0x00,0x2b,0x66,0x66,0xa0,0x05,0x30,0x00,
+0xa0,0x00,0x0a,0x10,0x0a,0x15,0x01,0x70,0x04,0xa9,0x4a,0xae,0xaa,0x00,0xa0,0x12,
+0x00,0x00,0xc0,0x04,0xf1,0x04,0xa4,0x00,0xa0,0x00,0x1f,0x80,0x0a,0x00,0x03,0x40,
+0x00,0xa0,0x00,0x05,0x20,0x09,0x00,0x00,0x1b,0xbe,0x00,0x41,0x0a,0x00,0x05,0xa7,
+0xc2,0x02,0xf0,0x07,0x0d,0x40,0x00,0x0a,0x01,0xb8,0x00,0x00,0xb6,0x64,0x91,0x00,
+0x4c,0x4b,0x02,0xa0,0x01,0x05,0x10,0x03,0x30,0x01,0x3f,0x06,0xf0,0x16,0x66,0x43,
+0x91,0x64,0x00,0x32,0x72,0x4a,0x13,0xa6,0x0a,0x00,0xa0,0x01,0x90,0x83,0x56,0x00,
+0x19,0x01,0xab,0x00,0x01,0x94,0x0b,0x90,0x00,0x4d,0x59,0x57,0xa1,0x01,0x16,0x20,
+0x03,0x60,0x01,0x74,0x00,0xb0,0x58,0x2a,0xaa,0xc0,0x00,0x40,0x00,0x0a,0x04,0xa7,
+0x00,0x79,0x00,0xf2,0x05,0xda,0xae,0x00,0x0a,0x0a,0x00,0x10,0x00,0xa0,0xa0,0x00,
+0x20,0x0e,0x7a,0x00,0x19,0x03,0x60,0x9a,0xac,0xa6,0x09,0xf0,0x16,0x57,0x09,0xa9,
+0x90,0x00,0x40,0xa0,0x0a,0x03,0x95,0x67,0x00,0x97,0x01,0x85,0x99,0x9a,0x30,0x18,
+0x0a,0x00,0xb0,0x01,0x94,0x2b,0xb4,0x00,0x5c,0x37,0xbb,0x82,0x02,0x05,0x30,0x03,
+0x70,0x02,0xfa,0x09,0xb0,0x49,0x00,0x18,0x00,0x00,0x23,0xad,0xaa,0x73,0xa7,0x00,
+0x54,0x06,0xf1,0x05,0x1d,0xad,0x00,0x0a,0x02,0x70,0xa0,0x00,0xa6,0x63,0x0a,0x00,
+0x3e,0x4b,0x00,0xa0,0x03,0x27,0x51,0x98,0x51,0x00,0x01,0x7f,0x00,0xf3,0x3e,0x67,
+0x2a,0xac,0xa4,0x00,0x30,0x00,0x90,0x03,0xa7,0x06,0x09,0x00,0x00,0x90,0xa0,0xda,
+0x20,0x09,0x0a,0x09,0x00,0x00,0xa4,0xa0,0x90,0x00,0x2e,0x5a,0x19,0x00,0x03,0x25,
+0x88,0x88,0x50,0x05,0x10,0x00,0xa7,0x00,0x1b,0x00,0x0a,0x36,0x00,0x17,0xaa,0xea,
+0x83,0xa6,0x00,0x09,0x00,0x00,0x94,0xa9,0x81,0x00,0x09,0x09,0x07,0x30,0x00,0x90,
+0x90,0x55,0x10,0x2d,0x9d,0xb4,0x98,0x04,0x42,0x10,0x09,0x70,0x56,0x00,0xf0,0x01,
+0x44,0x01,0xa1,0x79,0xd6,0x20,0x01,0x10,0x0a,0x00,0x08,0xa0,0x9a,0xda,0xa3,0x08,
+0x5d,0x01,0xf2,0x2c,0x81,0x49,0xd9,0x80,0x08,0x58,0x30,0x0a,0x00,0xa9,0x74,0x11,
+0xb0,0x06,0x07,0xa8,0x8c,0x00,0x01,0x00,0x22,0x00,0x00,0x58,0x0a,0x42,0x21,0x00,
+0x24,0xa6,0x66,0xa3,0xa6,0x89,0x88,0x09,0x01,0x80,0xa2,0xa1,0x80,0x18,0x0b,0x5b,
+0x28,0x01,0xa5,0xc8,0xa3,0x60,0x3d,0x15,0x00,0x55,0x03,0x10,0x00,0x9b,0x10,0x56,
+0x00,0xf0,0x07,0x40,0x04,0x10,0x58,0x04,0x60,0xb0,0x00,0x32,0xab,0xcb,0x54,0xa7,
+0x00,0x28,0x00,0x00,0x90,0x9a,0xd9,0x20,0x09,0x09,0x00,0xc2,0xa6,0x9a,0xd9,0x70,
+0x1e,0x50,0x28,0x00,0x03,0x40,0x02,0x80,0xd9,0x00,0xf2,0x14,0xa1,0x9b,0xc9,0x90,
+0x02,0x25,0xaa,0x83,0x07,0xa0,0x0a,0x04,0x60,0x08,0x49,0xb9,0xaa,0x30,0x81,0x59,
+0x99,0x70,0x08,0x3b,0x00,0x0a,0x00,0xab,0xa1,0x00,0xa0,0x05,0x09,0x98,0x8b,0x25,
+0x02,0xf0,0x16,0x76,0x0b,0x99,0xb5,0x00,0x40,0xa3,0x38,0x53,0xa6,0x04,0x44,0x41,
+0x01,0x80,0x89,0xa8,0x40,0x18,0x38,0xab,0x88,0x01,0xa6,0x1b,0xb2,0x10,0x4c,0x49,
+0x52,0xb4,0x00,0x03,0x10,0x00,0x40,0x01,0x76,0x0b,0xf1,0x14,0x58,0x08,0x24,0x70,
+0x00,0x43,0xba,0xcb,0x03,0x97,0x45,0x00,0x90,0x00,0x94,0xb9,0x9d,0x00,0x09,0x04,
+0x6a,0x00,0x00,0xa6,0x72,0xa0,0x00,0x2f,0x4b,0x0a,0x07,0x04,0x3a,0x40,0x8a,0x7c,
+0x00,0xf0,0x1b,0x05,0x00,0x15,0x71,0x00,0x3a,0x38,0xab,0x84,0x00,0x20,0x79,0xa7,
+0x23,0xa6,0x47,0x9a,0x76,0x00,0x90,0x88,0x88,0x10,0x09,0x0b,0x44,0xa1,0x00,0x92,
+0xb3,0x3a,0x10,0x1e,0x5c,0x77,0xc1,0x03,0x40,0x90,0x5b,0x00,0x05,0x2b,0x05,0xf2,
+0x14,0x5a,0x19,0xbb,0x92,0x00,0x32,0x58,0x95,0x24,0xa6,0x15,0x45,0x75,0x00,0x82,
+0x56,0x93,0x00,0x08,0x08,0x29,0x00,0x00,0x97,0x8c,0xa8,0x60,0x1e,0x44,0xa4,0x80,
+0x03,0x27,0x70,0x02,0xb3,0x03,0xf1,0x14,0x77,0x3c,0x9b,0x9a,0x00,0x33,0x67,0xc4,
+0x94,0xb6,0x36,0x08,0x09,0x01,0x84,0x87,0x76,0x90,0x18,0x65,0xa7,0x69,0x01,0xbb,
+0x4b,0x87,0x90,0x2d,0xd1,0x50,0x09,0x04,0x29,0x00,0x09,0x7f,0x00,0xf0,0x17,0x11,
+0x01,0x40,0x51,0x01,0xb3,0x9d,0x9d,0x92,0x02,0x15,0xa0,0x96,0x07,0xa0,0x6a,0x0a,
+0x60,0x08,0x58,0x88,0x88,0x40,0x80,0x88,0x88,0x90,0x08,0x49,0x77,0x7a,0x00,0xc8,
+0x98,0x88,0xa0,0x04,0x09,0xc1,0x01,0x10,0x05,0xad,0x00,0xf0,0x01,0xc8,0x95,0x00,
+0x04,0xa0,0x0b,0x00,0x01,0x9d,0x99,0x99,0xa0,0x00,0xa0,0x70,0x0a,0x64,0x07,0xf2,
+0x00,0xa0,0x00,0x92,0x91,0x0a,0x00,0x15,0xa1,0x69,0x40,0x08,0x40,0x00,0x06,0x30,
+0x0c,0x09,0xf0,0x15,0xd0,0xa0,0x00,0x08,0x79,0x0c,0x9c,0x40,0x88,0x97,0x60,0x90,
+0x08,0x89,0x6a,0x18,0x00,0x88,0x90,0x78,0x30,0x05,0x84,0x01,0xe0,0x00,0x93,0x90,
+0x97,0x80,0x34,0x03,0x63,0x03,0x40,0x00,0xbf,0x02,0xf4,0x15,0xd9,0xd0,0x0a,0x00,
+0x08,0x79,0x00,0xd9,0x80,0x88,0x90,0x0a,0x00,0x08,0x89,0x00,0xa0,0x00,0x89,0x97,
+0xa9,0x99,0x05,0xa5,0x71,0x00,0x90,0xb5,0xa8,0xa9,0x99,0x37,0x02,0x72,0x00,0x90,
+0xde,0x04,0xf0,0x0e,0x05,0x9d,0x94,0x99,0xb0,0x00,0x90,0x00,0x0a,0x07,0x9d,0x96,
+0x99,0xb0,0x22,0x90,0x54,0x00,0x05,0x4c,0x97,0x50,0x52,0x68,0x90,0x2a,0x9a,0x08,
+0x9b,0x23,0x00,0x44,0x8c,0xaa,0xaa,0x31,0x2d,0x00,0xf0,0x0e,0x04,0x9d,0x95,0xca,
+0xc2,0x00,0x90,0x0a,0x09,0x16,0xad,0xaa,0x56,0x90,0x22,0x90,0x39,0x8a,0x04,0x5c,
+0x95,0x40,0xa0,0x5b,0x90,0x4a,0x8d,0x08,0x8b,0x23,0x00,0x41,0x7b,0xaa,0xaa,0x40,
+0x15,0x0a,0x31,0xaa,0xaa,0xaa,0xf7,0x02,0x01,0x09,0x00,0xf1,0x07,0x12,0x0a,0x00,
+0x00,0x05,0x60,0xd9,0x97,0x00,0x89,0x0a,0x00,0x00,0x1b,0x76,0xa0,0x00,0x08,0x30,
+0x6b,0xaa,0xa3,0x55,0x00,0xf1,0x39,0x0d,0x9c,0xba,0xaa,0x40,0x90,0x9a,0x00,0x00,
+0x09,0xd8,0xb9,0x9d,0x00,0x5a,0x2a,0x00,0x90,0x09,0xa5,0xba,0xad,0x00,0x99,0x1a,
+0x00,0x00,0x1c,0xc9,0xa1,0x11,0x02,0x40,0x06,0x88,0x85,0x0d,0x9c,0xa9,0x9d,0x00,
+0x90,0x9a,0x66,0xc0,0x09,0xd8,0x91,0x19,0x00,0x49,0x0a,0xaa,0xd0,0x08,0xa9,0x91,
+0x64,0x30,0x89,0x09,0x09,0x70,0x1c,0xc9,0xa3,0x59,0x02,0x30,0x0a,0x61,0x25,0xd4,
+0x09,0xf0,0x14,0xd9,0xc0,0xd9,0x80,0x09,0x09,0x89,0x27,0x00,0x9d,0x86,0x5b,0x00,
+0x05,0xa2,0x2b,0x98,0x00,0x8a,0x7c,0xb9,0xd6,0x08,0x90,0x53,0x0a,0x01,0xcd,0xa6,
+0x40,0xa0,0x24,0x00,0x5a,0x8d,0xa2,0x05,0xf2,0x16,0x81,0x00,0xd9,0x91,0x98,0x22,
+0x08,0x0a,0x89,0x86,0x60,0x9c,0x66,0xa8,0x90,0x03,0x80,0x09,0x83,0x00,0x7c,0x68,
+0x88,0xb3,0x07,0x84,0x67,0x82,0x60,0xad,0x77,0x28,0x15,0x35,0x14,0x70,0x5a,0xc4,
+0x02,0x00,0xc9,0x03,0xe0,0xc9,0xa4,0x5b,0x42,0x08,0x0c,0xa4,0x44,0xa0,0x9c,0x64,
+0x99,0x80,0x03,0x18,0x00,0xf5,0x2d,0x8b,0x79,0x9d,0x97,0x08,0x80,0x61,0x96,0x11,
+0xbc,0x79,0x09,0x28,0x24,0x02,0x08,0x70,0x30,0x00,0x00,0x80,0x00,0x00,0x0c,0x9a,
+0x9c,0x00,0x00,0xd7,0x77,0xd0,0x00,0x0b,0x11,0x1a,0x22,0x00,0xc7,0x77,0xca,0x02,
+0x9d,0x99,0x9d,0x10,0x00,0x00,0x69,0xb0,0x00,0x03,0xa5,0x0a,0x00,0x3b,0x60,0x3a,
+0xb0,0x00,0x00,0x29,0x06,0xf0,0x02,0xa2,0x00,0x00,0x0a,0xbd,0xaa,0xaa,0x50,0x09,
+0x12,0x50,0x00,0x05,0xd9,0xbc,0x99,0x00,0x29,0x0b,0xe0,0x2a,0xaa,0xbd,0xaa,0x60,
+0x00,0x03,0x70,0x00,0x00,0x00,0x37,0x00,0x00,0xf0,0x1a,0x00,0x50,0x00,0x60,0x04,
+0xad,0x97,0xad,0x92,0x07,0x10,0x07,0x20,0x00,0x87,0x09,0xda,0x95,0x2d,0xe9,0x0a,
+0x00,0x00,0x0a,0x02,0x9a,0xe1,0x27,0xda,0x03,0x65,0x02,0x3a,0x00,0x8c,0x00,0x00,
+0xa0,0x00,0x57,0x00,0x01,0x00,0xf3,0x37,0x01,0x50,0x01,0x70,0x03,0xbc,0x80,0x7b,
+0x10,0x07,0x10,0x18,0x17,0x00,0x87,0x08,0x00,0x35,0x1c,0xd9,0x25,0x07,0x20,0x09,
+0x02,0xca,0x20,0x16,0xda,0x2a,0x00,0x02,0x5a,0x02,0x80,0x08,0x00,0x90,0x0b,0x9a,
+0x50,0x01,0x80,0x00,0xa0,0x03,0xcd,0xa0,0x0a,0x00,0x08,0x31,0x69,0xd9,0x60,0x96,
+0x09,0x09,0x09,0x2d,0xd9,0x90,0x90,0x90,0x08,0x1a,0x9d,0x99,0x39,0xc8,0x09,0x00,
+0x64,0x00,0x81,0x90,0x00,0x90,0x00,0x01,0x00,0xf2,0x19,0x13,0x92,0x56,0x70,0x06,
+0x8c,0x85,0x57,0x22,0x89,0xc8,0xab,0x86,0x00,0x90,0x03,0x72,0x11,0xbd,0xaa,0x68,
+0x91,0x0a,0xac,0x92,0xb8,0x00,0x00,0xa0,0x0c,0x21,0x1b,0xbe,0xa9,0xe3,0x80,0x00,
+0xa0,0xa1,0xb7,0x2e,0x00,0xf2,0x19,0x20,0x01,0x10,0x01,0x5a,0x30,0x38,0x00,0x2a,
+0x75,0x99,0x99,0x40,0x86,0x05,0x60,0xa0,0x1c,0xd8,0x95,0x17,0x50,0x08,0x00,0x97,
+0x20,0x28,0xd8,0x05,0xc0,0x01,0x39,0x02,0xba,0x50,0x00,0x82,0xa1,0x08,0x50,0x2d,
+0x00,0xf1,0x17,0x00,0x00,0x01,0x6a,0x47,0x87,0xd0,0x08,0x42,0x58,0x79,0x00,0x96,
+0x07,0x76,0x73,0x1d,0xd8,0x69,0x7c,0x00,0x08,0x06,0x41,0xa0,0x27,0xda,0x69,0x7c,
+0x01,0x39,0x1b,0xa9,0xd6,0x00,0x81,0x20,0x09,0x2c,0x00,0xf1,0x42,0x06,0x00,0x06,
+0x10,0x07,0xd9,0x04,0x99,0x00,0x17,0x07,0xb3,0x5c,0x25,0x64,0x58,0x88,0x51,0x9b,
+0xc8,0x6a,0x87,0x00,0x36,0x78,0xb8,0x70,0x7b,0xb8,0x8b,0x87,0x00,0x35,0x71,0x81,
+0x70,0x03,0x57,0x39,0x39,0x00,0x38,0x00,0x0a,0x00,0x00,0x94,0x45,0xb4,0x40,0x00,
+0x16,0x8b,0x6d,0x08,0xa0,0x06,0x40,0xa0,0x09,0x00,0xa1,0x0a,0x00,0x90,0x39,0x00,
+0xa0,0x0a,0x2a,0x03,0xa7,0x04,0x99,0x00,0x00,0x00,0xa0,0x3a,0xaa,0xac,0x83,0x00,
+0xf1,0x1d,0x07,0x00,0x00,0x19,0x00,0x06,0x60,0x00,0x19,0x00,0x00,0x47,0xaa,0xad,
+0x80,0x00,0x00,0x20,0x19,0x00,0x2a,0x90,0xb1,0x19,0x00,0x00,0x90,0x24,0x19,0x00,
+0x01,0x90,0x04,0x68,0x00,0x2a,0x99,0x8b,0xc9,0x80,0x00,0x00,0x12,0x21,0x87,0x00,
+0xf0,0x16,0x03,0x91,0x99,0x99,0x50,0x02,0x21,0x11,0x11,0x08,0x94,0x7d,0x77,0x71,
+0x09,0x02,0x80,0xa0,0x00,0x91,0xb3,0x39,0x50,0x09,0x29,0x76,0x49,0x03,0xa9,0x00,
+0x00,0x00,0x90,0x29,0x99,0xad,0x30,0x29,0x00,0xf3,0x20,0x09,0x00,0xa0,0x18,0x00,
+0x04,0x80,0xa0,0x18,0x00,0x00,0x38,0xea,0xad,0x70,0x14,0x20,0xa0,0x18,0x00,0x16,
+0x98,0xea,0xad,0x90,0x00,0x91,0xa0,0x18,0x00,0x03,0xb6,0x20,0x05,0x00,0x0c,0xa6,
+0x00,0x00,0x00,0x36,0x07,0xa9,0x9a,0xc0,0x00,0x00,0x10,0x01,0xf3,0x13,0x02,0x91,
 0x5d,0x65,0x50,0x05,0x36,0x96,0x33,0x04,0x50,0xb4,0xc3,0x30,0x3b,0x05,0x5c,0x54,
-0x00,0x93,0x77,0xd7,0x71,0x09,0x11,0x1b,0x11,0x03,0xb7,0xf7,0x0f,0x13,0x4a,0xb9,
-0x00,0x01,0x39,0x06,0xf2,0x3d,0x84,0x0d,0xaa,0xe0,0x00,0x50,0xb0,0x0a,0x00,0x10,
-0x0e,0x99,0xd0,0x29,0x91,0xa3,0x51,0x00,0x19,0x47,0x0a,0x30,0x01,0x9a,0x10,0x0b,
-0x10,0x9b,0x71,0x00,0x31,0x24,0x04,0x89,0x99,0x40,0x06,0x00,0x0a,0x44,0x00,0x85,
-0x22,0xb2,0x91,0x00,0x37,0x9f,0xa8,0x32,0x85,0x07,0xda,0x10,0x01,0x91,0x9a,0x1a,
-0x00,0x0a,0xa1,0xa0,0x43,0x02,0xb0,0x08,0x00,0x00,0xb7,0x91,0x00,0x12,0x23,0x02,
-0x89,0x99,0xe1,0x06,0xf2,0x15,0x92,0x5b,0x88,0xc0,0x00,0x55,0x96,0x6b,0x02,0x85,
-0x5a,0x88,0xc0,0x02,0x85,0x46,0x29,0x30,0x18,0x54,0x3b,0x60,0x01,0x98,0xa4,0x09,
-0x20,0x98,0x30,0x00,0x00,0x35,0x06,0x99,0x9b,0xb0,0x08,0x01,0xf0,0x03,0x10,0x32,
-0x05,0x70,0x28,0x0a,0x00,0x05,0x49,0x9d,0x99,0x23,0x40,0x80,0xa0,0x90,0x3b,0x19,
-0x84,0x08,0xf1,0x01,0x9a,0xd9,0x70,0x09,0x10,0x93,0x00,0x01,0xb7,0xa6,0x00,0x00,
-0x81,0x39,0x99,0x9b,0x56,0x00,0xf6,0x19,0x42,0x03,0x3a,0x00,0x01,0xb0,0x9a,0xd8,
-0x81,0x02,0x2a,0x1a,0x11,0x00,0x01,0x55,0xc5,0x52,0x7d,0x24,0xc6,0xb4,0x20,0x90,
-0x28,0x19,0x04,0x09,0x5b,0x10,0xca,0x60,0xda,0x00,0x00,0x00,0x83,0x2a,0x99,0xab,
-0x1b,0x09,0xf2,0x19,0x09,0x24,0xb9,0xbc,0x30,0x00,0x44,0x9e,0xe8,0x40,0x15,0x28,
-0x2a,0x21,0x90,0x27,0x88,0x7c,0x76,0x90,0x01,0x88,0x8c,0x87,0x90,0x01,0x88,0x09,
-0x00,0x90,0x06,0x86,0x04,0x28,0x20,0x36,0x06,0x88,0x9a,0xb0,0x79,0x19,0x00,0xf1,
-0x01,0xf1,0x0e,0x85,0x9a,0xea,0xa4,0x00,0x34,0x7d,0x77,0x02,0x74,0x90,0xa0,0x90,
-0x14,0x98,0x8d,0x8c,0x00,0x09,0x07,0xd8,0x30,0x00,0xa7,0x2a,0x06,0x10,0x86,0x40,
-0xb9,0x00,0x17,0x9c,0x5f,0x00,0xf4,0x17,0x18,0x8c,0xc8,0xa0,0x00,0x68,0x49,0x93,
-0x90,0x15,0x32,0x6b,0x44,0x30,0x14,0x91,0xa8,0x8d,0x10,0x00,0x95,0x39,0x78,0x00,
-0x00,0x90,0x5b,0x70,0x00,0x09,0xa8,0x71,0x00,0x00,0x55,0x08,0xa9,0x9a,0xdb,0x1e,
-0xf0,0x0b,0x70,0x25,0x00,0x93,0x8c,0x9c,0xa6,0x00,0x30,0x2b,0x32,0x01,0x63,0x49,
-0x66,0xc0,0x15,0x94,0xa7,0x7c,0x00,0x09,0x49,0x66,0xc0,0x00,0x09,0x00,0x93,0x9b,
-0x30,0x00,0x00,0x36,0x08,0x99,0x9a,0x90,0x2f,0x03,0xf0,0x0f,0x54,0x03,0x92,0xa7,
-0x73,0x40,0x03,0x28,0x27,0x71,0x06,0x82,0xb8,0xa7,0x50,0x09,0x59,0x8d,0x88,0x20,
-0x90,0x60,0xa0,0x70,0x09,0x1c,0x8d,0x8a,0x02,0xc9,0x8f,0x1b,0x44,0x29,0x99,0x9b,
-0x30,0xab,0x51,0xf3,0x13,0x03,0x9d,0xa8,0x7a,0xd0,0x08,0x05,0x47,0x19,0x01,0x65,
-0xa2,0x86,0x40,0x48,0x88,0x88,0x28,0x00,0x99,0x96,0x70,0x90,0x18,0x00,0xa7,0x4b,
-0x01,0xd9,0x9a,0x73,0x10,0x18,0x00,0x4c,0x09,0xf0,0x0d,0x29,0xcc,0x78,0xaa,0xa0,
-0x8c,0xc5,0x00,0x0a,0x08,0x56,0x83,0x44,0xa0,0x85,0x68,0xb6,0x6a,0x0b,0x05,0x8a,
-0x00,0x10,0xc7,0x78,0xa0,0x03,0x0c,0x9e,0x53,0xf1,0x1e,0x80,0x08,0x7a,0xa9,0x00,
-0x00,0x01,0x35,0x00,0x8a,0xaa,0x86,0x50,0x03,0x30,0xa0,0x0b,0x00,0x0a,0x09,0x07,
-0x40,0x29,0xa9,0xc9,0xd9,0x60,0x11,0x9e,0xc2,0x10,0x00,0x78,0xa2,0xb1,0x01,0xa8,
-0x0a,0x03,0xc5,0x14,0x00,0xa0,0x01,0x40,0xf9,0x48,0xf6,0x0c,0x8c,0x46,0xc9,0xc6,
-0x17,0x98,0x08,0x5a,0x00,0x5a,0x40,0x8d,0x60,0x28,0xf8,0x93,0x44,0x80,0x8b,0x94,
-0x7d,0x72,0x46,0x90,0x89,0xd9,0x60,0x5e,0x27,0xf0,0x11,0x00,0x02,0x33,0x00,0x48,
+0x00,0x93,0x77,0xd7,0x71,0x09,0x11,0x1b,0x11,0x03,0xb7,0x00,0x90,0x00,0xa0,0x4a,
+0xb9,0x00,0x10,0x01,0x05,0x00,0xf1,0x3e,0x84,0x0d,0xaa,0xe0,0x00,0x50,0xb0,0x0a,
+0x00,0x10,0x0e,0x99,0xd0,0x29,0x91,0xa3,0x51,0x00,0x19,0x47,0x0a,0x30,0x01,0x9a,
+0x10,0x0b,0x10,0x9b,0x71,0x00,0x31,0x24,0x04,0x89,0x99,0x40,0x06,0x00,0x0a,0x44,
+0x00,0x85,0x22,0xb2,0x91,0x00,0x37,0x9f,0xa8,0x32,0x85,0x07,0xda,0x10,0x01,0x91,
+0x9a,0x1a,0x00,0x0a,0xa1,0xa0,0x43,0x02,0xb0,0x08,0x00,0x00,0xb7,0x91,0x00,0x12,
+0x23,0x02,0x89,0x99,0x40,0x82,0x00,0xf2,0x15,0x92,0x5b,0x88,0xc0,0x00,0x55,0x96,
+0x6b,0x02,0x85,0x5a,0x88,0xc0,0x02,0x85,0x46,0x29,0x30,0x18,0x54,0x3b,0x60,0x01,
+0x98,0xa4,0x09,0x20,0x98,0x30,0x00,0x00,0x35,0x06,0x99,0x9b,0xb0,0x08,0x01,0xf1,
+0x17,0x10,0x32,0x05,0x70,0x28,0x0a,0x00,0x05,0x49,0x9d,0x99,0x23,0x40,0x80,0xa0,
+0x90,0x3b,0x19,0x0a,0x0a,0x00,0x91,0x9a,0xd9,0x70,0x09,0x10,0x93,0x00,0x01,0xb7,
+0xa6,0x00,0x00,0x81,0x39,0x99,0x9b,0x56,0x00,0xf5,0x1a,0x42,0x03,0x3a,0x00,0x01,
+0xb0,0x9a,0xd8,0x81,0x02,0x2a,0x1a,0x11,0x00,0x01,0x55,0xc5,0x52,0x7d,0x24,0xc6,
+0xb4,0x20,0x90,0x28,0x19,0x04,0x09,0x5b,0x10,0xca,0x60,0xda,0x00,0x00,0x00,0x83,
+0x2a,0x99,0xab,0x70,0x74,0x02,0xf2,0x18,0x09,0x24,0xb9,0xbc,0x30,0x00,0x44,0x9e,
+0xe8,0x40,0x15,0x28,0x2a,0x21,0x90,0x27,0x88,0x7c,0x76,0x90,0x01,0x88,0x8c,0x87,
+0x90,0x01,0x88,0x09,0x00,0x90,0x06,0x86,0x04,0x28,0x20,0x36,0x06,0x88,0x9a,0x8b,
+0x00,0x10,0x05,0xf1,0x01,0xf1,0x0e,0x85,0x9a,0xea,0xa4,0x00,0x34,0x7d,0x77,0x02,
+0x74,0x90,0xa0,0x90,0x14,0x98,0x8d,0x8c,0x00,0x09,0x07,0xd8,0x30,0x00,0xa7,0x2a,
+0x06,0x10,0x86,0x40,0xb9,0x00,0x17,0x9c,0x5f,0x00,0xf3,0x16,0x18,0x8c,0xc8,0xa0,
+0x00,0x68,0x49,0x93,0x90,0x15,0x32,0x6b,0x44,0x30,0x14,0x91,0xa8,0x8d,0x10,0x00,
+0x95,0x39,0x78,0x00,0x00,0x90,0x5b,0x70,0x00,0x09,0xa8,0x71,0x00,0x00,0x55,0x08,
+0xa9,0x5f,0x00,0xf0,0x0d,0x02,0x00,0x70,0x25,0x00,0x93,0x8c,0x9c,0xa6,0x00,0x30,
+0x2b,0x32,0x01,0x63,0x49,0x66,0xc0,0x15,0x94,0xa7,0x7c,0x00,0x09,0x49,0x66,0xc0,
+0x00,0x09,0x00,0x93,0x9b,0x30,0x00,0x00,0x36,0x08,0x99,0x9a,0x90,0x2f,0x03,0xf1,
+0x17,0x54,0x03,0x92,0xa7,0x73,0x40,0x03,0x28,0x27,0x71,0x06,0x82,0xb8,0xa7,0x50,
+0x09,0x59,0x8d,0x88,0x20,0x90,0x60,0xa0,0x70,0x09,0x1c,0x8d,0x8a,0x02,0xc9,0x00,
+0x00,0x00,0x91,0x29,0x99,0x9b,0x30,0x2c,0x00,0xf2,0x17,0x40,0x00,0x00,0x03,0x9d,
+0xa8,0x7a,0xd0,0x08,0x05,0x47,0x19,0x01,0x65,0xa2,0x86,0x40,0x48,0x88,0x88,0x28,
+0x00,0x99,0x96,0x70,0x90,0x18,0x00,0xa7,0x4b,0x01,0xd9,0x9a,0x73,0x10,0x18,0x00,
+0x97,0x58,0x00,0xf0,0x62,0x29,0xcc,0x78,0xaa,0xa0,0x8c,0xc5,0x00,0x0a,0x08,0x56,
+0x83,0x44,0xa0,0x85,0x68,0xb6,0x6a,0x0b,0x05,0x8a,0x00,0x10,0xc7,0x78,0xa0,0x03,
+0x0c,0x88,0x8a,0x00,0x90,0x80,0x08,0x7a,0xa9,0x00,0x00,0x01,0x35,0x00,0x8a,0xaa,
+0x86,0x50,0x03,0x30,0xa0,0x0b,0x00,0x0a,0x09,0x07,0x40,0x29,0xa9,0xc9,0xd9,0x60,
+0x11,0x9e,0xc2,0x10,0x00,0x78,0xa2,0xb1,0x01,0xa8,0x0a,0x03,0xc5,0x14,0x00,0xa0,
+0x01,0x40,0x00,0x24,0x00,0x00,0x02,0x8c,0x46,0xc9,0xc6,0x17,0x98,0x08,0x5a,0x00,
+0x5a,0x40,0x8d,0x60,0x28,0xf8,0x93,0x44,0x80,0x8b,0x94,0x7d,0x72,0x46,0x90,0x89,
+0xd9,0x60,0x09,0x00,0x0a,0x00,0x6e,0x02,0x00,0xff,0x00,0xf0,0x0e,0x33,0x00,0x48,
 0x8d,0x64,0x20,0x28,0x88,0xd8,0x88,0x50,0x49,0x7d,0x77,0xa0,0x05,0xa7,0xc7,0x7b,
-0x00,0x49,0x7c,0x77,0xa0,0x05,0x88,0xd8,0x88,0x10,0x00,0x5a,0x4a,0x00,0x0c,0x11,
-0x91,0x02,0xec,0xcc,0xc9,0x00,0x2a,0x66,0x67,0x80,0x88,0x29,0xf0,0x09,0x48,0x6a,
-0x66,0x90,0x05,0x96,0xc6,0x6b,0x00,0x27,0x6c,0x76,0x60,0x04,0x77,0xc7,0x77,0x02,
-0x88,0x8c,0x88,0x86,0x00,0x0a,0xba,0x3e,0xf2,0x13,0xa3,0xe9,0x95,0x0a,0x0a,0x92,
-0x72,0x00,0x00,0x98,0x94,0x20,0x2b,0xbb,0x88,0xba,0x70,0x10,0x1a,0x21,0x00,0x04,
-0xa8,0xd8,0xa8,0x00,0x08,0x2a,0x0a,0x00,0x18,0xa9,0xd9,0xd8,0x1d,0x04,0x63,0x63,
-0x00,0x0a,0x00,0x0d,0xcb,0xa4,0x44,0xb4,0x08,0xc6,0x88,0xd8,0x50,0x0a,0x02,0x2b,
-0x21,0x39,0xd8,0x19,0x0a,0x81,0xc9,0x00,0xa0,0x00,0x39,0x10,0x0a,0x00,0x83,0x3b,
-0xf2,0x0e,0xcc,0xa0,0x0a,0x00,0x56,0x00,0x9c,0xec,0x70,0x7c,0x69,0x0a,0x09,0x01,
-0xa1,0x90,0xa0,0x92,0x8d,0x7b,0xae,0xa9,0x00,0xa0,0x30,0xa0,0x20,0x0c,0xa0,0xc6,
-0x14,0x02,0x1b,0x0b,0xf0,0x05,0xa6,0x59,0xd9,0xd0,0x38,0x32,0x0a,0x0a,0x00,0x7c,
-0x50,0xa0,0xa0,0x00,0x90,0xae,0xac,0x01,0x9d,0x70,0xc5,0x1c,0xc2,0x28,0x0a,0x00,
-0x0b,0x84,0x50,0xa0,0x03,0xa5,0xcc,0xbd,0x60,0xb2,0x38,0xf0,0x22,0x40,0xa1,0x20,
-0xcb,0xa7,0x3a,0x81,0x55,0x00,0x25,0xb6,0x00,0x7c,0x6a,0x77,0xa4,0x00,0x90,0xa0,
-0x95,0x41,0x9d,0x8a,0x09,0x54,0x00,0x90,0xa3,0x75,0x40,0x1d,0x84,0xb6,0x81,0x03,
-0x33,0x60,0x02,0x60,0x05,0x40,0x09,0x09,0x00,0xcb,0x86,0xd8,0xd5,0x46,0x35,0x0a,
-0xf2,0x33,0x8d,0x79,0xd9,0xd8,0x01,0xa1,0x24,0x44,0x11,0x7c,0x77,0x64,0x84,0x00,
-0x90,0x79,0x8b,0x40,0x0d,0x97,0x20,0x64,0x03,0x70,0x79,0x8a,0x40,0x08,0x02,0x20,
-0x91,0x02,0xeb,0x6b,0x5c,0xb3,0x71,0x01,0x78,0xca,0x62,0xc9,0x63,0x1a,0x63,0x07,
-0x15,0xc4,0xb6,0x14,0xc8,0x69,0x5c,0x71,0x07,0x35,0x88,0xc8,0x30,0x8a,0x77,0x21,
-0x00,0x08,0x18,0x07,0x4e,0x30,0xf3,0x1a,0x03,0x20,0x01,0x40,0x00,0xaa,0x67,0xb9,
-0xc4,0x47,0x00,0x4a,0x69,0x21,0xac,0x66,0x66,0x65,0x00,0x90,0x97,0x7a,0x52,0x9d,
-0x79,0x66,0xa5,0x00,0x90,0x4c,0xc7,0x20,0x1c,0x82,0x88,0x13,0x05,0x84,0xa1,0x69,
-0x80,0x28,0x20,0xf0,0x06,0x72,0x00,0x0b,0x00,0x87,0x00,0x00,0xb2,0xc6,0x00,0x00,
-0x0b,0x12,0x00,0x00,0x7a,0xea,0xdb,0xaa,0x20,0x0b,0x18,0x58,0xd0,0xb0,0x09,0x50,
-0x00,0x0d,0x7a,0x1a,0xb1,0x01,0x72,0x00,0x03,0x10,0x8f,0x13,0x9f,0x65,0x8a,0xaa,
-0xd1,0x46,0x00,0x00,0x91,0xa0,0x04,0x00,0x02,0x30,0x1a,0xc0,0x30,0x10,0x0b,0xf0,
-0x11,0x49,0x99,0xa8,0x21,0x00,0x80,0x18,0xa5,0xaa,0xea,0x48,0xa0,0x08,0xd0,0x18,
-0xa0,0x76,0xa0,0x18,0xa9,0x50,0xa0,0x18,0xa0,0x08,0xa0,0x18,0xa0,0x00,0x02,0xa6,
-0x20,0x98,0x43,0x40,0x89,0x99,0xd0,0x26,0xae,0x0a,0x44,0xb9,0xb0,0x90,0xa0,0x02,
-0x00,0x50,0xd9,0x90,0x90,0xa0,0x00,0xca,0x23,0x21,0x09,0xc0,0xa1,0x04,0xf3,0x0b,
-0x48,0x39,0x99,0x9a,0x01,0x71,0x50,0x00,0xa0,0x91,0x1a,0x11,0x0a,0x09,0x37,0xfb,
-0x62,0xa0,0x90,0x8b,0x76,0x0a,0x09,0x74,0x90,0x70,0x49,0x58,0x43,0x00,0x6a,0x70,
-0x00,0x9e,0x48,0xf2,0x00,0x77,0x89,0x99,0xa8,0x22,0x00,0x00,0x28,0xa0,0xd8,0x98,
-0x28,0xa0,0x90,0x18,0x08,0x00,0x00,0x04,0x00,0x20,0x00,0x00,0x04,0x00,0x01,0x0a,
-0x4a,0xf0,0x0e,0xd9,0xb5,0xb9,0x99,0x92,0x66,0x40,0x09,0x95,0x26,0xb9,0x99,0x90,
-0x96,0x40,0x09,0x90,0xa7,0xb9,0x99,0x95,0x49,0x10,0x09,0x90,0x0a,0x00,0x09,0x90,
-0xc4,0x19,0x04,0xce,0x5c,0xf0,0x0d,0x0d,0xb8,0x08,0xb0,0x00,0x09,0x92,0x2a,0x48,
+0x00,0x49,0x7c,0x77,0xa0,0x05,0x88,0xd8,0x88,0x10,0x28,0x00,0x00,0x1b,0x00,0xf2,
+0x3e,0x60,0x02,0xec,0xcc,0xc9,0x00,0x2a,0x66,0x67,0x80,0x28,0x88,0x88,0x88,0x60,
+0x48,0x6a,0x66,0x90,0x05,0x96,0xc6,0x6b,0x00,0x27,0x6c,0x76,0x60,0x04,0x77,0xc7,
+0x77,0x02,0x88,0x8c,0x88,0x86,0x00,0x0a,0x09,0x00,0x00,0xa0,0xa3,0xe9,0x95,0x0a,
+0x0a,0x92,0x72,0x00,0x00,0x98,0x94,0x20,0x2b,0xbb,0x88,0xba,0x70,0x10,0x1a,0x21,
+0x00,0x04,0xa8,0xd8,0xa8,0x00,0x08,0x2a,0x0a,0x00,0x18,0xa9,0xd9,0xd8,0x1d,0x04,
+0xf0,0x0d,0x63,0x00,0x0a,0x00,0x0d,0xcb,0x00,0xa0,0x06,0x40,0x00,0x0a,0x00,0x08,
+0xc6,0x88,0xd8,0x50,0x0a,0x02,0x2b,0x21,0x39,0xd8,0x00,0xa0,0x00,0x0a,0x77,0x00,
+0xf1,0x4b,0xc9,0x00,0xa0,0x00,0x39,0x10,0x0a,0x00,0x05,0x40,0x00,0xa0,0x00,0xcc,
+0xa0,0x0a,0x00,0x56,0x00,0x9c,0xec,0x70,0x7c,0x69,0x0a,0x09,0x01,0xa1,0x90,0xa0,
+0x92,0x8d,0x7b,0xae,0xa9,0x00,0xa0,0x30,0xa0,0x20,0x0c,0xa0,0x0a,0x00,0x03,0x80,
+0x00,0xa0,0x00,0x02,0x10,0x00,0x00,0x00,0xa6,0x59,0xd9,0xd0,0x38,0x32,0x0a,0x0a,
+0x00,0x7c,0x50,0xa0,0xa0,0x00,0x90,0xae,0xac,0x01,0x9d,0x70,0x90,0xa0,0x00,0x90,
+0x28,0x0a,0x00,0x0b,0x84,0x50,0xa0,0x03,0xa5,0xcc,0xbd,0x60,0x55,0x02,0xf1,0x6b,
+0x30,0x40,0xa1,0x20,0xcb,0xa7,0x3a,0x81,0x55,0x00,0x25,0xb6,0x00,0x7c,0x6a,0x77,
+0xa4,0x00,0x90,0xa0,0x95,0x41,0x9d,0x8a,0x09,0x54,0x00,0x90,0xa3,0x75,0x40,0x1d,
+0x84,0xb6,0x81,0x03,0x33,0x60,0x02,0x60,0x05,0x40,0x09,0x09,0x00,0xcb,0x86,0xd8,
+0xd5,0x46,0x00,0x0a,0x0a,0x00,0x8d,0x79,0xd9,0xd8,0x01,0xa1,0x24,0x44,0x11,0x7c,
+0x77,0x64,0x84,0x00,0x90,0x79,0x8b,0x40,0x0d,0x97,0x20,0x64,0x03,0x70,0x79,0x8a,
+0x40,0x08,0x02,0x20,0x91,0x02,0xeb,0x6b,0x5c,0xb3,0x71,0x01,0x78,0xca,0x62,0xc9,
+0x63,0x1a,0x63,0x07,0x15,0xc4,0xb6,0x14,0xc8,0x69,0x5c,0x71,0x07,0x35,0x88,0xc8,
+0x30,0x8a,0x77,0x21,0x00,0x08,0x18,0x07,0x89,0x50,0x5f,0x03,0xf1,0x19,0x20,0x01,
+0x40,0x00,0xaa,0x67,0xb9,0xc4,0x47,0x00,0x4a,0x69,0x21,0xac,0x66,0x66,0x65,0x00,
+0x90,0x97,0x7a,0x52,0x9d,0x79,0x66,0xa5,0x00,0x90,0x4c,0xc7,0x20,0x1c,0x82,0x88,
+0x13,0x05,0x84,0xa1,0x69,0x80,0x2b,0x01,0xff,0x26,0xb0,0x00,0x72,0x00,0x0b,0x00,
+0x87,0x00,0x00,0xb2,0xc6,0x00,0x00,0x0b,0x12,0x00,0x00,0x7a,0xea,0xdb,0xaa,0x20,
+0x0b,0x03,0x90,0x00,0x00,0xb0,0x09,0x50,0x00,0x0d,0x7a,0x1a,0xb1,0x01,0x72,0x00,
+0x03,0x10,0x20,0x00,0x00,0x00,0x65,0x8a,0xaa,0xd1,0x46,0x00,0x00,0x91,0xa0,0x04,
+0x00,0x02,0x20,0x1a,0xc0,0x9a,0x02,0xf0,0x11,0x58,0x49,0x99,0xa8,0x21,0x00,0x80,
+0x18,0xa5,0xaa,0xea,0x48,0xa0,0x08,0xd0,0x18,0xa0,0x76,0xa0,0x18,0xa9,0x50,0xa0,
+0x18,0xa0,0x08,0xa0,0x18,0xa0,0x00,0x02,0xa6,0x48,0x00,0xd4,0x75,0x89,0x99,0xd0,
+0x26,0x00,0x00,0x90,0xa0,0xb9,0xb0,0x90,0xa0,0x02,0x00,0x40,0xd9,0x90,0x90,0xa0,
+0x14,0x00,0x31,0x00,0x09,0xc0,0xa1,0x04,0xf1,0x0e,0x48,0x39,0x99,0x9a,0x01,0x71,
+0x50,0x00,0xa0,0x91,0x1a,0x11,0x0a,0x09,0x37,0xfb,0x62,0xa0,0x90,0x8b,0x76,0x0a,
+0x09,0x74,0x90,0x70,0xa0,0x90,0x09,0x0f,0x02,0x23,0x6a,0x70,0x09,0x06,0xf2,0x01,
+0x00,0x77,0x89,0x99,0xa8,0x22,0x00,0x00,0x28,0xa0,0xd8,0x98,0x28,0xa0,0x90,0x18,
+0x08,0x00,0x00,0x04,0x00,0x20,0x00,0x00,0x04,0x00,0x10,0xa5,0x28,0x00,0xf2,0x12,
+0xd9,0xb5,0xb9,0x99,0x92,0x66,0x40,0x09,0x95,0x26,0xb9,0x99,0x90,0x96,0x40,0x09,
+0x90,0xa7,0xb9,0x99,0x95,0x49,0x10,0x09,0x90,0x0a,0x00,0x09,0x90,0x63,0x01,0xa6,
+0x00,0x0d,0x07,0xf3,0x1a,0x30,0x00,0x0d,0xb8,0x08,0xb0,0x00,0x09,0x92,0x2a,0x48,
 0x00,0x0b,0xb3,0xb1,0x06,0x90,0x09,0x66,0x35,0x08,0x10,0x0a,0x28,0x46,0x0a,0x00,
-0x0c,0x92,0x64,0x65,0x25,0x50,0xa2,0x0a,0x00,0x09,0x03,0xd0,0x35,0x05,0x8e,0x27,
-0xf0,0x15,0xdb,0x80,0x37,0x00,0x09,0x87,0xb9,0x99,0xa0,0xab,0x25,0x20,0x06,0x09,
-0x55,0x54,0x4a,0x10,0x91,0x85,0xb5,0x00,0x0b,0x92,0x54,0x00,0x20,0x90,0x05,0x40,
-0x0a,0x09,0x00,0x2a,0x9a,0x40,0x47,0x1d,0xf0,0x08,0xdc,0x4a,0x00,0xa0,0x98,0x3b,
-0x89,0xd7,0x99,0xaa,0x00,0xa0,0x96,0x49,0x71,0xa0,0x94,0x59,0x18,0xa0,0xa9,0x19,
-0x02,0xd0,0x00,0x51,0xa0,0x90,0x09,0x07,0xb0,0x8c,0x08,0xf6,0x13,0xdb,0x73,0xc8,
-0xa0,0x08,0x84,0xaa,0x66,0x00,0x8b,0x01,0xad,0x40,0x08,0x57,0x71,0x45,0x60,0x81,
-0x89,0x9d,0x93,0x0a,0xa3,0x90,0xa0,0x00,0x80,0x18,0x8d,0x85,0x08,0x00,0x00,0x71,
-0x5c,0xf4,0x12,0xdb,0x8c,0x99,0xd0,0x98,0x2c,0x88,0xd0,0x9a,0x09,0x00,0xa0,0x93,
-0x6c,0xa9,0xb0,0x91,0x89,0x36,0x73,0x98,0x29,0x0c,0x40,0x90,0x0a,0x46,0xa0,0x90,
-0x1d,0x70,0x67,0x00,0xad,0x54,0xf3,0x18,0x0d,0xa8,0x07,0xb2,0x00,0x08,0x82,0x86,
-0x0a,0x50,0x08,0xa2,0x79,0xb9,0x40,0x08,0x36,0x11,0xa1,0x10,0x08,0x2a,0x88,0xd8,
-0x60,0x09,0x82,0x90,0xa8,0x10,0x08,0x03,0x80,0xa1,0xa0,0x08,0x02,0x19,0x80,0x1c,
-0x34,0x00,0x34,0x0a,0xf2,0x15,0xdb,0x83,0xd9,0x92,0x08,0x91,0x80,0x0a,0x00,0x9c,
-0x63,0x32,0x50,0x08,0x47,0xa6,0x69,0x60,0x93,0x98,0x21,0x49,0x0a,0x62,0xa3,0x26,
-0x90,0x80,0x1c,0x88,0x99,0x08,0x01,0x70,0x01,0x80,0x5b,0x00,0xf7,0x17,0xc7,0x16,
-0xc6,0x60,0x08,0x93,0x68,0x73,0x30,0x08,0x90,0x2e,0xa8,0x90,0x08,0x87,0xa6,0x96,
-0x90,0x08,0x62,0x95,0x97,0x90,0x09,0xa0,0x95,0x40,0x90,0x08,0x05,0xa3,0x25,0x30,
-0x08,0x07,0x07,0x99,0x26,0x5d,0xf4,0x15,0xcb,0x89,0x99,0x96,0x08,0xa1,0x97,0x7a,
-0x40,0x9c,0x07,0x77,0x93,0x08,0x55,0xa8,0x88,0x60,0x82,0x88,0x72,0x59,0x0b,0x81,
-0x98,0xc5,0x90,0x80,0x08,0x08,0x09,0x08,0x00,0x80,0x85,0x70,0x6f,0x13,0xf5,0x12,
-0x08,0x9c,0x58,0xb8,0x70,0x82,0x78,0xd8,0xd8,0x28,0x55,0x37,0x77,0x50,0x80,0x96,
-0x86,0x6a,0x08,0x0a,0x67,0x44,0xa0,0x87,0x71,0x3b,0x32,0x08,0x00,0x88,0xd8,0x83,
-0x80,0x42,0x3e,0xf0,0x3c,0x40,0x40,0x00,0x00,0x2e,0x8b,0xa8,0x80,0x2d,0xa6,0xb8,
-0x64,0x00,0x4b,0x7b,0x87,0x40,0x03,0x72,0x94,0x22,0x00,0x2a,0x8c,0x88,0x82,0x28,
-0x8d,0xfe,0x98,0x60,0x29,0x6a,0x4b,0x50,0x3a,0x20,0xa0,0x17,0x70,0x04,0x88,0xd8,
-0x88,0x00,0x0c,0x88,0xd7,0x87,0x90,0x06,0xcb,0xa6,0xc8,0x50,0x00,0x07,0xa9,0x20,
-0x00,0x2a,0x92,0x82,0x69,0x80,0x01,0x77,0x88,0xc7,0x00,0x00,0x08,0x8b,0x40,0x00,
-0xf3,0x10,0x11,0x00,0x28,0x00,0xf2,0x10,0xc7,0x7c,0x87,0x88,0x06,0x66,0x93,0x64,
-0x50,0x27,0x77,0x47,0x50,0x16,0x66,0xc6,0x66,0x40,0x7a,0xc9,0xc9,0xc2,0x07,0x27,
-0x18,0x17,0x20,0x72,0x71,0x73,0xb0,0x5e,0x08,0xf0,0x3a,0x99,0xcb,0x99,0x20,0xaa,
-0xaa,0x8a,0x7a,0x04,0x66,0x75,0x65,0x30,0x59,0x9a,0x99,0x94,0x08,0x46,0x66,0x66,
-0x00,0xa8,0xb7,0xb7,0xa4,0x1b,0x0a,0x25,0xaa,0x03,0x33,0x85,0x20,0x34,0x02,0x70,
-0x08,0x00,0x06,0xbd,0xa6,0xbd,0x40,0x38,0xb6,0xc3,0xb2,0x06,0x9b,0x86,0xc7,0xb0,
-0x38,0x76,0x8c,0x9d,0x45,0x97,0xa1,0x92,0xa0,0x59,0x7a,0x3b,0x6a,0x05,0x40,0x90,
-0x80,0x00,0x54,0x68,0xf1,0x38,0x04,0x68,0x29,0x50,0x2a,0xac,0x0b,0xaa,0x40,0x09,
-0x00,0x50,0x1a,0xac,0x0b,0xaa,0x20,0x09,0x00,0x40,0x4a,0xac,0x0b,0xaa,0x9c,0x40,
-0x02,0x24,0x00,0x01,0xab,0x20,0xf0,0x0b,0x22,0x2c,0x22,0x20,0x0b,0x7c,0x7a,0x9a,
-0x30,0xa0,0xc8,0xb3,0x63,0x0a,0x0a,0x16,0x36,0x30,0xa0,0xb6,0xa3,0x63,0x0b,0x9d,
-0x9c,0xbc,0x07,0x45,0x10,0x63,0x87,0x05,0xf2,0x11,0x05,0xad,0xa6,0x8d,0x85,0x16,
-0xb4,0x11,0xb1,0x04,0x85,0xa5,0x9d,0x92,0x4a,0x7b,0x00,0xa0,0x02,0x9b,0x87,0x9d,
-0x9a,0x59,0xc8,0x00,0xa0,0x90,0x19,0x00,0x0a,0x95,0x70,0x11,0x00,0x12,0x1c,0x32,
-0x79,0x9c,0xa9,0xe9,0x1b,0xf1,0x00,0x9a,0xd9,0xad,0x96,0x00,0x33,0x33,0x32,0x00,
-0x0c,0x55,0x56,0x80,0x00,0xd8,0x13,0x2f,0x21,0x02,0x80,0xa4,0x0f,0xf1,0x5d,0x09,
-0x99,0xea,0x99,0x50,0x18,0x9d,0x88,0x60,0x03,0x70,0x41,0x0b,0x00,0x37,0x09,0x10,
-0xb0,0x03,0x70,0xa0,0x0b,0x00,0x24,0x2a,0x63,0x60,0x04,0x99,0x10,0x79,0x10,0x51,
-0x00,0x00,0x22,0x39,0xb8,0x89,0xd9,0x70,0x0a,0x05,0xbc,0x94,0x00,0xa0,0x81,0x43,
-0x60,0x0a,0x08,0x1a,0x36,0x00,0xa0,0x81,0xa3,0x60,0x0a,0x05,0x29,0x24,0x01,0xa0,
-0x0a,0x5b,0x11,0x83,0x09,0x20,0x27,0x45,0x57,0x9e,0x99,0x32,0xa3,0x49,0xe9,0x70,
-0x09,0x06,0x35,0x0a,0x00,0x90,0x63,0xa0,0xa0,0x09,0x68,0x3a,0x0a,0x09,0x93,0x42,
-0xa1,0x60,0x00,0x03,0xa3,0x78,0x00,0x01,0x71,0x00,0x42,0x5d,0x01,0xf3,0x17,0x96,
-0x94,0x9e,0x96,0x09,0x79,0x28,0xd8,0x30,0x97,0x94,0x64,0x46,0x09,0x79,0x45,0x93,
-0x60,0x97,0x94,0x59,0x36,0x08,0x79,0x23,0xa3,0x33,0x61,0x90,0x45,0xa0,0x62,0x09,
-0x77,0x03,0x80,0x00,0x01,0x9c,0x5e,0xf2,0x14,0x76,0x79,0xe9,0x91,0x55,0x03,0x9e,
-0x97,0x00,0x1a,0x64,0x30,0xa0,0x3a,0x15,0x49,0x0a,0x01,0x03,0x64,0xa0,0xa0,0x02,
-0xa3,0x2a,0x16,0x05,0xa1,0x19,0x48,0x80,0x20,0x08,0x20,0x04,0x1c,0x26,0xf1,0x14,
-0x99,0xd5,0x8d,0x98,0x07,0x92,0x19,0xd9,0x50,0x1b,0x33,0x62,0x18,0x59,0xdc,0x86,
-0xa1,0x80,0x0a,0x73,0x6a,0x18,0x00,0xa0,0x14,0xa1,0x50,0x0a,0x00,0x66,0xb1,0x09,
-0x70,0x85,0x01,0x17,0x01,0xf2,0x15,0x01,0x5a,0x88,0x9d,0x92,0x17,0x90,0x29,0xc8,
-0x08,0xbd,0x98,0x44,0x90,0x04,0xa2,0x63,0x89,0x07,0x2a,0x95,0x48,0x90,0x30,0x97,
-0x45,0x66,0x00,0x69,0x00,0xa6,0x70,0x54,0x00,0x72,0x04,0xd3,0x53,0xf4,0x15,0xb7,
-0xc7,0xac,0x83,0x2a,0x6c,0x4a,0x99,0x01,0x97,0x96,0x36,0x90,0x68,0xa8,0x83,0x89,
-0x00,0x59,0x05,0x66,0x90,0x28,0xb8,0x38,0x84,0x05,0xbb,0x07,0x60,0x92,0x90,0x78,
-0x88,0x89,0x20,0xb8,0x07,0xf0,0x1a,0x01,0x9b,0x97,0x8c,0x86,0x05,0x37,0x17,0xb7,
-0x30,0xb9,0xb5,0x95,0x26,0x0a,0x69,0x18,0x81,0x60,0xa3,0x82,0x88,0x16,0x0b,0x95,
-0x46,0x81,0x43,0x67,0x90,0x75,0x92,0x34,0x20,0x63,0x00,0x50,0x3a,0xaa,0xad,0x01,
-0x35,0x16,0x50,0xb1,0x00,0x00,0x0a,0xa1,0x3f,0x4f,0x00,0x75,0x62,0x60,0x38,0x30,
-0x00,0x00,0x45,0x01,0x21,0x02,0xf1,0x1e,0x80,0x00,0x00,0x06,0xc4,0x09,0x01,0x3b,
-0x32,0x00,0xb4,0x86,0xc5,0xa0,0x4a,0xb6,0x7c,0x78,0x09,0x46,0x78,0xc8,0x82,0x19,
-0x05,0x88,0x86,0x00,0x90,0x81,0x60,0x90,0x09,0x28,0x1a,0x09,0x00,0xa7,0x28,0x78,
-0x40,0x04,0x08,0x30,0x07,0x20,0x1e,0xf6,0x11,0x40,0x81,0x79,0x60,0x90,0x07,0x36,
-0x91,0xa8,0x00,0xbb,0xa9,0x09,0x50,0x00,0x09,0x91,0x9a,0x02,0x88,0x99,0x92,0x64,
-0x11,0x09,0x93,0x11,0x00,0x49,0x65,0x88,0x85,0x9b,0x48,0x30,0x99,0xa0,0x09,0xbb,
-0x12,0xf3,0x0c,0xd9,0x80,0x92,0x79,0x09,0x08,0x0c,0xab,0x78,0xd8,0x60,0x00,0x95,
-0x48,0x00,0x16,0x9a,0x0c,0x50,0x02,0x40,0xa0,0xbb,0x20,0x02,0x97,0xa2,0xa5,0x14,
-0x00,0x22,0x01,0xf1,0x01,0x8c,0x88,0xa7,0xc0,0x06,0x42,0x89,0x19,0x02,0x72,0x82,
-0x57,0x60,0x02,0xb9,0x99,0xc5,0x0c,0x93,0x10,0x00,0x55,0x55,0x5a,0x20,0x88,0x88,
-0x85,0x76,0x15,0x03,0x5b,0x05,0xf2,0x12,0x03,0x9a,0x50,0xab,0x00,0x08,0x44,0x95,
-0x2b,0x11,0x76,0x75,0x99,0x66,0x3b,0xc7,0x41,0x42,0x30,0x00,0x97,0x18,0x81,0x58,
-0x59,0x22,0x48,0x00,0x01,0x88,0x8b,0xa4,0x05,0xdb,0x0d,0x02,0x58,0x33,0xf2,0x15,
-0x06,0x99,0x9d,0x99,0x91,0x02,0x87,0x77,0x70,0x00,0x46,0x11,0x1b,0x00,0x02,0x77,
-0x77,0x60,0x05,0xb8,0x88,0x88,0xc0,0x54,0xa7,0x7b,0x1a,0x05,0x4a,0x77,0x91,0xa0,
-0x54,0x10,0x00,0x59,0x55,0x12,0xf2,0x0d,0xba,0x58,0x9a,0x92,0x08,0x36,0xa4,0x27,
-0x20,0x83,0x6a,0x06,0x81,0x08,0x36,0xa0,0x46,0x00,0x94,0x66,0x77,0x7b,0x0c,0x74,
-0x99,0x96,0xa0,0x20,0x7c,0x17,0x12,0x39,0x67,0x13,0x30,0x11,0xa2,0x11,0xad,0x14,
-0xf0,0x0c,0x93,0x02,0x88,0xd8,0x87,0x01,0x33,0x3b,0x43,0x32,0x15,0x5d,0x65,0x55,
-0x40,0x2b,0xc8,0x8d,0x30,0x08,0x19,0x5a,0x60,0x00,0x15,0x9b,0xc6,0x36,0x51,0x21,
-0x47,0x70,0xdb,0x00,0xf2,0x15,0xbb,0x98,0x09,0x70,0x0b,0x87,0x80,0x93,0x20,0xbb,
-0x9a,0x9d,0x96,0x04,0xb4,0x20,0xe1,0x00,0x4b,0x42,0x1d,0x50,0x29,0x98,0x56,0x49,
-0x01,0x76,0x66,0xa0,0x73,0x41,0x43,0x53,0x00,0x70,0x96,0x61,0xf1,0x06,0x9e,0x99,
+0x0c,0x92,0x64,0x0a,0x00,0x09,0x00,0xa2,0x0a,0x00,0x09,0x03,0x80,0x0a,0x11,0x04,
+0x00,0x1b,0x02,0xf0,0x30,0xdb,0x80,0x37,0x00,0x09,0x87,0xb9,0x99,0xa0,0xab,0x25,
+0x20,0x06,0x09,0x55,0x54,0x4a,0x10,0x91,0x85,0xb5,0x00,0x0b,0x92,0x54,0x00,0x20,
+0x90,0x05,0x40,0x0a,0x09,0x00,0x2a,0x9a,0x40,0x00,0x05,0x40,0xa0,0xdc,0x4a,0x00,
+0xa0,0x98,0x3b,0x89,0xd7,0x99,0xaa,0x00,0xa0,0x96,0x49,0x71,0xa0,0x94,0x59,0x18,
+0xa0,0xa9,0x19,0x02,0xd0,0x00,0xf0,0x1b,0xa0,0x90,0x09,0x07,0xb0,0x00,0x00,0x03,
+0x00,0x00,0xdb,0x73,0xc8,0xa0,0x08,0x84,0xaa,0x66,0x00,0x8b,0x01,0xad,0x40,0x08,
+0x57,0x71,0x45,0x60,0x81,0x89,0x9d,0x93,0x0a,0xa3,0x90,0xa0,0x00,0x80,0x18,0x8d,
+0x85,0x08,0xb9,0x07,0x04,0x01,0x00,0xf3,0x11,0xdb,0x8c,0x99,0xd0,0x98,0x2c,0x88,
+0xd0,0x9a,0x09,0x00,0xa0,0x93,0x6c,0xa9,0xb0,0x91,0x89,0x36,0x73,0x98,0x29,0x0c,
+0x40,0x90,0x0a,0x46,0xa0,0x90,0x1d,0x70,0x67,0x27,0x00,0xf4,0x1b,0x30,0x00,0x0d,
+0xa8,0x07,0xb2,0x00,0x08,0x82,0x86,0x0a,0x50,0x08,0xa2,0x79,0xb9,0x40,0x08,0x36,
+0x11,0xa1,0x10,0x08,0x2a,0x88,0xd8,0x60,0x09,0x82,0x90,0xa8,0x10,0x08,0x03,0x80,
+0xa1,0xa0,0x08,0x02,0x19,0x80,0x20,0xd4,0x00,0xf2,0x17,0x00,0x00,0xdb,0x83,0xd9,
+0x92,0x08,0x91,0x80,0x0a,0x00,0x9c,0x63,0x32,0x50,0x08,0x47,0xa6,0x69,0x60,0x93,
+0x98,0x21,0x49,0x0a,0x62,0xa3,0x26,0x90,0x80,0x1c,0x88,0x99,0x08,0x01,0x70,0x01,
+0x80,0x5b,0x00,0xf6,0x17,0xc7,0x16,0xc6,0x60,0x08,0x93,0x68,0x73,0x30,0x08,0x90,
+0x2e,0xa8,0x90,0x08,0x87,0xa6,0x96,0x90,0x08,0x62,0x95,0x97,0x90,0x09,0xa0,0x95,
+0x40,0x90,0x08,0x05,0xa3,0x25,0x30,0x08,0x07,0x07,0x99,0xb5,0x00,0xf3,0x15,0x00,
+0xcb,0x89,0x99,0x96,0x08,0xa1,0x97,0x7a,0x40,0x9c,0x07,0x77,0x93,0x08,0x55,0xa8,
+0x88,0x60,0x82,0x88,0x72,0x59,0x0b,0x81,0x98,0xc5,0x90,0x80,0x08,0x08,0x09,0x08,
+0x00,0x80,0x85,0x70,0x05,0xf4,0x15,0x03,0x00,0x08,0x9c,0x58,0xb8,0x70,0x82,0x78,
+0xd8,0xd8,0x28,0x55,0x37,0x77,0x50,0x80,0x96,0x86,0x6a,0x08,0x0a,0x67,0x44,0xa0,
+0x87,0x71,0x3b,0x32,0x08,0x00,0x88,0xd8,0x83,0x80,0x00,0x89,0x01,0xf0,0x3b,0x40,
+0x40,0x00,0x00,0x2e,0x8b,0xa8,0x80,0x2d,0xa6,0xb8,0x64,0x00,0x4b,0x7b,0x87,0x40,
+0x03,0x72,0x94,0x22,0x00,0x2a,0x8c,0x88,0x82,0x28,0x8d,0xfe,0x98,0x60,0x29,0x6a,
+0x4b,0x50,0x3a,0x20,0xa0,0x17,0x70,0x04,0x88,0xd8,0x88,0x00,0x0c,0x88,0xd7,0x87,
+0x90,0x06,0xcb,0xa6,0xc8,0x50,0x00,0x07,0xa9,0x20,0x00,0x2a,0x92,0x82,0x69,0x80,
+0x01,0x77,0x88,0xc7,0x00,0x00,0x08,0x8b,0x40,0x32,0x08,0x21,0x50,0x00,0x28,0x00,
+0xf2,0x10,0xc7,0x7c,0x87,0x88,0x06,0x66,0x93,0x64,0x50,0x27,0x77,0x47,0x50,0x16,
+0x66,0xc6,0x66,0x40,0x7a,0xc9,0xc9,0xc2,0x07,0x27,0x18,0x17,0x20,0x72,0x71,0x73,
+0xb0,0x5e,0x08,0xf0,0x40,0x99,0xcb,0x99,0x20,0xaa,0xaa,0x8a,0x7a,0x04,0x66,0x75,
+0x65,0x30,0x59,0x9a,0x99,0x94,0x08,0x46,0x66,0x66,0x00,0xa8,0xb7,0xb7,0xa4,0x1b,
+0x0a,0x25,0xaa,0x03,0x33,0x85,0x20,0x34,0x02,0x70,0x08,0x00,0x06,0xbd,0xa6,0xbd,
+0x40,0x38,0xb6,0xc3,0xb2,0x06,0x9b,0x86,0xc7,0xb0,0x38,0x76,0x8c,0x9d,0x45,0x97,
+0xa1,0x92,0xa0,0x59,0x7a,0x3b,0x6a,0x05,0x40,0x90,0x80,0x00,0x54,0x68,0x4b,0x00,
+0x00,0x00,0x0a,0x0a,0x64,0x08,0x70,0xa0,0x00,0x2a,0xac,0x0b,0xaa,0x40,0x09,0x00,
+0x50,0x1a,0xac,0x0b,0xaa,0x20,0x09,0x00,0x50,0x4a,0xac,0x0b,0xaa,0x60,0x09,0x00,
+0x01,0x24,0x00,0xf0,0x15,0x2a,0xaa,0xda,0xaa,0x70,0x22,0x2c,0x22,0x20,0x0b,0x7c,
+0x7a,0x9a,0x30,0xa0,0xc8,0xb3,0x63,0x0a,0x0a,0x16,0x36,0x30,0xa0,0xb6,0xa3,0x63,
+0x0b,0x9d,0x9c,0xbc,0x30,0xa0,0x00,0x00,0x63,0x87,0x05,0xf2,0x12,0x05,0xad,0xa6,
+0x8d,0x85,0x16,0xb4,0x11,0xb1,0x04,0x85,0xa5,0x9d,0x92,0x4a,0x7b,0x00,0xa0,0x02,
+0x9b,0x87,0x9d,0x9a,0x59,0xc8,0x00,0xa0,0x90,0x19,0x00,0x0a,0x95,0x00,0xb0,0x09,
+0xf1,0x84,0x60,0x00,0x00,0x79,0x9c,0xa9,0x92,0x00,0x55,0x00,0xb0,0x02,0x9a,0xd9,
+0xad,0x96,0x00,0x33,0x33,0x32,0x00,0x0c,0x55,0x56,0x80,0x00,0xd8,0x88,0x98,0x00,
+0x09,0x00,0x02,0x80,0x00,0xd9,0x99,0xa8,0x00,0x09,0x99,0xea,0x99,0x50,0x18,0x9d,
+0x88,0x60,0x03,0x70,0x41,0x0b,0x00,0x37,0x09,0x10,0xb0,0x03,0x70,0xa0,0x0b,0x00,
+0x24,0x2a,0x63,0x60,0x04,0x99,0x10,0x79,0x10,0x51,0x00,0x00,0x22,0x39,0xb8,0x89,
+0xd9,0x70,0x0a,0x05,0xbc,0x94,0x00,0xa0,0x81,0x43,0x60,0x0a,0x08,0x1a,0x36,0x00,
+0xa0,0x81,0xa3,0x60,0x0a,0x05,0x29,0x24,0x01,0xa0,0x0a,0x5b,0x11,0x83,0x09,0x20,
+0x27,0x45,0x57,0x9e,0x99,0x32,0xa3,0x49,0xe9,0x70,0x09,0x06,0x35,0x0a,0x00,0x90,
+0x63,0xa0,0xa0,0x09,0x68,0x3a,0x0a,0x09,0x93,0x42,0xa1,0x60,0x00,0x03,0xa3,0x78,
+0x00,0x01,0x71,0x00,0x42,0x5d,0x01,0xf1,0x15,0x96,0x94,0x9e,0x96,0x09,0x79,0x28,
+0xd8,0x30,0x97,0x94,0x64,0x46,0x09,0x79,0x45,0x93,0x60,0x97,0x94,0x59,0x36,0x08,
+0x79,0x23,0xa3,0x33,0x61,0x90,0x45,0xa0,0x62,0x09,0x77,0x03,0x80,0xd1,0x08,0x00,
+0xa1,0x05,0xf1,0x15,0x76,0x79,0xe9,0x91,0x55,0x03,0x9e,0x97,0x00,0x1a,0x64,0x30,
+0xa0,0x3a,0x15,0x49,0x0a,0x01,0x03,0x64,0xa0,0xa0,0x02,0xa3,0x2a,0x16,0x05,0xa1,
+0x19,0x48,0x80,0x20,0x08,0x20,0x04,0x20,0xe5,0x03,0xf1,0x14,0x99,0xd5,0x8d,0x98,
+0x07,0x92,0x19,0xd9,0x50,0x1b,0x33,0x62,0x18,0x59,0xdc,0x86,0xa1,0x80,0x0a,0x73,
+0x6a,0x18,0x00,0xa0,0x14,0xa1,0x50,0x0a,0x00,0x66,0xb1,0x09,0x70,0x85,0x01,0x17,
+0x01,0xf2,0x14,0x01,0x5a,0x88,0x9d,0x92,0x17,0x90,0x29,0xc8,0x08,0xbd,0x98,0x44,
+0x90,0x04,0xa2,0x63,0x89,0x07,0x2a,0x95,0x48,0x90,0x30,0x97,0x45,0x66,0x00,0x69,
+0x00,0xa6,0x70,0x54,0x00,0x72,0x52,0x00,0xf4,0x16,0x02,0xb7,0xc7,0xac,0x83,0x2a,
+0x6c,0x4a,0x99,0x01,0x97,0x96,0x36,0x90,0x68,0xa8,0x83,0x89,0x00,0x59,0x05,0x66,
+0x90,0x28,0xb8,0x38,0x84,0x05,0xbb,0x07,0x60,0x92,0x90,0x78,0x88,0x89,0x20,0xb8,
+0x07,0xf0,0x19,0x01,0x9b,0x97,0x8c,0x86,0x05,0x37,0x17,0xb7,0x30,0xb9,0xb5,0x95,
+0x26,0x0a,0x69,0x18,0x81,0x60,0xa3,0x82,0x88,0x16,0x0b,0x95,0x46,0x81,0x43,0x67,
+0x90,0x75,0x92,0x34,0x20,0x63,0x00,0x50,0x3a,0xaa,0xad,0xd7,0x00,0x90,0xa1,0xb1,
+0x00,0x00,0x0a,0xa1,0x00,0x00,0x00,0x0f,0x09,0x70,0x07,0x38,0x30,0x00,0x00,0x45,
+0x01,0x21,0x02,0xf4,0x43,0x80,0x00,0x00,0x06,0xc4,0x09,0x01,0x3b,0x32,0x00,0xb4,
+0x86,0xc5,0xa0,0x4a,0xb6,0x7c,0x78,0x09,0x46,0x78,0xc8,0x82,0x19,0x05,0x88,0x86,
+0x00,0x90,0x81,0x60,0x90,0x09,0x28,0x1a,0x09,0x00,0xa7,0x28,0x78,0x40,0x04,0x08,
+0x30,0x07,0x00,0x09,0x99,0x99,0x99,0x40,0x81,0x79,0x60,0x90,0x07,0x36,0x91,0xa8,
+0x00,0xbb,0xa9,0x09,0x50,0x00,0x09,0x91,0x9a,0x02,0x88,0x99,0x92,0x64,0x11,0x09,
+0x93,0x11,0x00,0x49,0x65,0x88,0x85,0x9e,0x03,0xf2,0x16,0x90,0x00,0x99,0xa0,0x09,
+0x00,0x09,0x09,0x99,0xd9,0x80,0x92,0x79,0x09,0x08,0x0c,0xab,0x78,0xd8,0x60,0x00,
+0x95,0x48,0x00,0x16,0x9a,0x0c,0x50,0x02,0x40,0xa0,0xbb,0x20,0x02,0x97,0xa2,0x19,
+0xa0,0x03,0x00,0x22,0x01,0xf4,0x15,0x8c,0x88,0xa7,0xc0,0x06,0x42,0x89,0x19,0x02,
+0x72,0x82,0x57,0x60,0x02,0xb9,0x99,0xd0,0x00,0x0b,0x11,0x1a,0x10,0x00,0x55,0x55,
+0x5a,0x20,0x88,0x88,0x85,0x91,0x00,0x00,0x00,0x7a,0x00,0x5b,0x05,0xf4,0x14,0x03,
+0x9a,0x50,0xab,0x00,0x08,0x44,0x95,0x2b,0x11,0x76,0x75,0x99,0x66,0x3b,0xc7,0x41,
+0x42,0x30,0x00,0x97,0x18,0x81,0x58,0x59,0x22,0x48,0x00,0x01,0x88,0x8b,0xa4,0x05,
+0xa3,0x00,0x2c,0x00,0xf0,0x17,0x40,0x00,0x06,0x99,0x9d,0x99,0x91,0x02,0x87,0x77,
+0x70,0x00,0x46,0x11,0x1b,0x00,0x02,0x77,0x77,0x60,0x05,0xb8,0x88,0x88,0xc0,0x54,
+0xa7,0x7b,0x1a,0x05,0x4a,0x77,0x91,0xa0,0x54,0x10,0x00,0x59,0x2b,0x00,0xf1,0x10,
+0x50,0x00,0xba,0x58,0x9a,0x92,0x08,0x36,0xa4,0x27,0x20,0x83,0x6a,0x06,0x81,0x08,
+0x36,0xa0,0x46,0x00,0x94,0x66,0x77,0x7b,0x0c,0x74,0x99,0x96,0xa0,0x20,0x00,0x20,
+0x04,0x21,0x39,0x60,0x55,0x00,0xf1,0x19,0x11,0xa2,0x11,0x00,0x79,0x9d,0x99,0x93,
+0x02,0x88,0xd8,0x87,0x01,0x33,0x3b,0x43,0x32,0x15,0x5d,0x65,0x55,0x40,0x2b,0xc8,
+0x8d,0x30,0x08,0x19,0x5a,0x60,0x00,0x15,0x9b,0xc6,0x20,0x19,0x51,0x00,0x47,0x70,
+0xdb,0x00,0xf0,0x15,0xbb,0x98,0x09,0x70,0x0b,0x87,0x80,0x93,0x20,0xbb,0x9a,0x9d,
+0x96,0x04,0xb4,0x20,0xe1,0x00,0x4b,0x42,0x1d,0x50,0x29,0x98,0x56,0x49,0x01,0x76,
+0x66,0xa0,0x73,0x41,0x43,0x53,0x00,0x70,0xa8,0x00,0xf1,0x14,0x05,0x99,0x9e,0x99,
 0x91,0x00,0x84,0x0a,0x30,0x00,0x00,0xac,0x40,0x00,0x37,0xa9,0x5a,0xa7,0x13,0x38,
-0x00,0x35,0x40,0xb5,0x4c,0x71,0x19,0x00,0x55,0x00,0x0a,0x20,0x05,0x97,0x07,0xf0,
-0x06,0x15,0xaa,0x00,0x02,0x7c,0xff,0xfe,0x00,0x0e,0xff,0xfe,0xbe,0x00,0x0e,0xd8,
-0x30,0x3e,0x00,0x0e,0x30,0x00,0x05,0x00,0xf3,0x00,0x01,0x6e,0x00,0x1e,0x30,0x4f,
-0xfe,0x0d,0xff,0x30,0x2d,0xf8,0x0d,0xfd,0x10,0xcc,0x02,0xf0,0x31,0x75,0xcc,0xcc,
-0xc6,0x7c,0x8a,0x11,0x18,0xab,0xca,0x90,0x00,0x7b,0xc9,0x4f,0xcc,0xce,0x79,0xdb,
-0xa0,0x00,0x7c,0xda,0x59,0x00,0x07,0x7a,0xb9,0xfd,0xdd,0xea,0xb0,0x34,0x23,0x44,
-0x44,0x3f,0xf9,0xcf,0xff,0xff,0xef,0x8b,0xff,0xff,0xe7,0x84,0x68,0x88,0x87,0xff,
-0xad,0xff,0xff,0xf8,0x94,0x69,0x99,0x98,0xde,0x8a,0xee,0xee,0xdf,0x1b,0x00,0x50,
-0x45,0x23,0x55,0x55,0x40,0xaa,0x0c,0x00,0x43,0x5b,0xf0,0x07,0xfd,0x23,0x00,0x07,
-0xfe,0x2d,0xf4,0x07,0xfe,0x20,0x5f,0xfa,0xfe,0x20,0x00,0x5f,0xfe,0x20,0x00,0x00,
-0x4d,0x20,0x88,0x8b,0xf7,0x5a,0x02,0x0e,0xe2,0x0c,0xf1,0x5f,0xec,0xf8,0x00,0x6f,
-0xf9,0x00,0x0c,0xff,0xe2,0x0c,0xf8,0x5f,0xe0,0x98,0x00,0x5b,0x00,0x00,0x02,0xd2,
-0x00,0x00,0x7b,0x3f,0x3b,0x70,0x4f,0x73,0xf3,0x8f,0x4a,0xc0,0x3f,0x30,0xca,0xd9,
-0x03,0xf3,0x09,0xdb,0xb0,0x02,0x00,0xbc,0x6f,0x40,0x00,0x4f,0x60,0xbf,0xa7,0xaf,
-0xb0,0x00,0x7d,0xfd,0x70,0x00,0x00,0x06,0xb6,0x00,0x00,0x31,0xcf,0xc1,0x30,0x4f,
-0xff,0xff,0xff,0x47,0xff,0xb4,0xbf,0xf7,0x0d,0xf2,0x02,0xfd,0x04,0xff,0x70,0x7f,
-0xf4,0x6f,0xff,0xff,0xff,0x60,0x75,0xef,0xe5,0x70,0x00,0x08,0xf8,0x00,0x00,0x23,
-0x21,0xf0,0x1b,0x2d,0xe3,0xd9,0x00,0x00,0x4e,0x97,0xff,0x90,0x00,0x6f,0x7b,0xc6,
-0xfb,0x00,0x9e,0x6d,0xff,0xe6,0xdb,0x07,0x4e,0xff,0xff,0xf5,0x80,0x05,0xff,0xa9,
-0xff,0x70,0x00,0x5f,0xf3,0x1f,0xf7,0x00,0x03,0xcc,0x20,0xcc,0x50,0x50,0x21,0x00,
-0xc5,0x00,0x23,0xdf,0x60,0x05,0x00,0xf0,0x47,0x58,0xef,0xb7,0x10,0x00,0x4f,0xff,
-0xfc,0x00,0x00,0x04,0xff,0xc0,0x00,0x19,0xa9,0x7c,0x6a,0xa6,0x3f,0xff,0xfc,0xfe,
-0xec,0x2f,0xff,0xff,0xfc,0xbb,0x01,0xdf,0xff,0xfe,0x20,0x00,0xba,0x22,0x22,0x8c,
-0x00,0x5f,0x10,0x00,0x00,0xe7,0x0e,0xb6,0x30,0x02,0x6a,0xf0,0xff,0xfe,0x44,0xdf,
-0xff,0x2f,0xff,0xff,0xff,0xff,0xf2,0xcf,0xff,0xff,0xff,0xfe,0x00,0x00,0x5b,0xda,
-0x43,0xd0,0x9f,0xa7,0xaf,0xbf,0x5f,0x40,0x04,0x7f,0xf9,0x90,0x00,0xde,0xee,0x99,
-0x00,0xf1,0x02,0x0f,0xff,0xe0,0x00,0x9a,0xff,0x74,0x00,0x3f,0x5f,0xdf,0x85,0x8f,
-0xa0,0xf3,0x6c,0xfd,0x02,0x6d,0xd0,0x15,0xf8,0xff,0xff,0x8f,0xff,0xf8,0xff,0xff,
-0x84,0x59,0xf8,0x00,0x25,0x13,0x00,0x16,0x6d,0xf5,0x03,0x05,0xf8,0x00,0xff,0xff,
-0x86,0x3f,0xff,0xf8,0x3a,0xff,0xff,0x88,0x64,0x5a,0xf8,0x00,0x00,0x50,0x1a,0xf0,
-0x1a,0x06,0x10,0x00,0x00,0x55,0x01,0x4d,0x10,0x01,0x5f,0x80,0x89,0x59,0x0f,0xff,
-0xf8,0x73,0xb3,0xd0,0xff,0xff,0x83,0xa7,0x6c,0x1f,0xff,0xf8,0x86,0x94,0xd0,0x45,
-0x9f,0x80,0x5c,0x4b,0x00,0x00,0x97,0x03,0x2d,0x30,0x11,0x36,0xf0,0x0e,0x40,0x00,
-0xbf,0xff,0xff,0xff,0xbf,0x45,0xff,0xff,0xff,0xf1,0x2f,0xfd,0x9f,0xff,0xec,0xfd,
-0x10,0x8f,0xfa,0x07,0x10,0x02,0xff,0x32,0x22,0x22,0x3f,0xac,0x00,0xf3,0x11,0xc0,
-0x00,0x58,0x00,0x00,0x0d,0xf1,0x00,0x05,0xff,0x80,0x01,0xef,0xff,0x20,0x9f,0xff,
-0xfc,0x0e,0xef,0xff,0xf1,0xe6,0xff,0xff,0x19,0xc6,0xdf,0xc0,0x09,0xff,0xb1,0x98,
-0x63,0xf1,0x24,0xe5,0x00,0xaa,0xe5,0x0b,0xfb,0xe6,0xcf,0xfb,0xef,0xff,0xfb,0xed,
-0xff,0xfb,0xe5,0x8f,0xfb,0xe5,0x07,0xfb,0xb3,0x00,0x67,0xb9,0x10,0x00,0x00,0xff,
-0xe6,0x00,0x00,0xff,0xff,0xd3,0x00,0xff,0xff,0xff,0xa1,0xff,0xff,0xff,0xfc,0xff,
-0xff,0xff,0xd4,0xff,0xff,0xf8,0x1b,0x85,0x24,0xed,0x40,0x5a,0x10,0xad,0x01,0x10,
-0xdf,0xf4,0x5f,0xfc,0xff,0xf6,0x7f,0xfe,0x04,0x00,0xf0,0x00,0xf5,0x7f,0xfe,0x8c,
-0xb1,0x2b,0xc7,0x01,0x11,0x11,0x10,0xdf,0xff,0xff,0xfb,0x42,0x01,0x1e,0xff,0x04,
-0x00,0xf0,0x0f,0xfd,0x9c,0xcc,0xcc,0xc7,0x00,0x00,0x01,0xab,0x00,0x5e,0xbf,0xc0,
-0x5e,0xbf,0xfc,0x6e,0xbf,0xff,0xfe,0xbf,0xff,0xde,0xbf,0xf8,0x5e,0xbf,0x70,0x5e,
-0x76,0x1a,0x6c,0x10,0x54,0x3c,0x01,0xe0,0xff,0x40,0x00,0x00,0x4f,0xff,0xf3,0x00,
-0x03,0xff,0xff,0xfe,0x20,0x0e,0xe2,0x00,0xf1,0x05,0x05,0x88,0x88,0x88,0x40,0x0d,
-0xee,0xee,0xee,0xb0,0x0f,0xff,0xff,0xff,0xd0,0x04,0x55,0x55,0x55,0x30,0x61,0x0f,
-0xf1,0x04,0xe0,0x00,0x7f,0x70,0x07,0xf7,0x00,0x5f,0x90,0x00,0x1c,0xe3,0x00,0x01,
-0xce,0x30,0x00,0x1c,0xe0,0x61,0x4e,0x34,0x00,0x5e,0x20,0x12,0x00,0x14,0x1e,0x24,
-0x00,0x33,0x70,0x00,0x15,0x5b,0x02,0x60,0x0d,0xb0,0x00,0x00,0x0e,0xc0,0x04,0x00,
-0x00,0x0b,0x6a,0x54,0xfc,0x8a,0xaf,0xea,0xa7,0x10,0x00,0x04,0xa5,0x01,0x01,0x18,
-0x00,0xf2,0x1c,0xaa,0xaa,0xa7,0x00,0x29,0xcc,0x93,0x00,0x00,0x7f,0x92,0x28,0xf8,
-0x00,0x6f,0xc0,0x4f,0x4a,0xf8,0x0e,0xf9,0x6e,0xfb,0x7f,0xf1,0x7f,0xb5,0xff,0x69,
-0xf9,0x00,0x9f,0x72,0x35,0xfb,0x00,0x00,0x5b,0xed,0xc5,0x00,0x00,0x0c,0x56,0x0c,
-0x40,0x5f,0x86,0xbc,0xb6,0xbb,0x02,0xf2,0x15,0xf6,0x13,0xdd,0x20,0x00,0x05,0x1b,
+0x00,0x35,0x40,0x00,0xa0,0x05,0x50,0x00,0x19,0x00,0x55,0x00,0x0a,0x20,0x05,0x97,
+0x07,0xf0,0x06,0x15,0xaa,0x00,0x02,0x7c,0xff,0xfe,0x00,0x0e,0xff,0xfe,0xbe,0x00,
+0x0e,0xd8,0x30,0x3e,0x00,0x0e,0x30,0x00,0x05,0x00,0xf3,0x00,0x01,0x6e,0x00,0x1e,
+0x30,0x4f,0xfe,0x0d,0xff,0x30,0x2d,0xf8,0x0d,0xfd,0x10,0xcc,0x02,0xf0,0x31,0x75,
+0xcc,0xcc,0xc6,0x7c,0x8a,0x11,0x18,0xab,0xca,0x90,0x00,0x7b,0xc9,0x4f,0xcc,0xce,
+0x79,0xdb,0xa0,0x00,0x7c,0xda,0x59,0x00,0x07,0x7a,0xb9,0xfd,0xdd,0xea,0xb0,0x34,
+0x23,0x44,0x44,0x3f,0xf9,0xcf,0xff,0xff,0xef,0x8b,0xff,0xff,0xe7,0x84,0x68,0x88,
+0x87,0xff,0xad,0xff,0xff,0xf8,0x94,0x69,0x99,0x98,0xde,0x8a,0xee,0xee,0xdf,0x1b,
+0x00,0x50,0x45,0x23,0x55,0x55,0x40,0xaa,0x0c,0xf5,0x76,0x50,0x00,0x00,0x07,0xfd,
+0x23,0x00,0x07,0xfe,0x2d,0xf4,0x07,0xfe,0x20,0x5f,0xfa,0xfe,0x20,0x00,0x5f,0xfe,
+0x20,0x00,0x00,0x4d,0x20,0x00,0x00,0x21,0x00,0x02,0x0e,0xe2,0x0c,0xf1,0x5f,0xec,
+0xf8,0x00,0x6f,0xf9,0x00,0x0c,0xff,0xe2,0x0c,0xf8,0x5f,0xe0,0x98,0x00,0x5b,0x00,
+0x00,0x02,0xd2,0x00,0x00,0x7b,0x3f,0x3b,0x70,0x4f,0x73,0xf3,0x8f,0x4a,0xc0,0x3f,
+0x30,0xca,0xd9,0x03,0xf3,0x09,0xdb,0xb0,0x02,0x00,0xbc,0x6f,0x40,0x00,0x4f,0x60,
+0xbf,0xa7,0xaf,0xb0,0x00,0x7d,0xfd,0x70,0x00,0x00,0x06,0xb6,0x00,0x00,0x31,0xcf,
+0xc1,0x30,0x4f,0xff,0xff,0xff,0x47,0xff,0xb4,0xbf,0xf7,0x0d,0xf2,0x02,0xfd,0x04,
+0xff,0x70,0x7f,0xf4,0x6f,0xff,0xff,0xff,0x60,0x75,0xef,0xe5,0x70,0x00,0x08,0xf8,
+0x00,0x06,0x00,0xc1,0x02,0xf0,0x1a,0x2d,0xe3,0xd9,0x00,0x00,0x4e,0x97,0xff,0x90,
+0x00,0x6f,0x7b,0xc6,0xfb,0x00,0x9e,0x6d,0xff,0xe6,0xdb,0x07,0x4e,0xff,0xff,0xf5,
+0x80,0x05,0xff,0xa9,0xff,0x70,0x00,0x5f,0xf3,0x1f,0xf7,0x00,0x03,0xcc,0x20,0xcc,
+0x3c,0x01,0x10,0x9c,0xc5,0x00,0x23,0xdf,0x60,0x05,0x00,0xf0,0x47,0x58,0xef,0xb7,
+0x10,0x00,0x4f,0xff,0xfc,0x00,0x00,0x04,0xff,0xc0,0x00,0x19,0xa9,0x7c,0x6a,0xa6,
+0x3f,0xff,0xfc,0xfe,0xec,0x2f,0xff,0xff,0xfc,0xbb,0x01,0xdf,0xff,0xfe,0x20,0x00,
+0xba,0x22,0x22,0x8c,0x00,0x5f,0x10,0x00,0x00,0xe7,0x0e,0xb6,0x30,0x02,0x6a,0xf0,
+0xff,0xfe,0x44,0xdf,0xff,0x2f,0xff,0xff,0xff,0xff,0xf2,0xcf,0xff,0xff,0xff,0xfe,
+0x00,0x00,0x5b,0xda,0x43,0xd0,0x9f,0xa7,0xaf,0xbf,0x5f,0x40,0x04,0x7f,0xf9,0x90,
+0x00,0xde,0xee,0x99,0x00,0xf0,0x01,0x0f,0xff,0xe0,0x00,0x9a,0xff,0x74,0x00,0x3f,
+0x5f,0xdf,0x85,0x8f,0xa0,0xf3,0x6c,0xdc,0x00,0xf0,0x03,0x05,0x50,0x15,0xf8,0xff,
+0xff,0x8f,0xff,0xf8,0xff,0xff,0x84,0x59,0xf8,0x00,0x09,0x70,0x00,0x14,0x00,0xf2,
+0x03,0x00,0x05,0xf8,0x00,0xff,0xff,0x86,0x3f,0xff,0xf8,0x3a,0xff,0xff,0x88,0x64,
+0x5a,0xf8,0x00,0x1a,0x00,0x01,0x10,0x06,0xf0,0x18,0x10,0x00,0x00,0x55,0x01,0x4d,
+0x10,0x01,0x5f,0x80,0x89,0x59,0x0f,0xff,0xf8,0x73,0xb3,0xd0,0xff,0xff,0x83,0xa7,
+0x6c,0x1f,0xff,0xf8,0x86,0x94,0xd0,0x45,0x9f,0x80,0x5c,0x4b,0x00,0x00,0x97,0x03,
+0x2d,0x2e,0x09,0xf0,0x0f,0x08,0x40,0x00,0xbf,0xff,0xff,0xff,0xbf,0x45,0xff,0xff,
+0xff,0xf1,0x2f,0xfd,0x9f,0xff,0xec,0xfd,0x10,0x8f,0xfa,0x07,0x10,0x02,0xff,0x32,
+0x22,0x22,0x3f,0xac,0x00,0xf0,0x15,0xc0,0x00,0x58,0x00,0x00,0x0d,0xf1,0x00,0x05,
+0xff,0x80,0x01,0xef,0xff,0x20,0x9f,0xff,0xfc,0x0e,0xef,0xff,0xf1,0xe6,0xff,0xff,
+0x19,0xc6,0xdf,0xc0,0x09,0xff,0xb1,0x00,0x00,0x00,0x00,0xf1,0x2f,0x10,0x00,0x00,
+0xe5,0x00,0xaa,0xe5,0x0b,0xfb,0xe6,0xcf,0xfb,0xef,0xff,0xfb,0xed,0xff,0xfb,0xe5,
+0x8f,0xfb,0xe5,0x07,0xfb,0xb3,0x00,0x67,0xb9,0x10,0x00,0x00,0xff,0xe6,0x00,0x00,
+0xff,0xff,0xd3,0x00,0xff,0xff,0xff,0xa1,0xff,0xff,0xff,0xfc,0xff,0xff,0xff,0xd4,
+0xff,0xff,0xf8,0x00,0xff,0xfa,0x20,0x00,0xed,0x40,0x00,0x01,0x00,0xcd,0x01,0x10,
+0x01,0x10,0xdf,0xf4,0x5f,0xfc,0xff,0xf6,0x7f,0xfe,0x04,0x00,0xfe,0x05,0xf5,0x7f,
+0xfe,0x8c,0xb1,0x2b,0xc7,0x01,0x11,0x11,0x10,0xdf,0xff,0xff,0xfb,0xff,0xff,0xff,
+0xfe,0xff,0x04,0x00,0xf0,0x3e,0xfd,0x9c,0xcc,0xcc,0xc7,0x00,0x00,0x01,0xab,0x00,
+0x5e,0xbf,0xc0,0x5e,0xbf,0xfc,0x6e,0xbf,0xff,0xfe,0xbf,0xff,0xde,0xbf,0xf8,0x5e,
+0xbf,0x70,0x5e,0x76,0x00,0x3b,0x00,0x00,0x54,0x00,0x00,0x00,0x05,0xff,0x40,0x00,
+0x00,0x4f,0xff,0xf3,0x00,0x03,0xff,0xff,0xfe,0x20,0x0e,0xff,0xff,0xff,0xc0,0x05,
+0x88,0x88,0x88,0x40,0x0d,0xee,0xee,0xee,0xb0,0x0f,0xff,0xff,0xff,0xd0,0x04,0x55,
+0x55,0x55,0x30,0x94,0x00,0xf4,0x0d,0x07,0xe0,0x00,0x7f,0x70,0x07,0xf7,0x00,0x5f,
+0x90,0x00,0x1c,0xe3,0x00,0x01,0xce,0x30,0x00,0x1c,0xe0,0x00,0x01,0x50,0x00,0x00,
+0x00,0x5e,0x20,0x12,0x00,0x14,0x1e,0x24,0x00,0x30,0x70,0x00,0x15,0xc7,0x00,0x91,
+0x00,0x00,0x00,0x0d,0xb0,0x00,0x00,0x0e,0xc0,0x04,0x00,0x84,0xef,0xff,0xff,0xfc,
+0x8a,0xaf,0xea,0xa7,0x10,0x00,0x31,0x00,0x09,0x70,0xee,0x00,0x01,0x18,0x00,0xf1,
+0x1d,0xaa,0xaa,0xa7,0x00,0x29,0xcc,0x93,0x00,0x00,0x7f,0x92,0x28,0xf8,0x00,0x6f,
+0xc0,0x4f,0x4a,0xf8,0x0e,0xf9,0x6e,0xfb,0x7f,0xf1,0x7f,0xb5,0xff,0x69,0xf9,0x00,
+0x9f,0x72,0x35,0xfb,0x00,0x00,0x5b,0xed,0xc5,0x00,0x00,0x0c,0x50,0x36,0x00,0xf2,
+0x1d,0x5f,0x86,0xbc,0xb6,0x00,0x00,0x00,0x2d,0xf6,0x13,0xdd,0x20,0x00,0x05,0x1b,
 0xde,0xb3,0xfe,0x10,0x06,0xf9,0x07,0xff,0x3f,0xf8,0x00,0x1e,0xf3,0x04,0xea,0xff,
-0x20,0x00,0x3e,0xd1,0x02,0xcf,0x60,0x00,0x00,0x18,0xdd,0x60,0x9e,0x57,0x01,0x25,
-0x6e,0x10,0x37,0x0e,0x01,0x2c,0x08,0x30,0x4f,0xf6,0x00,0xc5,0x02,0x10,0xfe,0x26,
-0x02,0xf0,0x0e,0xf6,0x4f,0x80,0x00,0x00,0x0e,0xf5,0x3f,0xf2,0x00,0x00,0x8f,0xf6,
-0x4f,0xfa,0x00,0x02,0xff,0xfa,0x9f,0xff,0x30,0x0b,0xff,0xf7,0x5f,0xff,0xc0,0x0e,
-0xab,0x02,0x71,0xf0,0x00,0x22,0x22,0x22,0x22,0x10,0x31,0x5a,0xf1,0x10,0x31,0x00,
-0x16,0xf3,0xff,0xd1,0x2e,0xff,0xd3,0x4e,0x5d,0xd6,0xf3,0x00,0x1d,0xe1,0x03,0x00,
-0x0c,0xe5,0xa3,0xd1,0xff,0xf3,0x4f,0xff,0xd6,0x73,0x00,0x39,0xf6,0x08,0x53,0x00,
-0xb5,0x08,0xf4,0x14,0x00,0x6f,0xf5,0x00,0x06,0xf8,0xaf,0x50,0x6f,0x80,0x0a,0xf4,
-0x98,0x00,0x00,0xa8,0x65,0x00,0x00,0x65,0x9f,0x50,0x06,0xf7,0x0a,0xf5,0x6f,0x80,
-0x00,0xaf,0xf8,0x00,0x00,0x0a,0x80,0x73,0x28,0xf2,0x05,0xd2,0x02,0x22,0x21,0x00,
-0x4f,0xfe,0x3e,0xff,0xfe,0x00,0xa9,0xea,0x60,0x00,0x3e,0x00,0x03,0xe0,0x00,0x06,
-0x00,0x90,0x0a,0x9e,0xa5,0x03,0xfe,0xee,0xa5,0xff,0xe1,0xd4,0x6a,0x13,0x6e,0x14,
-0x0a,0xad,0x8c,0xcb,0x10,0x00,0x0f,0xff,0xfd,0xaa,0xa6,0xff,0x01,0x00,0x02,0xa7,
-0x02,0x10,0x01,0xa6,0x06,0xc0,0x1d,0xfd,0x10,0x00,0x01,0xdf,0xff,0xd1,0x00,0x03,
-0x9d,0xfd,0x3e,0x51,0x22,0xfa,0x00,0x05,0x00,0xf0,0x00,0x89,0x88,0xf8,0x89,0x91,
-0xff,0xfc,0xbc,0xee,0xf2,0xff,0xff,0xff,0xac,0xf2,0x11,0x01,0x00,0xf5,0x11,0x70,
-0x2f,0xff,0x00,0x00,0x00,0x6f,0xfd,0x0f,0x00,0x10,0xf9,0xe5,0x2b,0xf2,0x04,0xf3,
-0x00,0x14,0x00,0x9f,0x90,0x09,0xff,0x6b,0xfc,0x00,0x0d,0xff,0xff,0xa0,0x00,0x0a,
-0xff,0xa3,0x0f,0x05,0x00,0xca,0x15,0xf8,0x22,0x00,0xaf,0xe1,0x05,0xe9,0xf5,0xe4,
-0x6f,0xe2,0x7f,0xfd,0xfe,0x20,0x00,0xcf,0xf3,0x00,0x4d,0xff,0xf9,0x00,0xe7,0xe5,
-0xaf,0x90,0xe8,0xe3,0x0b,0xf8,0x3b,0x70,0x00,0x63,0x00,0xaf,0xfa,0x91,0x22,0xcf,
-0xfa,0x89,0xfb,0xcf,0xfe,0xa9,0xfb,0xcf,0xff,0xfe,0x04,0x00,0xf0,0x00,0xfd,0x57,
-0x77,0x75,0xff,0xff,0xfa,0x00,0x12,0x22,0x20,0x00,0x02,0x22,0x22,0x02,0x02,0x82,
-0x90,0xf2,0x00,0x05,0xf8,0xf2,0x00,0x05,0xc0,0x02,0xf0,0x00,0xf5,0x6f,0xfe,0xff,
-0xd0,0x0f,0xfe,0xff,0xf8,0x9f,0xfe,0x9c,0xcc,0xcc,0xc8,0x22,0x02,0x40,0x45,0x55,
-0x55,0x54,0xfb,0x00,0x00,0xdc,0x02,0x80,0x34,0x44,0x44,0x43,0x23,0x33,0x33,0x32,
-0x0c,0x00,0x00,0x10,0x33,0x50,0x8c,0xcc,0xcc,0xcc,0x8e,0x39,0x00,0xd1,0x5c,0xff,
-0xff,0xfc,0x5f,0x88,0xff,0xf8,0x8f,0xff,0xc5,0xa6,0xcf,0x1d,0x03,0x01,0x0f,0x01,
-0xf1,0x0c,0x06,0xff,0xc0,0x00,0x9f,0xf9,0x00,0x0b,0xff,0x62,0x00,0xdf,0xff,0xf7,
-0x0f,0xff,0xfe,0x10,0x11,0xaf,0x60,0x00,0x0d,0xd0,0x00,0x01,0xf4,0x61,0x6b,0x00,
-0xa7,0x46,0xf0,0x12,0xb9,0x52,0x00,0xff,0x8d,0xfa,0x00,0xff,0xd9,0x96,0x00,0xff,
-0x6e,0xe9,0x91,0xff,0x7f,0xfb,0x77,0xff,0x7f,0xff,0xed,0xff,0x7f,0xff,0xfe,0x45,
-0x4f,0xff,0xfe,0x00,0x2f,0xa9,0x04,0x03,0xbf,0x05,0xa0,0x8f,0xe7,0x00,0x08,0xff,
-0xff,0x60,0x0d,0xff,0xff,0x25,0x03,0xf1,0x01,0xd0,0x2f,0xff,0xff,0xf1,0xcf,0xff,
-0xff,0xfa,0x57,0x77,0x77,0x74,0x00,0x1e,0xd0,0x27,0x00,0x10,0xbf,0x9c,0x00,0xf4,
-0x0c,0x0f,0x4b,0x3a,0xa3,0xa3,0xf2,0xfa,0xd9,0xdd,0x9d,0x9f,0x2f,0xf0,0xa3,0x3a,
-0x0d,0xf2,0xfc,0xcb,0x9a,0xbc,0xcf,0x2f,0x4a,0x22,0x22,0xa2,0xfb,0x04,0x04,0x01,
-0x00,0xe0,0x3a,0xa0,0x00,0x00,0x04,0xbf,0xfd,0x00,0x00,0x5d,0xff,0xff,0x60,0x06,
-0x36,0x6d,0x00,0x16,0x01,0x60,0xf7,0x00,0x01,0x33,0x3f,0xff,0x4b,0x03,0x10,0xff,
-0x2b,0x02,0x20,0x1f,0xf1,0x2b,0x00,0x14,0xe9,0x34,0x00,0xb2,0xde,0xed,0x63,0x0f,
-0xff,0xf8,0xf3,0xff,0xff,0x47,0x5f,0x49,0x04,0x19,0xcf,0x07,0x00,0xf0,0x0f,0xb1,
-0x22,0x22,0x20,0x00,0x00,0x24,0x31,0x00,0x00,0x02,0xaf,0xff,0xff,0xb4,0x00,0x7f,
-0xd7,0x31,0x25,0xbf,0xa0,0x98,0x01,0x57,0x62,0x05,0xc1,0x00,0x7f,0xd2,0x01,0x50,
-0x00,0xa9,0x10,0x07,0xc1,0x59,0x46,0x01,0x53,0x03,0x31,0x6f,0xa0,0x00,0x78,0x61,
-0x20,0x00,0x00,0xc6,0x57,0x01,0x96,0x01,0xa0,0xff,0xff,0x90,0xf4,0x88,0x88,0x88,
+0x20,0x00,0x3e,0xd1,0x02,0xcf,0x60,0x00,0x00,0x18,0xdd,0x60,0x9e,0x57,0x01,0x33,
+0x6e,0x10,0x00,0x01,0x00,0x20,0x09,0xb0,0x06,0x00,0x20,0x4f,0xf6,0x06,0x00,0xf0,
+0x13,0xdf,0xfe,0x00,0x00,0x00,0x06,0xf6,0x4f,0x80,0x00,0x00,0x0e,0xf5,0x3f,0xf2,
+0x00,0x00,0x8f,0xf6,0x4f,0xfa,0x00,0x02,0xff,0xfa,0x9f,0xff,0x30,0x0b,0xff,0xf7,
+0x5f,0xff,0xc0,0x17,0x01,0x70,0xff,0xf0,0x00,0x22,0x22,0x22,0x22,0x42,0x00,0xf0,
+0x14,0x02,0x02,0x31,0x00,0x16,0xf3,0xff,0xd1,0x2e,0xff,0xd3,0x4e,0x5d,0xd6,0xf3,
+0x00,0x1d,0xe1,0x03,0x00,0x0c,0xe5,0xa3,0xd1,0xff,0xf3,0x4f,0xff,0xd6,0x73,0x00,
+0x39,0xf6,0x00,0x00,0xfe,0x00,0xf3,0x17,0x06,0x50,0x00,0x00,0x6f,0xf5,0x00,0x06,
+0xf8,0xaf,0x50,0x6f,0x80,0x0a,0xf4,0x98,0x00,0x00,0xa8,0x65,0x00,0x00,0x65,0x9f,
+0x50,0x06,0xf7,0x0a,0xf5,0x6f,0x80,0x00,0xaf,0xf8,0x00,0x00,0x0a,0x80,0x91,0x00,
+0xf2,0x06,0x05,0xd2,0x02,0x22,0x21,0x00,0x4f,0xfe,0x3e,0xff,0xfe,0x00,0xa9,0xea,
+0x60,0x00,0x3e,0x00,0x03,0xe0,0x00,0x06,0x00,0xf2,0x00,0x0a,0x9e,0xa5,0x03,0xfe,
+0xee,0xa5,0xff,0xe1,0x00,0x33,0x33,0x20,0x6e,0x20,0x30,0x00,0xad,0x8c,0xcb,0x10,
+0x00,0x0f,0xff,0xfd,0xaa,0xa6,0xff,0x01,0x00,0x10,0xcf,0xc5,0x01,0xf2,0x09,0x00,
+0x01,0xa1,0x00,0x00,0x00,0x1d,0xfd,0x10,0x00,0x01,0xdf,0xff,0xd1,0x00,0x03,0x9d,
+0xfd,0x93,0x00,0x00,0x0a,0xfa,0x00,0x05,0x00,0xf0,0x00,0x89,0x88,0xf8,0x89,0x91,
+0xff,0xfc,0xbc,0xee,0xf2,0xff,0xff,0xff,0xac,0xf2,0x11,0x01,0xb0,0xb7,0x00,0x00,
+0x00,0x2f,0xff,0x00,0x00,0x00,0x6f,0xfd,0x0f,0x00,0xf0,0x0c,0xf9,0x00,0x00,0x00,
+0x0c,0xf3,0x00,0x14,0x00,0x9f,0x90,0x09,0xff,0x6b,0xfc,0x00,0x0d,0xff,0xff,0xa0,
+0x00,0x0a,0xff,0xa3,0x00,0x00,0x00,0x03,0x01,0xf8,0x25,0x03,0x10,0x00,0x00,0xaf,
+0xe1,0x05,0xe9,0xf5,0xe4,0x6f,0xe2,0x7f,0xfd,0xfe,0x20,0x00,0xcf,0xf3,0x00,0x4d,
+0xff,0xf9,0x00,0xe7,0xe5,0xaf,0x90,0xe8,0xe3,0x0b,0xf8,0x3b,0x70,0x00,0x63,0x00,
+0xaf,0xfa,0x91,0x22,0xcf,0xfa,0x89,0xfb,0xcf,0xfe,0xa9,0xfb,0xcf,0xff,0xfe,0x04,
+0x00,0xf0,0x00,0xfd,0x57,0x77,0x75,0xff,0xff,0xfa,0x00,0x12,0x22,0x20,0x00,0x02,
+0x22,0x22,0x02,0x02,0x82,0x90,0xf2,0x00,0x05,0xf8,0xf2,0x00,0x05,0xc0,0x02,0xf0,
+0x00,0xf5,0x6f,0xfe,0xff,0xd0,0x0f,0xfe,0xff,0xf8,0x9f,0xfe,0x9c,0xcc,0xcc,0xc8,
+0x22,0x02,0x40,0x45,0x55,0x55,0x54,0xfb,0x00,0x00,0xdc,0x02,0x80,0x34,0x44,0x44,
+0x43,0x23,0x33,0x33,0x32,0x0c,0x00,0x90,0x11,0x11,0x11,0x10,0x8c,0xcc,0xcc,0xcc,
+0x8e,0x39,0x00,0xd1,0x5c,0xff,0xff,0xfc,0x5f,0x88,0xff,0xf8,0x8f,0xff,0xc5,0xa6,
+0xcf,0x1d,0x03,0x01,0x0f,0x01,0xf1,0x0f,0x06,0xff,0xc0,0x00,0x9f,0xf9,0x00,0x0b,
+0xff,0x62,0x00,0xdf,0xff,0xf7,0x0f,0xff,0xfe,0x10,0x11,0xaf,0x60,0x00,0x0d,0xd0,
+0x00,0x01,0xf4,0x00,0x00,0x3a,0x52,0x01,0xf1,0x16,0x45,0xb9,0x52,0x00,0xff,0x8d,
+0xfa,0x00,0xff,0xd9,0x96,0x00,0xff,0x6e,0xe9,0x91,0xff,0x7f,0xfb,0x77,0xff,0x7f,
+0xff,0xed,0xff,0x7f,0xff,0xfe,0x45,0x4f,0xff,0xfe,0x00,0x2f,0xff,0xfe,0x00,0x08,
+0x03,0xd0,0x50,0x00,0x00,0x8f,0xe7,0x00,0x08,0xff,0xff,0x60,0x0d,0xff,0xff,0x25,
+0x03,0xf1,0x01,0xd0,0x2f,0xff,0xff,0xf1,0xcf,0xff,0xff,0xfa,0x57,0x77,0x77,0x74,
+0x00,0x1e,0xd0,0x27,0x00,0x10,0xbf,0x9c,0x00,0xf0,0x0e,0x0f,0x4b,0x3a,0xa3,0xa3,
+0xf2,0xfa,0xd9,0xdd,0x9d,0x9f,0x2f,0xf0,0xa3,0x3a,0x0d,0xf2,0xfc,0xcb,0x9a,0xbc,
+0xcf,0x2f,0x4a,0x22,0x22,0xa2,0xf2,0xcf,0xb0,0x00,0x15,0x00,0x01,0x00,0xf0,0x03,
+0x3a,0xa0,0x00,0x00,0x04,0xbf,0xfd,0x00,0x00,0x5d,0xff,0xff,0x60,0x06,0xef,0xff,
+0xff,0xe0,0x16,0x01,0x60,0xf7,0x00,0x01,0x33,0x3f,0xff,0x4b,0x03,0x10,0xff,0x2b,
+0x02,0x20,0x1f,0xf1,0x2b,0x00,0x14,0xe9,0x34,0x00,0xb2,0xde,0xed,0x63,0x0f,0xff,
+0xf8,0xf3,0xff,0xff,0x47,0x5f,0x49,0x04,0x19,0xcf,0x07,0x00,0xf0,0x0f,0xb1,0x22,
+0x22,0x20,0x00,0x00,0x24,0x31,0x00,0x00,0x02,0xaf,0xff,0xff,0xb4,0x00,0x7f,0xd7,
+0x31,0x25,0xbf,0xa0,0x98,0x01,0x57,0x62,0x05,0xc1,0x00,0x7f,0xd2,0x01,0x91,0x00,
+0xa9,0x10,0x07,0xc1,0x00,0x00,0x00,0x3c,0x53,0x03,0x21,0x6f,0xa0,0x8b,0x02,0x62,
+0x10,0x00,0x00,0x12,0x22,0x22,0x96,0x01,0xa0,0xff,0xff,0x90,0xf4,0x88,0x88,0x88,
 0x77,0xf2,0xf7,0x03,0x03,0xfc,0x03,0xe3,0xf5,0xaa,0xaa,0xaa,0x97,0xf3,0xee,0xee,
 0xee,0xee,0xef,0xb0,0x13,0x33,0x33,0x33,0x33,0x2a,0x00,0x20,0x82,0x07,0x2a,0x00,
 0x20,0xf4,0x00,0x2a,0x00,0x2f,0xa2,0x07,0x2a,0x00,0x08,0x20,0x84,0x00,0x2a,0x00,
 0x20,0xf9,0x00,0x2a,0x00,0x2f,0xa6,0x00,0x2a,0x00,0x08,0x20,0x87,0x00,0x2a,0x00,
 0x20,0xfe,0x00,0x2a,0x00,0x2f,0xa9,0x00,0x2a,0x00,0x08,0x20,0xf2,0x00,0x2a,0x00,
-0x20,0xf2,0x00,0x2a,0x00,0x02,0x0c,0x00,0x01,0x2a,0x00,0x11,0xa0,0x2a,0x00,0x00,
-0xec,0x22,0x01,0x7f,0x1b,0xf1,0x04,0xa8,0xf5,0x00,0x00,0x48,0x05,0x50,0x00,0x03,
-0x00,0xff,0xcd,0xaa,0xaa,0xad,0xd1,0x8c,0x20,0x37,0x98,0x17,0x21,0x09,0x4d,0xfd,
-0x00,0x15,0x7f,0x8c,0x44,0xf0,0x14,0x7b,0xca,0x20,0x08,0xfe,0x6f,0xd0,0x0f,0xde,
-0x27,0xf4,0x2f,0x96,0x45,0xf6,0x3f,0xf7,0x1f,0xf7,0x3f,0xd3,0x28,0xf7,0x1f,0x8d,
-0x54,0xf5,0x0b,0xff,0x2e,0xf1,0x01,0xcf,0xee,0x50,0x0c,0x03,0xf6,0x04,0x56,0x9e,
-0xd8,0x64,0x9a,0xaa,0xaa,0xa8,0x5d,0xdd,0xdd,0xd4,0x7f,0xac,0xda,0xf5,0x7f,0x7a,
-0xc7,0x04,0x00,0x82,0x8a,0xc7,0xf5,0x4f,0xff,0xff,0xf3,0x01,0x38,0x04,0x20,0x08,
-0xa0,0x74,0x04,0xf2,0x05,0xfb,0x00,0x00,0x09,0xc7,0xfc,0x00,0x00,0x9f,0xfc,0x61,
-0x00,0x09,0xff,0xfc,0x10,0x00,0x9f,0xff,0xc1,0x09,0x00,0x70,0x0d,0xff,0xc1,0x00,
-0x00,0x0f,0xfc,0xc6,0x73,0x02,0xb7,0x6a,0xfc,0x24,0xcc,0xcc,0xcc,0xa0,0x03,0xef,
-0xfd,0xfe,0xef,0xf3,0x3e,0xff,0xe0,0x82,0x7f,0xf4,0xef,0xff,0xfb,0x03,0xff,0xf4,
-0x6f,0xff,0xf2,0x40,0x9f,0xf4,0x06,0xff,0xf9,0xfc,0xbf,0xf3,0x00,0x5f,0xff,0xff,
-0xff,0xe1,0x03,0xef,0xff,0x63,0xe5,0x7a,0x7b,0xff,0x36,0x96,0xcf,0x07,0x02,0x85,
-0xfb,0xcf,0xff,0xff,0x80,0x12,0x22,0x10,0xed,0x07,0xb0,0xc0,0x04,0xc0,0x00,0x05,
-0xf0,0x5f,0xe7,0x77,0x7a,0xf0,0x81,0x02,0x33,0xe0,0x0c,0xd0,0x0b,0x1c,0x0a,0x01,
-0x00,0x2f,0xfd,0x00,0x01,0x00,0x03,0x1b,0xf8,0x08,0x00,0x00,0x01,0x00,0x74,0xfc,
-0xfc,0x00,0xff,0xfc,0x00,0xfa,0xcb,0x14,0x0b,0x01,0x00,0x11,0x01,0xc1,0x1b,0x0c,
-0x01,0x00,0x2f,0xf4,0x00,0x01,0x00,0x15,0x1e,0xf0,0x1e,0x00,0x0e,0x90,0x00,0xb2,
-0xfc,0x00,0xff,0x00,0x00,0xf7,0xff,0xfa,0xfb,0x00,0xf9,0x11,0x00,0x10,0xff,0x28,
-0x04,0x2d,0xfc,0xfe,0x92,0x00,0x30,0xfe,0x00,0xfe,0x2e,0x00,0x1e,0x00,0x01,0x00,
-0x1c,0xfe,0x0a,0x00,0x19,0xff,0x1f,0x00,0x03,0x0e,0x00,0x13,0xf9,0x0b,0x00,0x10,
-0xfe,0x02,0x00,0x2f,0xfd,0xfe,0x9c,0x00,0x0a,0x15,0x01,0x3c,0x00,0x11,0xff,0x34,
-0x00,0x39,0xff,0xfe,0xfe,0xd6,0x00,0x35,0xf4,0x00,0xed,0x24,0x00,0x40,0xfe,0xff,
-0x00,0x00,0x0e,0x04,0x2e,0xfe,0xfe,0x44,0x00,0x10,0xfe,0x08,0x00,0x0f,0x6b,0x00,
-0x08,0x1f,0xfe,0x43,0x01,0x0d,0x1b,0xfc,0x25,0x00,0x12,0xfe,0x67,0x00,0x22,0xfe,
-0xfd,0x09,0x01,0x14,0xe8,0x6c,0x00,0x97,0xfb,0x00,0x00,0xed,0xfc,0xf4,0xf6,0x00,
-0xef,0x08,0x02,0x25,0xf7,0xfa,0x0c,0x00,0x00,0x77,0x04,0x35,0xf6,0x00,0xf2,0x48,
-0x01,0x21,0xff,0xff,0x0c,0x01,0x1f,0x01,0xf7,0x01,0x01,0x10,0xfd,0xd2,0x00,0x0f,
-0x99,0x00,0x0c,0x3e,0xfa,0x00,0xff,0x69,0x02,0x03,0x12,0x00,0xb1,0xf1,0xf0,0x00,
-0x00,0xfa,0xfe,0xef,0xff,0x01,0x00,0x01,0x60,0x00,0xd3,0xf8,0xf9,0x00,0xf8,0xf9,
-0xfb,0xf8,0x00,0xf9,0xfb,0xfc,0xfb,0xfc,0x1a,0x01,0x66,0xf0,0xfd,0x00,0x00,0xfb,
-0xff,0x2b,0x01,0x50,0xfd,0xfd,0x00,0x00,0xfd,0x44,0x01,0x01,0x30,0x05,0x02,0x24,
-0x00,0x22,0xf7,0xfc,0x51,0x00,0x13,0x01,0x24,0x00,0x23,0xfe,0xfe,0x6c,0x01,0x08,
-0xa1,0x01,0x14,0xfd,0x20,0x01,0x15,0x01,0x51,0x01,0x02,0xb0,0x01,0x04,0x30,0x01,
-0xe0,0x01,0xfd,0xf1,0xfc,0x00,0x00,0xf9,0xfe,0xf9,0xff,0x01,0xf9,0x01,0x01,0x92,
-0x00,0xe6,0xfb,0xfb,0xfe,0xfd,0xfb,0xfd,0xfc,0xfe,0xfd,0xff,0x00,0xfe,0xfe,0x01,
-0xc5,0x00,0x2a,0x01,0xfe,0x34,0x02,0x0c,0xf8,0x01,0x09,0x19,0x00,0x1e,0x00,0x01,
-0x00,0x1f,0xfb,0x31,0x01,0x09,0x1f,0xff,0xf0,0x01,0x10,0x11,0xff,0x97,0x01,0x0e,
-0x5f,0x00,0x0f,0x4f,0x00,0x07,0x0f,0x1d,0x00,0x0a,0x1e,0x01,0xdd,0x01,0x19,0x01,
-0x81,0x00,0x12,0x01,0x14,0x03,0x0f,0x01,0x00,0x22,0x0b,0x81,0x00,0x1f,0xf6,0xd8,
-0x00,0x10,0x00,0x8e,0x00,0x1c,0xf7,0x31,0x02,0x20,0xff,0x01,0x4b,0x00,0x10,0x04,
-0x2b,0x02,0x0f,0x6f,0x00,0x15,0x1b,0x01,0xc4,0x04,0x02,0xa7,0x03,0x1d,0x01,0x14,
-0x01,0x1f,0xf7,0xd8,0x00,0x24,0x1f,0xff,0x24,0x00,0x26,0x0f,0x3d,0x00,0x07,0x03,
-0x49,0x05,0x21,0x02,0x03,0x06,0x2d,0x2d,0x04,0x05,0x21,0x00,0xf2,0x0c,0x06,0x07,
-0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,
-0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x8a,0x6f,0x70,0x1b,0x1c,0x00,0x1d,
-0x1e,0x00,0x1f,0xa6,0x15,0xe4,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,
-0x25,0x26,0x24,0x27,0xc8,0x60,0x0f,0x01,0x00,0xff,0xff,0xa8,0x02,0x1c,0x03,0x20,
-0x03,0x02,0x17,0x03,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x00,0x06,0x1b,0x03,0x24,
-0x36,0x12,0x0c,0x30,0x36,0xa0,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,
-0xad,0x0d,0x00,0x0a,0x79,0x52,0x17,0x17,0x17,0x18,0x17,0x15,0x33,0xd2,0x19,0x1a,
-0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x97,0x73,0x0e,0x01,0x00,
-0x1f,0x24,0x16,0x03,0xff,0xff,0x91,0x50,0x00,0x00,0x00,0x00,0x00,
+0x20,0xf2,0x00,0x2a,0x00,0x02,0x0c,0x00,0x01,0x2a,0x00,0x12,0xa0,0x2a,0x00,0x40,
+0x00,0x00,0x04,0xb3,0x1b,0x00,0xf1,0x0b,0xa8,0xf5,0x00,0x00,0x48,0x05,0x50,0x00,
+0x03,0x00,0xff,0xcd,0xaa,0xaa,0xad,0xd1,0x8c,0x20,0x37,0x00,0x06,0x30,0x00,0x00,
+0x09,0x4d,0xfd,0x00,0x24,0x7f,0xc0,0x5c,0x01,0xf0,0x14,0x7b,0xca,0x20,0x08,0xfe,
+0x6f,0xd0,0x0f,0xde,0x27,0xf4,0x2f,0x96,0x45,0xf6,0x3f,0xf7,0x1f,0xf7,0x3f,0xd3,
+0x28,0xf7,0x1f,0x8d,0x54,0xf5,0x0b,0xff,0x2e,0xf1,0x01,0xcf,0xee,0x50,0x0c,0x03,
+0xf6,0x04,0x56,0x9e,0xd8,0x64,0x9a,0xaa,0xaa,0xa8,0x5d,0xdd,0xdd,0xd4,0x7f,0xac,
+0xda,0xf5,0x7f,0x7a,0xc7,0x04,0x00,0x82,0x8a,0xc7,0xf5,0x4f,0xff,0xff,0xf3,0x01,
+0x38,0x04,0x20,0x08,0xa0,0x74,0x04,0xf2,0x05,0xfb,0x00,0x00,0x09,0xc7,0xfc,0x00,
+0x00,0x9f,0xfc,0x61,0x00,0x09,0xff,0xfc,0x10,0x00,0x9f,0xff,0xc1,0x09,0x00,0x82,
+0x0d,0xff,0xc1,0x00,0x00,0x0f,0xfc,0x10,0x38,0x05,0xfc,0x27,0x00,0x00,0x2b,0xcc,
+0xcc,0xcc,0xa0,0x03,0xef,0xfd,0xfe,0xef,0xf3,0x3e,0xff,0xe0,0x82,0x7f,0xf4,0xef,
+0xff,0xfb,0x03,0xff,0xf4,0x6f,0xff,0xf2,0x40,0x9f,0xf4,0x06,0xff,0xf9,0xfc,0xbf,
+0xf3,0x00,0x5f,0xff,0xff,0xff,0xe1,0x03,0xef,0xff,0x63,0xe5,0x7a,0x7b,0xff,0x36,
+0x96,0xcf,0x07,0x02,0x75,0xfb,0xcf,0xff,0xff,0x80,0x12,0x22,0xf9,0x04,0xc0,0x01,
+0xc0,0x04,0xc0,0x00,0x05,0xf0,0x5f,0xe7,0x77,0x7a,0xf0,0x81,0x02,0xb0,0xe0,0x0c,
+0xd0,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -2089,11 +2144,22 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 176, .range_length = 63475, .glyph_id_start = 115, .list_length = 681, .type = 3, .unicode_list = 6368, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[41226] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 5839, .size = 4075, .comp_size = 3724 },
+{ .bitmap_start = 4075, .comp_offset = 9563, .size = 4055, .comp_size = 3801 },
+{ .bitmap_start = 8130, .comp_offset = 13364, .size = 4048, .comp_size = 3798 },
+{ .bitmap_start = 12178, .comp_offset = 17162, .size = 4078, .comp_size = 3800 },
+{ .bitmap_start = 16256, .comp_offset = 20962, .size = 4089, .comp_size = 3911 },
+{ .bitmap_start = 20345, .comp_offset = 24873, .size = 4057, .comp_size = 3920 },
+{ .bitmap_start = 24402, .comp_offset = 28793, .size = 4079, .comp_size = 3890 },
+{ .bitmap_start = 28481, .comp_offset = 32683, .size = 1719, .comp_size = 1438 },
+};
+
+static uint8_t etxUncompBuf[11026] __SDRAMFONTS;
 
 const etxLz4Font lv_font_cn_XXS = {
-.uncomp_size = 40962,
-.comp_size = 33245,
+.uncomp_size = 10762,
+.comp_size = 5839,
 .line_height = 12,
 .base_line = 3,
 .subpx = 0,
@@ -2106,12 +2172,13 @@ const etxLz4Font lv_font_cn_XXS = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 36,
-.glyph_bitmap = 7730,
-.class_pair_values = 37930,
-.left_class_mapping = 39370,
-.right_class_mapping = 40166,
+.class_pair_values = 7730,
+.left_class_mapping = 9170,
+.right_class_mapping = 9966,
+.block_num = 8,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 41226,
+.lvglFontBufSize = 11026,
 };
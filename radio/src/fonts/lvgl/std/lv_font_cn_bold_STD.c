@@ -260,4273 +260,4659 @@ static const uint8_t lz4FontData[] ={
 0x28,0x54,0x08,0x00,0x13,0x8c,0x08,0x00,0x13,0xf0,0x08,0x00,0x22,0x54,0x55,0x08,
 0x00,0xf2,0x03,0xb8,0x55,0x01,0x14,0x15,0x0e,0x00,0xff,0x4b,0x56,0x01,0x0e,0x0c,
 0x10,0x01,0xfe,0xab,0x56,0x60,0x00,0x21,0x1b,0x57,0xa8,0x00,0xb2,0xfd,0xac,0x57,
-0x01,0x14,0x14,0x0c,0x00,0x00,0x24,0x58,0x60,0x00,0xf0,0xff,0xff,0xff,0xff,0xff,
-0xff,0x1d,0x84,0x58,0x21,0x10,0x11,0x0b,0x00,0x01,0x00,0x00,0x72,0x1f,0xb5,0x21,
-0x51,0x2f,0x50,0x4d,0x5a,0x4d,0x5b,0x4d,0x5d,0x4d,0x5e,0x4d,0x7a,0x4d,0x7d,0x4d,
-0x82,0x4d,0x89,0x4d,0x8a,0x4d,0x8b,0x4d,0x99,0x4d,0x9b,0x4d,0x9c,0x4d,0xa0,0x4d,
-0xa8,0x4d,0xdc,0x4d,0xde,0x4d,0xf4,0x4d,0xfb,0x4d,0xfe,0x4d,0x15,0x4e,0x1b,0x4e,
-0x1e,0x4e,0x26,0x4e,0x35,0x4e,0x3a,0x4e,0x40,0x4e,0x46,0x4e,0x4b,0x4e,0x4d,0x4e,
-0x60,0x4e,0x70,0x4e,0x7f,0x4e,0x9d,0x4e,0x9e,0x4e,0x9f,0x4e,0xa3,0x4e,0xa5,0x4e,
-0xac,0x4e,0xcf,0x4e,0xdb,0x4e,0xeb,0x4e,0xf7,0x4e,0x14,0x4f,0x2d,0x4f,0x31,0x4f,
-0x3e,0x4f,0x3f,0x4f,0x5d,0x4f,0x62,0x4f,0x8c,0x4f,0x9f,0x4f,0xac,0x4f,0xcf,0x4f,
-0xf8,0x4f,0x1f,0x50,0x95,0x50,0x99,0x50,0x9b,0x50,0xb5,0x50,0xb8,0x50,0xbc,0x50,
-0xc0,0x50,0xc3,0x50,0xc6,0x50,0xc7,0x50,0xc8,0x50,0xcc,0x50,0xd5,0x50,0xdc,0x50,
-0xe9,0x50,0x02,0x51,0x16,0x51,0x1f,0x51,0x30,0x51,0x4a,0x51,0x4b,0x51,0x4d,0x51,
-0x56,0x51,0x57,0x51,0x67,0x51,0x6b,0x51,0x6d,0x51,0x70,0x51,0x79,0x51,0x7b,0x51,
-0x80,0x51,0x86,0x51,0x87,0x51,0x89,0x51,0x9d,0x51,0xbf,0x51,0xef,0x51,0xf0,0x51,
-0xf8,0x51,0x55,0x52,0x58,0x52,0x66,0x52,0x89,0x52,0x8a,0x52,0x97,0x52,0x9a,0x52,
-0x9f,0x52,0xa5,0x52,0xb1,0x52,0xbb,0x52,0xd2,0x52,0xdb,0x52,0xef,0x52,0x12,0x53,
-0x19,0x53,0x1a,0x53,0x1c,0x53,0x1d,0x53,0x21,0x53,0x26,0x53,0x28,0x53,0x30,0x53,
-0x33,0x53,0x3a,0x53,0x3f,0x53,0x40,0x53,0x43,0x53,0x47,0x53,0x58,0x53,0x5c,0x53,
-0x5d,0x53,0x5e,0x53,0x61,0x53,0x67,0x53,0x76,0x53,0x7b,0x53,0x7f,0x53,0x9a,0x53,
-0xb8,0x53,0xcd,0x53,0xdc,0x53,0x1d,0x54,0xb8,0x55,0x2e,0x56,0x30,0x56,0x44,0x56,
-0x4a,0x56,0x4d,0x56,0x4e,0x56,0x56,0x56,0x78,0x56,0x80,0x56,0x90,0x56,0x97,0x56,
-0xa7,0x56,0xdb,0x56,0x4a,0x57,0xbb,0x57,0xee,0x57,0x40,0x58,0x57,0x58,0x5d,0x58,
-0x66,0x58,0x6a,0x58,0x77,0x58,0x79,0x58,0x7a,0x58,0x81,0x58,0x89,0x58,0xcd,0x58,
-0x1b,0x59,0xa0,0x5a,0xa7,0x5a,0xa8,0x5a,0xb6,0x5a,0xd3,0x5a,0xd9,0x5a,0xdc,0x5a,
-0xea,0x5a,0xee,0x5a,0x09,0x5b,0x0d,0x5b,0x48,0x5b,0x49,0x5b,0x4c,0x5b,0x54,0x5b,
-0x56,0x5b,0x5f,0x5b,0x8a,0x5b,0x8e,0x5b,0x90,0x5b,0x9f,0x5b,0xa5,0x5b,0x35,0x5d,
-0x36,0x5d,0x3e,0x5d,0x42,0x5d,0x53,0x5d,0x5c,0x5d,0x76,0x5d,0x77,0x5d,0x88,0x5d,
-0x8d,0x5d,0x95,0x5d,0xa5,0x5d,0xc3,0x5d,0xc6,0x5d,0xdf,0x5d,0xe4,0x5d,0xf6,0x5d,
-0x46,0x5e,0x4a,0x5e,0x50,0x5e,0x52,0x5e,0x5f,0x5e,0x65,0x5e,0x81,0x5e,0x89,0x5e,
-0x8a,0x5e,0xa3,0x5e,0xa5,0x5e,0xb2,0x5e,0xc1,0x5e,0xd4,0x5e,0xd5,0x5e,0xd8,0x5e,
-0xfa,0x5e,0xfe,0x5e,0x07,0x5f,0x13,0x5f,0x15,0x5f,0x27,0x5f,0x3b,0x5f,0x4d,0x5f,
-0x51,0x5f,0x70,0x5f,0x75,0x5f,0x8b,0x5f,0xb2,0x5f,0xbf,0x5f,0xfc,0x5f,0x15,0x60,
-0x5f,0x60,0x6f,0x60,0xb2,0x60,0x5f,0x61,0x60,0x61,0x66,0x61,0x7a,0x61,0x90,0x61,
-0x97,0x61,0x9b,0x61,0xa3,0x61,0xb7,0x61,0xb9,0x61,0xbb,0x61,0xbc,0x61,0xce,0x61,
-0xf4,0x61,0xf5,0x61,0x19,0x62,0x22,0x62,0x2f,0x62,0x38,0x62,0x39,0x62,0x4e,0x62,
-0x51,0x62,0x57,0x62,0x59,0x62,0x7f,0x62,0xb2,0x62,0xbe,0x62,0xc7,0x62,0xe2,0x62,
-0xf5,0x62,0xf7,0x62,0xf8,0x62,0x1f,0x63,0x20,0x63,0x22,0x63,0x44,0x63,0x97,0x63,
-0xc8,0x63,0xfd,0x63,0x1d,0x64,0x36,0x64,0x7f,0x64,0x86,0x64,0x89,0x64,0x8e,0x64,
-0x95,0x64,0x98,0x64,0x9f,0x64,0xa1,0x64,0xa9,0x64,0xc0,0x64,0xc4,0x64,0xd7,0x64,
-0xec,0x64,0xfd,0x64,0xff,0x64,0x00,0x65,0x09,0x65,0x1b,0x65,0x30,0x65,0x35,0x65,
-0x46,0x65,0x5e,0x65,0x6f,0x65,0x70,0x65,0x7f,0x65,0x8e,0x65,0xbe,0x65,0xbf,0x65,
-0xd2,0x65,0x42,0x66,0x44,0x66,0x4f,0x66,0x50,0x66,0x59,0x66,0x6f,0x66,0x7a,0x66,
-0x7c,0x66,0x8a,0x66,0x96,0x66,0xb1,0x66,0xb5,0x66,0xcf,0x66,0xd1,0x66,0xec,0x66,
-0x14,0x67,0x35,0x67,0x57,0x67,0x5f,0x67,0x71,0x67,0x87,0x67,0x8c,0x67,0x96,0x67,
-0x10,0x68,0x71,0x69,0x7a,0x69,0x77,0x6a,0xb2,0x6a,0xb3,0x6a,0xb4,0x6a,0xb5,0x6a,
-0xcb,0x6a,0xda,0x6a,0x05,0x6b,0x24,0x6b,0x84,0x6b,0xb0,0x6b,0xf1,0x6b,0x09,0x6c,
-0x0f,0x6c,0x25,0x6c,0x32,0x6c,0x38,0x6c,0x6b,0x6c,0x82,0x6c,0x8b,0x6c,0x91,0x6c,
-0x9b,0x6c,0xd8,0x6c,0x47,0x6d,0x4b,0x6d,0x55,0x6d,0x60,0x6d,0x79,0x6d,0x88,0x6d,
-0xce,0x6d,0xe0,0x6d,0x21,0x6e,0x2a,0x6e,0x2e,0x6e,0x31,0x6e,0x34,0x6e,0x10,0x6f,
-0xbb,0x6f,0xbf,0x6f,0xc5,0x6f,0x09,0x70,0x76,0x70,0x86,0x70,0xd4,0x70,0x7c,0x71,
-0x97,0x71,0x98,0x71,0xa9,0x71,0xc9,0x71,0x06,0x72,0xd7,0x72,0xff,0x72,0x00,0x73,
-0x3d,0x73,0x56,0x73,0xae,0x73,0x6f,0x74,0x78,0x74,0x85,0x74,0x9c,0x74,0xb5,0x74,
-0xcd,0x75,0xd4,0x75,0x1a,0x76,0x21,0x76,0x26,0x76,0x28,0x76,0x3e,0x76,0x44,0x76,
-0x48,0x76,0x5b,0x76,0x6f,0x76,0xfc,0x76,0x35,0x77,0x51,0x77,0xbc,0x77,0xbe,0x77,
-0x8a,0x78,0xd1,0x78,0x0b,0x79,0x22,0x79,0x3f,0x79,0x40,0x79,0x4b,0x79,0x5b,0x79,
-0x83,0x79,0xca,0x79,0xd1,0x79,0xe7,0x79,0x2e,0x7a,0x3f,0x7a,0x7c,0x7a,0x99,0x7a,
-0xce,0x7a,0xe7,0x7a,0xf1,0x7a,0xcb,0x7b,0xe8,0x7b,0x0e,0x7c,0x4b,0x7c,0x77,0x7c,
-0x7f,0x7c,0xf2,0x7d,0xf7,0x7d,0x05,0x7e,0x0f,0x7e,0x13,0x7e,0x14,0x7e,0x16,0x7e,
-0x18,0x7e,0x1f,0x7e,0x21,0x7e,0x23,0x7e,0x2d,0x7e,0x2f,0x7e,0x3d,0x7e,0x4f,0x7e,
-0x63,0x7e,0x66,0x7e,0x79,0x7e,0xbe,0x7e,0xde,0x7e,0x4b,0x7f,0x4c,0x7f,0x55,0x7f,
-0x67,0x7f,0x76,0x7f,0xa4,0x7f,0x1c,0x80,0x4d,0x80,0x59,0x80,0x6a,0x80,0x3a,0x81,
-0x43,0x81,0x7a,0x81,0x85,0x81,0xc2,0x81,0xd2,0x81,0x41,0x82,0x53,0x82,0xc7,0x82,
-0x2c,0x83,0x54,0x83,0x8d,0x83,0xb1,0x83,0x2d,0x84,0x1f,0x85,0x52,0x86,0x0a,0x87,
-0x9c,0x87,0xb5,0x87,0xb8,0x87,0xc0,0x87,0xfb,0x87,0x15,0x88,0xcf,0x88,0xd1,0x88,
-0xd6,0x88,0x14,0x89,0x16,0x89,0x18,0x89,0x22,0x89,0x33,0x89,0x36,0x89,0x50,0x89,
-0xb6,0x8a,0xf1,0x8a,0xf4,0x8a,0xfe,0x8a,0x00,0x8b,0x0e,0x8b,0x0f,0x8b,0x11,0x8b,
-0x25,0x8b,0x2d,0x8b,0x32,0x8b,0x36,0x8b,0x3d,0x8b,0x3f,0x8b,0x44,0x8b,0x47,0x8b,
-0x4b,0x8b,0x53,0x8b,0x81,0x8b,0x6f,0x8c,0x75,0x8c,0x84,0x8c,0xc7,0x8c,0xd5,0x8c,
-0x03,0x8d,0x2d,0x8d,0x2f,0x8d,0x3f,0x8d,0x43,0x8d,0x7a,0x8d,0xfb,0x8d,0xb6,0x8e,
-0xbc,0x8e,0xbe,0x8e,0xc4,0x8e,0xcd,0x8e,0xd3,0x8e,0xe1,0x8e,0xe3,0x8e,0x09,0x8f,
-0x17,0x8f,0x20,0x8f,0x2b,0x8f,0x2e,0x8f,0x2f,0x8f,0x40,0x8f,0x50,0x8f,0x56,0x8f,
-0x59,0x8f,0x6a,0x8f,0x6f,0x8f,0x8b,0x8f,0xa3,0x8f,0xb5,0x8f,0x38,0x90,0x9d,0x90,
-0x17,0x91,0x1a,0x91,0x1d,0x91,0x1f,0x91,0xc4,0x91,0xd8,0x93,0xef,0x93,0xfe,0x93,
-0x51,0x94,0x69,0x94,0x7e,0x94,0xac,0x94,0xcf,0x94,0x38,0x95,0x3d,0x95,0x3e,0x95,
-0x42,0x95,0x44,0x95,0x84,0x95,0x86,0x95,0x90,0x95,0x94,0x95,0x9d,0x95,0xa0,0x95,
-0xb4,0x95,0xc7,0x95,0xdf,0x95,0xe4,0x95,0xec,0x95,0x16,0x96,0x46,0x96,0x50,0x96,
-0x57,0x96,0xa9,0x96,0xae,0x96,0xb2,0x96,0x39,0x97,0x43,0x97,0xc5,0x97,0xc6,0x97,
-0xc9,0x97,0xca,0x97,0xcb,0x97,0xd4,0x97,0xe1,0x97,0xe8,0x97,0xec,0x97,0x2e,0x98,
-0xd8,0x98,0xc1,0x99,0xc6,0x99,0xce,0x99,0xdc,0x99,0x28,0x9a,0x73,0x9d,0xf6,0x9d,
-0x28,0x9e,0xa0,0x9e,0x51,0xef,0x58,0xef,0x5b,0xef,0x5c,0xef,0x5d,0xef,0x61,0xef,
-0x63,0xef,0x65,0xef,0x69,0xef,0x6c,0xef,0x71,0xef,0x76,0xef,0x77,0xef,0x78,0xef,
-0x8e,0xef,0x93,0xef,0x98,0xef,0x9b,0xef,0x9c,0xef,0x9d,0xef,0xa1,0xef,0xa2,0xef,
-0xa3,0xef,0xa4,0xef,0xb7,0xef,0xb8,0xef,0xbe,0xef,0xc0,0xef,0xc1,0xef,0xc4,0xef,
-0xc7,0xef,0xc8,0xef,0xc9,0xef,0xcb,0xef,0xe3,0xef,0xe5,0xef,0x14,0xf0,0x15,0xf0,
-0x17,0xf0,0x19,0xf0,0x30,0xf0,0x37,0xf0,0x3a,0xf0,0x43,0xf0,0x6c,0xf0,0x74,0xf0,
-0xab,0xf0,0x3b,0xf1,0x90,0xf1,0x91,0xf1,0x92,0xf1,0x93,0xf1,0x94,0xf1,0xd7,0xf1,
-0xe3,0xf1,0x3d,0xf2,0x54,0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0x0f,0xf6,0x0e,0xf6,
-0x0e,0xf5,0x0d,0xf5,0x0d,0xf4,0x0c,0xf4,0x0c,0xf3,0x0b,0xf3,0x02,0x30,0x03,0x60,
-0x0f,0xf6,0x0b,0xe3,0x8f,0x1f,0xa8,0xf0,0xf9,0x8f,0x0f,0x78,0xd0,0xf6,0x36,0x07,
-0x20,0x00,0x06,0xf0,0x7f,0x00,0x00,0x09,0xd0,0xac,0x00,0x00,0x0c,0xa0,0xd9,0x00,
-0x0e,0xff,0xff,0xff,0xf3,0x06,0x8f,0x98,0xf8,0x61,0x00,0x4f,0x25,0xf1,0x00,0x01,
-0x7f,0x28,0xf1,0x10,0x8f,0xff,0xff,0xff,0xa0,0x24,0xdc,0x4e,0xb4,0x20,0x00,0xe8,
-0x0f,0x70,0x00,0x00,0xf5,0x1f,0x40,0x00,0x03,0xf3,0x4f,0x20,0x00,0x00,0x00,0x74,
-0x00,0x00,0x00,0x0c,0x70,0x00,0x00,0x3a,0xfe,0x70,0x00,0x3f,0xff,0xff,0xa0,0x0a,
-0xfb,0x05,0xff,0x20,0xcf,0x70,0x0d,0xf5,0x0a,0xfc,0x10,0x00,0x00,0x3f,0xff,0x91,
-0x00,0x00,0x3c,0xff,0xf4,0x00,0x00,0x03,0xcf,0xf1,0x18,0x70,0x00,0xef,0x52,0xff,
-0x30,0x0e,0xf5,0x0c,0xfe,0x8b,0xff,0x20,0x2d,0xff,0xff,0x60,0x00,0x03,0xf8,0x10,
-0x00,0x00,0x0e,0x50,0x00,0x05,0xdf,0xa0,0x00,0x00,0x00,0x1f,0xb7,0xf7,0x01,0x80,
-0x00,0x3f,0x40,0xda,0x0a,0xc0,0x00,0x2f,0x82,0xf9,0x3f,0x30,0x00,0x09,0xff,0xe2,
-0xd9,0x00,0x00,0x00,0x23,0x07,0xe1,0x00,0x20,0x00,0x10,0x60,0x06,0x00,0xf1,0x56,
-0xac,0x2c,0xfe,0x50,0x00,0x04,0xf3,0xae,0x5b,0xf0,0x00,0x0d,0x90,0xcb,0x06,0xf1,
-0x00,0x2c,0x10,0xae,0x6c,0xf0,0x00,0x00,0x00,0x1b,0xfd,0x40,0x00,0x3c,0xfd,0x50,
-0x00,0x00,0x1e,0xff,0xff,0x30,0x00,0x05,0xfb,0x08,0xf7,0x00,0x00,0x6f,0xa0,0x8f,
-0x60,0x00,0x02,0xff,0xaf,0xd0,0x00,0x00,0x09,0xff,0xb1,0x00,0x00,0x05,0xff,0xfc,
-0x04,0xd8,0x02,0xff,0x6e,0xf9,0x7f,0x80,0x6f,0xe0,0x3f,0xff,0xf4,0x05,0xff,0x10,
-0x6f,0xfd,0x00,0x0d,0xfe,0xcf,0xff,0xe2,0x00,0x19,0xef,0xd8,0xaf,0xd0,0x8f,0x28,
-0xf2,0x8f,0x18,0xf0,0x47,0x5f,0x1f,0xf1,0x07,0x03,0xe1,0x00,0x1e,0xd1,0x00,0xaf,
-0x20,0x02,0xfa,0x00,0x08,0xf5,0x00,0x0b,0xf2,0x00,0x0e,0xf0,0x00,0x0f,0xe0,0x03,
-0x00,0xf0,0x36,0xf0,0x00,0x0d,0xf0,0x00,0x0a,0xf3,0x00,0x05,0xf7,0x00,0x00,0xee,
-0x00,0x00,0x6f,0x70,0x00,0x09,0xf2,0x00,0x00,0x70,0x00,0x00,0x07,0xb0,0x00,0x4f,
-0xa0,0x00,0x8f,0x50,0x01,0xfd,0x00,0x0c,0xf3,0x00,0x8f,0x70,0x06,0xfa,0x00,0x5f,
-0xb0,0x04,0xfc,0x00,0x5f,0xa0,0x06,0xf8,0x00,0x9f,0x50,0x0d,0xf0,0x04,0xf9,0x00,
-0xcf,0x10,0x8f,0x40,0x04,0x30,0x00,0x00,0x4b,0x01,0xf1,0x08,0x0f,0x60,0x00,0x8d,
-0x6e,0x89,0xd0,0x5b,0xff,0xfe,0x90,0x00,0xaf,0xe1,0x00,0x07,0xf4,0xeb,0x00,0x09,
-0x90,0x6d,0x10,0x80,0x00,0xf0,0x02,0x07,0xa4,0x00,0x00,0x00,0xbf,0x60,0x00,0x00,
-0x0b,0xf6,0x00,0x01,0x22,0xcf,0x72,0x20,0x88,0x01,0x50,0x48,0xff,0xff,0xff,0xf4,
-0x12,0x00,0x05,0x1b,0x00,0xf9,0x1a,0x00,0x0e,0xf0,0xef,0x0f,0xd4,0xf8,0x5c,0x00,
-0x2e,0xee,0xe3,0x2f,0xff,0xf4,0x03,0x70,0x0f,0xf7,0x0a,0xf4,0x00,0x00,0x1f,0x90,
-0x00,0x06,0xf4,0x00,0x00,0xbe,0x00,0x00,0x0f,0xa0,0x00,0x05,0xf5,0x00,0x00,0xaf,
-0x0a,0x00,0xff,0x41,0xb0,0x00,0x04,0xf6,0x00,0x00,0xaf,0x10,0x00,0x0e,0xb0,0x00,
-0x00,0x00,0x6d,0xfe,0x80,0x00,0x6f,0xff,0xff,0x90,0x0e,0xf8,0x05,0xff,0x12,0xff,
-0x10,0x0e,0xf4,0x3f,0xf0,0x00,0xdf,0x64,0xff,0x00,0x0d,0xf7,0x4f,0xf0,0x00,0xdf,
-0x73,0xff,0x00,0x0d,0xf6,0x2f,0xf1,0x00,0xef,0x40,0xef,0x80,0x5f,0xf1,0x06,0xff,
-0xff,0xf9,0x00,0x06,0xdf,0xe8,0x00,0x00,0x16,0xc4,0x3a,0xff,0xf4,0xbf,0xff,0xf4,
-0x65,0x0f,0xf4,0x00,0x03,0x00,0x05,0xf1,0x35,0x7d,0xfd,0x80,0x00,0xaf,0xff,0xff,
-0xa0,0x2f,0xf4,0x06,0xff,0x05,0xec,0x00,0x1f,0xf2,0x00,0x00,0x04,0xff,0x00,0x00,
-0x00,0xdf,0x80,0x00,0x00,0xbf,0xd0,0x00,0x00,0xaf,0xe2,0x00,0x00,0x8f,0xf3,0x00,
-0x00,0x6f,0xf4,0x00,0x00,0x2f,0xff,0xee,0xee,0x83,0xff,0xff,0xff,0xf9,0x01,0x9e,
-0xfd,0x70,0x00,0xcf,0xfe,0xff,0xa0,0x3f,0xf3,0x05,0xff,0x11,0x33,0x36,0x00,0xf0,
-0x0b,0x08,0xfe,0x00,0x00,0xef,0xfd,0x20,0x00,0x0c,0xef,0xf7,0x00,0x00,0x00,0x3f,
-0xf2,0x25,0x40,0x00,0xef,0x56,0xff,0x20,0x4f,0xf4,0x0d,0x6a,0x0e,0xf0,0x19,0x19,
-0xdf,0xd8,0x00,0x00,0x00,0x2f,0xf7,0x00,0x00,0x0c,0xff,0x70,0x00,0x06,0xff,0xf7,
-0x00,0x01,0xee,0xdf,0x70,0x00,0xaf,0x5c,0xf7,0x00,0x4f,0xb0,0xcf,0x70,0x0d,0xf1,
-0x0c,0xf7,0x07,0xff,0xee,0xff,0xfa,0x43,0x01,0xa0,0xc0,0x00,0x00,0xcf,0x70,0x00,
-0x00,0x0c,0xf7,0x00,0x09,0x00,0xf0,0x11,0x04,0xff,0xff,0xff,0x20,0x6f,0xff,0xff,
-0xf2,0x08,0xf9,0x00,0x00,0x00,0x9f,0x70,0x00,0x00,0x0b,0xfc,0xef,0xb1,0x00,0xdf,
-0xfd,0xff,0xd0,0x01,0x51,0x03,0xff,0x40,0x29,0x00,0xf0,0x31,0x17,0x70,0x00,0xcf,
-0x70,0xff,0x70,0x3f,0xf4,0x07,0xff,0xff,0xfc,0x00,0x06,0xdf,0xe9,0x00,0x00,0x02,
-0x9d,0xe0,0x00,0x05,0xff,0xfe,0x00,0x02,0xff,0x92,0x00,0x00,0xaf,0xa0,0x00,0x00,
-0x0f,0xf8,0xdf,0xc3,0x02,0xff,0xff,0xff,0xe0,0x3f,0xf7,0x02,0xff,0x63,0xff,0x00,
-0x0b,0xf8,0x1f,0xf2,0x00,0xbf,0x90,0xdf,0x90,0x2f,0xf5,0x04,0x36,0x00,0x31,0x04,
-0xcf,0xe9,0x49,0x03,0xf0,0x07,0x87,0xee,0xee,0xef,0xf6,0x00,0x00,0x02,0xff,0x10,
-0x00,0x00,0x8f,0x90,0x00,0x00,0x0f,0xf3,0x00,0x00,0x06,0xfc,0x12,0x01,0x90,0x60,
-0x00,0x00,0x4f,0xe0,0x00,0x00,0x0b,0xf8,0x1e,0x00,0x90,0x20,0x00,0x00,0x9f,0xb0,
-0x00,0x00,0x1f,0xf5,0x9e,0x01,0xb0,0xfd,0x80,0x00,0x7f,0xff,0xff,0xa0,0x0d,0xf8,
-0x05,0xff,0xd0,0x1d,0xf0,0x04,0xf2,0x0c,0xf9,0x07,0xfe,0x00,0x2d,0xff,0xfe,0x30,
-0x04,0xff,0xff,0xf6,0x00,0xef,0x60,0x3f,0xf2,0xb0,0x01,0xf0,0x03,0x62,0xff,0x50,
-0x3f,0xf5,0x0b,0xff,0xef,0xfd,0x00,0x08,0xdf,0xe9,0x10,0x00,0x6d,0xfd,0x50,0x36,
-0x00,0xf0,0x00,0x50,0x0f,0xf7,0x07,0xfe,0x04,0xff,0x00,0x0f,0xf3,0x4f,0xf0,0x00,
-0xef,0x51,0x24,0x00,0xf2,0x12,0x0a,0xff,0xdf,0xff,0x40,0x0a,0xfe,0x8f,0xf2,0x00,
-0x00,0x05,0xfe,0x00,0x00,0x15,0xef,0x70,0x00,0x9f,0xff,0xb0,0x00,0x09,0xfc,0x60,
-0x00,0x0a,0xe3,0x0f,0xf7,0x03,0x70,0x5f,0x22,0x01,0x4a,0x02,0x74,0xe3,0x0c,0xe2,
-0x1f,0xf5,0x04,0x60,0x7a,0x22,0xa5,0x0b,0xf2,0x0b,0xf2,0x0d,0xf0,0x2f,0xa0,0x3d,
-0x20,0x8c,0x22,0xf0,0x16,0xb2,0x00,0x06,0xdf,0xf2,0x18,0xef,0xfe,0x80,0x9f,0xfa,
-0x40,0x00,0x9f,0xfc,0x60,0x00,0x06,0xdf,0xff,0xa1,0x00,0x04,0xbf,0xf2,0x00,0x00,
-0x02,0x92,0xff,0xff,0xff,0xf0,0xde,0xee,0xee,0xe0,0x2a,0x00,0x00,0x08,0x00,0x00,
-0x10,0x00,0xf0,0x3f,0x0c,0x50,0x00,0x00,0x1f,0xfd,0x70,0x00,0x07,0xdf,0xff,0x92,
-0x00,0x03,0x9e,0xfc,0x00,0x05,0xbf,0xfb,0x09,0xef,0xfe,0x71,0x1f,0xfc,0x50,0x00,
-0x0a,0x30,0x00,0x00,0x03,0xbf,0xeb,0x20,0x2f,0xff,0xff,0xe0,0x8f,0xd0,0x2f,0xf4,
-0x24,0x20,0x0f,0xf5,0x00,0x00,0x6f,0xf1,0x00,0x05,0xff,0x50,0x00,0x0f,0xf6,0x00,
-0x00,0x3f,0xd0,0x00,0x00,0x14,0x30,0x00,0x00,0x06,0x30,0x00,0x00,0x7f,0xf0,0x00,
-0x00,0x3e,0xbf,0x02,0xf2,0x45,0x3a,0xdf,0xeb,0x40,0x00,0x00,0x08,0xfc,0x75,0x6b,
-0xf9,0x00,0x00,0x8f,0x60,0x01,0x00,0x4f,0x70,0x03,0xf8,0x01,0xcf,0xfa,0x07,0xf1,
-0x0a,0xe0,0x0c,0xf6,0xbf,0x01,0xf5,0x0f,0x90,0x5f,0x60,0x9f,0x00,0xd8,0x2f,0x50,
-0xaf,0x10,0xae,0x00,0xb9,0x4f,0x30,0xde,0x00,0xbd,0x00,0xca,0x4f,0x30,0xed,0x00,
-0xcc,0x00,0xd7,0x3f,0x50,0xde,0x00,0xfb,0x02,0xf4,0x0f,0x80,0x9f,0x8b,0xfe,0x6d,
-0xc0,0x0b,0xe1,0x1c,0xfa,0x2d,0xfb,0x10,0x02,0xfc,0x84,0x03,0xb0,0x5f,0xfa,0x77,
-0x99,0x00,0x00,0x00,0x02,0x8d,0xff,0xc6,0x0f,0x00,0x30,0xef,0xa0,0x00,0xd6,0x04,
-0x10,0x00,0x4f,0x04,0x10,0xf5,0x10,0x00,0xf0,0x71,0xdf,0xb0,0x00,0x00,0x4f,0xf4,
-0xff,0x10,0x00,0x0a,0xfb,0x0e,0xf6,0x00,0x00,0xff,0x60,0xaf,0xc0,0x00,0x5f,0xf1,
-0x05,0xff,0x20,0x0b,0xff,0xff,0xff,0xf7,0x01,0xff,0xff,0xff,0xff,0xd0,0x6f,0xf2,
-0x00,0x05,0xff,0x2c,0xfb,0x00,0x00,0x0e,0xf8,0xff,0xff,0xfd,0x80,0x0f,0xff,0xff,
-0xff,0xb0,0xff,0x50,0x08,0xff,0x1f,0xf5,0x00,0x2f,0xf2,0xff,0x50,0x08,0xfe,0x0f,
-0xff,0xff,0xfe,0x30,0xff,0xdc,0xcf,0xfa,0x0f,0xf5,0x00,0x2f,0xf4,0xff,0x50,0x00,
-0xef,0x7f,0xf5,0x00,0x5f,0xf5,0xff,0xff,0xff,0xfd,0x0f,0xff,0xff,0xd9,0x10,0x00,
-0x19,0xef,0xe9,0x10,0x01,0xdf,0xff,0xff,0xd1,0x0a,0xfe,0x30,0x3e,0xf8,0x0f,0xf6,
-0x00,0x08,0xfd,0x3f,0xf2,0x00,0x00,0x21,0x4f,0xf0,0xa3,0x00,0x00,0x05,0x00,0x00,
-0x0f,0x00,0xf1,0x01,0x11,0x0f,0xf5,0x00,0x08,0xfd,0x0a,0xfd,0x30,0x3e,0xf9,0x01,
-0xef,0xff,0xff,0xd1,0x37,0x00,0x00,0x40,0x00,0x02,0x60,0x00,0x30,0x50,0x3c,0xfd,
-0x60,0x00,0xf0,0x1a,0xf5,0xff,0x50,0x00,0xcf,0x9f,0xf5,0x00,0x0a,0xfb,0xff,0x50,
-0x00,0xaf,0xbf,0xf5,0x00,0x0c,0xf9,0xff,0x50,0x02,0xff,0x5f,0xf5,0x03,0xcf,0xd0,
-0xff,0xff,0xff,0xe3,0x0f,0xff,0xfe,0x92,0x00,0xff,0xff,0xff,0xfa,0x89,0x03,0x44,
-0xff,0x50,0x00,0x00,0x04,0x00,0x00,0xcb,0x00,0x4b,0xff,0xfe,0xee,0xc0,0x14,0x00,
-0x13,0xf9,0x2c,0x00,0x11,0xf6,0x04,0x00,0x0c,0x30,0x00,0x00,0x04,0x00,0x08,0x14,
-0x00,0x03,0x04,0x00,0xf0,0x09,0x00,0x18,0xdf,0xea,0x20,0x00,0x1d,0xff,0xff,0xfe,
-0x10,0x09,0xff,0x40,0x2e,0xf9,0x00,0xef,0x70,0x00,0x6f,0xe0,0x2f,0xf3,0x76,0x02,
-0x10,0xff,0x5b,0x02,0xf0,0x09,0x4f,0xf2,0x07,0xff,0xff,0x02,0xff,0x30,0x5d,0xdf,
-0xf0,0x0e,0xf8,0x00,0x05,0xff,0x00,0x8f,0xf5,0x00,0x8f,0xf0,0x00,0xdf,0x4a,0x03,
-0x40,0x00,0x8d,0xfe,0xc6,0x46,0x00,0x2f,0x1f,0xf4,0x05,0x00,0x02,0x00,0x21,0x05,
-0x02,0x05,0x00,0x0f,0x23,0x00,0x05,0x3b,0xdf,0x8d,0xf8,0x03,0x00,0x4f,0x00,0x00,
-0x06,0xff,0x04,0x00,0x09,0xf0,0x01,0x6a,0x70,0x06,0xfe,0x8f,0xe1,0x1c,0xfb,0x1f,
-0xff,0xff,0xf3,0x02,0xbe,0xfc,0x40,0x32,0x01,0xf0,0x09,0xc0,0xff,0x50,0x0c,0xfe,
-0x10,0xff,0x50,0x8f,0xf4,0x00,0xff,0x54,0xff,0x80,0x00,0xff,0x7e,0xfc,0x00,0x00,
-0xff,0xef,0xf5,0xfa,0x00,0xf0,0x08,0xfd,0x00,0x00,0xff,0xf8,0xff,0x70,0x00,0xff,
-0x80,0xaf,0xf2,0x00,0xff,0x50,0x1e,0xfb,0x00,0xff,0x50,0x06,0xff,0x50,0x7b,0x01,
-0x1e,0xe1,0x10,0x01,0x0e,0x04,0x00,0x03,0x40,0x01,0x11,0xf5,0x04,0x00,0x40,0xf3,
-0x00,0x00,0x4f,0x74,0x05,0x40,0x00,0x9f,0xff,0xff,0x05,0x05,0xf0,0x1a,0xff,0xff,
-0xdf,0x40,0x04,0xfd,0xff,0xff,0x9f,0x90,0x09,0xf9,0xff,0xff,0x4f,0xe0,0x0e,0xf4,
-0xff,0xff,0x4b,0xf4,0x4f,0xb4,0xff,0xff,0x45,0xf9,0x9f,0x54,0xff,0xff,0x50,0xfe,
-0xef,0x05,0xff,0xff,0x50,0xaf,0xfa,0x06,0x00,0x30,0x5f,0xf5,0x05,0x04,0x04,0x50,
-0xf0,0x05,0xff,0xff,0xa0,0x00,0x01,0x10,0xf3,0x05,0x00,0x11,0xfc,0x28,0x01,0xf0,
-0x0d,0x60,0x1f,0xf4,0xff,0xcf,0xe0,0x1f,0xf4,0xff,0x5d,0xf8,0x1f,0xf4,0xff,0x54,
-0xff,0x3f,0xf4,0xff,0x50,0xaf,0xcf,0xf4,0xff,0x50,0x2f,0xff,0xf4,0xa0,0x02,0x01,
-0x8a,0x02,0x00,0x05,0x00,0xf0,0x21,0x5f,0xf4,0x00,0x08,0xdf,0xd8,0x10,0x00,0x0d,
-0xff,0xff,0xfd,0x10,0x09,0xff,0x51,0x4e,0xf9,0x00,0xff,0x70,0x00,0x7f,0xf0,0x3f,
-0xf2,0x00,0x02,0xff,0x34,0xff,0x10,0x00,0x0f,0xf5,0x4f,0xf1,0x00,0x00,0xff,0x53,
-0xff,0x20,0x00,0x2f,0xf3,0x0f,0xf7,0x35,0x01,0x70,0x9f,0xf5,0x04,0xef,0x90,0x00,
-0xdf,0x87,0x02,0x53,0x00,0x8d,0xfd,0x81,0x00,0xfa,0x02,0x00,0x0f,0x02,0xf0,0x01,
-0x05,0xff,0x6f,0xf5,0x00,0x0b,0xfa,0xff,0x50,0x00,0xbf,0xbf,0xf5,0x00,0x4f,0xf7,
-0xe8,0x02,0x50,0x1f,0xff,0xff,0xe9,0x10,0xf6,0x00,0x10,0x0f,0x57,0x03,0x05,0x09,
-0x00,0x20,0x00,0x08,0xd8,0x05,0x13,0x1d,0x78,0x00,0x18,0x5f,0x78,0x00,0x20,0x35,
-0xff,0x24,0x00,0x28,0x5f,0xf0,0x78,0x00,0x57,0x07,0xff,0x00,0x9f,0xf4,0x78,0x00,
-0x20,0xff,0xfd,0x4c,0x02,0x20,0x2d,0xfe,0xcc,0x03,0x90,0x0a,0x50,0xff,0xff,0xfd,
-0x70,0x0f,0xff,0xff,0xb9,0x01,0x60,0x07,0xff,0x4f,0xf5,0x00,0x0f,0xaf,0x02,0x00,
-0x8c,0x00,0x20,0x8f,0xf2,0xad,0x03,0x10,0x0f,0x64,0x01,0xc0,0xff,0x50,0x7f,0xf1,
-0x0f,0xf5,0x00,0xef,0x80,0xff,0x50,0x06,0xa1,0x03,0xf0,0x11,0x0e,0xf9,0x00,0x5c,
-0xff,0xc6,0x00,0x07,0xff,0xff,0xff,0x80,0x0f,0xf9,0x00,0x8f,0xf1,0x1f,0xf5,0x00,
-0x1a,0xa2,0x0c,0xfe,0x60,0x00,0x00,0x02,0xdf,0xff,0xa2,0x00,0xc5,0x04,0x10,0x40,
-0xdf,0x08,0xc0,0xe0,0x5d,0xc0,0x00,0x2f,0xf3,0x2f,0xf7,0x00,0x6f,0xf2,0x09,0xe1,
-0x03,0x60,0x00,0x5c,0xff,0xd7,0x00,0xbf,0x20,0x03,0x20,0xaf,0xff,0x59,0x00,0x10,
-0x04,0xf0,0x05,0x0f,0x05,0x00,0x19,0x5f,0x1f,0xf4,0x00,0x0b,0xfa,0x05,0x00,0x0f,
-0xc1,0xf9,0x0f,0xf5,0x00,0x0d,0xf8,0x0c,0xfc,0x20,0x5f,0xf5,0x03,0x78,0x00,0xf2,
-0x00,0x3b,0xff,0xd8,0x00,0xcf,0xc0,0x00,0x05,0xff,0x37,0xff,0x10,0x00,0xaf,0xe0,
-0xc4,0x00,0xf0,0x0f,0xcf,0xa0,0x03,0xff,0x40,0x07,0xfe,0x00,0x8f,0xe0,0x00,0x2f,
-0xf3,0x0c,0xf9,0x00,0x00,0xcf,0x81,0xff,0x40,0x00,0x07,0xfc,0x5f,0xe0,0x00,0x00,
-0x2f,0xfc,0xf9,0x06,0x01,0xc7,0x00,0x30,0x07,0xff,0xe0,0x46,0x07,0x10,0xf9,0x7c,
-0x06,0xf0,0x31,0x01,0xff,0x10,0x0b,0xfa,0x6f,0xe0,0x04,0xff,0x50,0x0d,0xf6,0x3f,
-0xf1,0x08,0xff,0x90,0x0f,0xf3,0x0f,0xf3,0x0b,0xff,0xc0,0x3f,0xf0,0x0c,0xf6,0x0f,
-0xed,0xf0,0x6f,0xc0,0x09,0xf9,0x2f,0xaa,0xf3,0x9f,0x90,0x05,0xfc,0x6f,0x66,0xf7,
-0xcf,0x60,0x02,0xff,0xaf,0x32,0xfa,0xff,0x20,0x00,0xef,0xff,0x00,0xff,0xff,0x00,
-0x00,0xbf,0xfb,0x03,0x00,0x60,0x00,0x8f,0xf8,0x00,0x7f,0xf8,0x22,0x05,0xf0,0x08,
-0x00,0x4f,0xf5,0x00,0x7f,0xf3,0x00,0x1f,0xfa,0x0d,0xfb,0x00,0x8f,0xf1,0x05,0xff,
-0x41,0xff,0x80,0x00,0xcf,0xc9,0xfe,0x4d,0x05,0xb0,0xf6,0x00,0x00,0x0a,0xff,0xd0,
-0x00,0x00,0x0b,0xff,0xe0,0xe9,0x02,0xf0,0x1f,0xf7,0x00,0x00,0xdf,0xb8,0xff,0x10,
-0x06,0xff,0x31,0xff,0x90,0x0e,0xfa,0x00,0x8f,0xf2,0x8f,0xf2,0x00,0x0e,0xfb,0xbf,
-0xc0,0x00,0x0e,0xfa,0x4f,0xf3,0x00,0x5f,0xf2,0x0c,0xfa,0x00,0xcf,0xa0,0x04,0xff,
-0x23,0xff,0x20,0x00,0xcf,0x8a,0xfa,0x32,0x00,0x10,0xf3,0xf5,0x07,0x10,0xb0,0xdd,
-0x09,0x10,0x30,0x3b,0x01,0x1b,0x20,0x05,0x00,0x00,0xd9,0x08,0x30,0xff,0xf1,0x6f,
-0x7a,0x06,0x00,0x59,0x07,0xa0,0x60,0x00,0x00,0x0c,0xfb,0x00,0x00,0x00,0x7f,0xf2,
-0x0e,0x00,0x00,0x08,0x08,0x00,0x7d,0x07,0x60,0x6f,0xf2,0x00,0x00,0x01,0xff,0xfd,
-0x07,0x10,0xfd,0x53,0x05,0x00,0x05,0x0b,0x10,0x6f,0x05,0x00,0xaf,0x0d,0xdd,0x41,
-0xff,0xf5,0x1f,0xf3,0x01,0xff,0x30,0x05,0x00,0x0a,0xf2,0x03,0xd4,0x1f,0xff,0x50,
-0xdf,0x70,0x00,0x00,0x7f,0xd0,0x00,0x00,0x1f,0xf3,0x00,0x00,0x0b,0xf9,0x5b,0x07,
-0x01,0xca,0x02,0x00,0x1e,0x08,0x00,0x20,0x03,0x20,0x0e,0xf6,0xa4,0x06,0x03,0xdd,
-0x07,0xbf,0xcf,0x80,0x00,0x00,0x6f,0xd0,0xbd,0xd6,0xef,0xf7,0x0c,0x02,0x00,0x06,
-0xf0,0x25,0xbf,0xf7,0xef,0xf7,0x00,0x8f,0x80,0x00,0x0e,0xfe,0x00,0x04,0xfc,0xf4,
-0x00,0xaf,0x2f,0xa0,0x1f,0xa0,0xaf,0x17,0xf5,0x04,0xf7,0xdd,0xdd,0xdd,0xd1,0xff,
-0xff,0xff,0xf2,0x38,0x80,0x00,0xbf,0x80,0x00,0xdf,0x20,0x01,0x9e,0xfc,0x50,0x00,
-0xcf,0xed,0xff,0x40,0x3f,0xf1,0x7a,0x00,0xf3,0x0d,0x01,0x9f,0xb0,0x04,0xcf,0xff,
-0xfb,0x02,0xff,0x74,0xaf,0xb0,0x6f,0xd0,0x0a,0xfb,0x03,0xff,0xee,0xff,0xb0,0x05,
-0xdf,0xb7,0xfe,0x00,0x2f,0xf2,0x7f,0x00,0x02,0x09,0x00,0xf0,0x08,0x7d,0xfb,0x10,
-0x2f,0xff,0xff,0xfc,0x02,0xff,0x60,0x4f,0xf3,0x2f,0xf2,0x00,0xdf,0x52,0xff,0x20,
-0x0c,0xf7,0x2f,0xf2,0x4b,0x08,0x32,0x60,0x3f,0xf3,0x1b,0x00,0xf0,0x06,0x6e,0xfb,
-0x10,0x00,0x8e,0xfd,0x50,0x0a,0xff,0xff,0xf5,0x2f,0xf4,0x08,0xfc,0x6f,0xd0,0x01,
-0x65,0x7f,0xc0,0xbc,0x00,0xe9,0x00,0x22,0x2f,0xf4,0x07,0xfc,0x0a,0xff,0xef,0xf6,
-0x00,0x8e,0xfd,0x60,0x58,0x00,0x50,0x20,0x1a,0xfd,0x7f,0xf2,0x02,0x07,0xf0,0x0b,
-0x22,0xff,0x50,0x7f,0xf2,0x5f,0xe0,0x02,0xff,0x27,0xfc,0x00,0x2f,0xf2,0x5f,0xd0,
-0x02,0xff,0x22,0xff,0x30,0x5f,0xf2,0x0b,0xff,0xdf,0x24,0x00,0xf0,0x05,0x6f,0xf2,
-0x00,0x6d,0xfd,0x70,0x00,0x8f,0xff,0xff,0x70,0x1f,0xf5,0x04,0xff,0x05,0xff,0x99,
-0x9f,0xf2,0x76,0x01,0x20,0x35,0xff,0xee,0x0b,0x30,0xf9,0x00,0x85,0x1b,0x00,0xfe,
-0x09,0xd0,0x00,0x6d,0xfe,0xa1,0x00,0x00,0x6d,0xfa,0x04,0xff,0xfa,0x07,0xfd,0x00,
-0xcf,0xff,0xf7,0x8d,0xfe,0xb5,0x08,0xfc,0x00,0x03,0x00,0xf2,0x06,0x00,0xaf,0xe7,
-0xdf,0x40,0xaf,0xff,0xff,0xf4,0x2f,0xf6,0x04,0xff,0x45,0xfe,0x00,0x0f,0xf4,0x6f,
-0xd0,0x00,0x09,0x00,0x00,0x12,0x00,0x01,0x1b,0x00,0xf0,0x05,0x00,0x9f,0xe7,0xff,
-0x30,0x15,0x00,0x6f,0xf1,0x0b,0xff,0xef,0xf9,0x00,0x1a,0xef,0xd7,0x00,0x3f,0xf1,
-0x74,0x06,0x23,0x10,0x00,0x09,0x00,0xf0,0x06,0x5d,0xfb,0x20,0x3f,0xff,0xff,0xfb,
-0x03,0xff,0x50,0x6f,0xf0,0x3f,0xf1,0x02,0xff,0x13,0xff,0x10,0x2f,0xf2,0x09,0x00,
-0x19,0x23,0x09,0x00,0x8c,0x0c,0xe2,0x1f,0xf4,0x04,0x50,0x0f,0xf4,0x02,0x00,0x70,
-0x00,0xde,0x20,0x1f,0xf4,0x00,0x45,0xfa,0x0a,0x2d,0xff,0x40,0x05,0x00,0x7c,0x02,
-0xff,0x3b,0xff,0xe0,0xaf,0xc3,0x87,0x01,0xf0,0x02,0x20,0xaf,0xe1,0x2f,0xf2,0x7f,
-0xf3,0x02,0xff,0x6f,0xf6,0x00,0x2f,0xff,0xfa,0x00,0x02,0xf6,0x00,0xfe,0x03,0x2f,
-0xfc,0xef,0x70,0x02,0xff,0x26,0xff,0x20,0x2f,0xf2,0x0c,0xfc,0x02,0xff,0x20,0x3f,
-0xf6,0x6e,0x00,0x02,0x02,0x00,0xff,0x12,0x2f,0xf4,0xdf,0xc2,0x6e,0xfb,0x12,0xff,
-0xff,0xff,0xef,0xff,0xfa,0x2f,0xf6,0x06,0xff,0x50,0x8f,0xe2,0xff,0x20,0x3f,0xf0,
-0x04,0xff,0x2f,0xf2,0x03,0xff,0x00,0x4f,0xf2,0x0d,0x00,0x06,0x10,0xf0,0x3b,0x00,
-0x10,0x02,0x13,0x05,0x00,0x37,0x00,0xa0,0x02,0xff,0x10,0x2f,0xf1,0x2f,0xf1,0x02,
-0xff,0x22,0xe2,0x00,0x09,0x09,0x00,0x50,0x20,0x00,0x7d,0xfd,0x70,0x80,0x06,0xf0,
-0x0a,0x90,0x2f,0xf6,0x05,0xff,0x26,0xfe,0x00,0x0d,0xf6,0x7f,0xc0,0x00,0xcf,0x86,
-0xfe,0x00,0x0d,0xf7,0x2f,0xf5,0x05,0xff,0x30,0x9f,0x5f,0x06,0xf0,0x10,0x7d,0xfe,
-0x80,0x00,0x2f,0xf7,0xdf,0xb1,0x02,0xff,0xfd,0xff,0xb0,0x2f,0xf4,0x03,0xff,0x32,
-0xff,0x20,0x0d,0xf5,0x2f,0xf2,0x00,0xcf,0x72,0xff,0x20,0x0e,0xf5,0x3b,0x00,0x10,
-0x22,0xa4,0x04,0x48,0x2f,0xf7,0xdf,0xa1,0xff,0x00,0xf0,0x01,0x00,0x00,0x01,0xaf,
-0xe6,0xef,0x20,0xbf,0xff,0xff,0xf2,0x3f,0xf5,0x06,0xff,0x25,0xa8,0x02,0x32,0x7f,
-0xc0,0x02,0x09,0x00,0x41,0x2f,0xf5,0x06,0xff,0x1b,0x00,0x39,0x01,0xaf,0xd7,0x34,
-0x00,0x21,0x2f,0xf2,0xf2,0x0b,0xab,0xea,0x2f,0xff,0xfa,0x2f,0xfa,0x31,0x2f,0xf2,
-0x00,0x03,0x00,0xf0,0x17,0x02,0xae,0xfc,0x40,0x0d,0xfd,0xcf,0xf3,0x3f,0xf0,0x0a,
-0xd7,0x1f,0xfa,0x51,0x00,0x05,0xef,0xff,0x90,0x00,0x04,0x8f,0xf7,0x7f,0xb0,0x0a,
-0xf9,0x2f,0xfc,0xbf,0xf4,0x03,0xbf,0xfc,0x50,0x0b,0xf9,0xab,0x03,0x62,0xef,0xff,
-0xf0,0xae,0xfe,0xb0,0x0c,0x00,0x02,0x03,0x00,0x9e,0x0a,0xfa,0x00,0x07,0xff,0xf1,
-0x01,0xbf,0xe1,0xfa,0x01,0x14,0x3f,0x18,0x01,0xf0,0x01,0x1f,0xf4,0x06,0xff,0x20,
-0xdf,0xff,0xff,0xf2,0x02,0xcf,0xd6,0xff,0x20,0xbf,0x90,0x1c,0x03,0xf0,0x36,0x0c,
-0xf7,0x1f,0xf1,0x1f,0xf2,0x0c,0xf6,0x5f,0xd0,0x07,0xfa,0x9f,0x80,0x02,0xfe,0xdf,
-0x30,0x00,0xdf,0xfe,0x00,0x00,0x8f,0xf9,0x00,0x00,0x3f,0xf4,0x00,0xaf,0x70,0x1f,
-0xd0,0x0c,0xf6,0x6f,0xb0,0x5f,0xf1,0x0f,0xf2,0x2f,0xe0,0xaf,0xf5,0x2f,0xe0,0x0e,
-0xf1,0xee,0xfa,0x5f,0xa0,0x0b,0xf6,0xf8,0xce,0x8f,0x60,0x07,0xfe,0xf3,0x8f,0xef,
-0x30,0x03,0xff,0xf0,0x60,0x0a,0x40,0xff,0xa0,0x0f,0xfb,0xe2,0x0d,0xf0,0x3e,0x0a,
-0xf7,0x00,0x7f,0xe0,0x0c,0xfa,0x00,0xef,0x74,0xff,0x20,0x05,0xff,0xdf,0x80,0x00,
-0x0d,0xff,0xe1,0x00,0x00,0x7f,0xfa,0x00,0x00,0x0e,0xff,0xf2,0x00,0x07,0xfe,0xbf,
-0xa0,0x01,0xff,0x63,0xff,0x30,0x8f,0xd0,0x0a,0xfc,0x00,0xcf,0x90,0x08,0xfd,0x07,
-0xfe,0x00,0xdf,0x70,0x1f,0xf2,0x1f,0xf2,0x00,0xcf,0x76,0xfc,0x00,0x06,0xfb,0xaf,
-0x70,0x00,0x1f,0xff,0xf2,0x00,0x00,0xbf,0xfc,0x00,0x00,0x06,0xfc,0x04,0xf1,0x00,
-0x1f,0xf1,0x00,0x00,0x08,0xfb,0x00,0x00,0x1f,0xff,0x50,0x00,0x01,0xee,0x70,0x5b,
-0x08,0x30,0xf7,0x4e,0xee,0xce,0x0a,0x60,0xdf,0xb0,0x00,0x08,0xfe,0x10,0xad,0x05,
-0x60,0x01,0xef,0x90,0x00,0x0a,0xfd,0x1c,0x00,0x30,0xee,0xe8,0x6f,0xbe,0x06,0xd0,
-0x05,0x80,0x00,0x7f,0xc0,0x00,0xff,0x10,0x02,0xfd,0x00,0x03,0xfc,0x03,0x00,0x20,
-0x06,0xfa,0xcf,0x05,0x83,0xaf,0xc0,0x00,0x09,0xf8,0x00,0x04,0xfc,0x15,0x00,0xd9,
-0x01,0xff,0x00,0x00,0xaf,0x90,0x00,0x0a,0xc0,0x00,0x00,0x00,0xab,0x01,0x00,0xf0,
-0x03,0x01,0x57,0x00,0x07,0xfb,0x00,0x0c,0xf4,0x00,0x8f,0x70,0x08,0xf8,0x00,0x8f,
-0x80,0x05,0xfb,0x85,0x05,0x50,0x8f,0xe0,0x4f,0xd1,0x07,0x0f,0x00,0x90,0x08,0xf7,
-0x00,0xaf,0x50,0x4f,0xe0,0x08,0xc2,0xf3,0x07,0xf0,0x05,0x01,0xae,0xa0,0x01,0x94,
-0x0a,0xff,0xfc,0x27,0xf6,0x0f,0xd1,0x8f,0xff,0xf1,0x1a,0x50,0x07,0xed,0x40,0x68,
-0x0c,0x02,0x72,0x0c,0x22,0x0e,0xe2,0x07,0x00,0xf1,0x03,0xfe,0x30,0x00,0x16,0x77,
-0x77,0x7f,0x7c,0xe3,0x00,0x6f,0xee,0xee,0xee,0x40,0xbf,0x30,0x7e,0x9f,0x0c,0x21,
-0xf4,0x7e,0x43,0x00,0x11,0xfc,0x07,0x00,0x20,0x1c,0xe2,0x4e,0x04,0x92,0x41,0xce,
-0x20,0x05,0x55,0x55,0x5f,0x8d,0xe2,0x38,0x00,0x11,0x20,0x07,0x00,0x12,0xd1,0xe2,
-0x0c,0x01,0xe5,0x0b,0x21,0x05,0xb0,0x0d,0x00,0x21,0x4f,0xf0,0xcf,0x0c,0x11,0xfc,
-0x07,0x00,0xe1,0x3f,0x95,0xfe,0xee,0xee,0xea,0x02,0xea,0x00,0x67,0x77,0x77,0xae,
-0x1e,0x21,0x00,0x31,0x7e,0x4f,0x60,0x07,0x00,0x21,0x08,0xf4,0x07,0x00,0x40,0x00,
-0x9f,0x33,0xff,0xe9,0x09,0xa2,0x0a,0xe8,0xf5,0x55,0x55,0x52,0x00,0x00,0xaf,0xf0,
-0x21,0x0d,0x12,0xf0,0x17,0x0d,0x21,0x30,0x00,0x89,0x00,0x01,0x6e,0x00,0x20,0x3e,
-0xe3,0x6c,0x00,0x30,0xeb,0xbe,0x30,0xaf,0x0c,0x40,0x0b,0xf3,0x00,0x03,0xdb,0x01,
-0xff,0x0a,0x30,0x3f,0xb0,0x00,0x00,0x0b,0xf3,0xef,0xff,0x30,0x03,0xff,0xfe,0x35,
-0x5f,0x50,0x05,0xf5,0x53,0x00,0x0f,0x50,0x05,0xf0,0x00,0x06,0x00,0x01,0x70,0x85,
-0x58,0xf0,0x00,0x00,0x0d,0xff,0x27,0x07,0x30,0x03,0x55,0x55,0x3c,0x10,0x2e,0xff,
-0xff,0x2a,0x00,0x0a,0x06,0x00,0xc0,0xce,0xef,0x50,0x05,0xfe,0xec,0xaf,0xb6,0x00,
-0x00,0x6b,0xfa,0x11,0x10,0x70,0x4f,0xb0,0x00,0xbf,0x40,0x04,0xfb,0x75,0x00,0x00,
-0x7b,0x00,0x00,0xa0,0x07,0x00,0xb0,0x00,0x17,0xb0,0x58,0x30,0x12,0x11,0x07,0x00,
-0x12,0x88,0xbc,0x00,0x00,0x15,0x05,0x00,0xe9,0x0c,0x20,0x90,0x00,0x69,0x03,0x20,
-0xcc,0xf2,0x07,0x00,0x30,0xaf,0x44,0xfa,0x0f,0x0d,0x40,0xfb,0x00,0xbf,0x20,0x49,
-0x00,0x10,0x00,0x4a,0x00,0x20,0x3f,0xa0,0x0b,0x11,0x30,0x00,0xbf,0x20,0x18,0x00,
-0x11,0x04,0x46,0x0f,0xb0,0x40,0x0c,0xfe,0xdd,0xdd,0xdd,0xef,0xc0,0x5f,0xff,0xff,
-0xc3,0x0a,0x01,0x4f,0x00,0x02,0x51,0x0d,0x10,0x9f,0x59,0x0d,0xf0,0x3c,0x02,0x26,
+0x01,0x14,0x14,0x0c,0x00,0x00,0x24,0x58,0x60,0x00,0xf8,0xff,0xff,0xff,0xff,0xff,
+0x51,0x84,0x58,0x21,0x10,0x11,0x0b,0x00,0x01,0x00,0x00,0x72,0x1f,0xb5,0x21,0x51,
+0x2f,0x50,0x4d,0x5a,0x4d,0x5b,0x4d,0x5d,0x4d,0x5e,0x4d,0x7a,0x4d,0x7d,0x4d,0x82,
+0x4d,0x89,0x4d,0x8a,0x4d,0x8b,0x4d,0x99,0x4d,0x9b,0x4d,0x9c,0x4d,0xa0,0x4d,0xa8,
+0x4d,0xdc,0x4d,0xde,0x4d,0xf4,0x4d,0xfb,0x4d,0xfe,0x4d,0x15,0x4e,0x1b,0x4e,0x1e,
+0x4e,0x26,0x4e,0x35,0x4e,0x3a,0x4e,0x40,0x4e,0x46,0x4e,0x4b,0x4e,0x4d,0x4e,0x60,
+0x4e,0x70,0x4e,0x7f,0x4e,0x9d,0x4e,0x9e,0x4e,0x9f,0x4e,0xa3,0x4e,0xa5,0x4e,0xac,
+0x4e,0xcf,0x4e,0xdb,0x4e,0xeb,0x4e,0xf7,0x4e,0x14,0x4f,0x2d,0x4f,0x31,0x4f,0x3e,
+0x4f,0x3f,0x4f,0x5d,0x4f,0x62,0x4f,0x8c,0x4f,0x9f,0x4f,0xac,0x4f,0xcf,0x4f,0xf8,
+0x4f,0x1f,0x50,0x95,0x50,0x99,0x50,0x9b,0x50,0xb5,0x50,0xb8,0x50,0xbc,0x50,0xc0,
+0x50,0xc3,0x50,0xc6,0x50,0xc7,0x50,0xc8,0x50,0xcc,0x50,0xd5,0x50,0xdc,0x50,0xe9,
+0x50,0x02,0x51,0x16,0x51,0x1f,0x51,0x30,0x51,0x4a,0x51,0x4b,0x51,0x4d,0x51,0x56,
+0x51,0x57,0x51,0x67,0x51,0x6b,0x51,0x6d,0x51,0x70,0x51,0x79,0x51,0x7b,0x51,0x80,
+0x51,0x86,0x51,0x87,0x51,0x89,0x51,0x9d,0x51,0xbf,0x51,0xef,0x51,0xf0,0x51,0xf8,
+0x51,0x55,0x52,0x58,0x52,0x66,0x52,0x89,0x52,0x8a,0x52,0x97,0x52,0x9a,0x52,0x9f,
+0x52,0xa5,0x52,0xb1,0x52,0xbb,0x52,0xd2,0x52,0xdb,0x52,0xef,0x52,0x12,0x53,0x19,
+0x53,0x1a,0x53,0x1c,0x53,0x1d,0x53,0x21,0x53,0x26,0x53,0x28,0x53,0x30,0x53,0x33,
+0x53,0x3a,0x53,0x3f,0x53,0x40,0x53,0x43,0x53,0x47,0x53,0x58,0x53,0x5c,0x53,0x5d,
+0x53,0x5e,0x53,0x61,0x53,0x67,0x53,0x76,0x53,0x7b,0x53,0x7f,0x53,0x9a,0x53,0xb8,
+0x53,0xcd,0x53,0xdc,0x53,0x1d,0x54,0xb8,0x55,0x2e,0x56,0x30,0x56,0x44,0x56,0x4a,
+0x56,0x4d,0x56,0x4e,0x56,0x56,0x56,0x78,0x56,0x80,0x56,0x90,0x56,0x97,0x56,0xa7,
+0x56,0xdb,0x56,0x4a,0x57,0xbb,0x57,0xee,0x57,0x40,0x58,0x57,0x58,0x5d,0x58,0x66,
+0x58,0x6a,0x58,0x77,0x58,0x79,0x58,0x7a,0x58,0x81,0x58,0x89,0x58,0xcd,0x58,0x1b,
+0x59,0xa0,0x5a,0xa7,0x5a,0xa8,0x5a,0xb6,0x5a,0xd3,0x5a,0xd9,0x5a,0xdc,0x5a,0xea,
+0x5a,0xee,0x5a,0x09,0x5b,0x0d,0x5b,0x48,0x5b,0x49,0x5b,0x4c,0x5b,0x54,0x5b,0x56,
+0x5b,0x5f,0x5b,0x8a,0x5b,0x8e,0x5b,0x90,0x5b,0x9f,0x5b,0xa5,0x5b,0x35,0x5d,0x36,
+0x5d,0x3e,0x5d,0x42,0x5d,0x53,0x5d,0x5c,0x5d,0x76,0x5d,0x77,0x5d,0x88,0x5d,0x8d,
+0x5d,0x95,0x5d,0xa5,0x5d,0xc3,0x5d,0xc6,0x5d,0xdf,0x5d,0xe4,0x5d,0xf6,0x5d,0x46,
+0x5e,0x4a,0x5e,0x50,0x5e,0x52,0x5e,0x5f,0x5e,0x65,0x5e,0x81,0x5e,0x89,0x5e,0x8a,
+0x5e,0xa3,0x5e,0xa5,0x5e,0xb2,0x5e,0xc1,0x5e,0xd4,0x5e,0xd5,0x5e,0xd8,0x5e,0xfa,
+0x5e,0xfe,0x5e,0x07,0x5f,0x13,0x5f,0x15,0x5f,0x27,0x5f,0x3b,0x5f,0x4d,0x5f,0x51,
+0x5f,0x70,0x5f,0x75,0x5f,0x8b,0x5f,0xb2,0x5f,0xbf,0x5f,0xfc,0x5f,0x15,0x60,0x5f,
+0x60,0x6f,0x60,0xb2,0x60,0x5f,0x61,0x60,0x61,0x66,0x61,0x7a,0x61,0x90,0x61,0x97,
+0x61,0x9b,0x61,0xa3,0x61,0xb7,0x61,0xb9,0x61,0xbb,0x61,0xbc,0x61,0xce,0x61,0xf4,
+0x61,0xf5,0x61,0x19,0x62,0x22,0x62,0x2f,0x62,0x38,0x62,0x39,0x62,0x4e,0x62,0x51,
+0x62,0x57,0x62,0x59,0x62,0x7f,0x62,0xb2,0x62,0xbe,0x62,0xc7,0x62,0xe2,0x62,0xf5,
+0x62,0xf7,0x62,0xf8,0x62,0x1f,0x63,0x20,0x63,0x22,0x63,0x44,0x63,0x97,0x63,0xc8,
+0x63,0xfd,0x63,0x1d,0x64,0x36,0x64,0x7f,0x64,0x86,0x64,0x89,0x64,0x8e,0x64,0x95,
+0x64,0x98,0x64,0x9f,0x64,0xa1,0x64,0xa9,0x64,0xc0,0x64,0xc4,0x64,0xd7,0x64,0xec,
+0x64,0xfd,0x64,0xff,0x64,0x00,0x65,0x09,0x65,0x1b,0x65,0x30,0x65,0x35,0x65,0x46,
+0x65,0x5e,0x65,0x6f,0x65,0x70,0x65,0x7f,0x65,0x8e,0x65,0xbe,0x65,0xbf,0x65,0xd2,
+0x65,0x42,0x66,0x44,0x66,0x4f,0x66,0x50,0x66,0x59,0x66,0x6f,0x66,0x7a,0x66,0x7c,
+0x66,0x8a,0x66,0x96,0x66,0xb1,0x66,0xb5,0x66,0xcf,0x66,0xd1,0x66,0xec,0x66,0x14,
+0x67,0x35,0x67,0x57,0x67,0x5f,0x67,0x71,0x67,0x87,0x67,0x8c,0x67,0x96,0x67,0x10,
+0x68,0x71,0x69,0x7a,0x69,0x77,0x6a,0xb2,0x6a,0xb3,0x6a,0xb4,0x6a,0xb5,0x6a,0xcb,
+0x6a,0xda,0x6a,0x05,0x6b,0x24,0x6b,0x84,0x6b,0xb0,0x6b,0xf1,0x6b,0x09,0x6c,0x0f,
+0x6c,0x25,0x6c,0x32,0x6c,0x38,0x6c,0x6b,0x6c,0x82,0x6c,0x8b,0x6c,0x91,0x6c,0x9b,
+0x6c,0xd8,0x6c,0x47,0x6d,0x4b,0x6d,0x55,0x6d,0x60,0x6d,0x79,0x6d,0x88,0x6d,0xce,
+0x6d,0xe0,0x6d,0x21,0x6e,0x2a,0x6e,0x2e,0x6e,0x31,0x6e,0x34,0x6e,0x10,0x6f,0xbb,
+0x6f,0xbf,0x6f,0xc5,0x6f,0x09,0x70,0x76,0x70,0x86,0x70,0xd4,0x70,0x7c,0x71,0x97,
+0x71,0x98,0x71,0xa9,0x71,0xc9,0x71,0x06,0x72,0xd7,0x72,0xff,0x72,0x00,0x73,0x3d,
+0x73,0x56,0x73,0xae,0x73,0x6f,0x74,0x78,0x74,0x85,0x74,0x9c,0x74,0xb5,0x74,0xcd,
+0x75,0xd4,0x75,0x1a,0x76,0x21,0x76,0x26,0x76,0x28,0x76,0x3e,0x76,0x44,0x76,0x48,
+0x76,0x5b,0x76,0x6f,0x76,0xfc,0x76,0x35,0x77,0x51,0x77,0xbc,0x77,0xbe,0x77,0x8a,
+0x78,0xd1,0x78,0x0b,0x79,0x22,0x79,0x3f,0x79,0x40,0x79,0x4b,0x79,0x5b,0x79,0x83,
+0x79,0xca,0x79,0xd1,0x79,0xe7,0x79,0x2e,0x7a,0x3f,0x7a,0x7c,0x7a,0x99,0x7a,0xce,
+0x7a,0xe7,0x7a,0xf1,0x7a,0xcb,0x7b,0xe8,0x7b,0x0e,0x7c,0x4b,0x7c,0x77,0x7c,0x7f,
+0x7c,0xf2,0x7d,0xf7,0x7d,0x05,0x7e,0x0f,0x7e,0x13,0x7e,0x14,0x7e,0x16,0x7e,0x18,
+0x7e,0x1f,0x7e,0x21,0x7e,0x23,0x7e,0x2d,0x7e,0x2f,0x7e,0x3d,0x7e,0x4f,0x7e,0x63,
+0x7e,0x66,0x7e,0x79,0x7e,0xbe,0x7e,0xde,0x7e,0x4b,0x7f,0x4c,0x7f,0x55,0x7f,0x67,
+0x7f,0x76,0x7f,0xa4,0x7f,0x1c,0x80,0x4d,0x80,0x59,0x80,0x6a,0x80,0x3a,0x81,0x43,
+0x81,0x7a,0x81,0x85,0x81,0xc2,0x81,0xd2,0x81,0x41,0x82,0x53,0x82,0xc7,0x82,0x2c,
+0x83,0x54,0x83,0x8d,0x83,0xb1,0x83,0x2d,0x84,0x1f,0x85,0x52,0x86,0x0a,0x87,0x9c,
+0x87,0xb5,0x87,0xb8,0x87,0xc0,0x87,0xfb,0x87,0x15,0x88,0xcf,0x88,0xd1,0x88,0xd6,
+0x88,0x14,0x89,0x16,0x89,0x18,0x89,0x22,0x89,0x33,0x89,0x36,0x89,0x50,0x89,0xb6,
+0x8a,0xf1,0x8a,0xf4,0x8a,0xfe,0x8a,0x00,0x8b,0x0e,0x8b,0x0f,0x8b,0x11,0x8b,0x25,
+0x8b,0x2d,0x8b,0x32,0x8b,0x36,0x8b,0x3d,0x8b,0x3f,0x8b,0x44,0x8b,0x47,0x8b,0x4b,
+0x8b,0x53,0x8b,0x81,0x8b,0x6f,0x8c,0x75,0x8c,0x84,0x8c,0xc7,0x8c,0xd5,0x8c,0x03,
+0x8d,0x2d,0x8d,0x2f,0x8d,0x3f,0x8d,0x43,0x8d,0x7a,0x8d,0xfb,0x8d,0xb6,0x8e,0xbc,
+0x8e,0xbe,0x8e,0xc4,0x8e,0xcd,0x8e,0xd3,0x8e,0xe1,0x8e,0xe3,0x8e,0x09,0x8f,0x17,
+0x8f,0x20,0x8f,0x2b,0x8f,0x2e,0x8f,0x2f,0x8f,0x40,0x8f,0x50,0x8f,0x56,0x8f,0x59,
+0x8f,0x6a,0x8f,0x6f,0x8f,0x8b,0x8f,0xa3,0x8f,0xb5,0x8f,0x38,0x90,0x9d,0x90,0x17,
+0x91,0x1a,0x91,0x1d,0x91,0x1f,0x91,0xc4,0x91,0xd8,0x93,0xef,0x93,0xfe,0x93,0x51,
+0x94,0x69,0x94,0x7e,0x94,0xac,0x94,0xcf,0x94,0x38,0x95,0x3d,0x95,0x3e,0x95,0x42,
+0x95,0x44,0x95,0x84,0x95,0x86,0x95,0x90,0x95,0x94,0x95,0x9d,0x95,0xa0,0x95,0xb4,
+0x95,0xc7,0x95,0xdf,0x95,0xe4,0x95,0xec,0x95,0x16,0x96,0x46,0x96,0x50,0x96,0x57,
+0x96,0xa9,0x96,0xae,0x96,0xb2,0x96,0x39,0x97,0x43,0x97,0xc5,0x97,0xc6,0x97,0xc9,
+0x97,0xca,0x97,0xcb,0x97,0xd4,0x97,0xe1,0x97,0xe8,0x97,0xec,0x97,0x2e,0x98,0xd8,
+0x98,0xc1,0x99,0xc6,0x99,0xce,0x99,0xdc,0x99,0x28,0x9a,0x73,0x9d,0xf6,0x9d,0x28,
+0x9e,0xa0,0x9e,0x51,0xef,0x58,0xef,0x5b,0xef,0x5c,0xef,0x5d,0xef,0x61,0xef,0x63,
+0xef,0x65,0xef,0x69,0xef,0x6c,0xef,0x71,0xef,0x76,0xef,0x77,0xef,0x78,0xef,0x8e,
+0xef,0x93,0xef,0x98,0xef,0x9b,0xef,0x9c,0xef,0x9d,0xef,0xa1,0xef,0xa2,0xef,0xa3,
+0xef,0xa4,0xef,0xb7,0xef,0xb8,0xef,0xbe,0xef,0xc0,0xef,0xc1,0xef,0xc4,0xef,0xc7,
+0xef,0xc8,0xef,0xc9,0xef,0xcb,0xef,0xe3,0xef,0xe5,0xef,0x14,0xf0,0x15,0xf0,0x17,
+0xf0,0x19,0xf0,0x30,0xf0,0x37,0xf0,0x3a,0xf0,0x43,0xf0,0x6c,0xf0,0x74,0xf0,0xab,
+0xf0,0x3b,0xf1,0x90,0xf1,0x91,0xf1,0x92,0xf1,0x93,0xf1,0x94,0xf1,0xd7,0xf1,0xe3,
+0xf1,0x3d,0xf2,0x54,0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0x00,0x01,0x00,0x2f,0xf9,
+0x00,0x01,0x00,0x03,0x13,0xfb,0x08,0x00,0x17,0xf1,0x14,0x00,0x90,0xfa,0xf9,0x00,
+0xfe,0xf5,0x00,0xf5,0x00,0x00,0x96,0x05,0x0d,0x01,0x00,0x4e,0x03,0x05,0x00,0x03,
+0x16,0x00,0x2f,0xdc,0x00,0x01,0x00,0x15,0x1f,0xe1,0x1e,0x00,0x0a,0x03,0x88,0x00,
+0xb2,0xf6,0x00,0xfd,0x00,0x00,0xf1,0xfe,0xf6,0xfb,0x00,0xed,0x93,0x00,0x9b,0xff,
+0x00,0x00,0xfe,0xff,0xfa,0xfc,0x00,0x02,0x30,0x00,0x3f,0xfd,0x00,0xfd,0xdd,0x00,
+0x04,0x15,0xfd,0x0a,0x00,0x12,0xfc,0x07,0x00,0x19,0xff,0x1f,0x00,0x16,0xfe,0x70,
+0x00,0x00,0x2a,0x00,0x10,0xf5,0x4a,0x00,0x2f,0xfb,0xfd,0x9c,0x00,0x0a,0x15,0x03,
+0x3c,0x00,0x11,0xfe,0x3f,0x00,0x26,0xfe,0xfd,0x30,0x00,0x75,0xde,0x00,0x00,0x00,
+0xe8,0x00,0xe6,0x24,0x00,0x53,0xfc,0xfd,0x00,0x00,0xfd,0x04,0x00,0x08,0x01,0x00,
+0x13,0x02,0x90,0x00,0x1f,0x02,0x6b,0x00,0x08,0x1f,0xfd,0x43,0x01,0x0d,0x16,0xec,
+0xd5,0x00,0x04,0x31,0x00,0x10,0xfd,0x07,0x00,0x29,0xfb,0xf8,0x8c,0x01,0xa7,0x02,
+0xf8,0x00,0x00,0xe6,0xfd,0xe6,0xf4,0x00,0xdd,0xf7,0x00,0x25,0xf1,0xfa,0x0c,0x00,
+0x72,0xce,0x00,0x00,0x00,0xea,0x00,0xe9,0x61,0x01,0x51,0x00,0xfc,0x00,0xff,0xfe,
+0x17,0x01,0x1d,0x02,0x65,0x01,0x01,0x6f,0x00,0x4f,0xfd,0xfe,0x00,0xfc,0x97,0x00,
+0x0b,0x10,0xfa,0x3e,0x00,0x06,0x5f,0x00,0x09,0x7b,0x02,0xb1,0xe0,0xde,0x00,0x00,
+0xf1,0xfd,0xe5,0xfe,0x02,0x00,0x02,0x60,0x00,0xd3,0xeb,0xf5,0x00,0xf5,0xe6,0xf8,
+0xf7,0x00,0xf8,0xf6,0xfa,0xf6,0xf9,0x5e,0x01,0x66,0xe5,0xec,0x00,0x00,0xf7,0xfe,
+0x2b,0x01,0xa2,0xfa,0xfb,0x00,0x00,0xfa,0xfc,0x00,0x00,0xfd,0xff,0x39,0x01,0x00,
+0x05,0x00,0x22,0xee,0xf9,0xb4,0x02,0x13,0x02,0x24,0x00,0x22,0xfc,0xfc,0x6c,0x01,
+0x01,0x37,0x00,0x04,0xb8,0x00,0x14,0xed,0x45,0x01,0x1a,0x02,0x20,0x01,0x14,0xfc,
+0xcd,0x00,0xe0,0x03,0xfa,0xe3,0xed,0x00,0x00,0xed,0xfc,0xf4,0xfe,0x02,0xf4,0x02,
+0x02,0x92,0x00,0xe6,0xf8,0xf8,0xfd,0xfb,0xf8,0xfb,0xf9,0xfd,0xfb,0xfe,0x00,0xfd,
+0xfc,0x02,0xc5,0x00,0x2e,0x02,0xfd,0x68,0x01,0x08,0xf8,0x01,0x05,0x4d,0x02,0x1f,
+0xfe,0x14,0x01,0x03,0x0e,0x17,0x00,0x0e,0x1d,0x00,0x0f,0x57,0x01,0x0a,0x10,0xff,
+0x6e,0x02,0x0c,0xbd,0x02,0x0f,0x6c,0x00,0x27,0x1e,0x02,0xbd,0x03,0x19,0x02,0x71,
+0x02,0x10,0x02,0x7d,0x03,0x0f,0x01,0x00,0x24,0x0b,0x81,0x00,0x1f,0xf5,0x2c,0x00,
+0x0b,0x23,0xfd,0xfe,0xa2,0x01,0x1c,0xea,0x6c,0x02,0x20,0xfe,0x03,0x14,0x01,0x3e,
+0x06,0x00,0x02,0x89,0x02,0x0a,0x94,0x02,0x0a,0x58,0x03,0x1c,0xeb,0x63,0x00,0x2d,
+0xfe,0x02,0x14,0x01,0x1f,0xf1,0xd8,0x00,0x24,0x1f,0xfb,0x24,0x00,0x10,0x1f,0xfe,
+0x19,0x00,0x1b,0x23,0x00,0x01,0xd5,0x02,0x11,0x03,0xd4,0x23,0x2d,0x04,0x05,0x21,
+0x00,0xf1,0x0c,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,
+0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,
+0xff,0x0d,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,
+0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x00,0x01,0x00,
+0xff,0xff,0xae,0x02,0x1c,0x03,0x20,0x03,0x02,0x17,0x03,0x4b,0x06,0x07,0x06,0x08,
+0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,
+0x00,0xf1,0x08,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,
+0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,
+0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x73,
+0x00,0x02,0x1f,0x24,0x16,0x03,0xff,0xff,0x91,0x50,0x00,0x00,0x00,0x00,0x00,0xf0,
+0xbd,0x0f,0xf6,0x0e,0xf6,0x0e,0xf5,0x0d,0xf5,0x0d,0xf4,0x0c,0xf4,0x0c,0xf3,0x0b,
+0xf3,0x02,0x30,0x03,0x60,0x0f,0xf6,0x0b,0xe3,0x8f,0x1f,0xa8,0xf0,0xf9,0x8f,0x0f,
+0x78,0xd0,0xf6,0x36,0x07,0x20,0x00,0x06,0xf0,0x7f,0x00,0x00,0x09,0xd0,0xac,0x00,
+0x00,0x0c,0xa0,0xd9,0x00,0x0e,0xff,0xff,0xff,0xf3,0x06,0x8f,0x98,0xf8,0x61,0x00,
+0x4f,0x25,0xf1,0x00,0x01,0x7f,0x28,0xf1,0x10,0x8f,0xff,0xff,0xff,0xa0,0x24,0xdc,
+0x4e,0xb4,0x20,0x00,0xe8,0x0f,0x70,0x00,0x00,0xf5,0x1f,0x40,0x00,0x03,0xf3,0x4f,
+0x20,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x0c,0x70,0x00,0x00,0x3a,0xfe,0x70,0x00,
+0x3f,0xff,0xff,0xa0,0x0a,0xfb,0x05,0xff,0x20,0xcf,0x70,0x0d,0xf5,0x0a,0xfc,0x10,
+0x00,0x00,0x3f,0xff,0x91,0x00,0x00,0x3c,0xff,0xf4,0x00,0x00,0x03,0xcf,0xf1,0x18,
+0x70,0x00,0xef,0x52,0xff,0x30,0x0e,0xf5,0x0c,0xfe,0x8b,0xff,0x20,0x2d,0xff,0xff,
+0x60,0x00,0x03,0xf8,0x10,0x00,0x00,0x0e,0x50,0x00,0x05,0xdf,0xa0,0x00,0x00,0x00,
+0x1f,0xb7,0xf7,0x01,0x80,0x00,0x3f,0x40,0xda,0x0a,0xc0,0x00,0x2f,0x82,0xf9,0x3f,
+0x30,0x00,0x09,0xff,0xe2,0xd9,0x00,0x00,0x00,0x23,0x07,0xe1,0x00,0x20,0x00,0x10,
+0x60,0x06,0x00,0xf0,0x57,0xac,0x2c,0xfe,0x50,0x00,0x04,0xf3,0xae,0x5b,0xf0,0x00,
+0x0d,0x90,0xcb,0x06,0xf1,0x00,0x2c,0x10,0xae,0x6c,0xf0,0x00,0x00,0x00,0x1b,0xfd,
+0x40,0x00,0x3c,0xfd,0x50,0x00,0x00,0x1e,0xff,0xff,0x30,0x00,0x05,0xfb,0x08,0xf7,
+0x00,0x00,0x6f,0xa0,0x8f,0x60,0x00,0x02,0xff,0xaf,0xd0,0x00,0x00,0x09,0xff,0xb1,
+0x00,0x00,0x05,0xff,0xfc,0x04,0xd8,0x02,0xff,0x6e,0xf9,0x7f,0x80,0x6f,0xe0,0x3f,
+0xff,0xf4,0x05,0xff,0x10,0x6f,0xfd,0x00,0x0d,0xfe,0xcf,0xff,0xe2,0x00,0x19,0xef,
+0xd8,0xaf,0xd0,0x8f,0x28,0xf2,0x8f,0x18,0xf0,0x47,0x00,0x01,0x00,0xf1,0x07,0x03,
+0xe1,0x00,0x1e,0xd1,0x00,0xaf,0x20,0x02,0xfa,0x00,0x08,0xf5,0x00,0x0b,0xf2,0x00,
+0x0e,0xf0,0x00,0x0f,0xe0,0x03,0x00,0xf0,0x36,0xf0,0x00,0x0d,0xf0,0x00,0x0a,0xf3,
+0x00,0x05,0xf7,0x00,0x00,0xee,0x00,0x00,0x6f,0x70,0x00,0x09,0xf2,0x00,0x00,0x70,
+0x00,0x00,0x07,0xb0,0x00,0x4f,0xa0,0x00,0x8f,0x50,0x01,0xfd,0x00,0x0c,0xf3,0x00,
+0x8f,0x70,0x06,0xfa,0x00,0x5f,0xb0,0x04,0xfc,0x00,0x5f,0xa0,0x06,0xf8,0x00,0x9f,
+0x50,0x0d,0xf0,0x04,0xf9,0x00,0xcf,0x10,0x8f,0x40,0x04,0x30,0x00,0x00,0x4b,0x01,
+0xf1,0x08,0x0f,0x60,0x00,0x8d,0x6e,0x89,0xd0,0x5b,0xff,0xfe,0x90,0x00,0xaf,0xe1,
+0x00,0x07,0xf4,0xeb,0x00,0x09,0x90,0x6d,0x10,0x80,0x00,0xf0,0x02,0x07,0xa4,0x00,
+0x00,0x00,0xbf,0x60,0x00,0x00,0x0b,0xf6,0x00,0x01,0x22,0xcf,0x72,0x20,0x88,0x01,
+0x50,0x48,0xff,0xff,0xff,0xf4,0x12,0x00,0x05,0x1b,0x00,0xf9,0x1a,0x00,0x0e,0xf0,
+0xef,0x0f,0xd4,0xf8,0x5c,0x00,0x2e,0xee,0xe3,0x2f,0xff,0xf4,0x03,0x70,0x0f,0xf7,
+0x0a,0xf4,0x00,0x00,0x1f,0x90,0x00,0x06,0xf4,0x00,0x00,0xbe,0x00,0x00,0x0f,0xa0,
+0x00,0x05,0xf5,0x00,0x00,0xaf,0x0a,0x00,0xff,0x41,0xb0,0x00,0x04,0xf6,0x00,0x00,
+0xaf,0x10,0x00,0x0e,0xb0,0x00,0x00,0x00,0x6d,0xfe,0x80,0x00,0x6f,0xff,0xff,0x90,
+0x0e,0xf8,0x05,0xff,0x12,0xff,0x10,0x0e,0xf4,0x3f,0xf0,0x00,0xdf,0x64,0xff,0x00,
+0x0d,0xf7,0x4f,0xf0,0x00,0xdf,0x73,0xff,0x00,0x0d,0xf6,0x2f,0xf1,0x00,0xef,0x40,
+0xef,0x80,0x5f,0xf1,0x06,0xff,0xff,0xf9,0x00,0x06,0xdf,0xe8,0x00,0x00,0x16,0xc4,
+0x3a,0xff,0xf4,0xbf,0xff,0xf4,0x65,0x0f,0xf4,0x00,0x03,0x00,0x05,0xf1,0x35,0x7d,
+0xfd,0x80,0x00,0xaf,0xff,0xff,0xa0,0x2f,0xf4,0x06,0xff,0x05,0xec,0x00,0x1f,0xf2,
+0x00,0x00,0x04,0xff,0x00,0x00,0x00,0xdf,0x80,0x00,0x00,0xbf,0xd0,0x00,0x00,0xaf,
+0xe2,0x00,0x00,0x8f,0xf3,0x00,0x00,0x6f,0xf4,0x00,0x00,0x2f,0xff,0xee,0xee,0x83,
+0xff,0xff,0xff,0xf9,0x01,0x9e,0xfd,0x70,0x00,0xcf,0xfe,0xff,0xa0,0x3f,0xf3,0x05,
+0xff,0x11,0x33,0x36,0x00,0xf0,0x37,0x08,0xfe,0x00,0x00,0xef,0xfd,0x20,0x00,0x0c,
+0xef,0xf7,0x00,0x00,0x00,0x3f,0xf2,0x25,0x40,0x00,0xef,0x56,0xff,0x20,0x4f,0xf4,
+0x0d,0xff,0xef,0xfc,0x00,0x19,0xdf,0xd8,0x00,0x00,0x00,0x2f,0xf7,0x00,0x00,0x0c,
+0xff,0x70,0x00,0x06,0xff,0xf7,0x00,0x01,0xee,0xdf,0x70,0x00,0xaf,0x5c,0xf7,0x00,
+0x4f,0xb0,0xcf,0x70,0x0d,0xf1,0x0c,0xf7,0x07,0xff,0xee,0xff,0xfa,0x43,0x01,0xa0,
+0xc0,0x00,0x00,0xcf,0x70,0x00,0x00,0x0c,0xf7,0x00,0x09,0x00,0xf0,0x11,0x04,0xff,
+0xff,0xff,0x20,0x6f,0xff,0xff,0xf2,0x08,0xf9,0x00,0x00,0x00,0x9f,0x70,0x00,0x00,
+0x0b,0xfc,0xef,0xb1,0x00,0xdf,0xfd,0xff,0xd0,0x01,0x51,0x03,0xff,0x40,0x29,0x00,
+0xf0,0x31,0x17,0x70,0x00,0xcf,0x70,0xff,0x70,0x3f,0xf4,0x07,0xff,0xff,0xfc,0x00,
+0x06,0xdf,0xe9,0x00,0x00,0x02,0x9d,0xe0,0x00,0x05,0xff,0xfe,0x00,0x02,0xff,0x92,
+0x00,0x00,0xaf,0xa0,0x00,0x00,0x0f,0xf8,0xdf,0xc3,0x02,0xff,0xff,0xff,0xe0,0x3f,
+0xf7,0x02,0xff,0x63,0xff,0x00,0x0b,0xf8,0x1f,0xf2,0x00,0xbf,0x90,0xdf,0x90,0x2f,
+0xf5,0x04,0x36,0x00,0x31,0x04,0xcf,0xe9,0x49,0x03,0xf0,0x07,0x87,0xee,0xee,0xef,
+0xf6,0x00,0x00,0x02,0xff,0x10,0x00,0x00,0x8f,0x90,0x00,0x00,0x0f,0xf3,0x00,0x00,
+0x06,0xfc,0x12,0x01,0x90,0x60,0x00,0x00,0x4f,0xe0,0x00,0x00,0x0b,0xf8,0x1e,0x00,
+0x90,0x20,0x00,0x00,0x9f,0xb0,0x00,0x00,0x1f,0xf5,0x9e,0x01,0xf0,0x13,0xfd,0x80,
+0x00,0x7f,0xff,0xff,0xa0,0x0d,0xf8,0x05,0xff,0x00,0xff,0x40,0x1f,0xf2,0x0c,0xf9,
+0x07,0xfe,0x00,0x2d,0xff,0xfe,0x30,0x04,0xff,0xff,0xf6,0x00,0xef,0x60,0x3f,0xf2,
+0xb0,0x01,0xf0,0x03,0x62,0xff,0x50,0x3f,0xf5,0x0b,0xff,0xef,0xfd,0x00,0x08,0xdf,
+0xe9,0x10,0x00,0x6d,0xfd,0x50,0x36,0x00,0xf0,0x00,0x50,0x0f,0xf7,0x07,0xfe,0x04,
+0xff,0x00,0x0f,0xf3,0x4f,0xf0,0x00,0xef,0x51,0x24,0x00,0xf2,0x13,0x0a,0xff,0xdf,
+0xff,0x40,0x0a,0xfe,0x8f,0xf2,0x00,0x00,0x05,0xfe,0x00,0x00,0x15,0xef,0x70,0x00,
+0x9f,0xff,0xb0,0x00,0x09,0xfc,0x60,0x00,0x0a,0xe3,0x0f,0xf7,0x03,0x70,0x00,0x00,
+0x03,0x00,0x4a,0x02,0x83,0xe3,0x0c,0xe2,0x1f,0xf5,0x04,0x60,0x00,0x01,0x00,0xa4,
+0x0b,0xf2,0x0b,0xf2,0x0d,0xf0,0x2f,0xa0,0x3d,0x20,0x12,0x00,0xf0,0x17,0x04,0xb2,
+0x00,0x06,0xdf,0xf2,0x18,0xef,0xfe,0x80,0x9f,0xfa,0x40,0x00,0x9f,0xfc,0x60,0x00,
+0x06,0xdf,0xff,0xa1,0x00,0x04,0xbf,0xf2,0x00,0x00,0x02,0x92,0xff,0xff,0xff,0xf0,
+0xde,0xee,0xee,0xe0,0x2a,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0xf0,0x3f,0x0c,0x50,
+0x00,0x00,0x1f,0xfd,0x70,0x00,0x07,0xdf,0xff,0x92,0x00,0x03,0x9e,0xfc,0x00,0x05,
+0xbf,0xfb,0x09,0xef,0xfe,0x71,0x1f,0xfc,0x50,0x00,0x0a,0x30,0x00,0x00,0x03,0xbf,
+0xeb,0x20,0x2f,0xff,0xff,0xe0,0x8f,0xd0,0x2f,0xf4,0x24,0x20,0x0f,0xf5,0x00,0x00,
+0x6f,0xf1,0x00,0x05,0xff,0x50,0x00,0x0f,0xf6,0x00,0x00,0x3f,0xd0,0x00,0x00,0x14,
+0x30,0x00,0x00,0x06,0x30,0x00,0x00,0x7f,0xf0,0x00,0x00,0x3e,0xbf,0x02,0xf2,0x45,
+0x3a,0xdf,0xeb,0x40,0x00,0x00,0x08,0xfc,0x75,0x6b,0xf9,0x00,0x00,0x8f,0x60,0x01,
+0x00,0x4f,0x70,0x03,0xf8,0x01,0xcf,0xfa,0x07,0xf1,0x0a,0xe0,0x0c,0xf6,0xbf,0x01,
+0xf5,0x0f,0x90,0x5f,0x60,0x9f,0x00,0xd8,0x2f,0x50,0xaf,0x10,0xae,0x00,0xb9,0x4f,
+0x30,0xde,0x00,0xbd,0x00,0xca,0x4f,0x30,0xed,0x00,0xcc,0x00,0xd7,0x3f,0x50,0xde,
+0x00,0xfb,0x02,0xf4,0x0f,0x80,0x9f,0x8b,0xfe,0x6d,0xc0,0x0b,0xe1,0x1c,0xfa,0x2d,
+0xfb,0x10,0x02,0xfc,0x84,0x03,0xb0,0x5f,0xfa,0x77,0x99,0x00,0x00,0x00,0x02,0x8d,
+0xff,0xc6,0x0f,0x00,0x30,0xef,0xa0,0x00,0xd6,0x04,0x10,0x00,0x4f,0x04,0x10,0xf5,
+0x10,0x00,0xf0,0x71,0xdf,0xb0,0x00,0x00,0x4f,0xf4,0xff,0x10,0x00,0x0a,0xfb,0x0e,
+0xf6,0x00,0x00,0xff,0x60,0xaf,0xc0,0x00,0x5f,0xf1,0x05,0xff,0x20,0x0b,0xff,0xff,
+0xff,0xf7,0x01,0xff,0xff,0xff,0xff,0xd0,0x6f,0xf2,0x00,0x05,0xff,0x2c,0xfb,0x00,
+0x00,0x0e,0xf8,0xff,0xff,0xfd,0x80,0x0f,0xff,0xff,0xff,0xb0,0xff,0x50,0x08,0xff,
+0x1f,0xf5,0x00,0x2f,0xf2,0xff,0x50,0x08,0xfe,0x0f,0xff,0xff,0xfe,0x30,0xff,0xdc,
+0xcf,0xfa,0x0f,0xf5,0x00,0x2f,0xf4,0xff,0x50,0x00,0xef,0x7f,0xf5,0x00,0x5f,0xf5,
+0xff,0xff,0xff,0xfd,0x0f,0xff,0xff,0xd9,0x10,0x00,0x19,0xef,0xe9,0x10,0x01,0xdf,
+0xff,0xff,0xd1,0x0a,0xfe,0x30,0x3e,0xf8,0x0f,0xf6,0x00,0x08,0xfd,0x3f,0xf2,0x00,
+0x00,0x21,0x4f,0xf0,0xa3,0x00,0x00,0x05,0x00,0x00,0x0f,0x00,0xf1,0x01,0x11,0x0f,
+0xf5,0x00,0x08,0xfd,0x0a,0xfd,0x30,0x3e,0xf9,0x01,0xef,0xff,0xff,0xd1,0x37,0x00,
+0x00,0x40,0x00,0x02,0x60,0x00,0x30,0x50,0x3c,0xfd,0x60,0x00,0xf0,0x1a,0xf5,0xff,
+0x50,0x00,0xcf,0x9f,0xf5,0x00,0x0a,0xfb,0xff,0x50,0x00,0xaf,0xbf,0xf5,0x00,0x0c,
+0xf9,0xff,0x50,0x02,0xff,0x5f,0xf5,0x03,0xcf,0xd0,0xff,0xff,0xff,0xe3,0x0f,0xff,
+0xfe,0x92,0x00,0xff,0xff,0xff,0xfa,0x89,0x03,0x44,0xff,0x50,0x00,0x00,0x04,0x00,
+0x00,0xcb,0x00,0x4b,0xff,0xfe,0xee,0xc0,0x14,0x00,0x13,0xf9,0x2c,0x00,0x11,0xf6,
+0x04,0x00,0x0c,0x30,0x00,0x00,0x04,0x00,0x08,0x14,0x00,0x03,0x04,0x00,0xf0,0x09,
+0x00,0x18,0xdf,0xea,0x20,0x00,0x1d,0xff,0xff,0xfe,0x10,0x09,0xff,0x40,0x2e,0xf9,
+0x00,0xef,0x70,0x00,0x6f,0xe0,0x2f,0xf3,0x76,0x02,0x10,0xff,0x5b,0x02,0xf0,0x09,
+0x4f,0xf2,0x07,0xff,0xff,0x02,0xff,0x30,0x5d,0xdf,0xf0,0x0e,0xf8,0x00,0x05,0xff,
+0x00,0x8f,0xf5,0x00,0x8f,0xf0,0x00,0xdf,0x4a,0x03,0x40,0x00,0x8d,0xfe,0xc6,0x46,
+0x00,0x2f,0x1f,0xf4,0x05,0x00,0x02,0x00,0x21,0x05,0x02,0x05,0x00,0x0f,0x23,0x00,
+0x05,0x3b,0xdf,0x8d,0xf8,0x03,0x00,0x4f,0x00,0x00,0x06,0xff,0x04,0x00,0x09,0xf0,
+0x01,0x6a,0x70,0x06,0xfe,0x8f,0xe1,0x1c,0xfb,0x1f,0xff,0xff,0xf3,0x02,0xbe,0xfc,
+0x40,0x32,0x01,0xf0,0x09,0xc0,0xff,0x50,0x0c,0xfe,0x10,0xff,0x50,0x8f,0xf4,0x00,
+0xff,0x54,0xff,0x80,0x00,0xff,0x7e,0xfc,0x00,0x00,0xff,0xef,0xf5,0xfa,0x00,0xf0,
+0x08,0xfd,0x00,0x00,0xff,0xf8,0xff,0x70,0x00,0xff,0x80,0xaf,0xf2,0x00,0xff,0x50,
+0x1e,0xfb,0x00,0xff,0x50,0x06,0xff,0x50,0x7b,0x01,0x1e,0xe1,0x10,0x01,0x0e,0x04,
+0x00,0x03,0x40,0x01,0x11,0xf5,0x04,0x00,0x40,0xf3,0x00,0x00,0x4f,0x74,0x05,0x40,
+0x00,0x9f,0xff,0xff,0x05,0x05,0xf0,0x1a,0xff,0xff,0xdf,0x40,0x04,0xfd,0xff,0xff,
+0x9f,0x90,0x09,0xf9,0xff,0xff,0x4f,0xe0,0x0e,0xf4,0xff,0xff,0x4b,0xf4,0x4f,0xb4,
+0xff,0xff,0x45,0xf9,0x9f,0x54,0xff,0xff,0x50,0xfe,0xef,0x05,0xff,0xff,0x50,0xaf,
+0xfa,0x06,0x00,0x30,0x5f,0xf5,0x05,0x04,0x04,0x50,0xf0,0x05,0xff,0xff,0xa0,0x00,
+0x01,0x10,0xf3,0x05,0x00,0x11,0xfc,0x28,0x01,0xf0,0x0d,0x60,0x1f,0xf4,0xff,0xcf,
+0xe0,0x1f,0xf4,0xff,0x5d,0xf8,0x1f,0xf4,0xff,0x54,0xff,0x3f,0xf4,0xff,0x50,0xaf,
+0xcf,0xf4,0xff,0x50,0x2f,0xff,0xf4,0xa0,0x02,0x01,0x8a,0x02,0x00,0x05,0x00,0xf0,
+0x21,0x5f,0xf4,0x00,0x08,0xdf,0xd8,0x10,0x00,0x0d,0xff,0xff,0xfd,0x10,0x09,0xff,
+0x51,0x4e,0xf9,0x00,0xff,0x70,0x00,0x7f,0xf0,0x3f,0xf2,0x00,0x02,0xff,0x34,0xff,
+0x10,0x00,0x0f,0xf5,0x4f,0xf1,0x00,0x00,0xff,0x53,0xff,0x20,0x00,0x2f,0xf3,0x0f,
+0xf7,0x35,0x01,0x70,0x9f,0xf5,0x04,0xef,0x90,0x00,0xdf,0x87,0x02,0x53,0x00,0x8d,
+0xfd,0x81,0x00,0xfa,0x02,0x00,0x0f,0x02,0xf0,0x01,0x05,0xff,0x6f,0xf5,0x00,0x0b,
+0xfa,0xff,0x50,0x00,0xbf,0xbf,0xf5,0x00,0x4f,0xf7,0xe8,0x02,0x50,0x1f,0xff,0xff,
+0xe9,0x10,0xf6,0x00,0x10,0x0f,0x57,0x03,0x05,0x09,0x00,0x20,0x00,0x08,0xd8,0x05,
+0x13,0x1d,0x78,0x00,0x18,0x5f,0x78,0x00,0x20,0x35,0xff,0x24,0x00,0x28,0x5f,0xf0,
+0x78,0x00,0x57,0x07,0xff,0x00,0x9f,0xf4,0x78,0x00,0x20,0xff,0xfd,0x4c,0x02,0x20,
+0x2d,0xfe,0xcc,0x03,0x90,0x0a,0x50,0xff,0xff,0xfd,0x70,0x0f,0xff,0xff,0xb9,0x01,
+0x60,0x07,0xff,0x4f,0xf5,0x00,0x0f,0xaf,0x02,0x00,0x8c,0x00,0x20,0x8f,0xf2,0xad,
+0x03,0x10,0x0f,0x64,0x01,0xc0,0xff,0x50,0x7f,0xf1,0x0f,0xf5,0x00,0xef,0x80,0xff,
+0x50,0x06,0xa1,0x03,0xf0,0x11,0x0e,0xf9,0x00,0x5c,0xff,0xc6,0x00,0x07,0xff,0xff,
+0xff,0x80,0x0f,0xf9,0x00,0x8f,0xf1,0x1f,0xf5,0x00,0x1a,0xa2,0x0c,0xfe,0x60,0x00,
+0x00,0x02,0xdf,0xff,0xa2,0x00,0xc5,0x04,0x10,0x40,0xdf,0x08,0xc0,0xe0,0x5d,0xc0,
+0x00,0x2f,0xf3,0x2f,0xf7,0x00,0x6f,0xf2,0x09,0xe1,0x03,0x60,0x00,0x5c,0xff,0xd7,
+0x00,0xbf,0x20,0x03,0x20,0xaf,0xff,0x59,0x00,0x10,0x04,0xf0,0x05,0x0f,0x05,0x00,
+0x19,0x5f,0x1f,0xf4,0x00,0x0b,0xfa,0x05,0x00,0x0f,0xc1,0xf9,0x0f,0xf5,0x00,0x0d,
+0xf8,0x0c,0xfc,0x20,0x5f,0xf5,0x03,0x78,0x00,0xf2,0x00,0x3b,0xff,0xd8,0x00,0xcf,
+0xc0,0x00,0x05,0xff,0x37,0xff,0x10,0x00,0xaf,0xe0,0xc4,0x00,0xf0,0x0f,0xcf,0xa0,
+0x03,0xff,0x40,0x07,0xfe,0x00,0x8f,0xe0,0x00,0x2f,0xf3,0x0c,0xf9,0x00,0x00,0xcf,
+0x81,0xff,0x40,0x00,0x07,0xfc,0x5f,0xe0,0x00,0x00,0x2f,0xfc,0xf9,0x06,0x01,0xc7,
+0x00,0x30,0x07,0xff,0xe0,0x46,0x07,0x10,0xf9,0x7c,0x06,0xf0,0x31,0x01,0xff,0x10,
+0x0b,0xfa,0x6f,0xe0,0x04,0xff,0x50,0x0d,0xf6,0x3f,0xf1,0x08,0xff,0x90,0x0f,0xf3,
+0x0f,0xf3,0x0b,0xff,0xc0,0x3f,0xf0,0x0c,0xf6,0x0f,0xed,0xf0,0x6f,0xc0,0x09,0xf9,
+0x2f,0xaa,0xf3,0x9f,0x90,0x05,0xfc,0x6f,0x66,0xf7,0xcf,0x60,0x02,0xff,0xaf,0x32,
+0xfa,0xff,0x20,0x00,0xef,0xff,0x00,0xff,0xff,0x00,0x00,0xbf,0xfb,0x03,0x00,0x60,
+0x00,0x8f,0xf8,0x00,0x7f,0xf8,0x22,0x05,0xf0,0x08,0x00,0x4f,0xf5,0x00,0x7f,0xf3,
+0x00,0x1f,0xfa,0x0d,0xfb,0x00,0x8f,0xf1,0x05,0xff,0x41,0xff,0x80,0x00,0xcf,0xc9,
+0xfe,0x4d,0x05,0xb0,0xf6,0x00,0x00,0x0a,0xff,0xd0,0x00,0x00,0x0b,0xff,0xe0,0xe9,
+0x02,0xf0,0x1f,0xf7,0x00,0x00,0xdf,0xb8,0xff,0x10,0x06,0xff,0x31,0xff,0x90,0x0e,
+0xfa,0x00,0x8f,0xf2,0x8f,0xf2,0x00,0x0e,0xfb,0xbf,0xc0,0x00,0x0e,0xfa,0x4f,0xf3,
+0x00,0x5f,0xf2,0x0c,0xfa,0x00,0xcf,0xa0,0x04,0xff,0x23,0xff,0x20,0x00,0xcf,0x8a,
+0xfa,0x32,0x00,0x10,0xf3,0xf5,0x07,0x10,0xb0,0xdd,0x09,0x10,0x30,0x3b,0x01,0x1b,
+0x20,0x05,0x00,0x00,0xd9,0x08,0x30,0xff,0xf1,0x6f,0x7a,0x06,0x00,0x59,0x07,0xa0,
+0x60,0x00,0x00,0x0c,0xfb,0x00,0x00,0x00,0x7f,0xf2,0x0e,0x00,0x00,0x08,0x08,0x00,
+0x7d,0x07,0x60,0x6f,0xf2,0x00,0x00,0x01,0xff,0xfd,0x07,0x10,0xfd,0x53,0x05,0x00,
+0x05,0x0b,0x10,0x6f,0x05,0x00,0xaf,0x0d,0xdd,0x41,0xff,0xf5,0x1f,0xf3,0x01,0xff,
+0x30,0x05,0x00,0x0a,0xf2,0x03,0xd4,0x1f,0xff,0x50,0xdf,0x70,0x00,0x00,0x7f,0xd0,
+0x00,0x00,0x1f,0xf3,0x00,0x00,0x0b,0xf9,0x5b,0x07,0x01,0xca,0x02,0x00,0x1e,0x08,
+0x00,0x20,0x03,0x20,0x0e,0xf6,0xa4,0x06,0x03,0xdd,0x07,0xbf,0xcf,0x80,0x00,0x00,
+0x6f,0xd0,0xbd,0xd6,0xef,0xf7,0x0c,0x02,0x00,0x06,0xf0,0x25,0xbf,0xf7,0xef,0xf7,
+0x00,0x8f,0x80,0x00,0x0e,0xfe,0x00,0x04,0xfc,0xf4,0x00,0xaf,0x2f,0xa0,0x1f,0xa0,
+0xaf,0x17,0xf5,0x04,0xf7,0xdd,0xdd,0xdd,0xd1,0xff,0xff,0xff,0xf2,0x38,0x80,0x00,
+0xbf,0x80,0x00,0xdf,0x20,0x01,0x9e,0xfc,0x50,0x00,0xcf,0xed,0xff,0x40,0x3f,0xf1,
+0x7a,0x00,0xf3,0x0d,0x01,0x9f,0xb0,0x04,0xcf,0xff,0xfb,0x02,0xff,0x74,0xaf,0xb0,
+0x6f,0xd0,0x0a,0xfb,0x03,0xff,0xee,0xff,0xb0,0x05,0xdf,0xb7,0xfe,0x00,0x2f,0xf2,
+0x7f,0x00,0x02,0x09,0x00,0xf0,0x08,0x7d,0xfb,0x10,0x2f,0xff,0xff,0xfc,0x02,0xff,
+0x60,0x4f,0xf3,0x2f,0xf2,0x00,0xdf,0x52,0xff,0x20,0x0c,0xf7,0x2f,0xf2,0x4b,0x08,
+0x32,0x60,0x3f,0xf3,0x1b,0x00,0xf0,0x06,0x6e,0xfb,0x10,0x00,0x8e,0xfd,0x50,0x0a,
+0xff,0xff,0xf5,0x2f,0xf4,0x08,0xfc,0x6f,0xd0,0x01,0x65,0x7f,0xc0,0xbc,0x00,0xe9,
+0x00,0x22,0x2f,0xf4,0x07,0xfc,0x0a,0xff,0xef,0xf6,0x00,0x8e,0xfd,0x60,0x58,0x00,
+0x50,0x20,0x1a,0xfd,0x7f,0xf2,0x02,0x07,0xf0,0x0b,0x22,0xff,0x50,0x7f,0xf2,0x5f,
+0xe0,0x02,0xff,0x27,0xfc,0x00,0x2f,0xf2,0x5f,0xd0,0x02,0xff,0x22,0xff,0x30,0x5f,
+0xf2,0x0b,0xff,0xdf,0x24,0x00,0xf0,0x05,0x6f,0xf2,0x00,0x6d,0xfd,0x70,0x00,0x8f,
+0xff,0xff,0x70,0x1f,0xf5,0x04,0xff,0x05,0xff,0x99,0x9f,0xf2,0x76,0x01,0x20,0x35,
+0xff,0xee,0x0b,0x30,0xf9,0x00,0x85,0x1b,0x00,0xfe,0x09,0xd0,0x00,0x6d,0xfe,0xa1,
+0x00,0x00,0x6d,0xfa,0x04,0xff,0xfa,0x07,0xfd,0x00,0xcf,0xff,0xf7,0x8d,0xfe,0xb5,
+0x08,0xfc,0x00,0x03,0x00,0xf2,0x06,0x00,0xaf,0xe7,0xdf,0x40,0xaf,0xff,0xff,0xf4,
+0x2f,0xf6,0x04,0xff,0x45,0xfe,0x00,0x0f,0xf4,0x6f,0xd0,0x00,0x09,0x00,0x00,0x12,
+0x00,0x01,0x1b,0x00,0xf0,0x05,0x00,0x9f,0xe7,0xff,0x30,0x15,0x00,0x6f,0xf1,0x0b,
+0xff,0xef,0xf9,0x00,0x1a,0xef,0xd7,0x00,0x3f,0xf1,0x74,0x06,0x23,0x10,0x00,0x09,
+0x00,0xf0,0x06,0x5d,0xfb,0x20,0x3f,0xff,0xff,0xfb,0x03,0xff,0x50,0x6f,0xf0,0x3f,
+0xf1,0x02,0xff,0x13,0xff,0x10,0x2f,0xf2,0x09,0x00,0x19,0x23,0x09,0x00,0x8c,0x0c,
+0xe2,0x1f,0xf4,0x04,0x50,0x0f,0xf4,0x02,0x00,0x70,0x00,0xde,0x20,0x1f,0xf4,0x00,
+0x45,0xfa,0x0a,0x2d,0xff,0x40,0x05,0x00,0x7c,0x02,0xff,0x3b,0xff,0xe0,0xaf,0xc3,
+0x87,0x01,0xf0,0x02,0x20,0xaf,0xe1,0x2f,0xf2,0x7f,0xf3,0x02,0xff,0x6f,0xf6,0x00,
+0x2f,0xff,0xfa,0x00,0x02,0xf6,0x00,0xfe,0x03,0x2f,0xfc,0xef,0x70,0x02,0xff,0x26,
+0xff,0x20,0x2f,0xf2,0x0c,0xfc,0x02,0xff,0x20,0x3f,0xf6,0x6e,0x00,0x02,0x02,0x00,
+0xff,0x12,0x2f,0xf4,0xdf,0xc2,0x6e,0xfb,0x12,0xff,0xff,0xff,0xef,0xff,0xfa,0x2f,
+0xf6,0x06,0xff,0x50,0x8f,0xe2,0xff,0x20,0x3f,0xf0,0x04,0xff,0x2f,0xf2,0x03,0xff,
+0x00,0x4f,0xf2,0x0d,0x00,0x06,0x10,0xf0,0x3b,0x00,0x10,0x02,0x13,0x05,0x00,0x37,
+0x00,0xa0,0x02,0xff,0x10,0x2f,0xf1,0x2f,0xf1,0x02,0xff,0x22,0xe2,0x00,0x09,0x09,
+0x00,0x50,0x20,0x00,0x7d,0xfd,0x70,0x80,0x06,0xf0,0x0a,0x90,0x2f,0xf6,0x05,0xff,
+0x26,0xfe,0x00,0x0d,0xf6,0x7f,0xc0,0x00,0xcf,0x86,0xfe,0x00,0x0d,0xf7,0x2f,0xf5,
+0x05,0xff,0x30,0x9f,0x5f,0x06,0xf0,0x10,0x7d,0xfe,0x80,0x00,0x2f,0xf7,0xdf,0xb1,
+0x02,0xff,0xfd,0xff,0xb0,0x2f,0xf4,0x03,0xff,0x32,0xff,0x20,0x0d,0xf5,0x2f,0xf2,
+0x00,0xcf,0x72,0xff,0x20,0x0e,0xf5,0x3b,0x00,0x10,0x22,0xa4,0x04,0x48,0x2f,0xf7,
+0xdf,0xa1,0xff,0x00,0xf0,0x01,0x00,0x00,0x01,0xaf,0xe6,0xef,0x20,0xbf,0xff,0xff,
+0xf2,0x3f,0xf5,0x06,0xff,0x25,0xa8,0x02,0x32,0x7f,0xc0,0x02,0x09,0x00,0x41,0x2f,
+0xf5,0x06,0xff,0x1b,0x00,0x39,0x01,0xaf,0xd7,0x34,0x00,0x21,0x2f,0xf2,0xf2,0x0b,
+0xab,0xea,0x2f,0xff,0xfa,0x2f,0xfa,0x31,0x2f,0xf2,0x00,0x03,0x00,0xf0,0x17,0x02,
+0xae,0xfc,0x40,0x0d,0xfd,0xcf,0xf3,0x3f,0xf0,0x0a,0xd7,0x1f,0xfa,0x51,0x00,0x05,
+0xef,0xff,0x90,0x00,0x04,0x8f,0xf7,0x7f,0xb0,0x0a,0xf9,0x2f,0xfc,0xbf,0xf4,0x03,
+0xbf,0xfc,0x50,0x0b,0xf9,0xab,0x03,0x62,0xef,0xff,0xf0,0xae,0xfe,0xb0,0x0c,0x00,
+0x02,0x03,0x00,0x9e,0x0a,0xfa,0x00,0x07,0xff,0xf1,0x01,0xbf,0xe1,0xfa,0x01,0x14,
+0x3f,0x18,0x01,0xf0,0x01,0x1f,0xf4,0x06,0xff,0x20,0xdf,0xff,0xff,0xf2,0x02,0xcf,
+0xd6,0xff,0x20,0xbf,0x90,0x1c,0x03,0xf0,0x36,0x0c,0xf7,0x1f,0xf1,0x1f,0xf2,0x0c,
+0xf6,0x5f,0xd0,0x07,0xfa,0x9f,0x80,0x02,0xfe,0xdf,0x30,0x00,0xdf,0xfe,0x00,0x00,
+0x8f,0xf9,0x00,0x00,0x3f,0xf4,0x00,0xaf,0x70,0x1f,0xd0,0x0c,0xf6,0x6f,0xb0,0x5f,
+0xf1,0x0f,0xf2,0x2f,0xe0,0xaf,0xf5,0x2f,0xe0,0x0e,0xf1,0xee,0xfa,0x5f,0xa0,0x0b,
+0xf6,0xf8,0xce,0x8f,0x60,0x07,0xfe,0xf3,0x8f,0xef,0x30,0x03,0xff,0xf0,0x60,0x0a,
+0x40,0xff,0xa0,0x0f,0xfb,0xe2,0x0d,0xf0,0x1d,0x0a,0xf7,0x00,0x7f,0xe0,0x0c,0xfa,
+0x00,0xef,0x74,0xff,0x20,0x05,0xff,0xdf,0x80,0x00,0x0d,0xff,0xe1,0x00,0x00,0x7f,
+0xfa,0x00,0x00,0x0e,0xff,0xf2,0x00,0x07,0xfe,0xbf,0xa0,0x01,0xff,0x63,0xff,0x30,
+0x8f,0xd0,0x0a,0xfc,0x00,0xf0,0x41,0xcf,0x90,0x08,0xfd,0x07,0xfe,0x00,0xdf,0x70,
+0x1f,0xf2,0x1f,0xf2,0x00,0xcf,0x76,0xfc,0x00,0x06,0xfb,0xaf,0x70,0x00,0x1f,0xff,
+0xf2,0x00,0x00,0xbf,0xfc,0x00,0x00,0x06,0xff,0x60,0x00,0x00,0x1f,0xf1,0x00,0x00,
+0x08,0xfb,0x00,0x00,0x1f,0xff,0x50,0x00,0x01,0xee,0x70,0x00,0x00,0x4f,0xff,0xff,
+0xf7,0x4e,0xee,0xff,0xf5,0x00,0x00,0xdf,0xb0,0x00,0x08,0xfe,0x10,0x00,0x4f,0xf4,
+0x00,0x01,0xef,0x90,0x00,0x0a,0xfd,0x1c,0x00,0xf0,0x05,0xee,0xe8,0x6f,0xff,0xff,
+0xf9,0x00,0x05,0x80,0x00,0x7f,0xc0,0x00,0xff,0x10,0x02,0xfd,0x00,0x03,0xfc,0x03,
+0x00,0xe3,0x06,0xfa,0x00,0x7f,0xf3,0x00,0xaf,0xc0,0x00,0x09,0xf8,0x00,0x04,0xfc,
+0x15,0x00,0xd9,0x01,0xff,0x00,0x00,0xaf,0x90,0x00,0x0a,0xc0,0x00,0x00,0x00,0xab,
+0x01,0x00,0xf0,0x0c,0x01,0x57,0x00,0x07,0xfb,0x00,0x0c,0xf4,0x00,0x8f,0x70,0x08,
+0xf8,0x00,0x8f,0x80,0x05,0xfb,0x00,0x0c,0xfb,0x00,0x8f,0xe0,0x4f,0xd1,0x07,0x0f,
+0x00,0xf0,0x18,0x08,0xf7,0x00,0xaf,0x50,0x4f,0xe0,0x08,0xc2,0x00,0x00,0x00,0x00,
+0x01,0xae,0xa0,0x01,0x94,0x0a,0xff,0xfc,0x27,0xf6,0x0f,0xd1,0x8f,0xff,0xf1,0x1a,
+0x50,0x07,0xed,0x40,0x00,0x00,0x00,0x04,0x20,0x00,0x01,0x00,0x22,0x0e,0xe2,0x07,
+0x00,0xf0,0x03,0xfe,0x30,0x00,0x16,0x77,0x77,0x7f,0x7c,0xe3,0x00,0x6f,0xee,0xee,
+0xee,0x40,0xbf,0x30,0x7e,0x17,0x00,0x31,0x0b,0xf4,0x7e,0x43,0x00,0x11,0xfc,0x07,
+0x00,0xf2,0x00,0x1c,0xe2,0x6f,0xff,0xff,0xff,0x41,0xce,0x20,0x05,0x55,0x55,0x5f,
+0x8d,0xe2,0x38,0x00,0x11,0x20,0x07,0x00,0x11,0xd1,0x46,0x00,0x20,0x03,0x10,0x06,
+0x00,0x21,0x05,0xb0,0x0d,0x00,0x30,0x4f,0xf0,0x00,0x67,0x00,0x11,0xfc,0x07,0x00,
+0xe1,0x3f,0x95,0xfe,0xee,0xee,0xea,0x02,0xea,0x00,0x67,0x77,0x77,0xae,0x1e,0x21,
+0x00,0x31,0x7e,0x4f,0x60,0x07,0x00,0x21,0x08,0xf4,0x07,0x00,0xf1,0x04,0x00,0x9f,
+0x33,0xff,0xff,0xff,0xfd,0x00,0x0a,0xe8,0xf5,0x55,0x55,0x52,0x00,0x00,0xaf,0xf0,
+0x00,0x82,0x00,0x02,0x07,0x00,0x31,0x00,0x30,0x00,0x89,0x00,0x01,0x6e,0x00,0x20,
+0x3e,0xe3,0x6c,0x00,0xff,0x19,0xeb,0xbe,0x30,0x00,0x00,0x3e,0xb0,0x0b,0xf3,0x00,
+0x03,0xfb,0x00,0x00,0xbf,0x30,0x3f,0xb0,0x00,0x00,0x0b,0xf3,0xef,0xff,0x30,0x03,
+0xff,0xfe,0x35,0x5f,0x50,0x05,0xf5,0x53,0x00,0x0f,0x50,0x05,0xf0,0x00,0x06,0x00,
+0x01,0xfe,0x05,0x85,0x58,0xf0,0x00,0x00,0x0d,0xff,0xff,0xd0,0x00,0x00,0x03,0x55,
+0x55,0x30,0x00,0x00,0x0f,0xff,0xff,0x2a,0x00,0x0a,0x06,0x00,0xf0,0x08,0xce,0xef,
+0x50,0x05,0xfe,0xec,0xaf,0xb6,0x00,0x00,0x6b,0xfa,0x0a,0xf4,0x00,0x00,0x4f,0xb0,
+0x00,0xbf,0x40,0x04,0xfb,0x75,0x00,0x10,0x3f,0xd1,0x00,0x21,0xbf,0xfb,0xb0,0x00,
+0x26,0xb0,0x00,0x01,0x00,0x12,0x11,0x07,0x00,0x12,0x88,0xbc,0x00,0x11,0xff,0x1e,
+0x01,0x30,0x09,0xff,0x90,0x07,0x00,0x30,0x2f,0xcc,0xf2,0x07,0x00,0xb0,0xaf,0x44,
+0xfa,0x00,0x00,0x00,0x02,0xfb,0x00,0xbf,0x20,0x49,0x00,0x10,0x00,0x4a,0x00,0x90,
+0x3f,0xa0,0x00,0x0a,0xf3,0x00,0x00,0xbf,0x20,0x18,0x00,0xf0,0x01,0x04,0xf9,0x00,
+0x00,0x00,0x9f,0x40,0x0c,0xfe,0xdd,0xdd,0xdd,0xef,0xc0,0x5f,0xff,0x01,0x00,0x11,
+0xf5,0x4f,0x00,0x11,0x10,0x56,0x00,0xf0,0x47,0x9f,0xfc,0x10,0x00,0x00,0x02,0x26,
 0xf7,0x4d,0xb0,0x00,0x04,0xdf,0xbb,0xd0,0x07,0xf0,0x00,0x6f,0xc4,0x0d,0xf5,0x2c,
 0xd0,0x02,0xfa,0x00,0x0f,0xff,0xfe,0x30,0x0a,0xe0,0x00,0x3f,0xff,0xc6,0x60,0x0e,
 0x80,0x00,0x6f,0xf8,0x08,0xe0,0x0f,0x60,0x00,0x9e,0x40,0x06,0xf0,0x0e,0x80,0x00,
 0x71,0x00,0x08,0xe0,0x0a,0xd0,0x00,0x00,0x00,0x0d,0xa0,0x03,0xf8,0x00,0x00,0x00,
-0x8f,0x30,0x00,0x7f,0xa3,0x00,0x3a,0xf7,0x00,0xd7,0x03,0x20,0xfe,0x50,0xb9,0x01,
-0x20,0x66,0x40,0x66,0x00,0xf0,0x14,0x66,0x66,0x63,0x00,0x00,0x00,0x20,0xcf,0xff,
-0xf2,0x50,0x00,0x03,0xf8,0x1e,0xff,0x65,0xf9,0x00,0x16,0xb8,0x03,0xfb,0x02,0xa7,
-0x70,0x6f,0xa0,0x00,0x51,0x00,0x3f,0xb0,0x49,0x30,0x5b,0x11,0x30,0x93,0xef,0x20,
-0x5e,0x0a,0x30,0xf6,0x49,0x10,0x0e,0x00,0x31,0x71,0xaf,0x60,0x3d,0x02,0xf0,0x0b,
-0x36,0xa1,0x00,0x00,0x00,0x6b,0x30,0x0a,0xf8,0x20,0x00,0x06,0x8f,0x50,0x01,0x4c,
-0xe7,0x68,0x8f,0xb1,0x00,0x00,0x0a,0x6e,0xac,0xc6,0x62,0x00,0x36,0x06,0x44,0x40,
-0x2b,0x01,0xf0,0x1c,0x8e,0x34,0x78,0x61,0x00,0x00,0x07,0xfd,0xff,0xfe,0xff,0x91,
-0x00,0x6f,0x70,0xbf,0x40,0x06,0xed,0x10,0x8f,0x50,0x0a,0xf5,0x00,0x2e,0xb0,0x0d,
-0xf6,0x00,0xed,0x00,0x03,0xf4,0x1f,0xcf,0x7a,0xf4,0x00,0x00,0xd9,0x3f,0x37,0x5a,
-0x09,0x40,0xab,0x3f,0x20,0x53,0x16,0x03,0x20,0x1f,0x50,0x3d,0x00,0x30,0xd8,0x0b,
-0xc0,0xb2,0x00,0x20,0xf3,0x02,0xcb,0x00,0xf0,0x00,0x2e,0xa0,0x00,0x6f,0xb4,0x00,
-0x17,0xfc,0x10,0x00,0x03,0xcf,0xff,0xff,0x80,0x5f,0x01,0x21,0x56,0x40,0x8e,0x01,
-0x20,0x10,0x00,0xf5,0x01,0x00,0x69,0x1f,0xe0,0x2f,0xe9,0x99,0x9b,0xf4,0x00,0x7f,
-0x70,0x00,0x09,0xd0,0x00,0xcf,0x10,0x3a,0x12,0xf0,0x1f,0xfc,0x00,0x00,0x9f,0x10,
-0x00,0x9f,0x10,0x1c,0xd3,0x00,0x06,0xff,0x70,0xe9,0x00,0x00,0x3f,0x8c,0x75,0xf9,
-0x00,0x00,0xbc,0x0e,0x2c,0xaf,0x00,0x00,0xd9,0x2d,0x1a,0x3f,0x20,0x00,0xbc,0x01,
-0x00,0x6f,0x00,0x00,0x4f,0x80,0x04,0xe9,0x00,0xc1,0x0a,0x00,0xe9,0x01,0x31,0x27,
-0x74,0x00,0xc6,0x01,0x21,0xff,0xa0,0x06,0x00,0x90,0xb1,0x10,0x1f,0xee,0xed,0xdd,
-0xdd,0xf2,0x1d,0x15,0x00,0xd1,0xb2,0x1d,0x01,0x77,0x77,0x60,0xb2,0x1d,0x03,0xff,
-0xff,0xe0,0xb3,0x12,0x00,0x11,0xb3,0x12,0x00,0x12,0xb3,0x12,0x00,0x11,0x1e,0x12,
-0x00,0xc4,0x0e,0x11,0x11,0x11,0x11,0xb3,0x0d,0xdd,0xff,0xff,0xec,0xc2,0x48,0x00,
-0x31,0x7b,0xbb,0x70,0x47,0x03,0x40,0xbd,0xdb,0x50,0x07,0x16,0x0b,0xd0,0xff,0xf0,
-0x0f,0xd3,0x2f,0xfa,0x30,0x03,0x20,0x0e,0x4d,0xef,0x80,0x6d,0x03,0x31,0x00,0x8f,
-0x40,0x07,0x00,0x21,0x03,0xd9,0x07,0x00,0x30,0x00,0x1e,0x90,0x07,0x00,0x21,0x02,
-0xd7,0x0e,0x00,0x11,0x5d,0x1c,0x00,0x20,0x08,0xfd,0x43,0x00,0x50,0x0f,0xca,0xaf,
-0xa0,0x00,0x15,0x13,0x60,0x0d,0xfd,0x63,0x37,0x60,0x03,0x61,0x00,0x01,0x92,0x0a,
-0xf1,0x1a,0x02,0x7a,0xa7,0x10,0xbd,0xef,0xfd,0xdd,0xdd,0xf1,0xc2,0x6f,0xe0,0x00,
-0x11,0xc2,0xc2,0x39,0x80,0x1a,0xff,0xf2,0xc2,0x16,0x52,0xef,0xff,0xf2,0xc2,0x6f,
-0xf0,0x19,0xff,0xf2,0xc2,0x5f,0xe0,0x00,0x11,0xb2,0xc2,0xc8,0x00,0x30,0xc2,0x5f,
-0xe0,0x06,0x00,0x20,0x6f,0xf0,0x06,0x00,0x20,0x15,0x40,0x06,0x00,0x21,0x4f,0xe0,
-0x18,0x00,0x00,0x12,0x00,0x70,0xcc,0xdf,0xfc,0xcc,0xcc,0xf1,0x01,0xc8,0x00,0x00,
-0x60,0x01,0x11,0x22,0x08,0x04,0xf0,0x36,0xbf,0xff,0xfa,0x20,0x00,0x00,0x7f,0xea,
-0xce,0x8d,0xf5,0x00,0x06,0xf9,0x03,0xbd,0x10,0xaf,0x30,0x1f,0xa0,0x04,0xbd,0x10,
-0x0c,0xd0,0x7f,0x10,0x04,0xce,0x10,0x03,0xf3,0xab,0x00,0x02,0xcc,0x00,0x00,0xe7,
-0xba,0x00,0x36,0x00,0xb9,0x00,0xc8,0xab,0x05,0xeb,0x76,0xc8,0xd3,0xe7,0x7f,0x8e,
-0x5c,0x61,0xbb,0x5d,0xf4,0x1f,0xd4,0xd5,0x00,0x05,0xdc,0xd0,0x06,0x7f,0x0a,0x81,
-0x9f,0x30,0x00,0x7f,0xc6,0x33,0x6d,0xf4,0x54,0x00,0x11,0xf9,0xfe,0x03,0x16,0x22,
-0x09,0x04,0x40,0x01,0xaf,0xfe,0x60,0x31,0x15,0x30,0xd4,0x28,0xf5,0x64,0x04,0xf0,
-0x16,0x20,0x00,0x9c,0x00,0x32,0x00,0x5f,0x00,0x00,0x6e,0x3e,0xff,0x90,0x3f,0x30,
-0x00,0xac,0xdf,0xff,0xf4,0x0c,0xe5,0x28,0xf5,0xff,0xff,0xf8,0x00,0xaf,0xff,0xd3,
-0xdf,0xff,0xf5,0x00,0xce,0xa9,0x31,0x07,0x40,0x0a,0xd1,0x1d,0xff,0x25,0x09,0x20,
-0x40,0xbf,0xcb,0x0a,0x21,0x5e,0x05,0x55,0x03,0x30,0x7c,0x1b,0xff,0xb7,0x0c,0xa9,
-0x6f,0xff,0xdd,0xdd,0xdd,0xdd,0xd6,0x02,0x22,0x00,0x01,0x00,0x22,0x06,0x90,0xc5,
-0x03,0x12,0xda,0x0f,0x00,0x22,0x1c,0xb0,0x0f,0x00,0x90,0xcc,0x00,0x00,0x3c,0xbb,
-0xbb,0xba,0xbf,0xc1,0xe4,0x0a,0x00,0x57,0x0d,0x20,0x14,0x44,0x01,0x00,0x10,0x30,
-0x3c,0x0c,0x00,0x1f,0x09,0x92,0x3e,0xfd,0xde,0xee,0xef,0xf4,0x00,0x02,0xea,0x37,
-0x00,0x22,0x1d,0xa0,0x37,0x00,0x13,0xdb,0x46,0x00,0x05,0x08,0x12,0x07,0x69,0x00,
-0x22,0xee,0xb6,0x09,0x00,0x21,0x49,0xe8,0x0e,0x00,0x30,0xa4,0x19,0xd2,0x32,0x00,
-0x30,0x5b,0xd3,0x30,0xd8,0x12,0x21,0x60,0x45,0x55,0x05,0x10,0xbc,0xf3,0x0f,0x30,
-0xa8,0x9c,0x71,0x07,0x05,0xf0,0x10,0x00,0x01,0xcd,0x10,0x00,0x1e,0xf2,0x5f,0xd0,
-0x3f,0xc0,0x00,0x5f,0xf0,0xbf,0xf3,0x1f,0xf1,0x00,0x0d,0xf3,0x4e,0xb0,0x4f,0xa0,
-0x00,0x02,0xdd,0x10,0x02,0xdc,0x90,0x03,0x91,0xcb,0xab,0x60,0x00,0x00,0x01,0x33,
-0x33,0x32,0xe9,0x04,0xf0,0x0d,0xff,0x70,0x00,0x1f,0x63,0x33,0xc8,0xf7,0x00,0x1f,
-0x40,0x00,0xe0,0x6f,0x70,0x1f,0x40,0x00,0xed,0xd7,0xf1,0x1f,0x40,0x00,0x01,0x13,
-0xf1,0x1f,0x7c,0x0d,0x0f,0x06,0x00,0x0d,0x72,0x74,0x44,0x44,0x47,0xf1,0x0e,0xff,
-0x01,0x0c,0x02,0xf8,0x05,0x20,0xbd,0xb4,0x07,0x00,0xf0,0x38,0x4d,0x41,0x3c,0x61,
-0x00,0x00,0x00,0xe2,0x00,0x01,0xed,0xe9,0x00,0x03,0xc0,0x00,0x00,0x10,0x0a,0x70,
-0x05,0xc0,0x00,0x00,0x01,0x01,0xe0,0x1e,0x30,0x02,0x69,0xdf,0x40,0xe0,0x88,0x09,
-0xef,0xfb,0x84,0x02,0xd0,0xc2,0x08,0x73,0x65,0x00,0x02,0xe2,0xc2,0x00,0x01,0xee,
-0x10,0x00,0x5a,0x95,0x00,0x0a,0xff,0x90,0x00,0x2c,0x3d,0x00,0x17,0x88,0x70,0x00,
-0x4a,0x08,0xd3,0xa1,0x02,0x87,0xd3,0x00,0x4c,0xed,0xde,0xee,0xed,0x40,0x19,0x01,
-0x22,0x02,0x10,0x57,0x06,0x13,0x60,0x07,0x00,0x11,0xb4,0x07,0x00,0xf0,0x15,0x64,
-0xf2,0x00,0x02,0x64,0x04,0xff,0xf6,0x80,0x00,0x6f,0xef,0x7e,0xa2,0x9e,0x00,0x01,
-0xf8,0x01,0x3f,0x50,0x4f,0x10,0x06,0xe0,0x00,0x0c,0xd7,0xdd,0x00,0x0b,0x90,0x00,
-0x01,0xcf,0xc2,0x13,0x17,0x00,0x38,0x00,0x21,0x1f,0x20,0x07,0x00,0x12,0x3f,0x46,
-0x00,0x12,0x4f,0x07,0x00,0x16,0x6d,0x54,0x00,0x00,0xca,0x00,0xb1,0xde,0x60,0x0e,
-0x85,0xf1,0x0e,0x52,0xf1,0x06,0xff,0x90,0xbf,0x05,0x80,0x6f,0xe4,0xef,0xfb,0xdf,
-0xfb,0x5e,0xd3,0x1d,0x00,0x50,0x1e,0x82,0x00,0x00,0x0f,0xb9,0x12,0xf1,0x02,0x5a,
-0xef,0xf8,0x00,0x01,0x7e,0xfc,0x07,0xcf,0xfe,0x92,0x1f,0xfb,0x50,0x00,0x08,0x20,
-0x58,0x01,0xf0,0x05,0xfb,0x0c,0xcc,0xcc,0xc8,0x03,0x90,0x00,0x1f,0xfb,0x00,0x06,
-0xff,0xb0,0x00,0x5f,0xf8,0x00,0x07,0xb0,0xbb,0x01,0x12,0x11,0x01,0x00,0x21,0x1f,
-0xff,0x01,0x00,0x14,0xf9,0x08,0x00,0x00,0x5d,0x00,0x02,0x55,0x02,0x0f,0x08,0x00,
-0x0f,0x40,0xfe,0xee,0xee,0x20,0x08,0x00,0x00,0x5c,0x15,0x0f,0x38,0x00,0x14,0x00,
-0x78,0x00,0x53,0x7f,0xa1,0x11,0x11,0x10,0x70,0x00,0x43,0xf7,0x1d,0xdd,0xdd,0xda,
-0x02,0x01,0x01,0x00,0x13,0x20,0x18,0x00,0x90,0xf2,0x1b,0xbb,0xbb,0xdf,0xeb,0xbb,
-0xbb,0xb1,0xa8,0x0d,0x03,0xbd,0x06,0x05,0x08,0x00,0x22,0xfe,0x70,0x08,0x00,0x31,
-0xff,0xfe,0x60,0x08,0x00,0x41,0xb3,0xcf,0xfc,0x20,0x20,0x00,0x32,0x06,0xfd,0x10,
-0x28,0x00,0x2e,0x22,0x00,0x38,0x00,0x0a,0x08,0x00,0x21,0x0a,0xbb,0x01,0x00,0x22,
-0xa0,0x0e,0x70,0x00,0x90,0xe0,0x03,0x33,0x33,0x4d,0xfc,0x33,0x33,0x30,0x34,0x0e,
-0x12,0xf3,0xf3,0x14,0x31,0xff,0xf2,0x60,0xcd,0x01,0x40,0xff,0xfe,0xfa,0x10,0x58,
-0x09,0xb0,0xbf,0xf4,0xef,0xd3,0x00,0x01,0xaf,0xf9,0x0f,0xf0,0x1c,0x3e,0x11,0x80,
-0x70,0x0f,0xf0,0x00,0xaf,0xf4,0x0a,0xc2,0x28,0x18,0x20,0x0a,0x90,0xd1,0x04,0x03,
-0x79,0x02,0x0f,0x08,0x00,0x04,0x12,0x65,0x0e,0x00,0x22,0x1f,0xe0,0xd3,0x01,0x82,
-0xff,0xcc,0xcc,0xcc,0xcc,0x30,0x00,0x6f,0x92,0x03,0x22,0x09,0xf6,0x1e,0x00,0x22,
-0xcf,0x20,0x33,0x00,0x10,0xfb,0x9d,0x00,0x25,0x70,0x03,0x94,0x01,0x00,0x0d,0x07,
-0x02,0xf6,0x00,0x31,0x09,0xf5,0x1f,0x70,0x14,0x20,0xcf,0x30,0x41,0x00,0x13,0xca,
-0x5d,0x00,0x21,0x05,0xfd,0xeb,0x02,0x21,0xdd,0xff,0x25,0x00,0x37,0xff,0xfe,0x80,
-0xa3,0x02,0x22,0x05,0xb3,0x08,0x00,0x22,0x2f,0xf6,0xb2,0x02,0x31,0xef,0xff,0x40,
-0xd8,0x00,0x20,0xf9,0x8f,0x11,0x00,0xf0,0x0a,0x1a,0xff,0x80,0x07,0xff,0xb2,0x00,
-0x29,0xff,0xf7,0x0c,0xc0,0x5f,0xff,0x92,0x2f,0xfb,0x20,0x0f,0xf0,0x02,0xbf,0xf3,
-0x05,0x50,0xb8,0x00,0x2e,0x05,0x50,0xd8,0x00,0x0f,0x08,0x00,0x15,0x2d,0x01,0xfe,
-0x07,0x00,0x82,0xad,0xdd,0xdd,0xff,0xdd,0xdd,0xd2,0xcf,0xe3,0x01,0xa8,0xcf,0x20,
-0x02,0xfe,0x00,0x0d,0xf2,0xcf,0x20,0x01,0x07,0x00,0x64,0xba,0xab,0xff,0xaa,0xaf,
-0xf2,0x23,0x00,0x70,0x42,0x24,0xfe,0x22,0x2d,0xf2,0x23,0x3f,0x00,0x2e,0x02,0x20,
-0x54,0x00,0x02,0xd1,0x00,0x07,0x07,0x00,0x82,0x0b,0xbb,0xbb,0xff,0xbb,0xbb,0xa0,
-0x0f,0xd5,0x01,0xe3,0x0f,0xe0,0x02,0xfe,0x00,0x2f,0xe0,0x0f,0xf9,0x9a,0xff,0x99,
-0xbf,0xe0,0x15,0x00,0x40,0x00,0x00,0x03,0xfe,0x19,0x09,0x02,0x5c,0x01,0xf3,0x06,
-0xbf,0xca,0xab,0xff,0xaa,0xad,0xf9,0xbf,0x40,0x02,0xfe,0x00,0x07,0xf9,0xbf,0xcb,
-0xbc,0xff,0xbb,0xbd,0xf9,0x1c,0x00,0x10,0x68,0xa1,0x00,0x24,0x04,0x85,0x62,0x00,
-0x01,0x40,0x00,0x12,0xf3,0x9d,0x01,0x10,0xbe,0x08,0x00,0x41,0xe0,0x39,0x00,0x0a,
-0x08,0x00,0x22,0xbf,0xc0,0x08,0x00,0x22,0x0b,0xfc,0x08,0x00,0xe2,0x00,0xa3,0x0a,
-0xf3,0x00,0x2c,0xcf,0xfc,0xcc,0xcc,0xce,0xfd,0xc2,0x3f,0x62,0x02,0x11,0xf3,0x78,
-0x02,0x22,0x0b,0xf4,0x7e,0x18,0x00,0x28,0x00,0x21,0xdf,0x30,0x08,0x00,0x31,0x07,
-0xfc,0x00,0x65,0x09,0xf0,0x06,0x4f,0xf3,0x00,0x00,0x9c,0xcf,0xf1,0x00,0x09,0x50,
-0x00,0x00,0x6f,0xfd,0x70,0x00,0x00,0x16,0x00,0xdf,0x10,0x1b,0x00,0x31,0xf7,0x0d,
-0xf1,0xbf,0x01,0x21,0xf1,0xdf,0x6c,0x04,0x30,0x87,0x0e,0xf1,0x4c,0x07,0x83,0xee,
-0xee,0xff,0xee,0xee,0xee,0x50,0xff,0x7c,0x09,0x00,0xa0,0x0b,0xf0,0x09,0x00,0xbf,
-0x40,0x00,0x00,0x8f,0x82,0x30,0x0c,0xf3,0x00,0x00,0x0e,0xf5,0xfe,0x10,0xcf,0x30,
-0x00,0x07,0xfc,0x07,0xfa,0x0d,0x49,0x13,0x60,0x50,0x0d,0xa0,0xff,0x10,0x01,0xda,
-0x16,0x50,0x1f,0xf0,0x04,0xef,0xd0,0xb6,0x05,0xd0,0x01,0xff,0xb1,0x00,0x01,0xff,
-0xff,0x80,0x03,0x80,0x00,0x00,0x0c,0x7e,0x0f,0x05,0x01,0x00,0x23,0x57,0x00,0x2a,
-0x02,0x12,0xc1,0x09,0x00,0x20,0x2d,0xfd,0x47,0x02,0x82,0xbb,0xbb,0xbc,0xfe,0xbb,
-0xbb,0x50,0x07,0x73,0x00,0x8e,0x60,0x00,0x11,0x11,0x2f,0xf2,0x11,0x11,0xfa,0x01,
-0x61,0x8e,0xee,0xef,0xfe,0xee,0xe9,0xc9,0x14,0x00,0xd6,0x08,0x0f,0x22,0x02,0x05,
-0x13,0x1f,0x18,0x01,0x21,0x1e,0xee,0x01,0x00,0x10,0xe2,0xb9,0x08,0x03,0x80,0x00,
-0x40,0x9f,0x50,0x00,0x31,0x00,0x3b,0xb0,0x2f,0xd0,0x00,0xef,0x30,0x00,0xbf,0x50,
-0x0b,0xf4,0x05,0xa8,0x0c,0x80,0xc0,0x05,0xa3,0x0c,0xf6,0x00,0x00,0x0c,0x45,0x1a,
-0x40,0xe0,0x00,0x00,0x05,0xf2,0x00,0x10,0x80,0x35,0x03,0x32,0x90,0x05,0xfe,0xe1,
-0x02,0x21,0x3f,0xf4,0xf1,0x02,0x32,0xff,0xef,0x80,0x02,0x09,0x22,0xfc,0x00,0xdd,
-0x0a,0x20,0xff,0xb2,0xb6,0x06,0xf0,0x01,0xef,0xe6,0x6f,0xff,0x82,0x00,0x2a,0xff,
-0xfa,0x10,0x01,0xbf,0xff,0xc3,0x1f,0xf9,0x86,0x18,0x45,0xaf,0xc0,0x03,0x00,0xb9,
-0x0a,0x23,0x2b,0x50,0x22,0x04,0x13,0xf1,0x08,0x19,0x10,0xf8,0x37,0x00,0x73,0xcc,
-0xcc,0xcd,0xfd,0xcc,0xd8,0x00,0xf8,0x00,0x12,0x20,0x22,0x00,0x13,0xf5,0x22,0x01,
-0x02,0x69,0x00,0x22,0x2e,0xfa,0xd5,0x03,0x22,0xef,0xa0,0x1e,0x00,0x13,0xf9,0x78,
-0x00,0x01,0x1e,0x00,0x31,0x18,0xef,0xe4,0x50,0x04,0x31,0xef,0xff,0x60,0x01,0x04,
-0xb1,0xf6,0x7f,0xfe,0xdc,0xcc,0xdf,0xf4,0x08,0x90,0x02,0x8d,0x90,0x02,0x00,0x01,
-0x00,0x02,0x46,0x06,0x13,0x48,0x5a,0x06,0x21,0xbf,0x30,0x29,0x00,0x03,0x40,0x01,
-0xa0,0x1f,0xeb,0xbb,0xbb,0xbd,0xf9,0x00,0x00,0x1f,0xb0,0xcc,0x0a,0x01,0x08,0x00,
-0x31,0x1b,0xbf,0xf2,0x08,0x00,0x20,0x0b,0xcb,0xed,0x0d,0x63,0xe8,0x88,0x88,0x88,
-0x88,0x80,0x51,0x01,0x12,0xf0,0xdb,0x05,0xa1,0x1e,0xf0,0x19,0x99,0x99,0x99,0x99,
-0x98,0x0e,0xe0,0x17,0x00,0x32,0xfe,0x0f,0xd0,0xf2,0x05,0x21,0x2f,0xc0,0xee,0x00,
-0x32,0xbb,0xdf,0x80,0x70,0x04,0x27,0xfc,0x10,0xf8,0x01,0xf1,0x0a,0x01,0x23,0x57,
-0xa3,0x00,0x00,0x9d,0xef,0xff,0xff,0xff,0xfb,0x00,0x00,0xcf,0xed,0xcb,0xa9,0x75,
-0x30,0x00,0x00,0xef,0x10,0x06,0xb9,0x00,0x41,0xfe,0x00,0x0d,0xf1,0x77,0x0d,0x02,
-0x08,0x00,0x92,0x05,0xfb,0x22,0x2e,0xf3,0x22,0x22,0x10,0x0a,0x18,0x01,0x40,0x90,
-0x05,0xdc,0xcc,0xf2,0x02,0x70,0x70,0x00,0x05,0x10,0x0d,0xf1,0x01,0x69,0x09,0x50,
-0xc0,0x0d,0xf1,0x1f,0xe2,0x9d,0x13,0x40,0x0d,0xf1,0x06,0xfd,0x1c,0x14,0xc0,0x0e,
-0xf1,0x00,0xaf,0xa0,0x2c,0x60,0x3e,0xef,0xf0,0x00,0x1d,0x1e,0x0a,0x1b,0xfd,0x6a,
-0x08,0x90,0x01,0x24,0x57,0x91,0x00,0x00,0xce,0xff,0xff,0x1c,0x09,0xf1,0x00,0x00,
-0x8b,0xba,0xaf,0xf7,0x54,0x10,0x00,0x08,0x99,0x99,0x9f,0xf9,0x99,0x99,0x58,0x16,
-0x00,0xe0,0x00,0xf0,0x1e,0x02,0x22,0x98,0x2f,0xf2,0x99,0x22,0x20,0x04,0x99,0xfd,
-0x0f,0xf0,0xde,0x8d,0x10,0x07,0xee,0xfd,0x0f,0xf0,0xdf,0xfc,0x40,0x00,0x01,0xed,
-0x0f,0xf0,0xde,0x12,0x10,0x0c,0xff,0xfd,0x9f,0xf9,0xdf,0x8c,0xf1,0x08,0x96,0xdf,
-0xff,0xff,0xb1,0x10,0xf0,0x0a,0x02,0xcf,0xbf,0xfb,0xfb,0x20,0x00,0x04,0xaf,0xf8,
-0x0f,0xf0,0x8f,0xf9,0x30,0x3f,0xfb,0x40,0x0f,0xf0,0x04,0xcf,0xf3,0x04,0x30,0x88,
-0x02,0x40,0x03,0x50,0x00,0x12,0x79,0x06,0x31,0x21,0x00,0x00,0x74,0x04,0x13,0xfc,
-0x1a,0x04,0x2f,0xfb,0x00,0x01,0x00,0x1d,0x03,0x52,0x07,0x04,0xda,0x06,0x14,0xf1,
-0x08,0x00,0x05,0x21,0x00,0x02,0x72,0x06,0x22,0x00,0x01,0x18,0x00,0x71,0x10,0x00,
-0x22,0x22,0x2d,0xf4,0x22,0xaa,0x06,0x11,0x0d,0x76,0x0d,0x03,0x08,0x00,0x12,0x02,
-0x18,0x00,0x23,0x20,0x2f,0x0a,0x07,0x8c,0x2b,0xbb,0xbb,0xbf,0xfc,0xbb,0xbb,0xb2,
-0x28,0x00,0x0d,0x08,0x00,0x00,0xe2,0x10,0x03,0x7e,0x0d,0x0b,0x58,0x01,0x23,0x3b,
-0x70,0x02,0x06,0x12,0xf1,0x23,0x05,0x54,0xbf,0xfd,0xbb,0xbb,0xb0,0x50,0x01,0xf0,
-0x19,0x01,0x11,0x88,0x31,0x11,0x89,0x11,0x10,0x00,0x08,0xfe,0x20,0x02,0xef,0xb1,
-0x00,0x02,0xcf,0xe2,0x00,0x00,0x1c,0xfe,0x20,0x0c,0xfc,0x7c,0x30,0x02,0xd9,0xaf,
-0xd0,0x00,0x70,0x4f,0xb0,0x0a,0xf8,0x08,0x10,0x8a,0x04,0x21,0x6f,0xe0,0xea,0x00,
-0x31,0xef,0xff,0x30,0xfe,0x02,0x30,0xcf,0xfd,0x30,0xd9,0x02,0xf8,0x06,0xaf,0xfd,
-0xdf,0xfb,0x41,0x00,0x0b,0xff,0xfe,0x60,0x06,0xef,0xff,0xd1,0x09,0xea,0x40,0x00,
-0x00,0x05,0x9e,0x82,0x06,0x20,0x27,0x60,0x30,0x02,0x74,0x55,0x55,0x7f,0xf6,0x55,
-0x55,0x50,0x78,0x00,0x20,0x03,0x34,0x94,0x0a,0x43,0x43,0x30,0x00,0x1f,0x58,0x05,
-0x60,0x1f,0xd4,0x44,0x44,0x4d,0xf3,0x36,0x1c,0x30,0xdd,0xdd,0xdf,0x30,0x1d,0x53,
-0x66,0x66,0x66,0x66,0x61,0x48,0x04,0x91,0xd2,0x00,0x00,0x58,0x88,0x89,0xdf,0xff,
-0x91,0x1a,0x03,0x44,0xfe,0x82,0x00,0x00,0x58,0x05,0x12,0x19,0x20,0x02,0x52,0x91,
-0x00,0x00,0x68,0x9f,0x00,0x01,0x23,0x7f,0xfe,0xf0,0x00,0x10,0x2a,0x8f,0x03,0x93,
-0x17,0x77,0x77,0x8f,0xf8,0x77,0x77,0x71,0x3f,0x50,0x01,0x50,0x00,0x04,0x44,0x44,
-0x44,0xe5,0x0d,0x04,0x2d,0x0a,0x65,0x0e,0xf1,0x11,0x11,0x1f,0xf0,0x10,0x00,0x00,
-0xa9,0x00,0x44,0x55,0x55,0x51,0x00,0xa8,0x00,0x20,0x0f,0xd5,0x10,0x00,0xf1,0x02,
-0x5e,0xf0,0x0f,0xc0,0x8f,0xff,0xff,0xf7,0x0d,0xf0,0x00,0x00,0xbf,0xb9,0x9d,0xf7,
-0x01,0x35,0x1a,0xf0,0x00,0x08,0xf8,0x07,0xc1,0x08,0xcf,0xf6,0x00,0x07,0xfd,0xae,
-0xf1,0x0b,0xfc,0x40,0x18,0x0d,0x25,0x80,0x01,0x52,0x03,0x13,0x31,0x08,0x00,0x22,
-0xef,0x20,0xea,0x1f,0xa1,0xfc,0xad,0xdd,0xdd,0xdd,0xb0,0x00,0x1f,0xf4,0xcf,0xf8,
-0x03,0xf0,0x0d,0xaf,0xd0,0x5f,0x70,0x00,0x3f,0xb0,0x06,0xff,0xc0,0x1f,0xc0,0x00,
-0x8f,0x70,0x4f,0xff,0xc0,0x0c,0xf1,0x00,0xdf,0x20,0x1e,0xaf,0xc0,0x06,0xf8,0x6e,
-0x11,0xe1,0x1f,0xc0,0x00,0xef,0x2d,0xf5,0x00,0x00,0x1f,0xc0,0x00,0x6f,0xef,0xc0,
-0x08,0x00,0x32,0x0d,0xff,0x20,0x10,0x00,0x20,0xff,0x90,0x08,0x00,0xf7,0x06,0x2a,
-0xff,0x7e,0xfc,0x40,0x00,0x1f,0xc8,0xff,0xd2,0x01,0xcf,0xf9,0x00,0x1f,0xc2,0xc5,
-0x00,0x00,0x04,0xb1,0x78,0x01,0x23,0x0a,0xb1,0x3b,0x08,0x14,0xf6,0x08,0x05,0x20,
-0x50,0x00,0xc7,0x18,0xe0,0xe3,0x4f,0xfa,0x20,0x00,0x03,0x9f,0xfc,0x10,0x02,0xef,
-0xfa,0x40,0x7f,0xa6,0x04,0xb0,0x19,0xff,0xf6,0x1e,0x91,0x55,0x00,0x00,0x55,0x17,
-0x90,0xf1,0x03,0x00,0x03,0x00,0x06,0x08,0x00,0x21,0xff,0x00,0x08,0x00,0x22,0x04,
-0xfe,0x08,0x00,0x22,0x0b,0xf9,0x08,0x00,0x21,0x8f,0xf2,0x08,0x00,0x31,0x0a,0xff,
-0x60,0x08,0x00,0x22,0x01,0xc4,0x33,0x00,0x0d,0x01,0x00,0x21,0x04,0xfd,0x34,0x12,
-0x00,0xa2,0x06,0x21,0x02,0xfe,0x39,0x04,0x30,0x00,0x03,0xfd,0x59,0x05,0x40,0xf9,
-0x00,0x05,0xfb,0xa0,0x0f,0x40,0xf8,0x00,0x06,0xfa,0xae,0x00,0x41,0xfb,0x00,0x09,
-0xfa,0x0d,0x0f,0x31,0x80,0x0c,0xfe,0x70,0x07,0x20,0xf4,0x0f,0x69,0x02,0x40,0x3f,
-0xe5,0xfe,0x5f,0x83,0x0e,0xf1,0x1c,0x8f,0xa0,0xaf,0xdf,0xae,0xf1,0x00,0x00,0xdf,
-0x50,0x24,0xff,0x47,0xfa,0x00,0x06,0xff,0x10,0x0a,0xfd,0x01,0xff,0x60,0x1f,0xf8,
-0x00,0x7f,0xf5,0x00,0x6f,0xf4,0x3e,0xe0,0x00,0x9f,0xa0,0x00,0x09,0xc0,0x01,0x30,
-0x00,0x04,0x52,0x05,0x51,0x06,0xb3,0x00,0x02,0xf9,0x1e,0x03,0x11,0x12,0x08,0x00,
-0xf1,0x30,0x4f,0xb0,0xdf,0x02,0xf9,0x03,0x10,0x00,0xcf,0x40,0xdf,0x02,0xfc,0xbf,
-0xd0,0x06,0xff,0x10,0xdf,0x28,0xff,0xff,0xd0,0x2f,0xff,0x10,0xdf,0xff,0xfd,0x5f,
-0xc0,0xaf,0xff,0x7d,0xff,0xeb,0xf9,0x0f,0xc0,0x3d,0xdf,0x7f,0xff,0x12,0xf9,0x0f,
-0xc0,0x01,0xcf,0x23,0xdf,0x02,0xf9,0x0f,0xb0,0x00,0xcf,0x10,0xdf,0x02,0xfb,0xff,
-0x90,0x08,0x00,0x30,0xf9,0xa9,0x10,0x08,0x00,0xf5,0x0d,0x00,0x10,0x05,0xc3,0x00,
-0xcf,0x10,0xcf,0x20,0x00,0x09,0xf4,0x00,0xcf,0x10,0x9f,0xfe,0xee,0xff,0xe0,0x00,
-0xcf,0x10,0x19,0xbc,0xcc,0xca,0x30,0xf8,0x00,0x30,0x9a,0x10,0x00,0x30,0x13,0x61,
-0x00,0xef,0x21,0xba,0x00,0x04,0x08,0x00,0x40,0xef,0x60,0x05,0xfa,0x0f,0x02,0x40,
-0x4f,0xf1,0x07,0xf8,0x08,0x00,0x40,0x0a,0xf6,0x09,0xf6,0x08,0x00,0x42,0x02,0x30,
-0x0d,0xf4,0x27,0x02,0x20,0x2f,0xf0,0x08,0x00,0x91,0x01,0x00,0x6f,0xc0,0x00,0x00,
-0xef,0x35,0xd8,0x2f,0x20,0xf0,0x0f,0xef,0xef,0xf9,0x06,0xff,0xa0,0x00,0x04,0xff,
-0xfc,0x40,0x4f,0xff,0xf9,0x00,0x0d,0xfd,0x50,0x07,0xff,0x92,0xff,0x80,0x04,0x70,
-0x03,0xdf,0xfa,0x00,0x4f,0xf2,0x06,0x56,0xae,0x50,0x00,0x08,0xb1,0xf0,0x09,0x31,
-0xa3,0x00,0x06,0x55,0x10,0xf0,0x24,0xf6,0x95,0x5f,0xa0,0x3d,0x80,0x00,0x5f,0xc3,
-0xfb,0x0c,0xf2,0x6f,0x80,0x00,0xcf,0x50,0xee,0x05,0xe4,0xaf,0x40,0x07,0xff,0x10,
-0xbf,0x20,0x00,0xdf,0x00,0x4f,0xff,0x10,0x7f,0x60,0x01,0xfc,0x00,0x9f,0xff,0x10,
-0x3f,0xd0,0x08,0xf7,0x00,0x1a,0xbf,0x10,0x0d,0xf5,0x5c,0x08,0x60,0xbf,0x10,0x06,
-0xfc,0x8f,0x90,0x08,0x00,0x41,0x00,0xef,0xff,0x10,0x08,0x00,0x30,0x6f,0xf8,0x00,
-0x08,0x00,0x40,0x03,0xef,0xff,0x50,0x08,0x00,0x80,0x7f,0xf9,0xaf,0xf9,0x20,0x00,
-0xbf,0x6e,0x63,0x1b,0x96,0xf3,0x00,0xbf,0x2d,0x81,0x00,0x00,0x2b,0x90,0x2c,0x0e,
-0x31,0x40,0x00,0x20,0x30,0x06,0x30,0x05,0xbf,0xa0,0xf7,0x0b,0xf1,0x0e,0x9a,0xfe,
-0xa6,0xa9,0x99,0x90,0x0c,0xf2,0xbf,0x00,0x2f,0xff,0xfe,0x05,0xff,0x0b,0xf0,0x02,
-0xfb,0x0e,0xe0,0xef,0xf0,0xbf,0x00,0x2f,0xb0,0xde,0x8f,0x0f,0x00,0x32,0x0d,0xe4,
-0xee,0x0f,0x00,0x21,0x03,0xdf,0x0f,0x00,0x22,0xe0,0x0d,0x0f,0x00,0xf0,0x08,0x00,
-0xdf,0x0c,0xf9,0xe5,0xfb,0x0e,0xe0,0x0d,0xf2,0xff,0xfc,0x5f,0xbd,0xfd,0x00,0xdf,
-0x0d,0x82,0x02,0xfb,0xbd,0x50,0x84,0x03,0x51,0x2f,0xb0,0x00,0x00,0xdf,0xa4,0x12,
-0x0e,0xac,0x0e,0x40,0xd5,0x10,0x0a,0xf3,0x00,0x01,0x40,0xf3,0x8f,0x5a,0xf3,0xf8,
-0x01,0x41,0xd0,0xcf,0x2a,0xf3,0x4a,0x23,0x81,0xff,0xae,0xfc,0xaa,0x60,0x05,0xff,
-0x15,0xb0,0x06,0xb1,0x1e,0xff,0x1c,0xf5,0x2b,0xf6,0x22,0x10,0x8f,0xff,0x2d,0xbf,
-0x09,0x40,0x2e,0xdf,0x10,0x20,0x08,0x00,0xb1,0x02,0xbf,0x1d,0xdd,0xdf,0xfe,0xdd,
-0xd4,0x00,0xbf,0x1f,0x5b,0x09,0x00,0x00,0x01,0x00,0x5a,0x13,0x01,0x08,0x00,0x1f,
-0xf3,0x08,0x00,0x08,0x05,0x01,0x00,0x10,0x42,0x1c,0x05,0x00,0x5b,0x13,0x30,0x30,
-0x02,0x59,0x6f,0x15,0xc0,0xfd,0xbd,0xff,0xff,0xfc,0x81,0x00,0x1f,0xf4,0xce,0xca,
-0xfd,0x96,0x08,0x40,0xd0,0x00,0x01,0xfd,0x3f,0x04,0x11,0xc0,0x08,0x00,0x13,0x4f,
-0x08,0x00,0xb2,0x1e,0xbf,0xc8,0xdd,0xde,0xff,0xdd,0xdb,0x04,0x1f,0xc9,0x89,0x06,
-0x12,0x1f,0x18,0x00,0x0f,0x08,0x00,0x08,0x02,0x21,0x08,0x20,0x1f,0xc0,0x42,0x0d,
-0x80,0xd9,0x00,0x04,0x72,0x02,0x20,0x04,0x20,0x20,0x09,0x40,0x0b,0xf5,0x3f,0x90,
-0x45,0x21,0xf0,0x1c,0x1f,0xf0,0x0e,0xe0,0x00,0x00,0xbf,0x50,0x7f,0x90,0x09,0xf6,
-0x00,0x05,0xff,0x11,0xff,0x20,0x02,0xfe,0x10,0x2e,0xff,0x2c,0xf8,0x00,0x00,0x9f,
-0xc1,0x9f,0xff,0x7f,0xfc,0xbb,0xbb,0xcf,0xf5,0x1d,0xdf,0x1a,0xbf,0xff,0xff,0x8b,
-0x23,0xb2,0x10,0x04,0xfa,0x03,0xfa,0x00,0x00,0xcf,0x10,0x06,0xf7,0x08,0x00,0x40,
-0x0b,0xf3,0x04,0xf9,0x08,0x00,0xfe,0x0e,0x2f,0xd0,0x06,0xf7,0x00,0x00,0xcf,0x11,
-0xdf,0x60,0x09,0xf5,0x00,0x00,0xcf,0x3e,0xfa,0x08,0xdf,0xf2,0x00,0x00,0xcf,0x1a,
-0x90,0x05,0xed,0x70,0x00,0x01,0x00,0x51,0xdd,0x10,0xbf,0x49,0xb1,0xa0,0x09,0xf0,
-0x09,0xbf,0x48,0xfd,0x20,0x00,0x0d,0xf5,0x00,0xaf,0x40,0x7e,0x30,0x00,0x5f,0xe0,
-0x00,0x9f,0x74,0x68,0x90,0x01,0xef,0xd8,0xce,0x88,0x05,0xf0,0x11,0x0c,0xff,0xda,
-0xff,0xef,0xd9,0x76,0x30,0x2f,0xff,0xd1,0x10,0x5f,0xa0,0x5f,0x80,0x08,0x4f,0xd0,
-0x00,0x2f,0xd1,0xef,0x40,0x00,0x1f,0xd0,0x00,0x0f,0xfb,0xfa,0x00,0x08,0x00,0x31,
-0x0c,0xff,0xd0,0x08,0x00,0xf6,0x15,0x1d,0xfe,0x10,0x60,0x00,0x1f,0xd0,0x05,0xef,
-0xfe,0x01,0xf8,0x00,0x1f,0xd5,0xdf,0xf9,0xcf,0x74,0xf6,0x00,0x1f,0xd4,0xfc,0x30,
-0x3f,0xff,0xf2,0x00,0x1f,0xd0,0x30,0x00,0x05,0xef,0x90,0x80,0x00,0x12,0x30,0xf3,
-0x15,0x20,0x07,0xfa,0xb9,0x14,0x00,0x0b,0x0b,0x90,0xcc,0xdf,0xec,0xcc,0x90,0x00,
-0x7f,0xa2,0xff,0x67,0x11,0x10,0x02,0xc0,0x1c,0x10,0x00,0x4e,0x1c,0x91,0x4c,0xcd,
-0xff,0xcc,0xcc,0xc7,0x9f,0xff,0x4f,0x71,0x08,0x32,0x3e,0xef,0x10,0x80,0x07,0xb1,
-0xcf,0x10,0x2f,0xfc,0xcc,0xcc,0x60,0x00,0xcf,0x10,0x7f,0x40,0x08,0x10,0xcf,0xf4,
-0x04,0x01,0x10,0x01,0x40,0x02,0xda,0xbf,0xa0,0x08,0x00,0x50,0x01,0xbf,0xfd,0x00,
-0x00,0x18,0x00,0x41,0x05,0xef,0xb0,0x00,0x20,0x00,0x27,0x1c,0x50,0x00,0x01,0x41,
-0x73,0x00,0x08,0x50,0xf0,0x0e,0x21,0x02,0xfe,0x87,0x02,0x30,0x00,0x7f,0x80,0x0a,
-0x04,0x81,0x0c,0xce,0xfd,0xcc,0xc0,0x00,0xaf,0x51,0xfe,0x07,0xf2,0x01,0x5f,0xf3,
-0x1f,0xd0,0x00,0x0e,0xf1,0x3f,0xff,0x31,0xfd,0x00,0x00,0xef,0x19,0xff,0x0f,0x00,
-0x31,0x1a,0xbf,0x31,0x1e,0x00,0x91,0x0a,0xf3,0x1f,0xfd,0xdd,0xdf,0xf1,0x00,0xaf,
-0x1e,0x00,0x22,0x10,0x0a,0x1e,0x00,0x00,0x0f,0x00,0x21,0x11,0x11,0x0f,0x00,0x01,
-0x59,0x08,0x70,0xaf,0x31,0xfe,0xcc,0xcc,0xdd,0x10,0x71,0x02,0x22,0x06,0xa0,0x10,
-0x0d,0x00,0x60,0x0c,0x00,0xae,0x17,0x30,0x06,0xf7,0x00,0x06,0x18,0x81,0xdd,0xde,
-0xed,0xdd,0xc0,0x00,0xaf,0xb0,0xf9,0x0c,0xf0,0x10,0x06,0xff,0xa0,0x03,0x50,0x00,
-0x56,0x10,0x1f,0xff,0xa0,0x0e,0xe0,0x00,0xdf,0x20,0x0b,0xcf,0xa0,0x0c,0xf1,0x00,
-0xff,0x00,0x02,0x4f,0xa0,0x09,0xf4,0x01,0xfc,0xe3,0x15,0x40,0x06,0xf7,0x04,0xf9,
-0x08,0x00,0x40,0x04,0xf9,0x07,0xf5,0x08,0x00,0x40,0x02,0xfb,0x0a,0xf1,0x08,0x00,
-0x20,0x01,0x61,0x49,0x02,0x21,0x3f,0xa8,0xb3,0x0f,0x30,0x00,0x3f,0xa6,0x7b,0x0e,
-0xf0,0x04,0xc6,0x00,0x03,0x51,0x00,0x00,0x01,0x56,0x00,0x00,0x0b,0xf5,0x03,0x69,
-0xcf,0xff,0x80,0x00,0x2f,0xaf,0x1c,0x80,0x84,0x00,0x00,0x9f,0x61,0xfd,0x52,0xcf,
-0xc0,0x19,0x20,0x21,0xfa,0x1d,0x03,0xf1,0x04,0x0c,0xff,0x11,0xfa,0x00,0xaf,0x20,
-0x00,0x9f,0xff,0x11,0xfe,0xbb,0xef,0xcb,0xb2,0x7f,0xdf,0x11,0xb9,0x07,0x40,0x04,
-0xbf,0x11,0xfb,0x55,0x27,0x72,0x00,0xbf,0x11,0xfa,0x00,0x4f,0x90,0x08,0x00,0x21,
-0x1f,0xc0,0x08,0x00,0xf6,0x0c,0x0b,0x5d,0xf1,0xc4,0x00,0xbf,0x12,0xfc,0x7e,0xd8,
-0xfb,0xf7,0x00,0xbf,0x19,0xff,0xfa,0xf5,0xef,0xf2,0x00,0xbf,0x15,0xd7,0x30,0xa3,
-0x4c,0x59,0x08,0x41,0x03,0x72,0x00,0x29,0x6a,0x13,0x12,0xf6,0xda,0x08,0x23,0x3f,
-0xe0,0xa9,0x03,0x91,0x78,0xcc,0xcd,0xdc,0xcc,0xc0,0x05,0xff,0x2a,0x81,0x09,0x40,
-0x2e,0xff,0x20,0x00,0x13,0x0d,0x10,0xaf,0x08,0x00,0x52,0xf2,0x00,0x00,0x3e,0xef,
-0x08,0x00,0x20,0x02,0xcf,0xa8,0x1a,0x00,0xd9,0x05,0x82,0x21,0xdd,0xdf,0xfd,0xdd,
-0x80,0x00,0xcf,0x18,0x00,0x0e,0x08,0x00,0x12,0x2f,0xa5,0x0f,0x20,0xcf,0x2d,0x69,
-0x03,0x40,0xd4,0x00,0x09,0xa2,0xe4,0x0d,0x01,0x66,0x19,0x01,0x08,0x00,0x22,0x7f,
-0xa0,0x08,0x00,0x20,0xdf,0x4c,0x02,0x0b,0x41,0xc3,0x06,0xff,0x1f,0x30,0x00,0x70,
-0x1e,0xff,0x10,0x02,0xff,0xff,0x20,0x61,0x05,0x40,0x08,0xff,0xff,0x80,0x61,0x04,
-0xd0,0x0f,0xbf,0xec,0xe0,0x00,0x02,0xbf,0x10,0x7f,0x4f,0xe4,0xf7,0x00,0xe0,0x00,
-0xf0,0x0d,0x0f,0xe0,0xdf,0x20,0x00,0xbf,0x1c,0xf5,0x0f,0xe0,0x5f,0xc0,0x00,0xbf,
-0xaf,0xcf,0xff,0xff,0xfc,0xf8,0x00,0xbf,0x3b,0x1b,0xbf,0xfb,0xb2,0xa0,0x3c,0x01,
-0x22,0x0f,0xe0,0x61,0x04,0x20,0x0e,0xd0,0xf1,0x00,0x13,0x40,0x51,0x07,0x14,0xfc,
-0x9f,0x0c,0x02,0x29,0x04,0x70,0x3f,0xe2,0xcc,0xcc,0xcc,0xcf,0xf9,0xdb,0x19,0x00,
+0x8f,0x30,0x00,0x7f,0xa3,0x00,0x3a,0xf7,0x00,0x00,0x05,0xef,0xff,0xfe,0x50,0xb9,
+0x01,0x20,0x66,0x40,0x66,0x00,0xf0,0x13,0x66,0x66,0x63,0x00,0x00,0x00,0x20,0xcf,
+0xff,0xf2,0x50,0x00,0x03,0xf8,0x1e,0xff,0x65,0xf9,0x00,0x16,0xb8,0x03,0xfb,0x02,
+0xa7,0x70,0x6f,0xa0,0x00,0x51,0x00,0x3f,0xb0,0x49,0x9a,0x01,0x30,0x07,0x93,0xef,
+0x9a,0x01,0x40,0x08,0xf6,0x49,0x10,0x0e,0x00,0x31,0x71,0xaf,0x60,0x3d,0x02,0xf0,
+0x0b,0x36,0xa1,0x00,0x00,0x00,0x6b,0x30,0x0a,0xf8,0x20,0x00,0x06,0x8f,0x50,0x01,
+0x4c,0xe7,0x68,0x8f,0xb1,0x00,0x00,0x0a,0x6e,0xac,0xc6,0x62,0x00,0x36,0x06,0x44,
+0x40,0x2b,0x01,0xf0,0x24,0x8e,0x34,0x78,0x61,0x00,0x00,0x07,0xfd,0xff,0xfe,0xff,
+0x91,0x00,0x6f,0x70,0xbf,0x40,0x06,0xed,0x10,0x8f,0x50,0x0a,0xf5,0x00,0x2e,0xb0,
+0x0d,0xf6,0x00,0xed,0x00,0x03,0xf4,0x1f,0xcf,0x7a,0xf4,0x00,0x00,0xd9,0x3f,0x37,
+0xff,0x40,0x00,0x00,0xab,0x3f,0x20,0x53,0x16,0x03,0x20,0x1f,0x50,0x3d,0x00,0x30,
+0xd8,0x0b,0xc0,0xb2,0x00,0x20,0xf3,0x02,0xcb,0x00,0xf0,0x00,0x2e,0xa0,0x00,0x6f,
+0xb4,0x00,0x17,0xfc,0x10,0x00,0x03,0xcf,0xff,0xff,0x80,0x5f,0x01,0x21,0x56,0x40,
+0x8e,0x01,0x21,0x10,0x00,0xf5,0x01,0xf0,0x38,0xff,0xfa,0x00,0x2f,0xe9,0x99,0x9b,
+0xf4,0x00,0x7f,0x70,0x00,0x09,0xd0,0x00,0xcf,0x10,0x00,0x0f,0x70,0x00,0xfc,0x00,
+0x00,0x9f,0x10,0x00,0x9f,0x10,0x1c,0xd3,0x00,0x06,0xff,0x70,0xe9,0x00,0x00,0x3f,
+0x8c,0x75,0xf9,0x00,0x00,0xbc,0x0e,0x2c,0xaf,0x00,0x00,0xd9,0x2d,0x1a,0x3f,0x20,
+0x00,0xbc,0x01,0x00,0x6f,0x00,0x00,0x4f,0x80,0x04,0xe9,0x00,0x00,0x07,0xff,0xff,
+0xe9,0x01,0x31,0x27,0x74,0x00,0xc6,0x01,0x21,0xff,0xa0,0x06,0x00,0x90,0xb1,0x10,
+0x1f,0xee,0xed,0xdd,0xdd,0xf2,0x1d,0x15,0x00,0xd1,0xb2,0x1d,0x01,0x77,0x77,0x60,
+0xb2,0x1d,0x03,0xff,0xff,0xe0,0xb3,0x12,0x00,0x11,0xb3,0x12,0x00,0x12,0xb3,0x12,
+0x00,0x11,0x1e,0x12,0x00,0xc4,0x0e,0x11,0x11,0x11,0x11,0xb3,0x0d,0xdd,0xff,0xff,
+0xec,0xc2,0x48,0x00,0x31,0x7b,0xbb,0x70,0x47,0x03,0xf0,0x06,0xbd,0xdb,0x50,0x07,
+0x00,0x02,0xdf,0xff,0xff,0xf0,0x0f,0xd3,0x2f,0xfa,0x30,0x03,0x20,0x0e,0x4d,0xef,
+0x80,0x6d,0x03,0x31,0x00,0x8f,0x40,0x07,0x00,0x21,0x03,0xd9,0x07,0x00,0x30,0x00,
+0x1e,0x90,0x07,0x00,0x21,0x02,0xd7,0x0e,0x00,0x11,0x5d,0x1c,0x00,0x20,0x08,0xfd,
+0x43,0x00,0x40,0x0f,0xca,0xaf,0xa0,0x07,0x00,0x70,0x60,0x0d,0xfd,0x63,0x37,0x60,
+0x03,0x61,0x00,0x20,0xff,0xe0,0x11,0x01,0xf1,0x19,0x7a,0xa7,0x10,0xbd,0xef,0xfd,
+0xdd,0xdd,0xf1,0xc2,0x6f,0xe0,0x00,0x11,0xc2,0xc2,0x39,0x80,0x1a,0xff,0xf2,0xc2,
+0x16,0x52,0xef,0xff,0xf2,0xc2,0x6f,0xf0,0x19,0xff,0xf2,0xc2,0x5f,0xe0,0x00,0x11,
+0xb2,0xc2,0xc8,0x00,0x30,0xc2,0x5f,0xe0,0x06,0x00,0x20,0x6f,0xf0,0x06,0x00,0x20,
+0x15,0x40,0x06,0x00,0x21,0x4f,0xe0,0x18,0x00,0x00,0x12,0x00,0x70,0xcc,0xdf,0xfc,
+0xcc,0xcc,0xf1,0x01,0xc8,0x00,0x00,0x60,0x01,0x11,0x22,0x08,0x04,0xf1,0x42,0xbf,
+0xff,0xfa,0x20,0x00,0x00,0x7f,0xea,0xce,0x8d,0xf5,0x00,0x06,0xf9,0x03,0xbd,0x10,
+0xaf,0x30,0x1f,0xa0,0x04,0xbd,0x10,0x0c,0xd0,0x7f,0x10,0x04,0xce,0x10,0x03,0xf3,
+0xab,0x00,0x02,0xcc,0x00,0x00,0xe7,0xba,0x00,0x36,0x00,0xb9,0x00,0xc8,0xab,0x05,
+0xeb,0x76,0xc8,0xd3,0xe7,0x7f,0x8e,0x5c,0x61,0xbb,0x5d,0xf4,0x1f,0xd4,0xd5,0x00,
+0x05,0xdc,0xd0,0x06,0xff,0x30,0x00,0x00,0x9f,0x30,0x00,0x7f,0xc6,0x33,0x6d,0xf4,
+0x54,0x00,0x11,0xf9,0xfe,0x03,0x16,0x22,0x09,0x04,0x30,0x01,0xaf,0xfe,0x69,0x02,
+0x40,0x0c,0xd4,0x28,0xf5,0x64,0x04,0xf1,0x2a,0x20,0x00,0x9c,0x00,0x32,0x00,0x5f,
+0x00,0x00,0x6e,0x3e,0xff,0x90,0x3f,0x30,0x00,0xac,0xdf,0xff,0xf4,0x0c,0xe5,0x28,
+0xf5,0xff,0xff,0xf8,0x00,0xaf,0xff,0xd3,0xdf,0xff,0xf5,0x00,0xce,0xa9,0xff,0xff,
+0xff,0xb0,0x0a,0xd1,0x1d,0xff,0xff,0xff,0x70,0x1f,0x40,0xbf,0xff,0xff,0xff,0xf1,
+0x5e,0x05,0x55,0x03,0x20,0x7c,0x1b,0x07,0x00,0xb9,0xf7,0x6f,0xff,0xdd,0xdd,0xdd,
+0xdd,0xd6,0x02,0x22,0x00,0x01,0x00,0x22,0x06,0x90,0xc5,0x03,0x12,0xda,0x0f,0x00,
+0x22,0x1c,0xb0,0x0f,0x00,0xa1,0xcc,0x00,0x00,0x3c,0xbb,0xbb,0xba,0xbf,0xc1,0x00,
+0x9b,0x03,0x40,0xfd,0x10,0x14,0x44,0x01,0x00,0x21,0x30,0x03,0xa9,0x03,0xb2,0xf4,
+0x00,0x3e,0xfd,0xde,0xee,0xef,0xf4,0x00,0x02,0xea,0x37,0x00,0x22,0x1d,0xa0,0x37,
+0x00,0x13,0xdb,0x46,0x00,0x01,0x02,0x05,0x0b,0x69,0x00,0x22,0xee,0xb6,0x09,0x00,
+0x21,0x49,0xe8,0x0e,0x00,0x30,0xa4,0x19,0xd2,0x32,0x00,0x91,0x5b,0xd3,0x30,0x00,
+0x00,0x06,0xfc,0x60,0x45,0x55,0x05,0x80,0xbc,0x00,0x00,0x00,0x18,0xa8,0x9c,0x71,
+0x07,0x05,0xf0,0x10,0x00,0x01,0xcd,0x10,0x00,0x1e,0xf2,0x5f,0xd0,0x3f,0xc0,0x00,
+0x5f,0xf0,0xbf,0xf3,0x1f,0xf1,0x00,0x0d,0xf3,0x4e,0xb0,0x4f,0xa0,0x00,0x02,0xdd,
+0x10,0x02,0xdc,0x90,0x03,0x91,0xcb,0xab,0x60,0x00,0x00,0x01,0x33,0x33,0x32,0xe9,
+0x04,0xf0,0x0b,0xff,0x70,0x00,0x1f,0x63,0x33,0xc8,0xf7,0x00,0x1f,0x40,0x00,0xe0,
+0x6f,0x70,0x1f,0x40,0x00,0xed,0xd7,0xf1,0x1f,0x40,0x00,0x01,0x13,0x06,0x00,0x2f,
+0x00,0x03,0x06,0x00,0x0d,0x81,0x74,0x44,0x44,0x47,0xf1,0x0e,0xff,0xff,0x33,0x05,
+0x02,0xf8,0x05,0x20,0xbd,0xb4,0x07,0x00,0xf0,0x38,0x4d,0x41,0x3c,0x61,0x00,0x00,
+0x00,0xe2,0x00,0x01,0xed,0xe9,0x00,0x03,0xc0,0x00,0x00,0x10,0x0a,0x70,0x05,0xc0,
+0x00,0x00,0x01,0x01,0xe0,0x1e,0x30,0x02,0x69,0xdf,0x40,0xe0,0x88,0x09,0xef,0xfb,
+0x84,0x02,0xd0,0xc2,0x08,0x73,0x65,0x00,0x02,0xe2,0xc2,0x00,0x01,0xee,0x10,0x00,
+0x5a,0x95,0x00,0x0a,0xff,0x90,0x00,0x2c,0x3d,0x00,0x17,0x88,0x70,0x00,0x4a,0x08,
+0xd3,0xa1,0x02,0x87,0xd3,0x00,0x4c,0xed,0xde,0xee,0xed,0x40,0x19,0x01,0x22,0x02,
+0x10,0x57,0x06,0x13,0x60,0x07,0x00,0x11,0xb4,0x07,0x00,0xf1,0x18,0x64,0xf2,0x00,
+0x02,0x64,0x04,0xff,0xf6,0x80,0x00,0x6f,0xef,0x7e,0xa2,0x9e,0x00,0x01,0xf8,0x01,
+0x3f,0x50,0x4f,0x10,0x06,0xe0,0x00,0x0c,0xd7,0xdd,0x00,0x0b,0x90,0x00,0x01,0xcf,
+0xc2,0x00,0x0e,0x50,0x38,0x00,0x21,0x1f,0x20,0x07,0x00,0x12,0x3f,0x46,0x00,0x12,
+0x4f,0x07,0x00,0x16,0x6d,0x54,0x00,0x00,0xca,0x00,0xb1,0xde,0x60,0x0e,0x85,0xf1,
+0x0e,0x52,0xf1,0x06,0xff,0x90,0xbf,0x05,0x80,0x6f,0xe4,0xef,0xfb,0xdf,0xfb,0x5e,
+0xd3,0x1d,0x00,0x20,0x1e,0x82,0x40,0x01,0xf1,0x05,0xc6,0x00,0x00,0x5a,0xef,0xf8,
+0x00,0x01,0x7e,0xfc,0x07,0xcf,0xfe,0x92,0x1f,0xfb,0x50,0x00,0x08,0x20,0x58,0x01,
+0xf0,0x05,0xfb,0x0c,0xcc,0xcc,0xc8,0x03,0x90,0x00,0x1f,0xfb,0x00,0x06,0xff,0xb0,
+0x00,0x5f,0xf8,0x00,0x07,0xb0,0xbb,0x01,0x12,0x11,0x01,0x00,0x21,0x1f,0xff,0x01,
+0x00,0x14,0xf9,0x08,0x00,0x00,0x5d,0x00,0x02,0x55,0x02,0x0f,0x08,0x00,0x0f,0x30,
+0xfe,0xee,0xee,0xf1,0x02,0x00,0x7f,0x07,0x1f,0x20,0x38,0x00,0x14,0x00,0x78,0x00,
+0x53,0x7f,0xa1,0x11,0x11,0x10,0x70,0x00,0x43,0xf7,0x1d,0xdd,0xdd,0xda,0x02,0x01,
+0x01,0x00,0x13,0x20,0x18,0x00,0xd3,0xf2,0x1b,0xbb,0xbb,0xdf,0xeb,0xbb,0xbb,0xb1,
+0x00,0x00,0x00,0x5f,0xbd,0x06,0x05,0x08,0x00,0x22,0xfe,0x70,0x08,0x00,0x31,0xff,
+0xfe,0x60,0x08,0x00,0x41,0xb3,0xcf,0xfc,0x20,0x20,0x00,0x32,0x06,0xfd,0x10,0x28,
+0x00,0x2e,0x22,0x00,0x38,0x00,0x0a,0x08,0x00,0x21,0x0a,0xbb,0x01,0x00,0x22,0xa0,
+0x0e,0x70,0x00,0xb0,0xe0,0x03,0x33,0x33,0x4d,0xfc,0x33,0x33,0x30,0x00,0x00,0xf3,
+0x08,0x01,0xcf,0x02,0x31,0xff,0xf2,0x60,0xcd,0x01,0x40,0xff,0xfe,0xfa,0x10,0x58,
+0x09,0xf0,0x0e,0xbf,0xf4,0xef,0xd3,0x00,0x01,0xaf,0xf9,0x0f,0xf0,0x1c,0xff,0x50,
+0x2f,0xff,0x70,0x0f,0xf0,0x00,0xaf,0xf4,0x0a,0xc2,0x00,0x0f,0xf0,0x00,0x0a,0x90,
+0xd1,0x04,0x03,0x79,0x02,0x0f,0x08,0x00,0x04,0x12,0x65,0x0e,0x00,0x22,0x1f,0xe0,
+0xd3,0x01,0x82,0xff,0xcc,0xcc,0xcc,0xcc,0x30,0x00,0x6f,0x92,0x03,0x22,0x09,0xf6,
+0x1e,0x00,0x22,0xcf,0x20,0x33,0x00,0x10,0xfb,0x9d,0x00,0x25,0x70,0x03,0x94,0x01,
+0x00,0x0d,0x07,0x02,0xf6,0x00,0x21,0x09,0xf5,0x23,0x01,0x30,0xd0,0xcf,0x30,0x41,
+0x00,0x13,0xca,0x5d,0x00,0x21,0x05,0xfd,0xeb,0x02,0x21,0xdd,0xff,0x25,0x00,0x37,
+0xff,0xfe,0x80,0xa3,0x02,0x22,0x05,0xb3,0x08,0x00,0x22,0x2f,0xf6,0xb2,0x02,0x31,
+0xef,0xff,0x40,0xd8,0x00,0x20,0xf9,0x8f,0x11,0x00,0xf0,0x0a,0x1a,0xff,0x80,0x07,
+0xff,0xb2,0x00,0x29,0xff,0xf7,0x0c,0xc0,0x5f,0xff,0x92,0x2f,0xfb,0x20,0x0f,0xf0,
+0x02,0xbf,0xf3,0x05,0x50,0xb8,0x00,0x2e,0x05,0x50,0xd8,0x00,0x0f,0x08,0x00,0x15,
+0x2d,0x01,0xfe,0x07,0x00,0x82,0xad,0xdd,0xdd,0xff,0xdd,0xdd,0xd2,0xcf,0xe3,0x01,
+0xa8,0xcf,0x20,0x02,0xfe,0x00,0x0d,0xf2,0xcf,0x20,0x01,0x07,0x00,0x64,0xba,0xab,
+0xff,0xaa,0xaf,0xf2,0x23,0x00,0x70,0x42,0x24,0xfe,0x22,0x2d,0xf2,0x23,0x3f,0x00,
+0x2e,0x02,0x20,0x54,0x00,0x02,0xd1,0x00,0x07,0x07,0x00,0x82,0x0b,0xbb,0xbb,0xff,
+0xbb,0xbb,0xa0,0x0f,0xd5,0x01,0xe3,0x0f,0xe0,0x02,0xfe,0x00,0x2f,0xe0,0x0f,0xf9,
+0x9a,0xff,0x99,0xbf,0xe0,0x15,0x00,0x40,0x00,0x00,0x03,0xfe,0x19,0x09,0x02,0x5c,
+0x01,0xf3,0x06,0xbf,0xca,0xab,0xff,0xaa,0xad,0xf9,0xbf,0x40,0x02,0xfe,0x00,0x07,
+0xf9,0xbf,0xcb,0xbc,0xff,0xbb,0xbd,0xf9,0x1c,0x00,0x10,0x68,0xa1,0x00,0x24,0x04,
+0x85,0x62,0x00,0x01,0x40,0x00,0x12,0xf3,0x9d,0x01,0x10,0xbe,0x08,0x00,0x41,0xe0,
+0x39,0x00,0x0a,0x08,0x00,0x22,0xbf,0xc0,0x08,0x00,0x22,0x0b,0xfc,0x08,0x00,0xe2,
+0x00,0xa3,0x0a,0xf3,0x00,0x2c,0xcf,0xfc,0xcc,0xcc,0xce,0xfd,0xc2,0x3f,0x62,0x02,
+0x11,0xf3,0x78,0x02,0x71,0x0b,0xf4,0x00,0x00,0x9f,0x70,0x00,0x38,0x00,0x21,0xdf,
+0x30,0x08,0x00,0x31,0x07,0xfc,0x00,0x65,0x09,0xf0,0x06,0x4f,0xf3,0x00,0x00,0x9c,
+0xcf,0xf1,0x00,0x09,0x50,0x00,0x00,0x6f,0xfd,0x70,0x00,0x00,0x16,0x00,0xdf,0x10,
+0x1b,0x00,0x31,0xf7,0x0d,0xf1,0xbf,0x01,0x21,0xf1,0xdf,0x6c,0x04,0x30,0x87,0x0e,
+0xf1,0x4c,0x07,0x83,0xee,0xee,0xff,0xee,0xee,0xee,0x50,0xff,0x7c,0x09,0x00,0xa0,
+0x0b,0xf0,0x1c,0x00,0xbf,0x40,0x00,0x00,0x8f,0x82,0x30,0x0c,0xf3,0x00,0x00,0x0e,
+0xf5,0xfe,0x10,0xcf,0x30,0x00,0x07,0xfc,0x07,0xfa,0x0d,0xf2,0x00,0x02,0xff,0x50,
+0x0d,0xa0,0xff,0x10,0x01,0xef,0xa0,0x00,0x00,0x1f,0xf0,0x04,0xef,0xd0,0xb6,0x05,
+0xf7,0x00,0x01,0xff,0xb1,0x00,0x01,0xff,0xff,0x80,0x03,0x80,0x00,0x00,0x0c,0xfe,
+0xa1,0x32,0x02,0x23,0x57,0x00,0x2a,0x02,0x12,0xc1,0x09,0x00,0x20,0x2d,0xfd,0x47,
+0x02,0x82,0xbb,0xbb,0xbc,0xfe,0xbb,0xbb,0x50,0x07,0x73,0x00,0x8e,0x60,0x00,0x11,
+0x11,0x2f,0xf2,0x11,0x11,0xfa,0x01,0xa1,0x8e,0xee,0xef,0xfe,0xee,0xe9,0x00,0x00,
+0x9f,0xff,0xd6,0x08,0x0f,0x22,0x02,0x05,0x13,0x1f,0x18,0x01,0x21,0x1e,0xee,0x01,
+0x00,0x10,0xe2,0xb9,0x08,0x03,0x80,0x00,0xf0,0x04,0x9f,0x50,0x00,0x31,0x00,0x00,
+0x04,0x00,0x2f,0xd0,0x00,0xef,0x30,0x00,0xbf,0x50,0x0b,0xf4,0x05,0xa8,0x0c,0x60,
+0xc0,0x05,0xa3,0x0c,0xf6,0x00,0x61,0x0c,0x60,0x00,0x2f,0xe0,0x00,0x00,0x05,0xf2,
+0x00,0x10,0x80,0x35,0x03,0x32,0x90,0x05,0xfe,0xe1,0x02,0x21,0x3f,0xf4,0xf1,0x02,
+0x32,0xff,0xef,0x80,0x02,0x09,0x22,0xfc,0x00,0xdd,0x0a,0x20,0xff,0xb2,0xb6,0x06,
+0xf5,0x09,0xef,0xe6,0x6f,0xff,0x82,0x00,0x2a,0xff,0xfa,0x10,0x01,0xbf,0xff,0xc3,
+0x1f,0xf9,0x30,0x00,0x00,0x03,0xaf,0xc0,0x03,0x00,0xb9,0x0a,0x23,0x2b,0x50,0x22,
+0x04,0x22,0xf1,0x00,0xe7,0x0b,0x10,0xf8,0x37,0x00,0x73,0xcc,0xcc,0xcd,0xfd,0xcc,
+0xd8,0x00,0xf8,0x00,0x12,0x20,0x22,0x00,0x13,0xf5,0x22,0x01,0x02,0x69,0x00,0x22,
+0x2e,0xfa,0xd5,0x03,0x22,0xef,0xa0,0x1e,0x00,0x13,0xf9,0x78,0x00,0x01,0x1e,0x00,
+0x31,0x18,0xef,0xe4,0x50,0x04,0x31,0xef,0xff,0x60,0x01,0x04,0xb1,0xf6,0x7f,0xfe,
+0xdc,0xcc,0xdf,0xf4,0x08,0x90,0x02,0x8d,0x90,0x02,0x00,0x01,0x00,0x02,0x46,0x06,
+0x13,0x48,0x5a,0x06,0x21,0xbf,0x30,0x29,0x00,0x03,0x40,0x01,0xa0,0x1f,0xeb,0xbb,
+0xbb,0xbd,0xf9,0x00,0x00,0x1f,0xb0,0xcc,0x0a,0x01,0x08,0x00,0x31,0x1b,0xbf,0xf2,
+0x08,0x00,0x20,0x0b,0xcb,0xed,0x0d,0x63,0xe8,0x88,0x88,0x88,0x88,0x80,0x51,0x01,
+0x12,0xf0,0xdb,0x05,0xa1,0x1e,0xf0,0x19,0x99,0x99,0x99,0x99,0x98,0x0e,0xe0,0x17,
+0x00,0x32,0xfe,0x0f,0xd0,0xf2,0x05,0x21,0x2f,0xc0,0xee,0x00,0x32,0xbb,0xdf,0x80,
+0x70,0x04,0x27,0xfc,0x10,0xf8,0x01,0xf1,0x0a,0x01,0x23,0x57,0xa3,0x00,0x00,0x9d,
+0xef,0xff,0xff,0xff,0xfb,0x00,0x00,0xcf,0xed,0xcb,0xa9,0x75,0x30,0x00,0x00,0xef,
+0x10,0x06,0xb9,0x00,0x41,0xfe,0x00,0x0d,0xf1,0x77,0x0d,0x02,0x08,0x00,0x92,0x05,
+0xfb,0x22,0x2e,0xf3,0x22,0x22,0x10,0x0a,0x18,0x01,0x40,0x90,0x05,0xdc,0xcc,0xf2,
+0x02,0x70,0x70,0x00,0x05,0x10,0x0d,0xf1,0x01,0x69,0x09,0xf0,0x0e,0xc0,0x0d,0xf1,
+0x1f,0xe2,0x00,0x04,0xff,0x20,0x0d,0xf1,0x06,0xfd,0x00,0x4f,0xf5,0x00,0x0e,0xf1,
+0x00,0xaf,0xa0,0x2c,0x60,0x3e,0xef,0xf0,0x00,0x1d,0x1e,0x0a,0x1b,0xfd,0x6a,0x08,
+0x90,0x01,0x24,0x57,0x91,0x00,0x00,0xce,0xff,0xff,0x1c,0x09,0xf2,0x03,0x00,0x8b,
+0xba,0xaf,0xf7,0x54,0x10,0x00,0x08,0x99,0x99,0x9f,0xf9,0x99,0x99,0x80,0x0f,0xff,
+0xe0,0x00,0xf0,0x1c,0x02,0x22,0x98,0x2f,0xf2,0x99,0x22,0x20,0x04,0x99,0xfd,0x0f,
+0xf0,0xde,0x8d,0x10,0x07,0xee,0xfd,0x0f,0xf0,0xdf,0xfc,0x40,0x00,0x01,0xed,0x0f,
+0xf0,0xde,0x12,0x10,0x0c,0xff,0xfd,0x9f,0xf9,0xdf,0x8c,0xf1,0x08,0x96,0xdf,0x30,
+0x00,0xf0,0x0c,0xa0,0x00,0x02,0xcf,0xbf,0xfb,0xfb,0x20,0x00,0x04,0xaf,0xf8,0x0f,
+0xf0,0x8f,0xf9,0x30,0x3f,0xfb,0x40,0x0f,0xf0,0x04,0xcf,0xf3,0x04,0x30,0x88,0x02,
+0x40,0x03,0x50,0x00,0x12,0x79,0x06,0x31,0x21,0x00,0x00,0x74,0x04,0x13,0xfc,0x1a,
+0x04,0x2f,0xfb,0x00,0x01,0x00,0x1d,0x03,0x52,0x07,0x04,0xda,0x06,0x14,0xf1,0x08,
+0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0xbb,0x01,0x00,0x31,
+0x00,0x01,0xff,0x01,0x00,0xe0,0x10,0x00,0x22,0x22,0x2d,0xf4,0x22,0x22,0x00,0x00,
+0x00,0x00,0x0d,0xf2,0x06,0x00,0x03,0x08,0x00,0x12,0x02,0x18,0x00,0x22,0x20,0x2f,
+0x28,0x00,0x9c,0xf2,0x2b,0xbb,0xbb,0xbf,0xfc,0xbb,0xbb,0xb2,0x28,0x00,0x0e,0x08,
+0x00,0x31,0xef,0xff,0xf0,0x08,0x00,0x49,0x9f,0xfc,0x60,0x00,0x01,0x00,0x22,0x3b,
+0x70,0x08,0x00,0xe2,0x2f,0xf1,0x00,0x00,0x00,0x0b,0xbb,0xbb,0xbf,0xfd,0xbb,0xbb,
+0xb0,0x0f,0x60,0x00,0xf0,0x20,0xf0,0x01,0x11,0x88,0x31,0x11,0x89,0x11,0x10,0x00,
+0x08,0xfe,0x20,0x02,0xef,0xb1,0x00,0x02,0xcf,0xe2,0x00,0x00,0x1c,0xfe,0x20,0x0c,
+0xfc,0x7c,0x30,0x02,0xd9,0xaf,0xd0,0x00,0x70,0x4f,0xb0,0x0a,0xf8,0x08,0x10,0x00,
+0x00,0x0b,0xf7,0x6f,0xe0,0x47,0x00,0x50,0x01,0xef,0xff,0x30,0x00,0xaa,0x00,0x20,
+0xcf,0xfd,0x08,0x00,0xf7,0x08,0x04,0xaf,0xfd,0xdf,0xfb,0x41,0x00,0x0b,0xff,0xfe,
+0x60,0x06,0xef,0xff,0xd1,0x09,0xea,0x40,0x00,0x00,0x05,0x9e,0x80,0x80,0x00,0x10,
+0x27,0x90,0x00,0x84,0x05,0x55,0x55,0x7f,0xf6,0x55,0x55,0x50,0x78,0x00,0xa0,0x03,
+0x34,0x44,0x44,0x44,0x44,0x43,0x30,0x00,0x1f,0x0f,0x00,0x80,0xf3,0x00,0x00,0x1f,
+0xd4,0x44,0x44,0x4d,0x08,0x00,0xf0,0x01,0xfd,0xdd,0xdd,0xdf,0xf3,0x00,0x00,0x06,
+0x66,0x66,0x66,0x66,0x61,0x00,0x00,0x9f,0x20,0x00,0x90,0xd2,0x00,0x00,0x58,0x88,
+0x89,0xdf,0xff,0x91,0x50,0x00,0x62,0x1f,0xfe,0x82,0x00,0x00,0x3f,0x48,0x00,0xd2,
+0xf3,0x19,0x99,0x99,0x9f,0xf9,0x99,0x99,0x91,0x00,0x00,0x68,0x9f,0x00,0x01,0x23,
+0x7f,0xfe,0xf0,0x00,0xe3,0x2a,0xa0,0x00,0x00,0x00,0x17,0x77,0x77,0x8f,0xf8,0x77,
+0x77,0x71,0x3f,0x50,0x01,0x20,0x00,0x04,0x78,0x00,0x41,0x40,0x00,0x00,0x0e,0x87,
+0x00,0x85,0x00,0x00,0x0e,0xf1,0x11,0x11,0x1f,0xf0,0x10,0x00,0x00,0xa9,0x00,0x44,
+0x55,0x55,0x51,0x00,0xa8,0x00,0x20,0x0f,0xd5,0x10,0x00,0xf4,0x1d,0x5e,0xf0,0x0f,
+0xc0,0x8f,0xff,0xff,0xf7,0x0d,0xf0,0x00,0x00,0xbf,0xb9,0x9d,0xf7,0x01,0x00,0x00,
+0x06,0xff,0x00,0x08,0xf8,0x07,0xc1,0x08,0xcf,0xf6,0x00,0x07,0xfd,0xae,0xf1,0x0b,
+0xfc,0x40,0x00,0x02,0xdf,0xff,0x80,0x01,0x10,0xf7,0x00,0x13,0x31,0x08,0x00,0x21,
+0xef,0x20,0x07,0x00,0xf1,0x2f,0x07,0xfc,0xad,0xdd,0xdd,0xdd,0xb0,0x00,0x1f,0xf4,
+0xcf,0xff,0xff,0xff,0xe0,0x00,0xaf,0xd0,0x5f,0x70,0x00,0x3f,0xb0,0x06,0xff,0xc0,
+0x1f,0xc0,0x00,0x8f,0x70,0x4f,0xff,0xc0,0x0c,0xf1,0x00,0xdf,0x20,0x1e,0xaf,0xc0,
+0x06,0xf8,0x04,0xfc,0x00,0x03,0x1f,0xc0,0x00,0xef,0x2d,0xf5,0x00,0x00,0x1f,0xc0,
+0x00,0x6f,0xef,0xc0,0x08,0x00,0x32,0x0d,0xff,0x20,0x10,0x00,0x20,0xff,0x90,0x08,
+0x00,0xf7,0x06,0x2a,0xff,0x7e,0xfc,0x40,0x00,0x1f,0xc8,0xff,0xd2,0x01,0xcf,0xf9,
+0x00,0x1f,0xc2,0xc5,0x00,0x00,0x04,0xb1,0x78,0x01,0x13,0x0a,0x0d,0x00,0x21,0x8f,
+0xf6,0x07,0x00,0xf0,0x1b,0x09,0xff,0xff,0x50,0x00,0x00,0x00,0x03,0xcf,0xe3,0x4f,
+0xfa,0x20,0x00,0x03,0x9f,0xfc,0x10,0x02,0xef,0xfa,0x40,0x7f,0xff,0x80,0x00,0x00,
+0x19,0xff,0xf6,0x1e,0x91,0x55,0x00,0x00,0x55,0x17,0x90,0x00,0x00,0xef,0x10,0x03,
+0x00,0x06,0x08,0x00,0x21,0xff,0x00,0x08,0x00,0x22,0x04,0xfe,0x08,0x00,0x22,0x0b,
+0xf9,0x08,0x00,0x21,0x8f,0xf2,0x08,0x00,0x31,0x0a,0xff,0x60,0x08,0x00,0x22,0x01,
+0xc4,0x33,0x00,0x0d,0x01,0x00,0x50,0x04,0xfd,0x00,0x01,0xff,0x08,0x00,0x40,0xfc,
+0x00,0x02,0xfe,0x09,0x02,0x90,0xfb,0x00,0x03,0xfd,0x00,0x00,0x00,0x06,0xf9,0x0b,
+0x00,0x70,0x00,0x00,0x08,0xf8,0x00,0x06,0xfa,0xae,0x00,0x40,0xfb,0x00,0x09,0xfa,
+0xce,0x02,0x30,0xff,0x80,0x0c,0x28,0x00,0x40,0x0f,0xff,0xf4,0x0f,0x69,0x02,0xf1,
+0x2e,0x3f,0xe5,0xfe,0x5f,0xff,0xa0,0x00,0x00,0x8f,0xa0,0xaf,0xdf,0xae,0xf1,0x00,
+0x00,0xdf,0x50,0x24,0xff,0x47,0xfa,0x00,0x06,0xff,0x10,0x0a,0xfd,0x01,0xff,0x60,
+0x1f,0xf8,0x00,0x7f,0xf5,0x00,0x6f,0xf4,0x3e,0xe0,0x00,0x9f,0xa0,0x00,0x09,0xc0,
+0x01,0x30,0x00,0x04,0x00,0x00,0x00,0x10,0x00,0x06,0xb3,0x00,0x02,0xf9,0x1e,0x03,
+0x11,0x12,0x08,0x00,0xf1,0x30,0x4f,0xb0,0xdf,0x02,0xf9,0x03,0x10,0x00,0xcf,0x40,
+0xdf,0x02,0xfc,0xbf,0xd0,0x06,0xff,0x10,0xdf,0x28,0xff,0xff,0xd0,0x2f,0xff,0x10,
+0xdf,0xff,0xfd,0x5f,0xc0,0xaf,0xff,0x7d,0xff,0xeb,0xf9,0x0f,0xc0,0x3d,0xdf,0x7f,
+0xff,0x12,0xf9,0x0f,0xc0,0x01,0xcf,0x23,0xdf,0x02,0xf9,0x0f,0xb0,0x00,0xcf,0x10,
+0xdf,0x02,0xfb,0xff,0x90,0x08,0x00,0x30,0xf9,0xa9,0x10,0x08,0x00,0xf5,0x0d,0x00,
+0x10,0x05,0xc3,0x00,0xcf,0x10,0xcf,0x20,0x00,0x09,0xf4,0x00,0xcf,0x10,0x9f,0xfe,
+0xee,0xff,0xe0,0x00,0xcf,0x10,0x19,0xbc,0xcc,0xca,0x30,0xf8,0x00,0xd1,0x9a,0x10,
+0x00,0x00,0x03,0xfc,0x00,0x00,0xef,0x21,0xba,0x00,0x04,0x08,0x00,0x40,0xef,0x60,
+0x05,0xfa,0x0f,0x02,0x40,0x4f,0xf1,0x07,0xf8,0x08,0x00,0x40,0x0a,0xf6,0x09,0xf6,
+0x08,0x00,0x42,0x02,0x30,0x0d,0xf4,0x27,0x02,0x20,0x2f,0xf0,0x08,0x00,0xb0,0x01,
+0x00,0x6f,0xc0,0x00,0x00,0xef,0x35,0xd8,0x00,0xdf,0x5c,0x01,0xf6,0x16,0xef,0xf9,
+0x06,0xff,0xa0,0x00,0x04,0xff,0xfc,0x40,0x4f,0xff,0xf9,0x00,0x0d,0xfd,0x50,0x07,
+0xff,0x92,0xff,0x80,0x04,0x70,0x03,0xdf,0xfa,0x00,0x4f,0xf4,0x00,0x00,0x00,0xae,
+0x50,0x00,0x08,0xf8,0x01,0x50,0x05,0xa3,0x00,0x06,0x10,0xf8,0x00,0xf0,0x2e,0xf6,
+0x95,0x5f,0xa0,0x3d,0x80,0x00,0x5f,0xc3,0xfb,0x0c,0xf2,0x6f,0x80,0x00,0xcf,0x50,
+0xee,0x05,0xe4,0xaf,0x40,0x07,0xff,0x10,0xbf,0x20,0x00,0xdf,0x00,0x4f,0xff,0x10,
+0x7f,0x60,0x01,0xfc,0x00,0x9f,0xff,0x10,0x3f,0xd0,0x08,0xf7,0x00,0x1a,0xbf,0x10,
+0x0d,0xf5,0x0e,0xf1,0x00,0x00,0xbf,0x10,0x06,0xfc,0x8f,0x90,0x08,0x00,0x41,0x00,
+0xef,0xff,0x10,0x08,0x00,0x30,0x6f,0xf8,0x00,0x08,0x00,0x40,0x03,0xef,0xff,0x50,
+0x08,0x00,0xf5,0x06,0x7f,0xf9,0xaf,0xf9,0x20,0x00,0xbf,0x6e,0xff,0x50,0x07,0xff,
+0xf3,0x00,0xbf,0x2d,0x81,0x00,0x00,0x2b,0x90,0x80,0x00,0x31,0x06,0x40,0x00,0xf1,
+0x02,0x30,0xfe,0x05,0xbf,0x80,0x03,0xf1,0x0f,0x6f,0x9a,0xfe,0xa6,0xa9,0x99,0x90,
+0x0c,0xf2,0xbf,0x00,0x2f,0xff,0xfe,0x05,0xff,0x0b,0xf0,0x02,0xfb,0x0e,0xe0,0xef,
+0xf0,0xbf,0x00,0x2f,0xb0,0xde,0x8f,0x0f,0x00,0x32,0x0d,0xe4,0xee,0x0f,0x00,0x21,
+0x03,0xdf,0x0f,0x00,0x22,0xe0,0x0d,0x0f,0x00,0xf0,0x08,0x00,0xdf,0x0c,0xf9,0xe5,
+0xfb,0x0e,0xe0,0x0d,0xf2,0xff,0xfc,0x5f,0xbd,0xfd,0x00,0xdf,0x0d,0x82,0x02,0xfb,
+0xbd,0x50,0x84,0x03,0x9e,0x2f,0xb0,0x00,0x00,0xdf,0x00,0x00,0x02,0xfb,0x70,0x02,
+0x50,0x06,0xd5,0x10,0x0a,0xf3,0x00,0x01,0x40,0xf3,0x8f,0x5a,0xf3,0xf8,0x01,0x40,
+0xd0,0xcf,0x2a,0xf3,0xc0,0x00,0x90,0x60,0xff,0xae,0xfc,0xaa,0x60,0x05,0xff,0x15,
+0xd8,0x03,0xd0,0x90,0x1e,0xff,0x1c,0xf5,0x2b,0xf6,0x22,0x10,0x8f,0xff,0x2d,0xc0,
+0x30,0x00,0x40,0x2e,0xdf,0x10,0x20,0x08,0x00,0xa1,0x02,0xbf,0x1d,0xdd,0xdf,0xfe,
+0xdd,0xd4,0x00,0xbf,0x99,0x04,0x10,0xf5,0x00,0x01,0x10,0x0a,0x66,0x01,0x00,0x08,
+0x00,0x1f,0xf3,0x08,0x00,0x08,0x05,0x01,0x00,0x10,0x42,0x1c,0x05,0xf0,0x07,0x00,
+0x00,0x01,0xff,0x30,0x02,0x59,0xdf,0xb0,0x00,0x08,0xfd,0xbd,0xff,0xff,0xfc,0x81,
+0x00,0x1f,0xf4,0xce,0xca,0xf8,0x02,0x50,0xaf,0xd0,0x00,0x01,0xfd,0x3f,0x04,0x11,
+0xc0,0x08,0x00,0x13,0x4f,0x08,0x00,0xb0,0x1e,0xbf,0xc8,0xdd,0xde,0xff,0xdd,0xdb,
+0x04,0x1f,0xc9,0x78,0x00,0x32,0xfc,0x00,0x1f,0x18,0x00,0x0f,0x08,0x00,0x08,0x00,
+0x28,0x00,0xf2,0x47,0xfa,0x00,0x1f,0xc0,0xdd,0xdd,0xdd,0xdd,0xd9,0x00,0x04,0x72,
+0x02,0x20,0x04,0x20,0x00,0x00,0x0c,0xf4,0x0b,0xf5,0x3f,0x90,0x00,0x00,0x3f,0xd0,
+0x1f,0xf0,0x0e,0xe0,0x00,0x00,0xbf,0x50,0x7f,0x90,0x09,0xf6,0x00,0x05,0xff,0x11,
+0xff,0x20,0x02,0xfe,0x10,0x2e,0xff,0x2c,0xf8,0x00,0x00,0x9f,0xc1,0x9f,0xff,0x7f,
+0xfc,0xbb,0xbb,0xcf,0xf5,0x1d,0xdf,0x1a,0xbf,0xff,0xff,0xfd,0x70,0x00,0xcf,0x10,
+0x04,0xfa,0x03,0xfa,0x00,0x00,0xcf,0x10,0x06,0xf7,0x08,0x00,0x40,0x0b,0xf3,0x04,
+0xf9,0x08,0x00,0xfe,0x0e,0x2f,0xd0,0x06,0xf7,0x00,0x00,0xcf,0x11,0xdf,0x60,0x09,
+0xf5,0x00,0x00,0xcf,0x3e,0xfa,0x08,0xdf,0xf2,0x00,0x00,0xcf,0x1a,0x90,0x05,0xed,
+0x70,0x00,0x01,0x00,0xf0,0x13,0xdd,0x10,0xbf,0x49,0xb1,0x00,0x00,0x05,0xfc,0x00,
+0xbf,0x48,0xfd,0x20,0x00,0x0d,0xf5,0x00,0xaf,0x40,0x7e,0x30,0x00,0x5f,0xe0,0x00,
+0x9f,0x74,0x68,0x90,0x01,0xef,0xd8,0xce,0x88,0x05,0xf0,0x11,0x0c,0xff,0xda,0xff,
+0xef,0xd9,0x76,0x30,0x2f,0xff,0xd1,0x10,0x5f,0xa0,0x5f,0x80,0x08,0x4f,0xd0,0x00,
+0x2f,0xd1,0xef,0x40,0x00,0x1f,0xd0,0x00,0x0f,0xfb,0xfa,0x00,0x08,0x00,0x31,0x0c,
+0xff,0xd0,0x08,0x00,0xf6,0x15,0x1d,0xfe,0x10,0x60,0x00,0x1f,0xd0,0x05,0xef,0xfe,
+0x01,0xf8,0x00,0x1f,0xd5,0xdf,0xf9,0xcf,0x74,0xf6,0x00,0x1f,0xd4,0xfc,0x30,0x3f,
+0xff,0xf2,0x00,0x1f,0xd0,0x30,0x00,0x05,0xef,0x90,0x80,0x00,0x40,0x30,0x00,0x03,
+0x10,0x70,0x05,0xf0,0x02,0xfa,0x00,0x3f,0xb0,0x00,0x00,0x00,0x0e,0xf5,0xcc,0xdf,
+0xec,0xcc,0x90,0x00,0x7f,0xa2,0x30,0x01,0xf0,0x05,0xb0,0x02,0xff,0x20,0x00,0xef,
+0x00,0x00,0x00,0x0c,0xff,0x4c,0xcd,0xff,0xcc,0xcc,0xc7,0x9f,0xff,0x4f,0x18,0x00,
+0x42,0xf8,0x3e,0xef,0x10,0x80,0x07,0xf0,0x02,0xcf,0x10,0x2f,0xfc,0xcc,0xcc,0x60,
+0x00,0xcf,0x10,0x7f,0xff,0xff,0xff,0xa0,0x00,0xcf,0xf4,0x04,0x01,0x10,0x01,0x40,
+0x02,0xda,0xbf,0xa0,0x08,0x00,0x50,0x01,0xbf,0xfd,0x00,0x00,0x18,0x00,0x41,0x05,
+0xef,0xb0,0x00,0x20,0x00,0x27,0x1c,0x50,0x00,0x01,0x40,0x73,0x00,0x08,0x50,0xf9,
+0x02,0x31,0x90,0x02,0xfe,0x87,0x02,0x30,0x00,0x7f,0x80,0x0a,0x04,0x81,0x0c,0xce,
+0xfd,0xcc,0xc0,0x00,0xaf,0x51,0xfe,0x07,0xf2,0x01,0x5f,0xf3,0x1f,0xd0,0x00,0x0e,
+0xf1,0x3f,0xff,0x31,0xfd,0x00,0x00,0xef,0x19,0xff,0x0f,0x00,0x31,0x1a,0xbf,0x31,
+0x1e,0x00,0x91,0x0a,0xf3,0x1f,0xfd,0xdd,0xdf,0xf1,0x00,0xaf,0x1e,0x00,0x22,0x10,
+0x0a,0x1e,0x00,0x00,0x0f,0x00,0x20,0x11,0x11,0x0f,0x00,0x00,0x9a,0x02,0x00,0x0f,
+0x00,0x50,0xfe,0xcc,0xcc,0xdd,0x10,0x71,0x02,0x20,0x06,0xa0,0x98,0x07,0x40,0xfe,
+0x00,0x0b,0xf4,0xe8,0x05,0x40,0xf8,0x00,0x06,0xf7,0x21,0x02,0xa0,0xf1,0xdd,0xde,
+0xed,0xdd,0xc0,0x00,0xaf,0xb0,0xff,0x71,0x06,0xf0,0x18,0x06,0xff,0xa0,0x03,0x50,
+0x00,0x56,0x10,0x1f,0xff,0xa0,0x0e,0xe0,0x00,0xdf,0x20,0x0b,0xcf,0xa0,0x0c,0xf1,
+0x00,0xff,0x00,0x02,0x4f,0xa0,0x09,0xf4,0x01,0xfc,0x00,0x00,0x3f,0xa0,0x06,0xf7,
+0x04,0xf9,0x08,0x00,0x40,0x04,0xf9,0x07,0xf5,0x08,0x00,0x40,0x02,0xfb,0x0a,0xf1,
+0x08,0x00,0x20,0x01,0x61,0x49,0x02,0x20,0x3f,0xa8,0x48,0x00,0xf0,0x1e,0xf7,0x00,
+0x3f,0xa6,0xcc,0xcc,0xcc,0xcc,0xc6,0x00,0x03,0x51,0x00,0x00,0x01,0x56,0x00,0x00,
+0x0b,0xf5,0x03,0x69,0xcf,0xff,0x80,0x00,0x2f,0xd1,0xff,0xff,0xff,0x84,0x00,0x00,
+0x9f,0x61,0xfd,0x52,0xcf,0x00,0x00,0x02,0xff,0x21,0xfa,0x1d,0x03,0xf1,0x04,0x0c,
+0xff,0x11,0xfa,0x00,0xaf,0x20,0x00,0x9f,0xff,0x11,0xfe,0xbb,0xef,0xcb,0xb2,0x7f,
+0xdf,0x11,0xb9,0x07,0xe0,0x04,0xbf,0x11,0xfb,0x00,0x6f,0x70,0x00,0x00,0xbf,0x11,
+0xfa,0x00,0x4f,0x71,0x04,0x10,0x11,0xcd,0x02,0x01,0x08,0x00,0xf6,0x0c,0x0b,0x5d,
+0xf1,0xc4,0x00,0xbf,0x12,0xfc,0x7e,0xd8,0xfb,0xf7,0x00,0xbf,0x19,0xff,0xfa,0xf5,
+0xef,0xf2,0x00,0xbf,0x15,0xd7,0x30,0xa3,0x4c,0x59,0x08,0x50,0x03,0x72,0x00,0x29,
+0x60,0xca,0x01,0x12,0xf6,0xda,0x08,0x23,0x3f,0xe0,0xa9,0x03,0xa0,0x78,0xcc,0xcd,
+0xdc,0xcc,0xc0,0x05,0xff,0x2a,0xff,0x28,0x01,0x90,0x2e,0xff,0x20,0x00,0x0c,0xf3,
+0x00,0x00,0xaf,0x08,0x00,0x52,0xf2,0x00,0x00,0x3e,0xef,0x08,0x00,0x31,0x02,0xcf,
+0x22,0x09,0x04,0xa2,0x00,0xcf,0x21,0xdd,0xdf,0xfd,0xdd,0x80,0x00,0xcf,0x18,0x00,
+0x0e,0x08,0x00,0x01,0x8b,0x09,0x40,0xf4,0x00,0xcf,0x2d,0x69,0x03,0x71,0xd4,0x00,
+0x09,0xa2,0x00,0x0f,0xe0,0x60,0x01,0x02,0x08,0x00,0x22,0x7f,0xa0,0x08,0x00,0xa1,
+0xdf,0x4c,0xcc,0xcf,0xfc,0xcc,0xc3,0x06,0xff,0x1f,0x30,0x00,0x70,0x1e,0xff,0x10,
+0x02,0xff,0xff,0x20,0x61,0x05,0x40,0x08,0xff,0xff,0x80,0x61,0x04,0xd0,0x0f,0xbf,
+0xec,0xe0,0x00,0x02,0xbf,0x10,0x7f,0x4f,0xe4,0xf7,0x00,0xe0,0x00,0xf0,0x0d,0x0f,
+0xe0,0xdf,0x20,0x00,0xbf,0x1c,0xf5,0x0f,0xe0,0x5f,0xc0,0x00,0xbf,0xaf,0xcf,0xff,
+0xff,0xfc,0xf8,0x00,0xbf,0x3b,0x1b,0xbf,0xfb,0xb2,0xa0,0x3c,0x01,0x22,0x0f,0xe0,
+0x61,0x04,0x20,0x0e,0xd0,0xf1,0x00,0x13,0x40,0x51,0x07,0x12,0xfc,0x08,0x00,0x22,
+0x0b,0xf8,0x29,0x04,0xb0,0x3f,0xe2,0xcc,0xcc,0xcc,0xcf,0xf9,0x00,0xdf,0xb0,0x00,
 0x2e,0x03,0xf2,0x0e,0x0b,0xff,0xa0,0x99,0x99,0x91,0x1f,0xd0,0x3f,0xff,0xa0,0xff,
 0xff,0xf2,0x1f,0xd0,0x0b,0x8f,0xa0,0xfd,0x0a,0xf2,0x1f,0xd0,0x00,0x3f,0xa0,0xfc,
 0x09,0x08,0x00,0x22,0xfe,0x9d,0x08,0x00,0x22,0xff,0xff,0x08,0x00,0x31,0xfd,0x00,
-0x00,0x08,0x00,0x13,0x32,0x08,0x00,0x50,0x00,0x01,0xdd,0xef,0xb0,0x08,0x00,0x46,
-0x00,0xdf,0xfc,0x30,0xec,0x12,0x31,0x40,0x00,0x41,0x57,0x08,0x00,0x9f,0x08,0x01,
-0x4f,0x0a,0x00,0xa2,0x28,0x00,0x0e,0x1a,0x10,0x3f,0x17,0x24,0xe0,0x06,0xff,0x20,
-0xcf,0xef,0xfd,0xdd,0xd5,0x3f,0xff,0x28,0xfd,0x1f,0xd0,0x70,0x01,0xb0,0x4f,0xf3,
-0x1f,0xfa,0xaa,0xa0,0x2d,0xdf,0x23,0x50,0x1f,0x69,0x0a,0x40,0xcf,0x20,0x00,0x1f,
-0xc8,0x00,0x08,0x08,0x00,0x00,0xfa,0x09,0x00,0x08,0x00,0x39,0xfc,0xcc,0xc2,0x18,
-0x00,0x08,0x08,0x00,0x0d,0xe1,0x05,0x10,0xd4,0xa5,0x29,0x10,0x00,0x59,0x04,0x11,
-0x0e,0x1c,0x25,0x12,0xee,0x42,0x0a,0xa1,0xcf,0x7b,0xbb,0xbf,0xfb,0xbb,0xb2,0x07,
-0xff,0x20,0x18,0x00,0x40,0x3f,0xff,0x29,0xff,0xf6,0x1c,0xf2,0x03,0xcf,0xff,0x29,
-0xf9,0x8f,0xf8,0x8f,0xc0,0x6c,0xbf,0x29,0xf1,0x0e,0xf0,0x0f,0xc0,0x00,0xaf,0x18,
-0x00,0xd1,0x00,0xaf,0x25,0xb8,0x9f,0xe8,0x88,0x60,0x00,0xaf,0x24,0xfa,0x6f,0x2b,
-0x17,0x41,0x20,0x7f,0xff,0x40,0x08,0x00,0xf1,0x09,0x3e,0xff,0xb6,0x10,0x00,0x00,
-0xaf,0x6d,0xff,0x99,0xff,0xfe,0xc2,0x00,0xaf,0x2b,0xa3,0x00,0x05,0x9c,0xa0,0x00,
-0x2b,0x40,0xfb,0x19,0x30,0x07,0xf8,0xff,0xf6,0x06,0xf0,0x32,0x00,0xdf,0x3c,0xfe,
-0xcc,0x7f,0x5b,0xf0,0x2f,0xb0,0x3f,0x90,0x04,0xf6,0xbf,0x0b,0xfa,0x07,0xfb,0x76,
-0x5f,0x6b,0xf3,0xff,0xa0,0xbf,0xff,0xf5,0xf6,0xbf,0x6f,0xfa,0x1f,0xd4,0xde,0x4f,
-0x6b,0xf0,0xcf,0xa7,0xf7,0x0f,0xb4,0xf6,0xbf,0x01,0xfb,0xff,0x65,0xf8,0x4f,0x6b,
-0xf0,0x1f,0xa6,0x8f,0xff,0x34,0xf6,0xbf,0x01,0xfa,0x00,0x5f,0xe0,0x0f,0x00,0xf7,
-0x0e,0xa0,0x07,0xf7,0x01,0x31,0xbf,0x01,0xfa,0x04,0xfd,0x00,0x00,0x0c,0xf0,0x1f,
-0xa2,0xff,0x40,0x01,0xee,0xfe,0x01,0xfa,0x09,0x40,0x00,0x0b,0xdb,0x40,0xf1,0x00,
-0x40,0x0d,0xf0,0x0b,0xf2,0x4b,0x04,0x02,0x08,0x00,0x22,0x4f,0xc0,0x08,0x00,0xa1,
-0xcf,0x56,0xaf,0xfa,0xae,0xfb,0xa2,0x06,0xff,0x19,0x01,0x01,0xb1,0x2f,0xff,0x11,
-0x2e,0xf2,0x2c,0xf4,0x20,0xaf,0xff,0x10,0x20,0x00,0x22,0x4e,0xef,0x08,0x00,0xa3,
-0x03,0xcf,0x13,0x3e,0xf3,0x3c,0xf5,0x31,0x00,0xcf,0xd2,0x06,0xe0,0xcf,0x1a,0xaa,
-0xaa,0xaa,0xaa,0xa3,0x00,0xcf,0x10,0x09,0x81,0x04,0x91,0xc2,0x04,0xb0,0x9f,0xa0,
-0x07,0xfd,0x10,0x00,0xcf,0x2b,0xfc,0x00,0x00,0xf3,0x1d,0x55,0x18,0xa0,0x00,0x00,
-0x0a,0x69,0x03,0x11,0x08,0x99,0x2b,0xf2,0x19,0xae,0x00,0xde,0x9f,0xff,0xff,0x40,
-0x0a,0xe0,0x1f,0xa9,0xe5,0x57,0xf4,0xe8,0xae,0x05,0xf7,0x9e,0x4d,0x3f,0x4e,0x8a,
-0xe0,0xbf,0x79,0xe5,0xf3,0xf4,0xe8,0xae,0x2f,0xf7,0x9e,0x5f,0x3f,0x4e,0x8a,0xe7,
-0xff,0x0f,0x00,0x12,0x1c,0x0f,0x00,0x22,0xe0,0x2f,0x0f,0x00,0x40,0x01,0xf7,0x9e,
-0x6f,0x0f,0x00,0x41,0x1f,0x79,0xe7,0xe3,0x0f,0x00,0xf6,0x0d,0x7a,0xbb,0x2a,0x2b,
-0x6a,0xe0,0x1f,0x70,0x4f,0x8e,0x40,0x00,0xae,0x01,0xf7,0x5f,0xb0,0x9f,0x32,0x9e,
-0xd0,0x1f,0x79,0xa0,0x00,0xb4,0x1f,0xe6,0x53,0x0d,0x13,0x00,0xe0,0x0c,0xf1,0x22,
-0xd1,0x01,0x85,0xbf,0x15,0x00,0x00,0x3f,0xe6,0xbf,0xff,0xdf,0x6f,0x50,0x00,0x9f,
-0xef,0xff,0xe4,0xbf,0x1e,0xc0,0x00,0xef,0x48,0x5f,0xb0,0xbf,0x19,0xf1,0x06,0xfe,
-0x00,0x1f,0xb0,0xbf,0x12,0x20,0x1e,0xfe,0x7a,0xbf,0xea,0xef,0xba,0xa0,0x9f,0xfe,
-0xaf,0xba,0x0b,0xf0,0x2e,0x5e,0xee,0x00,0x1f,0xb0,0x8f,0x36,0x40,0x03,0xde,0x00,
-0x1f,0xd8,0x8f,0x8f,0xa0,0x00,0xde,0x5b,0xef,0xff,0x8f,0xff,0x30,0x00,0xde,0x7f,
-0xef,0xc1,0x2f,0xf8,0x00,0x00,0xde,0x01,0x1f,0xb0,0x6f,0xe0,0x91,0x00,0xde,0x00,
-0x1f,0xb7,0xff,0xf2,0xf6,0x00,0xde,0x1b,0xcf,0xbe,0xc6,0xff,0xf3,0x00,0xde,0x0d,
-0xfc,0x33,0x4d,0x0a,0x05,0x69,0x04,0x13,0x71,0x71,0x03,0x12,0xf6,0x02,0x10,0xb0,
-0x2f,0xe1,0xfe,0xaa,0xaa,0xef,0x20,0x00,0xaf,0x70,0xfc,0xa6,0x02,0x31,0x04,0xff,
-0x20,0x08,0x00,0x31,0x2e,0xff,0x20,0x20,0x00,0xa2,0xbf,0xff,0x20,0xaa,0xaf,0xfa,
-0xaa,0x10,0x4d,0xbf,0x89,0x02,0x42,0x01,0xaf,0x3f,0xff,0xf2,0x0b,0xa0,0x3c,0xcc,
-0xff,0xff,0xcc,0xb0,0x00,0xaf,0x20,0x07,0x41,0x11,0x00,0x71,0x02,0x20,0xce,0xfb,
-0xab,0x2b,0xf2,0x05,0x4b,0xfd,0x1e,0xf1,0xef,0x90,0x00,0xaf,0x6f,0xc1,0x0e,0xf0,
-0x2e,0xd1,0x00,0xaf,0x23,0x00,0x0e,0xf0,0x4d,0x18,0x04,0x9d,0x10,0x01,0xd2,0x06,
-0x00,0x8b,0x1b,0x10,0x80,0x79,0x03,0x40,0xc0,0x00,0x0c,0xe0,0xe9,0x0d,0x10,0x6e,
-0x6b,0x11,0x40,0xe0,0x02,0xff,0x29,0xec,0x0f,0x80,0x90,0x0d,0xff,0x10,0x78,0x88,
-0x88,0x87,0x71,0x04,0x10,0xcf,0xb5,0x1c,0xc1,0x4d,0xbf,0x10,0x33,0x33,0x33,0x33,
-0x00,0x01,0xaf,0x10,0xdf,0xae,0x26,0x40,0xaf,0x10,0x22,0x22,0x72,0x0e,0x22,0xaf,
-0x11,0x82,0x0e,0x60,0xaf,0x11,0xfc,0x88,0x88,0xdf,0x08,0x00,0x00,0x12,0x08,0x08,
-0x10,0x00,0x50,0xee,0xff,0xff,0xed,0x10,0x8e,0x1d,0x40,0x26,0x20,0x00,0x00,0xc5,
-0x00,0x20,0xaf,0x50,0x69,0x03,0x22,0x90,0x03,0x31,0x05,0xf0,0x2e,0x30,0x1e,0xfd,
-0x88,0xdf,0x60,0x04,0xff,0x00,0xbf,0xef,0x56,0xfc,0x00,0x0d,0xfe,0x2f,0x76,0x0c,
-0xff,0xd1,0x00,0x8f,0xfe,0x2f,0x64,0xaf,0xff,0xfa,0x51,0x5f,0xfe,0x2f,0xef,0xf9,
-0x35,0xcf,0xf5,0x04,0xde,0x2f,0x86,0x04,0xde,0x12,0x50,0x00,0xde,0x2f,0x64,0xef,
-0xb2,0x74,0x00,0x00,0xde,0x2f,0x60,0x73,0x5d,0xf5,0x08,0x00,0xf0,0x03,0x63,0xbf,
-0xfa,0x2a,0x91,0x00,0xde,0x2b,0x40,0x96,0x27,0xef,0x70,0x00,0xde,0x00,0x17,0xae,
-0x67,0x25,0x52,0xde,0x00,0x0b,0xd9,0x50,0x06,0x1e,0x20,0x05,0x60,0x02,0x0c,0x12,
-0xd0,0x6b,0x10,0x22,0x6f,0x7f,0xb8,0x02,0xf0,0x0c,0xce,0x1f,0xd9,0xdd,0x99,0xcf,
-0x93,0x04,0xfb,0x0f,0xa0,0xe9,0x00,0x8f,0x10,0x0d,0xfb,0x0f,0xa2,0xf5,0x00,0x8f,
-0x10,0x8f,0xfb,0x0f,0xa7,0x94,0x03,0xf1,0x07,0x5f,0xfb,0x0f,0xae,0xf5,0x88,0xcf,
-0x91,0x03,0xfb,0x1f,0xef,0xf4,0x90,0x8f,0x10,0x00,0xfb,0x2f,0x9c,0xf4,0xf7,0x08,
-0x00,0x30,0x75,0xf1,0xae,0x08,0x00,0xf7,0x0e,0x4f,0x65,0xf1,0x29,0x9f,0x10,0x00,
-0xfb,0x8f,0x35,0xf1,0x00,0x8f,0x10,0x00,0xfc,0xde,0x05,0xf1,0x0a,0xdf,0x00,0x00,
-0xfc,0x68,0x05,0xe1,0x0c,0xd7,0xcb,0x0f,0x40,0x30,0x00,0x06,0x70,0xf9,0x02,0x12,
-0xf7,0x80,0x00,0xa1,0x1f,0xf5,0xbb,0xbe,0xfc,0xbb,0xa0,0x00,0x8f,0x84,0xc8,0x01,
-0xf2,0x0a,0x04,0xff,0x20,0x2d,0x80,0x03,0xf9,0x00,0x2e,0xff,0x10,0x0e,0xe0,0x09,
-0xf4,0x00,0x8f,0xff,0x19,0x9d,0xda,0x9f,0xfa,0x94,0x1c,0x60,0x03,0x10,0xf7,0xb1,
-0x05,0x02,0xc8,0x11,0xa0,0x10,0x7a,0xaa,0xaa,0xaa,0x10,0x00,0xbf,0x10,0xaf,0x38,
-0x02,0x00,0x08,0x00,0x39,0x10,0x00,0xbf,0x08,0x00,0x42,0xbb,0xbb,0xef,0x20,0x20,
-0x00,0x53,0xfe,0x20,0x00,0x04,0x10,0xd8,0x14,0xf0,0x52,0x77,0x77,0x74,0x00,0xaf,
-0x00,0x7f,0x8f,0xff,0xff,0xad,0xaa,0xf0,0x0d,0xf1,0x3f,0xb3,0x51,0xda,0xaf,0x04,
-0xfb,0x08,0xf3,0x9f,0x1d,0xaa,0xf0,0xdf,0xa3,0xff,0xbe,0xf9,0xda,0xaf,0x7f,0xfa,
-0x4f,0xfc,0x9b,0xfe,0xaa,0xf4,0xff,0xa0,0x33,0x93,0x22,0xda,0xaf,0x06,0xfa,0x01,
-0x6f,0x71,0x1d,0xaa,0xf0,0x1f,0xa6,0xff,0xff,0xf9,0xda,0xaf,0x01,0xfa,0x27,0xaf,
-0xa7,0x4d,0xaa,0xf0,0x1f,0xa0,0x05,0xf7,0x34,0x64,0xaf,0x01,0xfa,0x8b,0xdf,0xff,
-0xc0,0x0b,0xf0,0x1f,0xa9,0xc9,0x63,0x10,0x9c,0xfe,0x01,0xfa,0x27,0x0c,0x26,0xcb,
-0x40,0xa3,0x0d,0x11,0x92,0x3a,0x07,0x00,0x3f,0x08,0x20,0x0b,0xf3,0x61,0x02,0x12,
-0xda,0xbb,0x10,0xf0,0x03,0x9f,0x65,0x99,0x9f,0xe9,0x99,0x90,0x03,0xff,0x10,0x55,
-0x6f,0xb5,0x55,0x10,0x0d,0xff,0x00,0x18,0x00,0xb2,0x30,0x7f,0xff,0x00,0xfc,0x11,
-0x11,0x9f,0x30,0x1e,0xef,0x10,0x00,0xa2,0x01,0xcf,0x00,0xfc,0x33,0x33,0xaf,0x30,
-0x00,0xcf,0x10,0x00,0x17,0x00,0x10,0x00,0x21,0xee,0xee,0x10,0x00,0xf1,0x00,0xfd,
-0x55,0x55,0xbf,0x30,0x00,0xcf,0x39,0xfe,0x99,0x99,0xdf,0xb4,0x00,0xcf,0x98,0x1a,
-0x10,0xf6,0x52,0x06,0x30,0x16,0x30,0x00,0xb9,0x14,0x20,0x02,0xfc,0x77,0x00,0x11,
-0xea,0xb2,0x11,0xf0,0x1a,0x09,0xf7,0xaf,0xa9,0x99,0x9c,0xfb,0x03,0xff,0x1a,0xf1,
-0x00,0x00,0x6f,0xb0,0xdf,0xf1,0xaf,0xee,0xee,0xef,0xfb,0x9f,0xff,0x1b,0xfc,0xcc,
-0xcc,0xcc,0x85,0xfd,0xf1,0xbf,0x87,0x77,0x77,0x77,0x04,0xbf,0x1c,0xef,0x8d,0x01,
-0xf0,0x04,0x0b,0xf1,0xdc,0xf6,0xd5,0xd5,0x8e,0x00,0xbf,0x1f,0xaf,0xbe,0xae,0xac,
-0xe0,0x0b,0xf3,0xf8,0xff,0x41,0x29,0xf1,0x07,0xbf,0x8f,0x3f,0x6d,0x5d,0x58,0xe0,
-0x0b,0xfc,0xe0,0xf6,0xd5,0xda,0xce,0x00,0xbf,0x58,0x0f,0x6d,0x5d,0x9c,0x60,0x6b,
-0x13,0x00,0x97,0x0d,0x50,0x60,0x00,0x19,0x90,0x00,0xcb,0x0e,0x83,0x88,0x8f,0xf8,
-0x88,0x80,0x00,0x2f,0xbe,0xf0,0x00,0x10,0x50,0xec,0x0f,0x22,0x00,0x02,0xe8,0x00,
-0x21,0x00,0x0c,0xe8,0x00,0x33,0xdf,0x00,0x7f,0x10,0x00,0x30,0x1e,0xef,0x02,0x94,
-0x10,0x43,0x20,0x01,0xcf,0x3f,0x72,0x06,0x90,0x3f,0x83,0x33,0x33,0x39,0xf3,0x00,
-0xcf,0x2c,0x61,0x03,0xb1,0xc2,0x00,0xcf,0x00,0x58,0x8f,0xf8,0x84,0x00,0x00,0xcf,
-0x34,0x03,0x00,0x08,0x00,0x22,0x0a,0xbf,0x08,0x00,0x11,0x0b,0x2a,0x0b,0xf1,0x0b,
-0x09,0x70,0x64,0x0f,0xf0,0x37,0x20,0x00,0x2f,0xd3,0xfe,0x1f,0xf0,0xdf,0x60,0x00,
-0x7f,0x81,0xaf,0x5f,0xf4,0xda,0x20,0x00,0xdf,0x3f,0x9b,0x10,0xf0,0x04,0x05,0xff,
-0x1f,0xea,0xaa,0xaa,0xae,0xf2,0x0d,0xff,0x0f,0xc0,0x00,0x00,0x0c,0xf2,0x8f,0xff,
-0x07,0xe4,0x00,0x50,0x71,0x5f,0xff,0x00,0x9b,0x3b,0x12,0x23,0x07,0xef,0xac,0x12,
-0x22,0xef,0x5f,0x69,0x02,0xd0,0xef,0x3a,0xad,0xfe,0xaa,0xea,0xa4,0x00,0xef,0x00,
-0x2f,0xf3,0x08,0x53,0x0e,0x40,0x04,0xef,0x84,0x57,0xd1,0x29,0x12,0x0c,0xd0,0x00,
-0xf0,0x24,0xef,0x05,0x86,0x43,0x10,0x08,0xa2,0x00,0x1d,0x50,0x00,0x05,0xf6,0x03,
-0x61,0x00,0x7f,0x59,0x20,0x05,0xf6,0x0a,0xf2,0x00,0xcf,0x4f,0xe0,0xff,0xff,0xef,
-0xb0,0x01,0xfb,0x06,0xf6,0x9b,0xfc,0xdf,0x40,0x08,0xf8,0x00,0x50,0x05,0xf8,0xfc,
-0x00,0x1f,0xf8,0x99,0x98,0x58,0x00,0xf0,0x05,0x8f,0xf8,0xff,0xf6,0xbc,0xff,0xcb,
-0xb5,0x2c,0xf8,0x2b,0xf0,0x2c,0xfa,0x00,0x00,0x02,0xf8,0x0a,0xf5,0x74,0x18,0xf0,
-0x00,0x01,0xf8,0x0a,0xf6,0xff,0xd8,0x8e,0xe0,0x01,0xf8,0x0a,0xf0,0x2f,0xc6,0x6d,
-0x08,0x00,0xf1,0x03,0xf7,0x3f,0xff,0xff,0xe0,0x01,0xf8,0x0d,0xff,0x7f,0x90,0x0c,
-0xe0,0x01,0xf8,0x2f,0xe5,0x0f,0x10,0x00,0xc1,0x05,0x00,0x0f,0xd8,0x8d,0xd0,0x00,
-0x02,0x40,0x03,0x61,0x00,0xc4,0x16,0x40,0x1e,0xf8,0x67,0x10,0x32,0x08,0x20,0xbf,
-0xff,0xcb,0x0f,0xa1,0xaf,0x9c,0xfc,0x33,0xef,0x43,0x20,0x04,0xff,0xbf,0xf1,0x01,
-0xb1,0x1e,0xff,0x16,0xf9,0x19,0xf2,0x2f,0xa0,0x8f,0xff,0x01,0x10,0x00,0xf9,0x2f,
-0x1d,0xdf,0x00,0x6c,0xff,0x66,0x68,0x40,0x00,0xcf,0x28,0xdf,0xcf,0x70,0x7f,0x90,
-0x00,0xcf,0x19,0x96,0xbf,0xfe,0xfd,0x20,0x00,0xcf,0x15,0xbf,0xb7,0xfc,0xce,0x00,
-0x00,0xcf,0x19,0xb5,0x9f,0xfb,0x4f,0x80,0x00,0xcf,0x14,0xaf,0xf6,0xec,0x0c,0xf7,
-0x00,0xcf,0x3e,0xf9,0x7a,0xfa,0x01,0xc3,0x00,0xcf,0x02,0x10,0x6f,0xc2,0x2c,0x08,
-0x13,0x15,0xe5,0x02,0x22,0x4f,0xe1,0x08,0x00,0x24,0x0c,0xe5,0xca,0x17,0x00,0xa4,
-0x2e,0xd0,0xcc,0xef,0xfd,0xcc,0xdd,0xcc,0xc0,0x00,0x01,0xdf,0x90,0x03,0xdb,0x0a,
-0x1d,0xa0,0xf9,0x00,0x00,0xaf,0xd1,0x00,0x01,0xff,0xfe,0xef,0x37,0x1d,0xf0,0x05,
-0x00,0xdf,0xff,0xfd,0xdf,0xfa,0xdf,0xa0,0x00,0x44,0x4f,0xf0,0x2f,0xe0,0x2a,0x10,
-0x00,0x00,0x5f,0xc0,0x7a,0x16,0x00,0x52,0x30,0xf6,0x0d,0x2f,0xe0,0x04,0xc4,0x00,
-0x1c,0xfe,0x10,0x2f,0xe0,0x06,0xf7,0x1b,0xff,0xe3,0x00,0x1f,0xfd,0xcf,0xf3,0x0a,
-0xfb,0x20,0x00,0x08,0xef,0xff,0x90,0x03,0x12,0x03,0xf3,0x16,0x10,0x6c,0x08,0x00,
-0x70,0x97,0x10,0x00,0xaf,0x90,0x0f,0xf0,0xf7,0x29,0xe0,0x1e,0xf4,0x0f,0xf0,0x0d,
-0xf6,0x00,0x00,0x05,0xf9,0x0f,0xf0,0x8f,0xa0,0xda,0x09,0x70,0x0f,0xf0,0x05,0x00,
-0x00,0x1d,0xdd,0x89,0x0a,0x33,0xdd,0xd0,0x1f,0xa0,0x00,0x00,0xea,0x07,0x22,0x0f,
-0xe0,0x3c,0x1b,0x02,0x08,0x00,0x20,0xbf,0x60,0x08,0x00,0x00,0xcb,0x26,0xf0,0x05,
-0x0f,0xe0,0x01,0x00,0x00,0x3e,0xf8,0x00,0x0f,0xf0,0x06,0xe3,0x2a,0xff,0xa0,0x00,
-0x0f,0xfd,0xdf,0xf3,0xed,0x30,0x1b,0x06,0x80,0x00,0x17,0xe0,0x77,0x1a,0x13,0x0e,
-0x58,0x00,0x20,0x09,0xaa,0xa0,0x06,0x25,0xaa,0xa0,0x8f,0x1a,0x01,0x7f,0x02,0x00,
-0x78,0x2f,0x40,0xd9,0x99,0x99,0x9d,0x08,0x00,0x21,0x90,0x00,0x93,0x1a,0x63,0x3f,
-0xeb,0xbb,0xbb,0xbe,0xf6,0x20,0x00,0x01,0xce,0x1e,0x33,0xd0,0x3f,0xb0,0xf3,0x09,
-0xf0,0x07,0xb0,0x04,0x71,0x00,0x1a,0xff,0x20,0x3f,0xb0,0x07,0xf5,0x3c,0xff,0xf5,
-0x00,0x2f,0xfc,0xcf,0xf2,0x0c,0xfa,0x20,0x65,0x12,0x26,0x80,0x01,0x3a,0x07,0x13,
-0x00,0x7a,0x14,0x13,0x90,0x87,0x01,0x13,0xf9,0xa4,0x10,0x02,0x0c,0x17,0x01,0xf5,
-0x2f,0x02,0x08,0x00,0x13,0xfa,0x33,0x05,0x02,0x9d,0x1a,0x10,0x01,0xce,0x33,0x00,
-0x82,0x05,0x32,0xfd,0x0d,0xf7,0x35,0x17,0x01,0xe9,0x29,0x00,0x4d,0x32,0x20,0xbf,
-0xc0,0xca,0x12,0x80,0x30,0x00,0x2f,0xfa,0x00,0x01,0xaf,0xf6,0x48,0x0f,0x41,0xc1,
-0x2e,0xff,0x80,0xe6,0x12,0x21,0x07,0xe5,0x5c,0x00,0x18,0xe0,0xfd,0x1a,0x03,0x00,
-0x02,0x23,0x3f,0xf5,0xa2,0x17,0x03,0xfd,0x1a,0x31,0xf7,0x6f,0xf6,0x12,0x13,0x60,
-0x70,0x05,0xff,0xa2,0x00,0x07,0xa2,0x17,0xd1,0x3d,0xff,0x91,0x4f,0xff,0xdb,0xbb,
-0xbb,0xbc,0xff,0xf7,0x06,0x4c,0xdf,0x03,0x01,0xd7,0x20,0x04,0xb3,0x18,0x13,0xf1,
-0x42,0x13,0x01,0x9f,0x23,0x74,0x05,0x99,0x9f,0xfa,0x99,0x80,0x00,0x20,0x00,0x20,
-0x07,0xbb,0x79,0x0a,0x23,0xbb,0xa0,0x0b,0x17,0x07,0xd3,0x17,0x50,0x9f,0x80,0x08,
-0xf8,0x00,0x0b,0x0d,0x10,0x40,0xf2,0x2e,0x00,0xe3,0x12,0x41,0x00,0x9f,0xd0,0x00,
-0xec,0x19,0x10,0x0e,0x03,0x28,0x80,0x90,0x39,0x20,0x04,0xff,0x90,0x1e,0xfc,0xd9,
-0x00,0x71,0x7f,0xf3,0x04,0xc1,0x04,0xff,0x40,0x01,0x1a,0x13,0x0d,0x0f,0x01,0x42,
-0x7f,0xe1,0x02,0xcc,0x40,0x00,0x00,0x3d,0x2f,0xc0,0x00,0x1d,0xf7,0x00,0x01,0x7f,
-0xf3,0x00,0x01,0xdf,0xfd,0xef,0xab,0x16,0x00,0x26,0x2e,0x70,0xdc,0xb9,0xef,0x60,
-0x00,0x55,0x32,0x2c,0x00,0x13,0x80,0xa7,0x0b,0x02,0x99,0x24,0x11,0x04,0x63,0x13,
-0x00,0x9e,0x0c,0x00,0x9b,0x0c,0x12,0x40,0x86,0x14,0x20,0x5e,0x50,0x90,0x00,0x12,
-0x0b,0xa8,0x00,0x22,0xb0,0x09,0x7d,0x1d,0x1d,0xa0,0x62,0x0b,0x11,0xad,0x94,0x1d,
-0x03,0x13,0x17,0x1f,0xf8,0xf3,0x16,0x06,0x13,0x2f,0xe3,0x16,0x12,0x2d,0x48,0x00,
-0x11,0xd1,0xf5,0x00,0x10,0x02,0x78,0x00,0x10,0xf7,0x2b,0x03,0x02,0x5e,0x24,0x00,
-0xc3,0x12,0x61,0x11,0x9f,0x51,0x16,0xfd,0x11,0xee,0x2e,0x01,0x20,0x06,0x82,0xbc,
-0xcc,0xcf,0xfd,0xcc,0xcc,0x20,0x00,0x19,0x33,0x01,0x60,0x01,0x17,0xf4,0x98,0x03,
-0x71,0x0d,0xdd,0xdd,0xef,0xff,0xdd,0xdd,0x04,0x0c,0x02,0x6b,0x16,0x40,0x0a,0xff,
-0x9f,0xe4,0xa8,0x06,0xf0,0x02,0xdf,0xf7,0x07,0xff,0x91,0x00,0x17,0xdf,0xfe,0x50,
-0x00,0x8f,0xff,0xb3,0x1d,0xff,0x81,0x14,0x00,0x31,0xd0,0x02,0x50,0xdc,0x01,0x40,
-0x30,0x00,0x07,0xf6,0x1a,0x32,0x14,0x00,0x08,0x00,0x13,0x0a,0xe8,0x00,0xb3,0x08,
-0xce,0xfe,0xcc,0xcc,0xef,0xec,0x90,0x00,0x07,0xf7,0x20,0x00,0x02,0xc2,0x1a,0x70,
-0x00,0x07,0xfb,0x88,0x88,0xcf,0x60,0x9b,0x15,0x03,0x08,0x00,0x04,0x18,0x00,0x02,
-0x28,0x00,0x12,0x1c,0x38,0x00,0x24,0xc1,0x2f,0x3b,0x16,0xf0,0x01,0x01,0x8e,0x60,
-0x05,0xc6,0x10,0x00,0x05,0xaf,0xfe,0x70,0x08,0xef,0xfa,0x30,0x1d,0x69,0x17,0x53,
-0x05,0xdf,0x90,0x01,0x20,0x78,0x01,0x13,0x0d,0x48,0x03,0x50,0x0d,0xf8,0x77,0x77,
-0x7c,0x08,0x00,0x40,0xf9,0x88,0x88,0x8d,0x08,0x00,0x00,0xd3,0x16,0x00,0x08,0x00,
-0x57,0xf4,0x33,0x33,0x3b,0xf6,0x28,0x00,0x48,0xf3,0x11,0x11,0x1a,0x10,0x00,0x70,
-0xf6,0x55,0x55,0x5b,0xf6,0x00,0x0b,0xf1,0x17,0x34,0xbe,0xfd,0xb5,0x25,0x1f,0xf0,
-0x04,0x00,0x04,0xcf,0x50,0x02,0xee,0x81,0x00,0x05,0xcf,0xfb,0x20,0x00,0x6e,0xff,
-0x81,0x0b,0xfb,0x40,0xf0,0x01,0x34,0xe3,0x00,0x20,0xbb,0x1a,0x31,0x0c,0xf0,0x7f,
-0x04,0x01,0x02,0x08,0x00,0x73,0x01,0xbb,0xbf,0xfb,0xdf,0xcb,0xb8,0x6b,0x18,0xf6,
-0x02,0xfc,0x00,0x01,0xfc,0x0c,0xf0,0x8f,0x52,0xfc,0x00,0x01,0xfb,0x0c,0xf0,0x7f,
-0x52,0xfc,0x18,0x00,0x56,0xff,0xcf,0xfc,0xef,0xdd,0x18,0x00,0x13,0x02,0x28,0x00,
-0x13,0xaf,0x5b,0x17,0xc0,0x8b,0xbb,0xdd,0xbb,0xbc,0xfc,0xbb,0xb2,0x00,0x06,0xff,
-0x50,0xdf,0x16,0xb0,0x17,0xdf,0xf9,0x00,0x02,0xbf,0xfb,0x20,0x3e,0xfa,0x30,0xd0,
-0x1a,0x24,0x60,0x02,0xf8,0x00,0x50,0x01,0x71,0x00,0x00,0x07,0xcf,0x1c,0x00,0xb1,
-0x24,0xa6,0xc0,0x00,0x07,0x78,0xff,0x97,0x78,0xff,0x87,0x70,0x63,0x18,0x83,0x1b,
-0xf3,0x7f,0x71,0x11,0x10,0x00,0xaf,0xd3,0x1a,0xf3,0x02,0x57,0x7d,0xf8,0xaf,0xb8,
-0xfb,0x00,0x2a,0xaa,0xae,0xfb,0xcf,0xcb,0xfe,0xa2,0x3f,0xff,0x99,0x22,0x00,0x28,
-0x00,0x20,0x73,0xfb,0xa8,0x2e,0x02,0x83,0x19,0x60,0x47,0xff,0xf7,0x9f,0xfe,0x74,
-0x6b,0x20,0xf0,0x04,0xf2,0x6f,0xcf,0xe6,0x00,0x2e,0xfd,0x3a,0xf2,0x6f,0x63,0xdf,
-0xf2,0x07,0x60,0x0a,0xf2,0x6f,0x60,0x96,0x1a,0x01,0x37,0x08,0x0a,0x07,0x00,0x11,
-0xae,0x1a,0x1d,0x15,0xe2,0x65,0x1e,0x91,0x04,0xfa,0x00,0x0b,0xf2,0xcf,0x20,0x07,
-0xf9,0x07,0x00,0x30,0x0c,0xff,0x60,0x07,0x00,0xf1,0x0b,0x6f,0xde,0xf7,0x0b,0xf2,
-0xcf,0x25,0xff,0x32,0xef,0x6b,0xf2,0xcf,0xaf,0xf5,0x00,0x3f,0xec,0xf2,0xcf,0x3b,
-0x30,0x00,0x04,0x2b,0xf2,0x82,0x1f,0x11,0x0c,0x07,0x00,0x50,0x2e,0xef,0xf0,0xcf,
-0x20,0xbd,0x01,0xe0,0x70,0x00,0x6b,0xbb,0xb6,0x2b,0xbb,0xbb,0x10,0x00,0x8f,0xff,
-0xf8,0x3f,0x3a,0x0b,0xa9,0x8f,0x55,0xf8,0x3f,0x90,0xcf,0x10,0x00,0x8f,0x44,0x08,
-0x00,0x93,0x01,0x9f,0x55,0xf9,0x5f,0xa1,0xcf,0x31,0x2f,0x4e,0x21,0xf6,0x27,0x2b,
-0xef,0xcc,0xfe,0xdf,0xdb,0xff,0xc7,0x00,0xbf,0x14,0xf8,0x6f,0x60,0xcf,0x10,0x00,
-0xdf,0x04,0xf8,0x8f,0x40,0xcf,0x10,0x01,0xfc,0x04,0xf8,0xbf,0x20,0xcf,0x10,0x06,
-0xf8,0x04,0xfa,0xfe,0x00,0xcf,0x10,0x1e,0xf2,0xac,0xff,0xf9,0x5b,0xff,0x10,0x09,
-0x90,0xaf,0xc4,0xd1,0x2f,0x71,0x03,0x21,0xef,0xff,0xbd,0x1b,0x30,0xef,0xbc,0xcb,
-0x7d,0x1d,0x30,0xef,0x09,0xf5,0x57,0x15,0x71,0x89,0x0c,0xfa,0x99,0x99,0x97,0x98,
-0x2e,0x03,0x11,0xfc,0x0d,0x0c,0x01,0x74,0x1c,0x52,0xd9,0x99,0x99,0x99,0x50,0x2d,
-0x19,0x13,0x60,0x46,0x1d,0x80,0x6b,0xbb,0xbb,0xbb,0xb2,0xbf,0x30,0x9f,0x5c,0x01,
-0x12,0xdf,0x22,0x01,0x01,0x28,0x20,0x31,0x7b,0xbe,0xf8,0x05,0x05,0x06,0xf5,0x1d,
-0x00,0xc2,0x02,0x00,0x57,0x15,0x22,0x1d,0xe1,0x08,0x00,0x22,0x0b,0xfb,0x08,0x00,
-0xb2,0x01,0xef,0x51,0x22,0x2e,0xf2,0x22,0x20,0x00,0x6f,0x8b,0x52,0x08,0xe6,0x06,
-0x0b,0xfa,0x9f,0xfa,0x9e,0xf1,0x00,0x00,0x0b,0xf1,0x0d,0xf0,0x0d,0x08,0x00,0xa2,
-0x03,0x0b,0xf2,0x1d,0xf2,0x1d,0xf1,0x00,0x1e,0xbb,0x28,0x00,0xf0,0x00,0x8f,0x8b,
-0xfa,0xaf,0xfa,0xaf,0xf1,0x02,0xfe,0x06,0x90,0x0d,0xf0,0x06,0x70,0xb8,0x1d,0x01,
-0xb7,0x15,0x12,0xd0,0x08,0x00,0x21,0x02,0x30,0x08,0x00,0x00,0x01,0x00,0x10,0x12,
-0xc6,0x02,0xd0,0x18,0x30,0x00,0xaf,0x46,0xf8,0x00,0x00,0x5f,0xd0,0x02,0xfe,0x01,
-0xa0,0x11,0xa2,0xf6,0x08,0xfe,0xaa,0xef,0xba,0xa0,0x05,0xfe,0x2f,0x0a,0x07,0x51,
-0x94,0xbf,0xf1,0x00,0xfd,0x82,0x05,0x82,0xfa,0x9a,0xff,0x99,0x60,0x00,0x0a,0xec,
-0xdd,0x1b,0x22,0x44,0x2a,0x18,0x00,0xa1,0xbf,0x5a,0xfa,0x99,0xfe,0x99,0x60,0x01,
-0xff,0x0a,0x18,0x00,0x40,0x07,0xfa,0x0a,0xf2,0x18,0x00,0xb1,0x0e,0xf4,0x0a,0xf3,
-0x11,0xfd,0x11,0x10,0x5f,0xe0,0x0a,0xd2,0x02,0x82,0x18,0x70,0x0a,0xfa,0x99,0x99,
-0x99,0x92,0x21,0x01,0x40,0x5b,0x00,0x1a,0x40,0x39,0x06,0x40,0x7f,0xb0,0x1f,0xb0,
-0x08,0x00,0x51,0x28,0x90,0x0b,0xf2,0x9f,0x8b,0x03,0xf0,0x41,0x05,0xf7,0x9f,0xa9,
-0x99,0xcf,0xb9,0x94,0x01,0xf9,0x9f,0x47,0x77,0x7f,0x43,0x61,0x00,0x20,0x9f,0x7e,
-0xee,0x7f,0x5a,0xf1,0x00,0x00,0xaf,0x23,0x33,0x4f,0x7f,0xb0,0x00,0x93,0xbf,0x7f,
-0xff,0x7f,0xdf,0x50,0x02,0xf9,0xcd,0x7f,0x3f,0x5f,0xfd,0x00,0x07,0xf4,0xdc,0x7e,
-0x0e,0x5d,0xf5,0x00,0x0d,0xf1,0xfa,0x7f,0xff,0x6e,0xf2,0x93,0x3f,0xa4,0xf7,0x7f,
-0x89,0xef,0xf9,0xe7,0x4d,0x4b,0xf2,0x13,0x4e,0xf6,0xef,0xf3,0xa1,0x13,0x36,0x1b,
-0x30,0x4d,0x6a,0x05,0x01,0x83,0x03,0x01,0x08,0x00,0x33,0xdd,0xdd,0xff,0xcc,0x20,
-0x1f,0xef,0x08,0x00,0x08,0x10,0x02,0x09,0x14,0x03,0xfc,0x11,0x00,0x08,0x00,0x01,
-0x41,0x18,0x00,0xaa,0x02,0x61,0xf5,0x00,0x00,0xef,0x01,0x92,0x54,0x38,0x40,0xef,
-0x02,0xfa,0x01,0xd8,0x1d,0x40,0xef,0x13,0xf8,0x1c,0x0a,0x23,0x50,0xcf,0xee,0xf5,
-0x0b,0xe2,0xf5,0x05,0x45,0xff,0xb0,0x00,0x10,0x92,0x07,0x16,0xfe,0x07,0x00,0x7b,
-0x0f,0xf0,0x03,0xfe,0x00,0x3f,0xd0,0x07,0x00,0x62,0xf1,0x03,0xfe,0x00,0x4f,0xd0,
-0xbc,0x03,0x30,0xd0,0x0c,0xcc,0x25,0x15,0x91,0xa0,0xce,0x40,0x03,0xfe,0x00,0x09,
-0xe7,0xdf,0x07,0x00,0x1b,0xf8,0x07,0x00,0x81,0xdb,0xbc,0xff,0xbb,0xbe,0xf8,0xdf,
-0xff,0x2d,0x06,0x01,0xa2,0x0a,0x10,0x2a,0x60,0x02,0x01,0xa8,0x20,0x05,0x08,0x00,
-0x40,0x11,0x11,0x1e,0xf3,0x2e,0x20,0x04,0xfe,0x1c,0x11,0xcc,0x2e,0x1e,0x14,0x10,
-0x20,0x00,0x21,0x2c,0xcc,0x13,0x06,0x14,0xc2,0x6b,0x05,0xd0,0x01,0x33,0x11,0x1e,
-0xf2,0x11,0x43,0x10,0x00,0xdf,0x30,0x0e,0xf1,0xef,0x16,0x0d,0x08,0x00,0x52,0xa9,
-0x9f,0xfa,0x9a,0xfd,0x2b,0x04,0x00,0xdc,0x0e,0x00,0xea,0x0e,0x29,0x35,0xfd,0x5f,
-0x01,0x11,0xf8,0x74,0x1d,0xf2,0x3b,0xff,0xe4,0x00,0x34,0x00,0x00,0x6d,0xf9,0x10,
-0x54,0xdf,0x16,0x00,0xef,0x21,0x82,0xfc,0xdf,0x7f,0xa0,0xee,0x0a,0xf7,0xfc,0xdf,
-0x1a,0xf5,0xef,0x8f,0x91,0xfc,0xdf,0x10,0x77,0xff,0xfc,0x01,0xfc,0xdf,0x14,0xdf,
-0xff,0xef,0x41,0xfc,0xdf,0xaf,0xf5,0xee,0x3f,0xf5,0xfc,0xdf,0x7c,0x31,0xfe,0x04,
-0xf7,0xfc,0xdf,0x10,0x8f,0xfc,0x00,0x21,0xfc,0xdf,0x10,0x29,0x71,0x00,0x01,0xfc,
-0xdf,0x36,0x05,0x10,0xab,0xc6,0x1d,0x53,0xbc,0xfc,0x00,0x00,0x14,0x91,0x13,0x33,
-0x9f,0xc0,0x09,0xe4,0x07,0x23,0x01,0xff,0x04,0x05,0x21,0x7f,0xd0,0x6d,0x32,0x00,
-0xff,0x2c,0x30,0x05,0xff,0x70,0x47,0x03,0x21,0xa0,0x2f,0xc2,0x27,0x41,0xff,0xf3,
-0x05,0xae,0xd3,0x05,0x11,0x40,0xa0,0x16,0x01,0x1e,0x0a,0x22,0x0a,0xf6,0x08,0x00,
-0x22,0x2f,0xf1,0x8e,0x09,0x21,0xbf,0xa0,0x27,0x03,0xf5,0x06,0x3c,0xfe,0x10,0x00,
-0x6f,0xb0,0x00,0x0a,0xff,0xe2,0x01,0xed,0xff,0x70,0x00,0x04,0xf9,0x10,0x00,0xcf,
-0xfa,0x2b,0x20,0x00,0xb5,0x11,0x10,0x12,0x31,0x25,0x41,0x00,0xcf,0x10,0x6f,0x72,
-0x03,0xf0,0x10,0xcf,0x10,0x4a,0xbf,0xfa,0xaf,0xf1,0x00,0xcf,0x68,0x80,0x2f,0xc0,
-0x0d,0xf0,0x6c,0xff,0xff,0xe0,0x2f,0xb0,0x0e,0xf0,0x7f,0xff,0x63,0x00,0x3f,0xa0,
-0x0e,0xf0,0xa7,0x16,0x31,0x5f,0x90,0x0f,0x08,0x00,0xf0,0x09,0x8f,0x50,0x0f,0xe0,
-0x00,0xcf,0x15,0x80,0xcf,0x20,0x1f,0xd0,0x00,0xdf,0xff,0xe3,0xfe,0x00,0x2f,0xd0,
-0x06,0xff,0xd7,0x0b,0x47,0x3b,0x20,0x01,0xd5,0x40,0x34,0x20,0x8f,0x90,0x74,0x07,
-0x20,0x40,0xde,0xf0,0x19,0x5b,0x04,0xe4,0x00,0x9f,0xe9,0xfa,0x07,0x31,0x0d,0xf1,
-0x2f,0x11,0x07,0xa0,0x0d,0xf1,0x2c,0xdf,0xfc,0xcc,0xc3,0xfb,0x0d,0xf1,0x12,0x3d,
-0x10,0x01,0x08,0x00,0x70,0x9f,0xb6,0x67,0x31,0xfb,0x0d,0xf1,0xbc,0x04,0xf0,0x09,
-0xb1,0xfb,0x0d,0xf1,0x06,0xfc,0x55,0x9f,0x71,0xfb,0x0d,0xf1,0x1e,0xf4,0x00,0xaf,
-0x41,0xfb,0x0d,0xf1,0x3f,0xb9,0xa1,0xff,0x28,0x00,0x41,0x03,0x2e,0xfe,0xf8,0x30,
-0x00,0x31,0x01,0xdf,0xf1,0x08,0x00,0x00,0x2d,0x33,0x61,0x32,0x0d,0xf1,0x00,0x2d,
-0xfa,0x60,0x00,0x10,0x09,0xcb,0x2a,0x50,0x0c,0xdf,0xf0,0x05,0xe5,0x23,0x01,0x2d,
-0xfd,0x50,0xc0,0x2c,0x21,0x09,0xf3,0x8c,0x20,0xf1,0x29,0x03,0xff,0xa0,0x00,0x86,
-0x1f,0xc0,0x01,0xef,0xbf,0xa0,0x1f,0xb1,0xfc,0x02,0xef,0x70,0xbf,0x91,0xfb,0x1f,
-0xc3,0xef,0x90,0x01,0xdf,0x7f,0xb1,0xfc,0x3f,0xfb,0xaa,0xac,0xb2,0xfb,0x1f,0xc0,
-0x2d,0xff,0xff,0xf4,0x1f,0xb1,0xfc,0x00,0xdf,0x00,0x9f,0x31,0xfb,0x1f,0xc0,0x0d,
-0xf0,0x0c,0xf1,0x0f,0x00,0x30,0x4e,0xfe,0x01,0x0f,0x00,0x50,0xf1,0xa9,0x44,0x04,
-0x31,0x1e,0x00,0xf2,0x04,0x03,0xf7,0x00,0x1f,0xc0,0x0b,0xfb,0x99,0xdf,0x47,0x9a,
-0xfb,0x00,0x4d,0xff,0xff,0xa0,0x7f,0xff,0x79,0x00,0x41,0x32,0x00,0x00,0x07,0x79,
-0x01,0x00,0xb3,0x1c,0x00,0x04,0x0e,0x30,0x00,0x0b,0xd1,0x22,0x03,0xd0,0xe1,0xff,
-0xff,0xf6,0x67,0xfe,0x66,0xfe,0x0b,0xbb,0xef,0x50,0x1f,0xac,0x0b,0xf0,0x1a,0x2f,
-0xc0,0x02,0xfb,0x00,0xfd,0x00,0x0d,0xf5,0x91,0x3f,0xa0,0x0f,0xd0,0x0a,0xff,0xbe,
-0x36,0xf8,0x00,0xfc,0x0b,0xff,0xff,0x50,0x9f,0x50,0x1f,0xc4,0xfe,0xff,0xee,0x1d,
-0xf2,0x02,0xfb,0x0a,0x2f,0xe4,0xb3,0xfd,0x56,0x17,0xf4,0x0d,0xfe,0x00,0xbf,0x70,
-0x04,0xf9,0x00,0x1f,0xe0,0x7f,0xf0,0x00,0x8f,0x70,0x01,0xfe,0x2f,0xf5,0x1e,0xef,
-0xf3,0x00,0x1f,0xe0,0x57,0x00,0xbe,0xd6,0x7c,0x13,0xfe,0x08,0xf1,0x04,0xff,0xfa,
-0xaf,0xff,0x40,0x08,0xf1,0x04,0xfb,0xfa,0xaf,0xbf,0x4b,0xa8,0xf1,0x04,0xf4,0xda,
-0xad,0x4f,0x4b,0x08,0x00,0x81,0x1a,0xf9,0xed,0xde,0x9f,0x8b,0xa8,0xf1,0x42,0x03,
-0xf1,0x02,0xdb,0xa8,0xf1,0x07,0xf7,0xeb,0xce,0x7f,0x6b,0xa8,0xf1,0x05,0xf3,0xda,
-0xbc,0x4f,0x4b,0x08,0x00,0x10,0xcb,0x08,0x00,0xf3,0x10,0x06,0xf2,0xda,0xda,0x4f,
-0x44,0x48,0xf1,0x09,0xf0,0xdb,0xf8,0x4f,0x40,0x08,0xf1,0x0d,0xd9,0xfe,0xfa,0xbf,
-0x33,0x7c,0xf0,0x1d,0x6d,0xe8,0xe5,0xfb,0x03,0xff,0xa3,0x04,0x17,0x21,0x0e,0x11,
-0x20,0x7d,0xb0,0x5a,0x0e,0x10,0x8c,0xb9,0x09,0x20,0x0e,0xf0,0x08,0x0c,0xb0,0x4d,
-0x70,0xef,0x04,0x31,0xfd,0x00,0x05,0xf8,0x0e,0xf0,0xb3,0x02,0x30,0x5f,0x80,0xef,
-0xaa,0x08,0xf0,0x00,0xb5,0xf8,0x0e,0xf0,0xbb,0xdf,0xfb,0xb8,0x5f,0x80,0xef,0x00,
-0x0c,0xff,0x30,0x1e,0x00,0x01,0x9c,0x38,0xf2,0x0d,0x80,0xef,0x01,0xee,0xfe,0xef,
-0x55,0xf8,0x0e,0xf0,0xcf,0x6f,0xd2,0xe2,0x5f,0x80,0xef,0x3f,0xb0,0xfd,0x01,0x00,
-0x10,0x0e,0xf0,0xa1,0x0f,0xd0,0x5e,0x1e,0x10,0xfd,0xe5,0x1f,0x10,0xd0,0xef,0x11,
-0x30,0x04,0xfe,0xb3,0xa9,0x05,0x00,0xdd,0x1a,0xf0,0x07,0xaf,0xaa,0xaf,0xf0,0x2d,
-0x81,0xfc,0x0a,0xf0,0x00,0xdf,0x03,0xfa,0x1f,0xc0,0xaf,0x10,0x0e,0xf0,0x3f,0xa1,
-0xfc,0x1e,0x00,0x00,0x0f,0x00,0xf0,0x00,0x7b,0xbb,0xbb,0xa0,0x3f,0xa1,0xfc,0x00,
-0x0b,0xf1,0x00,0x03,0xfa,0x1f,0xc1,0xb4,0x05,0xf0,0x00,0x3f,0xa1,0xfc,0x19,0x9f,
-0xf9,0xdf,0x53,0xfa,0x1f,0xc0,0x02,0xfb,0x09,0xf4,0x1e,0x00,0xf2,0x0c,0x8f,0x70,
-0xaf,0x30,0x21,0x1f,0xc0,0x2e,0xf1,0x0d,0xf2,0x00,0x01,0xfc,0x3e,0xf7,0x8c,0xff,
-0x00,0x2c,0xdf,0xb2,0xe7,0x06,0xfe,0x60,0x00,0xb0,0x2e,0x04,0xb1,0x2e,0x00,0x6c,
-0x12,0x20,0xff,0xff,0x20,0x1f,0xf0,0x23,0xfd,0x0a,0xaf,0xfa,0xbb,0xa4,0xfb,0x0f,
-0xd0,0x05,0xfa,0x1e,0xa0,0x0f,0xb0,0xfd,0x00,0xdf,0x20,0xcf,0x40,0xfb,0x0f,0xd0,
-0x7f,0xfc,0xce,0xfc,0x0f,0xb0,0xfd,0x04,0xff,0xdb,0xac,0xe2,0xfb,0x0f,0xd0,0x01,
-0x08,0xb1,0x10,0x0f,0xb0,0xfd,0x02,0x44,0xcf,0x64,0x1e,0x00,0x00,0x36,0x06,0xf1,
-0x08,0x0f,0xb0,0xfd,0x03,0x55,0xcf,0x65,0x50,0xfb,0x0f,0xd0,0x00,0x0a,0xf1,0x03,
-0x19,0x70,0xfd,0x02,0x46,0xdf,0xef,0xf3,0x5a,0x00,0x70,0xeb,0x85,0x12,0xcd,0xfc,
-0x07,0x74,0x09,0x41,0x15,0xfc,0x77,0x11,0x10,0x83,0x32,0x2d,0x60,0x09,0xd1,0x03,
-0xfb,0x8f,0x40,0x48,0x07,0x90,0x06,0xfa,0xaf,0x73,0x30,0x8f,0x3b,0xf1,0x0c,0x5a,
-0x03,0xf0,0x01,0x8f,0x3b,0xf1,0x2f,0xd7,0xcf,0xa7,0x71,0x8f,0x3b,0xf1,0x1c,0xa5,
-0xaf,0x85,0x54,0x10,0x00,0x00,0x7e,0x04,0xf0,0x05,0x8f,0x3b,0xf1,0x06,0x66,0xbf,
-0x86,0x64,0x8f,0x3b,0xf1,0x03,0x66,0xbf,0x96,0x62,0x8f,0x3b,0xf1,0x08,0xfd,0x00,
-0x00,0x08,0x00,0xe0,0xf5,0xaf,0x77,0xf6,0x7f,0x3b,0xf1,0x08,0xf2,0x8f,0x44,0xf6,
-0x00,0x0b,0x08,0x00,0x40,0x79,0xf5,0x00,0x0c,0x08,0x00,0xbc,0x8f,0xf2,0x0b,0xdf,
-0xf0,0x00,0x10,0x8f,0x42,0x00,0x08,0x74,0x23,0x31,0x0e,0xd0,0x9f,0xf8,0x00,0xf0,
-0x01,0xed,0x09,0xfb,0xaa,0xad,0xf5,0xaf,0x0e,0xd0,0x9f,0x32,0x22,0x8f,0x5a,0xf0,
-0xed,0xeb,0x0c,0x01,0x0f,0x00,0xf0,0x19,0x65,0x9b,0x55,0x1a,0xf0,0xed,0x09,0xf0,
-0x09,0xf0,0x00,0xaf,0x0e,0xd0,0xaf,0xdf,0xff,0xff,0x6a,0xf0,0xed,0x0b,0xfd,0xee,
-0xfc,0xf6,0xaf,0x0e,0xd0,0xce,0xd8,0x9f,0x1f,0x6a,0xf0,0xed,0x0d,0xcd,0x89,0xf1,
-0x0f,0x00,0xf6,0x0d,0xf9,0xd8,0x9f,0x1f,0x62,0x40,0xed,0x3f,0x6d,0x89,0xf9,0xf5,
-0x00,0x0f,0xd9,0xf1,0xb7,0x9f,0x7a,0x00,0xde,0xfb,0x16,0x00,0x09,0xf0,0x00,0x0b,
-0x49,0x18,0xf0,0x1e,0x17,0x10,0x05,0xe7,0x00,0x01,0xfc,0x05,0xef,0xa8,0xfc,0x12,
-0xe8,0x1f,0xc0,0x01,0xaf,0xff,0x20,0x3f,0x91,0xfc,0x02,0xaf,0xfd,0xfe,0x53,0xf9,
-0x1f,0xc2,0xff,0xb5,0x36,0xf9,0x3f,0x91,0xfc,0x04,0x30,0xcf,0x01,0x03,0xf9,0x1f,
-0xc1,0x27,0x06,0xf6,0x28,0x3f,0x91,0xfc,0x1d,0xdd,0xff,0xdd,0xd3,0xf9,0x1f,0xc0,
-0x05,0x1c,0xf3,0x70,0x3f,0x91,0xfc,0x01,0xf9,0xcf,0x8f,0x43,0xf9,0x1f,0xc0,0xaf,
-0x3c,0xf1,0xed,0x00,0x01,0xfc,0x5f,0xb0,0xcf,0x08,0xf4,0x00,0x1f,0xc0,0x92,0x9f,
-0xf0,0x14,0x00,0xbc,0xfb,0x00,0x0c,0xe8,0x00,0x00,0x0c,0xfd,0xe0,0x12,0x00,0x92,
-0x22,0x00,0x26,0x0b,0x41,0xf8,0x00,0x00,0x6f,0x01,0x28,0x45,0x10,0x01,0xef,0x50,
-0x42,0x22,0x21,0x2a,0xaa,0x01,0x00,0x20,0xa2,0x02,0xfc,0x11,0x30,0x00,0x7f,0x50,
-0x7a,0x2d,0x81,0x0a,0xf1,0x7f,0x60,0x05,0xfa,0x66,0xef,0x08,0x00,0x22,0xfc,0x99,
-0x10,0x00,0x22,0xfe,0xcc,0x08,0x00,0x22,0xf8,0x22,0x18,0x00,0x04,0x28,0x00,0xf5,
-0x07,0xf8,0x33,0xef,0x05,0x70,0x7f,0x60,0x05,0xf6,0x48,0xfe,0x00,0x7b,0xef,0x40,
-0x05,0xf6,0x3f,0xf7,0x00,0x4f,0xfa,0x7e,0x00,0x11,0x1f,0xa9,0x09,0xf0,0x04,0x0c,
-0xf0,0x09,0x99,0x99,0x99,0x97,0x6b,0x1c,0xf0,0x01,0x77,0x77,0x77,0x70,0x8f,0x1c,
-0xf0,0x03,0xb8,0x05,0x00,0x08,0x00,0x47,0xf7,0x00,0x0b,0xf1,0x10,0x00,0x04,0x20,
-0x00,0xd0,0x08,0xaa,0xaa,0xaa,0xa7,0x8f,0x1c,0xf0,0x0c,0xfc,0xef,0xdd,0xfa,0x08,
-0x00,0x31,0xf2,0x8f,0x64,0x08,0x00,0x00,0x45,0x0b,0xf1,0x03,0x36,0x0c,0xf0,0x0c,
-0xf3,0x8f,0x65,0xfa,0x00,0x0d,0xf0,0x0c,0xf7,0xbf,0x99,0xfa,0x2e,0xef,0x18,0x00,
-0x28,0xe9,0x0e,0x2b,0x05,0x01,0x33,0x16,0x00,0x52,0x24,0x31,0x20,0x0b,0xf3,0xaf,
-0x0d,0x14,0xd0,0x08,0x00,0x00,0x29,0x1c,0x40,0x01,0x2f,0xd1,0x1e,0xc7,0x12,0x00,
-0xf4,0x04,0x40,0xcf,0xfc,0xce,0xf3,0x62,0x22,0x00,0x31,0x18,0x00,0x08,0x00,0x40,
-0x0f,0xe0,0x0c,0xf1,0x08,0x00,0x20,0x2f,0xc0,0x08,0x00,0xf0,0x0e,0xe8,0xc0,0x7f,
-0x80,0x0d,0xf0,0x29,0xdf,0xff,0xf3,0xdf,0x30,0x0e,0xf0,0x2f,0xfd,0x95,0x18,0xfd,
-0x00,0x0f,0xe0,0x06,0x20,0x00,0x6f,0xf3,0x00,0x4f,0x97,0x26,0x40,0xff,0x70,0xcd,
-0xff,0xe5,0x1c,0x46,0xe5,0x00,0x9f,0xfb,0x7d,0x10,0x22,0x3f,0xb0,0x6c,0x08,0x13,
-0xfa,0x0f,0x00,0x10,0xa0,0x7b,0x00,0x71,0xe2,0xcd,0xff,0xdd,0xd3,0xff,0xff,0xd9,
-0x09,0xf0,0x08,0x3f,0xc0,0x1f,0xe0,0x05,0xf9,0x0d,0xf3,0xfc,0x01,0xfe,0x00,0x7f,
-0x70,0xef,0x2f,0xc0,0x1f,0xe0,0x08,0xf6,0x0e,0xf2,0x0f,0x00,0x30,0xaf,0x40,0xfe,
-0x0f,0x00,0x40,0x0c,0xf1,0x0f,0xd2,0x0f,0x00,0x30,0xff,0x02,0xfc,0x0f,0x00,0xf7,
-0x10,0x4f,0xa0,0x4f,0xa2,0xfc,0x01,0xfe,0x0b,0xf5,0x08,0xf8,0x2f,0xfe,0xef,0xe4,
-0xfe,0x7f,0xff,0x42,0xff,0xff,0xfe,0x2d,0x52,0xfe,0x90,0x2f,0xb0,0x1d,0xc0,0x10,
-0xb5,0x04,0x11,0xfc,0x74,0x08,0x31,0x10,0x01,0xfc,0xb6,0x0f,0x30,0xfa,0x01,0xfc,
-0xb6,0x0f,0x32,0x99,0x95,0x01,0x3c,0x1b,0x00,0x37,0x08,0x10,0xf3,0x06,0x19,0x30,
-0x9b,0xfe,0xae,0x03,0x39,0xf0,0x16,0xfe,0x04,0xf9,0x0a,0xf2,0x00,0x5f,0xa0,0x00,
-0x05,0xf8,0x0b,0xf2,0x00,0x8f,0x44,0xd2,0x07,0xf6,0x0b,0xf1,0x00,0xde,0x02,0xf8,
-0x0a,0xf3,0x0c,0xf1,0x03,0xfa,0x37,0xfe,0x1f,0xf0,0x0d,0xf0,0x37,0x0f,0xf1,0x03,
-0xaf,0xb0,0x0f,0xe0,0x0c,0xfc,0x73,0x28,0xff,0x40,0x2f,0xc0,0x03,0x10,0x00,0x09,
-0xfc,0x7d,0x3a,0x33,0x38,0x02,0xd2,0x3f,0x4a,0x27,0x22,0x89,0x30,0x6e,0x0b,0x01,
-0xbd,0x0e,0x00,0x70,0x0f,0x00,0x60,0x02,0x01,0xa4,0x3a,0x00,0x08,0x16,0xf0,0x03,
-0x04,0xff,0x51,0x11,0x11,0x11,0xcf,0x20,0x4f,0xff,0x99,0x99,0x98,0x00,0xdf,0x10,
-0x09,0xaf,0xc2,0x08,0x10,0xdf,0xee,0x1b,0x20,0x01,0xfd,0xd6,0x09,0x61,0x0f,0xe1,
-0x12,0xfd,0x00,0xff,0x10,0x0f,0xb2,0xfd,0x25,0xfd,0x00,0x00,0x0f,0xf9,0x99,0x98,
-0xdf,0xf9,0xcd,0x11,0x32,0x69,0x73,0x30,0x32,0x09,0xc0,0x09,0xf5,0x00,0x0b,0xfe,
-0xcc,0xcc,0xcc,0xdf,0xf2,0x00,0x02,0x54,0x08,0x00,0xf8,0x01,0x13,0x64,0x69,0x01,
-0x12,0xf3,0xa5,0x07,0x01,0x64,0x2c,0x22,0xc0,0x08,0xe7,0x02,0x11,0x08,0xfa,0x10,
-0xf0,0x21,0x0f,0xe6,0xff,0xa0,0x10,0x8e,0x23,0x20,0xfe,0x0e,0xff,0xae,0x5e,0xc1,
-0xfa,0x0f,0xe0,0x2a,0xf4,0xdf,0xf5,0x1f,0xa0,0xfd,0x00,0x9f,0x15,0xff,0xb2,0xfa,
-0x1f,0xd0,0x09,0xf4,0xfe,0xaf,0xaf,0xa2,0xfc,0x00,0x9f,0x5d,0x30,0x72,0xfa,0x3f,
-0xb0,0x09,0x23,0x20,0x21,0xa5,0xfa,0x57,0x0c,0x12,0xfa,0x61,0x10,0x32,0x0c,0xcf,
-0xf4,0x5d,0x29,0x07,0x14,0x08,0x04,0xfb,0x00,0x20,0xdf,0x40,0x4f,0x34,0x00,0x15,
-0x3b,0x11,0xff,0x82,0x22,0x60,0xf7,0x00,0xff,0x10,0x1d,0x40,0xc3,0x41,0xd0,0xff,
-0x10,0xbf,0xd0,0x03,0xff,0xe0,0x00,0xff,0x18,0xff,0x30,0x2e,0x08,0x00,0x70,0x8f,
-0xf5,0x00,0x2f,0xef,0xe0,0x00,0xf8,0x2f,0x61,0x07,0x4f,0xe0,0x00,0xff,0xf6,0x8d,
-0x12,0x11,0x4d,0xbc,0x0c,0x60,0x1f,0xfa,0xff,0xff,0x10,0x01,0xda,0x28,0x90,0xf8,
-0xff,0x10,0x09,0xb2,0x00,0x1f,0xe0,0x10,0x14,0x1f,0x00,0x6c,0x06,0x00,0x4d,0x28,
-0x00,0x08,0x00,0x40,0xcf,0xfe,0xef,0xd0,0x08,0x00,0x52,0x4d,0xff,0xfd,0x30,0xcf,
-0x99,0x09,0xf0,0x02,0x0c,0xfd,0xde,0xfd,0xdf,0xfd,0xdd,0xa0,0xcf,0x10,0xaf,0x30,
-0xcf,0x10,0x00,0x0c,0xf1,0xbc,0x01,0x00,0x28,0x09,0x21,0xbf,0x20,0x0f,0x00,0x00,
-0xf6,0x07,0x00,0xc6,0x20,0xf2,0x0f,0xfd,0x00,0xcf,0x10,0x87,0x0c,0xf1,0x7f,0x90,
-0x0c,0xf1,0x0b,0xe0,0xcf,0x6f,0xf2,0x00,0xbf,0xcb,0xfc,0x0c,0xf6,0xf7,0x00,0x04,
-0xef,0xfe,0x40,0xcf,0x14,0x26,0x14,0x13,0xf1,0x64,0x09,0x02,0x3b,0x01,0x31,0x1a,
-0xcc,0xcc,0x4a,0x01,0x02,0x0f,0x00,0x31,0xfb,0x0c,0xfd,0x0f,0x00,0x30,0x90,0xcf,
-0x10,0xc5,0x05,0xf1,0x07,0x00,0x0c,0xf1,0x5e,0x40,0x00,0x8f,0xc0,0x00,0xcf,0x15,
-0xff,0x70,0x4f,0xe1,0x00,0x0c,0xf1,0x03,0xef,0xbe,0xf4,0x27,0x20,0x21,0xdf,0xf9,
-0x4b,0x00,0x40,0x3e,0xff,0xe2,0x00,0xa7,0x09,0xf1,0x07,0xf9,0xaf,0xf3,0x00,0x0c,
-0xf3,0xbf,0xf7,0x00,0xaf,0xf3,0x00,0xcf,0x3e,0xe4,0x00,0x00,0xae,0x20,0x0c,0xf1,
-0x21,0x3f,0x01,0x12,0xcf,0x42,0x11,0x14,0x1b,0x69,0x10,0x06,0x01,0x00,0xc0,0x6e,
-0x50,0xaf,0x40,0x00,0x00,0x02,0x7e,0xff,0xe0,0xaf,0x40,0x88,0x3e,0x90,0xe7,0x00,
-0xaf,0x40,0x00,0x0a,0xfe,0xef,0x40,0x08,0x00,0x31,0x02,0x30,0x9f,0x08,0x00,0x24,
-0x00,0x00,0x08,0x00,0x20,0xaf,0x50,0x03,0x00,0x03,0x39,0x10,0xb0,0xf8,0x0c,0xcc,
-0xef,0xdc,0xcc,0xef,0xdc,0xc6,0x00,0x00,0xd6,0x19,0x12,0x40,0x4f,0x0c,0x00,0x08,
-0x00,0x22,0x0a,0xf9,0x08,0x00,0x21,0x8f,0xe2,0x08,0x00,0x31,0x0c,0xff,0x40,0x08,
-0x00,0x32,0x05,0xc2,0x00,0x18,0x00,0x05,0xab,0x05,0xd0,0x00,0x0f,0xf0,0x01,0x83,
-0x00,0x00,0xaf,0x70,0x0f,0xf0,0x07,0xfc,0xa0,0x24,0x40,0x0f,0xf0,0x0e,0xf4,0x0a,
-0x1b,0xe2,0x0f,0xf0,0x6f,0xb0,0x00,0x00,0x04,0x60,0x0f,0xf0,0x16,0x20,0x00,0x02,
-0xce,0x0b,0x27,0x50,0x03,0x1c,0x2c,0x17,0xf1,0x1c,0x2c,0x20,0x2e,0xee,0xa9,0x1a,
-0x25,0xee,0xe3,0x0c,0x2d,0x00,0x87,0x2c,0x0f,0x3e,0x2e,0x08,0x00,0x41,0x17,0x22,
-0x8e,0x20,0x08,0x00,0x1a,0x9f,0x08,0x00,0x81,0xaa,0xdf,0xba,0xa3,0x00,0x4c,0xff,
-0xc7,0x30,0x10,0xf0,0x2e,0x5f,0xff,0xf8,0x33,0xbf,0x5b,0xf3,0x00,0x00,0xcf,0x02,
-0x72,0xcf,0x09,0xf9,0x40,0x00,0xcf,0x08,0xf3,0xef,0x0a,0xff,0xb0,0x00,0xcf,0x0d,
-0xe2,0xfb,0x0a,0xfd,0xf0,0x00,0xcf,0x6f,0x86,0xf7,0x0b,0xf9,0xf3,0x00,0xcf,0x2b,
-0x1d,0xf2,0x0c,0xf5,0xf6,0x00,0xcf,0x00,0x6f,0xa0,0x0d,0xf0,0x20,0x00,0xcf,0x04,
-0xff,0x20,0x4e,0x03,0x41,0xcf,0x3f,0xf5,0x3c,0xc4,0x21,0x57,0x1a,0x60,0x0e,0xfd,
-0x20,0x77,0x01,0x51,0x53,0x00,0x00,0x25,0x10,0x2a,0x06,0x31,0x00,0xaf,0xb0,0xc9,
-0x13,0x00,0x0b,0x00,0x01,0x1c,0x2a,0x00,0x9f,0x41,0xe3,0xcf,0xa9,0x9f,0xf9,0x99,
-0xff,0x00,0x00,0xcf,0x42,0x3f,0xf2,0x23,0xff,0x29,0x02,0x00,0x08,0x00,0x56,0x43,
-0x4f,0xf3,0x34,0xff,0x20,0x00,0x04,0x30,0x00,0x13,0x00,0xe3,0x0b,0x03,0x00,0x01,
-0x12,0x2b,0x31,0x14,0x1e,0xb2,0x00,0x01,0x00,0x84,0x04,0x0a,0x08,0x00,0x42,0xec,
-0xcc,0xc9,0x00,0xae,0x3e,0x1d,0xfc,0x20,0x00,0x83,0x1e,0xee,0xee,0xff,0xfe,0xee,
-0xee,0xe6,0xf0,0x01,0x11,0xf6,0xe6,0x26,0x03,0x6a,0x15,0x22,0xca,0x61,0x08,0x00,
-0x22,0xef,0xff,0x94,0x32,0x42,0xb1,0x7d,0xff,0x70,0x20,0x00,0x28,0x5a,0x00,0x28,
-0x00,0x01,0x08,0x00,0x11,0x33,0x01,0x00,0x22,0x10,0x04,0x48,0x00,0x90,0x50,0x03,
-0xbb,0xbb,0xff,0xcb,0xbb,0xef,0x50,0x72,0x01,0x3f,0x40,0x00,0xaf,0x08,0x00,0x0a,
-0x41,0x44,0xdc,0xff,0x30,0x10,0x00,0x32,0xff,0xe9,0x00,0x18,0x00,0x1d,0x00,0x08,
-0x00,0x0d,0xa8,0x00,0x13,0xdf,0xe1,0x16,0x05,0x08,0x00,0x03,0x1d,0x08,0x0c,0x08,
-0x00,0x13,0xef,0x94,0x01,0x14,0xff,0x08,0x00,0x13,0x10,0xdf,0x0d,0x03,0xcd,0x0e,
-0x03,0xf1,0x0d,0x23,0x07,0xfa,0x97,0x0c,0x13,0xf6,0x1d,0x01,0x13,0xe0,0x3e,0x0b,
-0x1b,0x70,0xa4,0x2b,0x03,0x80,0x00,0x21,0x01,0xff,0x6f,0x03,0xb2,0xd5,0x01,0xfb,
-0x00,0x00,0x56,0x10,0x00,0x00,0x01,0xfb,0x7b,0x31,0x06,0x08,0x00,0x10,0x7b,0x01,
-0x01,0x41,0x70,0x02,0xfa,0x9f,0x23,0x22,0x00,0xc2,0x06,0x50,0xdf,0x31,0x20,0x00,
-0x03,0x0f,0x25,0x21,0x2d,0xe2,0x12,0x4a,0x60,0xcf,0x25,0xfe,0x10,0x07,0xf5,0x30,
-0x00,0x42,0x7d,0x20,0x0b,0xf1,0x38,0x00,0x22,0x1f,0xe9,0xe0,0x01,0x21,0x2e,0x87,
-0x60,0x00,0x15,0xd2,0x5e,0x0a,0x04,0xa7,0x2f,0x80,0xff,0xbb,0xbb,0xdd,0xbb,0xbb,
-0xb3,0x00,0xce,0x0f,0x00,0x9c,0x00,0x22,0xfd,0x1f,0x0e,0x0f,0x51,0xfd,0x1f,0xe7,
-0x77,0x77,0x08,0x00,0x72,0xd5,0x55,0x55,0xef,0x10,0x01,0xfc,0x18,0x00,0xa2,0x02,
-0xfb,0x1f,0xd2,0x22,0x22,0xef,0x10,0x03,0xfa,0x10,0x00,0xf1,0x17,0x06,0xf7,0x05,
-0x74,0x6f,0xc4,0x64,0x00,0x09,0xf4,0x0b,0xf7,0x2f,0xa9,0xf6,0x00,0x0e,0xf1,0x9f,
-0xc0,0x2f,0xa1,0xdf,0x70,0x4f,0xa4,0xfc,0x3a,0xbf,0xa0,0x2f,0xf2,0x03,0x30,0x21,
-0x0e,0xfd,0x30,0x2c,0x1e,0x12,0x73,0x79,0x00,0x41,0x1b,0xfd,0x17,0xe5,0xfc,0x2e,
-0x10,0x91,0x3c,0x34,0x02,0x81,0x13,0xf5,0x03,0xfc,0x10,0x00,0x4c,0xbc,0xfe,0x87,
-0x66,0xbc,0x20,0x29,0x99,0x9d,0xfd,0x99,0x99,0xaa,0x92,0x81,0x13,0xf0,0x16,0x07,
-0xff,0x31,0x62,0xef,0x60,0x00,0x00,0x9f,0xfb,0xbf,0xf8,0x2e,0xf8,0x00,0x3e,0xfe,
-0xaf,0xd8,0x37,0x53,0xef,0xe4,0x0b,0xa1,0x04,0x6a,0xff,0xa1,0x09,0xc0,0x00,0x01,
-0xef,0xfe,0x92,0x4e,0x36,0x12,0x30,0x56,0x22,0x7c,0xab,0x05,0x51,0x28,0x9c,0xff,
-0xfe,0x82,0x5a,0x18,0x27,0xc8,0x40,0x0f,0x35,0x04,0x16,0x06,0x22,0x08,0xff,0x70,
-0x00,0x70,0x07,0xef,0xed,0xdd,0xdd,0xdd,0xfe,0x6e,0x02,0x40,0x07,0x00,0x08,0xf9,
-0x94,0x29,0xc0,0x9f,0xc0,0x0e,0xf3,0x00,0x00,0x07,0xf9,0x0b,0xf8,0x7f,0xc0,0x21,
-0x01,0x40,0x30,0x71,0xef,0x40,0x08,0x18,0x10,0xe1,0xb9,0x42,0x00,0x46,0x0f,0x22,
-0xaf,0xd1,0x0a,0x02,0x02,0xcc,0x3b,0x21,0x05,0xef,0xd5,0x2b,0xf2,0x0a,0x04,0xcf,
-0xfc,0xbf,0xfe,0x61,0x00,0x29,0xef,0xfe,0x50,0x05,0xef,0xff,0xc3,0x1e,0xfd,0x71,
-0x00,0x00,0x05,0xaf,0xc0,0x04,0x30,0x71,0x00,0x13,0x09,0x06,0x03,0x62,0x09,0xef,
-0xff,0xee,0xef,0xf3,0x3f,0x11,0x00,0x2d,0x07,0x00,0x8c,0x27,0x00,0xb9,0x19,0x00,
-0x72,0x17,0x10,0x6f,0x4a,0x3a,0xb1,0x03,0xff,0xe0,0x8d,0xdd,0xff,0x40,0x00,0x06,
-0xff,0xf6,0x95,0x2a,0x60,0x09,0xfb,0xfe,0x20,0x09,0xf9,0x30,0x12,0x40,0x9f,0xd0,
-0x3f,0xf2,0x6f,0x47,0x20,0x1e,0xfb,0x08,0x01,0x30,0xdf,0x90,0x02,0x88,0x14,0x11,
-0x0a,0xc3,0x23,0xf2,0x04,0x92,0x00,0x5f,0xf6,0x29,0xff,0xf8,0xaf,0xff,0xd3,0x0b,
-0x80,0x0d,0xfa,0x20,0x03,0xaf,0xc0,0x01,0xf1,0x00,0x10,0x10,0x62,0x09,0x30,0x22,
-0x22,0x22,0xb1,0x07,0x10,0xf7,0x36,0x11,0x80,0x0a,0xaa,0xae,0xf4,0xfe,0xaa,0xbf,
-0xb0,0xc9,0x0e,0xf0,0x0c,0xee,0x00,0x5f,0x90,0x08,0xc0,0x0f,0xe0,0xbf,0x10,0x9f,
-0x50,0x0c,0xfa,0x4f,0xb0,0x7f,0x50,0xdf,0x20,0x01,0xef,0xdf,0x70,0x4f,0xa2,0xfd,
-0x59,0x19,0x40,0x20,0x0e,0xf9,0xf8,0x79,0x16,0x40,0x20,0x08,0xff,0xf2,0x95,0x26,
-0x40,0xc0,0x03,0xff,0x90,0xd3,0x22,0xf0,0x10,0xf6,0x08,0xff,0x90,0x00,0x02,0xef,
-0x56,0xf4,0x7f,0xff,0xf7,0x00,0x2e,0xfb,0x00,0x5c,0xff,0x65,0xff,0xa0,0x3f,0xc0,
-0x00,0x2f,0xe5,0x00,0x6f,0xd1,0x04,0x00,0x2c,0x1e,0x24,0x03,0x20,0xae,0x1e,0x71,
-0x01,0x23,0x56,0x78,0xbd,0xff,0x70,0x4f,0x03,0x91,0xfd,0x96,0x00,0x0d,0xf9,0x75,
-0x43,0x10,0x00,0xf5,0x05,0x02,0x08,0x08,0x02,0xe8,0x24,0xb0,0xdf,0xef,0xfd,0xdd,
-0xdf,0xf9,0x00,0x0e,0xf0,0xdf,0x10,0x61,0x03,0xd0,0xfe,0x06,0xf9,0x00,0x5f,0xd0,
-0x00,0x1f,0xd0,0x0e,0xf4,0x2e,0xf4,0x4a,0x29,0x31,0x3f,0xed,0xf9,0xa6,0x35,0x20,
-0x9f,0xfe,0xd4,0x25,0xf4,0x08,0x02,0xaf,0xff,0xfc,0x40,0x03,0xff,0x5c,0xff,0xf7,
-0x4d,0xff,0xe8,0x3e,0x81,0xee,0x81,0x00,0x06,0xcf,0x50,0x11,0x02,0xef,0x07,0x20,
-0x07,0x40,0xdd,0x02,0x60,0x0d,0xe2,0x1f,0xf1,0x1e,0xd1,0xd8,0x13,0x40,0x4f,0xe0,
-0x08,0xfb,0x28,0x06,0x63,0x7f,0xb0,0x00,0x94,0x00,0x04,0x19,0x18,0x40,0x01,0xec,
-0xcc,0xff,0x39,0x07,0x42,0x00,0x00,0x06,0xfe,0x37,0x00,0x11,0x0c,0xb5,0x14,0x00,
-0xc5,0x35,0x40,0xcc,0xcf,0xfa,0x00,0x50,0x02,0x10,0x20,0x70,0x01,0xb0,0x1c,0xfc,
-0x7f,0xd2,0xef,0x90,0x00,0x02,0xcf,0xe1,0x09,0x70,0x01,0x40,0x4f,0xfd,0x20,0x29,
-0xad,0x39,0xf0,0x05,0x0c,0xa1,0x7b,0xff,0xe9,0xef,0xfd,0x93,0x00,0x00,0xbf,0xd7,
-0x00,0x08,0xdf,0xf1,0x00,0x00,0x23,0x00,0x3d,0x14,0x12,0x3f,0x3d,0x13,0xf0,0x12,
-0x00,0x2c,0xfd,0xae,0xfb,0xdf,0xff,0xff,0xe0,0x05,0xf7,0x0b,0xf1,0xcf,0xed,0xdf,
-0xf0,0x05,0xfc,0x9e,0xf1,0x2f,0x80,0x0f,0xc0,0x05,0xff,0xff,0xf1,0x0e,0xb0,0x3f,
-0x90,0x18,0x00,0x40,0x0b,0xe0,0x6f,0x60,0x08,0x00,0x40,0x07,0xf4,0xbf,0x10,0x18,
-0x00,0xf0,0x1d,0x02,0xfa,0xfb,0x00,0x05,0xfc,0x8e,0xf1,0x00,0xcf,0xf5,0x00,0x05,
-0xf7,0x0b,0xf6,0x20,0x6f,0xf0,0x00,0x2a,0xfe,0xef,0xff,0x60,0xcf,0xf4,0x00,0x3f,
-0xfd,0xae,0xf4,0x1a,0xfc,0xff,0x30,0x02,0x00,0x0b,0xf3,0xdf,0xb0,0x6f,0xf5,0x0b,
-0x4b,0x38,0xa9,0x00,0x04,0x21,0x19,0x23,0x17,0x70,0x38,0x0d,0x15,0xf2,0x5a,0x01,
-0xf0,0x01,0xff,0xe0,0x09,0xaa,0xaf,0xfa,0xaf,0xfa,0xaa,0x90,0x00,0x3d,0x6d,0xf0,
-0x1f,0xd8,0x24,0x28,0xf0,0x01,0x3d,0xf0,0x1f,0xd9,0xfc,0x00,0x0a,0xf8,0x0d,0xf0,
-0x1f,0xd0,0x8f,0xa0,0x01,0x70,0x08,0x00,0x93,0x07,0x10,0x00,0x99,0x9a,0xa9,0x9a,
-0xa9,0x80,0x10,0x04,0x10,0xf4,0xb8,0x35,0x40,0x20,0x02,0xcf,0x80,0x87,0x05,0x31,
-0xe6,0x5e,0xf9,0xca,0x04,0x01,0x1d,0x3c,0xf1,0x02,0x16,0xad,0xff,0xfe,0xef,0xfe,
-0xa8,0x61,0x0d,0xff,0xd9,0x30,0x04,0xae,0xff,0xc0,0x02,0xe0,0x02,0x26,0x13,0x20,
-0xd7,0x1b,0x02,0xad,0x0e,0x60,0x00,0x02,0xcb,0xb9,0x8c,0xe5,0x09,0x01,0xf4,0x17,
-0xee,0xda,0x88,0xbd,0x80,0x00,0x08,0xdf,0xed,0xda,0xcc,0xcd,0xed,0x70,0x03,0xfb,
-0x7d,0xe3,0x8e,0xa7,0xee,0x30,0x03,0xaf,0xff,0x91,0x5c,0xff,0xf9,0x10,0x0b,0xd8,
-0x36,0xd3,0xbd,0x84,0x6d,0x80,0x01,0x1c,0xf0,0x06,0x0e,0xd5,0x77,0x77,0x77,0x77,
-0x4d,0xf0,0x02,0x28,0xfe,0xee,0xee,0xef,0x72,0x20,0x00,0x08,0xfb,0xaa,0xaa,0x2f,
-0x4d,0x90,0x08,0xfa,0x88,0x88,0xbf,0x70,0x00,0x02,0x29,0x18,0x00,0x2a,0x82,0x20,
-0xcc,0x30,0x14,0xf4,0x07,0x00,0x10,0xe0,0xfb,0x00,0x0f,0x07,0x00,0x20,0x03,0x3f,
-0x00,0x51,0xfe,0xee,0xee,0xee,0xef,0x15,0x00,0x00,0xcc,0x33,0x02,0xf8,0x37,0x23,
-0x00,0x0d,0x1b,0x1a,0x62,0xdf,0xba,0xaa,0xaa,0xaf,0xf3,0xd3,0x30,0x00,0x59,0x41,
-0x00,0x99,0x16,0x07,0x0f,0x00,0x00,0xea,0x26,0x15,0xf3,0x2d,0x00,0x05,0x21,0x25,
-0x50,0x92,0x00,0x5a,0x10,0x00,0x3f,0x4c,0xe0,0x0b,0xfe,0x30,0x00,0x07,0xff,0x60,
-0x00,0x09,0xff,0x40,0x1c,0xff,0x60,0x9a,0x0c,0x30,0x40,0xad,0x30,0x2e,0x0b,0x05,
-0x17,0x1e,0x12,0x2b,0x88,0x31,0x14,0xb2,0x8c,0x07,0x10,0x03,0xfa,0x06,0x22,0x3b,
-0xf8,0x4d,0x00,0x00,0xf5,0x1c,0x61,0x8c,0xcc,0xcc,0xc0,0x09,0xf6,0xbc,0x07,0x11,
-0xf1,0x08,0x00,0x23,0x20,0x0d,0x08,0x00,0x12,0x0c,0x08,0x00,0x39,0x42,0x2d,0xf1,
-0x20,0x00,0x30,0xba,0xaa,0xa0,0x08,0x00,0x21,0x7a,0x10,0xcc,0x13,0x02,0x5e,0x0c,
-0x12,0xf3,0xbf,0x1b,0x18,0xfd,0x07,0x31,0x22,0x09,0x50,0xad,0x06,0x22,0xfe,0x20,
-0x02,0x38,0x30,0x40,0x09,0xb0,0x02,0x03,0x10,0x60,0xd3,0x1c,0xa1,0x02,0xdf,0x60,
-0x00,0x01,0xcf,0xb0,0x02,0xef,0xfe,0xac,0x03,0x91,0x0e,0xff,0xee,0xdc,0xba,0xa9,
-0xef,0x30,0x21,0x9e,0x21,0x21,0x40,0x02,0x71,0x0a,0x12,0xa0,0x40,0x08,0x12,0xfd,
-0xe8,0x18,0x21,0x4f,0xd0,0xfb,0x17,0x17,0x03,0x0f,0x00,0x03,0x1e,0x00,0x10,0xff,
-0x16,0x0c,0x23,0xd0,0x00,0xb9,0x51,0x01,0xf6,0x04,0x03,0x27,0x01,0x11,0xfa,0x0f,
-0x04,0x30,0xdd,0xde,0xfe,0xae,0x1b,0x15,0x0f,0xa1,0x32,0x23,0x7f,0xa0,0x6e,0x07,
-0x12,0x30,0x36,0x07,0x21,0xfe,0x32,0x27,0x24,0x12,0x2f,0xd5,0x08,0x20,0x01,0xdf,
-0xbf,0x0c,0x50,0xff,0x00,0x2d,0xfc,0xef,0xaf,0x11,0x00,0x48,0x2f,0x01,0x08,0x00,
-0x61,0x04,0x00,0xdf,0x11,0x11,0x11,0xe7,0x4f,0x03,0xcd,0x16,0x52,0xdf,0xcb,0xbb,
-0xbc,0xee,0x2e,0x1e,0x00,0x01,0x01,0x10,0x3f,0xcd,0x20,0x11,0xf3,0xf8,0x0d,0x01,
-0x81,0x29,0x04,0x18,0x00,0x11,0x2b,0x80,0x01,0x09,0x1f,0x0f,0x00,0x95,0x02,0x21,
-0x1a,0xab,0x27,0x0d,0x34,0xa0,0x00,0x06,0xe0,0x28,0x03,0x30,0x00,0x43,0x0a,0xaa,
-0xaa,0xaa,0x79,0x41,0x00,0xe7,0x00,0x01,0xc4,0x32,0x22,0xef,0x80,0x22,0x00,0x1a,
-0xfa,0x6b,0x30,0x19,0x91,0xeb,0x38,0x41,0x03,0xef,0xfe,0x30,0x5d,0x1e,0x20,0xf8,
-0x7f,0x46,0x1e,0x10,0x3c,0xee,0x1d,0xc0,0xd6,0x00,0x2b,0xff,0xfe,0xaa,0xaa,0xdf,
-0xff,0xe2,0x1d,0xfa,0x2f,0x01,0x40,0x6e,0x90,0x03,0x30,0xb8,0x33,0x04,0xc2,0x33,
-0x13,0x10,0x5d,0x03,0x11,0xf1,0x77,0x0d,0x32,0x99,0x9f,0xf1,0x77,0x0d,0x10,0x0e,
-0x08,0x00,0x01,0x2d,0x32,0x07,0x20,0x00,0x00,0x09,0x38,0x23,0xe1,0x00,0x7f,0x0c,
-0x91,0xcf,0xdc,0xcc,0xcc,0xcc,0xcd,0xfc,0xcf,0x10,0x7e,0x0e,0x10,0xcf,0xcc,0x3d,
-0x85,0xd1,0xfc,0xcf,0x19,0xaa,0xaa,0xaa,0x91,0x15,0x00,0x00,0x78,0x25,0xa0,0x11,
-0xfc,0xcf,0x11,0xfd,0x88,0xdf,0x11,0xfc,0xcf,0x17,0x2b,0x00,0x07,0x00,0x48,0xfb,
-0x00,0xbf,0x11,0x1c,0x00,0xc0,0x88,0x01,0xfc,0xcf,0x10,0x53,0x00,0x07,0xde,0xfa,
-0xcf,0x10,0x28,0x02,0x07,0xd2,0x20,0x31,0x85,0x10,0x00,0x0f,0x15,0x03,0xe1,0x3f,
-0x00,0x1c,0x1c,0x70,0x3d,0xfe,0xbb,0xbb,0xcf,0xf4,0x0a,0xf9,0x52,0x80,0xbf,0x90,
-0x04,0xe5,0x7e,0x40,0x1b,0xfd,0x7a,0x02,0x30,0xf9,0xef,0xb1,0xcb,0x01,0x01,0xbe,
-0x1d,0x72,0x27,0xdf,0xff,0xfc,0xcc,0xcb,0x2e,0x4d,0x1a,0x31,0x0c,0xd9,0xfd,0x18,
-0x07,0x1a,0x01,0x07,0x00,0x02,0xa9,0x0a,0x52,0x01,0xff,0xaa,0xaa,0xab,0x22,0x18,
-0x91,0x36,0x80,0x00,0x00,0x57,0x8a,0xbc,0xef,0xff,0x90,0x1b,0x83,0xfe,0xdb,0x97,
-0x40,0x00,0x00,0xdf,0x41,0x9f,0x09,0x15,0x20,0x46,0x0f,0x01,0xd7,0x08,0x11,0xdf,
-0xa0,0x02,0x14,0xc4,0x9f,0x09,0x30,0x00,0xff,0x1b,0xe3,0x01,0x41,0x10,0x01,0xfe,
-0x0f,0xb7,0x08,0x40,0x03,0xfc,0x0f,0xd0,0xc8,0x2c,0x22,0x07,0xf8,0x08,0x00,0x22,
-0x0c,0xf3,0x08,0x00,0x22,0x5f,0xc0,0x20,0x00,0x20,0x3c,0x30,0x4b,0x01,0x08,0x3c,
-0x32,0x22,0x03,0x63,0xc1,0x32,0x12,0xf9,0xee,0x04,0x00,0xfe,0x03,0x45,0xbd,0xdd,
-0xef,0xfd,0x3d,0x3a,0x22,0xf3,0xcf,0x10,0x27,0x70,0xcf,0x11,0x99,0x99,0x98,0x0b,
-0xf3,0x3d,0x01,0x10,0xfe,0x07,0x00,0x37,0xf9,0x00,0xde,0x07,0x00,0x39,0xfd,0xaa,
-0xfe,0x1c,0x00,0x21,0x00,0x0b,0x38,0x00,0x40,0x1d,0xdf,0xf1,0xcf,0x0e,0x12,0x09,
-0x26,0x3b,0x03,0x70,0x1f,0x00,0x41,0x03,0xf0,0x04,0xef,0xff,0xc5,0xbb,0xbb,0xbf,
-0xc0,0x0e,0xea,0xfc,0x04,0x50,0x01,0xfb,0x00,0xec,0x0e,0xc0,0xcf,0x43,0x17,0x60,
-0xc0,0xec,0x0d,0xe0,0x04,0xf8,0x0f,0x00,0xf0,0x00,0xfc,0x00,0x6f,0x60,0x0e,0xc0,
-0xec,0x1f,0xea,0xad,0xfc,0xa0,0xec,0x0e,0xc3,0x91,0x00,0x30,0x0e,0xe9,0xfc,0x15,
-0x06,0xa0,0xe0,0xef,0xff,0xc7,0xaa,0xaa,0xa3,0xfc,0x0e,0xd1,0x83,0x27,0x31,0x7f,
-0xa0,0xb9,0xf1,0x03,0x11,0xf7,0x5c,0x00,0x12,0x8a,0xb1,0x04,0x16,0x08,0x77,0x00,
-0x06,0x88,0x22,0x31,0xcc,0xcf,0xff,0x27,0x07,0x22,0x01,0xaf,0x5d,0x0f,0xf0,0x09,
-0x4e,0xff,0xe1,0xda,0x20,0x00,0x00,0x5c,0xff,0xcf,0xe3,0xcf,0xfa,0x20,0x4e,0xff,
-0xe5,0x0f,0xe0,0x05,0xdf,0xf3,0x0c,0xd6,0x8c,0x02,0x10,0x08,0xae,0x03,0x01,0x9a,
-0x3b,0x02,0xdf,0x3f,0x00,0x6c,0x1f,0x00,0xa8,0x21,0x00,0x08,0x00,0x00,0xb8,0x21,
-0x08,0x08,0x00,0x04,0x20,0x00,0x51,0xea,0xaa,0xaa,0xad,0xf7,0x0b,0x04,0x13,0x81,
-0x0a,0x0b,0x00,0x52,0x34,0x01,0x58,0x09,0x02,0x3a,0x2f,0xf2,0x11,0x3b,0xff,0x70,
-0x9f,0xe6,0x10,0x00,0x06,0xcf,0xfe,0x5c,0xc1,0x5f,0xff,0xb5,0x01,0xef,0xe7,0x00,
-0x9f,0xc0,0x18,0xef,0xa0,0x03,0x57,0x99,0x99,0xeb,0x99,0x71,0x60,0xe3,0x0c,0x01,
-0x64,0x4d,0x01,0xbb,0x04,0x02,0x45,0x00,0x24,0xcf,0x90,0x3d,0x22,0x10,0xfc,0x8a,
-0x04,0x52,0x99,0x99,0x99,0xaf,0xc0,0xf7,0x11,0x00,0xf9,0x32,0x02,0x0e,0x0e,0x12,
-0xc0,0x09,0x04,0x13,0xab,0xa3,0x1d,0x12,0x20,0x77,0x00,0x11,0xfc,0x35,0x41,0x20,
-0x22,0x2f,0x02,0x37,0x14,0x0d,0x05,0x0c,0x52,0xa9,0x99,0x99,0x99,0xff,0xec,0x05,
-0x14,0x0f,0x1c,0x0c,0x21,0x00,0x0d,0x0c,0x3d,0x14,0xb0,0x5c,0x02,0x21,0x0f,0xf9,
-0x73,0x02,0xb0,0x01,0xfc,0x8f,0xcb,0xbb,0xbb,0xdf,0x50,0x5f,0x98,0xf4,0x0b,0x11,
-0xa1,0x0a,0xf4,0x8f,0x50,0x00,0x00,0x9f,0x53,0xfd,0x08,0x1e,0x00,0x85,0x5e,0x40,
-0x8f,0xca,0xaa,0xaa,0xdf,0x50,0x7a,0x05,0x12,0xa3,0x61,0x3d,0x22,0x1f,0xf2,0x08,
-0x00,0x83,0x7f,0xfa,0xae,0xfd,0xaa,0xaa,0x00,0x02,0x8d,0x1a,0x22,0x0d,0xf9,0xb9,
-0x05,0x22,0x04,0xc0,0x89,0x3d,0x07,0x98,0x01,0x01,0xf8,0x0f,0x06,0xd1,0x12,0x03,
-0x57,0x1a,0x01,0x18,0x23,0x12,0xf8,0xea,0x00,0x10,0x08,0x08,0x00,0x13,0xc0,0x08,
-0x00,0x07,0x20,0x00,0x24,0xbd,0xf8,0xc0,0x1d,0x20,0x20,0x0e,0xc3,0x00,0xf0,0x14,
-0xbe,0xf2,0x00,0xef,0x00,0x0b,0xa0,0x00,0xbf,0x20,0x0e,0xf3,0xff,0xff,0xff,0x4b,
-0xf2,0x00,0xef,0x17,0x7f,0xe7,0x72,0xbf,0x20,0x0f,0xf3,0x66,0xfe,0x66,0x4b,0xf2,
-0x00,0xfe,0x8f,0x90,0x3c,0xf0,0x11,0x20,0x1f,0xe0,0x11,0x11,0x11,0x1b,0xf2,0x02,
-0xfc,0x0e,0xff,0xff,0xf0,0xbf,0x20,0x3f,0xa0,0xfd,0x77,0xdf,0x0b,0xf2,0x07,0xf7,
-0x0f,0xb0,0x0a,0xf0,0xbf,0x20,0xcf,0x63,0x2a,0xfe,0x00,0x0b,0xf2,0x3f,0xc0,0x0f,
-0xd7,0x77,0xfc,0xff,0x12,0xc4,0x00,0x32,0x00,0x0a,0xc8,0x02,0x00,0x67,0x02,0x13,
-0xa0,0xfc,0x35,0x02,0x7d,0x02,0x21,0x2c,0xfe,0x32,0x05,0xf4,0x09,0x3a,0xff,0xb1,
-0x2d,0xfe,0x83,0x00,0x4d,0xff,0xfe,0xa9,0x9b,0xff,0xff,0xe3,0x0e,0xe7,0xaf,0xff,
-0xff,0xf6,0x9f,0xb0,0x02,0x0c,0x17,0x60,0xaa,0xaa,0xa0,0x8a,0xaa,0xaa,0xa0,0x6c,
-0x20,0xf0,0xcf,0x84,0x11,0x66,0xfa,0x0c,0xf0,0xcf,0x10,0xaf,0x08,0x00,0x62,0xfd,
-0x8e,0xf0,0xcf,0x10,0xbf,0x20,0x00,0xa1,0x5f,0xff,0x00,0x01,0xfa,0x11,0x10,0xcf,
-0x19,0x93,0x2f,0x0f,0x01,0x92,0x03,0x03,0x13,0x1b,0x41,0x14,0x7a,0xef,0x90,0xed,
-0x09,0xd1,0xfe,0x83,0xcf,0xff,0xff,0xe0,0x35,0x5f,0xb0,0x0b,0xfc,0xcc,0xfe,0x52,
-0x46,0x30,0x10,0x1f,0xe0,0x9d,0x43,0x12,0xf1,0x1c,0x04,0xf0,0x00,0xcf,0x10,0x1f,
-0xe0,0x00,0xef,0xe1,0x0b,0xf1,0x01,0xfe,0x00,0x6f,0xff,0xd1,0x1e,0x00,0x30,0x0d,
-0xff,0xef,0x1e,0x00,0xf0,0x05,0x0a,0xf8,0xfb,0x7a,0xbf,0x10,0x1f,0xe3,0xfd,0x3f,
-0xb0,0x0b,0xfb,0xab,0xfe,0x0c,0x22,0xfb,0x00,0xbf,0x5b,0x23,0x51,0x2f,0xb0,0x0b,
-0xf3,0x23,0x4b,0x00,0x22,0x79,0x10,0xdf,0x0d,0xd0,0x56,0x20,0x00,0x22,0x22,0x10,
-0x00,0xcf,0x50,0x00,0xef,0xff,0x70,0xe1,0x10,0x30,0xee,0x9f,0x7a,0xac,0x02,0xa0,
-0xeb,0x1f,0x7a,0xfb,0xaa,0xaa,0xff,0xeb,0x1f,0x7a,0x35,0x36,0x61,0xeb,0x1f,0x7a,
-0xf2,0xff,0xf4,0x07,0x00,0x12,0xf6,0x07,0x00,0x51,0xf2,0xe4,0xdf,0xee,0xbf,0x07,
-0x00,0x22,0xef,0xff,0x1c,0x00,0xb0,0x00,0x0a,0xf2,0xf7,0x51,0xdf,0x97,0x00,0x0a,
-0xf1,0x61,0x5d,0x34,0x51,0x0a,0xf1,0x00,0x49,0xfe,0x07,0x00,0x23,0x3f,0xf8,0x90,
-0x2c,0x12,0x03,0x33,0x4e,0xf4,0x02,0x20,0x03,0xfc,0x9d,0xf3,0x6f,0xb9,0xdf,0x20,
-0x03,0xf7,0x09,0xf3,0x6f,0x40,0x9f,0x20,0x18,0x00,0x80,0x02,0xaa,0xaa,0xe9,0x6a,
-0xfe,0xaa,0x10,0x34,0x3e,0x36,0x11,0xcf,0x90,0x63,0x16,0xf0,0x0d,0xad,0xff,0xca,
-0xae,0xff,0xba,0xa2,0x00,0x7f,0xf7,0x00,0x01,0xcf,0xd5,0x00,0x4f,0xff,0xda,0xa3,
-0x5a,0xaf,0xff,0xf4,0x0b,0xff,0xff,0xf5,0x8f,0xc8,0x1e,0xe0,0xed,0x07,0xf5,0x8f,
-0x30,0xef,0x00,0x00,0xef,0xac,0xf5,0x8f,0xba,0xff,0x3a,0x02,0x45,0xe5,0x8f,0xff,
-0xed,0x01,0x20,0x03,0x07,0x00,0x11,0x10,0xe8,0x3e,0x04,0x07,0x00,0x00,0x0d,0x4c,
-0x61,0x12,0xfe,0xef,0x12,0xfd,0x99,0x07,0x00,0x37,0xf9,0x00,0xdf,0x07,0x00,0x45,
-0xfe,0xaa,0xff,0x12,0x23,0x00,0x07,0x38,0x00,0x15,0x03,0x4d,0x00,0x20,0xcb,0xbb,
-0x55,0x20,0x02,0x50,0x05,0x21,0xfd,0xcf,0x15,0x09,0x70,0xfd,0xce,0x00,0x00,0xac,
-0x00,0x00,0x07,0x00,0x10,0xef,0x07,0x00,0x80,0x3a,0xaa,0xff,0xaa,0xa3,0xfd,0xce,
-0x4f,0xb7,0x09,0x51,0xfd,0xce,0x00,0x04,0xfb,0x1c,0x00,0x30,0x08,0xff,0x80,0x07,
-0x00,0xe0,0x2f,0xfb,0xfa,0x00,0xfd,0xce,0x04,0xef,0x60,0xbf,0xa0,0xfd,0xce,0x2f,
-0x5f,0x21,0x84,0xfd,0xce,0x05,0x50,0x00,0x01,0x30,0xfd,0x54,0x00,0x10,0x99,0x01,
-0x00,0x22,0xfd,0xdf,0x0e,0x00,0x11,0xdf,0x65,0x17,0x21,0xfd,0xde,0xb4,0x35,0x30,
-0xfd,0xde,0x5f,0x61,0x03,0xf0,0x10,0xfd,0xde,0x27,0x78,0xfd,0x77,0x70,0xfd,0xde,
-0x09,0xbc,0xfe,0xbb,0x40,0xfd,0xde,0x08,0xab,0xfe,0xaa,0x40,0xfd,0xde,0x47,0x78,
-0xfd,0x77,0x73,0xfd,0xde,0x8f,0xcb,0x03,0x01,0x31,0x00,0x90,0x29,0xf3,0xfd,0xde,
-0x00,0x01,0xfb,0xaf,0xd0,0x07,0x00,0x35,0xa7,0x13,0x00,0x54,0x00,0x08,0x62,0x00,
-0x22,0xfe,0xdf,0xd2,0x00,0x60,0xdf,0x10,0x00,0x98,0x00,0x01,0x07,0x00,0x10,0xfd,
-0x07,0x00,0x10,0x5f,0x46,0x00,0xf0,0x01,0xfe,0xdf,0x37,0x77,0xfe,0x77,0x73,0xfe,
-0xdf,0x12,0x44,0xfd,0x44,0x21,0xfe,0xdf,0x31,0x2f,0x70,0x91,0xfe,0xdf,0x19,0xf3,
-0x11,0x5f,0x07,0x00,0xb0,0xf7,0x77,0x9f,0x91,0xfe,0xdf,0x18,0xff,0xff,0xff,0x81,
-0x38,0x00,0x00,0x12,0x07,0x0b,0x54,0x00,0x02,0xe4,0x07,0x02,0x0e,0x00,0x20,0xfc,
-0xdf,0x29,0x08,0x21,0x03,0xfc,0x5b,0x00,0xf0,0x02,0xa3,0xfc,0xdf,0x39,0x9b,0xfc,
-0x99,0x63,0xfc,0xdf,0x10,0x05,0xf7,0x00,0x03,0xfc,0xdf,0x53,0x17,0xf0,0x0a,0x23,
-0xfc,0xdf,0x18,0x8a,0xfc,0xcc,0x13,0xfc,0xdf,0x10,0x04,0xf7,0xaf,0x33,0xfc,0xdf,
-0x59,0x9b,0xfc,0xaf,0xa3,0xfc,0xdf,0x7f,0x0c,0x02,0x31,0xfc,0xdf,0x10,0xc9,0x1f,
-0x04,0x54,0x00,0x02,0x50,0x1e,0x05,0x88,0x01,0x80,0xbe,0xcb,0xbb,0xbb,0xfd,0xcf,
-0x00,0x4f,0xe6,0x35,0xfa,0x30,0xcf,0x03,0xef,0xff,0xff,0xe3,0xfd,0xcf,0x7f,0xfe,
-0x76,0xef,0x81,0xfd,0xcf,0x3b,0x6f,0xed,0xf7,0x01,0xfd,0xcf,0x15,0x9e,0xff,0xfa,
-0x52,0xfd,0xcf,0xef,0xff,0x83,0xaf,0xfc,0xfd,0xcf,0x56,0x2d,0xfe,0x92,0x42,0xfd,
-0xcf,0x00,0x75,0x58,0xc1,0x01,0xfd,0xcf,0x05,0xef,0xff,0xc8,0x21,0xfd,0xcf,0x00,
-0x00,0x37,0xbf,0x31,0xfd,0xdc,0x01,0x0a,0x96,0x01,0x20,0xcf,0x0b,0x1a,0x25,0x75,
-0xfd,0xcf,0x0b,0xf3,0x33,0x3f,0xb0,0x0e,0x00,0x10,0x03,0x27,0x46,0x31,0xfd,0xcf,
-0x0f,0x9d,0x01,0x50,0xcf,0x0f,0xc6,0x89,0x6d,0x07,0x00,0xf4,0x11,0xa0,0xcd,0x0b,
+0x00,0x08,0x00,0x13,0x32,0x08,0x00,0x50,0x00,0x01,0xdd,0xef,0xb0,0x08,0x00,0x36,
+0x00,0xdf,0xfc,0xd1,0x06,0x41,0x02,0x40,0x00,0x41,0x57,0x08,0x00,0x9f,0x08,0x01,
+0x4f,0x0a,0x11,0x0b,0x59,0x08,0x20,0xaf,0x90,0x5c,0x09,0xf0,0x00,0xf6,0x06,0xff,
+0x20,0xcf,0xef,0xfd,0xdd,0xd5,0x3f,0xff,0x28,0xfd,0x1f,0xd0,0x70,0x01,0xb0,0x4f,
+0xf3,0x1f,0xfa,0xaa,0xa0,0x2d,0xdf,0x23,0x50,0x1f,0x69,0x0a,0x40,0xcf,0x20,0x00,
+0x1f,0xc8,0x00,0x08,0x08,0x00,0x00,0xfa,0x09,0x00,0x08,0x00,0x39,0xfc,0xcc,0xc2,
+0x18,0x00,0x08,0x08,0x00,0x0d,0xe1,0x05,0x40,0xd4,0x00,0x0e,0xf0,0x5a,0x03,0x12,
+0xf5,0x08,0x00,0x22,0x5f,0xee,0x42,0x0a,0xa1,0xcf,0x7b,0xbb,0xbf,0xfb,0xbb,0xb2,
+0x07,0xff,0x20,0x18,0x00,0x30,0x3f,0xff,0x29,0x18,0x00,0xf2,0x04,0xc0,0xcf,0xff,
+0x29,0xf9,0x8f,0xf8,0x8f,0xc0,0x6c,0xbf,0x29,0xf1,0x0e,0xf0,0x0f,0xc0,0x00,0xaf,
+0x18,0x00,0xe0,0x00,0xaf,0x25,0xb8,0x9f,0xe8,0x88,0x60,0x00,0xaf,0x24,0xfa,0x6f,
+0xa0,0xc8,0x00,0x41,0x20,0x7f,0xff,0x40,0x08,0x00,0xf0,0x09,0x3e,0xff,0xb6,0x10,
+0x00,0x00,0xaf,0x6d,0xff,0x99,0xff,0xfe,0xc2,0x00,0xaf,0x2b,0xa3,0x00,0x05,0x9c,
+0xa0,0x00,0x2b,0x40,0x75,0x01,0x40,0xf0,0x07,0xf8,0xff,0xf6,0x06,0xf0,0x32,0x00,
+0xdf,0x3c,0xfe,0xcc,0x7f,0x5b,0xf0,0x2f,0xb0,0x3f,0x90,0x04,0xf6,0xbf,0x0b,0xfa,
+0x07,0xfb,0x76,0x5f,0x6b,0xf3,0xff,0xa0,0xbf,0xff,0xf5,0xf6,0xbf,0x6f,0xfa,0x1f,
+0xd4,0xde,0x4f,0x6b,0xf0,0xcf,0xa7,0xf7,0x0f,0xb4,0xf6,0xbf,0x01,0xfb,0xff,0x65,
+0xf8,0x4f,0x6b,0xf0,0x1f,0xa6,0x8f,0xff,0x34,0xf6,0xbf,0x01,0xfa,0x00,0x5f,0xe0,
+0x0f,0x00,0xf7,0x0e,0xa0,0x07,0xf7,0x01,0x31,0xbf,0x01,0xfa,0x04,0xfd,0x00,0x00,
+0x0c,0xf0,0x1f,0xa2,0xff,0x40,0x01,0xee,0xfe,0x01,0xfa,0x09,0x40,0x00,0x0b,0xdb,
+0x40,0xf1,0x00,0x40,0x0d,0xf0,0x0b,0xf2,0x4b,0x04,0x02,0x08,0x00,0x22,0x4f,0xc0,
+0x08,0x00,0xa1,0xcf,0x56,0xaf,0xfa,0xae,0xfb,0xa2,0x06,0xff,0x19,0x01,0x01,0xb1,
+0x2f,0xff,0x11,0x2e,0xf2,0x2c,0xf4,0x20,0xaf,0xff,0x10,0x20,0x00,0x22,0x4e,0xef,
+0x08,0x00,0xa3,0x03,0xcf,0x13,0x3e,0xf3,0x3c,0xf5,0x31,0x00,0xcf,0xd2,0x06,0xe0,
+0xcf,0x1a,0xaa,0xaa,0xaa,0xaa,0xa3,0x00,0xcf,0x10,0x09,0x81,0x04,0x91,0xc2,0x04,
+0xf5,0x05,0x9f,0xa0,0x07,0xfd,0x10,0x00,0xcf,0x2b,0xfc,0x00,0x00,0x7f,0xc0,0x00,
+0xcf,0x18,0xa0,0x00,0x00,0x0a,0x69,0x03,0x30,0x08,0xe1,0x00,0x65,0x08,0xf2,0x18,
+0x00,0xde,0x9f,0xff,0xff,0x40,0x0a,0xe0,0x1f,0xa9,0xe5,0x57,0xf4,0xe8,0xae,0x05,
+0xf7,0x9e,0x4d,0x3f,0x4e,0x8a,0xe0,0xbf,0x79,0xe5,0xf3,0xf4,0xe8,0xae,0x2f,0xf7,
+0x9e,0x5f,0x3f,0x4e,0x8a,0xe7,0xff,0x0f,0x00,0x12,0x1c,0x0f,0x00,0x22,0xe0,0x2f,
+0x0f,0x00,0x40,0x01,0xf7,0x9e,0x6f,0x0f,0x00,0x41,0x1f,0x79,0xe7,0xe3,0x0f,0x00,
+0xf5,0x0d,0x7a,0xbb,0x2a,0x2b,0x6a,0xe0,0x1f,0x70,0x4f,0x8e,0x40,0x00,0xae,0x01,
+0xf7,0x5f,0xb0,0x9f,0x32,0x9e,0xd0,0x1f,0x79,0xa0,0x00,0xb4,0x1f,0xe6,0xf8,0x00,
+0x23,0x01,0x00,0xe0,0x0c,0xf1,0x22,0xd1,0x01,0x85,0xbf,0x15,0x00,0x00,0x3f,0xe6,
+0xbf,0xff,0xdf,0x6f,0x50,0x00,0x9f,0xef,0xff,0xe4,0xbf,0x1e,0xc0,0x00,0xef,0x48,
+0x5f,0xb0,0xbf,0x19,0xf1,0x06,0xfe,0x00,0x1f,0xb0,0xbf,0x12,0x20,0x1e,0xfe,0x7a,
+0xbf,0xea,0xef,0xba,0xa0,0x9f,0xfe,0xaf,0xba,0x0b,0xf0,0x2e,0x5e,0xee,0x00,0x1f,
+0xb0,0x8f,0x36,0x40,0x03,0xde,0x00,0x1f,0xd8,0x8f,0x8f,0xa0,0x00,0xde,0x5b,0xef,
+0xff,0x8f,0xff,0x30,0x00,0xde,0x7f,0xef,0xc1,0x2f,0xf8,0x00,0x00,0xde,0x01,0x1f,
+0xb0,0x6f,0xe0,0x91,0x00,0xde,0x00,0x1f,0xb7,0xff,0xf2,0xf6,0x00,0xde,0x1b,0xcf,
+0xbe,0xc6,0xff,0xf3,0x00,0xde,0x0d,0xfc,0x33,0x4d,0x0a,0x05,0x69,0x04,0x13,0x71,
+0x71,0x03,0x30,0xf6,0xff,0xff,0xd2,0x03,0xb0,0x2f,0xe1,0xfe,0xaa,0xaa,0xef,0x20,
+0x00,0xaf,0x70,0xfc,0xa6,0x02,0x31,0x04,0xff,0x20,0x08,0x00,0x31,0x2e,0xff,0x20,
+0x20,0x00,0xa2,0xbf,0xff,0x20,0xaa,0xaf,0xfa,0xaa,0x10,0x4d,0xbf,0x89,0x02,0x42,
+0x01,0xaf,0x3f,0xff,0xf2,0x0b,0xd1,0x3c,0xcc,0xff,0xff,0xcc,0xb0,0x00,0xaf,0x20,
+0x07,0xff,0xff,0x60,0x71,0x02,0xf6,0x0d,0xce,0xfb,0xf5,0x00,0x00,0xaf,0x4b,0xfd,
+0x1e,0xf1,0xef,0x90,0x00,0xaf,0x6f,0xc1,0x0e,0xf0,0x2e,0xd1,0x00,0xaf,0x23,0x00,
+0x0e,0xf0,0x01,0x20,0x08,0x01,0x12,0x10,0xd2,0x06,0x50,0x0b,0xf3,0x00,0x3f,0x80,
+0x79,0x03,0x40,0xc0,0x00,0x0c,0xe0,0xe9,0x0d,0xf0,0x06,0x6e,0xee,0xef,0xfe,0xee,
+0xe0,0x02,0xff,0x29,0x99,0x99,0x99,0x99,0x90,0x0d,0xff,0x10,0x78,0x88,0x88,0x87,
+0x71,0x04,0xf0,0x02,0xcf,0xff,0xff,0xfd,0x00,0x4d,0xbf,0x10,0x33,0x33,0x33,0x33,
+0x00,0x01,0xaf,0x10,0xdf,0x10,0x00,0x50,0x00,0xaf,0x10,0x22,0x22,0x72,0x0e,0x22,
+0xaf,0x11,0x82,0x0e,0x60,0xaf,0x11,0xfc,0x88,0x88,0xdf,0x08,0x00,0x00,0x12,0x08,
+0x08,0x10,0x00,0xd0,0xee,0xff,0xff,0xed,0x10,0x00,0x04,0x20,0x00,0x26,0x20,0x00,
+0x00,0xc5,0x00,0x20,0xaf,0x50,0x69,0x03,0x22,0x90,0x03,0x31,0x05,0xf0,0x2e,0x30,
+0x1e,0xfd,0x88,0xdf,0x60,0x04,0xff,0x00,0xbf,0xef,0x56,0xfc,0x00,0x0d,0xfe,0x2f,
+0x76,0x0c,0xff,0xd1,0x00,0x8f,0xfe,0x2f,0x64,0xaf,0xff,0xfa,0x51,0x5f,0xfe,0x2f,
+0xef,0xf9,0x35,0xcf,0xf5,0x04,0xde,0x2f,0x86,0x04,0xde,0x12,0x50,0x00,0xde,0x2f,
+0x64,0xef,0xb2,0x74,0x00,0x00,0xde,0x2f,0x60,0x73,0x5d,0xf5,0x08,0x00,0xf0,0x0e,
+0x63,0xbf,0xfa,0x2a,0x91,0x00,0xde,0x2b,0x40,0x96,0x27,0xef,0x70,0x00,0xde,0x00,
+0x17,0xae,0xff,0xa2,0x00,0x00,0xde,0x00,0x0b,0xd9,0x50,0x00,0x00,0x78,0x00,0x20,
+0x05,0x60,0x02,0x0c,0x40,0xd0,0x00,0x0d,0xf1,0x4a,0x07,0x12,0x7f,0xb8,0x02,0xf0,
+0x0c,0xce,0x1f,0xd9,0xdd,0x99,0xcf,0x93,0x04,0xfb,0x0f,0xa0,0xe9,0x00,0x8f,0x10,
+0x0d,0xfb,0x0f,0xa2,0xf5,0x00,0x8f,0x10,0x8f,0xfb,0x0f,0xa7,0x94,0x03,0xf1,0x07,
+0x5f,0xfb,0x0f,0xae,0xf5,0x88,0xcf,0x91,0x03,0xfb,0x1f,0xef,0xf4,0x90,0x8f,0x10,
+0x00,0xfb,0x2f,0x9c,0xf4,0xf7,0x08,0x00,0x30,0x75,0xf1,0xae,0x08,0x00,0xf0,0x17,
+0x4f,0x65,0xf1,0x29,0x9f,0x10,0x00,0xfb,0x8f,0x35,0xf1,0x00,0x8f,0x10,0x00,0xfc,
+0xde,0x05,0xf1,0x0a,0xdf,0x00,0x00,0xfc,0x68,0x05,0xe1,0x0c,0xd7,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x2c,0x00,0x01,0x30,0x00,0x06,0x70,0x00,0x00,
+0x00,0x08,0xf7,0x00,0x0d,0xf1,0x00,0x00,0x00,0x1f,0xf5,0xbb,0xbe,0xfc,0xbb,0xa0,
+0x00,0x8f,0x84,0xff,0xff,0xff,0xff,0xe0,0x04,0xff,0x20,0x2d,0x80,0x03,0xf9,0x00,
+0x2e,0xff,0x10,0x0e,0xe0,0x09,0xf4,0x00,0x8f,0xff,0x19,0x9d,0xda,0x9f,0xfa,0x94,
+0x1c,0xcf,0x1f,0x20,0x00,0x51,0xf7,0x00,0xbf,0x10,0x00,0x01,0x00,0xf0,0x00,0xbf,
+0x10,0x7a,0xaa,0xaa,0xaa,0x10,0x00,0xbf,0x10,0xaf,0xff,0xff,0xff,0x20,0x08,0x00,
+0x39,0x10,0x00,0xbf,0x08,0x00,0x42,0xbb,0xbb,0xef,0x20,0x20,0x00,0x42,0xfe,0x20,
+0x00,0x04,0x38,0x00,0xf4,0x5b,0x01,0xfe,0x77,0x77,0x74,0x00,0xaf,0x00,0x7f,0x8f,
+0xff,0xff,0xad,0xaa,0xf0,0x0d,0xf1,0x3f,0xb3,0x51,0xda,0xaf,0x04,0xfb,0x08,0xf3,
+0x9f,0x1d,0xaa,0xf0,0xdf,0xa3,0xff,0xbe,0xf9,0xda,0xaf,0x7f,0xfa,0x4f,0xfc,0x9b,
+0xfe,0xaa,0xf4,0xff,0xa0,0x33,0x93,0x22,0xda,0xaf,0x06,0xfa,0x01,0x6f,0x71,0x1d,
+0xaa,0xf0,0x1f,0xa6,0xff,0xff,0xf9,0xda,0xaf,0x01,0xfa,0x27,0xaf,0xa7,0x4d,0xaa,
+0xf0,0x1f,0xa0,0x05,0xf7,0x34,0x64,0xaf,0x01,0xfa,0x8b,0xdf,0xff,0xc0,0x0b,0xf0,
+0x1f,0xa9,0xc9,0x63,0x10,0x9c,0xfe,0x01,0xfa,0x00,0x00,0x00,0x05,0xcb,0x40,0x00,
+0x01,0x00,0xf0,0x03,0x04,0x92,0x00,0x0a,0xf4,0x00,0x00,0x00,0x0b,0xf4,0x00,0x0b,
+0xf3,0x00,0x00,0x00,0x2f,0xda,0xc9,0x00,0xf0,0x05,0xf1,0x00,0x9f,0x65,0x99,0x9f,
+0xe9,0x99,0x90,0x03,0xff,0x10,0x55,0x6f,0xb5,0x55,0x10,0x0d,0xff,0x00,0x18,0x00,
+0xb2,0x30,0x7f,0xff,0x00,0xfc,0x11,0x11,0x9f,0x30,0x1e,0xef,0x10,0x00,0xa2,0x01,
+0xcf,0x00,0xfc,0x33,0x33,0xaf,0x30,0x00,0xcf,0x10,0x00,0x17,0x00,0x10,0x00,0x21,
+0xee,0xee,0x10,0x00,0xf0,0x01,0xfd,0x55,0x55,0xbf,0x30,0x00,0xcf,0x39,0xfe,0x99,
+0x99,0xdf,0xb4,0x00,0xcf,0x5f,0x28,0x00,0x70,0xf6,0x00,0x02,0x40,0x00,0x16,0x30,
+0x29,0x01,0x30,0x40,0x02,0xfc,0x77,0x00,0x10,0xea,0x17,0x00,0xf0,0x1b,0xa0,0x09,
+0xf7,0xaf,0xa9,0x99,0x9c,0xfb,0x03,0xff,0x1a,0xf1,0x00,0x00,0x6f,0xb0,0xdf,0xf1,
+0xaf,0xee,0xee,0xef,0xfb,0x9f,0xff,0x1b,0xfc,0xcc,0xcc,0xcc,0x85,0xfd,0xf1,0xbf,
+0x87,0x77,0x77,0x77,0x04,0xbf,0x1c,0xef,0x8d,0x01,0xf0,0x1e,0x0b,0xf1,0xdc,0xf6,
+0xd5,0xd5,0x8e,0x00,0xbf,0x1f,0xaf,0xbe,0xae,0xac,0xe0,0x0b,0xf3,0xf8,0xff,0xff,
+0xff,0xfe,0x00,0xbf,0x8f,0x3f,0x6d,0x5d,0x58,0xe0,0x0b,0xfc,0xe0,0xf6,0xd5,0xda,
+0xce,0x00,0xbf,0x58,0x0f,0x6d,0x5d,0x9c,0x60,0xec,0x00,0x90,0x10,0x10,0x00,0x00,
+0x03,0x60,0x00,0x19,0x90,0xf0,0x00,0x93,0xf9,0x88,0x8f,0xf8,0x88,0x80,0x00,0x2f,
+0xbe,0xf0,0x00,0x72,0x50,0x55,0x55,0x55,0x55,0x00,0x02,0xe8,0x00,0x21,0x00,0x0c,
+0xe8,0x00,0x33,0xdf,0x00,0x7f,0x10,0x00,0xb0,0x1e,0xef,0x02,0x66,0x66,0x66,0x66,
+0x20,0x01,0xcf,0x3f,0x10,0x00,0xf0,0x11,0xf3,0x00,0xcf,0x3f,0x83,0x33,0x33,0x39,
+0xf3,0x00,0xcf,0x2c,0xdf,0xff,0xff,0xfd,0xc2,0x00,0xcf,0x00,0x58,0x8f,0xf8,0x84,
+0x00,0x00,0xcf,0x00,0x00,0x0e,0xf0,0x00,0x08,0x00,0x22,0x0a,0xbf,0x08,0x00,0x20,
+0x0b,0xed,0x51,0x02,0xf1,0x0a,0x09,0x70,0x64,0x0f,0xf0,0x37,0x20,0x00,0x2f,0xd3,
+0xfe,0x1f,0xf0,0xdf,0x60,0x00,0x7f,0x81,0xaf,0x5f,0xf4,0xda,0x20,0x00,0xdf,0x50,
+0x00,0xf0,0x05,0xf2,0x05,0xff,0x1f,0xea,0xaa,0xaa,0xae,0xf2,0x0d,0xff,0x0f,0xc0,
+0x00,0x00,0x0c,0xf2,0x8f,0xff,0x07,0xe4,0x00,0xf2,0x05,0x71,0x5f,0xff,0x00,0x9b,
+0xbb,0xbb,0xbb,0x00,0x07,0xef,0x12,0x22,0x22,0x22,0x22,0x21,0x00,0xef,0x5f,0x69,
+0x02,0xf2,0x0b,0xef,0x3a,0xad,0xfe,0xaa,0xea,0xa4,0x00,0xef,0x00,0x2f,0xf3,0x08,
+0xf8,0x00,0x00,0xef,0x04,0xef,0x84,0x57,0xff,0x50,0x00,0xef,0x0c,0xd0,0x00,0xf0,
+0x24,0xef,0x05,0x86,0x43,0x10,0x08,0xa2,0x00,0x1d,0x50,0x00,0x05,0xf6,0x03,0x61,
+0x00,0x7f,0x59,0x20,0x05,0xf6,0x0a,0xf2,0x00,0xcf,0x4f,0xe0,0xff,0xff,0xef,0xb0,
+0x01,0xfb,0x06,0xf6,0x9b,0xfc,0xdf,0x40,0x08,0xf8,0x00,0x50,0x05,0xf8,0xfc,0x00,
+0x1f,0xf8,0x99,0x98,0x58,0x00,0xf0,0x18,0x8f,0xf8,0xff,0xf6,0xbc,0xff,0xcb,0xb5,
+0x2c,0xf8,0x2b,0xf0,0x2c,0xfa,0x00,0x00,0x02,0xf8,0x0a,0xf5,0xff,0xff,0xff,0xd0,
+0x01,0xf8,0x0a,0xf6,0xff,0xd8,0x8e,0xe0,0x01,0xf8,0x0a,0xf0,0x2f,0xc6,0x6d,0x08,
+0x00,0xf1,0x03,0xf7,0x3f,0xff,0xff,0xe0,0x01,0xf8,0x0d,0xff,0x7f,0x90,0x0c,0xe0,
+0x01,0xf8,0x2f,0xe5,0x0f,0x10,0x00,0xc0,0x05,0x00,0x0f,0xd8,0x8d,0xd0,0x00,0x02,
+0x40,0x03,0x61,0x00,0x68,0x01,0xf1,0x0a,0xf7,0x1e,0xf8,0x67,0x10,0x00,0x00,0x2f,
+0xf1,0xbf,0xff,0xff,0xa0,0x00,0x00,0xaf,0x9c,0xfc,0x33,0xef,0x43,0x20,0x04,0xff,
+0xbf,0xf1,0x01,0xb1,0x1e,0xff,0x16,0xf9,0x19,0xf2,0x2f,0xa0,0x8f,0xff,0x01,0x10,
+0x00,0xf8,0x30,0x1d,0xdf,0x00,0x6c,0xff,0x66,0x68,0x40,0x00,0xcf,0x28,0xdf,0xcf,
+0x70,0x7f,0x90,0x00,0xcf,0x19,0x96,0xbf,0xfe,0xfd,0x20,0x00,0xcf,0x15,0xbf,0xb7,
+0xfc,0xce,0x00,0x00,0xcf,0x19,0xb5,0x9f,0xfb,0x4f,0x80,0x00,0xcf,0x14,0xaf,0xf6,
+0xec,0x0c,0xf7,0x00,0xcf,0x3e,0xf9,0x7a,0xfa,0x01,0xc3,0x00,0xcf,0x02,0x10,0x6f,
+0xc2,0x00,0x01,0x00,0x13,0x15,0xe5,0x02,0x22,0x4f,0xe1,0x08,0x00,0x71,0x0c,0xe5,
+0x00,0x00,0x00,0x0f,0xff,0x01,0x00,0xf0,0x29,0xf0,0x0c,0xcc,0xef,0xfd,0xcc,0xdd,
+0xcc,0xc0,0x00,0x01,0xdf,0x90,0x03,0xdb,0x00,0x00,0x00,0x1d,0xf9,0x00,0x00,0xaf,
+0xd1,0x00,0x01,0xff,0xfe,0xef,0xff,0xff,0xfd,0x10,0x00,0xdf,0xff,0xfd,0xdf,0xfa,
+0xdf,0xa0,0x00,0x44,0x4f,0xf0,0x2f,0xe0,0x2a,0x10,0x00,0x00,0x5f,0xc0,0x2f,0xe0,
+0x00,0xd1,0x01,0xf5,0x10,0x70,0x2f,0xe0,0x04,0xc4,0x00,0x1c,0xfe,0x10,0x2f,0xe0,
+0x06,0xf7,0x1b,0xff,0xe3,0x00,0x1f,0xfd,0xcf,0xf3,0x0a,0xfb,0x20,0x00,0x08,0xef,
+0xff,0x90,0x01,0x10,0x80,0x00,0x20,0x0f,0xf0,0x06,0x00,0x10,0x6c,0x08,0x00,0xf3,
+0x1c,0x97,0x10,0x00,0xaf,0x90,0x0f,0xf0,0x04,0xff,0x10,0x00,0x1e,0xf4,0x0f,0xf0,
+0x0d,0xf6,0x00,0x00,0x05,0xf9,0x0f,0xf0,0x8f,0xa0,0x00,0x00,0x00,0x40,0x0f,0xf0,
+0x05,0x00,0x00,0x1d,0xdd,0xdd,0xdf,0xfd,0xdd,0xdd,0xd0,0x1f,0xa0,0x00,0x51,0x00,
+0x00,0x4f,0xc0,0x0f,0x70,0x00,0x22,0x6f,0x90,0x08,0x00,0x21,0xbf,0x60,0x08,0x00,
+0xfb,0x0d,0x03,0xff,0x10,0x0f,0xe0,0x01,0x00,0x00,0x3e,0xf8,0x00,0x0f,0xf0,0x06,
+0xe3,0x2a,0xff,0xa0,0x00,0x0f,0xfd,0xdf,0xf3,0x0c,0xf7,0x00,0x00,0x06,0x80,0x00,
+0x12,0xe0,0x08,0x00,0x10,0x1f,0x08,0x00,0x13,0x0e,0x58,0x00,0x84,0x09,0xaa,0xaa,
+0xaf,0xfa,0xaa,0xaa,0xa0,0x18,0x00,0x22,0x00,0x3f,0x8f,0x03,0x60,0x00,0x3f,0xd9,
+0x99,0x99,0x9d,0x08,0x00,0x40,0x90,0x00,0x00,0x09,0x08,0x00,0x53,0xeb,0xbb,0xbb,
+0xbe,0xf6,0x20,0x00,0x10,0xf5,0x29,0x00,0x30,0xd0,0x3f,0xb0,0x31,0x00,0xf5,0x10,
+0xaf,0x90,0x3f,0xb0,0x04,0x71,0x00,0x1a,0xff,0x20,0x3f,0xb0,0x07,0xf5,0x3c,0xff,
+0xf5,0x00,0x2f,0xfc,0xcf,0xf2,0x0c,0xfa,0x20,0x00,0x09,0xff,0xff,0x80,0x01,0x7f,
+0x00,0x13,0x03,0x08,0x00,0x23,0x2f,0x90,0x87,0x01,0x12,0xf9,0x08,0x00,0x32,0x05,
+0xff,0x60,0x09,0x00,0x23,0x6f,0xf1,0x08,0x00,0x13,0xfa,0x33,0x05,0x21,0xff,0x40,
+0x03,0x05,0x40,0xff,0xaf,0xd0,0x00,0x82,0x05,0x31,0xfd,0x0d,0xf7,0xbf,0x00,0x40,
+0xf6,0x04,0xff,0x20,0x1f,0x00,0xf1,0x10,0xd0,0x00,0xbf,0xc0,0x00,0x00,0x09,0xff,
+0x30,0x00,0x2f,0xfa,0x00,0x01,0xaf,0xf6,0x00,0x00,0x06,0xff,0xc1,0x2e,0xff,0x80,
+0x00,0x00,0x00,0x8f,0xf6,0x07,0xe5,0x5c,0x00,0x17,0xe0,0x00,0x02,0x13,0x05,0x00,
+0x02,0x22,0x3f,0xf5,0x90,0x00,0x12,0xef,0x60,0x00,0x50,0x4f,0xf7,0x6f,0xf6,0x00,
+0x48,0x00,0xf1,0x08,0x70,0x05,0xff,0xa2,0x00,0x07,0xef,0xe4,0x00,0x00,0x3d,0xff,
+0x91,0x4f,0xff,0xdb,0xbb,0xbb,0xbc,0xff,0xf7,0x06,0x4c,0xdf,0x03,0x23,0x80,0x00,
+0xc7,0x03,0x00,0x48,0x01,0x21,0xf1,0x00,0x30,0x00,0x00,0x07,0x03,0x94,0x00,0x00,
+0x05,0x99,0x9f,0xfa,0x99,0x80,0x00,0x20,0x00,0x92,0x07,0xbb,0xbb,0xbf,0xfb,0xbb,
+0xbb,0xa0,0x0a,0x60,0x01,0x02,0x80,0x00,0x01,0x84,0x01,0x20,0x9f,0x80,0x97,0x03,
+0x50,0x00,0x02,0xff,0x40,0x03,0xc0,0x00,0xf0,0x0a,0x0a,0xfb,0x00,0x00,0x9f,0xd0,
+0x00,0x00,0x4f,0xf3,0x00,0x00,0x0e,0xfa,0x00,0x02,0xff,0x90,0x39,0x20,0x04,0xff,
+0x90,0x1e,0xfc,0xd9,0x00,0xd3,0x7f,0xf3,0x04,0xc1,0x04,0xff,0x40,0x00,0x09,0x50,
+0x00,0x00,0x0d,0x0f,0x01,0x42,0x7f,0xe1,0x02,0xcc,0x40,0x00,0xf0,0x10,0x00,0xef,
+0x70,0x00,0x00,0x1d,0xf7,0x00,0x01,0x7f,0xf3,0x00,0x01,0xdf,0xfd,0xef,0xff,0xff,
+0xfc,0x00,0x00,0xef,0xff,0xff,0xdc,0xb9,0xef,0x60,0x00,0x55,0x32,0x2c,0x00,0x12,
+0x80,0x34,0x00,0xf0,0x01,0x02,0x00,0x00,0x00,0x30,0x00,0x00,0x04,0x00,0x00,0x00,
+0x06,0xf9,0x00,0x00,0x7f,0xe7,0x01,0x40,0xdf,0x40,0x00,0xef,0x40,0x01,0x20,0x5e,
+0x50,0x90,0x00,0x12,0x0b,0xa8,0x00,0x31,0xb0,0x09,0xdd,0x01,0x00,0x2c,0xa0,0x00,
+0x01,0x00,0x10,0xad,0x17,0x00,0x40,0xd6,0x00,0x00,0xcf,0x27,0x00,0x2f,0xf8,0x00,
+0x01,0x00,0x05,0x12,0x2f,0x48,0x00,0x22,0xf1,0x2d,0x48,0x00,0x11,0xd1,0xf5,0x00,
+0x10,0x02,0x78,0x00,0x10,0xf7,0x2b,0x03,0x00,0xc7,0x01,0xd1,0x10,0x00,0xdf,0x60,
+0x00,0x00,0x11,0x9f,0x51,0x16,0xfd,0x11,0x00,0x46,0x05,0x00,0x20,0x06,0x70,0xbc,
+0xcc,0xcf,0xfd,0xcc,0xcc,0x20,0x58,0x01,0x13,0xf3,0x60,0x01,0x17,0xf4,0x98,0x03,
+0x90,0x0d,0xdd,0xdd,0xef,0xff,0xdd,0xdd,0xd0,0x00,0x82,0x00,0x10,0x30,0x1f,0x00,
+0x40,0x0a,0xff,0x9f,0xe4,0xa8,0x06,0xf0,0x02,0xdf,0xf7,0x07,0xff,0x91,0x00,0x17,
+0xdf,0xfe,0x50,0x00,0x8f,0xff,0xb3,0x1d,0xff,0x81,0x14,0x00,0x31,0xd0,0x02,0x50,
+0xdc,0x01,0x94,0x30,0x00,0x07,0xf6,0x00,0x00,0x8f,0x60,0x00,0x08,0x00,0x13,0x0a,
+0xe8,0x00,0xb3,0x08,0xce,0xfe,0xcc,0xcc,0xef,0xec,0x90,0x00,0x07,0xf7,0x20,0x00,
+0x00,0x17,0x00,0x00,0x08,0x00,0x40,0xfb,0x88,0x88,0xcf,0x08,0x00,0x13,0xfc,0x08,
+0x00,0x04,0x18,0x00,0x02,0x28,0x00,0x12,0x1c,0x38,0x00,0x13,0xc1,0xe8,0x00,0xf3,
+0x0c,0xf2,0x00,0x01,0x8e,0x60,0x05,0xc6,0x10,0x00,0x05,0xaf,0xfe,0x70,0x08,0xef,
+0xfa,0x30,0x1d,0xfc,0x60,0x00,0x00,0x05,0xdf,0x90,0x01,0x20,0x78,0x01,0x13,0x0d,
+0x48,0x03,0x50,0x0d,0xf8,0x77,0x77,0x7c,0x08,0x00,0x40,0xf9,0x88,0x88,0x8d,0x08,
+0x00,0x40,0xfd,0xdd,0xdd,0xdf,0x08,0x00,0x57,0xf4,0x33,0x33,0x3b,0xf6,0x28,0x00,
+0x48,0xf3,0x11,0x11,0x1a,0x10,0x00,0xe3,0xf6,0x55,0x55,0x5b,0xf6,0x00,0x0b,0xbf,
+0xfc,0xbb,0xbb,0xbe,0xfd,0xb5,0x08,0x04,0xf0,0x05,0xf7,0x00,0x04,0xcf,0x50,0x02,
+0xee,0x81,0x00,0x05,0xcf,0xfb,0x20,0x00,0x6e,0xff,0x81,0x0b,0xfb,0x40,0xf0,0x01,
+0x21,0xe3,0x00,0x78,0x00,0x00,0xee,0x03,0x31,0x0c,0xf0,0x7f,0x04,0x01,0x02,0x08,
+0x00,0x80,0x01,0xbb,0xbf,0xfb,0xdf,0xcb,0xb8,0x00,0x4e,0x05,0x00,0x28,0x02,0xd0,
+0x01,0xfc,0x0c,0xf0,0x8f,0x52,0xfc,0x00,0x01,0xfb,0x0c,0xf0,0x7f,0x08,0x00,0x04,
+0x18,0x00,0x56,0xff,0xcf,0xfc,0xef,0xdd,0x18,0x00,0x13,0x02,0x28,0x00,0x12,0xaf,
+0x78,0x00,0xf0,0x0c,0xf3,0x8b,0xbb,0xdd,0xbb,0xbc,0xfc,0xbb,0xb2,0x00,0x06,0xff,
+0x50,0x0b,0xfc,0x40,0x00,0x17,0xdf,0xf9,0x00,0x02,0xbf,0xfb,0x20,0x3e,0xfa,0x60,
+0x02,0x34,0xef,0x60,0x02,0xf8,0x00,0xf4,0x08,0x01,0x71,0x00,0x00,0x07,0x30,0x00,
+0x00,0x0a,0xfc,0x00,0x00,0x9f,0xc0,0x00,0x07,0x78,0xff,0x97,0x78,0xff,0x87,0x70,
+0xd0,0x01,0x82,0x01,0x11,0x1b,0xf3,0x7f,0x71,0x11,0x10,0x59,0x00,0xf2,0x04,0xfa,
+0x00,0x00,0x57,0x7d,0xf8,0xaf,0xb8,0xfb,0x00,0x2a,0xaa,0xae,0xfb,0xcf,0xcb,0xfe,
+0xa2,0x3f,0x28,0x00,0x20,0xf4,0x00,0x28,0x00,0x50,0x73,0xfb,0x00,0x00,0xdf,0x0f,
+0x00,0xf1,0x15,0xfb,0x00,0x00,0x47,0xff,0xf7,0x9f,0xfe,0x74,0x00,0x00,0x6f,0xfe,
+0xf2,0x6f,0xcf,0xe6,0x00,0x2e,0xfd,0x3a,0xf2,0x6f,0x63,0xdf,0xf2,0x07,0x60,0x0a,
+0xf2,0x6f,0x60,0x06,0x60,0x00,0x00,0x37,0x08,0x0a,0x07,0x00,0x82,0xae,0xee,0xee,
+0xff,0xee,0xee,0xe2,0xcf,0xb3,0x01,0xb1,0xcf,0x20,0x04,0xfa,0x00,0x0b,0xf2,0xcf,
+0x20,0x07,0xf9,0x07,0x00,0x30,0x0c,0xff,0x60,0x07,0x00,0xf0,0x0d,0x6f,0xde,0xf7,
+0x0b,0xf2,0xcf,0x25,0xff,0x32,0xef,0x6b,0xf2,0xcf,0xaf,0xf5,0x00,0x3f,0xec,0xf2,
+0xcf,0x3b,0x30,0x00,0x04,0x2b,0xf2,0xcf,0x20,0x47,0x01,0x01,0x07,0x00,0x50,0x2e,
+0xef,0xf0,0xcf,0x20,0xbd,0x01,0xf9,0x0d,0x70,0x00,0x6b,0xbb,0xb6,0x2b,0xbb,0xbb,
+0x10,0x00,0x8f,0xff,0xf8,0x3f,0xff,0xff,0x10,0x00,0x8f,0x55,0xf8,0x3f,0x90,0xcf,
+0x10,0x00,0x8f,0x44,0x08,0x00,0x83,0x01,0x9f,0x55,0xf9,0x5f,0xa1,0xcf,0x31,0x31,
+0x02,0xf6,0x28,0xf9,0x2b,0xef,0xcc,0xfe,0xdf,0xdb,0xff,0xc7,0x00,0xbf,0x14,0xf8,
+0x6f,0x60,0xcf,0x10,0x00,0xdf,0x04,0xf8,0x8f,0x40,0xcf,0x10,0x01,0xfc,0x04,0xf8,
+0xbf,0x20,0xcf,0x10,0x06,0xf8,0x04,0xfa,0xfe,0x00,0xcf,0x10,0x1e,0xf2,0xac,0xff,
+0xf9,0x5b,0xff,0x10,0x09,0x90,0xaf,0xc4,0xd1,0x2f,0x71,0x03,0x11,0xef,0x47,0x00,
+0xa0,0xfe,0xef,0xbc,0xcb,0xbb,0xbb,0xbc,0xfe,0xef,0x09,0xc5,0x04,0x80,0xfe,0x89,
+0x0c,0xfa,0x99,0x99,0x97,0x98,0x2e,0x03,0x00,0x04,0x04,0x21,0x2f,0xc0,0x2b,0x00,
+0x83,0x5f,0xd9,0x99,0x99,0x99,0x50,0x00,0x9f,0xc2,0x02,0x00,0x7c,0x04,0x90,0x50,
+0x6b,0xbb,0xbb,0xbb,0xb2,0xbf,0x30,0x9f,0x5c,0x01,0x12,0xdf,0x22,0x01,0x10,0xfd,
+0x06,0x00,0x31,0x7b,0xbe,0xf8,0x05,0x05,0x24,0xfe,0xa1,0x69,0x00,0x10,0x01,0xe8,
+0x00,0x52,0xf0,0x00,0x00,0x1d,0xe1,0x08,0x00,0x22,0x0b,0xfb,0x08,0x00,0xb2,0x01,
+0xef,0x51,0x22,0x2e,0xf2,0x22,0x20,0x00,0x6f,0x8b,0x52,0x08,0xe6,0x06,0x0b,0xfa,
+0x9f,0xfa,0x9e,0xf1,0x00,0x00,0x0b,0xf1,0x0d,0xf0,0x0d,0x08,0x00,0xa2,0x03,0x0b,
+0xf2,0x1d,0xf2,0x1d,0xf1,0x00,0x1e,0xbb,0x28,0x00,0xf2,0x02,0x8f,0x8b,0xfa,0xaf,
+0xfa,0xaf,0xf1,0x02,0xfe,0x06,0x90,0x0d,0xf0,0x06,0x70,0x0c,0xf6,0x50,0x00,0x22,
+0x2f,0xd0,0x08,0x00,0x21,0x02,0x30,0x08,0x00,0x00,0x01,0x00,0x10,0x12,0xc6,0x02,
+0xf2,0x0c,0x18,0x30,0x00,0xaf,0x46,0xf8,0x00,0x00,0x5f,0xd0,0x02,0xfe,0x01,0xef,
+0x20,0x00,0x0c,0xf6,0x08,0xfe,0xaa,0xef,0xba,0xa0,0x05,0xfe,0x2f,0x0a,0x07,0x51,
+0x94,0xbf,0xf1,0x00,0xfd,0x82,0x05,0x81,0xfa,0x9a,0xff,0x99,0x60,0x00,0x0a,0xec,
+0x2a,0x08,0x32,0x00,0x44,0x2a,0x18,0x00,0xa1,0xbf,0x5a,0xfa,0x99,0xfe,0x99,0x60,
+0x01,0xff,0x0a,0x18,0x00,0x40,0x07,0xfa,0x0a,0xf2,0x18,0x00,0xb1,0x0e,0xf4,0x0a,
+0xf3,0x11,0xfd,0x11,0x10,0x5f,0xe0,0x0a,0xd2,0x02,0x82,0x18,0x70,0x0a,0xfa,0x99,
+0x99,0x99,0x92,0x21,0x01,0x40,0x5b,0x00,0x1a,0x40,0x39,0x06,0x40,0x7f,0xb0,0x1f,
+0xb0,0x08,0x00,0x51,0x28,0x90,0x0b,0xf2,0x9f,0x8b,0x03,0xf6,0x48,0x05,0xf7,0x9f,
+0xa9,0x99,0xcf,0xb9,0x94,0x01,0xf9,0x9f,0x47,0x77,0x7f,0x43,0x61,0x00,0x20,0x9f,
+0x7e,0xee,0x7f,0x5a,0xf1,0x00,0x00,0xaf,0x23,0x33,0x4f,0x7f,0xb0,0x00,0x93,0xbf,
+0x7f,0xff,0x7f,0xdf,0x50,0x02,0xf9,0xcd,0x7f,0x3f,0x5f,0xfd,0x00,0x07,0xf4,0xdc,
+0x7e,0x0e,0x5d,0xf5,0x00,0x0d,0xf1,0xfa,0x7f,0xff,0x6e,0xf2,0x93,0x3f,0xa4,0xf7,
+0x7f,0x89,0xef,0xf9,0xe7,0x4d,0x4b,0xf2,0x13,0x4e,0xf6,0xef,0xf3,0x00,0x06,0xa0,
+0x00,0x1b,0x30,0x4d,0x6a,0x05,0x01,0x83,0x03,0x01,0x08,0x00,0x31,0xdd,0xdd,0xff,
+0xf4,0x0b,0x3f,0x00,0x00,0xef,0x08,0x00,0x08,0x22,0x02,0xfd,0x08,0x00,0x22,0x04,
+0xfc,0x08,0x00,0x22,0x07,0xf8,0x08,0x00,0xf0,0x12,0x0c,0xf5,0x00,0x00,0xef,0x01,
+0x92,0x00,0x4f,0xe0,0x00,0x00,0xef,0x02,0xfa,0x01,0xdf,0x80,0x00,0x00,0xef,0x13,
+0xf8,0x1c,0xfd,0x10,0x00,0x00,0xcf,0xee,0xf5,0x0b,0xe2,0xf5,0x05,0x45,0xff,0xb0,
+0x00,0x10,0x92,0x07,0x16,0xfe,0x07,0x00,0x7b,0x0f,0xf0,0x03,0xfe,0x00,0x3f,0xd0,
+0x07,0x00,0x62,0xf1,0x03,0xfe,0x00,0x4f,0xd0,0xbc,0x03,0xf1,0x01,0xd0,0x0c,0xcc,
+0xcd,0xff,0xcc,0xcc,0xa0,0xce,0x40,0x03,0xfe,0x00,0x09,0xe7,0xdf,0x07,0x00,0x1b,
+0xf8,0x07,0x00,0x81,0xdb,0xbc,0xff,0xbb,0xbe,0xf8,0xdf,0xff,0x2d,0x06,0x01,0xa2,
+0x0a,0x20,0x2a,0xf8,0x1b,0x07,0x03,0xdb,0x07,0x02,0x08,0x00,0x55,0x11,0x11,0x1e,
+0xf3,0x11,0x03,0x06,0x94,0x10,0x00,0xcc,0xcc,0xcf,0xfc,0xcc,0xcc,0x10,0x20,0x00,
+0x21,0x2c,0xcc,0x13,0x06,0x14,0xc2,0x6b,0x05,0xfe,0x01,0x01,0x33,0x11,0x1e,0xf2,
+0x11,0x43,0x10,0x00,0xdf,0x30,0x0e,0xf1,0x01,0xfd,0x00,0x08,0x00,0x53,0xa9,0x9f,
+0xfa,0x9a,0xfd,0x2b,0x04,0x98,0xfd,0x00,0x00,0x33,0x33,0x33,0x33,0x35,0xfd,0x5f,
+0x01,0x00,0xb9,0x06,0xf2,0x3e,0xbb,0xbb,0xbb,0xff,0xe4,0x00,0x34,0x00,0x00,0x6d,
+0xf9,0x10,0x54,0xdf,0x16,0x00,0xef,0x21,0x82,0xfc,0xdf,0x7f,0xa0,0xee,0x0a,0xf7,
+0xfc,0xdf,0x1a,0xf5,0xef,0x8f,0x91,0xfc,0xdf,0x10,0x77,0xff,0xfc,0x01,0xfc,0xdf,
+0x14,0xdf,0xff,0xef,0x41,0xfc,0xdf,0xaf,0xf5,0xee,0x3f,0xf5,0xfc,0xdf,0x7c,0x31,
+0xfe,0x04,0xf7,0xfc,0xdf,0x10,0x8f,0xfc,0x00,0x21,0xfc,0xdf,0x10,0x29,0x71,0x00,
+0x01,0xfc,0xdf,0x36,0x05,0xd1,0xab,0xbb,0xbb,0xbb,0xbb,0xbc,0xfc,0x00,0x00,0x14,
+0x00,0x00,0x40,0x47,0x02,0x23,0xc0,0x09,0xe4,0x07,0x23,0x01,0xff,0x04,0x05,0xe0,
+0x7f,0xd0,0x00,0x00,0x6f,0xf2,0x00,0x00,0x0c,0xfb,0x00,0x05,0xff,0x70,0x47,0x03,
+0x30,0xa0,0x2f,0xff,0x23,0x07,0x41,0xff,0xf3,0x05,0xae,0xd3,0x05,0x52,0x40,0x00,
+0x00,0x07,0xfa,0x1e,0x0a,0x22,0x0a,0xf6,0x08,0x00,0x22,0x2f,0xf1,0x8e,0x09,0x21,
+0xbf,0xa0,0x27,0x03,0xf4,0x06,0x3c,0xfe,0x10,0x00,0x6f,0xb0,0x00,0x0a,0xff,0xe2,
+0x01,0xed,0xff,0x70,0x00,0x04,0xf9,0x10,0x00,0xcf,0xfa,0x58,0x08,0x00,0x1a,0x07,
+0x10,0x10,0x6b,0x01,0x51,0x20,0x00,0xcf,0x10,0x6f,0x72,0x03,0xf1,0x17,0xcf,0x10,
+0x4a,0xbf,0xfa,0xaf,0xf1,0x00,0xcf,0x68,0x80,0x2f,0xc0,0x0d,0xf0,0x6c,0xff,0xff,
+0xe0,0x2f,0xb0,0x0e,0xf0,0x7f,0xff,0x63,0x00,0x3f,0xa0,0x0e,0xf0,0x00,0xcf,0x10,
+0x00,0x5f,0x90,0x0f,0x08,0x00,0xf0,0x15,0x8f,0x50,0x0f,0xe0,0x00,0xcf,0x15,0x80,
+0xcf,0x20,0x1f,0xd0,0x00,0xdf,0xff,0xe3,0xfe,0x00,0x2f,0xd0,0x06,0xff,0xd7,0x0b,
+0xf7,0x00,0x4f,0xb0,0x01,0xd5,0x00,0x8f,0xe0,0x00,0x8f,0x90,0x74,0x07,0xbb,0x40,
+0xde,0xff,0x50,0x00,0x00,0x04,0xe4,0x00,0x9f,0xe9,0xfa,0x07,0x31,0x0d,0xf1,0x2f,
+0x11,0x07,0xf0,0x00,0x0d,0xf1,0x2c,0xdf,0xfc,0xcc,0xc3,0xfb,0x0d,0xf1,0x00,0x4f,
+0xa0,0x00,0x01,0x08,0x00,0x70,0x9f,0xb6,0x67,0x31,0xfb,0x0d,0xf1,0xbc,0x04,0xf0,
+0x09,0xb1,0xfb,0x0d,0xf1,0x06,0xfc,0x55,0x9f,0x71,0xfb,0x0d,0xf1,0x1e,0xf4,0x00,
+0xaf,0x41,0xfb,0x0d,0xf1,0x3f,0xb9,0xa1,0xff,0x28,0x00,0x41,0x03,0x2e,0xfe,0xf8,
+0x30,0x00,0x31,0x01,0xdf,0xf1,0x08,0x00,0xa1,0x00,0xcf,0x80,0x00,0x32,0x0d,0xf1,
+0x00,0x2d,0xfa,0x60,0x00,0xa0,0x09,0xff,0xb0,0x00,0x00,0x0c,0xdf,0xf0,0x05,0xe5,
+0x23,0x01,0xa0,0xfd,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x00,
+0x11,0x00,0x01,0x00,0xf1,0x30,0x09,0xf3,0x00,0x00,0x01,0xfc,0x00,0x03,0xff,0xa0,
+0x00,0x86,0x1f,0xc0,0x01,0xef,0xbf,0xa0,0x1f,0xb1,0xfc,0x02,0xef,0x70,0xbf,0x91,
+0xfb,0x1f,0xc3,0xef,0x90,0x01,0xdf,0x7f,0xb1,0xfc,0x3f,0xfb,0xaa,0xac,0xb2,0xfb,
+0x1f,0xc0,0x2d,0xff,0xff,0xf4,0x1f,0xb1,0xfc,0x00,0xdf,0x00,0x9f,0x31,0xfb,0x1f,
+0xc0,0x0d,0xf0,0x0c,0xf1,0x0f,0x00,0x30,0x4e,0xfe,0x01,0x0f,0x00,0x50,0xf1,0xa9,
+0x44,0x04,0x31,0x1e,0x00,0xf1,0x05,0x03,0xf7,0x00,0x1f,0xc0,0x0b,0xfb,0x99,0xdf,
+0x47,0x9a,0xfb,0x00,0x4d,0xff,0xff,0xa0,0x7f,0xff,0x50,0x6d,0x00,0x51,0x32,0x00,
+0x00,0x07,0x10,0x0a,0x00,0xf2,0x5a,0x05,0xfb,0x00,0x66,0x66,0x66,0x66,0x00,0x0b,
+0xd1,0x0f,0xff,0xff,0xff,0xe1,0xff,0xff,0xf6,0x67,0xfe,0x66,0xfe,0x0b,0xbb,0xef,
+0x50,0x1f,0xc0,0x0f,0xe0,0x00,0x2f,0xc0,0x02,0xfb,0x00,0xfd,0x00,0x0d,0xf5,0x91,
+0x3f,0xa0,0x0f,0xd0,0x0a,0xff,0xbe,0x36,0xf8,0x00,0xfc,0x0b,0xff,0xff,0x50,0x9f,
+0x50,0x1f,0xc4,0xfe,0xff,0xee,0x1d,0xf2,0x02,0xfb,0x0a,0x2f,0xe4,0xb3,0xfd,0x00,
+0x3f,0xa0,0x01,0xfe,0x00,0xbf,0x70,0x04,0xf9,0x00,0x1f,0xe0,0x7f,0xf0,0x00,0x8f,
+0x70,0x01,0xfe,0x2f,0xf5,0x1e,0xef,0xf3,0x00,0x1f,0xe0,0x57,0x00,0xbe,0xd6,0x00,
+0x01,0x00,0xfe,0x09,0x08,0xf1,0x04,0xff,0xfa,0xaf,0xff,0x40,0x08,0xf1,0x04,0xfb,
+0xfa,0xaf,0xbf,0x4b,0xa8,0xf1,0x04,0xf4,0xda,0xad,0x4f,0x4b,0x08,0x00,0xf1,0x0f,
+0x1a,0xf9,0xed,0xde,0x9f,0x8b,0xa8,0xf1,0x2f,0xff,0xff,0xff,0xff,0xdb,0xa8,0xf1,
+0x07,0xf7,0xeb,0xce,0x7f,0x6b,0xa8,0xf1,0x05,0xf3,0xda,0xbc,0x4f,0x4b,0x08,0x00,
+0x10,0xcb,0x08,0x00,0xf0,0x0e,0x06,0xf2,0xda,0xda,0x4f,0x44,0x48,0xf1,0x09,0xf0,
+0xdb,0xf8,0x4f,0x40,0x08,0xf1,0x0d,0xd9,0xfe,0xfa,0xbf,0x33,0x7c,0xf0,0x1d,0x6d,
+0xe8,0xe5,0xfb,0x4e,0x01,0x01,0x01,0x00,0x25,0x21,0x00,0x01,0x00,0xf0,0x28,0x01,
+0x7d,0xb0,0x00,0x00,0xef,0x04,0x8c,0xff,0xff,0x30,0x00,0x0e,0xf0,0xff,0xff,0xf5,
+0x00,0x4d,0x70,0xef,0x04,0x31,0xfd,0x00,0x05,0xf8,0x0e,0xf0,0x00,0x1f,0xe0,0x00,
+0x5f,0x80,0xef,0x1f,0xff,0xff,0xff,0xb5,0xf8,0x0e,0xf0,0xbb,0xdf,0xfb,0xb8,0x5f,
+0x80,0xef,0x00,0x0c,0xff,0x30,0x1e,0x00,0xf0,0x43,0x05,0xff,0xff,0x50,0x5f,0x80,
+0xef,0x01,0xee,0xfe,0xef,0x55,0xf8,0x0e,0xf0,0xcf,0x6f,0xd2,0xe2,0x5f,0x80,0xef,
+0x3f,0xb0,0xfd,0x01,0x00,0x10,0x0e,0xf0,0xa1,0x0f,0xd0,0x00,0x00,0x00,0xff,0x00,
+0x00,0xfd,0x00,0x00,0x9f,0xff,0xd0,0x00,0x0f,0xd0,0x00,0x04,0xfe,0xb3,0x0a,0xff,
+0xff,0xff,0x00,0x00,0x1f,0xc0,0xaf,0xaa,0xaf,0xf0,0x2d,0x81,0xfc,0x0a,0xf0,0x00,
+0xdf,0x03,0xfa,0x1f,0xc0,0xaf,0x10,0x0e,0xf0,0x3f,0xa1,0xfc,0x1e,0x00,0x00,0x0f,
+0x00,0xf0,0x13,0x7b,0xbb,0xbb,0xa0,0x3f,0xa1,0xfc,0x00,0x0b,0xf1,0x00,0x03,0xfa,
+0x1f,0xc1,0xff,0xff,0xff,0xf6,0x3f,0xa1,0xfc,0x19,0x9f,0xf9,0xdf,0x53,0xfa,0x1f,
+0xc0,0x02,0xfb,0x09,0xf4,0x1e,0x00,0xf2,0x0e,0x8f,0x70,0xaf,0x30,0x21,0x1f,0xc0,
+0x2e,0xf1,0x0d,0xf2,0x00,0x01,0xfc,0x3e,0xf7,0x8c,0xff,0x00,0x2c,0xdf,0xb2,0xe7,
+0x06,0xfe,0x60,0x00,0xff,0xf5,0xdd,0x00,0x13,0x10,0xe6,0x00,0x20,0x0f,0xd0,0x38,
+0x01,0xf0,0x25,0x50,0x00,0xfd,0x0a,0xaf,0xfa,0xbb,0xa4,0xfb,0x0f,0xd0,0x05,0xfa,
+0x1e,0xa0,0x0f,0xb0,0xfd,0x00,0xdf,0x20,0xcf,0x40,0xfb,0x0f,0xd0,0x7f,0xfc,0xce,
+0xfc,0x0f,0xb0,0xfd,0x04,0xff,0xdb,0xac,0xe2,0xfb,0x0f,0xd0,0x01,0x08,0xb1,0x10,
+0x0f,0xb0,0xfd,0x02,0x44,0xcf,0x64,0x1e,0x00,0xf1,0x0c,0x9f,0xff,0xff,0xff,0x0f,
+0xb0,0xfd,0x03,0x55,0xcf,0x65,0x50,0xfb,0x0f,0xd0,0x00,0x0a,0xf1,0x03,0x19,0x70,
+0xfd,0x02,0x46,0xdf,0xef,0xf3,0x5a,0x00,0xd4,0xeb,0x85,0x12,0xcd,0xfc,0x07,0x74,
+0x10,0x00,0x00,0x0e,0xfc,0x40,0x59,0x01,0x90,0x83,0x8f,0x40,0x00,0x00,0x09,0xd1,
+0x03,0xfb,0x08,0x00,0xf1,0x12,0x0b,0xf1,0x06,0xfa,0xaf,0x73,0x30,0x8f,0x3b,0xf1,
+0x0c,0xff,0xff,0xff,0xf2,0x8f,0x3b,0xf1,0x2f,0xd7,0xcf,0xa7,0x71,0x8f,0x3b,0xf1,
+0x1c,0xa5,0xaf,0x85,0x54,0x8f,0x3b,0xd9,0x01,0xf0,0x06,0xfc,0x8f,0x3b,0xf1,0x06,
+0x66,0xbf,0x86,0x64,0x8f,0x3b,0xf1,0x03,0x66,0xbf,0x96,0x62,0x8f,0x3b,0xf1,0x08,
+0xfd,0x00,0x00,0x08,0x00,0xe0,0xf5,0xaf,0x77,0xf6,0x7f,0x3b,0xf1,0x08,0xf2,0x8f,
+0x44,0xf6,0x00,0x0b,0x08,0x00,0x40,0x79,0xf5,0x00,0x0c,0x08,0x00,0xe9,0x8f,0xf2,
+0x0b,0xdf,0xf0,0x00,0x10,0x8f,0x42,0x00,0x08,0xfd,0x60,0x00,0x01,0x00,0x31,0x0e,
+0xd0,0x9f,0xf8,0x00,0xf1,0x05,0xed,0x09,0xfb,0xaa,0xad,0xf5,0xaf,0x0e,0xd0,0x9f,
+0x32,0x22,0x8f,0x5a,0xf0,0xed,0x09,0xff,0xff,0xff,0x0f,0x00,0xf0,0x19,0x65,0x9b,
+0x55,0x1a,0xf0,0xed,0x09,0xf0,0x09,0xf0,0x00,0xaf,0x0e,0xd0,0xaf,0xdf,0xff,0xff,
+0x6a,0xf0,0xed,0x0b,0xfd,0xee,0xfc,0xf6,0xaf,0x0e,0xd0,0xce,0xd8,0x9f,0x1f,0x6a,
+0xf0,0xed,0x0d,0xcd,0x89,0xf1,0x0f,0x00,0xf4,0x0f,0xf9,0xd8,0x9f,0x1f,0x62,0x40,
+0xed,0x3f,0x6d,0x89,0xf9,0xf5,0x00,0x0f,0xd9,0xf1,0xb7,0x9f,0x7a,0x00,0xde,0xfb,
+0x16,0x00,0x09,0xf0,0x00,0x0b,0xfc,0x30,0x73,0x00,0xf5,0x5a,0x17,0x10,0x05,0xe7,
+0x00,0x01,0xfc,0x05,0xef,0xa8,0xfc,0x12,0xe8,0x1f,0xc0,0x01,0xaf,0xff,0x20,0x3f,
+0x91,0xfc,0x02,0xaf,0xfd,0xfe,0x53,0xf9,0x1f,0xc2,0xff,0xb5,0x36,0xf9,0x3f,0x91,
+0xfc,0x04,0x30,0xcf,0x01,0x03,0xf9,0x1f,0xc1,0xcc,0xcf,0xfc,0xcc,0x3f,0x91,0xfc,
+0x1d,0xdd,0xff,0xdd,0xd3,0xf9,0x1f,0xc0,0x05,0x1c,0xf3,0x70,0x3f,0x91,0xfc,0x01,
+0xf9,0xcf,0x8f,0x43,0xf9,0x1f,0xc0,0xaf,0x3c,0xf1,0xed,0x00,0x01,0xfc,0x5f,0xb0,
+0xcf,0x08,0xf4,0x00,0x1f,0xc0,0x92,0x9f,0xf0,0x14,0x00,0xbc,0xfb,0x00,0x0c,0xe8,
+0x00,0x00,0x0c,0xfd,0x40,0xe5,0x00,0xf1,0x09,0x40,0x00,0x00,0x05,0x10,0x00,0x00,
+0x0c,0xf8,0x00,0x00,0x6f,0xe0,0x00,0x00,0x03,0xfe,0x10,0x01,0xef,0x50,0x00,0x3f,
+0xff,0x01,0x00,0x31,0xf3,0x2a,0xaa,0x01,0x00,0xf1,0x06,0xa2,0x02,0x55,0x55,0x55,
+0x00,0x00,0x7f,0x50,0x05,0xff,0xff,0xff,0x0a,0xf1,0x7f,0x60,0x05,0xfa,0x66,0xef,
+0x08,0x00,0x22,0xfc,0x99,0x10,0x00,0x22,0xfe,0xcc,0x08,0x00,0x22,0xf8,0x22,0x18,
+0x00,0x04,0x28,0x00,0xf5,0x07,0xf8,0x33,0xef,0x05,0x70,0x7f,0x60,0x05,0xf6,0x48,
+0xfe,0x00,0x7b,0xef,0x40,0x05,0xf6,0x3f,0xf7,0x00,0x4f,0xfa,0x7e,0x00,0x10,0x1f,
+0xb9,0x01,0xf0,0x09,0x00,0x0c,0xf0,0x09,0x99,0x99,0x99,0x97,0x6b,0x1c,0xf0,0x01,
+0x77,0x77,0x77,0x70,0x8f,0x1c,0xf0,0x03,0xff,0xff,0xff,0xf1,0x08,0x00,0x47,0xf7,
+0x00,0x0b,0xf1,0x10,0x00,0x04,0x20,0x00,0xd0,0x08,0xaa,0xaa,0xaa,0xa7,0x8f,0x1c,
+0xf0,0x0c,0xfc,0xef,0xdd,0xfa,0x08,0x00,0x30,0xf2,0x8f,0x64,0x08,0x00,0x00,0x21,
+0x02,0xf1,0x04,0xfa,0x36,0x0c,0xf0,0x0c,0xf3,0x8f,0x65,0xfa,0x00,0x0d,0xf0,0x0c,
+0xf7,0xbf,0x99,0xfa,0x2e,0xef,0x18,0x00,0x48,0xe9,0x0e,0xfd,0x50,0xdf,0x01,0x80,
+0x0b,0xf3,0x00,0x00,0x02,0x22,0x22,0x20,0x08,0x00,0x45,0x2f,0xff,0xff,0xd0,0x08,
+0x00,0x70,0xf4,0x00,0x00,0x01,0x2f,0xd1,0x1e,0x00,0x01,0x00,0xf4,0x04,0x30,0xcf,
+0xfc,0xce,0x08,0x00,0x50,0x00,0x0d,0xf0,0x0b,0xf2,0x08,0x00,0x40,0x0f,0xe0,0x0c,
+0xf1,0x08,0x00,0x20,0x2f,0xc0,0x08,0x00,0xf5,0x1f,0xe8,0xc0,0x7f,0x80,0x0d,0xf0,
+0x29,0xdf,0xff,0xf3,0xdf,0x30,0x0e,0xf0,0x2f,0xfd,0x95,0x18,0xfd,0x00,0x0f,0xe0,
+0x06,0x20,0x00,0x6f,0xf3,0x00,0x4f,0xb0,0x00,0x00,0x08,0xff,0x70,0xcd,0xff,0x80,
+0x00,0x00,0x03,0xe5,0x00,0x9f,0xfb,0x10,0x7d,0x00,0x21,0x3f,0xb0,0x07,0x00,0x23,
+0x03,0xfa,0x0f,0x00,0x10,0xa0,0x7b,0x00,0x80,0xe2,0xcd,0xff,0xdd,0xd3,0xff,0xff,
+0xfe,0xcf,0x02,0xf0,0x08,0x3f,0xc0,0x1f,0xe0,0x05,0xf9,0x0d,0xf3,0xfc,0x01,0xfe,
+0x00,0x7f,0x70,0xef,0x2f,0xc0,0x1f,0xe0,0x08,0xf6,0x0e,0xf2,0x0f,0x00,0x30,0xaf,
+0x40,0xfe,0x0f,0x00,0x40,0x0c,0xf1,0x0f,0xd2,0x0f,0x00,0x30,0xff,0x02,0xfc,0x0f,
+0x00,0xf6,0x0f,0x4f,0xa0,0x4f,0xa2,0xfc,0x01,0xfe,0x0b,0xf5,0x08,0xf8,0x2f,0xfe,
+0xef,0xe4,0xfe,0x7f,0xff,0x42,0xff,0xff,0xfe,0x2d,0x52,0xfe,0x90,0x2f,0xb0,0x1d,
+0xc0,0x7a,0x00,0x00,0x1a,0x06,0x50,0x00,0x00,0x11,0x11,0x10,0x08,0x00,0x40,0x09,
+0xff,0xff,0xfa,0x08,0x00,0x62,0x05,0x99,0x99,0x95,0x01,0xfc,0x20,0x00,0xf7,0x44,
+0xdf,0xff,0xff,0xf3,0x1a,0xaa,0xaa,0xaa,0x9b,0xfe,0xae,0xf3,0x2f,0xff,0xff,0xfe,
+0x04,0xf9,0x0a,0xf2,0x00,0x5f,0xa0,0x00,0x05,0xf8,0x0b,0xf2,0x00,0x8f,0x44,0xd2,
+0x07,0xf6,0x0b,0xf1,0x00,0xde,0x02,0xf8,0x0a,0xf3,0x0c,0xf1,0x03,0xfa,0x37,0xfe,
+0x1f,0xf0,0x0d,0xf0,0x0b,0xff,0xff,0xff,0xaf,0xb0,0x0f,0xe0,0x0c,0xfc,0x73,0x28,
+0xff,0x40,0x2f,0xc0,0x03,0x10,0x00,0x09,0xfc,0x7d,0xff,0x90,0x00,0x00,0x00,0x02,
+0xd2,0x3f,0xfc,0x7e,0x00,0x12,0x89,0xec,0x02,0x32,0x02,0xff,0x30,0x85,0x01,0x10,
+0xff,0x60,0x02,0x31,0x20,0x00,0x6f,0x70,0x02,0xf0,0x17,0x20,0x04,0xff,0x51,0x11,
+0x11,0x11,0xcf,0x20,0x4f,0xff,0x99,0x99,0x98,0x00,0xdf,0x10,0x09,0xaf,0xff,0xff,
+0xfd,0x00,0xdf,0x10,0x00,0x0f,0xe0,0x01,0xfd,0x00,0xef,0x00,0x00,0x0f,0xe1,0x12,
+0xfd,0x18,0x05,0xf0,0x0b,0x0f,0xff,0xff,0xfd,0x25,0xfd,0x00,0x00,0x0f,0xf9,0x99,
+0x98,0xdf,0xf9,0x00,0x00,0x0f,0xe0,0x00,0x00,0x69,0x73,0x30,0x00,0x0e,0xf1,0x00,
+0x07,0xf0,0x00,0xf5,0x00,0x0b,0xfe,0xcc,0xcc,0xcc,0xdf,0xf2,0x00,0x02,0xae,0xff,
+0xff,0xff,0xf8,0x01,0x13,0x64,0x69,0x01,0x11,0xf3,0x07,0x00,0x82,0x0d,0xff,0xcc,
+0xcc,0xcc,0xcc,0xc0,0x08,0xe7,0x02,0x30,0x08,0xff,0x40,0xe7,0x04,0xf0,0x28,0xe6,
+0xff,0xa0,0x10,0x8e,0x23,0x20,0xfe,0x0e,0xff,0xae,0x5e,0xc1,0xfa,0x0f,0xe0,0x2a,
+0xf4,0xdf,0xf5,0x1f,0xa0,0xfd,0x00,0x9f,0x15,0xff,0xb2,0xfa,0x1f,0xd0,0x09,0xf4,
+0xfe,0xaf,0xaf,0xa2,0xfc,0x00,0x9f,0x5d,0x30,0x72,0xfa,0x3f,0xb0,0x09,0xfc,0xbb,
+0xbb,0xcf,0xa5,0xfa,0x00,0x9f,0x73,0x02,0x20,0x7f,0x80,0x56,0x00,0x31,0x0c,0xcf,
+0xf4,0x5e,0x00,0x26,0xaf,0xe9,0xf0,0x00,0x04,0xfb,0x00,0x40,0xdf,0x40,0xff,0x10,
+0x24,0x07,0x21,0xfe,0x00,0x08,0x00,0xf0,0x09,0x0d,0xf7,0x00,0xff,0x10,0x1d,0x40,
+0x00,0x7f,0xf0,0x00,0xff,0x10,0xbf,0xd0,0x03,0xff,0xe0,0x00,0xff,0x18,0xff,0x30,
+0x2e,0x08,0x00,0xf0,0x02,0x8f,0xf5,0x00,0x2f,0xef,0xe0,0x00,0xff,0xff,0x70,0x00,
+0x07,0x4f,0xe0,0x00,0xff,0xf6,0x29,0x03,0x40,0xe0,0x4d,0xff,0x60,0x08,0x00,0xf0,
+0x07,0xfa,0xff,0xff,0x10,0x01,0x00,0x00,0x1f,0xe8,0xf8,0xff,0x10,0x09,0xb2,0x00,
+0x1f,0xe0,0x10,0xff,0x10,0x0a,0xf3,0x6c,0x06,0x40,0xff,0x20,0x0d,0xf1,0x08,0x00,
+0x40,0xcf,0xfe,0xef,0xd0,0x08,0x00,0x51,0x4d,0xff,0xfd,0x30,0xcf,0xe0,0x00,0xf0,
+0x03,0xfc,0x0c,0xfd,0xde,0xfd,0xdf,0xfd,0xdd,0xa0,0xcf,0x10,0xaf,0x30,0xcf,0x10,
+0x00,0x0c,0xf1,0xbc,0x01,0x61,0x00,0x00,0xcf,0x10,0xbf,0x20,0x0f,0x00,0x21,0x0d,
+0xf0,0x0f,0x00,0xf1,0x11,0x11,0xfd,0x00,0xcf,0x10,0x87,0x0c,0xf1,0x7f,0x90,0x0c,
+0xf1,0x0b,0xe0,0xcf,0x6f,0xf2,0x00,0xbf,0xcb,0xfc,0x0c,0xf6,0xf7,0x00,0x04,0xef,
+0xfe,0x40,0xcf,0x14,0x00,0xe4,0x00,0x12,0xf1,0xd0,0x00,0x12,0xcf,0x3b,0x01,0x31,
+0x1a,0xcc,0xcc,0x4a,0x01,0x02,0x0f,0x00,0x31,0xfb,0x0c,0xfd,0x0f,0x00,0x30,0x90,
+0xcf,0x10,0xc5,0x05,0xf0,0x07,0x00,0x0c,0xf1,0x5e,0x40,0x00,0x8f,0xc0,0x00,0xcf,
+0x15,0xff,0x70,0x4f,0xe1,0x00,0x0c,0xf1,0x03,0xef,0xbe,0xf4,0x78,0x00,0x31,0x01,
+0xdf,0xf9,0x4b,0x00,0x30,0x3e,0xff,0xe2,0x0f,0x00,0xf1,0x08,0x6f,0xf9,0xaf,0xf3,
+0x00,0x0c,0xf3,0xbf,0xf7,0x00,0xaf,0xf3,0x00,0xcf,0x3e,0xe4,0x00,0x00,0xae,0x20,
+0x0c,0xf1,0x21,0x3f,0x01,0x21,0xcf,0xdd,0x01,0x00,0x12,0x1b,0x70,0x00,0x17,0xf2,
+0xc1,0x03,0xf0,0x0a,0x6e,0x50,0xaf,0x40,0x00,0x00,0x02,0x7e,0xff,0xe0,0xaf,0x40,
+0x00,0x07,0xdf,0xff,0xe7,0x00,0xaf,0x40,0x00,0x0a,0xfe,0xef,0x40,0x08,0x00,0x31,
+0x02,0x30,0x9f,0x08,0x00,0x24,0x00,0x00,0x08,0x00,0x20,0xaf,0x50,0x03,0x00,0x12,
+0x1f,0x48,0x00,0xa0,0xf8,0x0c,0xcc,0xef,0xdc,0xcc,0xef,0xdc,0xc6,0x00,0x5e,0x02,
+0x00,0x20,0x00,0x31,0x01,0xfe,0x00,0x08,0x00,0x22,0x0a,0xf9,0x08,0x00,0x21,0x8f,
+0xe2,0x08,0x00,0x31,0x0c,0xff,0x40,0x08,0x00,0x32,0x05,0xc2,0x00,0x18,0x00,0x05,
+0xab,0x05,0xf0,0x19,0x00,0x0f,0xf0,0x01,0x83,0x00,0x00,0xaf,0x70,0x0f,0xf0,0x07,
+0xfc,0x00,0x00,0x2f,0xf0,0x0f,0xf0,0x0e,0xf4,0x00,0x00,0x0b,0xf6,0x0f,0xf0,0x6f,
+0xb0,0x00,0x00,0x04,0x60,0x0f,0xf0,0x16,0x20,0x00,0x02,0xcc,0xa7,0x05,0x32,0xcc,
+0x50,0x03,0x78,0x00,0x81,0x60,0x00,0x11,0x11,0x2f,0xf1,0x11,0x11,0x58,0x07,0xc4,
+0xf0,0x00,0x00,0x00,0x2e,0xee,0xee,0xef,0xfe,0xee,0xee,0xe3,0x72,0x05,0x00,0xe4,
+0x01,0x13,0xf0,0x78,0x07,0x0f,0x08,0x00,0x02,0x52,0xcf,0x00,0x00,0x8e,0x20,0x08,
+0x00,0x1a,0x9f,0x08,0x00,0xf0,0x3b,0xaa,0xdf,0xba,0xa3,0x00,0x4c,0xff,0xc7,0xff,
+0xff,0xff,0xf4,0x00,0x5f,0xff,0xf8,0x33,0xbf,0x5b,0xf3,0x00,0x00,0xcf,0x02,0x72,
+0xcf,0x09,0xf9,0x40,0x00,0xcf,0x08,0xf3,0xef,0x0a,0xff,0xb0,0x00,0xcf,0x0d,0xe2,
+0xfb,0x0a,0xfd,0xf0,0x00,0xcf,0x6f,0x86,0xf7,0x0b,0xf9,0xf3,0x00,0xcf,0x2b,0x1d,
+0xf2,0x0c,0xf5,0xf6,0x00,0xcf,0x00,0x6f,0xa0,0x0d,0xf0,0x20,0x00,0xcf,0x04,0xff,
+0x20,0x4e,0x03,0xe7,0xcf,0x3f,0xf5,0x3c,0xef,0xb0,0x00,0x00,0xcf,0x1a,0x60,0x0e,
+0xfd,0x20,0x77,0x01,0x51,0x53,0x00,0x00,0x25,0x10,0x2a,0x06,0x30,0x00,0xaf,0xb0,
+0x60,0x01,0x10,0x80,0x0b,0x00,0x20,0x00,0xbf,0xbf,0x00,0xf3,0x02,0xfe,0x00,0x00,
+0xcf,0xa9,0x9f,0xf9,0x99,0xff,0x00,0x00,0xcf,0x42,0x3f,0xf2,0x23,0xff,0x29,0x02,
+0x00,0x08,0x00,0x56,0x43,0x4f,0xf3,0x34,0xff,0x20,0x00,0x04,0x30,0x00,0x03,0xd8,
+0x00,0x13,0x2f,0x00,0x01,0x8e,0x2b,0xbb,0xbb,0xbf,0xfb,0xbb,0xbb,0xb2,0x00,0x01,
+0x00,0x84,0x04,0x0a,0x08,0x00,0x31,0xec,0xcc,0xc9,0x08,0x00,0x00,0x44,0x06,0x0c,
+0x20,0x00,0x83,0x1e,0xee,0xee,0xff,0xfe,0xee,0xee,0xe6,0xf0,0x01,0x00,0x44,0x03,
+0x22,0x4f,0xb0,0x20,0x00,0x32,0x4f,0xca,0x61,0x08,0x00,0x31,0xef,0xff,0xb4,0x08,
+0x00,0x42,0xb1,0x7d,0xff,0x70,0x20,0x00,0x28,0x5a,0x00,0x28,0x00,0x01,0x08,0x00,
+0x11,0x33,0x01,0x00,0x22,0x10,0x04,0x48,0x00,0x90,0x50,0x03,0xbb,0xbb,0xff,0xcb,
+0xbb,0xef,0x50,0x72,0x01,0x3f,0x40,0x00,0xaf,0x08,0x00,0x0a,0x41,0x44,0xdc,0xff,
+0x30,0x10,0x00,0x32,0xff,0xe9,0x00,0x18,0x00,0x1d,0x00,0x08,0x00,0x0d,0xa8,0x00,
+0x11,0xdf,0x08,0x00,0x16,0xf0,0x08,0x00,0x03,0x1d,0x08,0x0c,0x08,0x00,0x13,0xef,
+0x94,0x01,0x14,0xff,0x08,0x00,0x12,0x10,0xde,0x05,0x22,0xff,0x00,0x5a,0x06,0x12,
+0xfd,0x08,0x00,0x13,0x07,0x62,0x06,0x23,0x0d,0xf6,0x1d,0x01,0x13,0xe0,0x3e,0x0b,
+0x1a,0x70,0xed,0x08,0x13,0x01,0x80,0x00,0x21,0x01,0xff,0x6f,0x03,0x90,0xd5,0x01,
+0xfb,0x00,0x00,0x56,0x10,0x00,0x00,0x08,0x00,0x28,0xcf,0x20,0x08,0x00,0x10,0x7b,
+0x01,0x01,0x40,0x70,0x02,0xfa,0x9f,0x30,0x00,0x10,0x90,0xc2,0x06,0xf0,0x07,0xdf,
+0x31,0x20,0x00,0x03,0xf9,0x00,0x00,0xcf,0x2d,0xe2,0x00,0x05,0xf7,0x00,0x00,0xcf,
+0x25,0xfe,0x10,0x07,0xf5,0x30,0x00,0x42,0x7d,0x20,0x0b,0xf1,0x38,0x00,0x22,0x1f,
+0xe9,0xe0,0x01,0x21,0x2e,0x87,0x60,0x00,0x15,0xd2,0x5e,0x0a,0x02,0x78,0x00,0x90,
+0xf5,0x00,0xff,0xbb,0xbb,0xdd,0xbb,0xbb,0xb3,0xf2,0x0a,0x10,0xef,0x9c,0x00,0x11,
+0xfd,0x12,0x01,0x71,0x10,0x00,0xfd,0x1f,0xe7,0x77,0x77,0x08,0x00,0x72,0xd5,0x55,
+0x55,0xef,0x10,0x01,0xfc,0x18,0x00,0xa2,0x02,0xfb,0x1f,0xd2,0x22,0x22,0xef,0x10,
+0x03,0xfa,0x10,0x00,0xf0,0x18,0x06,0xf7,0x05,0x74,0x6f,0xc4,0x64,0x00,0x09,0xf4,
+0x0b,0xf7,0x2f,0xa9,0xf6,0x00,0x0e,0xf1,0x9f,0xc0,0x2f,0xa1,0xdf,0x70,0x4f,0xa4,
+0xfc,0x3a,0xbf,0xa0,0x2f,0xf2,0x03,0x30,0x21,0x0e,0xfd,0x30,0x03,0x76,0x00,0x12,
+0x73,0x79,0x00,0xb0,0x1b,0xfd,0x17,0xe5,0x00,0x00,0x00,0x06,0xef,0x91,0x06,0xa9,
+0x06,0x11,0xaf,0x2a,0x05,0xf3,0x02,0x10,0x00,0x4c,0xbc,0xfe,0x87,0x66,0xbc,0x20,
+0x29,0x99,0x9d,0xfd,0x99,0x99,0xaa,0x92,0x98,0x03,0xf0,0x1f,0xf4,0x00,0x07,0xff,
+0x31,0x62,0xef,0x60,0x00,0x00,0x9f,0xfb,0xbf,0xf8,0x2e,0xf8,0x00,0x3e,0xfe,0xaf,
+0xd8,0x37,0x53,0xef,0xe4,0x0b,0xa1,0x04,0x6a,0xff,0xa1,0x09,0xc0,0x00,0x01,0xef,
+0xfe,0x92,0x4e,0xa1,0x00,0x00,0x00,0x56,0x22,0x7c,0xab,0x05,0x50,0x28,0x9c,0xff,
+0xfe,0x82,0x46,0x0a,0x31,0xff,0xc8,0x40,0xf2,0x06,0x28,0x10,0x00,0x16,0x06,0x22,
+0x08,0xff,0x70,0x00,0x70,0x07,0xef,0xed,0xdd,0xdd,0xdd,0xfe,0x6e,0x02,0xf0,0x05,
+0x07,0x00,0x08,0xf9,0x00,0x00,0x0d,0xf2,0x9f,0xc0,0x0e,0xf3,0x00,0x00,0x07,0xf9,
+0x0b,0xf8,0x7f,0xc0,0x21,0x01,0x30,0x30,0x71,0xef,0x42,0x00,0x40,0x6f,0xe1,0x0c,
+0xf9,0x3c,0x00,0x42,0x0a,0xfc,0xaf,0xd1,0x0a,0x02,0x21,0xfe,0x20,0x77,0x0d,0x20,
+0xef,0xfe,0x30,0x01,0xf2,0x0a,0x04,0xcf,0xfc,0xbf,0xfe,0x61,0x00,0x29,0xef,0xfe,
+0x50,0x05,0xef,0xff,0xc3,0x1e,0xfd,0x71,0x00,0x00,0x05,0xaf,0xc0,0x04,0x30,0x71,
+0x00,0x13,0x09,0x06,0x03,0x71,0x09,0xef,0xff,0xee,0xef,0xf3,0x00,0xf0,0x04,0x21,
+0x0e,0xf1,0xf9,0x01,0x31,0x30,0x2f,0xe0,0x92,0x07,0xf0,0x1b,0x90,0x6f,0xff,0xfe,
+0x50,0x00,0x03,0xff,0xe0,0x8d,0xdd,0xff,0x40,0x00,0x06,0xff,0xf6,0x00,0x02,0xfe,
+0x00,0x00,0x09,0xfb,0xfe,0x20,0x09,0xf9,0x00,0x00,0x0e,0xf4,0x9f,0xd0,0x3f,0xf2,
+0x00,0x00,0x5f,0xf0,0x1e,0xfb,0x08,0x01,0xf2,0x11,0xdf,0x90,0x02,0xff,0xfb,0x00,
+0x00,0x0a,0xff,0x10,0x08,0xff,0xff,0x92,0x00,0x5f,0xf6,0x29,0xff,0xf8,0xaf,0xff,
+0xd3,0x0b,0x80,0x0d,0xfa,0x20,0x03,0xaf,0xc0,0x01,0xf1,0x00,0x10,0x10,0x62,0x09,
+0x30,0x22,0x22,0x22,0xb1,0x07,0xf0,0x2b,0xf7,0xff,0xff,0xff,0xd0,0x0a,0xaa,0xae,
+0xf4,0xfe,0xaa,0xbf,0xb0,0x00,0x00,0x0d,0xf1,0xee,0x00,0x5f,0x90,0x08,0xc0,0x0f,
+0xe0,0xbf,0x10,0x9f,0x50,0x0c,0xfa,0x4f,0xb0,0x7f,0x50,0xdf,0x20,0x01,0xef,0xdf,
+0x70,0x4f,0xa2,0xfd,0x00,0x00,0x3f,0xff,0x20,0x0e,0xf9,0xf8,0x00,0x00,0x07,0xff,
+0x20,0x08,0xf7,0x05,0x40,0x0c,0xff,0xc0,0x03,0xa8,0x01,0xf2,0x18,0x5f,0xee,0xf6,
+0x08,0xff,0x90,0x00,0x02,0xef,0x56,0xf4,0x7f,0xff,0xf7,0x00,0x2e,0xfb,0x00,0x5c,
+0xff,0x65,0xff,0xa0,0x3f,0xc0,0x00,0x2f,0xe5,0x00,0x6f,0xd1,0x04,0x00,0x00,0x04,
+0x10,0x00,0x03,0x20,0xd5,0x02,0x91,0x30,0x00,0x01,0x23,0x56,0x78,0xbd,0xff,0x70,
+0x4f,0x03,0x91,0xfd,0x96,0x00,0x0d,0xf9,0x75,0x43,0x10,0x00,0xf5,0x05,0x02,0x08,
+0x08,0x01,0xc5,0x02,0xc0,0x00,0xdf,0xef,0xfd,0xdd,0xdf,0xf9,0x00,0x0e,0xf0,0xdf,
+0x10,0x61,0x03,0xf0,0x2c,0xfe,0x06,0xf9,0x00,0x5f,0xd0,0x00,0x1f,0xd0,0x0e,0xf4,
+0x2e,0xf4,0x00,0x02,0xfb,0x00,0x3f,0xed,0xf9,0x00,0x00,0x6f,0x90,0x00,0x9f,0xfe,
+0x00,0x00,0x0b,0xf5,0x02,0xaf,0xff,0xfc,0x40,0x03,0xff,0x5c,0xff,0xf7,0x4d,0xff,
+0xe8,0x3e,0x81,0xee,0x81,0x00,0x06,0xcf,0x50,0x11,0x02,0x00,0x00,0x00,0x00,0x10,
+0xf1,0x13,0x00,0x00,0x00,0x07,0x40,0x01,0x10,0x00,0x00,0x0d,0xe2,0x1f,0xf1,0x1e,
+0xd1,0x00,0x00,0x2f,0xd0,0x4f,0xe0,0x08,0xfb,0x00,0x00,0xaf,0x70,0x7f,0xb0,0x00,
+0x94,0x00,0x04,0xff,0x01,0x00,0xf0,0x72,0xf1,0x01,0xec,0xcc,0xff,0xcc,0xcc,0xcc,
+0xc0,0x00,0x00,0x06,0xfe,0x00,0x00,0x10,0x00,0x00,0x00,0x0c,0xff,0xff,0xff,0xfc,
+0x00,0x00,0x00,0x5f,0xfe,0xcc,0xcf,0xfa,0x00,0x00,0x01,0xef,0xfe,0x20,0x3f,0xf2,
+0x00,0x00,0x1c,0xfc,0x7f,0xd2,0xef,0x90,0x00,0x02,0xcf,0xe1,0x09,0xff,0xfb,0x00,
+0x00,0x4f,0xfd,0x20,0x29,0xff,0xfa,0x20,0x00,0x0c,0xa1,0x7b,0xff,0xe9,0xef,0xfd,
+0x93,0x00,0x00,0xbf,0xd7,0x00,0x08,0xdf,0xf1,0x00,0x00,0x23,0x00,0x00,0x00,0x02,
+0x30,0x3f,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x2c,0xfd,0xae,0xfb,0xdf,0xff,0xff,
+0xe0,0x05,0xf7,0x0b,0xf1,0xcf,0xed,0xdf,0xf0,0x05,0xfc,0x9e,0xf1,0x2f,0x80,0x0f,
+0xc0,0x05,0xff,0xff,0xf1,0x0e,0xb0,0x3f,0x90,0x18,0x00,0x40,0x0b,0xe0,0x6f,0x60,
+0x08,0x00,0x40,0x07,0xf4,0xbf,0x10,0x18,0x00,0xf6,0x26,0x02,0xfa,0xfb,0x00,0x05,
+0xfc,0x8e,0xf1,0x00,0xcf,0xf5,0x00,0x05,0xf7,0x0b,0xf6,0x20,0x6f,0xf0,0x00,0x2a,
+0xfe,0xef,0xff,0x60,0xcf,0xf4,0x00,0x3f,0xfd,0xae,0xf4,0x1a,0xfc,0xff,0x30,0x02,
+0x00,0x0b,0xf3,0xdf,0xb0,0x6f,0xf5,0x00,0x00,0x0b,0xf2,0xa9,0x00,0x04,0xa0,0x00,
+0x01,0x00,0x22,0x17,0x70,0x08,0x00,0x62,0x0e,0xf2,0x00,0x00,0x00,0x0d,0xe8,0x00,
+0xf0,0x14,0xe0,0x09,0xaa,0xaf,0xfa,0xaf,0xfa,0xaa,0x90,0x00,0x3d,0x6d,0xf0,0x1f,
+0xd8,0xa0,0x00,0x00,0xcf,0x3d,0xf0,0x1f,0xd9,0xfc,0x00,0x0a,0xf8,0x0d,0xf0,0x1f,
+0xd0,0x8f,0xa0,0x01,0x70,0x08,0x00,0xb1,0x07,0x10,0x00,0x99,0x9a,0xa9,0x9a,0xa9,
+0x80,0x00,0x00,0x37,0x00,0xf0,0x02,0xf4,0x00,0x00,0x05,0xfd,0x20,0x02,0xcf,0x80,
+0x00,0x00,0x00,0x4f,0xe6,0x5e,0xf9,0x00,0x57,0x01,0xf0,0x08,0xff,0xff,0x80,0x00,
+0x00,0x16,0xad,0xff,0xfe,0xef,0xfe,0xa8,0x61,0x0d,0xff,0xd9,0x30,0x04,0xae,0xff,
+0xc0,0x02,0x30,0x1c,0x00,0x25,0x13,0x20,0x86,0x00,0x10,0x0f,0x40,0x00,0x80,0x50,
+0x00,0x00,0x02,0xcb,0xb9,0x8c,0xe5,0x09,0x01,0xf2,0x18,0xee,0xda,0x88,0xbd,0x80,
+0x00,0x08,0xdf,0xed,0xda,0xcc,0xcd,0xed,0x70,0x03,0xfb,0x7d,0xe3,0x8e,0xa7,0xee,
+0x30,0x03,0xaf,0xff,0x91,0x5c,0xff,0xf9,0x10,0x0b,0xd8,0x36,0xd3,0xbd,0x84,0x6d,
+0x80,0x0e,0xb0,0x00,0xf0,0x14,0xf0,0x0e,0xd5,0x77,0x77,0x77,0x77,0x4d,0xf0,0x02,
+0x28,0xfe,0xee,0xee,0xef,0x72,0x20,0x00,0x08,0xfb,0xaa,0xaa,0xcf,0x70,0x00,0x00,
+0x08,0xfa,0x88,0x88,0xbf,0x70,0x00,0x02,0x29,0x18,0x00,0x33,0x82,0x20,0x1f,0xc8,
+0x01,0x12,0x1f,0xb0,0x00,0x04,0x07,0x00,0x10,0xe0,0xfb,0x00,0x0f,0x07,0x00,0x20,
+0x03,0x3f,0x00,0x52,0xfe,0xee,0xee,0xee,0xef,0x15,0x00,0x40,0x0c,0xf4,0x00,0x22,
+0x01,0x00,0x13,0x20,0x4b,0x01,0xa0,0x30,0x00,0xdf,0xba,0xaa,0xaa,0xaf,0xf3,0x00,
+0x0d,0x5f,0x01,0x87,0xdf,0x30,0x00,0xdf,0x20,0x00,0x00,0x0d,0x0f,0x00,0x55,0xcc,
+0xcc,0xcc,0xcf,0xf3,0x2d,0x00,0x04,0x01,0x00,0xf0,0x0f,0x06,0x92,0x00,0x5a,0x10,
+0x00,0x00,0x05,0xff,0x50,0x0b,0xfe,0x30,0x00,0x07,0xff,0x60,0x00,0x09,0xff,0x40,
+0x1c,0xff,0x60,0x00,0x00,0x08,0xff,0x40,0xad,0x28,0x00,0x24,0x09,0xc2,0x2c,0x00,
+0x21,0x2b,0xbb,0x01,0x00,0x22,0xb2,0x2f,0xdc,0x00,0x82,0xf3,0x03,0x33,0x33,0x33,
+0x33,0x3b,0xf8,0x4d,0x00,0x80,0x09,0xf6,0x00,0x00,0x8c,0xcc,0xcc,0xc0,0x08,0x00,
+0x41,0xbf,0xff,0xff,0xf1,0x08,0x00,0x23,0x20,0x0d,0x08,0x00,0x12,0x0c,0x08,0x00,
+0x39,0x42,0x2d,0xf1,0x20,0x00,0x30,0xba,0xaa,0xa0,0x08,0x00,0x61,0x7a,0x10,0x00,
+0x00,0x0a,0xf6,0x47,0x00,0x31,0xdf,0xff,0xf3,0x08,0x00,0x37,0x7f,0xfd,0x80,0x3b,
+0x02,0x31,0x09,0x50,0x00,0xe3,0x01,0x11,0xfe,0xc8,0x01,0x50,0x03,0xff,0x40,0x09,
+0xb0,0x02,0x03,0xf0,0x00,0x60,0x00,0xbf,0xc0,0x00,0x02,0xdf,0x60,0x00,0x01,0xcf,
+0xb0,0x02,0xef,0xfe,0x95,0x00,0xa0,0x90,0x0e,0xff,0xee,0xdc,0xba,0xa9,0xef,0x30,
+0x21,0x2a,0x00,0x40,0x04,0x40,0x02,0xcc,0x01,0x00,0x21,0xa0,0x00,0xb4,0x00,0x40,
+0xfd,0x00,0x02,0xfc,0x32,0x02,0x77,0xd0,0x00,0x2f,0xc0,0x00,0x00,0x03,0x0f,0x00,
+0x03,0x1e,0x00,0x00,0x73,0x03,0x20,0xdf,0xd0,0x3a,0x00,0x12,0x74,0x79,0x00,0x23,
+0x02,0xff,0x27,0x01,0x20,0xfa,0x00,0x89,0x01,0x83,0xdd,0xde,0xfe,0xdd,0xdd,0xdd,
+0xd1,0x0f,0xdd,0x01,0x33,0x00,0x00,0x7f,0xe1,0x02,0x12,0xef,0x05,0x01,0x82,0x08,
+0xfe,0x32,0x22,0x22,0x22,0x00,0x00,0x22,0x01,0xf1,0x05,0x00,0x01,0xdf,0xff,0xaa,
+0xaa,0xaa,0xff,0x00,0x2d,0xfc,0xef,0x00,0x00,0x00,0xff,0x00,0x4f,0xb0,0xdf,0x08,
+0x00,0x71,0x04,0x00,0xdf,0x11,0x11,0x11,0xff,0xef,0x00,0x02,0x90,0x03,0x70,0xdf,
+0xcb,0xbb,0xbc,0xee,0x00,0x00,0x9e,0x03,0x00,0x01,0x01,0x50,0x3f,0xea,0xaa,0xaa,
+0xae,0x08,0x00,0x56,0xa0,0x00,0x00,0x0c,0xf3,0x18,0x00,0x11,0x2b,0x80,0x01,0x05,
+0x17,0x01,0x13,0x1f,0x95,0x02,0x20,0x1a,0xab,0x68,0x00,0x52,0xaa,0xa0,0x00,0x06,
+0xfc,0x19,0x00,0x13,0x0b,0x30,0x00,0x62,0x0a,0xaa,0xaa,0xaa,0xaf,0xf0,0x14,0x00,
+0x21,0x4f,0xd0,0x1a,0x00,0x32,0xbb,0xef,0x80,0x22,0x00,0x28,0xfa,0x00,0x01,0x00,
+0x22,0x04,0x91,0x08,0x00,0x12,0x2f,0x87,0x01,0x31,0x03,0xef,0xfe,0xd2,0x00,0xf0,
+0x09,0x6f,0xf8,0x7f,0xf7,0x00,0x00,0x00,0x3c,0xff,0x70,0x05,0xff,0xd6,0x00,0x2b,
+0xff,0xfe,0xaa,0xaa,0xdf,0xff,0xe2,0x1d,0xfa,0x2f,0x01,0xc0,0x6e,0x90,0x03,0x30,
+0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x01,0x08,0x00,0x12,0x10,0x5d,0x03,0x00,0x17,
+0x01,0x50,0x0f,0xf9,0x99,0x99,0x9f,0x08,0x00,0x40,0xe0,0x00,0x00,0x0e,0x08,0x00,
+0x13,0xf0,0x08,0x00,0x04,0x20,0x00,0x71,0xfb,0xbb,0xbb,0xbe,0xe1,0x00,0xcf,0xbf,
+0x00,0xa0,0xfc,0xcf,0xdc,0xcc,0xcc,0xcc,0xcd,0xfc,0xcf,0x10,0x4a,0x00,0xe5,0xfc,
+0xcf,0x1d,0xff,0xff,0xff,0xd1,0xfc,0xcf,0x19,0xaa,0xaa,0xaa,0x91,0x15,0x00,0xb0,
+0x11,0xff,0xff,0xff,0x11,0xfc,0xcf,0x11,0xfd,0x88,0xdf,0x07,0x00,0x30,0xfa,0x00,
+0xaf,0x07,0x00,0x48,0xfb,0x00,0xbf,0x11,0x1c,0x00,0xc0,0x88,0x01,0xfc,0xcf,0x10,
+0x53,0x00,0x07,0xde,0xfa,0xcf,0x10,0x28,0x02,0x16,0xc2,0xe1,0x00,0x20,0x85,0x10,
+0x06,0x00,0x21,0x0a,0xfd,0x0d,0x00,0xf0,0x0a,0xaf,0xff,0xff,0xff,0xf7,0x00,0x3d,
+0xfe,0xbb,0xbb,0xcf,0xf4,0x0a,0xff,0xb1,0x00,0x00,0xbf,0x90,0x04,0xe5,0x7e,0x40,
+0x1b,0xfd,0x7a,0x02,0x40,0xf9,0xef,0xb1,0x00,0xff,0x02,0xb1,0xf8,0x00,0x00,0x00,
+0x27,0xdf,0xff,0xfc,0xcc,0xcb,0x2e,0xa8,0x00,0xaa,0xfe,0x0c,0xd9,0xfd,0x00,0x00,
+0x01,0xfe,0x00,0x01,0x07,0x00,0x00,0x1c,0x00,0x00,0x07,0x00,0x41,0xaa,0xaa,0xab,
+0xfe,0x5e,0x00,0xa0,0x36,0x80,0x00,0x00,0x57,0x8a,0xbc,0xef,0xff,0xfb,0xe1,0x01,
+0x92,0xfe,0xdb,0x97,0x40,0x00,0x00,0xdf,0x41,0x00,0xe0,0x02,0x13,0x20,0x08,0x00,
+0x01,0x53,0x00,0x31,0xf5,0x00,0xdf,0xa0,0x02,0x42,0xc4,0x00,0xff,0x10,0x18,0x00,
+0x20,0xff,0x1b,0xe3,0x01,0x31,0x10,0x01,0xfe,0x2b,0x01,0xb2,0x10,0x03,0xfc,0x0f,
+0xd0,0x00,0x00,0xef,0x10,0x07,0xf8,0x08,0x00,0x22,0x0c,0xf3,0x08,0x00,0x22,0x5f,
+0xc0,0x20,0x00,0x20,0x3c,0x30,0x4b,0x01,0x26,0xef,0x10,0xe8,0x00,0x31,0x03,0x63,
+0x00,0xe9,0x00,0x12,0xf9,0xee,0x04,0x00,0xfe,0x03,0x82,0xbd,0xdd,0xef,0xfd,0xdd,
+0xdd,0xd2,0xcf,0xb6,0x03,0x01,0x52,0x01,0x90,0x0b,0xf3,0xcf,0x11,0x99,0x99,0x98,
+0x0b,0xf3,0x3d,0x01,0x10,0xfe,0x07,0x00,0x37,0xf9,0x00,0xde,0x07,0x00,0x39,0xfd,
+0xaa,0xfe,0x1c,0x00,0x21,0x00,0x0b,0x38,0x00,0x30,0x1d,0xdf,0xf1,0x07,0x00,0x4c,
+0x0c,0xfe,0x80,0x00,0x01,0x00,0x10,0x7f,0x41,0x03,0xf0,0x0e,0xef,0xff,0xc5,0xbb,
+0xbb,0xbf,0xc0,0x0e,0xea,0xfc,0x04,0x50,0x01,0xfb,0x00,0xec,0x0e,0xc0,0xcf,0x00,
+0x3f,0xa0,0x0e,0xc0,0xec,0x0d,0xe0,0x04,0xf8,0x0f,0x00,0xf0,0x00,0xfc,0x00,0x6f,
+0x60,0x0e,0xc0,0xec,0x1f,0xea,0xad,0xfc,0xa0,0xec,0x0e,0xc3,0x91,0x00,0x30,0x0e,
+0xe9,0xfc,0x15,0x06,0xf1,0x02,0xe0,0xef,0xff,0xc7,0xaa,0xaa,0xa3,0xfc,0x0e,0xd1,
+0x10,0xcf,0xff,0xff,0x7f,0xa0,0xb9,0xf1,0x03,0x11,0xf7,0x5c,0x00,0x12,0x8a,0xb1,
+0x04,0x16,0x08,0x77,0x00,0x13,0x0f,0xfa,0x02,0x51,0x0c,0xcc,0xcc,0xcf,0xff,0x27,
+0x07,0x31,0x01,0xaf,0xf4,0x1a,0x00,0xf0,0x09,0x4e,0xff,0xe1,0xda,0x20,0x00,0x00,
+0x5c,0xff,0xcf,0xe3,0xcf,0xfa,0x20,0x4e,0xff,0xe5,0x0f,0xe0,0x05,0xdf,0xf3,0x0c,
+0xd6,0x8c,0x02,0x10,0x08,0xae,0x03,0x11,0x05,0x4c,0x04,0x21,0x5f,0xff,0x03,0x02,
+0x60,0x00,0x5f,0xeb,0xbb,0xbb,0xbe,0x08,0x00,0x48,0x90,0x00,0x00,0x09,0x08,0x00,
+0x04,0x20,0x00,0x51,0xea,0xaa,0xaa,0xad,0xf7,0x0b,0x04,0x12,0x81,0x7b,0x00,0x31,
+0x01,0xef,0xc0,0x08,0x00,0x40,0x05,0xef,0xef,0x90,0x08,0x00,0xf1,0x12,0x3b,0xff,
+0x70,0x9f,0xe6,0x10,0x00,0x06,0xcf,0xfe,0x5c,0xc1,0x5f,0xff,0xb5,0x01,0xef,0xe7,
+0x00,0x9f,0xc0,0x18,0xef,0xa0,0x03,0x57,0x99,0x99,0xeb,0x99,0x71,0x60,0x00,0xe7,
+0x02,0x33,0xfe,0x10,0x00,0xbb,0x04,0x02,0x45,0x00,0x33,0xcf,0x90,0x00,0xd7,0x03,
+0x10,0xfc,0x8a,0x04,0xc0,0x99,0x99,0x99,0xaf,0xc0,0x00,0x00,0x3f,0xb0,0x00,0x00,
+0x03,0x11,0x00,0x01,0xde,0x00,0x12,0xc0,0x09,0x04,0x22,0xab,0xfc,0x8b,0x04,0x12,
+0x20,0x77,0x00,0x01,0x0e,0x00,0x63,0x22,0x22,0x2f,0xf4,0x22,0x22,0xce,0x05,0x82,
+0xf0,0x00,0xdf,0xa9,0x99,0x99,0x99,0xff,0xec,0x05,0x23,0x0f,0xf0,0x5d,0x02,0x30,
+0x00,0x0d,0xfb,0x4c,0x02,0x14,0xb0,0x5c,0x02,0x21,0x0f,0xf9,0x73,0x02,0xf1,0x0a,
+0x01,0xfc,0x8f,0xcb,0xbb,0xbb,0xdf,0x50,0x5f,0x98,0xf4,0x00,0x00,0x09,0xf5,0x0a,
+0xf4,0x8f,0x50,0x00,0x00,0x9f,0x53,0xfd,0x08,0x1e,0x00,0x85,0x5e,0x40,0x8f,0xca,
+0xaa,0xaa,0xdf,0x50,0x7a,0x05,0x31,0xa3,0x09,0xf6,0x6b,0x04,0x12,0xf2,0x08,0x00,
+0x82,0x7f,0xfa,0xae,0xfd,0xaa,0xaa,0x00,0x02,0x80,0x01,0x32,0x10,0x0d,0xf9,0xb9,
+0x05,0x21,0x04,0xc0,0x01,0x06,0x08,0x98,0x01,0x12,0xcc,0xbf,0x08,0x03,0x01,0x00,
+0x00,0xeb,0x00,0x00,0x52,0x03,0x10,0x3f,0x70,0x01,0x12,0xf8,0xea,0x00,0x10,0x08,
+0x08,0x00,0x13,0xc0,0x08,0x00,0x07,0x20,0x00,0x51,0xbd,0xf8,0x00,0x00,0xef,0x48,
+0x00,0x20,0x20,0x0e,0xc3,0x00,0xfe,0x4b,0xbe,0xf2,0x00,0xef,0x00,0x0b,0xa0,0x00,
+0xbf,0x20,0x0e,0xf3,0xff,0xff,0xff,0x4b,0xf2,0x00,0xef,0x17,0x7f,0xe7,0x72,0xbf,
+0x20,0x0f,0xf3,0x66,0xfe,0x66,0x4b,0xf2,0x00,0xfe,0x8f,0xff,0xff,0xf9,0xbf,0x20,
+0x1f,0xe0,0x11,0x11,0x11,0x1b,0xf2,0x02,0xfc,0x0e,0xff,0xff,0xf0,0xbf,0x20,0x3f,
+0xa0,0xfd,0x77,0xdf,0x0b,0xf2,0x07,0xf7,0x0f,0xb0,0x0a,0xf0,0xbf,0x20,0xcf,0x20,
+0xff,0xff,0xff,0x0b,0xf2,0x3f,0xc0,0x0f,0xd7,0x77,0xfc,0xff,0x12,0xc4,0x00,0x32,
+0x00,0x0a,0xc8,0x02,0x00,0x67,0x02,0x03,0xd4,0x05,0x12,0x8f,0x7d,0x02,0x21,0x2c,
+0xfe,0x32,0x05,0xf2,0x09,0x3a,0xff,0xb1,0x2d,0xfe,0x83,0x00,0x4d,0xff,0xfe,0xa9,
+0x9b,0xff,0xff,0xe3,0x0e,0xe7,0xaf,0xff,0xff,0xf6,0x9f,0xb0,0x02,0xcf,0x01,0xf6,
+0x09,0x10,0x00,0xaa,0xaa,0xa0,0x8a,0xaa,0xaa,0x10,0x01,0xff,0xff,0xf0,0xcf,0xff,
+0xff,0x10,0x01,0xfa,0x0c,0xf0,0xcf,0x10,0xaf,0x08,0x00,0x62,0xfd,0x8e,0xf0,0xcf,
+0x10,0xbf,0x20,0x00,0xf2,0x01,0x5f,0xff,0x00,0x01,0xfa,0x11,0x10,0xcf,0x19,0x93,
+0x00,0x00,0x53,0x00,0x00,0xcf,0xa0,0x01,0x01,0x1a,0x02,0x41,0x14,0x7a,0xef,0x90,
+0xed,0x09,0xf2,0x0b,0xfe,0x83,0xcf,0xff,0xff,0xe0,0x35,0x5f,0xb0,0x0b,0xfc,0xcc,
+0xfe,0x00,0x02,0xfb,0x00,0xbf,0x10,0x1f,0xe0,0xcc,0xdf,0xfc,0xcc,0xf1,0x1c,0x04,
+0xf0,0x00,0xcf,0x10,0x1f,0xe0,0x00,0xef,0xe1,0x0b,0xf1,0x01,0xfe,0x00,0x6f,0xff,
+0xd1,0x1e,0x00,0x30,0x0d,0xff,0xef,0x1e,0x00,0xf0,0x03,0x0a,0xf8,0xfb,0x7a,0xbf,
+0x10,0x1f,0xe3,0xfd,0x3f,0xb0,0x0b,0xfb,0xab,0xfe,0x0c,0x22,0xfb,0x71,0x07,0x71,
+0xe0,0x00,0x2f,0xb0,0x0b,0xf3,0x23,0x4b,0x00,0x31,0x79,0x10,0x08,0x8c,0x09,0xf0,
+0x05,0x56,0x20,0x00,0x22,0x22,0x10,0x00,0xcf,0x50,0x00,0xef,0xff,0x70,0x01,0xfe,
+0x00,0x00,0xee,0x9f,0x7a,0xac,0x02,0xf1,0x05,0xeb,0x1f,0x7a,0xfb,0xaa,0xaa,0xff,
+0xeb,0x1f,0x7a,0xf1,0x00,0x00,0xdf,0xeb,0x1f,0x7a,0xf2,0xff,0xf4,0x07,0x00,0x12,
+0xf6,0x07,0x00,0x51,0xf2,0xe4,0xdf,0xee,0xbf,0x07,0x00,0x22,0xef,0xff,0x1c,0x00,
+0xf1,0x05,0x00,0x0a,0xf2,0xf7,0x51,0xdf,0x97,0x00,0x0a,0xf1,0x61,0x00,0xdf,0x00,
+0x00,0x0a,0xf1,0x00,0x49,0xfe,0x07,0x00,0x22,0x3f,0xf8,0x21,0x01,0x00,0xd3,0x02,
+0xf4,0x06,0xf3,0x6f,0xff,0xff,0x20,0x03,0xfc,0x9d,0xf3,0x6f,0xb9,0xdf,0x20,0x03,
+0xf7,0x09,0xf3,0x6f,0x40,0x9f,0x20,0x18,0x00,0xf3,0x02,0x02,0xaa,0xaa,0xe9,0x6a,
+0xfe,0xaa,0x10,0x00,0x00,0x02,0xfe,0x11,0xcf,0x90,0x00,0x3f,0x65,0x08,0xf0,0x20,
+0x2a,0xad,0xff,0xca,0xae,0xff,0xba,0xa2,0x00,0x7f,0xf7,0x00,0x01,0xcf,0xd5,0x00,
+0x4f,0xff,0xda,0xa3,0x5a,0xaf,0xff,0xf4,0x0b,0xff,0xff,0xf5,0x8f,0xff,0xff,0xa0,
+0x00,0xed,0x07,0xf5,0x8f,0x30,0xef,0x00,0x00,0xef,0xac,0xf5,0x8f,0xba,0xff,0x3a,
+0x02,0x43,0xe5,0x8f,0xff,0xed,0x41,0x02,0x14,0xfe,0x07,0x00,0x10,0x10,0x42,0x03,
+0x05,0x07,0x00,0xa1,0x12,0xff,0xff,0xff,0x12,0xfe,0xef,0x12,0xfd,0x99,0x07,0x00,
+0x37,0xf9,0x00,0xdf,0x07,0x00,0x45,0xfe,0xaa,0xff,0x12,0x23,0x00,0x07,0x38,0x00,
+0x15,0x03,0x4d,0x00,0x62,0xcb,0xbb,0xbb,0xbb,0xbc,0xfe,0x50,0x05,0x21,0xfd,0xcf,
+0x15,0x09,0x70,0xfd,0xce,0x00,0x00,0xac,0x00,0x00,0x07,0x00,0x10,0xef,0x07,0x00,
+0x80,0x3a,0xaa,0xff,0xaa,0xa3,0xfd,0xce,0x4f,0xb7,0x09,0x51,0xfd,0xce,0x00,0x04,
+0xfb,0x1c,0x00,0x30,0x08,0xff,0x80,0x07,0x00,0xf4,0x0b,0x2f,0xfb,0xfa,0x00,0xfd,
+0xce,0x04,0xef,0x60,0xbf,0xa0,0xfd,0xce,0x2f,0xf9,0x00,0x0b,0xf2,0xfd,0xce,0x05,
+0x50,0x00,0x01,0x30,0xfd,0x54,0x00,0x10,0x99,0x01,0x00,0x22,0xfd,0xdf,0x0e,0x00,
+0x20,0xdf,0xaa,0x01,0x00,0x40,0xfd,0xde,0x00,0x02,0x46,0x00,0x20,0xde,0x5f,0x61,
+0x03,0xf0,0x10,0xfd,0xde,0x27,0x78,0xfd,0x77,0x70,0xfd,0xde,0x09,0xbc,0xfe,0xbb,
+0x40,0xfd,0xde,0x08,0xab,0xfe,0xaa,0x40,0xfd,0xde,0x47,0x78,0xfd,0x77,0x73,0xfd,
+0xde,0x8f,0xcb,0x03,0x01,0x31,0x00,0x90,0x29,0xf3,0xfd,0xde,0x00,0x01,0xfb,0xaf,
+0xd0,0x07,0x00,0x35,0xa7,0x13,0x00,0x54,0x00,0x08,0x62,0x00,0x22,0xfe,0xdf,0xd2,
+0x00,0x60,0xdf,0x10,0x00,0x98,0x00,0x01,0x07,0x00,0x10,0xfd,0x07,0x00,0x10,0x5f,
+0x46,0x00,0xf0,0x0c,0xfe,0xdf,0x37,0x77,0xfe,0x77,0x73,0xfe,0xdf,0x12,0x44,0xfd,
+0x44,0x21,0xfe,0xdf,0x19,0xff,0xff,0xff,0x91,0xfe,0xdf,0x19,0xf3,0x11,0x5f,0x07,
+0x00,0xb0,0xf7,0x77,0x9f,0x91,0xfe,0xdf,0x18,0xff,0xff,0xff,0x81,0x38,0x00,0x00,
+0x12,0x07,0x0b,0x54,0x00,0x02,0xe4,0x07,0x02,0x0e,0x00,0x20,0xfc,0xdf,0x29,0x08,
+0x21,0x03,0xfc,0x5b,0x00,0xf0,0x1f,0xa3,0xfc,0xdf,0x39,0x9b,0xfc,0x99,0x63,0xfc,
+0xdf,0x10,0x05,0xf7,0x00,0x03,0xfc,0xdf,0x1e,0xff,0xff,0xff,0x23,0xfc,0xdf,0x18,
+0x8a,0xfc,0xcc,0x13,0xfc,0xdf,0x10,0x04,0xf7,0xaf,0x33,0xfc,0xdf,0x59,0x9b,0xfc,
+0xaf,0xa3,0xfc,0xdf,0x7f,0x0c,0x02,0x11,0xfc,0x62,0x00,0x24,0x04,0xfc,0x54,0x00,
+0x11,0xbb,0x54,0x00,0x05,0x88,0x01,0xfa,0x3c,0xbe,0xcb,0xbb,0xbb,0xfd,0xcf,0x00,
+0x4f,0xc0,0x00,0x01,0xfd,0xcf,0x03,0xef,0xff,0xff,0xe3,0xfd,0xcf,0x7f,0xfe,0x76,
+0xef,0x81,0xfd,0xcf,0x3b,0x6f,0xed,0xf7,0x01,0xfd,0xcf,0x15,0x9e,0xff,0xfa,0x52,
+0xfd,0xcf,0xef,0xff,0x83,0xaf,0xfc,0xfd,0xcf,0x56,0x2d,0xfe,0x92,0x42,0xfd,0xcf,
+0x00,0x75,0x58,0xc1,0x01,0xfd,0xcf,0x05,0xef,0xff,0xc8,0x21,0xfd,0xcf,0x00,0x00,
+0x37,0xbf,0x31,0xfd,0xdc,0x01,0x0a,0x96,0x01,0x10,0xcf,0x5e,0x09,0x85,0xb0,0xfd,
+0xcf,0x0b,0xf3,0x33,0x3f,0xb0,0x0e,0x00,0x81,0x03,0x44,0x44,0x44,0x30,0xfd,0xcf,
+0x0f,0x9d,0x01,0x50,0xcf,0x0f,0xc6,0x89,0x6d,0x07,0x00,0xf3,0x11,0xa0,0xcd,0x0b,
 0xf0,0xfd,0xcf,0x0e,0x93,0xfb,0x49,0xb0,0xfd,0xcf,0x36,0xbf,0xe7,0xfe,0x82,0xfd,
-0xcf,0x7f,0xe8,0x10,0x4a,0xf5,0xfd,0xcf,0x9c,0x98,0x88,0x88,0xa9,0x5b,0x00,0x05,
-0x12,0x4b,0x03,0xe0,0x05,0x48,0x01,0x11,0x1a,0xf8,0x13,0x3d,0x80,0x1b,0xbb,0xef,
-0xdb,0xbb,0xbb,0xbb,0xb1,0x18,0x59,0x22,0x08,0xc3,0x21,0x16,0x22,0x0a,0xf4,0x13,
-0x37,0x20,0x0a,0xf5,0xcf,0x09,0x20,0xa0,0xef,0x0a,0x46,0xb2,0x6f,0xff,0xa0,0xab,
-0xbe,0xfc,0xbb,0x50,0x0b,0x6f,0xa0,0x20,0x00,0x1c,0x3f,0x08,0x00,0x63,0xa6,0xbb,
-0xbe,0xfd,0xbb,0xb0,0x92,0x34,0x02,0xad,0x15,0x01,0x03,0x27,0x41,0x40,0x00,0x00,
-0xfb,0x08,0x00,0x22,0x01,0x10,0x08,0x00,0x25,0x2f,0xa0,0x08,0x00,0xf1,0x10,0x3c,
-0xa0,0x4d,0xef,0xec,0x2f,0xa0,0xff,0xff,0xe0,0x5f,0xff,0xfe,0x2f,0xee,0xff,0xbe,
-0xe0,0x00,0x7f,0x43,0xbf,0xff,0xfb,0x0e,0xe0,0x00,0x7f,0x47,0xff,0xc1,0x08,0x00,
-0x31,0x41,0x7f,0xa0,0x08,0x00,0xf2,0x0f,0x9a,0x3f,0xa0,0xfb,0x9f,0xc0,0x04,0xbf,
-0xff,0x4f,0xa0,0xfb,0xce,0x50,0x5f,0xff,0x81,0x2f,0xa0,0x00,0x00,0xd5,0x0c,0x60,
-0x00,0x2f,0xa0,0x00,0x03,0xf8,0xa2,0x43,0x21,0xbe,0xf4,0x59,0x11,0x00,0xd5,0x5b,
-0x04,0x97,0x1e,0x21,0x8f,0x30,0x96,0x38,0x1e,0x00,0x08,0x00,0x31,0x01,0x00,0xdf,
-0x5e,0x08,0x25,0x7f,0x70,0x08,0x00,0x80,0x10,0x00,0x01,0x9f,0x51,0x6f,0x70,0xdf,
-0x2e,0x23,0x62,0x30,0x6f,0x70,0xdf,0xcc,0xc1,0x08,0x00,0x00,0x30,0x00,0x11,0x8a,
-0x08,0x00,0x23,0x05,0xcf,0x30,0x00,0x20,0xfd,0x71,0x10,0x00,0x00,0xae,0x22,0x34,
-0x6f,0x70,0xef,0x34,0x0b,0x00,0xe9,0x10,0x10,0x1c,0xa0,0x06,0x15,0xc5,0xed,0x19,
-0x21,0xf1,0x00,0x03,0x29,0x00,0xba,0x39,0x11,0x20,0x0f,0x00,0x80,0x5f,0xe6,0x66,
-0x65,0x00,0xbf,0x10,0x1e,0x2e,0x00,0xf0,0x07,0xdf,0xfd,0xaa,0xfd,0x99,0x99,0xee,
-0x6f,0xff,0xfe,0xfe,0x10,0x00,0x0d,0xe0,0x0b,0xf1,0x0a,0x4c,0x70,0x00,0xed,0x2d,
-0x00,0x40,0xaf,0xa0,0x0e,0xd0,0xc3,0x12,0xf2,0x0f,0x9d,0x33,0xfc,0x00,0xbf,0x9f,
-0x30,0x01,0x9f,0xbf,0xb0,0x3d,0xff,0xc2,0x18,0xff,0xb4,0xfa,0x7f,0xfc,0x40,0x6f,
-0xfc,0x30,0x3f,0x92,0xd5,0x00,0x03,0xc4,0x55,0x36,0x52,0x00,0x07,0xcc,0xff,0x30,
-0x3e,0x24,0x0e,0xfc,0x37,0x21,0x6f,0x50,0xc1,0x35,0x07,0x08,0x00,0x40,0x23,0x4f,
-0xd3,0x33,0x08,0x00,0x10,0xaf,0x68,0x07,0xc0,0x1d,0xef,0xec,0x7c,0xcf,0xfc,0xef,
-0x10,0x1f,0xff,0xfe,0x00,0xd2,0x1d,0x02,0x28,0x00,0x01,0x08,0x00,0x91,0x22,0x4f,
-0xc2,0xbf,0x30,0x00,0x6f,0x50,0xef,0xd0,0x01,0xe0,0x6f,0xaa,0x99,0xdf,0xfe,0x99,
-0x90,0x02,0xaf,0xff,0x00,0xcf,0xef,0x20,0x62,0x5e,0xa1,0x04,0xfe,0x4f,0xa0,0x00,
-0x0d,0x81,0x00,0x3e,0xf6,0x74,0x34,0x00,0xcc,0x36,0x10,0xff,0xe4,0x38,0x00,0xb2,
-0x10,0x55,0xd1,0x00,0x00,0x04,0x30,0x3c,0x4e,0x30,0x00,0x4f,0x70,0x05,0x08,0xf0,
-0x12,0xb3,0xf8,0x4f,0x70,0x05,0xbf,0xdb,0xfd,0x73,0xf8,0x4f,0x70,0x00,0x4f,0x72,
-0xf9,0x03,0xf8,0x4f,0x70,0x1c,0xdf,0xed,0xfe,0xc4,0xf8,0x4f,0x70,0x0b,0xef,0xdc,
-0xfe,0xb4,0x18,0x00,0xf0,0x0a,0xdf,0x12,0xf9,0x01,0x63,0x4f,0x70,0x09,0xfb,0x02,
-0xf9,0x00,0x27,0xaf,0x70,0x2e,0xe1,0x02,0xfa,0x10,0x1f,0xff,0x30,0x03,0x10,0x26,
-0x43,0x12,0x51,0x7b,0x3e,0x00,0x80,0x45,0x10,0x7c,0xdf,0x16,0x15,0xc7,0xa7,0x15,
-0x12,0x2c,0xef,0x16,0x15,0xc2,0x53,0x3e,0x21,0x02,0xfb,0x0c,0x08,0x94,0x03,0xab,
-0xfe,0xaa,0xaa,0xbf,0xea,0x90,0x05,0x08,0x2a,0x72,0x13,0xfc,0x33,0x33,0x6f,0xb1,
-0x10,0x69,0x08,0x10,0xb0,0xc6,0x23,0x56,0x44,0x44,0x7f,0xb0,0x00,0x10,0x00,0x11,
-0xfc,0x10,0x00,0x03,0x48,0x00,0xf1,0x03,0xfa,0x18,0x8b,0xfe,0x89,0xa8,0xaf,0xf9,
-0x85,0x00,0x6f,0xf5,0x0c,0xf3,0x0a,0xfd,0x30,0x1c,0x78,0x04,0xf3,0x03,0x9f,0xf7,
-0x09,0xa1,0x47,0x7e,0xf8,0x77,0x03,0xb1,0x00,0x79,0x99,0x9e,0xfa,0x99,0x99,0x30,
-0x73,0x0c,0x06,0xe9,0x1b,0x22,0x7d,0x30,0x0d,0x45,0xa2,0x9f,0x30,0x7a,0xab,0xfe,
-0xaa,0xa5,0x00,0x9f,0x30,0x1c,0x0c,0xc0,0x9f,0x30,0x11,0x18,0xf5,0x11,0x10,0x2d,
-0xff,0xeb,0x0e,0xff,0xd7,0x51,0x50,0xff,0xfd,0x0e,0xd5,0x55,0xe2,0x11,0x11,0x30,
-0x10,0x00,0x00,0x08,0x00,0x31,0xd4,0x44,0x5f,0x08,0x00,0x31,0xfb,0xbb,0xcf,0x08,
-0x00,0x70,0xea,0xaa,0xaf,0x90,0x00,0x9f,0xba,0x28,0x00,0x51,0xa0,0x2a,0xff,0xfe,
-0xff,0xb8,0x57,0xf0,0x00,0xfa,0x41,0x99,0xee,0x99,0xfc,0x98,0x04,0x10,0x00,0x5d,
-0xfe,0x25,0xff,0xa1,0xcf,0x11,0x43,0x80,0x00,0x2b,0xf8,0xef,0x07,0x12,0x40,0x14,
-0x12,0x10,0x10,0x1f,0x5f,0xf0,0x22,0x9f,0x10,0x2f,0xc0,0x00,0x9f,0x20,0x06,0xf9,
+0xcf,0x7f,0xe8,0x10,0x4a,0xf5,0xfd,0xcf,0x9c,0x98,0x88,0x88,0xa9,0x5b,0x00,0x00,
+0x78,0x08,0x27,0x30,0x00,0xe0,0x05,0x40,0x01,0x11,0x1a,0xf8,0x53,0x09,0x04,0x47,
+0x0c,0xe0,0x1b,0xbb,0xef,0xdb,0xbb,0xbb,0xbb,0xb1,0x00,0x02,0xff,0x10,0x08,0xc3,
+0x8b,0x0a,0x40,0xf7,0x00,0x0a,0xf4,0xca,0x08,0x40,0xd0,0x00,0x0a,0xf5,0xcf,0x09,
+0x10,0xa0,0x9d,0x02,0xc2,0x70,0x6f,0xff,0xa0,0xab,0xbe,0xfc,0xbb,0x50,0x0b,0x6f,
+0xa0,0x20,0x00,0x1c,0x3f,0x08,0x00,0x92,0xa6,0xbb,0xbe,0xfd,0xbb,0xb0,0x00,0x3f,
+0xa8,0x8b,0x09,0x00,0x01,0x00,0x10,0x32,0xd8,0x05,0x41,0x40,0x00,0x00,0xfb,0x08,
+0x00,0x22,0x01,0x10,0x08,0x00,0x25,0x2f,0xa0,0x08,0x00,0xf1,0x10,0x3c,0xa0,0x4d,
+0xef,0xec,0x2f,0xa0,0xff,0xff,0xe0,0x5f,0xff,0xfe,0x2f,0xee,0xff,0xbe,0xe0,0x00,
+0x7f,0x43,0xbf,0xff,0xfb,0x0e,0xe0,0x00,0x7f,0x47,0xff,0xc1,0x08,0x00,0x31,0x41,
+0x7f,0xa0,0x08,0x00,0xf1,0x10,0x9a,0x3f,0xa0,0xfb,0x9f,0xc0,0x04,0xbf,0xff,0x4f,
+0xa0,0xfb,0xce,0x50,0x5f,0xff,0x81,0x2f,0xa0,0x00,0x00,0xd5,0x0c,0x60,0x00,0x2f,
+0xa0,0x00,0x03,0xf8,0x00,0xfc,0x09,0x20,0xbe,0xf4,0x53,0x0b,0x41,0xef,0xff,0xfe,
+0x90,0x80,0x00,0x10,0x11,0x6d,0x05,0x4f,0x30,0x00,0x00,0xdf,0x08,0x00,0x02,0x31,
+0x01,0x00,0xdf,0x5e,0x08,0x25,0x7f,0x70,0x08,0x00,0xf2,0x03,0x10,0x00,0x01,0x9f,
+0x51,0x6f,0x70,0xdf,0xff,0xf1,0x00,0x8f,0x30,0x6f,0x70,0xdf,0xcc,0xc1,0x08,0x00,
+0x00,0x30,0x00,0x11,0x8a,0x08,0x00,0x23,0x05,0xcf,0x30,0x00,0x21,0xfd,0x71,0x10,
+0x00,0x65,0x1a,0x40,0x00,0x6f,0x70,0xef,0x34,0x0b,0x90,0xf6,0x00,0x00,0x1c,0xcc,
+0xcc,0xcc,0xcc,0xc5,0x13,0x00,0x01,0x00,0xd1,0x0b,0xf1,0x00,0x07,0xe5,0x00,0x00,
+0x00,0xbf,0x10,0x00,0xef,0x20,0x0f,0x00,0xf0,0x13,0x5f,0xe6,0x66,0x65,0x00,0xbf,
+0x10,0x1e,0xff,0xff,0xff,0xf6,0xdf,0xfd,0xaa,0xfd,0x99,0x99,0xee,0x6f,0xff,0xfe,
+0xfe,0x10,0x00,0x0d,0xe0,0x0b,0xf1,0x0a,0x4c,0x70,0x00,0xed,0x2d,0x00,0xf0,0x1a,
+0xaf,0xa0,0x0e,0xd0,0x0b,0xf1,0x00,0x00,0x9d,0x33,0xfc,0x00,0xbf,0x9f,0x30,0x01,
+0x9f,0xbf,0xb0,0x3d,0xff,0xc2,0x18,0xff,0xb4,0xfa,0x7f,0xfc,0x40,0x6f,0xfc,0x30,
+0x3f,0x92,0xd5,0x00,0x03,0xc4,0x00,0x06,0xf7,0x65,0x00,0x40,0x07,0xcc,0xff,0x30,
+0x08,0x00,0x4c,0x4f,0xfe,0x70,0x00,0x01,0x00,0x59,0x6f,0x50,0x00,0x1f,0xc0,0x08,
+0x00,0x40,0x23,0x4f,0xd3,0x33,0x08,0x00,0xf2,0x06,0xaf,0xff,0xff,0xff,0x10,0x1d,
+0xef,0xec,0x7c,0xcf,0xfc,0xef,0x10,0x1f,0xff,0xfe,0x00,0x1f,0xc0,0xaf,0x10,0x28,
+0x00,0x01,0x08,0x00,0xf2,0x36,0x22,0x4f,0xc2,0xbf,0x30,0x00,0x6f,0x50,0xef,0xff,
+0xff,0xff,0xf1,0x00,0x6f,0xaa,0x99,0xdf,0xfe,0x99,0x90,0x02,0xaf,0xff,0x00,0xcf,
+0xef,0x20,0x00,0x3f,0xff,0x91,0x04,0xfe,0x4f,0xa0,0x00,0x0d,0x81,0x00,0x3e,0xf6,
+0x0b,0xf6,0x00,0x00,0x00,0x06,0xff,0xa0,0x03,0xff,0x90,0x00,0x00,0x3f,0xf9,0x00,
+0x00,0x6f,0xd1,0x00,0x00,0x04,0x30,0x00,0x00,0x04,0x20,0x85,0x00,0xf0,0x18,0x4f,
+0x70,0x08,0xff,0xff,0xff,0xb3,0xf8,0x4f,0x70,0x05,0xbf,0xdb,0xfd,0x73,0xf8,0x4f,
+0x70,0x00,0x4f,0x72,0xf9,0x03,0xf8,0x4f,0x70,0x1c,0xdf,0xed,0xfe,0xc4,0xf8,0x4f,
+0x70,0x0b,0xef,0xdc,0xfe,0xb4,0x18,0x00,0xf0,0x1f,0xdf,0x12,0xf9,0x01,0x63,0x4f,
+0x70,0x09,0xfb,0x02,0xf9,0x00,0x27,0xaf,0x70,0x2e,0xe1,0x02,0xfa,0x10,0x1f,0xff,
+0x30,0x03,0x10,0x00,0x1f,0xf0,0x04,0x51,0x00,0x00,0x9f,0xff,0xff,0xff,0xff,0xf9,
+0x00,0x00,0x7c,0xcc,0xcf,0xfc,0xcc,0xc7,0x5d,0x00,0x70,0x0f,0xf0,0x00,0x00,0x00,
+0x2c,0xcc,0x10,0x00,0x41,0xcc,0xc2,0x3f,0xff,0x01,0x00,0xf2,0x03,0xf2,0x00,0x02,
+0xfb,0x00,0x00,0x3f,0xb0,0x00,0x03,0xab,0xfe,0xaa,0xaa,0xbf,0xea,0x90,0x05,0x18,
+0x00,0xb0,0xe0,0x00,0x13,0xfc,0x33,0x33,0x6f,0xb1,0x10,0x00,0x02,0x0f,0x00,0xa6,
+0xb0,0x00,0x00,0x02,0xfd,0x44,0x44,0x7f,0xb0,0x00,0x10,0x00,0x11,0xfc,0x10,0x00,
+0x03,0x48,0x00,0xf1,0x1c,0xfa,0x18,0x8b,0xfe,0x89,0xa8,0xaf,0xf9,0x85,0x00,0x6f,
+0xf5,0x0c,0xf3,0x0a,0xfd,0x30,0x1c,0xfe,0xdf,0xff,0xff,0xff,0x9f,0xf7,0x09,0xa1,
+0x47,0x7e,0xf8,0x77,0x03,0xb1,0x00,0x79,0x99,0x9e,0xfa,0x99,0x99,0x30,0x00,0xcf,
+0x30,0x00,0x15,0x50,0x78,0x01,0xf0,0x03,0x7d,0x30,0x00,0x01,0xfe,0x00,0x00,0x00,
+0x9f,0x30,0x7a,0xab,0xfe,0xaa,0xa5,0x00,0x9f,0x30,0x70,0x01,0xf1,0x0d,0xf7,0x00,
+0x9f,0x30,0x11,0x18,0xf5,0x11,0x10,0x2d,0xff,0xeb,0x0e,0xff,0xff,0xff,0x90,0x2f,
+0xff,0xfd,0x0e,0xd5,0x55,0x6f,0x90,0x00,0x9f,0x30,0x10,0x00,0x00,0x08,0x00,0x31,
+0xd4,0x44,0x5f,0x08,0x00,0x31,0xfb,0xbb,0xcf,0x08,0x00,0x70,0xea,0xaa,0xaf,0x90,
+0x00,0x9f,0xba,0x28,0x00,0x40,0xa0,0x2a,0xff,0xfe,0x68,0x00,0xf3,0x0e,0xfd,0x1f,
+0xfa,0x41,0x99,0xee,0x99,0xfc,0x98,0x04,0x10,0x00,0x5d,0xfe,0x25,0xff,0xa1,0x00,
+0x00,0x06,0xfe,0x80,0x00,0x2b,0xf8,0x00,0x00,0x00,0x40,0x04,0x00,0xf0,0x2a,0x00,
+0x10,0x00,0x10,0x00,0x09,0xf2,0x00,0x9f,0x10,0x2f,0xc0,0x00,0x9f,0x20,0x06,0xf9,
 0x08,0xf7,0x00,0x09,0xf2,0x07,0x8f,0x98,0xef,0x86,0x00,0x9f,0x20,0xef,0xef,0xff,
 0xef,0xb0,0xce,0xfc,0x6e,0xb9,0x4f,0x28,0xeb,0x1f,0xff,0xf8,0xea,0xc9,0xf8,0xad,
-0xb0,0x09,0xf2,0x0e,0xa5,0x9f,0x82,0xdb,0x1e,0x00,0x01,0x8c,0x2a,0xa1,0xf2,0x04,
-0x55,0x55,0x55,0x53,0x00,0x9f,0x20,0x1f,0x02,0x39,0xf0,0x02,0xfc,0x91,0xfc,0x55,
-0x5d,0xf1,0x2c,0xff,0xf8,0x1f,0xfd,0xdd,0xff,0x10,0xfc,0x61,0x01,0x0f,0x00,0x12,
-0x01,0xfa,0x02,0x10,0x10,0x4d,0x0d,0x34,0x66,0x6d,0xf1,0xe0,0x2c,0x30,0x89,0x99,
-0x99,0x4b,0x1b,0x04,0xb7,0x09,0x01,0xac,0x42,0x15,0x00,0x6e,0x2a,0x00,0x77,0x1d,
-0x00,0xf3,0x25,0x20,0x57,0x77,0x01,0x00,0x23,0x00,0x0b,0x25,0x00,0x60,0xbf,0x30,
-0x0f,0xe0,0x00,0xef,0x5d,0x10,0x10,0xfe,0xc6,0x2b,0x12,0xef,0x6e,0x0a,0x10,0x2f,
-0x4d,0x43,0x41,0x8f,0xf0,0x08,0xf8,0xa0,0x0a,0x13,0x04,0x78,0x16,0x2a,0x2d,0x60,
-0xe8,0x1a,0x01,0xc0,0x26,0x01,0xf9,0x43,0x32,0xf7,0x00,0x01,0x57,0x2c,0x00,0xd0,
-0x01,0xe0,0x01,0x8f,0xfd,0x99,0x9b,0xff,0x60,0x00,0x0d,0xfd,0xff,0x92,0x5e,0xf8,
-0x5c,0x5d,0x11,0x2c,0x8d,0x27,0x20,0x15,0x8b,0x4f,0x2e,0xc0,0xa7,0x51,0xaf,0xff,
-0xfb,0x61,0x16,0xbf,0xff,0xe1,0x29,0xec,0x92,0x00,0x13,0xb7,0xc8,0x01,0x00,0xc9,
-0x35,0x66,0x52,0x4f,0xe2,0x2e,0xf2,0x00,0x10,0x00,0x40,0x64,0x5f,0xe4,0x4f,0x08,
-0x00,0x47,0xba,0xaf,0xfa,0xaf,0x18,0x00,0x23,0x01,0x30,0xe9,0x03,0x13,0xf7,0x70,
-0x03,0x13,0xff,0xda,0x39,0x01,0xdb,0x00,0x30,0x70,0x2f,0xfe,0x76,0x16,0x93,0xdb,
-0x00,0x04,0x2d,0xf6,0x55,0x55,0x57,0xfd,0xa0,0x12,0x00,0x08,0x00,0x0b,0x10,0x00,
-0x92,0x01,0xaf,0xd5,0x55,0x55,0x50,0x00,0x00,0x2b,0x47,0x04,0x50,0x05,0xff,0xdf,
-0x92,0x27,0xb2,0x09,0xfc,0x09,0x72,0x09,0xfe,0xef,0xe5,0x00,0x00,0x38,0xac,0xef,
-0xff,0xef,0xff,0xcb,0xa5,0x3f,0xfe,0xc9,0x41,0x03,0x7a,0xde,0xf1,0x02,0xe8,0x03,
-0x21,0x1e,0x90,0xd1,0x0f,0x00,0xd3,0x46,0x01,0x08,0x00,0x12,0xaf,0x10,0x00,0x00,
-0x45,0x01,0x21,0x6c,0xf3,0xdd,0x48,0x30,0xff,0x4c,0xf3,0x29,0x38,0xf0,0x17,0x00,
+0xb0,0x09,0xf2,0x0e,0xa5,0x9f,0x82,0xdb,0x1e,0x00,0x00,0x0d,0x01,0xb0,0x09,0xf2,
+0x04,0x55,0x55,0x55,0x53,0x00,0x9f,0x20,0x1f,0x2b,0x02,0xf0,0x03,0x0a,0xfc,0x91,
+0xfc,0x55,0x5d,0xf1,0x2c,0xff,0xf8,0x1f,0xfd,0xdd,0xff,0x10,0xfc,0x61,0x01,0x0f,
+0x00,0x31,0x01,0x00,0x00,0x1e,0x00,0x70,0x00,0x00,0x01,0xfc,0x66,0x6d,0xf1,0x90,
+0x01,0xc2,0xe0,0x00,0x00,0x00,0x89,0x99,0x99,0xff,0x99,0x99,0x98,0x0f,0x47,0x01,
+0x00,0xa2,0x01,0x10,0xfe,0x93,0x00,0x02,0x0f,0x00,0x30,0x30,0x09,0x99,0x01,0x00,
+0x40,0x92,0x00,0x57,0x77,0x01,0x00,0x23,0x00,0x0b,0x25,0x00,0xf1,0x01,0xbf,0x30,
+0x0f,0xe0,0x00,0xef,0x00,0x0d,0xf3,0x00,0xfe,0x00,0x0e,0xf0,0x00,0xef,0x17,0x00,
+0xa0,0x00,0x2f,0xe8,0x88,0x88,0x88,0x8f,0xf0,0x08,0xf8,0x41,0x00,0x32,0x22,0x04,
+0xff,0x54,0x02,0x22,0x2d,0x60,0x68,0x01,0x14,0x10,0x71,0x01,0x22,0x02,0x30,0x08,
+0x00,0x91,0x2e,0xf7,0x00,0x01,0x00,0x00,0x00,0x03,0xef,0xd0,0x01,0xf0,0x1b,0x01,
+0x8f,0xfd,0x99,0x9b,0xff,0x60,0x00,0x0d,0xfd,0xff,0x92,0x5e,0xf8,0x00,0x00,0x03,
+0x70,0x2c,0xff,0xff,0x60,0x00,0x00,0x15,0x8b,0xef,0xff,0xff,0xfd,0xa7,0x51,0xaf,
+0xff,0xfb,0x61,0x16,0xbf,0xff,0xe1,0x29,0xec,0x92,0x00,0x13,0xb7,0xc8,0x01,0xa6,
+0xf2,0x00,0x00,0xcf,0x52,0x4f,0xe2,0x2e,0xf2,0x00,0x10,0x00,0x40,0x64,0x5f,0xe4,
+0x4f,0x08,0x00,0x47,0xba,0xaf,0xfa,0xaf,0x18,0x00,0x23,0x01,0x30,0xe9,0x03,0x13,
+0xf7,0x70,0x03,0x02,0x68,0x02,0x21,0x06,0xff,0xdb,0x00,0xf0,0x04,0x70,0x2f,0xfe,
+0xdd,0xdd,0xdd,0xdd,0xdb,0x00,0x04,0x2d,0xf6,0x55,0x55,0x57,0xfd,0x00,0x00,0x0d,
+0xbf,0x01,0x00,0x08,0x00,0x0b,0x10,0x00,0xa0,0x01,0xaf,0xd5,0x55,0x55,0x50,0x00,
+0x00,0x2b,0xff,0x19,0x04,0xfc,0x13,0x00,0x05,0xff,0xdf,0x92,0x27,0xef,0x90,0x00,
+0x00,0x72,0x09,0xfe,0xef,0xe5,0x00,0x00,0x38,0xac,0xef,0xff,0xef,0xff,0xcb,0xa5,
+0x3f,0xfe,0xc9,0x41,0x03,0x7a,0xde,0xf1,0x02,0xe8,0x03,0xa2,0x1e,0x90,0x00,0x0c,
+0xf3,0x00,0x00,0x00,0x5f,0xb0,0x08,0x00,0x12,0xaf,0x10,0x00,0x00,0x45,0x01,0xf1,
+0x29,0x6c,0xf3,0x00,0x00,0x03,0xff,0xcc,0xff,0x4c,0xf3,0x00,0x00,0x0a,0xf8,0x00,
 0xef,0x1c,0xf8,0x20,0x00,0x3f,0xf1,0x03,0xfd,0x0c,0xff,0xe2,0x00,0x8f,0x9d,0x68,
 0xfa,0x0c,0xfb,0xfe,0x20,0x05,0x3e,0xff,0xf3,0x0c,0xf3,0x9f,0xe2,0x00,0x01,0xdf,
-0xc0,0x0c,0xf3,0x0a,0x80,0x51,0x0c,0x01,0x40,0x00,0x21,0x2e,0xf9,0x48,0x00,0x31,
-0x07,0xff,0xc0,0x08,0x00,0x32,0x6f,0xfa,0x10,0x10,0x00,0x12,0x50,0x41,0x10,0x00,
-0x5a,0x0a,0x03,0x80,0x01,0x33,0xdf,0xa0,0x01,0x01,0x01,0x00,0x48,0x03,0xd0,0x5c,
-0xfe,0xa9,0x9a,0xff,0x60,0x00,0x02,0xee,0x89,0x50,0x3d,0xf8,0x1a,0x50,0x21,0x1c,
-0xfd,0x2f,0x50,0x50,0x47,0xbf,0xff,0xbe,0xd4,0x58,0x06,0x81,0xfd,0x74,0xdf,0xf9,
-0x99,0x50,0x03,0x95,0x9d,0x5f,0xf0,0x01,0xe1,0x00,0x03,0x9e,0xfd,0x41,0x14,0xff,
-0x60,0x00,0x0a,0xfd,0x7a,0x90,0x4e,0xf9,0xc3,0x02,0x21,0x1b,0xfe,0x44,0x2e,0xb0,
-0x14,0x8d,0xff,0xd3,0x00,0x00,0x0a,0xde,0xff,0xff,0xb6,0x7f,0x0e,0x39,0xfe,0xc9,
-0x61,0x25,0x22,0x06,0xb7,0x1a,0x14,0x2f,0x08,0x00,0x13,0xe0,0x1a,0x0c,0x17,0xe0,
-0xa0,0x10,0x04,0x5a,0x11,0x00,0xa5,0x47,0x40,0xff,0xee,0xee,0xe1,0x07,0x19,0x14,
-0xfb,0x81,0x18,0x11,0x20,0x9e,0x0b,0x31,0xfb,0x9f,0xb0,0x3f,0x00,0x30,0xf5,0x2f,
-0xf5,0x17,0x00,0x20,0xdf,0xb0,0x9f,0x1d,0x00,0xc5,0x5a,0x00,0x97,0x14,0x20,0x08,
-0xff,0x83,0x43,0x31,0xff,0xc2,0x0c,0x4c,0x1f,0x41,0xaf,0xc0,0x01,0x40,0x76,0x0d,
-0x22,0x20,0x03,0xbb,0x12,0x13,0x30,0x60,0x04,0xa2,0x40,0x01,0x33,0x33,0x5f,0xe3,
-0x33,0x33,0x10,0x00,0x59,0x29,0x14,0x00,0x08,0x00,0x12,0x0d,0x6f,0x1b,0x26,0xd0,
-0x0e,0x90,0x2e,0x23,0xcf,0xfa,0xd5,0x4a,0x02,0xbd,0x05,0x41,0x1e,0xf9,0x6f,0xe1,
-0x47,0x01,0x40,0xd1,0x0b,0xfd,0x30,0x32,0x43,0x80,0x20,0x00,0xcf,0xf8,0x20,0x3f,
-0xff,0xb1,0xec,0x16,0x30,0xf4,0x0a,0xc4,0x24,0x00,0x18,0x4b,0xf7,0x14,0x2b,0x1f,
-0xf0,0x00,0x01,0x17,0xe0,0x08,0x00,0x21,0x0c,0xcc,0x70,0x4f,0x23,0xc2,0x0f,0xee,
-0x0a,0x50,0x02,0x22,0x22,0xaf,0xfd,0xd5,0x13,0x00,0x12,0x02,0x12,0x20,0x6f,0x28,
-0x21,0x8f,0x90,0x59,0x1d,0x31,0xf9,0x1f,0xf4,0x81,0x0d,0x31,0xf1,0x08,0xfd,0x55,
-0x4b,0xf6,0x0e,0xf8,0x00,0xdf,0xd1,0x00,0x01,0x9f,0xfa,0xff,0x90,0x3f,0xfd,0x40,
-0x3f,0xff,0x80,0x3f,0xf7,0x03,0xff,0xf5,0x0b,0xc3,0x00,0x05,0xd2,0x00,0x1b,0xa0,
-0x3a,0x13,0x32,0x71,0x1f,0xe0,0x72,0x3a,0x02,0x08,0x00,0x22,0x7f,0xd0,0x08,0x00,
-0x03,0xfd,0x27,0x20,0x05,0xff,0xf0,0x00,0x42,0xec,0x00,0x1e,0xf7,0x42,0x27,0x22,
-0x03,0x90,0x08,0x01,0x13,0x2c,0x98,0x00,0x15,0x2f,0x98,0x00,0x31,0x23,0xff,0xfe,
-0x98,0x00,0x41,0x09,0xfd,0xcf,0x90,0xbc,0x27,0x30,0xf4,0x2f,0xf9,0x39,0x4b,0x90,
-0xff,0x60,0x04,0xff,0xd5,0x00,0x2e,0xff,0xe4,0x0c,0x00,0x31,0xf5,0x0b,0xd6,0x55,
-0x05,0x06,0xf8,0x0d,0x04,0x00,0x30,0x04,0x08,0x00,0x30,0x11,0x11,0x1f,0xfb,0x48,
-0x03,0x5a,0x1f,0xf0,0x01,0x80,0x06,0xcc,0xdc,0xcf,0xfc,0xce,0xcc,0x60,0x00,0x1e,
-0xb0,0x0f,0xf0,0x0d,0xe1,0xf5,0x1d,0xd4,0x2f,0xe0,0x4f,0xa0,0x00,0x00,0x08,0xd4,
-0x4f,0xd0,0x9f,0x20,0x00,0xd5,0x28,0x12,0x2e,0x10,0x02,0x11,0xe2,0x1b,0x0f,0x21,
-0x30,0x00,0x71,0x32,0x21,0x6f,0xd2,0x86,0x0f,0x60,0xd1,0x0b,0xfe,0x50,0x00,0x06,
-0x8f,0x47,0x60,0xaf,0xfd,0x81,0x0c,0xfe,0x70,0x58,0x2e,0x13,0xc0,0xd8,0x2e,0x43,
-0x20,0x00,0x6a,0x30,0x1e,0x31,0xf0,0x02,0x20,0x05,0xcc,0xcc,0xcd,0x70,0x00,0xdf,
-0x00,0x06,0xee,0xee,0xff,0xd0,0x49,0xff,0x99,0x3c,0x03,0x20,0x30,0x6f,0xd0,0x04,
-0xe0,0x1d,0xf5,0x00,0x07,0xf8,0x2e,0xd0,0x00,0xaf,0x70,0x00,0x09,0xf3,0x1f,0x07,
-0x54,0x50,0x00,0x0c,0xf0,0x4f,0x9f,0x08,0x06,0xb2,0x1f,0xe1,0x9f,0x4d,0xdd,0xff,
-0xed,0xd6,0x0a,0xfe,0xee,0x25,0x4a,0x22,0x6f,0xfb,0x08,0x00,0x30,0x3f,0xff,0x90,
-0x08,0x00,0x40,0x04,0xff,0x7e,0xf1,0x08,0x00,0xbe,0x6f,0xf6,0x03,0x50,0xbc,0xff,
-0x30,0x00,0x0b,0x40,0x00,0xf3,0x27,0x01,0xdd,0x61,0x40,0x00,0x00,0x0d,0xd3,0xb7,
-0x1a,0x02,0x49,0x59,0x10,0x00,0xcf,0x30,0xa0,0x90,0x43,0x00,0x4a,0xfd,0x99,0x11,
-0xff,0x23,0xfd,0xd8,0x08,0xf0,0x02,0x09,0xf9,0x00,0xbf,0x70,0x19,0xf4,0xcf,0x4f,
-0xf4,0x45,0x8f,0xe0,0x0b,0xf0,0xdd,0xbf,0x61,0x04,0xb0,0x0e,0xd0,0xfc,0x5d,0xb9,
-0x86,0x55,0xf6,0x2f,0xa3,0xf8,0x64,0x13,0x51,0x20,0x2e,0xfc,0xf5,0x0f,0x8b,0x3f,
-0xf0,0x04,0xdf,0xf1,0x0f,0xe9,0x99,0xaf,0xb0,0x00,0x5f,0xf9,0x0f,0xc0,0x00,0x1f,
-0xb0,0x01,0xef,0xdf,0x3f,0x08,0x00,0x31,0x3e,0xf5,0x17,0x20,0x00,0x20,0x1c,0x40,
-0x68,0x09,0x28,0xbf,0xb0,0x9f,0x11,0x01,0x40,0x2e,0x63,0x7e,0xee,0xee,0xee,0xff,
-0xfb,0xd5,0x44,0x12,0xa0,0x5e,0x49,0x12,0xf6,0x1a,0x05,0x25,0xfb,0x10,0xf8,0x22,
-0x01,0x50,0x33,0x45,0xfe,0xdd,0xdd,0xd6,0x48,0x2f,0x02,0x81,0x4b,0x05,0x20,0x00,
-0x0e,0x08,0x00,0x32,0xae,0xef,0xf1,0xc7,0x03,0x2a,0xfd,0x70,0x39,0x1c,0x02,0xbe,
-0x4d,0x01,0xc5,0x31,0x04,0x7c,0x0c,0x01,0x1c,0x10,0x21,0xfd,0xdf,0x1f,0x00,0x20,
-0xfd,0x89,0xc4,0x07,0x71,0xd3,0x98,0x00,0x2c,0xcc,0xcd,0xff,0xb9,0x1a,0x22,0x3d,
-0xfa,0x0a,0x13,0x14,0x60,0x88,0x06,0x00,0x96,0x15,0x00,0x04,0x00,0x02,0xf3,0x26,
-0x14,0x00,0x07,0x00,0x32,0x0b,0xee,0xfe,0x11,0x33,0x12,0xc5,0xd9,0x04,0x13,0xa5,
-0xbf,0x0f,0x11,0xf9,0xbe,0x1b,0x30,0xbb,0xbe,0xfd,0x31,0x0b,0x14,0x1f,0x50,0x19,
-0x31,0x12,0xdf,0x61,0xa4,0x14,0x70,0x07,0xfc,0x1a,0xaa,0xaa,0xa8,0x00,0x8d,0x5e,
-0x00,0xe3,0x06,0x90,0x03,0xef,0xb0,0x01,0x11,0x7f,0xe2,0x00,0x4f,0x28,0x44,0xe2,
-0xfd,0x10,0x00,0x5f,0xdf,0xa4,0x99,0x9c,0xfd,0x99,0x93,0x07,0x4f,0xa6,0xa1,0x13,
-0x70,0x4f,0xa1,0x22,0x27,0xfa,0x22,0x20,0xa5,0x29,0x11,0x05,0x0c,0x45,0x41,0xa0,
-0x07,0xce,0xf8,0x08,0x00,0x39,0x05,0xff,0xc2,0xcf,0x50,0x40,0x16,0x50,0x00,0x40,
-0x78,0x34,0x40,0x2f,0xe1,0x08,0xfb,0x5f,0x2c,0x55,0x0a,0xf4,0x2f,0xe1,0x00,0x38,
-0x18,0x21,0xfa,0xaa,0x8c,0x15,0x22,0x0e,0xe0,0xfc,0x32,0x20,0x07,0x63,0x24,0x0d,
-0x82,0x36,0x70,0x00,0x02,0x99,0x99,0xdf,0xf8,0x6d,0x1a,0x20,0xfb,0x30,0xb8,0x00,
-0x01,0xe0,0x1e,0x14,0xb1,0xce,0x4f,0x0e,0xe8,0x1e,0x32,0xac,0xdf,0xd0,0xaa,0x1d,
-0x03,0x0f,0x27,0x25,0x02,0xa9,0x8f,0x56,0x00,0xec,0x36,0x44,0xff,0xdb,0xbb,0xb9,
-0x20,0x0d,0x81,0x21,0x11,0x11,0x11,0x14,0xfc,0xdf,0x66,0x4f,0x45,0x00,0x50,0x1e,
-0x20,0x03,0x70,0x57,0x1e,0x20,0x27,0xdf,0x94,0x41,0x40,0xad,0xff,0xfc,0x71,0x20,
-0x07,0x21,0xb7,0x20,0x96,0x35,0x01,0xac,0x05,0x00,0x73,0x1e,0x20,0x04,0xf7,0x3a,
-0x67,0x00,0x0b,0x41,0x30,0x8f,0xfe,0xee,0x0c,0x1c,0x10,0x1a,0x83,0x07,0x00,0xc7,
-0x07,0x13,0x26,0x4c,0x03,0x01,0x77,0x1c,0x83,0x09,0xcc,0xcc,0xdf,0xfd,0xcc,0xcc,
-0xa0,0x12,0x33,0xb0,0xc0,0x0b,0xf3,0x00,0x77,0x20,0x00,0x4f,0xc0,0x08,0xc2,0xbc,
-0x23,0x60,0x3c,0x90,0x02,0x22,0x29,0xfd,0x9f,0x18,0x04,0xd2,0x05,0x80,0x0a,0xaa,
-0xff,0xda,0xab,0xff,0xba,0xa0,0xd6,0x4a,0x21,0x09,0xfc,0xf9,0x1c,0x32,0xb5,0x4f,
-0xf4,0x3c,0x64,0x01,0x43,0x57,0x00,0xaa,0x56,0xc0,0xfb,0x40,0x00,0x03,0x7a,0xef,
-0xfc,0x48,0xff,0xfc,0x30,0x08,0x0d,0x00,0x32,0x18,0xff,0x80,0x8f,0x1d,0x01,0xe0,
-0x4c,0x23,0x16,0x60,0x2a,0x06,0x10,0xe0,0xfe,0x01,0x83,0xdd,0xdd,0xef,0xfe,0xdd,
-0xdd,0xb0,0x0d,0x80,0x00,0x12,0x0d,0x98,0x58,0x30,0xc0,0x0d,0xf3,0x0f,0x00,0x40,
-0x4f,0xc0,0x01,0x12,0x65,0x02,0x2c,0x11,0x10,0x72,0x33,0x80,0x1c,0xcc,0xdf,0xfc,
-0xdf,0xfc,0xcc,0xc1,0xc2,0x01,0x22,0x1f,0xd0,0x1f,0x50,0xf2,0x08,0x1f,0xd0,0x02,
-0x30,0x00,0x05,0xff,0x10,0x1f,0xd0,0x06,0xf5,0x19,0xdf,0xf6,0x00,0x0f,0xfc,0xbe,
-0xf2,0x0c,0xfb,0x30,0x92,0x36,0x06,0xe3,0x01,0x27,0x16,0x60,0xc2,0x06,0x12,0x0b,
-0x22,0x03,0x14,0xc0,0xc9,0x1a,0x22,0x0d,0xf0,0x2d,0x36,0x20,0x0d,0xf5,0x78,0x00,
-0x40,0x6f,0xe0,0x02,0x26,0x17,0x00,0x72,0x72,0x20,0x00,0x01,0x10,0x0f,0xf0,0xcd,
-0x2d,0x01,0x08,0x00,0x00,0x09,0x22,0x01,0x12,0x36,0x60,0x6f,0xf3,0x0f,0xfd,0xdd,
-0xd4,0x6b,0x4d,0x21,0x0f,0xf0,0xe8,0x05,0x31,0xaf,0xdf,0xf0,0x18,0x09,0x10,0x0a,
-0xea,0x04,0x64,0xe4,0x1c,0xa0,0x00,0x39,0xde,0x12,0x35,0x02,0xe2,0x01,0x13,0x77,
-0x93,0x18,0x14,0x20,0x84,0x4f,0x22,0xfc,0xbf,0x56,0x0f,0xf0,0x04,0xbf,0x29,0x91,
+0xc0,0x0c,0xf3,0x0a,0x80,0x00,0x03,0xff,0x40,0x40,0x00,0x21,0x2e,0xf9,0x48,0x00,
+0x31,0x07,0xff,0xc0,0x08,0x00,0x32,0x6f,0xfa,0x10,0x10,0x00,0x22,0x50,0x00,0x60,
+0x00,0x33,0x00,0x00,0x14,0x80,0x01,0x33,0xdf,0xa0,0x01,0x01,0x01,0x00,0x48,0x03,
+0xc0,0x5c,0xfe,0xa9,0x9a,0xff,0x60,0x00,0x02,0xee,0x89,0x50,0x3d,0xba,0x01,0x40,
+0x20,0x1c,0xfd,0xfe,0x1e,0x03,0xf0,0x17,0x47,0xbf,0xff,0xbe,0xd4,0x00,0x00,0x0b,
+0xff,0xfd,0x74,0xdf,0xf9,0x99,0x50,0x03,0x95,0x10,0x8f,0xff,0xff,0xff,0xe1,0x00,
+0x03,0x9e,0xfd,0x41,0x14,0xff,0x60,0x00,0x0a,0xfd,0x7a,0x90,0x4e,0xf9,0xc3,0x02,
+0x40,0x1b,0xfe,0xff,0x80,0x5f,0x00,0xf0,0x02,0x8d,0xff,0xd3,0x00,0x00,0x0a,0xde,
+0xff,0xff,0xb6,0x00,0x00,0x00,0x0a,0xfe,0xc9,0x61,0x66,0x00,0x25,0x01,0x10,0xfa,
+0x00,0x22,0x1f,0xf0,0x08,0x00,0x14,0x2f,0x08,0x00,0x12,0xe0,0x08,0x00,0x23,0x3f,
+0xe0,0x7d,0x04,0x10,0xd0,0x95,0x02,0x02,0x7a,0x02,0xe1,0xf1,0x0e,0xee,0xee,0xff,
+0xff,0xee,0xee,0xe1,0x00,0x00,0x00,0xcf,0xfb,0x1f,0x00,0x22,0x01,0xff,0x52,0x02,
+0x41,0x08,0xfb,0x9f,0xb0,0x3f,0x00,0x30,0xf5,0x2f,0xf5,0x17,0x00,0xf0,0x0a,0xdf,
+0xb0,0x08,0xff,0x40,0x00,0x00,0x2d,0xfe,0x10,0x00,0xcf,0xf5,0x00,0x08,0xff,0xe2,
+0x00,0x00,0x1c,0xff,0xc2,0x0c,0xfb,0x10,0x5d,0x01,0x21,0xc0,0x01,0x62,0x03,0x41,
+0x03,0x20,0x03,0xbb,0x01,0x00,0x13,0x30,0x60,0x04,0x90,0x40,0x01,0x33,0x33,0x5f,
+0xe3,0x33,0x33,0x10,0x49,0x00,0x00,0x78,0x00,0x04,0x08,0x00,0x93,0x0d,0xee,0xee,
+0xef,0xfe,0xee,0xee,0xd0,0x0e,0x88,0x04,0x00,0x80,0x00,0x11,0xfa,0x1f,0x00,0x22,
+0x04,0xff,0xbd,0x05,0x41,0x1e,0xf9,0x6f,0xe1,0x47,0x01,0xf0,0x08,0xd1,0x0b,0xfd,
+0x30,0x00,0x00,0x7f,0xfe,0x20,0x00,0xcf,0xf8,0x20,0x3f,0xff,0xb1,0x00,0x00,0x0a,
+0xff,0xf4,0x0a,0xc4,0x24,0x00,0x4d,0x4b,0xa0,0x00,0x00,0xf8,0x00,0x1b,0x1f,0xf8,
+0x00,0x01,0x08,0x00,0x40,0x0c,0xcc,0xcc,0xdf,0x10,0x05,0x03,0xf8,0x00,0x91,0xf3,
+0x02,0x22,0x22,0xaf,0xfd,0x22,0x22,0x20,0x12,0x02,0x11,0x20,0xbc,0x00,0x40,0xfe,
+0x8f,0x90,0x00,0x2a,0x00,0x30,0xf9,0x1f,0xf4,0x08,0x00,0x50,0x7f,0xf1,0x08,0xfd,
+0x10,0xc7,0x05,0xf6,0x0d,0xf8,0x00,0xdf,0xd1,0x00,0x01,0x9f,0xfa,0xff,0x90,0x3f,
+0xfd,0x40,0x3f,0xff,0x80,0x3f,0xf7,0x03,0xff,0xf5,0x0b,0xc3,0x00,0x05,0xd2,0x00,
+0x1b,0x80,0x00,0x41,0x09,0x71,0x1f,0xe0,0x6e,0x00,0x12,0xf1,0x08,0x00,0x22,0x7f,
+0xd0,0x08,0x00,0x12,0xdf,0xd0,0x02,0x20,0x05,0xff,0xf0,0x00,0x51,0xec,0x00,0x1e,
+0xf7,0x00,0x18,0x00,0x22,0x03,0x90,0x08,0x01,0x13,0x2c,0x98,0x00,0x15,0x2f,0x98,
+0x00,0x31,0x23,0xff,0xfe,0x98,0x00,0x31,0x09,0xfd,0xcf,0x90,0x00,0x30,0x9f,0xf4,
+0x2f,0xff,0x01,0xa0,0x4d,0xff,0x60,0x04,0xff,0xd5,0x00,0x2e,0xff,0xe4,0x0c,0x00,
+0x31,0xf5,0x0b,0xd6,0x55,0x05,0x17,0xc0,0x00,0x01,0x28,0x0f,0xf1,0x08,0x00,0x82,
+0x11,0x11,0x1f,0xf2,0x11,0x11,0x00,0x08,0x58,0x00,0xf3,0x13,0x80,0x06,0xcc,0xdc,
+0xcf,0xfc,0xce,0xcc,0x60,0x00,0x1e,0xb0,0x0f,0xf0,0x0d,0xe1,0x00,0x00,0x0c,0xf1,
+0x2f,0xe0,0x4f,0xa0,0x00,0x00,0x08,0xd4,0x4f,0xd0,0x9f,0x20,0x00,0x2f,0x28,0x06,
+0x12,0x2e,0x10,0x02,0x10,0xe2,0x22,0x03,0x02,0x88,0x01,0xf0,0x08,0x1d,0xf9,0x6f,
+0xd2,0x00,0x00,0x00,0x05,0xef,0xd1,0x0b,0xfe,0x50,0x00,0x06,0xcf,0xfc,0x10,0x00,
+0xaf,0xfd,0x81,0x0c,0x5b,0x07,0x52,0x05,0xdf,0xc0,0x02,0x50,0xf8,0x01,0x23,0x00,
+0x6a,0xf8,0x03,0xf0,0x03,0xbf,0x20,0x05,0xcc,0xcc,0xcd,0x70,0x00,0xdf,0x00,0x06,
+0xee,0xee,0xff,0xd0,0x49,0xff,0x99,0x3c,0x03,0x20,0x30,0x6f,0xd0,0x04,0xf0,0x08,
+0x1d,0xf5,0x00,0x07,0xf8,0x2e,0xd0,0x00,0xaf,0x70,0x00,0x09,0xf3,0x1f,0xb0,0x00,
+0xbf,0x40,0x00,0x0c,0xf0,0x4f,0x9f,0x08,0x06,0xc0,0x1f,0xe1,0x9f,0x4d,0xdd,0xff,
+0xed,0xd6,0x0a,0xfe,0xee,0x00,0x18,0x00,0x32,0x00,0x6f,0xfb,0x08,0x00,0x30,0x3f,
+0xff,0x90,0x08,0x00,0x40,0x04,0xff,0x7e,0xf1,0x08,0x00,0xfe,0x00,0x6f,0xf6,0x03,
+0x50,0xbc,0xff,0x30,0x00,0x0b,0x40,0x00,0x00,0x9f,0xe9,0x00,0x01,0x00,0xc0,0xde,
+0x00,0x00,0x0d,0xd3,0x00,0x00,0x00,0xfd,0x00,0x00,0x3f,0x09,0x01,0xf0,0x14,0xfb,
+0x00,0x00,0x9f,0x90,0x43,0x00,0x4a,0xfd,0x99,0x11,0xff,0x23,0xfd,0x00,0x7f,0xff,
+0xff,0x09,0xf9,0x00,0xbf,0x70,0x19,0xf4,0xcf,0x4f,0xf4,0x45,0x8f,0xe0,0x0b,0xf0,
+0xdd,0xbf,0x61,0x04,0xf0,0x05,0x0e,0xd0,0xfc,0x5d,0xb9,0x86,0x55,0xf6,0x2f,0xa3,
+0xf8,0x01,0x11,0x11,0x11,0x20,0x2e,0xfc,0xf5,0x0f,0xb9,0x03,0xf0,0x05,0x02,0xdf,
+0xf1,0x0f,0xe9,0x99,0xaf,0xb0,0x00,0x5f,0xf9,0x0f,0xc0,0x00,0x1f,0xb0,0x01,0xef,
+0xdf,0x3f,0x08,0x00,0x31,0x3e,0xf5,0x17,0x20,0x00,0x85,0x1c,0x40,0x00,0x0f,0xfb,
+0xbb,0xbf,0xb0,0x80,0x00,0x11,0x7f,0x27,0x07,0x82,0x00,0x00,0x7e,0xee,0xee,0xee,
+0xff,0xfb,0x1b,0x02,0x21,0xff,0xa0,0xd9,0x02,0x22,0xef,0xf6,0x1a,0x05,0x22,0xfb,
+0x10,0x08,0x00,0x10,0xf3,0x5e,0x01,0x82,0xdd,0xdd,0xdf,0xfe,0xdd,0xdd,0xd6,0x1f,
+0x80,0x01,0x10,0xf7,0x18,0x00,0x26,0xf4,0x00,0x20,0x00,0x0e,0x08,0x00,0x32,0xae,
+0xef,0xf1,0xc7,0x03,0x1a,0xfd,0xdd,0x08,0x31,0x01,0x65,0x00,0x8b,0x01,0x23,0xff,
+0x20,0x75,0x02,0x40,0xff,0xfd,0xdf,0xcc,0x01,0x00,0x21,0xfd,0xdf,0x1f,0x00,0x20,
+0xfd,0x89,0xc4,0x07,0x80,0xd3,0x98,0x00,0x2c,0xcc,0xcd,0xff,0xd1,0x13,0x00,0x12,
+0x3d,0x71,0x03,0x24,0xff,0x60,0x88,0x06,0x40,0xff,0xcc,0xcc,0xcc,0x04,0x00,0x00,
+0x15,0x00,0x12,0x00,0x1c,0x00,0x01,0x79,0x00,0x11,0xee,0xac,0x06,0x32,0x05,0xff,
+0xc5,0xd9,0x04,0x12,0xa5,0x1c,0x00,0x20,0x08,0xf9,0x06,0x00,0x93,0x1b,0xbb,0xbe,
+0xfd,0xbb,0xbb,0xbb,0xb1,0x1f,0x51,0x04,0xf0,0x05,0x01,0x12,0xdf,0x61,0x11,0x11,
+0x11,0x10,0x00,0x07,0xfc,0x1a,0xaa,0xaa,0xa8,0x00,0x00,0x2f,0xf3,0x2f,0xe3,0x06,
+0xf0,0x0c,0x03,0xef,0xb0,0x01,0x11,0x7f,0xe2,0x00,0x4f,0xff,0xa0,0x00,0x04,0xfd,
+0x10,0x00,0x5f,0xdf,0xa4,0x99,0x9c,0xfd,0x99,0x93,0x07,0x4f,0xa6,0x38,0x00,0xe0,
+0xf5,0x00,0x4f,0xa1,0x22,0x27,0xfa,0x22,0x20,0x00,0x4f,0xa0,0x00,0x05,0x5a,0x00,
+0x51,0x4f,0xa0,0x07,0xce,0xf8,0x08,0x00,0x37,0x05,0xff,0xc2,0xe8,0x00,0x40,0x02,
+0x10,0x16,0x50,0xd0,0x07,0xf3,0x01,0x4f,0xc0,0x2f,0xe1,0x08,0xfb,0x00,0x00,0x0c,
+0xf5,0x0a,0xf4,0x2f,0xe1,0x00,0x0e,0x5a,0x07,0x91,0x0e,0xfa,0xaa,0xaa,0xaa,0xaa,
+0xaf,0xf0,0x0e,0x7e,0x03,0xf1,0x01,0x0e,0xf0,0x07,0x63,0xff,0xff,0xff,0xfe,0x36,
+0x70,0x00,0x02,0x99,0x99,0xdf,0xf8,0x42,0x00,0x30,0x0d,0xfb,0x30,0xb8,0x00,0x36,
+0xbb,0xbf,0xfb,0xb8,0x00,0x14,0xf2,0x39,0x09,0x06,0x08,0x00,0x22,0xac,0xdf,0xb1,
+0x04,0x32,0x5f,0xfc,0x40,0x79,0x00,0x12,0xa9,0x20,0x05,0x00,0xdc,0x07,0x72,0x9b,
+0xbb,0xbb,0xff,0xdb,0xbb,0xb9,0x68,0x01,0xf0,0x14,0xfc,0xdf,0x21,0x11,0x11,0x11,
+0x14,0xfc,0xdf,0x66,0x10,0x00,0x00,0x03,0xfc,0x00,0xcf,0x40,0x00,0x03,0x70,0x00,
+0x00,0xcf,0x40,0x27,0xdf,0xfa,0x00,0x00,0xcf,0xad,0xff,0xfc,0x71,0x20,0x07,0x20,
+0xb7,0x20,0xe5,0x04,0x10,0x70,0xac,0x05,0x00,0x23,0x00,0xf0,0x04,0x00,0x04,0xf7,
+0x00,0xbf,0x60,0x00,0x00,0x09,0xf8,0x00,0x8f,0xfe,0xee,0xee,0xef,0xf3,0x00,0x1a,
+0x83,0x07,0x00,0xc7,0x07,0x23,0x26,0x30,0x4c,0x02,0x10,0xc0,0x3e,0x02,0x82,0xcc,
+0xcc,0xdf,0xfd,0xcc,0xcc,0xa0,0x0b,0xa9,0x00,0xf4,0x0a,0xc0,0x0b,0xf3,0x00,0x77,
+0x20,0x00,0x4f,0xc0,0x08,0xc2,0x02,0xff,0x30,0x00,0x3c,0x90,0x02,0x22,0x29,0xfd,
+0x22,0x22,0x22,0x20,0xd2,0x05,0xe0,0x0a,0xaa,0xff,0xda,0xab,0xff,0xba,0xa0,0x00,
+0x04,0xff,0x20,0x09,0xfc,0x04,0x01,0x40,0xff,0xb5,0x4f,0xf4,0xc0,0x00,0x10,0x8d,
+0x50,0x09,0x01,0xcb,0x03,0xd0,0xff,0xfb,0x40,0x00,0x03,0x7a,0xef,0xfc,0x48,0xff,
+0xfc,0x30,0x08,0x0d,0x00,0x50,0x18,0xff,0x80,0x00,0x73,0x1c,0x00,0x10,0x27,0x05,
+0x00,0x23,0x16,0x60,0x2a,0x06,0x10,0xe0,0xfe,0x01,0x83,0xdd,0xdd,0xef,0xfe,0xdd,
+0xdd,0xb0,0x0d,0x80,0x00,0x21,0x0d,0xf0,0x4d,0x06,0x30,0xc0,0x0d,0xf3,0x0f,0x00,
+0x40,0x4f,0xc0,0x01,0x12,0x65,0x02,0x15,0x11,0x80,0x06,0x13,0x2f,0x88,0x00,0x80,
+0x1c,0xcc,0xdf,0xfc,0xdf,0xfc,0xcc,0xc1,0xc2,0x01,0x11,0x1f,0x4a,0x01,0xf6,0x10,
+0x8f,0x70,0x1f,0xd0,0x02,0x30,0x00,0x05,0xff,0x10,0x1f,0xd0,0x06,0xf5,0x19,0xdf,
+0xf6,0x00,0x0f,0xfc,0xbe,0xf2,0x0c,0xfb,0x30,0x00,0x08,0xef,0xff,0x90,0x01,0xe3,
+0x01,0x27,0x16,0x60,0xc2,0x06,0x12,0x0b,0x22,0x03,0x23,0xc0,0x0d,0x2a,0x06,0x02,
+0x80,0x00,0x40,0x1f,0xe0,0x0d,0xf5,0x78,0x00,0x40,0x6f,0xe0,0x02,0x26,0x17,0x00,
+0x52,0x72,0x20,0x00,0x01,0x10,0xb9,0x01,0x42,0x0e,0xf1,0x0f,0xf0,0x3e,0x00,0x10,
+0x0f,0x58,0x02,0xd1,0x00,0x6f,0xf3,0x0f,0xfd,0xdd,0xd4,0x00,0x00,0xaf,0xfc,0x0f,
+0xf0,0xe8,0x05,0x31,0xaf,0xdf,0xf0,0x18,0x09,0x10,0x0a,0xea,0x04,0x62,0xe4,0x1c,
+0xa0,0x00,0x39,0xde,0x82,0x06,0x04,0x4a,0x03,0x12,0x77,0xf0,0x01,0x00,0x4a,0x03,
+0x12,0xbf,0xe2,0x01,0xf0,0x0b,0xbf,0xcb,0xbb,0xbb,0xbb,0xbc,0xfc,0xbf,0x29,0x91,
 0x3b,0x80,0x03,0xfc,0x69,0x2c,0xfd,0x6f,0xa0,0x02,0x97,0x01,0x70,0x87,0x6f,0x90,
-0xa9,0x05,0x11,0x30,0x77,0x24,0xd1,0x7e,0x20,0xbf,0x50,0x00,0x00,0x78,0x89,0x88,
-0xef,0xa8,0x88,0x88,0x1a,0x02,0x00,0x72,0x18,0x30,0x4f,0xf5,0x84,0x61,0x4d,0xe0,
-0xff,0x84,0xff,0xe8,0x10,0x5c,0xff,0xf6,0x00,0x28,0xef,0xf8,0x1f,0xd8,0x58,0x06,
-0x17,0xe5,0x83,0x36,0x03,0xf0,0x00,0x01,0x79,0x06,0x14,0x0c,0xda,0x13,0x03,0xc9,
-0x02,0xf0,0x10,0x0c,0xf0,0x5d,0x70,0x03,0xc5,0x0e,0xf0,0x05,0x67,0xfe,0x33,0x44,
-0xef,0xa6,0x60,0x02,0xdf,0xe3,0x2e,0xf6,0x1a,0xfe,0x20,0x00,0xba,0x12,0xdf,0xff,
-0x80,0x8b,0xa1,0x02,0x20,0xf6,0x1c,0x5e,0x52,0x83,0x4c,0xff,0x40,0x01,0xaf,0xfa,
-0x30,0x3d,0x41,0x20,0x80,0x0b,0xab,0xfb,0x99,0x99,0xaf,0xe6,0xa0,0x00,0x48,0x01,
-0xa5,0x40,0x00,0x29,0x25,0x26,0xbf,0xd0,0x22,0x36,0x10,0x00,0x5a,0x4c,0x02,0xe8,
-0x01,0x08,0x29,0x1c,0x30,0x0d,0xf8,0x88,0x60,0x0a,0xb1,0xe0,0x0d,0xf4,0x5f,0xe4,
-0x4e,0xf5,0x4f,0xe0,0x04,0x6f,0x99,0x04,0x74,0x50,0x00,0x00,0x1b,0xa0,0x0a,0xb1,
-0xd9,0x0d,0x10,0xf1,0x03,0x25,0x40,0xaa,0xaa,0xaf,0xf1,0x5c,0x00,0x31,0x5e,0x90,
-0x0e,0x08,0x00,0x22,0x7f,0xc5,0x08,0x00,0xf0,0x09,0xcf,0xff,0x1d,0xe3,0x30,0x00,
-0x01,0x5c,0xfd,0xef,0x10,0x04,0xf5,0x16,0xae,0xff,0xa1,0xcf,0xb9,0xae,0xf3,0x0c,
-0xfe,0x92,0xb0,0x2c,0x03,0x8a,0x34,0x0a,0x27,0x42,0x08,0x08,0x00,0x00,0x67,0x53,
-0x25,0x25,0xfc,0x67,0x53,0x40,0xf6,0x0c,0xcc,0xcc,0xe1,0x2f,0x15,0xc5,0x28,0x00,
-0x22,0x3d,0xb0,0x08,0x00,0x21,0x0c,0xfa,0x08,0x00,0x00,0x9f,0x1a,0x12,0x04,0x78,
-0x22,0x22,0x80,0x04,0xd4,0x0f,0x04,0x50,0x00,0x33,0x10,0x05,0xfc,0x86,0x18,0x2b,
-0xfa,0x00,0x4e,0x32,0x04,0x01,0x00,0x14,0xfe,0x08,0x00,0x00,0x89,0x16,0x13,0xe5,
-0x08,0x00,0x10,0xf4,0x08,0x00,0x40,0x01,0x00,0x0c,0xf4,0xcb,0x05,0xc1,0x1d,0xa0,
-0x1f,0xe2,0xcc,0xcc,0xff,0xc7,0x0b,0xf8,0x6f,0x90,0x18,0x00,0x40,0xdf,0xef,0x40,
-0xab,0x38,0x00,0x60,0x2f,0xfe,0x00,0x9f,0x60,0xfe,0xa5,0x17,0x40,0x10,0x1f,0xe0,
-0xfe,0xfa,0x05,0xf0,0x02,0xc0,0x09,0xe2,0xfe,0x00,0x04,0xff,0x4d,0xf5,0x01,0x00,
-0xfe,0x00,0x4f,0xf7,0x03,0xa0,0x30,0x00,0x10,0x0c,0x75,0x28,0x23,0xee,0xfd,0xbf,
-0x1a,0x16,0xd4,0x7b,0x00,0x04,0x68,0x24,0x22,0xff,0xaa,0x84,0x1a,0x67,0xff,0x99,
-0x99,0x99,0x9d,0xf3,0x18,0x00,0x10,0x10,0xfc,0x52,0xf2,0x02,0x50,0x00,0xdf,0xc9,
-0x99,0x99,0x99,0xcf,0xb0,0x00,0x3a,0xde,0xff,0xff,0xff,0xeb,0x20,0xcd,0x05,0x06,
-0xc2,0x09,0x30,0x0c,0xcd,0xfd,0x20,0x01,0x72,0xc1,0x00,0x09,0xfd,0x20,0x01,0xfd,
-0x7b,0x08,0x02,0x08,0x00,0x23,0x06,0x3a,0xd2,0x16,0x38,0x0a,0xff,0xc4,0x29,0x06,
-0x00,0x1d,0x00,0x00,0xbb,0x0f,0x11,0xf8,0x08,0x00,0x10,0x01,0xaf,0x06,0x00,0x08,
-0x00,0xf0,0x00,0xfd,0xaa,0xfa,0x11,0x11,0xdf,0x11,0x01,0xfc,0x66,0xfa,0xcf,0xff,
-0xff,0xf8,0x18,0x00,0x84,0xac,0xcc,0xff,0xc6,0x01,0xfb,0x34,0xfa,0x28,0x00,0xb0,
-0x6f,0x30,0xdf,0x00,0x01,0xfa,0x23,0xfa,0x2f,0xc0,0xdf,0x12,0x0e,0xf1,0x01,0xfa,
-0x09,0xf3,0xdf,0x00,0x29,0x9b,0xff,0xfa,0x03,0xf5,0xdf,0x00,0x00,0x1d,0xf5,0x28,
-0x00,0x31,0x07,0xef,0x50,0x08,0x00,0xe6,0x3f,0xc2,0x7a,0xf9,0x03,0xdd,0xfd,0x00,
-0x02,0x00,0x8f,0xd3,0x00,0xee,0x81,0x00,0x00,0x6f,0x26,0x22,0x09,0xb5,0x08,0x00,
-0x80,0x9f,0xf9,0x77,0x50,0x04,0x0c,0xf1,0x3c,0x81,0x05,0xf0,0x08,0x4f,0xac,0xf5,
-0xff,0xa5,0x02,0xcf,0x80,0x0a,0xff,0xf1,0x53,0xcf,0x8e,0xfc,0x00,0x00,0xad,0xf1,
-0x01,0x7f,0xff,0xa0,0x81,0x1d,0x40,0xcf,0xff,0xd6,0xb8,0x30,0x00,0x30,0xdf,0xa5,
-0x01,0x7a,0x1f,0x91,0xf6,0xed,0xcc,0xcd,0xff,0xc6,0x08,0xff,0xf7,0x99,0x02,0xe0,
-0x5f,0xdd,0xf1,0x2c,0xa0,0x01,0xfb,0x00,0x07,0x0c,0xf1,0x0b,0xf8,0x01,0x11,0x06,
-0x32,0xf1,0x01,0xea,0x08,0x00,0x32,0x00,0x04,0xbc,0x08,0x00,0x4e,0x01,0xff,0xc3,
-0x00,0x2a,0x09,0x0b,0x08,0x00,0x10,0x02,0x08,0x00,0x10,0x40,0xe1,0x33,0x20,0x0f,
-0xf1,0x3b,0x1f,0x60,0x9f,0xa0,0x0f,0xf1,0x09,0xfa,0xcd,0x4b,0x10,0x0f,0x7a,0x60,
-0xa0,0x02,0xff,0x10,0x0f,0xf1,0x00,0xbf,0x90,0x08,0xfb,0x28,0x00,0x40,0x4f,0xf0,
-0x1f,0xf5,0x08,0x00,0x40,0x0f,0xf5,0x4e,0xc0,0x08,0x00,0x40,0x0a,0xf9,0x01,0x20,
-0x08,0x00,0x26,0x05,0x60,0x58,0x00,0x23,0xce,0xff,0xed,0x4d,0x2e,0xfc,0x50,0x93,
-0x38,0x40,0x10,0x00,0x2f,0xfd,0x6e,0x31,0x12,0x10,0x08,0x0a,0x1e,0xef,0x08,0x00,
-0x13,0x3f,0x28,0x00,0x70,0x3f,0xfc,0xcc,0xff,0xdc,0xcc,0x10,0xca,0x0c,0x01,0xcf,
-0x24,0x50,0x7f,0x90,0x00,0x4f,0xc0,0xd6,0x02,0x10,0x60,0x5f,0x44,0x01,0x79,0x24,
-0x10,0x05,0x69,0x6e,0x01,0xb9,0x49,0x10,0xf6,0x62,0x0a,0x00,0xf2,0x01,0x31,0xe3,
-0x1c,0xd0,0x9c,0x27,0x33,0xc0,0x00,0x20,0x18,0x0e,0x03,0x6a,0x38,0x01,0x68,0x02,
-0x53,0x99,0xbf,0xb0,0x00,0xfe,0x5c,0x25,0x05,0x18,0x00,0xa1,0x88,0x88,0x9b,0xff,
-0xa8,0x60,0x00,0xfe,0x27,0x9c,0x9e,0x55,0xc0,0xfe,0x3e,0xcb,0xfd,0x21,0x35,0x00,
-0x01,0xfd,0x13,0x58,0xff,0x50,0x16,0xf0,0x10,0xfb,0x8f,0xff,0xfe,0x97,0x42,0x10,
+0xa9,0x05,0x20,0x30,0x7f,0x99,0x07,0xe2,0x7e,0x20,0xbf,0x50,0x00,0x00,0x78,0x89,
+0x88,0xef,0xa8,0x88,0x88,0xdf,0xae,0x00,0xf0,0x08,0x00,0x00,0x4f,0xf5,0x84,0x00,
+0x00,0x00,0x18,0xff,0x84,0xff,0xe8,0x10,0x5c,0xff,0xf6,0x00,0x28,0xef,0xf8,0x1f,
+0xd8,0x58,0x06,0x16,0xe5,0xf1,0x00,0x13,0x03,0xf0,0x00,0x01,0x79,0x06,0x13,0x0c,
+0xc9,0x02,0x13,0x0c,0xc9,0x02,0xf0,0x10,0x0c,0xf0,0x5d,0x70,0x03,0xc5,0x0e,0xf0,
+0x05,0x67,0xfe,0x33,0x44,0xef,0xa6,0x60,0x02,0xdf,0xe3,0x2e,0xf6,0x1a,0xfe,0x20,
+0x00,0xba,0x12,0xdf,0xff,0x80,0x8b,0xa1,0x02,0xe2,0xf6,0x1c,0xfc,0x20,0x00,0x00,
+0x4c,0xff,0x40,0x01,0xaf,0xfa,0x30,0x3d,0x40,0x00,0xe0,0xf6,0x0b,0xab,0xfb,0x99,
+0x99,0xaf,0xe6,0xa0,0x00,0x09,0xf4,0x00,0x00,0x81,0x01,0x50,0x09,0xfc,0xbb,0xbb,
+0xbf,0x08,0x00,0x00,0x1f,0x00,0x11,0xd0,0x78,0x00,0x13,0x50,0xe8,0x01,0x00,0xfe,
+0x02,0x05,0x60,0x01,0x20,0xf8,0x88,0x60,0x0a,0xb1,0xe0,0x0d,0xf4,0x5f,0xe4,0x4e,
+0xf5,0x4f,0xe0,0x04,0x6f,0x99,0x04,0x81,0x50,0x00,0x00,0x1b,0xa0,0x0a,0xb1,0x00,
+0xdf,0x0a,0x00,0x01,0x0d,0x70,0x00,0x1f,0xfa,0xaa,0xaa,0xaf,0xf1,0x5c,0x00,0x31,
+0x5e,0x90,0x0e,0x08,0x00,0x22,0x7f,0xc5,0x08,0x00,0xf6,0x10,0xcf,0xff,0x1d,0xe3,
+0x30,0x00,0x01,0x5c,0xfd,0xef,0x10,0x04,0xf5,0x16,0xae,0xff,0xa1,0xcf,0xb9,0xae,
+0xf3,0x0c,0xfe,0x92,0x00,0x4d,0xff,0xff,0x90,0x01,0x20,0x6a,0x01,0x2e,0x04,0xfc,
+0x08,0x00,0x93,0x02,0x22,0x22,0x22,0x25,0xfc,0x22,0x20,0x1f,0xc8,0x00,0x85,0x0c,
+0xcc,0xcc,0xcc,0xcd,0xff,0xcc,0xc5,0x28,0x00,0x22,0x3d,0xb0,0x08,0x00,0x22,0x0c,
+0xfa,0x08,0x00,0x32,0x01,0xef,0x60,0x40,0x00,0x22,0x5f,0x80,0x08,0x00,0x14,0x01,
+0x50,0x00,0x22,0x10,0x05,0x08,0x00,0x10,0xaf,0x91,0x05,0x01,0x10,0x0e,0x1c,0xa1,
+0x2f,0x06,0x15,0xfe,0x08,0x00,0x43,0x5f,0xff,0xff,0xe5,0x08,0x00,0x10,0xf4,0x08,
+0x00,0x40,0x01,0x00,0x0c,0xf4,0xcb,0x05,0xc1,0x1d,0xa0,0x1f,0xe2,0xcc,0xcc,0xff,
+0xc7,0x0b,0xf8,0x6f,0x90,0x18,0x00,0x40,0xdf,0xef,0x40,0xab,0x38,0x00,0xe0,0x2f,
+0xfe,0x00,0x9f,0x60,0xfe,0x00,0x00,0x0c,0xfe,0x10,0x1f,0xe0,0xfe,0xfa,0x05,0xf0,
+0x02,0xc0,0x09,0xe2,0xfe,0x00,0x04,0xff,0x4d,0xf5,0x01,0x00,0xfe,0x00,0x4f,0xf7,
+0x03,0xa0,0x30,0x00,0x72,0x0c,0x80,0x00,0x00,0x03,0xee,0xfd,0x67,0x00,0x26,0xef,
+0xd4,0x7b,0x00,0x02,0xf1,0x07,0x70,0x00,0x00,0xff,0xaa,0xaa,0xaa,0xae,0x08,0x00,
+0x57,0x99,0x99,0x99,0x9d,0xf3,0x18,0x00,0x00,0x53,0x03,0xf2,0x03,0x1a,0x50,0x00,
+0xdf,0xc9,0x99,0x99,0x99,0xcf,0xb0,0x00,0x3a,0xde,0xff,0xff,0xff,0xeb,0x20,0xcd,
+0x05,0x06,0xc2,0x09,0x30,0x0c,0xcd,0xfd,0x20,0x01,0x72,0xc1,0x00,0x09,0xfd,0x20,
+0x01,0xfd,0x7b,0x08,0x02,0x08,0x00,0xe0,0x06,0x3a,0xab,0xfc,0x00,0x00,0x00,0x00,
+0x00,0x0a,0xff,0xc4,0x00,0x00,0x14,0x00,0x01,0x00,0xa1,0x01,0xfd,0x00,0x00,0x00,
+0xdf,0x00,0x00,0x05,0xf8,0x08,0x00,0x41,0x01,0xff,0xff,0xfa,0x08,0x00,0xf0,0x00,
+0xfd,0xaa,0xfa,0x11,0x11,0xdf,0x11,0x01,0xfc,0x66,0xfa,0xcf,0xff,0xff,0xf8,0x18,
+0x00,0x84,0xac,0xcc,0xff,0xc6,0x01,0xfb,0x34,0xfa,0x28,0x00,0xf1,0x10,0x6f,0x30,
+0xdf,0x00,0x01,0xfa,0x23,0xfa,0x2f,0xc0,0xdf,0x00,0x3f,0xff,0xff,0xfa,0x09,0xf3,
+0xdf,0x00,0x29,0x9b,0xff,0xfa,0x03,0xf5,0xdf,0x00,0x00,0x1d,0xf5,0x28,0x00,0x31,
+0x07,0xef,0x50,0x08,0x00,0xf5,0x01,0x3f,0xc2,0x7a,0xf9,0x03,0xdd,0xfd,0x00,0x02,
+0x00,0x8f,0xd3,0x00,0xee,0xc4,0x00,0x01,0x00,0x52,0x0c,0xf1,0x00,0x09,0xb5,0x08,
+0x00,0xf0,0x1c,0x9f,0xf9,0x77,0x50,0x04,0x0c,0xf1,0x3c,0xff,0xff,0xff,0xf2,0x4f,
+0xac,0xf5,0xff,0xa5,0x02,0xcf,0x80,0x0a,0xff,0xf1,0x53,0xcf,0x8e,0xfc,0x00,0x00,
+0xad,0xf1,0x01,0x7f,0xff,0xa0,0x00,0x00,0x0c,0xf4,0xcf,0xff,0xd6,0xb8,0x30,0x00,
+0xf0,0x15,0xdf,0xa5,0x01,0xfb,0x00,0x00,0x4f,0xf6,0xed,0xcc,0xcd,0xff,0xc6,0x08,
+0xff,0xf7,0xff,0xff,0xff,0xff,0xf7,0x5f,0xdd,0xf1,0x2c,0xa0,0x01,0xfb,0x00,0x07,
+0x0c,0xf1,0x0b,0xf8,0x01,0xfb,0x28,0x00,0x22,0x01,0xea,0x08,0x00,0x32,0x00,0x04,
+0xbc,0x08,0x00,0x47,0x01,0xff,0xc3,0x00,0x01,0x00,0x2f,0x0f,0xf1,0x08,0x00,0x01,
+0x10,0x02,0x08,0x00,0xf0,0x01,0x40,0x00,0x00,0x5f,0xd0,0x0f,0xf1,0x0e,0xf2,0x00,
+0x00,0x9f,0xa0,0x0f,0xf1,0x09,0xcb,0x00,0xf0,0x01,0x50,0x0f,0xf1,0x02,0xff,0x20,
+0x02,0xff,0x10,0x0f,0xf1,0x00,0xbf,0x90,0x08,0xfb,0x28,0x00,0x40,0x4f,0xf0,0x1f,
+0xf5,0x08,0x00,0x40,0x0f,0xf5,0x4e,0xc0,0x08,0x00,0x40,0x0a,0xf9,0x01,0x20,0x08,
+0x00,0x26,0x05,0x60,0x58,0x00,0x31,0xce,0xff,0xf0,0x08,0x00,0x38,0x7f,0xfc,0x50,
+0x7e,0x00,0x20,0x2f,0xff,0x01,0x00,0x70,0x10,0x00,0x2f,0xfd,0xdd,0xdd,0xdd,0x08,
+0x00,0x5e,0xd0,0x00,0x00,0x00,0xef,0x08,0x00,0x13,0x3f,0x28,0x00,0xd0,0x3f,0xfc,
+0xcc,0xff,0xdc,0xcc,0x10,0x00,0x5f,0xb0,0x00,0xaf,0x50,0x4f,0x00,0xf0,0x09,0x90,
+0x00,0x4f,0xc0,0x00,0x00,0x00,0xaf,0x60,0x00,0x0d,0xf5,0x00,0x00,0x00,0xff,0x20,
+0x00,0x05,0xff,0x30,0x00,0x05,0xfd,0x14,0x00,0xc0,0xf6,0x00,0x1e,0xf7,0x00,0x00,
+0x00,0x0a,0xff,0xe3,0x1c,0xd0,0x6d,0x00,0x41,0x6e,0xc0,0x00,0x20,0x76,0x00,0x31,
+0x10,0x00,0xff,0x01,0x00,0xb0,0xb0,0x00,0xff,0x99,0x99,0x99,0x99,0xbf,0xb0,0x00,
+0xfe,0x17,0x00,0x26,0x4f,0xb0,0x18,0x00,0xf0,0x3c,0x88,0x88,0x9b,0xff,0xa8,0x60,
+0x00,0xfe,0x27,0x9c,0xff,0xfe,0x80,0x00,0x00,0xfe,0x3e,0xcb,0xfd,0x21,0x35,0x00,
+0x01,0xfd,0x13,0x58,0xff,0xff,0xff,0x20,0x03,0xfb,0x8f,0xff,0xfe,0x97,0x42,0x10,
 0x05,0xfa,0x24,0x23,0xfe,0x8a,0xcf,0xf2,0x08,0xf7,0xad,0xff,0xff,0xfd,0xb9,0x71,
-0x0c,0xf3,0xab,0x97,0xfd,0x00,0x02,0xd5,0x67,0x0b,0x92,0xff,0xbb,0xbd,0xf6,0x3c,
-0x80,0x00,0x00,0x6e,0xe6,0x5b,0x07,0xa2,0x28,0x40,0xf9,0x00,0x0c,0xfa,0x77,0x00,
-0x11,0x90,0x85,0x17,0x22,0x04,0xf9,0xe7,0x04,0x00,0xa9,0x41,0x00,0xe6,0x04,0x12,
-0xa6,0xc5,0x40,0x05,0x4f,0x36,0x10,0xc0,0xd8,0x1c,0xc0,0x99,0x9a,0xfb,0x02,0xfb,
-0x28,0x88,0x88,0x80,0x3f,0xa0,0x5f,0x8e,0x6d,0xf6,0x10,0x14,0xfa,0x09,0xf5,0x3f,
-0x80,0x0b,0xf1,0x5f,0x81,0xfe,0x03,0xfc,0x88,0xdf,0x18,0xf7,0x8f,0x70,0x3f,0xff,
-0xff,0xfc,0xff,0x40,0x91,0x03,0xd7,0x00,0x07,0xfe,0x5e,0x49,0x04,0x53,0x0c,0x01,
-0xe9,0x00,0x43,0xaf,0xe0,0x00,0xfe,0xfe,0x0c,0x05,0x18,0x00,0xa1,0x8a,0xeb,0x88,
-0x8c,0xd9,0x80,0x00,0xfe,0x03,0xf9,0xaa,0x53,0x03,0x8c,0x43,0x82,0x01,0xfc,0x69,
-0xef,0xa9,0xaf,0xe9,0x90,0x03,0x18,0xc2,0xc0,0x00,0x04,0xfa,0xaa,0xef,0xaa,0xbf,
-0xea,0xa5,0x07,0xf8,0x9b,0x09,0x40,0x0c,0xf3,0x06,0xfb,0x34,0x12,0x31,0x3f,0xe0,
-0x9f,0x80,0x2c,0x42,0x2b,0x60,0x8c,0x20,0x44,0x12,0x09,0x0b,0x37,0x30,0x30,0x00,
-0xef,0x78,0x00,0x22,0xdf,0x30,0x6a,0x4e,0x26,0xaf,0x30,0x18,0x00,0xf2,0x02,0x98,
-0xdf,0x98,0xdf,0x98,0x20,0x00,0xef,0x58,0xdf,0x88,0xdf,0x98,0x30,0x00,0xef,0xaf,
-0x8a,0x28,0x30,0xff,0x00,0xaf,0x6e,0x41,0xb1,0x01,0xfd,0x9a,0xef,0xaa,0xef,0xaa,
-0xa0,0x03,0xfb,0xef,0xd9,0x03,0xf0,0x15,0x06,0xf8,0x0a,0xf1,0x1f,0xc3,0xce,0x30,
-0x0a,0xf4,0x0b,0xf1,0x07,0xff,0xe5,0x00,0x1f,0xf1,0x1e,0xfa,0xd9,0x8f,0xfa,0x50,
-0x5f,0x90,0x4f,0xff,0xb4,0x05,0xef,0xd0,0x03,0x20,0x07,0x30,0x57,0x12,0x12,0x03,
-0x9e,0x54,0x23,0x80,0x03,0xe6,0x52,0x08,0xb3,0x3a,0x0f,0x08,0x00,0x21,0x0e,0x93,
-0x0a,0x0b,0xf3,0x1c,0x23,0x00,0x08,0x14,0x00,0x02,0xaa,0x0a,0x11,0x0d,0x2f,0x00,
-0x26,0xdd,0xd0,0xdc,0x10,0x29,0x7f,0x80,0x23,0x27,0x02,0x49,0x58,0x42,0x80,0x00,
-0x09,0xfc,0x69,0x02,0x21,0x1e,0xe1,0x8e,0x1a,0x00,0x66,0x56,0x20,0x3f,0xc0,0xb5,
-0x4f,0x11,0x10,0x08,0x00,0x22,0x3f,0xf3,0xa6,0x1a,0x30,0x4f,0x60,0xdd,0x48,0x1d,
-0x24,0xd4,0x03,0x83,0x22,0x00,0x1d,0x35,0x11,0x45,0xb0,0x18,0xe2,0x10,0x00,0xef,
-0x60,0x00,0x03,0x88,0xdf,0xb8,0x8b,0xfe,0x88,0x40,0x06,0x70,0x00,0x60,0x70,0x01,
-0x33,0x33,0x7f,0xc3,0x63,0x0e,0x04,0xce,0x55,0xb0,0x6a,0xaa,0xff,0xaa,0xaa,0xa7,
-0x00,0x09,0x99,0x9b,0xfe,0x74,0x44,0x04,0x9a,0x0a,0x41,0x02,0x23,0xcf,0xb2,0xc8,
-0x21,0x13,0x08,0x63,0x10,0xa1,0x9f,0xfa,0xcc,0xef,0xec,0xcb,0x00,0x2d,0xff,0x50,
-0xb2,0x00,0x20,0x1d,0xeb,0x4a,0x3b,0x42,0xcc,0xc2,0x02,0x19,0x12,0x0a,0x22,0xbf,
-0xff,0xe9,0x4a,0x00,0x5d,0x01,0x03,0x74,0x0b,0x00,0xaf,0x24,0x11,0x78,0xfc,0x33,
-0x01,0xb4,0x25,0x00,0x0f,0x00,0x83,0xef,0x32,0x22,0x22,0x2e,0xf1,0x00,0x0e,0xad,
-0x03,0x21,0xef,0xcb,0x71,0x1f,0x04,0x59,0x36,0x01,0x03,0x02,0x42,0x09,0x60,0x0e,
-0xf1,0x0d,0x00,0x21,0xdf,0x30,0xfa,0x27,0x10,0x09,0x6a,0x28,0x9e,0xff,0xf7,0x00,
-0x09,0xde,0xff,0xff,0xfe,0xd8,0x37,0x49,0x00,0x14,0x0a,0x06,0x76,0x20,0xe1,0xf2,
-0x1c,0xcc,0xef,0xec,0xff,0xcc,0xcc,0xc1,0x00,0x01,0xef,0x21,0xfc,0x78,0x01,0x12,
-0xf9,0x4e,0x3a,0x12,0x7f,0xcb,0x2a,0xf2,0x03,0x09,0xff,0xfd,0xcc,0xff,0xcc,0xef,
-0x60,0x7f,0xfc,0xf5,0x01,0xfc,0x00,0x8f,0x60,0x1c,0x38,0x08,0x00,0x27,0x00,0x08,
-0x08,0x00,0x31,0x7d,0xff,0x40,0x08,0x00,0x25,0x3d,0xc8,0x7c,0x2e,0x70,0x00,0x07,
-0x61,0x00,0x00,0x19,0x80,0x50,0x0e,0x21,0xd8,0x5a,0x22,0x05,0x11,0x5c,0x4b,0x14,
-0xf0,0x02,0x05,0xdf,0xff,0xfd,0x8c,0xff,0xe7,0x00,0x00,0xdc,0x98,0xfe,0x00,0x29,
-0xe5,0x00,0x19,0xa9,0x0b,0x00,0xb0,0x49,0x04,0x8e,0x21,0x41,0x03,0xef,0x56,0xe7,
-0x1b,0x0e,0x11,0xfc,0x70,0x15,0x13,0x02,0xe4,0x0e,0xd0,0x4f,0xff,0xfc,0x9c,0xfc,
-0x9a,0xfd,0x00,0x0d,0x99,0xf5,0x06,0xf7,0x81,0x0d,0x53,0x08,0xf5,0x06,0xf7,0x01,
-0x08,0x00,0x00,0xe6,0x61,0x60,0x06,0xa3,0x06,0xf7,0x38,0x71,0x92,0x05,0xe4,0x0f,
-0xe0,0x0f,0xe0,0x00,0x16,0x6e,0xf7,0x6f,0xf6,0x6f,0xe6,0x61,0x3f,0xe7,0x22,0xf1,
-0x03,0x3d,0xf4,0x3f,0xf3,0x3f,0xe3,0x30,0x00,0x07,0x80,0x07,0x70,0x08,0x80,0x00,
-0x07,0x88,0x88,0x37,0x56,0x04,0x24,0x10,0x00,0xcb,0x33,0x00,0xfa,0x72,0x20,0x0e,
-0xf9,0x4f,0x53,0x22,0x9f,0xe0,0x22,0x05,0x01,0x0e,0x4c,0x31,0x1f,0xf0,0x05,0x08,
-0x00,0x33,0x0f,0xe0,0x04,0x08,0x00,0x13,0x9c,0x08,0x00,0x28,0xaf,0xd2,0x64,0x40,
-0x02,0x81,0x06,0x11,0xb0,0x2d,0x73,0xa0,0x00,0xcb,0x00,0x00,0x0e,0xf9,0x99,0x20,
-0x0c,0xb0,0xbb,0x03,0x40,0xf4,0xbc,0xff,0xcb,0x68,0x53,0xf2,0x0e,0x0e,0xff,0xff,
-0xe3,0x99,0xff,0x99,0x60,0xe7,0xdc,0x8e,0x6f,0xff,0xff,0xfa,0x0e,0x7c,0xb7,0xe6,
-0xf3,0x12,0x0f,0xa0,0xe7,0xcb,0x7e,0x6f,0x3c,0xf0,0x0f,0x00,0x17,0xcf,0x0f,0x00,
-0xf2,0x2b,0xdd,0xe6,0xf3,0xde,0x0f,0xa0,0xe7,0xcc,0xd7,0x6f,0x7f,0xa0,0xf9,0x01,
-0x0c,0xb0,0x00,0x5f,0xf6,0xc5,0x00,0x00,0xcb,0x06,0xcf,0xe2,0x3c,0xfc,0x20,0x0c,
-0xb0,0x3d,0x70,0x00,0x05,0xc1,0x02,0x96,0x00,0xfe,0x00,0x98,0x20,0x03,0xff,0x10,
-0xfe,0x04,0xfe,0x20,0x79,0xee,0x99,0xff,0x9b,0xfc,0x96,0xdf,0xa9,0x2d,0x11,0xdf,
-0x15,0x38,0x30,0xfb,0xdf,0x4f,0x01,0x01,0x90,0xfb,0x67,0x4f,0xb6,0x66,0x6e,0xf2,
-0x75,0x00,0x07,0x00,0x80,0xf1,0x00,0x00,0x3e,0xee,0xff,0xfe,0xe1,0xf4,0x21,0x52,
-0xef,0x21,0x11,0x10,0x0c,0x1a,0x05,0xd1,0x0c,0xfa,0x99,0xff,0xa9,0xaf,0xc0,0x0c,
-0xf2,0x00,0xef,0x10,0x2f,0x07,0x00,0xc4,0x2e,0xff,0xb0,0x07,0x91,0x00,0xef,0x19,
-0xb9,0x20,0x00,0x2f,0x46,0x55,0x01,0xd8,0x3c,0x10,0xf2,0x08,0x00,0xf1,0x09,0xd6,
-0x66,0x6c,0xf2,0x19,0xaf,0xc9,0x4f,0xbb,0xcc,0xca,0xf2,0x2f,0xff,0xff,0x7f,0xb5,
-0x66,0x6a,0xf2,0x2f,0x6f,0x8e,0x7f,0x10,0x00,0xb0,0x5f,0x7e,0x78,0x64,0x55,0x56,
-0x81,0x2f,0x5f,0x7e,0x69,0x10,0x67,0x00,0x08,0x00,0x40,0xf8,0x88,0x8f,0xc0,0x08,
-0x00,0xf0,0x09,0xfb,0xbb,0xbf,0xc0,0x2f,0x5f,0xcf,0x69,0xfa,0xaa,0xaf,0xc0,0x2f,
-0x5f,0xbc,0x19,0xfa,0x99,0x9f,0xc0,0x01,0x2f,0x70,0x09,0x18,0x00,0x71,0x00,0x2f,
-0x70,0x09,0xf8,0x77,0x7f,0x08,0x00,0x01,0x3f,0x1f,0x23,0x1f,0x70,0xc1,0x0a,0x22,
-0x70,0x0f,0xae,0x31,0xf1,0x0e,0x70,0x08,0x88,0x88,0x88,0x81,0x2b,0xcf,0xdb,0x50,
-0xaa,0xaa,0xaa,0x60,0x2f,0xff,0xff,0x61,0xfe,0xcc,0xdf,0x90,0x2f,0x4f,0x7e,0x61,
-0xf8,0x00,0x1f,0x08,0x00,0x01,0xed,0x15,0xb0,0x4f,0x7e,0x60,0x66,0x66,0x66,0x40,
-0x2f,0x4f,0x7e,0x68,0x30,0x00,0x40,0x2f,0x4f,0x7e,0x6f,0xb8,0x00,0xc1,0x2f,0x4f,
-0xcf,0x6f,0xe2,0xae,0x2a,0xf2,0x2f,0x4f,0xac,0x1f,0x6a,0x39,0x70,0x1f,0x70,0x0f,
-0xf4,0xbe,0x4b,0xf2,0x60,0x00,0x31,0xf8,0xdf,0x8c,0x08,0x00,0x02,0xb4,0x0d,0x46,
-0x8f,0x40,0x05,0xf8,0x29,0x03,0xa0,0x05,0x55,0x9c,0x75,0x58,0xc9,0x55,0x50,0x00,
-0x8e,0xb4,0x03,0xc0,0xe8,0x00,0x00,0x8f,0x85,0x55,0x55,0x59,0xf8,0x00,0x00,0x8f,
-0xc3,0x03,0x00,0x08,0x00,0x40,0x63,0x33,0x33,0x37,0x08,0x00,0x02,0x05,0x1f,0x84,
-0x04,0x55,0x5e,0xf7,0x55,0x55,0x55,0x40,0xfd,0x10,0x93,0x03,0x9f,0xfa,0x5f,0xf5,
-0x9f,0xe7,0x30,0x3e,0x6c,0x2a,0xf0,0x01,0x09,0x6a,0xf7,0x5f,0xe5,0x6f,0xd5,0x80,
-0x00,0x0a,0xf2,0x0f,0xd1,0x8f,0xc0,0x00,0x08,0x00,0x52,0xd0,0xfe,0x60,0x00,0x03,
-0x75,0x1f,0x23,0x60,0x03,0x82,0x04,0x70,0x00,0x12,0x41,0x1d,0xf3,0x13,0x52,0xfb,
-0x0a,0x40,0x0d,0xf1,0x08,0xfa,0xb3,0x08,0x40,0x0d,0xf1,0x0d,0xf2,0xdd,0x40,0x20,
-0x0d,0xf1,0x06,0x2d,0x60,0x01,0x61,0x0d,0xf1,0x15,0x10,0x64,0x2c,0x1b,0xef,0x0c,
-0x2d,0x05,0x20,0x57,0x1f,0xf1,0x08,0x00,0x0a,0x12,0x12,0x2d,0x41,0x21,0x04,0xfd,
-0x1e,0x34,0x00,0xa4,0x73,0x00,0x4a,0x0e,0x93,0x01,0x22,0x7e,0x82,0x24,0xff,0x32,
-0x20,0x08,0x7a,0x05,0x60,0x06,0xaa,0xdf,0xda,0xab,0xff,0x35,0x43,0x22,0x9f,0x60,
-0xbb,0x0f,0x02,0x08,0x00,0x30,0x0c,0xcc,0xef,0xe6,0x28,0x15,0xc5,0x78,0x00,0x31,
-0x01,0xef,0x30,0xa0,0x2c,0x22,0x06,0xfe,0xe3,0x0f,0x10,0x5f,0x33,0x72,0x02,0x63,
-0x65,0x00,0x08,0x00,0x26,0x04,0xe6,0x02,0x10,0x04,0x35,0x0a,0x14,0x78,0x5d,0x07,
-0x00,0xc3,0x04,0x04,0x1a,0x06,0x22,0xff,0xcc,0xdd,0x19,0x30,0xfd,0x06,0x77,0x10,
-0x48,0x32,0x00,0xfd,0x0f,0x82,0x21,0x60,0xfd,0x00,0x18,0x40,0x7f,0xe2,0x66,0x04,
-0xf2,0x01,0x5e,0xfe,0xfb,0x10,0x00,0x02,0xfb,0x68,0x88,0xdf,0xfd,0x88,0x71,0x03,
-0xfa,0xbf,0xa8,0x01,0x01,0x90,0x20,0x40,0x6f,0x80,0x08,0xf5,0x26,0x53,0x11,0xad,
-0x05,0x01,0x21,0x2f,0xb0,0xfe,0x05,0x31,0xbb,0xcf,0xa0,0x86,0x26,0x3a,0xaf,0xfc,
-0x30,0x37,0x25,0x13,0xa4,0x20,0x26,0x10,0xfb,0x71,0x04,0x02,0xa8,0x10,0x24,0xc2,
-0x03,0x39,0x04,0x10,0xfb,0xca,0x56,0x70,0x22,0x00,0x03,0xfb,0x05,0x08,0xf4,0x08,
-0x2f,0xc0,0xfb,0xbf,0x34,0xf8,0x00,0xdf,0x40,0x03,0xfb,0x6f,0x80,0xfd,0x21,0x5d,
-0xf0,0x0c,0xfa,0x1f,0xe0,0xdf,0x17,0xf9,0x00,0x05,0xf9,0x0b,0xf3,0x9f,0x4d,0xf2,
-0x00,0x06,0xf7,0x07,0xf8,0x46,0x7f,0xa0,0x00,0x09,0xf5,0x02,0x60,0x29,0x24,0x22,
-0x0d,0xf2,0x79,0x26,0x22,0x2f,0xe8,0x2d,0x24,0x22,0x4f,0x86,0x2d,0x24,0x08,0xe0,
-0x4a,0x13,0x54,0x36,0x1c,0x07,0xb7,0x17,0x31,0xf6,0x00,0xff,0xed,0x14,0x60,0xb4,
-0x00,0xfd,0x00,0xbf,0x10,0x63,0x04,0x22,0xfd,0xcf,0xbc,0x0b,0x70,0xfd,0x68,0xdf,
-0x88,0x8f,0xf8,0x82,0x18,0x00,0x60,0x87,0x7f,0xe0,0x00,0x01,0xfc,0xf3,0x3f,0x40,
-0xd0,0x00,0x02,0xfb,0xe1,0x17,0x32,0x75,0x00,0x04,0xbf,0x5d,0x80,0x20,0x07,0xf7,
-0x05,0xfd,0x40,0x5e,0xf6,0x9c,0x53,0x20,0x5f,0xfc,0x12,0x72,0xe0,0xf3,0x8a,0xdf,
-0xff,0xff,0xca,0x83,0x2d,0x91,0xff,0xd9,0x53,0x7c,0xff,0x78,0x85,0x05,0xb3,0x63,
-0xf2,0x04,0x00,0x14,0x7b,0x20,0x2f,0xff,0xf8,0x5a,0xce,0xff,0xff,0xb0,0x1a,0xaf,
-0xf2,0x5f,0xec,0xff,0x51,0xb7,0x26,0x20,0xcf,0x10,0x10,0x31,0x40,0x02,0x10,0xcf,
-0x10,0x82,0x3d,0xf1,0x11,0x1f,0xb0,0xcf,0x98,0x80,0x09,0xff,0xff,0x1f,0xb0,0xcf,
-0xff,0xf0,0x09,0x99,0xfe,0x1f,0xb0,0xcf,0x32,0x20,0x03,0x51,0xfb,0x1f,0xb0,0xcf,
-0x10,0x00,0x0b,0xf6,0xf8,0x08,0x00,0xc1,0x04,0xff,0xf3,0x1f,0xd8,0xef,0x98,0x82,
-0x00,0xbf,0xe0,0x1f,0x62,0x07,0x31,0xaf,0xfb,0x51,0x77,0x06,0xc0,0xfd,0xbf,0xff,
-0xfe,0xdc,0xdd,0xd5,0x2d,0xe2,0x03,0x9b,0xde,0xcc,0x11,0x17,0x10,0x34,0x0b,0x10,
-0xb0,0x68,0x03,0xa1,0xfa,0x34,0x5f,0xd4,0x44,0x10,0x0a,0xae,0xf3,0xcf,0xd2,0x08,
-0xa3,0x1f,0xc1,0x44,0x5f,0xd4,0x9f,0x50,0x00,0x7f,0x6a,0xcd,0x47,0x10,0x33,0x10,
-0x00,0x31,0x70,0x06,0xff,0x6b,0x3d,0xf1,0x15,0x30,0x05,0x7a,0xf5,0x56,0x7f,0xd6,
-0x66,0x10,0x03,0x38,0xf3,0xbc,0xcf,0xfc,0xcc,0x40,0x0d,0xbb,0xf0,0x9a,0xaf,0xea,
-0xaa,0x40,0x07,0xff,0xb5,0x88,0x9f,0xe8,0x88,0x80,0x00,0xef,0x79,0xd9,0x05,0xf0,
-0x05,0x02,0xef,0xe6,0x10,0x06,0x50,0x00,0x00,0x2e,0xf8,0xdf,0xfe,0xdc,0xbb,0xbb,
-0xb3,0x2d,0x70,0x05,0xac,0x34,0x2b,0x04,0x22,0x0f,0x05,0xe0,0x02,0x01,0xc8,0x02,
-0x30,0xdc,0xc0,0x00,0x82,0x66,0x01,0xe1,0x25,0x0f,0x08,0x00,0x03,0x04,0xe8,0x02,
-0x70,0x1d,0xdd,0xff,0xed,0xdd,0xff,0xed,0x26,0x44,0x02,0xa7,0x29,0x22,0x02,0xff,
-0x19,0x26,0x22,0x0a,0xf9,0x08,0x00,0x21,0x8f,0xf2,0x08,0x00,0x31,0x0b,0xff,0x50,
-0x08,0x00,0x27,0x03,0xd3,0x39,0x26,0x04,0xbf,0x26,0x00,0x2d,0x23,0x62,0xaf,0xa9,
-0x99,0x99,0x9b,0xf8,0x78,0x32,0x27,0x05,0xf8,0x18,0x00,0x10,0xa8,0xa1,0x06,0x90,
-0x20,0x00,0x9f,0x71,0x10,0x00,0x01,0x2c,0xf3,0xc4,0x6a,0x01,0x5c,0x0f,0xf4,0x00,
-0x02,0xff,0xa9,0x99,0xff,0xa6,0x10,0x03,0x33,0xdf,0x43,0x33,0xcf,0x53,0x31,0x4a,
-0x09,0xb1,0x08,0x8b,0xfe,0x88,0x88,0xef,0x98,0x83,0x00,0x3e,0xf7,0xa7,0x68,0x01,
-0x19,0x14,0x22,0xbf,0x20,0x70,0x03,0x2f,0xbf,0x20,0xc1,0x44,0x02,0x32,0x5f,0xb1,
-0xc5,0xbc,0x0e,0x13,0xb4,0x17,0x46,0x50,0xb0,0x4f,0x50,0x1d,0xdd,0x22,0x09,0x25,
-0xde,0xd2,0xf5,0x43,0x07,0xee,0x16,0x22,0x0f,0xf0,0x30,0x01,0xa2,0x5e,0xf1,0x00,
-0x00,0x06,0xcd,0xff,0xcc,0x4c,0xf4,0xef,0x07,0x21,0x09,0xf7,0x08,0x00,0x00,0x21,
-0x21,0xf1,0x0c,0x30,0x00,0x01,0xfc,0x25,0x60,0xff,0x12,0xf6,0x06,0x8b,0xff,0xff,
-0xd0,0xbf,0x96,0xf6,0x0e,0xff,0xeb,0x74,0x00,0x2f,0xff,0xf2,0x05,0x51,0xc1,0x44,
-0x13,0x80,0x0c,0x0a,0x01,0xcb,0x00,0x50,0xff,0x2c,0xcc,0xcc,0xfd,0x56,0x00,0x00,
-0xfc,0x3a,0x40,0xff,0x01,0x11,0x12,0x0d,0x00,0x11,0xef,0x1a,0x00,0x81,0x1f,0xfa,
-0xaa,0xa8,0x00,0x0f,0xf3,0xfb,0x12,0x03,0x72,0x6f,0xeb,0xbb,0xbb,0x00,0x0f,0xfa,
-0x61,0x0b,0x01,0x0d,0x40,0x22,0x0f,0xf0,0x5f,0x0c,0x01,0x78,0x24,0x60,0x0f,0xf0,
-0x0a,0xee,0xff,0x40,0x9b,0x29,0x24,0xfe,0x80,0x69,0x13,0x00,0x73,0x10,0x00,0x49,
-0x02,0x82,0xc0,0x9a,0xaa,0xef,0x38,0xbb,0xbb,0xfc,0xe3,0x14,0xf0,0x04,0x2f,0xc0,
+0x0c,0xf3,0xab,0x97,0xfd,0x00,0x02,0xd5,0x2f,0xe0,0x00,0x00,0xff,0xbb,0xbd,0xf6,
+0x3c,0x80,0x00,0x00,0x6e,0x50,0x00,0x04,0x01,0x00,0x10,0xcf,0x5f,0x00,0x40,0xf9,
+0x00,0x0c,0xfa,0x77,0x00,0xa1,0x90,0x00,0xcf,0x10,0x00,0x00,0x04,0xf9,0x00,0x0c,
+0x76,0x00,0xa3,0x90,0x00,0xcf,0xaa,0xaa,0xaa,0xaa,0xa6,0x00,0x0d,0x8b,0x01,0x11,
+0xef,0x17,0x00,0xf5,0x26,0xc0,0x0f,0xf9,0x99,0x99,0x99,0x9a,0xfb,0x02,0xfb,0x28,
+0x88,0x88,0x80,0x3f,0xa0,0x5f,0x83,0xff,0xff,0xff,0x14,0xfa,0x09,0xf5,0x3f,0x80,
+0x0b,0xf1,0x5f,0x81,0xfe,0x03,0xfc,0x88,0xdf,0x18,0xf7,0x8f,0x70,0x3f,0xff,0xff,
+0xfc,0xff,0x40,0x91,0x03,0xd7,0x00,0x07,0xfe,0x90,0x71,0x00,0x02,0xd1,0x00,0x12,
+0xe0,0xe9,0x00,0x22,0xaf,0xe0,0xe9,0x00,0x26,0x3f,0xe0,0x18,0x00,0xf0,0x02,0x8a,
+0xeb,0x88,0x8c,0xd9,0x80,0x00,0xfe,0x03,0xf9,0x00,0x0c,0xf4,0x00,0x00,0xfe,0xaf,
+0x18,0x00,0xf1,0x0d,0xf0,0x01,0xfc,0x69,0xef,0xa9,0xaf,0xe9,0x90,0x02,0xfb,0x00,
+0xbf,0x10,0x1f,0xc0,0x00,0x04,0xfa,0xaa,0xef,0xaa,0xbf,0xea,0xa5,0x07,0xf8,0xff,
+0x69,0x02,0xc0,0x0c,0xf3,0x06,0xfb,0x00,0x1f,0xc0,0x00,0x3f,0xe0,0x9f,0xf2,0x08,
+0x00,0x40,0x2b,0x60,0x8c,0x20,0x08,0x00,0x05,0x01,0x00,0x02,0xbc,0x00,0x30,0x30,
+0x00,0xef,0x78,0x00,0x50,0xdf,0x30,0x00,0xef,0x10,0x92,0x01,0x16,0x30,0x18,0x00,
+0xf1,0x01,0x98,0xdf,0x98,0xdf,0x98,0x20,0x00,0xef,0x58,0xdf,0x88,0xdf,0x98,0x30,
+0x00,0xef,0x78,0x00,0xf1,0x04,0x60,0x00,0xff,0x00,0xaf,0x10,0xaf,0x10,0x00,0x01,
+0xfd,0x9a,0xef,0xaa,0xef,0xaa,0xa0,0x03,0xfb,0x31,0x00,0xf1,0x1c,0xf1,0x06,0xf8,
+0x0a,0xf1,0x1f,0xc3,0xce,0x30,0x0a,0xf4,0x0b,0xf1,0x07,0xff,0xe5,0x00,0x1f,0xf1,
+0x1e,0xfa,0xd9,0x8f,0xfa,0x50,0x5f,0x90,0x4f,0xff,0xb4,0x05,0xef,0xd0,0x03,0x20,
+0x07,0x30,0x00,0x00,0x04,0x30,0x03,0xee,0x01,0x00,0x32,0x80,0x03,0xff,0x53,0x01,
+0x00,0x81,0x02,0x13,0xf3,0xd9,0x02,0x0f,0x08,0x00,0x21,0xa2,0x1d,0xdd,0xdd,0xdf,
+0xfe,0xdd,0xdd,0xd6,0x1f,0xff,0xf8,0x00,0x06,0xe1,0x00,0x22,0x03,0x63,0x08,0x00,
+0x13,0x08,0x14,0x00,0x20,0x0b,0xf4,0x06,0x00,0x11,0x0d,0x2f,0x00,0x31,0xdd,0xd0,
+0x0f,0x30,0x00,0x00,0xf4,0x02,0x22,0x7f,0x80,0x20,0x00,0x22,0xdf,0x30,0x37,0x00,
+0x92,0xff,0xcc,0xcc,0xcc,0xcc,0x80,0x00,0x09,0xfc,0x69,0x02,0x40,0x1e,0xe1,0x00,
+0x3f,0x37,0x01,0x21,0x9f,0x70,0x08,0x00,0x31,0x04,0xfe,0x10,0x08,0x00,0x31,0x3f,
+0xf3,0x00,0x08,0x00,0x92,0x4f,0x60,0xdd,0xdd,0xef,0xfd,0xdd,0xd4,0x03,0xb1,0x01,
+0xf2,0x0b,0xf4,0x00,0x00,0x34,0x00,0x00,0x45,0x10,0x00,0x00,0x02,0xfe,0x10,0x00,
+0xef,0x60,0x00,0x03,0x88,0xdf,0xb8,0x8b,0xfe,0x88,0x40,0x06,0x70,0x00,0xd1,0x70,
+0x01,0x33,0x33,0x7f,0xc3,0x33,0x33,0x10,0x00,0x9f,0xff,0xff,0xcc,0x04,0xf3,0x00,
+0x6a,0xaa,0xff,0xaa,0xaa,0xa7,0x00,0x09,0x99,0x9b,0xfe,0x99,0x99,0x99,0x90,0xc8,
+0x00,0xb0,0xf1,0x02,0x23,0xcf,0xb2,0x22,0x22,0x22,0x20,0x00,0x08,0x0f,0x00,0xd1,
+0xfd,0x00,0x00,0x9f,0xfa,0xcc,0xef,0xec,0xcb,0x00,0x2d,0xff,0x50,0xb2,0x00,0xa1,
+0x1d,0xeb,0xcc,0xcc,0xef,0xec,0xcc,0xc2,0x02,0x19,0x30,0x00,0x22,0xf2,0xbf,0x80,
+0x03,0x10,0x0a,0x5d,0x01,0x23,0xef,0xf1,0xd2,0x00,0x50,0x10,0x00,0x78,0x00,0x00,
+0xae,0x02,0x22,0x0e,0xf1,0x0f,0x00,0x83,0xef,0x32,0x22,0x22,0x2e,0xf1,0x00,0x0e,
+0xad,0x03,0x84,0xef,0xcb,0xbb,0xbb,0xbe,0xe1,0x00,0x0e,0xcf,0x02,0x00,0x03,0x02,
+0x42,0x09,0x60,0x0e,0xf1,0x0d,0x00,0x01,0x11,0x01,0xf0,0x01,0x5f,0xe0,0x09,0xff,
+0xfe,0xee,0xee,0xff,0xf7,0x00,0x09,0xde,0xff,0xff,0xfe,0xd8,0x1b,0x00,0x12,0x40,
+0x2f,0x00,0x22,0x04,0xfc,0x08,0x00,0x20,0x09,0xf8,0x06,0x00,0x03,0xb9,0x00,0xe1,
+0xf2,0x1c,0xcc,0xef,0xec,0xff,0xcc,0xcc,0xc1,0x00,0x01,0xef,0x21,0xfc,0x78,0x01,
+0x31,0xf9,0x02,0xfc,0x59,0x04,0x11,0xff,0x41,0x02,0xf2,0x03,0x09,0xff,0xfd,0xcc,
+0xff,0xcc,0xef,0x60,0x7f,0xfc,0xf5,0x01,0xfc,0x00,0x8f,0x60,0x1c,0x38,0x08,0x00,
+0x27,0x00,0x08,0x08,0x00,0x31,0x7d,0xff,0x40,0x08,0x00,0x21,0x3d,0xc8,0x04,0x06,
+0x01,0x40,0x00,0xc1,0x07,0x61,0x00,0x00,0x19,0x80,0x00,0x00,0x4d,0xff,0xd8,0x5a,
+0x22,0x05,0x10,0x5c,0xa9,0x03,0xf4,0x0a,0x00,0x05,0xdf,0xff,0xfd,0x8c,0xff,0xe7,
+0x00,0x00,0xdc,0x98,0xfe,0x00,0x29,0xe5,0x00,0x19,0x99,0x9c,0xfd,0x99,0x99,0x99,
+0x91,0x49,0x01,0x60,0x00,0x03,0xef,0x56,0xe7,0x00,0x2a,0x02,0x30,0xfc,0x06,0xf7,
+0x39,0x05,0x12,0xdf,0x51,0x01,0xf3,0x07,0x4f,0xff,0xfc,0x9c,0xfc,0x9a,0xfd,0x00,
+0x0d,0x99,0xf5,0x06,0xf7,0x00,0xfd,0x00,0x00,0x08,0xf5,0x06,0xf7,0x01,0x08,0x00,
+0xa0,0xbf,0xfb,0x00,0x00,0x06,0xa3,0x06,0xf7,0x38,0x71,0x92,0x05,0xe2,0x0f,0xe0,
+0x0f,0xe0,0x00,0x16,0x6e,0xf7,0x6f,0xf6,0x6f,0xe6,0x61,0x3f,0x58,0x00,0xf1,0x04,
+0xf3,0x03,0x3d,0xf4,0x3f,0xf3,0x3f,0xe3,0x30,0x00,0x07,0x80,0x07,0x70,0x08,0x80,
+0x00,0x07,0x88,0x01,0x00,0x23,0x80,0x0e,0xb9,0x03,0xf1,0x01,0x0e,0xf0,0x00,0x1f,
+0xf0,0x00,0x0f,0xe0,0x0e,0xf9,0x99,0x9f,0xf9,0x99,0x9f,0xe0,0x22,0x05,0x00,0xb1,
+0x00,0x51,0x3f,0xa0,0x1f,0xf0,0x05,0x08,0x00,0x33,0x0f,0xe0,0x04,0x08,0x00,0x13,
+0x9c,0x08,0x00,0x21,0xaf,0xd2,0xd9,0x02,0x27,0xe0,0x00,0x81,0x06,0xe0,0xb0,0x00,
+0x00,0xee,0x00,0x00,0x00,0xcb,0x00,0x00,0x0e,0xf9,0x99,0x20,0x0f,0x00,0xf2,0x18,
+0xef,0xff,0xf4,0xbc,0xff,0xcb,0x00,0x0e,0xf1,0x11,0x0e,0xff,0xff,0xe3,0x99,0xff,
+0x99,0x60,0xe7,0xdc,0x8e,0x6f,0xff,0xff,0xfa,0x0e,0x7c,0xb7,0xe6,0xf3,0x12,0x0f,
+0xa0,0xe7,0xcb,0x7e,0x6f,0x3c,0xf0,0x0f,0x00,0x17,0xcf,0x0f,0x00,0xf1,0x2b,0xdd,
+0xe6,0xf3,0xde,0x0f,0xa0,0xe7,0xcc,0xd7,0x6f,0x7f,0xa0,0xf9,0x01,0x0c,0xb0,0x00,
+0x5f,0xf6,0xc5,0x00,0x00,0xcb,0x06,0xcf,0xe2,0x3c,0xfc,0x20,0x0c,0xb0,0x3d,0x70,
+0x00,0x05,0xc1,0x02,0x96,0x00,0xfe,0x00,0x98,0x20,0x03,0xff,0x10,0xfe,0x04,0xfe,
+0x20,0x79,0xee,0x99,0xff,0x9b,0xfc,0x96,0xdf,0xd4,0x00,0xa0,0xfb,0xdf,0x33,0x33,
+0x33,0x33,0x35,0xfb,0xdf,0x4f,0x01,0x01,0x90,0xfb,0x67,0x4f,0xb6,0x66,0x6e,0xf2,
+0x75,0x00,0x07,0x00,0xf2,0x02,0xf1,0x00,0x00,0x3e,0xee,0xff,0xfe,0xe1,0x00,0x01,
+0x11,0x11,0xef,0x21,0x11,0x10,0x0c,0x1a,0x05,0xd1,0x0c,0xfa,0x99,0xff,0xa9,0xaf,
+0xc0,0x0c,0xf2,0x00,0xef,0x10,0x2f,0x07,0x00,0xd3,0x2e,0xff,0xb0,0x07,0x91,0x00,
+0xef,0x19,0xb9,0x20,0x00,0x2f,0x70,0x63,0x06,0x20,0x70,0x0f,0x39,0x02,0x00,0x08,
+0x00,0xf1,0x09,0xd6,0x66,0x6c,0xf2,0x19,0xaf,0xc9,0x4f,0xbb,0xcc,0xca,0xf2,0x2f,
+0xff,0xff,0x7f,0xb5,0x66,0x6a,0xf2,0x2f,0x6f,0x8e,0x7f,0x10,0x00,0xb0,0x5f,0x7e,
+0x78,0x64,0x55,0x56,0x81,0x2f,0x5f,0x7e,0x69,0x9a,0x03,0x00,0x08,0x00,0x40,0xf8,
+0x88,0x8f,0xc0,0x08,0x00,0xf0,0x09,0xfb,0xbb,0xbf,0xc0,0x2f,0x5f,0xcf,0x69,0xfa,
+0xaa,0xaf,0xc0,0x2f,0x5f,0xbc,0x19,0xfa,0x99,0x9f,0xc0,0x01,0x2f,0x70,0x09,0x18,
+0x00,0x71,0x00,0x2f,0x70,0x09,0xf8,0x77,0x7f,0x08,0x00,0x00,0x94,0x00,0x23,0x00,
+0x1f,0x78,0x00,0x11,0x1f,0x78,0x00,0xf1,0x11,0xf3,0x00,0x1f,0x70,0x08,0x88,0x88,
+0x88,0x81,0x2b,0xcf,0xdb,0x50,0xaa,0xaa,0xaa,0x60,0x2f,0xff,0xff,0x61,0xfe,0xcc,
+0xdf,0x90,0x2f,0x4f,0x7e,0x61,0xf8,0x00,0x1f,0x08,0x00,0x30,0xff,0xff,0xff,0x08,
+0x00,0x90,0x60,0x66,0x66,0x66,0x40,0x2f,0x4f,0x7e,0x68,0x30,0x00,0x40,0x2f,0x4f,
+0x7e,0x6f,0xb8,0x00,0xc0,0x2f,0x4f,0xcf,0x6f,0xe2,0xae,0x2a,0xf2,0x2f,0x4f,0xac,
+0x1f,0x10,0x00,0x80,0x01,0x1f,0x70,0x0f,0xf4,0xbe,0x4b,0xf2,0x60,0x00,0x31,0xf8,
+0xdf,0x8c,0x08,0x00,0x01,0xe0,0x00,0x56,0x00,0x8f,0x40,0x05,0xf8,0x29,0x03,0xa0,
+0x05,0x55,0x9c,0x75,0x58,0xc9,0x55,0x50,0x00,0x8e,0xb4,0x03,0xc0,0xe8,0x00,0x00,
+0x8f,0x85,0x55,0x55,0x59,0xf8,0x00,0x00,0x8f,0xc3,0x03,0x00,0x08,0x00,0x40,0x63,
+0x33,0x33,0x37,0x08,0x00,0x00,0x2f,0x00,0xb3,0xf8,0x00,0x04,0x55,0x5e,0xf7,0x55,
+0x55,0x55,0x40,0x2f,0x40,0x00,0xa2,0x03,0x9f,0xfa,0x5f,0xf5,0x9f,0xe7,0x30,0x3e,
+0xff,0x7a,0x04,0xf0,0x01,0x09,0x6a,0xf7,0x5f,0xe5,0x6f,0xd5,0x80,0x00,0x0a,0xf2,
+0x0f,0xd1,0x8f,0xc0,0x00,0x08,0x00,0x61,0xd0,0xfe,0x60,0x00,0x03,0xcc,0x01,0x00,
+0x23,0x60,0x03,0x82,0x04,0xf0,0x00,0x00,0x12,0x41,0x1d,0xf3,0x13,0x52,0x00,0x00,
+0x1f,0xd0,0x0d,0xf1,0x08,0xfa,0xb3,0x08,0xf3,0x0e,0x0d,0xf1,0x0d,0xf2,0x00,0x00,
+0x06,0xf9,0x0d,0xf1,0x5f,0xa0,0x00,0x00,0x01,0x61,0x0d,0xf1,0x15,0x10,0x00,0x1e,
+0xee,0xee,0xef,0xfe,0xee,0xee,0xe6,0xb0,0x00,0x10,0xf6,0x4a,0x04,0x12,0xf2,0x3a,
+0x01,0x2f,0x0d,0xf1,0x08,0x00,0x0a,0x40,0x12,0x00,0x00,0x04,0x20,0x04,0x50,0xfd,
+0x00,0x00,0x6f,0xe0,0x79,0x04,0xe3,0x60,0x00,0xcf,0x70,0x00,0x01,0x22,0x7e,0x82,
+0x24,0xff,0x32,0x20,0x08,0x7a,0x05,0xb0,0x06,0xaa,0xdf,0xda,0xab,0xff,0xaa,0xa0,
+0x00,0x00,0x9f,0x56,0x06,0x14,0x00,0x08,0x00,0x10,0x0c,0xd8,0x04,0x35,0xff,0xcc,
+0xc5,0x78,0x00,0x40,0x01,0xef,0x30,0x01,0x20,0x00,0x31,0x06,0xfe,0x00,0x28,0x00,
+0x21,0x5f,0xf6,0x08,0x00,0x31,0x09,0xff,0x90,0x08,0x00,0x42,0x04,0xe6,0x00,0x00,
+0x40,0x00,0x06,0x35,0x0a,0x14,0x78,0x5d,0x07,0x00,0xc3,0x04,0x04,0x1a,0x06,0x11,
+0xff,0x08,0x01,0xb0,0xc5,0x00,0xfd,0x06,0x77,0x77,0x77,0x74,0x00,0x00,0xfd,0x97,
+0x01,0x90,0xfe,0x10,0x00,0xfd,0x00,0x18,0x40,0x7f,0xe2,0x66,0x04,0xf2,0x01,0x5e,
+0xfe,0xfb,0x10,0x00,0x02,0xfb,0x68,0x88,0xdf,0xfd,0x88,0x71,0x03,0xfa,0xbf,0xa8,
+0x01,0x10,0xf8,0xea,0x05,0x91,0x6f,0x80,0x08,0xf5,0x00,0x00,0x2f,0xb0,0xad,0x05,
+0x01,0x21,0x2f,0xb0,0xfe,0x05,0xb9,0xbb,0xcf,0xa0,0x00,0x00,0x09,0x50,0x00,0xaf,
+0xfc,0x30,0x80,0x00,0x22,0x04,0xa4,0x08,0x00,0x20,0x06,0xfb,0x71,0x04,0x84,0xcc,
+0xcc,0xcc,0xff,0xcc,0xcc,0xc2,0x03,0x39,0x04,0xf1,0x30,0xfb,0x00,0x00,0x31,0x00,
+0x22,0x00,0x03,0xfb,0x05,0x08,0xf4,0x00,0x9f,0x80,0x03,0xfb,0xbf,0x34,0xf8,0x00,
+0xdf,0x40,0x03,0xfb,0x6f,0x80,0xfd,0x02,0xfe,0x00,0x04,0xfa,0x1f,0xe0,0xdf,0x17,
+0xf9,0x00,0x05,0xf9,0x0b,0xf3,0x9f,0x4d,0xf2,0x00,0x06,0xf7,0x07,0xf8,0x46,0x7f,
+0xa0,0x00,0x09,0xf5,0x02,0x60,0x00,0xdf,0x20,0x00,0xab,0x01,0x51,0xfa,0x00,0x00,
+0x2f,0xe8,0x50,0x00,0x31,0xf5,0x4f,0x86,0xd8,0x00,0x36,0xc4,0x01,0x20,0x00,0x01,
+0x12,0x54,0x08,0x00,0x11,0x05,0x4d,0x08,0x04,0x48,0x01,0x20,0xff,0xbb,0x01,0x00,
+0x60,0xb4,0x00,0xfd,0x00,0xbf,0x10,0x63,0x04,0x31,0xfd,0xcf,0xff,0x00,0x03,0x70,
+0xfd,0x68,0xdf,0x88,0x8f,0xf8,0x82,0x18,0x00,0x30,0x87,0x7f,0xe0,0x08,0x01,0xf1,
+0x00,0xae,0xee,0xee,0xd0,0x00,0x02,0xfb,0x57,0x77,0x77,0x77,0x75,0x00,0x04,0xf9,
+0x08,0x01,0xf0,0x14,0x20,0x07,0xf7,0x05,0xfd,0x40,0x5e,0xf6,0x00,0x0a,0xf3,0x00,
+0x5f,0xfc,0xff,0x50,0x00,0x1f,0xf3,0x8a,0xdf,0xff,0xff,0xca,0x83,0x2d,0x91,0xff,
+0xd9,0x53,0x7c,0xff,0xf1,0x00,0x10,0x3f,0x06,0x03,0x86,0x00,0xf0,0x03,0x14,0x7b,
+0x20,0x2f,0xff,0xf8,0x5a,0xce,0xff,0xff,0xb0,0x1a,0xaf,0xf2,0x5f,0xec,0xff,0x51,
+0xe1,0x04,0x11,0x00,0x50,0x09,0xf1,0x1b,0xaf,0x40,0x02,0x10,0xcf,0x10,0x00,0x02,
+0xfd,0x00,0x1f,0xb0,0xcf,0x98,0x80,0x09,0xff,0xff,0x1f,0xb0,0xcf,0xff,0xf0,0x09,
+0x99,0xfe,0x1f,0xb0,0xcf,0x32,0x20,0x03,0x51,0xfb,0x1f,0xb0,0xcf,0x10,0x00,0x0b,
+0xf6,0xf8,0x08,0x00,0xc1,0x04,0xff,0xf3,0x1f,0xd8,0xef,0x98,0x82,0x00,0xbf,0xe0,
+0x1f,0x62,0x07,0x31,0xaf,0xfb,0x51,0x77,0x06,0xf7,0x02,0xfd,0xbf,0xff,0xfe,0xdc,
+0xdd,0xd5,0x2d,0xe2,0x03,0x9b,0xde,0xff,0xff,0xf1,0x01,0x10,0x34,0x0b,0x10,0xb0,
+0x68,0x03,0xa1,0xfa,0x34,0x5f,0xd4,0x44,0x10,0x0a,0xae,0xf3,0xcf,0xd2,0x08,0xa2,
+0x1f,0xc1,0x44,0x5f,0xd4,0x9f,0x50,0x00,0x7f,0x6a,0x19,0x06,0x20,0xef,0x33,0x10,
+0x00,0x50,0x70,0x06,0xff,0xf8,0xdf,0x20,0x00,0xf1,0x14,0x05,0x7a,0xf5,0x56,0x7f,
+0xd6,0x66,0x10,0x03,0x38,0xf3,0xbc,0xcf,0xfc,0xcc,0x40,0x0d,0xbb,0xf0,0x9a,0xaf,
+0xea,0xaa,0x40,0x07,0xff,0xb5,0x88,0x9f,0xe8,0x88,0x80,0x00,0xef,0x79,0xd9,0x05,
+0xf3,0x0a,0x02,0xef,0xe6,0x10,0x06,0x50,0x00,0x00,0x2e,0xf8,0xdf,0xfe,0xdc,0xbb,
+0xbb,0xb3,0x2d,0x70,0x05,0xac,0xdf,0xff,0xff,0xe0,0x01,0x7c,0x00,0x05,0xe0,0x02,
+0x01,0xc8,0x02,0x60,0xdc,0xc0,0x00,0x00,0x7f,0x70,0xb8,0x01,0x0f,0x08,0x00,0x05,
+0x04,0xe8,0x02,0xc1,0x1d,0xdd,0xff,0xed,0xdd,0xff,0xed,0xd6,0x00,0x00,0xcf,0x30,
+0x20,0x00,0x31,0x02,0xff,0x00,0x08,0x00,0x22,0x0a,0xf9,0x08,0x00,0x21,0x8f,0xf2,
+0x08,0x00,0x31,0x0b,0xff,0x50,0x08,0x00,0x32,0x03,0xd3,0x00,0x18,0x00,0x04,0x01,
+0x00,0x12,0xaf,0x28,0x04,0x70,0x00,0xaf,0xa9,0x99,0x99,0x9b,0xf8,0x68,0x01,0x02,
+0x37,0x0d,0x05,0x18,0x00,0x10,0xa8,0xa1,0x06,0xb1,0x20,0x00,0x9f,0x71,0x10,0x00,
+0x01,0x2c,0xf3,0x00,0x4f,0x78,0x00,0xf4,0x02,0xd0,0x00,0x02,0xff,0xa9,0x99,0xff,
+0xa6,0x10,0x03,0x33,0xdf,0x43,0x33,0xcf,0x53,0x31,0x4a,0x09,0xf1,0x04,0x08,0x8b,
+0xfe,0x88,0x88,0xef,0x98,0x83,0x00,0x3e,0xf7,0x00,0x00,0xbf,0x20,0x00,0x09,0xff,
+0xa0,0x08,0x00,0x01,0x70,0x03,0x17,0xbf,0x78,0x00,0x07,0x01,0x00,0x41,0x5f,0xb1,
+0xc5,0x00,0xa9,0x0b,0x32,0xb4,0xff,0x40,0xb1,0x0b,0x40,0x4f,0x50,0x1d,0xdd,0x22,
+0x09,0x24,0xde,0xd2,0xb8,0x04,0x01,0xf3,0x05,0x13,0xe0,0xa8,0x01,0x12,0xf0,0x30,
+0x01,0xa2,0x5e,0xf1,0x00,0x00,0x06,0xcd,0xff,0xcc,0x4c,0xf4,0xef,0x07,0x22,0x09,
+0xf7,0x08,0x00,0xf0,0x0f,0x04,0xfb,0x00,0x30,0x00,0x01,0xfc,0x25,0x60,0xff,0x12,
+0xf6,0x06,0x8b,0xff,0xff,0xd0,0xbf,0x96,0xf6,0x0e,0xff,0xeb,0x74,0x00,0x2f,0xff,
+0xf2,0x05,0x51,0x6a,0x03,0x23,0xdf,0x80,0x0c,0x0a,0x01,0xcb,0x00,0x51,0xff,0x2c,
+0xcc,0xcc,0xfd,0x56,0x00,0x70,0x0f,0xd0,0x00,0xff,0x01,0x11,0x12,0x0d,0x00,0x11,
+0xef,0x1a,0x00,0x81,0x1f,0xfa,0xaa,0xa8,0x00,0x0f,0xf3,0xfb,0x12,0x03,0x72,0x6f,
+0xeb,0xbb,0xbb,0x00,0x0f,0xfa,0x61,0x0b,0x32,0x00,0x00,0x02,0x34,0x00,0x20,0x4f,
+0xb0,0x0d,0x00,0xf1,0x00,0x08,0xf8,0x00,0x0f,0xf0,0x0a,0xee,0xff,0x40,0x00,0xff,
+0x00,0x4f,0xfe,0x80,0x1a,0x00,0x01,0xdd,0x04,0x20,0xff,0xff,0x49,0x02,0xf0,0x15,
+0xc0,0x9a,0xaa,0xef,0x38,0xbb,0xbb,0xfc,0x00,0x00,0x0b,0xf3,0x00,0x00,0x2f,0xc0,
 0x7f,0xff,0xff,0x38,0xff,0xff,0xfc,0x08,0xfc,0xaa,0xa2,0x9f,0xca,0xaa,0x80,0x9f,
-0x40,0xc3,0x10,0x00,0x2a,0x45,0xf2,0x2a,0xf6,0xbf,0xff,0xff,0xf0,0x7a,0xaa,0xdf,
-0x58,0xaa,0xaa,0xff,0x08,0xfa,0x39,0xf4,0x7f,0xa5,0x0f,0xe0,0x29,0xec,0xbf,0x32,
-0x8e,0xe6,0xfd,0x04,0x8d,0xff,0xf2,0x38,0xdf,0xff,0xc3,0xff,0xb6,0xff,0x0e,0xfd,
-0x76,0xfa,0x05,0x19,0xbf,0xc0,0x44,0x77,0xcf,0x70,0x00,0xaf,0xe4,0x00,0x0e,0xff,
-0xd1,0x44,0x05,0x13,0x10,0x6c,0x11,0xf1,0x0d,0x66,0x00,0x1f,0xff,0xf9,0x0c,0xf4,
-0x00,0xee,0x00,0x1a,0xac,0xf9,0x02,0xfc,0x06,0xf6,0x00,0x00,0x03,0xf9,0x34,0xa6,
-0x4d,0xf5,0x40,0x08,0x9b,0x26,0x73,0xc1,0xd0,0x0e,0xff,0xf9,0xaf,0x34,0xfd,0x1e,
-0xd0,0x0e,0xb1,0x10,0x10,0x00,0xf0,0x02,0x0f,0xa0,0x00,0xaf,0xab,0xfe,0xaf,0xd0,
-0x0f,0xea,0xa6,0xaf,0x56,0xfd,0x4f,0xd0,0x1f,0x63,0x2f,0x00,0x04,0x01,0xa2,0x03,
-0xf7,0x12,0x24,0xfd,0x22,0x20,0x00,0x05,0xfc,0x11,0x04,0xa1,0x08,0xf8,0xaa,0xab,
-0xff,0xaa,0xa4,0x09,0xdf,0xf1,0xf3,0x2a,0x34,0x04,0xff,0x80,0xf9,0x43,0x00,0x7e,
-0x1f,0x00,0xfb,0x0d,0x10,0x0c,0x27,0x0a,0x70,0x1b,0xbb,0xef,0x0c,0xf8,0x88,0xef,
-0xae,0x33,0x80,0x0c,0xe2,0x22,0xcf,0x10,0x05,0x66,0xdf,0x18,0x00,0x00,0xae,0x83,
-0xf1,0x00,0x05,0x68,0xfb,0x66,0x00,0x0f,0xc5,0x55,0x17,0x79,0xfc,0x77,0x40,0x1f,
-0x90,0xcc,0x02,0xd0,0x80,0x3f,0xd9,0x99,0x3f,0x83,0xf8,0x3f,0x80,0x5f,0xff,0xff,
-0x2f,0x08,0x00,0x30,0x25,0x55,0xef,0xfc,0x01,0x00,0xa5,0x0d,0x51,0x07,0x79,0xfb,
-0xae,0x40,0x66,0x3e,0x80,0xf8,0x8f,0x70,0x04,0xbd,0xf9,0xad,0xef,0x81,0x5e,0x76,
-0xff,0xc1,0xaf,0xec,0xb9,0x7a,0xe4,0xe8,0x30,0x00,0x0d,0x2b,0xf0,0x04,0x10,0x1e,
-0xd0,0x00,0xff,0x00,0x1f,0xf2,0x0b,0xf8,0x00,0xff,0x00,0x6f,0xc0,0x02,0xfe,0x00,
-0xff,0x76,0x47,0x40,0xcf,0x30,0xff,0x04,0x41,0x05,0x63,0x01,0xff,0x10,0x32,0x00,
-0x0e,0x55,0x10,0x00,0xa6,0x1b,0x23,0xdf,0xf1,0x1d,0x41,0x20,0x04,0xcc,0xd4,0x2c,
-0x27,0xf1,0x05,0x2e,0x5e,0x14,0x0e,0x07,0x00,0x12,0x4f,0x15,0x00,0x17,0x3d,0x31,
-0x00,0x05,0x22,0x05,0x12,0xf5,0x52,0x5e,0xa2,0xbe,0xf5,0x00,0x00,0x25,0x55,0x55,
-0x55,0x5d,0xf4,0xb3,0x0a,0x00,0xdd,0x10,0x71,0x37,0x77,0x77,0x77,0x7e,0xf2,0x00,
-0xf9,0x1c,0x35,0x9f,0xfa,0x90,0x3c,0x0c,0x60,0x5b,0x30,0x0f,0xf2,0x02,0xc7,0xb1,
-0x73,0x20,0x0f,0xfc,0xf7,0x1a,0xe0,0x02,0xd8,0x7f,0xff,0xfe,0x40,0x00,0x00,0x16,
-0xcf,0xff,0xf9,0xfe,0x50,0x4e,0x2b,0xd0,0x4f,0xe0,0x7f,0xfd,0x80,0x07,0xd7,0x39,
-0xaf,0xe0,0x03,0xaf,0xa0,0xfb,0x44,0x2c,0x60,0x00,0xfd,0x1b,0x21,0x47,0x10,0x66,
-0x73,0x80,0x04,0xff,0x40,0x4c,0xff,0xcd,0xfe,0xc0,0x25,0x2f,0x61,0xce,0x03,0xfa,
-0x0c,0xff,0x50,0x08,0x00,0x31,0x06,0xc2,0x00,0x08,0x00,0x00,0x31,0x12,0x90,0x69,
-0xef,0x9b,0xfd,0x91,0x05,0xfe,0x20,0xaf,0x96,0x00,0xa0,0x9f,0xe3,0x00,0x12,0xee,
-0x25,0xfb,0x2b,0xfc,0x20,0x15,0x9c,0x61,0xfa,0x01,0x70,0x0b,0x91,0x03,0x6f,0x58,
-0x30,0x9f,0xc0,0x07,0x6f,0x58,0xf9,0x09,0x09,0xfe,0x10,0x0d,0xf2,0x03,0xfa,0x04,
-0xdf,0xe2,0x00,0x9f,0xb0,0x03,0xfa,0x7f,0xfa,0x10,0x00,0x3d,0x10,0x03,0xfa,0x1b,
-0xde,0x0f,0x02,0x4a,0x10,0x11,0x05,0xfe,0x00,0xa1,0x8f,0x90,0x05,0xfa,0x55,0x5b,
-0xf5,0x06,0xfe,0x20,0x10,0x00,0x30,0x9f,0xf3,0x00,0x10,0x00,0xf0,0x05,0xf9,0xfe,
-0x30,0x00,0x04,0xcc,0xdf,0xdc,0xc4,0x41,0x08,0x60,0x08,0x88,0xdf,0xb8,0x88,0x00,
-0xaf,0xc0,0x40,0x2c,0xc1,0xa9,0x4d,0xfc,0x00,0x01,0xee,0xee,0xee,0xe5,0xff,0x90,
-0x00,0x4b,0x1e,0x32,0x75,0x01,0x20,0x44,0x1e,0x70,0x0c,0xf4,0x01,0xfd,0xef,0xed,
-0xd1,0x3d,0x2b,0xf0,0x06,0xfa,0x8f,0x7f,0x70,0x5e,0xfb,0x00,0x0d,0xf8,0xcf,0x59,
-0xfa,0xff,0x80,0x00,0x01,0x38,0xfc,0x11,0x31,0xb3,0x73,0x00,0x13,0x93,0x29,0x69,
-0x20,0xf7,0x4f,0x5d,0x44,0xb0,0x03,0xef,0x90,0x3b,0xbb,0xbc,0xff,0x90,0x1f,0xf8,
-0x10,0xba,0x30,0x80,0x00,0x08,0x51,0xed,0x10,0x04,0xef,0xd1,0x44,0x7c,0x10,0x04,
-0x64,0x6a,0xf0,0x05,0x01,0xbf,0xc5,0xdf,0xfd,0x44,0xcf,0xf7,0x2d,0xff,0xb3,0xfd,
-0x60,0x00,0x05,0xe4,0x2f,0xef,0xb0,0x49,0x2c,0x0d,0x41,0x06,0x4f,0xb0,0x4f,0xc3,
-0x03,0x70,0x3f,0xb0,0x02,0x23,0xfe,0x22,0x20,0x33,0x20,0x01,0x30,0x12,0x05,0x08,
-0x00,0x92,0xb2,0xbb,0xbc,0xff,0xbb,0xb9,0x00,0x3f,0xb3,0x53,0x29,0x22,0x04,0xa3,
-0x48,0x12,0x21,0x2e,0xf4,0x08,0x00,0xa1,0x02,0xdf,0x70,0x7b,0xbd,0xfe,0xbb,0xb0,
-0x1e,0xf8,0x24,0x05,0x42,0xf0,0x0b,0x61,0xd8,0x20,0x00,0xa1,0x0c,0xfd,0xaa,0xac,
-0xfd,0xaa,0xa8,0x00,0xaf,0xd8,0xf7,0x0a,0x40,0x1c,0xff,0xb0,0x00,0x7f,0x6e,0x30,
-0x3f,0xff,0xb4,0xce,0x2b,0x42,0xa6,0x09,0x3f,0xb5,0xcc,0x0b,0x60,0x1f,0xb0,0x2a,
-0x60,0x03,0xfb,0x3a,0x62,0x31,0x1e,0xf3,0x02,0x08,0x00,0x22,0x04,0xfa,0x08,0x00,
-0x42,0x00,0x33,0xcd,0xfa,0x62,0x62,0x08,0xcd,0x11,0x04,0xc3,0x14,0x31,0x1e,0xf4,
-0xbf,0x8e,0x34,0xb0,0xdf,0x70,0xbf,0xa9,0x99,0xef,0x10,0x1e,0xf9,0x00,0xbf,0x78,
-0x42,0x41,0x0c,0x72,0xd6,0xbf,0x98,0x0d,0xa0,0x0d,0xf6,0xbf,0x97,0x77,0xef,0x10,
-0x00,0xaf,0xd0,0xe4,0x4f,0x41,0x10,0x0a,0xff,0xb0,0x18,0x00,0xf0,0x01,0x4f,0xff,
-0xb0,0xbf,0xae,0xf9,0x9b,0x00,0x0b,0x6f,0xb0,0xbf,0x27,0xf4,0x5f,0x90,0xa6,0x53,
-0x40,0x21,0xfe,0xfe,0x40,0x08,0x00,0x40,0x20,0x8f,0xe1,0x00,0x50,0x07,0xf6,0x05,
-0x78,0x5d,0xfb,0x10,0x00,0x1f,0xb2,0xff,0xff,0x61,0xdf,0xf3,0x00,0x1f,0xb0,0xd9,
-0x51,0x00,0x08,0x80,0xc4,0x28,0x00,0x56,0x06,0xf0,0x07,0x64,0x00,0x00,0xaf,0x74,
-0x8a,0xbd,0xff,0xff,0x30,0x07,0xfc,0x0a,0xfe,0xdb,0xef,0x61,0x00,0x5f,0xd2,0x0a,
-0xf1,0x6f,0x35,0x32,0x1c,0x2d,0xba,0x09,0x03,0x20,0x9f,0x9a,0x4e,0x10,0x20,0xa3,
-0x05,0x31,0x50,0x10,0xde,0x52,0x5b,0x20,0x0a,0xf4,0x3a,0x0a,0xf1,0x0d,0x4f,0xff,
-0x0a,0xf3,0xfc,0x88,0xaf,0x80,0x04,0xbf,0x0b,0xf3,0xfe,0xcc,0xdf,0x80,0x00,0xbf,
-0x0c,0xe3,0xfa,0x55,0x8f,0x80,0x00,0xbf,0x0d,0xd3,0xe1,0x03,0xf5,0x08,0xbf,0x1f,
-0xb3,0xfa,0x44,0x7f,0x80,0x00,0xbf,0x2f,0x83,0xfb,0x77,0x9f,0x80,0x00,0xbf,0x6f,
-0x33,0xff,0xee,0xff,0x80,0x79,0x54,0x50,0x29,0x20,0x2f,0x10,0x0b,0x06,0x08,0xf0,
-0x11,0x50,0x3f,0x10,0x0f,0xd0,0x00,0x09,0xfa,0x2f,0x4f,0x4f,0x2f,0xa0,0x00,0x6f,
-0xc1,0x2f,0x4f,0x4f,0x5f,0xa4,0x41,0x1c,0x3e,0xbf,0xaf,0xaf,0xaf,0xff,0xf7,0x00,
-0xaf,0x1d,0x0f,0xc0,0x5d,0xe2,0x05,0xff,0x13,0x33,0x36,0xff,0x1e,0xb0,0x4f,0xfe,
-0xe7,0x01,0xf0,0x11,0x6f,0x80,0x7f,0xfe,0x16,0x77,0x76,0x3e,0xcf,0x50,0x06,0xce,
-0x0a,0xff,0xf8,0x0a,0xff,0x10,0x00,0xce,0x0a,0xe3,0xf8,0x26,0xfb,0x00,0x00,0xce,
-0x0c,0xc0,0xff,0xd8,0x08,0x00,0xfe,0x06,0x0f,0xa3,0xfc,0x8f,0xff,0x70,0x00,0xce,
-0x8f,0x50,0x68,0xfd,0x1c,0xf6,0x00,0xce,0x19,0x00,0x04,0xb1,0x01,0x8f,0x4b,0x22,
-0x0b,0x60,0x89,0x58,0x21,0x9f,0x89,0xe1,0x56,0x41,0x06,0xfc,0x0d,0xff,0xd5,0x13,
-0xa1,0xe2,0x00,0x11,0x1f,0xd1,0x11,0x10,0x8f,0x3b,0xb5,0xfc,0x0f,0xf1,0x04,0x03,
-0x4f,0xc4,0xf6,0xcb,0x7f,0x3e,0xb0,0x00,0xdf,0x44,0xf5,0xba,0x6f,0x2d,0xb0,0x0a,
-0xff,0x14,0x18,0x00,0x31,0x8f,0xff,0x11,0xff,0x6b,0x32,0x7f,0xdf,0x2f,0xd2,0x09,
-0xf2,0x15,0xaf,0x18,0x77,0x8f,0xc7,0x79,0x71,0x00,0xaf,0x1c,0xbd,0xc9,0xe1,0x6f,
+0x40,0x00,0x09,0xf4,0xd3,0x0c,0xf2,0x2b,0xff,0xf6,0xbf,0xff,0xff,0xf0,0x7a,0xaa,
+0xdf,0x58,0xaa,0xaa,0xff,0x08,0xfa,0x39,0xf4,0x7f,0xa5,0x0f,0xe0,0x29,0xec,0xbf,
+0x32,0x8e,0xe6,0xfd,0x04,0x8d,0xff,0xf2,0x38,0xdf,0xff,0xc3,0xff,0xb6,0xff,0x0e,
+0xfd,0x76,0xfa,0x05,0x19,0xbf,0xc0,0x44,0x77,0xcf,0x70,0x00,0xaf,0xe4,0x00,0x0e,
+0xff,0xd1,0x44,0x05,0x11,0x10,0x8d,0x0a,0xf0,0x11,0x60,0x00,0x66,0x00,0x1f,0xff,
+0xf9,0x0c,0xf4,0x00,0xee,0x00,0x1a,0xac,0xf9,0x02,0xfc,0x06,0xf6,0x00,0x00,0x03,
+0xf9,0x34,0xa6,0x4d,0xf5,0x40,0x08,0x9b,0xf9,0xaf,0xf6,0x00,0xb1,0x0e,0xff,0xf9,
+0xaf,0x34,0xfd,0x1e,0xd0,0x0e,0xb1,0x10,0x10,0x00,0xf1,0x05,0x0f,0xa0,0x00,0xaf,
+0xab,0xfe,0xaf,0xd0,0x0f,0xea,0xa6,0xaf,0x56,0xfd,0x4f,0xd0,0x1f,0xff,0xf8,0xaf,
+0x1e,0x01,0xa2,0x03,0xf7,0x12,0x24,0xfd,0x22,0x20,0x00,0x05,0xfc,0x11,0x04,0xb0,
+0x08,0xf8,0xaa,0xab,0xff,0xaa,0xa4,0x09,0xdf,0xf1,0x00,0xa3,0x09,0x31,0x04,0xff,
+0x80,0x08,0x00,0x01,0x01,0x00,0x11,0x11,0xfb,0x0d,0x10,0x0c,0x27,0x0a,0x60,0x1b,
+0xbb,0xef,0x0c,0xf8,0x88,0x1d,0x0a,0x91,0xbf,0x0c,0xe2,0x22,0xcf,0x10,0x05,0x66,
+0xdf,0x18,0x00,0xf1,0x03,0x0e,0xff,0xff,0x05,0x68,0xfb,0x66,0x00,0x0f,0xc5,0x55,
+0x17,0x79,0xfc,0x77,0x40,0x1f,0x90,0xcc,0x02,0xd0,0x80,0x3f,0xd9,0x99,0x3f,0x83,
+0xf8,0x3f,0x80,0x5f,0xff,0xff,0x2f,0x08,0x00,0x30,0x25,0x55,0xef,0xfc,0x01,0x00,
+0xa5,0x0d,0x50,0x07,0x79,0xfb,0xae,0x40,0xd9,0x01,0xf0,0x0d,0x03,0xf8,0x8f,0x70,
+0x04,0xbd,0xf9,0xad,0xef,0xff,0xff,0xf0,0x02,0xff,0xc1,0xaf,0xec,0xb9,0x7a,0xe4,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x1d,0x00,0x10,0x00,0xff,0x00,0x04,
+0x10,0x1e,0xd0,0x00,0xff,0x00,0x1f,0xf2,0x0b,0xf8,0x00,0xff,0x00,0x6f,0xc0,0x02,
+0xfe,0x00,0xff,0x00,0xdf,0x40,0x00,0xcf,0x30,0xff,0x04,0xfb,0x00,0x00,0x31,0x01,
+0xff,0x10,0x32,0x00,0x0e,0xff,0x01,0x00,0x90,0xf1,0x0c,0xdd,0xdd,0xdd,0xdd,0xdf,
+0xf1,0x00,0x01,0x00,0xa2,0x0e,0xf1,0x04,0xcc,0xcc,0xcc,0xcc,0xcf,0xf1,0x05,0x1c,
+0x00,0x03,0x15,0x00,0x03,0x07,0x00,0x12,0x4f,0x15,0x00,0x17,0x3d,0x31,0x00,0x00,
+0x01,0x00,0x01,0x16,0x00,0xf0,0x05,0xf5,0x00,0x00,0xbb,0xbb,0xbb,0xbb,0xbe,0xf5,
+0x00,0x00,0x25,0x55,0x55,0x55,0x5d,0xf4,0x00,0x00,0x7f,0x18,0x00,0xf1,0x05,0xf3,
+0x00,0x00,0x37,0x77,0x77,0x77,0x7e,0xf2,0x00,0x09,0x99,0x99,0x99,0x99,0x9f,0xfa,
+0x90,0x0f,0xff,0x01,0x00,0xfa,0x2a,0xf0,0x00,0x5b,0x30,0x0f,0xf2,0x02,0xc7,0x00,
+0x00,0x8f,0xf8,0x0f,0xfc,0x4e,0xf9,0x00,0x00,0x02,0xd8,0x7f,0xff,0xfe,0x40,0x00,
+0x00,0x16,0xcf,0xff,0xf9,0xfe,0x50,0x00,0x0b,0xff,0xfa,0x4f,0xe0,0x7f,0xfd,0x80,
+0x07,0xd7,0x39,0xaf,0xe0,0x03,0xaf,0xa0,0x00,0x00,0x0d,0xfd,0x60,0x00,0x02,0x00,
+0x01,0x00,0x30,0x47,0x10,0x6f,0x4d,0x00,0xf1,0x03,0x04,0xff,0x40,0x4c,0xff,0xcd,
+0xfe,0xc0,0x6f,0xf5,0x00,0x00,0xce,0x03,0xfa,0x0c,0xff,0x50,0x08,0x00,0x31,0x06,
+0xc2,0x00,0x08,0x00,0xd0,0x00,0x00,0x5f,0x80,0x69,0xef,0x9b,0xfd,0x91,0x05,0xfe,
+0x20,0xaf,0x96,0x00,0xf0,0x06,0x9f,0xe3,0x00,0x12,0xee,0x25,0xfb,0x2b,0xfc,0x20,
+0x00,0x00,0xfd,0x03,0xfa,0x01,0x70,0x0b,0x91,0x03,0xfa,0x28,0x00,0xfb,0x12,0x9f,
+0xc0,0x07,0xf7,0x03,0xfa,0x00,0x09,0xfe,0x10,0x0d,0xf2,0x03,0xfa,0x04,0xdf,0xe2,
+0x00,0x9f,0xb0,0x03,0xfa,0x7f,0xfa,0x10,0x00,0x3d,0x10,0x03,0xfa,0x1b,0x50,0x00,
+0x01,0x00,0x31,0x02,0x00,0x05,0xfe,0x00,0xa1,0x8f,0x90,0x05,0xfa,0x55,0x5b,0xf5,
+0x06,0xfe,0x20,0x10,0x00,0x30,0x9f,0xf3,0x00,0x10,0x00,0xf0,0x43,0xf9,0xfe,0x30,
+0x00,0x04,0xcc,0xdf,0xdc,0xc4,0x41,0x08,0x60,0x08,0x88,0xdf,0xb8,0x88,0x00,0xaf,
+0xc0,0x0a,0xaa,0xaa,0xaa,0xa9,0x4d,0xfc,0x00,0x01,0xee,0xee,0xee,0xe5,0xff,0x90,
+0x00,0x01,0xfc,0x55,0x5d,0xf1,0x75,0x01,0x20,0x01,0xfc,0x66,0x6d,0xf1,0x00,0x0c,
+0xf4,0x01,0xfd,0xef,0xed,0xd1,0x00,0xbf,0x90,0x04,0xfa,0x8f,0x7f,0x70,0x5e,0xfb,
+0x00,0x0d,0xf8,0xcf,0x59,0xfa,0xff,0x80,0x00,0x01,0x38,0xfc,0x11,0x31,0xb3,0x73,
+0x00,0x12,0x93,0x7b,0x00,0x20,0x1d,0xf7,0x91,0x01,0xf0,0x2d,0xa0,0x03,0xef,0x90,
+0x3b,0xbb,0xbc,0xff,0x90,0x1f,0xf8,0x10,0x00,0x00,0x1c,0xfc,0x00,0x08,0x51,0xed,
+0x10,0x04,0xef,0xd1,0x00,0x00,0x0c,0xf7,0x04,0xbf,0xff,0xfa,0x20,0x01,0xbf,0xc5,
+0xdf,0xfd,0x44,0xcf,0xf7,0x2d,0xff,0xb3,0xfd,0x60,0x00,0x05,0xe4,0x2f,0xef,0xb0,
+0x49,0x99,0x99,0x99,0x90,0x06,0x4f,0xb0,0x40,0x00,0xf6,0x02,0xe0,0x00,0x3f,0xb0,
+0x02,0x23,0xfe,0x22,0x20,0x00,0x3f,0xb0,0x00,0x01,0xfd,0x00,0x00,0x08,0x00,0x90,
+0xb2,0xbb,0xbc,0xff,0xbb,0xb9,0x00,0x3f,0xb3,0xb0,0x01,0xc1,0xfc,0x00,0x04,0xa3,
+0x00,0x05,0xf8,0x00,0x00,0x00,0x2e,0xf4,0x08,0x00,0xc0,0x02,0xdf,0x70,0x7b,0xbd,
+0xfe,0xbb,0xb0,0x1e,0xf8,0x00,0xaf,0x83,0x01,0x32,0x0b,0x61,0xd8,0x20,0x00,0xa0,
+0x0c,0xfd,0xaa,0xac,0xfd,0xaa,0xa8,0x00,0xaf,0xd8,0x38,0x00,0xf0,0x05,0xfb,0x1c,
+0xff,0xb0,0x00,0x00,0x03,0xfb,0x00,0x3f,0xff,0xb4,0xaa,0xaa,0xab,0xfe,0xa6,0x09,
+0x3f,0xb5,0x18,0x00,0xf1,0x00,0xf9,0x00,0x1f,0xb0,0x2a,0x60,0x03,0xfb,0x00,0x00,
+0x1f,0xb0,0x1e,0xf3,0x02,0x08,0x00,0x22,0x04,0xfa,0x08,0x00,0x41,0x00,0x33,0xcd,
+0xfa,0x08,0x00,0x36,0x00,0xff,0xc3,0x6b,0x01,0x13,0x03,0x7d,0x01,0xf1,0x0b,0x1e,
+0xf4,0xbf,0xff,0xff,0xff,0x10,0x02,0xdf,0x70,0xbf,0xa9,0x99,0xef,0x10,0x1e,0xf9,
+0x00,0xbf,0x20,0x00,0xcf,0x10,0x0c,0x72,0xd6,0x18,0x00,0xf1,0x04,0x00,0x0d,0xf6,
+0xbf,0x97,0x77,0xef,0x10,0x00,0xaf,0xd0,0xbf,0x30,0x00,0xcf,0x10,0x0a,0xff,0xb0,
+0x18,0x00,0xf0,0x09,0x4f,0xff,0xb0,0xbf,0xae,0xf9,0x9b,0x00,0x0b,0x6f,0xb0,0xbf,
+0x27,0xf4,0x5f,0x90,0x00,0x1f,0xb0,0xbf,0x21,0xfe,0xfe,0x40,0x08,0x00,0x30,0x20,
+0x8f,0xe1,0x70,0x00,0xf5,0x06,0xcf,0x78,0x5d,0xfb,0x10,0x00,0x1f,0xb2,0xff,0xff,
+0x61,0xdf,0xf3,0x00,0x1f,0xb0,0xd9,0x51,0x00,0x08,0x80,0x80,0x00,0xf2,0x13,0x08,
+0x20,0x00,0x00,0x02,0x64,0x00,0x00,0xaf,0x74,0x8a,0xbd,0xff,0xff,0x30,0x07,0xfc,
+0x0a,0xfe,0xdb,0xef,0x61,0x00,0x5f,0xd2,0x0a,0xf1,0x00,0xcf,0x20,0x00,0x1c,0x2d,
+0xba,0x09,0x03,0xf2,0x43,0x9f,0x9a,0xfa,0xaa,0xef,0xaa,0xa3,0x05,0xff,0x1a,0xf1,
+0x00,0xde,0x00,0x00,0x4f,0xff,0x0a,0xf4,0xff,0xff,0xff,0x70,0x4f,0xff,0x0a,0xf3,
+0xfc,0x88,0xaf,0x80,0x04,0xbf,0x0b,0xf3,0xfe,0xcc,0xdf,0x80,0x00,0xbf,0x0c,0xe3,
+0xfa,0x55,0x8f,0x80,0x00,0xbf,0x0d,0xd3,0xff,0xff,0xff,0x80,0x00,0xbf,0x1f,0xb3,
+0xfa,0x44,0x7f,0x80,0x00,0xbf,0x2f,0x83,0xfb,0x77,0x9f,0x80,0x00,0xbf,0x6f,0x33,
+0xff,0xee,0xff,0x80,0x00,0x00,0x01,0x80,0x00,0xf0,0x2a,0x29,0x20,0x2f,0x10,0x0b,
+0xa0,0x00,0x00,0xcf,0x50,0x3f,0x10,0x0f,0xd0,0x00,0x09,0xfa,0x2f,0x4f,0x4f,0x2f,
+0xa0,0x00,0x6f,0xc1,0x2f,0x4f,0x4f,0x5f,0xa4,0x41,0x1c,0x3e,0xbf,0xaf,0xaf,0xaf,
+0xff,0xf7,0x00,0xaf,0x9f,0xff,0xff,0xff,0x5d,0xe2,0x05,0xff,0x13,0x33,0x36,0xff,
+0x1e,0xb0,0x4f,0xfe,0xe7,0x01,0xf0,0x11,0x6f,0x80,0x7f,0xfe,0x16,0x77,0x76,0x3e,
+0xcf,0x50,0x06,0xce,0x0a,0xff,0xf8,0x0a,0xff,0x10,0x00,0xce,0x0a,0xe3,0xf8,0x26,
+0xfb,0x00,0x00,0xce,0x0c,0xc0,0xff,0xd8,0x08,0x00,0xfc,0x08,0x0f,0xa3,0xfc,0x8f,
+0xff,0x70,0x00,0xce,0x8f,0x50,0x68,0xfd,0x1c,0xf6,0x00,0xce,0x19,0x00,0x04,0xb1,
+0x01,0xa0,0x00,0x01,0x00,0xf0,0x03,0x0b,0x60,0x00,0x0c,0xf2,0x00,0x00,0x00,0x9f,
+0x89,0xbb,0xbf,0xfb,0xbb,0xb2,0x06,0xfc,0x0d,0xf8,0x00,0xb1,0xf2,0x4f,0xe2,0x00,
+0x11,0x1f,0xd1,0x11,0x10,0x8f,0x3b,0xe0,0x01,0xf1,0x05,0xb0,0x03,0x4f,0xc4,0xf6,
+0xcb,0x7f,0x3e,0xb0,0x00,0xdf,0x44,0xf5,0xba,0x6f,0x2d,0xb0,0x0a,0xff,0x14,0x18,
+0x00,0xb1,0x8f,0xff,0x11,0x44,0x44,0x44,0x44,0x30,0x7f,0xdf,0x2f,0x21,0x04,0xf0,
+0x18,0x03,0xaf,0x18,0x77,0x8f,0xc7,0x79,0x71,0x00,0xaf,0x1c,0xbd,0xc9,0xe1,0x6f,
 0x30,0x00,0xaf,0x4f,0x7d,0xc0,0x06,0xae,0xd0,0x00,0xaf,0xaf,0x1d,0xfa,0xae,0xd6,
-0xe2,0x00,0xaf,0x12,0x04,0xbc,0x1e,0x52,0x13,0x20,0x74,0x03,0x23,0xed,0x30,0xb4,
-0x07,0x03,0x9d,0x10,0x00,0x4b,0x6a,0x01,0x19,0x1f,0x22,0x3f,0xa0,0x31,0x18,0x10,
-0x02,0xdd,0x18,0x30,0xfb,0x1f,0xe0,0x98,0x10,0x11,0x03,0x08,0x00,0x60,0x7f,0x90,
-0x05,0xf9,0x1f,0xe0,0x2a,0x18,0x40,0x08,0xf7,0x1f,0xe0,0xb7,0x0b,0x10,0x0c,0xf4,
-0x31,0x40,0x08,0x28,0xf9,0x0f,0xc6,0x1d,0x40,0x0f,0xe4,0xd5,0x05,0x8f,0x44,0x11,
-0x2f,0xa3,0x5b,0x43,0xfd,0xcc,0xef,0x70,0x3d,0x19,0x01,0xac,0x28,0x13,0x80,0x4d,
-0x0e,0x40,0xfd,0x30,0x00,0xa5,0x68,0x00,0x40,0xbf,0xf6,0x07,0xfd,0x18,0x00,0x20,
-0x28,0xf8,0x30,0x1f,0x40,0x41,0x4f,0xc0,0x30,0x16,0x1c,0xf0,0x10,0xfe,0x4f,0xc0,
-0x06,0xfe,0x22,0x00,0x04,0xfa,0x4f,0xc0,0x5f,0xf7,0xfc,0x00,0x08,0xf7,0x4f,0xc3,
-0xff,0x70,0xdf,0x50,0x0e,0xf2,0x4f,0xee,0xf9,0x00,0x4f,0xe0,0x6f,0x03,0xf0,0x01,
-0x90,0x00,0x0d,0xf4,0x03,0x30,0x8f,0xf8,0x00,0x05,0x17,0xe5,0x00,0x2c,0xff,0xc0,
-0x5c,0x05,0x22,0x19,0xff,0x3c,0x3c,0x50,0x1e,0xe6,0x1f,0xff,0xee,0x66,0x35,0x23,
-0x10,0x07,0x78,0x00,0x0a,0xa6,0x1a,0x13,0x1b,0xa6,0x39,0x07,0xc6,0x1a,0x09,0xb6,
-0x3a,0x12,0x01,0x07,0x24,0x35,0x20,0x01,0xff,0x8f,0x32,0x21,0x8e,0x50,0x11,0x06,
-0xf1,0x1e,0x45,0x6e,0xfa,0x00,0x12,0x00,0x02,0xf8,0xdf,0x01,0xcf,0x72,0xfc,0x00,
-0x07,0xf6,0xdf,0x00,0x06,0x12,0xcf,0x40,0x0e,0xf2,0xdf,0x10,0x00,0x4f,0xbf,0xc0,
-0x2d,0xb0,0xbf,0xcb,0xbb,0xef,0x5e,0xf2,0x00,0x10,0x3d,0xff,0xff,0xfa,0x03,0x9e,
-0x08,0x01,0x81,0x48,0x07,0x08,0x00,0x20,0x2f,0xb0,0xa9,0x61,0x20,0xb2,0xcf,0x48,
-0x03,0xb0,0x3f,0xef,0xf9,0x9b,0xcf,0xeb,0xef,0x10,0x6f,0xcf,0xbf,0x3b,0x03,0xf2,
-0x05,0x10,0xad,0xbf,0x55,0x00,0x2f,0xb0,0xbf,0x10,0x99,0xbf,0x28,0xaa,0xbf,0xea,
-0xef,0xb0,0x00,0xbf,0x2c,0x3c,0x06,0x70,0xbf,0x21,0x22,0xaf,0xfb,0x22,0x20,0x40,
-0x00,0x30,0xef,0xef,0x40,0x48,0x00,0x40,0x0a,0xf9,0x5f,0xd0,0x08,0x00,0xf0,0x02,
-0x9f,0xe1,0x0c,0xfd,0x20,0x00,0xbf,0x4d,0xfe,0x30,0x02,0xdf,0xf2,0x00,0xbf,0x28,
-0xc2,0x8c,0x52,0x06,0x61,0x02,0x13,0x74,0xd6,0x01,0x13,0xfd,0xf0,0x03,0x02,0x5f,
-0x24,0xf0,0x07,0x01,0xcf,0xdc,0xff,0xbe,0xfc,0xef,0x40,0x1d,0xfb,0x0b,0xf6,0x2f,
-0xd0,0xbf,0x30,0x07,0xc0,0x8f,0xb0,0xbf,0x40,0xf5,0x60,0x30,0xfe,0x15,0xfb,0x21,
-0x2a,0x40,0xdf,0xc1,0x6f,0xe2,0x83,0x39,0xf0,0x21,0x4a,0x03,0xfe,0x34,0xff,0xf9,
-0x00,0x01,0x10,0x55,0x46,0x60,0xbb,0x81,0x00,0x06,0xf4,0xef,0x0c,0xf6,0x00,0xcd,
-0x00,0x0a,0xf2,0xef,0x02,0xfc,0x33,0xaf,0x60,0x1f,0xd0,0xef,0x00,0x20,0x8f,0x5f,
-0xd0,0x4e,0x70,0xcf,0xcb,0xbb,0xff,0x0d,0xc1,0x00,0xab,0x18,0x19,0xe6,0xf6,0x3a,
-0x22,0x1f,0xd0,0x9a,0x33,0x55,0xcf,0xeb,0xbb,0xbb,0xb2,0x26,0x3c,0x00,0xa1,0x4c,
-0x11,0x80,0x64,0x17,0x31,0xfa,0x1f,0xf5,0x07,0x02,0xf0,0x12,0xd5,0x05,0xff,0x81,
-0x00,0x03,0x9f,0xfd,0xbf,0xd3,0x6f,0xfe,0x92,0x2f,0xff,0x80,0x09,0xfe,0x13,0xcf,
-0xe1,0x05,0x60,0x00,0x2c,0xd1,0x00,0x05,0x30,0x01,0xf8,0xcf,0x2d,0x96,0x71,0xf0,
-0x10,0x05,0xf8,0xcf,0x11,0xfe,0x15,0x9f,0x60,0x0b,0xf4,0xcf,0x20,0x31,0x2f,0xbf,
-0xd0,0x2f,0xe0,0xaf,0xcb,0xbb,0xef,0x6c,0xf3,0x05,0x50,0x3c,0xff,0xff,0xfb,0x04,
-0x37,0x35,0x03,0xfc,0x00,0x41,0x3e,0xf7,0x08,0xe5,0x03,0x0b,0x30,0x50,0x04,0xef,
-0xf9,0x62,0x21,0xfe,0xee,0xca,0x2e,0x90,0xbe,0xcc,0xba,0x99,0x87,0xbe,0x20,0x00,
-0x08,0x81,0x0a,0x17,0x82,0x95,0x19,0x12,0xb0,0x34,0x0e,0x66,0x1f,0xd9,0x99,0x99,
-0x9e,0xf1,0x18,0x00,0xf3,0x13,0x20,0x33,0x6f,0xa1,0x00,0x04,0x00,0x04,0xf7,0xfe,
-0x07,0xfd,0x00,0xbf,0x40,0x09,0xf4,0xfe,0x00,0x52,0x3c,0x8f,0xc0,0x1f,0xe0,0xef,
-0xba,0xab,0xef,0x6c,0xf4,0x07,0x80,0x5d,0x78,0x00,0x23,0x3a,0x60,0x7d,0x2f,0x30,
-0xd8,0x88,0x70,0x57,0x24,0x02,0xa8,0x0e,0x31,0x07,0xff,0xb0,0x1d,0x6a,0x13,0x2e,
-0x03,0x08,0x32,0x02,0x69,0x99,0x60,0x00,0x00,0xa1,0x40,0x00,0xf2,0x62,0x00,0x4e,
-0x31,0x31,0xbf,0xf1,0x00,0xc2,0x24,0x10,0x7e,0xa2,0x61,0x04,0x2b,0x08,0xf1,0x1d,
-0x11,0x3e,0xa0,0x00,0x46,0x00,0x07,0xe5,0xff,0x0c,0xf7,0x00,0xef,0x30,0x0d,0xf4,
-0xff,0x01,0xd6,0x8c,0x8f,0xb0,0x6f,0xc0,0xdf,0xca,0xab,0xff,0x1f,0xf1,0x06,0x30,
-0x5d,0xff,0xff,0xe7,0x05,0x20,0x00,0x00,0x48,0x00,0x00,0x85,0x2e,0x16,0x41,0x60,
-0x01,0xff,0x20,0xb0,0x15,0x01,0xe1,0x24,0x63,0x1a,0xaf,0xda,0xaf,0xfb,0xa3,0x35,
-0x17,0x00,0x2f,0x0e,0x52,0xe1,0x11,0x11,0x1d,0xf5,0xef,0x0a,0x10,0x0d,0x08,0x00,
-0x56,0xfb,0xbb,0xbb,0xbf,0xf5,0x20,0x00,0xf8,0x1e,0x00,0x34,0x3b,0xd3,0x00,0x13,
-0x00,0x02,0xe8,0x9f,0x67,0xfe,0x30,0xee,0x10,0x06,0xf8,0x9f,0x60,0x5e,0x30,0x6f,
-0xb0,0x0d,0xf4,0x9f,0x60,0x00,0x0e,0x7c,0xf3,0x2d,0xc0,0x7f,0xeb,0xbb,0xdf,0xa4,
-0xa1,0x00,0x10,0x1b,0xff,0xff,0xfd,0xea,0x0b,0x32,0x10,0x07,0xe3,0x08,0x00,0x22,
-0x08,0xf3,0x08,0x00,0x20,0x1a,0xf3,0x9c,0x41,0x21,0xaf,0x89,0x98,0x08,0xf0,0x2e,
-0x1f,0xff,0xfc,0x9f,0xe9,0x99,0x99,0x90,0x2f,0xef,0xcd,0x2f,0x90,0x0f,0x70,0x00,
-0x6f,0xcf,0x79,0x6f,0x5a,0x5f,0x77,0x80,0x9d,0xaf,0x10,0xaf,0x3f,0x7f,0x5d,0xa0,
-0x02,0xaf,0x10,0xed,0x6f,0x6f,0x5f,0x60,0x00,0xaf,0x16,0xf8,0xba,0xaf,0x7f,0x10,
-0x00,0xaf,0x2e,0xf1,0x02,0xff,0x63,0x00,0x00,0xaf,0x9f,0x80,0x09,0x2a,0x77,0xf8,
-0x08,0xaf,0x18,0x00,0x6f,0xc3,0xfc,0x20,0x00,0xaf,0x10,0x2c,0xfe,0x10,0x7f,0xe2,
-0x00,0xaf,0x10,0x0c,0x80,0x00,0x05,0x90,0x0a,0x65,0x21,0x81,0x00,0x5b,0x67,0x43,
-0x6f,0xe2,0x22,0x20,0xb8,0x01,0x12,0xf0,0x72,0x66,0x27,0x4e,0xf0,0x10,0x00,0x40,
-0xd6,0x66,0x66,0x6f,0x08,0x00,0x00,0x33,0x1e,0x30,0xf0,0x00,0x00,0x8d,0x3b,0x17,
-0x5f,0x20,0x00,0xf2,0x1b,0x07,0x77,0x8e,0xd7,0x77,0x70,0x00,0x01,0x81,0x67,0x1d,
-0xf4,0x00,0x9c,0x00,0x06,0xf8,0xff,0x02,0xfd,0x11,0xbf,0x70,0x0d,0xf2,0xff,0x00,
-0x51,0x5f,0x8f,0xe0,0x4f,0xb0,0xdf,0xcb,0xbb,0xff,0x3c,0xc1,0x02,0x20,0x5d,0xb6,
-0x6d,0x13,0x0a,0x7e,0x23,0x67,0x0a,0xf7,0x44,0x44,0x5f,0xe0,0x10,0x00,0x46,0xf8,
-0x66,0x66,0x6f,0x10,0x00,0x85,0x05,0x5c,0xf7,0x55,0x55,0x6f,0xf5,0x52,0x14,0x16,
-0x62,0x18,0xff,0x71,0x23,0xcf,0xd2,0xe8,0x09,0x00,0x18,0x58,0xf0,0x13,0x9a,0x87,
-0x7e,0xd4,0x10,0x6a,0x10,0x00,0xbb,0x4e,0x96,0xfd,0x01,0xdc,0x10,0x07,0xfc,0x4f,
-0x90,0x32,0x77,0x7f,0xc0,0x3f,0xe2,0x3f,0xe8,0x88,0xee,0x0a,0xf6,0x02,0x30,0x0a,
-0x50,0x03,0x33,0x30,0x00,0xaf,0x55,0x4d,0x20,0xaf,0x06,0xb9,0x04,0x40,0xa0,0x00,
-0xaf,0x38,0x13,0x11,0xc1,0xd0,0x03,0xbf,0xf5,0x55,0x5e,0xf5,0x55,0x20,0x1f,0xef,
-0xcd,0x52,0x11,0xa2,0x3f,0xdf,0x59,0x55,0x5e,0xf6,0x55,0x52,0x6f,0xbf,0x47,0x2a,
-0x31,0x9d,0xaf,0x00,0xd7,0x56,0x32,0x02,0xaf,0x00,0x57,0x28,0x8f,0xaf,0x00,0xfd,
-0x44,0x44,0x9f,0x50,0x00,0x10,0x00,0x07,0x51,0xfc,0x00,0x29,0xcf,0x40,0x08,0x00,
-0x29,0x0e,0xea,0x18,0x4a,0x00,0x29,0x0d,0x05,0xe2,0x68,0xf4,0x00,0x77,0xcf,0x77,
-0x77,0xfd,0x77,0x00,0x04,0x44,0xcf,0x74,0x47,0xfd,0x44,0x40,0x6b,0x14,0x21,0x04,
-0x55,0x01,0x00,0x16,0x50,0xfa,0x67,0x30,0xc4,0x44,0x44,0x30,0x26,0x0f,0x10,0x00,
-0x05,0xf3,0x0e,0x77,0x4a,0x8e,0xe7,0x01,0x97,0x00,0x02,0xfd,0x6f,0x70,0x93,0x85,
-0xcf,0x40,0x1e,0xf4,0x5f,0xc8,0x89,0xfb,0x2f,0xd0,0x05,0x60,0x0b,0xff,0xff,0xe4,
-0x35,0x59,0x05,0xbb,0x84,0x13,0xc4,0xd0,0x21,0x25,0xdf,0x20,0x76,0x3d,0xf0,0x50,
-0xfd,0x77,0x77,0x7b,0xf9,0x77,0x72,0x00,0xfb,0xcd,0xdd,0xd7,0xf5,0x3f,0x90,0x01,
-0xf9,0x55,0x55,0x54,0xf8,0xcf,0x30,0x02,0xf8,0xcf,0xff,0xd1,0xfe,0xfb,0x00,0x05,
-0xf6,0xdc,0x4b,0xe0,0xcf,0xe1,0xb4,0x0a,0xf2,0xdc,0x7c,0xe6,0xff,0xc3,0xf8,0x2f,
-0xc0,0xbd,0xdd,0xcd,0xeb,0xff,0xf3,0x05,0x30,0x34,0x19,0xa1,0x10,0x5b,0x50,0x00,
-0xe8,0xcf,0x18,0xfa,0x01,0xaf,0x40,0x07,0xf8,0xcf,0x10,0xa8,0x3f,0xaf,0xd0,0x1f,
-0xf1,0xcf,0x97,0x77,0xbf,0x6b,0xf4,0x03,0x50,0x4d,0xff,0xff,0xfb,0x02,0x10,0x61,
-0x87,0x03,0xe8,0x02,0x10,0xbf,0xe8,0x59,0x00,0x08,0x00,0x80,0x33,0x33,0xcf,0x20,
-0x02,0xaf,0x93,0xbf,0xe0,0x59,0x40,0x1f,0xcf,0xda,0xbf,0x30,0x5c,0x92,0x3f,0xbf,
-0x9e,0x78,0x88,0x88,0x88,0x30,0x5e,0x81,0x5e,0xc3,0xe0,0x8b,0xaf,0x18,0xf1,0xe8,
-0x5f,0x2c,0xe0,0x01,0xaf,0x18,0x20,0x5c,0x11,0x14,0x88,0x01,0x41,0x00,0xaf,0x1c,
-0xff,0xa0,0x08,0x60,0xaf,0x12,0x7f,0xd5,0x4c,0xfc,0x58,0x00,0x12,0x06,0x37,0x57,
-0x10,0x39,0xd8,0x5b,0x88,0xa3,0x00,0xaf,0x1d,0xda,0x51,0x16,0xad,0x9f,0x24,0x06,
-0x10,0x1a,0x22,0x23,0xb0,0x08,0x00,0xf0,0x24,0x3c,0xfa,0x00,0x5b,0xbb,0xbb,0x60,
-0xbf,0x32,0xef,0x30,0x7f,0xff,0xff,0x90,0xbf,0x40,0x57,0x00,0x02,0x00,0x7f,0x71,
-0xbf,0x98,0xac,0xc0,0x3f,0x60,0xbf,0x8f,0xff,0xff,0xfe,0xc0,0x1e,0xf4,0xff,0x2a,
-0xcf,0x92,0x26,0x00,0x03,0xff,0xfa,0x00,0x6f,0x90,0x9f,0x50,0x7f,0x83,0x20,0x4f,
-0xc2,0xdc,0x23,0x51,0xf7,0x00,0x1f,0xec,0xf5,0x7d,0x53,0xf4,0x13,0x0e,0xff,0x90,
-0x00,0x07,0xfe,0x8f,0xc0,0x0c,0xfd,0x07,0x90,0x7f,0xf4,0x0d,0x62,0xcf,0xff,0x2a,
-0xf1,0x4f,0x60,0x00,0x6f,0xfb,0xcf,0xff,0xd0,0x02,0x00,0x00,0x0a,0x70,0x1d,0xca,
-0x55,0x19,0x45,0x88,0x00,0x32,0x9f,0x68,0xc2,0x08,0x00,0x12,0x7c,0x83,0x37,0x46,
-0x9f,0x71,0xaf,0x40,0xda,0x12,0x80,0xdd,0xdd,0xef,0xed,0xdd,0xd6,0x00,0xff,0xaa,
-0x34,0xf0,0x02,0x35,0x10,0x00,0xff,0xaa,0xa9,0x3f,0xb0,0xbf,0x60,0x00,0xff,0xff,
-0xfe,0x1f,0xe2,0xff,0xcb,0x2a,0x40,0xfd,0x0e,0xfa,0xf9,0xdd,0x0d,0xfe,0x20,0xfd,
+0xe2,0x00,0xaf,0x12,0x04,0xbc,0xcb,0x40,0x7a,0x00,0x13,0x20,0x74,0x03,0x22,0xed,
+0x30,0x09,0x00,0x22,0xaf,0xf7,0x08,0x00,0x30,0x06,0xff,0xb0,0x07,0x00,0x31,0x01,
+0x10,0x3f,0xae,0x00,0xf1,0x00,0x1f,0xe0,0x02,0x00,0x27,0x00,0x00,0xfb,0x1f,0xe0,
+0x00,0x00,0xdf,0x30,0x03,0x08,0x00,0x40,0x7f,0x90,0x05,0xf9,0x08,0x00,0x40,0x2f,
+0xf0,0x08,0xf7,0x08,0x00,0xf0,0x0a,0x0c,0xf4,0x0c,0xf4,0x1f,0xe0,0x00,0x08,0x28,
+0xf9,0x0f,0xf1,0x1f,0xe0,0x00,0x0f,0xe4,0xd5,0x05,0x90,0x0f,0xf0,0x00,0x2f,0xb0,
+0xea,0x04,0xc0,0xfd,0xcc,0xef,0x70,0x00,0x00,0x00,0x05,0xef,0xff,0xfb,0x10,0x70,
+0x00,0x03,0x04,0x02,0x50,0x0c,0xfd,0x30,0x00,0xa5,0x68,0x00,0x40,0xbf,0xf6,0x07,
+0xfd,0x18,0x00,0xf0,0x1e,0x28,0xf8,0x2f,0xf5,0x00,0x00,0x41,0x4f,0xc0,0x30,0xbf,
+0xb0,0x00,0x00,0xfe,0x4f,0xc0,0x06,0xfe,0x22,0x00,0x04,0xfa,0x4f,0xc0,0x5f,0xf7,
+0xfc,0x00,0x08,0xf7,0x4f,0xc3,0xff,0x70,0xdf,0x50,0x0e,0xf2,0x4f,0xee,0xf9,0x00,
+0x4f,0xe0,0x6f,0x03,0xf0,0x01,0x90,0x00,0x0d,0xf4,0x03,0x30,0x8f,0xf8,0x00,0x05,
+0x17,0xe5,0x00,0x2c,0xff,0xc0,0x5c,0x05,0xf3,0x04,0x19,0xff,0xef,0xd0,0x00,0x1f,
+0xe0,0x00,0x1e,0xe6,0x1f,0xff,0xee,0xff,0x90,0x00,0x02,0x10,0x07,0x78,0x00,0x55,
+0x00,0x0f,0xf0,0x00,0x00,0x08,0x00,0x20,0x1b,0xbb,0x6f,0x01,0x32,0xbb,0xb2,0x1f,
+0x40,0x05,0x10,0xf2,0xe9,0x00,0x08,0x20,0x00,0x92,0x01,0xcc,0xcc,0xcf,0xfc,0xcc,
+0xcc,0x20,0x01,0x20,0x00,0x00,0x23,0x01,0x11,0x8e,0x32,0x03,0xf0,0x20,0x10,0x45,
+0x6e,0xfa,0x00,0x12,0x00,0x02,0xf8,0xdf,0x01,0xcf,0x72,0xfc,0x00,0x07,0xf6,0xdf,
+0x00,0x06,0x12,0xcf,0x40,0x0e,0xf2,0xdf,0x10,0x00,0x4f,0xbf,0xc0,0x2d,0xb0,0xbf,
+0xcb,0xbb,0xef,0x5e,0xf2,0x00,0x10,0x3d,0xff,0xff,0xfa,0x03,0x00,0x4e,0x03,0x00,
+0x7b,0x03,0x08,0x08,0x00,0x10,0x2f,0xc3,0x03,0x30,0xcf,0xb2,0xcf,0x48,0x03,0xb0,
+0x3f,0xef,0xf9,0x9b,0xcf,0xeb,0xef,0x10,0x6f,0xcf,0xbf,0x3b,0x03,0xf2,0x05,0x10,
+0xad,0xbf,0x55,0x00,0x2f,0xb0,0xbf,0x10,0x99,0xbf,0x28,0xaa,0xbf,0xea,0xef,0xb0,
+0x00,0xbf,0x2c,0x3c,0x06,0x70,0xbf,0x21,0x22,0xaf,0xfb,0x22,0x20,0x40,0x00,0x30,
+0xef,0xef,0x40,0x48,0x00,0x40,0x0a,0xf9,0x5f,0xd0,0x08,0x00,0xf6,0x06,0x9f,0xe1,
+0x0c,0xfd,0x20,0x00,0xbf,0x4d,0xfe,0x30,0x02,0xdf,0xf2,0x00,0xbf,0x28,0xc2,0x00,
+0x00,0x09,0x70,0x61,0x02,0x13,0x74,0xd6,0x01,0x13,0xfd,0xf0,0x03,0x01,0xd0,0x00,
+0xf8,0x51,0x50,0x01,0xcf,0xdc,0xff,0xbe,0xfc,0xef,0x40,0x1d,0xfb,0x0b,0xf6,0x2f,
+0xd0,0xbf,0x30,0x07,0xc0,0x8f,0xb0,0xbf,0x40,0xcf,0x20,0x00,0x09,0xfe,0x15,0xfb,
+0x00,0xef,0x00,0x00,0xdf,0xc1,0x6f,0xe2,0x03,0xfd,0x00,0x00,0x4a,0x03,0xfe,0x34,
+0xff,0xf9,0x00,0x01,0x10,0x55,0x46,0x60,0xbb,0x81,0x00,0x06,0xf4,0xef,0x0c,0xf6,
+0x00,0xcd,0x00,0x0a,0xf2,0xef,0x02,0xfc,0x33,0xaf,0x60,0x1f,0xd0,0xef,0x00,0x20,
+0x8f,0x5f,0xd0,0x4e,0x70,0xcf,0xcb,0xbb,0xff,0x0d,0xc1,0x00,0x00,0x4d,0xff,0xff,
+0xe6,0x00,0x70,0x01,0xe1,0x1f,0xd0,0x00,0x00,0x00,0x2b,0xbb,0xbb,0xcf,0xeb,0xbb,
+0xbb,0xb2,0x3f,0x50,0x01,0x00,0xc9,0x06,0x31,0x01,0xff,0xcf,0x0a,0x02,0x41,0x0a,
+0xfa,0x1f,0xf5,0x07,0x02,0xf3,0x39,0xd5,0x05,0xff,0x81,0x00,0x03,0x9f,0xfd,0xbf,
+0xd3,0x6f,0xfe,0x92,0x2f,0xff,0x80,0x09,0xfe,0x13,0xcf,0xe1,0x05,0x60,0x00,0x2c,
+0xd1,0x00,0x05,0x30,0x01,0xf8,0xcf,0x2d,0xf6,0x00,0xed,0x00,0x05,0xf8,0xcf,0x11,
+0xfe,0x15,0x9f,0x60,0x0b,0xf4,0xcf,0x20,0x31,0x2f,0xbf,0xd0,0x2f,0xe0,0xaf,0xcb,
+0xbb,0xef,0x6c,0xf3,0x05,0x50,0x3c,0xff,0xff,0xfb,0x04,0x50,0x00,0x00,0x02,0xfc,
+0x00,0x40,0x3e,0xf7,0x08,0xe5,0x68,0x04,0xa0,0xff,0x50,0x04,0xef,0x90,0x00,0x00,
+0xef,0xfe,0xee,0x77,0x05,0xf3,0x03,0x00,0xbe,0xcc,0xba,0x99,0x87,0xbe,0x20,0x00,
+0x08,0x88,0x88,0x88,0x88,0x82,0x00,0x00,0x1f,0x9b,0x07,0x00,0x9d,0x01,0x10,0x0d,
+0x08,0x00,0x56,0xd9,0x99,0x99,0x9e,0xf1,0x18,0x00,0xf3,0x13,0x20,0x33,0x6f,0xa1,
+0x00,0x04,0x00,0x04,0xf7,0xfe,0x07,0xfd,0x00,0xbf,0x40,0x09,0xf4,0xfe,0x00,0x52,
+0x3c,0x8f,0xc0,0x1f,0xe0,0xef,0xba,0xab,0xef,0x6c,0xf4,0x07,0x80,0x5d,0x78,0x00,
+0x31,0x3a,0x60,0x00,0x37,0x03,0x30,0xef,0xd8,0x88,0x82,0x00,0xf3,0x01,0x2d,0xff,
+0xff,0xff,0xf6,0x00,0x00,0x07,0xff,0xb0,0x00,0x5f,0xb0,0x00,0x00,0x2e,0x03,0x08,
+0x32,0x02,0x69,0x99,0x60,0x00,0x61,0x1a,0xaa,0xaa,0xaa,0xae,0xf1,0x89,0x02,0x60,
+0xbb,0xbf,0xf1,0x00,0x00,0x57,0xd8,0x07,0x44,0xf1,0x00,0x00,0xbf,0x2b,0x08,0xf0,
+0x1d,0x11,0x3e,0xa0,0x00,0x46,0x00,0x07,0xe5,0xff,0x0c,0xf7,0x00,0xef,0x30,0x0d,
+0xf4,0xff,0x01,0xd6,0x8c,0x8f,0xb0,0x6f,0xc0,0xdf,0xca,0xab,0xff,0x1f,0xf1,0x06,
+0x30,0x5d,0xff,0xff,0xe7,0x05,0x20,0x00,0x00,0x48,0x00,0x00,0x85,0x79,0x00,0x50,
+0xcf,0x60,0x01,0xff,0x20,0x69,0x06,0x20,0xe0,0x08,0x38,0x06,0x93,0x1a,0xaf,0xda,
+0xaf,0xfb,0xa3,0x00,0x00,0x2f,0x50,0x08,0x50,0x2f,0xe1,0x11,0x11,0x1d,0x08,0x00,
+0x40,0xe0,0x00,0x00,0x0d,0x08,0x00,0x56,0xfb,0xbb,0xbb,0xbf,0xf5,0x20,0x00,0xf6,
+0x1f,0x00,0x34,0x3b,0xd3,0x00,0x13,0x00,0x02,0xe8,0x9f,0x67,0xfe,0x30,0xee,0x10,
+0x06,0xf8,0x9f,0x60,0x5e,0x30,0x6f,0xb0,0x0d,0xf4,0x9f,0x60,0x00,0x0e,0x7c,0xf3,
+0x2d,0xc0,0x7f,0xeb,0xbb,0xdf,0xa4,0xa1,0x00,0x10,0x1b,0xff,0xff,0xfd,0x20,0x5f,
+0x02,0x42,0xaf,0x10,0x07,0xe3,0x08,0x00,0x22,0x08,0xf3,0x08,0x00,0x81,0x1a,0xf3,
+0x11,0x11,0x10,0x01,0xaf,0x89,0x98,0x08,0xf7,0x49,0x1f,0xff,0xfc,0x9f,0xe9,0x99,
+0x99,0x90,0x2f,0xef,0xcd,0x2f,0x90,0x0f,0x70,0x00,0x6f,0xcf,0x79,0x6f,0x5a,0x5f,
+0x77,0x80,0x9d,0xaf,0x10,0xaf,0x3f,0x7f,0x5d,0xa0,0x02,0xaf,0x10,0xed,0x6f,0x6f,
+0x5f,0x60,0x00,0xaf,0x16,0xf8,0xba,0xaf,0x7f,0x10,0x00,0xaf,0x2e,0xf1,0x02,0xff,
+0x63,0x00,0x00,0xaf,0x9f,0x80,0x09,0xff,0xe1,0x00,0x00,0xaf,0x18,0x00,0x6f,0xc3,
+0xfc,0x20,0x00,0xaf,0x10,0x2c,0xfe,0x10,0x7f,0xe2,0x00,0xaf,0x10,0x0c,0x80,0x00,
+0x05,0x90,0x42,0x05,0x21,0x0a,0x81,0xc7,0x04,0x53,0x22,0x6f,0xe2,0x22,0x20,0xb8,
+0x01,0x97,0xf0,0x00,0x00,0x1f,0xd4,0x44,0x44,0x4e,0xf0,0x10,0x00,0x40,0xd6,0x66,
+0x66,0x6f,0x08,0x00,0x40,0xfe,0xee,0xee,0xef,0x08,0x00,0x47,0xd5,0x55,0x55,0x5f,
+0x20,0x00,0xf0,0x1e,0x07,0x77,0x8e,0xd7,0x77,0x70,0x00,0x01,0x81,0x67,0x1d,0xf4,
+0x00,0x9c,0x00,0x06,0xf8,0xff,0x02,0xfd,0x11,0xbf,0x70,0x0d,0xf2,0xff,0x00,0x51,
+0x5f,0x8f,0xe0,0x4f,0xb0,0xdf,0xcb,0xbb,0xff,0x3c,0xc1,0x02,0x20,0x5d,0xff,0xff,
+0xf9,0x76,0x00,0x11,0xff,0xef,0x07,0x77,0x00,0x0a,0xf7,0x44,0x44,0x5f,0xe0,0x10,
+0x00,0x46,0xf8,0x66,0x66,0x6f,0x10,0x00,0x83,0x05,0x5c,0xf7,0x55,0x55,0x6f,0xf5,
+0x52,0x68,0x04,0x83,0xf7,0x00,0x18,0xff,0x71,0x23,0xcf,0xd2,0xe8,0x09,0xf0,0x16,
+0xfe,0x20,0x00,0x9a,0x87,0x7e,0xd4,0x10,0x6a,0x10,0x00,0xbb,0x4e,0x96,0xfd,0x01,
+0xdc,0x10,0x07,0xfc,0x4f,0x90,0x32,0x77,0x7f,0xc0,0x3f,0xe2,0x3f,0xe8,0x88,0xee,
+0x0a,0xf6,0x02,0x30,0x0a,0x50,0x03,0x70,0x30,0x00,0xaf,0x00,0x00,0x0d,0xf0,0x60,
+0x01,0x10,0x06,0xb9,0x04,0xf0,0x06,0xa0,0x00,0xaf,0x38,0xee,0xef,0xfe,0xee,0xd0,
+0x03,0xbf,0xf5,0x55,0x5e,0xf5,0x55,0x20,0x1f,0xef,0xcd,0xff,0x18,0x07,0xa1,0x3f,
+0xdf,0x59,0x55,0x5e,0xf6,0x55,0x52,0x6f,0xbf,0x72,0x00,0xc1,0xf6,0x9d,0xaf,0x00,
+0x66,0x66,0x66,0x66,0x20,0x02,0xaf,0x00,0xf8,0x03,0x9f,0x00,0xaf,0x00,0xfd,0x44,
+0x44,0x9f,0x50,0x00,0x10,0x00,0x07,0x51,0xfc,0x00,0x29,0xcf,0x40,0x08,0x00,0x28,
+0x0e,0xea,0xaa,0x06,0x20,0x0d,0xe0,0xdf,0x02,0x02,0xc8,0x00,0xf2,0x03,0x10,0x00,
+0x77,0xcf,0x77,0x77,0xfd,0x77,0x00,0x04,0x44,0xcf,0x74,0x47,0xfd,0x44,0x40,0x0e,
+0x18,0x00,0x31,0xe0,0x04,0x55,0x01,0x00,0x33,0x50,0x00,0x1f,0xe7,0x03,0x7f,0x1f,
+0xc4,0x44,0x44,0x4c,0xf3,0x00,0x10,0x00,0x06,0xf9,0x10,0x77,0x4a,0x8e,0xe7,0x01,
+0x97,0x00,0x02,0xfd,0x6f,0x70,0x93,0x85,0xcf,0x40,0x1e,0xf4,0x5f,0xc8,0x89,0xfb,
+0x2f,0xd0,0x05,0x60,0x0b,0xff,0xff,0xe4,0x04,0x10,0x2b,0x07,0x22,0xf2,0xc4,0x08,
+0x00,0x53,0xf3,0xdf,0x20,0x00,0xff,0x29,0x0b,0xf4,0x53,0xfd,0x77,0x77,0x7b,0xf9,
+0x77,0x72,0x00,0xfb,0xcd,0xdd,0xd7,0xf5,0x3f,0x90,0x01,0xf9,0x55,0x55,0x54,0xf8,
+0xcf,0x30,0x02,0xf8,0xcf,0xff,0xd1,0xfe,0xfb,0x00,0x05,0xf6,0xdc,0x4b,0xe0,0xcf,
+0xe1,0xb4,0x0a,0xf2,0xdc,0x7c,0xe6,0xff,0xc3,0xf8,0x2f,0xc0,0xbd,0xdd,0xcd,0xeb,
+0xff,0xf3,0x05,0x30,0x34,0x19,0xa1,0x10,0x5b,0x50,0x00,0xe8,0xcf,0x18,0xfa,0x01,
+0xaf,0x40,0x07,0xf8,0xcf,0x10,0xa8,0x3f,0xaf,0xd0,0x1f,0xf1,0xcf,0x97,0x77,0xbf,
+0x6b,0xf4,0x03,0x50,0x4d,0xff,0xff,0xfb,0x02,0x10,0x00,0xaf,0x10,0xe8,0x02,0x00,
+0x9a,0x03,0x10,0x20,0x08,0x00,0xf1,0x10,0x33,0x33,0xcf,0x20,0x02,0xaf,0x93,0xbf,
+0xbb,0xbb,0xef,0x20,0x1f,0xcf,0xda,0xbf,0xaa,0xaa,0xef,0x20,0x3f,0xbf,0x9e,0x78,
+0x88,0x88,0x88,0x30,0x5e,0xaf,0x29,0x08,0x01,0xb2,0x8b,0xaf,0x18,0xf1,0xe8,0x5f,
+0x2c,0xe0,0x01,0xaf,0x18,0x09,0x02,0x21,0xaf,0x14,0x88,0x01,0x41,0x00,0xaf,0x1c,
+0xff,0xa0,0x08,0x60,0xaf,0x12,0x7f,0xd5,0x4c,0xfc,0x58,0x00,0xfd,0x06,0x06,0xff,
+0xff,0xa0,0x00,0x00,0xaf,0x39,0xcf,0xff,0xff,0xfd,0xa3,0x00,0xaf,0x1d,0xda,0x51,
+0x16,0xad,0xc0,0x28,0x08,0x00,0xe2,0x03,0x22,0x23,0xb0,0x08,0x00,0xf2,0x5c,0x3c,
+0xfa,0x00,0x5b,0xbb,0xbb,0x60,0xbf,0x32,0xef,0x30,0x7f,0xff,0xff,0x90,0xbf,0x40,
+0x57,0x00,0x02,0x00,0x7f,0x71,0xbf,0x98,0xac,0xc0,0x3f,0x60,0xbf,0x8f,0xff,0xff,
+0xfe,0xc0,0x1e,0xf4,0xff,0x2a,0xcf,0x92,0x26,0x00,0x03,0xff,0xfa,0x00,0x6f,0x90,
+0x9f,0x50,0x00,0x8f,0xf5,0x00,0x4f,0xc2,0xfd,0x00,0x00,0x3f,0xf7,0x00,0x1f,0xec,
+0xf5,0x00,0x00,0xcf,0xff,0x30,0x0e,0xff,0x90,0x00,0x07,0xfe,0x8f,0xc0,0x0c,0xfd,
+0x07,0x90,0x7f,0xf4,0x0d,0x62,0xcf,0xff,0x2a,0xf1,0x4f,0x60,0x00,0x6f,0xfb,0xcf,
+0xff,0xd0,0x02,0x00,0x00,0x0a,0x70,0x1d,0xff,0x60,0x7a,0x00,0x19,0x45,0x88,0x00,
+0x32,0x9f,0x68,0xc2,0x08,0x00,0x31,0x7c,0xfe,0x30,0x08,0x00,0x44,0x71,0xaf,0x40,
+0x00,0xe0,0x02,0xfe,0x4a,0xff,0xdd,0xdd,0xef,0xed,0xdd,0xd6,0x00,0xff,0x00,0x00,
+0x5f,0x90,0x35,0x10,0x00,0xff,0xaa,0xa9,0x3f,0xb0,0xbf,0x60,0x00,0xff,0xff,0xfe,
+0x1f,0xe2,0xff,0x00,0x01,0xfe,0x00,0xfd,0x0e,0xfa,0xf9,0x00,0x02,0xfc,0x00,0xfd,
 0x0b,0xff,0xf2,0x00,0x03,0xfb,0x01,0xfc,0x07,0xff,0x70,0x30,0x06,0xf9,0xac,0xfa,
 0x0b,0xff,0x00,0xf6,0x0b,0xf5,0xbf,0xf6,0xcf,0xff,0x84,0xf7,0x2f,0xf1,0x01,0x4f,
 0xfc,0x5f,0xff,0xf3,0x0a,0xa0,0x00,0x0a,0x80,0x04,0xdf,0x90,0x00,0x10,0x10,0x01,
-0x32,0x8f,0x83,0xe6,0x27,0x1c,0x40,0x85,0xef,0x70,0x19,0xeb,0x1d,0x34,0xc9,0xaf,
-0xa1,0xd0,0x07,0x00,0x61,0x6a,0xd0,0x9f,0xc6,0x66,0x60,0x02,0x88,0x88,0x85,0x3f,
-0xc0,0x49,0x30,0x05,0x08,0x73,0xa0,0xe0,0xbf,0x50,0x05,0xf6,0x04,0xf9,0x0f,0xf3,
-0xfe,0x33,0x59,0x50,0xf9,0x0d,0xfb,0xf8,0x00,0x18,0x00,0x10,0x09,0x9a,0x17,0xf0,
-0x01,0xaa,0xaa,0xa6,0x06,0xff,0x71,0x20,0x00,0x02,0x58,0xad,0x0a,0xff,0x13,0xf4,
-0x1d,0x4e,0x2f,0xb1,0xff,0x97,0xf5,0x0e,0xd9,0x63,0x2e,0xfc,0x3e,0xff,0xf1,0x76,
-0x33,0x2d,0x04,0xde,0x13,0x65,0x00,0x11,0x17,0xc0,0x0c,0xf1,0x72,0x00,0x06,0xbb,
-0xff,0xbb,0x4c,0xf5,0xfe,0x10,0x42,0x10,0x31,0x6c,0xf1,0x7f,0x29,0x17,0x44,0x0b,
-0xf1,0x09,0x20,0x7e,0x3f,0xf0,0x16,0x2a,0xbd,0xab,0xba,0xad,0xfb,0xaa,0xa2,0x00,
-0xaf,0x3e,0xb0,0x09,0xf4,0x29,0x30,0x04,0xff,0xef,0xff,0xb7,0xf5,0x8f,0x60,0x3f,
-0xfc,0x6d,0xd6,0x45,0xf8,0xef,0x10,0x2d,0xff,0xef,0xfe,0x72,0x84,0x19,0x40,0xfb,
-0x3d,0xc3,0x10,0x8f,0x08,0x00,0xcd,0x03,0xb1,0xdf,0x80,0xa1,0x00,0xfa,0x3d,0xc3,
-0x18,0xff,0x92,0xf5,0x60,0x01,0xa7,0xee,0xfe,0xf2,0x00,0xfc,0x77,0x77,0xad,0x13,
-0xdf,0x00,0x05,0x00,0xe6,0x12,0xf1,0x02,0x15,0x00,0x03,0x69,0xcf,0xf2,0x36,0x9c,
-0xff,0x70,0x0c,0xff,0xfd,0x93,0xdf,0xff,0xd9,0x73,0x29,0x20,0xdf,0x40,0xec,0x1f,
-0x41,0xaa,0xa0,0xdf,0x10,0x1d,0x21,0xe0,0xf1,0xdf,0x64,0x44,0x40,0x0c,0xf1,0x0c,
-0xf1,0xdf,0xff,0xff,0xf1,0x0d,0x08,0x00,0xf0,0x03,0x99,0xfe,0x80,0x0d,0xff,0xff,
-0xf1,0xef,0x01,0xfc,0x00,0x0e,0xfc,0xbb,0xb1,0xfe,0x01,0xfc,0xf0,0x17,0x00,0x93,
-0x01,0x00,0x9f,0x1b,0x40,0x09,0xf7,0x01,0xfc,0x8b,0x42,0x40,0x2f,0xf1,0x01,0xfc,
-0x42,0x26,0x93,0xdf,0x90,0x01,0xfc,0x00,0x4d,0x00,0x00,0x7c,0x05,0x19,0x0b,0x4a,
-0x0c,0x11,0x02,0x7e,0x06,0x03,0xbe,0x21,0x22,0x0f,0xfa,0xd8,0x39,0x10,0xfe,0x01,
-0x3c,0x33,0xff,0x00,0x0f,0xa5,0x0e,0x21,0xfe,0x66,0x60,0x4d,0xf8,0x2d,0x1f,0xcc,
-0xff,0xfe,0xaf,0xff,0xf8,0x02,0xfa,0x7a,0x8e,0xe6,0xa8,0x9f,0x90,0x3f,0x97,0xf2,
-0xce,0x2f,0x92,0xf9,0x06,0xf7,0x0d,0x9c,0xe0,0x8d,0x5f,0x90,0x9f,0x51,0x7c,0xfe,
-0x06,0xbf,0xf9,0x0d,0xf5,0xff,0xbe,0xea,0xfd,0x8f,0x93,0xfc,0x07,0x37,0xee,0x24,
-0x59,0xf8,0x2a,0x60,0x00,0xee,0x70,0x06,0xfd,0x30,0x2e,0x0e,0x92,0x47,0xa1,0x00,
-0x00,0x79,0xab,0xce,0xff,0xff,0x57,0x54,0x74,0xfb,0x85,0x20,0x00,0x00,0x22,0x10,
-0xf7,0x25,0x11,0x0c,0x65,0x1b,0x04,0xdc,0x1b,0x02,0x84,0x50,0x13,0x70,0x0f,0x26,
-0x00,0x2d,0x21,0x54,0x2c,0xf5,0x22,0x22,0x21,0x4e,0x45,0x20,0x0b,0xbb,0x07,0x5e,
-0x27,0xbb,0xb6,0x37,0x26,0x03,0x96,0x2a,0x13,0xcd,0x9d,0x0f,0x1a,0x9f,0x37,0x26,
-0x03,0x19,0x19,0x00,0x1a,0x72,0x61,0xbb,0xbb,0xbb,0xb7,0x00,0x0f,0x84,0x72,0xa0,
-0xfa,0x0b,0xbf,0xfb,0x85,0x55,0x5f,0xf6,0x53,0x1f,0xb0,0x1b,0x22,0x0f,0xf1,0x85,
-0x59,0x13,0x0f,0x69,0x3a,0x01,0x10,0x00,0x50,0xfc,0xd0,0x00,0x0f,0xf1,0x12,0x85,
-0x01,0xff,0x1e,0x31,0x0e,0xef,0xf1,0x18,0x00,0x14,0x01,0x20,0x00,0x0b,0x08,0x00,
-0xda,0x08,0xcf,0xd0,0x00,0xbf,0xff,0xf0,0x00,0x07,0xfd,0x50,0x00,0x5f,0xff,0x49,
-0x03,0xe7,0x12,0x12,0x60,0x93,0x5e,0x0b,0x08,0x00,0xc1,0x0b,0xdf,0xd9,0x79,0xef,
-0xa9,0x97,0x00,0x1f,0xff,0xfd,0xbf,0x20,0x01,0x60,0x6f,0x70,0x11,0xdf,0x14,0xfa,
-0x20,0x00,0x30,0x12,0xee,0x03,0x3b,0x58,0x31,0xef,0xcf,0xfc,0xe8,0x5e,0xd0,0xfb,
-0x4c,0xff,0x64,0xf9,0x00,0x0f,0xdf,0x70,0x07,0xff,0xfe,0xf8,0x20,0x00,0x31,0x0e,
-0xf4,0xc9,0x08,0x00,0xf0,0x02,0x5f,0xa0,0x02,0xf9,0x52,0x00,0x6f,0x62,0xff,0x30,
-0x00,0xfa,0xbd,0x0b,0xef,0x7f,0xf8,0x6a,0x2a,0x43,0x09,0xfa,0x07,0x90,0x10,0x7d,
-0x0b,0x5e,0x39,0x42,0x50,0x00,0x02,0xc8,0x08,0x00,0x21,0x00,0xff,0x08,0x00,0x90,
-0x38,0x88,0xdf,0xa8,0x82,0x2b,0xdf,0xdb,0x6f,0x00,0x03,0x50,0x3f,0xff,0xff,0x6f,
-0xb5,0x7b,0x6d,0x42,0x7f,0x60,0x6f,0x80,0x30,0x00,0x02,0x08,0x00,0x41,0x8f,0xdc,
-0x7f,0x70,0x15,0x39,0x11,0xfd,0x05,0x75,0x52,0x3f,0xef,0x60,0x9f,0x50,0x20,0x00,
-0x22,0xbf,0x30,0x08,0x00,0x12,0xff,0x60,0x00,0x31,0x55,0xfb,0x00,0xe5,0x23,0x21,
-0x5e,0xf5,0xf5,0x07,0x2a,0xea,0x1a,0x24,0x05,0x04,0x90,0x01,0x12,0xfe,0xc3,0x4f,
-0x02,0x8f,0x01,0x91,0xe1,0xbb,0xff,0xb8,0x88,0x88,0x88,0xfe,0x1f,0x57,0x1f,0x13,
-0x0e,0xd2,0x1e,0x12,0xee,0x2d,0x00,0x00,0x0f,0x00,0x10,0x88,0x9d,0x5f,0x81,0x19,
-0xdf,0xff,0xd8,0xdd,0xdd,0xdf,0xe0,0x30,0x11,0x35,0x00,0xee,0x02,0x1e,0x00,0x04,
-0x2d,0x00,0x80,0x1a,0xaa,0xaa,0xaf,0xe0,0x7b,0xfd,0x01,0xb2,0x07,0x30,0x06,0xfe,
-0x50,0xc6,0x6f,0x05,0xbc,0x64,0x01,0x1a,0x7b,0x10,0x10,0x08,0x00,0x02,0x44,0x1d,
-0xa0,0x8f,0x40,0xcc,0xcc,0xff,0xf7,0x00,0x3a,0xdf,0xca,0xa8,0x3e,0x00,0xc9,0x76,
-0x40,0x03,0xdf,0xc2,0x00,0x0f,0x32,0x91,0xaf,0xff,0xcb,0xbb,0xb3,0x00,0x8f,0x40,
-0x9f,0xf9,0x06,0xf0,0x16,0x9f,0xcc,0x12,0xfc,0x2f,0xaa,0xf2,0x4e,0xff,0xfd,0x09,
-0xf3,0x8f,0x4b,0xf1,0x3f,0xef,0x50,0x6f,0xa1,0xed,0x0d,0xf0,0x00,0x8f,0x47,0xfc,
-0x09,0xf4,0x0f,0xe0,0x00,0x8f,0x41,0x90,0x5f,0xb0,0x3d,0x6e,0xf1,0x06,0x40,0x04,
-0xfd,0x10,0x5f,0x90,0x0d,0xff,0x30,0x8f,0xe2,0x6b,0xff,0x50,0x0c,0xe9,0x00,0x6b,
-0x10,0x3e,0xe8,0x68,0x01,0x31,0xde,0x07,0x50,0x08,0x00,0x31,0xef,0x3f,0xf4,0x08,
-0x00,0xf0,0x02,0xdf,0x14,0xfe,0x00,0x5b,0xdf,0xdb,0x00,0xcf,0x20,0x86,0x40,0x7f,
-0xff,0xff,0x7a,0xef,0x73,0x03,0xf1,0x17,0x8f,0x60,0xaf,0xff,0xec,0xa9,0x70,0x00,
-0x7f,0x50,0x23,0x9f,0x60,0x69,0x10,0x00,0x8f,0xce,0x10,0x6f,0x91,0xff,0x20,0x7e,
-0xff,0xfe,0x20,0x3f,0xca,0xf9,0x00,0x5f,0xef,0x70,0x00,0x0f,0xff,0xd1,0x40,0x00,
-0x40,0x0c,0xff,0x21,0x30,0x08,0x00,0xf6,0x0d,0x9f,0xfc,0x04,0xf4,0x00,0x7f,0x50,
-0x5d,0xfe,0xef,0xaa,0xf2,0x2b,0xef,0x42,0xef,0xc2,0x4f,0xff,0xe0,0x0e,0xfa,0x00,
-0x25,0x00,0x04,0xbf,0x50,0x78,0x02,0x42,0x80,0x00,0x03,0xb6,0xd5,0x15,0x20,0x3f,
-0xe0,0x0f,0x00,0xb0,0x01,0x11,0xce,0x41,0x13,0xbd,0xfe,0xb2,0xff,0xff,0xff,0x24,
-0x0f,0x90,0x3f,0xea,0xaa,0xaf,0xe0,0x05,0xf9,0x01,0xfc,0x43,0x01,0xf0,0x02,0x5f,
-0x80,0x1f,0xc0,0x00,0x0e,0xe0,0x05,0xfc,0xb3,0xff,0xcc,0xcc,0xfe,0x4b,0xff,0xff,
-0x14,0x02,0x30,0xe5,0xff,0xfa,0x91,0x02,0x51,0xdd,0x02,0x5f,0x80,0x6f,0x21,0x0e,
-0x12,0xf8,0x17,0x1f,0x21,0x5f,0x82,0xc1,0x23,0x41,0xbe,0xf7,0xbf,0xa0,0x4e,0x2d,
-0x29,0x12,0xd1,0xf0,0x02,0x14,0x90,0x08,0x00,0x10,0x6f,0x42,0x1b,0x00,0x08,0x00,
-0xf0,0x0c,0xdb,0xbb,0xcf,0xb0,0x4b,0xdf,0xeb,0x8f,0x70,0x00,0x4f,0xa0,0x5f,0xff,
-0xff,0x8f,0x72,0xcb,0xef,0x70,0x01,0x7f,0xa1,0x7f,0x70,0xab,0xb8,0x28,0x00,0x90,
-0x7f,0xda,0xaa,0xaa,0x80,0x00,0x6f,0xee,0x8f,0x83,0x04,0xf0,0x01,0x6e,0xff,0xff,
-0x9f,0xbf,0xc0,0x3f,0xb0,0x5f,0xef,0xa0,0x6f,0x7c,0xf5,0xaf,0x60,0x40,0x00,0x31,
-0x73,0xfe,0xfe,0x50,0x00,0x41,0x70,0x9f,0xf7,0x00,0x10,0x00,0xf8,0x03,0xdf,0xfe,
-0x50,0x4c,0xef,0x80,0x6f,0xdf,0xfa,0xbf,0xf6,0x1f,0xfb,0x10,0x6f,0x9d,0x50,0x06,
-0x64,0x7f,0x02,0x2b,0x30,0x21,0x6f,0x60,0x5d,0x15,0x00,0x08,0x00,0x21,0x07,0xf9,
-0x08,0x00,0x81,0x01,0x14,0xe8,0x11,0x10,0x2b,0xdf,0xda,0xe0,0x01,0x41,0x3f,0xff,
-0xfe,0x7b,0x0a,0x3f,0xc0,0x7f,0x70,0x03,0x81,0x00,0x89,0x20,0x00,0x6f,0x60,0x07,
-0xf4,0x23,0x17,0xb0,0x7f,0xb9,0x04,0xf7,0x00,0xff,0x00,0x3c,0xff,0xff,0x02,0xb9,
-0x4c,0xf1,0x00,0x2f,0xff,0x91,0x00,0xfd,0x04,0xf9,0x00,0x02,0x7f,0x60,0x00,0xdf,
-0x07,0xf5,0x50,0x00,0x31,0xbf,0x1a,0xf1,0x08,0x00,0x71,0x43,0x0d,0xe0,0x00,0x0a,
-0xef,0x55,0xe0,0x11,0x30,0x09,0xfb,0x14,0x12,0x14,0x11,0xb6,0x55,0x69,0x01,0x1e,
-0x2f,0x20,0x70,0x8f,0x58,0x08,0x00,0x08,0x00,0x92,0xed,0xdd,0xdd,0xc0,0x39,0xcf,
-0xc9,0x8f,0x60,0x36,0x3c,0x01,0x48,0x03,0x40,0x25,0x9f,0xa5,0x8f,0xa8,0x09,0x00,
-0x20,0x00,0x10,0xdb,0x7f,0x3d,0xf1,0x04,0x6f,0xb9,0x8f,0x60,0x00,0xaf,0x10,0x4a,
-0xef,0xff,0x9f,0x70,0x00,0xbf,0x10,0x4f,0xff,0xa2,0x8f,0xbf,0x3d,0x01,0x20,0x00,
-0x11,0xbb,0x50,0x00,0x13,0x60,0x58,0x00,0x10,0x70,0x20,0x0f,0x30,0xdf,0x60,0x8f,
-0x40,0x0a,0x48,0x0d,0xfb,0x10,0x6c,0x87,0x34,0x20,0x00,0xed,0x05,0x00,0xa0,0x24,
-0x10,0x00,0xed,0x00,0xfe,0x01,0x00,0xaf,0x30,0x08,0x00,0xf0,0x05,0xbd,0x00,0xbf,
-0x20,0x6b,0xff,0xb1,0xfe,0x8f,0x50,0xcf,0x10,0x9f,0xff,0xf1,0xfe,0x1f,0xc0,0xdf,
-0x00,0x18,0x00,0x31,0x0b,0xf2,0xef,0x08,0x00,0x20,0x06,0xd5,0xd9,0x56,0x40,0xc2,
-0xfe,0x00,0x04,0x6d,0x4c,0x20,0xe3,0xfe,0xe1,0x56,0x70,0x8d,0xfd,0x00,0xfe,0x2c,
-0x4c,0xfe,0x20,0x00,0x30,0xff,0xff,0x9f,0xa4,0x50,0xf0,0x09,0x01,0xff,0xe4,0xaf,
-0xbf,0xc0,0x00,0xed,0x08,0xfb,0x18,0xfe,0x0d,0xf1,0x4c,0xfc,0x02,0x90,0x4f,0xf5,
-0x08,0xf6,0x2f,0xd4,0xea,0x47,0x26,0x03,0x50,0xf5,0x07,0x60,0x50,0x03,0x02,0xe9,
-0x04,0x00,0xe8,0x54,0xf1,0x11,0xd4,0xfa,0x8f,0x60,0x00,0x8f,0x50,0x3f,0x97,0xf7,
-0x1d,0xf1,0x08,0xcf,0xb5,0x8f,0x49,0xf5,0x03,0x60,0x1f,0xff,0xfb,0xff,0xbe,0xfc,
-0xbb,0xb5,0x05,0xbf,0x93,0xef,0x90,0x08,0x31,0x8f,0x50,0x00,0x9f,0x2e,0x30,0x8f,
-0xa7,0x01,0x79,0x16,0xf0,0x07,0x2a,0xef,0xfe,0x08,0xff,0x99,0xbf,0xb0,0x2f,0xff,
-0x81,0x5f,0xff,0x60,0xdf,0x40,0x02,0x8f,0x56,0xff,0x7d,0xfb,0x75,0x8e,0x30,0x9f,
-0xf8,0x04,0xdd,0x27,0xf9,0x09,0x8f,0x56,0x60,0x6e,0xff,0xf9,0x10,0x0d,0xff,0x40,
-0x6f,0xff,0x73,0xef,0xf8,0x0a,0xea,0x00,0x1e,0x92,0x00,0x18,0xe2,0x00,0xf0,0x03,
-0x01,0x08,0x00,0x11,0x8f,0x58,0x06,0xe0,0x8f,0x40,0x5c,0xfd,0xaa,0xff,0x50,0x3b,
-0xdf,0xcb,0x00,0xcf,0x49,0xfb,0x80,0x01,0x40,0x00,0x1e,0xff,0xb0,0xa0,0x00,0xf1,
-0x12,0x05,0xbf,0xff,0xe9,0x30,0x00,0x8f,0x54,0xff,0xfa,0x27,0xef,0xfa,0x00,0xaf,
-0xfd,0x87,0x23,0xfb,0x16,0xb1,0x6f,0xff,0xfb,0x39,0x9b,0xfe,0x99,0x50,0x4e,0xdf,
-0x50,0x5f,0x08,0x0a,0x21,0x8f,0x40,0x4e,0x82,0x41,0x00,0x8f,0x41,0xaa,0xdf,0x33,
-0x21,0x8f,0x42,0xf0,0x01,0x31,0x0c,0xef,0x30,0x18,0x00,0x00,0x9d,0x6c,0x17,0x03,
-0x09,0x6f,0x00,0x00,0x02,0x22,0x05,0xd5,0x08,0x00,0x22,0x0c,0xfb,0x08,0x00,0xb0,
-0x5f,0xff,0x70,0x00,0x4d,0xef,0xed,0x12,0xef,0x4e,0xf3,0x80,0x00,0xf0,0x0a,0x3d,
-0xf8,0x05,0xfe,0x30,0x00,0x6f,0x72,0xdf,0xfa,0x99,0xff,0xf5,0x00,0x6f,0x71,0xdc,
-0xff,0xff,0xfb,0xd0,0x00,0x7f,0xdd,0x40,0x5d,0x2c,0xa1,0x5e,0xff,0xff,0x39,0x99,
-0x99,0x99,0x00,0x3f,0xef,0x3b,0x16,0x00,0x40,0x00,0x32,0x0f,0xd1,0x11,0x08,0x00,
-0x26,0xd0,0x00,0x08,0x00,0x41,0x0b,0xdf,0x60,0x0f,0x27,0x63,0x63,0xfb,0x10,0x0f,
-0xfa,0xaa,0xff,0xdf,0x3d,0x11,0x22,0x60,0x06,0x32,0x00,0xeb,0x00,0x08,0x00,0x11,
-0xfc,0x08,0x00,0x90,0x3b,0xbb,0xff,0xbb,0xb0,0x18,0xbf,0xb6,0x4f,0x60,0x03,0x10,
-0x2f,0x6c,0x06,0x00,0x8d,0x28,0x20,0x7f,0x72,0xd0,0x00,0x42,0xa7,0x00,0x5f,0x60,
-0xf0,0x5b,0x21,0x5f,0xb8,0x5c,0x2e,0xc0,0x3b,0xff,0xfc,0x9a,0xaa,0xaa,0xff,0xa6,
-0x2f,0xff,0x80,0xdf,0xe8,0x00,0x70,0x02,0x5f,0x60,0x06,0xb1,0x00,0xfd,0x48,0x00,
-0x22,0x08,0xf9,0x08,0x00,0xe0,0x00,0xdf,0x10,0xfd,0x00,0x0a,0xef,0x50,0x00,0x32,
-0xab,0xfc,0x00,0x09,0xe4,0x00,0x28,0xbf,0xe5,0x00,0x01,0x42,0x0f,0xe0,0x00,0x01,
-0x08,0x00,0x30,0x38,0xed,0x10,0x08,0x00,0xc0,0xfe,0xff,0xfa,0x30,0x4b,0xdf,0xdb,
-0x2f,0xfc,0x84,0x01,0x30,0xe9,0x17,0x10,0xe0,0x22,0x2c,0xb1,0x6f,0x80,0x0f,0xfc,
-0xaa,0xbe,0xf5,0x00,0x6f,0x70,0x06,0x3c,0x23,0xb0,0x6f,0xcb,0x20,0x01,0x11,0x10,
-0x00,0x4b,0xff,0xff,0x5f,0x38,0x04,0xf0,0x04,0x5f,0xff,0xa1,0x1f,0xe9,0x99,0xaf,
-0xc0,0x12,0x6f,0x70,0x1f,0xd6,0x66,0x7f,0xc0,0x00,0x6f,0x70,0x0b,0x08,0x01,0x08,
-0x00,0x10,0xc0,0x35,0x51,0x31,0xdf,0x60,0x1f,0x36,0x20,0x6e,0xfc,0x10,0x1f,0xe8,
-0x88,0x9f,0x90,0x0b,0x00,0x00,0x04,0x13,0xf3,0x00,0x04,0x11,0xf7,0x08,0x00,0x10,
-0xcf,0xb9,0x0f,0x40,0x3b,0xdf,0xda,0xcf,0xf3,0x17,0xf1,0x0c,0x5f,0xff,0xfe,0xce,
-0x1a,0x70,0x0c,0xf1,0x00,0x7f,0x70,0x8a,0x5f,0x90,0x08,0xa1,0x00,0x6f,0x63,0x99,
-0xdf,0xc9,0x99,0x92,0x00,0x6f,0x89,0x10,0x0a,0xf1,0x08,0x15,0xbf,0xff,0x28,0xf8,
-0x15,0xfc,0x10,0x6f,0xff,0xc5,0x1e,0xf2,0x08,0xf7,0x00,0x28,0x9f,0x60,0x3f,0xfc,
-0x5f,0xf1,0x48,0x04,0x31,0x9f,0xff,0x80,0x58,0x00,0xf8,0x05,0x7e,0xff,0xf9,0x00,
-0x1a,0xdf,0x51,0xcf,0xfe,0x65,0xef,0xe1,0x0d,0xfb,0x00,0xbc,0x61,0x00,0x1b,0x70,
-0x70,0x07,0x03,0x08,0x00,0x10,0x9f,0x31,0x10,0x00,0x08,0x00,0xf0,0x02,0xcb,0xbb,
-0xbb,0xb1,0x0b,0xdf,0xd8,0x9f,0x47,0x77,0x77,0x50,0x1f,0xff,0xfb,0x9f,0x5f,0xd0,
-0x00,0x70,0x8f,0x60,0x9f,0x42,0x22,0x22,0x10,0x20,0x00,0x71,0xca,0xaa,0xaa,0xa2,
-0x00,0x7f,0x96,0x33,0x5c,0xf0,0x08,0x29,0xef,0xfe,0xaf,0x4f,0xaa,0xb1,0x60,0x3f,
-0xff,0x91,0xaf,0x3f,0xa5,0xfd,0xf2,0x02,0x7f,0x50,0xbf,0x2f,0xa0,0xfe,0x00,0x06,
-0xf5,0x0d,0xdf,0x1f,0xa0,0xbf,0x10,0x00,0x7f,0x51,0xfd,0x2f,0xdb,0x8f,0xb0,0x08,
-0xef,0x47,0xf9,0x7f,0xfe,0x49,0xf5,0x07,0xfb,0x04,0xe2,0x5d,0x50,0x00,0x80,0x00,
-0x00,0x3e,0x1d,0x12,0xda,0x08,0x00,0x01,0xbe,0x13,0x00,0xe9,0x5c,0x00,0x19,0x0f,
-0xf2,0x05,0x26,0xdf,0x73,0xdf,0xc8,0x8e,0xf6,0x00,0x6f,0xff,0xfd,0xff,0x87,0x9f,
-0xe7,0x10,0x13,0xdf,0x42,0xdf,0x37,0x66,0x40,0x10,0xaf,0x19,0xf3,0x37,0x66,0x11,
-0x84,0x08,0x00,0xf3,0x05,0x3a,0xff,0xf8,0xaf,0x1a,0xf2,0xaf,0x30,0x6f,0xff,0x7a,
-0xef,0xbe,0xfb,0xef,0xb1,0x14,0xcf,0x1c,0xff,0xeb,0x58,0x40,0x00,0xbf,0xfc,0x10,
-0x50,0x00,0xf6,0x06,0x2c,0xf7,0x4f,0xd4,0x00,0x2d,0xff,0x2a,0xff,0x70,0x04,0xff,
-0xd2,0x0d,0xe7,0x1c,0xc3,0x00,0x00,0x19,0xa0,0x00,0x01,0x14,0x40,0x08,0x00,0x12,
-0xaf,0x00,0x01,0xf1,0x02,0x40,0xaf,0xa9,0x99,0x9e,0xf1,0x19,0xcf,0xb8,0xaf,0x20,
-0x00,0x0b,0xf1,0x2f,0xff,0xfd,0x18,0x00,0xd0,0x03,0x9f,0x62,0xaf,0xba,0xdf,0xca,
-0xa0,0x00,0x7f,0x40,0xbf,0x20,0x34,0x00,0x30,0x7f,0xa8,0xcf,0x38,0x0e,0x10,0x3c,
-0xb5,0x3c,0x70,0xcf,0xba,0xa3,0x2f,0xff,0x70,0xee,0x4c,0x00,0xc1,0x05,0x8f,0x40,
-0xfc,0x99,0xcf,0xb9,0x91,0x00,0x7f,0x44,0xfa,0x10,0x14,0xf4,0x04,0x7f,0x48,0xf5,
+0x22,0x8f,0x83,0x69,0x06,0xc4,0x7f,0x85,0xef,0x70,0x19,0x99,0x99,0x99,0xcf,0xc9,
+0xaf,0xa1,0xd0,0x07,0xf0,0x19,0x06,0x66,0x66,0x66,0x9f,0xc6,0x66,0x60,0x02,0x88,
+0x88,0x85,0x3f,0xc0,0x49,0x30,0x05,0xff,0xff,0xf9,0x1f,0xe0,0xbf,0x50,0x05,0xf6,
+0x04,0xf9,0x0f,0xf3,0xfe,0x00,0x05,0xf6,0x03,0xf9,0x0d,0xfb,0xf8,0x00,0x18,0x00,
+0xf1,0x13,0x09,0xff,0xf1,0x00,0x03,0xaa,0xaa,0xa6,0x06,0xff,0x71,0x20,0x00,0x02,
+0x58,0xad,0x0a,0xff,0x13,0xf4,0x1d,0xff,0xff,0xfd,0xcf,0xff,0x97,0xf5,0x0e,0xd9,
+0x63,0x2e,0xfc,0x3e,0x91,0x05,0x5e,0x08,0xa0,0x04,0xde,0x70,0x86,0x00,0xf0,0x07,
+0xee,0x00,0x0c,0xf1,0x72,0x00,0x06,0xbb,0xff,0xbb,0x4c,0xf5,0xfe,0x10,0x08,0xff,
+0xff,0xff,0x6c,0xf1,0x7f,0xb0,0x18,0x00,0x43,0x0b,0xf1,0x09,0x20,0xf0,0x06,0xf0,
+0x1f,0xf4,0x2a,0xbd,0xab,0xba,0xad,0xfb,0xaa,0xa2,0x00,0xaf,0x3e,0xb0,0x09,0xf4,
+0x29,0x30,0x04,0xff,0xef,0xff,0xb7,0xf5,0x8f,0x60,0x3f,0xfc,0x6d,0xd6,0x45,0xf8,
+0xef,0x10,0x2d,0xff,0xef,0xfe,0x72,0xff,0xfa,0x00,0x00,0xfb,0x3d,0xc3,0x10,0x8f,
+0x08,0x00,0xcd,0x03,0xb1,0xdf,0x80,0xa1,0x00,0xfa,0x3d,0xc3,0x18,0xff,0x92,0xf5,
+0x60,0x01,0xa7,0xee,0xfe,0xf2,0x00,0xfc,0x77,0x77,0xad,0x13,0xdf,0x00,0x05,0xf0,
+0x0a,0x01,0x20,0x00,0x00,0x15,0x00,0x03,0x69,0xcf,0xf2,0x36,0x9c,0xff,0x70,0x0c,
+0xff,0xfd,0x93,0xdf,0xff,0xd9,0x40,0x0c,0xf3,0x00,0xa3,0x0e,0xf0,0x0b,0x00,0x0c,
+0xfa,0xaa,0xa0,0xdf,0x10,0x00,0x00,0x0c,0xff,0xff,0xf1,0xdf,0x64,0x44,0x40,0x0c,
+0xf1,0x0c,0xf1,0xdf,0xff,0xff,0xf1,0x0d,0x08,0x00,0xf1,0x06,0x99,0xfe,0x80,0x0d,
+0xff,0xff,0xf1,0xef,0x01,0xfc,0x00,0x0e,0xfc,0xbb,0xb1,0xfe,0x01,0xfc,0x00,0x0f,
+0xe0,0x93,0x01,0xfd,0x13,0x00,0x1f,0xc0,0x00,0x09,0xf7,0x01,0xfc,0x00,0x5f,0xa0,
+0x00,0x2f,0xf1,0x01,0xfc,0x00,0xbf,0x40,0x00,0xdf,0x90,0x01,0xfc,0x00,0x4d,0x00,
+0x00,0x7c,0x00,0x01,0xfc,0x00,0x00,0x4a,0x0c,0x11,0x02,0x7e,0x06,0x02,0xef,0x00,
+0xf3,0x02,0x00,0x0f,0xfa,0xaa,0xaa,0xaa,0xaf,0xf0,0x00,0xfe,0x22,0x22,0x22,0x22,
+0xff,0x00,0x0f,0xa5,0x0e,0x20,0xfe,0x66,0x01,0x00,0xf0,0x35,0x00,0x1f,0xcc,0xff,
+0xfe,0xaf,0xff,0xf8,0x02,0xfa,0x7a,0x8e,0xe6,0xa8,0x9f,0x90,0x3f,0x97,0xf2,0xce,
+0x2f,0x92,0xf9,0x06,0xf7,0x0d,0x9c,0xe0,0x8d,0x5f,0x90,0x9f,0x51,0x7c,0xfe,0x06,
+0xbf,0xf9,0x0d,0xf5,0xff,0xbe,0xea,0xfd,0x8f,0x93,0xfc,0x07,0x37,0xee,0x24,0x59,
+0xf8,0x2a,0x60,0x00,0xee,0x70,0x06,0xfd,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0xf1,0x0f,0x00,0x00,0x00,0x00,0x02,0x47,0xa1,0x00,0x00,0x79,0xab,0xce,0xff,0xff,
+0xfb,0x00,0x00,0xdf,0xff,0xff,0xfb,0x85,0x20,0x00,0x00,0x22,0x10,0x0b,0xf3,0x00,
+0x01,0x00,0x20,0x0c,0xf4,0x06,0x00,0x11,0xff,0x01,0x00,0xc1,0x90,0x00,0xcc,0xcc,
+0xcf,0xfd,0xcc,0xcc,0x70,0x00,0x00,0x00,0x20,0x00,0x92,0x02,0x22,0x22,0x2c,0xf5,
+0x22,0x22,0x21,0x1f,0x20,0x00,0x94,0xf8,0x0b,0xbb,0xbb,0xbe,0xfc,0xbb,0xbb,0xb6,
+0x20,0x00,0x00,0x40,0x00,0x02,0x08,0x00,0x31,0xcd,0xdf,0xf1,0x08,0x00,0x47,0x9f,
+0xfd,0x70,0x00,0x01,0x00,0x24,0x0f,0xe0,0x08,0x00,0xf1,0x12,0x0b,0xbb,0xbb,0xbb,
+0xb7,0x00,0x0f,0xe0,0x0f,0xff,0xff,0xff,0xfa,0x0b,0xbf,0xfb,0x85,0x55,0x5f,0xf6,
+0x53,0x1f,0xff,0xff,0xb0,0x00,0x0f,0xf1,0x00,0x00,0x1f,0xe0,0x00,0x08,0x00,0x13,
+0x0f,0x08,0x00,0x30,0x1f,0xfc,0xd0,0x08,0x00,0x40,0x1d,0xff,0xff,0xc0,0x08,0x00,
+0x31,0x0e,0xef,0xf1,0x18,0x00,0x14,0x01,0x20,0x00,0x0b,0x08,0x00,0xfd,0x01,0x08,
+0xcf,0xd0,0x00,0xbf,0xff,0xf0,0x00,0x07,0xfd,0x50,0x00,0x5f,0xfd,0x50,0x00,0x01,
+0x00,0x5e,0x5f,0x60,0x00,0xbf,0x10,0x08,0x00,0xc1,0x0b,0xdf,0xd9,0x79,0xef,0xa9,
+0x97,0x00,0x1f,0xff,0xfd,0xbf,0x20,0x01,0x60,0x6f,0x70,0x11,0xdf,0x14,0xfa,0x20,
+0x00,0xf0,0x0d,0x12,0xee,0x03,0xf9,0x00,0x00,0x7f,0xef,0xcf,0xfc,0x03,0xf9,0x00,
+0x2e,0xff,0xfb,0x4c,0xff,0x64,0xf9,0x00,0x0f,0xdf,0x70,0x07,0xff,0xfe,0xf8,0x20,
+0x00,0x31,0x0e,0xf4,0xc9,0x08,0x00,0xfd,0x0e,0x5f,0xa0,0x02,0xf9,0x52,0x00,0x6f,
+0x62,0xff,0x30,0x00,0xfa,0xbd,0x0b,0xef,0x7f,0xf8,0x00,0x00,0xcf,0xfa,0x09,0xfa,
+0x07,0x90,0x00,0x00,0x3e,0xe3,0x88,0x00,0x52,0x7f,0x50,0x00,0x02,0xc8,0x08,0x00,
+0x21,0x00,0xff,0x08,0x00,0xf2,0x0b,0x38,0x88,0xdf,0xa8,0x82,0x2b,0xdf,0xdb,0x6f,
+0xff,0xff,0xff,0xf4,0x3f,0xff,0xff,0x6f,0xb5,0x55,0x55,0x51,0x00,0x7f,0x60,0x6f,
+0x80,0x30,0x00,0x02,0x08,0x00,0x30,0x8f,0xdc,0x7f,0x58,0x01,0x40,0x4e,0xff,0xfd,
+0x8f,0x08,0x00,0x52,0x3f,0xef,0x60,0x9f,0x50,0x20,0x00,0x22,0xbf,0x30,0x08,0x00,
+0x12,0xff,0x60,0x00,0x21,0x55,0xfb,0x95,0x01,0x30,0xff,0x5e,0xf5,0x08,0x00,0x5f,
+0x0a,0xea,0x1a,0xc0,0x00,0x90,0x01,0x01,0x63,0xfe,0x00,0x66,0x66,0x66,0x66,0x8f,
+0x01,0x81,0xe1,0xbb,0xff,0xb8,0x88,0x88,0x88,0xfe,0x8e,0x01,0x50,0x00,0x0e,0xe0,
+0x00,0xfe,0x23,0x00,0x12,0xee,0x2d,0x00,0x00,0x0f,0x00,0xf0,0x01,0x88,0xaf,0xff,
+0xff,0xfe,0x19,0xdf,0xff,0xd8,0xdd,0xdd,0xdf,0xe0,0xff,0xfe,0x40,0x1e,0x00,0x15,
+0x02,0x1e,0x00,0x04,0x2d,0x00,0xf4,0x05,0x1a,0xaa,0xaa,0xaf,0xe0,0x7b,0xfd,0x01,
+0xff,0xff,0xff,0xfe,0x06,0xfe,0x50,0x02,0x22,0x22,0x2d,0xd0,0x78,0x00,0x10,0x8f,
+0x34,0x00,0x10,0x10,0x08,0x00,0x00,0xff,0x01,0x00,0x08,0x00,0xf1,0x55,0xcc,0xcc,
+0xff,0xf7,0x00,0x3a,0xdf,0xca,0x00,0x09,0xff,0x40,0x00,0x5f,0xff,0xfe,0x03,0xdf,
+0xc2,0x00,0x00,0x01,0x9f,0x51,0xaf,0xff,0xcb,0xbb,0xb3,0x00,0x8f,0x40,0x9f,0xff,
+0xff,0xff,0xf3,0x00,0x9f,0xcc,0x12,0xfc,0x2f,0xaa,0xf2,0x4e,0xff,0xfd,0x09,0xf3,
+0x8f,0x4b,0xf1,0x3f,0xef,0x50,0x6f,0xa1,0xed,0x0d,0xf0,0x00,0x8f,0x47,0xfc,0x09,
+0xf4,0x0f,0xe0,0x00,0x8f,0x41,0x90,0x5f,0xb0,0x1f,0xc0,0x00,0x8f,0x40,0x04,0xfd,
+0x10,0x5f,0x90,0x0d,0xff,0x30,0x8f,0xe2,0x6b,0xff,0x50,0x0c,0xe9,0x00,0x6b,0x10,
+0x3e,0xe8,0x68,0x01,0x31,0xde,0x07,0x50,0x08,0x00,0x31,0xef,0x3f,0xf4,0x08,0x00,
+0xf1,0x2c,0xdf,0x14,0xfe,0x00,0x5b,0xdf,0xdb,0x00,0xcf,0x20,0x86,0x40,0x7f,0xff,
+0xff,0x7a,0xef,0xff,0xff,0xf0,0x00,0x8f,0x60,0xaf,0xff,0xec,0xa9,0x70,0x00,0x7f,
+0x50,0x23,0x9f,0x60,0x69,0x10,0x00,0x8f,0xce,0x10,0x6f,0x91,0xff,0x20,0x7e,0xff,
+0xfe,0x20,0x3f,0xca,0xf9,0x00,0x5f,0xef,0x70,0x00,0x0f,0xff,0xd1,0x40,0x00,0x40,
+0x0c,0xff,0x21,0x30,0x08,0x00,0xf6,0x0d,0x9f,0xfc,0x04,0xf4,0x00,0x7f,0x50,0x5d,
+0xfe,0xef,0xaa,0xf2,0x2b,0xef,0x42,0xef,0xc2,0x4f,0xff,0xe0,0x0e,0xfa,0x00,0x25,
+0x00,0x04,0xbf,0x50,0x78,0x02,0xc0,0x80,0x00,0x03,0xb6,0x00,0x00,0x05,0xf8,0x00,
+0x00,0x3f,0xe0,0x0f,0x00,0x80,0x01,0x11,0xce,0x41,0x13,0xbd,0xfe,0xb2,0x25,0x01,
+0xc0,0x4f,0xff,0xff,0x3f,0xea,0xaa,0xaf,0xe0,0x05,0xf9,0x01,0xfc,0x43,0x01,0xf0,
+0x02,0x5f,0x80,0x1f,0xc0,0x00,0x0e,0xe0,0x05,0xfc,0xb3,0xff,0xcc,0xcc,0xfe,0x4b,
+0xff,0xff,0x14,0x02,0x30,0xe5,0xff,0xfa,0x91,0x02,0x70,0xdd,0x02,0x5f,0x80,0x6f,
+0x70,0x00,0x4b,0x00,0x21,0x0b,0xf4,0x5a,0x00,0x20,0x82,0xff,0xc9,0x02,0xb9,0xbe,
+0xf7,0xbf,0xa0,0x00,0x00,0x00,0x08,0xfb,0x12,0xd1,0xf0,0x02,0x14,0x90,0x08,0x00,
+0x00,0x44,0x00,0x10,0xc0,0x08,0x00,0xf0,0x0c,0xdb,0xbb,0xcf,0xb0,0x4b,0xdf,0xeb,
+0x8f,0x70,0x00,0x4f,0xa0,0x5f,0xff,0xff,0x8f,0x72,0xcb,0xef,0x70,0x01,0x7f,0xa1,
+0x7f,0x70,0xab,0xb8,0x28,0x00,0xf0,0x0e,0x7f,0xda,0xaa,0xaa,0x80,0x00,0x6f,0xee,
+0x8f,0xff,0xff,0xff,0xf0,0x6e,0xff,0xff,0x9f,0xbf,0xc0,0x3f,0xb0,0x5f,0xef,0xa0,
+0x6f,0x7c,0xf5,0xaf,0x60,0x40,0x00,0x31,0x73,0xfe,0xfe,0x50,0x00,0x41,0x70,0x9f,
+0xf7,0x00,0x10,0x00,0xf9,0x04,0xdf,0xfe,0x50,0x4c,0xef,0x80,0x6f,0xdf,0xfa,0xbf,
+0xf6,0x1f,0xfb,0x10,0x6f,0x9d,0x50,0x06,0xb0,0x6c,0x02,0x00,0x9f,0x00,0x52,0x6f,
+0x60,0x00,0x09,0xf4,0x08,0x00,0x21,0x07,0xf9,0x08,0x00,0x81,0x01,0x14,0xe8,0x11,
+0x10,0x2b,0xdf,0xda,0xe0,0x01,0xf1,0x28,0x3f,0xff,0xfe,0x7b,0xbb,0xbb,0xbb,0xb2,
+0x00,0x7f,0x70,0x03,0x81,0x00,0x89,0x20,0x00,0x6f,0x60,0x07,0xf4,0x00,0xdf,0x20,
+0x00,0x7f,0xb9,0x04,0xf7,0x00,0xff,0x00,0x3c,0xff,0xff,0x02,0xfa,0x01,0xfc,0x00,
+0x2f,0xff,0x91,0x00,0xfd,0x04,0xf9,0x00,0x02,0x7f,0x60,0x00,0xdf,0x07,0xf5,0x50,
+0x00,0x31,0xbf,0x1a,0xf1,0x08,0x00,0x70,0x43,0x0d,0xe0,0x00,0x0a,0xef,0x55,0xa0,
+0x04,0x60,0xf9,0x09,0xfb,0x14,0xbb,0xbb,0xa0,0x04,0x13,0x6f,0x86,0x04,0x20,0x6f,
+0x70,0xd0,0x00,0x10,0xe0,0x08,0x00,0x90,0xed,0xdd,0xdd,0xc0,0x39,0xcf,0xc9,0x8f,
+0x60,0x17,0x01,0x21,0xff,0xff,0x48,0x03,0x30,0x25,0x9f,0xa5,0x20,0x00,0x10,0x10,
+0x20,0x00,0xf1,0x08,0xdb,0xbb,0xef,0x10,0x00,0x6f,0xb9,0x8f,0x60,0x00,0xaf,0x10,
+0x4a,0xef,0xff,0x9f,0x70,0x00,0xbf,0x10,0x4f,0xff,0xa2,0x20,0x00,0x11,0x03,0x20,
+0x00,0x11,0xbb,0x50,0x00,0x13,0x60,0x58,0x00,0x00,0x40,0x00,0x30,0x1b,0xdf,0x60,
+0x20,0x00,0x95,0xf6,0x0d,0xfb,0x10,0x6c,0xcc,0xcc,0xcc,0xc5,0xfc,0x00,0x10,0xed,
+0x05,0x00,0xa0,0x24,0x10,0x00,0xed,0x00,0xfe,0x01,0x00,0xaf,0x30,0x08,0x00,0xf0,
+0x05,0xbd,0x00,0xbf,0x20,0x6b,0xff,0xb1,0xfe,0x8f,0x50,0xcf,0x10,0x9f,0xff,0xf1,
+0xfe,0x1f,0xc0,0xdf,0x00,0x18,0x00,0x31,0x0b,0xf2,0xef,0x08,0x00,0xf0,0x0c,0x06,
+0xd5,0xfc,0x00,0x00,0xef,0xc2,0xfe,0x00,0x04,0xfa,0x00,0x9f,0xff,0xe3,0xfe,0x00,
+0x07,0xf8,0x00,0x8d,0xfd,0x00,0xfe,0x2c,0x4c,0xfe,0x20,0x00,0xf6,0x15,0xff,0xff,
+0x9f,0xff,0x50,0x00,0xed,0x01,0xff,0xe4,0xaf,0xbf,0xc0,0x00,0xed,0x08,0xfb,0x18,
+0xfe,0x0d,0xf1,0x4c,0xfc,0x02,0x90,0x4f,0xf5,0x08,0xf6,0x2f,0xd4,0x00,0x00,0x08,
+0x70,0x03,0x78,0x02,0x60,0x8f,0x50,0x03,0x02,0xe9,0x04,0x08,0x00,0xf0,0x1c,0x0f,
+0xd4,0xfa,0x8f,0x60,0x00,0x8f,0x50,0x3f,0x97,0xf7,0x1d,0xf1,0x08,0xcf,0xb5,0x8f,
+0x49,0xf5,0x03,0x60,0x1f,0xff,0xfb,0xff,0xbe,0xfc,0xbb,0xb5,0x05,0xbf,0x93,0xef,
+0xff,0xff,0xff,0xf7,0x00,0x8f,0x50,0x00,0x8f,0x90,0x38,0x00,0x10,0xa7,0xbf,0x03,
+0xf9,0x2b,0xd0,0x2a,0xef,0xfe,0x08,0xff,0x99,0xbf,0xb0,0x2f,0xff,0x81,0x5f,0xff,
+0x60,0xdf,0x40,0x02,0x8f,0x56,0xff,0x7d,0xfb,0xf9,0x00,0x00,0x8f,0x9f,0xf8,0x04,
+0xff,0xd0,0x00,0x00,0x8f,0x56,0x60,0x6e,0xff,0xf9,0x10,0x0d,0xff,0x40,0x6f,0xff,
+0x73,0xef,0xf8,0x0a,0xea,0x00,0x1e,0x92,0x00,0x18,0xe2,0x00,0xf0,0x03,0x01,0x08,
+0x00,0x11,0x8f,0x58,0x06,0xe0,0x8f,0x40,0x5c,0xfd,0xaa,0xff,0x50,0x3b,0xdf,0xcb,
+0x00,0xcf,0x49,0xfb,0x80,0x01,0x40,0x00,0x1e,0xff,0xb0,0xa0,0x00,0xf0,0x16,0x05,
+0xbf,0xff,0xe9,0x30,0x00,0x8f,0x54,0xff,0xfa,0x27,0xef,0xfa,0x00,0xaf,0xfd,0x87,
+0x23,0xfb,0x16,0xb1,0x6f,0xff,0xfb,0x39,0x9b,0xfe,0x99,0x50,0x4e,0xdf,0x50,0x5f,
+0xff,0xff,0xff,0x80,0x50,0x00,0x20,0x03,0xfb,0x50,0x00,0x91,0x41,0xaa,0xab,0xfe,
+0xaa,0xa5,0x00,0x8f,0x42,0xf0,0x01,0x31,0x0c,0xef,0x30,0x18,0x00,0x32,0x0b,0xfa,
+0x00,0x20,0x00,0x03,0x01,0x00,0x00,0x00,0x02,0x22,0x05,0xd5,0x08,0x00,0x22,0x0c,
+0xfb,0x08,0x00,0xb0,0x5f,0xff,0x70,0x00,0x4d,0xef,0xed,0x12,0xef,0x4e,0xf3,0x80,
+0x00,0xf0,0x19,0x3d,0xf8,0x05,0xfe,0x30,0x00,0x6f,0x72,0xdf,0xfa,0x99,0xff,0xf5,
+0x00,0x6f,0x71,0xdc,0xff,0xff,0xfb,0xd0,0x00,0x7f,0xdd,0x40,0x11,0x11,0x10,0x00,
+0x5e,0xff,0xff,0x39,0x99,0x99,0x99,0x00,0x3f,0xef,0x90,0x21,0x05,0x00,0x40,0x00,
+0x32,0x0f,0xd1,0x11,0x08,0x00,0x26,0xd0,0x00,0x08,0x00,0x31,0x0b,0xdf,0x60,0x20,
+0x00,0x71,0x0c,0xfb,0x10,0x0f,0xfa,0xaa,0xff,0x6f,0x07,0x31,0x20,0x00,0x22,0x60,
+0x06,0x32,0x00,0xeb,0x00,0x08,0x00,0x11,0xfc,0x08,0x00,0x90,0x3b,0xbb,0xff,0xbb,
+0xb0,0x18,0xbf,0xb6,0x4f,0x60,0x03,0x31,0x2f,0xff,0xfb,0x18,0x00,0x30,0x02,0x7f,
+0x72,0xd0,0x00,0x60,0xa7,0x00,0x5f,0x60,0xff,0xff,0x81,0x06,0xf0,0x04,0x5f,0xb8,
+0x00,0x00,0x00,0xfd,0x00,0x3b,0xff,0xfc,0x9a,0xaa,0xaa,0xff,0xa6,0x2f,0xff,0x80,
+0xdf,0xe8,0x00,0x70,0x02,0x5f,0x60,0x06,0xb1,0x00,0xfd,0x48,0x00,0x22,0x08,0xf9,
+0x08,0x00,0xe0,0x00,0xdf,0x10,0xfd,0x00,0x0a,0xef,0x50,0x00,0x32,0xab,0xfc,0x00,
+0x09,0xe4,0x00,0x28,0xbf,0xe5,0x00,0x01,0x42,0x0f,0xe0,0x00,0x01,0x08,0x00,0x30,
+0x38,0xed,0x10,0x08,0x00,0xf0,0x12,0xfe,0xff,0xfa,0x30,0x4b,0xdf,0xdb,0x2f,0xfc,
+0x84,0x01,0x30,0x5f,0xff,0xff,0x2f,0xe0,0x00,0x04,0xf7,0x00,0x6f,0x80,0x0f,0xfc,
+0xaa,0xbe,0xf5,0x00,0x6f,0x70,0x06,0xff,0xfe,0x05,0xb0,0x6f,0xcb,0x20,0x01,0x11,
+0x10,0x00,0x4b,0xff,0xff,0x5f,0x38,0x04,0xf0,0x04,0x5f,0xff,0xa1,0x1f,0xe9,0x99,
+0xaf,0xc0,0x12,0x6f,0x70,0x1f,0xd6,0x66,0x7f,0xc0,0x00,0x6f,0x70,0x0b,0x08,0x01,
+0x08,0x00,0x71,0xc0,0x00,0x1f,0xc0,0x0b,0xdf,0x60,0x10,0x00,0x8d,0x0c,0xfc,0x10,
+0x1f,0xe8,0x88,0x9f,0xc0,0xf0,0x06,0x00,0x00,0x04,0x13,0xf3,0x00,0x04,0x11,0xf7,
+0x08,0x00,0xf0,0x1a,0xcf,0xff,0xff,0xff,0xf1,0x3b,0xdf,0xda,0xcf,0xcc,0xcc,0xcf,
+0xf1,0x5f,0xff,0xfe,0xce,0x1a,0x70,0x0c,0xf1,0x00,0x7f,0x70,0x8a,0x5f,0x90,0x08,
+0xa1,0x00,0x6f,0x63,0x99,0xdf,0xc9,0x99,0x92,0x00,0x6f,0x89,0xff,0x10,0x07,0xf1,
+0x08,0x15,0xbf,0xff,0x28,0xf8,0x15,0xfc,0x10,0x6f,0xff,0xc5,0x1e,0xf2,0x08,0xf7,
+0x00,0x28,0x9f,0x60,0x3f,0xfc,0x5f,0xf1,0x48,0x04,0x31,0x9f,0xff,0x80,0x58,0x00,
+0xf8,0x05,0x7e,0xff,0xf9,0x00,0x1a,0xdf,0x51,0xcf,0xfe,0x65,0xef,0xe1,0x0d,0xfb,
+0x00,0xbc,0x61,0x00,0x1b,0x70,0x70,0x07,0x03,0x08,0x00,0x10,0x9f,0x78,0x00,0x00,
+0x08,0x00,0xf0,0x02,0xcb,0xbb,0xbb,0xb1,0x0b,0xdf,0xd8,0x9f,0x47,0x77,0x77,0x50,
+0x1f,0xff,0xfb,0x9f,0x5f,0xd0,0x00,0x70,0x8f,0x60,0x9f,0x42,0x22,0x22,0x10,0x20,
+0x00,0x80,0xca,0xaa,0xaa,0xa2,0x00,0x7f,0x96,0x9f,0x80,0x00,0xf0,0x08,0x29,0xef,
+0xfe,0xaf,0x4f,0xaa,0xb1,0x60,0x3f,0xff,0x91,0xaf,0x3f,0xa5,0xfd,0xf2,0x02,0x7f,
+0x50,0xbf,0x2f,0xa0,0xfe,0x00,0x06,0xf6,0x0d,0xdf,0x1f,0xa0,0xbf,0x10,0x00,0x7f,
+0x51,0xfd,0x2f,0xdb,0x8f,0xb0,0x08,0xef,0x47,0xf9,0x7f,0xfe,0x49,0xf5,0x07,0xfb,
+0x04,0xe2,0x5d,0x50,0x00,0x80,0x00,0x42,0xcf,0x10,0x00,0xda,0x08,0x00,0x22,0x07,
+0xfd,0x08,0x00,0xf0,0x09,0x1e,0xff,0xff,0xf9,0x00,0x26,0xdf,0x73,0xdf,0xc8,0x8e,
+0xf6,0x00,0x6f,0xff,0xfd,0xff,0x87,0x9f,0xe7,0x10,0x13,0xdf,0x42,0xe8,0x01,0xc1,
+0x30,0x00,0xcf,0x10,0xaf,0x19,0xf3,0xaf,0x30,0x00,0xcf,0x84,0x08,0x00,0xf0,0x05,
+0x3a,0xff,0xf8,0xaf,0x1a,0xf2,0xaf,0x30,0x6f,0xff,0x7a,0xef,0xbe,0xfb,0xef,0xb1,
+0x14,0xcf,0x1c,0xff,0xc8,0x00,0x00,0x58,0x00,0x30,0xbf,0xfc,0x10,0x50,0x00,0xf6,
+0x06,0x2c,0xf7,0x4f,0xd4,0x00,0x2d,0xff,0x2a,0xff,0x70,0x04,0xff,0xd2,0x0d,0xe7,
+0x1c,0xc3,0x00,0x00,0x19,0xa0,0x00,0x01,0x14,0x40,0x08,0x00,0x12,0xaf,0x00,0x01,
+0xf1,0x02,0x40,0xaf,0xa9,0x99,0x9e,0xf1,0x19,0xcf,0xb8,0xaf,0x20,0x00,0x0b,0xf1,
+0x2f,0xff,0xfd,0x18,0x00,0xd0,0x03,0x9f,0x62,0xaf,0xba,0xdf,0xca,0xa0,0x00,0x7f,
+0x40,0xbf,0x20,0x34,0x00,0x20,0x7f,0xa8,0xa8,0x01,0xd0,0xf5,0x3c,0xff,0xfd,0xdf,
+0xaa,0xcf,0xba,0xa3,0x2f,0xff,0x70,0xee,0x4c,0x00,0xf0,0x15,0x05,0x8f,0x40,0xfc,
+0x99,0xcf,0xb9,0x91,0x00,0x7f,0x44,0xfa,0xff,0xff,0xff,0xf2,0x00,0x7f,0x48,0xf5,
 0xf9,0x00,0x08,0xf2,0x0b,0xef,0x4f,0xe0,0xfd,0x88,0x8c,0xf2,0x0a,0xe9,0x2c,0x70,
-0x32,0x1c,0x14,0x21,0x5a,0x1e,0x03,0x88,0x00,0x21,0x02,0xf9,0x08,0x00,0x81,0x77,
-0x78,0xfc,0x77,0x72,0x00,0x7f,0x40,0x78,0x0f,0xb1,0x19,0xcf,0xb7,0x24,0x46,0xfb,
-0x44,0x40,0x2f,0xff,0xfb,0x70,0x02,0xb2,0x02,0x9f,0x62,0x13,0x35,0xfb,0x3f,0xc0,
-0x00,0x7f,0x44,0x00,0x18,0xf0,0x18,0x7f,0xb9,0x66,0x68,0xfc,0x6f,0xe5,0x3c,0xff,
-0xfb,0x4b,0xbc,0xfe,0xbf,0xc0,0x2f,0xff,0x60,0x4a,0xab,0xfd,0xaa,0x80,0x02,0x7f,
-0x40,0x9f,0x42,0xfc,0x66,0x50,0x00,0x7f,0x40,0xdf,0x32,0xff,0xff,0xe0,0x30,0x00,
-0xf7,0x03,0xe7,0xfa,0x11,0x10,0x0b,0xef,0x5e,0xf4,0xdf,0xfe,0xcc,0xc8,0x0b,0xea,
-0x1a,0x60,0x05,0x8a,0x90,0x05,0x61,0x5f,0x70,0x00,0x9d,0x1a,0xd1,0x08,0x00,0x30,
-0xbf,0x1b,0xf1,0x08,0x00,0xf0,0x06,0x34,0xcf,0x1b,0xf5,0x41,0x1b,0xdf,0xda,0xcf,
-0xff,0x1b,0xff,0xf4,0x2f,0xff,0xfe,0x56,0xdf,0x1b,0xf7,0x61,0xb0,0x07,0x03,0x20,
-0x00,0xf1,0x01,0x79,0xef,0x1b,0xfa,0x91,0x00,0x5f,0xb7,0xbf,0xff,0x1b,0xff,0xf2,
-0x29,0xdf,0xfd,0x18,0x00,0x31,0x3f,0xff,0xc4,0x08,0x00,0xf4,0x01,0x17,0x8f,0x72,
-0xff,0xff,0x1b,0xff,0xf7,0x00,0x5f,0x71,0xaa,0xef,0x1b,0xfb,0xa4,0x58,0x00,0x32,
-0x09,0xdf,0x60,0x08,0x00,0x22,0xfc,0x10,0x48,0x00,0x04,0x01,0x00,0x12,0xfc,0x0a,
-0x25,0x23,0x00,0xfc,0x37,0x49,0x21,0xfc,0x01,0x98,0x16,0xf3,0x0c,0x47,0xfe,0x71,
-0x8c,0xd8,0x8b,0xe9,0x60,0x9f,0xff,0xf1,0x0b,0xf2,0x0d,0xf2,0x00,0x12,0xfd,0x25,
-0x9b,0xfa,0xaf,0xd9,0x90,0x00,0xfc,0x08,0x0b,0x0c,0xf1,0x02,0xa0,0x00,0x7f,0x60,
-0x00,0x00,0x8e,0xff,0xf8,0x88,0xef,0x98,0x88,0x82,0x9f,0xfd,0x1c,0x18,0x03,0x70,
-0x10,0xfc,0x00,0x3f,0xd1,0x0b,0xf4,0x50,0x00,0x70,0xbf,0xfa,0x8f,0xb0,0x00,0x00,
-0xfc,0x88,0x83,0xfe,0x03,0xa1,0x00,0x4c,0xfb,0x09,0xbe,0xff,0xbd,0xff,0x70,0x2f,
-0xd4,0x09,0xeb,0x71,0x00,0x6e,0x40,0x80,0x0a,0x42,0x30,0x00,0x04,0xd7,0x08,0x00,
-0x21,0x02,0xfd,0x08,0x00,0x00,0x98,0x4e,0xf0,0x26,0xea,0x1c,0xef,0xd7,0xff,0xcc,
-0xcc,0xcd,0xfb,0x1e,0xff,0xf8,0xfc,0x15,0x00,0x51,0xfb,0x00,0x7f,0x30,0x13,0xef,
-0x58,0xfa,0x10,0x00,0x7f,0x30,0x6f,0xf6,0x00,0xaf,0xc1,0x00,0x7f,0x85,0x9f,0x50,
-0x00,0x09,0xe1,0x04,0xcf,0xfb,0x3c,0x99,0x99,0x9a,0x90,0x3f,0xff,0x92,0x4f,0xb0,
-0x01,0x32,0x09,0xaf,0x30,0x81,0x1c,0x13,0x7f,0x08,0x00,0x12,0x8f,0x08,0x00,0xb1,
-0x0b,0xef,0x36,0xbb,0xbb,0xfe,0xbb,0xba,0x0b,0xe9,0x08,0x56,0x45,0x00,0x88,0x03,
-0x30,0xc7,0x29,0x30,0x88,0x03,0x40,0x06,0xfb,0x5f,0xa0,0x08,0x00,0xf1,0x02,0x0c,
+0x18,0x00,0x00,0x73,0x00,0x48,0x21,0x00,0x01,0x20,0x88,0x00,0x21,0x02,0xf9,0x08,
+0x00,0x90,0x77,0x78,0xfc,0x77,0x72,0x00,0x7f,0x40,0xff,0x38,0x05,0xb1,0x19,0xcf,
+0xb7,0x24,0x46,0xfb,0x44,0x40,0x2f,0xff,0xfb,0x70,0x02,0xb0,0x02,0x9f,0x62,0x13,
+0x35,0xfb,0x3f,0xc0,0x00,0x7f,0x44,0x20,0x00,0xf0,0x1a,0xfc,0x00,0x7f,0xb9,0x66,
+0x68,0xfc,0x6f,0xe5,0x3c,0xff,0xfb,0x4b,0xbc,0xfe,0xbf,0xc0,0x2f,0xff,0x60,0x4a,
+0xab,0xfd,0xaa,0x80,0x02,0x7f,0x40,0x9f,0x42,0xfc,0x66,0x50,0x00,0x7f,0x40,0xdf,
+0x32,0xff,0xff,0xe0,0x30,0x00,0xf7,0x03,0xe7,0xfa,0x11,0x10,0x0b,0xef,0x5e,0xf4,
+0xdf,0xfe,0xcc,0xc8,0x0b,0xea,0x1a,0x60,0x05,0x8a,0x90,0x05,0x61,0x5f,0x70,0x00,
+0x9d,0x1a,0xd1,0x08,0x00,0x30,0xbf,0x1b,0xf1,0x08,0x00,0xf0,0x06,0x34,0xcf,0x1b,
+0xf5,0x41,0x1b,0xdf,0xda,0xcf,0xff,0x1b,0xff,0xf4,0x2f,0xff,0xfe,0x56,0xdf,0x1b,
+0xf7,0x61,0xb0,0x07,0x03,0x20,0x00,0xf1,0x01,0x79,0xef,0x1b,0xfa,0x91,0x00,0x5f,
+0xb7,0xbf,0xff,0x1b,0xff,0xf2,0x29,0xdf,0xfd,0x18,0x00,0x31,0x3f,0xff,0xc4,0x08,
+0x00,0xf4,0x01,0x17,0x8f,0x72,0xff,0xff,0x1b,0xff,0xf7,0x00,0x5f,0x71,0xaa,0xef,
+0x1b,0xfb,0xa4,0x58,0x00,0x32,0x09,0xdf,0x60,0x08,0x00,0x22,0xfc,0x10,0x48,0x00,
+0x03,0x01,0x00,0x00,0xec,0x03,0x22,0x19,0x80,0x08,0x00,0x20,0x0e,0xf2,0x08,0x00,
+0x20,0x01,0xff,0x70,0x03,0xf0,0x0e,0x47,0xfe,0x71,0x8c,0xd8,0x8b,0xe9,0x60,0x9f,
+0xff,0xf1,0x0b,0xf2,0x0d,0xf2,0x00,0x12,0xfd,0x25,0x9b,0xfa,0xaf,0xd9,0x90,0x00,
+0xfc,0x08,0xff,0xff,0x98,0x08,0xf1,0x03,0xfe,0xa0,0x00,0x7f,0x60,0x00,0x00,0x8e,
+0xff,0xf8,0x88,0xef,0x98,0x88,0x82,0x9f,0xfd,0x1c,0x18,0x03,0x70,0x10,0xfc,0x00,
+0x3f,0xd1,0x0b,0xf4,0x50,0x00,0x40,0xbf,0xfa,0x8f,0xb0,0x08,0x00,0xfe,0x06,0x03,
+0xbf,0xff,0xa1,0x00,0x4c,0xfb,0x09,0xbe,0xff,0xbd,0xff,0x70,0x2f,0xd4,0x09,0xeb,
+0x71,0x00,0x6e,0x40,0x80,0x0a,0x42,0x30,0x00,0x04,0xd7,0x08,0x00,0x21,0x02,0xfd,
+0x08,0x00,0xf0,0x2a,0xee,0xee,0xff,0xfe,0xea,0x1c,0xef,0xd7,0xff,0xcc,0xcc,0xcd,
+0xfb,0x1e,0xff,0xf8,0xfc,0x15,0x00,0x51,0xfb,0x00,0x7f,0x30,0x13,0xef,0x58,0xfa,
+0x10,0x00,0x7f,0x30,0x6f,0xf6,0x00,0xaf,0xc1,0x00,0x7f,0x85,0x9f,0x50,0x00,0x09,
+0xe1,0x04,0xcf,0xfb,0x3c,0x99,0x99,0x9a,0x90,0x3f,0xff,0x92,0x4f,0xb0,0x01,0x63,
+0x09,0xaf,0x30,0x00,0x02,0xfc,0x50,0x00,0x10,0xfc,0xa0,0x05,0x02,0x08,0x00,0xa1,
+0x0b,0xef,0x36,0xbb,0xbb,0xfe,0xbb,0xba,0x0b,0xe9,0xc8,0x00,0x10,0xfe,0x88,0x03,
+0x30,0xc7,0x29,0x30,0x88,0x03,0x40,0x06,0xfb,0x5f,0xa0,0x08,0x00,0xf0,0x02,0x0c,
 0xf5,0x0e,0xf0,0x00,0x29,0xcf,0xb8,0x3f,0xfd,0xce,0xec,0xc2,0x4f,0xff,0xfe,0xbf,
-0x9f,0x34,0x40,0x9f,0x78,0xff,0xe0,0x64,0x14,0xb0,0x7f,0x7f,0xff,0xf9,0xaf,0xe9,
-0x90,0x00,0x7f,0xae,0x8e,0x08,0x01,0x60,0x3b,0xff,0xfc,0x0e,0xe0,0x1f,0x27,0x3a,
-0xa1,0x70,0x0e,0xfa,0xaf,0xea,0xa0,0x01,0x7f,0x50,0x0e,0x20,0x01,0x20,0x7f,0x50,
-0x18,0x00,0x00,0x48,0x06,0x40,0x0e,0xe1,0x2f,0xb1,0x90,0x06,0x11,0x0e,0xa8,0x0c,
-0x20,0xea,0x00,0xa9,0x31,0x15,0xa5,0xba,0x36,0x30,0x7f,0x30,0x01,0xb0,0x0d,0x07,
-0x08,0x00,0xf4,0x01,0xee,0xff,0xee,0xff,0xe9,0x2f,0xff,0xfb,0xcc,0xff,0xcc,0xff,
-0xc8,0x1c,0xef,0xd8,0x18,0x00,0x40,0x00,0x96,0x00,0x97,0x08,0x00,0x20,0x49,0x99,
-0x52,0x79,0x21,0x8f,0xb9,0x32,0x24,0xf1,0x04,0x3c,0xff,0xfc,0x6f,0x51,0xfa,0x0a,
-0xf2,0x3f,0xff,0x92,0x6f,0x61,0xfb,0x0a,0xf2,0x07,0x9f,0x30,0x18,0x00,0x00,0x20,
-0x01,0x31,0xb9,0xfd,0x8d,0x08,0x00,0x00,0x20,0x00,0x22,0x0b,0xef,0x18,0x00,0x85,
-0x0b,0xe9,0x00,0x6f,0xb9,0x99,0x9d,0xf2,0xc2,0x6d,0x23,0x7f,0x30,0xa7,0x4f,0x22,
-0xf3,0x03,0x1d,0x28,0xb1,0x7f,0x30,0x3f,0xc5,0x55,0x5f,0xd0,0x02,0xbd,0xfc,0x93,
-0x11,0x00,0xb5,0x3f,0xff,0xfd,0x3f,0xb2,0x22,0x2f,0xd0,0x00,0x08,0xf4,0x22,0x00,
-0x10,0x04,0xb3,0x18,0x41,0x00,0x08,0xfb,0xaf,0x9c,0x0d,0xe0,0x3d,0xff,0xfd,0x99,
-0x99,0xfe,0x99,0x95,0x02,0xff,0xf6,0x02,0xd8,0x1f,0x3b,0x3b,0x40,0x7f,0x30,0x6f,
-0x81,0xb5,0x05,0xe0,0x07,0xf3,0x0a,0xfc,0x1f,0xd8,0x86,0x00,0x00,0x7f,0x31,0xff,
-0xfa,0xfb,0x15,0x0a,0xd8,0xf3,0xbf,0x67,0xff,0xea,0xaa,0xa0,0x0b,0xe9,0x0a,0xb0,
-0x04,0xbe,0x22,0x48,0x10,0x9f,0xf2,0x7d,0x70,0x7d,0x30,0x00,0x9f,0x30,0x49,0xbd,
-0x51,0x11,0xd0,0x9f,0x30,0x4f,0xed,0xfd,0x74,0x10,0x07,0xcf,0x94,0x00,0x01,0xfa,
-0x6f,0x12,0x92,0xf8,0xcc,0xcc,0xfe,0xcc,0xc5,0x05,0xbf,0x72,0x71,0x1e,0x50,0x9f,
-0x30,0x01,0x51,0xfa,0x38,0x00,0xf0,0x0f,0x74,0x7f,0xf6,0xfa,0xff,0xe0,0x29,0xef,
-0xfb,0xaf,0x52,0xfa,0x8e,0xe0,0x3f,0xff,0x93,0xaf,0x01,0xfa,0x0c,0xe0,0x05,0xaf,
-0x30,0xaf,0xf4,0xfa,0xff,0xe0,0x6f,0x3b,0x31,0x82,0xfa,0x7d,0x08,0x00,0x61,0x01,
-0xfa,0x0b,0xe0,0x09,0xef,0x7f,0x3b,0x81,0xe0,0x08,0xfa,0x00,0xaf,0xbb,0xbb,0xbe,
-0x13,0x13,0x00,0x84,0x0f,0x00,0x97,0x3e,0xb0,0x23,0x47,0x9d,0x30,0x00,0x7f,0x40,
-0xef,0xff,0xff,0xfe,0x70,0x04,0xc0,0x6b,0x68,0xb1,0x3d,0x60,0x1a,0xdf,0xc7,0x3f,
-0x67,0xf1,0x9f,0x08,0x04,0x92,0x2e,0xa7,0xd5,0xfc,0x20,0x03,0x9f,0x72,0xcf,0xe0,
-0x01,0x30,0x40,0x34,0xfe,0xab,0x7a,0x21,0x7f,0x65,0x38,0x11,0xc0,0x16,0xcf,0xfc,
-0x79,0xfc,0x77,0x77,0x73,0x3f,0xff,0xb4,0x07,0x88,0x13,0x70,0x17,0x9f,0x40,0x0c,
-0xff,0x76,0xdf,0x58,0x00,0xf7,0x0e,0x5f,0xdf,0xc6,0xfa,0x00,0x00,0x7f,0x43,0xff,
-0x27,0xff,0xf3,0x00,0x0b,0xef,0x6f,0xfa,0xcf,0xfd,0xff,0xe7,0x0a,0xea,0x09,0x51,
-0xd8,0x20,0x28,0xd2,0x08,0x0e,0x00,0xeb,0x22,0x70,0x10,0x00,0x5f,0x60,0x78,0xab,
-0xdf,0x75,0x16,0xf0,0x0e,0x60,0xef,0xec,0xc9,0x79,0x20,0x08,0xbf,0xb5,0x4c,0x24,
-0xf4,0x0f,0xc0,0x1f,0xff,0xfa,0x3f,0x90,0xf9,0x6f,0x40,0x03,0x8f,0x82,0x0c,0xb2,
-0x41,0x6a,0x30,0x00,0x11,0x4f,0x88,0x00,0xd0,0x5f,0xb8,0xfe,0x89,0xfd,0x88,0x80,
-0x2a,0xef,0xf9,0x74,0x03,0xfa,0x0f,0x16,0x11,0x98,0x10,0x0f,0xf0,0x01,0x04,0x6f,
+0x10,0x08,0xf0,0x05,0x02,0x9f,0x78,0xff,0xe0,0x1f,0xb0,0x00,0x00,0x7f,0x7f,0xff,
+0xf9,0xaf,0xe9,0x90,0x00,0x7f,0xae,0x8e,0x08,0x01,0x40,0x3b,0xff,0xfc,0x0e,0x18,
+0x00,0xc1,0x3f,0xff,0x70,0x0e,0xfa,0xaf,0xea,0xa0,0x01,0x7f,0x50,0x0e,0x20,0x01,
+0x20,0x7f,0x50,0x18,0x00,0x00,0x48,0x06,0x40,0x0e,0xe1,0x2f,0xb1,0x90,0x06,0x11,
+0x0e,0xa8,0x0c,0xc2,0xea,0x00,0x0e,0xfa,0xaa,0xaa,0xa5,0x00,0x00,0x00,0x01,0x10,
+0xf8,0x00,0x48,0x01,0xfb,0x01,0xfc,0x08,0x00,0xf4,0x01,0xee,0xff,0xee,0xff,0xe9,
+0x2f,0xff,0xfb,0xcc,0xff,0xcc,0xff,0xc8,0x1c,0xef,0xd8,0x18,0x00,0x40,0x00,0x96,
+0x00,0x97,0x08,0x00,0x90,0x49,0x99,0x99,0x99,0x91,0x00,0x8f,0xb9,0x6f,0xd0,0x02,
+0xf1,0x04,0x3c,0xff,0xfc,0x6f,0x51,0xfa,0x0a,0xf2,0x3f,0xff,0x92,0x6f,0x61,0xfb,
+0x0a,0xf2,0x07,0x9f,0x30,0x18,0x00,0x00,0x20,0x01,0x31,0xb9,0xfd,0x8d,0x08,0x00,
+0x00,0x20,0x00,0x22,0x0b,0xef,0x18,0x00,0x80,0x0b,0xe9,0x00,0x6f,0xb9,0x99,0x9d,
+0xf2,0x80,0x00,0x04,0x78,0x01,0x01,0x01,0x00,0x70,0x07,0xf3,0x03,0xff,0xff,0xff,
+0xfd,0x11,0x00,0x91,0x3f,0xc5,0x55,0x5f,0xd0,0x02,0xbd,0xfc,0x93,0x11,0x00,0xb5,
+0x3f,0xff,0xfd,0x3f,0xb2,0x22,0x2f,0xd0,0x00,0x08,0xf4,0x22,0x00,0x91,0x04,0x44,
+0x44,0x44,0x30,0x00,0x08,0xfb,0xaf,0x9c,0x0d,0xd0,0x3d,0xff,0xfd,0x99,0x99,0xfe,
+0x99,0x95,0x02,0xff,0xf6,0x02,0xd8,0xf4,0x00,0x50,0x02,0x7f,0x30,0x6f,0x81,0xb5,
+0x05,0xe0,0x07,0xf3,0x0a,0xfc,0x1f,0xd8,0x86,0x00,0x00,0x7f,0x31,0xff,0xfa,0xfb,
+0x15,0x0a,0xd0,0xf3,0xbf,0x67,0xff,0xea,0xaa,0xa0,0x0b,0xe9,0x0a,0xb0,0x04,0xbe,
+0x70,0x0b,0x04,0x01,0x00,0xf1,0x1b,0x9f,0x30,0x00,0x00,0x03,0x7d,0x30,0x00,0x9f,
+0x30,0x49,0xbd,0xff,0xff,0xa0,0x00,0x9f,0x30,0x4f,0xed,0xfd,0x74,0x10,0x07,0xcf,
+0x94,0x00,0x01,0xfa,0x00,0x00,0x1f,0xff,0xf8,0xcc,0xcc,0xfe,0xcc,0xc5,0x05,0xbf,
+0x72,0xa0,0x03,0x60,0x00,0x9f,0x30,0x01,0x51,0xfa,0x38,0x00,0xf1,0x16,0x74,0x7f,
+0xf6,0xfa,0xff,0xe0,0x29,0xef,0xfb,0xaf,0x52,0xfa,0x8e,0xe0,0x3f,0xff,0x93,0xaf,
+0x01,0xfa,0x0c,0xe0,0x05,0xaf,0x30,0xaf,0xf4,0xfa,0xff,0xe0,0x00,0x9f,0x30,0xaf,
+0x82,0xfa,0x7d,0x08,0x00,0x80,0x01,0xfa,0x0b,0xe0,0x09,0xef,0x30,0xaf,0x78,0x09,
+0x81,0x08,0xfa,0x00,0xaf,0xbb,0xbb,0xbe,0xe0,0x08,0x01,0x00,0x10,0x04,0xe0,0x7f,
+0x40,0x01,0x23,0x47,0x9d,0x30,0x00,0x7f,0x40,0xef,0xff,0xff,0xfe,0x70,0x04,0xc0,
+0x6b,0x68,0xb1,0x3d,0x60,0x1a,0xdf,0xc7,0x3f,0x67,0xf1,0x9f,0x08,0x04,0x92,0x2e,
+0xa7,0xd5,0xfc,0x20,0x03,0x9f,0x72,0xcf,0xe0,0x01,0xa0,0x40,0x34,0xfe,0x44,0x44,
+0x40,0x00,0x7f,0x65,0xff,0xa8,0x08,0xf0,0x08,0x16,0xcf,0xfc,0x79,0xfc,0x77,0x77,
+0x73,0x3f,0xff,0xb4,0x07,0xff,0xff,0xff,0x50,0x17,0x9f,0x40,0x0c,0xff,0x76,0xdf,
+0x58,0x00,0xf8,0x0e,0x5f,0xdf,0xc6,0xfa,0x00,0x00,0x7f,0x43,0xff,0x27,0xff,0xf3,
+0x00,0x0b,0xef,0x6f,0xfa,0xcf,0xfd,0xff,0xe7,0x0a,0xea,0x09,0x51,0xd8,0x20,0x28,
+0xd2,0x08,0x0e,0xf0,0x1c,0x00,0x00,0x14,0x10,0x00,0x5f,0x60,0x78,0xab,0xdf,0xff,
+0xb0,0x00,0x5f,0x60,0xef,0xec,0xc9,0x79,0x20,0x08,0xbf,0xb5,0x4c,0x24,0xf4,0x0f,
+0xc0,0x1f,0xff,0xfa,0x3f,0x90,0xf9,0x6f,0x40,0x03,0x8f,0x82,0x0c,0xb2,0x41,0x6a,
+0x30,0x00,0x11,0x4f,0x88,0x00,0xf1,0x03,0x5f,0xb8,0xfe,0x89,0xfd,0x88,0x80,0x2a,
+0xef,0xf9,0x74,0x03,0xfa,0x00,0x00,0x2f,0xff,0x98,0x10,0x0f,0xf0,0x01,0x04,0x6f,
 0x63,0xff,0x8a,0xfd,0x8f,0xf4,0x00,0x5f,0x60,0xee,0x02,0xf9,0x0c,0xf0,0x08,0x00,
-0x81,0x25,0xfb,0x2c,0xf0,0x0b,0xff,0x50,0xef,0x67,0x68,0x20,0xfa,0x00,0xb1,0x16,
-0x10,0xf0,0x00,0x02,0x30,0xfb,0x01,0xfb,0x00,0x02,0xf2,0x0b,0x0e,0xef,0xfe,0xef,
-0xfe,0x80,0x00,0x7f,0x30,0xaa,0xfe,0xaa,0xfe,0xa6,0x01,0xff,0xff,0xc1,0x2b,0x92,
-0x3b,0x82,0x00,0x1e,0xff,0xeb,0xaa,0x0b,0x61,0x07,0xf3,0x06,0xf8,0x44,0x45,0x8b,
-0x02,0x90,0x6f,0xfe,0xee,0xef,0xc0,0x00,0x08,0xfb,0xb6,0x11,0x00,0x00,0x08,0x99,
-0x01,0x11,0x00,0xf1,0x06,0x01,0xff,0xf6,0x03,0x77,0xbf,0xd7,0x76,0x00,0x03,0x8f,
-0x32,0x88,0x8b,0xfd,0x88,0x85,0x00,0x07,0xf3,0x4f,0x0b,0x62,0x00,0x65,0x3f,0xf6,
-0x06,0xbf,0xdd,0xf8,0x00,0x00,0xbe,0xf2,0x49,0xef,0xd2,0x1e,0xfd,0x80,0x0b,0xe9,
-0x04,0xfd,0x70,0x00,0x18,0xf5,0x49,0x70,0x00,0x80,0x01,0x23,0x57,0xad,0x80,0x01,
-0x00,0x6f,0x99,0xf2,0x0a,0x40,0x4d,0xc6,0xf9,0x4e,0x40,0x1a,0xdf,0xc7,0x0d,0xe2,
-0xf9,0x9f,0x10,0x2f,0xff,0xfc,0x8c,0xea,0xfd,0xee,0x84,0x03,0x9f,0x74,0x00,0x02,
-0x40,0x7f,0x40,0x04,0xef,0xf0,0x0e,0xf0,0x04,0x7f,0xb8,0x9f,0xd4,0xf9,0x7f,0xc4,
-0x2a,0xef,0xfe,0xfd,0x33,0xc8,0x29,0xf7,0x3f,0xff,0x60,0xaf,0xae,0x00,0x70,0x03,
-0x7f,0x40,0x7f,0x74,0xf8,0x3f,0xc8,0x01,0x01,0x2a,0x76,0x00,0x08,0x00,0x90,0x96,
-0xfa,0x6f,0xa0,0x0a,0xaf,0x30,0x7f,0x97,0x08,0x00,0x40,0xea,0x00,0x6f,0xff,0x1f,
-0x40,0x14,0xdd,0x19,0x77,0x00,0xe5,0x10,0x11,0xf6,0x08,0x00,0xf2,0x27,0xc5,0x59,
+0x80,0x25,0xfb,0x2c,0xf0,0x0b,0xff,0x50,0xef,0x38,0x00,0x80,0x09,0xfa,0x00,0x77,
+0x77,0x77,0x7e,0xf0,0xf1,0x30,0x00,0x7f,0x30,0x00,0xfb,0x01,0xfb,0x00,0x00,0x07,
+0xf3,0x0e,0xef,0xfe,0xef,0xfe,0x80,0x00,0x7f,0x30,0xaa,0xfe,0xaa,0xfe,0xa6,0x01,
+0xff,0xff,0xc1,0x2b,0x92,0x3b,0x82,0x00,0x1e,0xff,0xeb,0x6f,0xff,0xff,0xff,0xc0,
+0x00,0x07,0xf3,0x06,0xf8,0x44,0x45,0xfc,0x00,0x00,0x7f,0x30,0x6f,0xfe,0xee,0xef,
+0xc0,0x00,0x08,0xfb,0xb6,0x11,0x00,0x31,0x2d,0xff,0xfe,0x11,0x00,0xf1,0x29,0x01,
+0xff,0xf6,0x03,0x77,0xbf,0xd7,0x76,0x00,0x03,0x8f,0x32,0x88,0x8b,0xfd,0x88,0x85,
+0x00,0x07,0xf3,0x4f,0xff,0xff,0xff,0xff,0xa0,0x00,0x8f,0x30,0x01,0xbf,0xdd,0xf8,
+0x00,0x00,0xbe,0xf2,0x49,0xef,0xd2,0x1e,0xfd,0x80,0x0b,0xe9,0x04,0xfd,0x70,0x00,
+0x18,0xf5,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0xf0,0x1b,0x7f,0x40,0x01,0x23,0x57,
+0xad,0x30,0x00,0x7f,0x40,0xef,0xff,0xff,0xfd,0x80,0x00,0x7f,0x40,0x4d,0xc6,0xf9,
+0x4e,0x40,0x1a,0xdf,0xc7,0x0d,0xe2,0xf9,0x9f,0x10,0x2f,0xff,0xfc,0x8c,0xea,0xfd,
+0xee,0x84,0x03,0x9f,0x74,0x52,0x00,0xf0,0x0e,0xf6,0x00,0x7f,0x40,0x04,0xef,0xfe,
+0xf8,0x00,0x00,0x7f,0xb8,0x9f,0xd4,0xf9,0x7f,0xc4,0x2a,0xef,0xfe,0xfd,0x33,0xc8,
+0x29,0xf7,0x3f,0xff,0x60,0xaf,0xae,0x00,0xc0,0x03,0x7f,0x40,0x7f,0x74,0xf8,0x3f,
+0xa0,0x00,0x7f,0x40,0x7f,0x82,0x00,0x00,0x08,0x00,0x90,0x96,0xfa,0x6f,0xa0,0x0a,
+0xaf,0x30,0x7f,0x97,0x08,0x00,0xa2,0xea,0x00,0x6f,0xff,0xff,0xfe,0x90,0x00,0xdd,
+0x00,0x01,0x00,0x30,0xdd,0x00,0x0f,0x57,0x00,0x00,0x08,0x00,0xf0,0x30,0xc5,0x59,
 0xf6,0x00,0x5a,0xff,0xa0,0x0f,0xea,0xad,0xf6,0x00,0x8f,0xff,0xf1,0x08,0x88,0x88,
 0x83,0x00,0x00,0xdd,0x05,0xee,0xec,0x7e,0xee,0xd0,0x00,0xdd,0x06,0xf6,0xcd,0x8f,
 0x5c,0xe0,0x00,0xdf,0xe6,0xf7,0xdd,0x8f,0x6c,0xe0,0x8e,0xff,0xe7,0xdd,0xdd,0xae,
-0xdd,0xc0,0x8f,0xfd,0x7a,0x8c,0x32,0x12,0xdd,0x09,0x90,0x1a,0xb0,0xdd,0x05,0x99,
-0xff,0xff,0xa9,0x91,0x00,0xdd,0x00,0x4d,0x60,0x31,0xf8,0x01,0x09,0xfc,0x5d,0xfe,
-0x5b,0xf3,0xdf,0xe2,0x0c,0xe5,0x1c,0x71,0x0b,0xf0,0x06,0x80,0xa9,0x3c,0x00,0x01,
-0x00,0x00,0x94,0x09,0x20,0x0b,0xe0,0x08,0x00,0x91,0x05,0x88,0x8e,0xfa,0x88,0x80,
-0x00,0xeb,0x09,0x68,0x05,0xa1,0x39,0xfe,0x99,0xfb,0x61,0x75,0x0c,0xf0,0x6f,0xff,
-0xfe,0x62,0xf0,0x00,0xc0,0x01,0xec,0x13,0xeb,0x7f,0x5f,0x8f,0x80,0x00,0xeb,0x0a,
-0xb9,0xf9,0x0b,0x80,0x0b,0xf2,0x0a,0xa0,0xcd,0xf7,0x58,0xfc,0x00,0x4c,0xff,0xf3,
-0xdf,0xdf,0xff,0x8f,0xc1,0x5f,0xfd,0x2c,0xf5,0x23,0x33,0x18,0xf3,0x13,0xeb,0x02,
-0xf0,0x14,0x60,0xeb,0x00,0x4a,0x6b,0xf7,0x88,0x60,0x00,0xf3,0x04,0xbf,0x49,0xf2,
-0xde,0x30,0x09,0xfb,0x0c,0xf8,0x7d,0xf2,0x2e,0xe0,0x0d,0xe4,0x04,0x60,0xdf,0xb0,
-0x9c,0x51,0x07,0xe8,0x19,0x04,0x08,0x00,0x93,0x09,0xaa,0xaa,0xbf,0xfa,0xaa,0xaa,
-0x70,0x0e,0x25,0x2f,0x84,0x03,0x33,0x33,0x4f,0xe3,0x33,0x33,0x20,0x20,0x00,0x11,
-0x01,0x0f,0x6b,0x13,0xc3,0xa7,0x47,0x10,0xf5,0x48,0x17,0x02,0xb7,0x35,0x10,0x02,
-0x4f,0x8d,0x10,0x30,0x51,0x09,0x32,0xf5,0x5f,0xf6,0x8f,0x1c,0x01,0x86,0x14,0xf9,
-0x09,0x02,0x7c,0xff,0xff,0xc7,0x30,0x00,0x4c,0xff,0xff,0xd6,0x7e,0xff,0xff,0xd1,
-0x1f,0xfc,0x93,0x00,0x00,0x59,0xcf,0x90,0x02,0x3e,0x20,0x11,0x00,0x3b,0x79,0x11,
-0x0f,0x85,0x64,0x40,0x1f,0xc0,0x3f,0xd0,0x32,0x2b,0x42,0x1f,0xc0,0x6f,0xa0,0x08,
-0x00,0x40,0xaf,0xec,0xcc,0xc5,0x08,0x00,0x01,0x1d,0x33,0xf0,0x07,0xf1,0x1f,0xc6,
+0xdd,0xc0,0x8f,0xfd,0x00,0x00,0x0b,0xf0,0x00,0x00,0x12,0xdd,0x09,0xa0,0x00,0xf0,
+0x12,0xf2,0x00,0xdd,0x05,0x99,0xff,0xff,0xa9,0x91,0x00,0xdd,0x00,0x4d,0xff,0xff,
+0xe5,0x00,0x09,0xfc,0x5d,0xfe,0x5b,0xf3,0xdf,0xe2,0x0c,0xe5,0x1c,0x71,0x0b,0xf0,
+0x06,0x80,0x73,0x00,0x36,0x02,0x30,0x00,0x01,0x00,0x50,0xeb,0x00,0x00,0x0b,0xe0,
+0x08,0x00,0x81,0x05,0x88,0x8e,0xfa,0x88,0x80,0x00,0xeb,0x48,0x00,0xd0,0xf0,0x39,
+0xfe,0x99,0xfb,0x61,0x75,0x0c,0xf0,0x6f,0xff,0xf2,0x9f,0xd8,0x00,0xf0,0x28,0x01,
+0xec,0x13,0xeb,0x7f,0x5f,0x8f,0x80,0x00,0xeb,0x0a,0xb9,0xf9,0x0b,0xfe,0x00,0x00,
+0xed,0xa0,0xcd,0xf7,0x58,0xfc,0x00,0x4c,0xff,0xf3,0xdf,0xdf,0xff,0x8f,0xc1,0x5f,
+0xfd,0x2c,0xf5,0x23,0x33,0x18,0xf3,0x13,0xeb,0x02,0xbf,0xff,0xff,0xff,0x20,0x00,
+0xeb,0x00,0x4a,0x6b,0xf7,0x88,0x60,0x00,0xf8,0x05,0xbf,0x49,0xf2,0xde,0x30,0x09,
+0xfb,0x0c,0xf8,0x7d,0xf2,0x2e,0xe0,0x0d,0xe4,0x04,0x60,0xdf,0xb0,0x04,0x82,0x00,
+0x27,0x1f,0xd0,0x08,0x00,0xa1,0x09,0xaa,0xaa,0xbf,0xfa,0xaa,0xaa,0x70,0x0e,0xff,
+0x01,0x00,0x94,0xb0,0x03,0x33,0x33,0x4f,0xe3,0x33,0x33,0x20,0x20,0x00,0x91,0x01,
+0xdd,0xdd,0xdf,0xfd,0xdd,0xc3,0x00,0x02,0x1f,0x00,0xf0,0x01,0xf5,0x00,0x00,0x0a,
+0xf7,0x00,0x00,0x7f,0xc0,0x00,0x00,0x02,0xff,0x30,0x03,0xff,0x57,0x00,0x40,0x6f,
+0xf5,0x5f,0xf6,0x4f,0x00,0x40,0x06,0xff,0xff,0x60,0xed,0x00,0xf7,0x08,0x7c,0xff,
+0xff,0xc7,0x30,0x00,0x4c,0xff,0xff,0xd6,0x7e,0xff,0xff,0xd1,0x1f,0xfc,0x93,0x00,
+0x00,0x59,0xcf,0x90,0x02,0x81,0x00,0x12,0x02,0x7f,0x00,0x30,0xc0,0x0f,0xf0,0x1c,
+0x01,0xc2,0x1f,0xc0,0x3f,0xd0,0x00,0x00,0x0c,0xf1,0x1f,0xc0,0x6f,0xa0,0x08,0x00,
+0x40,0xaf,0xec,0xcc,0xc5,0x08,0x00,0x00,0x00,0x02,0xf0,0x08,0x0c,0xf1,0x1f,0xc6,
 0xfe,0x00,0x8f,0x60,0x0c,0xf1,0x1f,0xee,0xff,0x30,0xbf,0x10,0x0c,0xf1,0x1f,0xdd,
-0xdf,0xa0,0xfd,0x28,0x00,0xa0,0xc2,0x1c,0xf7,0xf8,0x00,0x0d,0xf7,0xbf,0xc0,0x04,
-0x09,0x2a,0x00,0xba,0x02,0xf0,0x02,0xdf,0xa0,0x00,0x1f,0xd7,0x3f,0xc0,0x05,0xff,
-0xe2,0x00,0x02,0x00,0x1f,0xc0,0x6f,0xfb,0x29,0x10,0x50,0x1f,0xdb,0xff,0x50,0x9f,
-0xc9,0x16,0x59,0xc3,0xc3,0x00,0x06,0x80,0x9f,0x47,0x61,0x91,0x00,0x00,0x0b,0xcc,
-0xcc,0x88,0x00,0x00,0xe9,0x47,0x20,0x3f,0xc0,0x2f,0x43,0x60,0x1e,0xf0,0x7f,0xfe,
-0xee,0xe4,0xc6,0x17,0x11,0xcf,0x9c,0x2d,0x70,0x0d,0xf3,0xff,0x20,0x7f,0x70,0x0c,
-0x89,0x2f,0xa0,0x70,0xbf,0x30,0x0c,0xfe,0xdd,0xdf,0xef,0xc0,0xef,0x0c,0x1e,0x41,
-0x03,0x4c,0xf6,0xfb,0x14,0x1e,0x30,0x05,0xff,0xf5,0x08,0x00,0xc0,0x20,0x00,0xff,
-0xe0,0x00,0x0c,0xf4,0x7d,0xf1,0x02,0xef,0xd0,0xbf,0x1b,0xf0,0x00,0xb1,0x4e,0xff,
-0xfc,0x10,0x2f,0xfe,0x71,0x0a,0xff,0xa2,0xdf,0xf4,0x09,0x50,0xf4,0x2c,0x23,0x1b,
-0xe1,0x09,0x14,0x10,0x10,0x27,0x4d,0x31,0x04,0x83,0x00,0x27,0x69,0x10,0x09,0xa0,
-0x23,0x42,0x35,0xf9,0x33,0x0d,0x18,0x5c,0xd0,0xfe,0x0f,0xfc,0xbb,0xb8,0x18,0xcf,
-0xa8,0x88,0x5f,0xff,0xff,0xfa,0x30,0x05,0xa0,0xbf,0xa0,0x7f,0x60,0x00,0x9f,0xdc,
-0xc9,0xff,0xe0,0xc2,0x77,0x00,0xa6,0x06,0x80,0xef,0x00,0x00,0xaf,0x27,0xf7,0xa6,
-0xfb,0x7e,0x37,0x40,0x27,0xf5,0x00,0xef,0xba,0x7c,0x00,0x19,0x28,0xf6,0x13,0xe0,
+0xdf,0xa0,0xfd,0x28,0x00,0xe0,0xc2,0x1c,0xf7,0xf8,0x00,0x0d,0xf7,0xbf,0xc0,0x04,
+0xff,0xf2,0x00,0x2f,0xba,0x02,0xf2,0x12,0xdf,0xa0,0x00,0x1f,0xd7,0x3f,0xc0,0x05,
+0xff,0xe2,0x00,0x02,0x00,0x1f,0xc0,0x6f,0xfb,0xfe,0x40,0x00,0x00,0x1f,0xdb,0xff,
+0x50,0x9f,0xf3,0x00,0x00,0x1f,0xc3,0xc3,0x00,0x90,0x01,0x04,0x01,0x00,0x71,0x08,
+0x91,0x00,0x00,0x0b,0xcc,0xcc,0x88,0x00,0xf0,0x28,0x0e,0xff,0xff,0xf0,0x3f,0xc0,
+0x00,0x00,0x01,0x11,0x1e,0xf0,0x7f,0xfe,0xee,0xe4,0x00,0x00,0x0d,0xf0,0xcf,0xff,
+0xff,0xf4,0x00,0x00,0x0d,0xf3,0xff,0x20,0x7f,0x70,0x0c,0xff,0xff,0xfc,0xff,0x70,
+0xbf,0x30,0x0c,0xfe,0xdd,0xdf,0xef,0xc0,0xef,0x00,0x0c,0xf2,0x00,0x03,0x4c,0xf6,
+0xfb,0x08,0x00,0x40,0x00,0x05,0xff,0xf5,0x08,0x00,0xf0,0x16,0x20,0x00,0xff,0xe0,
+0x00,0x0c,0xf4,0x7d,0xf1,0x02,0xef,0xd0,0x00,0x1e,0xff,0xff,0xb1,0x4e,0xff,0xfc,
+0x10,0x2f,0xfe,0x71,0x0a,0xff,0xa2,0xdf,0xf4,0x09,0x50,0x00,0x09,0xf8,0x00,0x1b,
+0xe1,0x53,0x01,0xf0,0x0c,0x20,0x00,0x00,0x10,0x00,0x04,0x91,0x00,0x04,0x83,0x00,
+0x00,0x00,0x07,0xf6,0x00,0x09,0xf6,0x00,0x00,0x03,0x35,0xf9,0x33,0x0d,0xf3,0x00,
+0xc8,0x00,0xf0,0x0f,0xfe,0x0f,0xfc,0xbb,0xb8,0x18,0xcf,0xa8,0x88,0x5f,0xff,0xff,
+0xfa,0x00,0x9f,0x30,0x00,0xbf,0xa0,0x7f,0x60,0x00,0x9f,0xdc,0xc9,0xff,0xe0,0xaf,
+0x20,0x00,0x1e,0x02,0xf5,0x2c,0xf3,0xef,0x00,0x00,0xaf,0x27,0xf7,0xa6,0xfb,0xfa,
+0x00,0x00,0xcf,0x27,0xf5,0x00,0xef,0xf4,0x00,0x00,0xef,0x08,0xf4,0x00,0x9f,0xe0,
 0x00,0x03,0xfc,0x08,0xf3,0x02,0xef,0xf5,0x00,0x0a,0xf6,0x0a,0xf2,0x5e,0xfb,0xff,
 0x70,0x4f,0xe5,0xbf,0xfa,0xff,0x80,0x7f,0xf9,0x0a,0x32,0xfe,0x72,0xd4,0x00,0x04,
-0xc1,0xcf,0x3b,0x42,0xf4,0x00,0x0b,0xc2,0x08,0x00,0x22,0x0f,0xf0,0x08,0x00,0x00,
-0x38,0x3d,0x90,0x4a,0xad,0xfc,0xa9,0x8f,0xeb,0xbb,0xb6,0x6f,0x78,0x45,0x00,0x25,
-0x33,0x50,0x1a,0xf5,0x17,0xff,0x40,0x10,0x8d,0xd0,0xf4,0x1e,0xff,0x90,0xaf,0x30,
-0x07,0x9d,0xfb,0xbe,0xcf,0xe0,0xef,0xc2,0x3f,0xa0,0xf6,0x1a,0xf8,0xfa,0x00,0x0b,
-0xf3,0x28,0xf6,0x05,0xf0,0x04,0x60,0xf0,0x06,0xf6,0x00,0xef,0xc0,0x9b,0x75,0x41,
-0xf6,0x03,0xff,0xd1,0x20,0x00,0xf6,0x04,0x5f,0xff,0xfc,0x10,0x0b,0xfc,0xbb,0xce,
-0xff,0x71,0xdf,0xe5,0x05,0x70,0x00,0x0b,0xc3,0x00,0x19,0xa0,0x0d,0x00,0xff,0x1b,
-0x12,0x65,0x99,0x4b,0x00,0x4f,0x0c,0x62,0x05,0x56,0xfb,0x55,0x32,0xfa,0x6f,0x18,
-0x10,0x86,0x00,0x06,0x40,0xab,0x57,0xe5,0x3b,0x18,0x0e,0xf0,0x12,0xed,0x06,0xf7,
-0x1f,0xd0,0x3f,0x90,0x08,0xf5,0x01,0xcf,0xaf,0xd0,0x6f,0x50,0x3f,0xc5,0x1f,0xdf,
-0xff,0xf2,0xaf,0x20,0x1d,0xcf,0xcf,0x70,0x9b,0xf8,0xee,0x00,0x00,0x1d,0x4b,0x7a,
-0x00,0x57,0x9a,0x00,0xe5,0x2e,0x10,0xf1,0x38,0x1d,0x30,0xf2,0x00,0x9f,0x9f,0x6b,
-0xf2,0x05,0x67,0xfb,0x08,0xff,0xfe,0x10,0x2e,0xfa,0x00,0x94,0xcf,0xe2,0x9f,0xe4,
-0x0a,0x80,0x00,0x08,0xfb,0x10,0x24,0x7c,0x10,0x40,0x54,0x1f,0x62,0x55,0x00,0x00,
-0x00,0x75,0x00,0x1b,0x44,0x12,0xfc,0x0e,0x42,0x20,0xe4,0xf9,0x37,0x96,0x60,0xaa,
-0xaa,0xa7,0xfc,0x99,0x94,0xbe,0x91,0x10,0x0c,0x7d,0x33,0x00,0x22,0x5d,0xf0,0x05,
-0xf4,0x5f,0xc1,0x04,0xfc,0xe9,0xdf,0xbf,0xf4,0x5f,0x70,0x02,0xf8,0xaa,0xaf,0x9e,
-0xf8,0x8f,0x40,0x5f,0xfd,0x03,0xf0,0x00,0xed,0xcf,0x10,0x3b,0xfc,0xe9,0xef,0x90,
-0x9f,0xfb,0x00,0x07,0xf6,0xf7,0xce,0x5f,0x83,0x71,0x09,0xfa,0xdd,0xef,0x80,0x3f,
-0xf4,0x57,0x1a,0x11,0xe3,0xa4,0x81,0x50,0x7a,0xf9,0x7f,0xf6,0x7f,0x61,0x74,0x57,
-0xd2,0x2c,0x30,0x05,0xc0,0x99,0x35,0x31,0x5b,0x00,0xcc,0x08,0x00,0x31,0x7f,0x80,
-0xfe,0x08,0x00,0x32,0x0c,0x63,0xfb,0x00,0x01,0x90,0xd6,0xfe,0xbb,0xb5,0x1b,0xbb,
-0xff,0xbb,0x9a,0xd9,0x9c,0xf0,0x17,0x50,0xfe,0x28,0x2f,0xf2,0x3f,0x80,0x09,0xf3,
-0xfe,0xcf,0xaf,0xf4,0x6f,0x50,0x01,0xfb,0xff,0xf6,0xdf,0xf9,0xaf,0x20,0x00,0x74,
-0xff,0xb0,0x29,0xce,0xee,0x00,0x00,0x2c,0xff,0xf9,0x00,0x7f,0xf8,0xb4,0x52,0x40,
-0xcf,0xa0,0x2f,0xf2,0xd6,0x70,0xa0,0x0a,0x30,0xaf,0xf9,0x00,0x04,0x00,0xfe,0x00,
-0x1a,0x50,0x3f,0xd1,0x7a,0xfd,0x03,0xff,0xe2,0x5f,0xf5,0x00,0x7f,0xd5,0x00,0x9b,
-0x20,0xa3,0x7a,0x04,0xa2,0x43,0xb1,0x07,0x27,0xd5,0x00,0x00,0x06,0x9f,0xb6,0x6f,
-0x8a,0xf4,0x78,0x00,0xf0,0x07,0xef,0x1e,0xf1,0x00,0x00,0x04,0x7f,0xa9,0xf9,0x2f,
-0xfe,0xdd,0xd3,0x69,0xbf,0xce,0xfb,0x8f,0xff,0xff,0xf3,0xaf,0xed,0x94,0xa0,0xa0,
-0xcf,0x30,0x02,0x6d,0xfc,0x57,0xff,0xe0,0xff,0xe6,0x03,0xf7,0x2b,0xfd,0xfe,0xf6,
-0xfc,0x00,0x8f,0xf9,0xbf,0x90,0x66,0xfe,0xf8,0x00,0x2c,0x36,0xf9,0x00,0x01,0xff,
-0xf1,0x00,0x58,0xad,0xfe,0xef,0x20,0xcf,0xb0,0x00,0x9f,0xff,0xfc,0xa9,0x15,0xff,
-0xf2,0x00,0x11,0x07,0xf4,0x00,0x8f,0xfc,0xfe,0x30,0x01,0x9d,0xf3,0x0c,0xff,0x60,
-0xbf,0xf2,0x00,0xef,0xb0,0x05,0xc3,0xf0,0x1e,0xf0,0x05,0x02,0x70,0xfb,0x27,0x11,
-0xd7,0x00,0x00,0x07,0xf5,0xfb,0x9f,0x35,0xf8,0x00,0x00,0x01,0xf6,0xfb,0xc8,0x2e,
-0x2b,0xc0,0x1d,0xed,0xff,0xdd,0xab,0xfc,0xbb,0xb5,0x0a,0xaf,0xff,0xea,0xec,0x81,
-0xf1,0x11,0x02,0xbf,0xfe,0xfb,0x7f,0xf2,0x6f,0x60,0x2f,0xe5,0xfb,0x38,0xdf,0xf5,
-0x9f,0x30,0x06,0x15,0xa3,0x02,0xfa,0xf9,0xcf,0x00,0x06,0x7d,0xf8,0x77,0x52,0xbe,
-0xfb,0x00,0x56,0x26,0x10,0x6f,0x54,0x93,0x40,0x13,0xfb,0x00,0x2f,0xba,0x2f,0x41,
-0xbd,0xf2,0x00,0xaf,0x60,0x6d,0xf4,0x07,0xc1,0x09,0xfc,0xef,0x60,0x18,0xef,0xea,
-0xf7,0xdf,0xd1,0x3f,0xf8,0x0e,0xd7,0x00,0x13,0xf9,0x10,0x04,0xd2,0x01,0x51,0x21,
-0x52,0x01,0xf8,0x00,0x02,0xc5,0x8f,0x6f,0x22,0x48,0xf6,0x80,0x02,0x50,0x2e,0xff,
-0xff,0xf6,0x09,0x60,0x5e,0xa1,0xe8,0xdf,0xa3,0x09,0xe3,0xfa,0x8f,0xef,0xf5,0xfc,
-0x4c,0x38,0xf4,0x0e,0x32,0xdf,0xf3,0x00,0x01,0x9f,0xfd,0xf7,0x03,0xcf,0xf8,0x20,
-0x0e,0xe6,0xf9,0x47,0xaf,0xb4,0x9f,0xf6,0x04,0x98,0x98,0x77,0x9b,0x77,0x79,0x90,
-0x02,0x6e,0x5b,0x40,0x24,0x52,0x2e,0xf2,0xc0,0x0d,0x30,0x0b,0xf0,0x0d,0xa8,0x1c,
-0x00,0x08,0x00,0x70,0xf6,0x66,0x60,0x00,0x09,0x9e,0xf9,0x1a,0x83,0x17,0x94,0x6c,
-0x32,0x04,0x15,0x1d,0x23,0x0e,0xf5,0x8a,0x03,0x12,0xfa,0x94,0x32,0x28,0xde,0xfd,
-0x94,0x32,0x22,0x05,0xfa,0xbf,0x6d,0x00,0x64,0x32,0x11,0xcf,0xcb,0x7c,0x12,0xc0,
-0x61,0x8a,0x42,0x0c,0xf8,0x1e,0xf5,0xc8,0x17,0x23,0xdf,0x90,0x04,0x8c,0x13,0x00,
-0xb6,0x54,0x10,0xc3,0x5b,0x3a,0xf0,0x01,0xdf,0xf9,0x5e,0xff,0xa4,0x00,0x1b,0xff,
-0xfd,0x40,0x00,0x9f,0xff,0xe6,0x0b,0xfb,0x6b,0x1f,0x23,0x8e,0xe1,0xea,0x2a,0x07,
-0x9e,0x19,0x20,0xac,0x20,0x1d,0x0e,0x00,0xa9,0x53,0xf1,0x0b,0x05,0x70,0xcf,0x10,
-0x00,0x6f,0xff,0xfa,0x1d,0xf7,0xcf,0x10,0x09,0xff,0x42,0xdf,0xc1,0xef,0xef,0x10,
-0x7f,0xfd,0x99,0xae,0x70,0x35,0x2d,0x0e,0x50,0xf7,0x18,0x00,0xcf,0x10,0x41,0x60,
-0xd0,0x8f,0xc1,0xcf,0x10,0x1a,0xab,0xfd,0xaa,0x39,0xf9,0xcf,0x10,0x2f,0xfc,0x40,
-0xf0,0x11,0x70,0xcf,0x10,0x01,0x23,0xfa,0x12,0x00,0x36,0xef,0xf6,0x07,0xf7,0xfa,
-0xec,0x7f,0xff,0xff,0xb5,0x0d,0xf3,0xf9,0x8f,0x8c,0x85,0xdf,0x10,0x4f,0x92,0xf9,
-0x3f,0x60,0x8f,0x81,0x31,0x9c,0xf9,0x02,0x68,0x00,0x35,0x6f,0xd3,0x00,0xa0,0x4c,
-0x09,0x10,0x16,0x00,0x9f,0x31,0xf0,0x0c,0x60,0xeb,0x11,0xf8,0x30,0x05,0xbf,0xff,
+0xc1,0xfd,0x00,0x52,0x09,0xf4,0x00,0x0b,0xc2,0x08,0x00,0x22,0x0f,0xf0,0x08,0x00,
+0xc0,0x4f,0xd0,0x00,0x00,0x4a,0xad,0xfc,0xa9,0x8f,0xeb,0xbb,0xb6,0x35,0x03,0xf1,
+0x2c,0xdf,0xff,0xff,0xf8,0x01,0x1a,0xf5,0x17,0xff,0x40,0x7f,0x70,0x00,0x09,0xf4,
+0x1e,0xff,0x90,0xaf,0x30,0x07,0x9d,0xfb,0xbe,0xcf,0xe0,0xef,0x00,0x0b,0xff,0xff,
+0xf6,0x1a,0xf8,0xfa,0x00,0x0b,0xf3,0x28,0xf6,0x05,0xff,0xf3,0x00,0x0b,0xf0,0x06,
+0xf6,0x00,0xef,0xc0,0x00,0x0b,0xf0,0x07,0xf6,0x03,0xff,0xd1,0x20,0x00,0xf6,0x05,
+0x5f,0xff,0xfc,0x10,0x0b,0xfc,0xbb,0xce,0xff,0x71,0xdf,0xe5,0x05,0x70,0x00,0x0b,
+0xc3,0x00,0x19,0xe2,0x05,0x02,0x40,0x70,0x00,0x00,0x65,0x00,0x01,0xf0,0x36,0xf7,
+0x00,0x00,0xfd,0x00,0x00,0x05,0x56,0xfb,0x55,0x32,0xfa,0x00,0x00,0x1f,0xff,0xff,
+0xff,0x86,0xfe,0xcc,0xc5,0x05,0xab,0x57,0xe5,0x3b,0xff,0xff,0xf7,0x00,0xed,0x06,
+0xf7,0x1f,0xd0,0x3f,0x90,0x08,0xf5,0x01,0xcf,0xaf,0xd0,0x6f,0x50,0x3f,0xc5,0x1f,
+0xdf,0xff,0xf2,0xaf,0x20,0x1d,0xcf,0xcf,0x70,0x9b,0xf8,0xee,0x00,0x00,0x1d,0xff,
+0x20,0x00,0xef,0xf8,0x7f,0x02,0xf0,0x16,0x50,0x00,0x7f,0xf1,0x00,0x00,0x1e,0xff,
+0xf2,0x00,0x9f,0xf3,0x00,0x01,0xdf,0x67,0xfb,0x08,0xff,0xfe,0x10,0x2e,0xfa,0x00,
+0x94,0xcf,0xe2,0x9f,0xe4,0x0a,0x80,0x00,0x08,0xfb,0x10,0x0a,0xf3,0x7b,0x00,0xf1,
+0x04,0x40,0x00,0x00,0x20,0x00,0x55,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0xdf,0x00,
+0x00,0x00,0xfc,0x00,0xe0,0x02,0xf0,0x1e,0xe4,0xf9,0x00,0x00,0x08,0xfc,0xaa,0xaa,
+0xa7,0xfc,0x99,0x94,0x1f,0xf1,0x00,0x00,0x0c,0xff,0xff,0xf7,0x5f,0xff,0xff,0xff,
+0x3f,0xf4,0x5f,0xc1,0x04,0xfc,0xe9,0xdf,0xbf,0xf4,0x5f,0x70,0x02,0xf8,0xaa,0xaf,
+0x9e,0xf8,0x8f,0x40,0x5f,0xfd,0x03,0xf0,0x12,0xed,0xcf,0x10,0x3b,0xfc,0xe9,0xef,
+0x90,0x9f,0xfb,0x00,0x07,0xf6,0xf7,0xce,0x00,0x4f,0xf5,0x00,0x09,0xfa,0xdd,0xef,
+0x80,0x3f,0xf4,0x00,0x0a,0xff,0xff,0xff,0xe3,0xef,0x21,0x03,0xe6,0x7a,0xf9,0x7f,
+0xf6,0x7f,0xf5,0x00,0x00,0xaf,0xd2,0x2c,0x30,0x05,0xc0,0x7e,0x02,0x41,0xfe,0x5b,
+0x00,0xcc,0x08,0x00,0x31,0x7f,0x80,0xfe,0x08,0x00,0x32,0x0c,0x63,0xfb,0x00,0x01,
+0xf5,0x4d,0xd6,0xfe,0xbb,0xb5,0x1b,0xbb,0xff,0xbb,0x9a,0xff,0xff,0xf7,0x01,0x50,
+0xfe,0x28,0x2f,0xf2,0x3f,0x80,0x09,0xf3,0xfe,0xcf,0xaf,0xf4,0x6f,0x50,0x01,0xfb,
+0xff,0xf6,0xdf,0xf9,0xaf,0x20,0x00,0x74,0xff,0xb0,0x29,0xce,0xee,0x00,0x00,0x2c,
+0xff,0xf9,0x00,0x7f,0xf8,0x00,0x07,0xff,0xff,0xcf,0xa0,0x2f,0xf2,0x00,0x2f,0xd3,
+0xfe,0x0a,0x30,0xaf,0xf9,0x00,0x04,0x00,0xfe,0x00,0x1a,0xfe,0xff,0x80,0x00,0x7a,
+0xfd,0x03,0xff,0xe2,0x5f,0xf5,0x00,0x7f,0xd5,0x00,0x9b,0x20,0x06,0xa0,0x7f,0x00,
+0xd1,0x4f,0x70,0x07,0x27,0xd5,0x00,0x00,0x06,0x9f,0xb6,0x6f,0x8a,0xf4,0x78,0x00,
+0xf0,0x06,0xef,0x1e,0xf1,0x00,0x00,0x04,0x7f,0xa9,0xf9,0x2f,0xfe,0xdd,0xd3,0x69,
+0xbf,0xce,0xfb,0x8f,0xff,0xff,0xf3,0x65,0x05,0xb0,0xef,0xa0,0xcf,0x30,0x02,0x6d,
+0xfc,0x57,0xff,0xe0,0xff,0xe6,0x03,0xf6,0x2e,0xfd,0xfe,0xf6,0xfc,0x00,0x8f,0xf9,
+0xbf,0x90,0x66,0xfe,0xf8,0x00,0x2c,0x36,0xf9,0x00,0x01,0xff,0xf1,0x00,0x58,0xad,
+0xfe,0xef,0x20,0xcf,0xb0,0x00,0x9f,0xff,0xfc,0xa9,0x15,0xff,0xf2,0x00,0x11,0x07,
+0xf4,0x00,0x8f,0xfc,0xfe,0x30,0x01,0x9d,0xf3,0x0c,0xff,0x60,0xbf,0xf2,0x00,0xef,
+0xb0,0x05,0xc3,0x00,0x09,0x70,0xff,0x01,0xf0,0x36,0xfb,0x27,0x11,0xd7,0x00,0x00,
+0x07,0xf5,0xfb,0x9f,0x35,0xf8,0x00,0x00,0x01,0xf6,0xfb,0xc8,0x08,0xf5,0x00,0x00,
+0x1d,0xed,0xff,0xdd,0xab,0xfc,0xbb,0xb5,0x0a,0xaf,0xff,0xea,0x8f,0xff,0xff,0xf7,
+0x02,0xbf,0xfe,0xfb,0x7f,0xf2,0x6f,0x60,0x2f,0xe5,0xfb,0x38,0xdf,0xf5,0x9f,0x30,
+0x06,0x15,0xa3,0x02,0xfa,0xf9,0xcf,0x00,0x06,0x7d,0xf8,0x77,0x52,0xbe,0xfb,0xa4,
+0x01,0xf0,0x20,0xff,0x10,0x6f,0xf5,0x00,0x00,0xdf,0x13,0xfb,0x00,0x2f,0xf1,0x00,
+0x03,0xef,0xbd,0xf2,0x00,0xaf,0xf8,0x00,0x00,0x0b,0xff,0xc1,0x09,0xfc,0xef,0x60,
+0x18,0xef,0xea,0xf7,0xdf,0xd1,0x3f,0xf8,0x0e,0xd7,0x00,0x13,0xf9,0x10,0x04,0xd2,
+0x01,0x00,0xfd,0x01,0x00,0x86,0x03,0x41,0xf8,0x00,0x02,0xc5,0xf8,0x03,0x32,0xff,
+0x48,0xf6,0x80,0x02,0x40,0x2e,0xff,0xff,0xf6,0x8e,0x05,0xc0,0xaf,0xe8,0xdf,0xa3,
+0x09,0xe3,0xfa,0x8f,0xef,0xf5,0xfc,0x00,0x10,0x00,0xf1,0x0d,0x32,0xdf,0xf3,0x00,
+0x01,0x9f,0xfd,0xf7,0x03,0xcf,0xf8,0x20,0x0e,0xe6,0xf9,0x47,0xaf,0xb4,0x9f,0xf6,
+0x04,0x98,0x98,0x77,0x9b,0x77,0x79,0x90,0x18,0x05,0x00,0xfa,0x04,0xe0,0x24,0x52,
+0x2e,0xf2,0x22,0x22,0x10,0x00,0x0b,0xf0,0x0d,0xff,0xff,0xf0,0x25,0x06,0xe2,0x0d,
+0xf6,0x66,0x60,0x00,0x09,0x9e,0xf9,0x9f,0xf9,0x99,0x99,0x94,0x1f,0x28,0x00,0x62,
+0xf7,0x00,0x00,0x00,0x05,0x90,0x03,0x01,0x23,0x0e,0xf5,0x8a,0x03,0xc5,0xfa,0x00,
+0x00,0x00,0x1d,0xdd,0xdd,0xde,0xfd,0xdd,0xdd,0xd6,0x28,0x00,0x60,0x05,0xfa,0x00,
+0x00,0x5f,0xc0,0xa1,0x02,0x40,0x30,0x00,0xcf,0x50,0x68,0x05,0x30,0xc0,0x05,0xfd,
+0x2f,0x00,0x41,0x0c,0xf8,0x1e,0xf5,0x42,0x01,0x22,0xff,0xdf,0x49,0x00,0x11,0x6f,
+0x3f,0x02,0x00,0x02,0x02,0xf1,0x0e,0xc3,0x00,0x00,0x00,0x16,0xdf,0xf9,0x5e,0xff,
+0xa4,0x00,0x1b,0xff,0xfd,0x40,0x00,0x9f,0xff,0xe6,0x0b,0xfb,0x50,0x00,0x00,0x02,
+0x8e,0xe1,0x01,0x10,0x25,0x00,0x16,0x10,0x80,0x02,0xf0,0x1c,0xac,0x20,0x00,0x00,
+0xcf,0x10,0x00,0x07,0xff,0x60,0x05,0x70,0xcf,0x10,0x00,0x6f,0xff,0xfa,0x1d,0xf7,
+0xcf,0x10,0x09,0xff,0x42,0xdf,0xc1,0xef,0xef,0x10,0x7f,0xfd,0x99,0xae,0x70,0x35,
+0xcf,0x10,0x1e,0xff,0xff,0xf7,0x18,0x28,0x00,0xf1,0x2c,0x03,0xfa,0x00,0x8f,0xc1,
+0xcf,0x10,0x1a,0xab,0xfd,0xaa,0x39,0xf9,0xcf,0x10,0x2f,0xff,0xff,0xff,0x40,0x70,
+0xcf,0x10,0x01,0x23,0xfa,0x12,0x00,0x36,0xef,0xf6,0x07,0xf7,0xfa,0xec,0x7f,0xff,
+0xff,0xb5,0x0d,0xf3,0xf9,0x8f,0x8c,0x85,0xdf,0x10,0x4f,0x92,0xf9,0x3f,0x60,0x00,
+0xcf,0x10,0x19,0x9c,0xf9,0x02,0x68,0x00,0x31,0x6f,0xd3,0x00,0x08,0x00,0x0c,0x01,
+0x00,0xf0,0x58,0x0f,0x80,0x00,0x00,0x4d,0x60,0xeb,0x11,0xf8,0x30,0x05,0xbf,0xff,
 0x2e,0xbd,0x6f,0x8f,0x8d,0xff,0xfa,0x30,0xeb,0x9a,0xfc,0xf2,0xfe,0x40,0x00,0x0e,
-0xb6,0x8f,0xca,0xa6,0x50,0xf0,0x09,0xeb,0xbc,0xfe,0xb7,0xfd,0x11,0x11,0x0e,0xbd,
-0xef,0xfd,0x8f,0xff,0xff,0xf6,0xeb,0x09,0xfe,0x30,0xff,0xae,0xfb,0x4e,0xb4,0x9e,
-0x3b,0xf0,0x11,0xbf,0x00,0xed,0xfa,0xf8,0xb3,0xfb,0x0b,0xf0,0x0e,0xb9,0x1f,0x80,
+0xb6,0x8f,0xca,0x0f,0xd0,0x00,0x00,0xeb,0xbc,0xfe,0xb7,0xfd,0x11,0x11,0x0e,0xbd,
+0xef,0xfd,0x8f,0xff,0xff,0xf6,0xeb,0x09,0xfe,0x30,0xff,0xae,0xfb,0x4e,0xb4,0xff,
+0xff,0x4f,0xc0,0xbf,0x00,0xed,0xfa,0xf8,0xb3,0xfb,0x0b,0xf0,0x0e,0xb9,0x1f,0x80,
 0x2f,0x90,0xbf,0x00,0xeb,0x00,0x74,0x05,0xf8,0x0b,0xf0,0x0e,0xea,0xaa,0xaa,0xaf,
-0x40,0xbf,0x00,0xe6,0x09,0x12,0xf0,0x2c,0x94,0x3c,0xa9,0x00,0xbf,0x30,0x86,0x00,
-0x08,0x08,0x11,0xfb,0x7d,0x53,0x61,0xdd,0x00,0xfc,0x04,0xaf,0xff,0x68,0x22,0xb1,
-0xab,0xfe,0x82,0x00,0x1d,0xff,0xdd,0xff,0x9b,0xe0,0x00,0x20,0x00,0x21,0x0b,0xe0,
-0xe7,0x40,0xa0,0xfb,0x0b,0xe4,0x44,0x42,0x00,0xde,0x66,0xfb,0x0b,0xa0,0x01,0x70,
-0xde,0x77,0xfb,0x0b,0xf8,0xef,0x94,0x18,0x00,0x40,0x0c,0xd0,0xbf,0x10,0x40,0x00,
-0x50,0x0e,0xd0,0xbf,0x10,0x4f,0x51,0x4d,0xf0,0x04,0xb0,0xbf,0x10,0x29,0xbb,0x99,
-0xb9,0xaf,0x90,0xbf,0x10,0x00,0xcf,0x3a,0xf2,0x8f,0x40,0xbf,0x10,0xd2,0x32,0x81,
-0xfe,0x00,0xbf,0x10,0x07,0xa0,0x00,0x24,0xcf,0x80,0x04,0x88,0x02,0x21,0x04,0x80,
-0x67,0xc4,0x00,0x80,0x05,0x50,0x03,0x6a,0xff,0x80,0x1f,0x73,0x3c,0x90,0xff,0xc7,
-0x20,0x19,0xdb,0x9c,0xea,0x4f,0x90,0xa7,0x02,0x20,0x0b,0xf1,0x70,0x78,0x80,0x28,
-0xed,0x8f,0xe8,0x6f,0xb6,0x66,0x62,0x78,0x04,0x11,0x8f,0x30,0x44,0xd1,0xf6,0x00,
-0x4f,0xb6,0xff,0x62,0x29,0x9b,0xfc,0x99,0x5f,0x70,0xef,0x2a,0x32,0xf1,0x11,0x5f,
-0x60,0xef,0x00,0x02,0x76,0xf7,0x81,0x6f,0x50,0xef,0x00,0x0b,0xe5,0xf7,0xea,0x9f,
-0x30,0xef,0x00,0x4f,0x64,0xf6,0x7d,0xef,0x00,0xef,0x00,0x04,0x5b,0xf5,0x05,0x30,
-0x22,0x41,0x5f,0xc1,0x01,0xb3,0xb6,0x6a,0x01,0x73,0x5c,0x01,0xf2,0x2d,0x03,0x15,
-0x07,0x00,0xfc,0xa3,0x04,0x80,0x55,0x05,0x72,0x30,0x11,0x1d,0x1c,0x3d,0x26,0xdd,
-0xd2,0x6e,0x43,0x04,0x66,0x43,0x13,0x5f,0xa2,0x87,0x51,0x8f,0xec,0xcc,0xcd,0xf9,
-0xd8,0x20,0x32,0x00,0x06,0xf8,0x52,0x9d,0x20,0x08,0xf7,0x77,0x6f,0x02,0x3f,0x35,
-0x32,0xbf,0xe1,0x00,0x48,0x19,0xd7,0x30,0x07,0xdc,0xef,0xd0,0x00,0x09,0xd3,0x00,
-0x02,0xff,0xfc,0x20,0x96,0x1a,0x11,0x30,0xe5,0x5d,0x00,0x1b,0x2f,0x22,0x9f,0x50,
-0xce,0x19,0x80,0xef,0xa9,0x99,0x93,0x5f,0xff,0xff,0xfb,0x71,0x08,0x50,0x3b,0xff,
-0xbb,0xdf,0xf3,0x11,0x13,0x40,0xdf,0x00,0x2d,0xea,0x18,0x11,0xf1,0x24,0xef,0xaa,
-0x82,0xee,0xff,0xef,0xf2,0x00,0xef,0xff,0xc0,0x00,0x9f,0x2e,0xc0,0x00,0xfc,0x0f,
-0xc1,0xd6,0x9f,0x25,0x40,0x01,0xf9,0x0f,0xb3,0xf7,0x9f,0xff,0xc0,0x04,0xf7,0x0f,
-0xb4,0xf7,0x9f,0xba,0x80,0x08,0xf4,0x1f,0xa6,0xfd,0x9f,0x10,0x00,0x0e,0xf0,0x2f,
-0x9b,0x5f,0x15,0xd0,0xa8,0xcf,0xbf,0xa9,0xff,0xcb,0xb6,0x0b,0x18,0xfc,0x2b,0x20,
-0x6c,0xd8,0x07,0x03,0x02,0x02,0x02,0xea,0x30,0x24,0x70,0x02,0x80,0x1a,0x42,0x11,
-0x11,0x3f,0xd1,0x36,0x5f,0x14,0x3f,0x9e,0x5d,0x01,0xa4,0x73,0x06,0x2c,0x8f,0x20,
-0xff,0xff,0x38,0x1d,0x00,0x14,0x84,0x12,0x20,0x67,0x4b,0x22,0xcf,0x20,0xcf,0x03,
-0x02,0x08,0x00,0xf0,0x09,0xbf,0xc0,0xcf,0x20,0x04,0xd5,0x00,0x2c,0xfe,0x20,0xcf,
-0x30,0x06,0xf7,0x1a,0xff,0xd1,0x00,0xbf,0xfd,0xef,0xf3,0x0c,0xf8,0xde,0x72,0x06,
-0x17,0x74,0x12,0xbf,0x82,0x35,0x00,0xe5,0x20,0x10,0xf2,0x41,0x19,0x1a,0x0e,0x06,
-0x00,0x11,0x40,0x06,0x00,0x02,0x24,0x00,0x4e,0xed,0xdd,0xdd,0xdf,0x24,0x00,0x04,
-0x18,0x00,0x02,0x24,0x00,0x15,0x40,0x69,0x31,0x60,0x1f,0xd0,0x0a,0xbb,0xbb,0x80,
-0xcc,0x28,0x00,0x36,0x54,0x00,0x5a,0x5a,0xa0,0xe2,0x3f,0xb9,0xdd,0xdd,0xff,0xd6,
-0xed,0x01,0xfb,0x2d,0x00,0x40,0x7e,0xd0,0x1f,0xb0,0x7a,0x0f,0x60,0xef,0xbb,0xfb,
-0x04,0x10,0x1f,0x9f,0x44,0xf1,0x03,0xb5,0xfb,0x01,0xfd,0x00,0xed,0x01,0xfb,0x0c,
-0xf6,0x1f,0xd0,0x0e,0xd0,0x1f,0xb0,0x3f,0xe2,0x0f,0x00,0x30,0x00,0x98,0x2f,0x1e,
-0x00,0x11,0xb0,0x4b,0x00,0x21,0xaa,0xa7,0x5a,0x00,0x10,0xa0,0xd8,0x44,0x12,0xfb,
-0x68,0x1f,0x18,0xeb,0xcf,0x2d,0x00,0xc1,0x57,0x40,0xdf,0xff,0xfa,0x0f,0x36,0x08,
-0xc1,0xbc,0xfa,0x0f,0xf8,0x88,0xfe,0xde,0x01,0xfa,0x0f,0xe0,0x00,0x07,0x00,0x51,
-0xe2,0x22,0xfe,0xdf,0xab,0x1c,0x00,0x00,0x23,0x00,0x27,0xf9,0x99,0x1c,0x00,0x30,
-0x1f,0xe5,0x55,0x1c,0x00,0x12,0x3f,0x1c,0x00,0x51,0x6f,0xa5,0x55,0xfe,0xde,0xcc,
-0x2e,0x21,0xfe,0x22,0x89,0x30,0x10,0xfe,0x47,0x56,0x40,0x04,0xcd,0xfc,0x00,0xde,
-0x8f,0x29,0xff,0xd4,0x83,0x42,0x00,0x88,0x0a,0x40,0xa6,0x66,0x66,0x6b,0x08,0x00,
-0x40,0xdb,0xbb,0xbb,0xbd,0x08,0x00,0x12,0xca,0x63,0x53,0x63,0x7f,0xb7,0x77,0x77,
-0x7c,0xf7,0x28,0x00,0x10,0xf6,0x91,0x45,0x21,0x0a,0xb0,0x75,0x01,0x10,0xfc,0x2c,
-0x26,0x41,0x00,0x0a,0xfe,0xcc,0x08,0x00,0x76,0x1c,0xe5,0x33,0x3f,0xf4,0x33,0x31,
-0x5b,0x75,0x12,0x03,0x10,0x00,0x13,0x0a,0x9b,0x75,0x06,0x9d,0x57,0x01,0xd1,0xa7,
-0x60,0x0c,0xdd,0xd9,0x00,0x00,0xfa,0x4b,0x35,0x81,0xb0,0x00,0x1f,0xa0,0x00,0x0e,
-0xd4,0xfb,0x7a,0x14,0xf0,0x12,0xec,0x0f,0xb1,0xfd,0xaf,0xea,0xfc,0x0e,0xc0,0xfb,
-0x1f,0x90,0xfa,0x0f,0xc0,0xef,0xff,0xb1,0xf9,0x1f,0xa0,0xfc,0x0e,0xea,0xfb,0x1f,
-0x91,0xfa,0x0f,0xc0,0xec,0x0f,0xbd,0x44,0x00,0xb0,0x8e,0xc0,0xfb,0x78,0x8c,0xff,
-0xa8,0x84,0xee,0x9f,0xb0,0x07,0x46,0xf2,0x0c,0x0e,0xff,0xfb,0x00,0x6f,0xbb,0xf2,
-0x00,0xec,0x22,0x10,0x6f,0xf2,0x3f,0xc0,0x0b,0x90,0x03,0xbf,0xf4,0x00,0x9f,0xd3,
-0x00,0x00,0x5f,0xc2,0x22,0x0f,0x11,0x20,0x1f,0x04,0x13,0x9f,0x86,0x2f,0x13,0x9f,
-0xe6,0x33,0x05,0x10,0x00,0x40,0x74,0x44,0x44,0x49,0x08,0x00,0x80,0xed,0xdd,0xdd,
-0xde,0xf8,0x00,0x00,0x58,0x24,0x25,0x10,0x84,0x56,0x8a,0x01,0xa7,0x53,0x05,0xb8,
-0x00,0x42,0x08,0x91,0x0c,0xf1,0x31,0x46,0x11,0x0c,0x44,0x16,0x60,0x7f,0xf5,0x0c,
-0xfb,0xbb,0xbb,0xf9,0x44,0x11,0x7d,0xac,0x81,0xc0,0xf8,0x3f,0xff,0xfd,0xcc,0xcc,
-0xc4,0x1d,0xa0,0x01,0x7b,0xef,0x20,0x3a,0x08,0x63,0x53,0x00,0xb4,0x0f,0x50,0x3f,
-0xd7,0x77,0x77,0x7a,0x08,0x00,0x56,0xd6,0x66,0x66,0x69,0xfa,0x18,0x00,0x00,0x71,
-0x28,0x17,0x04,0x10,0x00,0x10,0x18,0x80,0x00,0x00,0xa4,0x8f,0xf0,0x0d,0x06,0xc3,
-0x0b,0xa0,0x04,0x00,0x00,0xdd,0x08,0xf4,0x0e,0xe0,0x7f,0x60,0x00,0x7f,0x68,0xf4,
-0x0e,0xe1,0xed,0x00,0x00,0x0e,0xb8,0xf4,0x0e,0xe8,0x94,0x48,0x54,0x09,0xf4,0x0e,
-0xe0,0x20,0x6b,0x4b,0x22,0xfb,0x3c,0x7c,0x03,0x11,0xc8,0x52,0x5c,0x11,0x24,0xb5,
-0x22,0x10,0x20,0x32,0x42,0x40,0x02,0x99,0xdf,0xb9,0x61,0x70,0x03,0xfe,0x32,0x70,
-0xa0,0x00,0x6f,0x44,0xf7,0x3f,0x91,0xf5,0x0e,0xd6,0xc4,0xf7,0x3f,0x97,0xf4,0x00,
-0x09,0x9e,0xbb,0xfc,0xaf,0xdb,0xe9,0x54,0x07,0x01,0x2e,0x8a,0x13,0x52,0xa5,0x03,
-0x00,0x2f,0x35,0x56,0xc1,0x11,0x11,0x17,0xf8,0x10,0x00,0x00,0x54,0x24,0x22,0x6a,
-0xf8,0xa6,0x8d,0x14,0x8b,0x18,0x00,0x16,0xe7,0x20,0x02,0x6e,0x7f,0x95,0x55,0x55,
-0x5a,0xf6,0x10,0x00,0x60,0x5c,0xcc,0xcf,0xec,0xcc,0xc5,0x83,0x26,0x55,0xaf,0xe8,
-0x88,0x88,0x80,0x13,0x78,0x10,0x07,0xea,0x49,0x20,0x71,0x00,0x32,0x81,0x32,0xcc,
-0xcf,0xf2,0xa4,0x24,0x10,0x5d,0x08,0x00,0x03,0xa3,0x28,0xf1,0x08,0x19,0xe7,0x0e,
-0xf0,0x8a,0x50,0x00,0x2c,0xff,0xa7,0x7f,0xf0,0x6c,0xff,0x80,0x07,0x92,0x09,0xfe,
-0x80,0x00,0x3a,0x30,0x0c,0x8a,0x20,0x13,0x69,0x2e,0x36,0x00,0xdd,0x16,0xf0,0x02,
-0xb0,0x17,0xfe,0x89,0x76,0x2f,0xd4,0x20,0x00,0x0b,0xf7,0xaf,0x63,0x1f,0xd5,0x55,
-0x51,0xb8,0x01,0xf0,0x0c,0x7f,0xff,0xff,0xf4,0x05,0x55,0xbf,0x75,0x5f,0xb3,0xde,
-0x31,0x18,0x9a,0xef,0xff,0x9f,0x60,0xdd,0x00,0x1f,0xdc,0xdf,0x86,0xef,0x10,0xdd,
-0x32,0x99,0x42,0x20,0x57,0x00,0xaa,0x53,0x56,0x00,0x78,0x01,0x50,0x6f,0xa7,0x77,
-0x77,0x79,0x08,0x00,0x48,0xca,0xaa,0xaa,0xab,0x08,0x00,0x04,0x18,0x00,0x04,0xfe,
-0x8f,0x12,0xfd,0x0a,0x20,0x08,0x07,0x00,0x74,0x22,0x22,0xfe,0x24,0xfd,0x22,0x22,
-0xff,0x41,0xc5,0xba,0xff,0xab,0xfe,0xab,0xfc,0xbf,0x10,0xfd,0x01,0xfc,0x01,0x07,
-0x00,0x64,0xdd,0xff,0xdd,0xff,0xdd,0xfc,0x23,0x00,0x0a,0x1c,0x00,0x65,0x42,0xfe,
-0x24,0xfd,0x24,0xfc,0x3f,0x00,0x10,0xaa,0x5e,0x56,0x04,0xe5,0x2e,0x00,0x41,0x03,
-0x12,0xfb,0xdc,0x78,0x21,0x0e,0xf2,0xf5,0x11,0x03,0x2c,0x42,0xa3,0x9f,0x97,0x7e,
+0x40,0xbf,0x00,0xef,0xff,0xff,0xfe,0xf0,0x0b,0xf0,0x6b,0x00,0x3b,0xa9,0x00,0xbf,
+0x7d,0x00,0x10,0x01,0x08,0x08,0xd0,0xfb,0x00,0x00,0x7f,0xa0,0x00,0xdd,0x00,0xfc,
+0x04,0xaf,0xff,0xb2,0x80,0x01,0xb1,0xab,0xfe,0x82,0x00,0x1d,0xff,0xdd,0xff,0x9b,
+0xe0,0x00,0x20,0x00,0x01,0xb0,0x07,0xc0,0xdf,0xff,0xfb,0x0b,0xe4,0x44,0x42,0x00,
+0xde,0x66,0xfb,0x0b,0xa0,0x01,0x70,0xde,0x77,0xfb,0x0b,0xf8,0xef,0x94,0x18,0x00,
+0x40,0x0c,0xd0,0xbf,0x10,0x40,0x00,0x40,0x0e,0xd0,0xbf,0x10,0x08,0x09,0xf4,0x16,
+0xcf,0xb0,0xbf,0x10,0x29,0xbb,0x99,0xb9,0xaf,0x90,0xbf,0x10,0x00,0xcf,0x3a,0xf2,
+0x8f,0x40,0xbf,0x10,0x0b,0xf9,0x02,0xfc,0xfe,0x00,0xbf,0x10,0x07,0xa0,0x00,0x24,
+0xf5,0x00,0xbf,0x10,0x00,0x88,0x02,0x20,0x04,0x80,0x05,0x00,0x01,0x80,0x05,0x40,
+0x03,0x6a,0xff,0x80,0x80,0x00,0xa0,0x4f,0xff,0xc7,0x20,0x19,0xdb,0x9c,0xea,0x4f,
+0x90,0xa7,0x02,0xe0,0x0b,0xf1,0x3f,0x80,0x00,0x00,0x28,0xed,0x8f,0xe8,0x6f,0xb6,
+0x66,0x62,0x78,0x04,0x10,0x8f,0xc1,0x08,0xf3,0x2f,0x05,0xf6,0x00,0x4f,0xb6,0xff,
+0x62,0x29,0x9b,0xfc,0x99,0x5f,0x70,0xef,0x00,0x3f,0xff,0xff,0xff,0x5f,0x60,0xef,
+0x00,0x02,0x76,0xf7,0x81,0x6f,0x50,0xef,0x00,0x0b,0xe5,0xf7,0xea,0x9f,0x30,0xef,
+0x00,0x4f,0x64,0xf6,0x7d,0xef,0x00,0xef,0x00,0x04,0x5b,0xf5,0x05,0xfb,0x00,0xef,
+0x00,0x00,0x5f,0xc1,0x01,0xb3,0x00,0xef,0x00,0x01,0x20,0x33,0x00,0x90,0x02,0x13,
+0x80,0x10,0x08,0x13,0xf2,0x90,0x02,0x00,0xcf,0x07,0x03,0x88,0x02,0xd2,0xf2,0x1d,
+0xdd,0xef,0xfe,0xdd,0xdd,0xdd,0xd2,0x00,0x00,0x2f,0xf0,0x1f,0x00,0x22,0x3f,0xe0,
+0x08,0x00,0x00,0x8a,0x00,0x90,0xfb,0x00,0x00,0x00,0x8f,0xec,0xcc,0xcd,0xf9,0xdc,
+0x01,0xf6,0x1d,0x60,0x00,0x06,0xf8,0x00,0x00,0x04,0xff,0x10,0x00,0x08,0xf7,0x00,
+0x00,0x0d,0xf9,0x00,0x00,0x0b,0xf4,0x00,0x00,0xbf,0xe1,0x00,0x00,0x0f,0xf1,0x00,
+0x1d,0xff,0x30,0x07,0xdc,0xef,0xd0,0x00,0x09,0xd3,0x00,0x02,0xff,0xfc,0x20,0x83,
+0x01,0x50,0x03,0x30,0x00,0x25,0x10,0x57,0x00,0x40,0xc0,0x00,0x9f,0x50,0xdf,0x02,
+0xa0,0xf3,0x00,0xef,0xa9,0x99,0x93,0x5f,0xff,0xff,0xfb,0x71,0x08,0xf5,0x49,0x3b,
+0xff,0xbb,0xdf,0xf3,0x11,0x11,0x10,0x00,0xdf,0x00,0x2d,0xea,0xaa,0xaa,0xa2,0x00,
+0xef,0xaa,0x82,0xee,0xff,0xef,0xf2,0x00,0xef,0xff,0xc0,0x00,0x9f,0x2e,0xc0,0x00,
+0xfc,0x0f,0xc1,0xd6,0x9f,0x25,0x40,0x01,0xf9,0x0f,0xb3,0xf7,0x9f,0xff,0xc0,0x04,
+0xf7,0x0f,0xb4,0xf7,0x9f,0xba,0x80,0x08,0xf4,0x1f,0xa6,0xfd,0x9f,0x10,0x00,0x0e,
+0xf0,0x2f,0x9b,0xff,0xff,0x10,0x00,0x6f,0xa8,0xcf,0xbf,0xa9,0xff,0xcb,0xb6,0x0b,
+0x18,0xfc,0x2b,0x20,0x6c,0xff,0xf4,0x02,0x02,0x11,0xcc,0x01,0x00,0x13,0x70,0xc8,
+0x03,0x81,0x90,0x00,0x11,0x11,0x3f,0xd1,0x11,0x11,0xe9,0x00,0x13,0xb0,0x2a,0x05,
+0x16,0xa0,0x10,0x01,0xe1,0xf7,0x1d,0xdd,0xdd,0xff,0xff,0xed,0xdd,0xd6,0x00,0x00,
+0x00,0xef,0xef,0xc7,0x00,0x42,0x05,0xfc,0xcf,0x20,0xcf,0x03,0x02,0x08,0x00,0xf3,
+0x10,0xbf,0xc0,0xcf,0x20,0x04,0xd5,0x00,0x2c,0xfe,0x20,0xcf,0x30,0x06,0xf7,0x1a,
+0xff,0xd1,0x00,0xbf,0xfd,0xef,0xf3,0x0c,0xf8,0x00,0x00,0x3d,0xff,0xff,0x90,0x01,
+0x02,0x03,0x11,0xbf,0x5e,0x01,0xba,0xbf,0xfe,0xee,0xee,0xef,0xf2,0xbf,0x30,0x00,
+0x00,0x0e,0x06,0x00,0x11,0x40,0x06,0x00,0x02,0x24,0x00,0x4e,0xed,0xdd,0xdd,0xdf,
+0x24,0x00,0x04,0x18,0x00,0x01,0x24,0x00,0x00,0x30,0x00,0x23,0x0d,0xf2,0xd6,0x09,
+0xb0,0x0a,0xbb,0xbb,0x80,0x00,0x01,0xfd,0x00,0xef,0xff,0xfb,0x0f,0x00,0xb0,0x0e,
+0xe2,0x3f,0xb9,0xdd,0xdd,0xff,0xd6,0xed,0x01,0xfb,0x2d,0x00,0xf1,0x15,0x7e,0xd0,
+0x1f,0xb0,0x00,0x02,0xfd,0x00,0xef,0xbb,0xfb,0x04,0x10,0x1f,0xd0,0x0e,0xff,0xff,
+0xb5,0xfb,0x01,0xfd,0x00,0xed,0x01,0xfb,0x0c,0xf6,0x1f,0xd0,0x0e,0xd0,0x1f,0xb0,
+0x3f,0xe2,0x0f,0x00,0x30,0x00,0x98,0x2f,0x1e,0x00,0x11,0xb0,0x4b,0x00,0x21,0xaa,
+0xa7,0x5a,0x00,0x61,0xa0,0x00,0x00,0x0d,0xee,0xfb,0x68,0x00,0x47,0xaf,0xeb,0x20,
+0x00,0xc6,0x01,0x70,0x33,0x33,0x33,0xdf,0xff,0xfa,0x0f,0x36,0x08,0xc1,0xbc,0xfa,
+0x0f,0xf8,0x88,0xfe,0xde,0x01,0xfa,0x0f,0xe0,0x00,0x07,0x00,0x51,0xe2,0x22,0xfe,
+0xdf,0xab,0x1c,0x00,0x00,0x23,0x00,0x27,0xf9,0x99,0x1c,0x00,0x30,0x1f,0xe5,0x55,
+0x1c,0x00,0x12,0x3f,0x1c,0x00,0xf4,0x11,0x6f,0xa5,0x55,0xfe,0xde,0x00,0x00,0xcf,
+0x30,0x00,0xfe,0x22,0x00,0x05,0xfe,0x00,0x00,0xfe,0x00,0x00,0x2f,0xf6,0x04,0xcd,
+0xfc,0x00,0x00,0x0a,0x90,0x00,0xff,0xd4,0x6e,0x00,0x13,0x7f,0x4b,0x05,0x50,0x7f,
+0xa6,0x66,0x66,0x6b,0x08,0x00,0x40,0xdb,0xbb,0xbb,0xbd,0x08,0x00,0x40,0xca,0xaa,
+0xaa,0xad,0x08,0x00,0x52,0xb7,0x77,0x77,0x7c,0xf7,0x28,0x00,0x00,0xec,0x0b,0x41,
+0x2f,0xd0,0x0a,0xb0,0x75,0x01,0x91,0xfc,0xcf,0xfc,0xcc,0xcc,0x00,0x0a,0xfe,0xcc,
+0x08,0x00,0xa3,0x1c,0xe5,0x33,0x3f,0xf4,0x33,0x31,0x00,0x00,0x3f,0xdc,0x0a,0x12,
+0x03,0x10,0x00,0x92,0x0a,0xaa,0xaa,0xaf,0xfa,0xaa,0xaa,0xa0,0x0f,0xf4,0x01,0x11,
+0xf1,0xa7,0x04,0xf0,0x06,0xa0,0x00,0x0c,0xdd,0xd9,0x00,0x00,0xfa,0x00,0x00,0xef,
+0xff,0xb0,0x00,0x1f,0xa0,0x00,0x0e,0xd4,0xfb,0x1f,0xaa,0x0b,0xf0,0x12,0xec,0x0f,
+0xb1,0xfd,0xaf,0xea,0xfc,0x0e,0xc0,0xfb,0x1f,0x90,0xfa,0x0f,0xc0,0xef,0xff,0xb1,
+0xf9,0x1f,0xa0,0xfc,0x0e,0xea,0xfb,0x1f,0x91,0xfa,0x0f,0xc0,0xec,0x0f,0xbd,0x44,
+0x00,0xf0,0x1c,0x8e,0xc0,0xfb,0x78,0x8c,0xff,0xa8,0x84,0xee,0x9f,0xb0,0x00,0xcf,
+0xfa,0x00,0x0e,0xff,0xfb,0x00,0x6f,0xbb,0xf2,0x00,0xec,0x22,0x10,0x6f,0xf2,0x3f,
+0xc0,0x0b,0x90,0x03,0xbf,0xf4,0x00,0x9f,0xd3,0x00,0x00,0x5f,0xc2,0x00,0xf2,0x09,
+0x01,0x1b,0x04,0x02,0xec,0x09,0xb6,0xff,0xf8,0x00,0x00,0x9f,0x85,0x55,0x55,0x59,
+0xf8,0x00,0x10,0x00,0x40,0x74,0x44,0x44,0x49,0x08,0x00,0xf1,0x01,0xed,0xdd,0xdd,
+0xde,0xf8,0x00,0x00,0x58,0x88,0x88,0x88,0x88,0x84,0x00,0x0b,0xbb,0x01,0x00,0x15,
+0xb0,0xb8,0x00,0x41,0x08,0x91,0x0c,0xf1,0x14,0x02,0x10,0xf0,0x27,0x07,0xe0,0x00,
+0x00,0x7f,0xf5,0x0c,0xfb,0xbb,0xbb,0x00,0x03,0xff,0xff,0x7d,0xf1,0xe1,0x02,0xf3,
+0x00,0xf8,0x3f,0xff,0xfd,0xcc,0xcc,0xc4,0x1d,0xa0,0x01,0x7b,0xef,0xff,0xff,0xf0,
+0xa2,0x0d,0x03,0x10,0x01,0x80,0xfa,0x00,0x00,0x3f,0xd7,0x77,0x77,0x7a,0x08,0x00,
+0x57,0xd6,0x66,0x66,0x69,0xfa,0x18,0x00,0x47,0xa0,0x00,0x00,0x04,0x10,0x00,0x10,
+0x18,0x80,0x00,0xf1,0x1a,0x85,0x00,0x00,0x02,0x06,0xc3,0x0b,0xa0,0x04,0x00,0x00,
+0xdd,0x08,0xf4,0x0e,0xe0,0x7f,0x60,0x00,0x7f,0x68,0xf4,0x0e,0xe1,0xed,0x00,0x00,
+0x0e,0xb8,0xf4,0x0e,0xe8,0xf3,0x00,0x00,0x03,0x09,0xf4,0x0e,0xe0,0x20,0x37,0x00,
+0x00,0x3d,0x04,0x12,0x3c,0x7c,0x03,0x70,0xc8,0x00,0x00,0x23,0x00,0x00,0x24,0x8d,
+0x03,0xf2,0x02,0xff,0x20,0x00,0xbf,0x60,0x00,0x02,0x99,0xdf,0xb9,0x9a,0xff,0x99,
+0x60,0x03,0xff,0xff,0x56,0x0e,0xf6,0x08,0x6f,0x44,0xf7,0x3f,0x91,0xfa,0x00,0x00,
+0x2f,0xc4,0xf7,0x3f,0x97,0xf4,0x00,0x09,0x9e,0xbb,0xfc,0xaf,0xdb,0xe9,0x94,0x2c,
+0x07,0x52,0x55,0x55,0x55,0x55,0x52,0xa5,0x03,0x00,0x20,0x01,0x67,0x1f,0xc1,0x11,
+0x11,0x17,0xf8,0x10,0x00,0x40,0xd6,0x66,0x66,0x6a,0x08,0x00,0x44,0xe8,0x88,0x88,
+0x8b,0x18,0x00,0x16,0xe7,0x20,0x02,0x6e,0x7f,0x95,0x55,0x55,0x5a,0xf6,0x10,0x00,
+0xe1,0x5c,0xcc,0xcf,0xec,0xcc,0xc5,0x00,0x08,0x88,0x88,0xaf,0xe8,0x88,0x88,0x9c,
+0x05,0x10,0xff,0xdd,0x07,0xf0,0x06,0x07,0x77,0x77,0x77,0x77,0x71,0x00,0x00,0x1f,
+0xfc,0xcc,0xcc,0xcf,0xf2,0x00,0x00,0x1f,0xd5,0x55,0x55,0x5d,0x08,0x00,0x02,0x13,
+0x0e,0xf0,0x12,0x00,0x19,0xe7,0x0e,0xf0,0x8a,0x50,0x00,0x2c,0xff,0xa7,0x7f,0xf0,
+0x6c,0xff,0x80,0x07,0x92,0x09,0xfe,0x80,0x00,0x3a,0x30,0x00,0x0a,0xb1,0x00,0x00,
+0x13,0x69,0x60,0x2f,0xac,0x05,0xf0,0x04,0xff,0xff,0xb0,0x17,0xfe,0x89,0x76,0x2f,
+0xd4,0x20,0x00,0x0b,0xf7,0xaf,0x63,0x1f,0xd5,0x55,0x51,0xb8,0x01,0xf0,0x0b,0x7f,
+0xff,0xff,0xf4,0x05,0x55,0xbf,0x75,0x5f,0xb3,0xde,0x31,0x18,0x9a,0xef,0xff,0x9f,
+0x60,0xdd,0x00,0x1f,0xdc,0xdf,0x86,0xef,0x10,0xc1,0x0e,0x52,0x6b,0x20,0x57,0x00,
+0xaa,0x7b,0x05,0x00,0x78,0x01,0x50,0x6f,0xa7,0x77,0x77,0x79,0x08,0x00,0x48,0xca,
+0xaa,0xaa,0xab,0x08,0x00,0x04,0x18,0x00,0x60,0xff,0xff,0xff,0xff,0xfa,0x00,0x7a,
+0x00,0x00,0xfd,0x01,0xfc,0x00,0x00,0x07,0x00,0x90,0x22,0x22,0xfe,0x24,0xfd,0x22,
+0x22,0xbf,0xff,0x01,0x00,0xe5,0xfc,0xbf,0xba,0xff,0xab,0xfe,0xab,0xfc,0xbf,0x10,
+0xfd,0x01,0xfc,0x01,0x07,0x00,0x64,0xdd,0xff,0xdd,0xff,0xdd,0xfc,0x23,0x00,0x0a,
+0x1c,0x00,0x65,0x42,0xfe,0x24,0xfd,0x24,0xfc,0x3f,0x00,0x71,0xaa,0xaa,0xaa,0xab,
+0xfc,0x0f,0xff,0x01,0x00,0xe0,0xf0,0x0a,0xaa,0xaa,0xaf,0xfb,0xaa,0xaa,0xa0,0x00,
+0x00,0x00,0x0e,0xf2,0x72,0x00,0x11,0x9f,0x18,0x00,0xc3,0x00,0x00,0x9f,0x97,0x7e,
 0xf8,0x77,0xef,0x00,0x00,0x9f,0x87,0x08,0x00,0x04,0x18,0x00,0x47,0x30,0x0e,0xf2,
-0x00,0x10,0x00,0x60,0x5c,0xd8,0xbf,0xe8,0x88,0x88,0x9b,0x47,0x00,0xba,0x76,0x01,
-0xab,0x47,0xf6,0x05,0x63,0x10,0x00,0x00,0x1a,0xdf,0xff,0xcf,0xff,0xff,0xee,0xe5,
-0x0a,0xfb,0x60,0x01,0x59,0xbc,0xef,0xf0,0x3d,0x35,0x11,0xf8,0xf0,0x4e,0x70,0x05,
-0x9b,0xfc,0x94,0x59,0xcf,0xb9,0x7c,0x4e,0x20,0xf7,0x9f,0x11,0x0e,0x10,0x05,0x39,
-0x10,0x01,0xe4,0x24,0xf3,0x18,0xf9,0xdf,0xff,0xff,0xf5,0x08,0x9f,0xfe,0x85,0x7a,
-0xff,0xfa,0x82,0x00,0x9f,0xff,0xb1,0x2d,0xf9,0xfe,0x20,0x1b,0xfc,0x19,0xe5,0xff,
-0x80,0x6f,0xf5,0x0c,0xea,0x89,0xa8,0xdd,0x88,0x89,0xd1,0x00,0x4f,0x59,0x04,0x76,
-0x4f,0x91,0x11,0x11,0x18,0xf7,0x00,0x10,0x00,0x40,0xb4,0x44,0x44,0x4a,0x08,0x00,
-0x44,0xd9,0x99,0x99,0x9c,0x18,0x00,0x03,0x41,0x02,0x00,0xf1,0x01,0x67,0x7f,0x96,
-0x66,0x66,0x6d,0xf2,0x10,0x00,0x12,0x95,0x11,0x02,0x21,0x6d,0xdd,0x3c,0x07,0x13,
-0x38,0xe8,0x39,0x14,0x6f,0x99,0x03,0x40,0xfd,0x58,0xf9,0x56,0x65,0x24,0x02,0x98,
-0x00,0x90,0x90,0x00,0xfd,0x57,0xf9,0x4f,0x81,0xaf,0x30,0x10,0x00,0x90,0x0a,0xf8,
-0xfa,0x00,0x03,0xfd,0x69,0xfe,0x41,0x83,0x4f,0xf8,0x04,0xff,0xfe,0xfd,0xae,0xfd,
-0xff,0xa1,0x14,0x21,0x03,0xf9,0x7a,0x30,0x39,0x90,0x00,0x00,0x02,0x84,0x9b,0x46,
-0x1a,0x0b,0x9b,0x46,0x00,0xc8,0x6f,0x13,0x50,0x50,0x34,0x01,0x5c,0x82,0x04,0xd9,
-0x04,0x40,0x03,0xff,0xfb,0x00,0x5a,0xad,0x22,0x3f,0xfc,0x10,0x00,0xa2,0x1e,0x93,
-0xfe,0xaa,0xaa,0xad,0xf5,0x00,0x02,0x03,0x18,0x00,0x24,0x00,0x03,0x01,0x05,0x51,
-0xfd,0x88,0x88,0x8c,0xf5,0x2e,0x6a,0x31,0x0a,0xce,0xf4,0x08,0x00,0x37,0x08,0xfe,
-0xa0,0x7c,0x48,0x24,0x01,0xf9,0x08,0x00,0xf0,0x03,0x0b,0xff,0xff,0xf1,0x1d,0xff,
-0xdd,0xfe,0x9b,0xfb,0xbe,0xf1,0x1e,0xff,0xee,0xff,0xab,0xf0,0xad,0x69,0x91,0x13,
-0xf9,0x0b,0xf3,0x3c,0xf1,0x00,0xdf,0xff,0x20,0x00,0xf1,0x00,0x00,0xde,0x67,0xf9,
-0x0c,0xf6,0x6d,0xf1,0x00,0xdf,0x78,0xf9,0x0c,0xf0,0x0b,0x18,0x00,0x30,0x0d,0xf7,
-0x7d,0xd5,0x69,0x41,0xfa,0x0e,0xff,0xff,0x5b,0x31,0xa0,0x9f,0xc1,0x1c,0xf1,0x29,
-0xcc,0x9a,0xc9,0x8f,0x90,0x20,0x00,0xf9,0x05,0x39,0xf5,0x7f,0x60,0x0c,0xf1,0x1c,
-0xf9,0x00,0xdf,0xef,0x17,0xcf,0xf0,0x09,0xa0,0x00,0x21,0x59,0x05,0xe4,0x50,0x0c,
-0xab,0x65,0x02,0x0d,0x2c,0x13,0xef,0x38,0x02,0x11,0xcd,0xbc,0x7b,0x0d,0x20,0x00,
-0x05,0xcd,0x08,0x00,0xbd,0x07,0x01,0xcd,0x08,0x13,0x0a,0x2a,0x46,0x40,0xbf,0xdf,
-0xfc,0xfb,0x7c,0x4a,0xf0,0x01,0xfb,0x1f,0xf0,0xbf,0xd4,0x00,0x3c,0xff,0xa0,0x0f,
-0xf0,0x0a,0xff,0xb2,0x2e,0xd4,0x40,0x00,0x32,0x5e,0xe1,0x02,0x48,0x00,0x1f,0x20,
-0x23,0x67,0x04,0x00,0xf6,0x06,0x54,0x3f,0xf3,0x33,0x33,0x30,0xf8,0x02,0x70,0x0b,
-0xbb,0xcf,0xff,0xff,0xfb,0xbb,0x0e,0x16,0x31,0x8f,0xf9,0xf7,0xa4,0x0b,0x40,0x1f,
-0xf2,0xff,0x10,0x8f,0x35,0x20,0x0f,0xf0,0xcc,0x31,0x30,0x5f,0xe1,0x0f,0x57,0x41,
-0xa0,0x04,0xff,0x60,0x0f,0xf0,0x07,0xff,0x50,0x4f,0xfd,0x37,0x00,0x40,0xdf,0xf3,
-0x0c,0x85,0x24,0x28,0x2d,0x49,0x70,0x68,0x00,0x14,0x0d,0x48,0x34,0x20,0xf0,0x0a,
-0x85,0x27,0x00,0x08,0x00,0xb0,0xfd,0xcf,0xf3,0x00,0x3c,0xcf,0xfc,0xaa,0xf3,0x0a,
-0xf3,0xdf,0x01,0x40,0xda,0xf3,0x0a,0xf3,0xcc,0x7a,0x11,0x0a,0x08,0x00,0x31,0x9f,
-0xfd,0x1b,0x08,0x00,0x40,0xef,0xff,0xcb,0xf3,0x35,0xaf,0xf0,0x1f,0xff,0xf9,0xfd,
-0xf2,0x0a,0xf3,0x00,0x0e,0xee,0xf1,0x6e,0xf0,0x0a,0xf3,0x00,0x6f,0x7d,0xf0,0x1f,
-0xd0,0x0a,0xf3,0x30,0x1d,0x0d,0xf0,0x6f,0x90,0x0a,0xf3,0xf4,0x01,0x0d,0xf0,0xcf,
-0x30,0x0a,0xf4,0xf5,0x00,0x0d,0xf7,0xfc,0x00,0x0a,0xfd,0xe3,0x5f,0x31,0xc2,0x00,
-0x03,0x23,0xb0,0x04,0x91,0x6f,0x04,0x08,0x00,0x11,0x0b,0xf9,0x04,0xb0,0x0f,0xd0,
-0x0a,0xee,0xff,0xfe,0xe0,0x3b,0xbf,0xfb,0xa0,0x98,0x0c,0x14,0x5f,0x37,0x66,0x11,
-0x4f,0x74,0x2e,0x02,0x7f,0xa1,0x20,0xdf,0x30,0x80,0x00,0x10,0x7f,0x35,0x1c,0xc1,
-0x04,0xff,0xee,0xfe,0xee,0xff,0xee,0xe8,0x0d,0xff,0xd5,0x90,0x30,0x00,0x21,0x9f,
-0xd0,0x20,0x00,0x22,0x2e,0x1f,0x08,0x00,0x32,0x01,0x0f,0xd0,0x30,0x00,0x0c,0x08,
-0x00,0x04,0x33,0x13,0x00,0x46,0x0a,0x14,0x01,0x63,0x41,0x10,0xb0,0x42,0x09,0xa0,
-0xa8,0x8a,0xff,0x70,0x00,0x08,0xff,0xaf,0xf6,0x5e,0x35,0x0e,0x31,0x82,0x04,0xff,
-0xf3,0x6c,0xf0,0x0a,0x58,0xcf,0xfe,0xdf,0xfe,0xa7,0x51,0x3f,0xff,0xfc,0x67,0x64,
-0xaf,0xff,0xf1,0x0b,0xa6,0x20,0x0f,0xf0,0x00,0x37,0x50,0x00,0x7a,0xc9,0x07,0x12,
-0xa9,0xcf,0x36,0x00,0x03,0x68,0x60,0x03,0xc5,0x0f,0xf0,0x4a,0x10,0x73,0x69,0xa0,
-0x0f,0xf0,0x6f,0xe3,0x00,0x07,0xfb,0x16,0xaf,0xe0,0x9e,0x3f,0x10,0x40,0x65,0x02,
-0x1d,0x43,0xe0,0x01,0x12,0x05,0x9a,0x48,0x01,0x9a,0x1c,0x01,0x05,0x1e,0x60,0x1b,
-0xa0,0x0f,0xf0,0x08,0xd5,0x14,0x12,0x40,0x0f,0xf0,0x0e,0xf2,0x64,0x7b,0x80,0x0f,
-0xf0,0x6f,0x80,0x00,0x1c,0xcd,0xec,0x7c,0x4c,0x05,0xa4,0x7a,0x00,0xd2,0x97,0x21,
-0xff,0xa1,0x60,0x02,0x22,0xbf,0xfb,0x60,0x02,0x62,0x0f,0xf0,0xbf,0xc3,0x00,0x2b,
-0x60,0x02,0x31,0xa1,0x2e,0xe5,0x60,0x02,0x30,0xe2,0x02,0x10,0x08,0x00,0x22,0x01,
-0x30,0x72,0x2e,0x80,0x38,0x50,0x00,0x1f,0xb0,0x06,0x8a,0xbe,0x4f,0x8b,0xb2,0xb0,
-0x0f,0xff,0xfe,0xc8,0x40,0x09,0x9f,0xd9,0x3f,0xd2,0xcc,0x4e,0x30,0x6f,0xd0,0x00,
-0x9d,0x0f,0x21,0xd4,0x1f,0x4d,0x20,0xf0,0x19,0x8f,0xf5,0x0f,0xff,0xda,0xaf,0xc0,
-0x00,0xef,0xff,0x2f,0xce,0xd0,0x5f,0x80,0x04,0xff,0xcf,0x8f,0xa9,0xf3,0xbf,0x40,
-0x0c,0xcf,0xb4,0x4f,0x84,0xfb,0xfd,0x00,0x4f,0x6f,0xb0,0x8f,0x50,0xcf,0xf5,0x00,
-0x0b,0x0d,0x39,0x10,0x9f,0xcd,0x24,0xf6,0x07,0xb2,0xfc,0x1a,0xff,0xfe,0x30,0x00,
-0x1f,0xbb,0xfb,0xff,0xb1,0xaf,0xf8,0x00,0x1f,0xb5,0xc0,0xb6,0x00,0x06,0xd2,0x13,
-0x14,0x14,0x90,0x08,0x00,0x40,0x7b,0xbb,0xbb,0xb7,0x08,0x00,0x10,0xaf,0xf8,0x04,
-0x70,0x0b,0xbf,0xeb,0x13,0xfa,0x09,0xf3,0x80,0x00,0xf1,0x2b,0x13,0xf8,0x0c,0xf0,
-0x00,0x00,0x6f,0xc1,0x05,0xf7,0x1f,0xe9,0x81,0x00,0xaf,0xf6,0x06,0xf7,0x5f,0xff,
-0xf1,0x00,0xff,0xff,0x29,0xfd,0x00,0x1f,0xc0,0x06,0xff,0xbe,0x3c,0xff,0x50,0x7f,
-0x80,0x0d,0xdf,0x91,0x0f,0xef,0xe1,0xef,0x20,0x5f,0x7f,0x90,0x5f,0x87,0xfd,0xf9,
-0x00,0x0b,0x1f,0x90,0xbf,0x30,0x21,0x07,0x30,0x94,0xfd,0x07,0xf3,0x65,0x50,0x1f,
-0xbe,0xf4,0xaf,0xf6,0x80,0x00,0x66,0xa7,0x90,0x2c,0x20,0x04,0xb0,0xad,0x1f,0x13,
-0xff,0x95,0x23,0x50,0xc9,0x9f,0xf9,0x9c,0xfa,0x32,0x28,0x47,0x3f,0xf3,0x38,0xfa,
-0x18,0x00,0x40,0x94,0x4f,0xf4,0x49,0x08,0x00,0x47,0xca,0xaf,0xfa,0xac,0x18,0x00,
-0x03,0x8a,0x44,0x06,0xb1,0x9a,0xb0,0xbe,0xff,0xff,0xeb,0xbb,0xb1,0x00,0x01,0x9f,
-0xef,0xfd,0x5f,0x91,0xf1,0x01,0x9e,0xfa,0x0f,0xf1,0x8f,0xfa,0x40,0x4f,0xfc,0x50,
-0x0f,0xf0,0x03,0xbf,0xf4,0x05,0x6f,0x94,0x25,0x02,0x40,0x0b,0x7f,0x31,0x2f,0x90,
-0xcf,0xe5,0x23,0xa0,0x2f,0x90,0x9b,0xbc,0xfe,0xbb,0xb2,0x0b,0xcf,0xeb,0x50,0x4d,
-0x00,0xf0,0x00,0x91,0x5a,0xaa,0xfe,0xaa,0xa0,0x00,0x4f,0xa0,0x7f,0xf8,0x02,0xf0,
-0x24,0x9f,0xf3,0x7f,0x51,0xfa,0x0c,0xf0,0x00,0xef,0xfd,0x7f,0x42,0xfe,0x0c,0xf0,
-0x04,0xff,0xae,0xbf,0x47,0xff,0x6c,0xf0,0x0c,0xff,0x93,0x7f,0x5d,0xdc,0xdc,0xf0,
-0x2f,0x9f,0x90,0x7f,0xdf,0x66,0xff,0xf0,0x09,0x3f,0x90,0x7f,0x68,0x00,0x6c,0xf0,
-0x00,0x2f,0x90,0x7f,0xfa,0x4d,0x01,0x08,0x00,0x22,0x07,0xbf,0x08,0x00,0x0b,0xc8,
-0x04,0x13,0xe0,0x40,0x04,0x46,0xe3,0x33,0x33,0x30,0x0d,0x29,0xf1,0x10,0x8f,0xff,
-0xff,0xf8,0x66,0x60,0x00,0x04,0xef,0x6f,0xe7,0xfe,0x40,0x00,0x03,0xaf,0xf6,0x0f,
-0xe0,0x7f,0xfb,0x40,0x4f,0xff,0x62,0x27,0x72,0x26,0xff,0xf3,0x0a,0x01,0x7a,0x72,
-0x96,0x60,0x00,0x0a,0xf5,0x22,0x22,0x1f,0x76,0x02,0x10,0x43,0x60,0x0a,0xf6,0x33,
-0x33,0x9f,0x90,0x2d,0x51,0x20,0xdd,0xdd,0x45,0x2f,0x10,0x05,0xa1,0x08,0x1c,0x40,
-0x11,0x0a,0x14,0xf0,0xcd,0x43,0x00,0xb3,0x01,0x30,0xbb,0xbb,0xbb,0xf9,0x55,0x10,
-0x08,0xc0,0x28,0x42,0x28,0x9f,0xe8,0x50,0x67,0x9b,0x02,0xc9,0x4d,0x41,0x15,0xbf,
-0xe5,0x4b,0xc5,0x22,0x30,0xdf,0xf8,0x1f,0x42,0x09,0x60,0x02,0xff,0xff,0x60,0x02,
-0xfd,0x3f,0x3d,0xf0,0x20,0xdc,0xa5,0x52,0xfc,0x27,0x00,0x2f,0xbf,0xc2,0x1d,0xe2,
-0xfc,0x6f,0x60,0x6f,0x5f,0xc0,0x2f,0x91,0xfc,0x1f,0xd0,0x08,0x1f,0xc0,0xaf,0x31,
-0xfc,0x0b,0xf3,0x00,0x1f,0xc1,0xfc,0x02,0xfc,0x07,0xf8,0x00,0x1f,0xc0,0x33,0xbf,
-0xfb,0x02,0x82,0x00,0x18,0x25,0x07,0x11,0x48,0x00,0x5f,0x4e,0x40,0x92,0x00,0x5b,
-0x40,0xf5,0x34,0x10,0xfb,0xab,0x28,0x00,0x23,0x4f,0xa0,0x32,0xfc,0x00,0x08,0x9f,
-0xd8,0x30,0x5c,0x39,0xf6,0x78,0x01,0x10,0x8f,0xc8,0x06,0x80,0x04,0x7f,0xd4,0x4c,
-0xcc,0xcc,0xcc,0xc1,0x0d,0x2b,0x03,0x81,0x68,0x12,0x10,0x07,0x08,0xa0,0xdf,0x87,
-0xcc,0xcc,0xcc,0x40,0x0b,0xff,0xb7,0x09,0x75,0x11,0x32,0x4f,0x9f,0xb0,0x4a,0x11,
-0x03,0xab,0x0d,0x34,0x02,0x1f,0xb0,0x68,0x00,0x02,0x55,0x22,0x39,0x1f,0xb0,0xbc,
-0x15,0x23,0x00,0x62,0x1a,0x40,0x4e,0x90,0x00,0x00,0xc0,0x0b,0x30,0x01,0xef,0x20,
-0x11,0x00,0xa1,0x01,0x99,0x9d,0xe9,0x99,0x60,0x09,0xaf,0xea,0x4f,0xd0,0x0e,0x00,
-0x73,0x1f,0xf0,0x21,0xa3,0x3b,0xa2,0x20,0x02,0x9f,0xc2,0x04,0xfe,0x10,0xdf,0x70,
-0x00,0x0c,0xff,0x44,0xff,0x40,0x02,0xef,0x40,0x01,0xff,0xfd,0xbf,0xea,0x00,0xcc,
-0xf6,0x00,0x7f,0xfd,0xf7,0x3a,0xf4,0x6f,0xb1,0x00,0x0d,0xbf,0xaa,0x20,0x2f,0xdd,
-0xf4,0x00,0x05,0xf5,0x41,0x37,0x00,0x87,0x47,0x22,0x1f,0xa0,0xfc,0xb4,0xfd,0x09,
-0x11,0xfa,0x00,0x3c,0xfe,0xef,0xe6,0x10,0x00,0x1f,0xa0,0xcf,0xfc,0x11,0xbf,0xfc,
-0x00,0x01,0xfa,0x04,0xd5,0x00,0x00,0x4b,0x00,0x3b,0x00,0x7e,0x88,0xb0,0x19,0x90,
-0x00,0xbb,0x20,0x00,0xaf,0x20,0x0e,0xf2,0x01,0x0e,0x88,0xf1,0x03,0x20,0x08,0xf8,
-0x06,0xf9,0x00,0x5b,0xef,0xc7,0x9c,0xfb,0xbe,0xfd,0xa0,0x7f,0xff,0xfa,0xcf,0x87,
-0x39,0x21,0xbf,0x30,0x5d,0x0f,0xc0,0x00,0xff,0xb0,0x01,0x17,0xf8,0x11,0x00,0x05,
-0xff,0xf6,0x5f,0x01,0x01,0xb1,0x0a,0xff,0xee,0x3a,0xac,0xfd,0xaa,0x40,0x2f,0xff,
-0x66,0x1a,0x58,0x31,0xaf,0xcf,0x23,0x09,0x08,0xb2,0x69,0xaf,0x23,0xcc,0xcd,0xfe,
-0xcc,0xc1,0x01,0xaf,0x20,0x32,0x58,0x0c,0x08,0x00,0x05,0x87,0x13,0x42,0xf9,0x00,
-0x08,0xe4,0x0a,0x03,0x41,0x01,0xff,0x86,0x67,0x24,0x1f,0x10,0x9f,0x08,0x20,0x90,
-0x1b,0xcf,0xeb,0x7f,0xfa,0x66,0xbf,0xb0,0x01,0xf8,0x16,0x20,0xf4,0x5f,0x2e,0x48,
-0x31,0xe3,0x15,0x4f,0x10,0x17,0xf1,0x15,0xff,0xd0,0x05,0xdf,0xfe,0x61,0x00,0x01,
-0xff,0xdf,0xde,0xff,0xcb,0xff,0xfb,0x00,0x7f,0xfa,0x9f,0xfc,0x50,0x03,0xbf,0xb0,
-0x0e,0xdf,0x90,0x6d,0xaa,0xaa,0xaa,0x82,0x05,0xf8,0xf9,0x01,0x4c,0x01,0x50,0x1d,
-0x3f,0x90,0x1f,0xb0,0x46,0x33,0x41,0x22,0xf9,0x01,0xfb,0x1e,0x23,0x31,0x2f,0x90,
-0x1f,0xc9,0x05,0x87,0x02,0xf9,0x01,0xed,0x99,0x9a,0xea,0x00,0x89,0x03,0x11,0xbf,
-0xa8,0x3d,0x20,0x2f,0x90,0x89,0x4c,0x62,0xb3,0x19,0xaf,0xd9,0xcf,0x10,0x4a,0x48,
-0x20,0xcf,0x7f,0xae,0x2e,0xe0,0x8f,0xd4,0xcf,0x48,0xaf,0xc8,0x80,0x00,0xaf,0xf6,
-0xbf,0x10,0x3f,0x80,0xde,0x2e,0xf1,0x01,0xef,0x4f,0xff,0xff,0x90,0x08,0xff,0xac,
-0xcf,0x39,0xaf,0xd9,0x60,0x2f,0xcf,0x90,0x18,0x00,0xd0,0x3f,0x5f,0x90,0xbf,0x6a,
-0xbf,0xda,0xa0,0x06,0x2f,0x90,0xbf,0x9f,0xf1,0x02,0x10,0x2f,0x83,0x11,0x05,0x60,
-0x00,0x51,0xf8,0x00,0x2f,0x90,0x8a,0x8e,0x47,0x05,0x8e,0x1c,0x42,0x10,0x00,0x0c,
-0xd1,0x08,0x00,0x21,0x7f,0xf5,0x08,0x00,0x10,0x03,0x5d,0x2f,0xb0,0x6d,0xff,0xd4,
-0x3e,0xf4,0x3f,0xf7,0x00,0x8f,0xff,0xf9,0xd6,0x20,0xf0,0x03,0xc2,0x01,0xef,0x6f,
-0xff,0xaa,0xaa,0xde,0xf4,0x02,0xff,0xba,0x7a,0xff,0xff,0xf1,0x80,0x07,0x26,0x0c,
-0xf0,0x12,0x10,0x01,0x00,0x0d,0xff,0xca,0x8a,0x0a,0xd0,0x2f,0x80,0x4f,0xef,0x30,
-0x8f,0x07,0xf0,0x8f,0x20,0x8e,0xaf,0x10,0x4f,0x45,0xf3,0xeb,0x00,0x16,0x9f,0x10,
-0x1f,0x72,0x98,0x91,0x07,0x00,0x25,0x00,0x43,0xb0,0x00,0x00,0x9f,0x5e,0x2e,0x20,
-0x9f,0x16,0xf2,0x9e,0x00,0x57,0x8e,0x21,0x04,0xf7,0xcb,0xa5,0x10,0x12,0xe6,0x55,
-0xf0,0x06,0xe0,0x00,0xbf,0x12,0xac,0xfd,0xad,0xfb,0xa0,0x7f,0xff,0xf8,0x15,0xb6,
-0x28,0xb4,0x00,0x6d,0xff,0xd7,0xbf,0x61,0x13,0xf1,0x04,0x00,0xcf,0x20,0xbf,0x54,
-0x44,0xbf,0x40,0x01,0xff,0xc0,0xbf,0xee,0xee,0xff,0x40,0x06,0xff,0xf6,0x10,0x00,
-0x31,0x0b,0xff,0xcd,0x10,0x00,0xf2,0x04,0x3f,0xff,0x54,0x57,0x7d,0xf9,0x77,0x20,
-0xaf,0xcf,0x13,0x88,0x8e,0xf9,0x88,0x80,0x59,0xbf,0x17,0xea,0x47,0xf7,0x08,0xbf,
+0x00,0x10,0x00,0xc0,0x5c,0xd8,0xbf,0xe8,0x88,0x88,0x00,0x00,0x1d,0xf9,0xdf,0x60,
+0x40,0x00,0xf4,0x09,0x03,0xff,0xff,0x63,0x10,0x00,0x00,0x1a,0xdf,0xff,0xcf,0xff,
+0xff,0xee,0xe5,0x0a,0xfb,0x60,0x01,0x59,0xbc,0xef,0xf0,0x00,0x01,0x00,0xf0,0x3a,
+0x04,0xf8,0x00,0x00,0x6f,0x50,0x00,0x05,0x9b,0xfc,0x94,0x59,0xcf,0xb9,0x70,0x08,
+0xff,0xff,0xf7,0x9f,0xff,0xff,0xc0,0x00,0x05,0xf8,0x00,0x00,0x7f,0x50,0x00,0x1f,
+0xff,0xff,0xf9,0xdf,0xff,0xff,0xf5,0x08,0x9f,0xfe,0x85,0x7a,0xff,0xfa,0x82,0x00,
+0x9f,0xff,0xb1,0x2d,0xf9,0xfe,0x20,0x1b,0xfc,0x19,0xe5,0xff,0x80,0x6f,0xf5,0x0c,
+0xea,0x89,0xa8,0xdd,0x88,0x89,0xd1,0x00,0x4f,0x7f,0x00,0xa6,0xf7,0x00,0x00,0x4f,
+0x91,0x11,0x11,0x18,0xf7,0x00,0x10,0x00,0x40,0xb4,0x44,0x44,0x4a,0x08,0x00,0x44,
+0xd9,0x99,0x99,0x9c,0x18,0x00,0x40,0xe7,0x00,0x00,0x7f,0x08,0x00,0x97,0xf2,0x00,
+0x00,0x7f,0x96,0x66,0x66,0x6d,0xf2,0x10,0x00,0xf1,0x01,0x95,0x55,0x55,0x5d,0xf2,
+0x00,0x00,0x6d,0xdd,0xdd,0xdd,0xdd,0xd2,0x00,0x38,0x88,0x01,0x00,0x22,0x80,0x6f,
+0x20,0x01,0xa2,0xf1,0x00,0xfd,0x58,0xf9,0x56,0x66,0x66,0x20,0x00,0x98,0x00,0x90,
+0x90,0x00,0xfd,0x57,0xf9,0x4f,0x81,0xaf,0x30,0x10,0x00,0xf2,0x11,0x0a,0xf8,0xfa,
+0x00,0x03,0xfd,0x69,0xfe,0x41,0xff,0xf1,0x00,0x6f,0xff,0xfe,0xfd,0xae,0xfd,0xff,
+0xa1,0x14,0x21,0x03,0xf9,0x7a,0x30,0x39,0x90,0x00,0x00,0x02,0x84,0xf1,0x00,0x20,
+0x08,0xf9,0x06,0x00,0x94,0x0b,0xbb,0xbe,0xfd,0xbb,0xbb,0xbb,0xb1,0x1f,0x58,0x00,
+0x32,0x01,0xdf,0x50,0x1f,0x00,0x80,0xff,0xaa,0xaa,0xaa,0xa3,0x00,0x00,0x3f,0x17,
+0x00,0xc2,0xf5,0x00,0x03,0xff,0xfb,0x00,0x00,0x08,0xf5,0x00,0x3f,0xfc,0x10,0x00,
+0xa2,0x1e,0x93,0xfe,0xaa,0xaa,0xad,0xf5,0x00,0x02,0x03,0x18,0x00,0x22,0x00,0x03,
+0x18,0x00,0x60,0x00,0x03,0xfd,0x88,0x88,0x8c,0x08,0x00,0x51,0xfa,0x00,0x0a,0xce,
+0xf4,0x08,0x00,0x45,0x08,0xfe,0xa0,0x00,0x01,0x00,0x34,0xde,0x01,0xf9,0x08,0x00,
+0xf1,0x10,0x0b,0xff,0xff,0xf1,0x1d,0xff,0xdd,0xfe,0x9b,0xfb,0xbe,0xf1,0x1e,0xff,
+0xee,0xff,0xab,0xf0,0x0b,0xf1,0x00,0xde,0x13,0xf9,0x0b,0xf3,0x3c,0xf1,0x00,0xdf,
+0xff,0x20,0x00,0xf1,0x00,0x00,0xde,0x67,0xf9,0x0c,0xf6,0x6d,0xf1,0x00,0xdf,0x78,
+0xf9,0x0c,0xf0,0x0b,0x18,0x00,0xc0,0x0d,0xf7,0x7d,0xf1,0x00,0xde,0x02,0xfa,0x0e,
+0xff,0xff,0xf1,0x47,0x01,0xa0,0x9f,0xc1,0x1c,0xf1,0x29,0xcc,0x9a,0xc9,0x8f,0x90,
+0x20,0x00,0xf6,0x08,0x39,0xf5,0x7f,0x60,0x0c,0xf1,0x1c,0xf9,0x00,0xdf,0xef,0x17,
+0xcf,0xf0,0x09,0xa0,0x00,0x21,0x59,0x05,0xfe,0x70,0x00,0x01,0x00,0x2a,0x0f,0xf0,
+0x08,0x00,0x11,0x1f,0x08,0x00,0x13,0xef,0x38,0x02,0x6d,0xcd,0xdd,0xdf,0xfd,0xdd,
+0xdd,0x20,0x00,0x03,0x20,0x01,0x60,0xf2,0x1d,0xdd,0xdd,0xff,0xff,0x91,0x01,0x50,
+0x00,0x0a,0xff,0xff,0x90,0x1f,0x00,0xf0,0x09,0xbf,0xdf,0xfc,0xfb,0x00,0x00,0x00,
+0x4d,0xfb,0x1f,0xf0,0xbf,0xd4,0x00,0x3c,0xff,0xa0,0x0f,0xf0,0x0a,0xff,0xb2,0x2e,
+0xd4,0x40,0x00,0x32,0x5e,0xe1,0x02,0x48,0x00,0x1e,0x20,0x78,0x00,0x02,0x08,0x00,
+0x84,0x03,0x33,0x33,0x3f,0xf3,0x33,0x33,0x30,0xf8,0x02,0xf0,0x23,0x0b,0xbb,0xcf,
+0xff,0xff,0xfb,0xbb,0xb0,0x00,0x00,0x8f,0x8f,0xf9,0xf7,0x00,0x00,0x00,0x02,0xff,
+0x1f,0xf2,0xff,0x10,0x00,0x00,0x0a,0xf9,0x0f,0xf0,0xaf,0xa0,0x00,0x00,0x5f,0xe1,
+0x0f,0xf0,0x1f,0xf5,0x00,0x04,0xff,0x60,0x0f,0xf0,0x07,0xff,0x50,0x4f,0xfd,0x37,
+0x00,0xad,0xdf,0xf3,0x0c,0x85,0xee,0xef,0xfe,0xee,0x49,0x70,0x68,0x00,0x13,0x0d,
+0x0e,0x00,0x61,0x0d,0xf0,0x0a,0xff,0xff,0xf3,0x08,0x00,0xb0,0xfd,0xcf,0xf3,0x00,
+0x3c,0xcf,0xfc,0xaa,0xf3,0x0a,0xf3,0xdf,0x01,0x10,0xda,0x08,0x00,0x41,0x00,0x4f,
+0xf3,0x0a,0x08,0x00,0x31,0x9f,0xfd,0x1b,0x08,0x00,0x30,0xef,0xff,0xcb,0x08,0x00,
+0xf6,0x29,0x05,0xff,0xf9,0xfd,0xf2,0x0a,0xf3,0x00,0x0e,0xee,0xf1,0x6e,0xf0,0x0a,
+0xf3,0x00,0x6f,0x7d,0xf0,0x1f,0xd0,0x0a,0xf3,0x30,0x1d,0x0d,0xf0,0x6f,0x90,0x0a,
+0xf3,0xf4,0x01,0x0d,0xf0,0xcf,0x30,0x0a,0xf4,0xf5,0x00,0x0d,0xf7,0xfc,0x00,0x0a,
+0xfd,0xf3,0x00,0x0d,0xf2,0xc2,0x00,0x03,0xdf,0xa0,0x6e,0x01,0x14,0xd0,0x08,0x00,
+0x10,0x0b,0xe0,0x00,0xf0,0x05,0x00,0x0f,0xd0,0x0a,0xee,0xff,0xfe,0xe0,0x3b,0xbf,
+0xfb,0xa0,0x00,0xdf,0x30,0x00,0x5f,0xff,0xff,0xf0,0x08,0x00,0x41,0x00,0x4f,0xe0,
+0x00,0x08,0x00,0x22,0x8f,0xf9,0x08,0x00,0x20,0xef,0xff,0x0a,0x03,0xd1,0xf9,0x04,
+0xff,0xee,0xfe,0xee,0xff,0xee,0xe8,0x0d,0xff,0xd5,0x90,0x30,0x00,0x21,0x9f,0xd0,
+0x20,0x00,0x22,0x2e,0x1f,0x08,0x00,0x32,0x01,0x0f,0xd0,0x30,0x00,0x0c,0x08,0x00,
+0x33,0x00,0x02,0x30,0xf9,0x00,0x30,0xf9,0x00,0x01,0x08,0x00,0xf0,0x31,0xcf,0xff,
+0xff,0xff,0xb0,0x00,0x00,0x3d,0xff,0xa8,0x8a,0xff,0x70,0x00,0x08,0xff,0xaf,0xf6,
+0x5e,0xf8,0x00,0x00,0x01,0x82,0x04,0xff,0xff,0x80,0x00,0x00,0x03,0x58,0xcf,0xfe,
+0xdf,0xfe,0xa7,0x51,0x3f,0xff,0xfc,0x67,0x64,0xaf,0xff,0xf1,0x0b,0xa6,0x20,0x0f,
+0xf0,0x00,0x37,0x50,0x00,0x7a,0xaa,0xaf,0xfa,0xaa,0xa9,0x00,0x00,0xaf,0x68,0x01,
+0xf0,0x0d,0xfe,0x00,0x00,0x03,0xc5,0x0f,0xf0,0x4a,0x10,0x00,0x00,0x8f,0xe2,0x0f,
+0xf0,0x6f,0xe3,0x00,0x07,0xfb,0x16,0xaf,0xe0,0x04,0xfe,0x10,0x00,0x40,0x65,0x02,
+0x1d,0x43,0xe0,0x01,0x92,0x05,0xcc,0xcc,0xdf,0xfd,0xcc,0xcc,0x70,0x06,0xe0,0x01,
+0xe0,0x80,0x00,0x1b,0xa0,0x0f,0xf0,0x08,0xd5,0x00,0x00,0x0d,0xf3,0x0f,0xf0,0xda,
+0x04,0xf3,0x03,0x06,0xf7,0x0f,0xf0,0x6f,0x80,0x00,0x1c,0xcd,0xec,0xcf,0xfc,0xce,
+0xcc,0xc1,0x2f,0xff,0xff,0x01,0x04,0x41,0x1a,0xff,0xff,0xa1,0x60,0x02,0x22,0xbf,
+0xfb,0x60,0x02,0x62,0x0f,0xf0,0xbf,0xc3,0x00,0x2b,0x60,0x02,0x31,0xa1,0x2e,0xe5,
+0x60,0x02,0x30,0xe2,0x02,0x10,0x08,0x00,0xf0,0x10,0x01,0x30,0x00,0x1f,0xb0,0x00,
+0x00,0x00,0x38,0x50,0x00,0x1f,0xb0,0x06,0x8a,0xbe,0xff,0xf2,0x00,0x1f,0xb0,0x0f,
+0xff,0xfe,0xc8,0x40,0x09,0x9f,0xd9,0x3f,0xd2,0x8d,0x00,0x40,0xff,0xff,0x6f,0xd0,
+0xe7,0x04,0x20,0x7f,0xd4,0xcb,0x02,0xf5,0x3a,0xe0,0x00,0x8f,0xf5,0x0f,0xff,0xda,
+0xaf,0xc0,0x00,0xef,0xff,0x2f,0xce,0xd0,0x5f,0x80,0x04,0xff,0xcf,0x8f,0xa9,0xf3,
+0xbf,0x40,0x0c,0xcf,0xb4,0x4f,0x84,0xfb,0xfd,0x00,0x4f,0x6f,0xb0,0x8f,0x50,0xcf,
+0xf5,0x00,0x0b,0x1f,0xb0,0xcf,0x10,0x9f,0xf1,0x00,0x00,0x1f,0xb2,0xfc,0x1a,0xff,
+0xfe,0x30,0x00,0x1f,0xbb,0xfb,0xff,0xb1,0xaf,0xf8,0x00,0x1f,0xb5,0xc0,0xb6,0x00,
+0x06,0xd2,0xe8,0x01,0x24,0x1f,0x90,0x08,0x00,0x40,0x7b,0xbb,0xbb,0xb7,0x08,0x00,
+0x10,0xaf,0xf8,0x04,0x70,0x0b,0xbf,0xeb,0x13,0xfa,0x09,0xf3,0x80,0x00,0xf0,0x3c,
+0x13,0xf8,0x0c,0xf0,0x00,0x00,0x6f,0xc1,0x05,0xf7,0x1f,0xe9,0x81,0x00,0xaf,0xf6,
+0x06,0xf7,0x5f,0xff,0xf1,0x00,0xff,0xff,0x29,0xfd,0x00,0x1f,0xc0,0x06,0xff,0xbe,
+0x3c,0xff,0x50,0x7f,0x80,0x0d,0xdf,0x91,0x0f,0xef,0xe1,0xef,0x20,0x5f,0x7f,0x90,
+0x5f,0x87,0xfd,0xf9,0x00,0x0b,0x1f,0x90,0xbf,0x30,0xcf,0xf2,0x00,0x00,0x1f,0x94,
+0xfd,0x07,0xff,0xfe,0x50,0x00,0x1f,0xbe,0xf4,0xaf,0xf6,0x80,0x00,0x65,0xa7,0x90,
+0x2c,0x20,0x04,0xb0,0x80,0x00,0x10,0x8f,0x37,0x01,0x80,0xfa,0x00,0x00,0x8f,0xc9,
+0x9f,0xf9,0x9c,0x08,0x00,0x57,0x83,0x3f,0xf3,0x38,0xfa,0x18,0x00,0x40,0x94,0x4f,
+0xf4,0x49,0x08,0x00,0x46,0xca,0xaf,0xfa,0xac,0x18,0x00,0x00,0x1b,0x01,0x17,0xf1,
+0xe0,0x03,0xf0,0x13,0x1b,0xbb,0xbe,0xff,0xff,0xeb,0xbb,0xb1,0x00,0x01,0x9f,0xef,
+0xfd,0xfa,0x20,0x00,0x03,0x9e,0xfa,0x0f,0xf1,0x8f,0xfa,0x40,0x4f,0xfc,0x50,0x0f,
+0xf0,0x03,0xbf,0xf4,0x05,0x30,0x70,0x01,0x43,0x02,0x40,0x00,0x2f,0xf0,0x00,0x40,
+0x2f,0x90,0xcf,0xff,0x59,0x03,0xd1,0x2f,0x90,0x9b,0xbc,0xfe,0xbb,0xb2,0x0b,0xcf,
+0xeb,0x00,0x00,0xfb,0x70,0x01,0x91,0x5a,0xaa,0xfe,0xaa,0xa0,0x00,0x4f,0xa0,0x7f,
+0xf8,0x02,0xf2,0x27,0x9f,0xf3,0x7f,0x51,0xfa,0x0c,0xf0,0x00,0xef,0xfd,0x7f,0x42,
+0xfe,0x0c,0xf0,0x04,0xff,0xae,0xbf,0x47,0xff,0x6c,0xf0,0x0c,0xff,0x93,0x7f,0x5d,
+0xdc,0xdc,0xf0,0x2f,0x9f,0x90,0x7f,0xdf,0x66,0xff,0xf0,0x09,0x3f,0x90,0x7f,0x68,
+0x00,0x6c,0xf0,0x00,0x2f,0x90,0x7f,0x40,0x00,0x0c,0x08,0x00,0x22,0x07,0xbf,0x08,
+0x00,0x0b,0xc8,0x04,0x13,0xe0,0x40,0x04,0x44,0xe3,0x33,0x33,0x30,0xc0,0x00,0xf0,
+0x13,0x06,0x66,0x8f,0xff,0xff,0xf8,0x66,0x60,0x00,0x04,0xef,0x6f,0xe7,0xfe,0x40,
+0x00,0x03,0xaf,0xf6,0x0f,0xe0,0x7f,0xfb,0x40,0x4f,0xff,0x62,0x27,0x72,0x26,0xff,
+0xf3,0x0a,0x8b,0x27,0x00,0x91,0x96,0x60,0x00,0x0a,0xf5,0x22,0x22,0x8f,0x90,0xc7,
+0x04,0x01,0xc9,0x04,0x50,0x0a,0xf6,0x33,0x33,0x9f,0x08,0x00,0xf1,0x01,0xfe,0xdd,
+0xdd,0xef,0x90,0x00,0x00,0x05,0x77,0x77,0x77,0x77,0x40,0x00,0x0b,0xbb,0x01,0x00,
+0x14,0xb0,0xa0,0x04,0x33,0x00,0x1f,0xc0,0xe8,0x01,0xf0,0x02,0xc0,0x06,0xbb,0xbb,
+0xbb,0x50,0x00,0x1f,0xc0,0x08,0xff,0xff,0xff,0x70,0x28,0x9f,0xe8,0x38,0x06,0x00,
+0xd7,0x06,0x01,0xfc,0x03,0xb0,0x15,0xbf,0xe5,0x4b,0xbb,0xbb,0xbb,0xb6,0x00,0xdf,
+0xf8,0x9b,0x00,0xf0,0x2a,0xf8,0x02,0xff,0xff,0x60,0x02,0xfd,0x00,0x00,0x09,0xff,
+0xdc,0xa5,0x52,0xfc,0x27,0x00,0x2f,0xbf,0xc2,0x1d,0xe2,0xfc,0x6f,0x60,0x6f,0x5f,
+0xc0,0x2f,0x91,0xfc,0x1f,0xd0,0x08,0x1f,0xc0,0xaf,0x31,0xfc,0x0b,0xf3,0x00,0x1f,
+0xc1,0xfc,0x02,0xfc,0x07,0xf8,0x00,0x1f,0xc0,0x33,0xbf,0xfb,0x02,0x82,0x70,0x00,
+0x27,0x8f,0xd4,0xf6,0x00,0xe0,0x1f,0xb0,0x01,0x92,0x00,0x5b,0x40,0x00,0x1f,0xb0,
+0x04,0xfb,0x00,0xbf,0x08,0x00,0xc0,0x00,0xbf,0x32,0xfc,0x00,0x08,0x9f,0xd8,0x30,
+0x5c,0x39,0xf6,0x78,0x01,0x10,0x8f,0xc8,0x06,0xb2,0x04,0x7f,0xd4,0x4c,0xcc,0xcc,
+0xcc,0xc1,0x00,0x8f,0xf5,0x38,0x00,0x32,0xdf,0xfe,0x10,0x07,0x08,0xf2,0x01,0xdf,
+0x87,0xcc,0xcc,0xcc,0x40,0x0b,0xff,0xb7,0x09,0xff,0xff,0xff,0x60,0x4f,0x9f,0x43,
+0x02,0x22,0x0e,0x3f,0x08,0x00,0x34,0x02,0x1f,0xb0,0x68,0x00,0x11,0xef,0xb9,0x07,
+0x75,0x1f,0xb0,0xbc,0xcc,0xcc,0xcc,0xc5,0x80,0x00,0x60,0x01,0xfa,0x00,0x00,0x4e,
+0x90,0x21,0x00,0x50,0xa0,0x00,0x01,0xef,0x20,0x11,0x00,0x90,0x01,0x99,0x9d,0xe9,
+0x99,0x60,0x09,0xaf,0xea,0x8d,0x06,0xfd,0x51,0xfb,0x00,0xff,0xff,0xf4,0x29,0xa3,
+0x3b,0xa2,0x20,0x02,0x9f,0xc2,0x04,0xfe,0x10,0xdf,0x70,0x00,0x0c,0xff,0x44,0xff,
+0x40,0x02,0xef,0x40,0x01,0xff,0xfd,0xbf,0xea,0x00,0xcc,0xf6,0x00,0x7f,0xfd,0xf7,
+0x3a,0xf4,0x6f,0xb1,0x00,0x0d,0xbf,0xaa,0x20,0x2f,0xdd,0xf4,0x00,0x05,0xf5,0xfa,
+0x00,0x00,0x9f,0xfb,0x00,0x00,0x0c,0x1f,0xa0,0x00,0x09,0xff,0xb1,0x00,0x00,0x11,
+0xfa,0x00,0x3c,0xfe,0xef,0xe6,0x10,0x00,0x1f,0xa0,0xcf,0xfc,0x11,0xbf,0xfc,0x00,
+0x01,0xfa,0x04,0xd5,0x00,0x00,0x4b,0x20,0x00,0x01,0x00,0xf0,0x13,0xaf,0x20,0x19,
+0x90,0x00,0xbb,0x20,0x00,0xaf,0x20,0x0e,0xf2,0x01,0xff,0x10,0x00,0xaf,0x20,0x08,
+0xf8,0x06,0xf9,0x00,0x5b,0xef,0xc7,0x9c,0xfb,0xbe,0xfd,0xa0,0x7f,0xff,0xfa,0xa1,
+0x02,0xf0,0x06,0xd0,0x00,0xbf,0x30,0x00,0x06,0xf8,0x00,0x00,0x00,0xff,0xb0,0x01,
+0x17,0xf8,0x11,0x00,0x05,0xff,0xf6,0x5f,0x01,0x01,0xf1,0x04,0x0a,0xff,0xee,0x3a,
+0xac,0xfd,0xaa,0x40,0x2f,0xff,0x66,0x00,0x06,0xf7,0x00,0x00,0xaf,0xcf,0x23,0x09,
+0x08,0xb1,0x69,0xaf,0x23,0xcc,0xcd,0xfe,0xcc,0xc1,0x01,0xaf,0x20,0x18,0x00,0x1c,
+0x00,0x08,0x00,0x04,0x01,0x00,0x52,0x02,0xf9,0x00,0x08,0xe4,0x0a,0x03,0x50,0x01,
+0xff,0x86,0x67,0x40,0x11,0x00,0x00,0x85,0x09,0xf1,0x31,0x30,0x1b,0xcf,0xeb,0x7f,
+0xfa,0x66,0xbf,0xb0,0x01,0xff,0xff,0xfc,0xff,0xf4,0x5f,0xf2,0x00,0x00,0x9f,0xe3,
+0x15,0x4f,0xff,0xf4,0x00,0x00,0x0d,0xff,0xd0,0x05,0xdf,0xfe,0x61,0x00,0x01,0xff,
+0xdf,0xde,0xff,0xcb,0xff,0xfb,0x00,0x7f,0xfa,0x9f,0xfc,0x50,0x03,0xbf,0xb0,0x0e,
+0xdf,0x90,0x6d,0xaa,0xaa,0xaa,0x82,0x05,0xf8,0xf9,0x01,0x4c,0x01,0xe0,0x1d,0x3f,
+0x90,0x1f,0xb0,0x00,0x2f,0xb0,0x00,0x22,0xf9,0x01,0xfb,0x00,0x6c,0x08,0x31,0x2f,
+0x90,0x1f,0xc9,0x05,0x87,0x02,0xf9,0x01,0xed,0x99,0x9a,0xea,0x00,0x89,0x03,0x00,
+0x4a,0x0a,0x10,0xf4,0x08,0x00,0x90,0xcb,0xbb,0xbb,0xb3,0x19,0xaf,0xd9,0xcf,0x10,
+0x17,0x00,0xf1,0x1b,0xff,0xff,0xcf,0x7f,0xff,0xff,0xe0,0x04,0x8f,0xd4,0xcf,0x48,
+0xaf,0xc8,0x80,0x00,0xaf,0xf6,0xbf,0x10,0x3f,0x80,0x00,0x01,0xff,0xff,0xef,0x4f,
+0xff,0xff,0x90,0x08,0xff,0xac,0xcf,0x39,0xaf,0xd9,0x60,0x2f,0xcf,0x90,0x18,0x00,
+0xd0,0x3f,0x5f,0x90,0xbf,0x6a,0xbf,0xda,0xa0,0x06,0x2f,0x90,0xbf,0x9f,0xf1,0x02,
+0x46,0x2f,0x90,0xbf,0x10,0x60,0x00,0x95,0xf8,0x00,0x2f,0x90,0x8a,0xaa,0xaa,0xaa,
+0xa6,0x00,0x01,0x52,0x9f,0x10,0x00,0x0c,0xd1,0x08,0x00,0x21,0x7f,0xf5,0x08,0x00,
+0xf0,0x3c,0x03,0xff,0xff,0x50,0x00,0x6d,0xff,0xd4,0x3e,0xf4,0x3f,0xf7,0x00,0x8f,
+0xff,0xf9,0xff,0x70,0x04,0xff,0xc2,0x01,0xef,0x6f,0xff,0xaa,0xaa,0xde,0xf4,0x02,
+0xff,0xba,0x7a,0xff,0xff,0xf1,0x80,0x07,0xff,0xf6,0x00,0x00,0x10,0x01,0x00,0x0d,
+0xff,0xca,0x8a,0x0a,0xd0,0x2f,0x80,0x4f,0xef,0x30,0x8f,0x07,0xf0,0x8f,0x20,0x8e,
+0xaf,0x10,0x4f,0x45,0xf3,0xeb,0x00,0x16,0x9f,0x10,0x1f,0x72,0x98,0x91,0x07,0x00,
+0x25,0x00,0x61,0xb0,0x00,0x00,0x9f,0x18,0xff,0xb9,0x05,0x20,0x9f,0x16,0x91,0x03,
+0x60,0xa0,0x00,0xbf,0x10,0x04,0xf7,0xa9,0x07,0xf0,0x0b,0xbf,0x12,0xef,0xff,0xef,
+0xff,0xe0,0x00,0xbf,0x12,0xac,0xfd,0xad,0xfb,0xa0,0x7f,0xff,0xf8,0x15,0xb6,0x28,
+0xb4,0x00,0x6d,0xff,0xd7,0xb0,0x00,0xf1,0x05,0x40,0x00,0xcf,0x20,0xbf,0x54,0x44,
+0xbf,0x40,0x01,0xff,0xc0,0xbf,0xee,0xee,0xff,0x40,0x06,0xff,0xf6,0x10,0x00,0x31,
+0x0b,0xff,0xcd,0x10,0x00,0xf1,0x04,0x3f,0xff,0x54,0x57,0x7d,0xf9,0x77,0x20,0xaf,
+0xcf,0x13,0x88,0x8e,0xf9,0x88,0x80,0x59,0xbf,0x17,0xe9,0x03,0xf6,0x09,0x01,0xbf,
 0x10,0x03,0xdf,0xaf,0xc2,0x00,0x00,0xbf,0x16,0xbf,0xf7,0x06,0xff,0xb2,0x00,0xbf,
-0x17,0xd8,0x20,0x00,0x3a,0xa0,0x0e,0x32,0x40,0x04,0xf7,0x08,0xf3,0x08,0x00,0x53,
-0x7a,0xfb,0x7c,0xf9,0x50,0x8e,0x8a,0xf0,0x05,0xa0,0x3b,0xef,0xb4,0x26,0xf9,0x29,
-0xf5,0x10,0x5f,0xff,0xfb,0xbc,0xfd,0xbd,0xfc,0xb0,0x00,0xef,0x27,0x9a,0x08,0xd0,
-0xe1,0x03,0xff,0xa0,0x44,0x4b,0xf7,0x44,0x20,0x08,0xff,0xf5,0xcf,0x78,0x02,0xb1,
-0x0e,0xff,0xcd,0xdf,0x29,0xf4,0x7f,0x60,0x6f,0xdf,0x45,0x10,0x00,0xb0,0xac,0xaf,
-0x10,0xcf,0x29,0xf5,0x7f,0x60,0x35,0xaf,0x10,0x10,0x00,0x00,0xc1,0x26,0xf8,0x03,
-0x28,0xf7,0x29,0xe5,0x10,0x00,0xaf,0x13,0xbf,0xc2,0x04,0xef,0x80,0x00,0xaf,0x15,
-0xd5,0x00,0x4d,0x54,0x02,0x7c,0x12,0x00,0x36,0x10,0x21,0x0b,0xf1,0xbf,0x09,0xf0,
-0x1e,0xf1,0xee,0x00,0x00,0x0e,0xf7,0x77,0x87,0x3f,0xff,0xff,0xf5,0xee,0x70,0x0f,
-0xa7,0xfc,0xaa,0xef,0x3e,0xff,0x94,0xf7,0xdf,0x79,0x0c,0xe0,0xee,0xaf,0xdf,0x6f,
-0x9a,0xf2,0xf9,0x0e,0xe1,0xef,0xc0,0x41,0xaf,0x28,0x30,0xee,0x09,0xfa,0x33,0x2c,
-0xf0,0x10,0x0e,0xe1,0xff,0xf3,0x00,0xff,0x80,0x00,0xee,0xbf,0x9f,0xb0,0x3f,0xfe,
-0x00,0x0e,0xff,0xa0,0xdd,0x09,0xfc,0xf6,0x00,0xee,0x61,0x01,0x03,0xfd,0x0e,0xf2,
-0x0e,0x58,0x09,0xa3,0x50,0x5f,0xe2,0xbc,0xcc,0xcc,0xce,0x90,0x00,0x8c,0x6e,0x13,
-0x01,0x34,0x6b,0x03,0xfe,0x84,0x0f,0x08,0x00,0x03,0x25,0x7f,0x80,0x08,0x00,0x40,
-0xfe,0xcc,0xcc,0x50,0x08,0x00,0x00,0xd0,0x00,0x00,0x08,0x00,0x39,0xfa,0x22,0x22,
-0x20,0x00,0x0f,0x08,0x00,0x01,0x93,0x01,0x8f,0x91,0x18,0xfa,0x11,0x11,0x10,0x8f,
-0x91,0x0b,0x12,0x6c,0xe2,0x0e,0x23,0xc1,0x06,0x89,0x05,0x15,0x08,0x8d,0x81,0x32,
-0x11,0x18,0xf9,0x17,0xa5,0x22,0x06,0xf8,0xf4,0x51,0x02,0x08,0x00,0x43,0x2f,0xc0,
-0x06,0xf9,0x08,0x00,0x00,0xd1,0x0a,0x00,0x08,0x00,0x31,0xfe,0xcc,0xcc,0x08,0x00,
-0x04,0x20,0x00,0x0a,0x08,0x00,0x11,0xd0,0x78,0x00,0x0c,0xca,0xa1,0x00,0x60,0x06,
-0x02,0xc1,0x3c,0x0b,0x08,0x00,0x12,0x54,0x08,0x00,0x20,0x01,0xfc,0x08,0x00,0xf2,
-0x02,0x3e,0x50,0x01,0xfc,0x0f,0xfc,0x9e,0xf8,0xff,0xd0,0x01,0xfc,0x0f,0xff,0xbe,
-0xff,0xe6,0x18,0x00,0x14,0xf8,0x20,0x00,0x0c,0x08,0x00,0x22,0x01,0x20,0x08,0x00,
-0xa0,0x04,0xf6,0x01,0xfd,0x6f,0xfd,0xad,0xf1,0x06,0xf6,0x2e,0x35,0xd7,0xac,0xfe,
-0xdf,0xf2,0x1f,0xfc,0x96,0x30,0x04,0xef,0xff,0x80,0x02,0xee,0x33,0x12,0xf6,0x37,
-0x69,0x22,0x0a,0xf6,0x4f,0x09,0x01,0x53,0x7a,0x00,0x08,0x00,0x31,0xfd,0xbb,0xbb,
-0x08,0x00,0x1a,0xf6,0xbd,0x84,0x21,0xdf,0xfd,0xbd,0x84,0x50,0x94,0x0d,0xf2,0x00,
-0x62,0x4f,0x27,0xc0,0x0d,0xf2,0x04,0xff,0x10,0x01,0xcf,0xd0,0x0d,0xf2,0x2e,0xf6,
-0xce,0x22,0x20,0x0d,0xf7,0x9c,0x06,0x32,0x80,0x00,0x0a,0x8c,0xa1,0x20,0x26,0xcf,
-0x5d,0x58,0x51,0x19,0xcf,0xff,0xfd,0x71,0x6e,0x2c,0x28,0xc9,0x40,0x6a,0x1d,0x05,
-0xf1,0x0b,0x20,0xde,0xff,0x59,0x00,0x10,0xd2,0x8e,0x00,0x22,0x0e,0xf0,0x2f,0x92,
-0x22,0x0e,0xf0,0x42,0x12,0xb0,0x6e,0xf0,0x1b,0x20,0x01,0xef,0xcc,0xef,0x5e,0xf3,
-0xef,0x92,0xac,0xf0,0x01,0xdf,0x1e,0xff,0xf8,0x00,0x4f,0xda,0x63,0xfc,0x0e,0xfd,
-0x30,0x00,0x04,0x3e,0xfe,0x1d,0x22,0x00,0xef,0x3b,0x32,0xd0,0x0e,0xf0,0x6e,0x65,
-0xf1,0x00,0x0e,0xf0,0x05,0xb2,0x00,0x5f,0xf7,0x00,0x0e,0xf1,0x07,0xf4,0x1c,0xff,
-0x80,0xaa,0x2f,0x8a,0x08,0xd4,0x00,0x00,0x03,0xac,0xcb,0x50,0xff,0x31,0x01,0xd8,
-0x00,0xb2,0xf3,0xc5,0xcf,0x00,0x00,0x1b,0xef,0xcb,0xb6,0xf5,0xcf,0x85,0x8a,0xd0,
-0xff,0xff,0xfe,0xd0,0x00,0xff,0xaa,0x8f,0xfe,0xff,0xfe,0xd0,0x04,0x55,0x02,0x20,
-0xcf,0x00,0x25,0x56,0x30,0xba,0x00,0xcf,0x90,0x07,0x20,0x3f,0xac,0xc0,0x44,0x40,
-0x8f,0x8e,0xaf,0x7f,0x83,0x10,0x31,0x2b,0x5f,0xfe,0xc9,0x1a,0x00,0xc1,0x0e,0x30,
-0xcf,0xff,0xfc,0xf2,0x36,0xf1,0x08,0x1b,0xf8,0xcf,0x7f,0xa0,0x02,0xcf,0x53,0xef,
-0xa0,0xcf,0x0c,0xf8,0x2f,0xf8,0x00,0xb7,0x00,0xcf,0x01,0xa1,0x06,0x40,0x70,0x00,
-0x00,0x80,0x51,0x02,0x84,0x00,0x30,0x4a,0xff,0xf2,0x0c,0x50,0x71,0x01,0xff,0xc6,
-0x00,0xaf,0xaa,0xfa,0x4c,0x71,0x00,0xe9,0x90,0x70,0x01,0xfe,0xbb,0x80,0xed,0x01,
-0xfa,0x38,0x05,0x70,0xc5,0xf9,0x00,0xfd,0x73,0x01,0xfb,0xee,0x15,0xd0,0x8e,0xe7,
-0x01,0xfe,0x99,0x78,0xa6,0x66,0x67,0x30,0x01,0xff,0xff,0xc7,0x3b,0x00,0x66,0x4e,
-0xe0,0x02,0xdc,0x22,0xbf,0x50,0x02,0xfc,0x69,0xb0,0x8f,0x65,0xfe,0x00,0x4f,0x95,
-0x48,0x50,0xfe,0xf4,0x00,0x2c,0xfd,0x5c,0x9c,0x10,0xd1,0x50,0x00,0xd3,0x39,0xef,
-0xfe,0xff,0xa4,0x01,0xfb,0x00,0x3f,0xf9,0x10,0x8e,0xf3,0x5e,0x88,0x13,0x20,0xe6,
-0x22,0x22,0x01,0xfe,0x5e,0x42,0x21,0x1f,0xe0,0x8e,0x14,0x02,0x0f,0x00,0x12,0x03,
-0x0f,0x00,0x21,0x02,0xf9,0x0f,0x00,0xc0,0x22,0xef,0xf2,0x1f,0xfd,0xdd,0x7d,0xf5,
-0xef,0xd2,0x01,0xff,0x45,0x43,0x11,0xb1,0x1e,0x00,0x22,0xff,0x60,0x2d,0x00,0x14,
-0x30,0x3c,0x00,0x12,0x20,0x3c,0x00,0xff,0x12,0x09,0xd2,0x1f,0xe0,0x38,0x4d,0xf2,
-0x00,0xaf,0x33,0xff,0xef,0xf6,0xcf,0x20,0x0d,0xf1,0xaf,0xff,0xc7,0x1a,0xff,0xde,
-0xfd,0x07,0xf9,0x30,0x00,0x2d,0xff,0xfd,0x30,0x01,0xf3,0x4e,0x0d,0x01,0x08,0x00,
-0x90,0x97,0x00,0x0d,0xdd,0xdd,0x5f,0xf3,0x07,0xff,0xa9,0x0d,0x40,0x5f,0xfa,0x6f,
-0xf4,0x52,0x08,0x40,0x1f,0xff,0xfe,0x30,0xc6,0x41,0x11,0x0f,0x2c,0x26,0x51,0x09,
-0xf7,0x0f,0xfb,0xf9,0xdd,0x58,0x40,0x0f,0xf2,0xef,0x70,0x35,0xbb,0xf1,0x0b,0x0f,
-0xf1,0x3f,0xf9,0x10,0x1c,0xfd,0x00,0x0f,0xf1,0x06,0xff,0xe4,0x3e,0xe2,0x01,0x2f,
-0xf1,0x00,0x5e,0xe2,0x03,0x20,0x2f,0xff,0xe0,0x02,0x5c,0x11,0x0c,0x34,0x55,0x00,
-0x19,0x3b,0x20,0x02,0xfa,0x02,0x1e,0x11,0xc1,0x08,0x00,0x61,0x00,0x6e,0xe0,0xdf,
-0x02,0xfa,0x10,0x70,0x41,0xdf,0x02,0xfb,0x7e,0xbf,0x19,0x10,0x05,0x73,0x52,0xf0,
-0x07,0xa2,0x00,0xdf,0xef,0xff,0x7e,0xe0,0x2d,0xff,0x5b,0xff,0xfd,0xfa,0x0e,0xe0,
-0x00,0x7a,0x2f,0xff,0x22,0xfa,0x0e,0x65,0xac,0xf0,0x11,0xdf,0x02,0xfa,0x0f,0xd0,
-0x00,0x08,0x90,0xdf,0x02,0xfb,0xef,0xb0,0x00,0x1f,0xf1,0xdf,0x02,0xfa,0xbb,0x30,
-0x00,0x9f,0x80,0xdf,0x00,0x10,0x04,0xc4,0x02,0xff,0x10,0xa3,0x19,0xe0,0xf5,0x0b,
-0xf8,0x00,0xaf,0xdc,0xbb,0xcf,0xf1,0x01,0xa0,0x00,0x2c,0xff,0x73,0xa5,0x13,0x10,
-0xf8,0x10,0x20,0xfa,0x20,0xa0,0xac,0x00,0xf5,0xbd,0xc2,0x0f,0xfc,0xcf,0xf0,0x00,
-0x00,0x06,0x60,0x1f,0xc0,0x0e,0xf0,0xf6,0x88,0xf1,0x07,0x0d,0xf4,0x42,0x1d,0x81,
-0x1b,0xfe,0x10,0x0a,0xff,0xf6,0x3d,0xff,0x39,0xc2,0x00,0x01,0x68,0x73,0x00,0x7b,
-0x05,0xbd,0x5a,0x01,0xae,0x1f,0x00,0xee,0x27,0x41,0x08,0x90,0xaf,0x50,0xa5,0xae,
-0x50,0xe0,0x2f,0xe3,0x5f,0xf3,0xb2,0x4c,0x11,0x05,0x2f,0xbe,0x10,0xfe,0xed,0x71,
-0xf0,0x01,0x60,0x00,0x0c,0xf6,0x3b,0xef,0xfc,0xcf,0xff,0xc4,0x04,0xc0,0x1f,0xfa,
-0x40,0x04,0x5c,0x53,0x03,0x7c,0x70,0x10,0x66,0x2b,0x48,0x00,0xb1,0x13,0x11,0xc2,
-0x08,0x00,0x00,0xcd,0x58,0x11,0x0a,0xb9,0x97,0x13,0xc3,0x88,0x99,0x11,0x01,0xd8,
-0x03,0xf2,0x04,0x05,0x71,0x01,0xfe,0xce,0xfc,0xcf,0xf1,0x0d,0xff,0x71,0xfb,0x0a,
-0xf2,0x0c,0xf1,0x00,0x6e,0x61,0x08,0x00,0xa2,0x01,0x01,0xff,0xdf,0xfe,0xdf,0xf1,
-0x00,0x01,0x21,0xb9,0x10,0x22,0x0a,0xf4,0x18,0x00,0x22,0x3f,0xd1,0x08,0x00,0xa2,
-0xdf,0x51,0xfe,0xae,0xfb,0xae,0xf1,0x06,0xfd,0x01,0x20,0x00,0x76,0x84,0x01,0xfb,
-0x22,0x22,0x2b,0xe1,0xdb,0x62,0x00,0xf8,0x00,0x00,0x7d,0x8a,0x50,0xf3,0x0f,0xfc,
-0xcc,0xfa,0x85,0xa9,0x10,0x1f,0xd9,0xac,0x01,0xae,0x17,0x40,0x02,0xfa,0x00,0x0c,
-0x6a,0x9b,0x60,0x02,0xfb,0x00,0x3e,0xfe,0x5c,0x2b,0xb8,0xd0,0xe7,0x00,0x9e,0x2c,
-0xc1,0x00,0x00,0x49,0x94,0x00,0x01,0x01,0x9b,0xd5,0xa5,0x41,0x00,0x04,0x90,0xcf,
-0x5a,0x14,0x40,0x0d,0xf3,0xcf,0x10,0x3c,0x33,0x31,0x8f,0xb0,0xcf,0x3b,0x00,0x21,
-0xff,0x20,0x10,0x00,0x10,0x0d,0x77,0x03,0x00,0x65,0xbf,0x96,0xe1,0x00,0xcf,0xbb,
-0xbb,0xce,0x90,0x00,0x20,0xa5,0x3b,0x20,0x0b,0xf2,0x0f,0x04,0x11,0xa1,0x08,0x00,
-0x00,0xa1,0x0a,0x11,0x0c,0x06,0x03,0x01,0x35,0x63,0x00,0xe1,0x0b,0x00,0x08,0x46,
-0x32,0x50,0x0b,0x92,0x28,0x00,0x00,0x7a,0x4d,0x01,0x20,0x00,0x23,0x6d,0x18,0xbf,
-0x38,0x90,0x06,0xbb,0xef,0xeb,0xbb,0xb0,0x00,0x02,0xb0,0xf6,0x33,0x00,0x26,0x05,
-0x40,0x05,0xfb,0x04,0xb1,0xd4,0x8b,0x31,0x0d,0xf3,0x06,0x8b,0x51,0x81,0x8f,0xc3,
-0x57,0xff,0x50,0x08,0xfc,0x02,0x68,0x45,0xa2,0x04,0xe3,0x00,0xcc,0xa8,0x64,0x2c,
-0xf2,0x00,0x10,0x25,0x06,0x22,0x01,0xa3,0xee,0x8a,0x00,0x98,0x72,0x02,0xc8,0x04,
-0x92,0x96,0xaa,0xaf,0xfa,0xab,0x91,0x00,0x02,0x09,0x68,0x46,0xf1,0x0b,0x00,0x09,
-0xf4,0x1f,0xf1,0x5f,0x90,0x4f,0xc3,0x09,0xf3,0x0e,0xf0,0x6e,0x30,0x3c,0xfe,0x09,
-0xfb,0x9f,0xf9,0xa8,0x00,0x00,0x64,0x0a,0x0e,0x38,0x00,0xce,0x3d,0x10,0xf3,0xf1,
-0x9d,0x50,0x2d,0x3d,0xf3,0xfc,0x0d,0x95,0x1e,0xf5,0x17,0x6e,0xe0,0x9f,0xbf,0xb0,
-0x00,0x01,0xfe,0x3f,0xb0,0x1e,0xff,0x20,0x00,0x0a,0xf7,0x7f,0x60,0x8f,0xff,0xa1,
-0x00,0x3f,0xf1,0xef,0x9e,0xfe,0x7d,0xff,0xb1,0x08,0x81,0xb9,0x5f,0xa1,0x00,0x8e,
-0x90,0xbf,0x23,0x52,0x51,0x00,0x00,0x17,0x80,0xf7,0x43,0x01,0xda,0x13,0x22,0x6e,
-0xf3,0x56,0x2b,0x51,0x01,0x55,0xcc,0xcd,0xec,0x64,0x72,0x02,0xdb,0x55,0x12,0xa2,
-0x47,0x1a,0x00,0x00,0x01,0x01,0x4f,0x1a,0x24,0x8e,0x10,0x5f,0xa7,0x00,0x58,0x01,
-0x00,0x80,0x01,0x50,0xad,0xdf,0xfe,0xdd,0x60,0xfa,0x5f,0x01,0x18,0x00,0x21,0x6f,
-0xb0,0x08,0x00,0x00,0x94,0x0b,0x20,0x09,0xf6,0x30,0x11,0x10,0x0c,0x21,0x6f,0x42,
-0xd6,0x06,0xe1,0x0e,0x93,0x15,0x15,0x10,0xd2,0x2f,0x02,0x75,0x6b,0x41,0xdd,0x40,
-0x1f,0xf1,0xe6,0x02,0x21,0xf7,0x8f,0x51,0x0a,0x70,0x04,0xd7,0xff,0xa9,0x99,0xef,
-0x80,0xd0,0x1d,0xb0,0xb0,0x08,0xfe,0x00,0x06,0x81,0x05,0x48,0xfd,0xaf,0xe2,0x59,
-0x04,0xf2,0x11,0x01,0xcf,0xff,0x71,0x00,0x00,0x7f,0x57,0xcf,0xff,0xcf,0xff,0xc7,
-0x00,0x01,0x1e,0xfd,0x60,0x02,0x9e,0xf9,0x00,0x00,0xb7,0xeb,0xbb,0xbb,0xbb,0xa1,
-0x00,0x07,0xfb,0x62,0x16,0x22,0x1e,0xf4,0xd7,0x16,0x31,0x9f,0x82,0xfa,0x7c,0x99,
-0x31,0xfe,0x12,0xff,0x66,0x42,0x77,0xe7,0x02,0xfe,0x99,0x99,0xbf,0xa0,0x80,0x00,
-0x02,0x60,0x13,0xa1,0xfa,0x10,0x9f,0x21,0xfa,0x08,0xf4,0x01,0xaf,0x80,0x08,0x00,
-0x31,0x00,0x04,0x00,0x08,0x00,0x22,0x02,0x00,0x08,0x00,0xf0,0x07,0x2f,0xd4,0x1e,
-0xef,0xa4,0xff,0xc8,0xf4,0x1a,0xfe,0x6f,0xdf,0xfc,0xff,0xfe,0xf4,0x00,0x44,0xaf,
-0xcf,0xdf,0xfc,0x3e,0x0b,0xb0,0xf9,0xcf,0x6e,0xfa,0xae,0xf4,0x00,0x69,0x32,0xee,
-0x01,0x38,0x00,0x40,0xcf,0x20,0xfc,0x01,0x38,0x00,0x30,0xfc,0x04,0xfa,0x08,0x00,
-0x40,0x08,0xf6,0x0a,0xf5,0x08,0x00,0x40,0x0e,0xf1,0x2f,0xe0,0x08,0x00,0x8a,0x07,
-0xa0,0x2a,0x60,0x00,0xb8,0x08,0xf4,0xe5,0x7b,0xf0,0x02,0x43,0x00,0x06,0xfa,0x10,
-0x14,0x68,0xbf,0xfe,0x30,0x04,0xdf,0xe3,0xff,0xff,0xfd,0x94,0x0a,0x74,0x33,0x87,
-0x5c,0xf2,0x79,0x07,0x10,0xf2,0xad,0x40,0x10,0x0c,0xb4,0x50,0x41,0xd2,0x4f,0xfd,
-0x2e,0xbf,0x39,0x22,0x01,0xac,0x18,0x00,0x03,0x20,0x00,0x00,0xa4,0xb9,0x11,0xef,
-0xd8,0x08,0xc0,0x4f,0xd0,0xee,0xaa,0xaa,0xdf,0x60,0x00,0xdf,0x40,0xec,0x00,0xfb,
-0x30,0x21,0xfb,0x00,0x08,0x00,0x41,0x2f,0xf3,0x00,0xef,0x60,0x0c,0x77,0x90,0x00,
-0xef,0xbb,0xbb,0xce,0x50,0xd7,0x9b,0x01,0x81,0x01,0x31,0x07,0xfb,0x20,0xc2,0x0e,
-0xb4,0x03,0xcf,0xd8,0xaa,0xae,0xfb,0xaa,0xa0,0x00,0x08,0x4d,0x2a,0x19,0xe0,0x09,
-0xf9,0x06,0xf5,0x00,0x1e,0xa3,0x02,0x9f,0xe6,0x79,0xff,0x30,0x2b,0x46,0xc1,0x00,
-0xc0,0x0c,0xf0,0x07,0x4a,0x03,0x86,0x53,0x21,0x07,0x90,0x00,0x01,0x00,0xae,0x0e,
-0x95,0xe5,0x00,0x00,0x0a,0xa0,0xbf,0x0f,0xa5,0xf6,0x4d,0x1c,0x11,0xcf,0x08,0x00,
-0xfd,0x10,0xcf,0x50,0xfd,0x0f,0xa5,0xf6,0x40,0x06,0xfc,0x07,0xf8,0x0f,0xa5,0xf6,
-0xc7,0x1f,0xf4,0x5f,0xf1,0x0f,0xa4,0xfb,0xe6,0x06,0xa0,0x2e,0x40,0x07,0x41,0xcf,
-0xd1,0x80,0x44,0x11,0xd5,0xb3,0x09,0xf2,0x14,0xf0,0x0a,0xff,0xaf,0xff,0xff,0x80,
-0x07,0xf0,0x03,0xbf,0x6f,0x85,0x5f,0x8a,0xc7,0xf0,0x00,0x03,0x1f,0x5b,0x4e,0x8a,
-0xc7,0xf0,0x02,0x00,0x1f,0x5f,0x5e,0x8a,0xc7,0xf0,0x2f,0xd4,0x08,0x00,0x31,0x1a,
-0xfe,0x2f,0x08,0x00,0x32,0x00,0x54,0x1f,0x08,0x00,0x13,0x00,0x08,0x00,0x13,0x57,
-0x18,0x00,0x31,0xbf,0x4f,0x6f,0x38,0x00,0xf7,0x0e,0xfc,0x1c,0x9f,0x29,0x68,0x97,
-0xf0,0x09,0xf6,0x01,0xed,0xc6,0x00,0x07,0xf0,0x1f,0xf1,0x4d,0xf2,0x6f,0x54,0x8d,
-0xf0,0x05,0x80,0x5c,0x20,0x09,0x64,0xc1,0x0f,0xf1,0x0c,0xa2,0x00,0x21,0x0d,0xf1,
-0x05,0x00,0x8f,0xf6,0x4f,0xa0,0xdf,0x14,0xfb,0x00,0x8f,0xe1,0xdf,0x2d,0xf1,0xaf,
-0x40,0x00,0x54,0x07,0xf7,0xdf,0xfa,0x51,0x71,0x26,0x0d,0xf2,0x33,0x01,0xda,0x10,
-0x2d,0x4e,0xc2,0x2c,0xfe,0x30,0xff,0xbb,0xbb,0xef,0x30,0x08,0xd0,0x0f,0xe0,0x1e,
-0x05,0x02,0x7c,0x05,0xf1,0x02,0x75,0x0f,0xf8,0x88,0x8d,0xf3,0x00,0x1f,0xd0,0xff,
-0x88,0x88,0xdf,0x30,0x0a,0xf5,0x0f,0x91,0x9b,0x30,0xfd,0x00,0xfe,0x54,0x53,0xe5,
-0xdf,0x50,0x0f,0xd0,0x06,0xcf,0xf2,0x02,0xa0,0x00,0xfd,0x00,0x3f,0xe9,0x05,0x42,
-0x32,0x01,0xed,0x32,0x3d,0x00,0x30,0x9f,0xf6,0xfd,0x36,0x00,0x83,0x00,0x05,0x92,
-0xfc,0x77,0x77,0xcf,0x30,0xcf,0x64,0x50,0x30,0x04,0x81,0x02,0xfa,0x3f,0x00,0x32,
-0x0d,0xfe,0x52,0x28,0x00,0x62,0x7e,0x21,0xdb,0x77,0xbc,0x77,0x5f,0x79,0xf9,0x24,
-0xbf,0x12,0x30,0x00,0x03,0xc2,0xfe,0xaa,0xcf,0x8f,0xf2,0x00,0x0c,0xf6,0xff,0xff,
-0xcf,0xfd,0x60,0x00,0x6f,0xc1,0xfc,0x00,0xcf,0x50,0x10,0x01,0xef,0x32,0xfc,0x24,
-0xbf,0x11,0xf6,0x0a,0xf9,0x0a,0xff,0xff,0xbf,0xbc,0xf6,0x02,0xc1,0x07,0xfc,0x84,
-0x4e,0xff,0xc1,0x50,0x9f,0x01,0xd1,0x14,0x12,0x96,0xc9,0x04,0x20,0x5e,0xc4,0x1c,
-0xac,0x10,0xb0,0xcd,0x24,0x20,0x8f,0x70,0x1e,0x04,0x91,0x1b,0xbb,0xef,0xcb,0xbb,
-0xb6,0x0d,0xd5,0x2f,0x17,0x31,0x50,0x18,0xfd,0x00,0x4f,0xf3,0xbb,0xa7,0xf2,0x2a,
-0x12,0x05,0xff,0xa9,0x21,0xdf,0xb3,0x00,0x03,0x6f,0xf5,0x6f,0x40,0x1d,0xf7,0x00,
-0x3f,0x79,0xa8,0x6f,0x77,0x8f,0x60,0x00,0x9f,0x51,0xfb,0x6f,0xcf,0x5f,0xb0,0x00,
-0xfe,0x0a,0xf4,0x6f,0x6f,0x8a,0xf2,0x07,0xf9,0x1d,0xa0,0x6f,0x4d,0x93,0xf6,0x0a,
-0xf3,0x00,0x1a,0xdf,0x41,0x00,0x10,0x00,0x50,0x36,0x31,0x05,0xb9,0x0f,0x00,0xa8,
-0xad,0x10,0x90,0x18,0x0a,0x81,0x1b,0xbb,0xcf,0xdb,0xbb,0x50,0x05,0xff,0xe2,0xa8,
-0x84,0x60,0x00,0x2b,0x03,0x55,0x8f,0xb5,0x55,0x17,0x90,0xc2,0x00,0x2d,0x50,0x35,
-0x55,0x9f,0xb5,0x55,0x50,0x5f,0xfb,0xaf,0xad,0x5d,0x21,0xc6,0x03,0x67,0x36,0x01,
-0x57,0x8e,0x00,0xd4,0x2a,0x50,0x2b,0x17,0xf8,0x55,0x55,0x87,0x97,0xf2,0x01,0x67,
-0xff,0xee,0xee,0xfd,0x00,0x02,0xfe,0x07,0xf8,0x44,0x44,0xfd,0x00,0x0a,0xf7,0x20,
-0x00,0xc0,0x1e,0xf1,0x07,0xf4,0x00,0x7a,0xfd,0x00,0x01,0x50,0x07,0xf4,0x33,0x23,
-0x31,0x00,0x20,0x00,0xe6,0xb2,0xf0,0x08,0x04,0xfc,0x20,0xfa,0x00,0x15,0xaf,0xd0,
-0x02,0xbf,0xec,0xfe,0xbb,0x8f,0xfc,0x71,0x00,0x06,0x5f,0xff,0xfe,0x8f,0x20,0xb7,
-0x42,0x30,0xf6,0x50,0x8f,0xbb,0x0c,0xf0,0x2f,0x0a,0xdd,0xd0,0x8f,0xdd,0xd5,0x09,
-0xff,0x3e,0x8d,0xd0,0x8f,0xff,0xf6,0x00,0x36,0x6f,0xff,0xfe,0x9f,0x0e,0xa0,0x00,
-0x00,0x2d,0xcf,0xfb,0xaf,0x0e,0xa0,0x00,0x3a,0x10,0x0d,0xd2,0xbe,0x0e,0xa0,0x00,
-0x9f,0x75,0x8f,0xff,0xdd,0x0e,0xa0,0x00,0xee,0x6f,0xff,0xe6,0xfc,0x0e,0xa0,0x06,
-0xf9,0x16,0x2d,0xd3,0xf8,0x0e,0xa0,0x5f,0x75,0xc8,0xd8,0xf4,0x0e,0xa0,0x04,0xa0,
-0x00,0x0d,0xd3,0xc0,0x0e,0xa0,0x36,0x83,0x02,0x16,0x42,0x11,0x42,0xa0,0x00,0xe1,
-0x01,0x9f,0xe3,0xfd,0x88,0x89,0xfd,0x00,0x00,0x04,0x52,0xfc,0x66,0x67,0x8f,0x43,
-0x01,0x18,0x00,0x40,0x2d,0x70,0x02,0xfa,0xba,0x4a,0x32,0x5e,0xfe,0x12,0xe8,0x00,
-0x10,0x9a,0xc1,0x82,0x10,0x76,0x2b,0x07,0x10,0x88,0xef,0x3c,0x32,0x00,0x1c,0x2a,
-0x37,0x3e,0xf2,0x02,0x8f,0x7a,0xf2,0xf5,0xca,0x7f,0x50,0x01,0xfe,0x0a,0xf1,0xf5,
-0xba,0x6f,0x50,0x09,0xf7,0x08,0x00,0xa1,0x2f,0xe0,0x9e,0xfb,0xfc,0xee,0xdf,0xc2,
-0x09,0x80,0xe1,0x4d,0x06,0x71,0x04,0x00,0xd4,0x69,0xa0,0x13,0x00,0x00,0x06,0xe6,
-0x04,0xfd,0x00,0x8f,0x60,0x02,0xb3,0xa1,0xce,0x30,0xcf,0x97,0x73,0x00,0x29,0xdf,
-0xff,0xfd,0x1b,0x19,0xf1,0x0c,0xae,0xfc,0xbe,0xfa,0x55,0x52,0x0b,0x81,0x0b,0xf0,
-0x0a,0xfa,0x88,0x80,0x2c,0xfd,0x0d,0xfb,0xb7,0x8f,0xff,0xf3,0x00,0x63,0x0e,0xff,
-0xf9,0x05,0x5e,0x30,0x0f,0xc2,0xf9,0x76,0x11,0x40,0x87,0x0f,0x92,0xfa,0x30,0x00,
-0xf5,0x17,0xee,0x4f,0x63,0xf9,0xbc,0xfe,0xb5,0x04,0xf9,0x8f,0x34,0xf6,0x01,0xf9,
-0x00,0x0b,0xf5,0xee,0x07,0xf5,0x01,0xf9,0x00,0x2f,0xe9,0xf8,0xbe,0xf2,0x8a,0xf9,
-0x00,0x07,0x73,0xc0,0xde,0x90,0xaf,0xe3,0x9e,0x21,0x00,0xf8,0x01,0x20,0x0b,0xc0,
-0xb9,0x76,0x92,0x07,0x77,0x7e,0xf9,0x77,0x71,0x03,0xfe,0x1e,0x90,0x3e,0x70,0x99,
-0x03,0x98,0xf6,0x9f,0x59,0x10,0x10,0x48,0xf2,0x08,0xf5,0x8f,0x6f,0xc0,0x4e,0x60,
-0xaf,0x55,0xf5,0x8f,0x27,0xf4,0x1f,0xf1,0x04,0x03,0xa3,0x59,0x10,0x30,0x07,0xf7,
-0x0a,0x00,0x03,0xf0,0x04,0x40,0x04,0x66,0x66,0x66,0xbf,0x30,0x00,0x8a,0x00,0xcc,
-0xcc,0xcc,0xef,0x30,0x00,0xef,0x13,0xfe,0xf4,0xad,0xb1,0x05,0xfb,0x07,0xfb,0x77,
-0x77,0x77,0x60,0x0c,0xf4,0x0a,0xf7,0x28,0x10,0x1e,0x8f,0x13,0x5b,0x78,0xcf,0x60,
-0x00,0x30,0x56,0x81,0x23,0x81,0x00,0x30,0x76,0x12,0x5b,0x18,0x01,0xb2,0x8f,0xaa,
-0xfb,0xbb,0xec,0xbb,0xb3,0x00,0x04,0x0a,0xf2,0xab,0x75,0xf0,0x0b,0x0a,0xf4,0x67,
-0xff,0x66,0x50,0x0a,0x70,0x0b,0xf6,0xff,0xee,0xef,0xd0,0x3e,0xfd,0x0b,0xf6,0xf8,
-0x33,0x3f,0xd0,0x00,0x96,0x0c,0xf5,0x10,0x00,0x00,0xba,0x00,0x01,0x10,0x00,0x32,
-0x49,0x0f,0xd4,0xc9,0x11,0xf8,0x14,0x7f,0xb1,0x52,0xcf,0x25,0x30,0x02,0xfd,0x7f,
-0x77,0xf6,0xcf,0x5f,0xb0,0x0a,0xf7,0xdf,0x5f,0xe0,0xcf,0x1c,0xf4,0x1f,0xf6,0xfb,
-0x4e,0x79,0xef,0x04,0xc4,0x04,0x72,0xb3,0x00,0x1f,0xf6,0x61,0x13,0x20,0xf1,0x08,
-0x00,0x53,0x11,0x00,0xb1,0xba,0xe1,0xcf,0xd2,0xfc,0x66,0x68,0xfa,0x00,0x00,0x09,
-0x41,0xff,0xff,0x91,0xfa,0xd3,0x12,0x00,0x1b,0x1d,0xf0,0x0c,0x0c,0x60,0x8d,0xfe,
-0xdf,0xed,0xff,0xd3,0x5f,0xfb,0xaf,0xbb,0xbb,0xbb,0xbd,0xf3,0x02,0xd9,0x9f,0x88,
-0x88,0x88,0x8c,0xf3,0x00,0x00,0x26,0xa0,0x1b,0x80,0x41,0x00,0x0a,0x23,0xfb,0x55,
-0x56,0xfb,0xa9,0xaf,0x30,0xff,0xee,0xef,0x87,0x3b,0x91,0x43,0xfa,0x44,0x45,0xfb,
-0x00,0x07,0xfc,0x03,0xab,0x11,0xe8,0x0d,0xf3,0x03,0xf8,0x00,0x78,0xfb,0x00,0x00,
-0x60,0x03,0xf8,0x00,0xcf,0xb3,0x13,0x03,0xd8,0x69,0x40,0xa1,0x00,0x00,0x7f,0x69,
-0x71,0x00,0x81,0x23,0x01,0x1e,0x6a,0xf0,0x14,0x89,0xbf,0xb9,0x9d,0xe9,0x90,0x00,
-0x02,0x05,0xee,0x51,0x0d,0xfa,0x00,0x08,0x10,0xcf,0xe4,0xef,0x21,0xaf,0xd1,0x4f,
-0xe3,0x8a,0x2d,0xf6,0x7e,0x28,0xc0,0x05,0xfb,0x05,0xef,0xa7,0xfb,0x21,0x00,0x0e,
-0x2f,0x00,0xa7,0x28,0xf0,0x0f,0x24,0x06,0x6d,0xff,0xf3,0x44,0x00,0x00,0x9f,0x32,
-0xcf,0xb3,0xfb,0x8f,0xb0,0x00,0xef,0xbf,0xff,0x30,0xbf,0xfb,0x10,0x06,0xf9,0xcc,
-0xbf,0x30,0x3e,0xf7,0xf3,0x0b,0xf5,0x02,0xbf,0xdf,0x93,0xff,0xc2,0x1c,0xb0,0x02,
-0xff,0xea,0x40,0x3d,0xe1,0x00,0x10,0x00,0x52,0xaa,0x25,0x00,0x1a,0x57,0xf3,0x03,
-0xe7,0x00,0xbf,0x0b,0xf0,0xaf,0x10,0x03,0xef,0xa6,0xdf,0x7d,0xf6,0xdf,0x74,0x00,
-0x0a,0x4f,0x1b,0x55,0xf1,0x01,0x03,0xcf,0x4c,0xf4,0xcf,0x42,0x09,0x80,0x00,0x9d,
-0x08,0xb0,0x8c,0x10,0x1c,0xfd,0x73,0xab,0x34,0x94,0x00,0x67,0x9e,0x6b,0x30,0x1f,
-0xa0,0x0c,0x9b,0x28,0xa2,0x09,0x2a,0xd8,0x8e,0xf9,0x8b,0xc4,0x00,0x5f,0x80,0x08,
-0x03,0x30,0xbf,0x20,0xfc,0xa8,0x91,0xf6,0x08,0x03,0xfb,0x00,0xfc,0x0c,0xf1,0x8f,
-0x50,0x0a,0xf4,0x00,0xfc,0x0c,0xf8,0xff,0x20,0x08,0xd0,0x00,0x54,0x0c,0xf2,0x62,
-0xfd,0x00,0xf1,0x0f,0x60,0x00,0x0d,0xd0,0x0d,0xe0,0x00,0x07,0xfe,0x6d,0xdf,0xfd,
-0xdf,0xfd,0xd2,0x00,0x8f,0xbb,0xbf,0xfb,0xbf,0xfb,0xb1,0x00,0x04,0x00,0x0a,0xa0,
-0x0a,0xa0,0xf0,0xaf,0x00,0x90,0xa0,0xf3,0x04,0x1e,0xa1,0x5e,0xee,0xff,0xff,0xfe,
-0xe5,0x3e,0xfd,0x00,0x00,0xf7,0x2f,0x40,0x00,0x01,0xb6,0x0f,0xf1,0x09,0xf0,0x24,
-0x0f,0xeb,0xfc,0xcf,0xbe,0xf0,0x00,0x0d,0x6f,0xc3,0xf6,0x7f,0x3a,0xf0,0x00,0x7f,
-0xaf,0xc7,0xff,0xdf,0xcb,0xf0,0x01,0xef,0x2f,0xde,0xb8,0xfc,0xff,0xf0,0x09,0xf9,
-0x0f,0xdb,0x26,0xf1,0x4a,0xf0,0x0e,0xf2,0x0f,0xc0,0x00,0x10,0x3c,0xf0,0x01,0x60,
-0x0f,0xc0,0x00,0xc8,0x2a,0x12,0x30,0x01,0x96,0x12,0x07,0xd1,0x72,0x10,0xa0,0x54,
-0x8e,0xe1,0x3f,0xc5,0x55,0x30,0x00,0x1e,0x47,0x77,0x9f,0xc7,0x77,0x72,0x00,0x01,
-0x60,0x00,0xf0,0x0a,0xf4,0x0a,0x50,0x0f,0xb0,0xaf,0x12,0x38,0xe0,0x2d,0xfa,0x0f,
-0xbb,0xff,0xff,0xd3,0x30,0x00,0xa8,0x0f,0xa4,0xbf,0x41,0x1b,0x80,0xf8,0x00,0x10,
-0x7f,0xb2,0x18,0xf3,0x20,0x3d,0x5f,0x90,0x03,0x67,0x53,0x00,0x00,0x9f,0x7f,0x73,
-0x25,0xbd,0x1b,0x20,0x01,0xfd,0x7f,0x5f,0xaf,0x2e,0x8b,0xb0,0x08,0xf6,0xbf,0x6f,
-0x7f,0x15,0x8a,0xf2,0x0e,0xf2,0xfc,0xbb,0x6f,0x53,0xac,0xd7,0x03,0x72,0xe5,0x12,
-0x2d,0xff,0xf5,0x10,0x71,0x02,0x00,0x74,0x01,0x10,0x66,0x4e,0x92,0x40,0x0d,0xd2,
-0x00,0xfe,0x1e,0x18,0x50,0x03,0xee,0xaf,0xff,0xfa,0x0d,0xb3,0xa0,0x35,0x9f,0x44,
-0xfa,0x7f,0xca,0xa4,0x00,0x00,0x9f,0x9b,0x14,0xb1,0xf6,0x2c,0x40,0x9f,0x44,0xfc,
-0xfc,0x0c,0xc0,0x2d,0xf6,0x7e,0x89,0xf8,0x31,0x90,0x01,0xa1,0x36,0xeb,0x58,0xff,
-0x5f,0x70,0x00,0x00,0xaa,0xff,0xaa,0x1f,0xbf,0x40,0x00,0x53,0xdf,0xfd,0xdd,0x0b,
-0xff,0x00,0x00,0xdd,0x0b,0xe7,0x74,0x06,0xfb,0x00,0x03,0xf8,0x0e,0xff,0xf9,0x05,
-0xfa,0x00,0x0a,0xf2,0x5f,0x72,0xf8,0x1e,0xff,0x60,0x1f,0xc3,0xef,0x69,0xf8,0xdf,
-0x4d,0xf4,0x19,0x55,0xe3,0x6f,0xc4,0xd4,0x02,0xbf,0x39,0x0d,0xe6,0x67,0x11,0xf0,
-0xff,0x4b,0xd0,0x70,0x2f,0xf0,0x00,0x6a,0x40,0x00,0x6f,0xa0,0x3f,0xd0,0x00,0xbf,
-0xe7,0x0b,0xc0,0x5f,0xc0,0x01,0xff,0x10,0x04,0xfe,0x10,0x7f,0xe0,0x08,0xf9,0x8d,
-0x0a,0x40,0xbf,0xf4,0x0b,0xf1,0x0f,0x7e,0x00,0x36,0xd7,0x10,0x00,0x56,0x7e,0x21,
-0xdf,0x40,0xaf,0x24,0x31,0xf3,0x5f,0xe2,0xa6,0x2c,0xe1,0x80,0x0a,0xff,0x50,0x00,
-0x03,0xbf,0xf9,0x00,0x00,0xbf,0xfd,0x71,0x1e,0x6a,0x94,0x22,0xff,0xe2,0xb5,0x78,
-0x22,0x06,0x50,0x3d,0x43,0x01,0x45,0x43,0x91,0x02,0x33,0x33,0x33,0x31,0x00,0x0d,
-0xe0,0x0e,0x1b,0x1d,0xb0,0x0d,0xe1,0x19,0xaa,0xbf,0xfa,0xa3,0x0c,0x8d,0xe8,0xf1,
-0xc0,0x5c,0x40,0x0e,0x8d,0xec,0xb0,0x08,0x00,0x40,0x1f,0x6e,0xff,0x40,0x08,0x00,
-0x31,0x4f,0x3f,0xd1,0xf8,0x67,0x32,0x02,0x1f,0xc0,0x00,0x68,0x22,0x4f,0xe3,0x08,
-0x00,0x10,0x9f,0x26,0x97,0x00,0x69,0x77,0x20,0x5f,0xf2,0x08,0x00,0x40,0x09,0xfb,
-0x04,0xa0,0x5a,0xc7,0x00,0x0b,0x5a,0x00,0xfe,0x2f,0x00,0xa5,0xa4,0x3b,0x8f,0xfb,
-0x20,0x1d,0x81,0x31,0xfb,0x00,0x01,0x30,0x12,0x40,0xfb,0x00,0x00,0x39,0xcf,0x02,
-0x40,0xfb,0x00,0x00,0x4a,0x46,0x5c,0x43,0xfb,0x00,0x01,0xaa,0x08,0x00,0x15,0xff,
-0x21,0xad,0x21,0x0a,0xa0,0x18,0x01,0x50,0x60,0x2f,0xe0,0x00,0xb8,0x32,0x95,0x40,
-0x4f,0xf1,0x03,0xfc,0xc1,0x0d,0xc0,0xbf,0xf9,0x0c,0xf3,0x00,0x01,0x94,0x05,0xff,
-0xcf,0x75,0x70,0x9a,0x12,0xf0,0x01,0xf6,0x1e,0xfa,0x30,0x00,0x16,0xaf,0xff,0x50,
-0x02,0xdf,0xfd,0xa3,0x1e,0xfe,0x81,0xdb,0x6e,0x24,0xe0,0x03,0x3c,0x5d,0x02,0x6f,
-0x02,0x03,0x22,0x88,0x05,0x05,0x22,0x22,0x90,0x00,0x48,0x75,0x15,0x70,0x20,0x00,
-0x10,0x9c,0xc8,0xa5,0x14,0xc1,0xc0,0x24,0x11,0x00,0xca,0x26,0x18,0x0c,0x08,0x00,
-0x03,0x18,0x00,0x31,0x8b,0xbb,0xbb,0x3a,0xb4,0xe0,0x75,0x01,0x20,0x24,0x03,0x92,
-0x00,0x04,0xfc,0x0f,0xd0,0xbf,0x26,0xfe,0xde,0xa8,0xf1,0x05,0xf0,0x5f,0x80,0xbf,
-0xb0,0x5f,0xa0,0x0c,0xf1,0x0f,0xb0,0x3f,0xe2,0x01,0x00,0x03,0x20,0x01,0x00,0x02,
-0xed,0x83,0x12,0x44,0xe3,0x17,0x22,0x11,0xfd,0x76,0x4a,0x00,0x66,0x62,0x13,0x60,
-0x5e,0x6b,0xa3,0xd0,0x04,0xff,0xd2,0x22,0xdf,0x32,0x22,0x10,0x4f,0xb8,0x40,0xb0,
-0x0a,0x8f,0xe7,0x77,0xef,0x77,0x77,0x00,0x00,0x1f,0xfb,0x25,0x82,0x00,0xf6,0x81,
-0x41,0x99,0xef,0xa9,0x99,0xe3,0x21,0x42,0xef,0x88,0x88,0x70,0x02,0x12,0x00,0xd3,
-0xc0,0xf2,0x0f,0x71,0x20,0x13,0x11,0x66,0x00,0x01,0xff,0x1b,0xf0,0x6f,0x71,0xef,
-0x30,0x0a,0xf9,0x09,0xf3,0x1f,0xd0,0x5f,0xd0,0x1d,0xe0,0x08,0xf3,0x0d,0xc0,0x0d,
-0xe3,0x51,0x0b,0x02,0x1a,0x32,0x05,0xb7,0x12,0x20,0xcf,0x6c,0xdb,0x21,0x70,0xba,
-0x30,0xcf,0x8f,0x70,0x00,0x7f,0xa9,0x11,0xe0,0x0e,0x90,0x02,0xff,0x40,0xbf,0xba,
-0xef,0xab,0x90,0x0c,0xf7,0xed,0xfd,0xd8,0x03,0xf1,0x00,0x8f,0xa2,0x3e,0xf6,0x22,
-0xff,0x52,0x20,0x08,0x8f,0x8f,0xe0,0x04,0xff,0xa0,0xa9,0x8f,0x10,0x0c,0x00,0x0b,
-0xfa,0x28,0x4e,0xf8,0x00,0x9f,0xb6,0xfc,0x00,0x1b,0xff,0x80,0x1b,0xfe,0x10,0xcf,
-0xd1,0x08,0xd4,0x00,0x7f,0xd2,0x00,0x1c,0x90,0x00,0x85,0x00,0x24,0x13,0x01,0x76,
-0x00,0x05,0xfb,0x0d,0xf0,0x8f,0x61,0xff,0x20,0x1e,0xf3,0x0b,0xf1,0x3f,0xb0,0x6f,
-0xb0,0x5e,0x90,0x0a,0xe2,0x0e,0xb0,0x0d,0xc1,0x6c,0xa1,0x00,0xd0,0x01,0x12,0x80,
-0xf0,0x5e,0xb1,0x1f,0x90,0x05,0x6a,0xfc,0x66,0x40,0x00,0x1f,0x90,0x0c,0x9f,0x36,
-0x40,0x2f,0x9a,0x9c,0xf0,0x3b,0x2f,0x31,0x8f,0x9f,0xac,0x47,0x5e,0xb0,0x7f,0xdf,
-0x4c,0xf4,0x44,0x5f,0xc0,0x3f,0x5f,0xca,0x0c,0x9b,0x31,0xc1,0x5e,0x3f,0x80,0x0c,
-0xf3,0x33,0x4f,0xc0,0x00,0x4f,0x70,0x0c,0xcd,0x31,0xf7,0x20,0x7f,0xd1,0x04,0x5a,
-0xf7,0x55,0x40,0x00,0xbf,0xfd,0x51,0x9b,0xef,0x33,0x30,0x01,0xfd,0x6b,0xeb,0xfa,
-0x2a,0x1d,0xd0,0x0a,0xf7,0x02,0xf8,0xfa,0x00,0x9b,0xf6,0x4f,0xd0,0x07,0xf3,0xfe,
-0x89,0xfa,0xec,0x0b,0x30,0x00,0x50,0x9f,0xff,0xe3,0x41,0x80,0x03,0x12,0x12,0x93,
-0x00,0x11,0x5a,0xd6,0x0e,0x00,0x32,0x5b,0x11,0x3f,0x4f,0x33,0xda,0xf8,0xcb,0x1f,
-0xcd,0xcd,0xe0,0x08,0xf4,0xf8,0xdb,0x1f,0x8a,0x8a,0x08,0x00,0x20,0xff,0xff,0x08,
-0x00,0xf0,0x0b,0xcc,0x1f,0xc8,0x88,0x70,0x09,0xf3,0xf8,0xae,0x1f,0x80,0x01,0x70,
-0x09,0xf2,0xf8,0x8f,0x2f,0xa0,0x05,0xf4,0x0a,0xf2,0xf8,0x4f,0x8e,0x77,0x51,0xb0,
-0xd2,0xf8,0x0d,0xf6,0x78,0x88,0x30,0x0f,0xa2,0xf8,0x03,0x39,0x98,0xe0,0x5f,0x62,
-0xf8,0x00,0x3d,0xff,0xda,0x84,0x3e,0x12,0xf8,0x00,0x00,0x49,0xd2,0xa8,0x06,0xe7,
-0x0c,0x00,0x02,0x49,0x10,0x02,0xa3,0x09,0x02,0x53,0x6b,0x09,0x0f,0x00,0x10,0xfc,
-0x55,0x6a,0x23,0x70,0x02,0x9c,0xb5,0x20,0x2f,0xd2,0xbf,0x42,0x33,0x10,0x03,0xfc,
-0xb1,0x27,0x10,0xfc,0x1a,0x88,0x02,0x49,0x98,0x00,0x01,0x13,0x52,0x83,0x33,0x33,
-0x7f,0xb0,0x11,0xcd,0x41,0xfb,0x00,0x09,0xfc,0x64,0x54,0x11,0x02,0xc3,0xc4,0x12,
-0xfb,0x12,0x30,0x17,0x4f,0x78,0x04,0x91,0xce,0x00,0x02,0x35,0x8b,0x30,0x0a,0xf1,
-0xce,0xf9,0x59,0x80,0x0a,0xf1,0xce,0x0a,0xfa,0x76,0x42,0x00,0x08,0x00,0x11,0xf2,
-0x0d,0x7b,0x50,0xef,0x8a,0xf7,0x55,0x56,0xed,0x47,0x11,0xfa,0x30,0xba,0xf1,0x1e,
-0xf3,0x11,0x1a,0xff,0xb5,0x8f,0x80,0x0a,0xf1,0x00,0x0a,0xfe,0xd0,0x7f,0x50,0x0b,
-0xff,0xff,0x3b,0xf8,0xf3,0xcf,0x20,0x0c,0xfb,0xdf,0x3c,0xf2,0xfa,0xfc,0x00,0x0d,
-0xe0,0x7f,0x3d,0xf0,0xbf,0xf5,0x00,0x0f,0xc0,0x7f,0x4f,0xc0,0x6f,0x09,0x1c,0xfb,
-0x06,0x7f,0x93,0xff,0xfa,0x00,0x8f,0x40,0x7f,0xcf,0xbf,0xf6,0xcf,0xc0,0x3c,0x00,
-0x7f,0x9d,0x3d,0x20,0x0b,0x70,0x1d,0x85,0x21,0x50,0x01,0xa9,0x92,0x43,0xdd,0x40,
-0x00,0x08,0x60,0x53,0x23,0x0f,0xe0,0x63,0x7e,0x13,0xa0,0xef,0x36,0x83,0x81,0x11,
-0x14,0xfd,0x11,0x10,0x00,0xcf,0xfa,0x21,0x70,0xbb,0xbb,0xbd,0xff,0xff,0xbb,0xb0,
-0xe9,0x04,0x31,0xf8,0xfc,0x00,0x54,0xb6,0x21,0x42,0xfc,0x6d,0x78,0x30,0xc2,0x02,
-0xfc,0x89,0x0f,0x12,0xe6,0x17,0x37,0x53,0xe7,0x10,0x08,0xef,0xfb,0x87,0x6c,0x1e,
-0xc3,0xbc,0x46,0x00,0xb5,0x1c,0x00,0x35,0x14,0x31,0x02,0x0c,0xf0,0x51,0x71,0x41,
-0x0d,0xac,0xf0,0x0d,0x92,0xc7,0x60,0xbd,0xf5,0x19,0xab,0xfe,0xaa,0x39,0xb0,0x11,
-0x40,0x69,0x71,0x30,0x8d,0xf6,0xef,0x88,0x09,0xb0,0x7f,0x1c,0xf0,0x9b,0xbb,0xbc,
-0xfd,0xb2,0x17,0x0c,0xf0,0xf0,0x67,0x00,0xae,0x52,0x60,0x7c,0xcc,0xcd,0xfe,0xc0,
-0x2c,0x2d,0x3e,0x00,0x57,0x4a,0xe1,0xde,0xf0,0x07,0xd1,0x04,0xf7,0x00,0x01,0x0c,
-0xf0,0x04,0xfd,0x04,0xf7,0x60,0x00,0x22,0x78,0x05,0x08,0x00,0x32,0x05,0xde,0xf6,
-0x70,0x00,0x2d,0xff,0xb1,0x88,0x00,0x00,0x7d,0x00,0x33,0x0c,0xf1,0x24,0x08,0x00,
-0x40,0xee,0x10,0x03,0x52,0x08,0x00,0x40,0x7f,0x80,0x0e,0xe4,0x08,0x00,0xe1,0x0e,
-0xb0,0x07,0xfc,0xfb,0x00,0x0d,0xf1,0x03,0x00,0x00,0xef,0xfb,0xef,0x98,0x09,0x30,
-0x33,0xfb,0xcd,0x31,0xac,0x00,0x66,0x1a,0x20,0x0f,0xf8,0x41,0xbb,0x40,0xfb,0x00,
-0x3f,0xfe,0x93,0x6a,0xf0,0x06,0xfb,0x00,0x8f,0xef,0x50,0x00,0x1f,0xf8,0xfb,0x00,
-0xef,0x2f,0xd0,0x00,0x07,0x32,0xfb,0x08,0xf9,0x08,0xf9,0x58,0x00,0xa0,0x4f,0xf2,
-0x01,0xef,0x80,0x00,0x02,0xfd,0xff,0x60,0x42,0x70,0x78,0x02,0xfb,0xa7,0x00,0x00,
-0x02,0xa0,0x82,0x00,0x14,0x40,0x79,0x51,0x03,0x46,0x4a,0x00,0x68,0x00,0xf7,0x2e,
-0x06,0xaa,0xaa,0xcf,0xda,0xba,0xaa,0xa2,0x02,0xc6,0x00,0xce,0x19,0xe2,0x4d,0x40,
-0x02,0xcf,0xaa,0xff,0xff,0x85,0xfe,0x30,0x00,0x09,0x35,0xae,0xf8,0x12,0xa2,0x00,
-0x00,0x17,0xd0,0x8f,0x8b,0xd8,0xd4,0x00,0x0a,0xff,0xbd,0xff,0xef,0xfd,0xef,0xa0,
-0x08,0xb3,0x0a,0xcc,0xb7,0xbb,0x1b,0xa0,0x01,0x11,0x11,0x1d,0xf4,0x73,0xb9,0x03,
-0x22,0x25,0x12,0xa5,0x9c,0xaa,0x02,0x72,0x06,0x16,0xf3,0xc4,0xb2,0x31,0x10,0x3f,
-0xff,0x69,0x09,0x90,0xfb,0x2b,0xef,0xca,0x6b,0xbb,0xef,0xdb,0xb8,0xd7,0x38,0x01,
-0x37,0x4c,0x21,0x8f,0x30,0xc2,0x02,0x00,0x8f,0x3e,0x00,0x61,0xba,0x10,0x0f,0x61,
-0x72,0xf2,0x17,0xff,0xf9,0x00,0x0b,0xdf,0xc5,0x05,0xff,0xfc,0xef,0x60,0x00,0x8f,
-0x30,0x3f,0xfc,0xfb,0x3f,0xf2,0x00,0x8f,0x30,0xef,0xa3,0xfb,0x08,0xf9,0x00,0x8f,
-0x87,0x3a,0x03,0xfb,0x00,0x70,0x17,0xdf,0xfd,0x81,0x1b,0x21,0xfa,0x51,0x08,0x00,
-0x26,0x04,0x00,0xaf,0x3e,0x12,0x03,0x77,0x30,0x11,0x8e,0x47,0x3d,0x60,0xcf,0xec,
-0x6e,0xf9,0x99,0xaf,0x01,0x6c,0x42,0x0e,0xd0,0x43,0x1f,0x08,0x00,0x10,0xfb,0x84,
-0x8e,0x01,0x08,0x00,0x00,0xa4,0x68,0x10,0x3e,0x08,0x00,0x62,0x09,0xbf,0xeb,0x2e,
-0xd1,0xf9,0x20,0x00,0x21,0xd3,0xf7,0x08,0x00,0x90,0x07,0x68,0xfa,0x37,0x60,0x00,
-0x1f,0xc5,0x40,0xce,0x15,0xf1,0x0f,0x05,0x9f,0xff,0xa0,0x9f,0xdf,0x60,0xa5,0x4f,
-0xff,0xb7,0x26,0xfc,0x5f,0x60,0xda,0x19,0x40,0x01,0x9f,0xe2,0x4f,0xa6,0xf7,0x00,
-0x00,0x02,0xec,0x20,0x1d,0xb0,0x56,0x16,0x20,0x12,0x35,0x00,0x66,0x4d,0x60,0xa9,
-0x00,0xeb,0x8b,0xbb,0xb4,0x96,0x74,0xb0,0xeb,0xcf,0xff,0xf6,0x00,0x8f,0x40,0x51,
-0xeb,0x01,0xfb,0x84,0x36,0x12,0xf6,0x08,0x00,0x20,0x31,0xf5,0x08,0x00,0x40,0x06,
-0xbf,0x85,0xf4,0x08,0x00,0xf2,0x06,0x0f,0xff,0xfd,0xf3,0xfb,0x9f,0xff,0xf3,0x04,
-0xaf,0x6b,0xf0,0xfb,0x7c,0xfe,0xb2,0x00,0x7f,0x33,0x91,0xfa,0x30,0x00,0x21,0x04,
-0xf7,0x08,0x00,0xb0,0x86,0x0a,0xf4,0x01,0xfb,0x00,0x3b,0xef,0xfc,0x3f,0xd0,0xae,
-0x16,0xc2,0xea,0x66,0xef,0x56,0xcd,0xff,0xc8,0x01,0x00,0x08,0xf7,0x08,0x3b,0x20,
-0x13,0x30,0xc0,0xba,0x10,0x7f,0x28,0x06,0xf1,0x00,0x4c,0xef,0xdb,0x7f,0xba,0xfc,
-0x9f,0xd0,0x00,0x9f,0x30,0x7f,0x41,0xf8,0x0e,0x08,0x00,0x01,0x40,0x06,0xa1,0x9f,
-0x40,0x7f,0xa9,0xfc,0x8f,0xd0,0x3f,0xff,0xfa,0x18,0x00,0x33,0x2b,0xef,0xc7,0x18,
-0x00,0x60,0x30,0x49,0x9a,0xfd,0x99,0x80,0xad,0x29,0x20,0x04,0xfb,0x89,0x12,0x21,
-0x56,0x9f,0x92,0x55,0xa1,0xcf,0xff,0x6a,0xab,0xfe,0xaa,0xa0,0x7f,0xff,0xc6,0x73,
-0x8f,0x30,0x3c,0x71,0x08,0x89,0x1d,0x13,0xc7,0x42,0x02,0x11,0xf9,0x66,0x08,0x01,
-0x34,0x76,0x91,0xc7,0xae,0x06,0xf6,0x0b,0xf0,0x1f,0xff,0xf9,0x08,0x00,0x00,0x21,
-0x63,0x31,0x8c,0xfb,0x8e,0x08,0x00,0x01,0x38,0x0a,0x32,0xaf,0x20,0x22,0xf4,0x6a,
-0x12,0xf8,0xf7,0x46,0x20,0xef,0xb5,0xec,0x25,0x10,0xb6,0xe7,0x4a,0x21,0x0b,0xf3,
-0xc1,0x1b,0x11,0xef,0xe0,0x0a,0xf1,0x03,0xaf,0x10,0xed,0xcf,0x9f,0xdb,0xf6,0x03,
-0xcf,0xe9,0xea,0x6f,0x1e,0xa5,0xf6,0x1f,0xfd,0xa4,0x08,0x00,0x70,0x04,0x10,0x00,
-0xea,0x6f,0x1e,0xcc,0xd3,0x1c,0x47,0xea,0x6d,0x1c,0x9d,0xf7,0x33,0x22,0x81,0x0f,
-0x5f,0x6a,0x03,0x44,0x6a,0x23,0x7f,0xc0,0xed,0x8b,0x10,0xec,0x77,0x47,0x23,0x50,
-0x04,0xcf,0x30,0x22,0x0d,0xf7,0x41,0x17,0x23,0x3e,0xc0,0x67,0x51,0x13,0x20,0x1a,
-0x23,0x13,0x4f,0x69,0x7e,0x10,0x4d,0x58,0x19,0x1e,0xdb,0x3d,0x8c,0x0b,0x65,0x8b,
-0x12,0x2e,0xbb,0x63,0x12,0xe3,0x10,0x08,0x12,0xbb,0xe4,0x5f,0x00,0x3e,0x3e,0x60,
-0x31,0x1e,0xf2,0x11,0xdf,0x10,0xea,0x15,0x00,0xbf,0x66,0x65,0xcf,0xdc,0xcf,0xfd,
-0xcc,0xff,0x1e,0x00,0x30,0xdf,0x10,0x0d,0x24,0x97,0x20,0x0e,0xf1,0xa8,0x80,0x14,
-0xf1,0xaf,0x98,0x01,0xeb,0x07,0x30,0xbf,0xf1,0x05,0x6f,0x91,0x00,0x52,0x8e,0x11,
-0x50,0x3c,0x00,0xf6,0x01,0x4f,0xe1,0x00,0x0d,0xf2,0xbb,0xff,0x03,0xd5,0x00,0x00,
-0xdf,0x0e,0xff,0x70,0x01,0x9e,0x96,0x1a,0xff,0x98,0x00,0x01,0xb2,0x74,0x03,0x3f,
-0x08,0x90,0x1f,0xfc,0xcd,0xff,0xdc,0xcf,0xf0,0x01,0xfe,0x1e,0x00,0x10,0xff,0xc8,
-0x29,0x44,0xff,0xcc,0xcf,0xf0,0x1e,0x00,0x00,0xe3,0x8e,0x00,0x74,0x8d,0x10,0xff,
-0xfe,0x23,0x14,0xff,0xd4,0xb7,0x20,0x01,0xfe,0x13,0x01,0x50,0x07,0xc2,0x06,0x50,
-0x00,0xa9,0x1f,0x10,0x60,0x0a,0x1f,0x11,0xee,0x3d,0x18,0x11,0x3d,0x0c,0x28,0x04,
-0xbb,0xb6,0x50,0xcf,0x98,0x9f,0xe8,0x89,0x08,0x00,0x57,0x54,0x5f,0xe4,0x46,0xfc,
-0x18,0x00,0x50,0x21,0x2f,0xd1,0x14,0xfc,0x97,0x8c,0x37,0xaf,0xe9,0x9a,0x18,0x00,
-0xf0,0x0b,0x06,0xef,0x60,0x07,0xfd,0x60,0x00,0x29,0xef,0xfc,0x50,0x05,0xcf,0xff,
-0xb3,0x1e,0xd5,0x7f,0x80,0x08,0xfa,0x6d,0xd0,0x01,0x00,0xaf,0x6a,0x41,0x10,0x10,
-0x64,0xb3,0x01,0xb1,0x04,0x22,0xcf,0xf6,0xf6,0x27,0x23,0x9d,0x40,0xfe,0x27,0x06,
-0x01,0x00,0x20,0x56,0x00,0x93,0x2a,0x30,0x30,0x1f,0xe0,0x4b,0x1d,0xf0,0x0c,0xf6,
-0x0a,0xff,0xff,0xfd,0x2e,0x9c,0x7e,0x68,0xff,0xcc,0xdf,0xe0,0xe7,0xb5,0xec,0xff,
-0xf8,0x0c,0xf5,0x0e,0x7b,0x5e,0x8c,0x3b,0xfd,0xf8,0x1e,0x00,0xf0,0x12,0x01,0x8f,
-0xfe,0x30,0x0e,0xbd,0xaf,0xaa,0xff,0xfc,0xff,0xd5,0xe7,0xb5,0xee,0xff,0xc2,0x06,
-0xff,0x8e,0x7b,0x5e,0x9c,0xfb,0xbb,0xbd,0xe4,0xe7,0xb5,0xe6,0x0f,0xff,0xff,0x9a,
-0x27,0xa1,0x60,0xf9,0x00,0x1f,0xa0,0xee,0xcc,0xc5,0x0f,0xa0,0x08,0xab,0x00,0x82,
-0x01,0x01,0x2f,0xc2,0x30,0xd9,0x9a,0xfa,0xb4,0x44,0x12,0x30,0x4c,0x5d,0x02,0x9b,
-0x21,0x24,0x70,0x00,0x37,0x4a,0x20,0xff,0xee,0x13,0x70,0x21,0x0f,0xe0,0x75,0x01,
-0x02,0x47,0x5e,0x03,0x60,0x4a,0x02,0x59,0x01,0x64,0x0f,0xf3,0x33,0x33,0x33,0x3f,
-0x1a,0x00,0x02,0x27,0x00,0x01,0x61,0x5f,0x14,0xff,0x41,0x00,0x12,0x11,0xcd,0x84,
-0x41,0x46,0x10,0x00,0x54,0x48,0x4e,0x02,0x4b,0x72,0x60,0xec,0x00,0x06,0xfa,0x11,
-0x11,0x70,0x1b,0x10,0xcf,0x04,0x00,0xf0,0x0e,0xaa,0xef,0x6f,0xea,0xaa,0xef,0x0c,
-0xe0,0x0a,0xfe,0xf4,0x00,0x0c,0xf0,0xce,0x00,0xaf,0xab,0x10,0x00,0xcf,0x0c,0xfa,
-0xae,0xf1,0x4f,0x90,0x0d,0xe0,0x32,0x7f,0xf0,0x05,0xdf,0x40,0xee,0x0c,0xe0,0x0a,
-0xf1,0x03,0xfe,0x0f,0xd0,0xce,0x00,0xaf,0x10,0x0a,0xb2,0xfc,0x0c,0xe0,0x44,0xaf,
-0x30,0x2f,0xa0,0xcf,0x04,0x17,0xb0,0x06,0xf8,0x0c,0xfb,0xbb,0xb0,0x07,0xdd,0xff,
-0x30,0x8a,0xd7,0x0a,0x07,0xd6,0x13,0x00,0x43,0x9f,0x50,0x27,0x20,0x00,0x00,0x07,
-0x46,0x89,0x20,0x80,0x00,0x8f,0x17,0x20,0x03,0xfc,0xfc,0x84,0x66,0xcf,0xaa,0xab,
-0xfc,0xaa,0xa0,0x4e,0xb8,0x30,0x4b,0x20,0x02,0x9d,0xac,0x80,0x5b,0xfe,0x40,0x05,
-0xff,0xf9,0x20,0x0d,0x84,0x26,0x50,0x06,0xdf,0xe0,0x05,0xda,0x6c,0x11,0x26,0x89,
-0x40,0xa0,0x2e,0x40,0x47,0xf5,0x6f,0x64,0x08,0x00,0x46,0x37,0xf4,0x5f,0x54,0x08,
-0x00,0x93,0x3b,0xdf,0xcd,0xfc,0xdf,0xdc,0xfd,0xb3,0x4f,0xf2,0x8b,0x00,0x00,0x1c,
-0x20,0x09,0x91,0xa4,0x5b,0x42,0x1f,0xc0,0x0e,0xf2,0x08,0x00,0x40,0x4f,0xf6,0x66,
-0x61,0x08,0x00,0x40,0x9f,0xff,0xff,0xf2,0x83,0x95,0xb0,0xff,0x56,0x44,0x40,0x03,
-0xf9,0x1f,0xca,0xf9,0x7f,0x80,0x20,0x00,0xda,0xcb,0xe1,0x1b,0xf9,0x00,0x03,0xc7,
-0x1b,0x90,0x20,0x00,0xbc,0x10,0xce,0x5d,0x10,0xfc,0xdb,0xa5,0x40,0xfb,0xaf,0xc9,
-0xfc,0x24,0x38,0x36,0xf4,0x4f,0x71,0x08,0x00,0x76,0x2b,0xef,0xbd,0xfc,0xcf,0xdb,
-0xfe,0x78,0x00,0x22,0x01,0x63,0x04,0x37,0x22,0x03,0xfd,0x2c,0x82,0x62,0x77,0xef,
-0x87,0x7c,0xfa,0x77,0x66,0xbb,0x00,0x2f,0x27,0x50,0x12,0x22,0x5f,0xc2,0x22,0x20,
-0xd5,0x03,0xd5,0x0b,0x82,0x23,0x33,0x6f,0xc3,0x33,0x30,0x00,0x1c,0xd3,0x73,0x11,
-0x90,0xc2,0xac,0x00,0xb4,0x47,0x12,0x68,0x80,0x2e,0x02,0xd3,0x02,0x00,0x97,0x8d,
-0x43,0x0a,0xf1,0x8f,0x46,0x08,0x00,0xa1,0x35,0xf7,0x00,0x5a,0xff,0xae,0xfb,0xdf,
-0xbc,0xfd,0x4c,0x25,0x04,0x26,0x16,0x11,0x81,0xd6,0x10,0x53,0x77,0x8f,0xf7,0x77,
-0x73,0x65,0x86,0x10,0xf7,0xf1,0x01,0x40,0x3e,0x81,0x07,0xf7,0x35,0x7b,0x55,0x2b,
-0xfa,0x06,0xf7,0x00,0x2d,0x07,0xf0,0x05,0xbf,0xea,0xbe,0xaa,0xac,0xfd,0xa5,0x00,
-0xaf,0x80,0x8f,0xc4,0x18,0xf7,0x00,0x08,0xfd,0x10,0x05,0xd6,0xaf,0x2a,0x63,0xc6,
-0x44,0x44,0x44,0xab,0x83,0x77,0x2b,0x00,0xb1,0x3c,0x40,0x77,0xf8,0x5f,0xa3,0x08,
-0x00,0xe3,0x54,0xf6,0x2f,0x80,0xfc,0x00,0x1a,0xdf,0xcc,0xfc,0xbf,0xdb,0xfe,0xa4,
-0x8d,0x04,0x31,0xf6,0xdf,0xff,0x85,0x9f,0x00,0xc8,0x5b,0x20,0xf4,0xdf,0x7c,0x4b,
-0x04,0x06,0x00,0x02,0x18,0x00,0x43,0xdc,0xcc,0xcc,0xcf,0x12,0x00,0x00,0xf0,0x70,
-0x14,0x1c,0x18,0x00,0x00,0xe1,0x5b,0x04,0x18,0x00,0x02,0x24,0x00,0x02,0x18,0x00,
-0x13,0x10,0x20,0x68,0x20,0x08,0x71,0x4e,0x09,0x84,0x77,0x77,0x7f,0xf8,0x77,0x77,
-0x70,0x0a,0x8c,0x67,0x10,0x33,0x2c,0x01,0x22,0x33,0x30,0x1c,0x03,0x12,0xf7,0xc9,
-0x86,0x10,0x9c,0x08,0x00,0x00,0x84,0x2e,0x00,0x08,0x00,0x40,0xfd,0xdd,0xdd,0xde,
-0x08,0x00,0x66,0xe4,0x44,0x44,0x49,0xf7,0x00,0x28,0x00,0x48,0xd2,0x22,0x22,0x28,
-0x10,0x00,0x70,0xe5,0x55,0x55,0x5a,0xf7,0x00,0x0b,0x06,0x57,0x34,0xbd,0xfd,0xb6,
-0x08,0x4d,0x03,0x8e,0xb0,0x10,0x00,0x3d,0x7c,0x00,0xac,0x01,0xb0,0x0e,0xd0,0x0b,
-0xfd,0xcc,0xcf,0xe1,0x77,0xfe,0x76,0xbf,0xda,0xea,0xa1,0xff,0xff,0xdb,0xf1,0x00,
-0x0f,0xe1,0x79,0xfe,0x76,0x1e,0x00,0xa0,0x8f,0xe0,0x0b,0xfc,0xbb,0xbf,0xe0,0x0d,
-0xff,0xa0,0x1e,0x00,0x40,0x03,0xff,0xff,0x7b,0x37,0xb1,0xf1,0x01,0xbe,0xfe,0xbd,
-0xcf,0xff,0xff,0xfe,0x5f,0x7e,0xd2,0x3b,0xfb,0xaa,0xaf,0xe4,0xd0,0x88,0x7c,0x60,
-0xfe,0x01,0x0e,0xd0,0x0b,0xfa,0x7d,0x66,0x05,0x5a,0x00,0x32,0x0a,0xd2,0x11,0xd6,
-0xc4,0x32,0x12,0x35,0x72,0x6c,0x2b,0x00,0x6d,0x01,0x40,0x78,0x77,0xff,0x74,0xf0,
-0x7d,0x02,0x52,0x73,0x22,0x30,0x00,0x8c,0x2c,0x20,0x20,0x08,0xd7,0x3c,0x06,0x2d,
-0x2f,0x10,0xf1,0x33,0x16,0x01,0x2b,0xc8,0x12,0x1d,0x01,0x07,0xa2,0x02,0xdf,0xfe,
-0x44,0x44,0x48,0xf9,0x00,0x4f,0xfb,0x10,0x00,0x70,0x1e,0x80,0xee,0x55,0x55,0x58,
-0xf9,0xc5,0x2b,0x12,0xcc,0x49,0x34,0x41,0xef,0x77,0x77,0x7a,0x08,0x00,0x05,0x31,
-0x07,0x21,0x71,0x00,0xd3,0x26,0x54,0x7d,0xf9,0x77,0x77,0x50,0x50,0xa4,0x95,0x01,
-0x14,0x44,0x5f,0xd4,0x44,0x42,0x10,0x00,0x69,0x11,0x10,0xe5,0x22,0xba,0x03,0x32,
-0x88,0x12,0xf0,0x61,0x01,0x22,0xdf,0xf0,0x61,0x01,0x00,0x61,0x54,0x05,0x28,0x00,
-0x11,0xe2,0xd0,0x68,0x04,0xa0,0x00,0xa0,0x08,0x88,0xae,0x88,0x89,0xfc,0x88,0x81,
-0x00,0x4a,0x85,0xc1,0x30,0xe9,0x20,0x0c,0xab,0x91,0x51,0x17,0xef,0xc0,0x01,0x51,
-0xa2,0x02,0x02,0x65,0x01,0x61,0x23,0x68,0x10,0x0f,0xff,0xf5,0xbe,0x72,0xf1,0x0c,
-0x0f,0xcc,0xf2,0xbd,0x6b,0xc2,0x1c,0x60,0x0f,0x65,0xf1,0x7f,0x29,0xf1,0x8f,0x40,
-0x0f,0x99,0xf3,0x5f,0x67,0xe6,0xfd,0x31,0x0f,0xff,0xf9,0x17,0x02,0xf1,0x05,0x0f,
-0x88,0xf9,0xfc,0x33,0x33,0x7d,0xf4,0x0f,0x66,0xf3,0xbf,0x65,0x44,0xaf,0x81,0x0f,
-0xff,0xf2,0xef,0xc3,0xba,0xf0,0x12,0xbb,0xf9,0xf3,0xbc,0x96,0xaf,0x40,0x0f,0x65,
-0xff,0xc8,0xf8,0xf5,0x8e,0x00,0x0f,0xdd,0xf9,0x5f,0xf2,0xfd,0xef,0xc0,0x0f,0xff,
-0xf1,0x4f,0x81,0xaa,0xdf,0xa0,0x0c,0x40,0x58,0x65,0x10,0x8e,0xef,0x00,0x11,0x80,
-0x08,0x00,0x15,0x96,0x8f,0x0f,0xf1,0x15,0x02,0x55,0x55,0x54,0x07,0xfd,0xbb,0xb7,
-0x7f,0xff,0xff,0xd0,0xdf,0xff,0xff,0xb7,0xfb,0x67,0xfd,0x5f,0xb7,0xf7,0x00,0x7f,
-0x70,0x1f,0xd5,0xf3,0x7f,0x70,0x07,0xf7,0x01,0xfd,0x04,0x07,0x0f,0x00,0x10,0xd6,
-0x1a,0x02,0x70,0xf7,0x01,0xfd,0x5b,0xbe,0xfd,0xbb,0x8c,0x72,0x30,0x00,0xcf,0x60,
-0x1e,0x00,0x00,0x83,0xcc,0xe0,0x7f,0x70,0x1f,0xd0,0x07,0xfa,0xef,0x47,0xf7,0x01,
-0xfd,0x03,0xff,0x14,0x67,0x27,0x90,0xd3,0xff,0x70,0x08,0x77,0xfe,0xcc,0xfd,0x2e,
-0xcf,0x6c,0x45,0x60,0x1a,0x90,0x10,0x3b,0x21,0xd0,0xab,0xee,0xee,0xee,0x20,0x0b,
-0xdf,0xdb,0x7a,0xcc,0xcc,0xff,0x10,0xe2,0x08,0x10,0x53,0x26,0x3b,0x10,0xde,0x3e,
-0x27,0x40,0xee,0x00,0x01,0xfa,0x82,0x91,0xf1,0x07,0xfc,0x00,0x08,0xff,0xee,0x44,
-0xf7,0x02,0xfa,0x00,0x1f,0xfe,0xdf,0x46,0xfc,0xab,0xfd,0xa3,0x5f,0xf7,0x5f,0x48,
-0x00,0x01,0x30,0xf7,0x5f,0x40,0x65,0x1a,0xf1,0x11,0x04,0xf7,0x5f,0x56,0x66,0x66,
-0x3c,0xf0,0x01,0xf8,0x5f,0x6f,0xff,0xff,0x9e,0xe0,0x01,0xff,0xff,0x55,0x55,0x55,
-0x5f,0xc0,0x01,0xfc,0x99,0x20,0x00,0x5a,0xdf,0x70,0x8e,0x73,0x1d,0x4f,0x3b,0xb8,
-0x00,0x6c,0x04,0x01,0x11,0x46,0xf1,0x04,0x6b,0xff,0xbb,0x6a,0xaa,0xfe,0xaa,0xa1,
-0x00,0xfd,0x00,0x02,0x23,0xfc,0x22,0x10,0x03,0xf9,0x00,0xf1,0x43,0xf1,0x14,0x08,
-0xf5,0x00,0x4f,0x95,0xfc,0x4f,0xc0,0x0e,0xfe,0xee,0x5f,0xdc,0xfe,0xbf,0xc0,0x7f,
-0xfc,0xef,0x5f,0xca,0xfe,0x9f,0xc0,0xbf,0xf0,0x7f,0x5f,0xa7,0xfd,0x6f,0xc0,0x6f,
-0xf0,0x7f,0xc9,0x45,0x60,0x29,0xf0,0x7f,0x37,0x45,0xf8,0xbd,0x9d,0x41,0x8f,0x2e,
-0xeb,0xf4,0x33,0x62,0x30,0x14,0xff,0xe0,0xbb,0x1b,0xc1,0x9a,0x49,0xff,0xfe,0x96,
-0x40,0x04,0x70,0x00,0xcf,0x92,0x5b,0x27,0x72,0x14,0x10,0x34,0x91,0x21,0x67,0x10,
-0x00,0x01,0x21,0x80,0xef,0x99,0x4f,0x21,0xdb,0x57,0x29,0x0a,0xf1,0x03,0x9f,0x20,
-0x4f,0xf7,0x7d,0xf4,0x00,0x00,0xde,0x02,0xff,0xc8,0x9f,0xe8,0x80,0x01,0xfa,0x01,
-0x20,0x7f,0x70,0x07,0xff,0xff,0x3d,0xe0,0xce,0x0b,0xef,0xc6,0x91,0x2d,0xf7,0xdf,
-0x7d,0xf1,0x5f,0xf7,0x6f,0x2d,0xa7,0x8d,0xf0,0x05,0xf7,0x6f,0x2e,0xe0,0xbe,0x0b,
-0xf1,0x05,0xf7,0x6f,0x2f,0xfc,0xff,0xcf,0xf1,0x01,0xf7,0x7f,0x4f,0xec,0x08,0x00,
-0xf6,0x07,0xff,0xff,0x9f,0x70,0xbe,0x0b,0xf1,0x01,0xfc,0x9a,0xff,0x20,0xbe,0x8e,
-0xf0,0x00,0x83,0x02,0xc8,0x00,0x68,0xaf,0x21,0x52,0x21,0x7b,0xbb,0xa0,0x50,0x05,
-0xa0,0xa5,0x04,0x13,0xbf,0x04,0x11,0x10,0x03,0xe0,0xa7,0x07,0xd3,0xbe,0x21,0x0f,
-0xf2,0xa0,0x76,0x40,0x70,0x0f,0xf1,0x07,0x9b,0xbb,0x40,0xc0,0x0f,0xf1,0x0d,0xfa,
-0x66,0x91,0x40,0x0f,0xf1,0x04,0xff,0x10,0x0c,0xfb,0x00,0xce,0x6f,0x21,0x4f,0xd1,
-0xce,0x6f,0x61,0xe0,0x02,0x20,0x9f,0xff,0xf0,0x95,0xba,0x1a,0x4f,0x9f,0x50,0x12,
-0x07,0x95,0x4e,0x00,0x08,0x30,0x00,0x08,0x00,0x12,0x0e,0x61,0xd8,0xf3,0x14,0xf0,
-0x07,0x9f,0xfd,0x83,0x7a,0xff,0xf8,0x70,0x02,0xef,0xff,0xd4,0x4e,0xff,0xfc,0x20,
-0x3f,0xc9,0xf5,0x98,0xfa,0x8f,0x7d,0xf3,0x06,0x04,0x92,0x00,0x50,0x49,0x30,0x50,
-0x00,0x3d,0x6a,0x24,0x04,0x24,0x31,0x0b,0x50,0x89,0xf0,0x0b,0x08,0x8c,0x98,0x8f,
-0xf8,0x8a,0x98,0x80,0x00,0x7f,0xd0,0x0e,0xf0,0x4f,0xd4,0x00,0x1d,0xfd,0x29,0x9f,
-0xf0,0x04,0xef,0x90,0x05,0x80,0x5a,0x79,0x26,0x19,0x10,0x69,0xce,0x02,0x47,0x95,
-0x04,0xb5,0x34,0xe0,0x09,0xac,0xab,0xc9,0x9c,0xda,0xcb,0x91,0x00,0x5f,0x65,0xdd,
-0xce,0x45,0xe1,0x50,0x40,0x77,0xde,0xdf,0x85,0x08,0x00,0x40,0x8b,0xa4,0x37,0xc7,
-0x08,0x00,0x03,0xd5,0x33,0x84,0x13,0x33,0x6f,0xe3,0x33,0x32,0x00,0x06,0x00,0x7a,
-0xf1,0x11,0xfc,0xad,0xfd,0xad,0xda,0xcf,0x80,0x06,0xf6,0x3e,0xe4,0x4e,0xf3,0x4f,
-0x80,0x06,0xf6,0x9f,0xff,0xfe,0xed,0x5f,0x80,0x06,0xf6,0x26,0x31,0x00,0x67,0x9f,
-0x80,0x06,0x67,0x1e,0x17,0xfd,0x6b,0x13,0x41,0x6b,0x10,0x00,0xfb,0x43,0x24,0x20,
-0xa0,0x00,0x02,0x0d,0x00,0x78,0x7a,0x20,0xfb,0x03,0xc2,0x13,0x60,0x06,0xc4,0xfb,
-0x9f,0x30,0x00,0x2a,0x2f,0xf2,0x1e,0xfb,0x4f,0xa0,0x6f,0xff,0xff,0xcc,0xf1,0xfb,
-0x0e,0xf0,0x4b,0xdf,0xfb,0xaf,0xb0,0xfb,0x09,0xf5,0x00,0xaf,0xf6,0x4f,0x60,0xfb,
-0x03,0x61,0x02,0xff,0xff,0x61,0x10,0xfb,0x1d,0x80,0x0d,0xef,0xdb,0x50,0x00,0xda,
-0x9f,0x80,0x7f,0x6f,0x62,0x91,0x10,0x2c,0xc1,0x15,0x90,0x8f,0xf4,0x00,0x01,0x0f,
-0xc0,0x03,0x8f,0xff,0x01,0x19,0x21,0xc1,0xff,0x32,0xbf,0x42,0x0f,0xc0,0x8b,0x61,
-0x8a,0xbf,0x01,0x59,0x0e,0xc1,0x38,0xbe,0xff,0xe2,0xbb,0xbb,0xbb,0x90,0x4f,0xef,
-0xf6,0x12,0x52,0x0c,0xf0,0x04,0x0b,0xf1,0x02,0xfb,0x00,0x2f,0xd0,0x02,0x2c,0xf3,
-0x23,0xfa,0x00,0x1f,0xd0,0x5f,0xff,0xff,0xf6,0x08,0x00,0x50,0x4b,0xbf,0xfb,0xb5,
-0xfa,0x8c,0x41,0xb0,0x7f,0xfa,0x02,0xfe,0xcc,0xcf,0xd0,0x00,0xef,0xff,0xa2,0x30,
-0x00,0x41,0x09,0xfe,0xf8,0xf3,0x3d,0x01,0xf0,0x04,0xbb,0xf1,0x60,0x59,0x40,0x79,
-0x00,0x4f,0x2b,0xf1,0x00,0xdf,0x50,0xcf,0x40,0x04,0x0b,0xf1,0x05,0x43,0xa4,0x00,
-0x5c,0x49,0x10,0xf6,0x29,0x27,0x10,0x0b,0x1e,0x02,0x20,0x05,0xa2,0x7d,0x54,0x10,
-0x54,0xd2,0x04,0x41,0x8b,0xff,0x60,0xef,0x70,0x01,0xa2,0xe7,0x23,0xfe,0x99,0x99,
-0x93,0x02,0x3f,0xa0,0x09,0xd3,0x6a,0x80,0xa0,0x2f,0xf2,0xef,0x2e,0xd0,0x3f,0xff,
-0x01,0x03,0xf0,0x1c,0x2e,0x70,0x2b,0xdf,0xeb,0x69,0x10,0xef,0x02,0x00,0x00,0xaf,
-0xe3,0x06,0xf5,0xef,0x6f,0x50,0x02,0xff,0xff,0x3a,0xf2,0xef,0x2f,0xa0,0x0b,0xef,
-0xbe,0x6e,0xe0,0xef,0x0d,0xf0,0x5f,0x7f,0xa2,0x6f,0x80,0xef,0x09,0xf3,0x3c,0x86,
-0x4a,0xd0,0xef,0x06,0xf7,0x01,0x1f,0xa0,0x03,0x00,0xef,0x01,0x20,0x00,0x1f,0x9f,
-0xd2,0x02,0x63,0x2b,0x21,0x4e,0xc5,0x33,0x91,0xb0,0x00,0x01,0x62,0x00,0x00,0x04,
-0x7b,0xff,0x20,0x0c,0xf9,0xa1,0x1f,0x30,0xe7,0x13,0xdf,0xf2,0xc4,0xe0,0x3f,0xb0,
-0x8f,0xf9,0x89,0xff,0x30,0x01,0x2f,0xb1,0x5c,0x8d,0x7c,0xf7,0xd7,0x01,0x91,0x70,
-0x3f,0xff,0x60,0x00,0x39,0xdf,0xe9,0xac,0x48,0x9b,0xf0,0x14,0xef,0xf5,0x4e,0x86,
-0xff,0xa8,0x71,0x05,0xff,0xff,0x40,0x4f,0xff,0xff,0xf5,0x0d,0xdf,0xbe,0x6a,0xfe,
-0x40,0x4f,0xc0,0x6f,0x6f,0xb2,0x5f,0xb9,0xd6,0xef,0x40,0x3d,0x1f,0xb0,0x02,0x71,
-0x7a,0x00,0xf4,0x2b,0x11,0x3b,0x70,0xd1,0x41,0xb0,0x8d,0xff,0xa2,0xfc,0x2b,0x29,
-0x7d,0x83,0x52,0x04,0x12,0x21,0xe6,0x0e,0x11,0x7c,0xbc,0x69,0xf0,0x09,0x80,0x0e,
-0xff,0xe6,0x1f,0xe9,0x99,0xbf,0x80,0x03,0x3f,0xa0,0x0f,0xc0,0x00,0x4f,0x80,0x00,
-0x1f,0xa0,0x0f,0xe8,0x88,0xaf,0xb0,0x06,0x01,0xe9,0x4d,0x11,0x1b,0xe2,0xdc,0x00,
-0xbb,0x2f,0x21,0xf2,0x2f,0xf7,0x0b,0x30,0xff,0xfd,0x2a,0x73,0x6a,0x41,0x09,0xff,
-0xdf,0x70,0x74,0x7b,0x30,0xbf,0xa9,0x0b,0x1a,0x15,0xb0,0x4f,0x4f,0xa0,0x08,0xbb,
-0xff,0xbb,0x70,0x06,0x1f,0xa0,0xc1,0x40,0x00,0xf0,0x00,0x00,0x39,0x62,0x52,0xb3,
-0x00,0x1f,0xa0,0xef,0x4d,0x33,0x11,0x33,0x50,0x04,0xc0,0x05,0x9d,0xfe,0x13,0xff,
-0x77,0x72,0x00,0x0d,0xff,0xd5,0x2d,0x38,0x07,0x60,0x02,0x2f,0xa3,0xef,0x60,0x0b,
-0x14,0x2f,0x01,0x61,0x62,0x00,0x11,0x2b,0xf1,0x12,0x59,0x99,0x99,0x9f,0x90,0x1b,
-0xdf,0xeb,0x29,0x99,0x99,0xaf,0x90,0x00,0xbf,0xf3,0x0b,0xbb,0xbb,0xcf,0x90,0x02,
-0xff,0xfe,0x47,0x77,0x77,0x8f,0x90,0x0a,0xff,0xdf,0x9f,0x70,0x00,0xf0,0x18,0xaf,
-0xa3,0x10,0x23,0xd7,0x01,0x20,0x3f,0x3f,0xa1,0xf9,0xfa,0xaf,0x2c,0xd0,0x05,0x1f,
-0xa7,0xf6,0xfa,0x04,0x9c,0xf4,0x00,0x1f,0xbe,0xe1,0xfd,0x78,0xfb,0xf9,0x00,0x1f,
-0xa2,0x40,0x9f,0xff,0xe3,0x10,0x9a,0xcf,0x03,0xdf,0xad,0x01,0xf0,0xc2,0x10,0xbc,
-0x50,0xad,0x23,0xff,0xff,0xd3,0x09,0xf1,0x0e,0x11,0x00,0x22,0x00,0xff,0xfe,0x07,
-0xfe,0x11,0xdf,0xa3,0xdd,0x4a,0xef,0xf5,0x00,0x5d,0xff,0xb3,0x9f,0xf9,0x10,0x00,
-0x00,0x5d,0xf8,0x19,0xcb,0xbb,0x13,0x2e,0x01,0xdf,0x07,0x06,0xdf,0x97,0x08,0x07,
-0x00,0x11,0xac,0xeb,0x07,0x34,0xcb,0xcf,0xff,0x51,0x99,0x14,0x16,0x8e,0x6d,0x00,
-0x8a,0x02,0x05,0xc5,0x6e,0xf0,0x02,0xf9,0x9a,0x99,0x99,0xa9,0xaf,0xe0,0x0e,0xf0,
-0x3d,0xb0,0x09,0xd5,0x1f,0xe0,0x05,0x79,0xa3,0xbe,0xf2,0x02,0xd6,0x20,0x02,0xff,
-0xc2,0x04,0x40,0x3a,0xff,0x10,0x00,0x65,0x00,0x1f,0xd5,0xf8,0x45,0x64,0x79,0x36,
-0xbf,0x30,0x00,0x99,0x86,0x31,0xbb,0xff,0xfd,0x34,0x16,0x32,0x05,0xfe,0xfe,0x33,
-0x49,0x30,0xf6,0x5f,0xe5,0xc7,0xc2,0x70,0xff,0x60,0x06,0xff,0xe9,0x61,0x0d,0xde,
-0x01,0x42,0x2a,0xff,0xe1,0x03,0xde,0x8a,0x13,0x30,0x80,0x00,0x00,0xfd,0x37,0x10,
-0x8f,0xd4,0xc2,0x14,0x0e,0xf1,0x7f,0xf0,0x12,0xf1,0x3a,0x92,0x16,0xd7,0x2e,0xf1,
-0x07,0xb9,0xff,0xa1,0x06,0xdf,0xed,0x60,0x0c,0xff,0xb3,0x9e,0x70,0x04,0xcf,0xe1,
-0x03,0xb8,0x67,0xff,0x76,0x66,0x6b,0x40,0x00,0xaf,0x75,0x3b,0x01,0x84,0x9b,0x30,
-0xc8,0x22,0x11,0x08,0x00,0x40,0x6b,0xff,0xff,0xf4,0x08,0x00,0x41,0x8c,0xa9,0x6f,
-0x81,0x18,0x00,0x30,0x8f,0xff,0x41,0x08,0x00,0x40,0x8e,0xfc,0x5a,0xf5,0x08,0x00,
-0x53,0x9d,0x96,0x66,0x87,0xfe,0x99,0x05,0x11,0xed,0x80,0x94,0x10,0x80,0x51,0x02,
-0x02,0xf4,0xc2,0x03,0xa6,0x71,0x00,0xc2,0x26,0xe5,0xbc,0x00,0x00,0xdc,0x10,0x00,
-0x18,0x88,0xff,0x98,0x89,0xfe,0x88,0x81,0x0d,0x32,0x13,0x17,0x2e,0x38,0x13,0x2f,
-0x4a,0x5b,0x13,0x2f,0x8b,0x91,0x66,0x2f,0xd7,0x77,0x77,0x7d,0xf3,0x18,0x00,0xf0,
-0x0a,0x00,0x1e,0xf1,0x5f,0xa0,0x02,0x10,0x00,0x01,0xbf,0x90,0x4f,0x90,0x07,0xf2,
-0x28,0xcf,0xfc,0x00,0x3f,0xea,0xae,0xf1,0x0e,0xfc,0x16,0x66,0x07,0x5c,0x29,0x12,
-0x5a,0xf0,0x36,0x00,0xa3,0x10,0x10,0x34,0xab,0x10,0x21,0x3f,0x90,0x08,0x00,0x92,
-0x3b,0xcf,0xcb,0x8f,0x78,0xfa,0x5f,0xd0,0x4f,0x7b,0x13,0x50,0xd0,0x04,0x30,0x64,
-0x24,0xbf,0x49,0x31,0x0d,0x90,0xfb,0xde,0x35,0xb1,0x0b,0xb0,0xf8,0xbb,0xbe,0xfe,
-0xbb,0xb4,0x09,0xd2,0xf5,0xcd,0xe2,0x41,0x08,0xe4,0xf2,0xbf,0xc9,0x06,0xf0,0x04,
-0xf7,0xf0,0xbf,0xaf,0xaf,0xcd,0xf1,0x27,0xae,0xfd,0xbf,0x3f,0x3e,0x89,0xf1,0x5f,
-0xff,0xda,0xcf,0x08,0x00,0x80,0x17,0x40,0x00,0xbf,0x3f,0x3e,0xbc,0xf1,0x0b,0x03,
-0x35,0x2e,0x3c,0xaf,0x23,0x15,0x00,0xb4,0x18,0x20,0x05,0x72,0x4d,0x05,0x60,0xc4,
-0x44,0x1d,0xf8,0x55,0x52,0x0f,0x07,0x10,0x9f,0xaa,0x45,0xe2,0xf6,0x9f,0x63,0xff,
-0x39,0xf7,0x00,0x19,0xb1,0x3d,0x63,0xb9,0x12,0xd7,0x29,0x0a,0x00,0x8b,0x1e,0x60,
-0x67,0x77,0x8f,0xe7,0x77,0xfd,0xcb,0x18,0x30,0xaf,0xe9,0x99,0x57,0x4a,0x04,0x9e,
-0x72,0x12,0x40,0x8f,0x30,0x13,0xcf,0x7a,0x3d,0xf1,0x0f,0x78,0x8e,0xff,0xe8,0x88,
-0xbf,0x80,0x00,0x03,0xdf,0xaf,0xc0,0x00,0x9f,0x60,0x06,0xcf,0xe4,0x1f,0xc0,0xbe,
-0xff,0x20,0x07,0xc5,0x00,0x1f,0xc0,0x6b,0xb6,0x2a,0x78,0x20,0x08,0x81,0xe6,0x0c,
-0x70,0xd8,0x88,0x4f,0xf8,0x88,0x83,0x04,0xe3,0x2b,0xf4,0x03,0xff,0xff,0xf6,0x2f,
-0xf5,0xfd,0x08,0xfc,0x1f,0xf1,0x00,0x09,0x70,0x86,0x0a,0xf3,0x06,0x81,0x35,0x72,
-0x31,0x00,0x00,0x49,0xa9,0x85,0x30,0x00,0x07,0x77,0x3a,0x1e,0x24,0x77,0x73,0x4e,
-0x0c,0x01,0x62,0x92,0x43,0xbf,0x51,0x10,0x07,0xa9,0x06,0x80,0x04,0xaa,0xef,0xaa,
-0xaa,0xef,0xca,0xa0,0x01,0x82,0x02,0x78,0x9d,0x32,0x0b,0xe2,0xac,0x1a,0x80,0x30,
-0x10,0x8f,0xea,0x84,0x81,0x31,0x40,0x00,0x0b,0xe3,0xc8,0x50,0xa7,0x75,0x5f,0xe7,
-0x77,0x11,0xcc,0x01,0x03,0x18,0xf1,0x07,0x1e,0xf5,0xfc,0x06,0xf6,0x2f,0xe1,0x00,
-0x3e,0x90,0xac,0x5f,0xf3,0x08,0xe4,0x00,0x01,0x00,0x08,0xfe,0xee,0x50,0x6c,0xc8,
-0x40,0xb1,0x1c,0xfc,0x61,0xd8,0x83,0xf0,0x05,0x99,0x9a,0xff,0xff,0xb2,0x1e,0xd6,
-0x6f,0xff,0xff,0xf3,0x6c,0xc0,0x01,0x04,0x30,0x19,0x40,0x04,0x82,0xcc,0x16,0x40,
-0x1f,0xc0,0x0c,0xf1,0x65,0x74,0x30,0x09,0xf3,0x3f,0x3c,0x6f,0x51,0xa3,0x02,0x71,
-0xcf,0x30,0x62,0x93,0x00,0x69,0x04,0x14,0x0e,0xad,0x31,0x60,0x47,0x20,0x00,0x08,
-0x60,0x00,0xa5,0xdb,0x80,0x86,0x4f,0xf8,0x88,0x81,0x0a,0xff,0xff,0x72,0xb0,0x50,
-0xf2,0x5f,0xc2,0xfc,0x09,0x8f,0xca,0xe0,0x04,0x5c,0xfd,0xcc,0xfd,0xce,0xe9,0x00,
-0x00,0x5f,0xc6,0x66,0x66,0x69,0xdb,0x1d,0x03,0xf0,0x16,0x58,0x5f,0xc7,0x77,0x77,
-0x7a,0x08,0x00,0x03,0x18,0x00,0xf5,0x00,0x02,0x7f,0x92,0x24,0xfe,0x21,0x00,0x18,
-0x88,0xbf,0xc8,0x89,0xfe,0x88,0x82,0x95,0x72,0x22,0x6c,0xfc,0x0c,0xc1,0x22,0xeb,
-0x50,0x02,0x67,0x05,0x82,0xca,0x40,0x20,0x00,0x06,0x61,0x88,0x0b,0xb0,0x85,0x55,
-0x0f,0xf6,0x55,0x51,0x06,0xff,0xff,0xfe,0x8f,0x32,0x55,0xe2,0xe1,0x9f,0x42,0xdd,
-0x09,0xf6,0x00,0x07,0x61,0x38,0x4f,0xd2,0x12,0x93,0xb5,0x11,0x00,0xa6,0xaa,0x10,
-0xf6,0x86,0x3b,0x31,0x6f,0xd0,0x08,0x5d,0xa9,0x93,0xea,0x90,0x00,0x0d,0xf5,0x44,
-0x44,0x4f,0xd0,0x78,0x7b,0x10,0xd0,0x69,0x8a,0x42,0x66,0x66,0x66,0x50,0x89,0xaf,
-0x20,0xdd,0xd9,0x60,0xb1,0x42,0x99,0x99,0x9b,0xfb,0x18,0x00,0x10,0x68,0x08,0x00,
-0x03,0xa8,0x00,0x70,0x05,0x60,0x0f,0xe0,0x07,0x72,0x00,0x69,0xde,0x30,0xe0,0x2f,
-0xf2,0x8e,0x0f,0xd5,0x0f,0xe0,0xaf,0x60,0x00,0x0a,0xbb,0xfc,0xbf,0xfb,0xbf,0xbb,
-0xb0,0x20,0x01,0xf0,0x0a,0x01,0x7e,0xff,0xff,0xd7,0x10,0x00,0x04,0x8e,0xfe,0x3f,
-0xf6,0xef,0xfa,0x30,0x1e,0xff,0xb1,0x08,0x80,0x06,0xef,0xc0,0x04,0x92,0x2d,0x17,
-0x77,0x07,0x40,0x02,0x22,0x22,0x4f,0xd2,0xce,0xce,0xf1,0x13,0x0a,0xaa,0xab,0xff,
+0x17,0xd8,0x20,0x00,0x3a,0xa0,0x78,0x02,0x50,0x10,0x04,0xf7,0x08,0xf3,0x08,0x00,
+0x80,0x7a,0xfb,0x7c,0xf9,0x50,0x00,0xaf,0x11,0x38,0x00,0xf0,0x05,0xa0,0x3b,0xef,
+0xb4,0x26,0xf9,0x29,0xf5,0x10,0x5f,0xff,0xfb,0xbc,0xfd,0xbd,0xfc,0xb0,0x00,0xef,
+0x27,0x9a,0x08,0xd0,0xe1,0x03,0xff,0xa0,0x44,0x4b,0xf7,0x44,0x20,0x08,0xff,0xf5,
+0xcf,0x78,0x02,0xb1,0x0e,0xff,0xcd,0xdf,0x29,0xf4,0x7f,0x60,0x6f,0xdf,0x45,0x10,
+0x00,0xb1,0xac,0xaf,0x10,0xcf,0x29,0xf5,0x7f,0x60,0x35,0xaf,0x10,0x10,0x00,0xf8,
+0x09,0x00,0xaf,0x10,0x28,0xf7,0x29,0xe5,0x10,0x00,0xaf,0x13,0xbf,0xc2,0x04,0xef,
+0x80,0x00,0xaf,0x15,0xd5,0x00,0x00,0x1b,0xa0,0xfb,0x02,0x11,0x33,0x00,0x05,0x31,
+0x33,0x0b,0xf1,0xbf,0x09,0xf0,0x41,0xf1,0xee,0x00,0x00,0x0e,0xf7,0x77,0x87,0x3f,
+0xff,0xff,0xf5,0xee,0x70,0x0f,0xa7,0xfc,0xaa,0xef,0x3e,0xff,0x94,0xf7,0xdf,0x79,
+0x0c,0xe0,0xee,0xaf,0xdf,0x6f,0x9a,0xf2,0xf9,0x0e,0xe1,0xef,0xc0,0x41,0xaf,0x28,
+0x30,0xee,0x09,0xfa,0x00,0x0c,0xf4,0x00,0x0e,0xe1,0xff,0xf3,0x00,0xff,0x80,0x00,
+0xee,0xbf,0x9f,0xb0,0x3f,0xfe,0x00,0x0e,0xff,0xa0,0xdd,0x09,0xfc,0xf6,0x00,0xee,
+0x61,0x01,0x03,0xfd,0x0e,0xf2,0x0e,0x58,0x09,0xc1,0x50,0x5f,0xe2,0xbc,0xcc,0xcc,
+0xce,0x90,0x00,0x8c,0x00,0x00,0xc6,0x09,0x00,0x0b,0x02,0x12,0x07,0xc2,0x0a,0x0f,
+0x08,0x00,0x04,0x25,0x7f,0x80,0x08,0x00,0x40,0xfe,0xcc,0xcc,0x50,0x08,0x00,0x00,
+0xd0,0x00,0x00,0x08,0x00,0x39,0xfa,0x22,0x22,0x20,0x00,0x0f,0x08,0x00,0x01,0x93,
+0x01,0x8f,0x91,0x18,0xfa,0x11,0x11,0x10,0x8f,0x91,0x0b,0x21,0x6c,0xcc,0x01,0x00,
+0x23,0xc1,0x06,0x89,0x05,0x13,0x08,0x89,0x05,0x70,0x01,0x11,0x11,0x18,0xf9,0x11,
+0x11,0x90,0x00,0x21,0x06,0xf8,0x88,0x03,0x12,0x10,0x08,0x00,0x43,0x2f,0xc0,0x06,
+0xf9,0x08,0x00,0x00,0xd1,0x0a,0x00,0x08,0x00,0x31,0xfe,0xcc,0xcc,0x08,0x00,0x04,
+0x20,0x00,0x0a,0x08,0x00,0x36,0xd0,0x07,0xf9,0x01,0x07,0x31,0xf7,0x1d,0xdd,0x01,
+0x00,0x10,0xd6,0x60,0x06,0x10,0x0e,0x1a,0x07,0x0c,0x08,0x00,0x12,0x54,0x08,0x00,
+0x20,0x01,0xfc,0x08,0x00,0xf2,0x02,0x3e,0x50,0x01,0xfc,0x0f,0xfc,0x9e,0xf8,0xff,
+0xd0,0x01,0xfc,0x0f,0xff,0xbe,0xff,0xe6,0x18,0x00,0x14,0xf8,0x20,0x00,0x0c,0x08,
+0x00,0x22,0x01,0x20,0x08,0x00,0xf6,0x0c,0x04,0xf6,0x01,0xfd,0x6f,0xfd,0xad,0xf1,
+0x06,0xf6,0x2e,0xff,0xff,0xff,0xac,0xfe,0xdf,0xf2,0x1f,0xfc,0x96,0x30,0x04,0xef,
+0xff,0x80,0x02,0xdf,0x01,0x21,0x0a,0xf6,0x99,0x0d,0x32,0x40,0x0a,0xf6,0x4f,0x09,
+0x00,0xab,0x06,0x01,0x08,0x00,0x31,0xfd,0xbb,0xbb,0x08,0x00,0x12,0xf6,0xe0,0x03,
+0x01,0x28,0x01,0x21,0x2d,0xdd,0xb9,0x0b,0xf0,0x0f,0xd1,0x00,0x00,0x94,0x0d,0xf2,
+0x00,0x62,0x00,0x00,0x0b,0xfa,0x0d,0xf2,0x04,0xff,0x10,0x01,0xcf,0xd0,0x0d,0xf2,
+0x2e,0xf6,0x00,0x09,0xfc,0x10,0x0d,0xf7,0x9c,0x06,0x41,0x80,0x00,0x0a,0xff,0x21,
+0x01,0xf7,0x04,0x26,0xcf,0xfe,0x50,0x00,0x00,0x19,0xcf,0xff,0xfd,0x71,0x00,0x00,
+0x00,0x0c,0xff,0xc9,0x40,0x00,0x37,0x0a,0x05,0xf1,0x0b,0x20,0xde,0xff,0x59,0x00,
+0x10,0xd2,0x8e,0x00,0x11,0x0e,0x0a,0x0c,0x11,0xf1,0x08,0x00,0x00,0xa9,0x0d,0xf1,
+0x11,0x6e,0xf0,0x1b,0x20,0x01,0xef,0xcc,0xef,0x5e,0xf3,0xef,0xb0,0x0b,0xf9,0x00,
+0xdf,0x1e,0xff,0xf8,0x00,0x4f,0xda,0x63,0xfc,0x0e,0xfd,0x30,0x00,0x04,0x3e,0xfe,
+0xf5,0x28,0x00,0x51,0x02,0xdf,0xd0,0x0e,0xf0,0x7a,0x06,0xf9,0x0e,0x40,0x0e,0xf0,
+0x05,0xb2,0x00,0x5f,0xf7,0x00,0x0e,0xf1,0x07,0xf4,0x1c,0xff,0x80,0x00,0x0c,0xff,
+0xff,0xf1,0x08,0xd4,0x00,0x00,0x03,0xac,0xcb,0x50,0xd4,0x05,0x11,0xcf,0xd8,0x00,
+0xb0,0xf3,0xc5,0xcf,0x00,0x00,0x1b,0xef,0xcb,0xb6,0xf5,0xcf,0x14,0x00,0x00,0xab,
+0x07,0xb0,0xfe,0xd0,0x00,0xff,0xaa,0x8f,0xfe,0xff,0xfe,0xd0,0x04,0x55,0x02,0x90,
+0xcf,0x00,0x00,0x09,0xf3,0x1f,0xba,0x00,0xcf,0x90,0x07,0x90,0x3f,0xac,0xcc,0xff,
+0xcc,0xc5,0x8f,0x8e,0xaf,0x71,0x08,0x90,0xf6,0x2b,0x5f,0xfe,0x00,0x1e,0xff,0xf2,
+0x00,0xc1,0x0e,0xf0,0x15,0xcf,0xff,0xfc,0x00,0x00,0x0d,0xf1,0x1b,0xf8,0xcf,0x7f,
+0xa0,0x02,0xcf,0x53,0xef,0xa0,0xcf,0x0c,0xf8,0x2f,0xf8,0x00,0xb7,0x00,0xcf,0x01,
+0xa1,0x06,0x40,0x00,0x00,0x00,0xcf,0x00,0x00,0x50,0x00,0x00,0x18,0x50,0x00,0x01,
+0x00,0xf0,0x0e,0x4a,0xff,0xf2,0xaf,0xff,0xfa,0x00,0x01,0xff,0xc6,0x00,0xaf,0xaa,
+0xfa,0x00,0x01,0xfb,0x00,0x00,0xbf,0x01,0xfa,0x00,0x01,0xfe,0xbb,0x80,0xed,0x01,
+0x18,0x00,0xf0,0x2e,0xff,0xc5,0xf9,0x00,0xfd,0x73,0x01,0xfb,0x00,0x1f,0xf2,0x00,
+0x8e,0xe7,0x01,0xfe,0x99,0x78,0xa6,0x66,0x67,0x30,0x01,0xff,0xff,0xba,0xff,0xff,
+0xff,0xa0,0x01,0xfb,0x00,0x02,0xdc,0x22,0xbf,0x50,0x02,0xfc,0x69,0xb0,0x8f,0x65,
+0xfe,0x00,0x4f,0xff,0xff,0xe0,0x0e,0xfe,0xf4,0x00,0x2c,0xfd,0x41,0x00,0x0b,0xff,
+0xd1,0x50,0x00,0xf4,0x1a,0x39,0xef,0xfe,0xff,0xa4,0x01,0xfb,0x00,0x3f,0xf9,0x10,
+0x8e,0xf3,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x01,0x10,0x00,
+0x00,0x01,0xfe,0x00,0x00,0xdf,0x20,0x00,0x00,0x1f,0xe0,0x00,0x0d,0xf2,0x0f,0x00,
+0x12,0x03,0x0f,0x00,0x21,0x02,0xf9,0x0f,0x00,0xf1,0x02,0x22,0xef,0xf2,0x1f,0xfd,
+0xdd,0x7d,0xf5,0xef,0xd2,0x01,0xff,0xff,0xf8,0xdf,0xff,0xb1,0x1e,0x00,0x22,0xff,
+0x60,0x2d,0x00,0x14,0x30,0x3c,0x00,0x12,0x20,0x3c,0x00,0xf5,0x13,0x09,0xd2,0x1f,
+0xe0,0x38,0x4d,0xf2,0x00,0xaf,0x33,0xff,0xef,0xf6,0xcf,0x20,0x0d,0xf1,0xaf,0xff,
+0xc7,0x1a,0xff,0xde,0xfd,0x07,0xf9,0x30,0x00,0x2d,0xff,0xfd,0x30,0x01,0x00,0x01,
+0x00,0x2f,0x0f,0xf1,0x08,0x00,0x06,0xf0,0x48,0x97,0x00,0x0d,0xdd,0xdd,0x5f,0xf3,
+0x07,0xff,0x30,0x0f,0xff,0xff,0x5f,0xfa,0x6f,0xf4,0x00,0x00,0x00,0xdf,0x1f,0xff,
+0xfe,0x30,0x00,0x00,0x02,0xfd,0x0f,0xff,0xf2,0x00,0x00,0x00,0x09,0xf7,0x0f,0xfb,
+0xf9,0x00,0x00,0x00,0x2f,0xf1,0x0f,0xf2,0xef,0x70,0x00,0x00,0xdf,0x80,0x0f,0xf1,
+0x3f,0xf9,0x10,0x1c,0xfd,0x00,0x0f,0xf1,0x06,0xff,0xe4,0x3e,0xe2,0x01,0x2f,0xf1,
+0x00,0x5e,0xe2,0x03,0x20,0x2f,0xff,0xe0,0x00,0x01,0x30,0x00,0x00,0x0c,0xfc,0x40,
+0x5e,0x00,0xa1,0xa5,0x00,0x00,0x02,0xfa,0x00,0x00,0x05,0xff,0xc1,0x08,0x00,0x41,
+0x00,0x6e,0xe0,0xdf,0x08,0x00,0x70,0x01,0x30,0xdf,0x02,0xfb,0x7e,0xc0,0x69,0x00,
+0xf2,0x47,0x05,0xff,0xff,0xe0,0x0d,0xa2,0x00,0xdf,0xef,0xff,0x7e,0xe0,0x2d,0xff,
+0x5b,0xff,0xfd,0xfa,0x0e,0xe0,0x00,0x7a,0x2f,0xff,0x22,0xfa,0x0e,0xd0,0x00,0x00,
+0x03,0xdf,0x02,0xfa,0x0f,0xd0,0x00,0x08,0x90,0xdf,0x02,0xfb,0xef,0xb0,0x00,0x1f,
+0xf1,0xdf,0x02,0xfa,0xbb,0x30,0x00,0x9f,0x80,0xdf,0x00,0x10,0x04,0xc4,0x02,0xff,
+0x10,0xcf,0x10,0x00,0x07,0xf5,0x0b,0xf8,0x00,0xaf,0xdc,0xbb,0xcf,0xf1,0x01,0xa0,
+0x00,0x2c,0xff,0xff,0xfe,0x60,0x00,0x10,0xdd,0x00,0xf0,0x08,0x04,0xfa,0x20,0x0f,
+0xff,0xff,0xf0,0x00,0x03,0xcf,0xf1,0x0f,0xfc,0xcf,0xf0,0x00,0x00,0x06,0x60,0x1f,
+0xc0,0x0e,0xf0,0x1b,0x00,0xf0,0x1d,0x9f,0x80,0x0d,0xf4,0x42,0x1d,0x81,0x1b,0xfe,
+0x10,0x0a,0xff,0xf6,0x3d,0xff,0x39,0xc2,0x00,0x01,0x68,0x73,0x00,0x7b,0x05,0xbb,
+0xbb,0xbb,0xbb,0x30,0x00,0x00,0x06,0xff,0xff,0xff,0xff,0x30,0x00,0x08,0x90,0xaf,
+0x50,0x08,0xfb,0x76,0x01,0xf0,0x19,0x2f,0xe3,0x5f,0xf3,0x00,0x00,0x9f,0x70,0x05,
+0xff,0xff,0x60,0x00,0x03,0xfe,0x00,0x05,0xef,0xfe,0x60,0x00,0x0c,0xf6,0x3b,0xef,
+0xfc,0xcf,0xff,0xc4,0x04,0xc0,0x1f,0xfa,0x40,0x04,0xbf,0xd0,0x00,0x00,0x02,0x5c,
+0x00,0x60,0x10,0x00,0x66,0x00,0x00,0x0a,0xe2,0x01,0x21,0xff,0xc2,0x08,0x00,0x32,
+0x00,0x6f,0xfb,0x08,0x00,0x60,0x02,0xc3,0x00,0x0a,0xf3,0x00,0x01,0x01,0x00,0x60,
+0x00,0xf2,0x05,0xf1,0x05,0x71,0x01,0xfe,0xce,0xfc,0xcf,0xf1,0x0d,0xff,0x71,0xfb,
+0x0a,0xf2,0x0c,0xf1,0x00,0x6e,0x61,0x08,0x00,0xa1,0x01,0x01,0xff,0xdf,0xfe,0xdf,
+0xf1,0x00,0x01,0x21,0x28,0x00,0x32,0x00,0x0a,0xf4,0x18,0x00,0x22,0x3f,0xd1,0x08,
+0x00,0xa2,0xdf,0x51,0xfe,0xae,0xfb,0xae,0xf1,0x06,0xfd,0x01,0x20,0x00,0x92,0x84,
+0x01,0xfb,0x22,0x22,0x2b,0xe1,0x00,0x30,0xf8,0x00,0x50,0x05,0xfc,0x20,0x0f,0xff,
+0xe8,0x02,0xc1,0xaf,0xf3,0x0f,0xfc,0xcc,0xfa,0x00,0x00,0x06,0x90,0x1f,0xd0,0x79,
+0x01,0xf0,0x1b,0x00,0x4f,0xa0,0x02,0xfa,0x00,0x0c,0x80,0x00,0xcf,0x50,0x02,0xfb,
+0x00,0x3e,0xfe,0x5c,0xfc,0x00,0x00,0xff,0xe7,0x00,0x9e,0x2c,0xc1,0x00,0x00,0x49,
+0x94,0x00,0x01,0x01,0x9b,0xbb,0xbb,0xbb,0x70,0x00,0x04,0x90,0xcf,0xf0,0x02,0xc1,
+0x00,0x0d,0xf3,0xcf,0x10,0x00,0x5f,0xa0,0x00,0x8f,0xb0,0xcf,0x3b,0x00,0x21,0xff,
+0x20,0x10,0x00,0x31,0x0d,0xf8,0x00,0x20,0x00,0xa3,0x0a,0xe1,0x00,0xcf,0xbb,0xbb,
+0xce,0x90,0x00,0x20,0x66,0x02,0xa1,0x74,0x00,0x00,0x0b,0xf2,0x00,0x00,0x03,0xff,
+0xa1,0x08,0x00,0x51,0x00,0x8f,0xf5,0x00,0x0c,0x06,0x03,0xf2,0x01,0xa0,0xef,0xff,
+0xff,0xff,0x70,0x00,0x00,0x00,0xbc,0xcf,0xfc,0xcc,0x50,0x0b,0x92,0x28,0x00,0x32,
+0x2d,0xff,0x50,0x20,0x00,0x20,0x6d,0x18,0xc8,0x00,0x00,0xa1,0x01,0xa0,0xbb,0xef,
+0xeb,0xbb,0xb0,0x00,0x02,0xb0,0x00,0xdf,0x41,0x02,0xf0,0x0b,0x0a,0xf6,0x05,0xfb,
+0x04,0xb1,0x00,0x00,0x3f,0xd0,0x0d,0xf3,0x06,0xfa,0x00,0x00,0xdf,0x50,0x8f,0xc3,
+0x57,0xff,0x50,0x08,0xfc,0x02,0x30,0x00,0x92,0xd0,0x04,0xe3,0x00,0xcc,0xa8,0x64,
+0x2c,0xf2,0xf0,0x01,0x60,0x02,0x10,0x01,0xa3,0x00,0x00,0xdf,0x01,0x41,0x08,0xff,
+0x90,0x00,0xe7,0x01,0xa0,0x7f,0x96,0xaa,0xaf,0xfa,0xab,0x91,0x00,0x02,0x09,0x30,
+0x00,0xf0,0x0d,0xe0,0x02,0x00,0x09,0xf4,0x1f,0xf1,0x5f,0x90,0x4f,0xc3,0x09,0xf3,
+0x0e,0xf0,0x6e,0x30,0x3c,0xfe,0x09,0xfb,0x9f,0xf9,0xa8,0x00,0x00,0x64,0x0a,0x20,
+0x00,0xf0,0x2a,0x10,0x00,0x00,0x0c,0xfd,0xf3,0x05,0xfb,0x00,0x00,0x2d,0x3d,0xf3,
+0xfc,0x0d,0xf5,0x00,0x00,0xaf,0x6e,0xe0,0x9f,0xbf,0xb0,0x00,0x01,0xfe,0x3f,0xb0,
+0x1e,0xff,0x20,0x00,0x0a,0xf7,0x7f,0x60,0x8f,0xff,0xa1,0x00,0x3f,0xf1,0xef,0x9e,
+0xfe,0x7d,0xff,0xb1,0x08,0x81,0xb9,0x5f,0xa1,0x00,0x8e,0x90,0xd1,0x01,0x01,0x00,
+0x01,0xd0,0x51,0x00,0x00,0x17,0x80,0x00,0x00,0x04,0xff,0x80,0x00,0x0e,0xf2,0xf0,
+0x02,0x40,0xf3,0x00,0x07,0xf7,0x1e,0x00,0x63,0x55,0xcc,0xcd,0xec,0xcc,0xc0,0x58,
+0x02,0x72,0xf0,0x0c,0xa2,0x00,0x00,0x09,0xf6,0x00,0x01,0x00,0x08,0x00,0x32,0x00,
+0x8e,0x10,0x08,0x00,0x11,0x00,0x58,0x01,0x00,0x80,0x01,0x82,0xad,0xdf,0xfe,0xdd,
+0x60,0x00,0x0d,0xf3,0x18,0x00,0x21,0x6f,0xb0,0x08,0x00,0x31,0x01,0xef,0x20,0x08,
+0x00,0xb0,0x0a,0xf9,0x0c,0xdd,0xde,0xfe,0xdd,0xd6,0x06,0xe1,0x0e,0x50,0x00,0x13,
+0xf6,0xf0,0x02,0x00,0x7a,0x02,0x11,0x05,0xe9,0x04,0x41,0xdd,0x40,0x1f,0xf1,0xe6,
+0x02,0xf0,0x0e,0xf7,0x8f,0xff,0xff,0xff,0xb0,0x00,0x04,0xd7,0xff,0xa9,0x99,0xef,
+0x80,0x00,0x00,0x0e,0xff,0xb0,0x08,0xfe,0x00,0x06,0x81,0x05,0x48,0xfd,0xaf,0xe2,
+0x59,0x04,0xf1,0x12,0x01,0xcf,0xff,0x71,0x00,0x00,0x7f,0x57,0xcf,0xff,0xcf,0xff,
+0xc7,0x00,0x01,0x1e,0xfd,0x60,0x02,0x9e,0xf9,0x00,0x00,0xb7,0xeb,0xbb,0xbb,0xbb,
+0xa1,0x00,0x07,0xfb,0xff,0x08,0x02,0xa1,0x1e,0xf4,0xfa,0x00,0x00,0x3f,0xa0,0x00,
+0x9f,0x82,0x08,0x00,0x31,0x04,0xfe,0x12,0x18,0x00,0x87,0x03,0xe7,0x02,0xfe,0x99,
+0x99,0xbf,0xa0,0x80,0x00,0x01,0x01,0x00,0xb1,0x08,0xfa,0x10,0x9f,0x21,0xfa,0x08,
+0xf4,0x01,0xaf,0x80,0x08,0x00,0x31,0x00,0x04,0x00,0x08,0x00,0x22,0x02,0x00,0x08,
+0x00,0xf0,0x16,0x2f,0xd4,0x1e,0xef,0xa4,0xff,0xc8,0xf4,0x1a,0xfe,0x6f,0xdf,0xfc,
+0xff,0xfe,0xf4,0x00,0x44,0xaf,0xcf,0xdf,0xfc,0xff,0xf4,0x00,0x00,0xf9,0xcf,0x6e,
+0xfa,0xae,0xf4,0x00,0x69,0x32,0xee,0x01,0x38,0x00,0x40,0xcf,0x20,0xfc,0x01,0x38,
+0x00,0x30,0xfc,0x04,0xfa,0x08,0x00,0x40,0x08,0xf6,0x0a,0xf5,0x08,0x00,0x40,0x0e,
+0xf1,0x2f,0xe0,0x08,0x00,0x70,0x07,0xa0,0x2a,0x60,0x00,0xb8,0x08,0xb1,0x04,0x07,
+0x80,0x00,0xf2,0x09,0x43,0x00,0x06,0xfa,0x10,0x14,0x68,0xbf,0xfe,0x30,0x04,0xdf,
+0xe3,0xff,0xff,0xfd,0x94,0x00,0x00,0x07,0x40,0x87,0x5c,0xf2,0x23,0x00,0x00,0x88,
+0x03,0xb0,0x0b,0x60,0x0c,0xdd,0xdf,0xfe,0xdd,0xd2,0x4f,0xfd,0x2e,0xc8,0x00,0x32,
+0xf3,0x01,0xac,0x18,0x00,0x04,0x20,0x00,0x50,0x00,0x0a,0x50,0xef,0xff,0xe9,0x03,
+0xf1,0x03,0x4f,0xd0,0xee,0xaa,0xaa,0xdf,0x60,0x00,0xdf,0x40,0xec,0x00,0x00,0x6f,
+0x60,0x07,0xfb,0x00,0x08,0x00,0x31,0x2f,0xf3,0x00,0x20,0x00,0x85,0x0a,0x90,0x00,
+0xef,0xbb,0xbb,0xce,0x50,0x80,0x00,0x21,0x30,0x00,0x81,0x01,0xf1,0x04,0x07,0xfb,
+0x20,0x00,0x0f,0xe0,0x00,0x00,0x03,0xcf,0xd8,0xaa,0xae,0xfb,0xaa,0xa0,0x00,0x08,
+0x4d,0xa8,0x03,0x00,0x4a,0x05,0xf1,0x00,0xf9,0x06,0xf5,0x00,0x1e,0xa3,0x02,0x9f,
+0xe6,0x79,0xff,0x30,0x2b,0xff,0x48,0xc8,0x02,0xf1,0x0d,0x00,0x4a,0x03,0x86,0x53,
+0x21,0x07,0x90,0x00,0x01,0x00,0xae,0x0e,0x95,0xe5,0x00,0x00,0x0a,0xa0,0xbf,0x0f,
+0xa5,0xf6,0x00,0x00,0x3f,0xe0,0xcf,0x08,0x00,0xfb,0x11,0xcf,0x50,0xfd,0x0f,0xa5,
+0xf6,0x40,0x06,0xfc,0x07,0xf8,0x0f,0xa5,0xf6,0xc7,0x1f,0xf4,0x5f,0xf1,0x0f,0xa4,
+0xfb,0xe6,0x06,0xa0,0x2e,0x40,0x07,0x41,0xcf,0xd1,0x00,0x01,0x00,0x20,0x02,0xd5,
+0x06,0x00,0xf2,0x15,0x07,0xf0,0x0a,0xff,0xaf,0xff,0xff,0x80,0x07,0xf0,0x03,0xbf,
+0x6f,0x85,0x5f,0x8a,0xc7,0xf0,0x00,0x03,0x1f,0x5b,0x4e,0x8a,0xc7,0xf0,0x02,0x00,
+0x1f,0x5f,0x5e,0x8a,0xc7,0xf0,0x2f,0xd4,0x08,0x00,0x31,0x1a,0xfe,0x2f,0x08,0x00,
+0x32,0x00,0x54,0x1f,0x08,0x00,0x13,0x00,0x08,0x00,0x13,0x57,0x18,0x00,0x31,0xbf,
+0x4f,0x6f,0x38,0x00,0xf5,0x10,0xfc,0x1c,0x9f,0x29,0x68,0x97,0xf0,0x09,0xf6,0x01,
+0xed,0xc6,0x00,0x07,0xf0,0x1f,0xf1,0x4d,0xf2,0x6f,0x54,0x8d,0xf0,0x05,0x80,0x5c,
+0x20,0x09,0x64,0xfe,0x70,0x81,0x00,0xf0,0x0d,0xa2,0x00,0x21,0x0d,0xf1,0x05,0x00,
+0x8f,0xf6,0x4f,0xa0,0xdf,0x14,0xfb,0x00,0x8f,0xe1,0xdf,0x2d,0xf1,0xaf,0x40,0x00,
+0x54,0x07,0xf7,0xdf,0x3f,0xf6,0x05,0x80,0x26,0x0d,0xf2,0x33,0x01,0xda,0x10,0x0f,
+0x7d,0x01,0xc2,0x2c,0xfe,0x30,0xff,0xbb,0xbb,0xef,0x30,0x08,0xd0,0x0f,0xe0,0x1e,
+0x05,0x02,0x7c,0x05,0xf1,0x01,0x75,0x0f,0xf8,0x88,0x8d,0xf3,0x00,0x1f,0xd0,0xff,
+0x88,0x88,0xdf,0x30,0x0a,0xf5,0x2d,0x00,0xf4,0x08,0x04,0xfd,0x00,0xfe,0x00,0x00,
+0xaf,0x30,0xdf,0x50,0x0f,0xd0,0x06,0xcf,0xf2,0x02,0xa0,0x00,0xfd,0x00,0x3f,0xe9,
+0x00,0x81,0x04,0x32,0x01,0xed,0x32,0x3d,0x00,0x30,0x9f,0xf6,0xfd,0x36,0x00,0x70,
+0x00,0x05,0x92,0xfc,0x77,0x77,0xcf,0xca,0x06,0x01,0x18,0x00,0x40,0x04,0x81,0x02,
+0xfa,0x3f,0x00,0x32,0x0d,0xfe,0x52,0x28,0x00,0x80,0x7e,0x21,0xdb,0x77,0xbc,0x77,
+0x10,0x00,0xbb,0x07,0xf5,0x24,0xbf,0x12,0x30,0x00,0x03,0xc2,0xfe,0xaa,0xcf,0x8f,
+0xf2,0x00,0x0c,0xf6,0xff,0xff,0xcf,0xfd,0x60,0x00,0x6f,0xc1,0xfc,0x00,0xcf,0x50,
+0x10,0x01,0xef,0x32,0xfc,0x24,0xbf,0x11,0xf6,0x0a,0xf9,0x0a,0xff,0xff,0xbf,0xbc,
+0xf6,0x02,0xc1,0x07,0xfc,0x84,0x4e,0xff,0xc1,0xf1,0x00,0x13,0x42,0x79,0x01,0x22,
+0xff,0x96,0xc9,0x04,0x40,0x5e,0xc4,0xbb,0xdf,0xc9,0x04,0x50,0x01,0x20,0x00,0x8f,
+0x70,0x1e,0x04,0x90,0x1b,0xbb,0xef,0xcb,0xbb,0xb6,0x0d,0xd5,0x2f,0x20,0x00,0xf7,
+0x37,0xf9,0x18,0xfd,0x00,0x4f,0xf3,0x0b,0xf8,0x00,0x00,0x12,0x05,0xff,0xa9,0x21,
+0xdf,0xb3,0x00,0x03,0x6f,0xf5,0x6f,0x40,0x1d,0xf7,0x00,0x3f,0x79,0xa8,0x6f,0x77,
+0x8f,0x60,0x00,0x9f,0x51,0xfb,0x6f,0xcf,0x5f,0xb0,0x00,0xfe,0x0a,0xf4,0x6f,0x6f,
+0x8a,0xf2,0x07,0xf9,0x1d,0xa0,0x6f,0x4d,0x93,0xf6,0x0a,0xf3,0x00,0x1a,0xdf,0x41,
+0x00,0x10,0x00,0x50,0x00,0x0c,0xfb,0xf1,0x01,0xf0,0x10,0x01,0x50,0x00,0x00,0x4f,
+0x90,0x00,0x00,0x0b,0xfa,0x1b,0xbb,0xcf,0xdb,0xbb,0x50,0x05,0xff,0x8e,0xee,0xef,
+0xfe,0xee,0x60,0x00,0x2b,0x03,0x55,0x8f,0xb5,0x55,0x78,0x02,0x00,0x78,0x00,0xc1,
+0x00,0x2d,0x50,0x35,0x55,0x9f,0xb5,0x55,0x50,0x5f,0xfb,0xaf,0x91,0x02,0x70,0x01,
+0xc6,0x03,0x66,0x66,0x66,0x66,0x2d,0x02,0xf2,0x10,0xff,0xff,0xff,0xfd,0x00,0x00,
+0x2b,0x17,0xf8,0x55,0x55,0xfd,0x00,0x00,0xaf,0x67,0xff,0xee,0xee,0xfd,0x00,0x02,
+0xfe,0x07,0xf8,0x44,0x44,0xfd,0x00,0x0a,0xf7,0x20,0x00,0xf0,0x00,0x1e,0xf1,0x07,
+0xf4,0x00,0x7a,0xfd,0x00,0x01,0x50,0x07,0xf4,0x00,0x7f,0xd5,0x78,0x01,0x10,0x63,
+0xe1,0x08,0xf5,0x61,0x04,0xfc,0x20,0xfa,0x00,0x15,0xaf,0xd0,0x02,0xbf,0xec,0xfe,
+0xbb,0x8f,0xfc,0x71,0x00,0x06,0x5f,0xff,0xfe,0x8f,0x20,0x00,0x02,0x10,0x07,0xf6,
+0x50,0x8f,0x00,0x00,0x0e,0xf7,0x0a,0xdd,0xd0,0x8f,0xdd,0xd5,0x09,0xff,0x3e,0x8d,
+0xd0,0x8f,0xff,0xf6,0x00,0x36,0x6f,0xff,0xfe,0x9f,0x0e,0xa0,0x00,0x00,0x2d,0xcf,
+0xfb,0xaf,0x0e,0xa0,0x00,0x3a,0x10,0x0d,0xd2,0xbe,0x0e,0xa0,0x00,0x9f,0x75,0x8f,
+0xff,0xdd,0x0e,0xa0,0x00,0xee,0x6f,0xff,0xe6,0xfc,0x0e,0xa0,0x06,0xf9,0x16,0x2d,
+0xd3,0xf8,0x0e,0xa0,0x0d,0xf3,0x00,0x0d,0xd8,0xf4,0x0e,0xa0,0x04,0xa0,0x00,0x0d,
+0xd3,0xc0,0x0e,0xa0,0xf9,0x00,0x12,0x40,0x07,0x00,0x31,0x06,0xfd,0x42,0xa0,0x00,
+0xf1,0x00,0x01,0x9f,0xe3,0xfd,0x88,0x89,0xfd,0x00,0x00,0x04,0x52,0xfc,0x66,0x67,
+0xfd,0x92,0x01,0x00,0x18,0x00,0xb2,0x2d,0x70,0x02,0xfa,0x11,0x12,0xfd,0x00,0x5e,
+0xfe,0x12,0xe8,0x00,0x60,0x9a,0x01,0x77,0x77,0x77,0x76,0x2b,0x07,0x80,0x88,0x88,
+0x88,0x88,0x30,0x00,0x1c,0x2a,0x10,0x01,0xf2,0x04,0x50,0x00,0x8f,0x7a,0xf2,0xf5,
+0xca,0x7f,0x50,0x01,0xfe,0x0a,0xf1,0xf5,0xba,0x6f,0x50,0x09,0xf7,0x08,0x00,0xb0,
+0x2f,0xe0,0x9e,0xfb,0xfc,0xee,0xdf,0xc2,0x09,0x80,0xcf,0x28,0x00,0x17,0xf4,0x7b,
+0x01,0xf0,0x3b,0x32,0x00,0x13,0x00,0x00,0x06,0xe6,0x04,0xfd,0x00,0x8f,0x60,0x00,
+0x06,0xff,0x70,0xce,0x30,0xcf,0x97,0x73,0x00,0x29,0xdf,0xff,0xfd,0xff,0xff,0xf7,
+0x00,0x00,0xae,0xfc,0xbe,0xfa,0x55,0x52,0x0b,0x81,0x0b,0xf0,0x0a,0xfa,0x88,0x80,
+0x2c,0xfd,0x0d,0xfb,0xb7,0x8f,0xff,0xf3,0x00,0x63,0x0e,0xff,0xf9,0x00,0xcf,0x40,
+0x00,0x00,0x0f,0xc2,0xf9,0x01,0xfa,0x00,0x00,0x87,0x0f,0x92,0xfa,0x30,0x00,0xf3,
+0x17,0xee,0x4f,0x63,0xf9,0xbc,0xfe,0xb5,0x04,0xf9,0x8f,0x34,0xf6,0x01,0xf9,0x00,
+0x0b,0xf5,0xee,0x07,0xf5,0x01,0xf9,0x00,0x2f,0xe9,0xf8,0xbe,0xf2,0x8a,0xf9,0x00,
+0x07,0x73,0xc0,0xde,0x90,0xaf,0xe3,0xf5,0x01,0x02,0xf8,0x01,0xf1,0x00,0x0b,0xc0,
+0x00,0x00,0x0d,0xf4,0x07,0x77,0x7e,0xf9,0x77,0x71,0x03,0xfe,0x1e,0xd1,0x04,0xf2,
+0x14,0x00,0x99,0x03,0x98,0xf6,0x9f,0x59,0x10,0x00,0x00,0x1d,0xf7,0xf5,0x8f,0x6f,
+0xc0,0x4e,0x60,0xaf,0x55,0xf5,0x8f,0x27,0xf4,0x1f,0xf1,0x04,0x03,0xa3,0x59,0x10,
+0x30,0x07,0xf7,0x0a,0x00,0x03,0xf1,0x12,0x40,0x04,0x66,0x66,0x66,0xbf,0x30,0x00,
+0x8a,0x00,0xcc,0xcc,0xcc,0xef,0x30,0x00,0xef,0x13,0xfe,0xcc,0xcc,0xcc,0x30,0x05,
+0xfb,0x07,0xfb,0x77,0x77,0x77,0x60,0x0c,0xf4,0x28,0x00,0x91,0xb0,0x1e,0xe0,0x00,
+0x00,0x00,0x78,0xcf,0x60,0x61,0x08,0x26,0xaf,0xe9,0xfe,0x00,0x12,0x81,0x07,0x00,
+0x32,0x07,0xfe,0x5b,0x18,0x01,0xe0,0x8f,0xaa,0xfb,0xbb,0xec,0xbb,0xb3,0x00,0x04,
+0x0a,0xf2,0x00,0xef,0x30,0x4a,0x05,0xf0,0x0a,0xf4,0x67,0xff,0x66,0x50,0x0a,0x70,
+0x0b,0xf6,0xff,0xee,0xef,0xd0,0x3e,0xfd,0x0b,0xf6,0xf8,0x33,0x3f,0xd0,0x00,0x96,
+0x0c,0xf5,0x10,0x00,0x00,0xba,0x00,0x01,0x10,0x00,0x31,0x49,0x0f,0xd4,0x09,0x05,
+0xf7,0x15,0xbf,0x7f,0xb1,0x52,0xcf,0x25,0x30,0x02,0xfd,0x7f,0x77,0xf6,0xcf,0x5f,
+0xb0,0x0a,0xf7,0xdf,0x5f,0xe0,0xcf,0x1c,0xf4,0x1f,0xf6,0xfb,0x4e,0x79,0xef,0x04,
+0xc4,0x04,0x72,0xb3,0x00,0x1f,0x7f,0x00,0x04,0xf8,0x03,0x40,0x05,0xf9,0x01,0xff,
+0xf1,0x08,0xe1,0x02,0xcf,0xd2,0xfc,0x66,0x68,0xfa,0x00,0x00,0x09,0x41,0xff,0xff,
+0x91,0x6a,0x0a,0xf9,0x45,0xfa,0x3f,0x91,0xfa,0x00,0x0c,0x60,0x8d,0xfe,0xdf,0xed,
+0xff,0xd3,0x5f,0xfb,0xaf,0xbb,0xbb,0xbb,0xbd,0xf3,0x02,0xd9,0x9f,0x88,0x88,0x88,
+0x8c,0xf3,0x00,0x00,0x26,0xff,0xff,0xff,0xfc,0x41,0x00,0x0a,0x23,0xfb,0x55,0x56,
+0xfb,0x00,0x00,0x5f,0xb3,0xff,0xee,0xef,0xfb,0x00,0x00,0xdf,0x43,0xfa,0x44,0x45,
+0xfb,0x00,0x07,0xfc,0x03,0xff,0xff,0xff,0xfb,0x00,0x0d,0xf3,0x03,0xf8,0x00,0x78,
+0xfb,0x00,0x00,0x60,0x03,0xf8,0x00,0xcf,0xd4,0x6d,0x05,0xf2,0x00,0x04,0x30,0x00,
+0x00,0x04,0xa1,0x00,0x00,0x7f,0xb0,0x00,0x00,0x08,0xfd,0x8f,0xe9,0x05,0xf0,0x3f,
+0x6f,0x89,0xbf,0xb9,0x9d,0xe9,0x90,0x00,0x02,0x05,0xee,0x51,0x0d,0xfa,0x00,0x08,
+0x10,0xcf,0xe4,0xef,0x21,0xaf,0xd1,0x4f,0xe3,0x8a,0x2d,0xf6,0x7e,0x28,0xc0,0x05,
+0xfb,0x05,0xef,0xa7,0xbf,0xe1,0x00,0x00,0x40,0x0e,0xff,0xff,0xfb,0xfa,0x00,0x00,
+0x24,0x06,0x6d,0xff,0xf3,0x44,0x00,0x00,0x9f,0x32,0xcf,0xb3,0xfb,0x8f,0xb0,0x00,
+0xef,0xbf,0xff,0x30,0xbf,0xfb,0x10,0x06,0xf9,0xcc,0xbf,0x30,0x3e,0xf7,0xf3,0x0b,
+0xf4,0x02,0xbf,0xdf,0x93,0xff,0xc2,0x1c,0xb0,0x02,0xff,0xea,0x40,0x3d,0xe1,0x00,
+0x10,0x00,0x52,0xfe,0x00,0x00,0x5a,0x0c,0xf1,0x04,0x02,0xe7,0x00,0xbf,0x0b,0xf0,
+0xaf,0x10,0x03,0xef,0xa6,0xdf,0x7d,0xf6,0xdf,0x74,0x00,0x0a,0x4f,0x68,0x04,0x00,
+0x83,0x06,0xf2,0x08,0x4c,0xf4,0xcf,0x42,0x09,0x80,0x00,0x9d,0x08,0xb0,0x8c,0x10,
+0x1c,0xfd,0x19,0x99,0x99,0x99,0x99,0x94,0x00,0x67,0x1f,0x39,0x08,0xf2,0x03,0x00,
+0x1f,0xa0,0x0c,0xf0,0x06,0xf6,0x00,0x09,0x2a,0xd8,0x8e,0xf9,0x8b,0xc4,0x00,0x5f,
+0x80,0x08,0x03,0xf6,0x0f,0xbf,0x20,0xfc,0x0c,0xf0,0x7f,0x50,0x03,0xfb,0x00,0xfc,
+0x0c,0xf1,0x8f,0x50,0x0a,0xf4,0x00,0xfc,0x0c,0xf8,0xff,0x20,0x08,0xd0,0x00,0x54,
+0x0c,0xf2,0x62,0xfd,0x00,0xf0,0x0e,0x60,0x00,0x0d,0xd0,0x0d,0xe0,0x00,0x07,0xfe,
+0x6d,0xdf,0xfd,0xdf,0xfd,0xd2,0x00,0x8f,0xbb,0xbf,0xfb,0xbf,0xfb,0xb1,0x00,0x04,
+0x00,0x0a,0xa0,0x0a,0xa7,0x03,0xf3,0x0a,0x4d,0xdd,0xdd,0xdd,0xdd,0xd4,0x1e,0xa1,
+0x5e,0xee,0xff,0xff,0xfe,0xe5,0x3e,0xfd,0x00,0x00,0xf7,0x2f,0x40,0x00,0x01,0xb6,
+0x0f,0xf1,0x09,0xf0,0x27,0x0f,0xeb,0xfc,0xcf,0xbe,0xf0,0x00,0x0d,0x6f,0xc3,0xf6,
+0x7f,0x3a,0xf0,0x00,0x7f,0xaf,0xc7,0xff,0xdf,0xcb,0xf0,0x01,0xef,0x2f,0xde,0xb8,
+0xfc,0xff,0xf0,0x09,0xf9,0x0f,0xdb,0x26,0xf1,0x4a,0xf0,0x0e,0xf2,0x0f,0xc0,0x00,
+0x10,0x3c,0xf0,0x01,0x60,0x0f,0xc0,0x00,0x00,0xdf,0xa0,0x88,0x02,0x90,0x3f,0x90,
+0x00,0x00,0x07,0xf8,0x00,0x00,0x3f,0x99,0x0d,0xf1,0x03,0xdf,0x80,0x00,0x3f,0xc5,
+0x55,0x30,0x00,0x1e,0x47,0x77,0x9f,0xc7,0x77,0x72,0x00,0x01,0x0f,0x90,0x02,0xf0,
+0x09,0x0a,0x50,0x0f,0xb0,0xaf,0x12,0x38,0xe0,0x2d,0xfa,0x0f,0xbb,0xff,0xff,0xd3,
+0x30,0x00,0xa8,0x0f,0xa4,0xbf,0x41,0x1b,0x80,0xf8,0x00,0xf4,0x25,0x7f,0xff,0xff,
+0x80,0x00,0x3d,0x5f,0x90,0x03,0x67,0x53,0x00,0x00,0x9f,0x7f,0x73,0x25,0xbd,0x1b,
+0x20,0x01,0xfd,0x7f,0x5f,0xaf,0x2e,0x8b,0xb0,0x08,0xf6,0xbf,0x6f,0x7f,0x15,0x8a,
+0xf2,0x0e,0xf2,0xfc,0xbb,0x6f,0x53,0xac,0xd7,0x03,0x72,0xe5,0x12,0x2d,0xff,0xf5,
+0x10,0x71,0x02,0x10,0x01,0xe3,0x0b,0xf7,0x64,0x07,0x30,0x00,0x0d,0xd2,0x00,0xfe,
+0x00,0x1f,0x90,0x00,0x03,0xee,0xaf,0xff,0xfa,0x4f,0x60,0x00,0x00,0x35,0x9f,0x44,
+0xfa,0x7f,0xca,0xa4,0x00,0x00,0x9f,0xff,0xfa,0xcf,0xff,0xf6,0x2c,0x40,0x9f,0x44,
+0xfc,0xfc,0x0c,0xc0,0x2d,0xf6,0x9f,0xff,0xff,0xff,0x0f,0x90,0x01,0xa1,0x36,0xeb,
+0x58,0xff,0x5f,0x70,0x00,0x00,0xaa,0xff,0xaa,0x1f,0xbf,0x40,0x00,0x53,0xdf,0xfd,
+0xdd,0x0b,0xff,0x00,0x00,0xdd,0x0b,0xe7,0x74,0x06,0xfb,0x00,0x03,0xf8,0x0e,0xff,
+0xf9,0x05,0xfa,0x00,0x0a,0xf2,0x5f,0x72,0xf8,0x1e,0xff,0x60,0x1f,0xc3,0xef,0x69,
+0xf8,0xdf,0x4d,0xf4,0x19,0x55,0xe3,0x6f,0xc4,0xd4,0x02,0xb0,0x77,0x02,0x22,0x1f,
+0xf0,0x08,0x00,0x19,0x2f,0x08,0x00,0xe0,0x1d,0x70,0x2f,0xf0,0x00,0x6a,0x40,0x00,
+0x6f,0xa0,0x3f,0xd0,0x00,0xbf,0xe7,0x0b,0xc0,0x5f,0xc0,0x01,0xff,0x10,0x04,0xfe,
+0x10,0x7f,0xe0,0x08,0xf9,0x8d,0x0a,0xa1,0xbf,0xf4,0x0b,0xf1,0x00,0x00,0x10,0x02,
+0xff,0xfa,0x2e,0x09,0x31,0x09,0xfb,0xdf,0x44,0x05,0x50,0x5f,0xf3,0x5f,0xe2,0x00,
+0xa0,0x0a,0xf0,0x01,0x80,0x0a,0xff,0x50,0x00,0x03,0xbf,0xf9,0x00,0x00,0xbf,0xfd,
+0x71,0x1e,0xff,0x60,0x1b,0x06,0x31,0xe2,0x04,0x91,0x66,0x05,0x42,0x50,0x00,0x0d,
+0xe0,0x6e,0x00,0xa0,0x0d,0xe0,0x02,0x33,0x33,0x33,0x31,0x00,0x0d,0xe0,0x82,0x0a,
+0xf0,0x06,0xf5,0x00,0x0d,0xe1,0x19,0xaa,0xbf,0xfa,0xa3,0x0c,0x8d,0xe8,0xf1,0x00,
+0x2f,0xd0,0x00,0x0e,0x8d,0xec,0xb0,0x08,0x00,0x40,0x1f,0x6e,0xff,0x40,0x08,0x00,
+0x40,0x4f,0x3f,0xd1,0x00,0x08,0x00,0x31,0x02,0x1f,0xc0,0x08,0x00,0x32,0x00,0x4f,
+0xe3,0x08,0x00,0x31,0x9f,0xff,0x30,0x08,0x00,0x30,0xef,0x5f,0xf2,0x08,0x00,0xf0,
+0x11,0x09,0xfb,0x04,0xa0,0x00,0x3f,0xd0,0x00,0x3f,0xf3,0x00,0x00,0xdf,0xff,0xb0,
+0x00,0x08,0x50,0x00,0x00,0x8f,0xfb,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x20,0x01,0xff,0x01,0x00,0x40,0xfb,0x00,0x01,0xbb,0x01,0x00,0xf3,0x05,0xfb,
+0x00,0x00,0x39,0x99,0x99,0x99,0x99,0xfb,0x00,0x00,0x4a,0xaa,0xaa,0xaa,0xaa,0xfb,
+0x00,0x01,0xaa,0x08,0x00,0x03,0x28,0x00,0x50,0x00,0x00,0x00,0x0a,0xa0,0x06,0x00,
+0xf0,0x2b,0x1d,0x60,0x2f,0xe0,0x00,0xb8,0x00,0x00,0x8f,0x60,0x4f,0xf1,0x03,0xfc,
+0x00,0x03,0xfe,0x00,0xbf,0xf9,0x0c,0xf3,0x00,0x01,0x94,0x05,0xff,0xcf,0x75,0x70,
+0x00,0x00,0x01,0x8f,0xf6,0x1e,0xfa,0x30,0x00,0x16,0xaf,0xff,0x50,0x02,0xdf,0xfd,
+0xa3,0x1e,0xfe,0x81,0x00,0x00,0x05,0xcf,0xe0,0x03,0x20,0x00,0x01,0x00,0x71,0x10,
+0x00,0x00,0x00,0x3f,0x90,0x00,0x01,0x00,0x23,0x3f,0xa0,0x08,0x00,0x40,0xff,0xff,
+0xff,0x90,0x08,0x00,0x45,0xeb,0xbb,0xbb,0x70,0x20,0x00,0x90,0x9c,0xcc,0xdf,0xec,
+0xcc,0xc1,0x00,0x00,0xbf,0x80,0x00,0x88,0xf2,0x00,0x00,0xbf,0x10,0x00,0x00,0x0c,
+0x08,0x00,0x03,0x18,0x00,0x10,0x8b,0xc0,0x00,0xf0,0x20,0xb1,0x00,0x00,0x75,0x01,
+0x20,0x24,0x03,0x92,0x00,0x04,0xfc,0x0f,0xd0,0xbf,0x26,0xfe,0x10,0x0d,0xf5,0x0e,
+0xf0,0x5f,0x80,0xbf,0xb0,0x5f,0xa0,0x0c,0xf1,0x0f,0xb0,0x3f,0xe2,0x01,0x00,0x03,
+0x20,0x01,0x00,0x02,0x00,0x00,0x00,0x53,0x00,0x44,0x60,0x00,0x40,0x03,0xff,0x11,
+0xfd,0x08,0x00,0x91,0x0c,0xfd,0x88,0xef,0xa8,0x88,0x60,0x00,0x6f,0xe9,0x00,0xb1,
+0xd0,0x04,0xff,0xd2,0x22,0xdf,0x32,0x22,0x10,0x4f,0xff,0x01,0x00,0xf2,0x14,0x00,
+0x0a,0x8f,0xe7,0x77,0xef,0x77,0x77,0x00,0x00,0x1f,0xfb,0xbb,0xff,0xcb,0xbb,0x00,
+0x00,0x1f,0xe9,0x99,0xef,0xa9,0x99,0x00,0x00,0x1f,0xe8,0x88,0xef,0x88,0x88,0x70,
+0x00,0x1f,0x38,0x00,0xf1,0x11,0x00,0x6d,0x71,0x20,0x13,0x11,0x66,0x00,0x01,0xff,
+0x1b,0xf0,0x6f,0x71,0xef,0x30,0x0a,0xf9,0x09,0xf3,0x1f,0xd0,0x5f,0xd0,0x1d,0xe0,
+0x08,0xf3,0x0d,0xc0,0x0d,0xe3,0xfa,0x00,0x62,0x00,0x01,0x00,0x00,0x01,0x20,0xf6,
+0x00,0xf3,0x6a,0x0a,0xf6,0x00,0x00,0xcf,0x6c,0x00,0x00,0x1f,0xfc,0xba,0x30,0xcf,
+0x8f,0x70,0x00,0x7f,0xff,0xff,0x60,0xcf,0x0e,0x90,0x02,0xff,0x40,0xbf,0xba,0xef,
+0xab,0x90,0x0c,0xf7,0xed,0xfd,0xff,0xff,0xff,0xf0,0x8f,0xa2,0x3e,0xf6,0x22,0xff,
+0x52,0x20,0x08,0x8f,0x8f,0xe0,0x04,0xff,0xa0,0x00,0x00,0x0a,0xff,0x40,0x0c,0xff,
+0xf1,0x00,0x00,0x4e,0xf8,0x00,0x9f,0xb6,0xfc,0x00,0x1b,0xff,0x80,0x1b,0xfe,0x10,
+0xcf,0xd1,0x08,0xd4,0x00,0x7f,0xd2,0x00,0x1c,0x90,0x00,0x85,0x00,0x24,0x13,0x01,
+0x76,0x00,0x05,0xfb,0x0d,0xf0,0x8f,0x61,0xff,0x20,0x1e,0xf3,0x0b,0xf1,0x3f,0xb0,
+0x6f,0xb0,0x5e,0x90,0x0a,0xe2,0x0e,0xb0,0x0d,0xc1,0x00,0x00,0x88,0x00,0x04,0x01,
+0x00,0x40,0x1d,0x80,0x00,0x05,0x09,0x01,0xf0,0x0c,0x1f,0x90,0x05,0x6a,0xfc,0x66,
+0x40,0x00,0x1f,0x90,0x0c,0xff,0xff,0xff,0xc0,0x02,0x2f,0x9a,0x9c,0xf0,0x00,0x1f,
+0xc0,0x0f,0x8f,0x9f,0xac,0x10,0x00,0xf1,0x0c,0x0f,0x7f,0xdf,0x4c,0xf4,0x44,0x5f,
+0xc0,0x3f,0x5f,0xca,0x0c,0xfe,0xee,0xef,0xc0,0x5e,0x3f,0x80,0x0c,0xf3,0x33,0x4f,
+0xc0,0x00,0x4f,0x70,0x30,0x00,0xf6,0x22,0x00,0x7f,0xd1,0x04,0x5a,0xf7,0x55,0x40,
+0x00,0xbf,0xfd,0x51,0x9b,0xef,0x33,0x30,0x01,0xfd,0x6b,0xeb,0xfa,0x2a,0x1d,0xd0,
+0x0a,0xf7,0x02,0xf8,0xfa,0x00,0x9b,0xf6,0x4f,0xd0,0x07,0xf3,0xfe,0x89,0xfa,0xec,
+0x0b,0x30,0x00,0x50,0x9f,0xff,0xe3,0x41,0x00,0x01,0x00,0x12,0x12,0x93,0x00,0x20,
+0x5a,0xff,0xfd,0x01,0xfa,0x08,0x05,0xdf,0xff,0xfd,0x3f,0xff,0xff,0xe0,0x08,0xfa,
+0xf8,0xcb,0x1f,0xcd,0xcd,0xe0,0x08,0xf4,0xf8,0xdb,0x1f,0x8a,0x8a,0x08,0x00,0x20,
+0xff,0xff,0x08,0x00,0xf3,0x2e,0xcc,0x1f,0xc8,0x88,0x70,0x09,0xf3,0xf8,0xae,0x1f,
+0x80,0x01,0x70,0x09,0xf2,0xf8,0x8f,0x2f,0xa0,0x05,0xf4,0x0a,0xf2,0xf8,0x4f,0x8e,
+0xff,0xff,0xf1,0x0c,0xd2,0xf8,0x0d,0xf6,0x78,0x88,0x30,0x0f,0xa2,0xf8,0x03,0xff,
+0x81,0x00,0x00,0x5f,0x62,0xf8,0x00,0x3d,0xff,0xda,0x84,0x3e,0x12,0xf8,0x00,0x00,
+0x49,0xdf,0xf2,0x7c,0x00,0x01,0x96,0x01,0x90,0x2f,0xe0,0x00,0x00,0x02,0xfd,0x00,
+0x02,0xfe,0x0c,0x00,0x1a,0xd0,0x0f,0x00,0x71,0xfc,0xcc,0xdf,0xfc,0xcc,0x70,0x02,
+0xe5,0x01,0xb2,0xf9,0x00,0x2f,0xd2,0x22,0x22,0x22,0x22,0x10,0x03,0xfc,0x3e,0x00,
+0x83,0x4f,0xfc,0xcc,0xcc,0xcc,0x90,0x00,0x07,0x23,0x03,0xf0,0x01,0xbf,0x83,0x33,
+0x33,0x7f,0xb0,0x00,0x1f,0xf2,0x00,0x00,0x04,0xfb,0x00,0x09,0xfc,0x22,0x00,0x41,
+0xb0,0x02,0xff,0x30,0x0f,0x00,0x21,0x06,0x80,0x0f,0x00,0x06,0xf7,0x00,0xa0,0xce,
+0x00,0x02,0x35,0x8b,0x30,0x0a,0xf1,0xce,0x09,0x40,0x01,0x80,0x0a,0xf1,0xce,0x0a,
+0xfa,0x76,0x42,0x00,0x08,0x00,0x10,0xf2,0x1f,0x02,0xf4,0x48,0xf9,0xef,0x8a,0xf7,
+0x55,0x56,0x30,0x0a,0xff,0xff,0xfa,0xff,0xff,0xff,0xb0,0x0a,0xf3,0x11,0x1a,0xff,
+0xb5,0x8f,0x80,0x0a,0xf1,0x00,0x0a,0xfe,0xd0,0x7f,0x50,0x0b,0xff,0xff,0x3b,0xf8,
+0xf3,0xcf,0x20,0x0c,0xfb,0xdf,0x3c,0xf2,0xfa,0xfc,0x00,0x0d,0xe0,0x7f,0x3d,0xf0,
+0xbf,0xf5,0x00,0x0f,0xc0,0x7f,0x4f,0xc0,0x6f,0xf0,0x00,0x2f,0x90,0x7f,0x7f,0x93,
+0xff,0xfa,0x00,0x8f,0x40,0x7f,0xcf,0xbf,0xf6,0xcf,0xc0,0x3c,0x00,0x7f,0x9d,0x3d,
+0x20,0x0b,0x70,0x7e,0x00,0x12,0x01,0xe0,0x02,0xe0,0x50,0x01,0xdd,0xdd,0xdd,0xdd,
+0xff,0xdd,0x40,0x00,0x08,0x80,0x00,0x02,0xb2,0x00,0x22,0x0f,0xe0,0x08,0x00,0x22,
+0x4f,0xa0,0x08,0x00,0x91,0x7f,0x81,0x11,0x14,0xfd,0x11,0x10,0x00,0xcf,0x30,0x00,
+0x80,0xf1,0x00,0xbb,0xbb,0xbd,0xff,0xff,0xbb,0xc8,0x00,0x21,0x5f,0xf8,0x07,0x01,
+0x30,0x1a,0xff,0x42,0x08,0x00,0x30,0x3a,0xff,0xc2,0x30,0x00,0x31,0x2d,0xff,0xe6,
+0x38,0x00,0x61,0x0b,0xe7,0x10,0x08,0xef,0xfb,0x6b,0x00,0x4e,0x04,0xff,0xc3,0x00,
+0x01,0x00,0xf0,0x14,0x0c,0xf0,0x00,0x01,0xfb,0x00,0x00,0x02,0x0c,0xf0,0x00,0x02,
+0xfb,0x00,0x00,0x0d,0xac,0xf0,0x0d,0xff,0xff,0xff,0x80,0x0f,0xbd,0xf5,0x19,0xab,
+0xfe,0xaa,0x50,0x0f,0xff,0xff,0x40,0x18,0x00,0xf0,0x15,0x3f,0x8d,0xf6,0xef,0xff,
+0xff,0xff,0xf3,0x7f,0x1c,0xf0,0x9b,0xbb,0xbc,0xfd,0xb2,0x17,0x0c,0xf0,0x00,0x00,
+0x04,0xf7,0x00,0x00,0x0d,0xfd,0x7c,0xcc,0xcd,0xfe,0xc0,0x2c,0xff,0xff,0x9f,0x28,
+0x03,0xf1,0x00,0x1f,0xde,0xf0,0x07,0xd1,0x04,0xf7,0x00,0x01,0x0c,0xf0,0x04,0xfd,
+0x04,0xf7,0x60,0x00,0x22,0x78,0x05,0x08,0x00,0x32,0x05,0xde,0xf6,0x70,0x00,0x2d,
+0xff,0xb1,0x88,0x00,0x00,0x7d,0x00,0x33,0x0c,0xf1,0x24,0x08,0x00,0x40,0xee,0x10,
+0x03,0x52,0x08,0x00,0x40,0x7f,0x80,0x0e,0xe4,0x08,0x00,0xd0,0x0e,0xb0,0x07,0xfc,
+0xfb,0x00,0x0d,0xf1,0x03,0x00,0x00,0xef,0xfb,0x88,0x00,0xf0,0x21,0xf4,0x00,0x33,
+0xfb,0xcd,0xdf,0xfe,0xdd,0xd4,0x00,0x03,0xfb,0x00,0x0f,0xf8,0x00,0x00,0x00,0x1c,
+0xfb,0x00,0x3f,0xfe,0x00,0x00,0x04,0xef,0xfb,0x00,0x8f,0xef,0x50,0x00,0x1f,0xf8,
+0xfb,0x00,0xef,0x2f,0xd0,0x00,0x07,0x32,0xfb,0x08,0xf9,0x08,0xf9,0x58,0x00,0xf8,
+0x06,0x4f,0xf2,0x01,0xef,0x80,0x00,0x02,0xfd,0xff,0x60,0x00,0x2e,0xf7,0x00,0x02,
+0xfb,0xa7,0x00,0x00,0x02,0xa0,0x82,0x00,0x12,0x40,0x08,0x00,0x20,0x1e,0xf4,0xf8,
+0x01,0x02,0x98,0x01,0xf2,0x33,0xf4,0x06,0xaa,0xaa,0xcf,0xda,0xba,0xaa,0xa2,0x02,
+0xc6,0x00,0xce,0x19,0xe2,0x4d,0x40,0x02,0xcf,0xaa,0xff,0xff,0x85,0xfe,0x30,0x00,
+0x09,0x35,0xae,0xf8,0x12,0xa2,0x00,0x00,0x17,0xd0,0x8f,0x8b,0xd8,0xd4,0x00,0x0a,
+0xff,0xbd,0xff,0xef,0xfd,0xef,0xa0,0x08,0xb3,0x0a,0xcc,0xb7,0xbb,0x1b,0xa0,0x01,
+0x11,0x11,0x1d,0xf4,0x11,0x11,0x10,0x1f,0x48,0x00,0xe2,0xf7,0x0a,0xaa,0xaa,0xaf,
+0xfb,0xaa,0xaa,0xa5,0x00,0x00,0x00,0x0d,0xf3,0x68,0x00,0x04,0x08,0x00,0x90,0x01,
+0x11,0x11,0x11,0x10,0x3f,0xff,0xfd,0x8f,0xbe,0x02,0xf0,0x01,0x2b,0xef,0xca,0x6b,
+0xbb,0xef,0xdb,0xb8,0x00,0x8f,0x30,0x00,0x01,0xff,0x20,0x00,0x08,0x00,0x01,0xc2,
+0x02,0xf0,0x23,0x8f,0x40,0x00,0x1f,0xfb,0x50,0x00,0x0f,0xff,0xf7,0x00,0x9f,0xff,
+0xf9,0x00,0x0b,0xdf,0xc5,0x05,0xff,0xfc,0xef,0x60,0x00,0x8f,0x30,0x3f,0xfc,0xfb,
+0x3f,0xf2,0x00,0x8f,0x30,0xef,0xa3,0xfb,0x08,0xf9,0x00,0x8f,0x87,0x3a,0x03,0xfb,
+0x00,0x70,0x17,0xdf,0xfd,0x1b,0x01,0x41,0x00,0x2f,0xfa,0x51,0x08,0x00,0x10,0x04,
+0x6b,0x05,0x02,0x08,0x02,0x00,0x08,0x00,0x00,0x2f,0x05,0x10,0x8e,0xf0,0x02,0xf2,
+0x00,0x0c,0xcf,0xec,0x6e,0xf9,0x99,0xaf,0xc0,0x00,0x1f,0xb0,0x0e,0xd0,0x43,0x1f,
+0x08,0x00,0x52,0xfb,0x1f,0xc0,0x00,0x2f,0x08,0x00,0x40,0x0d,0xff,0xff,0x3e,0x08,
+0x00,0x62,0x09,0xbf,0xeb,0x2e,0xd1,0xf9,0x20,0x00,0x21,0xd3,0xf7,0x08,0x00,0xf4,
+0x22,0x07,0x68,0xfa,0x37,0x60,0x00,0x1f,0xc5,0x40,0x0d,0xff,0x60,0x00,0x05,0x9f,
+0xff,0xa0,0x9f,0xdf,0x60,0xa5,0x4f,0xff,0xb7,0x26,0xfc,0x5f,0x60,0xda,0x19,0x40,
+0x01,0x9f,0xe2,0x4f,0xa6,0xf7,0x00,0x00,0x02,0xec,0x20,0x1d,0xff,0xd1,0x00,0x00,
+0x00,0x20,0x69,0x01,0x10,0xeb,0xae,0x02,0xf0,0x05,0xaa,0xa9,0x00,0xeb,0x8b,0xbb,
+0xb4,0x1f,0xff,0xfe,0x00,0xeb,0xcf,0xff,0xf6,0x00,0x8f,0x40,0x51,0xeb,0x89,0x02,
+0x32,0x7f,0x30,0xf6,0x08,0x00,0x20,0x31,0xf5,0x08,0x00,0x40,0x06,0xbf,0x85,0xf4,
+0x08,0x00,0xf2,0x06,0x0f,0xff,0xfd,0xf3,0xfb,0x9f,0xff,0xf3,0x04,0xaf,0x6b,0xf0,
+0xfb,0x7c,0xfe,0xb2,0x00,0x7f,0x33,0x91,0xfa,0x30,0x00,0x21,0x04,0xf7,0x08,0x00,
+0xf0,0x14,0x86,0x0a,0xf4,0x01,0xfb,0x00,0x3b,0xef,0xfc,0x3f,0xd0,0x01,0xfb,0x00,
+0x3f,0xea,0x66,0xef,0x56,0xcd,0xff,0xc8,0x01,0x00,0x08,0xf7,0x08,0xff,0xff,0xfa,
+0x00,0x00,0x00,0x30,0x00,0x2d,0x03,0x30,0xff,0xfe,0x7f,0x28,0x06,0xf1,0x00,0x4c,
+0xef,0xdb,0x7f,0xba,0xfc,0x9f,0xd0,0x00,0x9f,0x30,0x7f,0x41,0xf8,0x0e,0x08,0x00,
+0x01,0x40,0x06,0xa1,0x9f,0x40,0x7f,0xa9,0xfc,0x8f,0xd0,0x3f,0xff,0xfa,0x18,0x00,
+0x33,0x2b,0xef,0xc7,0x18,0x00,0xb0,0x30,0x49,0x9a,0xfd,0x99,0x80,0x00,0x9f,0x30,
+0x00,0x04,0x48,0x01,0x21,0x9f,0x56,0xf0,0x02,0xf3,0x09,0x04,0xcf,0xff,0x6a,0xab,
+0xfe,0xaa,0xa0,0x7f,0xff,0xc6,0x00,0x03,0xfa,0x00,0x00,0x3c,0x71,0x08,0xcc,0xcd,
+0xfe,0xcc,0xc7,0x42,0x02,0x10,0xf9,0x74,0x00,0xf1,0x00,0x06,0xf6,0x00,0x00,0x1c,
+0xcc,0xc7,0xae,0x06,0xf6,0x0b,0xf0,0x1f,0xff,0xf9,0x08,0x00,0x71,0x00,0xaf,0x10,
+0xaf,0x8c,0xfb,0x8e,0x08,0x00,0x00,0x48,0x00,0x30,0x00,0xaf,0x20,0xd3,0x04,0x40,
+0x20,0x0f,0xff,0xf8,0x38,0x00,0xe0,0xf8,0x0b,0xef,0xb5,0xbb,0xbe,0xfd,0xbb,0xb6,
+0x00,0xaf,0x10,0x00,0x0b,0x29,0x02,0x20,0xaf,0x10,0xf8,0x02,0xf1,0x05,0xf6,0x00,
+0xaf,0x10,0xed,0xcf,0x9f,0xdb,0xf6,0x03,0xcf,0xe9,0xea,0x6f,0x1e,0xa5,0xf6,0x1f,
+0xfd,0xa4,0x08,0x00,0xf5,0x01,0x04,0x10,0x00,0xea,0x6f,0x1e,0xcc,0xf5,0x00,0x00,
+0x00,0xea,0x6d,0x1c,0x9d,0xc1,0xd6,0x02,0x50,0x09,0x81,0x0f,0xf0,0x00,0x58,0x06,
+0x12,0xf1,0x08,0x00,0x22,0x7f,0xc0,0x08,0x00,0x82,0xcf,0xec,0xcf,0xfd,0xcc,0xcc,
+0x50,0x04,0xa0,0x02,0xc0,0x60,0x0d,0xf7,0x00,0x0f,0xf1,0x00,0x00,0x00,0x3e,0xc0,
+0x00,0x20,0x00,0x00,0x1f,0x07,0x02,0x28,0x00,0x01,0x81,0x07,0x90,0xfc,0x00,0x00,
+0x4d,0xdd,0xdf,0xfd,0xdd,0xdb,0x12,0x00,0x02,0x18,0x00,0x0b,0x08,0x00,0x12,0x2f,
+0x48,0x00,0x31,0xf3,0x2e,0xee,0x01,0x00,0x12,0xe3,0x10,0x08,0x33,0xbb,0x10,0x0c,
+0xaf,0x04,0xf5,0x06,0xcf,0x31,0x1e,0xf2,0x11,0xdf,0x10,0x0c,0xf1,0x00,0xdf,0x00,
+0x0c,0xf1,0x00,0xcf,0xdc,0xcf,0xfd,0xcc,0xff,0x1e,0x00,0xb0,0xdf,0x10,0x0d,0xf0,
+0x00,0xcf,0x10,0x0e,0xf1,0x00,0xef,0x23,0x00,0x02,0x4c,0x00,0x11,0x10,0xeb,0x07,
+0x51,0xbf,0xf1,0x05,0xfa,0x00,0x1e,0x00,0x21,0xbf,0x50,0x3c,0x00,0xf1,0x00,0x4f,
+0xe1,0x00,0x0d,0xf2,0xbb,0xff,0x03,0xd5,0x00,0x00,0xdf,0x0e,0xff,0x70,0x43,0x07,
+0x11,0x11,0x89,0x00,0x1a,0xff,0x98,0x00,0x25,0xff,0x10,0x5f,0x05,0xa0,0x00,0x1f,
+0xfc,0xcd,0xff,0xdc,0xcf,0xf0,0x01,0xfe,0x1e,0x00,0x00,0x0f,0x00,0x55,0xcc,0xff,
+0xcc,0xcf,0xf0,0x1e,0x00,0xd3,0xe0,0x00,0xff,0x00,0x0f,0xf0,0x01,0xff,0xcc,0xdf,
+0xfd,0xcc,0xff,0x4b,0x08,0x01,0x2d,0x00,0x60,0xf1,0x00,0x07,0xc2,0x06,0x50,0x4b,
+0x00,0x80,0xaf,0x60,0x00,0x00,0x0d,0xff,0xee,0xff,0x15,0x06,0x73,0x3d,0xff,0xff,
+0xe7,0x00,0x00,0xcf,0x1a,0x01,0x50,0xcf,0x98,0x9f,0xe8,0x89,0x08,0x00,0x57,0x54,
+0x5f,0xe4,0x46,0xfc,0x18,0x00,0x40,0x21,0x2f,0xd1,0x14,0x08,0x00,0x47,0xa9,0xaf,
+0xe9,0x9a,0x18,0x00,0xf1,0x14,0x06,0xef,0x60,0x07,0xfd,0x60,0x00,0x29,0xef,0xfc,
+0x50,0x05,0xcf,0xff,0xb3,0x1e,0xd5,0x7f,0x80,0x08,0xfa,0x6d,0xd0,0x01,0x00,0xaf,
+0x60,0x08,0xf9,0x00,0x10,0x00,0x06,0xff,0x10,0xb1,0x04,0x40,0xcf,0xf6,0x00,0x08,
+0x40,0x02,0x22,0x9d,0x40,0x08,0x00,0x07,0x01,0x00,0xf0,0x19,0x56,0x00,0x00,0x07,
+0x77,0x77,0x30,0x1f,0xe0,0x00,0x00,0xef,0xff,0xf6,0x0a,0xff,0xff,0xfd,0x2e,0x9c,
+0x7e,0x68,0xff,0xcc,0xdf,0xe0,0xe7,0xb5,0xec,0xff,0xf8,0x0c,0xf5,0x0e,0x7b,0x5e,
+0x8c,0x3b,0xfd,0xf8,0x1e,0x00,0xf0,0x25,0x01,0x8f,0xfe,0x30,0x0e,0xbd,0xaf,0xaa,
+0xff,0xfc,0xff,0xd5,0xe7,0xb5,0xee,0xff,0xc2,0x06,0xff,0x8e,0x7b,0x5e,0x9c,0xfb,
+0xbb,0xbd,0xe4,0xe7,0xb5,0xe6,0x0f,0xff,0xff,0xfa,0x0e,0xff,0xff,0x60,0xf9,0x00,
+0x1f,0xa0,0xee,0xcc,0xc5,0x0f,0xa0,0x01,0xfa,0x09,0x40,0x00,0x82,0x01,0x10,0xa0,
+0x4b,0x01,0x20,0xd9,0x9a,0x3a,0x03,0x21,0x25,0x30,0x4a,0x02,0x11,0xfd,0x7c,0x00,
+0x52,0xdf,0x70,0x00,0x00,0x0f,0x22,0x01,0x10,0xff,0xeb,0x01,0x31,0xff,0x0f,0xe0,
+0x75,0x01,0x11,0xfe,0x74,0x01,0x72,0x0f,0xfa,0xaa,0xaa,0xaa,0xaf,0xf0,0x59,0x01,
+0x64,0x0f,0xf3,0x33,0x33,0x33,0x3f,0x1a,0x00,0x02,0x27,0x00,0x64,0xff,0xcc,0xcc,
+0xcc,0xcc,0xff,0x41,0x00,0xf0,0x03,0x11,0x11,0x11,0x11,0xff,0x00,0x00,0x46,0x10,
+0x00,0x54,0x00,0x00,0x00,0x0b,0xf2,0x00,0x1f,0x26,0x00,0xb0,0xec,0x00,0x06,0xfa,
+0x11,0x11,0x0c,0xff,0xff,0xf1,0xcf,0x04,0x00,0xf0,0x24,0xaa,0xef,0x6f,0xea,0xaa,
+0xef,0x0c,0xe0,0x0a,0xfe,0xf4,0x00,0x0c,0xf0,0xce,0x00,0xaf,0xab,0x10,0x00,0xcf,
+0x0c,0xfa,0xae,0xf1,0x4f,0x90,0x0d,0xe0,0xcf,0xff,0xff,0x10,0xdf,0x40,0xee,0x0c,
+0xe0,0x0a,0xf1,0x03,0xfe,0x0f,0xd0,0xce,0x00,0xaf,0x10,0x0a,0xb2,0xfc,0x0f,0x00,
+0x40,0x00,0x00,0x2f,0xa0,0x1e,0x00,0xc0,0x00,0x06,0xf8,0x0c,0xfb,0xbb,0xb0,0x07,
+0xdd,0xff,0x30,0x8a,0xd7,0x0a,0x35,0xfe,0x70,0x00,0x7e,0x07,0xd0,0x71,0x00,0x00,
+0x27,0x20,0x00,0x00,0x07,0xfb,0x00,0x00,0xaf,0x80,0xdd,0x00,0x10,0x50,0x54,0x08,
+0x82,0x0a,0xaa,0xcf,0xaa,0xab,0xfc,0xaa,0xa0,0xbd,0x05,0x00,0xe6,0x09,0xf1,0x11,
+0x4b,0x20,0x02,0xb6,0x10,0x00,0x00,0x5b,0xfe,0x40,0x05,0xff,0xf9,0x20,0x0d,0xff,
+0x80,0x00,0x00,0x06,0xdf,0xe0,0x05,0xda,0x88,0x88,0x88,0x88,0x89,0x40,0x00,0x7f,
+0xe4,0x05,0x70,0x00,0x00,0x7f,0x47,0xf5,0x6f,0x64,0x08,0x00,0x46,0x37,0xf4,0x5f,
+0x54,0x08,0x00,0x93,0x3b,0xdf,0xcd,0xfc,0xdf,0xdc,0xfd,0xb3,0x4f,0x55,0x06,0xe2,
+0x00,0x00,0x1f,0xc0,0x09,0x91,0x00,0x00,0x03,0xf9,0x1f,0xc0,0x0e,0xf2,0x08,0x00,
+0x40,0x4f,0xf6,0x66,0x61,0x08,0x00,0xf0,0x04,0x9f,0xff,0xff,0xf2,0x03,0xf9,0x1f,
+0xc1,0xff,0x56,0x44,0x40,0x03,0xf9,0x1f,0xca,0xf9,0x7f,0x80,0x20,0x00,0xd5,0xcb,
+0xe1,0x1b,0xf9,0x00,0x03,0xc7,0x1b,0x90,0x20,0x00,0xbc,0x10,0xc0,0x00,0x13,0xaf,
+0x53,0x02,0x50,0xaf,0x9c,0xfb,0xaf,0xc9,0x08,0x00,0x46,0x27,0xf4,0x4f,0x71,0x08,
+0x00,0x76,0x2b,0xef,0xbd,0xfc,0xcf,0xdb,0xfe,0x78,0x00,0x50,0x01,0x63,0x00,0x00,
+0x75,0x02,0x06,0x20,0xfd,0x00,0xe8,0x00,0x72,0x03,0x77,0xef,0x87,0x7c,0xfa,0x77,
+0x39,0x09,0xd3,0xff,0xfe,0x00,0x00,0x12,0x22,0x5f,0xc2,0x22,0x20,0x00,0x00,0x9f,
+0xd5,0x0b,0x90,0x23,0x33,0x6f,0xc3,0x33,0x30,0x00,0x1c,0xcc,0x7e,0x09,0x41,0xcc,
+0x90,0x1a,0xaa,0x01,0x00,0x30,0x80,0x00,0x68,0xf8,0x00,0x12,0x84,0xd3,0x02,0x00,
+0xf8,0x00,0x53,0xcf,0x0a,0xf1,0x8f,0x46,0x08,0x00,0xc4,0x35,0xf7,0x00,0x5a,0xff,
+0xae,0xfb,0xdf,0xbc,0xfd,0xa0,0x7f,0x40,0x01,0x00,0x87,0x04,0x10,0x00,0x56,0x0a,
+0x83,0x77,0x8f,0xf7,0x77,0x73,0x00,0x00,0x0b,0x38,0x00,0x50,0x0b,0xf2,0x3e,0x81,
+0x07,0x08,0x00,0x65,0xf1,0x2b,0xfa,0x06,0xf7,0x00,0x2d,0x07,0xf3,0x12,0xbf,0xea,
+0xbe,0xaa,0xac,0xfd,0xa5,0x00,0xaf,0x80,0x8f,0xc4,0x18,0xf7,0x00,0x08,0xfd,0x10,
+0x05,0xd6,0xff,0xf5,0x00,0x00,0xc6,0x44,0x44,0x44,0xab,0x83,0x00,0x00,0x7f,0xf8,
+0x00,0x50,0x7f,0x77,0xf8,0x5f,0xa3,0x08,0x00,0xe3,0x54,0xf6,0x2f,0x80,0xfc,0x00,
+0x1a,0xdf,0xcc,0xfc,0xbf,0xdb,0xfe,0xa4,0x8d,0x04,0x21,0xf6,0xdf,0xf6,0x00,0xb4,
+0xdf,0xdd,0xdd,0xdd,0xdf,0xf4,0xdf,0x10,0x00,0x00,0x0b,0x06,0x00,0x02,0x18,0x00,
+0x44,0xdc,0xcc,0xcc,0xcf,0x12,0x00,0x44,0x21,0x11,0x11,0x1c,0x18,0x00,0x44,0xbb,
+0xbb,0xbb,0xbe,0x18,0x00,0x02,0x24,0x00,0x02,0x18,0x00,0x00,0x12,0x00,0x00,0x1c,
+0x08,0x20,0x08,0x71,0x4e,0x09,0x83,0x77,0x77,0x7f,0xf8,0x77,0x77,0x70,0x0a,0xe4,
+0x00,0x20,0x02,0x33,0x2c,0x01,0x43,0x33,0x30,0x00,0x0f,0xdc,0x00,0x50,0x0f,0xf9,
+0x99,0x99,0x9c,0x08,0x00,0x40,0xe8,0x88,0x88,0x8b,0x08,0x00,0x40,0xfd,0xdd,0xdd,
+0xde,0x08,0x00,0x66,0xe4,0x44,0x44,0x49,0xf7,0x00,0x28,0x00,0x48,0xd2,0x22,0x22,
+0x28,0x10,0x00,0xe3,0xe5,0x55,0x55,0x5a,0xf7,0x00,0x0b,0xbf,0xfb,0xbb,0xbb,0xbd,
+0xfd,0xb6,0x14,0x01,0x42,0xf8,0x00,0x0e,0xd0,0xf4,0x01,0x30,0xed,0x00,0xbf,0xac,
+0x01,0xf1,0x0a,0x0e,0xd0,0x0b,0xfd,0xcc,0xcf,0xe1,0x77,0xfe,0x76,0xbf,0x10,0x00,
+0xfe,0x3f,0xff,0xff,0xdb,0xf1,0x00,0x0f,0xe1,0x79,0xfe,0x76,0x1e,0x00,0xa0,0x8f,
+0xe0,0x0b,0xfc,0xbb,0xbf,0xe0,0x0d,0xff,0xa0,0x1e,0x00,0xf0,0x0b,0x03,0xff,0xff,
+0x7b,0xf1,0x00,0x0f,0xe0,0xbe,0xfe,0xbd,0xcf,0xff,0xff,0xfe,0x5f,0x7e,0xd2,0x3b,
+0xfb,0xaa,0xaf,0xe4,0xd0,0xed,0x00,0x1e,0x00,0x86,0x01,0x0e,0xd0,0x0b,0xfa,0x99,
+0x9f,0xe0,0x5a,0x00,0x51,0x0a,0xd2,0x11,0x1c,0xb0,0x13,0x0c,0x20,0x35,0x72,0x62,
+0x04,0x02,0x6d,0x01,0xa0,0x78,0x77,0xff,0x74,0x32,0x00,0x00,0x00,0xcc,0xcc,0xc4,
+0x03,0x20,0x30,0x00,0xa0,0x06,0xb5,0xbb,0xbb,0x20,0x08,0x88,0x8e,0xfa,0x88,0x88,
+0x88,0x80,0x2d,0x03,0x92,0x02,0xff,0x96,0x66,0x66,0x63,0x00,0x00,0x1d,0x01,0x07,
+0xa2,0x02,0xdf,0xfe,0x44,0x44,0x48,0xf9,0x00,0x4f,0xfb,0x10,0x00,0x60,0x1e,0x80,
+0xee,0x55,0x55,0x58,0xd1,0x04,0x41,0xef,0xcc,0xcc,0xcd,0x08,0x00,0x31,0x77,0x77,
+0x7a,0x08,0x00,0x05,0x31,0x07,0x11,0x71,0x2c,0x02,0x63,0x77,0x7d,0xf9,0x77,0x77,
+0x50,0x61,0x01,0x92,0xb0,0x01,0x14,0x44,0x5f,0xd4,0x44,0x42,0x10,0x29,0x01,0x12,
+0xf0,0x29,0x01,0x22,0x5e,0xf0,0x69,0x01,0x22,0x9f,0xf0,0x61,0x01,0x22,0xdf,0xf0,
+0x61,0x01,0x36,0x4e,0xf0,0x00,0x28,0x00,0x64,0xe2,0x22,0x22,0x2e,0xf1,0x00,0xa0,
+0x00,0xf0,0x11,0x08,0x88,0xae,0x88,0x89,0xfc,0x88,0x81,0x00,0x4a,0xff,0x80,0x07,
+0xff,0xe9,0x20,0x0c,0xff,0xb4,0x00,0x00,0x17,0xef,0xc0,0x01,0x51,0x00,0x00,0x00,
+0x00,0x05,0x00,0x10,0x00,0x01,0x00,0xf1,0x60,0x23,0x68,0x10,0x0f,0xff,0xf5,0xef,
+0xff,0xff,0xfd,0x60,0x0f,0xcc,0xf2,0xbd,0x6b,0xc2,0x1c,0x60,0x0f,0x65,0xf1,0x7f,
+0x29,0xf1,0x8f,0x40,0x0f,0x99,0xf3,0x5f,0x67,0xe6,0xfd,0x31,0x0f,0xff,0xf9,0xff,
+0xff,0xff,0xff,0xf4,0x0f,0x88,0xf9,0xfc,0x33,0x33,0x7d,0xf4,0x0f,0x66,0xf3,0xbf,
+0x65,0x44,0xaf,0x81,0x0f,0xff,0xf2,0xef,0xff,0xff,0xff,0xf0,0x0f,0xbb,0xf9,0xf3,
+0xbc,0x96,0xaf,0x40,0x0f,0x65,0xff,0xc8,0xf8,0xf5,0x8e,0x00,0x0f,0xdd,0xf9,0x5f,
+0xf2,0xfd,0xef,0xc0,0x0f,0xff,0xf1,0x4f,0x81,0xaa,0xdf,0xa0,0x0c,0x40,0x08,0xfa,
+0x00,0x00,0x8e,0x00,0x00,0x00,0x06,0x80,0x08,0x00,0x21,0x96,0x00,0x01,0x00,0xf1,
+0x18,0x3f,0xa0,0x00,0x02,0x55,0x55,0x54,0x07,0xfd,0xbb,0xb7,0x7f,0xff,0xff,0xd0,
+0xdf,0xff,0xff,0xb7,0xfb,0x67,0xfd,0x5f,0xb7,0xf7,0x00,0x7f,0x70,0x1f,0xd5,0xf3,
+0x7f,0x70,0x07,0xf7,0x01,0xfd,0x04,0x07,0x0f,0x00,0xf0,0x04,0xd6,0xff,0xff,0xff,
+0xf8,0xf7,0x01,0xfd,0x5b,0xbe,0xfd,0xbb,0x8f,0x70,0x1f,0xd0,0x00,0xcf,0x60,0x1e,
+0x00,0xf2,0x18,0x00,0x1f,0xff,0x50,0x7f,0x70,0x1f,0xd0,0x07,0xfa,0xef,0x47,0xf7,
+0x01,0xfd,0x03,0xff,0x14,0xff,0x8f,0xff,0xff,0xd3,0xff,0x70,0x08,0x77,0xfe,0xcc,
+0xfd,0x2e,0x80,0x00,0x00,0x6e,0x60,0x1a,0x90,0x10,0x70,0x00,0xf0,0x10,0x1f,0xff,
+0xff,0xab,0xee,0xee,0xee,0x20,0x0b,0xdf,0xdb,0x7a,0xcc,0xcc,0xff,0x10,0x00,0x9f,
+0x30,0x00,0x53,0x00,0xdf,0x00,0x00,0xde,0x00,0x01,0xfa,0x00,0xee,0x05,0x00,0xf1,
+0x0a,0x03,0xf9,0x00,0xfc,0x00,0x08,0xff,0xee,0x44,0xf7,0x02,0xfa,0x00,0x1f,0xfe,
+0xdf,0x46,0xfc,0xab,0xfd,0xa3,0x5f,0xf7,0x5f,0x48,0x00,0x01,0xfc,0x20,0xf7,0x5f,
+0x40,0x00,0x00,0x0a,0xf2,0x04,0xf7,0x5f,0x56,0x66,0x66,0x3c,0xf0,0x01,0xf8,0x5f,
+0x6f,0xff,0xff,0x9e,0xe0,0x01,0xff,0xff,0x55,0x55,0x55,0x5f,0xc0,0x01,0xfc,0x99,
+0x20,0x00,0x5a,0xdf,0x70,0x00,0x73,0x00,0x00,0x00,0x4f,0xfb,0x00,0x01,0x00,0xf0,
+0x35,0x9f,0xff,0xff,0xaf,0xff,0xff,0xff,0xf1,0x6b,0xff,0xbb,0x6a,0xaa,0xfe,0xaa,
+0xa1,0x00,0xfd,0x00,0x02,0x23,0xfc,0x22,0x10,0x03,0xf9,0x00,0x4f,0xff,0xff,0xff,
+0xc0,0x08,0xf5,0x00,0x4f,0x95,0xfc,0x4f,0xc0,0x0e,0xfe,0xee,0x5f,0xdc,0xfe,0xbf,
+0xc0,0x7f,0xfc,0xef,0x5f,0xca,0xfe,0x9f,0xc0,0xbf,0xf0,0x7f,0x5f,0xa7,0xfd,0x6f,
+0xc0,0x6f,0xf0,0x7f,0x5f,0x28,0x00,0xf1,0x20,0x29,0xf0,0x7f,0x37,0x45,0xf8,0x00,
+0x00,0x08,0xf1,0x8f,0x2e,0xeb,0xf4,0x00,0x00,0x08,0xff,0xff,0x14,0xff,0xe0,0x00,
+0x00,0x08,0xfa,0x9a,0x49,0xff,0xfe,0x96,0x40,0x04,0x70,0x00,0xcf,0x92,0x5b,0xff,
+0xd0,0x00,0x00,0x00,0x10,0x00,0x00,0x02,0xfe,0x00,0x21,0x67,0x10,0x00,0x01,0xf0,
+0x12,0x80,0xef,0x10,0x00,0x00,0x0b,0xdf,0xdb,0x57,0xff,0xff,0xfa,0x00,0x00,0x9f,
+0x20,0x4f,0xf7,0x7d,0xf4,0x00,0x00,0xde,0x02,0xff,0xc8,0x9f,0xe8,0x80,0x01,0xfa,
+0x01,0xef,0xa0,0x00,0xf0,0x05,0x07,0xff,0xff,0x3d,0xe0,0xce,0x0b,0xf1,0x0e,0xff,
+0xff,0x2d,0xf7,0xdf,0x7d,0xf1,0x5f,0xf7,0x6f,0x2d,0x18,0x00,0xf0,0x06,0x1f,0xf7,
+0x6f,0x2e,0xe0,0xbe,0x0b,0xf1,0x05,0xf7,0x6f,0x2f,0xfc,0xff,0xcf,0xf1,0x01,0xf7,
+0x7f,0x4f,0xec,0x08,0x00,0xf5,0x08,0xff,0xff,0x9f,0x70,0xbe,0x0b,0xf1,0x01,0xfc,
+0x9a,0xff,0x20,0xbe,0x8e,0xf0,0x00,0x83,0x02,0xc8,0x00,0x68,0xaf,0x90,0xf9,0x00,
+0x80,0x7b,0xbb,0xbb,0xbb,0xbb,0xb7,0x00,0x00,0xfe,0x00,0x00,0x78,0x00,0x65,0x12,
+0x22,0x22,0x22,0x22,0x21,0x1f,0x00,0x21,0x1d,0xdd,0x01,0x00,0x31,0xd1,0x1f,0xff,
+0x01,0x00,0x60,0xf1,0x00,0x00,0x00,0x0f,0xf2,0x19,0x00,0xf0,0x12,0x1b,0x70,0x0f,
+0xf1,0x07,0xa0,0x00,0x00,0x8f,0xc0,0x0f,0xf1,0x0d,0xf6,0x00,0x01,0xef,0x40,0x0f,
+0xf1,0x04,0xff,0x10,0x0c,0xfb,0x00,0x0f,0xf1,0x00,0xbf,0x90,0x4f,0xd1,0x08,0x00,
+0xf8,0x00,0x4f,0xe0,0x02,0x20,0x9f,0xff,0xf0,0x00,0x06,0x10,0x00,0x00,0x4f,0xfd,
+0x50,0x71,0x01,0xa1,0x07,0xf4,0x00,0x00,0x7f,0x50,0x00,0x00,0x08,0xf5,0x08,0x00,
+0x40,0x0e,0xff,0xff,0xf6,0xb0,0x02,0xf0,0x13,0x07,0x9f,0xfd,0x83,0x7a,0xff,0xf8,
+0x70,0x02,0xef,0xff,0xd4,0x4e,0xff,0xfc,0x20,0x3f,0xc9,0xf5,0x98,0xfa,0x8f,0x7d,
+0xf3,0x06,0x04,0x92,0x00,0x50,0x49,0x30,0x50,0x00,0x3d,0x8f,0x00,0x21,0xd6,0x00,
+0x96,0x01,0x25,0xff,0xf7,0x4f,0x00,0x12,0x0f,0xa0,0x00,0xf0,0x11,0xf0,0x08,0x8c,
+0x98,0x8f,0xf8,0x8a,0x98,0x80,0x00,0x7f,0xd0,0x0e,0xf0,0x4f,0xd4,0x00,0x1d,0xfd,
+0x29,0x9f,0xf0,0x04,0xef,0x90,0x05,0x80,0x0c,0xfe,0x70,0x00,0x19,0x70,0x01,0x22,
+0x04,0x20,0x33,0x00,0x26,0x5f,0xa0,0x38,0x00,0xe0,0xf1,0x09,0xac,0xab,0xc9,0x9c,
+0xda,0xcb,0x91,0x00,0x5f,0x65,0xdd,0xce,0xc1,0x01,0x50,0x5f,0x77,0xde,0xdf,0x85,
+0x08,0x00,0x40,0x8b,0xa4,0x37,0xc7,0x08,0x00,0x10,0xff,0xe6,0x02,0xa2,0x00,0x00,
+0x13,0x33,0x6f,0xe3,0x33,0x32,0x00,0x06,0x38,0x00,0xf5,0x1a,0x80,0x06,0xfc,0xad,
+0xfd,0xad,0xda,0xcf,0x80,0x06,0xf6,0x3e,0xe4,0x4e,0xf3,0x4f,0x80,0x06,0xf6,0x9f,
+0xff,0xfe,0xed,0x5f,0x80,0x06,0xf6,0x26,0x31,0x00,0x67,0x9f,0x80,0x06,0xf6,0x00,
+0x00,0x00,0x6f,0xfd,0x20,0xa9,0x00,0xd0,0x01,0x6b,0x10,0x00,0xfb,0x00,0x00,0x19,
+0xcf,0xff,0xa0,0x00,0xfb,0xf8,0x01,0xf0,0x4d,0xe4,0x00,0x00,0xfb,0x03,0x00,0x02,
+0x1f,0xc0,0x06,0xc4,0xfb,0x9f,0x30,0x00,0x1f,0xd0,0x0a,0xf3,0xfb,0x4f,0xa0,0x6f,
+0xff,0xff,0xcc,0xf1,0xfb,0x0e,0xf0,0x4b,0xdf,0xfb,0xaf,0xb0,0xfb,0x09,0xf5,0x00,
+0xaf,0xf6,0x4f,0x60,0xfb,0x03,0x61,0x02,0xff,0xff,0x61,0x10,0xfb,0x1d,0x80,0x0d,
+0xef,0xdb,0x50,0x00,0xda,0x9f,0x80,0x7f,0x6f,0xc0,0x00,0x00,0x06,0xfe,0x00,0x2c,
+0x0f,0xc0,0x00,0x00,0x8f,0xf4,0x00,0x01,0x0f,0xc0,0x03,0x8f,0xff,0x40,0x00,0x00,
+0x0f,0xc1,0xff,0xff,0x91,0xe1,0x00,0x31,0xc0,0x8b,0x61,0x79,0x00,0x20,0x27,0x40,
+0x06,0x00,0xf0,0x15,0x38,0xbe,0xff,0xe2,0xbb,0xbb,0xbb,0x90,0x4f,0xef,0xf6,0x12,
+0xff,0xff,0xff,0xd0,0x00,0x0b,0xf1,0x02,0xfb,0x00,0x2f,0xd0,0x02,0x2c,0xf3,0x23,
+0xfa,0x00,0x1f,0xd0,0x5f,0xff,0xff,0xf6,0x08,0x00,0x40,0x4b,0xbf,0xfb,0xb5,0x08,
+0x00,0xc0,0x00,0x7f,0xfa,0x02,0xfe,0xcc,0xcf,0xd0,0x00,0xef,0xff,0xa2,0x30,0x00,
+0x41,0x09,0xfe,0xf8,0xf3,0x3d,0x01,0xf0,0x07,0xbb,0xf1,0x60,0x59,0x40,0x79,0x00,
+0x4f,0x2b,0xf1,0x00,0xdf,0x50,0xcf,0x40,0x04,0x0b,0xf1,0x05,0xfe,0x00,0x3f,0x50,
+0x00,0x70,0x2f,0xf6,0x00,0x0c,0xf4,0x00,0x0b,0x1e,0x02,0xf1,0x00,0x05,0xa2,0x00,
+0x00,0x15,0x00,0x54,0x00,0x00,0x00,0x05,0x8b,0xff,0x60,0xef,0x70,0x01,0xf0,0x09,
+0xe7,0x23,0xfe,0x99,0x99,0x93,0x02,0x3f,0xa0,0x09,0xff,0xff,0xff,0xf3,0x00,0x1f,
+0xa0,0x2f,0xf2,0xef,0x2e,0xd0,0x3f,0xff,0x01,0x03,0xf0,0x33,0x2e,0x70,0x2b,0xdf,
+0xeb,0x69,0x10,0xef,0x02,0x00,0x00,0xaf,0xe3,0x06,0xf5,0xef,0x6f,0x50,0x02,0xff,
+0xff,0x3a,0xf2,0xef,0x2f,0xa0,0x0b,0xef,0xbe,0x6e,0xe0,0xef,0x0d,0xf0,0x5f,0x7f,
+0xa2,0x6f,0x80,0xef,0x09,0xf3,0x3c,0x1f,0xa0,0xbf,0x10,0xef,0x06,0xf7,0x01,0x1f,
+0xa0,0x03,0x00,0xef,0x01,0x20,0x00,0x1f,0xa0,0x00,0x7d,0xfe,0x00,0x00,0x08,0x00,
+0x20,0x4e,0xc5,0xa2,0x00,0xf0,0x16,0x13,0x00,0x01,0x62,0x00,0x00,0x04,0x7b,0xff,
+0x20,0x0c,0xf9,0x00,0x00,0x0e,0xff,0xe7,0x13,0xdf,0xff,0xff,0x80,0x03,0x3f,0xb0,
+0x8f,0xf9,0x89,0xff,0x30,0x01,0x2f,0xb1,0x5c,0x8d,0x7c,0xf7,0xd7,0x01,0xa0,0x70,
+0x3f,0xff,0x60,0x00,0x39,0xdf,0xe9,0xac,0xff,0xa2,0x02,0xf0,0x27,0xef,0xf5,0x4e,
+0x86,0xff,0xa8,0x71,0x05,0xff,0xff,0x40,0x4f,0xff,0xff,0xf5,0x0d,0xdf,0xbe,0x6a,
+0xfe,0x40,0x4f,0xc0,0x6f,0x6f,0xb2,0x5f,0xb9,0xd6,0xef,0x40,0x3d,0x1f,0xb0,0x02,
+0x04,0xef,0xf6,0x00,0x02,0x1f,0xb0,0x00,0x3b,0xff,0x60,0x00,0x00,0x1f,0xb0,0x8d,
+0xff,0xa2,0x00,0x08,0x00,0x29,0x7d,0x83,0x52,0x04,0x02,0x44,0x03,0x40,0x03,0x7c,
+0xfd,0x0f,0xdb,0x00,0xf0,0x0d,0x0e,0xff,0xe6,0x1f,0xe9,0x99,0xbf,0x80,0x03,0x3f,
+0xa0,0x0f,0xc0,0x00,0x4f,0x80,0x00,0x1f,0xa0,0x0f,0xe8,0x88,0xaf,0x80,0x1f,0xff,
+0xff,0x5f,0x20,0x00,0x41,0x1b,0xdf,0xeb,0x40,0x31,0x00,0x30,0xbf,0xf2,0x2f,0xc8,
+0x02,0xf1,0x17,0x01,0xff,0xfd,0x2a,0xab,0xff,0xaa,0xa0,0x09,0xff,0xdf,0x70,0x00,
+0xfd,0x00,0x00,0x3f,0xbf,0xa9,0x0b,0xff,0xff,0xff,0x90,0x4f,0x4f,0xa0,0x08,0xbb,
+0xff,0xbb,0x70,0x06,0x1f,0xa0,0x00,0x00,0xfd,0xf0,0x00,0x80,0xbb,0xbc,0xff,0xbb,
+0xb3,0x00,0x1f,0xa0,0x20,0x04,0x41,0xf5,0x00,0x00,0x33,0x50,0x04,0xf0,0x0d,0x05,
+0x9d,0xfe,0x13,0xff,0x77,0x72,0x00,0x0d,0xff,0xd5,0x2d,0xff,0xff,0xfc,0x00,0x02,
+0x2f,0xa3,0xef,0x60,0x0b,0xf2,0x00,0x00,0x1f,0xb3,0xff,0x48,0x00,0xf1,0x15,0x1f,
+0xff,0xff,0x59,0x99,0x99,0x9f,0x90,0x1b,0xdf,0xeb,0x29,0x99,0x99,0xaf,0x90,0x00,
+0xbf,0xf3,0x0b,0xbb,0xbb,0xcf,0x90,0x02,0xff,0xfe,0x47,0x77,0x77,0x8f,0x90,0x0a,
+0xff,0xdf,0x9f,0x70,0x00,0xf1,0x1c,0xaf,0xa3,0x10,0x23,0xd7,0x01,0x20,0x3f,0x3f,
+0xa1,0xf9,0xfa,0xaf,0x2c,0xd0,0x05,0x1f,0xa7,0xf6,0xfa,0x04,0x9c,0xf4,0x00,0x1f,
+0xbe,0xe1,0xfd,0x78,0xfb,0xf9,0x00,0x1f,0xa2,0x40,0x9f,0xff,0xe3,0x10,0x00,0x00,
+0x01,0x66,0xc0,0x00,0xd2,0x05,0xff,0x00,0x00,0x00,0xbb,0xbb,0xbc,0xff,0xdb,0xbb,
+0xbb,0xff,0x01,0x00,0xf0,0x0f,0xfe,0x00,0x11,0x00,0x22,0x00,0xff,0xfe,0x07,0xfe,
+0x11,0xdf,0xa3,0xdd,0x4a,0xef,0xf5,0x00,0x5d,0xff,0xb3,0x9f,0xf9,0x10,0x00,0x00,
+0x5d,0xf8,0x19,0xcb,0x80,0x04,0x30,0x50,0x00,0xef,0x29,0x00,0x00,0x1f,0x03,0x00,
+0x05,0x00,0x0a,0x07,0x00,0x83,0xac,0xcc,0xcc,0xff,0xcc,0xcc,0xcb,0xcf,0x4c,0x00,
+0x42,0x00,0x00,0x16,0x70,0x62,0x01,0x10,0x2f,0x8a,0x02,0x12,0x0e,0x64,0x00,0xf1,
+0x19,0xe0,0x0e,0xf9,0x9a,0x99,0x99,0xa9,0xaf,0xe0,0x0e,0xf0,0x3d,0xb0,0x09,0xd5,
+0x1f,0xe0,0x05,0x79,0xff,0x50,0x07,0xff,0xd6,0x20,0x02,0xff,0xc2,0x04,0x40,0x3a,
+0xff,0x10,0x00,0x65,0x00,0x1f,0xd5,0xf8,0x45,0xdc,0x06,0x44,0xc0,0xbf,0x30,0x00,
+0xd1,0x04,0xd1,0x1b,0xbb,0xbb,0xff,0xfd,0xbb,0xbb,0xb1,0x00,0x00,0x05,0xfe,0xfe,
+0x8f,0x05,0xf0,0x00,0x7f,0xf6,0x5f,0xe5,0x00,0x00,0x05,0x9e,0xff,0x60,0x06,0xff,
+0xe9,0x61,0x0d,0xde,0x01,0x41,0x2a,0xff,0xe1,0x03,0x9f,0x01,0x24,0x14,0x30,0x80,
+0x00,0x93,0x05,0x55,0x55,0x8f,0xf6,0x55,0x55,0x50,0x0e,0x48,0x00,0xf0,0x1f,0x0e,
+0xf1,0x3a,0x92,0x16,0xd7,0x2e,0xf1,0x07,0xb9,0xff,0xa1,0x06,0xdf,0xed,0x60,0x0c,
+0xff,0xb3,0x9e,0x70,0x04,0xcf,0xe1,0x03,0xb8,0x67,0xff,0x76,0x66,0x6b,0x40,0x00,
+0xaf,0xfe,0xee,0xee,0xef,0xfe,0x00,0x00,0xaf,0x40,0xc8,0x22,0x11,0x08,0x00,0x40,
+0x6b,0xff,0xff,0xf4,0x08,0x00,0x41,0x8c,0xa9,0x6f,0x81,0x18,0x00,0x30,0x8f,0xff,
+0x41,0x08,0x00,0x40,0x8e,0xfc,0x5a,0xf5,0x08,0x00,0x53,0x9d,0x96,0x66,0x87,0xfe,
+0x99,0x05,0x10,0xed,0x7d,0x00,0x20,0x17,0x80,0x51,0x02,0x73,0x99,0x99,0x9f,0xf9,
+0x99,0x99,0x40,0x81,0x04,0xf2,0x03,0x60,0x00,0x01,0xbc,0x00,0x00,0xdc,0x10,0x00,
+0x18,0x88,0xff,0x98,0x89,0xfe,0x88,0x81,0x2f,0x18,0x00,0xc1,0xf2,0x00,0x17,0x77,
+0x77,0x77,0x77,0x71,0x00,0x00,0x2f,0xff,0x68,0x03,0x60,0x00,0x2f,0xa0,0x00,0x00,
+0x0c,0x08,0x00,0x56,0xd7,0x77,0x77,0x7d,0xf3,0x18,0x00,0xf4,0x11,0x00,0x1e,0xf1,
+0x5f,0xa0,0x02,0x10,0x00,0x01,0xbf,0x90,0x4f,0x90,0x07,0xf2,0x28,0xcf,0xfc,0x00,
+0x3f,0xea,0xae,0xf1,0x0e,0xfc,0x50,0x00,0x0b,0xff,0xff,0x80,0x02,0xd0,0x02,0x50,
+0x5a,0x00,0x00,0x04,0xf8,0x2a,0x07,0x91,0x30,0x7f,0x34,0xf8,0x0e,0xd0,0x00,0x3f,
+0x90,0x08,0x00,0xc0,0x3b,0xcf,0xcb,0x8f,0x78,0xfa,0x5f,0xd0,0x4f,0xff,0xff,0x9f,
+0x21,0x04,0xc0,0x04,0x30,0x64,0x24,0x44,0x44,0x44,0x30,0x0d,0x90,0xfb,0xff,0x91,
+0x02,0xf1,0x05,0x0b,0xb0,0xf8,0xbb,0xbe,0xfe,0xbb,0xb4,0x09,0xd2,0xf5,0x00,0x0b,
+0xf6,0x00,0x00,0x08,0xe4,0xf2,0xbf,0xc9,0x06,0xf0,0x04,0xf7,0xf0,0xbf,0xaf,0xaf,
+0xcd,0xf1,0x27,0xae,0xfd,0xbf,0x3f,0x3e,0x89,0xf1,0x5f,0xff,0xda,0xcf,0x08,0x00,
+0x80,0x17,0x40,0x00,0xbf,0x3f,0x3e,0xbc,0xf1,0x0b,0x03,0x45,0x2e,0x3c,0xaf,0xb0,
+0x50,0x03,0x50,0x08,0x50,0x00,0x05,0x72,0x4d,0x05,0x81,0xc4,0x44,0x1d,0xf8,0x55,
+0x52,0x01,0xef,0x71,0x00,0xf2,0x02,0xf6,0x0c,0xf6,0x9f,0x63,0xff,0x39,0xf7,0x00,
+0x19,0xb1,0x3d,0x63,0xb9,0x12,0xd7,0x00,0x4a,0x02,0xf3,0x05,0xfd,0x00,0x00,0x67,
+0x77,0x8f,0xe7,0x77,0xfd,0x00,0x00,0x39,0x99,0xaf,0xe9,0x99,0xfd,0x00,0x00,0x7f,
+0x18,0x00,0x40,0x9f,0x40,0x1f,0xc0,0x50,0x00,0x02,0x50,0x02,0xf2,0x39,0x90,0x00,
+0x78,0x8e,0xff,0xe8,0x88,0xbf,0x80,0x00,0x03,0xdf,0xaf,0xc0,0x00,0x9f,0x60,0x06,
+0xcf,0xe4,0x1f,0xc0,0xbe,0xff,0x20,0x07,0xc5,0x00,0x1f,0xc0,0x6b,0xb6,0x00,0x00,
+0x1a,0x50,0x00,0x08,0x81,0x00,0x00,0x00,0xaf,0xd8,0x88,0x4f,0xf8,0x88,0x83,0x04,
+0xff,0xff,0xff,0xdf,0xff,0xff,0xf6,0x2f,0xf5,0xfd,0x08,0xfc,0x1f,0xf1,0x00,0x09,
+0x70,0x86,0x0a,0xf3,0x06,0x81,0x60,0x00,0x00,0xc3,0x02,0xf3,0x00,0x49,0x99,0x9e,
+0xfa,0x99,0x99,0x00,0x07,0x77,0x77,0x7e,0xf9,0x77,0x77,0x73,0x68,0x02,0xa3,0xf7,
+0x01,0x11,0x11,0x11,0x11,0xbf,0x51,0x10,0x07,0xa9,0x06,0xe0,0x04,0xaa,0xef,0xaa,
+0xaa,0xef,0xca,0xa0,0x00,0x01,0xdf,0xb0,0x00,0xaf,0x5d,0x02,0x60,0x0b,0xe2,0xac,
+0xff,0x30,0x00,0x19,0x08,0xa0,0x8f,0xea,0x00,0x00,0x00,0x4b,0x40,0x00,0x0b,0x80,
+0xa8,0x00,0xa0,0xa7,0x75,0x5f,0xe7,0x77,0x70,0x03,0xff,0xff,0xfd,0x38,0x00,0xf0,
+0x06,0x1e,0xf5,0xfc,0x06,0xf6,0x2f,0xe1,0x00,0x3e,0x90,0xac,0x5f,0xf3,0x08,0xe4,
+0x00,0x01,0x00,0x08,0xfe,0xee,0x5a,0x07,0xf0,0x2c,0x18,0xef,0xb1,0x1c,0xfc,0x61,
+0x00,0x2b,0xff,0xff,0x99,0x9a,0xff,0xff,0xb2,0x1e,0xd6,0x6f,0xff,0xff,0xf3,0x6c,
+0xc0,0x01,0x04,0x30,0x19,0x40,0x04,0x82,0x00,0x00,0x2f,0xd0,0x1f,0xc0,0x0c,0xf1,
+0x00,0x00,0x08,0xf7,0x09,0xf3,0x3f,0xa0,0x00,0x00,0x01,0xa3,0x02,0x71,0xcf,0x30,
+0x00,0x0a,0xaa,0xaa,0xaa,0x69,0x04,0x13,0x0e,0x98,0x00,0xf3,0x20,0x00,0x47,0x20,
+0x00,0x08,0x60,0x00,0x00,0x00,0xdf,0xb8,0x86,0x4f,0xf8,0x88,0x81,0x0a,0xff,0xff,
+0xfd,0xef,0xff,0xff,0xf2,0x5f,0xc2,0xfc,0x09,0xf7,0x0d,0xf1,0x00,0x04,0x5c,0xfd,
+0xcc,0xfd,0xce,0xe9,0x00,0x00,0x5f,0xc6,0x66,0x66,0x69,0xfb,0x19,0x07,0x00,0x08,
+0x00,0x48,0xc7,0x77,0x77,0x7a,0x08,0x00,0x03,0x18,0x00,0xf2,0x01,0x02,0x7f,0x92,
+0x24,0xfe,0x21,0x00,0x18,0x88,0xbf,0xc8,0x89,0xfe,0x88,0x82,0x3f,0x68,0x00,0xc1,
+0xf3,0x03,0x6c,0xfc,0x00,0x01,0xfd,0x00,0x00,0x06,0xeb,0x50,0x08,0x00,0x05,0x01,
+0x00,0x40,0x57,0x20,0x00,0x06,0xb2,0x06,0xf2,0x11,0xef,0x85,0x55,0x0f,0xf6,0x55,
+0x51,0x06,0xff,0xff,0xfe,0x8f,0xff,0xff,0xf3,0x3f,0xe1,0x9f,0x42,0xdd,0x09,0xf6,
+0x00,0x07,0x61,0x38,0x4f,0xd2,0x12,0x93,0x10,0x0c,0x48,0x00,0xb0,0xd0,0x0c,0xf6,
+0x55,0x55,0x55,0x55,0x6f,0xd0,0x08,0xae,0x0f,0x00,0xc0,0xea,0x90,0x00,0x0d,0xf5,
+0x44,0x44,0x4f,0xd0,0x00,0x00,0x0d,0x1f,0x00,0x00,0x08,0x00,0xf2,0x06,0xf7,0x66,
+0x66,0x66,0x50,0x00,0x00,0x0d,0xfd,0xdd,0xdd,0xdd,0xd9,0x00,0x00,0x0d,0xfa,0x99,
+0x99,0x9b,0xfb,0x18,0x00,0x10,0x68,0x08,0x00,0x03,0xa8,0x00,0x60,0x05,0x60,0x0f,
+0xe0,0x07,0x72,0x56,0x04,0xf5,0x06,0x0f,0xe0,0x2f,0xf2,0x00,0x00,0x07,0xfb,0x0f,
+0xe0,0xaf,0x60,0x00,0x0a,0xbb,0xfc,0xbf,0xfb,0xbf,0xbb,0xb0,0x20,0x01,0xf3,0x19,
+0x01,0x7e,0xff,0xff,0xd7,0x10,0x00,0x04,0x8e,0xfe,0x3f,0xf6,0xef,0xfa,0x30,0x1e,
+0xff,0xb1,0x08,0x80,0x06,0xef,0xc0,0x04,0x92,0x00,0x0f,0xe0,0x00,0x07,0x40,0x02,
+0x22,0x22,0x4f,0xd2,0x22,0x22,0x20,0x1f,0x88,0x03,0xf0,0x13,0x0a,0xaa,0xab,0xff,
 0xff,0xaa,0xaa,0xa1,0x00,0x00,0x3c,0xfc,0xcf,0xb2,0x00,0x00,0x15,0x8d,0xff,0xc1,
-0x1c,0xff,0xc8,0x51,0x1e,0xff,0xd7,0x00,0x00,0x6d,0xff,0xe1,0x05,0x62,0x72,0x93,
-0x10,0x40,0x85,0x36,0x00,0x13,0x15,0x41,0x3b,0x1f,0xd5,0xd4,0x33,0x15,0x40,0x5f,
-0xd8,0xf2,0x03,0x54,0xe2,0xa0,0x9f,0xdc,0xc0,0x03,0xfe,0xbb,0xb6,0x0c,0xbf,0xef,
-0x9a,0x3c,0x71,0xf8,0x25,0x4f,0xe5,0x40,0x03,0xfb,0x6f,0x02,0x10,0xf1,0x08,0x00,
-0x41,0x5a,0xcf,0xfa,0xa1,0x0b,0x14,0x32,0xcf,0xf4,0x0e,0xa2,0xb8,0xa0,0xff,0x3e,
-0xfc,0xbb,0xcf,0xe0,0x0d,0xff,0xee,0xee,0x6e,0x0d,0x40,0x8f,0x8f,0xd4,0x6e,0x08,
-0x00,0x40,0x7e,0x1f,0xd0,0x0e,0x3f,0xa1,0x41,0x04,0x0f,0xd0,0x0e,0x14,0x30,0x6e,
-0x0f,0xd0,0x0e,0xfc,0xbb,0xce,0x65,0xbd,0x21,0x4f,0x60,0xec,0x9c,0xf1,0x0c,0x2c,
-0x5f,0x6e,0x8b,0xbc,0xfe,0xbb,0xb0,0x1f,0x9f,0x9f,0x7e,0xef,0xff,0xee,0xe0,0x0d,
-0xcf,0xcf,0x04,0x47,0xfb,0x44,0x30,0x0b,0xef,0xfa,0x41,0x88,0xa1,0x06,0x9f,0xa5,
-0x45,0x58,0xfb,0x55,0x52,0x4f,0xff,0xe7,0x77,0x51,0xf5,0x28,0xdf,0xc7,0x05,0xc2,
-0x5e,0x10,0xef,0x06,0x2f,0x00,0x6f,0x95,0xa1,0xfc,0x0e,0xe4,0x44,0x7f,0x70,0x0d,
-0xff,0xbf,0x4e,0xd9,0x8b,0xb1,0xaf,0x68,0x0e,0xe3,0x33,0x7f,0x70,0x2d,0x5f,0x60,
-0x0e,0x5e,0x76,0x80,0x4f,0x60,0x0e,0xd0,0x07,0xaf,0x60,0x00,0x08,0x00,0x29,0x0b,
-0xfc,0xa5,0x32,0x80,0x13,0x58,0x90,0x00,0x03,0x9a,0xbd,0xef,0x71,0x09,0x00,0x29,
-0x20,0xa1,0xc9,0x75,0x10,0x00,0x00,0x10,0x2d,0xf6,0x00,0x87,0x29,0x66,0x20,0x40,
-0x1b,0xa9,0x05,0x13,0x6f,0x29,0x1c,0x60,0x2b,0xab,0xff,0xc4,0x3a,0x10,0xd0,0xcb,
-0x42,0xe7,0x34,0x8f,0xe2,0x35,0x75,0x00,0x2c,0x71,0xe0,0xdb,0xa8,0x7e,0xf3,0x20,
-0x4f,0x80,0x00,0x06,0x93,0x0e,0xf0,0x4b,0x23,0x81,0xe6,0x20,0x0e,0xf0,0x17,0xe3,
-0xe0,0xff,0x50,0x0e,0xf0,0x06,0xff,0x60,0x09,0xe4,0x2d,0xdf,0xf0,0x00,0x5f,0x20,
-0xde,0x03,0x18,0xa7,0x12,0x32,0x98,0x0a,0x30,0xc0,0xec,0x5f,0xc3,0x21,0xf0,0x00,
-0x0a,0xf1,0xec,0x3b,0xfd,0xab,0xfc,0x00,0x0a,0xf1,0xec,0x00,0xbf,0x5d,0xf3,0x08,
-0x00,0x00,0x86,0x4f,0x70,0x00,0x0a,0xf1,0xed,0x6d,0xff,0xef,0xdd,0x97,0xd1,0xdf,
-0xef,0xc5,0x05,0xdf,0x50,0x00,0x28,0xff,0x85,0x7e,0x60,0x02,0x90,0x00,0x10,0xfc,
-0xea,0x08,0x90,0x19,0xdf,0xfc,0x40,0x6f,0xc1,0x00,0x03,0xbf,0xbc,0x8f,0xf0,0x0d,
-0xfe,0x20,0x02,0xfe,0xdb,0xaf,0xf8,0x66,0x6e,0x50,0x00,0x3c,0xf6,0x0d,0xf1,0x9e,
-0x71,0x00,0x1c,0xff,0x78,0x9f,0xf0,0x2b,0xfe,0x50,0x07,0xa2,0x0e,0x94,0x25,0x4b,
-0x20,0xec,0x92,0x30,0xf7,0x77,0xfe,0x31,0x4d,0x10,0xdf,0xc0,0x61,0x60,0xff,0x00,
-0x0d,0xfa,0xaa,0xff,0x22,0x5d,0x65,0xdf,0x77,0x7f,0xe7,0x77,0xef,0x28,0x93,0x52,
-0x38,0xef,0xc7,0x7c,0xf6,0x76,0x24,0xa0,0xc5,0x82,0x00,0x00,0x25,0xae,0xfc,0x40,
-0x4f,0xe4,0xf6,0x4a,0xf0,0x12,0xee,0xff,0xff,0xf4,0x02,0xec,0xca,0x9f,0xf7,0x66,
-0x6e,0x60,0x05,0xdf,0x50,0xef,0x0a,0xe8,0x10,0x2e,0xfe,0x58,0xaf,0xf0,0x29,0xff,
-0x70,0x57,0x00,0x7f,0xe7,0x00,0x03,0xa6,0x64,0x03,0xdb,0x0d,0x13,0xd0,0xb7,0x11,
-0x21,0x60,0x3f,0x55,0xcb,0xd0,0xfc,0x01,0x3d,0xde,0xff,0xdd,0xd0,0x0c,0xf3,0x6e,
-0x60,0x01,0xff,0xfe,0x83,0x50,0xef,0x50,0x01,0xff,0x00,0xf0,0xb0,0x01,0x80,0x07,
-0x31,0x13,0x9f,0xa0,0x08,0x00,0x42,0x07,0xfe,0x56,0x10,0x18,0x00,0x20,0xff,0x40,
-0x08,0x00,0x33,0x4e,0xb8,0x53,0xa7,0x07,0x11,0x36,0x08,0x00,0xc0,0x5a,0xdf,0xff,
-0x8a,0xab,0xff,0xaa,0xa1,0x9f,0xfd,0xa6,0xbf,0xf9,0x02,0x50,0x35,0x10,0x00,0x23,
-0x33,0x8b,0x10,0x24,0x08,0x40,0xa0,0x86,0x40,0x6b,0xbb,0xbb,0xb8,0x9d,0xb0,0x00,
-0x62,0x47,0x00,0x00,0x7b,0xf0,0x3b,0x01,0xfd,0x0a,0xf3,0x00,0x0a,0xf3,0x8f,0x42,
-0xfb,0x0e,0xf0,0x00,0x6f,0xeb,0xfd,0x03,0xfa,0x2f,0xe9,0x70,0x4f,0xff,0xf3,0x05,
-0xfa,0x7f,0xff,0xe0,0x01,0x6f,0x80,0x06,0xff,0x10,0x3f,0xa0,0x03,0xff,0xad,0x29,
-0xff,0x70,0x9f,0x50,0x4e,0xff,0xfc,0x1c,0xfe,0xf2,0xfe,0x00,0x3f,0xb6,0x11,0x2f,
-0xd5,0xfe,0xf7,0x00,0x01,0x05,0xbf,0xbf,0x80,0xbf,0xf0,0x00,0x1a,0xff,0xfb,0xff,
-0x36,0x43,0xd7,0xe0,0xe8,0x28,0xfc,0xaf,0xf7,0xcf,0xe4,0x05,0x00,0x07,0xf2,0x8e,
-0x50,0x09,0xf3,0x4a,0x17,0x10,0xda,0x1c,0x00,0xac,0x1e,0x40,0x0b,0xf3,0x0c,0xf2,
-0x9e,0x68,0x40,0x0b,0xf2,0x0c,0xf1,0xe8,0x2d,0xf1,0x14,0x0c,0xf2,0x0d,0xf1,0x00,
-0x05,0xf9,0x44,0x0c,0xf1,0x0e,0xf0,0x00,0x1e,0xe2,0xdf,0x1d,0xf0,0x0e,0xf0,0x00,
-0x7f,0xff,0xf6,0x0f,0xf0,0x0f,0xf0,0x00,0x1b,0xaf,0xc0,0x0f,0xd0,0x1f,0xde,0x9f,
-0xf0,0x26,0x2f,0xe0,0x3f,0xf5,0x00,0x0a,0xfd,0xba,0x5f,0xf8,0x6f,0xf8,0x00,0x4f,
-0xff,0xe8,0x8f,0xff,0xcf,0xfc,0x00,0x09,0x41,0x01,0xdf,0x9e,0xff,0xcf,0x20,0x00,
-0x38,0xed,0xfe,0x07,0xfb,0x5f,0x90,0x4e,0xff,0xde,0xf9,0x1e,0xf5,0x0f,0xf3,0x2f,
-0x93,0x2f,0xf1,0x8f,0xc0,0x08,0xf3,0x04,0x8a,0x40,0x07,0x30,0x00,0x50,0x8a,0xa0,
-0x31,0x0d,0xf2,0x92,0x13,0x2e,0x40,0x0d,0xf5,0xff,0x20,0x67,0x9d,0x90,0x0c,0xf1,
-0x4a,0x30,0x00,0xee,0x17,0x15,0x8e,0xf3,0xba,0xf0,0x22,0xf5,0x6f,0x8f,0xff,0xfc,
-0x97,0x30,0x3f,0xff,0xfe,0x05,0x3a,0xf3,0x01,0x40,0x0d,0xbf,0xf3,0x00,0x2a,0xfd,
-0xef,0xf1,0x00,0x6f,0x80,0x4f,0xff,0xff,0xda,0x71,0x04,0xff,0x9b,0x7b,0x98,0xfa,
-0x0a,0xa1,0x1f,0xff,0xfd,0x30,0x00,0xfd,0x8f,0xb0,0x0a,0x84,0xff,0x54,0xf1,0x18,
-0xfd,0x10,0x00,0x04,0x9e,0x50,0x04,0xdf,0xd1,0x30,0x1b,0xff,0xfc,0x45,0xbf,0xff,
-0xe1,0xe5,0x0f,0xd7,0x10,0xbf,0xfa,0x39,0xff,0xf4,0x01,0x00,0x00,0x19,0x20,0x00,
-0xbf,0xb0,0x00,0x36,0x00,0x00,0x38,0xe4,0xb0,0x10,0x60,0x4b,0x53,0x00,0x55,0x79,
-0x02,0xef,0xd2,0x20,0xf9,0x00,0x50,0x09,0x60,0xb0,0x0a,0xf2,0xd7,0x03,0xf9,0xca,
-0x0b,0x31,0xda,0xf7,0xdf,0x79,0x9d,0x40,0xff,0xd0,0x9f,0xeb,0xa4,0x19,0x50,0x9f,
-0x40,0x4f,0x92,0xfb,0x71,0x83,0x11,0x44,0xff,0x3a,0xf8,0x1f,0x2e,0xff,0xf9,0x6b,
-0xab,0xfe,0xaa,0x70,0x1e,0xa7,0x30,0x0a,0x61,0xfb,0x28,0x00,0x00,0x27,0xd7,0x7f,
-0x81,0xfb,0x7f,0x70,0x3c,0xff,0xc7,0xfe,0x01,0xfb,0x0e,0xf1,0x2f,0xa3,0x08,0xf3,
-0x9c,0xfa,0x06,0xe3,0x02,0x00,0x00,0x20,0xaf,0xd4,0xe2,0x0d,0x14,0x50,0x80,0xb8,
-0x12,0x08,0x07,0x42,0x50,0x70,0x08,0xfc,0xbb,0xff,0x42,0x5d,0x20,0x08,0xf4,0xd0,
-0x7e,0x40,0xf5,0x3f,0x68,0xf4,0x8d,0xc8,0x60,0xf8,0xdf,0x28,0xfd,0xbb,0xff,0x29,
-0xe2,0x01,0x28,0x00,0x31,0x04,0x4f,0xa0,0x20,0x00,0x70,0x01,0xde,0x35,0x38,0xf4,
-0x00,0xdf,0x2a,0x67,0x10,0x68,0x38,0x00,0x41,0x1f,0xd9,0x63,0x08,0x94,0x9a,0x30,
-0x00,0x26,0x18,0x18,0x00,0x50,0x28,0xbf,0xff,0x48,0xf4,0x10,0x7f,0xa2,0xfc,0x73,
-0xad,0xfc,0xbb,0xff,0xb3,0x04,0x00,0x00,0x94,0x1b,0x23,0x04,0x82,0x54,0x1c,0x11,
-0xf6,0x2c,0xc5,0x00,0x0d,0xc7,0xa0,0xfe,0xff,0xef,0xf1,0x00,0xcf,0x40,0x1f,0xa0,
-0xed,0x6c,0xab,0x20,0x0b,0x6f,0x08,0x00,0x40,0x3f,0xfb,0xcf,0xcf,0x08,0x00,0x40,
-0x1f,0xff,0xfd,0x2f,0x08,0x00,0x41,0x04,0x2d,0xf2,0x1f,0xbc,0x27,0xb0,0xcf,0x74,
-0x4f,0xeb,0xff,0xbe,0xf1,0x2d,0xff,0xff,0x9f,0x18,0x00,0x31,0x0e,0xda,0x74,0x20,
-0x00,0x00,0x35,0xa9,0x00,0x08,0x00,0x40,0x17,0x9c,0xef,0xaf,0x20,0x00,0x41,0x3f,
-0xff,0xda,0x5f,0x4f,0x7c,0x10,0x30,0x74,0x0c,0x82,0x0a,0xd1,0x00,0x06,0x20,0x00,
-0x07,0x40,0x41,0x1e,0x11,0x8f,0x38,0xa4,0x00,0x29,0x1e,0x00,0x97,0x94,0xf0,0x0c,
-0x10,0x1d,0xfe,0x99,0xff,0x50,0x09,0xf5,0x6d,0xdf,0xff,0x47,0xfc,0x00,0x5f,0xf8,
-0xee,0x9b,0x3f,0xff,0xe1,0x00,0x5f,0xff,0xf5,0x00,0x0b,0xb2,0xde,0xf0,0x1e,0x6f,
-0x90,0x05,0xdf,0xdf,0xfc,0x40,0x03,0xfd,0x24,0xcf,0xf9,0x02,0xcf,0xf7,0x3e,0xff,
-0xff,0x3a,0x28,0xd7,0x04,0x90,0x2f,0xda,0x85,0x00,0x06,0xdf,0xe2,0x00,0x01,0x00,
-0x01,0x10,0x51,0x06,0xa0,0x00,0x25,0x8b,0xef,0x78,0xff,0xc6,0x68,0x04,0x80,0xda,
-0x40,0x5a,0xff,0xf9,0x10,0x27,0x41,0x64,0x01,0x16,0xed,0x53,0x48,0x14,0x09,0xf0,
-0xb8,0x01,0x4d,0x0d,0x00,0x0d,0xa6,0x70,0x2b,0xbb,0xbd,0xff,0x30,0x02,0xfc,0x5f,
-0xba,0x00,0xa4,0x93,0xf0,0x12,0x6f,0x90,0x04,0xef,0xb0,0x00,0x7f,0xfe,0xff,0x24,
-0xbf,0xff,0xe6,0x00,0x4f,0xdf,0xf6,0xcf,0xfd,0x58,0xff,0xe4,0x00,0x8f,0x90,0xad,
-0x50,0x00,0x19,0xe2,0x06,0xff,0x9b,0xf6,0x21,0x50,0x70,0x6f,0xff,0xff,0x3f,0x79,
-0x17,0x60,0x2e,0xa6,0x30,0x01,0x14,0xfb,0x2d,0x34,0x10,0x37,0x99,0x06,0x00,0x70,
-0x01,0x30,0x10,0x03,0xfb,0xbf,0x9f,0x10,0x95,0x5c,0x1a,0x4a,0xc5,0x17,0x20,0x00,
-0x83,0x0f,0x51,0xc9,0x00,0x0f,0x90,0x00,0xc6,0x59,0xf7,0x5d,0x0f,0x90,0x7f,0xff,
-0xb0,0x04,0xf8,0x06,0xaf,0xd9,0x7f,0x9f,0xf0,0x0a,0xf3,0x19,0xff,0xff,0x7f,0x2f,
-0xb0,0x1f,0xa7,0xe3,0x2f,0xa1,0x7f,0x4f,0x70,0x9f,0xce,0xe0,0x0f,0x90,0x7f,0x8f,
-0x30,0x8f,0xff,0x56,0xff,0xfc,0x7f,0xbf,0x00,0x13,0xed,0x04,0xbf,0xe8,0x7f,0x7f,
-0x50,0x08,0xf7,0x40,0x1f,0x90,0x7f,0x1d,0xd0,0x6f,0xff,0xd8,0x9f,0xc8,0x9f,0x18,
-0xf1,0x5e,0xa6,0x2e,0xff,0xff,0xaf,0x16,0xf3,0x00,0x04,0x71,0xaf,0x41,0x8f,0x8d,
-0xf1,0x39,0xef,0xe1,0xfd,0x00,0x7f,0xcf,0x80,0x9f,0xa5,0x0c,0xf5,0x00,0x7f,0x21,
-0x00,0x10,0x00,0x07,0x90,0x00,0x7f,0x10,0xe0,0x03,0x13,0x50,0x2b,0x5b,0x12,0xb0,
-0x08,0x00,0xa1,0xef,0x30,0x7c,0xcd,0xff,0xcc,0xc0,0x06,0xfa,0x14,0x03,0x59,0x41,
-0x1e,0xf1,0x9f,0x70,0x2a,0xd3,0x50,0xfc,0xfe,0x10,0x04,0xfc,0x41,0x07,0x20,0xf4,
-0x2f,0xe8,0x00,0x40,0x12,0x9f,0x80,0x2c,0x47,0x7d,0x43,0x07,0xfe,0x57,0x20,0xe6,
-0x45,0x10,0x6c,0x59,0x0b,0xc0,0x5f,0xc9,0x63,0x0c,0xfb,0xaa,0xdf,0x60,0x01,0x00,
-0x01,0x1c,0x28,0x5f,0x51,0x36,0x9b,0xef,0x7c,0xf1,0x30,0x5f,0x20,0xeb,0x4c,0x20,
-0x00,0xe1,0x58,0x52,0x00,0x0c,0xfb,0xbb,0xde,0x60,0x00,0x05,0x20,0x00,0x36,0x10,
-0x50,0xbb,0x00,0xd3,0x2a,0x00,0x95,0x35,0x11,0x04,0x4a,0x11,0xf1,0x03,0xde,0x10,
-0x1e,0xf9,0x9d,0xf8,0x00,0x07,0xf5,0x5e,0xdf,0x80,0x1f,0xd0,0x00,0x4f,0xf9,0xee,
-0x68,0xef,0xf2,0x0a,0x4f,0xff,0xf4,0x0f,0xea,0xfd,0xaf,0xa0,0x04,0x5f,0x90,0x0f,
-0xa0,0xf9,0x1f,0xa0,0x02,0xed,0x24,0x3f,0xb0,0xf9,0x1f,0xa0,0x2d,0x0a,0x0e,0x40,
-0xa0,0x3f,0xda,0x73,0x65,0x6a,0x40,0x60,0x02,0x00,0x02,0x8e,0xc5,0xf1,0x04,0x30,
-0x16,0x9c,0xff,0x8f,0xb0,0x00,0x05,0xf6,0x5f,0xfd,0x95,0x1f,0xfa,0xaa,0xae,0xf2,
-0x15,0x10,0x7a,0x92,0x72,0x80,0x00,0x2a,0x30,0x00,0x06,0xa1,0xf0,0x00,0x21,0x09,
-0xf7,0xf0,0x00,0x91,0x8a,0xac,0xfc,0xaa,0xa0,0x06,0xfb,0x31,0xcf,0xf0,0x00,0xf0,
-0x25,0xf2,0xdf,0x20,0xaf,0x91,0x72,0x00,0xaf,0xfd,0xfa,0x06,0xfc,0x03,0xfc,0x00,
-0x6f,0xff,0xe2,0x8f,0xfa,0xab,0xff,0x60,0x01,0xbf,0x50,0xef,0xff,0xfd,0xce,0xe0,
-0x08,0xfe,0x9a,0x68,0xd7,0x3a,0x66,0x60,0x7f,0xff,0xfb,0x06,0xf7,0x4f,0x90,0x00,
-0x4e,0x95,0x10,0x08,0xf6,0xed,0x2a,0xf0,0x09,0x04,0x9d,0x0c,0xf2,0x4f,0x94,0x91,
-0x39,0xef,0xfc,0x6f,0xe0,0x4f,0x95,0xf4,0x6f,0xf9,0x38,0xff,0x40,0x3f,0xdc,0xf1,
-0x26,0x42,0x1c,0x11,0x0c,0x73,0x07,0x1a,0x10,0xa3,0x6e,0x12,0x50,0x19,0x0c,0x50,
-0x3f,0xb0,0x08,0x8a,0xfc,0xb5,0x75,0x21,0x40,0x0f,0xa2,0x8c,0x21,0xfc,0x10,0x71,
-0x88,0xc1,0x0a,0xf4,0x9c,0x6a,0xac,0xfd,0xaa,0x91,0x5f,0xe7,0xfa,0x8f,0x3f,0xed,
-0x60,0xef,0xe1,0x04,0xc5,0xec,0x0f,0x1b,0x5d,0xb0,0x38,0x7b,0xfc,0x17,0x30,0x04,
-0xfe,0xba,0x5e,0xc0,0xfc,0xf9,0x23,0xa1,0xe7,0x8b,0xd9,0xfd,0x99,0x90,0x1d,0x72,
-0x01,0xef,0xec,0x06,0xf6,0x10,0x27,0xdc,0x11,0x4f,0xe5,0x71,0x10,0x3c,0xff,0xd6,
-0x03,0xef,0x6a,0xfa,0x00,0x3f,0xa4,0x01,0x9f,0xf7,0x00,0x8f,0xc1,0x01,0x00,0x00,
-0xbd,0x40,0x00,0x07,0xd1,0x29,0x28,0x04,0x00,0x82,0x22,0xc0,0x0f,0x0d,0x54,0x21,
-0x80,0x09,0x3d,0x2f,0xb0,0xef,0x10,0x05,0x77,0x77,0x9f,0x90,0x06,0xf7,0x7c,0x1a,
-0x62,0x0f,0x30,0x2e,0xf8,0xee,0x36,0x08,0x20,0x80,0x1f,0x6e,0x62,0x00,0x95,0x6b,
-0xf0,0x0e,0x6f,0x90,0x29,0x99,0xfe,0x99,0x96,0x01,0xee,0x35,0x0c,0x70,0xfd,0x08,
-0xc3,0x1d,0xff,0xff,0x09,0xf4,0xff,0xaf,0x90,0x0d,0xb8,0x52,0x00,0x7c,0xff,0xc2,
-0xed,0xf0,0x09,0x7b,0x08,0xfd,0xfe,0xfe,0x40,0x09,0xef,0xfc,0xbf,0x90,0xfd,0x3f,
-0xf9,0x0f,0xe9,0x20,0x24,0x49,0xfc,0x01,0x92,0x03,0x00,0x98,0xce,0x07,0x00,0x01,
-0xc0,0x29,0x30,0x00,0x12,0x45,0x7a,0x10,0x00,0x8f,0x71,0xff,0xff,0x98,0x01,0xf1,
-0x0b,0xef,0x10,0x7c,0x59,0xa1,0x5d,0x50,0x06,0xf9,0x20,0x5f,0x49,0xf0,0xbf,0x20,
-0x0e,0xf1,0xcb,0x4f,0x88,0xc5,0xfa,0x20,0xaf,0xda,0xf9,0xb6,0xc0,0xb2,0x8f,0xff,
-0xd0,0x47,0xfb,0x44,0x44,0x40,0x12,0xaf,0x38,0x0a,0x16,0xb0,0xfb,0x7a,0x7b,0xfa,
-0x77,0x77,0x70,0x7f,0xff,0xfa,0x0a,0xf3,0x69,0xf0,0x06,0x4d,0x95,0x20,0x0f,0xfd,
-0x67,0xfe,0x00,0x00,0x05,0xa9,0x7f,0xef,0x89,0xf7,0x00,0x4a,0xff,0xfa,0xfe,0x1c,
-0x76,0x4a,0xe1,0xd6,0x4e,0xf9,0xaf,0xff,0xfe,0x93,0x33,0x00,0x1d,0x67,0xfa,0x33,
-0xaf,0xd5,0xbe,0x10,0x10,0x03,0x00,0x52,0x16,0x10,0x00,0x02,0x83,0xf9,0xba,0x20,
-0x6f,0xb0,0x31,0x15,0x11,0x9f,0x47,0x02,0xf0,0x02,0x62,0x0a,0xf9,0x99,0x99,0xfb,
-0x0b,0xe1,0xea,0xaf,0x65,0x55,0x5f,0xb6,0xfd,0xcf,0x4a,0xf5,0x00,0x50,0x5f,0xef,
-0xa0,0xaf,0x32,0xba,0xd3,0x20,0xf1,0x0b,0xad,0x00,0xf0,0x0b,0x05,0xfb,0x83,0xcf,
-0xfa,0xfb,0xfc,0xf4,0xff,0xff,0x5e,0xff,0x3f,0x5e,0x7f,0x3f,0xc7,0x32,0xff,0xf9,
-0xfa,0xfb,0xf0,0x10,0x5b,0x8f,0xc3,0x07,0xf5,0x08,0x39,0xef,0xdd,0xf7,0xf3,0xf5,
-0xe7,0xf6,0xfb,0x42,0xfc,0x4f,0x3f,0x5e,0xaf,0x11,0x00,0x07,0x54,0xf3,0xb3,0xad,
-0x90,0x60,0xbd,0x03,0x4d,0x6d,0x21,0x4f,0x90,0x30,0x28,0x33,0x00,0xaf,0x31,0x9f,
-0x9b,0x11,0x01,0xcf,0x43,0xc1,0x09,0xf3,0xc8,0xdd,0x70,0x00,0x05,0xa3,0x5f,0xd9,
-0xf7,0x0e,0xfa,0xe3,0xf0,0x1c,0xef,0xd0,0x5f,0x57,0x8f,0xd7,0x71,0x00,0x8f,0x40,
+0x1c,0xff,0xc8,0x51,0x1e,0xff,0xd7,0x00,0x00,0x6d,0xff,0xe1,0x05,0x62,0xf5,0x00,
+0xe0,0x36,0x40,0x00,0x0f,0xd0,0x00,0x03,0xfb,0x00,0x00,0x3b,0x1f,0xd5,0xd4,0x08,
+0x00,0x40,0x2f,0x5f,0xd8,0xf2,0x08,0x00,0xf1,0x07,0x0e,0x9f,0xdc,0xc0,0x03,0xfe,
+0xbb,0xb6,0x0c,0xbf,0xef,0x60,0x03,0xff,0xff,0xf8,0x25,0x4f,0xe5,0x40,0x03,0xfb,
+0x6f,0x02,0x10,0xf1,0x08,0x00,0x60,0x5a,0xcf,0xfa,0xa1,0x04,0xfb,0x28,0x02,0x20,
+0xf4,0x0e,0x08,0x05,0xf0,0x05,0x04,0xff,0xff,0x3e,0xfc,0xbb,0xcf,0xe0,0x0d,0xff,
+0xee,0xee,0xf1,0x00,0x0f,0xe0,0x8f,0x8f,0xd4,0x6e,0x08,0x00,0xb1,0x7e,0x1f,0xd0,
+0x0e,0xf1,0x00,0x1f,0xe0,0x04,0x0f,0xd0,0x28,0x00,0x8d,0x00,0x0f,0xd0,0x0e,0xfc,
+0xbb,0xce,0xd0,0x0a,0x0b,0x20,0x4f,0x60,0x6a,0x0b,0xf0,0x0e,0x00,0x2c,0x5f,0x6e,
+0x8b,0xbc,0xfe,0xbb,0xb0,0x1f,0x9f,0x9f,0x7e,0xef,0xff,0xee,0xe0,0x0d,0xcf,0xcf,
+0x04,0x47,0xfb,0x44,0x30,0x0b,0xef,0xfa,0x0e,0x38,0x03,0xc0,0x06,0x9f,0xa5,0x45,
+0x58,0xfb,0x55,0x52,0x4f,0xff,0xfe,0xaf,0xe8,0x03,0xb0,0x28,0xdf,0xc7,0x05,0x66,
+0x66,0x66,0x20,0x00,0xef,0xf2,0x20,0x00,0xd0,0x70,0x05,0xff,0xfc,0x0e,0xe4,0x44,
+0x7f,0x70,0x0d,0xff,0xbf,0x4e,0x10,0x00,0xb1,0x6f,0xaf,0x68,0x0e,0xe3,0x33,0x7f,
+0x70,0x2d,0x5f,0x60,0x20,0x00,0x90,0x01,0x4f,0x60,0x0e,0xd0,0x07,0xaf,0x60,0x00,
+0x08,0x00,0x38,0x0b,0xfc,0x20,0x83,0x00,0x80,0x13,0x58,0x90,0x00,0x03,0x9a,0xbd,
+0xef,0x71,0x09,0xe0,0x03,0xff,0xff,0xff,0xc9,0x75,0x10,0x00,0x00,0x10,0x2d,0xf6,
+0x00,0x87,0x79,0x05,0x30,0xef,0x40,0x1b,0xa9,0x05,0x11,0x6f,0xbe,0x03,0xf1,0x04,
+0x00,0x00,0x2b,0xab,0xff,0xc4,0x3a,0x10,0x00,0x00,0x03,0xaf,0xe7,0x34,0x8f,0xe2,
+0x00,0x02,0xdf,0x27,0x06,0xf1,0x1f,0x10,0x00,0xdb,0xa8,0x7e,0xf3,0x20,0x4f,0x80,
+0x00,0x06,0x93,0x0e,0xf0,0x4b,0x23,0x00,0x00,0x6f,0xf4,0x0e,0xf0,0x9f,0xf5,0x00,
+0x0a,0xff,0x50,0x0e,0xf0,0x06,0xff,0x60,0x09,0xe4,0x2d,0xdf,0xf0,0x00,0x5f,0x70,
+0x00,0x00,0x0c,0xfd,0x60,0x76,0x00,0x12,0x32,0x98,0x0a,0x20,0xc0,0xec,0xba,0x02,
+0xf1,0x01,0x30,0x0a,0xf1,0xec,0x3b,0xfd,0xab,0xfc,0x00,0x0a,0xf1,0xec,0x00,0xbf,
+0x5d,0xf3,0x08,0x00,0xf1,0x0c,0x3f,0xff,0x70,0x00,0x0a,0xf1,0xed,0x6d,0xff,0xef,
+0xfd,0x80,0x00,0x00,0xdf,0xef,0xc5,0x05,0xdf,0x50,0x00,0x28,0xff,0x85,0x7e,0x60,
+0x02,0x90,0x00,0x10,0xfc,0xea,0x08,0xf2,0x22,0x19,0xdf,0xfc,0x40,0x6f,0xc1,0x00,
+0x03,0xbf,0xff,0xfe,0xef,0xff,0xfe,0x20,0x02,0xfe,0xdb,0xaf,0xf8,0x66,0x6e,0x50,
+0x00,0x3c,0xf6,0x0d,0xf1,0x9e,0x71,0x00,0x1c,0xff,0x78,0x9f,0xf0,0x2b,0xfe,0x50,
+0x07,0xa2,0x08,0xfe,0x80,0x00,0x4b,0x20,0x00,0xdf,0x38,0x04,0xf3,0x10,0x0d,0xf7,
+0x77,0xfe,0x77,0x7e,0xf0,0x00,0xdf,0xbb,0xbf,0xfb,0xbb,0xff,0x00,0x0d,0xfa,0xaa,
+0xff,0xaa,0xaf,0xf0,0x00,0xdf,0x77,0x7f,0xe7,0x77,0xef,0x00,0x0d,0x7d,0x02,0x70,
+0x38,0xef,0xc7,0x7c,0xf6,0x00,0x00,0x3b,0x09,0xf3,0x24,0xc5,0x82,0x00,0x00,0x25,
+0xae,0xfc,0x40,0x4f,0xe4,0x00,0x4c,0xff,0xff,0xee,0xff,0xff,0xf4,0x02,0xec,0xca,
+0x9f,0xf7,0x66,0x6e,0x60,0x05,0xdf,0x50,0xef,0x0a,0xe8,0x10,0x2e,0xfe,0x58,0xaf,
+0xf0,0x29,0xff,0x70,0x57,0x00,0x7f,0xe7,0x00,0x03,0xa1,0x00,0x04,0x00,0xdb,0x0d,
+0x03,0xf4,0x01,0x30,0xaf,0x60,0x3f,0x54,0x00,0xc0,0x02,0xfc,0x01,0x3d,0xde,0xff,
+0xdd,0xd0,0x0c,0xf3,0x6e,0x60,0x70,0x07,0x40,0x9f,0xe9,0xef,0x50,0x08,0x00,0x31,
+0x8f,0xff,0xf8,0x80,0x07,0x31,0x13,0x9f,0xa0,0x08,0x00,0x42,0x07,0xfe,0x56,0x10,
+0x18,0x00,0x20,0xff,0x40,0x08,0x00,0x33,0x4e,0xb8,0x53,0xa7,0x07,0x11,0x36,0x08,
+0x00,0xc0,0x5a,0xdf,0xff,0x8a,0xab,0xff,0xaa,0xa1,0x9f,0xfd,0xa6,0xbf,0xf9,0x02,
+0xb3,0x35,0x10,0x00,0x23,0x33,0x33,0x33,0x30,0x00,0x08,0x40,0xaf,0x07,0xa0,0xd0,
+0x6b,0xbb,0xbb,0xb8,0x00,0x00,0x9f,0x50,0x8f,0xba,0x0b,0xf0,0x51,0x01,0xfd,0x13,
+0x01,0xfd,0x0a,0xf3,0x00,0x0a,0xf3,0x8f,0x42,0xfb,0x0e,0xf0,0x00,0x6f,0xeb,0xfd,
+0x03,0xfa,0x2f,0xe9,0x70,0x4f,0xff,0xf3,0x05,0xfa,0x7f,0xff,0xe0,0x01,0x6f,0x80,
+0x06,0xff,0x10,0x3f,0xa0,0x03,0xff,0xad,0x29,0xff,0x70,0x9f,0x50,0x4e,0xff,0xfc,
+0x1c,0xfe,0xf2,0xfe,0x00,0x3f,0xb6,0x11,0x2f,0xd5,0xfe,0xf7,0x00,0x01,0x05,0xbf,
+0xbf,0x80,0xbf,0xf0,0x00,0x1a,0xff,0xfb,0xff,0x36,0xff,0xfa,0x00,0x2f,0xe8,0x28,
+0xfc,0xaf,0xf7,0xcf,0xe4,0x05,0x00,0x07,0xf2,0x8e,0x50,0x09,0xe1,0x49,0x05,0x18,
+0x01,0x56,0x02,0xc0,0x1d,0x60,0x0b,0xf3,0x0c,0xf2,0x00,0x00,0x7f,0x90,0x0b,0xf2,
+0x09,0x05,0xf0,0x58,0xdf,0x20,0x0c,0xf2,0x0d,0xf1,0x00,0x05,0xf9,0x44,0x0c,0xf1,
+0x0e,0xf0,0x00,0x1e,0xe2,0xdf,0x1d,0xf0,0x0e,0xf0,0x00,0x7f,0xff,0xf6,0x0f,0xf0,
+0x0f,0xf0,0x00,0x1b,0xaf,0xc0,0x0f,0xd0,0x1f,0xf1,0x00,0x00,0xcf,0x20,0x2f,0xe0,
+0x3f,0xf5,0x00,0x0a,0xfd,0xba,0x5f,0xf8,0x6f,0xf8,0x00,0x4f,0xff,0xe8,0x8f,0xff,
+0xcf,0xfc,0x00,0x09,0x41,0x01,0xdf,0x9e,0xff,0xcf,0x20,0x00,0x38,0xed,0xfe,0x07,
+0xfb,0x5f,0x90,0x4e,0xff,0xde,0xf9,0x1e,0xf5,0x0f,0xf3,0x2f,0x93,0x2f,0xf1,0x8f,
+0xc0,0x08,0xf3,0x00,0x00,0x03,0x70,0x07,0x30,0x00,0x50,0xf6,0xe0,0x00,0x08,0x70,
+0x00,0x0d,0xf2,0x92,0x00,0x00,0x0f,0xf1,0x00,0x0d,0xf5,0xff,0x20,0x00,0x6f,0x90,
+0x00,0x0c,0xf1,0x4a,0x30,0x00,0xee,0x17,0x15,0x8e,0xff,0xff,0xa0,0x09,0xf5,0x6f,
+0x8f,0xff,0xfc,0x97,0x30,0x3f,0xff,0xfe,0x05,0x3a,0xf3,0x01,0x40,0x0d,0xbf,0xf3,
+0x00,0x2a,0xfd,0xef,0xf1,0x00,0x6f,0x80,0x4f,0xff,0xff,0xda,0x71,0x04,0xff,0x9b,
+0x7b,0x98,0xfa,0x0a,0xa1,0x1f,0xff,0xfd,0x30,0x00,0xfd,0x8f,0xb0,0x0a,0x84,0x10,
+0x00,0x00,0xcf,0xfd,0x10,0x00,0x04,0x9e,0x50,0x04,0xdf,0xd1,0x30,0x1b,0xff,0xfc,
+0x45,0xbf,0xff,0xe1,0xe5,0x0f,0xd7,0x10,0xbf,0xfa,0x39,0xff,0xf4,0x01,0x00,0x00,
+0x19,0x20,0x00,0xbf,0xb0,0x00,0x36,0x00,0x00,0x38,0x40,0x00,0x00,0x00,0x8f,0x60,
+0x00,0x7f,0x60,0x00,0x00,0x00,0xdf,0x10,0xff,0xff,0xff,0xff,0xe0,0x03,0xf9,0x00,
+0xcc,0xff,0xcc,0xcc,0xb0,0x0a,0xf2,0xd7,0x03,0xf9,0x00,0x00,0x00,0x5f,0xda,0xf7,
+0xdf,0xff,0xfb,0x00,0x00,0x4f,0xff,0xd0,0x9f,0xeb,0xfb,0x00,0x00,0x04,0x9f,0x40,
+0x4f,0x92,0xfb,0x00,0x00,0x03,0xfc,0x44,0xcf,0xff,0xff,0xff,0xb0,0x2e,0xff,0xf9,
+0x6b,0xab,0xfe,0xaa,0x70,0x1e,0xa7,0x30,0x0a,0x61,0xfb,0x28,0x00,0x00,0x27,0xd7,
+0x7f,0x81,0xfb,0x7f,0x70,0x3c,0xff,0xc7,0xfe,0x01,0xfb,0x0e,0xf1,0x2f,0xa3,0x08,
+0xf3,0x9c,0xfa,0x06,0xe3,0x02,0x00,0x00,0x20,0xaf,0xd4,0x00,0x01,0x00,0x22,0x07,
+0x50,0x08,0x00,0xf0,0x0c,0x1f,0xe0,0x08,0xff,0xff,0xff,0x00,0x00,0x7f,0x70,0x08,
+0xfc,0xbb,0xff,0x00,0x00,0xee,0x02,0x08,0xf4,0x00,0xdf,0x00,0x07,0xf5,0x3f,0x68,
+0x08,0x00,0xb1,0x4f,0xf8,0xdf,0x28,0xfd,0xbb,0xff,0x00,0x3f,0xff,0xf6,0x28,0x00,
+0x31,0x04,0x4f,0xa0,0x20,0x00,0x40,0x01,0xde,0x35,0x38,0x08,0x00,0x40,0x2d,0xff,
+0xff,0x68,0x38,0x00,0x31,0x1f,0xd9,0x63,0x20,0x00,0x40,0x01,0x00,0x26,0x18,0x18,
+0x00,0x40,0x28,0xbf,0xff,0x48,0x08,0x00,0xf2,0x04,0x3f,0xfc,0x73,0xad,0xfc,0xbb,
+0xff,0xb3,0x04,0x00,0x00,0xef,0xff,0xff,0xff,0xf4,0x00,0x04,0x82,0x78,0x00,0xf0,
+0x0c,0x0c,0xf6,0x1f,0xff,0xff,0xff,0xf1,0x00,0x3f,0xd0,0x1f,0xfe,0xff,0xef,0xf1,
+0x00,0xcf,0x40,0x1f,0xa0,0xed,0x0b,0xf1,0x06,0xfa,0x0b,0x6f,0x08,0x00,0x40,0x3f,
+0xfb,0xcf,0xcf,0x08,0x00,0x40,0x1f,0xff,0xfd,0x2f,0x08,0x00,0x31,0x04,0x2d,0xf2,
+0x30,0x00,0xc0,0x01,0xcf,0x74,0x4f,0xeb,0xff,0xbe,0xf1,0x2d,0xff,0xff,0x9f,0x18,
+0x00,0x31,0x0e,0xda,0x74,0x20,0x00,0x31,0x00,0x00,0x01,0x08,0x00,0x40,0x17,0x9c,
+0xef,0xaf,0x20,0x00,0x40,0x3f,0xff,0xda,0x5f,0x30,0x00,0xd0,0x06,0x30,0x00,0x1f,
+0xa0,0x00,0x0a,0xd1,0x00,0x06,0x20,0x00,0x07,0x70,0x01,0xf0,0x5a,0x2f,0xe0,0x00,
+0x8f,0xb0,0x00,0x00,0x00,0x9f,0x70,0x02,0xff,0xff,0xff,0x70,0x01,0xfe,0x10,0x1d,
+0xfe,0x99,0xff,0x50,0x09,0xf5,0x6d,0xdf,0xff,0x47,0xfc,0x00,0x5f,0xf8,0xee,0x9b,
+0x3f,0xff,0xe1,0x00,0x5f,0xff,0xf5,0x00,0x0b,0xff,0x90,0x00,0x04,0x6f,0x90,0x05,
+0xdf,0xdf,0xfc,0x40,0x03,0xfd,0x24,0xcf,0xf9,0x02,0xcf,0xf7,0x3e,0xff,0xff,0x3a,
+0x28,0xd7,0x04,0x90,0x2f,0xda,0x85,0x00,0x06,0xdf,0xe2,0x00,0x01,0x00,0x01,0x10,
+0x51,0x06,0xa0,0x00,0x25,0x8b,0xef,0x78,0xff,0xc6,0x00,0x00,0x6f,0xff,0xda,0x40,
+0x5a,0xff,0xf9,0x10,0x27,0x41,0x64,0x01,0x13,0xed,0x6d,0x01,0x52,0x01,0x00,0x00,
+0x09,0x40,0x0b,0x00,0xf0,0x33,0x3f,0xd0,0x3f,0xff,0xff,0xff,0x50,0x00,0xaf,0x50,
+0x2b,0xbb,0xbd,0xff,0x30,0x02,0xfc,0x05,0x00,0x00,0x1d,0xf9,0x00,0x0b,0xf2,0x6f,
+0x90,0x04,0xef,0xb0,0x00,0x7f,0xfe,0xff,0x24,0xbf,0xff,0xe6,0x00,0x4f,0xdf,0xf6,
+0xcf,0xfd,0x58,0xff,0xe4,0x00,0x8f,0x90,0xad,0x50,0x00,0x19,0xe2,0x06,0xff,0x9b,
+0x39,0x99,0x99,0x99,0x70,0x6f,0xff,0xff,0x40,0x00,0xf0,0x01,0xa0,0x2e,0xa6,0x30,
+0x01,0x14,0xfb,0x11,0x10,0x00,0x00,0x37,0x00,0x03,0xfb,0x00,0x70,0x01,0x10,0x10,
+0x08,0x00,0xb0,0x5f,0xfe,0x95,0xcc,0xcd,0xfe,0xcc,0xc5,0x17,0x20,0x00,0x50,0x02,
+0x15,0xf7,0xf0,0x01,0x40,0xc9,0x00,0x0f,0x90,0x08,0x00,0xf6,0x5f,0xfd,0x00,0x0f,
+0x90,0x7f,0xff,0xb0,0x04,0xf8,0x06,0xaf,0xd9,0x7f,0x9f,0xf0,0x0a,0xf3,0x19,0xff,
+0xff,0x7f,0x2f,0xb0,0x1f,0xa7,0xe3,0x2f,0xa1,0x7f,0x4f,0x70,0x9f,0xce,0xe0,0x0f,
+0x90,0x7f,0x8f,0x30,0x8f,0xff,0x56,0xff,0xfc,0x7f,0xbf,0x00,0x13,0xed,0x04,0xbf,
+0xe8,0x7f,0x7f,0x50,0x08,0xf7,0x40,0x1f,0x90,0x7f,0x1d,0xd0,0x6f,0xff,0xd8,0x9f,
+0xc8,0x9f,0x18,0xf1,0x5e,0xa6,0x2e,0xff,0xff,0xaf,0x16,0xf3,0x00,0x04,0x71,0xaf,
+0x41,0x8f,0x8d,0xf1,0x39,0xef,0xe1,0xfd,0x00,0x7f,0xcf,0x80,0x9f,0xa5,0x0c,0xf5,
+0x00,0x7f,0x21,0x00,0x10,0x00,0x07,0x90,0x00,0x7f,0x10,0x70,0x02,0x21,0x1d,0x50,
+0xa8,0x00,0x00,0x7d,0x01,0x01,0x08,0x00,0xb0,0xef,0x30,0x7c,0xcd,0xff,0xcc,0xc0,
+0x06,0xfa,0x14,0x9f,0xa8,0x01,0xc0,0x1e,0xf1,0x9f,0x70,0x04,0xfc,0x00,0x00,0xbf,
+0xfc,0xfe,0x10,0x08,0x00,0x40,0x7f,0xff,0xf4,0x2f,0xe8,0x00,0xe0,0x12,0x9f,0x80,
+0x2c,0xcc,0xcc,0xcc,0x80,0x07,0xfe,0x57,0x20,0x00,0x00,0x18,0x00,0xf0,0x13,0xff,
+0x6c,0xff,0xff,0xff,0x60,0x5f,0xc9,0x63,0x0c,0xfb,0xaa,0xdf,0x60,0x01,0x00,0x01,
+0x1c,0xf0,0x00,0x8f,0x60,0x36,0x9b,0xef,0x7c,0xf1,0x00,0x8f,0x60,0xaf,0xff,0xeb,
+0x4c,0x20,0x00,0xe1,0x58,0x52,0x00,0x0c,0xfb,0xbb,0xde,0x60,0x00,0x05,0x20,0x00,
+0x36,0x10,0xe8,0x02,0xf0,0x12,0x00,0xcf,0x50,0x10,0x00,0x00,0x7f,0x80,0x04,0xff,
+0xff,0xfa,0x00,0x00,0xde,0x10,0x1e,0xf9,0x9d,0xf8,0x00,0x07,0xf5,0x5e,0xdf,0x80,
+0x1f,0xd0,0x00,0x4f,0xf9,0xee,0x8f,0x70,0x00,0xf0,0x0d,0x4f,0xff,0xf4,0x0f,0xea,
+0xfd,0xaf,0xa0,0x04,0x5f,0x90,0x0f,0xa0,0xf9,0x1f,0xa0,0x02,0xed,0x24,0x3f,0xb0,
+0xf9,0x1f,0xa0,0x2d,0xff,0xff,0x5f,0x20,0x00,0xf2,0x1f,0x3f,0xda,0x73,0x1f,0xd9,
+0x99,0x99,0x60,0x02,0x00,0x02,0x3f,0xa0,0x00,0x01,0x30,0x16,0x9c,0xff,0x8f,0xb0,
+0x00,0x05,0xf6,0x5f,0xfd,0x95,0x1f,0xfa,0xaa,0xae,0xf2,0x15,0x10,0x00,0x06,0xef,
+0xff,0xfe,0x80,0x00,0x2a,0x30,0x00,0x06,0xa1,0xf0,0x00,0x21,0x09,0xf7,0xf0,0x00,
+0x91,0x8a,0xac,0xfc,0xaa,0xa0,0x06,0xfb,0x31,0xcf,0xf0,0x00,0xf0,0x47,0xf2,0xdf,
+0x20,0xaf,0x91,0x72,0x00,0xaf,0xfd,0xfa,0x06,0xfc,0x03,0xfc,0x00,0x6f,0xff,0xe2,
+0x8f,0xfa,0xab,0xff,0x60,0x01,0xbf,0x50,0xef,0xff,0xfd,0xce,0xe0,0x08,0xfe,0x9a,
+0x68,0xd7,0x3a,0x66,0x60,0x7f,0xff,0xfb,0x06,0xf7,0x4f,0x90,0x00,0x4e,0x95,0x10,
+0x08,0xf6,0x4f,0x90,0x00,0x00,0x04,0x9d,0x0c,0xf2,0x4f,0x94,0x91,0x39,0xef,0xfc,
+0x6f,0xe0,0x4f,0x95,0xf4,0x6f,0xf9,0x38,0xff,0x40,0x3f,0xdc,0xf1,0x26,0x00,0x06,
+0xf6,0x00,0x0c,0xff,0xe3,0x01,0x28,0x10,0x00,0x01,0x00,0x50,0x0b,0x50,0x00,0x04,
+0xf8,0x78,0x02,0xf0,0x13,0xb0,0x08,0x8a,0xfc,0x88,0x20,0x00,0x9f,0x40,0x0f,0xff,
+0xff,0xff,0x40,0x01,0xfc,0x10,0x00,0x05,0xf9,0x00,0x00,0x0a,0xf4,0x9c,0x6a,0xac,
+0xfd,0xaa,0x91,0x5f,0xe7,0xfa,0x8f,0x80,0x04,0xf0,0x14,0x3f,0xef,0xe1,0x04,0xc5,
+0xec,0x0f,0x90,0x00,0x8f,0x40,0x38,0x7b,0xfc,0x17,0x30,0x04,0xfe,0xba,0x5e,0xc0,
+0xfc,0x00,0x00,0x3f,0xff,0xe7,0x8b,0xd9,0xfd,0x99,0x90,0x1d,0x72,0x01,0xc8,0x03,
+0xf5,0x12,0xf0,0x00,0x27,0xdc,0x11,0x4f,0xe5,0x71,0x10,0x3c,0xff,0xd6,0x03,0xef,
+0x6a,0xfa,0x00,0x3f,0xa4,0x01,0x9f,0xf7,0x00,0x8f,0xc1,0x01,0x00,0x00,0xbd,0x40,
+0x00,0x07,0xd1,0x80,0x00,0x13,0x04,0x08,0x00,0x30,0x2f,0xc0,0x0f,0x40,0x01,0xf0,
+0x14,0x00,0x8f,0x80,0x09,0x99,0x99,0xbf,0xa0,0x00,0xef,0x10,0x05,0x77,0x77,0x9f,
+0x90,0x06,0xf7,0x7c,0x1a,0xff,0xff,0xff,0x80,0x2e,0xf8,0xee,0x10,0x00,0x00,0x6f,
+0x80,0x1f,0xff,0xf4,0xe0,0x02,0xf0,0x2b,0xfb,0x04,0x6f,0x90,0x29,0x99,0xfe,0x99,
+0x96,0x01,0xee,0x35,0x0c,0x70,0xfd,0x08,0xc3,0x1d,0xff,0xff,0x09,0xf4,0xff,0xaf,
+0x90,0x0d,0xb8,0x52,0x00,0x7c,0xff,0xf6,0x00,0x00,0x02,0x7b,0x08,0xfd,0xfe,0xfe,
+0x40,0x09,0xef,0xfc,0xbf,0x90,0xfd,0x3f,0xf9,0x0f,0xe9,0x20,0x24,0x49,0xfc,0x01,
+0x92,0x03,0xeb,0x00,0x17,0xe5,0x00,0x01,0xc0,0x29,0x30,0x00,0x12,0x45,0x7a,0x10,
+0x00,0x8f,0x71,0xff,0xff,0x98,0x01,0xf0,0x0c,0xef,0x10,0x7c,0x59,0xa1,0x5d,0x50,
+0x06,0xf9,0x20,0x5f,0x49,0xf0,0xbf,0x20,0x0e,0xf1,0xcb,0x4f,0x88,0xc5,0xfa,0x20,
+0xaf,0xda,0xf9,0xef,0x00,0x01,0xc0,0x8f,0xff,0xd0,0x47,0xfb,0x44,0x44,0x40,0x12,
+0xaf,0x38,0xff,0xa8,0x01,0xf2,0x2a,0x08,0xfb,0x7a,0x7b,0xfa,0x77,0x77,0x70,0x7f,
+0xff,0xfa,0x0a,0xff,0xff,0xfe,0x20,0x4d,0x95,0x20,0x0f,0xfd,0x67,0xfe,0x00,0x00,
+0x05,0xa9,0x7f,0xef,0x89,0xf7,0x00,0x4a,0xff,0xfa,0xfe,0x1c,0xff,0xc0,0x00,0x9f,
+0xd6,0x4e,0xf9,0xaf,0xff,0xfe,0x93,0x33,0x00,0x1d,0x67,0xfa,0x33,0xaf,0xe1,0x00,
+0x89,0x01,0xf1,0x05,0x10,0x00,0x16,0x10,0x00,0x02,0x83,0x00,0x00,0x07,0xf6,0x00,
+0x00,0x6f,0xb0,0x00,0x00,0xde,0x00,0x9f,0x47,0x02,0xf0,0x02,0x62,0x0a,0xf9,0x99,
+0x99,0xfb,0x0b,0xe1,0xea,0xaf,0x65,0x55,0x5f,0xb6,0xfd,0xcf,0x4a,0xf5,0x00,0xb0,
+0x5f,0xef,0xa0,0xaf,0x32,0x22,0x22,0x10,0x0a,0xf1,0x0b,0xad,0x00,0xf4,0x26,0x05,
+0xfb,0x83,0xcf,0xfa,0xfb,0xfc,0xf4,0xff,0xff,0x5e,0xff,0x3f,0x5e,0x7f,0x3f,0xc7,
+0x32,0xff,0xf9,0xfa,0xfb,0xf0,0x10,0x5b,0x8f,0xbf,0xff,0xff,0xff,0x39,0xef,0xdd,
+0xf7,0xf3,0xf5,0xe7,0xf6,0xfb,0x42,0xfc,0x4f,0x3f,0x5e,0xaf,0x11,0x00,0x07,0x54,
+0xf3,0xb3,0xad,0x90,0xf8,0x00,0xc0,0x05,0x00,0x00,0x02,0x70,0x00,0x00,0x00,0x4f,
+0x90,0x00,0x07,0x00,0x02,0x20,0xaf,0x31,0xd0,0x00,0xf0,0x36,0xf5,0x01,0xfc,0x01,
+0xfd,0x88,0x88,0x8c,0xf5,0x09,0xf3,0xc8,0xdd,0x70,0x00,0x05,0xa3,0x5f,0xd9,0xf7,
+0x0e,0xbf,0xff,0xff,0xf2,0x3f,0xef,0xd0,0x5f,0x57,0x8f,0xd7,0x71,0x00,0x8f,0x40,
 0xcf,0x4a,0xdf,0xb6,0x60,0x02,0xfb,0x58,0xff,0x4c,0xff,0xff,0xe0,0x2d,0xff,0xfe,
 0xff,0x4c,0xc0,0x0b,0xe0,0x2f,0xd8,0x42,0x7f,0x4c,0xe7,0x7d,0xe0,0x02,0x01,0x66,
 0x5f,0x18,0x00,0x40,0x17,0xcf,0xfa,0x5f,0x18,0x00,0x31,0x3f,0xe9,0x20,0x10,0x00,
-0x84,0x06,0x00,0x00,0x5f,0x4c,0xe8,0x8c,0xd0,0xa9,0xa8,0x94,0x04,0xfa,0x3c,0xf4,
-0x5f,0xb3,0xaf,0x50,0x04,0xbc,0x22,0x74,0x55,0x55,0x6f,0xe5,0x55,0x55,0x10,0x53,
-0x54,0xa2,0x06,0x66,0x66,0x9f,0xb6,0x66,0x66,0x40,0x00,0x4f,0xee,0x1a,0x00,0xfd,
-0x7d,0x20,0x66,0x6c,0x08,0x00,0x40,0xda,0xaa,0xaa,0xae,0x08,0x00,0x21,0xdb,0xbb,
-0xc9,0x95,0x74,0x4f,0xa4,0x44,0x44,0x4b,0xf4,0x00,0x28,0x00,0x20,0x06,0x9f,0x28,
-0x00,0x35,0xf8,0x61,0x2f,0x8b,0x6e,0x11,0x53,0x2a,0xa8,0x00,0xdd,0x26,0x00,0xe6,
-0xb5,0x94,0x04,0x88,0xef,0xa8,0x8b,0xfd,0x88,0x40,0x07,0x27,0x81,0x31,0x22,0x22,
-0x3f,0x83,0x4f,0x13,0xbf,0x61,0x0e,0x73,0x68,0x88,0x9f,0xf8,0x88,0x87,0x00,0x9d,
-0xd2,0x23,0x93,0x2f,0x8b,0x6a,0x93,0x02,0x22,0x22,0x7f,0xb2,0x22,0x22,0x20,0x0a,
-0x49,0x0c,0x60,0x07,0xaa,0xac,0xff,0xff,0xba,0xae,0x46,0x20,0x4d,0xfa,0x84,0x49,
-0xb0,0x16,0x9d,0xff,0xb0,0x09,0xff,0xd8,0x62,0x1e,0xff,0xb4,0x31,0x80,0x33,0xf1,
-0x04,0x40,0xc5,0xc0,0x42,0x12,0x36,0x82,0x00,0xe9,0x10,0xf0,0x2d,0xd8,0xcf,0xf9,
-0xdf,0xf7,0x06,0xc5,0xf6,0xa6,0x78,0xf9,0x8a,0xf7,0x03,0xf4,0xf8,0xf4,0x00,0xe9,
-0x11,0xf7,0x1f,0xff,0xff,0xfd,0xd6,0xea,0xf6,0xf7,0x06,0x9f,0xff,0x96,0x8b,0xe9,
-0xbb,0xf7,0x01,0xdf,0xff,0xf6,0x4f,0xf9,0x7e,0xf7,0x2e,0xf5,0xf7,0xcb,0x02,0xe9,
-0x12,0xf7,0x0f,0x52,0xb5,0x12,0x05,0xf9,0x0b,0x9a,0x2c,0xf1,0x0d,0xfc,0x4f,0xfa,
-0xcf,0xf7,0x0a,0xd6,0xf8,0xcd,0xea,0xec,0xf6,0xf7,0x0a,0xfe,0xfe,0xfc,0x40,0xe9,
-0x11,0xf7,0x0a,0xc4,0xf6,0xbc,0x00,0xe9,0x01,0x20,0x00,0xd2,0x3a,0xf8,0x7b,0xf6,
-0x0a,0xd7,0x77,0xaa,0x1e,0xc2,0x7e,0xb1,0x0f,0x9f,0xec,0xf6,0x19,0xc0,0x06,0xfa,
-0x49,0xf5,0x6f,0xc4,0x5f,0xc0,0x00,0x7e,0xae,0xf4,0x07,0xfb,0xef,0xc0,0x0b,0xff,
-0xaa,0xf5,0xcf,0xc8,0x5f,0xc0,0x05,0xdd,0xce,0xfd,0xed,0xcc,0xcb,0x20,0x00,0xaf,
-0x65,0x5f,0xe5,0x57,0xfa,0x42,0x16,0x04,0x10,0x00,0x10,0x9e,0x01,0x0b,0xf4,0x03,
-0xe9,0x00,0x04,0x88,0xbf,0xb8,0x8b,0xfc,0x88,0x60,0x04,0x77,0xbf,0xb7,0x7b,0xfb,
-0x77,0x50,0x11,0x0f,0xf5,0x03,0x04,0x7b,0xff,0xb4,0x4c,0xff,0xc7,0x42,0x0c,0xff,
-0xb5,0x00,0x00,0x59,0xff,0xa0,0x01,0x50,0xcd,0x03,0x00,0xa7,0x92,0x03,0x08,0x00,
-0x93,0x9e,0x30,0x00,0x8b,0xbb,0xff,0xbb,0xb8,0xfd,0x74,0x24,0x11,0xe2,0x18,0x00,
-0x40,0x04,0xef,0x30,0x00,0xb9,0x11,0x46,0xbf,0xfe,0xbb,0xb1,0xfe,0x42,0x12,0x19,
-0x47,0x40,0x20,0x18,0xff,0x61,0x14,0x23,0x00,0x3b,0x3b,0x56,0x73,0x2e,0xd7,0xfd,
-0x22,0x22,0x2b,0xf5,0x00,0x31,0x01,0x47,0xbb,0x51,0x33,0x33,0x3b,0xf5,0x00,0x19,
-0x88,0x14,0x9d,0x18,0x00,0x10,0xe4,0x2a,0x15,0x01,0x8c,0x8c,0xc0,0x14,0x4f,0xd4,
-0x30,0x05,0xaf,0xfd,0x30,0x4f,0xff,0xff,0xb9,0xf4,0x36,0x40,0x16,0x6f,0xe6,0x49,
-0xd6,0x1c,0x70,0x08,0x8f,0xe8,0x30,0x01,0xfc,0x24,0xcd,0x37,0x20,0x64,0x8b,0x7b,
-0x0c,0xd2,0x0f,0xd0,0x08,0xff,0xff,0xb7,0x30,0x5a,0xaf,0xfa,0xa4,0x65,0xfc,0x91,
-0x0d,0xf0,0x16,0x01,0xfd,0x69,0xb2,0x00,0xcf,0xf9,0x0a,0xdf,0xff,0xff,0xf4,0x08,
-0xff,0xff,0x8c,0xdb,0xfd,0x41,0x00,0x6f,0xbf,0xdc,0xd0,0x01,0xfc,0x01,0x70,0x5d,
-0x1f,0xc2,0x10,0x01,0xfc,0x03,0xf6,0x01,0x68,0x00,0x41,0xff,0x9c,0xf3,0x00,0xb2,
-0x15,0x21,0xff,0xa0,0x99,0x11,0x02,0xf9,0x4d,0x00,0xd7,0x0b,0x00,0x3a,0x7c,0xf0,
-0x02,0x89,0xf8,0xcf,0x7e,0xe0,0x07,0x9f,0xd7,0x49,0xfb,0xdf,0xae,0xe0,0x06,0x9f,
-0xd8,0x29,0x08,0x00,0x84,0x0b,0xff,0xff,0x39,0xf7,0xcf,0x6e,0xe0,0x28,0x00,0xc2,
-0x2c,0xdf,0xec,0x80,0x11,0x9e,0x11,0x10,0x3d,0xef,0xfd,0xaf,0x7b,0xc6,0xf1,0x18,
-0xf9,0x0f,0xc9,0xdf,0x9a,0xf7,0x04,0xff,0xef,0x7f,0x80,0x9e,0x89,0xf7,0x1e,0xff,
-0xab,0x9f,0xcb,0xef,0xfe,0xf7,0x6f,0x7f,0xa1,0x0f,0xcc,0xa8,0x6c,0xf7,0x08,0x2f,
-0xa0,0x0f,0x80,0x00,0x37,0xf7,0x00,0x08,0x00,0x39,0x4f,0xd2,0x00,0x18,0xe4,0x10,
-0x21,0xff,0x02,0x10,0xe2,0x64,0x8d,0xf1,0x05,0x3d,0xfb,0xcf,0xb0,0x9f,0x73,0xfc,
-0x00,0x09,0xf1,0x4f,0x52,0x5e,0x6b,0xf8,0x40,0x09,0xf9,0xaf,0x5a,0xd3,0x59,0xb1,
-0xff,0xff,0x54,0x77,0xff,0x77,0x70,0x09,0xf1,0x4f,0x50,0xd5,0x7e,0x80,0xf8,0xaf,
-0x57,0x77,0xff,0x77,0x73,0x09,0x3d,0x04,0x00,0xc3,0x52,0xb0,0xf1,0x4f,0x53,0x36,
-0xff,0x43,0x31,0x09,0xf3,0x7f,0xb5,0x27,0x9c,0x10,0x4e,0x7e,0x90,0xa0,0xfe,0xf2,
-0x00,0x3e,0xb8,0x9f,0x51,0xdf,0x75,0xfe,0xaf,0x45,0x21,0x9e,0xfb,0x5b,0x41,0x34,
-0x4f,0x7d,0x90,0x94,0xe5,0x03,0x2b,0x21,0x10,0x2f,0xaf,0x84,0x81,0x55,0x5f,0xf0,
-0x2f,0xc2,0x9f,0x50,0x0b,0x27,0x62,0xf0,0x08,0xfd,0x80,0x01,0x11,0x1f,0xf0,0x2f,
-0xe5,0x10,0x20,0x09,0xac,0xef,0xf0,0x1f,0xe4,0x48,0xf6,0x0b,0xa8,0x5f,0xf0,0x0a,
-0x01,0x02,0x67,0x06,0x69,0x96,0x66,0x67,0x74,0x67,0x4b,0x1b,0xe1,0x77,0x4b,0x12,
-0xe5,0xb7,0x4c,0x05,0x08,0x00,0x11,0xfe,0xa5,0x80,0x00,0xcd,0x16,0x31,0x07,0xac,
-0xf7,0x08,0x00,0x38,0x06,0xfe,0xb1,0x67,0xaf,0x02,0x7d,0x2a,0xf0,0x19,0xdf,0x5b,
-0x60,0x3f,0xa0,0x4b,0x10,0x06,0xfa,0x2f,0xf1,0x3f,0xdc,0xff,0x70,0x3f,0xfb,0xaf,
-0xf9,0x3f,0xfd,0x71,0x00,0x0f,0xfe,0xdb,0xff,0x4f,0xb0,0x02,0x81,0x02,0x00,0x00,
-0x51,0x2f,0xd3,0x38,0xf5,0x0a,0xed,0x13,0x00,0x10,0x8e,0xe0,0xfa,0x9e,0xf1,0x18,
-0xb7,0x77,0x20,0x0a,0xfb,0xae,0xf1,0x2f,0xb0,0x07,0x99,0xaf,0x50,0xf1,0x2f,0xb6,
-0xef,0xa0,0x49,0x38,0x40,0x2f,0xff,0xf9,0x20,0x28,0x00,0xf3,0x0d,0x2f,0xe6,0x10,
+0xa1,0x06,0x00,0x00,0x5f,0x4c,0xe8,0x8c,0xd0,0x04,0xff,0x01,0x00,0x94,0x50,0x04,
+0xfa,0x3c,0xf4,0x5f,0xb3,0xaf,0x50,0x10,0x00,0x92,0x01,0x55,0x55,0x6f,0xe5,0x55,
+0x55,0x10,0x0e,0x10,0x00,0xc1,0xb0,0x06,0x66,0x66,0x9f,0xb6,0x66,0x66,0x40,0x00,
+0x4f,0xff,0x17,0x06,0x60,0x00,0x4f,0xb6,0x66,0x66,0x6c,0x08,0x00,0x40,0xda,0xaa,
+0xaa,0xae,0x08,0x00,0x40,0xdb,0xbb,0xbb,0xbe,0x08,0x00,0x64,0xa4,0x44,0x44,0x4b,
+0xf4,0x00,0x28,0x00,0x20,0x06,0x9f,0x28,0x00,0x32,0xf8,0x61,0x2f,0x48,0x00,0xf2,
+0x0b,0xf3,0x00,0x00,0x53,0x00,0x00,0x56,0x10,0x00,0x00,0x03,0xfe,0x00,0x01,0xff,
+0x30,0x00,0x04,0x88,0xef,0xa8,0x8b,0xfd,0x88,0x40,0x07,0x20,0x00,0xb0,0x70,0x01,
+0x22,0x22,0x3f,0xf2,0x22,0x22,0x10,0x00,0xbf,0x0f,0x00,0xf3,0x03,0xfd,0x00,0x00,
+0x68,0x88,0x9f,0xf8,0x88,0x87,0x00,0x19,0x99,0x99,0x9f,0xf9,0x99,0x99,0x93,0x48,
+0x00,0xa2,0xf5,0x02,0x22,0x22,0x7f,0xb2,0x22,0x22,0x20,0x0a,0x10,0x00,0xf1,0x13,
+0xf0,0x07,0xaa,0xac,0xff,0xff,0xba,0xaa,0xa0,0x00,0x00,0x4d,0xfa,0x9f,0xd3,0x00,
+0x00,0x16,0x9d,0xff,0xb0,0x09,0xff,0xd8,0x62,0x1e,0xff,0xb4,0x00,0x00,0x5c,0xff,
+0xf1,0x04,0xcf,0x05,0x51,0x15,0x40,0x00,0x12,0x36,0xd1,0x06,0xf1,0x50,0x0e,0xff,
+0xff,0xd8,0xcf,0xf9,0xdf,0xf7,0x06,0xc5,0xf6,0xa6,0x78,0xf9,0x8a,0xf7,0x03,0xf4,
+0xf8,0xf4,0x00,0xe9,0x11,0xf7,0x1f,0xff,0xff,0xfd,0xd6,0xea,0xf6,0xf7,0x06,0x9f,
+0xff,0x96,0x8b,0xe9,0xbb,0xf7,0x01,0xdf,0xff,0xf6,0x4f,0xf9,0x7e,0xf7,0x2e,0xf5,
+0xf7,0xcb,0x02,0xe9,0x12,0xf7,0x0f,0x52,0xb5,0x12,0x05,0xf9,0x0b,0xf7,0x0a,0xff,
+0xff,0xfc,0x4f,0xfa,0xcf,0xf7,0x0a,0xd6,0xf8,0xcd,0xea,0xec,0xf6,0xf7,0x0a,0xfe,
+0xfe,0xfc,0x40,0xe9,0x11,0xf7,0x0a,0xc4,0xf6,0xbc,0x00,0xe9,0x01,0x20,0x00,0xf1,
+0x31,0x3a,0xf8,0x7b,0xf6,0x0a,0xd7,0x77,0xaa,0x1e,0xc2,0x7e,0xb1,0x0f,0xff,0xff,
+0xf5,0xff,0xff,0xff,0xc0,0x06,0xfa,0x49,0xf5,0x6f,0xc4,0x5f,0xc0,0x00,0x7e,0xae,
+0xf4,0x07,0xfb,0xef,0xc0,0x0b,0xff,0xaa,0xf5,0xcf,0xc8,0x5f,0xc0,0x05,0xdd,0xce,
+0xfd,0xed,0xcc,0xcb,0x20,0x00,0xaf,0x65,0x5f,0xe5,0x57,0xfa,0x00,0x00,0xaf,0xff,
+0xff,0xf8,0x04,0x04,0x10,0x00,0xf2,0x09,0x9e,0xff,0xfe,0xef,0xff,0xe9,0x00,0x04,
+0x88,0xbf,0xb8,0x8b,0xfc,0x88,0x60,0x04,0x77,0xbf,0xb7,0x7b,0xfb,0x77,0x50,0x1f,
+0x00,0x01,0xf5,0x04,0xf7,0x04,0x7b,0xff,0xb4,0x4c,0xff,0xc7,0x42,0x0c,0xff,0xb5,
+0x00,0x00,0x59,0xff,0xa0,0x01,0x50,0xcd,0x03,0x11,0xfd,0xd0,0x06,0x01,0x08,0x00,
+0xc0,0x9e,0x30,0x00,0x8b,0xbb,0xff,0xbb,0xb8,0xfd,0x10,0x00,0xcf,0x37,0x00,0x11,
+0xe2,0x18,0x00,0xc3,0x04,0xef,0x30,0x00,0x1b,0xbb,0xbb,0xff,0xbf,0xfe,0xbb,0xb1,
+0x60,0x01,0x60,0xf2,0x00,0x00,0x19,0xff,0xa0,0x1e,0x00,0x82,0x18,0xff,0xfe,0x99,
+0x99,0x93,0x00,0x3b,0x77,0x01,0xa1,0x00,0x2e,0xd7,0xfd,0x22,0x22,0x2b,0xf5,0x00,
+0x00,0xaf,0x06,0x00,0x08,0x00,0x41,0xfe,0x33,0x33,0x3b,0x10,0x00,0x34,0x99,0x99,
+0x9d,0x18,0x00,0xf0,0x30,0xe4,0x00,0x00,0x0f,0xc0,0x00,0x00,0x02,0xa9,0x00,0x14,
+0x4f,0xd4,0x30,0x05,0xaf,0xfd,0x30,0x4f,0xff,0xff,0xb9,0xff,0xfe,0x60,0x00,0x16,
+0x6f,0xe6,0x49,0xc9,0xfc,0x00,0x00,0x08,0x8f,0xe8,0x30,0x01,0xfc,0x24,0x30,0x0f,
+0xff,0xff,0x64,0x8b,0xff,0xff,0x90,0x00,0x0f,0xd0,0x08,0xff,0xff,0xb7,0x30,0x5a,
+0xaf,0xfa,0xa4,0x65,0x50,0x06,0x00,0x3c,0x08,0xf0,0x15,0xfd,0x69,0xb2,0x00,0xcf,
+0xf9,0x0a,0xdf,0xff,0xff,0xf4,0x08,0xff,0xff,0x8c,0xdb,0xfd,0x41,0x00,0x6f,0xbf,
+0xdc,0xd0,0x01,0xfc,0x01,0x70,0x5d,0x1f,0xc2,0x10,0x01,0xfc,0x03,0xf6,0x01,0x68,
+0x00,0x31,0xff,0x9c,0xf3,0x70,0x00,0x63,0x8f,0xff,0xa0,0x00,0x2f,0xa0,0xb8,0x07,
+0x20,0xb0,0x09,0x20,0x04,0xf0,0x05,0x1f,0xff,0xff,0x89,0xf8,0xcf,0x7e,0xe0,0x07,
+0x9f,0xd7,0x49,0xfb,0xdf,0xae,0xe0,0x06,0x9f,0xd8,0x29,0x08,0x00,0x84,0x0b,0xff,
+0xff,0x39,0xf7,0xcf,0x6e,0xe0,0x28,0x00,0xc1,0x2c,0xdf,0xec,0x80,0x11,0x9e,0x11,
+0x10,0x3d,0xef,0xfd,0xaf,0x88,0x07,0xf1,0x19,0xbf,0xf9,0x0f,0xc9,0xdf,0x9a,0xf7,
+0x04,0xff,0xef,0x7f,0x80,0x9e,0x89,0xf7,0x1e,0xff,0xab,0x9f,0xcb,0xef,0xfe,0xf7,
+0x6f,0x7f,0xa1,0x0f,0xcc,0xa8,0x6c,0xf7,0x08,0x2f,0xa0,0x0f,0x80,0x00,0x37,0xf7,
+0x00,0x08,0x00,0x28,0x4f,0xd2,0xc3,0x05,0x30,0x11,0x00,0x21,0xff,0x02,0xf0,0x0a,
+0xe2,0xfc,0x00,0xcf,0x40,0x3d,0xfb,0xcf,0xb0,0x9f,0x73,0xfc,0x00,0x09,0xf1,0x4f,
+0x52,0x5e,0x6b,0xf8,0x40,0x09,0xf9,0xaf,0x5a,0xb0,0x02,0xf0,0x0a,0x09,0xff,0xff,
+0x54,0x77,0xff,0x77,0x70,0x09,0xf1,0x4f,0x50,0x00,0xff,0x00,0x00,0x09,0xf8,0xaf,
+0x57,0x77,0xff,0x77,0x73,0x09,0x3d,0x04,0xf6,0x24,0xff,0xff,0xf6,0x09,0xf1,0x4f,
+0x53,0x36,0xff,0x43,0x31,0x09,0xf3,0x7f,0xb5,0x08,0xff,0x80,0x00,0x4e,0xff,0xff,
+0xf7,0x1f,0xfe,0xf2,0x00,0x3e,0xb8,0x9f,0x51,0xdf,0x75,0xfe,0x30,0x00,0x00,0x4f,
+0x9e,0xfb,0x00,0x8f,0xf5,0x00,0x00,0x4f,0x7d,0x90,0x00,0x05,0xb0,0x7e,0x00,0xf0,
+0x1c,0x0f,0xf0,0x2f,0xc0,0x00,0x00,0x04,0x55,0x5f,0xf0,0x2f,0xc2,0x9f,0x50,0x0b,
+0xff,0xff,0xf0,0x2f,0xff,0xfd,0x80,0x01,0x11,0x1f,0xf0,0x2f,0xe5,0x10,0x20,0x09,
+0xac,0xef,0xf0,0x1f,0xe4,0x48,0xf6,0x0b,0xa8,0x5f,0xf0,0x0a,0x01,0x02,0x81,0x06,
+0x69,0x96,0x66,0x67,0x74,0x00,0x00,0x49,0x02,0x97,0xf8,0x00,0x00,0x1f,0xe1,0x11,
+0x11,0x17,0xf8,0x10,0x00,0x48,0xe5,0x55,0x55,0x59,0x08,0x00,0x40,0xfe,0xee,0xee,
+0xef,0x08,0x00,0x51,0xd0,0x00,0x07,0xac,0xf7,0x08,0x00,0x36,0x06,0xfe,0xb1,0x7f,
+0x00,0x50,0x6e,0x50,0x00,0x3f,0xa0,0x20,0x0b,0xf0,0x3f,0x5b,0x60,0x3f,0xa0,0x4b,
+0x10,0x06,0xfa,0x2f,0xf1,0x3f,0xdc,0xff,0x70,0x3f,0xfb,0xaf,0xf9,0x3f,0xfd,0x71,
+0x00,0x0f,0xfe,0xdb,0xff,0x4f,0xb0,0x02,0x81,0x02,0x00,0x00,0x51,0x2f,0xd3,0x38,
+0xf5,0x0a,0xff,0xff,0xf1,0x0e,0xff,0xff,0xf1,0x0a,0xfa,0x9e,0xf1,0x18,0xb7,0x77,
+0x20,0x0a,0xfb,0xae,0xf1,0x2f,0xb0,0x07,0x00,0x0a,0xfe,0xef,0xf1,0x2f,0xb6,0xef,
+0xa0,0x0a,0xf2,0x0c,0xf1,0x2f,0xff,0xf9,0x20,0x28,0x00,0xf1,0x0c,0x2f,0xe6,0x10,
 0x10,0x0a,0xf6,0x5d,0xf1,0x2f,0xb0,0x01,0xf6,0x0a,0xf2,0xbf,0xf1,0x1f,0xfc,0xce,
-0xf6,0x0a,0xf1,0xde,0x80,0x07,0xde,0xee,0xa0,0x29,0x65,0x00,0x65,0x13,0xf1,0x0c,
-0x10,0xbf,0xfc,0x72,0x00,0x0b,0xfb,0xef,0x10,0x16,0xbf,0xf6,0x00,0x0b,0xe0,0x9f,
-0x16,0x99,0x9a,0x70,0x00,0x0b,0xf2,0xaf,0x1b,0xff,0xff,0x20,0x00,0xf0,0x0d,0x14,
-0x66,0xef,0x0a,0xb1,0x0b,0xf9,0xdf,0x57,0x74,0xdf,0x8f,0xe2,0x0c,0xe0,0x9f,0x9f,
-0xfc,0xdf,0xfc,0x10,0x0c,0xfb,0xef,0x14,0xf9,0xdf,0xf1,0x1b,0x0e,0xf9,0x1c,0x19,
-0xf5,0xdf,0xf8,0x00,0x0d,0xc0,0xaf,0x2e,0xf0,0xdf,0xdf,0x30,0x0f,0xa0,0x9f,0xcf,
-0x80,0xdf,0x4f,0xe3,0x2f,0x80,0xaf,0xdd,0x00,0xdf,0x09,0xf5,0x7f,0x4c,0xff,0x21,
-0x8c,0xfe,0x00,0x40,0x4d,0x0b,0xe7,0x00,0x6f,0xe6,0xba,0x07,0x12,0x09,0x1a,0xc4,
-0x80,0xf6,0x09,0xe0,0x1f,0xff,0xf1,0x0e,0xdb,0x08,0x00,0xf2,0x03,0xee,0xf1,0x0e,
-0x81,0xf6,0xff,0xff,0x5f,0x88,0xf1,0x0e,0xa3,0xf6,0xbe,0xfb,0x4f,0x88,0xf1,0x20,
-0x00,0xf0,0x10,0x88,0xf1,0x0e,0x93,0xfa,0xce,0xfc,0x7f,0x88,0xf1,0x0e,0x81,0xfb,
-0xff,0xff,0x9f,0x88,0xf1,0x0f,0xfe,0xf6,0x2f,0x70,0x1f,0x88,0xf1,0x0f,0xff,0xf6,
-0x5f,0x8c,0x08,0x00,0xf6,0x18,0x61,0xf6,0x9d,0x4f,0x3f,0x89,0xf1,0x2f,0x41,0xf6,
-0xdb,0x5f,0x7f,0xef,0xf0,0x4f,0x31,0xfb,0xff,0xff,0xaf,0xa8,0x40,0x7f,0x3a,0xf6,
-0x63,0x05,0x4f,0x80,0x00,0x6b,0x1f,0xc1,0x00,0x00,0x1f,0x80,0x00,0x7c,0xb7,0x11,
-0x4b,0x4b,0x06,0x00,0x05,0xc5,0x10,0x9b,0x1e,0x9c,0x22,0xba,0xdf,0x77,0x9d,0x41,
-0x31,0x11,0x11,0x13,0x8b,0x9d,0x03,0x8a,0x9d,0x01,0x89,0x9d,0x14,0xbc,0x12,0x00,
-0x00,0x2f,0x16,0x04,0x18,0x00,0x01,0xbc,0x86,0x03,0x06,0x00,0x02,0x12,0x00,0x01,
-0x1e,0x00,0x14,0x0c,0xe4,0xc2,0x70,0xbb,0xdf,0xfc,0xbb,0xcc,0xbb,0x80,0x27,0xdc,
-0x22,0x03,0xe9,0x67,0xd6,0x11,0x02,0xf3,0xaf,0x52,0xfa,0x99,0xaa,0xcf,0xfc,0xcf,
-0x91,0xb5,0xfe,0xef,0xa0,0x00,0x34,0x32,0x29,0x80,0x00,0x2b,0x10,0x27,0x6a,0x10,
-0x9c,0xa9,0x4f,0x18,0xc9,0x0f,0xda,0x27,0x0f,0xe0,0x40,0x45,0x04,0xb5,0x6d,0x12,
-0x2c,0x67,0x3f,0x42,0xc3,0x00,0x06,0x60,0x22,0x4b,0x21,0x0e,0xd0,0xd7,0xd6,0xc1,
-0x05,0xaf,0xda,0x70,0x01,0xfd,0x10,0x00,0x09,0xfd,0xdf,0xbf,0xef,0x82,0x30,0xf9,
-0x3e,0xb9,0x87,0x98,0x40,0x09,0xfb,0x9e,0xb0,0xf4,0xe2,0x70,0x09,0xf5,0x6e,0xb0,
-0xdf,0xff,0xfa,0x31,0x05,0xf5,0x2d,0xb0,0xdf,0x45,0xfa,0x00,0x6d,0xf9,0x9f,0xb0,
-0xde,0x01,0xfa,0x00,0x0a,0xfd,0x5e,0xb0,0xee,0x01,0xfa,0x00,0x0b,0xf8,0xce,0xb0,
-0xfc,0x01,0xfa,0x00,0x0c,0xd2,0x5e,0xb1,0xfa,0x01,0xfa,0x63,0x0f,0xb0,0x0e,0xb6,
-0xf7,0x01,0xfb,0xa8,0x6f,0x52,0x9f,0xce,0xf2,0x00,0xfe,0xe7,0x5e,0x00,0xfd,0x6b,
-0x80,0x00,0x8e,0x5e,0x25,0x00,0xd2,0x1a,0x21,0x01,0x52,0x84,0x18,0x01,0xc0,0x55,
-0x61,0x03,0x8f,0xa6,0x40,0x00,0xee,0x83,0xad,0x11,0xad,0x62,0x08,0xf0,0x08,0xf7,
-0x3e,0xad,0xe8,0x88,0x8d,0xf1,0x08,0xfc,0x9e,0xad,0xd7,0x10,0x0b,0xf1,0x08,0xf5,
-0x8e,0xa1,0xaf,0x20,0x02,0x10,0xd4,0xeb,0xf0,0x0a,0x9f,0x22,0xbf,0x30,0x5c,0xf9,
-0x8f,0xa0,0x9f,0xaf,0xf9,0x10,0x09,0xfb,0x4e,0xa0,0x9f,0xfa,0x20,0x00,0x0a,0xf9,
-0xbe,0xa0,0x9f,0x6d,0x3c,0xf8,0x0e,0xd3,0x9e,0xa0,0x9f,0x20,0x04,0xa1,0x0f,0xa0,
-0x0e,0xa0,0x9f,0x20,0x06,0xf3,0x5f,0x51,0x8f,0x90,0x8f,0xca,0xae,0xf1,0x6d,0x00,
-0xfd,0x40,0x2d,0xff,0x58,0x46,0x14,0x04,0x22,0x51,0x21,0xb1,0x11,0x62,0x1b,0x03,
-0x85,0x83,0x51,0x5f,0xfa,0x99,0xbf,0xf2,0x23,0xb6,0x33,0x02,0xef,0x40,0x3f,0x47,
-0x00,0xa1,0x43,0x60,0xef,0xbb,0xbf,0xfb,0xbc,0xfb,0xbe,0x2d,0x21,0x0e,0xe0,0x2c,
-0x3e,0x56,0xba,0xaf,0xfa,0xab,0xfb,0x70,0x01,0x51,0xbf,0x32,0x22,0x22,0x23,0x20,
-0x00,0x00,0x98,0x1e,0x11,0x81,0xc3,0x7f,0x00,0xe7,0x2d,0x70,0x8f,0xec,0xbb,0xbb,
-0xbb,0xdf,0xd0,0xe4,0xad,0x02,0xb2,0x8d,0x20,0xbf,0x30,0x20,0x46,0x75,0x16,0x66,
-0xdf,0x86,0x68,0xfe,0x66,0xb2,0x07,0x00,0x10,0x00,0x20,0x67,0xfe,0x40,0xda,0x47,
-0xbe,0x30,0x02,0xec,0x3d,0xd0,0x01,0xcb,0x1c,0x16,0xdc,0x69,0x22,0x00,0x7a,0x9e,
-0x1f,0x01,0x08,0x00,0x03,0x31,0x09,0xcc,0xfd,0x08,0x00,0x00,0x73,0x43,0x00,0x08,
-0x00,0x32,0x01,0x32,0x00,0x20,0x00,0x02,0x7f,0x88,0x01,0xb3,0x14,0x30,0x0c,0xcc,
-0xff,0x9b,0x18,0x40,0xc0,0x0e,0xee,0xff,0x79,0xc2,0x00,0x07,0x25,0x31,0x06,0x61,
-0xfd,0x11,0x71,0x20,0x0f,0xe0,0x0b,0x12,0x10,0x69,0x02,0x08,0x13,0x96,0x1a,0x07,
-0x10,0xfb,0x21,0x37,0x40,0x1f,0xf0,0x04,0xfb,0x0f,0x45,0xc4,0x1f,0xe0,0x03,0xfb,
-0x00,0x2b,0xef,0xcb,0xcf,0xfb,0xbc,0xfe,0x8f,0xaa,0x01,0xe1,0x3b,0x01,0x33,0x71,
-0x90,0x01,0x7f,0xf9,0x5f,0xf7,0x10,0x00,0x27,0xbf,0x47,0x13,0x21,0xfb,0x83,0x36,
-0x2f,0x54,0x18,0xef,0xe1,0x02,0x20,0x47,0xa5,0x11,0xef,0xa4,0x52,0x30,0x2d,0xdd,
-0xff,0xae,0x2b,0x22,0xd2,0x2e,0x80,0x00,0x14,0xe2,0x18,0x00,0x31,0x00,0x65,0x22,
-0x96,0xe6,0x50,0x01,0xff,0x90,0x6c,0xcc,0x69,0xbf,0x31,0x2d,0xf6,0x8f,0x6a,0x8c,
-0xa1,0x20,0x60,0x8f,0x70,0x00,0xcf,0x20,0x0e,0xfa,0x10,0x08,0x00,0xf0,0x00,0x02,
-0xbf,0x50,0x8f,0x71,0xbb,0xff,0x10,0x00,0x03,0xa9,0x8f,0x70,0xcf,0xe8,0x7a,0xaf,
-0x20,0x8f,0x70,0xc9,0x7f,0xf9,0x05,0xaf,0xd1,0x8f,0x80,0x00,0x07,0xf7,0x0a,0xfe,
-0x10,0x5f,0xfc,0xcc,0xdf,0xf3,0x04,0xe2,0x00,0x0a,0xef,0x59,0xe2,0x46,0xbf,0x20,
-0x02,0xfb,0xef,0x40,0x02,0x08,0x01,0x00,0x9f,0x2f,0x50,0xbe,0x20,0x02,0xeb,0x00,
-0xe4,0x17,0x03,0xfa,0x0f,0x22,0xf8,0xff,0xcd,0x6c,0x10,0xb3,0x8d,0xbf,0x10,0xb2,
-0xa0,0xec,0x00,0xef,0x6b,0xf0,0x07,0x3f,0xff,0x64,0xff,0xff,0xf0,0xee,0x00,0x2f,
-0xff,0x64,0xfb,0x7d,0xf0,0xee,0x00,0x04,0x7f,0x64,0xf7,0x0b,0xf0,0x67,0xfb,0x01,
-0x18,0x00,0x00,0x08,0x00,0x20,0xfb,0x88,0x9e,0x5a,0x61,0x6f,0x62,0x83,0x05,0xdd,
-0xfd,0xed,0x66,0x31,0x01,0xee,0xb4,0xd8,0xc2,0x26,0x04,0xfa,0x78,0x00,0x60,0x09,
-0x99,0xdf,0xb9,0x9b,0xfd,0xff,0xdb,0xa0,0x58,0x20,0x04,0xbd,0xc3,0x00,0x04,0x89,
-0x9a,0xbd,0xfb,0x13,0x00,0xe0,0x01,0xb0,0xec,0xa9,0x94,0x00,0x00,0x8a,0x10,0x4d,
-0x60,0x01,0xef,0x2b,0x38,0x40,0x0f,0xc0,0x09,0xf7,0xc9,0xfc,0x63,0x0f,0xd0,0x07,
-0x90,0x00,0x09,0x37,0xdc,0x15,0x1f,0xdc,0xc5,0x40,0x9f,0xff,0xff,0xe7,0x51,0x11,
-0xe3,0xfd,0x3f,0xf3,0xdf,0xd8,0x30,0x3f,0xfe,0x70,0x0f,0xf0,0x08,0xef,0xf2,0x09,
-0xe3,0x11,0x40,0x00,0xd6,0x06,0xf0,0x00,0xf1,0x00,0xf1,0x09,0x99,0xef,0xa9,0x9a,
-0xfe,0x99,0x91,0x00,0x2d,0xd8,0x00,0x01,0x85,0x1b,0x18,0x00,0x8a,0x24,0x14,0x40,
-0x29,0x8c,0x31,0x1e,0xf5,0xd8,0x02,0x6d,0x30,0x3f,0x78,0xff,0x39,0x17,0xf2,0x01,
-0x80,0x02,0x2f,0xa5,0xfd,0x55,0x50,0x6f,0x70,0x01,0x79,0x87,0xfd,0x77,0x76,0x7f,
-0x61,0x52,0xf1,0x04,0xfd,0x7f,0x60,0x00,0x3c,0x40,0xec,0x07,0xc1,0x9f,0x40,0x00,
-0x4f,0x95,0xfd,0x5c,0xf1,0xbf,0x30,0x82,0x0a,0x23,0xf8,0xff,0x9e,0x13,0x07,0xab,
-0x05,0x00,0x80,0xd9,0x1b,0xfa,0x80,0x00,0x90,0xfd,0x99,0x90,0x00,0x61,0x79,0x14,
-0xa7,0x96,0x36,0x02,0x50,0x50,0x1e,0xf8,0x33,0x32,0x77,0x83,0x02,0xbf,0x45,0xf0,
-0x05,0x03,0x6b,0xff,0xe5,0x3c,0xfb,0x00,0x0c,0x80,0x4f,0xc7,0xff,0xef,0xa0,0x00,
-0x2d,0xfe,0x13,0x27,0xef,0xd7,0xd2,0x50,0x8a,0x4d,0xff,0xe8,0x4a,0xf7,0xb0,0x92,
-0x3e,0xfd,0x87,0x77,0x9e,0xa0,0x00,0x1e,0xd1,0xfa,0xa9,0x31,0xdf,0x80,0xfc,0xe4,
-0xdf,0x20,0xf9,0x00,0x10,0x00,0x00,0x26,0xe6,0x48,0xfe,0x77,0x77,0xfe,0x5c,0x42,
-0x0f,0x00,0x01,0x03,0x50,0x1d,0xe8,0x00,0x01,0x86,0xf7,0x03,0x01,0x87,0xe0,0x32,
-0x60,0x01,0xef,0x78,0x05,0xc0,0x0c,0xf8,0x00,0x9b,0x4f,0x40,0x2f,0xb0,0x5f,0xef,
-0xff,0xff,0x5d,0x11,0x60,0x06,0x37,0x77,0xdf,0x77,0x74,0x2d,0x61,0xf1,0x07,0xa8,
-0xef,0x89,0xf8,0x3f,0x90,0x00,0x7f,0xdd,0xff,0xdd,0xf8,0x4f,0x80,0x00,0x7f,0x75,
-0xdf,0x56,0xf8,0x5f,0x70,0x3b,0x19,0xf8,0x03,0xf8,0x7f,0x50,0x00,0x7f,0x20,0xbe,
-0x05,0xfa,0xcf,0x30,0x00,0x7f,0x20,0x9b,0x0b,0xbf,0xf9,0x80,0x00,0x01,0x82,0x91,
-0x04,0xb0,0x01,0x60,0x07,0x77,0xef,0x97,0x78,0xfe,0xdc,0x1a,0x40,0x4a,0x50,0x09,
-0x94,0x6c,0x2a,0xb0,0x2f,0xb0,0x5f,0xc4,0x44,0x20,0x00,0xfb,0x2f,0xb0,0xaf,0x7e,
-0x34,0xc0,0xfb,0x2f,0xb2,0xfe,0x6d,0x75,0x30,0x00,0xfb,0x2f,0xbc,0xf7,0x5e,0x79,
-0x40,0xfb,0x2f,0xb3,0xa0,0x3d,0xa2,0x63,0x21,0x17,0x50,0x00,0x03,0x80,0x59,0x26,
-0x00,0xb0,0xc6,0x40,0x8a,0xf9,0x9f,0xa8,0x08,0x00,0xe6,0x25,0xf4,0x3f,0x61,0xfc,
-0x00,0x29,0xdf,0xbb,0xfb,0xbf,0xca,0xfe,0x93,0x21,0x27,0x17,0x9f,0x07,0x89,0x00,
-0xb4,0x23,0x60,0xcf,0xa8,0x8a,0xfc,0x8e,0x81,0xb8,0x07,0xe2,0x01,0xcf,0x3f,0xb0,
-0x0a,0x55,0x99,0x99,0x99,0xef,0x9e,0xd2,0x0e,0x78,0x30,0x00,0xf0,0x2c,0x0e,0x9a,
-0xf3,0x55,0x55,0x9f,0x04,0x20,0x0e,0xff,0xf7,0xfe,0xfe,0x9f,0x1f,0xb0,0x02,0x2a,
-0xf7,0xe6,0xf4,0x7f,0x6f,0x70,0x49,0x9d,0xf7,0xfd,0xdf,0x8f,0xcf,0x20,0x6f,0xff,
-0xe7,0xe4,0x5f,0x5f,0xfb,0x00,0x0c,0x9a,0xd7,0xfd,0xfd,0x2f,0xf3,0x00,0x0e,0x6c,
-0xb7,0xe6,0xf4,0x4f,0xf1,0xb2,0x6f,0x3f,0x66,0x29,0x01,0x7a,0xf4,0x13,0x3d,0x20,
-0x00,0x08,0xd4,0x4d,0x6a,0x13,0x01,0x19,0xff,0x22,0x2f,0x90,0x08,0x00,0x30,0x9f,
-0xd9,0xa6,0x08,0x00,0x10,0x03,0x6a,0x0c,0x52,0x09,0xaf,0xc9,0x6e,0xfe,0xc0,0x4a,
-0xc0,0xdf,0x9f,0xdf,0xb0,0x00,0x0f,0x4f,0x3e,0x62,0x5e,0xff,0xa4,0x08,0x00,0xc0,
-0xdf,0xfe,0xad,0xff,0xf4,0x0f,0x4f,0x4e,0xce,0x73,0xf9,0x3a,0x88,0x4b,0xf0,0x12,
-0x6b,0xee,0xff,0xee,0x50,0x0f,0xbf,0xb8,0x35,0x68,0xfc,0x66,0x20,0x02,0x2f,0x79,
-0x37,0xdd,0xfe,0xdd,0x10,0x00,0x2f,0x6e,0x73,0x67,0xfc,0x66,0x00,0x26,0xaf,0xff,
-0xdf,0xe2,0x09,0xc1,0x5f,0xfd,0xab,0xf6,0x68,0xfc,0x66,0x60,0x03,0x00,0x01,0x20,
-0xb5,0x68,0x14,0x3f,0x52,0x12,0x20,0x40,0x3f,0xef,0x3e,0x00,0x08,0x00,0xf0,0x08,
-0x95,0xfb,0x5f,0xb0,0x0c,0xdf,0xdc,0x5f,0xfe,0xff,0xef,0xb0,0x0f,0xcf,0xcf,0x5f,
-0x94,0xfa,0x4f,0xb0,0x0f,0x5f,0x4f,0xba,0x10,0x00,0x08,0x00,0xc0,0x35,0xaf,0xc6,
-0xa5,0x40,0x0f,0x6f,0x6f,0x28,0xfd,0x4b,0xf5,0x98,0x00,0xf2,0x02,0x2e,0xff,0xfd,
-0x44,0x00,0x0f,0xbf,0x97,0x05,0xcf,0xb4,0x9f,0x60,0x00,0x3f,0xae,0x5f,0x0f,0xe5,
-0xf1,0x05,0xbf,0x5a,0xb5,0xfd,0x36,0x81,0x5f,0xff,0xff,0x9c,0xf2,0xec,0x9f,0x40,
-0x4e,0xa6,0x36,0xef,0xa8,0xfc,0x03,0x35,0x83,0x37,0x3f,0xe6,0x03,0x50,0x00,0x05,
-0xb4,0x78,0x00,0x21,0xf4,0x0f,0x1d,0x62,0x30,0xef,0x80,0x0c,0x5b,0x31,0x24,0x3f,
-0xfa,0x83,0x9e,0x12,0xdc,0x98,0x4b,0x01,0x93,0x2e,0x01,0x65,0x35,0x12,0xbf,0x44,
-0xcf,0x91,0xd0,0x8b,0xbb,0xbf,0xfb,0xb1,0x5f,0xff,0xd0,0x80,0x2b,0x32,0x2e,0x9f,
-0xd0,0x88,0x2b,0x1f,0x1f,0x08,0x00,0x07,0x13,0x7f,0x67,0xda,0x27,0x3e,0xeb,0x34,
-0x68,0x11,0x4c,0x21,0x4f,0x01,0xa1,0xfd,0x11,0x0f,0x6e,0xd6,0x01,0x8f,0x2c,0x00,
-0xd2,0x1a,0x10,0xd2,0x08,0x00,0x53,0x4b,0xbb,0xcf,0xf1,0x0f,0xee,0x42,0x30,0x0f,
-0xfb,0x40,0x27,0x3b,0x21,0x3a,0x1f,0xb0,0x53,0xf0,0x0c,0xf9,0xdf,0x4f,0xf6,0xff,
-0x90,0x06,0xff,0xff,0xf5,0x0f,0xf0,0x4f,0xf2,0x9f,0xff,0xfa,0xfa,0x0f,0xf0,0x04,
-0x20,0x3e,0x3d,0xf1,0xad,0x1f,0x52,0xc7,0x52,0x0d,0xf1,0x02,0x0f,0xf0,0x7d,0x8a,
-0x0e,0x08,0x00,0x07,0xa0,0x4d,0x03,0xe3,0x1d,0x14,0x05,0x07,0x8b,0x20,0x11,0x11,
-0xe4,0x0a,0x02,0xb8,0x02,0x00,0x62,0x0e,0x90,0x47,0x77,0x7f,0xf7,0x77,0x76,0x00,
-0x08,0x88,0xc3,0xd0,0x26,0x88,0x80,0x21,0x90,0x60,0x5e,0xf8,0xfe,0x10,0x27,0x00,
-0x99,0x20,0x50,0x9f,0x73,0xef,0x70,0x3c,0x4a,0xdc,0x60,0xff,0xf6,0x00,0x1e,0xc8,
-0xfc,0xa8,0x60,0x00,0xe7,0x8a,0x50,0x7b,0xf6,0x9f,0xf9,0x20,0x53,0x0a,0xc7,0xc4,
-0x06,0xff,0xf4,0x00,0x08,0xfb,0x61,0x00,0x00,0x29,0xa0,0xe5,0x9e,0x40,0x28,0x60,
-0x00,0x00,0x26,0xe1,0x44,0x7f,0xf5,0x44,0x44,0x60,0x52,0x22,0xd0,0x03,0x23,0xb8,
-0x12,0x20,0x5c,0x92,0x01,0x21,0x7c,0x70,0x55,0x55,0x6f,0xe0,0x00,0x0f,0xff,0x5a,
-0x0b,0xa5,0xff,0xf1,0x06,0x6e,0xf4,0x44,0x44,0x5f,0xf6,0x60,0x20,0x00,0x60,0x06,
-0x8f,0xfc,0xef,0x97,0x88,0xd0,0x26,0x70,0xa0,0x6f,0xb3,0xef,0x60,0x3b,0xff,0x64,
-0x2d,0x91,0xd3,0x00,0x0d,0xc6,0xcf,0x46,0x95,0xdf,0xe6,0x3d,0x3c,0x20,0xf6,0x1a,
-0x5a,0x0f,0x66,0xdb,0x74,0x00,0x00,0x39,0x90,0x32,0x16,0x22,0x80,0x00,0x94,0x50,
-0x00,0x21,0xa5,0x10,0xfb,0x63,0x10,0xa1,0xf5,0x04,0x66,0x7f,0xd6,0x65,0x10,0x7b,
-0xce,0xc3,0x4a,0x84,0xf0,0x01,0x0a,0xff,0xff,0x5a,0xf7,0x7f,0xd6,0xee,0x00,0x00,
-0x0b,0xd0,0xaf,0x11,0xfb,0x1f,0xd7,0xcb,0x90,0x9b,0xfa,0xaf,0xe9,0xa6,0x00,0x04,
-0xff,0xcd,0x20,0x0e,0x00,0x7c,0x01,0x30,0x4c,0xff,0xe1,0x9b,0xdf,0xe0,0xef,0xdd,
-0xed,0x7f,0x82,0xfe,0x00,0x05,0x4a,0xf4,0x8f,0xa0,0xdf,0xcf,0xa7,0xf7,0x50,0x14,
-0xf7,0x03,0xff,0xb0,0xd5,0xa9,0x30,0xbf,0x23,0xcf,0x06,0x34,0xe0,0xaf,0x5f,0xcc,
-0xff,0x85,0xef,0xf4,0x00,0x0a,0xf1,0x82,0x89,0x10,0x01,0x96,0x2b,0x11,0xec,0x3a,
-0x14,0x22,0x07,0xb1,0x08,0x00,0xb1,0x0a,0xfc,0xec,0x7b,0xbc,0xfe,0xbb,0xb3,0x00,
-0x85,0xec,0x15,0x6d,0x00,0xcb,0x32,0x01,0xc6,0x30,0x10,0xbf,0xef,0x87,0x00,0x48,
-0xf9,0x30,0xfc,0x3f,0xff,0x83,0xb4,0x51,0x10,0x98,0x3e,0xd9,0x99,0x15,0xce,0x26,
-0x1f,0xe1,0x07,0x48,0xf0,0x1d,0xf6,0x07,0x77,0x8e,0xfc,0xff,0x77,0x9e,0x73,0x00,
-0x49,0xff,0x80,0x7f,0x97,0xff,0x50,0x1f,0xff,0xfd,0x00,0x0c,0xff,0xb1,0x00,0x04,
-0x42,0xfe,0xad,0xf3,0xaf,0xfa,0x51,0x00,0x0b,0xff,0xeb,0x70,0x04,0xcf,0xf4,0x00,
-0x04,0x52,0xea,0x03,0x05,0x2f,0x8d,0x60,0x2d,0xdd,0xde,0xfd,0xdf,0xed,0x97,0x48,
-0x22,0x09,0xf1,0xff,0x36,0x30,0x09,0xf2,0x4f,0x5f,0x4f,0x04,0x6f,0xe5,0xf1,0x0d,
-0xfd,0xbe,0xfb,0xcf,0xdb,0xcf,0x90,0x05,0xf7,0x0d,0xf0,0x3f,0x90,0x5f,0x90,0x05,
-0xf7,0x4f,0xb0,0x3f,0xa0,0x6f,0x90,0x05,0xfc,0xff,0x30,0x1f,0x20,0x00,0x82,0xe4,
-0x00,0x06,0xbb,0xdf,0x90,0x05,0xf7,0x0a,0x73,0x20,0x05,0xf8,0x7c,0x1e,0x26,0x6f,
-0x90,0x40,0x00,0x00,0x40,0x2b,0x34,0xcf,0x80,0x0d,0xd8,0x04,0xf3,0x01,0xaa,0xad,
-0xfb,0xaf,0xea,0xaa,0xa1,0x00,0x77,0x7c,0xf8,0x7f,0xe7,0x77,0x40,0x01,0x28,0x00,
-0xf5,0x02,0x01,0xfb,0x0a,0xf3,0x1f,0xc0,0x5f,0x90,0x01,0xfd,0x7c,0xf8,0x7f,0xd7,
-0x9f,0x90,0x01,0xad,0x5c,0x27,0x15,0xfd,0xdc,0xa7,0xd1,0xf6,0x09,0x99,0xef,0xc9,
-0x99,0xff,0xb9,0x94,0x00,0x05,0xff,0x83,0x91,0x6f,0x22,0x07,0xbe,0xd7,0x55,0x20,
-0x46,0x8b,0x93,0x1d,0xb1,0x40,0x08,0xff,0xff,0xb6,0x10,0x5a,0xff,0x60,0x01,0x53,
-0x86,0xaa,0x05,0xac,0x25,0x75,0x05,0x77,0x7d,0xf7,0x8f,0xc7,0x77,0x3b,0xbc,0xf1,
-0x04,0x03,0xfb,0x7d,0xf7,0x9f,0xc7,0xbf,0x60,0x01,0x7e,0xa7,0x9f,0xb7,0x77,0x77,
-0x30,0x00,0x9f,0x90,0x6d,0x67,0x40,0x2c,0xfb,0x08,0xfd,0x4e,0x3e,0x60,0x1d,0x7b,
-0xfe,0xff,0xa9,0x99,0x15,0xa7,0xc0,0x91,0x7f,0xdc,0xcc,0xef,0x00,0x09,0xff,0x20,
-0x5f,0xba,0xaa,0xcf,0xe0,0xc0,0x20,0x19,0xff,0x88,0x86,0x00,0x04,0x8f,0x26,0xdf,
-0xfd,0xdf,0xa8,0x51,0xee,0x35,0x9a,0xfe,0xef,0xc6,0x61,0x00,0x8f,0x3e,0xec,0x95,
-0x47,0xac,0xc0,0x58,0x54,0x00,0xba,0x0f,0x01,0x76,0xc4,0x40,0x08,0xfb,0x99,0xaf,
-0x61,0x93,0xc1,0xb8,0xf4,0x23,0x0f,0xd0,0x0b,0xbf,0xfb,0x88,0xf4,0xbf,0x0f,0x18,
-0x00,0x00,0x08,0x00,0x70,0x39,0x9f,0xe9,0x98,0xf4,0xcf,0x0f,0x14,0x25,0xa0,0xe8,
-0xf4,0xde,0x0f,0xd0,0x12,0x5f,0xd3,0x28,0xf4,0xd0,0xb0,0xc0,0x6f,0xf9,0x03,0x76,
-0xff,0x57,0x60,0x00,0x9f,0xdf,0x60,0x0a,0x58,0x03,0xf5,0x10,0xee,0x1e,0xf1,0x5f,
-0xff,0x50,0xa3,0x06,0xf9,0x05,0x53,0xef,0x7f,0x50,0xf7,0x3f,0xe1,0x00,0x7f,0xf4,
-0x4f,0xb8,0xf5,0x1c,0x50,0x00,0xbd,0x30,0x0c,0xff,0xc0,0x32,0x15,0x02,0x48,0xc6,
-0x00,0xa7,0x13,0x11,0x0d,0xb0,0x03,0x60,0x0c,0xd1,0x0d,0xf9,0x99,0x9e,0xeb,0x34,
-0xf1,0x02,0x7d,0xf0,0x8a,0x0c,0xf0,0x0a,0xbb,0xef,0x3d,0xf0,0xcf,0x1c,0xf0,0x00,
-0x01,0xeb,0x0d,0x08,0x00,0xe0,0x0b,0xf4,0x0d,0xf0,0xdf,0x0c,0xf0,0x00,0x9f,0xf7,
-0x0d,0xf0,0xef,0x0c,0x85,0xc0,0xf1,0x05,0x5d,0xf1,0xfc,0x0c,0xf0,0x1f,0xff,0xbe,
-0x96,0x76,0xfe,0x85,0x70,0x09,0x5f,0xa3,0x00,0x1e,0xff,0xa0,0xdb,0x21,0xf0,0x04,
-0xaf,0xcf,0xa0,0x95,0x00,0x2f,0xa0,0x09,0xfe,0x2f,0xa0,0xda,0x00,0x2f,0xa1,0xdf,
-0xe3,0x0f,0xe9,0xea,0x0f,0x6b,0x8a,0x10,0x07,0xcc,0xa1,0x00,0xd9,0x3d,0x00,0x6f,
-0xda,0x11,0xe0,0x98,0x2e,0x81,0x05,0xfe,0x88,0x88,0x22,0xfa,0x0c,0xf0,0x55,0xf9,
-0xf5,0x03,0xa0,0xcf,0x2f,0xe2,0x6a,0x22,0x02,0xfa,0x0c,0xf9,0xf6,0x09,0xf7,0x00,
-0x1a,0x70,0xad,0x28,0xee,0x2b,0x13,0x20,0x29,0x79,0x11,0xd0,0xba,0x79,0x20,0xab,
-0xfd,0x2e,0x08,0x40,0xee,0x00,0x2f,0xd0,0x48,0x77,0x20,0xe1,0x02,0x0f,0x00,0xf1,
-0x08,0x06,0xff,0xf2,0x2e,0xc0,0x00,0x01,0x39,0xff,0xdf,0x30,0x00,0x91,0x48,0xcf,
-0xfc,0x3a,0xfb,0x88,0xbf,0x43,0xfe,0xa4,0x4a,0xc7,0x06,0x86,0x1b,0x25,0x4e,0xb1,
-0x96,0xb8,0x10,0xf6,0x0f,0xb1,0x80,0x88,0x8a,0xff,0x60,0x00,0x07,0xff,0x40,0x43,
-0xfb,0x13,0x08,0xb6,0x0d,0xc0,0xaf,0xff,0xcc,0xcf,0xfc,0xcd,0xfb,0x00,0x4f,0xf0,
-0x02,0xfc,0x0d,0x5f,0x63,0xff,0xaa,0xbf,0xea,0xac,0xfb,0x35,0x02,0x10,0xb0,0xd6,
-0xeb,0x10,0xc0,0xe1,0x86,0x73,0xfb,0xbc,0xff,0xbb,0xcf,0xb0,0x06,0x53,0x0c,0x21,
-0xdf,0x50,0x2d,0x00,0xd6,0x8f,0xd0,0x00,0x2f,0xc6,0xce,0xfa,0x04,0xe3,0x00,0x02,
-0xfc,0x2f,0xea,0x8e,0x23,0x6a,0x20,0x47,0x08,0x22,0x21,0x00,0x5c,0x25,0xf0,0x07,
-0xff,0xd0,0x8b,0xfb,0x8e,0xf0,0x08,0xf9,0x7f,0x90,0x09,0xf2,0x0c,0xe0,0x3f,0xf7,
-0xaf,0x94,0x2e,0xd0,0x0e,0xd0,0xc2,0x1d,0xf0,0x0a,0xee,0x27,0xff,0x90,0x08,0xf2,
-0xf2,0xea,0x99,0x2a,0xf6,0x00,0x07,0xfe,0xfe,0xfa,0x6f,0x4d,0xf0,0x00,0x07,0xfb,
-0xfb,0xfa,0xaf,0x5c,0x28,0xf0,0x05,0xf1,0xf2,0xec,0xfd,0x9e,0xf9,0x90,0x09,0xfb,
-0xfc,0xfb,0x92,0x0d,0xf0,0x00,0x0a,0xfb,0xfb,0xfa,0xdf,0x24,0x26,0xb0,0xb0,0xf2,
-0xea,0x9a,0xaf,0xfa,0xa4,0x2f,0x70,0xfa,0xf9,0x25,0x32,0x45,0x5e,0x10,0x6a,0xe4,
-0x44,0x57,0x08,0x01,0x00,0x22,0x7d,0x40,0x7c,0xa1,0x20,0xcf,0x41,0x08,0x00,0x00,
-0x17,0x32,0x01,0xac,0xa1,0xd1,0x08,0xfa,0x8f,0x90,0x99,0xef,0xb9,0x80,0x2f,0xf8,
-0xaf,0x93,0xef,0xa4,0xaa,0xa0,0xff,0xf8,0xe8,0x7f,0x1a,0xe0,0x08,0xf2,0xf3,0xe8,
-0x08,0x00,0x41,0x07,0xf8,0xf9,0xf8,0x08,0x00,0x61,0xfe,0xff,0xf8,0xec,0xcf,0x8d,
-0x18,0x00,0x51,0xbc,0xef,0xdc,0xb0,0x09,0x48,0xf2,0xf0,0x07,0x69,0x50,0x09,0xf8,
-0xf9,0xf8,0x00,0xaf,0x5e,0xc0,0x0c,0xc1,0xf3,0xea,0x46,0xcf,0xce,0xf2,0x0f,0x91,
-0xf8,0xfd,0x62,0x01,0x92,0x4f,0x41,0xfc,0xf7,0xa9,0x75,0x32,0xf8,0x04,0x80,0x02,
-0x10,0x20,0xac,0x16,0x03,0x75,0x61,0x00,0xc4,0xfc,0x00,0x40,0x06,0x57,0x8d,0xfd,
-0x88,0x88,0x83,0x37,0x91,0x05,0x40,0x8c,0x01,0xff,0x08,0x13,0x07,0x05,0x83,0x10,
-0x06,0x4b,0x24,0x16,0x72,0x18,0x00,0x05,0x6d,0x4d,0x00,0x48,0x04,0x17,0xa4,0x35,
-0x2e,0x12,0xd0,0x59,0x67,0x23,0x0f,0xe9,0x75,0x2e,0x0b,0xe8,0x96,0xf0,0x05,0x7f,
-0x19,0xf0,0x02,0xe6,0x00,0x00,0x1c,0xef,0xde,0xfc,0x79,0xfb,0x88,0x83,0x00,0xe9,
-0x01,0x20,0x3f,0xbf,0x8d,0x00,0xed,0x65,0xf4,0x15,0xf3,0x8f,0x20,0x4f,0xe9,0x95,
-0xbe,0x75,0xdf,0xf9,0x00,0x09,0xf5,0xc8,0xdc,0x04,0xbf,0xfb,0x50,0x02,0xfd,0xde,
-0xf8,0x6f,0xe7,0x8e,0xf8,0x03,0x63,0x27,0x8d,0xd7,0x32,0x23,0x81,0x0f,0xd5,0x7f,
-0x13,0x08,0xf9,0x2f,0x04,0x08,0x00,0x10,0x0e,0x02,0x32,0x30,0xe7,0x00,0x00,0xce,
-0xc5,0x00,0x33,0x60,0x50,0x3f,0xb4,0x44,0x44,0x45,0x2f,0x38,0x03,0x78,0x0d,0x13,
-0x48,0x31,0xee,0x22,0xdf,0xa0,0x08,0x00,0x22,0x1d,0xf8,0x08,0x00,0x24,0x01,0xc1,
-0x49,0xee,0x01,0x08,0x00,0x30,0x4d,0xdd,0xc1,0x4c,0x27,0x43,0xb7,0x5f,0xff,0xe1,
-0x35,0x89,0x60,0xe0,0x33,0x35,0xff,0x33,0x32,0x96,0x07,0x01,0x28,0x00,0x05,0x08,
-0x00,0x32,0xe2,0x80,0x01,0xa7,0xe6,0x00,0xbd,0xb0,0x00,0x13,0x1b,0x11,0x50,0x08,
-0x00,0x22,0xaf,0xb1,0x20,0x00,0x13,0x28,0x70,0x00,0x13,0x38,0x98,0xd0,0x22,0xdf,
-0xa0,0xae,0xe4,0x22,0x2e,0xf8,0x9a,0x1a,0x25,0x02,0xd1,0x06,0x37,0x00,0xd0,0x0c,
-0x51,0x4c,0xcc,0xb0,0x00,0x06,0x32,0x23,0x42,0xe0,0x00,0x07,0xfd,0x68,0x00,0x20,
-0x09,0xff,0x31,0xc8,0x00,0xa4,0x4c,0x11,0x50,0x08,0x00,0x11,0x2f,0xa2,0x7a,0x50,
-0xe1,0x40,0x8f,0x8c,0xf3,0x78,0x00,0x40,0xc2,0xff,0x15,0xfb,0x2a,0x9d,0xa0,0x5c,
-0xfa,0x00,0xdf,0x80,0x00,0xaf,0xc2,0xcf,0xe1,0xba,0x7f,0x10,0x49,0x3a,0xc1,0x25,
-0x05,0xf4,0xce,0x3a,0x10,0x20,0x4a,0xee,0x00,0xed,0x66,0xf0,0x04,0x00,0x20,0x9f,
-0x50,0x39,0x40,0x02,0xff,0x28,0xf5,0x3f,0xc0,0x7f,0x60,0x00,0x6e,0x34,0xf9,0x0d,
-0x70,0x0c,0xa0,0x01,0x01,0xfd,0x05,0x30,0xef,0x00,0x7c,0xcc,0x20,0xe1,0x0b,0x00,
-0x35,0x3e,0x00,0xd8,0x2d,0x00,0xa8,0x0e,0x40,0x2f,0xe0,0x0d,0xf1,0x08,0x00,0x11,
-0x0b,0x40,0x0b,0x40,0xaf,0x30,0x03,0xfe,0x76,0x42,0x50,0xaf,0x36,0x00,0xaf,0xf9,
-0xe8,0x00,0x21,0xdf,0x30,0xe7,0xf7,0x30,0xdf,0xf9,0x2b,0x35,0xa8,0x30,0x04,0xff,
-0x57,0xd4,0x22,0x30,0xd0,0x00,0xa2,0x08,0x18,0x25,0x7e,0x80,0xf0,0x04,0x14,0x31,
-0x5c,0x01,0x30,0x20,0x1b,0xbb,0x1e,0x62,0x31,0x8f,0xe2,0x2f,0x1e,0x3c,0x20,0x09,
-0xf4,0x26,0x23,0x12,0xc0,0x67,0x44,0x42,0x2f,0xc0,0x39,0x99,0xda,0xdc,0x31,0x5f,
-0xff,0xd0,0x18,0x00,0x20,0x25,0x6f,0xf4,0x98,0x00,0x01,0x7d,0x51,0xd0,0x0f,0xfa,
-0xaa,0xbf,0x08,0x00,0x12,0xe0,0xb8,0x05,0x20,0x2f,0xe0,0x5c,0x00,0xc0,0x0f,0xfe,
-0x9f,0xe0,0x00,0x02,0xf8,0x00,0x2f,0xff,0x8f,0xf0,0xac,0x4e,0xc4,0x9f,0xe4,0x0e,
-0xfe,0xdd,0xdf,0xf5,0x00,0x3b,0x10,0x05,0xdf,0x94,0xad,0x06,0x37,0x49,0x00,0xcf,
-0x22,0x11,0x0b,0xba,0x23,0x31,0xcf,0xa0,0x0b,0xaf,0x4c,0x10,0x0c,0x07,0xcc,0x10,
-0xf0,0x5d,0x0b,0xf3,0x10,0x4f,0xc0,0x0c,0xf0,0x00,0x6a,0xaa,0x17,0xff,0x40,0x0a,
-0xff,0xf0,0x9f,0xff,0x13,0xd4,0x00,0x01,0x89,0x90,0x01,0xbf,0x11,0xbb,0xbb,0xbb,
-0xba,0x20,0x00,0xbf,0x2d,0xdd,0x50,0xbf,0x10,0x6f,0x70,0x07,0xba,0x3f,0x40,0x37,
-0x0b,0xf4,0x3f,0x6e,0x3e,0x41,0xef,0x01,0xef,0xef,0x2c,0x2a,0xf0,0x05,0x02,0xcf,
-0xfe,0x40,0x00,0x05,0xfe,0x48,0xcf,0xfc,0xcf,0xfd,0x91,0x00,0xb2,0x0b,0xfb,0x40,
-0x05,0xcf,0xda,0xb9,0x01,0xe3,0x12,0x00,0x11,0x36,0x20,0x02,0x72,0x7c,0x38,0x13,
-0x10,0x22,0x19,0x12,0xc0,0xf8,0x01,0xa1,0x0b,0xc1,0xdd,0xdd,0xfd,0xdd,0xd6,0x00,
-0x01,0x00,0xb3,0x14,0x51,0x2a,0xaa,0x80,0x00,0xef,0x58,0x12,0x11,0xc0,0x3e,0x36,
-0x41,0x15,0x6f,0xc0,0x00,0xf8,0x59,0xc0,0x1f,0xc0,0x02,0xfe,0xbb,0xdf,0x70,0x00,
-0x1f,0xc0,0x04,0xf9,0xc4,0x1f,0x40,0x1f,0xd5,0x98,0xf6,0xb2,0x78,0x40,0x2f,0xff,
-0xbd,0xf2,0x5d,0x79,0x40,0x8f,0xf8,0x6f,0xd0,0x2c,0x09,0x60,0xcf,0x42,0xff,0x43,
-0xcd,0xfe,0xd0,0x60,0x19,0xa8,0x0a,0x9f,0x13,0x40,0xe7,0x13,0x21,0xf7,0x02,0x07,
-0x52,0x32,0x02,0xef,0x73,0x28,0x0a,0x22,0x2e,0x60,0x5f,0xc1,0x12,0x01,0x4a,0x99,
-0x60,0x5a,0xaa,0x20,0x13,0x10,0xef,0xe2,0xd2,0x80,0x20,0x7f,0x80,0xef,0x20,0x00,
-0x25,0xcf,0x08,0x00,0x40,0xff,0xd0,0x00,0xaf,0x08,0x00,0x22,0xcb,0x90,0x08,0x00,
-0x00,0x0f,0x93,0x13,0x55,0x08,0x00,0x12,0xfd,0x08,0x00,0x21,0xdf,0xf5,0x08,0x00,
-0x32,0x05,0xfe,0x3a,0x7d,0x32,0x29,0xc2,0x08,0x34,0xb5,0x20,0x05,0x70,0x4a,0x42,
-0x11,0xa3,0xef,0xc0,0x30,0x7f,0x9f,0xd0,0x04,0x12,0xb3,0x07,0xf7,0x7f,0x20,0x04,
-0xc4,0xbb,0xbb,0xdf,0xdb,0xd4,0x71,0x19,0xa1,0x6d,0xdd,0x90,0x11,0x11,0x6f,0x91,
-0x10,0xff,0xfb,0xbf,0x9c,0x61,0x03,0x5f,0xb0,0xbc,0xcc,0x7f,0x50,0xce,0x30,0xff,
-0xf7,0xfc,0x0f,0x0a,0x20,0x09,0xf2,0x77,0x03,0x10,0xfb,0x2d,0xac,0xf0,0x0b,0x03,
-0x00,0x1f,0xdd,0x29,0xf8,0x8b,0xf4,0xf6,0x05,0xff,0xed,0xff,0xfe,0x7f,0xdf,0x50,
-0xbf,0xa0,0xdd,0x94,0x01,0xff,0xf1,0x03,0x60,0x94,0xeb,0x18,0xe8,0x2f,0x4a,0x90,
-0x00,0x03,0x74,0x00,0x09,0xf6,0x03,0x8a,0xce,0x9a,0xb3,0xc3,0xef,0x63,0xff,0xef,
-0xf9,0x41,0x00,0x00,0x2e,0x50,0x10,0x0b,0x9b,0x72,0x20,0x0b,0xf2,0xdb,0xad,0x11,
-0x09,0x67,0x54,0x31,0x8f,0xff,0x19,0x08,0x00,0x00,0x70,0x12,0x01,0x20,0x00,0x06,
-0x08,0x00,0x92,0x8b,0xbe,0xfc,0xbb,0x40,0x00,0xbf,0x45,0xbf,0xbe,0x43,0x30,0xfc,
-0xbf,0x20,0x2f,0x66,0x21,0xef,0xe2,0x08,0x00,0x32,0x06,0xfc,0x10,0x18,0x00,0x83,
-0x90,0x00,0xbf,0xcc,0xcc,0xde,0x50,0x00,0xba,0x26,0x21,0x8f,0x50,0xa4,0x45,0xb2,
-0x02,0xef,0x40,0x7f,0xf6,0x66,0x66,0x60,0x04,0xf5,0x1e,0x67,0x0f,0xf1,0x0d,0x0c,
-0xfb,0x44,0x44,0x4f,0xd8,0xcc,0xc4,0xff,0xa8,0x88,0x60,0xfd,0xaf,0xff,0x12,0xdf,
-0xff,0xfb,0x0f,0xc0,0x0b,0xf1,0x0a,0xf0,0x0f,0xb1,0xfc,0x09,0xde,0xf1,0x19,0xfb,
+0xf6,0x0a,0xf1,0xde,0x80,0x07,0xde,0xee,0xf5,0x01,0xf1,0x13,0x24,0x10,0x00,0x00,
+0x0b,0xff,0xff,0x10,0xbf,0xfc,0x72,0x00,0x0b,0xfb,0xef,0x10,0x16,0xbf,0xf6,0x00,
+0x0b,0xe0,0x9f,0x16,0x99,0x9a,0x70,0x00,0x0b,0xf2,0xaf,0x1b,0xff,0xff,0x20,0x00,
+0xf9,0x3c,0x14,0x66,0xef,0x0a,0xb1,0x0b,0xf9,0xdf,0x57,0x74,0xdf,0x8f,0xe2,0x0c,
+0xe0,0x9f,0x9f,0xfc,0xdf,0xfc,0x10,0x0c,0xfb,0xef,0x14,0xf9,0xdf,0xf1,0x00,0x0d,
+0xff,0xff,0x19,0xf5,0xdf,0xf8,0x00,0x0d,0xc0,0xaf,0x2e,0xf0,0xdf,0xdf,0x30,0x0f,
+0xa0,0x9f,0xcf,0x80,0xdf,0x4f,0xe3,0x2f,0x80,0xaf,0xdd,0x00,0xdf,0x09,0xf5,0x7f,
+0x4c,0xff,0x21,0x8c,0xfe,0x00,0x40,0x4d,0x0b,0xe7,0x00,0x6f,0xe6,0xba,0x07,0x21,
+0x09,0xe0,0x58,0x04,0x80,0xf6,0x09,0xe0,0x1f,0xff,0xf1,0x0e,0xdb,0x08,0x00,0xf2,
+0x03,0xee,0xf1,0x0e,0x81,0xf6,0xff,0xff,0x5f,0x88,0xf1,0x0e,0xa3,0xf6,0xbe,0xfb,
+0x4f,0x88,0xf1,0x20,0x00,0xf0,0x10,0x88,0xf1,0x0e,0x93,0xfa,0xce,0xfc,0x7f,0x88,
+0xf1,0x0e,0x81,0xfb,0xff,0xff,0x9f,0x88,0xf1,0x0f,0xfe,0xf6,0x2f,0x70,0x1f,0x88,
+0xf1,0x0f,0xff,0xf6,0x5f,0x8c,0x08,0x00,0xf3,0x17,0x61,0xf6,0x9d,0x4f,0x3f,0x89,
+0xf1,0x2f,0x41,0xf6,0xdb,0x5f,0x7f,0xef,0xf0,0x4f,0x31,0xfb,0xff,0xff,0xaf,0xa8,
+0x40,0x7f,0x3a,0xf6,0x63,0x05,0x4f,0x80,0x00,0x6b,0x1f,0xc1,0x00,0x00,0x1f,0x80,
+0xaf,0x0a,0x00,0x43,0x08,0x11,0x4b,0x4b,0x06,0xc0,0x8f,0xa0,0x00,0x00,0x9b,0xbb,
+0xef,0xdb,0xbb,0xba,0xdf,0xff,0x94,0x06,0xc3,0xdf,0x31,0x11,0x11,0x13,0xfe,0xdf,
+0x10,0x00,0x00,0x01,0xfe,0x12,0x00,0x44,0xcb,0xbb,0xbb,0xbc,0x12,0x00,0x43,0xbb,
+0xbb,0xbb,0xbb,0x18,0x00,0x00,0x12,0x00,0x14,0x02,0x06,0x00,0x02,0x12,0x00,0x01,
+0x1e,0x00,0x13,0x0c,0x02,0x06,0xf0,0x13,0x09,0xbb,0xdf,0xfc,0xbb,0xcc,0xbb,0x80,
+0x00,0x00,0xcf,0x90,0x03,0xe9,0x00,0x00,0x00,0x0a,0xfb,0x00,0x02,0xef,0xb0,0x00,
+0x00,0xcf,0xfa,0x99,0xaa,0xcf,0xfc,0x00,0x00,0xdf,0x34,0x00,0xa0,0xef,0xa0,0x00,
+0x34,0x32,0x29,0x80,0x00,0x2b,0x10,0x8b,0x02,0x10,0xe0,0x93,0x00,0x72,0x9c,0xcc,
+0xcf,0xfc,0xcc,0xc9,0x00,0xd2,0x05,0x25,0xfb,0x00,0x18,0x00,0x03,0x08,0x00,0x12,
+0x3f,0x60,0x00,0x31,0xf4,0x2c,0xcc,0x01,0x00,0x70,0xc3,0x00,0x06,0x60,0x00,0x02,
+0x84,0x4b,0x01,0xf0,0x03,0xd0,0x00,0x05,0xfb,0x00,0x00,0x05,0xaf,0xda,0x70,0x01,
+0xfd,0x10,0x00,0x09,0xfd,0xdf,0xbf,0x28,0x00,0xf0,0x08,0x09,0xf9,0x3e,0xb9,0x99,
+0x99,0x99,0x92,0x09,0xfb,0x9e,0xb0,0x33,0x33,0x32,0x00,0x09,0xf5,0x6e,0xb0,0xdf,
+0xff,0xfa,0x31,0x05,0xf6,0x2e,0xb0,0xdf,0x45,0xfa,0x00,0x6d,0xf9,0x9f,0xb0,0xde,
+0x01,0xfa,0x00,0x0a,0xfd,0x5e,0xb0,0xee,0x01,0xfa,0x00,0x0b,0xf8,0xce,0xb0,0xfc,
+0x01,0xfa,0x00,0x0c,0xd2,0x5e,0xb1,0xfa,0x01,0xfa,0x63,0x0f,0xb0,0x0e,0xb6,0xf7,
+0x01,0xfb,0xa8,0x6f,0x52,0x9f,0xce,0xf2,0x00,0xfe,0xe7,0x5e,0x00,0xfd,0x6b,0x80,
+0x00,0x8e,0xc1,0x02,0x09,0x40,0x20,0x00,0x01,0x52,0x82,0x0a,0xf1,0x03,0xb0,0x00,
+0x05,0xfa,0x00,0x00,0x03,0x8f,0xa6,0x40,0x00,0xee,0x10,0x00,0x08,0xff,0xff,0xad,
+0x62,0x08,0xfd,0x49,0xf7,0x3e,0xad,0xe8,0x88,0x8d,0xf1,0x08,0xfc,0x9e,0xad,0xd7,
+0x10,0x0b,0xf1,0x08,0xf5,0x8e,0xa1,0xaf,0x20,0x02,0x10,0x9f,0xff,0xff,0xa0,0x9f,
+0x22,0xbf,0x30,0x5c,0xf9,0x8f,0xa0,0x9f,0xaf,0xf9,0x10,0x09,0xfb,0x4e,0xa0,0x9f,
+0xfa,0x20,0x00,0x0a,0xf9,0xbe,0xa0,0x9f,0x30,0x00,0x00,0x0c,0xd3,0x9e,0xa0,0x9f,
+0x20,0x04,0xa1,0x0f,0xa0,0x0e,0xa0,0x9f,0x20,0x06,0xf3,0x5f,0x51,0x8f,0x90,0x8f,
+0xca,0xae,0xf1,0x6d,0x00,0xfd,0x40,0x2d,0xff,0xfe,0x70,0x00,0x83,0x09,0x40,0x7f,
+0xb1,0x11,0x10,0x0f,0x00,0x00,0x10,0x04,0x00,0x5b,0x0e,0xc0,0xfa,0x99,0xbf,0xf2,
+0x00,0x00,0x08,0xff,0x70,0x02,0xef,0x40,0xed,0x04,0x02,0x50,0x01,0xe0,0x1d,0xef,
+0xbb,0xbf,0xfb,0xbc,0xfb,0x00,0x00,0xbf,0x10,0x0e,0xe0,0x01,0x08,0x00,0x56,0xba,
+0xaf,0xfa,0xab,0xfb,0x70,0x01,0x50,0xbf,0x32,0x22,0x22,0x23,0x20,0x00,0x00,0x4d,
+0x00,0x50,0x06,0x81,0x00,0xbf,0x20,0xcf,0x0d,0xb0,0xf2,0x00,0x8f,0xec,0xbb,0xbb,
+0xbb,0xdf,0xd0,0x00,0x09,0x49,0x09,0xf5,0x02,0xeb,0x20,0x00,0x00,0xbf,0x30,0x02,
+0xfd,0x00,0x00,0x16,0x66,0xdf,0x86,0x68,0xfe,0x66,0xb2,0x07,0x00,0x10,0x00,0xa6,
+0x67,0xfe,0x66,0x61,0x00,0x00,0xbe,0x30,0x02,0xec,0xa6,0x00,0x20,0x06,0xdd,0x01,
+0x00,0x22,0xdc,0x00,0xba,0x07,0x10,0xfe,0x11,0x02,0x3f,0xf5,0x00,0x01,0x08,0x00,
+0x03,0x31,0x09,0xcc,0xfd,0x08,0x00,0x31,0x07,0xff,0xf6,0x08,0x00,0xc0,0x01,0x32,
+0x00,0x00,0x00,0x00,0x0a,0xf5,0x00,0x00,0x00,0x00,0xf0,0x2f,0x00,0x00,0xef,0x00,
+0x01,0xfd,0x00,0x00,0x0c,0xcc,0xff,0xcc,0xcc,0xff,0xcc,0xc0,0x0e,0xee,0xff,0xee,
+0xee,0xff,0xee,0xe0,0x00,0x00,0xef,0x06,0x61,0xfd,0x00,0x00,0x00,0x00,0x45,0x0f,
+0xe0,0x54,0x00,0x00,0x00,0x69,0x99,0x9f,0xf9,0x99,0x96,0x00,0x00,0xaf,0xff,0xff,
+0xff,0xff,0xfb,0x00,0x00,0xaf,0x30,0x1f,0xf0,0x04,0x08,0x00,0xf1,0x01,0x20,0x1f,
+0xe0,0x03,0xfb,0x00,0x2b,0xef,0xcb,0xcf,0xfb,0xbc,0xfe,0xb2,0x2f,0xff,0x01,0x00,
+0xf0,0x14,0xf2,0x00,0x00,0x03,0xff,0xfe,0x30,0x00,0x00,0x00,0x01,0x7f,0xf9,0x5f,
+0xf7,0x10,0x00,0x27,0xbf,0xff,0x70,0x05,0xff,0xfb,0x83,0x1e,0xfe,0x81,0x00,0x00,
+0x18,0xef,0xe1,0x02,0x20,0x5c,0x00,0x20,0x02,0x20,0x80,0x00,0xd2,0x00,0xfe,0x00,
+0x00,0x2d,0xdd,0xff,0xdd,0xdd,0xff,0xdd,0xd2,0x2e,0x80,0x00,0x14,0xe2,0x18,0x00,
+0xf1,0x14,0x00,0x65,0x22,0x00,0x00,0x22,0x00,0x00,0x01,0xff,0x90,0x6c,0xcc,0xcc,
+0xcc,0x10,0x00,0x2d,0xf6,0x8f,0xff,0xff,0xff,0x20,0x03,0x20,0x60,0x8f,0x70,0x00,
+0xcf,0x20,0x0e,0xfa,0x10,0x08,0x00,0xf5,0x22,0x02,0xbf,0x50,0x8f,0x71,0xbb,0xff,
+0x10,0x00,0x03,0xa9,0x8f,0x70,0xcf,0xe8,0x00,0x00,0x0a,0xfc,0x8f,0x70,0x00,0x03,
+0x60,0x00,0xaf,0xd1,0x8f,0x80,0x00,0x07,0xf7,0x0a,0xfe,0x10,0x5f,0xfc,0xcc,0xdf,
+0xf3,0x04,0xe2,0x00,0x0a,0xef,0xff,0xfe,0x80,0x00,0x01,0x00,0x73,0xbf,0x20,0x02,
+0xfb,0x00,0x00,0x1f,0xb8,0x00,0x03,0x08,0x01,0xc2,0xc1,0x00,0x00,0xbe,0x20,0x02,
+0xeb,0x00,0x00,0x00,0x08,0xe4,0x27,0x00,0x20,0x1f,0xf8,0x20,0x00,0xf1,0x1c,0xf3,
+0x00,0x9f,0xb3,0xbb,0xbb,0xbb,0xff,0xb2,0x06,0xff,0x60,0x00,0x00,0x00,0xee,0x00,
+0x3f,0xff,0x64,0xff,0xff,0xf0,0xee,0x00,0x2f,0xff,0x64,0xfb,0x7d,0xf0,0xee,0x00,
+0x04,0x7f,0x64,0xf7,0x0b,0xf0,0xee,0x00,0x00,0x6f,0x18,0x00,0x00,0x08,0x00,0xf6,
+0x0c,0xfb,0x88,0x80,0xfe,0x00,0x00,0x6f,0x62,0x83,0x05,0xdd,0xfd,0x00,0x00,0x6f,
+0x60,0x00,0x01,0xee,0xb4,0x00,0x00,0x00,0x9f,0x50,0x04,0xfa,0x78,0x00,0xf0,0x2b,
+0x09,0x99,0xdf,0xb9,0x9b,0xfd,0x99,0x91,0x00,0x00,0x58,0x20,0x04,0xbd,0xc3,0x00,
+0x04,0x89,0x9a,0xbd,0xff,0xff,0xfe,0x10,0x07,0xff,0xff,0xff,0xec,0xa9,0x94,0x00,
+0x00,0x8a,0x10,0x4d,0x60,0x01,0xef,0x20,0x00,0x8f,0x70,0x0f,0xc0,0x09,0xf7,0x00,
+0x00,0x0c,0x70,0x0f,0xd0,0x07,0x90,0x00,0x09,0x99,0x98,0x01,0x34,0x99,0x91,0x1f,
+0x78,0x01,0xf7,0x14,0x01,0x9f,0xff,0xff,0xe7,0x10,0x00,0x04,0x9e,0xfd,0x3f,0xf3,
+0xdf,0xd8,0x30,0x3f,0xfe,0x70,0x0f,0xf0,0x08,0xef,0xf2,0x05,0x50,0x00,0x0f,0xf0,
+0x00,0x05,0x40,0x00,0x00,0xcf,0x10,0xf0,0x00,0xf2,0x0b,0xf1,0x09,0x99,0xef,0xa9,
+0x9a,0xfe,0x99,0x91,0x00,0x2d,0xd8,0x00,0x01,0x85,0x00,0x00,0x00,0xaf,0xd8,0x88,
+0x88,0x88,0x88,0x40,0x03,0x20,0x00,0xb0,0x90,0x1e,0xf5,0xd8,0x00,0x00,0x00,0x5f,
+0x80,0x3f,0x78,0x5e,0x00,0xf1,0x03,0x5f,0x80,0x02,0x2f,0xa5,0xfd,0x55,0x50,0x6f,
+0x70,0x01,0x79,0x87,0xfd,0x77,0x76,0x7f,0x60,0x28,0x00,0xf2,0x0b,0xfd,0x7f,0x60,
+0x00,0x3c,0x40,0xec,0x07,0xc1,0x9f,0x40,0x00,0x4f,0x95,0xfd,0x5c,0xf1,0xbf,0x30,
+0x00,0x4f,0xff,0xff,0xff,0xf8,0xff,0x3c,0x01,0x37,0xaf,0xe6,0x00,0x70,0x01,0x3b,
+0x10,0x03,0xfa,0x80,0x00,0x90,0xfd,0x99,0x90,0x00,0x61,0x79,0x14,0xa7,0x96,0x36,
+0x02,0xf0,0x33,0x50,0x1e,0xf8,0x33,0x32,0x00,0x00,0x8f,0xf2,0xbf,0xff,0xff,0xff,
+0x40,0x00,0x03,0x6b,0xff,0xe5,0x3c,0xfb,0x00,0x0c,0x80,0x4f,0xc7,0xff,0xef,0xa0,
+0x00,0x2d,0xfe,0x13,0x27,0xef,0xff,0xb6,0x10,0x00,0x8a,0x4d,0xff,0xe8,0x4a,0xff,
+0xf6,0x00,0x02,0x3e,0xfd,0x87,0x77,0x9e,0xa0,0x00,0x1e,0xd1,0xff,0xff,0xff,0xfe,
+0x00,0x01,0xdf,0x80,0xfc,0x39,0x02,0x31,0x0d,0xf9,0x00,0x10,0x00,0x77,0x07,0xb0,
+0x00,0xfe,0x77,0x77,0xfe,0x80,0x00,0x0f,0x00,0x01,0x04,0xa0,0x1d,0xe8,0x00,0x01,
+0x86,0x00,0x00,0x00,0x7f,0xe8,0x00,0x01,0x31,0x60,0x01,0xef,0x20,0x00,0xb0,0xb0,
+0x0c,0xf8,0x00,0x9b,0x4f,0x40,0x2f,0xb0,0x5f,0xef,0xe8,0x00,0xf0,0x15,0x2f,0xa0,
+0x06,0x37,0x77,0xdf,0x77,0x74,0x3f,0xa0,0x00,0x7f,0xa8,0xef,0x89,0xf8,0x3f,0x90,
+0x00,0x7f,0xdd,0xff,0xdd,0xf8,0x4f,0x80,0x00,0x7f,0x75,0xdf,0x56,0xf8,0x5f,0x70,
+0x00,0x7f,0xf8,0x00,0xf8,0x02,0x7f,0x50,0x00,0x7f,0x20,0xbe,0x05,0xfa,0xcf,0x30,
+0x00,0x7f,0x20,0x9b,0x0b,0xbf,0xf9,0x80,0x00,0x36,0x20,0x01,0xfd,0xf8,0x01,0xf0,
+0x33,0x07,0x77,0xef,0x97,0x78,0xfe,0x77,0x71,0x00,0x00,0x4a,0x50,0x09,0x94,0x00,
+0x00,0x00,0xea,0x2f,0xb0,0x5f,0xc4,0x44,0x20,0x00,0xfb,0x2f,0xb0,0xaf,0xff,0xff,
+0x80,0x00,0xfb,0x2f,0xb2,0xfe,0x6d,0x75,0x30,0x00,0xfb,0x2f,0xbc,0xf7,0x5f,0xb0,
+0x00,0x00,0xfb,0x2f,0xb3,0xa0,0x0a,0xf4,0x00,0x00,0x21,0x17,0x50,0x00,0x03,0x80,
+0x00,0x00,0x9f,0x47,0x00,0x80,0xfc,0x00,0x00,0x9f,0x8a,0xf9,0x9f,0xa8,0x08,0x00,
+0xf2,0x00,0x25,0xf4,0x3f,0x61,0xfc,0x00,0x29,0xdf,0xbb,0xfb,0xbf,0xca,0xfe,0x93,
+0x4f,0x68,0x00,0x76,0xf4,0x00,0x00,0x9f,0x40,0x05,0xf8,0xf8,0x00,0xf2,0x0b,0x08,
+0x88,0xcf,0xa8,0x8a,0xfc,0x8e,0x81,0x00,0x00,0x24,0x10,0x01,0xcf,0x3f,0xb0,0x0a,
+0x55,0x99,0x99,0x99,0xef,0x9e,0xd2,0x0e,0x78,0x30,0x00,0xf0,0x2c,0x0e,0x9a,0xf3,
+0x55,0x55,0x9f,0x04,0x20,0x0e,0xff,0xf7,0xfe,0xfe,0x9f,0x1f,0xb0,0x02,0x2a,0xf7,
+0xe6,0xf4,0x7f,0x6f,0x70,0x49,0x9d,0xf7,0xfd,0xdf,0x8f,0xcf,0x20,0x6f,0xff,0xe7,
+0xe4,0x5f,0x5f,0xfb,0x00,0x0c,0x9a,0xd7,0xfd,0xfd,0x2f,0xf3,0x00,0x0e,0x6c,0xb7,
+0xe6,0xf4,0x4f,0xf1,0xb2,0x6f,0x3f,0x66,0x29,0x01,0xa7,0xf4,0x13,0x3d,0x20,0x00,
+0x08,0xd4,0x9f,0xc0,0x00,0x01,0x00,0x11,0x01,0x48,0x03,0x42,0x60,0x00,0x2f,0x90,
+0x08,0x00,0x60,0x9f,0xd9,0xa6,0x00,0x00,0x1f,0x43,0x02,0xf0,0x0a,0xfd,0x00,0x09,
+0xaf,0xc9,0x6e,0xfe,0x39,0xf6,0x00,0x0f,0xff,0xff,0xdf,0x9f,0xdf,0xb0,0x00,0x0f,
+0x4f,0x3e,0x62,0x5e,0xff,0xa4,0x08,0x00,0xf0,0x33,0xdf,0xfe,0xad,0xff,0xf4,0x0f,
+0x4f,0x4e,0xce,0x73,0xf9,0x3a,0xb0,0x0f,0xff,0xff,0x6b,0xee,0xff,0xee,0x50,0x0f,
+0xbf,0xb8,0x35,0x68,0xfc,0x66,0x20,0x02,0x2f,0x79,0x37,0xdd,0xfe,0xdd,0x10,0x00,
+0x2f,0x6e,0x73,0x67,0xfc,0x66,0x00,0x26,0xaf,0xff,0xdf,0xff,0xff,0xff,0xf0,0x5f,
+0xfd,0xab,0xf6,0x68,0xfc,0x66,0x60,0x03,0x00,0x01,0x20,0x02,0x7f,0x01,0x22,0x3f,
+0x40,0x85,0x00,0x30,0x3f,0x40,0x3f,0xd8,0x01,0x00,0x08,0x00,0xf0,0x0c,0x95,0xfb,
+0x5f,0xb0,0x0c,0xdf,0xdc,0x5f,0xfe,0xff,0xef,0xb0,0x0f,0xcf,0xcf,0x5f,0x94,0xfa,
+0x4f,0xb0,0x0f,0x5f,0x4f,0x5f,0xff,0xff,0xff,0x08,0x00,0xc0,0x35,0xaf,0xc6,0xa5,
+0x40,0x0f,0x6f,0x6f,0x28,0xfd,0x4b,0xf5,0x98,0x00,0xf1,0x02,0x2e,0xff,0xfd,0x44,
+0x00,0x0f,0xbf,0x97,0x05,0xcf,0xb4,0x9f,0x60,0x00,0x3f,0xae,0x5f,0x10,0x04,0xf3,
+0x13,0x5f,0xbf,0x5a,0xb5,0xfd,0x36,0x81,0x5f,0xff,0xff,0x9c,0xf2,0xec,0x9f,0x40,
+0x4e,0xa6,0x36,0xef,0xa8,0xfc,0x0d,0xe0,0x00,0x00,0x00,0x37,0x3f,0xe6,0x03,0x50,
+0x00,0x05,0xb4,0x78,0x00,0x20,0xf4,0x0f,0x58,0x00,0xa2,0x03,0xef,0x80,0x0c,0xcc,
+0xcc,0xcc,0x90,0x3f,0xfa,0x17,0x00,0x40,0x1e,0x90,0xdc,0x10,0x08,0x00,0x32,0x03,
+0x09,0xfc,0x11,0x00,0x30,0x5f,0xf3,0xbf,0x18,0x02,0xc0,0x05,0xff,0xd0,0x8b,0xbb,
+0xbf,0xfb,0xb1,0x5f,0xff,0xd0,0x00,0xba,0x03,0x22,0x2e,0x9f,0x08,0x00,0x2f,0x00,
+0x1f,0x08,0x00,0x07,0x31,0x7f,0xff,0xd0,0x08,0x00,0x36,0x3e,0xeb,0x40,0x75,0x01,
+0x21,0x4c,0x10,0x1f,0x00,0x32,0x00,0x9f,0xb0,0x08,0x00,0x21,0x0d,0xc0,0x08,0x00,
+0x40,0x5f,0xff,0xff,0xd2,0x08,0x00,0x41,0x4b,0xbb,0xcf,0xf1,0x18,0x00,0xf2,0x24,
+0x00,0x9f,0x80,0x0f,0xfb,0x40,0x00,0x00,0x06,0xfd,0x3a,0x1f,0xff,0xf7,0x00,0x00,
+0x4f,0xf9,0xdf,0x4f,0xf6,0xff,0x90,0x06,0xff,0xff,0xf5,0x0f,0xf0,0x4f,0xf2,0x9f,
+0xff,0xfa,0xfa,0x0f,0xf0,0x04,0x20,0x3e,0x3d,0xf1,0xad,0x1f,0xf0,0x00,0x00,0x01,
+0x0d,0xf1,0x02,0x50,0x00,0x2e,0xf1,0x00,0x08,0x00,0x01,0x7a,0x00,0x20,0x0f,0xe0,
+0xd8,0x00,0x02,0xa0,0x04,0x22,0x40,0x05,0x78,0x02,0x83,0x70,0x00,0x11,0x11,0x1f,
+0xe1,0x11,0x11,0xb8,0x02,0xf2,0x04,0xfd,0x00,0x00,0x47,0x77,0x7f,0xf7,0x77,0x76,
+0x00,0x08,0x88,0x88,0x8f,0xf8,0x88,0x88,0x80,0x0f,0x28,0x00,0xf4,0x2d,0xf0,0x00,
+0x00,0x5e,0xf8,0xfe,0x10,0x27,0x00,0x00,0x3b,0xff,0x60,0x9f,0x73,0xef,0x70,0x3c,
+0xff,0xfc,0x00,0x1f,0xff,0xf6,0x00,0x1e,0xc8,0xfc,0x00,0x06,0xff,0x50,0x00,0x00,
+0x04,0xfd,0x7b,0xf6,0x9f,0xf9,0x20,0x00,0x0b,0xff,0xff,0xc4,0x06,0xff,0xf4,0x00,
+0x08,0xfb,0x61,0x00,0x00,0x29,0xa0,0x00,0x01,0x10,0xfa,0x00,0x10,0x28,0xa2,0x05,
+0x83,0x04,0x44,0x44,0x7f,0xf5,0x44,0x44,0x30,0x58,0x00,0x31,0xd0,0x03,0x33,0x01,
+0x00,0x30,0x20,0x00,0x0c,0x0f,0x00,0xf5,0x0b,0xe0,0x00,0x00,0x0d,0xf5,0x55,0x55,
+0x6f,0xe0,0x00,0x0f,0xff,0xfe,0xee,0xee,0xef,0xff,0xf1,0x06,0x6e,0xf4,0x44,0x44,
+0x5f,0xf6,0x60,0x20,0x00,0xf5,0x20,0x06,0x8f,0xfc,0xef,0x97,0x88,0x00,0x00,0x17,
+0xef,0xa0,0x6f,0xb3,0xef,0x60,0x3b,0xff,0xff,0x10,0x0c,0xff,0xd3,0x00,0x0d,0xc6,
+0xcf,0x46,0x95,0xdf,0xe6,0x00,0x00,0x02,0xff,0xff,0xf6,0x1a,0xff,0xf3,0x00,0x00,
+0xdb,0x74,0x00,0x00,0x39,0x90,0x78,0x01,0xf0,0x0e,0x07,0x80,0x00,0x00,0x1f,0xb0,
+0x00,0x00,0x00,0xdf,0x10,0x00,0x01,0xfb,0x00,0x00,0x00,0x05,0xf5,0x04,0x66,0x7f,
+0xd6,0x65,0x10,0x7b,0xce,0xc3,0xaf,0x3a,0x02,0xf1,0x11,0x0a,0xff,0xff,0x5a,0xf7,
+0x7f,0xd6,0xee,0x00,0x00,0x0b,0xd0,0xaf,0x11,0xfb,0x1f,0x90,0x00,0x07,0xf7,0x9b,
+0xfa,0xaf,0xe9,0xa6,0x00,0x04,0xff,0xcd,0xcf,0xff,0xff,0x7c,0x01,0xf2,0x34,0x4c,
+0xff,0xe1,0x09,0xf4,0x00,0xcf,0xef,0xdd,0xed,0x7f,0x82,0xfe,0x00,0x05,0x4a,0xf4,
+0x8f,0xa0,0xdf,0xcf,0x50,0x00,0x00,0xaf,0x14,0xf7,0x03,0xff,0xb0,0x00,0x00,0x0a,
+0xf1,0xbf,0x23,0xcf,0xff,0x81,0x00,0x00,0xaf,0x5f,0xcc,0xff,0x85,0xef,0xf4,0x00,
+0x0a,0xf1,0x82,0x89,0x10,0x01,0x8a,0x00,0x00,0x00,0xec,0x00,0x03,0xfb,0x00,0x00,
+0x07,0xb1,0x08,0x00,0xc1,0x0a,0xfc,0xec,0x7b,0xbc,0xfe,0xbb,0xb3,0x00,0x85,0xec,
+0x9f,0x10,0x04,0x21,0x02,0xfc,0x18,0x00,0x40,0x04,0xbf,0xfc,0x00,0xc7,0x07,0x40,
+0x2f,0xf9,0xfc,0x3f,0xf1,0x00,0x80,0x05,0x10,0x98,0x3e,0xd9,0x99,0x99,0x80,0xa2,
+0x03,0x25,0xe1,0x00,0x30,0x04,0xf0,0x1d,0xf6,0x07,0x77,0x8e,0xfc,0xff,0x77,0x9e,
+0x73,0x00,0x49,0xff,0x80,0x7f,0x97,0xff,0x50,0x1f,0xff,0xfd,0x00,0x0c,0xff,0xb1,
+0x00,0x04,0x42,0xfe,0xad,0xf3,0xaf,0xfa,0x51,0x00,0x0b,0xff,0xeb,0x70,0x04,0xcf,
+0xf4,0x00,0x04,0x52,0xea,0x03,0x14,0x40,0x08,0x08,0xd1,0x2d,0xdd,0xde,0xfd,0xdf,
+0xed,0xdd,0xd1,0x00,0x00,0x09,0xf1,0x3f,0x1e,0x01,0x73,0x09,0xf2,0x4f,0x90,0x00,
+0x00,0x05,0x60,0x06,0xf1,0x0e,0x05,0xfd,0xbe,0xfb,0xcf,0xdb,0xcf,0x90,0x05,0xf7,
+0x0d,0xf0,0x3f,0x90,0x5f,0x90,0x05,0xf7,0x4f,0xb0,0x3f,0xa0,0x6f,0x90,0x05,0xfc,
+0xff,0x30,0x1f,0x20,0x00,0x81,0xe4,0x00,0x06,0xbb,0xdf,0x90,0x05,0xf7,0x1d,0x03,
+0x96,0x90,0x05,0xf8,0x11,0x11,0x11,0x11,0x6f,0x90,0x40,0x00,0x74,0xaa,0xaa,0xaa,
+0xaa,0xcf,0x80,0x0d,0xd8,0x04,0xf3,0x01,0xaa,0xad,0xfb,0xaf,0xea,0xaa,0xa1,0x00,
+0x77,0x7c,0xf8,0x7f,0xe7,0x77,0x40,0x01,0x28,0x00,0xf4,0x01,0x01,0xfb,0x0a,0xf3,
+0x1f,0xc0,0x5f,0x90,0x01,0xfd,0x7c,0xf8,0x7f,0xd7,0x9f,0x90,0x18,0x00,0x84,0x00,
+0x11,0x15,0xfd,0x11,0x11,0x11,0x10,0xe8,0x00,0xe0,0x09,0x99,0xef,0xc9,0x99,0xff,
+0xb9,0x94,0x00,0x05,0xff,0x83,0x09,0xfb,0xc8,0x01,0xf0,0x0a,0xbe,0xff,0xff,0xf5,
+0x00,0x00,0x03,0x46,0x8b,0xff,0xff,0xff,0xea,0x40,0x08,0xff,0xff,0xb6,0x10,0x5a,
+0xff,0x60,0x01,0x53,0x10,0xde,0x02,0x14,0x00,0xb0,0x02,0x83,0x05,0x77,0x7d,0xf7,
+0x8f,0xc7,0x77,0x50,0x38,0x07,0xf0,0x05,0x60,0x03,0xfb,0x7d,0xf7,0x9f,0xc7,0xbf,
+0x60,0x01,0x7e,0xa7,0x9f,0xb7,0x77,0x77,0x30,0x00,0x9f,0x90,0xf6,0x01,0xf6,0x31,
+0xc0,0x2c,0xfb,0x08,0xfd,0x88,0x88,0x88,0x30,0x1d,0x7b,0xfe,0xff,0xa9,0x99,0xdf,
+0x00,0x00,0x7f,0x91,0x7f,0xdc,0xcc,0xef,0x00,0x09,0xff,0x20,0x5f,0xba,0xaa,0xdf,
+0x00,0x4f,0xff,0x20,0x19,0xff,0x88,0x86,0x00,0x04,0x8f,0x26,0xdf,0xfd,0xdf,0xfa,
+0x00,0x00,0x8f,0x35,0x9a,0xfe,0xef,0xc6,0x61,0x00,0x8f,0x3e,0xec,0x95,0x47,0xac,
+0x50,0x05,0x24,0x0f,0xd0,0x08,0x00,0x10,0x08,0xd8,0x02,0x00,0x08,0x00,0xf1,0x04,
+0xfb,0x99,0xaf,0xd0,0x0f,0xff,0xff,0xb8,0xf4,0x23,0x0f,0xd0,0x0b,0xbf,0xfb,0x88,
+0xf4,0xbf,0x0f,0x18,0x00,0x00,0x08,0x00,0xf0,0x16,0x39,0x9f,0xe9,0x98,0xf4,0xcf,
+0x0f,0xd0,0x5f,0xff,0xff,0xe8,0xf4,0xde,0x0f,0xd0,0x12,0x5f,0xd3,0x28,0xf4,0xfc,
+0x0f,0xd0,0x00,0x6f,0xf9,0x03,0x76,0xff,0x57,0x60,0x00,0x9f,0xdf,0x60,0x0a,0x58,
+0x03,0xf0,0x0f,0xee,0x1e,0xf1,0x5f,0xff,0x50,0xa3,0x06,0xf9,0x05,0x53,0xef,0x7f,
+0x50,0xf7,0x3f,0xe1,0x00,0x7f,0xf4,0x4f,0xb8,0xf5,0x1c,0x50,0x00,0xbd,0x30,0x0c,
+0xff,0x80,0x00,0x12,0x10,0xe0,0x02,0x03,0x68,0x03,0x31,0x6f,0xb0,0x0d,0xb0,0x03,
+0xf1,0x0c,0x0c,0xd1,0x0d,0xf9,0x99,0x9e,0xf0,0x0d,0xff,0xff,0x7d,0xf0,0x8a,0x0c,
+0xf0,0x0a,0xbb,0xef,0x3d,0xf0,0xcf,0x1c,0xf0,0x00,0x01,0xeb,0x0d,0x08,0x00,0xf8,
+0x38,0x0b,0xf4,0x0d,0xf0,0xdf,0x0c,0xf0,0x00,0x9f,0xf7,0x0d,0xf0,0xef,0x0c,0xf0,
+0x0b,0xff,0xff,0x5d,0xf1,0xfc,0x0c,0xf0,0x1f,0xff,0xbe,0x96,0x76,0xfe,0x85,0x70,
+0x09,0x5f,0xa3,0x00,0x1e,0xff,0xa0,0x00,0x00,0x2f,0xa0,0x00,0xaf,0xcf,0xa0,0x95,
+0x00,0x2f,0xa0,0x09,0xfe,0x2f,0xa0,0xda,0x00,0x2f,0xa1,0xdf,0xe3,0x0f,0xe9,0xf7,
+0x00,0x2f,0xa0,0x8a,0x10,0x07,0xcc,0xa1,0x50,0x06,0x01,0x43,0x0a,0x40,0x0c,0xf0,
+0x1f,0xe0,0x36,0x00,0xf5,0x14,0xcf,0x05,0xfe,0x88,0x88,0x22,0xfa,0x0c,0xf0,0xaf,
+0xff,0xff,0xf4,0x2f,0xa0,0xcf,0x2f,0xe2,0x6a,0x22,0x02,0xfa,0x0c,0xf9,0xf6,0x09,
+0xf7,0x00,0x1a,0x70,0xad,0x28,0x00,0x0e,0xd0,0x36,0x00,0x22,0xff,0xff,0x33,0x01,
+0x50,0xfa,0xaa,0xaa,0xab,0xfd,0x2e,0x08,0xa0,0xee,0x00,0x2f,0xd0,0x00,0x0f,0xe0,
+0x0f,0xe1,0x02,0x0f,0x00,0xf5,0x0e,0x06,0xff,0xf2,0x2e,0xc0,0x00,0x01,0x39,0xff,
+0xdf,0x30,0x00,0x91,0x48,0xcf,0xfc,0x3a,0xfb,0x88,0xbf,0x43,0xfe,0xa4,0x00,0x4d,
+0xff,0xff,0xa0,0x01,0x7e,0x00,0x21,0x4e,0xb1,0x07,0x00,0x10,0x0d,0x36,0x02,0xf2,
+0x03,0x00,0x00,0x08,0xfe,0x88,0x8a,0xff,0x60,0x00,0x07,0xff,0x40,0x00,0xaf,0xa0,
+0x00,0x08,0xff,0x3e,0x08,0xf3,0x07,0xaf,0xff,0xcc,0xcf,0xfc,0xcd,0xfb,0x00,0x4f,
+0xf0,0x02,0xfc,0x00,0x3f,0xb0,0x00,0xff,0xaa,0xbf,0xea,0xac,0xfb,0x35,0x02,0xf2,
+0x03,0xb0,0x02,0xfe,0x00,0x2f,0xc0,0x03,0xfb,0x00,0x3f,0xfb,0xbc,0xff,0xbb,0xcf,
+0xb0,0x06,0xff,0x5b,0x0b,0x21,0xdf,0x50,0x2d,0x00,0xf4,0x00,0x8f,0xd0,0x00,0x2f,
+0xc6,0xce,0xfa,0x04,0xe3,0x00,0x02,0xfc,0x2f,0xfc,0x30,0x77,0x00,0x23,0x6a,0x20,
+0x47,0x08,0x20,0x21,0x00,0x78,0x01,0xf0,0x55,0x01,0xff,0xff,0xd0,0x8b,0xfb,0x8e,
+0xf0,0x08,0xf9,0x7f,0x90,0x09,0xf2,0x0c,0xe0,0x3f,0xf7,0xaf,0x94,0x2e,0xd0,0x0e,
+0xd0,0x6f,0xff,0xff,0xfc,0xee,0x27,0xff,0x90,0x08,0xf2,0xf2,0xea,0x99,0x2a,0xf6,
+0x00,0x07,0xfe,0xfe,0xfa,0x6f,0x4d,0xf0,0x00,0x07,0xfb,0xfb,0xfa,0xaf,0xff,0xff,
+0xf0,0x08,0xf1,0xf2,0xec,0xfd,0x9e,0xf9,0x90,0x09,0xfb,0xfc,0xfb,0x92,0x0d,0xf0,
+0x00,0x0a,0xfb,0xfb,0xfa,0xdf,0xff,0xff,0xf5,0x0d,0xb0,0xf2,0xea,0x9a,0xaf,0xfa,
+0xa4,0x2f,0x70,0xfa,0xf9,0x00,0x0d,0xf0,0x00,0x5e,0x10,0x6a,0xe4,0x08,0x00,0x0d,
+0x01,0x00,0x50,0x7d,0x40,0x00,0x00,0xbf,0x4f,0x0a,0x11,0x41,0x08,0x00,0x40,0x01,
+0xff,0xff,0xb0,0x08,0x00,0xf0,0x0d,0x08,0xfa,0x8f,0x90,0x99,0xef,0xb9,0x80,0x2f,
+0xf8,0xaf,0x93,0xef,0xff,0xff,0xe0,0x5f,0xff,0xff,0xf8,0xe8,0x7f,0x1a,0xe0,0x08,
+0xf2,0xf3,0xe8,0x08,0x00,0x41,0x07,0xf8,0xf9,0xf8,0x08,0x00,0x61,0xfe,0xff,0xf8,
+0xec,0xcf,0x8d,0x18,0x00,0xf0,0x11,0xbc,0xef,0xdc,0xb0,0x09,0xff,0xff,0xf8,0x00,
+0xaf,0x69,0x50,0x09,0xf8,0xf9,0xf8,0x00,0xaf,0x5e,0xc0,0x0c,0xc1,0xf3,0xea,0x46,
+0xcf,0xce,0xf2,0x0f,0x91,0xf8,0xfd,0x62,0x01,0x92,0x4f,0x41,0xfc,0xf7,0xa9,0x75,
+0x32,0xf8,0x04,0x80,0x02,0x00,0x05,0x01,0x23,0x29,0x80,0x9a,0x0b,0x30,0xf3,0x00,
+0x00,0x40,0x06,0x54,0x8d,0xfd,0x88,0x88,0x83,0xc8,0x03,0x05,0xa8,0x00,0x13,0x0d,
+0xff,0x08,0x10,0x07,0xd7,0x09,0x96,0x82,0x00,0x00,0x06,0x77,0x77,0x77,0x77,0x72,
+0x18,0x00,0x04,0x01,0x00,0x10,0x0a,0x48,0x04,0x22,0xa4,0x00,0x9c,0x01,0x12,0xf7,
+0x60,0x03,0x10,0x07,0x08,0x00,0x56,0xe9,0x99,0x99,0x9c,0xf7,0x18,0x00,0x04,0x01,
+0x00,0xf0,0x08,0x7f,0x19,0xf0,0x02,0xe6,0x00,0x00,0x1c,0xef,0xde,0xfc,0x79,0xfb,
+0x88,0x83,0x00,0xe9,0x01,0x20,0x3f,0xff,0xff,0xf7,0xfa,0x01,0xf3,0x15,0xef,0xf3,
+0x8f,0x20,0x4f,0xe9,0x95,0xbe,0x75,0xdf,0xf9,0x00,0x09,0xf5,0xc8,0xdc,0x04,0xbf,
+0xfb,0x50,0x02,0xfd,0xde,0xf8,0x6f,0xe7,0x8e,0xf8,0x03,0x63,0x27,0x8d,0xd7,0x32,
+0x23,0x81,0x38,0x04,0x30,0xf5,0x00,0x08,0x98,0x00,0x25,0x84,0x00,0x08,0x00,0x90,
+0x0e,0xee,0xee,0xee,0xee,0xe7,0x00,0x00,0x2a,0x90,0x00,0xc3,0xa7,0x00,0x00,0x3f,
+0xb4,0x44,0x44,0x45,0xfb,0x00,0x00,0x3f,0x78,0x0d,0x50,0x48,0x00,0x00,0x01,0xfe,
+0x57,0x06,0x12,0xa0,0x08,0x00,0x22,0x1d,0xf8,0x08,0x00,0x22,0x01,0xc1,0x08,0x00,
+0x12,0x00,0x20,0x00,0xb0,0x4d,0xdd,0xc1,0xbb,0xbc,0xff,0xbb,0xb7,0x5f,0xff,0xe1,
+0x39,0x00,0x90,0xf9,0x00,0x1f,0xe0,0x33,0x35,0xff,0x33,0x32,0x96,0x07,0x01,0x28,
+0x00,0x05,0x08,0x00,0x22,0xe2,0x80,0x08,0x00,0x21,0xff,0xf1,0x08,0x00,0x31,0x5f,
+0xfe,0x50,0x08,0x00,0x22,0xaf,0xb1,0x20,0x00,0x13,0x28,0x70,0x00,0x20,0x38,0x00,
+0x33,0x06,0x01,0x78,0x00,0x10,0x02,0x18,0x05,0x21,0x2e,0xf8,0x40,0x06,0x31,0x00,
+0x02,0xd1,0x08,0x00,0x00,0x01,0x00,0x00,0xd0,0x0c,0x60,0x4c,0xcc,0xb0,0x00,0x06,
+0xfb,0x60,0x08,0x42,0xe0,0x00,0x07,0xfd,0x68,0x00,0xb1,0x09,0xff,0x10,0x00,0x00,
+0x0e,0xe0,0x00,0x0d,0xff,0x50,0x08,0x00,0x10,0x2f,0xba,0x06,0x60,0x0e,0xe1,0x40,
+0x8f,0x8c,0xf3,0x78,0x00,0x30,0xc2,0xff,0x15,0x81,0x06,0xf4,0x06,0xfe,0x5c,0xfa,
+0x00,0xdf,0x80,0x00,0xaf,0xc2,0xcf,0xe1,0x00,0x3f,0xf7,0x00,0x49,0x00,0x8e,0x20,
+0x00,0x05,0xa1,0x01,0x10,0x10,0xf2,0x01,0x10,0x16,0x77,0x04,0xf0,0x05,0xf5,0x00,
+0x20,0x9f,0x50,0x39,0x40,0x02,0xff,0x28,0xf5,0x3f,0xc0,0x7f,0x60,0x00,0x6e,0x34,
+0xf9,0x0d,0x70,0x0c,0xa1,0x01,0x01,0xfd,0x05,0x30,0xef,0x00,0x7c,0xcc,0x20,0xe1,
+0x0b,0x70,0x9f,0xff,0x30,0x7f,0x70,0x07,0xf7,0xa8,0x0e,0x40,0x2f,0xe0,0x0d,0xf1,
+0x08,0x00,0x11,0x0b,0x40,0x0b,0xd0,0xaf,0x30,0x03,0xfe,0xef,0x30,0x00,0x00,0xaf,
+0x36,0x00,0xaf,0xf9,0xe8,0x00,0xf5,0x0f,0xdf,0x30,0x9f,0xfc,0x10,0x00,0x00,0xdf,
+0xf9,0x2b,0xfe,0xef,0xe5,0x00,0x04,0xff,0x57,0xff,0xc1,0x1c,0xff,0xd0,0x00,0xa2,
+0x07,0xf8,0x00,0x00,0x7e,0x80,0xf0,0x04,0x14,0x31,0x5c,0x01,0xa0,0x20,0x1b,0xbb,
+0xbb,0xbb,0x80,0x00,0x8f,0xe2,0x2f,0xd0,0x05,0xa0,0x00,0x09,0xf4,0x02,0x22,0x22,
+0x4f,0xc0,0x00,0x00,0x74,0x09,0x51,0x2f,0xc0,0x39,0x99,0x80,0x08,0x00,0x31,0x5f,
+0xff,0xd0,0x18,0x00,0x41,0x25,0x6f,0xd0,0x0f,0x28,0x00,0x61,0x0f,0xd0,0x0f,0xfa,
+0xaa,0xbf,0x08,0x00,0x12,0xe0,0xb8,0x05,0x20,0x2f,0xe0,0x5c,0x00,0xf0,0x18,0x0f,
+0xfe,0x9f,0xe0,0x00,0x02,0xf8,0x00,0x2f,0xff,0x8f,0xf0,0x00,0x05,0xf8,0x00,0x9f,
+0xe4,0x0e,0xfe,0xdd,0xdf,0xf5,0x00,0x3b,0x10,0x05,0xdf,0xff,0xfe,0x90,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x10,0x00,0x01,0x00,0xf0,0x61,0x03,0xf9,
+0x00,0x0b,0xff,0xff,0xf0,0x00,0x01,0xcf,0xa0,0x0b,0xfc,0xcf,0xf0,0x00,0x00,0x0c,
+0xc0,0x0d,0xf0,0x0c,0xf0,0x00,0x00,0x01,0x00,0x4f,0xc0,0x0c,0xf0,0x00,0x6a,0xaa,
+0x17,0xff,0x40,0x0a,0xff,0xf0,0x9f,0xff,0x13,0xd4,0x00,0x01,0x89,0x90,0x01,0xbf,
+0x11,0xbb,0xbb,0xbb,0xba,0x20,0x00,0xbf,0x11,0xff,0xff,0xff,0xff,0x10,0x00,0xbf,
+0x10,0x6f,0x70,0x07,0xf9,0x00,0x00,0xbf,0x37,0x0b,0xf4,0x3f,0xf2,0x00,0x00,0xbf,
+0xef,0x01,0xef,0xef,0x50,0x00,0x00,0xef,0xf5,0x02,0xcf,0xfe,0x40,0x00,0x05,0xfe,
+0x48,0xcf,0xfc,0xcf,0xfd,0x91,0x00,0xb2,0x0b,0xfb,0x40,0x05,0xcf,0xb0,0x59,0x00,
+0xf0,0x18,0x00,0x00,0x01,0x10,0x00,0x11,0x00,0x00,0x02,0x72,0x00,0x00,0x02,0xec,
+0x10,0x00,0x07,0xf8,0x00,0x00,0x00,0xaf,0xc0,0x00,0x03,0xfb,0x00,0x00,0x00,0x0b,
+0xc1,0xdd,0xdd,0xfd,0xdd,0xd6,0x00,0x01,0x00,0x60,0x00,0xf0,0x05,0xf8,0x2a,0xaa,
+0x80,0x00,0xef,0x00,0x00,0x00,0x3f,0xff,0xc0,0x00,0xff,0x00,0x00,0x00,0x15,0x6f,
+0xc0,0x19,0x00,0xf5,0x2a,0x80,0x00,0x1f,0xc0,0x02,0xfe,0xbb,0xdf,0x70,0x00,0x1f,
+0xc0,0x04,0xf9,0x00,0x7f,0x60,0x00,0x1f,0xd5,0x98,0xf6,0x00,0x8f,0x50,0x00,0x2f,
+0xff,0xbd,0xf2,0x00,0xaf,0x30,0x00,0x8f,0xf8,0x6f,0xd0,0x00,0xdf,0x10,0x00,0xcf,
+0x42,0xff,0x43,0xcd,0xfe,0x00,0x00,0x23,0x00,0xa8,0x00,0xef,0xd4,0x00,0x01,0x00,
+0x12,0x40,0x07,0x00,0xd0,0x09,0xf7,0x02,0xbb,0xbb,0xbb,0xbb,0xb0,0x02,0xef,0x73,
+0xff,0xff,0x09,0x01,0x62,0x2e,0x60,0x00,0x00,0xef,0x20,0xa7,0x00,0xf0,0x06,0xef,
+0x10,0x00,0x5a,0xaa,0x20,0x13,0x10,0xef,0x10,0x00,0x8f,0xff,0x20,0x7f,0x80,0xef,
+0x20,0x00,0x25,0xcf,0x08,0x00,0x40,0xff,0xd0,0x00,0xaf,0x08,0x00,0x22,0xcb,0x90,
+0x08,0x00,0x53,0x10,0x00,0x00,0xaf,0x55,0x08,0x00,0x12,0xfd,0x08,0x00,0x21,0xdf,
+0xf5,0x08,0x00,0x30,0x05,0xfe,0x3a,0x58,0x00,0x94,0xf1,0x02,0xc2,0x08,0xcc,0xcc,
+0xcc,0xcc,0xc0,0x7f,0x00,0xf0,0x12,0x05,0x70,0x00,0x00,0x07,0xf8,0xa3,0x00,0xef,
+0x70,0x00,0x00,0x7f,0x9f,0xd0,0x02,0xef,0x40,0x00,0x07,0xf7,0x7f,0x20,0x04,0xc4,
+0xbb,0xbb,0xdf,0xdb,0xd4,0x00,0x00,0x4f,0x36,0x00,0xf5,0x3c,0x6d,0xdd,0x90,0x11,
+0x11,0x6f,0x91,0x10,0xff,0xfb,0x00,0x00,0x04,0xf9,0x00,0x03,0x5f,0xb0,0xbc,0xcc,
+0x7f,0xa0,0x00,0x01,0xfb,0x0d,0xff,0xf7,0xfc,0x00,0x00,0x1f,0xb0,0x09,0xf2,0x0f,
+0xe0,0x00,0x01,0xfb,0x00,0x9f,0x20,0xef,0x03,0x00,0x1f,0xdd,0x29,0xf8,0x8b,0xf4,
+0xf6,0x05,0xff,0xed,0xff,0xfe,0x7f,0xdf,0x50,0xbf,0xa0,0xdd,0x94,0x01,0xff,0xf1,
+0x03,0x60,0x01,0x00,0x00,0x06,0xe8,0xf8,0x00,0x10,0x30,0xf5,0x01,0xf1,0x0a,0x74,
+0x00,0x09,0xf6,0x03,0x8a,0xce,0xff,0xff,0x20,0x02,0xef,0x63,0xff,0xef,0xf9,0x41,
+0x00,0x00,0x2e,0x50,0x10,0x0b,0xf2,0x00,0xf8,0x00,0x00,0x08,0x00,0xb1,0x7c,0xcc,
+0x09,0xee,0xef,0xfe,0xee,0xe1,0x8f,0xff,0x19,0x08,0x00,0x31,0x00,0xbf,0x10,0x18,
+0x00,0x07,0x08,0x00,0xf1,0x09,0x8b,0xbe,0xfc,0xbb,0x40,0x00,0xbf,0x45,0xbf,0xff,
+0xff,0xff,0x50,0x00,0xbf,0xfc,0xbf,0x20,0x00,0x9f,0x50,0x00,0xef,0xe2,0x08,0x00,
+0x32,0x06,0xfc,0x10,0x18,0x00,0xe0,0x90,0x00,0xbf,0xcc,0xcc,0xde,0x50,0x00,0x20,
+0x00,0x06,0x61,0x00,0x00,0xa2,0x01,0xf0,0x51,0xef,0x30,0x00,0x00,0x02,0xef,0x40,
+0x7f,0xf6,0x66,0x66,0x60,0x04,0xf5,0x1e,0xff,0xff,0xff,0xfe,0x00,0x01,0x0c,0xfb,
+0x44,0x44,0x4f,0xd8,0xcc,0xc4,0xff,0xa8,0x88,0x60,0xfd,0xaf,0xff,0x12,0xdf,0xff,
+0xfb,0x0f,0xc0,0x0b,0xf1,0x0a,0xf0,0x0f,0xb1,0xfc,0x00,0xbf,0x10,0xaf,0xff,0xfb,
 0x1f,0xb0,0x0b,0xf1,0x0a,0xf8,0x7f,0xb2,0xfa,0x00,0xbf,0x35,0xaf,0x77,0xfb,0x4f,
 0x90,0x0b,0xff,0xeb,0xff,0xff,0xb6,0xf8,0x01,0xff,0xe4,0x8c,0x10,0x00,0x9f,0x60,
-0x4f,0xc1,0x00,0x00,0x3c,0xdf,0xf2,0x68,0x77,0x26,0xef,0xe6,0xd5,0x07,0x00,0x89,
-0x1b,0x70,0x38,0x30,0x02,0xed,0x20,0x09,0xf8,0xfe,0x9b,0x50,0x8f,0xe2,0x01,0xff,
-0x00,0x11,0x67,0x60,0xd1,0x6b,0xed,0xbc,0xfe,0xb1,0x52,0x28,0x02,0x4f,0xee,0x00,
-0xa1,0x65,0x00,0x68,0x02,0x92,0xb0,0x01,0x12,0xfd,0x11,0x00,0x16,0x7f,0xb0,0x32,
-0x1d,0x70,0x1f,0xb0,0x0a,0xaa,0xff,0xaa,0x70,0x7c,0x0b,0x02,0x5f,0xe8,0x12,0xb1,
-0xe6,0x39,0x40,0x1f,0xde,0xcc,0xcc,0x22,0xa2,0x22,0x3f,0xfe,0x02,0xa1,0x22,0xaf,
-0xb1,0x20,0x00,0x13,0x38,0xed,0xa0,0x14,0x10,0xcb,0x2f,0x11,0x08,0x9c,0x07,0xf0,
-0x00,0x04,0xff,0x56,0xaa,0xef,0xca,0xaa,0x70,0x00,0x4f,0x70,0x22,0xdf,0x42,0x32,
-0xb6,0x4f,0x01,0x80,0x05,0x60,0x7c,0xcc,0x00,0x58,0xfc,0x56,0xdd,0x7b,0x83,0x13,
-0x39,0xf9,0x36,0xfa,0x30,0x00,0xbf,0x56,0xe5,0x22,0xaf,0x27,0x59,0x06,0x20,0xaf,
-0x10,0x6f,0x42,0x12,0x20,0x0f,0x56,0x00,0x0e,0x08,0x21,0x8d,0xfd,0x14,0x94,0x21,
-0xcf,0xfd,0x08,0x00,0xb2,0x03,0xff,0x80,0xff,0xaa,0xaa,0xef,0x40,0x00,0xa3,0x00,
-0x20,0x00,0x14,0x21,0x96,0x4a,0x12,0x10,0x98,0x0e,0x40,0x9f,0xd1,0x3f,0xd9,0x4c,
-0xa8,0x41,0x0a,0xe2,0x3f,0x80,0x3f,0x8b,0x91,0x30,0x3f,0xda,0xaa,0xbf,0xb0,0x19,
-0x99,0x60,0x20,0x00,0x13,0x3f,0xda,0xce,0x41,0x03,0x6f,0xa0,0x8f,0x12,0x22,0x60,
-0x2f,0xa0,0x5a,0xab,0xfd,0xaa,0x7a,0x19,0x60,0x11,0x15,0xf9,0x11,0x11,0x00,0x1a,
-0xb2,0x01,0x86,0xfb,0xf1,0x0c,0xa6,0x98,0x9f,0xff,0xb8,0x86,0x00,0x4f,0xff,0x30,
-0x7f,0xef,0xe2,0x00,0x00,0xbf,0xf8,0x3a,0xff,0x27,0xfe,0x82,0x00,0x7e,0x32,0xff,
-0xd3,0xbf,0xb5,0x00,0xbf,0x6d,0x40,0x01,0x60,0x00,0x10,0xf2,0x53,0x10,0x51,0x36,
-0xf9,0x30,0x1f,0xe1,0x03,0x20,0x04,0x50,0xb0,0x08,0xf9,0x09,0xf8,0x5f,0x2b,0x81,
-0x47,0xfb,0x6f,0xf7,0x30,0x00,0x01,0x30,0x6f,0x4e,0xc0,0x1a,0xaa,0x70,0xcf,0x54,
-0x44,0x9f,0x70,0x2f,0xff,0xb0,0xcf,0x92,0x7a,0xb2,0x03,0x5f,0xb0,0xcf,0xa9,0x99,
-0xcf,0x70,0x00,0x2f,0xb0,0x8f,0x4e,0x50,0x2f,0xb0,0x12,0xfd,0x1f,0xc2,0x43,0x50,
-0xc8,0x84,0xfa,0x0f,0xd0,0x99,0x01,0xf7,0x0e,0xc9,0xf6,0x0f,0xd0,0x40,0x00,0x9f,
-0xfb,0x5f,0xf1,0x0f,0xd0,0xf9,0x01,0xef,0x79,0xff,0x50,0x0f,0xfd,0xf7,0x00,0x64,
-0x08,0xd4,0x00,0x09,0xff,0xd1,0x1e,0x46,0x01,0x5f,0x08,0x30,0x0a,0xf8,0x03,0x2d,
-0x26,0x40,0x60,0x02,0xef,0x74,0xc0,0x02,0x80,0x80,0x00,0x3f,0x70,0x45,0x5e,0xf5,
-0x55,0x63,0x0b,0x10,0xdf,0xb8,0x04,0x30,0x58,0x88,0x14,0xed,0x87,0x32,0x50,0xaf,
-0xff,0x25,0x8c,0x41,0x24,0xcf,0x20,0x56,0x96,0x4a,0x20,0xaf,0x20,0xb8,0x02,0x01,
-0x08,0x00,0xa0,0x43,0x33,0xdf,0x00,0x00,0xaf,0x22,0xbf,0xee,0xee,0xb3,0xc6,0xa1,
-0xcb,0xbf,0x32,0x22,0xdf,0x00,0x00,0xdf,0xf8,0xbf,0x8a,0x23,0x60,0xfd,0x30,0xbf,
-0x11,0x7a,0xfe,0x8e,0x48,0x40,0xbf,0x00,0x5f,0xe7,0x07,0x55,0x00,0x18,0x03,0x00,
-0x75,0x7b,0x91,0x78,0x8d,0xf9,0x88,0x20,0x01,0xdf,0xb0,0xdf,0x90,0x01,0x23,0x1d,
-0x50,0x16,0x83,0x10,0x05,0x88,0x00,0x40,0xc0,0x7c,0xcc,0x04,0x7f,0x39,0xf1,0x07,
-0xb0,0x9f,0xff,0x10,0x1e,0x85,0xe7,0x2f,0x70,0x00,0xaf,0x10,0x76,0xed,0xf8,0x2a,
-0x10,0x00,0xaf,0x12,0xde,0x67,0x0f,0x5a,0xa2,0x16,0x9f,0xcc,0xfb,0x99,0x90,0x00,
-0xaf,0x4d,0xff,0x76,0x3c,0xf0,0x04,0xf9,0x11,0xbf,0xa8,0x51,0x10,0x00,0xcf,0xf4,
-0x09,0xfe,0x3d,0xf9,0x00,0x03,0xfe,0x26,0xef,0xe3,0x6d,0x02,0x30,0xb2,0x07,0xf9,
-0xc5,0x02,0x05,0x6a,0x02,0x14,0x20,0xe4,0x7d,0x01,0x4c,0x83,0xf0,0x2c,0x03,0xef,
-0x60,0xfd,0xaa,0xaa,0xaf,0xa0,0x03,0xf7,0x0f,0x90,0x7f,0x00,0xfa,0x00,0x01,0x00,
-0xf9,0xbf,0xff,0x4f,0xa7,0xcc,0xc1,0x0f,0x92,0x9f,0x31,0xfa,0x9f,0xff,0x10,0xf9,
-0xac,0xfa,0x6f,0xa0,0x0b,0xf1,0x1f,0x8b,0xbb,0xb7,0xfa,0x00,0xbf,0x11,0xf7,0x23,
-0x33,0x0f,0xa0,0x0b,0xf1,0x2f,0x6d,0xff,0xf4,0x60,0x03,0xf5,0x12,0xf5,0xd8,0x2f,
-0x4f,0xa0,0x0c,0xfe,0xdf,0x2d,0xa6,0xf4,0xfa,0x01,0xff,0xff,0xe0,0xdf,0xff,0x4f,
-0xa0,0x8f,0xe9,0xf9,0x06,0x30,0x7b,0xf9,0x00,0x81,0x2b,0x10,0x00,0x07,0x4d,0x84,
-0x00,0x0e,0x3b,0x90,0x00,0x04,0x40,0x00,0x08,0xe2,0x00,0x4f,0x90,0xe4,0x17,0xa2,
-0xfe,0x28,0x9e,0xf9,0xaf,0xc9,0x50,0x00,0x7f,0x5e,0xa0,0x5f,0xf2,0x0b,0x03,0x0b,
-0x97,0xf3,0x9f,0x2d,0x60,0x6b,0xbb,0x06,0xfa,0xf3,0x9f,0x9f,0x20,0x8f,0xff,0x58,
-0xbc,0xfa,0xdf,0x9b,0x81,0x00,0xbf,0x8f,0x00,0x15,0x20,0xaf,0x11,0xef,0xf0,0x42,
-0x00,0x00,0xaf,0x12,0x78,0x16,0x50,0xaf,0x13,0xf9,0x33,0x33,0x90,0xab,0x12,0xc6,
-0x10,0x00,0x21,0xdf,0xf7,0x10,0x00,0x50,0x04,0xfd,0x22,0xff,0xee,0x14,0xaa,0x61,
-0x70,0x02,0xfb,0x66,0x66,0xdd,0x6a,0xc3,0x03,0x31,0x0c,0x13,0xd0,0x3d,0x8c,0x02,
-0x93,0xdb,0x51,0x0c,0xfb,0x88,0x8f,0xf8,0xf4,0x69,0x01,0x6f,0xd4,0x13,0x1d,0xd4,
-0xd9,0x70,0x0a,0xdf,0xfa,0xaa,0xaa,0xac,0xfc,0xd0,0x10,0x42,0x03,0x40,0x03,0xfc,
-0x37,0x9b,0x02,0x08,0x00,0x22,0x0f,0xf0,0x08,0x00,0x22,0x4f,0xc0,0x08,0x00,0x21,
-0xcf,0x53,0xb6,0x42,0xf0,0x02,0x3b,0xfd,0x5f,0xf9,0x30,0x00,0x05,0x8c,0xff,0xc1,
-0x05,0xcf,0xfb,0x40,0x0d,0xff,0xb5,0xd7,0xfc,0x37,0xc1,0x02,0x30,0xc0,0xdd,0x12,
-0x73,0x45,0xcd,0x20,0x04,0xf8,0x32,0x6e,0x30,0xaa,0xfa,0x09,0x74,0xbb,0xc0,0xe1,
-0x41,0xea,0x0d,0xfb,0xaa,0xa4,0x09,0xe4,0xf5,0xea,0x3f,0x00,0x0e,0xf0,0x1e,0xe4,
-0xf5,0xea,0xaf,0x40,0x3f,0x60,0x09,0xe4,0xf5,0xed,0xff,0x40,0x6f,0x30,0x09,0xe5,
-0xf5,0xec,0xff,0xa0,0x9f,0x00,0x09,0xe5,0xf4,0xea,0x2b,0xf1,0xec,0x00,0x09,0xe6,
-0xf3,0xea,0x03,0xfb,0xf6,0x00,0x07,0xca,0xf0,0xb7,0x00,0xbf,0x2d,0x71,0xf6,0x0e,
-0xc8,0x50,0x00,0x7f,0xe1,0x00,0x00,0x9f,0x4c,0xe1,0x05,0xff,0xfc,0x10,0x0a,0xfa,
-0x03,0xfa,0x9f,0xe3,0xaf,0xe4,0x0c,0x90,0x00,0x73,0x6c,0x20,0x07,0xad,0x71,0x03,
-0x41,0x7a,0x00,0x6e,0x1b,0x01,0x08,0x00,0x22,0xeb,0xbd,0x08,0x00,0xa0,0x93,0x48,
-0xf1,0x00,0xff,0xbb,0xb5,0x0e,0x9b,0xc8,0xa6,0x3d,0x11,0xf7,0x08,0x00,0x00,0xf2,
-0xd7,0x22,0x9b,0xc8,0x20,0x00,0x04,0x10,0x00,0x31,0x9c,0xc8,0xf8,0xbb,0xaa,0xc0,
-0x9d,0xb8,0xf8,0xfc,0xbb,0xbe,0xf0,0x0d,0x8f,0x86,0xc8,0xf4,0xfb,0x41,0x31,0x4f,
-0x99,0x06,0x08,0x00,0x40,0xce,0x9f,0x46,0xf5,0x9d,0xcf,0x30,0xf4,0x0e,0xd7,0x28,
-0x00,0x89,0x3d,0x40,0x05,0x87,0xfc,0xbb,0xbd,0xe0,0xa4,0x34,0x02,0x08,0x00,0x00,
-0xa3,0x14,0xd1,0xa0,0x0c,0xff,0xff,0xfa,0x4a,0xaa,0xbf,0xa0,0x09,0xbd,0xfc,0xb7,
-0x75,0x0d,0x01,0x20,0x00,0x70,0x2f,0xa0,0x4e,0xef,0xff,0xee,0x5f,0xc7,0x5a,0x92,
-0xbc,0xfe,0xbb,0x5f,0xda,0xaa,0x70,0x02,0x21,0xd5,0xea,0xf3,0x12,0x0c,0xf1,0xfd,
-0x66,0x4f,0x90,0x02,0xa2,0x0d,0xf1,0xff,0xfe,0x4f,0x90,0x03,0xf6,0x0e,0xf3,0xfc,
-0x54,0x3f,0xfb,0xbd,0xf3,0x0e,0xfb,0xfa,0x00,0x09,0xef,0xfe,0x90,0x1f,0xc8,0xac,
-0xc1,0x4f,0x7b,0xff,0xfd,0xdc,0xcc,0xcd,0xd8,0x9f,0x20,0x4a,0xdf,0xee,0x41,0x05,
-0x41,0x07,0x15,0xf6,0x08,0x00,0x00,0x4b,0x2c,0x00,0xfe,0x43,0xc0,0x9b,0xfc,0x9d,
-0xf1,0x07,0xbd,0xfd,0xb7,0x09,0xf3,0x0c,0xf0,0x18,0x00,0xf1,0x07,0x2f,0xd1,0x1e,
-0xf0,0x1d,0xde,0xfe,0xdd,0xef,0x4a,0xff,0xb0,0x0c,0xcc,0xfe,0xcb,0x83,0x03,0x75,
-0x00,0x03,0x51,0x4e,0x5d,0xf2,0x0c,0xc0,0x09,0xf2,0xfc,0x75,0x9f,0xa9,0x9f,0xc0,
-0x0a,0xf2,0xff,0xfb,0x9f,0x30,0x1f,0xc0,0x0b,0xf7,0xfa,0x21,0x9f,0x97,0x8f,0xc0,
-0x0c,0xfe,0x20,0x00,0x13,0x0e,0x80,0x00,0x40,0x2f,0x88,0xff,0xfe,0x80,0x00,0x31,
-0x4f,0x40,0x3a,0x80,0x00,0x18,0x02,0x91,0x69,0x00,0x28,0x04,0x20,0x3f,0xfc,0x2e,
-0x3d,0x03,0xa4,0x47,0x08,0x08,0x00,0x01,0x6a,0xa5,0x06,0x28,0x00,0x04,0x57,0x9d,
-0x42,0x0a,0xf3,0x0d,0xf2,0xc6,0x96,0x11,0x0d,0x20,0x04,0x40,0x2f,0xf4,0x0d,0xfb,
-0xff,0x55,0x32,0x7f,0xfe,0x1d,0x92,0xc7,0x11,0x6f,0xf8,0xa1,0xa1,0x0d,0xf8,0x05,
-0xef,0xff,0xed,0xdd,0xd4,0x07,0xb0,0x32,0x10,0x04,0x31,0x0d,0x00,0xf0,0x01,0x10,
-0xb9,0xf0,0x00,0xc1,0x0e,0xd9,0x9f,0xb9,0xfe,0xdd,0xdd,0xd2,0x0e,0xa0,0x0f,0xb9,
-0xeb,0x31,0x46,0xb2,0x2f,0xb9,0xf4,0x20,0x00,0xf2,0x06,0x10,0x06,0x6d,0xf7,0x59,
-0xfc,0xbb,0xef,0x10,0x04,0x2a,0xf0,0x09,0xf3,0x00,0xaf,0x10,0x0f,0x9a,0xfd,0xa9,
-0x08,0x00,0x20,0xfc,0x99,0x20,0x00,0xd0,0x0f,0x9a,0xf0,0x09,0xfd,0xcc,0xcc,0x10,
-0x0f,0x9a,0xf4,0x69,0xf3,0x3f,0x0a,0x41,0xcd,0xff,0xf9,0xf4,0xec,0x37,0x20,0xd8,
-0x39,0x99,0x0c,0x40,0x5a,0x61,0x00,0x07,0xce,0xec,0x13,0x0e,0x87,0x58,0xf0,0x08,
-0x0e,0xd9,0x9f,0xbb,0xfb,0xaa,0xbf,0xa0,0x0e,0xa0,0x0f,0xbb,0xf2,0x00,0x1f,0xa0,
-0x0e,0xb0,0x0f,0xbb,0xfe,0xee,0xef,0x1b,0x2f,0x90,0xbb,0xfc,0xbb,0xbf,0xa0,0x07,
-0x8d,0xf8,0x6b,0x18,0x00,0x21,0x06,0x3a,0x10,0xd0,0xf0,0x08,0xa0,0x0f,0x8a,0xff,
-0xab,0xf8,0xde,0x77,0x70,0x0f,0x8a,0xfb,0x7b,0xf2,0x8f,0x3b,0xe2,0x0f,0x8a,0xf0,
-0x0b,0xf2,0x3f,0x18,0x00,0xf3,0x0f,0xf1,0x3b,0xf2,0x0c,0xf8,0x00,0x0f,0xbd,0xff,
-0xcb,0xf4,0x58,0xfe,0x20,0x9f,0xff,0xd9,0x6f,0xff,0xf7,0x9f,0xe4,0x5a,0x62,0x00,
-0x2f,0xfb,0x61,0x0a,0xe1,0x5d,0x03,0x01,0xd4,0x04,0x00,0x1b,0x9a,0x10,0x0b,0x52,
-0x47,0x10,0xf2,0x7f,0xa2,0xf1,0x31,0x9f,0xc0,0x6f,0xff,0xff,0x90,0x0b,0xe0,0x0e,
-0xc1,0xef,0x99,0xdf,0x60,0x0b,0xf1,0x1f,0xca,0xff,0x61,0xff,0x10,0x0b,0xff,0xff,
-0xef,0xee,0xfb,0xf7,0x00,0x06,0x8c,0xfa,0x72,0x34,0xff,0xd0,0x00,0x05,0x47,0xf3,
-0x00,0x1b,0xff,0xf8,0x00,0x0d,0xb7,0xfc,0xb8,0xff,0xa4,0xdf,0xf8,0x0d,0xb7,0xfe,
-0xde,0xfd,0x88,0x9f,0xf3,0x0d,0xb7,0x65,0x7b,0xb0,0xb0,0x0d,0xb7,0xf3,0x41,0xfb,
-0x00,0x2f,0xb0,0x0d,0xdb,0xea,0x04,0x60,0x1f,0xb0,0x7f,0xff,0xfd,0x92,0x93,0xc8,
-0x20,0x4c,0x84,0xbe,0xbd,0x02,0xbf,0x93,0x72,0xce,0x4f,0x80,0x00,0x0e,0xff,0xfe,
-0x08,0x00,0xf0,0x51,0xd9,0xde,0x33,0xce,0x4f,0x86,0x40,0x0e,0xa0,0xaf,0xfc,0xce,
-0x4f,0x8e,0xf1,0x0e,0xa0,0xae,0x9f,0xfe,0x4f,0xcf,0x90,0x0e,0xff,0xfe,0x3f,0xfe,
-0x4f,0xff,0x20,0x07,0x8f,0xc7,0x09,0xde,0x4f,0xb6,0x00,0x07,0x3f,0x80,0x00,0xce,
-0x4f,0xb1,0x00,0x0e,0x6f,0xff,0x17,0xfd,0x4f,0xfd,0x20,0x0e,0x6f,0xdd,0xef,0xfc,
-0x4f,0xdf,0xe3,0x0e,0x6f,0x82,0xf9,0xf9,0x4f,0x85,0xc0,0x0e,0x6f,0xb8,0x47,0xf5,
-0x4f,0x80,0x20,0x4f,0xef,0xff,0x6d,0xe0,0x4f,0x82,0xf5,0x8f,0xd9,0x52,0xcf,0x70,
-0x2f,0xec,0xf4,0x11,0x1c,0x28,0x39,0x0b,0xff,0xb0,0x16,0x8a,0x21,0x83,0x00,0x80,
-0x00,0x10,0x06,0x9c,0x35,0xb0,0xd9,0xee,0x4a,0xab,0xff,0xaa,0xa2,0x0e,0xa0,0xce,
-0x6f,0x30,0x05,0x40,0x0e,0xb3,0xde,0x6f,0xca,0xb0,0xb1,0x0e,0xff,0xfe,0x26,0xca,
-0xaa,0xab,0x61,0x05,0x5e,0xa5,0x56,0x6e,0x23,0x07,0x3d,0x42,0x9b,0x30,0x7d,0xff,
-0x8d,0xfe,0x4c,0xf0,0x1b,0x0f,0x7d,0xc9,0x7c,0xcc,0xff,0xcc,0xc4,0x0f,0x7d,0x70,
-0x03,0x72,0xcf,0x16,0x00,0x0f,0x7d,0xcb,0x2d,0xf4,0xcf,0x5f,0x80,0x4f,0xff,0xfd,
-0xdf,0x90,0xcf,0x0c,0xf2,0x7f,0xc7,0x21,0xbc,0x49,0xfe,0x04,0xe5,0x12,0x00,0xa1,
-0x49,0x0a,0x23,0xbf,0x18,0x61,0x1c,0xe4,0x13,0x0c,0xad,0xc0,0x22,0x0c,0xfa,0xc6,
-0xc0,0x50,0x0c,0xf8,0x88,0x88,0x8f,0x08,0x00,0x00,0xcc,0x3b,0xc3,0xc3,0x30,0x00,
-0x0c,0xf3,0x22,0x22,0x3f,0xdd,0xf2,0x00,0x0c,0x90,0x15,0x80,0x0c,0xf4,0x22,0x22,
-0x4f,0xfa,0x00,0x07,0x1d,0x3d,0x10,0xcf,0xac,0x0d,0x02,0x40,0x00,0x00,0xd3,0x1e,
-0x20,0xfe,0x7f,0xce,0x77,0x20,0x6c,0xff,0xd2,0x86,0x00,0x8f,0xff,0x99,0xcd,0xdf,
-0xa0,0x00,0x07,0xfa,0x40,0x00,0x9f,0x78,0x9f,0x02,0xe6,0x3b,0x00,0x02,0x11,0x02,
-0x7b,0x45,0x11,0x1e,0x2c,0xbb,0x04,0x2a,0xac,0x40,0x0a,0xbc,0xff,0xcc,0xcb,0xfc,
-0x00,0xa9,0xfb,0x02,0xde,0xfa,0x12,0xf2,0x08,0x00,0x10,0xdf,0x31,0x42,0x16,0xca,
-0x08,0x16,0x15,0x11,0xdf,0xc5,0x01,0x08,0x00,0x04,0x5b,0x31,0x21,0x2c,0xcc,0xba,
-0xdb,0x16,0xc2,0x28,0xfd,0x03,0x08,0x00,0x61,0x05,0x30,0x00,0x00,0x25,0x20,0xa8,
-0x0f,0x00,0xc7,0x0a,0x70,0x1c,0xcf,0xec,0xc4,0xcc,0xff,0xdc,0x40,0x66,0x12,0xf5,
-0x45,0x94,0x11,0x85,0xb2,0x27,0xa1,0x01,0xfb,0xfa,0x0c,0xce,0xfe,0xcc,0xc8,0x06,
-0xf5,0xeb,0x2f,0x70,0xfa,0x0e,0xfe,0xff,0xb0,0x2f,0xc0,0x32,0xae,0x60,0xff,0xb0,
-0x7f,0xed,0xdd,0xa1,0x74,0x5a,0x10,0xcf,0x0c,0x3d,0x60,0x37,0xfe,0xb5,0x00,0x03,
-0xfe,0x95,0x73,0xc2,0xc4,0x4f,0x9e,0xf3,0x00,0x09,0x76,0xfa,0x00,0x2b,0xff,0xb0,
-0x9c,0x5a,0x31,0x5e,0xfc,0x10,0x08,0x00,0x27,0x01,0xb9,0x12,0x2c,0x11,0x30,0xf9,
-0x3f,0x00,0xcd,0x18,0xb0,0x04,0xff,0x30,0x00,0x1c,0xdf,0xec,0xa0,0x0c,0xff,0xc0,
-0x30,0x15,0xf0,0x0d,0xc0,0x7f,0xcb,0xf6,0x00,0x00,0xde,0x83,0x03,0xff,0x32,0xff,
-0x40,0x01,0xfb,0xf5,0x3f,0xf6,0x00,0x6f,0xf4,0x07,0xf6,0xf5,0xaf,0xe8,0x00,0x08,
-0xa2,0x54,0xb0,0xc6,0xdf,0x11,0xb5,0x40,0x0b,0xcd,0xfd,0x90,0xcf,0x6e,0x5f,0x47,
-0x32,0xf5,0x00,0xcf,0xa5,0x99,0x31,0xd0,0xcf,0xa2,0xca,0x34,0x80,0xe0,0xcf,0x10,
-0x07,0x80,0x0c,0x99,0xf6,0x83,0x98,0x10,0xf1,0x20,0x00,0x40,0xbf,0xdb,0xcf,0xe0,
-0x08,0x00,0x71,0x3c,0xef,0xfd,0x40,0x00,0x0e,0x90,0x59,0x95,0x31,0x01,0x3f,0xb1,
-0x7c,0xe9,0x00,0x32,0x4a,0x00,0x08,0x00,0x41,0x1e,0xff,0xee,0xd0,0x71,0xfb,0x31,
-0xce,0x85,0x08,0xfa,0x2b,0xf0,0x04,0xf9,0xfa,0x08,0xfa,0xdf,0xae,0xf1,0x07,0xf3,
-0xfa,0x08,0xf1,0xaf,0x1b,0xf1,0x0e,0xfe,0xff,0xd8,0x08,0x00,0xc1,0x0b,0xdd,0xff,
-0xc8,0xfc,0xef,0xce,0xf1,0x00,0x00,0xfa,0x08,0x28,0x01,0x60,0x24,0xfd,0xb8,0xf1,
-0xaf,0x1b,0x96,0xd7,0x10,0xf9,0x08,0x00,0x31,0x0f,0xc9,0xfb,0x30,0x00,0x04,0x20,
-0x00,0x00,0x08,0x00,0x11,0xfa,0xbe,0x93,0x0c,0x2b,0x29,0xf4,0x0f,0x9f,0x30,0x05,
-0xf7,0x48,0x00,0x03,0xcc,0xef,0xdc,0xa5,0xf8,0xcf,0x60,0x03,0xdd,0xff,0xed,0xb5,
-0xf8,0x1f,0xe0,0x01,0x11,0xaf,0x41,0x16,0xf8,0x16,0x40,0x88,0x11,0xf0,0x02,0x06,
-0x6a,0xf9,0x66,0x68,0xfb,0x66,0x62,0x05,0x6c,0xf9,0x66,0x64,0xfa,0x0c,0x70,0x0d,
-0xf5,0x10,0xf1,0x03,0xfb,0x4f,0x90,0x01,0xcf,0x3e,0xd1,0x10,0xfd,0xaf,0x30,0x07,
-0xfe,0x9f,0xf9,0x90,0xdf,0xfd,0x10,0x16,0x30,0xf0,0xaf,0xf5,0x12,0x05,0x70,0xe3,
-0x52,0x7f,0xc0,0x81,0x0c,0xef,0x1f,0x4a,0xa0,0xd0,0xe9,0x08,0x98,0x6f,0xe3,0x7f,
-0xfb,0xfe,0xf5,0x91,0x20,0x46,0x5e,0x30,0x8d,0xa0,0xb0,0x11,0x52,0x70,0x00,0x00,
-0x8a,0x00,0x14,0xa2,0x11,0xcf,0xa0,0x6c,0x91,0xc7,0xaa,0xcf,0xba,0xa4,0x1b,0xef,
-0xcb,0x9b,0xf0,0x0b,0x70,0xdd,0x85,0x00,0x2d,0x70,0x5c,0x20,0xa4,0x4b,0xf0,0x0d,
-0x9f,0x40,0x4f,0xa0,0x08,0xf2,0xfa,0x04,0xfc,0x00,0x0b,0xf3,0x0f,0xff,0xff,0xcd,
-0xfa,0x20,0x58,0xfb,0x0a,0xcb,0xfe,0xa3,0xbf,0xa0,0xfe,0x72,0x8f,0x70,0xb0,0x0c,
-0xf9,0xf6,0x00,0x02,0x46,0xfe,0xb1,0x04,0xff,0xe0,0x80,0x01,0x10,0xe1,0x55,0xc4,
-0x51,0x09,0x75,0xfa,0x00,0x2d,0x66,0x73,0x60,0xfa,0x09,0xff,0x71,0xcf,0xf6,0x08,
-0x00,0x46,0xc3,0x00,0x06,0xc0,0x92,0xe5,0x14,0x20,0x08,0x66,0x10,0x05,0x31,0x03,
-0xc1,0x1b,0xcf,0xeb,0x95,0xfa,0x55,0x6f,0xc0,0x1c,0xef,0xcc,0xa5,0x41,0x03,0x30,
-0xde,0x85,0x02,0xac,0x33,0x40,0x02,0xf9,0xfa,0x2f,0x78,0x02,0xf1,0x05,0x08,0xf4,
-0xfa,0x1c,0xfd,0xbb,0xcf,0xe7,0x0f,0xff,0xff,0x93,0xfb,0x55,0x7f,0x90,0x0a,0xcc,
-0xfe,0x73,0x80,0x16,0xb2,0x01,0xfa,0x03,0xf9,0x22,0x4f,0x90,0x01,0x36,0xfe,0xb3,
-0xdc,0xba,0xd0,0xff,0xc3,0xfa,0x23,0x5f,0xa3,0x0a,0x75,0xfa,0x4c,0xff,0xef,0xff,
-0xf9,0x64,0x61,0x3c,0xba,0x97,0x8f,0xb2,0x00,0xed,0xea,0x16,0x2f,0x10,0x10,0x22,
-0x68,0x00,0xe0,0x3e,0x11,0xbf,0x47,0xe6,0x00,0xd0,0x19,0xf1,0x01,0x02,0xcf,0xbe,
-0xf5,0x00,0x3c,0xfd,0xbd,0x9f,0xf8,0x02,0xdf,0xc4,0x04,0xf8,0x62,0xf8,0x0c,0xf1,
-0x24,0x08,0xfb,0xe0,0x24,0x88,0x88,0x88,0x10,0x0d,0xaa,0xe0,0x4a,0xaa,0xa2,0x24,
-0xd2,0x4f,0xff,0xfe,0x7f,0xde,0xf7,0xf5,0xf2,0x1d,0xce,0xfb,0x7f,0x69,0xf7,0xf5,
-0xf2,0x00,0x0a,0xe0,0x7f,0xff,0xf7,0xf5,0xf2,0x03,0x6d,0xff,0x7f,0x47,0xf7,0xf5,
-0xf2,0x4f,0xff,0xfa,0x10,0x00,0x71,0x09,0x5b,0xe0,0x7f,0x37,0xf5,0xa5,0x20,0x00,
-0x31,0x4a,0xf2,0x8b,0x08,0x00,0x4e,0x5f,0xb0,0xce,0x90,0x17,0xf9,0x13,0xc1,0xdf,
-0xd0,0x23,0xcf,0xb0,0xa4,0xce,0x32,0xef,0x70,0x00,0x3f,0xd5,0xa5,0xf4,0x9e,0xef,
-0xfe,0xee,0xeb,0x00,0x00,0x02,0x0a,0x54,0x04,0xa0,0x2f,0xd0,0x03,0xfb,0x00,0xaf,
-0xff,0x10,0x05,0xfa,0x63,0x2b,0x70,0xcf,0xf1,0x00,0x9f,0x60,0x04,0xfa,0x24,0x19,
-0x20,0x0e,0xf1,0xef,0x8a,0x41,0x0d,0xf1,0x07,0xfb,0x5f,0x10,0xd0,0xdf,0x14,0xff,
-0x22,0x22,0xcf,0x50,0x00,0x0d,0xf1,0xef,0x60,0x7f,0x87,0x71,0xf1,0x05,0xff,0xa7,
-0x70,0x02,0xbb,0xa3,0x00,0x0b,0xfe,0xdf,0xff,0xed,0xdd,0xde,0xff,0x60,0x6e,0x20,
-0x49,0xdf,0x04,0xb9,0x14,0x10,0x99,0x02,0x12,0x40,0xd0,0x8e,0x21,0x08,0xf8,0x08,
-0x00,0x00,0x49,0x1e,0x02,0xe0,0x8e,0x20,0x5f,0xc5,0x10,0x8f,0x44,0xc2,0x00,0x07,
-0x17,0x25,0x38,0x10,0x02,0x18,0x00,0x60,0x0b,0xbb,0x70,0xcf,0x20,0x0b,0x99,0x69,
-0x41,0xa0,0x5f,0xd0,0x0b,0xdf,0xc9,0x22,0x09,0xf7,0x08,0x00,0x32,0x01,0x60,0x0b,
-0xef,0xc9,0x20,0x37,0x7d,0xa6,0xf0,0x00,0xb2,0x82,0xd0,0xd0,0x00,0x08,0xff,0xfb,
-0x50,0x07,0x64,0x00,0x22,0x3f,0xf5,0xaf,0x0c,0x28,0x9d,0xf5,0x09,0x60,0x03,0x9d,
-0xef,0xff,0xfe,0xd1,0xfe,0x4b,0x22,0xc2,0x01,0x5f,0x4f,0x20,0xff,0x41,0x41,0x10,
-0x06,0x46,0x89,0x14,0x02,0xb1,0xfb,0x11,0x3f,0xc1,0x0c,0xf0,0x00,0xaf,0xff,0x49,
-0x9c,0xfe,0x99,0xa9,0x90,0x7b,0xef,0x20,0x0c,0xf6,0x1a,0x80,0xc1,0x0c,0x20,0x4f,
-0xc0,0x6b,0x08,0x50,0xaf,0x21,0xdf,0x42,0x49,0x72,0x44,0x12,0x2a,0x14,0x39,0xb0,
-0xbf,0x34,0xeb,0x98,0x65,0x5f,0x90,0x06,0xff,0xe6,0x10,0x89,0x11,0x20,0x7f,0xfc,
-0x7f,0xa3,0x73,0xef,0xf3,0x3f,0x40,0x28,0xdf,0xff,0x00,0xa3,0x18,0x01,0x2a,0xe8,
-0x60,0xe5,0x00,0x01,0xfc,0x0d,0xf1,0x00,0x01,0x01,0x08,0x00,0xb4,0x00,0x3f,0xc3,
-0xcd,0xff,0xcf,0xfd,0xb0,0x00,0x03,0x03,0x45,0xb9,0x10,0x02,0x18,0x00,0x31,0x0c,
-0xcc,0x80,0x20,0x00,0xb2,0x0f,0xff,0xa5,0xcc,0xff,0xcf,0xfc,0xc2,0x00,0x3f,0xa6,
-0x20,0x01,0x51,0x3f,0xa0,0x0b,0xf5,0x0d,0x2f,0xf5,0x22,0x3f,0xf0,0x08,0x00,0x20,
-0xef,0x70,0x50,0x00,0xf1,0x02,0xdf,0xe6,0x4a,0x00,0x0a,0xc0,0x00,0x2f,0xf8,0xcf,
-0xfd,0xcb,0xbb,0xcd,0xe6,0x0b,0x70,0x03,0xe0,0x27,0xe2,0x01,0xb9,0x0f,0x13,0x61,
-0x83,0x01,0x10,0xf9,0x18,0x02,0x00,0x8a,0x8e,0x01,0xd1,0x0e,0xf1,0x0a,0x5a,0xcf,
-0xea,0xaa,0xaa,0x70,0x00,0x02,0x00,0xaf,0x46,0xc6,0x00,0x00,0x24,0x44,0x05,0xfe,
-0x49,0xf9,0x33,0x00,0x8f,0xff,0x1a,0x5f,0x56,0x70,0x47,0xdf,0x14,0x98,0x8b,0xfc,
-0x88,0x99,0x12,0x02,0x59,0x12,0x13,0xbf,0x66,0xf0,0x61,0xbf,0x2b,0xbb,0xbd,0xfd,
-0xbb,0xb8,0xf6,0x00,0xc8,0x13,0x50,0x1b,0xff,0xc5,0x10,0x07,0x11,0x45,0x20,0xca,
-0xff,0xa2,0x69,0x3b,0xf4,0x4e,0x10,0x00,0x01,0x14,0x50,0x58,0x5c,0x21,0x00,0x1f,
-0xde,0x17,0x40,0xdf,0x70,0x1f,0xfc,0x40,0xcc,0x00,0x70,0xd9,0x01,0x91,0x36,0x12,
-0x00,0x08,0x00,0x02,0x2e,0x3a,0xf0,0x01,0xd0,0x1c,0xcc,0x80,0x4f,0xfe,0xee,0xee,
-0xc0,0x1f,0xff,0xa0,0x5f,0xb0,0xac,0x10,0xe8,0x00,0x40,0x8f,0x80,0xaf,0xd1,0x08,
-0x00,0x80,0xdf,0x50,0x0b,0xfd,0x10,0x00,0x3f,0xa7,0x01,0xd5,0xf2,0x0e,0xc0,0x00,
-0x4f,0xa9,0xf8,0x00,0x00,0x1e,0xc1,0x05,0xff,0xf9,0x70,0x00,0x00,0x02,0x01,0x2f,
-0xf7,0xbf,0xfe,0xdc,0xcd,0xef,0xf9,0x0a,0x70,0x04,0x9e,0x6c,0x29,0x0b,0x01,0x00,
-0x10,0x20,0xdf,0x23,0x11,0xa7,0xa6,0x5a,0x60,0x0c,0xf3,0xff,0x40,0x06,0xfe,0x3d,
-0x0b,0xc1,0x5f,0x70,0x00,0xaf,0x98,0xbb,0xbf,0xfb,0xbe,0xb1,0x00,0x1c,0xae,0xbc,
-0x02,0x2a,0x03,0x50,0xfc,0x10,0x00,0x1c,0xcc,0xe8,0x1b,0x10,0xb0,0x15,0x15,0x31,
-0x0e,0xfd,0xfc,0xbe,0x9e,0xf0,0x0c,0x8f,0x7c,0xf2,0xcf,0x70,0x00,0x1f,0xb6,0xfd,
-0x0c,0xf1,0x1e,0xf1,0x00,0x1f,0xb9,0xe1,0x0c,0xf1,0x04,0x50,0x00,0x4f,0xd0,0x10,
-0x0c,0xf1,0x39,0x1b,0x01,0x7c,0x40,0xe0,0x22,0x2f,0xfa,0xbf,0xfe,0xcb,0xbc,0xcf,
-0xf5,0x0b,0x70,0x03,0x8d,0xef,0x03,0xaa,0x0b,0x01,0x00,0x32,0x09,0xa0,0x01,0xb0,
-0xdb,0xf2,0x02,0xfa,0x01,0xfe,0x88,0x88,0xfc,0x00,0x01,0xdf,0x41,0xfe,0x66,0x67,
-0xfc,0x00,0x00,0x36,0x18,0x00,0x00,0x48,0x07,0x72,0x22,0x23,0xfc,0x00,0x6d,0xdd,
-0x21,0xa5,0x87,0xd0,0xff,0x21,0xfe,0x58,0x95,0x8e,0x30,0x00,0xaf,0x21,0xfd,0x0d,
-0xf9,0xb6,0x95,0x40,0x21,0xfd,0x01,0xcf,0xe0,0x66,0x42,0x25,0xff,0xbe,0x4a,0x90,
-0x02,0x80,0xeb,0x20,0x9f,0x70,0x04,0xef,0xc6,0x72,0x25,0x25,0xd7,0x7f,0xfa,0xef,
-0xfb,0xa9,0xaa,0xbc,0xd4,0x4e,0x30,0x06,0xbe,0xff,0x88,0xa5,0x00,0xba,0x5b,0x00,
-0x53,0x10,0x70,0x0a,0x50,0x00,0xdf,0x60,0x0c,0xf4,0xb2,0xea,0x82,0x4f,0xd0,0x3f,
-0xa0,0x00,0x03,0xff,0x7f,0x28,0x5e,0x20,0x53,0x3a,0x52,0x6e,0x00,0x4f,0x13,0xf1,
-0x01,0xa0,0x1f,0xd0,0x7b,0x10,0x6b,0xbb,0x0a,0xf1,0x1f,0xd0,0xbf,0x20,0x8f,0xff,
-0x1a,0x08,0x00,0x70,0x00,0xbf,0x1a,0xfb,0xbf,0xfa,0xef,0x08,0x00,0x13,0xff,0x6e,
-0xf0,0x00,0x18,0x79,0x00,0xc1,0x12,0x21,0x4c,0xfb,0xa4,0xbe,0x11,0xb6,0x03,0xc8,
-0xc1,0x6f,0xe8,0xef,0xfd,0xba,0xab,0xcd,0xe0,0x2e,0x20,0x06,0xbe,0xcd,0x44,0x05,
-0xfb,0xb7,0x20,0x00,0x33,0x28,0x01,0x60,0x2e,0xe2,0x00,0xcf,0x2c,0xf1,0xf8,0x08,
-0x92,0x02,0xff,0x8e,0xf9,0x88,0x30,0x00,0xde,0x3b,0x50,0x03,0x32,0x22,0x2f,0xd1,
-0xda,0x0b,0x91,0x05,0x63,0x3d,0xf4,0x33,0x30,0x49,0x99,0x3f,0xb9,0x0f,0x90,0x7f,
-0xff,0x20,0x0a,0xf4,0x9f,0x40,0x00,0x12,0xe6,0x2e,0x20,0x9f,0x40,0x90,0x03,0x50,
-0x5f,0xc0,0x9f,0x45,0x60,0x00,0x01,0xf1,0x11,0x40,0x9f,0x58,0xf3,0x00,0xaf,0x5f,
-0xf7,0x00,0x7f,0xff,0xf0,0x00,0xcf,0xdc,0x50,0x00,0x19,0xba,0x50,0x4e,0xf9,0xaf,
-0xfd,0xcb,0xbc,0xcd,0xe1,0x1e,0x60,0x04,0xae,0x6e,0x82,0x09,0x61,0xbd,0x00,0xd1,
-0xad,0x11,0x01,0xe1,0x11,0x70,0x2e,0xf9,0x00,0x78,0xc7,0x8e,0xfc,0x76,0xa0,0x20,
-0x09,0xfe,0x3e,0x14,0x70,0x18,0x02,0x99,0xcf,0xff,0xb9,0x70,0x33,0x48,0xf0,0x0b,
-0xae,0xfa,0xaf,0xb0,0x7a,0xaa,0x23,0xfc,0x8e,0xf8,0x9f,0xb0,0xaf,0xff,0x23,0xfe,
-0xcf,0xfc,0xdf,0xb0,0x01,0xaf,0x23,0xfb,0x4d,0xf4,0xc8,0xb1,0x01,0x88,0x6a,0x00,
-0x08,0x00,0xb0,0xf9,0x0c,0xe0,0x2f,0xb0,0x00,0xaf,0x33,0xf8,0x0c,0xe7,0xb0,0x69,
-0xf1,0x02,0xc5,0x74,0x05,0x51,0x86,0x00,0x8f,0xc5,0xdf,0xda,0x98,0x99,0xab,0xd5,
-0x2e,0x10,0x06,0x23,0x31,0x05,0x80,0x00,0x12,0x10,0xf8,0xd9,0x22,0x06,0xf3,0x08,
-0x00,0x32,0x0a,0xfe,0x2a,0x69,0x18,0x20,0xaf,0xb5,0xe0,0x68,0x93,0x82,0x00,0x0a,
-0x11,0x88,0x8e,0xf8,0x88,0x60,0xb2,0x72,0xd2,0xc0,0x1b,0xbb,0x83,0xf8,0x0c,0xf1,
-0x0f,0xc0,0x1c,0xdf,0xb3,0xff,0xa8,0xab,0xa2,0xb1,0x77,0xef,0xff,0x97,0x60,0x00,
-0x1f,0xb0,0x0b,0x83,0x2a,0xf0,0x13,0xb7,0xef,0x6c,0xf2,0xaf,0xd1,0x00,0x2f,0xc6,
-0xd4,0x0c,0xf1,0x06,0x80,0x03,0xef,0xfc,0x40,0x04,0x50,0x00,0x01,0x2f,0xfb,0xbf,
-0xfe,0xba,0xab,0xbd,0xf9,0x0c,0x80,0x03,0x8d,0x08,0x03,0x1c,0x01,0x80,0x02,0x22,
-0xc1,0x0a,0x06,0xf1,0xf2,0x02,0xfc,0x0a,0xf7,0xfa,0xaf,0x7f,0xa0,0x00,0xbf,0x5a,
-0xe0,0xf5,0x5e,0x0f,0xa0,0x00,0x15,0x18,0x00,0xf2,0x05,0x13,0x33,0x04,0x79,0xfe,
-0x77,0x77,0x40,0x8f,0xff,0x20,0x0c,0xfc,0x88,0x85,0x00,0x47,0xdf,0x21,0xbf,0x51,
-0x10,0x21,0x4e,0xf9,0xa0,0xfb,0x60,0xaf,0x25,0x58,0xfc,0xaf,0xa0,0x88,0x01,0x01,
-0x81,0xda,0x60,0x00,0xbf,0x24,0xbf,0xfd,0x40,0x50,0xbe,0x21,0xc7,0xfa,0xb1,0xd7,
-0xb1,0xba,0xff,0xfd,0xcb,0xcc,0xde,0xf2,0x5d,0x00,0x39,0xdf,0xd5,0xef,0x06,0x80,
-0x01,0x40,0x05,0x40,0x02,0x40,0xee,0xd2,0x10,0x2f,0x1f,0xde,0xb2,0x09,0xfc,0x07,
-0x9e,0xe9,0x9f,0xe9,0x92,0x00,0xbf,0x8b,0xe0,0x04,0x64,0x18,0x00,0x11,0x3f,0xc1,
-0x11,0x41,0x7a,0xd2,0x10,0x0d,0xdd,0x90,0xbf,0x42,0x22,0xdf,0x10,0x0e,0xef,0xa0,
-0xbf,0x73,0xb3,0x10,0xa0,0x49,0x12,0x01,0x08,0x00,0x2a,0xfe,0xee,0x10,0x00,0x10,
-0xff,0x4c,0xca,0x21,0xaf,0xf7,0x79,0x12,0xc1,0x1d,0xfc,0xdf,0xfc,0xa9,0x9a,0xab,
-0xd6,0x0c,0x90,0x04,0xae,0x80,0xac,0x06,0x22,0x09,0xf0,0x0c,0x12,0x34,0x69,0xc6,
-0x00,0x0a,0xc1,0x3f,0xff,0xff,0xfd,0xb8,0x10,0x0a,0xfe,0x27,0xa3,0x5b,0x10,0xd9,
-0x00,0x00,0x9f,0x79,0xf4,0x3f,0x76,0xde,0x7b,0xa0,0x02,0xfb,0x0b,0x59,0xd0,0x00,
-0x13,0x33,0x02,0xff,0x0d,0xf1,0x30,0x6f,0xff,0x4d,0x53,0x79,0xc3,0x00,0x4a,0xef,
-0x5f,0x83,0x4f,0xc3,0x33,0x20,0x00,0xaf,0x5f,0x46,0x99,0xa0,0x37,0x94,0x4f,0xc3,
-0x79,0x40,0x00,0xaf,0x29,0xf2,0x69,0xa2,0x03,0xef,0xf7,0x50,0x20,0x05,0xef,0xca,
-0x98,0xd1,0x07,0xf5,0x02,0x6f,0xe9,0xef,0xfc,0xcb,0xcc,0xde,0xf1,0x2e,0x30,0x06,
-0xce,0xff,0xff,0xfe,0xb0,0x01,0x75,0x51,0x14,0xa7,0xc3,0xb5,0x00,0xe2,0x01,0x90,
-0xc1,0x0a,0xcc,0xff,0xcc,0xa3,0xfd,0xbf,0xf4,0x79,0x09,0xf1,0x0c,0xc3,0xf6,0x0f,
-0xd0,0x00,0xcd,0x00,0xde,0x13,0xf6,0x5f,0x70,0x00,0x9f,0x43,0xfa,0x03,0xf6,0xaf,
-0x10,0x3a,0xcf,0xbd,0xfc,0xa5,0xf6,0xfc,0xc1,0x16,0x32,0xf6,0xf6,0x8f,0xb9,0x2e,
-0xb0,0xf6,0x0e,0xd0,0x05,0xaa,0xaa,0xaa,0x53,0xf6,0x0b,0xf0,0x06,0x0a,0xf2,0x05,
-0x83,0xf6,0x09,0xf2,0x08,0xf4,0x00,0x5f,0x83,0xf9,0x8f,0xf0,0x08,0xf3,0x00,0x5f,
-0x83,0xf8,0xff,0x80,0x18,0x00,0x10,0x31,0x73,0xd3,0x31,0xbe,0x83,0xf6,0x01,0x17,
-0x00,0xeb,0x92,0xc1,0xe0,0x3a,0xbf,0xcf,0xaa,0x5d,0xdd,0xdf,0xe0,0x00,0x2f,0x5f,
-0x5b,0x94,0x10,0x0f,0xb6,0x1a,0x00,0x08,0x00,0x31,0xce,0xcc,0xeb,0x08,0x00,0x62,
-0x7d,0x67,0xdb,0x5f,0xff,0xff,0x08,0x00,0xf1,0x08,0xda,0xaf,0xe0,0x0f,0xcb,0x4e,
-0xfb,0x5f,0x80,0x09,0x90,0x0f,0x93,0x01,0xdb,0x5f,0x80,0x00,0x00,0x0f,0xa5,0x55,
-0xeb,0x08,0x00,0x00,0xe2,0x31,0x70,0x80,0x02,0x81,0x0f,0x92,0x22,0xdb,0x17,0x20,
-0x00,0x10,0x00,0xc1,0x3f,0xfe,0xef,0xf3,0x0f,0x94,0x44,0xb8,0x08,0xdd,0xdd,0x80,
-0x69,0x01,0x60,0x46,0x92,0x00,0x07,0xab,0xcd,0xa0,0x7e,0x00,0x8e,0x98,0xf0,0x06,
-0xed,0xcb,0x97,0x63,0x00,0x01,0x25,0x00,0x5c,0x30,0x00,0xec,0x10,0x00,0xbf,0x40,
-0x5f,0xb0,0x07,0xfb,0x00,0x0b,0xe8,0x20,0xd0,0x1f,0x94,0xd6,0x50,0xc1,0x0e,0xc0,
-0x7f,0x60,0x2d,0x06,0x36,0x1f,0xf0,0x02,0x09,0x25,0x51,0x1c,0xcc,0xce,0xff,0xff,
-0x90,0x57,0x12,0x5f,0x52,0x2f,0xf0,0x09,0x19,0xff,0x6f,0xf5,0xff,0x91,0x00,0x18,
-0xff,0xe3,0x0f,0xf0,0x3e,0xff,0x81,0x3f,0xfa,0x10,0x0f,0xf0,0x01,0x9f,0xe2,0x04,
-0xf9,0x70,0x00,0x6b,0x7d,0x21,0x00,0x36,0xfe,0x0c,0x40,0x3c,0xef,0xff,0xda,0x00,
-0x07,0xf0,0x2d,0x1a,0x9f,0xd3,0x06,0xfe,0xaa,0xcf,0xc0,0x2b,0x1f,0xb6,0xd1,0x6f,
-0x62,0xef,0x30,0x0e,0x7f,0xbc,0xc0,0x0b,0xfe,0xf5,0x00,0x08,0x6f,0xb9,0x40,0x3b,
-0xff,0xd4,0x00,0x3a,0xaf,0xea,0x9c,0xff,0xba,0xff,0xe6,0x5e,0xff,0xfe,0xbe,0xa2,
-0xef,0x4b,0xf2,0x00,0x9f,0xf5,0x02,0x33,0xff,0x33,0x30,0x03,0xff,0xff,0x78,0x71,
-0x13,0xf1,0x05,0x1e,0xef,0xbb,0xa2,0x44,0xff,0x44,0x20,0x7f,0x6f,0xb0,0x1a,0xaa,
-0xff,0xaa,0xa2,0x1a,0x0f,0xb0,0x2f,0xa8,0x02,0x22,0x0f,0xb0,0x1b,0xe9,0x03,0x08,
-0x00,0x00,0xd2,0x01,0x72,0x23,0x57,0x80,0x00,0x00,0xbe,0xef,0xe0,0x1c,0x56,0x69,
-0x98,0x8f,0xe5,0x32,0xde,0xa1,0x03,0x9c,0xdc,0xf0,0x00,0xe2,0x00,0x36,0x66,0x6f,
-0xe6,0x66,0x64,0x00,0x00,0x8f,0xed,0xdf,0xfd,0xde,0x41,0x20,0x40,0xb8,0x8f,0xf8,
-0x8a,0x08,0x00,0x47,0x96,0x7f,0xf6,0x69,0xf9,0x71,0x40,0x24,0x44,0x5f,0xe4,0xc9,
-0x13,0x02,0xd4,0xda,0x30,0x30,0x00,0x88,0xeb,0x31,0x32,0x88,0x20,0x28,0x89,0x23,
-0x15,0x82,0x4c,0xd9,0x13,0x3f,0xd0,0x29,0x22,0x3f,0xec,0xaa,0x79,0x22,0x3f,0xc5,
-0x99,0x77,0x03,0x18,0x00,0x21,0x16,0x66,0x01,0x00,0x24,0x61,0x3e,0xa7,0x50,0x10,
-0x49,0x00,0x17,0x10,0x95,0x58,0x65,0x40,0x6f,0xf6,0x69,0xf8,0x95,0xc1,0x40,0xef,
-0xfe,0xef,0xf8,0x8e,0x8e,0x30,0x8f,0xf8,0x8b,0x6a,0x7b,0x00,0x60,0x00,0x15,0x85,
-0xf5,0xc0,0x20,0x15,0x66,0xb0,0x00,0x25,0x66,0x51,0x70,0x00,0x06,0x62,0x1d,0x30,
-0x60,0x1d,0x80,0xd5,0x7f,0xb0,0x7f,0x60,0x7f,0xc3,0x33,0x30,0x09,0xf4,0x7f,0x61,
-0xef,0x29,0x29,0xf0,0x07,0xf4,0x7f,0x6b,0xfa,0xad,0x65,0x50,0x09,0xf4,0x7f,0x68,
-0xc0,0xbf,0xc2,0x00,0x07,0xd3,0x6e,0x9d,0xd2,0x05,0xea,0x34,0x3d,0xf6,0x0d,0xfc,
-0xdf,0xa5,0x20,0x00,0x4a,0xef,0xff,0xa4,0x4a,0xff,0xfe,0xb4,0x1f,0xea,0x9f,0xff,
-0xff,0xf8,0x8d,0xe1,0x02,0x00,0x02,0x2f,0xf2,0x20,0x00,0xdc,0xdc,0x60,0x68,0xd7,
-0x7f,0xf7,0x8d,0xa7,0x64,0x34,0xc7,0x0f,0xe0,0x6f,0x80,0x00,0x08,0x8a,0xfb,0x8f,
-0xf8,0xdf,0xa8,0x79,0x24,0x03,0x01,0x00,0x22,0x7c,0x30,0x7a,0xd8,0x21,0xef,0x20,
-0x08,0x00,0x11,0x07,0x1e,0x87,0x10,0x10,0x28,0x12,0x10,0xa0,0x08,0x00,0x21,0x7f,
-0x80,0xdc,0x23,0x00,0x48,0x0f,0x91,0x78,0x88,0xff,0x98,0x82,0x03,0xaf,0xfa,0x7f,
+0x4f,0xc1,0x00,0x00,0x3c,0xdf,0xf2,0x00,0x70,0xb9,0x01,0x15,0xe6,0xf0,0x00,0xf0,
+0x1e,0x20,0x00,0x02,0x70,0x00,0x38,0x30,0x02,0xed,0x20,0x09,0xf8,0x00,0x9f,0x70,
+0x00,0x8f,0xe2,0x01,0xff,0x00,0xff,0x10,0x00,0x08,0xd1,0x6b,0xed,0xbc,0xfe,0xb1,
+0x00,0x00,0x10,0x8f,0xff,0xff,0xff,0xf2,0x2b,0xbb,0x80,0x00,0x01,0xfd,0x68,0x02,
+0xf1,0x0a,0xb0,0x01,0x12,0xfd,0x11,0x00,0x16,0x7f,0xb0,0x0f,0xff,0xff,0xff,0xa0,
+0x00,0x1f,0xb0,0x0a,0xaa,0xff,0xaa,0x70,0x00,0x1f,0xb0,0x20,0x00,0xf1,0x05,0x00,
+0x1f,0xb1,0xef,0xff,0xff,0xff,0xf6,0x00,0x1f,0xde,0xcc,0xcc,0xff,0xcc,0xc5,0x00,
+0x3f,0xfe,0x20,0x18,0x00,0x22,0xaf,0xb1,0x20,0x00,0x22,0x38,0x00,0x08,0x00,0x03,
+0x60,0x03,0x30,0x07,0xf4,0x08,0xca,0x01,0xf0,0x04,0xb0,0x04,0xff,0x56,0xaa,0xef,
+0xca,0xaa,0x70,0x00,0x4f,0x70,0x22,0xdf,0x42,0x32,0x00,0x00,0x02,0xc7,0x02,0xf0,
+0x06,0xfb,0x00,0x7c,0xcc,0x00,0x58,0xfc,0x56,0xfa,0x00,0x9f,0xff,0x13,0x39,0xf9,
+0x36,0xfa,0x30,0x00,0xbf,0x2f,0x30,0x00,0xf1,0x04,0xf4,0x00,0xaf,0x27,0x77,0x77,
+0x77,0x77,0x72,0x00,0xaf,0x10,0x99,0x99,0x99,0x99,0x20,0x00,0xaf,0x70,0x03,0xc1,
+0x40,0x00,0xaf,0x8d,0xfd,0x00,0x00,0xaf,0x40,0x00,0xcf,0xfd,0x08,0x00,0xb2,0x03,
+0xff,0x80,0xff,0xaa,0xaa,0xef,0x40,0x00,0xa3,0x00,0x20,0x00,0x12,0x21,0x78,0x00,
+0x40,0x01,0xed,0x10,0x3f,0x78,0x00,0xf1,0x0c,0x00,0x9f,0xd1,0x3f,0xd9,0x99,0xaf,
+0xb0,0x00,0x0a,0xe2,0x3f,0x80,0x00,0x2f,0xb0,0x00,0x00,0x30,0x3f,0xda,0xaa,0xbf,
+0xb0,0x19,0x99,0x60,0x20,0x00,0x32,0x3f,0xff,0xa0,0x08,0x04,0x30,0x6f,0xa0,0x8f,
+0xa8,0x02,0xf0,0x04,0x00,0x2f,0xa0,0x5a,0xab,0xfd,0xaa,0xa0,0x00,0x2f,0xa0,0x11,
+0x15,0xf9,0x11,0x11,0x00,0x2f,0xa0,0x58,0x00,0xf0,0x28,0xfa,0x00,0x2f,0xa6,0x98,
+0x9f,0xff,0xb8,0x86,0x00,0x4f,0xff,0x30,0x7f,0xef,0xe2,0x00,0x00,0xbf,0xf8,0x3a,
+0xff,0x27,0xfe,0x82,0x00,0x7e,0x32,0xff,0xd3,0x00,0x7f,0xf7,0x00,0x01,0x00,0x55,
+0x00,0x00,0x01,0x60,0x00,0x10,0x00,0x02,0x30,0x00,0x51,0x00,0x01,0xdb,0x00,0x1f,
+0xe1,0x03,0x20,0x04,0xf0,0x22,0xb0,0x08,0xf9,0x09,0xf8,0x00,0x00,0x0c,0xf3,0x47,
+0xfb,0x6f,0xf7,0x30,0x00,0x01,0x30,0xcf,0xff,0xff,0xff,0x70,0x1a,0xaa,0x70,0xcf,
+0x54,0x44,0x9f,0x70,0x2f,0xff,0xb0,0xcf,0x00,0x00,0x6f,0x70,0x03,0x5f,0xb0,0xcf,
+0xa9,0x99,0xcf,0x70,0x00,0x2f,0xb0,0x20,0x00,0x00,0x08,0x00,0xc0,0x12,0xfd,0x1f,
+0xd1,0x00,0x00,0x2f,0xc8,0x84,0xfa,0x0f,0xd0,0x99,0x01,0xf5,0x0e,0xc9,0xf6,0x0f,
+0xd0,0x40,0x00,0x9f,0xfb,0x5f,0xf1,0x0f,0xd0,0xf9,0x01,0xef,0x79,0xff,0x50,0x0f,
+0xfd,0xf7,0x00,0x64,0x08,0xd4,0x00,0x09,0xff,0xd1,0xf0,0x01,0xf0,0x03,0x60,0x00,
+0x00,0x0d,0xf0,0x00,0x00,0x0a,0xf8,0x03,0xbb,0xbf,0xfb,0xbb,0x60,0x02,0xef,0x74,
+0xc0,0x02,0xd0,0x80,0x00,0x3f,0x70,0x45,0x5e,0xf5,0x55,0x00,0x00,0x03,0x00,0xdf,
+0xb8,0x04,0xb1,0x58,0x88,0x14,0x55,0x5e,0xf6,0x55,0x50,0xaf,0xff,0x2c,0xa0,0x03,
+0xb0,0x24,0xcf,0x20,0x56,0x66,0x66,0x66,0x00,0x00,0xaf,0x20,0xb8,0x02,0x01,0x08,
+0x00,0xf1,0x08,0x43,0x33,0xdf,0x00,0x00,0xaf,0x22,0xbf,0xee,0xee,0xff,0x00,0x00,
+0xbf,0xcb,0xbf,0x32,0x22,0xdf,0x00,0x00,0xdf,0xf8,0x20,0x00,0xf2,0x03,0x04,0xfd,
+0x30,0xbf,0x11,0x7a,0xfe,0x00,0x00,0x81,0x00,0xbf,0x00,0x5f,0xe7,0x00,0x00,0x80,
+0x38,0x03,0xc1,0x09,0xfb,0x00,0x78,0x8d,0xf9,0x88,0x20,0x01,0xdf,0xb0,0xdf,0x90,
+0x01,0x51,0x1d,0x50,0x00,0x0b,0xf3,0xf2,0x03,0x00,0x88,0x00,0xf0,0x10,0xc0,0x7c,
+0xcc,0x04,0xaa,0xaa,0xaa,0xaf,0xb0,0x9f,0xff,0x10,0x1e,0x85,0xe7,0x2f,0x70,0x00,
+0xaf,0x10,0x76,0xed,0xf8,0x2a,0x10,0x00,0xaf,0x12,0xde,0x67,0xf7,0x48,0x02,0x92,
+0x16,0x9f,0xcc,0xfb,0x99,0x90,0x00,0xaf,0x4d,0x90,0x04,0xf0,0x05,0xaf,0xf9,0x11,
+0xbf,0xa8,0x51,0x10,0x00,0xcf,0xf4,0x09,0xfe,0x3d,0xf9,0x00,0x03,0xfe,0x26,0xef,
+0xe3,0x6d,0x02,0x30,0xb2,0x07,0xf9,0xc5,0x02,0x05,0x6a,0x02,0x12,0x20,0xff,0x00,
+0x30,0x8f,0x50,0x0f,0xaf,0x01,0xf0,0x2c,0x03,0xef,0x60,0xfd,0xaa,0xaa,0xaf,0xa0,
+0x03,0xf7,0x0f,0x90,0x7f,0x00,0xfa,0x00,0x01,0x00,0xf9,0xbf,0xff,0x4f,0xa7,0xcc,
+0xc1,0x0f,0x92,0x9f,0x31,0xfa,0x9f,0xff,0x10,0xf9,0xac,0xfa,0x6f,0xa0,0x0b,0xf1,
+0x1f,0x8b,0xbb,0xb7,0xfa,0x00,0xbf,0x11,0xf7,0x23,0x33,0x0f,0xa0,0x0b,0xf1,0x2f,
+0x6d,0xff,0xf4,0x60,0x03,0xf4,0x14,0xf5,0xd8,0x2f,0x4f,0xa0,0x0c,0xfe,0xdf,0x2d,
+0xa6,0xf4,0xfa,0x01,0xff,0xff,0xe0,0xdf,0xff,0x4f,0xa0,0x8f,0xe9,0xf9,0x06,0x30,
+0x7b,0xf9,0x00,0x81,0x2b,0x10,0x00,0x07,0xfd,0x30,0x70,0x01,0xf1,0x0c,0x10,0x00,
+0x06,0x00,0x04,0x40,0x00,0x08,0xe2,0x00,0x4f,0x90,0x0e,0xd0,0x00,0x05,0xfe,0x28,
+0x9e,0xf9,0xaf,0xc9,0x50,0x00,0x7f,0x5e,0xff,0xa8,0x05,0xf0,0x0b,0x03,0x0b,0x97,
+0xf3,0x9f,0x2d,0x60,0x6b,0xbb,0x06,0xfa,0xf3,0x9f,0x9f,0x20,0x8f,0xff,0x58,0xbc,
+0xfa,0xdf,0x9b,0x81,0x00,0xbf,0x8f,0x20,0x00,0xc1,0xf3,0x00,0xaf,0x11,0x44,0x44,
+0x44,0x43,0x00,0x00,0xaf,0x12,0x09,0x04,0xb2,0x00,0xaf,0x13,0xf9,0x33,0x33,0xee,
+0x00,0x00,0xbf,0xc6,0x10,0x00,0x21,0xdf,0xf7,0x10,0x00,0xf0,0x00,0x04,0xfd,0x22,
+0xff,0xee,0xee,0xfe,0x00,0x00,0x70,0x02,0xfb,0x66,0x66,0xdd,0x5a,0x03,0x03,0xc2,
+0x05,0x22,0x6f,0xd0,0xf1,0x02,0x30,0xef,0xff,0xff,0x48,0x06,0x50,0x0c,0xfb,0x88,
+0x8f,0xf8,0xa0,0x04,0x80,0xc0,0x00,0x7f,0xd0,0x00,0x00,0x1d,0xff,0x01,0x00,0x80,
+0xfc,0x00,0x0a,0xdf,0xfa,0xaa,0xaa,0xac,0x35,0x05,0x41,0xd0,0x03,0x40,0x03,0x08,
+0x00,0x22,0x0d,0xf1,0x08,0x00,0x22,0x0f,0xf0,0x08,0x00,0x22,0x4f,0xc0,0x08,0x00,
+0x20,0xcf,0x53,0x08,0x00,0xf1,0x0a,0x00,0x3b,0xfd,0x5f,0xf9,0x30,0x00,0x05,0x8c,
+0xff,0xc1,0x05,0xcf,0xfb,0x40,0x0d,0xff,0xb5,0x00,0x00,0x03,0xbf,0xc1,0x02,0x30,
+0x2e,0x03,0x02,0x7b,0x00,0xf0,0x14,0x73,0x00,0x00,0x09,0xff,0xff,0xfa,0x04,0xf8,
+0x00,0x00,0x09,0xfa,0xaa,0xfa,0x09,0xf4,0x00,0x00,0x09,0xe1,0x41,0xea,0x0d,0xfb,
+0xaa,0xa4,0x09,0xe4,0xf5,0xea,0x3f,0xff,0xff,0xf6,0x08,0x00,0xf8,0x3e,0xaf,0x40,
+0x3f,0x60,0x09,0xe4,0xf5,0xed,0xff,0x40,0x6f,0x30,0x09,0xe5,0xf5,0xec,0xff,0xa0,
+0x9f,0x00,0x09,0xe5,0xf4,0xea,0x2b,0xf1,0xec,0x00,0x09,0xe6,0xf3,0xea,0x03,0xfb,
+0xf6,0x00,0x07,0xca,0xf0,0xb7,0x00,0xbf,0xf1,0x00,0x00,0x1e,0xc8,0x50,0x00,0x7f,
+0xe1,0x00,0x00,0x9f,0x4c,0xe1,0x05,0xff,0xfc,0x10,0x0a,0xfa,0x03,0xfa,0x9f,0xe3,
+0xaf,0xe4,0x0c,0x90,0x00,0x73,0x6c,0x20,0x07,0xe2,0x00,0x01,0x00,0x40,0xfc,0x00,
+0x00,0x0e,0xb4,0x03,0x00,0x08,0x00,0x22,0xeb,0xbd,0x08,0x00,0xf1,0x00,0x93,0x48,
+0xf1,0x00,0xff,0xbb,0xb5,0x0e,0x9b,0xc8,0xf1,0x00,0xff,0xff,0xf7,0x08,0x00,0x31,
+0xfd,0x00,0x00,0x08,0x00,0x00,0x20,0x00,0x04,0x10,0x00,0x30,0x9c,0xc8,0xf8,0x60,
+0x02,0xf1,0x05,0x0e,0x9d,0xb8,0xf8,0xfc,0xbb,0xbe,0xf0,0x0d,0x8f,0x86,0xc8,0xf4,
+0x00,0x0c,0xf0,0x00,0x4f,0x99,0x06,0x08,0x00,0xb0,0xce,0x9f,0x46,0xf5,0x00,0x0c,
+0xf0,0x09,0xf4,0x0e,0xd7,0x28,0x00,0x85,0x3d,0x40,0x05,0x87,0xfc,0xbb,0xbd,0xe0,
+0x7c,0x00,0x25,0x07,0xf4,0x08,0x00,0xf2,0x05,0x7f,0xff,0xff,0xa0,0x0c,0xff,0xff,
+0xfa,0x4a,0xaa,0xbf,0xa0,0x09,0xbd,0xfc,0xb7,0x00,0x00,0x2f,0xa0,0x20,0x00,0xf1,
+0x2e,0x2f,0xa0,0x4e,0xef,0xff,0xee,0x5f,0xff,0xff,0xa0,0x3b,0xbc,0xfe,0xbb,0x5f,
+0xda,0xaa,0x70,0x02,0x21,0xfa,0x00,0x4f,0x90,0x00,0x00,0x0c,0xf1,0xfd,0x66,0x4f,
+0x90,0x02,0xa2,0x0d,0xf1,0xff,0xfe,0x4f,0x90,0x03,0xf6,0x0e,0xf3,0xfc,0x54,0x3f,
+0xfb,0xbd,0xf3,0x0e,0xfb,0xfa,0x00,0x09,0xef,0xfe,0x90,0x1f,0xff,0xfb,0x5f,0x00,
+0xc0,0x4f,0x7b,0xff,0xfd,0xdc,0xcc,0xcd,0xd8,0x9f,0x20,0x4a,0xdf,0x18,0x05,0x15,
+0x06,0x41,0x07,0x15,0xf6,0x08,0x00,0x00,0xc0,0x05,0xf0,0x01,0x0a,0xff,0xff,0xfa,
+0x9b,0xfc,0x9d,0xf1,0x07,0xbd,0xfd,0xb7,0x09,0xf3,0x0c,0xf0,0x18,0x00,0xf2,0x27,
+0x2f,0xd1,0x1e,0xf0,0x1d,0xde,0xfe,0xdd,0xef,0x4a,0xff,0xb0,0x0c,0xcc,0xfe,0xcb,
+0x83,0x03,0x75,0x00,0x03,0x51,0xf9,0x00,0x9f,0xff,0xff,0xc0,0x09,0xf2,0xfc,0x75,
+0x9f,0xa9,0x9f,0xc0,0x0a,0xf2,0xff,0xfb,0x9f,0x30,0x1f,0xc0,0x0b,0xf7,0xfa,0x21,
+0x9f,0x97,0x8f,0xc0,0x0c,0xfe,0x20,0x00,0x13,0x0e,0x80,0x00,0x40,0x2f,0x88,0xff,
+0xfe,0x80,0x00,0x31,0x4f,0x40,0x3a,0x80,0x00,0x14,0x02,0x80,0x00,0x00,0x3e,0x05,
+0x00,0x28,0x04,0x50,0x3f,0xfc,0xcc,0xcc,0xcc,0x08,0x00,0x00,0x48,0x05,0x08,0x08,
+0x00,0x56,0xfd,0xdd,0xdd,0xdd,0xff,0x28,0x00,0x40,0x00,0x00,0x0d,0xf1,0x06,0x00,
+0x40,0x0a,0xf3,0x0d,0xf2,0x08,0x00,0x31,0x0e,0xf1,0x0d,0x20,0x04,0xc0,0x2f,0xf4,
+0x0d,0xfb,0xbb,0xbb,0x30,0x00,0x7f,0xfe,0x1d,0xf1,0xc7,0x02,0x40,0xff,0x6f,0xef,
+0xf1,0x2d,0x00,0xc0,0xf8,0x05,0xef,0xff,0xed,0xdd,0xd4,0x07,0xb0,0x00,0x07,0xbe,
+0x08,0x04,0x02,0x01,0x00,0x00,0xf0,0x01,0x10,0xb9,0xf0,0x00,0xd0,0x0e,0xd9,0x9f,
+0xb9,0xfe,0xdd,0xdd,0xd2,0x0e,0xa0,0x0f,0xb9,0xf3,0x18,0x00,0x46,0xb2,0x2f,0xb9,
+0xf4,0x20,0x00,0xf2,0x06,0x10,0x06,0x6d,0xf7,0x59,0xfc,0xbb,0xef,0x10,0x04,0x2a,
+0xf0,0x09,0xf3,0x00,0xaf,0x10,0x0f,0x9a,0xfd,0xa9,0x08,0x00,0x20,0xfc,0x99,0x20,
+0x00,0xc0,0x0f,0x9a,0xf0,0x09,0xfd,0xcc,0xcc,0x10,0x0f,0x9a,0xf4,0x69,0x40,0x00,
+0x40,0x0f,0xcd,0xff,0xf9,0x40,0x00,0xf0,0x05,0x9f,0xff,0xd8,0x39,0xff,0xff,0xff,
+0xf7,0x5a,0x61,0x00,0x07,0xcc,0xcc,0xcc,0xc6,0x0e,0xff,0xff,0xba,0x08,0x07,0xf0,
+0x15,0x0e,0xd9,0x9f,0xbb,0xfb,0xaa,0xbf,0xa0,0x0e,0xa0,0x0f,0xbb,0xf2,0x00,0x1f,
+0xa0,0x0e,0xb0,0x0f,0xbb,0xfe,0xee,0xef,0xa0,0x0e,0xff,0xff,0xbb,0xfc,0xbb,0xbf,
+0xa0,0x07,0x8d,0xf8,0x6b,0x18,0x00,0x40,0x06,0x3a,0xf0,0x0b,0x30,0x00,0xf0,0x07,
+0x0f,0x8a,0xff,0xab,0xf8,0xde,0x77,0x70,0x0f,0x8a,0xfb,0x7b,0xf2,0x8f,0x3b,0xe2,
+0x0f,0x8a,0xf0,0x0b,0xf2,0x3f,0x18,0x00,0xf3,0x0f,0xf1,0x3b,0xf2,0x0c,0xf8,0x00,
+0x0f,0xbd,0xff,0xcb,0xf4,0x58,0xfe,0x20,0x9f,0xff,0xd9,0x6f,0xff,0xf7,0x9f,0xe4,
+0x5a,0x62,0x00,0x2f,0xfb,0x61,0x0a,0xe1,0x5d,0x03,0x11,0x10,0xdb,0x01,0x20,0x51,
+0x00,0x9d,0x0a,0xf0,0x3a,0xc0,0x0f,0xf2,0x00,0x00,0x0b,0xf9,0x9f,0xc0,0x6f,0xff,
+0xff,0x90,0x0b,0xe0,0x0e,0xc1,0xef,0x99,0xdf,0x60,0x0b,0xf1,0x1f,0xca,0xff,0x61,
+0xff,0x10,0x0b,0xff,0xff,0xef,0xee,0xfb,0xf7,0x00,0x06,0x8c,0xfa,0x72,0x34,0xff,
+0xd0,0x00,0x05,0x47,0xf3,0x00,0x1b,0xff,0xf8,0x00,0x0d,0xb7,0xfc,0xb8,0xff,0xa4,
+0xdf,0xf8,0x0d,0xb7,0xfe,0xde,0xfd,0x88,0x9f,0xf3,0x0d,0xb7,0xf3,0x03,0xf0,0x06,
+0xa0,0x0d,0xb7,0xf3,0x41,0xfb,0x00,0x2f,0xb0,0x0d,0xdb,0xea,0x04,0xe0,0x1f,0xb0,
+0x7f,0xff,0xfd,0x92,0xfe,0xaa,0xbf,0xb0,0x4c,0x84,0x10,0x01,0x30,0x07,0x00,0x78,
+0x00,0x72,0xce,0x4f,0x80,0x00,0x0e,0xff,0xfe,0x08,0x00,0xf8,0x58,0xd9,0xde,0x33,
+0xce,0x4f,0x86,0x40,0x0e,0xa0,0xaf,0xfc,0xce,0x4f,0x8e,0xf1,0x0e,0xa0,0xae,0x9f,
+0xfe,0x4f,0xcf,0x90,0x0e,0xff,0xfe,0x3f,0xfe,0x4f,0xff,0x20,0x07,0x8f,0xc7,0x09,
+0xde,0x4f,0xb6,0x00,0x07,0x3f,0x80,0x00,0xce,0x4f,0xb1,0x00,0x0e,0x6f,0xff,0x17,
+0xfd,0x4f,0xfd,0x20,0x0e,0x6f,0xdd,0xef,0xfc,0x4f,0xdf,0xe3,0x0e,0x6f,0x82,0xf9,
+0xf9,0x4f,0x85,0xc0,0x0e,0x6f,0xb8,0x47,0xf5,0x4f,0x80,0x20,0x4f,0xef,0xff,0x6d,
+0xe0,0x4f,0x82,0xf5,0x8f,0xd9,0x52,0xcf,0x70,0x2f,0xec,0xf4,0x11,0x00,0x00,0xc9,
+0x00,0x0b,0xff,0xb0,0xd7,0x03,0x31,0x03,0x83,0x00,0x80,0x00,0xf0,0x01,0x06,0xf9,
+0x00,0x00,0x0e,0xd9,0xee,0x4a,0xab,0xff,0xaa,0xa2,0x0e,0xa0,0xce,0x6f,0x30,0x05,
+0xf1,0x0c,0x0e,0xb3,0xde,0x6f,0x70,0x00,0x09,0xf3,0x0e,0xff,0xfe,0x26,0xca,0xaa,
+0xab,0x61,0x05,0x5e,0xa5,0x00,0xef,0xff,0xfb,0x00,0x07,0x3d,0x80,0x3c,0x00,0xf0,
+0x22,0x0f,0x7d,0xff,0x8d,0xdd,0xdd,0xdd,0xd4,0x0f,0x7d,0xc9,0x7c,0xcc,0xff,0xcc,
+0xc4,0x0f,0x7d,0x70,0x03,0x72,0xcf,0x16,0x00,0x0f,0x7d,0xcb,0x2d,0xf4,0xcf,0x5f,
+0x80,0x4f,0xff,0xfd,0xdf,0x90,0xcf,0x0c,0xf2,0x7f,0xc7,0x21,0xbc,0x49,0xfe,0x04,
+0xe5,0x12,0xd3,0x08,0x19,0xe8,0x56,0x04,0x32,0x08,0x61,0x00,0x7b,0x03,0x20,0xe1,
+0x00,0x50,0x05,0x00,0xbf,0x02,0x80,0xc0,0x00,0x00,0x0c,0xfa,0x99,0x99,0xaf,0x08,
+0x00,0x40,0xf8,0x88,0x88,0x8f,0x08,0x00,0xe1,0xfd,0xdd,0xdd,0xdf,0xc3,0x30,0x00,
+0x0c,0xf3,0x22,0x22,0x3f,0xdd,0xf2,0x28,0x00,0x00,0xb8,0x07,0xe0,0x0c,0xf4,0x22,
+0x22,0x4f,0xfa,0x00,0x07,0xbf,0xfb,0xbb,0xbb,0xcf,0xe0,0x20,0x05,0x02,0x40,0x00,
+0xf7,0x0f,0x00,0x00,0x4b,0xfe,0x7f,0xc0,0x00,0x00,0x01,0x6c,0xff,0x80,0x1f,0xc0,
+0x00,0x07,0xcf,0xfe,0x92,0xcd,0xdf,0xa0,0x00,0x07,0xfa,0x40,0x00,0x9f,0xfc,0x30,
+0x7f,0x00,0x23,0x01,0x51,0x87,0x00,0x11,0xfe,0x0e,0x00,0x91,0x11,0x1e,0xf8,0x11,
+0x11,0x11,0x10,0x0d,0xff,0x01,0x00,0xe1,0xe0,0x0a,0xbc,0xff,0xcc,0xff,0xbb,0xbb,
+0xa0,0x00,0x06,0xfc,0x01,0xfe,0xa1,0x03,0x12,0xf2,0x08,0x00,0x90,0xdf,0xfc,0xcc,
+0xff,0xcc,0xca,0x00,0x00,0x9f,0x27,0x00,0x72,0xfd,0x00,0x00,0x11,0x00,0x02,0xff,
+0x49,0x00,0x25,0x02,0xff,0xaf,0x03,0xa0,0xff,0xf3,0x2c,0xcc,0xcc,0xcd,0xff,0xcc,
+0xcc,0xc2,0x5b,0x00,0x01,0x38,0x00,0x04,0x08,0x00,0xb0,0x05,0x30,0x00,0x00,0x25,
+0x20,0x00,0x00,0x0f,0xd0,0x00,0xc7,0x0a,0xc1,0x1c,0xcf,0xec,0xc4,0xcc,0xff,0xdc,
+0xc1,0x2f,0xff,0xff,0xf5,0x18,0x09,0xf0,0x04,0xbf,0x85,0x00,0x05,0xf9,0x00,0x00,
+0x01,0xfb,0xfa,0x0c,0xce,0xfe,0xcc,0xc8,0x06,0xf5,0xfa,0x0e,0x69,0x07,0xf0,0x21,
+0x0e,0xfe,0xff,0xb0,0x2f,0xc0,0x00,0x00,0x0b,0xdd,0xff,0xb0,0x7f,0xed,0xdd,0xa1,
+0x00,0x02,0xfa,0x00,0xcf,0xff,0xff,0xb0,0x01,0x37,0xfe,0xb5,0x00,0x03,0xfe,0x10,
+0x2f,0xff,0xff,0xc4,0x4f,0x9e,0xf3,0x00,0x09,0x76,0xfa,0x00,0x2b,0xff,0xb0,0x00,
+0x20,0x00,0x41,0x00,0x5e,0xfc,0x10,0x08,0x00,0x36,0x01,0xb9,0x00,0x50,0x05,0x40,
+0x30,0x00,0x00,0x75,0xd0,0x00,0xf0,0x4f,0x90,0x00,0x04,0xff,0x30,0x00,0x1c,0xdf,
+0xec,0xa0,0x0c,0xff,0xc0,0x00,0x1f,0xff,0xff,0xc0,0x7f,0xcb,0xf6,0x00,0x00,0xde,
+0x83,0x03,0xff,0x32,0xff,0x40,0x01,0xfb,0xf5,0x3f,0xf6,0x00,0x6f,0xf4,0x07,0xf6,
+0xf5,0xaf,0xe8,0x00,0x08,0xf5,0x0f,0xff,0xff,0xc6,0xdf,0x11,0xb5,0x40,0x0b,0xcd,
+0xfd,0x90,0xcf,0x6e,0xfe,0x00,0x00,0x04,0xf5,0x00,0xcf,0xff,0x80,0x00,0x01,0x38,
+0xfc,0xd0,0xcf,0xa2,0x00,0x00,0x2f,0xff,0xff,0xe0,0xcf,0x10,0x07,0x80,0x0c,0x99,
+0xf6,0x00,0xcf,0x10,0x0a,0xf1,0x20,0x00,0x40,0xbf,0xdb,0xcf,0xe0,0x08,0x00,0xf0,
+0x04,0x3c,0xef,0xfd,0x40,0x00,0x0e,0x90,0x00,0x00,0xbf,0x20,0x00,0x01,0x3f,0xb1,
+0x10,0x00,0xbf,0x20,0x70,0x00,0x10,0xe0,0x08,0x00,0xc0,0x1e,0xff,0xee,0xd0,0x00,
+0xbf,0x30,0x00,0x00,0xce,0x85,0x08,0x00,0x01,0xf0,0x05,0x01,0xf9,0xfa,0x08,0xfa,
+0xdf,0xae,0xf1,0x07,0xf3,0xfa,0x08,0xf1,0xaf,0x1b,0xf1,0x0e,0xfe,0xff,0xd8,0x08,
+0x00,0xc1,0x0b,0xdd,0xff,0xc8,0xfc,0xef,0xce,0xf1,0x00,0x00,0xfa,0x08,0x28,0x01,
+0x30,0x24,0xfd,0xb8,0x18,0x00,0x40,0x2f,0xff,0xff,0xf9,0x08,0x00,0x31,0x0f,0xc9,
+0xfb,0x30,0x00,0x04,0x20,0x00,0x00,0x08,0x00,0x42,0xfa,0xaa,0xae,0xf1,0x3b,0x08,
+0x08,0x01,0x00,0xf2,0x10,0x9f,0x30,0x05,0xf7,0x48,0x00,0x03,0xcc,0xef,0xdc,0xa5,
+0xf8,0xcf,0x60,0x03,0xdd,0xff,0xed,0xb5,0xf8,0x1f,0xe0,0x01,0x11,0xaf,0x41,0x16,
+0xf8,0x16,0x40,0x1f,0xc0,0x01,0xf0,0x02,0xf6,0x06,0x6a,0xf9,0x66,0x68,0xfb,0x66,
+0x62,0x05,0x6c,0xf9,0x66,0x64,0xfa,0x0c,0x70,0x18,0x02,0xf0,0x06,0xf5,0xfb,0x4f,
+0x90,0x01,0xcf,0x3e,0xd1,0x10,0xfd,0xaf,0x30,0x07,0xfe,0x9f,0xf9,0x90,0xdf,0xfd,
+0x00,0x05,0xb5,0x06,0x20,0xaf,0xf5,0x12,0x05,0xf5,0x0e,0xe3,0x52,0x7f,0xc0,0x81,
+0x0c,0xef,0xff,0xff,0xfa,0xff,0xd0,0xe9,0x08,0x98,0x6f,0xe3,0x7f,0xfb,0xfe,0xf5,
+0x00,0x00,0x0e,0xd0,0x5e,0x30,0x8d,0xa0,0x7f,0x00,0x71,0x0a,0x70,0x00,0x00,0x8a,
+0x00,0x00,0x23,0x0b,0x20,0xcf,0x50,0x08,0x01,0x91,0xc7,0xaa,0xcf,0xba,0xa4,0x1b,
+0xef,0xcb,0x9b,0xf0,0x0b,0xf0,0x27,0xdd,0x85,0x00,0x2d,0x70,0x5c,0x20,0x02,0xf8,
+0xfa,0x00,0x9f,0x40,0x4f,0xa0,0x08,0xf2,0xfa,0x04,0xfc,0x00,0x0b,0xf3,0x0f,0xff,
+0xff,0xcd,0xfa,0x20,0x58,0xfb,0x0a,0xcb,0xfe,0xa3,0xbf,0xa0,0xfe,0x72,0x00,0x00,
+0xfa,0x00,0x0c,0xf9,0xf6,0x00,0x02,0x46,0xfe,0xb1,0x04,0xff,0xe0,0x80,0x01,0xf0,
+0x06,0xe1,0x01,0xef,0xc0,0x00,0x09,0x75,0xfa,0x00,0x2d,0xff,0xfc,0x20,0x00,0x00,
+0xfa,0x09,0xff,0x71,0xcf,0xf6,0x08,0x00,0xc0,0xc3,0x00,0x06,0xc0,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x05,0x20,0x00,0x01,0x00,0xf0,0x04,0x1f,0xc0,
+0x05,0xff,0xff,0xff,0xc0,0x1b,0xcf,0xeb,0x95,0xfa,0x55,0x6f,0xc0,0x1c,0xef,0xcc,
+0xa5,0x10,0x00,0xf0,0x25,0x00,0xde,0x85,0x02,0x66,0x66,0x66,0x50,0x02,0xf9,0xfa,
+0x2f,0xff,0xff,0xff,0xfa,0x08,0xf4,0xfa,0x1c,0xfd,0xbb,0xcf,0xe7,0x0f,0xff,0xff,
+0x93,0xfb,0x55,0x7f,0x90,0x0a,0xcc,0xfe,0x73,0xff,0xff,0xff,0x90,0x00,0x01,0xfa,
+0x03,0xf9,0x22,0x4f,0x90,0x01,0x36,0xfe,0xb3,0x10,0x00,0xf4,0x12,0x2f,0xff,0xff,
+0xc3,0xfa,0x23,0x5f,0xa3,0x0a,0x75,0xfa,0x4c,0xff,0xef,0xff,0xfc,0x00,0x01,0xfa,
+0x3c,0xba,0x97,0x8f,0xb2,0x00,0x01,0xfa,0x00,0x00,0x00,0x2f,0x90,0x00,0x01,0x00,
+0xf1,0x4b,0x68,0x00,0x00,0x00,0x96,0x00,0x00,0x00,0xbf,0x00,0x00,0x09,0xff,0x30,
+0x00,0x5f,0xff,0xff,0x02,0xcf,0xbe,0xf5,0x00,0x3c,0xfd,0xbd,0x9f,0xf8,0x02,0xdf,
+0xc4,0x04,0xf8,0x62,0xef,0xff,0xff,0xff,0xf6,0x08,0xfb,0xe0,0x24,0x88,0x88,0x88,
+0x10,0x0d,0xaa,0xe0,0x4a,0xaa,0xa2,0x24,0xd2,0x4f,0xff,0xfe,0x7f,0xde,0xf7,0xf5,
+0xf2,0x1d,0xce,0xfb,0x7f,0x69,0xf7,0xf5,0xf2,0x00,0x0a,0xe0,0x7f,0xff,0xf7,0xf5,
+0xf2,0x03,0x6d,0xff,0x7f,0x47,0xf7,0xf5,0xf2,0x4f,0xff,0xfa,0x10,0x00,0x71,0x09,
+0x5b,0xe0,0x7f,0x37,0xf5,0xa5,0x20,0x00,0x31,0x4a,0xf2,0x8b,0x08,0x00,0x5c,0x5f,
+0xb0,0xce,0x90,0x00,0x01,0x00,0x50,0x04,0xc1,0x00,0x00,0xef,0x0c,0x01,0xf1,0x0e,
+0xcf,0xb0,0x00,0x0e,0xf1,0x00,0x00,0x00,0x01,0xef,0x70,0x00,0xff,0x10,0x00,0x00,
+0x00,0x05,0xf4,0x9e,0xef,0xfe,0xee,0xeb,0x00,0x00,0x02,0x0a,0xff,0x13,0x01,0x00,
+0xc1,0x00,0xf0,0x42,0xd0,0x03,0xfb,0x00,0xaf,0xff,0x10,0x05,0xfa,0x00,0x3f,0xb0,
+0x08,0xcf,0xf1,0x00,0x9f,0x60,0x04,0xfa,0x00,0x00,0xdf,0x10,0x0e,0xf1,0x00,0x5f,
+0x90,0x00,0x0d,0xf1,0x07,0xfb,0x00,0x07,0xf8,0x00,0x00,0xdf,0x14,0xff,0x22,0x22,
+0xcf,0x50,0x00,0x0d,0xf1,0xef,0x60,0x7f,0xff,0xf1,0x00,0x08,0xff,0xa7,0x70,0x02,
+0xbb,0xa3,0x00,0x0b,0xfe,0xdf,0xff,0xed,0xdd,0xde,0xff,0x60,0x6e,0x20,0x49,0xdf,
+0xff,0xff,0xff,0xe1,0x00,0x6a,0x00,0x10,0x10,0x5b,0x00,0x92,0x40,0x00,0x00,0x00,
+0x0b,0xf3,0x00,0x08,0xf8,0x08,0x00,0x31,0x03,0xff,0x50,0x08,0x00,0xb0,0x00,0x5f,
+0xc5,0xcc,0xcc,0xcf,0xfd,0xc2,0x00,0x07,0x17,0x86,0x00,0x50,0xf3,0x00,0x00,0x00,
+0x02,0x18,0x00,0xd0,0x0b,0xbb,0x70,0xcf,0x20,0x0b,0xf3,0x00,0x0f,0xff,0xa0,0x5f,
+0xd0,0x28,0x00,0x42,0x3f,0xa0,0x09,0xf7,0x08,0x00,0x22,0x01,0x60,0x08,0x00,0xfc,
+0x16,0x00,0x37,0x7d,0xf2,0x00,0x00,0x4f,0xb0,0x00,0x3f,0xff,0xd0,0x00,0x08,0xff,
+0xfb,0x50,0x07,0x64,0x00,0x22,0x3f,0xf5,0xaf,0xff,0xfe,0xef,0xff,0xf5,0x09,0x60,
+0x03,0x9d,0xef,0xff,0xfe,0xd1,0x10,0x01,0x30,0x0c,0xc2,0x01,0x68,0x00,0xc2,0x00,
+0x0a,0xff,0x41,0xcc,0xcc,0xcc,0xcc,0x00,0x00,0x8f,0x40,0x19,0x00,0xa0,0x02,0x04,
+0x44,0x44,0x44,0x44,0x40,0x00,0x00,0x3f,0x20,0x00,0xf0,0x15,0xf1,0xaf,0xff,0x49,
+0x9c,0xfe,0x99,0xa9,0x90,0x7b,0xef,0x20,0x0c,0xf6,0x1a,0x80,0x00,0x00,0xaf,0x20,
+0x4f,0xc0,0x0d,0xf2,0x00,0x00,0xaf,0x21,0xdf,0x42,0x49,0xfc,0x00,0x00,0xaf,0x2a,
+0x28,0x00,0xf0,0x0d,0x60,0x00,0xbf,0x34,0xeb,0x98,0x65,0x5f,0x90,0x06,0xff,0xe6,
+0x10,0x00,0x00,0x01,0x10,0x7f,0xfc,0xff,0xfe,0xdc,0xdd,0xef,0xf3,0x3f,0x40,0x28,
+0x01,0x01,0x20,0xe0,0x01,0x73,0x01,0x07,0x80,0x00,0x70,0x05,0xe5,0x00,0x01,0xfc,
+0x0d,0xf1,0x00,0x01,0x01,0x08,0x00,0xc0,0x00,0x3f,0xc3,0xcd,0xff,0xcf,0xfd,0xb0,
+0x00,0x03,0x03,0xff,0x30,0x00,0x00,0x8a,0x00,0x00,0x18,0x00,0x31,0x0c,0xcc,0x80,
+0x20,0x00,0xb2,0x0f,0xff,0xa5,0xcc,0xff,0xcf,0xfc,0xc2,0x00,0x3f,0xa6,0x20,0x01,
+0x41,0x3f,0xa0,0x0b,0xf5,0x38,0x00,0x32,0xa0,0x3f,0xf0,0x08,0x00,0x20,0xef,0x70,
+0x50,0x00,0xf5,0x08,0xdf,0xe6,0x4a,0x00,0x0a,0xc0,0x00,0x2f,0xf8,0xcf,0xfd,0xcb,
+0xbb,0xcd,0xe6,0x0b,0x70,0x05,0xae,0xff,0xff,0xff,0xe2,0x7c,0x00,0x43,0x20,0x00,
+0x02,0x61,0x83,0x01,0x10,0xf9,0x18,0x02,0x20,0xfe,0x1f,0x50,0x00,0xf0,0x0d,0xb0,
+0x00,0x9f,0x5a,0xcf,0xea,0xaa,0xaa,0x70,0x00,0x02,0x00,0xaf,0x46,0xc6,0x00,0x00,
+0x24,0x44,0x05,0xfe,0x49,0xf9,0x33,0x00,0x8f,0xff,0x1a,0x20,0x00,0xc1,0x30,0x47,
+0xdf,0x14,0x98,0x8b,0xfc,0x88,0x10,0x00,0xbf,0x10,0xfa,0x01,0x32,0x00,0xbf,0x3f,
+0xa8,0x00,0xf0,0x04,0xbf,0x2b,0xbb,0xbd,0xfd,0xbb,0xa0,0x00,0xcf,0x10,0x00,0x07,
+0xf7,0x00,0x00,0x1b,0xff,0xc5,0x10,0x08,0x00,0xab,0xcf,0xca,0xff,0xfe,0xdd,0xdd,
+0xef,0xf4,0x4e,0x10,0x00,0x01,0x12,0x50,0x87,0x00,0x30,0x08,0xfa,0x00,0x79,0x00,
+0xf1,0x05,0xd0,0x00,0xdf,0x70,0x1f,0xfc,0xcc,0xdf,0xd0,0x00,0x2f,0xc0,0x1f,0xe0,
+0x00,0x0f,0xd0,0x00,0x03,0x00,0x08,0x00,0x00,0x85,0x02,0x00,0x20,0x00,0xf0,0x00,
+0x1c,0xcc,0x80,0x4f,0xfe,0xee,0xee,0xc0,0x1f,0xff,0xa0,0x5f,0xb0,0xac,0x10,0xe8,
+0x00,0x40,0x8f,0x80,0xaf,0xd1,0x08,0x00,0xfd,0x1e,0xdf,0x50,0x0b,0xfd,0x10,0x00,
+0x3f,0xa7,0xff,0x00,0x00,0xcf,0xc0,0x00,0x4f,0xa9,0xf8,0x00,0x00,0x1e,0xc1,0x05,
+0xff,0xf9,0x70,0x00,0x00,0x02,0x01,0x2f,0xf7,0xbf,0xfe,0xdc,0xcd,0xef,0xf9,0x0a,
+0x70,0x04,0x9e,0xff,0xff,0xff,0xe4,0x11,0x03,0xf1,0x13,0x20,0x00,0x00,0x0c,0xf2,
+0xa7,0x00,0x0a,0xf3,0x00,0x00,0x0c,0xf3,0xff,0x40,0x06,0xfe,0x00,0x00,0x0c,0xf1,
+0x5f,0x70,0x00,0xaf,0x98,0xbb,0xbf,0xfb,0xbe,0xb1,0x00,0x1c,0x2b,0x00,0x02,0x01,
+0x2a,0x03,0x70,0xfc,0x10,0x00,0x1c,0xcc,0x90,0x06,0x27,0x01,0xf0,0x1c,0x2f,0xff,
+0xb0,0x0e,0xfd,0xfc,0xfa,0x00,0x00,0x1f,0xb0,0x8f,0x7c,0xf2,0xcf,0x70,0x00,0x1f,
+0xb6,0xfd,0x0c,0xf1,0x1e,0xf1,0x00,0x1f,0xb9,0xe1,0x0c,0xf1,0x04,0x50,0x00,0x4f,
+0xd0,0x10,0x0c,0xf1,0x00,0x00,0x05,0xff,0xfd,0xea,0x00,0xfc,0x02,0x22,0x2f,0xfa,
+0xbf,0xfe,0xcb,0xbc,0xcf,0xf5,0x0b,0x70,0x03,0x8d,0xef,0xff,0xfe,0xe1,0x87,0x00,
+0x20,0x09,0xa0,0x88,0x02,0xf1,0x05,0xfc,0x00,0x0c,0xfa,0x01,0xfe,0x88,0x88,0xfc,
+0x00,0x01,0xdf,0x41,0xfe,0x66,0x67,0xfc,0x00,0x00,0x36,0x18,0x00,0x00,0x7f,0x00,
+0x81,0xfe,0x22,0x23,0xfc,0x00,0x6d,0xdd,0x21,0x10,0x00,0xf0,0x01,0x7f,0xff,0x21,
+0xfe,0x58,0x95,0x8e,0x30,0x00,0xaf,0x21,0xfd,0x0d,0xf9,0xff,0x80,0x08,0x00,0xa2,
+0x01,0xcf,0xf3,0x00,0x00,0xaf,0x25,0xff,0xbe,0x4a,0x90,0x02,0xf4,0x09,0xeb,0x20,
+0x9f,0x70,0x04,0xef,0xc6,0x72,0x00,0x00,0x04,0x00,0x7f,0xfa,0xef,0xfb,0xa9,0xaa,
+0xbc,0xd4,0x4e,0x30,0x06,0xbe,0x88,0x01,0x03,0x01,0x00,0xf0,0x09,0x26,0x00,0x02,
+0x30,0x00,0x0a,0x50,0x00,0xdf,0x60,0x0c,0xf4,0x00,0x3f,0xf5,0x00,0x4f,0xd0,0x3f,
+0xa0,0x00,0x03,0xff,0x7f,0xf8,0x00,0xf1,0x0d,0xa0,0x00,0x53,0x3a,0xaa,0xaf,0xfa,
+0xaa,0x70,0x00,0x00,0x07,0xa0,0x1f,0xd0,0x7b,0x10,0x6b,0xbb,0x0a,0xf1,0x1f,0xd0,
+0xbf,0x20,0x8f,0xff,0x1a,0x08,0x00,0x70,0x00,0xbf,0x1a,0xfb,0xbf,0xfa,0xef,0x08,
+0x00,0x00,0x30,0x00,0x10,0x20,0x18,0x02,0x20,0xcf,0x60,0x18,0x02,0xf1,0x09,0x10,
+0x4c,0xfb,0x00,0x00,0x00,0x03,0xef,0xb6,0xef,0x80,0x00,0x00,0x00,0x6f,0xe8,0xef,
+0xfd,0xba,0xab,0xcd,0xe0,0x2e,0x20,0x80,0x00,0x14,0xb0,0x80,0x00,0x40,0x02,0x10,
+0x00,0x33,0x28,0x01,0xf2,0x04,0x2e,0xe2,0x00,0xcf,0x2c,0xf1,0x00,0x00,0x0c,0xfd,
+0x02,0xff,0x8e,0xf9,0x88,0x30,0x00,0xde,0x3b,0x50,0x03,0x51,0x22,0x2f,0xd1,0x0d,
+0xf1,0x2a,0x03,0x71,0x63,0x3d,0xf4,0x33,0x30,0x49,0x99,0x70,0x02,0xf0,0x01,0xf0,
+0x7f,0xff,0x20,0x0a,0xf4,0x9f,0x40,0x00,0x12,0xbf,0x20,0x0e,0xf1,0x9f,0x40,0x90,
+0x03,0x50,0x5f,0xc0,0x9f,0x45,0x60,0x00,0x01,0xf0,0x11,0x40,0x9f,0x58,0xf3,0x00,
+0xaf,0x5f,0xf7,0x00,0x7f,0xff,0xf0,0x00,0xcf,0xdc,0x50,0x00,0x19,0xba,0x50,0x4e,
+0xf9,0xaf,0xfd,0xcb,0xbc,0xcd,0xe1,0x1e,0x60,0x04,0xae,0xde,0x04,0x01,0x88,0x02,
+0x17,0x10,0x80,0x01,0x11,0x60,0x08,0x04,0xf2,0x2d,0x40,0x2e,0xf9,0x00,0x78,0xc7,
+0x8e,0xfc,0x10,0x02,0xdf,0x70,0x09,0xfe,0xef,0x70,0x00,0x00,0x18,0x02,0x99,0xcf,
+0xff,0xb9,0x70,0x00,0x00,0x03,0xfd,0xae,0xfa,0xaf,0xb0,0x7a,0xaa,0x23,0xfc,0x8e,
+0xf8,0x9f,0xb0,0xaf,0xff,0x23,0xfe,0xcf,0xfc,0xdf,0xb0,0x01,0xaf,0x23,0xfb,0x4d,
+0xf4,0x5f,0xb0,0x00,0xaf,0x23,0x40,0x03,0xf0,0x14,0xaf,0x23,0xf9,0x0c,0xe0,0x2f,
+0xb0,0x00,0xaf,0x33,0xf8,0x0c,0xe7,0xff,0x90,0x08,0xff,0xc5,0x74,0x05,0x51,0x86,
+0x00,0x8f,0xc5,0xdf,0xda,0x98,0x99,0xab,0xd5,0x2e,0x10,0x06,0xcf,0x50,0x02,0x04,
+0x80,0x00,0x00,0x0d,0x05,0x00,0x00,0x01,0x22,0x06,0xf3,0x08,0x00,0x21,0x0a,0xfe,
+0x48,0x04,0xf1,0x06,0xf5,0x00,0xaf,0xb5,0x88,0x8e,0xf9,0x88,0x82,0x00,0x0a,0x11,
+0x88,0x8e,0xf8,0x88,0x60,0x00,0x00,0x03,0xff,0xb9,0x06,0xa2,0xbb,0x83,0xf8,0x0c,
+0xf1,0x0f,0xc0,0x1c,0xdf,0xb3,0xa6,0x05,0xf0,0x24,0x1f,0xb1,0x77,0xef,0xff,0x97,
+0x60,0x00,0x1f,0xb0,0x0b,0xff,0xff,0xf8,0x00,0x00,0x1f,0xb7,0xef,0x6c,0xf2,0xaf,
+0xd1,0x00,0x2f,0xc6,0xd4,0x0c,0xf1,0x06,0x80,0x03,0xef,0xfc,0x40,0x04,0x50,0x00,
+0x01,0x2f,0xfb,0xbf,0xfe,0xba,0xab,0xbd,0xf9,0x0c,0x80,0x03,0x8d,0x08,0x03,0x1c,
+0x01,0x80,0x02,0x21,0xc1,0x0a,0xf0,0x01,0xf2,0x03,0x09,0xfc,0x0a,0xf7,0xfa,0xaf,
+0x7f,0xa0,0x00,0xbf,0x5a,0xe0,0xf5,0x5e,0x0f,0xa0,0x00,0x15,0x18,0x00,0xf0,0x10,
+0x13,0x33,0x04,0x79,0xfe,0x77,0x77,0x40,0x8f,0xff,0x20,0x0c,0xfc,0x88,0x85,0x00,
+0x47,0xdf,0x21,0xbf,0xff,0xff,0xfe,0x00,0x00,0xaf,0x4e,0xf9,0x60,0x09,0xf5,0x78,
+0x02,0x40,0x58,0xfc,0xaf,0xa0,0x88,0x01,0x30,0x01,0xdf,0xf9,0x00,0x02,0xb0,0x24,
+0xbf,0xfd,0x40,0x00,0x00,0x1c,0xff,0xc7,0xfa,0x50,0x6f,0x06,0xb0,0xba,0xff,0xfd,
+0xcb,0xcc,0xde,0xf2,0x5d,0x00,0x39,0xdf,0xd0,0x03,0x07,0x80,0x01,0xf2,0x09,0x05,
+0x40,0x02,0x40,0x00,0x04,0xa0,0x00,0x2f,0xd0,0x0b,0xf4,0x00,0x09,0xfc,0x07,0x9e,
+0xe9,0x9f,0xe9,0x92,0x00,0xbf,0x8b,0xe0,0x04,0x70,0x18,0x00,0x11,0x3f,0xc1,0x11,
+0x00,0x52,0x00,0xf1,0x00,0xff,0xff,0xff,0x10,0x0d,0xdd,0x90,0xbf,0x42,0x22,0xdf,
+0x10,0x0e,0xef,0xa0,0x10,0x00,0x71,0x00,0x2f,0xa0,0xbf,0x43,0x33,0xdf,0x08,0x00,
+0x2a,0xfe,0xee,0x10,0x00,0x00,0x20,0x00,0xf1,0x03,0x01,0xaf,0xf7,0x56,0x66,0x66,
+0x66,0x00,0x1d,0xfc,0xdf,0xfc,0xa9,0x9a,0xab,0xd6,0x0c,0x90,0x00,0x02,0x11,0xf2,
+0x00,0x01,0x02,0x80,0x00,0xf2,0x31,0x12,0x34,0x69,0xc6,0x00,0x0a,0xc1,0x3f,0xff,
+0xff,0xfd,0xb8,0x10,0x0a,0xfe,0x27,0xa3,0x5b,0x10,0xd9,0x00,0x00,0x9f,0x79,0xf4,
+0x3f,0x76,0xf8,0x00,0x00,0x04,0x02,0xfb,0x0b,0x59,0xd0,0x00,0x13,0x33,0x02,0xff,
+0xbb,0xbb,0xbb,0x00,0x6f,0xff,0x4d,0xfc,0xcf,0xfc,0xcc,0x00,0x4a,0xef,0x5f,0x83,
+0x4f,0xc3,0x33,0x20,0x00,0xaf,0x5f,0x00,0x05,0xf1,0x03,0xaf,0x37,0x94,0x4f,0xc3,
+0x79,0x40,0x00,0xaf,0x29,0xf2,0x1f,0xb0,0xbf,0x20,0x00,0xaf,0x29,0x10,0x03,0x40,
+0x05,0xef,0xca,0x98,0xd1,0x07,0xf5,0x01,0x6f,0xe9,0xef,0xfc,0xcb,0xcc,0xde,0xf1,
+0x2e,0x30,0x06,0xce,0xff,0xff,0xfe,0xb0,0x80,0x01,0x22,0x02,0xa7,0x08,0x00,0x20,
+0x01,0xfd,0xe2,0x01,0xf0,0x1b,0xc1,0x0a,0xcc,0xff,0xcc,0xa3,0xfd,0xbf,0xf4,0x0d,
+0xff,0xff,0xff,0xc3,0xf6,0x0f,0xd0,0x00,0xcd,0x00,0xde,0x13,0xf6,0x5f,0x70,0x00,
+0x9f,0x43,0xfa,0x03,0xf6,0xaf,0x10,0x3a,0xcf,0xbd,0xfc,0xa5,0xf6,0xfc,0x00,0x4f,
+0x2e,0x08,0x31,0xf6,0x8f,0x50,0xd4,0x07,0xf2,0x14,0xf6,0x0e,0xd0,0x05,0xaa,0xaa,
+0xaa,0x53,0xf6,0x0b,0xf0,0x08,0xff,0xff,0xff,0x83,0xf6,0x09,0xf2,0x08,0xf4,0x00,
+0x5f,0x83,0xf9,0x8f,0xf0,0x08,0xf3,0x00,0x5f,0x83,0xf8,0xff,0x80,0x18,0x00,0x91,
+0x31,0x00,0x08,0xfb,0xaa,0xbe,0x83,0xf6,0x00,0x40,0x00,0xf1,0x09,0x6f,0xff,0xff,
+0xe0,0x3a,0xbf,0xcf,0xaa,0x5d,0xdd,0xdf,0xe0,0x00,0x2f,0x5f,0x00,0x00,0x00,0x0e,
+0xe0,0x0f,0xff,0xff,0xfb,0x08,0x00,0x31,0xce,0xcc,0xeb,0x08,0x00,0x62,0x7d,0x67,
+0xdb,0x5f,0xff,0xff,0x08,0x00,0xf0,0x08,0xda,0xaf,0xe0,0x0f,0xcb,0x4e,0xfb,0x5f,
+0x80,0x09,0x90,0x0f,0x93,0x01,0xdb,0x5f,0x80,0x00,0x00,0x0f,0xa5,0x55,0xeb,0x08,
+0x00,0x00,0x38,0x00,0xc0,0x5f,0x80,0x02,0x81,0x0f,0x92,0x22,0xdb,0x5f,0x90,0x05,
+0xf7,0x10,0x00,0xc1,0x3f,0xfe,0xef,0xf3,0x0f,0x94,0x44,0xb8,0x08,0xdd,0xdd,0x80,
+0x69,0x01,0xf0,0x23,0x46,0x92,0x00,0x07,0xab,0xcd,0xef,0xff,0xff,0xfe,0x10,0x08,
+0xff,0xff,0xed,0xcb,0x97,0x63,0x00,0x01,0x25,0x00,0x5c,0x30,0x00,0xec,0x10,0x00,
+0xbf,0x40,0x5f,0xb0,0x07,0xfb,0x00,0x00,0x3f,0xd0,0x0f,0xd0,0x1f,0xf2,0x00,0x00,
+0x0c,0xc1,0x0e,0xc0,0x7f,0x60,0x2d,0x06,0x41,0x1f,0xf0,0x02,0x00,0x25,0x06,0x00,
+0x38,0x03,0xb0,0x1c,0xcc,0xce,0xff,0xff,0xec,0xcc,0xc1,0x00,0x00,0x5f,0x26,0x03,
+0xf0,0x16,0x00,0x00,0x19,0xff,0x6f,0xf5,0xff,0x91,0x00,0x18,0xff,0xe3,0x0f,0xf0,
+0x3e,0xff,0x81,0x3f,0xfa,0x10,0x0f,0xf0,0x01,0x9f,0xe2,0x04,0x30,0x00,0x0f,0xf0,
+0x00,0x03,0x30,0x00,0x00,0x36,0x30,0x7c,0x00,0x40,0x3c,0xef,0xff,0xda,0x00,0x07,
+0xf1,0x45,0x1a,0x9f,0xd3,0x06,0xfe,0xaa,0xcf,0xc0,0x2b,0x1f,0xb6,0xd1,0x6f,0x62,
+0xef,0x30,0x0e,0x7f,0xbc,0xc0,0x0b,0xfe,0xf5,0x00,0x08,0x6f,0xb9,0x40,0x3b,0xff,
+0xd4,0x00,0x3a,0xaf,0xea,0x9c,0xff,0xba,0xff,0xe6,0x5e,0xff,0xfe,0xbe,0xa2,0xef,
+0x4b,0xf2,0x00,0x9f,0xf5,0x02,0x33,0xff,0x33,0x30,0x03,0xff,0xff,0x78,0xff,0xff,
+0xff,0x80,0x1e,0xef,0xbb,0xa2,0x44,0xff,0x44,0x20,0x7f,0x6f,0xb0,0x1a,0xaa,0xff,
+0xaa,0xa2,0x1a,0x0f,0xb0,0x2f,0xa8,0x02,0x74,0x0f,0xb0,0x00,0x00,0xef,0x00,0x00,
+0x08,0x00,0x00,0xd2,0x01,0x61,0x23,0x57,0x80,0x00,0x00,0xbe,0xd8,0x09,0xf0,0x20,
+0x00,0x00,0x69,0x98,0x8f,0xe5,0x32,0x00,0x00,0x1b,0xbb,0xbb,0xbf,0xfb,0xbb,0xbb,
+0xb2,0x2e,0xee,0xee,0xef,0xfe,0xee,0xee,0xe2,0x00,0x36,0x66,0x6f,0xe6,0x66,0x64,
+0x00,0x00,0x8f,0xed,0xdf,0xfd,0xde,0xfa,0x00,0x00,0x8f,0xb8,0x8f,0xf8,0x8a,0x08,
+0x00,0x40,0x96,0x7f,0xf6,0x69,0x08,0x00,0x10,0xff,0x90,0x0a,0x00,0x89,0x07,0xf2,
+0x0f,0x5f,0xe4,0x44,0x43,0x00,0x00,0xee,0xee,0xff,0xfe,0xee,0xee,0x30,0x00,0x88,
+0x88,0x9f,0xf8,0x88,0x88,0x20,0x28,0x88,0x88,0x8f,0xf8,0x88,0x88,0x82,0x3f,0x20,
+0x01,0x12,0xf4,0xaf,0x08,0x80,0xf2,0x00,0x00,0x3f,0xec,0xcc,0xcc,0xcf,0x08,0x00,
+0x64,0xc5,0x55,0x55,0x5d,0xf2,0x00,0x18,0x00,0x21,0x16,0x66,0x01,0x00,0x31,0x61,
+0x3e,0xee,0x01,0x00,0xf0,0x08,0xe3,0x00,0x49,0x99,0x99,0x99,0x99,0x95,0x00,0x00,
+0x7f,0x96,0x6f,0xf6,0x69,0xf8,0x00,0x00,0x7f,0xfe,0xef,0xfe,0xef,0x08,0x00,0x80,
+0xa8,0x8f,0xf8,0x8b,0xf8,0x00,0x00,0x58,0x60,0x00,0x40,0x85,0x00,0x00,0xdf,0x40,
+0x00,0x40,0xfd,0x00,0x15,0x66,0xb0,0x00,0x25,0x66,0x51,0x70,0x00,0x05,0x01,0x00,
+0xf1,0x3c,0x7f,0x60,0x1d,0x80,0x00,0x00,0x09,0xf4,0x7f,0x60,0x7f,0xc3,0x33,0x30,
+0x09,0xf4,0x7f,0x61,0xef,0xff,0xff,0xf2,0x09,0xf4,0x7f,0x6b,0xfa,0xad,0x65,0x50,
+0x09,0xf4,0x7f,0x68,0xc0,0xbf,0xc2,0x00,0x07,0xd3,0x6e,0x9d,0xd2,0x05,0xea,0x00,
+0x00,0x03,0xaf,0xfc,0xdf,0xa5,0x20,0x00,0x4a,0xef,0xff,0xa4,0x4a,0xff,0xfe,0xb4,
+0x1f,0xea,0x9f,0xff,0xff,0xf8,0x8d,0xe1,0x02,0x00,0x02,0x2f,0xf2,0xa0,0x0a,0x11,
+0xff,0x98,0x09,0xf2,0x0a,0x00,0x68,0xd7,0x7f,0xf7,0x8d,0xa7,0x00,0x00,0x07,0xf6,
+0x0f,0xe0,0x6f,0x80,0x00,0x08,0x8a,0xfb,0x8f,0xf8,0xdf,0xa8,0x80,0x0f,0x80,0x00,
+0x15,0xf0,0x7f,0x00,0x20,0x7c,0x30,0x98,0x0a,0x01,0xdd,0x0a,0x00,0x08,0x00,0x40,
+0x07,0xff,0xff,0xc0,0x08,0x00,0x40,0x3f,0xfd,0xdd,0xa0,0x08,0x00,0x31,0x7f,0x80,
+0x00,0x18,0x00,0xc1,0x0c,0xff,0xff,0x78,0x88,0xff,0x98,0x82,0x03,0xaf,0xfa,0x7f,
 0xc0,0x00,0xe0,0x0f,0xd0,0x15,0x55,0xef,0x65,0x51,0x0b,0xbf,0xfb,0x80,0x00,0xdf,
-0x10,0x68,0x02,0x01,0x30,0x00,0x02,0x99,0x75,0x01,0x08,0x00,0x11,0x40,0x08,0x00,
-0x31,0x1f,0xfe,0xf0,0x08,0x00,0x31,0x9f,0xfc,0x50,0x08,0x00,0x10,0x3c,0x99,0xd2,
-0x07,0x41,0x06,0x22,0x7a,0x10,0x5a,0x85,0x12,0xef,0x08,0x00,0x01,0x25,0x08,0x11,
-0xdf,0xb8,0x57,0x71,0x85,0x55,0xef,0x55,0x50,0x5f,0x90,0x2f,0x44,0x00,0xfc,0x34,
-0xf0,0x05,0x6e,0xe7,0xef,0x7d,0xf1,0x01,0xaf,0xea,0x4e,0xc0,0xdf,0x0b,0xf1,0x00,
-0x0f,0xc0,0x0e,0xc0,0xdf,0x0b,0xec,0xd6,0x10,0xae,0x3d,0x49,0x41,0x0b,0xbf,0xfb,
-0x7e,0x70,0x08,0x01,0x18,0x00,0x10,0x1c,0x08,0x00,0x40,0x43,0x30,0xdf,0x01,0x43,
-0x7c,0x11,0xe0,0x60,0x00,0x31,0xbf,0xfa,0x30,0x08,0x00,0x22,0x5a,0x20,0x70,0x00,
-0x15,0x42,0x7a,0xe2,0x10,0x0c,0x80,0x06,0xf0,0x04,0x07,0xff,0xff,0x99,0xbe,0xfc,
-0xcf,0xa0,0x2f,0xfd,0xdd,0x80,0x0a,0xf3,0x3f,0x90,0x4f,0x70,0x00,0x33,0x52,0xf0,
-0x06,0x80,0x0b,0xff,0xff,0x40,0x0d,0xf0,0x5f,0x70,0x02,0xaf,0xea,0x34,0x7f,0xf7,
-0xaf,0x60,0x00,0x0f,0xb0,0x0a,0x41,0x1a,0x80,0x0b,0xbf,0xeb,0x83,0x8f,0xb5,0xbf,
-0x40,0x88,0x98,0x70,0x5f,0x70,0x9f,0x30,0x00,0x0f,0xb0,0xe1,0x98,0xb0,0x20,0x00,
-0x0f,0xc6,0xb0,0x9f,0x30,0xcf,0x00,0x00,0x0f,0xe1,0x0e,0xe9,0xef,0x00,0x00,0x7f,
-0xf8,0xae,0xff,0xee,0xff,0xe7,0x00,0x8d,0x20,0xaf,0x9e,0xf1,0x51,0x79,0x10,0x00,
-0x10,0xde,0x98,0x2c,0xf0,0x0d,0x0d,0xc0,0xde,0x0a,0xe1,0x07,0xff,0xff,0xb8,0xf5,
-0xde,0x2f,0xa0,0x2f,0xfa,0xaa,0x71,0xf8,0xde,0x7f,0x10,0x6f,0x70,0x00,0x06,0xa8,
-0xff,0x8a,0x9c,0x59,0x11,0x6c,0xcf,0x59,0x70,0xbf,0xda,0x4c,0xf2,0x55,0x3f,0xc0,
-0xdf,0x59,0xb0,0xf0,0xfe,0x0f,0xc0,0x0b,0xcf,0xeb,0x6c,0xf0,0xfe,0x0f,0x40,0x37,
-0x10,0x7c,0x08,0x00,0x00,0x18,0x00,0x20,0xf1,0xfc,0x08,0x00,0x40,0x92,0x3c,0xf7,
-0xf8,0xb0,0x46,0xf0,0x0b,0xef,0x91,0x7f,0xf8,0xb3,0x00,0x00,0xaf,0xfb,0x6a,0xff,
-0x39,0xff,0x91,0x01,0xed,0x40,0xcf,0xb2,0x00,0x2c,0xf5,0x00,0x10,0x00,0x13,0x6f,
-0x1b,0x00,0x80,0x00,0x31,0xcf,0x01,0xfa,0x74,0x03,0x00,0x08,0x00,0x70,0x07,0xff,
-0xcc,0x7b,0xff,0xbb,0xfe,0xce,0xa3,0x01,0x38,0x88,0x30,0x6f,0x71,0x11,0x18,0x00,
-0x00,0x8d,0x54,0x91,0x8a,0xef,0xab,0xfe,0xa6,0x02,0x9f,0xd8,0x8f,0x51,0x03,0x21,
-0x1f,0x90,0x77,0x56,0x41,0x1e,0xef,0xfe,0x89,0x39,0x2a,0xd0,0xdf,0xec,0x79,0xf8,
-0x77,0x8f,0xb0,0x00,0x1f,0x90,0x09,0xf8,0x77,0x3d,0x59,0x31,0x92,0x29,0xff,0xe9,
-0x09,0x30,0xef,0x69,0xf2,0x9e,0x1a,0xb1,0x8f,0xfd,0x49,0xf9,0x88,0x9f,0xb0,0x00,
-0x7a,0x30,0x09,0x46,0x8d,0x20,0xc4,0x00,0xa8,0x61,0x00,0xe8,0x0f,0xa0,0xaa,0xa4,
-0x7d,0xe7,0x70,0x0a,0xff,0xfa,0xff,0xf4,0x3f,0x32,0xc0,0xda,0xa5,0x0d,0xa3,0x4d,
-0xd8,0xf2,0x5f,0x20,0x00,0x2f,0x5e,0xc7,0x54,0xc1,0xff,0xf2,0x7f,0x12,0x3c,0xd8,
-0xf1,0x03,0xcf,0x91,0xcf,0xe9,0xf6,0x98,0xb0,0x00,0x8a,0xf6,0x4d,0xd4,0x40,0x1c,
-0xef,0xd6,0x14,0xf9,0x49,0xf8,0xc0,0xdf,0xb9,0xfb,0xf2,0x5d,0xd5,0x40,0x00,0x8f,
-0x00,0xef,0xbb,0xa1,0x03,0xd0,0x8f,0x67,0x7f,0x86,0x8e,0xe8,0x81,0x00,0x9f,0xf8,
-0xaf,0xf6,0x08,0xeb,0x3f,0xed,0x65,0xfa,0xdf,0xfc,0xa9,0x96,0x00,0xc3,0x08,0xd0,
-0x06,0xbd,0xff,0xf5,0xc0,0x0a,0x00,0x61,0x22,0x11,0xdb,0x78,0x02,0x12,0x0d,0x95,
-0xc7,0xf1,0x08,0xff,0x56,0xae,0x77,0xeb,0x70,0x2f,0xfb,0xbb,0x40,0x9f,0x11,0xfa,
-0x00,0x5f,0x91,0x11,0x3c,0xef,0xdd,0xfe,0xc3,0x0a,0x75,0x47,0xf0,0x03,0x99,0x92,
-0x02,0x8f,0xc7,0x18,0xdd,0xdd,0xdd,0x90,0x00,0x2f,0x90,0x09,0xf4,0x44,0x5f,0xa0,
-0x00,0x01,0x31,0xfe,0xee,0xff,0x08,0x00,0x40,0xf3,0x33,0x4f,0xa0,0x18,0x00,0x01,
-0xf8,0x09,0xf6,0x0f,0x2f,0xa6,0x51,0x8f,0x7b,0xf4,0x20,0x00,0x5f,0xff,0x90,0xcf,
-0x1a,0xf1,0x72,0x00,0xef,0xf7,0x6c,0xf9,0x0a,0xf6,0xf7,0x00,0x9a,0x10,0xaf,0x80,
-0x05,0xff,0x29,0x17,0x00,0x46,0x13,0x22,0x04,0x71,0x08,0x00,0x21,0x5f,0xf8,0x08,
-0x00,0x11,0x2a,0x1e,0x52,0x41,0xf9,0x2a,0xff,0xe5,0x20,0x00,0x31,0x2e,0xf9,0x10,
-0x08,0x00,0x20,0x03,0x30,0xa6,0x58,0x10,0xcd,0x8e,0x62,0x06,0x72,0xed,0x41,0x02,
-0x28,0xfa,0x24,0xb5,0xc5,0x10,0x06,0xc3,0xc3,0x02,0x50,0x00,0x21,0x3f,0xf5,0x08,
-0x00,0x40,0x01,0x46,0xff,0x80,0xa8,0x12,0x50,0xdf,0xf1,0x7f,0xfe,0x82,0x00,0x57,
-0x86,0x91,0x04,0xdf,0xe1,0x00,0x09,0xa5,0x10,0x60,0xf5,0x02,0xab,0x61,0x01,0x55,
-0x22,0x01,0xef,0xe6,0x20,0x04,0xff,0x9d,0x60,0x30,0xfc,0x56,0x8c,0x04,0x1d,0x02,
-0xf2,0xce,0x0f,0x07,0x00,0x2b,0x30,0x09,0xcd,0xfa,0x07,0x00,0x15,0x07,0x3a,0x5a,
-0x22,0x07,0x20,0xf7,0x29,0x11,0xe1,0x1f,0x0b,0x30,0x09,0xfa,0x5b,0x5f,0x2e,0x20,
-0x11,0x81,0xda,0x89,0x31,0xef,0xef,0x00,0x3a,0x82,0x71,0xef,0x01,0x11,0x13,0xfd,
-0x11,0xef,0xcf,0xad,0xe0,0xf8,0xef,0xef,0x1a,0xaa,0xdf,0xff,0xa5,0xef,0xef,0x00,
-0x04,0xff,0xfd,0x23,0x00,0x20,0x5f,0xf8,0x07,0x00,0x30,0x2b,0xff,0x51,0x07,0x00,
-0x30,0x7f,0xb2,0x02,0x07,0x00,0x40,0x03,0x06,0xcc,0xfc,0x1c,0x00,0x61,0x03,0xff,
-0xd4,0x6b,0xfe,0xef,0x60,0x00,0x14,0xe6,0x70,0x00,0x03,0x86,0x19,0x20,0xc0,0x6f,
-0x7f,0x05,0x30,0x08,0xfb,0x5c,0xfe,0xc3,0x21,0x11,0x96,0x31,0x08,0x23,0xcf,0x10,
-0x07,0x00,0x50,0xaa,0xaa,0xa9,0x01,0xfd,0x72,0xd6,0x30,0xfd,0x01,0xfd,0xe0,0xd7,
-0x0e,0x07,0x00,0x04,0x1c,0x00,0x30,0xfd,0xaa,0xa8,0x31,0x00,0x14,0x43,0x3f,0x00,
-0x32,0x06,0xde,0xfb,0xee,0xd7,0x04,0xe0,0x00,0x03,0x1f,0x5f,0x21,0x1f,0xe2,0xf8,
-0xe9,0x30,0x05,0xfd,0x2b,0x24,0xc1,0x30,0x55,0x9f,0x40,0x0f,0x19,0x40,0xde,0x13,
-0x00,0xeb,0x07,0x00,0x80,0x02,0x22,0xec,0x22,0x21,0xfc,0xde,0x2f,0xd9,0x06,0x90,
-0xfc,0xde,0x05,0x5d,0xff,0xc5,0x52,0xfc,0xde,0x16,0xe3,0xf0,0x0a,0x00,0xfc,0xde,
-0x03,0xec,0xfc,0xcf,0x60,0xfc,0xde,0x5f,0xf2,0xec,0x1d,0xf3,0xfc,0xde,0x4e,0x30,
-0xec,0x03,0x70,0xfc,0xde,0x00,0x64,0x69,0x00,0x07,0x00,0x51,0xdb,0x09,0xdd,0xfb,
-0xde,0x94,0x60,0x0d,0x50,0x01,0x10,0x9f,0x90,0x1a,0x91,0x08,0xfb,0x7c,0xcc,0xcc,
-0xcc,0xfe,0x12,0x70,0xf0,0x0c,0x22,0xef,0x10,0x07,0x00,0x01,0xa4,0xd8,0x60,0xfe,
-0xef,0x11,0xfc,0x77,0xdf,0x07,0x00,0x00,0x51,0x1b,0x0d,0x15,0x00,0x18,0xf9,0x15,
-0x00,0x43,0x10,0x88,0x88,0x88,0x3f,0x00,0x31,0x7b,0xfd,0xef,0x7c,0x9e,0x1b,0xe5,
-0xb1,0xa2,0xf0,0x10,0xff,0xf6,0x7e,0xee,0xee,0xeb,0xcf,0xbd,0xf8,0x8f,0xdc,0xcc,
-0xfc,0xcf,0x0a,0xf3,0x8f,0x40,0x00,0xfc,0xcf,0x0d,0xe0,0x8f,0x50,0x01,0xfc,0xcf,
-0x2f,0x80,0x8f,0x5a,0xd9,0x82,0x2f,0xb0,0x8f,0xca,0xaa,0xfc,0xcf,0x09,0x1c,0x00,
-0xa0,0x05,0xf7,0x9f,0x85,0x55,0xfc,0xcf,0x05,0xf8,0xaf,0x1c,0x00,0xe0,0x8f,0xf5,
-0xcf,0x65,0x55,0xfc,0xcf,0x3b,0x71,0xfd,0x00,0x00,0xfc,0xcf,0xfd,0x02,0x00,0x07,
-0x00,0xc7,0x1e,0xf3,0x00,0xdf,0xfb,0xcf,0x00,0x3d,0xa0,0x00,0x9d,0xb2,0x6d,0x00,
-0x20,0x2b,0x80,0xbf,0x24,0x20,0x70,0x09,0x38,0xf0,0x50,0xce,0xf9,0x02,0xff,0xfa,
-0x6a,0x8d,0xf0,0x15,0x11,0xdf,0x8c,0xf9,0x00,0xdf,0x3f,0x92,0xdf,0xb0,0x1d,0xfd,
-0x3d,0xf9,0xf5,0xef,0xb0,0x00,0x1a,0xf8,0xdf,0x2e,0xd4,0x89,0x70,0x18,0x64,0x0d,
-0xf0,0x7f,0x61,0xfc,0x03,0xfa,0x00,0xdf,0x0f,0x55,0x61,0x3f,0xa0,0x0d,0xf0,0x4f,
-0xa1,0x0f,0x00,0xd0,0xcf,0xf6,0x3f,0xb0,0x3f,0xa0,0x0d,0xf6,0xb6,0x07,0xf8,0x03,
-0xfa,0xfd,0x05,0x20,0xef,0x40,0x1e,0x00,0x30,0x00,0xaf,0xd0,0x0f,0x00,0x00,0xbd,
-0xc8,0x19,0x3e,0x70,0x74,0x70,0x39,0x10,0x00,0x0d,0xff,0xfe,0x50,0x87,0x0f,0x60,
-0xdf,0xad,0xf8,0x00,0x2f,0xa0,0x78,0x00,0x01,0x02,0x49,0xf0,0x23,0xdf,0x1f,0xba,
-0xf9,0x99,0x99,0xdf,0x1d,0xf6,0xf5,0xaf,0xeb,0x00,0x0a,0xf1,0xdf,0x6f,0x60,0x2f,
-0xc0,0x00,0x10,0x0d,0xf0,0xbf,0x11,0xfc,0x03,0xdc,0x10,0xdf,0x05,0xf5,0x1f,0xeb,
-0xff,0xa2,0x0d,0xf0,0x6f,0x71,0xff,0xf9,0x30,0x00,0xdf,0xbf,0xf4,0x1f,0xd0,0xce,
-0xcb,0x71,0xb6,0x01,0xfc,0x00,0x06,0x81,0xdf,0xb5,0x2c,0x90,0xaf,0x2d,0xf0,0x00,
-0x00,0xff,0xfe,0xef,0xe0,0x76,0xc0,0x32,0xcd,0xdd,0xc4,0x0c,0x34,0x00,0x51,0x18,
-0x30,0xfc,0x00,0xee,0x7d,0x0b,0xf0,0x3c,0xaf,0xe0,0x6f,0x70,0x02,0xfa,0x0b,0xe0,
-0xfa,0x0d,0xf1,0x00,0x3f,0xa0,0xbe,0x4f,0x67,0xfb,0x7f,0xff,0xff,0xdb,0xe7,0xf4,
-0xff,0xb5,0xbb,0xcf,0xe9,0xbe,0x9f,0x8f,0xfb,0x00,0x02,0xfa,0x0b,0xe2,0xf8,0x8e,
-0xb4,0xe4,0x2f,0xa0,0xbe,0x0d,0xd0,0xeb,0x1f,0xb2,0xfa,0x0b,0xe0,0xbe,0x0e,0xb0,
-0xaf,0x4f,0xa0,0xbe,0x8f,0xd0,0xeb,0x04,0xb4,0xfa,0x0b,0xeb,0xf5,0x0e,0xb0,0x00,
-0x2f,0xa0,0xbe,0x31,0x5b,0x00,0x4b,0x00,0x70,0x00,0x0e,0xb0,0x0d,0xff,0x90,0xbe,
-0xf0,0x04,0x11,0xae,0xce,0x27,0x00,0x5f,0xa8,0x10,0x0e,0x32,0x8e,0xf0,0x2c,0xa0,
-0x00,0x00,0xee,0xbf,0xf0,0x6f,0xff,0xff,0xf5,0x0e,0xb3,0xf9,0x8f,0xfb,0x69,0xfd,
-0x00,0xeb,0x8f,0x3d,0xdc,0xf8,0xee,0x30,0x0e,0xbd,0xc0,0x11,0x6f,0xff,0xa3,0x00,
-0xeb,0x8f,0x7b,0xff,0xf8,0xdf,0xfe,0x5e,0xb0,0xfc,0xfe,0x91,0xdc,0x6b,0xd0,0xeb,
-0x0b,0xf5,0xa9,0x9f,0xf9,0x97,0x0e,0xb0,0xcf,0x4f,0xe5,0x05,0xf2,0x01,0xed,0xef,
-0xa2,0xa4,0x0f,0xe0,0x00,0x0e,0xb7,0x60,0x8f,0xb9,0xff,0x99,0x91,0xeb,0x6e,0x26,
-0x22,0x2e,0xb0,0x4d,0xc2,0x17,0xeb,0xbf,0x29,0x07,0x7b,0x3e,0x02,0x7c,0x38,0xc0,
-0x10,0xbf,0xad,0xf6,0xef,0xaa,0xae,0xf1,0x0b,0xe0,0xaf,0x1e,0xa4,0x59,0x40,0xbe,
-0x0f,0xc0,0xef,0xe7,0x07,0xd1,0xe3,0xf6,0x0e,0xf7,0x77,0xdf,0x10,0xbe,0x3f,0x90,
-0xef,0x00,0x0c,0x1e,0x00,0x00,0x2d,0x00,0xf8,0x26,0xbe,0x05,0xf5,0xef,0xaf,0xc9,
-0xc0,0x0b,0xe0,0x6f,0x6e,0xf0,0xdc,0x4f,0x90,0xbe,0x8f,0xf3,0xef,0x08,0xff,0xe5,
-0x0b,0xe4,0xa5,0x0e,0xf0,0x1f,0xf2,0x00,0xbe,0x00,0x00,0xff,0x47,0x9f,0xb1,0x0b,
-0xe0,0x00,0x5f,0xff,0xf2,0xbf,0xe1,0xbe,0x00,0x02,0xe9,0x51,0x00,0x88,0x00,0x51,
-0xa8,0x11,0x60,0xf0,0x00,0x20,0x08,0xfc,0xf0,0x00,0xf0,0x11,0xc0,0x06,0xfe,0xfa,
-0x00,0x0e,0xb2,0xf7,0x08,0xfd,0x1a,0xfc,0x20,0xeb,0x6f,0x6c,0xfd,0x10,0x0a,0xff,
-0x6e,0xba,0xd2,0xef,0xca,0xaa,0xae,0xe1,0xeb,0x9f,0x11,0xaf,0x67,0x1b,0x21,0xb2,
-0xf7,0x13,0xa3,0xa1,0xeb,0x0e,0xbb,0xbb,0xcf,0xfb,0xbb,0x4e,0xb0,0xec,0xaa,0x4d,
-0xf0,0x10,0xec,0xef,0x90,0x52,0x1f,0xc1,0x70,0x0e,0xb9,0x91,0x5f,0xa1,0xfc,0x6f,
-0x90,0xeb,0x00,0x3f,0xe1,0x1f,0xc0,0xaf,0x5e,0xb0,0x05,0xe3,0x9c,0xfb,0x01,0xc4,
-0xeb,0xf5,0x66,0x19,0x40,0x0a,0x30,0x10,0x83,0xe1,0x42,0x30,0xa0,0x08,0xf9,0x77,
-0x00,0xf0,0x37,0xd0,0x1f,0xfd,0xbb,0xb4,0xeb,0x3f,0x70,0xbf,0xff,0xff,0xf7,0xeb,
-0x7f,0x2a,0xfc,0x00,0x3f,0xd0,0xeb,0xbd,0x8f,0xe2,0x00,0xdf,0x30,0xeb,0x9f,0x3b,
-0x39,0xb0,0x66,0x00,0xeb,0x1f,0x88,0xff,0xa7,0xff,0xfc,0xeb,0x0e,0xbc,0xf2,0x03,
-0x99,0xfd,0xeb,0x0e,0xcc,0xf0,0x00,0x00,0xfd,0xec,0xff,0x9c,0xff,0xf8,0xff,0xfd,
-0xeb,0x98,0x1c,0xf8,0x84,0x88,0xfd,0xeb,0x00,0x04,0x25,0x00,0x07,0x00,0x00,0xd6,
-0x04,0x71,0xeb,0x00,0x0b,0xf9,0x99,0x99,0xfc,0x0c,0x0e,0x10,0x81,0x15,0x38,0x10,
-0x10,0x27,0x15,0x21,0xee,0xcf,0xe0,0xef,0x40,0x4e,0xb6,0xf5,0xfa,0x9f,0xa4,0xa1,
-0xeb,0x9f,0x08,0x91,0xff,0x66,0x64,0x0e,0xbd,0xb0,0x01,0x18,0xc0,0xeb,0xf9,0x58,
-0xbf,0xff,0x11,0xfb,0x0e,0xb8,0xfb,0xff,0x5a,0x0f,0x00,0xf3,0x22,0x3f,0x58,0xf1,
-0xaf,0x22,0xfb,0x0e,0xb1,0xf7,0x8f,0x1a,0xff,0xff,0xb0,0xec,0x7f,0x78,0xf1,0xaf,
-0x55,0xfb,0x0e,0xcf,0xf2,0x8f,0x1a,0xf0,0x6f,0xb0,0xeb,0x52,0x3d,0xf5,0x9e,0x0a,
-0xe5,0x0e,0xb0,0x2f,0xc9,0xfe,0xba,0xaa,0xb4,0xeb,0x00,0xa1,0x03,0xae,0x13,0xcd,
-0x07,0x93,0xee,0x02,0x7a,0x7a,0x40,0xf6,0xee,0xbf,0xc7,0x13,0x0b,0x21,0x3e,0xb4,
-0xc4,0x43,0xf0,0x04,0x90,0xeb,0x8f,0x11,0xfa,0x44,0x45,0xfa,0x0e,0xbc,0xc0,0x1f,
-0xec,0xcc,0xcf,0xa0,0xeb,0x9f,0x10,0xf0,0xb7,0x21,0x0e,0xb1,0x56,0xb4,0xf0,0x10,
-0xf2,0xeb,0x0e,0xca,0xf7,0xa6,0x88,0xbf,0x2e,0xb0,0xec,0xaf,0x4f,0x37,0xf8,0xf2,
-0xed,0xff,0x9a,0xf0,0xc8,0xe8,0x7f,0x2e,0xb9,0x81,0xaf,0x8f,0xff,0xf8,0xf2,0xdb,
-0xd7,0xa0,0x4f,0xa3,0x8f,0x2e,0xb0,0x00,0xaf,0x00,0xf8,0x4c,0x0f,0x00,0x49,0xf0,
-0x0f,0x86,0xfb,0xf5,0x5f,0x10,0x84,0x62,0x09,0xa1,0xfb,0x57,0x79,0xfc,0x77,0x70,
-0x0f,0xea,0xfe,0x9f,0x38,0x55,0xa1,0xa1,0xf9,0x02,0xfa,0x01,0xfa,0x00,0x0f,0xa5,
-0xf6,0xc5,0x28,0x31,0x0f,0xa9,0xe1,0x6d,0x28,0x40,0x0f,0xa8,0xf2,0x3c,0x8c,0x30,
-0xc1,0x0f,0xa1,0xfa,0x3f,0xc5,0x55,0x7f,0xb0,0x0f,0xa0,0xcd,0x3f,0xfc,0x30,0xa2,
-0xa0,0xce,0x3f,0xb3,0x33,0x5f,0xb0,0x0f,0xad,0xfc,0x10,0x00,0xa2,0xaa,0xc3,0x12,
-0x23,0xfd,0x22,0x20,0x0f,0xa0,0x01,0x40,0x00,0xab,0xa0,0x00,0x77,0x78,0xfe,0x77,
-0x73,0x0f,0xa0,0x00,0x20,0xa5,0x32,0x86,0x02,0x83,0x8f,0x8d,0x43,0x15,0xfb,0x11,
-0x11,0x37,0x4b,0x00,0x7b,0x4e,0x82,0xa5,0x58,0xfb,0x55,0x55,0x20,0x5f,0xff,0x7b,
-0x0c,0x20,0x09,0xaf,0x10,0x00,0x13,0x53,0x5d,0x85,0x00,0xb1,0xa3,0x30,0x94,0x47,
-0xfa,0x8b,0x0c,0x13,0x6f,0x7d,0x1a,0x74,0x37,0x66,0x6f,0xf6,0x66,0x66,0x50,0x98,
-0xd2,0xf0,0x0b,0x17,0x77,0x9f,0xff,0xff,0xfa,0x77,0x71,0x00,0x4a,0xff,0x9f,0xf8,
-0xff,0xa4,0x00,0x6f,0xff,0xc3,0x0f,0xe0,0x2b,0xff,0xf4,0x0b,0x82,0x5e,0x28,0x42,
-0x28,0x90,0x00,0xef,0x04,0x37,0x20,0x02,0x77,0x4c,0x30,0x24,0x77,0x20,0xcb,0x0b,
-0xf0,0x00,0x0f,0xa6,0x77,0x4f,0xe5,0x77,0x6b,0xf0,0x0b,0x76,0x77,0x3f,0xe4,0x77,
-0x58,0x64,0x13,0x30,0x8b,0xc9,0xff,0xfd,0x44,0xf4,0x11,0x26,0xcf,0xf8,0x21,0x10,
+0x10,0x68,0x02,0x01,0x30,0x00,0x01,0x7b,0x08,0x02,0x08,0x00,0x11,0x40,0x08,0x00,
+0x31,0x1f,0xfe,0xf0,0x08,0x00,0x31,0x9f,0xfc,0x50,0x08,0x00,0x22,0x3c,0x40,0x20,
+0x00,0x04,0x01,0x00,0x92,0x7a,0x10,0x00,0x00,0xdf,0x00,0x00,0x00,0xef,0x08,0x00,
+0x00,0x25,0x08,0x00,0x08,0x00,0xc0,0x2f,0xfc,0xcc,0x85,0x55,0xef,0x55,0x50,0x5f,
+0x90,0x00,0x0e,0xc0,0x02,0xf0,0x05,0x0b,0xff,0xff,0x6e,0xe7,0xef,0x7d,0xf1,0x01,
+0xaf,0xea,0x4e,0xc0,0xdf,0x0b,0xf1,0x00,0x0f,0xc0,0x0e,0x08,0x00,0xc1,0x1f,0xff,
+0xff,0xae,0xfc,0xff,0xcf,0xf1,0x0b,0xbf,0xfb,0x7e,0x70,0x08,0x01,0x18,0x00,0x10,
+0x1c,0x08,0x00,0x91,0x43,0x30,0xdf,0x01,0x20,0x00,0x3f,0xff,0xe0,0x60,0x00,0x31,
+0xbf,0xfa,0x30,0x08,0x00,0x22,0x5a,0x20,0x70,0x00,0x13,0x42,0x3f,0x04,0x30,0xfc,
+0x00,0x0c,0x80,0x06,0xf0,0x03,0x07,0xff,0xff,0x99,0xbe,0xfc,0xcf,0xa0,0x2f,0xfd,
+0xdd,0x80,0x0a,0xf3,0x3f,0x90,0x4f,0x70,0x58,0x06,0xf0,0x06,0x4f,0x80,0x0b,0xff,
+0xff,0x40,0x0d,0xf0,0x5f,0x70,0x02,0xaf,0xea,0x34,0x7f,0xf7,0xaf,0x60,0x00,0x0f,
+0xb0,0xd9,0x05,0xf0,0x02,0x50,0x0b,0xbf,0xeb,0x83,0x8f,0xb5,0xbf,0x40,0x1f,0xff,
+0xff,0xb0,0x5f,0x70,0x9f,0x30,0xc0,0x02,0xb0,0x7f,0x50,0xbf,0x20,0x00,0x0f,0xc6,
+0xb0,0x9f,0x30,0xcf,0xd9,0x03,0xf1,0x03,0xe0,0xcf,0x10,0xef,0x00,0x00,0x7f,0xf8,
+0xae,0xff,0xee,0xff,0xe7,0x00,0x8d,0x20,0xaf,0xff,0x69,0x06,0x03,0x01,0x00,0x60,
+0x79,0x10,0x00,0x10,0xde,0x00,0xf4,0x02,0xf0,0x12,0x0d,0xc0,0xde,0x0a,0xe1,0x07,
+0xff,0xff,0xb8,0xf5,0xde,0x2f,0xa0,0x2f,0xfa,0xaa,0x71,0xf8,0xde,0x7f,0x10,0x6f,
+0x70,0x00,0x06,0xa8,0xff,0x8a,0x70,0x0c,0xff,0xff,0x6c,0xb0,0x06,0xf0,0x05,0x02,
+0xbf,0xda,0x4c,0xf2,0x55,0x3f,0xc0,0x00,0x1f,0x90,0x0c,0xf0,0xfe,0x0f,0xc0,0x0b,
+0xcf,0xeb,0x6c,0x08,0x00,0x40,0x0f,0xff,0xff,0x7c,0x08,0x00,0x00,0x18,0x00,0x20,
+0xf1,0xfc,0x08,0x00,0xf0,0x17,0x92,0x3c,0xf7,0xf8,0x0f,0xc0,0x00,0x4f,0xef,0x91,
+0x7f,0xf8,0xb3,0x00,0x00,0xaf,0xfb,0x6a,0xff,0x39,0xff,0x91,0x01,0xed,0x40,0xcf,
+0xb2,0x00,0x2c,0xf5,0x00,0x10,0x00,0x13,0x00,0x00,0x00,0x30,0x80,0x00,0x31,0xcf,
+0x01,0xfa,0x74,0x03,0x00,0x08,0x00,0xc0,0x07,0xff,0xcc,0x7b,0xff,0xbb,0xfe,0xb2,
+0x3f,0xff,0xff,0x9f,0x98,0x03,0x31,0x6f,0x71,0x11,0x18,0x00,0xc1,0x0a,0xff,0xff,
+0x8a,0xef,0xab,0xfe,0xa6,0x02,0x9f,0xd8,0x8f,0x51,0x03,0xb0,0x1f,0x90,0x01,0x11,
+0x11,0x11,0x10,0x1e,0xef,0xfe,0x89,0x38,0x01,0xf1,0x06,0x0c,0xdf,0xec,0x79,0xf8,
+0x77,0x8f,0xb0,0x00,0x1f,0x90,0x09,0xf8,0x77,0x7f,0xb0,0x00,0x1f,0x92,0x29,0xff,
+0xe9,0x09,0xf0,0x09,0xef,0x69,0xf2,0x00,0x1f,0xb0,0x00,0x8f,0xfd,0x49,0xf9,0x88,
+0x9f,0xb0,0x00,0x7a,0x30,0x09,0xff,0xff,0xfe,0xa0,0x00,0xc4,0x3d,0x0b,0xf0,0x20,
+0xc0,0x00,0x04,0xf5,0x00,0xaa,0xa4,0x7d,0xe7,0x70,0x0a,0xff,0xfa,0xff,0xf4,0xff,
+0xff,0xf0,0x2f,0xda,0xa5,0x0d,0xa3,0x4d,0xd8,0xf2,0x5f,0x20,0x00,0x2f,0x5e,0xff,
+0xff,0xf8,0x0b,0xff,0xf2,0x7f,0x12,0x3c,0xd8,0xf1,0x03,0xcf,0x91,0xcf,0xe9,0xb0,
+0x02,0xf0,0x0d,0x8f,0x00,0x8a,0xf6,0x4d,0xd4,0x40,0x1c,0xef,0xd6,0x14,0xf9,0xff,
+0xff,0xe0,0x0b,0xdf,0xb9,0xfb,0xf2,0x5d,0xd5,0x40,0x00,0x8f,0x00,0xef,0xbb,0xa1,
+0x03,0xfd,0x10,0x8f,0x67,0x7f,0x86,0x8e,0xe8,0x81,0x00,0x9f,0xf8,0xaf,0xf6,0x08,
+0x80,0x00,0x00,0xdf,0x65,0xfa,0xdf,0xfc,0xa9,0x96,0x00,0xc3,0x08,0xd0,0x06,0xbd,
+0xff,0xf5,0xc0,0x0a,0x51,0x6a,0x20,0x00,0x00,0xdb,0x78,0x02,0x10,0x0d,0x88,0x06,
+0xf0,0x21,0x06,0xff,0xff,0x56,0xae,0x77,0xeb,0x70,0x2f,0xfb,0xbb,0x40,0x9f,0x11,
+0xfa,0x00,0x5f,0x91,0x11,0x3c,0xef,0xdd,0xfe,0xc3,0x0a,0xff,0xff,0x59,0x99,0x99,
+0x99,0x92,0x02,0x8f,0xc7,0x18,0xdd,0xdd,0xdd,0x90,0x00,0x2f,0x90,0x09,0xf4,0x44,
+0x5f,0xa0,0x00,0x01,0x31,0xfe,0xee,0xff,0x08,0x00,0x40,0xf3,0x33,0x4f,0xa0,0x18,
+0x00,0x01,0xf8,0x09,0xf5,0x10,0x2f,0xa6,0x51,0x8f,0x7b,0xf4,0x20,0x00,0x5f,0xff,
+0x90,0xcf,0x1a,0xf1,0x72,0x00,0xef,0xf7,0x6c,0xf9,0x0a,0xf6,0xf7,0x00,0x9a,0x10,
+0xaf,0x80,0x05,0xff,0xe2,0x80,0x00,0x62,0x06,0xf9,0x00,0x00,0x04,0x71,0x08,0x00,
+0x21,0x5f,0xf8,0x08,0x00,0x30,0x2a,0xff,0x80,0x08,0x00,0x31,0x2a,0xff,0xe5,0x20,
+0x00,0x31,0x2e,0xf9,0x10,0x08,0x00,0x10,0x03,0x89,0x05,0x30,0x1c,0xcd,0xfe,0x68,
+0x0d,0x22,0xc2,0x2f,0xc0,0x03,0x90,0xf2,0x02,0x28,0xfa,0x24,0xfd,0x22,0x22,0x20,
+0x38,0x00,0x22,0xbf,0x70,0x50,0x00,0x21,0x3f,0xf5,0x08,0x00,0x20,0x01,0x46,0x48,
+0x00,0xf0,0x04,0x08,0xfe,0xdf,0xf1,0x7f,0xfe,0x82,0x00,0x0f,0xff,0xfd,0x91,0x04,
+0xdf,0xe1,0x00,0x09,0xa5,0x10,0x33,0x08,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x30,0x04,0x30,0x00,0x01,0x00,0xff,0x09,0x1f,0xf3,0x1f,0xff,0xff,0xff,0xfc,
+0x04,0xff,0x4d,0xdd,0xdd,0xdd,0xfc,0x56,0x8c,0x30,0x00,0x00,0x02,0xfc,0xdf,0x10,
+0x00,0x07,0x00,0x2d,0x30,0x09,0xcd,0xfa,0x07,0x00,0x42,0x07,0xff,0xc3,0x00,0x01,
+0x00,0x21,0x07,0x20,0x07,0x00,0xf0,0x27,0x5f,0xe1,0x7f,0xff,0xff,0xff,0xff,0x09,
+0xfa,0x5b,0xbb,0xbb,0xbb,0xff,0x11,0x81,0x00,0x00,0x65,0x00,0xef,0xef,0x00,0x00,
+0x01,0xfd,0x00,0xef,0xef,0x01,0x11,0x13,0xfd,0x11,0xef,0xef,0x2f,0xff,0xff,0xff,
+0xf8,0xef,0xef,0x1a,0xaa,0xdf,0xff,0xa5,0xef,0xef,0x00,0x04,0xff,0xfd,0x23,0x00,
+0x20,0x5f,0xf8,0x07,0x00,0x30,0x2b,0xff,0x51,0x07,0x00,0x30,0x7f,0xb2,0x02,0x07,
+0x00,0x40,0x03,0x06,0xcc,0xfc,0x1c,0x00,0x61,0x03,0xff,0xd4,0x6b,0xfe,0xef,0x60,
+0x00,0x14,0xe6,0x70,0x00,0x02,0x07,0x00,0xf0,0x02,0x6f,0xc0,0x6f,0xff,0xff,0xff,
+0xfd,0x08,0xfb,0x5c,0xcc,0xcc,0xcc,0xfd,0x11,0x96,0x00,0x6b,0x00,0x23,0xcf,0x10,
+0x07,0x00,0xa0,0xaa,0xaa,0xa9,0x01,0xfd,0xcf,0x11,0xff,0xff,0xfd,0x07,0x00,0x2e,
+0xfa,0x00,0x07,0x00,0x04,0x1c,0x00,0x30,0xfd,0xaa,0xa8,0x31,0x00,0x14,0x43,0x3f,
+0x00,0x30,0x06,0xde,0xfb,0x07,0x00,0x15,0x03,0xe0,0x00,0x22,0x03,0x20,0x50,0x01,
+0x20,0xe2,0x2f,0x50,0x01,0xf0,0x03,0x05,0xfd,0x2b,0xbb,0xbb,0xbc,0xfc,0x55,0x9f,
+0x40,0x00,0x00,0x00,0xfc,0xde,0x13,0x00,0xeb,0x07,0x00,0x70,0x02,0x22,0xec,0x22,
+0x21,0xfc,0xde,0x22,0x00,0xf0,0x1c,0xf6,0xfc,0xde,0x05,0x5d,0xff,0xc5,0x52,0xfc,
+0xde,0x00,0x5f,0xff,0xf8,0x00,0xfc,0xde,0x03,0xec,0xfc,0xcf,0x60,0xfc,0xde,0x5f,
+0xf2,0xec,0x1d,0xf3,0xfc,0xde,0x4e,0x30,0xec,0x03,0x70,0xfc,0xde,0x00,0x00,0xec,
+0x00,0x00,0x07,0x00,0x9e,0xdb,0x09,0xdd,0xfb,0xde,0x00,0x00,0x00,0x06,0x50,0x01,
+0xe0,0x9f,0xff,0xff,0xff,0xfe,0x08,0xfb,0x7c,0xcc,0xcc,0xcc,0xfe,0x12,0x70,0xd9,
+0x00,0x32,0xfe,0xef,0x10,0x07,0x00,0xb0,0x11,0xff,0xff,0xff,0x11,0xfe,0xef,0x11,
+0xfc,0x77,0xdf,0x07,0x00,0x4d,0xfa,0x00,0xbf,0x11,0x15,0x00,0x18,0xf9,0x15,0x00,
+0x43,0x10,0x88,0x88,0x88,0x3f,0x00,0x21,0x7b,0xfd,0x07,0x00,0x39,0x5f,0xe5,0x00,
+0x01,0x00,0xf2,0x1d,0xcf,0xff,0xf6,0x7e,0xee,0xee,0xeb,0xcf,0xbd,0xf8,0x8f,0xdc,
+0xcc,0xfc,0xcf,0x0a,0xf3,0x8f,0x40,0x00,0xfc,0xcf,0x0d,0xe0,0x8f,0x50,0x01,0xfc,
+0xcf,0x2f,0x80,0x8f,0xff,0xff,0xfc,0xcf,0x2f,0xb0,0x8f,0xca,0xaa,0xfc,0xcf,0x09,
+0x1c,0x00,0xa0,0x05,0xf7,0x9f,0x85,0x55,0xfc,0xcf,0x05,0xf8,0xaf,0x1c,0x00,0xf1,
+0x02,0x8f,0xf5,0xcf,0x65,0x55,0xfc,0xcf,0x3b,0x71,0xfd,0x00,0x00,0xfc,0xcf,0x00,
+0x06,0xf9,0x07,0x00,0xc7,0x1e,0xf3,0x00,0xdf,0xfb,0xcf,0x00,0x3d,0xa0,0x00,0x9d,
+0xb2,0x6d,0x00,0xf1,0x34,0x2b,0x80,0x00,0x0d,0xff,0xff,0x70,0x09,0xfd,0x00,0x00,
+0xdf,0xce,0xf9,0x02,0xff,0xfa,0x00,0x0d,0xf0,0xcf,0x11,0xdf,0x8c,0xf9,0x00,0xdf,
+0x3f,0x92,0xdf,0xb0,0x1d,0xfd,0x3d,0xf9,0xf5,0xef,0xb0,0x00,0x1a,0xf8,0xdf,0x2e,
+0xd4,0x89,0x70,0x18,0x64,0x0d,0xf0,0x7f,0x61,0xfc,0x03,0xfa,0x00,0xdf,0x03,0xf9,
+0x1f,0xc0,0x3f,0xa0,0x0d,0xf0,0x4f,0xa1,0x0f,0x00,0xb0,0xcf,0xf6,0x3f,0xb0,0x3f,
+0xa0,0x0d,0xf6,0xb6,0x07,0xf8,0x0f,0x00,0x40,0x00,0x00,0xef,0x40,0x1e,0x00,0x31,
+0x00,0xaf,0xd0,0x0f,0x00,0x58,0x05,0xd2,0x00,0x3e,0xa0,0xe5,0x00,0xf0,0x02,0x39,
+0x10,0x00,0x0d,0xff,0xfe,0x50,0x07,0xf7,0x00,0x00,0xdf,0xad,0xf8,0x00,0x2f,0xa0,
+0x78,0x00,0xf0,0x48,0xbf,0xff,0xff,0xff,0xf1,0xdf,0x1f,0xba,0xf9,0x99,0x99,0xdf,
+0x1d,0xf6,0xf5,0xaf,0xeb,0x00,0x0a,0xf1,0xdf,0x6f,0x60,0x2f,0xc0,0x00,0x10,0x0d,
+0xf0,0xbf,0x11,0xfc,0x03,0xdc,0x10,0xdf,0x05,0xf5,0x1f,0xeb,0xff,0xa2,0x0d,0xf0,
+0x6f,0x71,0xff,0xf9,0x30,0x00,0xdf,0xbf,0xf4,0x1f,0xd0,0x00,0x00,0x0d,0xf6,0xb6,
+0x01,0xfc,0x00,0x06,0x81,0xdf,0x00,0x00,0x1f,0xd0,0x00,0xaf,0x2d,0xf0,0x00,0x00,
+0xff,0xfe,0xef,0xe0,0xdf,0x00,0x00,0x05,0xcd,0xdd,0xc4,0x70,0x00,0xf0,0x4d,0x04,
+0x20,0x00,0x00,0x0b,0xff,0xfc,0x00,0xee,0x00,0x2f,0xa0,0xbf,0xaf,0xe0,0x6f,0x70,
+0x02,0xfa,0x0b,0xe0,0xfa,0x0d,0xf1,0x00,0x3f,0xa0,0xbe,0x4f,0x67,0xfb,0x7f,0xff,
+0xff,0xdb,0xe7,0xf4,0xff,0xb5,0xbb,0xcf,0xe9,0xbe,0x9f,0x8f,0xfb,0x00,0x02,0xfa,
+0x0b,0xe2,0xf8,0x8e,0xb4,0xe4,0x2f,0xa0,0xbe,0x0d,0xd0,0xeb,0x1f,0xb2,0xfa,0x0b,
+0xe0,0xbe,0x0e,0xb0,0xaf,0x4f,0xa0,0xbe,0x8f,0xd0,0xeb,0x04,0xb4,0xfa,0x0b,0xeb,
+0xf5,0x0e,0xb0,0x00,0x2f,0xa0,0xbe,0x00,0x00,0xeb,0x00,0x4b,0x00,0xd1,0x00,0x0e,
+0xb0,0x0d,0xff,0x90,0xbe,0x00,0x00,0xdb,0x00,0xae,0xb1,0xe2,0x00,0xf0,0x4a,0x85,
+0x00,0x00,0x0e,0xff,0xfa,0x00,0x9f,0xa0,0x00,0x00,0xee,0xbf,0xf0,0x6f,0xff,0xff,
+0xf5,0x0e,0xb3,0xf9,0x8f,0xfb,0x69,0xfd,0x00,0xeb,0x8f,0x3d,0xdc,0xf8,0xee,0x30,
+0x0e,0xbd,0xc0,0x11,0x6f,0xff,0xa3,0x00,0xeb,0x8f,0x7b,0xff,0xf8,0xdf,0xfe,0x5e,
+0xb0,0xfc,0xfe,0x91,0xdc,0x6b,0xd0,0xeb,0x0b,0xf5,0xa9,0x9f,0xf9,0x97,0x0e,0xb0,
+0xcf,0x4f,0xff,0xff,0xff,0xb0,0xed,0xef,0xa2,0xa4,0x0f,0xe0,0x00,0x0e,0xb7,0x60,
+0x8f,0xb9,0xff,0x99,0x91,0xeb,0x00,0x0d,0xdd,0x03,0x70,0x2e,0xb0,0x00,0x00,0x00,
+0xfe,0x00,0xf4,0x02,0x3a,0x00,0x0f,0xd0,0x40,0x02,0x00,0xe9,0x00,0xf1,0x1b,0xff,
+0x5e,0xff,0xff,0xff,0x10,0xbf,0xad,0xf6,0xef,0xaa,0xae,0xf1,0x0b,0xe0,0xaf,0x1e,
+0xf0,0x00,0xcf,0x10,0xbe,0x0f,0xc0,0xef,0xff,0xff,0xf1,0x0b,0xe3,0xf6,0x0e,0xf7,
+0x77,0xdf,0x10,0xbe,0x3f,0x90,0xef,0x00,0x0c,0x1e,0x00,0x00,0x2d,0x00,0xf8,0x25,
+0xbe,0x05,0xf5,0xef,0xaf,0xc9,0xc0,0x0b,0xe0,0x6f,0x6e,0xf0,0xdc,0x4f,0x90,0xbe,
+0x8f,0xf3,0xef,0x08,0xff,0xe5,0x0b,0xe4,0xa5,0x0e,0xf0,0x1f,0xf2,0x00,0xbe,0x00,
+0x00,0xff,0x47,0x9f,0xb1,0x0b,0xe0,0x00,0x5f,0xff,0xf2,0xbf,0xe1,0xbe,0x00,0x02,
+0xe9,0x51,0x00,0x88,0x75,0x00,0x21,0x0a,0x60,0xf0,0x00,0x20,0x08,0xfc,0xf0,0x00,
+0xf8,0x4f,0xc0,0x06,0xfe,0xfa,0x00,0x0e,0xb2,0xf7,0x08,0xfd,0x1a,0xfc,0x20,0xeb,
+0x6f,0x6c,0xfd,0x10,0x0a,0xff,0x6e,0xba,0xd2,0xef,0xca,0xaa,0xae,0xe1,0xeb,0x9f,
+0x11,0xaf,0xff,0xff,0xc0,0x0e,0xb2,0xf7,0x00,0x01,0xfc,0x00,0x00,0xeb,0x0e,0xbb,
+0xbb,0xcf,0xfb,0xbb,0x4e,0xb0,0xec,0xef,0xff,0xff,0xff,0xf5,0xec,0xef,0x90,0x52,
+0x1f,0xc1,0x70,0x0e,0xb9,0x91,0x5f,0xa1,0xfc,0x6f,0x90,0xeb,0x00,0x3f,0xe1,0x1f,
+0xc0,0xaf,0x5e,0xb0,0x05,0xe3,0x9c,0xfb,0x01,0xc4,0xeb,0x00,0x00,0x08,0xfd,0x40,
+0x77,0x00,0x90,0x01,0x83,0x00,0x00,0xef,0xff,0xa0,0x08,0xf9,0x77,0x00,0xf0,0x3b,
+0xd0,0x1f,0xfd,0xbb,0xb4,0xeb,0x3f,0x70,0xbf,0xff,0xff,0xf7,0xeb,0x7f,0x2a,0xfc,
+0x00,0x3f,0xd0,0xeb,0xbd,0x8f,0xe2,0x00,0xdf,0x30,0xeb,0x9f,0x3b,0x39,0xb0,0x66,
+0x00,0xeb,0x1f,0x88,0xff,0xa7,0xff,0xfc,0xeb,0x0e,0xbc,0xf2,0x03,0x99,0xfd,0xeb,
+0x0e,0xcc,0xf0,0x00,0x00,0xfd,0xec,0xff,0x9c,0xff,0xf8,0xff,0xfd,0xeb,0x98,0x1c,
+0xf8,0x84,0x88,0xfd,0xeb,0x00,0x0c,0xf0,0x00,0x00,0x07,0x00,0x00,0xd6,0x04,0x70,
+0xeb,0x00,0x0b,0xf9,0x99,0x99,0xfc,0x6a,0x00,0xe0,0x05,0x81,0x00,0x0e,0xff,0xf6,
+0x10,0x00,0xbf,0x00,0x00,0xee,0xcf,0xef,0xd4,0x05,0xf0,0x14,0x4e,0xb6,0xf5,0xfa,
+0xad,0xfb,0xaa,0xa2,0xeb,0x9f,0x08,0x91,0xff,0x66,0x64,0x0e,0xbd,0xb0,0x00,0xcf,
+0xff,0xff,0xb0,0xeb,0xf9,0x58,0xbf,0xff,0x11,0xfb,0x0e,0xb8,0xfb,0xff,0x5a,0x0f,
+0x00,0xf9,0x25,0x3f,0x58,0xf1,0xaf,0x22,0xfb,0x0e,0xb1,0xf7,0x8f,0x1a,0xff,0xff,
+0xb0,0xec,0x7f,0x78,0xf1,0xaf,0x55,0xfb,0x0e,0xcf,0xf2,0x8f,0x1a,0xf0,0x6f,0xb0,
+0xeb,0x52,0x3d,0xf5,0x9e,0x0a,0xe5,0x0e,0xb0,0x2f,0xc9,0xfe,0xba,0xaa,0xb4,0xeb,
+0x00,0xa1,0x03,0xae,0xff,0xff,0x20,0xd1,0x01,0x00,0x59,0x01,0x10,0xcf,0xd2,0x04,
+0xa0,0xee,0xbf,0xc7,0x99,0x99,0x99,0x99,0x3e,0xb4,0xf6,0x7f,0x00,0xf0,0x3c,0x90,
+0xeb,0x8f,0x11,0xfa,0x44,0x45,0xfa,0x0e,0xbc,0xc0,0x1f,0xec,0xcc,0xcf,0xa0,0xeb,
+0x9f,0x10,0x77,0x77,0x77,0x75,0x0e,0xb1,0xf9,0xaf,0xff,0xff,0xff,0xf2,0xeb,0x0e,
+0xca,0xf7,0xa6,0x88,0xbf,0x2e,0xb0,0xec,0xaf,0x4f,0x37,0xf8,0xf2,0xed,0xff,0x9a,
+0xf0,0xc8,0xe8,0x7f,0x2e,0xb9,0x81,0xaf,0x8f,0xff,0xf8,0xf2,0xeb,0x00,0x0a,0xf2,
+0x4f,0xa3,0x8f,0x2e,0xb0,0x00,0xaf,0x00,0xf8,0x4c,0x0f,0x00,0x48,0xf0,0x0f,0x86,
+0xfb,0x75,0x00,0xf0,0x00,0x02,0x84,0x00,0x00,0x0f,0xff,0xfb,0x57,0x79,0xfc,0x77,
+0x70,0x0f,0xea,0xfe,0x05,0x05,0xc0,0xf0,0x0f,0xa1,0xf9,0x02,0xfa,0x01,0xfa,0x00,
+0x0f,0xa5,0xf6,0x87,0x02,0xf0,0x0e,0xf7,0x0f,0xa9,0xe1,0x88,0x88,0x88,0x88,0x84,
+0x0f,0xa8,0xf2,0x3c,0xcc,0xcc,0xcc,0x90,0x0f,0xa1,0xfa,0x3f,0xc5,0x55,0x7f,0xb0,
+0x0f,0xa0,0xcd,0x3f,0xbe,0x02,0xb2,0x0f,0xa0,0xce,0x3f,0xb3,0x33,0x5f,0xb0,0x0f,
+0xad,0xfc,0x10,0x00,0xa2,0xaa,0xc3,0x12,0x23,0xfd,0x22,0x20,0x0f,0xa0,0x01,0x40,
+0x00,0xa1,0xa0,0x00,0x77,0x78,0xfe,0x77,0x73,0x0f,0xa0,0x00,0x0d,0x02,0x06,0x01,
+0x00,0x30,0x86,0x02,0x83,0x07,0x00,0xa0,0x09,0xfa,0x15,0xfb,0x11,0x11,0x00,0x00,
+0x5f,0xff,0x01,0x00,0x92,0x60,0x06,0xff,0xa5,0x58,0xfb,0x55,0x55,0x20,0x0f,0x00,
+0x40,0xfa,0x00,0x09,0xaf,0x10,0x00,0x40,0x53,0x00,0x00,0x6f,0x10,0x00,0x93,0xfb,
+0x00,0x00,0x6f,0x94,0x47,0xfa,0x44,0x43,0x10,0x00,0xa0,0xff,0xc0,0x00,0x37,0x66,
+0x6f,0xf6,0x66,0x66,0x50,0x7d,0x00,0x00,0x14,0x01,0xf0,0x14,0x17,0x77,0x9f,0xff,
+0xff,0xfa,0x77,0x71,0x00,0x4a,0xff,0x9f,0xf8,0xff,0xa4,0x00,0x6f,0xff,0xc3,0x0f,
+0xe0,0x2b,0xff,0xf4,0x0b,0x82,0x00,0x0f,0xe0,0x00,0x28,0x90,0x00,0xef,0xff,0xec,
+0x05,0xa2,0x00,0x02,0x77,0x77,0x7f,0xf7,0x77,0x77,0x20,0x0f,0x38,0x00,0xf2,0x2a,
+0xf0,0x0f,0xa6,0x77,0x4f,0xe5,0x77,0x6b,0xf0,0x0b,0x76,0x77,0x3f,0xe4,0x77,0x58,
+0xb0,0x00,0x2f,0xff,0x8b,0xc9,0xff,0xf1,0x00,0x00,0x01,0x26,0xcf,0xf8,0x21,0x10,
 0x00,0x00,0x49,0xef,0xea,0xcf,0xfb,0x74,0x10,0x5f,0xff,0xd6,0x3f,0x83,0x9e,0xff,
-0xf5,0x0a,0xa9,0x66,0x6d,0xf6,0x66,0x98,0x90,0x00,0x6f,0x43,0x2a,0x31,0x27,0x30,
-0x29,0x81,0xcf,0x13,0x6e,0x8c,0x80,0x46,0x00,0x27,0xcf,0xf9,0x68,0x01,0x06,0x9f,
-0x4d,0x00,0xd9,0x48,0x25,0x76,0x00,0x78,0x00,0xf2,0x11,0xc6,0x66,0x5f,0xe5,0x66,
-0x6c,0xf0,0x0f,0xac,0xff,0x7e,0xd8,0xff,0xbb,0xf0,0x05,0x46,0x66,0x3e,0xd3,0x66,
-0x64,0x50,0x00,0x1c,0xcc,0x6d,0xc7,0xcc,0xc1,0x00,0x0a,0xf5,0x59,0x20,0xa1,0x1b,
-0x44,0x03,0x00,0xaf,0x4f,0x20,0x78,0x88,0x76,0x35,0x13,0x20,0x84,0x83,0x82,0x40,
-0x00,0xee,0x07,0xf3,0x0f,0xa0,0x9f,0x08,0x00,0xac,0xa7,0xdf,0x30,0x00,0xee,0x06,
-0xe3,0x0e,0x99,0xfb,0x45,0xc2,0x22,0x00,0x02,0xab,0x0d,0x30,0x20,0x0f,0xfb,0x03,
-0x0e,0xf0,0x08,0xbf,0xf0,0x0f,0xca,0xcc,0x7d,0xf6,0xcc,0xac,0xf0,0x09,0x74,0x44,
-0x3d,0xf2,0x44,0x48,0x90,0x00,0x19,0x99,0x6b,0xd5,0x25,0xf8,0x02,0x9b,0x0d,0x10,
-0x90,0x0a,0x35,0x01,0xd5,0x7e,0x22,0xfc,0x9f,0x30,0x01,0x20,0xfd,0x67,0x10,0x00,
-0x23,0x41,0x03,0x7b,0x0d,0xf3,0x0c,0x08,0xf6,0x6f,0x70,0x4f,0xb4,0xde,0x10,0x1e,
-0xf2,0xcf,0xb9,0xb9,0xdf,0xfa,0x62,0x5f,0x81,0xff,0xfd,0xb2,0x06,0xbe,0xf2,0x04,
-0x00,0x43,0x08,0xe7,0xc1,0xf3,0x00,0x08,0xb1,0x00,0x00,0x04,0x4a,0xf7,0x43,0x0f,
-0xf1,0x37,0x58,0x20,0xfc,0x7f,0xb8,0xce,0xf0,0x17,0x7b,0xf9,0x76,0xff,0x6a,0xf9,
+0xf5,0x0a,0xa9,0x66,0x6d,0xf6,0x66,0x98,0x90,0x88,0x00,0xf1,0x01,0xf6,0x00,0x00,
+0x00,0x27,0x30,0x29,0xfe,0x50,0x00,0x00,0x00,0x6e,0xff,0xff,0xa1,0xe1,0x00,0x36,
+0x27,0xcf,0xf9,0x68,0x01,0x02,0x78,0x00,0xa5,0xfd,0x00,0x00,0x67,0x77,0x7f,0xe7,
+0x77,0x76,0x00,0x78,0x00,0xf1,0x12,0xc6,0x66,0x5f,0xe5,0x66,0x6c,0xf0,0x0f,0xac,
+0xff,0x7e,0xd8,0xff,0xbb,0xf0,0x05,0x46,0x66,0x3e,0xd3,0x66,0x64,0x50,0x00,0x1c,
+0xcc,0x6d,0xc7,0xcc,0xc1,0x00,0x0a,0xaa,0x01,0x00,0x21,0xa1,0x1b,0x44,0x03,0xa2,
+0xbb,0xb1,0x00,0x78,0x88,0xaf,0xd8,0x88,0x88,0x20,0x50,0x00,0x92,0xff,0x40,0x00,
+0xee,0x07,0xf3,0x0f,0xa0,0x9f,0x08,0x00,0x97,0xa7,0xdf,0x30,0x00,0xee,0x06,0xe3,
+0x0e,0x99,0xe7,0x01,0x02,0x28,0x00,0xf1,0x1c,0x00,0x02,0x88,0x88,0x8f,0xf8,0x88,
+0x88,0x20,0x0f,0xfb,0xbb,0xbf,0xfb,0xbb,0xbf,0xf0,0x0f,0xca,0xcc,0x7d,0xf6,0xcc,
+0xac,0xf0,0x09,0x74,0x44,0x3d,0xf2,0x44,0x48,0x90,0x00,0x19,0x99,0x6b,0xd5,0x99,
+0x92,0x00,0x00,0xee,0x01,0x00,0x40,0x90,0x00,0xfe,0x77,0x01,0x00,0x42,0x40,0x00,
+0xfc,0x9f,0x30,0x01,0x20,0xfd,0x67,0x10,0x00,0x22,0x41,0x03,0xb8,0x00,0xf0,0x0d,
+0xf4,0x08,0xf6,0x6f,0x70,0x4f,0xb4,0xde,0x10,0x1e,0xf2,0xcf,0xb9,0xb9,0xdf,0xfa,
+0x62,0x5f,0x81,0xff,0xfd,0xb2,0x06,0xbe,0xf2,0x04,0x00,0x43,0x76,0x00,0xf0,0x01,
+0x10,0x00,0x08,0xf3,0x00,0x08,0xb1,0x00,0x00,0x04,0x4a,0xf7,0x43,0x0f,0xf1,0x10,
+0xf0,0x00,0xf0,0x22,0xfc,0x7f,0xff,0xfd,0x00,0x05,0x7b,0xf9,0x76,0xff,0x6a,0xf9,
 0x00,0x08,0xce,0xfd,0xca,0xfc,0x7e,0xf8,0x70,0x29,0x9c,0xfb,0x98,0xaf,0xff,0xff,
 0xe0,0x4e,0xee,0xee,0xed,0x00,0xde,0x0b,0xe0,0x03,0x66,0x66,0x64,0x88,0xef,0x8e,
-0x13,0x47,0x10,0xf8,0xf1,0x01,0x70,0x08,0xf6,0x59,0xf4,0x00,0xde,0x0b,0x4b,0x47,
-0xc1,0xf4,0x7a,0xff,0xae,0xe0,0x08,0xf5,0x49,0xf4,0xae,0xff,0xef,0x10,0x00,0xa0,
-0x00,0xde,0x05,0x70,0x08,0xf1,0x5b,0xf4,0x5c,0xfe,0x78,0x56,0x42,0x6f,0xb0,0x2f,
-0xd6,0x7d,0x1f,0x26,0x1f,0xe0,0x08,0x00,0x61,0x03,0x33,0x3e,0xf1,0x1f,0xf3,0x34,
-0x84,0x21,0xf1,0x1f,0xce,0xca,0x64,0xaf,0xf1,0x1f,0xfa,0xaa,0xa0,0x20,0x00,0x92,
-0x09,0xcc,0xcf,0xf1,0x1f,0xfc,0xcc,0x80,0x0c,0x20,0x00,0x1c,0xb0,0x40,0x00,0x12,
-0x5f,0x18,0x00,0x40,0xf5,0x4e,0xee,0xef,0x28,0x00,0x1c,0xc4,0x20,0x00,0x06,0x08,
-0x00,0x09,0xae,0xca,0x14,0xf3,0x88,0xcf,0x12,0x00,0x6b,0xe2,0x00,0x89,0xef,0x00,
-0x78,0xc7,0x23,0x40,0x08,0xdc,0x32,0xf1,0x01,0x08,0xf6,0x2f,0xb2,0x2e,0xd2,0x8f,
-0x70,0x08,0xf5,0x0f,0xd8,0x8f,0xd0,0x6f,0x70,0xee,0x1b,0x02,0x08,0x00,0x2a,0xa0,
-0x0d,0x10,0x00,0x03,0x20,0x00,0x65,0x1f,0xa0,0x0e,0xd0,0x7f,0x70,0x40,0x00,0x20,
-0xfc,0xbb,0x14,0x3a,0x18,0x70,0xe4,0x2f,0x00,0x9c,0x26,0x61,0x15,0x5f,0xe5,0x50,
-0x01,0xfd,0x63,0x11,0x91,0xf9,0xbb,0xff,0xbb,0xb1,0x15,0x5f,0xe5,0x5a,0x44,0x21,
-0x50,0xbf,0xfb,0xa0,0x01,0xfd,0x8c,0xf3,0xa1,0xcf,0xe3,0xbb,0xff,0xbb,0x60,0x0e,
-0xd8,0x8e,0xe4,0xa0,0x53,0x31,0xfe,0xef,0xe0,0x18,0x00,0x40,0xd6,0x6e,0xe7,0xbb,
-0x5c,0x22,0x31,0xff,0xff,0xe9,0xbd,0x2c,0x00,0x02,0x65,0x40,0xfd,0x05,0xf5,0x6f,
-0xaf,0x12,0xb2,0xfd,0x06,0xf4,0x5b,0xbf,0xfb,0xb2,0x01,0xfd,0x7d,0xf1,0x68,0x00,
-0x10,0xcf,0x06,0x40,0x04,0xd0,0x03,0x23,0x15,0x50,0xfb,0x00,0x00,0xfc,0x20,0x04,
-0xd2,0x60,0x82,0x02,0x9a,0xdd,0x99,0x99,0xde,0xb9,0x40,0xce,0xf9,0xa5,0x40,0x00,
-0x17,0x77,0xef,0xa7,0x79,0xff,0x87,0x71,0xed,0xf8,0x22,0x11,0x11,0x7b,0xe2,0x05,
-0x89,0xaf,0x12,0xe9,0x96,0x40,0x67,0x2f,0xc4,0x44,0x44,0x4b,0xf5,0xa1,0xaf,0x12,
-0xc2,0xc6,0x40,0x05,0x20,0x00,0x02,0x18,0x00,0x14,0x0e,0xfc,0x88,0x10,0xbb,0x19,
-0x71,0x22,0xbb,0xb0,0x9c,0xbe,0x00,0xb4,0x89,0x56,0xbb,0xff,0xbb,0xbb,0xb9,0x2c,
-0x1e,0x60,0x9f,0x60,0x05,0x50,0x04,0xfd,0xf8,0x1d,0x39,0x0e,0xf0,0x03,0x08,0x00,
-0x13,0x0f,0x08,0x00,0x20,0x2f,0xd0,0x08,0x00,0xf0,0x02,0x6b,0x40,0xcf,0x9a,0x84,
-0xa8,0x00,0x00,0x00,0x5d,0xfd,0x3c,0xff,0xa2,0x00,0x16,0xae,0x5e,0x9d,0x31,0xff,
-0x90,0x0b,0xec,0xe9,0x23,0x5e,0xa0,0xb1,0x68,0x00,0x21,0x6a,0x10,0x6f,0x99,0x04,
-0xb0,0x5f,0xff,0xff,0x8a,0xaa,0xff,0xaa,0xa6,0x13,0x4f,0xd3,0x71,0xf1,0x00,0xdc,
-0x1b,0x13,0x07,0xf4,0x81,0x41,0x07,0xfc,0xaa,0xae,0x08,0x00,0x32,0xf4,0x58,0x2c,
-0x08,0x00,0x2a,0x9f,0x3c,0x08,0x00,0x13,0xaf,0x08,0x00,0x30,0xcf,0x1c,0xf0,0xe4,
-0x2a,0x40,0xa6,0xfc,0x27,0x90,0xbc,0x81,0xf0,0x02,0x3e,0xf8,0xfb,0x10,0x2e,0xff,
-0xb0,0x3a,0xff,0x51,0xbf,0xe4,0x0c,0xeb,0x20,0x4f,0xd3,0xc2,0x2c,0x02,0x04,0x78,
-0x13,0x20,0x4d,0x61,0xc2,0xf2,0x8e,0xee,0xeb,0xaa,0xbf,0xfc,0xaa,0xa1,0x9f,0xff,
-0xfa,0x1b,0x90,0x11,0xcf,0xc2,0x62,0x10,0x50,0x08,0x00,0x31,0xba,0xaa,0xdf,0x08,
-0x00,0x31,0x37,0xb3,0x9f,0x08,0x00,0x28,0x39,0xf4,0x08,0x00,0xf0,0x08,0x99,0xaf,
-0x3a,0xf4,0x9f,0x50,0x6a,0xff,0xfe,0xaf,0x3c,0xf2,0x9f,0x50,0xaf,0xfa,0x40,0x58,
-0x4f,0xe1,0x57,0x20,0x45,0x26,0x17,0x20,0x6d,0xe4,0xba,0x01,0x50,0xaf,0xf6,0x05,
-0xef,0x90,0x85,0xc3,0x43,0x30,0x00,0x1c,0xd1,0xb7,0xe0,0x05,0x32,0x1b,0x41,0x0d,
-0xb0,0x08,0xf8,0xf9,0xa4,0xf0,0x04,0xb9,0xb8,0xf5,0x99,0xff,0xa9,0x93,0x0d,0xb9,
-0xb8,0xf1,0x23,0xfc,0x22,0x20,0x0d,0xb9,0xb8,0xf3,0xe6,0xcb,0x00,0x08,0x00,0x31,
-0xfc,0x88,0x8e,0x08,0x00,0x50,0xf7,0x68,0x0d,0xe0,0x0e,0x08,0x00,0x25,0xaf,0x1d,
-0x08,0x00,0xf1,0x0d,0x0f,0xa9,0xb8,0xf3,0xf7,0xbf,0x0d,0xe0,0x0f,0x99,0xb8,0xf3,
-0xf7,0xcf,0x0d,0xe0,0x1f,0x89,0xb8,0xf2,0x96,0xff,0x67,0x80,0x5f,0x69,0xb8,0xf1,
-0x98,0x23,0xf6,0x00,0x30,0x08,0xf5,0xdf,0x90,0xbf,0xa0,0x5d,0x00,0x07,0xdb,0xf8,
-0x00,0x0b,0xd1,0x39,0x94,0x14,0x20,0x00,0xd6,0x03,0x54,0x26,0x91,0xc0,0xcc,0xce,
-0xfd,0xcc,0xc3,0x1d,0xfc,0x10,0xca,0xaa,0x20,0x08,0xa0,0x4e,0x14,0x00,0xd2,0xb4,
-0x60,0xc6,0x4f,0xea,0xaa,0xdf,0x90,0xb1,0xb8,0xf1,0x00,0x92,0x74,0x6f,0x90,0x05,
-0xef,0x80,0x4f,0x94,0xfa,0x6f,0x90,0x1e,0xf7,0x00,0x08,0x00,0xd0,0x03,0x30,0x54,
-0x4f,0x94,0xf9,0x6f,0x90,0x00,0x02,0xfe,0x6f,0x96,0x7a,0xcb,0x61,0x1d,0xf5,0x3a,
-0x6b,0xf5,0x59,0x05,0xb3,0xf3,0x05,0x8f,0xbc,0xe6,0x00,0x4f,0xf9,0x00,0x4c,0xfc,
-0x05,0xef,0xb1,0x09,0x60,0x04,0xff,0x90,0x00,0x1b,0xf3,0xdd,0x10,0x15,0x40,0xc2,
-0x31,0x31,0xee,0xef,0xad,0x21,0x91,0xf1,0x04,0xbb,0xdf,0xa8,0xaa,0xef,0xba,0xa4,
-0x01,0x51,0xee,0x10,0x22,0xef,0x32,0x10,0x0b,0xff,0xf3,0x04,0x53,0x18,0xf0,0x00,
-0x9f,0xf6,0x04,0xfc,0x99,0x9f,0xb0,0x59,0x9d,0xfd,0xa8,0xf6,0x79,0x2f,0xb0,0xd9,
-0xe0,0x82,0xf6,0xbf,0x2f,0xb0,0x00,0x1f,0xc8,0xf5,0x08,0x00,0x40,0xcb,0xb4,0xf6,
-0xcf,0x08,0x00,0x60,0xc2,0x24,0xf7,0xee,0x1f,0xb0,0xe4,0x2c,0x31,0x8b,0xf9,0x27,
-0x35,0xda,0xf7,0x04,0x7f,0xe5,0xfa,0x10,0x1c,0xdf,0xb0,0x4d,0xfe,0x20,0xaf,0xd2,
-0x0c,0xfd,0x30,0x0b,0x70,0x00,0x08,0x34,0x22,0x15,0xfa,0x08,0x00,0x10,0xcf,0x78,
-0x05,0xf0,0x11,0xf0,0xff,0xfb,0x8a,0xaf,0xea,0xa2,0x08,0xf0,0xfd,0x97,0x00,0x3f,
-0x80,0x00,0x08,0xf0,0xfa,0x00,0x4a,0xcf,0xba,0x90,0x5d,0xfb,0xfe,0xbb,0x7f,0xed,
-0xdf,0xf0,0x7f,0xb1,0x92,0xf0,0x1e,0x28,0x4a,0xf0,0x01,0x26,0xf5,0x00,0x6f,0x2f,
-0x7a,0xf0,0x08,0xf7,0xf5,0xae,0x7f,0x3f,0x7a,0xf0,0x0e,0xc5,0xf6,0xfb,0x6f,0x3f,
-0x6a,0xf0,0x6f,0x55,0xfd,0xf5,0x6f,0x6f,0x4a,0xf0,0x04,0x03,0xdf,0xc0,0x5d,0x9f,
-0x18,0xb0,0x00,0x06,0x28,0x2c,0xf2,0x04,0xe6,0x00,0x06,0xcf,0xe3,0x00,0x5d,0xf4,
-0xaf,0xa0,0x3f,0xf9,0x10,0x08,0xfe,0x40,0x08,0xf4,0x04,0x26,0x1b,0x22,0x30,0x08,
-0x24,0x21,0x90,0xf6,0x08,0xf6,0x49,0xf4,0x77,0xbf,0xa7,0x73,0x78,0x05,0x90,0x23,
-0xbf,0x53,0x30,0x08,0xf6,0x4a,0xf4,0x8f,0x20,0x5c,0xf0,0x01,0xfe,0xef,0xf4,0x8f,
-0x26,0x3d,0xc0,0x01,0x33,0x33,0x30,0x8f,0x3f,0x5c,0xc0,0x4f,0xb7,0x52,0xf5,0x28,
-0x3f,0x4c,0xc0,0x16,0x69,0xf9,0x66,0x8f,0x5f,0x3c,0xc0,0x07,0xd5,0xf5,0x00,0x8f,
-0x9f,0x0c,0xc0,0x09,0xf4,0xff,0xfa,0x39,0xfb,0x77,0x40,0x0a,0xf8,0xf8,0x53,0x4d,
-0xe3,0xdf,0x60,0x0d,0xff,0xf5,0x06,0xfd,0x30,0x0b,0xf2,0x4f,0x7c,0xfd,0xa9,0xc8,
-0x88,0x88,0xc4,0x5e,0x00,0x5b,0xdf,0x1b,0x17,0x01,0xf8,0x01,0x14,0x61,0x6c,0x8c,
-0x00,0xf0,0x60,0x01,0x04,0x31,0x81,0xad,0xdf,0xed,0xd3,0x07,0xbd,0x89,0xd9,0xa0,
-0x39,0xe1,0xae,0x07,0xf2,0x5a,0xdf,0xaa,0x70,0x06,0xbf,0x9e,0xe8,0x8f,0xaa,0xae,
-0x50,0x12,0xf1,0x01,0x8d,0x1c,0x3b,0xb0,0x0a,0xf0,0x19,0xe4,0x8d,0x2f,0x4b,0xb0,
-0x0b,0xfb,0xff,0x70,0x08,0x00,0xf2,0x21,0xf5,0x75,0xc6,0x8d,0x3f,0x3b,0xb0,0x0c,
-0xe4,0xbf,0xc1,0x8d,0x5f,0x1b,0xb0,0x0d,0xef,0xe7,0x74,0x7b,0x8e,0x09,0x90,0x1f,
-0xa3,0x4c,0xfa,0x03,0xf9,0x85,0x00,0x5f,0xcd,0xff,0x71,0x6e,0xe2,0xaf,0x90,0x6f,
-0x4c,0x71,0x0e,0xfb,0x20,0x07,0xf4,0x02,0x86,0x0e,0x23,0x30,0x1f,0x46,0x53,0x02,
-0x08,0x00,0x22,0x1c,0x70,0xec,0x91,0x02,0x42,0xd5,0x33,0x0f,0xec,0xf8,0x7c,0x5b,
-0x19,0x80,0x08,0x00,0x11,0x0d,0x82,0xd7,0x00,0xcb,0x1b,0x11,0x7f,0x07,0x26,0x01,
-0x0f,0xc2,0x02,0x74,0x80,0x22,0x50,0x00,0xd1,0xfe,0x12,0xf5,0x01,0x0e,0x22,0x83,
-0xf5,0x86,0x23,0x03,0xf7,0xf2,0x00,0xc9,0xaf,0x20,0xd7,0x00,0x8b,0xfb,0x00,0x3b,
-0x22,0xc0,0x14,0x47,0xfa,0x44,0x20,0x06,0xf8,0x11,0x4f,0xee,0xff,0xef,0x10,0xc5,
-0x91,0xaf,0x76,0xf9,0x6f,0x70,0x0e,0xf7,0xdf,0x5f,0xe1,0xb9,0xa1,0x91,0xfa,0x55,
-0x57,0xfa,0x55,0x52,0x8f,0x8a,0x63,0x44,0x2f,0x41,0x05,0x9f,0x00,0x37,0xa8,0x07,
-0x11,0x9f,0x8a,0x08,0x10,0x80,0x08,0x00,0x31,0x42,0x94,0x4f,0x08,0x00,0x20,0x44,
-0xf6,0x08,0x00,0xf6,0x13,0x69,0x6f,0x46,0xf5,0x4f,0x80,0x00,0xaf,0xfc,0x38,0x4d,
-0xf5,0x69,0x40,0x01,0xef,0xa0,0x38,0xff,0x7b,0xfd,0x50,0x05,0xf6,0x02,0xff,0xd5,
-0x00,0x4d,0xf1,0x00,0x20,0x00,0x43,0xc4,0xde,0x05,0x52,0xbe,0x50,0xf3,0x19,0x99,
-0xdf,0x0c,0x2b,0x16,0xf1,0x17,0x03,0x30,0xbe,0x0c,0xf0,0x00,0x04,0x00,0x0b,0xe0,
-0xcd,0x0c,0xf6,0xc0,0x5f,0x80,0x0c,0xc0,0xdc,0x0c,0xf6,0xf9,0xaf,0x20,0x0d,0xb0,
-0xfa,0x0c,0xf0,0xbf,0xfc,0x00,0x0f,0xb3,0xfa,0x1c,0xf0,0x1e,0x8c,0x3b,0xf2,0x1a,
-0x9c,0xf0,0x1e,0xfa,0x00,0x04,0x44,0x6f,0x8c,0xf0,0x9f,0xff,0x40,0x00,0x26,0x5f,
-0x7c,0xf5,0xfd,0x4f,0xc0,0x8f,0xff,0x9f,0x6c,0xfc,0xf3,0x0b,0xc0,0x58,0x40,0x6f,
-0x4c,0xf1,0x50,0x01,0x00,0x00,0x67,0xdf,0x1c,0xa8,0xdb,0x6c,0xf8,0x09,0xbb,0xbb,
-0xbb,0xb5,0x6c,0xd5,0x00,0xf2,0x6a,0x00,0x08,0x00,0x40,0x09,0x99,0xdf,0x30,0x08,
-0x00,0x41,0x03,0x40,0x9f,0x2b,0x1c,0x24,0xf1,0x03,0xe0,0xaf,0x0b,0xf8,0xef,0x8e,
-0xe0,0x0b,0xd0,0xbf,0x0b,0xe0,0xde,0x0d,0xe0,0x0d,0xb0,0xdd,0x08,0x00,0x30,0x0e,
-0xb2,0xed,0x20,0x00,0x00,0x3b,0x18,0xb0,0xd7,0x99,0xff,0x99,0x90,0x04,0x44,0x4f,
-0xc7,0xd2,0xfc,0x36,0x65,0x21,0x5f,0xa2,0xc8,0x9e,0xf6,0x0f,0xff,0xdf,0x80,0x5f,
-0xf5,0x00,0x00,0x49,0x52,0x5f,0x60,0xbf,0xff,0xa3,0x00,0x00,0x48,0xdf,0x9f,0xfa,
-0x2b,0xff,0xe3,0x00,0x4f,0xe7,0x3d,0x60,0x00,0x4a,0xb3,0x0e,0x03,0xf6,0x79,0x71,
-0x04,0x4b,0xf7,0x44,0x2f,0xff,0xff,0x8d,0x92,0xf0,0x0f,0x2f,0xc5,0x6f,0xa0,0x02,
-0x6f,0xc2,0xaf,0x1f,0x90,0x1f,0xa0,0x05,0xef,0x66,0xed,0x1f,0xd9,0xaf,0xa0,0x4f,
-0xe4,0x2e,0xd5,0x1a,0xaa,0xaa,0x70,0x04,0x3a,0x97,0x09,0x13,0x90,0xdb,0x16,0x00,
-0x5a,0x7e,0x12,0xa7,0xea,0x07,0x21,0x06,0xfa,0x89,0xca,0x23,0x00,0x0a,0x38,0x5e,
-0x10,0x05,0xf2,0x16,0x10,0x6f,0x12,0x92,0x00,0x6b,0xb1,0x11,0xd0,0x5b,0x34,0x32,
-0xcc,0xbf,0xa0,0x68,0x28,0x03,0xff,0x53,0x11,0x96,0x47,0x00,0x01,0x04,0x33,0x31,
-0x29,0x99,0xdf,0xa3,0xd6,0xf1,0x17,0x02,0x30,0xae,0x03,0xef,0x5c,0xfa,0x00,0x0a,
-0xf0,0xbd,0x5f,0xf6,0x01,0xcf,0xe4,0x0b,0xe0,0xcd,0xef,0xda,0xaa,0xbf,0xf6,0x0c,
-0xd0,0xeb,0x55,0x8e,0xee,0xe6,0x80,0x0d,0xc2,0xfa,0x20,0x00,0x11,0x30,0x01,0xf1,
-0x1a,0xc5,0xd0,0xcb,0x09,0xe2,0x04,0x44,0x4f,0xb5,0xf4,0x9f,0x0e,0xd0,0x00,0x25,
-0x4f,0xa1,0xf7,0x6f,0x5f,0x70,0x6e,0xff,0x9f,0x80,0xe9,0x39,0xbf,0x10,0x48,0x51,
-0x3f,0x70,0x00,0x00,0xf9,0x00,0x00,0x57,0xcf,0x4f,0x73,0x16,0x30,0x6f,0xfa,0x0a,
-0xf9,0xf9,0x08,0xdf,0xed,0x12,0x80,0xf9,0xaf,0x26,0x3f,0xf4,0xbf,0x55,0x22,0xf0,
-0x06,0xab,0x17,0x00,0xf3,0x0d,0x02,0xd3,0x17,0x50,0x0f,0xf5,0x55,0x55,0x5e,0x08,
-0x00,0x03,0x85,0x91,0x12,0x06,0x1f,0x00,0x13,0x09,0x35,0x92,0x21,0x0a,0xfa,0x06,
-0xce,0xf1,0x00,0xa0,0x0a,0xf3,0x7c,0xcc,0xcc,0xc4,0x3f,0xa0,0x0a,0xf3,0x9f,0xba,
-0xac,0xf5,0x08,0x00,0x21,0x75,0x58,0x08,0x00,0x00,0x98,0x0b,0xa4,0xaf,0x90,0x0a,
-0xf3,0x59,0x10,0x00,0x0c,0xdb,0x30,0x97,0x25,0x00,0x07,0x00,0x10,0xf7,0xa6,0x0a,
-0xf0,0x0d,0xc1,0xee,0xff,0xee,0xe3,0x0e,0xfc,0xfc,0x1f,0xd7,0x87,0xcf,0x30,0xec,
-0x0f,0xc1,0xfb,0x8b,0x09,0xf2,0x0e,0xc0,0xfc,0x1f,0xb3,0xf8,0xaf,0x00,0x0f,0x00,
-0x30,0x05,0x7e,0xe0,0x0f,0x00,0x30,0xb0,0x1e,0xd5,0x0f,0x00,0x60,0xfd,0x77,0x77,
-0x77,0x1e,0xd5,0x33,0xf2,0x00,0xf0,0x61,0x01,0xbe,0xce,0x90,0x1e,0xe6,0x65,0x8f,
-0xff,0xff,0xcb,0xf0,0xa9,0x6c,0x09,0x22,0x98,0xce,0xe1,0x11,0x22,0x7f,0xc0,0x71,
-0x03,0x18,0xe4,0xb1,0xb5,0x01,0x62,0x82,0x84,0xbb,0xbb,0xbf,0xfc,0xbb,0xbb,0x70,
-0x05,0xdc,0x39,0x30,0x01,0x11,0x1d,0xe0,0xd8,0x05,0xbf,0x57,0x10,0x15,0x43,0x2e,
-0x32,0x54,0x00,0x1d,0x2b,0x83,0x52,0xd5,0x0a,0xaa,0xaf,0xfd,0xf5,0x35,0x20,0xaf,
-0xf9,0x6f,0x03,0x22,0x00,0x5d,0xdf,0x01,0xe1,0x0b,0xff,0xdf,0xb1,0x05,0xff,0x50,
-0x00,0x01,0x92,0x0a,0xfd,0x9f,0xf6,0x0f,0x09,0xf8,0x07,0xef,0xff,0xb3,0x00,0x00,
-0x07,0xad,0xff,0xfc,0xaf,0xff,0xfd,0xb5,0x09,0xfe,0xb7,0x20,0x00,0x6a,0xdf,0xf1,
-0x00,0x11,0x9a,0x21,0x1f,0x80,0x8c,0x43,0xf0,0x11,0x20,0x1f,0xb9,0x00,0x07,0xf5,
-0xf7,0x8f,0x20,0x1f,0xcf,0x70,0x07,0xfa,0xe9,0xff,0x20,0x1f,0x89,0xf1,0x07,0xeb,
-0xed,0x8f,0x31,0x2f,0x92,0x40,0x07,0xf5,0xf8,0x7f,0xa9,0xe6,0x00,0x28,0x00,0x80,
-0x7a,0xbf,0xda,0xa4,0x01,0x36,0xf9,0x33,0xa7,0xcf,0x01,0xa8,0x84,0xf3,0x24,0x6f,
-0xf1,0x00,0x01,0x46,0xf9,0x55,0x00,0xbf,0xf5,0x00,0x0b,0xee,0xff,0xff,0x40,0xfc,
-0xea,0x00,0x09,0xba,0x98,0x88,0x17,0xf6,0x9f,0x20,0x03,0xd9,0x7e,0x7d,0x1e,0xf0,
-0x2f,0xb0,0x09,0xc9,0x7f,0x5d,0xdf,0x60,0x0a,0xf9,0x0f,0x68,0x78,0x31,0xcb,0x00,
-0x00,0xd4,0xfb,0x20,0x17,0x10,0x47,0x5c,0x28,0x1e,0xf3,0x40,0x60,0xd3,0x8a,0xfe,
-0x98,0x89,0xff,0xb8,0x80,0x00,0x00,0x7f,0xc3,0x2d,0xf8,0x61,0xa0,0x10,0x80,0x48,
-0x03,0xf1,0x06,0x9d,0xff,0xff,0xfc,0x86,0x41,0x2f,0xff,0xfd,0x82,0x16,0xbf,0xff,
-0xf2,0x06,0x86,0xd8,0x00,0x00,0x8a,0x44,0x22,0xc2,0x01,0x00,0xf4,0x13,0x02,0x08,
-0x00,0x22,0x06,0xfa,0x08,0x00,0x11,0x1e,0x20,0xf4,0x02,0x6d,0xe9,0x00,0x10,0x00,
-0x10,0x5b,0xb6,0x53,0x0c,0x8b,0x89,0x21,0x49,0xdc,0x97,0xd5,0x10,0xbf,0x64,0x19,
-0x01,0x13,0x1e,0x07,0x50,0xf6,0x00,0x06,0x00,0x11,0xc7,0x08,0x00,0x30,0xfa,0x51,
-0x00,0x08,0x00,0x12,0x84,0x75,0x2b,0x2f,0xff,0x00,0x08,0x00,0x06,0x21,0x2b,0xee,
-0x08,0x00,0x00,0x27,0x1a,0x21,0x2b,0xee,0x08,0x00,0x00,0x20,0xe5,0x00,0xec,0xdd,
-0x21,0xb2,0xdf,0xa3,0xe3,0x01,0x0b,0x00,0x01,0x08,0x00,0x02,0x56,0xce,0x00,0x7b,
-0x3a,0x40,0xc8,0x88,0x88,0x8c,0x81,0x0d,0x00,0xe7,0x15,0x24,0xf0,0x0f,0x08,0x00,
-0x11,0xff,0xf7,0x15,0x00,0x18,0x00,0x64,0xec,0xcc,0xcc,0xce,0xf0,0x0f,0x08,0x00,
-0x06,0x18,0x00,0x0c,0x30,0x00,0x02,0x48,0x00,0x04,0x58,0x00,0x20,0xdf,0xff,0x6c,
-0x34,0x00,0xb3,0x5a,0x13,0xa5,0x06,0x5e,0x02,0x08,0x00,0x04,0x18,0x00,0x04,0x02,
-0x01,0x0f,0x28,0x00,0x3b,0x01,0x48,0xd5,0x01,0x72,0x97,0x03,0x1f,0x12,0x13,0xfb,
-0xf6,0x98,0x32,0xc0,0x1b,0xa0,0x17,0x13,0x21,0xcf,0xfb,0x0f,0x00,0x70,0x00,0xbf,
-0xff,0xb0,0x0b,0xff,0xfc,0xfb,0x29,0x10,0xfb,0x0f,0x00,0x01,0x77,0x01,0x03,0x42,
-0xb2,0x03,0xa9,0x2a,0x23,0xbf,0xfb,0x71,0x09,0x14,0xb0,0x0e,0x2f,0x20,0x03,0x08,
-0x7c,0x22,0xc2,0xf8,0xff,0xfc,0x10,0x1c,0xff,0xf5,0xff,0xfc,0x2c,0xff,0xf5,0x8f,
-0xc2,0x11,0x05,0xa1,0x0b,0x71,0x1d,0xff,0xfd,0x10,0x00,0x1c,0xff,0x1e,0x00,0x40,
-0xf9,0xff,0xfc,0x1c,0x1e,0x00,0x20,0xfc,0xdf,0x1e,0x00,0x22,0xd1,0xa4,0xca,0x78,
-0x01,0xf8,0xd7,0x00,0x6e,0x21,0x40,0x6f,0xf1,0x03,0x10,0x10,0xd3,0xd0,0x6f,0xf1,
-0x3f,0xd1,0x00,0x03,0xff,0xf1,0x6f,0xf1,0x5f,0xfd,0x00,0x53,0xae,0x60,0xf1,0x09,
-0xff,0x70,0x4f,0xf7,0xd8,0x02,0x70,0xcf,0xe0,0x9f,0xf0,0x00,0x6f,0xf1,0xdb,0x40,
-0x10,0xc0,0x08,0x00,0x40,0x2f,0xf5,0xbf,0xc0,0x40,0x00,0x41,0x1f,0xf6,0xaf,0xe0,
-0x33,0x07,0x31,0xf4,0x6f,0xf4,0x27,0x44,0x31,0xf0,0x0f,0xfe,0xff,0xf0,0x40,0xa0,
-0x06,0xff,0xd3,0xe7,0x05,0x00,0xbf,0x97,0x42,0xda,0xbe,0xff,0xf4,0x14,0x81,0x01,
-0xc4,0x30,0x32,0x17,0xbd,0xca,0x9b,0x0c,0x24,0x8b,0xb8,0x45,0xc4,0x01,0x26,0x35,
-0x10,0x06,0x74,0x3d,0x40,0x00,0x04,0xfd,0xdf,0xe3,0x5b,0x23,0x40,0x0d,0xee,0x3f,
-0x00,0x32,0x0d,0x12,0x9f,0xc0,0x4c,0x20,0x20,0x02,0xef,0x01,0x20,0xff,0xf9,0x46,
-0x0c,0x14,0x00,0x08,0x00,0x04,0x18,0x00,0x04,0x28,0x00,0x04,0x38,0x00,0x30,0x04,
-0xfe,0xdf,0x1b,0xdb,0x14,0x40,0x58,0x00,0x05,0x68,0x00,0x06,0x78,0x00,0x52,0x03,
-0xdd,0x30,0x3f,0xf3,0xbc,0xdf,0x31,0xf5,0x4f,0xf4,0x3e,0x7d,0x41,0x99,0xff,0xbf,
-0xf4,0xe5,0xbf,0x40,0x22,0x6f,0xff,0xf4,0x06,0xdf,0xf0,0x02,0x35,0xff,0x53,0xef,
-0xf4,0x00,0x04,0xff,0xc1,0x8f,0xff,0xf8,0x1c,0xfe,0x40,0x7f,0xfa,0xd3,0x22,0x51,
-0xa1,0xaf,0xf7,0xcf,0x82,0xe2,0xf4,0x42,0x28,0xfc,0x14,0x0e,0x26,0x2b,0x14,0x41,
-0x37,0xb6,0x00,0xbd,0x03,0x32,0xf9,0x00,0x8f,0x09,0x00,0x1b,0xf8,0x09,0x00,0x20,
-0x0e,0xff,0x6d,0xac,0x02,0x32,0xde,0x18,0xfd,0xfe,0x00,0x0f,0x08,0x00,0x0d,0x04,
-0x36,0x50,0x01,0x25,0x6a,0x01,0x9a,0xbf,0x03,0x21,0x02,0x19,0x0b,0x21,0x02,0x61,
-0xdf,0xff,0xfc,0x1b,0xb1,0xcf,0x9b,0x5d,0x3b,0xc2,0x2c,0xff,0x01,0x00,0x21,0xf0,
-0xe0,0x59,0x43,0x01,0xa0,0x02,0x20,0x04,0xef,0x40,0x10,0x14,0x40,0x62,0xbf,0x22,
-0xe1,0x00,0x5d,0xfa,0x20,0x0b,0xfa,0xb8,0xd9,0x01,0x15,0x2f,0x32,0x50,0x1e,0xf6,
-0x67,0x18,0x13,0xe1,0xf6,0x5e,0x21,0x0b,0xfa,0x6e,0x2c,0x03,0xeb,0x0e,0x00,0x70,
-0x41,0x0f,0x01,0x00,0x0a,0x13,0x8f,0x08,0x00,0x00,0x00,0x1a,0x70,0xbd,0xda,0x50,
-0x02,0xff,0x00,0x05,0xe6,0x1f,0xa0,0x42,0xff,0x00,0x7f,0xff,0xa7,0x7b,0xff,0xf9,
-0xff,0x2f,0x86,0x00,0xc9,0x85,0x11,0x0e,0x0e,0xd8,0x42,0xdf,0xff,0x5f,0xf2,0xf8,
-0x04,0x22,0x8f,0xb0,0x08,0x00,0x0c,0x5e,0x15,0x12,0xff,0x52,0xa0,0x12,0xf8,0x08,
-0x00,0x50,0x2f,0xf4,0xff,0xfd,0x22,0xbd,0x9f,0x40,0xe0,0xff,0xff,0xc2,0x48,0x00,
-0x60,0x40,0xff,0x9f,0xff,0xb7,0x6a,0xd4,0xb9,0x30,0x24,0xdf,0xff,0x67,0x91,0x65,
-0xff,0x20,0x05,0xac,0xdb,0x60,0x3f,0x00,0x10,0x8d,0x29,0x04,0x00,0x3c,0x1f,0x2e,
-0xdf,0xff,0x01,0x00,0x12,0xdf,0x81,0x97,0x01,0x1d,0xcd,0x02,0x2c,0x00,0x07,0x01,
-0x00,0x12,0x8d,0x4d,0x96,0x02,0xa3,0x91,0x02,0x12,0x05,0x20,0x01,0x50,0x36,0x00,
-0x21,0x06,0xf7,0x1c,0x05,0x11,0xbe,0x06,0x00,0x01,0xf1,0x5d,0x11,0x05,0x12,0xcb,
-0x22,0x02,0x60,0x4c,0x00,0x03,0x4e,0x00,0x3a,0x00,0x00,0x9e,0xca,0x00,0x24,0x06,
-0x10,0xde,0x79,0x13,0xd2,0x60,0x00,0x31,0x03,0xee,0x10,0x63,0x00,0x41,0x0a,0xb1,
-0x2f,0xb0,0x66,0x00,0x41,0x05,0xfc,0x07,0xf4,0x4b,0x00,0x42,0x50,0x5f,0x60,0xf9,
-0x6c,0x00,0x32,0x0d,0xc0,0xbd,0x69,0x00,0x33,0x09,0xf0,0x9f,0x09,0x00,0x24,0xe0,
-0x8f,0x1b,0x00,0x14,0xad,0x2d,0x00,0x11,0xe9,0x7b,0x00,0x30,0x05,0xfc,0x06,0x1a,
-0x33,0x04,0x51,0x00,0x00,0x63,0x00,0x38,0x02,0xee,0x10,0x75,0x00,0x02,0x87,0x00,
-0x13,0x8f,0xa4,0x01,0x23,0xff,0xfc,0x09,0x01,0x12,0x20,0x0a,0x10,0x01,0x3a,0x1e,
-0x12,0xee,0x10,0x00,0x40,0xfe,0x12,0xef,0xff,0x20,0x00,0x10,0xe1,0x17,0xc0,0x31,
-0xfe,0x4e,0xfe,0x45,0xe6,0x31,0xe1,0x02,0xc1,0x93,0x01,0x1b,0x10,0xac,0x02,0x09,
-0xfd,0x01,0x00,0xfc,0x01,0x21,0x4e,0x40,0x0c,0xdf,0x01,0x53,0x02,0x11,0xf1,0xee,
-0x30,0x11,0x90,0xcf,0x0a,0x30,0x30,0x00,0x0c,0x67,0x00,0x13,0x07,0x5a,0x91,0x12,
-0xff,0xf2,0xa7,0x21,0xff,0x9e,0x08,0x14,0x20,0xff,0x2f,0x06,0x00,0x10,0xf2,0x4e,
-0x24,0xc2,0x9f,0xa1,0xbf,0xff,0xff,0x92,0xff,0xa2,0x2f,0xff,0xf2,0x04,0xf6,0x42,
-0x35,0x9e,0xfe,0x92,0xa4,0xce,0x40,0x01,0xcc,0xff,0x40,0x93,0x59,0x10,0x40,0xf8,
-0xe4,0x01,0x17,0x46,0x01,0xb1,0xae,0x1a,0x9f,0xde,0x01,0x01,0xf1,0x4a,0x32,0x45,
-0xff,0xff,0x45,0x65,0x03,0x2d,0x00,0x00,0x37,0x00,0x00,0x41,0x00,0x09,0xa4,0xbb,
-0x13,0x91,0xc7,0x00,0x12,0x70,0x07,0x00,0x01,0xf3,0x16,0x00,0x58,0x10,0x24,0x10,
-0x00,0x5e,0x58,0x01,0x51,0x00,0x13,0xd5,0xea,0x00,0x13,0xb2,0x4f,0x03,0x09,0x07,
-0x00,0x17,0xb2,0x23,0x00,0x12,0xf7,0x3f,0x00,0x17,0x20,0x4d,0x00,0x01,0x5b,0x00,
-0x2e,0x8e,0xa1,0x76,0x76,0x01,0xe3,0x5c,0x11,0x8f,0x60,0x13,0x04,0x99,0xba,0x0f,
-0x07,0x00,0x36,0x20,0x7f,0xff,0xfa,0x26,0x23,0xf7,0x8f,0xee,0x01,0x0f,0x01,0x00,
-0x40,0x14,0x8f,0xf1,0x01,0x00,0x0d,0x6d,0x10,0x10,0xb8,0x24,0x10,0xd2,0x76,0x12,
-0x21,0xfe,0x30,0xb6,0x01,0x01,0x80,0x12,0x11,0x54,0x3c,0x16,0x0a,0x37,0x00,0x23,
-0xf9,0xff,0xb4,0x01,0x14,0xf3,0x2d,0x00,0x00,0x37,0x00,0x01,0x41,0x00,0x04,0x17,
-0x01,0x23,0x2d,0xd2,0x6e,0x36,0x02,0x10,0x65,0x22,0x1d,0xff,0x7b,0x38,0x12,0xcf,
-0x03,0x29,0x04,0x11,0x05,0x03,0xef,0x53,0x03,0xf9,0x0a,0x05,0x6a,0xca,0x04,0x19,
-0xe3,0x05,0xdc,0x2b,0x03,0xdf,0xde,0x05,0xe9,0x15,0x04,0x87,0xdd,0x15,0xff,0x36,
-0x31,0x20,0x1a,0x40,0x07,0xe5,0x10,0xf0,0x6a,0x00,0x00,0x0f,0x63,0x17,0xfa,0x09,
-0x00,0x20,0x0c,0xff,0xfc,0x9f,0x01,0x98,0xc7,0x01,0x65,0xe0,0x1d,0x1d,0x0b,0x00,
-0x01,0xae,0xc5,0x11,0x50,0x5f,0x07,0x20,0x0f,0xfc,0xf4,0x98,0x01,0x3e,0x84,0x1d,
-0xaf,0x0b,0x00,0x00,0xa7,0xf1,0x01,0xc1,0xb5,0x10,0xfd,0x19,0x4f,0x17,0xd1,0x09,
-0x00,0x20,0x0f,0xfd,0x41,0x07,0x13,0xb1,0x9e,0x78,0x12,0x40,0x7c,0x04,0x1f,0x80,
-0x07,0x00,0x04,0x7a,0x48,0x88,0x8c,0xff,0xc8,0x88,0x84,0x54,0x01,0x03,0x15,0x00,
-0x0f,0x38,0x00,0x09,0x03,0x5b,0x00,0x20,0x14,0x44,0x01,0x00,0x13,0x41,0x88,0xef,
-0x03,0x3f,0x00,0x23,0x7b,0xbb,0x84,0x6b,0x51,0x05,0xad,0xff,0xda,0x50,0x08,0x0f,
-0x50,0xfc,0x88,0xcf,0xfd,0x40,0x08,0x24,0xd0,0x40,0x00,0x04,0xef,0xf7,0x00,0x07,
-0xff,0xf4,0x00,0x9e,0x80,0x4f,0xd8,0xc8,0xe0,0xc0,0x00,0xaf,0xf8,0x0c,0xff,0xf4,
-0xdf,0xff,0x80,0x9a,0xff,0xfe,0x08,0xe1,0x09,0x21,0x80,0xef,0x09,0x00,0x50,0x4f,
-0xff,0xc0,0x8f,0xff,0x1b,0x00,0x50,0x07,0xff,0xf4,0x08,0xee,0x2d,0x00,0x03,0x3f,
-0x00,0x17,0xf8,0x51,0x00,0x04,0x63,0x00,0x25,0x8c,0x20,0x59,0x09,0x04,0x13,0x0c,
-0x00,0x3d,0x7c,0x43,0x49,0xdf,0xfd,0xa5,0x04,0x5b,0x21,0xd8,0x8c,0xf9,0xa0,0x01,
-0x3f,0x00,0x11,0x4e,0x44,0x03,0xf0,0x04,0x1c,0xff,0x69,0xe8,0x04,0xff,0xf7,0x00,
-0x04,0xe3,0x00,0x9f,0xfe,0xff,0x80,0xcf,0xff,0x40,0x0d,0xa0,0x4e,0x01,0xd2,0x58,
-0x51,0x0d,0xff,0xf7,0x00,0x2d,0x0a,0x00,0x11,0x04,0x0a,0x72,0x61,0xf8,0xcf,0xff,
-0x30,0x00,0x7f,0x66,0xfd,0x00,0x93,0x03,0x10,0x08,0x4a,0x07,0x31,0x3e,0xff,0xa0,
-0x70,0xe5,0x51,0xc8,0x82,0x01,0xbf,0xf7,0x52,0x66,0x46,0xdf,0xfc,0x10,0x08,0x17,
-0x34,0x25,0x4e,0xfd,0x91,0x19,0x17,0xc8,0x87,0x02,0x07,0x8b,0x09,0x00,0x6a,0x09,
-0x15,0x50,0xa3,0x42,0x15,0xd0,0x96,0xa1,0x13,0xf7,0x2d,0x68,0x42,0xd8,0x8d,0xff,
-0x10,0x98,0xdd,0x22,0xa0,0x0a,0xf4,0x3b,0x10,0x3f,0xe7,0x09,0x12,0xf3,0xbe,0x02,
-0x41,0xc0,0x0c,0xff,0xfc,0x44,0x00,0x00,0xaf,0x00,0x01,0x57,0x41,0x02,0xc2,0x08,
-0x11,0xe0,0xe0,0x25,0x20,0xe2,0x2e,0x4d,0x03,0x00,0x19,0x05,0x01,0x7c,0x21,0x11,
-0x10,0x4a,0xa9,0x23,0x3e,0xff,0x03,0x0f,0x09,0xdc,0x02,0x2b,0xff,0xff,0x76,0xf3,
-0x14,0xd8,0x31,0x07,0x10,0x80,0x6e,0x04,0x11,0x07,0xf1,0x03,0x10,0xf6,0x88,0x10,
-0x70,0xfd,0x78,0x8e,0xff,0x15,0xff,0xe8,0x19,0xac,0x40,0xe5,0x4f,0xfe,0x20,0xfe,
-0xf9,0x51,0x13,0xff,0xf3,0x00,0x52,0x9a,0x00,0x30,0x31,0x00,0x52,0x25,0x3e,0x90,
-0xf4,0x5e,0x20,0xfe,0x20,0x78,0x8e,0xff,0x51,0x28,0x00,0x04,0x38,0x00,0x04,0x48,
-0x00,0x04,0x58,0x00,0x0a,0x68,0x00,0x08,0x16,0x1c,0x13,0xdd,0xa4,0x03,0x11,0xd1,
-0x4c,0xe8,0x30,0xff,0xfd,0x10,0x0d,0x00,0x40,0x99,0xff,0xd1,0x00,0x02,0x2a,0x60,
-0x9f,0xfd,0x10,0x1d,0xff,0x90,0x3c,0x3c,0x01,0x4f,0x4d,0x21,0x9f,0xfb,0x1f,0xbb,
-0x1b,0x09,0xc1,0x22,0x03,0x15,0x00,0x03,0x23,0x00,0x03,0x31,0x00,0x03,0x3f,0x00,
-0x03,0x4d,0x00,0x04,0x5b,0x00,0x03,0x69,0x00,0x04,0x77,0x00,0x0c,0x01,0x00,0x24,
-0x1d,0xd1,0x97,0x00,0x21,0xdf,0xfd,0x2a,0x78,0x11,0xd0,0x3e,0x04,0x02,0x5c,0x78,
-0x42,0xcf,0xcf,0xfc,0xfc,0x19,0x77,0x43,0x6b,0x1f,0xf1,0xb6,0x23,0x77,0x02,0xf8,
-0x4a,0x0e,0x0a,0x00,0x02,0x24,0x00,0x01,0x0a,0x00,0x01,0x38,0x00,0x01,0xf2,0x3b,
-0x01,0x8a,0x04,0x10,0x0d,0x3a,0x03,0x00,0x60,0x00,0x0c,0x74,0x00,0x03,0xd2,0x99,
-0x13,0xd1,0x18,0x07,0x26,0xfd,0x10,0x20,0x07,0x0f,0x81,0x05,0x2e,0x06,0x5f,0x07,
-0x03,0x10,0x0c,0x05,0x95,0x02,0x04,0x0f,0x0a,0x03,0x1f,0x0a,0x04,0x1e,0x05,0x04,
-0x3f,0x0a,0x0f,0x6f,0x0a,0x14,0x60,0xdf,0xff,0xf0,0xdf,0xfd,0x0f,0xf8,0x01,0x01,
-0x65,0x0b,0x0f,0x47,0x0a,0x07,0x19,0x00,0x8a,0x1e,0x23,0xea,0x62,0xfe,0x35,0x24,
-0xff,0xf0,0xc6,0x70,0x04,0x0e,0x6f,0x13,0xd0,0x19,0x00,0x13,0xfb,0x0f,0xfb,0x23,
-0xff,0x70,0xe1,0x04,0x1a,0xf2,0x54,0x03,0x31,0x6f,0xff,0x30,0x5b,0x17,0x10,0x4f,
-0x6d,0x11,0x60,0x8f,0xf3,0x00,0x6f,0xff,0xd0,0xb4,0x11,0x43,0xe4,0xbf,0xff,0xd1,
-0x35,0x1b,0x16,0xd1,0xf1,0x99,0x00,0x9c,0x02,0x21,0xfb,0x30,0x59,0x00,0x22,0xdb,
-0x72,0x2f,0x12,0x10,0xee,0x67,0x24,0x20,0x61,0x08,0x14,0x03,0xf0,0x02,0x2d,0xff,
-0xd0,0xef,0x33,0xfe,0x00,0x2e,0xff,0xf3,0x0e,0xf3,0x3f,0xe0,0x2e,0xff,0xf3,0x8f,
-0x01,0x10,0x6e,0x7f,0x03,0x14,0x8e,0x46,0x32,0x12,0xef,0x8d,0x03,0x11,0x2e,0x33,
-0xcb,0x22,0x08,0xef,0x0d,0x90,0x40,0xff,0xff,0xf6,0xef,0xc7,0xdd,0x60,0x33,0xfe,
-0x02,0xef,0xff,0x30,0x3c,0x00,0x00,0x08,0x00,0x10,0x8f,0x8f,0x03,0x40,0xdf,0xfd,
-0x00,0x8e,0xba,0x37,0x21,0x66,0x10,0xd6,0x0e,0x12,0x0d,0x17,0x08,0x22,0x0f,0xd1,
-0x07,0x00,0x31,0xfd,0xdf,0xf0,0xef,0x2e,0x13,0xff,0xea,0x77,0x0f,0x07,0x00,0x1f,
-0x11,0xdf,0x46,0x08,0x16,0xf9,0x4c,0x09,0x02,0x64,0x29,0x13,0xfd,0xf3,0x29,0x22,
-0xc1,0x00,0x77,0x01,0x12,0x10,0x9b,0x6c,0x12,0xd1,0x6c,0x0f,0x12,0xfc,0x07,0x00,
-0x02,0x6c,0x01,0x0e,0x2c,0x02,0x23,0xfb,0x11,0xa5,0xc9,0x17,0x1f,0x07,0x00,0x03,
-0x15,0x00,0x08,0xba,0x07,0x21,0x12,0x22,0x6b,0x71,0x0a,0x3d,0x00,0x28,0x12,0x22,
-0x80,0x71,0x0f,0x23,0x00,0x2c,0x1b,0x8f,0xfe,0x02,0x22,0xcf,0xff,0x6c,0x0a,0x04,
-0xb4,0x07,0x21,0xd2,0x5f,0x45,0x1a,0x30,0x2d,0xff,0x62,0xdc,0x07,0x10,0x26,0x87,
-0xf0,0x40,0xff,0xff,0x81,0xaf,0xfa,0x04,0x22,0x4d,0xd4,0xad,0xd9,0x2f,0x81,0x18,
-0x0e,0x03,0x09,0x11,0xdf,0x52,0xee,0x02,0x03,0xfa,0x01,0x87,0x05,0x11,0x06,0x24,
-0x13,0x11,0x08,0x7f,0x02,0x12,0x0a,0xa0,0x69,0x11,0xff,0x5b,0x3b,0x01,0xeb,0x0a,
-0x13,0x0d,0x43,0x03,0x22,0x0a,0xff,0x79,0x58,0x11,0x50,0x54,0x81,0x02,0xc2,0x4f,
-0x01,0xbf,0x02,0x01,0xb4,0x05,0x02,0xd1,0x29,0x11,0xd7,0xae,0x02,0x21,0xde,0x40,
-0x1d,0x03,0x30,0x99,0xff,0xfd,0x6a,0x01,0x14,0x99,0x18,0x11,0x01,0x07,0x00,0x12,
-0x90,0x7f,0x01,0x10,0x0d,0x17,0x02,0x30,0xff,0xff,0x0f,0x17,0x02,0x02,0x07,0x00,
-0x11,0xfd,0x07,0x00,0x00,0x9f,0x62,0x03,0xbb,0x05,0x08,0x07,0x00,0x32,0xdf,0xff,
-0x0f,0x41,0x00,0x0a,0x07,0x00,0x13,0x0d,0x5e,0x03,0x13,0xcc,0x51,0x03,0x11,0x30,
-0x74,0xcc,0x01,0xcd,0x36,0x12,0x1e,0xaf,0x0d,0x12,0x9f,0xbd,0x00,0x01,0xd4,0x52,
-0x04,0x86,0x00,0x02,0x12,0x4d,0x03,0xee,0xfa,0x22,0x30,0x08,0x1c,0x06,0x03,0xe1,
-0x0d,0x04,0x1c,0xfe,0x03,0xdf,0x0b,0x06,0xe2,0x20,0x11,0xe0,0xda,0x00,0x15,0xee,
-0x11,0x57,0x09,0x9f,0x04,0x30,0x00,0xf0,0x0f,0x03,0x00,0x07,0x09,0x00,0x05,0x01,
-0x00,0x77,0xf8,0x08,0x80,0x88,0x08,0x80,0x8f,0x09,0x00,0x07,0x36,0x00,0x00,0xf5,
-0x03,0x17,0x00,0x09,0x00,0x0e,0x15,0x0e,0x0a,0x01,0x00,0x23,0x03,0xaf,0x10,0x04,
-0x12,0xcf,0x3b,0x04,0x22,0x06,0xdf,0x6c,0x7b,0x22,0x17,0xef,0xcf,0xce,0x13,0x18,
-0xb6,0x00,0x13,0x2a,0x62,0x2c,0x24,0x08,0xff,0x01,0x4c,0x04,0x78,0x6e,0x02,0x12,
-0x00,0x03,0x60,0x3a,0x05,0xe7,0x49,0x04,0xc8,0xd4,0x15,0x00,0x25,0x07,0x15,0xff,
-0x1a,0xfe,0x14,0xfa,0x27,0x07,0x14,0xf2,0xae,0x05,0x08,0x48,0x07,0x00,0x79,0x03,
-0x31,0xf0,0xd1,0x00,0x7f,0xf6,0x11,0x10,0xa3,0x03,0x11,0xd1,0x06,0x00,0x12,0xfd,
-0x78,0x15,0x0f,0xbe,0x05,0x29,0x1d,0xdf,0x3c,0x05,0x41,0x04,0x9c,0xef,0xfe,0xbc,
-0x97,0x12,0x07,0x08,0x21,0xe1,0x70,0x00,0x04,0xdf,0xff,0xfc,0xa8,0x8a,0xcf,0xff,
-0xfd,0x40,0x6f,0xff,0xe7,0x8f,0x53,0x5d,0xff,0xf6,0xcf,0xf6,0x24,0x05,0x80,0xfc,
-0x1a,0x30,0x00,0x5a,0xdf,0xfd,0xa5,0x47,0x69,0x11,0x00,0xb5,0x42,0x11,0xd4,0x4a,
-0x08,0x60,0xfe,0xa8,0x8a,0xef,0xff,0x50,0xef,0x06,0x00,0x9c,0x33,0x24,0xfd,0x10,
-0xc0,0x84,0x13,0x21,0xd2,0x08,0x15,0xe4,0x7e,0x20,0x1e,0xfe,0x0a,0x00,0x02,0x1e,
-0x00,0x15,0x8f,0x54,0x08,0x06,0xf0,0x05,0x14,0xff,0xcc,0x1e,0x17,0xfd,0xbb,0x02,
-0x03,0x0a,0x00,0x06,0xd6,0x02,0x09,0xe0,0x02,0x06,0x32,0x00,0x05,0x46,0x00,0x06,
-0x5a,0x00,0x0f,0x64,0x00,0x11,0x24,0xf0,0x00,0x64,0x00,0x00,0x54,0x26,0x0e,0x0a,
-0x00,0x0f,0x64,0x00,0x30,0x02,0x99,0x06,0x04,0x6a,0x10,0x0e,0x0a,0x00,0x0f,0x64,
-0x00,0x2f,0x24,0xf0,0x00,0x64,0x00,0x02,0x10,0x07,0x0e,0x0a,0x00,0x0f,0x64,0x00,
-0x2d,0x06,0x6f,0x76,0x06,0x26,0x11,0x0d,0x0a,0x00,0x0f,0x64,0x00,0x0d,0x0b,0x76,
-0x87,0x02,0x39,0x02,0x01,0x55,0xff,0x05,0x5c,0x2c,0x43,0xb9,0x29,0xfe,0x10,0x85,
-0x41,0x21,0x10,0x02,0xb1,0x03,0x60,0xdf,0x80,0x0a,0x90,0x00,0x00,0x02,0xed,0x40,
-0xdf,0xff,0x77,0xf7,0xf5,0x6e,0x80,0x8f,0xd3,0x0f,0xff,0xfd,0xcc,0xdf,0xdc,0xef,
-0x3d,0x60,0xb0,0x8f,0xfe,0x10,0x00,0xaa,0x60,0x0b,0x10,0x40,0xc8,0x7e,0x53,0x01,
-0xf2,0x02,0x33,0x10,0x55,0x34,0x14,0xb1,0x80,0x23,0x05,0x7f,0xa6,0x01,0x00,0x08,
-0x15,0xf9,0x43,0x0a,0x11,0x22,0x36,0x61,0x80,0xdf,0xfd,0x92,0x00,0x02,0xef,0xfb,
-0xef,0xd7,0x0b,0xf0,0x0d,0xfa,0x2e,0xff,0xe0,0x4f,0xff,0xfa,0x03,0xff,0xf5,0x9f,
-0xfa,0xfa,0x35,0x4f,0xfa,0xcf,0xc0,0x8a,0x3d,0x0b,0xfd,0xef,0xfb,0x03,0x11,0x8f,
-0xfe,0x5b,0x63,0x01,0x17,0x08,0xf0,0x0d,0x08,0xff,0xff,0xef,0xfd,0x11,0x10,0x9f,
-0xff,0xdf,0xd1,0x59,0x3b,0x0b,0xfd,0xaf,0xd6,0xfa,0x37,0x1d,0xfb,0x5f,0xff,0xfa,
-0x01,0xdf,0xf7,0x0d,0xac,0x09,0xc1,0xf1,0x03,0xef,0xfc,0xdf,0xff,0x50,0x00,0x18,
-0xdf,0xfe,0xa3,0xa8,0x0b,0x2b,0xf7,0x00,0xd5,0xfc,0x09,0xbc,0x77,0x14,0xf0,0x07,
-0x00,0xcf,0xf9,0x9f,0x99,0xf9,0x9f,0xf0,0x0f,0xf8,0x8f,0x88,0xf8,0x8f,0x07,0x00,
-0x12,0x03,0x31,0x00,0x08,0xa4,0x0b,0x13,0x80,0x1c,0x0c,0x14,0xa0,0x24,0x0c,0x14,
-0xb0,0x36,0x0c,0x11,0xa0,0x28,0x30,0x12,0x1d,0xa2,0x01,0x51,0x7f,0xfa,0x1d,0xff,
-0x70,0x20,0x00,0x32,0xfa,0x1d,0x70,0x4c,0x0c,0x14,0xfa,0xea,0xad,0x1f,0x70,0x08,
-0x00,0x08,0x13,0x6f,0x08,0x00,0x13,0x0b,0x08,0x00,0x00,0xbc,0x04,0x13,0x70,0xbb,
-0x42,0x12,0x70,0xc3,0x1b,0x07,0x09,0x13,0x05,0x60,0x0d,0x12,0xff,0x6a,0x62,0x23,
-0x01,0xdf,0x18,0x75,0x00,0x1d,0x0b,0x20,0xfa,0xef,0x40,0x6f,0x20,0x01,0xdf,0x72,
-0x69,0x50,0xe2,0x0a,0xff,0xff,0x1d,0x21,0x33,0x31,0x02,0x20,0x2e,0xae,0x07,0x00,
-0x40,0x6e,0x18,0xef,0x0a,0x00,0x06,0x1e,0x00,0x06,0x32,0x00,0x06,0x46,0x00,0x07,
-0x5a,0x00,0x06,0x6e,0x00,0x11,0x07,0x06,0x00,0x10,0x7f,0x16,0x00,0x71,0x07,0xf8,
-0x0f,0x0b,0x40,0xff,0x7f,0x06,0x00,0x12,0xff,0x06,0x00,0x0f,0x01,0x00,0x22,0x02,
-0x34,0x05,0x13,0x4e,0x38,0x63,0x09,0xce,0x02,0x11,0x03,0xa1,0x4d,0x00,0xea,0x09,
-0x11,0x10,0xf7,0xb2,0x00,0x1d,0xb7,0x21,0xcf,0xf1,0x09,0x93,0x21,0x11,0xcf,0xac,
-0xf6,0x33,0xbf,0xf1,0xcf,0x47,0x00,0x23,0x17,0xff,0xda,0x14,0x14,0x07,0x35,0x06,
-0x14,0x06,0x2c,0x06,0x1e,0x05,0x0a,0xd7,0x01,0xbe,0x1b,0x0f,0x01,0x00,0x02,0x04,
-0x1e,0x0e,0x27,0xf1,0x00,0x2e,0x20,0x57,0xf9,0x00,0xfe,0xf5,0x00,0x01,0xbc,0x0a,
-0xfe,0x06,0x3e,0x05,0x00,0x03,0x16,0x00,0x2f,0xdc,0x00,0x01,0x00,0x15,0x1f,0xe1,
-0x1e,0x00,0x0a,0x03,0x88,0x00,0x10,0xf6,0x84,0x46,0x62,0xf1,0xfe,0xf6,0xfb,0x00,
-0xed,0x93,0x00,0x7d,0xff,0x00,0x00,0xfe,0xff,0xfa,0xfc,0x57,0xdb,0x3f,0xfd,0x00,
-0xfd,0xdd,0x00,0x04,0x18,0xfd,0x07,0x47,0x07,0x5d,0x84,0x0a,0x65,0xed,0x13,0xf1,
-0x2a,0x00,0x10,0xf5,0x4a,0x00,0x1b,0xfb,0x24,0x0c,0x0c,0xfa,0x00,0x05,0x3c,0x00,
-0x11,0xfe,0x3f,0x00,0x38,0xfe,0xfd,0xfd,0x77,0x1e,0x45,0x00,0xe8,0x00,0xe6,0x24,
-0x00,0x53,0xfc,0xfd,0x00,0x00,0xfd,0x04,0x00,0x0a,0x87,0xdb,0x02,0x90,0x00,0x1f,
-0x02,0x6b,0x00,0x08,0x1f,0xfd,0x43,0x01,0x0d,0x16,0xec,0xd5,0x00,0x04,0x31,0x00,
-0x10,0xfd,0x07,0x00,0x28,0xfb,0xf8,0x8c,0x01,0x00,0xe6,0x4f,0x77,0x00,0xe6,0xfd,
-0xe6,0xf4,0x00,0xdd,0xf7,0x00,0x26,0xf1,0xfa,0x38,0x8b,0x00,0xff,0x5b,0x23,0x00,
-0xe9,0x1a,0x22,0x32,0xfc,0x00,0xff,0xbf,0xb1,0x1d,0x02,0x65,0x01,0x01,0x6f,0x00,
-0x4f,0xfd,0xfe,0x00,0xfc,0x97,0x00,0x0b,0x36,0xfa,0x00,0xfe,0x6b,0x22,0x0b,0x7b,
-0x02,0xb1,0xe0,0xde,0x00,0x00,0xf1,0xfd,0xe5,0xfe,0x02,0x00,0x02,0x60,0x00,0xd3,
-0xeb,0xf5,0x00,0xf5,0xe6,0xf8,0xf7,0x00,0xf8,0xf6,0xfa,0xf6,0xf9,0x5e,0x01,0x66,
-0xe5,0xec,0x00,0x00,0xf7,0xfe,0x2b,0x01,0x00,0x97,0xc0,0x41,0xfa,0xfc,0x00,0x00,
-0x3a,0x06,0x12,0x02,0x3e,0x01,0x22,0xee,0xf9,0xb4,0x02,0x13,0x02,0x24,0x00,0x22,
-0xfc,0xfc,0x6c,0x01,0x16,0xfe,0xa6,0xbc,0x02,0x49,0xc9,0x17,0xfd,0x11,0x00,0x04,
-0x20,0x01,0x14,0xfc,0xcd,0x00,0xe0,0x03,0xfa,0xe3,0xed,0x00,0x00,0xed,0xfc,0xf4,
-0xfe,0x02,0xf4,0x02,0x02,0x92,0x00,0xe6,0xf8,0xf8,0xfd,0xfb,0xf8,0xfb,0xf9,0xfd,
-0xfb,0xfe,0x00,0xfd,0xfc,0x02,0xc5,0x00,0x2e,0x02,0xfd,0x68,0x01,0x08,0xf8,0x01,
-0x05,0x4d,0x02,0x08,0xf3,0x5d,0x0e,0xcc,0xef,0x0f,0x1d,0x00,0x0a,0x0f,0x57,0x01,
-0x0a,0x10,0xff,0x6e,0x02,0x0c,0xbd,0x02,0x0f,0x6c,0x00,0x27,0x1e,0x02,0xbd,0x03,
-0x19,0x02,0x71,0x02,0x10,0x02,0x7d,0x03,0x0f,0x01,0x00,0x24,0x0b,0x81,0x00,0x1f,
-0xf5,0x2c,0x00,0x0b,0x23,0xfd,0xfe,0xa2,0x01,0x1c,0xea,0x6c,0x02,0x30,0xfe,0x03,
-0x00,0x66,0x87,0x2e,0x00,0x02,0x89,0x02,0x0b,0xdf,0x4a,0x09,0x58,0x03,0x1c,0xeb,
-0x63,0x00,0x2d,0xfe,0x02,0x14,0x01,0x1f,0xf1,0xd8,0x00,0x24,0x0e,0xf6,0x80,0x0f,
-0x03,0x02,0x15,0x0f,0x1c,0x02,0x07,0x13,0x01,0xd5,0x02,0x11,0x03,0x06,0x64,0x2d,
-0x04,0x05,0x21,0x00,0xf1,0x0d,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,
-0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,
-0x19,0x00,0x31,0x8e,0x70,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0xe7,0x26,0xff,0x01,
-0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x00,
-0x01,0x00,0xff,0xff,0xae,0x02,0x1c,0x03,0x20,0x03,0x02,0x17,0x03,0x4c,0x06,0x07,
-0x06,0x08,0xee,0x3f,0x60,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,
-0x08,0x00,0xa0,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x37,0x81,0x00,
-0xbd,0x57,0x51,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xe1,0x19,0x19,0x1a,0x19,0x17,
-0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0xbc,0xb6,0x1e,0x00,0x01,0x00,0x1f,
-0x24,0x16,0x03,0xff,0xff,0x91,0x50,0x00,0x00,0x00,0x00,0x00,
+0xf6,0x08,0xff,0xff,0xf8,0xf1,0x01,0x40,0x08,0xf6,0x59,0xf4,0x18,0x00,0xf1,0x00,
+0x08,0xff,0xff,0xf4,0x7a,0xff,0xae,0xe0,0x08,0xf5,0x49,0xf4,0xae,0xff,0xef,0x10,
+0x00,0xf1,0x03,0x00,0xde,0x05,0x70,0x08,0xf1,0x5b,0xf4,0x5c,0xfe,0x00,0x00,0x08,
+0xf1,0x6f,0xb0,0x2f,0xd6,0x4b,0x03,0x36,0xf1,0x1f,0xe0,0x08,0x00,0xf4,0x09,0x03,
+0x33,0x3e,0xf1,0x1f,0xf3,0x33,0x30,0x0f,0xff,0xff,0xf1,0x1f,0xff,0xff,0xf1,0x0a,
+0xaa,0xaf,0xf1,0x1f,0xfa,0xaa,0xa0,0x20,0x00,0x92,0x09,0xcc,0xcf,0xf1,0x1f,0xfc,
+0xcc,0x80,0x0c,0x20,0x00,0x1c,0xb0,0x40,0x00,0x12,0x5f,0x18,0x00,0x40,0xf5,0x4e,
+0xee,0xef,0x28,0x00,0x1c,0xc4,0x20,0x00,0x06,0x08,0x00,0x02,0x01,0x00,0x12,0x2f,
+0x20,0x01,0xe0,0xf3,0x2c,0xcc,0xcc,0xdf,0xfc,0xcc,0xcc,0xc2,0x00,0x00,0x00,0x7f,
+0xa0,0x5c,0x04,0x82,0x99,0x99,0xdf,0xc9,0x99,0x99,0x40,0x08,0x20,0x00,0xf0,0x01,
+0x70,0x08,0xf6,0x2f,0xb2,0x2e,0xd2,0x8f,0x70,0x08,0xf5,0x0f,0xd8,0x8f,0xd0,0x6f,
+0x08,0x00,0x22,0xff,0xff,0x08,0x00,0x2a,0xa0,0x0d,0x10,0x00,0x03,0x20,0x00,0x65,
+0x1f,0xa0,0x0e,0xd0,0x7f,0x70,0x40,0x00,0x75,0xfc,0xbb,0xbb,0xbb,0xbb,0xdf,0x70,
+0x79,0x00,0x20,0x0f,0xd0,0x00,0x0a,0x50,0x00,0x15,0x5f,0xe5,0x50,0x08,0x00,0xc0,
+0x4f,0xff,0xff,0xf9,0xbb,0xff,0xbb,0xb1,0x15,0x5f,0xe5,0x5a,0x18,0x03,0x40,0x0a,
+0xbf,0xfb,0xa0,0x18,0x00,0xf1,0x05,0x0e,0xfc,0xcf,0xe3,0xbb,0xff,0xbb,0x60,0x0e,
+0xd8,0x8e,0xe4,0xff,0xff,0xff,0x80,0x0e,0xfe,0xef,0xe0,0x18,0x00,0xb0,0xd6,0x6e,
+0xe7,0xbb,0xff,0xbb,0xb5,0x0e,0xff,0xff,0xe9,0xb8,0x03,0x00,0x2e,0x03,0xf2,0x05,
+0x02,0xfd,0x05,0xf5,0x6f,0xff,0xff,0xf2,0x01,0xfd,0x06,0xf4,0x5b,0xbf,0xfb,0xb2,
+0x01,0xfd,0x7d,0xf1,0x68,0x00,0x21,0xcf,0x90,0x08,0x00,0x02,0xd0,0x03,0x23,0x15,
+0x50,0xfb,0x00,0x10,0xf2,0x87,0x07,0x12,0xff,0xc8,0x03,0xb0,0x02,0x9a,0xdd,0x99,
+0x99,0xde,0xb9,0x40,0x00,0x01,0xfe,0x2b,0x08,0xa3,0x00,0x17,0x77,0xef,0xa7,0x79,
+0xff,0x87,0x71,0x2f,0xa8,0x03,0x21,0x01,0x11,0x01,0x00,0x12,0x10,0x31,0x01,0x80,
+0xf5,0x00,0x00,0x2f,0xe9,0x99,0x99,0x9d,0x08,0x00,0x66,0xc4,0x44,0x44,0x4b,0xf5,
+0x00,0x18,0x00,0x48,0xc2,0x22,0x22,0x2b,0x20,0x00,0x02,0x18,0x00,0x13,0x0e,0x40,
+0x03,0x70,0x0a,0xbb,0xbb,0xdf,0xeb,0xbb,0xbb,0x2e,0x07,0x20,0x9f,0x60,0x86,0x00,
+0x93,0x6b,0xbb,0xff,0xbb,0xbb,0xb9,0x00,0x00,0x9f,0x70,0x03,0x50,0x9f,0x60,0x05,
+0x50,0x04,0x08,0x00,0x49,0x50,0x0e,0xf0,0x03,0x08,0x00,0x13,0x0f,0x08,0x00,0x20,
+0x2f,0xd0,0x08,0x00,0xf3,0x12,0x6b,0x40,0xcf,0x9a,0x84,0xa8,0x00,0x00,0x00,0x5d,
+0xfd,0x3c,0xff,0xa2,0x00,0x16,0xae,0xff,0xa1,0x00,0x4c,0xff,0x90,0x0b,0xfe,0x82,
+0x00,0x00,0x00,0x5e,0xa0,0x01,0x20,0xd7,0x08,0x30,0x99,0x99,0x6f,0x99,0x04,0xc1,
+0x5f,0xff,0xff,0x8a,0xaa,0xff,0xaa,0xa6,0x13,0x4f,0xd3,0x10,0x08,0x01,0x30,0x1f,
+0xc0,0x07,0x90,0x00,0x00,0x08,0x00,0x31,0xfc,0xaa,0xae,0x08,0x00,0x32,0xf4,0x58,
+0x2c,0x08,0x00,0x2a,0x9f,0x3c,0x08,0x00,0x13,0xaf,0x08,0x00,0x20,0xcf,0x1c,0x08,
+0x00,0xf0,0x0e,0x04,0xa6,0xfc,0x27,0x90,0x00,0x1f,0xc0,0x00,0x3e,0xf8,0xfb,0x10,
+0x2e,0xff,0xb0,0x3a,0xff,0x51,0xbf,0xe4,0x0c,0xeb,0x20,0x4f,0xd3,0x00,0x07,0xf5,
+0x3f,0x04,0x71,0x00,0x00,0x00,0x20,0x00,0x00,0x01,0x38,0x01,0xe0,0x8e,0xee,0xeb,
+0xaa,0xbf,0xfc,0xaa,0xa1,0x9f,0xff,0xfa,0x00,0x3f,0xe0,0x4d,0x0a,0x10,0x10,0x0c,
+0x06,0x10,0x50,0x08,0x00,0x31,0xba,0xaa,0xdf,0x08,0x00,0x31,0x37,0xb3,0x9f,0x08,
+0x00,0x28,0x39,0xf4,0x08,0x00,0xf0,0x0e,0x99,0xaf,0x3a,0xf4,0x9f,0x50,0x6a,0xff,
+0xfe,0xaf,0x3c,0xf2,0x9f,0x50,0xaf,0xfa,0x40,0x58,0x4f,0xe1,0x57,0x20,0x45,0x00,
+0x00,0x03,0xef,0x6d,0xe4,0xba,0x01,0xf1,0x02,0xaf,0xf6,0x05,0xef,0x90,0x00,0x00,
+0x1d,0xfc,0x30,0x00,0x1c,0xd1,0x00,0x00,0x02,0x20,0xc8,0x03,0x02,0x04,0x00,0x50,
+0x00,0x0d,0xb0,0x08,0xf8,0xe9,0x04,0xf0,0x09,0x0d,0xb9,0xb8,0xf5,0x99,0xff,0xa9,
+0x93,0x0d,0xb9,0xb8,0xf1,0x23,0xfc,0x22,0x20,0x0d,0xb9,0xb8,0xf3,0xff,0xff,0xff,
+0xe0,0x08,0x00,0x31,0xfc,0x88,0x8e,0x08,0x00,0x50,0xf7,0x68,0x0d,0xe0,0x0e,0x08,
+0x00,0x25,0xaf,0x1d,0x08,0x00,0xf2,0x22,0x0f,0xa9,0xb8,0xf3,0xf7,0xbf,0x0d,0xe0,
+0x0f,0x99,0xb8,0xf3,0xf7,0xcf,0x0d,0xe0,0x1f,0x89,0xb8,0xf2,0x96,0xff,0x67,0x80,
+0x5f,0x69,0xb8,0xf1,0x0c,0xfe,0xf9,0x00,0x9f,0x30,0x08,0xf5,0xdf,0x90,0xbf,0xa0,
+0x5d,0x00,0x07,0xdb,0xf8,0x00,0x0b,0xd1,0x01,0xf5,0x00,0x24,0x00,0x00,0x79,0x01,
+0x21,0x0b,0xf7,0x58,0x03,0xf0,0x05,0x00,0xaf,0xc0,0xcc,0xce,0xfd,0xcc,0xc3,0x1d,
+0xfc,0x10,0x00,0x0c,0xf4,0x00,0x00,0x08,0xa0,0x00,0x4f,0x2a,0x07,0xf1,0x0c,0x00,
+0x02,0xc6,0x4f,0xea,0xaa,0xdf,0x90,0x00,0x1d,0xf7,0x4f,0x92,0x74,0x6f,0x90,0x05,
+0xef,0x80,0x4f,0x94,0xfa,0x6f,0x90,0x1e,0xf7,0x00,0x08,0x00,0xf5,0x28,0x03,0x30,
+0x54,0x4f,0x94,0xf9,0x6f,0x90,0x00,0x02,0xfe,0x6f,0x96,0xf8,0x6f,0x90,0x00,0x1d,
+0xf5,0x3a,0x6b,0xf5,0x59,0x50,0x04,0xef,0x90,0x00,0x8f,0xbc,0xe6,0x00,0x4f,0xf9,
+0x00,0x4c,0xfc,0x05,0xef,0xb1,0x09,0x60,0x04,0xff,0x90,0x00,0x1b,0xf3,0x00,0x00,
+0x00,0x42,0x00,0x00,0x00,0x8a,0x08,0x40,0x4e,0xee,0xef,0xad,0x79,0x02,0xf0,0x05,
+0x3b,0xbb,0xdf,0xa8,0xaa,0xef,0xba,0xa4,0x01,0x51,0xee,0x10,0x22,0xef,0x32,0x10,
+0x0b,0xff,0xf3,0x04,0xf8,0x06,0xf2,0x0d,0x01,0x9f,0xf6,0x04,0xfc,0x99,0x9f,0xb0,
+0x59,0x9d,0xfd,0xa8,0xf6,0x79,0x2f,0xb0,0x8f,0xff,0xff,0xf9,0xf6,0xbf,0x2f,0xb0,
+0x00,0x1f,0xc8,0xf5,0x08,0x00,0x40,0xcb,0xb4,0xf6,0xcf,0x08,0x00,0xe0,0xc2,0x24,
+0xf7,0xee,0x1f,0xb0,0x00,0x1f,0xc0,0x02,0x8b,0xf9,0x27,0x50,0xf8,0x01,0xf6,0x05,
+0x7f,0xe5,0xfa,0x10,0x1c,0xdf,0xb0,0x4d,0xfe,0x20,0xaf,0xd2,0x0c,0xfd,0x30,0x0b,
+0x70,0x00,0x08,0xb0,0x52,0x04,0x15,0xfa,0x08,0x00,0x10,0xcf,0x78,0x05,0xf0,0x10,
+0xf0,0xff,0xfb,0x8a,0xaf,0xea,0xa2,0x08,0xf0,0xfd,0x97,0x00,0x3f,0x80,0x00,0x08,
+0xf0,0xfa,0x00,0x4a,0xcf,0xba,0x90,0x5d,0xfb,0xfe,0xbb,0x7f,0xed,0xdf,0xf0,0x1a,
+0x0e,0xf0,0x41,0x8f,0x28,0x4a,0xf0,0x01,0x26,0xf5,0x00,0x6f,0x2f,0x7a,0xf0,0x08,
+0xf7,0xf5,0xae,0x7f,0x3f,0x7a,0xf0,0x0e,0xc5,0xf6,0xfb,0x6f,0x3f,0x6a,0xf0,0x6f,
+0x55,0xfd,0xf5,0x6f,0x6f,0x4a,0xf0,0x04,0x03,0xdf,0xc0,0x5d,0x9f,0x18,0xb0,0x00,
+0x06,0xff,0x20,0x02,0xef,0xe6,0x00,0x06,0xcf,0xe3,0x00,0x5d,0xf4,0xaf,0xa0,0x3f,
+0xf9,0x10,0x08,0xfe,0x40,0x08,0xf4,0x04,0x00,0x00,0x00,0x50,0x00,0x00,0x30,0x08,
+0xff,0xff,0xf5,0xf8,0x01,0x80,0x08,0xf6,0x49,0xf4,0x77,0xbf,0xa7,0x73,0x78,0x05,
+0xf1,0x49,0x23,0xbf,0x53,0x30,0x08,0xf6,0x4a,0xf4,0x8f,0xff,0xff,0xc0,0x08,0xfe,
+0xef,0xf4,0x8f,0x26,0x3d,0xc0,0x01,0x33,0x33,0x30,0x8f,0x3f,0x5c,0xc0,0x4f,0xff,
+0xff,0xfe,0x8f,0x3f,0x4c,0xc0,0x16,0x69,0xf9,0x66,0x8f,0x5f,0x3c,0xc0,0x07,0xd5,
+0xf5,0x00,0x8f,0x9f,0x0c,0xc0,0x09,0xf4,0xff,0xfa,0x39,0xfb,0x77,0x40,0x0a,0xf8,
+0xf8,0x53,0x4d,0xe3,0xdf,0x60,0x0d,0xff,0xf5,0x06,0xfd,0x30,0x0b,0xf2,0x4f,0x7c,
+0xfd,0xa9,0xc8,0x88,0x88,0xc4,0x5e,0x00,0x5b,0xdf,0x18,0x04,0x05,0xf7,0x09,0x12,
+0x61,0x08,0x00,0x70,0x04,0xf8,0x00,0x68,0x88,0x88,0x81,0x30,0x07,0xf1,0x21,0xad,
+0xdf,0xed,0xd3,0x07,0xbd,0x89,0xd9,0x00,0x3f,0x40,0x00,0x00,0xae,0x07,0xf2,0x5a,
+0xdf,0xaa,0x70,0x06,0xbf,0x9e,0xe8,0x8f,0xaa,0xae,0xb0,0x0a,0xff,0xff,0xff,0x8d,
+0x1c,0x3b,0xb0,0x0a,0xf0,0x19,0xe4,0x8d,0x2f,0x4b,0xb0,0x0b,0xfb,0xff,0x70,0x08,
+0x00,0xf0,0x28,0xf5,0x75,0xc6,0x8d,0x3f,0x3b,0xb0,0x0c,0xe4,0xbf,0xc1,0x8d,0x5f,
+0x1b,0xb0,0x0d,0xef,0xe7,0x74,0x7b,0x8e,0x09,0x90,0x1f,0xa3,0x4c,0xfa,0x03,0xf9,
+0x85,0x00,0x5f,0xcd,0xff,0x71,0x6e,0xe2,0xaf,0x90,0x6f,0x4c,0x71,0x0e,0xfb,0x20,
+0x07,0xf4,0x02,0x00,0x00,0x03,0x20,0x00,0x00,0x30,0x82,0x1f,0xff,0xff,0xff,0xff,
+0xd0,0x00,0x00,0x08,0x00,0xa0,0x1c,0x70,0x00,0x00,0x00,0x00,0x1f,0xd0,0xcf,0x90,
+0x08,0x00,0x41,0x0f,0xec,0xf8,0x00,0x08,0x00,0x29,0xff,0x80,0x08,0x00,0x40,0x0d,
+0xfd,0xfe,0x50,0x08,0x00,0x40,0x0c,0xf3,0x7f,0xf2,0x08,0x00,0x40,0x09,0xf5,0x02,
+0x60,0x08,0x00,0x31,0x06,0xf8,0x00,0x18,0x00,0x41,0x02,0xfd,0x00,0xf5,0x29,0x00,
+0x22,0xcf,0x83,0x08,0x00,0x31,0x4f,0xff,0xf2,0x08,0x00,0xf0,0x27,0x04,0xdf,0x90,
+0x00,0xd7,0x00,0x00,0x03,0xf7,0x00,0x00,0x02,0xfa,0x00,0x14,0x47,0xfa,0x44,0x20,
+0x06,0xf8,0x11,0x4f,0xee,0xff,0xef,0x70,0x09,0xff,0xff,0xaf,0x76,0xf9,0x6f,0x70,
+0x0e,0xf7,0xdf,0x5f,0xff,0xff,0xff,0x70,0x4f,0x91,0xfa,0x55,0x57,0xfa,0x55,0x52,
+0x8f,0x8a,0x63,0x9a,0x00,0xf0,0x02,0xf8,0x05,0x9f,0x00,0x37,0x77,0x77,0x77,0x40,
+0x00,0x9f,0x00,0x6f,0xff,0xff,0xff,0x80,0x08,0x00,0x31,0x42,0x94,0x4f,0x08,0x00,
+0x20,0x44,0xf6,0x08,0x00,0xf3,0x18,0x69,0x6f,0x46,0xf5,0x4f,0x80,0x00,0xaf,0xfc,
+0x38,0x4d,0xf5,0x69,0x40,0x01,0xef,0xa0,0x38,0xff,0x7b,0xfd,0x50,0x05,0xf6,0x02,
+0xff,0xd5,0x00,0x4d,0xf1,0x00,0x20,0x00,0x43,0x00,0x00,0x00,0x30,0x00,0x01,0x00,
+0xf8,0x62,0x2f,0xff,0xff,0x0c,0xff,0xff,0xff,0xf3,0x19,0x99,0xdf,0x0c,0xfb,0xbb,
+0xbb,0xb2,0x03,0x30,0xbe,0x0c,0xf0,0x00,0x04,0x00,0x0b,0xe0,0xcd,0x0c,0xf6,0xc0,
+0x5f,0x80,0x0c,0xc0,0xdc,0x0c,0xf6,0xf9,0xaf,0x20,0x0d,0xb0,0xfa,0x0c,0xf0,0xbf,
+0xfc,0x00,0x0f,0xb3,0xfa,0x1c,0xf0,0x1e,0xf6,0x00,0x0f,0xff,0xff,0x9c,0xf0,0x1e,
+0xfa,0x00,0x04,0x44,0x6f,0x8c,0xf0,0x9f,0xff,0x40,0x00,0x26,0x5f,0x7c,0xf5,0xfd,
+0x4f,0xc0,0x8f,0xff,0x9f,0x6c,0xfc,0xf3,0x0b,0xc0,0x58,0x40,0x6f,0x4c,0xf1,0x50,
+0x01,0x00,0x00,0x67,0xdf,0x1c,0xff,0xff,0xff,0xf7,0x00,0x9f,0xf8,0x09,0xbb,0xbb,
+0xbb,0xb5,0x00,0x01,0x00,0x20,0xde,0x00,0x48,0x00,0x10,0x40,0x08,0x00,0x40,0x09,
+0x99,0xdf,0x30,0x08,0x00,0xf1,0x0c,0x03,0x40,0x9f,0x2b,0xff,0xff,0xff,0xe0,0x0a,
+0xe0,0xaf,0x0b,0xf8,0xef,0x8e,0xe0,0x0b,0xd0,0xbf,0x0b,0xe0,0xde,0x0d,0xe0,0x0d,
+0xb0,0xdd,0x08,0x00,0x31,0x0e,0xb2,0xed,0x20,0x00,0xf5,0x29,0x0f,0xff,0xff,0xd7,
+0x99,0xff,0x99,0x90,0x04,0x44,0x4f,0xc7,0xd2,0xfc,0x00,0x00,0x00,0x25,0x5f,0xa2,
+0xfe,0xf8,0x00,0x00,0x7f,0xff,0xdf,0x80,0x5f,0xf5,0x00,0x00,0x49,0x52,0x5f,0x60,
+0xbf,0xff,0xa3,0x00,0x00,0x48,0xdf,0x9f,0xfa,0x2b,0xff,0xe3,0x00,0x4f,0xe7,0x3d,
+0x60,0x00,0x4a,0xa0,0x7c,0x00,0x22,0x08,0xf4,0x8b,0x01,0xf3,0x22,0x4b,0xf7,0x44,
+0x2f,0xff,0xff,0xa0,0x0f,0xff,0xff,0xff,0x2f,0xc5,0x6f,0xa0,0x02,0x6f,0xc2,0xaf,
+0x1f,0x90,0x1f,0xa0,0x05,0xef,0x66,0xed,0x1f,0xd9,0xaf,0xa0,0x4f,0xe4,0x2e,0xd5,
+0x1a,0xaa,0xaa,0x70,0x04,0x3a,0xaa,0xaa,0xaa,0xaa,0x90,0x00,0x00,0x3f,0x29,0x02,
+0xf0,0x03,0x03,0xa7,0x00,0x00,0x7f,0xa0,0x00,0x00,0x06,0xfa,0x00,0x00,0x9f,0x70,
+0x00,0x00,0x0a,0xff,0x01,0x00,0xa0,0xf1,0x00,0x05,0x66,0x66,0x66,0x66,0x6f,0xf0,
+0x0c,0x0e,0x00,0xa2,0xf9,0x1f,0xd0,0x07,0x88,0x88,0x88,0x88,0xcc,0xbf,0x78,0x00,
+0x31,0x3f,0xfc,0x20,0x08,0x00,0x11,0x96,0x47,0x00,0xf1,0x24,0x00,0x07,0xfd,0x00,
+0x00,0x29,0x99,0xdf,0x00,0x3f,0xff,0x90,0x00,0x02,0x30,0xae,0x03,0xef,0x5c,0xfa,
+0x00,0x0a,0xf0,0xbd,0x5f,0xf6,0x01,0xcf,0xe4,0x0b,0xe0,0xcd,0xef,0xda,0xaa,0xbf,
+0xf6,0x0c,0xd0,0xeb,0x55,0x8e,0xee,0xe6,0x80,0x0d,0xc2,0xfa,0x20,0x00,0x11,0x30,
+0x01,0xf7,0x26,0xc5,0xd0,0xcb,0x09,0xe2,0x04,0x44,0x4f,0xb5,0xf4,0x9f,0x0e,0xd0,
+0x00,0x25,0x4f,0xa1,0xf7,0x6f,0x5f,0x70,0x6e,0xff,0x9f,0x80,0xe9,0x39,0xbf,0x10,
+0x48,0x51,0x3f,0x70,0x00,0x00,0xf9,0x00,0x00,0x57,0xcf,0x4f,0xff,0xff,0xff,0xf4,
+0x00,0x6f,0xfa,0x0a,0xaa,0xaa,0xaa,0xa2,0x76,0x01,0x20,0x17,0x80,0x9c,0x02,0x91,
+0x22,0x22,0x3f,0xf4,0x22,0x22,0x20,0x1f,0xff,0x01,0x00,0x31,0xf0,0x06,0x66,0x01,
+0x00,0x60,0x60,0x00,0x0e,0xff,0xff,0xff,0xa7,0x02,0x50,0x0f,0xf5,0x55,0x55,0x5e,
+0x08,0x00,0x82,0xfc,0xcc,0xcc,0xcf,0xf2,0x00,0x00,0x06,0x1f,0x00,0x12,0x09,0x30,
+0x00,0xf1,0x08,0xa0,0x0a,0xfa,0x99,0x99,0x99,0x99,0xbf,0xa0,0x0a,0xf3,0x7c,0xcc,
+0xcc,0xc4,0x3f,0xa0,0x0a,0xf3,0x9f,0xba,0xac,0xf5,0x08,0x00,0x22,0x75,0x58,0x08,
+0x00,0xc1,0xff,0xff,0xfa,0xaf,0x90,0x0a,0xf3,0x59,0x10,0x00,0x0c,0xdb,0x70,0x02,
+0x12,0x05,0x76,0x02,0xf0,0x13,0x05,0xf7,0x00,0x00,0xef,0xff,0xc1,0xee,0xff,0xee,
+0xe3,0x0e,0xfc,0xfc,0x1f,0xd7,0x87,0xcf,0x30,0xec,0x0f,0xc1,0xfb,0x8b,0x09,0xf2,
+0x0e,0xc0,0xfc,0x1f,0xb3,0xf8,0xaf,0x00,0x0f,0x00,0x30,0x05,0x7e,0xe0,0x0f,0x00,
+0x30,0xb0,0x1e,0xd5,0x0f,0x00,0x80,0xfd,0x77,0x77,0x77,0x1e,0xd5,0xfc,0x1f,0x9c,
+0x00,0xf1,0x07,0xef,0xff,0xc0,0x00,0x00,0x00,0xaf,0x1e,0xe6,0x65,0x8f,0xff,0xff,
+0xcb,0xf0,0xa9,0x00,0x05,0x99,0x99,0x98,0xce,0x5b,0x00,0x32,0x07,0x7f,0xc0,0x71,
+0x03,0x17,0xe4,0xf0,0x00,0xe2,0x0d,0xf0,0x00,0x00,0x00,0x03,0xbb,0xbb,0xbf,0xfc,
+0xbb,0xbb,0x70,0x05,0xc0,0x00,0xb0,0x90,0x00,0x01,0x11,0x1d,0xf2,0x11,0x11,0x00,
+0x00,0x5f,0x0f,0x00,0xf0,0x0f,0xfb,0x00,0x00,0x15,0x55,0x5e,0xf6,0x55,0x54,0x00,
+0x1d,0xdd,0xdd,0xdf,0xfd,0xdd,0xdd,0xd5,0x0a,0xaa,0xaf,0xfd,0xaa,0xaa,0xaa,0xa4,
+0x00,0x00,0xaf,0xf9,0x6f,0x03,0x22,0x00,0x5d,0xdf,0x01,0xe0,0x0b,0xff,0xdf,0xb1,
+0x05,0xff,0x50,0x00,0x01,0x92,0x0a,0xfd,0x9f,0xf6,0x5f,0x00,0xf1,0x09,0x15,0xef,
+0xff,0xb3,0x00,0x00,0x07,0xad,0xff,0xfc,0xaf,0xff,0xfd,0xb5,0x09,0xfe,0xb7,0x20,
+0x00,0x6a,0xdf,0xf1,0x00,0x10,0x7c,0x00,0x02,0x06,0x00,0xf0,0x1c,0x1f,0x80,0x00,
+0x07,0xff,0xff,0xff,0x20,0x1f,0xb9,0x00,0x07,0xf5,0xf7,0x8f,0x20,0x1f,0xcf,0x70,
+0x07,0xfa,0xe9,0xff,0x20,0x1f,0x89,0xf1,0x07,0xeb,0xed,0x8f,0x31,0x2f,0x92,0x40,
+0x07,0xf5,0xf8,0x7f,0xaf,0xff,0xff,0xf6,0x28,0x00,0xf2,0x3a,0x7a,0xbf,0xda,0xa4,
+0x01,0x36,0xf9,0x33,0x00,0x4f,0xc0,0x00,0x06,0xff,0xff,0xff,0x00,0x6f,0xf1,0x00,
+0x01,0x46,0xf9,0x55,0x00,0xbf,0xf5,0x00,0x0b,0xee,0xff,0xff,0x40,0xfc,0xea,0x00,
+0x09,0xba,0x98,0x88,0x17,0xf6,0x9f,0x20,0x03,0xd9,0x7e,0x7d,0x1e,0xf0,0x2f,0xb0,
+0x09,0xc9,0x7f,0x5d,0xdf,0x60,0x0a,0xf9,0x0f,0x68,0x78,0x31,0xcb,0x00,0x00,0xd4,
+0x01,0x00,0x00,0x00,0x01,0x80,0x00,0x22,0x16,0x70,0x08,0x01,0x21,0x1e,0xf3,0xbc,
+0x04,0x02,0xf0,0x01,0xe1,0x08,0x8a,0xfe,0x98,0x89,0xff,0xb8,0x80,0x00,0x00,0x7f,
+0xc3,0x2d,0xf8,0xb6,0x04,0x11,0xff,0xd7,0x04,0xf3,0x12,0x25,0x9d,0xff,0xff,0xfc,
+0x86,0x41,0x2f,0xff,0xfd,0x82,0x16,0xbf,0xff,0xf2,0x06,0x86,0xd8,0x00,0x00,0x8a,
+0x44,0x40,0x00,0x01,0xfc,0x00,0x00,0xcf,0x20,0x00,0x00,0x02,0x08,0x00,0x22,0x06,
+0xfa,0x08,0x00,0x21,0x1e,0xf5,0x08,0x00,0x32,0x01,0xef,0xc0,0x10,0x00,0x22,0x5b,
+0x10,0x08,0x00,0x09,0x01,0x00,0x30,0x49,0xdc,0x00,0x89,0x00,0x90,0xbf,0xff,0xff,
+0x00,0x00,0x03,0x8d,0xff,0xff,0x08,0x00,0x22,0xcf,0xff,0x08,0x00,0x00,0x06,0x00,
+0x11,0xc7,0x08,0x00,0x30,0xfa,0x51,0x00,0x08,0x00,0x31,0x84,0x00,0x00,0x08,0x00,
+0x1f,0x00,0x08,0x00,0x06,0x22,0x2b,0xee,0x08,0x00,0x51,0xdf,0xff,0xff,0x2b,0xee,
+0x08,0x00,0x30,0xfd,0xdf,0xff,0x18,0x00,0x50,0xff,0xb2,0xdf,0xff,0xfd,0x72,0x00,
+0x00,0x0b,0x00,0x01,0x08,0x00,0x21,0xd0,0x0f,0xef,0x00,0xf4,0x02,0x0d,0xff,0xff,
+0xc8,0x88,0x88,0x8c,0xff,0xff,0xf0,0x0f,0x80,0x00,0x00,0x08,0xf0,0x0f,0x08,0x00,
+0x01,0xf5,0x00,0x10,0x08,0x18,0x00,0x64,0xec,0xcc,0xcc,0xce,0xf0,0x0f,0x08,0x00,
+0x06,0x18,0x00,0x0c,0x30,0x00,0x02,0x48,0x00,0x04,0x58,0x00,0x30,0xdf,0xff,0x73,
+0x09,0x00,0x42,0xfd,0xff,0xff,0xa5,0x5a,0x01,0x03,0x08,0x00,0x04,0x18,0x00,0x04,
+0x02,0x01,0x0f,0x28,0x00,0x3b,0x22,0x0a,0xb1,0x08,0x00,0x21,0xbf,0xfc,0x07,0x00,
+0x32,0x0b,0xff,0xfb,0x0f,0x00,0x40,0xff,0xc0,0x1b,0xa0,0x0f,0x00,0x41,0xfc,0x00,
+0xcf,0xfb,0x0f,0x00,0x40,0x00,0xbf,0xff,0xb0,0x0f,0x00,0x51,0x00,0x0c,0xff,0xfb,
+0xbf,0x38,0x03,0x11,0xcf,0xee,0x02,0x00,0x11,0x00,0x22,0xff,0xb0,0x35,0x00,0x22,
+0xfb,0x00,0x45,0x00,0x01,0x0f,0x00,0x10,0x03,0x04,0x00,0xf0,0x02,0x08,0xfc,0x10,
+0x00,0x1c,0xf8,0xff,0xfc,0x10,0x1c,0xff,0xf5,0xff,0xfc,0x2c,0xff,0xf5,0x36,0x03,
+0x30,0xf5,0x00,0x05,0x05,0x00,0x81,0x00,0x1d,0xff,0xfd,0x10,0x00,0x1c,0xff,0x1e,
+0x00,0x40,0xf9,0xff,0xfc,0x1c,0x1e,0x00,0x20,0xfc,0xdf,0x1e,0x00,0x60,0xd1,0xa4,
+0x00,0x00,0x04,0xa1,0xe8,0x06,0x11,0xe0,0xff,0x06,0xf0,0x11,0x10,0x6f,0xf1,0x03,
+0x10,0x00,0x00,0x5f,0xd0,0x6f,0xf1,0x3f,0xd1,0x00,0x03,0xff,0xf1,0x6f,0xf1,0x5f,
+0xfd,0x00,0x0d,0xff,0x40,0x6f,0xf1,0x09,0xff,0x70,0x4f,0xf7,0xd8,0x02,0x40,0xcf,
+0xe0,0x9f,0xf0,0x08,0x00,0x40,0x5f,0xf3,0xbf,0xc0,0x08,0x00,0x40,0x2f,0xf5,0xbf,
+0xc0,0x40,0x00,0x41,0x1f,0xf6,0xaf,0xe0,0x33,0x07,0x21,0xf4,0x6f,0xa9,0x05,0xd0,
+0xaf,0xf0,0x0f,0xfe,0x10,0x00,0x00,0x05,0xff,0xa0,0x06,0xff,0xd3,0xe7,0x05,0x91,
+0x20,0x00,0x9f,0xff,0xda,0xbe,0xff,0xf4,0x00,0x23,0x03,0x20,0xfd,0x30,0xd9,0x04,
+0x31,0xbd,0xca,0x50,0xcb,0x00,0x22,0x8b,0xb8,0xd3,0x00,0x11,0xff,0x34,0x02,0x80,
+0x30,0x06,0xff,0xff,0x60,0x03,0x00,0x04,0x24,0x02,0x42,0xfd,0xef,0x40,0x0d,0x57,
+0x01,0xe0,0xd0,0x4f,0xff,0xff,0xf9,0x9f,0xff,0xff,0xf4,0x08,0xff,0xff,0x20,0x02,
+0xef,0x01,0x74,0xff,0xf9,0x00,0x00,0x9f,0xff,0x00,0x08,0x00,0x04,0x18,0x00,0x04,
+0x28,0x00,0x04,0x38,0x00,0x20,0x04,0xfe,0x48,0x00,0x24,0xdf,0x40,0x58,0x00,0x05,
+0x68,0x00,0x06,0x78,0x00,0x50,0x03,0xdd,0x30,0x3f,0xf3,0x09,0x00,0x50,0x6f,0xff,
+0xf5,0x4f,0xf4,0x1a,0x08,0xc0,0xff,0x99,0xff,0xbf,0xf4,0x00,0x00,0x01,0xbf,0xf6,
+0x22,0x6f,0xb4,0x00,0xf0,0x0e,0x2d,0xfe,0x35,0xff,0x53,0xef,0xf4,0x00,0x04,0xff,
+0xc1,0x8f,0xff,0xf8,0x1c,0xfe,0x40,0x7f,0xfa,0x1a,0xff,0xff,0xff,0xa1,0xaf,0xf7,
+0xcf,0x82,0xdf,0xd0,0x00,0x41,0x28,0xfc,0x14,0x0e,0x70,0x00,0x23,0xe0,0x41,0xb4,
+0x03,0x10,0xf0,0xbd,0x03,0x32,0xf9,0x00,0x8f,0x09,0x00,0x1b,0xf8,0x09,0x00,0x71,
+0x0e,0xff,0xf6,0x00,0x6f,0xff,0xe0,0x43,0x02,0x18,0xfd,0xfe,0x00,0x0f,0x08,0x00,
+0x0d,0x20,0x4f,0xff,0x27,0x06,0x00,0x35,0x02,0x12,0xff,0x12,0x02,0x13,0xbf,0x21,
+0x02,0x19,0x0b,0x21,0x02,0x60,0xdf,0xff,0xfc,0x1b,0xb1,0xcf,0x98,0x02,0x4b,0xff,
+0xc2,0x2c,0xff,0x01,0x00,0x30,0xf0,0xe0,0xff,0xb5,0x00,0x01,0xa0,0x02,0xa1,0x04,
+0xef,0xff,0xff,0xff,0xfe,0x40,0x00,0x00,0x1e,0x11,0x00,0x50,0xe1,0x00,0x00,0xaf,
+0xb0,0x4e,0x00,0x50,0xfa,0x00,0x05,0xff,0x10,0x95,0x04,0x51,0xff,0x50,0x1e,0xf6,
+0x00,0x1d,0x01,0x11,0xe1,0x1a,0x00,0x00,0x1c,0x00,0x00,0xea,0x08,0x00,0x71,0x01,
+0x01,0xf1,0x00,0x04,0xa4,0x04,0x0f,0x01,0x00,0x05,0x13,0x8f,0x08,0x00,0xf0,0x14,
+0xf8,0x00,0x00,0x06,0xbd,0xda,0x50,0x02,0xff,0x00,0x05,0xef,0xff,0xff,0xfe,0x42,
+0xff,0x00,0x7f,0xff,0xa7,0x7b,0xff,0xf9,0xff,0x05,0xff,0xc1,0x00,0x00,0x2c,0xff,
+0xff,0x0e,0xfc,0xe8,0x06,0x42,0xdf,0xff,0x5f,0xf2,0xf8,0x04,0x22,0x8f,0xb0,0x08,
+0x00,0x1b,0x00,0x01,0x00,0x02,0x5d,0x01,0x22,0x0b,0xf8,0x08,0x00,0xd0,0x2f,0xf4,
+0xff,0xfd,0x22,0x20,0x00,0x00,0xcf,0xe0,0xff,0xff,0xc2,0x48,0x00,0xf5,0x08,0x40,
+0xff,0x9f,0xff,0xb7,0x6a,0xff,0xf7,0x00,0xff,0x24,0xdf,0xff,0xff,0xfe,0x50,0x00,
+0xff,0x20,0x05,0xac,0xdb,0x60,0x3f,0x00,0x10,0x8d,0x29,0x04,0x5e,0x00,0x00,0x8f,
+0xff,0xdf,0xad,0x00,0x01,0x14,0x00,0x02,0x57,0x02,0x22,0x09,0xff,0x2c,0x00,0x28,
+0x00,0x00,0x3a,0x00,0x02,0x3c,0x00,0x00,0x3e,0x00,0x02,0x12,0x05,0x20,0x01,0x50,
+0x36,0x00,0x21,0x06,0xf7,0x1c,0x05,0x11,0xbe,0x06,0x00,0x10,0xae,0x06,0x00,0x20,
+0x05,0xf8,0x4a,0x00,0x22,0x02,0x60,0x4c,0x00,0x03,0x4e,0x00,0x3a,0x00,0x00,0x9e,
+0xca,0x00,0x23,0x06,0x10,0x09,0x00,0x23,0x1f,0xd2,0x60,0x00,0x31,0x03,0xee,0x10,
+0x63,0x00,0x41,0x0a,0xb1,0x2f,0xb0,0x66,0x00,0x41,0x05,0xfc,0x07,0xf4,0x4b,0x00,
+0x42,0x50,0x5f,0x60,0xf9,0x6c,0x00,0x32,0x0d,0xc0,0xbd,0x69,0x00,0x33,0x09,0xf0,
+0x9f,0x09,0x00,0x24,0xe0,0x8f,0x1b,0x00,0x14,0xad,0x2d,0x00,0x11,0xe9,0x7b,0x00,
+0x41,0x05,0xfc,0x06,0xf4,0x7e,0x00,0x02,0x51,0x00,0x00,0x63,0x00,0x38,0x02,0xee,
+0x10,0x75,0x00,0x02,0x87,0x00,0x13,0x8f,0xa4,0x01,0x23,0xff,0xfc,0x09,0x01,0x21,
+0x20,0x2f,0x07,0x00,0x10,0xfc,0x79,0x04,0x12,0xee,0x10,0x00,0x60,0xfe,0x12,0xef,
+0xff,0xff,0xfc,0x24,0x02,0xe1,0x2e,0xff,0xff,0xfe,0x4e,0xfe,0x10,0x00,0x02,0xff,
+0xff,0xe1,0x02,0xc1,0x93,0x01,0x1b,0x10,0xac,0x02,0x09,0xfd,0x01,0x00,0xfc,0x01,
+0x20,0x4e,0x40,0x3b,0x02,0x11,0xfb,0x53,0x02,0x20,0xf1,0x00,0x9d,0x00,0x11,0x90,
+0xcf,0x0a,0x10,0x30,0x62,0x00,0x11,0xfc,0x71,0x07,0x21,0xf8,0x02,0xcd,0x08,0x01,
+0xd5,0x00,0x20,0x9e,0xff,0x98,0x02,0x20,0xff,0x2f,0x06,0x00,0xf1,0x02,0xf2,0xbf,
+0xff,0xff,0xfe,0x9f,0xa1,0xbf,0xff,0xff,0x92,0xff,0xa2,0x2f,0xff,0xf2,0x04,0x03,
+0x03,0x43,0x02,0x9e,0xfe,0x92,0x6e,0x00,0xf0,0x01,0x30,0x00,0x01,0xcc,0xff,0x40,
+0x00,0x2d,0xff,0xff,0x40,0x03,0xef,0xff,0xff,0x40,0xf5,0x09,0x10,0x44,0x41,0x00,
+0x1a,0x9f,0xde,0x01,0x10,0xaf,0x05,0x00,0x10,0x45,0x05,0x00,0x34,0x40,0x4f,0xff,
+0x2d,0x00,0x00,0x37,0x00,0x00,0x41,0x00,0x08,0x99,0x01,0x23,0x8f,0x91,0xc7,0x00,
+0x12,0x70,0x07,0x00,0x22,0xfd,0x40,0xd5,0x00,0x22,0xfa,0x10,0xdc,0x00,0x13,0xf7,
+0xe3,0x00,0x13,0xd5,0xea,0x00,0x13,0xb2,0x4f,0x03,0x09,0x07,0x00,0x17,0xb2,0x23,
+0x00,0x12,0xf7,0x3f,0x00,0x17,0x20,0x4d,0x00,0x01,0x5b,0x00,0x3e,0x8e,0xa1,0x00,
+0x01,0x00,0x11,0x8f,0x26,0x04,0x00,0xe0,0x02,0x03,0x5f,0x00,0x0f,0x07,0x00,0x37,
+0x83,0x7f,0xff,0xf7,0x00,0x7f,0xff,0xf7,0x8f,0xee,0x01,0x0f,0x01,0x00,0x40,0x03,
+0x5b,0x00,0x01,0xc9,0x00,0xd1,0xcc,0x10,0x00,0x03,0xff,0xff,0xd2,0x00,0x04,0xff,
+0xff,0xfe,0x30,0xb6,0x01,0x10,0x04,0x1d,0x00,0x20,0x54,0xff,0x0c,0x01,0x0a,0x37,
+0x00,0x23,0xf9,0xff,0xb4,0x01,0x14,0xf3,0x2d,0x00,0x00,0x37,0x00,0x01,0x41,0x00,
+0x04,0x17,0x01,0x12,0x2d,0xb0,0x02,0x20,0x01,0xef,0x5a,0x06,0x00,0xd9,0x06,0x21,
+0xff,0xd1,0x3d,0x0a,0x00,0x3f,0x02,0x06,0x11,0x05,0x11,0xaf,0x5d,0x00,0x04,0xf9,
+0x0a,0x15,0x90,0x41,0x09,0x02,0x08,0x00,0x14,0x80,0x4d,0x00,0x12,0x0c,0x10,0x00,
+0x14,0xc0,0x20,0x00,0x04,0x08,0x00,0x03,0x18,0x00,0x00,0x7b,0x07,0x70,0x1a,0x40,
+0x00,0x00,0x01,0xdf,0xf0,0x6a,0x00,0x57,0xa0,0x00,0x01,0xdf,0xfa,0x09,0x00,0x80,
+0x0c,0xff,0xa0,0x00,0x00,0x0d,0xff,0x80,0x21,0x00,0x11,0xf8,0x8c,0x00,0x0c,0x0b,
+0x00,0x00,0xc5,0x0a,0x21,0x1b,0x50,0x5f,0x07,0x30,0x0f,0xfc,0x10,0x70,0x0c,0x10,
+0xc1,0x17,0x07,0x0c,0x0b,0x00,0x00,0x69,0x00,0x10,0x08,0xa0,0x0c,0x77,0x8f,0xfd,
+0x10,0x00,0x08,0xff,0xd1,0x09,0x00,0x20,0x0f,0xfd,0x41,0x07,0x12,0xb1,0xf7,0x0c,
+0x22,0xff,0x40,0x7c,0x04,0x1f,0x80,0x07,0x00,0x04,0x7a,0x48,0x88,0x8c,0xff,0xc8,
+0x88,0x84,0x54,0x01,0x03,0x15,0x00,0x0f,0x38,0x00,0x09,0x03,0x5b,0x00,0x20,0x14,
+0x44,0x01,0x00,0x32,0x41,0xef,0xff,0x76,0x03,0x02,0x01,0x00,0x20,0x7b,0xbb,0x01,
+0x00,0x81,0xb7,0x00,0x00,0x05,0xad,0xff,0xda,0x50,0x08,0x0f,0x30,0xfc,0x88,0xcf,
+0xbe,0x02,0xf0,0x12,0x7f,0xfe,0x40,0x00,0x04,0xef,0xf7,0x00,0x07,0xff,0xf4,0x00,
+0x9e,0x80,0x4f,0xff,0x70,0x4f,0xff,0xc0,0x00,0xaf,0xf8,0x0c,0xff,0xf4,0xdf,0xff,
+0x80,0x9a,0xff,0xfe,0x08,0xe1,0x09,0x21,0x80,0xef,0x09,0x00,0x50,0x4f,0xff,0xc0,
+0x8f,0xff,0x1b,0x00,0x50,0x07,0xff,0xf4,0x08,0xee,0x2d,0x00,0x03,0x3f,0x00,0x17,
+0xf8,0x51,0x00,0x80,0x00,0x05,0xad,0xff,0xda,0x50,0x00,0x00,0x33,0x8c,0x20,0x00,
+0x01,0x00,0x24,0xdf,0xe4,0x0a,0x00,0x70,0x1b,0xff,0x80,0x49,0xdf,0xfd,0xa5,0x0b,
+0x00,0xf1,0x27,0x7f,0xff,0xff,0xd8,0x8c,0xff,0xd4,0x00,0x00,0x00,0x04,0xef,0xf8,
+0x00,0x00,0x4e,0xff,0x70,0x00,0x00,0x00,0x1c,0xff,0x69,0xe8,0x04,0xff,0xf7,0x00,
+0x04,0xe3,0x00,0x9f,0xfe,0xff,0x80,0xcf,0xff,0x40,0x0d,0xff,0x70,0x05,0xff,0xff,
+0xe0,0x8f,0xff,0xd0,0x0d,0xff,0xf7,0x00,0x2d,0x0a,0x00,0xf0,0x18,0x04,0xff,0xfc,
+0x00,0x00,0xaf,0xf8,0xcf,0xff,0x30,0x00,0x7f,0xff,0x40,0x00,0x06,0xff,0xff,0xf7,
+0x00,0x00,0x08,0xff,0xf4,0x00,0x00,0x3e,0xff,0xa0,0x00,0x00,0x00,0x4d,0xff,0xc8,
+0x82,0x01,0xbf,0xf7,0x66,0x00,0x74,0x5a,0xdf,0xfc,0x10,0x08,0xff,0xb0,0x80,0x00,
+0x24,0x4e,0xfd,0x0a,0x00,0x20,0x02,0xc8,0x06,0x00,0x24,0x2d,0xd2,0x10,0x00,0x23,
+0xbf,0xfb,0x09,0x00,0x42,0x05,0xff,0xff,0x50,0x0a,0x00,0x63,0x0d,0xff,0xff,0xd0,
+0x00,0x00,0xac,0x00,0x11,0xf7,0x09,0x00,0x60,0x01,0xff,0xd8,0x8d,0xff,0x10,0x0a,
+0x00,0x41,0x0a,0xff,0xa0,0x0a,0x6d,0x00,0x70,0x00,0x3f,0xff,0xb0,0x0b,0xff,0xf3,
+0x0a,0x00,0x62,0xcf,0xff,0xc0,0x0c,0xff,0xfc,0x44,0x00,0x21,0xd0,0x0d,0x48,0x00,
+0xf3,0x1a,0x0e,0xff,0xff,0xf9,0x9f,0xff,0xff,0xe0,0x00,0x00,0x8f,0xff,0xff,0xe2,
+0x2e,0xff,0xff,0xf8,0x00,0x02,0xff,0xff,0xff,0x90,0x09,0xff,0xff,0xff,0x10,0x0a,
+0xff,0xff,0xff,0xe3,0x3e,0xff,0xff,0xff,0xa0,0x0f,0xff,0x01,0x00,0x24,0xf0,0x08,
+0x0a,0x00,0x29,0x80,0x00,0x01,0x00,0x13,0xd8,0x08,0x00,0xf1,0x1a,0xff,0x80,0xff,
+0xff,0x70,0x00,0x07,0xff,0xff,0xf8,0xff,0xff,0xf6,0x00,0x6f,0xff,0xff,0xfd,0x78,
+0x8e,0xff,0x15,0xff,0xe8,0xff,0xe2,0x00,0x02,0xe5,0x4f,0xfe,0x20,0xfe,0x20,0x00,
+0x00,0x13,0xff,0xf3,0x00,0x52,0x9a,0x00,0x10,0x31,0x08,0x00,0xb0,0x02,0xef,0xf4,
+0x5e,0x20,0xfe,0x20,0x78,0x8e,0xff,0x51,0x28,0x00,0x04,0x38,0x00,0x04,0x48,0x00,
+0x04,0x58,0x00,0x0a,0x68,0x00,0x07,0x01,0x00,0x21,0x01,0xdd,0xf2,0x00,0x30,0x1d,
+0xff,0xd1,0x0d,0x00,0x40,0xdf,0xff,0xfd,0x10,0x0d,0x00,0xfa,0x11,0x99,0xff,0xd1,
+0x00,0x01,0xdf,0xf9,0x00,0x9f,0xfd,0x10,0x1d,0xff,0x90,0x00,0x09,0xff,0xd1,0xbf,
+0xf9,0x00,0x00,0x00,0x9f,0xfb,0x5f,0x90,0x00,0x00,0x00,0x09,0xf5,0x44,0x00,0x03,
+0x15,0x00,0x03,0x23,0x00,0x03,0x31,0x00,0x03,0x3f,0x00,0x03,0x4d,0x00,0x04,0x5b,
+0x00,0x03,0x69,0x00,0x04,0x77,0x00,0x0c,0x01,0x00,0x24,0x1d,0xd1,0x97,0x00,0x50,
+0xdf,0xfd,0x10,0xef,0xff,0xa4,0x01,0x50,0x1d,0xff,0xff,0xd1,0xaf,0x3d,0x01,0x40,
+0x00,0xcf,0xcf,0xfc,0x80,0x01,0x72,0x0f,0xf0,0x00,0x6b,0x1f,0xf1,0xb6,0x0a,0x00,
+0x01,0x04,0x00,0x0f,0x0a,0x00,0x02,0x01,0x24,0x00,0x01,0x0a,0x00,0x01,0x38,0x00,
+0x00,0x85,0x01,0x10,0xfa,0x4c,0x00,0x00,0xfa,0x01,0x20,0xff,0xfe,0x60,0x00,0x0c,
+0x74,0x00,0x21,0x00,0x00,0xc9,0x01,0x11,0xd1,0x32,0x01,0x12,0xff,0xaf,0x00,0x03,
+0xb0,0x01,0x2f,0xf8,0xff,0x01,0x00,0x2c,0x12,0x8f,0x48,0x00,0x00,0x90,0x01,0x29,
+0x0b,0xb0,0x95,0x02,0x22,0x0b,0xff,0xc2,0x02,0x42,0xbf,0xff,0xff,0xfb,0x0f,0x00,
+0x01,0x11,0x00,0x10,0x4f,0x08,0x00,0x12,0xf4,0x8b,0x00,0x2f,0x00,0x00,0x08,0x00,
+0x0e,0x60,0xdf,0xff,0xf0,0xdf,0xfd,0x0f,0xf8,0x01,0x4b,0xf9,0x00,0x00,0x9f,0x7d,
+0x00,0x42,0xf0,0xe0,0xff,0xdf,0x0a,0x00,0x1a,0xfd,0x6f,0x01,0x32,0x0a,0xea,0x62,
+0x30,0x03,0x00,0x5f,0x01,0x10,0x00,0xbe,0x01,0x03,0x55,0x00,0x12,0x0f,0x1e,0x03,
+0x00,0x19,0x00,0x02,0xa6,0x00,0x20,0x03,0xef,0xc3,0x03,0x00,0xd0,0x03,0x2a,0xff,
+0xf2,0x54,0x03,0x60,0x6f,0xff,0x30,0x00,0x00,0x02,0xb1,0x00,0xf0,0x00,0x90,0x00,
+0x02,0x8f,0xf3,0x00,0x6f,0xff,0xd0,0x00,0x0a,0xff,0xff,0xe4,0xbf,0x49,0x01,0x10,
+0xef,0x75,0x00,0x10,0xd1,0x51,0x03,0x00,0x18,0x03,0x01,0x2e,0x00,0x31,0xff,0xfb,
+0x30,0x59,0x00,0x21,0xdb,0x72,0x3f,0x00,0x80,0x08,0xee,0x80,0x00,0x00,0x06,0x61,
+0x08,0x14,0x03,0xf0,0x02,0x2d,0xff,0xd0,0xef,0x33,0xfe,0x00,0x2e,0xff,0xf3,0x0e,
+0xf3,0x3f,0xe0,0x2e,0xff,0xf3,0x8f,0x01,0x10,0x6e,0x7f,0x03,0x31,0x8e,0xff,0xff,
+0x86,0x03,0x22,0x02,0xef,0x8d,0x03,0x20,0x2e,0xff,0x76,0x00,0x30,0x08,0xef,0xff,
+0x08,0x00,0xf0,0x00,0x08,0xff,0xff,0xf6,0xef,0xff,0x30,0x00,0xef,0x33,0xfe,0x02,
+0xef,0xff,0x30,0x3c,0x00,0x00,0x08,0x00,0x10,0x8f,0x8f,0x03,0xa0,0xdf,0xfd,0x00,
+0x8e,0xe8,0x00,0x00,0x00,0x66,0x10,0x24,0x01,0x31,0xff,0x0d,0x10,0xd3,0x01,0x22,
+0x0f,0xd1,0x07,0x00,0xa3,0xfd,0xdf,0xf0,0xff,0xff,0xff,0x20,0x00,0xff,0xf0,0x29,
+0x01,0x0f,0x07,0x00,0x1e,0x10,0xdf,0x55,0x01,0x00,0x74,0x01,0x04,0x2c,0x02,0x01,
+0x67,0x00,0x00,0x68,0x01,0x01,0xf2,0x01,0x22,0xc1,0x00,0x77,0x01,0x21,0x10,0xff,
+0x60,0x04,0x21,0xd1,0xff,0x28,0x00,0x12,0xfc,0x07,0x00,0x02,0x6c,0x01,0x0e,0x2c,
+0x02,0x30,0xfb,0x11,0xbf,0x07,0x00,0x37,0xf1,0x00,0x1f,0x07,0x00,0x03,0x15,0x00,
+0x07,0x4d,0x02,0x30,0xf8,0x12,0x22,0x01,0x00,0x1a,0x21,0x3d,0x00,0x03,0x15,0x00,
+0x03,0xe1,0x01,0x0f,0x23,0x00,0x2c,0x1b,0x8f,0xfe,0x02,0x12,0xcf,0x07,0x00,0x22,
+0xfc,0x09,0x08,0x00,0x30,0x90,0xd2,0x5f,0x07,0x00,0xf0,0x02,0xf5,0x2d,0xff,0x62,
+0xcf,0xff,0xff,0xfc,0x26,0xff,0xff,0xfa,0x18,0xff,0xff,0x81,0xaf,0xfa,0x04,0x31,
+0x4d,0xd4,0x3e,0x24,0x00,0x2f,0x81,0x18,0x0e,0x03,0x09,0x30,0xdf,0xff,0xfd,0x18,
+0x01,0x00,0x58,0x05,0x11,0x03,0x87,0x05,0x20,0x06,0xff,0x60,0x02,0x11,0x08,0x7f,
+0x02,0x01,0x35,0x02,0x30,0xd0,0x0c,0xff,0x44,0x05,0x20,0x0e,0xff,0xa9,0x01,0x13,
+0x0d,0x43,0x03,0x10,0x0a,0x74,0x05,0x21,0x00,0x0e,0xcc,0x05,0x21,0x2f,0xfc,0x83,
+0x04,0x11,0xf3,0xbf,0x02,0x11,0xa0,0x92,0x06,0x01,0xda,0x03,0x11,0xd7,0xae,0x02,
+0x21,0xde,0x40,0x1d,0x03,0x30,0x99,0xff,0xfd,0x6a,0x01,0x35,0x99,0xff,0xff,0xa7,
+0x01,0x01,0x90,0x02,0x00,0x07,0x00,0x10,0x0d,0x17,0x02,0x30,0xff,0xff,0x0f,0x17,
+0x02,0x02,0x07,0x00,0x10,0xfd,0x07,0x00,0x00,0x17,0x02,0x13,0xff,0xbb,0x05,0x08,
+0x07,0x00,0x32,0xdf,0xff,0x0f,0x41,0x00,0x0a,0x07,0x00,0x13,0x0d,0x5e,0x03,0x13,
+0xcc,0x51,0x03,0x10,0x30,0xf1,0x01,0xb2,0xbf,0xff,0xfc,0x20,0x00,0x00,0x1e,0xff,
+0xff,0xff,0xe1,0x96,0x03,0x12,0xf8,0x13,0x03,0x14,0xfd,0x86,0x00,0x12,0x01,0x07,
+0x00,0x11,0x03,0x07,0x00,0x22,0x30,0x08,0x1c,0x06,0x11,0x1e,0x07,0x00,0x22,0xe1,
+0xcf,0x6c,0x01,0x03,0x07,0x00,0x05,0xb4,0x03,0x31,0x0e,0xff,0xe0,0xda,0x00,0x23,
+0xee,0x40,0x64,0x02,0x0a,0x9f,0x04,0x30,0x00,0xf0,0x0f,0x03,0x00,0x07,0x09,0x00,
+0x05,0x01,0x00,0x77,0xf8,0x08,0x80,0x88,0x08,0x80,0x8f,0x09,0x00,0x07,0x36,0x00,
+0x00,0xf5,0x03,0x17,0x00,0x09,0x00,0x0b,0xab,0x01,0x2b,0xff,0xf8,0xaa,0x05,0x23,
+0x03,0xaf,0x10,0x04,0x12,0xcf,0x3b,0x04,0x31,0x06,0xdf,0xff,0x32,0x07,0x12,0x17,
+0x94,0x03,0x23,0x00,0x18,0xb6,0x00,0x22,0x2a,0xff,0xc9,0x04,0x03,0xfb,0x06,0x23,
+0xd0,0x00,0x4c,0x01,0x13,0x60,0x12,0x00,0x14,0xfe,0xc5,0x04,0x14,0xf7,0x09,0x00,
+0x14,0xf1,0x09,0x00,0x14,0x80,0x09,0x00,0x13,0x10,0x09,0x00,0x14,0xfa,0x27,0x07,
+0x14,0xf2,0xae,0x05,0x08,0x48,0x07,0x00,0x79,0x03,0x30,0xf0,0xd1,0x00,0x96,0x03,
+0x21,0xfd,0x10,0xa3,0x03,0x11,0xd1,0x06,0x00,0x21,0xfd,0xff,0x54,0x02,0x0f,0xbe,
+0x05,0x29,0x1d,0xdf,0x3c,0x05,0x50,0x04,0x9c,0xef,0xfe,0xc9,0x5c,0x02,0x21,0x07,
+0xef,0xc6,0x00,0xf0,0x00,0x70,0x00,0x04,0xdf,0xff,0xfc,0xa8,0x8a,0xcf,0xff,0xfd,
+0x40,0x6f,0xff,0xd5,0x23,0x00,0x53,0x5d,0xff,0xf6,0xcf,0xf6,0x24,0x05,0x50,0xfc,
+0x1a,0x30,0x00,0x5a,0x1c,0x09,0x50,0x03,0xa1,0x00,0x00,0x4d,0x32,0x00,0x11,0xd4,
+0x4a,0x08,0x60,0xfe,0xa8,0x8a,0xef,0xff,0x50,0xef,0x06,0x41,0x70,0x00,0x00,0x07,
+0x72,0x06,0x10,0x12,0x31,0x00,0x13,0x21,0xd2,0x08,0x05,0x5c,0x09,0x2e,0xef,0xfe,
+0x0a,0x00,0x02,0x1e,0x00,0x15,0x8f,0x54,0x08,0x06,0xf0,0x05,0x13,0xff,0x22,0x00,
+0x27,0x0f,0xfd,0xbb,0x02,0x03,0x0a,0x00,0x06,0xd6,0x02,0x09,0xe0,0x02,0x06,0x32,
+0x00,0x05,0x46,0x00,0x06,0x5a,0x00,0x0f,0x64,0x00,0x11,0x24,0xf0,0x00,0x64,0x00,
+0x10,0xf0,0x6d,0x01,0x0d,0x0a,0x00,0x0f,0x64,0x00,0x30,0x02,0x99,0x06,0x15,0x0f,
+0x39,0x05,0x0d,0x0a,0x00,0x0f,0x64,0x00,0x2e,0x24,0xf0,0x00,0x64,0x00,0x02,0x10,
+0x07,0x0e,0x0a,0x00,0x0f,0x64,0x00,0x2d,0x04,0x0a,0x00,0x05,0x46,0x00,0x1e,0x00,
+0x0a,0x00,0x0f,0x64,0x00,0x0e,0x02,0x23,0x09,0x05,0x8d,0x02,0x14,0x07,0xcc,0x08,
+0x34,0x01,0xcf,0xff,0x9b,0x09,0x33,0xb9,0x29,0xfe,0x15,0x00,0x31,0x3f,0x10,0x02,
+0xb1,0x03,0x40,0xdf,0x80,0x0a,0x90,0x08,0x00,0xf0,0x0d,0x70,0x00,0xdf,0xff,0x77,
+0xf7,0x55,0x55,0x55,0x55,0x8f,0xd3,0x0f,0xff,0xfd,0xcc,0xdf,0xdc,0xcc,0xcc,0xcd,
+0xff,0xb0,0x8f,0xfe,0x10,0x00,0xaa,0x60,0x0b,0x93,0x40,0x00,0x46,0x10,0x00,0x01,
+0xf2,0x02,0x33,0x40,0x00,0x44,0x09,0xb1,0xcf,0xf9,0x30,0x08,0x03,0x35,0x05,0x01,
+0x00,0x08,0x15,0xf9,0x43,0x0a,0x10,0x22,0x06,0x00,0x90,0x18,0xdf,0xfd,0x92,0x00,
+0x02,0xef,0xfb,0xef,0xd7,0x0b,0xf1,0x11,0xfa,0x2e,0xff,0xe0,0x4f,0xff,0xfa,0x03,
+0xff,0xf5,0x9f,0xfa,0xfa,0x35,0x4f,0xfa,0xcf,0xc0,0x8a,0x3d,0x0b,0xfd,0xef,0xfb,
+0x03,0x11,0x8f,0xfe,0xff,0xff,0xb0,0x06,0x17,0x08,0xf0,0x0d,0x08,0xff,0xff,0xef,
+0xfd,0x11,0x10,0x9f,0xff,0xdf,0xd1,0x59,0x3b,0x0b,0xfd,0xaf,0xd6,0xfa,0x37,0x1d,
+0xfb,0x5f,0xff,0xfa,0x01,0xdf,0xf7,0x0d,0xac,0x09,0xc1,0xf1,0x03,0xef,0xfc,0xdf,
+0xff,0x50,0x00,0x18,0xdf,0xfe,0xa3,0xa8,0x0b,0x13,0xf7,0x51,0x08,0x38,0xff,0xfe,
+0xef,0x3c,0x04,0x03,0x53,0x04,0x14,0xf0,0x07,0x00,0xcf,0xf9,0x9f,0x99,0xf9,0x9f,
+0xf0,0x0f,0xf8,0x8f,0x88,0xf8,0x8f,0x07,0x00,0x12,0x03,0x31,0x00,0x08,0xa4,0x0b,
+0x13,0x80,0x1c,0x0c,0x14,0xa0,0x24,0x0c,0x14,0xb0,0x36,0x0c,0x01,0x12,0x00,0x22,
+0x7a,0x1d,0xa2,0x01,0x51,0x7f,0xfa,0x1d,0xff,0x70,0x20,0x00,0x32,0xfa,0x1d,0x70,
+0x4c,0x0c,0x13,0xfa,0x54,0x0c,0x2f,0xff,0x70,0x08,0x00,0x08,0x13,0x6f,0x08,0x00,
+0x13,0x0b,0x08,0x00,0x00,0xbc,0x04,0x12,0x70,0xde,0x05,0x03,0x68,0x09,0x3c,0xde,
+0xdb,0x60,0x1d,0x0b,0x12,0x1b,0xfe,0x01,0x10,0xe4,0x4c,0x0b,0x02,0x00,0x01,0x00,
+0x1d,0x0b,0x70,0xfa,0xef,0xfe,0xaf,0xff,0xff,0x01,0x7f,0x05,0xd2,0x2e,0xe2,0x0a,
+0xff,0xff,0x1d,0xff,0xff,0xff,0xe2,0x02,0x20,0x2e,0xae,0x07,0x48,0xfe,0x20,0x02,
+0xef,0x0a,0x00,0x06,0x1e,0x00,0x06,0x32,0x00,0x06,0x46,0x00,0x07,0x5a,0x00,0x06,
+0x6e,0x00,0x11,0x07,0x06,0x00,0x10,0x7f,0x16,0x00,0x71,0x07,0xf8,0x0f,0x0b,0x40,
+0xff,0x7f,0x06,0x00,0x12,0xff,0x06,0x00,0x0f,0x01,0x00,0x22,0x02,0x34,0x05,0x12,
+0x4e,0x60,0x00,0x19,0x00,0xce,0x02,0x51,0x03,0xe0,0x00,0x00,0x10,0xea,0x09,0x31,
+0x10,0x00,0xbf,0x4b,0x01,0x40,0xf1,0x00,0xcf,0xf1,0xe5,0x02,0xb3,0xff,0x11,0xcf,
+0xff,0x77,0x77,0x77,0x77,0xbf,0xf1,0xcf,0x47,0x00,0x13,0x17,0x08,0x00,0x24,0xe0,
+0x07,0x35,0x06,0x14,0x06,0x2c,0x06,0x80,0x05,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -4536,11 +4922,36 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 176, .range_length = 63475, .glyph_id_start = 115, .list_length = 681, .type = 3, .unicode_list = 6368, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[99316] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 6159, .size = 4079, .comp_size = 3398 },
+{ .bitmap_start = 4079, .comp_offset = 9557, .size = 4025, .comp_size = 3045 },
+{ .bitmap_start = 8104, .comp_offset = 12602, .size = 4010, .comp_size = 3340 },
+{ .bitmap_start = 12114, .comp_offset = 15942, .size = 3997, .comp_size = 3271 },
+{ .bitmap_start = 16111, .comp_offset = 19213, .size = 3973, .comp_size = 3299 },
+{ .bitmap_start = 20084, .comp_offset = 22512, .size = 3983, .comp_size = 3076 },
+{ .bitmap_start = 24067, .comp_offset = 25588, .size = 3970, .comp_size = 3138 },
+{ .bitmap_start = 28037, .comp_offset = 28726, .size = 4092, .comp_size = 3298 },
+{ .bitmap_start = 32129, .comp_offset = 32024, .size = 3993, .comp_size = 3432 },
+{ .bitmap_start = 36122, .comp_offset = 35456, .size = 3976, .comp_size = 3364 },
+{ .bitmap_start = 40098, .comp_offset = 38820, .size = 4092, .comp_size = 3563 },
+{ .bitmap_start = 44190, .comp_offset = 42383, .size = 4066, .comp_size = 3290 },
+{ .bitmap_start = 48256, .comp_offset = 45673, .size = 4041, .comp_size = 3592 },
+{ .bitmap_start = 52297, .comp_offset = 49265, .size = 3986, .comp_size = 3298 },
+{ .bitmap_start = 56283, .comp_offset = 52563, .size = 4042, .comp_size = 3656 },
+{ .bitmap_start = 60325, .comp_offset = 56219, .size = 4050, .comp_size = 3647 },
+{ .bitmap_start = 64375, .comp_offset = 59866, .size = 4008, .comp_size = 3420 },
+{ .bitmap_start = 68383, .comp_offset = 63286, .size = 3984, .comp_size = 3567 },
+{ .bitmap_start = 72367, .comp_offset = 66853, .size = 4057, .comp_size = 3580 },
+{ .bitmap_start = 76424, .comp_offset = 70433, .size = 4059, .comp_size = 3433 },
+{ .bitmap_start = 80483, .comp_offset = 73866, .size = 4055, .comp_size = 2770 },
+{ .bitmap_start = 84538, .comp_offset = 76636, .size = 3752, .comp_size = 1940 },
+};
+
+static uint8_t etxUncompBuf[11026] __SDRAMFONTS;
 
 const etxLz4Font lv_font_cn_bold_STD = {
-.uncomp_size = 99052,
-.comp_size = 72396,
+.uncomp_size = 10762,
+.comp_size = 6159,
 .line_height = 19,
 .base_line = 4,
 .subpx = 0,
@@ -4553,12 +4964,13 @@ const etxLz4Font lv_font_cn_bold_STD = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 36,
-.glyph_bitmap = 7730,
-.class_pair_values = 96020,
-.left_class_mapping = 97460,
-.right_class_mapping = 98256,
+.class_pair_values = 7730,
+.left_class_mapping = 9170,
+.right_class_mapping = 9966,
+.block_num = 22,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 99316,
+.lvglFontBufSize = 11026,
 };
@@ -127,932 +127,1237 @@ static const uint8_t lz4FontData[] ={
 0x83,0x70,0x0e,0x0f,0x15,0x00,0x00,0x0f,0x84,0x60,0x0e,0x48,0x00,0x40,0x9e,0x84,
 0xe0,0x0b,0x68,0x00,0x40,0x01,0x85,0x60,0x0e,0x88,0x00,0x50,0x8a,0x85,0xe0,0x0b,
 0x0b,0xf8,0x07,0x12,0x85,0x20,0x00,0x22,0x77,0x86,0x20,0x00,0x40,0xda,0x86,0xf0,
-0x05,0xf8,0x01,0x21,0x0f,0xf3,0x02,0x00,0x15,0xf2,0x02,0x00,0x21,0xf1,0x0e,0x02,
-0x00,0xf0,0x32,0x04,0x50,0x00,0x00,0x04,0x60,0x1f,0xf5,0x0c,0xe3,0x6f,0x43,0xf6,
-0x6f,0x33,0xf6,0x6f,0x23,0xf5,0x6f,0x13,0xf4,0x6f,0x03,0xf2,0x5c,0x03,0xd1,0x00,
-0x00,0x08,0xf2,0x00,0xbf,0x00,0x00,0x00,0x0b,0xf0,0x00,0xec,0x00,0x00,0x00,0x0e,
-0xc0,0x02,0xf8,0x00,0x00,0x00,0x1f,0x90,0x05,0xf5,0x00,0x00,0x00,0x4f,0x60,0x08,
-0xf2,0x00,0x0b,0xff,0x01,0x00,0xf1,0x16,0xf7,0x07,0xaa,0xef,0xaa,0xaf,0xea,0xa4,
-0x00,0x00,0xec,0x00,0x1f,0x90,0x00,0x00,0x01,0xf9,0x00,0x5f,0x50,0x00,0x00,0x05,
-0xf5,0x00,0x8f,0x20,0x00,0x6a,0xac,0xfb,0xaa,0xef,0xaa,0x50,0x9f,0x2a,0x00,0x1f,
-0x90,0x45,0x00,0x01,0xd0,0x00,0x00,0x7f,0x30,0x0b,0xf0,0x00,0x00,0x00,0xaf,0x00,
-0x0e,0xc0,0x1b,0x0a,0x20,0x06,0x60,0x06,0x00,0x25,0x0d,0xe0,0x06,0x00,0xf0,0x16,
-0x06,0xbf,0xfb,0x50,0x00,0x00,0xbf,0xff,0xff,0xf9,0x00,0x08,0xfe,0x51,0x18,0xff,
-0x50,0x0e,0xf6,0x00,0x00,0xaf,0xc0,0x0f,0xf2,0x00,0x00,0x4f,0xf0,0x0f,0xf3,0x00,
-0x00,0x1a,0xa0,0x0b,0xfc,0x2e,0x00,0x30,0x03,0xff,0xd6,0x07,0x00,0xa0,0x4e,0xff,
-0xf9,0x20,0x00,0x00,0x01,0x7d,0xff,0xf8,0x0e,0x00,0x30,0x3b,0xff,0x70,0x07,0x00,
-0xf0,0x10,0x9f,0xe0,0x58,0x40,0x00,0x00,0x1f,0xf2,0x9f,0x90,0x00,0x00,0x0f,0xf2,
-0x6f,0xe1,0x00,0x00,0x6f,0xf0,0x0e,0xfd,0x52,0x37,0xff,0x90,0x03,0xef,0xff,0xff,
-0xfa,0x66,0x00,0x20,0xe8,0x40,0x9b,0x00,0x23,0xa0,0x00,0x06,0x00,0x31,0x04,0xcf,
-0xd8,0xab,0x0a,0x31,0x3f,0xd7,0x9f,0x14,0x00,0xf2,0x1e,0xaf,0x10,0x09,0xf1,0x00,
-0x1e,0x40,0x00,0xcd,0x00,0x06,0xf3,0x00,0xbe,0x00,0x00,0xae,0x00,0x07,0xf2,0x06,
-0xf4,0x00,0x00,0x6f,0x92,0x4e,0xd0,0x1e,0xa0,0x00,0x00,0x08,0xff,0xfd,0x20,0xae,
-0x10,0x00,0x00,0x00,0x13,0x20,0x05,0xf5,0xe6,0x0a,0x41,0x1e,0xb0,0x01,0x10,0x3b,
-0x00,0xc0,0x12,0xcf,0xfc,0x30,0x00,0x00,0x04,0xf6,0x0d,0xe7,0x6e,0xe0,0x4b,0x01,
-0x20,0x4f,0x50,0x23,0x00,0xf0,0x0f,0x9f,0x20,0x6f,0x20,0x01,0xf8,0x00,0x03,0xf7,
-0x00,0x6f,0x20,0x01,0xf7,0x00,0x0c,0xd0,0x00,0x4f,0x60,0x05,0xf5,0x00,0x01,0x20,
-0x00,0x0c,0xf8,0x8f,0xd0,0x39,0x00,0x90,0x01,0x9e,0xfb,0x10,0x00,0x07,0xdf,0xea,
-0x20,0x45,0x00,0xf0,0x10,0xfd,0xef,0xf3,0x00,0x00,0x02,0xff,0x50,0x09,0xfb,0x00,
-0x00,0x06,0xfd,0x00,0x02,0xfd,0x00,0x00,0x05,0xfd,0x00,0x05,0xfb,0x00,0x00,0x01,
-0xff,0x40,0x4e,0xf3,0x4a,0x01,0xa0,0xe9,0xff,0x50,0x00,0x00,0x00,0x0c,0xff,0xd2,
-0x00,0x0e,0x00,0xf0,0x5c,0xff,0xb0,0x00,0x00,0x00,0x09,0xff,0x5e,0xf9,0x00,0x2e,
-0xc0,0x5f,0xf3,0x03,0xff,0x60,0x4f,0xb0,0xbf,0x90,0x00,0x5f,0xf4,0x8f,0x80,0xcf,
-0x60,0x00,0x08,0xff,0xef,0x30,0xaf,0x90,0x00,0x00,0xaf,0xfb,0x00,0x4f,0xf4,0x00,
-0x00,0x9f,0xfc,0x00,0x08,0xff,0xb9,0xae,0xfe,0xef,0x90,0x00,0x3a,0xef,0xfc,0x71,
-0x3f,0xf6,0xcf,0xcf,0xce,0xcd,0xcc,0x87,0x00,0x00,0x00,0x10,0x00,0x01,0xc9,0x00,
-0x00,0xcf,0x40,0x00,0x9f,0x60,0x00,0x3f,0xb0,0x00,0x0c,0xf3,0x00,0x03,0xfd,0x00,
-0x00,0x9f,0x80,0x00,0x0d,0xf3,0x00,0x01,0xff,0x00,0x00,0x4f,0xe0,0x00,0x05,0xfc,
-0xeb,0x03,0xf0,0x35,0x00,0x06,0xfb,0x00,0x00,0x5f,0xc0,0x00,0x04,0xfd,0x00,0x00,
-0x1f,0xf0,0x00,0x00,0xef,0x20,0x00,0x0a,0xf6,0x00,0x00,0x4f,0xb0,0x00,0x00,0xdf,
-0x20,0x00,0x05,0xfa,0x00,0x00,0x0b,0xf4,0x00,0x00,0x1e,0xe2,0x00,0x00,0x2e,0x90,
-0x00,0x00,0x12,0x01,0x00,0x00,0x06,0xe3,0x00,0x00,0x2e,0xe2,0x00,0x00,0x3f,0xc0,
-0x00,0x00,0x8f,0x60,0x00,0x01,0xfe,0x00,0x32,0x00,0x00,0x44,0x00,0xf1,0x05,0x00,
-0xff,0x00,0x00,0x0d,0xf4,0x00,0x00,0xbf,0x70,0x00,0x09,0xf8,0x00,0x00,0x8f,0x90,
-0x00,0x08,0xf9,0x75,0x00,0x21,0x0a,0xf7,0x8c,0x00,0x21,0x0f,0xf1,0x86,0x00,0xf0,
-0x06,0x8f,0x70,0x00,0x0e,0xf1,0x00,0x06,0xf8,0x00,0x01,0xee,0x00,0x00,0xcf,0x30,
-0x00,0x6f,0x40,0x00,0x01,0x20,0xfc,0x00,0x21,0xbf,0x10,0x52,0x02,0x02,0x05,0x00,
-0xf0,0x09,0x5f,0xa4,0x9f,0x17,0xda,0x5d,0xff,0xff,0xff,0xfb,0x00,0x29,0xff,0xc5,
-0x10,0x00,0x0c,0xfe,0xe1,0x00,0x00,0x8f,0x85,0xfb,0x43,0x00,0xb1,0xaf,0x60,0x00,
-0x83,0x00,0x1b,0x10,0x00,0x00,0x02,0x86,0xb3,0x01,0x11,0x5f,0x78,0x01,0x2c,0x05,
-0xfd,0x0d,0x00,0x71,0x11,0x11,0x5f,0xd1,0x11,0x10,0x1f,0xc8,0x02,0x11,0x91,0x06,
-0x00,0x1e,0xf9,0x27,0x00,0x0b,0x0d,0x00,0xf0,0x0a,0x08,0xf9,0x08,0xf9,0x09,0xf8,
-0x0d,0xf3,0x4f,0xc0,0x3c,0x20,0x7c,0xcc,0xcc,0x19,0xff,0xff,0xf2,0x07,0x70,0x4f,
-0xf5,0x1d,0xe2,0xda,0x02,0x10,0xf0,0x5b,0x02,0x10,0x90,0x9a,0x02,0x50,0x30,0x00,
-0x00,0x00,0xfd,0xe8,0x02,0x10,0xf7,0xbc,0x01,0x50,0xf1,0x00,0x00,0x00,0x2f,0xb9,
-0x01,0x10,0x8f,0x8f,0x02,0x10,0xee,0x4c,0x00,0x10,0xf8,0x86,0x03,0x10,0xf2,0x97,
-0x02,0x10,0xc0,0xd7,0x01,0x00,0x20,0x03,0x10,0xdf,0xef,0x02,0x50,0xf9,0x00,0x00,
-0x00,0x0a,0xf8,0x01,0x10,0x0f,0x74,0x00,0x10,0x6f,0xe8,0x02,0x11,0x58,0x70,0x02,
-0xf0,0x0a,0x19,0xdf,0xeb,0x50,0x00,0x02,0xef,0xfd,0xef,0xf8,0x00,0x0c,0xfb,0x10,
-0x05,0xff,0x30,0x2f,0xf1,0x00,0x00,0x9f,0xa0,0x6f,0xb0,0xae,0x01,0x20,0x9f,0x90,
-0x9f,0x01,0x80,0xaf,0x80,0x00,0x00,0x1f,0xf1,0xaf,0x80,0x0e,0x03,0x07,0x06,0x00,
-0x12,0xf1,0x06,0x00,0xc1,0x8f,0x90,0x00,0x00,0x2f,0xf0,0x6f,0xc0,0x00,0x00,0x4f,
-0xd0,0x3c,0x00,0x30,0x90,0x0b,0xfc,0x48,0x00,0x50,0x02,0xef,0xfc,0xef,0xf8,0x60,
-0x00,0x10,0xfc,0x68,0x02,0xff,0x05,0x5b,0x80,0x39,0xff,0xf8,0xdf,0xff,0xef,0x8f,
-0xb5,0x0a,0xf8,0x10,0x00,0xaf,0x80,0x00,0x0a,0xf8,0x00,0x07,0x00,0x13,0x00,0x64,
-0x02,0xf0,0x0c,0x50,0x00,0x06,0xff,0xfd,0xff,0xfa,0x00,0x3f,0xf7,0x00,0x06,0xff,
-0x50,0xaf,0xa0,0x00,0x00,0xaf,0xb0,0xdf,0x50,0x00,0x00,0x6f,0xc0,0x23,0xe6,0x00,
-0x01,0x74,0x03,0x20,0xcf,0x40,0x18,0x01,0x01,0xdd,0x03,0x10,0x4f,0x01,0x01,0x20,
-0x02,0xef,0x78,0x00,0x20,0x2e,0xf7,0x1b,0x03,0x20,0xdf,0x80,0x47,0x01,0x11,0xf9,
-0x27,0x00,0x10,0xa0,0x22,0x01,0x11,0xfb,0xf5,0x02,0x62,0xfc,0xcc,0xcc,0xcc,0xc7,
-0x9f,0xa1,0x01,0xf0,0x01,0x3a,0xef,0xeb,0x40,0x00,0x7f,0xff,0xde,0xff,0x80,0x3f,
-0xf6,0x00,0x06,0xff,0x39,0x83,0x02,0x61,0xf8,0x57,0x30,0x00,0x00,0x8f,0x31,0x00,
-0x10,0xf7,0xa4,0x01,0xc0,0xfe,0x00,0x00,0x5c,0xdf,0xfc,0x20,0x00,0x06,0xff,0xff,
-0xb2,0x62,0x00,0x21,0xaf,0xe2,0x36,0x02,0x11,0xa0,0xc5,0x01,0xf0,0x09,0x9b,0x30,
-0x00,0x00,0x5f,0xeb,0xf9,0x00,0x00,0x08,0xfb,0x5f,0xf6,0x00,0x05,0xff,0x50,0x9f,
-0xfe,0xde,0xff,0x80,0x00,0x4b,0x58,0x00,0x10,0x00,0x78,0x03,0x11,0x90,0x6d,0x02,
-0x11,0xf9,0xf9,0x01,0x01,0x0d,0x00,0x21,0x1e,0xfb,0x96,0x01,0x10,0xf6,0x66,0x01,
-0xa0,0x05,0xfc,0x09,0xf9,0x00,0x00,0x01,0xef,0x20,0x9f,0x68,0x03,0x30,0x70,0x09,
-0xf9,0x4f,0x01,0x91,0x00,0x9f,0x90,0x00,0x0e,0xf3,0x00,0x09,0xf9,0xd9,0x02,0xa1,
-0x9f,0x90,0x03,0xff,0xdc,0xcc,0xce,0xfe,0xcb,0x6f,0x54,0x02,0x10,0xf0,0xb1,0x03,
-0x01,0x4e,0x00,0x00,0x27,0x00,0x0a,0x0d,0x00,0x11,0xcf,0x20,0x00,0x11,0xdf,0x06,
-0x00,0x21,0xff,0x10,0x7e,0x00,0x10,0x00,0xb1,0x00,0x01,0x77,0x02,0x31,0x04,0xfb,
-0x00,0x2a,0x01,0xf1,0x01,0x9e,0xfe,0x91,0x00,0x07,0xff,0xff,0xff,0xfe,0x20,0x05,
-0xdb,0x30,0x15,0xef,0xd0,0xc1,0x04,0x20,0xf3,0x00,0x59,0x02,0x20,0xf7,0x00,0x99,
-0x00,0x30,0xf8,0x19,0x80,0x0c,0x00,0x00,0x37,0x05,0xf0,0x15,0x1f,0xf3,0x09,0xfd,
-0x20,0x01,0xcf,0xd0,0x00,0xcf,0xfd,0xdf,0xfe,0x20,0x00,0x07,0xcf,0xfd,0x91,0x00,
-0x00,0x00,0x18,0xce,0xe0,0x00,0x00,0x06,0xff,0xfe,0xc0,0x00,0x00,0x7f,0xf8,0x10,
-0x71,0x04,0x10,0x30,0x88,0x00,0x20,0xf6,0x00,0x04,0x06,0x70,0xf1,0x7b,0xcb,0x50,
-0x00,0x2f,0xed,0x31,0x05,0xe0,0x5f,0xff,0x71,0x06,0xff,0x70,0x6f,0xf4,0x00,0x00,
-0x7f,0xe0,0x7f,0xc0,0x5b,0x05,0x00,0x06,0x00,0x40,0x0e,0xf4,0x5f,0xe0,0xba,0x03,
-0x20,0x3f,0xf1,0x53,0x02,0xf2,0x09,0x0d,0xf8,0x00,0x00,0x6f,0xe0,0x05,0xff,0x50,
-0x03,0xef,0x70,0x00,0x9f,0xfe,0xdf,0xfb,0x00,0x00,0x05,0xcf,0xfc,0x60,0x00,0x47,
-0x03,0x71,0x71,0xcc,0xcc,0xcc,0xcc,0xcf,0xf4,0xba,0x05,0x02,0x3c,0x03,0x11,0xaf,
-0xfb,0x05,0x21,0x2f,0xe0,0xfa,0x00,0x12,0xf8,0x62,0x01,0x01,0xd1,0x02,0x21,0x8f,
-0xa0,0x7f,0x00,0x11,0xf2,0xe5,0x00,0x11,0xfb,0x2c,0x00,0x26,0xef,0x40,0x6e,0x03,
-0x21,0x0d,0xf6,0x04,0x01,0x21,0xfe,0x00,0x0d,0x02,0x11,0x70,0xf5,0x00,0x11,0xf1,
-0xef,0x00,0x02,0x3f,0x01,0x10,0x29,0x6e,0x02,0xd1,0x03,0xff,0xfd,0xef,0xfa,0x00,
-0x0d,0xfb,0x10,0x06,0xff,0x50,0x3f,0x10,0x03,0x80,0x3f,0xe0,0x00,0x00,0x7f,0xb0,
-0x1f,0xf2,0x92,0x02,0xf0,0x09,0x08,0xfd,0x40,0x18,0xfe,0x10,0x00,0x7f,0xff,0xff,
-0xc2,0x00,0x01,0xbf,0xfd,0xef,0xe5,0x00,0x0c,0xfa,0x00,0x05,0xff,0x40,0x61,0x00,
-0x44,0x6f,0xd0,0x9f,0x90,0x2e,0x03,0x02,0xe7,0x00,0xf0,0x04,0x5f,0xf0,0x2f,0xf9,
-0x00,0x03,0xef,0x90,0x05,0xff,0xfd,0xef,0xfc,0x00,0x00,0x2a,0xef,0xfc,0x60,0x06,
-0x00,0xf0,0x0b,0xe9,0x10,0x00,0x5f,0xff,0xdf,0xfe,0x20,0x1f,0xf9,0x00,0x1b,0xfd,
-0x07,0xfc,0x00,0x00,0x0e,0xf5,0xbf,0x70,0x00,0x00,0x8f,0x9c,0xf5,0x0d,0x02,0x00,
-0x0b,0x00,0xf0,0x09,0x4f,0xe8,0xfc,0x00,0x00,0x09,0xfe,0x2f,0xf8,0x00,0x08,0xff,
-0xd0,0x6f,0xff,0xdf,0xfb,0xfc,0x00,0x4b,0xff,0xb3,0x6f,0xa0,0xac,0x00,0x11,0xf7,
-0xf0,0x00,0x01,0xeb,0x05,0xf9,0x0a,0xb0,0x00,0x00,0x03,0xcf,0xf2,0x00,0x05,0xdf,
-0xff,0xd3,0x00,0x00,0x6f,0xeb,0x60,0x00,0x00,0x2e,0xd1,0x5f,0xf3,0x08,0x70,0x00,
-0x01,0x00,0xca,0x07,0x60,0x5f,0xf3,0x2e,0xd1,0x06,0xfa,0x0a,0xff,0x02,0x84,0x1a,
-0x00,0xc2,0x05,0xea,0x06,0xfb,0x06,0xfa,0x0a,0xf6,0x1f,0xe1,0x3d,0x40,0x12,0x00,
-0xf0,0x06,0x18,0x50,0x00,0x00,0x02,0x9f,0xf7,0x00,0x00,0x2a,0xff,0xfc,0x30,0x04,
-0xbf,0xff,0x92,0x00,0x1c,0xff,0xd6,0xde,0x01,0x20,0xa1,0x00,0xbb,0x06,0x10,0xf9,
-0xe5,0x01,0x30,0x7e,0xff,0xc6,0x60,0x01,0x20,0xdf,0xff,0x34,0x00,0x21,0x5c,0xf7,
-0x54,0x01,0x73,0x40,0x3e,0xee,0xee,0xee,0xee,0x83,0xf1,0x04,0x0a,0x01,0x00,0x10,
-0x03,0x1b,0x00,0x21,0xe8,0x3f,0xdb,0x07,0x01,0x79,0x04,0x41,0x06,0xff,0xa3,0x00,
-0x62,0x00,0x11,0x50,0x80,0x07,0x10,0xd6,0x24,0x00,0x30,0xaf,0xfe,0x50,0x9d,0x04,
-0x80,0xf9,0x00,0x00,0x28,0xef,0xfb,0x30,0x05,0x7a,0x00,0x70,0x4e,0xff,0xe7,0x10,
-0x00,0x06,0xfd,0xed,0x01,0x33,0x44,0x00,0x00,0xb1,0x04,0xf0,0x09,0x40,0x00,0x2e,
-0xff,0xff,0xff,0x60,0x0b,0xfc,0x20,0x09,0xff,0x10,0xff,0x30,0x00,0x0e,0xf4,0x02,
-0x20,0x00,0x00,0xdf,0x50,0xdf,0x04,0x10,0xf3,0x10,0x02,0x10,0xfc,0xa9,0x00,0x00,
-0x1f,0x01,0x10,0x07,0xa0,0x00,0x11,0x03,0xa5,0x00,0x25,0x9f,0xa0,0xda,0x02,0x16,
-0x12,0x98,0x00,0x25,0x26,0x10,0x1a,0x04,0x21,0x9f,0x50,0x12,0x00,0x41,0x38,0xcf,
-0xfe,0xc8,0x18,0x06,0x61,0x1a,0xff,0xc9,0x9a,0xdf,0xf9,0x4a,0x04,0xa1,0x81,0x00,
-0x00,0x01,0x9f,0xc0,0x00,0x00,0x1e,0xf3,0x32,0x01,0x42,0xf9,0x00,0x00,0xaf,0x2c,
-0x01,0x20,0x8f,0x20,0x5a,0x05,0xf0,0x37,0x4c,0xfd,0x91,0x00,0x0e,0x90,0x0a,0xf1,
-0x00,0x06,0xfd,0x8a,0xfd,0x00,0x09,0xe0,0x0f,0xc0,0x00,0x2f,0xc0,0x00,0xed,0x00,
-0x05,0xf2,0x4f,0x70,0x00,0xbf,0x20,0x00,0xfb,0x00,0x03,0xf4,0x7f,0x40,0x01,0xfc,
-0x00,0x01,0xfa,0x00,0x02,0xf5,0x8f,0x20,0x04,0xf8,0x00,0x03,0xf8,0x00,0x02,0xf5,
-0x9f,0x10,0x07,0xf6,0x00,0x04,0xf7,0x00,0x03,0xf4,0x9f,0x20,0x08,0xf5,0x07,0x09,
-0xf0,0x10,0x05,0xf2,0x8f,0x20,0x08,0xf6,0x00,0x0a,0xf5,0x00,0x0b,0xe0,0x6f,0x50,
-0x05,0xfc,0x00,0x5f,0xf7,0x00,0x3f,0x70,0x2f,0x90,0x00,0xef,0xdc,0xf7,0xff,0x78,
-0xfc,0xe5,0x08,0x60,0x2c,0xfd,0x50,0x3c,0xfe,0x80,0xc9,0x06,0x04,0x01,0x00,0x24,
-0xcf,0x60,0x0a,0x00,0x11,0x1d,0x86,0x03,0x01,0x0d,0x03,0x52,0xbf,0xfb,0x88,0x9b,
-0xfb,0x7b,0x01,0x52,0x9d,0xff,0xec,0x82,0x00,0x71,0x06,0x12,0xf0,0x08,0x00,0x32,
-0xbf,0xf6,0x00,0x32,0x03,0x00,0x2f,0x05,0x00,0x7d,0x06,0x21,0xef,0x20,0x1c,0x03,
-0x31,0xf3,0x9f,0x80,0x40,0x05,0x10,0xe0,0xef,0x02,0x00,0xeb,0x02,0x22,0x0d,0xf4,
-0x69,0x02,0x32,0x08,0xfb,0x00,0x49,0x08,0x22,0xff,0x10,0x45,0x01,0x00,0x3a,0x03,
-0x00,0xee,0x05,0x41,0x7f,0xd0,0x00,0x00,0x42,0x05,0xe0,0xf3,0x00,0x00,0xef,0xed,
-0xdd,0xdd,0xdf,0xf9,0x00,0x05,0xff,0x00,0x00,0x05,0x00,0x21,0x0b,0xf9,0x7c,0x03,
-0x31,0x60,0x1f,0xf3,0x2a,0x01,0x31,0xc0,0x7f,0xd0,0xb2,0x03,0xe0,0xf2,0x0f,0xff,
-0xff,0xff,0xc8,0x10,0x00,0xff,0xee,0xee,0xff,0xfe,0x20,0xb0,0x01,0x40,0x4e,0xfb,
-0x00,0xff,0x3d,0x05,0x00,0xa1,0x09,0x00,0x62,0x00,0x06,0x0d,0x00,0xa1,0x4e,0xf7,
-0x00,0xff,0xdd,0xdd,0xef,0xf7,0x00,0x0f,0x14,0x0a,0x00,0x27,0x00,0x51,0x14,0xcf,
-0xb0,0x0f,0xf3,0xc7,0x08,0x00,0x27,0x00,0x21,0x0c,0xf8,0xf1,0x01,0x20,0xbf,0x80,
-0x0d,0x00,0x20,0x1f,0xf6,0x0d,0x00,0x90,0x2c,0xff,0x10,0xff,0xed,0xdd,0xef,0xff,
-0x40,0x34,0x00,0x10,0xd9,0xd8,0x00,0xf0,0x07,0x6c,0xef,0xea,0x40,0x00,0x00,0x2d,
-0xff,0xfe,0xff,0xf9,0x00,0x01,0xef,0xc3,0x00,0x07,0xff,0x70,0x0a,0xfc,0x00,0xd6,
-0x09,0x20,0x1f,0xf4,0x33,0x02,0x30,0xf5,0x5f,0xe0,0x22,0x03,0x20,0x94,0x7f,0x4b,
-0x07,0x03,0x29,0x02,0x0c,0x07,0x00,0x22,0x8f,0xb0,0x41,0x01,0x01,0x65,0x0a,0x31,
-0x83,0x1f,0xf3,0x38,0x00,0x12,0x0b,0x46,0x00,0xb0,0x01,0xff,0xb2,0x00,0x06,0xff,
-0x70,0x00,0x3e,0xff,0xee,0x48,0x0a,0x50,0x01,0x8d,0xff,0xea,0x30,0xb2,0x00,0xa0,
-0xec,0x81,0x00,0x00,0x0f,0xfe,0xee,0xef,0xff,0x60,0x97,0x02,0x31,0x01,0x8f,0xf7,
-0x9e,0x02,0x51,0x05,0xff,0x30,0x0f,0xf3,0x37,0x06,0x01,0x07,0x00,0x10,0x3f,0xe9,
-0x00,0x00,0x01,0x05,0x01,0x07,0x00,0x22,0x0e,0xf4,0x07,0x00,0x12,0xf5,0x15,0x00,
-0x18,0xf4,0x1c,0x00,0x27,0x4f,0xf0,0x38,0x00,0x02,0x46,0x00,0x01,0x54,0x00,0x21,
-0xfd,0xdd,0x62,0x00,0x03,0x70,0x00,0x10,0xff,0xbc,0x08,0x71,0x0f,0xfe,0xee,0xee,
-0xee,0xe9,0x0f,0x79,0x01,0x0f,0x06,0x00,0x06,0x51,0xfe,0xdd,0xdd,0xdd,0x80,0x30,
-0x00,0x1f,0xa0,0x2a,0x00,0x0c,0x06,0x30,0x00,0x11,0xdb,0x30,0x00,0x11,0xfd,0x06,
-0x00,0x11,0xf8,0x66,0x00,0x1f,0xe7,0x36,0x00,0x10,0x11,0x50,0x30,0x00,0x1f,0x60,
-0x66,0x00,0x12,0x07,0x06,0x00,0xf1,0x08,0x00,0x01,0x7c,0xef,0xeb,0x50,0x00,0x00,
-0x3e,0xff,0xfe,0xff,0xfb,0x00,0x02,0xff,0xc3,0x00,0x06,0xff,0xa0,0x0a,0xfc,0xe1,
-0x07,0x21,0x1f,0xf4,0xce,0x03,0x03,0xd1,0x02,0x28,0x7f,0xc0,0xa5,0x01,0xe1,0x9f,
-0xb0,0x00,0x08,0xdd,0xdd,0xd7,0x8f,0xb0,0x00,0x09,0xff,0xff,0xf9,0x1c,0x00,0x41,
-0x0a,0xf9,0x4f,0xf0,0x07,0x00,0x21,0x0f,0xf6,0x07,0x00,0x31,0x08,0xfe,0x10,0xf2,
-0x05,0xb0,0xdf,0xe4,0x00,0x01,0x7f,0xf7,0x00,0x1c,0xff,0xfd,0xef,0x93,0x07,0x42,
-0x5b,0xef,0xed,0x93,0x7d,0x00,0x02,0x87,0x02,0x00,0xe4,0x02,0x0f,0x0f,0x00,0x14,
-0x71,0xed,0xdd,0xdd,0xdd,0xdf,0xf1,0x0f,0xae,0x06,0x0f,0x3c,0x00,0x1d,0x0a,0x0f,
-0x00,0x3f,0xdf,0x6d,0xf6,0x03,0x00,0x03,0x11,0x60,0xd9,0x06,0x1f,0xf6,0x06,0x00,
-0x2f,0x20,0x4e,0xd0,0xbe,0x02,0x20,0x3f,0xf2,0x49,0x01,0xf2,0x03,0x0d,0xfc,0x20,
-0x03,0xef,0xc0,0x03,0xef,0xfe,0xef,0xfe,0x20,0x00,0x19,0xdf,0xfd,0x81,0x00,0x66,
-0x02,0x11,0xe2,0x94,0x03,0x21,0x8f,0xf3,0x0f,0x00,0x30,0x7f,0xf4,0x00,0x0f,0x00,
-0x21,0x5f,0xf6,0x9b,0x01,0x30,0x4f,0xf7,0x00,0x0f,0x00,0x21,0x3f,0xf9,0xaa,0x01,
-0x11,0x2e,0x66,0x04,0x32,0xff,0x5d,0xff,0xef,0x01,0x02,0xfb,0x05,0x40,0xff,0xfd,
-0x6f,0xf5,0x0f,0x00,0x40,0xfd,0x10,0x9f,0xf2,0x0f,0x00,0x41,0x40,0x00,0xcf,0xd0,
-0x3c,0x00,0x31,0x02,0xef,0xa0,0x4b,0x00,0x12,0x05,0x15,0x03,0x01,0xa6,0x05,0x01,
-0xc9,0x03,0x12,0xfd,0x78,0x00,0x41,0x1e,0xfa,0x00,0x0f,0xe7,0x07,0x0f,0x06,0x00,
-0x42,0x00,0x8d,0x02,0x11,0xd4,0xa4,0x01,0x22,0xf5,0x0f,0x2e,0x08,0x32,0x2f,0xff,
-0x0f,0xf5,0x0d,0x51,0x8f,0xff,0x0f,0xff,0xe0,0xb1,0x04,0x40,0xff,0x0f,0xfe,0xf4,
-0xc2,0x04,0x60,0xfe,0xff,0x0f,0xf8,0xfb,0x00,0x64,0x04,0x30,0xff,0x0f,0xf2,0x2e,
-0x00,0x32,0x2f,0xf3,0xff,0xf5,0x0a,0xf0,0x16,0x9f,0x92,0xff,0x0f,0xf2,0x4f,0xe0,
-0x00,0x00,0xef,0x33,0xff,0x0f,0xf2,0x0d,0xf4,0x00,0x05,0xfc,0x03,0xff,0x0f,0xf3,
-0x07,0xfb,0x00,0x0c,0xf6,0x04,0xff,0x0f,0xf3,0x01,0xff,0x10,0x2f,0xe0,0x09,0x00,
-0x51,0x00,0xaf,0x80,0x9f,0x90,0x09,0x00,0x41,0x3f,0xe0,0xff,0x20,0x09,0x00,0x41,
-0x0d,0xfb,0xfc,0x00,0x09,0x00,0x32,0x06,0xff,0xf5,0x09,0x00,0x33,0x00,0xff,0xe0,
-0x09,0x00,0x20,0x9f,0x80,0x09,0x00,0x13,0xf9,0x16,0x02,0x12,0xf3,0x16,0x02,0x22,
+0x05,0xf8,0x01,0x09,0x01,0x00,0x2f,0xf9,0x00,0x01,0x00,0x05,0x13,0xec,0x08,0x00,
+0x17,0xea,0x14,0x00,0xbf,0xf7,0xf5,0x00,0xfc,0xf5,0x00,0xf1,0x00,0x00,0x00,0x02,
+0x34,0x00,0x02,0x4f,0x04,0x03,0x00,0x04,0x18,0x00,0x01,0x2f,0xe0,0x00,0x01,0x00,
+0x17,0x1f,0xd6,0x20,0x00,0x0c,0x03,0x90,0x00,0xb1,0xf5,0x00,0xfe,0x00,0x00,0xe8,
+0xfd,0xf0,0xf3,0x00,0xee,0x11,0x00,0x00,0x0f,0x00,0x5e,0xfd,0xfe,0xf7,0xfa,0x00,
+0x9a,0x00,0x6f,0xfb,0x00,0xfc,0x00,0x00,0xf6,0x4e,0x00,0x03,0x1c,0xfb,0x0a,0x00,
+0x19,0xfe,0x1f,0x00,0x14,0xfd,0x09,0x00,0x53,0xed,0x00,0x00,0x00,0xfc,0x4c,0x00,
+0x3b,0xfc,0xf8,0xfc,0x46,0x00,0x1c,0xfa,0x08,0x01,0x04,0x09,0x00,0x21,0xfc,0xfd,
+0x36,0x00,0x28,0xfd,0xfb,0x32,0x00,0x11,0xd4,0x12,0x01,0x15,0xcf,0x26,0x00,0xac,
+0xfa,0xfc,0x00,0x00,0xfc,0xfb,0x00,0x00,0xfc,0xfc,0x9e,0x00,0x13,0x03,0x98,0x00,
+0x2f,0x03,0xfb,0x12,0x01,0x09,0x1f,0xfc,0x55,0x01,0x0f,0x1b,0xf4,0xa5,0x00,0x11,
+0xfb,0x71,0x00,0x43,0x00,0xfc,0xf9,0xf4,0x11,0x00,0x14,0xc1,0xba,0x00,0x96,0xf4,
+0x00,0x00,0xcc,0xf6,0xdf,0xe5,0x00,0xd3,0x2d,0x00,0x37,0xf8,0xe7,0xef,0x3b,0x00,
+0x73,0xc3,0x00,0x00,0x00,0xe6,0x00,0xdb,0xf8,0x00,0x41,0xfb,0x00,0xfe,0xfe,0x35,
+0x01,0x11,0x03,0xad,0x00,0x04,0x8d,0x01,0x06,0x3c,0x00,0x3e,0x00,0xfb,0xfc,0x65,
+0x02,0x0c,0x01,0x00,0x10,0xf1,0xc4,0x00,0x1e,0xf7,0x19,0x00,0x02,0x3a,0x00,0xb1,
+0xd7,0xd5,0x00,0x00,0xf1,0xfb,0xd3,0xfd,0x03,0x00,0x03,0x66,0x00,0xf1,0x02,0xeb,
+0xed,0x00,0xec,0xed,0xf2,0xea,0x00,0xee,0xf3,0xf5,0xf2,0xf5,0x00,0xde,0xeb,0xee,
+0x72,0x01,0x66,0xd6,0xf9,0x00,0x00,0xf2,0xfe,0x3b,0x01,0xa6,0xf7,0xf8,0x00,0x00,
+0xf7,0xfa,0x00,0x00,0xfb,0xfe,0x91,0x01,0x40,0x03,0x00,0xe9,0xf5,0x94,0x00,0x02,
+0x5a,0x01,0x00,0xc7,0x02,0x23,0xfa,0xfa,0x80,0x01,0x04,0x6f,0x01,0x03,0xe9,0x02,
+0x04,0x11,0x02,0x15,0x03,0x1d,0x02,0x10,0xfc,0x30,0x01,0x16,0xfa,0xf3,0x01,0xf5,
+0x14,0x04,0xf7,0xd8,0xf6,0x00,0x00,0xee,0xfb,0xee,0xfd,0x03,0xee,0x03,0x03,0x02,
+0x03,0x00,0x03,0xf2,0xf4,0xfc,0xf9,0xf4,0xf9,0xf5,0xfc,0xf9,0xfc,0x00,0xfc,0xfa,
+0x04,0xee,0xf4,0xf4,0x2d,0x00,0x2a,0x02,0xfb,0xaf,0x01,0x01,0x4c,0x00,0x1e,0xfb,
+0xd5,0x01,0x17,0xfd,0x72,0x02,0x0c,0x01,0x00,0x1f,0xf3,0x41,0x01,0x09,0x05,0x36,
+0x00,0x0f,0x29,0x02,0x0a,0x4e,0xfe,0x00,0xfd,0xfd,0xe5,0x02,0x0f,0x55,0x00,0x0f,
+0x0f,0x4c,0x00,0x03,0x05,0xa4,0x02,0x1e,0x04,0xb7,0x02,0x1c,0xfc,0x0d,0x03,0x2f,
+0xed,0x00,0x01,0x00,0x26,0x0d,0xdf,0x02,0x1f,0xe7,0xb5,0x00,0x0b,0x25,0xfc,0xfd,
+0x3c,0x03,0x1c,0xe9,0x4f,0x02,0x11,0xfc,0x9b,0x00,0x10,0x09,0x49,0x02,0x0f,0x75,
+0x00,0x19,0x17,0x03,0x10,0x05,0x05,0x69,0x00,0x3e,0xfe,0x02,0x00,0x22,0x01,0x1f,
+0xe9,0xe4,0x00,0x26,0x1f,0xfc,0x91,0x01,0x12,0x1f,0xfd,0x41,0x00,0x20,0x12,0x01,
+0x14,0x05,0x21,0x02,0x03,0x8d,0x01,0x2d,0x04,0x05,0x21,0x00,0xf1,0x0c,0x06,0x07,
+0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,
+0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,0xfe,0x0e,0x1a,0x1b,0x1c,
+0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,
+0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x00,0x00,0x4e,0x00,0x01,0x01,0x00,0xd0,
+0x00,0x08,0x0a,0x0a,0x0a,0x0a,0x0c,0x0c,0x0c,0x0c,0x09,0x0c,0x09,0x01,0x00,0xa1,
+0x00,0x00,0x0d,0x0d,0x0d,0x0d,0x17,0x00,0x00,0x1a,0x01,0x00,0x61,0x00,0x1c,0x1d,
+0x1d,0x1d,0x1d,0x31,0x00,0x20,0x1f,0x21,0x01,0x00,0x02,0x3d,0x00,0x50,0x24,0x1b,
+0x24,0x06,0x1a,0x02,0x00,0x22,0x08,0x1c,0x02,0x00,0x64,0x09,0x00,0x09,0x00,0x0a,
+0x1d,0x02,0x00,0x04,0x64,0x00,0x55,0x0c,0x1f,0x00,0x00,0x0c,0x02,0x00,0x83,0x00,
+0x00,0x0d,0x00,0x0e,0x00,0x00,0x0f,0x02,0x00,0x00,0x1f,0x00,0x00,0x02,0x00,0x80,
+0x1f,0x00,0x00,0x09,0x21,0x09,0x21,0x09,0x5b,0x00,0x11,0x22,0x02,0x00,0x03,0x01,
+0x00,0x11,0x13,0x02,0x00,0x17,0x0d,0x02,0x00,0x70,0x15,0x00,0x17,0x24,0x17,0x18,
+0x27,0x02,0x00,0x04,0x30,0x01,0x20,0x03,0x02,0x2b,0x01,0x4a,0x06,0x07,0x06,0x08,
+0xe0,0x00,0x00,0x90,0x00,0x60,0x00,0x0b,0x00,0x00,0x00,0x0b,0x83,0x00,0x01,0x08,
+0x00,0xf1,0x08,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,
+0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xfd,0x02,0x19,0x19,
+0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x30,
+0x01,0x11,0x0a,0x01,0x00,0x26,0x24,0x0b,0x12,0x00,0x10,0x0b,0x01,0x00,0xa1,0x00,
+0x0b,0x0f,0x0f,0x0f,0x0f,0x13,0x00,0x00,0x16,0x01,0x00,0x20,0x25,0x17,0x01,0x00,
+0x02,0x53,0x00,0x02,0x41,0x01,0xa0,0x26,0x1e,0x1e,0x1e,0x1e,0x1f,0x00,0x1f,0x0a,
+0x16,0x02,0x00,0x22,0x0b,0x17,0x02,0x00,0x10,0x00,0x24,0x00,0x14,0x17,0x02,0x00,
+0x05,0x16,0x00,0x0b,0x01,0x00,0x1b,0x0c,0x10,0x00,0x10,0x19,0x02,0x00,0x51,0x19,
+0x00,0x00,0x0b,0x1a,0x02,0x00,0x03,0x30,0x00,0x22,0x0d,0x1c,0x02,0x00,0x10,0x0e,
+0x5e,0x01,0x36,0x00,0x0f,0x1e,0x02,0x00,0xc0,0x11,0x00,0x13,0x1f,0x13,0x14,0x22,
+0x14,0x22,0x14,0x22,0x00,0x21,0x0f,0xf3,0x02,0x00,0x15,0xf2,0x02,0x00,0x21,0xf1,
+0x0e,0x02,0x00,0xf0,0x32,0x04,0x50,0x00,0x00,0x04,0x60,0x1f,0xf5,0x0c,0xe3,0x6f,
+0x43,0xf6,0x6f,0x33,0xf6,0x6f,0x23,0xf5,0x6f,0x13,0xf4,0x6f,0x03,0xf2,0x5c,0x03,
+0xd1,0x00,0x00,0x08,0xf2,0x00,0xbf,0x00,0x00,0x00,0x0b,0xf0,0x00,0xec,0x00,0x00,
+0x00,0x0e,0xc0,0x02,0xf8,0x00,0x00,0x00,0x1f,0x90,0x05,0xf5,0x00,0x00,0x00,0x4f,
+0x60,0x08,0xf2,0x00,0x0b,0xff,0x01,0x00,0xf1,0x16,0xf7,0x07,0xaa,0xef,0xaa,0xaf,
+0xea,0xa4,0x00,0x00,0xec,0x00,0x1f,0x90,0x00,0x00,0x01,0xf9,0x00,0x5f,0x50,0x00,
+0x00,0x05,0xf5,0x00,0x8f,0x20,0x00,0x6a,0xac,0xfb,0xaa,0xef,0xaa,0x50,0x9f,0x2a,
+0x00,0x1f,0x90,0x45,0x00,0x01,0xf0,0x04,0x00,0x00,0x7f,0x30,0x0b,0xf0,0x00,0x00,
+0x00,0xaf,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,0x06,0x60,0x06,0x00,0x25,0x0d,0xe0,
+0x06,0x00,0xf0,0x16,0x06,0xbf,0xfb,0x50,0x00,0x00,0xbf,0xff,0xff,0xf9,0x00,0x08,
+0xfe,0x51,0x18,0xff,0x50,0x0e,0xf6,0x00,0x00,0xaf,0xc0,0x0f,0xf2,0x00,0x00,0x4f,
+0xf0,0x0f,0xf3,0x00,0x00,0x1a,0xa0,0x0b,0xfc,0x2e,0x00,0x30,0x03,0xff,0xd6,0x07,
+0x00,0xa0,0x4e,0xff,0xf9,0x20,0x00,0x00,0x01,0x7d,0xff,0xf8,0x0e,0x00,0x30,0x3b,
+0xff,0x70,0x07,0x00,0xf0,0x10,0x9f,0xe0,0x58,0x40,0x00,0x00,0x1f,0xf2,0x9f,0x90,
+0x00,0x00,0x0f,0xf2,0x6f,0xe1,0x00,0x00,0x6f,0xf0,0x0e,0xfd,0x52,0x37,0xff,0x90,
+0x03,0xef,0xff,0xff,0xfa,0x66,0x00,0x20,0xe8,0x40,0x9b,0x00,0x23,0xa0,0x00,0x06,
+0x00,0x40,0x04,0xcf,0xd8,0x00,0x01,0x00,0x31,0x3f,0xd7,0x9f,0x14,0x00,0xf0,0x1c,
+0xaf,0x10,0x09,0xf1,0x00,0x1e,0x40,0x00,0xcd,0x00,0x06,0xf3,0x00,0xbe,0x00,0x00,
+0xae,0x00,0x07,0xf2,0x06,0xf4,0x00,0x00,0x6f,0x92,0x4e,0xd0,0x1e,0xa0,0x00,0x00,
+0x08,0xff,0xfd,0x20,0xae,0x10,0x00,0x00,0x00,0x13,0x20,0xde,0x00,0x00,0x01,0x00,
+0x41,0x1e,0xb0,0x01,0x10,0x3b,0x00,0xc0,0x12,0xcf,0xfc,0x30,0x00,0x00,0x04,0xf6,
+0x0d,0xe7,0x6e,0xe0,0x4b,0x01,0x20,0x4f,0x50,0x23,0x00,0xf0,0x0f,0x9f,0x20,0x6f,
+0x20,0x01,0xf8,0x00,0x03,0xf7,0x00,0x6f,0x20,0x01,0xf7,0x00,0x0c,0xd0,0x00,0x4f,
+0x60,0x05,0xf5,0x00,0x01,0x20,0x00,0x0c,0xf8,0x8f,0xd0,0x39,0x00,0x90,0x01,0x9e,
+0xfb,0x10,0x00,0x07,0xdf,0xea,0x20,0x45,0x00,0xf0,0x10,0xfd,0xef,0xf3,0x00,0x00,
+0x02,0xff,0x50,0x09,0xfb,0x00,0x00,0x06,0xfd,0x00,0x02,0xfd,0x00,0x00,0x05,0xfd,
+0x00,0x05,0xfb,0x00,0x00,0x01,0xff,0x40,0x4e,0xf3,0x4a,0x01,0xa0,0xe9,0xff,0x50,
+0x00,0x00,0x00,0x0c,0xff,0xd2,0x00,0x0e,0x00,0xf0,0xa4,0xff,0xb0,0x00,0x00,0x00,
+0x09,0xff,0x5e,0xf9,0x00,0x2e,0xc0,0x5f,0xf3,0x03,0xff,0x60,0x4f,0xb0,0xbf,0x90,
+0x00,0x5f,0xf4,0x8f,0x80,0xcf,0x60,0x00,0x08,0xff,0xef,0x30,0xaf,0x90,0x00,0x00,
+0xaf,0xfb,0x00,0x4f,0xf4,0x00,0x00,0x9f,0xfc,0x00,0x08,0xff,0xb9,0xae,0xfe,0xef,
+0x90,0x00,0x3a,0xef,0xfc,0x71,0x3f,0xf6,0xcf,0xcf,0xce,0xcd,0xcc,0x87,0x00,0x00,
+0x00,0x10,0x00,0x01,0xc9,0x00,0x00,0xcf,0x40,0x00,0x9f,0x60,0x00,0x3f,0xb0,0x00,
+0x0c,0xf3,0x00,0x03,0xfd,0x00,0x00,0x9f,0x80,0x00,0x0d,0xf3,0x00,0x01,0xff,0x00,
+0x00,0x4f,0xe0,0x00,0x05,0xfc,0x00,0x00,0x6f,0xb0,0x00,0x06,0xfb,0x00,0x00,0x5f,
+0xc0,0x00,0x04,0xfd,0x00,0x00,0x1f,0xf0,0x00,0x00,0xef,0x20,0x00,0x0a,0xf6,0x00,
+0x00,0x4f,0xb0,0x00,0x00,0xdf,0x20,0x00,0x05,0xfa,0x00,0x00,0x0b,0xf4,0x00,0x00,
+0x1e,0xe2,0x00,0x00,0x2e,0x90,0x00,0x00,0x12,0x01,0x00,0x00,0x06,0xe3,0x00,0x00,
+0x2e,0xe2,0x00,0x00,0x3f,0xc0,0x00,0x00,0x8f,0x60,0x00,0x01,0xfe,0x00,0x32,0x00,
+0x00,0x44,0x00,0xf1,0x05,0x00,0xff,0x00,0x00,0x0d,0xf4,0x00,0x00,0xbf,0x70,0x00,
+0x09,0xf8,0x00,0x00,0x8f,0x90,0x00,0x08,0xf9,0x75,0x00,0x21,0x0a,0xf7,0x8c,0x00,
+0x21,0x0f,0xf1,0x86,0x00,0xf0,0x06,0x8f,0x70,0x00,0x0e,0xf1,0x00,0x06,0xf8,0x00,
+0x01,0xee,0x00,0x00,0xcf,0x30,0x00,0x6f,0x40,0x00,0x01,0x20,0xfc,0x00,0x21,0xbf,
+0x10,0x52,0x02,0x02,0x05,0x00,0xf0,0x09,0x5f,0xa4,0x9f,0x17,0xda,0x5d,0xff,0xff,
+0xff,0xfb,0x00,0x29,0xff,0xc5,0x10,0x00,0x0c,0xfe,0xe1,0x00,0x00,0x8f,0x85,0xfb,
+0x43,0x00,0xb1,0xaf,0x60,0x00,0x83,0x00,0x1b,0x10,0x00,0x00,0x02,0x86,0xb3,0x01,
+0x11,0x5f,0x78,0x01,0x2c,0x05,0xfd,0x0d,0x00,0x71,0x11,0x11,0x5f,0xd1,0x11,0x10,
+0x1f,0xc8,0x02,0x11,0x91,0x06,0x00,0x1e,0xf9,0x27,0x00,0x0b,0x0d,0x00,0xf0,0x0a,
+0x08,0xf9,0x08,0xf9,0x09,0xf8,0x0d,0xf3,0x4f,0xc0,0x3c,0x20,0x7c,0xcc,0xcc,0x19,
+0xff,0xff,0xf2,0x07,0x70,0x4f,0xf5,0x1d,0xe2,0xda,0x02,0x10,0xf0,0x5b,0x02,0x10,
+0x90,0x9a,0x02,0x50,0x30,0x00,0x00,0x00,0xfd,0xe8,0x02,0x10,0xf7,0xbc,0x01,0x50,
+0xf1,0x00,0x00,0x00,0x2f,0xb9,0x01,0x10,0x8f,0x8f,0x02,0x10,0xee,0x4c,0x00,0x10,
+0xf8,0x86,0x03,0x10,0xf2,0x97,0x02,0x10,0xc0,0xd7,0x01,0x00,0x20,0x03,0x10,0xdf,
+0xef,0x02,0x50,0xf9,0x00,0x00,0x00,0x0a,0xf8,0x01,0x10,0x0f,0x74,0x00,0x10,0x6f,
+0xe8,0x02,0x11,0x58,0x70,0x02,0xf0,0x0a,0x19,0xdf,0xeb,0x50,0x00,0x02,0xef,0xfd,
+0xef,0xf8,0x00,0x0c,0xfb,0x10,0x05,0xff,0x30,0x2f,0xf1,0x00,0x00,0x9f,0xa0,0x6f,
+0xb0,0xae,0x01,0x20,0x9f,0x90,0x9f,0x01,0x80,0xaf,0x80,0x00,0x00,0x1f,0xf1,0xaf,
+0x80,0x0e,0x03,0x07,0x06,0x00,0x12,0xf1,0x06,0x00,0xc1,0x8f,0x90,0x00,0x00,0x2f,
+0xf0,0x6f,0xc0,0x00,0x00,0x4f,0xd0,0x3c,0x00,0x30,0x90,0x0b,0xfc,0x48,0x00,0x50,
+0x02,0xef,0xfc,0xef,0xf8,0x60,0x00,0x10,0xfc,0x68,0x02,0xff,0x05,0x5b,0x80,0x39,
+0xff,0xf8,0xdf,0xff,0xef,0x8f,0xb5,0x0a,0xf8,0x10,0x00,0xaf,0x80,0x00,0x0a,0xf8,
+0x00,0x07,0x00,0x13,0x00,0x64,0x02,0xf0,0x0c,0x50,0x00,0x06,0xff,0xfd,0xff,0xfa,
+0x00,0x3f,0xf7,0x00,0x06,0xff,0x50,0xaf,0xa0,0x00,0x00,0xaf,0xb0,0xdf,0x50,0x00,
+0x00,0x6f,0xc0,0x23,0xe6,0x00,0x01,0x74,0x03,0x20,0xcf,0x40,0x18,0x01,0x01,0xdd,
+0x03,0x10,0x4f,0x01,0x01,0x20,0x02,0xef,0x78,0x00,0x20,0x2e,0xf7,0x1b,0x03,0x20,
+0xdf,0x80,0x47,0x01,0x11,0xf9,0x27,0x00,0x10,0xa0,0x22,0x01,0x11,0xfb,0xf5,0x02,
+0x62,0xfc,0xcc,0xcc,0xcc,0xc7,0x9f,0xa1,0x01,0xf0,0x01,0x3a,0xef,0xeb,0x40,0x00,
+0x7f,0xff,0xde,0xff,0x80,0x3f,0xf6,0x00,0x06,0xff,0x39,0x83,0x02,0x61,0xf8,0x57,
+0x30,0x00,0x00,0x8f,0x31,0x00,0x10,0xf7,0xa4,0x01,0xc0,0xfe,0x00,0x00,0x5c,0xdf,
+0xfc,0x20,0x00,0x06,0xff,0xff,0xb2,0x62,0x00,0x21,0xaf,0xe2,0x36,0x02,0x11,0xa0,
+0xc5,0x01,0xf0,0x09,0x9b,0x30,0x00,0x00,0x5f,0xeb,0xf9,0x00,0x00,0x08,0xfb,0x5f,
+0xf6,0x00,0x05,0xff,0x50,0x9f,0xfe,0xde,0xff,0x80,0x00,0x4b,0x58,0x00,0x10,0x00,
+0x78,0x03,0x11,0x90,0x6d,0x02,0x11,0xf9,0xf9,0x01,0x01,0x0d,0x00,0x21,0x1e,0xfb,
+0x96,0x01,0x10,0xf6,0x66,0x01,0xa0,0x05,0xfc,0x09,0xf9,0x00,0x00,0x01,0xef,0x20,
+0x9f,0x68,0x03,0x30,0x70,0x09,0xf9,0x4f,0x01,0x91,0x00,0x9f,0x90,0x00,0x0e,0xf3,
+0x00,0x09,0xf9,0xd9,0x02,0xa1,0x9f,0x90,0x03,0xff,0xdc,0xcc,0xce,0xfe,0xcb,0x6f,
+0x54,0x02,0x10,0xf0,0xb1,0x03,0x01,0x4e,0x00,0x00,0x27,0x00,0x0a,0x0d,0x00,0x11,
+0xcf,0x20,0x00,0x11,0xdf,0x06,0x00,0x21,0xff,0x10,0x7e,0x00,0x10,0x00,0xb1,0x00,
+0x01,0x77,0x02,0x31,0x04,0xfb,0x00,0x2a,0x01,0xf1,0x01,0x9e,0xfe,0x91,0x00,0x07,
+0xff,0xff,0xff,0xfe,0x20,0x05,0xdb,0x30,0x15,0xef,0xd0,0xc1,0x04,0x20,0xf3,0x00,
+0x59,0x02,0x20,0xf7,0x00,0x99,0x00,0x30,0xf8,0x19,0x80,0x0c,0x00,0x00,0x37,0x05,
+0xf0,0x15,0x1f,0xf3,0x09,0xfd,0x20,0x01,0xcf,0xd0,0x00,0xcf,0xfd,0xdf,0xfe,0x20,
+0x00,0x07,0xcf,0xfd,0x91,0x00,0x00,0x00,0x18,0xce,0xe0,0x00,0x00,0x06,0xff,0xfe,
+0xc0,0x00,0x00,0x7f,0xf8,0x10,0x71,0x04,0x10,0x30,0x88,0x00,0x20,0xf6,0x00,0x04,
+0x06,0x70,0xf1,0x7b,0xcb,0x50,0x00,0x2f,0xed,0x31,0x05,0xe0,0x5f,0xff,0x71,0x06,
+0xff,0x70,0x6f,0xf4,0x00,0x00,0x7f,0xe0,0x7f,0xc0,0x5b,0x05,0x00,0x06,0x00,0x40,
+0x0e,0xf4,0x5f,0xe0,0xba,0x03,0x20,0x3f,0xf1,0x53,0x02,0xf2,0x09,0x0d,0xf8,0x00,
+0x00,0x6f,0xe0,0x05,0xff,0x50,0x03,0xef,0x70,0x00,0x9f,0xfe,0xdf,0xfb,0x00,0x00,
+0x05,0xcf,0xfc,0x60,0x00,0x47,0x03,0x71,0x71,0xcc,0xcc,0xcc,0xcc,0xcf,0xf4,0xba,
+0x05,0x02,0x3c,0x03,0x11,0xaf,0xfb,0x05,0x21,0x2f,0xe0,0xfa,0x00,0x12,0xf8,0x62,
+0x01,0x01,0xd1,0x02,0x21,0x8f,0xa0,0x7f,0x00,0x11,0xf2,0xe5,0x00,0x11,0xfb,0x2c,
+0x00,0x26,0xef,0x40,0x6e,0x03,0x21,0x0d,0xf6,0x04,0x01,0x21,0xfe,0x00,0x0d,0x02,
+0x11,0x70,0xf5,0x00,0x11,0xf1,0xef,0x00,0x02,0x3f,0x01,0x10,0x29,0x6e,0x02,0xd1,
+0x03,0xff,0xfd,0xef,0xfa,0x00,0x0d,0xfb,0x10,0x06,0xff,0x50,0x3f,0x10,0x03,0x80,
+0x3f,0xe0,0x00,0x00,0x7f,0xb0,0x1f,0xf2,0x92,0x02,0xf0,0x09,0x08,0xfd,0x40,0x18,
+0xfe,0x10,0x00,0x7f,0xff,0xff,0xc2,0x00,0x01,0xbf,0xfd,0xef,0xe5,0x00,0x0c,0xfa,
+0x00,0x05,0xff,0x40,0x61,0x00,0x44,0x6f,0xd0,0x9f,0x90,0x2e,0x03,0x02,0xe7,0x00,
+0xf0,0x04,0x5f,0xf0,0x2f,0xf9,0x00,0x03,0xef,0x90,0x05,0xff,0xfd,0xef,0xfc,0x00,
+0x00,0x2a,0xef,0xfc,0x60,0x06,0x00,0xf0,0x0b,0xe9,0x10,0x00,0x5f,0xff,0xdf,0xfe,
+0x20,0x1f,0xf9,0x00,0x1b,0xfd,0x07,0xfc,0x00,0x00,0x0e,0xf5,0xbf,0x70,0x00,0x00,
+0x8f,0x9c,0xf5,0x0d,0x02,0x00,0x0b,0x00,0xf0,0x09,0x4f,0xe8,0xfc,0x00,0x00,0x09,
+0xfe,0x2f,0xf8,0x00,0x08,0xff,0xd0,0x6f,0xff,0xdf,0xfb,0xfc,0x00,0x4b,0xff,0xb3,
+0x6f,0xa0,0xac,0x00,0x11,0xf7,0xf0,0x00,0x01,0xeb,0x05,0xf9,0x0a,0xb0,0x00,0x00,
+0x03,0xcf,0xf2,0x00,0x05,0xdf,0xff,0xd3,0x00,0x00,0x6f,0xeb,0x60,0x00,0x00,0x2e,
+0xd1,0x5f,0xf3,0x08,0x70,0x00,0x01,0x00,0xca,0x07,0x60,0x5f,0xf3,0x2e,0xd1,0x06,
+0xfa,0x0a,0xff,0x02,0x84,0x1a,0x00,0xc2,0x05,0xea,0x06,0xfb,0x06,0xfa,0x0a,0xf6,
+0x1f,0xe1,0x3d,0x40,0x12,0x00,0xf0,0x06,0x18,0x50,0x00,0x00,0x02,0x9f,0xf7,0x00,
+0x00,0x2a,0xff,0xfc,0x30,0x04,0xbf,0xff,0x92,0x00,0x1c,0xff,0xd6,0xde,0x01,0x20,
+0xa1,0x00,0xbb,0x06,0x10,0xf9,0xe5,0x01,0x30,0x7e,0xff,0xc6,0x60,0x01,0x20,0xdf,
+0xff,0x34,0x00,0x21,0x5c,0xf7,0x54,0x01,0x73,0x40,0x3e,0xee,0xee,0xee,0xee,0x83,
+0xf1,0x04,0x0a,0x01,0x00,0x10,0x03,0x1b,0x00,0x21,0xe8,0x3f,0xdb,0x07,0x01,0x79,
+0x04,0x41,0x06,0xff,0xa3,0x00,0x62,0x00,0x11,0x50,0x80,0x07,0x10,0xd6,0x24,0x00,
+0x30,0xaf,0xfe,0x50,0x9d,0x04,0x80,0xf9,0x00,0x00,0x28,0xef,0xfb,0x30,0x05,0x7a,
+0x00,0x70,0x4e,0xff,0xe7,0x10,0x00,0x06,0xfd,0xed,0x01,0x33,0x44,0x00,0x00,0xb1,
+0x04,0xf0,0x09,0x40,0x00,0x2e,0xff,0xff,0xff,0x60,0x0b,0xfc,0x20,0x09,0xff,0x10,
+0xff,0x30,0x00,0x0e,0xf4,0x02,0x20,0x00,0x00,0xdf,0x50,0xdf,0x04,0x10,0xf3,0x10,
+0x02,0x10,0xfc,0xa9,0x00,0x00,0x1f,0x01,0x10,0x07,0xa0,0x00,0x11,0x03,0xa5,0x00,
+0x25,0x9f,0xa0,0xda,0x02,0x16,0x12,0x98,0x00,0x25,0x26,0x10,0x1a,0x04,0x21,0x9f,
+0x50,0x12,0x00,0x41,0x38,0xcf,0xfe,0xc8,0x18,0x06,0x61,0x1a,0xff,0xc9,0x9a,0xdf,
+0xf9,0x4a,0x04,0xa1,0x81,0x00,0x00,0x01,0x9f,0xc0,0x00,0x00,0x1e,0xf3,0x32,0x01,
+0x42,0xf9,0x00,0x00,0xaf,0x2c,0x01,0x20,0x8f,0x20,0x5a,0x05,0xf0,0x37,0x4c,0xfd,
+0x91,0x00,0x0e,0x90,0x0a,0xf1,0x00,0x06,0xfd,0x8a,0xfd,0x00,0x09,0xe0,0x0f,0xc0,
+0x00,0x2f,0xc0,0x00,0xed,0x00,0x05,0xf2,0x4f,0x70,0x00,0xbf,0x20,0x00,0xfb,0x00,
+0x03,0xf4,0x7f,0x40,0x01,0xfc,0x00,0x01,0xfa,0x00,0x02,0xf5,0x8f,0x20,0x04,0xf8,
+0x00,0x03,0xf8,0x00,0x02,0xf5,0x9f,0x10,0x07,0xf6,0x00,0x04,0xf7,0x00,0x03,0xf4,
+0x9f,0x20,0x08,0xf5,0x07,0x09,0xf0,0x10,0x05,0xf2,0x8f,0x20,0x08,0xf6,0x00,0x0a,
+0xf5,0x00,0x0b,0xe0,0x6f,0x50,0x05,0xfc,0x00,0x5f,0xf7,0x00,0x3f,0x70,0x2f,0x90,
+0x00,0xef,0xdc,0xf7,0xff,0x78,0xfc,0xe5,0x08,0x60,0x2c,0xfd,0x50,0x3c,0xfe,0x80,
+0xc9,0x06,0x04,0x01,0x00,0x24,0xcf,0x60,0x0a,0x00,0x11,0x1d,0x86,0x03,0x01,0x0d,
+0x03,0x52,0xbf,0xfb,0x88,0x9b,0xfb,0x7b,0x01,0x52,0x9d,0xff,0xec,0x82,0x00,0x71,
+0x06,0x12,0xf0,0x08,0x00,0x32,0xbf,0xf6,0x00,0x32,0x03,0x00,0x2f,0x05,0x00,0x7d,
+0x06,0x21,0xef,0x20,0x1c,0x03,0x31,0xf3,0x9f,0x80,0x40,0x05,0x10,0xe0,0xef,0x02,
+0x00,0xeb,0x02,0x22,0x0d,0xf4,0x69,0x02,0x32,0x08,0xfb,0x00,0x49,0x08,0x22,0xff,
+0x10,0x45,0x01,0x00,0x3a,0x03,0x00,0xee,0x05,0x41,0x7f,0xd0,0x00,0x00,0x42,0x05,
+0xe0,0xf3,0x00,0x00,0xef,0xed,0xdd,0xdd,0xdf,0xf9,0x00,0x05,0xff,0x00,0x00,0x05,
+0x00,0x21,0x0b,0xf9,0x7c,0x03,0x31,0x60,0x1f,0xf3,0x2a,0x01,0x31,0xc0,0x7f,0xd0,
+0xb2,0x03,0xe0,0xf2,0x0f,0xff,0xff,0xff,0xc8,0x10,0x00,0xff,0xee,0xee,0xff,0xfe,
+0x20,0xb0,0x01,0x40,0x4e,0xfb,0x00,0xff,0x3d,0x05,0x00,0xa1,0x09,0x00,0x62,0x00,
+0x06,0x0d,0x00,0xa1,0x4e,0xf7,0x00,0xff,0xdd,0xdd,0xef,0xf7,0x00,0x0f,0x14,0x0a,
+0x00,0x27,0x00,0x51,0x14,0xcf,0xb0,0x0f,0xf3,0xc7,0x08,0x00,0x27,0x00,0x21,0x0c,
+0xf8,0xf1,0x01,0x20,0xbf,0x80,0x0d,0x00,0x20,0x1f,0xf6,0x0d,0x00,0x90,0x2c,0xff,
+0x10,0xff,0xed,0xdd,0xef,0xff,0x40,0x34,0x00,0x10,0xd9,0xd8,0x00,0xf0,0x07,0x6c,
+0xef,0xea,0x40,0x00,0x00,0x2d,0xff,0xfe,0xff,0xf9,0x00,0x01,0xef,0xc3,0x00,0x07,
+0xff,0x70,0x0a,0xfc,0x00,0xd6,0x09,0x20,0x1f,0xf4,0x33,0x02,0x30,0xf5,0x5f,0xe0,
+0x22,0x03,0x20,0x94,0x7f,0x4b,0x07,0x03,0x29,0x02,0x0c,0x07,0x00,0x22,0x8f,0xb0,
+0x41,0x01,0x01,0x65,0x0a,0x31,0x83,0x1f,0xf3,0x38,0x00,0x12,0x0b,0x46,0x00,0xb0,
+0x01,0xff,0xb2,0x00,0x06,0xff,0x70,0x00,0x3e,0xff,0xee,0x48,0x0a,0x50,0x01,0x8d,
+0xff,0xea,0x30,0xb2,0x00,0xa0,0xec,0x81,0x00,0x00,0x0f,0xfe,0xee,0xef,0xff,0x60,
+0x97,0x02,0x31,0x01,0x8f,0xf7,0x9e,0x02,0x51,0x05,0xff,0x30,0x0f,0xf3,0x37,0x06,
+0x01,0x07,0x00,0x10,0x3f,0xe9,0x00,0x00,0x01,0x05,0x01,0x07,0x00,0x22,0x0e,0xf4,
+0x07,0x00,0x12,0xf5,0x15,0x00,0x18,0xf4,0x1c,0x00,0x27,0x4f,0xf0,0x38,0x00,0x02,
+0x46,0x00,0x01,0x54,0x00,0x21,0xfd,0xdd,0x62,0x00,0x03,0x70,0x00,0x10,0xff,0xbc,
+0x08,0x71,0x0f,0xfe,0xee,0xee,0xee,0xe9,0x0f,0x79,0x01,0x0f,0x06,0x00,0x06,0x51,
+0xfe,0xdd,0xdd,0xdd,0x80,0x30,0x00,0x1f,0xa0,0x2a,0x00,0x0c,0x06,0x30,0x00,0x11,
+0xdb,0x30,0x00,0x11,0xfd,0x06,0x00,0x11,0xf8,0x66,0x00,0x1f,0xe7,0x36,0x00,0x10,
+0x11,0x50,0x30,0x00,0x1f,0x60,0x66,0x00,0x12,0x07,0x06,0x00,0xf1,0x08,0x00,0x01,
+0x7c,0xef,0xeb,0x50,0x00,0x00,0x3e,0xff,0xfe,0xff,0xfb,0x00,0x02,0xff,0xc3,0x00,
+0x06,0xff,0xa0,0x0a,0xfc,0xe1,0x07,0x21,0x1f,0xf4,0xce,0x03,0x03,0xd1,0x02,0x28,
+0x7f,0xc0,0xa5,0x01,0xe1,0x9f,0xb0,0x00,0x08,0xdd,0xdd,0xd7,0x8f,0xb0,0x00,0x09,
+0xff,0xff,0xf9,0x1c,0x00,0x41,0x0a,0xf9,0x4f,0xf0,0x07,0x00,0x21,0x0f,0xf6,0x07,
+0x00,0x31,0x08,0xfe,0x10,0xf2,0x05,0xb0,0xdf,0xe4,0x00,0x01,0x7f,0xf7,0x00,0x1c,
+0xff,0xfd,0xef,0x93,0x07,0x42,0x5b,0xef,0xed,0x93,0x7d,0x00,0x02,0x87,0x02,0x00,
+0xe4,0x02,0x0f,0x0f,0x00,0x14,0x71,0xed,0xdd,0xdd,0xdd,0xdf,0xf1,0x0f,0xae,0x06,
+0x0f,0x3c,0x00,0x1d,0x0a,0x0f,0x00,0x3f,0xdf,0x6d,0xf6,0x03,0x00,0x03,0x11,0x60,
+0xd9,0x06,0x1f,0xf6,0x06,0x00,0x2f,0x20,0x4e,0xd0,0xbe,0x02,0x20,0x3f,0xf2,0x49,
+0x01,0xf2,0x03,0x0d,0xfc,0x20,0x03,0xef,0xc0,0x03,0xef,0xfe,0xef,0xfe,0x20,0x00,
+0x19,0xdf,0xfd,0x81,0x00,0x66,0x02,0x11,0xe2,0x94,0x03,0x21,0x8f,0xf3,0x0f,0x00,
+0x30,0x7f,0xf4,0x00,0x0f,0x00,0x21,0x5f,0xf6,0x9b,0x01,0x30,0x4f,0xf7,0x00,0x0f,
+0x00,0x21,0x3f,0xf9,0xaa,0x01,0x11,0x2e,0x66,0x04,0x32,0xff,0x5d,0xff,0xef,0x01,
+0x02,0xfb,0x05,0x40,0xff,0xfd,0x6f,0xf5,0x0f,0x00,0x40,0xfd,0x10,0x9f,0xf2,0x0f,
+0x00,0x41,0x40,0x00,0xcf,0xd0,0x3c,0x00,0x31,0x02,0xef,0xa0,0x4b,0x00,0x12,0x05,
+0x15,0x03,0x01,0xa6,0x05,0x01,0xc9,0x03,0x12,0xfd,0x78,0x00,0x41,0x1e,0xfa,0x00,
+0x0f,0xe7,0x07,0x0f,0x06,0x00,0x42,0x00,0x8d,0x02,0x11,0xd4,0xa4,0x01,0x22,0xf5,
+0x0f,0x2e,0x08,0x32,0x2f,0xff,0x0f,0xf5,0x0d,0x51,0x8f,0xff,0x0f,0xff,0xe0,0xb1,
+0x04,0x40,0xff,0x0f,0xfe,0xf4,0xc2,0x04,0x60,0xfe,0xff,0x0f,0xf8,0xfb,0x00,0x64,
+0x04,0x30,0xff,0x0f,0xf2,0x2e,0x00,0x32,0x2f,0xf3,0xff,0xf5,0x0a,0xf0,0x16,0x9f,
+0x92,0xff,0x0f,0xf2,0x4f,0xe0,0x00,0x00,0xef,0x33,0xff,0x0f,0xf2,0x0d,0xf4,0x00,
+0x05,0xfc,0x03,0xff,0x0f,0xf3,0x07,0xfb,0x00,0x0c,0xf6,0x04,0xff,0x0f,0xf3,0x01,
+0xff,0x10,0x2f,0xe0,0x09,0x00,0x51,0x00,0xaf,0x80,0x9f,0x90,0x09,0x00,0x41,0x3f,
+0xe0,0xff,0x20,0x09,0x00,0x41,0x0d,0xfb,0xfc,0x00,0x09,0x00,0x32,0x06,0xff,0xf5,
+0x09,0x00,0x33,0x00,0xff,0xe0,0x09,0x00,0x50,0x9f,0x80,0x00,0x04,0xff,0xf2,0x03,
+0x0f,0xf9,0x00,0x00,0x00,0x02,0xff,0x10,0xff,0xf3,0x00,0x00,0x00,0x2f,0xf1,0x0f,
 0xff,0xd0,0x0f,0x00,0x21,0xff,0x80,0x0f,0x00,0x31,0xf9,0xff,0x30,0x0f,0x00,0x21,
 0x4b,0xfd,0x0f,0x00,0x31,0xf4,0x1f,0xf8,0x0f,0x00,0x31,0x40,0x6f,0xf2,0x0f,0x00,
 0x31,0x00,0xbf,0xc0,0x0f,0x00,0x31,0x02,0xff,0x70,0x0f,0x00,0x30,0x06,0xff,0x22,
-0x0f,0x00,0x31,0x00,0x0c,0xfc,0x0f,0x00,0x30,0x00,0x2f,0xf9,0x0f,0x00,0x00,0xf1,
-0x0d,0x11,0xf1,0x14,0x01,0x12,0xcf,0x0f,0x00,0x13,0x02,0x0f,0x00,0x30,0x08,0xff,
-0x10,0x30,0x05,0x00,0x37,0x05,0x40,0x02,0xdf,0xff,0xff,0x1b,0x01,0x90,0xef,0xd4,
-0x00,0x28,0xff,0x70,0x00,0x9f,0xd1,0xb4,0x07,0x31,0x20,0x0f,0xf4,0x12,0x01,0x11,
-0x05,0x40,0x09,0x41,0x6f,0xd0,0x7f,0xb0,0x4c,0x0f,0x31,0x09,0xfa,0x00,0xad,0x00,
-0x21,0x9f,0xa0,0xbc,0x00,0x13,0x19,0x0f,0x00,0x03,0x1e,0x00,0x04,0x2d,0x00,0x03,
-0x3c,0x00,0x01,0x4b,0x00,0x30,0x05,0xff,0x20,0x5a,0x00,0x32,0x17,0xff,0x70,0x69,
-0x00,0x11,0x80,0xa8,0x05,0x22,0xda,0x30,0xc2,0x04,0x30,0xeb,0x50,0x00,0x5d,0x04,
-0x21,0xff,0xfb,0x15,0x02,0x41,0x07,0xff,0x90,0x0f,0xb3,0x0e,0x02,0x01,0x05,0x28,
-0x1f,0xf3,0x07,0x00,0x10,0x6f,0x15,0x00,0x00,0x19,0x04,0x71,0x0f,0xfe,0xdd,0xde,
-0xff,0xfc,0x10,0x3f,0x00,0x14,0x60,0x42,0x04,0x0f,0x07,0x00,0x17,0x32,0x00,0x00,
-0x7c,0xf7,0x00,0x10,0xef,0xab,0x04,0xf1,0x03,0x00,0x01,0xff,0xc4,0x00,0x29,0xff,
-0x50,0x00,0xbf,0xc0,0x00,0x00,0x07,0xfe,0x10,0x1f,0xf3,0x3b,0x0a,0x22,0x06,0xfd,
-0x67,0x04,0x21,0x9f,0xa0,0x21,0x02,0x00,0xa1,0x0c,0x00,0x98,0x05,0x21,0xbf,0x80,
-0xe8,0x00,0x04,0x0f,0x00,0x03,0x1e,0x00,0x04,0x2d,0x00,0x03,0x3c,0x00,0x04,0x4b,
-0x00,0x92,0x01,0xff,0xc3,0x00,0x18,0xff,0x50,0x00,0x03,0x69,0x00,0x00,0x78,0x00,
-0x41,0xdf,0xfc,0x10,0x00,0x8e,0x10,0x21,0xfe,0x30,0x08,0x00,0x23,0x2c,0xfb,0xb5,
-0x09,0x13,0x00,0x2c,0x07,0x01,0x46,0x06,0x11,0xf4,0xab,0x00,0x32,0x3c,0xfe,0x10,
-0x00,0x07,0x02,0x4f,0x05,0x23,0xcf,0x80,0x01,0x07,0x02,0x15,0x00,0x10,0x50,0x07,
-0x00,0x20,0x3d,0xfd,0xea,0x02,0x31,0xdf,0xff,0xd2,0x3f,0x00,0x11,0xfa,0xe3,0x00,
-0x22,0x08,0xfd,0xea,0x00,0x22,0xef,0x60,0xd1,0x03,0x11,0xe0,0x07,0x00,0x32,0x0e,
-0xf7,0x00,0x3e,0x01,0x11,0x10,0x46,0x00,0x12,0xdf,0x4d,0x00,0x50,0x5f,0xf1,0x00,
-0x01,0x7c,0xc4,0x06,0x00,0x7a,0x05,0x00,0xd0,0x03,0x20,0xef,0xc3,0xe0,0x06,0x30,
-0x05,0xff,0x10,0x6f,0x01,0x21,0x07,0xfc,0x35,0x01,0x01,0x0e,0x00,0x00,0x2f,0x03,
-0x11,0xd3,0x07,0x00,0x31,0x2d,0xff,0xd8,0xbc,0x00,0x41,0x7d,0xff,0xfd,0x60,0x46,
-0x09,0x03,0xd4,0x00,0x32,0x04,0xef,0xc0,0x1a,0x11,0x31,0xf2,0x0f,0xf4,0x88,0x03,
-0x30,0x0b,0xfa,0x00,0x4a,0x03,0xe0,0x03,0xff,0xa2,0x00,0x04,0xdf,0xd0,0x00,0x4e,
-0xff,0xfd,0xff,0xfd,0x20,0xea,0x05,0x32,0xec,0x70,0x00,0xd9,0x0c,0x82,0xfc,0x5e,
-0xee,0xee,0xff,0xee,0xee,0xea,0x38,0x04,0x1f,0x00,0x07,0x00,0x4f,0x01,0xd5,0x07,
-0x30,0x4f,0xf5,0xfe,0xaf,0x00,0x1f,0xff,0x0d,0x00,0x2e,0x30,0x3f,0xf0,0x00,0xca,
-0x0c,0x00,0xdb,0x01,0xf2,0x08,0x0c,0xf9,0x07,0xff,0x70,0x00,0x2b,0xff,0x20,0x09,
-0xff,0xfe,0xef,0xff,0x40,0x00,0x04,0xae,0xff,0xd8,0x10,0x00,0x7f,0x5c,0x09,0x11,
-0xc1,0x82,0x00,0x41,0x0f,0xf6,0x0b,0xfa,0x2f,0x09,0x11,0x10,0xcb,0x06,0x30,0xbf,
-0xa0,0x00,0x97,0x11,0x40,0x1f,0xf4,0x00,0x0a,0x68,0x12,0x30,0xfe,0x00,0x00,0xb8,
-0x06,0x00,0x60,0x02,0x30,0xef,0x50,0x00,0x7e,0x0c,0x22,0x08,0xfa,0xe4,0x0e,0x22,
-0x2f,0xf0,0xf7,0x09,0x41,0xcf,0x50,0x1f,0xf1,0xe9,0x0c,0x21,0x07,0xfa,0x8d,0x12,
-0x31,0xf1,0xcf,0x50,0x5e,0x00,0x21,0x8f,0xe0,0x7e,0x01,0x03,0x89,0x0b,0x32,0x0e,
-0xff,0x30,0x21,0x07,0x11,0xd0,0x98,0x03,0x03,0x00,0x0d,0x20,0x9f,0xa0,0x23,0x0f,
-0x20,0x9f,0xf2,0x9e,0x02,0x00,0xbc,0x02,0x10,0x0d,0xef,0x03,0x80,0xff,0x20,0x6f,
-0xc0,0x00,0x02,0xfe,0xfb,0x06,0x0a,0xa0,0x03,0xff,0x00,0x00,0x7f,0x8e,0xf0,0x00,
-0x08,0xfa,0x27,0x02,0x70,0x0b,0xf4,0xaf,0x40,0x00,0xbf,0x70,0x03,0x00,0x30,0xff,
-0x06,0xf8,0x12,0x00,0x70,0x07,0xfb,0x00,0x4f,0xa0,0x1f,0xd0,0x27,0x00,0x90,0x3f,
-0xe0,0x09,0xf6,0x00,0xdf,0x10,0x6f,0xb0,0x42,0x00,0x40,0xdf,0x10,0x08,0xf6,0xa3,
-0x0c,0xf0,0x02,0x0b,0xf6,0x2f,0xc0,0x00,0x4f,0xa0,0xdf,0x30,0x00,0x00,0x7f,0x96,
-0xf8,0x00,0x00,0xfe,0xeb,0x11,0x80,0x04,0xfc,0xbf,0x30,0x00,0x0a,0xf7,0xfb,0xfd,
-0x00,0x70,0xee,0xe0,0x00,0x00,0x6f,0xdf,0x70,0xc8,0x00,0x10,0xf9,0xbf,0x02,0x11,
-0xf3,0x83,0x04,0x10,0x50,0x8b,0x00,0x02,0x4b,0x03,0x01,0x39,0x0a,0x40,0x00,0x00,
-0x0d,0xfb,0xb6,0x07,0x40,0xfe,0x00,0x3f,0xf5,0xd4,0x00,0xf1,0x00,0x50,0x00,0x9f,
-0xe1,0x00,0x00,0xdf,0xa0,0x00,0x00,0xef,0x90,0x00,0x8f,0xf1,0x0d,0x09,0x11,0x2f,
-0xd8,0x07,0x31,0xfd,0x0c,0xfc,0x06,0x01,0x31,0xfc,0xff,0x20,0x73,0x04,0x22,0xff,
-0x70,0xa4,0x02,0x12,0xf1,0x26,0x08,0x02,0x83,0x0f,0x21,0x2f,0xfc,0x0e,0x01,0x41,
-0x0c,0xfd,0x0b,0xfd,0x88,0x0c,0x30,0x30,0x2f,0xf8,0x7c,0x00,0xf0,0x00,0x80,0x00,
-0x7f,0xf2,0x00,0x00,0xbf,0xe0,0x00,0x00,0xdf,0xc0,0x00,0x5f,0xf4,0xd1,0x03,0x31,
-0x70,0x1e,0xfa,0x16,0x13,0x40,0x20,0x8f,0xf1,0x00,0x8b,0x0d,0x31,0x01,0xef,0x80,
-0x56,0x13,0x30,0x07,0xff,0x10,0x56,0x14,0x10,0x00,0xb4,0x0e,0x21,0x2f,0xf4,0x31,
-0x03,0x20,0x0a,0xfb,0xc5,0x00,0x40,0x90,0x03,0xff,0x20,0x39,0x00,0x31,0x10,0xbf,
-0x90,0x67,0x08,0x02,0x5a,0x0e,0x32,0x2f,0xfd,0xf7,0x98,0x08,0x13,0xfe,0x76,0x0b,
-0x12,0x60,0x79,0x04,0x03,0xfa,0x13,0x2f,0xff,0x50,0x0f,0x00,0x0e,0x11,0xdf,0x19,
-0x03,0x10,0x1b,0x44,0x0d,0x21,0xff,0xf0,0x53,0x00,0x01,0x52,0x00,0x02,0xee,0x00,
-0x11,0x07,0xed,0x00,0x12,0x02,0x56,0x00,0x21,0xdf,0xb0,0xe8,0x01,0x11,0xe1,0x3f,
-0x01,0x11,0xf4,0xfc,0x01,0x21,0xf9,0x00,0x1b,0x01,0x01,0xba,0x0c,0x01,0xfa,0x00,
-0x01,0xc7,0x00,0x10,0x00,0x90,0x04,0x00,0x24,0x01,0x11,0xf2,0x6e,0x00,0x62,0xff,
-0xdd,0xdd,0xdd,0xdd,0xd5,0xbe,0x08,0xaf,0x70,0x4f,0xff,0xf2,0x4f,0xfc,0xc1,0x4f,
-0xe0,0x00,0x03,0x00,0x23,0x00,0x3c,0x00,0x41,0xff,0xf2,0x5f,0xb0,0x06,0x10,0x00,
-0x39,0x01,0x15,0xf7,0x7c,0x10,0x01,0xa5,0x11,0x01,0xc3,0x0e,0x00,0xb7,0x02,0x00,
-0xc2,0x13,0x00,0x11,0x02,0x01,0xb9,0x00,0x10,0x30,0xa2,0x01,0x10,0x90,0x1a,0x00,
-0x10,0xe0,0x71,0x11,0x10,0xf5,0xaf,0x00,0x11,0xfb,0xbe,0x01,0x10,0x10,0x3c,0x01,
-0x14,0x70,0xee,0x0f,0x20,0x0c,0xf4,0x34,0x00,0xaf,0x84,0xef,0xff,0x8b,0xce,0xf8,
-0x00,0xaf,0x80,0x0a,0x05,0x00,0x18,0x40,0x8b,0xce,0xf8,0xef,0x6a,0x06,0x11,0x66,
-0x30,0x01,0x10,0x20,0xdb,0x01,0x10,0x90,0x86,0x02,0xf0,0x0d,0xf0,0x00,0x00,0x6f,
-0x88,0xf6,0x00,0x00,0xcf,0x22,0xfc,0x00,0x03,0xfb,0x00,0xcf,0x30,0x0a,0xf5,0x00,
-0x5f,0x90,0x1f,0xe0,0x00,0x0e,0xf1,0xbc,0x79,0x10,0x11,0x9f,0x97,0x04,0x51,0x17,
-0x83,0x00,0x07,0xfe,0x60,0x11,0x20,0x0b,0xf3,0x2f,0x12,0xe4,0x30,0x00,0x6f,0xfe,
-0xce,0xff,0x50,0x2f,0xf5,0x00,0x08,0xfe,0x04,0xa8,0x49,0x06,0xe0,0xef,0x40,0x04,
-0xae,0xff,0xff,0xf4,0x09,0xff,0xca,0x88,0xff,0x45,0xfe,0x9c,0x0e,0x10,0xaf,0xbe,
-0x03,0x20,0x4b,0xf9,0x2b,0x02,0xf2,0x02,0x7f,0xf4,0x00,0x4e,0xff,0x50,0xdf,0xff,
-0xff,0xee,0xf7,0x01,0x9e,0xfe,0x91,0x7c,0x80,0x94,0x10,0x0f,0x06,0x00,0x06,0xf0,
-0x04,0xd1,0x9e,0xfd,0x80,0x00,0x5f,0xee,0xfe,0xef,0xfc,0x00,0x5f,0xfc,0x20,0x04,
-0xff,0x80,0x5f,0xe1,0x5c,0x04,0x20,0x5f,0xd0,0x15,0x0c,0x00,0x06,0x00,0x20,0x0d,
-0xf5,0x06,0x00,0x26,0x0c,0xf5,0x0c,0x00,0x23,0x0f,0xf3,0x24,0x00,0x00,0x30,0x00,
-0x31,0x70,0x5f,0xde,0x3c,0x00,0x10,0xa1,0x48,0x00,0x20,0x00,0x18,0x3a,0x0f,0xc0,
-0x3e,0xff,0xde,0xff,0x70,0x0e,0xf9,0x00,0x06,0xff,0x36,0xfd,0x34,0x12,0x00,0x6a,
-0x10,0x35,0x38,0x6d,0xf4,0x27,0x11,0x11,0x0d,0x78,0x02,0x00,0x16,0x00,0x30,0x03,
-0x26,0xfd,0x1b,0x0e,0x20,0x0e,0xf9,0x37,0x02,0xa6,0x3e,0xff,0xce,0xff,0x60,0x00,
-0x19,0xdf,0xea,0x30,0xba,0x14,0x2d,0x05,0xfd,0x0b,0x00,0xf0,0x08,0x03,0xbe,0xfc,
-0x65,0xfd,0x04,0xff,0xfd,0xff,0xdf,0xd1,0xef,0xb1,0x00,0x6f,0xfd,0x6f,0xe0,0x00,
-0x00,0x8f,0xdb,0xf8,0x21,0x00,0x00,0x9f,0x0f,0x35,0x5f,0xde,0xf4,0x0b,0x00,0x20,
-0xda,0xf7,0x0b,0x00,0x11,0x6f,0x34,0x11,0xf0,0x13,0xef,0x70,0x00,0x3e,0xfd,0x04,
-0xff,0xda,0xbf,0xef,0xd0,0x03,0xbf,0xfd,0x73,0xfd,0x00,0x07,0xdf,0xeb,0x30,0x00,
-0x1d,0xff,0xde,0xff,0x50,0x0c,0xfa,0x10,0x07,0xff,0x15,0xfd,0x83,0x13,0x00,0x49,
-0x01,0x80,0x6f,0xbd,0xfd,0xcc,0xcc,0xcd,0xfc,0xef,0x92,0x01,0x12,0xdd,0xab,0x00,
-0x10,0x80,0xc6,0x03,0x00,0x92,0x03,0xf0,0x02,0x40,0x0d,0xfc,0x20,0x01,0xaf,0x60,
-0x2e,0xff,0xdd,0xff,0xc0,0x00,0x18,0xdf,0xfc,0x70,0x54,0x08,0x90,0xfe,0x40,0x00,
-0x9f,0xff,0xe4,0x00,0x1f,0xf7,0x3a,0x04,0x11,0x00,0x83,0x16,0x10,0x04,0x4c,0x0e,
-0x42,0x3a,0xcf,0xfa,0xa6,0x07,0x05,0x00,0xc9,0x09,0x0f,0x09,0x00,0x16,0xb0,0x3b,
-0xef,0xc6,0x2f,0xd0,0x4f,0xff,0xef,0xfc,0xfd,0x1e,0x1e,0x12,0x60,0xd6,0xfe,0x00,
-0x00,0x07,0xfd,0x1c,0x17,0x35,0x5f,0xdd,0xf6,0xdb,0x00,0x11,0xdc,0x0b,0x00,0x01,
-0x16,0x00,0x02,0x21,0x00,0x10,0x0e,0x2c,0x00,0xa1,0xd0,0x4f,0xff,0xdf,0xfd,0xfd,
-0x00,0x3b,0xff,0xc6,0x33,0x01,0xfe,0x08,0x07,0xfc,0x03,0x10,0x00,0x00,0xcf,0x91,
-0xed,0x40,0x00,0x9f,0xf2,0x08,0xff,0xed,0xff,0xf6,0x00,0x03,0xae,0xfe,0xa3,0x5b,
-0x01,0x08,0x0b,0x00,0xf1,0x06,0x08,0xdf,0xe9,0x10,0x5f,0xdd,0xfe,0xef,0xfc,0x05,
-0xff,0xd3,0x00,0x5f,0xf4,0x5f,0xf1,0x00,0x00,0xbf,0x85,0xc8,0x01,0x00,0x21,0x00,
-0x21,0x8f,0x95,0xb2,0x01,0x0f,0x0b,0x00,0x0e,0x60,0x1e,0xd0,0x4f,0xf2,0x06,0x50,
-0x45,0x06,0x0f,0x02,0x00,0x05,0x81,0x00,0x3e,0xb0,0x00,0x7f,0xf0,0x00,0x07,0x25,
-0x07,0x0f,0xfa,0x03,0x17,0x00,0xb3,0x14,0x6e,0xb0,0xbe,0xff,0x50,0xaf,0xd7,0xd4,
-0x02,0x0c,0x06,0x00,0xf0,0x03,0x08,0xfe,0x20,0x5f,0xd0,0x00,0x7f,0xf3,0x00,0x5f,
-0xd0,0x06,0xff,0x40,0x00,0x5f,0xd0,0x5f,0xcf,0x17,0x10,0xd3,0xb3,0x05,0x31,0x5f,
-0xee,0xfd,0x25,0x15,0x00,0xd3,0x04,0x40,0x5f,0xfb,0x7f,0xf2,0xa3,0x07,0x20,0x0b,
-0xfd,0x36,0x00,0x30,0x01,0xef,0x90,0x3c,0x00,0x22,0x4f,0xf5,0x42,0x00,0x10,0x10,
-0x4e,0x00,0x5f,0xcf,0xc0,0x2f,0xf2,0xff,0x03,0x00,0x05,0xf0,0x13,0x6f,0xb1,0x9e,
-0xfe,0x80,0x03,0xbe,0xfd,0x70,0x06,0xfd,0xef,0xef,0xff,0xc6,0xff,0xef,0xff,0x90,
-0x6f,0xfa,0x10,0x06,0xff,0xfa,0x10,0x08,0xff,0x16,0xfe,0x00,0x00,0x0c,0xfe,0x6e,
-0x0f,0x22,0x6f,0xc0,0xe9,0x0f,0x32,0xcf,0x66,0xfc,0x48,0x15,0x21,0x0c,0xf6,0x13,
-0x00,0x1f,0x90,0x13,0x00,0x29,0xf0,0x09,0x60,0x5f,0xb0,0x8d,0xfe,0x91,0x05,0xfd,
-0xdf,0xee,0xff,0xc0,0x5f,0xfd,0x30,0x05,0xff,0x45,0xff,0x10,0x00,0x0b,0xf8,0x5f,
-0x32,0x11,0x0f,0xa9,0x01,0x14,0x21,0x5f,0xd0,0xd0,0x18,0xa0,0x17,0xdf,0xec,0x50,
-0x00,0x02,0xdf,0xfd,0xdf,0xfa,0xa4,0x17,0x50,0x03,0xef,0x80,0x5f,0xe0,0x75,0x06,
-0x20,0xbf,0x80,0xaf,0x03,0x20,0xdf,0x50,0xab,0x15,0x20,0xef,0x40,0x80,0x00,0x02,
-0x0c,0x00,0x02,0x18,0x00,0x00,0x7b,0x03,0x31,0x4f,0xf1,0x0d,0x30,0x00,0x20,0x02,
-0xef,0x3c,0x00,0x20,0x00,0x18,0xec,0x17,0x30,0x5f,0xa3,0xae,0x55,0x04,0xa1,0xef,
-0xda,0xbf,0xfc,0x00,0x5f,0xf8,0x00,0x02,0xef,0x85,0x04,0x17,0x7f,0x55,0x04,0x26,
-0x0e,0xf4,0x4f,0x04,0x02,0x0c,0x00,0x41,0x1f,0xf2,0x5f,0xe0,0x24,0x00,0x80,0xfa,
-0x10,0x05,0xff,0x70,0x5f,0xef,0xfd,0x55,0x04,0x11,0xd2,0x48,0x00,0x0f,0xe7,0x01,
-0x09,0x00,0x2f,0x03,0xf0,0x00,0xd6,0x3f,0xc0,0x4f,0xff,0xde,0xfd,0xfc,0x1e,0xfb,
-0x10,0x04,0xff,0xc7,0xfe,0x79,0x16,0x00,0xa0,0x00,0x21,0x5f,0xcd,0xe8,0x14,0x20,
-0xef,0x40,0x0b,0x00,0x00,0x2f,0x03,0x02,0x16,0x00,0x20,0xc6,0xfe,0x19,0x03,0x10,
-0x1e,0x4f,0x15,0x60,0xc0,0x4f,0xff,0xce,0xfe,0xfc,0x42,0x00,0x20,0x5f,0xc0,0xfc,
-0x02,0x01,0x26,0x06,0x0e,0x0b,0x00,0x01,0x05,0x00,0x80,0x3c,0xfc,0x5f,0xef,0xfe,
-0xb5,0xff,0xb1,0xcb,0x09,0x11,0x05,0x29,0x02,0x0f,0x07,0x00,0x07,0x50,0x00,0x5c,
-0xff,0xd9,0x10,0x62,0x16,0x90,0xfe,0x20,0x3f,0xf4,0x00,0x1c,0xfc,0x06,0xfc,0xbe,
-0x08,0x21,0x4f,0xf2,0x4c,0x04,0x61,0xfb,0x73,0x00,0x00,0x00,0x6d,0xc4,0x0a,0x50,
-0x01,0x5a,0xff,0x90,0x11,0x35,0x04,0x20,0x1c,0xf7,0x19,0x01,0x20,0x7f,0xe3,0x00,
-0x18,0xa2,0xbf,0xfe,0xdf,0xff,0x50,0x00,0x6b,0xef,0xda,0x20,0xe5,0x01,0x03,0x04,
-0x00,0x88,0xef,0xff,0xff,0xf0,0x9a,0xdf,0xda,0xa0,0x14,0x00,0x0f,0x04,0x00,0x02,
-0x00,0x8d,0x10,0x71,0x2f,0xfe,0xe0,0x00,0x05,0xdf,0xd0,0x28,0x02,0x11,0x96,0x37,
-0x02,0x0f,0x0b,0x00,0x13,0xf0,0x0a,0x94,0xfe,0x00,0x00,0x0b,0xf9,0x1f,0xf8,0x00,
-0x19,0xff,0x90,0x8f,0xff,0xef,0xfd,0xf9,0x00,0x7d,0xff,0xb4,0x8f,0x90,0x6f,0xc0,
-0x45,0x12,0x20,0x1f,0xf1,0xfa,0x16,0xf0,0x02,0x0b,0xf6,0x00,0x00,0xdf,0x40,0x06,
-0xfc,0x00,0x02,0xfe,0x00,0x00,0xff,0x10,0x07,0xf9,0x28,0x17,0x10,0x0c,0xa2,0x08,
-0x30,0xb0,0x1f,0xe0,0x8e,0x07,0x20,0x7f,0x90,0xa0,0x17,0x20,0xcf,0x30,0x76,0x07,
-0x11,0xfd,0xf4,0x05,0x11,0xf8,0x30,0x08,0x11,0xf2,0xa4,0x0b,0x16,0xd0,0x50,0x1b,
-0x30,0xf5,0x1f,0xf0,0xc4,0x18,0xf0,0x0c,0x00,0x1f,0xf0,0x0c,0xf4,0x00,0x0a,0xff,
-0xa0,0x00,0x5f,0xc0,0x08,0xf8,0x00,0x0e,0xde,0xe0,0x00,0x9f,0x70,0x03,0xfc,0x00,
-0x4f,0x8a,0xf3,0xb2,0x07,0x50,0xef,0x10,0x8f,0x35,0xf8,0x8b,0x1b,0x70,0xaf,0x50,
-0xde,0x00,0xfd,0x05,0xf9,0xe2,0x1c,0xe0,0xf9,0x00,0xbf,0x29,0xf5,0x00,0x00,0x1f,
-0xd7,0xf4,0x00,0x6f,0x7d,0xf1,0x68,0x09,0x50,0xf0,0x00,0x1f,0xdf,0xc0,0xd9,0x09,
-0x50,0xb0,0x00,0x0c,0xff,0x70,0x20,0x09,0x31,0x60,0x00,0x07,0x8a,0x08,0x21,0xff,
-0x10,0xaa,0x00,0xa0,0x1f,0xf6,0x00,0x00,0x9f,0xd0,0x06,0xfe,0x10,0x03,0x29,0x10,
-0x30,0x90,0x0c,0xf9,0x22,0x0c,0x20,0x6f,0xe1,0x0b,0x02,0x11,0xef,0xff,0x08,0x11,
-0xfb,0xaa,0x08,0x02,0xa5,0x06,0x10,0xfc,0x52,0x08,0x30,0xfb,0xdf,0x70,0x54,0x0c,
-0x20,0x3f,0xf2,0xb5,0x0c,0x50,0x0a,0xfb,0x00,0x08,0xfd,0x57,0x09,0x10,0x3f,0x62,
-0x18,0x30,0xf1,0x8f,0xc0,0x00,0x07,0x20,0x3f,0xf1,0x1b,0x06,0x20,0x0d,0xf7,0x6e,
-0x10,0x41,0x07,0xfc,0x00,0x05,0xbc,0x14,0x20,0x0a,0xf8,0xba,0x14,0x20,0x0e,0xf2,
-0x3a,0x1a,0x20,0x4f,0xd0,0x85,0x08,0x20,0x9f,0x70,0x5a,0x06,0x20,0xdf,0x20,0xb1,
-0x0d,0x11,0xfc,0x70,0x09,0x11,0xf7,0x40,0x0b,0x15,0xf1,0x63,0x02,0x00,0x6e,0x1c,
-0x04,0x86,0x08,0x21,0x1a,0xf9,0x2c,0x09,0x10,0xe1,0xda,0x08,0x23,0xfb,0x20,0x99,
-0x09,0x70,0xfc,0x0a,0xcc,0xcc,0xcc,0xff,0xa0,0xbf,0x08,0x10,0xe1,0x46,0x01,0x10,
-0xf5,0xc7,0x10,0x13,0xf9,0x74,0x09,0x00,0x34,0x0f,0x04,0x9d,0x09,0x00,0xb2,0x0a,
-0x01,0xbb,0x0a,0x31,0x00,0x5f,0xf3,0x95,0x0b,0x42,0xcc,0xcc,0xcc,0xc1,0x30,0x12,
-0x02,0x95,0x16,0x00,0xae,0x1d,0x61,0xaf,0xc2,0x00,0x03,0xfe,0x10,0xc3,0x1c,0x20,
-0x0b,0xf7,0x50,0x04,0x06,0x04,0x00,0x20,0x0e,0xf4,0xd9,0x00,0xc2,0x00,0x2d,0xff,
-0x40,0x00,0x4f,0xfd,0x10,0x00,0x02,0xaf,0xc0,0x75,0x08,0x26,0x0d,0xf5,0x24,0x00,
-0x00,0x02,0x02,0x00,0xe6,0x00,0x01,0x7d,0x0e,0x00,0xf7,0x1a,0x10,0x2d,0xc3,0x0a,
-0x3e,0x65,0xfc,0xfc,0x01,0x00,0x23,0x76,0x22,0x2e,0x1a,0x32,0x1b,0xfb,0x00,0x3e,
-0x17,0x22,0x8f,0xa0,0xb9,0x03,0x04,0x04,0x00,0x00,0xf6,0x06,0x00,0xcf,0x0c,0x00,
-0xe8,0x0a,0xb1,0x03,0xef,0xd4,0x00,0x00,0xaf,0xf5,0x00,0x0a,0xfb,0x20,0xbc,0x09,
-0x2a,0x4f,0xe0,0x2c,0x00,0x20,0x7f,0xb0,0x15,0x16,0x00,0xe1,0x0e,0x70,0x00,0x9f,
-0xd2,0x00,0x00,0x45,0x00,0x7d,0x07,0xf1,0x12,0xeb,0x30,0x00,0x00,0x97,0x07,0xff,
-0xff,0xf6,0x00,0x02,0xfa,0x1f,0xf4,0x16,0xff,0x90,0x1b,0xf5,0x5f,0x90,0x00,0x4e,
-0xff,0xff,0xc0,0x49,0x40,0x00,0x02,0xaf,0xf9,0x10,0x96,0x1a,0x14,0x20,0xbf,0x16,
-0x12,0x0a,0x6c,0x15,0x05,0x88,0x1a,0x02,0x93,0x03,0x04,0x42,0x18,0x12,0xff,0xc5,
-0x0c,0x00,0xb4,0x1e,0x22,0xff,0xc0,0x0a,0x00,0x42,0x4f,0xf9,0x9f,0xf4,0x0a,0x00,
-0x52,0xdf,0xf1,0x1f,0xfd,0x00,0xe3,0x0a,0x22,0x70,0x08,0x43,0x0b,0x42,0x0d,0xfe,
-0x00,0x00,0xd6,0x1a,0x22,0x6f,0xf6,0x04,0x00,0x02,0x10,0x00,0x21,0x0e,0xfe,0x35,
-0x0b,0x00,0x78,0x20,0x00,0x8e,0x02,0x21,0x0e,0xfd,0x40,0x00,0x00,0xa9,0x08,0x11,
-0xf4,0x54,0x00,0x52,0xf8,0x00,0x01,0xff,0xc0,0x68,0x00,0x40,0x10,0x09,0xff,0xdc,
-0x01,0x0a,0x53,0xcd,0xff,0x90,0x1f,0xff,0x01,0x00,0x24,0xf1,0xaf,0x0a,0x00,0x22,
-0xfa,0x00,0x32,0x1a,0x13,0xcc,0x6c,0x19,0x22,0x04,0xff,0x50,0x17,0x00,0x1d,0x02,
-0x11,0x46,0x64,0x0b,0x41,0x38,0xb5,0x6f,0xe0,0x5f,0x0e,0x50,0x2b,0xff,0xfa,0x9f,
-0xb0,0x4c,0x01,0x60,0x03,0xef,0xfb,0x60,0xcf,0xe1,0x37,0x17,0xe0,0x2f,0xfc,0x20,
-0x00,0xef,0xfe,0x89,0xff,0x50,0x00,0xcf,0xc0,0x00,0x01,0x50,0x15,0x01,0x15,0x11,
-0x00,0x9d,0x08,0x50,0x54,0x00,0x0b,0xfa,0x00,0x9c,0x1b,0x30,0xc2,0x5f,0xa0,0xf5,
-0x01,0x80,0x0a,0xff,0xf8,0x00,0x4f,0xe0,0x0f,0xf2,0xd4,0x00,0x50,0x40,0x00,0x1f,
-0xf0,0x0f,0x32,0x1b,0x10,0xc1,0x9b,0x1d,0x00,0x1e,0x00,0x11,0x28,0xa3,0x07,0x13,
-0x09,0x73,0x19,0x00,0x70,0x12,0x11,0x20,0x57,0x01,0x00,0x4c,0x03,0x11,0xc0,0x09,
-0x01,0xc0,0xfc,0x00,0x00,0x2e,0xfd,0x30,0x00,0x00,0x03,0xdf,0xe2,0x00,0x82,0x00,
-0x31,0x75,0x57,0xbf,0x6a,0x10,0x10,0x1a,0xc6,0x00,0x11,0xa1,0x37,0x00,0x42,0x27,
-0xbd,0xcb,0x72,0x41,0x00,0x53,0x59,0x99,0x99,0x99,0x81,0x94,0x20,0x00,0x1c,0x16,
-0x01,0x3f,0x1c,0x80,0xb5,0x04,0xff,0xff,0xfe,0x01,0xec,0x10,0x8c,0x00,0x50,0x50,
-0x7f,0xff,0xf4,0x0d,0x8c,0x01,0xf0,0x07,0x21,0xdf,0x60,0x0a,0xff,0x90,0x07,0xf5,
-0x56,0x00,0x01,0xfd,0x85,0x00,0x00,0xdd,0x00,0x00,0x3d,0xff,0x10,0x06,0xb0,0x12,
-0x20,0x23,0x00,0x3d,0x1b,0x32,0x00,0x4b,0x50,0xba,0x01,0x53,0x75,0x50,0x0d,0xed,
-0x00,0xfc,0x0c,0x43,0xf0,0x0f,0xff,0x00,0xda,0x0c,0x33,0xd0,0x06,0x78,0x0b,0x00,
-0x53,0x84,0x00,0x05,0xcf,0x40,0xe6,0x01,0x21,0xd0,0x09,0x0d,0x12,0x00,0x3b,0x10,
-0x42,0xa0,0x03,0xa6,0x92,0x5e,0x10,0x52,0x42,0x10,0x00,0x1b,0xfd,0x10,0x02,0xb0,
-0xf7,0x00,0x00,0x2f,0xfb,0x83,0x00,0x00,0x00,0x3c,0x5d,0xbb,0x10,0x80,0x73,0xff,
-0x66,0x32,0x65,0xef,0xc0,0x30,0x34,0x0c,0x42,0xfe,0x7f,0xf8,0xfd,0xd0,0x0c,0x63,
-0x02,0xc5,0x9f,0xc5,0xff,0x18,0x59,0x02,0x32,0x5b,0x81,0xb8,0x09,0x00,0x15,0x2a,
-0x6a,0x02,0x71,0x02,0xef,0xe4,0x6b,0xde,0xda,0x50,0x34,0x19,0x01,0xcc,0x01,0x20,
-0xfe,0x70,0x27,0x1e,0xf0,0x00,0xd1,0xbf,0xfa,0x33,0x47,0xcf,0xfb,0x10,0x00,0x0c,
-0xfd,0x10,0x0b,0xff,0x50,0x86,0x06,0xf0,0x05,0x00,0x0e,0xfc,0x10,0x00,0xaf,0xf6,
-0x00,0x00,0x2e,0xf9,0x00,0x02,0xef,0xd1,0x00,0x09,0xff,0x40,0x00,0x62,0x01,0x40,
-0xaf,0xfd,0x10,0x05,0x44,0x02,0x90,0xaf,0x90,0x00,0xff,0xef,0xd2,0x4f,0xfa,0x00,
-0x46,0x06,0x41,0x03,0xfe,0x1d,0xfe,0x4a,0x21,0x52,0x0f,0xf1,0x04,0xfc,0x01,0xb7,
-0x04,0x72,0x0e,0xf3,0x04,0xfd,0x00,0x1b,0xb0,0x0b,0x00,0x22,0x02,0xfe,0x81,0x00,
-0x00,0x95,0x20,0x02,0x74,0x19,0x01,0x77,0x05,0x02,0xc1,0x1d,0x01,0x4d,0x00,0x11,
-0x2f,0xc0,0x00,0x01,0x63,0x00,0x21,0x09,0xfd,0x20,0x03,0x20,0x2e,0xf8,0xa0,0x02,
-0x11,0xe4,0xdc,0x02,0x00,0xd0,0x01,0x62,0x1b,0xff,0xc7,0x54,0x58,0xdf,0x17,0x03,
-0x10,0x7e,0xbb,0x00,0x13,0x60,0xb9,0x01,0x22,0xcd,0xc9,0x70,0x01,0x70,0x09,0x99,
-0x98,0x88,0x88,0x88,0x85,0x42,0x09,0x00,0x01,0x00,0x00,0x02,0x23,0x50,0xff,0xff,
-0xee,0xee,0xef,0x68,0x21,0x21,0xf0,0x00,0x52,0x08,0x11,0x04,0x0b,0x0f,0x62,0xef,
-0x30,0x00,0x09,0xff,0x30,0x36,0x1f,0x32,0x0e,0xfc,0x00,0x42,0x04,0x20,0x0f,0xfa,
-0x46,0x02,0x10,0xf0,0x80,0x02,0x51,0x00,0x00,0x2c,0xfc,0x20,0x2c,0x03,0x31,0x04,
-0xef,0x80,0x2d,0x14,0x31,0xb0,0x1f,0xe3,0x69,0x01,0x41,0x6f,0xc0,0x6f,0xf4,0x88,
-0x17,0x41,0x3f,0x70,0xdf,0xfd,0xb9,0x00,0x50,0x7f,0x23,0xf5,0xff,0x20,0x90,0x10,
-0xd3,0xad,0x09,0xd0,0xdf,0x40,0x00,0x00,0xbf,0x50,0xb6,0x03,0x00,0xdf,0x40,0x1f,
-0x10,0x02,0xf4,0x01,0x00,0xa3,0x0f,0x21,0x1c,0xf9,0xe2,0x0f,0x42,0xa5,0x47,0xef,
-0xe1,0x75,0x15,0x22,0xff,0xfd,0xad,0x02,0x22,0x8c,0xdb,0xc6,0x00,0x00,0xf0,0x1d,
-0x12,0xf5,0x99,0x15,0x24,0xff,0xf6,0x08,0x00,0x42,0x11,0x10,0xcf,0xff,0x1b,0x12,
-0xa2,0xfa,0x66,0x65,0x55,0x55,0x44,0x44,0x9e,0xf7,0x00,0xff,0x00,0x06,0x08,0x00,
-0x10,0xef,0xb3,0x21,0x02,0x08,0x00,0x90,0xfc,0x00,0x7e,0xe7,0x00,0x22,0x22,0x22,
-0x21,0x08,0x00,0x02,0x20,0x00,0x06,0x10,0x00,0x02,0x20,0x00,0x12,0xe8,0x30,0x00,
-0x22,0x7f,0xe8,0x20,0x00,0x05,0x08,0x00,0xfa,0x01,0xeb,0x66,0x66,0x77,0x77,0x77,
-0x77,0xbf,0xbf,0xff,0xef,0xff,0xff,0xfe,0xdd,0xda,0x88,0x00,0x10,0x00,0x7e,0x01,
-0x34,0xbb,0xbb,0xb4,0x46,0x02,0x23,0x01,0x10,0x09,0x00,0x60,0x5a,0xef,0xff,0xe9,
-0x20,0x03,0x94,0x02,0x01,0x9a,0x1f,0xf0,0x01,0x0f,0x90,0x00,0x05,0xff,0xff,0xeb,
-0xab,0xef,0xc0,0x0f,0xfe,0x40,0x4f,0xff,0xc4,0x94,0x1b,0x52,0x0f,0x7a,0xfa,0xef,
-0xf9,0xfb,0x01,0x43,0x50,0x4e,0xff,0xb0,0x0a,0x00,0x34,0x00,0x8f,0xc3,0x0a,0x00,
-0x32,0x03,0xcf,0x80,0x0a,0x00,0x00,0xbd,0x05,0x13,0x40,0x0a,0x00,0x12,0x02,0xd5,
-0x1c,0x00,0x55,0x0c,0x13,0xc2,0x1e,0x00,0x23,0x09,0xf8,0x32,0x00,0x33,0x02,0xcf,
-0x40,0x0a,0x00,0x23,0x5f,0xff,0x0a,0x00,0x21,0x69,0xfc,0x9c,0x06,0x00,0xa4,0x06,
-0x22,0x60,0xbf,0x4d,0x14,0xb0,0x0f,0xd2,0x00,0x1d,0xff,0xfa,0x52,0x12,0x69,0x40,
-0x0a,0x16,0x1c,0x04,0x3a,0x20,0x00,0x30,0x1e,0x00,0x52,0x1b,0x01,0x6c,0x02,0x53,
-0x8a,0xa9,0x62,0x00,0x3e,0xd5,0x04,0xd0,0xf3,0x5f,0x55,0xff,0xfb,0x55,0x55,0x55,
-0x55,0xf5,0x5f,0x00,0xef,0x95,0x11,0xc0,0x12,0xe5,0x5f,0x00,0xcf,0xf7,0x00,0x04,
-0xdf,0xff,0xf5,0x5f,0xaa,0x01,0x20,0xbf,0xff,0x09,0x00,0x41,0x47,0x73,0x2d,0xff,
-0x09,0x00,0x41,0xdf,0xfa,0x00,0x6e,0x09,0x00,0xa1,0xef,0xfb,0x00,0x00,0x7c,0xcb,
-0xf5,0x5f,0x00,0xcf,0xe7,0x00,0x10,0xe5,0x2d,0x00,0x0c,0x09,0x00,0x05,0x1b,0x00,
-0x23,0xef,0xfb,0x09,0x00,0x23,0xdf,0xfa,0x09,0x00,0x23,0x58,0x83,0x09,0x00,0x24,
-0x13,0x31,0x2d,0x00,0x05,0x24,0x00,0x14,0xfc,0x12,0x00,0x03,0x09,0x00,0x03,0xab,
-0x00,0x32,0xf5,0x05,0x55,0x01,0x00,0x10,0x50,0xc5,0x00,0x42,0x9c,0xee,0xc9,0x40,
-0xcf,0x00,0x10,0xdf,0xa3,0x1a,0x12,0x40,0x60,0x02,0x51,0xaf,0x6b,0xd7,0xef,0xf8,
-0x74,0x02,0x80,0xa1,0x0f,0x6a,0xc0,0x08,0xff,0x80,0x00,0x53,0x1d,0x40,0x0f,0x6a,
-0xc0,0x00,0xa1,0x18,0x20,0xdf,0x90,0x0b,0x00,0x00,0x3e,0x08,0x10,0x05,0x87,0x08,
-0x20,0x6a,0xc0,0x68,0x13,0x00,0x3f,0x07,0x30,0x1f,0xbd,0xc0,0x58,0x22,0x20,0x0e,
-0xf3,0x8b,0x12,0x10,0x90,0x7a,0x10,0x21,0x0f,0xf1,0x6c,0x11,0x60,0x50,0x00,0x0f,
-0xf0,0x0f,0xf1,0xe4,0x20,0xf0,0x1a,0x6f,0xfa,0x10,0x0f,0xf0,0x0e,0xf2,0x00,0xbf,
-0xcf,0x41,0xfb,0x6f,0xe5,0x1f,0xe0,0x0b,0xf6,0x2d,0xf5,0x4f,0xa1,0xdf,0x72,0xbf,
-0xcf,0xb0,0x06,0xfd,0xee,0x36,0xfb,0x00,0x08,0xfc,0x26,0xff,0x60,0x00,0xef,0xd2,
-0xdd,0x03,0x30,0x3c,0xf9,0xfe,0x9d,0x1f,0x11,0xf6,0xa2,0x05,0x10,0xf6,0x46,0x05,
-0x01,0x33,0x16,0x20,0xef,0xa0,0x3c,0x03,0x62,0xfa,0x40,0x00,0x04,0xaf,0xfa,0xcb,
-0x11,0x33,0xff,0xee,0xff,0xb5,0x12,0x54,0x17,0xcf,0xff,0xfc,0x71,0x6a,0x02,0x13,
-0x22,0x62,0x06,0x22,0xac,0xb7,0x73,0x02,0x00,0xd2,0x03,0x12,0xf4,0xed,0x03,0x52,
-0xfe,0x62,0x39,0xff,0x20,0x5a,0x1d,0x04,0x02,0x1b,0xf0,0x07,0x7f,0x80,0x00,0x00,
-0x0e,0xf0,0x00,0x46,0x40,0x00,0x9f,0x40,0x00,0x00,0x0c,0xf3,0x3d,0xff,0xfd,0x20,
-0x8f,0x50,0x6c,0x21,0x50,0xef,0xff,0xff,0xe1,0x5f,0x31,0x0a,0x10,0xe9,0x71,0x06,
-0x60,0x0e,0xf9,0x00,0x02,0xdf,0x7c,0x58,0x03,0x61,0x03,0xff,0xea,0xbf,0xfb,0x0b,
-0xf7,0x24,0x51,0x2b,0xff,0xff,0xfb,0x47,0x37,0x04,0xc1,0x2d,0xff,0xed,0xff,0xfe,
-0xff,0xff,0xff,0xc0,0x02,0xef,0xa2,0xae,0x16,0x61,0xfc,0x00,0x0b,0xf8,0x00,0x4f,
-0x7c,0x01,0x51,0x40,0x2f,0xd0,0x02,0xef,0x0a,0x00,0x42,0xd0,0x7f,0x60,0x0b,0x90,
-0x01,0x42,0xf4,0xaf,0x20,0x4f,0x0a,0x00,0x43,0xf8,0xcf,0x10,0xaf,0x24,0x07,0x23,
-0xcf,0xdd,0xae,0x01,0x51,0xfb,0xaf,0xff,0xfe,0xdd,0x01,0x00,0x1a,0xd8,0x1b,0x20,
-0x03,0x76,0x20,0x04,0x99,0x22,0x04,0xc3,0x1b,0x03,0x01,0x00,0x13,0x09,0x1c,0x17,
-0x00,0xce,0x01,0x14,0xd1,0x0a,0x00,0x10,0x08,0x36,0x04,0x80,0x12,0x22,0x22,0x11,
-0x11,0x10,0x8f,0xe2,0xd9,0x13,0x02,0xc4,0x05,0x13,0x30,0x0a,0x00,0x00,0x1c,0x01,
-0x22,0x5c,0xcc,0x01,0x00,0x40,0xdc,0x30,0x01,0x22,0x01,0x00,0x00,0x2c,0x00,0x01,
-0x6a,0x18,0x01,0x88,0x28,0x25,0x00,0x1d,0x0a,0x00,0xb2,0x01,0xcf,0xfc,0xbc,0xcc,
-0xcd,0xdd,0xee,0xe6,0x00,0x00,0x1b,0x28,0x02,0x60,0x01,0x15,0xc0,0x95,0x08,0x16,
-0xfc,0x96,0x00,0x15,0xc1,0x81,0x00,0x06,0x96,0x00,0x25,0x7e,0x20,0x0f,0x04,0x04,
-0x09,0x00,0x33,0xcc,0xa7,0x30,0x0a,0x00,0x54,0x9a,0xdf,0xfe,0x91,0x00,0x25,0x04,
-0x12,0xff,0x0b,0x00,0x51,0xcb,0x96,0x10,0x18,0xfe,0xf5,0x00,0x62,0x9b,0xdf,0xfb,
-0x30,0x2c,0xf5,0x91,0x06,0x31,0x7d,0xfb,0x10,0xbe,0x05,0x52,0x98,0x40,0x00,0x6e,
-0xe1,0xd7,0x1f,0x33,0xff,0x91,0x01,0x48,0x00,0x31,0x38,0xef,0x50,0x21,0x01,0x41,
-0x8b,0xbb,0x94,0x06,0xbd,0x03,0x51,0xef,0x71,0x03,0x9f,0xc3,0x93,0x00,0x11,0xf3,
-0x12,0x15,0x00,0xcb,0x12,0x31,0x70,0x05,0x95,0xc3,0x08,0x80,0x4f,0xff,0x10,0x7f,
-0xff,0x60,0x2f,0xfe,0x25,0x02,0x01,0xb3,0x05,0x20,0xff,0x30,0x14,0x00,0x51,0xaf,
-0xff,0x80,0x2f,0xfe,0x28,0x00,0x50,0x1a,0xda,0x00,0x8f,0xf5,0x4b,0x07,0x10,0xf2,
-0x70,0x07,0x11,0x80,0xe3,0x14,0x32,0x71,0x01,0x7f,0x4c,0x05,0x59,0x28,0xdf,0xff,
-0xc7,0x10,0xa0,0x01,0x11,0x8f,0x23,0x1e,0x03,0x85,0x14,0xb0,0xfb,0x00,0x00,0xdf,
-0x31,0x11,0x11,0x44,0xef,0xa0,0x00,0x35,0x0b,0x32,0xf6,0x3f,0xfa,0x08,0x00,0x30,
-0x04,0xff,0x90,0x08,0x00,0x40,0xfa,0x66,0x9f,0xf2,0x08,0x00,0x61,0xff,0xff,0x8c,
-0xf3,0xdf,0x20,0x45,0x09,0x0f,0x08,0x00,0x3f,0x10,0xee,0x01,0x00,0x23,0xef,0xf3,
-0x62,0x02,0x18,0xe1,0xcc,0x22,0x24,0x76,0x30,0x0a,0x00,0x33,0xef,0xef,0xfd,0x99,
-0x01,0x52,0x6f,0x91,0x00,0x3c,0xf2,0xa1,0x01,0x00,0x0a,0x04,0x30,0xcd,0xce,0xb4,
-0xc1,0x01,0x10,0xe0,0x7a,0x07,0x20,0xa8,0xdf,0xa6,0x17,0x11,0xa0,0xbc,0x01,0x10,
-0x08,0xec,0x03,0x03,0x88,0x07,0x41,0xda,0x00,0x00,0x3f,0x8c,0x0a,0x41,0x45,0x00,
-0x7e,0x00,0xd3,0x2a,0xf0,0x13,0x48,0xcf,0xfe,0x00,0x6f,0x00,0x07,0xf2,0x00,0x48,
-0xcf,0xff,0xff,0xd9,0x00,0x8e,0x00,0x0d,0xa0,0x0e,0xff,0xff,0xd9,0x51,0x00,0x00,
-0xdb,0x00,0x1f,0x40,0x0a,0xc8,0x41,0x75,0x51,0x01,0x20,0x30,0x2f,0xed,0x0b,0x00,
-0x5c,0x1e,0x70,0x0d,0xb0,0x2f,0x30,0x00,0x00,0x0b,0x38,0x01,0x21,0x06,0xf1,0xc0,
-0x05,0x10,0xff,0x53,0x16,0x80,0xf2,0x0b,0xb0,0x00,0x01,0xef,0xff,0xfd,0x0b,0x00,
-0xe3,0x04,0xf4,0x00,0x01,0x44,0x44,0x44,0x10,0x00,0x06,0xf0,0x00,0xaf,0x30,0x39,
-0x0a,0x41,0xa0,0x00,0x1b,0xf9,0xb8,0x00,0x32,0x13,0xce,0x10,0xdf,0x07,0x12,0xff,
-0x6d,0x26,0x20,0x00,0x35,0xfb,0x06,0x14,0x52,0xea,0x00,0x15,0x4c,0x8b,0x02,0x26,
-0x6f,0xf2,0x0a,0x00,0x24,0x04,0x95,0x0a,0x00,0x24,0x0a,0xf7,0x0a,0x00,0x21,0x0f,
-0xf2,0x99,0x29,0x50,0x09,0xff,0xfe,0x56,0xb0,0xac,0x21,0xe0,0x91,0x8f,0xfb,0xdf,
-0xf2,0x10,0x00,0x0c,0xff,0xdf,0xf1,0xff,0x40,0x0a,0xb3,0x0d,0x41,0xd2,0x01,0x82,
-0xff,0x6c,0x15,0x20,0xdf,0x30,0x2e,0x0d,0x50,0x09,0xf9,0x00,0x03,0xfc,0x5b,0x02,
-0x60,0xfa,0xcf,0xf3,0x00,0x08,0xf7,0x03,0x03,0x00,0x8a,0x11,0x01,0x56,0x28,0x01,
-0x24,0x17,0x24,0x0e,0xf0,0x78,0x00,0x15,0x1f,0x43,0x16,0x24,0x3f,0xa0,0x0a,0x00,
-0x24,0x5f,0x80,0x0a,0x00,0x24,0x7f,0x60,0x0a,0x00,0x24,0x8f,0x50,0x0a,0x00,0x2a,
-0x9f,0x40,0xb4,0x00,0x01,0xf4,0x09,0xf0,0x04,0xcf,0xc2,0x01,0xed,0x8d,0xe1,0x5f,
-0x20,0x1f,0x56,0xf1,0x01,0xf5,0x1e,0xd8,0xde,0x10,0x3c,0xfc,0x03,0x22,0x13,0xf2,
-0x06,0x1b,0x14,0xfc,0x7f,0x03,0x13,0x70,0x11,0x00,0x0b,0xdc,0x24,0x0f,0xd6,0x22,
-0x72,0x07,0xd7,0x00,0x32,0x01,0xef,0x30,0x3a,0x04,0x03,0xc3,0x17,0x2f,0x17,0x50,
-0xb0,0x00,0x83,0x22,0x3f,0xd1,0x7b,0x04,0x22,0xec,0xeb,0x3d,0x24,0x21,0xe1,0x3f,
-0xff,0x02,0x4f,0x48,0x20,0x04,0x81,0x60,0x01,0x83,0x20,0x00,0x11,0x05,0x00,0x50,
-0x4d,0xfa,0x30,0xbe,0x00,0xf0,0x2a,0x21,0xbf,0xff,0x2b,0x1f,0x4f,0xa3,0x01,0x7a,
-0x60,0xb0,0x00,0x81,0x41,0x9f,0x50,0x08,0xf6,0x5b,0x0e,0x31,0x90,0x0c,0xfa,0x63,
-0x0d,0x3f,0x10,0x02,0x71,0x58,0x01,0x82,0x22,0x7d,0xc4,0x33,0x05,0x31,0xe3,0x5f,
-0x10,0x72,0x07,0x31,0x80,0x0c,0x50,0x67,0x03,0x32,0xc0,0x2f,0x30,0x0c,0x07,0x2f,
-0xf7,0x00,0x10,0x02,0x84,0x12,0x2f,0x8c,0x08,0x03,0x2f,0x07,0x00,0xab,0x0f,0x22,
-0x30,0x00,0xbb,0x21,0x03,0x08,0x06,0x00,0xdd,0x15,0x25,0xef,0x40,0xc0,0x07,0x35,
-0xc0,0xdf,0x50,0x4e,0x10,0x15,0x30,0x0c,0x00,0x26,0x0c,0xfa,0x43,0x27,0x81,0x6f,
-0xf1,0x00,0xbf,0xec,0xcc,0xcc,0xc4,0xc7,0x03,0x10,0x70,0x67,0x09,0x01,0x8f,0x0c,
-0x21,0x09,0xfd,0x8b,0x2c,0x02,0xb0,0x0d,0x53,0xf6,0x11,0x11,0x9f,0x80,0x77,0x10,
-0x02,0x98,0x26,0x03,0xbc,0x09,0x02,0x28,0x07,0x00,0xc5,0x0c,0x00,0xb5,0x00,0x03,
-0x4f,0x26,0x25,0xaf,0xe1,0x0c,0x00,0x11,0x04,0x07,0x12,0x10,0x6f,0x77,0x2c,0x22,
-0xc0,0x0d,0xc5,0x14,0x03,0x90,0x0b,0x0f,0xa3,0x26,0x61,0x00,0x2d,0x00,0x12,0xed,
-0x28,0x01,0x22,0x8e,0xf3,0x81,0x09,0x02,0xd1,0x01,0x21,0x5c,0xf2,0xd7,0x01,0x21,
-0xfc,0x40,0x52,0x28,0x02,0x2f,0x0f,0x11,0x30,0xd2,0x01,0x11,0xd0,0x26,0x00,0x03,
-0x4d,0x28,0x0f,0x6d,0x26,0x55,0x00,0x89,0x10,0x13,0xf8,0x1e,0x0f,0x05,0xbe,0x2c,
-0x1f,0x70,0x84,0x00,0x5d,0x21,0x0c,0xf5,0x83,0x00,0x00,0x3b,0x15,0x40,0x08,0xf5,
-0x0c,0xe1,0xd6,0x05,0x2f,0x01,0x74,0x84,0x00,0x5b,0x40,0x4f,0xb0,0x03,0xeb,0x06,
-0x23,0x8f,0x06,0xff,0x00,0x00,0x06,0x30,0x00,0x64,0x7e,0x00,0x5a,0x21,0x1d,0xf8,
+0x0f,0x00,0x31,0x00,0x0c,0xfc,0x0f,0x00,0x31,0x00,0x2f,0xf9,0x0f,0x00,0x31,0x00,
+0x7f,0xff,0x0f,0x00,0x22,0x00,0xcf,0x0f,0x00,0x13,0x02,0x0f,0x00,0xf1,0x12,0x08,
+0xff,0x10,0x00,0x00,0x6c,0xef,0xd9,0x20,0x00,0x00,0x02,0xdf,0xff,0xff,0xff,0x70,
+0x00,0x00,0xef,0xd4,0x00,0x28,0xff,0x70,0x00,0x9f,0xd1,0x00,0x00,0x06,0xff,0x20,
+0x26,0x00,0xf1,0x05,0x0c,0xf8,0x05,0xfe,0x00,0x00,0x00,0x00,0x6f,0xd0,0x7f,0xb0,
+0x00,0x00,0x00,0x03,0xff,0x09,0xfa,0x00,0xad,0x00,0x21,0x9f,0xa0,0xbc,0x00,0x13,
+0x19,0x0f,0x00,0x03,0x1e,0x00,0x04,0x2d,0x00,0x03,0x3c,0x00,0x01,0x4b,0x00,0x30,
+0x05,0xff,0x20,0x5a,0x00,0x32,0x17,0xff,0x70,0x69,0x00,0x20,0x80,0x00,0x78,0x00,
+0xf0,0x0b,0xda,0x30,0x00,0x00,0x0f,0xff,0xff,0xff,0xeb,0x50,0x00,0x0f,0xfe,0xee,
+0xee,0xff,0xfb,0x00,0x0f,0xf3,0x00,0x00,0x07,0xff,0x90,0x0f,0x0d,0x01,0x21,0x7f,
+0xf0,0x07,0x00,0x28,0x1f,0xf3,0x07,0x00,0x11,0x6f,0x15,0x00,0xa1,0x06,0xff,0xa0,
+0x0f,0xfe,0xdd,0xde,0xff,0xfc,0x10,0x3f,0x00,0x21,0x60,0x00,0x1c,0x00,0x1f,0x00,
+0x07,0x00,0x18,0x32,0x00,0x00,0x7c,0xf7,0x00,0xf0,0x07,0xef,0xff,0xff,0xff,0x60,
+0x00,0x01,0xff,0xc4,0x00,0x29,0xff,0x50,0x00,0xbf,0xc0,0x00,0x00,0x07,0xfe,0x10,
+0x1f,0x25,0x00,0x40,0x0d,0xf6,0x06,0xfd,0x29,0x00,0x21,0x8f,0xb0,0xe8,0x00,0x40,
+0x05,0xfe,0x0a,0xf8,0x0f,0x00,0x41,0x4f,0xf0,0xbf,0x80,0xe8,0x00,0x04,0x0f,0x00,
+0x03,0x1e,0x00,0x04,0x2d,0x00,0x03,0x3c,0x00,0x04,0x4b,0x00,0x92,0x01,0xff,0xc3,
+0x00,0x18,0xff,0x50,0x00,0x03,0x69,0x00,0x00,0x78,0x00,0x31,0xdf,0xfc,0x10,0x82,
+0x00,0x31,0x4e,0xfe,0x30,0x08,0x00,0x22,0x2c,0xfb,0x92,0x00,0x11,0x07,0x0d,0x01,
+0x20,0xc8,0x10,0x0d,0x01,0x31,0xef,0xff,0xf4,0xab,0x00,0x30,0x3c,0xfe,0x10,0x07,
+0x00,0x31,0x01,0xff,0x60,0xb9,0x00,0x21,0xcf,0x80,0x07,0x00,0x22,0xbf,0x80,0x15,
+0x00,0x10,0x50,0x07,0x00,0x91,0x3d,0xfd,0x00,0x0f,0xfe,0xdd,0xdf,0xff,0xd2,0x3f,
+0x00,0x11,0xfa,0xe3,0x00,0x22,0x08,0xfd,0xea,0x00,0x12,0xef,0x1b,0x01,0x21,0x7f,
+0xe0,0x07,0x00,0x32,0x0e,0xf7,0x00,0x3e,0x01,0x11,0x10,0x46,0x00,0x12,0xdf,0x4d,
+0x00,0xf0,0x0b,0x5f,0xf1,0x00,0x01,0x7c,0xff,0xea,0x30,0x00,0x00,0x3e,0xff,0xfe,
+0xff,0xf9,0x00,0x00,0xef,0xc3,0x00,0x06,0xff,0x70,0x05,0xff,0x10,0x6f,0x01,0x21,
+0x07,0xfc,0x35,0x01,0x22,0x05,0xff,0xb4,0x00,0x21,0xef,0xd3,0x07,0x00,0x31,0x2d,
+0xff,0xd8,0xbc,0x00,0x40,0x7d,0xff,0xfd,0x60,0x08,0x00,0x13,0x38,0xd4,0x00,0x31,
+0x04,0xef,0xc0,0x20,0x00,0x21,0x3f,0xf2,0xfe,0x01,0x40,0x0f,0xf4,0x0b,0xfa,0x1b,
+0x02,0xf0,0x09,0xf3,0x03,0xff,0xa2,0x00,0x04,0xdf,0xd0,0x00,0x4e,0xff,0xfd,0xff,
+0xfd,0x20,0x00,0x01,0x7c,0xef,0xec,0x70,0x00,0x6f,0xff,0x01,0x00,0xb0,0xfc,0x5e,
+0xee,0xee,0xff,0xee,0xee,0xea,0x00,0x00,0x00,0x9b,0x02,0x0f,0x07,0x00,0x4f,0x20,
+0x5f,0xe0,0xb7,0x01,0x20,0xf5,0xfe,0xaf,0x00,0x1f,0xff,0x0d,0x00,0x2e,0x20,0x3f,
+0xf0,0x96,0x02,0x10,0xe0,0xdb,0x01,0xf0,0x09,0x0c,0xf9,0x07,0xff,0x70,0x00,0x2b,
+0xff,0x20,0x09,0xff,0xfe,0xef,0xff,0x40,0x00,0x04,0xae,0xff,0xd8,0x10,0x00,0x7f,
+0xe0,0x79,0x00,0x21,0xaf,0xc1,0x82,0x00,0x21,0x0f,0xf6,0x11,0x01,0x50,0x05,0xff,
+0x10,0x5f,0xf0,0xc8,0x01,0xf0,0x00,0xa0,0x00,0xff,0x50,0x00,0x00,0x1f,0xf4,0x00,
+0x0a,0xfa,0x00,0x00,0x06,0xfe,0x4f,0x02,0x20,0x00,0x00,0x60,0x02,0xc0,0xef,0x50,
+0x00,0x1f,0xf2,0x00,0x00,0x08,0xfa,0x00,0x06,0xfc,0x42,0x01,0x40,0xf0,0x00,0xcf,
+0x60,0x00,0x02,0x91,0x50,0x1f,0xf1,0x00,0x00,0x00,0x06,0xfb,0x07,0x74,0x03,0x41,
+0x1f,0xf1,0xcf,0x50,0x5e,0x00,0x31,0x8f,0xe0,0x00,0x8e,0x00,0x11,0xf9,0xe6,0x00,
+0x22,0x0e,0xff,0x59,0x02,0x21,0x8f,0xd0,0x98,0x03,0x30,0x00,0x00,0x04,0xac,0x00,
+0x80,0x9f,0xa0,0xef,0x50,0x00,0x00,0x9f,0xf2,0x9e,0x02,0x00,0xbc,0x02,0x10,0x0d,
+0xef,0x03,0xf0,0x07,0xff,0x20,0x6f,0xc0,0x00,0x02,0xfe,0xfb,0x00,0x00,0x4f,0xe0,
+0x03,0xff,0x00,0x00,0x7f,0x8e,0xf0,0x00,0x08,0xfa,0x27,0x02,0x70,0x0b,0xf4,0xaf,
+0x40,0x00,0xbf,0x70,0x03,0x00,0x30,0xff,0x06,0xf8,0x12,0x00,0x70,0x07,0xfb,0x00,
+0x4f,0xa0,0x1f,0xd0,0x27,0x00,0x90,0x3f,0xe0,0x09,0xf6,0x00,0xdf,0x10,0x6f,0xb0,
+0x42,0x00,0xf0,0x16,0xdf,0x10,0x08,0xf6,0x0a,0xf7,0x00,0x00,0x0b,0xf6,0x2f,0xc0,
+0x00,0x4f,0xa0,0xdf,0x30,0x00,0x00,0x7f,0x96,0xf8,0x00,0x00,0xfe,0x1f,0xf0,0x00,
+0x00,0x04,0xfc,0xbf,0x30,0x00,0x0a,0xf7,0xfb,0xfd,0x00,0x70,0xee,0xe0,0x00,0x00,
+0x6f,0xdf,0x70,0xc8,0x00,0x10,0xf9,0xbf,0x02,0x11,0xf3,0x83,0x04,0x10,0x50,0x8b,
+0x00,0x02,0x4b,0x03,0x00,0xb4,0x00,0x40,0xc0,0x00,0x00,0x0d,0x2e,0x00,0x50,0x0a,
+0xfe,0x00,0x3f,0xf5,0xd4,0x00,0xf0,0x00,0x50,0x00,0x9f,0xe1,0x00,0x00,0xdf,0xa0,
+0x00,0x00,0xef,0x90,0x00,0x8f,0xf1,0x3e,0x01,0x30,0x30,0x2f,0xf6,0x22,0x00,0x31,
+0xfd,0x0c,0xfc,0x06,0x01,0x31,0xfc,0xff,0x20,0x73,0x04,0x22,0xff,0x70,0xa4,0x02,
+0x00,0x23,0x01,0x00,0xf4,0x04,0x11,0x90,0x98,0x04,0x11,0xfc,0x0e,0x01,0x50,0x0c,
+0xfd,0x0b,0xfd,0x00,0xfc,0x02,0x30,0x30,0x2f,0xf8,0x7c,0x00,0xf0,0x00,0x80,0x00,
+0x7f,0xf2,0x00,0x00,0xbf,0xe0,0x00,0x00,0xdf,0xc0,0x00,0x5f,0xf4,0xd1,0x03,0x20,
+0x70,0x1e,0x55,0x01,0x50,0x09,0xff,0x20,0x8f,0xf1,0x08,0x00,0x40,0xfe,0x01,0xef,
+0x80,0xdf,0x04,0x20,0x50,0x07,0xfc,0x02,0x91,0xaf,0xc0,0x00,0x0d,0xf8,0x00,0x00,
+0x2f,0xf4,0x31,0x03,0x20,0x0a,0xfb,0xc5,0x00,0x40,0x90,0x03,0xff,0x20,0x39,0x00,
+0x30,0x10,0xbf,0x90,0x8f,0x00,0x31,0xf9,0x3f,0xf1,0x71,0x00,0x21,0xfd,0xf7,0x80,
+0x00,0x11,0x9f,0x08,0x05,0x00,0xbb,0x03,0x02,0x79,0x04,0x22,0xf5,0x00,0x83,0x02,
+0x1f,0x50,0x0f,0x00,0x0e,0x11,0xdf,0x19,0x03,0x71,0x1b,0xee,0xee,0xee,0xee,0xff,
+0xf0,0x53,0x00,0x01,0x52,0x00,0x02,0xee,0x00,0x11,0x07,0xed,0x00,0x12,0x02,0x56,
+0x00,0x21,0xdf,0xb0,0xe8,0x01,0x11,0xe1,0x3f,0x01,0x11,0xf4,0xfc,0x01,0x01,0x03,
+0x02,0x11,0x0a,0x8d,0x04,0x11,0x05,0xfa,0x00,0x01,0xc7,0x00,0x10,0x00,0x90,0x04,
+0x00,0x24,0x01,0x11,0xf2,0x6e,0x00,0x71,0xff,0xdd,0xdd,0xdd,0xdd,0xd5,0xff,0x01,
+0x00,0xaf,0x70,0x4f,0xff,0xf2,0x4f,0xfc,0xc1,0x4f,0xe0,0x00,0x03,0x00,0x23,0x00,
+0x3c,0x00,0x40,0xff,0xf2,0x5f,0xb0,0x7d,0x00,0x01,0x39,0x01,0x10,0xf7,0xa0,0x00,
+0x01,0x81,0x00,0x20,0xcf,0x40,0x73,0x00,0x11,0xa0,0xaa,0x02,0x00,0x96,0x00,0x20,
+0xf6,0x00,0x11,0x02,0x01,0xb9,0x00,0x10,0x30,0xa2,0x01,0x10,0x90,0x1a,0x00,0x00,
+0xbb,0x02,0x20,0x0b,0xf5,0xaf,0x00,0x11,0xfb,0xbe,0x01,0x10,0x10,0x3c,0x01,0x10,
+0x70,0xf6,0x00,0x10,0xe0,0xf5,0x00,0x10,0xf4,0x34,0x00,0xaf,0x84,0xef,0xff,0x8b,
+0xce,0xf8,0x00,0xaf,0x80,0x0a,0x05,0x00,0x18,0x40,0x8b,0xce,0xf8,0xef,0x6a,0x06,
+0x11,0x66,0x30,0x01,0x10,0x20,0xdb,0x01,0x10,0x90,0x86,0x02,0xf1,0x12,0xf0,0x00,
+0x00,0x6f,0x88,0xf6,0x00,0x00,0xcf,0x22,0xfc,0x00,0x03,0xfb,0x00,0xcf,0x30,0x0a,
+0xf5,0x00,0x5f,0x90,0x1f,0xe0,0x00,0x0e,0xf1,0xbc,0xcc,0xcc,0xcc,0xcc,0x9f,0x97,
+0x04,0xf4,0x0f,0x17,0x83,0x00,0x07,0xfe,0x00,0x00,0x9f,0x90,0x00,0x0b,0xf3,0x00,
+0x3a,0xef,0xeb,0x30,0x00,0x6f,0xfe,0xce,0xff,0x50,0x2f,0xf5,0x00,0x08,0xfe,0x04,
+0xa8,0x49,0x06,0xf0,0x04,0xef,0x40,0x04,0xae,0xff,0xff,0xf4,0x09,0xff,0xca,0x88,
+0xff,0x45,0xfe,0x30,0x00,0x0e,0xf4,0xaf,0xbe,0x03,0x20,0x4b,0xf9,0x2b,0x02,0xf0,
+0x04,0x7f,0xf4,0x00,0x4e,0xff,0x50,0xdf,0xff,0xff,0xee,0xf7,0x01,0x9e,0xfe,0x91,
+0x7c,0x80,0x5f,0xd0,0x34,0x00,0x0f,0x06,0x00,0x06,0xf0,0x04,0xd1,0x9e,0xfd,0x80,
+0x00,0x5f,0xee,0xfe,0xef,0xfc,0x00,0x5f,0xfc,0x20,0x04,0xff,0x80,0x5f,0xe1,0x5c,
+0x04,0x00,0x1e,0x00,0x20,0x0f,0xf2,0x06,0x00,0x20,0x0d,0xf5,0x06,0x00,0x26,0x0c,
+0xf5,0x0c,0x00,0x23,0x0f,0xf3,0x24,0x00,0x00,0x30,0x00,0x31,0x70,0x5f,0xde,0x3c,
+0x00,0x10,0xa1,0x48,0x00,0xf2,0x0e,0x00,0x18,0xdf,0xeb,0x40,0x00,0x3e,0xff,0xde,
+0xff,0x70,0x0e,0xf9,0x00,0x06,0xff,0x36,0xfd,0x00,0x00,0x09,0xf9,0xbf,0x70,0x00,
+0x00,0x38,0x6d,0xf4,0xbb,0x00,0x00,0xa9,0x06,0x01,0x78,0x02,0x00,0x16,0x00,0x90,
+0x03,0x26,0xfd,0x00,0x00,0x08,0xf9,0x0e,0xf9,0x37,0x02,0x80,0x3e,0xff,0xce,0xff,
+0x60,0x00,0x19,0xdf,0x16,0x06,0x04,0xa0,0x00,0x2d,0x05,0xfd,0x0b,0x00,0xf0,0x08,
+0x03,0xbe,0xfc,0x65,0xfd,0x04,0xff,0xfd,0xff,0xdf,0xd1,0xef,0xb1,0x00,0x6f,0xfd,
+0x6f,0xe0,0x00,0x00,0x8f,0xdb,0xf8,0x21,0x00,0x75,0xdf,0x50,0x00,0x00,0x5f,0xde,
+0xf4,0x0b,0x00,0x20,0xda,0xf7,0x0b,0x00,0x20,0x6f,0xd0,0x1a,0x08,0xf0,0x17,0xef,
+0x70,0x00,0x3e,0xfd,0x04,0xff,0xda,0xbf,0xef,0xd0,0x03,0xbf,0xfd,0x73,0xfd,0x00,
+0x07,0xdf,0xeb,0x30,0x00,0x1d,0xff,0xde,0xff,0x50,0x0c,0xfa,0x10,0x07,0xff,0x15,
+0xfd,0x00,0x00,0x0b,0xf7,0x49,0x01,0x80,0x6f,0xbd,0xfd,0xcc,0xcc,0xcd,0xfc,0xef,
+0x92,0x01,0x12,0xdd,0xab,0x00,0x10,0x80,0xc6,0x03,0x00,0x92,0x03,0xf0,0x02,0x40,
+0x0d,0xfc,0x20,0x01,0xaf,0x60,0x2e,0xff,0xdd,0xff,0xc0,0x00,0x18,0xdf,0xfc,0x70,
+0x54,0x08,0x90,0xfe,0x40,0x00,0x9f,0xff,0xe4,0x00,0x1f,0xf7,0x3a,0x04,0x20,0x00,
+0x00,0xa0,0x02,0x91,0x04,0xff,0xff,0xff,0x90,0x3a,0xcf,0xfa,0xa6,0x07,0x05,0x00,
+0x12,0x00,0x0f,0x09,0x00,0x17,0xf5,0x0d,0x3b,0xef,0xc6,0x2f,0xd0,0x4f,0xff,0xef,
+0xfc,0xfd,0x1e,0xfb,0x10,0x06,0xff,0xd6,0xfe,0x00,0x00,0x07,0xfd,0xaf,0x90,0x00,
+0x00,0x5f,0xdd,0xf6,0xdb,0x00,0x11,0xdc,0x0b,0x00,0x01,0x16,0x00,0x02,0x21,0x00,
+0x10,0x0e,0x2c,0x00,0xa1,0xd0,0x4f,0xff,0xdf,0xfd,0xfd,0x00,0x3b,0xff,0xc6,0x33,
+0x01,0xfe,0x08,0x07,0xfc,0x03,0x10,0x00,0x00,0xcf,0x91,0xed,0x40,0x00,0x9f,0xf2,
+0x08,0xff,0xed,0xff,0xf6,0x00,0x03,0xae,0xfe,0xa3,0x5b,0x01,0x08,0x0b,0x00,0xf1,
+0x06,0x08,0xdf,0xe9,0x10,0x5f,0xdd,0xfe,0xef,0xfc,0x05,0xff,0xd3,0x00,0x5f,0xf4,
+0x5f,0xf1,0x00,0x00,0xbf,0x85,0xc8,0x01,0x00,0x21,0x00,0x21,0x8f,0x95,0xb2,0x01,
+0x0f,0x0b,0x00,0x0e,0x60,0x1e,0xd0,0x4f,0xf2,0x06,0x50,0x45,0x06,0x0f,0x02,0x00,
+0x05,0x81,0x00,0x3e,0xb0,0x00,0x7f,0xf0,0x00,0x07,0x25,0x07,0x0f,0xfa,0x03,0x18,
+0x9e,0xd0,0x00,0x9f,0xb0,0xbe,0xff,0x50,0xaf,0xd7,0xd4,0x02,0x0c,0x06,0x00,0xf0,
+0x08,0x08,0xfe,0x20,0x5f,0xd0,0x00,0x7f,0xf3,0x00,0x5f,0xd0,0x06,0xff,0x40,0x00,
+0x5f,0xd0,0x5f,0xf6,0x00,0x00,0x5f,0xd3,0xb3,0x05,0x30,0x5f,0xee,0xfd,0x24,0x00,
+0x01,0x1f,0x09,0x40,0x5f,0xfb,0x7f,0xf2,0xa3,0x07,0x20,0x0b,0xfd,0x36,0x00,0x30,
+0x01,0xef,0x90,0x3c,0x00,0x22,0x4f,0xf5,0x42,0x00,0x10,0x10,0x4e,0x00,0x5f,0xcf,
+0xc0,0x2f,0xf2,0xff,0x03,0x00,0x05,0xf0,0x1b,0x6f,0xb1,0x9e,0xfe,0x80,0x03,0xbe,
+0xfd,0x70,0x06,0xfd,0xef,0xef,0xff,0xc6,0xff,0xef,0xff,0x90,0x6f,0xfa,0x10,0x06,
+0xff,0xfa,0x10,0x08,0xff,0x16,0xfe,0x00,0x00,0x0c,0xfe,0x00,0x00,0x0e,0xf5,0x6f,
+0xc0,0x00,0x00,0xb6,0x09,0x30,0xcf,0x66,0xfc,0x4c,0x01,0x41,0x00,0x00,0x0c,0xf6,
+0x13,0x00,0x1f,0x90,0x13,0x00,0x29,0xf0,0x08,0x60,0x5f,0xb0,0x8d,0xfe,0x91,0x05,
+0xfd,0xdf,0xee,0xff,0xc0,0x5f,0xfd,0x30,0x05,0xff,0x45,0xff,0x10,0x00,0x0b,0xf8,
+0xb3,0x00,0x1f,0x9f,0xa9,0x01,0x14,0x01,0x0b,0x00,0xf0,0x06,0x90,0x00,0x17,0xdf,
+0xec,0x50,0x00,0x02,0xdf,0xfd,0xdf,0xfa,0x00,0x0c,0xfb,0x10,0x03,0xef,0x80,0x5f,
+0xe0,0x75,0x06,0x20,0xbf,0x80,0xaf,0x03,0x00,0x72,0x02,0x40,0x0a,0xf8,0xef,0x40,
+0x80,0x00,0x02,0x0c,0x00,0x02,0x18,0x00,0x00,0x7b,0x03,0x31,0x4f,0xf1,0x0d,0x30,
+0x00,0x20,0x02,0xef,0x3c,0x00,0x00,0x01,0x04,0x50,0x50,0x00,0x5f,0xa3,0xae,0x55,
+0x04,0xa1,0xef,0xda,0xbf,0xfc,0x00,0x5f,0xf8,0x00,0x02,0xef,0x85,0x04,0x17,0x7f,
+0x55,0x04,0x26,0x0e,0xf4,0x4f,0x04,0x02,0x0c,0x00,0x41,0x1f,0xf2,0x5f,0xe0,0x24,
+0x00,0x80,0xfa,0x10,0x05,0xff,0x70,0x5f,0xef,0xfd,0x55,0x04,0x11,0xd2,0x48,0x00,
+0x0f,0xe7,0x01,0x09,0x00,0x2f,0x03,0xf0,0x04,0xd6,0x3f,0xc0,0x4f,0xff,0xde,0xfd,
+0xfc,0x1e,0xfb,0x10,0x04,0xff,0xc7,0xfe,0x00,0x00,0x06,0xfc,0xa0,0x00,0x90,0x5f,
+0xcd,0xf5,0x00,0x00,0x05,0xfc,0xef,0x40,0x0b,0x00,0x00,0x2f,0x03,0x02,0x16,0x00,
+0x20,0xc6,0xfe,0x19,0x03,0xb0,0x1e,0xfa,0x00,0x05,0xff,0xc0,0x4f,0xff,0xce,0xfe,
+0xfc,0x42,0x00,0x20,0x5f,0xc0,0xfc,0x02,0x01,0x26,0x06,0x0e,0x0b,0x00,0x01,0x05,
+0x00,0x80,0x3c,0xfc,0x5f,0xef,0xfe,0xb5,0xff,0xb1,0xcb,0x09,0x11,0x05,0x29,0x02,
+0x0f,0x07,0x00,0x07,0xf0,0x03,0x00,0x5c,0xff,0xd9,0x10,0x00,0x9f,0xfe,0xdf,0xfe,
+0x20,0x3f,0xf4,0x00,0x1c,0xfc,0x06,0xfc,0xbe,0x08,0x21,0x4f,0xf2,0x4c,0x04,0x61,
+0xfb,0x73,0x00,0x00,0x00,0x6d,0xc4,0x0a,0x50,0x01,0x5a,0xff,0x90,0x11,0x35,0x04,
+0x20,0x1c,0xf7,0x19,0x01,0xf2,0x01,0x7f,0xe3,0x00,0x08,0xfe,0x00,0xbf,0xfe,0xdf,
+0xff,0x50,0x00,0x6b,0xef,0xda,0x20,0xe5,0x01,0x03,0x04,0x00,0x88,0xef,0xff,0xff,
+0xf0,0x9a,0xdf,0xda,0xa0,0x14,0x00,0x0f,0x04,0x00,0x02,0xb1,0x7f,0xc0,0x00,0x00,
+0x2f,0xfe,0xe0,0x00,0x05,0xdf,0xd0,0x28,0x02,0x11,0x96,0x37,0x02,0x0f,0x0b,0x00,
+0x13,0xf0,0x08,0x94,0xfe,0x00,0x00,0x0b,0xf9,0x1f,0xf8,0x00,0x19,0xff,0x90,0x8f,
+0xff,0xef,0xfd,0xf9,0x00,0x7d,0xff,0xb4,0x8f,0x90,0x1c,0x00,0x20,0x3f,0xf0,0x4f,
+0x07,0xf0,0x09,0x8f,0xa0,0x0b,0xf6,0x00,0x00,0xdf,0x40,0x06,0xfc,0x00,0x02,0xfe,
+0x00,0x00,0xff,0x10,0x07,0xf9,0x00,0x00,0xaf,0x60,0x0c,0xa2,0x08,0x30,0xb0,0x1f,
+0xe0,0x8e,0x07,0x00,0x61,0x07,0x40,0x09,0xf6,0xcf,0x30,0x76,0x07,0x11,0xfd,0xf4,
+0x05,0x11,0xf8,0x30,0x08,0x11,0xf2,0xa4,0x0b,0x12,0xd0,0x56,0x01,0x10,0xff,0xfd,
+0x01,0xf0,0x12,0x1f,0xf0,0x00,0x05,0xff,0x50,0x00,0x1f,0xf0,0x0c,0xf4,0x00,0x0a,
+0xff,0xa0,0x00,0x5f,0xc0,0x08,0xf8,0x00,0x0e,0xde,0xe0,0x00,0x9f,0x70,0x03,0xfc,
+0x00,0x4f,0x8a,0xf3,0xb2,0x07,0xf0,0x13,0xef,0x10,0x8f,0x35,0xf8,0x01,0xfe,0x00,
+0x00,0xaf,0x50,0xde,0x00,0xfd,0x05,0xf9,0x00,0x00,0x6f,0x92,0xf9,0x00,0xbf,0x29,
+0xf5,0x00,0x00,0x1f,0xd7,0xf4,0x00,0x6f,0x7d,0xf1,0x68,0x09,0x50,0xf0,0x00,0x1f,
+0xdf,0xc0,0xd9,0x09,0x50,0xb0,0x00,0x0c,0xff,0x70,0x20,0x09,0x31,0x60,0x00,0x07,
+0x8a,0x08,0x21,0xff,0x10,0xaa,0x00,0xf0,0x02,0x1f,0xf6,0x00,0x00,0x9f,0xd0,0x06,
+0xfe,0x10,0x03,0xff,0x40,0x00,0xcf,0x90,0x0c,0xf9,0x22,0x0c,0x20,0x6f,0xe1,0x0b,
+0x02,0x11,0xef,0xff,0x08,0x11,0xfb,0xaa,0x08,0x02,0xa5,0x06,0x10,0xfc,0x52,0x08,
+0x30,0xfb,0xdf,0x70,0x54,0x0c,0x20,0x3f,0xf2,0xb5,0x0c,0x50,0x0a,0xfb,0x00,0x08,
+0xfd,0x57,0x09,0x80,0x3f,0xf4,0x00,0x00,0x7f,0xf1,0x8f,0xc0,0x00,0x07,0x20,0x3f,
+0xf1,0x1b,0x06,0xb0,0x0d,0xf7,0x00,0x00,0xff,0x30,0x07,0xfc,0x00,0x05,0xfd,0x27,
+0x0f,0x00,0xe6,0x0a,0xa0,0xcf,0x70,0x0e,0xf2,0x00,0x00,0x6f,0xc0,0x4f,0xd0,0x85,
+0x08,0x20,0x9f,0x70,0x5a,0x06,0x20,0xdf,0x20,0xb1,0x0d,0x11,0xfc,0x70,0x09,0x11,
+0xf7,0x40,0x0b,0x15,0xf1,0x63,0x02,0x35,0x00,0x8f,0x60,0x86,0x08,0x21,0x1a,0xf9,
+0x2c,0x09,0x10,0xe1,0xda,0x08,0x23,0xfb,0x20,0x99,0x09,0x70,0xfc,0x0a,0xcc,0xcc,
+0xcc,0xff,0xa0,0xbf,0x08,0x10,0xe1,0x46,0x01,0x00,0x96,0x06,0x23,0x1e,0xf9,0x74,
+0x09,0x00,0x34,0x0f,0x04,0x9d,0x09,0x00,0xb2,0x0a,0x01,0xbb,0x0a,0x31,0x00,0x5f,
+0xf3,0x95,0x0b,0xa0,0xcc,0xcc,0xcc,0xc1,0xff,0xff,0xff,0xff,0xff,0x10,0xf6,0x0c,
+0x00,0x00,0x00,0x12,0x00,0x00,0x09,0xfb,0x00,0x00,0xaf,0xc2,0x00,0x03,0xfe,0x10,
+0x00,0x08,0xf9,0x00,0x00,0x0b,0xf7,0x00,0x00,0x0c,0xf6,0x04,0x00,0xf6,0x0b,0x0e,
+0xf4,0x00,0x00,0x6f,0xe0,0x00,0x2d,0xff,0x40,0x00,0x4f,0xfd,0x10,0x00,0x02,0xaf,
+0xc0,0x00,0x00,0x0f,0xf3,0x00,0x00,0x0d,0xf5,0x24,0x00,0xfe,0x0a,0x0b,0xf6,0x00,
+0x00,0x0a,0xf8,0x00,0x00,0x06,0xfd,0x00,0x00,0x00,0xdf,0x80,0x00,0x00,0x2d,0xfa,
+0x00,0x00,0x00,0x65,0xfc,0xfc,0x01,0x00,0xb0,0x76,0x22,0x00,0x00,0x00,0x9f,0x90,
+0x00,0x00,0x1b,0xfb,0x2c,0x00,0x96,0x50,0x00,0x00,0x8f,0xa0,0x00,0x00,0x5f,0xd0,
+0x04,0x00,0xf2,0x0b,0x4f,0xe0,0x00,0x00,0x3f,0xf0,0x00,0x00,0x0d,0xf8,0x00,0x00,
+0x03,0xef,0xd4,0x00,0x00,0xaf,0xf5,0x00,0x0a,0xfb,0x20,0x00,0x1f,0xf1,0x1c,0x00,
+0x08,0x2c,0x00,0xf0,0x27,0x7f,0xb0,0x00,0x00,0xcf,0x70,0x00,0x07,0xfe,0x10,0x00,
+0x9f,0xd2,0x00,0x00,0x45,0x00,0x00,0x00,0x00,0x6c,0xeb,0x30,0x00,0x00,0x97,0x07,
+0xff,0xff,0xf6,0x00,0x02,0xfa,0x1f,0xf4,0x16,0xff,0x90,0x1b,0xf5,0x5f,0x90,0x00,
+0x4e,0xff,0xff,0xc0,0x49,0x40,0x00,0x02,0xaf,0xf9,0x10,0x26,0x00,0x33,0x02,0x20,
+0x00,0x01,0x00,0x24,0x0a,0xa0,0x0a,0x00,0x24,0x3f,0xf3,0x0a,0x00,0x23,0xbf,0xfb,
+0x09,0x00,0x42,0x03,0xff,0xff,0x30,0x0a,0x00,0x42,0x0c,0xff,0xff,0xc0,0x0a,0x00,
+0x42,0x4f,0xf9,0x9f,0xf4,0x0a,0x00,0x41,0xdf,0xf1,0x1f,0xfd,0x09,0x00,0x60,0x05,
+0xff,0x70,0x08,0xff,0x50,0x0a,0x00,0x60,0x0d,0xfe,0x00,0x00,0xef,0xd0,0x0a,0x00,
+0x22,0x6f,0xf6,0x04,0x00,0x02,0x10,0x00,0x81,0x0e,0xfe,0x00,0x00,0x00,0x07,0xff,
+0x50,0x2c,0x00,0x41,0x00,0x00,0x0e,0xfd,0x40,0x00,0x51,0xe0,0x00,0x00,0x8f,0xf4,
+0x54,0x00,0x52,0xf8,0x00,0x01,0xff,0xc0,0x68,0x00,0xd3,0x10,0x09,0xff,0xdc,0xcc,
+0xcc,0xcc,0xcc,0xcd,0xff,0x90,0x1f,0xff,0x01,0x00,0x24,0xf1,0xaf,0x0a,0x00,0x12,
+0xfa,0x7b,0x00,0x32,0x29,0xcc,0x70,0x09,0x00,0x42,0x04,0xff,0xff,0xfc,0x0a,0x00,
+0xf0,0x07,0x0e,0xfb,0x46,0xef,0x80,0x00,0x00,0x00,0x38,0xb5,0x6f,0xe0,0x00,0x5f,
+0xe0,0x00,0x00,0x2b,0xff,0xfa,0x9f,0xb0,0x4c,0x01,0xf0,0x11,0x03,0xef,0xfb,0x60,
+0xcf,0xe1,0x00,0x7f,0xd0,0x00,0x2f,0xfc,0x20,0x00,0xef,0xfe,0x89,0xff,0x50,0x00,
+0xcf,0xc0,0x00,0x01,0xff,0xff,0xff,0xf8,0x00,0x05,0xff,0x20,0x45,0x00,0x50,0xff,
+0x54,0x00,0x0b,0xfa,0xa3,0x00,0x40,0xff,0xc2,0x5f,0xa0,0xf5,0x01,0x80,0x0a,0xff,
+0xf8,0x00,0x4f,0xe0,0x0f,0xf2,0xd4,0x00,0xe0,0x40,0x00,0x1f,0xf0,0x0f,0xf1,0x00,
+0x00,0x0f,0xc1,0x00,0x00,0x1f,0xf0,0x1e,0x00,0x20,0x28,0x00,0x8e,0x01,0x22,0x09,
+0xf9,0x7b,0x00,0x51,0x9f,0x90,0x04,0xff,0x20,0x57,0x01,0x20,0xff,0x40,0x5a,0x00,
+0x00,0x09,0x01,0xc0,0xfc,0x00,0x00,0x2e,0xfd,0x30,0x00,0x00,0x03,0xdf,0xe2,0x00,
+0x82,0x00,0x40,0x75,0x57,0xbf,0xfe,0x4c,0x01,0x10,0x1a,0xc6,0x00,0x11,0xa1,0x37,
+0x00,0x42,0x27,0xbd,0xcb,0x72,0x41,0x00,0x52,0x59,0x99,0x99,0x99,0x81,0x0b,0x00,
+0x50,0x1e,0xff,0xff,0xff,0xa0,0xa4,0x01,0x90,0x01,0xb5,0x04,0xff,0xff,0xfe,0x01,
+0xec,0x10,0x8c,0x00,0x50,0x50,0x7f,0xff,0xf4,0x0d,0x8c,0x01,0xf2,0x14,0x21,0xdf,
+0x60,0x0a,0xff,0x90,0x07,0xf5,0x56,0x00,0x01,0xfd,0x85,0x00,0x00,0xdd,0x00,0x00,
+0x3d,0xff,0x10,0x06,0xff,0xd0,0x00,0x00,0x23,0x00,0x00,0x0d,0xfb,0x10,0x00,0x4b,
+0x50,0xba,0x01,0x42,0x75,0x50,0x0d,0xed,0x52,0x00,0x53,0x01,0xff,0xf0,0x0f,0xff,
+0xd1,0x01,0x43,0xff,0xd0,0x06,0x78,0x0b,0x00,0x53,0x84,0x00,0x05,0xcf,0x40,0xe6,
+0x01,0x42,0xd0,0x09,0xff,0x80,0x4f,0x01,0x51,0xef,0xa0,0x03,0xa6,0x92,0x0b,0x00,
+0x62,0x2d,0x42,0x10,0x00,0x1b,0xfd,0x10,0x02,0xf0,0x07,0xf7,0x00,0x00,0x2f,0xfb,
+0x83,0x00,0x00,0x00,0x3c,0x5d,0xf3,0x00,0x00,0x06,0x73,0xff,0x66,0x32,0x65,0xef,
+0xc0,0xcf,0x00,0x71,0x0b,0xfe,0x7f,0xf8,0xfd,0x6f,0xf2,0xfd,0x00,0x53,0xc5,0x9f,
+0xc5,0xff,0x18,0x59,0x02,0x32,0x5b,0x81,0xb8,0x09,0x00,0x15,0x2a,0x6a,0x02,0x61,
+0x02,0xef,0xe4,0x6b,0xde,0xda,0x9f,0x00,0x11,0x1d,0xcc,0x01,0xf0,0x1e,0xfe,0x70,
+0x00,0x00,0x01,0xdf,0xd1,0xbf,0xfa,0x33,0x47,0xcf,0xfb,0x10,0x00,0x0c,0xfd,0x10,
+0x0b,0xff,0x50,0x00,0x05,0xff,0xc0,0x00,0x0e,0xfc,0x10,0x00,0xaf,0xf6,0x00,0x00,
+0x2e,0xf9,0x00,0x02,0xef,0xd1,0x00,0x09,0xff,0x40,0x00,0x62,0x01,0x40,0xaf,0xfd,
+0x10,0x05,0x44,0x02,0x80,0xaf,0x90,0x00,0xff,0xef,0xd2,0x4f,0xfa,0xb5,0x02,0xf1,
+0x02,0xe0,0x03,0xfe,0x1d,0xfe,0xff,0xb0,0x00,0x00,0x00,0x0f,0xf1,0x04,0xfc,0x01,
+0xdf,0xfb,0x0c,0x02,0x62,0xf3,0x04,0xfd,0x00,0x1b,0xb0,0x0b,0x00,0x23,0x02,0xfe,
+0x81,0x00,0x53,0x0f,0xf1,0x00,0xef,0x20,0xec,0x02,0x11,0xd0,0x86,0x03,0x21,0x00,
+0x00,0x4d,0x00,0x11,0x2f,0xc0,0x00,0x01,0x63,0x00,0x21,0x09,0xfd,0x20,0x03,0x20,
+0x2e,0xf8,0xa0,0x02,0x11,0xe4,0xdc,0x02,0x00,0xd0,0x01,0x62,0x1b,0xff,0xc7,0x54,
+0x58,0xdf,0x17,0x03,0x10,0x7e,0xbb,0x00,0x13,0x60,0xb9,0x01,0x22,0xcd,0xc9,0x70,
+0x01,0xa1,0x09,0x99,0x98,0x88,0x88,0x88,0x85,0x00,0x00,0x5f,0xdb,0x00,0xc0,0xf6,
+0x00,0x00,0xaf,0xff,0xff,0xee,0xee,0xef,0xf0,0x00,0x00,0x04,0x00,0x70,0x00,0x8f,
+0x90,0x00,0x04,0xff,0x90,0x0e,0x03,0x30,0x30,0x00,0x09,0xc9,0x01,0x72,0x06,0xfc,
+0x00,0x00,0x0e,0xfc,0x00,0x42,0x04,0x20,0x0f,0xfa,0x46,0x02,0x10,0xf0,0x80,0x02,
+0x51,0x00,0x00,0x2c,0xfc,0x20,0x2c,0x03,0x11,0x04,0xcf,0x02,0x51,0xcf,0xff,0xb0,
+0x1f,0xe3,0x69,0x01,0x40,0x6f,0xc0,0x6f,0xf4,0x77,0x02,0x51,0xf2,0x3f,0x70,0xdf,
+0xfd,0xb9,0x00,0x30,0x7f,0x23,0xf5,0x78,0x02,0xf2,0x01,0xcf,0x50,0xad,0x09,0xd0,
+0xdf,0x40,0x00,0x00,0xbf,0x50,0xb6,0x03,0x00,0xdf,0x30,0x55,0x04,0x10,0x02,0xf4,
+0x01,0x50,0x2f,0xf6,0x00,0x00,0x1c,0xa6,0x02,0x70,0x08,0xff,0xa5,0x47,0xef,0xe1,
+0x00,0x8a,0x00,0x32,0xff,0xff,0xfd,0xad,0x02,0x23,0x8c,0xdb,0xc6,0x00,0x50,0x1f,
+0xff,0xff,0xf5,0x00,0x2e,0x00,0x01,0xb9,0x00,0x02,0x08,0x00,0x32,0x11,0x10,0xcf,
+0x72,0x03,0xb2,0xfc,0xfa,0x66,0x65,0x55,0x55,0x44,0x44,0x9e,0xf7,0x00,0xff,0x00,
+0x06,0x08,0x00,0x43,0xef,0xff,0xff,0xfb,0x08,0x00,0x90,0xfc,0x00,0x7e,0xe7,0x00,
+0x22,0x22,0x22,0x21,0x08,0x00,0x02,0x20,0x00,0x06,0x10,0x00,0x02,0x20,0x00,0x12,
+0xe8,0x30,0x00,0x22,0x7f,0xe8,0x20,0x00,0x05,0x08,0x00,0xfa,0x01,0xeb,0x66,0x66,
+0x77,0x77,0x77,0x77,0xbf,0xbf,0xff,0xef,0xff,0xff,0xfe,0xdd,0xda,0x88,0x00,0x10,
+0x00,0x7e,0x01,0x34,0xbb,0xbb,0xb4,0x46,0x02,0x23,0x01,0x10,0x09,0x00,0x60,0x5a,
+0xef,0xff,0xe9,0x20,0x03,0x94,0x02,0x00,0xa6,0x00,0xf2,0x0b,0xf0,0x0f,0x90,0x00,
+0x05,0xff,0xff,0xeb,0xab,0xef,0xc0,0x0f,0xfe,0x40,0x4f,0xff,0xc4,0x00,0x00,0x02,
+0x00,0x0f,0x7a,0xfa,0xef,0xf9,0xfb,0x01,0x43,0x50,0x4e,0xff,0xb0,0x0a,0x00,0x34,
+0x00,0x8f,0xc3,0x0a,0x00,0x32,0x03,0xcf,0x80,0x0a,0x00,0x00,0xbd,0x05,0x13,0x40,
+0x0a,0x00,0x33,0x02,0xdf,0x50,0x0a,0x00,0x23,0x5f,0xc2,0x1e,0x00,0x23,0x09,0xf8,
+0x32,0x00,0x33,0x02,0xcf,0x40,0x0a,0x00,0x23,0x5f,0xff,0x0a,0x00,0x42,0x69,0xfc,
+0xff,0xe1,0x0a,0x00,0x22,0xff,0x60,0xe3,0x03,0xf1,0x01,0x00,0x0f,0xd2,0x00,0x1d,
+0xff,0xfa,0x52,0x12,0x69,0x40,0x0a,0x00,0x00,0x01,0xbf,0xa0,0x00,0x01,0x28,0x05,
+0x52,0xdf,0xff,0xff,0xff,0x90,0x6c,0x02,0x53,0x8a,0xa9,0x62,0x00,0x3e,0xd5,0x04,
+0xc0,0xf3,0x5f,0x55,0xff,0xfb,0x55,0x55,0x55,0x55,0xf5,0x5f,0x00,0xb1,0x00,0xd0,
+0x01,0x12,0xe5,0x5f,0x00,0xcf,0xf7,0x00,0x04,0xdf,0xff,0xf5,0x5f,0xaa,0x01,0x20,
+0xbf,0xff,0x09,0x00,0x41,0x47,0x73,0x2d,0xff,0x09,0x00,0x41,0xdf,0xfa,0x00,0x6e,
+0x09,0x00,0xa1,0xef,0xfb,0x00,0x00,0x7c,0xcb,0xf5,0x5f,0x00,0xcf,0xe7,0x00,0x10,
+0xe5,0x2d,0x00,0x0c,0x09,0x00,0x05,0x1b,0x00,0x23,0xef,0xfb,0x09,0x00,0x23,0xdf,
+0xfa,0x09,0x00,0x23,0x58,0x83,0x09,0x00,0x24,0x13,0x31,0x2d,0x00,0x05,0x24,0x00,
+0x14,0xfc,0x12,0x00,0x03,0x09,0x00,0x03,0xab,0x00,0x32,0xf5,0x05,0x55,0x01,0x00,
+0x10,0x50,0xc5,0x00,0x42,0x9c,0xee,0xc9,0x40,0xcf,0x00,0x00,0xda,0x00,0x22,0xfd,
+0x40,0x60,0x02,0x51,0xaf,0x6b,0xd7,0xef,0xf8,0x74,0x02,0x50,0xa1,0x0f,0x6a,0xc0,
+0x08,0x5b,0x04,0xd1,0x5f,0xf7,0x00,0x0f,0x6a,0xc0,0x00,0x6f,0xf5,0x00,0x00,0xdf,
+0x90,0x0b,0x00,0xe0,0x08,0xfd,0x00,0x05,0xfe,0x00,0x00,0x1f,0x6a,0xc0,0x00,0x00,
+0xef,0x50,0x3f,0x07,0x80,0x1f,0xbd,0xc0,0x00,0x00,0x7f,0xa0,0x0e,0x5e,0x07,0x00,
+0x26,0x01,0x50,0x2f,0xe0,0x0f,0xf1,0x00,0x37,0x06,0x30,0x50,0x00,0x0f,0x7f,0x05,
+0xf0,0x1d,0x09,0xf6,0x00,0x6f,0xfa,0x10,0x0f,0xf0,0x0e,0xf2,0x00,0xbf,0xcf,0x41,
+0xfb,0x6f,0xe5,0x1f,0xe0,0x0b,0xf6,0x2d,0xf5,0x4f,0xa1,0xdf,0x72,0xbf,0xcf,0xb0,
+0x06,0xfd,0xee,0x36,0xfb,0x00,0x08,0xfc,0x26,0xff,0x60,0x00,0xef,0xd2,0xdd,0x03,
+0x81,0x3c,0xf9,0xfe,0x00,0x00,0x6f,0xeb,0xf6,0xa2,0x05,0x00,0xa3,0x07,0x01,0xe4,
+0x04,0x30,0x03,0xef,0xa0,0x3c,0x03,0x50,0xfa,0x40,0x00,0x04,0xaf,0x08,0x01,0x00,
+0xf3,0x05,0x32,0xee,0xff,0xff,0x4f,0x06,0x54,0x17,0xcf,0xff,0xfc,0x71,0x6a,0x02,
+0x13,0x22,0x62,0x06,0x22,0xac,0xb7,0x73,0x02,0x00,0xd2,0x03,0x12,0xf4,0xed,0x03,
+0x32,0xfe,0x62,0x39,0xf1,0x05,0x00,0x3a,0x04,0x21,0x8f,0xb0,0xc7,0x02,0xf0,0x14,
+0x80,0x00,0x00,0x0e,0xf0,0x00,0x46,0x40,0x00,0x9f,0x40,0x00,0x00,0x0c,0xf3,0x3d,
+0xff,0xfd,0x20,0x8f,0x50,0x00,0x00,0x0d,0xf4,0xef,0xff,0xff,0xe1,0x5f,0xc0,0x00,
+0x00,0x3f,0xe9,0x71,0x06,0x60,0x0e,0xf9,0x00,0x02,0xdf,0x7c,0x58,0x03,0x70,0x03,
+0xff,0xea,0xbf,0xfb,0x0b,0xff,0x14,0x03,0x51,0x2b,0xff,0xff,0xfb,0x47,0x37,0x04,
+0xe0,0x2d,0xff,0xed,0xff,0xfe,0xff,0xff,0xff,0xc0,0x02,0xef,0xa2,0x03,0xef,0x27,
+0x00,0x51,0x00,0x0b,0xf8,0x00,0x4f,0x7c,0x01,0x51,0x40,0x2f,0xd0,0x02,0xef,0x0a,
+0x00,0x42,0xd0,0x7f,0x60,0x0b,0x90,0x01,0x42,0xf4,0xaf,0x20,0x4f,0x0a,0x00,0x43,
+0xf8,0xcf,0x10,0xaf,0x24,0x07,0x23,0xcf,0xdd,0xae,0x01,0x51,0xfb,0xaf,0xff,0xfe,
+0xdd,0x01,0x00,0x29,0xd8,0x00,0x01,0x00,0x14,0x40,0x09,0x00,0x25,0x04,0xfb,0x14,
+0x00,0x24,0x9f,0xb0,0x0a,0x00,0x34,0x09,0xfc,0x10,0x0b,0x00,0x24,0x8f,0xd1,0x0a,
+0x00,0x10,0x08,0x36,0x04,0xc2,0x12,0x22,0x22,0x11,0x11,0x10,0x8f,0xe2,0x00,0x00,
+0x7f,0xff,0xc4,0x05,0x13,0x30,0x0a,0x00,0x00,0x1c,0x01,0x22,0x5c,0xcc,0x01,0x00,
+0x40,0xdc,0x30,0x01,0x22,0x01,0x00,0x00,0x2c,0x00,0x23,0x02,0xdf,0x1f,0x00,0x35,
+0xf7,0x00,0x1d,0x0a,0x00,0xd5,0x01,0xcf,0xfc,0xbc,0xcc,0xcd,0xdd,0xee,0xe6,0x00,
+0x00,0x0b,0xfc,0x81,0x00,0x25,0xaf,0xc0,0x95,0x08,0x16,0xfc,0x96,0x00,0x15,0xc1,
+0x81,0x00,0x06,0x96,0x00,0x25,0x7e,0x20,0x0f,0x04,0x04,0x09,0x00,0x33,0xcc,0xa7,
+0x30,0x0a,0x00,0x54,0x9a,0xdf,0xfe,0x91,0x00,0x25,0x04,0x12,0xff,0x0b,0x00,0x51,
+0xcb,0x96,0x10,0x18,0xfe,0xf5,0x00,0x62,0x9b,0xdf,0xfb,0x30,0x2c,0xf5,0x91,0x06,
+0x31,0x7d,0xfb,0x10,0xbe,0x05,0x42,0x98,0x40,0x00,0x6e,0xc4,0x03,0x43,0xcf,0xff,
+0x91,0x01,0x48,0x00,0x31,0x38,0xef,0x50,0x21,0x01,0x41,0x8b,0xbb,0x94,0x06,0xbd,
+0x03,0x51,0xef,0x71,0x03,0x9f,0xc3,0x93,0x00,0x40,0xf3,0x00,0x00,0x04,0x88,0x06,
+0x51,0x09,0xff,0x70,0x05,0x95,0xc3,0x08,0x80,0x4f,0xff,0x10,0x7f,0xff,0x60,0x2f,
+0xfe,0x25,0x02,0x01,0xb3,0x05,0x20,0xff,0x30,0x14,0x00,0x51,0xaf,0xff,0x80,0x2f,
+0xfe,0x28,0x00,0x50,0x1a,0xda,0x00,0x8f,0xf5,0x4b,0x07,0x10,0xf2,0x70,0x07,0x20,
+0x80,0x00,0x15,0x00,0x32,0x71,0x01,0x7f,0x4c,0x05,0x59,0x28,0xdf,0xff,0xc7,0x10,
+0xa0,0x01,0x20,0x8f,0xff,0x07,0x08,0x41,0x00,0x00,0xdf,0xff,0x20,0x02,0xf2,0x01,
+0x00,0xdf,0x31,0x11,0x11,0x44,0xef,0xa0,0x00,0xdf,0x20,0x00,0x00,0xf6,0x3f,0xfa,
+0x08,0x00,0x30,0x04,0xff,0x90,0x08,0x00,0x40,0xfa,0x66,0x9f,0xf2,0x08,0x00,0x61,
+0xff,0xff,0x8c,0xf3,0xdf,0x20,0x45,0x09,0x0f,0x08,0x00,0x3f,0x10,0xee,0x01,0x00,
+0x23,0xef,0xf3,0x62,0x02,0x17,0xe1,0xab,0x00,0x34,0x05,0x76,0x30,0x0a,0x00,0x33,
+0xef,0xef,0xfd,0x99,0x01,0x52,0x6f,0x91,0x00,0x3c,0xf2,0xa1,0x01,0x00,0x0a,0x04,
+0x30,0xcd,0xce,0xb4,0xc1,0x01,0x10,0xe0,0x7a,0x07,0x71,0xa8,0xdf,0x60,0x00,0x00,
+0x0c,0xa0,0xbc,0x01,0x10,0x08,0xec,0x03,0x03,0x88,0x07,0x41,0xda,0x00,0x00,0x3f,
+0x8c,0x0a,0xf0,0x1c,0x45,0x00,0x7e,0x00,0x00,0xec,0x00,0x00,0x00,0x48,0xcf,0xfe,
+0x00,0x6f,0x00,0x07,0xf2,0x00,0x48,0xcf,0xff,0xff,0xd9,0x00,0x8e,0x00,0x0d,0xa0,
+0x0e,0xff,0xff,0xd9,0x51,0x00,0x00,0xdb,0x00,0x1f,0x40,0x0a,0xc8,0x41,0x75,0x51,
+0x01,0xf0,0x02,0x30,0x2f,0x20,0x00,0x00,0x02,0xfe,0x10,0x00,0x00,0x0d,0xb0,0x2f,
+0x30,0x00,0x00,0x0b,0x38,0x01,0x21,0x06,0xf1,0xc0,0x05,0x00,0xb0,0x03,0x90,0x03,
+0xf2,0x0b,0xb0,0x00,0x01,0xef,0xff,0xfd,0x0b,0x00,0xe3,0x04,0xf4,0x00,0x01,0x44,
+0x44,0x44,0x10,0x00,0x06,0xf0,0x00,0xaf,0x30,0x39,0x0a,0x41,0xa0,0x00,0x1b,0xf9,
+0xb8,0x00,0x31,0x13,0xce,0x10,0xdf,0x07,0x00,0x01,0x00,0x10,0xb2,0x11,0x00,0x10,
+0x35,0xfb,0x06,0x14,0x52,0xea,0x00,0x15,0x4c,0x8b,0x02,0x26,0x6f,0xf2,0x0a,0x00,
+0x24,0x04,0x95,0x0a,0x00,0x24,0x0a,0xf7,0x0a,0x00,0x10,0x0f,0x20,0x00,0xf1,0x16,
+0x10,0x00,0x09,0xff,0xfe,0x56,0xb0,0x00,0x00,0x9f,0xff,0x91,0x8f,0xfb,0xdf,0xf2,
+0x10,0x00,0x0c,0xff,0xdf,0xf1,0xff,0x40,0x0a,0xf9,0x00,0x00,0x6f,0xd2,0x01,0x82,
+0xff,0x00,0x05,0xfb,0x00,0xaf,0x07,0x70,0xff,0x30,0x09,0xf9,0x00,0x03,0xfc,0x5b,
+0x02,0x70,0xfa,0xcf,0xf3,0x00,0x08,0xf7,0x00,0xae,0x04,0x51,0xff,0x60,0x00,0x0b,
+0xf2,0x5b,0x04,0x11,0xf2,0x5b,0x04,0x03,0x78,0x00,0x24,0x1f,0xc0,0x0a,0x00,0x24,
+0x3f,0xa0,0x0a,0x00,0x24,0x5f,0x80,0x0a,0x00,0x24,0x7f,0x60,0x0a,0x00,0x24,0x8f,
+0x50,0x0a,0x00,0x2a,0x9f,0x40,0xb4,0x00,0x01,0xf4,0x09,0xf3,0x08,0xcf,0xc2,0x01,
+0xed,0x8d,0xe1,0x5f,0x20,0x1f,0x56,0xf1,0x01,0xf5,0x1e,0xd8,0xde,0x10,0x3c,0xfc,
+0x30,0x00,0x00,0x5f,0x25,0x00,0x24,0x07,0xfc,0x7f,0x03,0x13,0x70,0x11,0x00,0x1a,
+0x70,0x41,0x04,0x23,0x5f,0xf0,0x2b,0x0c,0x13,0xf6,0x64,0x0a,0x12,0xfc,0xa4,0x03,
+0x12,0xf9,0x62,0x09,0x51,0x0d,0xf3,0x9f,0x80,0x00,0x24,0x0b,0x21,0x3f,0xe0,0xdb,
+0x03,0x31,0x80,0x0d,0xf4,0x27,0x00,0x41,0x20,0x08,0xfb,0x00,0x2a,0x0d,0x71,0x02,
+0xff,0x10,0x00,0x00,0x0c,0xf7,0xc1,0x0c,0x40,0x00,0x2f,0xf1,0x00,0x9f,0x0b,0x21,
+0x00,0x9f,0x0e,0x07,0xb1,0x00,0x00,0xef,0xed,0xdd,0xdd,0xdf,0xf9,0x00,0x05,0xff,
+0x81,0x09,0x31,0x00,0x0b,0xf9,0x48,0x0c,0x31,0x60,0x1f,0xf3,0x1c,0x03,0x34,0xc0,
+0x7f,0xd0,0x7c,0x05,0x05,0xd7,0x00,0x32,0x01,0xef,0x30,0x3a,0x04,0x22,0xf5,0x00,
+0xca,0x05,0x1f,0x50,0xb0,0x00,0x83,0x22,0x3f,0xd1,0x7b,0x04,0x31,0xec,0xeb,0x00,
+0x09,0x0b,0x21,0xe1,0x3f,0xff,0x02,0x4f,0x48,0x20,0x04,0x81,0x60,0x01,0x83,0x20,
+0x00,0x11,0x05,0x00,0x40,0x4d,0xfa,0x30,0xbe,0x08,0x00,0x40,0xee,0xbf,0xff,0xf9,
+0xbf,0x00,0x4f,0xa3,0x01,0x7a,0x60,0xb0,0x00,0x7a,0x50,0x00,0x00,0x00,0x2f,0xf2,
+0xe0,0x00,0x00,0x9f,0x50,0x08,0xf6,0x00,0x00,0x00,0x00,0xdf,0x90,0x0c,0xfa,0x08,
+0x00,0x58,0x27,0x10,0x02,0x71,0x00,0x01,0x00,0x22,0x5f,0xf0,0x08,0x00,0x21,0xbf,
+0xf6,0x07,0x00,0x31,0x01,0xff,0xfc,0x08,0x00,0x40,0x08,0xf9,0xef,0x20,0x08,0x00,
+0x40,0x0d,0xf3,0x9f,0x80,0x08,0x00,0x40,0x4f,0xe0,0x3f,0xe0,0x08,0x00,0x41,0xaf,
+0x80,0x0d,0xf4,0x27,0x00,0xf0,0x22,0x20,0x08,0xfb,0x00,0x00,0x00,0x06,0xfd,0x00,
+0x02,0xff,0x10,0x00,0x00,0x0c,0xf7,0x00,0x00,0xcf,0x70,0x00,0x00,0x2f,0xf1,0x00,
+0x00,0x7f,0xd0,0x00,0x00,0x9f,0xff,0xff,0xff,0xff,0xf3,0x00,0x00,0xef,0xed,0xdd,
+0xdd,0xdf,0xf9,0x00,0x05,0xff,0x00,0x00,0x05,0x00,0x20,0x0b,0xf9,0x44,0x00,0x40,
+0xef,0x60,0x1f,0xf3,0x08,0x00,0x40,0x8f,0xc0,0x7f,0xd0,0x08,0x00,0x71,0x2f,0xf2,
+0x00,0x00,0x00,0x7d,0xc4,0x78,0x00,0x40,0x05,0xe3,0x5f,0x10,0x08,0x00,0x40,0x09,
+0x80,0x0c,0x50,0x08,0x00,0x51,0x07,0xc0,0x2f,0x30,0x00,0x79,0x00,0x2f,0xf7,0x00,
+0xb8,0x00,0x81,0x00,0x07,0x00,0x10,0xff,0x01,0x00,0x11,0x40,0x0c,0x00,0x71,0xcf,
+0xff,0xdc,0xcc,0xcc,0xcc,0x30,0xca,0x00,0x34,0xfe,0xff,0x30,0xad,0x00,0x44,0x0e,
+0xf5,0xef,0x40,0x0c,0x00,0x43,0x9f,0xc0,0xdf,0x50,0x0b,0x00,0x35,0x03,0xff,0x30,
+0x0c,0x00,0x53,0x0c,0xfa,0x00,0xcf,0x60,0x0c,0x00,0x80,0x6f,0xf1,0x00,0xbf,0xec,
+0xcc,0xcc,0xc4,0xb1,0x00,0x80,0xef,0x70,0x00,0xaf,0xff,0xff,0xff,0xf5,0x14,0x01,
+0x10,0xfd,0xc8,0x00,0x02,0x23,0x00,0x53,0x3f,0xf6,0x11,0x11,0x9f,0x0c,0x00,0x10,
+0xdf,0x80,0x00,0x21,0x90,0x00,0x2f,0x01,0x01,0x8c,0x00,0x11,0xa0,0x0c,0x00,0x10,
+0x1f,0xb5,0x00,0x22,0x7f,0xb0,0x3e,0x01,0x15,0xe1,0x0c,0x00,0x30,0x04,0xff,0x60,
+0x63,0x00,0x71,0xfc,0xcc,0xcc,0xcc,0xc0,0x0d,0xfc,0x4b,0x01,0x00,0x34,0x00,0xf0,
+0x09,0xf0,0x00,0x00,0x6c,0xef,0xea,0x40,0x00,0x00,0x2d,0xff,0xfe,0xff,0xf9,0x00,
+0x01,0xef,0xc3,0x00,0x07,0xff,0x70,0x0a,0xfc,0x2c,0x00,0x20,0xf0,0x1f,0x3c,0x01,
+0x40,0x0f,0xf5,0x5f,0xe0,0x63,0x00,0x13,0x94,0x54,0x00,0x3e,0x9f,0xa0,0x00,0x07,
+0x00,0x12,0x8f,0x1c,0x00,0x01,0x2a,0x00,0x41,0x06,0x83,0x1f,0xf3,0x38,0x00,0x12,
+0x0b,0x46,0x00,0xf1,0x04,0x01,0xff,0xb2,0x00,0x06,0xff,0x70,0x00,0x3e,0xff,0xee,
+0xff,0xf8,0x00,0x00,0x01,0x8d,0xff,0xea,0x22,0x01,0x12,0xed,0x28,0x01,0x31,0x8e,
+0xf3,0x00,0xa0,0x00,0x02,0xd1,0x01,0x21,0x5c,0xf2,0xd7,0x01,0x10,0xfc,0x38,0x01,
+0x20,0x1d,0xf8,0x0c,0x00,0x31,0x02,0xef,0x30,0xd2,0x01,0x11,0xd0,0x26,0x00,0x14,
+0x82,0x50,0x01,0x10,0x0f,0xbe,0x00,0x81,0xfb,0x0f,0xfe,0xee,0xee,0xee,0xe9,0x0f,
+0x43,0x00,0x0f,0x06,0x00,0x06,0x61,0xfe,0xdd,0xdd,0xdd,0x80,0x0f,0x22,0x01,0x0f,
+0x2a,0x00,0x0c,0x06,0x30,0x00,0x11,0xdb,0x30,0x00,0x61,0xfd,0x00,0x00,0x00,0x1e,
+0xf8,0x4a,0x01,0x10,0x90,0x7e,0x00,0x20,0xfb,0x00,0xe0,0x00,0x1f,0x70,0x84,0x00,
+0x5d,0x21,0x0c,0xf5,0x83,0x00,0xef,0xcf,0x30,0x00,0x00,0x08,0xf5,0x0c,0xe1,0x00,
+0x00,0x17,0x50,0x01,0x74,0x84,0x00,0x5b,0xff,0x01,0x4f,0xb0,0x03,0xeb,0x00,0x00,
+0x7f,0xf0,0x06,0xff,0x00,0x00,0x06,0x30,0x00,0x64,0x7e,0x00,0x5a,0x21,0x1d,0xf8,
 0x06,0x02,0x23,0x3f,0xd0,0x00,0x02,0x2f,0x0d,0xf6,0x03,0x00,0x1d,0x92,0x01,0xef,
 0x80,0xaf,0x90,0x4f,0xb0,0x06,0x70,0x3e,0x00,0x2f,0xdf,0x60,0x05,0x00,0x13,0x00,
 0x7a,0x01,0x00,0x78,0x01,0x00,0x76,0x01,0x05,0x74,0x01,0x2f,0x0d,0xf6,0x04,0x00,
-0x2e,0xb4,0x3e,0xb0,0x03,0xec,0x06,0xff,0x00,0x6f,0xf0,0x06,0x40,0x4b,0x01,0x01,
-0x1c,0x2e,0x2f,0xdf,0x60,0x09,0x00,0x32,0x00,0x3b,0x04,0x20,0xda,0x30,0x3c,0x09,
-0x41,0xee,0xef,0xff,0xa0,0xbd,0x02,0x31,0x05,0xdf,0xc0,0x66,0x2e,0x00,0x8f,0x30,
-0x21,0xaf,0x90,0x90,0x1c,0x21,0x0a,0xf9,0xa3,0x04,0x01,0xdb,0x02,0x00,0xa0,0x1e,
-0xa0,0xfe,0xcc,0x60,0x00,0x09,0xf9,0xef,0xff,0xff,0xf8,0x39,0x11,0x22,0x0a,0xf9,
-0xd7,0x2f,0x02,0x1e,0x00,0x18,0x80,0x2d,0x00,0x03,0x3c,0x00,0x00,0xcb,0x1f,0x00,
-0x5a,0x00,0x40,0xef,0xd0,0x00,0x0a,0xf3,0x23,0x12,0xb1,0x78,0x00,0x04,0xf2,0x04,
-0x10,0x21,0x97,0x05,0x31,0xee,0x71,0x2f,0x61,0x30,0x11,0xcf,0x5f,0x21,0x46,0x59,
-0x00,0x39,0x93,0xcb,0x05,0x23,0xff,0x90,0x65,0x26,0x12,0x30,0x65,0x26,0x13,0xfd,
-0x0f,0x00,0x12,0xf8,0x0f,0x00,0x22,0x9f,0xf3,0x65,0x26,0x21,0xbf,0xd0,0x0f,0x00,
-0x31,0x41,0xff,0x80,0x0f,0x00,0x31,0x06,0xff,0x20,0x65,0x26,0x22,0x0b,0xfc,0x74,
-0x26,0x31,0x2f,0xf7,0x02,0x47,0x26,0x22,0x6f,0xf2,0x65,0x26,0x21,0xcf,0xc2,0x0f,
-0x00,0x31,0x02,0xff,0x9f,0x0f,0x00,0x22,0x07,0xff,0x65,0x26,0x13,0x0c,0x65,0x26,
-0x12,0x2f,0x0f,0x00,0x00,0xbb,0x21,0x47,0x01,0xdf,0x90,0x00,0x61,0x04,0x04,0xdd,
-0x2f,0x07,0x64,0x04,0x01,0xee,0x03,0x30,0xce,0xfd,0x92,0x64,0x24,0x00,0xb0,0x0d,
-0x00,0xb1,0x15,0x42,0x40,0x02,0x8f,0xf7,0x1e,0x13,0x22,0x6f,0xf2,0xc9,0x23,0x22,
-0xcf,0x80,0xf7,0x04,0x41,0xfd,0x07,0xfb,0x00,0x55,0x2b,0x0b,0x8a,0x26,0x03,0x0f,
-0x00,0x13,0x17,0x1e,0x00,0x03,0x2d,0x00,0x04,0x3c,0x00,0x01,0x4b,0x00,0x20,0x5f,
-0xf2,0x5a,0x00,0x01,0x07,0x0d,0x11,0x2d,0x8e,0x15,0x01,0x78,0x00,0x00,0xa5,0x2e,
-0x05,0x32,0x21,0x02,0x89,0x01,0x02,0xa7,0x34,0x09,0x85,0x04,0x0f,0xa5,0x00,0x72,
-0x02,0xfa,0x23,0x02,0xa3,0x04,0x00,0xb6,0x18,0x00,0x41,0x0c,0x08,0xa6,0x04,0x0f,
-0xa5,0x00,0x71,0x41,0x59,0x71,0x02,0xd4,0x99,0x23,0x10,0xfb,0x2c,0x08,0x34,0x0c,
-0xc1,0x29,0xbd,0x14,0x0f,0x4a,0x01,0x79,0x31,0x63,0x00,0x06,0xa7,0x22,0x01,0x69,
-0x05,0x00,0x11,0x22,0x2f,0x3e,0xc0,0xa5,0x00,0x7f,0x00,0x25,0x03,0xd0,0xe3,0x00,
-0x00,0x08,0xc1,0x9f,0xf3,0x00,0x08,0xff,0x40,0xaf,0xe3,0xf6,0x18,0x31,0xaf,0xe9,
-0xff,0xff,0x38,0x10,0x50,0x75,0x03,0x10,0xe2,0x7d,0x1a,0x80,0xdf,0xe2,0x00,0x06,
-0xff,0x60,0xcf,0xe1,0xeb,0x18,0x40,0xcf,0xd1,0x9f,0x70,0x83,0x23,0x00,0x72,0x31,
-0x13,0x40,0xdc,0x0f,0x11,0x10,0xc9,0x00,0x21,0x1f,0x80,0x60,0x00,0x22,0xfc,0xf1,
-0xc9,0x00,0x12,0xfa,0xc9,0x00,0x31,0xdf,0xf1,0x00,0x2b,0x2a,0x11,0xdf,0xc9,0x00,
-0x30,0x2f,0x87,0xfc,0xc9,0x00,0x21,0x0c,0xd0,0xe1,0x28,0x21,0x06,0xf3,0xc9,0x00,
-0x22,0x01,0xf9,0xc9,0x00,0x11,0xbe,0xc9,0x00,0x00,0x54,0x37,0x61,0x3f,0xf0,0x4f,
-0xe0,0x1e,0xa0,0xc9,0x00,0x21,0x4a,0xe1,0xc9,0x00,0x21,0xfe,0xf5,0xc9,0x00,0x22,
-0x0d,0xff,0xc9,0x00,0x12,0x9f,0xc9,0x00,0x21,0x3f,0x76,0xc9,0x00,0x12,0x0c,0x28,
-0x1e,0x03,0x28,0x1b,0x00,0x59,0x11,0x02,0x3b,0x0d,0x1b,0xf6,0xea,0x0d,0x1f,0x05,
-0x9e,0x27,0x34,0x02,0x0d,0x00,0x30,0xf3,0xff,0x00,0x5e,0x27,0x21,0x0f,0xf6,0xb5,
-0x25,0xa0,0x7f,0xf7,0x00,0x02,0xbf,0xf2,0x00,0x9f,0xff,0xee,0xa4,0x0f,0x51,0x4a,
-0xef,0xfd,0x81,0x00,0x1f,0x00,0x02,0x57,0x25,0x11,0x30,0xeb,0x0a,0x11,0x40,0x19,
-0x33,0x1f,0x40,0x8f,0x00,0x66,0x21,0x04,0xfd,0x27,0x05,0x20,0xfc,0xfb,0x8e,0x04,
-0x31,0xed,0x14,0xf8,0xa8,0x0d,0x2f,0x05,0x71,0x8f,0x00,0x64,0x21,0x03,0x61,0x39,
-0x33,0x41,0xef,0x80,0x0d,0xf9,0xe7,0x0e,0x03,0x3b,0x33,0x0f,0xad,0x01,0x67,0x00,
-0xac,0x0b,0x07,0xa1,0x05,0x2d,0x5f,0xa0,0xa1,0x05,0x00,0xda,0x2c,0x00,0xdb,0x3b,
-0x01,0x4b,0x0a,0x52,0x2f,0xf5,0x00,0x7f,0xf1,0xdb,0x13,0x21,0xdf,0x80,0x2a,0x1b,
-0x00,0xcf,0x2a,0x20,0xaf,0xb0,0xb3,0x29,0x31,0x00,0x3f,0xf2,0x14,0x36,0x02,0x79,
-0x0c,0x41,0xaf,0x93,0xff,0x10,0x07,0x02,0x21,0xdf,0x70,0x1c,0x0d,0x02,0x24,0x2e,
-0x01,0xb2,0x1e,0x0f,0xbc,0x27,0x14,0x03,0x0f,0x00,0x12,0x0f,0xb2,0x0c,0x02,0xe6,
-0x02,0x04,0x0d,0x00,0x42,0xdd,0xdc,0xb7,0x20,0xc0,0x09,0x40,0x70,0x00,0xff,0x20,
-0x71,0x2c,0x21,0x0f,0xf2,0xbf,0x34,0x21,0xff,0x20,0x1a,0x32,0x11,0xf2,0x3b,0x19,
-0x00,0x0d,0x00,0x11,0x7f,0xff,0x1b,0x80,0x6f,0xf7,0x00,0xff,0xdc,0xcd,0xff,0xfa,
-0x34,0x00,0x2c,0xfe,0xb5,0x4e,0x00,0x07,0x0d,0x00,0x00,0x7a,0x21,0x60,0xd9,0x10,
-0x00,0x00,0x3f,0xff,0x9f,0x19,0x50,0x0d,0xfa,0x00,0x2e,0xf6,0x97,0x28,0x21,0x00,
-0x7f,0x3f,0x23,0x20,0x07,0xf9,0x39,0x21,0x00,0x31,0x06,0x20,0x6f,0xc0,0x10,0x00,
-0x21,0x06,0xfc,0xfa,0x19,0x20,0x6f,0xc0,0x8b,0x2f,0x20,0x06,0xfc,0x10,0x35,0x00,
-0x0d,0x00,0x21,0x4f,0xf9,0x1a,0x1a,0x30,0x5f,0xfc,0x00,0x64,0x20,0x32,0x3e,0xfb,
-0x06,0x7b,0x31,0x20,0x6f,0xc0,0x6d,0x00,0xf4,0x04,0x36,0xfc,0x01,0x10,0x00,0x4f,
-0xf0,0x6f,0xc0,0x8f,0xb9,0xbf,0xf7,0x06,0xfc,0x06,0xce,0xff,0xc5,0x01,0x11,0x26,
-0x7f,0xc0,0xae,0x11,0x15,0x55,0xe5,0x11,0xf1,0x02,0xae,0xfe,0xb3,0x00,0x06,0xff,
-0xec,0xef,0xf5,0x02,0xff,0x50,0x00,0x8f,0xe0,0x4a,0x80,0x08,0x30,0x01,0xd6,0x1e,
-0xf0,0x02,0x4a,0xef,0xff,0xff,0x40,0x9f,0xfc,0xa8,0x8f,0xf4,0x5f,0xe3,0x00,0x00,
-0xef,0x4a,0xf8,0x16,0x00,0xf0,0x07,0xbf,0x90,0x00,0x02,0xff,0x47,0xff,0x40,0x04,
-0xef,0xf5,0x0d,0xff,0xff,0xfe,0xef,0x70,0x19,0xef,0xe9,0x17,0xc8,0x5f,0x00,0x10,
-0xe2,0xc2,0x01,0x11,0xe2,0x0c,0x14,0x00,0xfb,0x01,0x1f,0x63,0x63,0x00,0x3e,0x20,
-0x5f,0xd1,0xe9,0x00,0x10,0xae,0x28,0x17,0x8f,0xb0,0x2e,0xb0,0x00,0x02,0x30,0x00,
-0x13,0xc6,0x00,0x3d,0x00,0xcc,0x10,0xf9,0x00,0x03,0xde,0x80,0x0a,0xe0,0x00,0xee,
-0xbf,0xeb,0xf9,0x00,0x3f,0x40,0x2c,0xfb,0x76,0x15,0x0f,0x60,0x28,0x34,0x80,0x00,
-0xaf,0x50,0x09,0xf5,0x00,0x0e,0xf8,0xea,0x18,0x4f,0x36,0x10,0x03,0x71,0x5e,0x00,
-0x3c,0x80,0x00,0x9e,0xd5,0x00,0x00,0x00,0x8c,0x25,0xb5,0x02,0x63,0xa0,0x1e,0x30,
-0x00,0x00,0x1c,0xbc,0x1d,0x0f,0xc7,0x00,0x3d,0x60,0x06,0xcf,0xfd,0x80,0x02,0xae,
-0x75,0x3a,0x50,0xcf,0xfe,0xdf,0xfd,0x6f,0xbd,0x23,0xc2,0x07,0xff,0x40,0x01,0xdf,
-0xff,0x70,0x01,0xbf,0xc0,0x08,0xd7,0x35,0x38,0x23,0x1f,0xf2,0x3b,0x20,0x00,0x33,
-0x0c,0xb4,0x03,0x79,0x9a,0xbf,0xfa,0xaa,0xaa,0xae,0xf6,0x01,0xbf,0xeb,0x17,0x31,
-0x0a,0xfe,0x51,0xcf,0x20,0x02,0x0f,0x32,0x02,0x63,0x20,0x01,0x1a,0x40,0x13,0xfa,
-0x28,0x2b,0x70,0x05,0xef,0xff,0x70,0x00,0x07,0xa0,0xe0,0x01,0xd0,0xf8,0x4f,0xff,
-0xcd,0xff,0xf1,0x00,0x4c,0xef,0xd9,0x30,0x02,0x9d,0x83,0x2f,0x0f,0x3d,0x29,0x30,
-0x34,0xef,0xea,0x30,0x15,0x14,0x21,0x6c,0xf7,0x7d,0x00,0x00,0x48,0x0a,0x20,0x49,
-0xf7,0x39,0x00,0x11,0xd7,0x9d,0x04,0x06,0xc3,0x04,0x01,0xdc,0x1b,0x25,0x01,0x64,
-0x49,0x01,0xf0,0x00,0x7d,0xfe,0xb3,0x00,0x01,0xdf,0xfd,0xef,0xf5,0x00,0xcf,0xa1,
-0x00,0x7f,0xf1,0x72,0x21,0x30,0xbf,0x7a,0xf8,0xf9,0x2d,0x61,0xdf,0xdc,0xcc,0xcc,
-0xdf,0xce,0xa4,0x0d,0x01,0xd2,0x10,0x23,0x0b,0xf8,0xc8,0x10,0x80,0x00,0x04,0x00,
-0xdf,0xc2,0x00,0x1a,0xf6,0xfd,0x25,0x10,0xfc,0xf3,0x0f,0x15,0xc7,0xd9,0x18,0x01,
-0xe1,0x02,0x20,0x1e,0xe1,0xd9,0x04,0x1f,0x62,0x63,0x00,0x3e,0x01,0x88,0x10,0x10,
-0x7f,0xf6,0x1a,0x9f,0x6f,0x80,0x4f,0x80,0x00,0x03,0x30,0x00,0x23,0x63,0x00,0x3c,
-0xe4,0xce,0x20,0x0c,0xe3,0x00,0x1f,0xf5,0x00,0xff,0x60,0x00,0x46,0x00,0x04,0x42,
-0x0a,0x0f,0x34,0x2a,0x33,0x00,0x36,0x2d,0x30,0x04,0xfe,0x10,0x43,0x06,0x22,0x03,
-0x40,0x9a,0x09,0x0f,0x03,0x00,0x12,0xaf,0x5f,0xf3,0x01,0xef,0x30,0x0b,0xf4,0x00,
-0x04,0x20,0x35,0x00,0x18,0xd0,0x00,0x3f,0xe2,0x00,0x03,0xfb,0xce,0x20,0x3f,0xb0,
-0x0c,0xd1,0x01,0xa6,0x17,0x03,0x3c,0x00,0x0f,0x04,0x00,0x1d,0xcf,0x8f,0x70,0x07,
-0xf7,0xbf,0xb0,0x0b,0xfb,0x27,0x20,0x02,0x72,0x44,0x00,0x25,0x31,0x00,0x79,0x40,
-0xd2,0x12,0xa0,0xfd,0x40,0x5e,0x30,0x00,0x27,0xef,0xfc,0xfc,0x20,0xc0,0x18,0x10,
-0xd0,0x98,0x02,0x10,0xdf,0x3d,0x2b,0x11,0xf7,0x30,0x01,0xa0,0x10,0x00,0xbf,0x90,
-0x00,0x04,0x9c,0xb7,0x5f,0xe0,0xc9,0x09,0xa0,0xdf,0xf3,0x07,0xff,0x61,0x03,0xbf,
-0xf6,0x0f,0xf6,0xd0,0x13,0x20,0x4f,0xe0,0x7c,0x24,0x24,0x7f,0xb0,0x06,0x00,0x22,
-0x0c,0xf6,0x42,0x28,0x11,0x1f,0xb8,0x24,0xb0,0x09,0xfe,0x30,0x03,0xef,0x60,0x00,
-0xbf,0xfd,0xdf,0xf9,0xc6,0x0a,0x23,0xfc,0x50,0xd2,0x15,0xf9,0x00,0x04,0xde,0x70,
-0x0c,0xc0,0x01,0xfe,0xbf,0xdc,0xf7,0x00,0x5f,0x20,0x3d,0xfa,0x69,0x14,0x0f,0x41,
-0x29,0x35,0x01,0x99,0x25,0x01,0x5f,0x25,0x05,0x3a,0x3e,0x16,0x06,0xb3,0x08,0x0f,
-0x5f,0x29,0x3a,0x04,0xa8,0x1c,0x11,0x03,0x3f,0x0a,0x21,0x0d,0xe2,0x65,0x3c,0x1f,
-0x20,0x6c,0x00,0x45,0x11,0x6f,0x05,0x29,0x20,0xfa,0xeb,0xb0,0x06,0x10,0xa0,0x84,
-0x19,0x10,0x23,0xae,0x06,0x0f,0xd8,0x00,0x44,0x00,0x7f,0x17,0x50,0x4d,0xe7,0x00,
-0xbd,0x00,0xae,0x01,0x65,0xf8,0x00,0x05,0xf3,0x03,0xcf,0xb1,0x25,0x0f,0x72,0x00,
-0x41,0x30,0xbf,0x40,0x0a,0x78,0x38,0x9f,0x70,0x0e,0xf8,0x00,0x00,0x36,0x00,0x03,
-0x60,0xd8,0x00,0x44,0x03,0x77,0x1e,0x21,0x8f,0xf0,0x49,0x0a,0x25,0x85,0x00,0x24,
-0x24,0x01,0x37,0x1e,0x12,0x12,0xd1,0x1e,0x02,0x6a,0x16,0x0a,0xdd,0x06,0x02,0x2a,
-0x3f,0x00,0x5b,0x0a,0x08,0x16,0x10,0x31,0x00,0x07,0x30,0xbc,0x02,0x60,0x10,0x00,
-0x17,0xdf,0xeb,0xd9,0xa8,0x00,0x02,0x4b,0x40,0x20,0x0d,0xff,0xa8,0x00,0x20,0x4f,
-0x7f,0xa8,0x00,0x10,0xca,0xa8,0x00,0xe0,0x04,0xf2,0x0a,0xf8,0xef,0x30,0x0c,0xa0,
-0x09,0xf9,0xdf,0x40,0x4f,0x20,0xa8,0x00,0x10,0xca,0xa8,0x00,0x86,0xe5,0xf2,0x00,
-0x5f,0xf0,0x0d,0xff,0xa0,0xa8,0x00,0x10,0xcd,0xf0,0x00,0x11,0x03,0xaf,0x06,0x03,
-0xed,0x04,0x02,0xe0,0x31,0x03,0x6c,0x46,0x01,0x84,0x00,0x14,0x33,0x47,0x0d,0x0f,
-0x51,0x2a,0x18,0x02,0x0b,0x00,0x00,0xb6,0x03,0xfa,0x03,0xbf,0x91,0xff,0x80,0x01,
-0x9f,0xf9,0x08,0xff,0xfe,0xff,0xdf,0x90,0x07,0xdf,0xfb,0x48,0xf9,0x2a,0x06,0x10,
-0xd1,0x1a,0x01,0x1f,0x31,0x63,0x00,0x3e,0x02,0x2a,0x06,0x80,0x8e,0xb0,0x00,0x00,
-0x7f,0x70,0x3f,0xa0,0x4f,0x23,0x1f,0x01,0x63,0x00,0x3c,0x3e,0xce,0x20,0x0b,0x2a,
-0x06,0x0f,0x7a,0x2b,0x35,0x04,0xc9,0x29,0x02,0xf0,0x1b,0x12,0x0b,0x9e,0x42,0x05,
-0xeb,0x03,0x0f,0x87,0x2a,0x59,0x00,0xfe,0x00,0x0f,0x06,0x00,0x08,0xc0,0xe1,0x9e,
-0xfe,0x81,0x00,0x4f,0xfe,0xfe,0xef,0xfd,0x10,0x4f,0x17,0x32,0x30,0x90,0x4f,0xf1,
-0xdf,0x10,0x20,0x4f,0xe0,0x0a,0x09,0x20,0x4f,0xe0,0xb1,0x14,0x00,0x06,0x00,0x11,
-0x0b,0xc2,0x05,0x23,0x0c,0xf6,0x18,0x00,0x10,0xf0,0xea,0x19,0x10,0x4f,0x31,0x03,
-0x61,0x90,0x4f,0xfe,0xfd,0xdf,0xfd,0x48,0x00,0x1f,0x80,0x6c,0x00,0x0c,0x01,0x8b,
-0x06,0x00,0xc8,0x36,0x21,0x0b,0xfb,0xf2,0x1a,0x1f,0x72,0x0e,0x01,0x60,0x61,0x00,
-0x00,0xbb,0xbb,0xbb,0xb9,0x38,0x00,0x24,0xff,0xff,0x71,0x27,0x0f,0xc3,0x1a,0x80,
-0x11,0x01,0xd6,0x17,0x5f,0x0b,0xbb,0xbb,0xbb,0x80,0x34,0x0b,0x41,0x51,0x00,0x48,
-0x10,0x03,0x82,0x90,0x0d,0x31,0x40,0x08,0xf3,0x72,0x00,0x32,0xc3,0x4e,0xd0,0x23,
-0x2b,0x03,0x68,0x3a,0x2f,0x14,0x30,0xd1,0x1b,0x79,0x90,0x9f,0x20,0x08,0xf3,0x00,
-0x04,0xfa,0x24,0xee,0xbd,0x12,0x00,0xaf,0x2a,0x29,0x01,0x32,0xda,0x0d,0x10,0x08,
-0x77,0x0d,0x00,0x22,0x2e,0x4f,0x8f,0xe0,0x26,0x50,0x77,0x0d,0x25,0x0f,0xeb,0x00,
-0x05,0x22,0xf7,0xdf,0xeb,0x00,0x22,0xf1,0x7f,0xeb,0x00,0x01,0x30,0x2f,0x00,0x5d,
-0x05,0x11,0x0a,0xeb,0x00,0x12,0xfe,0x26,0x06,0x22,0x06,0xf9,0x74,0x02,0x20,0x0c,
-0xf2,0x50,0x4a,0x00,0xda,0x37,0x38,0xdd,0xdd,0xef,0xeb,0x00,0x11,0x10,0x24,0x00,
-0x22,0x05,0xfc,0x73,0x47,0x22,0x0b,0xf7,0x9f,0x43,0x13,0x1f,0x17,0x0f,0x09,0xbc,
-0x1c,0x03,0x54,0x12,0x33,0x00,0x09,0xf4,0xc7,0x19,0x13,0xf0,0x85,0x18,0x23,0xfc,
-0xc0,0xc7,0x26,0x1f,0xc0,0x0b,0x02,0x33,0x01,0x8c,0x38,0x33,0x8f,0x80,0x00,0xa5,
-0x21,0x11,0x07,0xfa,0x00,0x01,0x29,0x46,0x30,0x00,0xaf,0xe5,0xa9,0x00,0x27,0x78,
-0x30,0x1e,0x09,0x12,0x4f,0x7e,0x00,0x2e,0xdd,0x10,0x35,0x03,0x0f,0xa5,0x1c,0x64,
-0x02,0xdc,0x11,0x01,0xb3,0x0b,0x20,0x5f,0x90,0x44,0x02,0x15,0x50,0x71,0x25,0x90,
-0x8d,0xfe,0xb4,0x00,0x03,0xef,0xfd,0xef,0xf7,0x0a,0x3a,0x30,0x6f,0xf3,0x6f,0x8b,
-0x01,0x82,0x9b,0xf7,0x00,0x00,0x03,0x86,0xdf,0x40,0x1e,0x02,0x03,0xda,0x2e,0x02,
-0x8b,0x01,0x21,0x32,0x6f,0x0f,0x0a,0x00,0x44,0x34,0xa1,0xf3,0x03,0xef,0xfc,0xef,
-0xf6,0x00,0x01,0x9d,0xfe,0x4e,0x15,0x12,0x76,0x8b,0x01,0x02,0x7b,0x27,0x21,0x6f,
-0x79,0x63,0x38,0x10,0xfa,0xbb,0x45,0x0f,0x04,0x01,0x73,0x11,0x01,0xc4,0x00,0x30,
-0xce,0xaf,0x40,0x64,0x24,0x20,0xaf,0x30,0x66,0x06,0x1f,0x32,0x04,0x01,0x3e,0x13,
-0x65,0x19,0x1f,0x21,0x20,0x00,0x64,0x14,0x0f,0x01,0x02,0x77,0x20,0xbe,0x30,0x25,
-0x00,0x01,0x4c,0x03,0x16,0x47,0x7b,0x09,0x0f,0xcd,0x38,0x34,0x50,0x03,0x83,0x00,
-0x48,0x30,0x5d,0x01,0x21,0x23,0xfc,0xf3,0x2e,0x21,0xde,0xd1,0xfc,0x09,0x2f,0xfe,
-0x20,0xff,0x00,0x74,0x80,0x01,0xdd,0x10,0x7f,0x70,0x00,0x02,0xeb,0x57,0x25,0x11,
-0x03,0xaf,0x1b,0x27,0x02,0x40,0x00,0x03,0x11,0xb3,0xfc,0x01,0x10,0xf6,0xfc,0x01,
-0x40,0x7f,0xf2,0x6f,0xd0,0x45,0x1c,0x00,0xad,0x0d,0x1f,0xb8,0xfc,0x01,0x02,0x30,
-0x21,0x6f,0xd0,0xd6,0x2a,0x05,0xfc,0x01,0x13,0xf7,0xfc,0x01,0x41,0x2e,0xc0,0x09,
-0xf6,0xf2,0x02,0x12,0x7f,0xbc,0x25,0x1d,0xfa,0x3e,0x15,0x0f,0xce,0x46,0x64,0x02,
-0x4a,0x36,0x21,0x9f,0x70,0xfc,0x38,0x22,0x0a,0xf6,0x0f,0x00,0x21,0xdf,0x20,0x0f,
-0x00,0x22,0x4f,0xb0,0x0f,0x00,0x21,0x51,0x00,0x75,0x3a,0x21,0x00,0x00,0x77,0x3a,
-0x31,0xd0,0x00,0x01,0x79,0x3a,0x01,0x2a,0x33,0x00,0xf0,0x3e,0x22,0x0b,0xf8,0x43,
-0x39,0x01,0x99,0x39,0x11,0xd0,0x13,0x01,0x07,0x0f,0x00,0x11,0x0a,0x85,0x3a,0x00,
-0x83,0x3a,0x02,0x04,0x00,0x01,0x89,0x3a,0x22,0x00,0x00,0x8b,0x3a,0x22,0x00,0x00,
-0x8d,0x3a,0x0f,0xcc,0x1d,0x72,0x03,0x51,0x37,0x02,0x3b,0x3a,0x02,0x35,0x22,0x54,
-0x05,0xcc,0xdf,0xfc,0xc0,0x15,0x00,0x20,0x3b,0xef,0x57,0x3a,0x03,0x04,0x01,0x11,
-0x1e,0x70,0x3a,0x04,0x03,0x01,0x01,0x5a,0x37,0x14,0xd0,0xf3,0x00,0x28,0xef,0x40,
-0x0e,0x00,0x21,0xaf,0x70,0x07,0x00,0x02,0x00,0x01,0x00,0x10,0x42,0x35,0x03,0xef,
-0xd0,0xff,0x00,0x40,0x3b,0xff,0xd7,0x3f,0x53,0x02,0x01,0x64,0x23,0x49,0x6b,0xbb,
-0xbb,0xbb,0x15,0x03,0x0f,0x78,0x20,0x53,0x11,0x04,0x69,0x33,0x49,0x2b,0xbb,0xbb,
-0xbb,0x2a,0x1c,0x0f,0x21,0x3c,0x34,0x00,0xd3,0x19,0x70,0x75,0x00,0x00,0x0f,0xd3,
-0x28,0xf8,0x71,0x32,0x11,0xff,0x93,0x1b,0x1f,0x31,0x5c,0x22,0x5c,0x10,0xcf,0x38,
-0x55,0x40,0x07,0xf8,0x25,0xfc,0x62,0x02,0x28,0xfc,0x20,0xf9,0x08,0x0f,0x95,0x13,
-0x36,0x12,0x0b,0x01,0x47,0x02,0xa9,0x4d,0x0f,0x3d,0x23,0x5e,0x22,0x5f,0x90,0x44,
-0x25,0x00,0xbd,0x0f,0x1f,0x30,0xc3,0x01,0x3c,0x0f,0x85,0x24,0x56,0x02,0x6a,0x0f,
-0x33,0x08,0xf5,0x00,0x93,0x53,0x00,0x80,0x41,0x20,0xc1,0x00,0x56,0x35,0x12,0xc1,
-0x78,0x55,0xa0,0x1d,0xff,0xce,0xff,0x30,0x0c,0xfc,0x10,0x08,0xfe,0xc9,0x35,0x40,
-0x0d,0xf5,0xaf,0xa0,0xd0,0x4f,0x01,0xdd,0x3a,0x02,0xcc,0x00,0x75,0xfd,0xcc,0xcc,
-0xcc,0xca,0xbf,0x60,0xd4,0x2a,0xd1,0x0e,0xfa,0x10,0x00,0x8e,0x40,0x3e,0xff,0xdc,
-0xff,0xf3,0x00,0x19,0xc0,0x4f,0x02,0x4d,0x52,0x22,0x2f,0xd0,0x66,0x4e,0x00,0x51,
-0x05,0x20,0xfb,0x80,0xa0,0x25,0x70,0xe7,0x00,0x00,0x1d,0xd1,0x07,0xf8,0x02,0x1c,
-0x01,0xdc,0x1a,0x21,0x4f,0xfc,0xc9,0x0b,0x1f,0x71,0xc9,0x01,0x5c,0x90,0x8f,0x40,
-0x2e,0xd1,0x00,0x00,0xaf,0x4d,0xd1,0x94,0x01,0x01,0x84,0x10,0x1f,0x41,0xa2,0x16,
-0x3f,0x12,0x75,0x02,0x1e,0x12,0xff,0x4c,0x13,0x22,0x6a,0xf3,0xd7,0x54,0x1d,0xce,
-0x90,0x08,0x0f,0x1e,0x4c,0x63,0x03,0x6e,0x53,0x30,0x8f,0x9f,0x80,0xe1,0x2c,0x27,
-0x6f,0x60,0xe0,0x16,0x00,0x89,0x06,0x76,0x62,0xfd,0x04,0xff,0xfe,0xff,0xcf,0xfe,
-0x40,0x31,0x7f,0xda,0xf9,0x18,0x40,0x10,0x60,0x23,0x40,0x10,0xf5,0x0b,0x00,0x10,
-0xcf,0x0b,0x00,0x02,0x16,0x00,0x01,0x21,0x00,0x11,0xd0,0x2c,0x00,0x02,0xba,0x05,
-0x21,0x03,0xbf,0xcb,0x06,0x00,0xb4,0x00,0x10,0x31,0x8d,0x1c,0x21,0x1e,0xd4,0x7f,
-0x44,0x60,0xfe,0xdf,0xff,0x60,0x00,0x3a,0x40,0x18,0x00,0xa7,0x2e,0x20,0x7f,0x40,
-0xb5,0x12,0x31,0x23,0xee,0x10,0xd4,0x44,0x11,0xe4,0x0c,0x01,0x1f,0x33,0x19,0x01,
-0x6f,0x90,0xed,0x00,0x0c,0xe0,0x00,0x09,0xf7,0x26,0xfa,0x38,0x16,0x29,0xfb,0x10,
-0xc0,0x0d,0x0f,0x19,0x01,0x50,0x13,0x00,0xc6,0x25,0x03,0x99,0x48,0x10,0x02,0xb6,
-0x2f,0x0f,0x32,0x02,0x74,0x25,0x7f,0x70,0x74,0x56,0x15,0x27,0x43,0x07,0x0f,0x4a,
-0x42,0x4f,0x0f,0xf0,0x00,0x66,0x05,0x03,0x13,0x02,0x8e,0x1f,0x03,0x2d,0x2b,0x02,
-0xaf,0x36,0x13,0x02,0xe2,0x25,0x17,0x72,0x28,0x00,0x11,0x7a,0x53,0x1f,0x10,0xf0,
-0xcb,0x00,0x15,0xfa,0x31,0x00,0x16,0x0a,0xe1,0x52,0x0f,0x30,0x01,0x54,0x00,0xd5,
-0x04,0x12,0x60,0xb2,0x00,0x02,0x9c,0x0f,0x41,0x7f,0x70,0xbe,0x20,0x3c,0x55,0x27,
-0x00,0x75,0x33,0x27,0x0f,0xdb,0x4f,0x21,0x01,0xfa,0x34,0x23,0xff,0x10,0x42,0x3c,
-0x0f,0x62,0x50,0x23,0x01,0x0f,0x00,0x00,0xcc,0x5a,0x13,0x10,0xb4,0x2f,0x41,0x01,
-0xdd,0x14,0xf9,0xaf,0x2f,0x1f,0x71,0x35,0x44,0x51,0x02,0x6f,0x56,0x22,0x3f,0xf0,
-0x67,0x1d,0x34,0x03,0xff,0x00,0x11,0x00,0x94,0x07,0xbf,0xfb,0xaa,0xaa,0xaa,0xab,
-0xff,0xa6,0x19,0x3d,0x1c,0x90,0x22,0x00,0x70,0x00,0x1f,0xfd,0xdd,0xdd,0xdd,0xde,
-0x11,0x00,0x03,0xbb,0x58,0x0e,0x22,0x00,0x0f,0x11,0x00,0x1f,0x09,0xf8,0x20,0x11,
-0x5f,0x46,0x3f,0x57,0x04,0xcc,0xff,0xdc,0xc1,0x12,0x21,0xf1,0x05,0x25,0xcf,0xfb,
-0x30,0x00,0x0f,0xfb,0xff,0xef,0xff,0x30,0x00,0xff,0xf6,0x00,0x1d,0xfa,0x00,0x0f,
-0xf6,0x7d,0x0d,0x20,0xff,0x20,0x4b,0x00,0x21,0x0f,0xf2,0x49,0x00,0x0f,0x0d,0x00,
-0x19,0xd7,0x05,0x97,0x10,0x2d,0x46,0xff,0xff,0xbe,0xf2,0xcc,0x12,0xaf,0xe5,0x9e,
-0x02,0x2f,0xdf,0x60,0x3f,0x2a,0x37,0x00,0xb0,0x33,0xe8,0x02,0xcf,0x90,0x08,0xf0,
-0x0c,0xfb,0xfe,0xbf,0xc0,0x1f,0x60,0x1b,0xfc,0x78,0x0b,0x2f,0x03,0xff,0x05,0x00,
-0x2b,0x00,0xac,0x12,0x41,0x46,0xbb,0xbb,0xbb,0x55,0x34,0x0f,0xf8,0x2a,0x3f,0x00,
-0xea,0x08,0x45,0xab,0xbb,0xbb,0xba,0x5d,0x00,0x0f,0x8b,0x1c,0x20,0x00,0x95,0x0b,
-0x41,0x0f,0xe3,0x28,0xf8,0x91,0x0b,0x04,0x8f,0x0b,0x0f,0xf3,0x2b,0x30,0xc0,0x7f,
-0x40,0x05,0xf6,0x2f,0xc3,0x3d,0xf2,0x06,0xff,0xfe,0x50,0xb8,0x07,0x0f,0x2b,0x1d,
-0x26,0x0f,0xbc,0x2c,0x15,0xf0,0x02,0xff,0x60,0x9f,0x70,0x5f,0x80,0x0a,0xf3,0x00,
-0x9f,0xdb,0x41,0xbf,0xd3,0x00,0x1e,0xd0,0x9b,0x5c,0x02,0x7a,0x1c,0x2f,0x2f,0xf0,
-0x03,0x00,0x0f,0xf0,0x08,0x3f,0xf0,0x01,0xce,0x30,0x0a,0xf3,0x00,0x0f,0xe0,0x00,
-0x0e,0xfb,0xc0,0x04,0xdf,0xb0,0x0b,0xf4,0x0f,0xf7,0x04,0x70,0xcc,0x00,0x0f,0x02,
-0x00,0x0d,0x3c,0x3f,0xf3,0xff,0x03,0x00,0x32,0xf0,0xdf,0x60,0x9d,0x25,0x0f,0x08,
-0x00,0x47,0x20,0x09,0xb5,0x0f,0x16,0x20,0xdf,0x60,0xbf,0x40,0x50,0x0a,0xfb,0xdf,
-0x60,0x05,0xd9,0x47,0xf0,0x01,0xf4,0xdf,0x60,0x00,0xaf,0xfc,0xac,0xff,0x80,0xdf,
-0x60,0x00,0x05,0xbe,0xfe,0xb4,0x07,0x01,0xb3,0x6f,0x84,0xff,0x20,0x0a,0xfc,0x06,
-0x50,0x00,0x17,0x20,0x0d,0x01,0x6f,0x7f,0xb2,0xff,0x00,0x07,0xfb,0x09,0x00,0x1e,
-0x20,0xb0,0x00,0x86,0x4e,0x02,0x04,0x5e,0x00,0x58,0x0a,0x62,0xde,0xff,0x30,0x00,
-0x0c,0xfd,0x62,0x01,0x12,0xe1,0xc9,0x12,0x11,0xed,0xab,0x0b,0x11,0xe2,0x29,0x5f,
-0x38,0x38,0x30,0x03,0x5a,0x2c,0x2f,0x0e,0xf6,0x07,0x00,0x3b,0x02,0x59,0x55,0x12,
-0x00,0x5a,0x55,0x12,0x00,0x5b,0x55,0x13,0x00,0x5c,0x55,0x02,0x5d,0x55,0x02,0x44,
-0x5a,0xb5,0xde,0xce,0x20,0x0b,0xf3,0x1d,0xd1,0x26,0x30,0x01,0x63,0x84,0x52,0x0f,
-0x04,0x00,0x1e,0x11,0xf2,0x46,0x40,0x00,0xe5,0x0f,0x7f,0xad,0xff,0x70,0x00,0xbf,
-0xd7,0x00,0xba,0x55,0x6d,0x00,0x3e,0x3a,0x02,0xbf,0x04,0x02,0xb9,0x4d,0x03,0xd0,
-0x4d,0x03,0xb3,0x4d,0x02,0x57,0x39,0x07,0x83,0x19,0x0f,0x21,0x4a,0x58,0x45,0x00,
-0x00,0x68,0x10,0x65,0x4e,0x02,0x12,0x5f,0x03,0x48,0x32,0x19,0xf3,0xa8,0x04,0x40,
-0xaf,0xd0,0x3f,0xf0,0x50,0x4f,0x20,0x3f,0xf0,0x42,0x00,0x20,0x3f,0xf0,0x4e,0x00,
-0x41,0x3f,0xf0,0x0c,0xfc,0xbe,0x2b,0x10,0xe1,0x4f,0x27,0x00,0x11,0x2b,0x50,0x3f,
-0xfe,0xff,0xa0,0x00,0xe9,0x2a,0x10,0xf9,0x06,0x00,0x31,0x04,0xff,0x80,0x00,0x22,
-0x10,0xf6,0x06,0x00,0x00,0x30,0x5e,0x11,0xf0,0x76,0x01,0x11,0x07,0x67,0x5d,0x01,
-0xf2,0x17,0x00,0x11,0x3a,0x00,0x82,0x02,0x07,0x3b,0x11,0x0f,0xe3,0x56,0x52,0x01,
-0x94,0x22,0x5f,0x40,0x0a,0xf5,0x00,0x07,0x72,0x04,0x16,0x0e,0x03,0x00,0x0f,0xab,
-0x00,0x54,0x04,0x8b,0x35,0x12,0xf4,0x71,0x1a,0x05,0x11,0x0a,0x12,0x00,0x93,0x14,
-0x11,0x18,0x38,0x19,0x0f,0xe6,0x4b,0x05,0x00,0x15,0x08,0x80,0x2f,0xe6,0xfa,0xcf,
-0x33,0x60,0x0f,0xf4,0x3d,0x0a,0x20,0x0f,0xf4,0xd8,0x12,0x20,0x0f,0xf4,0xf0,0x01,
-0x41,0x0f,0xf4,0x03,0xfc,0x72,0x00,0x1f,0x61,0xae,0x00,0x37,0xf0,0x04,0x2f,0xf0,
-0x0f,0xf0,0x2f,0xf0,0x1f,0xf0,0x2f,0xf0,0x5f,0xb0,0x2f,0xf0,0xbf,0x40,0x2f,0xf0,
-0x26,0x2b,0x01,0x0f,0x04,0x00,0x1e,0x0f,0x7e,0x00,0x14,0x10,0x46,0x06,0x00,0x30,
-0x01,0xff,0x50,0x0c,0x00,0x2f,0xce,0x20,0xae,0x00,0x20,0x01,0x80,0x43,0x1e,0x2f,
-0x07,0x00,0x9f,0x01,0x72,0x2f,0xf0,0x9f,0xc2,0xff,0x06,0xf9,0x23,0x00,0x07,0x04,
-0xf1,0x0a,0x04,0x27,0x57,0x0f,0x0d,0x00,0x08,0x21,0x33,0x93,0x89,0x10,0x20,0xfe,
-0x30,0xe0,0x2f,0x10,0x93,0x5d,0x03,0x1f,0x7f,0x34,0x00,0x0e,0x16,0x30,0xad,0x00,
-0x11,0x00,0x1b,0x0a,0x10,0x50,0xa0,0x14,0x00,0xa5,0x15,0x0e,0x07,0x00,0xaf,0xf8,
-0xa1,0x02,0xff,0xfc,0x17,0xff,0xf5,0x00,0x55,0x23,0x00,0x06,0x12,0xf4,0x59,0x1b,
-0x15,0xb0,0xe7,0x1f,0x00,0x47,0x02,0x1e,0xd1,0x52,0x32,0x0f,0xf7,0x32,0x6d,0x11,
-0x00,0x04,0x59,0x34,0x00,0x3f,0xe1,0x23,0x24,0x05,0x87,0x27,0x2f,0x05,0xfb,0xae,
-0x0b,0x33,0x0f,0x46,0x5a,0x6f,0x1a,0x00,0xb6,0x3d,0x03,0xd2,0x2f,0x01,0x2e,0x40,
-0x07,0x2d,0x23,0x1f,0x71,0xe8,0x25,0x3a,0x07,0x76,0x06,0x21,0x08,0xf8,0x0b,0x02,
-0x14,0x50,0x4f,0x13,0x22,0x00,0x62,0xfd,0x25,0x21,0x30,0x3f,0x17,0x02,0x32,0xce,
-0x4e,0xd1,0x38,0x2e,0x12,0xe2,0x55,0x0b,0x1f,0x83,0x1e,0x02,0x78,0x20,0x7f,0x50,
-0x71,0x23,0x32,0x9f,0x5d,0xe2,0xce,0x07,0x07,0x66,0x13,0x0f,0x1e,0x02,0x35,0x13,
-0x0e,0x20,0x0d,0x13,0x10,0xf7,0x4d,0x00,0x9e,0x15,0x02,0x84,0x05,0x18,0x15,0x69,
-0x00,0x11,0x00,0x6a,0x00,0x12,0x00,0x6b,0x00,0x21,0x00,0x5f,0xbd,0x21,0x21,0x05,
-0xfd,0xc7,0x18,0x02,0x71,0x01,0x11,0x05,0x4e,0x00,0x0f,0x0d,0x00,0x14,0x30,0x1f,
-0xf7,0x00,0x92,0x0f,0x32,0x1f,0xff,0x20,0x07,0x00,0x12,0xb0,0x07,0x00,0x11,0xf6,
-0x07,0x00,0x30,0xf9,0xfe,0x10,0x07,0x00,0x31,0xf2,0xcf,0xa0,0x07,0x00,0x21,0x2f,
-0xf4,0x07,0x00,0x21,0x07,0xfe,0x07,0x00,0x31,0x00,0xdf,0x90,0x07,0x00,0x21,0x3f,
-0xf3,0x07,0x00,0x21,0x09,0xfd,0x07,0x00,0x31,0x00,0xef,0x77,0x07,0x00,0x21,0x5f,
-0xf9,0x07,0x00,0x21,0x0a,0xff,0x07,0x00,0x12,0x01,0x07,0x00,0x22,0x00,0x6f,0x07,
-0x00,0x22,0x0c,0xfd,0x6c,0x16,0x02,0x07,0x00,0x01,0xb0,0x20,0x02,0xd0,0x4c,0x00,
-0x17,0x11,0x11,0xf1,0x75,0x5b,0xf0,0x05,0xfb,0x30,0x4f,0xa0,0x7d,0xfe,0x91,0x04,
-0xfc,0xbf,0xee,0xff,0xd0,0x4f,0xfa,0x10,0x04,0xff,0x64,0xfe,0x0f,0x1f,0x10,0x4f,
-0x9d,0x58,0x21,0xc4,0xfe,0x6c,0x1a,0x00,0x61,0x26,0x1f,0xd4,0x0b,0x00,0x0d,0x15,
-0xd0,0x9c,0x50,0x22,0x6f,0xb0,0xea,0x5c,0x21,0x00,0x03,0xdc,0x4d,0x20,0x3e,0xfc,
-0x69,0x49,0x02,0xb2,0x45,0x0d,0x47,0x19,0x04,0x5c,0x1c,0x0f,0x74,0x5d,0x69,0x11,
-0x02,0xda,0x43,0x5f,0x01,0xbb,0xbb,0xbb,0xb8,0xd1,0x27,0x49,0x22,0x01,0x84,0x8b,
-0x08,0x42,0x0f,0xe4,0x28,0xf8,0x7e,0x6d,0x03,0xa2,0x64,0x1f,0x41,0x5a,0x35,0x77,
-0x00,0xbc,0x6d,0x10,0xf2,0xc8,0x50,0x22,0x4f,0xd0,0xa8,0x6d,0x01,0xa6,0x6d,0x0f,
-0x2c,0x2a,0x46,0x41,0xef,0x51,0xef,0x50,0xb3,0x04,0x01,0x8b,0x68,0x31,0x1f,0xd0,
-0x8f,0xe4,0x3c,0x3f,0x92,0x19,0x70,0x6b,0x36,0x78,0xd0,0x7f,0xc0,0x9f,0xc0,0x00,
-0x01,0xef,0x15,0xfd,0x10,0x00,0x09,0xf5,0x56,0x0d,0x4f,0x08,0x70,0x69,0x20,0x11,
-0x01,0x43,0x23,0x03,0x9d,0x44,0x12,0x52,0x00,0x07,0xff,0xec,0xde,0x2d,0x12,0xd3,
-0x06,0xff,0x50,0x00,0x0b,0xf9,0x11,0x11,0x11,0x11,0x01,0xff,0x40,0x0c,0x1a,0x01,
-0xdd,0x07,0x22,0x0b,0xf8,0xa7,0x6a,0x04,0x21,0x1a,0x01,0xbe,0x13,0x02,0x15,0x00,
-0x20,0x0c,0xf6,0x0f,0x00,0x01,0xff,0x25,0x10,0xcf,0x15,0x00,0x00,0x62,0x08,0x12,
-0xc0,0x15,0x00,0x14,0x80,0x33,0x67,0x0d,0x3f,0x00,0x06,0x54,0x00,0x07,0x69,0x00,
-0x01,0x7e,0x00,0x13,0xf8,0xe2,0x3f,0x21,0xec,0xcc,0xe8,0x63,0x16,0xd1,0xa8,0x00,
-0x30,0x10,0x00,0x07,0x89,0x20,0x31,0x5c,0xff,0xc5,0xea,0x29,0x70,0xf9,0x0a,0xff,
-0xde,0xff,0x90,0x0c,0xec,0x54,0x51,0xcf,0xe3,0x00,0x4f,0xf4,0x44,0x04,0x70,0xff,
-0x40,0x00,0x07,0xfb,0xaf,0x90,0x55,0x0d,0x00,0x18,0x2c,0x20,0xcf,0x60,0xc8,0x4f,
-0x00,0x55,0x50,0x00,0x13,0x01,0x02,0x3c,0x49,0x00,0x14,0x00,0x02,0x26,0x42,0x04,
-0x28,0x00,0x11,0x00,0x70,0x05,0x02,0xda,0x4b,0x01,0x29,0x01,0xf2,0x00,0xcf,0xe3,
-0x00,0x03,0xc1,0x02,0xef,0xfc,0xdf,0xf9,0x0b,0xff,0xdc,0xef,0xf6,0x31,0x01,0x12,
-0x6c,0xfb,0x16,0x27,0x2f,0xf6,0xcf,0x6a,0x2d,0x06,0xf9,0x26,0x45,0x0f,0x47,0x60,
-0x65,0x00,0x0b,0x2d,0x00,0x09,0x2d,0x00,0xe4,0x08,0x22,0x13,0x10,0xf7,0x0d,0xcb,
-0xc3,0xcf,0xc0,0x5f,0xef,0xfe,0xb0,0x5f,0xfb,0x10,0x00,0x5f,0x44,0x52,0x0f,0x04,
-0x00,0x05,0x0f,0xbf,0x00,0x66,0x04,0x27,0x10,0x14,0xf2,0xb4,0x4f,0x06,0x74,0x6c,
-0x04,0xd8,0x08,0x14,0x17,0xf5,0x36,0x00,0x86,0x56,0x91,0x05,0xfe,0xff,0xeb,0x05,
-0xff,0xb1,0x00,0x05,0x15,0x06,0x0f,0x04,0x00,0x0f,0x02,0x6b,0x22,0x02,0xf7,0x3c,
-0x22,0x06,0xfa,0xf9,0x0c,0x01,0xe8,0x2c,0x21,0x2e,0xc0,0x3c,0x44,0x1e,0x03,0x92,
-0x21,0x0f,0xd3,0x01,0x6c,0x81,0x6f,0x70,0x1d,0xe2,0x06,0xf5,0xce,0x20,0x86,0x35,
-0x2f,0x01,0x00,0xd3,0x01,0x26,0x06,0x55,0x3d,0x28,0x09,0xfa,0x11,0x0a,0x19,0x57,
-0xaf,0x19,0x0f,0x85,0x62,0x61,0x0e,0xfa,0x2c,0x25,0x03,0x62,0xe4,0x01,0x00,0xf8,
-0x6e,0x60,0x09,0xff,0xed,0xff,0xe2,0x03,0x7e,0x34,0x60,0xb0,0x6f,0xc0,0x00,0x04,
-0xff,0xab,0x51,0x61,0x01,0x10,0x0b,0xff,0xb7,0x30,0x11,0x6d,0x10,0xd6,0x46,0x09,
-0x21,0xaf,0xf9,0xd4,0x00,0x10,0xf1,0xd8,0x03,0xc0,0xff,0x27,0xfe,0x30,0x00,0x8f,
-0xe0,0x0b,0xff,0xed,0xff,0xf5,0x54,0x05,0x16,0xa2,0xad,0x3d,0x36,0x0a,0xfc,0xf3,
-0xac,0x3d,0x28,0x01,0x76,0x2a,0x48,0x0f,0xfd,0x00,0x65,0x26,0x8f,0xa0,0xbe,0x33,
-0x28,0x5f,0x70,0xde,0x1c,0x0a,0xfd,0x00,0x72,0xcf,0xc0,0x6f,0xc0,0x00,0x03,0xfe,
-0x6d,0x54,0x0c,0xfd,0x00,0x21,0x01,0x10,0xfd,0x00,0x1c,0x70,0xfd,0x00,0x3f,0xbe,
-0xfd,0xa2,0xda,0x00,0x61,0x22,0xff,0xfc,0xe3,0x67,0x02,0x88,0x1a,0x13,0x4a,0x2a,
-0x55,0x12,0xec,0x5b,0x4d,0x02,0xdc,0x05,0x2f,0xbd,0x80,0x1a,0x5a,0x33,0x10,0xff,
-0x80,0x75,0x11,0x04,0xd9,0x56,0x21,0x3a,0xfc,0xe3,0x01,0x10,0xf0,0x01,0x32,0x10,
-0xfc,0x91,0x05,0x30,0xea,0x10,0x00,0xcf,0x25,0x20,0x6f,0x80,0xe1,0x03,0x22,0xc5,
-0xfa,0x12,0x46,0x02,0xc3,0x00,0x2f,0x47,0x10,0xf7,0x02,0x6e,0x71,0x9f,0x40,0x2f,
-0xc0,0x00,0x00,0xaf,0x18,0x0d,0x29,0xcf,0xd1,0xdc,0x1f,0x0f,0xf7,0x02,0x34,0x0f,
-0xdf,0x65,0x64,0x24,0x00,0x00,0x5f,0x4d,0x22,0x8d,0xf5,0x61,0x01,0x12,0xfa,0x08,
-0x02,0x12,0xf6,0xea,0x2a,0x2f,0x70,0x00,0xcc,0x5b,0x2c,0x22,0xff,0xd0,0x0e,0x06,
-0x10,0x5a,0x4b,0x02,0x12,0xfb,0xd2,0x37,0x51,0xcd,0x70,0x00,0x01,0xec,0x24,0x2c,
-0x42,0x00,0x3f,0xb6,0xf9,0x98,0x1e,0x1c,0xa0,0xe2,0x04,0x0f,0x11,0x01,0x67,0x23,
-0x5f,0xc0,0xa5,0x15,0x10,0x8f,0x90,0x09,0x52,0xf2,0x00,0x9f,0x90,0xa8,0x40,0x74,
-0x00,0x72,0x74,0x00,0x7f,0x09,0x01,0x02,0x01,0x04,0x12,0x00,0x0f,0x09,0x00,0x09,
-0x01,0x93,0x02,0x00,0x07,0x01,0x3f,0x00,0x5d,0xfd,0xd1,0x00,0x12,0x55,0x05,0xcc,
-0xff,0xdc,0xc0,0xc4,0x26,0x0f,0xd1,0x00,0x33,0x09,0x97,0x00,0x00,0xc1,0x01,0x45,
-0x09,0xad,0xfd,0xaa,0x12,0x00,0x10,0x02,0x06,0x13,0x5e,0x1c,0xce,0xfe,0xcc,0x30,
-0xc4,0x00,0x01,0xc6,0x01,0x60,0x02,0xff,0xee,0x00,0x00,0x06,0x3c,0x28,0x40,0x89,
-0x40,0x08,0xb0,0xd6,0x49,0x9f,0xdb,0xfb,0x00,0x00,0x3f,0x60,0x5d,0xfb,0x10,0xd8,
-0x3e,0x6b,0x00,0x73,0x35,0x61,0x05,0xee,0x60,0x0d,0xb0,0x02,0x20,0x37,0x39,0x6f,
-0x10,0x4d,0x59,0x73,0x0f,0xc9,0x32,0x35,0x00,0x65,0x75,0x00,0xc5,0x02,0x0e,0x00,
-0x0e,0x0f,0x1b,0x69,0x5c,0x15,0x03,0xed,0x27,0x1f,0x70,0xe7,0x00,0x41,0x50,0x05,
-0x80,0x00,0x38,0x20,0xdc,0x0d,0x11,0x3d,0x83,0x13,0x21,0xff,0xe5,0x69,0x51,0x1f,
-0x30,0xdf,0x01,0x65,0x43,0xcf,0x00,0x0a,0xf1,0xf8,0x27,0x1a,0x09,0xf8,0x27,0x0f,
-0x63,0x35,0x37,0x30,0x08,0xdc,0x30,0x50,0x00,0x20,0xd3,0x6f,0xca,0x02,0x30,0xa7,
-0x00,0xd4,0x05,0x11,0x22,0xc0,0x3f,0xb4,0x07,0x1f,0x60,0xe6,0x01,0x64,0x30,0x00,
-0x01,0xae,0xbc,0x54,0x90,0xba,0x26,0xf0,0x00,0x00,0x0c,0x70,0x3f,0x10,0x38,0x5c,
-0x18,0x60,0x40,0x55,0x0f,0xa1,0x35,0x37,0x21,0x06,0xfd,0xfa,0x11,0x20,0xef,0x24,
-0x83,0x19,0x40,0x7f,0x61,0xee,0x20,0xbd,0x0e,0x2f,0x59,0x30,0xd0,0x03,0x65,0x80,
-0x8f,0xa0,0xaf,0xa0,0x00,0x02,0xfe,0x16,0xea,0x29,0x10,0xf4,0x7f,0x51,0x48,0x18,
-0x60,0x68,0x20,0xf5,0x00,0x1f,0x90,0x06,0x00,0x1d,0x01,0xf8,0x01,0x12,0x90,0xfa,
-0x00,0x02,0xf9,0x01,0x02,0xfb,0x00,0x0f,0xd3,0x01,0x47,0x12,0xfb,0xd3,0x01,0x20,
-0x50,0x09,0x1c,0x58,0x20,0xb0,0x00,0x88,0x32,0x11,0x90,0x25,0x00,0x14,0x40,0x71,
-0x15,0x00,0x47,0x33,0x02,0x77,0x07,0x11,0xcc,0x43,0x45,0x2f,0xcf,0xc1,0xd2,0x01,
-0x35,0x10,0x80,0x87,0x00,0x01,0x9e,0x15,0x10,0xc0,0x6c,0x01,0x02,0x70,0x6f,0x20,
-0xeb,0x80,0xcd,0x03,0x25,0xe6,0x00,0x26,0x45,0x06,0x2a,0x45,0x16,0x00,0x2e,0x45,
-0x03,0xda,0x52,0x0a,0x82,0x51,0x01,0xb8,0x34,0x20,0x4f,0xe0,0x85,0x0c,0x21,0x0e,
-0xf5,0xea,0x6b,0x00,0xdc,0x1f,0x00,0x84,0x2a,0x11,0xdf,0xdb,0x09,0x00,0x88,0x03,
-0x30,0x2f,0xef,0xb0,0xfb,0x67,0x10,0x3f,0xa3,0x2b,0x10,0xef,0x20,0x0b,0x00,0xb6,
-0x18,0x60,0xbf,0x4a,0xf4,0x00,0x0b,0xf7,0x03,0x00,0x40,0x0f,0xf0,0x6f,0x80,0x12,
-0x00,0x61,0x7f,0xb0,0x04,0xfa,0x01,0xfd,0xe3,0x5f,0x81,0xfe,0x00,0x9f,0x60,0x0d,
-0xf1,0x06,0xfb,0xd7,0x7a,0x40,0xf1,0x00,0x8f,0x60,0x65,0x2d,0x70,0xbf,0x62,0xfc,
-0x00,0x04,0xfa,0x0d,0xcf,0x70,0x61,0xf9,0x6f,0x80,0x00,0x0f,0xe1,0x8d,0x68,0x51,
-0xcb,0xf3,0x00,0x00,0xaf,0xb3,0x13,0x20,0xfe,0xee,0xae,0x02,0x11,0xf7,0x77,0x60,
-0x00,0x42,0x7a,0x01,0x1b,0x19,0x01,0xa7,0x57,0x21,0xdf,0xf0,0x5f,0x01,0x06,0x1d,
-0x47,0x24,0x03,0xfe,0x3a,0x5e,0x11,0xac,0xfd,0x56,0x00,0xa3,0x48,0x12,0xcd,0xaa,
-0x06,0x05,0x42,0x39,0x03,0xd9,0x03,0x0f,0xce,0x63,0x61,0x05,0xeb,0x25,0x42,0x00,
-0xbf,0xcf,0x20,0x59,0x79,0x21,0xdd,0x10,0x2d,0x3b,0x2f,0x01,0x84,0x8f,0x45,0x76,
-0x01,0x7b,0x3f,0x00,0x3a,0x01,0x00,0x7a,0x0d,0x00,0x7f,0x3f,0x01,0x7f,0x04,0x1f,
-0x10,0xae,0x38,0x61,0x20,0x04,0xfb,0x6e,0x69,0x04,0xd9,0x4f,0x05,0x7f,0x4a,0x03,
-0x8a,0x00,0x0f,0x7a,0x6e,0x6c,0x00,0x5d,0x01,0x03,0x0e,0x7e,0x01,0x32,0x05,0x02,
-0x3b,0x0b,0x16,0x67,0x3b,0x24,0x02,0xd2,0x26,0x10,0xbe,0x92,0x59,0x02,0x64,0x7e,
-0x02,0x44,0x35,0x24,0xcf,0xc0,0x2e,0x58,0x04,0x9e,0x12,0x01,0xc4,0x6f,0x00,0x93,
-0x1f,0x06,0x2d,0x04,0x21,0xef,0x90,0x29,0x01,0x24,0xd0,0x00,0x4a,0x3b,0x03,0xe9,
-0x51,0x27,0x0b,0xfc,0x12,0x4a,0x20,0xff,0xfd,0x3c,0x27,0x13,0x5f,0xae,0x5b,0x02,
-0x3b,0x00,0x11,0x01,0xde,0x33,0x28,0xaf,0x40,0x71,0x3b,0x01,0x8a,0x00,0x71,0xc0,
-0xac,0xcc,0xcc,0xcf,0xfa,0x00,0x69,0x73,0x00,0x0f,0x01,0x10,0x50,0x2c,0x00,0x14,
-0x90,0x65,0x00,0x24,0x6f,0xf2,0x8e,0x00,0x21,0x0d,0xfa,0x57,0x01,0x14,0x10,0x13,
-0x6f,0x10,0xef,0x94,0x53,0x00,0xe3,0x63,0x00,0x14,0x18,0x22,0x0b,0xe3,0x00,0x01,
-0x1a,0x70,0x2d,0x2f,0x0f,0x86,0x6f,0x5d,0x00,0x2c,0x0e,0x05,0x0b,0x65,0x18,0x56,
-0x85,0x00,0x0f,0x72,0x66,0x32,0x41,0x1e,0xd0,0x07,0xf8,0x9e,0x0c,0x11,0xfa,0xa6,
-0x00,0x1b,0xfb,0x9d,0x0c,0x0f,0xd9,0x01,0x5c,0x20,0x03,0xea,0xcf,0x01,0x44,0x03,
-0xf9,0x8f,0x40,0x45,0x00,0x2f,0x01,0x10,0xd9,0x01,0x3d,0x81,0x5c,0xfe,0x60,0x5f,
-0xfe,0xd4,0x0d,0xf9,0x43,0x28,0x1e,0x1f,0xf3,0x1e,0x0f,0x07,0x00,0x0b,0x09,0x01,
-0x00,0x0d,0xe0,0x7e,0x05,0x01,0x00,0x04,0x77,0x2c,0x17,0xea,0x14,0x00,0x83,0xf7,
-0xf5,0x00,0xfc,0xf5,0x00,0xf1,0x00,0x9c,0x7d,0x0d,0x01,0x00,0x4f,0x04,0x03,0x00,
-0x04,0x18,0x00,0x01,0x2f,0xe0,0x00,0x01,0x00,0x17,0x1f,0xd6,0x20,0x00,0x0c,0x03,
-0x90,0x00,0xb1,0xf5,0x00,0xfe,0x00,0x00,0xe8,0xfd,0xf0,0xf3,0x00,0xee,0x11,0x00,
-0x00,0x0f,0x00,0x4d,0xfd,0xfe,0xf7,0xfa,0x9a,0x00,0x00,0xca,0x0e,0x33,0xfc,0x00,
-0x00,0x59,0x05,0x0e,0x1c,0x00,0x0b,0x0a,0x00,0x0a,0x67,0x3d,0x05,0x87,0x07,0x00,
-0x7c,0x25,0x13,0xfc,0x4c,0x00,0x3b,0xfc,0xf8,0xfc,0x46,0x00,0x1c,0xfa,0x08,0x01,
-0x04,0x09,0x00,0x21,0xfc,0xfd,0x36,0x00,0x28,0xfd,0xfb,0x32,0x00,0x11,0xd4,0x12,
-0x01,0x15,0xcf,0x26,0x00,0x40,0xfa,0xfc,0x00,0x00,0xe6,0x07,0x2d,0xfc,0xfc,0x6d,
-0x80,0x03,0x98,0x00,0x2f,0x03,0xfb,0x12,0x01,0x09,0x1f,0xfc,0x55,0x01,0x0f,0x1b,
-0xf4,0xa5,0x00,0x21,0xfb,0x00,0x57,0x08,0x33,0xfc,0xf9,0xf4,0x11,0x00,0x14,0xc1,
-0xba,0x00,0x96,0xf4,0x00,0x00,0xcc,0xf6,0xdf,0xe5,0x00,0xd3,0x2d,0x00,0x37,0xf8,
-0xe7,0xef,0x3b,0x00,0x00,0xf2,0x0a,0x33,0xe6,0x00,0xdb,0xf8,0x00,0x41,0xfb,0x00,
-0xfe,0xfe,0x35,0x01,0x11,0x03,0xad,0x00,0x04,0x8d,0x01,0x06,0x3c,0x00,0x3e,0x00,
-0xfb,0xfc,0x65,0x02,0x0c,0x01,0x00,0x10,0xf1,0xc4,0x00,0x0b,0x9d,0x59,0x06,0x9f,
-0x02,0xb1,0xd7,0xd5,0x00,0x00,0xf1,0xfb,0xd3,0xfd,0x03,0x00,0x03,0x66,0x00,0xf1,
-0x02,0xeb,0xed,0x00,0xec,0xed,0xf2,0xea,0x00,0xee,0xf3,0xf5,0xf2,0xf5,0x00,0xde,
-0xeb,0xee,0x72,0x01,0x66,0xd6,0xf9,0x00,0x00,0xf2,0xfe,0x3b,0x01,0x91,0xf7,0xf8,
-0x00,0x00,0xf7,0xfa,0x00,0x00,0xfb,0xfa,0x09,0x04,0x50,0x01,0x20,0xe9,0xf5,0x94,
-0x00,0x02,0x5a,0x01,0x00,0xc7,0x02,0x23,0xfa,0xfa,0x80,0x01,0x04,0x6f,0x01,0x03,
-0xe9,0x02,0x04,0x11,0x02,0x15,0x03,0x1d,0x02,0x10,0xfc,0x30,0x01,0x16,0xfa,0xf3,
-0x01,0xf6,0x14,0x04,0xf7,0xd8,0xf6,0x00,0x00,0xee,0xfb,0xee,0xfd,0x03,0xee,0x03,
-0x03,0x02,0x03,0x00,0x03,0xf2,0xf4,0xfc,0xf9,0xf4,0xf9,0xf5,0xfc,0xf9,0xfc,0x00,
-0xfc,0xfa,0x04,0xee,0xf4,0xf4,0x9f,0x09,0x1a,0xfb,0xaf,0x01,0x01,0x4c,0x00,0x1e,
-0xfb,0xd5,0x01,0x17,0xfd,0x72,0x02,0x0c,0x01,0x00,0x1f,0xf3,0x41,0x01,0x09,0x05,
-0x36,0x00,0x0f,0x29,0x02,0x0a,0x4e,0xfe,0x00,0xfd,0xfd,0xe5,0x02,0x0f,0x55,0x00,
-0x0f,0x0f,0x4c,0x00,0x03,0x05,0xa4,0x02,0x1e,0x04,0xb7,0x02,0x1c,0xfc,0x0d,0x03,
-0x2f,0xed,0x00,0x01,0x00,0x26,0x0d,0xdf,0x02,0x1f,0xe7,0xb5,0x00,0x0b,0x25,0xfc,
-0xfd,0x3c,0x03,0x1c,0xe9,0x4f,0x02,0x11,0xfc,0x9b,0x00,0x10,0x09,0x49,0x02,0x0f,
-0x75,0x00,0x19,0x17,0x03,0x10,0x05,0x05,0x69,0x00,0x3e,0xfe,0x02,0x00,0x22,0x01,
-0x1f,0xe9,0xe4,0x00,0x26,0x1f,0xfc,0x91,0x01,0x12,0x1f,0xfd,0x41,0x00,0x20,0x12,
-0x01,0x14,0x05,0x21,0x02,0x03,0x8d,0x01,0x2e,0x04,0x05,0x03,0x54,0xf1,0x0c,0x07,
-0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,
-0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x00,0x41,0x84,0xf0,0x0a,0x1b,0x1c,
-0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,
-0x23,0x00,0x24,0x25,0x26,0x24,0x27,0xb3,0x6b,0x0d,0x4e,0x00,0x01,0x01,0x00,0xd0,
-0x00,0x08,0x0a,0x0a,0x0a,0x0a,0x0c,0x0c,0x0c,0x0c,0x09,0x0c,0x09,0x01,0x00,0xa1,
-0x00,0x00,0x0d,0x0d,0x0d,0x0d,0x17,0x00,0x00,0x1a,0x01,0x00,0x62,0x00,0x1c,0x1d,
-0x1d,0x1d,0x1d,0x98,0x09,0x10,0x21,0x01,0x00,0x02,0x3d,0x00,0x50,0x24,0x1b,0x24,
-0x06,0x1a,0x02,0x00,0x22,0x08,0x1c,0x02,0x00,0x64,0x09,0x00,0x09,0x00,0x0a,0x1d,
-0x02,0x00,0x05,0x5f,0x27,0x44,0x1f,0x00,0x00,0x0c,0x02,0x00,0x00,0x2e,0x07,0x53,
-0x00,0x0e,0x00,0x00,0x0f,0x02,0x00,0x00,0x1f,0x00,0x00,0x02,0x00,0x50,0x1f,0x00,
-0x00,0x09,0x21,0x02,0x00,0x01,0x78,0x66,0x13,0x22,0x7c,0x66,0x00,0x2a,0x11,0x01,
-0x02,0x00,0x17,0x0d,0x02,0x00,0x70,0x15,0x00,0x17,0x24,0x17,0x18,0x27,0x02,0x00,
-0x04,0x30,0x01,0x20,0x03,0x02,0x2b,0x01,0x4a,0x06,0x07,0x06,0x08,0xe0,0x00,0x00,
-0x90,0x00,0x20,0x00,0x0b,0x04,0x08,0x00,0x83,0x00,0x01,0x08,0x00,0xa2,0x0b,0x00,
-0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x78,0x22,0x72,0x16,0x00,0x17,0x17,0x17,
-0x18,0x17,0xe6,0x85,0xd1,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,
-0x1f,0x22,0x52,0x6c,0x0b,0x01,0x00,0x11,0x0a,0x01,0x00,0x26,0x24,0x0b,0x12,0x00,
-0x10,0x0b,0x01,0x00,0xa1,0x00,0x0b,0x0f,0x0f,0x0f,0x0f,0x13,0x00,0x00,0x16,0x01,
-0x00,0x20,0x25,0x17,0x01,0x00,0x02,0x53,0x00,0x02,0x41,0x01,0xa0,0x26,0x1e,0x1e,
-0x1e,0x1e,0x1f,0x00,0x1f,0x0a,0x16,0x02,0x00,0x22,0x0b,0x17,0x02,0x00,0x01,0xc8,
-0x1b,0x14,0x17,0x02,0x00,0x05,0x16,0x00,0x0b,0x01,0x00,0x1b,0x0c,0x10,0x00,0x10,
-0x19,0x02,0x00,0x51,0x19,0x00,0x00,0x0b,0x1a,0x02,0x00,0x13,0x17,0xb1,0x08,0x12,
-0x1c,0x02,0x00,0x30,0x0e,0x00,0x0e,0xd5,0x09,0x16,0x1e,0x02,0x00,0xc0,0x11,0x00,
-0x13,0x1f,0x13,0x14,0x22,0x14,0x22,0x14,0x22,0x00,
+0x2e,0xb4,0x3e,0xb0,0x03,0xec,0x06,0xff,0x00,0x6f,0xf0,0x06,0x40,0x4b,0x01,0x20,
+0x0d,0xf6,0xd3,0x03,0x1f,0x60,0x09,0x00,0x32,0x00,0x3b,0x04,0xa1,0xda,0x30,0x00,
+0x00,0x0a,0xff,0xee,0xef,0xff,0xa0,0xbd,0x02,0xb1,0x05,0xdf,0xc0,0x00,0x0a,0xf9,
+0x00,0x00,0x01,0xdf,0x80,0xcc,0x02,0x20,0x04,0xff,0x0f,0x00,0x00,0xa3,0x04,0x02,
+0xdb,0x02,0xb0,0xaf,0x8b,0xce,0xfe,0xcc,0x60,0x00,0x09,0xf9,0xef,0xff,0xa5,0x03,
+0x21,0x8f,0xa0,0x1e,0x00,0x23,0x09,0xf9,0x1e,0x00,0x18,0x80,0x2d,0x00,0x03,0x3c,
+0x00,0x31,0x01,0xef,0x80,0x5a,0x00,0x92,0xef,0xd0,0x00,0x0a,0xfe,0xdd,0xdf,0xff,
+0xb1,0x78,0x00,0x04,0xf2,0x04,0x10,0x21,0x97,0x05,0xa0,0xee,0x71,0x2f,0x90,0x00,
+0x00,0x05,0xfc,0xcf,0xff,0xd5,0x01,0x46,0x59,0x00,0x39,0x93,0xcb,0x05,0x01,0xbc,
+0x04,0x60,0x2f,0xf1,0x0f,0xff,0x30,0x00,0x96,0x05,0x23,0xff,0xfd,0x0f,0x00,0x12,
+0xf8,0x0f,0x00,0x21,0x9f,0xf3,0x0f,0x00,0x31,0xf4,0xbf,0xd0,0x0f,0x00,0x31,0x41,
+0xff,0x80,0x0f,0x00,0x30,0x06,0xff,0x20,0x0f,0x00,0x31,0x40,0x0b,0xfc,0x0f,0x00,
+0x31,0x00,0x2f,0xf7,0x0f,0x00,0x31,0x00,0x6f,0xf2,0x0f,0x00,0x31,0x00,0xcf,0xc2,
+0x0f,0x00,0x31,0x02,0xff,0x9f,0x0f,0x00,0x21,0x07,0xff,0x0f,0x00,0x31,0x00,0x0c,
+0xff,0x0f,0x00,0x22,0x00,0x2f,0x0f,0x00,0x87,0x00,0x8f,0xf1,0x00,0x01,0xdf,0x90,
+0x00,0x61,0x04,0x20,0x00,0x03,0x81,0x00,0x09,0x64,0x04,0x01,0xee,0x03,0x40,0xce,
+0xfd,0x92,0x00,0x1f,0x05,0xf1,0x05,0xff,0xff,0xf7,0x00,0x00,0x0e,0xfd,0x40,0x02,
+0x8f,0xf7,0x00,0x09,0xfd,0x10,0x00,0x00,0x6f,0xf2,0x00,0x4b,0x00,0x22,0xcf,0x80,
+0xf7,0x04,0x31,0xfd,0x07,0xfb,0xa3,0x05,0x11,0xf0,0x14,0x05,0x51,0x02,0xff,0x19,
+0xfa,0x00,0xd2,0x00,0x03,0x0f,0x00,0x13,0x17,0x1e,0x00,0x03,0x2d,0x00,0x04,0x3c,
+0x00,0x01,0x4b,0x00,0x20,0x5f,0xf2,0x5a,0x00,0x32,0x01,0x7f,0xf7,0x69,0x00,0x12,
+0xf8,0x78,0x00,0x11,0xa3,0xe3,0x06,0x00,0x67,0x01,0x04,0x82,0x04,0x00,0x08,0x05,
+0x2a,0xb0,0x00,0x85,0x04,0x0f,0xa5,0x00,0x72,0x34,0xcf,0x50,0x00,0xa3,0x04,0x00,
+0x5d,0x01,0x49,0x60,0xce,0x10,0x00,0xa6,0x04,0x0f,0xa5,0x00,0x71,0x40,0x59,0x71,
+0x02,0xd4,0x91,0x06,0x20,0xff,0xfb,0x2c,0x08,0x44,0x0c,0xc1,0x29,0xfe,0x79,0x07,
+0x0f,0xa5,0x00,0x78,0x41,0x63,0x00,0x06,0x40,0x36,0x07,0x20,0x06,0xff,0x93,0x02,
+0x4f,0xfb,0x00,0x3e,0xc0,0xa5,0x00,0x7f,0x00,0x25,0x03,0xf0,0x0b,0xe3,0x00,0x00,
+0x08,0xc1,0x9f,0xf3,0x00,0x08,0xff,0x40,0xaf,0xe3,0x08,0xff,0x50,0x00,0xaf,0xe9,
+0xff,0x50,0x00,0x00,0xbf,0xff,0x50,0x75,0x03,0xf3,0x0e,0xe2,0x00,0x00,0x06,0xff,
+0xdf,0xe2,0x00,0x06,0xff,0x60,0xcf,0xe1,0x05,0xff,0x70,0x00,0xcf,0xd1,0x9f,0x70,
+0x00,0x00,0xcf,0x40,0x50,0x00,0x00,0x01,0x22,0x04,0x21,0x8f,0x10,0xc9,0x00,0x21,
+0x1f,0x80,0x60,0x00,0x22,0xfc,0xf1,0xc9,0x00,0x12,0xfa,0xc9,0x00,0x21,0xdf,0xf1,
+0x8d,0x00,0x21,0x7f,0xdf,0xc9,0x00,0x30,0x2f,0x87,0xfc,0xc9,0x00,0x30,0x0c,0xd0,
+0x4f,0xc9,0x00,0x21,0x06,0xf3,0xc9,0x00,0x22,0x01,0xf9,0xc9,0x00,0x12,0xbe,0xc9,
+0x00,0x91,0x6f,0x40,0x00,0x3f,0xf0,0x4f,0xe0,0x1e,0xa0,0xc9,0x00,0x21,0x4a,0xe1,
+0xc9,0x00,0x21,0xfe,0xf5,0xc9,0x00,0x22,0x0d,0xff,0xc9,0x00,0x12,0x9f,0xc9,0x00,
+0x21,0x3f,0x76,0xc9,0x00,0x24,0x0c,0xd0,0x50,0x01,0x21,0xff,0x20,0x45,0x0a,0x02,
+0x4c,0x0a,0x22,0x0a,0xf6,0x54,0x09,0x05,0x62,0x03,0x21,0x05,0xfe,0x40,0x09,0x01,
+0x25,0x01,0x2f,0x4f,0xf5,0x0d,0x00,0x2d,0x20,0xf3,0xff,0x72,0x00,0x30,0xfe,0x0f,
+0xf6,0x6b,0x01,0xf1,0x05,0x90,0x7f,0xf7,0x00,0x02,0xbf,0xf2,0x00,0x9f,0xff,0xee,
+0xff,0xf4,0x00,0x00,0x4a,0xef,0xfd,0x81,0x00,0x1f,0x00,0x11,0x20,0xa0,0x01,0x11,
+0x30,0xeb,0x0a,0x01,0x30,0x01,0x2f,0x18,0x40,0x8f,0x00,0x66,0x21,0x04,0xfd,0x27,
+0x05,0x20,0xfc,0xfb,0x8e,0x04,0x20,0xed,0x14,0x0a,0x02,0x4f,0x48,0x20,0x05,0x71,
+0x8f,0x00,0x64,0xf4,0x02,0x03,0x61,0x00,0x26,0x10,0x00,0x00,0xef,0x80,0x0d,0xf9,
+0x00,0x00,0x0a,0xf5,0x00,0x9f,0x4b,0x0b,0x0f,0xad,0x01,0x65,0x00,0xac,0x0b,0x07,
+0xa1,0x05,0x2d,0x5f,0xa0,0xa1,0x05,0x30,0x08,0xff,0x10,0x2b,0x0b,0x11,0xe0,0x4b,
+0x0a,0x70,0x2f,0xf5,0x00,0x7f,0xf1,0x00,0x00,0x63,0x0b,0xf0,0x05,0xdf,0x80,0x00,
+0x02,0xff,0x40,0x00,0x05,0xff,0x10,0x00,0xaf,0xb0,0x00,0x00,0x0c,0xf9,0x00,0x3f,
+0xf2,0x90,0x03,0x12,0xf1,0x79,0x0c,0x41,0xaf,0x93,0xff,0x10,0x07,0x02,0x21,0xdf,
+0x70,0x1c,0x0d,0x22,0xff,0xe0,0xe1,0x0b,0x13,0xf6,0x40,0x07,0x12,0x50,0x83,0x09,
+0x1f,0xf5,0x0f,0x00,0x0e,0x12,0x0f,0xb2,0x0c,0x02,0xe6,0x02,0x04,0x0d,0x00,0x42,
+0xdd,0xdc,0xb7,0x20,0xc0,0x09,0x10,0x70,0x1a,0x00,0x30,0x29,0xff,0x50,0x1a,0x00,
+0x21,0x09,0xfc,0x27,0x00,0x40,0x3f,0xf0,0x0f,0xf2,0x7a,0x00,0x01,0x0d,0x00,0x20,
+0x7f,0xe0,0x0d,0x00,0x80,0x6f,0xf7,0x00,0xff,0xdc,0xcd,0xff,0xfa,0x34,0x00,0x2c,
+0xfe,0xb5,0x4e,0x00,0x08,0x0d,0x00,0xf1,0x13,0x00,0x3b,0xef,0xd9,0x10,0x00,0x00,
+0x3f,0xff,0xdf,0xfd,0x00,0x00,0x0d,0xfa,0x00,0x2e,0xf6,0x00,0x03,0xff,0x10,0x00,
+0x7f,0x90,0x00,0x5f,0xd0,0x00,0x07,0xf9,0x00,0x05,0xfc,0x31,0x06,0x20,0x6f,0xc0,
+0x10,0x00,0x60,0x06,0xfc,0x00,0x0c,0xf6,0x00,0x0d,0x00,0x20,0xff,0x30,0x0d,0x00,
+0x21,0x0d,0xf9,0x0d,0x00,0x20,0x4f,0xf9,0x0d,0x00,0x30,0x00,0x5f,0xfc,0x0d,0x00,
+0x50,0x00,0x3e,0xfb,0x06,0xfc,0x8f,0x01,0x30,0xf2,0x6f,0xc0,0x6d,0x00,0xf1,0x04,
+0x36,0xfc,0x01,0x10,0x00,0x4f,0xf0,0x6f,0xc0,0x8f,0xb9,0xbf,0xf7,0x06,0xfc,0x06,
+0xce,0xff,0xc5,0xfb,0x04,0x00,0xed,0x0c,0x11,0xc0,0x96,0x0c,0x01,0x31,0x01,0x24,
+0x55,0x00,0x71,0x0d,0xf1,0x04,0xae,0xfe,0xb3,0x00,0x06,0xff,0xec,0xef,0xf5,0x02,
+0xff,0x50,0x00,0x8f,0xe0,0x4a,0x80,0x00,0x00,0x5c,0x03,0xf0,0x05,0x0e,0xf4,0x00,
+0x4a,0xef,0xff,0xff,0x40,0x9f,0xfc,0xa8,0x8f,0xf4,0x5f,0xe3,0x00,0x00,0xef,0x4a,
+0xf8,0x16,0x00,0xf0,0x07,0xbf,0x90,0x00,0x02,0xff,0x47,0xff,0x40,0x04,0xef,0xf5,
+0x0d,0xff,0xff,0xfe,0xef,0x70,0x19,0xef,0xe9,0x17,0xc8,0x5f,0x00,0x10,0xe2,0xc2,
+0x01,0x10,0xe2,0xb9,0x0d,0x10,0xf3,0xfb,0x01,0x1f,0x63,0x63,0x00,0x37,0x50,0x19,
+0xef,0xe9,0x17,0xc8,0xf2,0x07,0x00,0x00,0x5f,0xd1,0x00,0x00,0x00,0x4f,0xae,0xc0,
+0x00,0x00,0x3f,0xb0,0x2e,0xb0,0x00,0x02,0x30,0x00,0x13,0x00,0x01,0x00,0xf0,0x1e,
+0x03,0xae,0xfe,0xb3,0x00,0x06,0xff,0xec,0xef,0xf5,0x02,0xff,0x50,0x00,0x8f,0xe0,
+0x4a,0x80,0x00,0x00,0xff,0x30,0x00,0x00,0x00,0x0e,0xf4,0x00,0x4a,0xef,0xff,0xff,
+0x40,0x9f,0xfc,0xa8,0x8f,0xf4,0x5f,0xe3,0x00,0x00,0xef,0x4a,0xf8,0x16,0x00,0xf0,
+0x07,0xbf,0x90,0x00,0x02,0xff,0x47,0xff,0x40,0x04,0xef,0xf5,0x0d,0xff,0xff,0xfe,
+0xef,0x70,0x19,0xef,0xe9,0x17,0xc8,0x4b,0x00,0xf7,0x04,0x11,0x00,0x03,0xde,0x80,
+0x0a,0xe0,0x00,0xee,0xbf,0xeb,0xf9,0x00,0x3f,0x40,0x2c,0xfb,0x10,0x00,0x01,0x00,
+0xf0,0x06,0x3a,0xef,0xeb,0x30,0x00,0x6f,0xfe,0xce,0xff,0x50,0x2f,0xf5,0x00,0x08,
+0xfe,0x04,0xa8,0x00,0x00,0x0f,0xf3,0x19,0x00,0xff,0x2f,0xef,0x40,0x04,0xae,0xff,
+0xff,0xf4,0x09,0xff,0xca,0x88,0xff,0x45,0xfe,0x30,0x00,0x0e,0xf4,0xaf,0x80,0x00,
+0x00,0xef,0x4b,0xf9,0x00,0x00,0x2f,0xf4,0x7f,0xf4,0x00,0x4e,0xff,0x50,0xdf,0xff,
+0xff,0xee,0xf7,0x01,0x9e,0xfe,0x91,0x7c,0x80,0x00,0xaf,0x50,0x09,0xf5,0x00,0x0e,
+0xf8,0x00,0xdf,0x90,0x00,0x36,0x10,0x03,0x71,0x5e,0x00,0x3c,0xff,0x06,0x00,0x9e,
+0xd5,0x00,0x00,0x00,0x8c,0x25,0xf2,0x00,0x00,0x09,0xa0,0x1e,0x30,0x00,0x00,0x1c,
+0xff,0x80,0x00,0xc7,0x00,0x41,0xf0,0x18,0x06,0xcf,0xfd,0x80,0x02,0xae,0xfd,0x91,
+0x00,0x00,0xcf,0xfe,0xdf,0xfd,0x6f,0xfe,0xdf,0xfe,0x20,0x07,0xff,0x40,0x01,0xdf,
+0xff,0x70,0x01,0xbf,0xc0,0x08,0xd7,0x00,0x00,0x6f,0xf9,0x00,0x00,0x1f,0xf2,0x5a,
+0x00,0xf2,0x04,0x3f,0xf3,0x00,0x00,0x0c,0xf5,0x00,0x03,0x79,0x9a,0xbf,0xfa,0xaa,
+0xaa,0xae,0xf6,0x01,0xbf,0xff,0x01,0x00,0x70,0xf7,0x0a,0xfe,0x51,0x00,0x3f,0xf0,
+0x24,0x00,0x21,0x0f,0xf4,0x28,0x00,0x00,0x0a,0x00,0x60,0xf2,0x00,0x00,0x4f,0xfa,
+0x00,0xc2,0x01,0x90,0xf9,0x00,0x05,0xef,0xff,0x70,0x00,0x07,0xa0,0xe0,0x01,0xf2,
+0x1e,0xf8,0x4f,0xff,0xcd,0xff,0xf1,0x00,0x4c,0xef,0xd9,0x30,0x02,0x9d,0xff,0xc8,
+0x10,0x00,0x18,0xdf,0xeb,0x40,0x00,0x3e,0xff,0xde,0xff,0x70,0x0e,0xf9,0x00,0x06,
+0xff,0x36,0xfd,0x00,0x00,0x09,0xf9,0xbf,0x70,0x00,0x00,0x38,0x6d,0xf4,0xd1,0x00,
+0x50,0x00,0x00,0x00,0x0d,0xf5,0x0b,0x00,0x00,0x16,0x00,0x70,0x03,0x26,0xfd,0x00,
+0x00,0x08,0xf9,0x55,0x00,0xf1,0x00,0xff,0x30,0x3e,0xff,0xce,0xff,0x60,0x00,0x19,
+0xef,0xea,0x30,0x00,0x00,0x0a,0x23,0x00,0x21,0x6c,0xf7,0x7d,0x00,0x60,0xb0,0x00,
+0x00,0x00,0x49,0xf7,0x39,0x00,0x60,0xd7,0x00,0x00,0x00,0x9f,0xe0,0x15,0x00,0x20,
+0xaf,0x90,0x06,0x00,0x10,0xcf,0x4f,0x00,0x25,0x01,0x64,0x49,0x01,0xf0,0x11,0x7d,
+0xfe,0xb3,0x00,0x01,0xdf,0xfd,0xef,0xf5,0x00,0xcf,0xa1,0x00,0x7f,0xf1,0x5f,0xd0,
+0x00,0x00,0xbf,0x7a,0xf8,0x00,0x00,0x06,0xfb,0xdf,0xdc,0xcc,0xcc,0xdf,0xce,0xe1,
+0x00,0x80,0xfd,0xdf,0x50,0x00,0x00,0x00,0x0b,0xf8,0x30,0x00,0xf1,0x06,0x6f,0xf1,
+0x00,0x00,0x04,0x00,0xdf,0xc2,0x00,0x1a,0xf6,0x02,0xef,0xfd,0xdf,0xfc,0x00,0x01,
+0x8d,0xff,0xc7,0x5f,0x00,0x23,0xc0,0x00,0xe1,0x02,0x7f,0x1e,0xe1,0x00,0x00,0x00,
+0x02,0x62,0x63,0x00,0x3e,0x10,0x8f,0xd6,0x00,0xef,0x7f,0x9f,0x90,0x00,0x00,0x6f,
+0x80,0x4f,0x80,0x00,0x03,0x30,0x00,0x23,0x63,0x00,0x3c,0xf3,0x00,0xce,0x20,0x0c,
+0xe3,0x00,0x1f,0xf5,0x00,0xff,0x60,0x00,0x46,0x00,0x04,0x60,0x5d,0x00,0xf0,0x06,
+0x07,0xdf,0xeb,0x30,0x00,0x1d,0xff,0xde,0xff,0x50,0x0c,0xfa,0x10,0x07,0xff,0x15,
+0xfd,0x00,0x00,0x0b,0xf7,0x56,0x02,0x80,0x6f,0xbd,0xfd,0xcc,0xcc,0xcd,0xfc,0xef,
+0x5e,0x00,0x12,0xdd,0xa2,0x01,0x00,0xa6,0x02,0xf1,0x14,0x06,0xff,0x10,0x00,0x00,
+0x40,0x0d,0xfc,0x20,0x01,0xaf,0x60,0x2e,0xff,0xdd,0xff,0xc0,0x00,0x18,0xdf,0xfc,
+0x70,0x00,0x4f,0xf4,0x00,0x04,0xfe,0x10,0x00,0x5f,0xa0,0x00,0x03,0x40,0x50,0x02,
+0x1f,0xf0,0x03,0x00,0x12,0xaf,0x5f,0xf3,0x01,0xef,0x30,0x0b,0xf4,0x00,0x04,0x20,
+0x35,0x00,0x18,0xf3,0x02,0x00,0x3f,0xe2,0x00,0x03,0xfb,0xce,0x20,0x3f,0xb0,0x0c,
+0xd1,0x01,0x00,0x00,0x10,0x00,0x3c,0x00,0x0f,0x04,0x00,0x1d,0xcf,0x8f,0x70,0x07,
+0xf7,0xbf,0xb0,0x0b,0xfb,0x27,0x20,0x02,0x72,0x44,0x00,0x25,0x21,0x00,0x79,0xef,
+0x00,0xf0,0x01,0xdf,0xfd,0x40,0x5e,0x30,0x00,0x27,0xef,0xfc,0xfc,0x20,0x00,0x00,
+0x0b,0xff,0xd0,0x98,0x02,0x61,0xdf,0xf7,0x00,0x00,0x04,0xf7,0x30,0x01,0xf4,0x15,
+0x10,0x00,0xbf,0x90,0x00,0x04,0x9c,0xb7,0x5f,0xe0,0x00,0x9f,0xff,0xff,0xdf,0xf3,
+0x07,0xff,0x61,0x03,0xbf,0xf6,0x0f,0xf6,0x00,0x00,0x0c,0xf7,0x4f,0xe0,0x00,0x00,
+0x0a,0xf8,0x7f,0xb0,0x06,0x00,0x40,0x0c,0xf6,0x5f,0xd0,0x04,0x05,0xf2,0x09,0x1f,
+0xf4,0x00,0x00,0x6f,0xe0,0x09,0xfe,0x30,0x03,0xef,0x60,0x00,0xbf,0xfd,0xdf,0xf9,
+0x00,0x00,0x06,0xce,0xfc,0x50,0x00,0x06,0x05,0xf8,0x00,0x04,0xde,0x70,0x0c,0xc0,
+0x01,0xfe,0xbf,0xdc,0xf7,0x00,0x5f,0x20,0x3d,0xfa,0x3e,0x04,0xf0,0x07,0x5f,0xb0,
+0x8d,0xfe,0x91,0x05,0xfd,0xdf,0xee,0xff,0xc0,0x5f,0xfd,0x30,0x05,0xff,0x45,0xff,
+0x10,0x00,0x0b,0xf8,0x55,0x00,0x21,0x9f,0x95,0x5f,0x03,0x00,0x0b,0x00,0x1f,0x8f,
+0x0b,0x00,0x0e,0x40,0x90,0x00,0x7f,0xe1,0x4f,0x00,0x31,0x09,0xfb,0x00,0x02,0x03,
+0x01,0x31,0x02,0x25,0x06,0x50,0x67,0x00,0xf0,0x0a,0x17,0xdf,0xec,0x50,0x00,0x02,
+0xdf,0xfd,0xdf,0xfa,0x00,0x0c,0xfb,0x10,0x03,0xef,0x80,0x5f,0xe0,0x00,0x00,0x5f,
+0xf1,0xbf,0x80,0xd1,0x03,0x20,0xdf,0x50,0xcf,0x00,0x20,0xef,0x40,0xef,0x03,0x02,
+0x0c,0x00,0x02,0x18,0x00,0x71,0x6f,0xe0,0x00,0x00,0x4f,0xf1,0x0d,0x30,0x00,0x20,
+0x02,0xef,0x3c,0x00,0x00,0x23,0x04,0x01,0x55,0x00,0x20,0x8f,0xd1,0x2a,0x06,0x20,
+0xfe,0x20,0xd8,0x03,0x10,0xe2,0x11,0x00,0x2f,0x26,0x20,0x6c,0x00,0x45,0x10,0x6f,
+0xce,0x03,0x30,0x05,0xfa,0xeb,0xb0,0x06,0x60,0xa0,0x3f,0xa0,0x00,0x00,0x23,0xae,
+0x06,0x0f,0xd8,0x00,0x43,0x00,0xad,0x01,0x60,0x00,0x4d,0xe7,0x00,0xbd,0x00,0xae,
+0x01,0x79,0xf8,0x00,0x05,0xf3,0x03,0xcf,0xa0,0xee,0x05,0x0f,0x72,0x00,0x3c,0xff,
+0x01,0xbf,0x40,0x0a,0xf4,0x00,0x00,0xff,0x70,0x0e,0xf8,0x00,0x00,0x36,0x00,0x03,
+0x60,0xd8,0x00,0x44,0x12,0x04,0x17,0x02,0x11,0x8f,0x1a,0x06,0x25,0x01,0x85,0xcd,
+0x00,0x20,0x02,0x22,0x01,0x00,0x11,0x12,0x3c,0x06,0x21,0xf8,0x2f,0x07,0x00,0x2a,
+0x80,0x00,0x01,0x00,0x11,0x18,0x18,0x01,0x21,0x08,0xff,0x0d,0x00,0x23,0x4f,0xb0,
+0x88,0x04,0x11,0x30,0xbc,0x02,0x60,0x10,0x00,0x17,0xdf,0xeb,0xd9,0xa8,0x00,0x80,
+0xef,0xfa,0x00,0x0d,0xfb,0x10,0x0d,0xff,0xa8,0x00,0x20,0x4f,0x7f,0xa8,0x00,0x10,
+0xca,0xa8,0x00,0xe0,0x04,0xf2,0x0a,0xf8,0xef,0x30,0x0c,0xa0,0x09,0xf9,0xdf,0x40,
+0x4f,0x20,0xa8,0x00,0x10,0xca,0xa8,0x00,0x86,0xe5,0xf2,0x00,0x5f,0xf0,0x0d,0xff,
+0xa0,0xa8,0x00,0x10,0xcd,0xf0,0x00,0x11,0x03,0xaf,0x06,0x03,0xed,0x04,0x11,0x8f,
+0xd0,0x02,0x21,0x9f,0xa0,0xcf,0x02,0x01,0x84,0x00,0x13,0x33,0x92,0x00,0x20,0x06,
+0xfc,0xf9,0x00,0x00,0x17,0x02,0x2f,0x9f,0x96,0x0b,0x00,0x13,0x00,0xb6,0x03,0xfa,
+0x03,0xbf,0x91,0xff,0x80,0x01,0x9f,0xf9,0x08,0xff,0xfe,0xff,0xdf,0x90,0x07,0xdf,
+0xfb,0x48,0xf9,0x2a,0x06,0x10,0xd1,0x1a,0x01,0x1f,0x31,0x63,0x00,0x3e,0x02,0x2a,
+0x06,0xdf,0x8e,0xb0,0x00,0x00,0x7f,0x70,0x3f,0xa0,0x00,0x01,0x10,0x00,0x01,0x63,
+0x00,0x3c,0x3e,0xce,0x20,0x0b,0x2a,0x06,0x0f,0x58,0x00,0x19,0x01,0x0b,0x00,0xf0,
+0x08,0x94,0xfe,0x00,0x00,0x0b,0xf9,0x1f,0xf8,0x00,0x19,0xff,0x90,0x8f,0xff,0xef,
+0xfd,0xf9,0x00,0x7d,0xff,0xb4,0x8f,0x90,0x1f,0x01,0x10,0xf3,0x1a,0x01,0x20,0xef,
+0x30,0xb2,0x06,0x11,0xf4,0x21,0x0a,0x05,0xeb,0x03,0x20,0x8f,0xc0,0xf6,0x04,0x20,
+0x3f,0xf1,0x6e,0x06,0x20,0x0d,0xf7,0x27,0x0a,0xf0,0x02,0x07,0xfc,0x00,0x05,0xfd,
+0x00,0x02,0xff,0x10,0x0a,0xf8,0x00,0x00,0xcf,0x70,0x0e,0xf2,0x8b,0x00,0x80,0x4f,
+0xd0,0x00,0x00,0x1f,0xf1,0x9f,0x70,0xad,0x06,0x70,0xdf,0x20,0x00,0x00,0x05,0xfe,
+0xfc,0x3e,0x00,0x21,0xff,0xf7,0xdc,0x01,0x11,0xf1,0x4b,0x02,0x11,0xc0,0x50,0x00,
+0x11,0x60,0x67,0x08,0x00,0x24,0x06,0x20,0x1a,0xf9,0x3d,0x08,0x20,0xff,0xe1,0xb6,
+0x08,0x10,0xfb,0x71,0x00,0x00,0xfe,0x00,0x0f,0x06,0x00,0x08,0xf0,0x0a,0xe1,0x9e,
+0xfe,0x81,0x00,0x4f,0xfe,0xfe,0xef,0xfd,0x10,0x4f,0xfc,0x20,0x04,0xff,0x90,0x4f,
+0xf1,0x00,0x00,0x6f,0xf0,0x4f,0xe0,0x0a,0x09,0x00,0x06,0x00,0x20,0x0d,0xf6,0x06,
+0x00,0x11,0x0b,0xc2,0x05,0x23,0x0c,0xf6,0x18,0x00,0x60,0xf0,0x00,0x00,0x5f,0xf0,
+0x4f,0x31,0x03,0x61,0x90,0x4f,0xfe,0xfd,0xdf,0xfd,0x48,0x00,0x1f,0x80,0x6c,0x00,
+0x0c,0x01,0x8b,0x06,0xcf,0x00,0x00,0xbf,0xa0,0x0b,0xfb,0x00,0x00,0x27,0x10,0x02,
+0x72,0x0e,0x01,0x60,0x61,0x00,0x00,0xbb,0xbb,0xbb,0xb9,0x38,0x00,0x4e,0xff,0xff,
+0xfe,0x00,0x01,0x00,0x00,0xd9,0x00,0x02,0x08,0x00,0x31,0xbf,0xf6,0x00,0xf6,0x03,
+0x10,0xff,0x67,0x00,0x00,0x31,0x06,0x11,0xef,0x41,0x00,0x42,0x0d,0xf3,0x9f,0x80,
+0xd4,0x00,0x12,0x3f,0x94,0x09,0x31,0x80,0x0d,0xf4,0x27,0x00,0x30,0x20,0x08,0xfb,
+0x9f,0x02,0x01,0xb8,0x00,0x00,0xf3,0x06,0x00,0xba,0x00,0x70,0x00,0x00,0x2f,0xf1,
+0x00,0x00,0x7f,0x96,0x06,0x00,0x24,0x04,0x80,0xf3,0x00,0x00,0xef,0xed,0xdd,0xdd,
+0xdf,0xfa,0x09,0x20,0x00,0x00,0x05,0x00,0x21,0x0b,0xf9,0xac,0x00,0x32,0x60,0x1f,
+0xf3,0x0a,0x01,0x20,0x7f,0xd0,0x08,0x00,0x30,0x2f,0xf2,0x01,0xee,0x08,0x6f,0x00,
+0x0b,0xbb,0xbb,0xbb,0x80,0x34,0x0b,0x41,0x60,0x00,0x48,0x10,0x03,0x82,0x00,0x62,
+0x03,0x31,0x40,0x08,0xf3,0x72,0x00,0x41,0xc3,0x4e,0xd0,0x00,0x93,0x00,0x12,0xfe,
+0x24,0x06,0x2f,0x14,0x30,0x0e,0x01,0x78,0xf8,0x06,0x00,0x9f,0x20,0x08,0xf3,0x00,
+0x04,0xfa,0x24,0xee,0x00,0x00,0x07,0xff,0xfd,0x30,0x00,0x00,0x01,0x32,0x00,0x77,
+0x0d,0x10,0x08,0x77,0x0d,0x8f,0x03,0xff,0x40,0x00,0x8f,0xe0,0x26,0x50,0x77,0x0d,
+0x25,0x0f,0xeb,0x00,0x05,0x22,0xf7,0xdf,0xeb,0x00,0x32,0xf1,0x7f,0x80,0xcc,0x05,
+0x22,0x1f,0xe0,0x5d,0x05,0x11,0x0a,0xeb,0x00,0x12,0xfe,0x26,0x06,0x22,0x06,0xf9,
+0x74,0x02,0x50,0x0c,0xf2,0x00,0x00,0x8f,0xeb,0x00,0x48,0xfd,0xdd,0xdd,0xef,0xeb,
+0x00,0x11,0x10,0x24,0x00,0x21,0x05,0xfc,0x5b,0x00,0x31,0x00,0x0b,0xf7,0xcb,0x0b,
+0x12,0x60,0x99,0x0c,0x16,0x7f,0xeb,0x00,0x02,0x83,0x00,0x21,0x40,0x00,0x96,0x08,
+0x12,0xf4,0x0f,0x00,0x13,0x0f,0x9a,0x00,0x41,0x0d,0xfc,0xc0,0x00,0xeb,0x05,0x2f,
+0xdf,0xc0,0x0b,0x02,0x33,0x20,0xbf,0x90,0x68,0x01,0x10,0x80,0x16,0x0a,0x10,0xa0,
+0x9f,0x06,0x11,0xf6,0x04,0x05,0x20,0xeb,0x60,0xdf,0x00,0x10,0xe5,0xa9,0x00,0x27,
+0x78,0x30,0x1e,0x09,0x12,0x4f,0x7e,0x00,0x2e,0xdd,0x10,0x35,0x03,0xf0,0x07,0x6c,
+0xef,0xea,0x40,0x00,0x00,0x2d,0xff,0xfe,0xff,0xf9,0x00,0x01,0xef,0xc3,0x00,0x07,
+0xff,0x70,0x0a,0xfc,0x00,0x4a,0x04,0x20,0x1f,0xf4,0xc1,0x00,0x30,0xf5,0x5f,0xe0,
+0x60,0x00,0x10,0x94,0xfc,0x09,0x05,0x9f,0x06,0x0b,0x07,0x00,0x12,0x8f,0x1c,0x00,
+0x01,0x2a,0x00,0x41,0x06,0x83,0x1f,0xf3,0x38,0x00,0x12,0x0b,0x46,0x00,0xe0,0x01,
+0xff,0xb2,0x00,0x06,0xff,0x70,0x00,0x3e,0xff,0xee,0xff,0xf8,0x00,0xec,0x0b,0x21,
+0xea,0x30,0x5f,0x05,0x14,0x70,0xb3,0x0b,0x20,0x5f,0x90,0x44,0x02,0x05,0xba,0x09,
+0xf0,0x02,0x01,0x8d,0xfe,0xb4,0x00,0x03,0xef,0xfd,0xef,0xf7,0x00,0xef,0x90,0x00,
+0x6f,0xf3,0x6f,0x8b,0x01,0x82,0x9b,0xf7,0x00,0x00,0x03,0x86,0xdf,0x40,0x1e,0x02,
+0x00,0xd2,0x0a,0x01,0x50,0x0c,0x00,0x8b,0x01,0x21,0x32,0x6f,0x0f,0x0a,0xf0,0x01,
+0xef,0x90,0x00,0x5f,0xf3,0x03,0xef,0xfc,0xef,0xf6,0x00,0x01,0x9d,0xfe,0xa3,0x00,
+0x50,0x00,0x00,0x00,0x76,0x00,0x01,0x00,0x30,0x09,0xff,0x70,0x07,0x00,0xcc,0x6f,
+0x79,0xf4,0x00,0x00,0x00,0x04,0xfa,0x00,0xbf,0x20,0x00,0x01,0x00,0xf0,0x06,0x6c,
+0xef,0xea,0x40,0x00,0x00,0x2d,0xff,0xfe,0xff,0xf9,0x00,0x01,0xef,0xc3,0x00,0x07,
+0xff,0x70,0x0a,0xfc,0x34,0x00,0x20,0xf0,0x1f,0x35,0x00,0xb1,0x0f,0xf5,0x5f,0xe0,
+0x00,0x00,0x00,0x07,0x94,0x7f,0xb0,0x2f,0x00,0x3e,0x9f,0xa0,0x00,0x07,0x00,0x12,
+0x8f,0x1c,0x00,0x01,0x2a,0x00,0x41,0x06,0x83,0x1f,0xf3,0x38,0x00,0x12,0x0b,0x46,
+0x00,0xf3,0x1b,0x01,0xff,0xb2,0x00,0x06,0xff,0x70,0x00,0x3e,0xff,0xee,0xff,0xf8,
+0x00,0x00,0x01,0x8d,0xff,0xea,0x30,0x00,0x00,0x01,0xdf,0x50,0x00,0x00,0x00,0xce,
+0xaf,0x40,0x00,0x00,0xbf,0x30,0xaf,0x30,0x00,0x03,0x20,0x00,0x32,0x91,0x00,0xf0,
+0x13,0x01,0x8d,0xfe,0xb4,0x00,0x03,0xef,0xfd,0xef,0xf7,0x00,0xef,0x90,0x00,0x6f,
+0xf3,0x6f,0xd0,0x00,0x00,0x9f,0x9b,0xf7,0x00,0x00,0x03,0x86,0xdf,0x40,0x00,0x00,
+0x00,0x0e,0xf4,0x26,0x00,0x01,0x40,0x00,0x60,0x0b,0xf7,0x00,0x00,0x00,0x32,0x21,
+0x00,0xf0,0x02,0x8f,0x90,0xef,0x90,0x00,0x5f,0xf3,0x03,0xef,0xfc,0xef,0xf6,0x00,
+0x01,0x9d,0xfe,0xa3,0x24,0x00,0x11,0x65,0x50,0x00,0x31,0x03,0xff,0x20,0x57,0x00,
+0x3f,0xed,0x10,0x00,0xfd,0x00,0x74,0x30,0x00,0xbe,0x30,0x25,0x00,0x10,0xf7,0x37,
+0x00,0x15,0x47,0x8c,0x00,0xf1,0x0c,0x18,0xdf,0xeb,0x40,0x00,0x3e,0xff,0xde,0xff,
+0x70,0x0e,0xf9,0x00,0x06,0xff,0x36,0xfd,0x00,0x00,0x09,0xf9,0xbf,0x70,0x00,0x00,
+0x38,0x6d,0xf2,0x00,0x10,0xef,0xfd,0x00,0x20,0x0d,0xf5,0x0b,0x00,0x00,0x16,0x00,
+0xf0,0x06,0x03,0x26,0xfd,0x00,0x00,0x08,0xf9,0x0e,0xf9,0x00,0x05,0xff,0x30,0x3e,
+0xff,0xce,0xff,0x60,0x00,0x19,0xdf,0x5e,0x00,0x50,0x03,0x83,0x00,0x48,0x30,0x5d,
+0x01,0x20,0x23,0xfc,0x2c,0x00,0x30,0x1e,0xde,0xd1,0x07,0x00,0x3f,0x02,0xfe,0x20,
+0xff,0x00,0x74,0xa0,0x01,0xdd,0x10,0x7f,0x70,0x00,0x02,0xeb,0x5f,0x80,0x9c,0x01,
+0x10,0x90,0x9c,0x00,0x26,0x40,0x00,0xfc,0x01,0x11,0xb3,0xfc,0x01,0x10,0xf6,0xfc,
+0x01,0x20,0x7f,0xf2,0xdb,0x01,0x7f,0xaf,0x8b,0xf7,0x00,0x00,0x04,0xb8,0xfc,0x01,
+0x02,0x10,0x21,0x21,0x00,0x25,0x7f,0xa0,0xfc,0x01,0x13,0xf7,0xfc,0x01,0x41,0x2e,
+0xc0,0x09,0xf6,0xf2,0x02,0x21,0x7f,0x80,0x00,0x03,0x11,0xfa,0x5e,0x00,0x26,0x06,
+0x70,0xfb,0x00,0xf0,0x05,0x0f,0xff,0xff,0xec,0x81,0x00,0x00,0x0f,0xfe,0xee,0xef,
+0xff,0x60,0x00,0x0f,0xf3,0x00,0x01,0x8f,0xf7,0x07,0x00,0x00,0x4e,0x01,0x10,0x0f,
+0xc5,0x00,0x21,0xaf,0xa0,0x07,0x00,0x31,0x3f,0xf0,0x0f,0xd3,0x00,0x31,0xf2,0x0f,
+0xf3,0x80,0x00,0x02,0x07,0x00,0x12,0xf5,0x15,0x00,0x18,0xf4,0x1c,0x00,0x27,0x4f,
+0xf0,0x38,0x00,0x02,0x46,0x00,0x01,0x54,0x00,0x21,0xfd,0xdd,0x62,0x00,0x02,0x70,
+0x00,0x01,0x2b,0x01,0x20,0xd0,0x9f,0x89,0x00,0x42,0x05,0xfd,0x0a,0xf6,0x0f,0x00,
+0x21,0xdf,0x20,0x0f,0x00,0x22,0x4f,0xb0,0x0f,0x00,0xf0,0x12,0x51,0x00,0x03,0xbe,
+0xfc,0x65,0xfd,0x00,0x00,0x04,0xff,0xfd,0xff,0xdf,0xd0,0x00,0x01,0xef,0xb1,0x00,
+0x6f,0xfd,0x00,0x00,0x6f,0xe0,0x00,0x00,0x8f,0xd0,0x00,0x0b,0xf8,0x2d,0x00,0x02,
+0x06,0x01,0x21,0x5f,0xd0,0x13,0x01,0x07,0x0f,0x00,0x22,0x0a,0xf7,0x0f,0x00,0x22,
+0x6f,0xd0,0x04,0x00,0x41,0xef,0x70,0x00,0x3e,0x4b,0x00,0xb0,0xda,0xbf,0xef,0xd0,
+0x00,0x00,0x03,0xbf,0xfd,0x73,0xfd,0xa6,0x00,0xf0,0x08,0xff,0xff,0xda,0x30,0x00,
+0x00,0x0a,0xff,0xee,0xef,0xff,0xa0,0x00,0x00,0xaf,0x90,0x00,0x05,0xdf,0xc0,0x00,
+0x0a,0xf9,0x9a,0x03,0x40,0x80,0x00,0xaf,0x90,0x32,0x00,0x00,0x0f,0x00,0x00,0xec,
+0x00,0x00,0x0f,0x00,0x00,0x87,0x01,0x90,0xce,0xfe,0xcc,0x60,0x00,0x09,0xf9,0xef,
+0xff,0xcc,0x01,0x21,0x8f,0xa0,0x1e,0x00,0x23,0x09,0xf9,0x1e,0x00,0x18,0x80,0x2d,
+0x00,0x03,0x3c,0x00,0x31,0x01,0xef,0x80,0x5a,0x00,0x92,0xef,0xd0,0x00,0x0a,0xfe,
+0xdd,0xdf,0xff,0xb1,0x78,0x00,0x14,0x40,0x07,0x01,0x06,0x07,0x00,0xc4,0x07,0xff,
+0xff,0xff,0xf0,0x00,0x00,0x05,0xcc,0xdf,0xfc,0xc0,0x15,0x00,0x54,0x3b,0xef,0xc6,
+0x5f,0xd0,0x04,0x01,0x64,0x1e,0xfb,0x10,0x06,0xff,0xd0,0x03,0x01,0x21,0xbf,0x80,
+0x23,0x00,0x03,0xf3,0x00,0x28,0xef,0x40,0x0e,0x00,0x21,0xaf,0x70,0x07,0x00,0x03,
+0x00,0x01,0x65,0x0e,0xf7,0x00,0x03,0xef,0xd0,0xff,0x00,0x51,0x3b,0xff,0xd7,0x3f,
+0xd0,0x86,0x00,0x78,0xff,0x40,0x00,0x6b,0xbb,0xbb,0xbb,0x15,0x03,0x00,0xa4,0x01,
+0x91,0xff,0xff,0xfb,0x0f,0xfe,0xee,0xee,0xee,0xe9,0xcc,0x01,0x1f,0x00,0x06,0x00,
+0x06,0x51,0xfe,0xdd,0xdd,0xdd,0x80,0x30,0x00,0x1f,0xa0,0x2a,0x00,0x0c,0x06,0x30,
+0x00,0x11,0xdb,0x30,0x00,0xc8,0xfd,0x04,0xff,0xff,0xff,0xfa,0x00,0x2b,0xbb,0xbb,
+0xbb,0x60,0x7d,0x00,0xf0,0x02,0x07,0xdf,0xeb,0x30,0x00,0x1d,0xff,0xde,0xff,0x50,
+0x0c,0xfa,0x10,0x07,0xff,0x15,0xfd,0xe3,0x02,0xc0,0xaf,0x80,0x00,0x00,0x6f,0xbd,
+0xfd,0xcc,0xcc,0xcd,0xfc,0xef,0x3d,0x00,0x12,0xdd,0xff,0x03,0x10,0x80,0xcd,0x02,
+0xf1,0x15,0xff,0x10,0x00,0x00,0x40,0x0d,0xfc,0x20,0x01,0xaf,0x60,0x2e,0xff,0xdd,
+0xff,0xc0,0x00,0x18,0xdf,0xfc,0x70,0x00,0x00,0x18,0x40,0x00,0x75,0x00,0x00,0x0f,
+0xd3,0x28,0xf8,0x00,0x00,0x04,0xdd,0x01,0x3f,0x00,0x02,0x31,0xe2,0x00,0x5b,0xa0,
+0x00,0xcf,0x00,0x0b,0xf0,0x00,0x07,0xf8,0x25,0xfc,0x62,0x02,0x65,0xfc,0x20,0x00,
+0x00,0x01,0x32,0xe8,0x00,0xf0,0x00,0x7d,0xfe,0xb3,0x00,0x01,0xdf,0xfd,0xef,0xf5,
+0x00,0xcf,0xa1,0x00,0x7f,0xf1,0xea,0x01,0xd1,0xbf,0x7a,0xf8,0x00,0x00,0x06,0xfb,
+0xdf,0xdc,0xcc,0xcc,0xdf,0xce,0x42,0x00,0x02,0xe2,0x03,0x11,0xf8,0xbc,0x03,0xf0,
+0x00,0xf1,0x00,0x00,0x04,0x00,0xdf,0xc2,0x00,0x1a,0xf6,0x02,0xef,0xfd,0xdf,0xfc,
+0x46,0x04,0x10,0xc7,0x1e,0x00,0x25,0xf4,0x00,0x45,0x05,0x2f,0x04,0x70,0xe1,0x00,
+0x5c,0x30,0x00,0x5f,0x90,0xfd,0x02,0x10,0xfd,0x19,0x00,0x2f,0x17,0x30,0xc3,0x01,
+0x3c,0x0f,0xc4,0x00,0x54,0x00,0xb6,0x03,0x00,0x67,0x01,0x11,0x08,0x91,0x00,0x20,
+0x0d,0xf0,0x06,0x00,0x30,0x0c,0xfc,0xc1,0x32,0x07,0xf3,0x13,0xdf,0xc1,0x00,0x07,
+0xdf,0xea,0x20,0x00,0x1d,0xff,0xce,0xff,0x30,0x0c,0xfc,0x10,0x08,0xfe,0x05,0xff,
+0x20,0x00,0x0d,0xf5,0xaf,0xa0,0x00,0x00,0x8f,0x9c,0xf6,0x00,0x00,0x05,0xcc,0x00,
+0x70,0xfd,0xcc,0xcc,0xcc,0xca,0xbf,0x60,0xfc,0x00,0x01,0x6d,0x06,0xf0,0x01,0x0e,
+0xfa,0x10,0x00,0x8e,0x40,0x3e,0xff,0xdc,0xff,0xf3,0x00,0x19,0xdf,0xff,0xd3,0x10,
+0x05,0x00,0x82,0x02,0x20,0x2f,0xd0,0xe2,0x04,0x20,0xf9,0x00,0x51,0x05,0x10,0xfb,
+0xfb,0x00,0xe0,0x8e,0xe7,0x00,0x00,0x1d,0xd1,0x07,0xf8,0x00,0x00,0x02,0xfc,0x5f,
+0xa0,0x3e,0x05,0x01,0x40,0x00,0x2f,0x05,0x71,0xc9,0x01,0x5c,0x90,0x8f,0x40,0x2e,
+0xd1,0x00,0x00,0xaf,0x4d,0xd1,0x94,0x01,0x10,0xe1,0x1f,0x00,0x1f,0x41,0xaa,0x02,
+0x3e,0x00,0x90,0x03,0x10,0x00,0x0a,0x03,0x11,0x50,0x30,0x07,0x20,0x6a,0xf3,0xe9,
+0x00,0x3d,0xf8,0x00,0xce,0x90,0x08,0xf1,0x05,0x01,0x7c,0xef,0xeb,0x50,0x00,0x00,
+0x3e,0xff,0xfe,0xff,0xfb,0x00,0x02,0xff,0xc3,0x00,0x06,0xff,0xa0,0x90,0x07,0x21,
+0x4f,0xf2,0x90,0x07,0x41,0x0c,0xf7,0x5f,0xf0,0x29,0x00,0x28,0x7f,0xc0,0x7b,0x07,
+0xe1,0x9f,0xb0,0x00,0x08,0xdd,0xdd,0xd7,0x8f,0xb0,0x00,0x09,0xff,0xff,0xf9,0x1c,
+0x00,0x41,0x0a,0xf9,0x4f,0xf0,0x07,0x00,0x21,0x0f,0xf6,0x07,0x00,0x40,0x08,0xfe,
+0x10,0x00,0x93,0x05,0xb0,0xdf,0xe4,0x00,0x01,0x7f,0xf7,0x00,0x1c,0xff,0xfd,0xef,
+0x7a,0x07,0x40,0x5b,0xef,0xed,0x93,0x41,0x00,0x10,0x90,0x4d,0x00,0xd2,0x9f,0x80,
+0x00,0x00,0x7f,0x60,0x6f,0x60,0x00,0x03,0x30,0x00,0x23,0x92,0x00,0x00,0x89,0x06,
+0x81,0x62,0xfd,0x04,0xff,0xfe,0xff,0xcf,0xd1,0x85,0x06,0x00,0x80,0x05,0x30,0x7f,
+0xda,0xf9,0x63,0x06,0x70,0xdf,0x60,0x00,0x00,0x5f,0xdd,0xf5,0x0b,0x00,0x10,0xcf,
+0x0b,0x00,0x02,0x16,0x00,0x01,0x21,0x00,0x11,0xd0,0x2c,0x00,0x02,0xba,0x05,0x21,
+0x03,0xbf,0xcb,0x06,0x00,0xb4,0x00,0xf0,0x04,0x31,0x00,0x00,0x0c,0xf9,0x1e,0xd4,
+0x00,0x09,0xff,0x20,0x8f,0xfe,0xdf,0xff,0x60,0x00,0x3a,0xef,0xb0,0x08,0xc0,0x08,
+0xf3,0x00,0x7f,0x40,0x00,0x00,0x04,0xfb,0x23,0xee,0x10,0x28,0x00,0x21,0xff,0xe4,
+0x0c,0x01,0x1f,0x33,0x19,0x01,0x6f,0xf8,0x00,0xed,0x00,0x0c,0xe0,0x00,0x09,0xf7,
+0x26,0xfa,0x00,0x00,0x0b,0xff,0xfb,0x10,0xc7,0x04,0x0f,0x19,0x01,0x51,0x41,0x00,
+0x00,0x64,0x00,0x15,0x03,0x21,0xff,0x10,0xc2,0x09,0x3f,0xec,0x00,0x00,0x32,0x02,
+0x75,0x20,0x7f,0x70,0xf6,0x02,0x10,0xfb,0x4c,0x00,0x14,0x27,0x43,0x07,0x00,0xb1,
+0x07,0x71,0x2f,0xd0,0x4f,0xff,0xef,0xfc,0xfd,0xae,0x07,0x80,0xd6,0xfe,0x00,0x00,
+0x07,0xfd,0xaf,0x90,0x0e,0x01,0x11,0xf6,0x19,0x01,0x00,0xa1,0x07,0x11,0xdc,0x0b,
+0x00,0x01,0x16,0x00,0x02,0x21,0x00,0x11,0x0e,0xda,0x07,0x92,0x4f,0xff,0xdf,0xfd,
+0xfd,0x00,0x3b,0xff,0xc6,0x0f,0x08,0xff,0x07,0xfc,0x03,0x10,0x00,0x00,0xcf,0x91,
+0xed,0x40,0x00,0x9f,0xf2,0x08,0xff,0xed,0xff,0xf6,0x00,0x03,0xae,0xfe,0xa3,0xf0,
+0x00,0x67,0x04,0x01,0x00,0x22,0x8f,0x90,0x50,0x00,0x11,0x80,0x07,0x00,0x21,0xcf,
+0x40,0x98,0x01,0x12,0xfd,0x1c,0x00,0x17,0x72,0x28,0x00,0x10,0x7a,0x05,0x00,0x20,
+0x1f,0xf0,0xcb,0x00,0x15,0xfa,0x31,0x00,0x2a,0x0a,0xf8,0xbd,0x01,0x0f,0x30,0x01,
+0x4f,0x00,0xd5,0x04,0x12,0x60,0xb2,0x00,0x31,0xbf,0x40,0x00,0xb8,0x01,0x20,0xbe,
+0x20,0x30,0x00,0x36,0x60,0x00,0x75,0x88,0x00,0x20,0xff,0x30,0xa2,0x05,0x11,0xf1,
+0x1e,0x05,0x3f,0x02,0xff,0x10,0x0f,0x00,0x13,0x00,0x45,0x05,0x41,0xdd,0xff,0x10,
+0xff,0x01,0x00,0x0f,0x3c,0x00,0x1c,0x0a,0x0f,0x00,0x40,0x00,0x03,0xfd,0x10,0xde,
+0x02,0xd2,0xeb,0x00,0x00,0x01,0xdd,0x14,0xf9,0x00,0x00,0x48,0x20,0x04,0x71,0x17,
+0x0a,0x11,0x05,0x5b,0x01,0x0e,0x0b,0x00,0xf1,0x06,0x08,0xdf,0xe9,0x10,0x5f,0xdd,
+0xfe,0xef,0xfc,0x05,0xff,0xd3,0x00,0x5f,0xf4,0x5f,0xf1,0x00,0x00,0xbf,0x85,0x30,
+0x0d,0x10,0x5f,0x0c,0x0e,0x11,0x95,0x1a,0x0d,0x0f,0x0b,0x00,0x0e,0x31,0x01,0xff,
+0x20,0xe1,0x0b,0x31,0x00,0x1f,0xf2,0x27,0x0e,0x14,0x00,0x11,0x00,0xb2,0x07,0xbf,
+0xfb,0xaa,0xaa,0xaa,0xab,0xff,0xa6,0xaf,0xff,0x01,0x00,0x1c,0x90,0x22,0x00,0x70,
+0x00,0x1f,0xfd,0xdd,0xdd,0xdd,0xde,0x11,0x00,0x01,0x01,0x00,0x0e,0x44,0x00,0x0f,
+0x11,0x00,0x1c,0x50,0x00,0x00,0x3f,0xf0,0x00,0x40,0x00,0x0f,0xf2,0x00,0x01,0x00,
+0xf5,0x03,0xff,0x20,0x00,0x00,0x00,0x5f,0xff,0xff,0xff,0x10,0x00,0x04,0xcc,0xff,
+0xdc,0xc1,0x00,0x00,0x1a,0x00,0xf0,0x09,0x25,0xcf,0xfb,0x30,0x00,0x0f,0xfb,0xff,
+0xef,0xff,0x30,0x00,0xff,0xf6,0x00,0x1d,0xfa,0x00,0x0f,0xf6,0x00,0x00,0x5f,0xe0,
+0x34,0x00,0x21,0x03,0xff,0x27,0x00,0x2f,0x3f,0xf0,0x0d,0x00,0x1a,0xe6,0x05,0x97,
+0x10,0x2d,0x46,0xff,0xff,0xbe,0xf2,0xcc,0x12,0xaf,0xe5,0x00,0x01,0x00,0x6f,0xdf,
+0x60,0x00,0x00,0x0d,0xf6,0x09,0x00,0x32,0x00,0x01,0x00,0xf7,0x01,0x10,0x02,0xcf,
+0x90,0x08,0xf0,0x0c,0xfb,0xfe,0xbf,0xc0,0x1f,0x60,0x1b,0xfc,0x20,0x6a,0x00,0x2f,
+0x03,0xff,0x05,0x00,0x2b,0x96,0x9f,0xff,0xff,0xff,0x46,0xbb,0xbb,0xbb,0xb2,0x53,
+0x00,0x2f,0x0d,0xf6,0xc2,0x00,0x37,0x85,0xef,0xff,0xff,0xff,0xab,0xbb,0xbb,0xba,
+0x5d,0x00,0x2f,0x3f,0xf0,0x04,0x00,0x1e,0xf6,0x00,0x18,0x40,0x00,0x75,0x0f,0xe3,
+0x28,0xf8,0x04,0xef,0xff,0xa0,0x00,0x02,0x31,0xa5,0x00,0x0f,0x04,0x00,0x2c,0xff,
+0x00,0x7f,0x40,0x05,0xf6,0x2f,0xc3,0x3d,0xf2,0x06,0xff,0xfe,0x50,0x00,0x03,0x30,
+0xa0,0x00,0x25,0x00,0xed,0x00,0x2f,0x0d,0xf6,0x05,0x00,0x11,0xf0,0x08,0xff,0x60,
+0x9f,0x70,0x5f,0x80,0x0a,0xf3,0x00,0x9f,0xdb,0x41,0xbf,0xd3,0x00,0x1e,0xd0,0x00,
+0x4f,0xf2,0x00,0x06,0x50,0x77,0x00,0x2f,0x2f,0xf0,0x03,0x00,0x0f,0xf0,0x08,0x3f,
+0xf0,0x01,0xce,0x30,0x0a,0xf3,0x00,0x0f,0xe0,0x00,0x0e,0xfb,0xc0,0x04,0xdf,0xb0,
+0x0b,0xf4,0x0f,0xf7,0x04,0x70,0xcc,0x00,0x0f,0x02,0x00,0x0d,0x3c,0x3f,0xf3,0xff,
+0x03,0x00,0x12,0xf0,0x5c,0x02,0x2f,0x05,0xfe,0x08,0x00,0x47,0xf0,0x16,0x09,0xb5,
+0x00,0x00,0x06,0xfd,0xdf,0x60,0x0b,0xfa,0x00,0x00,0x0a,0xfb,0xdf,0x60,0x05,0xff,
+0x40,0x00,0x5f,0xf4,0xdf,0x60,0x00,0xaf,0xfc,0xac,0xff,0x80,0xdf,0x60,0x00,0x05,
+0xbe,0xfe,0xb4,0x07,0x01,0xb3,0x6f,0x84,0xff,0x20,0x0a,0xfc,0x06,0x50,0x00,0x17,
+0x20,0x0d,0x01,0x6f,0x7f,0xb2,0xff,0x00,0x07,0xfb,0x09,0x00,0x1e,0xf2,0x07,0xb0,
+0x00,0x00,0x07,0xfb,0x00,0x00,0x00,0x7f,0xa0,0x00,0x00,0x0b,0xf8,0x00,0x00,0xde,
+0xff,0x30,0x00,0x0c,0xfd,0x62,0x01,0x10,0xe1,0x06,0x00,0x30,0x01,0xed,0xed,0x07,
+0x00,0xb7,0x0c,0xe2,0x2f,0xb0,0x00,0x00,0x00,0x38,0x30,0x03,0x82,0x4c,0x03,0x2f,
+0x0e,0xf6,0x07,0x00,0x3b,0xa0,0x4e,0xd0,0x00,0x00,0x0f,0xf5,0x00,0x3f,0xf2,0x00,
+0xe9,0x01,0xf1,0x16,0x0d,0xfc,0x20,0x03,0xef,0xc0,0x00,0x03,0xef,0xfe,0xef,0xfe,
+0x20,0x00,0x00,0x19,0xdf,0xfd,0x81,0x00,0x00,0x00,0x1e,0xf3,0x00,0x00,0xde,0xce,
+0x20,0x0b,0xf3,0x1d,0xd1,0x26,0x30,0x01,0x63,0x3b,0x00,0x2f,0x0f,0xf3,0x04,0x00,
+0x1f,0x00,0x96,0x04,0xd2,0x0f,0xf1,0x00,0x00,0x6f,0xe0,0x00,0xad,0xff,0x70,0x00,
+0xbf,0xd7,0x17,0x00,0xa1,0x00,0xaf,0xe2,0x00,0xff,0x30,0x00,0x00,0x8f,0xf3,0x0f,
+0x00,0x30,0x7f,0xf4,0x00,0x0f,0x00,0x21,0x5f,0xf6,0x1e,0x00,0x30,0x4f,0xf7,0x00,
+0x0f,0x00,0x21,0x3f,0xf9,0x74,0x00,0x21,0x2e,0xfb,0x25,0x05,0x21,0x5d,0xff,0x83,
+0x00,0x31,0xfe,0xff,0xf9,0x0f,0x00,0x30,0xfd,0x6f,0xf5,0x0f,0x00,0x40,0xfd,0x10,
+0x9f,0xf2,0x0f,0x00,0x41,0x40,0x00,0xcf,0xd0,0x3c,0x00,0x31,0x02,0xef,0xa0,0x4b,
+0x00,0x31,0x05,0xff,0x60,0x5a,0x00,0x31,0x08,0xff,0x20,0x69,0x00,0x22,0x0c,0xfd,
+0x78,0x00,0x62,0x1e,0xfa,0x00,0x00,0x00,0x28,0xbf,0x04,0x22,0x05,0xfb,0x60,0x01,
+0x31,0x7f,0x90,0x00,0x7d,0x01,0x12,0xf4,0x0f,0x00,0x27,0xda,0x00,0x01,0x00,0x2f,
+0x5f,0xd0,0x06,0x00,0x0c,0xc0,0x08,0xfe,0x20,0x5f,0xd0,0x00,0x7f,0xf3,0x00,0x5f,
+0xd0,0x06,0x48,0x02,0x20,0xd0,0x5f,0xbc,0x05,0x82,0xd3,0xff,0x70,0x00,0x00,0x5f,
+0xee,0xfd,0xf4,0x05,0x70,0x60,0x00,0x00,0x5f,0xfb,0x7f,0xf2,0xd4,0x05,0x20,0x0b,
+0xfd,0x36,0x00,0x30,0x01,0xef,0x90,0x3c,0x00,0x22,0x4f,0xf5,0x42,0x00,0x10,0x10,
+0x4e,0x00,0x61,0xcf,0xc0,0x00,0x00,0x68,0x10,0xa6,0x05,0x11,0x30,0xe3,0x00,0x00,
+0x0c,0x00,0x11,0x04,0xa3,0x00,0x29,0x06,0xf3,0xa8,0x04,0xa0,0xaf,0xd0,0x3f,0xf0,
+0x00,0x07,0xff,0x20,0x3f,0xf0,0x42,0x00,0x20,0x3f,0xf0,0x4e,0x00,0x40,0x3f,0xf0,
+0x0c,0xfc,0x1e,0x00,0xe0,0x9f,0xe1,0x00,0x00,0x3f,0xff,0xff,0x40,0x00,0x00,0x3f,
+0xfe,0xff,0xa0,0x12,0x00,0x20,0x4f,0xf9,0x06,0x00,0x30,0x04,0xff,0x80,0x3c,0x00,
+0x20,0x5f,0xf6,0x06,0x00,0x51,0x06,0xff,0x50,0x3f,0xf0,0x76,0x01,0x21,0x07,0x84,
+0x01,0x01,0x00,0xcd,0x00,0x31,0x02,0xfe,0x10,0x82,0x02,0x06,0xfc,0x00,0x2f,0x0f,
+0xf4,0x06,0x00,0x46,0xff,0x06,0xfe,0xdd,0xdd,0xdd,0xd4,0x0f,0xff,0xff,0xff,0xff,
+0xf5,0x00,0x5f,0xf3,0x01,0xef,0x40,0x0a,0xf5,0x00,0x07,0x72,0x04,0x16,0x0e,0x03,
+0x00,0x0f,0xab,0x00,0x54,0x27,0x00,0x00,0x2a,0x02,0x11,0x0d,0x96,0x01,0x21,0x1f,
+0xf0,0x42,0x01,0x10,0x80,0x06,0x00,0x10,0x18,0xc0,0x00,0x2f,0xf2,0xff,0x03,0x00,
+0x05,0xe0,0x00,0x01,0xff,0x2f,0xe6,0xfa,0xcf,0x33,0x60,0x0f,0xf4,0x00,0x9f,0x80,
+0x60,0x00,0x50,0xaf,0x70,0x00,0x0f,0xf4,0xf0,0x01,0x41,0x0f,0xf4,0x03,0xfc,0x72,
+0x00,0x1f,0x61,0xae,0x00,0x37,0xf0,0x04,0x2f,0xf0,0x0f,0xf0,0x2f,0xf0,0x1f,0xf0,
+0x2f,0xf0,0x5f,0xb0,0x2f,0xf0,0xbf,0x40,0x2f,0xf0,0x26,0x2b,0x01,0x0f,0x04,0x00,
+0x1e,0x0f,0x7e,0x00,0x14,0x10,0x46,0x06,0x00,0x30,0x01,0xff,0x50,0x0c,0x00,0x2f,
+0xce,0x20,0xae,0x00,0x20,0x31,0x00,0x02,0xff,0x71,0x00,0x0c,0x07,0x00,0x9f,0x01,
+0x72,0x2f,0xf0,0x9f,0xc2,0xff,0x06,0xf9,0x23,0x00,0x07,0x01,0x30,0x04,0x04,0xa3,
+0x04,0x0f,0x0d,0x00,0x0b,0x20,0x33,0x93,0x0d,0x00,0x80,0xff,0xfe,0x30,0x00,0x00,
+0x6f,0xff,0x93,0x5d,0x03,0x1f,0x7f,0x34,0x00,0x0e,0x16,0x30,0xad,0x00,0x20,0x00,
+0xff,0x01,0x00,0x9e,0x50,0x00,0xef,0x40,0x00,0x0e,0xf4,0x00,0x00,0x07,0x00,0xaf,
+0xf8,0xa1,0x02,0xff,0xfc,0x17,0xff,0xf5,0x00,0x55,0x23,0x00,0x06,0x02,0x68,0x04,
+0x21,0xbf,0xb0,0x07,0x00,0x31,0x6f,0xc0,0x00,0x47,0x02,0x11,0xd1,0x07,0x00,0x18,
+0x04,0xf8,0x05,0x20,0xff,0x90,0x50,0x02,0x20,0xf1,0x0f,0x80,0x00,0x53,0x02,0xff,
+0x10,0xff,0xfd,0x0f,0x00,0x12,0xf8,0x0f,0x00,0x21,0x9f,0xf3,0x0f,0x00,0x31,0xf4,
+0xbf,0xd0,0x0f,0x00,0x31,0x41,0xff,0x80,0x0f,0x00,0x30,0x06,0xff,0x20,0x0f,0x00,
+0x31,0x40,0x0b,0xfc,0x0f,0x00,0x31,0x00,0x2f,0xf7,0x0f,0x00,0x31,0x00,0x6f,0xf2,
+0x0f,0x00,0x31,0x00,0xcf,0xc2,0x0f,0x00,0x31,0x02,0xff,0x9f,0x0f,0x00,0x21,0x07,
+0xff,0x0f,0x00,0x41,0x00,0x0c,0xff,0xf1,0x95,0x01,0x12,0x2f,0x0f,0x00,0x80,0x00,
+0x8f,0xf1,0x00,0x00,0x00,0x9f,0xd1,0x73,0x04,0x10,0xe1,0xed,0x02,0x10,0xe2,0x23,
+0x04,0x33,0x62,0x00,0x00,0x3a,0x05,0xf0,0x0b,0x08,0xdf,0xe9,0x10,0x5f,0xdd,0xfe,
+0xef,0xfc,0x05,0xff,0xd3,0x00,0x5f,0xf4,0x5f,0xf1,0x00,0x00,0xbf,0x85,0xfd,0x00,
+0x00,0x09,0xf9,0xcc,0x04,0x6f,0x8f,0x95,0xfd,0x00,0x00,0x08,0x0b,0x00,0x0f,0x32,
+0x0f,0xf9,0x00,0xcc,0x00,0x13,0xf3,0xdb,0x00,0x12,0xd0,0x0f,0x00,0x21,0xff,0x80,
+0x0f,0x00,0x31,0xf9,0xff,0x30,0x0f,0x00,0x22,0x4b,0xfd,0xea,0x00,0x31,0x1f,0xf8,
+0x00,0xcc,0x00,0x22,0x6f,0xf2,0xdb,0x00,0x21,0xbf,0xc0,0x0f,0x00,0x31,0x02,0xff,
+0x70,0x0f,0x00,0x31,0x06,0xff,0x22,0xbd,0x00,0x22,0x0c,0xfc,0xea,0x00,0x22,0x2f,
+0xf9,0xcc,0x00,0x13,0x7f,0xdb,0x00,0x12,0xcf,0x0f,0x00,0x13,0x02,0x0f,0x00,0x36,
+0x08,0xff,0x10,0x6c,0x01,0x21,0x9f,0x70,0x07,0x00,0x23,0x0a,0xf6,0x29,0x0b,0x02,
+0xcc,0x0a,0x22,0x4f,0xb0,0x0f,0x00,0x11,0x71,0xed,0x05,0xf0,0x06,0xb0,0x8d,0xfe,
+0x91,0x05,0xfd,0xdf,0xee,0xff,0xc0,0x5f,0xfd,0x30,0x05,0xff,0x45,0xff,0x10,0x00,
+0x0b,0xf8,0xce,0x00,0x1f,0x9f,0xef,0x00,0x14,0x01,0x0b,0x00,0x27,0x90,0x00,0x76,
+0x06,0x21,0x08,0xf8,0x0b,0x02,0x10,0x50,0xff,0x00,0x01,0x52,0x06,0x02,0x62,0x01,
+0x31,0xaf,0x30,0x3f,0x17,0x02,0x31,0xce,0x4e,0xd1,0x1e,0x08,0x22,0xef,0xe2,0x55,
+0x0b,0x1f,0x83,0x1e,0x02,0x78,0x91,0x7f,0x50,0x1e,0xd1,0x00,0x00,0x9f,0x5d,0xe2,
+0xce,0x07,0x00,0x92,0x00,0x1f,0x41,0x1e,0x02,0x3c,0x13,0x0e,0x20,0x0d,0x11,0x10,
+0xf9,0x06,0x01,0x1f,0x01,0x12,0x09,0x84,0x05,0x18,0x15,0x69,0x00,0x11,0x00,0x6a,
+0x00,0x12,0x00,0x6b,0x00,0x11,0x00,0x6c,0x00,0x21,0x80,0x05,0x6d,0x00,0x12,0x00,
+0x71,0x01,0x11,0x05,0x4e,0x00,0x0f,0x0d,0x00,0x14,0x10,0x1f,0x7d,0x08,0x52,0x07,
+0xfd,0x1f,0xff,0x20,0x07,0x00,0x12,0xb0,0x07,0x00,0x11,0xf6,0x07,0x00,0x30,0xf9,
+0xfe,0x10,0x07,0x00,0x31,0xf2,0xcf,0xa0,0x07,0x00,0x21,0x2f,0xf4,0x07,0x00,0x21,
+0x07,0xfe,0x07,0x00,0x31,0x00,0xdf,0x90,0x07,0x00,0x21,0x3f,0xf3,0x07,0x00,0x21,
+0x09,0xfd,0x07,0x00,0x31,0x00,0xef,0x77,0x07,0x00,0x21,0x5f,0xf9,0x07,0x00,0x21,
+0x0a,0xff,0x07,0x00,0x12,0x01,0x07,0x00,0x22,0x00,0x6f,0x07,0x00,0x21,0x0c,0xfd,
+0xd0,0x00,0x12,0x07,0x07,0x00,0x22,0x08,0xfb,0x4b,0x0c,0x01,0x1c,0x02,0x30,0x3e,
+0xff,0xf1,0x07,0x00,0xf0,0x15,0x4e,0xfb,0x30,0x4f,0xa0,0x7d,0xfe,0x91,0x04,0xfc,
+0xbf,0xee,0xff,0xd0,0x4f,0xfa,0x10,0x04,0xff,0x64,0xfe,0x00,0x00,0x09,0xfb,0x4f,
+0xe0,0x00,0x00,0x6f,0xc4,0xfe,0x00,0x00,0x05,0xfd,0x0b,0x00,0x2f,0x5f,0xd4,0x0b,
+0x00,0x0d,0x10,0xd0,0x39,0x01,0x11,0xfc,0x7b,0x04,0x10,0xb0,0x7b,0x00,0x10,0xf8,
+0x71,0x0d,0x00,0x64,0x01,0x80,0x3e,0xfc,0x30,0x00,0x09,0xff,0xff,0xff,0xe8,0x01,
+0x6d,0x6b,0xbb,0xbb,0xbb,0x20,0x00,0x01,0x00,0xa0,0x6c,0xef,0xd9,0x20,0x00,0x00,
+0x02,0xdf,0xff,0xff,0xe0,0x08,0x61,0xef,0xd4,0x00,0x28,0xff,0x70,0x25,0x04,0x51,
+0x06,0xff,0x20,0x0f,0xf4,0x4e,0x00,0x21,0x05,0xfe,0x5b,0x00,0x31,0xd0,0x7f,0xb0,
+0xca,0x0d,0x31,0x09,0xfa,0x00,0x98,0x02,0x21,0x9f,0xa0,0xea,0x03,0x13,0x19,0x0f,
+0x00,0x03,0x1e,0x00,0x04,0x2d,0x00,0x03,0x3c,0x00,0x01,0x4b,0x00,0x30,0x05,0xff,
+0x20,0x5a,0x00,0x32,0x17,0xff,0x70,0x69,0x00,0x11,0x80,0x78,0x00,0x11,0xda,0xe6,
+0x02,0x9a,0xff,0xff,0xfb,0x00,0x01,0xbb,0xbb,0xbb,0xb8,0x97,0x00,0xf0,0x03,0x17,
+0xdf,0xec,0x50,0x00,0x02,0xdf,0xfd,0xdf,0xfa,0x00,0x0c,0xfb,0x10,0x03,0xef,0x80,
+0x5f,0xe9,0x00,0xf0,0x00,0xf1,0xbf,0x80,0x00,0x00,0x0d,0xf5,0xdf,0x50,0x00,0x00,
+0x0a,0xf8,0xef,0x40,0x11,0x02,0x02,0x0c,0x00,0x02,0x18,0x00,0x71,0x6f,0xe0,0x00,
+0x00,0x4f,0xf1,0x0d,0x30,0x00,0xc0,0x02,0xef,0xfd,0xdf,0xfa,0x00,0x00,0x18,0xdf,
+0xeb,0x50,0x00,0xf0,0x06,0x00,0x01,0x84,0x00,0x07,0x50,0x00,0x00,0x00,0x0f,0xe4,
+0x28,0xf8,0x00,0x00,0x00,0x00,0x4e,0xff,0xfb,0x00,0x01,0x00,0x37,0x03,0x41,0x00,
+0x01,0x00,0xf0,0x17,0x06,0xce,0xfd,0x92,0x00,0x00,0x00,0x2d,0xff,0xff,0xff,0xf7,
+0x00,0x00,0x0e,0xfd,0x40,0x02,0x8f,0xf7,0x00,0x09,0xfd,0x10,0x00,0x00,0x6f,0xf2,
+0x00,0xff,0x40,0x00,0x00,0x00,0xcf,0x80,0x5f,0xe0,0x29,0x00,0x21,0xfd,0x07,0x40,
+0x00,0xb0,0x3f,0xf0,0x9f,0xa0,0x00,0x00,0x00,0x02,0xff,0x19,0xfa,0x0f,0x00,0x23,
+0x2f,0xf1,0x0f,0x00,0x13,0x17,0x1e,0x00,0x03,0x2d,0x00,0x04,0x3c,0x00,0x01,0x4b,
+0x00,0x20,0x5f,0xf2,0x5a,0x00,0x32,0x01,0x7f,0xf7,0x69,0x00,0x12,0xf8,0x78,0x00,
+0xf5,0x0a,0xa3,0x00,0x00,0x00,0xaf,0x10,0x09,0xf2,0x00,0x00,0x6f,0x92,0x4f,0xd0,
+0x00,0x00,0x08,0xff,0xfd,0x20,0x00,0x00,0x00,0x13,0x20,0x9d,0x00,0xf1,0x01,0x17,
+0xdf,0xec,0x50,0x00,0x02,0xdf,0xfd,0xdf,0xfa,0x00,0x0c,0xfb,0x10,0x03,0xef,0x8a,
+0x00,0xf2,0x05,0x5f,0xf1,0xbf,0x80,0x00,0x00,0x0d,0xf5,0xdf,0x50,0x00,0x00,0x0a,
+0xf8,0xef,0x40,0x00,0x00,0x09,0xf9,0x0c,0x00,0x02,0x18,0x00,0x71,0x6f,0xe0,0x00,
+0x00,0x4f,0xf1,0x0d,0x30,0x00,0x20,0x02,0xef,0x3c,0x00,0x50,0x00,0x18,0xdf,0xeb,
+0x50,0x50,0x00,0x30,0xef,0x51,0xef,0x08,0x00,0xff,0x03,0x7f,0x90,0xcf,0x70,0x00,
+0x00,0x00,0x1f,0xd0,0x8f,0x90,0x00,0x00,0x00,0x04,0x92,0x19,0x70,0x11,0x01,0x77,
+0xff,0x07,0x00,0x7f,0xc0,0x9f,0xc0,0x00,0x01,0xef,0x15,0xfd,0x10,0x00,0x09,0xf5,
+0x2f,0xe1,0x00,0x00,0x08,0x70,0x69,0x20,0x11,0x01,0x43,0x32,0x03,0x9d,0xff,0x01,
+0x00,0x51,0x00,0x07,0xff,0xec,0xde,0x0a,0x00,0xc0,0xf0,0x06,0xff,0x50,0x00,0x0b,
+0xf9,0x11,0x11,0x11,0x11,0x01,0xb1,0x00,0x20,0xbf,0x80,0x77,0x00,0x51,0x6f,0xc0,
+0x00,0x00,0x0b,0x45,0x02,0x34,0x0a,0xf8,0x00,0x15,0x00,0x24,0xbf,0x60,0x15,0x00,
+0x20,0x0c,0xf6,0x0f,0x00,0x60,0xff,0xff,0xff,0xfe,0x00,0xcf,0x15,0x00,0x75,0xfe,
+0xdd,0xdd,0xdd,0xc0,0x0c,0xf6,0x2a,0x00,0x2e,0xcf,0x60,0x3f,0x00,0x07,0x54,0x00,
+0x07,0x69,0x00,0x01,0x7e,0x00,0x01,0x15,0x00,0x00,0x93,0x00,0x76,0xcc,0xff,0xed,
+0xdd,0xdd,0xdd,0xd1,0xa8,0x00,0xa0,0x10,0x00,0x07,0xdf,0xeb,0x40,0x00,0x5c,0xff,
+0xc5,0x05,0x01,0xf0,0x16,0xef,0xf9,0x0a,0xff,0xde,0xff,0x90,0x0c,0xfb,0x10,0x04,
+0xff,0xcf,0xe3,0x00,0x4f,0xf4,0x4f,0xe0,0x00,0x00,0x6f,0xff,0x40,0x00,0x07,0xfb,
+0xaf,0x90,0x00,0x00,0x0f,0xfd,0x00,0x00,0x03,0xfe,0x7c,0x00,0x60,0x0d,0xfe,0xcc,
+0xcc,0xcd,0xff,0x13,0x01,0x11,0x0b,0x47,0x00,0x00,0x14,0x00,0x11,0x0c,0xad,0x01,
+0x04,0x28,0x00,0x00,0x45,0x01,0x31,0x00,0x00,0x5f,0xa3,0x01,0x01,0x29,0x01,0xf2,
+0x00,0xcf,0xe3,0x00,0x03,0xc1,0x02,0xef,0xfc,0xdf,0xf9,0x0b,0xff,0xdc,0xef,0xf6,
+0x31,0x01,0x40,0x6c,0xef,0xea,0x30,0xe2,0x01,0x21,0xf6,0x00,0xd6,0x00,0x11,0x70,
+0xb2,0x00,0x12,0xf9,0xae,0x00,0x07,0x43,0x02,0xf0,0x08,0x0f,0xff,0xff,0xff,0xc8,
+0x10,0x00,0x0f,0xfe,0xee,0xef,0xff,0xf4,0x00,0x0f,0xf3,0x00,0x00,0x3c,0xfe,0x10,
+0x0f,0xf3,0xe9,0x00,0x31,0x60,0x0f,0xf3,0x05,0x02,0x21,0x0f,0xf3,0x08,0x01,0x02,
+0x15,0x00,0x10,0x50,0x07,0x00,0x91,0x3d,0xfd,0x00,0x0f,0xfe,0xdd,0xdf,0xff,0xd2,
+0x3f,0x00,0x20,0xfa,0x00,0x38,0x00,0x31,0x08,0xfd,0x00,0x3f,0x00,0x21,0xef,0x60,
+0x07,0x00,0x21,0x7f,0xe0,0x07,0x00,0x21,0x0e,0xf7,0x07,0x00,0x31,0x06,0xff,0x10,
+0x46,0x00,0x12,0xdf,0x4d,0x00,0x00,0xc0,0x00,0xe1,0x8f,0xd1,0x00,0x03,0xfe,0x20,
+0x00,0x0d,0xe2,0x00,0x00,0x13,0x10,0x00,0xd6,0x00,0xb1,0xc3,0xcf,0xc0,0x5f,0xef,
+0xfe,0xb0,0x5f,0xfb,0x10,0x00,0x2b,0x02,0x1f,0xd0,0x04,0x00,0x0f,0x0f,0xbf,0x00,
+0x66,0x03,0x01,0x00,0x22,0x0e,0xf2,0x46,0x01,0x02,0x12,0x00,0x21,0x2f,0xe0,0x07,
+0x00,0x22,0x9f,0x70,0x00,0x03,0x04,0x25,0x00,0xff,0x03,0x05,0xfc,0x3c,0xfc,0x05,
+0xfe,0xff,0xeb,0x05,0xff,0xb1,0x00,0x05,0xfe,0x00,0x00,0x05,0xfd,0x04,0x00,0x0f,
+0x10,0x00,0x97,0x03,0xf0,0x09,0xfe,0x00,0x00,0x03,0xfd,0x00,0x00,0x06,0xfa,0x00,
+0x00,0x0d,0xf3,0x00,0x00,0x03,0x60,0x00,0x00,0x00,0x2e,0xc0,0x08,0xf6,0x19,0x05,
+0x22,0xfa,0x7f,0x9a,0x02,0x12,0xfa,0x09,0x04,0x0f,0xd3,0x01,0x6f,0xff,0x00,0x6f,
+0x70,0x1d,0xe2,0x06,0xf5,0xce,0x20,0x00,0x7f,0xe2,0x00,0x00,0x01,0x00,0xd3,0x01,
+0x26,0x00,0x65,0x03,0x11,0xef,0xdc,0x00,0x12,0x09,0xdc,0x00,0x21,0x4f,0xb0,0x07,
+0x00,0x17,0x57,0xf8,0x04,0x30,0x01,0x7c,0xff,0xde,0x02,0xf0,0x00,0x3e,0xff,0xfe,
+0xff,0xf9,0x00,0x00,0xef,0xc3,0x00,0x06,0xff,0x70,0x05,0xff,0xf7,0x04,0x40,0xf0,
+0x07,0xfc,0x00,0xb6,0x00,0x01,0x0e,0x00,0x00,0x46,0x05,0x31,0xd3,0x00,0x00,0x22,
+0x05,0x20,0xd8,0x30,0x08,0x00,0x40,0x7d,0xff,0xfd,0x60,0x08,0x00,0x31,0x38,0xdf,
+0xfc,0x20,0x00,0x41,0x04,0xef,0xc0,0x00,0xfa,0x04,0x30,0xf2,0x0f,0xf4,0x38,0x00,
+0x30,0xf4,0x0b,0xfa,0xc8,0x01,0xc0,0xf3,0x03,0xff,0xa2,0x00,0x04,0xdf,0xd0,0x00,
+0x4e,0xff,0xfd,0xe9,0x05,0x51,0x01,0x7c,0xef,0xec,0x70,0x84,0x03,0x10,0xc0,0xd6,
+0x00,0x60,0xd1,0x00,0x00,0x00,0x1e,0xd1,0x86,0x01,0x15,0x62,0xe4,0x01,0xf1,0x1b,
+0xcf,0xfd,0x91,0x00,0x09,0xff,0xed,0xff,0xe2,0x03,0xff,0x40,0x01,0xdf,0xb0,0x6f,
+0xc0,0x00,0x04,0xff,0x04,0xff,0x20,0x00,0x01,0x10,0x0b,0xff,0xb7,0x30,0x00,0x00,
+0x06,0xdf,0xff,0xd6,0x00,0x00,0x00,0x15,0xaf,0xf9,0xd4,0x00,0x10,0xf1,0xd8,0x03,
+0xc0,0xff,0x27,0xfe,0x30,0x00,0x8f,0xe0,0x0b,0xff,0xed,0xff,0xf5,0x54,0x05,0x11,
+0xa2,0xab,0x03,0x11,0x50,0x7d,0x04,0x20,0xfc,0xf3,0x07,0x00,0xbf,0x8f,0x60,0xce,
+0x10,0x00,0x00,0x01,0x76,0x00,0x17,0x50,0xfd,0x00,0x6e,0x20,0x8f,0xa0,0xf2,0x05,
+0xdf,0x9f,0x90,0x00,0x00,0x6f,0x80,0x5f,0x70,0x00,0x03,0x30,0x00,0x23,0xfd,0x00,
+0x02,0x90,0xcf,0xc0,0x6f,0xc0,0x00,0x03,0xfe,0x04,0xff,0x0a,0x06,0x0c,0xfd,0x00,
+0x21,0x01,0x10,0xfd,0x00,0x1c,0x70,0xfd,0x00,0x3f,0xbe,0xfd,0xa2,0xda,0x00,0x61,
+0x31,0xff,0xfc,0x70,0x67,0x01,0x11,0x80,0x2f,0x00,0x22,0x4a,0xf9,0xd0,0x00,0x21,
+0xec,0x00,0x4d,0x00,0x02,0xdc,0x05,0x10,0xbd,0x1c,0x00,0xf1,0x08,0x5c,0xff,0xd9,
+0x10,0x00,0x9f,0xfe,0xdf,0xfe,0x20,0x3f,0xf4,0x00,0x1c,0xfc,0x06,0xfc,0x00,0x00,
+0x3f,0xe0,0x4f,0xf2,0x5b,0x06,0x61,0xfb,0x73,0x00,0x00,0x00,0x6d,0x82,0x00,0xf0,
+0x14,0x01,0x5a,0xff,0x90,0x11,0x00,0x00,0x04,0xff,0x1c,0xf7,0x00,0x00,0x0f,0xf2,
+0x7f,0xe3,0x00,0x08,0xfe,0x00,0xbf,0xfe,0xdf,0xff,0x50,0x00,0x6b,0xff,0xea,0x20,
+0x00,0x00,0x04,0xf9,0xa0,0x00,0x21,0x3a,0xfc,0xe3,0x01,0x60,0xf0,0x00,0x00,0x00,
+0x26,0xfc,0x91,0x05,0x10,0xea,0xe5,0x01,0x40,0xdd,0x10,0x6f,0x80,0xe1,0x03,0x21,
+0xc5,0xfa,0xc3,0x00,0x12,0xff,0xc3,0x00,0x2f,0x47,0x10,0xf7,0x02,0x6e,0x90,0x9f,
+0x40,0x2f,0xc0,0x00,0x00,0xaf,0x4e,0xd1,0x9e,0x02,0x10,0xd1,0x38,0x00,0x1f,0x41,
+0xf7,0x02,0x3c,0x11,0x6f,0xeb,0x06,0xa2,0xfc,0x5e,0xee,0xee,0xff,0xee,0xee,0xea,
+0x00,0x00,0x80,0x08,0x0f,0x07,0x00,0x51,0x21,0xaf,0x30,0x07,0x00,0x22,0x8d,0xf5,
+0x61,0x01,0x12,0xfa,0x08,0x02,0x02,0x35,0x07,0x20,0xdd,0x70,0xcd,0x05,0x15,0x90,
+0x04,0x00,0x88,0xef,0xff,0xff,0xf0,0x9a,0xdf,0xda,0xa0,0x14,0x00,0x0f,0x04,0x00,
+0x02,0xb2,0x7f,0xc0,0x00,0x00,0x2f,0xfe,0xe0,0x00,0x05,0xff,0xd0,0x0e,0x06,0x10,
+0x5a,0x4b,0x02,0xe0,0xfb,0x00,0x00,0x49,0xf7,0x00,0x00,0xcd,0x70,0x00,0x01,0xec,
+0x00,0x8f,0x5c,0x00,0x31,0x3f,0xb6,0xf9,0x45,0x01,0x2c,0xff,0xa0,0xe2,0x04,0x0f,
+0x11,0x01,0x67,0x63,0x5f,0xc0,0x00,0x00,0x05,0xfb,0x14,0x03,0x92,0x0d,0xf2,0x00,
+0x9f,0x90,0xa8,0x00,0x09,0xf9,0x09,0x01,0x10,0x0e,0x7f,0x09,0x01,0x02,0x01,0x04,
+0x12,0x00,0x0f,0x09,0x00,0x09,0x01,0x93,0x02,0x00,0x07,0x01,0x3f,0x00,0x5d,0xfd,
+0xd1,0x00,0x12,0x80,0x05,0xcc,0xff,0xdc,0xc0,0x00,0x00,0x07,0xdb,0x09,0x0f,0xd1,
+0x00,0x35,0x09,0x97,0x00,0x00,0xc1,0x01,0x45,0x09,0xad,0xfd,0xaa,0x12,0x00,0xae,
+0x02,0xff,0xff,0xff,0xf5,0x1c,0xce,0xfe,0xcc,0x30,0xc4,0x00,0x01,0xc6,0x01,0x30,
+0x02,0xff,0xee,0xc4,0x02,0xf8,0x05,0xd0,0x00,0x01,0x89,0x40,0x08,0xb0,0x00,0x00,
+0xdf,0xff,0xdb,0xfb,0x00,0x00,0x3f,0x60,0x5d,0xfb,0x10,0x99,0x0c,0x00,0xd7,0x07,
+0x00,0xb3,0x03,0x01,0x3f,0x0b,0x2f,0x4f,0xf5,0x0d,0x00,0x2d,0x20,0xf3,0xff,0xd3,
+0x07,0x30,0xfe,0x0f,0xf6,0x71,0x03,0xf1,0x04,0x90,0x7f,0xf7,0x00,0x02,0xbf,0xf2,
+0x00,0x9f,0xff,0xee,0xff,0xf4,0x00,0x00,0x4a,0xef,0xfd,0x81,0x73,0x00,0xf8,0x02,
+0x11,0x00,0x05,0xee,0x60,0x0d,0xb0,0x02,0xfe,0xbf,0xdc,0xf7,0x00,0x6f,0x10,0x4d,
+0xf9,0x90,0x00,0x00,0xb1,0x0a,0x30,0x9f,0x96,0xfc,0xca,0x00,0x0f,0x0b,0x00,0x13,
+0xf0,0x0c,0x94,0xfe,0x00,0x00,0x0b,0xf9,0x1f,0xf8,0x00,0x19,0xff,0x90,0x8f,0xff,
+0xef,0xfd,0xf9,0x00,0x7d,0xff,0xb4,0x8f,0x90,0x00,0x1f,0xff,0xff,0xc5,0x02,0x59,
+0xbb,0xbb,0xbb,0xb8,0x00,0x01,0x00,0x0f,0xeb,0x00,0x34,0x03,0x0d,0x00,0x20,0x3f,
+0xf0,0xb5,0x00,0x20,0xe0,0xff,0xed,0x0a,0xf1,0x07,0xf9,0x07,0xff,0x70,0x00,0x2b,
+0xff,0x20,0x09,0xff,0xfe,0xef,0xff,0x40,0x00,0x04,0xae,0xff,0xd8,0x10,0x00,0x03,
+0x96,0x08,0x5f,0x2b,0xbb,0xbb,0xbb,0x70,0xe7,0x00,0x41,0x50,0x05,0x80,0x00,0x38,
+0x20,0xdc,0x0d,0x20,0x3d,0xf1,0x03,0x02,0x30,0xff,0xe5,0x00,0xdd,0x0d,0x1f,0x30,
+0xdf,0x01,0x65,0x80,0xcf,0x00,0x0a,0xf1,0x00,0x07,0xf8,0x25,0xb9,0x00,0x74,0xff,
+0xfc,0x20,0x00,0x00,0x01,0x32,0xf2,0x0d,0x0f,0xed,0x00,0x18,0x02,0x0b,0x00,0x00,
+0x69,0x0c,0xf0,0x03,0xbf,0x91,0xff,0x80,0x01,0x9f,0xf9,0x08,0xff,0xfe,0xff,0xdf,
+0x90,0x07,0xdf,0xfb,0x48,0xf9,0xf3,0x11,0x00,0x00,0x08,0xdc,0x30,0x00,0x00,0x00,
+0x06,0xd3,0x6f,0x10,0x00,0x00,0x00,0xa7,0x00,0xd4,0x00,0x00,0x00,0x08,0xc0,0x3f,
+0x20,0x00,0x00,0x00,0x0b,0xff,0x60,0x00,0x01,0x00,0xdf,0x5f,0xe0,0x00,0x00,0x00,
+0x4f,0xf5,0xfe,0x00,0x00,0x00,0x04,0xff,0x0d,0x00,0x2e,0x70,0x3f,0xf0,0x00,0x00,
+0x00,0x6f,0xe0,0x5f,0x00,0xf1,0x1a,0x0c,0xf9,0x07,0xff,0x70,0x00,0x2b,0xff,0x20,
+0x09,0xff,0xfe,0xef,0xff,0x40,0x00,0x04,0xae,0xff,0xd8,0x10,0x00,0x00,0x01,0xae,
+0xc3,0x00,0x00,0x00,0xba,0x26,0xf0,0x00,0x00,0x0c,0x70,0x3f,0x10,0x00,0x00,0x3d,
+0x8c,0x00,0x14,0x01,0x90,0x00,0xbf,0x6f,0xc0,0x00,0x00,0x9f,0x96,0xfc,0x00,0x00,
+0x09,0xf9,0x0b,0x00,0x13,0xf3,0x21,0x94,0xfe,0x00,0x00,0x0b,0xf9,0x1f,0xf8,0x00,
+0x19,0xff,0x90,0x8f,0xff,0xef,0xfd,0xf9,0x00,0x7d,0xff,0xb4,0x8f,0x90,0x00,0x00,
+0x06,0xfd,0x07,0xfd,0x00,0x00,0x00,0xef,0x24,0xfe,0x10,0x00,0x00,0x7f,0x61,0xee,
+0x20,0x00,0x00,0x08,0x70,0x59,0x30,0x68,0x00,0x1f,0x05,0xf2,0x00,0x34,0x02,0x0d,
+0x00,0x20,0xf3,0xff,0x6a,0x01,0xf8,0x23,0xfe,0x0f,0xf6,0x00,0x00,0x00,0xcf,0x90,
+0x7f,0xf7,0x00,0x02,0xbf,0xf2,0x00,0x9f,0xff,0xee,0xff,0xf4,0x00,0x00,0x4a,0xef,
+0xfd,0x81,0x00,0x00,0x00,0x8f,0xa0,0xaf,0xa0,0x00,0x02,0xfe,0x16,0xfc,0x00,0x00,
+0x0a,0xf4,0x3f,0xd1,0x00,0x00,0x18,0x60,0x68,0x20,0xf5,0x00,0x1f,0x90,0x06,0x00,
+0x1d,0x62,0x4f,0xe0,0x00,0x00,0xbf,0x90,0xfa,0x00,0x62,0x08,0xff,0xfe,0xff,0xdf,
+0x90,0xfb,0x00,0x0f,0xd3,0x01,0x47,0x12,0xfb,0xd3,0x01,0x70,0x50,0x09,0xff,0xfe,
+0xff,0xff,0xb0,0xd3,0x01,0x21,0xff,0x90,0x25,0x00,0x10,0x40,0xc6,0x00,0x20,0xbf,
+0x50,0x06,0x00,0x21,0x0d,0xf1,0xd3,0x00,0x20,0xaf,0xcc,0xdd,0x00,0x3f,0x02,0xcf,
+0xc1,0xd2,0x01,0x35,0x10,0x80,0x87,0x00,0x00,0x6e,0x00,0x20,0x2f,0xc0,0x6c,0x01,
+0x20,0xf8,0x00,0xa4,0x00,0x10,0xeb,0x16,0x00,0x30,0x9f,0xe6,0x00,0x85,0x00,0x14,
+0xfd,0x43,0x02,0x33,0x02,0xfc,0xfb,0x0a,0x00,0x43,0x01,0xed,0x14,0xf8,0x0b,0x00,
+0x58,0x48,0x20,0x04,0x71,0x00,0x01,0x00,0x50,0x02,0xff,0x10,0x00,0x00,0x43,0x01,
+0xf0,0x19,0x09,0xfa,0x0e,0xf5,0x00,0x00,0x09,0xff,0x20,0x00,0x00,0xdf,0x60,0xaf,
+0x80,0x00,0x00,0xdf,0xf7,0x00,0x00,0x0f,0xf2,0x06,0xfc,0x00,0x00,0x2f,0xef,0xb0,
+0x00,0x04,0xfe,0x00,0x3f,0xf0,0x00,0x07,0xf8,0xef,0xc3,0x01,0xa0,0x00,0xff,0x30,
+0x00,0xbf,0x4a,0xf4,0x00,0x0b,0xf7,0x03,0x00,0x40,0x0f,0xf0,0x6f,0x80,0x12,0x00,
+0x60,0x7f,0xb0,0x04,0xfa,0x01,0xfd,0x27,0x00,0x90,0x03,0xfe,0x00,0x9f,0x60,0x0d,
+0xf1,0x06,0xfb,0x42,0x00,0xf0,0x0c,0x0d,0xf1,0x00,0x8f,0x60,0xaf,0x70,0x00,0x00,
+0xbf,0x62,0xfc,0x00,0x04,0xfa,0x0d,0xf3,0x00,0x00,0x07,0xf9,0x6f,0x80,0x00,0x0f,
+0xe1,0xff,0xbc,0x00,0xc0,0xcb,0xf3,0x00,0x00,0xaf,0x7f,0xb0,0x00,0x00,0x00,0xfe,
+0xee,0xae,0x02,0x50,0xf7,0x00,0x00,0x00,0x0c,0x50,0x01,0x30,0x1f,0xff,0x30,0x30,
+0x02,0x61,0xf5,0x00,0x00,0x00,0xdf,0xf0,0x5f,0x01,0x00,0xba,0x03,0x11,0xfc,0xb6,
+0x00,0x23,0x03,0xfe,0x34,0x02,0x32,0x3f,0xac,0xe1,0x11,0x00,0x41,0xfb,0x00,0xcd,
+0x10,0x0a,0x00,0x16,0x10,0x45,0x03,0x01,0xd9,0x03,0xf1,0x59,0xc0,0x00,0x00,0xff,
+0x00,0x00,0x0d,0xf5,0x1f,0xf0,0x00,0x05,0xff,0x50,0x00,0x1f,0xf0,0x0c,0xf4,0x00,
+0x0a,0xff,0xa0,0x00,0x5f,0xc0,0x08,0xf8,0x00,0x0e,0xde,0xe0,0x00,0x9f,0x70,0x03,
+0xfc,0x00,0x4f,0x8a,0xf3,0x00,0xdf,0x30,0x00,0xef,0x10,0x8f,0x35,0xf8,0x01,0xfe,
+0x00,0x00,0xaf,0x50,0xde,0x00,0xfd,0x05,0xf9,0x00,0x00,0x6f,0x92,0xf9,0x00,0xbf,
+0x29,0xf5,0x00,0x00,0x1f,0xd7,0xf4,0x00,0x6f,0x7d,0xf1,0x00,0x00,0x0c,0xfd,0xf0,
+0x00,0x1f,0xdf,0xc0,0x00,0x00,0x08,0xff,0xb0,0x00,0x0c,0xff,0x70,0x00,0x00,0x03,
+0xff,0x60,0x00,0x07,0xae,0x00,0x51,0xff,0x10,0x00,0x02,0xfe,0x78,0x00,0x31,0xcf,
+0x40,0x00,0x0d,0x02,0x11,0xcf,0xa9,0x00,0x30,0x9f,0x50,0xdd,0x9e,0x00,0x45,0x18,
+0x50,0x01,0x84,0x9a,0x00,0x30,0x08,0xff,0x10,0x1a,0x00,0x30,0xe0,0x1e,0xf8,0xce,
+0x01,0xf0,0x08,0xf5,0x00,0x7f,0xf1,0x00,0x00,0x0a,0xfc,0x00,0x00,0xdf,0x80,0x00,
+0x02,0xff,0x40,0x00,0x05,0xff,0x10,0x00,0xaf,0xb0,0x41,0x04,0x30,0x00,0x3f,0xf2,
+0xea,0x00,0x31,0xf1,0x0b,0xf9,0x52,0x02,0x31,0x93,0xff,0x10,0xb8,0x01,0x40,0xdf,
+0x70,0x00,0x00,0xb1,0x01,0x11,0xe0,0x4e,0x00,0x22,0x1f,0xf6,0x56,0x00,0x21,0xff,
+0x50,0x07,0x00,0x2f,0x0f,0xf5,0x0f,0x00,0x10,0x21,0x3f,0xe2,0x3a,0x01,0x81,0xce,
+0x10,0x00,0x00,0x3f,0xb0,0x0c,0xd1,0x7f,0x04,0x13,0x10,0x9e,0x00,0x20,0x8f,0xc0,
+0xef,0x02,0xf0,0x02,0x3f,0xf1,0x00,0x00,0xbf,0x80,0x0d,0xf7,0x00,0x00,0xff,0x30,
+0x07,0xfc,0x00,0x05,0xfd,0x30,0x02,0x80,0x0a,0xf8,0x00,0x00,0xcf,0x70,0x0e,0xf2,
+0xb1,0x03,0xe0,0x4f,0xd0,0x00,0x00,0x1f,0xf1,0x9f,0x70,0x00,0x00,0x0b,0xf7,0xdf,
+0x20,0x50,0x04,0x11,0xfc,0x68,0x00,0x11,0xf7,0xab,0x00,0x13,0xf1,0x82,0x01,0x00,
+0x50,0x00,0x01,0x6b,0x05,0x10,0xef,0x5f,0x00,0x20,0x1a,0xf9,0x83,0x00,0x10,0xff,
+0xb9,0x01,0x31,0x0e,0xfb,0x20,0xb5,0x02,0x30,0xfb,0x00,0x3e,0x02,0x02,0x40,0x7f,
+0xf0,0x06,0xff,0x10,0x00,0x45,0x63,0x00,0x06,0x40,0x28,0x01,0x20,0x8f,0xf1,0xe7,
+0x00,0x40,0xfe,0x01,0xef,0x80,0xf6,0x00,0x20,0x50,0x07,0xff,0x00,0xf1,0x01,0xaf,
+0xc0,0x00,0x0d,0xf8,0x00,0x00,0x2f,0xf4,0x00,0x00,0x5f,0xf1,0x00,0x0a,0xfb,0x70,
+0x04,0x30,0x03,0xff,0x20,0x8c,0x01,0x20,0x10,0xbf,0x1f,0x03,0x31,0x0a,0xf9,0x3f,
+0x7e,0x00,0x10,0x2f,0x51,0x02,0x00,0x68,0x01,0x12,0xfe,0x0b,0x03,0x2f,0xff,0x60,
+0x20,0x01,0x17,0x04,0x0f,0x00,0x21,0x00,0x1f,0x44,0x00,0x21,0x0a,0xf8,0x32,0x05,
+0x11,0xfa,0x13,0x00,0x15,0x67,0xa0,0x00,0x20,0x0d,0xff,0x01,0x00,0x72,0xf1,0xbe,
+0xee,0xee,0xee,0xef,0xff,0x53,0x03,0x11,0x70,0x02,0x02,0x01,0xf8,0x00,0x21,0x7f,
+0xf2,0x86,0x00,0x11,0xf6,0x2a,0x00,0x11,0xfb,0xf8,0x01,0x26,0xfe,0x10,0x2d,0x04,
+0x21,0xef,0x90,0x29,0x01,0x11,0xd0,0x29,0x01,0x10,0xf3,0x06,0x00,0x11,0x1e,0x66,
+0x00,0x11,0x0b,0x47,0x01,0x31,0x06,0xff,0x20,0x87,0x00,0x61,0xfd,0xdd,0xdd,0xdd,
+0xdd,0x5f,0x68,0x00,0x13,0xf7,0x3b,0x00,0x30,0x01,0xef,0x40,0x39,0x00,0x10,0x40,
+0xc2,0x01,0x18,0x20,0x8a,0x00,0x50,0xc0,0xac,0xcc,0xcc,0xcf,0xa4,0x00,0x30,0x07,
+0xfe,0x10,0x0f,0x01,0x10,0x50,0x2c,0x00,0x14,0x90,0x65,0x00,0x24,0x6f,0xf2,0x8e,
+0x00,0x20,0x0d,0xfa,0x57,0x01,0x00,0x24,0x00,0x11,0x05,0xbb,0x02,0x61,0xef,0xfc,
+0xcc,0xcc,0xcc,0x1f,0xcb,0x00,0x42,0x00,0x00,0x0b,0xe3,0x00,0x01,0x11,0x70,0x9e,
+0x01,0x15,0x70,0xec,0x00,0x11,0xdf,0x84,0x00,0x71,0x1b,0xee,0xee,0xee,0xee,0xff,
+0xf0,0xd9,0x00,0x01,0x1a,0x01,0x11,0x0c,0xae,0x00,0x21,0x07,0xff,0xec,0x04,0x02,
+0x62,0x01,0x21,0xdf,0xb0,0xbc,0x01,0x11,0xe1,0xa0,0x04,0x20,0xf4,0x00,0xec,0x01,
+0x11,0xf9,0x45,0x01,0x01,0xa0,0x04,0x02,0x73,0x00,0x00,0xd3,0x01,0x00,0x24,0x03,
+0x23,0xc0,0x00,0x9a,0x00,0x00,0x17,0x02,0x00,0xeb,0x00,0x21,0xd5,0xff,0x01,0x00,
+0x31,0x70,0x00,0x01,0x37,0x03,0x11,0x3f,0x19,0x01,0x18,0x56,0x85,0x00,0x70,0xfc,
+0x0a,0xcc,0xcc,0xcc,0xff,0xa0,0x61,0x01,0x10,0xe1,0x22,0x00,0x10,0xf5,0x3a,0x01,
+0x14,0xf9,0x60,0x00,0x01,0x38,0x01,0x02,0x89,0x00,0x20,0xdf,0xa0,0xfd,0x01,0x14,
+0xe1,0x5f,0x01,0x61,0x0e,0xff,0xcc,0xcc,0xcc,0xc1,0x5e,0x00,0x60,0x10,0x00,0x1e,
+0xd0,0x07,0xf8,0x3d,0x00,0x21,0xb6,0xfa,0xa6,0x00,0x02,0x2f,0x05,0x1f,0x57,0xd9,
+0x01,0x65,0x20,0x03,0xea,0xcf,0x01,0x44,0x03,0xf9,0x8f,0x40,0x45,0x00,0x2f,0x01,
+0x10,0xd9,0x01,0x3d,0xff,0x06,0x5c,0xfe,0x60,0x5f,0xfe,0xd4,0x0d,0xf9,0x00,0x01,
+0xff,0x20,0x00,0x1f,0xf0,0x00,0x02,0xff,0x00,0x00,0x2f,0x07,0x00,0x11,0x50,0x00,
+0x02,0xff,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -1062,11 +1367,23 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 192, .range_length = 192, .glyph_id_start = 112, .list_length = 0, .type = 2, .unicode_list = 0, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[39409] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 2917, .size = 3969, .comp_size = 2905 },
+{ .bitmap_start = 3969, .comp_offset = 5822, .size = 4085, .comp_size = 2768 },
+{ .bitmap_start = 8054, .comp_offset = 8590, .size = 4050, .comp_size = 2642 },
+{ .bitmap_start = 12104, .comp_offset = 11232, .size = 4026, .comp_size = 1700 },
+{ .bitmap_start = 16130, .comp_offset = 12932, .size = 4081, .comp_size = 2044 },
+{ .bitmap_start = 20211, .comp_offset = 14976, .size = 4023, .comp_size = 1817 },
+{ .bitmap_start = 24234, .comp_offset = 16793, .size = 4017, .comp_size = 1818 },
+{ .bitmap_start = 28251, .comp_offset = 18611, .size = 3954, .comp_size = 1699 },
+{ .bitmap_start = 32205, .comp_offset = 20310, .size = 2380, .comp_size = 1374 },
+};
+
+static uint8_t etxUncompBuf[4824] __SDRAMFONTS;
 
 const etxLz4Font lv_font_en_L = {
-.uncomp_size = 39145,
-.comp_size = 16810,
+.uncomp_size = 4560,
+.comp_size = 2917,
 .line_height = 29,
 .base_line = 6,
 .subpx = 0,
@@ -1079,12 +1396,13 @@ const etxLz4Font lv_font_en_L = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 38,
-.glyph_bitmap = 2432,
-.class_pair_values = 37017,
-.left_class_mapping = 38537,
-.right_class_mapping = 38841,
+.class_pair_values = 2432,
+.left_class_mapping = 3952,
+.right_class_mapping = 4256,
+.block_num = 9,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 39409,
+.lvglFontBufSize = 4824,
 };
@@ -134,284 +134,365 @@ static const uint8_t lz4FontData[] ={
 0x00,0x13,0x8e,0x08,0x00,0x13,0xb8,0x08,0x00,0x10,0xe2,0x08,0x00,0x52,0x08,0x00,
 0xff,0x12,0x20,0x58,0x00,0x13,0x3a,0x08,0x00,0x22,0x62,0x20,0xa8,0x00,0x22,0x94,
 0x20,0x28,0x00,0x22,0xbe,0x20,0x60,0x00,0x60,0xe1,0x20,0x10,0x09,0x0a,0x07,0x80,
-0x0b,0xf4,0xff,0x38,0x43,0x02,0xdf,0xcf,0xe6,0xcf,0xe9,0xcf,0xea,0xcf,0xeb,0xcf,
-0xef,0xcf,0xf1,0xcf,0xf3,0xcf,0xf7,0xcf,0xfa,0xcf,0xff,0xcf,0x04,0xd0,0x05,0xd0,
-0x06,0xd0,0x1c,0xd0,0x21,0xd0,0x26,0xd0,0x29,0xd0,0x2a,0xd0,0x2b,0xd0,0x2f,0xd0,
-0x30,0xd0,0x31,0xd0,0x32,0xd0,0x45,0xd0,0x46,0xd0,0x4c,0xd0,0x4e,0xd0,0x4f,0xd0,
-0x52,0xd0,0x55,0xd0,0x56,0xd0,0x57,0xd0,0x59,0xd0,0x71,0xd0,0x73,0xd0,0xa2,0xd0,
-0xa3,0xd0,0xa5,0xd0,0xa7,0xd0,0xbe,0xd0,0xc5,0xd0,0xc8,0xd0,0xd1,0xd0,0xfa,0xd0,
-0x02,0xd1,0x39,0xd1,0xc9,0xd1,0x1e,0xd2,0x1f,0xd2,0x20,0xd2,0x21,0xd2,0x22,0xd2,
-0x65,0xd2,0x71,0xd2,0xcb,0xd2,0xe2,0xd2,0x38,0xd5,0xa0,0xd7,0x80,0xd8,0x49,0x39,
-0x38,0x38,0x26,0x00,0x28,0x66,0x66,0x55,0x11,0x10,0x00,0x90,0xa0,0x00,0xa0,0x90,
-0x1a,0xdb,0xc4,0x02,0x76,0x30,0x4c,0xbd,0xa0,0x08,0x1a,0x00,0x0a,0x0a,0x00,0x00,
-0x70,0x00,0x6e,0x70,0x2b,0x09,0x53,0xb0,0x23,0x08,0xc5,0x00,0x01,0xb5,0x65,0x04,
-0x81,0xc9,0xc2,0x00,0xa0,0x00,0x2a,0x80,0x00,0x07,0x19,0x0a,0x00,0x72,0x96,0x50,
-0x01,0x87,0xa0,0x00,0x00,0x83,0x98,0x00,0x28,0x63,0x72,0x02,0x02,0xaa,0x00,0x08,
-0xb9,0x00,0x0d,0x0b,0x00,0x0c,0x6b,0x00,0x09,0xe0,0x00,0x59,0x68,0x91,0x75,0x0a,
-0xc0,0x1a,0x9b,0xc3,0x81,0x80,0x10,0x00,0x20,0x38,0x0b,0x02,0x90,0x57,0x06,0x60,
-0x57,0x01,0xb0,0x0a,0x10,0x19,0x00,0x00,0x20,0x07,0x40,0x0c,0x00,0x93,0x06,0x60,
-0x57,0x06,0x50,0xa2,0x1a,0x08,0x20,0x00,0x00,0x06,0x40,0x8b,0xa7,0x0b,0xa0,0x34,
-0x61,0x00,0xa0,0x00,0x0d,0x00,0x8c,0xfc,0x90,0x0d,0x00,0x00,0xd0,0x00,0x75,0x92,
-0x10,0x9a,0x30,0x37,0x00,0x74,0x00,0xb0,0x03,0x70,0x09,0x10,0x0a,0x00,0x55,0x00,
-0xa0,0x00,0x0a,0xba,0x04,0x80,0x75,0x75,0x04,0x88,0x50,0x48,0x75,0x04,0x74,0x80,
-0x75,0x0a,0xba,0x00,0x05,0xc3,0x27,0xa3,0x00,0x93,0x02,0x00,0xf1,0x5c,0x1a,0xbb,
-0x07,0x50,0x85,0x10,0x08,0x40,0x02,0xb0,0x00,0xc2,0x00,0xb3,0x00,0x6e,0xbb,0x70,
-0x0b,0xba,0x06,0x50,0x84,0x00,0x09,0x30,0x3c,0xa0,0x00,0x08,0x56,0x40,0x76,0x1b,
-0xaa,0x00,0x00,0x2f,0x00,0x0a,0xe0,0x03,0x8d,0x00,0xb1,0xd0,0x57,0x0d,0x09,0xbb,
-0xf9,0x00,0x0d,0x00,0x0c,0xcc,0x60,0xc0,0x00,0x0e,0xba,0x10,0x30,0x68,0x00,0x02,
-0xa3,0x90,0x48,0x09,0xbb,0x10,0x03,0xb8,0x00,0xb1,0x00,0x4c,0xa9,0x05,0xa0,0x76,
-0x66,0x03,0x93,0xa0,0x67,0x08,0xbb,0x00,0x7b,0xbc,0x90,0x00,0x83,0x00,0x0c,0x00,
-0x06,0x60,0x00,0xc1,0x00,0x39,0x00,0x0a,0x30,0x8c,0x00,0xf1,0x2a,0x85,0x39,0x09,
-0x30,0xbc,0xb0,0x58,0x07,0x66,0x60,0x57,0x0b,0xbb,0x10,0x0a,0xb9,0x06,0x60,0xa3,
-0x84,0x06,0x65,0x80,0x97,0x09,0xab,0x50,0x00,0xb1,0x07,0xb4,0x00,0x47,0x00,0x00,
-0x00,0x47,0x65,0x00,0x00,0x00,0x66,0x92,0x10,0x00,0x4a,0x4b,0x81,0x6b,0x50,0x00,
-0x7b,0x00,0x00,0x3b,0xbb,0x30,0x05,0x00,0x90,0x59,0x10,0x00,0x3a,0x91,0x02,0x8b,
-0x25,0xb3,0x09,0x02,0xf1,0x43,0x3c,0xc5,0x62,0x0d,0x00,0x2b,0x00,0xc2,0x05,0x70,
-0x00,0x00,0x05,0x50,0x00,0x79,0x99,0x20,0x07,0x40,0x00,0x90,0x19,0x06,0x94,0x26,
-0x54,0x28,0x28,0x09,0x72,0x73,0x37,0x08,0x63,0x82,0x56,0x17,0x36,0x3a,0x7a,0x91,
-0x0a,0x10,0x00,0x00,0x01,0x99,0x94,0x00,0x00,0x97,0x00,0x00,0xbb,0x00,0x04,0x68,
-0x20,0x0a,0x13,0x80,0x0e,0xbb,0xd0,0x56,0x00,0x83,0xb2,0x00,0x49,0x4e,0xbc,0x50,
-0x49,0x00,0xd0,0x49,0x01,0xb0,0x4d,0xbe,0x09,0x00,0xf0,0x17,0x00,0xd0,0x4e,0xbc,
-0x60,0x06,0xcb,0x80,0x2c,0x00,0xa3,0x67,0x00,0x11,0x76,0x00,0x00,0x67,0x00,0x11,
-0x2c,0x00,0xa3,0x05,0xbb,0x70,0x4e,0xbb,0x30,0x49,0x01,0xc0,0x49,0x00,0x94,0x49,
-0x00,0x75,0x06,0x00,0xf4,0x08,0x01,0xd0,0x4e,0xbc,0x30,0x4e,0xbb,0x84,0x90,0x00,
-0x49,0x00,0x04,0xeb,0xb4,0x49,0x00,0x04,0x90,0x00,0x4e,0xbb,0x90,0x12,0x00,0x21,
-0xdb,0xb2,0x12,0x00,0xf2,0x0c,0x49,0x00,0x00,0x05,0xcb,0x90,0x2c,0x00,0x84,0x67,
-0x00,0x00,0x76,0x09,0xb6,0x67,0x00,0x67,0x1c,0x00,0x77,0x05,0xcb,0xa1,0x49,0x00,
-0x3a,0x03,0x00,0x35,0x4e,0xbb,0xca,0x0c,0x00,0x03,0x01,0x00,0x53,0x00,0x09,0x40,
-0x00,0x94,0x05,0x00,0xf2,0x0b,0x4a,0x20,0xb2,0x3c,0xb8,0x00,0x49,0x01,0xc2,0x49,
-0x0b,0x40,0x49,0x96,0x00,0x4e,0xf3,0x00,0x4c,0x2d,0x00,0x49,0x06,0x90,0x49,0x00,
-0x72,0x00,0x06,0x05,0x00,0xf0,0x4b,0x4e,0xbb,0x70,0x4f,0x00,0x02,0xf1,0x4e,0x60,
-0x08,0xe1,0x49,0xb0,0x0c,0xb1,0x49,0xb1,0x48,0xb1,0x49,0x57,0xa2,0xb1,0x49,0x0c,
-0xc0,0xb1,0x49,0x09,0x60,0xb1,0x4d,0x00,0x2a,0x4f,0x70,0x2a,0x49,0xc1,0x2a,0x49,
-0x4a,0x2a,0x49,0x0a,0x7a,0x49,0x01,0xea,0x49,0x00,0x7a,0x05,0xcc,0x70,0x2c,0x00,
-0xa4,0x67,0x00,0x49,0x75,0x00,0x2a,0x67,0x00,0x49,0x2c,0x00,0xa4,0x05,0xcc,0x80,
-0x4e,0xbc,0x70,0x49,0x00,0xb2,0x49,0x00,0x84,0x49,0x00,0xc2,0x4e,0xbb,0x60,0x49,
-0x00,0xc5,0x00,0x10,0x06,0x2a,0x00,0xf1,0x0a,0xa3,0x66,0x00,0x48,0x85,0x00,0x39,
-0x76,0x00,0x48,0x2c,0x00,0xa4,0x06,0xcd,0xc0,0x00,0x00,0x85,0x00,0x00,0x00,0x4e,
-0xbc,0x60,0x43,0x01,0xfb,0x16,0xd0,0x4e,0xbe,0x30,0x49,0x0a,0x40,0x49,0x02,0xb0,
-0x49,0x00,0xb2,0x0a,0xbc,0x35,0x80,0x1d,0x4b,0x10,0x00,0x5d,0xb2,0x00,0x04,0xc8,
-0x60,0x0d,0x0a,0xbc,0x50,0x8b,0xeb,0xb1,0x00,0xb1,0x00,0x03,0x00,0x37,0x67,0x00,
-0x94,0x03,0x00,0xf0,0x09,0x93,0x3a,0x00,0xc1,0x08,0xbc,0x60,0xb3,0x00,0x77,0x58,
-0x00,0xc1,0x0d,0x02,0xc0,0x0b,0x37,0x60,0x05,0x8d,0x10,0x00,0xeb,0x09,0x0f,0xf3,
-0x30,0xa3,0x07,0x80,0x2a,0x66,0x0b,0xb0,0x57,0x2a,0x0b,0xa0,0x93,0x0c,0x38,0x64,
-0xc0,0x0b,0x83,0x28,0xc0,0x08,0xd0,0x0d,0x90,0x04,0xb0,0x0a,0x50,0x69,0x00,0xd1,
-0x0c,0x38,0x70,0x03,0xdd,0x00,0x00,0xd7,0x00,0x04,0xbd,0x00,0x0d,0x27,0x80,0x78,
-0x00,0xd2,0xb4,0x00,0xd1,0x3c,0x06,0x90,0x0a,0x4d,0x10,0x02,0xf8,0x00,0x00,0xc2,
-0x70,0x00,0x80,0x6b,0xbc,0xd0,0x00,0x09,0x50,0x00,0x3b,0x12,0x00,0xe3,0x07,0x70,
-0x00,0x2c,0x00,0x00,0x9d,0xbb,0xb0,0x4c,0x35,0x70,0x57,0x05,0x03,0x00,0xf2,0x03,
-0x4c,0x30,0xa2,0x00,0x48,0x00,0x0c,0x00,0x07,0x40,0x01,0xa0,0x00,0xb1,0x00,0x56,
-0xa9,0x1b,0x01,0x00,0xf0,0x0e,0xa9,0x04,0x10,0x0c,0x80,0x29,0xb0,0x83,0x74,0xab,
-0xbb,0x00,0x42,0x01,0xb0,0x0a,0xba,0x02,0x40,0xa3,0x09,0x9d,0x37,0x60,0xa3,0x3c,
-0xbb,0x40,0x66,0xe6,0x02,0xf2,0x32,0x6b,0xbb,0x16,0x80,0x67,0x66,0x03,0x96,0x80,
-0x67,0x6b,0xbb,0x10,0x0a,0xba,0x06,0x60,0x53,0x93,0x00,0x06,0x60,0x42,0x0a,0xaa,
-0x00,0x00,0x06,0x70,0x00,0x67,0x0b,0xbc,0x76,0x70,0x77,0x84,0x06,0x76,0x60,0x77,
-0x0a,0xab,0x70,0x09,0xba,0x06,0x70,0x84,0x9c,0xbb,0x56,0x60,0x10,0x0a,0xba,0x10,
-0x07,0xb1,0x0d,0x00,0x7e,0x80,0x0d,0x00,0x02,0x00,0x22,0x0b,0xbb,0x28,0x00,0xa2,
-0x70,0x77,0x0b,0xbc,0x60,0x20,0x85,0x1a,0xba,0x00,0x5e,0x00,0xf0,0x00,0xbc,0x16,
-0x80,0x85,0x66,0x07,0x56,0x60,0x75,0x66,0x07,0x50,0x46,0x00,0x58,0x01,0x00,0x34,
-0x04,0x50,0x00,0xb6,0x00,0x41,0x67,0x3d,0x30,0x67,0x67,0x00,0xd2,0x2c,0x16,0x8c,
-0x10,0x6e,0xc0,0x06,0x77,0x70,0x67,0x0b,0x30,0x58,0x01,0x00,0xc4,0x6b,0xbc,0x8b,
-0xb0,0x67,0x08,0x70,0x93,0x66,0x07,0x50,0x84,0x04,0x00,0x09,0x4f,0x00,0xf2,0x1d,
-0x0a,0xba,0x16,0x70,0x58,0x93,0x01,0xb6,0x60,0x58,0x0a,0xbb,0x00,0x6b,0xab,0x16,
-0x70,0x57,0x66,0x03,0x96,0x70,0x67,0x6c,0xab,0x16,0x60,0x00,0x66,0x00,0x00,0x0b,
-0xbb,0x66,0x70,0x76,0x84,0x06,0x66,0x70,0x76,0x0b,0xbc,0x60,0x8e,0x00,0xf3,0x0f,
-0x06,0xca,0x67,0x06,0x60,0x66,0x06,0x60,0x1b,0xb9,0x05,0x80,0x60,0x08,0xb7,0x04,
-0x30,0xb2,0x1b,0xba,0x00,0x1b,0x0a,0xe6,0x1b,0x01,0xb0,0x1b,0x00,0xc7,0x58,0x00,
-0xf0,0x31,0x55,0x70,0x85,0x1c,0xbc,0x50,0xb2,0x0c,0x05,0x71,0xa0,0x0b,0x65,0x00,
-0xac,0x00,0x04,0xa0,0x00,0xa1,0x1d,0x06,0x66,0x56,0xc2,0xa2,0x29,0xa4,0x7b,0x00,
-0xba,0x0c,0x90,0x09,0x60,0xa4,0x00,0x77,0x1c,0x00,0xca,0x40,0x06,0xd0,0x00,0xc9,
-0x40,0x76,0x0c,0x00,0xb2,0x0d,0x06,0x72,0xa0,0x1c,0x75,0x00,0xbd,0x00,0x05,0xa0,
-0x00,0x65,0xfa,0x03,0xf3,0x0d,0x6b,0xbf,0x00,0x09,0x60,0x04,0xa0,0x01,0xc1,0x00,
-0x8d,0xbb,0x10,0x02,0x90,0xa2,0x0c,0x00,0xc0,0x98,0x00,0xc0,0x0c,0x00,0xa2,0x02,
-0x90,0x36,0x01,0x00,0xf0,0x08,0x92,0x02,0xb0,0x0c,0x00,0xc0,0x07,0x90,0xc0,0x0c,
-0x02,0xb0,0x92,0x00,0x0a,0xa2,0x36,0x44,0x1a,0xb1,0x00,0x00,0x03,0x23,0x04,0xf0,
-0x0a,0xf4,0x00,0x09,0xaa,0xab,0xb3,0x00,0xb1,0x11,0x01,0xc2,0x0b,0x00,0x00,0x0a,
-0x40,0xdc,0xcc,0x88,0x60,0x00,0x00,0x1f,0x70,0x00,0xab,0x05,0x10,0x00,0xd1,0x11,
-0xf5,0x20,0x9b,0x00,0x00,0x07,0x7e,0xaa,0xa6,0x69,0x01,0x11,0x2b,0x95,0x00,0x00,
-0x1b,0x0a,0x3c,0xcc,0xc9,0x00,0xbb,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x10,
-0x00,0x00,0x78,0xa2,0x00,0x09,0x60,0x0a,0x30,0x8e,0x70,0x1b,0xf2,0x00,0xc0,0x29,
-0x00,0x04,0x00,0x78,0xec,0xc8,0x00,0x00,0xab,0xb6,0x00,0x14,0x00,0xc0,0x7c,0xb0,
-0x1e,0xb2,0x1b,0x30,0x08,0x70,0x00,0xb5,0xa6,0x00,0xbc,0x03,0x02,0x01,0x00,0x10,
-0x08,0x49,0x00,0xf5,0x26,0xf4,0x00,0x00,0x00,0xd7,0xd0,0x00,0x00,0x5b,0x0b,0x50,
-0x00,0x0d,0x20,0x2d,0x00,0x06,0xa0,0x00,0xa6,0x00,0xef,0xff,0xff,0xe0,0x00,0x00,
-0x59,0x20,0x07,0x6b,0x4c,0x1d,0x67,0xd7,0xba,0x40,0xaf,0xb6,0xc0,0x0c,0x60,0xcc,
-0x10,0x20,0x1c,0x4b,0x00,0x0b,0x40,0x5d,0xcd,0x50,0x7a,0x12,0xf3,0x38,0x03,0xdf,
-0xd4,0x10,0x05,0xa2,0xe2,0xa7,0x00,0xb1,0x01,0x01,0xb1,0x2b,0x00,0x00,0x0a,0x20,
-0xd1,0x00,0x00,0xc2,0x06,0xa1,0x01,0x89,0x00,0x06,0xaa,0xb8,0x00,0x00,0x01,0x21,
-0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x8d,0xcc,0xc6,0x00,0x2d,0x0a,0x70,0x97,0x00,
-0xdb,0x5b,0x00,0xc1,0x0c,0x4a,0x00,0x09,0x30,0xc0,0x00,0x00,0xc1,0x04,0xa0,0x00,
-0x88,0x00,0x05,0xcc,0xd7,0x4e,0x00,0xf2,0x0b,0x33,0x33,0x20,0x3f,0xbb,0xd8,0x09,
-0x80,0x0b,0x10,0xa5,0x07,0x80,0x3c,0x98,0x60,0x0b,0x47,0xaa,0x00,0xa4,0x04,0x90,
-0x02,0xcc,0xb1,0x20,0x00,0xf3,0x0b,0x46,0x40,0x02,0x4c,0xfd,0x52,0x83,0x33,0x22,
-0x88,0x0c,0xcb,0x08,0x80,0x22,0x20,0x88,0x09,0x98,0x08,0x88,0x88,0x87,0x70,0x0b,
-0xfb,0x41,0x00,0xf2,0x6f,0x12,0x04,0x02,0xbf,0xeb,0xb8,0xe7,0x00,0x08,0x07,0x70,
-0x00,0x80,0x09,0x30,0x08,0x2b,0x10,0x00,0xb7,0xd7,0x00,0x03,0x02,0xbf,0xeb,0x00,
-0x00,0x12,0x00,0x13,0x33,0x33,0x18,0x8f,0x44,0x68,0x81,0x53,0xef,0xa8,0x5f,0x05,
-0xa9,0x81,0x60,0x00,0x78,0x4e,0x00,0x07,0x83,0xb0,0x00,0x78,0xaf,0x87,0x78,0x00,
-0x17,0x97,0x00,0x00,0x3e,0x7e,0x7c,0x10,0x0d,0x30,0xd2,0x3b,0x02,0xb0,0x0c,0x10,
-0xc0,0x39,0x1a,0x3b,0x5b,0x00,0xda,0x83,0x79,0xd0,0x06,0xe3,0x00,0xb4,0x00,0x05,
-0xcc,0xb4,0x00,0x08,0x80,0x00,0x00,0x94,0x4a,0x00,0x00,0xb0,0x0b,0x4b,0x80,0xa3,
-0x3a,0xef,0xf4,0x1e,0xfa,0xef,0xf2,0x85,0x8f,0xff,0xb0,0xb3,0xff,0xff,0xf2,0xed,
-0xee,0xee,0xe4,0x84,0x00,0x10,0x2a,0x05,0x00,0xf0,0x05,0x3a,0x00,0x00,0xcc,0xcc,
-0xec,0x10,0x07,0x99,0x99,0x97,0x00,0x1d,0xec,0xdd,0xd0,0x00,0x1b,0x30,0x00,0x1e,
-0x01,0x03,0xa8,0x00,0xf2,0x26,0x01,0x86,0x10,0x00,0x00,0x17,0x68,0x70,0x00,0x00,
-0x36,0x94,0x00,0x00,0x17,0xa2,0x00,0x01,0x95,0x69,0x10,0x00,0xd5,0x98,0x7b,0x00,
-0x0c,0x68,0x77,0xa0,0x00,0x1a,0x77,0x90,0x00,0x0a,0xaa,0x91,0x02,0xa2,0x28,0xc1,
-0x29,0x00,0xc9,0xa2,0x90,0x00,0x0b,0x29,0x00,0x00,0xb2,0x07,0x00,0xf2,0x19,0xb1,
-0xeb,0xbb,0xbb,0x00,0x37,0x30,0x00,0x00,0x37,0x17,0x85,0x00,0x08,0x00,0x02,0x45,
-0x01,0x90,0x26,0xb2,0x80,0x62,0xaa,0x82,0x09,0x06,0x10,0x5e,0x00,0x71,0x27,0x07,
-0x93,0x07,0x00,0x58,0x88,0x88,0x60,0x24,0x02,0xf2,0x0e,0x00,0xb3,0x80,0x00,0x32,
-0x3e,0x88,0x00,0x6a,0x8b,0x2b,0x20,0x0b,0x00,0x7b,0xc0,0x00,0xa0,0x00,0xb3,0x00,
-0x37,0x00,0x0b,0x30,0x04,0x60,0x00,0xb3,0x8c,0x00,0xaf,0x19,0x56,0x39,0x19,0x50,
-0x01,0x50,0x00,0x00,0xa2,0x85,0x06,0x03,0x5f,0x00,0x06,0x10,0x00,0x38,0x1b,0x00,
-0x04,0x4f,0x33,0x00,0x01,0x99,0x1b,0x00,0x03,0x3f,0x03,0x99,0x30,0x18,0x00,0x02,
-0x3f,0x05,0x56,0x30,0x4b,0x00,0x03,0x4f,0x65,0x00,0x00,0x65,0x66,0x00,0x04,0xfe,
-0x14,0x00,0x7f,0xbb,0xa0,0x00,0x01,0xcd,0x00,0x00,0x00,0x09,0x7c,0x00,0x00,0x00,
-0x2e,0x0c,0xbb,0x60,0x00,0xa8,0x0b,0x10,0x00,0x03,0xfd,0xce,0x10,0x00,0x0c,0x50,
-0x0a,0xbb,0xb2,0x06,0x14,0x07,0xde,0xcc,0x70,0x00,0x39,0x00,0x00,0x39,0x00,0x03,
-0x30,0x00,0x0b,0x00,0x0a,0x07,0x6e,0x00,0x06,0x00,0x07,0x50,0x4e,0x17,0x00,0x4e,
-0x51,0x00,0x48,0x90,0x17,0x00,0x53,0x08,0x29,0x14,0xeb,0xb8,0x0d,0x00,0x12,0x44,
-0x1c,0x00,0x74,0xb9,0x07,0x00,0x66,0x03,0xa0,0x3a,0x03,0x00,0x26,0x04,0x30,0x0c,
-0x00,0x88,0x3a,0x00,0x01,0x50,0x0a,0x83,0x03,0xa0,0x02,0x00,0x2a,0x19,0x27,0x10,
-0x00,0xff,0x09,0x2e,0xbc,0x40,0x2b,0x00,0xc1,0x2b,0x00,0x66,0xbe,0x90,0x57,0x2b,
-0x00,0x76,0x2b,0x00,0xc1,0x2e,0xbc,0x40,0x01,0x99,0x50,0x0a,0x07,0x02,0x6f,0x00,
-0x60,0x00,0x00,0x84,0x00,0x10,0x07,0x02,0x5f,0x00,0x05,0x20,0x00,0x1a,0x1b,0x00,
-0x04,0x5f,0x24,0x00,0x00,0xa8,0x20,0x1b,0x00,0x02,0x3f,0x02,0x99,0x40,0x18,0x00,
-0x03,0x2f,0x74,0x60,0x4b,0x00,0x03,0xa0,0x00,0x05,0x70,0xb1,0x09,0xd5,0x00,0xac,
-0x60,0x57,0xc4,0x02,0xf2,0x09,0x05,0xcc,0xa6,0x2c,0x00,0xe4,0x67,0x07,0x79,0x75,
-0x18,0x2a,0x57,0x81,0x49,0x1d,0x60,0xa4,0x0b,0xcc,0x80,0x13,0x00,0x00,0x46,0x02,
-0x0f,0x37,0x07,0x02,0x02,0x46,0x02,0x0f,0x1b,0x00,0x03,0x4f,0x42,0x00,0x02,0x99,
-0x1b,0x00,0x03,0x3f,0x05,0x57,0x30,0x4e,0x00,0x04,0x4f,0x00,0x00,0x75,0x00,0x45,
-0x07,0x02,0xf5,0x1e,0x48,0x00,0x04,0x80,0x00,0x4d,0xaa,0x24,0x80,0x1c,0x48,0x01,
-0xc4,0xda,0xa2,0x48,0x00,0x00,0x0b,0xb8,0x05,0x80,0xd0,0x66,0x2b,0x06,0x65,0x90,
-0x66,0x0a,0x66,0x60,0x0d,0x66,0xaa,0x80,0x06,0x70,0x00,0x03,0x00,0x1a,0xba,0x02,
-0x30,0x26,0x07,0x59,0x00,0x57,0x00,0x03,0x00,0x38,0x07,0x58,0x03,0xb3,0x00,0x30,
-0x30,0x12,0x00,0x00,0x36,0x05,0xf0,0x02,0x8a,0x90,0x00,0x00,0x00,0xab,0xa0,0x24,
-0x0a,0x30,0x99,0xd3,0x76,0x0a,0x33,0xcb,0xb4,0x5a,0x0b,0x0a,0x38,0x00,0x79,0x01,
-0x72,0x00,0x52,0x70,0x01,0x72,0x26,0x00,0xf7,0x05,0x2b,0xb9,0xab,0x80,0x43,0x0c,
-0x50,0xa2,0x2a,0xae,0xaa,0xb3,0x94,0x0b,0x40,0x00,0x4c,0xb7,0xaa,0xb0,0x86,0x07,
-0xc9,0xba,0x00,0x0a,0x10,0x00,0xa1,0x00,0x07,0x60,0x00,0x04,0x00,0x7e,0x07,0x4a,
-0x00,0x66,0x00,0x03,0x12,0x00,0x00,0x96,0x00,0x19,0x20,0x12,0x00,0x01,0x82,0x00,
-0x09,0x12,0x00,0x61,0x0b,0x10,0x12,0x05,0x80,0x58,0x03,0x00,0x42,0x0b,0x21,0x20,
-0x58,0x0c,0x00,0x74,0x00,0x08,0x90,0x02,0x11,0x05,0x80,0x02,0x00,0x46,0x27,0x46,
-0x00,0x00,0x0e,0x00,0xf0,0x11,0x05,0x20,0x00,0x4d,0xc1,0x01,0x7c,0x20,0x6b,0xb8,
-0x3a,0x03,0xa6,0x60,0x2a,0x49,0x05,0x70,0x8b,0xa0,0x00,0x00,0x00,0x9a,0x90,0x00,
-0x00,0x06,0xbb,0xc1,0x68,0x08,0x33,0x07,0x00,0x38,0x07,0x58,0x06,0x70,0x00,0x04,
-0x00,0x92,0x07,0x00,0x6e,0x03,0x1a,0x03,0x12,0x00,0x03,0x38,0x01,0x08,0x24,0x00,
-0x02,0x4a,0x00,0xd3,0x00,0xab,0xa1,0x67,0x05,0x89,0x30,0x1b,0x66,0x05,0x80,0xab,
-0xb0,0x38,0x01,0x08,0x26,0x00,0x81,0xb0,0x00,0x00,0x00,0x9d,0xdd,0x90,0x00,0x0a,
-0x00,0xf0,0x01,0x02,0x10,0xab,0xe0,0x67,0x3a,0x88,0x38,0x2b,0x69,0x55,0x80,0xdb,
-0xb0,0x04,0x00,0xd9,0x07,0x29,0x03,0x00,0xbd,0x07,0x2c,0x00,0x76,0x12,0x00,0x59,
-0x03,0xb3,0x00,0x20,0x20,0x12,0x00,0x01,0x67,0x00,0x0a,0x36,0x00,0x4e,0xa3,0x00,
-0x02,0x00,0xcc,0x07,0xfe,0x0d,0x57,0x00,0x05,0x70,0x00,0x5c,0xbc,0x15,0x80,0x58,
-0x57,0x02,0xa5,0x80,0x58,0x5c,0xac,0x15,0x70,0x00,0x57,0x00,0x00,0x19,0x28,0x00,
-0x00,0x00,0x2e,0x00,0x3f,0x05,0xaa,0x40,0xaa,0x04,0x02,0x2c,0x09,0xaa,0x0e,0x02,
-0x3f,0x02,0x88,0x10,0x2a,0x00,0x02,0x96,0x0a,0x0a,0x00,0x39,0x40,0x1a,0xba,0x01,
-0x10,0x5e,0x02,0x0f,0xfb,0x04,0x03,0x47,0x82,0x00,0x00,0xa6,0x52,0x00,0x70,0xbc,
-0x40,0x00,0xa0,0x00,0x1c,0x20,0x00,0x03,0x2f,0x23,0x00,0x0a,0x0c,0x02,0x21,0x00,
-0x94,0x92,0x01,0x35,0x06,0x60,0x64,0xe3,0x09,0x4f,0x43,0x00,0x01,0x44,0x2d,0x00,
-0x03,0x5a,0x05,0xb1,0x00,0x30,0x20,0x10,0x0a,0x1f,0x55,0x57,0x00,0x04,0x00,0x11,
-0x02,0x09,0x2a,0x00,0x5f,0x01,0x34,0x00,0x00,0x33,0x2d,0x00,0x03,0x4a,0x08,0x84,
-0x00,0x03,0x2d,0x00,0x6f,0x04,0x15,0x00,0x01,0xd4,0x00,0xa6,0x0c,0x02,0xff,0x06,
-0x00,0x06,0x7c,0x00,0x06,0x85,0x0b,0xbc,0x70,0x67,0x07,0x70,0x84,0x06,0x70,0x66,
-0x07,0x70,0x0a,0xab,0x70,0x1f,0x05,0x02,0x00,0x45,0x0a,0x2b,0x6c,0xd2,0x2a,0x00,
-0x3d,0x07,0xaa,0x24,0x9b,0x05,0x2c,0x0a,0xaa,0x14,0x03,0x5e,0x04,0x15,0x00,0x29,
-0x70,0xd8,0x05,0x00,0x87,0x01,0x1a,0x30,0x73,0x03,0x2d,0x91,0x04,0x4f,0x00,0x2c,
-0x00,0xa0,0x4f,0x00,0x1e,0x4e,0x39,0x06,0x47,0x91,0x00,0x0b,0x50,0x24,0x00,0xce,
-0xbc,0x10,0x0a,0x20,0x00,0xa5,0x00,0x03,0x25,0x00,0x0c,0x50,0x2e,0x00,0x2c,0x06,
-0x86,0xd9,0x03,0x02,0xa5,0x01,0x0f,0x8e,0x0d,0x02,0x5e,0x04,0xb2,0x00,0x30,0x20,
-0x7b,0x0b,0x5f,0x02,0x23,0x10,0x00,0x98,0x32,0x00,0x03,0x5e,0x0a,0x0a,0x00,0x49,
-0x30,0x32,0x00,0x2f,0x00,0x64,0x2f,0x00,0x03,0x01,0xe0,0x00,0x0e,0x2f,0x00,0x0f,
-0x2c,0x00,0x03,0x70,0x14,0x00,0x00,0x56,0x00,0x00,0x10,0xd6,0x09,0xf2,0x07,0x0c,
-0x00,0x00,0x60,0x00,0xbb,0xb7,0x67,0x07,0x78,0x40,0x67,0x67,0x07,0x70,0xbb,0xc6,
-0x02,0x08,0x51,0xab,0xa0,0x77,0x06,0x0f,0x43,0x0e,0x02,0x5e,0x01,0x40,0x00,0xa8,
-0x30,0x33,0x0c,0xe2,0x49,0x00,0x3a,0x04,0x90,0x03,0xa0,0xad,0xaa,0xbe,0x24,0xeb,
-0xbc,0xa0,0x0e,0x00,0x00,0x07,0x00,0x00,0x2d,0x01,0xc2,0x1c,0xd7,0x00,0x04,0xcb,
-0xd2,0x04,0xa0,0x67,0x04,0x90,0x57,0x03,0x00,0x2a,0x19,0x96,0x4a,0x07,0x48,0x00,
-0x00,0x3a,0xa5,0xcd,0x04,0x2a,0x2a,0xa7,0x20,0x00,0x29,0x3a,0xa6,0xeb,0x04,0x3a,
-0x14,0x07,0x92,0x20,0x00,0x46,0x28,0x45,0x07,0x80,0x20,0x00,0x02,0xe5,0x0e,0x63,
-0x3c,0x92,0xa5,0x04,0x60,0x00,0x46,0x05,0x53,0x90,0xa1,0x0b,0x40,0x28,0xfe,0x0e,
-0x01,0xb5,0x0c,0x77,0x3a,0x00,0x02,0xb3,0xa0,0x00,0x2b,0x07,0x00,0xd4,0xa3,0x90,
-0x39,0x3a,0x09,0xab,0x20,0x46,0x28,0x00,0x00,0x58,0x2a,0x02,0x00,0xa0,0x00,0x3a,
-0x01,0xc5,0x00,0x05,0x10,0x00,0x48,0x90,0x73,0x0b,0x07,0x03,0x00,0xc5,0xa2,0x0b,
-0x20,0x3c,0xb8,0x00,0x07,0xa0,0x03,0x11,0x04,0x90,0x02,0x00,0x3f,0x80,0x3c,0x30,
-0x49,0x0f,0x02,0x20,0x00,0x83,0x11,0x0c,0x0e,0x41,0x0d,0xfe,0x08,0x1a,0x00,0x03,
-0x40,0x00,0x58,0x0b,0x35,0x89,0x60,0x5d,0xd0,0x05,0x88,0x80,0x58,0x0a,0x50,0x04,
-0x20,0x01,0xa0,0x00,0x78,0x0f,0x33,0x0b,0x21,0x30,0x04,0x06,0x00,0x07,0x06,0x0e,
-0x20,0x00,0x10,0x05,0x71,0x05,0x23,0x01,0x00,0x91,0x0d,0x89,0x23,0x65,0x10,0x49,
-0x38,0x04,0x95,0x30,0x23,0x00,0x64,0x58,0xc0,0x58,0x70,0x58,0x00,0x02,0x00,0x04,
-0x1b,0x00,0x25,0x94,0x50,0x20,0x00,0x00,0x5d,0x00,0x16,0x8a,0x60,0x00,0x45,0x4a,
-0x30,0x09,0xc3,0x3d,0x00,0xff,0x02,0x39,0x03,0x90,0x39,0x08,0xc1,0x49,0x03,0x90,
-0x39,0x00,0x00,0x04,0x30,0x00,0x0a,0x00,0xe3,0x08,0x03,0x00,0x49,0x06,0x09,0x16,
-0x02,0x0f,0x27,0x00,0x03,0x04,0x7f,0x02,0x09,0x2b,0x00,0x10,0x06,0xa5,0x1e,0x7f,
-0x01,0x00,0x00,0x52,0x30,0x00,0x6b,0x5f,0x00,0x03,0x2c,0x06,0x87,0x5f,0x00,0x41,
-0x0b,0x00,0x00,0x15,0xdf,0x06,0x62,0x06,0x80,0x85,0x06,0x60,0x75,0x03,0x00,0xff,
-0x21,0x4d,0x00,0x49,0x4f,0x60,0x49,0x49,0xc1,0x49,0x49,0x59,0x49,0x49,0x0b,0x79,
-0x49,0x02,0xe9,0x49,0x00,0x99,0x00,0x00,0x58,0x00,0x04,0xc3,0x5a,0xac,0x15,0x80,
-0x76,0x57,0x06,0x75,0x70,0x67,0x57,0x06,0x70,0x00,0x66,0x00,0x5c,0x20,0x03,0xaa,
-0x50,0x2d,0x09,0x02,0x2c,0x09,0xaa,0xdc,0x06,0x6f,0x01,0x42,0x30,0x00,0x89,0x10,
-0x2d,0x00,0x02,0x01,0x09,0x06,0x0b,0x2f,0x07,0x4f,0x10,0x00,0x97,0x80,0x2d,0x00,
-0x02,0x4a,0x01,0xaa,0x30,0x22,0x5c,0x07,0xf0,0x01,0x08,0xdd,0xfd,0xdb,0x4a,0x02,
-0xb0,0x00,0x85,0x02,0xb0,0x00,0x84,0x02,0xeb,0xb5,0x08,0x00,0xf0,0x0d,0x49,0x02,
-0xb0,0x00,0x08,0xcb,0xeb,0xba,0x0a,0xba,0x4c,0xb3,0x67,0x05,0xe0,0x1b,0x84,0x02,
-0xeb,0xbb,0x67,0x05,0xe0,0x00,0x0a,0xba,0x5b,0xb6,0x39,0x06,0x1f,0x74,0x15,0x11,
-0x03,0x91,0x02,0xa0,0x02,0x00,0x6c,0xa0,0x67,0x00,0x66,0x02,0x00,0x0f,0x23,0x00,
-0x02,0x21,0x00,0x50,0x9d,0x07,0x25,0x10,0x00,0x65,0x0f,0x44,0x23,0x07,0x40,0x10,
-0xdd,0x05,0x0f,0x32,0x00,0x01,0x28,0x28,0x90,0x55,0x00,0x5e,0x00,0x06,0x00,0x06,
-0x50,0x7d,0x11,0x01,0xca,0x07,0x09,0xaf,0x0f,0x01,0x87,0x0b,0x0e,0x29,0x00,0x01,
-0x0a,0x05,0x09,0x29,0x00,0x0c,0x24,0x00,0x68,0xcc,0x50,0x06,0x60,0x00,0x57,0x4d,
-0x00,0x62,0xca,0x00,0x09,0x30,0x00,0x93,0x89,0x05,0x0e,0x52,0x00,0x2c,0x07,0x86,
-0x7b,0x00,0x0f,0x0a,0x12,0x02,0x20,0x00,0x75,0x2f,0x21,0x05,0x45,0x10,0x8f,0x03,
-0x90,0x39,0x03,0x15,0x00,0x00,0xc5,0x2d,0x00,0x04,0x90,0x32,0x00,0x92,0x1b,0x20,
-0xae,0x60,0x1b,0x00,0x02,0x00,0x22,0x0c,0x70,0x25,0x00,0x38,0x07,0xeb,0x10,0x25,
-0x00,0xef,0x01,0xb0,0x0a,0xe6,0x0b,0xe8,0x01,0xb0,0x01,0xb0,0x00,0xc7,0x03,0x99,
-0xe6,0x0a,0x04,0x03,0x83,0x09,0x03,0x7e,0x09,0x8f,0x57,0x08,0x51,0xcb,0xc5,0x05,
-0xaa,0x40,0x2c,0x00,0x02,0x2c,0x0a,0xaa,0xea,0x08,0x5f,0x02,0x23,0x10,0x01,0x98,
-0x57,0x0b,0x03,0x01,0xf7,0x06,0x0a,0x17,0x09,0x01,0x7f,0x0d,0x0f,0x2d,0x00,0x02,
-0x79,0x01,0x71,0x00,0x61,0x60,0x01,0x71,0x86,0x00,0x00,0x04,0x02,0x2f,0xa8,0x50,
-0x2f,0x00,0x02,0x4a,0x02,0xaa,0x20,0x32,0x5c,0x00,0x0d,0x27,0x00,0x40,0xc2,0x08,
-0xbd,0x90,0x22,0x0f,0x2a,0x2b,0x10,0x84,0x00,0x40,0xa0,0x00,0x0c,0x30,0xb0,0x0d,
-0x3f,0x00,0x1a,0x91,0x52,0x13,0x0a,0x6e,0x00,0x5a,0x20,0x00,0x02,0x02,0xb1,0x11,
-0x00,0x37,0x02,0x2f,0x04,0x89,0x17,0x0c,0x03,0x5e,0x07,0xa1,0x00,0x20,0x10,0xca,
-0x09,0x3f,0x08,0x29,0x10,0x2f,0x00,0x02,0x02,0x28,0x03,0x0f,0x91,0x13,0x02,0x01,
-0x42,0x0a,0x09,0xfc,0x11,0x2f,0x00,0x91,0x2a,0x00,0x03,0x3b,0x01,0x90,0x00,0x26,
-0x12,0x20,0x03,0x25,0x36,0x02,0x0f,0x2d,0x00,0x02,0x2c,0x08,0x83,0x57,0x00,0x60,
-0x0a,0x84,0x90,0x48,0x04,0x80,0x03,0x00,0xf0,0x01,0x00,0x3e,0x33,0xe3,0x66,0x10,
-0x00,0x49,0x91,0x16,0xa7,0x05,0x40,0x00,0x6a,0xaa,0x53,0x0b,0xf0,0x06,0x15,0xaa,
-0x00,0x02,0x7c,0xff,0xfe,0x00,0x0e,0xff,0xfe,0xbe,0x00,0x0e,0xd8,0x30,0x3e,0x00,
-0x0e,0x30,0x00,0x05,0x00,0xe0,0x01,0x6e,0x00,0x1e,0x30,0x4f,0xfe,0x0d,0xff,0x30,
-0x2d,0xf8,0x0d,0xfd,0x04,0x10,0x00,0x04,0x00,0xf0,0x31,0x75,0xcc,0xcc,0xc6,0x7c,
-0x8a,0x11,0x18,0xab,0xca,0x90,0x00,0x7b,0xc9,0x4f,0xcc,0xce,0x79,0xdb,0xa0,0x00,
-0x7c,0xda,0x59,0x00,0x07,0x7a,0xb9,0xfd,0xdd,0xea,0xb0,0x34,0x23,0x44,0x44,0x3f,
-0xf9,0xcf,0xff,0xff,0xef,0x8b,0xff,0xff,0xe7,0x84,0x68,0x88,0x87,0xff,0xad,0xff,
-0xff,0xf8,0x94,0x69,0x99,0x98,0xde,0x8a,0xee,0xee,0xdf,0x1b,0x00,0x40,0x45,0x23,
-0x55,0x55,0x06,0x0d,0xf0,0x0c,0x07,0x50,0x00,0x00,0x07,0xfd,0x23,0x00,0x07,0xfe,
-0x2d,0xf4,0x07,0xfe,0x20,0x5f,0xfa,0xfe,0x20,0x00,0x5f,0xfe,0x20,0x00,0x00,0x4d,
-0x20,0x6e,0x24,0xf4,0x58,0x02,0x0e,0xe2,0x0c,0xf1,0x5f,0xec,0xf8,0x00,0x6f,0xf9,
-0x00,0x0c,0xff,0xe2,0x0c,0xf8,0x5f,0xe0,0x98,0x00,0x5b,0x00,0x00,0x02,0xd2,0x00,
-0x00,0x7b,0x3f,0x3b,0x70,0x4f,0x73,0xf3,0x8f,0x4a,0xc0,0x3f,0x30,0xca,0xd9,0x03,
-0xf3,0x09,0xdb,0xb0,0x02,0x00,0xbc,0x6f,0x40,0x00,0x4f,0x60,0xbf,0xa7,0xaf,0xb0,
-0x00,0x7d,0xfd,0x70,0x00,0x00,0x06,0xb6,0x00,0x00,0x31,0xcf,0xc1,0x30,0x4f,0xff,
-0xff,0xff,0x47,0xff,0xb4,0xbf,0xf7,0x0d,0xf2,0x02,0xfd,0x04,0xff,0x70,0x7f,0xf4,
-0x6f,0xff,0xff,0xff,0x60,0x75,0xef,0xe5,0x70,0x00,0x08,0xf8,0x84,0x12,0x00,0xf9,
-0x05,0xf0,0x1b,0x00,0x2d,0xe3,0xd9,0x00,0x00,0x4e,0x97,0xff,0x90,0x00,0x6f,0x7b,
-0xc6,0xfb,0x00,0x9e,0x6d,0xff,0xe6,0xdb,0x07,0x4e,0xff,0xff,0xf5,0x80,0x05,0xff,
-0xa9,0xff,0x70,0x00,0x5f,0xf3,0x1f,0xf7,0x00,0x03,0xcc,0x20,0xcc,0xbb,0x12,0x10,
-0x9c,0xc5,0x00,0x23,0xdf,0x60,0x05,0x00,0xf0,0x47,0x58,0xef,0xb7,0x10,0x00,0x4f,
-0xff,0xfc,0x00,0x00,0x04,0xff,0xc0,0x00,0x19,0xa9,0x7c,0x6a,0xa6,0x3f,0xff,0xfc,
-0xfe,0xec,0x2f,0xff,0xff,0xfc,0xbb,0x01,0xdf,0xff,0xfe,0x20,0x00,0xba,0x22,0x22,
-0x8c,0x00,0x5f,0x10,0x00,0x00,0xe7,0x0e,0xb6,0x30,0x02,0x6a,0xf0,0xff,0xfe,0x44,
-0xdf,0xff,0x2f,0xff,0xff,0xff,0xff,0xf2,0xcf,0xff,0xff,0xff,0xfe,0x00,0x00,0x5b,
-0xda,0x43,0xd0,0x9f,0xa7,0xaf,0xbf,0x5f,0x40,0x04,0x7f,0xf9,0x90,0x00,0xde,0xee,
-0x99,0x00,0xf1,0x02,0x0f,0xff,0xe0,0x00,0x9a,0xff,0x74,0x00,0x3f,0x5f,0xdf,0x85,
-0x8f,0xa0,0xf3,0x6c,0xfd,0x0e,0x18,0xf1,0x01,0x15,0xf8,0xff,0xff,0x8f,0xff,0xf8,
-0xff,0xff,0x84,0x59,0xf8,0x00,0x09,0x70,0x00,0x22,0x18,0xf1,0x02,0x05,0xf8,0x00,
+0x0b,0xf8,0x6c,0x43,0x02,0xdf,0xcf,0xe6,0xcf,0xe9,0xcf,0xea,0xcf,0xeb,0xcf,0xef,
+0xcf,0xf1,0xcf,0xf3,0xcf,0xf7,0xcf,0xfa,0xcf,0xff,0xcf,0x04,0xd0,0x05,0xd0,0x06,
+0xd0,0x1c,0xd0,0x21,0xd0,0x26,0xd0,0x29,0xd0,0x2a,0xd0,0x2b,0xd0,0x2f,0xd0,0x30,
+0xd0,0x31,0xd0,0x32,0xd0,0x45,0xd0,0x46,0xd0,0x4c,0xd0,0x4e,0xd0,0x4f,0xd0,0x52,
+0xd0,0x55,0xd0,0x56,0xd0,0x57,0xd0,0x59,0xd0,0x71,0xd0,0x73,0xd0,0xa2,0xd0,0xa3,
+0xd0,0xa5,0xd0,0xa7,0xd0,0xbe,0xd0,0xc5,0xd0,0xc8,0xd0,0xd1,0xd0,0xfa,0xd0,0x02,
+0xd1,0x39,0xd1,0xc9,0xd1,0x1e,0xd2,0x1f,0xd2,0x20,0xd2,0x21,0xd2,0x22,0xd2,0x65,
+0xd2,0x71,0xd2,0xcb,0xd2,0xe2,0xd2,0x38,0xd5,0xa0,0xd7,0x80,0xd8,0x00,0x01,0x00,
+0x2f,0xfd,0x00,0x01,0x00,0x06,0x1b,0xf8,0x08,0x00,0x00,0x01,0x00,0xbf,0xfc,0xfc,
+0x00,0xff,0xfc,0x00,0xfa,0x00,0x00,0x00,0x01,0x35,0x00,0x03,0x4f,0x01,0x01,0x00,
+0x02,0x19,0x00,0x02,0x2f,0xf4,0x00,0x01,0x00,0x18,0x1f,0xf0,0x21,0x00,0x0d,0x13,
+0xf8,0x8f,0x00,0xa1,0x00,0xff,0x00,0x00,0xf7,0xff,0xfa,0xfb,0x00,0xf9,0x11,0x00,
+0x00,0x0f,0x00,0x4f,0xff,0xff,0xfc,0xfe,0x9e,0x00,0x01,0x30,0xfe,0x00,0xfe,0x31,
+0x00,0x0f,0x01,0x00,0x03,0x1c,0xfe,0x0a,0x00,0x19,0xff,0x1f,0x00,0x06,0x0e,0x00,
+0x13,0xf9,0x0e,0x00,0x10,0xfe,0x02,0x00,0x2e,0xfd,0xfe,0x47,0x00,0x0b,0x0f,0x01,
+0x05,0x42,0x00,0x11,0xff,0x37,0x00,0x3c,0xff,0xfe,0xfe,0xe8,0x00,0x35,0xf4,0x00,
+0xed,0x27,0x00,0x20,0xfe,0xff,0x23,0x00,0x4e,0x00,0x00,0xfe,0xfe,0x59,0x01,0x03,
+0x5f,0x00,0x1e,0x01,0x1b,0x00,0x0e,0x82,0x00,0x0f,0x01,0x00,0x0b,0x1b,0xfc,0x28,
+0x00,0x12,0xfe,0x70,0x00,0x25,0xfe,0xfd,0x1e,0x01,0x14,0xe8,0x75,0x00,0x97,0xfb,
+0x00,0x00,0xed,0xfc,0xf4,0xf6,0x00,0xef,0x32,0x02,0x28,0xf7,0xfa,0x4d,0x00,0x75,
+0xe9,0x00,0x00,0x00,0xf6,0x00,0xf2,0x63,0x01,0x10,0xff,0xc3,0x00,0x00,0xaf,0x00,
+0x14,0x01,0x2f,0x01,0x0b,0x70,0x02,0x2f,0xfe,0xff,0xa5,0x00,0x10,0x3e,0xfa,0x00,
+0xff,0x9c,0x02,0x06,0xb1,0x02,0xb1,0xf1,0xf0,0x00,0x00,0xfa,0xfe,0xef,0xff,0x01,
+0x00,0x01,0x69,0x00,0xf2,0x02,0xf8,0xf9,0x00,0xf8,0xf9,0xfb,0xf8,0x00,0xf9,0xfb,
+0xfc,0xfb,0xfc,0x00,0xf3,0xf8,0xf9,0x32,0x01,0x66,0xf0,0xfd,0x00,0x00,0xfb,0xff,
+0x43,0x01,0x62,0xfd,0xfd,0x00,0x00,0xfd,0xfe,0x67,0x01,0x25,0x00,0x01,0x59,0x01,
+0x22,0xf7,0xfc,0x57,0x00,0x13,0x01,0x11,0x00,0x23,0xfe,0xfe,0x8a,0x01,0x1a,0x00,
+0xe8,0x02,0x14,0xfd,0x38,0x01,0x15,0x01,0x6c,0x01,0x02,0xd4,0x01,0x07,0x4b,0x01,
+0xe0,0x01,0xfd,0xf1,0xfc,0x00,0x00,0xf9,0xfe,0xf9,0xff,0x01,0xf9,0x01,0x01,0x9e,
+0x00,0xf6,0x03,0xfb,0xfb,0xfe,0xfd,0xfb,0xfd,0xfc,0xfe,0xfd,0xff,0x00,0xfe,0xfe,
+0x01,0xf9,0xfc,0xfc,0xfd,0x91,0x00,0x1a,0xfe,0x64,0x02,0x0e,0x22,0x02,0x0a,0x1c,
+0x00,0x0f,0x01,0x00,0x03,0x1f,0xfb,0x49,0x01,0x09,0x1f,0xff,0x1a,0x02,0x13,0x11,
+0xff,0xb8,0x01,0x0e,0xf9,0x02,0x0f,0x58,0x00,0x10,0x0f,0x1d,0x00,0x0a,0x1e,0x01,
+0x8a,0x03,0x19,0x01,0x8a,0x00,0x15,0x01,0x56,0x03,0x0f,0x01,0x00,0x25,0x0e,0x8a,
+0x00,0x1f,0xf6,0xea,0x00,0x13,0x00,0x7b,0x00,0x1c,0xf7,0x5e,0x02,0x20,0xff,0x01,
+0x51,0x00,0x10,0x04,0x58,0x02,0x0f,0x78,0x00,0x1b,0x1b,0x01,0x2a,0x05,0x02,0xf5,
+0x03,0x1f,0x01,0x29,0x01,0x01,0x1f,0xf7,0xea,0x00,0x27,0x1f,0xff,0x27,0x00,0x2c,
+0x0f,0x43,0x00,0x0a,0x03,0xbb,0x05,0x30,0x02,0x03,0x00,0x02,0x01,0x2d,0x04,0x05,
+0x21,0x00,0xf1,0x0c,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,
+0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,
+0x00,0xff,0x0c,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,
+0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x73,0x00,
+0x04,0x11,0x06,0x01,0x00,0xe0,0x00,0x08,0x0a,0x0a,0x0a,0x0a,0x0c,0x0c,0x0c,0x0c,
+0x09,0x0c,0x09,0x09,0x11,0x08,0x91,0x00,0x0d,0x0d,0x0d,0x0d,0x17,0x00,0x00,0x1a,
+0x01,0x00,0x61,0x00,0x1c,0x1d,0x1d,0x1d,0x1d,0x31,0x00,0x20,0x1f,0x21,0x01,0x00,
+0x02,0x3d,0x00,0x50,0x24,0x1b,0x24,0x06,0x1a,0x02,0x00,0x22,0x08,0x1c,0x02,0x00,
+0x64,0x09,0x00,0x09,0x00,0x0a,0x1d,0x02,0x00,0x04,0x64,0x00,0x55,0x0c,0x1f,0x00,
+0x00,0x0c,0x02,0x00,0x83,0x00,0x00,0x0d,0x00,0x0e,0x00,0x00,0x0f,0x02,0x00,0x00,
+0x1f,0x00,0x00,0x02,0x00,0x80,0x1f,0x00,0x00,0x09,0x21,0x09,0x21,0x09,0x5b,0x00,
+0x11,0x22,0x02,0x00,0x03,0x01,0x00,0x11,0x13,0x02,0x00,0x17,0x0d,0x02,0x00,0x70,
+0x15,0x00,0x17,0x24,0x17,0x18,0x27,0x02,0x00,0x0f,0xb7,0x02,0x28,0x07,0x72,0x01,
+0x20,0x03,0x02,0x6d,0x01,0x4a,0x06,0x07,0x06,0x08,0x1f,0x00,0x00,0xce,0x00,0x60,
+0x00,0x0b,0x00,0x00,0x00,0x0b,0xc1,0x00,0x01,0x08,0x00,0xf1,0x08,0x0b,0x00,0x0d,
+0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,
+0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,
+0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x73,0x00,0x02,0x11,0x0a,0x01,0x00,
+0x26,0x24,0x0b,0x12,0x00,0x10,0x0b,0x01,0x00,0xa1,0x00,0x0b,0x0f,0x0f,0x0f,0x0f,
+0x13,0x00,0x00,0x16,0x01,0x00,0x20,0x25,0x17,0x01,0x00,0x02,0x57,0x00,0x02,0x83,
+0x01,0xa0,0x26,0x1e,0x1e,0x1e,0x1e,0x1f,0x00,0x1f,0x0a,0x16,0x02,0x00,0x22,0x0b,
+0x17,0x02,0x00,0x10,0x00,0x24,0x00,0x14,0x17,0x02,0x00,0x05,0x16,0x00,0x0b,0x01,
+0x00,0x1b,0x0c,0x10,0x00,0x10,0x19,0x02,0x00,0x51,0x19,0x00,0x00,0x0b,0x1a,0x02,
+0x00,0x03,0x30,0x00,0x22,0x0d,0x1c,0x02,0x00,0x10,0x0e,0xa0,0x01,0x36,0x00,0x0f,
+0x1e,0x02,0x00,0x70,0x11,0x00,0x13,0x1f,0x13,0x14,0x22,0x02,0x00,0x1f,0x00,0x74,
+0x01,0x26,0x50,0x00,0x00,0x00,0x00,0x00,0xf4,0xbd,0x49,0x39,0x38,0x38,0x26,0x00,
+0x28,0x66,0x66,0x55,0x11,0x10,0x00,0x90,0xa0,0x00,0xa0,0x90,0x1a,0xdb,0xc4,0x02,
+0x76,0x30,0x4c,0xbd,0xa0,0x08,0x1a,0x00,0x0a,0x0a,0x00,0x00,0x70,0x00,0x6e,0x70,
+0x2b,0x09,0x53,0xb0,0x23,0x08,0xc5,0x00,0x01,0xb5,0x65,0x04,0x81,0xc9,0xc2,0x00,
+0xa0,0x00,0x2a,0x80,0x00,0x07,0x19,0x0a,0x00,0x72,0x96,0x50,0x01,0x87,0xa0,0x00,
+0x00,0x83,0x98,0x00,0x28,0x63,0x72,0x02,0x02,0xaa,0x00,0x08,0xb9,0x00,0x0d,0x0b,
+0x00,0x0c,0x6b,0x00,0x09,0xe0,0x00,0x59,0x68,0x91,0x75,0x0a,0xc0,0x1a,0x9b,0xc3,
+0x81,0x80,0x10,0x00,0x20,0x38,0x0b,0x02,0x90,0x57,0x06,0x60,0x57,0x01,0xb0,0x0a,
+0x10,0x19,0x00,0x00,0x20,0x07,0x40,0x0c,0x00,0x93,0x06,0x60,0x57,0x06,0x50,0xa2,
+0x1a,0x08,0x20,0x00,0x00,0x06,0x40,0x8b,0xa7,0x0b,0xa0,0x34,0x61,0x00,0xa0,0x00,
+0x0d,0x00,0x8c,0xfc,0x90,0x0d,0x00,0x00,0xd0,0x00,0x75,0x92,0x10,0x9a,0x30,0x37,
+0x00,0x74,0x00,0xb0,0x03,0x70,0x09,0x10,0x0a,0x00,0x55,0x00,0xa0,0x00,0x0a,0xba,
+0x04,0x80,0x75,0x75,0x04,0x88,0x50,0x48,0x75,0x04,0x74,0x80,0x75,0x0a,0xba,0x00,
+0x05,0xc3,0x27,0xa3,0x00,0x93,0x02,0x00,0xf1,0x5c,0x1a,0xbb,0x07,0x50,0x85,0x10,
+0x08,0x40,0x02,0xb0,0x00,0xc2,0x00,0xb3,0x00,0x6e,0xbb,0x70,0x0b,0xba,0x06,0x50,
+0x84,0x00,0x09,0x30,0x3c,0xa0,0x00,0x08,0x56,0x40,0x76,0x1b,0xaa,0x00,0x00,0x2f,
+0x00,0x0a,0xe0,0x03,0x8d,0x00,0xb1,0xd0,0x57,0x0d,0x09,0xbb,0xf9,0x00,0x0d,0x00,
+0x0c,0xcc,0x60,0xc0,0x00,0x0e,0xba,0x10,0x30,0x68,0x00,0x02,0xa3,0x90,0x48,0x09,
+0xbb,0x10,0x03,0xb8,0x00,0xb1,0x00,0x4c,0xa9,0x05,0xa0,0x76,0x66,0x03,0x93,0xa0,
+0x67,0x08,0xbb,0x00,0x7b,0xbc,0x90,0x00,0x83,0x00,0x0c,0x00,0x06,0x60,0x00,0xc1,
+0x00,0x39,0x00,0x0a,0x30,0x8c,0x00,0xf1,0x2a,0x85,0x39,0x09,0x30,0xbc,0xb0,0x58,
+0x07,0x66,0x60,0x57,0x0b,0xbb,0x10,0x0a,0xb9,0x06,0x60,0xa3,0x84,0x06,0x65,0x80,
+0x97,0x09,0xab,0x50,0x00,0xb1,0x07,0xb4,0x00,0x47,0x00,0x00,0x00,0x47,0x65,0x00,
+0x00,0x00,0x66,0x92,0x10,0x00,0x4a,0x4b,0x81,0x6b,0x50,0x00,0x7b,0x00,0x00,0x3b,
+0xbb,0x30,0x05,0x00,0xf1,0x50,0x59,0x10,0x00,0x3a,0x91,0x02,0x8b,0x25,0xb3,0x00,
+0x00,0x00,0x00,0x3c,0xc5,0x62,0x0d,0x00,0x2b,0x00,0xc2,0x05,0x70,0x00,0x00,0x05,
+0x50,0x00,0x79,0x99,0x20,0x07,0x40,0x00,0x90,0x19,0x06,0x94,0x26,0x54,0x28,0x28,
+0x09,0x72,0x73,0x37,0x08,0x63,0x82,0x56,0x17,0x36,0x3a,0x7a,0x91,0x0a,0x10,0x00,
+0x00,0x01,0x99,0x94,0x00,0x00,0x97,0x00,0x00,0xbb,0x00,0x04,0x68,0x20,0x0a,0x13,
+0x80,0x0e,0xbb,0xd0,0x56,0x00,0x83,0xb2,0x00,0x49,0x4e,0xbc,0x50,0x49,0x00,0xd0,
+0x49,0x01,0xb0,0x4d,0xbe,0x09,0x00,0xf0,0x17,0x00,0xd0,0x4e,0xbc,0x60,0x06,0xcb,
+0x80,0x2c,0x00,0xa3,0x67,0x00,0x11,0x76,0x00,0x00,0x67,0x00,0x11,0x2c,0x00,0xa3,
+0x05,0xbb,0x70,0x4e,0xbb,0x30,0x49,0x01,0xc0,0x49,0x00,0x94,0x49,0x00,0x75,0x06,
+0x00,0xf4,0x08,0x01,0xd0,0x4e,0xbc,0x30,0x4e,0xbb,0x84,0x90,0x00,0x49,0x00,0x04,
+0xeb,0xb4,0x49,0x00,0x04,0x90,0x00,0x4e,0xbb,0x90,0x12,0x00,0x21,0xdb,0xb2,0x12,
+0x00,0xf2,0x0c,0x49,0x00,0x00,0x05,0xcb,0x90,0x2c,0x00,0x84,0x67,0x00,0x00,0x76,
+0x09,0xb6,0x67,0x00,0x67,0x1c,0x00,0x77,0x05,0xcb,0xa1,0x49,0x00,0x3a,0x03,0x00,
+0x35,0x4e,0xbb,0xca,0x0c,0x00,0x03,0x01,0x00,0x53,0x00,0x09,0x40,0x00,0x94,0x05,
+0x00,0xf2,0x0b,0x4a,0x20,0xb2,0x3c,0xb8,0x00,0x49,0x01,0xc2,0x49,0x0b,0x40,0x49,
+0x96,0x00,0x4e,0xf3,0x00,0x4c,0x2d,0x00,0x49,0x06,0x90,0x49,0x00,0x72,0x00,0x06,
+0x05,0x00,0xf0,0x4b,0x4e,0xbb,0x70,0x4f,0x00,0x02,0xf1,0x4e,0x60,0x08,0xe1,0x49,
+0xb0,0x0c,0xb1,0x49,0xb1,0x48,0xb1,0x49,0x57,0xa2,0xb1,0x49,0x0c,0xc0,0xb1,0x49,
+0x09,0x60,0xb1,0x4d,0x00,0x2a,0x4f,0x70,0x2a,0x49,0xc1,0x2a,0x49,0x4a,0x2a,0x49,
+0x0a,0x7a,0x49,0x01,0xea,0x49,0x00,0x7a,0x05,0xcc,0x70,0x2c,0x00,0xa4,0x67,0x00,
+0x49,0x75,0x00,0x2a,0x67,0x00,0x49,0x2c,0x00,0xa4,0x05,0xcc,0x80,0x4e,0xbc,0x70,
+0x49,0x00,0xb2,0x49,0x00,0x84,0x49,0x00,0xc2,0x4e,0xbb,0x60,0x49,0x00,0xc5,0x00,
+0x10,0x06,0x2a,0x00,0xf1,0x0a,0xa3,0x66,0x00,0x48,0x85,0x00,0x39,0x76,0x00,0x48,
+0x2c,0x00,0xa4,0x06,0xcd,0xc0,0x00,0x00,0x85,0x00,0x00,0x00,0x4e,0xbc,0x60,0x43,
+0x01,0xfb,0x16,0xd0,0x4e,0xbe,0x30,0x49,0x0a,0x40,0x49,0x02,0xb0,0x49,0x00,0xb2,
+0x0a,0xbc,0x35,0x80,0x1d,0x4b,0x10,0x00,0x5d,0xb2,0x00,0x04,0xc8,0x60,0x0d,0x0a,
+0xbc,0x50,0x8b,0xeb,0xb1,0x00,0xb1,0x00,0x03,0x00,0x37,0x67,0x00,0x94,0x03,0x00,
+0xf3,0x4c,0x93,0x3a,0x00,0xc1,0x08,0xbc,0x60,0xb3,0x00,0x77,0x58,0x00,0xc1,0x0d,
+0x02,0xc0,0x0b,0x37,0x60,0x05,0x8d,0x10,0x00,0xeb,0x00,0x00,0xa6,0x00,0xa3,0x07,
+0x80,0x2a,0x66,0x0b,0xb0,0x57,0x2a,0x0b,0xa0,0x93,0x0c,0x38,0x64,0xc0,0x0b,0x83,
+0x28,0xc0,0x08,0xd0,0x0d,0x90,0x04,0xb0,0x0a,0x50,0x69,0x00,0xd1,0x0c,0x38,0x70,
+0x03,0xdd,0x00,0x00,0xd7,0x00,0x04,0xbd,0x00,0x0d,0x27,0x80,0x78,0x00,0xd2,0xb4,
+0x00,0xd1,0x3c,0x06,0x90,0x0a,0x4d,0x10,0x02,0xf8,0x00,0x00,0xc2,0x70,0x00,0x80,
+0x6b,0xbc,0xd0,0x00,0x09,0x50,0x00,0x3b,0x12,0x00,0xe3,0x07,0x70,0x00,0x2c,0x00,
+0x00,0x9d,0xbb,0xb0,0x4c,0x35,0x70,0x57,0x05,0x03,0x00,0xf2,0x03,0x4c,0x30,0xa2,
+0x00,0x48,0x00,0x0c,0x00,0x07,0x40,0x01,0xa0,0x00,0xb1,0x00,0x56,0xa9,0x1b,0x01,
+0x00,0xf0,0x0e,0xa9,0x04,0x10,0x0c,0x80,0x29,0xb0,0x83,0x74,0xab,0xbb,0x00,0x42,
+0x01,0xb0,0x0a,0xba,0x02,0x40,0xa3,0x09,0x9d,0x37,0x60,0xa3,0x3c,0xbb,0x40,0x66,
+0xe6,0x02,0xf2,0x32,0x6b,0xbb,0x16,0x80,0x67,0x66,0x03,0x96,0x80,0x67,0x6b,0xbb,
+0x10,0x0a,0xba,0x06,0x60,0x53,0x93,0x00,0x06,0x60,0x42,0x0a,0xaa,0x00,0x00,0x06,
+0x70,0x00,0x67,0x0b,0xbc,0x76,0x70,0x77,0x84,0x06,0x76,0x60,0x77,0x0a,0xab,0x70,
+0x09,0xba,0x06,0x70,0x84,0x9c,0xbb,0x56,0x60,0x10,0x0a,0xba,0x10,0x07,0xb1,0x0d,
+0x00,0x7e,0x80,0x0d,0x00,0x02,0x00,0x22,0x0b,0xbb,0x28,0x00,0xa2,0x70,0x77,0x0b,
+0xbc,0x60,0x20,0x85,0x1a,0xba,0x00,0x5e,0x00,0xf0,0x00,0xbc,0x16,0x80,0x85,0x66,
+0x07,0x56,0x60,0x75,0x66,0x07,0x50,0x46,0x00,0x58,0x01,0x00,0x34,0x04,0x50,0x00,
+0xb6,0x00,0x41,0x67,0x3d,0x30,0x67,0x67,0x00,0xd2,0x2c,0x16,0x8c,0x10,0x6e,0xc0,
+0x06,0x77,0x70,0x67,0x0b,0x30,0x58,0x01,0x00,0xc4,0x6b,0xbc,0x8b,0xb0,0x67,0x08,
+0x70,0x93,0x66,0x07,0x50,0x84,0x04,0x00,0x09,0x4f,0x00,0xf2,0x1d,0x0a,0xba,0x16,
+0x70,0x58,0x93,0x01,0xb6,0x60,0x58,0x0a,0xbb,0x00,0x6b,0xab,0x16,0x70,0x57,0x66,
+0x03,0x96,0x70,0x67,0x6c,0xab,0x16,0x60,0x00,0x66,0x00,0x00,0x0b,0xbb,0x66,0x70,
+0x76,0x84,0x06,0x66,0x70,0x76,0x0b,0xbc,0x60,0x8e,0x00,0xf3,0x0f,0x06,0xca,0x67,
+0x06,0x60,0x66,0x06,0x60,0x1b,0xb9,0x05,0x80,0x60,0x08,0xb7,0x04,0x30,0xb2,0x1b,
+0xba,0x00,0x1b,0x0a,0xe6,0x1b,0x01,0xb0,0x1b,0x00,0xc7,0x58,0x00,0xf0,0x31,0x55,
+0x70,0x85,0x1c,0xbc,0x50,0xb2,0x0c,0x05,0x71,0xa0,0x0b,0x65,0x00,0xac,0x00,0x04,
+0xa0,0x00,0xa1,0x1d,0x06,0x66,0x56,0xc2,0xa2,0x29,0xa4,0x7b,0x00,0xba,0x0c,0x90,
+0x09,0x60,0xa4,0x00,0x77,0x1c,0x00,0xca,0x40,0x06,0xd0,0x00,0xc9,0x40,0x76,0x0c,
+0x00,0xb2,0x0d,0x06,0x72,0xa0,0x1c,0x75,0x00,0xbd,0x00,0x05,0xa0,0x00,0x65,0xfa,
+0x03,0xf3,0x0d,0x6b,0xbf,0x00,0x09,0x60,0x04,0xa0,0x01,0xc1,0x00,0x8d,0xbb,0x10,
+0x02,0x90,0xa2,0x0c,0x00,0xc0,0x98,0x00,0xc0,0x0c,0x00,0xa2,0x02,0x90,0x36,0x01,
+0x00,0xf0,0x08,0x92,0x02,0xb0,0x0c,0x00,0xc0,0x07,0x90,0xc0,0x0c,0x02,0xb0,0x92,
+0x00,0x0a,0xa2,0x36,0x44,0x1a,0xb1,0x00,0x00,0x03,0x23,0x04,0xf0,0x0a,0xf4,0x00,
+0x09,0xaa,0xab,0xb3,0x00,0xb1,0x11,0x01,0xc2,0x0b,0x00,0x00,0x0a,0x40,0xdc,0xcc,
+0x88,0x60,0x00,0x00,0x1f,0x70,0x00,0xab,0x05,0xf5,0x25,0x00,0x02,0x00,0x00,0x00,
+0x9b,0x00,0x00,0x07,0x7e,0xaa,0xa6,0x69,0x01,0x11,0x2b,0x95,0x00,0x00,0x1b,0x0a,
+0x3c,0xcc,0xc9,0x00,0xbb,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x10,0x00,0x00,
+0x78,0xa2,0x00,0x09,0x60,0x0a,0x30,0x8e,0x70,0x1b,0xf2,0x00,0xc0,0x29,0x00,0x04,
+0x00,0x78,0xec,0xc8,0x00,0x00,0xab,0xb6,0x00,0x14,0x00,0xc0,0x7c,0xb0,0x1e,0xb2,
+0x1b,0x30,0x08,0x70,0x00,0xb5,0xa6,0x00,0xbc,0x03,0x02,0x01,0x00,0x10,0x08,0x49,
+0x00,0xf4,0x27,0xf4,0x00,0x00,0x00,0xd7,0xd0,0x00,0x00,0x5b,0x0b,0x50,0x00,0x0d,
+0x20,0x2d,0x00,0x06,0xa0,0x00,0xa6,0x00,0xef,0xff,0xff,0xe0,0x00,0x00,0x59,0x20,
+0x07,0x6b,0x4c,0x1d,0x67,0xd7,0xba,0x40,0xaf,0xb6,0xc0,0x0c,0x60,0xcc,0x10,0x20,
+0x1c,0x4b,0x00,0x0b,0x40,0x5d,0xcd,0x50,0x00,0x01,0x00,0xf3,0x38,0x03,0xdf,0xd4,
+0x10,0x05,0xa2,0xe2,0xa7,0x00,0xb1,0x01,0x01,0xb1,0x2b,0x00,0x00,0x0a,0x20,0xd1,
+0x00,0x00,0xc2,0x06,0xa1,0x01,0x89,0x00,0x06,0xaa,0xb8,0x00,0x00,0x01,0x21,0x00,
+0x00,0x00,0x20,0x00,0x00,0x00,0x8d,0xcc,0xc6,0x00,0x2d,0x0a,0x70,0x97,0x00,0xdb,
+0x5b,0x00,0xc1,0x0c,0x4a,0x00,0x09,0x30,0xc0,0x00,0x00,0xc1,0x04,0xa0,0x00,0x88,
+0x00,0x05,0xcc,0xd7,0x4e,0x00,0xf2,0x0b,0x33,0x33,0x20,0x3f,0xbb,0xd8,0x09,0x80,
+0x0b,0x10,0xa5,0x07,0x80,0x3c,0x98,0x60,0x0b,0x47,0xaa,0x00,0xa4,0x04,0x90,0x02,
+0xcc,0xb1,0x20,0x00,0xf3,0x0b,0x46,0x40,0x02,0x4c,0xfd,0x52,0x83,0x33,0x22,0x88,
+0x0c,0xcb,0x08,0x80,0x22,0x20,0x88,0x09,0x98,0x08,0x88,0x88,0x87,0x70,0x0b,0xfb,
+0x41,0x00,0xf2,0x6f,0x12,0x04,0x02,0xbf,0xeb,0xb8,0xe7,0x00,0x08,0x07,0x70,0x00,
+0x80,0x09,0x30,0x08,0x2b,0x10,0x00,0xb7,0xd7,0x00,0x03,0x02,0xbf,0xeb,0x00,0x00,
+0x12,0x00,0x13,0x33,0x33,0x18,0x8f,0x44,0x68,0x81,0x53,0xef,0xa8,0x5f,0x05,0xa9,
+0x81,0x60,0x00,0x78,0x4e,0x00,0x07,0x83,0xb0,0x00,0x78,0xaf,0x87,0x78,0x00,0x17,
+0x97,0x00,0x00,0x3e,0x7e,0x7c,0x10,0x0d,0x30,0xd2,0x3b,0x02,0xb0,0x0c,0x10,0xc0,
+0x39,0x1a,0x3b,0x5b,0x00,0xda,0x83,0x79,0xd0,0x06,0xe3,0x00,0xb4,0x00,0x05,0xcc,
+0xb4,0x00,0x08,0x80,0x00,0x00,0x94,0x4a,0x00,0x00,0xb0,0x0b,0x4b,0x80,0xa3,0x3a,
+0xef,0xf4,0x1e,0xfa,0xef,0xf2,0x85,0x8f,0xff,0xb0,0xb3,0xff,0xff,0xf2,0xed,0xee,
+0xee,0xe4,0x84,0x00,0x10,0x2a,0x05,0x00,0xf0,0x05,0x3a,0x00,0x00,0xcc,0xcc,0xec,
+0x10,0x07,0x99,0x99,0x97,0x00,0x1d,0xec,0xdd,0xd0,0x00,0x1b,0x30,0x00,0x1e,0x01,
+0x03,0xa8,0x00,0xf2,0x26,0x01,0x86,0x10,0x00,0x00,0x17,0x68,0x70,0x00,0x00,0x36,
+0x94,0x00,0x00,0x17,0xa2,0x00,0x01,0x95,0x69,0x10,0x00,0xd5,0x98,0x7b,0x00,0x0c,
+0x68,0x77,0xa0,0x00,0x1a,0x77,0x90,0x00,0x0a,0xaa,0x91,0x02,0xa2,0x28,0xc1,0x29,
+0x00,0xc9,0xa2,0x90,0x00,0x0b,0x29,0x00,0x00,0xb2,0x07,0x00,0xf2,0x19,0xb1,0xeb,
+0xbb,0xbb,0x00,0x37,0x30,0x00,0x00,0x37,0x17,0x85,0x00,0x08,0x00,0x02,0x45,0x01,
+0x90,0x26,0xb2,0x80,0x62,0xaa,0x82,0x09,0x06,0x10,0x5e,0x00,0x71,0x27,0x07,0x93,
+0x07,0x00,0x58,0x88,0x88,0x60,0x24,0x02,0xf2,0x0e,0x00,0xb3,0x80,0x00,0x32,0x3e,
+0x88,0x00,0x6a,0x8b,0x2b,0x20,0x0b,0x00,0x7b,0xc0,0x00,0xa0,0x00,0xb3,0x00,0x37,
+0x00,0x0b,0x30,0x04,0x60,0x00,0xb3,0x8c,0x00,0xaf,0x19,0x56,0x39,0x19,0x50,0x01,
+0x50,0x00,0x00,0xa2,0x85,0x06,0x03,0x5f,0x00,0x06,0x10,0x00,0x38,0x1b,0x00,0x04,
+0x4f,0x33,0x00,0x01,0x99,0x1b,0x00,0x03,0x3f,0x03,0x99,0x30,0x18,0x00,0x02,0x3f,
+0x05,0x56,0x30,0x4b,0x00,0x03,0x4f,0x65,0x00,0x00,0x65,0x66,0x00,0x04,0xfe,0x14,
+0x00,0x7f,0xbb,0xa0,0x00,0x01,0xcd,0x00,0x00,0x00,0x09,0x7c,0x00,0x00,0x00,0x2e,
+0x0c,0xbb,0x60,0x00,0xa8,0x0b,0x10,0x00,0x03,0xfd,0xce,0x10,0x00,0x0c,0x50,0x0a,
+0xbb,0xb2,0x06,0x14,0x07,0xde,0xcc,0x70,0x00,0x39,0x00,0x00,0x39,0x00,0x03,0x30,
+0x00,0x0b,0x00,0x0a,0x07,0x6e,0x00,0x06,0x00,0x07,0x50,0x4e,0x17,0x00,0x4e,0x51,
+0x00,0x48,0x90,0x17,0x00,0x53,0x08,0x29,0x14,0xeb,0xb8,0x0d,0x00,0x12,0x44,0x1c,
+0x00,0x74,0xb9,0x07,0x00,0x66,0x03,0xa0,0x3a,0x03,0x00,0x26,0x04,0x30,0x0c,0x00,
+0x88,0x3a,0x00,0x01,0x50,0x0a,0x83,0x03,0xa0,0x02,0x00,0x2a,0x19,0x27,0x10,0x00,
+0xff,0x09,0x2e,0xbc,0x40,0x2b,0x00,0xc1,0x2b,0x00,0x66,0xbe,0x90,0x57,0x2b,0x00,
+0x76,0x2b,0x00,0xc1,0x2e,0xbc,0x40,0x01,0x99,0x50,0x0a,0x07,0x02,0x6f,0x00,0x60,
+0x00,0x00,0x84,0x00,0x10,0x07,0x02,0x5f,0x00,0x05,0x20,0x00,0x1a,0x1b,0x00,0x04,
+0x5f,0x24,0x00,0x00,0xa8,0x20,0x1b,0x00,0x02,0x3f,0x02,0x99,0x40,0x18,0x00,0x03,
+0x2f,0x74,0x60,0x4b,0x00,0x03,0xa0,0x00,0x05,0x70,0xb1,0x09,0xd5,0x00,0xac,0x60,
+0x57,0xc4,0x02,0xf2,0x09,0x05,0xcc,0xa6,0x2c,0x00,0xe4,0x67,0x07,0x79,0x75,0x18,
+0x2a,0x57,0x81,0x49,0x1d,0x60,0xa4,0x0b,0xcc,0x80,0x13,0x00,0x00,0x46,0x02,0x0f,
+0x37,0x07,0x02,0x02,0x46,0x02,0x0f,0x1b,0x00,0x03,0x4f,0x42,0x00,0x02,0x99,0x1b,
+0x00,0x03,0x3f,0x05,0x57,0x30,0x4e,0x00,0x04,0x4f,0x00,0x00,0x75,0x00,0x45,0x07,
+0x02,0xf5,0x1e,0x48,0x00,0x04,0x80,0x00,0x4d,0xaa,0x24,0x80,0x1c,0x48,0x01,0xc4,
+0xda,0xa2,0x48,0x00,0x00,0x0b,0xb8,0x05,0x80,0xd0,0x66,0x2b,0x06,0x65,0x90,0x66,
+0x0a,0x66,0x60,0x0d,0x66,0xaa,0x80,0x06,0x70,0x00,0x03,0x00,0x1a,0xba,0x02,0x30,
+0x26,0x07,0x59,0x00,0x57,0x00,0x03,0x00,0x38,0x07,0x58,0x03,0xb3,0x00,0x30,0x30,
+0x12,0x00,0x00,0x36,0x05,0xf0,0x02,0x8a,0x90,0x00,0x00,0x00,0xab,0xa0,0x24,0x0a,
+0x30,0x99,0xd3,0x76,0x0a,0x33,0xcb,0xb4,0x5a,0x0b,0x0a,0x38,0x00,0x79,0x01,0x72,
+0x00,0x52,0x70,0x01,0x72,0x26,0x00,0xf7,0x05,0x2b,0xb9,0xab,0x80,0x43,0x0c,0x50,
+0xa2,0x2a,0xae,0xaa,0xb3,0x94,0x0b,0x40,0x00,0x4c,0xb7,0xaa,0xb0,0x86,0x07,0xc9,
+0xba,0x00,0x0a,0x10,0x00,0xa1,0x00,0x07,0x60,0x00,0x04,0x00,0x7e,0x07,0x4a,0x00,
+0x66,0x00,0x03,0x12,0x00,0x00,0x96,0x00,0x19,0x20,0x12,0x00,0x01,0x82,0x00,0x09,
+0x12,0x00,0x61,0x0b,0x10,0x12,0x05,0x80,0x58,0x03,0x00,0x42,0x0b,0x21,0x20,0x58,
+0x0c,0x00,0x74,0x00,0x08,0x90,0x02,0x11,0x05,0x80,0x02,0x00,0x46,0x27,0x46,0x00,
+0x00,0x0e,0x00,0xf0,0x11,0x05,0x20,0x00,0x4d,0xc1,0x01,0x7c,0x20,0x6b,0xb8,0x3a,
+0x03,0xa6,0x60,0x2a,0x49,0x05,0x70,0x8b,0xa0,0x00,0x00,0x00,0x9a,0x90,0x00,0x00,
+0x06,0xbb,0xc1,0x68,0x08,0x33,0x07,0x00,0x38,0x07,0x58,0x06,0x70,0x00,0x04,0x00,
+0x92,0x07,0x00,0x6e,0x03,0x1a,0x03,0x12,0x00,0x03,0x38,0x01,0x08,0x24,0x00,0x02,
+0x4a,0x00,0xd3,0x00,0xab,0xa1,0x67,0x05,0x89,0x30,0x1b,0x66,0x05,0x80,0xab,0xb0,
+0x38,0x01,0x08,0x26,0x00,0x81,0xb0,0x00,0x00,0x00,0x9d,0xdd,0x90,0x00,0x0a,0x00,
+0xf0,0x01,0x02,0x10,0xab,0xe0,0x67,0x3a,0x88,0x38,0x2b,0x69,0x55,0x80,0xdb,0xb0,
+0x04,0x00,0xd9,0x07,0x29,0x03,0x00,0xbd,0x07,0x2c,0x00,0x76,0x12,0x00,0x59,0x03,
+0xb3,0x00,0x20,0x20,0x12,0x00,0x01,0x67,0x00,0x0a,0x36,0x00,0x4e,0xa3,0x00,0x02,
+0x00,0xcc,0x07,0xfe,0x0d,0x57,0x00,0x05,0x70,0x00,0x5c,0xbc,0x15,0x80,0x58,0x57,
+0x02,0xa5,0x80,0x58,0x5c,0xac,0x15,0x70,0x00,0x57,0x00,0x00,0x19,0x28,0x00,0x00,
+0x00,0x2e,0x00,0x3f,0x05,0xaa,0x40,0xaa,0x04,0x02,0x2c,0x09,0xaa,0x0e,0x02,0x3f,
+0x02,0x88,0x10,0x2a,0x00,0x02,0x96,0x0a,0x0a,0x00,0x39,0x40,0x1a,0xba,0x01,0x10,
+0x5e,0x02,0x0f,0xfb,0x04,0x03,0x47,0x82,0x00,0x00,0xa6,0x52,0x00,0x70,0xbc,0x40,
+0x00,0xa0,0x00,0x1c,0x20,0x00,0x03,0x2f,0x23,0x00,0x0a,0x0c,0x02,0x21,0x00,0x94,
+0x92,0x01,0x35,0x06,0x60,0x64,0xe3,0x09,0x4f,0x43,0x00,0x01,0x44,0x2d,0x00,0x03,
+0x5a,0x05,0xb1,0x00,0x30,0x20,0x10,0x0a,0x1f,0x55,0x57,0x00,0x04,0x00,0x11,0x02,
+0x09,0x2a,0x00,0x5f,0x01,0x34,0x00,0x00,0x33,0x2d,0x00,0x03,0x4a,0x08,0x84,0x00,
+0x03,0x2d,0x00,0x6f,0x04,0x15,0x00,0x01,0xd4,0x00,0xa6,0x0c,0x02,0xff,0x06,0x00,
+0x06,0x7c,0x00,0x06,0x85,0x0b,0xbc,0x70,0x67,0x07,0x70,0x84,0x06,0x70,0x66,0x07,
+0x70,0x0a,0xab,0x70,0x1f,0x05,0x02,0x00,0x45,0x0a,0x2b,0x6c,0xd2,0x2a,0x00,0x3d,
+0x07,0xaa,0x24,0x9b,0x05,0x2c,0x0a,0xaa,0x14,0x03,0x5e,0x04,0x15,0x00,0x29,0x70,
+0xd8,0x05,0x00,0x87,0x01,0x1a,0x30,0x73,0x03,0x2d,0x91,0x04,0x4f,0x00,0x2c,0x00,
+0xa0,0x4f,0x00,0x1e,0x4e,0x39,0x06,0x47,0x91,0x00,0x0b,0x50,0x24,0x00,0xce,0xbc,
+0x10,0x0a,0x20,0x00,0xa5,0x00,0x03,0x25,0x00,0x0c,0x50,0x2e,0x00,0x2c,0x06,0x86,
+0xd9,0x03,0x02,0xa5,0x01,0x0f,0x8e,0x0d,0x02,0x59,0x04,0xb2,0x00,0x30,0x20,0x7b,
+0x0b,0x50,0x20,0x85,0x1a,0xba,0x00,0xff,0x25,0x02,0x23,0x10,0x00,0x98,0x00,0x05,
+0xcb,0x90,0x2c,0x00,0x84,0x67,0x00,0x00,0x76,0x09,0xb6,0x67,0x00,0x67,0x1c,0x00,
+0x77,0x05,0xcb,0xa1,0x0a,0x0a,0x00,0x49,0x30,0x0b,0xbb,0x76,0x70,0x77,0x84,0x06,
+0x76,0x70,0x77,0x0b,0xbc,0x60,0x20,0x85,0x1a,0xba,0x00,0x00,0x64,0x2f,0x00,0x03,
+0x5e,0x00,0xa0,0x00,0x00,0x00,0x2f,0x00,0x0f,0x2c,0x00,0x03,0xf2,0x1b,0x14,0x00,
+0x00,0x56,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x0c,0x00,0x00,0x60,0x00,0xbb,0xb7,
+0x67,0x07,0x78,0x40,0x67,0x67,0x07,0x70,0xbb,0xc6,0x02,0x08,0x51,0xab,0xa0,0x00,
+0x24,0x00,0x00,0xa8,0x20,0x49,0x00,0x3a,0x03,0x00,0x35,0x4e,0xbb,0xca,0x0c,0x00,
+0xf2,0x16,0x01,0x40,0x00,0xa8,0x30,0x66,0x00,0x06,0x60,0x00,0x6b,0xbc,0x16,0x80,
+0x85,0x66,0x07,0x56,0x60,0x75,0x66,0x07,0x50,0x49,0x00,0x3a,0x04,0x90,0x03,0xa0,
+0xad,0xaa,0xbe,0x24,0xeb,0xbc,0xa0,0x0e,0x00,0x00,0x07,0x00,0xf2,0x01,0x00,0x04,
+0x90,0x00,0x1c,0xd7,0x00,0x04,0xcb,0xd2,0x04,0xa0,0x67,0x04,0x90,0x57,0x03,0x00,
+0x48,0x19,0x96,0x03,0xa0,0x02,0x00,0x84,0x00,0x00,0x3a,0xa5,0x00,0x00,0x05,0x80,
+0x02,0x00,0x2a,0x2a,0xa7,0x20,0x00,0x28,0x3a,0xa6,0x1e,0x00,0x4a,0x05,0x14,0x07,
+0x92,0x20,0x00,0x46,0x28,0x45,0x07,0x80,0x20,0x00,0x11,0x3a,0x01,0x00,0x90,0x3c,
+0x92,0xa5,0x04,0x60,0x00,0x05,0x80,0x58,0x03,0x00,0x62,0x90,0xa1,0x0b,0x40,0x28,
+0x3a,0x01,0x00,0x10,0x58,0x01,0x00,0x77,0x3a,0x00,0x02,0xb3,0xa0,0x00,0x2b,0x07,
+0x00,0xd4,0xa3,0x90,0x39,0x3a,0x09,0xab,0x20,0x46,0x28,0x00,0x00,0x58,0x2a,0x02,
+0x00,0xd8,0x00,0x3a,0x01,0xc5,0x00,0x05,0x10,0x00,0x48,0x90,0x00,0x09,0x40,0x03,
+0x00,0xc5,0xa2,0x0b,0x20,0x3c,0xb8,0x00,0x07,0xa0,0x03,0x11,0x04,0x90,0x02,0x00,
+0xf0,0x39,0x80,0x3c,0x30,0x49,0x01,0xc2,0x49,0x0b,0x40,0x49,0x96,0x00,0x4e,0xf3,
+0x00,0x4c,0x2d,0x00,0x49,0x06,0x90,0x49,0x00,0xb4,0x00,0x83,0x00,0x00,0x70,0x00,
+0x67,0x00,0x06,0x70,0x00,0x67,0x2c,0x16,0x8c,0x10,0x6e,0xc0,0x06,0x77,0x70,0x67,
+0x0b,0x30,0x1a,0x00,0x03,0x40,0x00,0x58,0x0b,0x35,0x89,0x60,0x5d,0xd0,0x05,0x88,
+0x80,0x58,0x0a,0x50,0x04,0x20,0x01,0xa0,0x00,0x49,0x35,0x01,0x06,0x05,0x00,0x61,
+0x4e,0xbb,0x70,0x0b,0x21,0x30,0xc7,0x00,0x01,0x03,0x00,0x1e,0x00,0x20,0x00,0x82,
+0x05,0x00,0x00,0xb0,0x00,0x01,0x00,0x58,0x01,0x00,0x89,0x23,0x65,0x10,0x49,0x38,
+0x04,0x95,0x30,0x23,0x00,0x64,0x58,0xc0,0x58,0x70,0x58,0x00,0x02,0x00,0x04,0x1b,
+0x00,0x25,0x94,0x50,0x20,0x00,0x00,0x5d,0x00,0x16,0x8a,0x60,0x00,0x45,0x4a,0x30,
+0x09,0xc3,0x3d,0x00,0xfa,0x1b,0x39,0x03,0x90,0x39,0x08,0xc1,0x49,0x03,0x90,0x39,
+0x00,0x00,0x04,0x30,0x00,0x0a,0x00,0x4d,0x00,0x2a,0x4f,0x70,0x2a,0x49,0xc1,0x2a,
+0x49,0x4a,0x2a,0x49,0x0a,0x7a,0x49,0x01,0xea,0x49,0x00,0x7a,0x00,0x67,0x00,0x03,
+0x16,0x02,0x0f,0x27,0x00,0x03,0x04,0x7f,0x02,0x09,0x2b,0x00,0xcf,0x06,0x00,0x01,
+0xa0,0x00,0x01,0x00,0x00,0x52,0x30,0x00,0x6b,0x5f,0x00,0x03,0x2c,0x06,0x87,0x5f,
+0x00,0xf2,0x00,0x0b,0x00,0x00,0x15,0x00,0x00,0x06,0xbb,0xc1,0x06,0x80,0x85,0x06,
+0x60,0x75,0x03,0x00,0xff,0x4e,0x4d,0x00,0x49,0x4f,0x60,0x49,0x49,0xc1,0x49,0x49,
+0x59,0x49,0x49,0x0b,0x79,0x49,0x02,0xe9,0x49,0x00,0x99,0x00,0x00,0x58,0x00,0x04,
+0xc3,0x5a,0xac,0x15,0x80,0x76,0x57,0x06,0x75,0x70,0x67,0x57,0x06,0x70,0x00,0x66,
+0x00,0x5c,0x20,0x03,0xaa,0x50,0x05,0xcc,0x70,0x2c,0x00,0xa4,0x67,0x00,0x49,0x75,
+0x00,0x2a,0x67,0x00,0x49,0x2c,0x00,0xa4,0x05,0xcc,0x80,0x09,0xaa,0x00,0x00,0x00,
+0x0a,0xba,0x16,0x70,0x58,0x93,0x01,0xb6,0x60,0x58,0x0a,0xbb,0x00,0x01,0x42,0x30,
+0x00,0x89,0x10,0x2d,0x00,0x02,0x59,0x0a,0x0a,0x00,0x39,0x40,0x2d,0x00,0x00,0xde,
+0x00,0x2f,0x97,0x80,0x2d,0x00,0x02,0x59,0x01,0xaa,0x30,0x22,0x30,0x2d,0x00,0xf0,
+0x01,0x08,0xdd,0xfd,0xdb,0x4a,0x02,0xb0,0x00,0x85,0x02,0xb0,0x00,0x84,0x02,0xeb,
+0xb5,0x08,0x00,0xf1,0x31,0x49,0x02,0xb0,0x00,0x08,0xcb,0xeb,0xba,0x0a,0xba,0x4c,
+0xb3,0x67,0x05,0xe0,0x1b,0x84,0x02,0xeb,0xbb,0x67,0x05,0xe0,0x00,0x0a,0xba,0x5b,
+0xb6,0x00,0x06,0x00,0x00,0x74,0x00,0x4e,0xbc,0x60,0x49,0x00,0xd0,0x49,0x01,0xd0,
+0x4e,0xbe,0x30,0x49,0x0a,0x40,0x49,0x02,0xb0,0x49,0x00,0xb2,0x02,0xa0,0x02,0x00,
+0x6c,0xa0,0x67,0x00,0x66,0x02,0x00,0x0f,0x23,0x00,0x02,0x20,0x00,0x50,0x2c,0x02,
+0x00,0xfd,0x03,0xff,0x03,0x06,0xca,0x67,0x06,0x60,0x66,0x06,0x60,0x23,0x07,0x40,
+0x10,0x00,0x04,0x15,0x00,0x01,0xd4,0x32,0x00,0x03,0x28,0x28,0x90,0x55,0x00,0xfe,
+0x1f,0x00,0x06,0x00,0x06,0x50,0x0a,0xbc,0x35,0x80,0x1d,0x4b,0x10,0x00,0x5d,0xb2,
+0x00,0x04,0xc8,0x60,0x0d,0x0a,0xbc,0x50,0x00,0x76,0x00,0x03,0x00,0x1b,0xb9,0x05,
+0x80,0x60,0x08,0xb7,0x04,0x30,0xb2,0x1b,0xba,0x00,0x00,0x51,0x00,0x48,0x90,0x29,
+0x00,0x59,0x04,0xb2,0x00,0x30,0x20,0x29,0x00,0x0c,0x24,0x00,0x68,0xcc,0x50,0x06,
+0x60,0x00,0x57,0x4d,0x00,0xce,0xca,0x00,0x09,0x30,0x00,0x93,0x00,0x03,0x25,0x00,
+0x0c,0x50,0x52,0x00,0x2c,0x07,0x86,0x7b,0x00,0x6c,0x8b,0xeb,0xb1,0x00,0xb1,0x00,
+0x03,0x00,0xff,0x07,0x75,0x00,0x00,0x66,0x00,0x1b,0x0a,0xe6,0x1b,0x01,0xb0,0x1b,
+0x00,0xc7,0x03,0x90,0x39,0x03,0x15,0x00,0x00,0xc5,0x2d,0x00,0x04,0x90,0x32,0x00,
+0x92,0x1b,0x20,0xae,0x60,0x1b,0x00,0x02,0x00,0x22,0x0c,0x70,0x25,0x00,0x38,0x07,
+0xeb,0x10,0x25,0x00,0xf7,0x03,0x01,0xb0,0x0a,0xe6,0x0b,0xe8,0x01,0xb0,0x01,0xb0,
+0x00,0xc7,0x03,0x99,0x30,0x67,0x00,0x94,0x03,0x00,0xf1,0x02,0x93,0x3a,0x00,0xc1,
+0x08,0xbc,0x60,0x00,0x00,0x00,0x9a,0x90,0x00,0x00,0x06,0x60,0x75,0xb5,0x02,0x8f,
+0x57,0x08,0x51,0xcb,0xc5,0x05,0xaa,0x40,0x2c,0x00,0x02,0x10,0x0a,0x75,0x02,0x03,
+0xdc,0x02,0xcf,0x55,0x70,0x85,0x1c,0xbc,0x50,0x02,0x23,0x10,0x01,0x98,0x00,0x2d,
+0x00,0x02,0x00,0x75,0x02,0x19,0x30,0x2d,0x00,0x5f,0x00,0x65,0x00,0x00,0x65,0x2d,
+0x00,0x03,0x79,0x01,0x71,0x00,0x61,0x60,0x01,0x71,0x86,0x00,0x00,0x04,0x02,0x2f,
+0xa8,0x50,0x2f,0x00,0x02,0x4a,0x02,0xaa,0x20,0x32,0x5c,0x00,0x0d,0x27,0x00,0xaa,
+0xc2,0x08,0xbd,0x90,0x00,0x3a,0x00,0x00,0x2b,0x10,0x84,0x00,0xf0,0x31,0xa0,0x00,
+0x0c,0x30,0x00,0x03,0x30,0x00,0x00,0x1a,0x91,0x00,0xa3,0x07,0x80,0x2a,0x66,0x0b,
+0xb0,0x57,0x2a,0x0b,0xa0,0x93,0x0c,0x38,0x64,0xc0,0x0b,0x83,0x28,0xc0,0x08,0xd0,
+0x0d,0x90,0x04,0xb0,0x0a,0x50,0x00,0x5a,0x20,0x00,0x02,0x02,0x00,0xa1,0x1d,0x06,
+0x66,0x56,0xc2,0xa2,0x29,0xa4,0x7b,0x00,0xba,0x0c,0x90,0x09,0x60,0xa4,0x37,0x02,
+0xf3,0x02,0x04,0x89,0x00,0xb4,0x00,0xd1,0x3c,0x06,0x90,0x0a,0x4d,0x10,0x02,0xf8,
+0x00,0x00,0xc2,0x70,0x01,0xff,0x0b,0x07,0xa1,0x00,0x20,0x10,0xb2,0x0d,0x06,0x72,
+0xa0,0x1c,0x75,0x00,0xbd,0x00,0x05,0xa0,0x00,0x65,0x00,0x7b,0x00,0x00,0x08,0x29,
+0x10,0x2f,0x00,0x02,0x02,0x28,0x03,0x80,0x6b,0xbc,0xd0,0x00,0x09,0x50,0x00,0x3b,
+0x18,0x00,0xff,0x0e,0x07,0x70,0x00,0x2c,0x00,0x00,0x9d,0xbb,0xb0,0x00,0xa3,0x00,
+0x02,0x00,0x6b,0xbf,0x00,0x09,0x60,0x04,0xa0,0x01,0xc1,0x00,0x8d,0xbb,0x10,0x00,
+0x91,0x2a,0x00,0x03,0x4a,0x01,0x90,0x00,0x00,0x2a,0x00,0x20,0x03,0x25,0x36,0x02,
+0x0f,0x2d,0x00,0x02,0x2c,0x08,0x83,0x57,0x00,0x60,0x0a,0x84,0x90,0x48,0x04,0x80,
+0x03,0x00,0xf0,0x00,0x00,0x3e,0x33,0xe3,0x66,0x10,0x00,0x49,0x91,0x16,0xa7,0x05,
+0x40,0x00,0x6a,0xeb,0x01,0xf0,0x07,0x00,0x15,0xaa,0x00,0x02,0x7c,0xff,0xfe,0x00,
+0x0e,0xff,0xfe,0xbe,0x00,0x0e,0xd8,0x30,0x3e,0x00,0x0e,0x30,0x00,0x05,0x00,0xf1,
+0x01,0x01,0x6e,0x00,0x1e,0x30,0x4f,0xfe,0x0d,0xff,0x30,0x2d,0xf8,0x0d,0xfd,0x10,
+0x00,0xb0,0x03,0xf0,0x32,0x00,0x75,0xcc,0xcc,0xc6,0x7c,0x8a,0x11,0x18,0xab,0xca,
+0x90,0x00,0x7b,0xc9,0x4f,0xcc,0xce,0x79,0xdb,0xa0,0x00,0x7c,0xda,0x59,0x00,0x07,
+0x7a,0xb9,0xfd,0xdd,0xea,0xb0,0x34,0x23,0x44,0x44,0x3f,0xf9,0xcf,0xff,0xff,0xef,
+0x8b,0xff,0xff,0xe7,0x84,0x68,0x88,0x87,0xff,0xad,0xff,0xff,0xf8,0x94,0x69,0x99,
+0x98,0xde,0x8a,0xee,0xee,0xdf,0x1b,0x00,0xf3,0x80,0x45,0x23,0x55,0x55,0x40,0x00,
+0x00,0x00,0x07,0x50,0x00,0x00,0x07,0xfd,0x23,0x00,0x07,0xfe,0x2d,0xf4,0x07,0xfe,
+0x20,0x5f,0xfa,0xfe,0x20,0x00,0x5f,0xfe,0x20,0x00,0x00,0x4d,0x20,0x00,0x00,0x21,
+0x00,0x02,0x0e,0xe2,0x0c,0xf1,0x5f,0xec,0xf8,0x00,0x6f,0xf9,0x00,0x0c,0xff,0xe2,
+0x0c,0xf8,0x5f,0xe0,0x98,0x00,0x5b,0x00,0x00,0x02,0xd2,0x00,0x00,0x7b,0x3f,0x3b,
+0x70,0x4f,0x73,0xf3,0x8f,0x4a,0xc0,0x3f,0x30,0xca,0xd9,0x03,0xf3,0x09,0xdb,0xb0,
+0x02,0x00,0xbc,0x6f,0x40,0x00,0x4f,0x60,0xbf,0xa7,0xaf,0xb0,0x00,0x7d,0xfd,0x70,
+0x00,0x00,0x06,0xb6,0x00,0x00,0x31,0xcf,0xc1,0x30,0x4f,0xff,0xff,0xff,0x47,0xff,
+0xb4,0xbf,0xf7,0x0d,0xf2,0x02,0xfd,0x04,0xff,0x70,0x7f,0xf4,0x6f,0xff,0xff,0xff,
+0x60,0x75,0xef,0xe5,0x70,0x00,0x08,0xf8,0x00,0x01,0x00,0x00,0xf9,0x05,0xf0,0x20,
+0x00,0x2d,0xe3,0xd9,0x00,0x00,0x4e,0x97,0xff,0x90,0x00,0x6f,0x7b,0xc6,0xfb,0x00,
+0x9e,0x6d,0xff,0xe6,0xdb,0x07,0x4e,0xff,0xff,0xf5,0x80,0x05,0xff,0xa9,0xff,0x70,
+0x00,0x5f,0xf3,0x1f,0xf7,0x00,0x03,0xcc,0x20,0xcc,0x50,0x00,0x00,0x00,0x9c,0xc5,
+0x00,0x23,0xdf,0x60,0x05,0x00,0xf0,0x47,0x58,0xef,0xb7,0x10,0x00,0x4f,0xff,0xfc,
+0x00,0x00,0x04,0xff,0xc0,0x00,0x19,0xa9,0x7c,0x6a,0xa6,0x3f,0xff,0xfc,0xfe,0xec,
+0x2f,0xff,0xff,0xfc,0xbb,0x01,0xdf,0xff,0xfe,0x20,0x00,0xba,0x22,0x22,0x8c,0x00,
+0x5f,0x10,0x00,0x00,0xe7,0x0e,0xb6,0x30,0x02,0x6a,0xf0,0xff,0xfe,0x44,0xdf,0xff,
+0x2f,0xff,0xff,0xff,0xff,0xf2,0xcf,0xff,0xff,0xff,0xfe,0x00,0x00,0x5b,0xda,0x43,
+0xd0,0x9f,0xa7,0xaf,0xbf,0x5f,0x40,0x04,0x7f,0xf9,0x90,0x00,0xde,0xee,0x99,0x00,
+0xf0,0x01,0x0f,0xff,0xe0,0x00,0x9a,0xff,0x74,0x00,0x3f,0x5f,0xdf,0x85,0x8f,0xa0,
+0xf3,0x6c,0xdc,0x00,0xf0,0x03,0x05,0x50,0x15,0xf8,0xff,0xff,0x8f,0xff,0xf8,0xff,
+0xff,0x84,0x59,0xf8,0x00,0x09,0x70,0x00,0x14,0x00,0xf2,0x03,0x00,0x05,0xf8,0x00,
 0xff,0xff,0x86,0x3f,0xff,0xf8,0x3a,0xff,0xff,0x88,0x64,0x5a,0xf8,0x00,0x1a,0x00,
-0x00,0x01,0x00,0x00,0x39,0x0f,0xf0,0x17,0x00,0x55,0x01,0x4d,0x10,0x01,0x5f,0x80,
+0x00,0x01,0x00,0xf0,0x3b,0x06,0x10,0x00,0x00,0x55,0x01,0x4d,0x10,0x01,0x5f,0x80,
 0x89,0x59,0x0f,0xff,0xf8,0x73,0xb3,0xd0,0xff,0xff,0x83,0xa7,0x6c,0x1f,0xff,0xf8,
-0x86,0x94,0xd0,0x45,0x9f,0x80,0x5c,0x4b,0x00,0x00,0x97,0x03,0x2d,0x30,0xd2,0x13,
-0xf0,0x0e,0x40,0x00,0xbf,0xff,0xff,0xff,0xbf,0x45,0xff,0xff,0xff,0xf1,0x2f,0xfd,
+0x86,0x94,0xd0,0x45,0x9f,0x80,0x5c,0x4b,0x00,0x00,0x97,0x03,0x2d,0x30,0x00,0x00,
+0x00,0x08,0x40,0x00,0xbf,0xff,0xff,0xff,0xbf,0x45,0xff,0xff,0xff,0xf1,0x2f,0xfd,
 0x9f,0xff,0xec,0xfd,0x10,0x8f,0xfa,0x07,0x10,0x02,0xff,0x32,0x22,0x22,0x3f,0xac,
 0x00,0xf2,0x12,0xc0,0x00,0x58,0x00,0x00,0x0d,0xf1,0x00,0x05,0xff,0x80,0x01,0xef,
 0xff,0x20,0x9f,0xff,0xfc,0x0e,0xef,0xff,0xf1,0xe6,0xff,0xff,0x19,0xc6,0xdf,0xc0,
@@ -426,138 +507,85 @@ static const uint8_t lz4FontData[] ={
 0xff,0xde,0xbf,0xf8,0x5e,0xbf,0x70,0x5e,0x76,0x3e,0x03,0x10,0x54,0x3c,0x01,0xe0,
 0xff,0x40,0x00,0x00,0x4f,0xff,0xf3,0x00,0x03,0xff,0xff,0xfe,0x20,0x0e,0xe2,0x00,
 0xf0,0x06,0x05,0x88,0x88,0x88,0x40,0x0d,0xee,0xee,0xee,0xb0,0x0f,0xff,0xff,0xff,
-0xd0,0x04,0x55,0x55,0x55,0x30,0x00,0xb7,0x02,0xf1,0x04,0xe0,0x00,0x7f,0x70,0x07,
-0xf7,0x00,0x5f,0x90,0x00,0x1c,0xe3,0x00,0x01,0xce,0x30,0x00,0x1c,0xe0,0xb3,0x10,
-0x34,0x00,0x5e,0x20,0x12,0x00,0x14,0x1e,0x24,0x00,0x33,0x70,0x00,0x15,0x5b,0x02,
-0x60,0x0d,0xb0,0x00,0x00,0x0e,0xc0,0x04,0x00,0x00,0x17,0x15,0x54,0xfc,0x8a,0xaf,
-0xea,0xa7,0x10,0x00,0x04,0xa5,0x01,0x01,0x18,0x00,0xf2,0x1c,0xaa,0xaa,0xa7,0x00,
-0x29,0xcc,0x93,0x00,0x00,0x7f,0x92,0x28,0xf8,0x00,0x6f,0xc0,0x4f,0x4a,0xf8,0x0e,
-0xf9,0x6e,0xfb,0x7f,0xf1,0x7f,0xb5,0xff,0x69,0xf9,0x00,0x9f,0x72,0x35,0xfb,0x00,
-0x00,0x5b,0xed,0xc5,0x00,0x00,0x0c,0x40,0x15,0x40,0x5f,0x86,0xbc,0xb6,0xbb,0x02,
-0xf2,0x15,0xf6,0x13,0xdd,0x20,0x00,0x05,0x1b,0xde,0xb3,0xfe,0x10,0x06,0xf9,0x07,
-0xff,0x3f,0xf8,0x00,0x1e,0xf3,0x04,0xea,0xff,0x20,0x00,0x3e,0xd1,0x02,0xcf,0x60,
-0x00,0x00,0x18,0xdd,0x60,0x9e,0x57,0x01,0x24,0x6e,0x10,0xf4,0x02,0x20,0x09,0xb0,
-0x06,0x00,0x30,0x4f,0xf6,0x00,0xc5,0x02,0x10,0xfe,0x26,0x02,0xf0,0x0e,0xf6,0x4f,
-0x80,0x00,0x00,0x0e,0xf5,0x3f,0xf2,0x00,0x00,0x8f,0xf6,0x4f,0xfa,0x00,0x02,0xff,
-0xfa,0x9f,0xff,0x30,0x0b,0xff,0xf7,0x5f,0xff,0xc0,0x0e,0xab,0x02,0x70,0xf0,0x00,
-0x22,0x22,0x22,0x22,0x10,0x10,0x27,0xf2,0x12,0x02,0x31,0x00,0x16,0xf3,0xff,0xd1,
-0x2e,0xff,0xd3,0x4e,0x5d,0xd6,0xf3,0x00,0x1d,0xe1,0x03,0x00,0x0c,0xe5,0xa3,0xd1,
-0xff,0xf3,0x4f,0xff,0xd6,0x73,0x00,0x39,0xf6,0x00,0x1c,0x09,0xf0,0x03,0x50,0x00,
-0x00,0x6f,0xf5,0x00,0x06,0xf8,0xaf,0x50,0x6f,0x80,0x0a,0xf4,0x98,0x00,0x00,0xa8,
-0x26,0x06,0xf3,0x00,0x9f,0x50,0x06,0xf7,0x0a,0xf5,0x6f,0x80,0x00,0xaf,0xf8,0x00,
-0x00,0x0a,0x80,0x91,0x00,0xf2,0x06,0x05,0xd2,0x02,0x22,0x21,0x00,0x4f,0xfe,0x3e,
-0xff,0xfe,0x00,0xa9,0xea,0x60,0x00,0x3e,0x00,0x03,0xe0,0x00,0x06,0x00,0x90,0x0a,
-0x9e,0xa5,0x03,0xfe,0xee,0xa5,0xff,0xe1,0xe0,0x15,0x13,0x6e,0x03,0x15,0xad,0x8c,
-0xcb,0x10,0x00,0x0f,0xff,0xfd,0xaa,0xa6,0xff,0x01,0x00,0x02,0xa7,0x02,0xf2,0x08,
-0x01,0xa1,0x00,0x00,0x00,0x1d,0xfd,0x10,0x00,0x01,0xdf,0xff,0xd1,0x00,0x03,0x9d,
-0xfd,0x93,0x00,0x00,0x0a,0xfa,0x00,0x05,0x00,0xf0,0x00,0x89,0x88,0xf8,0x89,0x91,
-0xff,0xfc,0xbc,0xee,0xf2,0xff,0xff,0xff,0xac,0xf2,0x11,0x01,0xb0,0xb7,0x00,0x00,
-0x00,0x2f,0xff,0x00,0x00,0x00,0x6f,0xfd,0x0f,0x00,0xf3,0x09,0xf9,0x00,0x00,0x00,
-0x0c,0xf3,0x00,0x14,0x00,0x9f,0x90,0x09,0xff,0x6b,0xfc,0x00,0x0d,0xff,0xff,0xa0,
-0x00,0x0a,0xff,0xa3,0x0f,0x05,0xf8,0x25,0x03,0x10,0x00,0x00,0xaf,0xe1,0x05,0xe9,
-0xf5,0xe4,0x6f,0xe2,0x7f,0xfd,0xfe,0x20,0x00,0xcf,0xf3,0x00,0x4d,0xff,0xf9,0x00,
-0xe7,0xe5,0xaf,0x90,0xe8,0xe3,0x0b,0xf8,0x3b,0x70,0x00,0x63,0x00,0xaf,0xfa,0x91,
-0x22,0xcf,0xfa,0x89,0xfb,0xcf,0xfe,0xa9,0xfb,0xcf,0xff,0xfe,0x04,0x00,0xf0,0x00,
-0xfd,0x57,0x77,0x75,0xff,0xff,0xfa,0x00,0x12,0x22,0x20,0x00,0x02,0x22,0x22,0x02,
-0x02,0x82,0x90,0xf2,0x00,0x05,0xf8,0xf2,0x00,0x05,0xc0,0x02,0xf0,0x00,0xf5,0x6f,
-0xfe,0xff,0xd0,0x0f,0xfe,0xff,0xf8,0x9f,0xfe,0x9c,0xcc,0xcc,0xc8,0x22,0x02,0x40,
-0x45,0x55,0x55,0x54,0xfb,0x00,0x00,0xdc,0x02,0x80,0x34,0x44,0x44,0x43,0x23,0x33,
-0x33,0x32,0x0c,0x00,0x90,0x11,0x11,0x11,0x10,0x8c,0xcc,0xcc,0xcc,0x8e,0x39,0x00,
-0xd1,0x5c,0xff,0xff,0xfc,0x5f,0x88,0xff,0xf8,0x8f,0xff,0xc5,0xa6,0xcf,0x1d,0x03,
-0x01,0x0f,0x01,0xf0,0x0c,0x06,0xff,0xc0,0x00,0x9f,0xf9,0x00,0x0b,0xff,0x62,0x00,
-0xdf,0xff,0xf7,0x0f,0xff,0xfe,0x10,0x11,0xaf,0x60,0x00,0x0d,0xd0,0x00,0x01,0xf4,
-0x6d,0x16,0x00,0x01,0x00,0xf0,0x13,0x45,0xb9,0x52,0x00,0xff,0x8d,0xfa,0x00,0xff,
-0xd9,0x96,0x00,0xff,0x6e,0xe9,0x91,0xff,0x7f,0xfb,0x77,0xff,0x7f,0xff,0xed,0xff,
-0x7f,0xff,0xfe,0x45,0x4f,0xff,0xfe,0x00,0x2f,0xa9,0x04,0x03,0xbf,0x05,0xa0,0x8f,
-0xe7,0x00,0x08,0xff,0xff,0x60,0x0d,0xff,0xff,0x25,0x03,0xf1,0x01,0xd0,0x2f,0xff,
-0xff,0xf1,0xcf,0xff,0xff,0xfa,0x57,0x77,0x77,0x74,0x00,0x1e,0xd0,0x27,0x00,0x10,
-0xbf,0x9c,0x00,0xf4,0x0c,0x0f,0x4b,0x3a,0xa3,0xa3,0xf2,0xfa,0xd9,0xdd,0x9d,0x9f,
-0x2f,0xf0,0xa3,0x3a,0x0d,0xf2,0xfc,0xcb,0x9a,0xbc,0xcf,0x2f,0x4a,0x22,0x22,0xa2,
-0xfb,0x04,0x04,0x01,0x00,0xe0,0x3a,0xa0,0x00,0x00,0x04,0xbf,0xfd,0x00,0x00,0x5d,
-0xff,0xff,0x60,0x06,0x42,0x18,0x00,0x16,0x01,0x60,0xf7,0x00,0x01,0x33,0x3f,0xff,
-0x4b,0x03,0x10,0xff,0x2b,0x02,0x20,0x1f,0xf1,0x2b,0x00,0x14,0xe9,0x34,0x00,0xb2,
-0xde,0xed,0x63,0x0f,0xff,0xf8,0xf3,0xff,0xff,0x47,0x5f,0x49,0x04,0x19,0xcf,0x07,
-0x00,0xf0,0x0f,0xb1,0x22,0x22,0x20,0x00,0x00,0x24,0x31,0x00,0x00,0x02,0xaf,0xff,
-0xff,0xb4,0x00,0x7f,0xd7,0x31,0x25,0xbf,0xa0,0x98,0x01,0x57,0x62,0x05,0xc1,0x00,
-0x7f,0xd2,0x01,0x50,0x00,0xa9,0x10,0x07,0xc1,0x71,0x1d,0x01,0x53,0x03,0x10,0x6f,
-0xc9,0x0e,0x00,0x73,0x0d,0x42,0x00,0x12,0x22,0x22,0x96,0x01,0xa0,0xff,0xff,0x90,
-0xf4,0x88,0x88,0x88,0x77,0xf2,0xf7,0x03,0x03,0xfc,0x03,0xe3,0xf5,0xaa,0xaa,0xaa,
-0x97,0xf3,0xee,0xee,0xee,0xee,0xef,0xb0,0x13,0x33,0x33,0x33,0x33,0x2a,0x00,0x20,
-0x82,0x07,0x2a,0x00,0x20,0xf4,0x00,0x2a,0x00,0x2f,0xa2,0x07,0x2a,0x00,0x08,0x20,
-0x84,0x00,0x2a,0x00,0x20,0xf9,0x00,0x2a,0x00,0x2f,0xa6,0x00,0x2a,0x00,0x08,0x20,
-0x87,0x00,0x2a,0x00,0x20,0xfe,0x00,0x2a,0x00,0x2f,0xa9,0x00,0x2a,0x00,0x08,0x20,
-0xf2,0x00,0x2a,0x00,0x20,0xf2,0x00,0x2a,0x00,0x02,0x0c,0x00,0x01,0x2a,0x00,0x11,
-0xa0,0x2a,0x00,0x00,0xab,0x19,0x01,0xb1,0x17,0xf1,0x0b,0xa8,0xf5,0x00,0x00,0x48,
-0x05,0x50,0x00,0x03,0x00,0xff,0xcd,0xaa,0xaa,0xad,0xd1,0x8c,0x20,0x37,0x00,0x06,
-0x30,0x00,0x00,0x09,0x4d,0xfd,0x00,0x24,0x7f,0xc0,0x5c,0x01,0xf0,0x14,0x7b,0xca,
+0xd0,0x04,0x55,0x55,0x55,0x30,0x00,0xb7,0x02,0xf0,0x06,0xe0,0x00,0x7f,0x70,0x07,
+0xf7,0x00,0x5f,0x90,0x00,0x1c,0xe3,0x00,0x01,0xce,0x30,0x00,0x1c,0xe0,0x00,0x01,
+0x11,0x02,0x24,0x5e,0x20,0x12,0x00,0x14,0x1e,0x24,0x00,0x33,0x70,0x00,0x15,0x5b,
+0x02,0x61,0x0d,0xb0,0x00,0x00,0x0e,0xc0,0x04,0x00,0x84,0xef,0xff,0xff,0xfc,0x8a,
+0xaf,0xea,0xa7,0x10,0x00,0x04,0xa5,0x01,0x01,0x18,0x00,0xf1,0x1d,0xaa,0xaa,0xa7,
+0x00,0x29,0xcc,0x93,0x00,0x00,0x7f,0x92,0x28,0xf8,0x00,0x6f,0xc0,0x4f,0x4a,0xf8,
+0x0e,0xf9,0x6e,0xfb,0x7f,0xf1,0x7f,0xb5,0xff,0x69,0xf9,0x00,0x9f,0x72,0x35,0xfb,
+0x00,0x00,0x5b,0xed,0xc5,0x00,0x00,0x0c,0x50,0x36,0x00,0x40,0x5f,0x86,0xbc,0xb6,
+0xbb,0x02,0xf2,0x15,0xf6,0x13,0xdd,0x20,0x00,0x05,0x1b,0xde,0xb3,0xfe,0x10,0x06,
+0xf9,0x07,0xff,0x3f,0xf8,0x00,0x1e,0xf3,0x04,0xea,0xff,0x20,0x00,0x3e,0xd1,0x02,
+0xcf,0x60,0x00,0x00,0x18,0xdd,0x60,0x9e,0x57,0x01,0x24,0x6e,0x10,0xf4,0x02,0x20,
+0x09,0xb0,0x06,0x00,0x30,0x4f,0xf6,0x00,0xc5,0x02,0x10,0xfe,0x26,0x02,0xf0,0x0e,
+0xf6,0x4f,0x80,0x00,0x00,0x0e,0xf5,0x3f,0xf2,0x00,0x00,0x8f,0xf6,0x4f,0xfa,0x00,
+0x02,0xff,0xfa,0x9f,0xff,0x30,0x0b,0xff,0xf7,0x5f,0xff,0xc0,0x0e,0xab,0x02,0x60,
+0xf0,0x00,0x22,0x22,0x22,0x22,0x42,0x00,0xf2,0x13,0x02,0x02,0x31,0x00,0x16,0xf3,
+0xff,0xd1,0x2e,0xff,0xd3,0x4e,0x5d,0xd6,0xf3,0x00,0x1d,0xe1,0x03,0x00,0x0c,0xe5,
+0xa3,0xd1,0xff,0xf3,0x4f,0xff,0xd6,0x73,0x00,0x39,0xf6,0x00,0x1c,0x09,0xf0,0x03,
+0x50,0x00,0x00,0x6f,0xf5,0x00,0x06,0xf8,0xaf,0x50,0x6f,0x80,0x0a,0xf4,0x98,0x00,
+0x00,0xa8,0x26,0x06,0xf3,0x00,0x9f,0x50,0x06,0xf7,0x0a,0xf5,0x6f,0x80,0x00,0xaf,
+0xf8,0x00,0x00,0x0a,0x80,0x91,0x00,0xf2,0x06,0x05,0xd2,0x02,0x22,0x21,0x00,0x4f,
+0xfe,0x3e,0xff,0xfe,0x00,0xa9,0xea,0x60,0x00,0x3e,0x00,0x03,0xe0,0x00,0x06,0x00,
+0xf2,0x00,0x0a,0x9e,0xa5,0x03,0xfe,0xee,0xa5,0xff,0xe1,0x00,0x33,0x33,0x20,0x6e,
+0x20,0x30,0x00,0xad,0x8c,0xcb,0x10,0x00,0x0f,0xff,0xfd,0xaa,0xa6,0xff,0x01,0x00,
+0x02,0xa7,0x02,0xf2,0x08,0x01,0xa1,0x00,0x00,0x00,0x1d,0xfd,0x10,0x00,0x01,0xdf,
+0xff,0xd1,0x00,0x03,0x9d,0xfd,0x93,0x00,0x00,0x0a,0xfa,0x00,0x05,0x00,0xf0,0x00,
+0x89,0x88,0xf8,0x89,0x91,0xff,0xfc,0xbc,0xee,0xf2,0xff,0xff,0xff,0xac,0xf2,0x11,
+0x01,0xb0,0xb7,0x00,0x00,0x00,0x2f,0xff,0x00,0x00,0x00,0x6f,0xfd,0x0f,0x00,0xf3,
+0x09,0xf9,0x00,0x00,0x00,0x0c,0xf3,0x00,0x14,0x00,0x9f,0x90,0x09,0xff,0x6b,0xfc,
+0x00,0x0d,0xff,0xff,0xa0,0x00,0x0a,0xff,0xa3,0x0f,0x05,0xf8,0x25,0x03,0x10,0x00,
+0x00,0xaf,0xe1,0x05,0xe9,0xf5,0xe4,0x6f,0xe2,0x7f,0xfd,0xfe,0x20,0x00,0xcf,0xf3,
+0x00,0x4d,0xff,0xf9,0x00,0xe7,0xe5,0xaf,0x90,0xe8,0xe3,0x0b,0xf8,0x3b,0x70,0x00,
+0x63,0x00,0xaf,0xfa,0x91,0x22,0xcf,0xfa,0x89,0xfb,0xcf,0xfe,0xa9,0xfb,0xcf,0xff,
+0xfe,0x04,0x00,0xf0,0x00,0xfd,0x57,0x77,0x75,0xff,0xff,0xfa,0x00,0x12,0x22,0x20,
+0x00,0x02,0x22,0x22,0x02,0x02,0x82,0x90,0xf2,0x00,0x05,0xf8,0xf2,0x00,0x05,0xc0,
+0x02,0xf0,0x00,0xf5,0x6f,0xfe,0xff,0xd0,0x0f,0xfe,0xff,0xf8,0x9f,0xfe,0x9c,0xcc,
+0xcc,0xc8,0x22,0x02,0x40,0x45,0x55,0x55,0x54,0xfb,0x00,0x00,0xdc,0x02,0x80,0x34,
+0x44,0x44,0x43,0x23,0x33,0x33,0x32,0x0c,0x00,0x90,0x11,0x11,0x11,0x10,0x8c,0xcc,
+0xcc,0xcc,0x8e,0x39,0x00,0xd1,0x5c,0xff,0xff,0xfc,0x5f,0x88,0xff,0xf8,0x8f,0xff,
+0xc5,0xa6,0xcf,0x1d,0x03,0x01,0x0f,0x01,0xf1,0x0f,0x06,0xff,0xc0,0x00,0x9f,0xf9,
+0x00,0x0b,0xff,0x62,0x00,0xdf,0xff,0xf7,0x0f,0xff,0xfe,0x10,0x11,0xaf,0x60,0x00,
+0x0d,0xd0,0x00,0x01,0xf4,0x00,0x00,0x3a,0x52,0x01,0xf0,0x13,0x45,0xb9,0x52,0x00,
+0xff,0x8d,0xfa,0x00,0xff,0xd9,0x96,0x00,0xff,0x6e,0xe9,0x91,0xff,0x7f,0xfb,0x77,
+0xff,0x7f,0xff,0xed,0xff,0x7f,0xff,0xfe,0x45,0x4f,0xff,0xfe,0x00,0x2f,0xa9,0x04,
+0x03,0xbf,0x05,0xa0,0x8f,0xe7,0x00,0x08,0xff,0xff,0x60,0x0d,0xff,0xff,0x25,0x03,
+0xf1,0x01,0xd0,0x2f,0xff,0xff,0xf1,0xcf,0xff,0xff,0xfa,0x57,0x77,0x77,0x74,0x00,
+0x1e,0xd0,0x27,0x00,0x10,0xbf,0x9c,0x00,0xf4,0x0c,0x0f,0x4b,0x3a,0xa3,0xa3,0xf2,
+0xfa,0xd9,0xdd,0x9d,0x9f,0x2f,0xf0,0xa3,0x3a,0x0d,0xf2,0xfc,0xcb,0x9a,0xbc,0xcf,
+0x2f,0x4a,0x22,0x22,0xa2,0xfb,0x04,0x04,0x01,0x00,0xf0,0x03,0x3a,0xa0,0x00,0x00,
+0x04,0xbf,0xfd,0x00,0x00,0x5d,0xff,0xff,0x60,0x06,0xef,0xff,0xff,0xe0,0x16,0x01,
+0x60,0xf7,0x00,0x01,0x33,0x3f,0xff,0x4b,0x03,0x10,0xff,0x2b,0x02,0x20,0x1f,0xf1,
+0x2b,0x00,0x14,0xe9,0x34,0x00,0xb2,0xde,0xed,0x63,0x0f,0xff,0xf8,0xf3,0xff,0xff,
+0x47,0x5f,0x49,0x04,0x19,0xcf,0x07,0x00,0xf0,0x0f,0xb1,0x22,0x22,0x20,0x00,0x00,
+0x24,0x31,0x00,0x00,0x02,0xaf,0xff,0xff,0xb4,0x00,0x7f,0xd7,0x31,0x25,0xbf,0xa0,
+0x98,0x01,0x57,0x62,0x05,0xc1,0x00,0x7f,0xd2,0x01,0x91,0x00,0xa9,0x10,0x07,0xc1,
+0x00,0x00,0x00,0x3c,0x53,0x03,0x10,0x6f,0xc9,0x0e,0x00,0x73,0x0d,0x42,0x00,0x12,
+0x22,0x22,0x96,0x01,0xa0,0xff,0xff,0x90,0xf4,0x88,0x88,0x88,0x77,0xf2,0xf7,0x03,
+0x03,0xfc,0x03,0xe3,0xf5,0xaa,0xaa,0xaa,0x97,0xf3,0xee,0xee,0xee,0xee,0xef,0xb0,
+0x13,0x33,0x33,0x33,0x33,0x2a,0x00,0x20,0x82,0x07,0x2a,0x00,0x20,0xf4,0x00,0x2a,
+0x00,0x2f,0xa2,0x07,0x2a,0x00,0x08,0x20,0x84,0x00,0x2a,0x00,0x20,0xf9,0x00,0x2a,
+0x00,0x2f,0xa6,0x00,0x2a,0x00,0x08,0x20,0x87,0x00,0x2a,0x00,0x20,0xfe,0x00,0x2a,
+0x00,0x2f,0xa9,0x00,0x2a,0x00,0x08,0x20,0xf2,0x00,0x2a,0x00,0x20,0xf2,0x00,0x2a,
+0x00,0x02,0x0c,0x00,0x01,0x2a,0x00,0x70,0xa0,0x13,0x33,0x33,0x33,0x33,0x00,0xf0,
+0x14,0x00,0x00,0x04,0xb3,0x00,0x00,0x00,0x00,0xa8,0xf5,0x00,0x00,0x48,0x05,0x50,
+0x00,0x03,0x00,0xff,0xcd,0xaa,0xaa,0xad,0xd1,0x8c,0x20,0x37,0x00,0x06,0x30,0x00,
+0x00,0x09,0x4d,0xa0,0x1f,0x00,0x33,0x7f,0xc0,0x00,0x01,0x00,0xf6,0x2b,0x7b,0xca,
 0x20,0x08,0xfe,0x6f,0xd0,0x0f,0xde,0x27,0xf4,0x2f,0x96,0x45,0xf6,0x3f,0xf7,0x1f,
 0xf7,0x3f,0xd3,0x28,0xf7,0x1f,0x8d,0x54,0xf5,0x0b,0xff,0x2e,0xf1,0x01,0xcf,0xee,
-0x50,0x0c,0x03,0xf6,0x04,0x56,0x9e,0xd8,0x64,0x9a,0xaa,0xaa,0xa8,0x5d,0xdd,0xdd,
-0xd4,0x7f,0xac,0xda,0xf5,0x7f,0x7a,0xc7,0x04,0x00,0x82,0x8a,0xc7,0xf5,0x4f,0xff,
-0xff,0xf3,0x01,0x38,0x04,0x20,0x08,0xa0,0x74,0x04,0xf2,0x05,0xfb,0x00,0x00,0x09,
-0xc7,0xfc,0x00,0x00,0x9f,0xfc,0x61,0x00,0x09,0xff,0xfc,0x10,0x00,0x9f,0xff,0xc1,
-0x09,0x00,0x70,0x0d,0xff,0xc1,0x00,0x00,0x0f,0xfc,0xd2,0x1e,0x01,0x82,0x00,0xfc,
-0x25,0x2b,0xcc,0xcc,0xcc,0xa0,0x03,0xef,0xfd,0xfe,0xef,0xf3,0x3e,0xff,0xe0,0x82,
-0x7f,0xf4,0xef,0xff,0xfb,0x03,0xff,0xf4,0x6f,0xff,0xf2,0x40,0x9f,0xf4,0x06,0xff,
-0xf9,0xfc,0xbf,0xf3,0x00,0x5f,0xff,0xff,0xff,0xe1,0x03,0xef,0xff,0x63,0xe5,0x7a,
-0x7b,0xff,0x36,0x96,0xcf,0x07,0x02,0x85,0xfb,0xcf,0xff,0xff,0x80,0x12,0x22,0x10,
-0xed,0x07,0xb0,0xc0,0x04,0xc0,0x00,0x05,0xf0,0x5f,0xe7,0x77,0x7a,0xf0,0x81,0x02,
-0x31,0xe0,0x0c,0xd0,0xfa,0x2c,0x1b,0x00,0x01,0x00,0x2f,0xfd,0x00,0x01,0x00,0x06,
-0x1b,0xf8,0x08,0x00,0x00,0x01,0x00,0x84,0xfc,0xfc,0x00,0xff,0xfc,0x00,0xfa,0x00,
-0xbb,0x00,0x0d,0x01,0x00,0x4e,0x01,0x01,0x00,0x02,0x19,0x00,0x01,0xc8,0x1b,0x0f,
-0x01,0x00,0x18,0x1f,0xf0,0x21,0x00,0x0d,0x13,0xf8,0x8f,0x00,0xa2,0x00,0xff,0x00,
-0x00,0xf7,0xff,0xfa,0xfb,0x00,0xf9,0x11,0x00,0x10,0xff,0x37,0x04,0x2f,0xfc,0xfe,
-0x9e,0x00,0x01,0x30,0xfe,0x00,0xfe,0x31,0x00,0x0f,0x01,0x00,0x03,0x1c,0xfe,0x0a,
-0x00,0x19,0xff,0x1f,0x00,0x06,0x0e,0x00,0x13,0xf9,0x0e,0x00,0x10,0xfe,0x02,0x00,
-0x2e,0xfd,0xfe,0x47,0x00,0x0b,0x0f,0x01,0x05,0x42,0x00,0x11,0xff,0x37,0x00,0x3c,
-0xff,0xfe,0xfe,0xe8,0x00,0x35,0xf4,0x00,0xed,0x27,0x00,0x40,0xfe,0xff,0x00,0x00,
-0x2c,0x04,0x2e,0xfe,0xfe,0x59,0x01,0x03,0x5f,0x00,0x1e,0x01,0x1b,0x00,0x0e,0x82,
-0x00,0x0f,0x01,0x00,0x0b,0x1b,0xfc,0x28,0x00,0x12,0xfe,0x70,0x00,0x25,0xfe,0xfd,
-0x1e,0x01,0x14,0xe8,0x75,0x00,0x97,0xfb,0x00,0x00,0xed,0xfc,0xf4,0xf6,0x00,0xef,
-0x32,0x02,0x28,0xf7,0xfa,0x4d,0x00,0x00,0xa4,0x04,0x35,0xf6,0x00,0xf2,0x63,0x01,
-0x21,0xff,0xff,0x21,0x01,0x12,0x01,0xd4,0x00,0x1e,0xf9,0x70,0x02,0x2f,0xfe,0xff,
-0xa5,0x00,0x10,0x3e,0xfa,0x00,0xff,0x9c,0x02,0x06,0xb1,0x02,0xb1,0xf1,0xf0,0x00,
-0x00,0xfa,0xfe,0xef,0xff,0x01,0x00,0x01,0x69,0x00,0xf2,0x02,0xf8,0xf9,0x00,0xf8,
-0xf9,0xfb,0xf8,0x00,0xf9,0xfb,0xfc,0xfb,0xfc,0x00,0xf3,0xf8,0xf9,0x32,0x01,0x66,
-0xf0,0xfd,0x00,0x00,0xfb,0xff,0x43,0x01,0x50,0xfd,0xfd,0x00,0x00,0xfd,0x5f,0x01,
-0x01,0x69,0x05,0x05,0x59,0x01,0x22,0xf7,0xfc,0x57,0x00,0x13,0x01,0x11,0x00,0x23,
-0xfe,0xfe,0x8a,0x01,0x1a,0x00,0xe8,0x02,0x14,0xfd,0x38,0x01,0x15,0x01,0x6c,0x01,
-0x02,0xd4,0x01,0x07,0x4b,0x01,0xe0,0x01,0xfd,0xf1,0xfc,0x00,0x00,0xf9,0xfe,0xf9,
-0xff,0x01,0xf9,0x01,0x01,0x9e,0x00,0xf6,0x03,0xfb,0xfb,0xfe,0xfd,0xfb,0xfd,0xfc,
-0xfe,0xfd,0xff,0x00,0xfe,0xfe,0x01,0xf9,0xfc,0xfc,0xfd,0x91,0x00,0x1a,0xfe,0x64,
-0x02,0x0e,0x22,0x02,0x0a,0x1c,0x00,0x0f,0x01,0x00,0x03,0x1f,0xfb,0x49,0x01,0x09,
-0x1f,0xff,0x1a,0x02,0x13,0x11,0xff,0xb8,0x01,0x0e,0xf9,0x02,0x0f,0x58,0x00,0x10,
-0x0f,0x1d,0x00,0x0a,0x1e,0x01,0x8a,0x03,0x19,0x01,0x8a,0x00,0x15,0x01,0x56,0x03,
-0x0f,0x01,0x00,0x25,0x0e,0x8a,0x00,0x1f,0xf6,0xea,0x00,0x13,0x00,0x7b,0x00,0x1c,
-0xf7,0x5e,0x02,0x20,0xff,0x01,0x51,0x00,0x10,0x04,0x58,0x02,0x0f,0x78,0x00,0x1b,
-0x1b,0x01,0x2a,0x05,0x02,0xf5,0x03,0x1f,0x01,0x29,0x01,0x01,0x1f,0xf7,0xea,0x00,
-0x27,0x1f,0xff,0x27,0x00,0x2c,0x0f,0x43,0x00,0x0a,0x03,0xbb,0x05,0x30,0x02,0x03,
-0x00,0x02,0x01,0x2d,0x04,0x05,0x21,0x00,0xf1,0x0c,0x06,0x07,0x08,0x09,0x0a,0x0b,
-0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,
-0x15,0x16,0x17,0x18,0x19,0x20,0x00,0x80,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,
-0xf5,0x16,0xff,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,
-0x24,0x27,0x28,0x73,0x00,0x04,0x11,0x06,0x01,0x00,0xe0,0x00,0x08,0x0a,0x0a,0x0a,
-0x0a,0x0c,0x0c,0x0c,0x0c,0x09,0x0c,0x09,0x09,0x15,0x29,0x91,0x00,0x0d,0x0d,0x0d,
-0x0d,0x17,0x00,0x00,0x1a,0x01,0x00,0x61,0x00,0x1c,0x1d,0x1d,0x1d,0x1d,0x31,0x00,
-0x20,0x1f,0x21,0x01,0x00,0x02,0x3d,0x00,0x50,0x24,0x1b,0x24,0x06,0x1a,0x02,0x00,
-0x22,0x08,0x1c,0x02,0x00,0x64,0x09,0x00,0x09,0x00,0x0a,0x1d,0x02,0x00,0x04,0x64,
-0x00,0x54,0x0c,0x1f,0x00,0x00,0x0c,0x02,0x00,0x00,0xa9,0x0c,0x53,0x00,0x0e,0x00,
-0x00,0x0f,0x02,0x00,0x00,0x1f,0x00,0x00,0x02,0x00,0x80,0x1f,0x00,0x00,0x09,0x21,
-0x09,0x21,0x09,0x5b,0x00,0x11,0x22,0x02,0x00,0x03,0x01,0x00,0x11,0x13,0x02,0x00,
-0x17,0x0d,0x02,0x00,0x70,0x15,0x00,0x17,0x24,0x17,0x18,0x27,0x02,0x00,0x0f,0xb7,
-0x02,0x28,0x07,0x72,0x01,0x20,0x03,0x02,0x6d,0x01,0x4a,0x06,0x07,0x06,0x08,0x1f,
-0x00,0x00,0xce,0x00,0x20,0x00,0x0b,0x74,0x18,0x00,0xc1,0x00,0x01,0x08,0x00,0xa0,
-0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x7b,0x0c,0x00,0xe4,0x22,0x52,
-0x17,0x17,0x17,0x18,0x17,0xa1,0x20,0xd0,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,
-0x1f,0x20,0x21,0x1f,0x22,0xf9,0x1a,0x0f,0x01,0x00,0x01,0x11,0x0a,0x01,0x00,0x26,
-0x24,0x0b,0x12,0x00,0x10,0x0b,0x01,0x00,0xa1,0x00,0x0b,0x0f,0x0f,0x0f,0x0f,0x13,
-0x00,0x00,0x16,0x01,0x00,0x20,0x25,0x17,0x01,0x00,0x02,0x57,0x00,0x02,0x83,0x01,
-0xa0,0x26,0x1e,0x1e,0x1e,0x1e,0x1f,0x00,0x1f,0x0a,0x16,0x02,0x00,0x22,0x0b,0x17,
-0x02,0x00,0x10,0x00,0x24,0x00,0x14,0x17,0x02,0x00,0x05,0x16,0x00,0x0b,0x01,0x00,
-0x1b,0x0c,0x10,0x00,0x10,0x19,0x02,0x00,0x51,0x19,0x00,0x00,0x0b,0x1a,0x02,0x00,
-0x03,0x30,0x00,0x22,0x0d,0x1c,0x02,0x00,0x30,0x0e,0x00,0x0e,0x15,0x10,0x16,0x1e,
-0x02,0x00,0x70,0x11,0x00,0x13,0x1f,0x13,0x14,0x22,0x02,0x00,0x1f,0x00,0x74,0x01,
-0x26,0x50,0x00,0x00,0x00,0x00,0x00,
+0x50,0x00,0x00,0x10,0x00,0x56,0x9e,0xd8,0x64,0x9a,0xaa,0xaa,0xa8,0x5d,0xdd,0xdd,
+0xd4,0x7f,0xac,0xda,0xf5,0x7f,0x7a,0xc7,0x04,0x00,0xf0,0x00,0x8a,0xc7,0xf5,0x4f,
+0xff,0xff,0xf3,0x01,0x22,0x22,0x10,0x00,0x00,0x00,0x08,0x62,0x00,0xf2,0x06,0x4f,
+0xfb,0x00,0x00,0x09,0xc7,0xfc,0x00,0x00,0x9f,0xfc,0x61,0x00,0x09,0xff,0xfc,0x10,
+0x00,0x9f,0xff,0xc1,0x09,0x00,0xb1,0x0d,0xff,0xc1,0x00,0x00,0x0f,0xfc,0x10,0x00,
+0x00,0x01,0x82,0x00,0xf6,0x2b,0x2b,0xcc,0xcc,0xcc,0xa0,0x03,0xef,0xfd,0xfe,0xef,
+0xf3,0x3e,0xff,0xe0,0x82,0x7f,0xf4,0xef,0xff,0xfb,0x03,0xff,0xf4,0x6f,0xff,0xf2,
+0x40,0x9f,0xf4,0x06,0xff,0xf9,0xfc,0xbf,0xf3,0x00,0x5f,0xff,0xff,0xff,0xe1,0x03,
+0xef,0xff,0x63,0xe5,0x7a,0x7b,0xff,0x36,0x96,0xcf,0xff,0xff,0xfc,0xff,0xff,0xff,
+0x07,0x00,0x84,0xfb,0xcf,0xff,0xff,0x80,0x12,0x22,0x10,0xd6,0x00,0xf0,0x0c,0x01,
+0xc0,0x04,0xc0,0x00,0x05,0xf0,0x5f,0xe7,0x77,0x7a,0xf0,0xcf,0xff,0xff,0xff,0xe0,
+0x0c,0xd0,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -569,11 +597,17 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 8226, .range_length = 55425, .glyph_id_start = 308, .list_length = 62, .type = 3, .unicode_list = 2960, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[14164] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 3128, .size = 4083, .comp_size = 2879 },
+{ .bitmap_start = 4083, .comp_offset = 6007, .size = 4079, .comp_size = 3064 },
+{ .bitmap_start = 8162, .comp_offset = 9071, .size = 290, .comp_size = 267 },
+};
+
+static uint8_t etxUncompBuf[5712] __SDRAMFONTS;
 
 const etxLz4Font lv_font_en_XXS = {
-.uncomp_size = 13836,
-.comp_size = 8887,
+.uncomp_size = 5384,
+.comp_size = 3128,
 .line_height = 12,
 .base_line = 3,
 .subpx = 0,
@@ -586,12 +620,13 @@ const etxLz4Font lv_font_en_XXS = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 39,
-.glyph_bitmap = 3084,
-.class_pair_values = 11536,
-.left_class_mapping = 13096,
-.right_class_mapping = 13466,
+.class_pair_values = 3084,
+.left_class_mapping = 4644,
+.right_class_mapping = 5014,
+.block_num = 3,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 14164,
+.lvglFontBufSize = 5712,
 };
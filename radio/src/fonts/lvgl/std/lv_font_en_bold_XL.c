@@ -125,1086 +125,1592 @@ static const uint8_t lz4FontData[] ={
 0x17,0x18,0x18,0x00,0x00,0x92,0xd7,0x90,0x00,0x22,0xb4,0xd8,0xd0,0x03,0x21,0xb3,
 0xd9,0xb0,0x00,0x41,0x00,0xcb,0xda,0x60,0xc8,0x00,0x31,0xd0,0xdb,0x50,0x68,0x03,
 0x22,0x84,0xdc,0x10,0x00,0x22,0x89,0xdd,0x10,0x00,0x22,0x3d,0xde,0x10,0x00,0x22,
-0x42,0xdf,0x10,0x00,0xf0,0x00,0xf6,0xdf,0x50,0x08,0x0a,0x18,0x01,0x00,0x0f,0xff,
-0xfd,0x0e,0xff,0xfc,0x0d,0x03,0x00,0x20,0xfb,0x0c,0x03,0x00,0x20,0xfa,0x0b,0x03,
-0x00,0x20,0xf9,0x0a,0x03,0x00,0xb0,0xf8,0x09,0xff,0xf7,0x09,0xff,0xf7,0x08,0xff,
-0xf6,0x07,0x03,0x00,0x40,0xf5,0x03,0x99,0x93,0x2a,0x09,0xf0,0x0a,0x8a,0x70,0x0b,
-0xff,0xfa,0x0f,0xff,0xfe,0x0d,0xff,0xfc,0x03,0xcf,0xc2,0xff,0xf2,0x0e,0xff,0x3f,
-0xff,0x20,0xef,0xf3,0xff,0xf1,0x09,0x00,0xf0,0x0a,0x00,0xef,0xf1,0xff,0xe0,0x0e,
-0xff,0x0f,0xfd,0x00,0xef,0xe0,0xff,0xb0,0x0e,0xfd,0x0f,0xfa,0x00,0xef,0xb0,0x77,
-0x40,0x06,0x74,0x3a,0x00,0x50,0xaf,0xf2,0x00,0xcf,0xf1,0x09,0x00,0x50,0xdf,0xf0,
-0x00,0xff,0xd0,0x09,0x00,0xf2,0x14,0xff,0xc0,0x02,0xff,0xa0,0x00,0x00,0x00,0x03,
-0xff,0x90,0x05,0xff,0x70,0x00,0x00,0x00,0x06,0xff,0x60,0x08,0xff,0x40,0x00,0x00,
-0x00,0x0a,0xff,0x30,0x0c,0xff,0x10,0x00,0x0d,0xff,0x01,0x00,0x15,0xf7,0x09,0x00,
-0xf0,0x01,0x09,0xbb,0xcf,0xfe,0xbb,0xcf,0xfd,0xbb,0xb4,0x00,0x00,0x5f,0xf7,0x00,
-0x7f,0xf6,0x47,0x00,0x50,0x8f,0xf5,0x00,0xaf,0xf3,0x09,0x00,0x50,0xbf,0xf2,0x00,
-0xdf,0xf0,0x09,0x00,0x12,0xef,0x62,0x00,0x13,0xff,0x01,0x00,0x15,0x40,0x09,0x00,
-0xf0,0x09,0xaa,0xad,0xff,0xca,0xad,0xff,0xba,0xaa,0x20,0x00,0x09,0xff,0x40,0x0b,
-0xff,0x20,0x00,0x00,0x00,0x0c,0xff,0x10,0x0e,0xff,0x35,0x00,0x50,0x0f,0xfe,0x00,
-0x1f,0xfc,0x09,0x00,0x50,0x2f,0xfb,0x00,0x4f,0xf9,0x09,0x00,0x23,0x5f,0xf8,0x62,
-0x00,0x53,0x7f,0xf5,0x00,0x9f,0xf3,0x31,0x0a,0x1f,0xff,0x08,0x00,0x02,0x40,0x04,
-0x8d,0xff,0x84,0xca,0x00,0x81,0xdf,0xff,0xff,0xff,0xd3,0x00,0x00,0x4f,0x6f,0x00,
-0xf0,0x0d,0x30,0x00,0xef,0xff,0xff,0xef,0xff,0xff,0xd0,0x06,0xff,0xff,0xa0,0x01,
-0xbf,0xff,0xf5,0x09,0xff,0xff,0x00,0x00,0x1f,0xff,0xfa,0x0a,0xff,0xfd,0x79,0x00,
-0x11,0xfc,0x10,0x00,0x50,0x04,0x77,0x76,0x05,0xff,0x08,0x01,0x00,0xb9,0x00,0x30,
-0xff,0xfe,0x71,0x08,0x00,0xf0,0x08,0x3f,0xff,0xff,0xff,0xa2,0x00,0x00,0x00,0x02,
-0xcf,0xff,0xff,0xff,0xa1,0x00,0x00,0x00,0x05,0xdf,0xff,0xff,0xfd,0x20,0x62,0x00,
-0x22,0xaf,0xff,0x3d,0x01,0xf1,0x08,0x01,0xcf,0xff,0xf6,0x24,0x44,0x40,0x00,0x00,
-0x1e,0xff,0xfb,0x8f,0xff,0xf0,0x00,0x00,0x0b,0xff,0xfd,0x6f,0xff,0xf4,0x58,0x00,
-0x60,0x1f,0xff,0xfd,0x10,0x00,0x5f,0x68,0x00,0x81,0xff,0xfb,0x9c,0xff,0xff,0xf4,
-0x01,0xef,0x90,0x00,0x30,0xa0,0x00,0x1c,0x07,0x00,0x00,0xdc,0x00,0x50,0x4a,0xdf,
-0xff,0xc8,0x20,0x47,0x00,0x4e,0x0d,0xfa,0x00,0x00,0x08,0x00,0x42,0x4b,0xef,0xea,
-0x30,0x10,0x00,0x52,0x07,0xff,0xff,0xff,0xf5,0x0b,0x00,0xf0,0x24,0x2f,0xff,0xc9,
-0xdf,0xfe,0x00,0x00,0x07,0x10,0x00,0x00,0x6f,0xfb,0x00,0x0d,0xff,0x40,0x00,0x8f,
-0xf2,0x00,0x00,0x8f,0xf7,0x00,0x0a,0xff,0x50,0x03,0xff,0xb0,0x00,0x00,0x7f,0xf8,
-0x00,0x0b,0xff,0x50,0x0d,0xfe,0x10,0x00,0x00,0x5f,0xfe,0x30,0x4f,0xff,0x20,0x8f,
-0x3a,0x00,0x00,0xbc,0x01,0x21,0xfb,0x03,0xe1,0x00,0x50,0x02,0xdf,0xff,0xff,0xb1,
-0x20,0x00,0x00,0x32,0x01,0x54,0x78,0x73,0x00,0x9f,0xf5,0x88,0x0b,0x34,0x04,0xff,
-0xa0,0x0b,0x00,0x61,0x0e,0xfe,0x10,0x48,0x87,0x20,0x0b,0x00,0x32,0x9f,0xf5,0x2d,
-0xaf,0x00,0x00,0x20,0x00,0x00,0x5b,0x01,0xc0,0x80,0x00,0x00,0x00,0x1e,0xfe,0x15,
-0xff,0xe3,0x07,0xff,0xf0,0x53,0x02,0x71,0xf5,0x09,0xff,0x70,0x00,0xdf,0xf3,0x20,
-0x00,0x60,0x0a,0xff,0x50,0x00,0xcf,0xf3,0x20,0x00,0x40,0x10,0x09,0xff,0x60,0x0b,
-0x00,0x00,0x60,0x00,0xf2,0x02,0x07,0xff,0xb0,0x01,0xff,0xf1,0x00,0x00,0x19,0xa0,
-0x00,0x02,0xff,0xfc,0x9e,0xff,0xc0,0x65,0x00,0x53,0x7f,0xff,0xff,0xfe,0x20,0x7b,
-0x00,0xa1,0xbe,0xfe,0x91,0x00,0x00,0x00,0x18,0xcf,0xfe,0xa3,0x10,0x00,0x40,0x03,
-0xef,0xff,0xff,0x8e,0x02,0x00,0xaa,0x01,0x04,0xfd,0x00,0x61,0x9f,0xff,0xfb,0xae,
-0xff,0xfd,0xbd,0x02,0x52,0xff,0x70,0x01,0xef,0xff,0xac,0x01,0x31,0x20,0x00,0xbf,
-0x0a,0x00,0x62,0xcf,0xff,0x50,0x02,0xff,0xfb,0x57,0x00,0x41,0xd0,0x5e,0xff,0xf3,
-0xc6,0x00,0x52,0xff,0xfe,0xff,0xff,0x50,0xbb,0x00,0x01,0x13,0x02,0x02,0x0a,0x00,
-0x12,0xfd,0x74,0x00,0x11,0x8f,0x63,0x00,0xf0,0x17,0xaf,0xff,0x30,0x08,0xff,0xff,
-0xdf,0xff,0xf6,0x00,0xcf,0xff,0x20,0x3f,0xff,0xf6,0x0c,0xff,0xff,0x50,0xff,0xff,
-0x00,0xaf,0xff,0xd0,0x01,0xdf,0xff,0xf9,0xff,0xfd,0x00,0xdf,0xff,0xa0,0x00,0x2e,
-0xf7,0x02,0xe1,0x00,0xdf,0xff,0xd0,0x00,0x02,0xff,0xff,0xff,0xf1,0x00,0xaf,0xff,
-0xf7,0x40,0x00,0x10,0x70,0x65,0x02,0x83,0xda,0xad,0xff,0xff,0xff,0xc0,0x00,0x09,
-0xe0,0x02,0x12,0xf9,0x5a,0x00,0xf0,0x08,0xff,0xec,0xff,0xff,0x60,0x00,0x02,0x8c,
-0xef,0xfd,0xa5,0x00,0xdf,0xff,0xf3,0x0f,0xff,0x40,0xff,0xf4,0x0f,0xff,0x40,0x0a,
-0x00,0xa1,0x20,0xff,0xf0,0x0f,0xff,0x00,0xff,0xe0,0x08,0x86,0xeb,0x00,0x10,0xa0,
-0xb4,0x00,0x10,0xf3,0xe6,0x01,0x40,0xf6,0x00,0x00,0x4f,0x5f,0x01,0x20,0xef,0xfa,
-0xd4,0x02,0x10,0xf1,0xfd,0x00,0x10,0x80,0xd0,0x00,0x80,0x10,0x00,0x00,0xdf,0xfc,
-0x00,0x00,0x02,0x76,0x00,0x10,0x06,0x5f,0x02,0x10,0x0a,0x1d,0x00,0x10,0x0d,0x7f,
-0x01,0x10,0x0e,0x89,0x02,0x3d,0x0f,0xff,0xc0,0x05,0x00,0x01,0x19,0x00,0x01,0x23,
-0x00,0x01,0x2d,0x00,0x01,0x37,0x00,0x30,0x03,0xff,0xf7,0x34,0x01,0x10,0xfb,0xfd,
-0x00,0x00,0x55,0x00,0x10,0x1f,0x63,0x01,0x80,0x09,0xff,0xe0,0x00,0x00,0x01,0xef,
-0xf9,0x6c,0x03,0x20,0xff,0x60,0x79,0x00,0x10,0xf5,0x20,0x00,0x10,0xf4,0x2c,0x01,
-0x12,0xc0,0x5f,0x03,0x10,0x60,0x9a,0x03,0x11,0xfa,0x13,0x03,0x10,0xb0,0x42,0x01,
-0x11,0xf9,0x66,0x01,0x40,0x30,0x00,0x00,0x0d,0x65,0x00,0x30,0x05,0xff,0xf6,0x56,
-0x00,0x11,0xfd,0xa3,0x01,0x13,0x30,0xc3,0x00,0x12,0x1f,0x84,0x00,0x10,0xf0,0x0b,
-0x03,0x10,0xf3,0x84,0x00,0x10,0xf5,0x6a,0x00,0x10,0xf6,0x5f,0x00,0x13,0xf8,0x05,
-0x00,0x30,0x09,0xff,0xf7,0x19,0x00,0x10,0xf6,0x36,0x03,0x10,0xf4,0x4c,0x00,0x10,
-0xf1,0xbb,0x00,0x10,0xe0,0x41,0x00,0x40,0x90,0x00,0x00,0x8f,0x84,0x04,0x20,0xdf,
-0xfd,0x6f,0x00,0x10,0xf7,0x45,0x00,0x10,0xe0,0x9f,0x00,0x50,0x40,0x00,0x03,0xff,
-0xfa,0x05,0x03,0x22,0xc0,0x00,0x28,0x04,0x26,0x0a,0x70,0x47,0x0e,0x10,0x01,0x24,
-0x00,0x00,0xaa,0x00,0x03,0xe0,0x01,0x01,0x67,0x02,0xf0,0x09,0x51,0x00,0x0e,0xfc,
-0x00,0x01,0x20,0x0f,0xfb,0x40,0xdf,0xb0,0x4a,0xfa,0x05,0xff,0xff,0xee,0xfd,0xdf,
-0xff,0xf0,0x28,0xdf,0xa2,0x01,0x70,0xea,0x10,0x00,0x16,0xef,0xff,0xc7,0x83,0x02,
-0x12,0x6f,0x15,0x02,0x50,0x3f,0xfe,0x9f,0xfa,0x00,0xce,0x03,0x21,0x50,0xdf,0x75,
-0x00,0x20,0xb0,0x04,0x9a,0x00,0x50,0x3d,0xf1,0x00,0x09,0xfa,0xaa,0x01,0x31,0x00,
-0x00,0x15,0x5a,0x00,0x33,0x25,0x55,0x40,0x98,0x03,0x14,0xfd,0xca,0x02,0x1f,0xd0,
-0x11,0x00,0x11,0x14,0x01,0x42,0x05,0x13,0x1f,0x09,0x00,0x1c,0x71,0x11,0x00,0x1f,
-0x70,0x55,0x00,0x1f,0x00,0x0f,0x03,0x04,0x03,0x00,0x50,0xfe,0x00,0xef,0xfc,0x02,
-0x30,0x06,0xf0,0x00,0xf2,0x1f,0xff,0x80,0x2b,0xfb,0x00,0x00,0x30,0x00,0x29,0x99,
-0x99,0x99,0x94,0x0b,0x05,0x16,0xf8,0x05,0x00,0xa0,0x00,0x8b,0x81,0x00,0xbf,0xff,
-0xb0,0x0f,0xff,0xff,0xd4,0x02,0x32,0x02,0xcf,0xc3,0x38,0x01,0x01,0x2b,0x03,0x31,
-0x05,0xff,0xf0,0x29,0x06,0x1d,0xfa,0x13,0x00,0x22,0xbf,0xfa,0x90,0x03,0x11,0x40,
-0x25,0x06,0x02,0x13,0x00,0x18,0xf9,0x13,0x00,0x11,0xe0,0x88,0x03,0x07,0x13,0x00,
-0x18,0x07,0x13,0x00,0x36,0x2f,0xff,0x30,0x13,0x00,0x28,0xdf,0xf8,0x13,0x00,0x18,
-0xd0,0x13,0x00,0x11,0x20,0xd1,0x05,0x02,0x13,0x00,0x11,0xf7,0x7f,0x02,0x22,0x88,
-0x10,0xef,0x00,0x62,0x39,0xdf,0xfe,0xa5,0x00,0x00,0x69,0x03,0x40,0xd1,0x00,0x00,
-0xaf,0x08,0x00,0x40,0xfe,0x10,0x04,0xff,0x18,0x04,0x50,0xff,0xa0,0x0c,0xff,0xfe,
-0x0c,0x04,0x40,0xf1,0x1f,0xff,0xf7,0x80,0x00,0x40,0xf6,0x4f,0xff,0xf2,0x55,0x02,
-0x22,0xfa,0x6f,0x98,0x05,0x22,0xfc,0x7f,0x0c,0x03,0x2f,0xfd,0x8f,0x08,0x00,0x0c,
-0x04,0x28,0x00,0x04,0x38,0x00,0x03,0x48,0x00,0x14,0xf9,0x58,0x00,0x10,0x0b,0x68,
-0x00,0x80,0xaf,0xff,0xf1,0x04,0xff,0xff,0xfa,0xad,0xd0,0x05,0x12,0x9f,0x88,0x00,
-0x02,0x98,0x00,0x12,0xd2,0xa8,0x00,0x11,0xb6,0xb1,0x00,0xe0,0x02,0x7d,0x80,0x00,
-0x01,0x6c,0xff,0xf8,0x01,0x6b,0xff,0xff,0xff,0x85,0x1f,0x00,0x20,0xf8,0x6f,0x06,
-0x00,0x91,0x86,0xff,0xea,0x5f,0xff,0xf8,0x48,0x30,0x00,0x4d,0x05,0x10,0x0f,0x0d,
-0x03,0x0f,0x0b,0x00,0x3a,0x53,0x4a,0xdf,0xfe,0xb7,0x10,0xb9,0x06,0x52,0xfe,0x50,
-0x00,0x02,0xef,0x79,0x07,0x80,0x00,0xdf,0xff,0xfe,0xab,0xef,0xff,0xfd,0x96,0x06,
-0x80,0x00,0x01,0xdf,0xff,0xf3,0x0a,0xff,0xfe,0xde,0x01,0x50,0xff,0x50,0xdf,0xff,
-0xb0,0x7b,0x01,0x41,0xf5,0x02,0x33,0x31,0x22,0x05,0x02,0x78,0x06,0x13,0xbf,0x70,
-0x02,0x33,0x5f,0xff,0xf7,0x7c,0x06,0x11,0xfc,0x08,0x00,0x13,0x2e,0xb7,0x05,0x13,
-0x2e,0x29,0x00,0x10,0x2e,0x5c,0x00,0x0f,0x08,0x00,0x10,0x93,0x1e,0xff,0xff,0xd9,
-0x99,0x99,0x99,0x99,0x17,0xed,0x02,0x23,0xf2,0x7f,0x09,0x00,0x14,0x27,0x11,0x00,
-0x41,0x00,0x01,0x7b,0xef,0x3c,0x01,0x01,0x27,0x01,0x32,0xe5,0x00,0x08,0x18,0x00,
-0xc0,0x50,0x2f,0xff,0xff,0xda,0xae,0xff,0xff,0xe0,0x8f,0xff,0xf6,0xf8,0x01,0x40,
-0xf4,0x7b,0xbb,0x90,0x8f,0x00,0x22,0xf6,0x00,0xa8,0x07,0x00,0xac,0x04,0x00,0x18,
-0x00,0x61,0xe1,0x00,0x00,0x06,0x77,0x9d,0xf3,0x05,0x00,0xf1,0x06,0x13,0xd4,0xf9,
-0x06,0x13,0x91,0x08,0x00,0x11,0xfe,0xae,0x00,0x23,0x26,0xef,0x28,0x04,0x12,0x3f,
-0xd7,0x00,0x00,0x24,0x02,0x31,0x77,0x77,0x40,0xb4,0x07,0x30,0xef,0xff,0xb0,0xb6,
-0x04,0x10,0xfa,0xe0,0x05,0x00,0xe5,0x05,0x12,0x4f,0x78,0x00,0x23,0xe1,0x08,0xbb,
-0x08,0x00,0xb3,0x06,0x01,0x49,0x06,0x20,0x01,0x7c,0xd8,0x05,0x02,0x77,0x04,0x04,
-0x50,0x00,0x23,0x0a,0xff,0x09,0x00,0x13,0x5f,0x09,0x00,0x00,0xf2,0x07,0x13,0xe0,
-0x1a,0x00,0x02,0x09,0x00,0x13,0x4f,0x09,0x00,0x61,0x01,0xef,0xfe,0xaf,0xff,0xe0,
-0x1a,0x00,0x41,0xf4,0x9f,0xff,0xe0,0x1a,0x00,0x22,0xa0,0x9f,0x89,0x05,0x20,0xfe,
-0x10,0x09,0x00,0x00,0x1a,0x00,0x22,0x00,0x9f,0x0e,0x05,0x11,0xa0,0x09,0x00,0x00,
-0x1a,0x00,0x01,0x09,0x00,0xa4,0x0a,0xff,0xfc,0x99,0x99,0xdf,0xff,0xf9,0x94,0x1f,
-0x3e,0x04,0x1d,0x0f,0x09,0x00,0x02,0xba,0x07,0x03,0x90,0x00,0x0f,0x09,0x00,0x0e,
-0x11,0x8f,0x35,0x00,0x34,0xf4,0x00,0x0a,0xe7,0x00,0x13,0xcf,0x11,0x00,0x70,0x0e,
-0xff,0xfc,0xbb,0xbb,0xbb,0xbb,0xa9,0x02,0x13,0x10,0x03,0x02,0x13,0xf0,0x46,0x07,
-0x03,0x83,0x04,0x60,0x6f,0xff,0xc7,0xce,0xfd,0xa3,0xb2,0x03,0x03,0xfc,0x06,0x12,
-0xaf,0x09,0x00,0x00,0x0e,0x03,0x30,0x96,0x6a,0xff,0x3c,0x03,0x73,0x47,0x10,0x00,
-0x06,0xff,0xff,0x90,0x6c,0x01,0x14,0xfd,0x78,0x00,0x13,0xf0,0xbb,0x09,0x50,0xff,
-0x02,0x88,0x88,0x10,0x38,0x00,0x50,0xe0,0x3f,0xff,0xf6,0x00,0x73,0x00,0x40,0x00,
-0xef,0xff,0xe2,0x19,0x00,0xb3,0x70,0x07,0xff,0xff,0xfb,0x9d,0xff,0xff,0xe1,0x00,
-0x0b,0x90,0x00,0x02,0x67,0x00,0x30,0xe4,0x00,0x00,0x59,0x07,0x22,0xeb,0x61,0x2b,
-0x08,0x21,0x8c,0xef,0xa7,0x06,0x22,0x3c,0xff,0x9f,0x02,0x11,0x7f,0x8e,0x07,0x01,
-0xd5,0x00,0x21,0xfd,0xb8,0x8e,0x01,0x22,0xfd,0x50,0x0d,0x08,0x02,0x5e,0x09,0x61,
-0x06,0xff,0xfd,0x03,0x78,0x85,0x32,0x08,0x11,0x8b,0x1f,0x03,0x03,0x47,0x01,0x23,
-0x60,0x04,0x3d,0x01,0xd0,0x20,0x5f,0xff,0xff,0x92,0x03,0xcf,0xff,0xf9,0x06,0xff,
-0xff,0x70,0xb4,0x05,0x41,0xe0,0x7f,0xff,0xf1,0x7b,0x00,0x11,0x16,0x07,0x01,0x61,
-0x5f,0xff,0xf3,0x5f,0xff,0xf3,0x28,0x03,0x11,0x33,0x6c,0x02,0x60,0x7f,0xff,0xf1,
-0x0f,0xff,0xfb,0x41,0x02,0x50,0xfe,0x00,0x9f,0xff,0xf5,0xaf,0x09,0x60,0x80,0x02,
-0xff,0xff,0xfc,0x9c,0xbb,0x00,0x23,0x05,0xff,0xc1,0x08,0x23,0x04,0xef,0xbb,0x00,
-0x74,0x00,0x7b,0xef,0xec,0x60,0x00,0x00,0xac,0x01,0x1e,0xf0,0x09,0x00,0x20,0x09,
-0x99,0x01,0x00,0x12,0xef,0x34,0x01,0x00,0x73,0x08,0x13,0x20,0x61,0x02,0x14,0xfa,
-0x05,0x0a,0x14,0xf3,0x46,0x01,0x13,0xc0,0xfb,0x06,0x23,0xff,0x40,0x4f,0x01,0x02,
-0x60,0x01,0x00,0xa9,0x04,0x04,0xe6,0x08,0x03,0xea,0x01,0x02,0xb9,0x09,0x01,0x4d,
-0x0a,0x22,0x10,0x00,0x11,0x01,0x14,0xf9,0xc4,0x01,0x23,0xf2,0x00,0xfa,0x0a,0x13,
-0xb0,0x23,0x01,0x03,0x02,0x04,0x13,0x0d,0xf2,0x03,0x24,0x00,0x5f,0x80,0x0a,0x34,
-0xdf,0xff,0xe0,0x47,0x09,0x03,0x7b,0x07,0x12,0x5a,0x6d,0x04,0x12,0x2d,0xe7,0x00,
-0x03,0xe6,0x0a,0x70,0x50,0x09,0xff,0xff,0xfb,0xad,0xff,0x89,0x0c,0x00,0x2e,0x05,
-0x00,0xf6,0x08,0x10,0xf9,0x72,0x03,0x22,0xf5,0x0e,0x08,0x00,0x22,0xf4,0x09,0xae,
-0x05,0x31,0xe0,0x01,0xef,0x28,0x00,0x32,0x50,0x00,0x2c,0xf2,0x03,0x02,0xe2,0x01,
-0x23,0xb1,0x00,0x83,0x02,0xc0,0x30,0x0a,0xff,0xff,0x71,0x14,0xdf,0xff,0xe0,0x2f,
-0xff,0xf7,0xf8,0x00,0x40,0xf7,0x5f,0xff,0xf1,0x69,0x01,0x27,0xfb,0x7f,0x6e,0x0b,
-0x00,0x34,0x02,0x10,0x3f,0x6e,0x0b,0x42,0x8f,0xff,0xf9,0x0d,0x78,0x00,0x22,0xf2,
-0x03,0x4b,0x01,0x33,0x80,0x00,0x3d,0x10,0x03,0x00,0xa8,0x00,0x21,0xc7,0x10,0x9e,
-0x05,0x23,0xfd,0x92,0x94,0x03,0x00,0xc3,0x00,0x15,0xcf,0xaf,0x02,0x50,0xea,0xaf,
-0xff,0xff,0x40,0xb6,0x0b,0x41,0x01,0xdf,0xff,0xd0,0x58,0x00,0x31,0x4f,0xff,0xf2,
-0x16,0x06,0x31,0x0f,0xff,0xf7,0xaf,0x03,0x31,0x0d,0xff,0xf8,0xb8,0x02,0x01,0x56,
-0x06,0x11,0xf6,0xf6,0x0b,0x94,0x1f,0xff,0xff,0x61,0x04,0xdf,0xff,0xfa,0x09,0xfd,
-0x09,0x02,0xb8,0x00,0x10,0xf8,0xc8,0x00,0x11,0xfc,0xd1,0x02,0x31,0x04,0x55,0x20,
-0x43,0x06,0x05,0x51,0x05,0x00,0x5f,0x01,0x10,0x60,0xd8,0x01,0x10,0xaf,0xad,0x01,
-0x31,0x03,0xcc,0xef,0x26,0x03,0x13,0x04,0xa1,0x04,0x13,0x04,0x76,0x0c,0x41,0x04,
-0xff,0xdb,0x72,0x7d,0x0c,0x10,0xc2,0xa4,0x07,0x30,0x0f,0xff,0xff,0xb2,0x07,0x4f,
-0x01,0x8b,0x81,0x00,0x01,0x00,0x06,0x27,0x8b,0x80,0xd5,0x07,0x10,0x03,0xd5,0x07,
-0xff,0x02,0x5d,0xfa,0x00,0x1f,0xff,0xf9,0x04,0xff,0xff,0xb0,0x1e,0xff,0xf7,0x00,
-0x29,0xb6,0x00,0x01,0x00,0x09,0xf0,0x05,0x05,0xcc,0xc4,0x00,0x7f,0xff,0x50,0x07,
-0xff,0xf5,0x00,0x7f,0xff,0x40,0x08,0xff,0xf2,0x00,0xbf,0xfe,0x81,0x0a,0x9b,0x09,
-0xff,0xe1,0x00,0xbf,0xf5,0x00,0x00,0x45,0x30,0x00,0x21,0x04,0xa4,0x07,0x00,0x11,
-0x6d,0x7a,0x02,0x11,0x29,0x9e,0x03,0x20,0x05,0xcf,0x3e,0x04,0x20,0x01,0x7e,0xcb,
-0x00,0x20,0x91,0x1a,0x08,0x01,0x11,0xa4,0x31,0x0b,0x11,0xb5,0xb4,0x02,0x22,0xfd,
-0x30,0xcd,0x02,0x10,0xff,0x87,0x01,0x10,0x08,0x28,0x02,0x50,0xc6,0x10,0x00,0x00,
-0x5c,0x27,0x00,0x62,0xb2,0x00,0x00,0x03,0x9f,0xff,0xc5,0x02,0x23,0x17,0xdf,0xd0,
-0x05,0x13,0x4b,0xd4,0x02,0x41,0x02,0x83,0x8a,0xaa,0x01,0x00,0x12,0x0e,0x64,0x01,
-0x22,0xf1,0xef,0x08,0x00,0x13,0x1e,0x0f,0x00,0x0f,0xcf,0x00,0x03,0x12,0x08,0x34,
-0x00,0x1b,0xa0,0x2d,0x00,0x03,0x0f,0x00,0x33,0x10,0x1b,0x50,0x5c,0x03,0x22,0xe8,
-0x10,0x52,0x03,0x23,0xff,0xa4,0x9e,0x00,0x10,0xfd,0x04,0x0b,0x10,0xdf,0xcc,0x01,
-0x40,0x30,0x00,0x00,0x38,0x30,0x00,0x10,0xc3,0x36,0x02,0x12,0xef,0xf1,0x02,0x21,
-0x01,0xaf,0x4d,0x02,0x11,0x5b,0x3d,0x02,0x20,0x5a,0xff,0xad,0x01,0x01,0xfb,0x01,
-0x30,0xe7,0x10,0x02,0x63,0x0d,0x11,0x50,0x4b,0x00,0x11,0x92,0x4b,0x00,0x11,0xd6,
-0x62,0x00,0x24,0x1a,0x30,0x92,0x00,0x11,0x6b,0x33,0x06,0x01,0x07,0x04,0x22,0xfc,
-0x10,0xa0,0x02,0xc0,0xfc,0x00,0xbf,0xff,0xfe,0xbb,0xff,0xff,0xf5,0x1f,0xff,0xfc,
-0xfa,0x01,0x40,0xa3,0xff,0xff,0x50,0x75,0x03,0x20,0x01,0x11,0xf3,0x0b,0x02,0x8e,
-0x03,0x01,0x45,0x02,0x00,0x45,0x07,0x17,0xfd,0x74,0x07,0x03,0x07,0x00,0x12,0x0c,
-0x8a,0x07,0x13,0x03,0xb0,0x03,0x12,0x7f,0xc1,0x0d,0x13,0x08,0x00,0x06,0x29,0x01,
-0x11,0x12,0x01,0x29,0x07,0xa7,0x46,0x04,0x38,0xff,0xff,0xf0,0x92,0x05,0x23,0x3c,
-0xfc,0x8b,0x0d,0x63,0x03,0x8b,0xef,0xfe,0xc9,0x50,0x34,0x00,0x21,0x4d,0xff,0xdd,
-0x00,0x22,0x00,0x00,0xfb,0x00,0x51,0xfd,0xa8,0x8a,0xcf,0xff,0x29,0x00,0x21,0x01,
-0xdf,0xe6,0x00,0x21,0x16,0xef,0x81,0x00,0x23,0xdf,0xfd,0x32,0x08,0x10,0xfc,0x88,
-0x07,0x13,0xfd,0xb0,0x09,0x20,0xbf,0xf7,0x43,0x03,0x03,0x57,0x00,0x00,0x01,0x0e,
-0x10,0x0d,0xf8,0x02,0x60,0x2a,0xef,0xeb,0x50,0x00,0x08,0x6f,0x05,0x12,0xe0,0xe8,
-0x07,0x10,0xc1,0xed,0x0f,0x20,0xaf,0xf7,0x0d,0x00,0xf0,0x0f,0xeb,0xdf,0xff,0x20,
-0x00,0xdf,0xf0,0x0f,0xff,0x20,0x00,0x1f,0xff,0x90,0x01,0xff,0xf0,0x00,0x0a,0xff,
-0x23,0xff,0xd0,0x00,0x0a,0xff,0xc0,0x00,0x3f,0xff,0x96,0x0c,0x70,0x6f,0xfa,0x00,
-0x01,0xff,0xf5,0x00,0x3d,0x00,0xc0,0x07,0xff,0x58,0xff,0x80,0x00,0x6f,0xff,0x00,
-0x00,0x5f,0xfc,0x1f,0x10,0x60,0x9f,0xf7,0x00,0x09,0xff,0xd0,0x6d,0x0e,0x40,0x00,
-0x07,0xff,0x4a,0x7e,0x0e,0xf0,0x07,0xfa,0x00,0x00,0x8f,0xfa,0x00,0x00,0x9f,0xf2,
-0xaf,0xf7,0x00,0x0d,0xff,0x90,0x00,0x09,0xff,0x80,0x00,0x0b,0xff,0xaf,0x0e,0x22,
-0xef,0xf9,0x9f,0x00,0xf0,0x12,0xff,0xc0,0x7f,0xfa,0x00,0x0c,0xff,0xc0,0x00,0x2f,
+0x42,0xdf,0x10,0x00,0x89,0xf6,0xdf,0x50,0x08,0x0a,0x18,0x01,0x00,0x01,0x00,0x2f,
+0xf1,0x00,0x01,0x00,0x05,0x13,0xf7,0x08,0x00,0x17,0xe2,0x14,0x00,0xbf,0xf4,0xf1,
+0x00,0xfb,0xe9,0x00,0xe9,0x00,0x00,0x00,0x03,0x34,0x00,0x02,0x4f,0x05,0x0a,0x00,
+0x06,0x18,0x00,0x01,0x2f,0xb9,0x00,0x01,0x00,0x17,0x1f,0xc2,0x20,0x00,0x0c,0x03,
+0x90,0x00,0xb2,0xec,0x00,0xfb,0x00,0x00,0xe2,0xfc,0xed,0xf6,0x00,0xdb,0x9b,0x00,
+0x8e,0xfd,0x00,0x00,0xfc,0xfd,0xf4,0xf8,0x00,0x9a,0x00,0x6f,0xf9,0x00,0xfa,0x00,
+0x00,0xf2,0x4e,0x00,0x03,0x17,0xfa,0x26,0x00,0x01,0x01,0x00,0x19,0xfd,0x1f,0x00,
+0x17,0xfc,0x76,0x00,0x00,0x71,0x00,0x8b,0x00,0xeb,0x00,0xfb,0x00,0xfb,0xf5,0xfa,
+0x46,0x00,0x1c,0xf8,0x08,0x01,0x04,0x09,0x00,0x21,0xfb,0xfc,0x36,0x00,0x37,0xfc,
+0xfa,0xfb,0x1e,0x00,0x75,0xbc,0x00,0x00,0x00,0xd0,0x00,0xcc,0x26,0x00,0x62,0xf8,
+0xfb,0x00,0x00,0xfb,0xfa,0x04,0x00,0x0e,0x48,0x00,0x00,0x98,0x00,0x2f,0x04,0xf9,
+0x12,0x01,0x09,0x1f,0xfb,0x55,0x01,0x0f,0x1b,0xd7,0xa5,0x00,0x12,0xfa,0x58,0x00,
+0x33,0xfa,0xf6,0xf0,0x11,0x00,0x14,0xb8,0x72,0x00,0x96,0xf0,0x00,0x00,0xcd,0xfa,
+0xcd,0xe9,0x00,0xba,0x2d,0x00,0x37,0xfd,0xe1,0xf3,0x3b,0x00,0x71,0x9b,0x00,0x00,
+0x00,0xd4,0x00,0xd2,0x0c,0x00,0x61,0xf3,0x00,0xf7,0x00,0xfd,0xfd,0x35,0x01,0x30,
+0x04,0x00,0x04,0x12,0x00,0x1d,0xb6,0x1a,0x01,0x4f,0xf9,0xfb,0x00,0xf7,0x9f,0x00,
+0x0d,0x10,0xf4,0xc4,0x00,0x1e,0xf4,0x19,0x00,0x02,0x9f,0x02,0xb1,0xc0,0xbc,0x00,
+0x00,0xe2,0xf9,0xca,0xfc,0x04,0x00,0x04,0x66,0x00,0xf1,0x02,0xd6,0xea,0x00,0xea,
+0xcc,0xf0,0xed,0x00,0xf0,0xec,0xf4,0xed,0xf1,0x00,0xd1,0xeb,0xe8,0x2a,0x01,0x56,
+0xca,0xd9,0x00,0x00,0xed,0xbe,0x01,0xb6,0x04,0xf5,0xf5,0x00,0x00,0xf5,0xf9,0x00,
+0x00,0xf9,0xfd,0x91,0x01,0x71,0x04,0x00,0xdc,0xf1,0x00,0x00,0xf5,0x0a,0x00,0x01,
+0x01,0x00,0x33,0x03,0xf8,0xf8,0x80,0x01,0x02,0x1f,0x00,0x04,0x01,0x00,0x14,0xd9,
+0x1b,0x02,0x15,0x04,0x30,0x01,0x10,0xfb,0x6a,0x01,0x16,0xf8,0x2f,0x02,0xf5,0x14,
+0x05,0xf4,0xc6,0xda,0x00,0x00,0xdb,0xf9,0xe8,0xfc,0x04,0xe8,0x05,0x04,0x03,0x05,
+0x00,0x05,0xf0,0xf0,0xfb,0xf6,0xf0,0xf6,0xf2,0xfb,0xf6,0xfb,0x00,0xfa,0xf9,0x05,
+0xe8,0xf0,0xf0,0x2d,0x00,0x2a,0x03,0xfa,0xaf,0x01,0x01,0x4c,0x00,0x1e,0xf9,0xd5,
+0x01,0x17,0xfc,0x72,0x02,0x0e,0x1c,0x00,0x0e,0x01,0x00,0x0e,0x1d,0x00,0x0f,0x29,
+0x02,0x0a,0x4e,0xfd,0x00,0xfc,0xfc,0xe5,0x02,0x0f,0x2f,0x00,0x08,0x0f,0x1d,0x00,
+0x11,0x3e,0x04,0x00,0x05,0xb7,0x02,0x1c,0xfa,0x0d,0x03,0x2f,0xec,0x00,0x01,0x00,
+0x26,0x0d,0xdf,0x02,0x1f,0xea,0x0a,0x01,0x0a,0x00,0x74,0x03,0x04,0xba,0x01,0x1c,
+0xd5,0x0a,0x04,0x20,0xfb,0x05,0x8d,0x02,0x4f,0x0d,0x00,0x05,0x04,0x75,0x00,0x0c,
+0x0a,0x48,0x01,0x00,0x2e,0x00,0x1c,0xd6,0x69,0x00,0x3e,0xfd,0x03,0x00,0x94,0x01,
+0x1f,0xe1,0xe4,0x00,0x26,0x1e,0xf6,0x26,0x00,0x0f,0x1f,0x02,0x18,0x1f,0xfb,0x07,
+0x04,0x08,0x30,0x01,0x00,0x02,0x07,0x00,0x31,0x02,0x03,0x00,0xa7,0x03,0x1d,0x05,
+0x21,0x00,0xf1,0x0c,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,
+0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,
+0x00,0xf1,0x0c,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,
+0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x3f,0x00,
+0x01,0x01,0x00,0xd0,0x00,0x08,0x0a,0x0a,0x0a,0x0a,0x0c,0x0c,0x0c,0x0c,0x09,0x0c,
+0x09,0x01,0x00,0xa1,0x00,0x00,0x0d,0x0d,0x0d,0x0d,0x17,0x00,0x00,0x1a,0x01,0x00,
+0x61,0x00,0x1c,0x1d,0x1d,0x1d,0x1d,0x50,0x00,0x20,0x1f,0x21,0x01,0x00,0x02,0x7c,
+0x00,0x50,0x24,0x1b,0x24,0x06,0x1a,0x02,0x00,0x22,0x08,0x1c,0x02,0x00,0x64,0x09,
+0x00,0x09,0x00,0x0a,0x1d,0x02,0x00,0x04,0xa3,0x00,0x10,0x0c,0x89,0x0c,0x05,0x02,
+0x00,0x00,0xc3,0x01,0x43,0x0e,0x00,0x00,0x0f,0x02,0x00,0x00,0x1f,0x00,0x00,0x02,
+0x00,0x80,0x1f,0x00,0x00,0x09,0x21,0x09,0x21,0x09,0x5b,0x00,0x11,0x22,0x02,0x00,
+0x03,0x01,0x00,0x11,0x13,0x02,0x00,0x17,0x0d,0x02,0x00,0x70,0x15,0x00,0x17,0x24,
+0x17,0x18,0x27,0x02,0x00,0x04,0x21,0x01,0x20,0x03,0x02,0x1c,0x01,0x4a,0x06,0x07,
+0x06,0x08,0x1f,0x01,0x00,0x90,0x00,0x60,0x00,0x0b,0x00,0x00,0x00,0x0b,0x83,0x00,
+0x01,0x08,0x00,0xf1,0x08,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,
+0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xf1,0x05,
+0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,
+0x23,0x00,0x00,0x0a,0x01,0x00,0x26,0x24,0x0b,0x53,0x00,0x10,0x0b,0x01,0x00,0xa1,
+0x00,0x0b,0x0f,0x0f,0x0f,0x0f,0x13,0x00,0x00,0x16,0x01,0x00,0x20,0x25,0x17,0x01,
+0x00,0x02,0x44,0x00,0x02,0x32,0x01,0xa0,0x26,0x1e,0x1e,0x1e,0x1e,0x1f,0x00,0x1f,
+0x0a,0x16,0x02,0x00,0x22,0x0b,0x17,0x02,0x00,0x10,0x00,0x24,0x00,0x14,0x17,0x02,
+0x00,0x05,0x16,0x00,0x0b,0x01,0x00,0x1b,0x0c,0x10,0x00,0x10,0x19,0x02,0x00,0x51,
+0x19,0x00,0x00,0x0b,0x1a,0x02,0x00,0x03,0x30,0x00,0x22,0x0d,0x1c,0x02,0x00,0x10,
+0x0e,0x4f,0x01,0x36,0x00,0x0f,0x1e,0x02,0x00,0xc0,0x11,0x00,0x13,0x1f,0x13,0x14,
+0x22,0x14,0x22,0x14,0x22,0x00,0x70,0x0f,0xff,0xfd,0x0e,0xff,0xfc,0x0d,0x03,0x00,
+0x20,0xfb,0x0c,0x03,0x00,0x20,0xfa,0x0b,0x03,0x00,0x20,0xf9,0x0a,0x03,0x00,0xb0,
+0xf8,0x09,0xff,0xf7,0x09,0xff,0xf7,0x08,0xff,0xf6,0x07,0x03,0x00,0xf0,0x12,0xf5,
+0x03,0x99,0x93,0x00,0x00,0x00,0x00,0x8a,0x70,0x0b,0xff,0xfa,0x0f,0xff,0xfe,0x0d,
+0xff,0xfc,0x03,0xcf,0xc2,0xff,0xf2,0x0e,0xff,0x3f,0xff,0x20,0xef,0xf3,0xff,0xf1,
+0x09,0x00,0xf0,0x0a,0x00,0xef,0xf1,0xff,0xe0,0x0e,0xff,0x0f,0xfd,0x00,0xef,0xe0,
+0xff,0xb0,0x0e,0xfd,0x0f,0xfa,0x00,0xef,0xb0,0x77,0x40,0x06,0x74,0x3a,0x00,0x50,
+0xaf,0xf2,0x00,0xcf,0xf1,0x09,0x00,0x50,0xdf,0xf0,0x00,0xff,0xd0,0x09,0x00,0xf2,
+0x14,0xff,0xc0,0x02,0xff,0xa0,0x00,0x00,0x00,0x03,0xff,0x90,0x05,0xff,0x70,0x00,
+0x00,0x00,0x06,0xff,0x60,0x08,0xff,0x40,0x00,0x00,0x00,0x0a,0xff,0x30,0x0c,0xff,
+0x10,0x00,0x0d,0xff,0x01,0x00,0x15,0xf7,0x09,0x00,0xf0,0x01,0x09,0xbb,0xcf,0xfe,
+0xbb,0xcf,0xfd,0xbb,0xb4,0x00,0x00,0x5f,0xf7,0x00,0x7f,0xf6,0x47,0x00,0x50,0x8f,
+0xf5,0x00,0xaf,0xf3,0x09,0x00,0x50,0xbf,0xf2,0x00,0xdf,0xf0,0x09,0x00,0x12,0xef,
+0x62,0x00,0x13,0xff,0x01,0x00,0x15,0x40,0x09,0x00,0xf0,0x09,0xaa,0xad,0xff,0xca,
+0xad,0xff,0xba,0xaa,0x20,0x00,0x09,0xff,0x40,0x0b,0xff,0x20,0x00,0x00,0x00,0x0c,
+0xff,0x10,0x0e,0xff,0x35,0x00,0x50,0x0f,0xfe,0x00,0x1f,0xfc,0x09,0x00,0x50,0x2f,
+0xfb,0x00,0x4f,0xf9,0x09,0x00,0x23,0x5f,0xf8,0x62,0x00,0x61,0x7f,0xf5,0x00,0x9f,
+0xf3,0x00,0x01,0x00,0x2f,0x08,0xff,0x08,0x00,0x02,0x40,0x04,0x8d,0xff,0x84,0xca,
+0x00,0x81,0xdf,0xff,0xff,0xff,0xd3,0x00,0x00,0x4f,0x6f,0x00,0xf0,0x0d,0x30,0x00,
+0xef,0xff,0xff,0xef,0xff,0xff,0xd0,0x06,0xff,0xff,0xa0,0x01,0xbf,0xff,0xf5,0x09,
+0xff,0xff,0x00,0x00,0x1f,0xff,0xfa,0x0a,0xff,0xfd,0x79,0x00,0x11,0xfc,0x10,0x00,
+0x50,0x04,0x77,0x76,0x05,0xff,0x08,0x01,0x00,0xb9,0x00,0x30,0xff,0xfe,0x71,0x08,
+0x00,0xf0,0x08,0x3f,0xff,0xff,0xff,0xa2,0x00,0x00,0x00,0x02,0xcf,0xff,0xff,0xff,
+0xa1,0x00,0x00,0x00,0x05,0xdf,0xff,0xff,0xfd,0x20,0x62,0x00,0x22,0xaf,0xff,0x3d,
+0x01,0xf1,0x08,0x01,0xcf,0xff,0xf6,0x24,0x44,0x40,0x00,0x00,0x1e,0xff,0xfb,0x8f,
+0xff,0xf0,0x00,0x00,0x0b,0xff,0xfd,0x6f,0xff,0xf4,0x58,0x00,0x60,0x1f,0xff,0xfd,
+0x10,0x00,0x5f,0x68,0x00,0x81,0xff,0xfb,0x9c,0xff,0xff,0xf4,0x01,0xef,0x90,0x00,
+0x30,0xa0,0x00,0x1c,0x07,0x00,0x00,0xdc,0x00,0x50,0x4a,0xdf,0xff,0xc8,0x20,0x47,
+0x00,0x4e,0x0d,0xfa,0x00,0x00,0x08,0x00,0x42,0x4b,0xef,0xea,0x30,0x10,0x00,0x52,
+0x07,0xff,0xff,0xff,0xf5,0x0b,0x00,0xf0,0x24,0x2f,0xff,0xc9,0xdf,0xfe,0x00,0x00,
+0x07,0x10,0x00,0x00,0x6f,0xfb,0x00,0x0d,0xff,0x40,0x00,0x8f,0xf2,0x00,0x00,0x8f,
+0xf7,0x00,0x0a,0xff,0x50,0x03,0xff,0xb0,0x00,0x00,0x7f,0xf8,0x00,0x0b,0xff,0x50,
+0x0d,0xfe,0x10,0x00,0x00,0x5f,0xfe,0x30,0x4f,0xff,0x20,0x8f,0x3a,0x00,0x00,0xbc,
+0x01,0x21,0xfb,0x03,0xe1,0x00,0x50,0x02,0xdf,0xff,0xff,0xb1,0x20,0x00,0x00,0x32,
+0x01,0x42,0x78,0x73,0x00,0x9f,0x5a,0x00,0x00,0x0e,0x00,0x24,0xff,0xa0,0x0b,0x00,
+0x61,0x0e,0xfe,0x10,0x48,0x87,0x20,0x0b,0x00,0x32,0x9f,0xf5,0x2d,0xaf,0x00,0x00,
+0x20,0x00,0x00,0x5b,0x01,0xc0,0x80,0x00,0x00,0x00,0x1e,0xfe,0x15,0xff,0xe3,0x07,
+0xff,0xf0,0x53,0x02,0x71,0xf5,0x09,0xff,0x70,0x00,0xdf,0xf3,0x20,0x00,0x60,0x0a,
+0xff,0x50,0x00,0xcf,0xf3,0x20,0x00,0x40,0x10,0x09,0xff,0x60,0x0b,0x00,0x00,0x60,
+0x00,0xf2,0x02,0x07,0xff,0xb0,0x01,0xff,0xf1,0x00,0x00,0x19,0xa0,0x00,0x02,0xff,
+0xfc,0x9e,0xff,0xc0,0x65,0x00,0x53,0x7f,0xff,0xff,0xfe,0x20,0x7b,0x00,0xa1,0xbe,
+0xfe,0x91,0x00,0x00,0x00,0x18,0xcf,0xfe,0xa3,0x10,0x00,0x40,0x03,0xef,0xff,0xff,
+0x8e,0x02,0x00,0xaa,0x01,0x04,0xfd,0x00,0x61,0x9f,0xff,0xfb,0xae,0xff,0xfd,0xbd,
+0x02,0x52,0xff,0x70,0x01,0xef,0xff,0xac,0x01,0x31,0x20,0x00,0xbf,0x0a,0x00,0x62,
+0xcf,0xff,0x50,0x02,0xff,0xfb,0x57,0x00,0x41,0xd0,0x5e,0xff,0xf3,0xc6,0x00,0x52,
+0xff,0xfe,0xff,0xff,0x50,0xbb,0x00,0x01,0x13,0x02,0x02,0x0a,0x00,0x12,0xfd,0x74,
+0x00,0x11,0x8f,0x63,0x00,0xf0,0x17,0xaf,0xff,0x30,0x08,0xff,0xff,0xdf,0xff,0xf6,
+0x00,0xcf,0xff,0x20,0x3f,0xff,0xf6,0x0c,0xff,0xff,0x50,0xff,0xff,0x00,0xaf,0xff,
+0xd0,0x01,0xdf,0xff,0xf9,0xff,0xfd,0x00,0xdf,0xff,0xa0,0x00,0x2e,0xf7,0x02,0xe1,
+0x00,0xdf,0xff,0xd0,0x00,0x02,0xff,0xff,0xff,0xf1,0x00,0xaf,0xff,0xf7,0x40,0x00,
+0x10,0x70,0x65,0x02,0x83,0xda,0xad,0xff,0xff,0xff,0xc0,0x00,0x09,0xe0,0x02,0x12,
+0xf9,0x5a,0x00,0xf0,0x08,0xff,0xec,0xff,0xff,0x60,0x00,0x02,0x8c,0xef,0xfd,0xa5,
+0x00,0xdf,0xff,0xf3,0x0f,0xff,0x40,0xff,0xf4,0x0f,0xff,0x40,0x0a,0x00,0xa1,0x20,
+0xff,0xf0,0x0f,0xff,0x00,0xff,0xe0,0x08,0x86,0xeb,0x00,0x10,0xa0,0xb4,0x00,0x10,
+0xf3,0xe6,0x01,0x40,0xf6,0x00,0x00,0x4f,0x5f,0x01,0x20,0xef,0xfa,0xd4,0x02,0x10,
+0xf1,0xfd,0x00,0x10,0x80,0xd0,0x00,0x80,0x10,0x00,0x00,0xdf,0xfc,0x00,0x00,0x02,
+0x76,0x00,0x10,0x06,0x5f,0x02,0x10,0x0a,0x1d,0x00,0x10,0x0d,0x7f,0x01,0x10,0x0e,
+0x89,0x02,0x3d,0x0f,0xff,0xc0,0x05,0x00,0x01,0x19,0x00,0x01,0x23,0x00,0x01,0x2d,
+0x00,0x01,0x37,0x00,0x30,0x03,0xff,0xf7,0x34,0x01,0x10,0xfb,0xfd,0x00,0x00,0x55,
+0x00,0x10,0x1f,0x63,0x01,0x80,0x09,0xff,0xe0,0x00,0x00,0x01,0xef,0xf9,0x6c,0x03,
+0x20,0xff,0x60,0x79,0x00,0x10,0xf5,0x20,0x00,0x10,0xf4,0x2c,0x01,0x12,0xc0,0x5f,
+0x03,0x10,0x60,0x9a,0x03,0x11,0xfa,0x13,0x03,0x10,0xb0,0x42,0x01,0x11,0xf9,0x66,
+0x01,0x40,0x30,0x00,0x00,0x0d,0x65,0x00,0x30,0x05,0xff,0xf6,0x56,0x00,0x11,0xfd,
+0xa3,0x01,0x13,0x30,0xc3,0x00,0x12,0x1f,0x84,0x00,0x10,0xf0,0x0b,0x03,0x10,0xf3,
+0x84,0x00,0x10,0xf5,0x6a,0x00,0x10,0xf6,0x5f,0x00,0x13,0xf8,0x05,0x00,0x30,0x09,
+0xff,0xf7,0x19,0x00,0x10,0xf6,0x36,0x03,0x10,0xf4,0x4c,0x00,0x10,0xf1,0xbb,0x00,
+0x10,0xe0,0x41,0x00,0x40,0x90,0x00,0x00,0x8f,0x84,0x04,0x20,0xdf,0xfd,0x6f,0x00,
+0x10,0xf7,0x45,0x00,0x10,0xe0,0x9f,0x00,0x50,0x40,0x00,0x03,0xff,0xfa,0x05,0x03,
+0x22,0xc0,0x00,0x28,0x04,0x35,0x0a,0x70,0x00,0x01,0x00,0x10,0x01,0x24,0x00,0x00,
+0xaa,0x00,0x03,0xe0,0x01,0x01,0x67,0x02,0xf0,0x09,0x51,0x00,0x0e,0xfc,0x00,0x01,
+0x20,0x0f,0xfb,0x40,0xdf,0xb0,0x4a,0xfa,0x05,0xff,0xff,0xee,0xfd,0xdf,0xff,0xf0,
+0x28,0xdf,0xa2,0x01,0x70,0xea,0x10,0x00,0x16,0xef,0xff,0xc7,0x83,0x02,0x12,0x6f,
+0x15,0x02,0x50,0x3f,0xfe,0x9f,0xfa,0x00,0xce,0x03,0x21,0x50,0xdf,0x75,0x00,0x20,
+0xb0,0x04,0x9a,0x00,0x50,0x3d,0xf1,0x00,0x09,0xfa,0xaa,0x01,0x31,0x00,0x00,0x15,
+0x5a,0x00,0x33,0x25,0x55,0x40,0x98,0x03,0x14,0xfd,0xca,0x02,0x1f,0xd0,0x11,0x00,
+0x11,0x14,0x01,0x42,0x05,0x13,0x1f,0x09,0x00,0x1c,0x71,0x11,0x00,0x1f,0x70,0x55,
+0x00,0x1f,0x00,0x0f,0x03,0x04,0x03,0x00,0x50,0xfe,0x00,0xef,0xfc,0x02,0x30,0x06,
+0xf0,0x00,0xf2,0x1f,0xff,0x80,0x2b,0xfb,0x00,0x00,0x30,0x00,0x29,0x99,0x99,0x99,
+0x94,0x0b,0x05,0x16,0xf8,0x05,0x00,0xa0,0x00,0x8b,0x81,0x00,0xbf,0xff,0xb0,0x0f,
+0xff,0xff,0xd4,0x02,0x32,0x02,0xcf,0xc3,0x38,0x01,0x01,0x2b,0x03,0x31,0x05,0xff,
+0xf0,0x29,0x06,0x1d,0xfa,0x13,0x00,0x22,0xbf,0xfa,0x90,0x03,0x11,0x40,0x25,0x06,
+0x02,0x13,0x00,0x18,0xf9,0x13,0x00,0x11,0xe0,0x88,0x03,0x07,0x13,0x00,0x18,0x07,
+0x13,0x00,0x36,0x2f,0xff,0x30,0x13,0x00,0x28,0xdf,0xf8,0x13,0x00,0x18,0xd0,0x13,
+0x00,0x11,0x20,0xd1,0x05,0x02,0x13,0x00,0x11,0xf7,0x7f,0x02,0x22,0x88,0x10,0xef,
+0x00,0x62,0x39,0xdf,0xfe,0xa5,0x00,0x00,0x69,0x03,0x40,0xd1,0x00,0x00,0xaf,0x08,
+0x00,0x40,0xfe,0x10,0x04,0xff,0x18,0x04,0x50,0xff,0xa0,0x0c,0xff,0xfe,0x0c,0x04,
+0x40,0xf1,0x1f,0xff,0xf7,0x80,0x00,0x40,0xf6,0x4f,0xff,0xf2,0x55,0x02,0x22,0xfa,
+0x6f,0x98,0x05,0x22,0xfc,0x7f,0x0c,0x03,0x2f,0xfd,0x8f,0x08,0x00,0x0c,0x04,0x28,
+0x00,0x04,0x38,0x00,0x03,0x48,0x00,0x14,0xf9,0x58,0x00,0x10,0x0b,0x68,0x00,0x80,
+0xaf,0xff,0xf1,0x04,0xff,0xff,0xfa,0xad,0xd0,0x05,0x12,0x9f,0x88,0x00,0x02,0x98,
+0x00,0x12,0xd2,0xa8,0x00,0x11,0xb6,0xb1,0x00,0xe0,0x02,0x7d,0x80,0x00,0x01,0x6c,
+0xff,0xf8,0x01,0x6b,0xff,0xff,0xff,0x85,0x1f,0x00,0x20,0xf8,0x6f,0x06,0x00,0x91,
+0x86,0xff,0xea,0x5f,0xff,0xf8,0x48,0x30,0x00,0x4d,0x05,0x10,0x0f,0x0d,0x03,0x0f,
+0x0b,0x00,0x3a,0x53,0x4a,0xdf,0xfe,0xb7,0x10,0xb9,0x06,0x52,0xfe,0x50,0x00,0x02,
+0xef,0x79,0x07,0x80,0x00,0xdf,0xff,0xfe,0xab,0xef,0xff,0xfd,0x96,0x06,0x80,0x00,
+0x01,0xdf,0xff,0xf3,0x0a,0xff,0xfe,0xde,0x01,0x50,0xff,0x50,0xdf,0xff,0xb0,0x7b,
+0x01,0x41,0xf5,0x02,0x33,0x31,0x22,0x05,0x02,0x78,0x06,0x13,0xbf,0x70,0x02,0x33,
+0x5f,0xff,0xf7,0x7c,0x06,0x11,0xfc,0x08,0x00,0x13,0x2e,0xb7,0x05,0x13,0x2e,0x29,
+0x00,0x10,0x2e,0x5c,0x00,0x0f,0x08,0x00,0x10,0x93,0x1e,0xff,0xff,0xd9,0x99,0x99,
+0x99,0x99,0x17,0xed,0x02,0x23,0xf2,0x7f,0x09,0x00,0x14,0x27,0x11,0x00,0x41,0x00,
+0x01,0x7b,0xef,0x3c,0x01,0x01,0x27,0x01,0x32,0xe5,0x00,0x08,0x18,0x00,0xc0,0x50,
+0x2f,0xff,0xff,0xda,0xae,0xff,0xff,0xe0,0x8f,0xff,0xf6,0xf8,0x01,0x40,0xf4,0x7b,
+0xbb,0x90,0x8f,0x00,0x22,0xf6,0x00,0xa8,0x07,0x00,0xac,0x04,0x00,0x18,0x00,0x61,
+0xe1,0x00,0x00,0x06,0x77,0x9d,0xf3,0x05,0x00,0xf1,0x06,0x13,0xd4,0xf9,0x06,0x13,
+0x91,0x08,0x00,0x11,0xfe,0xae,0x00,0x23,0x26,0xef,0x28,0x04,0x12,0x3f,0xd7,0x00,
+0x00,0x24,0x02,0x31,0x77,0x77,0x40,0xb4,0x07,0x30,0xef,0xff,0xb0,0xb6,0x04,0x10,
+0xfa,0xe0,0x05,0x00,0xe5,0x05,0x12,0x4f,0x78,0x00,0x23,0xe1,0x08,0xbb,0x08,0x00,
+0xb3,0x06,0x01,0x49,0x06,0x20,0x01,0x7c,0xd8,0x05,0x02,0x77,0x04,0x04,0x50,0x00,
+0x23,0x0a,0xff,0x09,0x00,0x13,0x5f,0x09,0x00,0x00,0xf2,0x07,0x13,0xe0,0x1a,0x00,
+0x02,0x09,0x00,0x13,0x4f,0x09,0x00,0x61,0x01,0xef,0xfe,0xaf,0xff,0xe0,0x1a,0x00,
+0x41,0xf4,0x9f,0xff,0xe0,0x1a,0x00,0x22,0xa0,0x9f,0x89,0x05,0x20,0xfe,0x10,0x09,
+0x00,0x00,0x1a,0x00,0x22,0x00,0x9f,0x0e,0x05,0x11,0xa0,0x09,0x00,0x00,0x1a,0x00,
+0x01,0x09,0x00,0xa4,0x0a,0xff,0xfc,0x99,0x99,0xdf,0xff,0xf9,0x94,0x1f,0x3e,0x04,
+0x1d,0x0f,0x09,0x00,0x02,0xba,0x07,0x03,0x90,0x00,0x0f,0x09,0x00,0x0e,0x11,0x8f,
+0x35,0x00,0x34,0xf4,0x00,0x0a,0xe7,0x00,0x13,0xcf,0x11,0x00,0x70,0x0e,0xff,0xfc,
+0xbb,0xbb,0xbb,0xbb,0xa9,0x02,0x13,0x10,0x03,0x02,0x13,0xf0,0x46,0x07,0x03,0x83,
+0x04,0x60,0x6f,0xff,0xc7,0xce,0xfd,0xa3,0xb2,0x03,0x03,0xfc,0x06,0x12,0xaf,0x09,
+0x00,0x00,0x0e,0x03,0x30,0x96,0x6a,0xff,0x3c,0x03,0x73,0x47,0x10,0x00,0x06,0xff,
+0xff,0x90,0x6c,0x01,0x14,0xfd,0x78,0x00,0x13,0xf0,0xbb,0x09,0x50,0xff,0x02,0x88,
+0x88,0x10,0x38,0x00,0x50,0xe0,0x3f,0xff,0xf6,0x00,0x73,0x00,0x40,0x00,0xef,0xff,
+0xe2,0x19,0x00,0xb3,0x70,0x07,0xff,0xff,0xfb,0x9d,0xff,0xff,0xe1,0x00,0x0b,0x90,
+0x00,0x02,0x67,0x00,0x30,0xe4,0x00,0x00,0x59,0x07,0x22,0xeb,0x61,0x2b,0x08,0x21,
+0x8c,0xef,0xa7,0x06,0x22,0x3c,0xff,0x9f,0x02,0x11,0x7f,0x8e,0x07,0x01,0xd5,0x00,
+0x21,0xfd,0xb8,0x8e,0x01,0x22,0xfd,0x50,0x0d,0x08,0x02,0x5e,0x09,0x61,0x06,0xff,
+0xfd,0x03,0x78,0x85,0x32,0x08,0x11,0x8b,0x1f,0x03,0x03,0x47,0x01,0x23,0x60,0x04,
+0x3d,0x01,0xd0,0x20,0x5f,0xff,0xff,0x92,0x03,0xcf,0xff,0xf9,0x06,0xff,0xff,0x70,
+0xb4,0x05,0x41,0xe0,0x7f,0xff,0xf1,0x7b,0x00,0x11,0x16,0x07,0x01,0x61,0x5f,0xff,
+0xf3,0x5f,0xff,0xf3,0x28,0x03,0x11,0x33,0x6c,0x02,0x60,0x7f,0xff,0xf1,0x0f,0xff,
+0xfb,0x41,0x02,0x50,0xfe,0x00,0x9f,0xff,0xf5,0xaf,0x09,0x60,0x80,0x02,0xff,0xff,
+0xfc,0x9c,0xbb,0x00,0x23,0x05,0xff,0xc1,0x08,0x23,0x04,0xef,0xbb,0x00,0x74,0x00,
+0x7b,0xef,0xec,0x60,0x00,0x00,0xac,0x01,0x1e,0xf0,0x09,0x00,0x20,0x09,0x99,0x01,
+0x00,0x12,0xef,0x34,0x01,0x00,0x73,0x08,0x13,0x20,0x61,0x02,0x14,0xfa,0x05,0x0a,
+0x14,0xf3,0x46,0x01,0x13,0xc0,0xfb,0x06,0x23,0xff,0x40,0x4f,0x01,0x02,0x60,0x01,
+0x00,0xa9,0x04,0x04,0xe6,0x08,0x03,0xea,0x01,0x02,0xb9,0x09,0x01,0x4d,0x0a,0x22,
+0x10,0x00,0x11,0x01,0x14,0xf9,0xc4,0x01,0x23,0xf2,0x00,0xfa,0x0a,0x13,0xb0,0x23,
+0x01,0x03,0x02,0x04,0x13,0x0d,0xf2,0x03,0x24,0x00,0x5f,0x80,0x0a,0x34,0xdf,0xff,
+0xe0,0x47,0x09,0x03,0x7b,0x07,0x12,0x5a,0x6d,0x04,0x12,0x2d,0xe7,0x00,0x03,0xe6,
+0x0a,0x70,0x50,0x09,0xff,0xff,0xfb,0xad,0xff,0x89,0x0c,0x00,0x2e,0x05,0x00,0xf6,
+0x08,0x10,0xf9,0x72,0x03,0x22,0xf5,0x0e,0x08,0x00,0x22,0xf4,0x09,0xae,0x05,0x31,
+0xe0,0x01,0xef,0x28,0x00,0x32,0x50,0x00,0x2c,0xf2,0x03,0x02,0xe2,0x01,0x23,0xb1,
+0x00,0x83,0x02,0xc0,0x30,0x0a,0xff,0xff,0x71,0x14,0xdf,0xff,0xe0,0x2f,0xff,0xf7,
+0xf8,0x00,0x40,0xf7,0x5f,0xff,0xf1,0x69,0x01,0x27,0xfb,0x7f,0x6e,0x0b,0x00,0x34,
+0x02,0x10,0x3f,0x6e,0x0b,0x42,0x8f,0xff,0xf9,0x0d,0x78,0x00,0x22,0xf2,0x03,0x4b,
+0x01,0x33,0x80,0x00,0x3d,0x10,0x03,0x00,0xa8,0x00,0x21,0xc7,0x10,0x9e,0x05,0x23,
+0xfd,0x92,0x94,0x03,0x00,0xc3,0x00,0x15,0xcf,0xaf,0x02,0x50,0xea,0xaf,0xff,0xff,
+0x40,0xb6,0x0b,0x41,0x01,0xdf,0xff,0xd0,0x58,0x00,0x31,0x4f,0xff,0xf2,0x16,0x06,
+0x31,0x0f,0xff,0xf7,0xaf,0x03,0x31,0x0d,0xff,0xf8,0xb8,0x02,0x01,0x56,0x06,0x11,
+0xf6,0xf6,0x0b,0x94,0x1f,0xff,0xff,0x61,0x04,0xdf,0xff,0xfa,0x09,0xfd,0x09,0x02,
+0xb8,0x00,0x10,0xf8,0xc8,0x00,0x11,0xfc,0xd1,0x02,0x31,0x04,0x55,0x20,0x43,0x06,
+0x05,0x51,0x05,0x00,0x5f,0x01,0x10,0x60,0xd8,0x01,0x10,0xaf,0xad,0x01,0x31,0x03,
+0xcc,0xef,0x26,0x03,0x13,0x04,0xa1,0x04,0x13,0x04,0x76,0x0c,0x41,0x04,0xff,0xdb,
+0x72,0x7d,0x0c,0x10,0xc2,0xa4,0x07,0x30,0x0f,0xff,0xff,0xb2,0x07,0x4f,0x01,0x8b,
+0x81,0x00,0x01,0x00,0x06,0x27,0x8b,0x80,0xd5,0x07,0x10,0x03,0xd5,0x07,0xff,0x02,
+0x5d,0xfa,0x00,0x1f,0xff,0xf9,0x04,0xff,0xff,0xb0,0x1e,0xff,0xf7,0x00,0x29,0xb6,
+0x00,0x01,0x00,0x09,0xf0,0x05,0x05,0xcc,0xc4,0x00,0x7f,0xff,0x50,0x07,0xff,0xf5,
+0x00,0x7f,0xff,0x40,0x08,0xff,0xf2,0x00,0xbf,0xfe,0x81,0x0a,0x9b,0x09,0xff,0xe1,
+0x00,0xbf,0xf5,0x00,0x00,0x45,0x30,0x00,0x21,0x04,0xa4,0x07,0x00,0x11,0x6d,0x7a,
+0x02,0x11,0x29,0x9e,0x03,0x20,0x05,0xcf,0x3e,0x04,0x20,0x01,0x7e,0xcb,0x00,0x20,
+0x91,0x1a,0x08,0x01,0x11,0xa4,0x31,0x0b,0x11,0xb5,0xb4,0x02,0x22,0xfd,0x30,0xcd,
+0x02,0x10,0xff,0x87,0x01,0x10,0x08,0x28,0x02,0x50,0xc6,0x10,0x00,0x00,0x5c,0x27,
+0x00,0x62,0xb2,0x00,0x00,0x03,0x9f,0xff,0xc5,0x02,0x23,0x17,0xdf,0xd0,0x05,0x13,
+0x4b,0xd4,0x02,0x41,0x02,0x83,0x8a,0xaa,0x01,0x00,0x12,0x0e,0x64,0x01,0x22,0xf1,
+0xef,0x08,0x00,0x13,0x1e,0x0f,0x00,0x0f,0xcf,0x00,0x03,0x12,0x08,0x34,0x00,0x1b,
+0xa0,0x2d,0x00,0x03,0x0f,0x00,0x33,0x10,0x1b,0x50,0x5c,0x03,0x22,0xe8,0x10,0x52,
+0x03,0x23,0xff,0xa4,0x9e,0x00,0x10,0xfd,0x04,0x0b,0x10,0xdf,0xcc,0x01,0x40,0x30,
+0x00,0x00,0x38,0x30,0x00,0x10,0xc3,0x36,0x02,0x12,0xef,0xf1,0x02,0x21,0x01,0xaf,
+0x4d,0x02,0x11,0x5b,0x3d,0x02,0x20,0x5a,0xff,0xad,0x01,0x01,0xfb,0x01,0x30,0xe7,
+0x10,0x02,0x63,0x0d,0x11,0x50,0x4b,0x00,0x11,0x92,0x4b,0x00,0x11,0xd6,0x62,0x00,
+0x80,0x1a,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x03,0x00,0x00,0x6b,0xef,0xfd,
+0xa5,0x00,0x00,0x04,0xef,0xff,0xff,0xff,0xfc,0x10,0x03,0xff,0xff,0x08,0x00,0xf0,
+0x17,0x00,0xbf,0xff,0xfe,0xbb,0xff,0xff,0xf5,0x1f,0xff,0xfc,0x00,0x04,0xff,0xff,
+0xa3,0xff,0xff,0x50,0x00,0x0d,0xff,0xfc,0x01,0x11,0x10,0x00,0x00,0xdf,0xff,0xb0,
+0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0x07,0x00,0x32,0x2e,0xff,0xfd,0x07,0x00,0x26,
+0xff,0x30,0x07,0x00,0x82,0x0c,0xff,0xfe,0x20,0x00,0x00,0x00,0x03,0x0e,0x00,0x40,
+0x00,0x7f,0xff,0xa0,0x07,0x00,0x40,0x08,0xff,0xf7,0x00,0x01,0x00,0x38,0x01,0x11,
+0x00,0x01,0x00,0x21,0x07,0xa7,0x07,0x00,0x31,0x0a,0xff,0xfa,0x08,0x00,0x30,0xff,
+0xff,0xf0,0x07,0x00,0x12,0x0d,0x58,0x00,0x42,0x00,0x3c,0xfc,0x20,0x27,0x00,0x63,
+0x03,0x8b,0xef,0xfe,0xc9,0x50,0x34,0x00,0x11,0x4d,0xa7,0x00,0x12,0xe7,0x4f,0x00,
+0x71,0xaf,0xff,0xfd,0xa8,0x8a,0xcf,0xff,0x29,0x00,0x91,0x01,0xdf,0xff,0x92,0x00,
+0x00,0x00,0x16,0xef,0x81,0x00,0x31,0xdf,0xfd,0x30,0x23,0x00,0x92,0xbf,0xfc,0x00,
+0x00,0x00,0xaf,0xfd,0x10,0x00,0x0e,0x00,0x53,0xf7,0x00,0x00,0x4f,0xff,0x57,0x00,
+0xf0,0x12,0x01,0xff,0xf1,0x00,0x0d,0xff,0x60,0x00,0x00,0x2a,0xef,0xeb,0x50,0x00,
+0x08,0xff,0x60,0x04,0xff,0xe0,0x00,0x00,0x6f,0xff,0xff,0xff,0xc1,0x00,0x2f,0xfb,
+0x00,0xaf,0xf7,0x0d,0x00,0xf0,0x1a,0xeb,0xdf,0xff,0x20,0x00,0xdf,0xf0,0x0f,0xff,
+0x20,0x00,0x1f,0xff,0x90,0x01,0xff,0xf0,0x00,0x0a,0xff,0x23,0xff,0xd0,0x00,0x0a,
+0xff,0xc0,0x00,0x3f,0xff,0x00,0x00,0x8f,0xf4,0x6f,0xfa,0x00,0x01,0xff,0xf5,0x00,
+0x3d,0x00,0xf2,0x2f,0x07,0xff,0x58,0xff,0x80,0x00,0x6f,0xff,0x00,0x00,0x5f,0xfc,
+0x00,0x00,0x7f,0xf5,0x9f,0xf7,0x00,0x09,0xff,0xd0,0x00,0x07,0xff,0xb0,0x00,0x07,
+0xff,0x4a,0xff,0x60,0x00,0xcf,0xfa,0x00,0x00,0x8f,0xfa,0x00,0x00,0x9f,0xf2,0xaf,
+0xf7,0x00,0x0d,0xff,0x90,0x00,0x09,0xff,0x80,0x00,0x0b,0xff,0x09,0xff,0x70,0x00,
+0xef,0xf9,0x9f,0x00,0xf0,0x19,0xff,0xc0,0x7f,0xfa,0x00,0x0c,0xff,0xc0,0x00,0x2f,
 0xff,0x60,0x00,0x6f,0xf7,0x04,0xff,0xd0,0x00,0x9f,0xff,0x40,0x1d,0xff,0xf9,0x00,
-0x2e,0xfe,0x10,0x1f,0xff,0x20,0x02,0x1b,0x0e,0x30,0xff,0xf9,0x9e,0x4e,0x00,0x01,
-0xd4,0x03,0x21,0xfe,0x2c,0xfa,0x01,0xb1,0x06,0xff,0xf2,0x00,0x06,0xdf,0xe9,0x10,
-0x08,0xef,0xea,0x07,0x0d,0x17,0xc1,0x68,0x01,0x37,0x3f,0xff,0xd2,0x0e,0x00,0x11,
-0x6f,0x48,0x02,0x34,0x01,0x52,0x00,0x1b,0x08,0x34,0xfd,0xbb,0xde,0x3b,0x05,0x14,
-0x1a,0x35,0x07,0x02,0x22,0x01,0x55,0x6a,0xde,0xff,0xec,0x83,0x39,0x00,0x16,0x9f,
-0xda,0x02,0x11,0xff,0xe0,0x09,0x03,0x3b,0x04,0x13,0xfe,0x0b,0x00,0x13,0x0c,0x30,
-0x03,0x02,0xbe,0x02,0x26,0xff,0xa0,0xd5,0x0e,0x14,0xf1,0xce,0x05,0x34,0x7e,0xff,
-0xf6,0xad,0x05,0x12,0x19,0xe7,0x01,0x00,0xd1,0x0a,0x04,0xe0,0x09,0x00,0xd1,0x0a,
-0x03,0x64,0x06,0x00,0xe1,0x06,0x03,0x92,0x07,0x11,0xdf,0x6b,0x01,0x12,0xf5,0x56,
-0x02,0x11,0x60,0x8f,0x07,0x01,0x73,0x0b,0x01,0xe0,0x0a,0x16,0x20,0xb7,0x06,0x13,
-0x80,0xa5,0x09,0x02,0xd2,0x08,0x13,0xcf,0x0b,0x00,0x10,0xf4,0x43,0x03,0x70,0xec,
-0xcc,0xcc,0xcc,0xcf,0xff,0xfb,0x2f,0x01,0x11,0x60,0x7b,0x09,0x00,0xde,0x11,0x13,
-0xff,0x7c,0x06,0x10,0x70,0x7d,0x0a,0x02,0xb3,0x06,0x43,0xd0,0xbf,0xff,0xf4,0x18,
-0x05,0x11,0xf3,0x44,0x0b,0x24,0xca,0x50,0x5f,0x00,0x13,0xe4,0x38,0x12,0x00,0x34,
-0x0f,0x30,0xfe,0xbb,0xbc,0x49,0x09,0x10,0xff,0x0f,0x03,0x61,0x3e,0xff,0xff,0x3f,
-0xff,0xfb,0xb2,0x00,0x10,0xf6,0x11,0x00,0x00,0x5f,0x07,0x22,0x5f,0xff,0xd1,0x0e,
-0x10,0xf2,0x11,0x00,0x20,0x02,0x7f,0x1a,0x13,0x03,0x5d,0x03,0x02,0x08,0x00,0x14,
-0xfa,0x55,0x00,0xd1,0xfe,0x20,0xff,0xff,0xc5,0x55,0x56,0x9f,0xff,0xfe,0x1f,0xff,
-0xfb,0x74,0x09,0x10,0xf9,0x44,0x00,0x00,0x2a,0x01,0x32,0xdf,0xff,0xfb,0x4f,0x03,
-0x02,0x11,0x00,0x12,0xff,0x11,0x00,0xd3,0x01,0xbf,0xff,0xfa,0xff,0xff,0xeb,0xbb,
-0xbc,0xff,0xff,0xff,0x4f,0x91,0x00,0x14,0xa0,0x00,0x01,0x11,0x0f,0x53,0x00,0x11,
-0xb8,0x0d,0x03,0x43,0x7b,0xef,0xfd,0xa6,0xce,0x08,0x11,0xff,0xf5,0x00,0x12,0x0b,
-0x25,0x00,0x11,0x90,0x67,0x06,0x10,0xdd,0x33,0x02,0x10,0x04,0xde,0x06,0x00,0x33,
-0x01,0x21,0x10,0xcf,0xbe,0x07,0x10,0x6f,0xf5,0x0d,0x12,0xfa,0xde,0x01,0x12,0xb5,
-0x29,0x01,0x44,0x08,0xaa,0xa8,0x8f,0xda,0x07,0x14,0x09,0xf5,0x07,0x00,0x6b,0x0c,
-0x14,0x00,0x60,0x0a,0x14,0x10,0x1b,0x02,0x24,0xf2,0x00,0x3e,0x09,0x19,0x30,0xa1,
-0x07,0x32,0x78,0x88,0x62,0x0b,0x02,0x10,0x0f,0x4b,0x14,0x24,0xff,0x20,0x73,0x01,
-0x42,0xfe,0x40,0x00,0x06,0xb9,0x10,0x30,0xff,0xec,0xdf,0x4f,0x02,0x23,0x01,0xcf,
-0x1c,0x01,0x00,0x4e,0x00,0x04,0x32,0x0a,0x52,0x28,0xce,0xff,0xdb,0x61,0xb3,0x13,
-0x34,0xeb,0x71,0x00,0xbc,0x13,0x13,0x91,0x09,0x00,0x00,0x6c,0x04,0x50,0xff,0xff,
-0xeb,0xbc,0xef,0xd7,0x08,0x00,0x28,0x01,0x10,0x03,0xe5,0x01,0x01,0x31,0x01,0x11,
-0x0b,0xe0,0x13,0x11,0xb0,0x41,0x05,0x12,0xb0,0x43,0x01,0x32,0xbf,0xff,0xf0,0x09,
-0x00,0x10,0x8f,0xdd,0x01,0x11,0xb0,0xf2,0x00,0x12,0xf5,0x09,0x00,0x3b,0x5f,0xff,
-0xf6,0x09,0x00,0x05,0x1b,0x00,0x34,0x8f,0xff,0xf4,0x3f,0x00,0x14,0xf1,0x51,0x00,
-0x11,0xc0,0x09,0x00,0x02,0x98,0x11,0x01,0x75,0x00,0x14,0xfc,0x87,0x00,0x18,0xe2,
-0x99,0x00,0x12,0xff,0xa6,0x13,0x01,0xbd,0x00,0x00,0x3a,0x07,0x04,0x41,0x02,0x0e,
-0x08,0x00,0x10,0xeb,0xd4,0x0a,0x23,0xb2,0xff,0xed,0x08,0x0f,0x08,0x00,0x07,0x53,
-0xea,0xaa,0xaa,0xaa,0xa7,0x48,0x00,0x1e,0xfb,0x08,0x00,0x0f,0x40,0x00,0x0e,0x0c,
-0x08,0x00,0x01,0x78,0x00,0x1e,0xb3,0x98,0x00,0x09,0x08,0x00,0x12,0xdf,0x07,0x00,
-0x15,0xfd,0x0f,0x00,0x10,0xfe,0x36,0x00,0x13,0xb9,0x46,0x00,0x01,0x68,0x0a,0x06,
-0x55,0x00,0x0d,0x0f,0x00,0x01,0x01,0x00,0x13,0xb0,0xa3,0x00,0x06,0x0f,0x00,0x00,
-0x7a,0x00,0x1e,0xb8,0x3c,0x00,0x0f,0x0f,0x00,0x1f,0x11,0x00,0xa2,0x0d,0x13,0xc8,
-0x6e,0x06,0x00,0x65,0x00,0x24,0x20,0x00,0x37,0x0c,0x11,0xe2,0x4b,0x02,0x20,0xfc,
-0xce,0x61,0x13,0x10,0x03,0x52,0x02,0x00,0x3e,0x06,0x21,0x50,0x0a,0x38,0x07,0x00,
-0x18,0x02,0x11,0x0f,0xbb,0x04,0x00,0xe9,0x0b,0x15,0x4f,0xd0,0x04,0x13,0x6f,0x58,
-0x0a,0x00,0x4e,0x00,0x13,0xf4,0x0a,0x00,0x01,0x04,0x03,0x10,0xef,0x08,0x0b,0x06,
-0x0a,0x00,0x01,0x1e,0x00,0x01,0x0a,0x00,0x01,0x79,0x09,0x82,0x56,0x66,0xcf,0xff,
-0xf0,0x3f,0xff,0xf9,0x50,0x00,0x15,0xf0,0x5a,0x00,0x21,0xf0,0x0a,0xe6,0x0a,0x00,
-0x0a,0x00,0x50,0x02,0xff,0xff,0xf9,0x10,0x6e,0x07,0x10,0xf0,0xa9,0x00,0x10,0xfd,
-0x2f,0x02,0x14,0xf0,0xa4,0x13,0x00,0x6e,0x03,0x11,0x6e,0x09,0x00,0x10,0xb3,0x38,
-0x00,0x53,0x6a,0xdf,0xfe,0xda,0x62,0xeb,0x00,0x00,0xaa,0x00,0x32,0x8f,0xff,0xfb,
-0x56,0x05,0x1f,0xf8,0x13,0x00,0x31,0x03,0x01,0x00,0x14,0xf8,0x09,0x00,0x09,0x13,
-0x00,0x00,0x99,0x01,0x1f,0xbc,0x72,0x00,0x3d,0x04,0x13,0x00,0x3f,0xaf,0xff,0xf0,
-0x03,0x00,0x2c,0x03,0x69,0x06,0x1f,0xfe,0x08,0x00,0x5d,0x30,0x4d,0xdd,0xd5,0xd6,
-0x0b,0x11,0xfd,0x29,0x02,0x11,0x1f,0xca,0x02,0xb1,0x30,0x01,0xbf,0xff,0xf6,0x0a,
-0xff,0xff,0xfd,0xcf,0xff,0x36,0x0c,0x02,0xa9,0x0e,0x14,0x2c,0x10,0x0e,0x11,0x5a,
-0x74,0x11,0x02,0x05,0x01,0x31,0xcf,0xff,0xfd,0xe1,0x05,0x00,0x8f,0x02,0x10,0x20,
-0x13,0x00,0x00,0x77,0x05,0x11,0x40,0xc3,0x02,0x10,0x3f,0x8e,0x02,0x00,0x13,0x00,
-0x10,0x1e,0x27,0x05,0x00,0x13,0x00,0x10,0x0c,0x2e,0x0e,0x00,0x13,0x00,0x10,0x0a,
-0xd7,0x04,0x00,0x13,0x00,0x41,0x06,0xff,0xff,0xf3,0xfa,0x02,0x12,0xb3,0x79,0x16,
-0x42,0x0f,0xff,0xfc,0xdf,0xb1,0x02,0x02,0x4f,0x03,0x05,0x69,0x03,0x15,0x60,0x66,
-0x04,0x02,0x18,0x07,0x21,0xfc,0xaf,0x2d,0x07,0x11,0xff,0xc2,0x0e,0x10,0xf7,0x13,
-0x00,0x01,0x9e,0x12,0x12,0xf2,0x98,0x00,0x10,0x09,0x34,0x18,0x01,0x85,0x00,0x10,
-0x1e,0xa5,0x02,0x00,0x49,0x00,0x00,0x10,0x10,0x12,0x30,0x5b,0x03,0x00,0x0c,0x0c,
-0x00,0x13,0x00,0x00,0x41,0x0d,0x11,0xf8,0x13,0x00,0x00,0xdb,0x06,0x1e,0xf3,0xac,
-0x03,0x0f,0x0f,0x00,0x64,0x01,0xbc,0x04,0x13,0x7f,0x51,0x07,0x03,0xc0,0x02,0x16,
-0xaf,0x0f,0x00,0x11,0x50,0x42,0x0c,0x03,0x70,0x04,0x02,0x68,0x08,0x06,0x9d,0x0b,
-0x17,0x1f,0x95,0x10,0x14,0x7f,0x9c,0x07,0x01,0x6b,0x08,0x05,0x3e,0x01,0x03,0xaf,
-0x0d,0x30,0xbf,0xff,0x80,0xd5,0x06,0x10,0xfb,0x0c,0x00,0x30,0x6f,0xff,0xe0,0x04,
-0x02,0x10,0xf6,0x0c,0x00,0x12,0x6a,0x8e,0x0d,0x10,0xa6,0x0c,0x00,0x30,0x64,0xff,
-0xfa,0x2f,0x01,0x11,0x47,0xc0,0x0d,0x00,0x06,0x18,0x31,0xff,0xfe,0x07,0x91,0x07,
+0x2e,0xfe,0x10,0x1f,0xff,0x20,0x02,0xff,0xff,0xdf,0xff,0xff,0xf9,0x9e,0x4e,0x00,
+0xf0,0x09,0xf8,0x00,0x08,0xff,0xff,0xfe,0x2c,0xff,0xff,0xff,0x70,0x00,0x06,0xff,
+0xf2,0x00,0x06,0xdf,0xe9,0x10,0x08,0xef,0xea,0x30,0x44,0x01,0x17,0xc1,0x68,0x01,
+0x37,0x3f,0xff,0xd2,0x0e,0x00,0x82,0x6f,0xff,0xf9,0x30,0x00,0x00,0x01,0x52,0x0e,
+0x00,0x82,0x5f,0xff,0xff,0xfd,0xbb,0xde,0xff,0x70,0x0e,0x00,0x11,0x1a,0x5e,0x01,
+0x23,0xf9,0x00,0x22,0x01,0x55,0x6a,0xde,0xff,0xec,0x83,0x39,0x00,0x34,0x9f,0xff,
+0xf1,0x0b,0x00,0x33,0xff,0xff,0xf8,0x0a,0x00,0x43,0x06,0xff,0xff,0xfe,0x0b,0x00,
+0x52,0x0c,0xff,0xff,0xff,0x40,0x0b,0x00,0x52,0x2f,0xff,0xff,0xff,0xa0,0x0b,0x00,
+0x34,0x8f,0xff,0xff,0x38,0x00,0x32,0xef,0xff,0x7e,0x3b,0x02,0x00,0x5a,0x02,0x13,
+0x19,0xe7,0x01,0x43,0x0b,0xff,0xfc,0x04,0x2e,0x02,0x72,0x1f,0xff,0xf7,0x00,0xef,
+0xff,0x90,0x39,0x02,0x32,0xf1,0x00,0x9f,0x10,0x02,0x11,0xdf,0x6b,0x01,0x12,0xf5,
+0x56,0x02,0x40,0x60,0x00,0x0e,0xff,0xd3,0x01,0x70,0x09,0xff,0xff,0x10,0x00,0x09,
+0xff,0xcc,0x01,0x22,0x0f,0xff,0x01,0x00,0x11,0x80,0xbd,0x01,0x00,0x01,0x00,0x00,
+0xc8,0x01,0x13,0xcf,0x0b,0x00,0xc0,0xf4,0x00,0x02,0xff,0xff,0xec,0xcc,0xcc,0xcc,
+0xcf,0xff,0xfb,0x2f,0x01,0x11,0x60,0x62,0x02,0x51,0xff,0x10,0x0e,0xff,0xff,0x83,
+0x02,0x62,0xff,0xff,0x70,0x5f,0xff,0xfa,0x10,0x02,0x52,0xff,0xd0,0xbf,0xff,0xf4,
+0x29,0x02,0x20,0xff,0xf3,0x3d,0x00,0x34,0xfe,0xca,0x50,0x5f,0x00,0x24,0xe4,0x00,
+0x51,0x00,0xa0,0x0f,0xff,0xfe,0xbb,0xbc,0xef,0xff,0xff,0xe0,0xff,0x0f,0x03,0x61,
+0x3e,0xff,0xff,0x3f,0xff,0xfb,0xb2,0x00,0x11,0xf6,0x11,0x00,0x61,0x05,0xff,0xff,
+0x5f,0xff,0xfb,0xf9,0x00,0x10,0xf2,0x11,0x00,0x43,0x02,0x7f,0xff,0xfa,0x44,0x00,
+0x13,0xfc,0x44,0x00,0x14,0xfa,0x55,0x00,0xb1,0xfe,0x20,0xff,0xff,0xc5,0x55,0x56,
+0x9f,0xff,0xfe,0x1f,0x33,0x00,0x30,0x4f,0xff,0xf9,0x44,0x00,0x00,0x2a,0x01,0x32,
+0xdf,0xff,0xfb,0x4f,0x03,0x02,0x11,0x00,0x12,0xff,0x11,0x00,0xd3,0x01,0xbf,0xff,
+0xfa,0xff,0xff,0xeb,0xbb,0xbc,0xff,0xff,0xff,0x4f,0x91,0x00,0x14,0xa0,0x00,0x01,
+0x11,0x0f,0x53,0x00,0x11,0xb8,0x0d,0x03,0x42,0x7b,0xef,0xfd,0xa6,0x7a,0x03,0x21,
+0xff,0xff,0xf5,0x00,0x12,0x0b,0x25,0x00,0x70,0x90,0x00,0x0a,0xff,0xff,0xff,0xdd,
+0x33,0x02,0x41,0x04,0xff,0xff,0xe5,0x33,0x01,0x41,0x10,0xcf,0xff,0xf3,0x18,0x02,
+0x42,0xf7,0x1f,0xff,0xfa,0xde,0x01,0x12,0xb5,0x29,0x01,0x41,0x08,0xaa,0xa8,0x8f,
+0x1c,0x00,0x02,0x72,0x01,0x03,0x39,0x03,0x14,0xaf,0xd0,0x01,0x10,0x0a,0x85,0x01,
+0x03,0x1b,0x02,0x33,0xf2,0x00,0x00,0x70,0x00,0x14,0x30,0x59,0x02,0x10,0xf5,0x07,
+0x00,0x32,0x78,0x88,0x62,0x0b,0x02,0x41,0x0f,0xff,0xfb,0x0c,0x43,0x00,0x02,0x73,
+0x01,0x40,0xfe,0x40,0x00,0x06,0x19,0x02,0x50,0xaf,0xff,0xff,0xec,0xdf,0x4f,0x02,
+0x23,0x01,0xcf,0x1c,0x01,0x00,0x4e,0x00,0x22,0xff,0xff,0x32,0x04,0x61,0x28,0xce,
+0xff,0xdb,0x61,0x00,0x37,0x01,0x43,0xeb,0x71,0x00,0x00,0x40,0x01,0x13,0x91,0x09,
+0x00,0x00,0x6c,0x04,0x30,0xff,0xff,0xeb,0x8d,0x01,0x20,0xe1,0x00,0x28,0x01,0x10,
+0x03,0xe5,0x01,0x00,0x31,0x01,0x00,0xef,0x00,0x10,0x40,0x09,0x00,0x00,0xfe,0x01,
+0x12,0xb0,0x43,0x01,0x32,0xbf,0xff,0xf0,0x09,0x00,0x10,0x8f,0xdd,0x01,0x11,0xb0,
+0xf2,0x00,0x12,0xf5,0x09,0x00,0x3b,0x5f,0xff,0xf6,0x09,0x00,0x05,0x1b,0x00,0x34,
+0x8f,0xff,0xf4,0x3f,0x00,0x14,0xf1,0x51,0x00,0x10,0xc0,0x09,0x00,0x00,0xef,0x02,
+0x13,0x50,0x75,0x00,0x14,0xfc,0x87,0x00,0x18,0xe2,0x99,0x00,0x00,0x01,0x00,0x13,
+0xa1,0xbd,0x00,0x35,0x72,0x00,0x00,0x41,0x02,0x0e,0x08,0x00,0x72,0xeb,0xbb,0xbb,
+0xbb,0xbb,0xb2,0xff,0x5f,0x05,0x1f,0x00,0x08,0x00,0x07,0x53,0xea,0xaa,0xaa,0xaa,
+0xa7,0x48,0x00,0x1e,0xfb,0x08,0x00,0x0f,0x40,0x00,0x0e,0x0c,0x08,0x00,0x01,0x78,
+0x00,0x1e,0xb3,0x98,0x00,0x09,0x08,0x00,0x12,0xdf,0x07,0x00,0x15,0xfd,0x0f,0x00,
+0x10,0xfe,0x36,0x00,0x12,0xb9,0x46,0x00,0x00,0xd7,0x01,0x08,0x55,0x00,0x0d,0x0f,
+0x00,0x01,0x01,0x00,0x13,0xb0,0xa3,0x00,0x06,0x0f,0x00,0x00,0x7a,0x00,0x1e,0xb8,
+0x3c,0x00,0x0f,0x0f,0x00,0x1f,0x01,0xec,0x02,0x23,0xfe,0xc8,0x6e,0x06,0x00,0x65,
+0x00,0x11,0x20,0x99,0x02,0x00,0x01,0x00,0x11,0xe2,0x4b,0x02,0x50,0xfc,0xce,0xff,
+0xff,0xfd,0x3c,0x04,0x11,0xf7,0x3e,0x06,0x20,0x50,0x0a,0x2f,0x05,0x01,0x18,0x02,
+0x32,0x0f,0xff,0xfe,0xd0,0x02,0x25,0xe0,0x4f,0xd0,0x04,0x12,0x6f,0xb7,0x02,0x01,
+0x4e,0x00,0x13,0xf4,0x0a,0x00,0x01,0x04,0x03,0x00,0x26,0x07,0x16,0xf0,0x0a,0x00,
+0x01,0x1e,0x00,0x01,0x0a,0x00,0x10,0x6f,0xd4,0x04,0x82,0x56,0x66,0xcf,0xff,0xf0,
+0x3f,0xff,0xf9,0x50,0x00,0x15,0xf0,0x5a,0x00,0x21,0xf0,0x0a,0x99,0x04,0x00,0x0a,
+0x00,0x50,0x02,0xff,0xff,0xf9,0x10,0x6e,0x07,0x10,0xf0,0xa9,0x00,0x10,0xfd,0x2f,
+0x02,0x10,0xf0,0x56,0x03,0x04,0xa2,0x03,0x11,0x6e,0x09,0x00,0x10,0xb3,0x38,0x00,
+0x53,0x6a,0xdf,0xfe,0xda,0x62,0xeb,0x00,0x00,0xaa,0x00,0x32,0x8f,0xff,0xfb,0x56,
+0x05,0x1f,0xf8,0x13,0x00,0x31,0x03,0x01,0x00,0x14,0xf8,0x09,0x00,0x09,0x13,0x00,
+0x00,0x99,0x01,0x1f,0xbc,0x72,0x00,0x3d,0x04,0x13,0x00,0x3f,0xaf,0xff,0xf0,0x03,
+0x00,0x2c,0x03,0x69,0x06,0x1f,0xfe,0x08,0x00,0x5d,0x81,0x4d,0xdd,0xd5,0x00,0x00,
+0x0e,0xff,0xfd,0x29,0x02,0x11,0x1f,0xca,0x02,0xe0,0x30,0x01,0xbf,0xff,0xf6,0x0a,
+0xff,0xff,0xfd,0xcf,0xff,0xff,0xe0,0x01,0x0b,0x02,0x00,0xff,0x06,0x12,0x2c,0x2d,
+0x06,0x64,0x00,0x00,0x5a,0xdf,0xfe,0xb6,0xc3,0x01,0x31,0xcf,0xff,0xfd,0xe1,0x05,
+0x00,0x8f,0x02,0x10,0x20,0x13,0x00,0x00,0x77,0x05,0x11,0x40,0xc3,0x02,0x10,0x3f,
+0x8e,0x02,0x00,0x13,0x00,0x40,0x1e,0xff,0xff,0xa0,0xd6,0x02,0x00,0x58,0x04,0x11,
+0xc0,0x39,0x00,0x10,0x0a,0xd7,0x04,0x00,0x13,0x00,0x41,0x06,0xff,0xff,0xf3,0xfa,
+0x02,0x41,0xb3,0xff,0xff,0xf5,0xfc,0x02,0x22,0xfc,0xdf,0xb1,0x02,0x02,0x4f,0x03,
+0x05,0x69,0x03,0x15,0x60,0x66,0x04,0x02,0x18,0x07,0x21,0xfc,0xaf,0x2d,0x07,0x00,
+0x7a,0x06,0x30,0xef,0xff,0xf7,0x13,0x00,0x61,0xfe,0x10,0x04,0xff,0xff,0xf2,0x98,
+0x00,0x00,0x7c,0x02,0x12,0xd0,0x48,0x03,0x10,0x1e,0xa5,0x02,0x01,0x49,0x00,0x42,
+0x4f,0xff,0xff,0x30,0x5b,0x03,0x32,0xaf,0xff,0xfd,0x13,0x00,0x41,0x01,0xef,0xff,
+0xf8,0x13,0x00,0x00,0xdb,0x06,0x1e,0xf3,0xac,0x03,0x0f,0x0f,0x00,0x64,0x01,0xbc,
+0x04,0x13,0x7f,0x51,0x07,0x03,0xc0,0x02,0x16,0xaf,0x0f,0x00,0x22,0x50,0x00,0xb1,
+0x00,0x04,0x21,0x01,0x04,0x01,0x07,0x12,0xf1,0x69,0x08,0x15,0xff,0x63,0x06,0x14,
+0x7f,0x9c,0x07,0x01,0x6b,0x08,0x05,0x3e,0x01,0x12,0x03,0x0a,0x00,0x30,0xbf,0xff,
+0x80,0xd5,0x06,0x10,0xfb,0x0c,0x00,0x30,0x6f,0xff,0xe0,0x04,0x02,0x10,0xf6,0x0c,
+0x00,0x30,0x6a,0xff,0xf4,0x2d,0x01,0x10,0xa6,0x0c,0x00,0x30,0x64,0xff,0xfa,0x2f,
+0x01,0x20,0x47,0xff,0x56,0x07,0x71,0xef,0xff,0x00,0x00,0xff,0xfe,0x07,0x91,0x07,
 0x71,0x8f,0xff,0x50,0x06,0xff,0xf8,0x08,0x0c,0x00,0x71,0x2f,0xff,0xb0,0x0b,0xff,
-0xf2,0x09,0x84,0x07,0x10,0x0c,0x14,0x14,0x21,0xc0,0x0a,0xbd,0x07,0x60,0x06,0xff,
-0xf7,0x7f,0xff,0x60,0x0c,0x00,0x00,0x93,0x18,0x32,0xfd,0xdf,0xff,0xa9,0x00,0x10,
-0xb0,0x19,0x07,0x14,0xfa,0x0c,0x00,0x10,0x4f,0xc8,0x08,0x03,0x0c,0x00,0x10,0x0e,
-0xdf,0x08,0x03,0x0c,0x00,0x10,0x09,0xb8,0x01,0x03,0x0c,0x00,0x10,0x03,0xb7,0x00,
-0x03,0x0c,0x00,0x01,0x9d,0x17,0x01,0x0c,0x00,0x15,0xe1,0xf5,0x03,0x14,0xa0,0x96,
-0x03,0x24,0xff,0x40,0x13,0x00,0x15,0xfe,0x13,0x00,0x15,0xf8,0x1b,0x04,0x14,0xf3,
-0x13,0x00,0x22,0xff,0xc0,0x13,0x00,0x10,0xfe,0xa1,0x02,0x01,0x13,0x00,0x42,0xba,
-0xff,0xff,0x10,0xcf,0x03,0x00,0xcd,0x02,0x02,0xe2,0x03,0x33,0x6f,0xff,0xf5,0xe2,
-0x03,0x32,0xcf,0xff,0xe1,0x13,0x00,0x42,0x02,0xff,0xff,0x92,0x13,0x00,0x10,0x08,
-0x0b,0x09,0x01,0x08,0x04,0x33,0x0d,0xff,0xfe,0x08,0x04,0x12,0x4f,0x67,0x04,0x12,
-0xb0,0x98,0x11,0x11,0x8f,0xd5,0x08,0x14,0xef,0x13,0x00,0x14,0x05,0x13,0x00,0x00,
-0xbd,0x00,0x03,0x41,0x04,0x15,0x2f,0x41,0x04,0x11,0x7f,0xf4,0x02,0x12,0x6b,0x90,
-0x13,0x03,0x30,0x05,0x14,0xe6,0x7f,0x15,0x01,0xe1,0x00,0x00,0xd4,0x00,0x00,0x4d,
-0x00,0x00,0xba,0x00,0x42,0xf8,0x10,0x01,0x7f,0xaf,0x0f,0x11,0x70,0xa6,0x0a,0x42,
-0xb0,0x1f,0xff,0xfd,0x97,0x19,0x13,0xf1,0x3f,0x14,0x62,0x6f,0xff,0xf6,0x8f,0xff,
-0xf4,0x21,0x0b,0x13,0xf8,0xc2,0x08,0x10,0x1f,0x6b,0x13,0x13,0xf1,0x6a,0x02,0x06,
-0x0a,0x00,0x06,0x1e,0x00,0x05,0x32,0x00,0x16,0xf9,0x46,0x00,0x05,0x5a,0x00,0x11,
-0xf2,0x6e,0x00,0x00,0xc7,0x00,0x11,0xc0,0x82,0x00,0x23,0x00,0x7f,0xa3,0x13,0x10,
-0xfd,0xb4,0x0b,0x08,0xaa,0x00,0x26,0x00,0x5e,0x16,0x13,0x00,0xd2,0x00,0x13,0x10,
-0xb9,0x03,0x04,0xee,0x08,0x01,0xcd,0x03,0x05,0xc0,0x19,0x00,0xc2,0x0a,0x10,0xcd,
-0x13,0x00,0x01,0x13,0x01,0x14,0x09,0x7c,0x0a,0x24,0x00,0xbf,0x9d,0x08,0x1d,0x6f,
-0xc1,0x08,0x12,0x9f,0x1b,0x00,0x00,0x6e,0x09,0x14,0xf0,0x3f,0x00,0x2a,0x90,0xff,
-0x88,0x0a,0x22,0xff,0x90,0x09,0x00,0x26,0xeb,0x82,0x15,0x08,0x0f,0x09,0x00,0x2d,
-0x0f,0xa2,0x01,0x09,0x17,0x90,0xa2,0x01,0x11,0x03,0xa2,0x01,0x51,0x8f,0xff,0xff,
-0x30,0x0b,0xb8,0x04,0x02,0xa2,0x01,0x1a,0xfc,0xa2,0x01,0x33,0x7f,0xff,0xf5,0x80,
-0x0a,0x10,0x3f,0x3d,0x06,0x1a,0xf1,0xa2,0x01,0x0f,0x0a,0x00,0x04,0x06,0x32,0x00,
-0x05,0xa2,0x01,0x16,0xf5,0xfc,0x01,0x06,0x6e,0x00,0x14,0x03,0xa2,0x01,0x11,0x20,
-0x9a,0x13,0x11,0xdf,0x8f,0x01,0x15,0x09,0xf6,0x18,0x03,0x90,0x07,0x13,0x40,0xd2,
-0x00,0x06,0xf2,0x0c,0x11,0x7f,0x0e,0x12,0x21,0x00,0x00,0x3a,0x0f,0x13,0xe3,0x15,
-0x00,0x34,0x1c,0xfd,0x20,0xff,0x00,0x12,0x71,0x55,0x01,0x25,0xda,0x60,0xa6,0x0a,
-0x05,0xca,0x01,0x11,0xf7,0xb8,0x04,0x24,0xcd,0xff,0x06,0x06,0x11,0x2c,0x94,0x01,
-0x08,0x55,0x0a,0x00,0x2a,0x11,0x04,0x03,0x0c,0x02,0x09,0x00,0x10,0x04,0xe2,0x0b,
-0x00,0x48,0x0c,0x16,0x7e,0xb3,0x1e,0x1b,0xfa,0xc1,0x01,0x00,0xf2,0x00,0x00,0xe5,
-0x01,0x00,0xa9,0x10,0x00,0x8b,0x01,0x00,0xdc,0x10,0x02,0x09,0x00,0x10,0x0a,0x0a,
-0x05,0x01,0x3f,0x00,0x00,0xed,0x05,0x01,0x51,0x00,0x32,0x9f,0xff,0xf6,0x09,0x00,
-0x44,0x1f,0xff,0xfe,0x00,0x51,0x02,0x12,0x70,0xeb,0x05,0x05,0x5a,0x02,0x10,0x8f,
-0x0d,0x01,0x55,0x17,0xbd,0xff,0xec,0x72,0xbf,0x01,0x14,0x90,0x55,0x0d,0x10,0xfc,
-0x11,0x00,0x70,0xfe,0xcb,0xef,0xff,0xff,0x90,0x0f,0x4e,0x01,0x00,0x52,0x06,0x32,
-0x2f,0xff,0xfa,0x04,0x0d,0x11,0x2f,0x28,0x01,0x43,0x2b,0xbb,0xb5,0x0e,0xde,0x16,
-0x00,0x82,0x02,0x23,0xfa,0x30,0x39,0x0c,0x34,0xff,0xfe,0x94,0x3f,0x1e,0x02,0xc4,
-0x0f,0x24,0x19,0xef,0x08,0x1d,0x33,0x05,0xaf,0xff,0x3c,0x0c,0x00,0x82,0x11,0x42,
-0xd0,0x12,0x22,0x10,0xe1,0x02,0x31,0xef,0xff,0xd0,0x1a,0x0d,0x42,0xf7,0xbf,0xff,
-0xf2,0x09,0x00,0x40,0x6f,0xff,0xfd,0x30,0x35,0x1e,0x61,0xf5,0x0c,0xff,0xff,0xfd,
-0xba,0x7e,0x07,0x14,0xdf,0x28,0x16,0x02,0xab,0x00,0x10,0xd4,0x09,0x10,0x46,0xad,
-0xef,0xed,0xa5,0x13,0x0e,0x2f,0xff,0xf2,0x0a,0x00,0x01,0xa9,0x4b,0xbb,0xbb,0xbd,
-0xff,0xff,0xcb,0xbb,0xbb,0xb1,0xbc,0x0c,0x0f,0x0a,0x00,0x93,0x00,0xe3,0x02,0x02,
-0x4d,0x01,0x11,0x43,0x65,0x0a,0x00,0xb2,0x0a,0x0f,0x13,0x00,0x5f,0x14,0x2f,0x13,
-0x00,0x12,0x31,0xd9,0x04,0x10,0xaf,0xfe,0x21,0x10,0xfe,0x5d,0x19,0x00,0x7d,0x16,
-0x00,0x9c,0x11,0x40,0x2b,0xff,0xff,0x90,0x69,0x1c,0x20,0xdc,0xdf,0x7f,0x07,0x14,
-0x04,0x98,0x0f,0x02,0x17,0x21,0x02,0xfd,0x01,0x50,0x49,0xde,0xfe,0xda,0x50,0xef,
-0x01,0x13,0xf7,0x6b,0x0e,0x22,0xa5,0xff,0x49,0x16,0x10,0xdf,0x70,0x0f,0x21,0xff,
-0x10,0x08,0x06,0x31,0xfe,0x00,0xaf,0xff,0x08,0x00,0xce,0x16,0x12,0x04,0x6d,0x00,
-0x00,0xba,0x0e,0x02,0xca,0x0f,0x01,0xe2,0x03,0x10,0x9f,0x57,0x00,0x01,0x25,0x17,
-0x11,0x03,0xb0,0x02,0x12,0xbf,0x96,0x1e,0x11,0xfe,0x33,0x09,0x01,0xaf,0x00,0x10,
-0xf3,0x80,0x00,0x11,0x60,0x71,0x03,0x12,0x70,0x61,0x10,0x00,0x66,0x19,0x04,0x8b,
-0x17,0x41,0x6f,0xff,0xf1,0x03,0xf3,0x03,0x00,0x0a,0x03,0x13,0x60,0xa9,0x16,0x43,
-0x0b,0xff,0xfb,0x0d,0x13,0x11,0x10,0x5f,0xd3,0x0f,0x13,0x30,0xf1,0x04,0x13,0xcf,
-0x8d,0x1a,0x12,0x09,0x40,0x07,0x04,0x4e,0x19,0x14,0x20,0xec,0x10,0x25,0xff,0xc0,
-0xad,0x01,0x25,0xf6,0x00,0x17,0x11,0x14,0x10,0x1b,0x0f,0x11,0x01,0x2b,0x00,0x10,
-0x4f,0x9c,0x04,0x11,0xf8,0xf4,0x1a,0x00,0xb8,0x17,0x00,0x3c,0x01,0x11,0xfb,0x33,
-0x00,0x11,0x90,0x98,0x0c,0x01,0x10,0x1b,0x11,0x0c,0xdc,0x21,0x10,0xdf,0x2c,0x08,
-0x20,0xff,0x10,0xd7,0x09,0x10,0xf1,0x7f,0x00,0x11,0x70,0xaa,0x00,0x01,0x1a,0x08,
-0x00,0x6e,0x13,0x00,0x12,0x00,0x00,0xc8,0x04,0x10,0xf8,0x00,0x01,0x10,0x00,0x78,
-0x15,0x50,0x00,0xcf,0xff,0xef,0xfc,0x9c,0x19,0x02,0x73,0x17,0x00,0xcf,0x06,0x20,
-0x00,0x0d,0x6c,0x00,0x10,0x4f,0xe6,0x00,0x20,0xf7,0x6f,0xe9,0x09,0x10,0xf4,0x1a,
-0x01,0x82,0xf4,0x07,0xff,0xf3,0x2f,0xff,0x70,0x3f,0x2d,0x01,0x50,0xf7,0x0b,0xff,
-0xf0,0x0e,0xd9,0x07,0x10,0xd0,0xdb,0x00,0x20,0xfa,0x0f,0x88,0x0a,0x40,0xe0,0x9f,
-0xff,0x90,0xa4,0x00,0xa3,0xfe,0x3f,0xff,0x70,0x06,0xff,0xf2,0xcf,0xff,0x60,0x30,
-0x08,0x20,0x30,0x02,0x70,0x06,0x11,0x20,0xf0,0x00,0x64,0xef,0xfe,0x00,0x00,0xef,
-0xfc,0xf9,0x0c,0x24,0xff,0xfb,0x06,0x00,0x01,0x32,0x05,0x01,0x4d,0x13,0x02,0xde,
-0x01,0x13,0x3f,0x65,0x08,0x23,0xff,0xf3,0x22,0x0e,0x01,0x56,0x09,0x02,0xdb,0x0b,
-0x11,0x0c,0x7e,0x04,0x13,0x0a,0x3c,0x01,0x14,0x08,0xbc,0x07,0x11,0x80,0x36,0x00,
-0x11,0x30,0x10,0x02,0x21,0xf8,0x09,0x24,0x00,0x10,0x06,0x38,0x00,0x12,0xef,0x6c,
-0x17,0x20,0xff,0x40,0x54,0x19,0x00,0x68,0x00,0x11,0xfb,0x43,0x00,0x20,0x60,0x01,
-0xe4,0x0a,0x00,0xa2,0x00,0x10,0xe0,0xdb,0x04,0x02,0xcf,0x04,0x12,0x2f,0x03,0x06,
-0x10,0x0e,0xb9,0x01,0x15,0xf4,0x1d,0x0a,0x13,0xa0,0xef,0x11,0x06,0x4f,0x1a,0x24,
-0xff,0xf7,0x35,0x13,0x04,0x08,0x13,0x14,0xdf,0x99,0x04,0x12,0x07,0x17,0x09,0x02,
-0x41,0x0a,0x12,0xcf,0xd6,0x01,0x10,0xaf,0x5a,0x00,0x00,0xbc,0x22,0x12,0x04,0x6e,
-0x00,0x11,0xa0,0x5f,0x12,0x50,0x50,0x01,0xef,0xff,0xf3,0x77,0x00,0x10,0xfc,0x96,
-0x00,0x10,0xfd,0x8b,0x00,0x11,0xf3,0x19,0x00,0x21,0x70,0x0b,0x23,0x00,0x20,0x04,
-0xff,0xe4,0x06,0x12,0xff,0xe3,0x04,0x27,0xfb,0xbf,0x4b,0x00,0x22,0xfd,0x00,0x87,
-0x05,0x01,0xb9,0x05,0x00,0x5c,0x02,0x10,0x60,0x1c,0x06,0x08,0xe0,0x02,0x31,0x8f,
-0xff,0xf5,0x83,0x0c,0x00,0x74,0x01,0x12,0xc0,0x0c,0x04,0x12,0x07,0xb5,0x02,0x44,
-0xef,0xff,0xa0,0x0e,0x72,0x01,0x24,0xf2,0x5f,0x72,0x22,0x10,0xf9,0x30,0x22,0x02,
-0xaa,0x13,0x04,0x9e,0x02,0x02,0x8e,0x08,0x03,0xb2,0x02,0x15,0xf1,0xbe,0x13,0x15,
-0x80,0xb1,0x02,0x1f,0x40,0x0a,0x00,0x36,0x04,0x53,0x0b,0x1d,0xf3,0x09,0x00,0x20,
-0xf2,0x9b,0xc2,0x0b,0x14,0xbe,0x89,0x1b,0x14,0x3f,0x29,0x1a,0x13,0xdf,0x72,0x12,
-0x14,0x09,0xd1,0x19,0x02,0x4f,0x13,0x01,0x28,0x0a,0x14,0xe1,0xab,0x00,0x13,0x40,
-0x99,0x0f,0x12,0xf9,0x22,0x16,0x13,0xff,0x8c,0x03,0x14,0x1e,0xe2,0x00,0x13,0xaf,
-0x74,0x03,0x14,0x06,0x99,0x08,0x02,0xa5,0x01,0x02,0x52,0x04,0x04,0x5f,0x00,0x14,
-0x80,0x03,0x01,0x10,0xbb,0x01,0x00,0x24,0xb5,0xdf,0xa6,0x07,0x0e,0x09,0x00,0x86,
-0x07,0x77,0x77,0x74,0x2f,0xff,0xff,0xfa,0x04,0x00,0x2f,0xf6,0x00,0x04,0x00,0x4b,
-0x19,0xfa,0x70,0x00,0x38,0xcf,0xff,0xc0,0x07,0x1b,0x13,0x1f,0xf8,0x00,0x12,0xaf,
-0xa2,0x04,0x13,0x04,0xef,0x0c,0x13,0x0d,0x29,0x01,0x12,0x7f,0xae,0x0a,0x13,0x01,
-0xe2,0x00,0x13,0x0b,0xc7,0x0e,0x13,0x5f,0xfa,0x00,0x14,0xef,0x95,0x17,0x13,0xff,
-0x6a,0x18,0x02,0xf2,0x02,0x03,0xd0,0x04,0x04,0x64,0x00,0x01,0x20,0x1b,0x06,0x18,
-0x1d,0x01,0x7c,0x15,0x07,0x81,0x1b,0x0b,0x64,0x00,0x12,0x0a,0x64,0x00,0x00,0xd0,
-0x04,0x08,0xb9,0x1b,0x90,0x04,0x88,0x87,0x00,0x57,0x77,0x77,0x6c,0xff,0x30,0x03,
-0x50,0xff,0xfc,0xff,0xff,0xff,0x50,0x00,0x1f,0x09,0x07,0x00,0x3c,0x47,0x57,0xcf,
-0xff,0xfc,0x62,0x00,0x02,0x05,0x24,0x00,0x8c,0x00,0x22,0xf4,0x00,0x61,0x03,0x03,
-0x49,0x19,0x10,0x20,0xf5,0x00,0x30,0xcc,0xff,0x80,0x16,0x03,0x12,0x66,0xed,0x17,
-0x10,0x00,0x28,0x02,0xb0,0xdf,0xfa,0x00,0xaf,0xfd,0x00,0x04,0xff,0xf3,0x00,0x3f,
-0x31,0x0c,0x50,0xd0,0x00,0x0d,0xff,0xa0,0x8a,0x24,0x42,0x07,0xff,0xf1,0x77,0x01,
-0x00,0x1a,0x1f,0x13,0x13,0x13,0x4f,0x0f,0x00,0x30,0x0a,0xcc,0xcb,0xfa,0x18,0x01,
-0x41,0x1c,0x10,0xf3,0x71,0x00,0x10,0xd0,0x66,0x01,0x83,0x80,0x00,0x02,0x7c,0xef,
-0xfc,0x82,0x00,0xc7,0x1e,0x13,0x70,0x95,0x08,0x10,0xf6,0xe3,0x02,0x41,0x65,0x8f,
-0xff,0xfe,0xdd,0x16,0x00,0x67,0x01,0x00,0x55,0x19,0x11,0x02,0x58,0x01,0x30,0x36,
-0x89,0x9a,0x08,0x00,0x12,0x6e,0xf9,0x0b,0x13,0x0a,0x01,0x0c,0x40,0x5f,0xff,0xfb,
-0x31,0x89,0x06,0x00,0xa6,0x1b,0x00,0x08,0x00,0x00,0x1c,0x17,0x02,0x08,0x00,0x11,
-0xd0,0x1a,0x04,0x93,0xaf,0xff,0xfc,0x77,0xdf,0xff,0xff,0x60,0x3f,0xb5,0x0a,0x10,
-0x05,0xa7,0x13,0x00,0x25,0x00,0x41,0x29,0xdf,0xfc,0x70,0xd6,0x12,0x02,0xf1,0x01,
-0x0f,0x08,0x00,0x20,0x10,0x3a,0x47,0x18,0x31,0x4f,0xff,0xfa,0xb5,0x0a,0x13,0x4f,
-0x90,0x00,0x13,0x4f,0x43,0x1d,0x40,0x4f,0xff,0xfc,0x10,0x47,0x0a,0x12,0x4f,0x40,
-0x06,0x11,0xfa,0x08,0x00,0x10,0x0b,0x1d,0x11,0x10,0xf4,0x58,0x03,0x23,0xfe,0x4f,
-0x19,0x1f,0x09,0x10,0x00,0x03,0x20,0x00,0x00,0x6b,0x07,0x06,0x40,0x00,0x01,0xb1,
-0x22,0x16,0xf0,0x60,0x00,0x01,0x8c,0x0e,0x00,0x48,0x01,0x03,0x6b,0x28,0x42,0x5b,
-0xef,0xfd,0x92,0x21,0x28,0x23,0xff,0xf8,0x36,0x22,0x10,0xf8,0x4e,0x11,0x70,0xab,
-0xff,0xff,0xf2,0x4f,0xff,0xf9,0x96,0x02,0x30,0x89,0xff,0xfe,0x65,0x00,0x11,0xfb,
-0x9d,0x1a,0x58,0x37,0x77,0x5e,0xff,0xf9,0x5d,0x1e,0x04,0x53,0x1e,0x03,0xbb,0x1a,
-0x10,0x09,0x2d,0x00,0x10,0x08,0x43,0x23,0x01,0x4f,0x00,0x84,0x90,0xcf,0xff,0xfd,
-0x9b,0xff,0xff,0xf2,0x5a,0x00,0x01,0x69,0x00,0x11,0xf7,0x78,0x00,0x23,0xed,0x82,
-0xb4,0x07,0x0f,0x45,0x01,0x21,0x40,0x03,0xae,0xfe,0xa3,0x08,0x00,0x11,0x6f,0x94,
-0x10,0x23,0xf4,0x05,0x2f,0x02,0xb0,0x0e,0xff,0xff,0xea,0xbf,0xff,0xff,0xf4,0x5f,
-0xff,0xfb,0xaf,0x1a,0x10,0xf4,0xb4,0x0c,0x00,0x30,0x00,0x00,0xe2,0x18,0x00,0x08,
-0x00,0x01,0xfc,0x18,0x10,0x4f,0x66,0x02,0x19,0x80,0x10,0x00,0x12,0xdf,0x9a,0x11,
-0x23,0xf4,0x9f,0x30,0x00,0x03,0x2e,0x23,0x00,0x50,0x00,0x10,0xda,0x50,0x00,0x05,
-0x53,0x09,0x10,0x6f,0x40,0x0f,0x00,0xf3,0x18,0x61,0x9e,0xfe,0xb3,0x0d,0xff,0xf4,
-0x5b,0x1e,0x14,0xa4,0xc1,0x0b,0x13,0xa0,0xc0,0x0b,0x01,0x98,0x0f,0x60,0xeb,0xbe,
-0xff,0xff,0x60,0x1f,0x88,0x01,0x10,0xbf,0x5b,0x1e,0x10,0xf3,0xc2,0x02,0x11,0xf2,
-0x4f,0x04,0x33,0x1f,0xff,0xf5,0x3c,0x19,0x2a,0xf6,0xdf,0x07,0x05,0x14,0xf7,0x7f,
-0x23,0x02,0x1a,0x15,0x30,0x10,0x00,0x2f,0xc6,0x17,0x20,0x03,0xda,0x5f,0x00,0x20,
-0xfc,0xaa,0x66,0x06,0x13,0xbf,0xdf,0x0e,0x12,0x09,0x4f,0x01,0x00,0xc0,0x17,0x11,
-0xfe,0xce,0x26,0x43,0x02,0x9d,0xff,0xd5,0x02,0x08,0x10,0x03,0x63,0x01,0x00,0xe3,
-0x07,0x20,0xeb,0xa4,0x51,0x13,0x14,0x00,0x2d,0x24,0x01,0x06,0x00,0x01,0x31,0x03,
-0x18,0xd0,0x06,0x00,0x68,0x24,0x4f,0xff,0xfa,0x44,0x30,0x24,0x00,0x0f,0x06,0x00,
-0x30,0x51,0x01,0x8d,0xff,0xc7,0x09,0x69,0x02,0x00,0x0c,0x19,0x23,0xf8,0x03,0xfe,
-0x14,0x12,0x0d,0xb9,0x25,0x21,0xf8,0x4f,0xbb,0x1f,0x00,0x14,0x10,0x11,0xf3,0x32,
-0x00,0x12,0xcf,0xd3,0x28,0x10,0xf8,0x49,0x07,0x00,0x08,0x00,0x01,0x98,0x01,0x07,
-0x10,0x00,0x04,0x20,0x00,0x04,0x30,0x00,0x00,0xe0,0x02,0x00,0x40,0x00,0x12,0x0c,
-0xe0,0x02,0x05,0x60,0x00,0x21,0x00,0x4e,0x52,0x12,0x10,0xf8,0x80,0x00,0x11,0xc6,
-0xbe,0x25,0x03,0x32,0x05,0x50,0x6c,0x20,0x00,0x02,0xdf,0x96,0x09,0x74,0xfc,0x88,
-0xaf,0xff,0xff,0x90,0x0a,0x92,0x12,0x12,0x8f,0x43,0x18,0x00,0x50,0x04,0x26,0xec,
-0x83,0x17,0x21,0x0f,0x08,0x00,0x20,0x42,0x19,0xdf,0xec,0x60,0x26,0x10,0x24,0xff,
-0xfa,0x14,0x0d,0x70,0x60,0x6f,0xff,0xff,0xea,0xbe,0xff,0x00,0x02,0x10,0xfa,0x1c,
-0x02,0x11,0xf0,0x30,0x00,0x10,0x6f,0x20,0x0d,0x10,0xf2,0x98,0x00,0x1f,0xf3,0x08,
-0x00,0x3d,0xe2,0x05,0xef,0xa1,0x2f,0xff,0xf9,0x3f,0xff,0xfb,0x0e,0xff,0xf6,0x01,
-0x78,0x28,0x08,0x00,0x30,0x01,0x0f,0x03,0x00,0x1d,0x42,0x00,0x00,0x6e,0xfa,0x2e,
-0x25,0x01,0x23,0x2d,0x10,0x1e,0x8f,0x02,0x27,0x18,0x84,0xe3,0x1c,0x01,0x24,0x00,
-0x00,0x46,0x03,0x0f,0x09,0x00,0x33,0x10,0x70,0x57,0x11,0x22,0x5b,0xbf,0x17,0x26,
-0x95,0xb0,0x7f,0xff,0xff,0xd1,0x06,0xef,0xfc,0x70,0xf2,0x03,0x14,0x04,0x8f,0x08,
-0x0f,0x11,0x00,0x1b,0x00,0xad,0x08,0x40,0x70,0x4f,0xff,0xf4,0xcf,0x08,0x10,0x90,
-0x11,0x00,0x12,0x0a,0xeb,0x13,0x50,0xf4,0x08,0xff,0xff,0xc0,0x22,0x00,0x10,0x45,
-0xbf,0x13,0x00,0xf1,0x0e,0x13,0xff,0xdd,0x23,0x01,0x36,0x0d,0x02,0x8e,0x05,0x13,
-0x10,0x11,0x00,0x14,0xfb,0x11,0x00,0x11,0xf6,0x11,0x00,0x22,0xf9,0xef,0x23,0x04,
-0x01,0x63,0x21,0x13,0x00,0x55,0x00,0x10,0x60,0x77,0x00,0x00,0x6e,0x00,0x11,0x10,
-0x77,0x00,0x32,0x6f,0xff,0xfb,0x88,0x00,0x31,0xbf,0xff,0xf6,0x11,0x00,0x20,0x02,
-0xff,0x2f,0x24,0x1f,0xf8,0x03,0x00,0x32,0xd0,0x4f,0xff,0xf0,0x18,0xdf,0xfc,0x70,
-0x00,0x4a,0xef,0xeb,0x40,0x04,0x33,0x15,0x51,0xff,0xff,0xb0,0xaf,0xff,0xe9,0x00,
-0x06,0x4d,0x1a,0xd0,0x34,0xff,0xff,0xfe,0xbb,0xef,0xff,0xff,0xfe,0xab,0xff,0xff,
-0xf9,0x2d,0x03,0x40,0x01,0xdf,0xff,0xfb,0xda,0x06,0x10,0xc4,0x8f,0x00,0x10,0x08,
-0xa9,0x07,0x12,0x0a,0x36,0x06,0x00,0x92,0x0d,0x03,0xcc,0x12,0x01,0x30,0x1c,0x01,
-0xf4,0x1d,0x0f,0x19,0x00,0x5d,0x40,0xf0,0x5f,0xff,0xe0,0x52,0x07,0x00,0xb8,0x0d,
-0x01,0x98,0x03,0x13,0x5f,0x70,0x07,0x13,0x5f,0x40,0x03,0x01,0xa1,0x0a,0x01,0xb6,
-0x12,0x02,0x40,0x03,0x13,0x5f,0xf0,0x02,0x0f,0x08,0x00,0x3d,0x00,0x48,0x29,0x01,
-0xd0,0x05,0x21,0x01,0xbf,0xb3,0x21,0x00,0x05,0x06,0x02,0xea,0x29,0xb1,0xaf,0xff,
-0xfe,0xaa,0xef,0xff,0xfc,0x00,0x2f,0xff,0xfb,0x35,0x11,0x00,0xdc,0x09,0x00,0x51,
-0x01,0x10,0xa0,0x39,0x0a,0x00,0x3c,0x2a,0x02,0x08,0x07,0x10,0x8f,0x0c,0x14,0x11,
-0x80,0xc9,0x0c,0x05,0x11,0x00,0x12,0xcf,0x2f,0x1d,0x24,0xfe,0x09,0x33,0x00,0x12,
-0x3f,0xbb,0x0d,0x33,0xf4,0x00,0xbf,0x55,0x00,0x23,0x01,0xef,0x66,0x00,0x01,0xa3,
-0x1d,0x01,0x6d,0x21,0x12,0x4a,0xf9,0x2a,0x5e,0x4f,0xff,0xf0,0x4b,0xef,0x29,0x08,
-0x22,0x50,0x4f,0x49,0x05,0x00,0x29,0x08,0x00,0x8f,0x00,0x11,0xf5,0x4e,0x01,0x13,
-0x1f,0x29,0x08,0x1b,0x0c,0x29,0x08,0x04,0x6e,0x01,0x04,0xf3,0x01,0x04,0x20,0x00,
-0x10,0x1f,0x1c,0x02,0x00,0x8b,0x00,0x00,0x40,0x00,0x22,0xff,0xea,0x79,0x08,0x02,
-0xe7,0x11,0x02,0x70,0x00,0x13,0xf6,0xa9,0x08,0x1f,0x20,0xa4,0x07,0x1e,0x00,0xa1,
-0x07,0x41,0xb4,0x0c,0xff,0xf4,0xfd,0x17,0x1a,0x9e,0xa1,0x07,0x52,0xae,0xff,0xff,
-0xf4,0x6f,0xd1,0x01,0x0f,0xa1,0x07,0x16,0x1f,0xcf,0xa1,0x07,0x01,0x12,0xcf,0xa1,
-0x07,0x1c,0xae,0xa1,0x07,0x10,0xbf,0xa1,0x07,0x3f,0xae,0xfe,0xb3,0x59,0x08,0x20,
-0xb1,0x4f,0xff,0xf0,0x4c,0xff,0x44,0xff,0xff,0x7f,0xff,0xf4,0x0b,0x01,0x11,0x44,
-0x51,0x0d,0x61,0x4f,0xff,0xff,0xd7,0x66,0x14,0xe1,0x07,0x01,0x2c,0x00,0x02,0x6e,
-0x04,0x0f,0x0b,0x00,0x1e,0x15,0x00,0xa7,0x2b,0x13,0x0a,0xfa,0x26,0x02,0xcf,0x07,
-0x00,0xc8,0x03,0x62,0xa4,0x37,0xff,0xff,0xd0,0x08,0x64,0x0f,0x20,0xf2,0x08,0x45,
-0x09,0x84,0x15,0x55,0x51,0x05,0xff,0xff,0xd7,0x30,0x3f,0x0f,0x14,0xb6,0x67,0x08,
-0x10,0xe6,0xf7,0x07,0x23,0xcf,0xff,0x2f,0x0c,0x11,0x4a,0x3d,0x28,0x11,0x92,0xa4,
-0x28,0x00,0x4e,0x05,0x00,0x29,0x0b,0xa3,0x09,0xff,0xff,0x94,0x35,0xdf,0xff,0xf0,
-0x01,0xdf,0xe8,0x16,0x14,0x1b,0x0c,0x17,0x12,0x49,0x12,0x27,0x01,0x30,0x06,0x11,
-0x06,0xb0,0x0b,0x06,0x0b,0x00,0x01,0x2d,0x00,0x11,0x0d,0x8e,0x28,0x01,0x0b,0x00,
-0x6e,0x03,0x48,0xff,0xff,0x54,0x40,0x2c,0x00,0x0f,0x0b,0x00,0x08,0x00,0x78,0x11,
-0x00,0x80,0x08,0x41,0xfb,0xb2,0x00,0x0e,0xd4,0x0f,0x11,0x5f,0x5a,0x05,0x4f,0x4b,
-0xef,0xec,0x20,0xeb,0x06,0x3d,0x06,0xbb,0x03,0x11,0xf3,0x08,0x00,0x12,0x3f,0x12,
-0x02,0x22,0xf3,0x0f,0xb3,0x09,0x24,0xf3,0x09,0xb8,0x15,0x11,0xcf,0x23,0x0a,0x91,
-0xf3,0x00,0x07,0xcf,0xfe,0xa4,0x0f,0xff,0xf3,0x72,0x02,0x10,0x0e,0xa1,0x0a,0x11,
-0xf5,0x69,0x25,0x00,0xa7,0x03,0x00,0x30,0x0c,0x01,0x60,0x0d,0x10,0xcf,0xff,0x2f,
-0x30,0xff,0x20,0x01,0x34,0x01,0x11,0xef,0xef,0x0b,0x00,0x47,0x0b,0x22,0xb0,0x09,
-0x58,0x19,0x21,0xf0,0x0e,0xae,0x2a,0x00,0x92,0x13,0x10,0xf1,0x8c,0x01,0x22,0xf9,
-0x7f,0x3f,0x16,0x21,0xfd,0xbf,0x8b,0x01,0x13,0xef,0xe4,0x10,0x13,0x9f,0x95,0x11,
-0x13,0x4f,0x97,0x12,0x13,0x0e,0x02,0x10,0x13,0x09,0x2a,0x0f,0x02,0x20,0x13,0x10,
-0x7f,0xe0,0x2b,0x21,0xff,0xf8,0x09,0x00,0x00,0x50,0x00,0x10,0x05,0xca,0x03,0x10,
-0xaf,0x60,0x10,0x12,0xf4,0x7c,0x23,0x10,0xdf,0xa7,0x0c,0x10,0xf8,0x3e,0x00,0x10,
-0x50,0xca,0x12,0x30,0x06,0xff,0xfb,0x32,0x11,0x21,0xa0,0x04,0xed,0x10,0x10,0xfe,
-0x59,0x03,0x40,0xe0,0x07,0xff,0xf9,0x77,0x00,0x80,0x10,0xcf,0xfd,0xff,0xf3,0x0b,
-0xff,0xf5,0x40,0x00,0x80,0x51,0xff,0xf5,0xef,0xf8,0x0e,0xff,0xf1,0x97,0x01,0x80,
-0x85,0xff,0xf1,0x9f,0xfd,0x1f,0xff,0xd0,0x82,0x0e,0x80,0xba,0xff,0xc0,0x5f,0xff,
-0x7f,0xff,0x90,0x8f,0x00,0x82,0xee,0xff,0x70,0x0f,0xff,0xef,0xff,0x50,0x88,0x02,
-0x22,0x20,0x0b,0xb8,0x00,0x10,0x06,0xc5,0x1f,0x12,0x06,0x2b,0x33,0x13,0x02,0xe3,
-0x19,0x01,0xdb,0x0b,0x01,0x04,0x12,0x12,0xdf,0x77,0x0e,0x01,0x21,0x1e,0x12,0x8f,
-0xd0,0x00,0x10,0x6f,0x10,0x03,0x11,0x3f,0x5f,0x00,0x00,0xdf,0x08,0x00,0xf2,0x0b,
-0x30,0x9f,0xff,0xf3,0x0e,0x14,0x00,0xd1,0x04,0x10,0xc0,0xf3,0x28,0x00,0x08,0x05,
-0x10,0x51,0x45,0x11,0x00,0x74,0x26,0x01,0xbd,0x09,0x01,0xc2,0x04,0x18,0xfa,0x13,
-0x12,0x23,0x02,0xff,0x4a,0x0c,0x13,0x0d,0xb1,0x12,0x14,0x05,0x51,0x1c,0x13,0xef,
-0x1e,0x18,0x30,0x7f,0xff,0xfe,0x96,0x00,0x00,0x93,0x11,0x12,0x5f,0x41,0x32,0x51,
-0xff,0x20,0xcf,0xff,0xe1,0x83,0x14,0x00,0x87,0x14,0x00,0x1a,0x06,0x00,0x15,0x00,
-0x22,0x30,0x6f,0xb0,0x2f,0x11,0xfc,0x11,0x00,0x00,0x67,0x37,0x10,0x06,0xb8,0x0f,
-0x00,0xb8,0x2a,0x00,0x78,0x23,0x00,0x5f,0x25,0x00,0xa4,0x22,0x00,0xe1,0x24,0x00,
-0x65,0x00,0x11,0x40,0x1a,0x0e,0x00,0x00,0x02,0x12,0x7f,0x87,0x06,0x41,0xd0,0x0c,
-0xff,0xfa,0xbf,0x02,0x13,0x21,0x50,0x2e,0x10,0xf7,0x91,0x1c,0x00,0xf0,0x00,0x33,
-0xcb,0xff,0xf9,0xaa,0x00,0x03,0x84,0x27,0x03,0xdd,0x2d,0x13,0x6f,0x99,0x14,0x14,
-0x01,0xf9,0x11,0x14,0x0b,0x95,0x14,0x04,0x41,0x2f,0x14,0x02,0xf8,0x12,0x13,0x7f,
-0x27,0x11,0x12,0x2e,0x15,0x02,0x22,0x1a,0xcf,0xd0,0x0f,0x14,0x02,0xc8,0x03,0x13,
-0x2f,0xa7,0x11,0x43,0x01,0xdf,0xec,0x50,0x17,0x10,0x01,0x01,0x00,0x13,0x09,0x21,
-0x2c,0x12,0x9f,0xea,0x18,0x40,0x05,0x99,0x99,0x99,0xb5,0x2a,0x02,0x5f,0x10,0x12,
-0x80,0x4f,0x02,0x12,0xc0,0xbc,0x11,0x12,0xe2,0x65,0x10,0x17,0xf5,0xb9,0x11,0x01,
-0x20,0x06,0x05,0xb6,0x11,0x12,0x0c,0xc7,0x10,0x12,0x08,0x6b,0x00,0x00,0xce,0x30,
-0x43,0x99,0x99,0x99,0x91,0x7d,0x0c,0x1a,0x3d,0x3e,0x12,0x10,0x30,0x54,0x00,0x11,
-0x73,0x2e,0x00,0x13,0x90,0xe2,0x10,0x10,0x07,0xb6,0x0b,0x01,0x80,0x35,0x02,0x89,
-0x0f,0x13,0x06,0x93,0x18,0x10,0x90,0x1b,0x00,0x1a,0xf9,0x0b,0x00,0x10,0x9f,0x5b,
-0x12,0x01,0x22,0x0d,0x10,0x5c,0xbc,0x01,0x10,0x4f,0x46,0x37,0x02,0x86,0x26,0x00,
-0x01,0x1f,0x00,0x3e,0x2a,0x11,0xfe,0xf3,0x01,0x11,0xf5,0x2c,0x00,0x1e,0x80,0x42,
-0x00,0x02,0x0b,0x00,0x00,0xf6,0x02,0x00,0x65,0x02,0x11,0xe0,0x62,0x0e,0x11,0x40,
-0x23,0x15,0x14,0x40,0xf4,0x2c,0x21,0x04,0xdf,0xbf,0x12,0x4f,0x41,0x00,0x4f,0xf7,
-0x02,0x00,0x1f,0x41,0x2a,0xa4,0x07,0x50,0x3a,0x34,0x13,0x30,0xb8,0x11,0x11,0x06,
-0xaa,0x01,0x12,0xaf,0x79,0x06,0x01,0x10,0x14,0x01,0x07,0x2c,0x0e,0x05,0x00,0x30,
-0x0e,0xff,0xf2,0x11,0x01,0x11,0xf7,0x42,0x01,0x11,0x83,0x7f,0x14,0x00,0xdd,0x03,
-0x12,0xfd,0xd2,0x1f,0x10,0x06,0x60,0x2e,0x10,0x0c,0xd8,0x00,0x12,0x0f,0x85,0x02,
-0x0e,0x41,0x00,0x01,0x52,0x2f,0x10,0x5f,0x64,0x00,0x00,0x39,0x04,0x11,0x19,0x20,
-0x01,0x00,0xbd,0x01,0x20,0x0e,0xfa,0x75,0x0a,0x11,0x10,0x24,0x12,0x71,0xcf,0xeb,
-0x40,0x00,0x00,0x27,0x77,0xa2,0x03,0x10,0x80,0x7c,0x33,0x11,0x06,0x25,0x2d,0x20,
-0x01,0xdf,0x9e,0x36,0x50,0xcb,0xff,0xff,0xeb,0xef,0xf2,0x1e,0x11,0x90,0x50,0x0f,
-0x20,0xf1,0x04,0x47,0x31,0x10,0xbf,0xbb,0x20,0x62,0x26,0x66,0x00,0x00,0x00,0x6c,
-0xe4,0x22,0x51,0x33,0x10,0x00,0x00,0x4e,0xc3,0x0f,0x00,0x12,0x1f,0xf0,0x07,0xfd,
-0x20,0x9f,0xf2,0x0f,0xf5,0x00,0x0f,0xf5,0x0f,0xf6,0x00,0x0f,0xf5,0x0a,0xff,0x75,
-0xcf,0xf1,0x01,0xef,0xff,0x80,0x00,0x20,0xef,0xc4,0x7a,0x15,0x25,0xcc,0xcc,0x60,
-0x1b,0x03,0x0c,0x13,0x00,0x01,0x00,0x14,0x1d,0xad,0x15,0x01,0x61,0x02,0x05,0x22,
-0x00,0x3f,0x2e,0xff,0xb0,0x59,0x2c,0x0a,0x0f,0xca,0x28,0xdc,0x02,0xde,0x00,0x35,
-0xcc,0xcc,0x30,0x86,0x18,0x16,0xf7,0x4c,0x01,0x02,0x7d,0x15,0x04,0x2e,0x03,0x03,
-0xaa,0x2f,0x0f,0x3f,0x01,0xfe,0x25,0x06,0x88,0x35,0x2d,0x02,0x28,0x06,0x04,0x45,
-0x33,0x13,0x40,0x59,0x2c,0x43,0xfe,0x27,0xff,0xf4,0xfc,0x00,0x5f,0xd1,0x00,0x5f,
-0xff,0x50,0x3f,0x01,0xfa,0x32,0x5d,0xfd,0x83,0xea,0x3b,0x03,0x91,0x23,0x03,0x49,
-0x16,0x23,0xdd,0xff,0x4c,0x16,0x6f,0x0d,0xd9,0x00,0x28,0xcc,0x80,0x73,0x02,0xfa,
-0x72,0x05,0xdd,0x50,0x00,0x09,0xdb,0x10,0xcd,0x10,0x12,0xf1,0xcd,0x08,0x00,0xa5,
-0x00,0x14,0xf1,0x53,0x2f,0x7f,0x06,0xee,0x60,0x00,0x0a,0xfc,0x20,0xe6,0x04,0xfc,
-0x15,0x10,0xfd,0x00,0x11,0x4d,0x21,0x3f,0x01,0xec,0x0d,0x43,0xfe,0x68,0xfd,0x00,
-0xc4,0x2c,0x43,0xf4,0x00,0xaf,0x30,0x0b,0x00,0x43,0xf3,0x00,0x8f,0x30,0xc7,0x21,
-0x45,0xfc,0x34,0xfe,0x00,0xdd,0x21,0x15,0xd3,0x52,0x06,0x1f,0x43,0x55,0x01,0xf4,
-0x01,0xea,0x0a,0x04,0x75,0x09,0x04,0x53,0x2e,0x05,0x0f,0x00,0x1a,0x1f,0x0f,0x00,
-0x10,0xaf,0x41,0x0b,0x00,0xe8,0x32,0x13,0x10,0x36,0x1a,0x04,0x84,0x38,0x02,0x1d,
-0x01,0x15,0xfd,0xe8,0x37,0x02,0x08,0x1f,0x13,0x8f,0xd3,0x29,0x03,0xe4,0x00,0x01,
-0x45,0x35,0x05,0x54,0x01,0x21,0x40,0x7f,0x4b,0x00,0x12,0x90,0x24,0x0a,0x13,0xfc,
-0xda,0x00,0x14,0xe0,0x93,0x2b,0x15,0x5f,0x0f,0x00,0x00,0xcd,0x2b,0x07,0x0f,0x00,
-0x00,0x82,0x0b,0x06,0xec,0x0f,0x25,0x00,0x3f,0x72,0x20,0x03,0xf4,0x06,0x04,0x01,
-0x37,0x07,0x23,0x28,0x03,0x0f,0x00,0x00,0x16,0x01,0x30,0xdd,0xdd,0xdd,0x7d,0x3f,
-0x03,0x0f,0x02,0x13,0xf9,0x93,0x01,0x03,0x1d,0x01,0x12,0xf1,0x7f,0x29,0x00,0xe1,
-0x00,0x22,0xa1,0x09,0xa9,0x0a,0x13,0x0f,0xcf,0x1c,0x03,0xdd,0x1f,0x04,0x0f,0x00,
-0x12,0xbf,0xe3,0x0a,0x14,0x0e,0x49,0x3a,0x0f,0x94,0x2f,0xb7,0x43,0xcf,0xff,0xfb,
-0x61,0x3e,0x0c,0x13,0xfa,0x59,0x00,0x34,0x28,0xdf,0xff,0x4d,0x03,0x04,0x5a,0x1e,
-0x44,0x09,0xef,0xff,0x70,0x3f,0x02,0x13,0xd1,0x5d,0x01,0x11,0xec,0x12,0x00,0x33,
-0x6c,0xcc,0xc4,0xab,0x00,0x14,0xfd,0x92,0x01,0x13,0x80,0xcf,0x09,0x13,0xf3,0xcc,
-0x09,0x1e,0xfd,0x7a,0x03,0x0f,0x3f,0x2f,0x9e,0x01,0xca,0x24,0x23,0xcc,0xc4,0x9d,
-0x0a,0x18,0x90,0xea,0x34,0x13,0x4f,0x43,0x00,0x0f,0xe8,0x00,0xb5,0x24,0x58,0x83,
-0xea,0x25,0x13,0x40,0xee,0x04,0x11,0xf5,0xee,0x00,0x11,0xe3,0x0a,0x09,0x6f,0xbf,
-0xfe,0x20,0x04,0xff,0xf6,0xe8,0x00,0xaf,0x61,0x4c,0xd6,0x00,0x00,0x8d,0xb2,0x63,
-0x0e,0x30,0x04,0xff,0xfc,0x31,0x00,0x11,0x20,0x17,0x11,0x6f,0x5e,0xe8,0x00,0x00,
-0x9f,0xd3,0xe0,0x00,0xae,0x31,0x09,0xcc,0xcc,0x52,0x16,0x10,0xa0,0x41,0x0d,0x01,
-0x9c,0x43,0x23,0xfe,0x00,0xfb,0x42,0x06,0x01,0x00,0x01,0x62,0x11,0x0f,0x05,0x00,
-0x55,0x40,0x08,0xcc,0xcc,0x20,0xdc,0x20,0x00,0x6d,0x12,0x67,0x00,0x8f,0xff,0x80,
-0x00,0x3f,0x8d,0x00,0x00,0xea,0x04,0x02,0x27,0x00,0x0f,0x09,0x00,0x47,0x00,0xd4,
-0x02,0x22,0x87,0x10,0x43,0x21,0x10,0x20,0xdc,0x07,0x00,0x07,0x00,0xb3,0x1c,0xff,
-0xd1,0x9f,0xfe,0x30,0x1d,0xff,0xc0,0x00,0x7f,0xe2,0x28,0x0a,0x93,0x00,0x04,0x3b,
-0x00,0x0f,0x0d,0x00,0x6e,0x90,0x06,0xdc,0x30,0x00,0x1a,0xda,0x02,0xff,0xfe,0xde,
-0x44,0x30,0x3f,0xff,0xe0,0xca,0x10,0x53,0x8f,0xe4,0x00,0x01,0xcf,0xbf,0x2a,0x0a,
-0xd5,0x01,0x0f,0xbd,0x00,0x76,0x01,0x1f,0x07,0x14,0xd9,0x49,0x04,0x03,0xce,0x29,
-0x14,0x08,0x43,0x1d,0x01,0x55,0x25,0x12,0xbb,0xad,0x2b,0x01,0xd9,0x06,0x22,0x07,
-0xff,0x6a,0x25,0x12,0xf3,0x78,0x2d,0x03,0xee,0x06,0x00,0x70,0x13,0x02,0x15,0x00,
-0x01,0xfa,0x13,0x03,0x03,0x07,0x90,0xff,0xff,0xb4,0xdd,0xef,0xff,0xfd,0xdd,0x80,
-0x7a,0x1e,0x13,0x5f,0xeb,0x38,0x33,0xdf,0xff,0xe5,0x87,0x07,0x00,0x1c,0x14,0x03,
-0x2a,0x00,0x00,0x63,0x21,0x02,0x3f,0x00,0x12,0x0f,0x33,0x09,0x02,0x09,0x3d,0x13,
-0x80,0x15,0x00,0x00,0xb2,0x15,0x02,0x15,0x00,0x33,0x5f,0xff,0xfc,0x7e,0x00,0x00,
-0x6e,0x2e,0x00,0x15,0x00,0x22,0xcb,0xbc,0x88,0x09,0x15,0x8f,0x92,0x09,0x12,0x08,
-0x41,0x35,0x13,0x40,0xd2,0x00,0x23,0xfd,0x94,0x6c,0x39,0x43,0xb6,0x11,0xaf,0xf2,
-0x33,0x0a,0x21,0xff,0xfe,0x8c,0x08,0x13,0xfd,0xba,0x30,0x6f,0x6d,0xd2,0x00,0x5a,
-0xcb,0x40,0xd6,0x0b,0x02,0x0f,0xd4,0x2f,0xc0,0x34,0x4c,0xcc,0xc5,0xa1,0x0b,0x04,
-0xa6,0x25,0x01,0x6d,0x16,0x03,0x0a,0x00,0x15,0x0b,0xbb,0x09,0x00,0x50,0x46,0x0f,
-0x01,0x00,0x07,0x0f,0x1a,0x30,0xc6,0x01,0x01,0x00,0x35,0x4c,0xcc,0xc6,0x28,0x0b,
-0x14,0xa0,0xd9,0x09,0x15,0xfc,0xe3,0x0a,0x14,0xd0,0xde,0x0a,0x2f,0xfe,0x10,0x22,
-0x01,0xe4,0x34,0xcf,0xfc,0x10,0x16,0x14,0x03,0x71,0x0a,0x63,0x02,0xdf,0xfc,0xbf,
-0xfd,0x10,0x12,0x14,0x12,0x0a,0x15,0x00,0x22,0x68,0x86,0x04,0x00,0x0f,0x22,0x01,
-0xe0,0x53,0x8c,0x92,0x00,0x09,0xcb,0xa4,0x0e,0x33,0x71,0x3f,0xfc,0x22,0x18,0x03,
-0x28,0x00,0x33,0xbf,0xf3,0x18,0x1d,0x18,0x6f,0xad,0xa0,0x00,0x3a,0xc8,0x10,0x22,
-0x01,0xe1,0x10,0x3d,0x2a,0x4d,0x22,0xd4,0x00,0xcd,0x17,0x12,0x03,0xd3,0x0f,0x10,
-0xcf,0x0a,0x00,0x11,0xfd,0x90,0x40,0x5f,0xd7,0x00,0x00,0x7d,0xc3,0x18,0x01,0xe0,
-0x10,0xb3,0x9b,0x06,0x31,0xa0,0x01,0xcf,0x62,0x07,0x40,0xb0,0xbf,0xff,0xf3,0x49,
-0x00,0xc0,0x92,0xef,0xff,0xe3,0x04,0xff,0xff,0xd1,0x02,0xef,0xff,0xe7,0x70,0x03,
-0x22,0x02,0xef,0x04,0x4b,0x00,0x08,0x00,0x12,0xd1,0x0c,0x0c,0x13,0xf4,0xe7,0x4e,
-0x13,0xe3,0xac,0x22,0x10,0xe2,0x07,0x00,0x40,0xd5,0xef,0xff,0xe2,0x38,0x00,0x52,
-0x03,0xff,0xff,0xe2,0xaf,0x26,0x1b,0x30,0x80,0xaf,0xe2,0x6e,0x0a,0x30,0x80,0x00,
-0x92,0x32,0x10,0x06,0x08,0x14,0x05,0x2a,0x10,0x02,0x07,0x52,0x00,0x51,0x39,0x10,
-0x0a,0xdd,0x0e,0x14,0x5e,0xa5,0x40,0x15,0x08,0xfd,0x32,0x14,0x6f,0x61,0x01,0x10,
-0x01,0x65,0x3b,0x00,0x70,0x01,0x24,0x40,0x09,0x85,0x07,0x11,0xc0,0x8d,0x3b,0x10,
-0x03,0x85,0x0f,0x01,0xa1,0x3b,0x51,0x0d,0xff,0x7f,0xff,0xf7,0xe7,0x3b,0x23,0x7f,
-0xf7,0x39,0x01,0x10,0x02,0x25,0x00,0x10,0xfb,0xc6,0x07,0x60,0x0c,0xff,0x20,0x0e,
-0xff,0xfc,0x0a,0x00,0x40,0x6f,0xf8,0x00,0x0e,0x7c,0x4b,0x21,0xf4,0x01,0x26,0x39,
-0x20,0xfc,0x5f,0x69,0x4b,0x10,0x30,0xe6,0x1b,0x51,0x2f,0xff,0xfa,0x5f,0xf9,0x58,
-0x08,0x51,0x0e,0xff,0xfe,0xef,0xe0,0x2d,0x21,0x11,0x08,0x84,0x07,0x10,0x04,0x88,
-0x2c,0x10,0xef,0x88,0x1a,0x12,0x6f,0x77,0x23,0x31,0xff,0xfe,0xdf,0x6f,0x1d,0x03,
-0xd2,0x29,0x12,0xc0,0x15,0x12,0x02,0xc8,0x08,0x23,0xcf,0xf3,0xa9,0x46,0x26,0x06,
-0xff,0xf4,0x00,0x33,0xbc,0xcc,0xb0,0xb6,0x12,0x05,0xcf,0x46,0x15,0x04,0xe5,0x0f,
-0x15,0x05,0xf4,0x3c,0x1e,0x06,0x50,0x0d,0x05,0x37,0x00,0x0f,0x0a,0x32,0x66,0x05,
-0x13,0x00,0x14,0x42,0x13,0x00,0x12,0xf3,0xbd,0x10,0x00,0x90,0x11,0x12,0xef,0x4c,
-0x4a,0x01,0x24,0x2f,0x60,0xc2,0x00,0x02,0xbf,0xff,0xf9,0x3a,0x12,0x21,0xfd,0xcd,
-0x67,0x1d,0x14,0x4f,0xbf,0x33,0x02,0x1d,0x47,0x01,0xbc,0x43,0x21,0x04,0x9d,0xc0,
-0x33,0x02,0x01,0x00,0x14,0xac,0x17,0x01,0x14,0x7f,0xd5,0x10,0x14,0x2f,0x15,0x08,
-0x01,0x5a,0x1e,0x0f,0x14,0x01,0xdf,0x14,0x06,0xf7,0x00,0x13,0x07,0xbc,0x12,0x00,
-0xe5,0x0b,0x01,0x02,0x01,0x00,0x78,0x0f,0x02,0x70,0x0f,0x7f,0x03,0x88,0x82,0x00,
-0x03,0x88,0x71,0x14,0x01,0xd5,0x61,0xaf,0xc2,0x00,0x03,0xdf,0x90,0xfb,0x04,0x10,
-0xb0,0x7e,0x53,0x02,0x31,0x03,0x11,0x0c,0x29,0x02,0x6e,0x09,0xdb,0x20,0x00,0x2b,
-0xd8,0x1f,0x02,0x0f,0x46,0x35,0xc1,0x17,0x00,0x7a,0x12,0x06,0x7c,0x12,0x07,0xae,
-0x4b,0x05,0x80,0x12,0x0e,0x82,0x12,0x06,0x01,0x00,0x0f,0x95,0x32,0xc9,0x04,0x13,
-0x01,0x05,0x71,0x4c,0x06,0x11,0x00,0x54,0xfd,0x99,0x98,0x75,0x10,0xf3,0x16,0x14,
-0xb2,0xbf,0x15,0x14,0xf5,0x04,0x17,0x11,0xf3,0x33,0x00,0x52,0x3b,0xff,0xff,0xc0,
-0xef,0x79,0x20,0x11,0xff,0xff,0x2f,0x00,0x9c,0x17,0x00,0x11,0x00,0x00,0x26,0x01,
-0x19,0x6e,0x11,0x00,0x12,0x0a,0x22,0x00,0x00,0x33,0x00,0x26,0xd0,0xef,0x67,0x26,
-0x02,0xb3,0x29,0x13,0xef,0xf3,0x41,0x02,0x77,0x00,0x1e,0x20,0x99,0x00,0x0d,0x11,
-0x00,0x00,0xec,0x53,0x21,0x88,0x85,0xae,0x08,0x13,0x1b,0xaa,0x47,0x02,0xbd,0x2e,
-0x01,0xc5,0x22,0x02,0xbc,0x07,0x00,0x31,0x33,0x22,0x20,0x6f,0xf2,0x1f,0x01,0x62,
-0x42,0x01,0x3a,0x24,0x02,0x42,0x20,0x11,0xef,0x9e,0x2d,0x12,0xfe,0x05,0x32,0x12,
-0x0e,0xa1,0x23,0x12,0xa0,0x24,0x25,0x00,0x09,0x00,0x01,0x6a,0x2e,0x00,0x09,0x00,
-0x01,0x7e,0x06,0x02,0x09,0x00,0x12,0xa0,0x09,0x00,0x01,0xf0,0x34,0x00,0x09,0x00,
-0x10,0x4f,0x1c,0x00,0x00,0x09,0x00,0x21,0x07,0xff,0xab,0x18,0x12,0xa0,0xce,0x40,
-0x13,0xef,0xd8,0x34,0x11,0xc0,0x5f,0x32,0x00,0xb8,0x18,0x02,0x09,0x00,0x10,0x6f,
-0xe3,0x4a,0x20,0xa0,0x21,0x61,0x2c,0x00,0x12,0x00,0x70,0x8f,0xca,0xae,0xff,0xff,
-0xb0,0xef,0x9a,0x28,0x11,0xff,0xef,0x03,0x11,0xa0,0x31,0x41,0x00,0x48,0x00,0x21,
-0x9c,0xef,0xfe,0x25,0x13,0xbf,0xe3,0x05,0x14,0x0c,0xf7,0x33,0x00,0xfe,0x11,0x02,
-0x03,0x18,0x12,0xe1,0xd7,0x0b,0x2f,0xcc,0xc7,0xb1,0x02,0x01,0x0f,0x75,0x31,0x74,
-0x02,0x72,0x09,0x12,0xe1,0x9b,0x05,0x28,0xfe,0x20,0x1e,0x4f,0x12,0xbf,0x87,0x02,
-0x3f,0x03,0xcc,0xc5,0xc0,0x00,0x8a,0x04,0xad,0x15,0x12,0x5f,0x83,0x08,0x31,0x05,
-0xff,0xf9,0x11,0x0a,0x10,0x6f,0x34,0x00,0x9f,0x70,0x00,0x02,0x99,0x95,0x00,0x03,
-0x99,0x92,0xc0,0x00,0x87,0x51,0x05,0xde,0x90,0x00,0x3f,0xe9,0x4b,0x40,0xfe,0x40,
-0x9f,0xf4,0x0b,0x4c,0x01,0x17,0x1a,0x40,0x02,0xff,0xa0,0x1a,0xbf,0x04,0x6f,0x03,
-0xdd,0x50,0x00,0x6b,0xb5,0x80,0x01,0x88,0x61,0x9f,0xd4,0x00,0x02,0xcf,0xb0,0xd1,
-0x52,0x11,0x0a,0x30,0x31,0x11,0xfd,0x99,0x58,0x00,0x7c,0x0c,0x3f,0x01,0xbd,0x90,
-0xf0,0x02,0x81,0x13,0x01,0x93,0x08,0x22,0xef,0xf9,0x6f,0x30,0x31,0xc6,0xaf,0xa0,
-0x06,0x03,0x31,0x10,0x0d,0xf0,0x08,0x00,0x31,0x00,0x0c,0xf0,0x00,0x06,0x23,0x92,
-0x6f,0x85,0x33,0x03,0xaa,0x0f,0x2f,0x14,0x20,0x80,0x01,0x81,0x00,0xa8,0x1b,0x10,
-0xa4,0x33,0x57,0x14,0xa4,0x21,0x0f,0x12,0xaa,0x1d,0x0d,0x01,0xac,0x06,0x07,0xc2,
-0x4b,0x00,0xc9,0x29,0x01,0xe8,0x2c,0x22,0x40,0x5f,0xd8,0x32,0x01,0xa9,0x51,0x42,
-0xb0,0x25,0x55,0x50,0x99,0x3c,0x22,0x00,0x6f,0x43,0x16,0xc5,0x11,0xbf,0xff,0xe1,
-0x11,0x11,0x4f,0xff,0xf1,0x00,0x17,0xbe,0x42,0x00,0x14,0xf3,0x79,0x1c,0x04,0xc3,
-0x2b,0x06,0x0d,0x00,0x44,0xbf,0xff,0xf9,0x20,0xdb,0x37,0x02,0x49,0x37,0x00,0x6f,
-0x14,0x05,0xba,0x37,0x11,0xcf,0x59,0x3f,0x80,0x36,0x00,0xbf,0xff,0xf9,0x55,0x8e,
-0xff,0x7b,0x33,0x32,0xbe,0xff,0x10,0x41,0x00,0x12,0xef,0xd3,0x00,0x12,0x07,0x15,
-0x5f,0x03,0x75,0x14,0x10,0x29,0x55,0x2b,0x00,0x8a,0x33,0x2f,0xd9,0x40,0x52,0x35,
-0x22,0x1e,0x6e,0x52,0x35,0x07,0x86,0x12,0x12,0x09,0x7b,0x27,0x61,0xfb,0x4f,0xff,
-0xf7,0x00,0x01,0x52,0x35,0x59,0xfc,0x89,0xef,0xff,0xf3,0x52,0x35,0x12,0xf8,0xa0,
-0x50,0x12,0x82,0x6e,0x09,0x11,0xa2,0x04,0x05,0x13,0x8d,0xd3,0x00,0x12,0x4f,0x56,
-0x00,0x12,0x9e,0x74,0x0e,0x13,0x0f,0x13,0x1c,0x26,0xee,0xc7,0x47,0x05,0x00,0xd1,
-0x11,0x14,0xfa,0xcb,0x08,0x13,0x40,0xe1,0x25,0x12,0xd0,0xc6,0x0a,0x05,0x14,0x13,
-0x0a,0x01,0x00,0x0f,0xf7,0x34,0x75,0x01,0xcf,0x41,0x03,0x06,0x55,0x12,0x10,0xfe,
-0x00,0x13,0xe2,0x17,0x00,0x14,0x30,0xe2,0x52,0x0f,0xc0,0x00,0x89,0x13,0x05,0x5b,
-0x0c,0x11,0x6f,0x96,0x16,0x00,0xfa,0x28,0x02,0x8b,0x5d,0x20,0xff,0x50,0x99,0x5d,
-0x7f,0x03,0x99,0x94,0x00,0x04,0x99,0x91,0xc0,0x00,0x87,0x21,0xaf,0xd3,0x11,0x0c,
-0x00,0xa5,0x1b,0x00,0xf3,0x28,0x00,0x0e,0x0c,0x00,0x2e,0x0e,0x00,0xc5,0x1b,0x3f,
-0x02,0xbd,0x80,0xb0,0x00,0x7e,0x30,0x1d,0xff,0xfd,0xdb,0x02,0x10,0xf8,0x31,0x08,
-0x10,0xf2,0x6a,0x00,0x10,0xc0,0xc7,0x0b,0x07,0x06,0x18,0x03,0xb0,0x09,0x1f,0x90,
-0x09,0x00,0x31,0x00,0xac,0x0b,0x10,0x0a,0x6a,0x2c,0x00,0xb6,0x04,0x00,0x34,0x53,
-0x3f,0x6c,0xcc,0x30,0x6a,0x00,0x43,0x01,0x0a,0x01,0x03,0xfc,0x18,0x10,0x40,0x19,
-0x0a,0xfb,0x01,0x9f,0xff,0x40,0x00,0xaf,0xfe,0x30,0x5f,0xff,0x50,0x49,0x98,0x20,
-0x00,0x49,0x98,0x6c,0x14,0x14,0x0e,0xd8,0x2d,0x1f,0x90,0x0d,0x00,0x50,0x90,0x0b,
-0xfc,0x20,0x00,0x4d,0xf8,0x07,0xff,0xfa,0x0e,0x2c,0x30,0x7f,0xff,0x90,0x9a,0x03,
-0x6f,0x9d,0xb1,0x00,0x03,0xcd,0x70,0x8f,0x00,0x62,0x44,0x00,0x01,0xb7,0x20,0xe9,
-0x10,0x41,0xc4,0x00,0x04,0x50,0x40,0x22,0x43,0xfb,0x3a,0xff,0x20,0xab,0x05,0x21,
-0x91,0x00,0x4a,0x0c,0x04,0x74,0x3d,0x02,0x3b,0x0d,0x32,0x3d,0xff,0xef,0x17,0x2f,
-0x22,0xfe,0x60,0x0c,0x56,0x10,0x04,0x9f,0x2f,0x10,0xf1,0x2b,0x0c,0x20,0x54,0x15,
-0x22,0x07,0x20,0x05,0xdf,0x64,0x30,0x14,0xfa,0x30,0x13,0x14,0xf0,0x7b,0x06,0x72,
-0x10,0xef,0xff,0xf8,0x10,0x16,0xef,0xf9,0x05,0x00,0xbc,0x0b,0x10,0x48,0x3d,0x22,
-0x00,0x3a,0x23,0x03,0x08,0x0a,0x41,0xff,0x3a,0xff,0xfd,0x09,0x0a,0x10,0xf1,0xa8,
-0x23,0x00,0xec,0x05,0x01,0xb3,0x2e,0x00,0x88,0x06,0x13,0x0f,0x47,0x59,0x00,0x46,
-0x14,0x30,0xba,0xdf,0xff,0xbe,0x54,0x04,0x47,0x4b,0x13,0x8f,0x44,0x2f,0x00,0xd7,
-0x02,0x11,0xa4,0xda,0x07,0x51,0xbf,0xc3,0x00,0x0d,0xfd,0xa1,0x0c,0x81,0x81,0x4f,
-0xfa,0x00,0x00,0x7f,0xfe,0xef,0xb5,0x10,0x22,0xcf,0xf1,0x9f,0x3f,0x5e,0xbd,0x90,
-0x00,0x2a,0xc8,0x46,0x04,0x0f,0x77,0x35,0x76,0x04,0x2e,0x2f,0x06,0x98,0x5a,0x14,
-0x8f,0x84,0x2c,0x13,0x9f,0x9c,0x0c,0x3f,0x00,0x9c,0xcb,0x47,0x0f,0x03,0x53,0x04,
-0xad,0xff,0xda,0x40,0xae,0x0d,0x21,0xff,0xc1,0x9d,0x18,0x01,0x97,0x4b,0x12,0x0a,
-0x6b,0x34,0x11,0xc0,0xbb,0x24,0x00,0xae,0x52,0x12,0x8f,0x5f,0x63,0x31,0xfa,0x0c,
-0xff,0xb3,0x56,0x00,0x2e,0x0e,0x11,0x90,0xb1,0x0e,0x02,0xb3,0x3a,0x34,0x7f,0xff,
-0xf0,0x11,0x00,0x02,0x19,0x0d,0x10,0xbf,0x96,0x43,0x02,0x33,0x00,0x13,0x03,0xea,
-0x47,0x23,0x40,0x0b,0x55,0x00,0x23,0x00,0x1e,0x66,0x00,0x02,0xdb,0x65,0x12,0xc2,
-0x88,0x00,0x13,0xea,0x1c,0x10,0x01,0xb1,0x50,0x07,0xd7,0x24,0x13,0x0b,0xd2,0x07,
-0x14,0x05,0x20,0x10,0x2f,0xbc,0xca,0xcc,0x00,0x94,0x34,0x01,0xcf,0xfc,0x23,0x0e,
-0x12,0xfc,0x08,0x00,0x11,0xfc,0x06,0x1a,0x50,0x02,0xef,0xfb,0x00,0xbf,0x09,0x00,
-0x6f,0x89,0x98,0x00,0x00,0x89,0x96,0xcc,0x00,0x91,0x00,0x24,0x03,0x22,0x0c,0xfd,
-0xe2,0x44,0x11,0x14,0x37,0x67,0x11,0xff,0x25,0x03,0x00,0x8a,0x68,0x11,0x6f,0x59,
-0x00,0x2e,0xbd,0xa0,0x26,0x03,0x0f,0xcc,0x00,0x83,0x10,0x4d,0xca,0x3d,0x12,0xd3,
-0x61,0x31,0x12,0x4f,0xbc,0x46,0x11,0x30,0x45,0x19,0x00,0x57,0x05,0x3f,0x07,0xdc,
-0x30,0x1f,0x03,0x8a,0x34,0x08,0xee,0x90,0x7f,0x04,0x05,0x05,0x28,0x1b,0xf8,0xe6,
-0x5e,0x39,0x03,0x99,0x30,0xda,0x5b,0x12,0x88,0x01,0x00,0x1f,0x80,0x42,0x5f,0x08,
-0x0e,0x9a,0x16,0x08,0x48,0x00,0x05,0x5a,0x00,0x05,0x6c,0x00,0x05,0x7e,0x00,0x05,
-0x90,0x00,0x00,0xb5,0x15,0x13,0x40,0x1c,0x1f,0x21,0xd0,0x00,0x0c,0x3a,0x23,0xaf,
-0xf6,0x0c,0x3a,0x14,0xff,0x0c,0x3a,0x11,0xfd,0x0c,0x3a,0x21,0xab,0xff,0xcd,0x1f,
-0x10,0xfb,0x3b,0x15,0x01,0x0c,0x3a,0x60,0x09,0xfe,0xff,0xff,0x90,0xcf,0x4f,0x01,
-0x12,0x6b,0x0c,0x3a,0x22,0xaf,0xd0,0x0c,0x3a,0x30,0x2f,0xf6,0x07,0x56,0x37,0x32,
-0xf9,0x0a,0xfd,0x0c,0x3a,0xb2,0xc2,0xff,0x50,0x0b,0xff,0xfe,0x08,0xff,0xff,0xbf,
-0xd0,0x0c,0x3a,0x20,0xff,0xf5,0x0c,0x3a,0x00,0xd9,0x1f,0x02,0x0c,0x3a,0x13,0xdf,
-0xdf,0x56,0x23,0x01,0xef,0x0c,0x3a,0x22,0x2f,0xfb,0x0c,0x3a,0x24,0x0a,0xfd,0x57,
-0x5b,0x2a,0x60,0x00,0x68,0x04,0x05,0xe0,0x5f,0x13,0x9f,0x77,0x14,0x14,0x0a,0xbc,
-0x16,0x1f,0xac,0x35,0x05,0x01,0x0f,0x8b,0x37,0x75,0x03,0x81,0x4e,0x03,0x07,0x35,
-0x12,0x60,0x93,0x12,0x13,0xf8,0xa3,0x00,0x12,0x90,0x29,0x05,0x1f,0xc9,0xc0,0x00,
-0x8a,0x43,0x01,0xdf,0xfb,0x00,0xa3,0x5d,0x11,0xc1,0xc3,0x6a,0x10,0xfa,0x0f,0x1f,
-0x00,0x73,0x0d,0x01,0x0d,0x1f,0x6f,0x66,0x64,0x00,0x00,0x56,0x64,0xc0,0x00,0x87,
-0x13,0x4e,0x58,0x27,0x31,0xef,0xff,0x30,0x68,0x27,0x04,0x78,0x27,0x01,0x88,0x27,
-0x1f,0xc2,0x30,0x02,0x82,0x00,0x06,0x0f,0x07,0x25,0x0f,0x00,0x41,0x4b,0x03,0xba,
-0x03,0x1f,0xfc,0x27,0x08,0x09,0x11,0x0c,0x22,0x03,0x01,0x8a,0x41,0x11,0xf5,0x45,
-0x00,0x13,0x01,0x1f,0x0c,0x42,0x10,0x0b,0xff,0xff,0x53,0x17,0x00,0x05,0x36,0x12,
-0x2f,0x83,0x15,0x11,0x90,0x51,0x03,0x00,0xd3,0x35,0x11,0xcf,0xe4,0x38,0x00,0x5c,
-0x69,0x11,0xf5,0x3a,0x06,0x32,0x76,0xff,0xfe,0x17,0x22,0x33,0xbf,0xff,0x90,0x81,
-0x2e,0x13,0xf3,0xf3,0x2c,0x14,0xfe,0x6e,0x17,0x13,0x80,0xb5,0x2d,0x04,0x01,0x62,
-0x14,0xfc,0x07,0x2d,0x13,0x70,0x8a,0x04,0x13,0xf1,0xb5,0x03,0x12,0xfb,0x96,0x11,
-0x11,0xef,0xfb,0x02,0x23,0x01,0xac,0x79,0x2d,0x13,0x2f,0x37,0x3a,0x14,0x02,0xae,
-0x17,0x39,0x1d,0xfe,0xc5,0xf5,0x66,0x0f,0x08,0x00,0x20,0x01,0x6d,0x46,0x11,0x3f,
-0x65,0x55,0x14,0xf7,0xae,0x2d,0x23,0x60,0x3f,0x44,0x3e,0x40,0x3f,0xff,0xfc,0x10,
-0xcf,0x49,0x13,0x3f,0x44,0x3e,0x13,0x3f,0x4d,0x46,0x13,0x3f,0x44,0x3e,0x13,0x3f,
-0x6d,0x46,0x09,0x10,0x00,0x04,0x20,0x00,0x01,0x30,0x00,0x01,0x40,0x00,0x22,0xf5,
-0x3f,0x8d,0x43,0x23,0xe0,0x3f,0xa4,0x3e,0x06,0x70,0x00,0x04,0x80,0x00,0x0f,0xb8,
-0x00,0x1b,0x70,0x00,0x3d,0xfa,0x00,0x00,0x7e,0xe5,0x6c,0x00,0x12,0xf6,0x34,0x37,
-0x11,0xbf,0x0b,0x3b,0x11,0x00,0x5c,0x0e,0x3f,0x06,0xdc,0x40,0xde,0x01,0xba,0x04,
-0x6d,0x1f,0x1b,0x30,0x0b,0x00,0x11,0x05,0x19,0x66,0x0f,0x87,0x32,0xf9,0x13,0xcf,
-0xef,0x07,0x04,0x08,0x00,0x10,0x69,0x21,0x01,0x1f,0x90,0xef,0x17,0x89,0x24,0x88,
-0x50,0xd2,0x6c,0x00,0x0c,0x6d,0x32,0x4f,0xff,0x10,0x02,0x02,0x45,0xfd,0x9a,0xff,
-0xfb,0x24,0x62,0x04,0xc3,0x2f,0x4f,0x02,0xae,0xff,0xc7,0x1d,0x38,0xfa,0x41,0xbf,
-0xf8,0x00,0x04,0x76,0x3e,0x51,0xfe,0x40,0x2c,0xff,0xc0,0xcc,0x3c,0x02,0x8e,0x29,
-0x13,0xdf,0x5c,0x69,0x3f,0x03,0x78,0x74,0xae,0x1a,0x8c,0x0f,0xb2,0x01,0x25,0x16,
+0xf2,0x09,0x84,0x07,0x71,0x0c,0xff,0xf1,0x1f,0xff,0xc0,0x0a,0xbd,0x07,0x71,0x06,
+0xff,0xf7,0x7f,0xff,0x60,0x0a,0xa7,0x00,0x52,0x01,0xff,0xfd,0xdf,0xff,0xa9,0x00,
+0x10,0xb0,0x19,0x07,0x14,0xfa,0x0c,0x00,0x10,0x4f,0xc8,0x08,0x03,0x0c,0x00,0x10,
+0x0e,0xdf,0x08,0x03,0x0c,0x00,0x10,0x09,0xb8,0x01,0x03,0x0c,0x00,0x10,0x03,0xb7,
+0x00,0x13,0x0b,0xef,0x00,0x23,0xdf,0xfc,0xf1,0x00,0x15,0xe1,0xf5,0x03,0x14,0xa0,
+0x96,0x03,0x24,0xff,0x40,0x13,0x00,0x15,0xfe,0x13,0x00,0x15,0xf8,0x1b,0x04,0x14,
+0xf3,0x13,0x00,0x22,0xff,0xc0,0x13,0x00,0x10,0xfe,0xa1,0x02,0x01,0x13,0x00,0x42,
+0xba,0xff,0xff,0x10,0xcf,0x03,0x00,0xcd,0x02,0x02,0xe2,0x03,0x33,0x6f,0xff,0xf5,
+0xe2,0x03,0x32,0xcf,0xff,0xe1,0x13,0x00,0x42,0x02,0xff,0xff,0x92,0x13,0x00,0x10,
+0x08,0x0b,0x09,0x01,0x08,0x04,0x33,0x0d,0xff,0xfe,0x08,0x04,0x12,0x4f,0x67,0x04,
+0x10,0xb0,0x32,0x01,0x03,0x13,0x00,0x24,0x01,0xef,0x13,0x00,0x14,0x05,0x13,0x00,
+0x00,0xbd,0x00,0x03,0x41,0x04,0x15,0x2f,0x41,0x04,0x11,0x7f,0xf4,0x02,0x20,0x6b,
+0xef,0x58,0x03,0x13,0x00,0x30,0x05,0x12,0xe6,0x9a,0x08,0x12,0xff,0x70,0x0a,0x00,
+0xd4,0x00,0x00,0x4d,0x00,0x00,0xba,0x00,0x71,0xf8,0x10,0x01,0x7f,0xff,0xff,0x30,
+0xee,0x05,0x00,0x6b,0x08,0x22,0xb0,0x1f,0x71,0x0a,0x62,0xcf,0xff,0xf1,0x5f,0xff,
+0xf7,0xeb,0x05,0x42,0xf6,0x8f,0xff,0xf4,0x21,0x0b,0x13,0xf8,0xc2,0x08,0x32,0x1f,
+0xff,0xfa,0xdf,0x08,0x00,0x6a,0x02,0x06,0x0a,0x00,0x06,0x1e,0x00,0x05,0x32,0x00,
+0x16,0xf9,0x46,0x00,0x05,0x5a,0x00,0x11,0xf2,0x6e,0x00,0x00,0xc7,0x00,0x11,0xc0,
+0x82,0x00,0x00,0x5d,0x02,0x11,0x40,0xee,0x05,0x00,0xb4,0x0b,0x08,0xaa,0x00,0x25,
+0x00,0x5e,0x81,0x02,0x01,0xd2,0x00,0x13,0x10,0xb9,0x03,0x04,0xee,0x08,0x01,0xcd,
+0x03,0x23,0xff,0xff,0x8f,0x0b,0x00,0xc2,0x0a,0x10,0xcd,0x13,0x00,0x01,0x13,0x01,
+0x14,0x09,0x7c,0x0a,0x24,0x00,0xbf,0x9d,0x08,0x1d,0x6f,0xc1,0x08,0x12,0x9f,0x1b,
+0x00,0x00,0x6e,0x09,0x14,0xf0,0x3f,0x00,0x2a,0x90,0xff,0x88,0x0a,0x22,0xff,0x90,
+0x09,0x00,0x26,0xeb,0x82,0x15,0x08,0x0f,0x09,0x00,0x2d,0x0f,0xa2,0x01,0x09,0x17,
+0x90,0xa2,0x01,0x11,0x03,0xa2,0x01,0x51,0x8f,0xff,0xff,0x30,0x0b,0xb8,0x04,0x02,
+0xa2,0x01,0x1a,0xfc,0xa2,0x01,0x33,0x7f,0xff,0xf5,0x80,0x0a,0x10,0x3f,0x3d,0x06,
+0x1a,0xf1,0xa2,0x01,0x0f,0x0a,0x00,0x04,0x06,0x32,0x00,0x05,0xa2,0x01,0x16,0xf5,
+0xfc,0x01,0x06,0x6e,0x00,0x14,0x03,0xa2,0x01,0x32,0x20,0x00,0x8f,0xa2,0x01,0x15,
+0xf7,0xaa,0x00,0x24,0x70,0x00,0x90,0x07,0x13,0x40,0xd2,0x00,0x05,0xf2,0x0c,0x00,
+0x32,0x00,0x11,0xb1,0x0a,0x00,0x00,0xcc,0x07,0x13,0xe3,0x15,0x00,0xd0,0x1c,0xfd,
+0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x00,0x10,0xff,0x01,0x00,0x51,
+0xda,0x60,0x00,0x00,0xff,0x01,0x00,0x23,0xfe,0x60,0x09,0x00,0xf1,0x06,0xff,0xf7,
+0x00,0xff,0xff,0xeb,0xbb,0xcd,0xff,0xff,0xff,0x20,0xff,0xff,0xb0,0x00,0x00,0x2c,
+0xff,0xff,0x90,0x09,0x00,0x41,0x02,0xff,0xff,0xc0,0x09,0x00,0x42,0x00,0xdf,0xff,
+0xd0,0x09,0x00,0x13,0xef,0x09,0x00,0x40,0x04,0xff,0xff,0xa0,0x09,0x00,0x53,0x02,
+0x7e,0xff,0xff,0x40,0x48,0x00,0x14,0xfa,0x51,0x00,0x13,0x90,0x09,0x00,0x10,0xf3,
+0x6c,0x00,0x70,0xec,0xcc,0xdf,0xff,0xf4,0x00,0x00,0x2d,0x00,0x32,0x2f,0xff,0xfd,
+0x09,0x00,0x40,0x0a,0xff,0xff,0x50,0x09,0x00,0x00,0x62,0x00,0x21,0xd0,0x00,0x51,
+0x00,0x32,0x9f,0xff,0xf6,0x09,0x00,0x32,0x1f,0xff,0xfe,0x09,0x00,0x41,0x09,0xff,
+0xff,0x70,0x09,0x00,0x42,0x01,0xff,0xff,0xe0,0x7e,0x00,0xb1,0x8f,0xff,0xf7,0x00,
+0x00,0x17,0xbd,0xff,0xec,0x72,0x00,0x20,0x00,0x01,0x6c,0x00,0x21,0x00,0xcf,0x09,
+0x00,0x10,0xfc,0x11,0x00,0xa0,0xfe,0xcb,0xef,0xff,0xff,0x90,0x0f,0xff,0xff,0x60,
+0xa2,0x00,0xf0,0x09,0xf2,0x2f,0xff,0xfa,0x00,0x00,0x00,0x7f,0xff,0xf6,0x2f,0xff,
+0xf8,0x00,0x00,0x00,0x2b,0xbb,0xb5,0x0e,0xff,0xfe,0x30,0x00,0x01,0x00,0x42,0x07,
+0xff,0xff,0xfa,0x0a,0x00,0x53,0xaf,0xff,0xff,0xfe,0x94,0x13,0x00,0x30,0xff,0xff,
+0xe7,0x0a,0x00,0x60,0x19,0xef,0xff,0xff,0xff,0xd3,0x0a,0x00,0x52,0x05,0xaf,0xff,
+0xff,0xff,0x28,0x00,0xf2,0x0a,0x5c,0xff,0xff,0xd0,0x12,0x22,0x10,0x00,0x00,0x00,
+0xbf,0xff,0xf4,0xef,0xff,0xd0,0x00,0x00,0x00,0x4f,0xff,0xf7,0xbf,0xff,0xf2,0x09,
+0x00,0xf2,0x05,0x6f,0xff,0xfd,0x30,0x00,0x02,0xdf,0xff,0xf5,0x0c,0xff,0xff,0xfd,
+0xba,0xcf,0xff,0xff,0xe0,0x01,0xdf,0x07,0x01,0x13,0x40,0xab,0x00,0xd3,0xd4,0x00,
+0x00,0x00,0x16,0xad,0xef,0xed,0xa5,0x00,0x00,0x6f,0xff,0x01,0x00,0x1f,0xf2,0x0a,
+0x00,0x01,0xe4,0x4b,0xbb,0xbb,0xbd,0xff,0xff,0xcb,0xbb,0xbb,0xb1,0x00,0x00,0x00,
+0x08,0x80,0x00,0x0f,0x0a,0x00,0x95,0x32,0x3f,0xff,0xf8,0x4d,0x01,0x41,0x43,0xff,
+0xff,0x80,0x7f,0x01,0x1f,0xf4,0x13,0x00,0x5f,0x14,0x2f,0x13,0x00,0x41,0x31,0xff,
+0xff,0xa0,0xe5,0x01,0xf1,0x10,0xf2,0x0e,0xff,0xfe,0x00,0x00,0x00,0x1e,0xff,0xfe,
+0x00,0x9f,0xff,0xfc,0x20,0x00,0x2b,0xff,0xff,0x90,0x01,0xff,0xff,0xff,0xdc,0xdf,
+0xff,0xff,0xf1,0x00,0x04,0x7b,0x01,0x00,0xa9,0x02,0x34,0x03,0xdf,0xff,0xfd,0x01,
+0x50,0x49,0xde,0xfe,0xda,0x50,0xef,0x01,0x22,0xf7,0x00,0x70,0x02,0x51,0xa5,0xff,
+0xff,0xc0,0x00,0x0f,0x03,0x40,0xf4,0x0f,0xff,0xff,0x0b,0x02,0x72,0x2f,0xff,0xfe,
+0x00,0xaf,0xff,0xf5,0x6c,0x00,0x22,0x80,0x04,0x6d,0x00,0xb0,0xcf,0xff,0xf3,0x00,
+0x0e,0xff,0xff,0x00,0x00,0x00,0x1f,0xf2,0x02,0x10,0x9f,0x57,0x00,0x61,0x06,0xff,
+0xff,0x70,0x00,0x03,0xb0,0x02,0x60,0xbf,0xff,0xf1,0x00,0x00,0x0d,0x8e,0x00,0x31,
+0x0f,0xff,0xfc,0xaf,0x00,0x10,0xf3,0x80,0x00,0x11,0x60,0x71,0x03,0xd0,0x70,0x00,
+0x9f,0xff,0xf0,0x00,0x00,0x00,0x0c,0xff,0xfc,0x00,0x0e,0xbf,0x02,0x00,0x2d,0x02,
+0x20,0xf1,0x03,0x46,0x02,0x01,0x0a,0x03,0x40,0x60,0x8f,0xff,0xe0,0x15,0x00,0x61,
+0x0b,0xff,0xfb,0x0d,0xff,0xf9,0x78,0x01,0x34,0x5f,0xff,0xf2,0x84,0x01,0x31,0xff,
+0xff,0xcf,0x99,0x02,0x02,0x1e,0x03,0x12,0xf8,0x98,0x01,0x10,0x4f,0xda,0x03,0x02,
+0x0b,0x00,0x13,0xef,0xc1,0x00,0x01,0xad,0x01,0x22,0xf6,0x00,0x01,0x00,0x12,0x2f,
+0xcb,0x00,0x31,0x5f,0xff,0xf5,0x62,0x00,0x10,0x20,0x32,0x00,0x20,0xf5,0x1f,0x3e,
+0x00,0x10,0x05,0xa8,0x03,0x20,0x00,0x7f,0x3c,0x01,0x11,0xfb,0x33,0x00,0x10,0x90,
+0x4a,0x01,0x40,0xe0,0x0a,0xff,0xfe,0xa1,0x00,0x20,0xff,0xd0,0x0a,0x01,0x20,0xa0,
+0x06,0x3f,0x00,0x40,0x0f,0xff,0xff,0xf1,0x7f,0x00,0x11,0x70,0xaa,0x00,0x10,0x4f,
+0x4a,0x01,0x10,0x03,0x95,0x00,0x00,0xd1,0x00,0x40,0x8f,0xff,0xff,0xf8,0x00,0x01,
+0x00,0xfa,0x00,0x80,0xb0,0x00,0xcf,0xff,0xef,0xfc,0x00,0x0a,0xf9,0x00,0x00,0xca,
+0x00,0x80,0xff,0xfb,0xaf,0xff,0x00,0x0d,0xff,0xf8,0x74,0x00,0x20,0xf1,0x03,0x46,
+0x03,0x40,0x30,0x0f,0xff,0xf4,0x1a,0x01,0x82,0xf4,0x07,0xff,0xf3,0x2f,0xff,0x70,
+0x3f,0x2d,0x01,0xa0,0xf7,0x0b,0xff,0xf0,0x0e,0xff,0xb0,0x6f,0xff,0xd0,0xdb,0x00,
+0xa0,0xfa,0x0f,0xff,0xb0,0x0a,0xff,0xe0,0x9f,0xff,0x90,0xa4,0x00,0x83,0xfe,0x3f,
+0xff,0x70,0x06,0xff,0xf2,0xcf,0x42,0x01,0x62,0x8f,0xff,0x30,0x02,0xff,0xf6,0xf3,
+0x00,0xa3,0xef,0xff,0xef,0xfe,0x00,0x00,0xef,0xfc,0xff,0xfe,0xea,0x03,0x14,0xfb,
+0x06,0x00,0x00,0xd7,0x00,0x21,0xff,0xf7,0x8a,0x03,0x01,0xde,0x01,0x11,0x3f,0xaf,
+0x04,0x11,0x2f,0x06,0x00,0x00,0x7f,0x00,0x00,0x66,0x01,0x21,0x0e,0xff,0x8b,0x01,
+0x21,0x00,0x0c,0x7e,0x04,0x13,0x0a,0x3c,0x01,0x10,0x08,0xd4,0x00,0x00,0xd0,0x00,
+0x11,0x80,0x36,0x00,0x11,0x30,0x10,0x02,0x21,0xf8,0x09,0x24,0x00,0x10,0x06,0x38,
+0x00,0x10,0xef,0xc1,0x00,0x10,0x0e,0x08,0x01,0x30,0x5f,0xff,0xfd,0x68,0x00,0x11,
+0xfb,0x43,0x00,0x51,0x60,0x01,0xff,0xff,0xf2,0xa2,0x00,0x10,0xe0,0xdb,0x04,0x02,
+0xcf,0x04,0x01,0x13,0x05,0x01,0x2e,0x00,0x10,0xcf,0x36,0x00,0x01,0x73,0x01,0x02,
+0x45,0x02,0x00,0x2e,0x01,0x02,0x99,0x01,0x01,0x97,0x00,0x01,0xa5,0x00,0x01,0x71,
+0x00,0x12,0xf9,0x0a,0x00,0x14,0xdf,0x99,0x04,0x01,0xb7,0x04,0x01,0x9a,0x00,0x10,
+0x1f,0x46,0x00,0x11,0xf6,0xea,0x00,0x00,0x5a,0x00,0x21,0xfe,0x10,0xa8,0x05,0x00,
+0x6e,0x00,0x10,0xa0,0x44,0x01,0x60,0xff,0x50,0x01,0xef,0xff,0xf3,0x77,0x00,0x10,
+0xfc,0x96,0x00,0x10,0xfd,0x8b,0x00,0x11,0xf3,0x19,0x00,0x20,0x70,0x0b,0x23,0x00,
+0x00,0x2d,0x00,0x42,0xf1,0x5f,0xff,0xff,0xe3,0x04,0x27,0xfb,0xbf,0x4b,0x00,0x22,
+0xfd,0x00,0x87,0x05,0x01,0xb9,0x05,0x00,0x5c,0x02,0x10,0x60,0x1c,0x06,0x08,0xe0,
+0x02,0x30,0x8f,0xff,0xf5,0x0f,0x00,0x10,0xfb,0x74,0x01,0x12,0xc0,0x0c,0x04,0x12,
+0x07,0xb5,0x02,0x44,0xef,0xff,0xa0,0x0e,0x72,0x01,0x42,0xf2,0x5f,0xff,0xf3,0xf0,
+0x00,0x22,0xf9,0xdf,0xe6,0x00,0x25,0x06,0xff,0x9e,0x02,0x15,0xdf,0xdc,0x00,0x11,
+0x4f,0x4e,0x02,0x03,0x7b,0x01,0x15,0x80,0xb1,0x02,0x1f,0x40,0x0a,0x00,0x36,0x23,
+0xdf,0xff,0xa2,0x06,0x0d,0x09,0x00,0x71,0xf2,0x9b,0xbb,0xbb,0xbb,0xbb,0xbe,0xeb,
+0x02,0x01,0x70,0x01,0x14,0xfd,0x6f,0x01,0x14,0xf3,0x58,0x03,0x13,0x70,0x76,0x03,
+0x11,0xfb,0x08,0x00,0x44,0x01,0xef,0xff,0xe1,0xab,0x00,0x02,0x65,0x00,0x13,0x8f,
+0xc7,0x00,0x23,0x03,0xff,0x8c,0x03,0x14,0x1e,0xe2,0x00,0x13,0xaf,0x74,0x03,0x12,
+0x06,0xcf,0x06,0x22,0x00,0x00,0xa5,0x01,0x02,0x52,0x04,0x04,0x5f,0x00,0x14,0x80,
+0x03,0x01,0x10,0xbb,0x01,0x00,0x24,0xb5,0xdf,0xa6,0x07,0x0e,0x09,0x00,0x86,0x07,
+0x77,0x77,0x74,0x2f,0xff,0xff,0xfa,0x04,0x00,0x2f,0xf6,0x00,0x04,0x00,0x4b,0x19,
+0xfa,0x70,0x00,0x12,0xcf,0x77,0x02,0x13,0x06,0x89,0x02,0x13,0x1f,0xf8,0x00,0x12,
+0xaf,0xa2,0x04,0x11,0x04,0x2c,0x02,0x00,0x60,0x02,0x23,0xfb,0x00,0xfe,0x01,0x12,
+0x00,0x47,0x02,0x12,0x80,0xc1,0x04,0x13,0xfe,0x48,0x01,0x13,0xf4,0x9b,0x04,0x13,
+0xa0,0xa1,0x01,0x12,0x10,0x1a,0x01,0x02,0xf2,0x02,0x03,0xd0,0x04,0x04,0x64,0x00,
+0x13,0x0f,0x64,0x00,0x02,0x25,0x05,0x00,0x63,0x01,0x12,0x60,0x64,0x00,0x1f,0xfc,
+0x64,0x00,0x01,0x12,0x0a,0x64,0x00,0x00,0xd0,0x04,0x03,0x64,0x00,0x11,0xb0,0x9a,
+0x00,0x80,0x88,0x87,0x00,0x57,0x77,0x77,0x6c,0xff,0x30,0x03,0x50,0xff,0xfc,0xff,
+0xff,0xff,0x50,0x00,0x1f,0x09,0x07,0x00,0x3c,0x47,0x57,0xcf,0xff,0xfc,0x62,0x00,
+0x22,0x00,0x0d,0xca,0x00,0x12,0x4f,0xf0,0x00,0x11,0xbf,0x16,0x01,0x12,0x02,0xfd,
+0x02,0x50,0x08,0xff,0xcc,0xff,0x80,0x16,0x03,0x30,0x66,0xff,0xe0,0x93,0x04,0x10,
+0x00,0x28,0x02,0xf2,0x0d,0xdf,0xfa,0x00,0xaf,0xfd,0x00,0x04,0xff,0xf3,0x00,0x3f,
+0xff,0x30,0x0a,0xff,0xd0,0x00,0x0d,0xff,0xa0,0x1f,0xff,0x70,0x00,0x07,0xff,0xf1,
+0x77,0x01,0x00,0x13,0x1f,0xb5,0x06,0x03,0x10,0x02,0x13,0x4f,0x0f,0x00,0x80,0x0a,
+0xcc,0xcb,0x00,0x00,0x2e,0xff,0xf9,0xbe,0x02,0x10,0xf3,0x71,0x00,0x10,0xd0,0x66,
+0x01,0x71,0x80,0x00,0x02,0x7c,0xef,0xfc,0x82,0xa0,0x02,0x10,0xff,0xc5,0x02,0x02,
+0x95,0x08,0x10,0xf6,0xe3,0x02,0x81,0x65,0x8f,0xff,0xfe,0x00,0x7f,0xff,0xf1,0x67,
+0x01,0x51,0x01,0x11,0x10,0x00,0x02,0x58,0x01,0x30,0x36,0x89,0x9a,0x08,0x00,0x11,
+0x6e,0x29,0x00,0x32,0x60,0x0a,0xff,0x08,0x00,0x40,0x5f,0xff,0xfb,0x31,0x89,0x06,
+0x31,0xbf,0xff,0xd0,0x91,0x06,0x33,0xef,0xff,0x90,0x08,0x00,0x11,0xd0,0x1a,0x04,
+0x92,0xaf,0xff,0xfc,0x77,0xdf,0xff,0xff,0x60,0x3f,0x30,0x00,0x10,0x70,0xd2,0x04,
+0x10,0xfd,0x25,0x00,0x83,0x29,0xdf,0xfc,0x70,0xaf,0xff,0xe0,0x4f,0xf1,0x01,0x0f,
+0x08,0x00,0x20,0x81,0x3a,0xef,0xea,0x30,0x00,0x4f,0xff,0xfa,0xb5,0x0a,0x13,0x4f,
+0x90,0x00,0x60,0x4f,0xff,0xff,0xfb,0xad,0xff,0x58,0x00,0x20,0xfc,0x10,0x47,0x0a,
+0x12,0x4f,0x40,0x06,0x11,0xfa,0x08,0x00,0x31,0x0b,0xff,0xfd,0x08,0x00,0x30,0x09,
+0xff,0xfe,0x08,0x00,0x00,0x5f,0x02,0x09,0x10,0x00,0x03,0x20,0x00,0x00,0x6b,0x07,
+0x06,0x40,0x00,0x66,0xff,0xfa,0xad,0xff,0xff,0xf0,0x60,0x00,0x10,0xf8,0x4c,0x07,
+0x00,0x48,0x01,0x30,0x4b,0xef,0xea,0x86,0x02,0x50,0x5b,0xef,0xfd,0x92,0x00,0xec,
+0x09,0x00,0x17,0x00,0x31,0x02,0xef,0xff,0x08,0x00,0xa0,0xcf,0xff,0xfd,0xab,0xff,
+0xff,0xf2,0x4f,0xff,0xf9,0x96,0x02,0x30,0x89,0xff,0xfe,0x65,0x00,0x20,0xfb,0xdf,
+0x72,0x02,0x33,0x37,0x77,0x5e,0xb7,0x02,0x03,0x98,0x02,0x13,0x0e,0x0f,0x00,0x01,
+0x1e,0x00,0x01,0x8d,0x00,0x00,0x9a,0x00,0x22,0xfc,0x4f,0x4f,0x00,0x84,0x90,0xcf,
+0xff,0xfd,0x9b,0xff,0xff,0xf2,0x5a,0x00,0x01,0x69,0x00,0x11,0xf7,0x78,0x00,0x23,
+0xed,0x82,0xb4,0x07,0x0f,0x45,0x01,0x21,0x40,0x03,0xae,0xfe,0xa3,0x08,0x00,0x00,
+0x69,0x0a,0x43,0xaf,0xff,0xf4,0x05,0x2f,0x02,0x80,0x0e,0xff,0xff,0xea,0xbf,0xff,
+0xff,0xf4,0xd1,0x04,0x71,0x01,0xdf,0xff,0xf4,0xaf,0xff,0xf1,0x30,0x00,0x31,0xdf,
+0xff,0xc0,0x08,0x00,0x00,0xbb,0x01,0x00,0x08,0x00,0x01,0xbc,0x00,0x07,0x10,0x00,
+0x00,0xbd,0x00,0x00,0x08,0x00,0x13,0x9f,0x30,0x00,0x30,0x5f,0xff,0xfa,0x40,0x00,
+0x00,0x50,0x00,0x10,0xda,0x50,0x00,0x05,0x53,0x09,0x20,0x6f,0xff,0x95,0x07,0x70,
+0xf4,0x00,0x02,0x9e,0xfe,0xb3,0x0d,0x90,0x00,0x44,0x39,0xdf,0xfd,0xa4,0xc1,0x0b,
+0x13,0xa0,0xc0,0x0b,0x10,0xfb,0x9b,0x01,0x60,0xeb,0xbe,0xff,0xff,0x60,0x1f,0x88,
+0x01,0x60,0xbf,0xff,0xd0,0x6f,0xff,0xf3,0xc2,0x02,0x11,0xf2,0x4f,0x04,0x52,0x1f,
+0xff,0xf5,0xcf,0xff,0xb1,0x02,0x1a,0xdf,0x07,0x05,0x23,0xf7,0xbf,0x66,0x05,0x11,
+0x7f,0xeb,0x00,0x10,0x10,0x54,0x05,0x40,0x40,0x00,0x03,0xda,0x5f,0x00,0x20,0xfc,
+0xaa,0x66,0x06,0x22,0xbf,0xff,0x69,0x00,0x23,0x09,0xff,0x14,0x09,0x50,0x28,0xce,
+0xfe,0xc7,0x20,0x7e,0x03,0x33,0x9d,0xff,0xd5,0x02,0x08,0x10,0x03,0x63,0x01,0x00,
+0xe3,0x07,0x61,0xeb,0xa4,0x00,0x0e,0xff,0xfd,0x6a,0x04,0x14,0xf8,0x06,0x00,0x01,
+0x31,0x03,0x18,0xd0,0x06,0x00,0x68,0x24,0x4f,0xff,0xfa,0x44,0x30,0x24,0x00,0x0f,
+0x06,0x00,0x30,0x71,0x01,0x8d,0xff,0xc7,0x09,0xff,0xf8,0xd9,0x02,0x42,0xdd,0xff,
+0xf8,0x03,0xe0,0x00,0xf1,0x05,0xf8,0x0d,0xff,0xff,0xfb,0xae,0xff,0xff,0xf8,0x4f,
+0xff,0xfd,0x10,0x00,0x8f,0xff,0xf8,0x9f,0xff,0xf3,0x32,0x00,0x00,0x1a,0x05,0x00,
+0x08,0x00,0x00,0x49,0x07,0x00,0x08,0x00,0x01,0x98,0x01,0x07,0x10,0x00,0x04,0x20,
+0x00,0x04,0x30,0x00,0x00,0xe0,0x02,0x00,0x40,0x00,0x12,0x0c,0xe0,0x02,0x05,0x60,
+0x00,0x80,0x00,0x4e,0xff,0xff,0xff,0xbf,0xff,0xf8,0x80,0x00,0x45,0xc6,0x1f,0xff,
+0xf7,0x32,0x05,0x50,0x6c,0x20,0x00,0x02,0xdf,0x96,0x09,0x73,0xfc,0x88,0xaf,0xff,
+0xff,0x90,0x0a,0x67,0x0d,0x02,0x0f,0x01,0x20,0xa1,0x00,0x50,0x04,0x20,0xec,0x83,
+0x40,0x01,0x01,0x74,0x05,0x0f,0x08,0x00,0x21,0x81,0x19,0xdf,0xec,0x60,0x00,0x6f,
+0xff,0xf6,0x3d,0x0e,0x13,0x6f,0x70,0x03,0x60,0x6f,0xff,0xff,0xea,0xbe,0xff,0x00,
+0x02,0x10,0xfa,0x1c,0x02,0x11,0xf0,0x30,0x00,0x10,0x6f,0x20,0x0d,0x10,0xf2,0x98,
+0x00,0x1f,0xf3,0x08,0x00,0x3d,0xe2,0x05,0xef,0xa1,0x2f,0xff,0xf9,0x3f,0xff,0xfb,
+0x0e,0xff,0xf6,0x01,0x78,0x28,0x08,0x00,0x30,0x01,0x0f,0x03,0x00,0x1d,0x40,0x00,
+0x00,0x6e,0xfa,0xb1,0x02,0x30,0xf7,0x00,0x05,0x6e,0x02,0x10,0x1e,0x8f,0x02,0x23,
+0x18,0x84,0xb0,0x03,0x03,0x54,0x00,0x02,0x02,0x04,0x0f,0x09,0x00,0x33,0xf0,0x08,
+0x70,0x00,0x5f,0xff,0xf6,0x5b,0xbf,0xff,0xff,0x27,0xff,0xff,0xff,0xb0,0x7f,0xff,
+0xff,0xd1,0x06,0xef,0xfc,0x70,0x00,0x40,0x4f,0xff,0xf4,0x00,0x01,0x00,0x41,0x04,
+0xff,0xff,0x40,0x09,0x00,0x0f,0x11,0x00,0x1c,0x40,0x1e,0xff,0xff,0x70,0x11,0x00,
+0x40,0x0c,0xff,0xff,0x90,0x11,0x00,0x40,0x0a,0xff,0xff,0xb0,0x22,0x00,0x40,0x08,
+0xff,0xff,0xc0,0x22,0x00,0x40,0x45,0xff,0xff,0xe1,0x33,0x00,0x41,0xf7,0xff,0xff,
+0xf3,0x33,0x00,0x11,0xff,0x3e,0x00,0x10,0x4f,0x09,0x00,0x13,0x10,0x11,0x00,0x14,
+0xfb,0x11,0x00,0x11,0xf6,0x11,0x00,0x40,0xf9,0xef,0xff,0xf1,0x11,0x00,0x20,0xf9,
+0x04,0x4c,0x00,0x03,0x55,0x00,0x10,0x60,0x77,0x00,0x00,0x6e,0x00,0x11,0x10,0x77,
+0x00,0x32,0x6f,0xff,0xfb,0x88,0x00,0x31,0xbf,0xff,0xf6,0x11,0x00,0x7f,0x02,0xff,
+0xff,0xf1,0x0f,0xff,0xf8,0x03,0x00,0x32,0xf1,0x07,0x4f,0xff,0xf0,0x18,0xdf,0xfc,
+0x70,0x00,0x4a,0xef,0xeb,0x40,0x04,0xff,0xff,0x6f,0xff,0xff,0xff,0xb0,0xaf,0xff,
+0xe9,0x00,0x01,0x01,0x00,0x10,0xdf,0x05,0x00,0xf0,0x0b,0x34,0xff,0xff,0xfe,0xbb,
+0xef,0xff,0xff,0xfe,0xab,0xff,0xff,0xf9,0x4f,0xff,0xfc,0x10,0x01,0xdf,0xff,0xfb,
+0x00,0x01,0xff,0xff,0xc4,0x8f,0x00,0x81,0x08,0xff,0xff,0x20,0x00,0x0a,0xff,0xfe,
+0xa4,0x00,0x10,0x6f,0xd0,0x00,0x30,0x9f,0xff,0xf4,0x19,0x00,0x10,0x06,0xf7,0x00,
+0x3f,0x09,0xff,0xff,0x19,0x00,0x5d,0x50,0xf0,0x5f,0xff,0xe0,0x29,0xd5,0x00,0x92,
+0x5f,0xff,0xf5,0xff,0xff,0xff,0xfc,0x00,0x5f,0xcc,0x00,0xa0,0x70,0x5f,0xff,0xff,
+0xea,0xbe,0xff,0xff,0xd0,0x5f,0x87,0x01,0x60,0xcf,0xff,0xf1,0x5f,0xff,0xf2,0x35,
+0x00,0x11,0xf2,0x08,0x00,0x3f,0x4f,0xff,0xf3,0x08,0x00,0x3d,0xb0,0x00,0x00,0x4a,
+0xdf,0xfd,0xa4,0x00,0x00,0x00,0x01,0xbf,0x88,0x00,0x31,0x10,0x00,0x01,0x4f,0x01,
+0xc0,0xfe,0x10,0x00,0xaf,0xff,0xfe,0xaa,0xef,0xff,0xfc,0x00,0x2f,0x8a,0x00,0x11,
+0xbf,0x43,0x02,0x10,0x10,0x51,0x01,0xf5,0x0b,0xa0,0xcf,0xff,0xc0,0x00,0x00,0x0a,
+0xff,0xfd,0x0e,0xff,0xf9,0x00,0x00,0x00,0x8f,0xff,0xf0,0xff,0xff,0x80,0x00,0x00,
+0x07,0xff,0xff,0x11,0x00,0x94,0xcf,0xff,0xb0,0x00,0x00,0x0b,0xff,0xfe,0x09,0x33,
+0x00,0x10,0x3f,0x44,0x00,0x53,0xaf,0xff,0xf4,0x00,0xbf,0x55,0x00,0x23,0x01,0xef,
+0x66,0x00,0x20,0x01,0xcf,0x77,0x00,0x20,0x20,0x00,0x88,0x00,0x21,0xfe,0xa5,0x7a,
+0x02,0xe3,0xf0,0x4b,0xef,0xea,0x30,0x00,0x4f,0xff,0xfa,0xff,0xff,0xff,0xf7,0x00,
+0xe5,0x01,0xc0,0x50,0x4f,0xff,0xff,0xfb,0xae,0xff,0xff,0xe0,0x4f,0xff,0xfc,0x8f,
+0x00,0x11,0xf5,0x4e,0x01,0x31,0x1f,0xff,0xfa,0x08,0x00,0x31,0x0c,0xff,0xfd,0x08,
+0x00,0x13,0x09,0xe3,0x01,0x04,0x6e,0x01,0x04,0xf3,0x01,0x04,0x20,0x00,0x10,0x1f,
+0x1c,0x02,0x00,0x8b,0x00,0x00,0x40,0x00,0x31,0xff,0xea,0xad,0x50,0x00,0x01,0x01,
+0x00,0x12,0x40,0x70,0x00,0x10,0xf6,0xc7,0x02,0x45,0x3a,0xef,0xea,0x20,0x57,0x03,
+0x0f,0x08,0x00,0x15,0xf2,0x02,0x00,0x03,0xae,0xfe,0xb4,0x0c,0xff,0xf4,0x00,0x7f,
+0xff,0xff,0xff,0x9e,0xff,0xf4,0x05,0x58,0x00,0xa2,0xf4,0x0e,0xff,0xff,0xea,0xae,
+0xff,0xff,0xf4,0x6f,0xd1,0x01,0x22,0xf4,0xaf,0x4e,0x03,0x41,0xf4,0xdf,0xff,0xc0,
+0x08,0x00,0x31,0xef,0xff,0x90,0x08,0x00,0x01,0x45,0x01,0x07,0x10,0x00,0x00,0x44,
+0x01,0x00,0x08,0x00,0x13,0x9f,0x30,0x00,0x30,0x5f,0xff,0xfa,0x2d,0x01,0x00,0x50,
+0x00,0x10,0xda,0x50,0x00,0x13,0x04,0x60,0x00,0x10,0x00,0x10,0x03,0x8f,0xbf,0xff,
+0xf4,0x00,0x02,0xae,0xfe,0xb3,0xb5,0x00,0x1c,0x00,0x08,0x00,0xb1,0x4f,0xff,0xf0,
+0x4c,0xff,0x44,0xff,0xff,0x7f,0xff,0xf4,0x0b,0x01,0x10,0x44,0x05,0x00,0xa3,0xf3,
+0x4f,0xff,0xff,0xd7,0x66,0x14,0xff,0xff,0xa0,0x2c,0x00,0x02,0x6e,0x04,0x0f,0x0b,
+0x00,0x1e,0x02,0xd7,0x01,0x50,0xb7,0x10,0x00,0x00,0x0a,0x57,0x00,0x10,0xe5,0xba,
+0x01,0x00,0x6e,0x01,0x00,0xc8,0x03,0xf2,0x0d,0xa4,0x37,0xff,0xff,0xd0,0x08,0xff,
+0xfd,0x00,0x00,0x7f,0xff,0xf2,0x08,0xff,0xfe,0x00,0x00,0x15,0x55,0x51,0x05,0xff,
+0xff,0xd7,0x30,0x00,0x00,0x28,0x00,0x21,0xb6,0x00,0xca,0x01,0x70,0xff,0xff,0xe6,
+0x00,0x00,0x00,0x28,0x29,0x02,0x11,0x60,0x52,0x00,0xf1,0x0c,0xff,0xff,0xf0,0x09,
+0x99,0x92,0x00,0x00,0x5f,0xff,0xf3,0x0f,0xff,0xf8,0x00,0x00,0x3f,0xff,0xf3,0x09,
+0xff,0xff,0x94,0x35,0xdf,0xff,0xf0,0xbe,0x02,0x00,0x28,0x00,0x21,0x1b,0xff,0x3e,
+0x02,0x71,0x00,0x00,0x49,0xdf,0xfe,0xc7,0x10,0x43,0x03,0x10,0x00,0x8a,0x03,0x18,
+0x20,0x0b,0x00,0x01,0x2d,0x00,0x10,0x0d,0x05,0x00,0x11,0xf0,0x0b,0x00,0x6e,0x03,
+0x48,0xff,0xff,0x54,0x40,0x2c,0x00,0x0f,0x0b,0x00,0x07,0x00,0xc0,0x03,0xf1,0x00,
+0x00,0x00,0x03,0xff,0xff,0xfb,0xb2,0x00,0x0e,0xff,0xff,0xff,0x30,0x00,0x5f,0x5a,
+0x05,0x53,0x4b,0xef,0xec,0x20,0x6f,0x63,0x03,0x0f,0x08,0x00,0x35,0x06,0xbb,0x03,
+0x11,0xf3,0x08,0x00,0x11,0x3f,0x12,0x02,0x00,0x04,0x01,0x41,0xff,0xda,0xbf,0xff,
+0x04,0x01,0x01,0xbc,0x01,0x10,0x00,0x2a,0x01,0xb1,0xaf,0xff,0xf3,0x00,0x07,0xcf,
+0xfe,0xa4,0x0f,0xff,0xf3,0x72,0x02,0x60,0x0e,0xff,0xfc,0x4f,0xff,0xf5,0x2c,0x01,
+0x11,0xf6,0xa7,0x03,0x60,0x7f,0xff,0xf1,0x0a,0xff,0xfe,0x92,0x02,0x60,0xb0,0x04,
+0xff,0xff,0x20,0x01,0x34,0x01,0x40,0xef,0xff,0x70,0x05,0xb2,0x03,0x61,0x9f,0xff,
+0xb0,0x09,0xff,0xfb,0x8b,0x03,0x30,0x0e,0xff,0xf6,0x3c,0x00,0x40,0xf4,0x2f,0xff,
+0xf1,0x8c,0x01,0x40,0xf9,0x7f,0xff,0xb0,0xe1,0x01,0x21,0xfd,0xbf,0x8b,0x01,0x12,
+0xef,0x36,0x06,0x22,0x00,0x9f,0x35,0x06,0x21,0x00,0x4f,0x34,0x06,0x00,0x31,0x00,
+0x00,0x2f,0x00,0x01,0xbd,0x01,0x13,0xb0,0x9b,0x06,0x10,0x60,0x73,0x00,0x51,0xe0,
+0x00,0x01,0xff,0xf8,0x09,0x00,0x00,0x50,0x00,0x30,0x05,0xff,0xfc,0x8a,0x03,0x51,
+0xa0,0x0e,0xff,0xf4,0x00,0x2a,0x04,0x60,0xdf,0xff,0x60,0x0a,0xff,0xf8,0x3e,0x00,
+0xf0,0x05,0x50,0x01,0xff,0xff,0x20,0x06,0xff,0xfb,0x00,0x3f,0xff,0xff,0xa0,0x04,
+0xff,0xfd,0x00,0x02,0xff,0xfe,0x59,0x03,0x40,0xe0,0x07,0xff,0xf9,0x77,0x00,0x80,
+0x10,0xcf,0xfd,0xff,0xf3,0x0b,0xff,0xf5,0x40,0x00,0x80,0x51,0xff,0xf5,0xef,0xf8,
+0x0e,0xff,0xf1,0x97,0x01,0xf0,0x05,0x85,0xff,0xf1,0x9f,0xfd,0x1f,0xff,0xd0,0x00,
+0x00,0x2f,0xff,0xba,0xff,0xc0,0x5f,0xff,0x7f,0xff,0x90,0x8f,0x00,0x82,0xee,0xff,
+0x70,0x0f,0xff,0xef,0xff,0x50,0x88,0x02,0x21,0x20,0x0b,0xb8,0x00,0x00,0xc2,0x01,
+0x12,0xfd,0x05,0x00,0x10,0x00,0xb1,0x06,0x10,0xf8,0x05,0x00,0x20,0xf9,0x00,0xd8,
+0x00,0x00,0xbc,0x02,0x10,0xdf,0x5f,0x00,0x00,0x61,0x00,0x10,0xf0,0xd4,0x04,0x01,
+0xd0,0x00,0x10,0x6f,0x10,0x03,0x12,0x3f,0x5f,0x00,0x10,0xfa,0xef,0x00,0x90,0xf8,
+0x00,0x9f,0xff,0xf3,0x00,0x0d,0xff,0xfe,0xd1,0x04,0x50,0xc0,0x06,0xff,0xff,0x60,
+0x08,0x05,0x20,0x51,0xef,0xdc,0x03,0x30,0x0d,0xff,0xfd,0x1d,0x00,0x02,0x4c,0x07,
+0x14,0xfa,0xd4,0x02,0x12,0x10,0x6c,0x00,0x00,0xed,0x03,0x00,0x23,0x00,0x01,0x21,
+0x00,0x20,0x00,0x05,0xd3,0x06,0x02,0x79,0x00,0x02,0xd6,0x07,0x31,0x7f,0xff,0xfe,
+0x96,0x00,0x61,0x1f,0xff,0xfb,0x5f,0xff,0xf7,0xb6,0x00,0x40,0x20,0xcf,0xff,0xe1,
+0x69,0x02,0x10,0x90,0x04,0x00,0x00,0x1a,0x06,0x00,0x15,0x00,0x40,0x30,0x6f,0xff,
+0xf7,0x26,0x00,0x11,0xfc,0x11,0x00,0x80,0x00,0x0f,0xff,0xfd,0x06,0xff,0xff,0x50,
+0x70,0x01,0x20,0x70,0x1f,0x74,0x00,0x00,0x3d,0x04,0x30,0xbf,0xff,0xf0,0xfe,0x01,
+0x00,0x65,0x00,0x20,0x40,0x02,0xa2,0x00,0x00,0x00,0x02,0x12,0x7f,0x87,0x06,0x41,
+0xd0,0x0c,0xff,0xfa,0xbf,0x02,0x40,0x21,0xff,0xff,0x50,0x90,0x00,0x41,0xf7,0x6f,
+0xff,0xe0,0xc4,0x05,0x32,0xcb,0xff,0xf9,0xaa,0x00,0x00,0xd4,0x02,0x10,0x00,0x50,
+0x08,0x22,0xff,0xe0,0x03,0x01,0x00,0xc2,0x01,0x10,0x00,0xd6,0x05,0x00,0xff,0x02,
+0x00,0xe7,0x05,0x21,0xff,0xc0,0xe9,0x03,0x01,0xa9,0x00,0x02,0x34,0x00,0x11,0x10,
+0x09,0x00,0x12,0x7f,0xd4,0x00,0x22,0x00,0x2e,0x15,0x02,0x43,0x1a,0xcf,0xff,0xfe,
+0x20,0x00,0x02,0xc8,0x03,0x10,0x2f,0xc9,0x00,0x00,0x4b,0x00,0x31,0xdf,0xec,0x50,
+0x29,0x00,0x12,0x9f,0xc1,0x02,0x03,0xc8,0x02,0x12,0xf0,0x0f,0x00,0x62,0xfe,0x05,
+0x99,0x99,0x99,0xaf,0x17,0x01,0x12,0x08,0x38,0x01,0x11,0x04,0x73,0x00,0x00,0x73,
+0x01,0x10,0xe2,0x37,0x00,0x12,0xcf,0xa9,0x01,0x12,0x8f,0xbc,0x01,0x01,0x20,0x06,
+0x10,0x00,0x9b,0x08,0x12,0x20,0xb8,0x00,0x12,0x50,0x39,0x00,0x12,0x90,0x39,0x00,
+0x62,0xfa,0x99,0x99,0x99,0x91,0xdf,0x62,0x00,0x13,0x3d,0x31,0x03,0x03,0x0f,0x00,
+0x10,0x30,0x54,0x00,0x11,0x73,0x2e,0x00,0x11,0x90,0xbf,0x06,0x00,0xd5,0x06,0x20,
+0xfd,0x10,0x96,0x01,0x10,0x20,0x58,0x00,0x10,0xd0,0x32,0x02,0x00,0xc9,0x01,0x01,
+0x55,0x02,0x01,0x8a,0x02,0x08,0x0b,0x00,0x60,0x9f,0xff,0x70,0x00,0x00,0x0d,0x3a,
+0x02,0x30,0x5c,0xff,0xfd,0x30,0x00,0x41,0xfd,0x20,0x00,0x04,0x56,0x00,0x11,0x4f,
+0x06,0x00,0x31,0x29,0xff,0xfe,0xf3,0x01,0x11,0xf5,0x2c,0x00,0x1e,0x80,0x42,0x00,
+0x02,0x0b,0x00,0x11,0x06,0x4b,0x03,0x11,0x3f,0x6e,0x01,0x30,0xdf,0xff,0x40,0x1d,
+0x02,0x20,0xfe,0x40,0x94,0x00,0x10,0xfd,0xc1,0x00,0x20,0xdf,0x70,0xdd,0x00,0x4f,
+0x41,0x00,0x4f,0xf7,0x02,0x00,0x1f,0x30,0x2a,0xa4,0x07,0x0c,0x01,0x30,0x0f,0xfd,
+0x30,0xad,0x01,0x22,0xf4,0x00,0x99,0x08,0x22,0x00,0xaf,0x79,0x06,0x10,0xc0,0x48,
+0x02,0x10,0xf0,0x44,0x02,0x0e,0x05,0x00,0x30,0x0e,0xff,0xf2,0x11,0x01,0x11,0xf7,
+0x42,0x01,0x10,0x83,0xa9,0x00,0x10,0xfd,0xdd,0x03,0x10,0xfd,0x3d,0x00,0x00,0x42,
+0x03,0x40,0xfe,0x50,0x00,0x0c,0xd8,0x00,0x12,0x0f,0x85,0x02,0x0e,0x41,0x00,0x10,
+0x2f,0x05,0x00,0x10,0x5f,0x64,0x00,0x00,0x39,0x04,0x11,0x19,0x20,0x01,0x00,0xbd,
+0x01,0x20,0x0e,0xfa,0x75,0x0a,0x01,0x2f,0x02,0xa1,0x06,0xcf,0xeb,0x40,0x00,0x00,
+0x27,0x77,0x00,0x0a,0x1e,0x03,0x40,0x06,0xff,0xf0,0x06,0x95,0x01,0xf0,0x03,0xb1,
+0x01,0xdf,0xfd,0x00,0xdf,0xff,0xcb,0xff,0xff,0xeb,0xef,0xff,0x80,0x2f,0xff,0x90,
+0x02,0xae,0x01,0x41,0xf1,0x04,0xff,0xf2,0xb2,0x08,0xa0,0xf5,0x00,0x26,0x66,0x00,
+0x00,0x00,0x6c,0xff,0xb3,0x44,0x00,0x70,0x33,0x10,0x00,0x00,0x4e,0xff,0xf9,0xd1,
+0x02,0xf0,0x0a,0xff,0x90,0x0c,0xfd,0x20,0x9f,0xf2,0x0f,0xf5,0x00,0x0f,0xf5,0x0f,
+0xf6,0x00,0x0f,0xf5,0x0a,0xff,0x75,0xcf,0xf1,0x01,0xef,0xff,0x80,0x00,0x81,0xef,
+0xc4,0x00,0x00,0x00,0x07,0xcc,0xcc,0xc1,0x02,0x02,0x43,0x02,0x14,0xc0,0x0b,0x00,
+0x13,0x1d,0xc7,0x02,0x02,0x61,0x02,0x05,0x22,0x00,0x13,0x2e,0xcd,0x02,0x0f,0x01,
+0x00,0x06,0x01,0xa8,0x07,0x02,0x01,0x00,0x03,0x23,0x03,0x11,0x00,0x62,0x01,0x13,
+0xfe,0x0b,0x00,0x13,0x0c,0xdb,0x03,0x02,0xf9,0x02,0x00,0x49,0x04,0x02,0xb5,0x02,
+0x03,0x2b,0x05,0x00,0x66,0x02,0x34,0x7e,0xff,0xf6,0xca,0x0b,0x01,0x23,0x01,0x01,
+0x5e,0x03,0x12,0xfc,0x44,0x02,0x00,0x9e,0x01,0x21,0xf7,0x00,0x1d,0x08,0x01,0xbd,
+0x05,0x00,0x44,0x0a,0x00,0x0b,0x00,0x00,0x47,0x08,0x11,0x3f,0x54,0x02,0x12,0x03,
+0xdc,0x03,0x12,0xfc,0x78,0x05,0x01,0x72,0x0a,0x10,0x20,0x7f,0x01,0x02,0x01,0x00,
+0x11,0x80,0xbb,0x03,0x01,0x01,0x00,0x10,0xe0,0xf0,0x00,0x03,0x3e,0x08,0x00,0x8e,
+0x03,0x70,0xec,0xcc,0xcc,0xcc,0xcf,0xff,0xfb,0x25,0x03,0x12,0x60,0x95,0x04,0x50,
+0x10,0x0e,0xff,0xff,0x00,0x23,0x01,0x01,0x91,0x0a,0x13,0xfa,0xf0,0x03,0x10,0xd0,
+0x66,0x08,0x02,0xc8,0x04,0x12,0xf3,0xde,0x00,0x44,0xcc,0xcc,0x30,0x00,0xd3,0x00,
+0x16,0xf7,0x4c,0x01,0x15,0x90,0xfe,0x00,0x01,0x3b,0x00,0x02,0xbd,0x00,0x0f,0x3f,
+0x01,0xfe,0x36,0x06,0x88,0x30,0xfd,0x00,0x13,0xf3,0x0a,0x00,0x16,0x0a,0xe7,0x00,
+0x53,0xbf,0xfe,0x27,0xff,0xf4,0xfc,0x00,0x5f,0xd1,0x00,0x5f,0xff,0x50,0x3f,0x01,
+0xf2,0x50,0x00,0x00,0xbf,0xff,0xf3,0xf0,0x00,0x00,0x00,0x00,0x5d,0xfd,0x83,0x03,
+0xff,0xa0,0x00,0x00,0x00,0x00,0x05,0xff,0x01,0x00,0x10,0x60,0x0b,0x00,0x71,0x0d,
+0xff,0xdd,0xff,0xff,0xfc,0x00,0x0b,0x00,0x6f,0xd9,0x00,0x28,0xcc,0x80,0x00,0x01,
+0x00,0x09,0x34,0x9f,0xff,0xf1,0x0b,0x00,0x33,0xff,0xff,0xf8,0x0a,0x00,0x43,0x06,
+0xff,0xff,0xfe,0x0b,0x00,0x52,0x0c,0xff,0xff,0xff,0x40,0x0b,0x00,0x52,0x2f,0xff,
+0xff,0xff,0xa0,0x0b,0x00,0x34,0x8f,0xff,0xff,0x38,0x00,0x51,0xef,0xff,0x7e,0xff,
+0xf6,0x0a,0x00,0x61,0x04,0xff,0xff,0x19,0xff,0xfd,0x0b,0x00,0x70,0x0b,0xff,0xfc,
+0x04,0xff,0xff,0x30,0x0b,0x00,0x70,0x1f,0xff,0xf7,0x00,0xef,0xff,0x90,0x0b,0x00,
+0x70,0x7f,0xff,0xf1,0x00,0x9f,0xff,0xf0,0x0b,0x00,0xb0,0xdf,0xff,0xc0,0x00,0x3f,
+0xff,0xf5,0x00,0x00,0x00,0x03,0xb7,0x00,0x11,0x0e,0xb1,0x00,0x40,0x09,0xff,0xff,
+0x10,0x05,0x00,0x52,0x20,0x00,0x00,0x0f,0xff,0x01,0x00,0x43,0x80,0x00,0x00,0x6f,
+0x0b,0x00,0x43,0xe0,0x00,0x00,0xcf,0x0b,0x00,0xe2,0xf4,0x00,0x02,0xff,0xff,0xec,
+0xcc,0xcc,0xcc,0xcf,0xff,0xfb,0x00,0x08,0xf8,0x00,0x70,0x0d,0xff,0xff,0x10,0x0e,
+0xff,0xff,0x5d,0x00,0x70,0x07,0xff,0xff,0x70,0x5f,0xff,0xfa,0x0b,0x00,0x71,0x01,
+0xff,0xff,0xd0,0xbf,0xff,0xf4,0x95,0x00,0xe0,0xbf,0xff,0xf3,0x00,0x00,0x05,0xdd,
+0x50,0x00,0x09,0xdb,0x10,0x00,0x00,0x64,0x00,0x52,0xf1,0x00,0x6f,0xff,0xa0,0xa5,
+0x00,0x32,0xf1,0x00,0x7f,0x0b,0x00,0x7f,0x06,0xee,0x60,0x00,0x0a,0xfc,0x20,0x34,
+0x01,0xf8,0x00,0x01,0x00,0x15,0x10,0xfd,0x00,0x33,0x4d,0xff,0xa1,0x0a,0x00,0x43,
+0x03,0xfe,0x68,0xfd,0x0b,0x00,0x53,0x09,0xf4,0x00,0xaf,0x30,0x0b,0x00,0x33,0xf3,
+0x00,0x8f,0x0b,0x00,0x33,0x04,0xfc,0x34,0x13,0x01,0x00,0xc8,0x00,0x14,0xd3,0x0b,
+0x00,0x2f,0x01,0x43,0x55,0x01,0xf4,0x23,0x00,0xef,0x47,0x00,0x02,0x30,0x01,0x29,
+0x08,0xff,0x0f,0x00,0x1a,0x1f,0x0f,0x00,0xa1,0xaf,0xff,0xff,0xff,0xfa,0xaa,0xaa,
+0xaa,0xaa,0x10,0x7c,0x01,0x03,0x89,0x00,0x05,0x1d,0x01,0x27,0xfd,0x9f,0x0f,0x00,
+0x42,0x5f,0xff,0xf5,0x8f,0xdf,0x00,0x13,0x00,0xe4,0x00,0x15,0x7f,0x0f,0x00,0x00,
+0x54,0x01,0x21,0x40,0x7f,0x4b,0x00,0x01,0x0c,0x01,0x33,0x1e,0xff,0xfc,0xda,0x00,
+0x12,0xe0,0x51,0x01,0x34,0xf3,0x00,0x5f,0x0f,0x00,0x00,0xde,0x00,0x17,0xb0,0x0f,
+0x00,0x10,0x0a,0x13,0x01,0x33,0x4f,0xff,0xf4,0x4a,0x00,0x14,0x3f,0x05,0x01,0x02,
+0x01,0x00,0x03,0x15,0x01,0x00,0x4c,0x01,0x05,0x92,0x04,0x04,0x0f,0x00,0x00,0x16,
+0x01,0x64,0xdd,0xdd,0xdd,0xdf,0xff,0xf6,0x0f,0x02,0x13,0xf9,0x93,0x01,0x03,0x1d,
+0x01,0x11,0xf1,0x91,0x03,0x10,0xfc,0xe1,0x00,0x31,0xa1,0x09,0xff,0xa7,0x01,0x03,
+0x7b,0x01,0x20,0xf2,0x2f,0x8e,0x01,0x06,0x0f,0x00,0x11,0xbf,0x3b,0x00,0x23,0x00,
+0x0e,0x0f,0x00,0x76,0x00,0x00,0x01,0x7b,0xef,0xfd,0xa6,0x41,0x01,0x10,0x60,0xf6,
+0x01,0x01,0x01,0x00,0x10,0x90,0xb1,0x00,0x00,0x0e,0x05,0x61,0xff,0x70,0x04,0xff,
+0xff,0xe5,0xc2,0x01,0x21,0x10,0xcf,0x7d,0x01,0x62,0x6f,0xff,0xf7,0x1f,0xff,0xfa,
+0x6d,0x02,0x12,0xb5,0xb8,0x01,0x44,0x08,0xaa,0xa8,0x8f,0x99,0x01,0x02,0xfc,0x01,
+0x02,0x77,0x01,0x03,0x5f,0x02,0x12,0x0a,0x86,0x00,0x01,0xaa,0x02,0x24,0xf2,0x00,
+0xb1,0x01,0x15,0x30,0x71,0x01,0x00,0x07,0x00,0x32,0x78,0x88,0x62,0x9a,0x02,0x41,
+0x0f,0xff,0xfb,0x0c,0x43,0x00,0x02,0x02,0x02,0x20,0xfe,0x40,0x76,0x01,0x10,0xf1,
+0xc4,0x01,0x20,0xec,0xdf,0xde,0x02,0x12,0x01,0x2c,0x01,0x11,0xfa,0x4e,0x00,0x22,
+0xff,0xff,0x07,0x01,0x71,0x28,0xcf,0xff,0xfb,0x61,0x00,0x00,0x77,0x01,0x13,0xfa,
+0x59,0x00,0x34,0x28,0xdf,0xff,0x4d,0x03,0x23,0xff,0xf9,0x9c,0x00,0x34,0xef,0xff,
+0x70,0x3f,0x02,0x13,0xd1,0x5d,0x01,0x11,0xec,0x12,0x00,0x33,0x6c,0xcc,0xc4,0xab,
+0x00,0x14,0xfd,0x92,0x01,0x02,0xfd,0x05,0x13,0x1d,0xd8,0x00,0x4e,0x01,0xef,0xfd,
+0x00,0x01,0x00,0x04,0xcc,0x02,0x0e,0x08,0x00,0x60,0xeb,0xbb,0xbb,0xbb,0xbb,0xb2,
+0x04,0x02,0x02,0x28,0x00,0x0f,0x08,0x00,0x05,0x53,0xea,0xaa,0xaa,0xaa,0xa7,0x48,
+0x00,0x1e,0xfb,0x08,0x00,0x0f,0x40,0x00,0x0e,0x0c,0x08,0x00,0x01,0x78,0x00,0x1e,
+0xb3,0x98,0x00,0x06,0x6f,0x02,0x12,0x5c,0xeb,0x00,0x13,0x01,0xd1,0x03,0x12,0x0a,
+0xcc,0x01,0x23,0x00,0x4f,0x43,0x00,0x0f,0xe8,0x00,0xb5,0x33,0x58,0x83,0x00,0x48,
+0x04,0x13,0x40,0xee,0x04,0x11,0xf5,0xee,0x00,0xcf,0xe3,0x5f,0xff,0x50,0x00,0x00,
+0xbf,0xfe,0x20,0x04,0xff,0xf6,0xe8,0x00,0xaf,0x60,0x4c,0xd6,0x00,0x00,0x8d,0xb2,
+0xd0,0x02,0x40,0x20,0x04,0xff,0xfc,0x31,0x00,0x20,0x20,0x05,0x08,0x00,0x6f,0x5e,
+0xe8,0x00,0x00,0x9f,0xd3,0xe0,0x00,0xae,0x70,0x09,0xcc,0xcc,0x10,0x00,0x01,0xdf,
+0x19,0x04,0x30,0x2e,0xff,0xf4,0xbc,0x05,0x11,0xfe,0xab,0x02,0x18,0x90,0xd5,0x00,
+0x3f,0xaf,0xff,0xf0,0x05,0x00,0x57,0xf7,0x03,0x08,0xcc,0xcc,0x20,0x04,0xff,0xff,
+0x50,0x00,0xdf,0xff,0x60,0x00,0x8f,0xff,0x80,0x00,0x3f,0x8d,0x00,0x00,0xea,0x04,
+0x02,0x27,0x00,0x0f,0x09,0x00,0x47,0x00,0xd4,0x02,0x21,0x87,0x10,0xa0,0x07,0x20,
+0xfe,0x20,0xdc,0x07,0x00,0x07,0x00,0xc3,0x1c,0xff,0xd1,0x9f,0xfe,0x30,0x1d,0xff,
+0xc0,0x00,0x7f,0xfe,0xf5,0x04,0x09,0x93,0x00,0x04,0x3b,0x00,0x0f,0x0d,0x00,0x6e,
+0xfb,0x0b,0x06,0xdc,0x30,0x00,0x1a,0xda,0x02,0xff,0xfe,0x00,0x08,0xff,0xf8,0x3f,
+0xff,0xe0,0x00,0x9f,0xff,0x80,0x8f,0xe4,0x00,0x01,0xcf,0xb1,0xaa,0x02,0x0f,0xb0,
+0x00,0x74,0x03,0x0d,0x00,0x01,0x1f,0x07,0x13,0xd9,0x49,0x04,0x00,0x01,0x00,0x16,
+0xd4,0x75,0x08,0x11,0xf8,0x15,0x00,0x31,0xfc,0xbb,0xdf,0x8c,0x06,0x00,0xd9,0x06,
+0x00,0x75,0x04,0x12,0xf3,0x10,0x08,0x00,0xcc,0x07,0x13,0xc0,0xee,0x06,0x10,0x0a,
+0x06,0x00,0x02,0x28,0x07,0x34,0x4f,0xff,0xf8,0x03,0x07,0xd1,0xff,0xff,0xb4,0xdd,
+0xef,0xff,0xfd,0xdd,0x80,0x00,0x0e,0xff,0xfd,0x30,0x08,0x10,0xf9,0x77,0x08,0x13,
+0xe5,0x87,0x07,0x34,0x0d,0xff,0xfe,0x2a,0x00,0x33,0xef,0xff,0xd0,0x3f,0x00,0x12,
+0x0f,0x33,0x09,0x11,0x30,0xb0,0x09,0x13,0x80,0x15,0x00,0x33,0xaf,0xff,0xf3,0x15,
+0x00,0x33,0x5f,0xff,0xfc,0x7e,0x00,0x40,0x7f,0xff,0xff,0x30,0x15,0x00,0x22,0xcb,
+0xbc,0x88,0x09,0x15,0x8f,0x92,0x09,0x02,0xbd,0x00,0x23,0xfd,0x40,0xd2,0x00,0x21,
+0xfd,0x94,0x76,0x01,0x63,0x1a,0xff,0xb6,0x11,0xaf,0xf2,0x33,0x0a,0x21,0xff,0xfe,
+0x8c,0x08,0x30,0xfd,0xff,0xff,0x32,0x05,0x63,0x00,0x6d,0xd2,0x00,0x5a,0xcb,0x47,
+0x0a,0x0d,0x57,0x04,0x12,0xe1,0xf2,0x08,0x12,0x8f,0xc4,0x07,0x32,0x2f,0xff,0xf8,
+0x73,0x0a,0x02,0x13,0x00,0x15,0xfe,0x13,0x00,0x14,0xf8,0x13,0x00,0x24,0xff,0xf3,
+0x13,0x00,0x22,0xff,0xc0,0x13,0x00,0x42,0xfe,0xff,0xff,0x70,0x13,0x00,0x41,0xba,
+0xff,0xff,0x10,0x13,0x00,0x42,0xfb,0x1f,0xff,0xfb,0x13,0x00,0x42,0xb0,0x6f,0xff,
+0xf5,0x13,0x00,0x42,0x00,0xcf,0xff,0xe1,0x13,0x00,0x41,0x02,0xff,0xff,0x92,0x13,
+0x00,0x00,0xcc,0x00,0x11,0x5f,0x13,0x00,0x00,0x2e,0x01,0x01,0x13,0x00,0x00,0x62,
+0x01,0x12,0xff,0x13,0x00,0x01,0xfe,0x09,0x01,0x13,0x00,0x24,0x01,0xef,0x13,0x00,
+0x14,0x05,0x13,0x00,0x24,0x00,0x0b,0x13,0x00,0x24,0x00,0x2f,0x13,0x00,0x20,0x00,
+0x7f,0xa7,0x00,0x44,0x4c,0xcc,0xc5,0x00,0xd1,0x08,0x25,0xfe,0x10,0x95,0x02,0x02,
+0x3c,0x0b,0x00,0x38,0x00,0x15,0xf4,0x23,0x0a,0x1f,0xfe,0xf0,0x0c,0x08,0x41,0x6b,
+0xef,0xfe,0xb6,0x09,0x00,0x10,0x6e,0xeb,0x00,0x12,0xe6,0x20,0x09,0x12,0xff,0x85,
+0x0b,0x00,0x1a,0x01,0x00,0x93,0x00,0x00,0x00,0x01,0x30,0xf8,0x10,0x01,0xac,0x01,
+0x10,0x0a,0x05,0x01,0x00,0xf1,0x08,0x42,0xb0,0x1f,0xff,0xfd,0x87,0x08,0x22,0xf1,
+0x5f,0xe3,0x08,0x62,0x6f,0xff,0xf6,0x8f,0xff,0xf4,0x3c,0x0a,0x13,0xf8,0x48,0x09,
+0x32,0x1f,0xff,0xfa,0x65,0x09,0x00,0x12,0x02,0x06,0x0a,0x00,0x06,0x1e,0x00,0x05,
+0x32,0x00,0x16,0xf9,0x46,0x00,0x05,0x5a,0x00,0x12,0xf2,0x6e,0x00,0x00,0xa2,0x02,
+0x01,0x82,0x00,0x00,0x2e,0x02,0x10,0x40,0x05,0x00,0x21,0xfd,0xdf,0x85,0x02,0x06,
+0xaa,0x00,0x25,0x00,0x5e,0x6a,0x09,0x80,0x00,0x6b,0xef,0xfe,0xb6,0x10,0x00,0x00,
+0x10,0x00,0x01,0x00,0x42,0x4c,0xcc,0xc6,0x00,0x01,0x00,0x32,0xdf,0xff,0xa0,0x09,
+0x00,0x33,0x08,0xff,0xfc,0x13,0x00,0x33,0x3f,0xff,0xd0,0x0a,0x00,0x4f,0xcf,0xfe,
+0x10,0x00,0x01,0x00,0x06,0x41,0x6b,0xef,0xfe,0xb6,0x09,0x00,0xb0,0x6e,0xff,0xff,
+0xff,0xff,0xe6,0x00,0x00,0x00,0x09,0xff,0x01,0x00,0x00,0x51,0x00,0xf1,0x11,0x8f,
+0xff,0xff,0xfe,0xef,0xff,0xff,0xf8,0x00,0x02,0xff,0xff,0xf8,0x10,0x01,0x7f,0xff,
+0xff,0x30,0x0a,0xff,0xff,0x70,0x00,0x00,0x06,0xff,0xff,0xb0,0x1f,0xff,0xfd,0x5d,
+0x00,0x50,0xff,0xf1,0x5f,0xff,0xf7,0x0a,0x00,0x62,0x6f,0xff,0xf6,0x8f,0xff,0xf4,
+0x7b,0x00,0x40,0xf8,0x9f,0xff,0xf2,0x0a,0x00,0x60,0x1f,0xff,0xfa,0xaf,0xff,0xf1,
+0x0a,0x00,0x36,0x0f,0xff,0xfb,0x0a,0x00,0x06,0x1e,0x00,0x05,0x32,0x00,0x16,0xf9,
+0x46,0x00,0x05,0x5a,0x00,0x12,0xf2,0x6e,0x00,0x41,0x05,0xff,0xff,0xc0,0x82,0x00,
+0x50,0x00,0x7f,0xff,0xff,0x40,0x05,0x00,0x58,0xfd,0xdf,0xff,0xff,0xf9,0xaa,0x00,
+0x20,0x00,0x5e,0x09,0x00,0x15,0xf7,0xd2,0x00,0x13,0x10,0xfa,0x00,0x13,0xfc,0x09,
+0x00,0x41,0x1d,0xff,0xff,0xd1,0x09,0x00,0x51,0x02,0xdf,0xfc,0xbf,0xfd,0x15,0x00,
+0x42,0x2e,0xff,0xb0,0x0a,0x15,0x00,0x22,0x68,0x86,0x04,0x00,0x0f,0x22,0x01,0xe0,
+0x50,0x8c,0x92,0x00,0x09,0xcb,0x09,0x00,0x62,0x0c,0xff,0xff,0x71,0x3f,0xfc,0x5f,
+0x00,0x04,0x28,0x00,0x60,0xbf,0xf3,0x18,0xff,0xff,0xc0,0x0a,0x00,0x6f,0xad,0xa0,
+0x00,0x3a,0xc8,0x10,0x22,0x01,0xe1,0x62,0x3d,0xf9,0x00,0x00,0x8f,0xd4,0x63,0x03,
+0x42,0x40,0x03,0xff,0xfe,0x55,0x00,0x22,0x40,0x03,0x5f,0x00,0x6f,0x3c,0xd7,0x00,
+0x00,0x7d,0xc3,0x18,0x01,0xe0,0x90,0xb3,0x00,0x00,0x00,0x05,0xa0,0x01,0xcf,0xf3,
+0x42,0x00,0x40,0xb0,0xbf,0xff,0xf3,0x49,0x00,0xc0,0x92,0xef,0xff,0xe3,0x04,0xff,
+0xff,0xd1,0x02,0xef,0xff,0xe7,0x70,0x03,0x31,0x02,0xef,0xff,0x77,0x03,0x22,0x02,
+0xef,0x7e,0x03,0x21,0x07,0xff,0x91,0x00,0x52,0x04,0xff,0xff,0xff,0xe3,0x07,0x00,
+0x20,0xff,0xe2,0x07,0x00,0x40,0xd5,0xef,0xff,0xe2,0x38,0x00,0xf5,0x0b,0x03,0xff,
+0xff,0xe2,0xaf,0xff,0xe1,0x00,0x03,0xff,0xff,0x80,0xaf,0xe2,0x00,0x00,0x03,0xff,
+0x80,0x00,0x92,0x00,0x00,0x00,0x03,0x80,0x52,0x01,0x23,0xff,0xe0,0x09,0x00,0x10,
+0x05,0xbd,0x00,0x83,0x00,0x5a,0xdf,0xfe,0xb6,0x0a,0xff,0x10,0xa3,0x00,0x00,0xb7,
+0x00,0x12,0x08,0xb7,0x00,0x11,0xf3,0xc8,0x02,0x02,0x61,0x01,0x50,0x01,0xff,0xff,
+0xf9,0x10,0x70,0x01,0x51,0x40,0x09,0xff,0xff,0x80,0x7a,0x01,0x50,0xc0,0x0f,0xff,
+0xfe,0x00,0x68,0x00,0x30,0xff,0xf2,0x3f,0x36,0x00,0xc3,0x0d,0xff,0x7f,0xff,0xf7,
+0x6f,0xff,0xf5,0x00,0x00,0x7f,0xf7,0x39,0x01,0x10,0x02,0x25,0x00,0xb0,0xfb,0x8f,
+0xff,0xf3,0x00,0x0c,0xff,0x20,0x0e,0xff,0xfc,0x0a,0x00,0xf0,0x1f,0x6f,0xf8,0x00,
+0x0e,0xff,0xfd,0x7f,0xff,0xf4,0x01,0xff,0xd0,0x00,0x0f,0xff,0xfc,0x5f,0xff,0xf6,
+0x0b,0xff,0x30,0x00,0x1f,0xff,0xfb,0x2f,0xff,0xfa,0x5f,0xf9,0x00,0x00,0x4f,0xff,
+0xf8,0x0e,0xff,0xfe,0xef,0xe0,0x00,0x00,0xaf,0xff,0xf4,0x8b,0x00,0x10,0x40,0xe0,
+0x00,0x60,0xd0,0x00,0xef,0xff,0xfd,0x10,0x91,0x00,0xd1,0x60,0x00,0x4f,0xff,0xff,
+0xfe,0xdf,0xff,0xff,0xfb,0x00,0x00,0x0a,0xaa,0x00,0x00,0x60,0x03,0x11,0x2f,0x09,
+0x00,0x10,0xf8,0x97,0x01,0x60,0xf3,0x5a,0xdf,0xfe,0xb7,0x10,0x05,0x02,0x06,0xf4,
+0x00,0x32,0xbc,0xcc,0xb0,0x09,0x00,0x21,0x03,0xff,0xf5,0x00,0x02,0x43,0x01,0x14,
+0x20,0x08,0x01,0x13,0xfb,0x27,0x00,0x3e,0x06,0xff,0xf6,0x86,0x02,0x03,0x37,0x00,
+0x00,0x4d,0x00,0x62,0x7f,0xff,0xf4,0x3f,0xff,0xf8,0x87,0x01,0x1f,0x43,0x13,0x00,
+0x5e,0x14,0x42,0x13,0x00,0x51,0xf3,0x1f,0xff,0xfa,0x00,0xfe,0x00,0x20,0x20,0xef,
+0xce,0x01,0xf0,0x08,0x01,0xef,0xff,0xe0,0x09,0xff,0xff,0xc2,0x00,0x02,0xbf,0xff,
+0xf9,0x00,0x1f,0xff,0xff,0xfd,0xcd,0xff,0xff,0xff,0x10,0x29,0x01,0x11,0xff,0x41,
+0x01,0x20,0x00,0x3d,0x08,0x00,0x20,0xfd,0x30,0xf7,0x00,0x44,0x9d,0xef,0xed,0xa5,
+0xd7,0x00,0x14,0xac,0x17,0x01,0x12,0x7f,0xf1,0x02,0x00,0x48,0x01,0x12,0xf4,0x09,
+0x00,0x3f,0x0b,0xff,0xf5,0x14,0x01,0xe1,0x13,0x06,0xf7,0x00,0x00,0x5c,0x00,0x13,
+0xf5,0x0e,0x08,0x12,0xf8,0x02,0x01,0x10,0x0a,0x9a,0x03,0x10,0xf6,0xf9,0x00,0x6f,
+0x88,0x82,0x00,0x03,0x88,0x71,0x14,0x01,0xd5,0x61,0xaf,0xc2,0x00,0x03,0xdf,0x90,
+0xfb,0x04,0x52,0xb0,0x00,0xcf,0xff,0x50,0x31,0x03,0x11,0x0c,0x29,0x02,0x6f,0x09,
+0xdb,0x20,0x00,0x2b,0xd8,0x1f,0x02,0x02,0x0f,0x01,0x01,0x68,0x06,0x13,0x00,0x14,
+0x2f,0x13,0x00,0x12,0x31,0x87,0x05,0x41,0xaf,0xff,0xf2,0x0e,0x81,0x06,0xf2,0x07,
+0x1e,0xff,0xfe,0x00,0x9f,0xff,0xfc,0x20,0x00,0x2b,0xff,0xff,0x90,0x01,0xff,0xff,
+0xff,0xdc,0xdf,0xff,0xff,0xf1,0x51,0x05,0x01,0x63,0x05,0x20,0x03,0xdf,0x09,0x00,
+0x10,0xd3,0xca,0x00,0x53,0x49,0xde,0xfe,0xda,0x50,0xd6,0x00,0x31,0x5c,0xcc,0xc4,
+0x09,0x00,0x00,0x4c,0x01,0x00,0x14,0x01,0x01,0x5f,0x01,0x13,0xfa,0x1d,0x00,0x33,
+0x4f,0xff,0xb0,0x0a,0x00,0x2f,0xef,0xfd,0xd0,0x06,0x05,0x12,0xbf,0x4d,0x02,0x40,
+0xaf,0xff,0xf7,0x2f,0x47,0x06,0x00,0x5a,0x05,0x51,0xe0,0x0a,0xff,0xff,0x50,0x2e,
+0x06,0x21,0x60,0x02,0xcd,0x04,0x01,0x61,0x06,0x10,0x9f,0x86,0x00,0x10,0x8f,0x85,
+0x02,0x10,0x1f,0xa0,0x04,0x31,0xef,0xff,0xc0,0x9a,0x05,0x20,0x30,0x07,0xa9,0x01,
+0x00,0x10,0x00,0x43,0xa0,0x0e,0xff,0xfb,0xbc,0x03,0x30,0x5f,0xff,0xf3,0x0a,0x00,
+0x32,0x0e,0xff,0xf9,0xc5,0x0a,0x00,0x01,0x07,0x04,0xdf,0x04,0x02,0x8b,0x06,0x02,
+0x9f,0x00,0x02,0xe1,0x06,0x01,0xaa,0x08,0x14,0x80,0xec,0x0a,0x2f,0xff,0x40,0x0a,
+0x00,0x36,0x04,0x13,0x01,0x14,0x0e,0x72,0x00,0x06,0x11,0x00,0x50,0xfd,0x99,0x98,
+0x75,0x10,0x11,0x00,0x00,0x01,0x00,0x32,0xb2,0x00,0x0e,0x68,0x01,0x33,0xf5,0x00,
+0xef,0x6c,0x06,0x01,0x33,0x00,0x41,0x3b,0xff,0xff,0xc0,0x33,0x00,0x61,0x0b,0xff,
+0xff,0x2e,0xff,0xf9,0x45,0x02,0x10,0xf5,0x11,0x00,0x00,0x26,0x01,0x19,0x6e,0x11,
+0x00,0x12,0x0a,0x22,0x00,0x00,0x33,0x00,0x23,0xd0,0xef,0xb5,0x01,0x03,0x55,0x00,
+0x13,0xf6,0x55,0x00,0x13,0xb3,0x77,0x00,0x1f,0x20,0x99,0x00,0x0a,0x14,0xf9,0x99,
+0x01,0x31,0x25,0x88,0x85,0xae,0x08,0x12,0x1b,0x05,0x07,0x02,0x7a,0x07,0x20,0xff,
+0xc0,0xd9,0x06,0x03,0xbc,0x07,0x70,0x5f,0xff,0xfb,0x20,0x6f,0xff,0xfd,0xbd,0x01,
+0x10,0xf0,0xae,0x01,0x00,0x03,0x08,0x10,0xb0,0x6b,0x01,0x10,0x10,0x8e,0x01,0x41,
+0x00,0x09,0xff,0xfe,0x97,0x01,0x02,0x55,0x00,0x00,0x09,0x00,0x32,0x6f,0xff,0xf2,
+0x09,0x00,0x32,0xdf,0xff,0xb0,0x09,0x00,0x01,0x7e,0x06,0x02,0x09,0x00,0x12,0xa0,
+0x09,0x00,0x32,0xcf,0xff,0xf6,0x09,0x00,0x10,0x4f,0x1c,0x00,0x00,0x09,0x00,0x10,
+0x07,0x6d,0x00,0x00,0x09,0x00,0x00,0xee,0x06,0x11,0x40,0x09,0x00,0x11,0x04,0x19,
+0x01,0x20,0xa0,0x00,0x16,0x02,0x12,0xf0,0x09,0x00,0x70,0x6f,0xff,0xf1,0xef,0xff,
+0xa0,0x21,0x84,0x00,0x00,0x12,0x00,0xc1,0x8f,0xca,0xae,0xff,0xff,0xb0,0xef,0xff,
+0xa0,0xcf,0xff,0xff,0xef,0x03,0x10,0xa0,0x08,0x00,0x10,0xe4,0x48,0x00,0x50,0x9c,
+0xef,0xfe,0xc7,0x10,0x79,0x02,0x13,0xf2,0xfc,0x01,0x12,0xfb,0xc1,0x02,0x51,0xdf,
+0xff,0x60,0x00,0x00,0x0b,0x03,0x12,0xe1,0xd7,0x0b,0x2f,0xcc,0xc7,0xb1,0x02,0x01,
+0x61,0x02,0x7c,0xef,0xfc,0x82,0x00,0xf3,0x07,0x00,0xa2,0x00,0x13,0x09,0x64,0x01,
+0xb0,0x3f,0xff,0xfd,0x65,0x8f,0xff,0xfe,0x00,0x7f,0xff,0xf1,0x03,0x01,0x70,0x30,
+0x01,0x11,0x10,0x00,0x02,0xff,0x53,0x00,0x30,0x36,0x89,0x9a,0x08,0x00,0x11,0x6e,
+0x29,0x00,0x13,0x60,0xa3,0x07,0xd0,0x60,0x5f,0xff,0xfb,0x31,0x01,0xff,0xff,0x60,
+0xbf,0xff,0xd0,0x00,0x08,0x00,0x00,0x82,0x01,0x02,0x08,0x00,0x11,0xd0,0xfa,0x02,
+0x92,0xaf,0xff,0xfc,0x77,0xdf,0xff,0xff,0x60,0x3f,0x30,0x00,0x20,0x70,0x05,0x89,
+0x04,0x00,0x25,0x00,0x72,0x29,0xdf,0xfc,0x70,0xaf,0xff,0xe0,0x72,0x09,0x12,0xe1,
+0x9b,0x05,0x22,0xfe,0x20,0xac,0x06,0x13,0xf3,0x53,0x03,0x11,0x40,0x7c,0x05,0x2f,
+0xcc,0xc5,0xc0,0x00,0x8a,0x13,0x04,0x49,0x07,0x12,0x5f,0x83,0x08,0x31,0x05,0xff,
+0xf9,0x11,0x0a,0x10,0x6f,0x34,0x00,0x9f,0x70,0x00,0x02,0x99,0x95,0x00,0x03,0x99,
+0x92,0xc0,0x00,0x87,0x60,0x05,0xde,0x90,0x00,0x3f,0xf7,0x46,0x04,0xf0,0x02,0xfe,
+0x40,0x9f,0xf4,0x00,0x00,0xdf,0xfd,0xff,0xff,0xff,0xe0,0x00,0x02,0xff,0xa0,0x1a,
+0xbf,0x04,0x6f,0x03,0xdd,0x50,0x00,0x6b,0xb5,0x80,0x01,0x82,0x50,0xfc,0x70,0xaf,
+0xff,0xe0,0xf5,0x11,0x00,0x9f,0xd4,0x00,0x02,0xcf,0xb0,0x00,0x04,0xff,0xfd,0x00,
+0x0a,0xff,0xf7,0x00,0x03,0xff,0xfd,0x00,0x09,0xff,0xf7,0x00,0x00,0x7d,0xc3,0x00,
+0x01,0xbd,0x90,0x00,0x01,0x00,0xf0,0x02,0x02,0x7c,0xef,0xfc,0x82,0x00,0x00,0x00,
+0x8f,0xff,0xff,0xff,0xff,0x70,0x00,0x09,0xff,0x01,0x00,0xf0,0x10,0xf6,0x00,0x3f,
+0xff,0xfd,0x65,0x8f,0xff,0xfe,0x00,0x7f,0xff,0xf1,0x00,0x06,0xff,0xff,0x30,0x01,
+0x11,0x10,0x00,0x02,0xff,0xff,0x60,0x00,0x00,0x36,0x89,0x9a,0x08,0x00,0x11,0x6e,
+0x29,0x00,0x32,0x60,0x0a,0xff,0x08,0x00,0xc0,0x5f,0xff,0xfb,0x31,0x01,0xff,0xff,
+0x60,0xbf,0xff,0xd0,0x00,0x08,0x00,0x33,0xef,0xff,0x90,0x08,0x00,0x10,0xd0,0x54,
+0x00,0xa2,0x60,0xaf,0xff,0xfc,0x77,0xdf,0xff,0xff,0x60,0x3f,0x30,0x00,0x60,0x70,
+0x05,0xff,0xff,0xff,0xfd,0x25,0x00,0xb2,0x29,0xdf,0xfc,0x70,0xaf,0xff,0xe0,0x00,
+0x00,0x00,0x01,0x91,0x00,0x31,0x06,0xef,0xf9,0x08,0x00,0x40,0x6f,0xc6,0xaf,0xa0,
+0x08,0x00,0x41,0xcf,0x10,0x0d,0xf0,0x08,0x00,0x21,0x00,0x0c,0x08,0x00,0x40,0x7f,
+0x92,0x6f,0xb0,0x08,0x00,0x41,0x09,0xff,0xfc,0x10,0x29,0x00,0x4f,0x14,0x20,0x00,
+0x00,0xd0,0x00,0x7f,0xa0,0x01,0x7b,0xef,0xfd,0xa4,0x00,0x39,0xdf,0xfe,0xa4,0xcc,
+0x00,0x00,0x24,0x00,0x10,0xaa,0x05,0x00,0x10,0xa0,0x7e,0x00,0x04,0x01,0x00,0xf1,
+0x01,0xfa,0x00,0x0f,0xff,0xff,0xda,0xbf,0xff,0xff,0xff,0xfb,0xae,0xff,0xff,0x40,
+0x5f,0xa8,0x01,0xf0,0x00,0xff,0xfd,0x10,0x01,0xdf,0xff,0xb0,0x25,0x55,0x50,0x00,
+0x00,0xcf,0xff,0xf3,0x3d,0x00,0x01,0xf8,0x00,0xc5,0x11,0xbf,0xff,0xe1,0x11,0x11,
+0x4f,0xff,0xf1,0x00,0x17,0xbe,0x42,0x00,0x10,0xf3,0x78,0x00,0x05,0x0d,0x00,0x18,
+0x4f,0x0d,0x00,0x52,0xbf,0xff,0xf9,0x20,0x00,0x5a,0x01,0xa3,0x00,0x00,0xef,0xff,
+0xb0,0x00,0x00,0xaf,0xff,0xf3,0x0d,0x00,0x10,0xa0,0x5b,0x00,0xf2,0x04,0xfe,0x30,
+0x00,0x00,0x36,0x00,0xbf,0xff,0xf9,0x55,0x8e,0xff,0xff,0xff,0xfc,0xaa,0xbe,0xff,
+0x10,0x41,0x00,0x12,0xef,0xd3,0x00,0x10,0x07,0x06,0x00,0x11,0xf7,0x41,0x01,0xf1,
+0x12,0xfd,0x40,0x00,0x29,0xdf,0xfe,0xc7,0x10,0x00,0x28,0xce,0xfe,0xd9,0x40,0x00,
+0x00,0x00,0x5b,0xef,0xfd,0x92,0x00,0x00,0x02,0xdf,0xff,0xff,0xff,0xf8,0x00,0x02,
+0xef,0xff,0x08,0x00,0xa0,0xcf,0xff,0xfd,0xab,0xff,0xff,0xf2,0x4f,0xff,0xf9,0xc7,
+0x00,0x30,0x89,0xff,0xfe,0xa5,0x01,0x20,0xfb,0xdf,0x7b,0x00,0x42,0x37,0x77,0x6e,
+0xff,0xd7,0x01,0x30,0xff,0xff,0x80,0x07,0x00,0x13,0x0e,0x0f,0x00,0x31,0xdf,0xff,
+0xa0,0xcd,0x01,0x00,0x2d,0x00,0xf4,0x03,0x07,0xff,0xfb,0x4f,0xff,0xf7,0x00,0x01,
+0xef,0xff,0x90,0xcf,0xff,0xfc,0x89,0xef,0xff,0xf3,0x5a,0x00,0x02,0x69,0x00,0x00,
+0x78,0x00,0x30,0xff,0xff,0x82,0x30,0x00,0x30,0x3f,0xff,0xa2,0x07,0x00,0x23,0x03,
+0x8d,0xd3,0x00,0x12,0x4f,0x56,0x00,0x30,0x9e,0xff,0xf7,0x07,0x00,0x31,0x0f,0xff,
+0xfd,0x16,0x00,0x21,0xee,0xc7,0x39,0x02,0x21,0xff,0xe1,0x0e,0x00,0x30,0x1d,0xff,
+0xfa,0x08,0x00,0x00,0x60,0x00,0x11,0x40,0x09,0x00,0x41,0x2e,0xff,0xd0,0x00,0x46,
+0x00,0x3f,0xcc,0xc6,0x00,0x01,0x00,0x01,0x30,0x39,0xdf,0xfd,0xbd,0x01,0x01,0x02,
+0x01,0x01,0x32,0x01,0x00,0xa9,0x01,0xa0,0x00,0x08,0xff,0xff,0xeb,0xbe,0xff,0xff,
+0x60,0x1f,0x80,0x02,0x60,0xbf,0xff,0xd0,0x6f,0xff,0xf3,0x90,0x00,0x11,0xf2,0x6b,
+0x01,0x52,0x1f,0xff,0xf5,0xcf,0xff,0x73,0x02,0x12,0xdf,0x08,0x00,0x14,0xf7,0x08,
+0x00,0x13,0xbf,0x6e,0x00,0xf0,0x02,0x7f,0xff,0xf4,0x00,0x00,0x00,0x10,0x00,0x2f,
+0xff,0xfe,0x40,0x00,0x03,0xda,0x00,0x09,0x7c,0x01,0x00,0x07,0x01,0x22,0xbf,0xff,
+0x69,0x00,0x22,0x09,0xff,0xed,0x00,0x00,0x6d,0x01,0x23,0xc7,0x20,0x26,0x01,0x01,
+0x3c,0x00,0x42,0x08,0xff,0xfd,0x10,0xfe,0x00,0x13,0xe2,0x17,0x00,0x10,0x30,0x07,
+0x00,0x3f,0x05,0xcc,0xc4,0xc0,0x00,0x8a,0x52,0x05,0xff,0xf5,0x00,0x00,0x06,0x03,
+0x20,0x50,0x00,0xe7,0x01,0x31,0xf9,0xff,0xf5,0xa2,0x03,0xcf,0x50,0x5f,0xff,0x60,
+0x00,0x03,0x99,0x94,0x00,0x04,0x99,0x91,0xc0,0x00,0x87,0xf0,0x05,0xaf,0xd3,0x00,
+0x03,0xdf,0x90,0x00,0x05,0xff,0xfc,0x00,0x0c,0xff,0xf5,0x00,0x05,0xff,0xfb,0x00,
+0x0b,0xc1,0x00,0x6f,0x8d,0xb2,0x00,0x02,0xbd,0x80,0xb0,0x00,0x7e,0x10,0x1d,0xfd,
+0x02,0x10,0x2e,0x11,0x00,0x30,0x2f,0xff,0xf2,0x6a,0x00,0x66,0xc0,0x00,0x00,0x5c,
+0xcc,0x40,0xa7,0x00,0x01,0x7b,0x03,0x00,0xab,0x04,0x0f,0x09,0x00,0x30,0x90,0x1f,
+0xff,0xfb,0x00,0x0a,0xff,0xfc,0x00,0x05,0xb6,0x04,0x7f,0xef,0xfe,0x20,0x00,0x6c,
+0xcc,0x30,0x6a,0x00,0x43,0x01,0x0a,0x01,0x11,0x40,0xd9,0x05,0x00,0x07,0x00,0xf2,
+0x03,0x9f,0xff,0x9f,0xff,0x40,0x00,0xaf,0xfe,0x30,0x5f,0xff,0x50,0x49,0x98,0x20,
+0x00,0x49,0x98,0x0d,0x06,0x0a,0x7c,0x00,0x02,0x3f,0x00,0x0f,0x0d,0x00,0x4f,0xf0,
+0x01,0x0b,0xfc,0x20,0x00,0x4d,0xf8,0x07,0xff,0xfa,0x00,0x0d,0xff,0xf4,0x7f,0xff,
+0x90,0x9a,0x03,0x6f,0x9d,0xb1,0x00,0x03,0xcd,0x70,0x8f,0x00,0x62,0x53,0x00,0x01,
+0xb7,0x20,0x00,0x3d,0x02,0x40,0xc4,0x00,0x04,0x50,0x17,0x00,0x53,0xff,0xfb,0x3a,
+0xff,0x20,0xab,0x05,0x00,0x6d,0x03,0x23,0x3b,0xff,0x8a,0x05,0x00,0xf2,0x06,0x00,
+0x2e,0x00,0x31,0x3d,0xff,0xef,0x37,0x05,0x41,0x02,0xfe,0x60,0xaf,0x47,0x05,0xc0,
+0x04,0x10,0x00,0xdf,0xff,0xf1,0x00,0x00,0x00,0x25,0x54,0x15,0x22,0x07,0x92,0x05,
+0xdf,0xff,0xff,0xaf,0xff,0xfa,0x00,0x08,0xa1,0x02,0x14,0xf0,0x7b,0x06,0x72,0x10,
+0xef,0xff,0xf8,0x10,0x16,0xef,0xf9,0x05,0x80,0x00,0x04,0xff,0xff,0x48,0xff,0xff,
+0x10,0x93,0x05,0x10,0xf4,0xe3,0x02,0x00,0x11,0x00,0x11,0x3a,0x59,0x00,0x61,0x5f,
+0xff,0xf1,0x8f,0xff,0xf0,0xec,0x05,0x10,0x06,0x0a,0x04,0x00,0x88,0x06,0x41,0x0f,
+0xff,0xfe,0x20,0x98,0x06,0x50,0x7f,0xff,0xff,0xba,0xdf,0x40,0x00,0x01,0xd6,0x02,
+0x13,0xfc,0xc1,0x07,0x22,0xfa,0x00,0xd7,0x02,0x11,0xa4,0xda,0x07,0xf0,0x04,0xbf,
+0xc3,0x00,0x0d,0xfd,0x00,0x00,0x0d,0xff,0xff,0x81,0x4f,0xfa,0x00,0x00,0x7f,0xfe,
+0xef,0xff,0x88,0x03,0x40,0xcf,0xf1,0x06,0xff,0x64,0x06,0x5e,0xbd,0x90,0x00,0x2a,
+0xc8,0x46,0x04,0x30,0x5f,0xff,0xe0,0x94,0x07,0x41,0x00,0x5f,0xff,0xf5,0x5a,0x00,
+0x13,0x5f,0xb2,0x07,0xb0,0x5f,0xff,0xff,0xea,0xbe,0xff,0xff,0xd0,0x5f,0xff,0xfb,
+0xac,0x03,0x40,0xf1,0x5f,0xff,0xf2,0xa3,0x04,0x11,0xf2,0x08,0x00,0x3f,0x4f,0xff,
+0xf3,0x08,0x00,0x3d,0x22,0x00,0x5f,0x9d,0x06,0x01,0x65,0x00,0x02,0x09,0x00,0x32,
+0x8f,0xff,0xc0,0x09,0x00,0x32,0x9f,0xff,0x60,0x09,0x00,0x3f,0x9c,0xcb,0x00,0x01,
+0x00,0x02,0x40,0x04,0xad,0xff,0xda,0xfd,0x02,0x10,0x1b,0xbb,0x00,0x10,0xc1,0xcc,
+0x06,0x00,0x01,0x00,0x10,0xe1,0xbd,0x01,0x60,0xea,0xae,0xff,0xff,0xc0,0x02,0x02,
+0x01,0x70,0x0b,0xff,0xff,0x40,0x8f,0xff,0xf1,0x56,0x04,0x21,0xfa,0x0c,0x44,0x01,
+0x30,0xaf,0xff,0xd0,0x17,0x02,0x00,0xb3,0x01,0x31,0x0f,0xff,0xf8,0x10,0x02,0x14,
+0xf0,0x11,0x00,0x40,0x0c,0xff,0xfb,0x00,0x6f,0x01,0x23,0xe0,0x9f,0x33,0x00,0x40,
+0x03,0xff,0xff,0xb0,0x51,0x00,0x23,0x40,0x0b,0x55,0x00,0x23,0x00,0x1e,0x66,0x00,
+0x20,0x00,0x1c,0x08,0x00,0x12,0xc2,0x88,0x00,0x24,0xea,0x50,0xc6,0x00,0x11,0xf6,
+0x08,0x00,0x13,0x1f,0xd7,0x00,0x13,0x0b,0xd2,0x07,0x13,0x05,0x67,0x07,0x3f,0x00,
+0xbc,0xca,0xcc,0x00,0x94,0x32,0x01,0xcf,0xfc,0x19,0x08,0x32,0xdf,0xff,0xfc,0x08,
+0x00,0x20,0xfc,0xcf,0x5c,0x0a,0x50,0x02,0xef,0xfb,0x00,0xbf,0x09,0x00,0x6f,0x89,
+0x98,0x00,0x00,0x89,0x96,0xcc,0x00,0x91,0x00,0x24,0x03,0x21,0x0c,0xfd,0x1b,0x08,
+0x40,0xf8,0x14,0xff,0xb0,0x59,0x00,0x02,0x25,0x03,0x41,0x0c,0xff,0x10,0x6f,0x59,
+0x00,0x2e,0xbd,0xa0,0x26,0x03,0x0f,0xcc,0x00,0x83,0x70,0x4d,0xf8,0x00,0x00,0x8f,
+0xd3,0x00,0x53,0x05,0x41,0x00,0x4f,0xff,0xd0,0xef,0x08,0x00,0xc7,0x0c,0x01,0x57,
+0x05,0x3f,0x07,0xdc,0x30,0x1f,0x03,0x8a,0x34,0x08,0xee,0x90,0x7f,0x04,0x14,0xf6,
+0x8b,0x05,0x12,0xf8,0x09,0x00,0x13,0x2f,0xb4,0x0a,0x48,0x00,0x03,0x99,0x30,0x80,
+0x01,0x22,0x08,0x88,0x01,0x00,0x33,0x80,0x0f,0xff,0x62,0x05,0x0e,0x09,0x00,0x0e,
+0xb9,0x01,0x08,0x48,0x00,0x05,0x5a,0x00,0x05,0x6c,0x00,0x05,0x7e,0x00,0x04,0x90,
+0x00,0x00,0x2f,0x00,0x13,0xff,0x0d,0x08,0x10,0xaf,0x61,0x08,0x91,0x4a,0xdf,0xfd,
+0xaf,0xf6,0x00,0x00,0x01,0xbf,0xcb,0x05,0x20,0x00,0x01,0x7f,0x08,0x00,0x67,0x0a,
+0x40,0xaf,0xff,0xfe,0xab,0xbf,0x08,0xf0,0x03,0x2f,0xff,0xfb,0x00,0x1f,0xff,0xff,
+0xf4,0x08,0xff,0xff,0x10,0x09,0xfe,0xff,0xff,0x90,0xcf,0x4f,0x01,0x30,0x6b,0xff,
+0xfd,0x6a,0x06,0xf0,0x19,0xaf,0xd0,0x8f,0xff,0xf0,0xff,0xff,0x80,0x2f,0xf6,0x07,
+0xff,0xff,0x0d,0xff,0xf9,0x0a,0xfd,0x00,0x8f,0xff,0xf0,0xcf,0xff,0xc2,0xff,0x50,
+0x0b,0xff,0xfe,0x08,0xff,0xff,0xbf,0xd0,0x01,0xff,0xff,0xa0,0x3f,0x83,0x02,0xb2,
+0xaf,0xff,0xf4,0x00,0xaf,0xff,0xff,0xaa,0xef,0xff,0xfc,0x66,0x00,0x00,0xfb,0x05,
+0x20,0x01,0xef,0x94,0x05,0x80,0x20,0x00,0x00,0x2f,0xfb,0xdf,0xfe,0xa5,0x8e,0x06,
+0x22,0xfd,0x00,0x8c,0x03,0x04,0x12,0x05,0x05,0x68,0x04,0x11,0x07,0x56,0x06,0x01,
+0x2d,0x05,0x22,0xb0,0x00,0xb9,0x06,0x12,0xf5,0x22,0x00,0x1f,0xac,0x35,0x05,0x01,
+0x13,0x6f,0x77,0x05,0x0f,0x08,0x00,0x35,0x06,0xcf,0x05,0x11,0xf3,0x08,0x00,0x83,
+0x3f,0xff,0xfa,0x00,0x01,0xcf,0xff,0xf3,0xc2,0x0d,0x23,0xf3,0x09,0x77,0x0d,0x01,
+0xf7,0x09,0xb0,0xaf,0xff,0xf3,0x00,0x07,0xcf,0xfe,0xa4,0x0f,0xff,0xf3,0x70,0x00,
+0x00,0x00,0x00,0x7f,0xff,0xf5,0x07,0x00,0x40,0x02,0xff,0xff,0x60,0x08,0x00,0x40,
+0x0c,0xff,0xf8,0x00,0x01,0x00,0x31,0x6f,0xff,0x90,0x08,0x00,0x3e,0xbc,0xc9,0x00,
+0x01,0x00,0x8f,0x6f,0xff,0xf2,0x00,0x00,0x4f,0xff,0xf3,0x08,0x00,0x35,0x15,0x5f,
+0x08,0x00,0x11,0xf3,0x08,0x00,0xf1,0x03,0x3f,0xff,0xfa,0x00,0x01,0xcf,0xff,0xf3,
+0x0f,0xff,0xff,0xda,0xbf,0xff,0xff,0xf3,0x09,0xff,0x01,0x00,0xf0,0x00,0xf3,0x00,
+0xcf,0xff,0xff,0xff,0xaf,0xff,0xf3,0x00,0x07,0xcf,0xfe,0xa4,0x0f,0x2d,0x00,0x31,
+0x01,0xdf,0xfb,0x92,0x00,0xd0,0x2e,0xff,0xff,0xc1,0x00,0x00,0x00,0x03,0xef,0xfa,
+0xbf,0xfd,0x10,0x44,0x00,0xcf,0x80,0x0a,0xff,0xd1,0x00,0x00,0x66,0x64,0x00,0x00,
+0x56,0x64,0xc0,0x00,0x87,0xe0,0x4e,0xe8,0x00,0x00,0x9f,0xd3,0x00,0x00,0xef,0xff,
+0x30,0x05,0xff,0xfc,0x08,0x00,0x20,0x20,0x04,0x08,0x00,0x6f,0x4c,0xd6,0x00,0x00,
+0x8d,0xc2,0x70,0x01,0x80,0x00,0x2f,0x00,0x11,0xf7,0x94,0x00,0x31,0x0e,0xff,0xf9,
+0x08,0x00,0x31,0x09,0xff,0xfa,0x08,0x00,0x32,0x03,0xff,0xfc,0xad,0x00,0x2e,0x9c,
+0xcb,0x32,0x02,0x00,0x58,0x02,0xa1,0xff,0x10,0x00,0x00,0xff,0xff,0xd0,0x6f,0xff,
+0xf5,0x45,0x00,0xc0,0x01,0xff,0xff,0xa0,0x00,0x09,0xff,0xff,0x10,0x0b,0xff,0xff,
+0xf9,0x00,0x90,0xc0,0x00,0x5f,0xff,0xf4,0x00,0x2f,0xff,0xf6,0x0d,0x00,0x20,0x90,
+0x07,0x2f,0x00,0xd1,0x09,0xff,0xfd,0x00,0xcf,0xff,0xa0,0x00,0x00,0x3f,0xff,0xf2,
+0x1f,0xa7,0x02,0xc1,0xdf,0xff,0x76,0xff,0xfe,0x00,0x00,0x00,0x08,0xff,0xfc,0xbf,
+0xa1,0x02,0x32,0x2f,0xff,0xff,0x97,0x00,0x21,0xcf,0xff,0x19,0x00,0x60,0x00,0x06,
+0xff,0xff,0xff,0x80,0x09,0x00,0x41,0x1f,0xff,0xff,0xf2,0x7a,0x00,0x13,0xbf,0x99,
+0x00,0x61,0x05,0xff,0xff,0x70,0x00,0x00,0x34,0x00,0x11,0xf1,0x08,0x00,0x22,0x07,
+0xff,0x3c,0x02,0x21,0x02,0xef,0xfb,0x02,0x62,0x01,0xac,0xff,0xff,0xe0,0x00,0x54,
+0x00,0x13,0xf6,0x13,0x03,0x02,0xe3,0x00,0x31,0x1d,0xfe,0xc5,0x08,0x00,0x3f,0x3f,
+0xff,0xf4,0x08,0x00,0x25,0xe2,0x3a,0xef,0xea,0x30,0x00,0x3f,0xff,0xfb,0xff,0xff,
+0xff,0xf7,0x00,0x3f,0x5f,0x01,0xf1,0x02,0x60,0x3f,0xff,0xff,0xfb,0xae,0xff,0xff,
+0xe0,0x3f,0xff,0xfc,0x10,0x00,0xaf,0xff,0xf6,0x30,0x00,0x31,0x1f,0xff,0xfa,0x08,
+0x00,0x31,0x0b,0xff,0xfd,0x08,0x00,0x31,0x09,0xff,0xfe,0x08,0x00,0x39,0x08,0xff,
+0xff,0x10,0x00,0x04,0x20,0x00,0x01,0x30,0x00,0x01,0x40,0x00,0x61,0xf5,0x3f,0xff,
+0xff,0xfa,0xad,0x50,0x00,0x01,0x01,0x00,0x16,0x50,0x70,0x00,0x04,0x80,0x00,0x0f,
+0xb8,0x00,0x1b,0x70,0x00,0x3d,0xfa,0x00,0x00,0x7e,0xe5,0x6c,0x00,0x50,0xf6,0x00,
+0x2f,0xff,0xf0,0x4c,0x01,0x20,0x50,0x01,0xaf,0x01,0x7f,0x02,0xbd,0x80,0x00,0x06,
+0xdc,0x40,0xde,0x01,0xba,0x00,0x63,0x01,0x00,0x01,0x00,0x1b,0x30,0x0b,0x00,0x20,
+0x05,0x99,0x01,0x00,0x2f,0x20,0x00,0x01,0x00,0x08,0x34,0x9f,0xff,0xf1,0x0b,0x00,
+0x13,0xff,0x40,0x05,0x01,0xac,0x00,0x16,0xfe,0x1f,0x01,0x13,0xff,0x2d,0x01,0x00,
+0xd3,0x00,0x12,0xa0,0x0b,0x00,0x34,0x8f,0xff,0xff,0x38,0x00,0x32,0xef,0xff,0x7e,
+0x96,0x00,0x71,0x00,0x04,0xff,0xff,0x19,0xff,0xfd,0x0b,0x00,0x43,0x0b,0xff,0xfc,
+0x04,0x84,0x00,0x30,0x1f,0xff,0xf7,0x38,0x01,0x02,0xb0,0x05,0x30,0xf1,0x00,0x9f,
+0x8c,0x01,0x00,0x30,0x01,0x31,0xc0,0x00,0x3f,0x3a,0x01,0x10,0x03,0xbe,0x05,0x11,
+0x0e,0x0b,0x01,0x12,0x09,0x5c,0x01,0x52,0xff,0x20,0x00,0x00,0x0f,0x08,0x02,0x00,
+0x32,0x01,0x13,0x6f,0x0b,0x00,0x11,0xe0,0x4c,0x01,0x01,0x01,0x00,0x10,0xf4,0x03,
+0x01,0x92,0xec,0xcc,0xcc,0xcc,0xcf,0xff,0xfb,0x00,0x08,0xff,0x05,0x72,0x0d,0xff,
+0xff,0x10,0x0e,0xff,0xff,0x40,0x01,0x32,0xff,0x70,0x5f,0xdc,0x03,0x53,0x01,0xff,
+0xff,0xd0,0xbf,0x14,0x02,0x13,0xbf,0x16,0x04,0x00,0x82,0x00,0x04,0x08,0x00,0x10,
+0x69,0x21,0x01,0x1e,0x90,0x17,0x01,0x52,0x02,0x7c,0xef,0xfc,0x82,0xe9,0x00,0x00,
+0x9e,0x01,0x02,0x56,0x04,0x90,0xf6,0x00,0x3f,0xff,0xfd,0x65,0x8f,0xff,0xfe,0xca,
+0x00,0x00,0x25,0x01,0x43,0x30,0x01,0x11,0x10,0x7f,0x06,0x30,0x36,0x89,0x9a,0x08,
+0x00,0x12,0x6e,0x1f,0x03,0x13,0x0a,0x27,0x03,0xc0,0x5f,0xff,0xfb,0x31,0x01,0xff,
+0xff,0x60,0xbf,0xff,0xd0,0x00,0x08,0x00,0x00,0x09,0x01,0x02,0x08,0x00,0x10,0xd0,
+0x54,0x00,0x62,0x60,0xaf,0xff,0xfc,0x77,0xdf,0x4f,0x03,0x01,0x69,0x00,0x50,0x05,
+0xff,0xff,0xff,0xfd,0x25,0x00,0x50,0x29,0xdf,0xfc,0x70,0xaf,0xf3,0x00,0x72,0x04,
+0x88,0x50,0x00,0x08,0x88,0x10,0xd7,0x00,0x52,0xe0,0x00,0x4f,0xff,0x10,0x02,0x02,
+0x23,0xfd,0x9a,0x25,0x02,0x63,0x00,0x5f,0xff,0xff,0xff,0xd1,0xb6,0x00,0x5f,0xae,
+0xff,0xc7,0x00,0x00,0xef,0x01,0xf8,0x40,0xbf,0xf8,0x00,0x04,0x82,0x00,0xa2,0x8f,
+0xfe,0x40,0x2c,0xff,0xc0,0x00,0x00,0x1e,0xff,0xe0,0x00,0x51,0x02,0xdf,0xff,0xff,
+0xe4,0xfb,0x05,0x4f,0x78,0x74,0x00,0x00,0xff,0x01,0x88,0x0f,0xb2,0x01,0x27,0x16,
 0xcf,0xb2,0x01,0x15,0x4c,0xb2,0x01,0x25,0xfe,0x06,0xb2,0x01,0x25,0xf8,0x01,0xb2,
-0x01,0x54,0xf3,0x00,0xaf,0xff,0x90,0x21,0x70,0x14,0x5f,0xb2,0x01,0x34,0x70,0x00,
-0x0e,0xb2,0x01,0x10,0x10,0x16,0x18,0x06,0x34,0x25,0x0f,0xb2,0x01,0x09,0x02,0xa7,
-0x01,0x14,0xf4,0x95,0x09,0x12,0x0e,0xb2,0x01,0x13,0x20,0xef,0x01,0x02,0x53,0x4a,
-0x01,0x56,0x3f,0x13,0x5f,0xcd,0x00,0x01,0xb2,0x01,0x1a,0xf3,0xd3,0x34,0x20,0x00,
-0x07,0x69,0x33,0x03,0x6f,0x1e,0x06,0x33,0x29,0x27,0x9f,0xfc,0xc8,0x02,0x26,0xde,
-0x10,0x41,0x34,0x14,0x40,0xb0,0x0c,0x30,0xcf,0xeb,0x20,0xbc,0x01,0x24,0xfd,0x92,
-0xbc,0x01,0x13,0x80,0xb4,0x00,0x13,0xf7,0xbc,0x01,0x14,0xff,0xbc,0x01,0x1f,0x40,
-0xbc,0x01,0x34,0x23,0x70,0x3f,0x08,0x01,0x00,0xbc,0x01,0x00,0x95,0x17,0x00,0xbc,
-0x01,0x22,0x50,0xaf,0x4c,0x0b,0x13,0x08,0xb0,0x36,0x02,0xa6,0x70,0x01,0xd2,0x4e,
-0x03,0xb3,0x03,0x23,0xee,0x50,0x5b,0x3f,0x12,0x80,0xb8,0x03,0x23,0xfc,0x40,0x57,
-0x2b,0x1a,0xf2,0xd8,0x4c,0x03,0x84,0x01,0x13,0x00,0x0e,0x73,0x0e,0x61,0x1d,0x0a,
-0x01,0x00,0x21,0x17,0xbe,0xda,0x58,0x03,0xfd,0x00,0x13,0xf6,0x2a,0x41,0x04,0x69,
-0x6d,0x02,0x46,0x59,0x10,0x4f,0x65,0x3e,0x00,0x4a,0x34,0x11,0x0c,0x01,0x02,0x11,
-0x06,0x57,0x72,0x03,0x70,0x34,0x03,0xd8,0x0c,0x35,0x8a,0xaa,0x88,0x96,0x34,0x05,
-0xa9,0x34,0x06,0xbc,0x34,0x05,0xcf,0x34,0x06,0xe2,0x34,0x05,0xf5,0x34,0x13,0x05,
-0x8d,0x16,0x34,0x88,0x86,0x2f,0x1b,0x35,0x41,0xb0,0xcf,0xff,0xf2,0x5d,0x02,0x21,
-0xf7,0x05,0x76,0x03,0x00,0x41,0x35,0x51,0x0a,0xff,0xff,0xfe,0xcd,0xa0,0x01,0x15,
-0x1c,0xde,0x26,0x15,0x09,0xdd,0x59,0x00,0x07,0x75,0x24,0xb6,0x10,0xd6,0x35,0x12,
-0xb0,0x1c,0x02,0x12,0xc0,0x3a,0x01,0x17,0xd1,0x6d,0x1e,0x3f,0x07,0xcc,0xc2,0x9a,
-0x6a,0x01,0x43,0xbe,0xff,0xd9,0x20,0x62,0x6c,0x32,0x80,0x00,0x2e,0x9f,0x01,0x12,
-0x0c,0x20,0x0a,0x10,0x24,0x4a,0x2e,0x01,0xb9,0x27,0x10,0xe0,0xdb,0x00,0x10,0xbd,
-0x45,0x05,0x33,0x03,0x77,0x75,0xb2,0x04,0x02,0xae,0x0e,0x05,0xd8,0x1f,0x04,0xb2,
-0x51,0x03,0xf5,0x6e,0x12,0xc4,0x4f,0x00,0x93,0xf9,0x0c,0xff,0xff,0xd9,0xbf,0xff,
-0xff,0x20,0x5a,0x00,0x02,0x69,0x00,0x10,0x70,0x78,0x00,0x32,0xfe,0xd8,0x20,0x8e,
-0x76,0x15,0xf9,0x1d,0x26,0x04,0xbd,0x11,0x32,0xf9,0xef,0xfa,0xb9,0x03,0x40,0xf7,
-0x01,0xdf,0xfa,0xd8,0x00,0x6f,0x78,0x84,0x00,0x01,0x78,0x83,0xc8,0x01,0xd5,0x33,
-0x07,0xff,0xf3,0x9c,0x08,0x12,0xf3,0x79,0x0b,0x01,0xe6,0x75,0x00,0x14,0x78,0x9f,
-0xf4,0x00,0x04,0x99,0x92,0x00,0x05,0x99,0x90,0xc8,0x01,0x7f,0x35,0x00,0xaf,0xd4,
-0x79,0x3a,0x15,0xe0,0x68,0x09,0x05,0xde,0x40,0x14,0x70,0x2d,0x06,0x1f,0x10,0x90,
-0x03,0xd7,0x33,0x03,0xdf,0xb1,0x23,0x1b,0x09,0x6f,0x1c,0x13,0x6f,0x99,0x79,0x2f,
-0x12,0x00,0x90,0x03,0x7f,0x53,0x01,0xdf,0xfd,0x10,0x07,0x8c,0x23,0x44,0xfe,0x28,
-0xff,0xfb,0xfa,0x3a,0x05,0x7d,0x0b,0x03,0x80,0x6c,0x15,0x07,0xde,0x30,0x3e,0x05,
-0x66,0x20,0xc8,0x01,0x25,0xeb,0x72,0xc8,0x01,0x11,0xf9,0x08,0x23,0x05,0xd1,0x11,
-0x01,0xc8,0x01,0x11,0xfb,0xc8,0x01,0x00,0x75,0x5e,0x11,0xf4,0xc8,0x01,0x00,0x63,
-0x00,0x12,0xa1,0xc8,0x01,0x36,0x0a,0xcc,0xca,0x30,0x12,0x0f,0xc8,0x01,0x2c,0x35,
-0x0b,0xdd,0xda,0xc8,0x01,0x14,0xa0,0xc8,0x01,0x12,0xf6,0xc8,0x01,0x17,0x7f,0xc8,
-0x01,0x35,0x60,0x00,0x1c,0xa0,0x07,0x13,0x09,0xe7,0x5e,0x02,0xc8,0x01,0x11,0xa6,
-0x4d,0x00,0x50,0xf8,0x00,0x1c,0xff,0xe3,0x97,0x04,0x32,0x1d,0xff,0xe2,0x06,0x32,
-0x12,0xe2,0x65,0x00,0x11,0xe2,0x6d,0x00,0x2f,0xbb,0xa1,0xc8,0x01,0x7e,0x80,0x58,
-0x87,0x10,0x00,0x58,0x88,0x10,0x00,0xe2,0x35,0x03,0xb2,0x6e,0x23,0xcf,0xfe,0xe1,
-0x17,0x15,0x0b,0x22,0x3c,0x03,0xc5,0x23,0x0e,0xb8,0x39,0x0f,0xa5,0x6a,0xb3,0x04,
-0x1c,0x08,0x03,0x63,0x79,0x11,0x04,0xde,0x20,0x04,0x15,0x00,0x34,0x06,0xff,0xd0,
-0x15,0x00,0x24,0x9f,0xf8,0x15,0x00,0x12,0x0f,0x4a,0x02,0x10,0x04,0x8f,0x4c,0x14,
-0xa0,0x15,0x00,0x82,0x02,0x91,0x00,0x00,0x3a,0xef,0xea,0x34,0x3a,0x09,0x03,0x08,
-0x55,0x03,0x4b,0x0c,0x02,0x4f,0x0a,0x04,0x0d,0x55,0x01,0x14,0x02,0x31,0xb0,0x00,
-0x1d,0x15,0x00,0x04,0x71,0x4d,0x03,0x68,0x58,0x02,0x9e,0x4c,0x04,0x66,0x4d,0x03,
-0xe6,0x01,0x0c,0x15,0x00,0x01,0xec,0x01,0x13,0x04,0x5c,0x1c,0x04,0x3f,0x00,0x01,
-0x19,0x52,0x02,0x54,0x00,0x04,0x26,0x55,0x04,0x2a,0x51,0x06,0x93,0x00,0x03,0x34,
-0x2f,0x41,0x29,0xef,0xeb,0x30,0xbe,0x47,0x0f,0x7b,0x36,0xd6,0x08,0xff,0x09,0x14,
-0x4f,0x39,0x30,0x03,0x4e,0x52,0x05,0x09,0x00,0x6e,0x2d,0xdd,0xdf,0xff,0xfd,0xd9,
-0x2d,0x00,0x05,0xde,0x56,0x05,0xd7,0x01,0x04,0x3f,0x4f,0x06,0xd4,0x01,0x04,0xe2,
-0x56,0x06,0xd1,0x01,0x04,0x43,0x4f,0x06,0xb9,0x01,0x04,0x45,0x4f,0x06,0x12,0x00,
-0x04,0xe8,0x56,0x06,0xc8,0x01,0x04,0xea,0x56,0x06,0xc5,0x01,0x06,0xf9,0x2a,0x05,
-0xc2,0x01,0x05,0xee,0x56,0x13,0x7f,0xc9,0x3f,0x04,0x08,0x00,0x10,0x49,0x7b,0x0f,
-0x1f,0x93,0x79,0x3c,0xaf,0x13,0xdf,0xfc,0x0c,0x04,0x08,0x00,0x10,0x79,0xd8,0x00,
-0x1f,0x80,0x78,0x21,0x87,0x90,0x38,0x86,0x00,0x00,0x78,0x82,0x00,0x00,0x5f,0x5c,
-0x38,0x10,0xf3,0x82,0x03,0x43,0xe9,0xaf,0xff,0xd0,0x52,0x76,0x10,0x20,0x72,0x03,
-0x4f,0xdf,0xfd,0x81,0x00,0x98,0x01,0xb0,0x21,0xf6,0x00,0x12,0x05,0x63,0xaf,0xfd,
-0x30,0x3d,0xff,0xa0,0xdc,0x31,0x12,0x20,0x93,0x2d,0x12,0xd3,0xce,0x82,0x1f,0x74,
-0xa0,0x24,0x8b,0x14,0x02,0x3c,0x37,0x04,0x45,0x0c,0x05,0xcc,0x05,0x03,0xb2,0x19,
-0x1f,0xe6,0xa1,0x40,0xb2,0x00,0xb4,0x78,0x02,0xc6,0x07,0x19,0xfa,0x5b,0x2c,0x14,
-0x04,0xd8,0x04,0x2f,0x02,0x00,0xa8,0x01,0x88,0x0f,0x70,0x01,0x2f,0x0f,0x68,0x01,
-0x05,0x04,0x88,0x01,0x0f,0xf9,0x42,0x3f,0x23,0xaf,0xfc,0x32,0x63,0x13,0xc0,0x57,
-0x45,0x14,0x90,0x01,0x46,0x13,0xd0,0x51,0x13,0x12,0xf1,0xad,0x79,0x2e,0xfe,0xa1,
-0x68,0x01,0x12,0xbf,0xa0,0x00,0x00,0x6d,0x7d,0x00,0x68,0x01,0x3e,0x0f,0xff,0xfd,
-0x68,0x01,0x1f,0x0f,0x68,0x01,0x07,0x04,0x99,0x65,0x04,0xda,0x0a,0x01,0x8a,0x7b,
-0x21,0x01,0xc8,0x80,0x3c,0x43,0x66,0x9e,0xff,0x60,0xac,0x6f,0x12,0xc0,0xff,0x09,
-0x00,0x27,0x20,0x13,0x6c,0xbe,0x0a,0x23,0x00,0x0b,0x38,0x77,0x0c,0x4f,0x11,0x13,
-0x4f,0x4f,0x11,0x19,0x0d,0x4f,0x11,0x10,0x78,0xe8,0x04,0x40,0x87,0x00,0x00,0x3f,
-0xec,0x81,0x10,0xe3,0x96,0x0f,0x42,0xfb,0xcf,0xfe,0x20,0x71,0x1b,0x12,0xd1,0x5f,
-0x17,0x2f,0xfc,0x10,0x40,0x03,0xaf,0x11,0x03,0x38,0x27,0x10,0xf4,0xe8,0x00,0x11,
-0xb1,0xfe,0x0a,0x14,0x03,0xe6,0x01,0x13,0x3e,0x6c,0x0c,0x3f,0x03,0xbb,0xb3,0xe8,
-0x04,0x8c,0x25,0xdf,0xfa,0x1c,0x50,0x02,0xf6,0x00,0x00,0x0e,0x1d,0x24,0xdf,0xfb,
-0x83,0x2a,0x12,0x1c,0xa8,0x02,0x00,0x86,0x7f,0x2e,0x78,0x84,0x6b,0x0f,0x0f,0x69,
-0x74,0xcd,0x04,0x89,0x87,0x12,0x00,0xdd,0x31,0x01,0x0b,0x24,0x21,0xff,0xf8,0xa5,
-0x00,0xae,0x70,0x3e,0xff,0x80,0x00,0x01,0x99,0x95,0x00,0x02,0x4a,0x09,0x0f,0x49,
-0x5f,0xa5,0x00,0x74,0x01,0x31,0xfb,0x00,0x00,0x1f,0x04,0x00,0xa5,0x08,0x12,0x05,
-0x8d,0x04,0x01,0xa7,0x08,0x14,0xa0,0xed,0x89,0x03,0xba,0x03,0x10,0x19,0x82,0x26,
-0x0f,0x12,0x02,0xe0,0x10,0xbf,0xa3,0x6f,0x11,0xf0,0xbb,0x29,0x0a,0xd8,0x18,0x11,
-0xcf,0xa3,0x4a,0x00,0xd8,0x18,0x3f,0x75,0x00,0x00,0x12,0x02,0xb7,0x00,0xed,0x08,
-0x25,0xe5,0x00,0x0a,0x11,0x06,0x06,0x19,0x14,0x10,0x76,0x41,0x2e,0xf9,0x00,0x8e,
-0x13,0x0f,0x24,0x04,0xda,0x39,0x01,0xbf,0xd3,0xd3,0x83,0x01,0xfb,0x2f,0x01,0xe6,
-0x06,0x1e,0xf6,0x19,0x01,0x0f,0x12,0x02,0xb0,0x0f,0xcc,0x01,0xc9,0x08,0x01,0x00,
-0x2e,0x4f,0xff,0x0a,0x00,0x25,0x5f,0xfd,0x08,0x1b,0x05,0x0e,0x80,0x03,0x4f,0x14,
-0x00,0x4e,0x07,0x15,0x90,0xb2,0x13,0x0c,0x4d,0x00,0x24,0x09,0xd5,0x4b,0x00,0x03,
-0x81,0x81,0x04,0xfc,0x8c,0x13,0xf8,0x33,0x4e,0x13,0xf6,0x08,0x00,0x19,0xf5,0x08,
-0x00,0x0e,0x4f,0x03,0x0f,0x4e,0x04,0xac,0x44,0x02,0x88,0x60,0x00,0x39,0x90,0x14,
-0x90,0xab,0x19,0x04,0x05,0x55,0x21,0xf8,0x1d,0x85,0x08,0x00,0xa8,0x8e,0x1f,0x1c,
-0x6d,0x57,0x03,0x1f,0x0f,0x80,0x7b,0x42,0x0e,0xf2,0x7b,0x08,0x13,0x00,0x01,0xd8,
-0x7d,0x3f,0xcf,0xff,0xf8,0x77,0x7c,0x42,0x10,0x80,0x8f,0x3e,0x13,0x60,0x49,0x01,
-0x14,0xf8,0x7a,0x51,0x02,0xae,0x3d,0x10,0x72,0xce,0x1a,0x00,0xe7,0x85,0x16,0x1d,
-0xf0,0x91,0x0f,0xed,0x66,0xae,0x01,0xcc,0x5d,0x12,0x00,0xdf,0x23,0x01,0xe8,0x23,
-0x02,0x4a,0x8a,0x07,0x17,0x00,0x16,0x08,0xf4,0x35,0x26,0xfb,0x8f,0x0c,0x00,0x40,
-0xb5,0xae,0xff,0xff,0x60,0x52,0x4f,0xaf,0xff,0xfe,0xa7,0x45,0x00,0x0f,0x04,0x45,
-0x52,0x12,0xff,0x17,0x00,0x03,0x01,0x00,0x0c,0x17,0x00,0x10,0xfb,0xdb,0x01,0x1f,
-0xff,0x45,0x00,0x0a,0x0f,0x17,0x00,0x3b,0x05,0xb0,0x3c,0x04,0x09,0x00,0x64,0xad,
-0xdf,0xff,0xfe,0xdd,0xd1,0x11,0x70,0x18,0xf1,0x09,0x00,0x0e,0x2d,0x00,0x00,0x09,
-0x00,0x41,0x05,0xce,0xfd,0x91,0x2e,0x6c,0x11,0xbf,0x87,0x88,0x03,0x34,0x3d,0x10,
-0xd0,0x09,0x00,0x23,0xfc,0xac,0x6d,0x14,0x31,0x30,0x00,0x6f,0x84,0x60,0x12,0xf9,
-0x4d,0x8b,0x12,0x0e,0xdf,0x43,0x1f,0xfb,0x09,0x00,0x48,0x73,0x7e,0xfd,0x72,0x05,
-0xff,0x70,0x7f,0x09,0x84,0xbf,0xde,0xff,0xff,0xfa,0x02,0xdd,0x70,0x03,0x9c,0xc7,
-0x00,0x53,0x4d,0x8a,0xd0,0x8e,0xe7,0x00,0x06,0xff,0x30,0x8f,0xff,0xfc,0x31,0xcf,
-0xf1,0x1f,0x84,0x67,0xdb,0xfc,0x05,0xff,0x70,0x2d,0xff,0xff,0x30,0x6d,0xd2,0x00,
-0x07,0xca,0xc5,0x4e,0x0f,0xf2,0x32,0x5b,0x11,0xbf,0x06,0x02,0x02,0x06,0x00,0x0e,
-0x2b,0x25,0x03,0xc0,0x00,0x0f,0x06,0x00,0x6a,0x06,0xb8,0x68,0x20,0xfd,0x89,0xa1,
-0x00,0x09,0x0f,0x0c,0x12,0xef,0xb4,0x62,0x1f,0xf9,0x0b,0x00,0x41,0x80,0x58,0x84,
-0x00,0x01,0x88,0x80,0x9f,0xfc,0x60,0x5f,0x10,0x3f,0xb9,0x1a,0x22,0x90,0x07,0xd0,
-0x03,0x5f,0x3a,0xef,0xfc,0x60,0x00,0x27,0x01,0x7e,0x50,0xf4,0x00,0x07,0xff,0xcd,
-0xc0,0x96,0x90,0xfa,0x8f,0xfe,0x40,0x6f,0xff,0x41,0xdf,0xff,0x39,0x4e,0x11,0xcf,
-0xf5,0x06,0x3f,0x37,0x86,0x20,0x32,0x01,0x51,0x01,0xf5,0x02,0x0f,0x04,0x00,0x3d,
-0xd0,0xef,0xff,0xf0,0x07,0xff,0xd4,0x00,0x3f,0xff,0x10,0x00,0x8f,0xfd,0xeb,0x07,
-0xf0,0x02,0xde,0x20,0x3f,0xff,0xff,0x50,0x04,0xcf,0xeb,0x30,0x00,0x5e,0xfa,0x10,
-0x2f,0xff,0xf9,0x61,0x30,0x00,0x7d,0x65,0x28,0x17,0x84,0x81,0x6c,0x01,0x92,0x87,
-0x0f,0x07,0x00,0x1f,0x90,0x0b,0xff,0xb1,0x08,0xff,0xb0,0x00,0xdf,0xf8,0x95,0x64,
-0xf0,0x00,0xc0,0x7f,0xff,0xff,0x00,0x7d,0xfe,0x90,0x00,0x21,0x00,0x2e,0xff,0x50,
-0x9f,0x70,0x92,0x33,0xd0,0x1b,0xfd,0xb1,0x03,0x0f,0x4e,0x83,0x2f,0x5f,0xef,0xff,
-0x9e,0xff,0xf9,0x05,0x00,0x12,0x14,0x90,0x7c,0x83,0x00,0xae,0x45,0x0f,0x0c,0x00,
-0x99,0x31,0xdd,0xdd,0x90,0x8b,0x89,0x02,0xca,0x01,0x10,0xd0,0xfb,0x07,0x00,0x48,
-0x84,0x00,0x6b,0x7a,0x00,0x61,0x14,0x40,0xc0,0xaf,0xff,0xf0,0x5e,0x0a,0x53,0xec,
-0xef,0xff,0xff,0x40,0xfc,0x53,0x01,0x9c,0x1b,0x01,0x48,0x00,0x12,0x9f,0x20,0x1e,
-0x01,0x0c,0x00,0xf0,0x00,0x02,0x9c,0xef,0xec,0x82,0x00,0x00,0x05,0xef,0xa1,0x00,
-0x02,0xbf,0xd4,0x02,0xbc,0x08,0x10,0xbf,0x98,0x03,0x11,0xfb,0x29,0x28,0x11,0xef,
-0xa2,0x54,0x11,0xc0,0xd6,0x6e,0x1d,0x59,0x31,0x10,0x02,0xbe,0x1b,0x22,0xf0,0x0f,
-0x0f,0x1c,0x0f,0x0f,0x00,0x5e,0x03,0xf1,0x1f,0x07,0x2f,0x91,0x21,0xba,0xef,0x0a,
-0x17,0x13,0x0f,0xc7,0x2b,0x03,0x85,0x21,0x35,0x0d,0xff,0xea,0x61,0x7c,0x15,0xf3,
-0x07,0x27,0x23,0xff,0x40,0x63,0x04,0x14,0xe9,0xf7,0x28,0x22,0xfe,0x20,0xe2,0x60,
-0x6f,0x04,0x88,0x71,0x00,0x04,0x88,0x1f,0x11,0x07,0x04,0x40,0x85,0x0f,0x0a,0x00,
-0x76,0x04,0xc6,0x85,0x03,0x84,0x0a,0x01,0xb0,0x46,0x04,0xca,0x85,0x24,0x00,0x00,
-0xcc,0x85,0x02,0xbe,0x52,0x03,0x28,0x1e,0x05,0xd0,0x85,0x04,0xd2,0x85,0x01,0xb8,
-0x0d,0x01,0xe6,0x15,0x11,0x9f,0xcd,0x1a,0x50,0x9f,0xff,0xaf,0xfe,0x20,0xd0,0x3a,
-0x9b,0x8f,0xfe,0x20,0x5b,0xba,0x20,0x00,0x7b,0xb9,0x06,0x01,0x03,0xe7,0x5a,0x01,
-0x02,0x1b,0x0f,0x0d,0x00,0x50,0x02,0x26,0x15,0x01,0xdb,0x00,0x21,0x1b,0xae,0xf2,
-0x9b,0x02,0x35,0x1c,0x22,0x3f,0xff,0xa3,0x16,0x01,0x7a,0x1b,0x0f,0x97,0x86,0xbd,
-0x00,0x88,0x00,0x25,0x38,0x87,0xdb,0x29,0x14,0xd0,0x6a,0x0f,0x15,0xfc,0x84,0x01,
-0x14,0x90,0x7f,0x06,0x14,0xf3,0x60,0x0c,0x14,0xfb,0xa1,0x01,0x1b,0x6d,0xb7,0x10,
-0x0f,0xd8,0x71,0xb9,0x07,0xd7,0x00,0x14,0x0d,0x4f,0x26,0x24,0xdf,0xf6,0xe8,0x09,
-0x13,0x40,0x84,0x0f,0x1a,0xf0,0xeb,0x0f,0x14,0x09,0xa7,0x24,0x23,0x02,0x30,0xbe,
-0x04,0x00,0x6e,0x01,0x10,0xfa,0x7e,0x21,0x00,0x5e,0x36,0x10,0x10,0x11,0x00,0x11,
-0x5f,0x2a,0x02,0x32,0xf8,0x00,0x1e,0x85,0x82,0x22,0x80,0x0a,0xb6,0x01,0x23,0xf8,
-0x04,0x8d,0x82,0x13,0xa4,0xda,0x01,0x03,0x07,0x25,0x04,0x50,0x03,0x0a,0x11,0x00,
+0x01,0x34,0xf3,0x00,0xaf,0xb2,0x01,0x34,0xd0,0x00,0x5f,0xb2,0x01,0x34,0x70,0x00,
+0x0e,0xb2,0x01,0x00,0xa7,0x01,0x03,0xb2,0x01,0x01,0x01,0x00,0x0f,0xb2,0x01,0x08,
+0x02,0xa7,0x01,0x14,0xf4,0x95,0x09,0x12,0x0e,0xb2,0x01,0x13,0x20,0xef,0x01,0x12,
+0x0e,0x7f,0x00,0x11,0x04,0xb2,0x01,0x02,0xcd,0x00,0x01,0xb2,0x01,0x15,0xf3,0xb2,
+0x01,0x13,0x00,0x02,0x05,0x14,0xe5,0xf5,0x00,0x35,0x4f,0xfe,0x10,0xbd,0x02,0x17,
+0xfc,0xc8,0x02,0x14,0xde,0x17,0x00,0x15,0x3f,0x00,0x01,0x50,0x00,0x04,0xcf,0xeb,
+0x20,0xbc,0x01,0x24,0xfd,0x92,0xbc,0x01,0x13,0x80,0xb4,0x00,0x13,0xf7,0xbc,0x01,
+0x14,0xff,0xbc,0x01,0x1f,0x40,0xbc,0x01,0x34,0x23,0x70,0x3f,0x08,0x01,0x00,0xbc,
+0x01,0x40,0xfb,0xdf,0xff,0xb0,0xbc,0x01,0x42,0x50,0xaf,0xff,0xb0,0x8b,0x05,0x13,
+0xd3,0x99,0x01,0x13,0x20,0x0d,0x09,0x04,0xb3,0x03,0x41,0xee,0x50,0x00,0x00,0x8f,
+0x02,0x12,0x80,0xb8,0x03,0x12,0xfc,0xc3,0x00,0x33,0xaf,0xff,0xf2,0xf6,0x00,0x04,
+0xc8,0x06,0x02,0x84,0x01,0x01,0x3f,0x01,0x13,0xf6,0x9c,0x02,0x1f,0xcc,0xe4,0x03,
+0x07,0x54,0x17,0xbe,0xff,0xda,0x60,0xb2,0x03,0x01,0x31,0x00,0x11,0xbf,0x9e,0x00,
+0x10,0xf9,0x5b,0x00,0x30,0xff,0xfd,0xdf,0x09,0x01,0x40,0x4f,0xff,0xfe,0x50,0x02,
+0x01,0x20,0xf1,0x0c,0x01,0x02,0x00,0x0a,0x00,0x12,0x71,0x37,0x02,0x42,0x0f,0xff,
+0xfb,0x5f,0x65,0x00,0x33,0x8a,0xaa,0x88,0x1d,0x02,0x00,0x6a,0x01,0x03,0x93,0x00,
+0x11,0x0a,0x29,0x07,0x02,0xa6,0x00,0x03,0x5b,0x02,0x02,0xbd,0x03,0x02,0x70,0x00,
+0x24,0xf3,0x00,0xcd,0x06,0x10,0x50,0xc1,0x01,0x52,0x88,0x86,0x2f,0xff,0xfa,0xe0,
+0x01,0x41,0xb0,0xcf,0xff,0xf2,0x5d,0x02,0x20,0xf7,0x05,0x76,0x03,0x00,0x30,0x02,
+0x61,0x10,0x0a,0xff,0xff,0xfe,0xcd,0xa0,0x01,0x12,0x1c,0x40,0x01,0x14,0xa0,0x5e,
+0x02,0x10,0x70,0xe3,0x00,0x63,0x8c,0xef,0xfd,0xb6,0x10,0x00,0xd2,0x03,0x12,0xb0,
+0x1c,0x02,0x12,0xc0,0x3a,0x01,0x12,0xd1,0x39,0x01,0x11,0xe1,0x27,0x02,0x3e,0xcc,
+0xc2,0x00,0x01,0x00,0x82,0x05,0xbe,0xff,0xd9,0x20,0x00,0x00,0x2d,0x00,0x02,0x12,
+0x2e,0x9f,0x01,0x12,0x0c,0x20,0x0a,0xb0,0x24,0xff,0xff,0x90,0x00,0x3f,0xff,0xf8,
+0x9f,0xff,0xe0,0xdb,0x00,0x10,0xbd,0x45,0x05,0x33,0x03,0x77,0x75,0xb2,0x04,0x13,
+0x0f,0x94,0x02,0x03,0x0f,0x00,0x13,0x0d,0x63,0x05,0x01,0x2d,0x00,0x32,0x8f,0xff,
+0xc4,0x4f,0x00,0x93,0xf9,0x0c,0xff,0xff,0xd9,0xbf,0xff,0xff,0x20,0x5a,0x00,0x02,
+0x69,0x00,0x10,0x70,0x78,0x00,0x41,0xfe,0xd8,0x20,0x00,0xcb,0x0b,0x24,0xf9,0x00,
+0x23,0x05,0x13,0xf9,0x16,0x01,0x32,0xf9,0xef,0xfa,0xb9,0x03,0x40,0xf7,0x01,0xdf,
+0xfa,0xd8,0x00,0x6f,0x78,0x84,0x00,0x01,0x78,0x83,0xc8,0x01,0xd5,0x33,0x07,0xff,
+0xf3,0x9c,0x08,0x12,0xf3,0x79,0x0b,0x20,0xff,0xf3,0x8a,0x00,0xcf,0xe3,0x07,0xff,
+0xf4,0x00,0x04,0x99,0x92,0x00,0x05,0x99,0x90,0xc8,0x01,0x7f,0x33,0x00,0xaf,0xd4,
+0x8b,0x00,0x35,0x7f,0xff,0xe0,0x68,0x09,0x03,0x13,0x00,0x34,0x1d,0xff,0x70,0x2d,
+0x06,0x1f,0x10,0x90,0x03,0xd0,0x50,0xfd,0xb6,0x10,0x00,0x00,0x60,0x00,0x00,0x03,
+0xdf,0xb1,0x00,0x01,0x00,0x30,0xdf,0xff,0x80,0x07,0x00,0x31,0x0e,0xff,0xf9,0x0f,
+0x00,0x31,0x6f,0xfe,0x20,0x08,0x00,0x3e,0x12,0x00,0x00,0x01,0x00,0xf1,0x01,0x05,
+0xbe,0xff,0xd9,0x20,0x00,0x00,0x2d,0xff,0xff,0xff,0xff,0x80,0x00,0x2e,0xff,0x08,
+0x00,0xf0,0x12,0x0c,0xff,0xff,0xda,0xbf,0xff,0xff,0x24,0xff,0xff,0x90,0x00,0x3f,
+0xff,0xf8,0x9f,0xff,0xe0,0x00,0x00,0x9f,0xff,0xbd,0xff,0xfb,0x00,0x00,0x03,0x77,
+0x75,0xef,0xff,0x90,0x3a,0x00,0x31,0x0f,0xff,0xf8,0x42,0x00,0x03,0x0f,0x00,0x31,
+0x0d,0xff,0xfb,0x0f,0x00,0x01,0x2d,0x00,0x32,0x8f,0xff,0xc4,0x4f,0x00,0x93,0xf9,
+0x0c,0xff,0xff,0xd9,0xbf,0xff,0xff,0x20,0x5a,0x00,0x02,0x69,0x00,0x10,0x70,0x78,
+0x00,0xa1,0xfe,0xd8,0x20,0x00,0x00,0x01,0xdf,0xfd,0x10,0x07,0xa8,0x00,0x42,0x02,
+0xef,0xfe,0x28,0x43,0x00,0x52,0x03,0xff,0xff,0xff,0xfc,0x9d,0x00,0x41,0xff,0xff,
+0xfd,0x10,0x0a,0x00,0x43,0x07,0xff,0xfe,0x10,0xb1,0x00,0x2b,0x66,0x20,0xc3,0x00,
+0x50,0x17,0xbe,0xff,0xeb,0x72,0x09,0x00,0x10,0x8f,0x5c,0x00,0x50,0xf9,0x10,0x00,
+0x00,0xbf,0x6d,0x00,0x00,0x3b,0x00,0xf1,0x07,0xaf,0xff,0xff,0xfd,0xdf,0xff,0xff,
+0xfb,0x00,0x4f,0xff,0xfe,0x50,0x00,0x04,0xef,0xff,0xf4,0x0c,0xff,0xff,0x30,0x63,
+0x00,0xd2,0xa1,0xff,0xff,0xa0,0x00,0x00,0x00,0x0a,0xcc,0xca,0x5f,0xff,0xf6,0x49,
+0x00,0x11,0x08,0x1c,0x00,0x02,0xc5,0x00,0x12,0xf2,0x09,0x00,0x33,0x0a,0xff,0xff,
+0x78,0x00,0x32,0xaf,0xff,0xf1,0x09,0x00,0x33,0x09,0xff,0xff,0x82,0x00,0x44,0x8f,
+0xff,0xf3,0x00,0xa8,0x00,0xa0,0x50,0x00,0x00,0x00,0x0b,0xdd,0xda,0x2f,0xff,0xfa,
+0x11,0x00,0x41,0xff,0xff,0xa0,0xcf,0x43,0x00,0x70,0x7f,0xff,0xf6,0x05,0xff,0xff,
+0xe4,0x09,0x00,0xe3,0xff,0x10,0x0a,0xff,0xff,0xfe,0xcd,0xff,0xff,0xff,0x60,0x00,
+0x1c,0xff,0x0f,0x01,0x20,0x00,0x09,0x08,0x00,0x20,0xfe,0x60,0x01,0x01,0x41,0x8c,
+0xef,0xfd,0xa6,0x4d,0x00,0xc1,0xf8,0x00,0x1c,0xff,0xe3,0x00,0x05,0xff,0xf9,0x1d,
+0xff,0xe2,0x5d,0x00,0x22,0xff,0xe2,0x65,0x00,0x11,0xe2,0x6d,0x00,0x2f,0xbb,0xa1,
+0xc8,0x01,0x7e,0xf0,0x00,0x58,0x87,0x10,0x00,0x58,0x88,0x10,0x00,0x00,0x1c,0xff,
+0xd1,0x08,0xff,0xf7,0x40,0x00,0x60,0xcf,0xfe,0x9f,0xff,0x60,0x00,0x16,0x01,0x32,
+0xff,0xff,0xf5,0xa4,0x00,0x4f,0xbf,0xff,0x40,0x00,0x01,0x00,0x02,0x00,0x4c,0x00,
+0x23,0xeb,0x71,0x09,0x00,0x34,0xff,0xff,0x91,0x09,0x00,0xf1,0x05,0xfe,0x20,0x00,
+0xff,0xff,0xeb,0xbc,0xef,0xff,0xff,0xe1,0x00,0xff,0xff,0xb0,0x00,0x03,0xcf,0xff,
+0xfb,0x09,0x00,0x00,0x55,0x00,0x11,0x40,0x09,0x00,0x40,0x02,0xff,0xff,0xb0,0x09,
+0x00,0x00,0x5e,0x00,0x11,0xf0,0x09,0x00,0x00,0x97,0x01,0x02,0x09,0x00,0x32,0x6f,
+0xff,0xf5,0x09,0x00,0x3b,0x5f,0xff,0xf6,0x09,0x00,0x05,0x1b,0x00,0x34,0x8f,0xff,
+0xf4,0x3f,0x00,0x14,0xf1,0x51,0x00,0x11,0xc0,0x09,0x00,0x43,0x0c,0xff,0xff,0x50,
+0x75,0x00,0x14,0xfc,0x87,0x00,0x18,0xe2,0x99,0x00,0x00,0x01,0x00,0x13,0xa1,0xbd,
+0x00,0x14,0x72,0xcb,0x00,0x60,0x4f,0xff,0xf4,0x05,0xff,0xf0,0x0a,0x00,0x64,0x04,
+0xff,0xff,0x40,0x5f,0xff,0x15,0x00,0x34,0x06,0xff,0xd0,0x15,0x00,0x24,0x9f,0xf8,
+0x15,0x00,0x33,0x0f,0xff,0x20,0x15,0x00,0x34,0x44,0xff,0xa0,0x15,0x00,0xb1,0x02,
+0x91,0x00,0x00,0x3a,0xef,0xea,0x34,0xff,0xff,0x40,0xa9,0x00,0x51,0xff,0xff,0xaf,
+0xff,0xf4,0xbc,0x00,0x01,0x01,0x00,0x10,0x40,0xd9,0x03,0x40,0xff,0xea,0xbf,0xff,
+0x15,0x00,0x10,0x05,0xa1,0x00,0x11,0x1d,0x15,0x00,0x00,0xa0,0x02,0x00,0x3f,0x00,
+0x00,0xc2,0x01,0x12,0xfc,0x69,0x00,0x03,0xd4,0x01,0x01,0x15,0x00,0x01,0xe6,0x01,
+0x0c,0x15,0x00,0x01,0xec,0x01,0x02,0x15,0x00,0x15,0x9f,0x3f,0x00,0x10,0x05,0x19,
+0x03,0x14,0x1d,0x69,0x00,0x12,0xda,0x69,0x00,0x25,0x00,0x4f,0x7e,0x00,0x01,0x93,
+0x00,0x11,0x8f,0x15,0x00,0x61,0x00,0x29,0xef,0xeb,0x30,0xdf,0x15,0x00,0x10,0x08,
+0x1e,0x00,0x25,0xd9,0x40,0x87,0x03,0x24,0xff,0xd4,0x15,0x00,0x31,0xff,0xff,0xf8,
+0x15,0x00,0x63,0xfc,0xbb,0xdf,0xff,0xff,0xf7,0x66,0x03,0x42,0x07,0xff,0xff,0xf3,
+0x41,0x03,0x00,0x70,0x00,0x13,0xc0,0x7b,0x03,0x10,0x0a,0x06,0x00,0x02,0x56,0x03,
+0x34,0x4f,0xff,0xf8,0x90,0x03,0xe1,0xff,0xff,0xb4,0xdd,0xef,0xff,0xfd,0xdd,0x80,
+0x00,0x0e,0xff,0xfd,0x5f,0xe4,0x03,0x00,0xe4,0x04,0x11,0xe5,0x5c,0x00,0x54,0x90,
+0x00,0x0d,0xff,0xfe,0x2a,0x00,0x33,0xef,0xff,0xd0,0x3f,0x00,0x33,0x0f,0xff,0xfb,
+0x15,0x00,0x10,0x04,0xae,0x02,0x02,0x15,0x00,0x33,0xaf,0xff,0xf3,0x15,0x00,0x32,
+0x5f,0xff,0xfc,0x7e,0x00,0x00,0x98,0x03,0x10,0x30,0x15,0x00,0x22,0xcb,0xbc,0x90,
+0x03,0x15,0x8f,0x9a,0x03,0x12,0x08,0x45,0x04,0x13,0x40,0xd2,0x00,0x27,0xfd,0x94,
+0xe3,0x01,0x09,0x09,0x00,0x10,0x3f,0x28,0x00,0x18,0xfb,0x09,0x00,0x7e,0x2d,0xdd,
+0xdf,0xff,0xfd,0xd9,0x00,0x2d,0x00,0x41,0x03,0xae,0xfe,0xa3,0x09,0x00,0x04,0xd7,
+0x01,0x12,0x05,0x6f,0x00,0x16,0xf4,0xd4,0x01,0x86,0x5f,0xff,0xfb,0x00,0x01,0xdf,
+0xff,0xf4,0xd1,0x01,0x32,0xdf,0xff,0xc0,0x09,0x00,0x05,0xb9,0x01,0x01,0xa0,0x00,
+0x09,0x12,0x00,0x32,0xdf,0xff,0xb0,0x09,0x00,0x05,0xc8,0x01,0x32,0x5f,0xff,0xfa,
+0x48,0x00,0x05,0xc5,0x01,0x14,0x04,0x6c,0x00,0x06,0xc2,0x01,0x71,0x02,0x9e,0xfe,
+0xb3,0x0d,0xff,0xf4,0x07,0x01,0x01,0xa7,0x03,0x04,0x08,0x00,0x6e,0x49,0x99,0x99,
+0x99,0x99,0x93,0xa9,0x03,0x03,0x43,0x00,0x0e,0x08,0x00,0x62,0xeb,0xbb,0xbb,0xbb,
+0xbb,0xb2,0x4b,0x03,0x2f,0x00,0x00,0x08,0x00,0x07,0x53,0xea,0xaa,0xaa,0xaa,0xa7,
+0x48,0x00,0x1e,0xfb,0x08,0x00,0x0f,0x40,0x00,0x0e,0x0c,0x08,0x00,0x01,0x78,0x00,
+0x1f,0xb3,0x98,0x00,0x05,0x20,0x00,0xdf,0x07,0x00,0x25,0xe0,0x00,0x08,0x00,0x10,
+0x79,0xd8,0x00,0x2e,0x80,0x00,0x01,0x00,0x42,0x39,0xdf,0xfd,0xa4,0xdd,0x05,0x01,
+0x18,0x06,0x11,0xcf,0x90,0x00,0x00,0x04,0x02,0xe0,0xeb,0xbe,0xff,0xff,0x60,0x1f,
+0xff,0xfc,0x10,0x00,0xbf,0xff,0xd0,0x6f,0x33,0x02,0x40,0x3f,0xff,0xf2,0xaf,0x4c,
+0x00,0x42,0x1f,0xff,0xf5,0xcf,0x68,0x00,0x22,0xf6,0xdf,0x08,0x00,0x14,0xf7,0x08,
+0x00,0x12,0xbf,0xee,0x03,0x21,0x00,0x7f,0xfe,0x01,0x90,0x10,0x00,0x2f,0xff,0xfe,
+0x40,0x00,0x03,0xda,0x5f,0x00,0x53,0xfc,0xaa,0xdf,0xff,0xa0,0xa2,0x06,0x34,0xa0,
+0x00,0x09,0x20,0x03,0xd0,0x28,0xce,0xfe,0xc7,0x20,0x00,0x00,0x38,0x86,0x00,0x00,
+0x78,0x82,0xa1,0x02,0x40,0x10,0x02,0xff,0xf3,0x82,0x03,0x20,0xe9,0xaf,0x4c,0x00,
+0x11,0x04,0x75,0x04,0x00,0x72,0x03,0x4f,0xdf,0xfd,0x81,0x00,0x98,0x01,0xb0,0x21,
+0xf6,0x00,0x12,0x05,0x40,0xaf,0xfd,0x30,0x3d,0x70,0x01,0x10,0x2f,0x17,0x00,0x10,
+0x20,0xc3,0x08,0x31,0xff,0xff,0xd3,0x14,0x05,0x4f,0x78,0x74,0x00,0x00,0xa8,0x01,
+0x86,0x00,0xaf,0x07,0x03,0x18,0x08,0x24,0xcf,0xf9,0x03,0x08,0x04,0xcc,0x05,0x12,
+0x10,0x40,0x07,0x2f,0xe6,0x00,0xa8,0x01,0xb0,0x52,0x00,0x02,0xcf,0xc2,0x00,0xc6,
+0x07,0x11,0xfa,0x08,0x00,0x13,0x0c,0x1f,0x08,0x14,0x04,0xd8,0x04,0x2f,0x02,0x00,
+0xa8,0x01,0x88,0x0f,0x70,0x01,0x2f,0x0f,0x68,0x01,0x05,0x04,0x88,0x01,0x0f,0x70,
+0x01,0x3c,0x00,0xa6,0x06,0x22,0xfc,0x30,0xf2,0x0a,0x22,0xc0,0x00,0x90,0x09,0x13,
+0x90,0x79,0x01,0x22,0xfd,0xd0,0x18,0x00,0x03,0x89,0x0a,0x3e,0x6d,0xfe,0xa1,0x68,
+0x01,0x11,0xbf,0xa0,0x00,0x00,0x25,0x00,0x10,0xfb,0x68,0x01,0x3e,0x0f,0xff,0xfd,
+0x68,0x01,0x1f,0x0f,0x68,0x01,0x07,0x39,0xcf,0xff,0xd0,0xda,0x0a,0x10,0x3f,0x40,
+0x00,0x20,0x01,0xc8,0x6f,0x09,0x71,0xf8,0x66,0x9e,0xff,0x60,0x01,0xef,0x28,0x00,
+0x11,0xc0,0xff,0x09,0x00,0xc4,0x01,0x22,0x00,0x6c,0xbe,0x0a,0x00,0x21,0x02,0x11,
+0xc1,0x33,0x00,0x13,0x2f,0x1e,0x0b,0x24,0x6f,0xff,0xf8,0x06,0x22,0xee,0x50,0xc8,
+0x00,0x02,0x96,0x0c,0x70,0x02,0xae,0xfc,0x40,0x00,0x00,0x78,0xe8,0x04,0x10,0x87,
+0x61,0x00,0xa0,0xa0,0x0c,0xff,0xe3,0x00,0x00,0x03,0xef,0xfb,0xcf,0xe0,0x04,0x00,
+0xba,0x0a,0x21,0xd1,0x00,0x0f,0x0c,0x2f,0xfc,0x10,0x40,0x03,0xaf,0x70,0x03,0xff,
+0xfb,0x00,0x0b,0xff,0xf4,0xe8,0x00,0x11,0xb1,0xfe,0x0a,0x14,0x03,0xe6,0x01,0x13,
+0x3e,0x6c,0x0c,0x3f,0x03,0xbb,0xb3,0xe8,0x04,0x8c,0x23,0xdf,0xfa,0x93,0x00,0x14,
+0x2e,0xf6,0x00,0x53,0x03,0xef,0xfa,0xdf,0xfb,0xdd,0x01,0x22,0x80,0x1c,0xa8,0x02,
+0x7f,0x78,0x85,0x00,0x00,0x78,0x84,0x00,0x01,0x00,0x04,0x62,0x01,0x7b,0xef,0xfe,
+0xc8,0x30,0x82,0x00,0x00,0xc9,0x00,0x11,0x20,0xec,0x09,0x12,0xff,0xda,0x0c,0xa1,
+0x9f,0xff,0xff,0xfc,0xce,0xff,0xff,0xfd,0x00,0x03,0x20,0x0a,0x51,0x4d,0xff,0xff,
+0x50,0x0a,0x5c,0x0c,0x00,0xdc,0x0b,0x32,0x0f,0xff,0xfe,0x7e,0x0d,0x23,0xe0,0x4f,
+0xa8,0x0c,0x01,0xbd,0x0b,0x27,0x00,0x00,0xd0,0x00,0x05,0xb2,0x02,0x00,0x9e,0x02,
+0x16,0xf0,0x0a,0x00,0x01,0x1e,0x00,0x01,0x0a,0x00,0x10,0x6f,0xe3,0x0d,0x82,0x56,
+0x66,0xcf,0xff,0xf0,0x3f,0xff,0xf9,0x50,0x00,0x15,0xf0,0x5a,0x00,0x21,0xf0,0x0a,
+0x9b,0x02,0x00,0x0a,0x00,0x10,0x02,0x40,0x0e,0x00,0x28,0x0e,0x10,0xf0,0xa9,0x00,
+0x10,0xfd,0xf3,0x0b,0x12,0xf0,0x14,0x01,0x01,0xb7,0x0d,0x21,0x00,0x6e,0x09,0x00,
+0x01,0xb2,0x01,0x70,0x6a,0xdf,0xfe,0xda,0x62,0x00,0x00,0x60,0x00,0x00,0x03,0xff,
+0xf7,0x00,0x01,0x00,0xfd,0x0f,0x4f,0xff,0xff,0x70,0x00,0x00,0x00,0x05,0xff,0xfa,
+0xff,0xf8,0x00,0x00,0x00,0x6f,0xff,0x70,0x3e,0xff,0x80,0x00,0x01,0x99,0x95,0x00,
+0x02,0x99,0x93,0x00,0x01,0x00,0x70,0x01,0x8d,0xff,0xc7,0x09,0xff,0xf8,0x37,0x00,
+0x61,0xff,0xdd,0xff,0xf8,0x03,0xff,0x01,0x00,0xf1,0x0d,0xf8,0x0d,0xff,0xff,0xfb,
+0xae,0xff,0xff,0xf8,0x4f,0xff,0xfd,0x10,0x00,0x8f,0xff,0xf8,0x9f,0xff,0xf3,0x00,
+0x00,0x0f,0xff,0xf8,0xcf,0xff,0xd0,0x08,0x00,0x31,0xdf,0xff,0xa0,0x08,0x00,0x39,
+0xef,0xff,0x90,0x10,0x00,0x04,0x20,0x00,0x04,0x30,0x00,0x31,0x4f,0xff,0xfc,0x40,
+0x00,0x66,0x0c,0xff,0xff,0xfa,0xad,0xff,0x60,0x00,0x80,0x00,0x4e,0xff,0xff,0xff,
+0xbf,0xff,0xf8,0x80,0x00,0x25,0xc6,0x1f,0xbb,0x00,0xf1,0x03,0xf5,0x00,0x6c,0x20,
+0x00,0x02,0xdf,0xff,0xf1,0x03,0xff,0xfc,0x88,0xaf,0xff,0xff,0x90,0x0a,0x2f,0x00,
+0x40,0xfc,0x00,0x00,0x8f,0x08,0x00,0x80,0xa1,0x00,0x00,0x02,0x7c,0xef,0xec,0x83,
+0x2d,0x00,0x60,0x7f,0xfb,0x00,0x00,0xff,0xf3,0x0a,0x00,0x60,0x5f,0xff,0x10,0x05,
+0xff,0xf1,0x0a,0x00,0x60,0x0e,0xff,0xe9,0xaf,0xff,0xa0,0x0a,0x00,0x30,0x03,0xef,
+0xff,0x7a,0x00,0x00,0x01,0x00,0x4e,0x19,0xdf,0xfc,0x70,0xf8,0x00,0x04,0xff,0x00,
+0x51,0x7b,0xef,0xfe,0xc8,0x30,0x50,0x00,0x00,0x61,0x00,0x52,0xfb,0x20,0x00,0x00,
+0x0a,0xa3,0x00,0xe0,0xe2,0x00,0x00,0x9f,0xff,0xff,0xfc,0xce,0xff,0xff,0xfd,0x00,
+0x03,0xff,0xa2,0x00,0x51,0x4d,0xff,0xff,0x50,0x0a,0x5e,0x01,0x70,0x02,0xff,0xff,
+0xb0,0x0f,0xff,0xfe,0x37,0x00,0x41,0xaf,0xff,0xe0,0x4f,0x69,0x01,0x11,0x00,0x6d,
+0x01,0x13,0xf5,0x0a,0x00,0x33,0x7f,0xff,0xf4,0x0a,0x00,0x10,0x8f,0xa5,0x00,0x56,
+0xef,0xff,0xff,0xff,0xf0,0x0a,0x00,0x01,0x1e,0x00,0x01,0x0a,0x00,0xd2,0x6f,0xff,
+0xf6,0x00,0x00,0x56,0x66,0xcf,0xff,0xf0,0x3f,0xff,0xf9,0x50,0x00,0x15,0xf0,0x5a,
+0x00,0x52,0xf0,0x0a,0xff,0xff,0x80,0x0a,0x00,0xa0,0x02,0xff,0xff,0xf9,0x10,0x00,
+0x04,0xef,0xff,0xf0,0xa9,0x00,0x92,0xfd,0xbc,0xef,0xff,0xff,0xf0,0x00,0x09,0xff,
+0x01,0x00,0x41,0x60,0x00,0x00,0x6e,0x09,0x00,0x10,0xb3,0x38,0x00,0xe0,0x6a,0xdf,
+0xfe,0xda,0x62,0x00,0x00,0x00,0xbf,0xf8,0x00,0x03,0xff,0xf0,0x8b,0x00,0x70,0x40,
+0x2c,0xff,0xc0,0x00,0x00,0x1e,0x22,0x00,0x81,0x40,0x00,0x00,0x02,0xcf,0xff,0xff,
+0xe5,0x24,0x01,0x4f,0x78,0x75,0x00,0x00,0x12,0x02,0xb8,0x31,0x00,0x00,0x9f,0xd8,
+0x00,0x01,0xfe,0x02,0x13,0xff,0x0a,0x00,0x43,0x06,0xff,0xff,0x10,0x0b,0x00,0x24,
+0xdf,0xf9,0xe3,0x00,0x3f,0x02,0x10,0x00,0x12,0x02,0xe1,0x41,0x00,0x01,0xbf,0xd3,
+0x82,0x00,0x31,0x08,0xff,0xfd,0x08,0x00,0x32,0x09,0xff,0xfe,0x10,0x01,0x2e,0xef,
+0xf6,0x19,0x01,0x0f,0x12,0x02,0xb0,0x0f,0xcc,0x01,0xc9,0x08,0x01,0x00,0x2e,0x4f,
+0xff,0x0a,0x00,0x24,0x5f,0xfd,0x0a,0x00,0x24,0x9f,0xf9,0xc8,0x01,0x24,0xff,0xf2,
+0x01,0x03,0x34,0xdf,0x90,0x00,0x2b,0x03,0x0c,0x4d,0x00,0x24,0x09,0xd5,0x4b,0x00,
+0x11,0x30,0x08,0x00,0x13,0xbf,0x49,0x00,0x03,0x08,0x01,0x33,0x02,0xff,0xf6,0x08,
+0x00,0x19,0xf5,0x08,0x00,0x0e,0x4f,0x03,0x0f,0x4e,0x04,0xac,0x53,0x02,0x88,0x60,
+0x00,0x00,0x4c,0x06,0x02,0x2e,0x01,0x52,0x04,0xff,0xff,0xff,0xa0,0x5f,0x04,0x41,
+0xf8,0x1d,0xff,0xb0,0x09,0x00,0x5e,0xf6,0x00,0x1c,0xff,0xb0,0xf9,0x00,0x00,0x9d,
+0x00,0x10,0xfb,0x07,0x00,0x40,0x2f,0xff,0xf8,0xff,0x21,0x00,0x00,0x56,0x02,0x1f,
+0x8f,0x13,0x00,0x31,0x03,0x01,0x00,0x14,0x8f,0x09,0x00,0x08,0x13,0x00,0x6f,0xfe,
+0xbb,0xbb,0xbb,0xbb,0xcf,0x72,0x00,0x3d,0x02,0x13,0x00,0x00,0xac,0x02,0x13,0x03,
+0x13,0x01,0x02,0x14,0x03,0x00,0x66,0x05,0x21,0xff,0x90,0x19,0x03,0xa2,0x72,0xef,
+0xf9,0x00,0x00,0x07,0xff,0xf5,0x00,0x1d,0x21,0x01,0x03,0x30,0x03,0x1f,0xf2,0x08,
+0x00,0x25,0xe3,0x19,0xdf,0xec,0x60,0x00,0x6f,0xff,0xf6,0xff,0xff,0xff,0xfa,0x00,
+0x6f,0x08,0x03,0xe0,0x6f,0xff,0xff,0xea,0xbe,0xff,0xff,0xd0,0x6f,0xff,0xfa,0x00,
+0x00,0xcf,0x5e,0x03,0x11,0xf2,0x2d,0x00,0x01,0x08,0x00,0x3f,0x4f,0xff,0xf3,0x08,
+0x00,0x3d,0x20,0x00,0xbf,0x3f,0x07,0x00,0xcb,0x03,0x32,0xc0,0x00,0x0b,0x51,0x06,
+0x10,0x0e,0x2b,0x02,0x06,0x17,0x00,0x25,0x08,0xff,0x01,0x00,0x26,0xfb,0x8f,0x0c,
+0x00,0xcf,0xb5,0xae,0xff,0xff,0xaa,0xaa,0xaa,0xaa,0xaf,0xff,0xfe,0xa7,0x45,0x00,
+0x0f,0x24,0x00,0x0b,0x38,0x00,0x01,0x17,0x00,0x03,0x01,0x00,0x0c,0x17,0x00,0x10,
+0xfb,0xdb,0x01,0x1f,0xff,0x45,0x00,0x0a,0x0f,0x17,0x00,0x3b,0x12,0x0e,0xb2,0x04,
+0x06,0x09,0x00,0x60,0xad,0xdf,0xff,0xfe,0xdd,0xd1,0x48,0x07,0x00,0x95,0x00,0x18,
+0xf1,0x09,0x00,0x0e,0x2d,0x00,0x00,0x09,0x00,0x40,0x05,0xce,0xfd,0x91,0x09,0x00,
+0x82,0xfa,0xbf,0xff,0xff,0xfe,0x30,0x00,0x0e,0xce,0x00,0x10,0xd0,0x09,0x00,0x50,
+0xfc,0xac,0xff,0xff,0xf4,0x09,0x00,0x51,0x30,0x00,0x6f,0xff,0xf8,0x36,0x00,0x00,
+0x29,0x00,0x02,0x09,0x00,0x3f,0x0d,0xff,0xfb,0x09,0x00,0x48,0x61,0x7e,0xfd,0x72,
+0x05,0xff,0x70,0x10,0x06,0xdc,0xf4,0x0f,0xff,0xde,0xff,0xff,0xfa,0x02,0xdd,0x70,
+0x03,0x9c,0xc7,0xc0,0x03,0x10,0xaf,0x17,0x01,0x00,0x2f,0x06,0x0f,0x0d,0x00,0x72,
+0xfb,0x10,0x8e,0xe7,0x00,0x06,0xff,0x30,0x8f,0xff,0xfc,0x31,0xcf,0xf1,0x1f,0xff,
+0xdf,0xff,0xff,0xfc,0x05,0xff,0x70,0x2d,0xff,0xff,0x30,0x6d,0xd2,0x00,0x07,0xca,
+0x30,0xbc,0x00,0x03,0x86,0x01,0x02,0xb8,0x04,0x0f,0x0d,0x00,0x4d,0x11,0xbf,0x06,
+0x02,0x02,0x06,0x00,0x69,0x69,0x99,0x99,0x99,0x99,0x90,0x8c,0x00,0x02,0xc0,0x00,
+0x0f,0x06,0x00,0x6a,0x01,0x78,0x02,0x01,0xad,0x02,0x20,0xfd,0x89,0xa1,0x00,0x09,
+0x0f,0x0c,0x01,0xca,0x00,0x02,0xd6,0x00,0x0f,0x0b,0x00,0x3e,0xa0,0x58,0x84,0x00,
+0x01,0x88,0x80,0x9f,0xfc,0x00,0x06,0x02,0x08,0x52,0xd9,0xbf,0xff,0x90,0x07,0xd0,
+0x03,0x5f,0x3a,0xef,0xfc,0x60,0x00,0x27,0x01,0x7e,0xf0,0x01,0xf4,0x00,0x07,0xff,
+0xcd,0xff,0x70,0x00,0xaf,0xfa,0x8f,0xfe,0x40,0x6f,0xff,0x41,0x33,0x01,0x31,0xb0,
+0x02,0xcf,0xf5,0x06,0x3f,0x37,0x86,0x20,0x32,0x01,0x51,0x01,0xf5,0x02,0x0f,0x04,
+0x00,0x3d,0xd0,0xef,0xff,0xf0,0x07,0xff,0xd4,0x00,0x3f,0xff,0x10,0x00,0x8f,0xfd,
+0xeb,0x07,0xf6,0x0c,0xde,0x20,0x3f,0xff,0xff,0x50,0x04,0xcf,0xeb,0x30,0x00,0x5e,
+0xfa,0x10,0x2f,0xff,0xf9,0x03,0xff,0xff,0xb0,0x0e,0xff,0xf6,0x00,0x17,0x84,0xbf,
+0x07,0x5f,0xf8,0x00,0xff,0xff,0x80,0x07,0x00,0x21,0xf5,0x15,0x0b,0xff,0xb1,0x08,
+0xff,0xb0,0x00,0xdf,0xf8,0x00,0x0d,0xff,0xfd,0xc0,0x7f,0xff,0xff,0x00,0x7d,0xfe,
+0x90,0x00,0x21,0x00,0x2e,0xff,0x50,0x9f,0xff,0xe0,0x8f,0xff,0xd0,0x1b,0xfd,0x30,
+0x64,0x04,0x0f,0x03,0x00,0x27,0x50,0xff,0xf0,0xaf,0xff,0xf0,0x5f,0xef,0xff,0x9e,
+0xff,0xf9,0x05,0x00,0x12,0x51,0x90,0xaf,0xff,0xf0,0x00,0x01,0x00,0x3f,0x7f,0xff,
+0xf3,0x0c,0x00,0x99,0x80,0xdd,0xdd,0x90,0x00,0x00,0x8f,0xff,0xf2,0x0c,0x00,0x80,
+0xef,0xff,0xd0,0x00,0x00,0xcf,0xff,0xf0,0x0c,0x00,0x80,0xbf,0xff,0xf7,0x00,0x07,
+0xff,0xff,0xc0,0x0c,0x00,0x80,0x4f,0xff,0xff,0xec,0xef,0xff,0xff,0x40,0x0c,0x00,
+0x20,0x0a,0xff,0x01,0x00,0x21,0xf9,0x00,0x48,0x00,0x10,0x9f,0x0c,0x00,0x12,0x70,
+0x0c,0x00,0xfb,0x1e,0x02,0x9c,0xef,0xec,0x82,0x00,0x00,0x05,0xef,0xa1,0x00,0x02,
+0xbf,0xd4,0x02,0xff,0xff,0x90,0x00,0xbf,0xff,0xf0,0x3f,0xff,0xfb,0x00,0x0d,0xff,
+0xff,0x10,0xef,0xff,0x60,0x00,0x8f,0xff,0xc0,0x01,0x78,0x40,0x00,0x00,0x59,0x70,
+0x00,0x01,0x00,0xef,0xff,0xff,0x80,0x00,0x8f,0xff,0xf0,0x0f,0xff,0xf8,0x00,0x08,
+0xff,0xff,0x0f,0x00,0x5e,0x00,0x83,0x00,0x31,0x09,0xff,0xff,0x8b,0x00,0xf1,0x03,
+0xdf,0xff,0xe0,0x00,0x00,0x00,0xba,0xef,0xff,0xfa,0x00,0x00,0x00,0x0f,0xff,0xff,
+0xff,0x30,0xa0,0x00,0x10,0xff,0xb4,0x00,0x42,0x0d,0xff,0xea,0x30,0xb1,0x00,0x32,
+0x08,0xff,0xf3,0xbb,0x00,0x00,0x03,0x01,0x11,0x40,0x09,0x00,0x51,0x0a,0xff,0xe9,
+0xff,0xf4,0x0a,0x00,0xfd,0x00,0xbf,0xfe,0x20,0x5f,0xff,0x50,0x00,0x00,0x00,0x04,
+0x88,0x71,0x00,0x04,0x88,0xee,0x00,0x05,0x01,0x00,0x3f,0x0c,0xff,0xfe,0x0a,0x00,
+0x7b,0xf1,0x03,0x4d,0xdd,0xd5,0x00,0x00,0x0e,0xff,0xfd,0x00,0x00,0x4f,0xff,0xf8,
+0x00,0x00,0x1f,0xff,0xfb,0x04,0x01,0x60,0x30,0x01,0xbf,0xff,0xf6,0x00,0xfb,0x01,
+0x30,0xfd,0xcf,0xff,0x20,0x01,0x21,0x01,0xef,0x06,0x02,0x00,0xf9,0x00,0x10,0x2c,
+0x09,0x00,0x11,0xe4,0x43,0x00,0x42,0x5a,0xdf,0xfe,0xb6,0x4d,0x00,0x31,0x8f,0xfe,
+0x20,0x1b,0x01,0x20,0xfe,0x20,0x06,0x00,0xfb,0x01,0xaf,0xfe,0x20,0x00,0xaf,0xfe,
+0x30,0x8f,0xfe,0x20,0x5b,0xba,0x20,0x00,0x7b,0xb9,0x06,0x01,0x30,0x0a,0xff,0xfd,
+0x07,0x00,0x3f,0xaf,0xff,0xd0,0x0d,0x00,0x52,0x11,0xbf,0x0d,0x00,0x01,0xdb,0x00,
+0x81,0x1b,0xae,0xff,0xff,0x60,0x00,0x02,0xff,0xd4,0x00,0xa1,0x3f,0xff,0xff,0xe3,
+0x00,0x00,0x03,0xef,0xfd,0x81,0xf1,0x01,0x20,0xb0,0x00,0x0b,0x03,0x11,0xfd,0x28,
+0x00,0x00,0xe5,0x01,0x11,0x20,0x13,0x00,0x71,0x6f,0xff,0xff,0x40,0x0f,0xff,0xfb,
+0x2e,0x00,0x11,0x70,0x26,0x00,0x50,0x1e,0xff,0xff,0xa0,0x00,0x13,0x00,0x41,0x0c,
+0xff,0xff,0xc0,0x39,0x00,0x50,0x0a,0xff,0xff,0xe1,0x00,0x13,0x00,0x41,0x06,0xff,
+0xff,0xf3,0x4c,0x00,0x41,0xb3,0xff,0xff,0xf5,0x4e,0x02,0x20,0xfc,0xdf,0x57,0x01,
+0x01,0x50,0x02,0x02,0x62,0x00,0x11,0x0f,0x0a,0x00,0x14,0x60,0x13,0x00,0x21,0xff,
+0x20,0x13,0x00,0x41,0xfc,0xaf,0xff,0xfc,0x13,0x00,0x50,0xfc,0x00,0xef,0xff,0xf7,
+0x13,0x00,0x61,0xfe,0x10,0x04,0xff,0xff,0xf2,0x98,0x00,0x00,0xaa,0x02,0x11,0xd0,
+0x72,0x00,0x00,0x7c,0x00,0x11,0x80,0xab,0x00,0x00,0xa2,0x03,0x10,0x30,0x13,0x00,
+0x00,0xec,0x00,0x11,0xfd,0x13,0x00,0x00,0xa4,0x01,0x12,0xf8,0x13,0x00,0x12,0x05,
+0x88,0x00,0x23,0x38,0x87,0x71,0x01,0x11,0x07,0x02,0x01,0x01,0x04,0x04,0x15,0xfc,
+0x84,0x01,0x13,0x90,0x0a,0x00,0x14,0xef,0xd9,0x02,0x24,0x6f,0xfb,0xa1,0x01,0x2a,
+0x6d,0x10,0xb1,0x01,0x13,0x4f,0xe8,0x02,0x14,0x04,0xfb,0x02,0x0f,0x11,0x00,0x1b,
+0x00,0xb7,0x00,0x40,0x70,0x4f,0xff,0xf4,0x32,0x01,0x10,0x90,0x11,0x00,0x40,0x0a,
+0xff,0xff,0xb0,0x22,0x00,0x40,0x08,0xff,0xff,0xc0,0x22,0x00,0x11,0x45,0x41,0x01,
+0x31,0x4f,0xff,0xf7,0xb8,0x00,0x10,0x04,0x18,0x01,0x10,0xf4,0x44,0x00,0x00,0x09,
+0x00,0x13,0x10,0x11,0x00,0x14,0xfb,0x11,0x00,0x10,0xf6,0x11,0x00,0x00,0x82,0x05,
+0x10,0xf1,0x11,0x00,0x20,0xf9,0x04,0x4c,0x00,0x03,0x55,0x00,0x10,0x60,0x77,0x00,
+0x00,0x6e,0x00,0x11,0x10,0x77,0x00,0x32,0x6f,0xff,0xfb,0x88,0x00,0x30,0xbf,0xff,
+0xf6,0x11,0x00,0x00,0xf9,0x01,0x17,0xf1,0xd7,0x00,0x23,0x0d,0xff,0xaa,0x03,0x22,
+0xdf,0xf6,0x08,0x00,0x13,0x0e,0xbd,0x00,0x14,0x02,0x33,0x05,0x22,0x9f,0xf9,0x08,
+0x00,0x23,0x09,0xfe,0x12,0x01,0x23,0x02,0x30,0xbe,0x04,0x00,0x6e,0x01,0x40,0xfa,
+0x0f,0xff,0xf8,0x80,0x01,0x20,0xfe,0x10,0x11,0x00,0x11,0x5f,0x2a,0x02,0x10,0xf8,
+0x7f,0x00,0x10,0x90,0x22,0x00,0x12,0x0a,0xb6,0x01,0x21,0xf8,0x04,0xd5,0x00,0x33,
+0xff,0xff,0xa4,0xda,0x01,0x23,0xff,0xff,0xec,0x01,0x02,0x50,0x03,0x0a,0x11,0x00,
 0x23,0xf8,0x00,0x33,0x00,0x11,0xf4,0x66,0x00,0x10,0x09,0x19,0x01,0x00,0x55,0x00,
-0x10,0x0d,0xe6,0x00,0x00,0x66,0x00,0x00,0x87,0x02,0x04,0x19,0x76,0x11,0x30,0x45,
-0x0e,0x10,0xdf,0xe6,0x02,0x01,0x78,0x79,0x01,0x46,0x1a,0x01,0x5d,0x76,0x03,0x86,
-0x01,0x11,0xbf,0x77,0x65,0x00,0xa8,0x46,0x0f,0x51,0x0f,0x07,0x1f,0x00,0xc0,0x88,
-0x6e,0x01,0x66,0x0f,0x1e,0xb7,0xb1,0x88,0x02,0xbb,0x18,0x62,0x01,0xcc,0xcc,0x80,
-0x00,0x0a,0xa9,0xa1,0x10,0xe1,0x62,0x99,0x00,0x94,0xa2,0x18,0xf3,0xd7,0x74,0x0f,
-0x05,0x00,0x60,0x0f,0xf4,0x89,0x92,0x06,0xeb,0x01,0x23,0x18,0x88,0x74,0x35,0x18,
-0xf1,0xd5,0x12,0x13,0x06,0x8b,0x1c,0x13,0xcf,0xa4,0x9b,0x03,0x19,0x06,0x18,0x5d,
-0xce,0x25,0x0f,0x06,0x75,0x35,0x01,0x7c,0x4f,0xf4,0x03,0x70,0x06,0xff,0xe0,0x06,
-0xff,0xd0,0x09,0xff,0x90,0x0e,0xff,0x40,0x5f,0xfc,0x00,0x06,0xd2,0xd4,0x00,0x12,
-0x2f,0xcd,0x04,0x31,0x02,0xff,0xf2,0x0f,0x00,0x21,0x3f,0xff,0xe3,0x00,0x11,0x07,
-0x6e,0x4b,0x10,0xb0,0xa2,0x04,0x00,0x0f,0x00,0x32,0x1a,0xfa,0x00,0xb9,0x85,0x0f,
-0x4c,0x01,0x60,0x10,0x0f,0xbc,0x2f,0x15,0xf3,0x06,0x00,0x11,0x02,0x20,0x76,0x40,
-0x06,0xff,0xc0,0x0f,0x2b,0x13,0x61,0x50,0x0f,0xff,0xf8,0x1c,0xfc,0x1a,0x02,0x1e,
-0x51,0x98,0x79,0x0f,0x06,0x00,0x42,0x0f,0xea,0x00,0x25,0x20,0x1b,0xfc,0x3e,0x1f,
-0x01,0x21,0x71,0x00,0x0f,0x00,0x40,0xaf,0xff,0xc0,0x00,0xf9,0x87,0x22,0xef,0xf5,
-0x2d,0x00,0x1f,0x21,0x35,0x01,0x3d,0x0f,0xe7,0x00,0x29,0x40,0x03,0xdf,0xb1,0x0f,
-0xda,0x14,0x20,0xf8,0x0f,0x58,0x54,0x11,0xf9,0x71,0x01,0x10,0xe2,0x1e,0x00,0x1f,
-0x12,0x54,0x00,0x24,0x01,0xee,0x84,0x1f,0x00,0x09,0x00,0x2a,0x13,0x02,0xfe,0x16,
-0x34,0xfb,0xef,0x90,0x14,0x27,0x02,0xb2,0x13,0x03,0x49,0x26,0x23,0x8f,0xff,0x2d,
-0x00,0x2f,0x68,0xaf,0x63,0x00,0x24,0x11,0xfc,0xf2,0x1e,0x04,0x85,0x8d,0x1f,0xf3,
-0x09,0x00,0x02,0x2f,0xf0,0x00,0x05,0x00,0x18,0x20,0xf6,0xb3,0x3b,0x00,0x70,0xf4,
-0x15,0xcf,0xff,0xff,0xe2,0x8f,0x59,0x06,0x10,0x8f,0x0e,0x17,0x1f,0x43,0x46,0x00,
-0x1c,0x14,0xf0,0x8e,0x55,0x14,0xa0,0x06,0x0b,0x14,0xe1,0x0b,0x32,0x14,0xe2,0x4e,
-0x07,0x05,0xfb,0xa7,0x1f,0xf4,0xfe,0x0a,0x03,0x00,0xd6,0x08,0x04,0x05,0x15,0x15,
-0xfa,0xb3,0x5d,0x15,0xf4,0x8a,0x15,0x15,0xe0,0xa0,0x5d,0x15,0x80,0x9d,0x15,0x14,
-0x30,0x13,0x00,0x13,0xfc,0x13,0x00,0x00,0x46,0x07,0x02,0x51,0x15,0x00,0x4a,0x27,
-0x01,0x13,0x00,0x12,0xb1,0x90,0x5d,0x11,0x8f,0x81,0x09,0x12,0x50,0x64,0x15,0x42,
-0x0c,0xff,0xfe,0x12,0x77,0x15,0x32,0x2f,0xff,0xf9,0x77,0x15,0x00,0x93,0x51,0x03,
-0x8a,0x15,0x53,0xdf,0xff,0xef,0xff,0xf8,0x39,0x08,0x03,0x13,0x00,0x15,0x0a,0xb3,
-0x5d,0x15,0x1e,0xa0,0x5d,0x15,0x5f,0xa0,0x5d,0x14,0xbf,0x13,0x00,0x15,0x02,0x13,
-0x00,0x00,0x75,0x87,0x07,0xc7,0x18,0x12,0x01,0x52,0x38,0x00,0xe6,0x33,0x03,0x70,
-0x32,0x1e,0xa0,0x3b,0x42,0x0f,0xc9,0x43,0x7d,0x0f,0x0f,0x8f,0xc1,0x06,0x01,0x00,
-0x25,0x28,0x88,0xbf,0x1c,0x14,0xf0,0x79,0x01,0x15,0xfe,0xbd,0x39,0x14,0xb0,0xc7,
-0x1c,0x14,0xf5,0xe6,0x0a,0x05,0xe2,0x19,0x2f,0x5d,0x30,0x78,0x45,0x84,0x06,0x01,
-0x00,0x10,0x58,0x1f,0xa1,0x05,0xdf,0xa5,0x01,0x9e,0x1e,0x02,0xce,0x0b,0x13,0xf5,
-0xeb,0x07,0x04,0xf1,0xa2,0x12,0x70,0x37,0x1a,0x1a,0x9c,0x20,0x43,0x61,0x88,0x82,
-0x00,0x05,0x88,0x82,0x48,0x01,0x42,0xe2,0x06,0xff,0xf9,0xb9,0x02,0x34,0xe8,0xff,
-0xf7,0x3c,0x13,0x14,0xf6,0x15,0x2f,0x1f,0xf5,0xcb,0x03,0xd6,0x10,0xaf,0xd8,0x79,
-0x11,0xfb,0xd6,0xa3,0x11,0x5f,0x16,0x00,0x13,0xaf,0x44,0x09,0x14,0x0a,0xe2,0x37,
-0x2f,0x8b,0xb8,0xcb,0x03,0x88,0x15,0x08,0x05,0x74,0x25,0x8f,0xfb,0x3c,0x62,0x1c,
-0x90,0xe4,0x02,0x25,0x2f,0xfe,0x13,0x0e,0x14,0x70,0x44,0x43,0x1d,0x90,0xcc,0x00,
-0x02,0xb3,0x9b,0x01,0xdf,0x0e,0x04,0xcf,0x00,0x00,0x13,0x00,0x02,0x9a,0xa6,0x14,
-0x00,0xd2,0x00,0x02,0x1d,0x29,0x01,0x49,0x7a,0x05,0xa1,0x02,0x01,0x13,0x00,0x01,
-0x98,0x3a,0x0f,0x13,0x00,0x41,0x02,0xaf,0x04,0x15,0x03,0xaf,0x04,0x11,0x3f,0x59,
-0x02,0x14,0x30,0x13,0x00,0x15,0xfd,0x13,0x00,0x14,0xf7,0x13,0x00,0x02,0x37,0x4c,
-0x15,0xf8,0x11,0x94,0x10,0x8f,0x51,0x64,0x12,0x50,0x13,0x00,0x32,0xb7,0xff,0xfe,
-0x13,0x00,0x10,0xfb,0x05,0x8c,0x11,0x3f,0x0d,0x02,0x11,0x4f,0x97,0xa2,0x12,0x8f,
-0x1b,0x09,0x02,0x13,0x00,0x42,0x01,0xff,0xff,0x63,0x13,0x00,0x10,0x06,0x90,0x7d,
-0x00,0x33,0x02,0x00,0x22,0x8d,0x03,0x46,0x02,0x15,0x3f,0x6c,0x02,0x15,0x9f,0x6c,
-0x02,0x0f,0xaf,0x04,0x16,0x1c,0xf7,0xda,0x5c,0x13,0x8f,0x70,0x03,0x23,0x8c,0xdf,
-0x67,0x21,0x13,0x0b,0x61,0x08,0x01,0x2b,0x26,0x04,0x2c,0x44,0x20,0xeb,0x50,0xaa,
-0x01,0x12,0x07,0x76,0x02,0x22,0xf1,0xdf,0x76,0x02,0x11,0xfd,0xe0,0x2e,0x13,0x5f,
-0x24,0x40,0x01,0x9c,0x3b,0x13,0xbf,0x5f,0x58,0x10,0x5f,0xd2,0x02,0x11,0xf3,0x82,
-0x57,0x12,0x5f,0xc0,0x05,0x0f,0x08,0x00,0x36,0x03,0x03,0x08,0x17,0xf5,0x09,0x74,
-0x13,0x07,0x3b,0x3f,0x13,0x0b,0x44,0x13,0x00,0x4b,0x1e,0x04,0xb8,0x00,0x00,0x02,
-0x27,0x10,0x99,0xee,0xaa,0x14,0x00,0xfa,0x30,0x1a,0xf7,0x0a,0x00,0x0e,0x01,0x00,
-0x0f,0x53,0x60,0xd4,0x13,0x5f,0xdb,0x10,0x05,0x10,0x74,0x1e,0x39,0xab,0x2f,0x0f,
-0x22,0x48,0x85,0x62,0x28,0x87,0x00,0x00,0x68,0x83,0x1a,0x01,0x10,0x20,0xfb,0xa1,
-0x01,0x0e,0x0a,0x45,0xe9,0x9e,0xff,0xe0,0x28,0xb0,0x12,0x40,0x88,0x0e,0x3f,0xdf,
-0xfd,0x91,0xdd,0x01,0xe2,0x12,0xfe,0x99,0x07,0x76,0x02,0xff,0xf8,0x11,0x8f,0xff,
-0x20,0x00,0x2a,0x01,0x09,0x00,0x02,0x47,0x7c,0x3f,0x68,0x86,0x10,0x2f,0x4d,0x95,
-0x53,0xaa,0xa9,0x00,0x9a,0xa9,0xea,0x0b,0x14,0x09,0x36,0x01,0x22,0x70,0x5f,0x66,
-0x12,0x52,0xcf,0xfb,0x02,0xff,0xf8,0x5f,0x10,0x14,0xe1,0xe5,0x2c,0x0f,0x36,0x65,
-0xdc,0x62,0x03,0xff,0xfb,0x02,0xff,0xfc,0x7b,0x68,0x21,0xdf,0xfd,0xbf,0x81,0x40,
-0x30,0xaf,0xfe,0x20,0x78,0x00,0x20,0x60,0x6f,0xaf,0x06,0x6f,0x05,0xaa,0x80,0x09,
-0xaa,0x40,0x51,0x4e,0x93,0x35,0x7b,0xef,0xff,0x17,0xb6,0x06,0xea,0x74,0x01,0xa2,
-0x15,0x17,0x1d,0x0e,0x00,0x01,0x4e,0x00,0x42,0xfc,0xa9,0x9a,0xff,0x5a,0x21,0x21,
-0xb3,0x07,0x48,0x00,0x14,0x0f,0xe6,0x47,0x02,0xb4,0x96,0x04,0x6d,0x7f,0x02,0x30,
-0xa7,0x04,0x1d,0x00,0x02,0x8b,0x82,0x05,0x1d,0x00,0x01,0x6c,0x0e,0x00,0x61,0x0a,
-0x00,0xf3,0x21,0x13,0x70,0xfd,0x3b,0x04,0xba,0x21,0x13,0x8f,0x1d,0x00,0x02,0xd4,
-0x21,0x0e,0x1d,0x00,0x07,0x57,0x00,0x14,0x07,0x1d,0x00,0x17,0xc0,0x0e,0x23,0x04,
-0x1d,0x00,0x14,0x03,0x84,0x17,0x14,0xc0,0xe6,0x5e,0x07,0x1d,0x00,0x00,0xe0,0x0f,
-0x16,0x10,0x1d,0x00,0x00,0x32,0x0a,0x32,0xc9,0x99,0xaf,0xa8,0x14,0x23,0xbb,0x30,
-0x03,0x74,0x05,0x25,0x75,0x17,0x8f,0x0f,0x00,0x11,0x50,0xb7,0x3a,0x07,0x1d,0x00,
-0x11,0x29,0x22,0x19,0x44,0x6b,0xef,0xec,0x70,0x70,0x36,0x22,0x32,0xdf,0x01,0x66,
-0x03,0x25,0x11,0x02,0x0b,0x75,0x10,0x6f,0x33,0x52,0x00,0x1e,0x00,0x41,0xac,0xff,
-0xff,0xc0,0x90,0xab,0x10,0x8f,0x69,0x02,0x11,0x07,0x1a,0x88,0x20,0x50,0x00,0x16,
-0xb0,0x00,0xa5,0x00,0x11,0xf7,0xe2,0x00,0x13,0x08,0x3b,0x2e,0x36,0x99,0xff,0xfe,
-0x40,0x38,0x24,0xfa,0xbf,0x50,0x34,0x02,0xa0,0x59,0x17,0xfd,0x1b,0x00,0x04,0x36,
-0x00,0x16,0x90,0x1b,0x91,0x12,0xdf,0x79,0x3b,0x00,0xf9,0x00,0x00,0xde,0x02,0x00,
-0xf0,0x00,0x20,0x01,0x72,0x09,0x00,0x11,0xa9,0xde,0x00,0x21,0xb9,0xac,0xcd,0x1b,
-0x06,0x42,0x59,0x11,0x10,0xdf,0x08,0x33,0xfe,0x32,0xdf,0xf8,0x98,0x02,0xd8,0x00,
-0x21,0x5a,0xef,0xaf,0x65,0x07,0x18,0x10,0x05,0xaf,0x6c,0x05,0x17,0x10,0x04,0x08,
-0x75,0x0f,0x16,0x10,0x06,0x0f,0x1c,0x9a,0xb5,0x00,0x44,0x83,0x04,0x74,0x1a,0x11,
-0x4f,0xee,0x30,0x01,0x79,0xa9,0x2b,0x06,0xcc,0x22,0x69,0x01,0xb3,0x86,0x11,0x40,
-0xed,0x18,0x23,0x40,0x4f,0xbd,0x87,0x00,0xc6,0x0a,0x01,0xb5,0x86,0x45,0x10,0x4f,
-0xff,0xfa,0x3e,0x19,0x0f,0x06,0x00,0x29,0x0f,0x56,0x01,0xb5,0x06,0x01,0x00,0x24,
-0x88,0x82,0x76,0x29,0x1b,0xf3,0x7f,0x29,0x01,0xa7,0xaa,0x09,0xf1,0x0c,0x24,0x1f,
-0xff,0x2a,0xab,0x0b,0x0f,0x5b,0x0f,0x30,0x88,0x4d,0x01,0x5c,0x0f,0x10,0x60,0x0c,
-0x0b,0x11,0xfb,0x90,0x00,0x01,0x93,0x99,0x11,0xf7,0x92,0x00,0x13,0x10,0x9b,0x83,
-0x3e,0x00,0x08,0xd1,0x88,0x0f,0x00,0x43,0x1e,0x02,0x44,0x4f,0x06,0x87,0x0f,0x13,
-0xaf,0x64,0x4f,0x0e,0x86,0x0f,0x0f,0x3b,0x03,0xbb,0x10,0x4f,0x4c,0x63,0x00,0x00,
-0x03,0x41,0xa1,0xcf,0xff,0x30,0x23,0x6a,0x01,0x76,0x84,0x01,0x52,0x1e,0x4e,0x4b,
-0xbb,0x20,0x00,0x3f,0x03,0x01,0x82,0x89,0x11,0x7f,0x4c,0x53,0x03,0x8f,0x89,0x00,
-0x9a,0x00,0x02,0x41,0x03,0x03,0x08,0x9b,0x14,0x4f,0x6d,0x6b,0x1f,0x40,0x0d,0x00,
-0x2a,0x02,0xfd,0x45,0x23,0xcc,0x70,0x32,0x1f,0x1a,0xfc,0xe6,0xb7,0x14,0x02,0xee,
-0x04,0x14,0x0b,0xee,0x04,0x0e,0x8e,0x42,0x0f,0x32,0x9e,0xb0,0x02,0xba,0x2a,0x13,
-0xfa,0x87,0x0e,0x12,0xb0,0x7e,0x00,0x13,0xfc,0x17,0x00,0x12,0xd1,0xb1,0x0e,0x1e,
-0xcc,0xbe,0x0a,0x0f,0x3f,0x8b,0x77,0x00,0xa1,0x01,0x14,0xd1,0x5a,0x7b,0x22,0xfd,
-0x20,0x4b,0x44,0x32,0xda,0xff,0xe2,0x12,0x71,0x20,0x00,0x9f,0x6b,0x02,0x7f,0x05,
-0x88,0x70,0x00,0x05,0x88,0x60,0xc5,0x01,0xc9,0x12,0x9f,0x32,0x44,0x13,0x09,0x72,
-0x42,0x51,0xaf,0xfe,0xaf,0xfe,0x30,0xbc,0x02,0x10,0x08,0x91,0x08,0x6f,0x59,0x99,
-0x10,0x00,0x69,0x98,0xc5,0x01,0x88,0x0f,0x86,0x01,0xab,0x23,0xaf,0xff,0x8e,0xb8,
-0x14,0x0b,0x68,0x4b,0x15,0x07,0xd1,0x75,0x14,0x0d,0xb3,0xb7,0x34,0xbf,0xff,0xe0,
-0xa5,0x00,0x12,0x50,0x1c,0x0b,0x2f,0xfd,0x93,0x84,0x01,0x3b,0x13,0xdf,0x84,0x01,
-0xb0,0x01,0x5a,0xff,0xff,0xf0,0x08,0x88,0x81,0x00,0x00,0x6f,0x84,0x01,0x14,0xf7,
-0x84,0x01,0x2f,0x83,0x24,0x84,0x01,0x03,0x02,0x13,0xb4,0x04,0xe9,0x23,0x05,0x99,
-0xa0,0x00,0xf9,0x00,0x13,0x10,0x11,0x00,0x21,0x20,0x00,0x8c,0x5d,0x19,0xfe,0x8e,
-0xb6,0x30,0x4f,0xd9,0x20,0xd0,0x00,0x71,0xaa,0xa2,0x00,0x09,0xaa,0xa1,0x00,0xc0,
-0x1f,0x00,0x89,0x6c,0x00,0x77,0x38,0x34,0xec,0xff,0xf6,0x18,0x46,0x18,0x70,0x07,
-0x2f,0x00,0x44,0x51,0x1e,0x70,0x81,0x03,0x15,0x83,0xfb,0x01,0x14,0xb2,0xfb,0x01,
-0x21,0xfe,0x20,0xfb,0x01,0x21,0xdf,0xff,0x7e,0xb5,0x10,0x60,0x8d,0x00,0x23,0xf4,
-0x2f,0x41,0x09,0x24,0xf7,0x2f,0x4e,0x00,0x0f,0xfb,0x01,0x2c,0x32,0x45,0x55,0x40,
-0xfb,0x01,0x14,0xdf,0xfb,0x01,0x13,0xaf,0xcb,0x42,0x24,0xf7,0x5f,0xfb,0x01,0x15,
-0x0b,0xfb,0x01,0x1a,0xcf,0x2b,0x0d,0x00,0xfb,0x01,0x12,0x15,0x81,0x03,0x00,0x3b,
-0x38,0x30,0x01,0xdf,0xfe,0x32,0x15,0x21,0xf8,0x2d,0x82,0x03,0x13,0x6f,0x08,0x47,
-0x14,0x06,0x4d,0x50,0x2f,0x5b,0xba,0x46,0x05,0x88,0x0f,0x38,0xa4,0xc9,0x01,0x4d,
-0x09,0x23,0xfa,0x20,0xf0,0x07,0x16,0x9d,0xfb,0x07,0x05,0x46,0x21,0x15,0x7d,0x6f,
-0x6c,0x15,0xcf,0xec,0x07,0x12,0xbf,0x15,0x76,0x0f,0x66,0x91,0x07,0x07,0x9d,0x91,
-0x02,0x0b,0x00,0x5f,0x34,0x8f,0xff,0xf5,0x44,0x9d,0x91,0x15,0x01,0x0b,0x00,0x01,
-0x84,0x48,0x00,0x66,0x16,0x20,0xbb,0x20,0x58,0x16,0x11,0xf3,0x21,0x14,0x10,0x30,
-0xe5,0x04,0x10,0xc2,0x59,0x09,0x10,0xb3,0x61,0x48,0x01,0xaf,0x00,0x10,0x3f,0x4d,
-0x04,0x10,0x8e,0xcc,0x01,0x11,0x0d,0x96,0x08,0x31,0xce,0xc7,0x10,0x90,0x3d,0x10,
-0x01,0x94,0x3d,0x01,0x85,0x9d,0x01,0x77,0x48,0x01,0x90,0x82,0x24,0xdf,0xfd,0xa5,
-0x0d,0x03,0x16,0xb5,0x00,0xa9,0x3d,0x0f,0xa9,0x11,0x05,0x0f,0xf8,0x01,0xcd,0x13,
-0x00,0xee,0x01,0x22,0xff,0xf3,0xf2,0x01,0x12,0xf1,0x32,0x1c,0x12,0xc0,0xf2,0x09,
-0x10,0x60,0x87,0x01,0x22,0x1c,0xfd,0x8e,0x01,0x15,0x52,0x55,0x33,0x02,0x07,0x00,
-0x01,0xda,0x01,0x0c,0x07,0x00,0x02,0xe4,0x01,0x0b,0x2a,0x00,0x0f,0x07,0x00,0x18,
-0x03,0x3a,0x05,0x02,0xf3,0x01,0x03,0x97,0x93,0x03,0xf6,0x01,0x02,0x9a,0x93,0x0f,
-0x92,0x01,0x40,0x06,0x7a,0x32,0x06,0x0a,0x00,0x6f,0xbd,0xde,0xff,0xff,0xdd,0xd0,
-0x92,0x01,0x5e,0x02,0xfc,0x02,0x0d,0x06,0x00,0x02,0x40,0x03,0x08,0x06,0x00,0x03,
-0xef,0x94,0x07,0x24,0x00,0x11,0x7f,0xb1,0x04,0x02,0x06,0x00,0x10,0x6d,0xbe,0x00,
-0x1e,0xd6,0x4e,0x00,0x01,0x49,0x92,0x00,0xe5,0x0b,0x00,0xf4,0x94,0x15,0x00,0x2c,
-0x77,0x11,0xf3,0xe0,0xc6,0x92,0xc2,0x00,0x00,0x04,0xbb,0x50,0x00,0x4c,0xc4,0x44,
-0x29,0x10,0xc3,0xdf,0x76,0x03,0xfa,0x70,0x01,0xfb,0x05,0x22,0xfa,0x04,0x2c,0xa3,
-0x6f,0x05,0xdd,0x30,0x00,0x8c,0xb4,0x5b,0x75,0xd5,0x00,0x7d,0xc4,0x21,0x0d,0xfc,
-0x4d,0x1d,0x20,0x71,0x4f,0xb0,0xb9,0x00,0x9c,0x15,0x00,0x47,0x6e,0x21,0xe1,0x07,
-0xc4,0x0d,0x5f,0xcd,0x90,0x00,0x3a,0xc8,0xf6,0x5d,0x89,0x14,0x89,0x1e,0x48,0x14,
-0x0e,0x58,0x80,0x2a,0x00,0xef,0x87,0x89,0x0f,0x07,0x75,0xd4,0x13,0x6f,0x96,0x14,
-0x04,0x08,0x00,0x0e,0x64,0x1a,0x0f,0xba,0x01,0x7c,0x23,0x78,0x82,0x24,0x39,0x53,
-0x0c,0xff,0x90,0x00,0xaf,0x3c,0xc2,0x22,0xb9,0xcf,0xc5,0x08,0x15,0xaf,0x7b,0x57,
-0x10,0x5b,0xb0,0xbc,0x0f,0x8e,0x03,0xd4,0x10,0x6f,0x71,0x11,0x01,0x7b,0x44,0x43,
-0x71,0x19,0xff,0xf1,0x16,0x0a,0x12,0x90,0x0f,0x01,0x11,0xf8,0xaf,0x03,0x0e,0x4a,
-0x1a,0x0f,0x14,0x60,0x7c,0x16,0x01,0x5c,0x8e,0x04,0xf8,0x1e,0x32,0xb6,0xbf,0x70,
-0xac,0x0b,0x23,0xe0,0x00,0xa2,0x20,0x10,0xed,0x0c,0x00,0x01,0xaf,0x0e,0x48,0xf8,
-0x28,0xf9,0x00,0xad,0x48,0x00,0xe4,0x00,0x1f,0x42,0xe4,0x7b,0xd1,0x02,0xdc,0x00,
-0x12,0xcf,0xd4,0x90,0x41,0x1f,0xe6,0x7f,0xe0,0x34,0x01,0x31,0x60,0x08,0xf5,0x08,
-0x00,0x31,0x50,0x06,0xf5,0x82,0x11,0x23,0xd3,0x4e,0xb2,0x08,0x22,0xfe,0x40,0x31,
-0x00,0x1f,0x30,0xf7,0x01,0x83,0x52,0x06,0xaa,0xa3,0x05,0xaa,0xc2,0xc1,0x10,0xfb,
-0x41,0x47,0x01,0x0b,0x3f,0x32,0x10,0xdf,0xfc,0xf4,0x08,0x12,0x30,0x93,0xc0,0x34,
-0x1e,0xff,0x60,0xd8,0x54,0x0f,0xa0,0x7b,0xd0,0x10,0x03,0x8d,0x1b,0x11,0xfc,0x9d,
-0xc1,0x40,0x01,0xef,0xfd,0x10,0x59,0x00,0x40,0x20,0xbf,0xfe,0x10,0x57,0x13,0x21,
-0x50,0x7f,0x3d,0x18,0x5e,0xaa,0x70,0x19,0xaa,0x30,0x0d,0x01,0x14,0x06,0x1b,0x23,
-0x04,0x98,0x01,0x0f,0x11,0x00,0x31,0x05,0x70,0x23,0x04,0xdd,0x01,0x13,0x03,0x0b,
-0xd1,0x14,0x30,0xde,0x01,0x04,0xe4,0x9a,0x15,0x30,0xdf,0x01,0x8f,0x00,0x7c,0xff,
-0xea,0x40,0xff,0xff,0x30,0x2c,0x07,0x8d,0x1e,0xff,0x2c,0x07,0x14,0xe2,0x2c,0x07,
-0x14,0xf3,0x2c,0x07,0x12,0xc2,0x2c,0x07,0x05,0x8e,0x23,0x07,0x24,0x33,0x15,0xf7,
-0x33,0x32,0x16,0xfc,0x1a,0xd1,0x04,0x1b,0x0e,0x2f,0xfe,0x90,0x69,0x03,0x6c,0x12,
-0x9f,0x69,0x03,0x10,0xa3,0x57,0x5e,0x02,0x84,0x1f,0x12,0x20,0xc0,0x00,0x13,0xa0,
-0xad,0x27,0x23,0x60,0x00,0x4c,0x74,0x03,0x6f,0x76,0x03,0xfb,0x08,0x23,0x8d,0xfd,
-0x34,0x51,0x28,0x38,0x85,0x74,0x56,0x05,0x01,0x01,0x08,0x33,0x9d,0x03,0x42,0x11,
-0x25,0xf5,0x3e,0x9c,0x81,0x00,0x00,0xd0,0x3f,0x02,0xef,0xf9,0xb4,0x23,0x0d,0x0f,
-0xdc,0xb1,0xff,0x22,0x02,0x93,0x0f,0x17,0xf8,0x44,0x01,0x07,0x97,0x9a,0x12,0xf8,
-0xd7,0x5c,0x02,0x77,0x74,0x04,0x2e,0x43,0x7f,0x01,0x66,0x63,0x00,0x00,0x66,0x63,
-0x88,0x01,0x08,0x0f,0xc1,0xa0,0xb9,0x00,0x01,0x00,0x26,0x47,0x73,0x0d,0x05,0x15,
-0x30,0x94,0x03,0x14,0xf3,0xa8,0x02,0x14,0x8f,0x70,0xc7,0x13,0x50,0x08,0x5d,0x6f,
-0x44,0x42,0x00,0x00,0x34,0x43,0xd1,0x7f,0xd5,0x02,0x5e,0x07,0x03,0x01,0xd7,0x22,
-0xfe,0x20,0x0b,0x70,0x01,0x01,0x18,0x00,0x0b,0x70,0x01,0xa8,0x8f,0x6f,0x56,0x65,
-0x00,0x00,0x46,0x65,0x7c,0x69,0xc3,0x15,0x00,0x9c,0x92,0x06,0x26,0x6b,0x06,0xa0,
-0x92,0x0e,0xa2,0x92,0x0f,0x17,0x02,0xd8,0x06,0xf9,0x9e,0x05,0xf7,0x9e,0x02,0xa1,
-0x01,0x07,0xf3,0x9e,0x3e,0x1e,0xff,0xc0,0x1b,0x01,0x0f,0xbc,0xb4,0xb6,0x13,0x00,
-0x3f,0x5a,0x01,0x40,0x00,0x03,0xc8,0x33,0x03,0xc8,0xcb,0x11,0xc0,0x4d,0x00,0x2d,
-0xcc,0xb1,0xfa,0x00,0x0a,0xd7,0xa3,0x04,0xe6,0xa3,0x52,0xe0,0x59,0x99,0x99,0x9a,
-0xfb,0x51,0x00,0x36,0x49,0x09,0xc2,0xa3,0x1e,0xfe,0xc2,0xa3,0x06,0xfb,0xa3,0x1f,
-0xf2,0xfb,0xa3,0x01,0x6a,0xff,0xa9,0x99,0x99,0x99,0x1d,0x59,0x01,0x15,0x3d,0xa4,
-0x08,0x01,0x9e,0x35,0x03,0x07,0x61,0x14,0x80,0x9c,0x07,0x14,0xf0,0x20,0x06,0x13,
-0xf0,0xb3,0x08,0x2f,0xfe,0x50,0xb9,0x01,0xca,0x33,0x05,0xef,0x90,0xfa,0x20,0x18,
-0x50,0x43,0xd1,0x04,0xa6,0x66,0x2f,0x12,0x00,0xb9,0x01,0x7f,0x70,0x07,0x88,0x60,
-0x00,0x17,0x88,0x60,0x45,0x00,0x11,0xf8,0x00,0x1a,0x00,0x32,0x00,0x12,0x9d,0xf2,
-0x19,0x15,0x03,0x56,0x51,0x3f,0x3e,0xff,0xb0,0xb9,0x01,0xc8,0x00,0x38,0xdb,0x30,
-0x2e,0xff,0xd1,0x92,0x8a,0x10,0x3e,0x73,0x18,0x13,0x06,0x0e,0x3f,0x04,0xd1,0xdd,
-0x3f,0x04,0x77,0x60,0xb9,0x01,0x7f,0x10,0x03,0xa3,0xb3,0x21,0x7f,0xff,0x3c,0x3e,
-0x01,0x62,0x62,0x21,0xda,0xb2,0xf8,0x38,0x01,0xf9,0x06,0x01,0xfc,0x2e,0x0f,0x05,
-0x00,0x42,0x09,0x01,0x00,0x1f,0xf1,0xcf,0x09,0x06,0x04,0x92,0x0c,0x08,0x79,0x22,
-0x72,0xf4,0xf1,0x00,0xfb,0xe9,0x00,0xe9,0x08,0xdb,0x0f,0x4e,0x62,0x01,0x3f,0x0a,
-0x00,0x06,0x18,0x00,0x01,0x2f,0xb9,0x00,0x01,0x00,0x17,0x1f,0xc2,0x20,0x00,0x0c,
-0x03,0x90,0x00,0xb2,0xec,0x00,0xfb,0x00,0x00,0xe2,0xfc,0xed,0xf6,0x00,0xdb,0x9b,
-0x00,0x8e,0xfd,0x00,0x00,0xfc,0xfd,0xf4,0xf8,0x00,0x9a,0x00,0x6f,0xf9,0x00,0xfa,
-0x00,0x00,0xf2,0x4e,0x00,0x03,0x06,0xc5,0x3c,0x03,0x22,0x07,0x0a,0x9e,0x89,0x18,
-0xfc,0x76,0x00,0x00,0xe6,0x02,0x7b,0xeb,0x00,0xfb,0x00,0xfb,0xf5,0xfa,0x46,0x00,
-0x0a,0x17,0x36,0x07,0xa4,0x4f,0x21,0xfb,0xfc,0x36,0x00,0x28,0xfc,0xfa,0xfe,0x1a,
-0x75,0xbc,0x00,0x00,0x00,0xd0,0x00,0xcc,0x26,0x00,0x62,0xf8,0xfb,0x00,0x00,0xfb,
-0xfa,0x04,0x00,0x0e,0x48,0x00,0x10,0xf9,0x66,0x02,0x0f,0x05,0x0d,0x0a,0x1f,0xfb,
-0x55,0x01,0x0f,0x1b,0xd7,0xa5,0x00,0x12,0xfa,0x58,0x00,0x24,0xfa,0xf6,0xb8,0x36,
-0x14,0xb8,0x72,0x00,0x96,0xf0,0x00,0x00,0xcd,0xfa,0xcd,0xe9,0x00,0xba,0x2d,0x00,
-0x28,0xfd,0xe1,0x19,0x36,0x62,0x9b,0x00,0x00,0x00,0xd4,0x00,0xdf,0xd0,0x61,0xf3,
-0x00,0xf7,0x00,0xfd,0xfd,0x35,0x01,0x30,0x04,0x00,0x04,0x12,0x00,0x1d,0xb6,0x1a,
-0x01,0x3f,0xf9,0xfb,0x00,0x7a,0x31,0x0e,0x10,0xf4,0xc4,0x00,0x0e,0xbf,0x29,0x03,
-0x9f,0x02,0xb1,0xc0,0xbc,0x00,0x00,0xe2,0xf9,0xca,0xfc,0x04,0x00,0x04,0x66,0x00,
-0xf1,0x02,0xd6,0xea,0x00,0xea,0xcc,0xf0,0xed,0x00,0xf0,0xec,0xf4,0xed,0xf1,0x00,
-0xd1,0xeb,0xe8,0x2a,0x01,0x66,0xca,0xd9,0x00,0x00,0xed,0xfd,0xfa,0x26,0xa6,0xf5,
-0xf5,0x00,0x00,0xf5,0xf9,0x00,0x00,0xf9,0xfd,0x91,0x01,0x71,0x04,0x00,0xdc,0xf1,
-0x00,0x00,0xf5,0x0a,0x00,0x02,0x99,0x04,0x23,0xf8,0xf8,0x80,0x01,0x02,0x1f,0x00,
-0x04,0x01,0x00,0x14,0xd9,0x1b,0x02,0x15,0x04,0x30,0x01,0x10,0xfb,0x6a,0x01,0x16,
-0xf8,0x2f,0x02,0xf6,0x14,0x05,0xf4,0xc6,0xda,0x00,0x00,0xdb,0xf9,0xe8,0xfc,0x04,
-0xe8,0x05,0x04,0x03,0x05,0x00,0x05,0xf0,0xf0,0xfb,0xf6,0xf0,0xf6,0xf2,0xfb,0xf6,
-0xfb,0x00,0xfa,0xf9,0x05,0xe8,0xf0,0xf0,0x5c,0x12,0x1a,0xfa,0xaf,0x01,0x01,0x4c,
-0x00,0x1e,0xf9,0xd5,0x01,0x17,0xfc,0x72,0x02,0x0e,0x1c,0x00,0x0e,0x01,0x00,0x0e,
-0x1d,0x00,0x0f,0x29,0x02,0x0a,0x4e,0xfd,0x00,0xfc,0xfc,0xe5,0x02,0x0f,0x2f,0x00,
-0x08,0x0f,0x1d,0x00,0x11,0x3e,0x04,0x00,0x05,0xb7,0x02,0x1c,0xfa,0x0d,0x03,0x2f,
-0xec,0x00,0x01,0x00,0x26,0x0d,0xdf,0x02,0x1f,0xea,0x0a,0x01,0x0a,0x00,0x74,0x03,
-0x04,0xba,0x01,0x1c,0xd5,0x0a,0x04,0x20,0xfb,0x05,0x8d,0x02,0x4f,0x0d,0x00,0x05,
-0x04,0x75,0x00,0x0c,0x0a,0x48,0x01,0x00,0x2e,0x00,0x1c,0xd6,0x69,0x00,0x3e,0xfd,
-0x03,0x00,0x94,0x01,0x1f,0xe1,0xe4,0x00,0x26,0x0e,0x4b,0x91,0x0f,0x1f,0x02,0x19,
-0x1f,0xfb,0x07,0x04,0x08,0x12,0x01,0x6d,0x5f,0x31,0x02,0x03,0x00,0xa7,0x03,0x1e,
-0x05,0xee,0x13,0xf2,0x0b,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,
-0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x38,
-0x9b,0xf1,0x0b,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,
-0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x3f,0x00,0x01,
-0x01,0x00,0xd0,0x00,0x08,0x0a,0x0a,0x0a,0x0a,0x0c,0x0c,0x0c,0x0c,0x09,0x0c,0x09,
-0x01,0x00,0xa1,0x00,0x00,0x0d,0x0d,0x0d,0x0d,0x17,0x00,0x00,0x1a,0x01,0x00,0x62,
-0x00,0x1c,0x1d,0x1d,0x1d,0x1d,0x3e,0x2b,0x10,0x21,0x01,0x00,0x02,0x7c,0x00,0x50,
-0x24,0x1b,0x24,0x06,0x1a,0x02,0x00,0x22,0x08,0x1c,0x02,0x00,0x64,0x09,0x00,0x09,
-0x00,0x0a,0x1d,0x02,0x00,0x05,0x34,0x0e,0x00,0xf7,0xec,0x05,0x02,0x00,0x00,0xc3,
-0x01,0x43,0x0e,0x00,0x00,0x0f,0x02,0x00,0x00,0x1f,0x00,0x00,0x02,0x00,0x80,0x1f,
-0x00,0x00,0x09,0x21,0x09,0x21,0x09,0x5b,0x00,0x11,0x22,0x02,0x00,0x03,0x01,0x00,
-0x11,0x13,0x02,0x00,0x17,0x0d,0x02,0x00,0x70,0x15,0x00,0x17,0x24,0x17,0x18,0x27,
-0x02,0x00,0x04,0x21,0x01,0x20,0x03,0x02,0x1c,0x01,0x4c,0x06,0x07,0x06,0x08,0x29,
-0x08,0x40,0x00,0x0a,0x00,0x0b,0x1f,0x18,0x00,0x83,0x00,0x01,0x08,0x00,0xa2,0x0b,
-0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x0f,0xe2,0x72,0x16,0x00,0x17,0x17,
-0x17,0x18,0x17,0xbf,0x5a,0xf1,0x04,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,
-0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x00,0x00,0x0a,0x01,0x00,0x26,0x24,0x0b,0x53,
-0x00,0x10,0x0b,0x01,0x00,0xa1,0x00,0x0b,0x0f,0x0f,0x0f,0x0f,0x13,0x00,0x00,0x16,
-0x01,0x00,0x20,0x25,0x17,0x01,0x00,0x02,0x44,0x00,0x02,0x32,0x01,0xa0,0x26,0x1e,
-0x1e,0x1e,0x1e,0x1f,0x00,0x1f,0x0a,0x16,0x02,0x00,0x22,0x0b,0x17,0x02,0x00,0x20,
-0x00,0x17,0xb1,0x24,0x04,0x02,0x00,0x05,0x16,0x00,0x0c,0x65,0x0f,0x0b,0x10,0x00,
-0x10,0x19,0x02,0x00,0x51,0x19,0x00,0x00,0x0b,0x1a,0x02,0x00,0x13,0x17,0x6f,0x14,
-0x12,0x1c,0x02,0x00,0x30,0x0e,0x00,0x0e,0x3e,0x12,0x16,0x1e,0x02,0x00,0xc0,0x11,
-0x00,0x13,0x1f,0x13,0x14,0x22,0x14,0x22,0x14,0x22,0x00,
+0x10,0x0d,0xe6,0x00,0x00,0x66,0x00,0x00,0x87,0x02,0x01,0x77,0x00,0x40,0x8f,0xff,
+0xff,0x30,0x11,0x00,0x20,0x00,0xdf,0xe6,0x02,0x32,0x0a,0xcc,0xcb,0xe9,0x01,0x21,
+0xff,0x20,0xc0,0x00,0x02,0xc9,0x00,0x10,0xbf,0x95,0x04,0x00,0xc4,0x02,0x1e,0x60,
+0x8c,0x04,0x02,0x51,0x02,0x05,0xfa,0x02,0x0f,0x0f,0x00,0x68,0x72,0xfe,0xbb,0xbb,
+0xbb,0xbb,0xb7,0xff,0x01,0x00,0x12,0xaf,0x07,0x00,0x13,0xfa,0x0f,0x00,0x60,0xa0,
+0x00,0x01,0xcc,0xcc,0x80,0xca,0x03,0xc5,0x10,0x00,0x5f,0xff,0xe1,0x00,0x01,0xef,
+0xfe,0x20,0x00,0x09,0x8c,0x05,0x01,0x0a,0x01,0x0f,0x05,0x00,0x60,0x0f,0x34,0x01,
+0x6e,0x04,0x0f,0x00,0x10,0xeb,0x3c,0x01,0x1a,0x7f,0x34,0x01,0x04,0x43,0x01,0x06,
+0xeb,0x01,0x21,0x18,0x88,0x07,0x00,0x13,0x03,0xfe,0x02,0x12,0x4f,0xf9,0x06,0x10,
+0x06,0xbf,0x04,0x00,0xf5,0x04,0x02,0xfe,0x02,0x13,0x3f,0x19,0x06,0x29,0x5d,0x40,
+0x25,0x02,0x1f,0xf8,0x03,0x00,0x32,0x00,0x7e,0x00,0xf4,0x04,0x88,0x70,0x06,0xff,
+0xe0,0x06,0xff,0xd0,0x09,0xff,0x90,0x0e,0xff,0x40,0x5f,0xfc,0x00,0x06,0xd2,0xd4,
+0x00,0x12,0x2f,0xcd,0x04,0x31,0x02,0xff,0xf2,0x0f,0x00,0x21,0x3f,0xff,0xe3,0x00,
+0x31,0x07,0xff,0xa0,0x0f,0x00,0x21,0xef,0xf3,0x0f,0x00,0x22,0x1a,0xfa,0x2d,0x00,
+0x1f,0x02,0x4c,0x01,0x5f,0x00,0xea,0x03,0x35,0x01,0xff,0xf3,0x06,0x00,0xf1,0x05,
+0x02,0xff,0xf1,0x0f,0xff,0xf8,0x06,0xff,0xc0,0x0f,0xff,0xf8,0x0c,0xff,0x50,0x0f,
+0xff,0xf8,0x1c,0xfc,0x1a,0x02,0x12,0x51,0x20,0x02,0x0f,0x06,0x00,0x4e,0x0f,0xea,
+0x00,0x25,0x30,0x1b,0xfc,0x20,0x0f,0x00,0x31,0x09,0xff,0xfb,0x0f,0x00,0x30,0xaf,
+0xff,0xc0,0x0f,0x00,0x32,0x03,0xef,0xf5,0x2d,0x00,0x1f,0x21,0x35,0x01,0x3d,0x0f,
+0xe7,0x00,0x29,0x71,0x03,0xdf,0xb1,0x0f,0xff,0xf8,0x0d,0x40,0x02,0x31,0x0e,0xff,
+0xf9,0x71,0x01,0x10,0xe2,0x1e,0x00,0x1f,0x12,0x54,0x00,0x24,0x24,0x00,0x7f,0x39,
+0x04,0x0f,0x09,0x00,0x26,0x22,0x02,0x30,0x09,0x00,0x31,0xfb,0xef,0x90,0xf7,0x08,
+0x10,0xff,0xed,0x05,0x01,0x26,0x08,0x23,0xfd,0x94,0x11,0x00,0x02,0x2d,0x00,0x2f,
+0x68,0xaf,0x63,0x00,0x24,0x10,0xfc,0x51,0x01,0x23,0xb2,0x00,0x53,0x01,0x1f,0xf3,
+0x09,0x00,0x02,0x2f,0xf0,0x00,0x05,0x00,0x18,0x20,0xf6,0xb3,0x3b,0x00,0xa0,0xf4,
+0x15,0xcf,0xff,0xff,0xe2,0x8f,0xff,0xff,0xf4,0xa4,0x00,0x3f,0xf0,0x00,0x43,0x46,
+0x00,0x1c,0x03,0x11,0x07,0x34,0xbc,0xcc,0xa0,0x06,0x0b,0x22,0xe1,0x00,0x37,0x04,
+0x24,0xff,0xe2,0x4e,0x07,0x14,0xf3,0x2b,0x0b,0x1e,0xf4,0xfe,0x0a,0x03,0xeb,0x05,
+0x00,0x47,0x07,0x31,0x2f,0xff,0xf8,0x9e,0x04,0x00,0xa7,0x06,0x01,0x91,0x00,0x03,
+0x13,0x00,0x24,0xff,0xe0,0x13,0x00,0x24,0xff,0x80,0x13,0x00,0x24,0xff,0x30,0x13,
+0x00,0x13,0xfc,0x13,0x00,0x00,0x46,0x07,0x01,0x13,0x00,0x42,0xfb,0xaf,0xff,0xf1,
+0x13,0x00,0x41,0xb1,0xff,0xff,0xb0,0x13,0x00,0x00,0x81,0x09,0x11,0x50,0x13,0x00,
+0x51,0xb0,0x0c,0xff,0xfe,0x12,0x13,0x00,0x42,0x00,0x2f,0xff,0xf9,0x13,0x00,0x41,
+0x00,0x8f,0xff,0xf5,0x13,0x00,0x00,0x34,0x07,0x33,0xef,0xff,0xf8,0x39,0x08,0x03,
+0x13,0x00,0x10,0x0a,0x7e,0x07,0x01,0xdf,0x02,0x14,0x1e,0x13,0x00,0x24,0x00,0x5f,
+0x13,0x00,0x24,0x00,0xbf,0x13,0x00,0x15,0x02,0x13,0x00,0x11,0x07,0xa7,0x00,0x00,
+0xfc,0x01,0x10,0xf5,0x07,0x00,0x22,0x01,0xff,0x4e,0x08,0x11,0x0b,0x6b,0x02,0x00,
+0x3c,0x00,0x12,0xa0,0x32,0x01,0x1d,0xca,0x0a,0x01,0x00,0x1d,0x00,0x91,0xe0,0x29,
+0xdf,0xfc,0x70,0x00,0x5f,0xff,0xf5,0xdb,0x00,0x12,0x5f,0xdc,0x01,0xc0,0x70,0x5f,
+0xff,0xff,0xea,0xbe,0xff,0xff,0xd0,0x5f,0xff,0xfb,0x8d,0x0a,0x40,0xf1,0x5f,0xff,
+0xf2,0x61,0x00,0x11,0xf2,0x08,0x00,0x3f,0x4f,0xff,0xf3,0x08,0x00,0x38,0x50,0x00,
+0x00,0x4f,0xff,0xf3,0xf4,0x08,0xff,0xff,0xe1,0x00,0x00,0x00,0x02,0xff,0xff,0x8f,
+0xff,0xff,0xa0,0x00,0x00,0x00,0x2f,0xff,0xf8,0xff,0xff,0xff,0x40,0x13,0x00,0x15,
+0xfe,0x13,0x00,0x14,0xf8,0x13,0x00,0x24,0xff,0xf3,0x13,0x00,0x22,0xff,0xc0,0x13,
+0x00,0x42,0xfe,0xff,0xff,0x70,0x13,0x00,0x41,0xba,0xff,0xff,0x10,0x13,0x00,0x42,
+0xfb,0x1f,0xff,0xfb,0x13,0x00,0x42,0xb0,0x6f,0xff,0xf5,0x13,0x00,0x42,0x00,0xcf,
+0xff,0xe1,0x13,0x00,0x42,0x02,0xff,0xff,0x92,0x13,0x00,0x41,0x08,0xff,0xff,0x5f,
+0x13,0x00,0x42,0x00,0x0d,0xff,0xfe,0x13,0x00,0x42,0x00,0x4f,0xff,0xff,0x13,0x00,
+0x33,0x00,0xaf,0xff,0x13,0x00,0x24,0x01,0xef,0x13,0x00,0x14,0x05,0x13,0x00,0x24,
+0x00,0x0b,0x13,0x00,0x24,0x00,0x2f,0x13,0x00,0x20,0x00,0x7f,0xa7,0x00,0x07,0x01,
+0x00,0x23,0x28,0x88,0x09,0x00,0x33,0x05,0xff,0xf0,0x0a,0x00,0x23,0x5f,0xfe,0x09,
+0x00,0x33,0x08,0xff,0xb0,0x0a,0x00,0x23,0xdf,0xf5,0x09,0x00,0x24,0x4f,0xfd,0x39,
+0x00,0x39,0x5d,0x30,0x00,0x01,0x00,0xf1,0x03,0x5f,0xff,0xe0,0x29,0xdf,0xfc,0x70,
+0x00,0x5f,0xff,0xf5,0xff,0xff,0xff,0xfc,0x00,0x5f,0xff,0x01,0x00,0xa0,0x70,0x5f,
+0xff,0xff,0xea,0xbe,0xff,0xff,0xd0,0x5f,0x80,0x00,0xb1,0xcf,0xff,0xf1,0x5f,0xff,
+0xf2,0x00,0x00,0x6f,0xff,0xf2,0x08,0x00,0x3f,0x4f,0xff,0xf3,0x08,0x00,0x3d,0x07,
+0x93,0x00,0x22,0x58,0x85,0x08,0x00,0x23,0xbf,0xf9,0x08,0x00,0x03,0xfb,0x00,0x12,
+0xef,0xce,0x00,0x31,0x03,0xff,0xe0,0x08,0x00,0x31,0x0a,0xff,0x70,0x08,0x00,0x29,
+0x01,0x9c,0xd1,0x00,0x71,0x04,0x88,0x82,0x00,0x05,0x88,0x82,0x48,0x01,0x51,0xe2,
+0x06,0xff,0xf9,0x00,0x0a,0x00,0x33,0xe8,0xff,0xf7,0x35,0x00,0x22,0xff,0xf6,0x28,
+0x00,0x24,0x09,0xff,0x1d,0x01,0x0b,0x01,0x00,0x44,0x0f,0xff,0xfe,0x10,0x1d,0x02,
+0x15,0xfa,0x43,0x02,0x15,0xf4,0x30,0x02,0x15,0xe0,0x30,0x02,0x15,0x80,0x30,0x02,
+0x14,0x30,0x13,0x00,0x13,0xfc,0x13,0x00,0x42,0xef,0xff,0xf7,0x00,0x1d,0x02,0x32,
+0xaf,0xff,0xf1,0x13,0x00,0x11,0xb1,0x20,0x02,0x00,0x13,0x00,0x42,0x06,0xff,0xff,
+0x50,0x30,0x02,0x42,0x0c,0xff,0xfe,0x12,0xe4,0x01,0x42,0x2f,0xff,0xf9,0x2f,0xf7,
+0x01,0x33,0x8f,0xff,0xf5,0xf7,0x01,0x32,0xdf,0xff,0xef,0x13,0x00,0x24,0x04,0xff,
+0x1d,0x02,0x15,0x0a,0x43,0x02,0x15,0x1e,0x30,0x02,0x15,0x5f,0x30,0x02,0x14,0xbf,
+0x13,0x00,0x15,0x02,0x13,0x00,0x10,0x07,0xa7,0x00,0x42,0xaf,0xff,0x40,0x04,0x3e,
+0x00,0x21,0xf4,0x5f,0x16,0x00,0x12,0xaf,0xdb,0x00,0x00,0x4f,0x00,0x11,0xa0,0xf5,
+0x00,0x2e,0x8b,0xb8,0x0a,0x01,0x0f,0x1c,0x02,0x76,0x33,0x08,0xff,0xc0,0x92,0x00,
+0x34,0x8f,0xfb,0x00,0xbe,0x01,0x1c,0x90,0xe4,0x02,0x14,0x2f,0x00,0x03,0x12,0x07,
+0x19,0x02,0x00,0x2b,0x02,0x1d,0x90,0xcc,0x00,0x00,0x68,0x03,0x11,0x5f,0xe2,0x03,
+0x05,0xcf,0x00,0x00,0x13,0x00,0x74,0xfe,0xab,0xef,0xff,0xfd,0x00,0x00,0xd2,0x00,
+0x00,0x13,0x00,0x30,0x20,0x00,0x06,0x05,0x00,0x05,0xa1,0x02,0x01,0x13,0x00,0x10,
+0x04,0xec,0x01,0x0f,0x13,0x00,0x41,0x02,0xaf,0x04,0x15,0x03,0xaf,0x04,0x11,0x3f,
+0x59,0x02,0x14,0x30,0x13,0x00,0x15,0xfd,0x13,0x00,0x14,0xf7,0x13,0x00,0x24,0xff,
+0xf2,0x13,0x00,0x22,0xff,0xb0,0x13,0x00,0x42,0xfd,0xff,0xff,0x50,0x13,0x00,0x32,
+0xb7,0xff,0xfe,0x13,0x00,0x42,0xfb,0x0d,0xff,0xf8,0x13,0x00,0x52,0xb0,0x4f,0xff,
+0xf2,0x03,0x20,0x02,0x32,0xaf,0xff,0xc0,0x13,0x00,0x42,0x01,0xff,0xff,0x63,0x13,
+0x00,0x42,0x06,0xff,0xfe,0x4f,0x33,0x02,0x33,0x0c,0xff,0xfc,0x46,0x02,0x15,0x3f,
+0x6c,0x02,0x15,0x9f,0x6c,0x02,0x0f,0xaf,0x04,0x16,0x23,0xf7,0x00,0xad,0x03,0x04,
+0x8d,0x01,0x13,0x8f,0x70,0x03,0x62,0x8c,0xdf,0xff,0xff,0x10,0x00,0x38,0x00,0x03,
+0xc5,0x01,0x12,0xcf,0x3f,0x00,0x00,0x8f,0x02,0x20,0xeb,0x50,0xaa,0x01,0x12,0x07,
+0x76,0x02,0x22,0xf1,0xdf,0x76,0x02,0x20,0xfd,0xff,0x6d,0x03,0x90,0x5f,0xff,0xff,
+0xfb,0xae,0xff,0xff,0xe0,0x5f,0xbb,0x02,0x10,0xbf,0x6e,0x02,0x10,0xf3,0xb1,0x01,
+0x11,0xf4,0x08,0x00,0x42,0x3f,0xff,0xf5,0x5f,0xc0,0x05,0x0f,0x08,0x00,0x36,0x01,
+0x92,0x00,0x13,0x3f,0x08,0x00,0x11,0x9f,0xa2,0x04,0x21,0x07,0xac,0xff,0x03,0x01,
+0xbb,0x00,0x00,0xd7,0x00,0x14,0x0c,0x47,0x03,0x00,0xb8,0x00,0x82,0x00,0x00,0x39,
+0x99,0x99,0x99,0x99,0x94,0x6e,0x02,0x02,0xaa,0x01,0x08,0x0a,0x00,0x0f,0x01,0x00,
+0x0c,0x41,0x6b,0xef,0xfe,0xb6,0x09,0x00,0x10,0x6e,0x32,0x00,0x11,0xe6,0xe4,0x02,
+0x00,0x01,0x00,0x00,0x0e,0x02,0x00,0xb0,0x06,0x00,0x7a,0x01,0x01,0xd8,0x03,0x70,
+0x10,0x01,0x7f,0xff,0xff,0x30,0x0a,0x82,0x00,0x00,0xa2,0x02,0x21,0xb0,0x1f,0x1d,
+0x02,0x02,0x88,0x03,0x01,0x69,0x00,0x41,0x6f,0xff,0xf6,0x8f,0xb0,0x04,0x00,0xf9,
+0x01,0x30,0x9f,0xff,0xf2,0x0a,0x00,0x30,0x1f,0xff,0xfa,0x89,0x04,0x01,0xdf,0x04,
+0x16,0xfb,0x0a,0x00,0x06,0x1e,0x00,0x05,0x32,0x00,0x16,0xf9,0x46,0x00,0x05,0x5a,
+0x00,0x11,0xf2,0x6e,0x00,0x00,0xf4,0x01,0x11,0xc0,0x82,0x00,0x50,0x00,0x7f,0xff,
+0xff,0x40,0x05,0x00,0x58,0xfd,0xdf,0xff,0xff,0xf9,0xaa,0x00,0x26,0x00,0x5e,0xf0,
+0x00,0x00,0xd2,0x00,0x14,0x10,0x03,0x01,0x12,0xf6,0x33,0x02,0x33,0xff,0xff,0x60,
+0x28,0x01,0x1f,0x93,0x05,0x01,0x01,0x90,0x04,0xad,0xff,0xda,0x40,0x00,0x00,0x00,
+0x1b,0x2a,0x00,0x41,0xc1,0x00,0x00,0x1d,0x33,0x00,0x10,0xe1,0xa8,0x04,0x22,0xea,
+0xae,0x7e,0x00,0x10,0xb0,0x7e,0x01,0x41,0x40,0x8f,0xff,0xf1,0xb7,0x00,0x31,0x0c,
+0xff,0xfc,0xcf,0x04,0x50,0xd0,0xef,0xff,0x90,0x00,0x75,0x07,0x31,0x0f,0xff,0xf8,
+0x80,0x02,0x14,0xf0,0x11,0x00,0x31,0x0c,0xff,0xfb,0x1a,0x05,0x23,0xe0,0x9f,0x33,
+0x00,0x40,0x03,0xff,0xff,0xb0,0x51,0x00,0x23,0x40,0x0b,0x55,0x00,0x01,0x4b,0x05,
+0x01,0x80,0x03,0x10,0x1c,0x08,0x00,0x12,0xc2,0x88,0x00,0x21,0xea,0x50,0x68,0x07,
+0x52,0x87,0x00,0x00,0x68,0x83,0x1a,0x01,0x22,0x20,0x01,0x0d,0x02,0x42,0x0d,0xff,
+0xe9,0x9e,0x84,0x06,0x21,0x03,0xef,0x53,0x08,0x00,0x01,0x00,0x4f,0x18,0xdf,0xfd,
+0x91,0xdd,0x01,0xe2,0x12,0xfe,0x99,0x07,0x73,0x02,0xff,0xf8,0x11,0x8f,0xff,0x20,
+0x2f,0x00,0x13,0xa0,0xe2,0x00,0x11,0x90,0xa1,0x07,0x4f,0x68,0x86,0x10,0x00,0xee,
+0x01,0x92,0x72,0x00,0x00,0xaa,0xa9,0x00,0x9a,0xa9,0x45,0x09,0x23,0xf4,0x09,0x36,
+0x01,0x00,0xf1,0x06,0x11,0x60,0x2c,0x01,0x22,0xfb,0x02,0x87,0x09,0x6f,0x06,0xff,
+0xe1,0x0d,0xff,0x90,0xee,0x01,0xdf,0x00,0xd0,0x05,0x21,0xfb,0x02,0x85,0x01,0x60,
+0xcf,0xfe,0x10,0xdf,0xfd,0x10,0x5c,0x00,0x40,0x30,0xaf,0xfe,0x20,0x78,0x00,0x20,
+0x60,0x6f,0xaf,0x06,0x6f,0x05,0xaa,0x80,0x09,0xaa,0x40,0xee,0x01,0x92,0x32,0x01,
+0x7b,0xef,0xed,0x00,0x01,0xc5,0x03,0x15,0x08,0x0c,0x00,0x00,0xed,0x09,0x17,0x1d,
+0x0e,0x00,0x01,0x4e,0x00,0xc1,0xfc,0xa9,0x9a,0xff,0xff,0xfb,0xbb,0xbb,0xbb,0xbb,
+0xb3,0x07,0x48,0x00,0x11,0x0f,0x9e,0x00,0x01,0x13,0x07,0x53,0xd0,0x00,0x00,0x00,
+0xff,0xa4,0x08,0x11,0x3f,0x60,0x0a,0x04,0x1d,0x00,0x01,0x42,0x08,0x05,0x1d,0x00,
+0x00,0xbb,0x00,0x02,0x61,0x0a,0x91,0xaa,0xaa,0xaa,0xaa,0x70,0x08,0xff,0xff,0x00,
+0x1d,0x00,0x11,0xff,0x5e,0x09,0x13,0x8f,0x1d,0x00,0x11,0xff,0x81,0x0c,0x0e,0x1d,
+0x00,0x07,0x57,0x00,0x14,0x07,0x1d,0x00,0x01,0x57,0x00,0x00,0x7b,0x09,0x07,0x1d,
+0x00,0x11,0x03,0x64,0x05,0x05,0x1d,0x00,0x36,0x0e,0xff,0xfd,0x1d,0x00,0x00,0x83,
+0x00,0x26,0xfb,0x10,0x1d,0x00,0x00,0x32,0x0a,0x60,0xc9,0x99,0xaf,0xff,0xfe,0xbb,
+0x01,0x00,0x37,0x30,0x01,0xcf,0xf6,0x00,0x11,0xf5,0xad,0x02,0x05,0x01,0x00,0x58,
+0x50,0x00,0x00,0x17,0xbe,0x1d,0x00,0x40,0x29,0xdf,0xfe,0xb6,0x1a,0x02,0x32,0xec,
+0x70,0x00,0x2a,0x00,0x72,0xfd,0x32,0xdf,0xff,0xff,0xff,0xe3,0xde,0x0c,0x03,0x01,
+0x00,0x70,0xf2,0x00,0x6f,0xff,0xff,0xba,0xdf,0x1e,0x00,0x80,0xac,0xff,0xff,0xc0,
+0x0e,0xff,0xfe,0x20,0x2c,0x00,0x10,0xf9,0xc3,0x00,0x11,0x34,0x55,0x00,0x30,0xdf,
+0xff,0xfe,0xa5,0x00,0x11,0xf7,0xe2,0x00,0x11,0x08,0x7a,0x02,0x31,0xcf,0xff,0x99,
+0xa0,0x0d,0x03,0xa1,0x09,0x20,0xfa,0xbf,0x62,0x01,0x13,0x04,0x52,0x00,0x37,0xaa,
+0xff,0xfd,0x1b,0x00,0x04,0x36,0x00,0x11,0x90,0x62,0x02,0x04,0x51,0x00,0x13,0x10,
+0xf9,0x00,0x00,0xde,0x02,0x00,0xf0,0x00,0x20,0x01,0x72,0x09,0x00,0x11,0xa9,0xde,
+0x00,0x61,0xb9,0xac,0xff,0x90,0x00,0xbf,0x3e,0x00,0x02,0xff,0x01,0x11,0x10,0xdf,
+0x08,0x11,0xfe,0xbd,0x00,0x24,0xff,0x90,0xd8,0x00,0x42,0x5a,0xef,0xfe,0xb7,0xb6,
+0x04,0x33,0xbc,0xcc,0xa0,0x73,0x0a,0x23,0xfe,0x10,0xe3,0x01,0x13,0xe2,0x7b,0x0a,
+0x00,0xf1,0x02,0x02,0x2c,0x04,0x0e,0x09,0x04,0x05,0xbe,0x01,0x24,0xda,0x60,0xc7,
+0x01,0x22,0xfe,0x60,0x09,0x00,0x00,0x56,0x03,0x91,0xff,0xff,0xeb,0xbb,0xcd,0xff,
+0xff,0xff,0x20,0xfc,0x08,0x40,0x2c,0xff,0xff,0x90,0x09,0x00,0x00,0x16,0x04,0x12,
+0xc0,0x0e,0x09,0x32,0xdf,0xff,0xd0,0x09,0x00,0x12,0xef,0x09,0x00,0x00,0xde,0x00,
+0x10,0xa0,0x09,0x00,0x63,0x02,0x7e,0xff,0xff,0x40,0xff,0x00,0x01,0x04,0x51,0x00,
+0x13,0x90,0x09,0x00,0x10,0xf3,0x6c,0x00,0x30,0xec,0xcc,0xdf,0x92,0x00,0x00,0x2d,
+0x00,0x10,0x2f,0x2e,0x01,0x03,0x15,0x03,0x10,0x50,0x09,0x00,0x00,0x62,0x00,0x23,
+0xd0,0x00,0xd6,0x09,0x12,0xf6,0x09,0x00,0x31,0x1f,0xff,0xfe,0x09,0x00,0x00,0xfd,
+0x03,0x11,0x70,0x09,0x00,0x42,0x01,0xff,0xff,0xe0,0x7e,0x00,0x31,0x8f,0xff,0xf7,
+0xa6,0x0e,0x10,0xc0,0xe6,0x08,0x20,0xfd,0x00,0xac,0x0a,0x10,0xd1,0x95,0x00,0x00,
+0xf4,0x03,0x3a,0x06,0xcc,0xc3,0xf0,0x00,0xa0,0x4f,0xff,0xf0,0x4c,0xff,0x40,0x4f,
+0xff,0xf7,0xff,0x06,0x00,0x14,0xff,0x06,0x00,0xa1,0x30,0x4f,0xff,0xff,0xd7,0x66,
+0x10,0x4f,0xff,0xfa,0x24,0x00,0x1f,0xf4,0x06,0x00,0x27,0x50,0xff,0xf4,0x00,0x00,
+0x00,0x10,0xff,0x01,0x00,0x51,0xda,0x60,0x00,0x00,0xff,0x01,0x00,0x23,0xfe,0x60,
+0x09,0x00,0xf1,0x06,0xff,0xf7,0x00,0xff,0xff,0xeb,0xbb,0xcd,0xff,0xff,0xff,0x20,
+0xff,0xff,0xb0,0x00,0x00,0x2c,0xff,0xff,0x90,0x09,0x00,0x41,0x02,0xff,0xff,0xc0,
+0x09,0x00,0x42,0x00,0xdf,0xff,0xd0,0x09,0x00,0x13,0xef,0x09,0x00,0x40,0x04,0xff,
+0xff,0xa0,0x09,0x00,0x53,0x02,0x7e,0xff,0xff,0x40,0x48,0x00,0x14,0xfa,0x51,0x00,
+0x13,0x90,0x09,0x00,0x10,0xf3,0x6c,0x00,0x70,0xec,0xcc,0xdf,0xff,0xf4,0x00,0x00,
+0x2d,0x00,0x32,0x2f,0xff,0xfd,0x09,0x00,0x40,0x0a,0xff,0xff,0x50,0x09,0x00,0x00,
+0x62,0x00,0x21,0xd0,0x00,0x51,0x00,0x32,0x9f,0xff,0xf6,0x09,0x00,0x32,0x1f,0xff,
+0xfe,0x09,0x00,0x41,0x09,0xff,0xff,0x70,0x09,0x00,0x42,0x01,0xff,0xff,0xe0,0x7e,
+0x00,0x47,0x8f,0xff,0xf7,0x00,0x01,0x00,0x22,0x88,0x82,0x08,0x00,0x34,0x01,0xff,
+0xf3,0x09,0x00,0x12,0xf2,0x09,0x00,0x32,0x04,0xff,0xe0,0x09,0x00,0x32,0x09,0xff,
+0x90,0x09,0x00,0x32,0x1f,0xff,0x20,0x09,0x00,0x39,0x03,0xc6,0x00,0x01,0x00,0xc0,
+0x4f,0xff,0xf0,0x4c,0xff,0x44,0xff,0xff,0x7f,0xff,0xf4,0x4f,0xb5,0x00,0x11,0x44,
+0xba,0x00,0x90,0x4f,0xff,0xff,0xd7,0x66,0x14,0xff,0xff,0xa0,0x21,0x00,0x11,0xf4,
+0xf0,0x00,0x1f,0x40,0x0b,0x00,0x20,0x03,0x8e,0x00,0x70,0x88,0x60,0x00,0x00,0x00,
+0x9f,0xfb,0x90,0x00,0x00,0x52,0x00,0x31,0x00,0xcf,0xf7,0x92,0x00,0x41,0x10,0x00,
+0x00,0x08,0xa0,0x00,0x36,0x08,0xd1,0x00,0x2c,0x00,0x31,0x82,0x00,0x05,0xd9,0x00,
+0x41,0xbf,0xfe,0x20,0x6f,0x1e,0x00,0x33,0x0b,0xff,0xe8,0xf8,0x00,0x43,0xaf,0xff,
+0xff,0x60,0xd7,0x00,0x2f,0xf5,0x00,0x01,0x00,0x02,0x0f,0xe5,0x01,0xb3,0xf0,0x04,
+0x4f,0xff,0xa0,0x00,0xcf,0xff,0x30,0x4f,0xff,0xa1,0xcf,0xff,0x30,0x00,0x4f,0xff,
+0xff,0xfe,0x30,0x51,0x01,0x10,0xfe,0xc3,0x01,0x23,0x4b,0xbb,0xc9,0x01,0x0a,0xc2,
+0x01,0x21,0x40,0x04,0xc3,0x01,0x11,0x00,0xc4,0x01,0x22,0x40,0x04,0x9a,0x00,0x01,
+0xc6,0x01,0x21,0x10,0x04,0xc7,0x01,0x03,0x91,0x01,0x02,0x9d,0x01,0x0f,0x0d,0x00,
+0x28,0x00,0x01,0x00,0x41,0x02,0xcc,0xcc,0x70,0x09,0x00,0x32,0x0c,0xff,0xfc,0x12,
+0x00,0x32,0x7f,0xff,0xd0,0x1a,0x00,0x51,0xff,0xfe,0x10,0x00,0x00,0xb5,0x01,0x2f,
+0xe2,0x00,0x01,0x00,0x03,0x51,0x17,0xbd,0xff,0xec,0x72,0xc4,0x01,0x02,0x47,0x01,
+0x21,0x00,0xcf,0x09,0x00,0x10,0xfc,0x11,0x00,0xa0,0xfe,0xcb,0xef,0xff,0xff,0x90,
+0x0f,0xff,0xff,0x60,0x75,0x00,0x41,0xf2,0x2f,0xff,0xfa,0x5c,0x00,0xb0,0xf6,0x2f,
+0xff,0xf8,0x00,0x00,0x00,0x2b,0xbb,0xb5,0x0e,0x0b,0x01,0x00,0x01,0x00,0x54,0x07,
+0xff,0xff,0xfa,0x30,0x15,0x02,0x23,0xfe,0x94,0x13,0x00,0x30,0xff,0xff,0xe7,0x0a,
+0x00,0x60,0x19,0xef,0xff,0xff,0xff,0xd3,0x0a,0x00,0x52,0x05,0xaf,0xff,0xff,0xff,
+0x28,0x00,0x70,0x5c,0xff,0xff,0xd0,0x12,0x22,0x10,0x5a,0x02,0x51,0xff,0xf4,0xef,
+0xff,0xd0,0xd2,0x00,0x42,0xf7,0xbf,0xff,0xf2,0x09,0x00,0xf2,0x05,0x6f,0xff,0xfd,
+0x30,0x00,0x02,0xdf,0xff,0xf5,0x0c,0xff,0xff,0xfd,0xba,0xcf,0xff,0xff,0xe0,0x01,
+0xdf,0xe2,0x01,0x13,0x40,0xab,0x00,0x92,0xd4,0x00,0x00,0x00,0x16,0xad,0xef,0xed,
+0xa5,0xc8,0x00,0x02,0x9d,0x00,0x00,0xbf,0x00,0x12,0xb0,0x7e,0x00,0x13,0xfc,0x17,
+0x00,0x02,0xcd,0x02,0x3f,0x8c,0xcc,0x10,0xfe,0x00,0x01,0x80,0x4a,0xdf,0xfe,0xb7,
+0x10,0x00,0x00,0x0a,0x51,0x00,0x10,0xe5,0x8b,0x00,0x04,0xb0,0x01,0x80,0xa4,0x37,
+0xff,0xff,0xd0,0x08,0xff,0xfd,0xf0,0x00,0xd1,0xf2,0x08,0xff,0xfe,0x00,0x00,0x15,
+0x55,0x51,0x05,0xff,0xff,0xd7,0xbe,0x00,0x00,0x28,0x00,0x14,0xb6,0x35,0x01,0x73,
+0xe6,0x00,0x00,0x00,0x28,0xcf,0xff,0x0d,0x03,0xd0,0x4a,0xff,0xff,0xf0,0x09,0x99,
+0x92,0x00,0x00,0x5f,0xff,0xf3,0x0f,0x28,0x01,0xb3,0x3f,0xff,0xf3,0x09,0xff,0xff,
+0x94,0x35,0xdf,0xff,0xf0,0xc3,0x00,0x32,0x60,0x00,0x1b,0x04,0x03,0x72,0x00,0x00,
+0x49,0xdf,0xfe,0xc7,0x10,0xa1,0x01,0x23,0xd1,0x00,0xc0,0x00,0x11,0xfd,0x52,0x02,
+0x31,0x1d,0xff,0xda,0xb4,0x01,0x50,0x02,0xdf,0xfc,0x00,0x9f,0x6b,0x02,0x7f,0x05,
+0x88,0x70,0x00,0x05,0x88,0x60,0xc5,0x01,0xc9,0x01,0xe8,0x00,0x01,0xc6,0x00,0x11,
+0xe2,0x86,0x00,0x41,0xfe,0xaf,0xfe,0x30,0xbc,0x02,0xbf,0x08,0xff,0xe3,0x00,0x00,
+0x59,0x99,0x10,0x00,0x69,0x98,0xc5,0x01,0x88,0x0f,0x86,0x01,0xab,0x43,0xaf,0xff,
+0xfd,0xa5,0x2c,0x04,0x22,0xe5,0x00,0x8a,0x00,0x32,0xaf,0xff,0xa0,0x0a,0x00,0x32,
+0x0d,0xff,0xf0,0x0f,0x06,0x34,0xbf,0xff,0xe0,0xa5,0x00,0x11,0x50,0x09,0x00,0x3f,
+0x06,0xfd,0x93,0x84,0x01,0x3b,0x13,0xdf,0x84,0x01,0xb0,0x01,0x5a,0xff,0xff,0xf0,
+0x08,0x88,0x81,0x00,0x00,0x6f,0x84,0x01,0x14,0xf7,0x84,0x01,0x2f,0x83,0x24,0x84,
+0x01,0x03,0x22,0xff,0xff,0x49,0x03,0x22,0x8f,0xfe,0x91,0x05,0x12,0xbf,0xa5,0x06,
+0x00,0xf9,0x00,0x13,0x10,0x11,0x00,0x01,0x19,0x00,0x31,0x3b,0xff,0xfe,0x0f,0x00,
+0x13,0x5f,0xb4,0x06,0x30,0x4f,0xd9,0x20,0xd0,0x00,0xd1,0xaa,0xa2,0x00,0x09,0xaa,
+0xa1,0x00,0x00,0x01,0xef,0xfe,0x20,0xcf,0xdc,0x00,0x51,0x2e,0xff,0xec,0xff,0xf6,
+0xa3,0x07,0x43,0xff,0xff,0xff,0x70,0xdb,0x05,0x12,0xf8,0x10,0x01,0x3e,0x05,0x99,
+0x70,0x81,0x03,0x15,0x83,0xfb,0x01,0x14,0xb2,0xfb,0x01,0x21,0xfe,0x20,0xfb,0x01,
+0x40,0xdf,0xff,0xff,0xd0,0xfb,0x01,0x00,0x8d,0x00,0x11,0xf4,0xfb,0x01,0x00,0x98,
+0x01,0x14,0x2f,0x4e,0x00,0x0f,0xfb,0x01,0x2c,0x32,0x45,0x55,0x40,0xfb,0x01,0x14,
+0xdf,0xfb,0x01,0x32,0xaf,0xff,0xf3,0x09,0x00,0x14,0x5f,0xfb,0x01,0x15,0x0b,0xfb,
+0x01,0x14,0xcf,0xfb,0x01,0x15,0x08,0xfb,0x01,0x13,0x15,0x81,0x03,0xe1,0x6f,0xff,
+0x70,0x01,0xdf,0xfe,0x20,0x00,0x06,0xff,0xf8,0x2d,0xff,0xe2,0x11,0x00,0x30,0xff,
+0xfd,0x10,0xe5,0x01,0x13,0xff,0x9e,0x04,0x2f,0x5b,0xba,0x46,0x05,0x88,0x23,0x6f,
+0xff,0x01,0x00,0x1f,0xf2,0x0a,0x00,0x01,0xa0,0x4b,0xbb,0xbb,0xbd,0xff,0xff,0xcb,
+0xbb,0xbb,0xb1,0xe2,0x08,0x04,0x40,0x01,0x0f,0x0a,0x00,0x98,0x43,0x00,0xff,0xfa,
+0x20,0xf0,0x07,0x16,0x9d,0xfb,0x07,0x23,0xff,0xfa,0x0a,0x00,0x44,0x7d,0xff,0xf9,
+0x00,0x42,0x06,0x04,0xec,0x07,0x41,0xbf,0xc8,0x10,0x00,0xc7,0x01,0x11,0xf2,0xc4,
+0x01,0x1d,0x20,0x0b,0x00,0x10,0x0d,0x1b,0x01,0x11,0xf0,0x50,0x01,0x02,0x0b,0x00,
+0x5e,0x34,0x8f,0xff,0xf5,0x44,0x2c,0x00,0x0f,0x0b,0x00,0x08,0x11,0x05,0x0a,0x04,
+0x70,0x3f,0xff,0xff,0xbb,0x20,0x00,0xef,0xe6,0x08,0x10,0x05,0x9d,0x02,0x00,0xe5,
+0x04,0x10,0xc2,0x59,0x09,0x51,0xb3,0x00,0x00,0x02,0x8c,0xaf,0x00,0x10,0x3f,0x4d,
+0x04,0x10,0x8e,0xcc,0x01,0x11,0x0d,0x96,0x08,0x10,0xce,0xb0,0x03,0x62,0x78,0x86,
+0x00,0x01,0x78,0x86,0x90,0x03,0x42,0x80,0x1d,0xff,0xe2,0x2e,0x0b,0x21,0xf9,0xdf,
+0x77,0x02,0x01,0x57,0x00,0x13,0xc1,0x28,0x0b,0x2f,0xef,0xfb,0xc1,0x08,0x04,0x0f,
+0xf8,0x01,0xce,0x13,0x00,0xee,0x01,0x22,0xff,0xf3,0xf2,0x01,0x11,0xf1,0x04,0x04,
+0x22,0xff,0xc0,0xf2,0x09,0x10,0x60,0x87,0x01,0x22,0x1c,0xfd,0x8e,0x01,0x13,0x52,
+0x95,0x01,0x04,0x07,0x00,0x01,0xda,0x01,0x0c,0x07,0x00,0x02,0xe4,0x01,0x0b,0x2a,
+0x00,0x0f,0x07,0x00,0x18,0x03,0x3a,0x05,0x02,0xf3,0x01,0x22,0x00,0x0e,0x8c,0x04,
+0x13,0x05,0x93,0x04,0x4f,0x4b,0xef,0xec,0x20,0x92,0x01,0x40,0x01,0xbb,0x00,0x1a,
+0xf1,0x0a,0x00,0x6f,0xbd,0xde,0xff,0xff,0xdd,0xd0,0x92,0x01,0x5e,0x02,0xfc,0x02,
+0x0d,0x06,0x00,0x02,0x40,0x03,0x08,0x06,0x00,0x68,0x03,0x48,0xff,0xff,0x54,0x40,
+0x24,0x00,0x11,0x7f,0xb1,0x04,0x02,0x06,0x00,0x10,0x6d,0xbe,0x00,0x1e,0xd6,0x4e,
+0x00,0x00,0x4a,0x01,0x11,0x40,0xe5,0x0b,0x21,0xfb,0xb2,0x38,0x0d,0x11,0xf3,0xe2,
+0x02,0x70,0xf3,0x00,0x00,0x04,0xbe,0xfe,0xc2,0xf0,0x15,0x00,0x00,0x04,0xbb,0x50,
+0x00,0x4c,0xc4,0x00,0x00,0x00,0x05,0xff,0xff,0xc3,0x0b,0xff,0x30,0x00,0x00,0x00,
+0xef,0xff,0xff,0xff,0xff,0xd0,0x00,0x00,0x00,0x4f,0xfa,0x04,0xdf,0xff,0xf4,0x1c,
+0x00,0x6f,0xdd,0x30,0x00,0x8c,0xb4,0x00,0x01,0x00,0x01,0xff,0x05,0x03,0xff,0xff,
+0x80,0x00,0x00,0x00,0x7f,0xff,0xf4,0x3f,0xff,0xf8,0x00,0x00,0x00,0x07,0xff,0xff,
+0x43,0x13,0x00,0x5e,0x14,0x42,0x13,0x00,0xf1,0x1b,0xf3,0x1f,0xff,0xfa,0x00,0x00,
+0x00,0x0a,0xff,0xff,0x20,0xef,0xff,0xe0,0x00,0x00,0x01,0xef,0xff,0xe0,0x09,0xff,
+0xff,0xc2,0x00,0x02,0xbf,0xff,0xf9,0x00,0x1f,0xff,0xff,0xfd,0xcd,0xff,0xff,0xff,
+0x10,0x00,0x4f,0xff,0x01,0x00,0x40,0x40,0x00,0x00,0x3d,0x08,0x00,0x10,0xfd,0xf7,
+0x00,0x50,0x04,0x9d,0xef,0xed,0xa5,0xd3,0x00,0xf0,0x05,0x02,0xcf,0xc3,0x00,0x0d,
+0xfc,0x00,0x00,0x1e,0xff,0xff,0x71,0x4f,0xfa,0x00,0x00,0x8f,0xfe,0xef,0xff,0x07,
+0x01,0xde,0xdf,0xe1,0x07,0xff,0xff,0xb0,0x00,0x00,0xcd,0x90,0x00,0x3a,0xc8,0x0a,
+0x01,0x8f,0x6f,0xff,0xf2,0x00,0x00,0x4f,0xff,0xf3,0x08,0x00,0x35,0x15,0x5f,0x08,
+0x00,0x11,0xf3,0x08,0x00,0xf2,0x02,0x3f,0xff,0xfa,0x00,0x01,0xcf,0xff,0xf3,0x0f,
+0xff,0xff,0xda,0xbf,0xff,0xff,0xf3,0x09,0xc4,0x00,0xf0,0x00,0xf3,0x00,0xcf,0xff,
+0xff,0xff,0xaf,0xff,0xf3,0x00,0x07,0xcf,0xfe,0xa4,0x0f,0x2d,0x00,0x50,0x89,0x99,
+0x99,0x99,0x99,0x11,0x01,0x10,0x0e,0x21,0x00,0x24,0xfe,0x00,0xd4,0x01,0x2f,0xe0,
+0x00,0x01,0x00,0x0a,0x0f,0xc1,0x01,0x68,0x06,0x13,0x00,0x14,0x2f,0x13,0x00,0xb1,
+0x31,0xff,0xff,0xa0,0x00,0x00,0x00,0xaf,0xff,0xf2,0x0e,0xc3,0x00,0xf1,0x09,0x1e,
+0xff,0xfe,0x00,0x9f,0xff,0xfc,0x20,0x00,0x2b,0xff,0xff,0x90,0x01,0xff,0xff,0xff,
+0xdc,0xdf,0xff,0xff,0xf1,0x00,0x04,0x06,0x01,0x00,0x9f,0x01,0x20,0x03,0xdf,0x09,
+0x00,0x10,0xd3,0xca,0x00,0x50,0x49,0xde,0xfe,0xda,0x50,0x93,0x01,0x00,0x12,0x00,
+0x16,0xf5,0x08,0x00,0x10,0x39,0x19,0x01,0x1f,0x93,0xba,0x01,0x88,0xf1,0x01,0x78,
+0x82,0x00,0x03,0x88,0x60,0x00,0x00,0x00,0x0c,0xff,0x90,0x00,0xaf,0xfc,0x00,0x14,
+0x01,0x51,0xb9,0xcf,0xff,0x60,0x00,0x0b,0x01,0x02,0x13,0x01,0x6f,0x00,0x00,0x5b,
+0xef,0xeb,0x50,0x8e,0x03,0xd5,0x60,0x6f,0xfd,0x00,0x00,0xff,0xf4,0x9e,0x02,0x41,
+0x71,0x19,0xff,0xf1,0x4e,0x00,0x32,0xff,0xff,0x90,0x0f,0x01,0x11,0xf8,0xaf,0x03,
+0x3f,0x68,0x86,0x10,0x8e,0x03,0x89,0x34,0x00,0x00,0x01,0x95,0x00,0x32,0x7f,0xff,
+0x70,0x09,0x00,0x32,0x8f,0xb6,0xbf,0x0a,0x00,0x42,0x0e,0xe0,0x00,0xfe,0x13,0x00,
+0x32,0xed,0x00,0x0e,0xa0,0x03,0x42,0x09,0xf8,0x28,0xf9,0x13,0x00,0x11,0x0b,0x3f,
+0x01,0x01,0xe4,0x00,0x1f,0x42,0xe7,0x01,0xcd,0x06,0xdc,0x00,0x30,0xcf,0xfc,0x20,
+0x08,0x00,0x41,0x1f,0xe6,0x7f,0xe0,0x34,0x01,0x31,0x60,0x08,0xf5,0x08,0x00,0x21,
+0x50,0x06,0x08,0x00,0x51,0x2f,0xd3,0x4e,0xf1,0x00,0xb0,0x06,0x22,0xfe,0x40,0x31,
+0x00,0x1f,0x30,0xf7,0x01,0x83,0x60,0x06,0xaa,0xa3,0x05,0xaa,0xa4,0xbd,0x01,0x50,
+0xff,0xfb,0x03,0xff,0xfb,0x9e,0x00,0x41,0xbf,0xfd,0x10,0xdf,0xd5,0x03,0x61,0x5f,
+0xff,0x30,0xaf,0xfd,0x10,0xd6,0x04,0x4f,0x60,0x6f,0xfe,0x20,0xcb,0x03,0xd3,0x00,
+0xd4,0x00,0x30,0xfa,0x03,0xff,0x01,0x01,0x60,0xdf,0xfd,0x01,0xef,0xfd,0x10,0x59,
+0x00,0xc0,0x20,0xbf,0xfe,0x10,0x00,0x00,0x2f,0xff,0x50,0x7f,0xfe,0x20,0x34,0x01,
+0x4e,0x70,0x19,0xaa,0x30,0x0d,0x01,0x40,0x06,0xff,0xff,0x20,0xeb,0x05,0x14,0x30,
+0x98,0x01,0x0f,0x11,0x00,0x31,0x14,0x05,0x11,0x00,0x04,0xdd,0x01,0x10,0x03,0x60,
+0x05,0x44,0x1c,0xff,0xff,0x30,0xde,0x01,0x22,0x00,0x9f,0xcf,0x00,0x15,0x30,0xdf,
+0x01,0x8f,0x00,0x7c,0xff,0xea,0x40,0xff,0xff,0x30,0x2c,0x07,0x8d,0x1e,0xff,0x2c,
+0x07,0x14,0xe2,0x2c,0x07,0x14,0xf3,0x2c,0x07,0x12,0xc2,0x2c,0x07,0x14,0xff,0x96,
+0x04,0x11,0x0a,0x58,0x05,0x01,0x2f,0x08,0x13,0xf7,0x09,0x00,0x44,0x0d,0xff,0xfc,
+0xc0,0xbc,0x04,0x13,0xff,0x14,0x00,0x3f,0x7d,0xfe,0x90,0x69,0x03,0x6c,0x12,0x9f,
+0x69,0x03,0x22,0xa3,0x1f,0x60,0x05,0x42,0x00,0xcf,0xfb,0x20,0xc0,0x00,0x02,0x1f,
+0x07,0x33,0x0f,0xff,0x60,0x08,0x00,0x21,0xfd,0xb0,0x52,0x05,0x04,0xfb,0x08,0x32,
+0x8d,0xfd,0x80,0xc3,0x00,0x27,0x38,0x85,0x5d,0x02,0x15,0x05,0x01,0x01,0x12,0x00,
+0x34,0x08,0x15,0xf8,0x0d,0x00,0x41,0x07,0xff,0xf5,0x3e,0x6e,0x01,0x02,0xb6,0x05,
+0x6f,0xff,0x40,0x02,0xef,0xf9,0x00,0x01,0x00,0x0c,0x10,0x5f,0x6a,0x08,0x40,0x01,
+0xff,0xff,0x20,0xc8,0x00,0x41,0xf5,0x1f,0xff,0xf8,0x62,0x00,0x10,0x50,0x42,0x01,
+0x20,0xf2,0x0e,0x08,0x04,0x11,0x08,0xc0,0x06,0x40,0xaf,0xff,0xe0,0x0a,0xad,0x01,
+0x11,0x0c,0x6c,0x0b,0x40,0xdf,0xff,0xa0,0x06,0x40,0x03,0x20,0x0f,0xff,0xe4,0x06,
+0x40,0xff,0xff,0x70,0x03,0x45,0x03,0x10,0x4f,0xd9,0x08,0x10,0x03,0x80,0x02,0x00,
+0xa3,0x00,0x10,0x8f,0x9a,0x00,0x10,0x06,0x87,0x01,0xc0,0xbf,0xff,0xb0,0x00,0xcf,
+0xff,0xef,0xfc,0x00,0x0a,0xff,0xfc,0x97,0x00,0xa0,0xe0,0x00,0xff,0xfb,0xaf,0xff,
+0x00,0x0d,0xff,0xf8,0x74,0x00,0x50,0xf1,0x03,0xff,0xf7,0x6f,0xc5,0x02,0x10,0xf4,
+0x03,0x01,0xa0,0xf4,0x07,0xff,0xf3,0x2f,0xff,0x70,0x3f,0xff,0xf1,0xce,0x01,0xa0,
+0xf7,0x0b,0xff,0xf0,0x0e,0xff,0xb0,0x6f,0xff,0xd0,0x17,0x01,0xa1,0xfa,0x0f,0xff,
+0xb0,0x0a,0xff,0xe0,0x9f,0xff,0x90,0x50,0x05,0x61,0x3f,0xff,0x70,0x06,0xff,0xf2,
+0x6e,0x08,0x90,0x02,0xff,0xff,0x8f,0xff,0x30,0x02,0xff,0xf6,0xc8,0x00,0x00,0x3f,
+0x0a,0x83,0xef,0xfe,0x00,0x00,0xef,0xfc,0xff,0xfe,0x89,0x08,0x14,0xfb,0x06,0x00,
+0x01,0x19,0x02,0x11,0xf7,0x37,0x01,0x12,0xf7,0x45,0x0a,0x20,0xff,0xf3,0xd0,0x03,
+0x02,0x9a,0x01,0x10,0x0f,0x7a,0x01,0x00,0x87,0x0a,0x31,0xf0,0x00,0x00,0xeb,0x00,
+0x11,0xb0,0x44,0x04,0x01,0x53,0x02,0x11,0x08,0x77,0x01,0x24,0x06,0xff,0x60,0x01,
+0x37,0x03,0xef,0xf8,0x44,0x01,0x25,0xff,0x90,0xfb,0x03,0x35,0xf8,0xef,0xfa,0x81,
+0x01,0x20,0x50,0x1c,0x43,0x00,0x00,0x54,0x07,0x6f,0x66,0x63,0x00,0x00,0x66,0x63,
+0x88,0x01,0x08,0x71,0x7f,0xff,0xe0,0x00,0x01,0xff,0xf8,0x09,0x00,0x70,0x2f,0xff,
+0xf1,0x00,0x05,0xff,0xfc,0xb5,0x00,0x60,0xa0,0x0e,0xff,0xf4,0x00,0x09,0x6c,0x01,
+0x60,0xdf,0xff,0x60,0x0a,0xff,0xf8,0x9e,0x00,0x10,0x50,0xaf,0x01,0x30,0x06,0xff,
+0xfb,0xbe,0x00,0x80,0xa0,0x04,0xff,0xfd,0x00,0x02,0xff,0xfe,0xd8,0x00,0x40,0xe0,
+0x07,0xff,0xf9,0xfd,0x00,0x80,0x10,0xcf,0xfd,0xff,0xf3,0x0b,0xff,0xf5,0x40,0x00,
+0x80,0x51,0xff,0xf5,0xef,0xf8,0x0e,0xff,0xf1,0xf3,0x00,0x80,0x85,0xff,0xf1,0x9f,
+0xfd,0x1f,0xff,0xd0,0xf1,0x00,0x80,0xba,0xff,0xc0,0x5f,0xff,0x7f,0xff,0x90,0xef,
+0x00,0x82,0xee,0xff,0x70,0x0f,0xff,0xef,0xff,0x50,0xae,0x08,0x21,0x20,0x0b,0x1b,
+0x05,0x00,0xeb,0x00,0x12,0xfd,0x05,0x00,0x01,0x60,0x01,0x10,0xf8,0x05,0x00,0x12,
+0xf9,0x9d,0x0b,0x10,0xf4,0x02,0x02,0x12,0xf5,0x5c,0x01,0x10,0xf0,0xe8,0x00,0x12,
+0xf1,0x8b,0x02,0x10,0xa0,0x51,0x01,0x12,0xd0,0xd0,0x00,0x26,0x47,0x73,0x0d,0x05,
+0x15,0x30,0x94,0x03,0x14,0xf3,0xa8,0x02,0x32,0x8f,0xff,0x30,0x13,0x00,0x22,0x50,
+0x07,0x15,0x00,0x68,0x44,0x42,0x00,0x00,0x34,0x43,0x12,0x01,0x32,0xbf,0xff,0xf6,
+0x63,0x00,0x21,0xf7,0x2f,0x85,0x00,0x20,0x01,0xff,0x84,0x02,0x21,0xff,0x50,0x22,
+0x03,0x21,0x60,0x02,0x98,0x01,0x10,0x1f,0x1a,0x00,0x30,0x9f,0xff,0xf4,0x85,0x00,
+0x10,0xf5,0x0f,0x00,0x10,0xfb,0xa0,0x00,0x11,0xc0,0xaf,0x01,0x21,0x30,0x07,0xda,
+0x05,0x20,0x00,0xef,0x45,0x01,0x03,0xfc,0x01,0x11,0xf2,0xb1,0x03,0x00,0xf5,0x00,
+0x43,0xf9,0xdf,0xff,0xa0,0x9f,0x00,0x02,0x35,0x02,0x00,0xd4,0x00,0x13,0xff,0x2f,
+0x03,0x11,0x4f,0xd8,0x02,0x03,0x05,0x02,0x03,0xf1,0x01,0x12,0x08,0x4e,0x00,0x0f,
+0x0a,0x00,0x36,0x11,0xbf,0x52,0x07,0x00,0x36,0x04,0x01,0x52,0x07,0x40,0x01,0xdf,
+0xfc,0x9f,0x09,0x00,0xfe,0x00,0x02,0xef,0xfb,0x00,0x7f,0xfe,0x30,0x00,0x00,0x56,
+0x65,0x00,0x00,0x46,0x65,0x29,0x02,0x11,0x0c,0x9e,0x01,0x60,0xff,0xff,0xd0,0x6f,
+0xff,0xf5,0xaa,0x00,0x20,0xf7,0x01,0x4f,0x05,0x00,0x23,0x02,0x32,0x0b,0xff,0xff,
+0xfe,0x00,0x70,0x5f,0xff,0xf4,0x00,0x2f,0xff,0xf6,0x0d,0x00,0x20,0x90,0x07,0x2f,
+0x00,0x52,0x09,0xff,0xfd,0x00,0xcf,0x9f,0x01,0x41,0xf2,0x1f,0xff,0xf5,0xec,0x00,
+0x31,0x76,0xff,0xfe,0x90,0x00,0x21,0xfc,0xbf,0xbd,0x02,0x23,0x2f,0xff,0x9e,0x01,
+0x13,0xcf,0x84,0x0d,0x22,0x06,0xff,0xfb,0x00,0x00,0x2f,0x07,0x13,0xf2,0x91,0x01,
+0x1a,0xfc,0x82,0x04,0x13,0x2f,0x26,0x01,0x11,0x07,0x5f,0x01,0x00,0xbc,0x00,0x01,
+0xcb,0x04,0x23,0x01,0xac,0xc2,0x04,0x22,0x2f,0xff,0xc3,0x01,0x14,0x02,0x59,0x01,
+0x80,0x1d,0xfe,0xc5,0x00,0x00,0x00,0x00,0x00,0xf0,0x03,0x00,0x00,0x4c,0xd6,0x00,
+0x00,0x8d,0xb2,0x00,0x00,0x00,0x00,0xef,0xff,0x20,0x04,0xff,0xfc,0x0a,0x00,0x42,
+0xff,0xff,0x20,0x05,0x0a,0x00,0x7f,0x5e,0xe8,0x00,0x00,0x9f,0xd3,0x00,0x01,0x00,
+0x02,0x30,0xbf,0xff,0xf6,0x07,0x00,0xf0,0x0f,0xaf,0xff,0xf7,0x2f,0xff,0xfd,0x00,
+0x00,0x00,0x01,0xff,0xff,0xe0,0x0a,0xff,0xff,0x50,0x00,0x00,0x09,0xff,0xff,0x60,
+0x02,0xff,0xff,0xc0,0x00,0x00,0x1f,0x1a,0x00,0x80,0x9f,0xff,0xf4,0x00,0x00,0x8f,
+0xff,0xf5,0x0f,0x00,0x40,0xfb,0x00,0x00,0xef,0x19,0x00,0x81,0x08,0xff,0xff,0x30,
+0x07,0xff,0xff,0x40,0x78,0x00,0x40,0xa0,0x0e,0xff,0xfb,0x4b,0x00,0x60,0x7f,0xff,
+0xf2,0x5f,0xff,0xf3,0x0a,0x00,0x60,0x0e,0xff,0xf9,0xdf,0xff,0xa0,0x0a,0x00,0x61,
+0x06,0xff,0xff,0xff,0xff,0x20,0x71,0x00,0x42,0xdf,0xff,0xff,0xf9,0x7b,0x00,0x42,
+0x4f,0xff,0xff,0xf1,0x0a,0x00,0x42,0x0c,0xff,0xff,0x80,0x0a,0x00,0x12,0x08,0x4e,
+0x00,0x0f,0x0a,0x00,0x36,0x51,0x00,0x06,0xcc,0xcc,0x30,0x09,0x00,0x34,0x2f,0xff,
+0xf7,0xf2,0x00,0x22,0x90,0x00,0x94,0x00,0x12,0xfa,0x11,0x00,0x3e,0x1e,0xff,0xc0,
+0x1b,0x01,0x02,0xaa,0x00,0x01,0x01,0x00,0x1d,0xf3,0x09,0x00,0x83,0xf2,0x9b,0xbb,
+0xbb,0xbb,0xbb,0xbe,0xff,0x4a,0x00,0x34,0x3f,0xff,0xfd,0x32,0x00,0x01,0xf8,0x00,
+0x00,0x3b,0x01,0x11,0x70,0x09,0x00,0x12,0x5f,0x13,0x01,0x54,0x00,0x01,0xef,0xff,
+0xe1,0xea,0x00,0x02,0x9a,0x00,0x13,0x8f,0x06,0x01,0x43,0x03,0xff,0xff,0xd0,0x86,
+0x00,0x03,0x21,0x01,0x12,0xaf,0x92,0x01,0x00,0x34,0x01,0x13,0xb0,0xba,0x00,0x23,
+0xfe,0x10,0x5f,0x00,0x14,0xf4,0x5f,0x00,0x14,0x80,0x42,0x01,0x10,0xbb,0x01,0x00,
+0x14,0xb5,0x99,0x00,0x1d,0xf7,0x09,0x00,0x00,0xf5,0x00,0x13,0x04,0x30,0x00,0x12,
+0xdf,0xb0,0x00,0x12,0x8f,0x58,0x00,0x12,0x3f,0xf7,0x00,0x3d,0x09,0xcc,0xb1,0xfa,
+0x00,0x12,0x09,0x3c,0x00,0x22,0xf0,0x9f,0x08,0x00,0x03,0x0f,0x00,0x82,0xe0,0x59,
+0x99,0x99,0x9a,0xff,0xff,0xf4,0x44,0x00,0x12,0xf8,0x81,0x00,0x12,0xfc,0xbc,0x00,
+0x22,0xfe,0x20,0xdd,0x00,0x12,0x50,0x7e,0x01,0x12,0x90,0x76,0x00,0x12,0xc0,0xfb,
+0x00,0x10,0xf2,0x24,0x00,0x36,0xcf,0xff,0xf5,0xf8,0x00,0x00,0xba,0x00,0x5a,0xa9,
+0x99,0x99,0x99,0x1d,0x59,0x01,0x13,0x3d,0x0f,0x00,0x00,0x22,0x00,0x13,0x21,0x8c,
+0x00,0x14,0x1d,0x1b,0x02,0x43,0x6f,0xff,0xf0,0x00,0x55,0x01,0x03,0x09,0x00,0x3f,
+0x0a,0xfe,0x50,0xb9,0x01,0xca,0x22,0x05,0xef,0xa7,0x00,0x02,0x57,0x01,0x23,0x00,
+0x1f,0x60,0x00,0x22,0x9f,0xfc,0xb5,0x00,0x2f,0x12,0x00,0xb9,0x01,0x7f,0x70,0x07,
+0x88,0x60,0x00,0x17,0x88,0x60,0x45,0x00,0x51,0xf8,0x01,0xdf,0xfe,0x20,0x32,0x00,
+0x33,0x9d,0xff,0xd1,0x32,0x01,0x12,0xfc,0x10,0x01,0x3f,0x3e,0xff,0xb0,0xb9,0x01,
+0xc8,0xe2,0x07,0xff,0xf6,0x00,0x2e,0xff,0xd1,0x00,0x06,0xff,0xf6,0x3e,0xff,0xc1,
+0xfd,0x04,0x00,0x58,0x00,0x22,0x05,0xff,0x0d,0x05,0x3f,0x04,0x77,0x60,0xb9,0x01,
+0x7f,0xf0,0x07,0x03,0x9d,0xff,0xd5,0x00,0x7f,0xff,0xff,0xf6,0x04,0xff,0xff,0xff,
+0xf4,0x0c,0xff,0xff,0xda,0xb2,0x0f,0xff,0xfb,0x0b,0x01,0x10,0xf6,0x05,0x00,0x1f,
+0xf5,0x05,0x00,0x3f,0x50,0x2f,0xff,0xf5,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -1213,11 +1719,29 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 192, .range_length = 192, .glyph_id_start = 97, .list_length = 0, .type = 2, .unicode_list = 0, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[62096] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 2902, .size = 4072, .comp_size = 2691 },
+{ .bitmap_start = 4072, .comp_offset = 5593, .size = 3930, .comp_size = 2114 },
+{ .bitmap_start = 8002, .comp_offset = 7707, .size = 4071, .comp_size = 2204 },
+{ .bitmap_start = 12073, .comp_offset = 9911, .size = 3878, .comp_size = 2032 },
+{ .bitmap_start = 15951, .comp_offset = 11943, .size = 3907, .comp_size = 1417 },
+{ .bitmap_start = 19858, .comp_offset = 13360, .size = 4077, .comp_size = 1490 },
+{ .bitmap_start = 23935, .comp_offset = 14850, .size = 3977, .comp_size = 1660 },
+{ .bitmap_start = 27912, .comp_offset = 16510, .size = 3957, .comp_size = 1422 },
+{ .bitmap_start = 31869, .comp_offset = 17932, .size = 3958, .comp_size = 1615 },
+{ .bitmap_start = 35827, .comp_offset = 19547, .size = 4088, .comp_size = 1185 },
+{ .bitmap_start = 39915, .comp_offset = 20732, .size = 3823, .comp_size = 1448 },
+{ .bitmap_start = 43738, .comp_offset = 22180, .size = 4058, .comp_size = 1709 },
+{ .bitmap_start = 47796, .comp_offset = 23889, .size = 3894, .comp_size = 1352 },
+{ .bitmap_start = 51690, .comp_offset = 25241, .size = 4041, .comp_size = 1536 },
+{ .bitmap_start = 55731, .comp_offset = 26777, .size = 1723, .comp_size = 561 },
+};
+
+static uint8_t etxUncompBuf[4642] __SDRAMFONTS;
 
 const etxLz4Font lv_font_en_bold_XL = {
-.uncomp_size = 61864,
-.comp_size = 19243,
+.uncomp_size = 4410,
+.comp_size = 2902,
 .line_height = 40,
 .base_line = 9,
 .subpx = 0,
@@ -1230,12 +1754,13 @@ const etxLz4Font lv_font_en_bold_XL = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 38,
-.glyph_bitmap = 2312,
-.class_pair_values = 59766,
-.left_class_mapping = 61286,
-.right_class_mapping = 61575,
+.class_pair_values = 2312,
+.left_class_mapping = 3832,
+.right_class_mapping = 4121,
+.block_num = 15,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 62096,
+.lvglFontBufSize = 4642,
 };
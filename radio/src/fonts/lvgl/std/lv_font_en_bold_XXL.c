@@ -43,1108 +43,1361 @@ static const uint8_t lz4FontData[] ={
 0x23,0x1e,0x23,0x03,0x00,0x19,0xca,0x30,0x24,0x21,0x24,0x02,0xff,0x6b,0xcc,0x10,
 0x24,0x1f,0x30,0x03,0xf3,0x53,0xcf,0x30,0x24,0x1f,0x30,0x02,0xf3,0x3b,0xd2,0x60,
 0x17,0x14,0x23,0x03,0x00,0x99,0xd3,0xf0,0x20,0x1e,0x24,0x01,0xff,0xb5,0xd5,0xa0,
-0x15,0x15,0x2c,0x00,0xff,0x83,0xd7,0xd0,0x38,0x00,0xf0,0x4e,0xff,0x90,0xd9,0x60,
+0x15,0x15,0x2c,0x00,0xff,0x83,0xd7,0xd0,0x38,0x00,0xf8,0x43,0xff,0x90,0xd9,0x60,
 0x20,0x20,0x22,0x00,0x00,0xb0,0xdb,0x10,0x2f,0x2f,0x22,0x00,0x00,0xcf,0xde,0x90,
 0x20,0x21,0x22,0x00,0x00,0x00,0xe1,0x20,0x20,0x21,0x30,0x00,0xf2,0x18,0xe4,0x90,
 0x20,0x1d,0x22,0x02,0x00,0x05,0xe6,0x20,0x15,0x14,0x3f,0x01,0xf4,0x7b,0xe8,0x30,
 0x10,0x06,0x37,0x05,0xf7,0x20,0xe9,0x20,0x15,0x13,0x3f,0x01,0xf4,0x77,0xeb,0x80,
-0x29,0x24,0x0f,0x03,0x0c,0x85,0xec,0xe0,0x18,0x12,0x12,0x03,0x1d,0x0e,0xff,0xff,
-0xff,0xff,0xb0,0xdf,0xff,0xff,0xff,0xfa,0x0d,0x0b,0x00,0x70,0xa0,0xcf,0xff,0xff,
-0xff,0xf9,0x0c,0x0b,0x00,0x70,0x90,0xbf,0xff,0xff,0xff,0xf8,0x0b,0x0b,0x00,0x70,
-0x80,0xaf,0xff,0xff,0xff,0xf7,0x0a,0x0b,0x00,0x70,0x60,0x9f,0xff,0xff,0xff,0xf6,
-0x08,0x0b,0x00,0x70,0x50,0x8f,0xff,0xff,0xff,0xf5,0x07,0x0b,0x00,0x70,0x40,0x7f,
-0xff,0xff,0xff,0xf4,0x06,0x0b,0x00,0x70,0x30,0x6f,0xff,0xff,0xff,0xf3,0x05,0x0b,
-0x00,0x70,0x20,0x5f,0xff,0xff,0xff,0xf2,0x04,0x0b,0x00,0x70,0x10,0x4f,0xff,0xff,
-0xff,0xf1,0x03,0x0b,0x00,0x71,0x00,0x3f,0xff,0xff,0xff,0xf0,0x02,0x0b,0x00,0x10,
-0x2f,0x0b,0x00,0xf0,0x07,0x01,0xff,0xff,0xff,0xfe,0x00,0x1f,0xff,0xff,0xff,0xd0,
-0x00,0xff,0xff,0xff,0xfd,0x00,0x0f,0xff,0xff,0xff,0xc0,0x0b,0x00,0x30,0xfc,0x00,
-0x0e,0x9f,0x00,0x70,0x00,0xef,0xff,0xff,0xfb,0x00,0x0d,0x9f,0x00,0x1f,0x00,0x01,
-0x00,0x04,0xb0,0x02,0x20,0x00,0x00,0x01,0xaf,0xff,0xf9,0x00,0x01,0xef,0x37,0x00,
-0x01,0xb0,0x00,0x10,0x0f,0x63,0x00,0x20,0xd1,0xff,0x01,0x00,0x01,0x0b,0x00,0x11,
-0xe0,0xdc,0x00,0x11,0x04,0x9a,0x00,0xb0,0x05,0xef,0xff,0xfd,0x30,0x00,0x00,0x57,
-0x74,0x00,0x00,0xca,0x00,0x80,0x00,0xdf,0xff,0xff,0x7f,0xff,0xff,0xf5,0x65,0x00,
-0x1f,0xf7,0x11,0x00,0x01,0x13,0x40,0x11,0x00,0x10,0xf3,0x11,0x00,0x10,0xf5,0xd1,
-0x00,0x00,0x11,0x00,0x40,0x4f,0xff,0xff,0xf0,0x11,0x00,0x10,0xf2,0xc1,0x00,0x00,
-0x11,0x00,0x40,0x1f,0xff,0xff,0xd0,0x11,0x00,0x40,0xf0,0xff,0xff,0xfb,0x11,0x00,
-0x50,0xfe,0x0f,0xff,0xff,0xa0,0x11,0x00,0x40,0xc0,0xff,0xff,0xf8,0x11,0x00,0x50,
-0xfb,0x0f,0xff,0xff,0x70,0x11,0x00,0x40,0x90,0xff,0xff,0xf5,0x11,0x00,0x50,0xf8,
-0x0f,0xff,0xff,0x30,0x11,0x00,0x40,0x60,0xff,0xff,0xf2,0x11,0x00,0xa2,0xf5,0x07,
-0x77,0x77,0x00,0x00,0x05,0x77,0x77,0x10,0xda,0x00,0x10,0x3f,0x31,0x00,0x20,0x00,
-0x7f,0x26,0x00,0x02,0x01,0x00,0x70,0x06,0xff,0xff,0xf4,0x00,0x00,0x0a,0x7b,0x00,
-0x03,0x01,0x00,0x40,0x9f,0xff,0xff,0x10,0x3b,0x00,0x14,0xfd,0x11,0x00,0x50,0x0c,
-0xff,0xff,0xe0,0x00,0x47,0x01,0x14,0xb0,0x12,0x00,0x01,0x90,0x00,0x11,0x03,0x85,
-0x00,0x01,0x01,0x00,0x00,0x6f,0x01,0x40,0x90,0x00,0x00,0x5f,0xeb,0x00,0x02,0x01,
-0x00,0x71,0x04,0xff,0xff,0xf6,0x00,0x00,0x08,0x86,0x00,0x02,0x01,0x00,0x02,0x74,
-0x00,0x34,0xbf,0xff,0xff,0x11,0x00,0x02,0x74,0x00,0x10,0x0e,0xe4,0x00,0x03,0x01,
-0x00,0x01,0x74,0x00,0x44,0x01,0xff,0xff,0xfa,0x11,0x00,0x11,0x0f,0xa4,0x01,0x11,
-0x4f,0xb4,0x00,0x02,0x99,0x01,0x01,0x74,0x00,0x02,0xb4,0x00,0x02,0x01,0x00,0x02,
-0x74,0x00,0x02,0xb4,0x00,0x00,0x53,0x00,0x09,0x01,0x00,0x3b,0xfe,0x00,0xaf,0x12,
-0x00,0x1f,0xe0,0x23,0x00,0x22,0xf8,0x02,0x58,0x88,0x88,0x8b,0xff,0xff,0xfa,0x88,
-0x88,0x8d,0xff,0xff,0xf8,0x88,0x88,0x88,0x70,0x28,0x01,0x17,0xfe,0x28,0x01,0x1a,
-0xf0,0x28,0x01,0x34,0xef,0xff,0xfc,0xb4,0x00,0x0f,0x28,0x01,0x0d,0x17,0xf3,0x28,
-0x01,0x19,0x40,0x28,0x01,0x77,0x09,0xff,0xff,0xf1,0x00,0x00,0x0d,0x28,0x01,0x11,
-0xcf,0x74,0x00,0x03,0x28,0x01,0xfb,0x04,0x07,0x77,0x77,0x77,0x7f,0xff,0xff,0xe7,
-0x77,0x77,0x8f,0xff,0xff,0xc7,0x77,0x77,0x73,0x00,0xff,0x01,0x00,0x2b,0x80,0x0f,
-0x11,0x00,0x1f,0xf8,0x23,0x00,0x22,0x08,0xf9,0x01,0x14,0xf7,0x8b,0x00,0x11,0x2f,
-0x19,0x00,0x11,0x6f,0xb4,0x00,0x01,0x01,0x00,0x11,0x05,0xd1,0x00,0x17,0x09,0xf9,
-0x01,0x11,0x8f,0xf9,0x01,0x16,0xcf,0xd1,0x00,0x14,0x0b,0xf9,0x01,0x1c,0xc0,0xf9,
-0x01,0x1d,0xf9,0xf9,0x01,0x13,0x60,0x11,0x00,0x02,0x6d,0x02,0x17,0x07,0xf9,0x01,
-0x10,0x6f,0x45,0x01,0x00,0xbd,0x01,0x03,0xda,0x02,0x03,0x6d,0x02,0x02,0xad,0x02,
-0x02,0x01,0x00,0x02,0x45,0x01,0x01,0xb4,0x00,0x02,0x01,0x00,0x02,0x6d,0x02,0x11,
-0x2f,0x85,0x01,0x01,0x01,0x00,0x02,0x6d,0x02,0x02,0xb4,0x00,0x07,0x01,0x00,0x24,
-0x01,0x11,0x55,0x00,0x05,0xb7,0x01,0x0f,0x10,0x00,0x4a,0x19,0x3f,0x10,0x00,0x20,
-0x38,0xdf,0xb8,0x04,0x14,0x92,0x0f,0x00,0x13,0x3c,0x81,0x01,0x15,0xc3,0x0f,0x02,
-0x03,0x01,0x00,0x14,0x70,0xe5,0x00,0x03,0x01,0x00,0x13,0xf9,0x56,0x03,0x09,0xb3,
-0x01,0x17,0x7f,0x10,0x00,0x11,0xf4,0xf1,0x00,0x06,0x01,0x00,0x10,0xfd,0x52,0x01,
-0x00,0x01,0x00,0x51,0x72,0x00,0x39,0xff,0xff,0xa9,0x04,0x01,0xb7,0x05,0x21,0xe2,
-0x00,0x7c,0x01,0x00,0xa1,0x01,0x12,0x1f,0x17,0x00,0x03,0x29,0x00,0x11,0xf1,0x6e,
-0x05,0x02,0xf1,0x02,0x02,0x51,0x00,0x24,0x5f,0xff,0x5f,0x01,0x01,0x25,0x05,0x00,
-0x96,0x01,0x03,0xbf,0x03,0x11,0x7f,0x92,0x00,0x06,0x20,0x00,0x11,0x5f,0x1a,0x00,
-0x06,0x40,0x00,0x52,0x28,0x88,0x88,0x88,0x85,0x60,0x00,0x04,0xe5,0x01,0x02,0x44,
-0x03,0x07,0x0c,0x03,0x04,0xa0,0x00,0x16,0x70,0x9a,0x01,0x11,0xef,0xb9,0x00,0x06,
-0x32,0x00,0x12,0x6f,0xa3,0x03,0x17,0x81,0x56,0x04,0x01,0x01,0x00,0x17,0xa3,0x05,
-0x02,0x01,0x01,0x00,0x2b,0xb3,0x00,0x40,0x01,0x13,0xa1,0x11,0x00,0x14,0x5e,0x11,
-0x00,0x16,0x50,0xb1,0x02,0x03,0x04,0x03,0x03,0x74,0x00,0x13,0x7e,0x11,0x00,0x14,
-0x90,0x54,0x00,0x12,0x5c,0x10,0x00,0x06,0x35,0x02,0x12,0x29,0x11,0x00,0x06,0x36,
-0x02,0x1a,0x19,0x31,0x00,0x03,0x50,0x01,0x16,0xf0,0x10,0x00,0x11,0x05,0x40,0x01,
-0x53,0x04,0x44,0x44,0x44,0x43,0xd5,0x03,0x00,0x40,0x01,0x11,0x1f,0xc8,0x06,0x06,
-0x40,0x01,0x16,0x0f,0x10,0x00,0x01,0x40,0x01,0x11,0x0e,0x14,0x07,0x06,0x10,0x00,
-0x02,0x50,0x07,0x06,0x30,0x00,0x01,0x4a,0x07,0x12,0xe1,0x54,0x03,0x00,0xc2,0x00,
-0x24,0x03,0xff,0x80,0x01,0x12,0x07,0xb0,0x01,0x13,0xdf,0x4a,0x02,0x22,0x01,0x8f,
-0x90,0x00,0x11,0x5f,0xa8,0x00,0x33,0xda,0x89,0xbf,0xb0,0x00,0x19,0x0c,0xf4,0x03,
-0x13,0x10,0x70,0x01,0x16,0xff,0xf0,0x00,0x17,0x3e,0x10,0x00,0x10,0x90,0x92,0x05,
-0x06,0x21,0x00,0x14,0xf7,0x87,0x03,0x03,0x5e,0x02,0x03,0x13,0x04,0x31,0x28,0xdf,
-0xff,0x86,0x00,0x15,0x50,0x5e,0x07,0x58,0x68,0xef,0xff,0xfb,0x74,0x62,0x03,0x16,
-0xbf,0xd7,0x03,0x0f,0x10,0x00,0x3f,0x3d,0x46,0x77,0x53,0xe1,0x07,0x10,0x3b,0x92,
-0x00,0x05,0x34,0x02,0x09,0xf8,0x01,0x1a,0xf5,0x15,0x00,0x1c,0xaf,0xeb,0x01,0x08,
-0x22,0x02,0x1b,0xf3,0xd5,0x03,0x43,0xff,0xfd,0xdf,0xff,0xd7,0x04,0x25,0x05,0x10,
-0xc0,0x02,0x30,0x80,0x00,0x2c,0x25,0x08,0x01,0xc6,0x04,0x14,0x81,0xec,0x01,0x11,
-0x90,0x8e,0x04,0x12,0xf7,0xaa,0x01,0x13,0xf7,0x9d,0x04,0x12,0xf2,0xc8,0x01,0x12,
-0x90,0x07,0x00,0x13,0x50,0x67,0x03,0x02,0x2e,0x02,0x12,0xfa,0x6e,0x05,0x13,0xb0,
-0x1f,0x05,0x12,0xf0,0x03,0x02,0x11,0xb0,0x4f,0x05,0x29,0xf2,0x00,0x2b,0x00,0x11,
-0xfb,0x06,0x00,0x2a,0xf7,0x00,0x2b,0x00,0x10,0xa0,0xcd,0x01,0x14,0xfd,0x99,0x06,
-0x21,0xff,0x30,0xab,0x01,0x11,0xf9,0xc8,0x06,0x14,0x40,0x98,0x05,0x12,0xfb,0x62,
-0x03,0x10,0x60,0xa8,0x03,0x15,0xa0,0x61,0x03,0x40,0xfb,0x30,0x05,0xdf,0x65,0x00,
-0x14,0x0d,0x5c,0x02,0x24,0x00,0x00,0xf6,0x01,0x36,0xfa,0x00,0x07,0x1d,0x01,0x14,
-0x05,0x31,0x07,0x30,0x20,0x02,0xff,0xfa,0x06,0x19,0x00,0x11,0x02,0x32,0x40,0x00,
-0xbf,0x06,0x01,0x07,0x2c,0x00,0x20,0xfd,0x20,0x9a,0x00,0x16,0x80,0xdf,0x03,0x5a,
-0x7c,0xff,0xff,0xff,0xb5,0x16,0x08,0x00,0x17,0x00,0x22,0x24,0x32,0xba,0x03,0x0a,
-0xe7,0x01,0x03,0x19,0x06,0x1d,0xfa,0xc1,0x09,0x00,0x96,0x07,0x1d,0x10,0x15,0x00,
-0x19,0x7f,0x6a,0x04,0x06,0xc1,0x06,0x1d,0xc0,0x15,0x00,0x02,0x53,0x01,0x59,0x49,
-0xce,0xfe,0xda,0x50,0xb2,0x03,0x40,0xf8,0x00,0x03,0xcf,0xb7,0x00,0x36,0xe5,0x00,
-0x00,0xe3,0x07,0x14,0xfe,0xf8,0x00,0x05,0xbe,0x06,0x01,0x53,0x01,0x1b,0x04,0x46,
-0x04,0x02,0x53,0x01,0x1a,0xef,0x3a,0x02,0x00,0x53,0x01,0x10,0xf1,0x99,0x00,0x45,
-0xfd,0x75,0x6c,0xff,0x39,0x08,0x01,0x53,0x01,0x11,0x0d,0x8e,0x01,0x15,0x09,0x00,
-0x04,0x10,0x01,0x53,0x01,0x12,0x01,0x49,0x02,0x15,0x0e,0x0a,0x01,0x10,0xbf,0xc9,
-0x01,0x12,0x3f,0x2e,0x01,0x14,0xaf,0xe0,0x00,0x10,0x5f,0x43,0x02,0x12,0x04,0xf9,
-0x03,0x14,0x08,0x09,0x02,0x11,0x0e,0x19,0x07,0x12,0x4f,0x65,0x00,0x13,0x8f,0x75,
-0x01,0x11,0x09,0xf0,0x02,0x06,0x2b,0x00,0x13,0xf8,0x53,0x01,0x12,0xfb,0xb0,0x00,
-0x12,0xc0,0xcc,0x00,0x13,0x70,0xb4,0x02,0x11,0x10,0xcd,0x08,0x12,0xff,0x21,0x01,
-0x13,0xf5,0x53,0x01,0x12,0x70,0x65,0x02,0x12,0xf7,0x5c,0x06,0x10,0x30,0xe0,0x03,
-0x12,0xaf,0xbd,0x01,0x10,0xaf,0x16,0x00,0x24,0x02,0xcf,0x91,0x07,0x11,0x3c,0xf4,
-0x00,0x01,0x92,0x04,0x25,0xcd,0xff,0x43,0x08,0x19,0x02,0xb6,0x05,0x19,0xfd,0x87,
-0x01,0x04,0x8d,0x04,0x1c,0x20,0x9d,0x01,0x02,0x3a,0x02,0x09,0x01,0x00,0x10,0x04,
-0x99,0x01,0x1d,0xe7,0xca,0x01,0x46,0x14,0x67,0x75,0x20,0x2c,0x02,0x3b,0x56,0x76,
-0x52,0x20,0x00,0x10,0x3a,0x91,0x01,0x19,0xe9,0x2c,0x02,0x1b,0x1b,0xb8,0x01,0x00,
-0x39,0x00,0x04,0xb7,0x01,0x16,0xb0,0x14,0x00,0x14,0x2e,0xe8,0x04,0x18,0xfb,0x77,
-0x02,0x09,0x2e,0x09,0x06,0xc1,0x06,0x12,0xff,0x3e,0x07,0x05,0x87,0x08,0x00,0x01,
-0x00,0x19,0xef,0x66,0x00,0x10,0x4f,0x38,0x03,0x11,0x50,0x8d,0x06,0x18,0xfd,0x67,
-0x04,0x13,0xf2,0x33,0x01,0x08,0xcf,0x06,0x12,0x90,0x97,0x01,0x05,0x6f,0x06,0x11,
-0xcf,0x5e,0x03,0x02,0x0c,0x07,0x17,0x20,0x8b,0x00,0x13,0x30,0x17,0x06,0x08,0x9f,
-0x00,0x12,0x60,0x44,0x00,0x18,0xfd,0xe0,0x04,0x12,0xb0,0xd8,0x01,0x17,0xf8,0x29,
-0x03,0x22,0xff,0xf2,0xe2,0x00,0x17,0xf2,0x28,0x03,0x22,0xff,0xfb,0xea,0x02,0x19,
-0x90,0x8a,0x01,0x29,0x61,0xbf,0xb8,0x01,0x15,0x02,0xef,0x00,0x28,0xe2,0x00,0x10,
-0x03,0x03,0x19,0x04,0x06,0x14,0x00,0x13,0x1e,0x14,0x00,0x18,0xc1,0xc5,0x01,0x0e,
-0x7b,0x01,0x02,0xde,0x00,0x38,0xff,0xfe,0x40,0x13,0x00,0x17,0x1a,0x70,0x06,0x04,
-0x78,0x00,0x13,0xdf,0x66,0x04,0x00,0x1f,0x00,0x44,0xaa,0xaa,0xaa,0x50,0x74,0x07,
-0x03,0x8a,0x00,0x12,0x3f,0x47,0x08,0x15,0x04,0x9e,0x06,0x12,0x10,0x20,0x00,0x12,
-0x70,0x1b,0x00,0x02,0x01,0x00,0x12,0xc0,0xfc,0x00,0x12,0x60,0x2b,0x01,0x22,0xfd,
-0x1b,0xe2,0x04,0x01,0xbf,0x00,0x12,0x40,0xc8,0x04,0x32,0xd1,0x00,0xdf,0xdf,0x01,
-0x11,0xef,0x6c,0x01,0x12,0x0f,0x73,0x00,0x11,0x1e,0x39,0x06,0x03,0xa8,0x01,0x11,
-0x5f,0x6b,0x0e,0x02,0xb6,0x01,0x22,0xff,0x39,0x21,0x02,0x13,0x9f,0xaf,0x00,0x14,
+0x29,0x24,0x0f,0x03,0x0c,0x85,0xec,0xe0,0x18,0x12,0x12,0x03,0x1d,0x00,0x01,0x00,
+0x2f,0xee,0x00,0x01,0x00,0x02,0x13,0xf5,0x08,0x00,0x17,0xdc,0x14,0x00,0xbe,0xf1,
+0xef,0x00,0xfa,0xe5,0x00,0xe5,0x00,0x00,0x00,0x03,0x31,0x00,0x4d,0x06,0x0b,0x00,
+0x07,0x15,0x00,0x2f,0xac,0x00,0x01,0x00,0x14,0x1f,0xb7,0x1d,0x00,0x09,0x03,0x84,
+0x00,0xb1,0xe8,0x00,0xfa,0x00,0x00,0xdc,0xfb,0xe9,0xf4,0x00,0xd4,0x10,0x00,0xaa,
+0xf2,0xfc,0x00,0x00,0xfb,0xfd,0xf1,0xf6,0x00,0x04,0x2f,0x00,0x7e,0xf8,0x00,0xf9,
+0x00,0x00,0xf0,0x00,0x01,0x00,0x15,0xf8,0x0a,0x00,0x12,0xf7,0x07,0x00,0x19,0xfc,
+0x1f,0x00,0x14,0xfb,0x6d,0x00,0x00,0x68,0x00,0x8f,0x00,0xe7,0x00,0xf9,0x00,0xf9,
+0xf3,0xf9,0x98,0x00,0x09,0x14,0x06,0x09,0x00,0x21,0xfa,0xfb,0x33,0x00,0x25,0xfb,
+0xf8,0x2f,0x00,0x75,0xaf,0x00,0x00,0x00,0xc7,0x00,0xc2,0x23,0x00,0x9a,0xf6,0xfa,
+0x00,0x00,0xfa,0xf8,0x00,0x00,0xf9,0x51,0x00,0x13,0x05,0x8c,0x00,0x2f,0x05,0xf8,
+0x65,0x00,0x06,0x1f,0xf9,0x3a,0x01,0x0c,0x16,0xcf,0xcf,0x00,0x04,0xe5,0x00,0x10,
+0xf8,0x37,0x00,0x20,0xf4,0xed,0x0e,0x00,0x14,0xab,0xab,0x00,0x96,0xed,0x00,0x00,
+0xc3,0xf9,0xc3,0xe4,0x00,0xad,0x2a,0x00,0x34,0xfc,0xdc,0xf1,0x0b,0x00,0x72,0x88,
+0x00,0x00,0x00,0xcb,0x00,0xc9,0xe6,0x01,0x51,0x00,0xf5,0x00,0xfd,0xfc,0x1d,0x01,
+0x1c,0x04,0x5b,0x01,0x00,0xca,0x00,0x5f,0x00,0xf8,0xfa,0x00,0xf6,0x93,0x00,0x0a,
+0x10,0xf1,0x0e,0x01,0x1c,0xf2,0x16,0x00,0x01,0x69,0x02,0xc0,0xb4,0xaf,0x00,0x00,
+0xdc,0xf8,0xc0,0xfb,0x05,0x00,0x05,0x04,0xfe,0x00,0xd2,0xce,0xe6,0x00,0xe6,0xc2,
+0xed,0xe9,0x00,0xed,0xe8,0xf2,0xe9,0xee,0x54,0x01,0x66,0xc0,0xd1,0x00,0x00,0xea,
+0xfc,0x23,0x01,0xa3,0xf2,0xf3,0x00,0x00,0xf2,0xf7,0x00,0x00,0xf8,0xfd,0x73,0x01,
+0x94,0x04,0x00,0xd6,0xee,0x00,0x00,0xf3,0x00,0x00,0x9e,0x00,0x72,0x04,0xf6,0xf7,
+0x00,0x00,0xf7,0xfa,0xb8,0x01,0x04,0x15,0x00,0x14,0xd2,0x3c,0x01,0x15,0x04,0x18,
+0x01,0x10,0xfa,0xab,0x01,0x13,0xf7,0x02,0x02,0xf5,0x11,0x06,0xf1,0xbc,0xd3,0x00,
+0x00,0xd4,0xf7,0xe4,0xfb,0x05,0xe4,0x05,0x05,0x04,0x05,0x00,0x05,0xed,0xed,0xf9,
+0xf4,0xed,0xf4,0xef,0xf9,0xf4,0xfa,0x00,0xf9,0xf7,0x06,0x81,0x00,0x18,0x04,0x9c,
+0x01,0x13,0xfa,0x46,0x00,0x1b,0xf8,0xb1,0x01,0x14,0xfb,0x3f,0x02,0x0c,0x01,0x00,
+0x1f,0xfb,0x29,0x01,0x09,0x18,0xfc,0x8d,0x02,0x0f,0x01,0x00,0x03,0x40,0xfd,0x00,
+0xfc,0xfc,0x06,0x00,0x0f,0x01,0x00,0x0e,0x1f,0xfc,0x1d,0x00,0x0f,0x16,0x05,0xb2,
+0x02,0x06,0x81,0x02,0x19,0xf9,0xd1,0x02,0x2f,0xe8,0x00,0x01,0x00,0x23,0x19,0xfa,
+0x0e,0x00,0x1f,0xe6,0x8c,0x00,0x0b,0x22,0xfa,0xfb,0xfa,0x02,0x1b,0xcd,0x1a,0x00,
+0x30,0xf7,0xfa,0x06,0x78,0x04,0x4f,0x0f,0x00,0x05,0x05,0x41,0x00,0x09,0x07,0x30,
+0x01,0x13,0x04,0x01,0x03,0x09,0x60,0x00,0x2c,0xfc,0x04,0x0d,0x01,0x1f,0xdb,0xd2,
+0x00,0x23,0x1e,0xf4,0x23,0x00,0x0f,0xf5,0x01,0x12,0x04,0x8a,0x02,0x0d,0x01,0x00,
+0x30,0x01,0x00,0x02,0x07,0x00,0x31,0x02,0x03,0x00,0x5c,0x03,0x1e,0x05,0x52,0x04,
+0xf1,0x0b,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,
+0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,0xf7,0x0c,
+0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,
+0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x61,0x00,0x20,0x03,0x02,
+0x5c,0x00,0x4b,0x06,0x07,0x06,0x08,0x5f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,
+0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xf1,0x08,0x0b,0x00,0x0d,0x0e,0x0f,0x10,
+0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,
+0x17,0x2e,0x00,0xf0,0x04,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,
+0x21,0x1f,0x22,0x00,0x00,0x23,0x00,0x00,0xc0,0x0e,0xff,0xff,0xff,0xff,0xb0,0xdf,
+0xff,0xff,0xff,0xfa,0x0d,0x0b,0x00,0x70,0xa0,0xcf,0xff,0xff,0xff,0xf9,0x0c,0x0b,
+0x00,0x70,0x90,0xbf,0xff,0xff,0xff,0xf8,0x0b,0x0b,0x00,0x70,0x80,0xaf,0xff,0xff,
+0xff,0xf7,0x0a,0x0b,0x00,0x70,0x60,0x9f,0xff,0xff,0xff,0xf6,0x08,0x0b,0x00,0x70,
+0x50,0x8f,0xff,0xff,0xff,0xf5,0x07,0x0b,0x00,0x70,0x40,0x7f,0xff,0xff,0xff,0xf4,
+0x06,0x0b,0x00,0x70,0x30,0x6f,0xff,0xff,0xff,0xf3,0x05,0x0b,0x00,0x70,0x20,0x5f,
+0xff,0xff,0xff,0xf2,0x04,0x0b,0x00,0x70,0x10,0x4f,0xff,0xff,0xff,0xf1,0x03,0x0b,
+0x00,0x71,0x00,0x3f,0xff,0xff,0xff,0xf0,0x02,0x0b,0x00,0x10,0x2f,0x0b,0x00,0xf0,
+0x07,0x01,0xff,0xff,0xff,0xfe,0x00,0x1f,0xff,0xff,0xff,0xd0,0x00,0xff,0xff,0xff,
+0xfd,0x00,0x0f,0xff,0xff,0xff,0xc0,0x0b,0x00,0x30,0xfc,0x00,0x0e,0x9f,0x00,0x70,
+0x00,0xef,0xff,0xff,0xfb,0x00,0x0d,0x9f,0x00,0x1f,0x00,0x01,0x00,0x04,0xb0,0x02,
+0x20,0x00,0x00,0x01,0xaf,0xff,0xf9,0x00,0x01,0xef,0x37,0x00,0x01,0xb0,0x00,0x10,
+0x0f,0x63,0x00,0x20,0xd1,0xff,0x01,0x00,0x01,0x0b,0x00,0x11,0xe0,0xdc,0x00,0x11,
+0x04,0x9a,0x00,0xb0,0x05,0xef,0xff,0xfd,0x30,0x00,0x00,0x57,0x74,0x00,0x00,0xca,
+0x00,0x80,0x00,0xdf,0xff,0xff,0x7f,0xff,0xff,0xf5,0x65,0x00,0x1f,0xf7,0x11,0x00,
+0x01,0x13,0x40,0x11,0x00,0x10,0xf3,0x11,0x00,0x10,0xf5,0xd1,0x00,0x00,0x11,0x00,
+0x40,0x4f,0xff,0xff,0xf0,0x11,0x00,0x10,0xf2,0xc1,0x00,0x00,0x11,0x00,0x40,0x1f,
+0xff,0xff,0xd0,0x11,0x00,0x40,0xf0,0xff,0xff,0xfb,0x11,0x00,0x50,0xfe,0x0f,0xff,
+0xff,0xa0,0x11,0x00,0x40,0xc0,0xff,0xff,0xf8,0x11,0x00,0x50,0xfb,0x0f,0xff,0xff,
+0x70,0x11,0x00,0x40,0x90,0xff,0xff,0xf5,0x11,0x00,0x50,0xf8,0x0f,0xff,0xff,0x30,
+0x11,0x00,0x40,0x60,0xff,0xff,0xf2,0x11,0x00,0xa2,0xf5,0x07,0x77,0x77,0x00,0x00,
+0x05,0x77,0x77,0x10,0xda,0x00,0x10,0x3f,0x31,0x00,0x20,0x00,0x7f,0x26,0x00,0x02,
+0x01,0x00,0x70,0x06,0xff,0xff,0xf4,0x00,0x00,0x0a,0x7b,0x00,0x03,0x01,0x00,0x40,
+0x9f,0xff,0xff,0x10,0x3b,0x00,0x14,0xfd,0x11,0x00,0x50,0x0c,0xff,0xff,0xe0,0x00,
+0x47,0x01,0x14,0xb0,0x12,0x00,0x01,0x90,0x00,0x11,0x03,0x85,0x00,0x01,0x01,0x00,
+0x00,0x6f,0x01,0x40,0x90,0x00,0x00,0x5f,0xeb,0x00,0x02,0x01,0x00,0x71,0x04,0xff,
+0xff,0xf6,0x00,0x00,0x08,0x86,0x00,0x02,0x01,0x00,0x02,0x74,0x00,0x34,0xbf,0xff,
+0xff,0x11,0x00,0x02,0x74,0x00,0x10,0x0e,0xe4,0x00,0x03,0x01,0x00,0x01,0x74,0x00,
+0x44,0x01,0xff,0xff,0xfa,0x11,0x00,0x11,0x0f,0xa4,0x01,0x11,0x4f,0xb4,0x00,0x02,
+0x99,0x01,0x01,0x74,0x00,0x02,0xb4,0x00,0x02,0x01,0x00,0x02,0x74,0x00,0x02,0xb4,
+0x00,0x00,0x53,0x00,0x09,0x01,0x00,0x3b,0xfe,0x00,0xaf,0x12,0x00,0x1f,0xe0,0x23,
+0x00,0x22,0xf8,0x02,0x58,0x88,0x88,0x8b,0xff,0xff,0xfa,0x88,0x88,0x8d,0xff,0xff,
+0xf8,0x88,0x88,0x88,0x70,0x28,0x01,0x17,0xfe,0x28,0x01,0x1a,0xf0,0x28,0x01,0x34,
+0xef,0xff,0xfc,0xb4,0x00,0x0f,0x28,0x01,0x0d,0x17,0xf3,0x28,0x01,0x19,0x40,0x28,
+0x01,0x77,0x09,0xff,0xff,0xf1,0x00,0x00,0x0d,0x28,0x01,0x11,0xcf,0x74,0x00,0x03,
+0x28,0x01,0xfb,0x04,0x07,0x77,0x77,0x77,0x7f,0xff,0xff,0xe7,0x77,0x77,0x8f,0xff,
+0xff,0xc7,0x77,0x77,0x73,0x00,0xff,0x01,0x00,0x2b,0x80,0x0f,0x11,0x00,0x1f,0xf8,
+0x23,0x00,0x22,0x08,0xf9,0x01,0x14,0xf7,0x8b,0x00,0x11,0x2f,0x19,0x00,0x11,0x6f,
+0xb4,0x00,0x01,0x01,0x00,0x11,0x05,0xd1,0x00,0x17,0x09,0xf9,0x01,0x11,0x8f,0xf9,
+0x01,0x16,0xcf,0xd1,0x00,0x14,0x0b,0xf9,0x01,0x1c,0xc0,0xf9,0x01,0x1d,0xf9,0xf9,
+0x01,0x13,0x60,0x11,0x00,0x02,0x6d,0x02,0x17,0x07,0xf9,0x01,0x10,0x6f,0x45,0x01,
+0x00,0xbd,0x01,0x03,0xda,0x02,0x03,0x6d,0x02,0x02,0xad,0x02,0x02,0x01,0x00,0x02,
+0x45,0x01,0x01,0xb4,0x00,0x02,0x01,0x00,0x02,0x6d,0x02,0x11,0x2f,0x85,0x01,0x01,
+0x01,0x00,0x02,0x6d,0x02,0x02,0xb4,0x00,0x07,0x01,0x00,0x24,0x01,0x11,0x55,0x00,
+0x05,0xb7,0x01,0x0f,0x10,0x00,0x4a,0x19,0x3f,0x10,0x00,0x20,0x38,0xdf,0xb8,0x04,
+0x14,0x92,0x0f,0x00,0x13,0x3c,0x81,0x01,0x15,0xc3,0x0f,0x02,0x03,0x01,0x00,0x14,
+0x70,0xe5,0x00,0x03,0x01,0x00,0x13,0xf9,0x56,0x03,0x09,0xb3,0x01,0x17,0x7f,0x10,
+0x00,0x11,0xf4,0xf1,0x00,0x06,0x01,0x00,0x10,0xfd,0x52,0x01,0x00,0x01,0x00,0x51,
+0x72,0x00,0x39,0xff,0xff,0xa9,0x04,0x01,0xb7,0x05,0x21,0xe2,0x00,0x7c,0x01,0x00,
+0xa1,0x01,0x12,0x1f,0x17,0x00,0x03,0x29,0x00,0x11,0xf1,0x6e,0x05,0x02,0xf1,0x02,
+0x02,0x51,0x00,0x24,0x5f,0xff,0x5f,0x01,0x01,0x25,0x05,0x00,0x96,0x01,0x03,0xbf,
+0x03,0x11,0x7f,0x92,0x00,0x06,0x20,0x00,0x11,0x5f,0x1a,0x00,0x06,0x40,0x00,0x52,
+0x28,0x88,0x88,0x88,0x85,0x60,0x00,0x04,0xe5,0x01,0x02,0x44,0x03,0x07,0x0c,0x03,
+0x04,0xa0,0x00,0x16,0x70,0x9a,0x01,0x11,0xef,0xb9,0x00,0x06,0x32,0x00,0x12,0x6f,
+0xa3,0x03,0x17,0x81,0x56,0x04,0x01,0x01,0x00,0x17,0xa3,0x05,0x02,0x01,0x01,0x00,
+0x2b,0xb3,0x00,0x40,0x01,0x13,0xa1,0x11,0x00,0x14,0x5e,0x11,0x00,0x16,0x50,0xb1,
+0x02,0x03,0x04,0x03,0x03,0x74,0x00,0x13,0x7e,0x11,0x00,0x14,0x90,0x54,0x00,0x12,
+0x5c,0x10,0x00,0x06,0x35,0x02,0x12,0x29,0x11,0x00,0x06,0x36,0x02,0x1a,0x19,0x31,
+0x00,0x03,0x50,0x01,0x16,0xf0,0x10,0x00,0x11,0x05,0x40,0x01,0x53,0x04,0x44,0x44,
+0x44,0x43,0xd5,0x03,0x00,0x40,0x01,0x11,0x1f,0xc8,0x06,0x06,0x40,0x01,0x16,0x0f,
+0x10,0x00,0x01,0x40,0x01,0x11,0x0e,0x14,0x07,0x06,0x10,0x00,0x02,0x50,0x07,0x06,
+0x30,0x00,0x01,0x4a,0x07,0x12,0xe1,0x54,0x03,0x00,0xc2,0x00,0x24,0x03,0xff,0x80,
+0x01,0x12,0x07,0xb0,0x01,0x13,0xdf,0x4a,0x02,0x22,0x01,0x8f,0x90,0x00,0x11,0x5f,
+0xa8,0x00,0x33,0xda,0x89,0xbf,0xb0,0x00,0x19,0x0c,0xf4,0x03,0x13,0x10,0x70,0x01,
+0x16,0xff,0xf0,0x00,0x17,0x3e,0x10,0x00,0x10,0x90,0x92,0x05,0x06,0x21,0x00,0x14,
+0xf7,0x87,0x03,0x03,0x5e,0x02,0x03,0x13,0x04,0x31,0x28,0xdf,0xff,0x86,0x00,0x15,
+0x50,0x5e,0x07,0x58,0x68,0xef,0xff,0xfb,0x74,0x62,0x03,0x16,0xbf,0xd7,0x03,0x0f,
+0x10,0x00,0x3f,0x3d,0x46,0x77,0x53,0xe1,0x07,0x10,0x3b,0x92,0x00,0x05,0x34,0x02,
+0x09,0xf8,0x01,0x1a,0xf5,0x15,0x00,0x1c,0xaf,0xeb,0x01,0x08,0x22,0x02,0x1b,0xf3,
+0xd5,0x03,0x43,0xff,0xfd,0xdf,0xff,0xd7,0x04,0x25,0x05,0x10,0xc0,0x02,0x30,0x80,
+0x00,0x2c,0x25,0x08,0x01,0xc6,0x04,0x14,0x81,0xec,0x01,0x11,0x90,0x8e,0x04,0x12,
+0xf7,0xaa,0x01,0x13,0xf7,0x9d,0x04,0x12,0xf2,0xc8,0x01,0x12,0x90,0x07,0x00,0x13,
+0x50,0x67,0x03,0x02,0x2e,0x02,0x12,0xfa,0x6e,0x05,0x13,0xb0,0x1f,0x05,0x12,0xf0,
+0x03,0x02,0x11,0xb0,0x4f,0x05,0x29,0xf2,0x00,0x2b,0x00,0x11,0xfb,0x06,0x00,0x2a,
+0xf7,0x00,0x2b,0x00,0x10,0xa0,0xcd,0x01,0x14,0xfd,0x99,0x06,0x21,0xff,0x30,0xab,
+0x01,0x11,0xf9,0xc8,0x06,0x14,0x40,0x98,0x05,0x12,0xfb,0x62,0x03,0x10,0x60,0xa8,
+0x03,0x15,0xa0,0x61,0x03,0x40,0xfb,0x30,0x05,0xdf,0x65,0x00,0x14,0x0d,0x5c,0x02,
+0x24,0x00,0x00,0xf6,0x01,0x36,0xfa,0x00,0x07,0x1d,0x01,0x14,0x05,0x31,0x07,0x30,
+0x20,0x02,0xff,0xfa,0x06,0x19,0x00,0x11,0x02,0x32,0x40,0x00,0xbf,0x06,0x01,0x07,
+0x2c,0x00,0x20,0xfd,0x20,0x9a,0x00,0x16,0x80,0xdf,0x03,0x5a,0x7c,0xff,0xff,0xff,
+0xb5,0x16,0x08,0x00,0x17,0x00,0x22,0x24,0x32,0xba,0x03,0x0a,0xe7,0x01,0x03,0x19,
+0x06,0x1d,0xfa,0xc1,0x09,0x00,0x96,0x07,0x1d,0x10,0x15,0x00,0x19,0x7f,0x6a,0x04,
+0x06,0xc1,0x06,0x1d,0xc0,0x15,0x00,0x02,0x53,0x01,0x59,0x49,0xce,0xfe,0xda,0x50,
+0xb2,0x03,0x40,0xf8,0x00,0x03,0xcf,0xb7,0x00,0x36,0xe5,0x00,0x00,0xe3,0x07,0x14,
+0xfe,0xf8,0x00,0x05,0xbe,0x06,0x01,0x53,0x01,0x1b,0x04,0x46,0x04,0x02,0x53,0x01,
+0x1a,0xef,0x3a,0x02,0x00,0x53,0x01,0x10,0xf1,0x99,0x00,0x45,0xfd,0x75,0x6c,0xff,
+0x39,0x08,0x01,0x53,0x01,0x11,0x0d,0x8e,0x01,0x15,0x09,0x00,0x04,0x10,0x01,0x53,
+0x01,0x12,0x01,0x49,0x02,0x15,0x0e,0x0a,0x01,0x10,0xbf,0xc9,0x01,0x12,0x3f,0x2e,
+0x01,0x14,0xaf,0xe0,0x00,0x10,0x5f,0x43,0x02,0x12,0x04,0xf9,0x03,0x14,0x08,0x09,
+0x02,0x11,0x0e,0x19,0x07,0x12,0x4f,0x65,0x00,0x13,0x8f,0x75,0x01,0x11,0x09,0xf0,
+0x02,0x06,0x2b,0x00,0x13,0xf8,0x53,0x01,0x12,0xfb,0xb0,0x00,0x12,0xc0,0xcc,0x00,
+0x13,0x70,0xb4,0x02,0x11,0x10,0xcd,0x08,0x12,0xff,0x21,0x01,0x13,0xf5,0x53,0x01,
+0x12,0x70,0x65,0x02,0x12,0xf7,0x5c,0x06,0x10,0x30,0xe0,0x03,0x12,0xaf,0xbd,0x01,
+0x10,0xaf,0x16,0x00,0x24,0x02,0xcf,0x91,0x07,0x11,0x3c,0xf4,0x00,0x01,0x92,0x04,
+0x25,0xcd,0xff,0x43,0x08,0x19,0x02,0xb6,0x05,0x19,0xfd,0x87,0x01,0x04,0x8d,0x04,
+0x1c,0x20,0x9d,0x01,0x02,0x3a,0x02,0x09,0x01,0x00,0x10,0x04,0x99,0x01,0x1d,0xe7,
+0xca,0x01,0x70,0x14,0x67,0x75,0x20,0x00,0x00,0x00,0x11,0x00,0x01,0x00,0x5a,0x03,
+0x56,0x76,0x52,0x00,0x01,0x00,0x78,0x3a,0xef,0xff,0xff,0xff,0xe9,0x10,0x13,0x00,
+0x21,0x1b,0xff,0x01,0x00,0x17,0xf8,0x13,0x00,0x32,0x03,0xef,0xff,0x01,0x00,0x16,
+0xb0,0x14,0x00,0x23,0x2e,0xff,0x01,0x00,0x16,0xfb,0x14,0x00,0x24,0xdf,0xff,0x01,
+0x00,0x14,0x80,0x13,0x00,0x25,0x07,0xff,0x01,0x00,0x14,0xf1,0x14,0x00,0x11,0x0e,
+0x0f,0x00,0x19,0xef,0x66,0x00,0xc4,0x4f,0xff,0xff,0xff,0xfe,0x50,0x00,0x5e,0xff,
+0xff,0xff,0xfd,0x14,0x00,0x80,0x8f,0xff,0xff,0xff,0xf2,0x00,0x00,0x03,0x29,0x00,
+0x04,0x14,0x00,0xc4,0xbf,0xff,0xff,0xff,0x90,0x00,0x00,0x00,0x9f,0xff,0xff,0xff,
+0xb7,0x00,0xd7,0xcf,0xff,0xff,0xff,0x40,0x00,0x00,0x00,0x6f,0xff,0xff,0xff,0x20,
+0x8b,0x00,0x57,0x30,0x00,0x00,0x00,0x7f,0x3c,0x00,0x00,0x14,0x00,0x12,0x60,0x44,
+0x00,0x05,0x64,0x00,0x12,0xaf,0xd6,0x00,0x18,0x02,0x8c,0x00,0x12,0x7f,0x78,0x00,
+0x12,0x2e,0x07,0x00,0x02,0x01,0x00,0x11,0x2f,0xea,0x00,0x23,0x05,0xff,0x7f,0x00,
+0x01,0x01,0x00,0x10,0x0b,0x0e,0x00,0x28,0x61,0xbf,0xb3,0x00,0x25,0x00,0x02,0xef,
+0x00,0x16,0xe2,0x18,0x01,0x13,0x9f,0x13,0x00,0x26,0xfe,0x20,0x14,0x00,0x13,0x1e,
+0x14,0x00,0x17,0xc1,0x68,0x01,0x1e,0x04,0x7b,0x01,0x02,0xde,0x00,0x38,0xff,0xfe,
+0x40,0x13,0x00,0x11,0x1a,0x27,0x00,0x18,0xf7,0x13,0x00,0x13,0x02,0x7c,0x01,0x10,
+0x40,0x1f,0x00,0x43,0xaa,0xaa,0xaa,0x50,0x54,0x01,0x04,0x8a,0x00,0x54,0x3f,0xff,
+0xff,0xff,0x70,0x62,0x00,0x00,0xb2,0x00,0x12,0x10,0x20,0x00,0x12,0x70,0x1b,0x00,
+0x02,0x01,0x00,0x12,0xc0,0xfc,0x00,0x12,0x60,0x2b,0x01,0x11,0xfd,0x0a,0x02,0x12,
+0xfa,0xbf,0x00,0x30,0x40,0x00,0x08,0x0e,0x00,0x32,0xd1,0x00,0xdf,0xdf,0x01,0x11,
+0xef,0x6c,0x01,0x12,0x0f,0x73,0x00,0x01,0xcc,0x00,0x13,0xf5,0xa8,0x01,0x53,0x5f,
+0xff,0xff,0xff,0xfc,0xb6,0x01,0x22,0xff,0x39,0x21,0x02,0x13,0x9f,0xaf,0x00,0x14,
 0x4f,0xf9,0x01,0x12,0xf7,0xca,0x01,0x18,0xf5,0x22,0x02,0x12,0xf2,0xec,0x00,0x18,
-0xf5,0x32,0x01,0x12,0xc0,0x28,0x00,0x16,0xf7,0xf9,0x02,0x04,0xf7,0x0a,0x03,0x61,
-0x05,0x15,0xcf,0x38,0x03,0x14,0x7f,0xff,0x00,0x24,0x00,0x1e,0xee,0x09,0x02,0xdb,
-0x00,0x16,0xe3,0xd6,0x02,0x11,0xa0,0x73,0x04,0x00,0x01,0x00,0x64,0x82,0x00,0x01,
-0x4a,0xff,0xff,0x2f,0x08,0x13,0x06,0xa0,0x01,0x04,0x8b,0x00,0x16,0xfc,0x5b,0x00,
-0x06,0x01,0x00,0x18,0xa0,0xf6,0x02,0x07,0xf4,0x07,0x05,0x1e,0x03,0x08,0x49,0x09,
-0x16,0x2c,0x66,0x0a,0x15,0x6f,0xf1,0x04,0x14,0x7e,0x13,0x00,0x11,0x60,0x88,0x01,
-0x02,0xa4,0x05,0x11,0x6b,0x13,0x00,0x23,0xd9,0x30,0xcc,0x09,0x12,0xc0,0xcf,0x01,
-0x34,0x56,0x77,0x65,0xa3,0x0e,0x02,0x61,0x04,0x1e,0xf9,0x04,0x00,0x01,0xef,0x0e,
-0x00,0x99,0x0f,0xf0,0x02,0xf6,0x0f,0xff,0xff,0xf5,0x0f,0xff,0xff,0xf4,0x0f,0xff,
-0xff,0xf2,0x0f,0xff,0xff,0xf1,0xf6,0x06,0x03,0x04,0x00,0xc5,0xe0,0x0f,0xff,0xff,
-0xd0,0x0f,0xff,0xff,0xc0,0x08,0x88,0x88,0xce,0x05,0x14,0x10,0xd9,0x03,0x15,0xcc,
-0xa5,0x06,0x15,0xf1,0xd4,0x02,0x14,0x70,0x7d,0x04,0x15,0xfd,0x86,0x04,0x14,0xf1,
-0x3a,0x0a,0x13,0xf4,0x34,0x0f,0x02,0xd0,0x00,0x15,0x02,0x30,0x08,0x14,0xcf,0xb6,
-0x02,0x14,0x6f,0x37,0x00,0x14,0x0e,0x8e,0x01,0x15,0x08,0x38,0x04,0x05,0xf8,0x05,
-0x14,0x7f,0x25,0x00,0x14,0x0d,0xfe,0x0a,0x15,0x04,0x1e,0x0a,0x14,0x9f,0x52,0x04,
-0x18,0x0e,0x1c,0x00,0x14,0xf1,0x11,0x04,0x06,0x94,0x00,0x02,0xa0,0x07,0x05,0x08,
+0xf5,0x32,0x01,0x12,0xc0,0x28,0x00,0x14,0xf7,0x6f,0x01,0x00,0x01,0x00,0x12,0x50,
+0xb6,0x01,0x16,0xfc,0x1e,0x01,0x01,0x80,0x01,0x14,0x7f,0xff,0x00,0x03,0x5b,0x01,
+0x23,0xf4,0x00,0xdb,0x00,0x16,0xe3,0xd6,0x02,0x51,0xa0,0x00,0x00,0x00,0x0d,0x0a,
+0x00,0x42,0x82,0x00,0x01,0x4a,0x4f,0x00,0x53,0xe1,0x00,0x00,0x00,0x06,0xa0,0x01,
+0x04,0x8b,0x00,0x16,0xfc,0x5b,0x00,0x06,0x01,0x00,0x18,0xa0,0xf6,0x02,0x03,0x01,
+0x00,0x18,0xf7,0x1e,0x03,0x16,0xff,0xa1,0x00,0x35,0x00,0x2c,0xff,0x6a,0x01,0x10,
+0x6f,0x06,0x00,0x10,0xf3,0x52,0x00,0x14,0x7e,0x13,0x00,0x21,0x60,0x04,0x6f,0x00,
+0x01,0xc1,0x02,0x11,0x6b,0x13,0x00,0x22,0xd9,0x30,0xc0,0x02,0x22,0xff,0xc0,0xcf,
+0x01,0x45,0x56,0x77,0x65,0x30,0xde,0x01,0x00,0x68,0x01,0x2e,0xf9,0x0f,0x04,0x00,
+0xf3,0x0e,0xf8,0x0f,0xff,0xff,0xf7,0x0f,0xff,0xff,0xf6,0x0f,0xff,0xff,0xf5,0x0f,
+0xff,0xff,0xf4,0x0f,0xff,0xff,0xf2,0x0f,0xff,0xff,0xf1,0x0f,0xff,0xff,0xf0,0x04,
+0x00,0xd4,0xe0,0x0f,0xff,0xff,0xd0,0x0f,0xff,0xff,0xc0,0x08,0x88,0x88,0x50,0x50,
+0x00,0x14,0x10,0xd9,0x03,0x13,0xcc,0x09,0x00,0x35,0x08,0xff,0xf1,0xd4,0x02,0x11,
+0x70,0x09,0x00,0x14,0x0c,0xd6,0x02,0x14,0x0c,0xbb,0x03,0x13,0x09,0x55,0x01,0x01,
+0x2e,0x01,0x14,0xf3,0xed,0x02,0x14,0xf5,0x87,0x01,0x02,0xb6,0x02,0x14,0x6f,0x37,
+0x00,0x14,0x0e,0x8e,0x01,0x15,0x08,0x38,0x04,0x04,0x37,0x00,0x24,0x00,0x7f,0x25,
+0x00,0x13,0x0d,0x92,0x03,0x01,0x98,0x02,0x14,0xf0,0x2c,0x03,0x15,0xfb,0x41,0x00,
+0x05,0x1c,0x00,0x14,0xf1,0x11,0x04,0x06,0x94,0x00,0x14,0xa0,0x54,0x00,0x02,0x08,
 0x03,0x14,0x3f,0x70,0x00,0x18,0x05,0x2f,0x00,0x15,0xff,0xa9,0x03,0x14,0xe0,0xa8,
-0x00,0x15,0xfc,0x5e,0x00,0x05,0x96,0x00,0x14,0xfa,0x65,0x01,0x02,0xdc,0x03,0x15,
-0x01,0xcd,0x06,0x14,0x1f,0xcb,0x04,0x15,0x01,0x97,0x03,0x09,0x13,0x00,0x1a,0xf9,
-0x39,0x00,0x06,0x4c,0x00,0x15,0x0e,0xa1,0x00,0x14,0xdf,0x72,0x00,0x06,0x85,0x00,
-0x14,0x9f,0x98,0x00,0x15,0x06,0xab,0x00,0x05,0xbe,0x00,0x06,0xd1,0x00,0x06,0xe4,
-0x00,0x05,0xf7,0x00,0x06,0x0a,0x01,0x15,0x0f,0xb0,0x0b,0x14,0xaf,0x73,0x00,0x06,
-0x43,0x01,0x15,0x0e,0x1d,0x00,0x14,0x8f,0x7d,0x00,0x15,0x01,0xcc,0x04,0x15,0x09,
-0x57,0x00,0x15,0x1f,0x4c,0x0b,0x15,0x7f,0xaf,0x08,0x14,0xdf,0xce,0x08,0x15,0x03,
-0xad,0x01,0x15,0x08,0x53,0x0b,0x15,0x0b,0xd6,0x04,0x15,0x0d,0x14,0x00,0x24,0x1d,
-0xff,0x01,0x10,0x15,0x1d,0xf6,0x05,0x15,0x0a,0x37,0x05,0x25,0x05,0xec,0xc3,0x02,
-0x16,0x30,0x76,0x02,0x35,0x00,0x4f,0x80,0xae,0x0c,0x15,0xd2,0x53,0x11,0x15,0xf5,
-0x70,0x09,0x15,0xf6,0xa9,0x00,0x15,0xf5,0x78,0x00,0x15,0xf3,0x28,0x07,0x15,0xe1,
-0x82,0x00,0x15,0xb0,0x9a,0x05,0x15,0x60,0xb8,0x05,0x14,0x10,0xc7,0x00,0x15,0xf9,
-0x67,0x09,0x02,0x3b,0x00,0x06,0xf1,0x12,0x06,0x27,0x06,0x05,0xc2,0x01,0x15,0x09,
-0x3c,0x01,0x15,0x5f,0x3c,0x01,0x05,0xdb,0x06,0x15,0x0b,0x1d,0x00,0x14,0x7f,0xa6,
-0x01,0x19,0x04,0x22,0x02,0x15,0xd0,0x5e,0x06,0x0b,0xaf,0x00,0x14,0x9f,0x9b,0x00,
-0x15,0x07,0x3f,0x02,0x14,0x5f,0x87,0x00,0x15,0x04,0xc3,0x04,0x14,0x3f,0x19,0x02,
-0x15,0x03,0x1d,0x0e,0x14,0x2f,0x73,0x00,0x15,0x01,0xfc,0x06,0x1e,0x1f,0x13,0x00,
+0x00,0x15,0xfc,0x5e,0x00,0x05,0x96,0x00,0x14,0xfa,0x65,0x01,0x02,0xdc,0x03,0x51,
+0x01,0xff,0xff,0xff,0xf9,0x13,0x00,0x14,0x1f,0xcb,0x04,0x15,0x01,0x97,0x03,0x09,
+0x13,0x00,0x1a,0xf9,0x39,0x00,0x06,0x4c,0x00,0x15,0x0e,0xa1,0x00,0x14,0xdf,0x72,
+0x00,0x06,0x85,0x00,0x14,0x9f,0x98,0x00,0x15,0x06,0xab,0x00,0x05,0xbe,0x00,0x06,
+0xd1,0x00,0x06,0xe4,0x00,0x05,0xf7,0x00,0x06,0x0a,0x01,0x13,0x0f,0x67,0x02,0x01,
+0x0b,0x03,0x2a,0xfa,0x00,0x43,0x01,0x15,0x0e,0x1d,0x00,0x14,0x8f,0x7d,0x00,0x15,
+0x01,0xcc,0x04,0x15,0x09,0x57,0x00,0x13,0x1f,0x23,0x05,0x01,0x90,0x01,0x15,0xfc,
+0x23,0x05,0x12,0xf6,0x1a,0x02,0x05,0xad,0x01,0x13,0x08,0x24,0x03,0x02,0xc2,0x00,
+0x15,0xe2,0xb8,0x01,0x02,0x14,0x00,0x54,0x1d,0xff,0xff,0xfe,0x00,0x0a,0x00,0x03,
+0xf6,0x05,0x15,0x0a,0x37,0x05,0x25,0x05,0xec,0xc3,0x02,0x16,0x30,0x76,0x02,0x44,
+0x00,0x4f,0x80,0x00,0x2a,0x00,0x13,0xd2,0x0a,0x00,0x04,0x49,0x02,0x24,0x00,0x6f,
+0x82,0x00,0x15,0x09,0x5d,0x02,0x15,0x0b,0x8c,0x00,0x15,0x0a,0x78,0x00,0x15,0x0d,
+0xc0,0x01,0x14,0x2f,0x28,0x02,0x25,0x00,0x7f,0x14,0x06,0x14,0xdf,0x9b,0x01,0x15,
+0x05,0x3b,0x00,0x15,0x0d,0xf8,0x00,0x06,0x27,0x06,0x05,0xc2,0x01,0x15,0x09,0x3c,
+0x01,0x15,0x5f,0x3c,0x01,0x05,0xdb,0x06,0x15,0x0b,0x1d,0x00,0x14,0x7f,0xa6,0x01,
+0x19,0x04,0x22,0x02,0x15,0xd0,0x5e,0x06,0x0b,0xaf,0x00,0x14,0x9f,0x9b,0x00,0x15,
+0x07,0x3f,0x02,0x14,0x5f,0x87,0x00,0x15,0x04,0xc3,0x04,0x14,0x3f,0x19,0x02,0x24,
+0x03,0xff,0x4d,0x01,0x14,0x2f,0x73,0x00,0x15,0x01,0xfc,0x06,0x1e,0x1f,0x13,0x00,
 0x05,0x26,0x00,0x15,0x02,0x39,0x00,0x05,0x4c,0x00,0x06,0x5f,0x00,0x05,0x72,0x00,
 0x15,0x07,0xb5,0x00,0x05,0x98,0x00,0x15,0x0a,0xab,0x00,0x05,0xbe,0x00,0x14,0x0f,
-0xd1,0x00,0x15,0x03,0x2f,0x00,0x14,0x6f,0x14,0x01,0x15,0x0a,0x80,0x02,0x01,0x44,
-0x14,0x04,0xb8,0x07,0x1a,0x60,0x43,0x01,0x14,0xef,0x92,0x02,0x14,0x5f,0x61,0x02,
-0x14,0x0c,0xad,0x01,0x06,0x56,0x02,0x18,0xcf,0x25,0x00,0x14,0x20,0xb6,0x05,0x14,
-0x70,0x40,0x01,0x14,0xc0,0x7a,0x02,0x14,0xf2,0x09,0x00,0x14,0xf4,0x09,0x00,0x14,
-0xf7,0x94,0x00,0x14,0xf8,0xda,0x02,0x14,0xf7,0xbb,0x04,0x14,0xe4,0x15,0x13,0x17,
-0xa1,0x76,0x02,0x0a,0x2d,0x0b,0x1a,0xfe,0xfc,0x0a,0x17,0xd0,0x65,0x0b,0x07,0xb4,
-0x0b,0x1a,0x00,0xc8,0x12,0x06,0x6e,0x12,0x06,0xc2,0x08,0x19,0x90,0x6f,0x0b,0x13,
-0xf8,0x4e,0x14,0x12,0x82,0xee,0x00,0x00,0xc8,0x00,0x40,0x16,0x00,0x00,0xcf,0xf5,
-0x0d,0x10,0xbf,0xd0,0x02,0x30,0x04,0xaf,0xf1,0xc2,0x01,0x30,0xe8,0x10,0x0a,0x2f,
-0x01,0x41,0x6d,0xff,0xff,0x60,0x73,0x06,0x42,0xa4,0xaf,0xff,0xf5,0x23,0x07,0x04,
-0xa7,0x0f,0x11,0xef,0x2a,0x09,0x1a,0x0f,0x50,0x06,0x27,0x15,0xae,0xb5,0x10,0x53,
-0x82,0x00,0x00,0x03,0x8c,0x0d,0x00,0x22,0xea,0x61,0xbb,0x00,0x01,0x91,0x0f,0x28,
-0xc8,0x30,0x25,0x10,0x29,0xe1,0x00,0x02,0x10,0x1a,0xb0,0xbc,0x0d,0x16,0x70,0x3f,
-0x14,0x15,0xf3,0x7b,0x04,0x00,0x11,0x01,0x24,0xf7,0x07,0x98,0x06,0x00,0x32,0x03,
-0x12,0xfc,0x05,0x00,0x04,0xfc,0x01,0x01,0x6b,0x0b,0x16,0xf9,0xd8,0x0d,0x00,0x49,
-0x02,0x13,0xf6,0x63,0x00,0x12,0xe0,0x78,0x00,0x12,0xd0,0x9d,0x01,0x12,0xf4,0xde,
-0x04,0x11,0xb1,0x3b,0x00,0x22,0x2c,0xfa,0x05,0x02,0x13,0x60,0x13,0x0a,0x11,0x10,
-0x15,0x00,0x1f,0x20,0x7e,0x16,0x05,0x46,0x9a,0xaa,0xaa,0xaa,0xf2,0x10,0x02,0x6c,
-0x0d,0x1f,0xb0,0x10,0x00,0x92,0x20,0x14,0x44,0x01,0x00,0x00,0x10,0x00,0x11,0xc4,
-0x0a,0x00,0x1b,0x3f,0x19,0x08,0x0f,0x10,0x00,0x5d,0x0e,0x40,0x01,0x0f,0x10,0x00,
-0xac,0x11,0x0a,0x65,0x04,0x00,0xfe,0x09,0x0f,0x0b,0x00,0x0d,0x13,0xfe,0x47,0x04,
-0x10,0xef,0xb1,0x02,0x10,0x1f,0x45,0x03,0x11,0x06,0x1b,0x00,0x10,0xbf,0xc9,0x03,
-0x10,0x2f,0xcc,0x02,0x10,0x0a,0x18,0x05,0x11,0x02,0x63,0x04,0x10,0xaf,0xc7,0x02,
-0x21,0x02,0xaf,0xe3,0x03,0x21,0x2b,0xfb,0x2a,0x04,0x53,0x00,0x00,0x00,0x36,0x66,
-0x01,0x00,0x05,0x33,0x13,0x24,0xf0,0x9f,0x0a,0x00,0x0f,0x13,0x00,0x1d,0x42,0x00,
-0x00,0x13,0x31,0xb9,0x0b,0x40,0xb2,0x00,0x01,0xdf,0x0a,0x0c,0x11,0x09,0x96,0x03,
-0x01,0x0b,0x0d,0x00,0xa7,0x09,0x01,0xb9,0x09,0x00,0xfb,0x03,0x11,0x0b,0x05,0x0a,
-0x12,0x03,0xcd,0x0a,0x12,0x4e,0x6c,0x0f,0x26,0x47,0x75,0x0e,0x01,0x17,0x0d,0xc4,
-0x04,0x18,0x02,0x6a,0x0d,0x01,0x50,0x19,0x0f,0x25,0x00,0x0d,0x1f,0x8f,0x25,0x00,
-0x45,0x1f,0xfd,0x25,0x00,0x3f,0x1f,0x03,0x25,0x00,0x46,0x1f,0xf2,0x25,0x00,0x3f,
-0x1f,0x0e,0x25,0x00,0x21,0x1f,0x70,0x25,0x00,0x3f,0x1f,0x9f,0x25,0x00,0x36,0x04,
-0x41,0x10,0x08,0x3f,0x14,0x21,0x02,0x8d,0x1e,0x0d,0x14,0x60,0x69,0x06,0x13,0x9f,
-0x38,0x0d,0x03,0x11,0x00,0x1a,0x3e,0x14,0x10,0x28,0x03,0xff,0x5a,0x0e,0x09,0x3d,
-0x0d,0x1c,0xfb,0x61,0x0d,0x15,0x70,0x85,0x0d,0x05,0x2d,0x10,0x11,0x0e,0x55,0x12,
-0x33,0x30,0x00,0x5c,0x5d,0x12,0x14,0x5f,0x5c,0x0d,0x12,0xaf,0xdc,0x04,0x14,0xbf,
-0xa1,0x08,0x12,0x0d,0x19,0x00,0x05,0x64,0x10,0x11,0x06,0xae,0x0d,0x15,0x04,0xf7,
-0x06,0x11,0x01,0xd7,0x1a,0x16,0x07,0xf8,0x06,0x10,0xcf,0x6f,0x03,0x15,0x0a,0x30,
-0x0e,0x01,0x10,0x09,0x26,0xf5,0x0c,0x6b,0x11,0x10,0x7f,0x67,0x08,0x16,0x0e,0xd2,
-0x16,0x10,0x6f,0xbf,0x09,0x0c,0x8c,0x16,0x0f,0x10,0x00,0x0c,0x1f,0xfb,0x10,0x00,
-0x8c,0x0d,0xc0,0x00,0x1b,0x0d,0xf0,0x00,0x28,0x0c,0xff,0x20,0x0c,0x03,0xb1,0x1e,
-0x15,0x50,0x35,0x11,0x26,0xf4,0x07,0xe8,0x11,0x01,0x50,0x01,0x15,0x03,0xe8,0x01,
-0x02,0x70,0x01,0x13,0x00,0xd4,0x0f,0x04,0x90,0x01,0x2b,0x00,0xaf,0xb0,0x01,0x14,
-0x4f,0xfc,0x18,0x12,0x9f,0x8a,0x00,0x13,0x0d,0xf0,0x01,0x13,0x4c,0xf0,0x01,0x17,
-0x05,0x12,0x09,0x01,0xd9,0x01,0x1a,0xbf,0x30,0x02,0x05,0x43,0x11,0x04,0xeb,0x0a,
-0x07,0x70,0x02,0x1b,0xd1,0xa4,0x12,0x03,0x7b,0x0c,0x0b,0xb0,0x02,0x0c,0xd0,0x02,
-0x02,0xf0,0x02,0x1a,0x63,0x02,0x03,0x24,0x16,0xcf,0xcd,0x0c,0x13,0xbf,0xe1,0x0a,
-0x23,0x04,0xaf,0x3a,0x01,0x23,0x02,0x8e,0xdd,0x05,0x24,0x01,0x7d,0x71,0x07,0x14,
-0x5b,0xf2,0x05,0x15,0x4a,0x8c,0x00,0x06,0x54,0x18,0x2f,0xf0,0xcf,0x15,0x00,0x0f,
-0x23,0xea,0x50,0x15,0x00,0x22,0xe9,0x40,0x5f,0x11,0x33,0x0c,0xd8,0x30,0x6f,0x1a,
-0x11,0xf0,0xc6,0x00,0x07,0xb8,0x01,0x06,0x54,0x19,0x0f,0x15,0x00,0xff,0x29,0x48,
-0x00,0x25,0x67,0x76,0x22,0x19,0x02,0xb9,0x01,0x24,0xc8,0x20,0xf6,0x01,0x04,0xd5,
-0x14,0x19,0xb2,0x1f,0x15,0x05,0x14,0x19,0x1a,0x2e,0x0d,0x12,0x09,0x22,0x12,0x15,
-0xf5,0x6f,0x12,0x06,0xd6,0x04,0x18,0x08,0xd6,0x02,0x23,0xff,0x90,0x31,0x14,0x43,
-0xc4,0x00,0x01,0x6e,0x42,0x02,0x14,0x9f,0x58,0x03,0x12,0x1d,0xc6,0x12,0x14,0x0f,
-0x7c,0x12,0x02,0xce,0x12,0x26,0x80,0x04,0x4c,0x15,0x11,0xbf,0x70,0x10,0x15,0x7f,
-0x71,0x05,0x11,0x07,0xf3,0x04,0x16,0x0a,0xe9,0x04,0x02,0x8c,0x13,0x15,0xcf,0x4a,
-0x0f,0x02,0x14,0x05,0x67,0x07,0x99,0x99,0x99,0x99,0x20,0x96,0x1c,0x06,0x01,0x00,
-0x01,0x96,0x08,0x0c,0x7d,0x0b,0x08,0xe7,0x19,0x1b,0x6f,0xa6,0x16,0x1b,0x0e,0x31,
-0x00,0x19,0x09,0xea,0x15,0x03,0x72,0x00,0x17,0xf7,0x42,0x06,0x0b,0xe7,0x16,0x26,
-0x01,0xdf,0x67,0x04,0x06,0xd1,0x13,0x2e,0x70,0x00,0xbe,0x0c,0x08,0x91,0x1a,0x1b,
-0xd0,0x5c,0x15,0x1b,0xe2,0x9c,0x1a,0x19,0xf3,0xf6,0x18,0x09,0x38,0x19,0x1b,0x6f,
-0x10,0x00,0x1b,0x5f,0xf5,0x1a,0x1b,0x4f,0xef,0x1a,0x1b,0x3f,0xc1,0x00,0x1b,0x2e,
-0xa2,0x15,0x1a,0x2e,0xfb,0x18,0x02,0xb6,0x01,0x1e,0xfa,0x10,0x00,0x09,0xd5,0x17,
-0x1c,0xfb,0xcf,0x17,0x14,0x76,0x6c,0x0a,0x1c,0x61,0x7e,0x21,0x1b,0x40,0x5e,0x14,
-0x2f,0xf4,0x0e,0x21,0x00,0x3f,0x02,0x8a,0x01,0x46,0x46,0x77,0x65,0x42,0x98,0x00,
-0x02,0xb7,0x1c,0x14,0xeb,0x1b,0x05,0x1a,0x2b,0xda,0x17,0x16,0x08,0x90,0x0e,0x1a,
-0x30,0x86,0x1f,0x01,0x4c,0x01,0x1b,0x0b,0x5f,0x00,0x07,0x86,0x1f,0x00,0x9a,0x0e,
-0x19,0x01,0x6f,0x15,0x13,0xf9,0x4e,0x00,0x42,0x93,0x00,0x01,0x6d,0x04,0x03,0x15,
-0x0e,0xb7,0x15,0x11,0xbf,0x2b,0x06,0x15,0x2f,0xa6,0x00,0x11,0x0e,0x35,0x03,0x15,
-0x5f,0x44,0x02,0x02,0xf2,0x02,0x15,0x6f,0x83,0x01,0x1b,0x04,0x1e,0x02,0x1b,0x02,
-0x10,0x00,0x16,0x03,0x63,0x15,0x17,0x00,0x9b,0x06,0x0a,0x8e,0x01,0x1a,0x50,0x1e,
-0x02,0x1b,0xfe,0xb6,0x1e,0x03,0x1d,0x02,0x57,0x12,0x22,0x23,0x47,0xcf,0x9d,0x02,
-0x18,0xbf,0x8b,0x06,0x07,0x10,0x00,0x1a,0xb0,0x10,0x00,0x1b,0xe6,0x99,0x1f,0x1c,
-0x91,0xa9,0x1f,0x1b,0x80,0x10,0x00,0x00,0xaa,0x17,0x09,0x63,0x01,0x16,0xd1,0xad,
-0x06,0x1b,0x8e,0x4d,0x02,0x2b,0x00,0x9f,0xc0,0x00,0x1b,0x0a,0xf0,0x00,0x1b,0x01,
-0x9f,0x03,0x05,0x86,0x17,0x08,0x3f,0x03,0x2a,0xf7,0x00,0x3f,0x03,0x67,0xf8,0xbc,
-0xcc,0xcc,0xcc,0xc0,0x97,0x1f,0x05,0xda,0x07,0x02,0x8f,0x03,0x11,0xf8,0x6c,0x1f,
-0x06,0x30,0x04,0x25,0xf5,0xaf,0x4b,0x09,0x11,0x08,0x2b,0x00,0x01,0x64,0x03,0x15,
+0xd1,0x00,0x15,0x03,0x2f,0x00,0x14,0x6f,0x14,0x01,0x15,0x0a,0x80,0x02,0x14,0xef,
+0x1d,0x01,0x14,0x4f,0x4b,0x00,0x06,0x43,0x01,0x14,0xef,0x92,0x02,0x14,0x5f,0x61,
+0x02,0x14,0x0c,0xad,0x01,0x06,0x56,0x02,0x18,0xcf,0x25,0x00,0x14,0x20,0xb6,0x05,
+0x14,0x70,0x40,0x01,0x14,0xc0,0x7a,0x02,0x14,0xf2,0x09,0x00,0x14,0xf4,0x09,0x00,
+0x14,0xf7,0x94,0x00,0x14,0xf8,0xda,0x02,0x14,0xf7,0xbb,0x04,0x13,0xe4,0x4d,0x02,
+0x27,0x5f,0xa1,0x76,0x02,0x08,0xc8,0x08,0x05,0xad,0x02,0x04,0x40,0x01,0x16,0xd0,
+0x0e,0x00,0x15,0x01,0x05,0x03,0x04,0x08,0x01,0x17,0xb0,0x0f,0x00,0x04,0xaf,0x00,
+0x05,0xc2,0x08,0x28,0x90,0x00,0xf8,0x08,0x03,0xb3,0x07,0x22,0x06,0x82,0xee,0x00,
+0x00,0xc8,0x00,0x90,0x16,0x00,0x00,0xcf,0xfb,0x50,0x00,0x00,0xbf,0xd0,0x02,0x30,
+0x04,0xaf,0xf1,0xc2,0x01,0x30,0xe8,0x10,0x0a,0x2f,0x01,0x41,0x6d,0xff,0xff,0x60,
+0x73,0x06,0x42,0xa4,0xaf,0xff,0xf5,0x23,0x07,0x00,0xe6,0x06,0x05,0x16,0x09,0x2a,
+0xf1,0x0f,0x50,0x06,0x36,0x15,0xae,0xff,0x4f,0x06,0x53,0x82,0x00,0x00,0x03,0x8c,
+0x0d,0x00,0x22,0xea,0x61,0xbb,0x00,0x10,0x5c,0x0d,0x00,0x24,0xc8,0x30,0xca,0x00,
+0x15,0xef,0x27,0x03,0x04,0x33,0x09,0x28,0xff,0xb0,0x55,0x09,0x04,0xe4,0x05,0x01,
+0x7e,0x01,0x15,0xf3,0x7b,0x04,0x00,0x11,0x01,0x24,0xf7,0x07,0x98,0x06,0x00,0x32,
+0x03,0x12,0xfc,0x05,0x00,0x04,0xfc,0x01,0x10,0x30,0x60,0x02,0x14,0xf9,0x4c,0x02,
+0x11,0x80,0x49,0x02,0x13,0xf6,0x63,0x00,0x12,0xe0,0x78,0x00,0x12,0xd0,0x9d,0x01,
+0x12,0xf4,0xde,0x04,0x11,0xb1,0x3b,0x00,0x22,0x2c,0xfa,0x05,0x02,0x13,0x60,0x13,
+0x0a,0x11,0x10,0x15,0x00,0x07,0x0c,0x09,0x0a,0x01,0x00,0x57,0x9a,0xaa,0xaa,0xaa,
+0x70,0x10,0x00,0x1a,0xef,0x79,0x0a,0x0f,0x10,0x00,0x88,0x20,0x14,0x44,0x01,0x00,
+0x00,0x10,0x00,0x11,0xc4,0x0a,0x00,0x1b,0x3f,0x19,0x08,0x0f,0x10,0x00,0x5d,0x0e,
+0x40,0x01,0x0f,0x10,0x00,0xac,0x11,0x0a,0x65,0x04,0x00,0xfe,0x09,0x0f,0x0b,0x00,
+0x0d,0x13,0xfe,0x47,0x04,0x10,0xef,0xb1,0x02,0x10,0x1f,0x45,0x03,0x11,0x06,0x1b,
+0x00,0x10,0xbf,0xc9,0x03,0x10,0x2f,0xcc,0x02,0x10,0x0a,0x18,0x05,0x11,0x02,0x63,
+0x04,0x10,0xaf,0xc7,0x02,0x21,0x02,0xaf,0xe3,0x03,0x21,0x2b,0xfb,0x2a,0x04,0x53,
+0x00,0x00,0x00,0x36,0x66,0x01,0x00,0x14,0x09,0x50,0x01,0x24,0xf0,0x9f,0x0a,0x00,
+0x0f,0x13,0x00,0x1d,0x42,0x00,0x00,0x13,0x31,0xb9,0x0b,0x40,0xb2,0x00,0x01,0xdf,
+0x0a,0x0c,0x11,0x09,0x96,0x03,0x01,0x0b,0x0d,0x00,0xa7,0x09,0x01,0xb9,0x09,0x00,
+0xfb,0x03,0x11,0x0b,0x05,0x0a,0x12,0x03,0xcd,0x0a,0xb0,0x4e,0xff,0xff,0xe5,0x00,
+0x00,0x00,0x47,0x75,0x00,0x00,0x13,0x00,0x01,0x00,0x44,0x0d,0xff,0xff,0xfe,0x0c,
+0x00,0x54,0x02,0xff,0xff,0xff,0x80,0x0d,0x00,0x4f,0x7f,0xff,0xff,0xf3,0x25,0x00,
+0x0e,0x1f,0x8f,0x25,0x00,0x45,0x1f,0xfd,0x25,0x00,0x3f,0x1f,0x03,0x25,0x00,0x46,
+0x1f,0xf2,0x25,0x00,0x3f,0x1f,0x0e,0x25,0x00,0x21,0x1f,0x70,0x25,0x00,0x3f,0x1f,
+0x9f,0x25,0x00,0x36,0x02,0x01,0x00,0x46,0x14,0x67,0x77,0x53,0x0e,0x00,0x83,0x02,
+0x8d,0xff,0xff,0xff,0xff,0xfc,0x60,0x0f,0x00,0x31,0x01,0x9f,0xff,0x01,0x00,0x13,
+0xfe,0x11,0x00,0x23,0x3e,0xff,0x01,0x00,0x15,0xfb,0x4f,0x00,0x03,0x01,0x00,0x10,
+0xc0,0x10,0x00,0x39,0x2e,0xff,0xff,0x21,0x00,0x16,0xcf,0x10,0x00,0x00,0x77,0x00,
+0x27,0x06,0xff,0x01,0x00,0x11,0xf1,0x9a,0x00,0x61,0xff,0xff,0xf9,0x30,0x00,0x5c,
+0x08,0x00,0x30,0x00,0x00,0x5f,0x08,0x00,0x50,0x50,0x00,0x00,0x00,0xaf,0x09,0x00,
+0x32,0x00,0x00,0xbf,0x17,0x00,0x01,0xa1,0x01,0x00,0x19,0x00,0x03,0x37,0x00,0x03,
+0x49,0x00,0x20,0xa0,0x04,0x06,0x00,0x11,0xb0,0xa7,0x00,0x00,0x0a,0x00,0x23,0xe0,
+0x07,0x67,0x00,0x03,0x79,0x00,0x20,0xf2,0x0a,0x10,0x00,0x14,0x40,0x10,0x01,0x30,
+0xff,0xf5,0x0c,0x10,0x00,0x14,0x20,0x4b,0x03,0x21,0xff,0xf7,0x7f,0x00,0x11,0x10,
+0x10,0x00,0x62,0x6f,0xff,0xff,0xff,0xf8,0x0f,0x76,0x00,0x22,0x00,0x00,0x8a,0x00,
+0x1f,0xfa,0x10,0x00,0x0c,0x1f,0xfb,0x10,0x00,0x8c,0x0d,0xc0,0x00,0x1b,0x0d,0xf0,
+0x00,0x01,0x10,0x01,0x16,0x30,0x10,0x01,0x14,0x0a,0x7f,0x01,0x02,0x81,0x01,0x11,
+0xf4,0x50,0x01,0x16,0x80,0x50,0x01,0x15,0x03,0xe8,0x01,0x02,0x70,0x01,0x01,0x90,
+0x01,0x16,0xf2,0x90,0x01,0x2b,0x00,0xaf,0xb0,0x01,0x10,0x4f,0x07,0x00,0x13,0x60,
+0x7f,0x01,0x12,0xff,0x17,0x00,0x00,0xf0,0x01,0x13,0x4c,0xf0,0x01,0x12,0x05,0x0a,
+0x02,0x24,0xef,0xff,0xd9,0x01,0x1a,0xbf,0x30,0x02,0x26,0x00,0x1e,0x0f,0x00,0x1b,
+0xfc,0x70,0x02,0x29,0xd1,0x00,0x71,0x02,0x25,0xfb,0x10,0xf9,0x02,0x08,0xb0,0x02,
+0x0c,0xd0,0x02,0x02,0xf0,0x02,0x1a,0x63,0x02,0x03,0x23,0x16,0xcf,0x09,0x00,0x41,
+0x05,0xbf,0xff,0xf0,0x09,0x00,0x23,0x04,0xaf,0x3a,0x01,0x50,0x02,0x8e,0xff,0xff,
+0xff,0x15,0x00,0x42,0x01,0x7d,0xff,0xff,0xc5,0x00,0x13,0x5b,0x72,0x00,0x25,0xf0,
+0x4a,0x8c,0x00,0x15,0x0c,0x0a,0x00,0x2f,0xf0,0xcf,0x15,0x00,0x0f,0x23,0xea,0x50,
+0x15,0x00,0x41,0xe9,0x40,0x00,0x0f,0x15,0x00,0x10,0xd8,0x85,0x01,0x01,0x15,0x00,
+0x01,0xc6,0x00,0x07,0xb8,0x01,0x03,0x7e,0x00,0x0f,0x15,0x00,0xff,0x2c,0x57,0x00,
+0x25,0x67,0x76,0x53,0xf0,0x01,0x02,0xb9,0x01,0x24,0xc8,0x20,0xf6,0x01,0x13,0xdf,
+0x9d,0x01,0x12,0xb2,0x10,0x00,0x15,0x1b,0xae,0x01,0x2b,0xf6,0x00,0xd5,0x04,0x1b,
+0xf7,0x10,0x00,0x24,0xff,0xf5,0xed,0x02,0x07,0xd6,0x04,0x18,0x08,0xd6,0x02,0x41,
+0xff,0x90,0x00,0x02,0x08,0x00,0x43,0xc4,0x00,0x01,0x6e,0x42,0x02,0x14,0x9f,0x58,
+0x03,0x20,0x1d,0xff,0x67,0x03,0x02,0xb5,0x00,0x10,0xa0,0x5b,0x00,0x11,0x3f,0x1a,
+0x00,0x15,0x04,0xe8,0x04,0x01,0x11,0x03,0x35,0xfa,0x00,0x7f,0x71,0x05,0x11,0x07,
+0xf3,0x04,0x16,0x0a,0xe9,0x04,0x11,0x5f,0x1b,0x03,0x13,0xcf,0x8b,0x00,0x22,0x00,
+0x00,0x14,0x05,0x66,0x07,0x99,0x99,0x99,0x99,0x20,0xfa,0x03,0x07,0xfd,0x00,0x2b,
+0x09,0xff,0x03,0x06,0x27,0xef,0xff,0x54,0x07,0x03,0x1b,0x04,0x17,0xfd,0x10,0x00,
+0x1b,0x0e,0x31,0x00,0x16,0x09,0x9e,0x00,0x06,0x72,0x00,0x17,0xf7,0x42,0x06,0x1a,
+0xff,0x41,0x00,0x26,0x01,0xdf,0x67,0x04,0x05,0x4c,0x04,0x08,0x51,0x00,0x15,0xbf,
+0xc7,0x05,0x15,0x00,0x7c,0x04,0x26,0xff,0xd0,0x10,0x00,0x01,0x2f,0x01,0x37,0xe2,
+0x00,0x00,0x26,0x07,0x09,0xb2,0x00,0x12,0x7f,0x46,0x01,0x09,0xc1,0x00,0x08,0x10,
+0x00,0x14,0x5f,0xa9,0x01,0x03,0x01,0x00,0x16,0x4f,0xdb,0x01,0x15,0x00,0x75,0x01,
+0x07,0xc1,0x00,0x01,0xe0,0x01,0x1b,0xf8,0x10,0x00,0x16,0xf9,0x10,0x00,0x2a,0x1d,
+0xff,0x53,0x01,0x0c,0x10,0x00,0x16,0x0c,0x20,0x07,0x01,0x01,0x00,0x11,0x0b,0xf7,
+0x01,0x23,0x76,0x66,0x01,0x00,0x3a,0x61,0x0a,0xff,0x01,0x00,0x2a,0x40,0xef,0x10,
+0x00,0x2f,0xf4,0x0e,0x21,0x00,0x3f,0x02,0x8a,0x01,0x46,0x46,0x77,0x65,0x42,0x98,
+0x00,0x11,0x28,0x99,0x01,0x14,0xeb,0x1b,0x05,0x14,0x2b,0x2d,0x00,0x02,0xf2,0x05,
+0x15,0x08,0x3d,0x00,0x25,0xfd,0x30,0xa6,0x01,0x06,0xf5,0x02,0x1b,0x0b,0x5f,0x00,
+0x18,0x7f,0x10,0x00,0x33,0xe1,0x00,0x01,0x87,0x05,0x02,0x07,0x00,0x13,0xf9,0x4e,
+0x00,0x42,0x93,0x00,0x01,0x6d,0x04,0x03,0x01,0xa1,0x00,0x15,0xe3,0x58,0x00,0x25,
+0x50,0x2f,0xa6,0x00,0x11,0x0e,0x35,0x03,0x15,0x5f,0x44,0x02,0x02,0xf2,0x02,0x15,
+0x6f,0x83,0x01,0x1b,0x04,0x1e,0x02,0x1b,0x02,0x10,0x00,0x06,0xa5,0x06,0x27,0x00,
+0x00,0x9b,0x06,0x0a,0x8e,0x01,0x1a,0x50,0x1e,0x02,0x16,0xfe,0x0f,0x00,0x17,0x05,
+0x1d,0x02,0x57,0x12,0x22,0x23,0x47,0xcf,0x9d,0x02,0x18,0xbf,0x8b,0x06,0x07,0x10,
+0x00,0x1a,0xb0,0x10,0x00,0x2a,0xe6,0x00,0x10,0x00,0x2b,0x91,0x00,0x30,0x00,0x1b,
+0x80,0x10,0x00,0x2a,0xfd,0x10,0x10,0x00,0x26,0xff,0xd1,0xad,0x06,0x1b,0x8e,0x4d,
+0x02,0x2b,0x00,0x9f,0xc0,0x00,0x1b,0x0a,0xf0,0x00,0x1b,0x01,0x9f,0x03,0x2a,0x00,
+0xbf,0xfe,0x02,0x2a,0x00,0x8f,0xee,0x02,0x01,0xba,0x01,0x66,0xf8,0xbc,0xcc,0xcc,
+0xcc,0xc0,0x10,0x00,0x15,0xf9,0xda,0x07,0x02,0x8f,0x03,0x26,0xf8,0xdf,0x13,0x03,
+0x10,0xef,0x50,0x00,0x15,0xaf,0x4b,0x09,0x11,0x08,0x2b,0x00,0x01,0x64,0x03,0x15,
 0xd2,0x8e,0x03,0x24,0xd0,0x0e,0xf0,0x01,0x12,0x5c,0xcc,0x07,0x19,0x07,0x10,0x02,
-0x1b,0xfe,0x7b,0x17,0x1b,0xf5,0x77,0x17,0x19,0x80,0x76,0x1f,0x26,0xff,0xf8,0x12,
-0x19,0x07,0x2a,0x19,0x14,0x5d,0x0f,0x00,0x14,0x80,0xd7,0x05,0x18,0xef,0xd0,0x02,
-0x00,0x0b,0x01,0x28,0x45,0x67,0xf0,0x02,0x06,0x2f,0x01,0x08,0x7a,0x1d,0x1c,0x4f,
-0x11,0x00,0x1b,0xdf,0x11,0x00,0x2b,0x08,0xff,0x11,0x00,0x1c,0x2f,0x11,0x00,0x1b,
-0xcf,0x11,0x00,0x03,0xe7,0x0a,0x1c,0xd0,0x0a,0x1a,0x1c,0xd0,0x74,0x1f,0x1b,0xd0,
-0x17,0x1a,0x06,0x11,0x00,0x1c,0x0d,0x11,0x00,0x1b,0x8f,0x11,0x00,0x14,0x02,0x4e,
-0x01,0x17,0xd0,0x76,0x04,0x18,0xf6,0x11,0x00,0x00,0x33,0x03,0x17,0x83,0x11,0x00,
-0x00,0xbc,0x11,0x27,0xfd,0x03,0x11,0x00,0x10,0x0a,0x2a,0x04,0x08,0x11,0x00,0x10,
-0x4f,0x2a,0x03,0x08,0x11,0x00,0x10,0xdf,0x2a,0x12,0x07,0x11,0x00,0x11,0x08,0x1c,
-0x03,0x07,0x11,0x00,0x11,0x2f,0x7c,0x02,0x07,0x11,0x00,0x11,0xcf,0x17,0x02,0x06,
-0x11,0x00,0x12,0x06,0xbf,0x01,0x06,0x11,0x00,0x03,0x4e,0x15,0x06,0x11,0x00,0x12,
-0xaf,0xf9,0x03,0x05,0x11,0x00,0x13,0x04,0x4d,0x05,0x05,0x11,0x00,0x13,0x0e,0xeb,
-0x12,0x05,0x11,0x00,0x13,0x8f,0x55,0x0a,0x04,0x11,0x00,0x01,0x55,0x15,0x00,0x5a,
-0x05,0x11,0x68,0x7e,0x03,0x4f,0x66,0x66,0x0c,0xff,0x36,0x11,0x0c,0x0e,0x11,0x00,
-0x1c,0x2f,0x11,0x00,0x1f,0x0f,0x11,0x00,0x0e,0x0c,0x64,0x05,0x06,0xe1,0x24,0x08,
-0x43,0x01,0x0f,0x11,0x00,0x84,0x08,0xb8,0x00,0x1b,0xf9,0x35,0x25,0x19,0xf9,0x68,
-0x0b,0x08,0xa9,0x0b,0x05,0x10,0x00,0x1b,0x07,0x10,0x00,0x1b,0x09,0x10,0x00,0x1b,
-0x0a,0x10,0x00,0x10,0x0c,0x36,0x05,0x13,0xaa,0x01,0x00,0x12,0xa5,0xd4,0x01,0x1a,
-0xf5,0x8b,0x15,0x09,0x84,0x08,0x1b,0x2f,0xc4,0x04,0x1a,0x4f,0x5b,0x24,0x01,0xdc,
-0x02,0x1b,0xd0,0xc4,0x04,0x1b,0xc0,0x25,0x05,0x1b,0xa0,0x04,0x05,0x75,0x80,0x16,
-0xac,0xee,0xdc,0x95,0x10,0xe4,0x03,0x12,0x9b,0xdf,0x21,0x01,0xc5,0x04,0x0b,0xf0,
-0x1b,0x09,0x0f,0x01,0x18,0x90,0xf3,0x1d,0x02,0xcf,0x02,0x1b,0x04,0x5d,0x07,0x1a,
-0x06,0x5f,0x29,0x02,0x1f,0x01,0x53,0xf9,0x41,0x01,0x27,0xdf,0x4e,0x06,0x54,0x15,
-0x9d,0xff,0xfc,0x10,0x3c,0x09,0x01,0xd8,0x06,0x26,0x15,0x70,0x09,0x04,0x1b,0x30,
-0x6d,0x09,0x1b,0x60,0x7d,0x04,0x1b,0xa0,0x6d,0x09,0x0a,0xd3,0x16,0x07,0x0f,0x28,
-0x0a,0xf6,0x0a,0x0f,0x10,0x00,0x07,0x56,0x12,0x22,0x22,0x22,0x20,0x40,0x00,0x2a,
-0xf0,0xaf,0x3f,0x0a,0x25,0xd0,0x9f,0xee,0x05,0x15,0x08,0x7e,0x07,0x17,0xfd,0x0d,
-0x0a,0x15,0x2f,0xc2,0x09,0x11,0x7f,0xc0,0x00,0x14,0x0c,0x16,0x08,0x12,0x04,0xe0,
-0x00,0x13,0x05,0xa1,0x26,0x23,0x02,0x9f,0x00,0x01,0x18,0xcf,0xfe,0x05,0x02,0xa1,
-0x28,0x09,0x3e,0x08,0x2b,0x05,0xff,0x64,0x0b,0x1b,0x5f,0x97,0x29,0x2a,0x03,0xdf,
-0x94,0x0b,0x33,0x00,0x07,0xef,0xf8,0x0d,0x14,0x20,0x75,0x05,0x01,0x3e,0x07,0x17,
-0xe9,0x4c,0x01,0x4c,0x35,0x77,0x76,0x41,0x2d,0x21,0x37,0x56,0x77,0x40,0xec,0x07,
-0x19,0xae,0xc2,0x26,0x1a,0x2a,0xd2,0x26,0x1a,0x1a,0x13,0x27,0x2a,0x05,0xef,0x10,
-0x00,0x1a,0x9f,0x33,0x27,0x18,0x0a,0x33,0x26,0x08,0xcc,0x07,0x18,0x90,0x4e,0x09,
-0x37,0xc9,0x53,0x21,0x76,0x06,0x29,0xff,0x92,0x85,0x0b,0x2a,0xff,0xc2,0xf7,0x01,
-0x1a,0xf8,0x7a,0x25,0x2a,0xff,0x80,0xf0,0x02,0x1b,0xfc,0xc4,0x0b,0x1b,0xf2,0x26,
-0x02,0x1b,0x90,0xb3,0x0b,0x74,0x30,0x01,0x5a,0xde,0xff,0xda,0x61,0x5e,0x06,0x35,
-0xfd,0x01,0x8f,0x9e,0x08,0x10,0x2f,0x09,0x03,0x13,0x3e,0x4f,0x07,0x12,0x30,0x9e,
-0x00,0x17,0xfc,0x54,0x29,0x19,0x7f,0xe0,0x02,0x15,0x20,0xfc,0x00,0x04,0xff,0x08,
-0x19,0xbf,0x10,0x00,0x13,0xf6,0xef,0x01,0x32,0xfb,0x86,0x79,0xcc,0x28,0x02,0x53,
-0x07,0x24,0xfc,0x20,0x28,0x04,0x25,0x40,0xdf,0xd6,0x02,0x11,0x8f,0x0a,0x00,0x28,
-0xef,0xff,0xf7,0x1d,0x35,0xff,0xd0,0xef,0xc1,0x0b,0x11,0x05,0xce,0x08,0x07,0xa3,
-0x0c,0x01,0x92,0x00,0x16,0xdf,0x10,0x00,0x01,0xde,0x08,0x07,0x10,0x00,0x01,0x6f,
-0x2f,0x16,0xcf,0x10,0x00,0x01,0xee,0x08,0x01,0xce,0x10,0x07,0x20,0x00,0x07,0x03,
-0x09,0x01,0xfb,0x02,0x07,0x24,0x0d,0x01,0x4b,0x00,0x06,0xa5,0x28,0x11,0x02,0x80,
-0x00,0x28,0x0c,0xff,0x04,0x1b,0x35,0xff,0xd0,0x06,0x85,0x28,0x12,0x3f,0x99,0x01,
-0x01,0xe0,0x00,0x14,0x10,0xb6,0x08,0x12,0x20,0x31,0x01,0x43,0xe6,0x10,0x01,0x7f,
-0x1b,0x0c,0x09,0x23,0x0e,0x1b,0xf2,0x60,0x05,0x15,0x70,0xe5,0x29,0x03,0x71,0x26,
-0x06,0x43,0x08,0x06,0xfe,0x03,0x19,0x5e,0x0d,0x09,0x01,0xbd,0x2f,0x02,0x8c,0x0a,
-0x04,0xf1,0x02,0x02,0xaa,0x10,0x17,0xe9,0xdf,0x02,0x24,0x24,0x67,0x0d,0x24,0x1b,
-0x1f,0xaa,0x06,0x1f,0xf0,0x11,0x00,0x41,0x1c,0xd0,0x11,0x00,0x35,0x70,0x07,0x77,
-0x01,0x00,0x1a,0x7c,0x3d,0x2a,0x02,0x49,0x04,0x2b,0xf9,0x00,0xd3,0x05,0x1a,0xf2,
-0xe2,0x26,0x0a,0x25,0x18,0x16,0x05,0xc9,0x0c,0x06,0xf2,0x08,0x1b,0xfd,0x65,0x2c,
-0x0a,0xc7,0x28,0x1b,0xbf,0xfd,0x04,0x1b,0x02,0x18,0x03,0x02,0xcf,0x01,0x1b,0x20,
-0xe3,0x28,0x1c,0xfb,0x09,0x29,0x09,0x94,0x27,0x1b,0xef,0x7b,0x06,0x1b,0x07,0xb2,
-0x05,0x02,0x23,0x05,0x08,0x32,0x00,0x1c,0x5f,0xf1,0x23,0x1b,0xcf,0xeb,0x00,0x06,
-0xc8,0x14,0x08,0xa4,0x0c,0x1b,0x40,0x10,0x07,0x1c,0xfd,0xb5,0x29,0x08,0xeb,0x00,
-0x0d,0x08,0x06,0x1b,0x08,0x32,0x04,0x02,0x65,0x10,0x1b,0x20,0x34,0x07,0x1c,0xfa,
-0xda,0x00,0x08,0xeb,0x00,0x1c,0x06,0x3f,0x08,0x1c,0x0d,0xeb,0x00,0x01,0xd3,0x25,
-0x0c,0xda,0x00,0x09,0x57,0x26,0x0c,0x8d,0x0c,0x1b,0x0a,0xd0,0x06,0x02,0x0a,0x06,
-0x1b,0x30,0xbb,0x07,0x1c,0xfc,0xda,0x00,0x1c,0xf6,0x71,0x01,0x1c,0xe0,0x71,0x01,
-0x1b,0x80,0x4b,0x02,0x09,0x6d,0x02,0x01,0xb0,0x33,0x0c,0x0b,0x06,0x37,0x57,0x76,
-0x54,0xa9,0x00,0x14,0xae,0x7a,0x1d,0x06,0x6c,0x27,0x07,0x43,0x2d,0x15,0x8f,0x7c,
-0x0c,0x05,0x26,0x1f,0x08,0x8f,0x06,0x1a,0x9f,0xce,0x06,0x1a,0x04,0x0e,0x08,0x28,
-0x00,0x0d,0x11,0x12,0x13,0xf8,0x35,0x04,0x22,0xf9,0x20,0x07,0x15,0x13,0xfe,0x5e,
-0x00,0x14,0x60,0x35,0x06,0x11,0x30,0x46,0x01,0x15,0xfb,0xb8,0x03,0x16,0x70,0x99,
-0x01,0x12,0x09,0xc0,0x02,0x0b,0x07,0x17,0x06,0xe4,0x07,0x03,0x49,0x02,0x05,0x10,
-0x00,0x12,0x05,0x20,0x00,0x05,0x1f,0x05,0x03,0xd1,0x15,0x05,0xdf,0x07,0x12,0x0c,
-0xb1,0x00,0x14,0x3f,0x30,0x01,0x03,0x0c,0x0f,0x13,0x0b,0xcd,0x0d,0x13,0x04,0xe1,
-0x00,0x02,0xff,0x08,0x34,0xa7,0x68,0xcf,0x6b,0x0e,0x07,0x9e,0x07,0x01,0xbc,0x0e,
-0x1c,0x05,0x97,0x15,0x19,0x2c,0xb2,0x2f,0x07,0x30,0x0a,0x2a,0xe4,0x00,0xce,0x07,
-0x02,0x0c,0x02,0x1a,0x4f,0x50,0x00,0x19,0x04,0x57,0x04,0x03,0x3f,0x0d,0x47,0xf9,
-0x31,0x01,0x5c,0xae,0x26,0x24,0xfe,0x20,0xe9,0x01,0x25,0x40,0x01,0x10,0x12,0x11,
-0x08,0xa1,0x00,0x16,0x07,0xe6,0x03,0x01,0x18,0x07,0x1a,0x0b,0x07,0x18,0x1b,0xf6,
-0xf7,0x17,0x1e,0xf9,0x37,0x17,0x09,0x20,0x00,0x26,0xfb,0x0f,0xa3,0x02,0x15,0x9f,
-0x47,0x17,0x16,0x80,0x83,0x2e,0x1a,0x0a,0x07,0x17,0x25,0xf5,0x06,0x18,0x01,0x11,
-0x4f,0xaa,0x01,0x02,0x4e,0x0a,0x43,0xe7,0x20,0x00,0x39,0x29,0x19,0x19,0x9f,0x21,
-0x14,0x03,0x5d,0x27,0x07,0x38,0x19,0x1a,0x04,0x4c,0x11,0x09,0x70,0x01,0x2a,0xfe,
-0x20,0x40,0x01,0x12,0xb1,0xee,0x03,0x04,0x2e,0x0f,0x14,0xd5,0xbc,0x03,0x11,0xbe,
-0x2d,0x00,0x19,0xa4,0x0e,0x06,0x29,0x54,0x10,0xf7,0x19,0x2c,0x76,0x41,0xf7,0x19,
-0x2b,0xd7,0x10,0xf7,0x19,0x04,0x28,0x10,0x14,0x4e,0x6f,0x00,0x18,0xc2,0xe1,0x0e,
-0x05,0xf0,0x28,0x07,0xa0,0x00,0x05,0xaa,0x0d,0x07,0x2c,0x11,0x1b,0x0c,0xee,0x06,
-0x11,0x6f,0x08,0x03,0x33,0x10,0x02,0x8f,0x20,0x03,0x04,0x21,0x14,0x12,0x03,0x73,
-0x00,0x15,0x04,0xb0,0x13,0x02,0x78,0x0a,0x15,0x09,0xe2,0x10,0x02,0xb1,0x18,0x15,
-0x0d,0x02,0x11,0x16,0x06,0xda,0x33,0x06,0x2c,0x04,0x17,0xc0,0x2d,0x05,0x10,0xef,
-0x0a,0x03,0x01,0xce,0x08,0x06,0xa0,0x04,0x26,0xf1,0x4f,0xe4,0x05,0x10,0xbf,0x3a,
-0x02,0x07,0x10,0x00,0x01,0x29,0x08,0x16,0x3f,0x40,0x00,0x01,0x1e,0x08,0x07,0xb3,
-0x30,0x01,0x10,0x00,0x1a,0x0f,0x27,0x19,0x26,0xf6,0x0b,0x82,0x11,0x15,0xdf,0xed,
-0x37,0x15,0xf5,0xb0,0x03,0x25,0xf5,0x02,0x83,0x13,0x12,0x9f,0x1a,0x00,0x11,0xbf,
-0xc8,0x02,0x33,0x41,0x02,0x6d,0x60,0x09,0x1a,0x4f,0xbd,0x13,0x0b,0xe5,0x35,0x01,
-0xe6,0x36,0x08,0x79,0x07,0x06,0x2d,0x11,0x32,0xfe,0xef,0xff,0x97,0x21,0x03,0xaf,
-0x04,0x14,0xd2,0x49,0x06,0x12,0x06,0x7b,0x2b,0x15,0x01,0xaa,0x02,0x6c,0x05,0x9c,
-0xef,0xfd,0xb6,0x10,0x43,0x07,0x1b,0x0b,0xab,0x06,0x1b,0x2f,0x28,0x05,0x1a,0xbf,
-0x12,0x06,0x1b,0x07,0x11,0x06,0x1a,0x6f,0x8b,0x12,0x28,0x2b,0xff,0xbb,0x05,0x27,
-0x02,0x5b,0x07,0x2e,0x39,0x06,0xbb,0xcd,0xd3,0x33,0x19,0x08,0xed,0x08,0x07,0x10,
-0x00,0x1a,0xa0,0x10,0x00,0x1a,0xf9,0x62,0x2f,0x2a,0xfe,0x50,0x10,0x00,0x19,0x91,
-0xee,0x06,0x27,0xfd,0x71,0xfe,0x06,0x36,0xfe,0xdb,0x96,0xed,0x06,0x22,0x47,0x74,
-0xc4,0x02,0x12,0xe4,0x63,0x02,0x12,0x30,0xb2,0x01,0x16,0x0f,0xc7,0x08,0x12,0xf1,
-0x0c,0x00,0x02,0x9e,0x06,0x21,0x01,0xef,0xd8,0x02,0x12,0x2b,0x11,0x18,0x01,0xd6,
-0x1f,0x0f,0x01,0x00,0x42,0x01,0x5a,0x00,0x10,0x1b,0xc3,0x03,0x01,0x72,0x00,0x12,
-0x10,0x7e,0x00,0x0e,0x96,0x00,0x07,0x30,0x20,0x12,0x30,0xc6,0x00,0x03,0xd2,0x00,
-0x42,0x00,0x02,0x67,0x62,0x8e,0x06,0x12,0xf9,0xcc,0x01,0x12,0xfa,0x3c,0x03,0x12,
-0xf3,0x52,0x06,0x22,0x70,0x09,0x43,0x01,0x02,0x0d,0x00,0x12,0x02,0x4c,0x02,0x22,
-0x08,0xff,0x68,0x36,0x12,0xef,0xa7,0x14,0x3f,0x34,0x20,0x00,0x01,0x00,0x5e,0x42,
-0xab,0xbb,0xbb,0xb7,0x90,0x08,0x14,0xa0,0x50,0x29,0x0f,0x0d,0x00,0x0b,0x11,0x90,
-0x0d,0x00,0x12,0xf8,0xa0,0x02,0x14,0x50,0xff,0x29,0x11,0x9f,0x6d,0x02,0x02,0x44,
-0x2a,0x12,0x05,0x18,0x03,0x02,0xa4,0x2a,0x11,0x4f,0xc5,0x06,0x12,0x0d,0xeb,0x02,
-0x03,0x08,0x30,0x12,0x19,0x5a,0x02,0x2f,0x02,0x80,0x9a,0x00,0x0a,0x28,0x02,0x88,
-0x96,0x09,0x27,0xbf,0xf9,0x0c,0x09,0x17,0xdf,0xae,0x0a,0x27,0x28,0xef,0xbc,0x0a,
-0x18,0x4a,0xa8,0x02,0x17,0x6d,0xb6,0x02,0x27,0x01,0x8e,0xc4,0x02,0x27,0x03,0xaf,
-0xd2,0x02,0x27,0x05,0xcf,0x1f,0x07,0x25,0x18,0xef,0x0c,0x03,0x35,0x40,0x00,0x3a,
-0xe6,0x03,0x17,0xb5,0x45,0x07,0x27,0xfd,0x71,0x64,0x05,0x27,0xe8,0x30,0x72,0x05,
-0x17,0xa4,0xe2,0x18,0x28,0xfb,0x60,0xf0,0x18,0x19,0x70,0xfe,0x18,0x04,0x29,0x00,
-0x04,0x38,0x00,0x16,0xe9,0x62,0x35,0x06,0xf8,0x08,0x15,0x06,0x67,0x04,0x21,0xc6,
-0x10,0x00,0x01,0x05,0x93,0x06,0x00,0x77,0x03,0x02,0xcc,0x0f,0x06,0x7a,0x36,0x1a,
-0x6d,0xe3,0x07,0x1a,0x4b,0xb2,0x03,0x1a,0x29,0xc0,0x03,0x29,0x07,0xdf,0x44,0x19,
-0x29,0x04,0xbf,0xfe,0x0b,0x29,0x02,0x9f,0x0c,0x0c,0x2a,0x01,0x7e,0x1a,0x0c,0x29,
-0x5c,0xf9,0xa5,0x01,0x1a,0x25,0xb6,0x2d,0x19,0x3c,0x0e,0x00,0x1f,0xf3,0x1d,0x00,
-0x35,0x28,0x36,0x88,0x01,0x00,0x1f,0x81,0xfc,0x02,0x35,0x1a,0x06,0x57,0x00,0x0f,
-0xcb,0x00,0x52,0x29,0x30,0x3a,0x5b,0x30,0x2a,0x4f,0xfd,0xc3,0x0b,0x2a,0xfe,0x82,
-0xd1,0x0b,0x1a,0xb4,0x1b,0x17,0x19,0xd6,0x0e,0x00,0x00,0xb7,0x0a,0x17,0x00,0xb3,
-0x09,0x38,0xfb,0x40,0x00,0xc1,0x09,0x25,0xfd,0x70,0x15,0x0f,0x05,0xe1,0x10,0x25,
-0x01,0x7c,0x0f,0x00,0x17,0xb4,0x2e,0x37,0x04,0x6f,0x08,0x2a,0x03,0x9e,0x49,0x02,
-0x05,0x56,0x1f,0x05,0x93,0x1f,0x08,0x5d,0x15,0x29,0x01,0x6c,0x6b,0x15,0x27,0x03,
-0xbf,0x0e,0x00,0x12,0x27,0x59,0x00,0x08,0x28,0x00,0x28,0xff,0xff,0x44,0x00,0x01,
-0x0e,0x00,0x17,0x49,0x8e,0x00,0x25,0x02,0x8e,0xc8,0x08,0x13,0x82,0xa4,0x02,0x04,
-0x7d,0x39,0x17,0x4f,0x96,0x03,0x06,0x0e,0x00,0x27,0xe8,0x10,0xee,0x00,0x18,0xd6,
-0x0a,0x01,0x18,0xa3,0x13,0x0d,0x17,0x81,0x34,0x01,0x27,0xfc,0x60,0x50,0x01,0x27,
-0xfa,0x30,0x6c,0x01,0x28,0xe8,0x10,0xd6,0x02,0x0e,0x2c,0x02,0x45,0x04,0x56,0x77,
-0x64,0x9f,0x05,0x21,0x18,0xdf,0x0e,0x2a,0x19,0x40,0xfd,0x0f,0x21,0xff,0xd4,0x28,
-0x00,0x18,0xef,0x1c,0x10,0x19,0x04,0x79,0x15,0x1a,0x02,0x59,0x13,0x19,0xcf,0xaa,
-0x1e,0x19,0x5f,0x74,0x19,0x11,0x0b,0x08,0x01,0x32,0x61,0x00,0x4b,0x96,0x0c,0x04,
-0xc5,0x0a,0x11,0x09,0x38,0x06,0x14,0x4f,0x3e,0x0e,0x01,0x93,0x06,0x15,0x56,0xf2,
-0x08,0x01,0xbb,0x31,0x14,0x8f,0x50,0x0c,0x01,0x87,0x07,0x10,0x83,0x8b,0x17,0x14,
-0x20,0x36,0x0d,0x1a,0xf8,0xfb,0x0d,0x1f,0x60,0x77,0x1e,0x04,0x19,0x6f,0x4a,0x0e,
-0x19,0x1e,0xd2,0x0d,0x19,0x0c,0x45,0x0e,0x19,0x0c,0x10,0x0e,0x19,0x1c,0x7c,0x1d,
-0x19,0x1d,0x82,0x08,0x18,0x0d,0x5c,0x1b,0x29,0x00,0x0a,0x0e,0x00,0x14,0x05,0xb2,
-0x11,0x06,0x21,0x0e,0x16,0xfc,0xbd,0x2e,0x08,0x2a,0x00,0x03,0x3d,0x13,0x09,0xe3,
-0x0e,0x19,0xa0,0x56,0x0f,0x07,0x22,0x09,0x0a,0x79,0x0e,0x05,0xd1,0x2d,0x05,0x7d,
-0x10,0x1f,0xfd,0x46,0x04,0x33,0x1b,0x22,0x2b,0x34,0x1a,0x91,0x8d,0x1e,0x1a,0xd1,
-0xe0,0x10,0x19,0x90,0x74,0x01,0x1a,0xfe,0x12,0x10,0x06,0xa0,0x00,0x0a,0xc4,0x18,
-0x1a,0x0b,0x94,0x10,0x1a,0x3f,0xa1,0x17,0x03,0x86,0x08,0x05,0xaa,0x02,0x08,0x56,
-0x15,0x05,0x01,0x00,0x2f,0x12,0x21,0xbd,0x00,0x02,0x30,0x01,0x58,0xbe,0x0a,0x01,
-0x1e,0xa8,0x33,0x00,0x15,0x6b,0x74,0x03,0x07,0xe0,0x1c,0x0a,0x8c,0x1e,0x06,0xe2,
-0x0c,0x02,0x01,0x00,0x19,0x7e,0xee,0x3d,0x07,0x5e,0x03,0x04,0x13,0x0b,0x0a,0x4b,
-0x3e,0x06,0xc9,0x15,0x68,0xc8,0x52,0x10,0x00,0x13,0x59,0xde,0x1d,0x03,0x4f,0x0c,
-0x23,0xe7,0x10,0x4e,0x04,0x08,0xa5,0x2a,0x10,0x06,0x39,0x01,0x19,0x70,0x3b,0x11,
-0x16,0xb0,0x1a,0x00,0x04,0x7c,0x24,0x04,0xfa,0x0e,0x15,0x70,0xfc,0x10,0x1c,0xf8,
-0xd7,0x37,0x14,0x30,0x8a,0x1b,0x1c,0xf6,0xf2,0x37,0x25,0xfd,0x00,0x52,0x38,0x09,
-0x01,0x00,0x13,0x1e,0x2c,0x00,0x1e,0x4f,0xc3,0x10,0x12,0x3f,0x08,0x11,0x06,0xbe,
-0x28,0x33,0x01,0x47,0x88,0x0d,0x38,0x11,0xaf,0x99,0x0b,0x15,0x06,0xba,0x02,0x01,
-0x59,0x08,0x22,0xd8,0x10,0x87,0x02,0x12,0xfb,0xf2,0x02,0x18,0xa0,0xc8,0x16,0x12,
-0x70,0x86,0x00,0x11,0xf1,0x69,0x00,0x18,0xf2,0x70,0x36,0x01,0xc0,0x36,0x01,0xa9,
-0x40,0x13,0x0b,0x83,0x00,0x06,0x9c,0x1d,0x13,0x60,0x38,0x2f,0x14,0x01,0x58,0x0c,
-0x17,0xdf,0x36,0x16,0x20,0x00,0x0b,0xa0,0x00,0x17,0x6f,0xe8,0x1b,0x32,0xa4,0x10,
-0x16,0x92,0x00,0x00,0x1b,0x04,0x23,0x10,0x0b,0x20,0x01,0x12,0x4f,0x46,0x0c,0x12,
-0x3f,0xe5,0x03,0x10,0x04,0x3c,0x00,0x03,0x26,0x00,0x12,0x0d,0x1a,0x00,0x00,0xd3,
-0x04,0x03,0x9f,0x0c,0x22,0x60,0x4f,0xf4,0x00,0x13,0x05,0xd8,0x02,0x13,0x5f,0xc2,
-0x02,0x02,0xd7,0x2e,0x04,0x74,0x28,0x12,0xf1,0xad,0x0c,0x13,0xfd,0xe6,0x02,0x22,
-0x90,0xaf,0x4e,0x04,0x13,0x2f,0x22,0x00,0x13,0x8f,0xbd,0x04,0x11,0xef,0xcc,0x0f,
-0x04,0xa2,0x36,0x12,0x50,0x25,0x04,0x13,0xfa,0x53,0x12,0x13,0xa0,0xf1,0x04,0x03,
-0x4f,0x00,0x00,0xea,0x04,0x13,0x90,0x35,0x00,0x00,0x80,0x35,0x02,0x5a,0x00,0x13,
-0xfd,0x92,0x04,0x13,0xf8,0x35,0x00,0x12,0xa2,0xaa,0x00,0x14,0x04,0x76,0x03,0x01,
-0x6a,0x3c,0x01,0x9f,0x00,0x13,0xf9,0xad,0x01,0x13,0x6f,0xe1,0x01,0x00,0xd0,0x35,
-0x03,0x08,0x00,0x12,0x74,0x48,0x00,0x13,0x09,0x84,0x00,0x03,0x4c,0x01,0x00,0xa9,
-0x01,0x22,0xf6,0x4f,0x3d,0x01,0x13,0xbf,0x7d,0x03,0x12,0x2f,0x9b,0x01,0x00,0x32,
-0x01,0x12,0x44,0xe9,0x04,0x04,0x54,0x02,0x13,0x03,0x79,0x04,0x12,0x07,0xe0,0x0e,
-0x12,0xd0,0xb9,0x00,0x27,0xf2,0x00,0x23,0x01,0x42,0xbf,0xff,0xfd,0x04,0xff,0x03,
-0x13,0x0c,0x35,0x00,0x00,0x09,0x30,0x04,0x8c,0x42,0x12,0x2f,0x26,0x00,0x13,0xbf,
+0x1a,0xfe,0x1a,0x0a,0x2a,0xff,0xf5,0x55,0x05,0x00,0x21,0x01,0x17,0x02,0xd3,0x02,
+0x01,0x79,0x00,0x15,0x1a,0x0f,0x00,0x12,0xfe,0xce,0x02,0x14,0x5d,0x0f,0x00,0x14,
+0x80,0xd7,0x05,0x18,0xef,0xd0,0x02,0x00,0x0b,0x01,0xa0,0x45,0x67,0x65,0x42,0x00,
+0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x01,0x00,0x76,0x0a,0xff,0xff,0xff,0xff,0xd0,
+0x00,0x01,0x00,0x1c,0x4f,0x11,0x00,0x1b,0xdf,0x11,0x00,0x2b,0x08,0xff,0x11,0x00,
+0x1c,0x2f,0x11,0x00,0x1b,0xcf,0x11,0x00,0x2b,0x06,0xff,0x11,0x00,0x1c,0x1e,0x11,
+0x00,0x1b,0xaf,0x11,0x00,0x2b,0x04,0xff,0x11,0x00,0x1c,0x0d,0x11,0x00,0x1b,0x8f,
+0x11,0x00,0x58,0x02,0xff,0xff,0xff,0xfe,0x11,0x00,0x58,0x0c,0xff,0xff,0xff,0xf6,
+0x11,0x00,0x57,0x6f,0xff,0xff,0xff,0x83,0x11,0x00,0x67,0x01,0xef,0xff,0xff,0xfd,
+0x03,0x11,0x00,0x00,0x0b,0x01,0x18,0xf4,0x11,0x00,0x00,0x0b,0x01,0x17,0xa0,0x11,
+0x00,0x00,0x0b,0x01,0x27,0xfe,0x10,0x11,0x00,0x10,0x08,0x64,0x00,0x17,0x00,0x11,
+0x00,0x00,0x0b,0x01,0x18,0xc0,0x11,0x00,0x00,0x0b,0x01,0x17,0x20,0x11,0x00,0x00,
+0x0b,0x01,0x27,0xf8,0x00,0x11,0x00,0x12,0x1f,0x09,0x00,0x06,0x11,0x00,0x00,0x0b,
+0x01,0x17,0x40,0x11,0x00,0x00,0x0b,0x01,0x27,0xfa,0x00,0x11,0x00,0x58,0x0e,0xff,
+0xff,0xff,0xe1,0x11,0x00,0x00,0x0b,0x01,0x17,0x60,0x11,0x00,0x10,0x03,0x0b,0x01,
+0x50,0x66,0x66,0x66,0x66,0x68,0x11,0x00,0x5b,0xe6,0x66,0x66,0x0c,0xff,0x01,0x00,
+0x1f,0x3f,0x11,0x00,0x0e,0x1c,0x2f,0x11,0x00,0x1f,0x0f,0x11,0x00,0x0e,0x1c,0x0e,
+0x11,0x00,0x05,0xde,0x01,0x08,0x43,0x01,0x0f,0x11,0x00,0x84,0x08,0xb8,0x00,0x4b,
+0xf9,0x00,0x00,0x01,0x10,0x00,0x1b,0x03,0x10,0x00,0x1b,0x05,0x10,0x00,0x1b,0x07,
+0x10,0x00,0x1b,0x09,0x10,0x00,0x1b,0x0a,0x10,0x00,0x00,0x92,0x01,0x23,0xfc,0xaa,
+0x01,0x00,0x12,0xa5,0xd4,0x01,0x17,0xf5,0x99,0x00,0x00,0x5d,0x01,0x2a,0xf3,0x00,
+0x63,0x03,0x1b,0xf1,0xa5,0x03,0x17,0xf0,0x10,0x00,0x1b,0x6f,0xd9,0x00,0x11,0x7f,
+0x88,0x02,0x06,0x01,0x00,0x10,0x9f,0xca,0x02,0x07,0x10,0x00,0xb5,0xbf,0xff,0xff,
+0xff,0x80,0x16,0xac,0xee,0xdc,0x95,0x10,0xe4,0x03,0x11,0x9b,0x9d,0x00,0x2b,0xfa,
+0x20,0x0f,0x01,0x2b,0xf7,0x00,0x0f,0x01,0x12,0x90,0x6d,0x03,0x05,0x01,0x00,0x16,
+0xf8,0xaf,0x03,0x02,0x01,0x00,0x39,0x40,0x00,0x06,0x10,0x00,0x12,0xe0,0x1f,0x01,
+0x61,0xf9,0x41,0x01,0x27,0xdf,0xff,0x32,0x03,0x73,0x00,0x15,0x9d,0xff,0xfc,0x10,
+0x00,0x28,0x01,0x10,0xfd,0x72,0x00,0x26,0x15,0x70,0x09,0x04,0x16,0x30,0xa9,0x00,
+0x01,0x55,0x02,0x1b,0x60,0x7d,0x04,0x07,0xca,0x00,0x1b,0x04,0xd3,0x01,0x12,0x01,
+0x71,0x00,0x06,0x01,0x00,0x1b,0xff,0x2a,0x01,0x0f,0x10,0x00,0x02,0x56,0x12,0x22,
+0x22,0x22,0x20,0x40,0x00,0x25,0xf0,0xaf,0x8f,0x01,0x02,0x60,0x00,0x12,0x9f,0xe7,
+0x00,0x04,0x80,0x00,0x24,0xb0,0x6f,0xb6,0x00,0x02,0xa0,0x00,0x21,0x70,0x2f,0x06,
+0x00,0x04,0x79,0x01,0x21,0xff,0x30,0x71,0x03,0x14,0xf5,0x3f,0x00,0x13,0xfd,0x2f,
+0x02,0x43,0xa3,0x00,0x02,0x9f,0x00,0x01,0x02,0x22,0x05,0x15,0xfe,0xc3,0x04,0x1a,
+0x2f,0x40,0x01,0x2b,0x00,0x05,0x81,0x01,0x26,0x00,0x5f,0x10,0x00,0x11,0x80,0xba,
+0x02,0x14,0xdf,0x0f,0x00,0x12,0xf6,0xc8,0x00,0x22,0x07,0xef,0x0f,0x00,0x24,0xfb,
+0x20,0x75,0x05,0x10,0xbf,0x0f,0x00,0x17,0xe9,0x4c,0x01,0x5a,0x35,0x77,0x76,0x41,
+0x00,0x01,0x00,0x46,0x14,0x56,0x77,0x40,0x0e,0x00,0x22,0x05,0xae,0xdf,0x01,0x03,
+0x01,0x00,0x38,0x2a,0xff,0xff,0x10,0x00,0x29,0x1a,0xff,0x10,0x00,0x2a,0x05,0xef,
+0x10,0x00,0x16,0x9f,0x1f,0x02,0x05,0x58,0x06,0x07,0x10,0x00,0x1a,0xbf,0x10,0x00,
+0x12,0x08,0x0d,0x00,0x37,0xc9,0x53,0x21,0x76,0x06,0x25,0xff,0x92,0x7c,0x00,0x01,
+0x5d,0x00,0x1a,0xc2,0xf7,0x01,0x16,0xf8,0xaa,0x00,0x15,0x1f,0x09,0x01,0x06,0xf0,
+0x02,0x39,0xfc,0x00,0x00,0x3f,0x00,0x1b,0xf2,0x26,0x02,0x06,0xd9,0x00,0x02,0x77,
+0x02,0x74,0x30,0x01,0x5a,0xde,0xff,0xda,0x61,0x5e,0x06,0x22,0xfd,0x01,0x53,0x06,
+0x13,0x91,0x6f,0x03,0x32,0xfa,0x3e,0xff,0xa5,0x01,0x12,0x30,0x9e,0x00,0x14,0xfc,
+0xc1,0x00,0x13,0xf4,0xe6,0x01,0x05,0x01,0x00,0x39,0x20,0x00,0x9f,0x10,0x00,0x16,
+0xb0,0xed,0x00,0x03,0xa2,0x01,0x12,0xcf,0x9b,0x01,0x32,0x86,0x79,0xef,0x10,0x02,
+0x01,0xbd,0x01,0x24,0xfc,0x20,0x28,0x04,0x25,0x40,0xdf,0xd6,0x02,0x11,0x8f,0x0a,
+0x00,0x15,0xef,0x60,0x02,0x11,0x0c,0x21,0x02,0x12,0xef,0x77,0x00,0x13,0x00,0x19,
+0x02,0x26,0xf1,0xef,0x1f,0x04,0x01,0x92,0x00,0x16,0xdf,0x10,0x00,0x10,0xbf,0x7a,
+0x02,0x07,0x10,0x00,0x10,0x9f,0x81,0x00,0x16,0xcf,0x10,0x00,0x10,0x8f,0x52,0x02,
+0x15,0xaf,0x50,0x00,0x02,0x20,0x00,0x01,0x15,0x00,0x06,0x8a,0x07,0x23,0xf5,0x5f,
+0x74,0x06,0x03,0x1a,0x04,0x25,0xf3,0x1f,0xcf,0x05,0x11,0x02,0x80,0x00,0x15,0x0c,
+0x96,0x03,0x11,0x09,0xa0,0x00,0x23,0x06,0xff,0x94,0x06,0x22,0x00,0x3f,0x99,0x01,
+0x00,0xe0,0x00,0x00,0xe1,0x03,0x22,0x02,0xef,0x21,0x01,0x11,0x7f,0x8a,0x06,0x42,
+0x10,0x01,0x7f,0xff,0x5a,0x00,0x18,0x0d,0x20,0x01,0x1b,0xf2,0x60,0x05,0x13,0x70,
+0xd1,0x04,0x03,0x01,0x00,0x17,0xfa,0x43,0x08,0x06,0xfe,0x03,0x17,0x5e,0x7f,0x04,
+0x01,0xb9,0x03,0x03,0x43,0x08,0x24,0xfc,0x30,0x11,0x08,0x11,0x8e,0x00,0x03,0x07,
+0xdf,0x02,0x47,0x24,0x67,0x76,0x52,0x3f,0x02,0x07,0x01,0x00,0x1f,0xf0,0x11,0x00,
+0x41,0x1c,0xd0,0x11,0x00,0x35,0x70,0x07,0x77,0x01,0x00,0x10,0x7c,0x11,0x00,0x2a,
+0x10,0x00,0xe9,0x04,0x2b,0xf9,0x00,0xd3,0x05,0x2b,0xf2,0x00,0x88,0x09,0x17,0xb0,
+0x10,0x00,0x01,0x0b,0x02,0x07,0xdf,0x00,0x01,0x2c,0x02,0x18,0xfd,0x32,0x00,0x16,
+0x3f,0x1f,0x04,0x06,0x1d,0x02,0x08,0xfd,0x04,0x1b,0x02,0x18,0x03,0x22,0x00,0x09,
+0xaf,0x01,0x0a,0x69,0x03,0x18,0xfb,0x43,0x00,0x16,0x8f,0x3b,0x02,0x06,0x6b,0x03,
+0x08,0x7b,0x06,0x1b,0x07,0xb2,0x05,0x02,0x23,0x05,0x08,0x32,0x00,0x1a,0x5f,0xcc,
+0x03,0x02,0x0e,0x05,0x2b,0xf2,0x00,0xaf,0x03,0x08,0xeb,0x00,0x1c,0x0b,0xeb,0x00,
+0x1c,0x2f,0xeb,0x00,0x1b,0xaf,0xeb,0x00,0x0d,0x08,0x06,0x1b,0x08,0x32,0x04,0x2c,
+0x00,0x0f,0xeb,0x00,0x16,0x7f,0xf5,0x02,0x06,0xda,0x00,0x08,0xeb,0x00,0x1c,0x06,
+0x3f,0x08,0x1c,0x0d,0xeb,0x00,0x10,0x4f,0x30,0x04,0x0c,0xda,0x00,0x1c,0xf8,0x71,
+0x08,0x08,0xc9,0x07,0x1b,0x0a,0xd0,0x06,0x02,0x0a,0x06,0x1b,0x30,0xbb,0x07,0x1c,
+0xfc,0xda,0x00,0x1c,0xf6,0x71,0x01,0x1c,0xe0,0x71,0x01,0x1b,0x80,0x4b,0x02,0x2b,
+0xff,0x10,0x4b,0x02,0x1c,0xfa,0x0b,0x06,0x37,0x57,0x76,0x54,0xa9,0x00,0x11,0xae,
+0xaa,0x04,0x14,0x82,0x92,0x01,0x13,0xcf,0xc4,0x02,0x1a,0xa1,0x7e,0x0b,0x39,0xff,
+0xfe,0x50,0xed,0x05,0x03,0x9a,0x00,0x1a,0x9f,0xce,0x06,0x1a,0x04,0x0e,0x08,0x04,
+0xfe,0x03,0x14,0xef,0xc0,0x03,0x11,0x3f,0x1f,0x08,0x31,0x20,0x00,0x4c,0x52,0x00,
+0x03,0x5e,0x00,0x14,0x60,0x35,0x06,0x11,0x30,0x46,0x01,0x15,0xfb,0xb8,0x03,0x16,
+0x70,0x99,0x01,0x12,0x09,0xc0,0x02,0x05,0x55,0x01,0x12,0x06,0x4e,0x01,0x05,0xe4,
+0x07,0x03,0x49,0x02,0x05,0x10,0x00,0x12,0x05,0x20,0x00,0x05,0x1f,0x05,0x12,0x07,
+0x2a,0x01,0x05,0xdf,0x07,0x12,0x0c,0xb1,0x00,0x14,0x3f,0x30,0x01,0x12,0x5f,0x90,
+0x00,0x01,0x7f,0x02,0x13,0xd2,0x4f,0x00,0x14,0xf6,0xff,0x08,0x21,0xa7,0x68,0x15,
+0x01,0x1a,0xc0,0x9e,0x07,0x39,0xfd,0x10,0x00,0xbf,0x07,0x11,0xd1,0x30,0x01,0x17,
+0x2c,0xfc,0x09,0x27,0x00,0x00,0x30,0x0a,0x2a,0xe4,0x00,0xce,0x07,0x02,0x0c,0x02,
+0x1a,0x4f,0x50,0x00,0x19,0x04,0x57,0x04,0x03,0x3f,0x0d,0x43,0xf9,0x31,0x01,0x5c,
+0x1f,0x05,0x10,0x9f,0xa7,0x00,0x14,0x20,0xe9,0x01,0x11,0x40,0x22,0x02,0x15,0xf3,
+0xf5,0x02,0x26,0xc0,0x07,0xe6,0x03,0x01,0x18,0x07,0x07,0x4e,0x03,0x01,0xfe,0x05,
+0x16,0x0e,0x1f,0x02,0x10,0x6f,0x59,0x00,0x16,0x0f,0xb1,0x03,0x01,0x09,0x06,0x1a,
+0x0f,0x20,0x00,0x26,0xfb,0x0f,0xa3,0x02,0x10,0x9f,0x20,0x00,0x16,0x0d,0x70,0x02,
+0x10,0xdf,0x4a,0x01,0x13,0x0a,0xd5,0x05,0x03,0x90,0x01,0x25,0xf5,0x06,0x18,0x01,
+0x11,0x4f,0xaa,0x01,0x02,0x4e,0x0a,0x52,0xe7,0x20,0x00,0x39,0xff,0x41,0x01,0x18,
+0x9f,0x10,0x02,0x24,0xff,0x40,0x1f,0x0e,0x03,0xd1,0x08,0x0b,0x00,0x01,0x1a,0xe1,
+0x70,0x01,0x2a,0xfe,0x20,0x40,0x01,0x12,0xb1,0xee,0x03,0x13,0xef,0x0f,0x00,0x14,
+0xd5,0xbc,0x03,0x11,0xbe,0x2d,0x00,0x19,0xa4,0x0e,0x06,0x70,0x54,0x10,0x00,0x00,
+0x00,0x00,0x00,0x11,0x00,0x01,0x00,0x55,0x14,0x67,0x76,0x41,0x00,0x01,0x00,0x83,
+0x02,0x8d,0xff,0xff,0xff,0xff,0xd7,0x10,0x0f,0x00,0x31,0x01,0x9f,0xff,0x01,0x00,
+0x13,0xf7,0x10,0x00,0x23,0x4e,0xff,0x01,0x00,0x11,0xc2,0x0f,0x00,0x24,0x06,0xff,
+0x01,0x00,0x20,0xfe,0x20,0x10,0x00,0x25,0x5f,0xff,0x01,0x00,0x66,0xe1,0x00,0x00,
+0x00,0x03,0xff,0x01,0x00,0x67,0xfc,0x00,0x00,0x00,0x0c,0xff,0x01,0x00,0x40,0x70,
+0x00,0x00,0x6f,0x08,0x00,0x40,0xf8,0x10,0x02,0x8f,0x08,0x00,0x40,0xe0,0x00,0x00,
+0xdf,0x08,0x00,0x13,0x30,0x38,0x00,0x30,0xf7,0x00,0x04,0x07,0x00,0x32,0xf5,0x00,
+0x00,0x29,0x00,0x30,0xfd,0x00,0x09,0x10,0x00,0x24,0xc0,0x00,0x49,0x00,0x20,0x30,
+0x0d,0x06,0x00,0x15,0x50,0x88,0x00,0x20,0x80,0x0f,0x06,0x00,0x02,0xb7,0x00,0x01,
+0x2a,0x00,0x11,0x2f,0x36,0x00,0x01,0x01,0x00,0x62,0xef,0xff,0xff,0xff,0xf0,0x4f,
+0x87,0x00,0x00,0x01,0x00,0x50,0xcf,0xff,0xff,0xff,0xf1,0x10,0x00,0x12,0xfb,0x10,
+0x00,0x57,0xbf,0xff,0xff,0xff,0xf3,0x10,0x00,0x66,0xaf,0xff,0xff,0xff,0xf4,0x3f,
+0x40,0x00,0x10,0xaf,0x8a,0x00,0x15,0x1f,0x60,0x00,0x02,0x10,0x00,0x15,0x0f,0x80,
+0x00,0x01,0x10,0x00,0x25,0xf6,0x0b,0xa0,0x00,0x01,0xca,0x00,0x25,0xf6,0x08,0xc0,
+0x00,0x11,0x09,0x0a,0x00,0x11,0x02,0xf8,0x00,0x52,0x40,0x00,0x00,0x00,0x9f,0x1a,
+0x00,0x10,0xbf,0x07,0x00,0x41,0xfa,0x41,0x02,0x6d,0x19,0x00,0x37,0xf4,0x00,0x4f,
+0x20,0x01,0x00,0x10,0x00,0x19,0x0a,0x10,0x00,0x13,0xf2,0x21,0x01,0x04,0x01,0x00,
+0x44,0xf0,0x00,0x00,0x2e,0x7e,0x01,0x12,0xef,0x41,0x01,0x22,0x01,0xcf,0x10,0x00,
+0x10,0xd2,0x05,0x00,0x10,0xb0,0x19,0x01,0x11,0xef,0x63,0x01,0x11,0x01,0x20,0x01,
+0x00,0x8a,0x00,0x74,0x05,0x9c,0xef,0xfd,0xb6,0x10,0x05,0x89,0x00,0x03,0x01,0x00,
+0x16,0x0b,0xda,0x00,0x01,0x01,0x00,0x10,0x2f,0x98,0x00,0x07,0x10,0x00,0x11,0xbf,
+0x8f,0x00,0x05,0x01,0x00,0x10,0x07,0x2f,0x00,0x16,0xd0,0x10,0x00,0x16,0x6f,0x09,
+0x01,0x00,0x01,0x00,0x14,0x2b,0xf0,0x01,0x02,0x52,0x02,0x11,0x5b,0x93,0x00,0x12,
+0xf3,0x31,0x02,0x25,0xbb,0xcd,0xff,0x01,0x00,0x01,0x00,0x14,0x08,0xcd,0x00,0x2a,
+0xfa,0x00,0x10,0x00,0x1a,0xa0,0x10,0x00,0x29,0xf9,0x00,0x10,0x00,0x2a,0xfe,0x50,
+0x10,0x00,0x28,0x91,0x00,0x10,0x00,0x36,0xfd,0x71,0x00,0x10,0x00,0x45,0xfe,0xdb,
+0x96,0x20,0x0f,0x00,0x22,0x47,0x74,0xc4,0x02,0x12,0xe4,0x63,0x02,0x12,0x30,0xb2,
+0x01,0x11,0x0f,0x4e,0x01,0x01,0xde,0x01,0x12,0xf1,0x0c,0x00,0x11,0x0a,0x83,0x00,
+0x20,0x01,0xef,0xd8,0x02,0x00,0xcf,0x00,0x7f,0xb2,0x00,0x00,0x00,0x13,0x31,0x00,
+0x01,0x00,0x44,0x01,0x5a,0x00,0x51,0x1b,0xff,0xff,0xb1,0x00,0x72,0x00,0x12,0x10,
+0x7e,0x00,0x0e,0x96,0x00,0x02,0xae,0x00,0x02,0xba,0x00,0x02,0xc6,0x00,0x03,0xd2,
+0x00,0x81,0x00,0x02,0x67,0x62,0x00,0x00,0x00,0x0a,0x28,0x01,0x11,0x0b,0x4e,0x01,
+0x12,0x04,0x74,0x01,0x11,0x8f,0x6b,0x01,0x12,0x09,0x43,0x01,0x02,0x0d,0x00,0x12,
+0x02,0x4c,0x02,0x10,0x08,0x18,0x02,0x60,0x00,0x00,0x07,0xef,0xff,0xe6,0x42,0x00,
+0x3f,0x34,0x20,0x00,0x01,0x00,0x5e,0x72,0xab,0xbb,0xbb,0xb7,0x00,0x00,0x0f,0xee,
+0x01,0x02,0x04,0x02,0x0f,0x0d,0x00,0x0b,0x32,0x90,0x00,0x00,0xb6,0x00,0x11,0x2f,
+0x70,0x02,0x10,0x05,0x1b,0x01,0x00,0x4d,0x03,0x00,0x6d,0x02,0x72,0x0e,0xff,0xff,
+0xff,0x60,0x00,0x05,0x18,0x03,0x10,0xcf,0x26,0x00,0x00,0x4f,0x03,0x42,0xfe,0x00,
+0x00,0x0d,0xeb,0x02,0x12,0x8f,0x01,0x03,0x12,0x19,0x5a,0x02,0x2f,0x02,0x80,0x9a,
+0x00,0x0a,0x27,0x02,0x88,0x0d,0x00,0x36,0x04,0xbf,0xf9,0x0d,0x00,0x36,0x06,0xdf,
+0xff,0x0e,0x00,0x36,0x28,0xef,0xff,0x0e,0x00,0x18,0x4a,0xa8,0x02,0x17,0x6d,0xb6,
+0x02,0x27,0x01,0x8e,0xc4,0x02,0x27,0x03,0xaf,0xd2,0x02,0x36,0x05,0xcf,0xff,0x0e,
+0x00,0x25,0x18,0xef,0x0c,0x03,0x35,0x40,0x00,0x3a,0xe6,0x03,0x44,0xb5,0x00,0x00,
+0x2c,0x0c,0x00,0x27,0xfd,0x71,0x64,0x05,0x27,0xe8,0x30,0x72,0x05,0x35,0xa4,0x00,
+0x00,0x0e,0x00,0x37,0xfb,0x60,0x00,0x0e,0x00,0x28,0x70,0x00,0x0e,0x00,0x04,0x29,
+0x00,0x04,0x38,0x00,0x38,0xe9,0x30,0x00,0xb8,0x05,0x23,0xfd,0x82,0xe4,0x00,0x03,
+0x01,0x00,0x21,0xc6,0x10,0x00,0x01,0x04,0x0f,0x00,0x20,0xfb,0x50,0x1c,0x01,0x15,
+0x9f,0x9c,0x00,0x16,0xa3,0xeb,0x00,0x05,0xee,0x00,0x1a,0x4b,0xb2,0x03,0x1a,0x29,
+0xc0,0x03,0x28,0x07,0xdf,0x0e,0x00,0x02,0x5b,0x00,0x06,0x50,0x01,0x00,0x5b,0x00,
+0x07,0x6c,0x01,0x48,0x01,0x7e,0xff,0xf9,0x96,0x01,0x29,0x5c,0xf9,0xa5,0x01,0x29,
+0x25,0xcf,0x1f,0x05,0x19,0x3c,0x0e,0x00,0x1f,0xf3,0x1d,0x00,0x35,0x28,0x36,0x88,
+0x01,0x00,0x1f,0x81,0xfc,0x02,0x35,0x1a,0x06,0x57,0x00,0x0f,0xcb,0x00,0x52,0x38,
+0x30,0x3a,0x40,0x83,0x00,0x38,0x4f,0xfd,0x60,0x0e,0x00,0x38,0xff,0xfe,0x82,0x0e,
+0x00,0x39,0xff,0xff,0xb4,0x0e,0x00,0x29,0xff,0xd6,0x0e,0x00,0x38,0xff,0xf9,0x20,
+0x0e,0x00,0x38,0xff,0xfb,0x40,0x0e,0x00,0x21,0xff,0xfd,0x77,0x02,0x15,0x3f,0x7b,
+0x00,0x10,0x92,0xcf,0x01,0x15,0x7c,0x0f,0x00,0x11,0xb4,0x3e,0x03,0x05,0x67,0x02,
+0x01,0x6f,0x08,0x2a,0x03,0x9e,0x49,0x02,0x01,0x50,0x03,0x06,0x98,0x06,0x13,0x05,
+0x86,0x02,0x04,0x1c,0x02,0x28,0x6c,0xff,0xb4,0x06,0x27,0x03,0xbf,0x0e,0x00,0x12,
+0x27,0x59,0x00,0x08,0x28,0x00,0x28,0xff,0xff,0x44,0x00,0x01,0x0e,0x00,0x17,0x49,
+0x8e,0x00,0x25,0x02,0x8e,0xc8,0x08,0x35,0x82,0x00,0x07,0x98,0x00,0x00,0x21,0x01,
+0x17,0x4f,0x96,0x03,0x06,0x0e,0x00,0x27,0xe8,0x10,0xee,0x00,0x18,0xd6,0x0a,0x01,
+0x17,0xa3,0x26,0x01,0x27,0xfe,0x81,0x34,0x01,0x27,0xfc,0x60,0x50,0x01,0x27,0xfa,
+0x30,0x6c,0x01,0x28,0xe8,0x10,0xd6,0x02,0x0e,0x2c,0x02,0x45,0x04,0x56,0x77,0x64,
+0x9f,0x05,0x11,0x18,0x9e,0x00,0x22,0xea,0x40,0xde,0x00,0x04,0x4e,0x04,0x11,0xd4,
+0x28,0x00,0x04,0x42,0x04,0x00,0xfd,0x04,0x02,0x02,0x06,0x05,0x51,0x01,0x02,0x7c,
+0x08,0x05,0xcd,0x09,0x08,0x19,0x02,0x17,0xf1,0xb7,0x09,0x00,0x27,0x08,0x11,0x0b,
+0x08,0x01,0x12,0x61,0xca,0x03,0x21,0xfe,0x00,0x09,0x01,0x13,0x10,0xc4,0x08,0x11,
+0xf2,0xe5,0x00,0x00,0x8d,0x00,0x01,0x93,0x06,0x15,0x56,0xf2,0x08,0x10,0xbf,0x58,
+0x00,0x13,0x8f,0x7b,0x00,0x02,0x87,0x07,0x51,0x83,0x66,0x66,0x66,0x66,0xb8,0x00,
+0x05,0x18,0x00,0x01,0x01,0x00,0x01,0xdf,0x06,0x06,0x0d,0x01,0x15,0xef,0x1d,0x08,
+0x04,0x4b,0x08,0x15,0xfe,0x0e,0x00,0x15,0x1e,0xb8,0x08,0x05,0xf6,0x09,0x19,0xf1,
+0x0e,0x00,0x14,0xf6,0x0e,0x00,0x28,0x1c,0xff,0xb3,0x08,0x19,0x1d,0x82,0x08,0x14,
+0x0d,0xc3,0x00,0x06,0x7f,0x00,0x05,0x0e,0x00,0x11,0x05,0x2a,0x00,0x05,0x81,0x01,
+0x19,0xdf,0x0e,0x00,0x18,0x4f,0x2a,0x00,0x02,0x01,0x01,0x06,0xb8,0x01,0x16,0xcf,
+0xa6,0x08,0x03,0x0f,0x01,0x07,0x22,0x09,0x00,0x2b,0x00,0x06,0xd6,0x01,0x12,0x1f,
+0x96,0x06,0x04,0xe6,0x04,0x06,0x57,0x0a,0x0f,0x01,0x00,0x2d,0x18,0x22,0x0d,0x00,
+0x17,0x1a,0x08,0x09,0x02,0x03,0x01,0x29,0xd1,0x00,0xbc,0x00,0x19,0x90,0x74,0x01,
+0x19,0xfe,0xbc,0x00,0x07,0xa0,0x00,0x09,0x59,0x03,0x02,0x1b,0x0a,0x15,0xb0,0x0f,
+0x00,0x19,0x3f,0xae,0x01,0x04,0x86,0x08,0x05,0xaa,0x02,0x80,0x77,0x40,0x00,0x00,
+0x00,0x00,0x00,0x00,0x18,0x00,0x01,0x00,0x3f,0x12,0x21,0x00,0x01,0x00,0x01,0x9d,
+0x01,0x58,0xbe,0xff,0xff,0xff,0xfd,0xa8,0x40,0x1a,0x00,0x23,0x6b,0xff,0x01,0x00,
+0x2a,0xfa,0x50,0x19,0x00,0x26,0x08,0xff,0x01,0x00,0x19,0xd5,0x1a,0x00,0x27,0x7e,
+0xff,0x01,0x00,0x27,0xfd,0x30,0x66,0x00,0x29,0xcf,0xff,0x01,0x00,0x15,0x70,0x1a,
+0x00,0x20,0x05,0xef,0x10,0x00,0x61,0xc8,0x52,0x10,0x00,0x13,0x59,0x25,0x00,0x14,
+0xb0,0x1a,0x00,0x10,0x06,0x0e,0x00,0x22,0xe7,0x10,0x0d,0x00,0x27,0x27,0xef,0x1b,
+0x00,0x00,0x1a,0x00,0x16,0xfe,0x43,0x00,0x16,0x7f,0x1b,0x00,0x00,0x1a,0x00,0x26,
+0xfb,0x10,0x78,0x00,0x15,0x2c,0x6c,0x00,0x58,0x03,0xff,0xff,0xff,0xf8,0xac,0x00,
+0x51,0x0b,0xff,0xff,0xff,0x30,0x9c,0x00,0x5b,0xef,0xff,0xff,0xf6,0x00,0x1b,0x00,
+0x11,0xfd,0x09,0x00,0x4a,0xaf,0xff,0xff,0xf7,0xfc,0x00,0x13,0x1e,0x2c,0x00,0x4b,
+0x4f,0xff,0xff,0xfa,0x30,0x01,0x84,0x3f,0xff,0xff,0xe0,0x00,0x00,0x00,0x0d,0x3d,
+0x00,0x64,0x00,0x01,0x47,0x88,0x75,0x20,0x48,0x00,0x12,0x50,0x9d,0x00,0x02,0x14,
+0x01,0x10,0x3a,0xdb,0x00,0x10,0xd8,0xa8,0x00,0xb1,0x02,0xff,0xff,0xfb,0x00,0x00,
+0x00,0xdf,0xff,0xff,0xa0,0x1a,0x00,0x15,0x9f,0x20,0x01,0x00,0x86,0x00,0x11,0xf1,
+0x69,0x00,0x20,0xf2,0x00,0x29,0x00,0x13,0xdf,0x3b,0x01,0x12,0xc1,0x7e,0x00,0x33,
+0x60,0x00,0x0b,0x83,0x00,0x24,0x02,0xef,0x56,0x01,0x40,0x60,0x00,0x00,0x00,0x15,
+0x00,0x41,0x01,0xff,0xff,0xff,0xd0,0x01,0x14,0xdf,0x1a,0x00,0x12,0xf4,0x50,0x00,
+0x63,0xe0,0x00,0x6f,0xff,0xff,0xd0,0x92,0x00,0x43,0xff,0xa4,0x10,0x16,0x92,0x00,
+0x53,0x8f,0xff,0xff,0x10,0x0b,0x20,0x01,0x21,0x4f,0xff,0xad,0x00,0x11,0x3f,0x7e,
+0x00,0x20,0x00,0x04,0x3c,0x00,0x03,0x26,0x00,0x11,0x0d,0x1a,0x00,0x00,0x13,0x00,
+0x10,0xff,0x29,0x00,0x52,0x2f,0xff,0xff,0x60,0x4f,0xf4,0x00,0xd1,0x05,0xff,0xff,
+0xff,0x90,0x00,0x00,0x00,0x5f,0xff,0xff,0xf0,0x00,0x85,0x00,0x22,0xf7,0x07,0xd9,
+0x00,0x22,0x00,0xcf,0x48,0x00,0x13,0x07,0x16,0x01,0x82,0x0f,0xff,0xff,0x90,0xaf,
+0xff,0xff,0x80,0x40,0x00,0x22,0xfb,0x00,0x7d,0x00,0x10,0xc0,0x08,0x00,0x72,0xef,
+0xff,0xfa,0x0d,0xff,0xff,0xf5,0x2d,0x00,0x10,0xff,0x74,0x02,0x13,0x0a,0xe2,0x00,
+0x86,0x0e,0xff,0xff,0xa0,0xff,0xff,0xff,0x20,0x4f,0x00,0x22,0x00,0xbf,0x71,0x00,
+0x00,0x35,0x00,0x12,0x0f,0x13,0x00,0x13,0x0f,0x62,0x00,0x12,0x0c,0xc8,0x00,0x00,
+0x35,0x00,0x12,0xa2,0xaa,0x00,0x25,0x04,0xff,0x2d,0x00,0x22,0xff,0x60,0x9f,0x00,
+0x13,0xf9,0xad,0x01,0x13,0x6f,0xe1,0x01,0x12,0x0f,0x79,0x00,0x00,0x08,0x00,0x12,
+0x74,0x48,0x00,0x13,0x09,0x84,0x00,0x03,0x4c,0x01,0x00,0xa9,0x01,0x21,0xf6,0x4f,
+0x3d,0x01,0x00,0x7c,0x00,0x13,0xf3,0x01,0x01,0x13,0xf2,0x32,0x01,0x47,0x44,0xff,
+0xff,0xfc,0x54,0x02,0x00,0x6d,0x02,0x12,0x10,0xc9,0x00,0x13,0xf1,0x35,0x00,0x13,
+0xcf,0x2d,0x00,0x04,0x23,0x01,0x72,0xbf,0xff,0xfd,0x04,0xff,0xff,0xfe,0xb1,0x00,
+0x22,0xff,0x30,0x2d,0x00,0x13,0xfe,0x84,0x00,0x22,0xa0,0x2f,0x26,0x00,0x13,0xbf,
 0x97,0x00,0x12,0xdf,0x44,0x00,0x10,0x06,0x0f,0x00,0x02,0x5b,0x00,0x16,0x09,0x72,
-0x01,0x13,0xfc,0x81,0x3c,0x00,0x39,0x00,0x12,0xf3,0xd4,0x00,0x13,0xfe,0xb6,0x05,
-0x12,0xd0,0x0f,0x00,0x10,0x80,0x41,0x00,0x12,0x60,0xf4,0x04,0x13,0xfa,0xa6,0x05,
-0x13,0x20,0xe3,0x01,0x02,0xaf,0x0c,0x01,0xdc,0x01,0x33,0xfc,0x64,0x7e,0x88,0x05,
-0x11,0x5f,0x17,0x01,0x12,0x6f,0x24,0x01,0x08,0xef,0x10,0x25,0xba,0xdf,0x6c,0x38,
-0x16,0x20,0x60,0x02,0x17,0xe5,0x7f,0x10,0x12,0x0e,0x7f,0x01,0x03,0x95,0x02,0x27,
-0xf3,0x09,0x99,0x10,0x12,0x9f,0x50,0x00,0x22,0x03,0xef,0xd1,0x12,0x16,0x09,0x2a,
-0x28,0x04,0x08,0x2b,0x22,0x01,0xaf,0x41,0x20,0x01,0xfc,0x0a,0x15,0xb4,0x37,0x06,
-0x12,0x10,0x22,0x11,0x02,0x28,0x28,0x36,0x36,0x77,0x64,0xa6,0x06,0x09,0x1d,0x16,
-0x0a,0x63,0x14,0x0b,0xb9,0x03,0x08,0xb8,0x16,0x0b,0x73,0x3f,0x08,0x13,0x07,0x0f,
-0x36,0x00,0x04,0x1b,0x0d,0x58,0x04,0x1b,0x00,0x90,0x24,0x15,0x81,0x7c,0x05,0x08,
-0x48,0x05,0x11,0x3e,0xe1,0x00,0x11,0x62,0x0c,0x00,0x29,0x26,0xae,0xac,0x00,0x03,
-0x34,0x10,0x4b,0xca,0x99,0x9a,0xbd,0x40,0x15,0x07,0x5b,0x21,0x0d,0x8c,0x3c,0x04,
-0xf6,0x1a,0x0e,0x23,0x40,0x07,0x02,0x0c,0x07,0x86,0x18,0x04,0x95,0x00,0x14,0x9e,
-0xa1,0x01,0x1e,0x93,0x65,0x0d,0x6b,0x58,0xbd,0xde,0xff,0xed,0xc9,0x84,0x29,0x0b,
-0xbd,0x27,0x0b,0x86,0x16,0x1c,0xf6,0x16,0x00,0x05,0x8b,0x14,0x0b,0xea,0x3e,0x0d,
-0x4c,0x3d,0x03,0x3c,0x06,0x1e,0xf8,0xaf,0x01,0x0b,0xdd,0x16,0x06,0xb8,0x0a,0x0a,
-0xcc,0x00,0x1c,0x09,0xfb,0x3e,0x06,0x2d,0x07,0x0a,0x5d,0x18,0x06,0xb8,0x02,0x1e,
-0x50,0xcd,0x3d,0x0b,0x39,0x02,0x1d,0x01,0x32,0x3d,0x05,0x85,0x2b,0x0c,0x9f,0x27,
-0x10,0x0d,0x46,0x01,0x1b,0x0e,0x3c,0x08,0x02,0xc9,0x18,0x1b,0x9f,0x36,0x1f,0x15,
-0x8f,0xd1,0x21,0x1a,0x90,0x1e,0x17,0x13,0xfe,0x06,0x00,0x0c,0x21,0x1c,0x1a,0x9f,
-0x9b,0x02,0x02,0x27,0x1b,0x0b,0x8e,0x18,0x12,0x0f,0x3a,0x00,0x07,0x35,0x15,0x04,
-0x95,0x01,0x13,0x90,0x50,0x15,0x09,0x95,0x01,0x13,0xf4,0x5d,0x00,0x19,0xc0,0x95,
-0x01,0x04,0xa6,0x17,0x1c,0x20,0xd7,0x1e,0x18,0x9f,0x9c,0x01,0x18,0xdf,0x46,0x1e,
-0x18,0xe0,0x95,0x01,0x05,0xe7,0x17,0x17,0x40,0x95,0x01,0x15,0xa0,0x92,0x15,0x07,
-0x95,0x01,0x15,0xf5,0xdf,0x00,0x17,0xf0,0x95,0x01,0x0c,0x5c,0x1f,0x09,0xbe,0x26,
-0x08,0x42,0x39,0x0b,0x79,0x13,0x0b,0x5f,0x46,0x05,0x97,0x0a,0x1b,0x0d,0x15,0x00,
-0x1a,0xfd,0x19,0x3e,0x08,0x03,0x41,0x05,0x3b,0x18,0x08,0x11,0x1e,0x0d,0x3c,0x22,
-0x14,0xff,0xb6,0x00,0x22,0xfc,0xbb,0x01,0x00,0x14,0xbc,0xcd,0x00,0x18,0xaf,0x79,
-0x01,0x13,0x0f,0x9c,0x01,0x19,0x0f,0xa4,0x01,0x03,0x23,0x00,0x0a,0x2a,0x03,0x18,
-0x04,0xf3,0x0b,0x19,0x10,0x63,0x03,0x3a,0xd0,0x00,0x2f,0xe4,0x01,0x02,0x86,0x20,
-0x1a,0x07,0x28,0x29,0x12,0x04,0xf7,0x02,0x01,0x2a,0x03,0x0b,0x6d,0x19,0x2b,0xe0,
-0x3f,0xb2,0x1a,0x01,0x45,0x08,0x1b,0x59,0x68,0x29,0x11,0x04,0xf7,0x02,0x05,0xca,
-0x05,0x38,0xdd,0xb8,0x51,0x3b,0x03,0x06,0x69,0x10,0x09,0x08,0x01,0x1c,0xe6,0x11,
-0x00,0x00,0x7f,0x08,0x0b,0x6d,0x01,0x1c,0x10,0xbb,0x49,0x1c,0xc0,0x11,0x00,0x12,
-0xf6,0xbf,0x0c,0x00,0x48,0x01,0x26,0xef,0xff,0xd0,0x0c,0x17,0xf7,0xed,0x46,0x16,
-0x40,0xe0,0x16,0x12,0x01,0xf2,0x3e,0x07,0xf1,0x16,0x02,0xe0,0x00,0x07,0x11,0x00,
-0x11,0x0d,0x67,0x00,0x07,0x11,0x00,0x02,0x09,0x1e,0x07,0x11,0x00,0x1f,0x08,0x22,
-0x00,0x02,0x1c,0xa0,0x44,0x00,0x17,0x70,0x11,0x00,0x02,0x55,0x0d,0x06,0x11,0x00,
-0x01,0xc3,0x06,0x16,0xfb,0xaa,0x00,0x22,0x03,0x9f,0x87,0x02,0x02,0x3f,0x01,0x34,
-0xdd,0xdd,0xde,0x5f,0x04,0x0a,0xed,0x00,0x1b,0xf5,0x21,0x01,0x2b,0xfb,0x20,0x11,
-0x00,0x1c,0xd5,0x54,0x01,0x00,0x12,0x00,0x0d,0x96,0x02,0x0e,0x20,0x4b,0x05,0x32,
-0x01,0x1c,0x5a,0x32,0x01,0x2c,0x00,0x4f,0xff,0x00,0x11,0x07,0xf1,0x02,0x08,0x34,
-0x18,0x10,0xef,0x45,0x00,0x08,0x11,0x00,0x14,0xbf,0x0f,0x02,0x17,0xf7,0xb0,0x04,
-0x1c,0xfc,0x11,0x00,0x18,0xfd,0x11,0x00,0x1c,0x9f,0x11,0x00,0x1b,0xdf,0x33,0x00,
-0x24,0x05,0xff,0xae,0x28,0x17,0xf7,0xe7,0x06,0x16,0xf6,0x11,0x00,0x12,0x17,0x67,
-0x05,0x14,0xff,0x81,0x24,0x13,0xbd,0xb4,0x20,0x0c,0x80,0x03,0x1b,0x30,0x10,0x00,
-0x1f,0xf9,0x64,0x02,0x0d,0x1b,0xfa,0x43,0x01,0x2a,0xfe,0x50,0x11,0x00,0x01,0xf8,
-0x0f,0x06,0x1e,0x00,0x27,0xdc,0x95,0x98,0x06,0x00,0x9a,0x28,0x1a,0x76,0xb4,0x47,
-0x12,0x39,0x24,0x21,0x16,0x72,0x12,0x00,0x2b,0x4c,0xff,0xd8,0x49,0x2a,0x00,0x1b,
-0x45,0x04,0x09,0xfb,0x0f,0x05,0x30,0x44,0x09,0x4d,0x18,0x1b,0xe2,0x35,0x31,0x04,
-0xd9,0x0e,0x2b,0x1e,0xff,0xc2,0x21,0x04,0x93,0x28,0x44,0xd8,0x65,0x57,0xae,0x55,
-0x02,0x16,0x03,0x95,0x4b,0x13,0x4d,0xe5,0x04,0x17,0x0c,0x0b,0x07,0x12,0xcf,0x8c,
-0x02,0x08,0x0b,0x04,0x12,0x1f,0x0c,0x00,0x17,0x9f,0xeb,0x05,0x12,0x08,0x8b,0x05,
-0x08,0x43,0x07,0x12,0x02,0x19,0x4a,0x09,0xa6,0x2d,0x01,0x49,0x1b,0x19,0x08,0x53,
-0x07,0x01,0xfb,0x2e,0x19,0x0c,0x69,0x04,0x52,0x6b,0xbb,0xbb,0xbb,0xb8,0x21,0x2c,
-0x0e,0x39,0x08,0x1e,0x60,0x0c,0x08,0x1e,0x50,0xdf,0x07,0x0a,0x76,0x0e,0x1e,0x4f,
-0xf0,0x07,0x1e,0x4f,0x13,0x00,0x1f,0x5f,0x13,0x00,0x12,0x0f,0x4c,0x00,0x13,0x1e,
-0x3f,0x85,0x00,0x1e,0x2f,0x13,0x00,0x0c,0x35,0x4c,0x04,0xe4,0x00,0x1e,0x80,0x3e,
-0x46,0x15,0xa0,0x06,0x4a,0x59,0x66,0x66,0x66,0x64,0x09,0x1d,0x1f,0x01,0x43,0x01,
-0x19,0x05,0x2f,0x2f,0x15,0xef,0x18,0x1a,0x18,0xf8,0x8f,0x01,0x03,0x95,0x1a,0x17,
-0x10,0xb5,0x01,0x03,0x20,0x12,0x17,0x90,0x92,0x00,0x01,0xac,0x51,0x05,0x36,0x05,
-0x03,0xc8,0x2f,0x16,0x06,0x29,0x1f,0x14,0x4e,0xf4,0x42,0x02,0x7d,0x0f,0x45,0xb7,
-0x54,0x56,0x9d,0x47,0x1c,0x1c,0x2f,0x4f,0x03,0x0b,0x56,0x28,0x03,0x4b,0x1c,0x18,
-0x6f,0x13,0x00,0x1b,0xe3,0x6e,0x1c,0x06,0x15,0x47,0x1d,0x3d,0x0b,0x03,0x07,0x0c,
-0x10,0x16,0xb3,0x23,0x01,0x2b,0x5a,0xef,0x57,0x03,0x00,0xf1,0x00,0x25,0x46,0x77,
-0x7d,0x03,0x04,0x7c,0x00,0x23,0xdb,0x85,0xfb,0x00,0x07,0xe7,0x29,0x19,0xb6,0x23,
-0x00,0x06,0x56,0x34,0x09,0x0a,0x2a,0x01,0x11,0x1d,0x0c,0x8f,0x05,0x0a,0x23,0x00,
-0x01,0x94,0x07,0x0c,0xa0,0x06,0x02,0x23,0x00,0x45,0xdb,0xbb,0xbc,0xdf,0x2c,0x08,
-0x05,0x6e,0x44,0x13,0x7e,0x39,0x20,0x15,0x0f,0x0c,0x0a,0x26,0x08,0xff,0x68,0x24,
-0x17,0xf7,0x15,0x01,0x16,0x20,0x23,0x00,0x03,0x75,0x28,0x07,0x23,0x00,0x03,0x39,
-0x13,0x07,0x23,0x00,0x02,0x7e,0x02,0x1d,0x70,0x51,0x05,0x08,0x23,0x00,0x15,0x07,
-0x30,0x05,0x18,0xf7,0xb3,0x02,0x18,0x4f,0x98,0x0a,0x14,0xff,0xa9,0x0a,0x18,0xf7,
-0x6b,0x13,0x18,0x9f,0x23,0x00,0x1c,0xcf,0xed,0x05,0x01,0x73,0x09,0x09,0xfb,0x31,
-0x1c,0xaf,0xdd,0x05,0x01,0xa3,0x13,0x1f,0xdf,0x23,0x00,0x1c,0x1c,0xbf,0x45,0x06,
-0x01,0xf6,0x00,0x18,0xbf,0x23,0x00,0x10,0xef,0x07,0x03,0x08,0x23,0x00,0x01,0xcd,
-0x02,0x17,0x7f,0x23,0x00,0x02,0x8d,0x04,0x0c,0x8b,0x06,0x13,0xff,0x80,0x21,0x0e,
-0x02,0x08,0x05,0x34,0x00,0x18,0xf8,0x3b,0x01,0x1b,0xdf,0xd0,0x07,0x02,0x3c,0x0a,
-0x17,0xa0,0x23,0x00,0x03,0x29,0x46,0x06,0x23,0x00,0x12,0x8f,0x4b,0x06,0x05,0x23,
-0x00,0x23,0x27,0xef,0x43,0x03,0x03,0xb1,0x06,0x15,0xbc,0x25,0x20,0x1d,0x0f,0xd0,
-0x12,0x0d,0x11,0x00,0x0a,0x23,0x00,0x09,0x80,0x06,0x03,0x80,0x27,0x09,0x23,0x00,
-0x02,0xa8,0x30,0x0b,0xb2,0x06,0x06,0x23,0x00,0x22,0xed,0xb9,0xb0,0x09,0x0d,0x2b,
-0x08,0x1b,0x8f,0x29,0x08,0x0f,0x1f,0x00,0x3f,0x24,0xdb,0xbb,0x01,0x00,0x1b,0xb5,
-0x9c,0x33,0x1b,0x0f,0x1f,0x0d,0x0f,0x1f,0x00,0x6d,0x14,0xfb,0xe1,0x26,0x3b,0x73,
-0x00,0x0f,0x8f,0x01,0x0b,0x46,0x48,0x0f,0x1f,0x00,0x3f,0x0f,0x17,0x01,0x88,0x0f,
-0x1f,0x00,0x0c,0x25,0xfc,0xaa,0x01,0x00,0x1b,0x5f,0x77,0x09,0x0b,0x0f,0x02,0x1f,
-0x9f,0x1f,0x00,0x48,0x1f,0xfb,0x0f,0x00,0x4b,0x15,0xfd,0xc5,0x02,0x1b,0xb7,0x13,
-0x01,0x0f,0x0f,0x00,0x87,0x05,0xb4,0x00,0x1c,0xb4,0x81,0x02,0x0f,0x0f,0x00,0x4b,
-0x0e,0x1d,0x01,0x0f,0x0f,0x00,0xf4,0x05,0xcc,0x2e,0x0b,0xbe,0x25,0x32,0x00,0x02,
-0x7c,0x1f,0x46,0x07,0x25,0x0a,0x15,0x2b,0xe8,0x02,0x1c,0x10,0x97,0x4e,0x06,0x4e,
-0x0a,0x2b,0x02,0xdf,0xf0,0x4c,0x0a,0x6b,0x35,0x03,0x14,0x00,0x2d,0x01,0xef,0xb3,
-0x10,0x0c,0x2d,0x4d,0x15,0x40,0x1c,0x11,0x45,0xe9,0x54,0x34,0x6a,0x06,0x11,0x16,
-0x1f,0x6e,0x19,0x13,0x8f,0xea,0x08,0x17,0x09,0x56,0x13,0x03,0x01,0x4d,0x17,0x01,
-0x96,0x38,0x04,0x2f,0x0c,0x17,0x6f,0xcd,0x09,0x12,0x01,0x07,0x01,0x09,0xfa,0x1b,
-0x03,0x3b,0x2a,0x09,0xf1,0x1b,0x02,0x27,0x38,0x18,0x4f,0xec,0x0b,0x20,0x01,0xcc,
-0xcb,0x36,0x03,0xc2,0x0a,0x0d,0xe9,0x54,0x1a,0xfe,0x13,0x00,0x0a,0x5f,0x0c,0x06,
-0x2e,0x08,0x1e,0xf9,0x99,0x14,0x0b,0x73,0x0c,0x1e,0x00,0x56,0x14,0x0d,0xeb,0x04,
-0x06,0xc9,0x00,0x08,0x33,0x12,0x16,0xf1,0x56,0x08,0x15,0xdf,0x87,0x56,0x1e,0xff,
-0x27,0x00,0x06,0xf1,0x0b,0x0a,0x27,0x00,0x1a,0xf9,0x27,0x00,0x15,0x0e,0xb5,0x01,
-0x06,0x27,0x00,0x14,0xcf,0xd4,0x12,0x06,0x27,0x00,0x19,0x0a,0x5c,0x0d,0x11,0x5f,
-0x27,0x00,0x18,0x7f,0x93,0x13,0x02,0x6a,0x2f,0x04,0xf3,0x29,0x08,0x27,0x00,0x18,
-0x0f,0xd0,0x13,0x02,0x27,0x00,0x04,0xaa,0x2a,0x08,0x27,0x00,0x02,0x53,0x1d,0x0a,
-0x27,0x00,0x18,0x0e,0xcf,0x02,0x12,0x5f,0x62,0x0c,0x17,0x8f,0x14,0x00,0x13,0x06,
-0xa7,0x01,0x16,0xef,0xcb,0x31,0x13,0x18,0x98,0x57,0x03,0x1d,0x0c,0x54,0xc7,0x43,
-0x23,0x47,0xaf,0x2b,0x15,0x1c,0x09,0xb6,0x0f,0x1b,0x10,0x5d,0x28,0x03,0xa7,0x01,
-0x1e,0x0c,0x13,0x00,0x0b,0x55,0x27,0x1d,0x50,0xde,0x16,0x2b,0xf9,0x10,0x0c,0x59,
-0x07,0xc7,0x1f,0x01,0x2a,0x32,0x00,0xde,0x00,0x19,0x83,0xdc,0x01,0x34,0x46,0x77,
-0x76,0xa1,0x1f,0x09,0xb7,0x03,0x02,0xc0,0x3d,0x0f,0x13,0x00,0xff,0x35,0x28,0xfd,
-0xbb,0x12,0x15,0x1d,0xf1,0x39,0x15,0x0f,0x13,0x00,0x65,0x0f,0xee,0x01,0xfe,0x0f,
-0x13,0x00,0x54,0x01,0x46,0x04,0x11,0x05,0xce,0x04,0x0f,0x0b,0x00,0xdf,0x0b,0x97,
-0x1a,0x1e,0xc0,0x37,0x31,0x0f,0x1f,0x00,0xff,0xbc,0x10,0x8b,0xf1,0x14,0x06,0xfe,
-0x08,0x16,0xba,0x24,0x00,0x01,0xdb,0x13,0x01,0x09,0x31,0x06,0x7b,0x08,0x15,0x87,
-0xb6,0x1a,0x02,0x43,0x2f,0x15,0x3f,0xfd,0x06,0x15,0xdf,0x3e,0x08,0x06,0x68,0x32,
-0x22,0xc0,0x0a,0x83,0x19,0x32,0x32,0x37,0xef,0xb7,0x12,0x1b,0x2f,0xd2,0x1a,0x09,
-0x3e,0x0d,0x02,0xe1,0x62,0x08,0x4e,0x0a,0x17,0x01,0x4a,0x0a,0x04,0x4b,0x1f,0x09,
-0xa7,0x2d,0x1b,0x6d,0x5a,0x07,0x21,0x04,0xae,0x44,0x07,0x16,0x81,0xc4,0x0a,0x4e,
-0x45,0x67,0x76,0x31,0x40,0x07,0x1d,0x3f,0x6e,0x18,0x2b,0x01,0xef,0x92,0x18,0x04,
-0xc2,0x1b,0x18,0xb0,0x13,0x00,0x17,0x8f,0x1d,0x1a,0x17,0xf7,0x57,0x3f,0x18,0xf2,
-0x5f,0x00,0x14,0x2e,0xff,0x07,0x06,0x13,0x00,0x14,0xcf,0xcb,0x09,0x05,0x13,0x00,
-0x15,0x09,0x16,0x17,0x0a,0x91,0x3a,0x27,0xfe,0x10,0x13,0x00,0x16,0x02,0xe4,0x1b,
-0x04,0x13,0x00,0x16,0x0d,0x6a,0x0b,0x04,0x13,0x00,0x16,0xaf,0xfa,0x16,0x03,0x13,
-0x00,0x16,0x06,0x2f,0x4b,0x04,0x13,0x00,0x16,0x3f,0x2c,0x58,0x03,0x13,0x00,0x02,
-0xf2,0x00,0x18,0xf3,0x1d,0x01,0x18,0x0b,0xc7,0x0b,0x15,0xff,0x8c,0x62,0x09,0xfe,
-0x1c,0x29,0xf7,0x02,0xd8,0x1e,0x01,0x13,0x00,0x19,0x0d,0x98,0x5a,0x01,0x13,0x00,
-0x19,0x9f,0x7c,0x17,0x06,0xc1,0x0e,0x1b,0xb0,0xdf,0x1e,0x08,0x39,0x16,0x0b,0xed,
-0x1c,0x0b,0x18,0x12,0x1e,0x80,0x13,0x00,0x1e,0xf3,0x13,0x00,0x04,0xef,0x02,0x0e,
-0x99,0x25,0x04,0x13,0x00,0x17,0xdf,0x79,0x42,0x03,0x2b,0x15,0x17,0x1f,0x3a,0x00,
-0x03,0x6d,0x00,0x17,0x07,0x0b,0x01,0x04,0x9e,0x1f,0x16,0xcf,0xf2,0x0b,0x04,0xc8,
-0x0c,0x16,0x3f,0x78,0x1f,0x04,0x0a,0x00,0x1e,0x08,0xa2,0x01,0x02,0x1d,0x03,0x19,
-0xe1,0x13,0x00,0x15,0x4f,0x59,0x01,0x05,0x13,0x00,0x15,0x0a,0x38,0x0a,0x06,0x18,
-0x1b,0x14,0xef,0x3a,0x00,0x06,0x4d,0x02,0x05,0x93,0x01,0x06,0x13,0x00,0x14,0x0b,
-0xed,0x0c,0x07,0xea,0x1b,0x04,0x1b,0x36,0x0c,0x2d,0x14,0x19,0xf9,0x13,0x00,0x13,
-0x0d,0x7b,0x03,0x07,0x13,0x00,0x13,0x03,0xe1,0x01,0x0c,0x26,0x1b,0x0a,0x1e,0x03,
-0x26,0x00,0x0e,0xd5,0x1a,0x19,0xf7,0x90,0x60,0x1f,0xc0,0x6f,0x0f,0xfe,0x0f,0x0f,
-0x00,0xff,0x1b,0x06,0xba,0x13,0x1b,0xa3,0x85,0x1e,0x0f,0x0f,0x00,0x4d,0x1e,0x70,
-0x0f,0x2a,0x0c,0xc4,0x23,0x1d,0x0e,0x7d,0x21,0x09,0xd8,0x23,0x0d,0x7b,0x5f,0x1a,
-0x9f,0x04,0x6b,0x0a,0x8d,0x3f,0x08,0xfa,0x06,0x0a,0xa5,0x45,0x0c,0x78,0x1a,0x0b,
-0xd0,0x49,0x05,0x7e,0x1b,0x0b,0xb2,0x17,0x08,0xd1,0x6b,0x0b,0x49,0x1e,0x0b,0x33,
-0x40,0x0a,0x50,0x44,0x0c,0x97,0x22,0x04,0xea,0x10,0x09,0x75,0x42,0x16,0xcf,0xbe,
-0x05,0x18,0x0b,0xbd,0x3f,0x16,0x9d,0x07,0x11,0x10,0x1f,0x84,0x5e,0x04,0x18,0x00,
-0x16,0x98,0xe7,0x0f,0x00,0xb2,0x04,0x14,0x7a,0x18,0x00,0x16,0xa2,0xaa,0x24,0x00,
-0x53,0x00,0x15,0x1b,0x22,0x1e,0x14,0xcf,0x1e,0x1c,0x10,0x02,0x5f,0x00,0x15,0x0b,
-0x18,0x00,0x14,0x7f,0x9b,0x01,0x10,0x07,0x52,0x00,0x15,0x0c,0xdf,0x1b,0x14,0x1f,
-0xe4,0x06,0x10,0x0d,0x82,0x00,0x15,0x0d,0xae,0x01,0x14,0x0b,0xe0,0x05,0x10,0x2f,
-0xa4,0x05,0x15,0x0d,0x35,0x01,0x14,0x05,0x6c,0x02,0x10,0x8f,0xe2,0x00,0x16,0x0e,
-0x4d,0x01,0x04,0x71,0x06,0x00,0x8c,0x46,0x06,0x53,0x01,0x02,0x0d,0x56,0x14,0x30,
-0xc4,0x5a,0x07,0x18,0x00,0x12,0x4f,0x8e,0x06,0x11,0x09,0x03,0x02,0x07,0x18,0x00,
-0x12,0x0e,0x9b,0x01,0x02,0x07,0x00,0x16,0x1f,0x80,0x25,0x02,0x29,0x00,0x03,0x37,
-0x00,0x16,0x2f,0xfc,0x23,0x03,0x1d,0x5b,0x11,0x9f,0x23,0x11,0x1a,0x2f,0x8d,0x37,
-0x11,0xfe,0x24,0x02,0x17,0xfd,0x5a,0x02,0x12,0xf3,0xb9,0x00,0x01,0x14,0x65,0x17,
-0xf7,0x85,0x1f,0x13,0xf4,0xe9,0x00,0x03,0x58,0x5b,0x08,0x18,0x00,0x14,0x0c,0x18,
-0x56,0x17,0xb0,0x13,0x02,0x12,0xf5,0x49,0x01,0x01,0x92,0x40,0x17,0x60,0x0e,0x1d,
-0x12,0xf6,0x08,0x02,0x22,0xfb,0xbf,0x18,0x02,0x08,0x18,0x00,0x04,0x38,0x02,0x18,
-0xfa,0xad,0x24,0x16,0xf7,0x68,0x02,0x1c,0xf4,0x18,0x00,0x16,0x0f,0xa8,0x02,0x09,
-0x18,0x00,0x16,0x0a,0xd8,0x02,0x09,0x18,0x00,0x16,0x04,0x08,0x03,0x19,0x7f,0xa5,
-0x43,0x03,0xde,0x41,0x0d,0x18,0x00,0x03,0x90,0x06,0x0d,0x18,0x00,0x15,0x3f,0xdd,
-0x07,0x0a,0x18,0x00,0x02,0x5b,0x1b,0x0e,0x18,0x00,0x1a,0x08,0x67,0x44,0x05,0x18,
-0x00,0x15,0x02,0xab,0x1e,0x0a,0x18,0x00,0x00,0xb3,0x02,0x1a,0xfb,0xb5,0x25,0x05,
-0x95,0x07,0x1a,0xf5,0x18,0x00,0x1e,0xfb,0x68,0x0e,0x2e,0xff,0x50,0x13,0x00,0x1e,
-0xe0,0x13,0x00,0x1e,0xf8,0x13,0x00,0x2e,0xff,0x20,0x13,0x00,0x1e,0xb0,0x13,0x00,
-0x1e,0xf5,0x13,0x00,0x1e,0xfe,0x13,0x00,0x2e,0xff,0x80,0x13,0x00,0x1e,0xf2,0x13,
-0x00,0x1e,0xfc,0x13,0x00,0x2e,0xff,0x50,0x13,0x00,0x1e,0xe0,0x13,0x00,0x1e,0xf9,
-0x13,0x00,0x2e,0xff,0x30,0x13,0x00,0x19,0xc0,0x13,0x00,0x14,0xf9,0x6d,0x02,0x07,
-0x98,0x0f,0x13,0x8f,0xb5,0x0a,0x07,0x13,0x00,0x13,0x0d,0x41,0x02,0x07,0x13,0x00,
-0x03,0x92,0x38,0x09,0xd1,0x0f,0x01,0xb4,0x1d,0x0a,0x13,0x00,0x12,0x2f,0x98,0x09,
-0x08,0x13,0x00,0x12,0x07,0x5e,0x09,0x09,0x0a,0x10,0x11,0xdf,0xc1,0x00,0x09,0x13,
-0x00,0x02,0x65,0x21,0x09,0x13,0x00,0x02,0x14,0x4d,0x09,0x13,0x00,0x02,0x47,0x40,
-0x0a,0x56,0x10,0x10,0x7f,0xc1,0x00,0x19,0x14,0x13,0x00,0x01,0xc1,0x00,0x19,0x94,
-0x13,0x00,0x02,0xe8,0x1d,0x0a,0x8f,0x10,0x1e,0xaf,0x0b,0x12,0x1e,0x1f,0x13,0x00,
-0x2e,0x07,0xff,0x31,0x12,0x1e,0xdf,0x13,0x00,0x1e,0x4f,0x13,0x00,0x1e,0x0a,0x13,
-0x00,0x2e,0x01,0xff,0x7d,0x12,0x1e,0x7f,0x13,0x00,0x1e,0x0d,0x13,0x00,0x2e,0x03,
-0xff,0xb6,0x12,0x1e,0xaf,0x13,0x00,0x1e,0x1f,0x13,0x00,0x2e,0x06,0xff,0x86,0x11,
-0x1e,0xcf,0x13,0x00,0x1e,0x3f,0x13,0x00,0x0a,0x25,0x52,0x0b,0x80,0x53,0x00,0x73,
-0x55,0x11,0xbf,0xc5,0x02,0x17,0x71,0x13,0x00,0x15,0x18,0x84,0x06,0x0c,0x49,0x4d,
-0x08,0x61,0x0c,0x27,0x01,0xbf,0x4f,0x0c,0x17,0x10,0x05,0x34,0x0b,0x3c,0x4f,0x19,
-0xcf,0xdc,0x07,0x1e,0x10,0xa8,0x07,0x02,0x71,0x04,0x13,0x6f,0xaa,0x46,0x25,0x68,
-0xbf,0xdd,0x03,0x03,0x6d,0x0e,0x54,0x10,0x00,0x00,0x01,0x7f,0xde,0x03,0x16,0x08,
-0xb0,0x18,0x23,0x02,0xef,0x5e,0x0c,0x17,0x1f,0xd5,0x07,0x04,0xda,0x04,0x17,0x7f,
+0x01,0x12,0xfc,0x22,0x00,0x10,0xfe,0x39,0x00,0x12,0xf3,0xd4,0x00,0x12,0xfe,0xaa,
+0x02,0x22,0xff,0xd0,0x0f,0x00,0x10,0x80,0x41,0x00,0x11,0x60,0xc4,0x00,0x00,0x51,
+0x01,0x22,0x1c,0xff,0x4d,0x01,0x00,0xe3,0x01,0x00,0x64,0x01,0x13,0xf9,0xdc,0x01,
+0x21,0xfc,0x64,0xc0,0x03,0x41,0xfc,0x10,0x00,0x5f,0x17,0x01,0x12,0x6f,0x24,0x01,
+0x16,0x5f,0xb7,0x03,0x31,0xfe,0xba,0xdf,0x70,0x00,0x13,0x03,0x8e,0x01,0x03,0x60,
+0x02,0x14,0xe5,0x1f,0x00,0x11,0x20,0x77,0x01,0x16,0xf8,0x95,0x02,0x26,0xf3,0x09,
+0x1a,0x00,0x22,0x00,0x9f,0x50,0x00,0x11,0x03,0x1b,0x00,0x11,0xd2,0xc3,0x00,0x03,
+0xae,0x03,0x13,0x03,0xf3,0x02,0x90,0x01,0xaf,0xff,0xff,0xfe,0x80,0x00,0x00,0x06,
+0x59,0x00,0x33,0xb4,0x00,0x00,0x99,0x00,0x01,0xd1,0x03,0x31,0x14,0x67,0x63,0x11,
+0x00,0x33,0x36,0x77,0x64,0x71,0x03,0x13,0x6f,0x41,0x02,0x1e,0x00,0x01,0x00,0x1d,
+0xdf,0xb9,0x03,0x05,0x70,0x04,0x13,0xff,0x54,0x01,0x0e,0x01,0x00,0x2f,0x0a,0xff,
+0x36,0x00,0x06,0x1b,0x0d,0x58,0x04,0x07,0x01,0x00,0x10,0x2e,0xc6,0x00,0x14,0x81,
+0x0e,0x00,0x18,0x04,0x48,0x05,0x11,0x3e,0xe1,0x00,0x11,0x62,0x0c,0x00,0x3d,0x26,
+0xae,0xfb,0x36,0x00,0x72,0xff,0xff,0xca,0x99,0x9a,0xbd,0xff,0x17,0x01,0x05,0x01,
+0x00,0x19,0x1a,0x2a,0x05,0x19,0x20,0xbd,0x00,0x17,0xef,0x1a,0x00,0x1a,0xf6,0x88,
+0x00,0x16,0x6d,0x1a,0x00,0x2a,0xfc,0x30,0x1b,0x00,0x24,0x04,0x9e,0xa1,0x01,0x1d,
+0x93,0xbf,0x00,0x8e,0x02,0x58,0xbd,0xde,0xff,0xed,0xc9,0x63,0xd9,0x00,0x10,0x0f,
+0x32,0x00,0x0c,0x15,0x00,0x1e,0x06,0x7a,0x00,0x02,0xdd,0x02,0x03,0xc5,0x03,0x07,
+0x01,0x00,0x1e,0x2f,0xc0,0x00,0x04,0x3c,0x06,0x1e,0xf8,0xaf,0x01,0x03,0xae,0x02,
+0x0a,0x50,0x05,0x00,0x01,0x00,0x0a,0xcc,0x00,0x03,0x50,0x02,0x1a,0xf9,0x2b,0x00,
+0x03,0xdf,0x00,0x19,0xf0,0x15,0x00,0x04,0xb8,0x02,0x1c,0x50,0xf6,0x05,0x01,0x96,
+0x01,0x09,0x04,0x07,0x04,0x39,0x01,0x01,0x5b,0x04,0x08,0x57,0x06,0x1a,0xf7,0xad,
+0x06,0x02,0x09,0x02,0x20,0xfe,0x0e,0xde,0x06,0x08,0x44,0x01,0x10,0xff,0x8e,0x03,
+0x10,0x9f,0xf0,0x02,0x07,0x16,0x00,0x10,0x8f,0x78,0x05,0x11,0x03,0x1b,0x00,0x06,
+0x15,0x00,0x10,0x0e,0x40,0x00,0x03,0x06,0x00,0x06,0xa0,0x01,0x02,0x25,0x00,0x1a,
+0x9f,0x9b,0x02,0x11,0xaf,0xb8,0x05,0x19,0x04,0x14,0x07,0x01,0x95,0x01,0x12,0xfe,
+0x47,0x00,0x29,0xff,0x10,0x95,0x01,0x12,0x90,0x3d,0x06,0x19,0xf6,0x95,0x01,0x13,
+0xf4,0x5d,0x00,0x19,0xc0,0x95,0x01,0x13,0x00,0x41,0x00,0x18,0x20,0x95,0x01,0x13,
+0xa0,0x7e,0x06,0x18,0xf8,0x95,0x01,0x14,0xf5,0x9e,0x00,0x18,0xe0,0x95,0x01,0x14,
+0x00,0x41,0x00,0x17,0x40,0x95,0x01,0x14,0xa0,0xbf,0x06,0x17,0xfa,0x95,0x01,0x15,
+0xf5,0xdf,0x00,0x17,0xf0,0x95,0x01,0x15,0x00,0x41,0x00,0x19,0x60,0x95,0x01,0x04,
+0xbf,0x02,0x0a,0x95,0x01,0x03,0x01,0x00,0x15,0xf2,0x95,0x01,0x08,0x01,0x00,0x14,
+0x80,0x95,0x01,0x09,0x7a,0x08,0x05,0x95,0x01,0x08,0x01,0x00,0x14,0xf3,0x95,0x01,
+0x09,0x01,0x00,0x14,0x90,0x8b,0x00,0x09,0x01,0x00,0x04,0xb6,0x00,0x22,0xfc,0xbb,
+0x01,0x00,0x14,0xbc,0xcd,0x00,0x18,0xaf,0x79,0x01,0x13,0x0f,0x9c,0x01,0x19,0x0f,
+0xa4,0x01,0x03,0x23,0x00,0x0a,0x2a,0x03,0x22,0x04,0xff,0x5d,0x04,0x19,0xcf,0xb9,
+0x01,0x12,0x0f,0xf7,0x02,0x1a,0x2f,0xe4,0x01,0x11,0xaf,0xf7,0x02,0x15,0x07,0x40,
+0x01,0x06,0x41,0x00,0x12,0xf9,0x2a,0x03,0x0a,0x4f,0x02,0x3a,0xff,0xe0,0x3f,0x40,
+0x00,0x02,0x45,0x08,0x1a,0x59,0x40,0x00,0x02,0x41,0x00,0x15,0xfb,0xca,0x05,0x38,
+0xdd,0xb8,0x51,0x3b,0x03,0x01,0x01,0x00,0x2b,0xc6,0x10,0x11,0x00,0x2c,0xff,0xe6,
+0x11,0x00,0x00,0x7f,0x08,0x0b,0x6d,0x01,0x2b,0x10,0x00,0x3d,0x01,0x1c,0xc0,0x11,
+0x00,0x21,0xf6,0x00,0x29,0x00,0x00,0x48,0x01,0x12,0xef,0x7e,0x00,0x24,0x00,0xff,
+0x6c,0x05,0x12,0x01,0x34,0x0a,0x25,0x40,0xff,0x7d,0x05,0x21,0x01,0xdf,0xd9,0x01,
+0x16,0xff,0x8e,0x05,0x02,0xe0,0x00,0x07,0x11,0x00,0x11,0x0d,0x67,0x00,0x07,0x11,
+0x00,0x11,0x09,0x49,0x01,0x07,0x11,0x00,0x1f,0x08,0x22,0x00,0x02,0x1c,0xa0,0x44,
+0x00,0x17,0x70,0x11,0x00,0x11,0x4f,0x13,0x03,0x06,0x11,0x00,0x01,0xc3,0x06,0x16,
+0xfb,0xaa,0x00,0x22,0x03,0x9f,0x87,0x02,0x02,0x3f,0x01,0x34,0xdd,0xdd,0xde,0x5f,
+0x04,0x0a,0xed,0x00,0x1b,0xf5,0x21,0x01,0x2b,0xfb,0x20,0x11,0x00,0x1c,0xd5,0x54,
+0x01,0x00,0x12,0x00,0x0d,0x96,0x02,0x0b,0x11,0x00,0x17,0xf8,0x32,0x01,0x1c,0x5a,
+0x32,0x01,0x2c,0x00,0x4f,0xff,0x00,0x11,0x07,0xf1,0x02,0x17,0xff,0xd1,0x06,0x10,
+0xef,0x45,0x00,0x08,0x11,0x00,0x14,0xbf,0x0f,0x02,0x17,0xf7,0xb0,0x04,0x1c,0xfc,
+0x11,0x00,0x18,0xfd,0x11,0x00,0x1c,0x9f,0x11,0x00,0x1b,0xdf,0x33,0x00,0x11,0x05,
+0xa5,0x02,0x07,0x11,0x00,0x11,0x2e,0xff,0x01,0x06,0x11,0x00,0x12,0x17,0x67,0x05,
+0x01,0x5b,0x03,0x52,0xaa,0xaa,0xaa,0xaa,0xbd,0xde,0x00,0x1c,0xb0,0x80,0x03,0x1b,
+0x30,0x10,0x00,0x1f,0xf9,0x64,0x02,0x0d,0x1b,0xfa,0x43,0x01,0x2a,0xfe,0x50,0x11,
+0x00,0x28,0xfc,0x60,0x76,0x01,0x80,0xfe,0xdc,0x95,0x20,0x00,0x00,0x00,0x00,0x12,
+0x00,0x01,0x00,0x68,0x01,0x45,0x67,0x76,0x53,0x00,0x01,0x00,0x86,0x39,0xdf,0xff,
+0xff,0xff,0xff,0xfc,0x72,0x12,0x00,0x23,0x4c,0xff,0x01,0x00,0x14,0xb3,0x12,0x00,
+0x25,0x1b,0xff,0x01,0x00,0x12,0x90,0x12,0x00,0x26,0x04,0xef,0x13,0x00,0x21,0xfd,
+0x20,0x13,0x00,0x27,0x4f,0xff,0x01,0x00,0x10,0xe2,0x12,0x00,0x28,0x03,0xff,0x01,
+0x00,0x79,0xfd,0x10,0x00,0x00,0x00,0x1e,0xff,0x01,0x00,0x51,0xb0,0x00,0x00,0x00,
+0xaf,0x0a,0x00,0x41,0xd8,0x65,0x57,0xae,0x09,0x00,0x14,0xf5,0x38,0x00,0x10,0xc3,
+0x43,0x00,0x11,0x4d,0x3a,0x00,0x30,0x00,0x00,0x0c,0x08,0x00,0x12,0xf9,0x7c,0x00,
+0x10,0xcf,0x0c,0x00,0x33,0x50,0x00,0x3f,0x41,0x00,0x00,0x01,0x00,0x12,0x1f,0x0c,
+0x00,0x10,0x9f,0x07,0x00,0x12,0x20,0x13,0x00,0x10,0x08,0x0c,0x00,0x27,0xf0,0x00,
+0x38,0x00,0x20,0x00,0x02,0x0d,0x00,0x21,0xf4,0x04,0x06,0x00,0x04,0xdb,0x00,0x00,
+0xfe,0x00,0x13,0xf8,0x2c,0x00,0x03,0x01,0x00,0x67,0xbf,0xff,0xff,0xff,0xfa,0x0c,
+0x5e,0x00,0x87,0x00,0x00,0x6b,0xbb,0xbb,0xbb,0xb8,0x0e,0x00,0x01,0x03,0x01,0x00,
+0x10,0x0f,0x13,0x00,0x19,0x60,0x13,0x00,0x12,0x2f,0x9e,0x00,0x08,0x01,0x00,0x01,
+0xaa,0x00,0x19,0x40,0x13,0x00,0x01,0x2d,0x01,0x1f,0x30,0x13,0x00,0x0d,0x1f,0x5f,
+0x13,0x00,0x12,0x0f,0x4c,0x00,0x13,0x1e,0x3f,0x85,0x00,0x1e,0x2f,0x13,0x00,0x1e,
+0x1f,0xd1,0x00,0x01,0xe4,0x00,0x19,0x80,0x13,0x00,0x01,0x1d,0x01,0x14,0xa0,0x0e,
+0x00,0x60,0x46,0x66,0x66,0x66,0x64,0x09,0x13,0x00,0x19,0xe0,0x43,0x01,0x10,0x05,
+0x13,0x00,0x14,0xf3,0x13,0x00,0x10,0xef,0x69,0x01,0x20,0x01,0xff,0x06,0x00,0x08,
+0x8f,0x01,0x11,0xf5,0x2c,0x00,0x27,0xff,0x10,0xb5,0x01,0x12,0xf1,0xe5,0x00,0x17,
+0x90,0x92,0x00,0x30,0xd0,0x00,0x0d,0x07,0x00,0x12,0xf7,0xc4,0x02,0x01,0x01,0x02,
+0x31,0x70,0x00,0x06,0x27,0x02,0x10,0xa1,0x13,0x00,0x10,0x4e,0x0a,0x00,0x23,0xfe,
+0x10,0x1c,0x02,0x64,0xff,0xb7,0x54,0x56,0x9d,0xff,0x31,0x00,0x1a,0x2f,0x73,0x02,
+0x59,0xc0,0x00,0x00,0x00,0x05,0x12,0x00,0x11,0xfe,0x32,0x02,0x18,0x6f,0x13,0x00,
+0x11,0xe3,0x69,0x00,0x2d,0x06,0xff,0xe5,0x02,0x2d,0x00,0x3d,0x0b,0x03,0x3d,0x00,
+0x00,0x7e,0x31,0x03,0x4b,0x00,0x00,0x5a,0xef,0x57,0x03,0x00,0xf1,0x00,0x25,0x46,
+0x77,0x7d,0x03,0x04,0x7c,0x00,0x37,0xdb,0x85,0x10,0x67,0x01,0x02,0x01,0x00,0x19,
+0xb6,0x23,0x00,0x01,0x27,0x00,0x1b,0x60,0x23,0x00,0x3b,0xff,0xff,0xc2,0x23,0x00,
+0x01,0x3a,0x03,0x0a,0x23,0x00,0x2c,0xff,0xf6,0x23,0x00,0x23,0xff,0xf6,0x23,0x00,
+0x31,0xdb,0xbb,0xbc,0xf8,0x03,0x01,0xa1,0x01,0x04,0x2a,0x01,0x12,0x03,0xc9,0x00,
+0x12,0xe0,0x23,0x00,0x15,0x70,0x91,0x01,0x25,0xff,0x80,0x23,0x00,0x04,0x15,0x01,
+0x16,0x20,0x23,0x00,0x22,0x00,0x07,0x64,0x03,0x06,0x23,0x00,0x02,0x20,0x02,0x17,
+0xf1,0x23,0x00,0x02,0x7e,0x02,0x17,0x70,0x23,0x00,0x01,0x79,0x03,0x18,0xfc,0x23,
+0x00,0x11,0x07,0x35,0x00,0x08,0x23,0x00,0x01,0x35,0x00,0x17,0x4f,0x23,0x00,0x02,
+0x64,0x00,0x08,0x23,0x00,0x01,0x17,0x02,0x18,0x9f,0x23,0x00,0x00,0x02,0x02,0x18,
+0xfb,0x23,0x00,0x10,0x0b,0x0d,0x00,0x18,0xcf,0x23,0x00,0x10,0xaf,0xd0,0x01,0x08,
+0x23,0x00,0x10,0x0a,0x0d,0x00,0x1f,0xdf,0x23,0x00,0x1c,0x10,0xbf,0xc1,0x00,0x08,
+0x23,0x00,0x01,0xf6,0x00,0x18,0xbf,0x23,0x00,0x10,0xef,0x07,0x03,0x08,0x23,0x00,
+0x01,0xcd,0x02,0x17,0x7f,0x23,0x00,0x02,0x8d,0x04,0x08,0x23,0x00,0x10,0x8f,0x0d,
+0x00,0x17,0x1f,0x23,0x00,0x11,0x0d,0xb6,0x02,0x07,0x23,0x00,0x11,0x04,0x45,0x03,
+0x08,0x3b,0x01,0x11,0xdf,0x93,0x01,0x07,0x23,0x00,0x11,0x7f,0xa1,0x03,0x07,0x23,
+0x00,0x12,0x6f,0xeb,0x01,0x06,0x23,0x00,0x01,0x67,0x00,0x16,0xfa,0xea,0x01,0x23,
+0x27,0xef,0x43,0x03,0x01,0xb7,0x02,0x33,0xaa,0xaa,0xbc,0xe1,0x05,0x1b,0x40,0x53,
+0x02,0x00,0x2d,0x00,0x0d,0x11,0x00,0x0a,0x23,0x00,0x1b,0x60,0x76,0x02,0x2b,0xfc,
+0x20,0x99,0x02,0x1b,0xe6,0xdf,0x02,0x29,0xfc,0x60,0x02,0x03,0x3a,0xed,0xb9,0x51,
+0x25,0x03,0x04,0x01,0x00,0x1a,0x8f,0x0f,0x00,0x1f,0xf8,0x1f,0x00,0x3f,0x24,0xdb,
+0xbb,0x01,0x00,0x18,0xb5,0x94,0x01,0x04,0x9d,0x00,0x16,0x70,0x10,0x00,0x0f,0x1f,
+0x00,0x6d,0x23,0xfb,0x77,0x01,0x00,0x1b,0x73,0x7e,0x01,0x1a,0x70,0x36,0x01,0x1f,
+0xf7,0x1f,0x00,0x40,0x0f,0x17,0x01,0x88,0x0f,0x1f,0x00,0x0c,0x25,0xfc,0xaa,0x01,
+0x00,0x1a,0x5f,0xff,0x01,0x1b,0xf9,0x0f,0x02,0x1f,0x9f,0x1f,0x00,0x48,0x1f,0xfb,
+0x0f,0x00,0x4b,0x15,0xfd,0xc5,0x02,0x1b,0xb7,0x13,0x01,0x0f,0x0f,0x00,0x87,0x05,
+0xb4,0x00,0x1c,0xb4,0x81,0x02,0x0f,0x0f,0x00,0x4b,0x0e,0x1d,0x01,0x0f,0x0f,0x00,
+0xf4,0x04,0x01,0x00,0x59,0x35,0x67,0x76,0x54,0x10,0xc5,0x08,0x11,0x7c,0x3f,0x01,
+0x17,0xea,0x25,0x0a,0x15,0x2b,0xe8,0x02,0x05,0x2a,0x00,0x1a,0x9f,0x0f,0x06,0x00,
+0x38,0x00,0x17,0xdf,0x7d,0x01,0x12,0xa0,0x13,0x00,0x2c,0xef,0xff,0x14,0x00,0x19,
+0x01,0x13,0x00,0x02,0x63,0x09,0x1a,0xcf,0xe4,0x02,0x14,0x40,0xe0,0x06,0x52,0xff,
+0xe9,0x54,0x34,0x6a,0x9d,0x09,0x04,0x5b,0x07,0x02,0xf0,0x03,0x13,0x8f,0xea,0x08,
+0x26,0x09,0xff,0x07,0x0b,0x12,0x6f,0xfc,0x09,0x27,0x01,0xff,0xf4,0x0a,0x03,0x2f,
+0x0c,0x17,0x6f,0xcd,0x09,0x12,0x01,0x07,0x01,0x02,0xc1,0x08,0x08,0xfb,0x07,0x22,
+0xa0,0x00,0x31,0x07,0x07,0x87,0x0b,0x38,0xfd,0x00,0x4f,0xec,0x0b,0x78,0x01,0xcc,
+0xcc,0xcc,0xcc,0xc0,0x08,0x3a,0x00,0x07,0x4d,0x08,0x1a,0xfe,0x13,0x00,0x0a,0x5f,
+0x0c,0x06,0x2e,0x08,0x2e,0xf9,0x00,0x7c,0x0b,0x1a,0x90,0x14,0x00,0x08,0x43,0x0b,
+0x0f,0xeb,0x04,0x04,0x06,0xc9,0x00,0x04,0x40,0x08,0x01,0x96,0x00,0x06,0x56,0x08,
+0x05,0x8c,0x01,0x2e,0x10,0xff,0x27,0x00,0x06,0xf1,0x0b,0x0a,0x27,0x00,0x1a,0xf9,
+0x27,0x00,0x15,0x0e,0xb5,0x01,0x06,0x27,0x00,0x10,0xcf,0x64,0x05,0x0a,0x27,0x00,
+0x19,0x0a,0x5c,0x0d,0x11,0x5f,0x27,0x00,0x17,0x7f,0xa8,0x0d,0x02,0x8d,0x0b,0x24,
+0xf1,0x04,0xb0,0x0a,0x07,0x27,0x00,0x14,0x0f,0xb0,0x0b,0x06,0x27,0x00,0x02,0x2e,
+0x0c,0x19,0x30,0x27,0x00,0x11,0x05,0xda,0x05,0x0a,0x27,0x00,0x18,0x0e,0xcf,0x02,
+0x12,0x5f,0x62,0x0c,0x17,0x8f,0x14,0x00,0x13,0x06,0xa7,0x01,0x11,0xef,0x36,0x05,
+0x01,0x8b,0x00,0x12,0x18,0xc3,0x00,0x04,0x1d,0x0c,0x52,0xc7,0x43,0x23,0x47,0xaf,
+0xc3,0x00,0x04,0x4a,0x02,0x07,0x01,0x00,0x13,0x10,0xc3,0x01,0x0b,0xac,0x02,0x2e,
+0x0c,0xff,0xbf,0x02,0x19,0x0a,0x13,0x00,0x12,0x50,0xa6,0x00,0x07,0xe7,0x02,0x04,
+0x35,0x03,0x25,0x01,0x7e,0xee,0x0b,0x15,0x81,0xc7,0x01,0x22,0x05,0xae,0x22,0x09,
+0x19,0x83,0xdc,0x01,0xb0,0x46,0x77,0x76,0x64,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+0x63,0xff,0xff,0xff,0xff,0xf7,0x00,0x01,0x00,0x10,0x04,0x0e,0x00,0x1f,0xf1,0x13,
+0x00,0xff,0x35,0x23,0xfd,0xbb,0x01,0x00,0x15,0xbc,0x13,0x00,0x0a,0x01,0x00,0x0f,
+0x13,0x00,0x64,0x0f,0xee,0x01,0xfe,0x0f,0x13,0x00,0x54,0x10,0x5f,0x06,0x00,0x10,
+0x05,0x05,0x00,0x1f,0xf0,0x0b,0x00,0xdf,0x15,0x00,0x01,0x00,0x10,0x09,0x10,0x00,
+0x16,0xc0,0x10,0x00,0x5f,0x9f,0xff,0xff,0xff,0xfc,0x1f,0x00,0xff,0xbf,0x51,0x8b,
+0xbb,0xbb,0xbb,0xb8,0x0f,0x00,0x10,0x0a,0x1f,0x00,0x16,0xba,0x24,0x00,0x50,0xbf,
+0xff,0xff,0xff,0xfa,0x24,0x00,0x11,0xfe,0x0f,0x00,0x10,0x0f,0x1a,0x00,0x10,0x87,
+0x05,0x00,0x15,0xf2,0x2b,0x03,0x20,0xf5,0x3f,0x06,0x00,0x10,0x90,0x10,0x00,0x10,
+0xdf,0x0a,0x00,0x11,0x10,0xbd,0x04,0x13,0x60,0x3d,0x00,0x31,0xff,0xc0,0x0a,0x10,
+0x00,0x41,0xc6,0x32,0x37,0xef,0x2e,0x00,0x28,0x00,0x2f,0xe4,0x04,0x12,0xfd,0x82,
+0x00,0x05,0x01,0x00,0x46,0x30,0x00,0x00,0xcf,0x0f,0x00,0x00,0x46,0x00,0x26,0x01,
+0xdf,0x0f,0x00,0x64,0x70,0x00,0x00,0x00,0x01,0xaf,0x0e,0x00,0x21,0xfe,0x50,0x94,
+0x00,0x13,0x6d,0x0f,0x00,0x23,0xf9,0x10,0xc0,0x03,0x20,0xae,0xff,0xd4,0x00,0x15,
+0x81,0xe3,0x00,0x52,0x02,0x45,0x67,0x76,0x31,0x0b,0x00,0x08,0xe9,0x03,0x11,0x3f,
+0x36,0x00,0x17,0x40,0x13,0x00,0x11,0x01,0xa2,0x00,0x18,0xf8,0x26,0x00,0x11,0x0b,
+0x25,0x00,0x18,0xb0,0x13,0x00,0x11,0x8f,0xb8,0x00,0x17,0x10,0x13,0x00,0x23,0x04,
+0xff,0x12,0x01,0x06,0x13,0x00,0x11,0x2e,0x13,0x00,0x18,0x50,0x13,0x00,0x12,0xcf,
+0x5d,0x00,0x07,0x13,0x00,0x13,0x09,0x5d,0x00,0x07,0x13,0x00,0x11,0x5f,0xd9,0x00,
+0x17,0x10,0x13,0x00,0x11,0x02,0x25,0x00,0x18,0xf3,0xbe,0x00,0x15,0x0d,0x62,0x01,
+0x05,0x13,0x00,0x11,0xaf,0x02,0x01,0x08,0xe4,0x00,0x26,0x06,0xff,0xc6,0x01,0x03,
+0x13,0x00,0x15,0x3f,0x5d,0x00,0x04,0x13,0x00,0x02,0xf2,0x00,0x18,0xf3,0x1d,0x01,
+0x16,0x0b,0x5d,0x00,0x04,0x13,0x00,0x20,0x6f,0xff,0x06,0x02,0x17,0x00,0x13,0x00,
+0x02,0x95,0x00,0x18,0xd0,0x13,0x00,0x11,0x0d,0x5d,0x00,0x18,0x20,0x13,0x00,0x01,
+0xda,0x01,0x27,0xf4,0x00,0x13,0x00,0x15,0xfb,0xf2,0x00,0x05,0x13,0x00,0x16,0xff,
+0xe0,0x00,0x0a,0x13,0x00,0x1e,0xfd,0x13,0x00,0x2e,0xff,0x80,0x13,0x00,0x1e,0xf3,
+0x13,0x00,0x1e,0xfc,0x13,0x00,0x29,0xff,0x70,0x13,0x00,0x15,0xdf,0xc3,0x02,0x04,
+0x13,0x00,0x27,0xf6,0x1f,0x3a,0x00,0x03,0x6d,0x00,0x17,0x07,0x0b,0x01,0x02,0x63,
+0x02,0x03,0xc6,0x01,0x16,0xf1,0x13,0x00,0x13,0xa0,0x57,0x01,0x15,0xfb,0xe4,0x00,
+0x00,0x0a,0x00,0x1e,0x08,0xa2,0x01,0x02,0x1d,0x03,0x19,0xe1,0x13,0x00,0x15,0x4f,
+0x59,0x01,0x05,0x13,0x00,0x14,0x0a,0x39,0x02,0x06,0x13,0x00,0x02,0xa5,0x01,0x19,
+0xe1,0xbf,0x02,0x05,0x93,0x01,0x06,0x13,0x00,0x12,0x0b,0xd0,0x02,0x08,0x13,0x00,
+0x02,0xa7,0x01,0x19,0xe0,0xf8,0x02,0x13,0x7f,0xc9,0x00,0x07,0x13,0x00,0x13,0x0d,
+0x7b,0x03,0x07,0x13,0x00,0x13,0x03,0xe1,0x01,0x08,0x31,0x03,0x1d,0x9f,0x1e,0x03,
+0x22,0x00,0x0e,0x3a,0x00,0x08,0x13,0x00,0x12,0x05,0x78,0x02,0x09,0x53,0x07,0x2f,
+0x00,0x00,0x0f,0x00,0xff,0xff,0x1e,0x24,0xfc,0xaa,0x01,0x00,0x1a,0xa3,0x14,0x0b,
+0x1f,0xf5,0x0f,0x00,0x42,0x50,0xff,0xff,0xff,0xff,0xf5,0x11,0xff,0x01,0x00,0x25,
+0x70,0x00,0x01,0x00,0x27,0x08,0xff,0x01,0x00,0x16,0xd0,0x18,0x00,0x18,0x0e,0x18,
+0x00,0x16,0xf3,0x18,0x00,0x18,0x3f,0x18,0x00,0x16,0xf8,0x18,0x00,0x18,0x9f,0x18,
+0x00,0x16,0xfe,0x18,0x00,0x28,0xef,0xff,0x01,0x00,0x14,0x30,0x17,0x00,0x29,0x04,
+0xff,0x01,0x00,0x14,0x90,0x18,0x00,0x1a,0x0a,0x18,0x00,0x14,0xe0,0x18,0x00,0x1a,
+0x0f,0x18,0x00,0x14,0xf4,0x18,0x00,0x1a,0x5f,0x18,0x00,0x14,0xfa,0x18,0x00,0x2a,
+0xbf,0xff,0x01,0x00,0x03,0x17,0x00,0x2b,0x01,0xff,0x01,0x00,0x12,0x50,0x18,0x00,
+0x18,0x06,0x14,0x00,0x52,0xcf,0xff,0xff,0xff,0xb0,0x18,0x00,0x54,0x0b,0xff,0xff,
+0xff,0xfc,0x18,0x00,0x52,0x9d,0xff,0xff,0xff,0xf1,0x18,0x00,0x54,0x1f,0xff,0xff,
+0xff,0xd9,0x18,0x00,0x52,0x98,0xff,0xff,0xff,0xf6,0x18,0x00,0x54,0x6f,0xff,0xff,
+0xff,0x7a,0x18,0x00,0x52,0xa2,0xff,0xff,0xff,0xfb,0x18,0x00,0x00,0x53,0x00,0x14,
+0x1b,0x18,0x00,0x10,0xb0,0x0e,0x00,0x10,0x10,0x17,0x00,0x10,0x02,0x5f,0x00,0x15,
+0x0b,0x18,0x00,0x14,0x7f,0x9b,0x01,0x10,0x07,0x52,0x00,0x14,0x0c,0x18,0x00,0x20,
+0xc0,0x1f,0x05,0x00,0x00,0x18,0x00,0x10,0x0d,0x82,0x00,0x15,0x0d,0xae,0x01,0x00,
+0x3a,0x00,0x10,0xf2,0x18,0x00,0x65,0x2f,0xff,0xff,0xff,0xa0,0x0d,0x35,0x01,0x50,
+0x05,0xff,0xff,0xff,0xf7,0x18,0x00,0x10,0x8f,0xe2,0x00,0x16,0x0e,0x4d,0x01,0x40,
+0xff,0xff,0xff,0xfd,0x18,0x00,0x10,0xdf,0xa3,0x01,0x05,0x53,0x01,0x32,0xf0,0x00,
+0xaf,0x9b,0x01,0x58,0x03,0xff,0xff,0xff,0xf9,0x18,0x00,0x81,0x4f,0xff,0xff,0xff,
+0x80,0x00,0x00,0x09,0x03,0x02,0x07,0x18,0x00,0x12,0x0e,0x9b,0x01,0x02,0x07,0x00,
+0x14,0x1f,0x18,0x00,0x13,0xf1,0x29,0x00,0x03,0x37,0x00,0x14,0x2f,0x18,0x00,0x13,
+0xf2,0x59,0x00,0x01,0x24,0x02,0x18,0x20,0x18,0x00,0x02,0x89,0x00,0x00,0x24,0x02,
+0x17,0xfd,0x5a,0x02,0x12,0xf3,0xb9,0x00,0x22,0x40,0x04,0xc7,0x00,0x17,0x4f,0xf5,
+0x01,0x01,0xe9,0x00,0x12,0x0a,0x88,0x01,0x08,0x18,0x00,0x10,0x0c,0x97,0x00,0x12,
+0x0f,0xb8,0x01,0x05,0x13,0x02,0x12,0xf5,0x49,0x01,0x10,0xf5,0x11,0x00,0x12,0x60,
+0x9c,0x01,0x01,0x01,0x00,0x12,0xf6,0x08,0x02,0x22,0xfb,0xbf,0x18,0x02,0x08,0x18,
+0x00,0x26,0x00,0xbf,0x48,0x02,0x14,0x7f,0x18,0x00,0x16,0xf7,0x68,0x02,0x1c,0xf4,
+0x18,0x00,0x16,0x0f,0xa8,0x02,0x09,0x18,0x00,0x16,0x0a,0xd8,0x02,0x09,0x18,0x00,
+0x16,0x04,0x08,0x03,0x09,0x18,0x00,0x02,0x28,0x03,0x2d,0xfd,0x00,0x18,0x00,0x15,
+0x9f,0x68,0x03,0x0a,0x18,0x00,0x13,0x3f,0x42,0x01,0x0c,0x18,0x00,0x11,0x0d,0x32,
+0x02,0x0e,0x18,0x00,0x15,0x08,0xf8,0x03,0x0a,0x18,0x00,0x24,0x02,0xff,0x8d,0x02,
+0x0a,0x18,0x00,0x24,0x00,0xcf,0xbd,0x02,0x0b,0x18,0x00,0x11,0x6f,0x59,0x01,0x08,
+0x18,0x00,0x19,0xfb,0xd5,0x03,0x18,0xf1,0x58,0x03,0x08,0x13,0x00,0x1e,0xe0,0x13,
+0x00,0x1e,0xf8,0x13,0x00,0x2e,0xff,0x20,0x13,0x00,0x1e,0xb0,0x13,0x00,0x1e,0xf5,
+0x13,0x00,0x1e,0xfe,0x13,0x00,0x2e,0xff,0x80,0x13,0x00,0x1e,0xf2,0x13,0x00,0x1e,
+0xfc,0x13,0x00,0x2e,0xff,0x50,0x13,0x00,0x1e,0xe0,0x13,0x00,0x1e,0xf9,0x13,0x00,
+0x2e,0xff,0x30,0x13,0x00,0x19,0xc0,0x13,0x00,0x14,0xf9,0x6d,0x02,0x06,0x13,0x00,
+0x20,0xf7,0x8f,0xc1,0x00,0x19,0x10,0x13,0x00,0x13,0x0d,0x41,0x02,0x07,0x13,0x00,
+0x13,0x04,0x1f,0x03,0x07,0x13,0x00,0x01,0xb2,0x02,0x1a,0xfc,0x13,0x00,0x01,0x62,
+0x03,0x19,0x60,0x13,0x00,0x10,0x07,0x07,0x00,0x19,0xe1,0x13,0x00,0x21,0x00,0xdf,
+0xc1,0x00,0x09,0x13,0x00,0x11,0x4f,0xc1,0x00,0x09,0x13,0x00,0x11,0x0a,0xc1,0x00,
+0x09,0x13,0x00,0x11,0x01,0xc1,0x00,0x09,0x13,0x00,0x01,0x0e,0x02,0x29,0xfe,0x14,
+0x13,0x00,0x01,0xc1,0x00,0x19,0x94,0x13,0x00,0x11,0x04,0xf6,0x01,0x09,0x13,0x00,
+0x01,0x7d,0x04,0x1a,0xff,0x13,0x00,0x1e,0x1f,0x13,0x00,0x1e,0x07,0x13,0x00,0x2e,
+0x00,0xdf,0x13,0x00,0x1e,0x4f,0x13,0x00,0x1e,0x0a,0x13,0x00,0x1e,0x01,0x13,0x00,
+0x2e,0x00,0x7f,0x13,0x00,0x1e,0x0d,0x13,0x00,0x1e,0x03,0x13,0x00,0x2e,0x00,0xaf,
+0x13,0x00,0x1e,0x1f,0x13,0x00,0x1e,0x06,0x13,0x00,0x2e,0x00,0xcf,0x13,0x00,0x1e,
+0x3f,0x13,0x00,0x12,0x09,0x5d,0x05,0x03,0x01,0x00,0x59,0x25,0x67,0x76,0x53,0x00,
+0x01,0x00,0x21,0x16,0xbf,0xc5,0x02,0x17,0x71,0x13,0x00,0x15,0x18,0x84,0x06,0x05,
+0x13,0x00,0x07,0xe3,0x06,0x14,0x80,0x0e,0x07,0x07,0x26,0x07,0x22,0xfc,0x10,0x14,
+0x00,0x18,0x1c,0x0a,0x07,0x17,0xd1,0xa7,0x00,0x05,0xdc,0x07,0x1e,0x10,0xa8,0x07,
+0x02,0x71,0x04,0x12,0x6f,0x0e,0x04,0x35,0x86,0x68,0xbf,0xdd,0x03,0x21,0x01,0xef,
+0x0a,0x00,0x54,0x10,0x00,0x00,0x01,0x7f,0xde,0x03,0x02,0x72,0x08,0x11,0x40,0x7d,
+0x04,0x01,0x1f,0x00,0x13,0xa0,0x30,0x01,0x03,0xd5,0x07,0x04,0xda,0x04,0x17,0x7f,
 0xab,0x00,0x13,0x06,0x51,0x00,0x18,0xdf,0x5d,0x08,0x02,0x0d,0x00,0x19,0x02,0x89,
-0x08,0x02,0xc6,0x40,0x19,0x06,0xb5,0x08,0x02,0xf1,0x47,0x19,0x0a,0x50,0x08,0x11,
-0x0c,0xb6,0x00,0x19,0x0d,0xa9,0x0d,0x16,0x09,0x5e,0x5c,0x19,0x80,0x36,0x01,0x29,
-0xf1,0x1f,0x01,0x25,0x02,0x86,0x03,0x0a,0x7d,0x24,0x16,0x02,0x25,0x10,0x0b,0x14,
-0x00,0x0a,0xb8,0x24,0x02,0x3b,0x03,0x1e,0x5f,0x14,0x00,0x1f,0xf7,0x14,0x00,0x01,
-0x0f,0x3c,0x00,0x01,0x1f,0x4f,0x78,0x00,0x14,0x03,0x05,0x04,0x08,0x3d,0x44,0x1f,
-0xf4,0xdc,0x00,0x01,0x0f,0x04,0x01,0x01,0x0f,0x2c,0x01,0x01,0x0f,0x54,0x01,0x01,
-0x19,0x02,0xce,0x2d,0x02,0x7c,0x01,0x03,0x20,0x11,0x08,0x1c,0x2e,0x03,0xcc,0x01,
-0x18,0x90,0x67,0x28,0x0a,0xf4,0x01,0x13,0x2e,0x5d,0x00,0x07,0x1c,0x02,0x24,0x01,
-0xdf,0x99,0x00,0x05,0x44,0x02,0x03,0x62,0x02,0x15,0x20,0x90,0x07,0x4e,0xfa,0x76,
-0x57,0x9e,0xcd,0x72,0x08,0x94,0x02,0x0b,0xbc,0x02,0x19,0x20,0x2a,0x6c,0x09,0x79,
-0x6a,0x1b,0xaf,0xde,0x21,0x0e,0x34,0x03,0x0e,0x5c,0x03,0x07,0x5a,0x2f,0x0e,0x84,
-0x03,0x0b,0xac,0x03,0x06,0x85,0x00,0x2e,0xdb,0x84,0xd3,0x0a,0x01,0xf3,0x38,0x0d,
-0x7a,0x2a,0x0b,0xf6,0x0a,0x1e,0x60,0x6a,0x2a,0x0c,0x23,0x00,0x03,0xd8,0x24,0x09,
-0x5d,0x1c,0x01,0x23,0x00,0x10,0xdc,0xcb,0x1b,0x0d,0xc0,0x2b,0x31,0x00,0x17,0xef,
-0x55,0x02,0x07,0x6e,0x1b,0x12,0x01,0xb4,0x51,0x0d,0x32,0x12,0x17,0x3f,0x39,0x0c,
-0x1d,0x06,0xb5,0x24,0x01,0x41,0x00,0x1f,0xaf,0x4c,0x24,0x0a,0x1d,0x09,0x6f,0x24,
-0x01,0x73,0x13,0x0f,0x92,0x24,0x0b,0x1c,0xef,0xfb,0x24,0x1c,0x4f,0x1e,0x25,0x15,
-0x0d,0xd8,0x0c,0x18,0xf7,0xc2,0x04,0x06,0xd2,0x00,0x22,0x14,0x9f,0x2b,0x01,0x1c,
-0xff,0x93,0x2e,0x0c,0x3b,0x01,0x0b,0x4e,0x1f,0x05,0x4c,0x24,0x0e,0xa8,0x2a,0x0d,
-0x7c,0x26,0x18,0xff,0x27,0x74,0x08,0x10,0x00,0x01,0x97,0x3b,0x14,0x0f,0x88,0x23,
-0x3e,0xba,0x98,0x74,0x9a,0x1e,0x0e,0xef,0x1c,0x0f,0x23,0x00,0xe7,0x07,0x39,0x03,
-0x1c,0x52,0x58,0x5c,0x01,0x61,0x03,0x02,0xc2,0x65,0x08,0x36,0x75,0x08,0xbb,0x42,
-0x08,0x4c,0x51,0x1e,0x70,0xe5,0x06,0x05,0x05,0x34,0x1e,0x1d,0xe5,0x06,0x2d,0x01,
-0xdf,0xd9,0x2b,0x0c,0xda,0x30,0x16,0xb0,0x27,0x08,0x05,0xe5,0x06,0x06,0xe2,0x50,
-0x24,0xf8,0x10,0x28,0x75,0x04,0xe2,0x35,0x01,0xff,0x4d,0x04,0x32,0x35,0x13,0x90,
-0xf1,0x04,0x18,0xf3,0xe7,0x07,0x03,0x68,0x15,0x08,0x2e,0x28,0x1b,0xf7,0x5a,0x3a,
-0x02,0x0d,0x00,0x19,0x03,0x3c,0x01,0x16,0x7f,0x63,0x30,0x19,0xf2,0xf9,0x2a,0x2e,
-0x70,0x0b,0xf9,0x54,0x29,0xb0,0x0e,0xda,0x2a,0x02,0xdb,0x05,0x0a,0x7a,0x01,0x11,
-0x07,0xf5,0x05,0x0a,0x3b,0x2b,0x16,0x05,0xab,0x3c,0x1a,0x30,0x45,0x06,0x0f,0x14,
-0x00,0x01,0x19,0x5f,0x2d,0x34,0x02,0x81,0x06,0x1e,0x6f,0x14,0x00,0x1f,0xf6,0x14,
-0x00,0x01,0x0f,0x3c,0x00,0x01,0x1f,0x5f,0x78,0x00,0x14,0x2e,0x3f,0xff,0x99,0x07,
-0x0f,0xdc,0x00,0x01,0x0f,0x04,0x01,0x01,0x0f,0x2c,0x01,0x01,0x0f,0x54,0x01,0x01,
-0x19,0x03,0x61,0x08,0x02,0x7c,0x01,0x0a,0xa4,0x01,0x17,0xdf,0x7b,0x4a,0x0b,0xb1,
-0x08,0x08,0xe5,0x06,0x13,0x2f,0x5d,0x00,0x07,0x1c,0x02,0x05,0x01,0x09,0x16,0x01,
-0x62,0x0d,0x06,0xe5,0x06,0x12,0x6f,0x75,0x04,0x4b,0x75,0x57,0xaf,0xff,0x3b,0x15,
-0x0a,0x94,0x02,0x0e,0xbc,0x02,0x0e,0xe4,0x02,0x0d,0x0c,0x03,0x2e,0xfd,0x10,0xe5,
-0x06,0x06,0xe6,0x06,0x1e,0x19,0x35,0x03,0x04,0x69,0x0a,0x07,0x4e,0x2c,0x03,0xac,
-0x03,0x3e,0x77,0x55,0xef,0xac,0x35,0x03,0x88,0x05,0x1e,0xf9,0x21,0x77,0x0c,0x26,
-0x22,0x1e,0x07,0x3d,0x00,0x02,0xe8,0x05,0x1c,0xf4,0xee,0x36,0x13,0xdf,0x37,0x01,
-0x0a,0x81,0x73,0x1e,0xd2,0x40,0x04,0x1e,0x8c,0xee,0x37,0x0a,0x85,0x07,0x3e,0xed,
-0xca,0x63,0x3f,0x17,0x2d,0xe8,0x20,0x86,0x07,0x1d,0xfa,0x55,0x33,0x01,0xad,0x3d,
-0x0e,0x46,0x12,0x0e,0xaf,0x34,0x0e,0xd7,0x34,0x05,0x48,0x33,0x1e,0xdf,0x7b,0x28,
-0x1e,0x4c,0x8c,0x16,0x03,0x9c,0x5d,0x0c,0xa9,0x19,0x09,0xe6,0x25,0x03,0x82,0x09,
-0x0c,0x86,0x2c,0x2c,0xfb,0x00,0xa1,0x0c,0x1d,0xfc,0xe6,0x16,0x0e,0x24,0x00,0x1d,
-0xfa,0x48,0x00,0x1d,0xf9,0x6c,0x00,0x1d,0xf6,0x90,0x00,0x18,0xf2,0x12,0x00,0x16,
-0x9f,0xdf,0x31,0x17,0xf7,0xfd,0x7a,0x1b,0x50,0xfc,0x00,0x00,0xb2,0x0e,0x0e,0x22,
-0x36,0x0c,0x47,0x32,0x0c,0x12,0x00,0x1c,0xd3,0x7a,0x01,0x1c,0xf9,0xb0,0x01,0x1e,
-0xfd,0xc2,0x01,0x0e,0x12,0x00,0x1d,0xa0,0x67,0x1a,0x18,0xf2,0x12,0x00,0x1e,0x05,
-0xb0,0x18,0x02,0x8d,0x2c,0x0d,0xc3,0x1a,0x18,0xa0,0x12,0x00,0x05,0x49,0x00,0x05,
-0x12,0x00,0x1e,0x05,0xbf,0x18,0x04,0x49,0x00,0x06,0x12,0x00,0x04,0x49,0x00,0x06,
-0x12,0x00,0x1b,0x0d,0xc3,0x2e,0x03,0x49,0x00,0x19,0xfb,0x41,0x07,0x1d,0xdf,0xcd,
-0x18,0x1d,0x5f,0xc4,0x1b,0x1d,0x0d,0x40,0x02,0x03,0x49,0x00,0x0c,0xe6,0x01,0x0a,
-0xdc,0x18,0x1c,0x5f,0xb0,0x35,0x0a,0x67,0x7d,0x58,0x35,0x67,0x77,0x64,0x10,0x80,
-0x7e,0x02,0x72,0x75,0x2b,0xa5,0x00,0xef,0x7c,0x06,0x60,0x77,0x1a,0x2c,0x3c,0x03,
-0x0b,0xac,0x30,0x1d,0x70,0xaa,0x30,0x1d,0xf8,0x68,0x33,0x2d,0xff,0x50,0x27,0x38,
-0x14,0xf1,0x35,0x00,0x44,0xb6,0x32,0x12,0x59,0x0d,0x02,0x15,0xdf,0x3a,0x5d,0x12,
-0x1a,0x89,0x07,0x17,0x01,0xea,0x04,0x11,0xaf,0x43,0x0b,0x06,0x11,0x4d,0x03,0x9d,
-0x05,0x27,0xa0,0x06,0x0e,0x20,0x02,0x1a,0x06,0x08,0x12,0x00,0x02,0x0c,0x00,0x17,
-0x05,0x83,0x0f,0x10,0x03,0xb2,0x17,0x2e,0xa0,0x03,0xdd,0x04,0x1d,0xff,0x69,0x32,
-0x16,0x9f,0x16,0x59,0x09,0x57,0x3b,0x2d,0xfa,0x30,0x14,0x3b,0x2b,0xfd,0x72,0x04,
-0x5d,0x00,0x3d,0x0a,0x19,0x20,0x8d,0x43,0x01,0x38,0x03,0x1d,0x50,0xd7,0x08,0x2d,
-0xfe,0x60,0xfd,0x08,0x29,0xfd,0x40,0x87,0x57,0x09,0x1a,0x17,0x2d,0x2a,0xff,0x1a,
-0x5f,0x2d,0x17,0xdf,0x51,0x79,0x2e,0x02,0x8d,0xc4,0x78,0x2d,0x39,0xff,0xf3,0x7c,
-0x2b,0x06,0xef,0xef,0x17,0x09,0xc3,0x0d,0x09,0x34,0x07,0x68,0x90,0x79,0x99,0x99,
-0x99,0x95,0x6e,0x07,0x27,0xd0,0xcf,0x98,0x00,0x02,0xb0,0x34,0x03,0xcd,0x12,0x07,
-0x7a,0x01,0x17,0x8f,0x4e,0x0e,0x24,0x06,0xff,0x83,0x4e,0x06,0x3c,0x73,0x05,0xde,
-0x07,0x08,0x3e,0x10,0x26,0xc0,0x08,0x5b,0x02,0x02,0x7f,0x09,0x22,0x80,0x01,0xaa,
-0x00,0x53,0x85,0x21,0x01,0x26,0xbf,0x5e,0x04,0x1b,0x6f,0x69,0x2c,0x0d,0x14,0x27,
-0x1c,0xf2,0xd8,0x18,0x06,0xdc,0x80,0x08,0xa1,0x32,0x06,0x75,0x81,0x07,0xbe,0x3d,
-0x18,0x4c,0x01,0x47,0x03,0x06,0x43,0x15,0xbf,0xbc,0x76,0x07,0x4a,0x50,0x05,0xba,
-0x76,0x1d,0xcf,0x1c,0x25,0x1f,0xf5,0x13,0x00,0x5f,0x12,0x8b,0x20,0x26,0x07,0x2d,
-0x26,0x04,0x01,0x34,0x0e,0x3b,0x3e,0x0f,0x13,0x00,0xff,0xff,0xa8,0x01,0xf9,0x03,
-0x09,0xc5,0x37,0x0f,0x12,0x00,0xff,0xf8,0x1c,0x5f,0x12,0x00,0x28,0xf7,0x5f,0xd0,
-0x14,0x06,0x97,0x15,0x17,0x20,0x95,0x15,0x09,0x6d,0x15,0x02,0x24,0x3a,0x02,0xdd,
-0x8c,0x08,0x55,0x15,0x03,0x2d,0x0b,0x06,0x7a,0x08,0x16,0xc0,0xdd,0x56,0x05,0xc9,
-0x69,0x05,0xe8,0x0a,0x03,0x36,0x09,0x02,0xe3,0x2d,0x00,0xbb,0x2d,0x24,0x24,0x6b,
-0xe6,0x08,0x0b,0xf1,0x40,0x1d,0xe1,0x2e,0x09,0x1c,0x40,0x19,0x1f,0x1d,0xf6,0x76,
-0x09,0x1c,0x60,0x9a,0x09,0x1c,0xd3,0x89,0x44,0x06,0x1e,0x81,0x2b,0x49,0xef,0xe2,
-0x09,0x00,0x74,0x3d,0x15,0x77,0x06,0x0a,0x1a,0x9f,0x6d,0x27,0x16,0x0f,0x23,0x01,
-0x1a,0xf1,0xbd,0x3b,0x02,0x5f,0x2f,0x1a,0xf5,0x7c,0x6a,0x2a,0xc0,0x09,0xf2,0x69,
-0x11,0xdf,0x9e,0x00,0x19,0x03,0x57,0x08,0x13,0x02,0x0b,0x01,0x18,0xef,0x02,0x10,
-0x13,0x07,0xb4,0x07,0x18,0x8f,0xb8,0x0e,0x13,0x0b,0xee,0x00,0x18,0x3f,0xdc,0x0f,
-0x02,0x2a,0x74,0x08,0xeb,0x0b,0x06,0x2f,0x0b,0x02,0x78,0x08,0x18,0xf6,0x9e,0x0e,
-0x13,0x50,0x71,0x00,0x18,0xfb,0xc2,0x20,0x07,0xcc,0x16,0x05,0x7e,0x10,0x29,0xfa,
-0x00,0x48,0x7f,0x16,0x00,0xac,0x56,0x16,0x2f,0xef,0x16,0x15,0x0d,0x4c,0x0a,0x16,
-0x0c,0x55,0x17,0x02,0x79,0x0a,0x06,0xeb,0x3f,0x08,0x3f,0x17,0x09,0xe9,0x30,0x26,
-0x00,0xbf,0x08,0x01,0x05,0x89,0x30,0x08,0x01,0x3e,0x14,0x7f,0x9d,0x02,0x08,0x03,
-0x3e,0x05,0xaf,0x18,0x08,0xc2,0x3c,0x05,0xe1,0x3c,0x08,0xf4,0x3d,0x05,0xea,0x0a,
-0x17,0x3f,0x5b,0x01,0x18,0x01,0xea,0x1e,0x18,0xfd,0x52,0x21,0x1c,0xf8,0x97,0x5c,
-0x03,0xcd,0x62,0x19,0x01,0x37,0x11,0x03,0x1e,0x5d,0x0a,0xf3,0x5c,0x12,0x0b,0x76,
-0x02,0x07,0x6e,0x6d,0x04,0x93,0x02,0x1c,0xb0,0x4f,0x5d,0x06,0x7c,0x20,0x1a,0xfc,
-0x39,0x10,0x15,0xf5,0x1a,0x81,0x07,0xc5,0x01,0x02,0x56,0x43,0x2a,0xf1,0x00,0x65,
-0x45,0x1b,0x02,0x02,0x2a,0x01,0x78,0x00,0x1b,0x37,0xa1,0x0b,0x01,0x34,0x01,0x1c,
-0x7b,0xe1,0x5c,0x13,0xef,0x84,0x16,0x1d,0xfb,0xca,0x0b,0x0c,0x56,0x06,0x1e,0x4f,
-0x79,0x46,0x06,0x9e,0x03,0x1e,0xb0,0xf9,0x46,0x0b,0xe5,0x10,0x1c,0x03,0xec,0x66,
-0x07,0x31,0x23,0x1f,0xfa,0x6d,0x88,0x10,0x1e,0x3f,0x37,0x47,0x04,0x27,0x0d,0x0b,
-0xac,0x90,0x0e,0x94,0x0b,0x04,0x56,0x03,0x2e,0xfe,0x00,0x6e,0x5e,0x16,0x0f,0xcd,
-0x01,0x01,0x02,0x02,0x02,0x2d,0x10,0x05,0xf2,0x00,0x17,0xf5,0x31,0x10,0x07,0xf1,
-0x6b,0x02,0xc2,0x8b,0x06,0xba,0x59,0x16,0x2f,0x58,0x01,0x07,0xf4,0x83,0x06,0x1c,
-0x05,0x1a,0x40,0x5d,0x03,0x26,0x00,0x03,0x25,0x05,0x16,0x70,0xf5,0x03,0x15,0x40,
-0xa6,0x02,0x02,0x8b,0x5c,0x16,0xa0,0xb2,0x12,0x04,0x93,0x86,0x04,0xe5,0x6f,0x16,
-0xd0,0x1f,0x13,0x15,0xb0,0xf1,0x02,0x16,0x50,0xc1,0x5d,0x16,0x0d,0x2f,0x01,0x03,
-0x96,0x5c,0x05,0xcc,0x5d,0x02,0xaf,0x1d,0x05,0x4b,0x23,0x17,0xfe,0x8d,0x47,0x16,
-0x5f,0xf7,0x01,0x03,0xda,0x62,0x05,0x3f,0x6d,0x16,0x8f,0xaa,0x01,0x03,0x05,0x63,
-0x1a,0x2f,0x0d,0x83,0x15,0xfd,0x17,0x5b,0x07,0x90,0x49,0x06,0x6e,0x33,0x02,0x52,
-0x5b,0x03,0x1b,0x03,0x16,0x20,0x10,0x02,0x14,0x50,0x7d,0x5b,0x03,0xb9,0x01,0x12,
-0x50,0x27,0x04,0x12,0xfe,0xf4,0x00,0x18,0x04,0x17,0x20,0x12,0x80,0x3e,0x00,0x12,
-0xba,0x2e,0x00,0x18,0x07,0x3e,0x00,0x12,0xb0,0x8b,0x02,0x12,0x76,0x64,0x00,0x27,
-0x0a,0xff,0xf5,0x4b,0x12,0xe0,0xaa,0x00,0x12,0x32,0x9a,0x00,0x14,0x0d,0xc4,0x01,
-0x16,0xaf,0x57,0x0f,0x00,0x9b,0x00,0x12,0xf7,0xb5,0x00,0x14,0xfb,0xe8,0x03,0x13,
-0xf4,0x27,0x58,0x11,0xbf,0xf4,0x00,0x18,0x3f,0x89,0x22,0x02,0x4d,0x20,0x10,0xf8,
-0x04,0x02,0x15,0xfe,0x2d,0x00,0x02,0x3f,0x00,0x02,0xd0,0x4e,0x35,0xf4,0x00,0x3f,
-0xed,0x64,0x16,0xf0,0x70,0x62,0x02,0x85,0x81,0x02,0x9e,0x81,0x18,0xcf,0xc8,0x7e,
-0x31,0xff,0x00,0x08,0x0f,0x00,0x11,0x0b,0xec,0x00,0x14,0xef,0xb1,0x04,0x15,0x05,
-0x22,0x67,0x11,0x80,0x21,0x00,0x25,0xd0,0x01,0x55,0x03,0x11,0x01,0xdc,0x03,0x02,
-0x4b,0x00,0x01,0x57,0x00,0x16,0x04,0x55,0x04,0x01,0x40,0x00,0x12,0x3f,0x75,0x01,
-0x04,0x8c,0x75,0x16,0xfe,0xc6,0x02,0x13,0xc0,0x61,0x83,0x13,0xcf,0xb7,0x75,0x16,
-0xfb,0xdc,0x04,0x00,0xce,0x67,0x12,0xf9,0xe0,0x01,0x2a,0xfb,0x0d,0xd3,0x46,0x22,
-0xf2,0xef,0x0b,0x03,0x13,0x4f,0xdc,0x3e,0x16,0xf4,0x3d,0x03,0x13,0xf8,0x14,0x04,
-0x00,0x17,0x00,0x01,0x46,0x00,0x06,0x82,0x05,0x13,0xfe,0xa9,0x02,0x13,0x0d,0x65,
-0x04,0x1a,0xd0,0x86,0x27,0x17,0xa0,0x2c,0x04,0x1a,0x90,0x27,0x8b,0x1b,0x60,0x0c,
-0x00,0x07,0xc7,0x20,0x1b,0x20,0x0c,0x00,0x06,0x47,0x04,0x18,0xfe,0x28,0x21,0x0a,
-0x84,0x15,0x17,0xfa,0xd8,0x04,0x19,0xfb,0xaa,0x0f,0x03,0xe5,0x04,0x1d,0x5f,0x91,
-0x8a,0x05,0xab,0x06,0x1a,0x2f,0x85,0x27,0x02,0x03,0x1b,0x06,0x4e,0x83,0x0c,0x62,
-0x54,0x03,0x0c,0x05,0x1a,0x0a,0x64,0x28,0x17,0x09,0xa7,0x19,0x1a,0x06,0xb6,0x04,
-0x17,0x05,0x2d,0x28,0x1a,0x02,0x57,0x11,0x18,0x02,0xcb,0x00,0x09,0x11,0x08,0x03,
-0x2d,0x1c,0x08,0xe5,0x00,0x07,0x77,0x00,0x18,0x10,0xfc,0x0b,0x29,0xf5,0x02,0x76,
-0x28,0x12,0xef,0x6e,0x03,0x17,0x8f,0xc6,0x06,0x13,0x07,0x82,0x00,0x17,0x0e,0x8d,
-0x05,0x19,0x1e,0xc1,0x6b,0x16,0x30,0x99,0x05,0x19,0xf1,0x45,0x4d,0x15,0x01,0xd8,
-0x00,0x29,0x3f,0xff,0x6d,0x62,0x1a,0xfd,0x0a,0x00,0x15,0x2f,0x1e,0x00,0x29,0x01,
-0xff,0xac,0x79,0x16,0xb0,0x8b,0x01,0x04,0xde,0x6d,0x03,0xd7,0x01,0x13,0x0d,0x9e,
-0x01,0x17,0x0b,0x9a,0x01,0x13,0x04,0xe8,0x01,0x18,0x4f,0xb4,0x1f,0x03,0xb3,0x41,
-0x18,0xcf,0x3b,0x01,0x11,0x2f,0xab,0x00,0x09,0x5a,0x38,0x02,0x78,0x02,0x14,0xf9,
-0x72,0x14,0x08,0x0f,0x01,0x1a,0x8f,0x47,0x06,0x18,0x6f,0x27,0x38,0x0b,0x71,0x8b,
-0x08,0x92,0x07,0x1d,0x03,0xba,0x29,0x07,0x5b,0x1f,0x1c,0x50,0x96,0x45,0x0b,0x65,
-0x07,0x18,0x07,0xa2,0x25,0x0a,0x10,0x07,0x1d,0x90,0xba,0x06,0x0b,0xb3,0x4e,0x1f,
-0x0b,0xa0,0x07,0x07,0x1c,0xfe,0xbf,0x64,0x0b,0x51,0x00,0x08,0x53,0x89,0x0b,0x9f,
-0x00,0x09,0xa1,0x00,0x1c,0xaf,0x36,0x2a,0x04,0xef,0x00,0x1e,0x6f,0x2f,0x21,0x29,
-0xf7,0x0c,0x19,0x01,0x02,0x22,0x00,0x18,0x03,0x41,0x01,0x22,0x01,0xef,0x9d,0x01,
-0x17,0xbf,0x69,0x01,0x04,0x1d,0x02,0x1c,0x2f,0x36,0x1a,0x18,0xf4,0x39,0x02,0x04,
-0x74,0x32,0x04,0x39,0x02,0x1a,0x60,0x33,0x03,0x15,0x8f,0x83,0x2f,0x06,0xbd,0x02,
-0x29,0x0e,0xff,0xb5,0x06,0x18,0xf2,0xe3,0x02,0x03,0x46,0x00,0x16,0x90,0x1f,0x01,
-0x1a,0xc0,0x35,0x03,0x04,0xf4,0x75,0x1c,0x4f,0x0f,0x45,0x13,0xfe,0x30,0x00,0x18,
-0xe0,0xd4,0x2b,0x29,0x80,0x06,0xb1,0x03,0x11,0xbf,0x70,0x00,0x19,0x1e,0x5e,0x14,
-0x02,0x4c,0x30,0x19,0xaf,0x87,0x01,0x11,0x0f,0x84,0x02,0x19,0x2f,0x3d,0x04,0x16,
-0x7f,0xa1,0x77,0x29,0xf7,0x00,0xf3,0x03,0x09,0xbc,0x08,0x04,0x68,0x17,0x04,0xbe,
-0x0b,0x08,0x8e,0x17,0x1b,0x2f,0x93,0x71,0x23,0xff,0xa0,0xdc,0x00,0x17,0xf4,0x9f,
-0x00,0x19,0x20,0xf2,0x0b,0x06,0xdc,0x0b,0x06,0x7c,0x49,0x06,0x97,0x64,0x06,0xbb,
-0x0b,0x06,0x0a,0x00,0x06,0xa1,0x25,0x15,0x8f,0x32,0x00,0x06,0x17,0x48,0x07,0xae,
-0x0b,0x04,0x64,0x34,0x03,0x1f,0x95,0x09,0x9f,0x48,0x08,0x97,0x0b,0x13,0x08,0xb6,
-0x00,0x08,0x7b,0x0e,0x02,0x69,0x0e,0x04,0x97,0x19,0x08,0xf6,0x4b,0x03,0xc3,0x27,
-0x09,0xbb,0x02,0x17,0x30,0xec,0x93,0x05,0x7b,0x6e,0x05,0x9c,0x66,0x06,0x81,0x02,
-0x2a,0xf2,0xaf,0xc7,0x2d,0x01,0x1e,0x79,0x0b,0xd4,0x0a,0x1e,0x0e,0x04,0x23,0x06,
-0x34,0x03,0x0c,0x3a,0x0b,0x0c,0xe4,0x1f,0x1e,0x7f,0x0f,0x04,0x2d,0x00,0x0e,0x86,
-0x2e,0x04,0x02,0x06,0x1e,0xfe,0x0c,0x0b,0x0c,0xc2,0x3f,0x0a,0x6d,0x03,0x0e,0xd0,
-0x49,0x0f,0x14,0x00,0xff,0x2f,0x0c,0x3b,0x2f,0x02,0x22,0x0d,0x09,0x29,0x23,0x0f,
-0x23,0x00,0x32,0x1c,0xf5,0x23,0x00,0x49,0xfb,0x07,0xbb,0xbb,0xa1,0x3c,0x09,0x5d,
-0x02,0x02,0xdc,0x78,0x0c,0x5a,0x02,0x0d,0xff,0x6a,0x1c,0xe1,0x92,0x40,0x1c,0xf5,
-0x08,0x0d,0x1c,0xfa,0x83,0x0d,0x0e,0x20,0x06,0x1c,0x40,0xfa,0x0d,0x1f,0x90,0xe5,
-0x76,0x09,0x1c,0x1e,0xdd,0x95,0x1c,0x0a,0xd0,0x40,0x1c,0x05,0xae,0x92,0x2c,0x01,
-0xef,0xce,0x4c,0x1c,0xbf,0x12,0x03,0x07,0xdf,0x8e,0x0a,0x3f,0x20,0x1a,0x00,0x69,
-0x06,0x0c,0x40,0x07,0x1d,0xfc,0x29,0x07,0x1c,0x20,0xec,0x55,0x1c,0x60,0x5a,0x0e,
-0x1c,0xb0,0x56,0x0e,0x1c,0xe1,0x52,0x0e,0x1c,0xf5,0xcd,0x0e,0x08,0x46,0x01,0x07,
-0x9f,0x8f,0x08,0xdf,0x00,0x1c,0x40,0x03,0x08,0x1c,0x90,0xf5,0x4d,0x1c,0xe0,0x46,
-0x01,0x1c,0xf4,0xd2,0x07,0x1d,0xf9,0x23,0x04,0x16,0xba,0xf0,0x46,0x1d,0x92,0xc0,
-0x18,0x0c,0x9e,0x9d,0x0c,0x4d,0x46,0x04,0xce,0x4a,0x0f,0x23,0x00,0x2e,0x03,0x5b,
-0x08,0x13,0x44,0x17,0x30,0x0f,0x0f,0x00,0x17,0x31,0xd1,0x11,0x10,0x13,0x5f,0x06,
-0x7f,0x74,0x0f,0x0f,0x00,0xff,0x53,0x03,0x77,0x01,0x0f,0xb3,0x01,0x1d,0x29,0x40,
-0xcf,0x54,0x0a,0x1a,0x06,0x94,0x03,0x1a,0x1f,0x5e,0x03,0x0a,0x4b,0x07,0x09,0x79,
-0x57,0x0a,0x72,0x57,0x03,0x77,0x03,0x1a,0xfa,0xa8,0x03,0x1a,0xf1,0xd9,0x03,0x1e,
-0x70,0x45,0x80,0x07,0x43,0x11,0x0a,0x6c,0x04,0x1e,0x90,0x46,0x70,0x0a,0x06,0x58,
-0x08,0x06,0x08,0x0a,0x51,0x04,0x19,0x10,0x82,0x04,0x1a,0xf7,0xb3,0x04,0x06,0xe6,
-0x04,0x07,0xb8,0x6d,0x0c,0x2a,0x58,0x04,0xbb,0x11,0x0e,0xdb,0x70,0x0e,0x60,0x75,
-0x0c,0x2b,0x14,0x1a,0x00,0xa7,0x08,0x0c,0x41,0x7e,0x0a,0x46,0x71,0x1a,0x09,0xf1,
-0x05,0x1a,0x3f,0xbf,0x00,0x0f,0xaa,0x01,0x1d,0x1f,0xf9,0xaa,0x01,0x0a,0x19,0x50,
-0xaa,0x01,0x1f,0xfb,0xaa,0x01,0x44,0x1f,0xff,0xaa,0x01,0x05,0x1e,0x07,0xaa,0x01,
-0x07,0xbf,0x00,0x19,0xbf,0x69,0x02,0x1a,0x05,0xbf,0x00,0x03,0x65,0x96,0x0f,0xaa,
-0x01,0x08,0x22,0xf1,0x9f,0x6c,0x09,0x0f,0x07,0x00,0x17,0x23,0x01,0x11,0x8a,0x9f,
+0x08,0x11,0x6f,0x5c,0x00,0x19,0x06,0xb5,0x08,0x11,0x1f,0x49,0x00,0x19,0x0a,0x50,
+0x08,0x11,0x0c,0xb6,0x00,0x17,0x0d,0x5e,0x04,0x03,0x68,0x01,0x28,0xf0,0x0f,0x22,
+0x01,0x02,0x79,0x00,0x28,0xf1,0x1f,0xd3,0x04,0x12,0x00,0x86,0x03,0x15,0x3f,0xc6,
+0x00,0x05,0x47,0x05,0x1f,0xf5,0x14,0x00,0x01,0x19,0x4f,0xf8,0x08,0x02,0x3b,0x03,
+0x1e,0x5f,0x14,0x00,0x1f,0xf7,0x14,0x00,0x01,0x0f,0x3c,0x00,0x01,0x1f,0x4f,0x78,
+0x00,0x14,0x03,0x05,0x04,0x17,0x00,0xb8,0x02,0x1f,0xf4,0xdc,0x00,0x01,0x0f,0x04,
+0x01,0x01,0x0f,0x2c,0x01,0x01,0x0f,0x54,0x01,0x01,0x15,0x02,0x04,0x05,0x06,0x7c,
+0x01,0x25,0x00,0xdf,0x52,0x06,0x04,0xa3,0x03,0x03,0xcc,0x01,0x03,0xe5,0x09,0x13,
+0x05,0x35,0x00,0x08,0xf4,0x01,0x13,0x2e,0x5d,0x00,0x07,0x1c,0x02,0x24,0x01,0xdf,
+0x99,0x00,0x05,0x44,0x02,0x03,0x62,0x02,0x15,0x20,0x90,0x07,0x46,0xfa,0x76,0x57,
+0x9e,0x88,0x05,0x0e,0x94,0x02,0x0d,0xbc,0x02,0x16,0x20,0xd1,0x00,0x04,0x01,0x00,
+0x19,0xe2,0xc6,0x03,0x02,0x0c,0x03,0x1f,0x20,0x34,0x03,0x07,0x0e,0x5c,0x03,0x02,
+0x2a,0x00,0x0e,0x84,0x03,0x0b,0xac,0x03,0x06,0x85,0x00,0x2e,0xdb,0x84,0xd3,0x0a,
+0x19,0xa3,0x23,0x00,0x01,0x48,0x03,0x1d,0x20,0xf6,0x0a,0x1b,0x60,0x23,0x00,0x00,
+0x53,0x01,0x0a,0x23,0x00,0x00,0xa8,0x00,0x0c,0xe3,0x0a,0x11,0x40,0x23,0x00,0x63,
+0xdc,0xcc,0xcc,0xcc,0xcc,0xef,0x29,0x07,0x06,0x5f,0x04,0x21,0x17,0xef,0x55,0x02,
+0x16,0x0f,0x16,0x0c,0x02,0x78,0x01,0x17,0xd0,0x82,0x04,0x02,0xc5,0x03,0x17,0x3f,
+0x39,0x0c,0x11,0x06,0x1e,0x00,0x08,0xa5,0x04,0x01,0x41,0x00,0x18,0xaf,0x5c,0x0c,
+0x14,0xbf,0x3b,0x0b,0x18,0xf7,0x5b,0x02,0x18,0xdf,0x23,0x00,0x10,0x9f,0x8d,0x00,
+0x08,0x23,0x00,0x1d,0x0a,0x23,0x00,0x10,0xef,0x0a,0x01,0x08,0x23,0x00,0x01,0xff,
+0x02,0x17,0x9f,0x23,0x00,0x11,0x0d,0xee,0x02,0x07,0x23,0x00,0x02,0xc2,0x04,0x06,
+0xd2,0x00,0x22,0x14,0x9f,0x2b,0x01,0x0c,0x18,0x01,0x1c,0xf2,0x3b,0x01,0x1c,0xf7,
+0x3b,0x01,0x1c,0xfa,0x5e,0x01,0x1c,0xfa,0x81,0x01,0x1c,0xf6,0xa4,0x01,0x1b,0xa1,
+0xc7,0x01,0x24,0xd7,0x10,0x1d,0x01,0x76,0xdb,0xbb,0xbb,0xbb,0xba,0x98,0x74,0x0d,
+0x02,0x18,0xf7,0x2a,0x02,0x1b,0x0f,0x97,0x0d,0x0f,0x23,0x00,0xdf,0x50,0x00,0x00,
+0x00,0x00,0x00,0x13,0x00,0x01,0x00,0x59,0x25,0x67,0x76,0x52,0x00,0x01,0x00,0x87,
+0x16,0xcf,0xff,0xff,0xff,0xff,0xfc,0x61,0x13,0x00,0x23,0x19,0xff,0x01,0x00,0x15,
+0x91,0x13,0x00,0x25,0x07,0xff,0x01,0x00,0x13,0x70,0x13,0x00,0x26,0x01,0xbf,0x14,
+0x00,0x22,0xfb,0x10,0x14,0x00,0x27,0x1d,0xff,0x01,0x00,0x12,0xd1,0x27,0x00,0x18,
+0xdf,0x14,0x00,0x11,0xfd,0x29,0x00,0x29,0x0b,0xff,0x01,0x00,0x10,0xb0,0x14,0x00,
+0x12,0x7f,0x49,0x00,0x22,0x86,0x68,0x57,0x00,0x10,0xf7,0x3b,0x00,0x01,0x0a,0x00,
+0x61,0xf8,0x10,0x00,0x00,0x01,0x8f,0x0b,0x00,0x40,0x10,0x00,0x00,0x09,0x08,0x00,
+0x20,0xfe,0x30,0x32,0x00,0x20,0x03,0xef,0x0c,0x00,0x40,0x90,0x00,0x00,0x1f,0x08,
+0x00,0x12,0xf3,0x82,0x00,0x10,0x3f,0x0c,0x00,0x47,0xf1,0x00,0x00,0x8f,0xab,0x00,
+0x13,0x07,0x51,0x00,0x10,0xef,0x3b,0x00,0x04,0xd2,0x00,0x02,0x0d,0x00,0x14,0x03,
+0x6c,0x00,0x15,0x00,0x84,0x00,0x11,0x30,0x2f,0x00,0x14,0xf2,0x14,0x00,0x11,0x2f,
+0x49,0x00,0x01,0xb2,0x00,0x14,0xd0,0x14,0x00,0x11,0x0d,0xb6,0x00,0x10,0x0e,0x06,
+0x00,0x14,0xa0,0x14,0x00,0x10,0x0a,0x0e,0x00,0x28,0xe0,0x0f,0x22,0x01,0x02,0x79,
+0x00,0x11,0xf0,0x42,0x00,0x14,0x40,0x14,0x00,0x11,0x05,0x5e,0x00,0x11,0x4f,0x6a,
+0x00,0x04,0x14,0x00,0x01,0x86,0x00,0x1f,0xf4,0x14,0x00,0x01,0x10,0x5f,0x06,0x00,
+0x14,0x20,0x14,0x00,0x10,0x02,0x0e,0x00,0x2e,0xf5,0x6f,0x14,0x00,0x1f,0xf6,0x14,
+0x00,0x01,0x0f,0x3c,0x00,0x01,0x1f,0x5f,0x78,0x00,0x14,0x01,0x47,0x01,0x14,0x50,
+0x14,0x00,0x11,0x04,0x61,0x01,0x0f,0xdc,0x00,0x01,0x0f,0x04,0x01,0x01,0x0f,0x2c,
+0x01,0x01,0x0f,0x54,0x01,0x01,0x11,0x03,0xde,0x01,0x0a,0x7c,0x01,0x0a,0xa4,0x01,
+0x12,0xdf,0x0d,0x00,0x01,0xcc,0x01,0x12,0x80,0x13,0x00,0x13,0x06,0x35,0x00,0x11,
+0x1f,0xa7,0x00,0x07,0x4f,0x00,0x19,0xf2,0x1c,0x02,0x23,0x02,0xef,0x99,0x00,0x25,
+0x01,0xff,0xe2,0x01,0x24,0x6f,0xff,0x11,0x01,0x02,0x0a,0x00,0x46,0xfa,0x75,0x57,
+0xaf,0x1e,0x00,0x1e,0x0a,0x94,0x02,0x0e,0xbc,0x02,0x0e,0xe4,0x02,0x0e,0x0c,0x03,
+0x03,0x27,0x00,0x03,0xab,0x00,0x03,0x01,0x00,0x1d,0x80,0x5c,0x03,0x05,0x35,0x03,
+0x00,0x84,0x03,0x06,0x3f,0x00,0x36,0xe3,0x00,0x00,0xac,0x03,0x49,0x77,0x55,0xef,
+0xff,0x89,0x01,0x01,0x01,0x00,0x11,0x1c,0x14,0x00,0x1a,0xf9,0xc7,0x03,0x16,0xaf,
+0xb6,0x00,0x0b,0xb5,0x03,0x1a,0x50,0x29,0x00,0x16,0x4f,0x38,0x01,0x15,0x00,0x1c,
+0x02,0x13,0xdf,0x37,0x01,0x08,0x01,0x00,0x4d,0x1b,0xff,0xd2,0x00,0x01,0x00,0x15,
+0x8c,0xb4,0x00,0x0a,0x01,0x00,0x05,0xc0,0x00,0x3a,0xed,0xca,0x63,0x12,0x00,0x00,
+0x01,0x00,0x2c,0xe8,0x20,0x12,0x00,0x3c,0xff,0xfa,0x10,0x12,0x00,0x2d,0xff,0xe4,
+0x12,0x00,0x2d,0xff,0x50,0x12,0x00,0x1d,0xf3,0x12,0x00,0x12,0xfd,0x12,0x00,0x64,
+0xfd,0xbb,0xbb,0xbb,0xbc,0xdf,0xa3,0x04,0x06,0xd7,0x03,0x22,0x4c,0xff,0x8f,0x02,
+0x07,0xe9,0x03,0x12,0x8f,0x49,0x00,0x07,0x12,0x00,0x12,0x0b,0x0c,0x00,0x07,0x12,
+0x00,0x12,0x02,0x64,0x01,0x08,0x1f,0x04,0x10,0xdf,0xb4,0x01,0x09,0x12,0x00,0x10,
+0xaf,0x3a,0x05,0x09,0x12,0x00,0x1f,0x9f,0x24,0x00,0x02,0x1d,0xfa,0x48,0x00,0x1d,
+0xf9,0x6c,0x00,0x1d,0xf6,0x90,0x00,0x18,0xf2,0x12,0x00,0x10,0x9f,0x0c,0x00,0x17,
+0xc0,0x12,0x00,0x13,0x5c,0x21,0x01,0x0b,0xfc,0x00,0x1d,0xfc,0x20,0x01,0x1d,0xf2,
+0x12,0x00,0x1c,0x30,0x12,0x00,0x1c,0xd3,0x7a,0x01,0x1c,0xf9,0xb0,0x01,0x1e,0xfd,
+0xc2,0x01,0x0e,0x12,0x00,0x14,0xa0,0x12,0x00,0x14,0xf7,0xf8,0x03,0x18,0xf2,0x12,
+0x00,0x11,0x05,0xf8,0x01,0x08,0x12,0x00,0x24,0x00,0xdf,0x49,0x00,0x05,0x12,0x00,
+0x14,0x5f,0x49,0x00,0x05,0x12,0x00,0x05,0x49,0x00,0x05,0x12,0x00,0x05,0x49,0x00,
+0x06,0x0e,0x01,0x04,0x49,0x00,0x06,0x12,0x00,0x04,0x49,0x00,0x06,0x12,0x00,0x17,
+0x0d,0x40,0x02,0x16,0xf7,0x8c,0x05,0x18,0xfb,0x12,0x00,0x02,0x49,0x00,0x18,0x30,
+0x12,0x00,0x12,0x5f,0x59,0x03,0x07,0x12,0x00,0x1d,0x0d,0x40,0x02,0x2d,0x05,0xff,
+0xf8,0x01,0x02,0x49,0x00,0x08,0x12,0x00,0x02,0x49,0x00,0x08,0x12,0x00,0x17,0x0c,
+0xb9,0x06,0x58,0x00,0x35,0x67,0x77,0x64,0x5e,0x03,0x21,0x38,0xcf,0xcf,0x04,0x15,
+0xa5,0x11,0x00,0x14,0x5c,0x68,0x01,0x13,0xe7,0x11,0x00,0x1a,0x2c,0x3c,0x03,0x03,
+0x87,0x00,0x09,0xa8,0x07,0x18,0x6f,0x12,0x00,0x14,0xf8,0xdf,0x05,0x09,0x61,0x03,
+0x1a,0x0d,0x12,0x00,0x14,0xf1,0x35,0x00,0x44,0xb6,0x32,0x12,0x59,0x0d,0x02,0x01,
+0xcd,0x00,0x01,0x0f,0x04,0x12,0x1a,0x89,0x07,0x17,0x01,0xea,0x04,0x01,0x7b,0x04,
+0x21,0x60,0x04,0x60,0x06,0x02,0x99,0x00,0x11,0x1f,0x7c,0x01,0x11,0x06,0x22,0x06,
+0x08,0x1a,0x06,0x08,0x12,0x00,0x02,0x0c,0x00,0x13,0x05,0x73,0x00,0x01,0x7a,0x06,
+0x6e,0xaa,0xaa,0xaa,0xaa,0xa0,0x03,0xdd,0x04,0x11,0xff,0x61,0x00,0x08,0x12,0x00,
+0x11,0x9f,0x02,0x02,0x17,0x20,0x12,0x00,0x12,0x2f,0x56,0x04,0x07,0xc6,0x04,0x13,
+0x09,0xba,0x02,0x16,0x72,0x13,0x00,0x13,0xcf,0xe4,0x00,0x15,0xd7,0x3a,0x00,0x05,
+0xcd,0x05,0x2d,0xfc,0x50,0xd7,0x08,0x2d,0xfe,0x60,0xfd,0x08,0x14,0xfd,0xc7,0x07,
+0x16,0x2a,0xc9,0x04,0x1d,0x00,0x13,0x00,0x14,0xd1,0x13,0x00,0x26,0x17,0xdf,0xa4,
+0x04,0x04,0x6b,0x05,0x3c,0x8d,0xff,0xff,0xab,0x05,0x37,0x39,0xff,0xff,0x3d,0x01,
+0x02,0x1e,0x01,0x11,0xef,0x82,0x00,0x08,0xf4,0x00,0x29,0x08,0xff,0x48,0x08,0x05,
+0x34,0x07,0x68,0x90,0x79,0x99,0x99,0x99,0x95,0x6e,0x07,0x27,0xd0,0xcf,0x98,0x00,
+0x11,0x08,0x68,0x01,0x12,0xbf,0x1b,0x04,0x07,0x7a,0x01,0x13,0x8f,0x51,0x09,0x06,
+0x12,0x00,0x17,0x4f,0xa9,0x06,0x16,0x0a,0xde,0x07,0x17,0xf4,0x59,0x09,0x26,0xc0,
+0x08,0x5b,0x02,0x02,0x7f,0x09,0x22,0x80,0x01,0xaa,0x00,0x53,0x85,0x21,0x01,0x26,
+0xbf,0x5e,0x04,0x09,0x75,0x02,0x01,0x61,0x03,0x1d,0x09,0x93,0x04,0x2c,0x00,0x9f,
+0x88,0x02,0x08,0x64,0x0a,0x04,0x0d,0x01,0x16,0x3c,0x11,0x00,0x13,0xfc,0xdb,0x01,
+0x15,0x4c,0x8c,0x01,0x05,0x12,0x02,0x12,0x27,0x79,0x00,0x18,0xd9,0xc3,0x06,0x5a,
+0x24,0x67,0x77,0x65,0x30,0xf6,0x01,0x07,0x5d,0x00,0x0f,0x13,0x00,0x5f,0x21,0x8b,
+0xbb,0x01,0x00,0x03,0xae,0x05,0x00,0x01,0x00,0x17,0xb3,0xde,0x02,0x1e,0xf6,0x4e,
+0x07,0x0f,0x13,0x00,0xff,0xff,0x9e,0x50,0x00,0x00,0x00,0x00,0x00,0x63,0x6f,0xff,
+0xff,0xff,0xff,0x00,0x01,0x00,0x5f,0xef,0xff,0xff,0xff,0xf8,0x12,0x00,0xff,0xf8,
+0x1c,0x5f,0x12,0x00,0x11,0xf7,0x12,0x00,0x13,0x10,0x12,0x00,0x10,0xff,0x12,0x00,
+0x10,0x4f,0x06,0x00,0x12,0x20,0x11,0x00,0x10,0x01,0x0c,0x00,0x20,0xf5,0x2f,0x06,
+0x00,0x12,0x60,0x12,0x00,0x10,0x05,0x0c,0x00,0x20,0xf3,0x0e,0x06,0x00,0x12,0xb0,
+0x12,0x00,0x10,0x09,0x0c,0x00,0x20,0xf0,0x0b,0x06,0x00,0x12,0xf2,0x12,0x00,0x10,
+0x1f,0x0c,0x00,0x20,0xc0,0x06,0x06,0x00,0x12,0xfd,0x5b,0x00,0x10,0xcf,0x0c,0x00,
+0x11,0x70,0x60,0x00,0x20,0xff,0xd3,0x11,0x00,0x22,0x2c,0xff,0x78,0x00,0x11,0x8f,
+0x08,0x00,0x41,0xc7,0x43,0x24,0x6b,0x09,0x00,0x59,0xf9,0x00,0x00,0x0e,0xff,0x01,
+0x00,0x4a,0xe1,0x00,0x00,0x03,0x12,0x00,0x58,0x40,0x00,0x00,0x00,0x5f,0x11,0x00,
+0x15,0xf6,0x98,0x00,0x04,0x01,0x00,0x26,0x60,0x00,0x64,0x00,0x05,0x74,0x00,0x00,
+0x01,0x00,0x14,0x6d,0x11,0x00,0x24,0xe7,0x00,0x01,0x00,0x20,0x49,0xef,0x10,0x00,
+0x36,0xfe,0xa5,0x00,0x01,0x00,0x53,0x01,0x45,0x77,0x77,0x64,0x14,0x01,0x11,0x9f,
+0xcc,0x00,0x05,0x1b,0x00,0x16,0x0f,0x23,0x01,0x15,0xf1,0x15,0x00,0x02,0x0f,0x00,
+0x11,0x0e,0x2c,0x01,0x05,0x15,0x00,0x11,0x8f,0x39,0x00,0x01,0x1d,0x01,0x15,0xfa,
+0x15,0x00,0x11,0xdf,0x9e,0x00,0x11,0x03,0x72,0x00,0x04,0x14,0x00,0x13,0x02,0x0b,
+0x01,0x01,0x88,0x00,0x13,0x30,0x15,0x00,0x10,0x07,0x0d,0x00,0x13,0xfb,0x46,0x00,
+0x13,0x80,0x15,0x00,0x13,0x0b,0xee,0x00,0x10,0x3f,0x08,0x00,0x17,0xd0,0x92,0x00,
+0x00,0x8c,0x00,0x17,0x0d,0x81,0x01,0x23,0x00,0x5f,0xa0,0x01,0x14,0x08,0x20,0x01,
+0x00,0x01,0x00,0x10,0xaf,0x0d,0x00,0x13,0x50,0x71,0x00,0x17,0xfb,0x05,0x02,0x15,
+0xff,0x9b,0x00,0x02,0x14,0x00,0x15,0x03,0xb5,0x00,0x14,0x7f,0x71,0x01,0x03,0x4b,
+0x00,0x01,0xdf,0x00,0x01,0x0f,0x02,0x11,0x90,0x15,0x00,0x11,0x0d,0xfc,0x01,0x00,
+0x0a,0x00,0x10,0x0c,0x0a,0x00,0x16,0xe0,0xff,0x01,0x15,0xa0,0xc6,0x00,0x11,0xf3,
+0x15,0x00,0x15,0x6f,0x4a,0x00,0x11,0x01,0x43,0x01,0x01,0x15,0x00,0x16,0xbf,0x08,
+0x01,0x00,0x22,0x02,0x15,0xfc,0x85,0x02,0x12,0xf9,0x15,0x00,0x14,0x7f,0x9d,0x02,
+0x10,0x04,0x09,0x00,0x17,0xf4,0x5e,0x02,0x14,0x50,0x79,0x02,0x12,0xe0,0x15,0x00,
+0x14,0x0c,0x74,0x00,0x16,0x0e,0x9d,0x00,0x24,0x00,0x06,0x9e,0x00,0x17,0x3f,0x5b,
+0x01,0x14,0x01,0x4b,0x00,0x10,0x7f,0x9f,0x02,0x04,0x85,0x01,0x10,0xbf,0x1e,0x03,
+0x03,0x87,0x00,0x00,0x08,0x00,0x05,0xb4,0x00,0x13,0xfd,0x32,0x00,0x19,0xf2,0x02,
+0x02,0x38,0x20,0x00,0x06,0x84,0x01,0x22,0x00,0x0b,0x76,0x02,0x12,0x0a,0xe7,0x02,
+0x17,0x00,0x2b,0x03,0x14,0xb0,0x31,0x00,0x04,0x01,0x00,0x02,0x94,0x00,0x15,0x4f,
+0xef,0x00,0x05,0x9b,0x01,0x35,0xf5,0x00,0x9f,0x19,0x01,0x05,0xc5,0x01,0x39,0xf9,
+0x00,0xdf,0x6b,0x02,0x01,0x4e,0x00,0x2a,0xfe,0x02,0x95,0x02,0x02,0x78,0x00,0x17,
+0x37,0xa6,0x03,0x14,0x00,0x34,0x01,0x18,0x7b,0xdf,0x03,0x04,0xf0,0x01,0x17,0xdf,
+0x00,0x02,0x06,0xe5,0x02,0x07,0x2a,0x02,0x06,0xd6,0x02,0x0a,0x7d,0x00,0x06,0x9e,
+0x03,0x03,0xfc,0x03,0x07,0x02,0x04,0x03,0x95,0x01,0x05,0x01,0x00,0x04,0xb6,0x03,
+0x08,0x14,0x00,0x03,0x6f,0x02,0x07,0x11,0x03,0x06,0x2b,0x03,0x2a,0xff,0xf5,0x15,
+0x00,0x25,0x3f,0xff,0x5c,0x02,0x06,0x01,0x00,0x25,0x0d,0xff,0x5c,0x02,0x06,0x01,
+0x00,0x15,0x08,0x17,0x04,0x07,0x01,0x00,0x19,0x02,0x64,0x03,0x07,0xd7,0x01,0x16,
+0x0f,0xcd,0x01,0x01,0x02,0x02,0x16,0x9f,0x0d,0x01,0x16,0x4f,0x86,0x00,0x10,0xaf,
+0xa6,0x00,0x16,0x5f,0x43,0x00,0x16,0x7f,0x95,0x02,0x10,0xdf,0x29,0x01,0x16,0x2f,
+0x58,0x01,0x16,0xbf,0x48,0x02,0x06,0x1c,0x05,0x1a,0x40,0x5d,0x03,0x26,0x00,0x03,
+0x25,0x05,0x16,0x70,0xf5,0x03,0x15,0x40,0xa6,0x02,0x25,0xc0,0x07,0xd9,0x00,0x25,
+0x06,0xff,0xf4,0x03,0x11,0x09,0x0a,0x00,0x15,0x04,0x6b,0x02,0x16,0x0a,0x7c,0x01,
+0x12,0x0c,0x71,0x01,0x05,0x24,0x01,0x16,0x0d,0x2f,0x01,0x12,0x0f,0x9c,0x00,0x14,
+0xdf,0x7c,0x03,0x25,0x1f,0xff,0xc1,0x02,0x12,0x2f,0xd2,0x00,0x14,0x9f,0xec,0x01,
+0x02,0x48,0x05,0x05,0x0b,0x00,0x12,0xfa,0xf4,0x02,0x16,0xf9,0x95,0x01,0x14,0xfa,
+0x0b,0x00,0x12,0xf7,0x3d,0x00,0x15,0xfc,0xce,0x05,0x24,0xff,0xfd,0xfd,0x00,0x13,
+0xf3,0x73,0x00,0x04,0x02,0x01,0x03,0x1a,0x01,0x12,0xef,0x90,0x00,0x13,0x0b,0xff,
+0x02,0x16,0x03,0x25,0x02,0x13,0x01,0xbf,0x02,0x13,0x08,0x10,0x00,0x10,0x07,0x96,
+0x00,0x02,0xf4,0x00,0x13,0x04,0xbf,0x03,0x13,0x04,0x04,0x01,0x00,0x3e,0x00,0x12,
+0xba,0x2e,0x00,0x18,0x07,0x3e,0x00,0x12,0xb0,0x8b,0x02,0x12,0x76,0x64,0x00,0x14,
+0x0a,0x63,0x03,0x12,0xdf,0x12,0x04,0x00,0xaa,0x00,0x12,0x32,0x9a,0x00,0x14,0x0d,
+0xc4,0x01,0x12,0xaf,0xcb,0x02,0x10,0x6f,0xa9,0x00,0x11,0xef,0xd0,0x00,0x14,0x0f,
+0xfa,0x01,0x12,0x6f,0x12,0x04,0x10,0x9f,0xdf,0x00,0x11,0xbf,0xf4,0x00,0x14,0x3f,
+0x8a,0x03,0x03,0x09,0x00,0x10,0xdf,0x3f,0x02,0x11,0x7f,0x4a,0x00,0x14,0x6f,0x8a,
+0x04,0x11,0x0f,0x1f,0x01,0x11,0x01,0x0f,0x00,0x11,0x3f,0x80,0x00,0x18,0x9f,0x0d,
+0x05,0x11,0xfd,0xc4,0x00,0x11,0xf0,0x27,0x00,0x11,0x50,0x33,0x01,0x15,0xc0,0xad,
+0x02,0x01,0x06,0x00,0x11,0xc0,0xdd,0x00,0x11,0x90,0x28,0x01,0x15,0x90,0x30,0x04,
+0x21,0x30,0x0c,0xf9,0x00,0x10,0x08,0xf3,0x01,0x15,0x01,0x55,0x03,0x11,0x01,0xdc,
+0x03,0x02,0x4b,0x00,0x01,0x57,0x00,0x16,0x04,0x55,0x04,0x01,0x40,0x00,0x12,0x3f,
+0x75,0x01,0x00,0x8d,0x00,0x01,0x4e,0x01,0x06,0xc6,0x02,0x21,0xc0,0x7f,0xab,0x01,
+0x00,0x82,0x00,0x26,0xf7,0x0a,0xec,0x02,0x10,0x6f,0x46,0x00,0x11,0xaf,0xec,0x01,
+0x00,0xe0,0x01,0x26,0xfb,0x0d,0x7c,0x04,0x10,0x3f,0x2e,0x02,0x12,0xef,0x0b,0x03,
+0x00,0x13,0x03,0x16,0x1f,0x7c,0x05,0x10,0x0f,0x48,0x03,0x03,0x14,0x04,0x00,0x17,
+0x00,0x01,0x46,0x00,0x06,0x82,0x05,0x13,0xfe,0xa9,0x02,0x13,0x0d,0x65,0x04,0x18,
+0xd0,0xa1,0x03,0x02,0xdf,0x02,0x04,0x2c,0x04,0x17,0x90,0x24,0x05,0x03,0xb8,0x04,
+0x08,0x0c,0x00,0x04,0xf4,0x00,0x03,0xe6,0x00,0x08,0x0c,0x00,0x06,0x47,0x04,0x16,
+0xfe,0x54,0x07,0x06,0x68,0x04,0x17,0xaf,0x62,0x04,0x02,0xd8,0x04,0x05,0xeb,0x04,
+0x17,0x7f,0xe5,0x04,0x02,0xfa,0x02,0x1a,0xf8,0x6e,0x04,0x25,0xf3,0x00,0xe0,0x06,
+0x29,0xff,0xf4,0xf1,0x05,0x03,0xe6,0x00,0x1a,0x0e,0x12,0x05,0x17,0x0c,0x0c,0x05,
+0x02,0x9c,0x03,0x1a,0xd0,0x14,0x05,0x16,0x70,0x88,0x06,0x06,0xb6,0x04,0x02,0xe8,
+0x00,0x17,0x30,0xfd,0x07,0x1a,0x60,0x0c,0x08,0x08,0xe5,0x00,0x19,0x30,0x3b,0x05,
+0x18,0xfb,0xe5,0x00,0x07,0x77,0x00,0x17,0x10,0xb2,0x06,0x38,0xff,0xf5,0x02,0x62,
+0x01,0x22,0x00,0xef,0x6e,0x03,0x17,0x8f,0xc6,0x06,0x13,0x07,0x82,0x00,0x17,0x0e,
+0x8d,0x05,0x13,0x1e,0x78,0x07,0x08,0x9e,0x00,0x14,0x8f,0xee,0x00,0x15,0xcf,0x71,
+0x06,0x15,0x01,0xd8,0x00,0x15,0x3f,0x26,0x01,0x15,0x09,0x0f,0x04,0x06,0x0a,0x00,
+0x15,0x2f,0x1e,0x00,0x15,0x01,0x1c,0x06,0x16,0xaf,0x2e,0x01,0x13,0x7f,0x2d,0x01,
+0x17,0x03,0xd7,0x01,0x13,0x0d,0x9e,0x01,0x17,0x0b,0x9a,0x01,0x13,0x04,0xe8,0x01,
+0x17,0x4f,0xec,0x07,0x22,0x00,0xbf,0x83,0x00,0x18,0xcf,0x3b,0x01,0x11,0x2f,0xab,
+0x00,0x01,0xbd,0x00,0x19,0xfc,0x19,0x06,0x26,0xf9,0x0d,0xda,0x01,0x05,0x0f,0x01,
+0x1a,0x8f,0x47,0x06,0x01,0x37,0x01,0x09,0x49,0x01,0x04,0xdc,0x01,0x0a,0x92,0x07,
+0x05,0x8a,0x0a,0x2a,0xe0,0x00,0xbc,0x07,0x0c,0xfe,0x06,0x2a,0x1f,0xff,0x7a,0x02,
+0x06,0x75,0x01,0x06,0x49,0x08,0x07,0xc9,0x02,0x1d,0x90,0xba,0x06,0x09,0xdf,0x07,
+0x03,0x13,0x01,0x0f,0xa0,0x07,0x03,0x18,0xfe,0xde,0x07,0x1a,0xdf,0x5e,0x03,0x07,
+0x77,0x00,0x09,0x79,0x00,0x14,0x1f,0x14,0x00,0x1e,0xfb,0xc7,0x00,0x07,0xc9,0x00,
+0x02,0xef,0x00,0x19,0x6f,0xf1,0x00,0x11,0x0c,0x13,0x01,0x19,0x0c,0x19,0x01,0x02,
+0x22,0x00,0x18,0x03,0x41,0x01,0x22,0x01,0xef,0x9d,0x01,0x17,0xbf,0x69,0x01,0x04,
+0x1d,0x02,0x06,0x1b,0x02,0x06,0x0c,0x00,0x06,0x39,0x02,0x03,0xdf,0x01,0x14,0xc0,
+0x39,0x02,0x1a,0x60,0x33,0x03,0x13,0x8f,0x15,0x0c,0x17,0x00,0xbd,0x02,0x29,0x0e,
+0xff,0xb5,0x06,0x18,0xf2,0xe3,0x02,0x03,0x46,0x00,0x16,0x90,0x1f,0x01,0x1a,0xc0,
+0x35,0x03,0x13,0x5f,0x7c,0x08,0x17,0x4f,0xd3,0x00,0x13,0x0c,0x76,0x02,0x17,0xdf,
+0xfb,0x00,0x12,0x04,0x97,0x07,0x19,0x06,0xb1,0x03,0x11,0xbf,0x70,0x00,0x28,0x1e,
+0xff,0x4b,0x0a,0x60,0x3f,0xff,0xff,0xff,0xff,0xfb,0x73,0xaf,0xff,0xff,0xff,0xff,
+0x90,0x00,0x01,0x00,0x10,0x0f,0x0e,0x00,0x20,0xf3,0x2f,0x06,0x00,0x14,0xf1,0x14,
+0x00,0x10,0x7f,0x0e,0x00,0x20,0xb0,0x0a,0x06,0x00,0x14,0xf7,0x14,0x00,0x10,0xef,
+0x0e,0x00,0x20,0x30,0x02,0x06,0x00,0x13,0xfe,0x13,0x00,0x10,0x05,0x0d,0x00,0x31,
+0xfa,0x00,0x00,0x51,0x00,0x12,0x50,0x14,0x00,0x10,0x0d,0x0c,0x00,0x31,0xf2,0x00,
+0x00,0x51,0x00,0x12,0xd0,0x14,0x00,0x10,0x4f,0x0c,0x00,0x31,0xa0,0x00,0x00,0x51,
+0x00,0x12,0xf4,0x14,0x00,0x10,0xbf,0x0c,0x00,0x31,0x20,0x00,0x00,0x51,0x00,0x11,
+0xfb,0x13,0x00,0x13,0x03,0x4f,0x00,0x33,0x00,0x00,0x9f,0x1d,0x00,0x03,0x33,0x00,
+0x10,0xf2,0x0a,0x00,0x13,0x1f,0x45,0x00,0x08,0x0a,0x00,0x15,0x09,0xb6,0x00,0x15,
+0x8f,0x32,0x00,0x10,0x01,0x0a,0x00,0x10,0xf8,0x0a,0x00,0x00,0x09,0x00,0x12,0xf9,
+0x6e,0x00,0x13,0x9f,0xb6,0x00,0x17,0x07,0xe7,0x00,0x01,0x47,0x00,0x47,0x60,0x00,
+0x00,0x0e,0x0f,0x01,0x13,0x08,0xb6,0x00,0x10,0x5f,0x08,0x00,0x35,0x10,0x00,0x00,
+0x51,0x00,0x46,0xf5,0x00,0x00,0xdf,0x4f,0x00,0x02,0x70,0x00,0x39,0xfc,0x00,0x04,
+0x36,0x01,0x11,0x1f,0x22,0x01,0x10,0x0b,0x06,0x00,0x37,0x80,0x00,0x00,0x51,0x00,
+0x26,0xb0,0x3f,0x4f,0x00,0x00,0x51,0x00,0x10,0xef,0xd4,0x00,0x14,0xaf,0xa7,0x00,
+0x06,0x73,0x01,0x19,0xfb,0x4f,0x00,0x03,0x9a,0x00,0x09,0x4f,0x00,0x03,0xc2,0x00,
+0x09,0x4f,0x00,0x04,0x9c,0x01,0x07,0xac,0x01,0x05,0xc4,0x01,0x5d,0xff,0xff,0xe0,
+0x00,0x00,0x51,0x00,0x18,0x70,0x14,0x00,0x28,0x06,0xff,0xd3,0x01,0x08,0x51,0x00,
+0x1a,0xf7,0x14,0x00,0x1d,0x6f,0x4f,0x00,0x03,0x3d,0x02,0x1f,0x80,0x14,0x00,0xff,
+0x35,0x2b,0xbf,0xff,0x01,0x00,0x1c,0x7b,0x11,0x00,0x1f,0xf7,0x23,0x00,0x32,0x1c,
+0xf5,0x23,0x00,0x35,0xfb,0x07,0xbb,0x01,0x00,0x1d,0xbc,0x5d,0x02,0x17,0xbf,0xde,
+0x03,0x06,0x5a,0x02,0x17,0xa0,0x11,0x00,0x01,0xec,0x03,0x17,0xe1,0x11,0x00,0x13,
+0x0c,0x33,0x03,0x19,0x00,0x07,0x03,0x17,0xfa,0x11,0x00,0x11,0x03,0x75,0x02,0x08,
+0x67,0x00,0x10,0xdf,0x12,0x00,0x17,0x40,0x11,0x00,0x19,0x9f,0xa7,0x04,0x04,0x47,
+0x04,0x17,0xd0,0x11,0x00,0x11,0x1e,0xbb,0x04,0x07,0x11,0x00,0x15,0x0a,0xfc,0x03,
+0x08,0xa2,0x04,0x17,0xfd,0x11,0x00,0x12,0x01,0xc7,0x04,0x0c,0xdf,0x00,0x1c,0x70,
+0xe8,0x02,0x1c,0xc0,0xdf,0x00,0x1c,0xf2,0xdf,0x00,0x2b,0xf7,0x00,0x95,0x03,0x17,
+0xfc,0x11,0x00,0x25,0x02,0xff,0x90,0x04,0x03,0x01,0x00,0x13,0xcf,0x6e,0x04,0x18,
+0x00,0x42,0x04,0x27,0xff,0xb0,0x11,0x00,0x1c,0x3f,0x46,0x01,0x1c,0x0d,0x46,0x01,
+0x1c,0x09,0x46,0x01,0x1c,0x04,0x46,0x01,0x2c,0x01,0xef,0x46,0x01,0x1c,0xaf,0x46,
+0x01,0x1c,0x5f,0xc7,0x03,0x17,0x1e,0x96,0x05,0x01,0x01,0x00,0x17,0x0b,0x39,0x05,
+0x07,0x23,0x04,0x25,0xba,0xaa,0x01,0x00,0x2c,0x92,0xff,0x01,0x00,0x2c,0xaf,0xff,
+0x54,0x02,0x0d,0x23,0x00,0x1f,0xbf,0x23,0x00,0x32,0x12,0x4f,0x07,0x00,0x12,0x44,
+0x07,0x00,0x1f,0xf4,0x0f,0x00,0x17,0x42,0xd1,0x11,0x10,0x4f,0x0d,0x02,0x13,0x04,
+0x48,0x02,0x0f,0x0f,0x00,0xff,0x53,0x03,0x77,0x01,0x0f,0xb3,0x01,0x1d,0x10,0x40,
+0x30,0x03,0x1a,0xf6,0x82,0x02,0x06,0x94,0x03,0x1a,0x1f,0x5e,0x03,0x0a,0x4b,0x07,
+0x1a,0x04,0xe1,0x02,0x1a,0x0e,0x12,0x03,0x19,0x8f,0x43,0x03,0x1a,0x02,0x72,0x07,
+0x1a,0x0c,0x0c,0x04,0x1a,0x6f,0x3d,0x04,0x0a,0x6e,0x04,0x1a,0x0a,0x59,0x03,0x1a,
+0x4f,0x45,0x07,0x19,0xdf,0xbb,0x03,0x02,0x06,0x08,0x0a,0x51,0x04,0x19,0x10,0x82,
+0x04,0x1a,0xf7,0xb3,0x04,0x1a,0xd0,0x22,0x06,0x19,0x30,0x15,0x05,0x1a,0xfa,0x46,
+0x05,0x1a,0xf0,0x31,0x04,0x19,0x60,0xa8,0x05,0x16,0xfc,0x1b,0x04,0x0a,0xc6,0x04,
+0x1a,0x0b,0x8e,0x06,0x1a,0x5f,0xbf,0x00,0x19,0xef,0x13,0x04,0x1a,0x09,0xf1,0x05,
+0x1a,0x3f,0xbf,0x00,0x0f,0xaa,0x01,0x1d,0x1f,0xf9,0xaa,0x01,0x0a,0x19,0x50,0xaa,
+0x01,0x1f,0xfb,0xaa,0x01,0x44,0x1e,0xff,0xaa,0x01,0x07,0xca,0x05,0x0b,0xaa,0x01,
+0x19,0x20,0xaa,0x01,0x1a,0xf8,0xaa,0x01,0x1a,0xe0,0xaa,0x01,0x1f,0x40,0xaa,0x01,
+0x09,0x22,0xf1,0x9f,0x6c,0x09,0x0f,0x07,0x00,0x17,0x32,0x01,0x11,0x3f,0x99,0x01,
 0x1f,0x2f,0x07,0x00,0xff,0x42,0x03,0x5e,0x01,0x0f,0x96,0x01,0x1e,0x04,0x29,0x02,
-0x18,0x70,0xba,0x02,0x1e,0xe0,0x41,0x27,0x04,0x2f,0x58,0x09,0x04,0x39,0x18,0x10,
-0x79,0x12,0x18,0x80,0x98,0x0b,0x18,0xe0,0x5a,0x39,0x18,0xf5,0x14,0x0a,0x15,0xfb,
-0x03,0x03,0x18,0x99,0xb2,0x80,0x14,0x33,0x42,0x00,0x13,0x0e,0xa0,0x78,0x01,0x42,
-0x00,0x01,0x86,0x60,0x01,0xc7,0xa6,0x04,0x40,0x61,0x12,0x1f,0x08,0x04,0x11,0x02,
-0xdb,0x02,0x12,0x0b,0x42,0x00,0x02,0xa9,0x61,0x03,0x82,0x62,0x12,0x0f,0x12,0x03,
-0x02,0x4d,0x04,0x12,0x6f,0xa3,0x03,0x14,0x9f,0xf4,0x7a,0x12,0xf3,0xf3,0x03,0x37,
-0xfc,0x00,0x03,0x43,0x13,0x23,0x30,0x09,0x00,0x01,0x10,0x07,0x42,0x00,0x17,0x0f,
-0x0c,0x13,0x14,0xf0,0x60,0x60,0x00,0xbc,0x00,0x29,0xf6,0x22,0x01,0x00,0x1f,0x1f,
-0x36,0x51,0x09,0x1f,0x8f,0x1d,0x00,0x35,0x68,0x1c,0xdd,0xdd,0xdd,0xdd,0x90,0xa7,
-0x56,0x05,0xde,0x04,0x05,0x2c,0x17,0x05,0x76,0x5e,0x01,0x88,0x14,0x04,0xc7,0x04,
-0x14,0x70,0xd4,0x29,0x13,0x20,0x23,0x2a,0x14,0xfb,0xbc,0x03,0x14,0xf5,0x75,0x55,
-0x2b,0x65,0x30,0x50,0x49,0x2b,0xfc,0x60,0xba,0x55,0x03,0x1d,0x3f,0x19,0xcf,0xe1,
-0x33,0x29,0x03,0xef,0x00,0x2a,0x08,0xae,0x4c,0x1b,0xfb,0x83,0x22,0x14,0xf5,0xba,
-0x3f,0x23,0x65,0x58,0xc6,0x81,0x14,0x0b,0x2f,0x31,0x16,0x9f,0x7d,0x26,0x14,0xf4,
-0xbc,0x04,0x25,0xf7,0x00,0xdb,0x71,0x03,0xa9,0x17,0x14,0x22,0x19,0x7d,0x1a,0x4f,
-0x47,0x11,0x0c,0x4a,0x7f,0x06,0x23,0x72,0x37,0x15,0x8b,0xde,0x89,0x3c,0x29,0x06,
-0xcf,0x26,0x41,0x1a,0x5d,0xa8,0x3c,0x1f,0x8f,0x60,0x43,0x08,0x12,0xd0,0xba,0x00,
-0x42,0xfe,0xa7,0x65,0x55,0xc3,0x1a,0x04,0x38,0x13,0x03,0x7c,0x00,0x15,0x03,0x99,
-0x05,0x02,0x7c,0x00,0x15,0x8f,0x5a,0x6e,0x05,0x57,0x3b,0x26,0xff,0x40,0x1f,0x00,
-0x05,0x63,0x78,0x02,0x1f,0x00,0x15,0x0d,0x1f,0x00,0x15,0x7f,0x1f,0x00,0x15,0xfa,
-0x32,0x03,0x23,0xd0,0x09,0xfd,0x0b,0x02,0xe4,0x6d,0x13,0xfd,0xed,0x42,0x24,0xa8,
-0xac,0x08,0x0f,0x1a,0xef,0x29,0x3d,0x1a,0x05,0x09,0x7a,0x0b,0x83,0x24,0x15,0x20,
-0xf0,0x2b,0x13,0xf8,0x7b,0x84,0x13,0x06,0x70,0x54,0x04,0x99,0x75,0x22,0x01,0x8e,
-0x5e,0x4b,0x24,0x2f,0xff,0x66,0x8b,0x07,0xb7,0x9e,0x0a,0x35,0x6a,0x0d,0xc8,0x78,
-0x0f,0x1f,0x00,0x9f,0x37,0x46,0x77,0x63,0x1f,0x00,0x14,0x3b,0x3a,0x33,0x02,0x1f,
-0x00,0x15,0x9f,0xd8,0x16,0x14,0x8f,0x31,0x01,0x02,0xe8,0x02,0x1b,0x08,0x1f,0x2d,
-0x1a,0x8f,0xf7,0x25,0x1b,0x08,0x73,0x58,0x1a,0x8f,0x83,0x3e,0x23,0x08,0xff,0x33,
-0x77,0x12,0x4b,0x13,0x0a,0x14,0x8f,0x65,0x28,0x11,0x07,0x6f,0x00,0x02,0xb4,0x85,
-0x06,0x8d,0x26,0x19,0x8f,0xed,0x98,0x26,0xff,0x38,0xd9,0x00,0x0a,0xe0,0x6b,0x02,
-0x3f,0x00,0x16,0xa8,0x1f,0x00,0x01,0x77,0x8e,0x06,0x1f,0x00,0x11,0x03,0x5a,0x69,
-0x06,0x1f,0x00,0x01,0x8a,0x75,0x06,0x1f,0x00,0x11,0x01,0xb1,0x2c,0x06,0x1f,0x00,
-0x10,0x1f,0x07,0x02,0x06,0x1f,0x00,0x11,0x02,0x81,0x5c,0x06,0x1f,0x00,0x10,0x3f,
-0x02,0x04,0x06,0x1f,0x00,0x1b,0x04,0x5d,0x00,0x01,0xc0,0x7a,0x06,0x1f,0x00,0x01,
-0xca,0x00,0x16,0x78,0x1f,0x00,0x01,0xea,0x03,0x06,0xdc,0x12,0x01,0x0a,0x00,0x15,
-0x18,0x70,0x2b,0x02,0x4b,0x1f,0x13,0x8f,0xfb,0x6d,0x12,0x03,0x99,0x75,0x04,0x55,
-0x01,0x04,0x88,0x18,0x1a,0x8f,0x48,0x27,0x1b,0x08,0xab,0x35,0x18,0x8f,0x69,0x3f,
-0x11,0xe1,0x93,0x01,0x26,0xfd,0x1c,0xa2,0x35,0x16,0x8f,0x64,0x47,0x00,0xa6,0x77,
-0x12,0x08,0xa0,0x73,0x16,0xbf,0x35,0x6f,0x04,0x87,0x77,0x08,0x53,0x0f,0x36,0x36,
-0x77,0x65,0x96,0x77,0x21,0x17,0xcf,0xf3,0x00,0x1a,0x10,0x70,0x19,0x1b,0xf8,0xc8,
-0x51,0x2a,0xd2,0x00,0xb5,0xa6,0x1a,0x20,0x24,0x05,0x1a,0xe1,0x3c,0x36,0x1b,0xfb,
-0xd2,0x62,0x23,0x30,0x01,0xcc,0x35,0x26,0x04,0xbf,0x4e,0x30,0x15,0xf5,0xdd,0x28,
-0x06,0xec,0x78,0x01,0x0c,0x76,0x06,0x7f,0x0b,0x01,0x43,0x1b,0x01,0x1f,0x79,0x06,
-0xcf,0x7d,0x06,0xea,0x1e,0x5b,0x09,0xcc,0xcc,0xcc,0xc7,0x3e,0x76,0x1a,0xdf,0x0b,
-0x10,0x1e,0xef,0x0f,0x00,0x1f,0xf1,0x0f,0x00,0x0a,0x1f,0xf2,0x4b,0x00,0x06,0x0b,
-0x69,0x00,0x0a,0x95,0x64,0x07,0xb1,0xa9,0x78,0x0b,0xdd,0xdd,0xdd,0xd8,0x2f,0xff,
-0x08,0x9b,0x16,0xf9,0xe1,0x00,0x10,0x6f,0x37,0x00,0x03,0x45,0xa8,0x03,0xcb,0x02,
-0x23,0xf2,0x01,0xc7,0x88,0x22,0x02,0x8f,0xf3,0x01,0x18,0x7f,0xc8,0x82,0x19,0x50,
-0xe0,0x2b,0x1d,0xfc,0x77,0x01,0x07,0x95,0x01,0x2e,0xfe,0x30,0xb3,0x01,0x0b,0xd1,
-0x01,0x04,0xef,0x01,0x27,0xc7,0x10,0x0d,0x02,0x0d,0xc1,0x82,0x0f,0x0f,0x05,0xae,
-0x00,0x5b,0x01,0x36,0x57,0x76,0x40,0x1f,0x00,0x21,0x02,0x9f,0x70,0x2c,0x04,0x1f,
-0x00,0x13,0x08,0xb7,0x15,0x03,0x1f,0x00,0x04,0x50,0x03,0x03,0x74,0x04,0x1a,0x0c,
-0x74,0x2d,0x1a,0x09,0x47,0x38,0x1b,0x03,0xc1,0x62,0x1a,0xcf,0x1f,0x00,0x11,0x3f,
-0xa7,0x01,0x32,0x51,0x01,0x39,0x1f,0x00,0x05,0x13,0x12,0x16,0x02,0xff,0x63,0x15,
-0xfc,0x88,0x04,0x16,0xf8,0xa0,0x3a,0x01,0x29,0x00,0x16,0x86,0x67,0x0a,0x01,0x9b,
-0x00,0x15,0x9f,0x33,0x05,0x01,0xb2,0x00,0x16,0x8b,0x40,0x0e,0x01,0x1f,0x00,0x03,
-0x0b,0x67,0x04,0x1f,0x00,0x16,0x8d,0x0d,0x0d,0x01,0x1f,0x00,0x06,0xd0,0x02,0x01,
-0x1f,0x00,0x16,0x8e,0xde,0x0a,0x14,0x8f,0x6e,0x8b,0x07,0x1f,0x00,0x1a,0x8c,0xbc,
-0x1b,0x04,0x57,0x07,0x04,0x1f,0x00,0x16,0x89,0x79,0x01,0x14,0x8f,0x0f,0x26,0x16,
-0xfc,0x1f,0x00,0x29,0x82,0xff,0xae,0x9e,0x16,0xf8,0xe6,0x25,0x15,0x2f,0x6a,0x01,
-0x01,0x3f,0x00,0x11,0x2d,0xf8,0x00,0x04,0xae,0x90,0x27,0x03,0x8f,0x17,0x72,0x07,
-0x55,0x01,0x1b,0x2f,0xbb,0x39,0x1b,0x8f,0x07,0x2f,0x18,0xbf,0x80,0x12,0x15,0x80,
-0x10,0x00,0x23,0xfb,0x0e,0xf0,0x01,0x13,0x8f,0x13,0x26,0x13,0xcf,0x76,0x00,0x12,
-0x29,0x7f,0x04,0x15,0x0a,0x2e,0x02,0x06,0x6f,0x6b,0x06,0x23,0x05,0x17,0x52,0xbc,
-0x2f,0x18,0xef,0xd0,0x76,0x1a,0x02,0x07,0x83,0x1a,0x06,0xa3,0x2f,0x1a,0x08,0x26,
-0x34,0x1a,0x08,0x4d,0x26,0x1a,0x05,0xb6,0x08,0x2a,0x01,0xef,0xce,0x03,0x12,0x9f,
-0x0e,0x70,0x02,0x76,0x7e,0x12,0xf3,0x1a,0x07,0x15,0xc1,0x88,0x56,0x03,0x9d,0x40,
-0x04,0x3b,0x10,0x29,0x00,0xcf,0x02,0x4a,0x02,0x42,0x84,0x15,0x10,0xf5,0x06,0x16,
-0x75,0xdb,0x0f,0x01,0x61,0x20,0x01,0xbc,0x06,0x11,0x44,0x01,0x00,0x01,0x17,0x86,
-0x0b,0x77,0x33,0x0b,0x13,0x14,0x1b,0xeb,0xae,0xb1,0x1f,0xbf,0xea,0x13,0x0b,0x1e,
-0xaf,0xf6,0x5a,0x08,0x98,0x03,0x1e,0x6f,0xdb,0x0a,0x08,0x4d,0x05,0x08,0x77,0x36,
-0x14,0x04,0x39,0x0b,0x12,0x60,0xb6,0x0b,0x02,0x1b,0xb1,0x06,0xc8,0x22,0x14,0xfa,
-0xc4,0x1c,0x51,0xd6,0x20,0x00,0x14,0x9e,0x11,0x03,0x18,0x2f,0xe9,0x8d,0x1b,0xf7,
-0xd4,0x27,0x1d,0xe0,0xae,0xaf,0x08,0x10,0x00,0x19,0xf4,0x6a,0x7e,0x03,0x25,0x05,
-0x1b,0x18,0x32,0x30,0x03,0xd9,0x75,0x19,0xb5,0xe7,0x87,0x08,0x78,0x39,0x00,0x04,
-0xa9,0x17,0x41,0x3c,0x76,0x17,0xfd,0x30,0x62,0x17,0xe0,0x50,0xaf,0x07,0x8a,0x47,
-0x26,0xe0,0x00,0xb8,0x00,0x07,0xaf,0x36,0x16,0xd0,0xd3,0x69,0x05,0x7e,0xa6,0x48,
-0xf7,0x20,0x01,0x30,0x5b,0x1b,0x03,0x70,0x29,0x0e,0x63,0x83,0x07,0x5f,0x12,0x07,
-0x40,0x7e,0x1e,0x01,0x17,0x00,0x08,0x9e,0x85,0x27,0xfb,0x01,0x26,0x37,0x0f,0x17,
-0x00,0x1b,0x12,0x1b,0x7f,0x18,0x12,0xfb,0x30,0x50,0x0f,0x73,0x00,0x0d,0x0f,0x17,
-0x00,0xfe,0x07,0x4e,0xab,0x1b,0x30,0xe3,0x6e,0x25,0xfe,0xa2,0x8f,0x8c,0x13,0x4e,
-0x4c,0x04,0x01,0x9d,0xb7,0x06,0x51,0x1c,0x22,0xfa,0x6f,0x10,0x00,0x1a,0x7f,0xed,
-0x33,0x1b,0x04,0xfd,0x33,0x1b,0x0e,0x10,0x00,0x1a,0x8f,0x10,0x00,0x03,0x93,0x3b,
-0x32,0x30,0x01,0x5b,0x10,0x00,0x15,0x06,0xfe,0x3f,0x16,0x5f,0xf5,0x40,0x1b,0xf2,
-0xe1,0x41,0x06,0xec,0x0a,0x26,0xf1,0x4f,0x45,0x06,0x01,0x10,0x00,0x1a,0x7f,0x37,
-0x4f,0x17,0xf1,0xeb,0x15,0x01,0x10,0x00,0x16,0xbf,0x27,0x09,0x01,0x10,0x00,0x06,
-0xb3,0x06,0x02,0x10,0x00,0x1a,0xdf,0x81,0x50,0x0d,0x10,0x00,0x1b,0xcf,0x10,0x00,
-0x1b,0xbf,0x40,0x00,0x02,0x2f,0xb3,0x0a,0x90,0x00,0x17,0xfa,0x10,0x00,0x07,0x4d,
-0x14,0x0c,0xa8,0x64,0x06,0x75,0x89,0x07,0xf0,0x00,0x06,0x7a,0x2c,0x12,0x5f,0x40,
-0x01,0x13,0xff,0x91,0x03,0x1f,0x4a,0x50,0x01,0x03,0x2b,0x00,0x0d,0x10,0x00,0x1e,
-0x03,0x8d,0x35,0x0a,0x10,0x00,0x14,0x06,0x31,0x29,0x04,0x31,0x15,0x13,0x3d,0x70,
-0x92,0x05,0x2f,0x02,0x10,0x6c,0x83,0x00,0x17,0x80,0x3f,0x02,0x4c,0x14,0x67,0x65,
-0x20,0x4c,0x16,0x24,0x00,0x07,0xeb,0x20,0x03,0xb4,0x04,0x04,0x16,0x47,0x17,0x0b,
-0x53,0x1f,0x02,0x34,0x95,0x15,0xd4,0xf8,0x35,0x12,0xfe,0x5b,0x05,0x44,0xd8,0x53,
-0x23,0x59,0x3b,0x05,0x1b,0x1e,0xe7,0x4c,0x0c,0x90,0x53,0x1b,0x1e,0x4b,0x05,0x2b,
-0x01,0xcf,0x23,0x93,0x2b,0x07,0xef,0x0a,0xb4,0x2b,0x07,0xdf,0x3b,0xb4,0x62,0x03,
-0x7a,0xde,0xff,0xed,0xb8,0x8f,0x0c,0x07,0x00,0x02,0x0f,0x0f,0x00,0xac,0x46,0x02,
-0x57,0x76,0x52,0x0f,0x00,0x01,0xf5,0x00,0x14,0xd8,0x0f,0x00,0x03,0x32,0x6b,0x13,
-0xe4,0x0f,0x00,0x15,0x6f,0x1e,0x23,0x01,0x13,0x11,0x06,0x56,0x23,0x1a,0xcf,0x20,
-0x70,0x0b,0x52,0x7d,0x1a,0xcf,0xd2,0x42,0x11,0xcf,0x9b,0x02,0x45,0x62,0x00,0x15,
-0xcf,0x38,0xbb,0x01,0x36,0x17,0x15,0x0b,0x29,0x03,0x16,0xfa,0xf9,0x6a,0x06,0xb4,
-0x00,0x14,0xcf,0xd1,0x34,0x16,0xf4,0x4d,0x84,0x06,0x0f,0x00,0x01,0x4e,0x0d,0x0f,
-0x0f,0x00,0xff,0x29,0x51,0x00,0x3a,0xef,0xea,0x20,0x2c,0x04,0x11,0x40,0x69,0x10,
-0x11,0x16,0xda,0x0e,0x01,0x45,0x03,0x17,0x88,0xaa,0x46,0x13,0xbf,0xba,0x9e,0x00,
-0xf4,0x08,0x2e,0x26,0x76,0x0f,0x83,0x07,0x26,0x06,0x02,0xf8,0x03,0x0f,0x0b,0x00,
-0x9d,0x01,0x9e,0x81,0x24,0xef,0xe9,0x06,0x11,0x27,0xfe,0x30,0xc0,0x14,0x14,0x09,
-0x1c,0x0c,0x04,0xaa,0x20,0x05,0x68,0x24,0x05,0x44,0x8b,0x13,0xdf,0x66,0x06,0x24,
-0x01,0xcf,0x6e,0x06,0x3f,0x36,0x75,0x10,0xa7,0x7c,0x13,0x09,0x40,0x2c,0x1f,0xf0,
-0x11,0x00,0xff,0x12,0x18,0x1f,0x0b,0x74,0x14,0xe0,0x41,0x31,0x48,0x03,0x10,0x04,
-0xbf,0x0f,0x46,0x02,0x82,0x88,0x04,0x15,0x47,0x04,0x44,0x2c,0x05,0x4b,0x3d,0x00,
-0x26,0x3b,0x14,0x0f,0x9d,0x2a,0x05,0xbb,0x3b,0x13,0x36,0x80,0x17,0x0b,0x97,0x0f,
-0x0f,0x10,0x00,0xc7,0x12,0x08,0xd9,0x05,0x05,0x10,0x00,0x12,0x5f,0x57,0x07,0x19,
-0x8f,0xae,0x3d,0x15,0x90,0x10,0x00,0x17,0x2e,0x9c,0x33,0x15,0xf8,0x53,0x48,0x05,
-0x10,0x00,0x14,0x0b,0x30,0x22,0x03,0x10,0x00,0x14,0x9f,0x3a,0x03,0x02,0x10,0x00,
-0x15,0x07,0xfa,0x2f,0x02,0x10,0x00,0x15,0x5f,0xd9,0x29,0x01,0x10,0x00,0x07,0x36,
-0x0d,0x01,0x10,0x00,0x16,0x1e,0x9b,0x1a,0x06,0xf8,0x15,0x15,0xc0,0x10,0x00,0x17,
-0xfe,0x9d,0x22,0x1b,0x8f,0xea,0x29,0x1a,0x8f,0x2c,0x4a,0x06,0x10,0x00,0x1b,0xf6,
-0x10,0x00,0x07,0x70,0x10,0x08,0x31,0x00,0x1b,0x8f,0xcf,0x79,0x1b,0x8f,0x77,0x40,
-0x16,0x8f,0x44,0x0e,0x15,0xc0,0x10,0x00,0x02,0x77,0xbb,0x15,0xf7,0x10,0x00,0x16,
-0x90,0x5f,0x40,0x03,0x16,0x20,0x02,0xc4,0x3c,0x06,0x80,0x01,0x14,0x09,0x31,0x00,
-0x04,0x50,0x01,0x03,0x1a,0x93,0x05,0x70,0x01,0x13,0x5f,0x31,0x00,0x04,0x10,0x00,
-0x03,0x28,0x42,0x05,0x10,0x00,0x13,0x01,0x93,0x00,0x05,0xc0,0x01,0x16,0x6f,0x76,
-0x15,0x06,0xbd,0x8e,0x06,0xd0,0x01,0x04,0x39,0x24,0x06,0x10,0x02,0x02,0xb4,0x13,
-0x06,0x10,0x00,0x25,0x0d,0xff,0x81,0xbc,0x0f,0x05,0x00,0xd8,0x06,0xad,0x64,0x13,
-0x63,0xd5,0x0f,0x02,0xf9,0x8d,0x12,0x08,0x1d,0x00,0x14,0x6c,0x16,0x4c,0x23,0x04,
-0xbf,0xab,0x3f,0x10,0x8f,0x8c,0x04,0x03,0x62,0x8e,0x15,0xf6,0x70,0x37,0x12,0xc1,
-0x31,0x00,0x15,0x16,0xaa,0x1b,0x15,0x3e,0x92,0x3f,0x18,0x8f,0x5b,0x6b,0x25,0xf3,
-0x3f,0x6f,0x02,0x0a,0x30,0x17,0x16,0xcd,0x7b,0x11,0x0d,0x13,0x79,0x03,0x66,0x09,
-0x0a,0x31,0x00,0x07,0xd4,0x3e,0x02,0xa8,0x17,0x53,0x72,0x00,0x15,0xdf,0xff,0x6a,
-0x09,0x02,0x28,0x6f,0x15,0x68,0x25,0x1c,0x14,0xdf,0x51,0x03,0x02,0x5d,0x44,0x04,
-0x9b,0x52,0x07,0xc6,0x26,0x1a,0x09,0x3f,0x18,0x06,0xc5,0x8d,0x1a,0x5f,0xa5,0x18,
-0x05,0x9b,0x13,0x1a,0x02,0xae,0x18,0x15,0x0d,0x22,0x03,0x1a,0x2f,0xb7,0x18,0x19,
-0xdf,0x31,0x00,0x1f,0xf8,0x31,0x00,0x04,0x1f,0xff,0x31,0x00,0xff,0xbf,0x16,0xf0,
-0x5a,0x03,0x14,0x53,0x86,0x18,0x12,0xd0,0x49,0x80,0x22,0xfa,0x20,0x0f,0x00,0x38,
-0xe0,0x04,0xef,0x17,0x15,0x25,0xf0,0x7f,0xc9,0x2f,0x14,0xbf,0x8d,0x4e,0x07,0x7d,
-0x75,0x06,0x61,0x1d,0x1a,0xbf,0x79,0x1a,0x1a,0xbf,0x3f,0x49,0x14,0xbf,0x0e,0x03,
-0x15,0xcf,0x80,0x42,0x25,0xff,0xb1,0xf1,0x2d,0x05,0xf4,0x12,0x02,0x13,0x39,0x18,
-0xbf,0xc1,0xb7,0x02,0xc0,0x2a,0x16,0xf5,0x26,0x19,0x0a,0x0f,0x00,0x1f,0xf7,0x0f,
-0x00,0xff,0x29,0x0e,0xe9,0x54,0x05,0x86,0x3c,0x19,0xb5,0xc2,0xbd,0x07,0xc7,0x90,
-0x1b,0x09,0xc6,0x93,0x1b,0x0c,0xfd,0x4a,0x1b,0x0c,0xe7,0x5c,0x1b,0x09,0x46,0x4b,
-0x1c,0x04,0x6a,0x51,0x13,0xdf,0x77,0x9a,0x13,0x6d,0x52,0x10,0x19,0x5f,0xb4,0x16,
-0x03,0x43,0x62,0x16,0xd1,0x68,0x9b,0x16,0x01,0x2f,0x23,0x15,0x3f,0x81,0xca,0x17,
-0xfe,0xae,0xc3,0x16,0x08,0x00,0x26,0x02,0x22,0x21,0x07,0x35,0x12,0x01,0x9f,0x1d,
-0x06,0x59,0x20,0x03,0x55,0x13,0x07,0xaa,0x1b,0x01,0x63,0x05,0x08,0xf7,0x7f,0x05,
-0xcc,0x9b,0x17,0xf1,0x21,0x00,0x1c,0x1e,0x35,0x15,0x07,0x68,0x12,0x01,0xc1,0x06,
-0x07,0xb1,0xa5,0x02,0x17,0x0b,0x07,0xf2,0x09,0x01,0xfb,0x2f,0x07,0xf7,0x27,0x11,
-0x0c,0xc5,0x03,0x16,0x1f,0xad,0x55,0x02,0xcf,0x0c,0x15,0xcf,0x08,0x16,0x02,0x9c,
-0x3c,0x04,0x9d,0x48,0x05,0x8b,0xa9,0x13,0x0d,0xfc,0x8a,0x02,0x0b,0xaa,0x1b,0xf1,
-0xb7,0x16,0x05,0xc8,0x63,0x0e,0x3c,0xbc,0x06,0xad,0x33,0x08,0x7e,0x11,0x05,0x84,
-0x87,0x0a,0xa8,0x56,0x19,0x5d,0x79,0x75,0x04,0x67,0xac,0x06,0xb9,0x8f,0x02,0x16,
-0xbc,0x09,0x81,0x14,0x01,0xaf,0x07,0x14,0x30,0xcf,0x0a,0x12,0xfe,0xa6,0x07,0x14,
-0xfa,0x33,0x33,0x25,0xf0,0x1a,0x83,0x37,0x01,0xaa,0x01,0x16,0x2c,0x3e,0x02,0x18,
-0x8f,0xed,0xbc,0x1b,0xd1,0x30,0x20,0x1b,0xa0,0x2c,0x13,0x2b,0x40,0x08,0xf7,0x4b,
-0x04,0x19,0x1f,0x02,0x71,0x07,0x25,0xf4,0x08,0x54,0x4d,0x11,0xaf,0x3f,0x00,0x05,
-0x5f,0x07,0x02,0x06,0x01,0x06,0xdb,0x1b,0x02,0xce,0x4e,0x0b,0x73,0x09,0x16,0x68,
-0xa9,0x14,0x14,0x9f,0x9d,0x07,0x16,0xf8,0xaf,0x19,0x1f,0xb8,0xf2,0x1f,0x06,0x0c,
-0x11,0x20,0x0b,0x79,0x07,0x0b,0xa1,0x07,0x02,0xd5,0x0e,0x0f,0x30,0x20,0x07,0x1a,
-0x6f,0xac,0x20,0x14,0x09,0x07,0x5f,0x03,0x1f,0x00,0x14,0xef,0x19,0x9e,0x16,0xf8,
-0xeb,0x28,0x15,0x28,0xe5,0x19,0x15,0x0c,0x7a,0x02,0x01,0x50,0x03,0x16,0x09,0x15,
-0x0b,0x00,0xd9,0x97,0x12,0x4c,0x16,0x12,0x19,0x8f,0xe5,0xa6,0x0b,0x00,0x09,0x1c,
-0xf2,0x2a,0x1b,0x1b,0x08,0x82,0x82,0x01,0x47,0x09,0x15,0xcf,0x0f,0x00,0x15,0x08,
-0x49,0xce,0x06,0x38,0x1b,0x03,0x3f,0x22,0x1e,0x92,0x5e,0x22,0x0f,0x37,0x23,0xa8,
-0x03,0xc5,0x19,0x08,0xa1,0x4b,0x12,0x29,0x83,0x1c,0x04,0x54,0xbb,0x13,0x9f,0xd4,
-0x4f,0x11,0xaf,0x39,0x00,0x04,0x69,0x03,0x22,0xfd,0x1d,0x1f,0x00,0x14,0xcf,0x43,
-0x01,0x06,0xdd,0x9a,0x07,0x66,0x01,0x1a,0x3f,0xaf,0x1c,0x1a,0x0d,0xce,0x1c,0x02,
-0x42,0x05,0x56,0xc5,0x10,0x02,0x7e,0xff,0x6f,0x01,0x14,0xa0,0x6b,0x7f,0x16,0xf8,
-0xfa,0x70,0x24,0x1e,0xff,0x4e,0xa7,0x16,0xf4,0xd4,0x00,0x06,0x3b,0x2b,0x01,0xd4,
-0x00,0x16,0x8a,0x2d,0x05,0x05,0x04,0x1e,0x1b,0xf6,0x04,0x1e,0x1e,0x30,0xe5,0x1d,
-0x08,0x04,0x1e,0x0b,0x23,0x1e,0x1f,0xf1,0x42,0x1e,0x07,0x06,0x7e,0x17,0x06,0x80,
-0x1e,0x16,0x50,0x1f,0x00,0x1a,0x8f,0xc2,0xa3,0x16,0x85,0x23,0x05,0x01,0x1a,0x00,
-0x06,0x76,0x9d,0x02,0x8e,0x01,0x14,0xef,0xd6,0x04,0x25,0x01,0xef,0x1b,0x1f,0x15,
-0xf9,0xd5,0x04,0x03,0x3a,0x1f,0x13,0x40,0x76,0x0b,0x1a,0xf8,0xcf,0xa3,0x03,0x53,
-0x59,0x0e,0xda,0x02,0x05,0x7a,0x1d,0x1b,0x0b,0x23,0x1e,0x04,0x10,0x00,0x1a,0xc9,
-0xf4,0x1f,0x19,0xa0,0x13,0x20,0x27,0xfb,0x30,0x32,0x20,0x3f,0x67,0x76,0x40,0x1a,
-0x26,0xb5,0x41,0x26,0x77,0x52,0x8f,0x3e,0x0a,0x13,0x5d,0x0b,0x05,0x24,0xf1,0x09,
-0x15,0x05,0x25,0xf2,0x9f,0xbb,0x01,0x14,0xff,0x0a,0x00,0x1f,0xff,0x0a,0x00,0x05,
-0x1c,0xf7,0x0a,0x00,0x55,0xfd,0xa8,0x88,0xa5,0x8f,0x48,0x73,0x19,0x8f,0x71,0x10,
-0x1b,0xfc,0x87,0x00,0x0f,0x0a,0x00,0xbf,0x05,0xe1,0xae,0x16,0x41,0xfc,0x4d,0x11,
-0xef,0xbb,0x4c,0x1a,0x20,0xd2,0x4f,0x2a,0xfc,0x20,0x29,0x20,0x1b,0xf7,0xe5,0x87,
-0x1d,0x90,0x8e,0xa6,0x09,0x88,0x19,0x03,0xdc,0xa3,0x22,0xa4,0x11,0x87,0x96,0x15,
-0xa0,0x05,0x2f,0x16,0x0a,0xe9,0x82,0x15,0xb0,0x08,0x30,0x15,0x02,0x86,0x01,0x15,
-0xaf,0xc3,0x3d,0x11,0xa0,0x92,0x9a,0x14,0x77,0xc8,0xd0,0x1b,0xf4,0xe9,0x34,0x1b,
-0x92,0xc0,0x3c,0x2b,0xd9,0x62,0xbb,0x3c,0x03,0xdf,0x8b,0x06,0xaf,0x20,0x1b,0xc5,
-0x18,0x47,0x1b,0xd4,0xd8,0x11,0x18,0x80,0x8e,0x98,0x05,0x30,0x01,0x29,0x49,0xdf,
-0x1c,0xb0,0x4a,0x00,0x01,0x48,0xdf,0xa2,0x3c,0x18,0x02,0x5c,0x3e,0x04,0xf8,0x55,
-0x66,0xf6,0x3e,0xee,0xee,0xee,0xe5,0x43,0xb6,0x15,0x2f,0x07,0x23,0x14,0x4f,0x5c,
-0x22,0x25,0xfe,0x10,0x4e,0x25,0x14,0x09,0x30,0x07,0x16,0x02,0x0e,0x01,0x52,0xfe,
-0x83,0x10,0x13,0x7e,0xdf,0x14,0x1a,0x8f,0x54,0x51,0x1a,0x0c,0x10,0x07,0x08,0xc2,
-0x91,0x05,0x74,0x07,0x07,0x07,0x40,0x1b,0x4c,0x39,0x50,0x29,0x39,0xef,0x01,0xa5,
-0x00,0x72,0x2c,0x28,0x66,0x41,0x3c,0x01,0x0c,0xe7,0x1a,0x0f,0x15,0x00,0x34,0x16,
-0x0b,0x43,0x1c,0x06,0xa9,0x0d,0x1f,0x1b,0x15,0x00,0x16,0x42,0x18,0xbb,0xbb,0xef,
-0xf8,0x89,0x1f,0xb0,0xa8,0x00,0x4b,0x0f,0x15,0x00,0x44,0x19,0xbf,0xc5,0xc3,0x08,
-0x55,0x92,0x36,0x82,0x11,0x21,0x24,0x1f,0x15,0x60,0x2d,0x67,0x16,0xf6,0x76,0x3b,
-0x15,0x60,0x89,0x03,0x16,0xf6,0x0f,0x3f,0x15,0x60,0x83,0x21,0x02,0x03,0x4a,0x16,
-0xcf,0xf3,0xaf,0x01,0xb4,0xa0,0x0f,0x22,0x1b,0xff,0x38,0x0b,0xc3,0x0e,0x06,0xb1,
-0x1f,0x14,0x9f,0x25,0x70,0x15,0xfc,0xf9,0x03,0x24,0xf7,0x7f,0x62,0x08,0x11,0x2d,
-0x17,0x05,0x11,0x3f,0x4b,0x04,0x13,0x20,0x4d,0x27,0x2a,0xf7,0x0f,0x4a,0x3b,0x1a,
-0x09,0x0f,0x00,0x1b,0x02,0xb4,0x5e,0x05,0x6f,0x05,0x02,0x86,0x2f,0x14,0x0a,0xd8,
-0x03,0x16,0x3f,0x03,0x16,0x03,0x67,0xac,0x00,0x0f,0x00,0x20,0x02,0x9e,0xe6,0x03,
-0x34,0x91,0x00,0x1f,0xa0,0x00,0x10,0x35,0x75,0x1f,0x0d,0x17,0x4f,0x01,0x1a,0x0d,
-0x02,0x49,0x3e,0x06,0x0e,0x8e,0x1a,0x0c,0x9b,0x0c,0x16,0xf0,0x64,0x35,0x02,0x83,
-0x8e,0x06,0x2e,0xb3,0x16,0x0d,0x07,0x1e,0x17,0xf5,0x18,0x22,0x05,0x3a,0x47,0x03,
-0x4a,0x47,0x18,0x1f,0x7a,0x46,0x16,0xf5,0x09,0x47,0x04,0x19,0x47,0x13,0x06,0xc3,
-0x02,0x18,0x02,0x25,0x5b,0x16,0xb0,0xe8,0x46,0x27,0x00,0xbf,0x41,0x47,0x05,0x2f,
-0x26,0x04,0x78,0x46,0x03,0x78,0x00,0x17,0xf8,0xb6,0x48,0x16,0x0b,0x1e,0x0c,0x15,
-0xf0,0xba,0x06,0x16,0x10,0x87,0x98,0x02,0x4f,0x46,0x1a,0x01,0x91,0x03,0x26,0x90,
-0x05,0x18,0x01,0x14,0x6f,0xe2,0x2f,0x16,0xfa,0x55,0x0f,0x26,0xf2,0x0e,0x7a,0x06,
-0x14,0x0b,0xfa,0x48,0x07,0x3e,0x56,0x26,0xfa,0x6f,0x05,0x26,0x14,0x01,0x73,0x26,
-0x1a,0x40,0x6d,0x3d,0x1b,0xfe,0x68,0x43,0x1b,0xf9,0x88,0x42,0x1b,0xf4,0xe7,0x42,
-0x1a,0xe0,0x2a,0x45,0x07,0x57,0x36,0x1b,0xff,0xeb,0x49,0x1b,0xbf,0x57,0x3f,0x1b,
-0x5f,0x56,0x3b,0x1b,0x0f,0x38,0x07,0x1b,0x0b,0x98,0x3b,0x07,0xc4,0xcd,0x18,0x0f,
-0x02,0x72,0x15,0xd0,0xd2,0x46,0x02,0x9e,0x13,0x04,0x35,0x0e,0x05,0x6f,0x59,0x02,
-0xd6,0x27,0x15,0x10,0xea,0xb2,0x05,0x54,0xaa,0x18,0x3f,0x37,0x32,0x01,0x61,0xa3,
-0x02,0xf7,0x01,0x04,0x5e,0x02,0x05,0x6a,0x17,0x11,0x9f,0x58,0x00,0x13,0x0b,0x76,
-0x00,0x14,0x06,0xa9,0x00,0x12,0x0c,0x7f,0x01,0x13,0x7f,0x76,0x00,0x14,0xaf,0x38,
-0x00,0x02,0x2d,0x02,0x13,0x03,0x76,0x00,0x14,0x0f,0xad,0x16,0x12,0x3f,0x79,0x07,
-0x18,0x0f,0x88,0x8b,0x03,0xa0,0x22,0x14,0xfd,0xce,0xb0,0x04,0x27,0x03,0x12,0x60,
-0x75,0x00,0x12,0x90,0x63,0x02,0x14,0xfb,0x34,0x4a,0x03,0x75,0xac,0x15,0xf5,0x32,
-0xc8,0x15,0x01,0xb2,0x92,0x04,0xe4,0x00,0x07,0x77,0x7f,0x03,0xf9,0xc5,0x23,0xff,
-0xd0,0x4e,0x01,0x11,0xf5,0x94,0x03,0x10,0x7f,0x8a,0x02,0x14,0x06,0x7c,0x01,0x14,
-0x7f,0xaa,0x63,0x11,0xd0,0x43,0x03,0x13,0xaf,0xd0,0x02,0x11,0x03,0xa0,0x02,0x00,
-0x36,0xc6,0x10,0x0b,0x58,0x00,0x01,0xef,0x6d,0x04,0x48,0x28,0x20,0xf0,0x08,0xd8,
-0x01,0x01,0x7e,0x6b,0x09,0x82,0x11,0x23,0x20,0xdf,0xc7,0xdc,0x24,0xa0,0x3f,0xaa,
-0x01,0x13,0x06,0x6a,0xa5,0x10,0xfa,0x2c,0x01,0x11,0xfe,0x04,0x6d,0x05,0xf4,0x0f,
-0x11,0x96,0x6b,0x00,0x00,0xfe,0xc2,0x15,0xaf,0xe3,0x24,0x00,0xb7,0xdc,0x14,0xaf,
-0xd6,0x23,0x15,0x7d,0xde,0x0c,0x15,0x0a,0x3f,0x08,0x12,0x0e,0x3a,0x88,0x19,0xf9,
-0xa4,0x02,0x15,0x70,0x46,0x23,0x18,0x50,0x96,0x45,0x15,0xf2,0x4c,0x13,0x18,0xf1,
-0x56,0x36,0x15,0xfd,0x28,0x48,0x19,0xfd,0x4f,0x45,0x15,0x90,0x05,0x03,0x18,0x80,
-0xe6,0x3d,0x19,0xf4,0x0a,0x00,0x06,0x74,0x48,0x06,0x14,0x03,0x18,0x10,0x24,0x42,
-0x1d,0xa0,0xc8,0x94,0x15,0x0a,0xf5,0x06,0x1e,0x08,0x21,0x68,0x1d,0x10,0x3e,0x8c,
-0x07,0x30,0x4e,0x18,0xef,0x81,0x24,0x16,0x0e,0x87,0x2f,0x09,0xc7,0x3a,0x15,0xaf,
-0x42,0x0e,0x19,0x4f,0x8b,0x4c,0x15,0xf1,0x07,0x2a,0x12,0xf6,0xa8,0x00,0x17,0x90,
-0xbb,0x4f,0x19,0x7f,0xbe,0x66,0x16,0x30,0x4c,0xab,0x04,0x28,0x2a,0x04,0x5f,0x8c,
-0x05,0x20,0x44,0x17,0x0b,0xe3,0x81,0x17,0xf8,0xe0,0x8c,0x06,0xad,0x78,0x01,0xd6,
-0x8f,0x07,0xa2,0x8d,0x2b,0x01,0xef,0x47,0xa7,0x11,0x06,0xa3,0x23,0x07,0x8b,0x3a,
-0x1b,0x0d,0x50,0xaa,0x06,0x49,0x6f,0x1b,0x10,0x02,0x42,0x1b,0x70,0xa6,0xd1,0x1b,
-0xd0,0x35,0x72,0x1b,0xf4,0x95,0xb7,0x1c,0xfb,0xf7,0x43,0x1b,0x30,0x2c,0x48,0x1c,
-0xf8,0x8e,0x6a,0x1c,0xf2,0x3c,0x44,0x0b,0x79,0xc9,0x06,0xa1,0x01,0x1b,0x2f,0xa3,
-0x5a,0x1b,0x0b,0x7d,0x48,0x06,0x21,0x93,0x17,0xe1,0x07,0x5f,0x07,0x55,0x45,0x02,
-0x7b,0x62,0x06,0x81,0x62,0x16,0x1e,0x7c,0x1d,0x17,0xfc,0xbf,0x01,0x05,0x20,0x5c,
-0x13,0x02,0x5d,0x00,0x05,0x11,0x05,0x04,0x0d,0x18,0x04,0xb1,0xb3,0x05,0x61,0xc3,
-0x12,0x9f,0x3c,0x01,0x05,0x7a,0x6f,0x24,0x01,0xef,0xeb,0xd6,0x08,0x2b,0xac,0x26,
-0xf3,0x01,0x6f,0x0b,0x02,0x2b,0x00,0x07,0x70,0xa1,0x01,0x55,0x15,0x05,0xe2,0x04,
-0x04,0x5f,0x69,0x06,0x97,0x43,0x12,0x06,0x2d,0x01,0x01,0xc3,0x8b,0x07,0xd3,0x5f,
-0x02,0xa5,0x63,0x07,0x4b,0x65,0x05,0xbd,0x8f,0x04,0x13,0x46,0x26,0xaf,0xff,0xa8,
-0x9b,0x05,0x27,0x6e,0x17,0xf0,0xa5,0x3d,0x04,0x98,0x3e,0x05,0xd9,0x3c,0x04,0x8d,
-0x2f,0x04,0xdb,0x2c,0x13,0x03,0x00,0x01,0x14,0x0b,0x5b,0x00,0x17,0x0e,0x9c,0x5f,
-0x17,0xf0,0xfd,0x4e,0x05,0xf9,0xb1,0x03,0x4c,0x03,0x15,0x09,0x94,0x02,0x16,0x0d,
-0xbf,0x53,0x06,0x1a,0xce,0x35,0xf5,0x00,0x3f,0x10,0x01,0x16,0x02,0x31,0x06,0x26,
-0x40,0x00,0x59,0x06,0x16,0xcf,0x8b,0x06,0x05,0x09,0x2e,0x17,0xf9,0x76,0x2a,0x17,
-0x85,0x64,0x02,0x14,0x0b,0xec,0x2d,0x1b,0xe0,0xb2,0x4a,0x05,0x98,0xdb,0x0c,0x84,
-0x74,0x1c,0x0a,0xd6,0x02,0x1c,0x5f,0xd5,0x74,0x0c,0xc5,0x99,0x1c,0x0a,0x78,0x4a,
-0x1c,0x4f,0xf0,0x46,0x1b,0xef,0xb7,0x44,0x1c,0x09,0xa9,0x4a,0x1c,0x3f,0xa5,0x4a,
-0x1b,0xef,0xe8,0x44,0x0b,0xa4,0x3f,0x0e,0x89,0xb1,0x1c,0x05,0x33,0x52,0x02,0x75,
-0x25,0x0a,0x5f,0x25,0x0d,0xaf,0x43,0x0c,0x41,0x00,0x16,0xa0,0xe8,0x0f,0x19,0x49,
-0xcb,0x03,0x1c,0x05,0x0a,0x5e,0x1b,0x5f,0xf3,0x4a,0x1c,0x05,0x05,0x01,0x1b,0x5f,
-0xca,0x03,0x2e,0x05,0xff,0x34,0xc0,0x09,0x31,0x64,0x1a,0x04,0x01,0xa0,0x01,0x6b,
-0x10,0x1e,0x52,0x3b,0x9a,0x03,0x1a,0x09,0x1a,0x03,0x8e,0x37,0x0f,0x1d,0x00,0x26,
-0x29,0xb0,0x3f,0xf6,0x6b,0x13,0x01,0x42,0xc0,0x0a,0xf1,0xc0,0x19,0x09,0x01,0x02,
-0x1a,0x05,0x85,0xab,0x0a,0xe6,0x44,0x0a,0x29,0x46,0x19,0xaf,0xa6,0x12,0x19,0x6f,
-0xc5,0x01,0x0a,0x98,0x46,0x19,0x0d,0x71,0x00,0x0a,0xdd,0x4a,0x19,0x06,0x46,0x05,
-0x0a,0x9d,0x46,0x0b,0xfb,0xc1,0x0a,0x30,0x46,0x02,0x2a,0x4b,0x09,0x41,0x01,0x1e,
-0xd1,0x9f,0x46,0x08,0x22,0x57,0x07,0x5e,0x2b,0x1a,0xfa,0x95,0x77,0x04,0x5d,0xc1,
-0x29,0x21,0xef,0x43,0x58,0x0a,0x0a,0x31,0x1a,0x6b,0x07,0x6b,0x1f,0xbf,0x1d,0x00,
-0x26,0x04,0x7c,0x00,0x14,0x11,0x09,0x00,0x14,0x5b,0x97,0x06,0x14,0x4d,0xb7,0x0a,
-0x19,0x09,0x35,0x0f,0x1a,0xa0,0xa6,0x0a,0x14,0x8f,0x15,0x7f,0x15,0x02,0x11,0x01,
-0x15,0x09,0x45,0x01,0x06,0xca,0x54,0x19,0x5f,0xb4,0x23,0x06,0x90,0x39,0x15,0x60,
-0xcc,0x01,0x06,0x90,0x54,0x1b,0x30,0x0a,0x00,0x1f,0xff,0x0a,0x00,0x22,0x1e,0x20,
-0x0a,0x00,0x02,0xe8,0x03,0x15,0x04,0xbc,0x07,0x06,0x49,0x0c,0x15,0x2f,0x6e,0x9b,
-0x04,0x13,0xb5,0x28,0x4a,0xdf,0x05,0x25,0x07,0x2f,0x24,0x14,0x60,0x0a,0x00,0x16,
-0xe2,0x02,0x4c,0x15,0x10,0x1e,0x00,0x15,0xe2,0x0a,0x00,0x02,0x49,0x1b,0x28,0x4b,
-0xff,0x18,0xd5,0x03,0x0d,0x01,0x19,0x0c,0x35,0x1a,0x16,0xfd,0xde,0x02,0x0c,0x79,
-0xa5,0x0a,0xbe,0x00,0x0f,0x0e,0x01,0x25,0x06,0x4a,0x01,0x15,0xdf,0x0a,0x00,0x15,
-0xcf,0x53,0x04,0x19,0x9f,0xd1,0x91,0x1b,0xb0,0xb3,0xbc,0x1a,0x0c,0x05,0x65,0x15,
-0x20,0xb9,0x01,0x2a,0xe3,0x00,0x69,0x59,0x07,0xab,0xc2,0x15,0x3e,0xd8,0x01,0x25,
-0x01,0xbf,0x5c,0x05,0x26,0x03,0xcf,0xc9,0x03,0x5f,0x85,0x00,0x9f,0xff,0xfe,0x03,
-0x00,0x8c,0x55,0x7d,0xdd,0xdb,0x01,0x10,0xdf,0x03,0x15,0xc6,0x3d,0x04,0x16,0xfd,
-0x6d,0x0b,0x15,0xa1,0xd7,0x01,0x06,0x87,0x1e,0x1a,0xd1,0xe9,0xbc,0x15,0x06,0xa5,
-0x04,0x06,0xd9,0x54,0x15,0x1f,0x08,0x02,0x18,0xbf,0x70,0x7a,0x15,0xfa,0xd2,0x06,
-0x1a,0xd0,0x10,0x02,0x1f,0x1f,0x5e,0xd5,0x03,0x15,0xf1,0x13,0x00,0x1f,0x10,0x13,
-0x00,0x0d,0x06,0x52,0x02,0x19,0x0f,0x13,0x00,0x15,0x20,0x6c,0xc1,0x05,0xca,0x00,
-0x15,0xb0,0xcc,0x01,0x17,0x40,0xc4,0x57,0x04,0xd4,0x04,0x24,0xea,0x60,0x4f,0x06,
-0x19,0xfa,0x85,0x67,0x01,0xdb,0x38,0x19,0xfa,0x24,0x46,0x05,0x49,0xc6,0x19,0x0c,
-0xd6,0x1d,0x10,0xc5,0xa6,0x6d,0x05,0x37,0x00,0x14,0x6f,0x46,0x04,0x19,0x0b,0xb3,
-0x24,0x1a,0x40,0x3c,0x04,0x0f,0xe4,0x00,0x12,0x0f,0x13,0x00,0x0e,0x1a,0xf0,0x56,
-0x01,0x05,0x7b,0xd6,0x15,0x05,0x64,0x06,0x17,0x9f,0x48,0x43,0x06,0x3b,0xda,0x15,
-0xfe,0xd6,0x0b,0x14,0x70,0x60,0x39,0x14,0xd0,0xe4,0x01,0x05,0x3b,0x42,0x05,0xaa,
-0x9f,0x14,0xf5,0xf8,0x04,0x13,0xc2,0x98,0x06,0x23,0xfd,0x50,0xdc,0x05,0x09,0x6f,
-0x8b,0x1b,0x46,0x0d,0x3b,0x25,0x01,0x9e,0xad,0xac,0x00,0xc9,0xd1,0x14,0x60,0x9f,
-0x33,0x14,0xa1,0x99,0x00,0x05,0x82,0x33,0x23,0xfd,0x20,0xbf,0x03,0x15,0xf0,0x93,
-0x0b,0x14,0xe3,0x73,0x43,0x06,0x6c,0x23,0x13,0x40,0xc9,0xda,0x18,0x04,0xab,0x1a,
-0x15,0x6f,0x87,0x75,0x03,0x8f,0xd5,0x11,0x9c,0x24,0x04,0x10,0x0f,0x01,0x02,0x27,
-0x11,0x4b,0x32,0x1f,0x03,0xdf,0xd9,0x16,0x6f,0xd4,0x23,0x12,0x6f,0xcc,0x01,0x16,
-0x04,0xb1,0x21,0x13,0x8f,0xec,0x00,0x15,0x3e,0x27,0x20,0x01,0xa6,0x00,0x05,0x1b,
-0x3c,0x00,0x0a,0x05,0x11,0x7b,0x08,0x16,0x04,0x2d,0x01,0x0a,0x02,0xa4,0x34,0x16,
-0xbd,0xfe,0x89,0x65,0x44,0x27,0x9a,0x96,0x10,0x3c,0x32,0x06,0xfe,0xa4,0x14,0xc1,
-0xd6,0x0c,0x15,0xfc,0x11,0x0d,0x20,0x80,0x04,0xb4,0xad,0x12,0x2a,0x02,0x8e,0x10,
-0x70,0x7a,0x01,0x23,0xf6,0x0e,0xa9,0x8f,0x23,0xfa,0x0f,0x89,0xa5,0x21,0xfb,0x0f,
-0x44,0x00,0x10,0x0c,0x09,0x98,0x11,0xfb,0xcc,0x01,0x41,0xfb,0x0c,0xff,0xff,0xaf,
-0xdc,0x50,0xf8,0x07,0xff,0xff,0xe4,0xf0,0x01,0x10,0xf3,0x66,0x02,0x20,0xdb,0xdf,
-0xc7,0x00,0x14,0x5f,0x63,0x0a,0x06,0xed,0x0e,0x15,0x4e,0x7e,0xa9,0x3c,0x6b,0xef,
-0xeb,0x83,0xe2,0x1f,0xee,0x1e,0x2e,0x03,0x04,0xf0,0x09,0x17,0xdc,0x14,0x00,0x73,
-0xf1,0xef,0x00,0xfa,0xe5,0x00,0xe5,0x9f,0xd3,0x0c,0x0a,0xa4,0x3d,0x0b,0x00,0x07,
-0x15,0x00,0x1f,0xac,0x34,0xab,0x15,0x1f,0xb7,0x1d,0x00,0x09,0x03,0x84,0x00,0xa2,
-0xe8,0x00,0xfa,0x00,0x00,0xdc,0xfb,0xe9,0xf4,0x00,0x44,0x19,0xaa,0xf2,0xfc,0x00,
-0x00,0xfb,0xfd,0xf1,0xf6,0x00,0x04,0x2f,0x00,0x7e,0xf8,0x00,0xf9,0x00,0x00,0xf0,
-0x00,0x01,0x00,0x06,0x88,0x0b,0x03,0x20,0x09,0x19,0xfc,0x1f,0x00,0x15,0xfb,0x6d,
-0x00,0x00,0x1a,0x02,0x7f,0xe7,0x00,0xf9,0x00,0xf9,0xf3,0xf9,0x2f,0xb0,0x0a,0x04,
-0x09,0x00,0x21,0xfa,0xfb,0x33,0x00,0x35,0xfb,0xf8,0xf9,0xbe,0x09,0x65,0x00,0x00,
-0x00,0xc7,0x00,0xc2,0x23,0x00,0xaa,0xf6,0xfa,0x00,0x00,0xfa,0xf8,0x00,0x00,0xf9,
-0xf9,0x7e,0xa6,0x03,0x8c,0x00,0x2f,0x05,0xf8,0x65,0x00,0x06,0x0e,0x82,0x00,0x0b,
-0x6c,0xa5,0x06,0xcf,0x00,0x04,0xe5,0x00,0x10,0xf8,0x37,0x00,0x21,0xf4,0xed,0xce,
-0xb3,0x04,0xab,0x00,0x96,0xed,0x00,0x00,0xc3,0xf9,0xc3,0xe4,0x00,0xad,0x2a,0x00,
-0x25,0xfc,0xdc,0xc4,0x3f,0x00,0x5a,0xb3,0x32,0xcb,0x00,0xc9,0xe6,0x01,0x51,0x00,
-0xf5,0x00,0xfd,0xfc,0x1d,0x01,0x1c,0x04,0x5b,0x01,0x00,0xca,0x00,0x5f,0x00,0xf8,
-0xfa,0x00,0xf6,0x93,0x00,0x0a,0x10,0xf1,0x0e,0x01,0x0a,0x74,0x57,0x04,0x69,0x02,
-0xc0,0xb4,0xaf,0x00,0x00,0xdc,0xf8,0xc0,0xfb,0x05,0x00,0x05,0x04,0xfe,0x00,0xd2,
-0xce,0xe6,0x00,0xe6,0xc2,0xed,0xe9,0x00,0xed,0xe8,0xf2,0xe9,0xee,0x54,0x01,0x66,
-0xc0,0xd1,0x00,0x00,0xea,0xfc,0x23,0x01,0xa3,0xf2,0xf3,0x00,0x00,0xf2,0xf7,0x00,
-0x00,0xf8,0xfd,0x73,0x01,0x73,0x04,0x00,0xd6,0xee,0x00,0x00,0xf3,0x02,0x3b,0x00,
-0x07,0x00,0x62,0xf6,0xf7,0x00,0x00,0xf7,0xfa,0xb8,0x01,0x04,0x15,0x00,0x14,0xd2,
-0x3c,0x01,0x15,0x04,0x18,0x01,0x10,0xfa,0xab,0x01,0x13,0xf7,0x02,0x02,0xf6,0x11,
-0x06,0xf1,0xbc,0xd3,0x00,0x00,0xd4,0xf7,0xe4,0xfb,0x05,0xe4,0x05,0x05,0x04,0x05,
-0x00,0x05,0xed,0xed,0xf9,0xf4,0xed,0xf4,0xef,0xf9,0xf4,0xfa,0x00,0xf9,0xf7,0x06,
-0x5d,0x0c,0x08,0x9c,0x01,0x13,0xfa,0x46,0x00,0x3c,0xf8,0xf8,0x00,0x3c,0x02,0x0f,
-0x7c,0xa8,0x03,0x0f,0x92,0xa8,0x05,0x07,0x80,0x02,0x1f,0xf7,0x23,0x00,0x09,0x6f,
-0xfd,0x00,0xfc,0xfc,0x00,0x00,0x9a,0xae,0x10,0x1f,0xfc,0x1d,0x00,0x0f,0x16,0x05,
-0xb2,0x02,0x06,0x81,0x02,0x19,0xf9,0xd1,0x02,0x1f,0xe8,0xf4,0xae,0x24,0x0a,0x5e,
-0x60,0x1f,0xe6,0x8c,0x00,0x0b,0x22,0xfa,0xfb,0xfa,0x02,0x1b,0xcd,0x1a,0x00,0x30,
-0xf7,0xfa,0x06,0x78,0x04,0x4f,0x0f,0x00,0x05,0x05,0x41,0x00,0x09,0x17,0xf7,0xf9,
-0x0d,0x03,0x01,0x03,0x09,0x60,0x00,0x2c,0xfc,0x04,0x0d,0x01,0x1f,0xdb,0xd2,0x00,
-0x23,0x0e,0xee,0xe7,0x0f,0xf5,0x01,0x13,0x04,0x8a,0x02,0x0e,0x5d,0xaf,0x02,0x6f,
-0xe6,0x31,0x02,0x03,0x00,0x5c,0x03,0x1e,0x05,0x52,0x04,0xf2,0x0b,0x07,0x08,0x09,
-0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,
-0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x0c,0xaa,0xf7,0x0b,0x1b,0x1c,0x00,0x1d,0x1e,
-0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,
-0x25,0x26,0x24,0x27,0x28,0x61,0x00,0x20,0x03,0x02,0x5c,0x00,0x4b,0x06,0x07,0x06,
-0x08,0x5f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,
-0x08,0x00,0xd1,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,
-0x35,0xdd,0x52,0x17,0x17,0x17,0x18,0x17,0xb2,0x73,0xf0,0x03,0x19,0x1a,0x19,0x17,
-0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x00,0x00,
+0x18,0x70,0xba,0x02,0x18,0xe0,0x60,0x02,0x18,0xf4,0x32,0x02,0x18,0xfb,0x82,0x03,
+0x04,0x39,0x03,0x18,0x08,0xd9,0x0b,0x18,0x0e,0xab,0x0b,0x12,0x5f,0xa5,0x09,0x08,
+0x14,0x0a,0x15,0xfb,0x03,0x03,0x14,0x99,0x90,0x02,0x00,0x40,0x00,0x14,0x33,0x42,
+0x00,0x10,0x0e,0xfe,0x02,0x13,0xdf,0x42,0x00,0x10,0x5f,0x4e,0x04,0x13,0x7f,0x42,
+0x00,0x10,0xcf,0xf4,0x03,0x12,0x1f,0x08,0x04,0x11,0x02,0xdb,0x02,0x12,0x0b,0x42,
+0x00,0x11,0x09,0x6c,0x03,0x12,0x05,0x1a,0x03,0x12,0x0f,0x12,0x03,0x02,0x4d,0x04,
+0x12,0x6f,0xa3,0x03,0x11,0x9f,0xd6,0x03,0x12,0xcf,0x49,0x03,0x10,0x3f,0x42,0x00,
+0x13,0x03,0x99,0x04,0x10,0x0d,0x92,0x04,0x13,0x09,0x00,0x01,0x10,0x07,0x42,0x00,
+0x13,0x0f,0x96,0x00,0x10,0x01,0x42,0x00,0x13,0x6f,0xb0,0x00,0x00,0xbc,0x00,0x29,
+0xf6,0x22,0x01,0x00,0x19,0x1f,0xcb,0x07,0x1a,0xf8,0xda,0x07,0x1f,0x8f,0x1d,0x00,
+0x35,0x64,0x1c,0xdd,0xdd,0xdd,0xdd,0x90,0xa9,0x04,0x18,0x40,0xde,0x04,0x14,0x7f,
+0x80,0x04,0x14,0x9f,0x22,0x04,0x14,0xaf,0xaf,0x04,0x13,0xcf,0xd1,0x00,0x23,0x01,
+0xdf,0xcd,0x00,0x23,0x02,0xef,0xc9,0x00,0x50,0x03,0xff,0xff,0xff,0xf5,0x10,0x00,
+0x01,0x00,0x64,0x02,0x46,0x77,0x65,0x30,0x00,0x01,0x00,0x83,0x05,0xae,0xff,0xff,
+0xff,0xff,0xfc,0x60,0x0f,0x00,0x22,0x7e,0xff,0x01,0x00,0x12,0xf7,0x2b,0x00,0x23,
+0xcf,0xff,0x01,0x00,0x84,0xfc,0x10,0x00,0x00,0x00,0x03,0xef,0xff,0x01,0x00,0x56,
+0xfd,0x10,0x00,0x00,0x02,0x0f,0x00,0x76,0xff,0xfb,0x00,0x00,0x00,0xcf,0xff,0x01,
+0x00,0x40,0xf5,0x00,0x00,0x4f,0x08,0x00,0x40,0xfa,0x65,0x58,0xdf,0x08,0x00,0x30,
+0xd0,0x00,0x0b,0x07,0x00,0x50,0xe2,0x00,0x00,0x00,0x9f,0x09,0x00,0x20,0x30,0x00,
+0x06,0x00,0x10,0xf4,0x65,0x00,0x11,0xdf,0x6f,0x00,0x10,0x1f,0x10,0x00,0x00,0x0f,
+0x00,0x10,0x07,0x09,0x00,0x70,0xa0,0x00,0x22,0x22,0x22,0x22,0x20,0x10,0x00,0x13,
+0x4f,0x5e,0x00,0x03,0x01,0x00,0x12,0x03,0x4e,0x00,0x05,0x01,0x00,0x10,0x3f,0x8d,
+0x00,0x01,0x0a,0x00,0x33,0x15,0x8b,0xde,0x7d,0x00,0x00,0x1f,0x00,0x16,0x06,0x8e,
+0x00,0x00,0x1f,0x00,0x16,0x5d,0x9c,0x00,0x00,0x1f,0x00,0x17,0x8f,0x0f,0x00,0x13,
+0xfd,0x93,0x00,0x06,0x1f,0x00,0x01,0xba,0x00,0x51,0xfe,0xa7,0x65,0x55,0x7f,0x1f,
+0x00,0x10,0x0d,0x0f,0x00,0x15,0xf6,0x7c,0x00,0x01,0x06,0x00,0x16,0xf3,0x7c,0x00,
+0x00,0x4c,0x00,0x16,0xf9,0x9b,0x00,0x01,0xe8,0x00,0x16,0x40,0x1f,0x00,0x00,0x88,
+0x00,0x16,0xf2,0x1f,0x00,0x15,0x0d,0x1f,0x00,0x15,0x7f,0x1f,0x00,0x10,0xfa,0x0f,
+0x00,0x11,0x5f,0x1f,0x00,0x10,0x09,0x06,0x00,0x52,0xf8,0x00,0x00,0x02,0x9f,0x9b,
+0x00,0x11,0x5f,0x8b,0x00,0x22,0xa8,0xac,0x9b,0x00,0x38,0xe0,0x00,0xef,0xaa,0x00,
+0x48,0xfe,0x00,0x05,0xff,0x01,0x00,0x39,0xf0,0x00,0x09,0x10,0x00,0x33,0x20,0x00,
+0x0a,0x0a,0x00,0x22,0xf8,0xbf,0x94,0x01,0x12,0x06,0x0f,0x00,0x11,0xe6,0x65,0x01,
+0x50,0x90,0x00,0x00,0x01,0x8e,0x47,0x00,0x34,0x81,0x00,0x2f,0x7e,0x01,0x44,0x02,
+0x56,0x76,0x52,0x5b,0x01,0x12,0x8f,0x8b,0x00,0x04,0x01,0x00,0x10,0x08,0x24,0x00,
+0x3f,0x80,0x00,0x00,0x1f,0x00,0xa7,0x37,0x46,0x77,0x63,0x1f,0x00,0x10,0x3b,0x16,
+0x00,0x15,0xa3,0x1f,0x00,0x02,0x04,0x02,0x14,0xfa,0x1f,0x00,0x15,0xbf,0xe8,0x02,
+0x01,0x1f,0x00,0x07,0xf8,0x02,0x18,0x8f,0x10,0x00,0x1a,0xfb,0x1f,0x00,0x2a,0xff,
+0xf5,0x1f,0x00,0x22,0xff,0xe0,0x1f,0x00,0x51,0xf9,0x31,0x01,0x4b,0xff,0xfa,0x01,
+0x01,0x1f,0x00,0x14,0xd2,0xe8,0x02,0x34,0xfa,0x08,0xff,0x1f,0x02,0x11,0x0a,0xc2,
+0x01,0x05,0x4d,0x02,0x02,0x11,0x03,0x16,0x38,0xd9,0x00,0x10,0xbf,0x27,0x03,0x06,
+0xd9,0x00,0x01,0x3f,0x00,0x16,0xa8,0x1f,0x00,0x10,0x5f,0x8d,0x00,0x06,0x1f,0x00,
+0x01,0x6d,0x02,0x16,0xc8,0x1f,0x00,0x10,0x2f,0xbc,0x00,0x06,0x1f,0x00,0x10,0x01,
+0x1a,0x00,0x16,0xe8,0x1f,0x00,0x10,0x1f,0x07,0x02,0x06,0x1f,0x00,0x10,0x02,0x1a,
+0x00,0x16,0xd8,0x1f,0x00,0x10,0x3f,0x02,0x04,0x06,0x1f,0x00,0x1b,0x04,0x5d,0x00,
+0x10,0x7f,0xca,0x00,0x06,0x1f,0x00,0x01,0xca,0x00,0x16,0x78,0x1f,0x00,0x01,0xea,
+0x03,0x12,0x8f,0x91,0x02,0x13,0x00,0x7c,0x03,0x11,0x18,0x4d,0x01,0x14,0x20,0xf8,
+0x02,0x21,0xb0,0x8f,0xd0,0x02,0x41,0x82,0x00,0x03,0x9f,0x46,0x01,0x04,0x55,0x01,
+0x13,0xef,0xe8,0x02,0x0a,0x55,0x01,0x1a,0x50,0x74,0x01,0x11,0xc0,0x1f,0x00,0x14,
+0xfc,0x0f,0x00,0x11,0xe1,0x93,0x01,0x23,0xfd,0x1c,0x0f,0x00,0x12,0xe2,0x72,0x00,
+0x13,0xc0,0x0b,0x03,0x12,0xb1,0xf0,0x01,0x40,0xfa,0x00,0x04,0xbf,0x32,0x01,0x16,
+0x40,0x26,0x02,0x56,0x14,0x67,0x76,0x30,0x00,0x01,0x00,0x45,0x36,0x77,0x65,0x41,
+0x0d,0x00,0x21,0x17,0xcf,0xf3,0x00,0x17,0x10,0x50,0x02,0x06,0x2d,0x01,0x01,0xe1,
+0x04,0x04,0xd7,0x01,0x28,0x00,0x3e,0x80,0x03,0x09,0x24,0x05,0x59,0xe1,0x00,0x00,
+0x0c,0xff,0x33,0x05,0x18,0x7f,0xc7,0x00,0x32,0x30,0x01,0xff,0x92,0x02,0x21,0x04,
+0xbf,0x13,0x01,0x13,0x07,0x48,0x05,0x02,0x6f,0x00,0x25,0xf0,0x0d,0x51,0x01,0x10,
+0xbf,0x50,0x01,0x01,0xb2,0x03,0x14,0x10,0x9d,0x01,0x25,0xf7,0x6f,0x26,0x05,0x10,
+0x0e,0x42,0x02,0x15,0x9f,0xc3,0x05,0x51,0x09,0xcc,0xcc,0xcc,0xc7,0x32,0x00,0x06,
+0xdb,0x00,0x14,0xdf,0x74,0x02,0x02,0x01,0x00,0x1e,0xef,0x0f,0x00,0x1f,0xf1,0x0f,
+0x00,0x0a,0x1f,0xf2,0x4b,0x00,0x06,0x0b,0x69,0x00,0x13,0x9f,0x39,0x05,0x03,0x01,
+0x00,0x14,0x6f,0xec,0x04,0x65,0x00,0x0b,0xdd,0xdd,0xdd,0xd8,0x75,0x04,0x20,0x00,
+0x0f,0xb4,0x00,0x06,0xe1,0x00,0x10,0x6f,0x37,0x00,0x14,0x07,0x21,0x06,0x11,0x03,
+0x23,0x03,0x02,0x1d,0x01,0x42,0x93,0x00,0x02,0x8f,0xf3,0x01,0x12,0x7f,0x1a,0x02,
+0x03,0x11,0x02,0x02,0xa4,0x05,0x04,0xac,0x06,0x0d,0x77,0x01,0x07,0x95,0x01,0x2e,
+0xfe,0x30,0xb3,0x01,0x0b,0xd1,0x01,0x04,0xef,0x01,0x27,0xc7,0x10,0x0d,0x02,0x16,
+0x76,0x0d,0x02,0x0f,0x0f,0x05,0xb4,0x00,0x5b,0x01,0x36,0x57,0x76,0x40,0x1f,0x00,
+0x01,0x74,0x06,0x24,0xfa,0x20,0x1f,0x00,0x03,0x15,0x01,0x13,0x80,0x1f,0x00,0x04,
+0x50,0x03,0x03,0x74,0x04,0x18,0x0c,0xbb,0x02,0x1b,0xf8,0x79,0x06,0x3a,0x80,0x03,
+0xff,0x1f,0x00,0x1a,0xcf,0x1f,0x00,0x11,0x3f,0xa7,0x01,0x32,0x51,0x01,0x39,0x1f,
+0x00,0x14,0x09,0x7a,0x05,0x02,0x98,0x01,0x13,0x80,0xc5,0x01,0x03,0x88,0x04,0x25,
+0xf8,0x3f,0x33,0x07,0x01,0x29,0x00,0x12,0x86,0x0a,0x07,0x05,0xd9,0x00,0x15,0x9f,
+0x33,0x05,0x01,0xb2,0x00,0x10,0x8b,0x05,0x00,0x16,0x60,0x1f,0x00,0x15,0xcf,0x93,
+0x02,0x01,0x1f,0x00,0x15,0x8d,0x88,0x04,0x02,0x1f,0x00,0x06,0xd0,0x02,0x01,0x1f,
+0x00,0x15,0x8e,0x57,0x03,0x02,0x1f,0x00,0x1a,0xdf,0x1f,0x00,0x12,0x8c,0xbc,0x08,
+0x18,0x00,0x26,0x06,0x16,0xf5,0x1f,0x00,0x16,0x89,0x79,0x01,0x01,0x1f,0x00,0x14,
+0x5f,0xc9,0x00,0x02,0x1f,0x00,0x15,0x82,0x3a,0x08,0x01,0x1a,0x03,0x21,0xf8,0x0e,
+0xe8,0x03,0x04,0x9f,0x05,0x02,0x6a,0x01,0x01,0x3f,0x00,0x11,0x2d,0xf8,0x00,0x11,
+0x02,0x1e,0x01,0x42,0xc4,0x00,0x03,0x8f,0x36,0x01,0x1b,0x0b,0x55,0x01,0x1a,0x2f,
+0x55,0x01,0x0a,0x25,0x05,0x12,0xf8,0x8d,0x03,0x01,0x69,0x04,0x03,0x57,0x00,0x13,
+0xbf,0x0f,0x00,0x13,0x0e,0xf0,0x01,0x12,0x8f,0x9b,0x06,0x23,0x00,0xcf,0x76,0x00,
+0x12,0x29,0x7f,0x04,0x15,0x0a,0x2e,0x02,0x39,0x36,0x77,0x64,0xf4,0x02,0x00,0x23,
+0x05,0x16,0x52,0x0e,0x00,0x11,0x38,0x65,0x03,0x13,0xa4,0x0e,0x00,0x23,0x02,0xaf,
+0x7e,0x03,0x02,0x1f,0x01,0x15,0x06,0x8a,0x00,0x18,0x70,0x62,0x03,0x03,0x6b,0x00,
+0x07,0xc1,0x05,0x00,0xac,0x01,0x1a,0x05,0xb6,0x08,0x2a,0x01,0xef,0xce,0x03,0x01,
+0x14,0x06,0x42,0xe7,0x10,0x01,0x5c,0x40,0x01,0x01,0x1a,0x07,0x14,0xc1,0x69,0x06,
+0x24,0xa0,0x07,0xe5,0x03,0x02,0x05,0x04,0x01,0xcf,0x00,0x15,0xf7,0x70,0x04,0x25,
+0xf3,0x1f,0xd2,0x01,0x01,0x43,0x04,0x12,0x75,0x3f,0x04,0x04,0x76,0x04,0x11,0xfa,
+0xbc,0x06,0x11,0x44,0x01,0x00,0x00,0x1a,0x00,0x39,0xc9,0xff,0xff,0xef,0x07,0x1a,
+0xaf,0x10,0x00,0x1a,0xeb,0x0f,0x00,0x14,0xfe,0x63,0x01,0x08,0x6a,0x01,0x07,0x01,
+0x00,0x0b,0x3e,0x00,0x1b,0xf9,0x98,0x03,0x1e,0x6f,0xdb,0x0a,0x08,0x4d,0x05,0x12,
+0x0e,0x0a,0x0b,0x02,0x73,0x07,0x04,0x39,0x0b,0x12,0x60,0xb6,0x0b,0x13,0xfb,0x2f,
+0x00,0x02,0x4f,0x00,0x10,0x09,0x3e,0x03,0x02,0x1f,0x02,0x51,0xd6,0x20,0x00,0x14,
+0x9e,0x11,0x03,0x13,0x2f,0xa4,0x00,0x04,0xd0,0x0b,0x19,0x5f,0x98,0x08,0x0a,0x7d,
+0x06,0x29,0xf4,0x00,0x10,0x00,0x01,0x30,0x03,0x2a,0x4e,0xff,0x25,0x05,0x14,0x18,
+0xf5,0x00,0x03,0x2c,0x0c,0x21,0x01,0x6c,0x0f,0x00,0x16,0xb5,0xb1,0x00,0x27,0x35,
+0x77,0x1f,0x02,0x00,0xd1,0x00,0x14,0x56,0x36,0x05,0x25,0x05,0xbf,0xa7,0x0b,0x25,
+0x3d,0xff,0xc0,0x03,0x13,0x6f,0xde,0x07,0x04,0x06,0x08,0x02,0x17,0x00,0x04,0xb8,
+0x00,0x04,0xe1,0x01,0x02,0xb2,0x0b,0x17,0x02,0xcd,0x0b,0x11,0x7f,0xd2,0x00,0x33,
+0x20,0x01,0x30,0x22,0x00,0x16,0xf2,0x9b,0x06,0x25,0xf7,0x00,0xdb,0x01,0x03,0xe6,
+0x03,0x12,0x00,0x1a,0x0b,0x06,0x54,0x09,0x16,0x00,0x02,0x09,0x0c,0x17,0x00,0x16,
+0x1f,0xca,0x01,0x16,0x01,0x0e,0x01,0x1f,0xb0,0x17,0x00,0x1b,0x31,0x1b,0xbb,0xbc,
+0x14,0x00,0x3f,0xbb,0xbb,0xb8,0x73,0x00,0x10,0x0f,0x17,0x00,0xfc,0x50,0xff,0x00,
+0x00,0x00,0x00,0x10,0x00,0x01,0x00,0x56,0x14,0x67,0x75,0x30,0x00,0x01,0x00,0xf1,
+0x02,0x6d,0xff,0xff,0xff,0xfe,0xa2,0x00,0x2f,0xff,0xff,0xff,0xf1,0x00,0x00,0x00,
+0x4e,0xff,0x01,0x00,0x22,0x80,0x4f,0x10,0x00,0x22,0x07,0xff,0x01,0x00,0x22,0xfa,
+0x6f,0x10,0x00,0x27,0x7f,0xff,0x01,0x00,0x4a,0xf1,0x00,0x04,0xff,0x10,0x00,0x1b,
+0x0e,0x10,0x00,0x1a,0x8f,0x10,0x00,0x11,0x01,0x07,0x00,0x42,0xf8,0x30,0x01,0x5b,
+0x10,0x00,0x20,0x06,0xff,0x7d,0x00,0x51,0x20,0x00,0x00,0x00,0x5f,0x10,0x00,0x10,
+0x0d,0x06,0x00,0x10,0xf2,0x96,0x00,0x11,0x06,0x10,0x00,0x11,0x1f,0x8b,0x00,0x01,
+0xa7,0x00,0x01,0x10,0x00,0x10,0x4f,0x06,0x00,0x16,0x10,0x10,0x00,0x00,0x8e,0x00,
+0x26,0xfc,0x00,0x10,0x00,0x10,0xaf,0x5e,0x00,0x07,0x10,0x00,0x57,0xbf,0xff,0xff,
+0xff,0xf6,0x10,0x00,0x57,0xcf,0xff,0xff,0xff,0xf4,0x10,0x00,0x5e,0xdf,0xff,0xff,
+0xff,0xf3,0x10,0x00,0x09,0x30,0x00,0x1b,0xf3,0x50,0x00,0x1b,0xf4,0x70,0x00,0x2a,
+0xf7,0x00,0x90,0x00,0x2b,0xfa,0x00,0xb0,0x00,0x07,0x10,0x00,0x10,0x0f,0x06,0x00,
+0x16,0x70,0x10,0x00,0x1b,0x0c,0xf0,0x00,0x01,0x06,0x00,0x25,0xfd,0x10,0x10,0x01,
+0x11,0x00,0x27,0x01,0x4f,0xf7,0x20,0x01,0x4a,0x50,0x01,0x03,0x2b,0x00,0x0d,0x10,
+0x00,0x1b,0x03,0x10,0x00,0x2b,0x00,0x6f,0x10,0x00,0x13,0x06,0x0b,0x00,0x23,0xf6,
+0xff,0xf0,0x01,0x21,0x3d,0xff,0x84,0x01,0x10,0x40,0x06,0x00,0x10,0xf0,0x8a,0x00,
+0x10,0x6c,0x83,0x00,0x24,0x80,0x01,0x10,0x00,0x00,0x30,0x02,0x22,0x65,0x20,0x59,
+0x00,0x16,0xf0,0x36,0x02,0x01,0x18,0x02,0x52,0xc0,0x00,0x00,0x01,0x60,0x10,0x00,
+0x01,0x89,0x00,0x52,0x90,0x00,0x00,0x0b,0xf9,0x10,0x00,0x10,0x9f,0x10,0x00,0x10,
+0x40,0x30,0x02,0x10,0xd4,0x0f,0x00,0x11,0x1a,0x65,0x00,0x11,0x00,0x47,0x00,0x62,
+0xd8,0x53,0x23,0x59,0xff,0xff,0x3a,0x01,0x18,0x1e,0x9f,0x00,0x13,0xd0,0x37,0x00,
+0x04,0x01,0x00,0x1a,0x30,0x20,0x00,0x00,0x79,0x01,0x25,0x01,0xcf,0x0f,0x00,0x21,
+0xfe,0x40,0x88,0x00,0x14,0xef,0x10,0x00,0x13,0xa1,0x99,0x00,0x12,0xdf,0x0f,0x00,
+0x14,0xa3,0xaa,0x00,0x71,0x03,0x7a,0xde,0xff,0xed,0xb8,0x40,0x0c,0x00,0x07,0x00,
+0x02,0x0f,0x0f,0x00,0xac,0x46,0x02,0x57,0x76,0x52,0x0f,0x00,0x01,0xf5,0x00,0x14,
+0xd8,0x0f,0x00,0x12,0x04,0x14,0x01,0x13,0xe4,0x0f,0x00,0x04,0x03,0x02,0x11,0x50,
+0x0f,0x00,0x14,0xfa,0x30,0x01,0x38,0xf2,0x00,0xcf,0x6d,0x01,0x1a,0xfc,0x0f,0x00,
+0x2a,0xff,0x30,0x0f,0x00,0x21,0x90,0xcf,0x9b,0x02,0x31,0x62,0x00,0x15,0x09,0x00,
+0x23,0xe0,0xcf,0xf0,0x01,0x25,0x00,0x0b,0x29,0x03,0x01,0xf9,0x02,0x11,0x02,0xaa,
+0x01,0x06,0xb4,0x00,0x00,0x0a,0x00,0x16,0xf5,0x0f,0x00,0x10,0xaf,0x7b,0x02,0x06,
+0x0f,0x00,0x10,0x9f,0x06,0x02,0x0f,0x0f,0x00,0xff,0x29,0x51,0x00,0x3a,0xef,0xea,
+0x20,0x2c,0x04,0x20,0x40,0x1f,0x13,0x03,0x20,0x16,0xff,0x6f,0x01,0x01,0x45,0x03,
+0x11,0x88,0x62,0x03,0x11,0x4f,0xcb,0x01,0x00,0xb7,0x04,0x30,0xa0,0x00,0xaf,0x05,
+0x00,0x5f,0x00,0x26,0x76,0x20,0x00,0x01,0x00,0x03,0x01,0x6d,0x05,0x02,0xf8,0x03,
+0x0f,0x0b,0x00,0x9d,0x00,0xbf,0x00,0x30,0x4b,0xef,0xe9,0xda,0x00,0x00,0x23,0x05,
+0x10,0xfe,0xe0,0x06,0x10,0x3f,0xb0,0x02,0x53,0x00,0x00,0x00,0x09,0xff,0xc5,0x05,
+0x12,0xbf,0x05,0x03,0x24,0x00,0x0a,0x4d,0x04,0x14,0x6f,0x4e,0x06,0x13,0xdf,0x66,
+0x06,0x24,0x01,0xcf,0x6e,0x06,0x4f,0x36,0x75,0x10,0x00,0x01,0x00,0x12,0x14,0x0f,
+0xe2,0x05,0x04,0x88,0x00,0x0f,0x11,0x00,0xff,0x0f,0x13,0x1f,0x11,0x00,0x11,0x04,
+0x48,0x04,0x03,0x23,0x04,0x51,0xfc,0x03,0x10,0x04,0xbf,0x53,0x04,0x03,0x70,0x04,
+0x23,0xf5,0x0f,0xe6,0x05,0x13,0x00,0x11,0x00,0x13,0x60,0x11,0x00,0x13,0xb0,0x11,
+0x00,0x12,0xd1,0x5a,0x00,0x00,0xd3,0x02,0x01,0xa0,0x08,0x10,0x30,0xb6,0x01,0x33,
+0x77,0x65,0x30,0x03,0x02,0x04,0x07,0x08,0x1f,0x00,0x10,0x00,0xca,0x12,0x08,0xd9,
+0x05,0x05,0x10,0x00,0x12,0x5f,0x57,0x07,0x04,0x10,0x00,0x12,0x03,0xbb,0x05,0x05,
+0x10,0x00,0x10,0x2e,0x0f,0x00,0x15,0xfb,0x40,0x00,0x23,0x01,0xdf,0x76,0x07,0x03,
+0x10,0x00,0x11,0x0b,0x71,0x01,0x15,0x10,0x10,0x00,0x14,0x9f,0x3a,0x03,0x02,0x10,
+0x00,0x02,0x0b,0x0a,0x15,0x40,0x10,0x00,0x11,0x5f,0x48,0x08,0x05,0x90,0x00,0x12,
+0x03,0x38,0x0a,0x05,0x10,0x00,0x13,0x1e,0x6d,0x00,0x04,0x10,0x00,0x13,0xbf,0x32,
+0x08,0x03,0x10,0x00,0x14,0xfe,0x6d,0x00,0x03,0x10,0x00,0x03,0x94,0x06,0x0a,0x10,
+0x00,0x1b,0xc0,0x10,0x00,0x1b,0xf6,0x10,0x00,0x2b,0xff,0x20,0x10,0x00,0x06,0x60,
+0x00,0x08,0x31,0x00,0x07,0x36,0x09,0x16,0x20,0x10,0x00,0x15,0xaf,0x31,0x00,0x01,
+0x10,0x00,0x34,0xf9,0x08,0xff,0xce,0x09,0x12,0x8f,0x37,0x01,0x14,0xdf,0x31,0x00,
+0x12,0x8f,0xde,0x06,0x14,0x3f,0x31,0x00,0x03,0x20,0x01,0x14,0x09,0x31,0x00,0x04,
+0x50,0x01,0x13,0xef,0x31,0x00,0x04,0x70,0x01,0x13,0x5f,0x31,0x00,0x04,0x10,0x00,
+0x13,0x0b,0x31,0x00,0x04,0x10,0x00,0x13,0x01,0x93,0x00,0x05,0xc0,0x01,0x12,0x6f,
+0x31,0x00,0x05,0x10,0x00,0x1a,0x0c,0xd0,0x01,0x22,0x00,0x02,0x31,0x00,0x06,0x10,
+0x02,0x11,0x8f,0x31,0x00,0x06,0x10,0x00,0x11,0x0d,0x31,0x00,0x01,0x63,0x03,0x0f,
+0x05,0x00,0xd3,0x50,0x1f,0xff,0xff,0xff,0xff,0x12,0x00,0x01,0x00,0x42,0x01,0x46,
+0x77,0x63,0x0a,0x00,0xf0,0x00,0x04,0x67,0x76,0x41,0x00,0x00,0x00,0x08,0xff,0xff,
+0xff,0xff,0x00,0x00,0x6c,0x07,0x00,0x10,0xa2,0x17,0x00,0xf0,0x01,0xbf,0xff,0xff,
+0xff,0xfc,0x50,0x00,0x00,0x8f,0xff,0xff,0xff,0xf0,0x03,0xdf,0xff,0x01,0x00,0x51,
+0xf6,0x00,0x00,0x2c,0xff,0x01,0x00,0x12,0xc1,0x31,0x00,0x22,0x16,0xff,0x01,0x00,
+0x33,0xf7,0x00,0x3e,0x0a,0x00,0x11,0xd1,0x31,0x00,0x23,0xf9,0xff,0x01,0x00,0x24,
+0xf3,0x3f,0x0a,0x00,0x38,0xc0,0x08,0xff,0x01,0x00,0x15,0xcd,0x0a,0x00,0x3f,0x60,
+0x8f,0xff,0x01,0x00,0x02,0x1a,0xfc,0x31,0x00,0x06,0x01,0x00,0x11,0xf2,0x31,0x00,
+0x42,0xfe,0x72,0x00,0x15,0x96,0x00,0x50,0xfd,0x62,0x00,0x27,0xef,0x09,0x00,0x11,
+0x68,0x37,0x00,0x41,0x10,0x00,0x00,0x00,0x19,0x00,0x60,0xfb,0x00,0x00,0x00,0x02,
+0xff,0x8e,0x00,0x10,0x8f,0x30,0x00,0x00,0x18,0x00,0x11,0x05,0x30,0x00,0x00,0xf7,
+0x00,0x10,0x09,0x0a,0x00,0x10,0xc8,0x05,0x00,0x10,0x80,0x0f,0x00,0x10,0x0f,0x0a,
+0x00,0x10,0x50,0x0a,0x00,0x10,0x5f,0x22,0x00,0x00,0x31,0x00,0x11,0xf8,0x1f,0x01,
+0x10,0xef,0x71,0x00,0x14,0x00,0x4a,0x00,0x15,0xe8,0x31,0x00,0x10,0x0d,0x0a,0x00,
+0x10,0x20,0x0a,0x00,0x10,0x2f,0x5d,0x00,0x06,0x31,0x00,0x19,0xdf,0x31,0x00,0x1f,
+0xf8,0x31,0x00,0x04,0x1f,0xff,0x31,0x00,0xff,0xbf,0x16,0xf0,0x5a,0x03,0x10,0x53,
+0x08,0x00,0x00,0x40,0x03,0x30,0xd0,0x00,0x06,0x25,0x00,0x22,0xfa,0x20,0x0f,0x00,
+0x41,0xe0,0x04,0xef,0xff,0x5c,0x00,0x02,0x0f,0x00,0x23,0xf0,0x7f,0xd1,0x02,0x11,
+0x90,0x0f,0x00,0x14,0xf7,0xe0,0x02,0x38,0xf5,0x00,0xbf,0xef,0x02,0x1a,0xfe,0x0f,
+0x00,0x2a,0xff,0x50,0x0f,0x00,0x24,0xb0,0xbf,0x0e,0x03,0x11,0xcf,0x87,0x00,0x01,
+0x0f,0x00,0x51,0xb1,0x00,0x00,0x00,0x0a,0x2c,0x03,0x14,0xbf,0xf1,0x02,0x10,0x01,
+0x0f,0x00,0x21,0xf4,0xbf,0x60,0x00,0x00,0x01,0x00,0x10,0xcf,0x0a,0x00,0x06,0x0f,
+0x00,0x10,0x9f,0xdf,0x03,0x0a,0x0f,0x00,0x1f,0xf7,0x0f,0x00,0xff,0x29,0x02,0x0c,
+0x02,0x56,0x25,0x67,0x76,0x53,0x00,0x01,0x00,0x11,0x49,0xff,0x01,0x14,0xb5,0x0f,
+0x00,0x23,0x04,0xcf,0xe1,0x01,0x12,0x50,0x10,0x00,0x15,0x09,0xd4,0x01,0x11,0xb1,
+0x10,0x00,0x16,0x0c,0xe5,0x01,0x1b,0xd1,0x10,0x00,0x29,0xff,0xd0,0x30,0x00,0x00,
+0x07,0x02,0x39,0x00,0x00,0x04,0x18,0x02,0x13,0x60,0x06,0x05,0x42,0xe6,0x10,0x01,
+0x6d,0x47,0x02,0x22,0x00,0x5f,0xba,0x05,0x03,0x1b,0x02,0x3a,0xf7,0x00,0x0b,0x5b,
+0x00,0x35,0xd0,0x01,0xff,0xc5,0x00,0x11,0x3f,0xf5,0x02,0x12,0x5f,0x38,0x00,0x04,
+0x2f,0x02,0x22,0xf7,0x08,0xae,0x02,0x00,0x01,0x00,0x10,0x07,0x0b,0x00,0x22,0xa0,
+0xbf,0x15,0x06,0x04,0x32,0x00,0x11,0xfc,0x2c,0x03,0x25,0x40,0x00,0x70,0x02,0x15,
+0xf0,0x3f,0x05,0x03,0x63,0x05,0x15,0x0e,0x4d,0x03,0x20,0x00,0x00,0x0b,0x00,0x20,
+0xf1,0xef,0x05,0x00,0x07,0x21,0x00,0x1b,0x1e,0x21,0x00,0x20,0xf0,0xdf,0x46,0x06,
+0x02,0x10,0x00,0x10,0x1f,0x11,0x00,0x15,0x0b,0xaa,0x05,0x02,0xf1,0x00,0x16,0xe0,
+0x91,0x03,0x20,0x00,0x7f,0xf6,0x05,0x14,0x05,0x20,0x01,0x03,0xd7,0x00,0x25,0x80,
+0x1f,0x95,0x00,0x11,0x02,0x04,0x03,0x24,0x00,0xcf,0x14,0x03,0x01,0x5a,0x03,0x12,
+0xfe,0x16,0x06,0x14,0xfb,0xbc,0x01,0x22,0xff,0x80,0xf3,0x03,0x62,0xfe,0x61,0x00,
+0x05,0xdf,0xff,0x9f,0x00,0x18,0x5f,0x5a,0x01,0x00,0xdd,0x01,0x18,0xaf,0xa9,0x06,
+0x04,0x20,0x01,0x04,0xb1,0x03,0x10,0x10,0xff,0x00,0x16,0xcf,0x10,0x00,0x02,0xcf,
+0x00,0x15,0xaf,0x30,0x00,0x12,0x10,0xae,0x00,0x13,0x5d,0x10,0x00,0x15,0xe6,0x11,
+0x02,0x11,0xaf,0x89,0x00,0x16,0x60,0x32,0x02,0x57,0x02,0x56,0x77,0x75,0x30,0x42,
+0x02,0x01,0xaf,0x07,0x23,0x30,0x00,0xb0,0x07,0x12,0xfe,0xa6,0x07,0x33,0xfa,0x30,
+0x00,0xa7,0x07,0x12,0x1a,0x51,0x00,0x13,0xa0,0xcf,0x07,0x16,0x2c,0x3e,0x02,0x01,
+0x02,0x07,0x06,0x4e,0x02,0x0a,0x5b,0x07,0x2a,0xa0,0x00,0x83,0x07,0x1a,0x40,0x1f,
+0x00,0x22,0xfd,0x00,0x71,0x07,0x13,0x82,0x71,0x07,0x21,0xf4,0x08,0xa7,0x00,0x14,
+0x10,0xd4,0x00,0x15,0xa0,0x5f,0x07,0x02,0x06,0x01,0x15,0x08,0x3b,0x05,0x11,0x04,
+0x03,0x08,0x06,0xa1,0x01,0x15,0x0d,0xa6,0x07,0x15,0x80,0x2b,0x03,0x16,0xf9,0x1f,
+0x00,0x10,0x06,0x1a,0x00,0x16,0xb8,0x1f,0x00,0x01,0x53,0x02,0x06,0x1f,0x00,0x01,
+0xbe,0x01,0x16,0xd8,0x1f,0x00,0x0b,0x79,0x07,0x0b,0xa1,0x07,0x2a,0x00,0x3f,0xc9,
+0x07,0x1a,0x04,0xf1,0x07,0x20,0x00,0x6f,0xc4,0x00,0x06,0x1f,0x00,0x01,0x4d,0x03,
+0x16,0x98,0x1f,0x00,0x10,0xef,0xda,0x02,0x06,0x1f,0x00,0x10,0x4f,0x1a,0x00,0x10,
+0x28,0x05,0x00,0x15,0xe1,0x59,0x02,0x24,0xe0,0x8f,0x50,0x03,0x11,0x09,0x66,0x08,
+0x02,0x36,0x01,0x41,0xe7,0x20,0x00,0x4c,0x09,0x00,0x23,0x30,0x8f,0xff,0x01,0x0f,
+0x00,0x09,0x02,0x1a,0xf2,0x74,0x01,0x1a,0xf8,0x93,0x01,0x22,0xfc,0x00,0x47,0x09,
+0x15,0xcf,0x0f,0x00,0x02,0x55,0x01,0x14,0xaf,0x40,0x06,0x12,0x00,0x9b,0x00,0x10,
+0x3b,0x0f,0x00,0x13,0x92,0xbf,0x09,0x00,0xba,0x00,0x04,0xd7,0x09,0x07,0x15,0x03,
+0x04,0x2e,0x02,0x03,0xd9,0x00,0x0f,0x1f,0x00,0x8d,0x01,0x01,0x00,0x46,0x35,0x77,
+0x64,0x10,0x0e,0x00,0x10,0x29,0x23,0x00,0x11,0xc4,0x73,0x04,0x13,0xf8,0xa5,0x03,
+0x00,0x80,0x02,0x11,0xaf,0x39,0x00,0x04,0x69,0x03,0x22,0xfd,0x1d,0x1f,0x00,0x14,
+0xcf,0x43,0x01,0x02,0x58,0x00,0x1a,0x9f,0x66,0x01,0x19,0x3f,0x85,0x01,0x39,0x80,
+0x0d,0xff,0x1f,0x00,0x02,0x42,0x05,0x55,0xc5,0x10,0x02,0x7e,0xff,0x6f,0x01,0x00,
+0x4e,0x03,0x21,0x00,0x1b,0x1f,0x00,0x11,0x0f,0xc8,0x01,0x00,0x92,0x00,0x01,0xa6,
+0x04,0x12,0x83,0x4e,0x04,0x05,0xd4,0x00,0x15,0x6f,0x57,0x04,0x01,0xd4,0x00,0x16,
+0x8a,0x2d,0x05,0x01,0x1f,0x00,0x15,0xcf,0x2c,0x05,0x01,0x1f,0x00,0x11,0x8d,0x24,
+0x02,0x06,0x1f,0x00,0x05,0x4e,0x08,0x02,0x1f,0x00,0x16,0x8e,0x08,0x05,0x01,0x1f,
+0x00,0x06,0x28,0x05,0x06,0x3e,0x00,0x1a,0x20,0x5d,0x00,0x16,0xf3,0x1f,0x00,0x16,
+0x8b,0x25,0x05,0x01,0x1f,0x00,0x06,0x74,0x01,0x01,0x1f,0x00,0x16,0x85,0x23,0x05,
+0x01,0x1a,0x00,0x15,0x2f,0x8c,0x00,0x02,0x8e,0x01,0x14,0xef,0xd6,0x04,0x20,0x01,
+0xef,0x1f,0x00,0x02,0xdf,0x02,0x05,0xd5,0x04,0x21,0x80,0x3f,0x60,0x01,0x13,0x40,
+0x76,0x0b,0x13,0xf8,0x73,0x01,0x14,0xfe,0x55,0x01,0x2f,0x02,0xff,0xda,0x02,0x07,
+0x00,0x93,0x01,0x1a,0x0b,0x1f,0x00,0x05,0x10,0x00,0x13,0xc9,0x0a,0x02,0x13,0x08,
+0x96,0x04,0x04,0xb5,0x00,0x20,0x02,0x9f,0xef,0x01,0x16,0x30,0x29,0x02,0x4f,0x03,
+0x67,0x76,0x40,0xe3,0x02,0xa9,0x08,0x1f,0x00,0x41,0x26,0x77,0x52,0x8f,0x3e,0x0a,
+0x13,0x5d,0x0b,0x05,0x24,0xf1,0x09,0x15,0x05,0x25,0xf2,0x9f,0xbb,0x01,0x14,0xff,
+0x0a,0x00,0x1f,0xff,0x0a,0x00,0x05,0x1c,0xf7,0x0a,0x00,0x51,0xfd,0xa8,0x88,0xa5,
+0x8f,0x29,0x03,0x13,0x20,0x73,0x00,0x24,0xff,0x80,0x7d,0x00,0x1b,0xfc,0x87,0x00,
+0x0f,0x0a,0x00,0xba,0x50,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x01,0x00,0x64,0x01,
+0x46,0x77,0x65,0x41,0x00,0x01,0x00,0x82,0x39,0xef,0xff,0xff,0xff,0xff,0xd9,0x20,
+0x0e,0x00,0x22,0x2c,0xff,0x01,0x00,0x11,0xfc,0x10,0x00,0x24,0x06,0xff,0x01,0x00,
+0x10,0xf7,0x0f,0x00,0x25,0x7f,0xff,0x01,0x00,0x68,0x90,0x00,0x00,0x05,0xff,0xff,
+0x1f,0x00,0x27,0x1e,0xff,0x01,0x00,0x12,0x20,0x2c,0x00,0x40,0xa4,0x11,0x25,0xcf,
+0x08,0x00,0xb0,0xa0,0x00,0xdf,0xff,0xff,0xff,0xf5,0x00,0x00,0x00,0x0a,0x0f,0x00,
+0x20,0xf0,0x00,0x06,0x00,0x10,0xb0,0x53,0x00,0x00,0x7d,0x00,0x20,0xf4,0x02,0x0f,
+0x00,0x10,0x80,0x0f,0x00,0x10,0xaf,0x27,0x00,0x11,0x02,0x33,0x00,0x00,0x0f,0x00,
+0x51,0x47,0x77,0x77,0x77,0x73,0x2d,0x00,0x25,0xf4,0x00,0x01,0x00,0x01,0x52,0x00,
+0x15,0x92,0x0f,0x00,0x21,0x6f,0xff,0xc0,0x00,0x13,0x62,0x0f,0x00,0x13,0x0c,0x82,
+0x00,0x22,0xfb,0x62,0xec,0x00,0x14,0xef,0x93,0x00,0x19,0xc5,0xe0,0x00,0x31,0xff,
+0xff,0xd4,0x10,0x00,0x15,0x8f,0x10,0x00,0x11,0x80,0x2f,0x00,0x14,0x8e,0x0f,0x00,
+0x12,0xf8,0x4f,0x00,0x23,0x49,0xdf,0x10,0x00,0x22,0x40,0x00,0x50,0x00,0x12,0x48,
+0x11,0x00,0x14,0xc0,0x7f,0x00,0x11,0x02,0x42,0x00,0x25,0xf2,0x00,0x10,0x00,0x00,
+0x71,0x00,0x65,0xf6,0x3e,0xee,0xee,0xee,0xe5,0x9f,0x00,0x61,0xf8,0x2f,0xff,0xff,
+0xff,0xf9,0x0f,0x00,0x10,0x4f,0x0f,0x00,0x64,0x0e,0xff,0xff,0xff,0xfe,0x10,0x1e,
+0x00,0x20,0xf6,0x09,0x42,0x00,0x14,0xc1,0x3c,0x00,0x02,0x0e,0x01,0x50,0xfe,0x83,
+0x10,0x13,0x7e,0x09,0x00,0x38,0xe0,0x00,0x8f,0x59,0x01,0x15,0x70,0xe1,0x00,0x01,
+0xa6,0x01,0x46,0x00,0x00,0x01,0xcf,0x0f,0x00,0x00,0x44,0x00,0x15,0x09,0x0e,0x00,
+0x11,0xfa,0x71,0x00,0x13,0x4c,0x0e,0x00,0x28,0xfd,0x40,0xef,0x01,0x25,0xe9,0x40,
+0xb0,0x00,0x48,0x46,0x77,0x66,0x41,0x3c,0x01,0x15,0x40,0x65,0x01,0x1f,0xf4,0x15,
+0x00,0x39,0x15,0x0b,0x98,0x00,0x25,0xf1,0xbf,0x0b,0x00,0x1f,0x1b,0x15,0x00,0x16,
+0x40,0x18,0xbb,0xbb,0xef,0xf1,0x00,0x3f,0xbb,0xbb,0xb0,0xa8,0x00,0x4b,0x0f,0x15,
+0x00,0x44,0x13,0xbf,0x00,0x03,0x03,0x09,0x01,0x11,0xa0,0x0b,0x00,0x10,0x9f,0x0b,
+0x00,0x63,0x82,0x11,0x21,0x00,0x00,0x07,0xe7,0x00,0x42,0x60,0x00,0x00,0x3f,0x0a,
+0x00,0x13,0xf6,0x1d,0x03,0x02,0x15,0x00,0x16,0x06,0x15,0x00,0x15,0x0b,0x15,0x00,
+0x25,0x00,0x0a,0x15,0x00,0x30,0x00,0x05,0xcf,0x35,0x02,0x02,0x6c,0x00,0x47,0x14,
+0x67,0x76,0x41,0x86,0x00,0x10,0x9f,0xa0,0x03,0x0f,0x0f,0x00,0xff,0x29,0x06,0xbb,
+0x01,0x01,0x0f,0x00,0x14,0xaf,0x0e,0x05,0x02,0x0f,0x00,0x12,0x9f,0x87,0x03,0x03,
+0xbd,0x03,0x11,0xf7,0xf7,0x04,0x51,0x50,0x00,0x00,0x00,0x2d,0x17,0x05,0x11,0x3f,
+0x4b,0x04,0x32,0x20,0x01,0x39,0x26,0x05,0x38,0x0f,0xff,0xff,0x35,0x05,0x1a,0x09,
+0x0f,0x00,0x1a,0x02,0x0f,0x00,0x06,0x6f,0x05,0x11,0xdf,0x0f,0x00,0x14,0x0a,0xd8,
+0x03,0x12,0x3f,0x82,0x00,0x13,0x8f,0x12,0x04,0x12,0x2f,0x0f,0x00,0x20,0x02,0x9e,
+0xe6,0x03,0x34,0x91,0x00,0x1f,0xa0,0x00,0x48,0x35,0x67,0x65,0x20,0x24,0x05,0x15,
+0x00,0x89,0x02,0x20,0xfa,0x1f,0x10,0x00,0x11,0x30,0x10,0x00,0x10,0xff,0xde,0x00,
+0x15,0x0c,0x01,0x05,0x11,0x04,0xa0,0x05,0x15,0x06,0xe3,0x04,0x11,0x08,0xae,0x02,
+0x11,0x01,0x8e,0x03,0x00,0x10,0x00,0x12,0x0d,0xe0,0x00,0x14,0xcf,0x14,0x01,0x12,
+0x1f,0x5a,0x00,0x14,0x6f,0xe1,0x04,0x12,0x5f,0x79,0x04,0x10,0x1f,0x8e,0x02,0x05,
+0xd1,0x05,0x03,0xb5,0x02,0x13,0x20,0xd3,0x02,0x12,0xf0,0xd0,0x02,0x00,0xc3,0x02,
+0x04,0xeb,0x05,0x13,0x01,0x11,0x06,0x14,0x07,0x3f,0x01,0x12,0xbf,0x28,0x00,0x01,
+0x38,0x00,0x04,0xc2,0x00,0x44,0xf3,0x00,0x00,0x0f,0xd8,0x04,0x12,0x1f,0xa3,0x05,
+0x14,0x4f,0x88,0x00,0x12,0x0b,0x87,0x01,0x12,0x8f,0x37,0x00,0x03,0x61,0x00,0x34,
+0x10,0x00,0xcf,0x6c,0x03,0x11,0x01,0x59,0x00,0x1a,0x01,0x91,0x03,0x11,0x90,0xc3,
+0x06,0x06,0x23,0x01,0x25,0xd0,0x09,0x37,0x05,0x01,0x61,0x00,0x26,0xf2,0x0e,0x7a,
+0x06,0x10,0x0b,0x6a,0x03,0x14,0x2f,0x5f,0x00,0x02,0x61,0x00,0x25,0xfa,0x6f,0xcb,
+0x03,0x01,0x61,0x00,0x26,0xfe,0xbf,0x29,0x06,0x13,0x00,0xbc,0x04,0x1a,0xfe,0xa8,
+0x06,0x03,0x07,0x06,0x04,0x3a,0x01,0x07,0xd9,0x06,0x03,0xd8,0x03,0x14,0xe0,0x10,
+0x00,0x15,0x05,0x69,0x07,0x03,0x01,0x00,0x09,0x88,0x06,0x04,0x61,0x00,0x16,0xfe,
+0x18,0x07,0x19,0x5f,0x5f,0x00,0x02,0x2c,0x01,0x08,0x38,0x07,0x19,0x0b,0x5f,0x00,
+0x03,0x61,0x00,0x15,0x90,0x2b,0x00,0x14,0xfb,0x65,0x00,0x14,0xd0,0xbb,0x04,0x34,
+0xfe,0x00,0xbf,0x32,0x00,0x13,0x3f,0xbf,0x01,0x11,0x00,0xb0,0x01,0x12,0x07,0x5d,
+0x01,0x02,0x1e,0x02,0x14,0xf6,0x20,0x00,0x34,0xf6,0x00,0x3f,0x71,0x00,0x13,0xdf,
+0xdf,0x07,0x12,0x06,0xf7,0x01,0x04,0x5e,0x02,0x14,0x1f,0x6f,0x01,0x11,0x9f,0x58,
+0x00,0x13,0x0b,0x76,0x00,0x14,0x06,0xa9,0x00,0x12,0x0c,0x7f,0x01,0x13,0x7f,0x76,
+0x00,0x14,0xaf,0x38,0x00,0x02,0x2d,0x02,0x13,0x03,0x76,0x00,0x11,0x0f,0xcf,0x06,
+0x03,0x75,0x00,0x12,0xf2,0x10,0x00,0x22,0xf5,0x00,0x1f,0x00,0x00,0xa5,0x02,0x13,
+0x06,0x1f,0x00,0x12,0xbf,0x3e,0x00,0x14,0x8f,0x2f,0x05,0x12,0x9f,0xef,0x00,0x12,
+0x07,0x76,0x00,0x14,0x0d,0x24,0x07,0x13,0x0d,0x43,0x02,0x11,0x3f,0x76,0x00,0x01,
+0x22,0x02,0x01,0xe5,0x01,0x04,0xe4,0x00,0x02,0xc3,0x00,0x03,0xbe,0x01,0x11,0x30,
+0x27,0x00,0x13,0xd0,0x4e,0x01,0x11,0xf5,0x94,0x03,0x10,0x7f,0x8a,0x02,0x14,0x06,
+0x7c,0x01,0x11,0x7f,0x76,0x00,0x00,0x25,0x00,0x01,0x43,0x03,0x13,0xaf,0xd0,0x02,
+0x10,0x03,0xa0,0x02,0x00,0x3d,0x00,0x20,0xf9,0x0b,0x58,0x00,0x14,0x0d,0x50,0x03,
+0x10,0x0e,0x6d,0x00,0x10,0x08,0xd8,0x01,0x10,0x6f,0x50,0x00,0x03,0xbb,0x00,0x02,
+0xbd,0x00,0x60,0x20,0xdf,0xff,0xff,0xf0,0x01,0x71,0x01,0x14,0x3f,0xaa,0x01,0x10,
+0x06,0x76,0x00,0x40,0x1f,0xff,0xff,0xfa,0x2c,0x01,0x25,0xfe,0x07,0x9a,0x04,0x00,
+0x99,0x02,0x10,0x96,0x6b,0x00,0x00,0x80,0x00,0x23,0xf3,0xaf,0xbb,0x00,0x01,0x6f,
+0x03,0x20,0xfc,0xaf,0x6b,0x00,0x00,0x80,0x00,0x14,0x7d,0xdd,0x01,0x04,0x4b,0x04,
+0x11,0xfc,0x80,0x00,0x16,0xfd,0x37,0x02,0x14,0x6f,0x65,0x08,0x02,0x9b,0x06,0x02,
+0xbb,0x00,0x03,0xa6,0x03,0x01,0x6c,0x01,0x24,0x04,0xff,0x66,0x01,0x04,0xbd,0x00,
+0x02,0xb1,0x00,0x15,0x0f,0x0a,0x00,0x04,0xf5,0x03,0x02,0xb1,0x00,0x16,0xbf,0x5b,
+0x09,0x04,0xc5,0x06,0x19,0xf4,0x0a,0x00,0x04,0xbd,0x00,0x26,0xff,0xff,0x14,0x03,
+0x13,0x10,0x18,0x00,0x15,0xef,0x2a,0x07,0x18,0xcf,0x73,0x09,0x15,0x0a,0xf5,0x06,
+0x17,0x08,0xa9,0x09,0x03,0xbd,0x00,0x14,0x10,0x8e,0x02,0x05,0x29,0x03,0x16,0x02,
+0x3c,0x00,0x03,0x7d,0x04,0x06,0xbd,0x00,0x02,0xc8,0x05,0x14,0x09,0xc3,0x05,0x05,
+0xbd,0x00,0x15,0x20,0xac,0x09,0x14,0x80,0x21,0x00,0x02,0xf4,0x00,0x12,0x03,0x7c,
+0x00,0x15,0x1f,0x3b,0x03,0x12,0xcf,0x3c,0x00,0x14,0x7f,0xe0,0x04,0x13,0x5f,0x5a,
+0x05,0x13,0xdf,0x4a,0x04,0x13,0x0e,0xc4,0x00,0x01,0x6d,0x03,0x13,0xf3,0xe1,0x04,
+0x14,0xf1,0x8e,0x03,0x12,0xc0,0x70,0x02,0x15,0xf8,0x06,0x01,0x11,0x40,0x79,0x01,
+0x15,0xfe,0x5f,0x06,0x12,0xfd,0x17,0x00,0x15,0x50,0xcb,0x0a,0x13,0xf6,0x38,0x00,
+0x05,0x50,0x01,0x13,0xe4,0x59,0x00,0x05,0x9d,0x05,0x08,0x06,0x04,0x00,0xc2,0x00,
+0x09,0x53,0x01,0x15,0xbf,0x47,0x0a,0x07,0x1d,0x01,0x05,0x17,0x02,0x04,0x53,0x01,
+0x08,0x37,0x04,0x12,0x1e,0x4e,0x0b,0x06,0x37,0x04,0x26,0x7f,0xff,0x3d,0x06,0x06,
+0x71,0x0b,0x15,0xf8,0x10,0x00,0x15,0x06,0x2d,0x02,0x08,0xc7,0x01,0x03,0xef,0x0b,
+0x08,0x73,0x0b,0x19,0x40,0xff,0x01,0x06,0x3e,0x02,0x19,0x0b,0x74,0x0c,0x03,0x74,
+0x02,0x10,0xfb,0x05,0x00,0x34,0xe1,0x00,0x00,0x5e,0x04,0x26,0xfb,0x0e,0xbe,0x04,
+0x11,0x6f,0x7d,0x01,0x02,0x06,0x00,0x05,0xb3,0x00,0x11,0x90,0x27,0x00,0x17,0xfc,
+0xbf,0x01,0x11,0x04,0xeb,0x06,0x04,0xf5,0x00,0x17,0xf7,0x11,0x05,0x13,0xbf,0x7e,
+0x00,0x13,0x2f,0x1b,0x01,0x14,0x5f,0x74,0x01,0x12,0x9f,0x3c,0x01,0x14,0x0d,0x74,
+0x01,0x21,0x01,0xef,0xd7,0x01,0x15,0x07,0x74,0x01,0x02,0x0a,0x00,0x16,0x01,0x6f,
+0x0b,0x60,0x0d,0xff,0xff,0xff,0xff,0xc0,0x61,0xbf,0xff,0xff,0xff,0xff,0x00,0x01,
+0x00,0x60,0xcf,0xff,0xff,0xff,0xfd,0x06,0x10,0x00,0x11,0xf4,0x10,0x00,0x10,0x1f,
+0x0b,0x00,0x21,0x80,0x0f,0x06,0x00,0x00,0x10,0x00,0x01,0x1b,0x00,0x30,0xf2,0x00,
+0xaf,0x27,0x00,0x01,0x21,0x00,0x00,0x0a,0x00,0x31,0xfc,0x00,0x05,0x17,0x00,0x00,
+0x10,0x00,0x01,0x2b,0x00,0x12,0x70,0x07,0x00,0x50,0x60,0x00,0x00,0x00,0x04,0x09,
+0x00,0x12,0xf1,0x28,0x00,0x10,0xfb,0x21,0x00,0x11,0x8f,0x31,0x00,0x02,0x18,0x00,
+0x53,0xf0,0x00,0x00,0x00,0x0d,0x2a,0x00,0x10,0x0e,0x08,0x00,0x43,0x40,0x00,0x00,
+0x02,0x31,0x00,0xa3,0x00,0x9f,0xff,0xff,0xff,0xf9,0x00,0x00,0x00,0x6f,0x3a,0x00,
+0x10,0x03,0x19,0x00,0x44,0xe0,0x00,0x00,0x0b,0x5b,0x00,0x01,0x32,0x00,0x34,0x30,
+0x00,0x00,0x4a,0x00,0x01,0x5b,0x00,0xa3,0xf7,0x00,0x00,0x5f,0xff,0xff,0xff,0xfa,
+0x00,0x00,0x4b,0x00,0x30,0xc0,0x00,0x09,0x07,0x00,0x24,0x50,0x00,0x6c,0x00,0x34,
+0x10,0x00,0xef,0x31,0x00,0x84,0x00,0x7f,0xff,0xff,0xff,0xf5,0x00,0x3f,0x31,0x00,
+0x02,0x32,0x00,0x22,0xa0,0x07,0x8b,0x00,0x00,0x01,0x00,0x72,0x0c,0xff,0xff,0xff,
+0xfe,0x00,0xcf,0x7a,0x00,0x13,0x00,0x8e,0x00,0x22,0xf3,0x1f,0x9b,0x00,0x00,0x01,
+0x00,0x10,0x01,0x2c,0x00,0x13,0x85,0x8a,0x00,0x22,0x00,0x00,0x9f,0x00,0x26,0xfd,
+0xaf,0x31,0x00,0x01,0x32,0x00,0x00,0x01,0x00,0x27,0xf8,0x00,0x32,0x00,0x07,0x31,
+0x00,0x23,0x00,0x0a,0x10,0x00,0x23,0xd0,0x00,0x01,0x00,0x1a,0x5f,0x31,0x00,0x23,
+0x00,0x00,0x21,0x00,0x2a,0x20,0x00,0x32,0x00,0x15,0xc0,0x21,0x00,0x11,0x4f,0x10,
+0x00,0x15,0xf7,0x10,0x00,0x01,0xe3,0x00,0x00,0xeb,0x00,0x04,0x01,0x00,0x1b,0x09,
+0x31,0x00,0x01,0xf4,0x00,0x3b,0xff,0xf6,0x00,0x32,0x00,0x16,0x10,0x10,0x00,0x10,
+0x08,0x10,0x00,0x2a,0xb0,0x00,0x32,0x00,0x08,0x31,0x00,0x16,0x05,0x36,0x02,0x02,
+0x01,0x00,0x10,0xbf,0x3c,0x01,0x07,0x10,0x00,0x11,0x1f,0x5d,0x01,0x1a,0x00,0x84,
+0x00,0x0c,0x41,0x00,0x06,0x31,0x00,0x26,0x01,0x49,0x77,0x02,0x04,0x1e,0x00,0x04,
+0x66,0x02,0x07,0x16,0x01,0x1b,0x50,0x21,0x00,0x1b,0xc0,0x21,0x00,0x1a,0xf2,0x60,
+0x00,0x06,0x51,0x00,0x03,0x21,0x00,0x16,0xe3,0x10,0x00,0x10,0x04,0xdd,0x01,0x17,
+0x70,0x92,0x00,0x4b,0x01,0x46,0x77,0x52,0xf2,0x00,0x05,0x01,0x00,0x38,0xfe,0x03,
+0xff,0x01,0x00,0x1f,0xe0,0x1d,0x00,0x26,0x19,0xb0,0x1d,0x00,0x32,0xe2,0x01,0x66,
+0x01,0x00,0x19,0x7f,0xad,0x00,0x19,0x09,0x01,0x02,0x22,0x05,0xff,0x35,0x03,0x16,
+0x00,0xa5,0x02,0x15,0xfe,0xab,0x01,0x16,0xdf,0xae,0x02,0x03,0x90,0x03,0x02,0xab,
+0x03,0x05,0x7c,0x02,0x05,0xc5,0x01,0x10,0x2f,0x0e,0x00,0x14,0xe1,0x0e,0x00,0x19,
+0x0d,0x71,0x00,0x19,0x0a,0x41,0x02,0x01,0xe7,0x03,0x14,0xfb,0x0e,0x00,0x19,0x03,
+0x71,0x00,0x28,0x01,0xdf,0xbd,0x02,0x11,0x00,0x3d,0x04,0x05,0x45,0x01,0x19,0x7f,
+0x71,0x00,0x01,0xea,0x00,0x14,0xd1,0x0e,0x00,0x20,0x1e,0xff,0x3c,0x03,0x04,0x0e,
+0x00,0x19,0x0b,0x81,0x02,0x25,0x07,0xff,0x84,0x03,0x04,0x35,0x04,0x23,0xff,0x76,
+0x1a,0x01,0x28,0x21,0xef,0x31,0x01,0x29,0xf6,0xaf,0x4e,0x01,0x29,0x6b,0xff,0x1d,
+0x00,0x1f,0xbf,0x1d,0x00,0x26,0x04,0x7c,0x00,0x14,0x11,0x09,0x00,0x23,0x5b,0xf9,
+0x09,0x00,0x36,0x4d,0xff,0xfe,0x95,0x01,0x15,0x40,0x27,0x05,0x15,0xa0,0xc6,0x00,
+0x14,0xe0,0x7d,0x04,0x24,0xf9,0x10,0x9f,0x01,0x14,0x70,0x30,0x00,0x02,0x45,0x01,
+0x15,0x0f,0x99,0x02,0x15,0x5f,0xb3,0x02,0x15,0x8f,0xa9,0x01,0x13,0xbf,0xd1,0x04,
+0x02,0xcc,0x01,0x15,0x40,0x8f,0x03,0x1b,0x30,0x0a,0x00,0x1f,0xff,0x0a,0x00,0x22,
+0x2e,0x20,0x00,0x0a,0x00,0x15,0x10,0xff,0x02,0x05,0xd9,0x00,0x15,0xfa,0x23,0x02,
+0x11,0xf5,0x1d,0x00,0x13,0xef,0x92,0x04,0x15,0x4a,0x60,0x02,0x15,0x8f,0x23,0x02,
+0x14,0x8f,0x83,0x05,0x01,0x0a,0x00,0x25,0xe2,0x00,0xd8,0x05,0x15,0x10,0x1e,0x00,
+0x15,0xe2,0x0a,0x00,0x01,0x39,0x02,0x26,0x01,0x4b,0xed,0x03,0x15,0x8f,0x0d,0x01,
+0x15,0x0c,0xe5,0x02,0x15,0x06,0xeb,0x03,0x16,0x02,0x26,0x04,0x06,0x92,0x04,0x0a,
+0xbe,0x00,0x0f,0x0e,0x01,0x25,0x06,0x4a,0x01,0x15,0xdf,0x0a,0x00,0x15,0xcf,0x53,
+0x04,0x15,0x9f,0xc8,0x02,0x15,0x6f,0xc4,0x02,0x13,0x2f,0x8c,0x06,0x02,0xab,0x00,
+0x16,0xf7,0x8d,0x03,0x15,0x20,0xb9,0x01,0x16,0xe3,0x5b,0x03,0x15,0x90,0x2d,0x03,
+0x02,0xe2,0x01,0x15,0x3e,0xd8,0x01,0x25,0x01,0xbf,0x5c,0x05,0x26,0x03,0xcf,0xc9,
+0x03,0x5f,0x85,0x00,0x9f,0xff,0xfe,0x03,0x00,0x8c,0x55,0x7d,0xdd,0xdb,0x01,0x10,
+0xdf,0x03,0x15,0xc6,0x3d,0x04,0x25,0xfd,0x50,0xaf,0x01,0x15,0xa1,0xd7,0x01,0x14,
+0xd1,0x2b,0x01,0x25,0xff,0xd1,0x44,0x06,0x15,0xa0,0x51,0x04,0x14,0x40,0x69,0x04,
+0x15,0xfb,0x20,0x06,0x15,0xf2,0x48,0x01,0x14,0x70,0x07,0x04,0x15,0xfa,0xd2,0x06,
+0x1a,0xd0,0x10,0x02,0x14,0x1f,0xb7,0x07,0x19,0x01,0x13,0x00,0x15,0xf1,0x13,0x00,
+0x1f,0x10,0x13,0x00,0x0d,0x06,0x52,0x02,0x19,0x0f,0x13,0x00,0x14,0x20,0xb7,0x00,
+0x15,0xf6,0xca,0x00,0x15,0xb0,0xcc,0x01,0x15,0x40,0xd4,0x00,0x15,0x50,0xd4,0x04,
+0x24,0xea,0x60,0x4f,0x06,0x15,0xfa,0x59,0x06,0x01,0xe8,0x00,0x14,0x1c,0x13,0x00,
+0x14,0x09,0x13,0x00,0x14,0x1d,0x26,0x00,0x23,0x0c,0xff,0x13,0x00,0x01,0x16,0x01,
+0x23,0xc5,0x10,0xa2,0x00,0x14,0xa0,0x72,0x02,0x14,0xe0,0x50,0x04,0x15,0xf8,0xad,
+0x02,0x1a,0x40,0x3c,0x04,0x0f,0xe4,0x00,0x12,0x0f,0x13,0x00,0x0e,0x1a,0xf0,0x56,
+0x01,0x14,0x3f,0x7b,0x00,0x15,0x05,0x64,0x06,0x14,0x9f,0x9a,0x04,0x14,0x0e,0x22,
+0x06,0x14,0x06,0x2b,0x04,0x23,0x01,0xef,0xab,0x01,0x23,0x02,0xdf,0xa1,0x01,0x15,
+0x08,0xd6,0x05,0x15,0xaf,0x3c,0x04,0x04,0xf9,0x07,0x00,0xbc,0x00,0x13,0xc2,0x98,
+0x06,0x23,0xfd,0x50,0xdc,0x05,0x18,0x83,0x34,0x08,0x58,0x46,0x76,0x41,0x00,0x00,
+0x82,0x07,0x52,0x9e,0xff,0xff,0xff,0xb4,0x0c,0x00,0x95,0x36,0x66,0x66,0x60,0x00,
+0x00,0x4e,0xff,0xff,0x63,0x02,0x10,0x9f,0xd1,0x00,0x13,0x04,0x19,0x08,0x13,0x20,
+0xbf,0x03,0x12,0xf0,0x7d,0x03,0x03,0x8b,0x03,0x11,0x01,0xe2,0x00,0x05,0xea,0x05,
+0x12,0x40,0xa1,0x00,0x25,0xb0,0x04,0xe9,0x05,0x12,0xf8,0x6e,0x01,0x26,0x80,0x0a,
+0xfc,0x05,0x21,0xea,0x9c,0x24,0x04,0x10,0x0f,0x01,0x02,0x25,0x11,0x4b,0x17,0x00,
+0x11,0xfd,0x1c,0x01,0x16,0x40,0xc2,0x09,0x20,0xff,0xf5,0x0b,0x00,0x15,0xfa,0xa1,
+0x06,0x01,0x27,0x02,0x13,0x8f,0xec,0x00,0x13,0x3e,0xed,0x07,0x12,0x20,0xa6,0x00,
+0x04,0x23,0x01,0x01,0x0a,0x05,0x46,0x7b,0xbb,0xbb,0xb0,0x55,0x09,0x28,0xfb,0x10,
+0xf2,0x00,0x43,0x16,0xbd,0xfe,0xd9,0x4d,0x07,0x31,0x27,0x9a,0x96,0x1b,0x00,0x13,
+0x1a,0x05,0x02,0x11,0x02,0xf9,0x06,0x13,0xc1,0x3a,0x07,0x00,0x9d,0x01,0x03,0xd8,
+0x00,0xb1,0x80,0x04,0xff,0xff,0xf9,0x20,0x2a,0xff,0xff,0xf1,0x0a,0x8e,0x01,0x61,
+0xaf,0xff,0xf6,0x0e,0xff,0xfd,0xe0,0x01,0x41,0xfa,0x0f,0xff,0xf9,0xa0,0x03,0x41,
+0xfb,0x0f,0xff,0xf8,0x76,0x02,0x41,0xfc,0x0f,0xff,0xfb,0xcc,0x01,0x21,0xfb,0x0c,
+0xf5,0x04,0x70,0x6f,0xff,0xf8,0x07,0xff,0xff,0xe4,0xf0,0x01,0x10,0xf3,0x66,0x02,
+0x20,0xdb,0xdf,0xc7,0x00,0x14,0x5f,0x63,0x0a,0x15,0x06,0x36,0x09,0x10,0x4e,0x04,
+0x01,0xb0,0x30,0x00,0x00,0x00,0x00,0x6b,0xef,0xeb,0x60,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -1152,11 +1405,31 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 176, .range_length = 1, .glyph_id_start = 96, .list_length = 0, .type = 2, .unicode_list = 0, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[63281] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 1416, .size = 3225, .comp_size = 1538 },
+{ .bitmap_start = 3225, .comp_offset = 2954, .size = 3523, .comp_size = 1452 },
+{ .bitmap_start = 6748, .comp_offset = 4406, .size = 3420, .comp_size = 1023 },
+{ .bitmap_start = 10168, .comp_offset = 5429, .size = 3852, .comp_size = 1422 },
+{ .bitmap_start = 14020, .comp_offset = 6851, .size = 3163, .comp_size = 1265 },
+{ .bitmap_start = 17183, .comp_offset = 8116, .size = 3361, .comp_size = 1451 },
+{ .bitmap_start = 20544, .comp_offset = 9567, .size = 4056, .comp_size = 1169 },
+{ .bitmap_start = 24600, .comp_offset = 10736, .size = 3420, .comp_size = 571 },
+{ .bitmap_start = 28020, .comp_offset = 11307, .size = 3743, .comp_size = 1256 },
+{ .bitmap_start = 31763, .comp_offset = 12563, .size = 3686, .comp_size = 1098 },
+{ .bitmap_start = 35449, .comp_offset = 13661, .size = 3974, .comp_size = 1485 },
+{ .bitmap_start = 39423, .comp_offset = 15146, .size = 3893, .comp_size = 948 },
+{ .bitmap_start = 43316, .comp_offset = 16094, .size = 3751, .comp_size = 1413 },
+{ .bitmap_start = 47067, .comp_offset = 17507, .size = 3287, .comp_size = 918 },
+{ .bitmap_start = 50354, .comp_offset = 18425, .size = 3815, .comp_size = 1217 },
+{ .bitmap_start = 54169, .comp_offset = 19642, .size = 3431, .comp_size = 1422 },
+{ .bitmap_start = 57600, .comp_offset = 21064, .size = 3111, .comp_size = 1269 },
+};
+
+static uint8_t etxUncompBuf[2570] __SDRAMFONTS;
 
 const etxLz4Font lv_font_en_bold_XXL = {
-.uncomp_size = 63081,
-.comp_size = 18286,
+.uncomp_size = 2370,
+.comp_size = 1416,
 .line_height = 69,
 .base_line = 15,
 .subpx = 0,
@@ -1169,12 +1442,13 @@ const etxLz4Font lv_font_en_bold_XXL = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 35,
-.glyph_bitmap = 776,
-.class_pair_values = 61487,
-.left_class_mapping = 62887,
-.right_class_mapping = 62984,
+.class_pair_values = 776,
+.left_class_mapping = 2176,
+.right_class_mapping = 2273,
+.block_num = 17,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 63281,
+.lvglFontBufSize = 2570,
 };
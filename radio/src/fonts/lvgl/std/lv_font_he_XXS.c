@@ -80,322 +80,325 @@ static const uint8_t lz4FontData[] ={
 0x00,0x0e,0x11,0x08,0x00,0x13,0x38,0x08,0x00,0x13,0x62,0x08,0x00,0x13,0x8c,0x08,
 0x00,0x10,0xb6,0x08,0x00,0x52,0x08,0x00,0xff,0xe6,0x11,0x58,0x00,0x22,0x0e,0x12,
 0x08,0x00,0x22,0x36,0x12,0xa8,0x00,0x22,0x68,0x12,0x28,0x00,0x22,0x92,0x12,0x60,
-0x00,0x60,0xb5,0x12,0x10,0x09,0x0a,0x07,0x60,0x06,0xf4,0xff,0x3a,0x2e,0x1a,0x71,
-0x1c,0x0d,0xea,0x14,0xea,0x17,0xea,0x18,0xea,0x19,0xea,0x1d,0xea,0x1f,0xea,0x21,
-0xea,0x25,0xea,0x28,0xea,0x2d,0xea,0x32,0xea,0x33,0xea,0x34,0xea,0x4a,0xea,0x4f,
-0xea,0x54,0xea,0x57,0xea,0x58,0xea,0x59,0xea,0x5d,0xea,0x5e,0xea,0x5f,0xea,0x60,
-0xea,0x73,0xea,0x74,0xea,0x7a,0xea,0x7c,0xea,0x7d,0xea,0x80,0xea,0x83,0xea,0x84,
-0xea,0x85,0xea,0x87,0xea,0x9f,0xea,0xa1,0xea,0xd0,0xea,0xd1,0xea,0xd3,0xea,0xd5,
-0xea,0xec,0xea,0xf3,0xea,0xf6,0xea,0xff,0xea,0x28,0xeb,0x30,0xeb,0x67,0xeb,0xf7,
-0xeb,0x4c,0xec,0x4d,0xec,0x4e,0xec,0x4f,0xec,0x50,0xec,0x93,0xec,0x9f,0xec,0xf9,
-0xec,0x10,0xed,0x66,0xef,0xce,0xf1,0xae,0xf2,0x49,0x39,0x38,0x38,0x26,0x00,0x28,
-0x66,0x66,0x55,0x11,0x10,0x00,0x90,0xa0,0x00,0xa0,0x90,0x1a,0xdb,0xc4,0x02,0x76,
-0x30,0x4c,0xbd,0xa0,0x08,0x1a,0x00,0x0a,0x0a,0x00,0x00,0x70,0x00,0x6e,0x70,0x2b,
-0x09,0x53,0xb0,0x23,0x08,0xc5,0x00,0x01,0xb5,0x65,0x04,0x81,0xc9,0xc2,0x00,0xa0,
-0x00,0x2a,0x80,0x00,0x07,0x19,0x0a,0x00,0x72,0x96,0x50,0x01,0x87,0xa0,0x00,0x00,
-0x83,0x98,0x00,0x28,0x63,0x72,0x02,0x02,0xaa,0x00,0x08,0xb9,0x00,0x0d,0x0b,0x00,
-0x0c,0x6b,0x00,0x09,0xe0,0x00,0x59,0x68,0x91,0x75,0x0a,0xc0,0x1a,0x9b,0xc3,0x81,
-0x80,0x10,0x00,0x20,0x38,0x0b,0x02,0x90,0x57,0x06,0x60,0x57,0x01,0xb0,0x0a,0x10,
-0x19,0x00,0x00,0x20,0x07,0x40,0x0c,0x00,0x93,0x06,0x60,0x57,0x06,0x50,0xa2,0x1a,
-0x08,0x20,0x00,0x00,0x06,0x40,0x8b,0xa7,0x0b,0xa0,0x34,0x61,0x00,0xa0,0x00,0x0d,
-0x00,0x8c,0xfc,0x90,0x0d,0x00,0x00,0xd0,0x00,0x75,0x92,0x10,0x9a,0x30,0x37,0x00,
-0x74,0x00,0xb0,0x03,0x70,0x09,0x10,0x0a,0x00,0x55,0x00,0xa0,0x00,0x0a,0xba,0x04,
-0x80,0x75,0x75,0x04,0x88,0x50,0x48,0x75,0x04,0x74,0x80,0x75,0x0a,0xba,0x00,0x05,
-0xc3,0x27,0xa3,0x00,0x93,0x02,0x00,0xf1,0x5c,0x1a,0xbb,0x07,0x50,0x85,0x10,0x08,
-0x40,0x02,0xb0,0x00,0xc2,0x00,0xb3,0x00,0x6e,0xbb,0x70,0x0b,0xba,0x06,0x50,0x84,
-0x00,0x09,0x30,0x3c,0xa0,0x00,0x08,0x56,0x40,0x76,0x1b,0xaa,0x00,0x00,0x2f,0x00,
-0x0a,0xe0,0x03,0x8d,0x00,0xb1,0xd0,0x57,0x0d,0x09,0xbb,0xf9,0x00,0x0d,0x00,0x0c,
-0xcc,0x60,0xc0,0x00,0x0e,0xba,0x10,0x30,0x68,0x00,0x02,0xa3,0x90,0x48,0x09,0xbb,
-0x10,0x03,0xb8,0x00,0xb1,0x00,0x4c,0xa9,0x05,0xa0,0x76,0x66,0x03,0x93,0xa0,0x67,
-0x08,0xbb,0x00,0x7b,0xbc,0x90,0x00,0x83,0x00,0x0c,0x00,0x06,0x60,0x00,0xc1,0x00,
-0x39,0x00,0x0a,0x30,0x8c,0x00,0xf1,0x2a,0x85,0x39,0x09,0x30,0xbc,0xb0,0x58,0x07,
-0x66,0x60,0x57,0x0b,0xbb,0x10,0x0a,0xb9,0x06,0x60,0xa3,0x84,0x06,0x65,0x80,0x97,
-0x09,0xab,0x50,0x00,0xb1,0x07,0xb4,0x00,0x47,0x00,0x00,0x00,0x47,0x65,0x00,0x00,
-0x00,0x66,0x92,0x10,0x00,0x4a,0x4b,0x81,0x6b,0x50,0x00,0x7b,0x00,0x00,0x3b,0xbb,
-0x30,0x05,0x00,0x90,0x59,0x10,0x00,0x3a,0x91,0x02,0x8b,0x25,0xb3,0x0b,0x02,0xf1,
-0x43,0x3c,0xc5,0x62,0x0d,0x00,0x2b,0x00,0xc2,0x05,0x70,0x00,0x00,0x05,0x50,0x00,
-0x79,0x99,0x20,0x07,0x40,0x00,0x90,0x19,0x06,0x94,0x26,0x54,0x28,0x28,0x09,0x72,
-0x73,0x37,0x08,0x63,0x82,0x56,0x17,0x36,0x3a,0x7a,0x91,0x0a,0x10,0x00,0x00,0x01,
-0x99,0x94,0x00,0x00,0x97,0x00,0x00,0xbb,0x00,0x04,0x68,0x20,0x0a,0x13,0x80,0x0e,
-0xbb,0xd0,0x56,0x00,0x83,0xb2,0x00,0x49,0x4e,0xbc,0x50,0x49,0x00,0xd0,0x49,0x01,
-0xb0,0x4d,0xbe,0x09,0x00,0xf0,0x17,0x00,0xd0,0x4e,0xbc,0x60,0x06,0xcb,0x80,0x2c,
-0x00,0xa3,0x67,0x00,0x11,0x76,0x00,0x00,0x67,0x00,0x11,0x2c,0x00,0xa3,0x05,0xbb,
-0x70,0x4e,0xbb,0x30,0x49,0x01,0xc0,0x49,0x00,0x94,0x49,0x00,0x75,0x06,0x00,0xf4,
-0x08,0x01,0xd0,0x4e,0xbc,0x30,0x4e,0xbb,0x84,0x90,0x00,0x49,0x00,0x04,0xeb,0xb4,
-0x49,0x00,0x04,0x90,0x00,0x4e,0xbb,0x90,0x12,0x00,0x21,0xdb,0xb2,0x12,0x00,0xf2,
-0x0c,0x49,0x00,0x00,0x05,0xcb,0x90,0x2c,0x00,0x84,0x67,0x00,0x00,0x76,0x09,0xb6,
-0x67,0x00,0x67,0x1c,0x00,0x77,0x05,0xcb,0xa1,0x49,0x00,0x3a,0x03,0x00,0x35,0x4e,
-0xbb,0xca,0x0c,0x00,0x03,0x01,0x00,0x53,0x00,0x09,0x40,0x00,0x94,0x05,0x00,0xf2,
-0x0b,0x4a,0x20,0xb2,0x3c,0xb8,0x00,0x49,0x01,0xc2,0x49,0x0b,0x40,0x49,0x96,0x00,
-0x4e,0xf3,0x00,0x4c,0x2d,0x00,0x49,0x06,0x90,0x49,0x00,0x72,0x00,0x06,0x05,0x00,
-0xf0,0x4b,0x4e,0xbb,0x70,0x4f,0x00,0x02,0xf1,0x4e,0x60,0x08,0xe1,0x49,0xb0,0x0c,
-0xb1,0x49,0xb1,0x48,0xb1,0x49,0x57,0xa2,0xb1,0x49,0x0c,0xc0,0xb1,0x49,0x09,0x60,
-0xb1,0x4d,0x00,0x2a,0x4f,0x70,0x2a,0x49,0xc1,0x2a,0x49,0x4a,0x2a,0x49,0x0a,0x7a,
-0x49,0x01,0xea,0x49,0x00,0x7a,0x05,0xcc,0x70,0x2c,0x00,0xa4,0x67,0x00,0x49,0x75,
-0x00,0x2a,0x67,0x00,0x49,0x2c,0x00,0xa4,0x05,0xcc,0x80,0x4e,0xbc,0x70,0x49,0x00,
-0xb2,0x49,0x00,0x84,0x49,0x00,0xc2,0x4e,0xbb,0x60,0x49,0x00,0xc5,0x00,0x10,0x06,
-0x2a,0x00,0xf1,0x0a,0xa3,0x66,0x00,0x48,0x85,0x00,0x39,0x76,0x00,0x48,0x2c,0x00,
-0xa4,0x06,0xcd,0xc0,0x00,0x00,0x85,0x00,0x00,0x00,0x4e,0xbc,0x60,0x43,0x01,0xfb,
-0x16,0xd0,0x4e,0xbe,0x30,0x49,0x0a,0x40,0x49,0x02,0xb0,0x49,0x00,0xb2,0x0a,0xbc,
-0x35,0x80,0x1d,0x4b,0x10,0x00,0x5d,0xb2,0x00,0x04,0xc8,0x60,0x0d,0x0a,0xbc,0x50,
-0x8b,0xeb,0xb1,0x00,0xb1,0x00,0x03,0x00,0x37,0x67,0x00,0x94,0x03,0x00,0xf0,0x09,
-0x93,0x3a,0x00,0xc1,0x08,0xbc,0x60,0xb3,0x00,0x77,0x58,0x00,0xc1,0x0d,0x02,0xc0,
-0x0b,0x37,0x60,0x05,0x8d,0x10,0x00,0xeb,0xeb,0x09,0xf3,0x30,0xa3,0x07,0x80,0x2a,
-0x66,0x0b,0xb0,0x57,0x2a,0x0b,0xa0,0x93,0x0c,0x38,0x64,0xc0,0x0b,0x83,0x28,0xc0,
-0x08,0xd0,0x0d,0x90,0x04,0xb0,0x0a,0x50,0x69,0x00,0xd1,0x0c,0x38,0x70,0x03,0xdd,
-0x00,0x00,0xd7,0x00,0x04,0xbd,0x00,0x0d,0x27,0x80,0x78,0x00,0xd2,0xb4,0x00,0xd1,
-0x3c,0x06,0x90,0x0a,0x4d,0x10,0x02,0xf8,0x00,0x00,0xc2,0x70,0x00,0x80,0x6b,0xbc,
-0xd0,0x00,0x09,0x50,0x00,0x3b,0x12,0x00,0xe3,0x07,0x70,0x00,0x2c,0x00,0x00,0x9d,
-0xbb,0xb0,0x4c,0x35,0x70,0x57,0x05,0x03,0x00,0xf2,0x03,0x4c,0x30,0xa2,0x00,0x48,
-0x00,0x0c,0x00,0x07,0x40,0x01,0xa0,0x00,0xb1,0x00,0x56,0xa9,0x1b,0x01,0x00,0xf0,
-0x0e,0xa9,0x04,0x10,0x0c,0x80,0x29,0xb0,0x83,0x74,0xab,0xbb,0x00,0x42,0x01,0xb0,
-0x0a,0xba,0x02,0x40,0xa3,0x09,0x9d,0x37,0x60,0xa3,0x3c,0xbb,0x40,0x66,0xe6,0x02,
-0xf2,0x32,0x6b,0xbb,0x16,0x80,0x67,0x66,0x03,0x96,0x80,0x67,0x6b,0xbb,0x10,0x0a,
-0xba,0x06,0x60,0x53,0x93,0x00,0x06,0x60,0x42,0x0a,0xaa,0x00,0x00,0x06,0x70,0x00,
-0x67,0x0b,0xbc,0x76,0x70,0x77,0x84,0x06,0x76,0x60,0x77,0x0a,0xab,0x70,0x09,0xba,
-0x06,0x70,0x84,0x9c,0xbb,0x56,0x60,0x10,0x0a,0xba,0x10,0x07,0xb1,0x0d,0x00,0x7e,
-0x80,0x0d,0x00,0x02,0x00,0x22,0x0b,0xbb,0x28,0x00,0xa2,0x70,0x77,0x0b,0xbc,0x60,
-0x20,0x85,0x1a,0xba,0x00,0x5e,0x00,0xf0,0x00,0xbc,0x16,0x80,0x85,0x66,0x07,0x56,
-0x60,0x75,0x66,0x07,0x50,0x46,0x00,0x58,0x01,0x00,0x34,0x04,0x50,0x00,0xb6,0x00,
-0x41,0x67,0x3d,0x30,0x67,0x67,0x00,0xd2,0x2c,0x16,0x8c,0x10,0x6e,0xc0,0x06,0x77,
-0x70,0x67,0x0b,0x30,0x58,0x01,0x00,0xc4,0x6b,0xbc,0x8b,0xb0,0x67,0x08,0x70,0x93,
-0x66,0x07,0x50,0x84,0x04,0x00,0x09,0x4f,0x00,0xf2,0x1d,0x0a,0xba,0x16,0x70,0x58,
-0x93,0x01,0xb6,0x60,0x58,0x0a,0xbb,0x00,0x6b,0xab,0x16,0x70,0x57,0x66,0x03,0x96,
-0x70,0x67,0x6c,0xab,0x16,0x60,0x00,0x66,0x00,0x00,0x0b,0xbb,0x66,0x70,0x76,0x84,
-0x06,0x66,0x70,0x76,0x0b,0xbc,0x60,0x8e,0x00,0xf3,0x0f,0x06,0xca,0x67,0x06,0x60,
-0x66,0x06,0x60,0x1b,0xb9,0x05,0x80,0x60,0x08,0xb7,0x04,0x30,0xb2,0x1b,0xba,0x00,
-0x1b,0x0a,0xe6,0x1b,0x01,0xb0,0x1b,0x00,0xc7,0x58,0x00,0xf0,0x31,0x55,0x70,0x85,
-0x1c,0xbc,0x50,0xb2,0x0c,0x05,0x71,0xa0,0x0b,0x65,0x00,0xac,0x00,0x04,0xa0,0x00,
-0xa1,0x1d,0x06,0x66,0x56,0xc2,0xa2,0x29,0xa4,0x7b,0x00,0xba,0x0c,0x90,0x09,0x60,
-0xa4,0x00,0x77,0x1c,0x00,0xca,0x40,0x06,0xd0,0x00,0xc9,0x40,0x76,0x0c,0x00,0xb2,
-0x0d,0x06,0x72,0xa0,0x1c,0x75,0x00,0xbd,0x00,0x05,0xa0,0x00,0x65,0xfa,0x03,0xf3,
-0x0d,0x6b,0xbf,0x00,0x09,0x60,0x04,0xa0,0x01,0xc1,0x00,0x8d,0xbb,0x10,0x02,0x90,
-0xa2,0x0c,0x00,0xc0,0x98,0x00,0xc0,0x0c,0x00,0xa2,0x02,0x90,0x36,0x01,0x00,0xf0,
-0x08,0x92,0x02,0xb0,0x0c,0x00,0xc0,0x07,0x90,0xc0,0x0c,0x02,0xb0,0x92,0x00,0x0a,
-0xa2,0x36,0x44,0x1a,0xb1,0x00,0x00,0x03,0x23,0x04,0xf0,0x0a,0xf4,0x00,0x09,0xaa,
-0xab,0xb3,0x00,0xb1,0x11,0x01,0xc2,0x0b,0x00,0x00,0x0a,0x40,0xdc,0xcc,0x88,0x60,
-0x00,0x00,0x1f,0x70,0x00,0xab,0x05,0x10,0x00,0xb3,0x0c,0xf5,0x20,0x9b,0x00,0x00,
+0x00,0x60,0xb5,0x12,0x10,0x09,0x0a,0x07,0x60,0x06,0xf8,0x6e,0x2e,0x1a,0x71,0x1c,
+0x0d,0xea,0x14,0xea,0x17,0xea,0x18,0xea,0x19,0xea,0x1d,0xea,0x1f,0xea,0x21,0xea,
+0x25,0xea,0x28,0xea,0x2d,0xea,0x32,0xea,0x33,0xea,0x34,0xea,0x4a,0xea,0x4f,0xea,
+0x54,0xea,0x57,0xea,0x58,0xea,0x59,0xea,0x5d,0xea,0x5e,0xea,0x5f,0xea,0x60,0xea,
+0x73,0xea,0x74,0xea,0x7a,0xea,0x7c,0xea,0x7d,0xea,0x80,0xea,0x83,0xea,0x84,0xea,
+0x85,0xea,0x87,0xea,0x9f,0xea,0xa1,0xea,0xd0,0xea,0xd1,0xea,0xd3,0xea,0xd5,0xea,
+0xec,0xea,0xf3,0xea,0xf6,0xea,0xff,0xea,0x28,0xeb,0x30,0xeb,0x67,0xeb,0xf7,0xeb,
+0x4c,0xec,0x4d,0xec,0x4e,0xec,0x4f,0xec,0x50,0xec,0x93,0xec,0x9f,0xec,0xf9,0xec,
+0x10,0xed,0x66,0xef,0xce,0xf1,0xae,0xf2,0x00,0x01,0x00,0x2f,0xfd,0x00,0x01,0x00,
+0x03,0x1b,0xf8,0x08,0x00,0x00,0x01,0x00,0xce,0xfc,0xfc,0x00,0xff,0xfc,0x00,0xfa,
+0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x4e,0x01,0x01,0x00,0x02,0x16,0x00,0x2f,0xf4,
+0x00,0x01,0x00,0x15,0x1e,0xf0,0x1e,0x00,0x0e,0x90,0x00,0xb1,0xfc,0x00,0xff,0x00,
+0x00,0xf7,0xff,0xfa,0xfb,0x00,0xf9,0x11,0x00,0x00,0x0f,0x00,0x4d,0xff,0xff,0xfc,
+0xfe,0x92,0x00,0x30,0xfe,0x00,0xfe,0x2e,0x00,0x1e,0x00,0x01,0x00,0x1c,0xfe,0x0a,
+0x00,0x19,0xff,0x1f,0x00,0x03,0x0e,0x00,0x13,0xf9,0x0b,0x00,0x10,0xfe,0x02,0x00,
+0x2f,0xfd,0xfe,0x9c,0x00,0x0a,0x15,0x01,0x3c,0x00,0x11,0xff,0x34,0x00,0x39,0xff,
+0xfe,0xfe,0xd6,0x00,0x35,0xf4,0x00,0xed,0x24,0x00,0x20,0xfe,0xff,0x20,0x00,0x4e,
+0x00,0x00,0xfe,0xfe,0x44,0x00,0x10,0xfe,0x08,0x00,0x0f,0x6b,0x00,0x08,0x1f,0xfe,
+0x43,0x01,0x0d,0x1b,0xfc,0x25,0x00,0x12,0xfe,0x67,0x00,0x22,0xfe,0xfd,0x09,0x01,
+0x14,0xe8,0x6c,0x00,0x97,0xfb,0x00,0x00,0xed,0xfc,0xf4,0xf6,0x00,0xef,0x08,0x02,
+0x25,0xf7,0xfa,0x0c,0x00,0x75,0xe9,0x00,0x00,0x00,0xf6,0x00,0xf2,0x48,0x01,0x21,
+0xff,0xff,0x0c,0x01,0x1f,0x01,0xf7,0x01,0x01,0x10,0xfd,0xd2,0x00,0x0f,0x99,0x00,
+0x0c,0x3e,0xfa,0x00,0xff,0x69,0x02,0x03,0x12,0x00,0xb1,0xf1,0xf0,0x00,0x00,0xfa,
+0xfe,0xef,0xff,0x01,0x00,0x01,0x60,0x00,0xd3,0xf8,0xf9,0x00,0xf8,0xf9,0xfb,0xf8,
+0x00,0xf9,0xfb,0xfc,0xfb,0xfc,0x1a,0x01,0x66,0xf0,0xfd,0x00,0x00,0xfb,0xff,0x2b,
+0x01,0x62,0xfd,0xfd,0x00,0x00,0xfd,0xfe,0x4c,0x01,0x22,0x00,0x01,0x24,0x00,0x22,
+0xf7,0xfc,0x51,0x00,0x13,0x01,0x24,0x00,0x23,0xfe,0xfe,0x6c,0x01,0x08,0xa1,0x01,
+0x14,0xfd,0x20,0x01,0x15,0x01,0x51,0x01,0x02,0xb0,0x01,0x04,0x30,0x01,0xe0,0x01,
+0xfd,0xf1,0xfc,0x00,0x00,0xf9,0xfe,0xf9,0xff,0x01,0xf9,0x01,0x01,0x92,0x00,0xe6,
+0xfb,0xfb,0xfe,0xfd,0xfb,0xfd,0xfc,0xfe,0xfd,0xff,0x00,0xfe,0xfe,0x01,0xc5,0x00,
+0x2a,0x01,0xfe,0x34,0x02,0x0c,0xf8,0x01,0x09,0x19,0x00,0x1e,0x00,0x01,0x00,0x1f,
+0xfb,0x31,0x01,0x09,0x1f,0xff,0xf0,0x01,0x10,0x11,0xff,0x97,0x01,0x0e,0x5f,0x00,
+0x0f,0x4f,0x00,0x07,0x0f,0x1d,0x00,0x0a,0x1e,0x01,0xdd,0x01,0x19,0x01,0x81,0x00,
+0x12,0x01,0x14,0x03,0x0f,0x01,0x00,0x22,0x0b,0x81,0x00,0x1f,0xf6,0xd8,0x00,0x10,
+0x00,0x8e,0x00,0x1c,0xf7,0x31,0x02,0x20,0xff,0x01,0x4b,0x00,0x10,0x04,0x2b,0x02,
+0x0f,0x6f,0x00,0x15,0x1b,0x01,0xc4,0x04,0x02,0xa7,0x03,0x1d,0x01,0x14,0x01,0x1f,
+0xf7,0xd8,0x00,0x24,0x1f,0xff,0x24,0x00,0x26,0x0f,0x3d,0x00,0x07,0x03,0x49,0x05,
+0x30,0x02,0x03,0x00,0xed,0x00,0x2d,0x04,0x05,0x21,0x00,0xf1,0x0c,0x06,0x07,0x08,
+0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,
+0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,0xff,0x0d,0x1a,0x1b,0x1c,0x00,
+0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,
+0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x00,0x01,0x00,0x5e,0x02,0xce,0x00,0x20,0x03,
+0x02,0xc9,0x00,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,
+0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xf1,0x08,0x0b,0x00,0x0d,0x0e,0x0f,
+0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,
+0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,
+0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x8f,0x00,0x1e,0x1f,0x24,0xc8,0x00,0x25,0x50,
+0x00,0x00,0x00,0x00,0x00,0xf4,0xbd,0x49,0x39,0x38,0x38,0x26,0x00,0x28,0x66,0x66,
+0x55,0x11,0x10,0x00,0x90,0xa0,0x00,0xa0,0x90,0x1a,0xdb,0xc4,0x02,0x76,0x30,0x4c,
+0xbd,0xa0,0x08,0x1a,0x00,0x0a,0x0a,0x00,0x00,0x70,0x00,0x6e,0x70,0x2b,0x09,0x53,
+0xb0,0x23,0x08,0xc5,0x00,0x01,0xb5,0x65,0x04,0x81,0xc9,0xc2,0x00,0xa0,0x00,0x2a,
+0x80,0x00,0x07,0x19,0x0a,0x00,0x72,0x96,0x50,0x01,0x87,0xa0,0x00,0x00,0x83,0x98,
+0x00,0x28,0x63,0x72,0x02,0x02,0xaa,0x00,0x08,0xb9,0x00,0x0d,0x0b,0x00,0x0c,0x6b,
+0x00,0x09,0xe0,0x00,0x59,0x68,0x91,0x75,0x0a,0xc0,0x1a,0x9b,0xc3,0x81,0x80,0x10,
+0x00,0x20,0x38,0x0b,0x02,0x90,0x57,0x06,0x60,0x57,0x01,0xb0,0x0a,0x10,0x19,0x00,
+0x00,0x20,0x07,0x40,0x0c,0x00,0x93,0x06,0x60,0x57,0x06,0x50,0xa2,0x1a,0x08,0x20,
+0x00,0x00,0x06,0x40,0x8b,0xa7,0x0b,0xa0,0x34,0x61,0x00,0xa0,0x00,0x0d,0x00,0x8c,
+0xfc,0x90,0x0d,0x00,0x00,0xd0,0x00,0x75,0x92,0x10,0x9a,0x30,0x37,0x00,0x74,0x00,
+0xb0,0x03,0x70,0x09,0x10,0x0a,0x00,0x55,0x00,0xa0,0x00,0x0a,0xba,0x04,0x80,0x75,
+0x75,0x04,0x88,0x50,0x48,0x75,0x04,0x74,0x80,0x75,0x0a,0xba,0x00,0x05,0xc3,0x27,
+0xa3,0x00,0x93,0x02,0x00,0xf1,0x5c,0x1a,0xbb,0x07,0x50,0x85,0x10,0x08,0x40,0x02,
+0xb0,0x00,0xc2,0x00,0xb3,0x00,0x6e,0xbb,0x70,0x0b,0xba,0x06,0x50,0x84,0x00,0x09,
+0x30,0x3c,0xa0,0x00,0x08,0x56,0x40,0x76,0x1b,0xaa,0x00,0x00,0x2f,0x00,0x0a,0xe0,
+0x03,0x8d,0x00,0xb1,0xd0,0x57,0x0d,0x09,0xbb,0xf9,0x00,0x0d,0x00,0x0c,0xcc,0x60,
+0xc0,0x00,0x0e,0xba,0x10,0x30,0x68,0x00,0x02,0xa3,0x90,0x48,0x09,0xbb,0x10,0x03,
+0xb8,0x00,0xb1,0x00,0x4c,0xa9,0x05,0xa0,0x76,0x66,0x03,0x93,0xa0,0x67,0x08,0xbb,
+0x00,0x7b,0xbc,0x90,0x00,0x83,0x00,0x0c,0x00,0x06,0x60,0x00,0xc1,0x00,0x39,0x00,
+0x0a,0x30,0x8c,0x00,0xf1,0x2a,0x85,0x39,0x09,0x30,0xbc,0xb0,0x58,0x07,0x66,0x60,
+0x57,0x0b,0xbb,0x10,0x0a,0xb9,0x06,0x60,0xa3,0x84,0x06,0x65,0x80,0x97,0x09,0xab,
+0x50,0x00,0xb1,0x07,0xb4,0x00,0x47,0x00,0x00,0x00,0x47,0x65,0x00,0x00,0x00,0x66,
+0x92,0x10,0x00,0x4a,0x4b,0x81,0x6b,0x50,0x00,0x7b,0x00,0x00,0x3b,0xbb,0x30,0x05,
+0x00,0xf1,0x50,0x59,0x10,0x00,0x3a,0x91,0x02,0x8b,0x25,0xb3,0x00,0x00,0x00,0x00,
+0x3c,0xc5,0x62,0x0d,0x00,0x2b,0x00,0xc2,0x05,0x70,0x00,0x00,0x05,0x50,0x00,0x79,
+0x99,0x20,0x07,0x40,0x00,0x90,0x19,0x06,0x94,0x26,0x54,0x28,0x28,0x09,0x72,0x73,
+0x37,0x08,0x63,0x82,0x56,0x17,0x36,0x3a,0x7a,0x91,0x0a,0x10,0x00,0x00,0x01,0x99,
+0x94,0x00,0x00,0x97,0x00,0x00,0xbb,0x00,0x04,0x68,0x20,0x0a,0x13,0x80,0x0e,0xbb,
+0xd0,0x56,0x00,0x83,0xb2,0x00,0x49,0x4e,0xbc,0x50,0x49,0x00,0xd0,0x49,0x01,0xb0,
+0x4d,0xbe,0x09,0x00,0xf0,0x17,0x00,0xd0,0x4e,0xbc,0x60,0x06,0xcb,0x80,0x2c,0x00,
+0xa3,0x67,0x00,0x11,0x76,0x00,0x00,0x67,0x00,0x11,0x2c,0x00,0xa3,0x05,0xbb,0x70,
+0x4e,0xbb,0x30,0x49,0x01,0xc0,0x49,0x00,0x94,0x49,0x00,0x75,0x06,0x00,0xf4,0x08,
+0x01,0xd0,0x4e,0xbc,0x30,0x4e,0xbb,0x84,0x90,0x00,0x49,0x00,0x04,0xeb,0xb4,0x49,
+0x00,0x04,0x90,0x00,0x4e,0xbb,0x90,0x12,0x00,0x21,0xdb,0xb2,0x12,0x00,0xf2,0x0c,
+0x49,0x00,0x00,0x05,0xcb,0x90,0x2c,0x00,0x84,0x67,0x00,0x00,0x76,0x09,0xb6,0x67,
+0x00,0x67,0x1c,0x00,0x77,0x05,0xcb,0xa1,0x49,0x00,0x3a,0x03,0x00,0x35,0x4e,0xbb,
+0xca,0x0c,0x00,0x03,0x01,0x00,0x53,0x00,0x09,0x40,0x00,0x94,0x05,0x00,0xf2,0x0b,
+0x4a,0x20,0xb2,0x3c,0xb8,0x00,0x49,0x01,0xc2,0x49,0x0b,0x40,0x49,0x96,0x00,0x4e,
+0xf3,0x00,0x4c,0x2d,0x00,0x49,0x06,0x90,0x49,0x00,0x72,0x00,0x06,0x05,0x00,0xf0,
+0x4b,0x4e,0xbb,0x70,0x4f,0x00,0x02,0xf1,0x4e,0x60,0x08,0xe1,0x49,0xb0,0x0c,0xb1,
+0x49,0xb1,0x48,0xb1,0x49,0x57,0xa2,0xb1,0x49,0x0c,0xc0,0xb1,0x49,0x09,0x60,0xb1,
+0x4d,0x00,0x2a,0x4f,0x70,0x2a,0x49,0xc1,0x2a,0x49,0x4a,0x2a,0x49,0x0a,0x7a,0x49,
+0x01,0xea,0x49,0x00,0x7a,0x05,0xcc,0x70,0x2c,0x00,0xa4,0x67,0x00,0x49,0x75,0x00,
+0x2a,0x67,0x00,0x49,0x2c,0x00,0xa4,0x05,0xcc,0x80,0x4e,0xbc,0x70,0x49,0x00,0xb2,
+0x49,0x00,0x84,0x49,0x00,0xc2,0x4e,0xbb,0x60,0x49,0x00,0xc5,0x00,0x10,0x06,0x2a,
+0x00,0xf1,0x0a,0xa3,0x66,0x00,0x48,0x85,0x00,0x39,0x76,0x00,0x48,0x2c,0x00,0xa4,
+0x06,0xcd,0xc0,0x00,0x00,0x85,0x00,0x00,0x00,0x4e,0xbc,0x60,0x43,0x01,0xfb,0x16,
+0xd0,0x4e,0xbe,0x30,0x49,0x0a,0x40,0x49,0x02,0xb0,0x49,0x00,0xb2,0x0a,0xbc,0x35,
+0x80,0x1d,0x4b,0x10,0x00,0x5d,0xb2,0x00,0x04,0xc8,0x60,0x0d,0x0a,0xbc,0x50,0x8b,
+0xeb,0xb1,0x00,0xb1,0x00,0x03,0x00,0x37,0x67,0x00,0x94,0x03,0x00,0xf3,0x4c,0x93,
+0x3a,0x00,0xc1,0x08,0xbc,0x60,0xb3,0x00,0x77,0x58,0x00,0xc1,0x0d,0x02,0xc0,0x0b,
+0x37,0x60,0x05,0x8d,0x10,0x00,0xeb,0x00,0x00,0xa6,0x00,0xa3,0x07,0x80,0x2a,0x66,
+0x0b,0xb0,0x57,0x2a,0x0b,0xa0,0x93,0x0c,0x38,0x64,0xc0,0x0b,0x83,0x28,0xc0,0x08,
+0xd0,0x0d,0x90,0x04,0xb0,0x0a,0x50,0x69,0x00,0xd1,0x0c,0x38,0x70,0x03,0xdd,0x00,
+0x00,0xd7,0x00,0x04,0xbd,0x00,0x0d,0x27,0x80,0x78,0x00,0xd2,0xb4,0x00,0xd1,0x3c,
+0x06,0x90,0x0a,0x4d,0x10,0x02,0xf8,0x00,0x00,0xc2,0x70,0x00,0x80,0x6b,0xbc,0xd0,
+0x00,0x09,0x50,0x00,0x3b,0x12,0x00,0xe3,0x07,0x70,0x00,0x2c,0x00,0x00,0x9d,0xbb,
+0xb0,0x4c,0x35,0x70,0x57,0x05,0x03,0x00,0xf2,0x03,0x4c,0x30,0xa2,0x00,0x48,0x00,
+0x0c,0x00,0x07,0x40,0x01,0xa0,0x00,0xb1,0x00,0x56,0xa9,0x1b,0x01,0x00,0xf0,0x0e,
+0xa9,0x04,0x10,0x0c,0x80,0x29,0xb0,0x83,0x74,0xab,0xbb,0x00,0x42,0x01,0xb0,0x0a,
+0xba,0x02,0x40,0xa3,0x09,0x9d,0x37,0x60,0xa3,0x3c,0xbb,0x40,0x66,0xe6,0x02,0xf2,
+0x32,0x6b,0xbb,0x16,0x80,0x67,0x66,0x03,0x96,0x80,0x67,0x6b,0xbb,0x10,0x0a,0xba,
+0x06,0x60,0x53,0x93,0x00,0x06,0x60,0x42,0x0a,0xaa,0x00,0x00,0x06,0x70,0x00,0x67,
+0x0b,0xbc,0x76,0x70,0x77,0x84,0x06,0x76,0x60,0x77,0x0a,0xab,0x70,0x09,0xba,0x06,
+0x70,0x84,0x9c,0xbb,0x56,0x60,0x10,0x0a,0xba,0x10,0x07,0xb1,0x0d,0x00,0x7e,0x80,
+0x0d,0x00,0x02,0x00,0x22,0x0b,0xbb,0x28,0x00,0xa2,0x70,0x77,0x0b,0xbc,0x60,0x20,
+0x85,0x1a,0xba,0x00,0x5e,0x00,0xf0,0x00,0xbc,0x16,0x80,0x85,0x66,0x07,0x56,0x60,
+0x75,0x66,0x07,0x50,0x46,0x00,0x58,0x01,0x00,0x34,0x04,0x50,0x00,0xb6,0x00,0x41,
+0x67,0x3d,0x30,0x67,0x67,0x00,0xd2,0x2c,0x16,0x8c,0x10,0x6e,0xc0,0x06,0x77,0x70,
+0x67,0x0b,0x30,0x58,0x01,0x00,0xc4,0x6b,0xbc,0x8b,0xb0,0x67,0x08,0x70,0x93,0x66,
+0x07,0x50,0x84,0x04,0x00,0x09,0x4f,0x00,0xf2,0x1d,0x0a,0xba,0x16,0x70,0x58,0x93,
+0x01,0xb6,0x60,0x58,0x0a,0xbb,0x00,0x6b,0xab,0x16,0x70,0x57,0x66,0x03,0x96,0x70,
+0x67,0x6c,0xab,0x16,0x60,0x00,0x66,0x00,0x00,0x0b,0xbb,0x66,0x70,0x76,0x84,0x06,
+0x66,0x70,0x76,0x0b,0xbc,0x60,0x8e,0x00,0xf3,0x0f,0x06,0xca,0x67,0x06,0x60,0x66,
+0x06,0x60,0x1b,0xb9,0x05,0x80,0x60,0x08,0xb7,0x04,0x30,0xb2,0x1b,0xba,0x00,0x1b,
+0x0a,0xe6,0x1b,0x01,0xb0,0x1b,0x00,0xc7,0x58,0x00,0xf0,0x31,0x55,0x70,0x85,0x1c,
+0xbc,0x50,0xb2,0x0c,0x05,0x71,0xa0,0x0b,0x65,0x00,0xac,0x00,0x04,0xa0,0x00,0xa1,
+0x1d,0x06,0x66,0x56,0xc2,0xa2,0x29,0xa4,0x7b,0x00,0xba,0x0c,0x90,0x09,0x60,0xa4,
+0x00,0x77,0x1c,0x00,0xca,0x40,0x06,0xd0,0x00,0xc9,0x40,0x76,0x0c,0x00,0xb2,0x0d,
+0x06,0x72,0xa0,0x1c,0x75,0x00,0xbd,0x00,0x05,0xa0,0x00,0x65,0xfa,0x03,0xf3,0x0d,
+0x6b,0xbf,0x00,0x09,0x60,0x04,0xa0,0x01,0xc1,0x00,0x8d,0xbb,0x10,0x02,0x90,0xa2,
+0x0c,0x00,0xc0,0x98,0x00,0xc0,0x0c,0x00,0xa2,0x02,0x90,0x36,0x01,0x00,0xf0,0x08,
+0x92,0x02,0xb0,0x0c,0x00,0xc0,0x07,0x90,0xc0,0x0c,0x02,0xb0,0x92,0x00,0x0a,0xa2,
+0x36,0x44,0x1a,0xb1,0x00,0x00,0x03,0x23,0x04,0xf0,0x0a,0xf4,0x00,0x09,0xaa,0xab,
+0xb3,0x00,0xb1,0x11,0x01,0xc2,0x0b,0x00,0x00,0x0a,0x40,0xdc,0xcc,0x88,0x60,0x00,
+0x00,0x1f,0x70,0x00,0xab,0x05,0xf5,0x25,0x00,0x02,0x00,0x00,0x00,0x9b,0x00,0x00,
 0x07,0x7e,0xaa,0xa6,0x69,0x01,0x11,0x2b,0x95,0x00,0x00,0x1b,0x0a,0x3c,0xcc,0xc9,
 0x00,0xbb,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x10,0x00,0x00,0x78,0xa2,0x00,
 0x09,0x60,0x0a,0x30,0x8e,0x70,0x1b,0xf2,0x00,0xc0,0x29,0x00,0x04,0x00,0x78,0xec,
 0xc8,0x00,0x00,0xab,0xb6,0x00,0x14,0x00,0xc0,0x7c,0xb0,0x1e,0xb2,0x1b,0x30,0x08,
-0x70,0x00,0xb5,0xa6,0x00,0xbc,0x03,0x02,0x01,0x00,0x10,0x08,0x49,0x00,0xf5,0x26,
+0x70,0x00,0xb5,0xa6,0x00,0xbc,0x03,0x02,0x01,0x00,0x10,0x08,0x49,0x00,0xf4,0x27,
 0xf4,0x00,0x00,0x00,0xd7,0xd0,0x00,0x00,0x5b,0x0b,0x50,0x00,0x0d,0x20,0x2d,0x00,
 0x06,0xa0,0x00,0xa6,0x00,0xef,0xff,0xff,0xe0,0x00,0x00,0x59,0x20,0x07,0x6b,0x4c,
 0x1d,0x67,0xd7,0xba,0x40,0xaf,0xb6,0xc0,0x0c,0x60,0xcc,0x10,0x20,0x1c,0x4b,0x00,
-0x0b,0x40,0x5d,0xcd,0x50,0x5c,0x0d,0xf3,0x38,0x03,0xdf,0xd4,0x10,0x05,0xa2,0xe2,
-0xa7,0x00,0xb1,0x01,0x01,0xb1,0x2b,0x00,0x00,0x0a,0x20,0xd1,0x00,0x00,0xc2,0x06,
-0xa1,0x01,0x89,0x00,0x06,0xaa,0xb8,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x20,0x00,
-0x00,0x00,0x8d,0xcc,0xc6,0x00,0x2d,0x0a,0x70,0x97,0x00,0xdb,0x5b,0x00,0xc1,0x0c,
-0x4a,0x00,0x09,0x30,0xc0,0x00,0x00,0xc1,0x04,0xa0,0x00,0x88,0x00,0x05,0xcc,0xd7,
-0x4e,0x00,0xf2,0x0b,0x33,0x33,0x20,0x3f,0xbb,0xd8,0x09,0x80,0x0b,0x10,0xa5,0x07,
-0x80,0x3c,0x98,0x60,0x0b,0x47,0xaa,0x00,0xa4,0x04,0x90,0x02,0xcc,0xb1,0x20,0x00,
-0xf3,0x0b,0x46,0x40,0x02,0x4c,0xfd,0x52,0x83,0x33,0x22,0x88,0x0c,0xcb,0x08,0x80,
-0x22,0x20,0x88,0x09,0x98,0x08,0x88,0x88,0x87,0x70,0x0b,0xfb,0x41,0x00,0xf2,0x6f,
-0x12,0x04,0x02,0xbf,0xeb,0xb8,0xe7,0x00,0x08,0x07,0x70,0x00,0x80,0x09,0x30,0x08,
-0x2b,0x10,0x00,0xb7,0xd7,0x00,0x03,0x02,0xbf,0xeb,0x00,0x00,0x12,0x00,0x13,0x33,
-0x33,0x18,0x8f,0x44,0x68,0x81,0x53,0xef,0xa8,0x5f,0x05,0xa9,0x81,0x60,0x00,0x78,
-0x4e,0x00,0x07,0x83,0xb0,0x00,0x78,0xaf,0x87,0x78,0x00,0x17,0x97,0x00,0x00,0x3e,
-0x7e,0x7c,0x10,0x0d,0x30,0xd2,0x3b,0x02,0xb0,0x0c,0x10,0xc0,0x39,0x1a,0x3b,0x5b,
-0x00,0xda,0x83,0x79,0xd0,0x06,0xe3,0x00,0xb4,0x00,0x05,0xcc,0xb4,0x00,0x08,0x80,
-0x00,0x00,0x94,0x4a,0x00,0x00,0xb0,0x0b,0x4b,0x80,0xa3,0x3a,0xef,0xf4,0x1e,0xfa,
-0xef,0xf2,0x85,0x8f,0xff,0xb0,0xb3,0xff,0xff,0xf2,0xed,0xee,0xee,0xe4,0x84,0x00,
-0x10,0x2a,0x05,0x00,0xf0,0x05,0x3a,0x00,0x00,0xcc,0xcc,0xec,0x10,0x07,0x99,0x99,
-0x97,0x00,0x1d,0xec,0xdd,0xd0,0x00,0x1b,0x30,0x00,0x1e,0x01,0x03,0xa8,0x00,0xf2,
-0x26,0x01,0x86,0x10,0x00,0x00,0x17,0x68,0x70,0x00,0x00,0x36,0x94,0x00,0x00,0x17,
-0xa2,0x00,0x01,0x95,0x69,0x10,0x00,0xd5,0x98,0x7b,0x00,0x0c,0x68,0x77,0xa0,0x00,
-0x1a,0x77,0x90,0x00,0x0a,0xaa,0x91,0x02,0xa2,0x28,0xc1,0x29,0x00,0xc9,0xa2,0x90,
-0x00,0x0b,0x29,0x00,0x00,0xb2,0x07,0x00,0xf2,0x19,0xb1,0xeb,0xbb,0xbb,0x00,0x37,
-0x30,0x00,0x00,0x37,0x17,0x85,0x00,0x08,0x00,0x02,0x45,0x01,0x90,0x26,0xb2,0x80,
-0x62,0xaa,0x82,0x09,0x06,0x10,0x5e,0x00,0x71,0x27,0x07,0x93,0x07,0x00,0x58,0x88,
-0x88,0x60,0x24,0x02,0xf2,0x0e,0x00,0xb3,0x80,0x00,0x32,0x3e,0x88,0x00,0x6a,0x8b,
-0x2b,0x20,0x0b,0x00,0x7b,0xc0,0x00,0xa0,0x00,0xb3,0x00,0x37,0x00,0x0b,0x30,0x04,
-0x60,0x00,0xb3,0x8c,0x00,0xf1,0x26,0x19,0x56,0x39,0x19,0x50,0x2c,0x10,0xa2,0x07,
-0xb0,0xd0,0x1c,0x8c,0x70,0x57,0x0a,0x50,0x94,0x00,0xc2,0x5c,0xcb,0x10,0x00,0x07,
-0x60,0x00,0x05,0x70,0x00,0x05,0x70,0x7c,0xcd,0xd0,0x5d,0x40,0x02,0xb0,0x05,0xe0,
-0x58,0x93,0x93,0x57,0x9c,0xcf,0x90,0x00,0xc1,0x00,0x0c,0x10,0x05,0x00,0xe0,0x3c,
-0xcc,0x62,0x40,0x0d,0x49,0x00,0xd4,0x90,0x0d,0x49,0x00,0xd0,0x39,0x01,0x00,0xf2,
-0x03,0x40,0x06,0xc9,0x0c,0x10,0xc0,0x1c,0x01,0xc0,0x3e,0xbc,0x80,0x39,0x00,0xb1,
-0x39,0x00,0x93,0x03,0x00,0xf0,0x05,0x48,0x1b,0xc0,0x48,0x00,0x85,0x48,0x00,0x75,
-0x3a,0x00,0xb2,0x09,0xcc,0x70,0x39,0x39,0x37,0x9c,0xc7,0x17,0x08,0x44,0x0b,0x10,
-0x00,0xb1,0x05,0x00,0xe0,0x7b,0xc6,0x00,0x00,0xc1,0x00,0x09,0x30,0x00,0xc1,0x7b,
-0xc6,0x00,0x81,0x16,0x00,0xf2,0x1f,0x8c,0xcc,0x10,0x00,0x84,0x00,0x0a,0x20,0x05,
-0xb0,0x0a,0xb0,0x01,0x40,0x00,0x3e,0xcc,0xa0,0x39,0x00,0x84,0x39,0x00,0x66,0x39,
-0x00,0x66,0x3e,0xcc,0xd6,0x68,0xac,0xb0,0x0d,0x50,0x85,0x0d,0x00,0x57,0x49,0x00,
-0x57,0x85,0x2c,0xd7,0x39,0x01,0x00,0xf1,0x1e,0x5d,0x60,0x1b,0x00,0xc0,0x0c,0x8c,
-0xc0,0x9e,0xcc,0xb0,0x48,0x00,0x95,0x67,0x00,0x76,0x4a,0x00,0xb3,0x09,0xcc,0x70,
-0x58,0x01,0xc0,0xd0,0x2a,0x08,0x55,0x70,0x1c,0xc1,0xad,0xa2,0x00,0x6d,0xcc,0x46,
-0x60,0x1c,0x5c,0x50,0xd0,0x00,0x9b,0x08,0x00,0x05,0x00,0xf5,0x07,0x6d,0xcc,0x46,
-0x70,0x1d,0x5c,0x60,0xd0,0x00,0x1c,0x3c,0xbc,0x30,0xa5,0x09,0x41,0xc0,0xb1,0x0a,
-0x9a,0x00,0x96,0xeb,0x06,0xf9,0x10,0x87,0x08,0x40,0xb4,0xb2,0x01,0xd7,0x00,0x02,
-0xc0,0x7c,0xce,0x70,0x5c,0xbc,0x50,0x10,0x1c,0x39,0x02,0xa3,0x90,0xa4,0x39,0xa7,
-0x03,0x92,0x00,0x39,0x00,0x00,0xcc,0x00,0xf0,0x29,0xa2,0x1b,0x0b,0x17,0x63,0x90,
-0xd0,0x4c,0xc4,0x0c,0x01,0xd0,0x07,0x80,0x0d,0xdc,0x90,0x00,0x8f,0xcb,0xb1,0x0c,
-0x00,0x76,0x0c,0x00,0x57,0x0d,0x00,0x58,0x98,0x00,0x58,0x08,0x69,0x50,0xb1,0xc0,
-0x0a,0x0a,0x00,0x3e,0x33,0xe3,0x66,0x10,0x00,0x49,0x91,0x16,0xa7,0x05,0x40,0x00,
-0x6a,0xaa,0x8b,0x01,0xf0,0x06,0x15,0xaa,0x00,0x02,0x7c,0xff,0xfe,0x00,0x0e,0xff,
-0xfe,0xbe,0x00,0x0e,0xd8,0x30,0x3e,0x00,0x0e,0x30,0x00,0x05,0x00,0xe0,0x01,0x6e,
-0x00,0x1e,0x30,0x4f,0xfe,0x0d,0xff,0x30,0x2d,0xf8,0x0d,0xfd,0xd8,0x01,0x00,0x04,
-0x00,0xf0,0x31,0x75,0xcc,0xcc,0xc6,0x7c,0x8a,0x11,0x18,0xab,0xca,0x90,0x00,0x7b,
-0xc9,0x4f,0xcc,0xce,0x79,0xdb,0xa0,0x00,0x7c,0xda,0x59,0x00,0x07,0x7a,0xb9,0xfd,
-0xdd,0xea,0xb0,0x34,0x23,0x44,0x44,0x3f,0xf9,0xcf,0xff,0xff,0xef,0x8b,0xff,0xff,
-0xe7,0x84,0x68,0x88,0x87,0xff,0xad,0xff,0xff,0xf8,0x94,0x69,0x99,0x98,0xde,0x8a,
-0xee,0xee,0xdf,0x1b,0x00,0x40,0x45,0x23,0x55,0x55,0x10,0x04,0xf0,0x0c,0x07,0x50,
-0x00,0x00,0x07,0xfd,0x23,0x00,0x07,0xfe,0x2d,0xf4,0x07,0xfe,0x20,0x5f,0xfa,0xfe,
-0x20,0x00,0x5f,0xfe,0x20,0x00,0x00,0x4d,0x20,0x24,0x11,0xf5,0x58,0x02,0x0e,0xe2,
-0x0c,0xf1,0x5f,0xec,0xf8,0x00,0x6f,0xf9,0x00,0x0c,0xff,0xe2,0x0c,0xf8,0x5f,0xe0,
-0x98,0x00,0x5b,0x00,0x00,0x02,0xd2,0x00,0x00,0x7b,0x3f,0x3b,0x70,0x4f,0x73,0xf3,
-0x8f,0x4a,0xc0,0x3f,0x30,0xca,0xd9,0x03,0xf3,0x09,0xdb,0xb0,0x02,0x00,0xbc,0x6f,
-0x40,0x00,0x4f,0x60,0xbf,0xa7,0xaf,0xb0,0x00,0x7d,0xfd,0x70,0x00,0x00,0x06,0xb6,
-0x00,0x00,0x31,0xcf,0xc1,0x30,0x4f,0xff,0xff,0xff,0x47,0xff,0xb4,0xbf,0xf7,0x0d,
-0xf2,0x02,0xfd,0x04,0xff,0x70,0x7f,0xf4,0x6f,0xff,0xff,0xff,0x60,0x75,0xef,0xe5,
-0x70,0x00,0x08,0xf8,0x58,0x04,0xf0,0x1e,0x01,0x00,0x00,0x00,0x2d,0xe3,0xd9,0x00,
-0x00,0x4e,0x97,0xff,0x90,0x00,0x6f,0x7b,0xc6,0xfb,0x00,0x9e,0x6d,0xff,0xe6,0xdb,
-0x07,0x4e,0xff,0xff,0xf5,0x80,0x05,0xff,0xa9,0xff,0x70,0x00,0x5f,0xf3,0x1f,0xf7,
-0x00,0x03,0xcc,0x20,0xcc,0x8f,0x04,0x10,0x9c,0xc5,0x00,0x23,0xdf,0x60,0x05,0x00,
-0xf0,0x47,0x58,0xef,0xb7,0x10,0x00,0x4f,0xff,0xfc,0x00,0x00,0x04,0xff,0xc0,0x00,
-0x19,0xa9,0x7c,0x6a,0xa6,0x3f,0xff,0xfc,0xfe,0xec,0x2f,0xff,0xff,0xfc,0xbb,0x01,
-0xdf,0xff,0xfe,0x20,0x00,0xba,0x22,0x22,0x8c,0x00,0x5f,0x10,0x00,0x00,0xe7,0x0e,
-0xb6,0x30,0x02,0x6a,0xf0,0xff,0xfe,0x44,0xdf,0xff,0x2f,0xff,0xff,0xff,0xff,0xf2,
-0xcf,0xff,0xff,0xff,0xfe,0x00,0x00,0x5b,0xda,0x43,0xd0,0x9f,0xa7,0xaf,0xbf,0x5f,
-0x40,0x04,0x7f,0xf9,0x90,0x00,0xde,0xee,0x99,0x00,0xf1,0x02,0x0f,0xff,0xe0,0x00,
-0x9a,0xff,0x74,0x00,0x3f,0x5f,0xdf,0x85,0x8f,0xa0,0xf3,0x6c,0xfd,0xe2,0x09,0xf1,
-0x01,0x15,0xf8,0xff,0xff,0x8f,0xff,0xf8,0xff,0xff,0x84,0x59,0xf8,0x00,0x09,0x70,
-0x00,0xf6,0x09,0xf2,0x02,0x05,0xf8,0x00,0xff,0xff,0x86,0x3f,0xff,0xf8,0x3a,0xff,
-0xff,0x88,0x64,0x5a,0xf8,0x00,0x1a,0x00,0x00,0x01,0x00,0xf0,0x1a,0x06,0x10,0x00,
-0x00,0x55,0x01,0x4d,0x10,0x01,0x5f,0x80,0x89,0x59,0x0f,0xff,0xf8,0x73,0xb3,0xd0,
-0xff,0xff,0x83,0xa7,0x6c,0x1f,0xff,0xf8,0x86,0x94,0xd0,0x45,0x9f,0x80,0x5c,0x4b,
-0x00,0x00,0x97,0x03,0x2d,0x30,0xa6,0x05,0xf0,0x0e,0x40,0x00,0xbf,0xff,0xff,0xff,
-0xbf,0x45,0xff,0xff,0xff,0xf1,0x2f,0xfd,0x9f,0xff,0xec,0xfd,0x10,0x8f,0xfa,0x07,
-0x10,0x02,0xff,0x32,0x22,0x22,0x3f,0xac,0x00,0xf2,0x12,0xc0,0x00,0x58,0x00,0x00,
-0x0d,0xf1,0x00,0x05,0xff,0x80,0x01,0xef,0xff,0x20,0x9f,0xff,0xfc,0x0e,0xef,0xff,
-0xf1,0xe6,0xff,0xff,0x19,0xc6,0xdf,0xc0,0x09,0xff,0xb1,0x00,0x30,0x02,0xf3,0x2b,
-0xe5,0x00,0xaa,0xe5,0x0b,0xfb,0xe6,0xcf,0xfb,0xef,0xff,0xfb,0xed,0xff,0xfb,0xe5,
-0x8f,0xfb,0xe5,0x07,0xfb,0xb3,0x00,0x67,0xb9,0x10,0x00,0x00,0xff,0xe6,0x00,0x00,
-0xff,0xff,0xd3,0x00,0xff,0xff,0xff,0xa1,0xff,0xff,0xff,0xfc,0xff,0xff,0xff,0xd4,
-0xff,0xff,0xf8,0x00,0xff,0xfa,0x20,0x00,0xed,0x40,0x94,0x01,0xbd,0x10,0x01,0x10,
-0xdf,0xf4,0x5f,0xfc,0xff,0xf6,0x7f,0xfe,0x04,0x00,0xf0,0x00,0xf5,0x7f,0xfe,0x8c,
-0xb1,0x2b,0xc7,0x01,0x11,0x11,0x10,0xdf,0xff,0xff,0xfb,0x42,0x01,0x1e,0xff,0x04,
-0x00,0xf0,0x0f,0xfd,0x9c,0xcc,0xcc,0xc7,0x00,0x00,0x01,0xab,0x00,0x5e,0xbf,0xc0,
-0x5e,0xbf,0xfc,0x6e,0xbf,0xff,0xfe,0xbf,0xff,0xde,0xbf,0xf8,0x5e,0xbf,0x70,0x5e,
-0x76,0xfa,0x08,0x10,0x54,0x3c,0x01,0xe0,0xff,0x40,0x00,0x00,0x4f,0xff,0xf3,0x00,
-0x03,0xff,0xff,0xfe,0x20,0x0e,0xe2,0x00,0xf0,0x06,0x05,0x88,0x88,0x88,0x40,0x0d,
-0xee,0xee,0xee,0xb0,0x0f,0xff,0xff,0xff,0xd0,0x04,0x55,0x55,0x55,0x30,0x00,0xb7,
-0x02,0xf0,0x06,0xe0,0x00,0x7f,0x70,0x07,0xf7,0x00,0x5f,0x90,0x00,0x1c,0xe3,0x00,
-0x01,0xce,0x30,0x00,0x1c,0xe0,0x00,0x01,0x11,0x02,0x24,0x5e,0x20,0x12,0x00,0x14,
-0x1e,0x24,0x00,0x33,0x70,0x00,0x15,0x5b,0x02,0x60,0x0d,0xb0,0x00,0x00,0x0e,0xc0,
-0x04,0x00,0x00,0xeb,0x06,0x54,0xfc,0x8a,0xaf,0xea,0xa7,0x10,0x00,0x04,0xa5,0x01,
-0x01,0x18,0x00,0xf2,0x1c,0xaa,0xaa,0xa7,0x00,0x29,0xcc,0x93,0x00,0x00,0x7f,0x92,
-0x28,0xf8,0x00,0x6f,0xc0,0x4f,0x4a,0xf8,0x0e,0xf9,0x6e,0xfb,0x7f,0xf1,0x7f,0xb5,
-0xff,0x69,0xf9,0x00,0x9f,0x72,0x35,0xfb,0x00,0x00,0x5b,0xed,0xc5,0x00,0x00,0x0c,
-0x14,0x07,0x40,0x5f,0x86,0xbc,0xb6,0xbb,0x02,0xf2,0x15,0xf6,0x13,0xdd,0x20,0x00,
-0x05,0x1b,0xde,0xb3,0xfe,0x10,0x06,0xf9,0x07,0xff,0x3f,0xf8,0x00,0x1e,0xf3,0x04,
-0xea,0xff,0x20,0x00,0x3e,0xd1,0x02,0xcf,0x60,0x00,0x00,0x18,0xdd,0x60,0x9e,0x57,
-0x01,0x24,0x6e,0x10,0xf4,0x02,0x20,0x09,0xb0,0x06,0x00,0x30,0x4f,0xf6,0x00,0xc5,
-0x02,0x10,0xfe,0x26,0x02,0xf0,0x0e,0xf6,0x4f,0x80,0x00,0x00,0x0e,0xf5,0x3f,0xf2,
-0x00,0x00,0x8f,0xf6,0x4f,0xfa,0x00,0x02,0xff,0xfa,0x9f,0xff,0x30,0x0b,0xff,0xf7,
-0x5f,0xff,0xc0,0x0e,0xab,0x02,0x70,0xf0,0x00,0x22,0x22,0x22,0x22,0x10,0xc6,0x13,
-0xf0,0x13,0x02,0x31,0x00,0x16,0xf3,0xff,0xd1,0x2e,0xff,0xd3,0x4e,0x5d,0xd6,0xf3,
-0x00,0x1d,0xe1,0x03,0x00,0x0c,0xe5,0xa3,0xd1,0xff,0xf3,0x4f,0xff,0xd6,0x73,0x00,
-0x39,0xf6,0x00,0x00,0xfe,0x00,0xf3,0x17,0x06,0x50,0x00,0x00,0x6f,0xf5,0x00,0x06,
-0xf8,0xaf,0x50,0x6f,0x80,0x0a,0xf4,0x98,0x00,0x00,0xa8,0x65,0x00,0x00,0x65,0x9f,
-0x50,0x06,0xf7,0x0a,0xf5,0x6f,0x80,0x00,0xaf,0xf8,0x00,0x00,0x0a,0x80,0x91,0x00,
-0xf2,0x06,0x05,0xd2,0x02,0x22,0x21,0x00,0x4f,0xfe,0x3e,0xff,0xfe,0x00,0xa9,0xea,
-0x60,0x00,0x3e,0x00,0x03,0xe0,0x00,0x06,0x00,0x90,0x0a,0x9e,0xa5,0x03,0xfe,0xee,
-0xa5,0xff,0xe1,0xb4,0x07,0x13,0x6e,0xd7,0x06,0xad,0x8c,0xcb,0x10,0x00,0x0f,0xff,
-0xfd,0xaa,0xa6,0xff,0x01,0x00,0x02,0xa7,0x02,0xf2,0x08,0x01,0xa1,0x00,0x00,0x00,
-0x1d,0xfd,0x10,0x00,0x01,0xdf,0xff,0xd1,0x00,0x03,0x9d,0xfd,0x93,0x00,0x00,0x0a,
-0xfa,0x00,0x05,0x00,0xf0,0x00,0x89,0x88,0xf8,0x89,0x91,0xff,0xfc,0xbc,0xee,0xf2,
-0xff,0xff,0xff,0xac,0xf2,0x11,0x01,0xb0,0xb7,0x00,0x00,0x00,0x2f,0xff,0x00,0x00,
-0x00,0x6f,0xfd,0x0f,0x00,0xf3,0x09,0xf9,0x00,0x00,0x00,0x0c,0xf3,0x00,0x14,0x00,
-0x9f,0x90,0x09,0xff,0x6b,0xfc,0x00,0x0d,0xff,0xff,0xa0,0x00,0x0a,0xff,0xa3,0x0f,
-0x05,0xf8,0x25,0x03,0x10,0x00,0x00,0xaf,0xe1,0x05,0xe9,0xf5,0xe4,0x6f,0xe2,0x7f,
-0xfd,0xfe,0x20,0x00,0xcf,0xf3,0x00,0x4d,0xff,0xf9,0x00,0xe7,0xe5,0xaf,0x90,0xe8,
-0xe3,0x0b,0xf8,0x3b,0x70,0x00,0x63,0x00,0xaf,0xfa,0x91,0x22,0xcf,0xfa,0x89,0xfb,
-0xcf,0xfe,0xa9,0xfb,0xcf,0xff,0xfe,0x04,0x00,0xf0,0x00,0xfd,0x57,0x77,0x75,0xff,
-0xff,0xfa,0x00,0x12,0x22,0x20,0x00,0x02,0x22,0x22,0x02,0x02,0x82,0x90,0xf2,0x00,
-0x05,0xf8,0xf2,0x00,0x05,0xc0,0x02,0xf0,0x00,0xf5,0x6f,0xfe,0xff,0xd0,0x0f,0xfe,
-0xff,0xf8,0x9f,0xfe,0x9c,0xcc,0xcc,0xc8,0x22,0x02,0x40,0x45,0x55,0x55,0x54,0xfb,
-0x00,0x00,0xdc,0x02,0x80,0x34,0x44,0x44,0x43,0x23,0x33,0x33,0x32,0x0c,0x00,0x90,
-0x11,0x11,0x11,0x10,0x8c,0xcc,0xcc,0xcc,0x8e,0x39,0x00,0xd1,0x5c,0xff,0xff,0xfc,
-0x5f,0x88,0xff,0xf8,0x8f,0xff,0xc5,0xa6,0xcf,0x1d,0x03,0x01,0x0f,0x01,0xf0,0x0c,
-0x06,0xff,0xc0,0x00,0x9f,0xf9,0x00,0x0b,0xff,0x62,0x00,0xdf,0xff,0xf7,0x0f,0xff,
-0xfe,0x10,0x11,0xaf,0x60,0x00,0x0d,0xd0,0x00,0x01,0xf4,0x41,0x08,0x00,0x01,0x00,
-0xf0,0x13,0x45,0xb9,0x52,0x00,0xff,0x8d,0xfa,0x00,0xff,0xd9,0x96,0x00,0xff,0x6e,
-0xe9,0x91,0xff,0x7f,0xfb,0x77,0xff,0x7f,0xff,0xed,0xff,0x7f,0xff,0xfe,0x45,0x4f,
-0xff,0xfe,0x00,0x2f,0xa9,0x04,0x03,0xbf,0x05,0xa0,0x8f,0xe7,0x00,0x08,0xff,0xff,
-0x60,0x0d,0xff,0xff,0x25,0x03,0xf1,0x01,0xd0,0x2f,0xff,0xff,0xf1,0xcf,0xff,0xff,
-0xfa,0x57,0x77,0x77,0x74,0x00,0x1e,0xd0,0x27,0x00,0x10,0xbf,0x9c,0x00,0xf4,0x0c,
-0x0f,0x4b,0x3a,0xa3,0xa3,0xf2,0xfa,0xd9,0xdd,0x9d,0x9f,0x2f,0xf0,0xa3,0x3a,0x0d,
-0xf2,0xfc,0xcb,0x9a,0xbc,0xcf,0x2f,0x4a,0x22,0x22,0xa2,0xfb,0x04,0x04,0x01,0x00,
-0xe0,0x3a,0xa0,0x00,0x00,0x04,0xbf,0xfd,0x00,0x00,0x5d,0xff,0xff,0x60,0x06,0x16,
-0x0a,0x00,0x16,0x01,0x60,0xf7,0x00,0x01,0x33,0x3f,0xff,0x4b,0x03,0x10,0xff,0x2b,
-0x02,0x20,0x1f,0xf1,0x2b,0x00,0x14,0xe9,0x34,0x00,0xb2,0xde,0xed,0x63,0x0f,0xff,
-0xf8,0xf3,0xff,0xff,0x47,0x5f,0x49,0x04,0x19,0xcf,0x07,0x00,0xf0,0x0f,0xb1,0x22,
-0x22,0x20,0x00,0x00,0x24,0x31,0x00,0x00,0x02,0xaf,0xff,0xff,0xb4,0x00,0x7f,0xd7,
-0x31,0x25,0xbf,0xa0,0x98,0x01,0x57,0x62,0x05,0xc1,0x00,0x7f,0xd2,0x01,0x50,0x00,
-0xa9,0x10,0x07,0xc1,0x45,0x0f,0x01,0x53,0x03,0x21,0x6f,0xa0,0x8b,0x02,0x62,0x10,
-0x00,0x00,0x12,0x22,0x22,0x96,0x01,0xa0,0xff,0xff,0x90,0xf4,0x88,0x88,0x88,0x77,
-0xf2,0xf7,0x03,0x03,0xfc,0x03,0xe3,0xf5,0xaa,0xaa,0xaa,0x97,0xf3,0xee,0xee,0xee,
-0xee,0xef,0xb0,0x13,0x33,0x33,0x33,0x33,0x2a,0x00,0x20,0x82,0x07,0x2a,0x00,0x20,
-0xf4,0x00,0x2a,0x00,0x2f,0xa2,0x07,0x2a,0x00,0x08,0x20,0x84,0x00,0x2a,0x00,0x20,
-0xf9,0x00,0x2a,0x00,0x2f,0xa6,0x00,0x2a,0x00,0x08,0x20,0x87,0x00,0x2a,0x00,0x20,
-0xfe,0x00,0x2a,0x00,0x2f,0xa9,0x00,0x2a,0x00,0x08,0x20,0xf2,0x00,0x2a,0x00,0x20,
-0xf2,0x00,0x2a,0x00,0x02,0x0c,0x00,0x01,0x2a,0x00,0x11,0xa0,0x2a,0x00,0x00,0x7f,
-0x0b,0x01,0x85,0x09,0xf1,0x0b,0xa8,0xf5,0x00,0x00,0x48,0x05,0x50,0x00,0x03,0x00,
-0xff,0xcd,0xaa,0xaa,0xad,0xd1,0x8c,0x20,0x37,0x00,0x06,0x30,0x00,0x00,0x09,0x4d,
-0xfd,0x00,0x24,0x7f,0xc0,0x5c,0x01,0xf0,0x14,0x7b,0xca,0x20,0x08,0xfe,0x6f,0xd0,
-0x0f,0xde,0x27,0xf4,0x2f,0x96,0x45,0xf6,0x3f,0xf7,0x1f,0xf7,0x3f,0xd3,0x28,0xf7,
-0x1f,0x8d,0x54,0xf5,0x0b,0xff,0x2e,0xf1,0x01,0xcf,0xee,0x50,0x0c,0x03,0xf6,0x04,
-0x56,0x9e,0xd8,0x64,0x9a,0xaa,0xaa,0xa8,0x5d,0xdd,0xdd,0xd4,0x7f,0xac,0xda,0xf5,
-0x7f,0x7a,0xc7,0x04,0x00,0x82,0x8a,0xc7,0xf5,0x4f,0xff,0xff,0xf3,0x01,0x38,0x04,
-0x20,0x08,0xa0,0x74,0x04,0xf2,0x05,0xfb,0x00,0x00,0x09,0xc7,0xfc,0x00,0x00,0x9f,
-0xfc,0x61,0x00,0x09,0xff,0xfc,0x10,0x00,0x9f,0xff,0xc1,0x09,0x00,0x70,0x0d,0xff,
-0xc1,0x00,0x00,0x0f,0xfc,0xa6,0x10,0x01,0x82,0x00,0xfc,0x25,0x2b,0xcc,0xcc,0xcc,
-0xa0,0x03,0xef,0xfd,0xfe,0xef,0xf3,0x3e,0xff,0xe0,0x82,0x7f,0xf4,0xef,0xff,0xfb,
-0x03,0xff,0xf4,0x6f,0xff,0xf2,0x40,0x9f,0xf4,0x06,0xff,0xf9,0xfc,0xbf,0xf3,0x00,
-0x5f,0xff,0xff,0xff,0xe1,0x03,0xef,0xff,0x63,0xe5,0x7a,0x7b,0xff,0x36,0x96,0xcf,
-0x07,0x02,0x85,0xfb,0xcf,0xff,0xff,0x80,0x12,0x22,0x10,0xed,0x07,0xb0,0xc0,0x04,
-0xc0,0x00,0x05,0xf0,0x5f,0xe7,0x77,0x7a,0xf0,0x81,0x02,0x31,0xe0,0x0c,0xd0,0xb0,
-0x19,0x1b,0x00,0x01,0x00,0x2f,0xfd,0x00,0x01,0x00,0x03,0x1b,0xf8,0x08,0x00,0x00,
-0x01,0x00,0x73,0xfc,0xfc,0x00,0xff,0xfc,0x00,0xfa,0xf0,0x05,0x0c,0x01,0x00,0x4e,
-0x01,0x01,0x00,0x02,0x16,0x00,0x2f,0xf4,0x00,0x01,0x00,0x15,0x1e,0xf0,0x1e,0x00,
-0x0e,0x90,0x00,0xb2,0xfc,0x00,0xff,0x00,0x00,0xf7,0xff,0xfa,0xfb,0x00,0xf9,0x11,
-0x00,0x10,0xff,0x28,0x04,0x2d,0xfc,0xfe,0x92,0x00,0x30,0xfe,0x00,0xfe,0x2e,0x00,
-0x1e,0x00,0x01,0x00,0x1c,0xfe,0x0a,0x00,0x19,0xff,0x1f,0x00,0x03,0x0e,0x00,0x13,
-0xf9,0x0b,0x00,0x10,0xfe,0x02,0x00,0x2f,0xfd,0xfe,0x9c,0x00,0x0a,0x15,0x01,0x3c,
-0x00,0x11,0xff,0x34,0x00,0x39,0xff,0xfe,0xfe,0xd6,0x00,0x35,0xf4,0x00,0xed,0x24,
-0x00,0x40,0xfe,0xff,0x00,0x00,0x0e,0x04,0x2e,0xfe,0xfe,0x44,0x00,0x10,0xfe,0x08,
-0x00,0x0f,0x6b,0x00,0x08,0x1f,0xfe,0x43,0x01,0x0d,0x1b,0xfc,0x25,0x00,0x12,0xfe,
-0x67,0x00,0x22,0xfe,0xfd,0x09,0x01,0x14,0xe8,0x6c,0x00,0x97,0xfb,0x00,0x00,0xed,
-0xfc,0xf4,0xf6,0x00,0xef,0x08,0x02,0x25,0xf7,0xfa,0x0c,0x00,0x00,0x77,0x04,0x35,
-0xf6,0x00,0xf2,0x48,0x01,0x21,0xff,0xff,0x0c,0x01,0x1f,0x01,0xf7,0x01,0x01,0x10,
-0xfd,0xd2,0x00,0x0f,0x99,0x00,0x0c,0x3e,0xfa,0x00,0xff,0x69,0x02,0x03,0x12,0x00,
-0xb1,0xf1,0xf0,0x00,0x00,0xfa,0xfe,0xef,0xff,0x01,0x00,0x01,0x60,0x00,0xd3,0xf8,
-0xf9,0x00,0xf8,0xf9,0xfb,0xf8,0x00,0xf9,0xfb,0xfc,0xfb,0xfc,0x1a,0x01,0x66,0xf0,
-0xfd,0x00,0x00,0xfb,0xff,0x2b,0x01,0x50,0xfd,0xfd,0x00,0x00,0xfd,0x44,0x01,0x01,
-0x30,0x05,0x02,0x24,0x00,0x22,0xf7,0xfc,0x51,0x00,0x13,0x01,0x24,0x00,0x23,0xfe,
-0xfe,0x6c,0x01,0x08,0xa1,0x01,0x14,0xfd,0x20,0x01,0x15,0x01,0x51,0x01,0x02,0xb0,
-0x01,0x04,0x30,0x01,0xe0,0x01,0xfd,0xf1,0xfc,0x00,0x00,0xf9,0xfe,0xf9,0xff,0x01,
-0xf9,0x01,0x01,0x92,0x00,0xe6,0xfb,0xfb,0xfe,0xfd,0xfb,0xfd,0xfc,0xfe,0xfd,0xff,
-0x00,0xfe,0xfe,0x01,0xc5,0x00,0x2a,0x01,0xfe,0x34,0x02,0x0c,0xf8,0x01,0x09,0x19,
-0x00,0x1e,0x00,0x01,0x00,0x1f,0xfb,0x31,0x01,0x09,0x1f,0xff,0xf0,0x01,0x10,0x11,
-0xff,0x97,0x01,0x0e,0x5f,0x00,0x0f,0x4f,0x00,0x07,0x0f,0x1d,0x00,0x0a,0x1e,0x01,
-0xdd,0x01,0x19,0x01,0x81,0x00,0x12,0x01,0x14,0x03,0x0f,0x01,0x00,0x22,0x0b,0x81,
-0x00,0x1f,0xf6,0xd8,0x00,0x10,0x00,0x8e,0x00,0x1c,0xf7,0x31,0x02,0x20,0xff,0x01,
-0x4b,0x00,0x10,0x04,0x2b,0x02,0x0f,0x6f,0x00,0x15,0x1b,0x01,0xc4,0x04,0x02,0xa7,
-0x03,0x1d,0x01,0x14,0x01,0x1f,0xf7,0xd8,0x00,0x24,0x1f,0xff,0x24,0x00,0x26,0x0f,
-0x3d,0x00,0x07,0x03,0x49,0x05,0x30,0x02,0x03,0x00,0xed,0x00,0x2d,0x04,0x05,0x21,
-0x00,0xf1,0x0c,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,
-0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,
-0x80,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x27,0x12,0xff,0x01,0x1f,0x1f,0x21,
-0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x00,0x01,0x00,0x5e,
-0x02,0xce,0x00,0x20,0x03,0x02,0xc9,0x00,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x70,
-0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xa0,0x0b,
-0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x5f,0x0b,0x00,0x9c,0x13,0x52,0x17,
-0x17,0x17,0x18,0x17,0x59,0x11,0xff,0x01,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,
-0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x8f,0x00,0x1e,0x1f,0x24,0xc8,0x00,0x25,
-0x50,0x00,0x00,0x00,0x00,0x00,
+0x0b,0x40,0x5d,0xcd,0x50,0x00,0x01,0x00,0xf3,0x38,0x03,0xdf,0xd4,0x10,0x05,0xa2,
+0xe2,0xa7,0x00,0xb1,0x01,0x01,0xb1,0x2b,0x00,0x00,0x0a,0x20,0xd1,0x00,0x00,0xc2,
+0x06,0xa1,0x01,0x89,0x00,0x06,0xaa,0xb8,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x20,
+0x00,0x00,0x00,0x8d,0xcc,0xc6,0x00,0x2d,0x0a,0x70,0x97,0x00,0xdb,0x5b,0x00,0xc1,
+0x0c,0x4a,0x00,0x09,0x30,0xc0,0x00,0x00,0xc1,0x04,0xa0,0x00,0x88,0x00,0x05,0xcc,
+0xd7,0x4e,0x00,0xf2,0x0b,0x33,0x33,0x20,0x3f,0xbb,0xd8,0x09,0x80,0x0b,0x10,0xa5,
+0x07,0x80,0x3c,0x98,0x60,0x0b,0x47,0xaa,0x00,0xa4,0x04,0x90,0x02,0xcc,0xb1,0x20,
+0x00,0xf3,0x0b,0x46,0x40,0x02,0x4c,0xfd,0x52,0x83,0x33,0x22,0x88,0x0c,0xcb,0x08,
+0x80,0x22,0x20,0x88,0x09,0x98,0x08,0x88,0x88,0x87,0x70,0x0b,0xfb,0x41,0x00,0xf2,
+0x6f,0x12,0x04,0x02,0xbf,0xeb,0xb8,0xe7,0x00,0x08,0x07,0x70,0x00,0x80,0x09,0x30,
+0x08,0x2b,0x10,0x00,0xb7,0xd7,0x00,0x03,0x02,0xbf,0xeb,0x00,0x00,0x12,0x00,0x13,
+0x33,0x33,0x18,0x8f,0x44,0x68,0x81,0x53,0xef,0xa8,0x5f,0x05,0xa9,0x81,0x60,0x00,
+0x78,0x4e,0x00,0x07,0x83,0xb0,0x00,0x78,0xaf,0x87,0x78,0x00,0x17,0x97,0x00,0x00,
+0x3e,0x7e,0x7c,0x10,0x0d,0x30,0xd2,0x3b,0x02,0xb0,0x0c,0x10,0xc0,0x39,0x1a,0x3b,
+0x5b,0x00,0xda,0x83,0x79,0xd0,0x06,0xe3,0x00,0xb4,0x00,0x05,0xcc,0xb4,0x00,0x08,
+0x80,0x00,0x00,0x94,0x4a,0x00,0x00,0xb0,0x0b,0x4b,0x80,0xa3,0x3a,0xef,0xf4,0x1e,
+0xfa,0xef,0xf2,0x85,0x8f,0xff,0xb0,0xb3,0xff,0xff,0xf2,0xed,0xee,0xee,0xe4,0x84,
+0x00,0x10,0x2a,0x05,0x00,0xf0,0x05,0x3a,0x00,0x00,0xcc,0xcc,0xec,0x10,0x07,0x99,
+0x99,0x97,0x00,0x1d,0xec,0xdd,0xd0,0x00,0x1b,0x30,0x00,0x1e,0x01,0x03,0xa8,0x00,
+0xf2,0x26,0x01,0x86,0x10,0x00,0x00,0x17,0x68,0x70,0x00,0x00,0x36,0x94,0x00,0x00,
+0x17,0xa2,0x00,0x01,0x95,0x69,0x10,0x00,0xd5,0x98,0x7b,0x00,0x0c,0x68,0x77,0xa0,
+0x00,0x1a,0x77,0x90,0x00,0x0a,0xaa,0x91,0x02,0xa2,0x28,0xc1,0x29,0x00,0xc9,0xa2,
+0x90,0x00,0x0b,0x29,0x00,0x00,0xb2,0x07,0x00,0xf2,0x19,0xb1,0xeb,0xbb,0xbb,0x00,
+0x37,0x30,0x00,0x00,0x37,0x17,0x85,0x00,0x08,0x00,0x02,0x45,0x01,0x90,0x26,0xb2,
+0x80,0x62,0xaa,0x82,0x09,0x06,0x10,0x5e,0x00,0x71,0x27,0x07,0x93,0x07,0x00,0x58,
+0x88,0x88,0x60,0x24,0x02,0xf2,0x0e,0x00,0xb3,0x80,0x00,0x32,0x3e,0x88,0x00,0x6a,
+0x8b,0x2b,0x20,0x0b,0x00,0x7b,0xc0,0x00,0xa0,0x00,0xb3,0x00,0x37,0x00,0x0b,0x30,
+0x04,0x60,0x00,0xb3,0x8c,0x00,0xf1,0x26,0x19,0x56,0x39,0x19,0x50,0x2c,0x10,0xa2,
+0x07,0xb0,0xd0,0x1c,0x8c,0x70,0x57,0x0a,0x50,0x94,0x00,0xc2,0x5c,0xcb,0x10,0x00,
+0x07,0x60,0x00,0x05,0x70,0x00,0x05,0x70,0x7c,0xcd,0xd0,0x5d,0x40,0x02,0xb0,0x05,
+0xe0,0x58,0x93,0x93,0x57,0x9c,0xcf,0x90,0x00,0xc1,0x00,0x0c,0x10,0x05,0x00,0xe0,
+0x3c,0xcc,0x62,0x40,0x0d,0x49,0x00,0xd4,0x90,0x0d,0x49,0x00,0xd0,0x39,0x01,0x00,
+0xf2,0x03,0x40,0x06,0xc9,0x0c,0x10,0xc0,0x1c,0x01,0xc0,0x3e,0xbc,0x80,0x39,0x00,
+0xb1,0x39,0x00,0x93,0x03,0x00,0xf0,0x05,0x48,0x1b,0xc0,0x48,0x00,0x85,0x48,0x00,
+0x75,0x3a,0x00,0xb2,0x09,0xcc,0x70,0x39,0x39,0x37,0x9c,0xc7,0x17,0x08,0x44,0x0b,
+0x10,0x00,0xb1,0x05,0x00,0xe0,0x7b,0xc6,0x00,0x00,0xc1,0x00,0x09,0x30,0x00,0xc1,
+0x7b,0xc6,0x00,0x81,0x16,0x00,0xf2,0x1f,0x8c,0xcc,0x10,0x00,0x84,0x00,0x0a,0x20,
+0x05,0xb0,0x0a,0xb0,0x01,0x40,0x00,0x3e,0xcc,0xa0,0x39,0x00,0x84,0x39,0x00,0x66,
+0x39,0x00,0x66,0x3e,0xcc,0xd6,0x68,0xac,0xb0,0x0d,0x50,0x85,0x0d,0x00,0x57,0x49,
+0x00,0x57,0x85,0x2c,0xd7,0x39,0x01,0x00,0xf1,0x1e,0x5d,0x60,0x1b,0x00,0xc0,0x0c,
+0x8c,0xc0,0x9e,0xcc,0xb0,0x48,0x00,0x95,0x67,0x00,0x76,0x4a,0x00,0xb3,0x09,0xcc,
+0x70,0x58,0x01,0xc0,0xd0,0x2a,0x08,0x55,0x70,0x1c,0xc1,0xad,0xa2,0x00,0x6d,0xcc,
+0x46,0x60,0x1c,0x5c,0x50,0xd0,0x00,0x9b,0x08,0x00,0x05,0x00,0xf5,0x07,0x6d,0xcc,
+0x46,0x70,0x1d,0x5c,0x60,0xd0,0x00,0x1c,0x3c,0xbc,0x30,0xa5,0x09,0x41,0xc0,0xb1,
+0x0a,0x9a,0x00,0x96,0xeb,0x06,0xf9,0x10,0x87,0x08,0x40,0xb4,0xb2,0x01,0xd7,0x00,
+0x02,0xc0,0x7c,0xce,0x70,0x5c,0xbc,0x50,0x10,0x1c,0x39,0x02,0xa3,0x90,0xa4,0x39,
+0xa7,0x03,0x92,0x00,0x39,0x00,0x00,0xcc,0x00,0xf0,0x29,0xa2,0x1b,0x0b,0x17,0x63,
+0x90,0xd0,0x4c,0xc4,0x0c,0x01,0xd0,0x07,0x80,0x0d,0xdc,0x90,0x00,0x8f,0xcb,0xb1,
+0x0c,0x00,0x76,0x0c,0x00,0x57,0x0d,0x00,0x58,0x98,0x00,0x58,0x08,0x69,0x50,0xb1,
+0xc0,0x0a,0x0a,0x00,0x3e,0x33,0xe3,0x66,0x10,0x00,0x49,0x91,0x16,0xa7,0x05,0x40,
+0x00,0x6a,0xaa,0x8b,0x01,0xf0,0x06,0x15,0xaa,0x00,0x02,0x7c,0xff,0xfe,0x00,0x0e,
+0xff,0xfe,0xbe,0x00,0x0e,0xd8,0x30,0x3e,0x00,0x0e,0x30,0x00,0x05,0x00,0xe0,0x01,
+0x6e,0x00,0x1e,0x30,0x4f,0xfe,0x0d,0xff,0x30,0x2d,0xf8,0x0d,0xfd,0xd8,0x01,0x00,
+0x04,0x00,0xf0,0x31,0x75,0xcc,0xcc,0xc6,0x7c,0x8a,0x11,0x18,0xab,0xca,0x90,0x00,
+0x7b,0xc9,0x4f,0xcc,0xce,0x79,0xdb,0xa0,0x00,0x7c,0xda,0x59,0x00,0x07,0x7a,0xb9,
+0xfd,0xdd,0xea,0xb0,0x34,0x23,0x44,0x44,0x3f,0xf9,0xcf,0xff,0xff,0xef,0x8b,0xff,
+0xff,0xe7,0x84,0x68,0x88,0x87,0xff,0xad,0xff,0xff,0xf8,0x94,0x69,0x99,0x98,0xde,
+0x8a,0xee,0xee,0xdf,0x1b,0x00,0x40,0x45,0x23,0x55,0x55,0x10,0x04,0xf5,0x77,0x07,
+0x50,0x00,0x00,0x07,0xfd,0x23,0x00,0x07,0xfe,0x2d,0xf4,0x07,0xfe,0x20,0x5f,0xfa,
+0xfe,0x20,0x00,0x5f,0xfe,0x20,0x00,0x00,0x4d,0x20,0x00,0x00,0x21,0x00,0x02,0x0e,
+0xe2,0x0c,0xf1,0x5f,0xec,0xf8,0x00,0x6f,0xf9,0x00,0x0c,0xff,0xe2,0x0c,0xf8,0x5f,
+0xe0,0x98,0x00,0x5b,0x00,0x00,0x02,0xd2,0x00,0x00,0x7b,0x3f,0x3b,0x70,0x4f,0x73,
+0xf3,0x8f,0x4a,0xc0,0x3f,0x30,0xca,0xd9,0x03,0xf3,0x09,0xdb,0xb0,0x02,0x00,0xbc,
+0x6f,0x40,0x00,0x4f,0x60,0xbf,0xa7,0xaf,0xb0,0x00,0x7d,0xfd,0x70,0x00,0x00,0x06,
+0xb6,0x00,0x00,0x31,0xcf,0xc1,0x30,0x4f,0xff,0xff,0xff,0x47,0xff,0xb4,0xbf,0xf7,
+0x0d,0xf2,0x02,0xfd,0x04,0xff,0x70,0x7f,0xf4,0x6f,0xff,0xff,0xff,0x60,0x75,0xef,
+0xe5,0x70,0x00,0x08,0xf8,0x58,0x04,0xf0,0x1e,0x01,0x00,0x00,0x00,0x2d,0xe3,0xd9,
+0x00,0x00,0x4e,0x97,0xff,0x90,0x00,0x6f,0x7b,0xc6,0xfb,0x00,0x9e,0x6d,0xff,0xe6,
+0xdb,0x07,0x4e,0xff,0xff,0xf5,0x80,0x05,0xff,0xa9,0xff,0x70,0x00,0x5f,0xf3,0x1f,
+0xf7,0x00,0x03,0xcc,0x20,0xcc,0x8f,0x04,0x10,0x9c,0xc5,0x00,0x23,0xdf,0x60,0x05,
+0x00,0xf0,0x47,0x58,0xef,0xb7,0x10,0x00,0x4f,0xff,0xfc,0x00,0x00,0x04,0xff,0xc0,
+0x00,0x19,0xa9,0x7c,0x6a,0xa6,0x3f,0xff,0xfc,0xfe,0xec,0x2f,0xff,0xff,0xfc,0xbb,
+0x01,0xdf,0xff,0xfe,0x20,0x00,0xba,0x22,0x22,0x8c,0x00,0x5f,0x10,0x00,0x00,0xe7,
+0x0e,0xb6,0x30,0x02,0x6a,0xf0,0xff,0xfe,0x44,0xdf,0xff,0x2f,0xff,0xff,0xff,0xff,
+0xf2,0xcf,0xff,0xff,0xff,0xfe,0x00,0x00,0x5b,0xda,0x43,0xd0,0x9f,0xa7,0xaf,0xbf,
+0x5f,0x40,0x04,0x7f,0xf9,0x90,0x00,0xde,0xee,0x99,0x00,0xf1,0x02,0x0f,0xff,0xe0,
+0x00,0x9a,0xff,0x74,0x00,0x3f,0x5f,0xdf,0x85,0x8f,0xa0,0xf3,0x6c,0xfd,0xe2,0x09,
+0xf1,0x01,0x15,0xf8,0xff,0xff,0x8f,0xff,0xf8,0xff,0xff,0x84,0x59,0xf8,0x00,0x09,
+0x70,0x00,0xf6,0x09,0xf2,0x02,0x05,0xf8,0x00,0xff,0xff,0x86,0x3f,0xff,0xf8,0x3a,
+0xff,0xff,0x88,0x64,0x5a,0xf8,0x00,0x1a,0x00,0x00,0x01,0x00,0xf0,0x1a,0x06,0x10,
+0x00,0x00,0x55,0x01,0x4d,0x10,0x01,0x5f,0x80,0x89,0x59,0x0f,0xff,0xf8,0x73,0xb3,
+0xd0,0xff,0xff,0x83,0xa7,0x6c,0x1f,0xff,0xf8,0x86,0x94,0xd0,0x45,0x9f,0x80,0x5c,
+0x4b,0x00,0x00,0x97,0x03,0x2d,0x30,0xa6,0x05,0xf0,0x0e,0x40,0x00,0xbf,0xff,0xff,
+0xff,0xbf,0x45,0xff,0xff,0xff,0xf1,0x2f,0xfd,0x9f,0xff,0xec,0xfd,0x10,0x8f,0xfa,
+0x07,0x10,0x02,0xff,0x32,0x22,0x22,0x3f,0xac,0x00,0xf2,0x12,0xc0,0x00,0x58,0x00,
+0x00,0x0d,0xf1,0x00,0x05,0xff,0x80,0x01,0xef,0xff,0x20,0x9f,0xff,0xfc,0x0e,0xef,
+0xff,0xf1,0xe6,0xff,0xff,0x19,0xc6,0xdf,0xc0,0x09,0xff,0xb1,0x00,0x30,0x02,0xf3,
+0x2b,0xe5,0x00,0xaa,0xe5,0x0b,0xfb,0xe6,0xcf,0xfb,0xef,0xff,0xfb,0xed,0xff,0xfb,
+0xe5,0x8f,0xfb,0xe5,0x07,0xfb,0xb3,0x00,0x67,0xb9,0x10,0x00,0x00,0xff,0xe6,0x00,
+0x00,0xff,0xff,0xd3,0x00,0xff,0xff,0xff,0xa1,0xff,0xff,0xff,0xfc,0xff,0xff,0xff,
+0xd4,0xff,0xff,0xf8,0x00,0xff,0xfa,0x20,0x00,0xed,0x40,0x94,0x01,0xbd,0x10,0x01,
+0x10,0xdf,0xf4,0x5f,0xfc,0xff,0xf6,0x7f,0xfe,0x04,0x00,0xf0,0x00,0xf5,0x7f,0xfe,
+0x8c,0xb1,0x2b,0xc7,0x01,0x11,0x11,0x10,0xdf,0xff,0xff,0xfb,0x42,0x01,0x1e,0xff,
+0x04,0x00,0xf0,0x0f,0xfd,0x9c,0xcc,0xcc,0xc7,0x00,0x00,0x01,0xab,0x00,0x5e,0xbf,
+0xc0,0x5e,0xbf,0xfc,0x6e,0xbf,0xff,0xfe,0xbf,0xff,0xde,0xbf,0xf8,0x5e,0xbf,0x70,
+0x5e,0x76,0xfa,0x08,0x10,0x54,0x3c,0x01,0xe0,0xff,0x40,0x00,0x00,0x4f,0xff,0xf3,
+0x00,0x03,0xff,0xff,0xfe,0x20,0x0e,0xe2,0x00,0xf0,0x06,0x05,0x88,0x88,0x88,0x40,
+0x0d,0xee,0xee,0xee,0xb0,0x0f,0xff,0xff,0xff,0xd0,0x04,0x55,0x55,0x55,0x30,0x00,
+0xb7,0x02,0xf0,0x06,0xe0,0x00,0x7f,0x70,0x07,0xf7,0x00,0x5f,0x90,0x00,0x1c,0xe3,
+0x00,0x01,0xce,0x30,0x00,0x1c,0xe0,0x00,0x01,0x11,0x02,0x24,0x5e,0x20,0x12,0x00,
+0x14,0x1e,0x24,0x00,0x33,0x70,0x00,0x15,0x5b,0x02,0x60,0x0d,0xb0,0x00,0x00,0x0e,
+0xc0,0x04,0x00,0x00,0xeb,0x06,0x54,0xfc,0x8a,0xaf,0xea,0xa7,0x10,0x00,0x04,0xa5,
+0x01,0x01,0x18,0x00,0xf2,0x1c,0xaa,0xaa,0xa7,0x00,0x29,0xcc,0x93,0x00,0x00,0x7f,
+0x92,0x28,0xf8,0x00,0x6f,0xc0,0x4f,0x4a,0xf8,0x0e,0xf9,0x6e,0xfb,0x7f,0xf1,0x7f,
+0xb5,0xff,0x69,0xf9,0x00,0x9f,0x72,0x35,0xfb,0x00,0x00,0x5b,0xed,0xc5,0x00,0x00,
+0x0c,0x14,0x07,0x40,0x5f,0x86,0xbc,0xb6,0xbb,0x02,0xf2,0x15,0xf6,0x13,0xdd,0x20,
+0x00,0x05,0x1b,0xde,0xb3,0xfe,0x10,0x06,0xf9,0x07,0xff,0x3f,0xf8,0x00,0x1e,0xf3,
+0x04,0xea,0xff,0x20,0x00,0x3e,0xd1,0x02,0xcf,0x60,0x00,0x00,0x18,0xdd,0x60,0x9e,
+0x57,0x01,0x24,0x6e,0x10,0xf4,0x02,0x20,0x09,0xb0,0x06,0x00,0x30,0x4f,0xf6,0x00,
+0xc5,0x02,0x10,0xfe,0x26,0x02,0xf0,0x0e,0xf6,0x4f,0x80,0x00,0x00,0x0e,0xf5,0x3f,
+0xf2,0x00,0x00,0x8f,0xf6,0x4f,0xfa,0x00,0x02,0xff,0xfa,0x9f,0xff,0x30,0x0b,0xff,
+0xf7,0x5f,0xff,0xc0,0x0e,0xab,0x02,0x60,0xf0,0x00,0x22,0x22,0x22,0x22,0x42,0x00,
+0xf0,0x14,0x02,0x02,0x31,0x00,0x16,0xf3,0xff,0xd1,0x2e,0xff,0xd3,0x4e,0x5d,0xd6,
+0xf3,0x00,0x1d,0xe1,0x03,0x00,0x0c,0xe5,0xa3,0xd1,0xff,0xf3,0x4f,0xff,0xd6,0x73,
+0x00,0x39,0xf6,0x00,0x00,0xfe,0x00,0xf3,0x17,0x06,0x50,0x00,0x00,0x6f,0xf5,0x00,
+0x06,0xf8,0xaf,0x50,0x6f,0x80,0x0a,0xf4,0x98,0x00,0x00,0xa8,0x65,0x00,0x00,0x65,
+0x9f,0x50,0x06,0xf7,0x0a,0xf5,0x6f,0x80,0x00,0xaf,0xf8,0x00,0x00,0x0a,0x80,0x91,
+0x00,0xf2,0x06,0x05,0xd2,0x02,0x22,0x21,0x00,0x4f,0xfe,0x3e,0xff,0xfe,0x00,0xa9,
+0xea,0x60,0x00,0x3e,0x00,0x03,0xe0,0x00,0x06,0x00,0x90,0x0a,0x9e,0xa5,0x03,0xfe,
+0xee,0xa5,0xff,0xe1,0xb4,0x07,0x13,0x6e,0xd7,0x06,0xad,0x8c,0xcb,0x10,0x00,0x0f,
+0xff,0xfd,0xaa,0xa6,0xff,0x01,0x00,0x02,0xa7,0x02,0xf2,0x08,0x01,0xa1,0x00,0x00,
+0x00,0x1d,0xfd,0x10,0x00,0x01,0xdf,0xff,0xd1,0x00,0x03,0x9d,0xfd,0x93,0x00,0x00,
+0x0a,0xfa,0x00,0x05,0x00,0xf0,0x00,0x89,0x88,0xf8,0x89,0x91,0xff,0xfc,0xbc,0xee,
+0xf2,0xff,0xff,0xff,0xac,0xf2,0x11,0x01,0xb0,0xb7,0x00,0x00,0x00,0x2f,0xff,0x00,
+0x00,0x00,0x6f,0xfd,0x0f,0x00,0xf3,0x09,0xf9,0x00,0x00,0x00,0x0c,0xf3,0x00,0x14,
+0x00,0x9f,0x90,0x09,0xff,0x6b,0xfc,0x00,0x0d,0xff,0xff,0xa0,0x00,0x0a,0xff,0xa3,
+0x0f,0x05,0xf8,0x25,0x03,0x10,0x00,0x00,0xaf,0xe1,0x05,0xe9,0xf5,0xe4,0x6f,0xe2,
+0x7f,0xfd,0xfe,0x20,0x00,0xcf,0xf3,0x00,0x4d,0xff,0xf9,0x00,0xe7,0xe5,0xaf,0x90,
+0xe8,0xe3,0x0b,0xf8,0x3b,0x70,0x00,0x63,0x00,0xaf,0xfa,0x91,0x22,0xcf,0xfa,0x89,
+0xfb,0xcf,0xfe,0xa9,0xfb,0xcf,0xff,0xfe,0x04,0x00,0xf0,0x00,0xfd,0x57,0x77,0x75,
+0xff,0xff,0xfa,0x00,0x12,0x22,0x20,0x00,0x02,0x22,0x22,0x02,0x02,0x82,0x90,0xf2,
+0x00,0x05,0xf8,0xf2,0x00,0x05,0xc0,0x02,0xf0,0x00,0xf5,0x6f,0xfe,0xff,0xd0,0x0f,
+0xfe,0xff,0xf8,0x9f,0xfe,0x9c,0xcc,0xcc,0xc8,0x22,0x02,0x40,0x45,0x55,0x55,0x54,
+0xfb,0x00,0x00,0xdc,0x02,0x80,0x34,0x44,0x44,0x43,0x23,0x33,0x33,0x32,0x0c,0x00,
+0x90,0x11,0x11,0x11,0x10,0x8c,0xcc,0xcc,0xcc,0x8e,0x39,0x00,0xd1,0x5c,0xff,0xff,
+0xfc,0x5f,0x88,0xff,0xf8,0x8f,0xff,0xc5,0xa6,0xcf,0x1d,0x03,0x01,0x0f,0x01,0xf0,
+0x0c,0x06,0xff,0xc0,0x00,0x9f,0xf9,0x00,0x0b,0xff,0x62,0x00,0xdf,0xff,0xf7,0x0f,
+0xff,0xfe,0x10,0x11,0xaf,0x60,0x00,0x0d,0xd0,0x00,0x01,0xf4,0x41,0x08,0x00,0x01,
+0x00,0xf0,0x19,0x45,0xb9,0x52,0x00,0xff,0x8d,0xfa,0x00,0xff,0xd9,0x96,0x00,0xff,
+0x6e,0xe9,0x91,0xff,0x7f,0xfb,0x77,0xff,0x7f,0xff,0xed,0xff,0x7f,0xff,0xfe,0x45,
+0x4f,0xff,0xfe,0x00,0x2f,0xff,0xfe,0x00,0x00,0x00,0x00,0xf0,0x15,0x00,0x07,0x50,
+0x00,0x00,0x8f,0xe7,0x00,0x08,0xff,0xff,0x60,0x0d,0xff,0xff,0xb0,0x0f,0xff,0xff,
+0xd0,0x2f,0xff,0xff,0xf1,0xcf,0xff,0xff,0xfa,0x57,0x77,0x77,0x74,0x00,0x1e,0xd0,
+0x00,0x01,0x00,0xf5,0x18,0xbf,0xff,0xff,0xff,0xfd,0x0f,0x4b,0x3a,0xa3,0xa3,0xf2,
+0xfa,0xd9,0xdd,0x9d,0x9f,0x2f,0xf0,0xa3,0x3a,0x0d,0xf2,0xfc,0xcb,0x9a,0xbc,0xcf,
+0x2f,0x4a,0x22,0x22,0xa2,0xf2,0xcf,0xff,0xff,0xff,0xfe,0x00,0x01,0x00,0xf0,0x18,
+0x3a,0xa0,0x00,0x00,0x04,0xbf,0xfd,0x00,0x00,0x5d,0xff,0xff,0x60,0x06,0xef,0xff,
+0xff,0xe0,0x00,0xef,0xff,0xff,0xf7,0x00,0x01,0x33,0x3f,0xff,0x00,0x00,0x00,0x01,
+0xff,0x80,0x00,0x00,0x00,0x1f,0xf1,0x2b,0x00,0x14,0xe9,0x34,0x00,0xf9,0x03,0xde,
+0xed,0x63,0x0f,0xff,0xf8,0xf3,0xff,0xff,0x47,0x5f,0xff,0xff,0xfc,0xff,0xff,0xff,
+0xcf,0x07,0x00,0xf0,0x1d,0xb1,0x22,0x22,0x20,0x00,0x00,0x24,0x31,0x00,0x00,0x02,
+0xaf,0xff,0xff,0xb4,0x00,0x7f,0xd7,0x31,0x25,0xbf,0xa0,0x98,0x01,0x57,0x62,0x05,
+0xc1,0x00,0x7f,0xff,0xff,0xa0,0x00,0x00,0xa9,0x10,0x07,0xc1,0x00,0x00,0x00,0x3c,
+0x50,0x4f,0x00,0x20,0x6f,0xa0,0x06,0x00,0x90,0x05,0x10,0x00,0x00,0x12,0x22,0x22,
+0x22,0x22,0x80,0x00,0xfc,0x11,0xff,0xff,0x90,0xf4,0x88,0x88,0x88,0x77,0xf2,0xf7,
+0xff,0xff,0xff,0xf0,0xe3,0xf5,0xaa,0xaa,0xaa,0x97,0xf3,0xee,0xee,0xee,0xee,0xef,
+0xb0,0x13,0x33,0x33,0x33,0x33,0x2a,0x00,0x20,0x82,0x07,0x2a,0x00,0x20,0xf4,0x00,
+0x2a,0x00,0x2f,0xa2,0x07,0x2a,0x00,0x08,0x20,0x84,0x00,0x2a,0x00,0x20,0xf9,0x00,
+0x2a,0x00,0x2f,0xa6,0x00,0x2a,0x00,0x08,0x20,0x87,0x00,0x2a,0x00,0x20,0xfe,0x00,
+0x2a,0x00,0x2f,0xa9,0x00,0x2a,0x00,0x08,0x20,0xf2,0x00,0x2a,0x00,0x20,0xf2,0x00,
+0x2a,0x00,0x02,0x0c,0x00,0x01,0x2a,0x00,0x12,0xa0,0x2a,0x00,0x40,0x00,0x00,0x04,
+0xb3,0x1b,0x00,0xf1,0x0b,0xa8,0xf5,0x00,0x00,0x48,0x05,0x50,0x00,0x03,0x00,0xff,
+0xcd,0xaa,0xaa,0xad,0xd1,0x8c,0x20,0x37,0x00,0x06,0x30,0x00,0x00,0x09,0x4d,0xfd,
+0x00,0x24,0x7f,0xc0,0x5c,0x01,0xf6,0x2b,0x7b,0xca,0x20,0x08,0xfe,0x6f,0xd0,0x0f,
+0xde,0x27,0xf4,0x2f,0x96,0x45,0xf6,0x3f,0xf7,0x1f,0xf7,0x3f,0xd3,0x28,0xf7,0x1f,
+0x8d,0x54,0xf5,0x0b,0xff,0x2e,0xf1,0x01,0xcf,0xee,0x50,0x00,0x00,0x10,0x00,0x56,
+0x9e,0xd8,0x64,0x9a,0xaa,0xaa,0xa8,0x5d,0xdd,0xdd,0xd4,0x7f,0xac,0xda,0xf5,0x7f,
+0x7a,0xc7,0x04,0x00,0xf0,0x00,0x8a,0xc7,0xf5,0x4f,0xff,0xff,0xf3,0x01,0x22,0x22,
+0x10,0x00,0x00,0x00,0x08,0x62,0x00,0xf2,0x06,0x4f,0xfb,0x00,0x00,0x09,0xc7,0xfc,
+0x00,0x00,0x9f,0xfc,0x61,0x00,0x09,0xff,0xfc,0x10,0x00,0x9f,0xff,0xc1,0x09,0x00,
+0xb1,0x0d,0xff,0xc1,0x00,0x00,0x0f,0xfc,0x10,0x00,0x00,0x01,0x82,0x00,0xfc,0x25,
+0x2b,0xcc,0xcc,0xcc,0xa0,0x03,0xef,0xfd,0xfe,0xef,0xf3,0x3e,0xff,0xe0,0x82,0x7f,
+0xf4,0xef,0xff,0xfb,0x03,0xff,0xf4,0x6f,0xff,0xf2,0x40,0x9f,0xf4,0x06,0xff,0xf9,
+0xfc,0xbf,0xf3,0x00,0x5f,0xff,0xff,0xff,0xe1,0x03,0xef,0xff,0x63,0xe5,0x7a,0x7b,
+0xff,0x36,0x96,0xcf,0x07,0x02,0x84,0xfb,0xcf,0xff,0xff,0x80,0x12,0x22,0x10,0xd6,
+0x00,0xc0,0x01,0xc0,0x04,0xc0,0x00,0x05,0xf0,0x5f,0xe7,0x77,0x7a,0xf0,0x81,0x02,
+0xb0,0xe0,0x0c,0xd0,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -407,11 +410,16 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 1524, .range_length = 62127, .glyph_id_start = 143, .list_length = 63, .type = 3, .unicode_list = 1648, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[8778] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 2005, .size = 4095, .comp_size = 3766 },
+{ .bitmap_start = 4095, .comp_offset = 5771, .size = 729, .comp_size = 577 },
+};
+
+static uint8_t etxUncompBuf[3954] __SDRAMFONTS;
 
 const etxLz4Font lv_font_he_XXS = {
-.uncomp_size = 8450,
-.comp_size = 6294,
+.uncomp_size = 3626,
+.comp_size = 2005,
 .line_height = 12,
 .base_line = 3,
 .subpx = 0,
@@ -424,12 +432,13 @@ const etxLz4Font lv_font_he_XXS = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 36,
-.glyph_bitmap = 1774,
-.class_pair_values = 6598,
-.left_class_mapping = 8038,
-.right_class_mapping = 8244,
+.class_pair_values = 1774,
+.left_class_mapping = 3214,
+.right_class_mapping = 3420,
+.block_num = 2,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 8778,
+.lvglFontBufSize = 3954,
 };
@@ -88,642 +88,661 @@ static const uint8_t lz4FontData[] ={
 0x00,0x22,0x4a,0x32,0x08,0x00,0x13,0xae,0x08,0x00,0xf2,0x03,0x12,0x33,0x00,0x14,
 0x15,0x0e,0x00,0xff,0xa5,0x33,0x00,0x0e,0x0c,0x10,0x01,0xfe,0x05,0x34,0x60,0x00,
 0x21,0x75,0x34,0xa8,0x00,0xb2,0xfd,0x06,0x35,0x00,0x14,0x14,0x0c,0x00,0x00,0x7e,
-0x35,0x60,0x00,0xf0,0xff,0x44,0xde,0x35,0x20,0x10,0x11,0x0b,0x00,0x01,0x00,0x00,
-0x2e,0x1a,0x71,0x1c,0x0d,0xea,0x14,0xea,0x17,0xea,0x18,0xea,0x19,0xea,0x1d,0xea,
-0x1f,0xea,0x21,0xea,0x25,0xea,0x28,0xea,0x2d,0xea,0x32,0xea,0x33,0xea,0x34,0xea,
-0x4a,0xea,0x4f,0xea,0x54,0xea,0x57,0xea,0x58,0xea,0x59,0xea,0x5d,0xea,0x5e,0xea,
-0x5f,0xea,0x60,0xea,0x73,0xea,0x74,0xea,0x7a,0xea,0x7c,0xea,0x7d,0xea,0x80,0xea,
-0x83,0xea,0x84,0xea,0x85,0xea,0x87,0xea,0x9f,0xea,0xa1,0xea,0xd0,0xea,0xd1,0xea,
-0xd3,0xea,0xd5,0xea,0xec,0xea,0xf3,0xea,0xf6,0xea,0xff,0xea,0x28,0xeb,0x30,0xeb,
-0x67,0xeb,0xf7,0xeb,0x4c,0xec,0x4d,0xec,0x4e,0xec,0x4f,0xec,0x50,0xec,0x93,0xec,
-0x9f,0xec,0xf9,0xec,0x10,0xed,0x66,0xef,0xce,0xf1,0xae,0xf2,0x0f,0xf6,0x0e,0xf6,
-0x0e,0xf5,0x0d,0xf5,0x0d,0xf4,0x0c,0xf4,0x0c,0xf3,0x0b,0xf3,0x02,0x30,0x03,0x60,
-0x0f,0xf6,0x0b,0xe3,0x8f,0x1f,0xa8,0xf0,0xf9,0x8f,0x0f,0x78,0xd0,0xf6,0x36,0x07,
-0x20,0x00,0x06,0xf0,0x7f,0x00,0x00,0x09,0xd0,0xac,0x00,0x00,0x0c,0xa0,0xd9,0x00,
-0x0e,0xff,0xff,0xff,0xf3,0x06,0x8f,0x98,0xf8,0x61,0x00,0x4f,0x25,0xf1,0x00,0x01,
-0x7f,0x28,0xf1,0x10,0x8f,0xff,0xff,0xff,0xa0,0x24,0xdc,0x4e,0xb4,0x20,0x00,0xe8,
-0x0f,0x70,0x00,0x00,0xf5,0x1f,0x40,0x00,0x03,0xf3,0x4f,0x20,0x00,0x00,0x00,0x74,
-0x00,0x00,0x00,0x0c,0x70,0x00,0x00,0x3a,0xfe,0x70,0x00,0x3f,0xff,0xff,0xa0,0x0a,
-0xfb,0x05,0xff,0x20,0xcf,0x70,0x0d,0xf5,0x0a,0xfc,0x10,0x00,0x00,0x3f,0xff,0x91,
-0x00,0x00,0x3c,0xff,0xf4,0x00,0x00,0x03,0xcf,0xf1,0x18,0x70,0x00,0xef,0x52,0xff,
-0x30,0x0e,0xf5,0x0c,0xfe,0x8b,0xff,0x20,0x2d,0xff,0xff,0x60,0x00,0x03,0xf8,0x10,
-0x00,0x00,0x0e,0x50,0x00,0x05,0xdf,0xa0,0x00,0x00,0x00,0x1f,0xb7,0xf7,0x01,0x80,
-0x00,0x3f,0x40,0xda,0x0a,0xc0,0x00,0x2f,0x82,0xf9,0x3f,0x30,0x00,0x09,0xff,0xe2,
-0xd9,0x00,0x00,0x00,0x23,0x07,0xe1,0x00,0x20,0x00,0x10,0x60,0x06,0x00,0xf1,0x56,
-0xac,0x2c,0xfe,0x50,0x00,0x04,0xf3,0xae,0x5b,0xf0,0x00,0x0d,0x90,0xcb,0x06,0xf1,
-0x00,0x2c,0x10,0xae,0x6c,0xf0,0x00,0x00,0x00,0x1b,0xfd,0x40,0x00,0x3c,0xfd,0x50,
-0x00,0x00,0x1e,0xff,0xff,0x30,0x00,0x05,0xfb,0x08,0xf7,0x00,0x00,0x6f,0xa0,0x8f,
-0x60,0x00,0x02,0xff,0xaf,0xd0,0x00,0x00,0x09,0xff,0xb1,0x00,0x00,0x05,0xff,0xfc,
-0x04,0xd8,0x02,0xff,0x6e,0xf9,0x7f,0x80,0x6f,0xe0,0x3f,0xff,0xf4,0x05,0xff,0x10,
-0x6f,0xfd,0x00,0x0d,0xfe,0xcf,0xff,0xe2,0x00,0x19,0xef,0xd8,0xaf,0xd0,0x8f,0x28,
-0xf2,0x8f,0x18,0xf0,0x47,0x1b,0x08,0xf1,0x07,0x03,0xe1,0x00,0x1e,0xd1,0x00,0xaf,
-0x20,0x02,0xfa,0x00,0x08,0xf5,0x00,0x0b,0xf2,0x00,0x0e,0xf0,0x00,0x0f,0xe0,0x03,
-0x00,0xf0,0x36,0xf0,0x00,0x0d,0xf0,0x00,0x0a,0xf3,0x00,0x05,0xf7,0x00,0x00,0xee,
-0x00,0x00,0x6f,0x70,0x00,0x09,0xf2,0x00,0x00,0x70,0x00,0x00,0x07,0xb0,0x00,0x4f,
-0xa0,0x00,0x8f,0x50,0x01,0xfd,0x00,0x0c,0xf3,0x00,0x8f,0x70,0x06,0xfa,0x00,0x5f,
-0xb0,0x04,0xfc,0x00,0x5f,0xa0,0x06,0xf8,0x00,0x9f,0x50,0x0d,0xf0,0x04,0xf9,0x00,
-0xcf,0x10,0x8f,0x40,0x04,0x30,0x00,0x00,0x4b,0x01,0xf1,0x08,0x0f,0x60,0x00,0x8d,
-0x6e,0x89,0xd0,0x5b,0xff,0xfe,0x90,0x00,0xaf,0xe1,0x00,0x07,0xf4,0xeb,0x00,0x09,
-0x90,0x6d,0x10,0x80,0x00,0xf0,0x02,0x07,0xa4,0x00,0x00,0x00,0xbf,0x60,0x00,0x00,
-0x0b,0xf6,0x00,0x01,0x22,0xcf,0x72,0x20,0x88,0x01,0x50,0x48,0xff,0xff,0xff,0xf4,
-0x12,0x00,0x05,0x1b,0x00,0xf9,0x1a,0x00,0x0e,0xf0,0xef,0x0f,0xd4,0xf8,0x5c,0x00,
-0x2e,0xee,0xe3,0x2f,0xff,0xf4,0x03,0x70,0x0f,0xf7,0x0a,0xf4,0x00,0x00,0x1f,0x90,
-0x00,0x06,0xf4,0x00,0x00,0xbe,0x00,0x00,0x0f,0xa0,0x00,0x05,0xf5,0x00,0x00,0xaf,
-0x0a,0x00,0xff,0x41,0xb0,0x00,0x04,0xf6,0x00,0x00,0xaf,0x10,0x00,0x0e,0xb0,0x00,
-0x00,0x00,0x6d,0xfe,0x80,0x00,0x6f,0xff,0xff,0x90,0x0e,0xf8,0x05,0xff,0x12,0xff,
-0x10,0x0e,0xf4,0x3f,0xf0,0x00,0xdf,0x64,0xff,0x00,0x0d,0xf7,0x4f,0xf0,0x00,0xdf,
-0x73,0xff,0x00,0x0d,0xf6,0x2f,0xf1,0x00,0xef,0x40,0xef,0x80,0x5f,0xf1,0x06,0xff,
-0xff,0xf9,0x00,0x06,0xdf,0xe8,0x00,0x00,0x16,0xc4,0x3a,0xff,0xf4,0xbf,0xff,0xf4,
-0x65,0x0f,0xf4,0x00,0x03,0x00,0x05,0xf1,0x35,0x7d,0xfd,0x80,0x00,0xaf,0xff,0xff,
-0xa0,0x2f,0xf4,0x06,0xff,0x05,0xec,0x00,0x1f,0xf2,0x00,0x00,0x04,0xff,0x00,0x00,
-0x00,0xdf,0x80,0x00,0x00,0xbf,0xd0,0x00,0x00,0xaf,0xe2,0x00,0x00,0x8f,0xf3,0x00,
-0x00,0x6f,0xf4,0x00,0x00,0x2f,0xff,0xee,0xee,0x83,0xff,0xff,0xff,0xf9,0x01,0x9e,
-0xfd,0x70,0x00,0xcf,0xfe,0xff,0xa0,0x3f,0xf3,0x05,0xff,0x11,0x33,0x36,0x00,0xf0,
-0x37,0x08,0xfe,0x00,0x00,0xef,0xfd,0x20,0x00,0x0c,0xef,0xf7,0x00,0x00,0x00,0x3f,
-0xf2,0x25,0x40,0x00,0xef,0x56,0xff,0x20,0x4f,0xf4,0x0d,0xff,0xef,0xfc,0x00,0x19,
-0xdf,0xd8,0x00,0x00,0x00,0x2f,0xf7,0x00,0x00,0x0c,0xff,0x70,0x00,0x06,0xff,0xf7,
-0x00,0x01,0xee,0xdf,0x70,0x00,0xaf,0x5c,0xf7,0x00,0x4f,0xb0,0xcf,0x70,0x0d,0xf1,
-0x0c,0xf7,0x07,0xff,0xee,0xff,0xfa,0x43,0x01,0xa0,0xc0,0x00,0x00,0xcf,0x70,0x00,
-0x00,0x0c,0xf7,0x00,0x09,0x00,0xf0,0x11,0x04,0xff,0xff,0xff,0x20,0x6f,0xff,0xff,
-0xf2,0x08,0xf9,0x00,0x00,0x00,0x9f,0x70,0x00,0x00,0x0b,0xfc,0xef,0xb1,0x00,0xdf,
-0xfd,0xff,0xd0,0x01,0x51,0x03,0xff,0x40,0x29,0x00,0xf0,0x31,0x17,0x70,0x00,0xcf,
-0x70,0xff,0x70,0x3f,0xf4,0x07,0xff,0xff,0xfc,0x00,0x06,0xdf,0xe9,0x00,0x00,0x02,
-0x9d,0xe0,0x00,0x05,0xff,0xfe,0x00,0x02,0xff,0x92,0x00,0x00,0xaf,0xa0,0x00,0x00,
-0x0f,0xf8,0xdf,0xc3,0x02,0xff,0xff,0xff,0xe0,0x3f,0xf7,0x02,0xff,0x63,0xff,0x00,
-0x0b,0xf8,0x1f,0xf2,0x00,0xbf,0x90,0xdf,0x90,0x2f,0xf5,0x04,0x36,0x00,0x31,0x04,
-0xcf,0xe9,0x49,0x03,0xf0,0x07,0x87,0xee,0xee,0xef,0xf6,0x00,0x00,0x02,0xff,0x10,
-0x00,0x00,0x8f,0x90,0x00,0x00,0x0f,0xf3,0x00,0x00,0x06,0xfc,0x12,0x01,0x90,0x60,
-0x00,0x00,0x4f,0xe0,0x00,0x00,0x0b,0xf8,0x1e,0x00,0x90,0x20,0x00,0x00,0x9f,0xb0,
-0x00,0x00,0x1f,0xf5,0x9e,0x01,0xf0,0x13,0xfd,0x80,0x00,0x7f,0xff,0xff,0xa0,0x0d,
-0xf8,0x05,0xff,0x00,0xff,0x40,0x1f,0xf2,0x0c,0xf9,0x07,0xfe,0x00,0x2d,0xff,0xfe,
-0x30,0x04,0xff,0xff,0xf6,0x00,0xef,0x60,0x3f,0xf2,0xb0,0x01,0xf0,0x03,0x62,0xff,
-0x50,0x3f,0xf5,0x0b,0xff,0xef,0xfd,0x00,0x08,0xdf,0xe9,0x10,0x00,0x6d,0xfd,0x50,
-0x36,0x00,0xf0,0x00,0x50,0x0f,0xf7,0x07,0xfe,0x04,0xff,0x00,0x0f,0xf3,0x4f,0xf0,
-0x00,0xef,0x51,0x24,0x00,0xf2,0x12,0x0a,0xff,0xdf,0xff,0x40,0x0a,0xfe,0x8f,0xf2,
-0x00,0x00,0x05,0xfe,0x00,0x00,0x15,0xef,0x70,0x00,0x9f,0xff,0xb0,0x00,0x09,0xfc,
-0x60,0x00,0x0a,0xe3,0x0f,0xf7,0x03,0x70,0x1b,0x0b,0x01,0x4a,0x02,0x74,0xe3,0x0c,
-0xe2,0x1f,0xf5,0x04,0x60,0x36,0x0b,0xa5,0x0b,0xf2,0x0b,0xf2,0x0d,0xf0,0x2f,0xa0,
-0x3d,0x20,0x48,0x0b,0xf0,0x16,0xb2,0x00,0x06,0xdf,0xf2,0x18,0xef,0xfe,0x80,0x9f,
-0xfa,0x40,0x00,0x9f,0xfc,0x60,0x00,0x06,0xdf,0xff,0xa1,0x00,0x04,0xbf,0xf2,0x00,
-0x00,0x02,0x92,0xff,0xff,0xff,0xf0,0xde,0xee,0xee,0xe0,0x2a,0x00,0x00,0x08,0x00,
-0x00,0x10,0x00,0xf0,0x3f,0x0c,0x50,0x00,0x00,0x1f,0xfd,0x70,0x00,0x07,0xdf,0xff,
-0x92,0x00,0x03,0x9e,0xfc,0x00,0x05,0xbf,0xfb,0x09,0xef,0xfe,0x71,0x1f,0xfc,0x50,
-0x00,0x0a,0x30,0x00,0x00,0x03,0xbf,0xeb,0x20,0x2f,0xff,0xff,0xe0,0x8f,0xd0,0x2f,
-0xf4,0x24,0x20,0x0f,0xf5,0x00,0x00,0x6f,0xf1,0x00,0x05,0xff,0x50,0x00,0x0f,0xf6,
-0x00,0x00,0x3f,0xd0,0x00,0x00,0x14,0x30,0x00,0x00,0x06,0x30,0x00,0x00,0x7f,0xf0,
-0x00,0x00,0x3e,0xbf,0x02,0xf2,0x45,0x3a,0xdf,0xeb,0x40,0x00,0x00,0x08,0xfc,0x75,
-0x6b,0xf9,0x00,0x00,0x8f,0x60,0x01,0x00,0x4f,0x70,0x03,0xf8,0x01,0xcf,0xfa,0x07,
-0xf1,0x0a,0xe0,0x0c,0xf6,0xbf,0x01,0xf5,0x0f,0x90,0x5f,0x60,0x9f,0x00,0xd8,0x2f,
-0x50,0xaf,0x10,0xae,0x00,0xb9,0x4f,0x30,0xde,0x00,0xbd,0x00,0xca,0x4f,0x30,0xed,
-0x00,0xcc,0x00,0xd7,0x3f,0x50,0xde,0x00,0xfb,0x02,0xf4,0x0f,0x80,0x9f,0x8b,0xfe,
-0x6d,0xc0,0x0b,0xe1,0x1c,0xfa,0x2d,0xfb,0x10,0x02,0xfc,0x84,0x03,0xb0,0x5f,0xfa,
-0x77,0x99,0x00,0x00,0x00,0x02,0x8d,0xff,0xc6,0x0f,0x00,0x30,0xef,0xa0,0x00,0xd6,
-0x04,0x10,0x00,0x4f,0x04,0x10,0xf5,0x10,0x00,0xf0,0x71,0xdf,0xb0,0x00,0x00,0x4f,
-0xf4,0xff,0x10,0x00,0x0a,0xfb,0x0e,0xf6,0x00,0x00,0xff,0x60,0xaf,0xc0,0x00,0x5f,
-0xf1,0x05,0xff,0x20,0x0b,0xff,0xff,0xff,0xf7,0x01,0xff,0xff,0xff,0xff,0xd0,0x6f,
-0xf2,0x00,0x05,0xff,0x2c,0xfb,0x00,0x00,0x0e,0xf8,0xff,0xff,0xfd,0x80,0x0f,0xff,
-0xff,0xff,0xb0,0xff,0x50,0x08,0xff,0x1f,0xf5,0x00,0x2f,0xf2,0xff,0x50,0x08,0xfe,
-0x0f,0xff,0xff,0xfe,0x30,0xff,0xdc,0xcf,0xfa,0x0f,0xf5,0x00,0x2f,0xf4,0xff,0x50,
-0x00,0xef,0x7f,0xf5,0x00,0x5f,0xf5,0xff,0xff,0xff,0xfd,0x0f,0xff,0xff,0xd9,0x10,
-0x00,0x19,0xef,0xe9,0x10,0x01,0xdf,0xff,0xff,0xd1,0x0a,0xfe,0x30,0x3e,0xf8,0x0f,
-0xf6,0x00,0x08,0xfd,0x3f,0xf2,0x00,0x00,0x21,0x4f,0xf0,0xa3,0x00,0x00,0x05,0x00,
-0x00,0x0f,0x00,0xf1,0x01,0x11,0x0f,0xf5,0x00,0x08,0xfd,0x0a,0xfd,0x30,0x3e,0xf9,
-0x01,0xef,0xff,0xff,0xd1,0x37,0x00,0x00,0x40,0x00,0x02,0x60,0x00,0x30,0x50,0x3c,
-0xfd,0x60,0x00,0xf0,0x1a,0xf5,0xff,0x50,0x00,0xcf,0x9f,0xf5,0x00,0x0a,0xfb,0xff,
-0x50,0x00,0xaf,0xbf,0xf5,0x00,0x0c,0xf9,0xff,0x50,0x02,0xff,0x5f,0xf5,0x03,0xcf,
-0xd0,0xff,0xff,0xff,0xe3,0x0f,0xff,0xfe,0x92,0x00,0xff,0xff,0xff,0xfa,0x89,0x03,
-0x44,0xff,0x50,0x00,0x00,0x04,0x00,0x00,0xcb,0x00,0x4b,0xff,0xfe,0xee,0xc0,0x14,
-0x00,0x13,0xf9,0x2c,0x00,0x11,0xf6,0x04,0x00,0x0c,0x30,0x00,0x00,0x04,0x00,0x08,
-0x14,0x00,0x03,0x04,0x00,0xf0,0x09,0x00,0x18,0xdf,0xea,0x20,0x00,0x1d,0xff,0xff,
-0xfe,0x10,0x09,0xff,0x40,0x2e,0xf9,0x00,0xef,0x70,0x00,0x6f,0xe0,0x2f,0xf3,0x76,
-0x02,0x10,0xff,0x5b,0x02,0xf0,0x09,0x4f,0xf2,0x07,0xff,0xff,0x02,0xff,0x30,0x5d,
-0xdf,0xf0,0x0e,0xf8,0x00,0x05,0xff,0x00,0x8f,0xf5,0x00,0x8f,0xf0,0x00,0xdf,0x4a,
-0x03,0x40,0x00,0x8d,0xfe,0xc6,0x46,0x00,0x2f,0x1f,0xf4,0x05,0x00,0x02,0x00,0x21,
-0x05,0x02,0x05,0x00,0x0f,0x23,0x00,0x05,0x3b,0xdf,0x8d,0xf8,0x03,0x00,0x4f,0x00,
-0x00,0x06,0xff,0x04,0x00,0x09,0xf0,0x01,0x6a,0x70,0x06,0xfe,0x8f,0xe1,0x1c,0xfb,
-0x1f,0xff,0xff,0xf3,0x02,0xbe,0xfc,0x40,0x32,0x01,0xf0,0x09,0xc0,0xff,0x50,0x0c,
-0xfe,0x10,0xff,0x50,0x8f,0xf4,0x00,0xff,0x54,0xff,0x80,0x00,0xff,0x7e,0xfc,0x00,
-0x00,0xff,0xef,0xf5,0xfa,0x00,0xf0,0x08,0xfd,0x00,0x00,0xff,0xf8,0xff,0x70,0x00,
-0xff,0x80,0xaf,0xf2,0x00,0xff,0x50,0x1e,0xfb,0x00,0xff,0x50,0x06,0xff,0x50,0x7b,
-0x01,0x1e,0xe1,0x10,0x01,0x0e,0x04,0x00,0x03,0x40,0x01,0x11,0xf5,0x04,0x00,0x40,
-0xf3,0x00,0x00,0x4f,0x74,0x05,0x40,0x00,0x9f,0xff,0xff,0x05,0x05,0xf0,0x1a,0xff,
-0xff,0xdf,0x40,0x04,0xfd,0xff,0xff,0x9f,0x90,0x09,0xf9,0xff,0xff,0x4f,0xe0,0x0e,
-0xf4,0xff,0xff,0x4b,0xf4,0x4f,0xb4,0xff,0xff,0x45,0xf9,0x9f,0x54,0xff,0xff,0x50,
-0xfe,0xef,0x05,0xff,0xff,0x50,0xaf,0xfa,0x06,0x00,0x30,0x5f,0xf5,0x05,0x04,0x04,
-0x50,0xf0,0x05,0xff,0xff,0xa0,0x00,0x01,0x10,0xf3,0x05,0x00,0x11,0xfc,0x28,0x01,
-0xf0,0x0d,0x60,0x1f,0xf4,0xff,0xcf,0xe0,0x1f,0xf4,0xff,0x5d,0xf8,0x1f,0xf4,0xff,
-0x54,0xff,0x3f,0xf4,0xff,0x50,0xaf,0xcf,0xf4,0xff,0x50,0x2f,0xff,0xf4,0xa0,0x02,
-0x01,0x8a,0x02,0x00,0x05,0x00,0xf0,0x21,0x5f,0xf4,0x00,0x08,0xdf,0xd8,0x10,0x00,
-0x0d,0xff,0xff,0xfd,0x10,0x09,0xff,0x51,0x4e,0xf9,0x00,0xff,0x70,0x00,0x7f,0xf0,
-0x3f,0xf2,0x00,0x02,0xff,0x34,0xff,0x10,0x00,0x0f,0xf5,0x4f,0xf1,0x00,0x00,0xff,
-0x53,0xff,0x20,0x00,0x2f,0xf3,0x0f,0xf7,0x35,0x01,0x70,0x9f,0xf5,0x04,0xef,0x90,
-0x00,0xdf,0x87,0x02,0x53,0x00,0x8d,0xfd,0x81,0x00,0xfa,0x02,0x00,0x0f,0x02,0xf0,
-0x01,0x05,0xff,0x6f,0xf5,0x00,0x0b,0xfa,0xff,0x50,0x00,0xbf,0xbf,0xf5,0x00,0x4f,
-0xf7,0xe8,0x02,0x50,0x1f,0xff,0xff,0xe9,0x10,0xf6,0x00,0x10,0x0f,0x57,0x03,0x05,
-0x09,0x00,0x20,0x00,0x08,0xd8,0x05,0x13,0x1d,0x78,0x00,0x18,0x5f,0x78,0x00,0x20,
-0x35,0xff,0x24,0x00,0x28,0x5f,0xf0,0x78,0x00,0x57,0x07,0xff,0x00,0x9f,0xf4,0x78,
-0x00,0x20,0xff,0xfd,0x4c,0x02,0x20,0x2d,0xfe,0xcc,0x03,0x90,0x0a,0x50,0xff,0xff,
-0xfd,0x70,0x0f,0xff,0xff,0xb9,0x01,0x60,0x07,0xff,0x4f,0xf5,0x00,0x0f,0xaf,0x02,
-0x00,0x8c,0x00,0x20,0x8f,0xf2,0xad,0x03,0x10,0x0f,0x64,0x01,0xc0,0xff,0x50,0x7f,
-0xf1,0x0f,0xf5,0x00,0xef,0x80,0xff,0x50,0x06,0xa1,0x03,0xf0,0x11,0x0e,0xf9,0x00,
-0x5c,0xff,0xc6,0x00,0x07,0xff,0xff,0xff,0x80,0x0f,0xf9,0x00,0x8f,0xf1,0x1f,0xf5,
-0x00,0x1a,0xa2,0x0c,0xfe,0x60,0x00,0x00,0x02,0xdf,0xff,0xa2,0x00,0xc5,0x04,0x10,
-0x40,0xdf,0x08,0xc0,0xe0,0x5d,0xc0,0x00,0x2f,0xf3,0x2f,0xf7,0x00,0x6f,0xf2,0x09,
-0xe1,0x03,0x60,0x00,0x5c,0xff,0xd7,0x00,0xbf,0x20,0x03,0x20,0xaf,0xff,0x59,0x00,
-0x10,0x04,0xf0,0x05,0x0f,0x05,0x00,0x19,0x5f,0x1f,0xf4,0x00,0x0b,0xfa,0x05,0x00,
-0x0f,0xc1,0xf9,0x0f,0xf5,0x00,0x0d,0xf8,0x0c,0xfc,0x20,0x5f,0xf5,0x03,0x78,0x00,
-0xf2,0x00,0x3b,0xff,0xd8,0x00,0xcf,0xc0,0x00,0x05,0xff,0x37,0xff,0x10,0x00,0xaf,
-0xe0,0xc4,0x00,0xf0,0x0f,0xcf,0xa0,0x03,0xff,0x40,0x07,0xfe,0x00,0x8f,0xe0,0x00,
-0x2f,0xf3,0x0c,0xf9,0x00,0x00,0xcf,0x81,0xff,0x40,0x00,0x07,0xfc,0x5f,0xe0,0x00,
-0x00,0x2f,0xfc,0xf9,0x06,0x01,0xc7,0x00,0x30,0x07,0xff,0xe0,0x46,0x07,0x10,0xf9,
-0x7c,0x06,0xf0,0x31,0x01,0xff,0x10,0x0b,0xfa,0x6f,0xe0,0x04,0xff,0x50,0x0d,0xf6,
-0x3f,0xf1,0x08,0xff,0x90,0x0f,0xf3,0x0f,0xf3,0x0b,0xff,0xc0,0x3f,0xf0,0x0c,0xf6,
-0x0f,0xed,0xf0,0x6f,0xc0,0x09,0xf9,0x2f,0xaa,0xf3,0x9f,0x90,0x05,0xfc,0x6f,0x66,
-0xf7,0xcf,0x60,0x02,0xff,0xaf,0x32,0xfa,0xff,0x20,0x00,0xef,0xff,0x00,0xff,0xff,
-0x00,0x00,0xbf,0xfb,0x03,0x00,0x60,0x00,0x8f,0xf8,0x00,0x7f,0xf8,0x22,0x05,0xf0,
-0x08,0x00,0x4f,0xf5,0x00,0x7f,0xf3,0x00,0x1f,0xfa,0x0d,0xfb,0x00,0x8f,0xf1,0x05,
-0xff,0x41,0xff,0x80,0x00,0xcf,0xc9,0xfe,0x4d,0x05,0xb0,0xf6,0x00,0x00,0x0a,0xff,
-0xd0,0x00,0x00,0x0b,0xff,0xe0,0xe9,0x02,0xf0,0x1f,0xf7,0x00,0x00,0xdf,0xb8,0xff,
-0x10,0x06,0xff,0x31,0xff,0x90,0x0e,0xfa,0x00,0x8f,0xf2,0x8f,0xf2,0x00,0x0e,0xfb,
-0xbf,0xc0,0x00,0x0e,0xfa,0x4f,0xf3,0x00,0x5f,0xf2,0x0c,0xfa,0x00,0xcf,0xa0,0x04,
-0xff,0x23,0xff,0x20,0x00,0xcf,0x8a,0xfa,0x32,0x00,0x10,0xf3,0xf5,0x07,0x10,0xb0,
-0xdd,0x09,0x10,0x30,0x3b,0x01,0x1b,0x20,0x05,0x00,0x00,0xd9,0x08,0x30,0xff,0xf1,
-0x6f,0x7a,0x06,0x00,0x59,0x07,0xa0,0x60,0x00,0x00,0x0c,0xfb,0x00,0x00,0x00,0x7f,
-0xf2,0x0e,0x00,0x00,0x08,0x08,0x00,0x7d,0x07,0x60,0x6f,0xf2,0x00,0x00,0x01,0xff,
-0xfd,0x07,0x10,0xfd,0x53,0x05,0x00,0x05,0x0b,0x10,0x6f,0x05,0x00,0xaf,0x0d,0xdd,
-0x41,0xff,0xf5,0x1f,0xf3,0x01,0xff,0x30,0x05,0x00,0x0a,0xf2,0x03,0xd4,0x1f,0xff,
-0x50,0xdf,0x70,0x00,0x00,0x7f,0xd0,0x00,0x00,0x1f,0xf3,0x00,0x00,0x0b,0xf9,0x5b,
-0x07,0x01,0xca,0x02,0x00,0x1e,0x08,0x00,0x20,0x03,0x20,0x0e,0xf6,0xa4,0x06,0x03,
-0xdd,0x07,0xbf,0xcf,0x80,0x00,0x00,0x6f,0xd0,0xbd,0xd6,0xef,0xf7,0x0c,0x02,0x00,
-0x06,0xf0,0x25,0xbf,0xf7,0xef,0xf7,0x00,0x8f,0x80,0x00,0x0e,0xfe,0x00,0x04,0xfc,
-0xf4,0x00,0xaf,0x2f,0xa0,0x1f,0xa0,0xaf,0x17,0xf5,0x04,0xf7,0xdd,0xdd,0xdd,0xd1,
-0xff,0xff,0xff,0xf2,0x38,0x80,0x00,0xbf,0x80,0x00,0xdf,0x20,0x01,0x9e,0xfc,0x50,
-0x00,0xcf,0xed,0xff,0x40,0x3f,0xf1,0x7a,0x00,0xf3,0x0d,0x01,0x9f,0xb0,0x04,0xcf,
-0xff,0xfb,0x02,0xff,0x74,0xaf,0xb0,0x6f,0xd0,0x0a,0xfb,0x03,0xff,0xee,0xff,0xb0,
-0x05,0xdf,0xb7,0xfe,0x00,0x2f,0xf2,0x7f,0x00,0x02,0x09,0x00,0xf0,0x08,0x7d,0xfb,
-0x10,0x2f,0xff,0xff,0xfc,0x02,0xff,0x60,0x4f,0xf3,0x2f,0xf2,0x00,0xdf,0x52,0xff,
-0x20,0x0c,0xf7,0x2f,0xf2,0x4b,0x08,0x32,0x60,0x3f,0xf3,0x1b,0x00,0xf0,0x06,0x6e,
-0xfb,0x10,0x00,0x8e,0xfd,0x50,0x0a,0xff,0xff,0xf5,0x2f,0xf4,0x08,0xfc,0x6f,0xd0,
-0x01,0x65,0x7f,0xc0,0xbc,0x00,0xe9,0x00,0x22,0x2f,0xf4,0x07,0xfc,0x0a,0xff,0xef,
-0xf6,0x00,0x8e,0xfd,0x60,0x58,0x00,0x50,0x20,0x1a,0xfd,0x7f,0xf2,0x02,0x07,0xf0,
-0x0b,0x22,0xff,0x50,0x7f,0xf2,0x5f,0xe0,0x02,0xff,0x27,0xfc,0x00,0x2f,0xf2,0x5f,
-0xd0,0x02,0xff,0x22,0xff,0x30,0x5f,0xf2,0x0b,0xff,0xdf,0x24,0x00,0xf0,0x05,0x6f,
-0xf2,0x00,0x6d,0xfd,0x70,0x00,0x8f,0xff,0xff,0x70,0x1f,0xf5,0x04,0xff,0x05,0xff,
-0x99,0x9f,0xf2,0x76,0x01,0x20,0x35,0xff,0xee,0x0b,0x30,0xf9,0x00,0x85,0x1b,0x00,
-0xfe,0x09,0xd0,0x00,0x6d,0xfe,0xa1,0x00,0x00,0x6d,0xfa,0x04,0xff,0xfa,0x07,0xfd,
-0x00,0xcf,0xff,0xf7,0x8d,0xfe,0xb5,0x08,0xfc,0x00,0x03,0x00,0xf2,0x06,0x00,0xaf,
-0xe7,0xdf,0x40,0xaf,0xff,0xff,0xf4,0x2f,0xf6,0x04,0xff,0x45,0xfe,0x00,0x0f,0xf4,
-0x6f,0xd0,0x00,0x09,0x00,0x00,0x12,0x00,0x01,0x1b,0x00,0xf0,0x05,0x00,0x9f,0xe7,
-0xff,0x30,0x15,0x00,0x6f,0xf1,0x0b,0xff,0xef,0xf9,0x00,0x1a,0xef,0xd7,0x00,0x3f,
-0xf1,0x74,0x06,0x23,0x10,0x00,0x09,0x00,0xf0,0x06,0x5d,0xfb,0x20,0x3f,0xff,0xff,
-0xfb,0x03,0xff,0x50,0x6f,0xf0,0x3f,0xf1,0x02,0xff,0x13,0xff,0x10,0x2f,0xf2,0x09,
-0x00,0x19,0x23,0x09,0x00,0x8c,0x0c,0xe2,0x1f,0xf4,0x04,0x50,0x0f,0xf4,0x02,0x00,
-0x70,0x00,0xde,0x20,0x1f,0xf4,0x00,0x45,0xfa,0x0a,0x2d,0xff,0x40,0x05,0x00,0x7c,
-0x02,0xff,0x3b,0xff,0xe0,0xaf,0xc3,0x87,0x01,0xf0,0x02,0x20,0xaf,0xe1,0x2f,0xf2,
-0x7f,0xf3,0x02,0xff,0x6f,0xf6,0x00,0x2f,0xff,0xfa,0x00,0x02,0xf6,0x00,0xfe,0x03,
-0x2f,0xfc,0xef,0x70,0x02,0xff,0x26,0xff,0x20,0x2f,0xf2,0x0c,0xfc,0x02,0xff,0x20,
-0x3f,0xf6,0x6e,0x00,0x02,0x02,0x00,0xff,0x12,0x2f,0xf4,0xdf,0xc2,0x6e,0xfb,0x12,
-0xff,0xff,0xff,0xef,0xff,0xfa,0x2f,0xf6,0x06,0xff,0x50,0x8f,0xe2,0xff,0x20,0x3f,
-0xf0,0x04,0xff,0x2f,0xf2,0x03,0xff,0x00,0x4f,0xf2,0x0d,0x00,0x06,0x10,0xf0,0x3b,
-0x00,0x10,0x02,0x13,0x05,0x00,0x37,0x00,0xa0,0x02,0xff,0x10,0x2f,0xf1,0x2f,0xf1,
-0x02,0xff,0x22,0xe2,0x00,0x09,0x09,0x00,0x50,0x20,0x00,0x7d,0xfd,0x70,0x80,0x06,
-0xf0,0x0a,0x90,0x2f,0xf6,0x05,0xff,0x26,0xfe,0x00,0x0d,0xf6,0x7f,0xc0,0x00,0xcf,
-0x86,0xfe,0x00,0x0d,0xf7,0x2f,0xf5,0x05,0xff,0x30,0x9f,0x5f,0x06,0xf0,0x10,0x7d,
-0xfe,0x80,0x00,0x2f,0xf7,0xdf,0xb1,0x02,0xff,0xfd,0xff,0xb0,0x2f,0xf4,0x03,0xff,
-0x32,0xff,0x20,0x0d,0xf5,0x2f,0xf2,0x00,0xcf,0x72,0xff,0x20,0x0e,0xf5,0x3b,0x00,
-0x10,0x22,0xa4,0x04,0x48,0x2f,0xf7,0xdf,0xa1,0xff,0x00,0xf0,0x01,0x00,0x00,0x01,
-0xaf,0xe6,0xef,0x20,0xbf,0xff,0xff,0xf2,0x3f,0xf5,0x06,0xff,0x25,0xa8,0x02,0x32,
-0x7f,0xc0,0x02,0x09,0x00,0x41,0x2f,0xf5,0x06,0xff,0x1b,0x00,0x39,0x01,0xaf,0xd7,
-0x34,0x00,0x21,0x2f,0xf2,0xf2,0x0b,0xab,0xea,0x2f,0xff,0xfa,0x2f,0xfa,0x31,0x2f,
-0xf2,0x00,0x03,0x00,0xf0,0x17,0x02,0xae,0xfc,0x40,0x0d,0xfd,0xcf,0xf3,0x3f,0xf0,
-0x0a,0xd7,0x1f,0xfa,0x51,0x00,0x05,0xef,0xff,0x90,0x00,0x04,0x8f,0xf7,0x7f,0xb0,
-0x0a,0xf9,0x2f,0xfc,0xbf,0xf4,0x03,0xbf,0xfc,0x50,0x0b,0xf9,0xab,0x03,0x62,0xef,
-0xff,0xf0,0xae,0xfe,0xb0,0x0c,0x00,0x02,0x03,0x00,0x9e,0x0a,0xfa,0x00,0x07,0xff,
-0xf1,0x01,0xbf,0xe1,0xfa,0x01,0x14,0x3f,0x18,0x01,0xf0,0x01,0x1f,0xf4,0x06,0xff,
-0x20,0xdf,0xff,0xff,0xf2,0x02,0xcf,0xd6,0xff,0x20,0xbf,0x90,0x1c,0x03,0xf0,0x36,
-0x0c,0xf7,0x1f,0xf1,0x1f,0xf2,0x0c,0xf6,0x5f,0xd0,0x07,0xfa,0x9f,0x80,0x02,0xfe,
-0xdf,0x30,0x00,0xdf,0xfe,0x00,0x00,0x8f,0xf9,0x00,0x00,0x3f,0xf4,0x00,0xaf,0x70,
-0x1f,0xd0,0x0c,0xf6,0x6f,0xb0,0x5f,0xf1,0x0f,0xf2,0x2f,0xe0,0xaf,0xf5,0x2f,0xe0,
-0x0e,0xf1,0xee,0xfa,0x5f,0xa0,0x0b,0xf6,0xf8,0xce,0x8f,0x60,0x07,0xfe,0xf3,0x8f,
-0xef,0x30,0x03,0xff,0xf0,0x60,0x0a,0x40,0xff,0xa0,0x0f,0xfb,0xe2,0x0d,0xf0,0x3e,
-0x0a,0xf7,0x00,0x7f,0xe0,0x0c,0xfa,0x00,0xef,0x74,0xff,0x20,0x05,0xff,0xdf,0x80,
-0x00,0x0d,0xff,0xe1,0x00,0x00,0x7f,0xfa,0x00,0x00,0x0e,0xff,0xf2,0x00,0x07,0xfe,
-0xbf,0xa0,0x01,0xff,0x63,0xff,0x30,0x8f,0xd0,0x0a,0xfc,0x00,0xcf,0x90,0x08,0xfd,
-0x07,0xfe,0x00,0xdf,0x70,0x1f,0xf2,0x1f,0xf2,0x00,0xcf,0x76,0xfc,0x00,0x06,0xfb,
-0xaf,0x70,0x00,0x1f,0xff,0xf2,0x00,0x00,0xbf,0xfc,0x00,0x00,0x06,0xfc,0x04,0xf1,
-0x00,0x1f,0xf1,0x00,0x00,0x08,0xfb,0x00,0x00,0x1f,0xff,0x50,0x00,0x01,0xee,0x70,
-0x5b,0x08,0x30,0xf7,0x4e,0xee,0xce,0x0a,0x60,0xdf,0xb0,0x00,0x08,0xfe,0x10,0xad,
-0x05,0x60,0x01,0xef,0x90,0x00,0x0a,0xfd,0x1c,0x00,0x30,0xee,0xe8,0x6f,0xbe,0x06,
-0xd0,0x05,0x80,0x00,0x7f,0xc0,0x00,0xff,0x10,0x02,0xfd,0x00,0x03,0xfc,0x03,0x00,
-0x20,0x06,0xfa,0xcf,0x05,0x83,0xaf,0xc0,0x00,0x09,0xf8,0x00,0x04,0xfc,0x15,0x00,
-0xd9,0x01,0xff,0x00,0x00,0xaf,0x90,0x00,0x0a,0xc0,0x00,0x00,0x00,0xab,0x01,0x00,
-0xf0,0x03,0x01,0x57,0x00,0x07,0xfb,0x00,0x0c,0xf4,0x00,0x8f,0x70,0x08,0xf8,0x00,
-0x8f,0x80,0x05,0xfb,0x85,0x05,0x50,0x8f,0xe0,0x4f,0xd1,0x07,0x0f,0x00,0x90,0x08,
-0xf7,0x00,0xaf,0x50,0x4f,0xe0,0x08,0xc2,0xf3,0x07,0xf0,0x05,0x01,0xae,0xa0,0x01,
+0x35,0x60,0x00,0xf8,0x78,0xde,0x35,0x20,0x10,0x11,0x0b,0x00,0x01,0x00,0x00,0x2e,
+0x1a,0x71,0x1c,0x0d,0xea,0x14,0xea,0x17,0xea,0x18,0xea,0x19,0xea,0x1d,0xea,0x1f,
+0xea,0x21,0xea,0x25,0xea,0x28,0xea,0x2d,0xea,0x32,0xea,0x33,0xea,0x34,0xea,0x4a,
+0xea,0x4f,0xea,0x54,0xea,0x57,0xea,0x58,0xea,0x59,0xea,0x5d,0xea,0x5e,0xea,0x5f,
+0xea,0x60,0xea,0x73,0xea,0x74,0xea,0x7a,0xea,0x7c,0xea,0x7d,0xea,0x80,0xea,0x83,
+0xea,0x84,0xea,0x85,0xea,0x87,0xea,0x9f,0xea,0xa1,0xea,0xd0,0xea,0xd1,0xea,0xd3,
+0xea,0xd5,0xea,0xec,0xea,0xf3,0xea,0xf6,0xea,0xff,0xea,0x28,0xeb,0x30,0xeb,0x67,
+0xeb,0xf7,0xeb,0x4c,0xec,0x4d,0xec,0x4e,0xec,0x4f,0xec,0x50,0xec,0x93,0xec,0x9f,
+0xec,0xf9,0xec,0x10,0xed,0x66,0xef,0xce,0xf1,0xae,0xf2,0x00,0x01,0x00,0x2f,0xf9,
+0x00,0x01,0x00,0x03,0x13,0xfb,0x08,0x00,0x17,0xf1,0x14,0x00,0x90,0xfa,0xf9,0x00,
+0xfe,0xf5,0x00,0xf5,0x00,0x00,0xc2,0x00,0x0d,0x01,0x00,0x4e,0x03,0x05,0x00,0x03,
+0x16,0x00,0x2f,0xdc,0x00,0x01,0x00,0x15,0x1f,0xe1,0x1e,0x00,0x0a,0x03,0x88,0x00,
+0xb2,0xf6,0x00,0xfd,0x00,0x00,0xf1,0xfe,0xf6,0xfb,0x00,0xed,0x93,0x00,0x9b,0xff,
+0x00,0x00,0xfe,0xff,0xfa,0xfc,0x00,0x02,0x30,0x00,0x3f,0xfd,0x00,0xfd,0xdd,0x00,
+0x04,0x15,0xfd,0x0a,0x00,0x12,0xfc,0x07,0x00,0x19,0xff,0x1f,0x00,0x16,0xfe,0x70,
+0x00,0x00,0x2a,0x00,0x10,0xf5,0x4a,0x00,0x2f,0xfb,0xfd,0x9c,0x00,0x0a,0x15,0x03,
+0x3c,0x00,0x11,0xfe,0x3f,0x00,0x26,0xfe,0xfd,0x30,0x00,0x75,0xde,0x00,0x00,0x00,
+0xe8,0x00,0xe6,0x24,0x00,0x53,0xfc,0xfd,0x00,0x00,0xfd,0x04,0x00,0x08,0x01,0x00,
+0x13,0x02,0x90,0x00,0x1f,0x02,0x6b,0x00,0x08,0x1f,0xfd,0x43,0x01,0x0d,0x16,0xec,
+0xd5,0x00,0x04,0x31,0x00,0x10,0xfd,0x07,0x00,0x29,0xfb,0xf8,0x8c,0x01,0xa7,0x02,
+0xf8,0x00,0x00,0xe6,0xfd,0xe6,0xf4,0x00,0xdd,0xf7,0x00,0x25,0xf1,0xfa,0x0c,0x00,
+0x72,0xce,0x00,0x00,0x00,0xea,0x00,0xe9,0x61,0x01,0x51,0x00,0xfc,0x00,0xff,0xfe,
+0x17,0x01,0x1d,0x02,0x65,0x01,0x01,0x6f,0x00,0x4f,0xfd,0xfe,0x00,0xfc,0x97,0x00,
+0x0b,0x10,0xfa,0x3e,0x00,0x06,0x5f,0x00,0x09,0x7b,0x02,0xb1,0xe0,0xde,0x00,0x00,
+0xf1,0xfd,0xe5,0xfe,0x02,0x00,0x02,0x60,0x00,0xd3,0xeb,0xf5,0x00,0xf5,0xe6,0xf8,
+0xf7,0x00,0xf8,0xf6,0xfa,0xf6,0xf9,0x5e,0x01,0x66,0xe5,0xec,0x00,0x00,0xf7,0xfe,
+0x2b,0x01,0xa2,0xfa,0xfb,0x00,0x00,0xfa,0xfc,0x00,0x00,0xfd,0xff,0x39,0x01,0x00,
+0x05,0x00,0x22,0xee,0xf9,0xb4,0x02,0x13,0x02,0x24,0x00,0x22,0xfc,0xfc,0x6c,0x01,
+0x01,0x37,0x00,0x04,0xb8,0x00,0x14,0xed,0x45,0x01,0x1a,0x02,0x20,0x01,0x14,0xfc,
+0xcd,0x00,0xe0,0x03,0xfa,0xe3,0xed,0x00,0x00,0xed,0xfc,0xf4,0xfe,0x02,0xf4,0x02,
+0x02,0x92,0x00,0xe6,0xf8,0xf8,0xfd,0xfb,0xf8,0xfb,0xf9,0xfd,0xfb,0xfe,0x00,0xfd,
+0xfc,0x02,0xc5,0x00,0x2e,0x02,0xfd,0x68,0x01,0x08,0xf8,0x01,0x05,0x4d,0x02,0x1f,
+0xfe,0x14,0x01,0x03,0x0e,0x17,0x00,0x0e,0x1d,0x00,0x0f,0x57,0x01,0x0a,0x10,0xff,
+0x6e,0x02,0x0c,0xbd,0x02,0x0f,0x6c,0x00,0x27,0x1e,0x02,0xbd,0x03,0x19,0x02,0x71,
+0x02,0x10,0x02,0x7d,0x03,0x0f,0x01,0x00,0x24,0x0b,0x81,0x00,0x1f,0xf5,0x2c,0x00,
+0x0b,0x23,0xfd,0xfe,0xa2,0x01,0x1c,0xea,0x6c,0x02,0x20,0xfe,0x03,0x14,0x01,0x3e,
+0x06,0x00,0x02,0x89,0x02,0x0a,0x94,0x02,0x0a,0x58,0x03,0x1c,0xeb,0x63,0x00,0x2d,
+0xfe,0x02,0x14,0x01,0x1f,0xf1,0xd8,0x00,0x24,0x1f,0xfb,0x24,0x00,0x10,0x1f,0xfe,
+0x19,0x00,0x1b,0x23,0x00,0x01,0xd5,0x02,0x11,0x03,0x90,0x0c,0x2d,0x04,0x05,0x21,
+0x00,0xf1,0x0c,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,
+0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,
+0xff,0x0d,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,
+0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x00,0x01,0x00,
+0x5e,0x02,0xce,0x00,0x20,0x03,0x02,0xc9,0x00,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,
+0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xf1,
+0x08,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x00,0x00,
+0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,
+0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x8f,0x00,0x1e,
+0x1f,0x24,0xc8,0x00,0x25,0x50,0x00,0x00,0x00,0x00,0x00,0xf0,0xbd,0x0f,0xf6,0x0e,
+0xf6,0x0e,0xf5,0x0d,0xf5,0x0d,0xf4,0x0c,0xf4,0x0c,0xf3,0x0b,0xf3,0x02,0x30,0x03,
+0x60,0x0f,0xf6,0x0b,0xe3,0x8f,0x1f,0xa8,0xf0,0xf9,0x8f,0x0f,0x78,0xd0,0xf6,0x36,
+0x07,0x20,0x00,0x06,0xf0,0x7f,0x00,0x00,0x09,0xd0,0xac,0x00,0x00,0x0c,0xa0,0xd9,
+0x00,0x0e,0xff,0xff,0xff,0xf3,0x06,0x8f,0x98,0xf8,0x61,0x00,0x4f,0x25,0xf1,0x00,
+0x01,0x7f,0x28,0xf1,0x10,0x8f,0xff,0xff,0xff,0xa0,0x24,0xdc,0x4e,0xb4,0x20,0x00,
+0xe8,0x0f,0x70,0x00,0x00,0xf5,0x1f,0x40,0x00,0x03,0xf3,0x4f,0x20,0x00,0x00,0x00,
+0x74,0x00,0x00,0x00,0x0c,0x70,0x00,0x00,0x3a,0xfe,0x70,0x00,0x3f,0xff,0xff,0xa0,
+0x0a,0xfb,0x05,0xff,0x20,0xcf,0x70,0x0d,0xf5,0x0a,0xfc,0x10,0x00,0x00,0x3f,0xff,
+0x91,0x00,0x00,0x3c,0xff,0xf4,0x00,0x00,0x03,0xcf,0xf1,0x18,0x70,0x00,0xef,0x52,
+0xff,0x30,0x0e,0xf5,0x0c,0xfe,0x8b,0xff,0x20,0x2d,0xff,0xff,0x60,0x00,0x03,0xf8,
+0x10,0x00,0x00,0x0e,0x50,0x00,0x05,0xdf,0xa0,0x00,0x00,0x00,0x1f,0xb7,0xf7,0x01,
+0x80,0x00,0x3f,0x40,0xda,0x0a,0xc0,0x00,0x2f,0x82,0xf9,0x3f,0x30,0x00,0x09,0xff,
+0xe2,0xd9,0x00,0x00,0x00,0x23,0x07,0xe1,0x00,0x20,0x00,0x10,0x60,0x06,0x00,0xf0,
+0x57,0xac,0x2c,0xfe,0x50,0x00,0x04,0xf3,0xae,0x5b,0xf0,0x00,0x0d,0x90,0xcb,0x06,
+0xf1,0x00,0x2c,0x10,0xae,0x6c,0xf0,0x00,0x00,0x00,0x1b,0xfd,0x40,0x00,0x3c,0xfd,
+0x50,0x00,0x00,0x1e,0xff,0xff,0x30,0x00,0x05,0xfb,0x08,0xf7,0x00,0x00,0x6f,0xa0,
+0x8f,0x60,0x00,0x02,0xff,0xaf,0xd0,0x00,0x00,0x09,0xff,0xb1,0x00,0x00,0x05,0xff,
+0xfc,0x04,0xd8,0x02,0xff,0x6e,0xf9,0x7f,0x80,0x6f,0xe0,0x3f,0xff,0xf4,0x05,0xff,
+0x10,0x6f,0xfd,0x00,0x0d,0xfe,0xcf,0xff,0xe2,0x00,0x19,0xef,0xd8,0xaf,0xd0,0x8f,
+0x28,0xf2,0x8f,0x18,0xf0,0x47,0x00,0x01,0x00,0xf1,0x07,0x03,0xe1,0x00,0x1e,0xd1,
+0x00,0xaf,0x20,0x02,0xfa,0x00,0x08,0xf5,0x00,0x0b,0xf2,0x00,0x0e,0xf0,0x00,0x0f,
+0xe0,0x03,0x00,0xf0,0x36,0xf0,0x00,0x0d,0xf0,0x00,0x0a,0xf3,0x00,0x05,0xf7,0x00,
+0x00,0xee,0x00,0x00,0x6f,0x70,0x00,0x09,0xf2,0x00,0x00,0x70,0x00,0x00,0x07,0xb0,
+0x00,0x4f,0xa0,0x00,0x8f,0x50,0x01,0xfd,0x00,0x0c,0xf3,0x00,0x8f,0x70,0x06,0xfa,
+0x00,0x5f,0xb0,0x04,0xfc,0x00,0x5f,0xa0,0x06,0xf8,0x00,0x9f,0x50,0x0d,0xf0,0x04,
+0xf9,0x00,0xcf,0x10,0x8f,0x40,0x04,0x30,0x00,0x00,0x4b,0x01,0xf1,0x08,0x0f,0x60,
+0x00,0x8d,0x6e,0x89,0xd0,0x5b,0xff,0xfe,0x90,0x00,0xaf,0xe1,0x00,0x07,0xf4,0xeb,
+0x00,0x09,0x90,0x6d,0x10,0x80,0x00,0xf0,0x02,0x07,0xa4,0x00,0x00,0x00,0xbf,0x60,
+0x00,0x00,0x0b,0xf6,0x00,0x01,0x22,0xcf,0x72,0x20,0x88,0x01,0x50,0x48,0xff,0xff,
+0xff,0xf4,0x12,0x00,0x05,0x1b,0x00,0xf9,0x1a,0x00,0x0e,0xf0,0xef,0x0f,0xd4,0xf8,
+0x5c,0x00,0x2e,0xee,0xe3,0x2f,0xff,0xf4,0x03,0x70,0x0f,0xf7,0x0a,0xf4,0x00,0x00,
+0x1f,0x90,0x00,0x06,0xf4,0x00,0x00,0xbe,0x00,0x00,0x0f,0xa0,0x00,0x05,0xf5,0x00,
+0x00,0xaf,0x0a,0x00,0xff,0x41,0xb0,0x00,0x04,0xf6,0x00,0x00,0xaf,0x10,0x00,0x0e,
+0xb0,0x00,0x00,0x00,0x6d,0xfe,0x80,0x00,0x6f,0xff,0xff,0x90,0x0e,0xf8,0x05,0xff,
+0x12,0xff,0x10,0x0e,0xf4,0x3f,0xf0,0x00,0xdf,0x64,0xff,0x00,0x0d,0xf7,0x4f,0xf0,
+0x00,0xdf,0x73,0xff,0x00,0x0d,0xf6,0x2f,0xf1,0x00,0xef,0x40,0xef,0x80,0x5f,0xf1,
+0x06,0xff,0xff,0xf9,0x00,0x06,0xdf,0xe8,0x00,0x00,0x16,0xc4,0x3a,0xff,0xf4,0xbf,
+0xff,0xf4,0x65,0x0f,0xf4,0x00,0x03,0x00,0x05,0xf1,0x35,0x7d,0xfd,0x80,0x00,0xaf,
+0xff,0xff,0xa0,0x2f,0xf4,0x06,0xff,0x05,0xec,0x00,0x1f,0xf2,0x00,0x00,0x04,0xff,
+0x00,0x00,0x00,0xdf,0x80,0x00,0x00,0xbf,0xd0,0x00,0x00,0xaf,0xe2,0x00,0x00,0x8f,
+0xf3,0x00,0x00,0x6f,0xf4,0x00,0x00,0x2f,0xff,0xee,0xee,0x83,0xff,0xff,0xff,0xf9,
+0x01,0x9e,0xfd,0x70,0x00,0xcf,0xfe,0xff,0xa0,0x3f,0xf3,0x05,0xff,0x11,0x33,0x36,
+0x00,0xf0,0x37,0x08,0xfe,0x00,0x00,0xef,0xfd,0x20,0x00,0x0c,0xef,0xf7,0x00,0x00,
+0x00,0x3f,0xf2,0x25,0x40,0x00,0xef,0x56,0xff,0x20,0x4f,0xf4,0x0d,0xff,0xef,0xfc,
+0x00,0x19,0xdf,0xd8,0x00,0x00,0x00,0x2f,0xf7,0x00,0x00,0x0c,0xff,0x70,0x00,0x06,
+0xff,0xf7,0x00,0x01,0xee,0xdf,0x70,0x00,0xaf,0x5c,0xf7,0x00,0x4f,0xb0,0xcf,0x70,
+0x0d,0xf1,0x0c,0xf7,0x07,0xff,0xee,0xff,0xfa,0x43,0x01,0xa0,0xc0,0x00,0x00,0xcf,
+0x70,0x00,0x00,0x0c,0xf7,0x00,0x09,0x00,0xf0,0x11,0x04,0xff,0xff,0xff,0x20,0x6f,
+0xff,0xff,0xf2,0x08,0xf9,0x00,0x00,0x00,0x9f,0x70,0x00,0x00,0x0b,0xfc,0xef,0xb1,
+0x00,0xdf,0xfd,0xff,0xd0,0x01,0x51,0x03,0xff,0x40,0x29,0x00,0xf0,0x31,0x17,0x70,
+0x00,0xcf,0x70,0xff,0x70,0x3f,0xf4,0x07,0xff,0xff,0xfc,0x00,0x06,0xdf,0xe9,0x00,
+0x00,0x02,0x9d,0xe0,0x00,0x05,0xff,0xfe,0x00,0x02,0xff,0x92,0x00,0x00,0xaf,0xa0,
+0x00,0x00,0x0f,0xf8,0xdf,0xc3,0x02,0xff,0xff,0xff,0xe0,0x3f,0xf7,0x02,0xff,0x63,
+0xff,0x00,0x0b,0xf8,0x1f,0xf2,0x00,0xbf,0x90,0xdf,0x90,0x2f,0xf5,0x04,0x36,0x00,
+0x31,0x04,0xcf,0xe9,0x49,0x03,0xf0,0x07,0x87,0xee,0xee,0xef,0xf6,0x00,0x00,0x02,
+0xff,0x10,0x00,0x00,0x8f,0x90,0x00,0x00,0x0f,0xf3,0x00,0x00,0x06,0xfc,0x12,0x01,
+0x90,0x60,0x00,0x00,0x4f,0xe0,0x00,0x00,0x0b,0xf8,0x1e,0x00,0x90,0x20,0x00,0x00,
+0x9f,0xb0,0x00,0x00,0x1f,0xf5,0x9e,0x01,0xf0,0x13,0xfd,0x80,0x00,0x7f,0xff,0xff,
+0xa0,0x0d,0xf8,0x05,0xff,0x00,0xff,0x40,0x1f,0xf2,0x0c,0xf9,0x07,0xfe,0x00,0x2d,
+0xff,0xfe,0x30,0x04,0xff,0xff,0xf6,0x00,0xef,0x60,0x3f,0xf2,0xb0,0x01,0xf0,0x03,
+0x62,0xff,0x50,0x3f,0xf5,0x0b,0xff,0xef,0xfd,0x00,0x08,0xdf,0xe9,0x10,0x00,0x6d,
+0xfd,0x50,0x36,0x00,0xf0,0x00,0x50,0x0f,0xf7,0x07,0xfe,0x04,0xff,0x00,0x0f,0xf3,
+0x4f,0xf0,0x00,0xef,0x51,0x24,0x00,0xf2,0x13,0x0a,0xff,0xdf,0xff,0x40,0x0a,0xfe,
+0x8f,0xf2,0x00,0x00,0x05,0xfe,0x00,0x00,0x15,0xef,0x70,0x00,0x9f,0xff,0xb0,0x00,
+0x09,0xfc,0x60,0x00,0x0a,0xe3,0x0f,0xf7,0x03,0x70,0x00,0x00,0x03,0x00,0x4a,0x02,
+0x83,0xe3,0x0c,0xe2,0x1f,0xf5,0x04,0x60,0x00,0x01,0x00,0xa4,0x0b,0xf2,0x0b,0xf2,
+0x0d,0xf0,0x2f,0xa0,0x3d,0x20,0x12,0x00,0xf0,0x17,0x04,0xb2,0x00,0x06,0xdf,0xf2,
+0x18,0xef,0xfe,0x80,0x9f,0xfa,0x40,0x00,0x9f,0xfc,0x60,0x00,0x06,0xdf,0xff,0xa1,
+0x00,0x04,0xbf,0xf2,0x00,0x00,0x02,0x92,0xff,0xff,0xff,0xf0,0xde,0xee,0xee,0xe0,
+0x2a,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0xf0,0x3f,0x0c,0x50,0x00,0x00,0x1f,0xfd,
+0x70,0x00,0x07,0xdf,0xff,0x92,0x00,0x03,0x9e,0xfc,0x00,0x05,0xbf,0xfb,0x09,0xef,
+0xfe,0x71,0x1f,0xfc,0x50,0x00,0x0a,0x30,0x00,0x00,0x03,0xbf,0xeb,0x20,0x2f,0xff,
+0xff,0xe0,0x8f,0xd0,0x2f,0xf4,0x24,0x20,0x0f,0xf5,0x00,0x00,0x6f,0xf1,0x00,0x05,
+0xff,0x50,0x00,0x0f,0xf6,0x00,0x00,0x3f,0xd0,0x00,0x00,0x14,0x30,0x00,0x00,0x06,
+0x30,0x00,0x00,0x7f,0xf0,0x00,0x00,0x3e,0xbf,0x02,0xf2,0x45,0x3a,0xdf,0xeb,0x40,
+0x00,0x00,0x08,0xfc,0x75,0x6b,0xf9,0x00,0x00,0x8f,0x60,0x01,0x00,0x4f,0x70,0x03,
+0xf8,0x01,0xcf,0xfa,0x07,0xf1,0x0a,0xe0,0x0c,0xf6,0xbf,0x01,0xf5,0x0f,0x90,0x5f,
+0x60,0x9f,0x00,0xd8,0x2f,0x50,0xaf,0x10,0xae,0x00,0xb9,0x4f,0x30,0xde,0x00,0xbd,
+0x00,0xca,0x4f,0x30,0xed,0x00,0xcc,0x00,0xd7,0x3f,0x50,0xde,0x00,0xfb,0x02,0xf4,
+0x0f,0x80,0x9f,0x8b,0xfe,0x6d,0xc0,0x0b,0xe1,0x1c,0xfa,0x2d,0xfb,0x10,0x02,0xfc,
+0x84,0x03,0xb0,0x5f,0xfa,0x77,0x99,0x00,0x00,0x00,0x02,0x8d,0xff,0xc6,0x0f,0x00,
+0x30,0xef,0xa0,0x00,0xd6,0x04,0x10,0x00,0x4f,0x04,0x10,0xf5,0x10,0x00,0xf0,0x71,
+0xdf,0xb0,0x00,0x00,0x4f,0xf4,0xff,0x10,0x00,0x0a,0xfb,0x0e,0xf6,0x00,0x00,0xff,
+0x60,0xaf,0xc0,0x00,0x5f,0xf1,0x05,0xff,0x20,0x0b,0xff,0xff,0xff,0xf7,0x01,0xff,
+0xff,0xff,0xff,0xd0,0x6f,0xf2,0x00,0x05,0xff,0x2c,0xfb,0x00,0x00,0x0e,0xf8,0xff,
+0xff,0xfd,0x80,0x0f,0xff,0xff,0xff,0xb0,0xff,0x50,0x08,0xff,0x1f,0xf5,0x00,0x2f,
+0xf2,0xff,0x50,0x08,0xfe,0x0f,0xff,0xff,0xfe,0x30,0xff,0xdc,0xcf,0xfa,0x0f,0xf5,
+0x00,0x2f,0xf4,0xff,0x50,0x00,0xef,0x7f,0xf5,0x00,0x5f,0xf5,0xff,0xff,0xff,0xfd,
+0x0f,0xff,0xff,0xd9,0x10,0x00,0x19,0xef,0xe9,0x10,0x01,0xdf,0xff,0xff,0xd1,0x0a,
+0xfe,0x30,0x3e,0xf8,0x0f,0xf6,0x00,0x08,0xfd,0x3f,0xf2,0x00,0x00,0x21,0x4f,0xf0,
+0xa3,0x00,0x00,0x05,0x00,0x00,0x0f,0x00,0xf1,0x01,0x11,0x0f,0xf5,0x00,0x08,0xfd,
+0x0a,0xfd,0x30,0x3e,0xf9,0x01,0xef,0xff,0xff,0xd1,0x37,0x00,0x00,0x40,0x00,0x02,
+0x60,0x00,0x30,0x50,0x3c,0xfd,0x60,0x00,0xf0,0x1a,0xf5,0xff,0x50,0x00,0xcf,0x9f,
+0xf5,0x00,0x0a,0xfb,0xff,0x50,0x00,0xaf,0xbf,0xf5,0x00,0x0c,0xf9,0xff,0x50,0x02,
+0xff,0x5f,0xf5,0x03,0xcf,0xd0,0xff,0xff,0xff,0xe3,0x0f,0xff,0xfe,0x92,0x00,0xff,
+0xff,0xff,0xfa,0x89,0x03,0x44,0xff,0x50,0x00,0x00,0x04,0x00,0x00,0xcb,0x00,0x4b,
+0xff,0xfe,0xee,0xc0,0x14,0x00,0x13,0xf9,0x2c,0x00,0x11,0xf6,0x04,0x00,0x0c,0x30,
+0x00,0x00,0x04,0x00,0x08,0x14,0x00,0x03,0x04,0x00,0xf0,0x09,0x00,0x18,0xdf,0xea,
+0x20,0x00,0x1d,0xff,0xff,0xfe,0x10,0x09,0xff,0x40,0x2e,0xf9,0x00,0xef,0x70,0x00,
+0x6f,0xe0,0x2f,0xf3,0x76,0x02,0x10,0xff,0x5b,0x02,0xf0,0x09,0x4f,0xf2,0x07,0xff,
+0xff,0x02,0xff,0x30,0x5d,0xdf,0xf0,0x0e,0xf8,0x00,0x05,0xff,0x00,0x8f,0xf5,0x00,
+0x8f,0xf0,0x00,0xdf,0x4a,0x03,0x40,0x00,0x8d,0xfe,0xc6,0x46,0x00,0x2f,0x1f,0xf4,
+0x05,0x00,0x02,0x00,0x21,0x05,0x02,0x05,0x00,0x0f,0x23,0x00,0x05,0x3b,0xdf,0x8d,
+0xf8,0x03,0x00,0x4f,0x00,0x00,0x06,0xff,0x04,0x00,0x09,0xf0,0x01,0x6a,0x70,0x06,
+0xfe,0x8f,0xe1,0x1c,0xfb,0x1f,0xff,0xff,0xf3,0x02,0xbe,0xfc,0x40,0x32,0x01,0xf0,
+0x09,0xc0,0xff,0x50,0x0c,0xfe,0x10,0xff,0x50,0x8f,0xf4,0x00,0xff,0x54,0xff,0x80,
+0x00,0xff,0x7e,0xfc,0x00,0x00,0xff,0xef,0xf5,0xfa,0x00,0xf0,0x08,0xfd,0x00,0x00,
+0xff,0xf8,0xff,0x70,0x00,0xff,0x80,0xaf,0xf2,0x00,0xff,0x50,0x1e,0xfb,0x00,0xff,
+0x50,0x06,0xff,0x50,0x7b,0x01,0x1e,0xe1,0x10,0x01,0x0e,0x04,0x00,0x03,0x40,0x01,
+0x11,0xf5,0x04,0x00,0x40,0xf3,0x00,0x00,0x4f,0x74,0x05,0x40,0x00,0x9f,0xff,0xff,
+0x05,0x05,0xf0,0x1a,0xff,0xff,0xdf,0x40,0x04,0xfd,0xff,0xff,0x9f,0x90,0x09,0xf9,
+0xff,0xff,0x4f,0xe0,0x0e,0xf4,0xff,0xff,0x4b,0xf4,0x4f,0xb4,0xff,0xff,0x45,0xf9,
+0x9f,0x54,0xff,0xff,0x50,0xfe,0xef,0x05,0xff,0xff,0x50,0xaf,0xfa,0x06,0x00,0x30,
+0x5f,0xf5,0x05,0x04,0x04,0x50,0xf0,0x05,0xff,0xff,0xa0,0x00,0x01,0x10,0xf3,0x05,
+0x00,0x11,0xfc,0x28,0x01,0xf0,0x0d,0x60,0x1f,0xf4,0xff,0xcf,0xe0,0x1f,0xf4,0xff,
+0x5d,0xf8,0x1f,0xf4,0xff,0x54,0xff,0x3f,0xf4,0xff,0x50,0xaf,0xcf,0xf4,0xff,0x50,
+0x2f,0xff,0xf4,0xa0,0x02,0x01,0x8a,0x02,0x00,0x05,0x00,0xf0,0x21,0x5f,0xf4,0x00,
+0x08,0xdf,0xd8,0x10,0x00,0x0d,0xff,0xff,0xfd,0x10,0x09,0xff,0x51,0x4e,0xf9,0x00,
+0xff,0x70,0x00,0x7f,0xf0,0x3f,0xf2,0x00,0x02,0xff,0x34,0xff,0x10,0x00,0x0f,0xf5,
+0x4f,0xf1,0x00,0x00,0xff,0x53,0xff,0x20,0x00,0x2f,0xf3,0x0f,0xf7,0x35,0x01,0x70,
+0x9f,0xf5,0x04,0xef,0x90,0x00,0xdf,0x87,0x02,0x53,0x00,0x8d,0xfd,0x81,0x00,0xfa,
+0x02,0x00,0x0f,0x02,0xf0,0x01,0x05,0xff,0x6f,0xf5,0x00,0x0b,0xfa,0xff,0x50,0x00,
+0xbf,0xbf,0xf5,0x00,0x4f,0xf7,0xe8,0x02,0x50,0x1f,0xff,0xff,0xe9,0x10,0xf6,0x00,
+0x10,0x0f,0x57,0x03,0x05,0x09,0x00,0x20,0x00,0x08,0xd8,0x05,0x13,0x1d,0x78,0x00,
+0x18,0x5f,0x78,0x00,0x20,0x35,0xff,0x24,0x00,0x28,0x5f,0xf0,0x78,0x00,0x57,0x07,
+0xff,0x00,0x9f,0xf4,0x78,0x00,0x20,0xff,0xfd,0x4c,0x02,0x20,0x2d,0xfe,0xcc,0x03,
+0x90,0x0a,0x50,0xff,0xff,0xfd,0x70,0x0f,0xff,0xff,0xb9,0x01,0x60,0x07,0xff,0x4f,
+0xf5,0x00,0x0f,0xaf,0x02,0x00,0x8c,0x00,0x20,0x8f,0xf2,0xad,0x03,0x10,0x0f,0x64,
+0x01,0xc0,0xff,0x50,0x7f,0xf1,0x0f,0xf5,0x00,0xef,0x80,0xff,0x50,0x06,0xa1,0x03,
+0xf0,0x11,0x0e,0xf9,0x00,0x5c,0xff,0xc6,0x00,0x07,0xff,0xff,0xff,0x80,0x0f,0xf9,
+0x00,0x8f,0xf1,0x1f,0xf5,0x00,0x1a,0xa2,0x0c,0xfe,0x60,0x00,0x00,0x02,0xdf,0xff,
+0xa2,0x00,0xc5,0x04,0x10,0x40,0xdf,0x08,0xc0,0xe0,0x5d,0xc0,0x00,0x2f,0xf3,0x2f,
+0xf7,0x00,0x6f,0xf2,0x09,0xe1,0x03,0x60,0x00,0x5c,0xff,0xd7,0x00,0xbf,0x20,0x03,
+0x20,0xaf,0xff,0x59,0x00,0x10,0x04,0xf0,0x05,0x0f,0x05,0x00,0x19,0x5f,0x1f,0xf4,
+0x00,0x0b,0xfa,0x05,0x00,0x0f,0xc1,0xf9,0x0f,0xf5,0x00,0x0d,0xf8,0x0c,0xfc,0x20,
+0x5f,0xf5,0x03,0x78,0x00,0xf2,0x00,0x3b,0xff,0xd8,0x00,0xcf,0xc0,0x00,0x05,0xff,
+0x37,0xff,0x10,0x00,0xaf,0xe0,0xc4,0x00,0xf0,0x0f,0xcf,0xa0,0x03,0xff,0x40,0x07,
+0xfe,0x00,0x8f,0xe0,0x00,0x2f,0xf3,0x0c,0xf9,0x00,0x00,0xcf,0x81,0xff,0x40,0x00,
+0x07,0xfc,0x5f,0xe0,0x00,0x00,0x2f,0xfc,0xf9,0x06,0x01,0xc7,0x00,0x30,0x07,0xff,
+0xe0,0x46,0x07,0x10,0xf9,0x7c,0x06,0xf0,0x31,0x01,0xff,0x10,0x0b,0xfa,0x6f,0xe0,
+0x04,0xff,0x50,0x0d,0xf6,0x3f,0xf1,0x08,0xff,0x90,0x0f,0xf3,0x0f,0xf3,0x0b,0xff,
+0xc0,0x3f,0xf0,0x0c,0xf6,0x0f,0xed,0xf0,0x6f,0xc0,0x09,0xf9,0x2f,0xaa,0xf3,0x9f,
+0x90,0x05,0xfc,0x6f,0x66,0xf7,0xcf,0x60,0x02,0xff,0xaf,0x32,0xfa,0xff,0x20,0x00,
+0xef,0xff,0x00,0xff,0xff,0x00,0x00,0xbf,0xfb,0x03,0x00,0x60,0x00,0x8f,0xf8,0x00,
+0x7f,0xf8,0x22,0x05,0xf0,0x08,0x00,0x4f,0xf5,0x00,0x7f,0xf3,0x00,0x1f,0xfa,0x0d,
+0xfb,0x00,0x8f,0xf1,0x05,0xff,0x41,0xff,0x80,0x00,0xcf,0xc9,0xfe,0x4d,0x05,0xb0,
+0xf6,0x00,0x00,0x0a,0xff,0xd0,0x00,0x00,0x0b,0xff,0xe0,0xe9,0x02,0xf0,0x1f,0xf7,
+0x00,0x00,0xdf,0xb8,0xff,0x10,0x06,0xff,0x31,0xff,0x90,0x0e,0xfa,0x00,0x8f,0xf2,
+0x8f,0xf2,0x00,0x0e,0xfb,0xbf,0xc0,0x00,0x0e,0xfa,0x4f,0xf3,0x00,0x5f,0xf2,0x0c,
+0xfa,0x00,0xcf,0xa0,0x04,0xff,0x23,0xff,0x20,0x00,0xcf,0x8a,0xfa,0x32,0x00,0x10,
+0xf3,0xf5,0x07,0x10,0xb0,0xdd,0x09,0x10,0x30,0x3b,0x01,0x1b,0x20,0x05,0x00,0x00,
+0xd9,0x08,0x30,0xff,0xf1,0x6f,0x7a,0x06,0x00,0x59,0x07,0xa0,0x60,0x00,0x00,0x0c,
+0xfb,0x00,0x00,0x00,0x7f,0xf2,0x0e,0x00,0x00,0x08,0x08,0x00,0x7d,0x07,0x60,0x6f,
+0xf2,0x00,0x00,0x01,0xff,0xfd,0x07,0x10,0xfd,0x53,0x05,0x00,0x05,0x0b,0x10,0x6f,
+0x05,0x00,0xaf,0x0d,0xdd,0x41,0xff,0xf5,0x1f,0xf3,0x01,0xff,0x30,0x05,0x00,0x0a,
+0xf2,0x03,0xd4,0x1f,0xff,0x50,0xdf,0x70,0x00,0x00,0x7f,0xd0,0x00,0x00,0x1f,0xf3,
+0x00,0x00,0x0b,0xf9,0x5b,0x07,0x01,0xca,0x02,0x00,0x1e,0x08,0x00,0x20,0x03,0x20,
+0x0e,0xf6,0xa4,0x06,0x03,0xdd,0x07,0xbf,0xcf,0x80,0x00,0x00,0x6f,0xd0,0xbd,0xd6,
+0xef,0xf7,0x0c,0x02,0x00,0x06,0xf0,0x25,0xbf,0xf7,0xef,0xf7,0x00,0x8f,0x80,0x00,
+0x0e,0xfe,0x00,0x04,0xfc,0xf4,0x00,0xaf,0x2f,0xa0,0x1f,0xa0,0xaf,0x17,0xf5,0x04,
+0xf7,0xdd,0xdd,0xdd,0xd1,0xff,0xff,0xff,0xf2,0x38,0x80,0x00,0xbf,0x80,0x00,0xdf,
+0x20,0x01,0x9e,0xfc,0x50,0x00,0xcf,0xed,0xff,0x40,0x3f,0xf1,0x7a,0x00,0xf3,0x0d,
+0x01,0x9f,0xb0,0x04,0xcf,0xff,0xfb,0x02,0xff,0x74,0xaf,0xb0,0x6f,0xd0,0x0a,0xfb,
+0x03,0xff,0xee,0xff,0xb0,0x05,0xdf,0xb7,0xfe,0x00,0x2f,0xf2,0x7f,0x00,0x02,0x09,
+0x00,0xf0,0x08,0x7d,0xfb,0x10,0x2f,0xff,0xff,0xfc,0x02,0xff,0x60,0x4f,0xf3,0x2f,
+0xf2,0x00,0xdf,0x52,0xff,0x20,0x0c,0xf7,0x2f,0xf2,0x4b,0x08,0x32,0x60,0x3f,0xf3,
+0x1b,0x00,0xf0,0x06,0x6e,0xfb,0x10,0x00,0x8e,0xfd,0x50,0x0a,0xff,0xff,0xf5,0x2f,
+0xf4,0x08,0xfc,0x6f,0xd0,0x01,0x65,0x7f,0xc0,0xbc,0x00,0xe9,0x00,0x22,0x2f,0xf4,
+0x07,0xfc,0x0a,0xff,0xef,0xf6,0x00,0x8e,0xfd,0x60,0x58,0x00,0x50,0x20,0x1a,0xfd,
+0x7f,0xf2,0x02,0x07,0xf0,0x0b,0x22,0xff,0x50,0x7f,0xf2,0x5f,0xe0,0x02,0xff,0x27,
+0xfc,0x00,0x2f,0xf2,0x5f,0xd0,0x02,0xff,0x22,0xff,0x30,0x5f,0xf2,0x0b,0xff,0xdf,
+0x24,0x00,0xf0,0x05,0x6f,0xf2,0x00,0x6d,0xfd,0x70,0x00,0x8f,0xff,0xff,0x70,0x1f,
+0xf5,0x04,0xff,0x05,0xff,0x99,0x9f,0xf2,0x76,0x01,0x20,0x35,0xff,0xee,0x0b,0x30,
+0xf9,0x00,0x85,0x1b,0x00,0xfe,0x09,0xd0,0x00,0x6d,0xfe,0xa1,0x00,0x00,0x6d,0xfa,
+0x04,0xff,0xfa,0x07,0xfd,0x00,0xcf,0xff,0xf7,0x8d,0xfe,0xb5,0x08,0xfc,0x00,0x03,
+0x00,0xf2,0x06,0x00,0xaf,0xe7,0xdf,0x40,0xaf,0xff,0xff,0xf4,0x2f,0xf6,0x04,0xff,
+0x45,0xfe,0x00,0x0f,0xf4,0x6f,0xd0,0x00,0x09,0x00,0x00,0x12,0x00,0x01,0x1b,0x00,
+0xf0,0x05,0x00,0x9f,0xe7,0xff,0x30,0x15,0x00,0x6f,0xf1,0x0b,0xff,0xef,0xf9,0x00,
+0x1a,0xef,0xd7,0x00,0x3f,0xf1,0x74,0x06,0x23,0x10,0x00,0x09,0x00,0xf0,0x06,0x5d,
+0xfb,0x20,0x3f,0xff,0xff,0xfb,0x03,0xff,0x50,0x6f,0xf0,0x3f,0xf1,0x02,0xff,0x13,
+0xff,0x10,0x2f,0xf2,0x09,0x00,0x19,0x23,0x09,0x00,0x8c,0x0c,0xe2,0x1f,0xf4,0x04,
+0x50,0x0f,0xf4,0x02,0x00,0x70,0x00,0xde,0x20,0x1f,0xf4,0x00,0x45,0xfa,0x0a,0x2d,
+0xff,0x40,0x05,0x00,0x7c,0x02,0xff,0x3b,0xff,0xe0,0xaf,0xc3,0x87,0x01,0xf0,0x02,
+0x20,0xaf,0xe1,0x2f,0xf2,0x7f,0xf3,0x02,0xff,0x6f,0xf6,0x00,0x2f,0xff,0xfa,0x00,
+0x02,0xf6,0x00,0xfe,0x03,0x2f,0xfc,0xef,0x70,0x02,0xff,0x26,0xff,0x20,0x2f,0xf2,
+0x0c,0xfc,0x02,0xff,0x20,0x3f,0xf6,0x6e,0x00,0x02,0x02,0x00,0xff,0x12,0x2f,0xf4,
+0xdf,0xc2,0x6e,0xfb,0x12,0xff,0xff,0xff,0xef,0xff,0xfa,0x2f,0xf6,0x06,0xff,0x50,
+0x8f,0xe2,0xff,0x20,0x3f,0xf0,0x04,0xff,0x2f,0xf2,0x03,0xff,0x00,0x4f,0xf2,0x0d,
+0x00,0x06,0x10,0xf0,0x3b,0x00,0x10,0x02,0x13,0x05,0x00,0x37,0x00,0xa0,0x02,0xff,
+0x10,0x2f,0xf1,0x2f,0xf1,0x02,0xff,0x22,0xe2,0x00,0x09,0x09,0x00,0x50,0x20,0x00,
+0x7d,0xfd,0x70,0x80,0x06,0xf0,0x0a,0x90,0x2f,0xf6,0x05,0xff,0x26,0xfe,0x00,0x0d,
+0xf6,0x7f,0xc0,0x00,0xcf,0x86,0xfe,0x00,0x0d,0xf7,0x2f,0xf5,0x05,0xff,0x30,0x9f,
+0x5f,0x06,0xf0,0x10,0x7d,0xfe,0x80,0x00,0x2f,0xf7,0xdf,0xb1,0x02,0xff,0xfd,0xff,
+0xb0,0x2f,0xf4,0x03,0xff,0x32,0xff,0x20,0x0d,0xf5,0x2f,0xf2,0x00,0xcf,0x72,0xff,
+0x20,0x0e,0xf5,0x3b,0x00,0x10,0x22,0xa4,0x04,0x48,0x2f,0xf7,0xdf,0xa1,0xff,0x00,
+0xf0,0x01,0x00,0x00,0x01,0xaf,0xe6,0xef,0x20,0xbf,0xff,0xff,0xf2,0x3f,0xf5,0x06,
+0xff,0x25,0xa8,0x02,0x32,0x7f,0xc0,0x02,0x09,0x00,0x41,0x2f,0xf5,0x06,0xff,0x1b,
+0x00,0x39,0x01,0xaf,0xd7,0x34,0x00,0x21,0x2f,0xf2,0xf2,0x0b,0xab,0xea,0x2f,0xff,
+0xfa,0x2f,0xfa,0x31,0x2f,0xf2,0x00,0x03,0x00,0xf0,0x17,0x02,0xae,0xfc,0x40,0x0d,
+0xfd,0xcf,0xf3,0x3f,0xf0,0x0a,0xd7,0x1f,0xfa,0x51,0x00,0x05,0xef,0xff,0x90,0x00,
+0x04,0x8f,0xf7,0x7f,0xb0,0x0a,0xf9,0x2f,0xfc,0xbf,0xf4,0x03,0xbf,0xfc,0x50,0x0b,
+0xf9,0xab,0x03,0x62,0xef,0xff,0xf0,0xae,0xfe,0xb0,0x0c,0x00,0x02,0x03,0x00,0x9e,
+0x0a,0xfa,0x00,0x07,0xff,0xf1,0x01,0xbf,0xe1,0xfa,0x01,0x14,0x3f,0x18,0x01,0xf0,
+0x01,0x1f,0xf4,0x06,0xff,0x20,0xdf,0xff,0xff,0xf2,0x02,0xcf,0xd6,0xff,0x20,0xbf,
+0x90,0x1c,0x03,0xf0,0x36,0x0c,0xf7,0x1f,0xf1,0x1f,0xf2,0x0c,0xf6,0x5f,0xd0,0x07,
+0xfa,0x9f,0x80,0x02,0xfe,0xdf,0x30,0x00,0xdf,0xfe,0x00,0x00,0x8f,0xf9,0x00,0x00,
+0x3f,0xf4,0x00,0xaf,0x70,0x1f,0xd0,0x0c,0xf6,0x6f,0xb0,0x5f,0xf1,0x0f,0xf2,0x2f,
+0xe0,0xaf,0xf5,0x2f,0xe0,0x0e,0xf1,0xee,0xfa,0x5f,0xa0,0x0b,0xf6,0xf8,0xce,0x8f,
+0x60,0x07,0xfe,0xf3,0x8f,0xef,0x30,0x03,0xff,0xf0,0x60,0x0a,0x40,0xff,0xa0,0x0f,
+0xfb,0xe2,0x0d,0xf0,0x1d,0x0a,0xf7,0x00,0x7f,0xe0,0x0c,0xfa,0x00,0xef,0x74,0xff,
+0x20,0x05,0xff,0xdf,0x80,0x00,0x0d,0xff,0xe1,0x00,0x00,0x7f,0xfa,0x00,0x00,0x0e,
+0xff,0xf2,0x00,0x07,0xfe,0xbf,0xa0,0x01,0xff,0x63,0xff,0x30,0x8f,0xd0,0x0a,0xfc,
+0x00,0xf0,0x41,0xcf,0x90,0x08,0xfd,0x07,0xfe,0x00,0xdf,0x70,0x1f,0xf2,0x1f,0xf2,
+0x00,0xcf,0x76,0xfc,0x00,0x06,0xfb,0xaf,0x70,0x00,0x1f,0xff,0xf2,0x00,0x00,0xbf,
+0xfc,0x00,0x00,0x06,0xff,0x60,0x00,0x00,0x1f,0xf1,0x00,0x00,0x08,0xfb,0x00,0x00,
+0x1f,0xff,0x50,0x00,0x01,0xee,0x70,0x00,0x00,0x4f,0xff,0xff,0xf7,0x4e,0xee,0xff,
+0xf5,0x00,0x00,0xdf,0xb0,0x00,0x08,0xfe,0x10,0x00,0x4f,0xf4,0x00,0x01,0xef,0x90,
+0x00,0x0a,0xfd,0x1c,0x00,0xf0,0x05,0xee,0xe8,0x6f,0xff,0xff,0xf9,0x00,0x05,0x80,
+0x00,0x7f,0xc0,0x00,0xff,0x10,0x02,0xfd,0x00,0x03,0xfc,0x03,0x00,0xe3,0x06,0xfa,
+0x00,0x7f,0xf3,0x00,0xaf,0xc0,0x00,0x09,0xf8,0x00,0x04,0xfc,0x15,0x00,0xd9,0x01,
+0xff,0x00,0x00,0xaf,0x90,0x00,0x0a,0xc0,0x00,0x00,0x00,0xab,0x01,0x00,0xf0,0x0c,
+0x01,0x57,0x00,0x07,0xfb,0x00,0x0c,0xf4,0x00,0x8f,0x70,0x08,0xf8,0x00,0x8f,0x80,
+0x05,0xfb,0x00,0x0c,0xfb,0x00,0x8f,0xe0,0x4f,0xd1,0x07,0x0f,0x00,0xf0,0x18,0x08,
+0xf7,0x00,0xaf,0x50,0x4f,0xe0,0x08,0xc2,0x00,0x00,0x00,0x00,0x01,0xae,0xa0,0x01,
 0x94,0x0a,0xff,0xfc,0x27,0xf6,0x0f,0xd1,0x8f,0xff,0xf1,0x1a,0x50,0x07,0xed,0x40,
-0x68,0x0c,0x02,0x72,0x0c,0x22,0x0e,0xe2,0x07,0x00,0xf1,0x03,0xfe,0x30,0x00,0x16,
-0x77,0x77,0x7f,0x7c,0xe3,0x00,0x6f,0xee,0xee,0xee,0x40,0xbf,0x30,0x7e,0x9f,0x0c,
-0x21,0xf4,0x7e,0x43,0x00,0x11,0xfc,0x07,0x00,0x20,0x1c,0xe2,0x4e,0x04,0x92,0x41,
-0xce,0x20,0x05,0x55,0x55,0x5f,0x8d,0xe2,0x38,0x00,0x11,0x20,0x07,0x00,0x12,0xd1,
-0xe2,0x0c,0x01,0xe5,0x0b,0x21,0x05,0xb0,0x0d,0x00,0x21,0x4f,0xf0,0xcf,0x0c,0x11,
-0xfc,0x07,0x00,0xe1,0x3f,0x95,0xfe,0xee,0xee,0xea,0x02,0xea,0x00,0x67,0x77,0x77,
-0xae,0x1e,0x21,0x00,0x31,0x7e,0x4f,0x60,0x07,0x00,0x21,0x08,0xf4,0x07,0x00,0x40,
-0x00,0x9f,0x33,0xff,0xe9,0x09,0xa2,0x0a,0xe8,0xf5,0x55,0x55,0x52,0x00,0x00,0xaf,
-0xf0,0x21,0x0d,0x12,0xf0,0x17,0x0d,0x21,0x30,0x00,0x89,0x00,0x01,0x6e,0x00,0x20,
-0x3e,0xe3,0x6c,0x00,0x30,0xeb,0xbe,0x30,0xaf,0x0c,0x40,0x0b,0xf3,0x00,0x03,0xdb,
-0x01,0xff,0x0a,0x30,0x3f,0xb0,0x00,0x00,0x0b,0xf3,0xef,0xff,0x30,0x03,0xff,0xfe,
-0x35,0x5f,0x50,0x05,0xf5,0x53,0x00,0x0f,0x50,0x05,0xf0,0x00,0x06,0x00,0x01,0x70,
-0x85,0x58,0xf0,0x00,0x00,0x0d,0xff,0x27,0x07,0x30,0x03,0x55,0x55,0x3c,0x10,0x2e,
-0xff,0xff,0x2a,0x00,0x0a,0x06,0x00,0xc0,0xce,0xef,0x50,0x05,0xfe,0xec,0xaf,0xb6,
-0x00,0x00,0x6b,0xfa,0x11,0x10,0x70,0x4f,0xb0,0x00,0xbf,0x40,0x04,0xfb,0x75,0x00,
-0x00,0x7b,0x00,0x00,0xa0,0x07,0x00,0xb0,0x00,0x17,0xb0,0x14,0x19,0x12,0x11,0x07,
-0x00,0x12,0x88,0xbc,0x00,0x00,0x15,0x05,0x00,0xe9,0x0c,0x20,0x90,0x00,0x69,0x03,
-0x20,0xcc,0xf2,0x07,0x00,0x30,0xaf,0x44,0xfa,0x0f,0x0d,0x40,0xfb,0x00,0xbf,0x20,
-0x49,0x00,0x10,0x00,0x4a,0x00,0x20,0x3f,0xa0,0x0b,0x11,0x30,0x00,0xbf,0x20,0x18,
-0x00,0x11,0x04,0x46,0x0f,0xb0,0x40,0x0c,0xfe,0xdd,0xdd,0xdd,0xef,0xc0,0x5f,0xff,
-0xff,0xc3,0x0a,0x01,0x4f,0x00,0x02,0x51,0x0d,0x10,0x9f,0x59,0x0d,0xf0,0x3c,0x02,
-0x26,0xf7,0x4d,0xb0,0x00,0x04,0xdf,0xbb,0xd0,0x07,0xf0,0x00,0x6f,0xc4,0x0d,0xf5,
-0x2c,0xd0,0x02,0xfa,0x00,0x0f,0xff,0xfe,0x30,0x0a,0xe0,0x00,0x3f,0xff,0xc6,0x60,
-0x0e,0x80,0x00,0x6f,0xf8,0x08,0xe0,0x0f,0x60,0x00,0x9e,0x40,0x06,0xf0,0x0e,0x80,
-0x00,0x71,0x00,0x08,0xe0,0x0a,0xd0,0x00,0x00,0x00,0x0d,0xa0,0x03,0xf8,0x00,0x00,
-0x00,0x8f,0x30,0x00,0x7f,0xa3,0x00,0x3a,0xf7,0x00,0xd7,0x03,0x20,0xfe,0x50,0xb9,
-0x01,0x20,0x66,0x40,0x66,0x00,0xf0,0x14,0x66,0x66,0x63,0x00,0x00,0x00,0x20,0xcf,
-0xff,0xf2,0x50,0x00,0x03,0xf8,0x1e,0xff,0x65,0xf9,0x00,0x16,0xb8,0x03,0xfb,0x02,
-0xa7,0x70,0x6f,0xa0,0x00,0x51,0x00,0x3f,0xb0,0x49,0x30,0x5b,0x11,0x30,0x93,0xef,
-0x20,0x5e,0x0a,0x30,0xf6,0x49,0x10,0x0e,0x00,0x31,0x71,0xaf,0x60,0x3d,0x02,0xf0,
-0x0b,0x36,0xa1,0x00,0x00,0x00,0x6b,0x30,0x0a,0xf8,0x20,0x00,0x06,0x8f,0x50,0x01,
-0x4c,0xe7,0x68,0x8f,0xb1,0x00,0x00,0x0a,0x6e,0xac,0xc6,0x62,0x00,0x36,0x06,0x44,
-0x40,0x2b,0x01,0xf0,0x1c,0x8e,0x34,0x78,0x61,0x00,0x00,0x07,0xfd,0xff,0xfe,0xff,
-0x91,0x00,0x6f,0x70,0xbf,0x40,0x06,0xed,0x10,0x8f,0x50,0x0a,0xf5,0x00,0x2e,0xb0,
-0x0d,0xf6,0x00,0xed,0x00,0x03,0xf4,0x1f,0xcf,0x7a,0xf4,0x00,0x00,0xd9,0x3f,0x37,
-0x5a,0x09,0x40,0xab,0x3f,0x20,0x53,0x16,0x03,0x20,0x1f,0x50,0x3d,0x00,0x30,0xd8,
-0x0b,0xc0,0xb2,0x00,0x20,0xf3,0x02,0xcb,0x00,0xf0,0x00,0x2e,0xa0,0x00,0x6f,0xb4,
-0x00,0x17,0xfc,0x10,0x00,0x03,0xcf,0xff,0xff,0x80,0x5f,0x01,0x21,0x56,0x40,0x8e,
-0x01,0x10,0x10,0xf0,0x00,0x00,0x5f,0x0d,0xf0,0x00,0x00,0x2f,0xe9,0x99,0x9b,0xf4,
-0x00,0x7f,0x70,0x00,0x09,0xd0,0x00,0xcf,0x10,0x3a,0x12,0xf0,0x1f,0xfc,0x00,0x00,
-0x9f,0x10,0x00,0x9f,0x10,0x1c,0xd3,0x00,0x06,0xff,0x70,0xe9,0x00,0x00,0x3f,0x8c,
-0x75,0xf9,0x00,0x00,0xbc,0x0e,0x2c,0xaf,0x00,0x00,0xd9,0x2d,0x1a,0x3f,0x20,0x00,
-0xbc,0x01,0x00,0x6f,0x00,0x00,0x4f,0x80,0x04,0xe9,0x00,0xc1,0x0a,0x00,0xe9,0x01,
-0x31,0x27,0x74,0x00,0xc6,0x01,0x21,0xff,0xa0,0x06,0x00,0x90,0xb1,0x10,0x1f,0xee,
-0xed,0xdd,0xdd,0xf2,0x1d,0x15,0x00,0xd1,0xb2,0x1d,0x01,0x77,0x77,0x60,0xb2,0x1d,
-0x03,0xff,0xff,0xe0,0xb3,0x12,0x00,0x11,0xb3,0x12,0x00,0x12,0xb3,0x12,0x00,0x11,
-0x1e,0x12,0x00,0xc4,0x0e,0x11,0x11,0x11,0x11,0xb3,0x0d,0xdd,0xff,0xff,0xec,0xc2,
-0x48,0x00,0x31,0x7b,0xbb,0x70,0x47,0x03,0x40,0xbd,0xdb,0x50,0x07,0x16,0x0b,0xd0,
+0x00,0x00,0x00,0x04,0x20,0x00,0x01,0x00,0x22,0x0e,0xe2,0x07,0x00,0xf0,0x03,0xfe,
+0x30,0x00,0x16,0x77,0x77,0x7f,0x7c,0xe3,0x00,0x6f,0xee,0xee,0xee,0x40,0xbf,0x30,
+0x7e,0x17,0x00,0x31,0x0b,0xf4,0x7e,0x43,0x00,0x11,0xfc,0x07,0x00,0xf2,0x00,0x1c,
+0xe2,0x6f,0xff,0xff,0xff,0x41,0xce,0x20,0x05,0x55,0x55,0x5f,0x8d,0xe2,0x38,0x00,
+0x11,0x20,0x07,0x00,0x11,0xd1,0x46,0x00,0x20,0x03,0x10,0x06,0x00,0x21,0x05,0xb0,
+0x0d,0x00,0x30,0x4f,0xf0,0x00,0x67,0x00,0x11,0xfc,0x07,0x00,0xe1,0x3f,0x95,0xfe,
+0xee,0xee,0xea,0x02,0xea,0x00,0x67,0x77,0x77,0xae,0x1e,0x21,0x00,0x31,0x7e,0x4f,
+0x60,0x07,0x00,0x21,0x08,0xf4,0x07,0x00,0xf1,0x04,0x00,0x9f,0x33,0xff,0xff,0xff,
+0xfd,0x00,0x0a,0xe8,0xf5,0x55,0x55,0x52,0x00,0x00,0xaf,0xf0,0x00,0x82,0x00,0x02,
+0x07,0x00,0x31,0x00,0x30,0x00,0x89,0x00,0x01,0x6e,0x00,0x20,0x3e,0xe3,0x6c,0x00,
+0xff,0x19,0xeb,0xbe,0x30,0x00,0x00,0x3e,0xb0,0x0b,0xf3,0x00,0x03,0xfb,0x00,0x00,
+0xbf,0x30,0x3f,0xb0,0x00,0x00,0x0b,0xf3,0xef,0xff,0x30,0x03,0xff,0xfe,0x35,0x5f,
+0x50,0x05,0xf5,0x53,0x00,0x0f,0x50,0x05,0xf0,0x00,0x06,0x00,0x01,0xfe,0x05,0x85,
+0x58,0xf0,0x00,0x00,0x0d,0xff,0xff,0xd0,0x00,0x00,0x03,0x55,0x55,0x30,0x00,0x00,
+0x0f,0xff,0xff,0x2a,0x00,0x0a,0x06,0x00,0xf0,0x08,0xce,0xef,0x50,0x05,0xfe,0xec,
+0xaf,0xb6,0x00,0x00,0x6b,0xfa,0x0a,0xf4,0x00,0x00,0x4f,0xb0,0x00,0xbf,0x40,0x04,
+0xfb,0x75,0x00,0x10,0x3f,0xd1,0x00,0x21,0xbf,0xfb,0xb0,0x00,0x26,0xb0,0x00,0x01,
+0x00,0x12,0x11,0x07,0x00,0x12,0x88,0xbc,0x00,0x11,0xff,0x1e,0x01,0x30,0x09,0xff,
+0x90,0x07,0x00,0x30,0x2f,0xcc,0xf2,0x07,0x00,0xb0,0xaf,0x44,0xfa,0x00,0x00,0x00,
+0x02,0xfb,0x00,0xbf,0x20,0x49,0x00,0x10,0x00,0x4a,0x00,0x90,0x3f,0xa0,0x00,0x0a,
+0xf3,0x00,0x00,0xbf,0x20,0x18,0x00,0xf0,0x01,0x04,0xf9,0x00,0x00,0x00,0x9f,0x40,
+0x0c,0xfe,0xdd,0xdd,0xdd,0xef,0xc0,0x5f,0xff,0x01,0x00,0x11,0xf5,0x4f,0x00,0x11,
+0x10,0x56,0x00,0xf0,0x47,0x9f,0xfc,0x10,0x00,0x00,0x02,0x26,0xf7,0x4d,0xb0,0x00,
+0x04,0xdf,0xbb,0xd0,0x07,0xf0,0x00,0x6f,0xc4,0x0d,0xf5,0x2c,0xd0,0x02,0xfa,0x00,
+0x0f,0xff,0xfe,0x30,0x0a,0xe0,0x00,0x3f,0xff,0xc6,0x60,0x0e,0x80,0x00,0x6f,0xf8,
+0x08,0xe0,0x0f,0x60,0x00,0x9e,0x40,0x06,0xf0,0x0e,0x80,0x00,0x71,0x00,0x08,0xe0,
+0x0a,0xd0,0x00,0x00,0x00,0x0d,0xa0,0x03,0xf8,0x00,0x00,0x00,0x8f,0x30,0x00,0x7f,
+0xa3,0x00,0x3a,0xf7,0x00,0x00,0x05,0xef,0xff,0xfe,0x50,0xb9,0x01,0x20,0x66,0x40,
+0x66,0x00,0xf0,0x13,0x66,0x66,0x63,0x00,0x00,0x00,0x20,0xcf,0xff,0xf2,0x50,0x00,
+0x03,0xf8,0x1e,0xff,0x65,0xf9,0x00,0x16,0xb8,0x03,0xfb,0x02,0xa7,0x70,0x6f,0xa0,
+0x00,0x51,0x00,0x3f,0xb0,0x49,0x9a,0x01,0x30,0x07,0x93,0xef,0x9a,0x01,0x40,0x08,
+0xf6,0x49,0x10,0x0e,0x00,0x31,0x71,0xaf,0x60,0x3d,0x02,0xf0,0x0b,0x36,0xa1,0x00,
+0x00,0x00,0x6b,0x30,0x0a,0xf8,0x20,0x00,0x06,0x8f,0x50,0x01,0x4c,0xe7,0x68,0x8f,
+0xb1,0x00,0x00,0x0a,0x6e,0xac,0xc6,0x62,0x00,0x36,0x06,0x44,0x40,0x2b,0x01,0xf0,
+0x24,0x8e,0x34,0x78,0x61,0x00,0x00,0x07,0xfd,0xff,0xfe,0xff,0x91,0x00,0x6f,0x70,
+0xbf,0x40,0x06,0xed,0x10,0x8f,0x50,0x0a,0xf5,0x00,0x2e,0xb0,0x0d,0xf6,0x00,0xed,
+0x00,0x03,0xf4,0x1f,0xcf,0x7a,0xf4,0x00,0x00,0xd9,0x3f,0x37,0xff,0x40,0x00,0x00,
+0xab,0x3f,0x20,0x53,0x16,0x03,0x20,0x1f,0x50,0x3d,0x00,0x30,0xd8,0x0b,0xc0,0xb2,
+0x00,0x20,0xf3,0x02,0xcb,0x00,0xf0,0x00,0x2e,0xa0,0x00,0x6f,0xb4,0x00,0x17,0xfc,
+0x10,0x00,0x03,0xcf,0xff,0xff,0x80,0x5f,0x01,0x21,0x56,0x40,0x8e,0x01,0x21,0x10,
+0x00,0xf5,0x01,0xf0,0x38,0xff,0xfa,0x00,0x2f,0xe9,0x99,0x9b,0xf4,0x00,0x7f,0x70,
+0x00,0x09,0xd0,0x00,0xcf,0x10,0x00,0x0f,0x70,0x00,0xfc,0x00,0x00,0x9f,0x10,0x00,
+0x9f,0x10,0x1c,0xd3,0x00,0x06,0xff,0x70,0xe9,0x00,0x00,0x3f,0x8c,0x75,0xf9,0x00,
+0x00,0xbc,0x0e,0x2c,0xaf,0x00,0x00,0xd9,0x2d,0x1a,0x3f,0x20,0x00,0xbc,0x01,0x00,
+0x6f,0x00,0x00,0x4f,0x80,0x04,0xe9,0x00,0x00,0x07,0xff,0xff,0xe9,0x01,0x31,0x27,
+0x74,0x00,0xc6,0x01,0x21,0xff,0xa0,0x06,0x00,0x90,0xb1,0x10,0x1f,0xee,0xed,0xdd,
+0xdd,0xf2,0x1d,0x15,0x00,0xd1,0xb2,0x1d,0x01,0x77,0x77,0x60,0xb2,0x1d,0x03,0xff,
+0xff,0xe0,0xb3,0x12,0x00,0x11,0xb3,0x12,0x00,0x12,0xb3,0x12,0x00,0x11,0x1e,0x12,
+0x00,0xc4,0x0e,0x11,0x11,0x11,0x11,0xb3,0x0d,0xdd,0xff,0xff,0xec,0xc2,0x48,0x00,
+0x31,0x7b,0xbb,0x70,0x47,0x03,0xf0,0x06,0xbd,0xdb,0x50,0x07,0x00,0x02,0xdf,0xff,
 0xff,0xf0,0x0f,0xd3,0x2f,0xfa,0x30,0x03,0x20,0x0e,0x4d,0xef,0x80,0x6d,0x03,0x31,
 0x00,0x8f,0x40,0x07,0x00,0x21,0x03,0xd9,0x07,0x00,0x30,0x00,0x1e,0x90,0x07,0x00,
-0x21,0x02,0xd7,0x0e,0x00,0x11,0x5d,0x1c,0x00,0x20,0x08,0xfd,0x43,0x00,0x50,0x0f,
-0xca,0xaf,0xa0,0x00,0x15,0x13,0x60,0x0d,0xfd,0x63,0x37,0x60,0x03,0x61,0x00,0x01,
-0x92,0x0a,0xf1,0x1a,0x02,0x7a,0xa7,0x10,0xbd,0xef,0xfd,0xdd,0xdd,0xf1,0xc2,0x6f,
-0xe0,0x00,0x11,0xc2,0xc2,0x39,0x80,0x1a,0xff,0xf2,0xc2,0x16,0x52,0xef,0xff,0xf2,
-0xc2,0x6f,0xf0,0x19,0xff,0xf2,0xc2,0x5f,0xe0,0x00,0x11,0xb2,0xc2,0xc8,0x00,0x30,
-0xc2,0x5f,0xe0,0x06,0x00,0x20,0x6f,0xf0,0x06,0x00,0x20,0x15,0x40,0x06,0x00,0x21,
-0x4f,0xe0,0x18,0x00,0x00,0x12,0x00,0x70,0xcc,0xdf,0xfc,0xcc,0xcc,0xf1,0x01,0xc8,
-0x00,0x00,0x60,0x01,0x11,0x22,0x08,0x04,0xf0,0x36,0xbf,0xff,0xfa,0x20,0x00,0x00,
-0x7f,0xea,0xce,0x8d,0xf5,0x00,0x06,0xf9,0x03,0xbd,0x10,0xaf,0x30,0x1f,0xa0,0x04,
-0xbd,0x10,0x0c,0xd0,0x7f,0x10,0x04,0xce,0x10,0x03,0xf3,0xab,0x00,0x02,0xcc,0x00,
-0x00,0xe7,0xba,0x00,0x36,0x00,0xb9,0x00,0xc8,0xab,0x05,0xeb,0x76,0xc8,0xd3,0xe7,
-0x7f,0x8e,0x5c,0x61,0xbb,0x5d,0xf4,0x1f,0xd4,0xd5,0x00,0x05,0xdc,0xd0,0x06,0x7f,
-0x0a,0x81,0x9f,0x30,0x00,0x7f,0xc6,0x33,0x6d,0xf4,0x54,0x00,0x11,0xf9,0xfe,0x03,
-0x16,0x22,0x09,0x04,0x40,0x01,0xaf,0xfe,0x60,0x31,0x15,0x30,0xd4,0x28,0xf5,0x64,
-0x04,0xf0,0x16,0x20,0x00,0x9c,0x00,0x32,0x00,0x5f,0x00,0x00,0x6e,0x3e,0xff,0x90,
-0x3f,0x30,0x00,0xac,0xdf,0xff,0xf4,0x0c,0xe5,0x28,0xf5,0xff,0xff,0xf8,0x00,0xaf,
-0xff,0xd3,0xdf,0xff,0xf5,0x00,0xce,0xa9,0x31,0x07,0x40,0x0a,0xd1,0x1d,0xff,0x25,
-0x09,0x20,0x40,0xbf,0xcb,0x0a,0x21,0x5e,0x05,0x55,0x03,0x30,0x7c,0x1b,0xff,0xb7,
-0x0c,0xa9,0x6f,0xff,0xdd,0xdd,0xdd,0xdd,0xd6,0x02,0x22,0x00,0x01,0x00,0x22,0x06,
-0x90,0xc5,0x03,0x12,0xda,0x0f,0x00,0x22,0x1c,0xb0,0x0f,0x00,0x90,0xcc,0x00,0x00,
-0x3c,0xbb,0xbb,0xba,0xbf,0xc1,0xe4,0x0a,0x00,0x57,0x0d,0x20,0x14,0x44,0x01,0x00,
-0x10,0x30,0x3c,0x0c,0x00,0x1f,0x09,0x92,0x3e,0xfd,0xde,0xee,0xef,0xf4,0x00,0x02,
-0xea,0x37,0x00,0x22,0x1d,0xa0,0x37,0x00,0x13,0xdb,0x46,0x00,0x05,0x08,0x12,0x07,
-0x69,0x00,0x22,0xee,0xb6,0x09,0x00,0x21,0x49,0xe8,0x0e,0x00,0x30,0xa4,0x19,0xd2,
-0x32,0x00,0x30,0x5b,0xd3,0x30,0xd8,0x12,0x21,0x60,0x45,0x55,0x05,0x10,0xbc,0xf3,
-0x0f,0x30,0xa8,0x9c,0x71,0x07,0x05,0xf0,0x10,0x00,0x01,0xcd,0x10,0x00,0x1e,0xf2,
-0x5f,0xd0,0x3f,0xc0,0x00,0x5f,0xf0,0xbf,0xf3,0x1f,0xf1,0x00,0x0d,0xf3,0x4e,0xb0,
-0x4f,0xa0,0x00,0x02,0xdd,0x10,0x02,0xdc,0x90,0x03,0x91,0xcb,0xab,0x60,0x00,0x00,
-0x01,0x33,0x33,0x32,0xe9,0x04,0xf0,0x0d,0xff,0x70,0x00,0x1f,0x63,0x33,0xc8,0xf7,
-0x00,0x1f,0x40,0x00,0xe0,0x6f,0x70,0x1f,0x40,0x00,0xed,0xd7,0xf1,0x1f,0x40,0x00,
-0x01,0x13,0xf1,0x1f,0x7c,0x0d,0x0f,0x06,0x00,0x0d,0x72,0x74,0x44,0x44,0x47,0xf1,
-0x0e,0xff,0x01,0x0c,0x02,0xf8,0x05,0x20,0xbd,0xb4,0x07,0x00,0xf0,0x38,0x4d,0x41,
-0x3c,0x61,0x00,0x00,0x00,0xe2,0x00,0x01,0xed,0xe9,0x00,0x03,0xc0,0x00,0x00,0x10,
-0x0a,0x70,0x05,0xc0,0x00,0x00,0x01,0x01,0xe0,0x1e,0x30,0x02,0x69,0xdf,0x40,0xe0,
-0x88,0x09,0xef,0xfb,0x84,0x02,0xd0,0xc2,0x08,0x73,0x65,0x00,0x02,0xe2,0xc2,0x00,
-0x01,0xee,0x10,0x00,0x5a,0x95,0x00,0x0a,0xff,0x90,0x00,0x2c,0x3d,0x00,0x17,0x88,
-0x70,0x00,0x4a,0x08,0xd3,0xa1,0x02,0x87,0xd3,0x00,0x4c,0xed,0xde,0xee,0xed,0x40,
-0x19,0x01,0x22,0x02,0x10,0x57,0x06,0x13,0x60,0x07,0x00,0x11,0xb4,0x07,0x00,0xf0,
-0x15,0x64,0xf2,0x00,0x02,0x64,0x04,0xff,0xf6,0x80,0x00,0x6f,0xef,0x7e,0xa2,0x9e,
-0x00,0x01,0xf8,0x01,0x3f,0x50,0x4f,0x10,0x06,0xe0,0x00,0x0c,0xd7,0xdd,0x00,0x0b,
-0x90,0x00,0x01,0xcf,0xc2,0x13,0x17,0x00,0x38,0x00,0x21,0x1f,0x20,0x07,0x00,0x12,
-0x3f,0x46,0x00,0x12,0x4f,0x07,0x00,0x16,0x6d,0x54,0x00,0x00,0xca,0x00,0xd0,0xde,
-0x60,0x0e,0x85,0xf1,0x0e,0x52,0xf1,0x06,0xff,0x90,0x00,0x11,0xb5,0x07,0xf0,0x21,
-0x01,0xff,0x10,0x0e,0xf9,0x00,0x2f,0xf0,0x00,0x3f,0xf4,0x04,0xfd,0x00,0x06,0xff,
-0xe1,0xaf,0x80,0x03,0xff,0xcf,0xdf,0xe1,0x00,0x8f,0x81,0xff,0xe3,0x00,0x0c,0xf4,
-0x05,0xff,0x20,0x00,0xff,0x10,0x0a,0xfd,0x00,0x3f,0xf0,0x00,0x1e,0xf8,0x06,0xfc,
-0x9e,0x0d,0x90,0x0f,0xff,0xfe,0xa2,0x00,0x0e,0xee,0xef,0xfe,0x9c,0x05,0x20,0xef,
-0x60,0xa7,0x05,0x10,0x90,0x23,0x0d,0x1b,0xa0,0x05,0x00,0x50,0x5e,0xee,0xee,0xff,
-0xf9,0x39,0x02,0x10,0xfb,0x02,0x0f,0x70,0x0a,0xef,0xf2,0x00,0x00,0x0a,0xf8,0x34,
-0x07,0x00,0x93,0x09,0x00,0xae,0x03,0xf0,0x02,0x30,0x08,0xfd,0xbf,0x70,0x0e,0xf3,
-0x6f,0xb0,0x2f,0xf0,0x2f,0xe0,0x6f,0xb0,0x0f,0xf2,0xfd,0x0e,0x40,0xe9,0xee,0xee,
-0xef,0x7f,0x08,0x10,0xfb,0x68,0x0d,0x1f,0xb0,0x09,0x00,0x08,0x71,0xdf,0xff,0xfe,
-0xa1,0x0b,0xee,0xee,0xe6,0x06,0x00,0x39,0x0d,0xdd,0x0a,0xf7,0x9e,0x60,0x00,0x9f,
-0x8a,0xf7,0x00,0x09,0xf8,0xaf,0x70,0x09,0x00,0x28,0x7a,0xf7,0x03,0x00,0xe0,0x89,
-0x40,0x00,0x9f,0xfe,0x93,0x17,0xcf,0xfa,0x00,0x9f,0xc7,0x03,0xfe,0x93,0x00,0x17,
-0x05,0x03,0x00,0xfe,0x0c,0xaf,0xff,0xfe,0xb4,0x0a,0xff,0xee,0xff,0xf4,0xaf,0x70,
-0x01,0xbf,0xba,0xf7,0x00,0x04,0xfd,0xaf,0x70,0x00,0x3f,0xea,0xf7,0x00,0x03,0xfe,
-0x09,0x00,0xf1,0x0a,0xbf,0x60,0xaf,0xfa,0x00,0xbf,0x60,0xbc,0xff,0x90,0xbf,0x60,
-0x00,0x6f,0xe0,0xbf,0x60,0x00,0x1f,0xf1,0xbf,0x60,0x00,0x0f,0xf2,0x0a,0x00,0xf3,
-0x05,0xaf,0x70,0x00,0x4f,0xf0,0x7f,0xd1,0x01,0xcf,0xa0,0x1f,0xff,0xef,0xff,0x20,
-0x02,0xae,0xfe,0xa2,0x00,0x86,0x00,0x71,0x71,0x21,0xbf,0xff,0xec,0x50,0x9e,0x4d,
-0x09,0xa2,0x0b,0xfb,0x00,0x00,0x04,0xfe,0x00,0x00,0x02,0xfe,0x1c,0x01,0x0f,0x04,
-0x00,0x07,0x60,0x6f,0xff,0xe9,0x10,0x5e,0xef,0xd7,0x09,0x60,0x3e,0xf9,0x00,0x00,
+0x21,0x02,0xd7,0x0e,0x00,0x11,0x5d,0x1c,0x00,0x20,0x08,0xfd,0x43,0x00,0x40,0x0f,
+0xca,0xaf,0xa0,0x07,0x00,0x70,0x60,0x0d,0xfd,0x63,0x37,0x60,0x03,0x61,0x00,0x20,
+0xff,0xe0,0x11,0x01,0xf1,0x19,0x7a,0xa7,0x10,0xbd,0xef,0xfd,0xdd,0xdd,0xf1,0xc2,
+0x6f,0xe0,0x00,0x11,0xc2,0xc2,0x39,0x80,0x1a,0xff,0xf2,0xc2,0x16,0x52,0xef,0xff,
+0xf2,0xc2,0x6f,0xf0,0x19,0xff,0xf2,0xc2,0x5f,0xe0,0x00,0x11,0xb2,0xc2,0xc8,0x00,
+0x30,0xc2,0x5f,0xe0,0x06,0x00,0x20,0x6f,0xf0,0x06,0x00,0x20,0x15,0x40,0x06,0x00,
+0x21,0x4f,0xe0,0x18,0x00,0x00,0x12,0x00,0x70,0xcc,0xdf,0xfc,0xcc,0xcc,0xf1,0x01,
+0xc8,0x00,0x00,0x60,0x01,0x11,0x22,0x08,0x04,0xf1,0x42,0xbf,0xff,0xfa,0x20,0x00,
+0x00,0x7f,0xea,0xce,0x8d,0xf5,0x00,0x06,0xf9,0x03,0xbd,0x10,0xaf,0x30,0x1f,0xa0,
+0x04,0xbd,0x10,0x0c,0xd0,0x7f,0x10,0x04,0xce,0x10,0x03,0xf3,0xab,0x00,0x02,0xcc,
+0x00,0x00,0xe7,0xba,0x00,0x36,0x00,0xb9,0x00,0xc8,0xab,0x05,0xeb,0x76,0xc8,0xd3,
+0xe7,0x7f,0x8e,0x5c,0x61,0xbb,0x5d,0xf4,0x1f,0xd4,0xd5,0x00,0x05,0xdc,0xd0,0x06,
+0xff,0x30,0x00,0x00,0x9f,0x30,0x00,0x7f,0xc6,0x33,0x6d,0xf4,0x54,0x00,0x11,0xf9,
+0xfe,0x03,0x16,0x22,0x09,0x04,0x30,0x01,0xaf,0xfe,0x69,0x02,0x40,0x0c,0xd4,0x28,
+0xf5,0x64,0x04,0xf1,0x2a,0x20,0x00,0x9c,0x00,0x32,0x00,0x5f,0x00,0x00,0x6e,0x3e,
+0xff,0x90,0x3f,0x30,0x00,0xac,0xdf,0xff,0xf4,0x0c,0xe5,0x28,0xf5,0xff,0xff,0xf8,
+0x00,0xaf,0xff,0xd3,0xdf,0xff,0xf5,0x00,0xce,0xa9,0xff,0xff,0xff,0xb0,0x0a,0xd1,
+0x1d,0xff,0xff,0xff,0x70,0x1f,0x40,0xbf,0xff,0xff,0xff,0xf1,0x5e,0x05,0x55,0x03,
+0x20,0x7c,0x1b,0x07,0x00,0xb9,0xf7,0x6f,0xff,0xdd,0xdd,0xdd,0xdd,0xd6,0x02,0x22,
+0x00,0x01,0x00,0x22,0x06,0x90,0xc5,0x03,0x12,0xda,0x0f,0x00,0x22,0x1c,0xb0,0x0f,
+0x00,0xa1,0xcc,0x00,0x00,0x3c,0xbb,0xbb,0xba,0xbf,0xc1,0x00,0x9b,0x03,0x40,0xfd,
+0x10,0x14,0x44,0x01,0x00,0x21,0x30,0x03,0xa9,0x03,0xb2,0xf4,0x00,0x3e,0xfd,0xde,
+0xee,0xef,0xf4,0x00,0x02,0xea,0x37,0x00,0x22,0x1d,0xa0,0x37,0x00,0x13,0xdb,0x46,
+0x00,0x01,0x02,0x05,0x0b,0x69,0x00,0x22,0xee,0xb6,0x09,0x00,0x21,0x49,0xe8,0x0e,
+0x00,0x30,0xa4,0x19,0xd2,0x32,0x00,0x91,0x5b,0xd3,0x30,0x00,0x00,0x06,0xfc,0x60,
+0x45,0x55,0x05,0x80,0xbc,0x00,0x00,0x00,0x18,0xa8,0x9c,0x71,0x07,0x05,0xf0,0x10,
+0x00,0x01,0xcd,0x10,0x00,0x1e,0xf2,0x5f,0xd0,0x3f,0xc0,0x00,0x5f,0xf0,0xbf,0xf3,
+0x1f,0xf1,0x00,0x0d,0xf3,0x4e,0xb0,0x4f,0xa0,0x00,0x02,0xdd,0x10,0x02,0xdc,0x90,
+0x03,0x91,0xcb,0xab,0x60,0x00,0x00,0x01,0x33,0x33,0x32,0xe9,0x04,0xf0,0x0b,0xff,
+0x70,0x00,0x1f,0x63,0x33,0xc8,0xf7,0x00,0x1f,0x40,0x00,0xe0,0x6f,0x70,0x1f,0x40,
+0x00,0xed,0xd7,0xf1,0x1f,0x40,0x00,0x01,0x13,0x06,0x00,0x2f,0x00,0x03,0x06,0x00,
+0x0d,0x81,0x74,0x44,0x44,0x47,0xf1,0x0e,0xff,0xff,0x33,0x05,0x02,0xf8,0x05,0x20,
+0xbd,0xb4,0x07,0x00,0xf0,0x38,0x4d,0x41,0x3c,0x61,0x00,0x00,0x00,0xe2,0x00,0x01,
+0xed,0xe9,0x00,0x03,0xc0,0x00,0x00,0x10,0x0a,0x70,0x05,0xc0,0x00,0x00,0x01,0x01,
+0xe0,0x1e,0x30,0x02,0x69,0xdf,0x40,0xe0,0x88,0x09,0xef,0xfb,0x84,0x02,0xd0,0xc2,
+0x08,0x73,0x65,0x00,0x02,0xe2,0xc2,0x00,0x01,0xee,0x10,0x00,0x5a,0x95,0x00,0x0a,
+0xff,0x90,0x00,0x2c,0x3d,0x00,0x17,0x88,0x70,0x00,0x4a,0x08,0xd3,0xa1,0x02,0x87,
+0xd3,0x00,0x4c,0xed,0xde,0xee,0xed,0x40,0x19,0x01,0x22,0x02,0x10,0x57,0x06,0x13,
+0x60,0x07,0x00,0x11,0xb4,0x07,0x00,0xf1,0x18,0x64,0xf2,0x00,0x02,0x64,0x04,0xff,
+0xf6,0x80,0x00,0x6f,0xef,0x7e,0xa2,0x9e,0x00,0x01,0xf8,0x01,0x3f,0x50,0x4f,0x10,
+0x06,0xe0,0x00,0x0c,0xd7,0xdd,0x00,0x0b,0x90,0x00,0x01,0xcf,0xc2,0x00,0x0e,0x50,
+0x38,0x00,0x21,0x1f,0x20,0x07,0x00,0x12,0x3f,0x46,0x00,0x12,0x4f,0x07,0x00,0x16,
+0x6d,0x54,0x00,0x00,0xca,0x00,0xd0,0xde,0x60,0x0e,0x85,0xf1,0x0e,0x52,0xf1,0x06,
+0xff,0x90,0x00,0x11,0xb5,0x07,0xf0,0x2e,0x01,0xff,0x10,0x0e,0xf9,0x00,0x2f,0xf0,
+0x00,0x3f,0xf4,0x04,0xfd,0x00,0x06,0xff,0xe1,0xaf,0x80,0x03,0xff,0xcf,0xdf,0xe1,
+0x00,0x8f,0x81,0xff,0xe3,0x00,0x0c,0xf4,0x05,0xff,0x20,0x00,0xff,0x10,0x0a,0xfd,
+0x00,0x3f,0xf0,0x00,0x1e,0xf8,0x06,0xfc,0x00,0x00,0x4f,0xf4,0x0f,0xff,0xfe,0xa2,
+0x00,0x0e,0xee,0xef,0xfe,0x9c,0x05,0x20,0xef,0x60,0xa7,0x05,0x00,0x3f,0x02,0x2b,
+0x7f,0xa0,0x05,0x00,0x50,0x5e,0xee,0xee,0xff,0xf9,0x39,0x02,0xd0,0xfb,0x0c,0xfe,
+0x60,0x00,0x0a,0xef,0xf2,0x00,0x00,0x0a,0xf8,0x00,0x01,0x08,0x30,0x00,0x02,0xff,
+0xae,0x03,0xf0,0x0a,0x30,0x08,0xfd,0xbf,0x70,0x0e,0xf3,0x6f,0xb0,0x2f,0xf0,0x2f,
+0xe0,0x6f,0xb0,0x0f,0xf2,0xaf,0xff,0xff,0xff,0xe9,0xee,0xee,0xef,0x7f,0x08,0x00,
+0x70,0x06,0x2f,0x6f,0xb0,0x09,0x00,0x08,0x71,0xdf,0xff,0xfe,0xa1,0x0b,0xee,0xee,
+0xe6,0x06,0xfd,0x02,0xff,0x50,0x00,0x00,0x0a,0xf7,0x9e,0x60,0x00,0x9f,0x8a,0xf7,
+0x00,0x09,0xf8,0xaf,0x70,0x09,0x00,0x28,0x7a,0xf7,0x03,0x00,0xe0,0x89,0x40,0x00,
+0x9f,0xfe,0x93,0x17,0xcf,0xfa,0x00,0x9f,0xc7,0x03,0xfe,0x93,0x00,0x17,0x05,0x03,
+0x00,0xfe,0x0c,0xaf,0xff,0xfe,0xb4,0x0a,0xff,0xee,0xff,0xf4,0xaf,0x70,0x01,0xbf,
+0xba,0xf7,0x00,0x04,0xfd,0xaf,0x70,0x00,0x3f,0xea,0xf7,0x00,0x03,0xfe,0x09,0x00,
+0xf1,0x0a,0xbf,0x60,0xaf,0xfa,0x00,0xbf,0x60,0xbc,0xff,0x90,0xbf,0x60,0x00,0x6f,
+0xe0,0xbf,0x60,0x00,0x1f,0xf1,0xbf,0x60,0x00,0x0f,0xf2,0x0a,0x00,0xf3,0x05,0xaf,
+0x70,0x00,0x4f,0xf0,0x7f,0xd1,0x01,0xcf,0xa0,0x1f,0xff,0xef,0xff,0x20,0x02,0xae,
+0xfe,0xa2,0x00,0x86,0x00,0x71,0x71,0x21,0xbf,0xff,0xec,0x50,0x9e,0x4d,0x09,0xa2,
+0x0b,0xfb,0x00,0x00,0x04,0xfe,0x00,0x00,0x02,0xfe,0x1c,0x01,0x0f,0x04,0x00,0x07,
+0xf0,0x01,0x6f,0xff,0xe9,0x10,0x5e,0xef,0xff,0xe1,0x00,0x00,0x3e,0xf9,0x00,0x00,
 0x06,0xfd,0xfd,0x00,0x02,0x04,0x00,0x20,0x06,0xfd,0x14,0x00,0x00,0x1c,0x00,0x00,
-0x24,0x00,0x00,0x41,0x07,0x11,0x07,0xba,0x0e,0x14,0xb0,0x09,0x00,0x60,0xff,0xfe,
-0xb3,0x06,0xee,0xee,0x3b,0x00,0x20,0x01,0xef,0xa9,0x16,0x01,0x3c,0x11,0x00,0x3a,
-0x16,0xf3,0x01,0xd0,0x00,0x01,0xaf,0xf3,0x00,0x18,0xef,0xf5,0x00,0x07,0xff,0xd3,
-0x00,0x00,0x7c,0x30,0x02,0x00,0x50,0x05,0x80,0xd7,0x00,0xaf,0xfe,0xef,0xff,0x90,
-0xaf,0x49,0x11,0x91,0xaf,0x70,0x00,0x0f,0xf3,0xaf,0x70,0x00,0x0e,0x05,0x00,0x17,
-0xf4,0x05,0x00,0x50,0xfe,0xee,0xef,0xf4,0xaf,0x12,0x04,0x20,0x5f,0xe0,0x1c,0x18,
-0xf0,0x01,0xcf,0xcf,0xff,0xff,0x90,0x03,0xff,0xf4,0x06,0xff,0x00,0x0c,0xf8,0x00,
-0x0e,0xf3,0x66,0x00,0xfb,0x0e,0xdf,0x50,0x4f,0xe0,0x00,0x0c,0xf5,0x09,0xfa,0x00,
-0x00,0xcf,0x50,0xdf,0x60,0x00,0x0c,0xf5,0x1f,0xf2,0x0a,0xee,0xff,0x55,0xfe,0x00,
-0xbf,0xff,0xf5,0x9e,0x01,0x00,0x03,0x00,0x70,0x70,0x0f,0xfe,0x70,0x0e,0xff,0xf3,
-0x41,0x00,0x55,0x08,0xf9,0x00,0x07,0xfa,0x03,0x00,0x70,0x6e,0xef,0xfa,0x7f,0xff,
-0xfa,0x9f,0x9f,0x11,0x20,0x08,0xef,0x9c,0x00,0xe0,0x07,0xf7,0x00,0x08,0xff,0x10,
-0xcf,0x40,0x00,0x0f,0xf3,0x0e,0xf3,0x00,0x77,0x18,0x60,0x40,0x00,0x0f,0xf4,0x0d,
-0xf7,0x35,0x17,0xf0,0x00,0x9f,0xe2,0x01,0xbf,0xd0,0x01,0xef,0xfe,0xff,0xf4,0x00,
-0x02,0xae,0xfe,0xb3,0xe9,0x0b,0x80,0x1f,0xf1,0x0c,0xf8,0x00,0x1f,0xf0,0x06,0xd3,
-0x02,0xf0,0x09,0x01,0xff,0x30,0x4f,0xd0,0x00,0xaf,0x80,0x8f,0xa0,0x00,0x4f,0xe0,
-0xdf,0x50,0x00,0x0e,0xfc,0xfe,0x00,0x01,0x3c,0xff,0xf4,0x02,0x02,0x50,0x40,0x00,
-0xaf,0xda,0x60,0x58,0x13,0xf0,0x10,0xfe,0x91,0x0f,0xfe,0xef,0xff,0xd0,0xff,0x20,
-0x04,0xff,0x5f,0xf2,0x00,0x0b,0xf7,0xff,0x20,0x00,0x9f,0x8f,0xff,0xf1,0x09,0xf8,
-0xde,0xee,0x00,0x9f,0x80,0x00,0xd4,0x0a,0x1f,0x00,0x09,0x00,0x02,0xf1,0x0a,0xef,
-0xff,0xfd,0x80,0x0e,0xfe,0xef,0xff,0xb0,0xef,0x40,0x05,0xff,0x4e,0xf4,0x00,0x0b,
-0xf7,0xef,0xee,0x20,0x9f,0x8e,0xff,0xf2,0x20,0x00,0x20,0xcf,0x60,0x56,0x10,0xf0,
-0x02,0xbe,0xee,0xff,0xf9,0x0c,0xff,0xff,0xc6,0x00,0x9f,0xc0,0x00,0xcf,0x61,0xef,
-0x70,0x0e,0x65,0x1a,0xf0,0x07,0xff,0x30,0x0d,0xf6,0x3f,0xf0,0x00,0x7f,0xcc,0xf9,
-0x00,0x05,0xff,0xfa,0x00,0x00,0x5f,0xd1,0x00,0x00,0x05,0xfb,0x6a,0x10,0x1f,0xb0,
-0x09,0x00,0x01,0xf0,0x05,0x9f,0xe1,0x00,0x3f,0xe0,0xcf,0xa0,0x05,0xfd,0x02,0xff,
-0x60,0x7f,0xb0,0x06,0xff,0x2c,0xf7,0x00,0x0a,0x54,0x14,0x30,0x0e,0xfc,0x00,0x49,
-0x0c,0x00,0xfb,0x01,0x90,0xe1,0x4e,0xee,0xee,0xff,0xc4,0xff,0xff,0xff,0x3e,0x16,
-0x70,0xfc,0x50,0x0e,0xee,0xee,0xff,0xf2,0xb1,0x05,0x20,0xf7,0x00,0xae,0x00,0xf0,
+0x24,0x00,0x00,0x41,0x07,0x20,0x07,0xfb,0x88,0x01,0x14,0xb0,0x09,0x00,0x60,0xff,
+0xfe,0xb3,0x06,0xee,0xee,0x3b,0x00,0x60,0x01,0xef,0x40,0x00,0x00,0x0c,0x56,0x04,
+0xf3,0x06,0xff,0x20,0x00,0x00,0x9f,0xd0,0x00,0x01,0xaf,0xf3,0x00,0x18,0xef,0xf5,
+0x00,0x07,0xff,0xd3,0x00,0x00,0x7c,0x30,0x02,0x00,0x50,0x05,0xf1,0x06,0xd7,0x00,
+0xaf,0xfe,0xef,0xff,0x90,0xaf,0x70,0x00,0x7f,0xf0,0xaf,0x70,0x00,0x0f,0xf3,0xaf,
+0x70,0x00,0x0e,0x05,0x00,0x17,0xf4,0x05,0x00,0x50,0xfe,0xee,0xef,0xf4,0xaf,0x12,
+0x04,0xf0,0x07,0x5f,0xe0,0x6d,0xfe,0x80,0x00,0xcf,0xcf,0xff,0xff,0x90,0x03,0xff,
+0xf4,0x06,0xff,0x00,0x0c,0xf8,0x00,0x0e,0xf3,0x66,0x00,0xfb,0x0e,0xdf,0x50,0x4f,
+0xe0,0x00,0x0c,0xf5,0x09,0xfa,0x00,0x00,0xcf,0x50,0xdf,0x60,0x00,0x0c,0xf5,0x1f,
+0xf2,0x0a,0xee,0xff,0x55,0xfe,0x00,0xbf,0xff,0xf5,0x9e,0x01,0x00,0x03,0x00,0x70,
+0x70,0x0f,0xfe,0x70,0x0e,0xff,0xf3,0x41,0x00,0x55,0x08,0xf9,0x00,0x07,0xfa,0x03,
+0x00,0xd0,0x6e,0xef,0xfa,0x7f,0xff,0xfa,0x9f,0xff,0xff,0xfd,0x70,0x08,0xef,0x9c,
+0x00,0xf0,0x28,0x07,0xf7,0x00,0x08,0xff,0x10,0xcf,0x40,0x00,0x0f,0xf3,0x0e,0xf3,
+0x00,0x00,0xef,0x40,0xef,0x40,0x00,0x0f,0xf4,0x0d,0xf7,0x00,0x02,0xff,0x10,0x9f,
+0xe2,0x01,0xbf,0xd0,0x01,0xef,0xfe,0xff,0xf4,0x00,0x02,0xae,0xfe,0xb3,0x00,0x2f,
+0xf2,0x00,0x1f,0xf1,0x0c,0xf8,0x00,0x1f,0xf0,0x06,0xd3,0x02,0xf0,0x09,0x01,0xff,
+0x30,0x4f,0xd0,0x00,0xaf,0x80,0x8f,0xa0,0x00,0x4f,0xe0,0xdf,0x50,0x00,0x0e,0xfc,
+0xfe,0x00,0x01,0x3c,0xff,0xf4,0x02,0x02,0xf0,0x19,0x40,0x00,0xaf,0xda,0x60,0x00,
+0x00,0xff,0xff,0xfe,0x91,0x0f,0xfe,0xef,0xff,0xd0,0xff,0x20,0x04,0xff,0x5f,0xf2,
+0x00,0x0b,0xf7,0xff,0x20,0x00,0x9f,0x8f,0xff,0xf1,0x09,0xf8,0xde,0xee,0x00,0x9f,
+0x80,0x00,0xd4,0x0a,0x1f,0x00,0x09,0x00,0x02,0xf1,0x0a,0xef,0xff,0xfd,0x80,0x0e,
+0xfe,0xef,0xff,0xb0,0xef,0x40,0x05,0xff,0x4e,0xf4,0x00,0x0b,0xf7,0xef,0xee,0x20,
+0x9f,0x8e,0xff,0xf2,0x20,0x00,0xf0,0x21,0xcf,0x60,0x00,0x00,0x7f,0xf2,0xbe,0xee,
+0xff,0xf9,0x0c,0xff,0xff,0xc6,0x00,0x9f,0xc0,0x00,0xcf,0x61,0xef,0x70,0x0e,0xf4,
+0x05,0xff,0x10,0xff,0x30,0x0d,0xf6,0x3f,0xf0,0x00,0x7f,0xcc,0xf9,0x00,0x05,0xff,
+0xfa,0x00,0x00,0x5f,0xd1,0x00,0x00,0x05,0xc3,0x01,0x2f,0x5f,0xb0,0x09,0x00,0x01,
+0xf0,0x0b,0x9f,0xe1,0x00,0x3f,0xe0,0xcf,0xa0,0x05,0xfd,0x02,0xff,0x60,0x7f,0xb0,
+0x06,0xff,0x2c,0xf7,0x00,0x0a,0xff,0xfd,0x00,0x00,0x0e,0xfc,0x37,0x06,0x10,0xf4,
+0xfb,0x01,0xf0,0x05,0xe1,0x4e,0xee,0xee,0xff,0xc4,0xff,0xff,0xff,0xfe,0x0f,0xff,
+0xff,0xfc,0x50,0x0e,0xee,0xee,0xff,0xf2,0xb1,0x05,0x20,0xf7,0x00,0xae,0x00,0xf0,
 0x12,0x09,0xf7,0x00,0x0b,0xf7,0x0a,0xf7,0x00,0x1f,0xf3,0x0a,0xf7,0x00,0xaf,0xc0,
 0x0a,0xf7,0x1a,0xff,0x20,0x0a,0xf7,0x9f,0xf4,0x00,0x0a,0xf7,0x9b,0x20,0x00,0x0a,
 0xf7,0x10,0x5d,0x03,0x13,0x00,0x05,0x00,0x03,0xb5,0x02,0x1f,0xf4,0xb5,0x02,0x0d,
-0xf0,0x24,0x7f,0xb0,0x06,0xfb,0x00,0xff,0x34,0xfe,0x00,0x7f,0xa0,0x1f,0xf1,0x1f,
+0xf0,0x33,0x7f,0xb0,0x06,0xfb,0x00,0xff,0x34,0xfe,0x00,0x7f,0xa0,0x1f,0xf1,0x1f,
 0xf1,0x09,0xf8,0x03,0xff,0x00,0xef,0x40,0xcf,0x60,0x4f,0xd0,0x0b,0xf9,0x7f,0xf2,
 0x06,0xfb,0x00,0x8f,0xff,0xf7,0x00,0x9f,0x90,0x05,0xfe,0x40,0x00,0x1e,0xf5,0x00,
-0x2f,0xf0,0x01,0x5d,0xfe,0x11,0x15,0xb0,0xff,0xfe,0x20,0x00,0x0c,0xff,0xec,0xa6,
-0x00,0x00,0x7f,0xe3,0x01,0x11,0x06,0xe3,0x01,0x80,0x00,0xff,0x20,0x07,0xff,0x00,
-0x0f,0xf2,0x03,0x00,0x00,0x36,0x12,0x33,0x30,0x0f,0xf2,0x57,0x02,0xf0,0x16,0xef,
-0x30,0x4f,0xf0,0x00,0x0e,0xf3,0x7f,0xfc,0x00,0x00,0xef,0x38,0xfc,0x20,0x00,0x0e,
-0xf3,0x05,0xfb,0x0d,0xf3,0x09,0xf5,0x1f,0xd0,0x0c,0xf0,0x4f,0x70,0x0f,0xa0,0x8f,
-0x20,0x3f,0x40,0xbc,0x2f,0x04,0x70,0xe4,0xef,0xfb,0xdf,0xfb,0x5e,0xd3,0xd7,0x02,
-0x50,0x1e,0x82,0x00,0x00,0x0f,0xa2,0x17,0xf1,0x02,0x5a,0xef,0xf8,0x00,0x01,0x7e,
-0xfc,0x07,0xcf,0xfe,0x92,0x1f,0xfb,0x50,0x00,0x08,0x20,0x41,0x06,0x5a,0xfb,0x0c,
-0xcc,0xcc,0xc8,0xb6,0x06,0x20,0x49,0xdc,0x06,0x00,0x30,0x16,0xbf,0xff,0x6b,0x03,
-0x30,0x8d,0xff,0xff,0x08,0x00,0x22,0xcf,0xff,0x08,0x00,0x00,0x06,0x00,0x11,0xc7,
-0x08,0x00,0x30,0xfa,0x51,0x00,0x08,0x00,0x10,0x84,0x57,0x03,0x01,0x03,0x00,0x0f,
-0x08,0x00,0x05,0x21,0x2b,0xee,0x08,0x00,0x00,0x78,0x14,0x21,0x2b,0xee,0x08,0x00,
-0x30,0xfd,0xdf,0xff,0x18,0x00,0x41,0xff,0xb2,0xdf,0xff,0xdb,0x08,0x00,0x0b,0x00,
-0x01,0x08,0x00,0x21,0xd0,0x0f,0x8a,0x06,0x70,0x0d,0xff,0xff,0xc8,0x88,0x88,0x8c,
-0x2d,0x09,0x64,0x80,0x00,0x00,0x08,0xf0,0x0f,0x08,0x00,0x01,0x03,0x0a,0x10,0x08,
-0x18,0x00,0x64,0xec,0xcc,0xcc,0xce,0xf0,0x0f,0x08,0x00,0x06,0x18,0x00,0x0c,0x30,
-0x00,0x02,0x48,0x00,0x04,0x58,0x00,0x31,0xdf,0xff,0x73,0xda,0x07,0x31,0xff,0xff,
-0xa5,0xd0,0x00,0x04,0x08,0x00,0x04,0x18,0x00,0x04,0x02,0x01,0x0f,0x28,0x00,0x3b,
-0x22,0x0a,0xb1,0x08,0x00,0x22,0xbf,0xfc,0x06,0x0d,0x22,0xff,0xfb,0x0f,0x00,0x40,
-0xff,0xc0,0x1b,0xa0,0x0f,0x00,0x41,0xfc,0x00,0xcf,0xfb,0x0f,0x00,0x70,0x00,0xbf,
-0xff,0xb0,0x0b,0xff,0xfc,0xb3,0x13,0x10,0xfb,0x0f,0x00,0x01,0x77,0x01,0x01,0x2d,
-0x00,0x12,0x0c,0xa3,0x0a,0x04,0x99,0x0c,0x04,0x9b,0x0c,0x10,0x03,0x04,0x00,0xf1,
-0x03,0x08,0xfc,0x10,0x00,0x1c,0xf8,0xff,0xfc,0x10,0x1c,0xff,0xf5,0xff,0xfc,0x2c,
-0xff,0xf5,0x05,0x57,0x0c,0x11,0x05,0x5c,0x0c,0x71,0x1d,0xff,0xfd,0x10,0x00,0x1c,
-0xff,0x1e,0x00,0x40,0xf9,0xff,0xfc,0x1c,0x1e,0x00,0x20,0xfc,0xdf,0x1e,0x00,0x72,
-0xd1,0xa4,0x00,0x00,0x04,0xa1,0x00,0x58,0x1b,0x00,0x92,0x07,0x20,0x6f,0xf1,0xf3,
-0x0d,0xf0,0x0a,0x5f,0xd0,0x6f,0xf1,0x3f,0xd1,0x00,0x03,0xff,0xf1,0x6f,0xf1,0x5f,
-0xfd,0x00,0x0d,0xff,0x40,0x6f,0xf1,0x09,0xff,0x70,0x4f,0xf7,0x69,0x1a,0x40,0xcf,
-0xe0,0x9f,0xf0,0x08,0x00,0x40,0x5f,0xf3,0xbf,0xc0,0x08,0x00,0x40,0x2f,0xf5,0xbf,
-0xc0,0x40,0x00,0x41,0x1f,0xf6,0xaf,0xe0,0xc2,0x07,0x10,0xf4,0xab,0x1c,0x00,0xf0,
-0x0d,0x30,0x0f,0xfe,0x10,0x75,0x14,0x20,0xa0,0x06,0x63,0x05,0x10,0x7f,0x45,0x04,
-0x30,0xff,0xda,0xbe,0x47,0x03,0x10,0x06,0x18,0x01,0x00,0x67,0x0c,0x41,0x17,0xbd,
-0xca,0x50,0xcb,0x00,0x22,0x8b,0xb8,0xd3,0x00,0x21,0xff,0xff,0x1c,0x0e,0x70,0x06,
-0xff,0xff,0x60,0x03,0x00,0x04,0x24,0x02,0x42,0xfd,0xef,0x40,0x0d,0x57,0x01,0x10,
-0xd0,0xe5,0x17,0x90,0x9f,0xff,0xff,0xf4,0x08,0xff,0xff,0x20,0x02,0xef,0x01,0x02,
-0xf4,0x17,0x14,0x00,0x08,0x00,0x04,0x18,0x00,0x04,0x28,0x00,0x04,0x38,0x00,0x20,
-0x04,0xfe,0x48,0x00,0x24,0xdf,0x40,0x58,0x00,0x05,0x68,0x00,0x06,0x78,0x00,0x60,
-0x03,0xdd,0x30,0x3f,0xf3,0x00,0x36,0x03,0x41,0xff,0xf5,0x4f,0xf4,0xd6,0x0d,0xd0,
-0x99,0xff,0xbf,0xf4,0x00,0x00,0x01,0xbf,0xf6,0x22,0x6f,0xff,0xf4,0x25,0x17,0xf0,
-0x0c,0x35,0xff,0x53,0xef,0xf4,0x00,0x04,0xff,0xc1,0x8f,0xff,0xf8,0x1c,0xfe,0x40,
-0x7f,0xfa,0x1a,0xff,0xff,0xff,0xa1,0xaf,0xf7,0xcf,0x82,0xdf,0xd0,0x00,0x41,0x28,
-0xfc,0x14,0x0e,0x70,0x00,0x21,0xe0,0x41,0x95,0x09,0x02,0x81,0x0e,0x42,0xff,0xf9,
-0x00,0x8f,0x09,0x00,0x1b,0xf8,0x09,0x00,0x71,0x0e,0xff,0xf6,0x00,0x6f,0xff,0xe0,
-0x43,0x02,0x18,0xfd,0xfe,0x00,0x0f,0x08,0x00,0x0d,0x12,0x4f,0x8a,0x0a,0x20,0x00,
-0x0b,0x08,0x00,0x01,0xa9,0x0e,0x03,0x21,0x02,0x19,0x0b,0x21,0x02,0x60,0xdf,0xff,
-0xfc,0x1b,0xb1,0xcf,0x98,0x02,0x4b,0xff,0xc2,0x2c,0xff,0x01,0x00,0x30,0xf0,0xe0,
-0xff,0xb5,0x00,0x01,0xa0,0x02,0x20,0x04,0xef,0x26,0x05,0x11,0x40,0x18,0x20,0x20,
-0xff,0xff,0x2d,0x07,0x20,0xaf,0xb0,0x4e,0x00,0x51,0xfa,0x00,0x05,0xff,0x10,0xe8,
-0x0e,0x41,0x50,0x1e,0xf6,0x00,0x1d,0x01,0x11,0xe1,0x1a,0x00,0x00,0x1c,0x00,0x01,
-0x76,0x0a,0x22,0x08,0xff,0xf1,0x00,0x03,0xf0,0x00,0x0f,0x01,0x00,0x06,0x13,0x8f,
-0x08,0x00,0x00,0x47,0x1a,0x50,0xbd,0xda,0x50,0x02,0xff,0x95,0x0e,0xf0,0x06,0xff,
+0x2f,0xf0,0x01,0x5d,0xfe,0x00,0x00,0xff,0xef,0xff,0xfe,0x20,0x00,0x0c,0xff,0xec,
+0xa6,0x00,0x00,0x7f,0xe3,0x01,0x11,0x06,0xe3,0x01,0xb0,0x00,0xff,0x20,0x07,0xff,
+0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x4c,0x02,0x43,0xef,0x30,0x0f,0xf2,0x57,0x02,0xf0,
+0x16,0xef,0x30,0x4f,0xf0,0x00,0x0e,0xf3,0x7f,0xfc,0x00,0x00,0xef,0x38,0xfc,0x20,
+0x00,0x0e,0xf3,0x05,0xfb,0x0d,0xf3,0x09,0xf5,0x1f,0xd0,0x0c,0xf0,0x4f,0x70,0x0f,
+0xa0,0x8f,0x20,0x3f,0x40,0xbc,0x2f,0x04,0x70,0xe4,0xef,0xfb,0xdf,0xfb,0x5e,0xd3,
+0xd7,0x02,0x20,0x1e,0x82,0x29,0x06,0xf1,0x05,0xc6,0x00,0x00,0x5a,0xef,0xf8,0x00,
+0x01,0x7e,0xfc,0x07,0xcf,0xfe,0x92,0x1f,0xfb,0x50,0x00,0x08,0x20,0x41,0x06,0x5a,
+0xfb,0x0c,0xcc,0xcc,0xc8,0xb6,0x06,0x20,0x49,0xdc,0x06,0x00,0x30,0x16,0xbf,0xff,
+0x6b,0x03,0x30,0x8d,0xff,0xff,0x08,0x00,0x22,0xcf,0xff,0x08,0x00,0x00,0x06,0x00,
+0x11,0xc7,0x08,0x00,0x30,0xfa,0x51,0x00,0x08,0x00,0x10,0x84,0x57,0x03,0x01,0x03,
+0x00,0x0f,0x08,0x00,0x05,0x22,0x2b,0xee,0x08,0x00,0x51,0xdf,0xff,0xff,0x2b,0xee,
+0x08,0x00,0x30,0xfd,0xdf,0xff,0x18,0x00,0x41,0xff,0xb2,0xdf,0xff,0xdb,0x08,0x00,
+0x0b,0x00,0x01,0x08,0x00,0x21,0xd0,0x0f,0x8a,0x06,0x70,0x0d,0xff,0xff,0xc8,0x88,
+0x88,0x8c,0x2d,0x09,0x64,0x80,0x00,0x00,0x08,0xf0,0x0f,0x08,0x00,0x01,0x03,0x0a,
+0x10,0x08,0x18,0x00,0x64,0xec,0xcc,0xcc,0xce,0xf0,0x0f,0x08,0x00,0x06,0x18,0x00,
+0x0c,0x30,0x00,0x02,0x48,0x00,0x04,0x58,0x00,0x31,0xdf,0xff,0x73,0xda,0x07,0x31,
+0xff,0xff,0xa5,0xd0,0x00,0x04,0x08,0x00,0x04,0x18,0x00,0x04,0x02,0x01,0x0f,0x28,
+0x00,0x3b,0x22,0x0a,0xb1,0x08,0x00,0x22,0xbf,0xfc,0x06,0x0d,0x22,0xff,0xfb,0x0f,
+0x00,0x40,0xff,0xc0,0x1b,0xa0,0x0f,0x00,0x41,0xfc,0x00,0xcf,0xfb,0x0f,0x00,0x40,
+0x00,0xbf,0xff,0xb0,0x0f,0x00,0x40,0x00,0x0c,0xff,0xfb,0x0f,0x00,0x01,0x77,0x01,
+0x01,0x2d,0x00,0x12,0x0c,0xa3,0x0a,0x04,0x99,0x0c,0x04,0x9b,0x0c,0x10,0x03,0x04,
+0x00,0xf1,0x03,0x08,0xfc,0x10,0x00,0x1c,0xf8,0xff,0xfc,0x10,0x1c,0xff,0xf5,0xff,
+0xfc,0x2c,0xff,0xf5,0x05,0x57,0x0c,0x11,0x05,0x5c,0x0c,0x71,0x1d,0xff,0xfd,0x10,
+0x00,0x1c,0xff,0x1e,0x00,0x40,0xf9,0xff,0xfc,0x1c,0x1e,0x00,0x20,0xfc,0xdf,0x1e,
+0x00,0x60,0xd1,0xa4,0x00,0x00,0x04,0xa1,0x31,0x07,0x12,0xe0,0x92,0x07,0x20,0x6f,
+0xf1,0xf3,0x0d,0xf0,0x12,0x5f,0xd0,0x6f,0xf1,0x3f,0xd1,0x00,0x03,0xff,0xf1,0x6f,
+0xf1,0x5f,0xfd,0x00,0x0d,0xff,0x40,0x6f,0xf1,0x09,0xff,0x70,0x4f,0xf7,0x00,0x6f,
+0xf1,0x00,0xcf,0xe0,0x9f,0xf0,0x08,0x00,0x40,0x5f,0xf3,0xbf,0xc0,0x08,0x00,0x40,
+0x2f,0xf5,0xbf,0xc0,0x40,0x00,0x41,0x1f,0xf6,0xaf,0xe0,0xc2,0x07,0x31,0xf4,0x6f,
+0xf4,0x4b,0x05,0x20,0xf0,0x0f,0x2f,0x07,0x40,0x05,0xff,0xa0,0x06,0x63,0x05,0x10,
+0x7f,0x45,0x04,0x30,0xff,0xda,0xbe,0x47,0x03,0x10,0x06,0x18,0x01,0xa0,0x30,0x00,
+0x00,0x00,0x17,0xbd,0xca,0x50,0x00,0x00,0x61,0x00,0x00,0x00,0x8b,0xb8,0x00,0x01,
+0x00,0x20,0xff,0xff,0x06,0x00,0xf1,0x02,0x30,0x06,0xff,0xff,0x60,0x03,0x00,0x04,
+0xfd,0xdf,0xff,0xff,0xfd,0xef,0x40,0x0d,0xff,0x01,0x00,0xf4,0x0a,0xd0,0x4f,0xff,
+0xff,0xf9,0x9f,0xff,0xff,0xf4,0x08,0xff,0xff,0x20,0x02,0xff,0xff,0x80,0x00,0xff,
+0xf9,0x00,0x00,0x9f,0xff,0x00,0x08,0x00,0x04,0x18,0x00,0x04,0x28,0x00,0x04,0x38,
+0x00,0x20,0x04,0xfe,0x48,0x00,0x24,0xdf,0x40,0x58,0x00,0x05,0x68,0x00,0x06,0x78,
+0x00,0x50,0x03,0xdd,0x30,0x3f,0xf3,0x09,0x00,0xf1,0x2f,0x6f,0xff,0xf5,0x4f,0xf4,
+0x00,0x00,0x00,0x09,0xff,0x99,0xff,0xbf,0xf4,0x00,0x00,0x01,0xbf,0xf6,0x22,0x6f,
+0xff,0xf4,0x00,0x00,0x2d,0xfe,0x35,0xff,0x53,0xef,0xf4,0x00,0x04,0xff,0xc1,0x8f,
+0xff,0xf8,0x1c,0xfe,0x40,0x7f,0xfa,0x1a,0xff,0xff,0xff,0xa1,0xaf,0xf7,0xcf,0x82,
+0xdf,0xff,0xff,0xff,0xfd,0x28,0xfc,0x14,0x0e,0x70,0x00,0x41,0xe0,0x41,0x00,0x0f,
+0x09,0x00,0x82,0xf0,0x00,0x00,0x0f,0xff,0xf9,0x00,0x8f,0x09,0x00,0x1b,0xf8,0x09,
+0x00,0x70,0x0e,0xff,0xf6,0x00,0x6f,0xff,0xe0,0x75,0x00,0x28,0xdf,0xfd,0xfe,0x00,
+0x0f,0x08,0x00,0x0d,0x40,0x4f,0xff,0xff,0xff,0x92,0x00,0x10,0x0b,0x08,0x00,0x80,
+0xb0,0x00,0x00,0x00,0xbf,0xff,0xff,0xfb,0x19,0x00,0x11,0x0b,0x0f,0x00,0x00,0x11,
+0x00,0x10,0xfb,0x55,0x00,0xdb,0xff,0xfc,0x1b,0xb1,0xcf,0xff,0xfd,0xff,0xff,0xff,
+0xc2,0x2c,0xff,0x01,0x00,0x42,0xf0,0xe0,0xff,0xdf,0x0a,0x00,0xc1,0xfd,0x00,0x04,
+0xef,0xff,0xff,0xff,0xfe,0x40,0x00,0x00,0x1e,0x11,0x00,0x50,0xe1,0x00,0x00,0xaf,
+0xb0,0x4e,0x00,0xe1,0xfa,0x00,0x05,0xff,0x10,0x00,0x00,0x00,0x01,0xff,0x50,0x1e,
+0xf6,0x00,0x1d,0x01,0x11,0xe1,0x1a,0x00,0x00,0x1c,0x00,0x40,0xff,0xff,0xff,0x70,
+0x71,0x01,0x01,0xf1,0x00,0x03,0xf0,0x00,0x0f,0x01,0x00,0x06,0x13,0x8f,0x08,0x00,
+0xf1,0x1d,0xf8,0x00,0x00,0x06,0xbd,0xda,0x50,0x02,0xff,0x00,0x05,0xef,0xff,0xff,
 0xfe,0x42,0xff,0x00,0x7f,0xff,0xa7,0x7b,0xff,0xf9,0xff,0x05,0xff,0xc1,0x00,0x00,
-0x2c,0xff,0xff,0x0e,0x29,0x09,0x20,0x22,0xdf,0x76,0x06,0x01,0x54,0x00,0x22,0x8f,
-0xb0,0x08,0x00,0x0c,0x54,0x0b,0x02,0x5d,0x01,0x21,0x0b,0xf8,0x08,0x00,0x00,0x13,
-0x1c,0x20,0xfd,0x22,0x33,0x16,0x40,0xe0,0xff,0xff,0xc2,0x48,0x00,0xd0,0x40,0xff,
-0x9f,0xff,0xb7,0x6a,0xff,0xf7,0x00,0xff,0x24,0xdf,0xff,0xfe,0x0e,0x56,0xff,0x20,
-0x05,0xac,0xdb,0x9c,0x0b,0x10,0x8d,0x29,0x04,0x5e,0x00,0x00,0x8f,0xff,0xdf,0xad,
-0x00,0x01,0x14,0x00,0x02,0x57,0x02,0x22,0x09,0xff,0x2c,0x00,0x28,0x00,0x00,0x3a,
-0x00,0x02,0x3c,0x00,0x00,0x3e,0x00,0x02,0x12,0x05,0x20,0x01,0x50,0x36,0x00,0x21,
-0x06,0xf7,0x1c,0x05,0x11,0xbe,0x06,0x00,0x10,0xae,0x06,0x00,0x20,0x05,0xf8,0x4a,
-0x00,0x22,0x02,0x60,0x4c,0x00,0x03,0x4e,0x00,0x3b,0x00,0x00,0x9e,0x1e,0x0c,0x13,
-0x10,0x09,0x00,0x23,0x1f,0xd2,0x60,0x00,0x31,0x03,0xee,0x10,0x63,0x00,0x41,0x0a,
-0xb1,0x2f,0xb0,0x66,0x00,0x41,0x05,0xfc,0x07,0xf4,0x4b,0x00,0x42,0x50,0x5f,0x60,
-0xf9,0x6c,0x00,0x32,0x0d,0xc0,0xbd,0x69,0x00,0x33,0x09,0xf0,0x9f,0x09,0x00,0x24,
-0xe0,0x8f,0x1b,0x00,0x14,0xad,0x2d,0x00,0x11,0xe9,0x7b,0x00,0x20,0x05,0xfc,0xe7,
-0x20,0x14,0x09,0x51,0x00,0x00,0x63,0x00,0x38,0x02,0xee,0x10,0x75,0x00,0x02,0x87,
-0x00,0x13,0x8f,0xa4,0x01,0x23,0xff,0xfc,0x09,0x01,0x21,0x20,0x2f,0x07,0x00,0x10,
-0xfc,0x79,0x04,0x12,0xee,0x10,0x00,0x60,0xfe,0x12,0xef,0xff,0xff,0xfc,0x24,0x02,
-0x70,0x2e,0xff,0xff,0xfe,0x4e,0xfe,0x10,0x8b,0x15,0x31,0xe1,0x02,0xc1,0x93,0x01,
-0x1b,0x10,0xac,0x02,0x09,0xfd,0x01,0x00,0xfc,0x01,0x31,0x4e,0x40,0x00,0x43,0x07,
-0x00,0x53,0x02,0x10,0xf1,0x30,0x08,0x00,0x3a,0x11,0x10,0x2f,0x8d,0x22,0x10,0x0c,
-0x67,0x00,0x10,0x07,0x26,0x00,0x20,0x02,0xff,0xb8,0x17,0x01,0xd5,0x00,0x20,0x9e,
-0xff,0x98,0x02,0x20,0xff,0x2f,0x06,0x00,0xf1,0x02,0xf2,0xbf,0xff,0xff,0xfe,0x9f,
-0xa1,0xbf,0xff,0xff,0x92,0xff,0xa2,0x2f,0xff,0xf2,0x04,0x03,0x03,0x43,0x02,0x9e,
-0xfe,0x92,0x6e,0x00,0xf0,0x06,0x30,0x00,0x01,0xcc,0xff,0x40,0x00,0x2d,0xff,0xff,
-0x40,0x03,0xef,0xff,0xff,0x40,0x3f,0xff,0xff,0xff,0x44,0x41,0x00,0x1a,0x9f,0xde,
-0x01,0x10,0xaf,0x05,0x00,0x10,0x45,0x05,0x00,0x34,0x40,0x4f,0xff,0x2d,0x00,0x00,
-0x37,0x00,0x00,0x41,0x00,0x08,0x99,0x01,0x23,0x8f,0x91,0xc7,0x00,0x12,0x70,0x07,
-0x00,0x22,0xfd,0x40,0xd5,0x00,0x22,0xfa,0x10,0xdc,0x00,0x13,0xf7,0xe3,0x00,0x13,
-0xd5,0xea,0x00,0x13,0xb2,0x4f,0x03,0x09,0x07,0x00,0x17,0xb2,0x23,0x00,0x12,0xf7,
-0x3f,0x00,0x17,0x20,0x4d,0x00,0x11,0x70,0x29,0x11,0x2e,0xa1,0x00,0x01,0x00,0x11,
-0x8f,0x26,0x04,0x00,0xe0,0x02,0x03,0x5f,0x00,0x0f,0x07,0x00,0x37,0x83,0x7f,0xff,
-0xf7,0x00,0x7f,0xff,0xf7,0x8f,0xee,0x01,0x0f,0x01,0x00,0x40,0x03,0x5b,0x00,0x01,
-0xc9,0x00,0x90,0xcc,0x10,0x00,0x03,0xff,0xff,0xd2,0x00,0x04,0x63,0x1f,0x01,0xb6,
-0x01,0x10,0x04,0x1d,0x00,0x23,0x54,0xff,0x16,0x1f,0x07,0x01,0x00,0x23,0xf9,0xff,
-0xb4,0x01,0x14,0xf3,0x2d,0x00,0x00,0x37,0x00,0x01,0x41,0x00,0x04,0x17,0x01,0x22,
-0x2d,0xd2,0x6f,0x0f,0x01,0x89,0x0d,0x01,0xf8,0x1c,0x01,0xa8,0x14,0x11,0xcf,0xf6,
-0x1e,0x05,0x11,0x05,0x21,0xaf,0xff,0x14,0x12,0x12,0x09,0x57,0x00,0x23,0x90,0x0f,
-0xf3,0x04,0x03,0xae,0x04,0x14,0x80,0x4d,0x00,0x12,0x0c,0x10,0x00,0x14,0xc0,0x20,
-0x00,0x04,0x08,0x00,0x03,0x18,0x00,0x00,0x7b,0x07,0x70,0x1a,0x40,0x00,0x00,0x01,
-0xdf,0xf0,0x6a,0x00,0x57,0xa0,0x00,0x01,0xdf,0xfa,0x09,0x00,0x30,0x0c,0xff,0xa0,
-0x7d,0x12,0x10,0x80,0x21,0x00,0x11,0xf8,0x8c,0x00,0x0c,0x0b,0x00,0x01,0x74,0x25,
-0x11,0x50,0x5f,0x07,0x30,0x0f,0xfc,0x10,0xc5,0x1b,0x10,0xc1,0x17,0x07,0x0c,0x0b,
-0x00,0x00,0x69,0x00,0x10,0x08,0xd3,0x0d,0x77,0x8f,0xfd,0x10,0x00,0x08,0xff,0xd1,
-0x09,0x00,0x20,0x0f,0xfd,0x41,0x07,0x12,0xb1,0x47,0x22,0x22,0xff,0x40,0x7c,0x04,
-0x1f,0x80,0x07,0x00,0x04,0x7a,0x48,0x88,0x8c,0xff,0xc8,0x88,0x84,0x54,0x01,0x03,
-0x15,0x00,0x0f,0x38,0x00,0x09,0x03,0x5b,0x00,0x02,0xe8,0x10,0x32,0x41,0xef,0xff,
-0x76,0x03,0x02,0x01,0x00,0x20,0x7b,0xbb,0x01,0x00,0x71,0xb7,0x00,0x00,0x05,0xad,
-0xff,0xda,0x45,0x14,0x40,0xdf,0xfc,0x88,0xcf,0xbe,0x02,0x60,0x7f,0xfe,0x40,0x00,
-0x04,0xef,0x52,0x1e,0xf0,0x08,0xf4,0x00,0x9e,0x80,0x4f,0xff,0x70,0x4f,0xff,0xc0,
-0x00,0xaf,0xf8,0x0c,0xff,0xf4,0xdf,0xff,0x80,0x9a,0xff,0xfe,0x08,0xe1,0x09,0x21,
-0x80,0xef,0x09,0x00,0x50,0x4f,0xff,0xc0,0x8f,0xff,0x1b,0x00,0x50,0x07,0xff,0xf4,
-0x08,0xee,0x2d,0x00,0x03,0x3f,0x00,0x17,0xf8,0x51,0x00,0x04,0x63,0x00,0x25,0x8c,
-0x20,0x59,0x09,0x14,0xe4,0x0a,0x00,0x91,0x1b,0xff,0x80,0x49,0xdf,0xfd,0xa5,0x00,
-0x00,0x23,0x0b,0x62,0xd8,0x8c,0xff,0xd4,0x00,0x00,0x3f,0x00,0x11,0x4e,0x44,0x03,
-0xf0,0x07,0x1c,0xff,0x69,0xe8,0x04,0xff,0xf7,0x00,0x04,0xe3,0x00,0x9f,0xfe,0xff,
-0x80,0xcf,0xff,0x40,0x0d,0xff,0x70,0x05,0x22,0x23,0x71,0xff,0xd0,0x0d,0xff,0xf7,
-0x00,0x2d,0x0a,0x00,0x20,0x04,0xff,0x03,0x1b,0xa1,0xf8,0xcf,0xff,0x30,0x00,0x7f,
-0xff,0x40,0x00,0x06,0x93,0x03,0x10,0x08,0x4a,0x07,0x11,0x3e,0xa7,0x13,0x70,0x4d,
-0xff,0xc8,0x82,0x01,0xbf,0xf7,0x66,0x00,0x65,0x5a,0xdf,0xfc,0x10,0x08,0xff,0xfa,
-0x15,0x25,0x4e,0xfd,0xb4,0x10,0x17,0xc8,0x87,0x02,0x07,0x8b,0x09,0x00,0x6a,0x09,
-0x02,0xca,0x08,0x03,0x86,0x16,0x03,0xac,0x00,0x13,0xf7,0x2a,0x16,0x22,0xd8,0x8d,
-0x1f,0x05,0x61,0x0a,0xff,0xa0,0x0a,0xff,0xa0,0x41,0x17,0x00,0xe7,0x09,0x12,0xf3,
+0x2c,0xff,0xff,0x0e,0xfc,0x00,0x00,0x02,0x22,0xdf,0xff,0x5f,0xf2,0x00,0x54,0x00,
+0x22,0x8f,0xb0,0x08,0x00,0x1b,0x00,0x01,0x00,0x02,0x5d,0x01,0x22,0x0b,0xf8,0x08,
+0x00,0xd0,0x2f,0xf4,0xff,0xfd,0x22,0x20,0x00,0x00,0xcf,0xe0,0xff,0xff,0xc2,0x48,
+0x00,0xf5,0x08,0x40,0xff,0x9f,0xff,0xb7,0x6a,0xff,0xf7,0x00,0xff,0x24,0xdf,0xff,
+0xff,0xfe,0x50,0x00,0xff,0x20,0x05,0xac,0xdb,0x60,0x3f,0x00,0xae,0x8d,0x00,0x00,
+0x08,0xff,0x00,0x00,0x8f,0xff,0xdf,0xad,0x00,0x01,0x14,0x00,0x02,0x57,0x02,0x22,
+0x09,0xff,0x2c,0x00,0x28,0x00,0x00,0x3a,0x00,0x02,0x3c,0x00,0x00,0x3e,0x00,0x80,
+0x00,0x00,0xcf,0xff,0xff,0xff,0x01,0x50,0x36,0x00,0x30,0x06,0xf7,0xff,0x38,0x00,
+0x11,0xbe,0x06,0x00,0x10,0xae,0x06,0x00,0x20,0x05,0xf8,0x4a,0x00,0x22,0x02,0x60,
+0x4c,0x00,0x03,0x4e,0x00,0x3a,0x00,0x00,0x9e,0xca,0x00,0x23,0x06,0x10,0x09,0x00,
+0x23,0x1f,0xd2,0x60,0x00,0x31,0x03,0xee,0x10,0x63,0x00,0x41,0x0a,0xb1,0x2f,0xb0,
+0x66,0x00,0x41,0x05,0xfc,0x07,0xf4,0x4b,0x00,0x42,0x50,0x5f,0x60,0xf9,0x6c,0x00,
+0x32,0x0d,0xc0,0xbd,0x69,0x00,0x33,0x09,0xf0,0x9f,0x09,0x00,0x24,0xe0,0x8f,0x1b,
+0x00,0x14,0xad,0x2d,0x00,0x11,0xe9,0x7b,0x00,0x41,0x05,0xfc,0x06,0xf4,0x7e,0x00,
+0x02,0x51,0x00,0x00,0x63,0x00,0x38,0x02,0xee,0x10,0x75,0x00,0x02,0x87,0x00,0x13,
+0x8f,0xa4,0x01,0x23,0xff,0xfc,0x09,0x01,0x21,0x20,0x2f,0x07,0x00,0x62,0xfc,0x00,
+0x0c,0xff,0xff,0xee,0x10,0x00,0x60,0xfe,0x12,0xef,0xff,0xff,0xfc,0x24,0x02,0xe1,
+0x2e,0xff,0xff,0xfe,0x4e,0xfe,0x10,0x00,0x02,0xff,0xff,0xe1,0x02,0xc1,0x93,0x01,
+0x1b,0x10,0xac,0x02,0x09,0xfd,0x01,0x00,0xfc,0x01,0x20,0x4e,0x40,0x3b,0x02,0x11,
+0xfb,0x53,0x02,0x20,0xf1,0x00,0x9d,0x00,0x90,0x90,0x00,0x00,0x2f,0xff,0xff,0x30,
+0x00,0x0c,0x67,0x00,0x10,0x07,0x26,0x00,0x10,0x02,0x2c,0x00,0x11,0xf2,0xd5,0x00,
+0x20,0x9e,0xff,0x98,0x02,0x20,0xff,0x2f,0x06,0x00,0xf1,0x02,0xf2,0xbf,0xff,0xff,
+0xfe,0x9f,0xa1,0xbf,0xff,0xff,0x92,0xff,0xa2,0x2f,0xff,0xf2,0x04,0x03,0x03,0x43,
+0x02,0x9e,0xfe,0x92,0x6e,0x00,0xf0,0x06,0x30,0x00,0x01,0xcc,0xff,0x40,0x00,0x2d,
+0xff,0xff,0x40,0x03,0xef,0xff,0xff,0x40,0x3f,0xff,0xff,0xff,0x44,0x41,0x00,0x1a,
+0x9f,0xde,0x01,0x10,0xaf,0x05,0x00,0x10,0x45,0x05,0x00,0x34,0x40,0x4f,0xff,0x2d,
+0x00,0x00,0x37,0x00,0x00,0x41,0x00,0x08,0x99,0x01,0x23,0x8f,0x91,0xc7,0x00,0x12,
+0x70,0x07,0x00,0x22,0xfd,0x40,0xd5,0x00,0x22,0xfa,0x10,0xdc,0x00,0x13,0xf7,0xe3,
+0x00,0x13,0xd5,0xea,0x00,0x13,0xb2,0x4f,0x03,0x09,0x07,0x00,0x17,0xb2,0x23,0x00,
+0x12,0xf7,0x3f,0x00,0x17,0x20,0x4d,0x00,0x01,0x5b,0x00,0x3e,0x8e,0xa1,0x00,0x01,
+0x00,0x11,0x8f,0x26,0x04,0x00,0xe0,0x02,0x03,0x5f,0x00,0x0f,0x07,0x00,0x37,0x83,
+0x7f,0xff,0xf7,0x00,0x7f,0xff,0xf7,0x8f,0xee,0x01,0x0f,0x01,0x00,0x40,0x03,0x5b,
+0x00,0x01,0xc9,0x00,0xd1,0xcc,0x10,0x00,0x03,0xff,0xff,0xd2,0x00,0x04,0xff,0xff,
+0xfe,0x30,0xb6,0x01,0x10,0x04,0x1d,0x00,0x20,0x54,0xff,0x0c,0x01,0x0a,0x37,0x00,
+0x23,0xf9,0xff,0xb4,0x01,0x14,0xf3,0x2d,0x00,0x00,0x37,0x00,0x01,0x41,0x00,0x04,
+0x17,0x01,0x12,0x2d,0xb0,0x02,0x31,0x01,0xef,0xfe,0x6d,0x02,0x40,0x1d,0xff,0xff,
+0xd1,0x08,0x00,0x10,0xcf,0x3f,0x02,0x06,0x11,0x05,0x11,0xaf,0x5d,0x00,0x22,0x00,
+0x09,0x57,0x00,0x23,0x90,0x0f,0xf3,0x04,0x03,0xae,0x04,0x14,0x80,0x4d,0x00,0x12,
+0x0c,0x10,0x00,0x14,0xc0,0x20,0x00,0x04,0x08,0x00,0x04,0x18,0x00,0xa0,0x00,0x00,
+0x00,0x1a,0x40,0x00,0x00,0x01,0xdf,0xf0,0x6a,0x00,0x57,0xa0,0x00,0x01,0xdf,0xfa,
+0x09,0x00,0x80,0x0c,0xff,0xa0,0x00,0x00,0x0d,0xff,0x80,0x21,0x00,0x11,0xf8,0x8c,
+0x00,0x0b,0x0b,0x00,0x00,0x37,0x00,0x40,0x00,0x1b,0x50,0x04,0xdf,0x01,0x70,0x0f,
+0xfc,0x10,0x00,0x00,0x0a,0xff,0x28,0x03,0x1d,0xaf,0x0b,0x00,0x10,0xc0,0xef,0x03,
+0xa7,0xd0,0x00,0x00,0x8f,0xfd,0x10,0x00,0x08,0xff,0xd1,0x09,0x00,0x71,0x0f,0xfd,
+0x10,0x00,0x00,0x05,0xb1,0xae,0x00,0x32,0x04,0xff,0x40,0x7c,0x04,0x1f,0x80,0x07,
+0x00,0x04,0x7a,0x48,0x88,0x8c,0xff,0xc8,0x88,0x84,0x54,0x01,0x03,0x15,0x00,0x0f,
+0x38,0x00,0x09,0x03,0x5b,0x00,0x20,0x14,0x44,0x01,0x00,0x32,0x41,0xef,0xff,0x76,
+0x03,0x02,0x01,0x00,0x20,0x7b,0xbb,0x01,0x00,0x80,0xb7,0x00,0x00,0x05,0xad,0xff,
+0xda,0x50,0x2b,0x00,0x40,0xdf,0xfc,0x88,0xcf,0xbe,0x02,0xf1,0x18,0x7f,0xfe,0x40,
+0x00,0x04,0xef,0xf7,0x00,0x07,0xff,0xf4,0x00,0x9e,0x80,0x4f,0xff,0x70,0x4f,0xff,
+0xc0,0x00,0xaf,0xf8,0x0c,0xff,0xf4,0xdf,0xff,0x80,0x9a,0xff,0xfe,0x08,0xff,0xfd,
+0xdf,0xff,0x80,0xef,0x09,0x00,0x50,0x4f,0xff,0xc0,0x8f,0xff,0x1b,0x00,0x50,0x07,
+0xff,0xf4,0x08,0xee,0x2d,0x00,0x03,0x3f,0x00,0x17,0xf8,0x51,0x00,0x04,0x63,0x00,
+0x24,0x8c,0x20,0xa0,0x01,0x24,0xdf,0xe4,0x0a,0x00,0x70,0x1b,0xff,0x80,0x49,0xdf,
+0xfd,0xa5,0x0b,0x00,0x92,0x7f,0xff,0xff,0xd8,0x8c,0xff,0xd4,0x00,0x00,0x3f,0x00,
+0x11,0x4e,0x44,0x03,0xf1,0x12,0x1c,0xff,0x69,0xe8,0x04,0xff,0xf7,0x00,0x04,0xe3,
+0x00,0x9f,0xfe,0xff,0x80,0xcf,0xff,0x40,0x0d,0xff,0x70,0x05,0xff,0xff,0xe0,0x8f,
+0xff,0xd0,0x0d,0xff,0xf7,0x00,0x2d,0x0a,0x00,0x10,0x04,0x25,0x02,0xb1,0xaf,0xf8,
+0xcf,0xff,0x30,0x00,0x7f,0xff,0x40,0x00,0x06,0x93,0x03,0x10,0x08,0x4a,0x07,0x10,
+0x3e,0xcc,0x01,0x80,0x00,0x4d,0xff,0xc8,0x82,0x01,0xbf,0xf7,0x66,0x00,0x74,0x5a,
+0xdf,0xfc,0x10,0x08,0xff,0xb0,0x80,0x00,0x24,0x4e,0xfd,0x0a,0x00,0x27,0x02,0xc8,
+0x87,0x02,0x04,0x6a,0x07,0x10,0x00,0xbe,0x00,0x32,0xff,0xff,0x50,0x0a,0x00,0x20,
+0x0d,0xff,0xcd,0x01,0x03,0xac,0x00,0x12,0xf7,0xb0,0x02,0x32,0xff,0xd8,0x8d,0x1f,
+0x05,0x41,0x0a,0xff,0xa0,0x0a,0x6d,0x00,0x72,0x00,0x3f,0xff,0xb0,0x0b,0xff,0xf3,
 0xbe,0x02,0x42,0xc0,0x0c,0xff,0xfc,0x44,0x00,0x21,0xd0,0x0d,0x48,0x00,0x12,0x0e,
 0xc2,0x08,0x20,0xe0,0x00,0x96,0x05,0x20,0xe2,0x2e,0x4d,0x03,0x10,0x02,0xcb,0x02,
-0x00,0xd3,0x02,0x20,0x10,0x0a,0x86,0x22,0x10,0x3e,0x73,0x28,0x05,0x77,0x07,0x04,
-0xdc,0x02,0x07,0xde,0x02,0x02,0x01,0x00,0x14,0xd8,0x31,0x07,0x10,0x80,0x6e,0x04,
-0x11,0x07,0xf1,0x03,0x10,0xf6,0xf1,0x1d,0xf0,0x00,0xfd,0x78,0x8e,0xff,0x15,0xff,
-0xe8,0xff,0xe2,0x00,0x02,0xe5,0x4f,0xfe,0x20,0xf6,0x17,0x51,0x13,0xff,0xf3,0x00,
-0x52,0x9a,0x00,0x30,0x31,0x00,0x52,0xe8,0x10,0x90,0xf4,0x5e,0x20,0xfe,0x20,0x78,
-0x8e,0xff,0x51,0x28,0x00,0x04,0x38,0x00,0x04,0x48,0x00,0x04,0x58,0x00,0x0a,0x68,
-0x00,0x07,0x01,0x00,0x23,0x01,0xdd,0xa4,0x03,0x20,0xd1,0x00,0x0e,0x03,0x30,0xff,
-0xfd,0x10,0x0d,0x00,0xf1,0x04,0x99,0xff,0xd1,0x00,0x01,0xdf,0xf9,0x00,0x9f,0xfd,
-0x10,0x1d,0xff,0x90,0x00,0x09,0xff,0xd1,0xbf,0x11,0x17,0x30,0xfb,0x5f,0x90,0x24,
-0x07,0x1a,0xf5,0x44,0x00,0x03,0x15,0x00,0x03,0x23,0x00,0x03,0x31,0x00,0x03,0x3f,
-0x00,0x03,0x4d,0x00,0x04,0x5b,0x00,0x03,0x69,0x00,0x04,0x77,0x00,0x0c,0x01,0x00,
-0x24,0x1d,0xd1,0x97,0x00,0x40,0xdf,0xfd,0x10,0xef,0x16,0x0a,0x01,0x3e,0x04,0x11,
-0xaf,0x42,0x08,0x60,0xcf,0xcf,0xfc,0xfc,0x00,0x00,0xb6,0x28,0x42,0x6b,0x1f,0xf1,
-0xb6,0x0a,0x00,0x01,0x04,0x00,0x0f,0x0a,0x00,0x02,0x01,0x24,0x00,0x01,0x0a,0x00,
-0x01,0x38,0x00,0x10,0x0f,0x6d,0x04,0x01,0x8a,0x04,0x10,0x0d,0x3a,0x03,0x00,0x60,
-0x00,0x0c,0x74,0x00,0x02,0xd2,0x05,0x02,0xa0,0x00,0x01,0x55,0x14,0x06,0x20,0x07,
-0x0f,0x81,0x05,0x2e,0x06,0x5f,0x07,0x05,0xab,0x18,0x03,0x95,0x02,0x04,0x0f,0x0a,
-0x03,0x1f,0x0a,0x04,0x1e,0x05,0x04,0x3f,0x0a,0x0f,0x6f,0x0a,0x14,0x84,0xdf,0xff,
-0xf0,0xdf,0xfd,0x0f,0xff,0xfd,0x61,0x23,0x0f,0x47,0x0a,0x06,0x09,0x01,0x00,0x32,
-0x0a,0xea,0x62,0x30,0x03,0x04,0x54,0x14,0x13,0x9f,0x55,0x00,0x13,0x0f,0x1e,0x03,
-0x23,0x02,0xff,0x02,0x0d,0x43,0x03,0xef,0xff,0x70,0xe1,0x04,0x1a,0xf2,0x54,0x03,
-0x10,0x6f,0x30,0x16,0x10,0x02,0xb1,0x00,0xf1,0x02,0x90,0x00,0x02,0x8f,0xf3,0x00,
-0x6f,0xff,0xd0,0x00,0x0a,0xff,0xff,0xe4,0xbf,0xff,0xd1,0xe5,0x23,0x01,0x51,0x01,
-0x11,0x0a,0xe3,0x05,0x01,0x2e,0x00,0x31,0xff,0xfb,0x30,0x59,0x00,0x31,0xdb,0x72,
-0x00,0xdd,0x04,0x70,0xee,0x80,0x00,0x00,0x06,0x61,0x08,0x14,0x03,0xf0,0x02,0x2d,
-0xff,0xd0,0xef,0x33,0xfe,0x00,0x2e,0xff,0xf3,0x0e,0xf3,0x3f,0xe0,0x2e,0xff,0xf3,
-0x8f,0x01,0x10,0x6e,0x7f,0x03,0x10,0x8e,0x70,0x06,0x10,0x00,0xee,0x02,0x02,0x8d,
-0x03,0x20,0x2e,0xff,0x76,0x00,0x10,0x08,0x5f,0x00,0x10,0x30,0xe0,0x0a,0xc0,0xf6,
-0xef,0xff,0x30,0x00,0xef,0x33,0xfe,0x02,0xef,0xff,0x30,0x3c,0x00,0x00,0x08,0x00,
-0x10,0x8f,0x8f,0x03,0x40,0xdf,0xfd,0x00,0x8e,0xd1,0x15,0x21,0x66,0x10,0xd6,0x0e,
-0x12,0x0d,0x17,0x08,0x22,0x0f,0xd1,0x07,0x00,0x50,0xfd,0xdf,0xf0,0xff,0xff,0x49,
-0x14,0x13,0xf0,0x29,0x01,0x0f,0x07,0x00,0x1e,0x11,0xdf,0x46,0x08,0x16,0xf9,0x4c,
-0x09,0x01,0x67,0x00,0x00,0x68,0x01,0x01,0xf2,0x01,0x32,0xc1,0x00,0xff,0xa0,0x16,
-0x11,0xff,0x60,0x04,0x12,0xd1,0x6c,0x0f,0x12,0xfc,0x07,0x00,0x02,0x6c,0x01,0x0e,
-0x2c,0x02,0x40,0xfb,0x11,0xbf,0xff,0x21,0x17,0x27,0x00,0x1f,0x07,0x00,0x03,0x15,
-0x00,0x08,0xba,0x07,0x20,0x12,0x22,0x01,0x00,0x1a,0x21,0x3d,0x00,0x03,0x15,0x00,
-0x03,0xe1,0x01,0x0f,0x23,0x00,0x2c,0x1b,0x8f,0xfe,0x02,0x22,0xcf,0xff,0x6c,0x0a,
-0x04,0xb4,0x07,0x21,0xd2,0x5f,0xc3,0x17,0x30,0x2d,0xff,0x62,0xdc,0x07,0x90,0x26,
-0xff,0xff,0xfa,0x18,0xff,0xff,0x81,0xaf,0xfa,0x04,0x31,0x4d,0xd4,0x3e,0x24,0x00,
-0x2f,0x81,0x18,0x0e,0x03,0x09,0x01,0x56,0x10,0x11,0x01,0x18,0x08,0x10,0x03,0x87,
-0x05,0x00,0xef,0x05,0x11,0xf2,0x20,0x10,0x13,0xd0,0x35,0x02,0x11,0xd0,0xe8,0x07,
+0x00,0xd3,0x02,0xb5,0x10,0x0a,0xff,0xff,0xff,0xe3,0x3e,0xff,0xff,0xff,0xa0,0x77,
+0x07,0x04,0xdc,0x02,0x07,0xde,0x02,0x02,0x01,0x00,0x14,0xd8,0x31,0x07,0x10,0x80,
+0x6e,0x04,0x11,0x07,0xf1,0x03,0x00,0x77,0x08,0xf1,0x0a,0xff,0xfd,0x78,0x8e,0xff,
+0x15,0xff,0xe8,0xff,0xe2,0x00,0x02,0xe5,0x4f,0xfe,0x20,0xfe,0x20,0x00,0x00,0x13,
+0xff,0xf3,0x00,0x52,0x9a,0x00,0x10,0x31,0x08,0x00,0xb0,0x02,0xef,0xf4,0x5e,0x20,
+0xfe,0x20,0x78,0x8e,0xff,0x51,0x28,0x00,0x04,0x38,0x00,0x04,0x48,0x00,0x04,0x58,
+0x00,0x0a,0x68,0x00,0x07,0x01,0x00,0x23,0x01,0xdd,0xa4,0x03,0x20,0xd1,0x00,0x0e,
+0x03,0x30,0xff,0xfd,0x10,0x0d,0x00,0xf0,0x05,0x99,0xff,0xd1,0x00,0x01,0xdf,0xf9,
+0x00,0x9f,0xfd,0x10,0x1d,0xff,0x90,0x00,0x09,0xff,0xd1,0xbf,0xf9,0x0b,0x06,0x30,
+0xfb,0x5f,0x90,0x24,0x07,0x1a,0xf5,0x44,0x00,0x03,0x15,0x00,0x03,0x23,0x00,0x03,
+0x31,0x00,0x03,0x3f,0x00,0x03,0x4d,0x00,0x04,0x5b,0x00,0x03,0x69,0x00,0x04,0x77,
+0x00,0x0c,0x01,0x00,0x24,0x1d,0xd1,0x97,0x00,0x40,0xdf,0xfd,0x10,0xef,0x16,0x0a,
+0x01,0x3e,0x04,0x11,0xaf,0x42,0x08,0x40,0xcf,0xcf,0xfc,0xfc,0xa6,0x03,0x62,0xf0,
+0x00,0x6b,0x1f,0xf1,0xb6,0x0a,0x00,0x01,0x04,0x00,0x0f,0x0a,0x00,0x02,0x01,0x24,
+0x00,0x01,0x0a,0x00,0x01,0x38,0x00,0x10,0x0f,0x6d,0x04,0x01,0x8a,0x04,0x10,0x0d,
+0x3a,0x03,0x00,0x60,0x00,0x0c,0x74,0x00,0x02,0xd2,0x05,0x23,0xff,0xd1,0x18,0x07,
+0x01,0x21,0x00,0x04,0x13,0x09,0x0f,0x6d,0x05,0x33,0x01,0x90,0x01,0x29,0x0b,0xb0,
+0x95,0x02,0x04,0x0f,0x0a,0x03,0x1f,0x0a,0x04,0x1e,0x05,0x04,0x3f,0x0a,0x0f,0x6f,
+0x0a,0x14,0x60,0xdf,0xff,0xf0,0xdf,0xfd,0x0f,0xf8,0x01,0x01,0x65,0x0b,0x0f,0x47,
+0x0a,0x07,0x09,0x01,0x00,0x32,0x0a,0xea,0x62,0x30,0x03,0x01,0xa1,0x09,0x01,0xec,
+0x07,0x02,0x55,0x00,0x13,0x0f,0x1e,0x03,0x13,0x02,0xb4,0x0a,0x53,0x00,0x03,0xef,
+0xff,0x70,0xe1,0x04,0x1a,0xf2,0x54,0x03,0x60,0x6f,0xff,0x30,0x00,0x00,0x02,0xb1,
+0x00,0xf0,0x00,0x90,0x00,0x02,0x8f,0xf3,0x00,0x6f,0xff,0xd0,0x00,0x0a,0xff,0xff,
+0xe4,0xbf,0x49,0x01,0x01,0xa8,0x04,0x10,0xd1,0x51,0x03,0x00,0x18,0x03,0x01,0x2e,
+0x00,0x31,0xff,0xfb,0x30,0x59,0x00,0x31,0xdb,0x72,0x00,0xdd,0x04,0x70,0xee,0x80,
+0x00,0x00,0x06,0x61,0x08,0x14,0x03,0xf0,0x02,0x2d,0xff,0xd0,0xef,0x33,0xfe,0x00,
+0x2e,0xff,0xf3,0x0e,0xf3,0x3f,0xe0,0x2e,0xff,0xf3,0x8f,0x01,0x10,0x6e,0x7f,0x03,
+0x10,0x8e,0x70,0x06,0x10,0x00,0xee,0x02,0x02,0x8d,0x03,0x20,0x2e,0xff,0x76,0x00,
+0x10,0x08,0x5f,0x00,0x10,0x30,0xe0,0x0a,0xc0,0xf6,0xef,0xff,0x30,0x00,0xef,0x33,
+0xfe,0x02,0xef,0xff,0x30,0x3c,0x00,0x00,0x08,0x00,0x10,0x8f,0x8f,0x03,0xa0,0xdf,
+0xfd,0x00,0x8e,0xe8,0x00,0x00,0x00,0x66,0x10,0x24,0x01,0x22,0xff,0x0d,0x17,0x08,
+0x22,0x0f,0xd1,0x07,0x00,0x30,0xfd,0xdf,0xf0,0x32,0x09,0x33,0x00,0xff,0xf0,0x29,
+0x01,0x0f,0x07,0x00,0x1e,0x11,0xdf,0x46,0x08,0x16,0xf9,0x4c,0x09,0x01,0x67,0x00,
+0x00,0x68,0x01,0x01,0xf2,0x01,0x22,0xc1,0x00,0x77,0x01,0x21,0x10,0xff,0x60,0x04,
+0x21,0xd1,0xff,0x28,0x00,0x12,0xfc,0x07,0x00,0x02,0x6c,0x01,0x0e,0x2c,0x02,0x30,
+0xfb,0x11,0xbf,0x07,0x00,0x37,0xf1,0x00,0x1f,0x07,0x00,0x03,0x15,0x00,0x08,0xba,
+0x07,0x20,0x12,0x22,0x01,0x00,0x1a,0x21,0x3d,0x00,0x03,0x15,0x00,0x03,0xe1,0x01,
+0x0f,0x23,0x00,0x2c,0x1b,0x8f,0xfe,0x02,0x22,0xcf,0xff,0x6c,0x0a,0x04,0xb4,0x07,
+0x20,0xd2,0x5f,0x07,0x00,0x40,0xf5,0x2d,0xff,0x62,0xdc,0x07,0x90,0x26,0xff,0xff,
+0xfa,0x18,0xff,0xff,0x81,0xaf,0xfa,0x04,0x31,0x4d,0xd4,0x3e,0x24,0x00,0x2f,0x81,
+0x18,0x0e,0x03,0x09,0x10,0xdf,0x2a,0x01,0x11,0x01,0x18,0x08,0x11,0x03,0x87,0x05,
+0x20,0x06,0xff,0x60,0x02,0x11,0x08,0x7f,0x02,0x11,0x0a,0x17,0x0e,0x01,0xe8,0x07,
 0x21,0xa0,0x0e,0xeb,0x0a,0x13,0x0d,0x43,0x03,0x11,0x0a,0x91,0x0d,0x11,0x0e,0xcc,
 0x05,0x21,0x2f,0xfc,0x83,0x04,0x11,0xf3,0xbf,0x02,0x11,0xa0,0x92,0x06,0x01,0xda,
-0x03,0x11,0xd7,0xae,0x02,0x21,0xde,0x40,0x1d,0x03,0x11,0x99,0xcb,0x26,0x24,0xff,
-0x99,0x18,0x11,0x01,0x07,0x00,0x12,0x90,0x7f,0x01,0x10,0x0d,0x17,0x02,0x30,0xff,
-0xff,0x0f,0x17,0x02,0x02,0x07,0x00,0x10,0xfd,0x07,0x00,0x00,0x17,0x02,0x13,0xff,
-0xbb,0x05,0x08,0x07,0x00,0x32,0xdf,0xff,0x0f,0x41,0x00,0x0a,0x07,0x00,0x13,0x0d,
-0x5e,0x03,0x13,0xcc,0x51,0x03,0x20,0x30,0x00,0x96,0x0e,0x32,0xff,0xfc,0x20,0xb1,
-0x0d,0x12,0xe1,0x96,0x03,0x12,0xf8,0x13,0x03,0x14,0xfd,0x86,0x00,0x12,0x01,0x07,
-0x00,0x02,0xb7,0x18,0x22,0x30,0x08,0x1c,0x06,0x03,0xe1,0x0d,0x12,0xcf,0x6c,0x01,
-0x03,0x07,0x00,0x05,0xb4,0x03,0x12,0x0e,0x8d,0x0e,0x33,0x04,0xee,0x40,0x64,0x02,
-0x0a,0x9f,0x04,0x30,0x00,0xf0,0x0f,0x03,0x00,0x07,0x09,0x00,0x05,0x01,0x00,0x77,
-0xf8,0x08,0x80,0x88,0x08,0x80,0x8f,0x09,0x00,0x07,0x36,0x00,0x00,0xf5,0x03,0x17,
-0x00,0x09,0x00,0x0e,0x15,0x0e,0x0a,0x01,0x00,0x23,0x03,0xaf,0x10,0x04,0x11,0xcf,
-0x3b,0x04,0x00,0x2e,0x2b,0x01,0x32,0x07,0x12,0x17,0x94,0x03,0x23,0x00,0x18,0xb6,
-0x00,0x13,0x2a,0x92,0x19,0x13,0x08,0xe6,0x0f,0x04,0x85,0x0e,0x13,0x60,0x12,0x00,
-0x14,0xfe,0xc5,0x04,0x14,0xf7,0x09,0x00,0x14,0xf1,0x09,0x00,0x14,0x80,0x09,0x00,
-0x13,0x10,0x09,0x00,0x14,0xfa,0x27,0x07,0x14,0xf2,0xae,0x05,0x09,0x48,0x07,0x00,
-0xb3,0x1b,0x11,0xd1,0x75,0x0e,0x21,0xfd,0x10,0xa3,0x03,0x11,0xd1,0x06,0x00,0x21,
-0xfd,0xff,0x54,0x02,0x0f,0xbe,0x05,0x29,0x1d,0xdf,0x3c,0x05,0x60,0x04,0x9c,0xef,
-0xfe,0xc9,0x40,0xe5,0x19,0x11,0xef,0xc6,0x00,0xf0,0x00,0x70,0x00,0x04,0xdf,0xff,
-0xfc,0xa8,0x8a,0xcf,0xff,0xfd,0x40,0x6f,0xff,0xd5,0x23,0x00,0x53,0x5d,0xff,0xf6,
-0xcf,0xf6,0x24,0x05,0x50,0xfc,0x1a,0x30,0x00,0x5a,0x1c,0x09,0x20,0x03,0xa1,0xc2,
-0x08,0x20,0xff,0xff,0x1c,0x09,0x00,0x79,0x2d,0x50,0xa8,0x8a,0xef,0xff,0x50,0xef,
-0x06,0x00,0x75,0x2f,0x01,0x72,0x06,0x10,0x12,0x31,0x00,0x13,0x21,0xd2,0x08,0x05,
-0x5c,0x09,0x2e,0xef,0xfe,0x0a,0x00,0x02,0x1e,0x00,0x15,0x8f,0x54,0x08,0x06,0xf0,
-0x05,0x04,0x8a,0x0b,0x27,0x0f,0xfd,0xbb,0x02,0x03,0x0a,0x00,0x06,0xd6,0x02,0x09,
-0xe0,0x02,0x06,0x32,0x00,0x05,0x46,0x00,0x06,0x5a,0x00,0x0f,0x64,0x00,0x11,0x24,
-0xf0,0x00,0x64,0x00,0x00,0xcc,0x28,0x0e,0x0a,0x00,0x0f,0x64,0x00,0x30,0x02,0x99,
-0x06,0x04,0x6a,0x10,0x0e,0x0a,0x00,0x0f,0x64,0x00,0x2f,0x24,0xf0,0x00,0x64,0x00,
-0x02,0x10,0x07,0x0e,0x0a,0x00,0x0f,0x64,0x00,0x2d,0x04,0x0a,0x00,0x06,0x2e,0x11,
-0x0e,0x0a,0x00,0x0f,0x64,0x00,0x0e,0x02,0x23,0x09,0x05,0x8d,0x02,0x14,0x07,0xcc,
-0x08,0x34,0x01,0xcf,0xff,0x9b,0x09,0x33,0xb9,0x29,0xfe,0x15,0x00,0x31,0x3f,0x10,
-0x02,0xb1,0x03,0x41,0xdf,0x80,0x0a,0x90,0x0f,0x2f,0xf0,0x0c,0x00,0xdf,0xff,0x77,
-0xf7,0x55,0x55,0x55,0x55,0x8f,0xd3,0x0f,0xff,0xfd,0xcc,0xdf,0xdc,0xcc,0xcc,0xcd,
-0xff,0xb0,0x8f,0xfe,0x10,0x00,0xaa,0x60,0x0b,0x93,0x40,0x00,0x46,0x10,0x00,0x01,
-0xf2,0x02,0x33,0x40,0x00,0x44,0x09,0xb1,0xcf,0xf9,0x30,0x08,0x03,0x35,0x05,0x01,
-0x00,0x08,0x15,0xf9,0x43,0x0a,0x21,0x22,0x00,0x0b,0x2d,0x70,0xfd,0x92,0x00,0x02,
-0xef,0xfb,0xef,0xd7,0x0b,0xf1,0x11,0xfa,0x2e,0xff,0xe0,0x4f,0xff,0xfa,0x03,0xff,
+0x03,0x11,0xd7,0xae,0x02,0x21,0xde,0x40,0x1d,0x03,0x30,0x99,0xff,0xfd,0x6a,0x01,
+0x35,0x99,0xff,0xff,0xa7,0x01,0x01,0x90,0x02,0x00,0x07,0x00,0x10,0x0d,0x17,0x02,
+0x30,0xff,0xff,0x0f,0x17,0x02,0x02,0x07,0x00,0x10,0xfd,0x07,0x00,0x00,0x17,0x02,
+0x13,0xff,0xbb,0x05,0x08,0x07,0x00,0x32,0xdf,0xff,0x0f,0x41,0x00,0x0a,0x07,0x00,
+0x13,0x0d,0x5e,0x03,0x13,0xcc,0x51,0x03,0x20,0x30,0x00,0x96,0x0e,0x32,0xff,0xfc,
+0x20,0xb1,0x0d,0x12,0xe1,0x96,0x03,0x12,0xf8,0x13,0x03,0x14,0xfd,0x86,0x00,0x12,
+0x01,0x07,0x00,0x11,0x03,0x07,0x00,0x22,0x30,0x08,0x1c,0x06,0x03,0xe1,0x0d,0x12,
+0xcf,0x6c,0x01,0x03,0x07,0x00,0x05,0xb4,0x03,0x12,0x0e,0x8d,0x0e,0x33,0x04,0xee,
+0x40,0x64,0x02,0x0a,0x9f,0x04,0x30,0x00,0xf0,0x0f,0x03,0x00,0x07,0x09,0x00,0x05,
+0x01,0x00,0x77,0xf8,0x08,0x80,0x88,0x08,0x80,0x8f,0x09,0x00,0x07,0x36,0x00,0x00,
+0xf5,0x03,0x17,0x00,0x09,0x00,0x08,0xab,0x01,0x50,0xff,0xff,0xff,0xff,0xf8,0x1a,
+0x00,0x01,0x00,0x31,0x03,0xaf,0x70,0x08,0x00,0x40,0x04,0xcf,0xff,0xf0,0x08,0x00,
+0xf0,0x0b,0x06,0xdf,0xff,0xff,0xa0,0x00,0x00,0x00,0x17,0xef,0xff,0xff,0xff,0x30,
+0x00,0x00,0x18,0xff,0xff,0xff,0xff,0xfc,0x00,0x00,0x2a,0xff,0x01,0x00,0x41,0xf4,
+0x00,0x08,0xff,0x01,0x00,0x32,0xd0,0x00,0x0f,0x09,0x00,0x13,0x60,0x12,0x00,0x12,
+0xfe,0x4f,0x00,0x34,0xff,0xff,0xf7,0x09,0x00,0x14,0xf1,0x09,0x00,0x14,0x80,0x09,
+0x00,0x13,0x10,0x09,0x00,0x23,0xfa,0x00,0x09,0x00,0x13,0xf2,0x09,0x00,0x28,0x8f,
+0x80,0x93,0x00,0xc0,0xdf,0xff,0xff,0xf0,0xd1,0x00,0xff,0xff,0xff,0xf0,0xfd,0x10,
+0x06,0x00,0x21,0xff,0xd1,0x06,0x00,0x30,0xfd,0xff,0xff,0x31,0x00,0x1f,0xff,0x01,
+0x00,0x28,0x10,0xdf,0x05,0x00,0x18,0xfd,0x6c,0x00,0xb1,0x04,0x9c,0xef,0xfe,0xc9,
+0x40,0x00,0x00,0x00,0x07,0xef,0xc6,0x00,0xf0,0x00,0x70,0x00,0x04,0xdf,0xff,0xfc,
+0xa8,0x8a,0xcf,0xff,0xfd,0x40,0x6f,0xff,0xd5,0x23,0x00,0x52,0x5d,0xff,0xf6,0xcf,
+0xf6,0x2e,0x00,0xf0,0x00,0x6f,0xfc,0x1a,0x30,0x00,0x5a,0xdf,0xfd,0xa5,0x00,0x03,
+0xa1,0x00,0x00,0x4d,0x32,0x00,0xf0,0x06,0xd4,0x00,0x00,0x00,0x05,0xff,0xfe,0xa8,
+0x8a,0xef,0xff,0x50,0x00,0x00,0x01,0xdf,0x70,0x00,0x00,0x07,0xfd,0xe9,0x00,0x10,
+0x12,0x31,0x00,0x12,0x21,0x38,0x00,0x24,0x4e,0xe4,0x70,0x00,0x2e,0xef,0xfe,0x0a,
+0x00,0x02,0x1e,0x00,0x14,0x8f,0xa5,0x00,0x15,0x80,0xaf,0x00,0x23,0xf0,0xff,0x22,
+0x00,0x33,0x0f,0xfd,0xff,0x6f,0x01,0x24,0x0f,0xff,0x0a,0x00,0x1e,0x00,0x0a,0x00,
+0x00,0x07,0x00,0x06,0x32,0x00,0x05,0x46,0x00,0x06,0x5a,0x00,0x0f,0x64,0x00,0x11,
+0x24,0xf0,0x00,0x64,0x00,0x10,0xf0,0x6d,0x01,0x0d,0x0a,0x00,0x0f,0x64,0x00,0x30,
+0x24,0x00,0x00,0x64,0x00,0x02,0x18,0x02,0x0d,0x0a,0x00,0x0f,0x64,0x00,0x2e,0x24,
+0xf0,0x00,0x64,0x00,0x13,0xf0,0x7c,0x02,0x0d,0x0a,0x00,0x0f,0x64,0x00,0x2c,0x04,
+0x0a,0x00,0x05,0x46,0x00,0x1e,0x00,0x0a,0x00,0x0f,0x64,0x00,0x0e,0x01,0x1b,0x00,
+0x15,0x01,0x8d,0x02,0x02,0x39,0x02,0x00,0x13,0x00,0x33,0xcf,0xff,0xf5,0x14,0x00,
+0x33,0xb9,0x29,0xfe,0x15,0x00,0x31,0x3f,0x10,0x02,0xb1,0x03,0x40,0xdf,0x80,0x0a,
+0x90,0x08,0x00,0xf3,0x1a,0x70,0x00,0xdf,0xff,0x77,0xf7,0x55,0x55,0x55,0x55,0x8f,
+0xd3,0x0f,0xff,0xfd,0xcc,0xdf,0xdc,0xcc,0xcc,0xcd,0xff,0xb0,0x8f,0xfe,0x10,0x00,
+0xaa,0x00,0x00,0x00,0x4d,0x40,0x00,0x46,0x10,0x00,0x01,0xf2,0x02,0x33,0x40,0x00,
+0x43,0x09,0xb1,0xcf,0xf9,0x55,0x00,0x44,0x0a,0xff,0xff,0x90,0x75,0x00,0x24,0xbf,
+0xf9,0x0a,0x00,0x20,0x01,0x22,0x06,0x00,0xf0,0x1e,0x18,0xdf,0xfd,0x92,0x00,0x02,
+0xef,0xfb,0xef,0xff,0x40,0x0d,0xff,0xfa,0x2e,0xff,0xe0,0x4f,0xff,0xfa,0x03,0xff,
 0xf5,0x9f,0xfa,0xfa,0x35,0x4f,0xfa,0xcf,0xc0,0x8a,0x3d,0x0b,0xfd,0xef,0xfb,0x03,
-0x11,0x8f,0xfe,0xff,0xff,0xb0,0x06,0x17,0x08,0xf0,0x0d,0x08,0xff,0xff,0xef,0xfd,
-0x11,0x10,0x9f,0xff,0xdf,0xd1,0x59,0x3b,0x0b,0xfd,0xaf,0xd6,0xfa,0x37,0x1d,0xfb,
-0x5f,0xff,0xfa,0x01,0xdf,0xf7,0x0d,0xac,0x09,0xc0,0xf1,0x03,0xef,0xfc,0xdf,0xff,
-0x50,0x00,0x18,0xdf,0xfe,0xa3,0xa8,0x0b,0x00,0x23,0x04,0x03,0xf9,0x0c,0x18,0xef,
-0x3c,0x04,0x04,0xc8,0x13,0x04,0x07,0x00,0xcf,0xf9,0x9f,0x99,0xf9,0x9f,0xf0,0x0f,
-0xf8,0x8f,0x88,0xf8,0x8f,0x07,0x00,0x12,0x03,0x31,0x00,0x08,0xa4,0x0b,0x13,0x80,
-0x1c,0x0c,0x14,0xa0,0x24,0x0c,0x14,0xb0,0x36,0x0c,0x01,0x12,0x00,0x22,0x7a,0x1d,
-0xa2,0x01,0x51,0x7f,0xfa,0x1d,0xff,0x70,0x20,0x00,0x22,0xfa,0x1d,0x08,0x00,0x02,
-0xa5,0x04,0x11,0x7f,0x79,0x13,0x0f,0x08,0x00,0x07,0x13,0x6f,0x08,0x00,0x13,0x0b,
-0x08,0x00,0x00,0xbc,0x04,0x12,0x70,0xde,0x05,0x03,0x68,0x09,0x2d,0xde,0xdb,0xa5,
-0x1e,0x12,0x1b,0xfe,0x01,0x10,0xe4,0x4c,0x0b,0x02,0x00,0x01,0x00,0x1d,0x0b,0x70,
-0xfa,0xef,0xfe,0xaf,0xff,0xff,0x01,0x7f,0x05,0x50,0x2e,0xe2,0x0a,0xff,0xff,0x63,
-0x1f,0x42,0xe2,0x02,0x20,0x2e,0xae,0x07,0x48,0xfe,0x20,0x02,0xef,0x0a,0x00,0x06,
-0x1e,0x00,0x06,0x32,0x00,0x06,0x46,0x00,0x07,0x5a,0x00,0x06,0x6e,0x00,0x11,0x07,
-0x06,0x00,0x10,0x7f,0x16,0x00,0x71,0x07,0xf8,0x0f,0x0b,0x40,0xff,0x7f,0x06,0x00,
-0x12,0xff,0x06,0x00,0x0f,0x01,0x00,0x22,0x02,0x34,0x05,0x12,0x4e,0x60,0x00,0x19,
-0x00,0xce,0x02,0x51,0x03,0xe0,0x00,0x00,0x10,0xea,0x09,0x31,0x10,0x00,0xbf,0x4b,
-0x01,0x50,0xf1,0x00,0xcf,0xf1,0x00,0xfb,0x21,0xa3,0x11,0xcf,0xff,0x77,0x77,0x77,
-0x77,0xbf,0xf1,0xcf,0x47,0x00,0x23,0x17,0xff,0xda,0x14,0x14,0x07,0x35,0x06,0x14,
-0x06,0x2c,0x06,0x3e,0x05,0xa0,0x00,0x01,0x00,0x05,0xb2,0x02,0x0b,0x01,0x00,0x04,
-0x1e,0x0e,0x17,0xf1,0x14,0x00,0x79,0xfa,0xf9,0x00,0xfe,0xf5,0x00,0xf5,0x68,0x03,
-0x07,0xfe,0x06,0x3e,0x05,0x00,0x03,0x16,0x00,0x2f,0xdc,0x00,0x01,0x00,0x15,0x1f,
-0xe1,0x1e,0x00,0x0a,0x03,0x88,0x00,0xb2,0xf6,0x00,0xfd,0x00,0x00,0xf1,0xfe,0xf6,
-0xfb,0x00,0xed,0x93,0x00,0x9b,0xff,0x00,0x00,0xfe,0xff,0xfa,0xfc,0x00,0x02,0x30,
-0x00,0x3f,0xfd,0x00,0xfd,0xdd,0x00,0x04,0x06,0xb4,0x06,0x03,0x41,0x08,0x0a,0xa4,
-0x15,0x16,0xfe,0x70,0x00,0x00,0x2a,0x00,0x10,0xf5,0x4a,0x00,0x1b,0xfb,0x24,0x0c,
-0x0c,0xfa,0x00,0x05,0x3c,0x00,0x11,0xfe,0x3f,0x00,0x26,0xfe,0xfd,0x30,0x00,0x75,
-0xde,0x00,0x00,0x00,0xe8,0x00,0xe6,0x24,0x00,0x53,0xfc,0xfd,0x00,0x00,0xfd,0x04,
-0x00,0x18,0x00,0x53,0x20,0x03,0x90,0x00,0x1f,0x02,0x6b,0x00,0x08,0x1f,0xfd,0x43,
-0x01,0x0d,0x16,0xec,0xd5,0x00,0x04,0x31,0x00,0x10,0xfd,0x07,0x00,0x29,0xfb,0xf8,
-0x8c,0x01,0x00,0x9c,0x24,0x67,0xe6,0xfd,0xe6,0xf4,0x00,0xdd,0xf7,0x00,0x25,0xf1,
-0xfa,0x0c,0x00,0x72,0xce,0x00,0x00,0x00,0xea,0x00,0xe9,0x61,0x01,0x30,0x00,0xfc,
-0x00,0xfb,0x02,0x00,0x37,0x1c,0x0d,0x65,0x01,0x01,0x6f,0x00,0x4f,0xfd,0xfe,0x00,
-0xfc,0x97,0x00,0x0b,0x10,0xfa,0x3e,0x00,0x1f,0xfa,0x7b,0x02,0x03,0xb1,0xe0,0xde,
-0x00,0x00,0xf1,0xfd,0xe5,0xfe,0x02,0x00,0x02,0x60,0x00,0xd3,0xeb,0xf5,0x00,0xf5,
-0xe6,0xf8,0xf7,0x00,0xf8,0xf6,0xfa,0xf6,0xf9,0x5e,0x01,0x66,0xe5,0xec,0x00,0x00,
-0xf7,0xfe,0x2b,0x01,0x81,0xfa,0xfb,0x00,0x00,0xfa,0xfc,0x00,0x00,0x3a,0x06,0x12,
-0x02,0x3e,0x01,0x22,0xee,0xf9,0xb4,0x02,0x13,0x02,0x24,0x00,0x22,0xfc,0xfc,0x6c,
-0x01,0x01,0x37,0x00,0x04,0xb8,0x00,0x14,0xed,0x45,0x01,0x1a,0x02,0x20,0x01,0x14,
-0xfc,0xcd,0x00,0xe0,0x03,0xfa,0xe3,0xed,0x00,0x00,0xed,0xfc,0xf4,0xfe,0x02,0xf4,
-0x02,0x02,0x92,0x00,0xe6,0xf8,0xf8,0xfd,0xfb,0xf8,0xfb,0xf9,0xfd,0xfb,0xfe,0x00,
-0xfd,0xfc,0x02,0xc5,0x00,0x2e,0x02,0xfd,0x68,0x01,0x08,0xf8,0x01,0x05,0x4d,0x02,
-0x1f,0xfe,0x14,0x01,0x03,0x0e,0x17,0x00,0x0e,0x1d,0x00,0x0f,0x57,0x01,0x0a,0x10,
-0xff,0x6e,0x02,0x0c,0xbd,0x02,0x0f,0x6c,0x00,0x27,0x1e,0x02,0xbd,0x03,0x19,0x02,
-0x71,0x02,0x10,0x02,0x7d,0x03,0x0f,0x01,0x00,0x24,0x0b,0x81,0x00,0x1f,0xf5,0x2c,
-0x00,0x0b,0x23,0xfd,0xfe,0xa2,0x01,0x1c,0xea,0x6c,0x02,0x30,0xfe,0x03,0x00,0x6e,
-0x22,0x2e,0x00,0x02,0x89,0x02,0x0a,0x94,0x02,0x0a,0x58,0x03,0x1c,0xeb,0x63,0x00,
-0x2d,0xfe,0x02,0x14,0x01,0x1f,0xf1,0xd8,0x00,0x24,0x1f,0xfb,0x24,0x00,0x10,0x1f,
-0xfe,0x19,0x00,0x1b,0x23,0x00,0x01,0xd5,0x02,0x11,0x03,0xcc,0x42,0x2e,0x04,0x05,
-0x99,0x25,0xf1,0x0b,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,
-0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,
-0xff,0x0d,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,
-0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x00,0x01,0x00,
-0x5e,0x02,0xce,0x00,0x20,0x03,0x02,0xc9,0x00,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,
-0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xd0,
-0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0xcb,0x1f,0x61,
-0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,
-0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x8f,0x00,0x1e,0x1f,0x24,
-0xc8,0x00,0x25,0x50,0x00,0x00,0x00,0x00,0x00,
+0x11,0x8f,0xfe,0xff,0xff,0xb0,0x06,0xc6,0x00,0xf0,0x22,0xd1,0x08,0xff,0xff,0xef,
+0xfd,0x11,0x10,0x9f,0xff,0xdf,0xd1,0x59,0x3b,0x0b,0xfd,0xaf,0xd6,0xfa,0x37,0x1d,
+0xfb,0x5f,0xff,0xfa,0x01,0xdf,0xf7,0x0d,0xff,0xfa,0x1d,0xff,0xf1,0x03,0xef,0xfc,
+0xdf,0xff,0x50,0x00,0x18,0xdf,0xfe,0xa3,0x00,0x00,0x00,0x7f,0x23,0x04,0x12,0xef,
+0x35,0x04,0x18,0xef,0x3c,0x04,0x03,0x53,0x04,0x14,0xf0,0x07,0x00,0xcf,0xf9,0x9f,
+0x99,0xf9,0x9f,0xf0,0x0f,0xf8,0x8f,0x88,0xf8,0x8f,0x07,0x00,0x12,0x03,0x31,0x00,
+0x02,0x3f,0x00,0x17,0x08,0x63,0x01,0x33,0x00,0x7f,0xa0,0x08,0x00,0x21,0xff,0xb0,
+0x08,0x00,0x12,0x0d,0xe5,0x04,0x32,0x00,0x7a,0x1d,0xa2,0x01,0x51,0x7f,0xfa,0x1d,
+0xff,0x70,0x20,0x00,0x22,0xfa,0x1d,0x08,0x00,0x01,0xa5,0x04,0x00,0x08,0x00,0x2f,
+0xff,0x70,0x08,0x00,0x08,0x13,0x6f,0x08,0x00,0x13,0x0b,0x08,0x00,0x23,0x00,0xdf,
+0x08,0x00,0x13,0x0e,0x08,0x00,0x5b,0x00,0xde,0xdb,0x60,0x00,0x01,0x00,0x12,0x1b,
+0xfe,0x01,0x53,0xe4,0x00,0x01,0xdf,0xff,0x00,0x01,0xa0,0x1d,0xff,0xff,0xfa,0xef,
+0xfe,0xaf,0xff,0xff,0x01,0x7f,0x05,0xf0,0x01,0x2e,0xe2,0x0a,0xff,0xff,0x1d,0xff,
+0xff,0xff,0xe2,0x02,0x20,0x2e,0xff,0xff,0xcf,0x23,0x00,0x38,0x20,0x02,0xef,0x0a,
+0x00,0x06,0x1e,0x00,0x06,0x32,0x00,0x06,0x46,0x00,0x07,0x5a,0x00,0x06,0x6e,0x00,
+0x11,0x07,0x06,0x00,0x10,0x7f,0x16,0x00,0x71,0x07,0xf8,0x0f,0x0b,0x40,0xff,0x7f,
+0x06,0x00,0x12,0xff,0x06,0x00,0x0f,0x01,0x00,0x22,0x02,0x34,0x05,0x12,0x4e,0x60,
+0x00,0x19,0x00,0xce,0x02,0x40,0x03,0xe0,0x00,0x00,0x79,0x02,0x51,0x02,0xef,0x10,
+0x00,0xbf,0x4b,0x01,0x40,0xf1,0x00,0xcf,0xf1,0xe5,0x02,0xb3,0xff,0x11,0xcf,0xff,
+0x77,0x77,0x77,0x77,0xbf,0xf1,0xcf,0x47,0x00,0x13,0x17,0x08,0x00,0x24,0xe0,0x07,
+0x35,0x06,0x14,0x06,0x2c,0x06,0x80,0x05,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -735,11 +754,18 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 1524, .range_length = 62127, .glyph_id_start = 143, .list_length = 63, .type = 3, .unicode_list = 1648, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[17838] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 2155, .size = 4079, .comp_size = 3398 },
+{ .bitmap_start = 4079, .comp_offset = 5553, .size = 3992, .comp_size = 3175 },
+{ .bitmap_start = 8071, .comp_offset = 8728, .size = 4095, .comp_size = 2295 },
+{ .bitmap_start = 12166, .comp_offset = 11023, .size = 1718, .comp_size = 832 },
+};
+
+static uint8_t etxUncompBuf[3954] __SDRAMFONTS;
 
 const etxLz4Font lv_font_he_bold_STD = {
-.uncomp_size = 17510,
-.comp_size = 11545,
+.uncomp_size = 3626,
+.comp_size = 2155,
 .line_height = 19,
 .base_line = 4,
 .subpx = 0,
@@ -752,12 +778,13 @@ const etxLz4Font lv_font_he_bold_STD = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 36,
-.glyph_bitmap = 1774,
-.class_pair_values = 15658,
-.left_class_mapping = 17098,
-.right_class_mapping = 17304,
+.class_pair_values = 1774,
+.left_class_mapping = 3214,
+.right_class_mapping = 3420,
+.block_num = 4,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 17838,
+.lvglFontBufSize = 3954,
 };
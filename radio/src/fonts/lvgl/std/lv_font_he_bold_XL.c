@@ -60,676 +60,747 @@ static const uint8_t lz4FontData[] ={
 0x68,0x00,0xc0,0x7d,0x47,0xa0,0x11,0x11,0x19,0x00,0xfa,0x52,0x48,0x80,0x13,0x98,
 0x00,0xf1,0x0c,0xfd,0x48,0xf0,0x14,0x13,0x19,0x01,0xfa,0xeb,0x49,0x70,0x12,0x10,
 0x13,0x00,0x00,0x83,0x4a,0xc0,0x19,0x19,0x13,0x00,0x00,0x71,0x4b,0x00,0x60,0x00,
-0xf0,0x00,0x39,0x4c,0x00,0x14,0x0e,0x0a,0x03,0x10,0x0f,0xff,0xfd,0x0e,0xff,0xfc,
-0x0d,0x03,0x00,0x20,0xfb,0x0c,0x03,0x00,0x20,0xfa,0x0b,0x03,0x00,0x20,0xf9,0x0a,
-0x03,0x00,0xb0,0xf8,0x09,0xff,0xf7,0x09,0xff,0xf7,0x08,0xff,0xf6,0x07,0x03,0x00,
-0x40,0xf5,0x03,0x99,0x93,0x0a,0x04,0xf0,0x0a,0x8a,0x70,0x0b,0xff,0xfa,0x0f,0xff,
-0xfe,0x0d,0xff,0xfc,0x03,0xcf,0xc2,0xff,0xf2,0x0e,0xff,0x3f,0xff,0x20,0xef,0xf3,
-0xff,0xf1,0x09,0x00,0xf0,0x0a,0x00,0xef,0xf1,0xff,0xe0,0x0e,0xff,0x0f,0xfd,0x00,
-0xef,0xe0,0xff,0xb0,0x0e,0xfd,0x0f,0xfa,0x00,0xef,0xb0,0x77,0x40,0x06,0x74,0x3a,
-0x00,0x50,0xaf,0xf2,0x00,0xcf,0xf1,0x09,0x00,0x50,0xdf,0xf0,0x00,0xff,0xd0,0x09,
-0x00,0xf2,0x14,0xff,0xc0,0x02,0xff,0xa0,0x00,0x00,0x00,0x03,0xff,0x90,0x05,0xff,
-0x70,0x00,0x00,0x00,0x06,0xff,0x60,0x08,0xff,0x40,0x00,0x00,0x00,0x0a,0xff,0x30,
-0x0c,0xff,0x10,0x00,0x0d,0xff,0x01,0x00,0x15,0xf7,0x09,0x00,0xf0,0x01,0x09,0xbb,
-0xcf,0xfe,0xbb,0xcf,0xfd,0xbb,0xb4,0x00,0x00,0x5f,0xf7,0x00,0x7f,0xf6,0x47,0x00,
-0x50,0x8f,0xf5,0x00,0xaf,0xf3,0x09,0x00,0x50,0xbf,0xf2,0x00,0xdf,0xf0,0x09,0x00,
-0x12,0xef,0x62,0x00,0x13,0xff,0x01,0x00,0x15,0x40,0x09,0x00,0xf0,0x09,0xaa,0xad,
-0xff,0xca,0xad,0xff,0xba,0xaa,0x20,0x00,0x09,0xff,0x40,0x0b,0xff,0x20,0x00,0x00,
-0x00,0x0c,0xff,0x10,0x0e,0xff,0x35,0x00,0x50,0x0f,0xfe,0x00,0x1f,0xfc,0x09,0x00,
-0x50,0x2f,0xfb,0x00,0x4f,0xf9,0x09,0x00,0x23,0x5f,0xf8,0x62,0x00,0x53,0x7f,0xf5,
-0x00,0x9f,0xf3,0x11,0x05,0x1f,0xff,0x08,0x00,0x02,0x40,0x04,0x8d,0xff,0x84,0xca,
-0x00,0x81,0xdf,0xff,0xff,0xff,0xd3,0x00,0x00,0x4f,0x6f,0x00,0xf0,0x0d,0x30,0x00,
-0xef,0xff,0xff,0xef,0xff,0xff,0xd0,0x06,0xff,0xff,0xa0,0x01,0xbf,0xff,0xf5,0x09,
-0xff,0xff,0x00,0x00,0x1f,0xff,0xfa,0x0a,0xff,0xfd,0x79,0x00,0x11,0xfc,0x10,0x00,
-0x50,0x04,0x77,0x76,0x05,0xff,0x08,0x01,0x00,0xb9,0x00,0x30,0xff,0xfe,0x71,0x08,
-0x00,0xf0,0x08,0x3f,0xff,0xff,0xff,0xa2,0x00,0x00,0x00,0x02,0xcf,0xff,0xff,0xff,
-0xa1,0x00,0x00,0x00,0x05,0xdf,0xff,0xff,0xfd,0x20,0x62,0x00,0x22,0xaf,0xff,0x3d,
-0x01,0xf1,0x08,0x01,0xcf,0xff,0xf6,0x24,0x44,0x40,0x00,0x00,0x1e,0xff,0xfb,0x8f,
-0xff,0xf0,0x00,0x00,0x0b,0xff,0xfd,0x6f,0xff,0xf4,0x58,0x00,0x60,0x1f,0xff,0xfd,
-0x10,0x00,0x5f,0x68,0x00,0x81,0xff,0xfb,0x9c,0xff,0xff,0xf4,0x01,0xef,0x90,0x00,
-0x30,0xa0,0x00,0x1c,0x07,0x00,0x00,0xdc,0x00,0x50,0x4a,0xdf,0xff,0xc8,0x20,0x47,
-0x00,0x4e,0x0d,0xfa,0x00,0x00,0x08,0x00,0x42,0x4b,0xef,0xea,0x30,0x10,0x00,0x52,
-0x07,0xff,0xff,0xff,0xf5,0x0b,0x00,0xf0,0x24,0x2f,0xff,0xc9,0xdf,0xfe,0x00,0x00,
-0x07,0x10,0x00,0x00,0x6f,0xfb,0x00,0x0d,0xff,0x40,0x00,0x8f,0xf2,0x00,0x00,0x8f,
-0xf7,0x00,0x0a,0xff,0x50,0x03,0xff,0xb0,0x00,0x00,0x7f,0xf8,0x00,0x0b,0xff,0x50,
-0x0d,0xfe,0x10,0x00,0x00,0x5f,0xfe,0x30,0x4f,0xff,0x20,0x8f,0x3a,0x00,0x00,0xbc,
-0x01,0x21,0xfb,0x03,0xe1,0x00,0x50,0x02,0xdf,0xff,0xff,0xb1,0x20,0x00,0x00,0x32,
-0x01,0x54,0x78,0x73,0x00,0x9f,0xf5,0x68,0x06,0x34,0x04,0xff,0xa0,0x0b,0x00,0x61,
-0x0e,0xfe,0x10,0x48,0x87,0x20,0x0b,0x00,0x32,0x9f,0xf5,0x2d,0xaf,0x00,0x00,0x20,
-0x00,0x00,0x5b,0x01,0xc0,0x80,0x00,0x00,0x00,0x1e,0xfe,0x15,0xff,0xe3,0x07,0xff,
-0xf0,0x53,0x02,0x71,0xf5,0x09,0xff,0x70,0x00,0xdf,0xf3,0x20,0x00,0x60,0x0a,0xff,
-0x50,0x00,0xcf,0xf3,0x20,0x00,0x40,0x10,0x09,0xff,0x60,0x0b,0x00,0x00,0x60,0x00,
-0xf2,0x02,0x07,0xff,0xb0,0x01,0xff,0xf1,0x00,0x00,0x19,0xa0,0x00,0x02,0xff,0xfc,
-0x9e,0xff,0xc0,0x65,0x00,0x53,0x7f,0xff,0xff,0xfe,0x20,0x7b,0x00,0xa1,0xbe,0xfe,
-0x91,0x00,0x00,0x00,0x18,0xcf,0xfe,0xa3,0x10,0x00,0x40,0x03,0xef,0xff,0xff,0x8e,
-0x02,0x00,0xaa,0x01,0x04,0xfd,0x00,0x61,0x9f,0xff,0xfb,0xae,0xff,0xfd,0xbd,0x02,
-0x52,0xff,0x70,0x01,0xef,0xff,0xac,0x01,0x31,0x20,0x00,0xbf,0x0a,0x00,0x62,0xcf,
-0xff,0x50,0x02,0xff,0xfb,0x57,0x00,0x41,0xd0,0x5e,0xff,0xf3,0xc6,0x00,0x52,0xff,
-0xfe,0xff,0xff,0x50,0xbb,0x00,0x01,0x13,0x02,0x02,0x0a,0x00,0x12,0xfd,0x74,0x00,
-0x11,0x8f,0x63,0x00,0xf0,0x17,0xaf,0xff,0x30,0x08,0xff,0xff,0xdf,0xff,0xf6,0x00,
-0xcf,0xff,0x20,0x3f,0xff,0xf6,0x0c,0xff,0xff,0x50,0xff,0xff,0x00,0xaf,0xff,0xd0,
-0x01,0xdf,0xff,0xf9,0xff,0xfd,0x00,0xdf,0xff,0xa0,0x00,0x2e,0xf7,0x02,0xe1,0x00,
-0xdf,0xff,0xd0,0x00,0x02,0xff,0xff,0xff,0xf1,0x00,0xaf,0xff,0xf7,0x40,0x00,0x10,
-0x70,0x65,0x02,0x83,0xda,0xad,0xff,0xff,0xff,0xc0,0x00,0x09,0xe0,0x02,0x12,0xf9,
-0x5a,0x00,0xf0,0x08,0xff,0xec,0xff,0xff,0x60,0x00,0x02,0x8c,0xef,0xfd,0xa5,0x00,
-0xdf,0xff,0xf3,0x0f,0xff,0x40,0xff,0xf4,0x0f,0xff,0x40,0x0a,0x00,0xa1,0x20,0xff,
-0xf0,0x0f,0xff,0x00,0xff,0xe0,0x08,0x86,0xeb,0x00,0x10,0xa0,0xb4,0x00,0x10,0xf3,
-0xe6,0x01,0x40,0xf6,0x00,0x00,0x4f,0x5f,0x01,0x20,0xef,0xfa,0xd4,0x02,0x10,0xf1,
-0xfd,0x00,0x10,0x80,0xd0,0x00,0x80,0x10,0x00,0x00,0xdf,0xfc,0x00,0x00,0x02,0x76,
-0x00,0x10,0x06,0x5f,0x02,0x10,0x0a,0x1d,0x00,0x10,0x0d,0x7f,0x01,0x10,0x0e,0x89,
-0x02,0x3d,0x0f,0xff,0xc0,0x05,0x00,0x01,0x19,0x00,0x01,0x23,0x00,0x01,0x2d,0x00,
-0x01,0x37,0x00,0x30,0x03,0xff,0xf7,0x34,0x01,0x10,0xfb,0xfd,0x00,0x00,0x55,0x00,
-0x10,0x1f,0x63,0x01,0x80,0x09,0xff,0xe0,0x00,0x00,0x01,0xef,0xf9,0x6c,0x03,0x20,
-0xff,0x60,0x79,0x00,0x10,0xf5,0x20,0x00,0x10,0xf4,0x2c,0x01,0x12,0xc0,0x5f,0x03,
-0x10,0x60,0x9a,0x03,0x11,0xfa,0x13,0x03,0x10,0xb0,0x42,0x01,0x11,0xf9,0x66,0x01,
-0x40,0x30,0x00,0x00,0x0d,0x65,0x00,0x30,0x05,0xff,0xf6,0x56,0x00,0x11,0xfd,0xa3,
-0x01,0x13,0x30,0xc3,0x00,0x12,0x1f,0x84,0x00,0x10,0xf0,0x0b,0x03,0x10,0xf3,0x84,
-0x00,0x10,0xf5,0x6a,0x00,0x10,0xf6,0x5f,0x00,0x13,0xf8,0x05,0x00,0x30,0x09,0xff,
-0xf7,0x19,0x00,0x10,0xf6,0x36,0x03,0x10,0xf4,0x4c,0x00,0x10,0xf1,0xbb,0x00,0x10,
-0xe0,0x41,0x00,0x40,0x90,0x00,0x00,0x8f,0x84,0x04,0x20,0xdf,0xfd,0x6f,0x00,0x10,
-0xf7,0x45,0x00,0x10,0xe0,0x9f,0x00,0x50,0x40,0x00,0x03,0xff,0xfa,0x05,0x03,0x22,
-0xc0,0x00,0x28,0x04,0x26,0x0a,0x70,0x27,0x09,0x10,0x01,0x24,0x00,0x00,0xaa,0x00,
-0x03,0xe0,0x01,0x01,0x67,0x02,0xf0,0x09,0x51,0x00,0x0e,0xfc,0x00,0x01,0x20,0x0f,
-0xfb,0x40,0xdf,0xb0,0x4a,0xfa,0x05,0xff,0xff,0xee,0xfd,0xdf,0xff,0xf0,0x28,0xdf,
-0xa2,0x01,0x70,0xea,0x10,0x00,0x16,0xef,0xff,0xc7,0x83,0x02,0x12,0x6f,0x15,0x02,
-0x50,0x3f,0xfe,0x9f,0xfa,0x00,0xce,0x03,0x21,0x50,0xdf,0x75,0x00,0x20,0xb0,0x04,
-0x9a,0x00,0x50,0x3d,0xf1,0x00,0x09,0xfa,0xaa,0x01,0x31,0x00,0x00,0x15,0x5a,0x00,
-0x33,0x25,0x55,0x40,0x98,0x03,0x14,0xfd,0xca,0x02,0x1f,0xd0,0x11,0x00,0x11,0x14,
-0x01,0x42,0x05,0x13,0x1f,0x09,0x00,0x1c,0x71,0x11,0x00,0x1f,0x70,0x55,0x00,0x1f,
-0x00,0x0f,0x03,0x04,0x03,0x00,0x50,0xfe,0x00,0xef,0xfc,0x02,0x30,0x06,0xf0,0x00,
-0xf2,0x1f,0xff,0x80,0x2b,0xfb,0x00,0x00,0x30,0x00,0x29,0x99,0x99,0x99,0x94,0x0b,
-0x05,0x16,0xf8,0x05,0x00,0xa0,0x00,0x8b,0x81,0x00,0xbf,0xff,0xb0,0x0f,0xff,0xff,
-0xd4,0x02,0x32,0x02,0xcf,0xc3,0x38,0x01,0x01,0x2b,0x03,0x31,0x05,0xff,0xf0,0x29,
-0x06,0x1d,0xfa,0x13,0x00,0x22,0xbf,0xfa,0x90,0x03,0x11,0x40,0x25,0x06,0x02,0x13,
-0x00,0x18,0xf9,0x13,0x00,0x11,0xe0,0x88,0x03,0x07,0x13,0x00,0x18,0x07,0x13,0x00,
-0x36,0x2f,0xff,0x30,0x13,0x00,0x28,0xdf,0xf8,0x13,0x00,0x18,0xd0,0x13,0x00,0x11,
-0x20,0xd1,0x05,0x02,0x13,0x00,0x11,0xf7,0x7f,0x02,0x22,0x88,0x10,0xef,0x00,0x62,
-0x39,0xdf,0xfe,0xa5,0x00,0x00,0x69,0x03,0x40,0xd1,0x00,0x00,0xaf,0x08,0x00,0x40,
-0xfe,0x10,0x04,0xff,0x18,0x04,0x50,0xff,0xa0,0x0c,0xff,0xfe,0x0c,0x04,0x40,0xf1,
-0x1f,0xff,0xf7,0x80,0x00,0x40,0xf6,0x4f,0xff,0xf2,0x55,0x02,0x22,0xfa,0x6f,0x98,
-0x05,0x22,0xfc,0x7f,0x0c,0x03,0x2f,0xfd,0x8f,0x08,0x00,0x0c,0x04,0x28,0x00,0x04,
-0x38,0x00,0x03,0x48,0x00,0x14,0xf9,0x58,0x00,0x10,0x0b,0x68,0x00,0x80,0xaf,0xff,
-0xf1,0x04,0xff,0xff,0xfa,0xad,0xd0,0x05,0x12,0x9f,0x88,0x00,0x02,0x98,0x00,0x12,
-0xd2,0xa8,0x00,0x11,0xb6,0xb1,0x00,0xe0,0x02,0x7d,0x80,0x00,0x01,0x6c,0xff,0xf8,
-0x01,0x6b,0xff,0xff,0xff,0x85,0x1f,0x00,0x20,0xf8,0x6f,0x06,0x00,0x91,0x86,0xff,
-0xea,0x5f,0xff,0xf8,0x48,0x30,0x00,0x4d,0x05,0x10,0x0f,0x0d,0x03,0x0f,0x0b,0x00,
-0x3a,0x53,0x4a,0xdf,0xfe,0xb7,0x10,0xb9,0x06,0x52,0xfe,0x50,0x00,0x02,0xef,0x79,
-0x07,0x80,0x00,0xdf,0xff,0xfe,0xab,0xef,0xff,0xfd,0x96,0x06,0x80,0x00,0x01,0xdf,
-0xff,0xf3,0x0a,0xff,0xfe,0xde,0x01,0x50,0xff,0x50,0xdf,0xff,0xb0,0x7b,0x01,0x41,
-0xf5,0x02,0x33,0x31,0x22,0x05,0x02,0x78,0x06,0x13,0xbf,0x70,0x02,0x33,0x5f,0xff,
-0xf7,0x7c,0x06,0x11,0xfc,0x08,0x00,0x13,0x2e,0xb7,0x05,0x13,0x2e,0x29,0x00,0x10,
-0x2e,0x5c,0x00,0x0f,0x08,0x00,0x10,0x93,0x1e,0xff,0xff,0xd9,0x99,0x99,0x99,0x99,
-0x17,0xed,0x02,0x23,0xf2,0x7f,0x09,0x00,0x14,0x27,0x11,0x00,0x41,0x00,0x01,0x7b,
-0xef,0x3c,0x01,0x01,0x27,0x01,0x32,0xe5,0x00,0x08,0x18,0x00,0xc0,0x50,0x2f,0xff,
-0xff,0xda,0xae,0xff,0xff,0xe0,0x8f,0xff,0xf6,0xf8,0x01,0x40,0xf4,0x7b,0xbb,0x90,
-0x8f,0x00,0x22,0xf6,0x00,0xa8,0x07,0x00,0xac,0x04,0x00,0x18,0x00,0x61,0xe1,0x00,
-0x00,0x06,0x77,0x9d,0xf3,0x05,0x00,0xf1,0x06,0x13,0xd4,0xf9,0x06,0x13,0x91,0x08,
-0x00,0x11,0xfe,0xae,0x00,0x23,0x26,0xef,0x28,0x04,0x12,0x3f,0xd7,0x00,0x00,0x24,
-0x02,0x31,0x77,0x77,0x40,0xb4,0x07,0x30,0xef,0xff,0xb0,0xb6,0x04,0x10,0xfa,0xe0,
-0x05,0x00,0xe5,0x05,0x12,0x4f,0x78,0x00,0x23,0xe1,0x08,0xbb,0x08,0x00,0xb3,0x06,
-0x01,0x49,0x06,0x20,0x01,0x7c,0xd8,0x05,0x02,0x77,0x04,0x04,0x50,0x00,0x23,0x0a,
-0xff,0x09,0x00,0x13,0x5f,0x09,0x00,0x00,0xf2,0x07,0x13,0xe0,0x1a,0x00,0x02,0x09,
-0x00,0x13,0x4f,0x09,0x00,0x61,0x01,0xef,0xfe,0xaf,0xff,0xe0,0x1a,0x00,0x41,0xf4,
-0x9f,0xff,0xe0,0x1a,0x00,0x22,0xa0,0x9f,0x89,0x05,0x20,0xfe,0x10,0x09,0x00,0x00,
-0x1a,0x00,0x22,0x00,0x9f,0x0e,0x05,0x11,0xa0,0x09,0x00,0x00,0x1a,0x00,0x01,0x09,
-0x00,0xa4,0x0a,0xff,0xfc,0x99,0x99,0xdf,0xff,0xf9,0x94,0x1f,0x3e,0x04,0x1d,0x0f,
-0x09,0x00,0x02,0xba,0x07,0x03,0x90,0x00,0x0f,0x09,0x00,0x0e,0x11,0x8f,0x35,0x00,
-0x34,0xf4,0x00,0x0a,0xe7,0x00,0x13,0xcf,0x11,0x00,0x70,0x0e,0xff,0xfc,0xbb,0xbb,
-0xbb,0xbb,0xa9,0x02,0x13,0x10,0x03,0x02,0x13,0xf0,0x46,0x07,0x03,0x83,0x04,0x60,
-0x6f,0xff,0xc7,0xce,0xfd,0xa3,0xb2,0x03,0x03,0xfc,0x06,0x12,0xaf,0x09,0x00,0x00,
-0x0e,0x03,0x30,0x96,0x6a,0xff,0x3c,0x03,0x73,0x47,0x10,0x00,0x06,0xff,0xff,0x90,
-0x6c,0x01,0x14,0xfd,0x78,0x00,0x13,0xf0,0xbb,0x09,0x50,0xff,0x02,0x88,0x88,0x10,
-0x38,0x00,0x50,0xe0,0x3f,0xff,0xf6,0x00,0x73,0x00,0x40,0x00,0xef,0xff,0xe2,0x19,
-0x00,0xb3,0x70,0x07,0xff,0xff,0xfb,0x9d,0xff,0xff,0xe1,0x00,0x0b,0x90,0x00,0x02,
-0x67,0x00,0x30,0xe4,0x00,0x00,0x59,0x07,0x22,0xeb,0x61,0x2b,0x08,0x21,0x8c,0xef,
-0xa7,0x06,0x22,0x3c,0xff,0x9f,0x02,0x11,0x7f,0x8e,0x07,0x01,0xd5,0x00,0x21,0xfd,
-0xb8,0x8e,0x01,0x22,0xfd,0x50,0x0d,0x08,0x02,0x5e,0x09,0x61,0x06,0xff,0xfd,0x03,
-0x78,0x85,0x32,0x08,0x11,0x8b,0x1f,0x03,0x03,0x47,0x01,0x23,0x60,0x04,0x3d,0x01,
-0xd0,0x20,0x5f,0xff,0xff,0x92,0x03,0xcf,0xff,0xf9,0x06,0xff,0xff,0x70,0xb4,0x05,
-0x41,0xe0,0x7f,0xff,0xf1,0x7b,0x00,0x11,0x16,0x07,0x01,0x61,0x5f,0xff,0xf3,0x5f,
-0xff,0xf3,0x28,0x03,0x11,0x33,0x6c,0x02,0x60,0x7f,0xff,0xf1,0x0f,0xff,0xfb,0x41,
-0x02,0x50,0xfe,0x00,0x9f,0xff,0xf5,0xaf,0x09,0x60,0x80,0x02,0xff,0xff,0xfc,0x9c,
-0xbb,0x00,0x23,0x05,0xff,0xc1,0x08,0x23,0x04,0xef,0xbb,0x00,0x74,0x00,0x7b,0xef,
-0xec,0x60,0x00,0x00,0xac,0x01,0x1e,0xf0,0x09,0x00,0x20,0x09,0x99,0x01,0x00,0x12,
-0xef,0x34,0x01,0x00,0x73,0x08,0x13,0x20,0x61,0x02,0x14,0xfa,0x05,0x0a,0x14,0xf3,
-0x46,0x01,0x13,0xc0,0xfb,0x06,0x23,0xff,0x40,0x4f,0x01,0x02,0x60,0x01,0x00,0xa9,
-0x04,0x04,0xe6,0x08,0x03,0xea,0x01,0x02,0xb9,0x09,0x01,0x4d,0x0a,0x22,0x10,0x00,
-0x11,0x01,0x14,0xf9,0xc4,0x01,0x23,0xf2,0x00,0xfa,0x0a,0x13,0xb0,0x23,0x01,0x03,
-0x02,0x04,0x13,0x0d,0xf2,0x03,0x24,0x00,0x5f,0x80,0x0a,0x34,0xdf,0xff,0xe0,0x47,
-0x09,0x03,0x7b,0x07,0x12,0x5a,0x6d,0x04,0x12,0x2d,0xe7,0x00,0x03,0xe6,0x0a,0x70,
-0x50,0x09,0xff,0xff,0xfb,0xad,0xff,0x89,0x0c,0x00,0x2e,0x05,0x00,0xf6,0x08,0x10,
-0xf9,0x72,0x03,0x22,0xf5,0x0e,0x08,0x00,0x22,0xf4,0x09,0xae,0x05,0x31,0xe0,0x01,
-0xef,0x28,0x00,0x32,0x50,0x00,0x2c,0xf2,0x03,0x02,0xe2,0x01,0x23,0xb1,0x00,0x83,
-0x02,0xc0,0x30,0x0a,0xff,0xff,0x71,0x14,0xdf,0xff,0xe0,0x2f,0xff,0xf7,0xf8,0x00,
-0x40,0xf7,0x5f,0xff,0xf1,0x69,0x01,0x27,0xfb,0x7f,0x6e,0x0b,0x00,0x34,0x02,0x10,
-0x3f,0x6e,0x0b,0x42,0x8f,0xff,0xf9,0x0d,0x78,0x00,0x22,0xf2,0x03,0x4b,0x01,0x33,
-0x80,0x00,0x3d,0x10,0x03,0x00,0xa8,0x00,0x21,0xc7,0x10,0x9e,0x05,0x23,0xfd,0x92,
-0x94,0x03,0x00,0xc3,0x00,0x15,0xcf,0xaf,0x02,0x50,0xea,0xaf,0xff,0xff,0x40,0xb6,
-0x0b,0x41,0x01,0xdf,0xff,0xd0,0x58,0x00,0x31,0x4f,0xff,0xf2,0x16,0x06,0x31,0x0f,
-0xff,0xf7,0xaf,0x03,0x31,0x0d,0xff,0xf8,0xb8,0x02,0x01,0x56,0x06,0x11,0xf6,0xf6,
-0x0b,0x94,0x1f,0xff,0xff,0x61,0x04,0xdf,0xff,0xfa,0x09,0xfd,0x09,0x02,0xb8,0x00,
-0x10,0xf8,0xc8,0x00,0x11,0xfc,0xd1,0x02,0x31,0x04,0x55,0x20,0x43,0x06,0x05,0x51,
-0x05,0x00,0x5f,0x01,0x10,0x60,0xd8,0x01,0x10,0xaf,0xad,0x01,0x31,0x03,0xcc,0xef,
-0x26,0x03,0x13,0x04,0xa1,0x04,0x13,0x04,0x76,0x0c,0x41,0x04,0xff,0xdb,0x72,0x7d,
-0x0c,0x10,0xc2,0xa4,0x07,0x30,0x0f,0xff,0xff,0xb2,0x07,0x4f,0x01,0x8b,0x81,0x00,
-0x01,0x00,0x06,0x27,0x8b,0x80,0xd5,0x07,0x10,0x03,0xd5,0x07,0xff,0x02,0x5d,0xfa,
-0x00,0x1f,0xff,0xf9,0x04,0xff,0xff,0xb0,0x1e,0xff,0xf7,0x00,0x29,0xb6,0x00,0x01,
-0x00,0x09,0xf0,0x05,0x05,0xcc,0xc4,0x00,0x7f,0xff,0x50,0x07,0xff,0xf5,0x00,0x7f,
-0xff,0x40,0x08,0xff,0xf2,0x00,0xbf,0xfe,0x81,0x0a,0x9b,0x09,0xff,0xe1,0x00,0xbf,
-0xf5,0x00,0x00,0x45,0x30,0x00,0x21,0x04,0xa4,0x07,0x00,0x11,0x6d,0x7a,0x02,0x11,
-0x29,0x9e,0x03,0x20,0x05,0xcf,0x3e,0x04,0x20,0x01,0x7e,0xcb,0x00,0x20,0x91,0x1a,
-0x08,0x01,0x11,0xa4,0x31,0x0b,0x11,0xb5,0xb4,0x02,0x22,0xfd,0x30,0xcd,0x02,0x10,
-0xff,0x87,0x01,0x10,0x08,0x28,0x02,0x50,0xc6,0x10,0x00,0x00,0x5c,0x27,0x00,0x62,
-0xb2,0x00,0x00,0x03,0x9f,0xff,0xc5,0x02,0x23,0x17,0xdf,0xd0,0x05,0x13,0x4b,0xd4,
-0x02,0x41,0x02,0x83,0x8a,0xaa,0x01,0x00,0x12,0x0e,0x64,0x01,0x22,0xf1,0xef,0x08,
-0x00,0x13,0x1e,0x0f,0x00,0x0f,0xcf,0x00,0x03,0x12,0x08,0x34,0x00,0x1b,0xa0,0x2d,
-0x00,0x03,0x0f,0x00,0x33,0x10,0x1b,0x50,0x5c,0x03,0x22,0xe8,0x10,0x52,0x03,0x23,
-0xff,0xa4,0x9e,0x00,0x10,0xfd,0x04,0x0b,0x10,0xdf,0xcc,0x01,0x40,0x30,0x00,0x00,
-0x38,0x30,0x00,0x10,0xc3,0x36,0x02,0x12,0xef,0xf1,0x02,0x21,0x01,0xaf,0x4d,0x02,
-0x11,0x5b,0x3d,0x02,0x20,0x5a,0xff,0xad,0x01,0x01,0xfb,0x01,0x30,0xe7,0x10,0x02,
-0x63,0x0d,0x11,0x50,0x4b,0x00,0x11,0x92,0x4b,0x00,0x11,0xd6,0x62,0x00,0x24,0x1a,
-0x30,0x92,0x00,0x11,0x6b,0x33,0x06,0x01,0x07,0x04,0x22,0xfc,0x10,0xa0,0x02,0xc0,
-0xfc,0x00,0xbf,0xff,0xfe,0xbb,0xff,0xff,0xf5,0x1f,0xff,0xfc,0xfa,0x01,0x40,0xa3,
-0xff,0xff,0x50,0x75,0x03,0x20,0x01,0x11,0xf3,0x0b,0x02,0x8e,0x03,0x01,0x45,0x02,
-0x00,0x45,0x07,0x17,0xfd,0x74,0x07,0x03,0x07,0x00,0x12,0x0c,0x8a,0x07,0x13,0x03,
-0xb0,0x03,0x12,0x7f,0xc1,0x0d,0x13,0x08,0x00,0x06,0x29,0x01,0x11,0x12,0x01,0x29,
-0x07,0xa7,0x46,0x04,0x38,0xff,0xff,0xf0,0x92,0x05,0x23,0x3c,0xfc,0x8b,0x0d,0x63,
-0x03,0x8b,0xef,0xfe,0xc9,0x50,0x34,0x00,0x21,0x4d,0xff,0xdd,0x00,0x22,0x00,0x00,
-0xfb,0x00,0x51,0xfd,0xa8,0x8a,0xcf,0xff,0x29,0x00,0x21,0x01,0xdf,0xe6,0x00,0x21,
-0x16,0xef,0x81,0x00,0x23,0xdf,0xfd,0x32,0x08,0x10,0xfc,0x88,0x07,0x13,0xfd,0xb0,
-0x09,0x20,0xbf,0xf7,0x43,0x03,0x03,0x57,0x00,0x00,0x01,0x0e,0x10,0x0d,0xf8,0x02,
-0x60,0x2a,0xef,0xeb,0x50,0x00,0x08,0x6f,0x05,0x12,0xe0,0xe8,0x07,0x10,0xc1,0xed,
-0x0f,0x20,0xaf,0xf7,0x0d,0x00,0xf0,0x0f,0xeb,0xdf,0xff,0x20,0x00,0xdf,0xf0,0x0f,
-0xff,0x20,0x00,0x1f,0xff,0x90,0x01,0xff,0xf0,0x00,0x0a,0xff,0x23,0xff,0xd0,0x00,
-0x0a,0xff,0xc0,0x00,0x3f,0xff,0x96,0x0c,0x70,0x6f,0xfa,0x00,0x01,0xff,0xf5,0x00,
-0x3d,0x00,0xc0,0x07,0xff,0x58,0xff,0x80,0x00,0x6f,0xff,0x00,0x00,0x5f,0xfc,0x1f,
-0x10,0x60,0x9f,0xf7,0x00,0x09,0xff,0xd0,0x6d,0x0e,0x40,0x00,0x07,0xff,0x4a,0x7e,
-0x0e,0xf0,0x07,0xfa,0x00,0x00,0x8f,0xfa,0x00,0x00,0x9f,0xf2,0xaf,0xf7,0x00,0x0d,
-0xff,0x90,0x00,0x09,0xff,0x80,0x00,0x0b,0xff,0xaf,0x0e,0x22,0xef,0xf9,0x9f,0x00,
-0xf0,0x12,0xff,0xc0,0x7f,0xfa,0x00,0x0c,0xff,0xc0,0x00,0x2f,0xff,0x60,0x00,0x6f,
-0xf7,0x04,0xff,0xd0,0x00,0x9f,0xff,0x40,0x1d,0xff,0xf9,0x00,0x2e,0xfe,0x10,0x1f,
-0xff,0x20,0x02,0x1b,0x0e,0x30,0xff,0xf9,0x9e,0x4e,0x00,0x01,0xd4,0x03,0x21,0xfe,
-0x2c,0xfa,0x01,0xb1,0x06,0xff,0xf2,0x00,0x06,0xdf,0xe9,0x10,0x08,0xef,0xea,0x07,
-0x0d,0x17,0xc1,0x68,0x01,0x37,0x3f,0xff,0xd2,0x0e,0x00,0x11,0x6f,0x48,0x02,0x34,
-0x01,0x52,0x00,0x1b,0x08,0x34,0xfd,0xbb,0xde,0x3b,0x05,0x14,0x1a,0x35,0x07,0x02,
-0x22,0x01,0x55,0x6a,0xde,0xff,0xec,0x83,0x39,0x00,0x16,0x9f,0xda,0x02,0x11,0xff,
-0xe0,0x09,0x03,0x3b,0x04,0x13,0xfe,0x0b,0x00,0x13,0x0c,0x30,0x03,0x02,0xbe,0x02,
-0x26,0xff,0xa0,0xd5,0x0e,0x14,0xf1,0xce,0x05,0x34,0x7e,0xff,0xf6,0xad,0x05,0x12,
-0x19,0xe7,0x01,0x00,0xd1,0x0a,0x04,0xe0,0x09,0x00,0xd1,0x0a,0x03,0x64,0x06,0x00,
-0xe1,0x06,0x03,0x92,0x07,0x11,0xdf,0x6b,0x01,0x12,0xf5,0x56,0x02,0x11,0x60,0x8f,
-0x07,0x01,0x73,0x0b,0x01,0xe0,0x0a,0x16,0x20,0xb7,0x06,0x13,0x80,0xa5,0x09,0x02,
-0xd2,0x08,0x13,0xcf,0x0b,0x00,0x10,0xf4,0x43,0x03,0x70,0xec,0xcc,0xcc,0xcc,0xcf,
-0xff,0xfb,0x2f,0x01,0x11,0x60,0x7b,0x09,0x00,0xde,0x11,0x13,0xff,0x7c,0x06,0x10,
-0x70,0x7d,0x0a,0x02,0xb3,0x06,0x43,0xd0,0xbf,0xff,0xf4,0x18,0x05,0x11,0xf3,0x44,
-0x0b,0x24,0xca,0x50,0x5f,0x00,0x13,0xe4,0x38,0x12,0x00,0x34,0x0f,0x30,0xfe,0xbb,
-0xbc,0x49,0x09,0x10,0xff,0x0f,0x03,0x61,0x3e,0xff,0xff,0x3f,0xff,0xfb,0xb2,0x00,
-0x10,0xf6,0x11,0x00,0x00,0x5f,0x07,0x22,0x5f,0xff,0xd1,0x0e,0x10,0xf2,0x11,0x00,
-0x20,0x02,0x7f,0x1a,0x13,0x03,0x5d,0x03,0x02,0x08,0x00,0x14,0xfa,0x55,0x00,0xd1,
-0xfe,0x20,0xff,0xff,0xc5,0x55,0x56,0x9f,0xff,0xfe,0x1f,0xff,0xfb,0x74,0x09,0x10,
-0xf9,0x44,0x00,0x00,0x2a,0x01,0x32,0xdf,0xff,0xfb,0x4f,0x03,0x02,0x11,0x00,0x12,
-0xff,0x11,0x00,0xd3,0x01,0xbf,0xff,0xfa,0xff,0xff,0xeb,0xbb,0xbc,0xff,0xff,0xff,
-0x4f,0x91,0x00,0x14,0xa0,0x00,0x01,0x11,0x0f,0x53,0x00,0x11,0xb8,0x0d,0x03,0x43,
-0x7b,0xef,0xfd,0xa6,0xce,0x08,0x11,0xff,0xf5,0x00,0x12,0x0b,0x25,0x00,0x11,0x90,
-0x67,0x06,0x10,0xdd,0x33,0x02,0x10,0x04,0xde,0x06,0x00,0x33,0x01,0x21,0x10,0xcf,
-0xbe,0x07,0x10,0x6f,0xf5,0x0d,0x12,0xfa,0xde,0x01,0x12,0xb5,0x29,0x01,0x44,0x08,
-0xaa,0xa8,0x8f,0xda,0x07,0x14,0x09,0xf5,0x07,0x00,0x6b,0x0c,0x14,0x00,0x60,0x0a,
-0x14,0x10,0x1b,0x02,0x24,0xf2,0x00,0x3e,0x09,0x19,0x30,0xa1,0x07,0x32,0x78,0x88,
-0x62,0x0b,0x02,0x10,0x0f,0x4b,0x14,0x24,0xff,0x20,0x73,0x01,0x42,0xfe,0x40,0x00,
-0x06,0xb9,0x10,0x30,0xff,0xec,0xdf,0x4f,0x02,0x23,0x01,0xcf,0x1c,0x01,0x00,0x4e,
-0x00,0x04,0x32,0x0a,0x52,0x28,0xce,0xff,0xdb,0x61,0xb3,0x13,0x34,0xeb,0x71,0x00,
-0xbc,0x13,0x13,0x91,0x09,0x00,0x00,0x6c,0x04,0x50,0xff,0xff,0xeb,0xbc,0xef,0xd7,
-0x08,0x00,0x28,0x01,0x10,0x03,0xe5,0x01,0x01,0x31,0x01,0x11,0x0b,0xe0,0x13,0x11,
-0xb0,0x41,0x05,0x12,0xb0,0x43,0x01,0x32,0xbf,0xff,0xf0,0x09,0x00,0x10,0x8f,0xdd,
-0x01,0x11,0xb0,0xf2,0x00,0x12,0xf5,0x09,0x00,0x3b,0x5f,0xff,0xf6,0x09,0x00,0x05,
-0x1b,0x00,0x34,0x8f,0xff,0xf4,0x3f,0x00,0x14,0xf1,0x51,0x00,0x11,0xc0,0x09,0x00,
-0x02,0x98,0x11,0x01,0x75,0x00,0x14,0xfc,0x87,0x00,0x18,0xe2,0x99,0x00,0x12,0xff,
-0xa6,0x13,0x01,0xbd,0x00,0x00,0x3a,0x07,0x04,0x41,0x02,0x0e,0x08,0x00,0x10,0xeb,
-0xd4,0x0a,0x23,0xb2,0xff,0xed,0x08,0x0f,0x08,0x00,0x07,0x53,0xea,0xaa,0xaa,0xaa,
-0xa7,0x48,0x00,0x1e,0xfb,0x08,0x00,0x0f,0x40,0x00,0x0e,0x0c,0x08,0x00,0x01,0x78,
-0x00,0x1e,0xb3,0x98,0x00,0x09,0x08,0x00,0x12,0xdf,0x07,0x00,0x15,0xfd,0x0f,0x00,
-0x10,0xfe,0x36,0x00,0x13,0xb9,0x46,0x00,0x01,0x68,0x0a,0x06,0x55,0x00,0x0d,0x0f,
-0x00,0x01,0x01,0x00,0x13,0xb0,0xa3,0x00,0x06,0x0f,0x00,0x00,0x7a,0x00,0x1e,0xb8,
-0x3c,0x00,0x0f,0x0f,0x00,0x1f,0x11,0x00,0xa2,0x0d,0x13,0xc8,0x6e,0x06,0x00,0x65,
-0x00,0x24,0x20,0x00,0x37,0x0c,0x11,0xe2,0x4b,0x02,0x20,0xfc,0xce,0x61,0x13,0x10,
-0x03,0x52,0x02,0x00,0x3e,0x06,0x21,0x50,0x0a,0x38,0x07,0x00,0x18,0x02,0x11,0x0f,
-0xbb,0x04,0x00,0xe9,0x0b,0x15,0x4f,0xd0,0x04,0x13,0x6f,0x58,0x0a,0x00,0x4e,0x00,
-0x13,0xf4,0x0a,0x00,0x01,0x04,0x03,0x10,0xef,0x08,0x0b,0x06,0x0a,0x00,0x01,0x1e,
-0x00,0x01,0x0a,0x00,0x01,0x79,0x09,0x82,0x56,0x66,0xcf,0xff,0xf0,0x3f,0xff,0xf9,
-0x50,0x00,0x15,0xf0,0x5a,0x00,0x21,0xf0,0x0a,0xe6,0x0a,0x00,0x0a,0x00,0x50,0x02,
-0xff,0xff,0xf9,0x10,0x6e,0x07,0x10,0xf0,0xa9,0x00,0x10,0xfd,0x2f,0x02,0x14,0xf0,
-0xa4,0x13,0x00,0x6e,0x03,0x11,0x6e,0x09,0x00,0x10,0xb3,0x38,0x00,0x53,0x6a,0xdf,
+0x98,0x39,0x4c,0x00,0x14,0x0e,0x0a,0x03,0x10,0x00,0x01,0x00,0x2f,0xf1,0x00,0x01,
+0x00,0x02,0x13,0xf7,0x08,0x00,0x17,0xe2,0x14,0x00,0xbe,0xf4,0xf1,0x00,0xfb,0xe9,
+0x00,0xe9,0x00,0x00,0x00,0x03,0x31,0x00,0x4d,0x05,0x0a,0x00,0x06,0x15,0x00,0x2f,
+0xb9,0x00,0x01,0x00,0x14,0x1f,0xc2,0x1d,0x00,0x09,0x03,0x84,0x00,0xb2,0xec,0x00,
+0xfb,0x00,0x00,0xe2,0xfc,0xed,0xf6,0x00,0xdb,0x8f,0x00,0x7c,0xfd,0x00,0x00,0xfc,
+0xfd,0xf4,0xf8,0x8e,0x00,0x7e,0xf9,0x00,0xfa,0x00,0x00,0xf2,0x00,0x01,0x00,0x17,
+0xfa,0x23,0x00,0x01,0x01,0x00,0x19,0xfd,0x1f,0x00,0x14,0xfc,0x6d,0x00,0x00,0x68,
+0x00,0x8f,0x00,0xeb,0x00,0xfb,0x00,0xfb,0xf5,0xfa,0x98,0x00,0x09,0x14,0x05,0x09,
+0x00,0x21,0xfb,0xfc,0x33,0x00,0x34,0xfc,0xfa,0xfb,0x12,0x00,0x75,0xbc,0x00,0x00,
+0x00,0xd0,0x00,0xcc,0x23,0x00,0x62,0xf8,0xfb,0x00,0x00,0xfb,0xfa,0x04,0x00,0x0b,
+0x42,0x00,0x00,0x8c,0x00,0x2f,0x04,0xf9,0x65,0x00,0x06,0x1f,0xfb,0x3a,0x01,0x0c,
+0x10,0xd7,0x5e,0x00,0x0a,0xe5,0x00,0x10,0xf9,0x07,0x00,0x20,0xf6,0xf0,0x0e,0x00,
+0x14,0xb8,0x69,0x00,0x96,0xf0,0x00,0x00,0xcd,0xfa,0xcd,0xe9,0x00,0xba,0x2a,0x00,
+0x34,0xfd,0xe1,0xf3,0x0b,0x00,0x71,0x9b,0x00,0x00,0x00,0xd4,0x00,0xd2,0x0c,0x00,
+0x61,0xf3,0x00,0xf7,0x00,0xfd,0xfd,0x1d,0x01,0x3d,0x04,0x00,0x04,0x70,0x00,0x6f,
+0xf8,0x00,0xf9,0xfb,0x00,0xf7,0x93,0x00,0x0a,0x10,0xf4,0xb5,0x00,0x1c,0xf4,0x16,
+0x00,0x01,0x69,0x02,0xb1,0xc0,0xbc,0x00,0x00,0xe2,0xf9,0xca,0xfc,0x04,0x00,0x04,
+0x5d,0x00,0xd2,0xd6,0xea,0x00,0xea,0xcc,0xf0,0xed,0x00,0xf0,0xec,0xf4,0xed,0xf1,
+0x12,0x01,0x56,0xca,0xd9,0x00,0x00,0xed,0x9a,0x01,0xb3,0x04,0xf5,0xf5,0x00,0x00,
+0xf5,0xf9,0x00,0x00,0xf9,0xfd,0x31,0x01,0x94,0x04,0x00,0xdc,0xf1,0x00,0x00,0xf5,
+0x00,0x00,0x9e,0x00,0x33,0x03,0xf8,0xf8,0x62,0x01,0x16,0x00,0x15,0x00,0x14,0xd9,
+0xf1,0x01,0x15,0x04,0x18,0x01,0x10,0xfb,0x4f,0x01,0x13,0xf8,0x02,0x02,0xf5,0x11,
+0x05,0xf4,0xc6,0xda,0x00,0x00,0xdb,0xf9,0xe8,0xfc,0x04,0xe8,0x05,0x04,0x03,0x05,
+0x00,0x05,0xf0,0xf0,0xfb,0xf6,0xf0,0xf6,0xf2,0xfb,0xf6,0xfb,0x00,0xfa,0xf9,0x05,
+0x81,0x00,0x2a,0x03,0xfa,0x8e,0x01,0x01,0x46,0x00,0x1b,0xf9,0xb1,0x01,0x14,0xfc,
+0x3f,0x02,0x0c,0x01,0x00,0x0e,0x16,0x00,0x0d,0x1d,0x00,0x0f,0xfc,0x01,0x07,0x01,
+0xa3,0x02,0x2c,0xfc,0xfc,0xa9,0x02,0x0f,0x29,0x00,0x04,0x0f,0x1d,0x00,0x0e,0x3e,
+0x04,0x00,0x05,0xc3,0x02,0x19,0xfa,0x0e,0x00,0x2f,0xec,0x00,0x01,0x00,0x23,0x0a,
+0xa6,0x02,0x1f,0xea,0xf5,0x00,0x0b,0x22,0xfb,0xfc,0x96,0x01,0x2b,0xd5,0x00,0xb9,
+0x03,0x20,0xfb,0x05,0x5a,0x02,0x4f,0x0d,0x00,0x05,0x04,0x41,0x00,0x09,0x07,0x30,
+0x01,0x00,0x28,0x00,0x1c,0xd6,0x60,0x00,0x2c,0xfd,0x03,0x76,0x01,0x1f,0xe1,0xd2,
+0x00,0x23,0x1e,0xf6,0x23,0x00,0x0f,0xf5,0x01,0x12,0x1f,0xfb,0xb6,0x03,0x05,0x30,
+0x01,0x00,0x02,0x07,0x00,0x31,0x02,0x03,0x00,0x5c,0x03,0x1d,0x05,0x21,0x00,0xf1,
+0x0c,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,
+0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,0xff,0x0c,
+0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,
+0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0xd1,0x00,0x0e,0x02,0x7d,
+0x00,0x20,0x03,0x02,0x78,0x00,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,
+0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xf1,0x08,0x0b,0x00,
+0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,
+0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,
+0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x77,0x00,0x06,0x50,0x00,0x00,
+0x00,0x00,0x00,0x70,0x0f,0xff,0xfd,0x0e,0xff,0xfc,0x0d,0x03,0x00,0x20,0xfb,0x0c,
+0x03,0x00,0x20,0xfa,0x0b,0x03,0x00,0x20,0xf9,0x0a,0x03,0x00,0xb0,0xf8,0x09,0xff,
+0xf7,0x09,0xff,0xf7,0x08,0xff,0xf6,0x07,0x03,0x00,0xf0,0x12,0xf5,0x03,0x99,0x93,
+0x00,0x00,0x00,0x00,0x8a,0x70,0x0b,0xff,0xfa,0x0f,0xff,0xfe,0x0d,0xff,0xfc,0x03,
+0xcf,0xc2,0xff,0xf2,0x0e,0xff,0x3f,0xff,0x20,0xef,0xf3,0xff,0xf1,0x09,0x00,0xf0,
+0x0a,0x00,0xef,0xf1,0xff,0xe0,0x0e,0xff,0x0f,0xfd,0x00,0xef,0xe0,0xff,0xb0,0x0e,
+0xfd,0x0f,0xfa,0x00,0xef,0xb0,0x77,0x40,0x06,0x74,0x3a,0x00,0x50,0xaf,0xf2,0x00,
+0xcf,0xf1,0x09,0x00,0x50,0xdf,0xf0,0x00,0xff,0xd0,0x09,0x00,0xf2,0x14,0xff,0xc0,
+0x02,0xff,0xa0,0x00,0x00,0x00,0x03,0xff,0x90,0x05,0xff,0x70,0x00,0x00,0x00,0x06,
+0xff,0x60,0x08,0xff,0x40,0x00,0x00,0x00,0x0a,0xff,0x30,0x0c,0xff,0x10,0x00,0x0d,
+0xff,0x01,0x00,0x15,0xf7,0x09,0x00,0xf0,0x01,0x09,0xbb,0xcf,0xfe,0xbb,0xcf,0xfd,
+0xbb,0xb4,0x00,0x00,0x5f,0xf7,0x00,0x7f,0xf6,0x47,0x00,0x50,0x8f,0xf5,0x00,0xaf,
+0xf3,0x09,0x00,0x50,0xbf,0xf2,0x00,0xdf,0xf0,0x09,0x00,0x12,0xef,0x62,0x00,0x13,
+0xff,0x01,0x00,0x15,0x40,0x09,0x00,0xf0,0x09,0xaa,0xad,0xff,0xca,0xad,0xff,0xba,
+0xaa,0x20,0x00,0x09,0xff,0x40,0x0b,0xff,0x20,0x00,0x00,0x00,0x0c,0xff,0x10,0x0e,
+0xff,0x35,0x00,0x50,0x0f,0xfe,0x00,0x1f,0xfc,0x09,0x00,0x50,0x2f,0xfb,0x00,0x4f,
+0xf9,0x09,0x00,0x23,0x5f,0xf8,0x62,0x00,0x61,0x7f,0xf5,0x00,0x9f,0xf3,0x00,0x01,
+0x00,0x2f,0x08,0xff,0x08,0x00,0x02,0x40,0x04,0x8d,0xff,0x84,0xca,0x00,0x81,0xdf,
+0xff,0xff,0xff,0xd3,0x00,0x00,0x4f,0x6f,0x00,0xf0,0x0d,0x30,0x00,0xef,0xff,0xff,
+0xef,0xff,0xff,0xd0,0x06,0xff,0xff,0xa0,0x01,0xbf,0xff,0xf5,0x09,0xff,0xff,0x00,
+0x00,0x1f,0xff,0xfa,0x0a,0xff,0xfd,0x79,0x00,0x11,0xfc,0x10,0x00,0x50,0x04,0x77,
+0x76,0x05,0xff,0x08,0x01,0x00,0xb9,0x00,0x30,0xff,0xfe,0x71,0x08,0x00,0xf0,0x08,
+0x3f,0xff,0xff,0xff,0xa2,0x00,0x00,0x00,0x02,0xcf,0xff,0xff,0xff,0xa1,0x00,0x00,
+0x00,0x05,0xdf,0xff,0xff,0xfd,0x20,0x62,0x00,0x22,0xaf,0xff,0x3d,0x01,0xf1,0x08,
+0x01,0xcf,0xff,0xf6,0x24,0x44,0x40,0x00,0x00,0x1e,0xff,0xfb,0x8f,0xff,0xf0,0x00,
+0x00,0x0b,0xff,0xfd,0x6f,0xff,0xf4,0x58,0x00,0x60,0x1f,0xff,0xfd,0x10,0x00,0x5f,
+0x68,0x00,0x81,0xff,0xfb,0x9c,0xff,0xff,0xf4,0x01,0xef,0x90,0x00,0x30,0xa0,0x00,
+0x1c,0x07,0x00,0x00,0xdc,0x00,0x50,0x4a,0xdf,0xff,0xc8,0x20,0x47,0x00,0x4e,0x0d,
+0xfa,0x00,0x00,0x08,0x00,0x42,0x4b,0xef,0xea,0x30,0x10,0x00,0x52,0x07,0xff,0xff,
+0xff,0xf5,0x0b,0x00,0xf0,0x24,0x2f,0xff,0xc9,0xdf,0xfe,0x00,0x00,0x07,0x10,0x00,
+0x00,0x6f,0xfb,0x00,0x0d,0xff,0x40,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf7,0x00,0x0a,
+0xff,0x50,0x03,0xff,0xb0,0x00,0x00,0x7f,0xf8,0x00,0x0b,0xff,0x50,0x0d,0xfe,0x10,
+0x00,0x00,0x5f,0xfe,0x30,0x4f,0xff,0x20,0x8f,0x3a,0x00,0x00,0xbc,0x01,0x21,0xfb,
+0x03,0xe1,0x00,0x50,0x02,0xdf,0xff,0xff,0xb1,0x20,0x00,0x00,0x32,0x01,0x42,0x78,
+0x73,0x00,0x9f,0x5a,0x00,0x00,0x0e,0x00,0x24,0xff,0xa0,0x0b,0x00,0x61,0x0e,0xfe,
+0x10,0x48,0x87,0x20,0x0b,0x00,0x32,0x9f,0xf5,0x2d,0xaf,0x00,0x00,0x20,0x00,0x00,
+0x5b,0x01,0xc0,0x80,0x00,0x00,0x00,0x1e,0xfe,0x15,0xff,0xe3,0x07,0xff,0xf0,0x53,
+0x02,0x71,0xf5,0x09,0xff,0x70,0x00,0xdf,0xf3,0x20,0x00,0x60,0x0a,0xff,0x50,0x00,
+0xcf,0xf3,0x20,0x00,0x40,0x10,0x09,0xff,0x60,0x0b,0x00,0x00,0x60,0x00,0xf2,0x02,
+0x07,0xff,0xb0,0x01,0xff,0xf1,0x00,0x00,0x19,0xa0,0x00,0x02,0xff,0xfc,0x9e,0xff,
+0xc0,0x65,0x00,0x53,0x7f,0xff,0xff,0xfe,0x20,0x7b,0x00,0xa1,0xbe,0xfe,0x91,0x00,
+0x00,0x00,0x18,0xcf,0xfe,0xa3,0x10,0x00,0x40,0x03,0xef,0xff,0xff,0x8e,0x02,0x00,
+0xaa,0x01,0x04,0xfd,0x00,0x61,0x9f,0xff,0xfb,0xae,0xff,0xfd,0xbd,0x02,0x52,0xff,
+0x70,0x01,0xef,0xff,0xac,0x01,0x31,0x20,0x00,0xbf,0x0a,0x00,0x62,0xcf,0xff,0x50,
+0x02,0xff,0xfb,0x57,0x00,0x41,0xd0,0x5e,0xff,0xf3,0xc6,0x00,0x52,0xff,0xfe,0xff,
+0xff,0x50,0xbb,0x00,0x01,0x13,0x02,0x02,0x0a,0x00,0x12,0xfd,0x74,0x00,0x11,0x8f,
+0x63,0x00,0xf0,0x17,0xaf,0xff,0x30,0x08,0xff,0xff,0xdf,0xff,0xf6,0x00,0xcf,0xff,
+0x20,0x3f,0xff,0xf6,0x0c,0xff,0xff,0x50,0xff,0xff,0x00,0xaf,0xff,0xd0,0x01,0xdf,
+0xff,0xf9,0xff,0xfd,0x00,0xdf,0xff,0xa0,0x00,0x2e,0xf7,0x02,0xe1,0x00,0xdf,0xff,
+0xd0,0x00,0x02,0xff,0xff,0xff,0xf1,0x00,0xaf,0xff,0xf7,0x40,0x00,0x10,0x70,0x65,
+0x02,0x83,0xda,0xad,0xff,0xff,0xff,0xc0,0x00,0x09,0xe0,0x02,0x12,0xf9,0x5a,0x00,
+0xf0,0x08,0xff,0xec,0xff,0xff,0x60,0x00,0x02,0x8c,0xef,0xfd,0xa5,0x00,0xdf,0xff,
+0xf3,0x0f,0xff,0x40,0xff,0xf4,0x0f,0xff,0x40,0x0a,0x00,0xa1,0x20,0xff,0xf0,0x0f,
+0xff,0x00,0xff,0xe0,0x08,0x86,0xeb,0x00,0x10,0xa0,0xb4,0x00,0x10,0xf3,0xe6,0x01,
+0x40,0xf6,0x00,0x00,0x4f,0x5f,0x01,0x20,0xef,0xfa,0xd4,0x02,0x10,0xf1,0xfd,0x00,
+0x10,0x80,0xd0,0x00,0x80,0x10,0x00,0x00,0xdf,0xfc,0x00,0x00,0x02,0x76,0x00,0x10,
+0x06,0x5f,0x02,0x10,0x0a,0x1d,0x00,0x10,0x0d,0x7f,0x01,0x10,0x0e,0x89,0x02,0x3d,
+0x0f,0xff,0xc0,0x05,0x00,0x01,0x19,0x00,0x01,0x23,0x00,0x01,0x2d,0x00,0x01,0x37,
+0x00,0x30,0x03,0xff,0xf7,0x34,0x01,0x10,0xfb,0xfd,0x00,0x00,0x55,0x00,0x10,0x1f,
+0x63,0x01,0x80,0x09,0xff,0xe0,0x00,0x00,0x01,0xef,0xf9,0x6c,0x03,0x20,0xff,0x60,
+0x79,0x00,0x10,0xf5,0x20,0x00,0x10,0xf4,0x2c,0x01,0x12,0xc0,0x5f,0x03,0x10,0x60,
+0x9a,0x03,0x11,0xfa,0x13,0x03,0x10,0xb0,0x42,0x01,0x11,0xf9,0x66,0x01,0x40,0x30,
+0x00,0x00,0x0d,0x65,0x00,0x30,0x05,0xff,0xf6,0x56,0x00,0x11,0xfd,0xa3,0x01,0x13,
+0x30,0xc3,0x00,0x12,0x1f,0x84,0x00,0x10,0xf0,0x0b,0x03,0x10,0xf3,0x84,0x00,0x10,
+0xf5,0x6a,0x00,0x10,0xf6,0x5f,0x00,0x13,0xf8,0x05,0x00,0x30,0x09,0xff,0xf7,0x19,
+0x00,0x10,0xf6,0x36,0x03,0x10,0xf4,0x4c,0x00,0x10,0xf1,0xbb,0x00,0x10,0xe0,0x41,
+0x00,0x40,0x90,0x00,0x00,0x8f,0x84,0x04,0x20,0xdf,0xfd,0x6f,0x00,0x10,0xf7,0x45,
+0x00,0x10,0xe0,0x9f,0x00,0x50,0x40,0x00,0x03,0xff,0xfa,0x05,0x03,0x22,0xc0,0x00,
+0x28,0x04,0x35,0x0a,0x70,0x00,0x01,0x00,0x10,0x01,0x24,0x00,0x00,0xaa,0x00,0x03,
+0xe0,0x01,0x01,0x67,0x02,0xf0,0x09,0x51,0x00,0x0e,0xfc,0x00,0x01,0x20,0x0f,0xfb,
+0x40,0xdf,0xb0,0x4a,0xfa,0x05,0xff,0xff,0xee,0xfd,0xdf,0xff,0xf0,0x28,0xdf,0xa2,
+0x01,0x70,0xea,0x10,0x00,0x16,0xef,0xff,0xc7,0x83,0x02,0x12,0x6f,0x15,0x02,0x50,
+0x3f,0xfe,0x9f,0xfa,0x00,0xce,0x03,0x21,0x50,0xdf,0x75,0x00,0x20,0xb0,0x04,0x9a,
+0x00,0x50,0x3d,0xf1,0x00,0x09,0xfa,0xaa,0x01,0x31,0x00,0x00,0x15,0x5a,0x00,0x33,
+0x25,0x55,0x40,0x98,0x03,0x14,0xfd,0xca,0x02,0x1f,0xd0,0x11,0x00,0x11,0x14,0x01,
+0x42,0x05,0x13,0x1f,0x09,0x00,0x1c,0x71,0x11,0x00,0x1f,0x70,0x55,0x00,0x1f,0x00,
+0x0f,0x03,0x04,0x03,0x00,0x50,0xfe,0x00,0xef,0xfc,0x02,0x30,0x06,0xf0,0x00,0xf2,
+0x1f,0xff,0x80,0x2b,0xfb,0x00,0x00,0x30,0x00,0x29,0x99,0x99,0x99,0x94,0x0b,0x05,
+0x16,0xf8,0x05,0x00,0xa0,0x00,0x8b,0x81,0x00,0xbf,0xff,0xb0,0x0f,0xff,0xff,0xd4,
+0x02,0x32,0x02,0xcf,0xc3,0x38,0x01,0x01,0x2b,0x03,0x31,0x05,0xff,0xf0,0x29,0x06,
+0x1d,0xfa,0x13,0x00,0x22,0xbf,0xfa,0x90,0x03,0x11,0x40,0x25,0x06,0x02,0x13,0x00,
+0x18,0xf9,0x13,0x00,0x11,0xe0,0x88,0x03,0x07,0x13,0x00,0x18,0x07,0x13,0x00,0x36,
+0x2f,0xff,0x30,0x13,0x00,0x28,0xdf,0xf8,0x13,0x00,0x18,0xd0,0x13,0x00,0x11,0x20,
+0xd1,0x05,0x02,0x13,0x00,0x11,0xf7,0x7f,0x02,0x22,0x88,0x10,0xef,0x00,0x62,0x39,
+0xdf,0xfe,0xa5,0x00,0x00,0x69,0x03,0x40,0xd1,0x00,0x00,0xaf,0x08,0x00,0x40,0xfe,
+0x10,0x04,0xff,0x18,0x04,0x50,0xff,0xa0,0x0c,0xff,0xfe,0x0c,0x04,0x40,0xf1,0x1f,
+0xff,0xf7,0x80,0x00,0x40,0xf6,0x4f,0xff,0xf2,0x55,0x02,0x22,0xfa,0x6f,0x98,0x05,
+0x22,0xfc,0x7f,0x0c,0x03,0x2f,0xfd,0x8f,0x08,0x00,0x0c,0x04,0x28,0x00,0x04,0x38,
+0x00,0x03,0x48,0x00,0x14,0xf9,0x58,0x00,0x10,0x0b,0x68,0x00,0x80,0xaf,0xff,0xf1,
+0x04,0xff,0xff,0xfa,0xad,0xd0,0x05,0x12,0x9f,0x88,0x00,0x02,0x98,0x00,0x12,0xd2,
+0xa8,0x00,0x11,0xb6,0xb1,0x00,0xe0,0x02,0x7d,0x80,0x00,0x01,0x6c,0xff,0xf8,0x01,
+0x6b,0xff,0xff,0xff,0x85,0x1f,0x00,0x20,0xf8,0x6f,0x06,0x00,0x91,0x86,0xff,0xea,
+0x5f,0xff,0xf8,0x48,0x30,0x00,0x4d,0x05,0x10,0x0f,0x0d,0x03,0x0f,0x0b,0x00,0x3a,
+0x53,0x4a,0xdf,0xfe,0xb7,0x10,0xb9,0x06,0x52,0xfe,0x50,0x00,0x02,0xef,0x79,0x07,
+0x80,0x00,0xdf,0xff,0xfe,0xab,0xef,0xff,0xfd,0x96,0x06,0x80,0x00,0x01,0xdf,0xff,
+0xf3,0x0a,0xff,0xfe,0xde,0x01,0x50,0xff,0x50,0xdf,0xff,0xb0,0x7b,0x01,0x41,0xf5,
+0x02,0x33,0x31,0x22,0x05,0x02,0x78,0x06,0x13,0xbf,0x70,0x02,0x33,0x5f,0xff,0xf7,
+0x7c,0x06,0x11,0xfc,0x08,0x00,0x13,0x2e,0xb7,0x05,0x13,0x2e,0x29,0x00,0x10,0x2e,
+0x5c,0x00,0x0f,0x08,0x00,0x10,0x93,0x1e,0xff,0xff,0xd9,0x99,0x99,0x99,0x99,0x17,
+0xed,0x02,0x23,0xf2,0x7f,0x09,0x00,0x14,0x27,0x11,0x00,0x41,0x00,0x01,0x7b,0xef,
+0x3c,0x01,0x01,0x27,0x01,0x32,0xe5,0x00,0x08,0x18,0x00,0xc0,0x50,0x2f,0xff,0xff,
+0xda,0xae,0xff,0xff,0xe0,0x8f,0xff,0xf6,0xf8,0x01,0x40,0xf4,0x7b,0xbb,0x90,0x8f,
+0x00,0x22,0xf6,0x00,0xa8,0x07,0x00,0xac,0x04,0x00,0x18,0x00,0x61,0xe1,0x00,0x00,
+0x06,0x77,0x9d,0xf3,0x05,0x00,0xf1,0x06,0x13,0xd4,0xf9,0x06,0x13,0x91,0x08,0x00,
+0x11,0xfe,0xae,0x00,0x23,0x26,0xef,0x28,0x04,0x12,0x3f,0xd7,0x00,0x00,0x24,0x02,
+0x31,0x77,0x77,0x40,0xb4,0x07,0x30,0xef,0xff,0xb0,0xb6,0x04,0x10,0xfa,0xe0,0x05,
+0x00,0xe5,0x05,0x12,0x4f,0x78,0x00,0x23,0xe1,0x08,0xbb,0x08,0x00,0xb3,0x06,0x01,
+0x49,0x06,0x20,0x01,0x7c,0xd8,0x05,0x02,0x77,0x04,0x04,0x50,0x00,0x23,0x0a,0xff,
+0x09,0x00,0x13,0x5f,0x09,0x00,0x00,0xf2,0x07,0x13,0xe0,0x1a,0x00,0x02,0x09,0x00,
+0x13,0x4f,0x09,0x00,0x61,0x01,0xef,0xfe,0xaf,0xff,0xe0,0x1a,0x00,0x41,0xf4,0x9f,
+0xff,0xe0,0x1a,0x00,0x22,0xa0,0x9f,0x89,0x05,0x20,0xfe,0x10,0x09,0x00,0x00,0x1a,
+0x00,0x22,0x00,0x9f,0x0e,0x05,0x11,0xa0,0x09,0x00,0x00,0x1a,0x00,0x01,0x09,0x00,
+0xa4,0x0a,0xff,0xfc,0x99,0x99,0xdf,0xff,0xf9,0x94,0x1f,0x3e,0x04,0x1d,0x0f,0x09,
+0x00,0x02,0xba,0x07,0x03,0x90,0x00,0x0f,0x09,0x00,0x0e,0x11,0x8f,0x35,0x00,0x34,
+0xf4,0x00,0x0a,0xe7,0x00,0x13,0xcf,0x11,0x00,0x70,0x0e,0xff,0xfc,0xbb,0xbb,0xbb,
+0xbb,0xa9,0x02,0x13,0x10,0x03,0x02,0x13,0xf0,0x46,0x07,0x03,0x83,0x04,0x60,0x6f,
+0xff,0xc7,0xce,0xfd,0xa3,0xb2,0x03,0x03,0xfc,0x06,0x12,0xaf,0x09,0x00,0x00,0x0e,
+0x03,0x30,0x96,0x6a,0xff,0x3c,0x03,0x73,0x47,0x10,0x00,0x06,0xff,0xff,0x90,0x6c,
+0x01,0x14,0xfd,0x78,0x00,0x13,0xf0,0xbb,0x09,0x50,0xff,0x02,0x88,0x88,0x10,0x38,
+0x00,0x50,0xe0,0x3f,0xff,0xf6,0x00,0x73,0x00,0x40,0x00,0xef,0xff,0xe2,0x19,0x00,
+0xb3,0x70,0x07,0xff,0xff,0xfb,0x9d,0xff,0xff,0xe1,0x00,0x0b,0x90,0x00,0x02,0x67,
+0x00,0x30,0xe4,0x00,0x00,0x59,0x07,0x22,0xeb,0x61,0x2b,0x08,0x21,0x8c,0xef,0xa7,
+0x06,0x22,0x3c,0xff,0x9f,0x02,0x11,0x7f,0x8e,0x07,0x01,0xd5,0x00,0x21,0xfd,0xb8,
+0x8e,0x01,0x22,0xfd,0x50,0x0d,0x08,0x02,0x5e,0x09,0x61,0x06,0xff,0xfd,0x03,0x78,
+0x85,0x32,0x08,0x11,0x8b,0x1f,0x03,0x03,0x47,0x01,0x23,0x60,0x04,0x3d,0x01,0xd0,
+0x20,0x5f,0xff,0xff,0x92,0x03,0xcf,0xff,0xf9,0x06,0xff,0xff,0x70,0xb4,0x05,0x41,
+0xe0,0x7f,0xff,0xf1,0x7b,0x00,0x11,0x16,0x07,0x01,0x61,0x5f,0xff,0xf3,0x5f,0xff,
+0xf3,0x28,0x03,0x11,0x33,0x6c,0x02,0x60,0x7f,0xff,0xf1,0x0f,0xff,0xfb,0x41,0x02,
+0x50,0xfe,0x00,0x9f,0xff,0xf5,0xaf,0x09,0x60,0x80,0x02,0xff,0xff,0xfc,0x9c,0xbb,
+0x00,0x23,0x05,0xff,0xc1,0x08,0x23,0x04,0xef,0xbb,0x00,0x74,0x00,0x7b,0xef,0xec,
+0x60,0x00,0x00,0xac,0x01,0x1e,0xf0,0x09,0x00,0x20,0x09,0x99,0x01,0x00,0x12,0xef,
+0x34,0x01,0x00,0x73,0x08,0x13,0x20,0x61,0x02,0x14,0xfa,0x05,0x0a,0x14,0xf3,0x46,
+0x01,0x13,0xc0,0xfb,0x06,0x23,0xff,0x40,0x4f,0x01,0x02,0x60,0x01,0x00,0xa9,0x04,
+0x04,0xe6,0x08,0x03,0xea,0x01,0x02,0xb9,0x09,0x01,0x4d,0x0a,0x22,0x10,0x00,0x11,
+0x01,0x14,0xf9,0xc4,0x01,0x23,0xf2,0x00,0xfa,0x0a,0x13,0xb0,0x23,0x01,0x03,0x02,
+0x04,0x13,0x0d,0xf2,0x03,0x24,0x00,0x5f,0x80,0x0a,0x34,0xdf,0xff,0xe0,0x47,0x09,
+0x03,0x7b,0x07,0x12,0x5a,0x6d,0x04,0x12,0x2d,0xe7,0x00,0x03,0xe6,0x0a,0x70,0x50,
+0x09,0xff,0xff,0xfb,0xad,0xff,0x89,0x0c,0x00,0x2e,0x05,0x00,0xf6,0x08,0x10,0xf9,
+0x72,0x03,0x22,0xf5,0x0e,0x08,0x00,0x22,0xf4,0x09,0xae,0x05,0x31,0xe0,0x01,0xef,
+0x28,0x00,0x32,0x50,0x00,0x2c,0xf2,0x03,0x02,0xe2,0x01,0x23,0xb1,0x00,0x83,0x02,
+0xc0,0x30,0x0a,0xff,0xff,0x71,0x14,0xdf,0xff,0xe0,0x2f,0xff,0xf7,0xf8,0x00,0x40,
+0xf7,0x5f,0xff,0xf1,0x69,0x01,0x27,0xfb,0x7f,0x6e,0x0b,0x00,0x34,0x02,0x10,0x3f,
+0x6e,0x0b,0x42,0x8f,0xff,0xf9,0x0d,0x78,0x00,0x22,0xf2,0x03,0x4b,0x01,0x33,0x80,
+0x00,0x3d,0x10,0x03,0x00,0xa8,0x00,0x21,0xc7,0x10,0x9e,0x05,0x23,0xfd,0x92,0x94,
+0x03,0x00,0xc3,0x00,0x15,0xcf,0xaf,0x02,0x50,0xea,0xaf,0xff,0xff,0x40,0xb6,0x0b,
+0x41,0x01,0xdf,0xff,0xd0,0x58,0x00,0x31,0x4f,0xff,0xf2,0x16,0x06,0x31,0x0f,0xff,
+0xf7,0xaf,0x03,0x31,0x0d,0xff,0xf8,0xb8,0x02,0x01,0x56,0x06,0x11,0xf6,0xf6,0x0b,
+0x94,0x1f,0xff,0xff,0x61,0x04,0xdf,0xff,0xfa,0x09,0xfd,0x09,0x02,0xb8,0x00,0x10,
+0xf8,0xc8,0x00,0x11,0xfc,0xd1,0x02,0x31,0x04,0x55,0x20,0x43,0x06,0x05,0x51,0x05,
+0x00,0x5f,0x01,0x10,0x60,0xd8,0x01,0x10,0xaf,0xad,0x01,0x31,0x03,0xcc,0xef,0x26,
+0x03,0x13,0x04,0xa1,0x04,0x13,0x04,0x76,0x0c,0x41,0x04,0xff,0xdb,0x72,0x7d,0x0c,
+0x10,0xc2,0xa4,0x07,0x30,0x0f,0xff,0xff,0xb2,0x07,0x4f,0x01,0x8b,0x81,0x00,0x01,
+0x00,0x06,0x27,0x8b,0x80,0xd5,0x07,0x10,0x03,0xd5,0x07,0xff,0x02,0x5d,0xfa,0x00,
+0x1f,0xff,0xf9,0x04,0xff,0xff,0xb0,0x1e,0xff,0xf7,0x00,0x29,0xb6,0x00,0x01,0x00,
+0x09,0xf0,0x05,0x05,0xcc,0xc4,0x00,0x7f,0xff,0x50,0x07,0xff,0xf5,0x00,0x7f,0xff,
+0x40,0x08,0xff,0xf2,0x00,0xbf,0xfe,0x81,0x0a,0x9b,0x09,0xff,0xe1,0x00,0xbf,0xf5,
+0x00,0x00,0x45,0x30,0x00,0x21,0x04,0xa4,0x07,0x00,0x11,0x6d,0x7a,0x02,0x11,0x29,
+0x9e,0x03,0x20,0x05,0xcf,0x3e,0x04,0x20,0x01,0x7e,0xcb,0x00,0x20,0x91,0x1a,0x08,
+0x01,0x11,0xa4,0x31,0x0b,0x11,0xb5,0xb4,0x02,0x22,0xfd,0x30,0xcd,0x02,0x10,0xff,
+0x87,0x01,0x10,0x08,0x28,0x02,0x50,0xc6,0x10,0x00,0x00,0x5c,0x27,0x00,0x62,0xb2,
+0x00,0x00,0x03,0x9f,0xff,0xc5,0x02,0x23,0x17,0xdf,0xd0,0x05,0x13,0x4b,0xd4,0x02,
+0x41,0x02,0x83,0x8a,0xaa,0x01,0x00,0x12,0x0e,0x64,0x01,0x22,0xf1,0xef,0x08,0x00,
+0x13,0x1e,0x0f,0x00,0x0f,0xcf,0x00,0x03,0x12,0x08,0x34,0x00,0x1b,0xa0,0x2d,0x00,
+0x03,0x0f,0x00,0x33,0x10,0x1b,0x50,0x5c,0x03,0x22,0xe8,0x10,0x52,0x03,0x23,0xff,
+0xa4,0x9e,0x00,0x10,0xfd,0x04,0x0b,0x10,0xdf,0xcc,0x01,0x40,0x30,0x00,0x00,0x38,
+0x30,0x00,0x10,0xc3,0x36,0x02,0x12,0xef,0xf1,0x02,0x21,0x01,0xaf,0x4d,0x02,0x11,
+0x5b,0x3d,0x02,0x20,0x5a,0xff,0xad,0x01,0x01,0xfb,0x01,0x30,0xe7,0x10,0x02,0x63,
+0x0d,0x11,0x50,0x4b,0x00,0x11,0x92,0x4b,0x00,0x11,0xd6,0x62,0x00,0x80,0x1a,0x30,
+0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x03,0x00,0x00,0x6b,0xef,0xfd,0xa5,0x00,0x00,
+0x04,0xef,0xff,0xff,0xff,0xfc,0x10,0x03,0xff,0xff,0x08,0x00,0xf0,0x17,0x00,0xbf,
+0xff,0xfe,0xbb,0xff,0xff,0xf5,0x1f,0xff,0xfc,0x00,0x04,0xff,0xff,0xa3,0xff,0xff,
+0x50,0x00,0x0d,0xff,0xfc,0x01,0x11,0x10,0x00,0x00,0xdf,0xff,0xb0,0x00,0x00,0x00,
+0x00,0x3f,0xff,0xf6,0x07,0x00,0x32,0x2e,0xff,0xfd,0x07,0x00,0x26,0xff,0x30,0x07,
+0x00,0x82,0x0c,0xff,0xfe,0x20,0x00,0x00,0x00,0x03,0x0e,0x00,0x40,0x00,0x7f,0xff,
+0xa0,0x07,0x00,0x40,0x08,0xff,0xf7,0x00,0x01,0x00,0x38,0x01,0x11,0x00,0x01,0x00,
+0x21,0x07,0xa7,0x07,0x00,0x31,0x0a,0xff,0xfa,0x08,0x00,0x30,0xff,0xff,0xf0,0x07,
+0x00,0x12,0x0d,0x58,0x00,0x42,0x00,0x3c,0xfc,0x20,0x27,0x00,0x63,0x03,0x8b,0xef,
+0xfe,0xc9,0x50,0x34,0x00,0x11,0x4d,0xa7,0x00,0x12,0xe7,0x4f,0x00,0x71,0xaf,0xff,
+0xfd,0xa8,0x8a,0xcf,0xff,0x29,0x00,0x91,0x01,0xdf,0xff,0x92,0x00,0x00,0x00,0x16,
+0xef,0x81,0x00,0x31,0xdf,0xfd,0x30,0x23,0x00,0x92,0xbf,0xfc,0x00,0x00,0x00,0xaf,
+0xfd,0x10,0x00,0x0e,0x00,0x53,0xf7,0x00,0x00,0x4f,0xff,0x57,0x00,0xf0,0x12,0x01,
+0xff,0xf1,0x00,0x0d,0xff,0x60,0x00,0x00,0x2a,0xef,0xeb,0x50,0x00,0x08,0xff,0x60,
+0x04,0xff,0xe0,0x00,0x00,0x6f,0xff,0xff,0xff,0xc1,0x00,0x2f,0xfb,0x00,0xaf,0xf7,
+0x0d,0x00,0xf0,0x1a,0xeb,0xdf,0xff,0x20,0x00,0xdf,0xf0,0x0f,0xff,0x20,0x00,0x1f,
+0xff,0x90,0x01,0xff,0xf0,0x00,0x0a,0xff,0x23,0xff,0xd0,0x00,0x0a,0xff,0xc0,0x00,
+0x3f,0xff,0x00,0x00,0x8f,0xf4,0x6f,0xfa,0x00,0x01,0xff,0xf5,0x00,0x3d,0x00,0xf2,
+0x2f,0x07,0xff,0x58,0xff,0x80,0x00,0x6f,0xff,0x00,0x00,0x5f,0xfc,0x00,0x00,0x7f,
+0xf5,0x9f,0xf7,0x00,0x09,0xff,0xd0,0x00,0x07,0xff,0xb0,0x00,0x07,0xff,0x4a,0xff,
+0x60,0x00,0xcf,0xfa,0x00,0x00,0x8f,0xfa,0x00,0x00,0x9f,0xf2,0xaf,0xf7,0x00,0x0d,
+0xff,0x90,0x00,0x09,0xff,0x80,0x00,0x0b,0xff,0x09,0xff,0x70,0x00,0xef,0xf9,0x9f,
+0x00,0xf0,0x19,0xff,0xc0,0x7f,0xfa,0x00,0x0c,0xff,0xc0,0x00,0x2f,0xff,0x60,0x00,
+0x6f,0xf7,0x04,0xff,0xd0,0x00,0x9f,0xff,0x40,0x1d,0xff,0xf9,0x00,0x2e,0xfe,0x10,
+0x1f,0xff,0x20,0x02,0xff,0xff,0xdf,0xff,0xff,0xf9,0x9e,0x4e,0x00,0xf0,0x09,0xf8,
+0x00,0x08,0xff,0xff,0xfe,0x2c,0xff,0xff,0xff,0x70,0x00,0x06,0xff,0xf2,0x00,0x06,
+0xdf,0xe9,0x10,0x08,0xef,0xea,0x30,0x44,0x01,0x17,0xc1,0x68,0x01,0x37,0x3f,0xff,
+0xd2,0x0e,0x00,0x82,0x6f,0xff,0xf9,0x30,0x00,0x00,0x01,0x52,0x0e,0x00,0x82,0x5f,
+0xff,0xff,0xfd,0xbb,0xde,0xff,0x70,0x0e,0x00,0x11,0x1a,0x5e,0x01,0x23,0xf9,0x00,
+0x22,0x01,0x55,0x6a,0xde,0xff,0xec,0x83,0x39,0x00,0x34,0x9f,0xff,0xf1,0x0b,0x00,
+0x33,0xff,0xff,0xf8,0x0a,0x00,0x43,0x06,0xff,0xff,0xfe,0x0b,0x00,0x52,0x0c,0xff,
+0xff,0xff,0x40,0x0b,0x00,0x52,0x2f,0xff,0xff,0xff,0xa0,0x0b,0x00,0x34,0x8f,0xff,
+0xff,0x38,0x00,0x32,0xef,0xff,0x7e,0x3b,0x02,0x00,0x5a,0x02,0x13,0x19,0xe7,0x01,
+0x43,0x0b,0xff,0xfc,0x04,0x2e,0x02,0x72,0x1f,0xff,0xf7,0x00,0xef,0xff,0x90,0x39,
+0x02,0x32,0xf1,0x00,0x9f,0x10,0x02,0x11,0xdf,0x6b,0x01,0x12,0xf5,0x56,0x02,0x40,
+0x60,0x00,0x0e,0xff,0xd3,0x01,0x70,0x09,0xff,0xff,0x10,0x00,0x09,0xff,0xcc,0x01,
+0x22,0x0f,0xff,0x01,0x00,0x11,0x80,0xbd,0x01,0x00,0x01,0x00,0x00,0xc8,0x01,0x13,
+0xcf,0x0b,0x00,0xc0,0xf4,0x00,0x02,0xff,0xff,0xec,0xcc,0xcc,0xcc,0xcf,0xff,0xfb,
+0x2f,0x01,0x11,0x60,0x62,0x02,0x51,0xff,0x10,0x0e,0xff,0xff,0x83,0x02,0x62,0xff,
+0xff,0x70,0x5f,0xff,0xfa,0x10,0x02,0x52,0xff,0xd0,0xbf,0xff,0xf4,0x29,0x02,0x20,
+0xff,0xf3,0x3d,0x00,0x34,0xfe,0xca,0x50,0x5f,0x00,0x24,0xe4,0x00,0x51,0x00,0xa0,
+0x0f,0xff,0xfe,0xbb,0xbc,0xef,0xff,0xff,0xe0,0xff,0x0f,0x03,0x61,0x3e,0xff,0xff,
+0x3f,0xff,0xfb,0xb2,0x00,0x11,0xf6,0x11,0x00,0x61,0x05,0xff,0xff,0x5f,0xff,0xfb,
+0xf9,0x00,0x10,0xf2,0x11,0x00,0x43,0x02,0x7f,0xff,0xfa,0x44,0x00,0x13,0xfc,0x44,
+0x00,0x14,0xfa,0x55,0x00,0xb1,0xfe,0x20,0xff,0xff,0xc5,0x55,0x56,0x9f,0xff,0xfe,
+0x1f,0x33,0x00,0x30,0x4f,0xff,0xf9,0x44,0x00,0x00,0x2a,0x01,0x32,0xdf,0xff,0xfb,
+0x4f,0x03,0x02,0x11,0x00,0x12,0xff,0x11,0x00,0xd3,0x01,0xbf,0xff,0xfa,0xff,0xff,
+0xeb,0xbb,0xbc,0xff,0xff,0xff,0x4f,0x91,0x00,0x14,0xa0,0x00,0x01,0x11,0x0f,0x53,
+0x00,0x11,0xb8,0x0d,0x03,0x42,0x7b,0xef,0xfd,0xa6,0x7a,0x03,0x21,0xff,0xff,0xf5,
+0x00,0x12,0x0b,0x25,0x00,0x70,0x90,0x00,0x0a,0xff,0xff,0xff,0xdd,0x33,0x02,0x41,
+0x04,0xff,0xff,0xe5,0x33,0x01,0x41,0x10,0xcf,0xff,0xf3,0x18,0x02,0x42,0xf7,0x1f,
+0xff,0xfa,0xde,0x01,0x12,0xb5,0x29,0x01,0x41,0x08,0xaa,0xa8,0x8f,0x1c,0x00,0x02,
+0x72,0x01,0x03,0x39,0x03,0x14,0xaf,0xd0,0x01,0x10,0x0a,0x85,0x01,0x03,0x1b,0x02,
+0x33,0xf2,0x00,0x00,0x70,0x00,0x14,0x30,0x59,0x02,0x10,0xf5,0x07,0x00,0x32,0x78,
+0x88,0x62,0x0b,0x02,0x41,0x0f,0xff,0xfb,0x0c,0x43,0x00,0x02,0x73,0x01,0x40,0xfe,
+0x40,0x00,0x06,0x19,0x02,0x50,0xaf,0xff,0xff,0xec,0xdf,0x4f,0x02,0x23,0x01,0xcf,
+0x1c,0x01,0x00,0x4e,0x00,0x22,0xff,0xff,0x32,0x04,0x61,0x28,0xce,0xff,0xdb,0x61,
+0x00,0x37,0x01,0x43,0xeb,0x71,0x00,0x00,0x40,0x01,0x13,0x91,0x09,0x00,0x00,0x6c,
+0x04,0x30,0xff,0xff,0xeb,0x8d,0x01,0x20,0xe1,0x00,0x28,0x01,0x10,0x03,0xe5,0x01,
+0x00,0x31,0x01,0x00,0xef,0x00,0x10,0x40,0x09,0x00,0x00,0xfe,0x01,0x12,0xb0,0x43,
+0x01,0x32,0xbf,0xff,0xf0,0x09,0x00,0x10,0x8f,0xdd,0x01,0x11,0xb0,0xf2,0x00,0x12,
+0xf5,0x09,0x00,0x3b,0x5f,0xff,0xf6,0x09,0x00,0x05,0x1b,0x00,0x34,0x8f,0xff,0xf4,
+0x3f,0x00,0x14,0xf1,0x51,0x00,0x10,0xc0,0x09,0x00,0x00,0xef,0x02,0x13,0x50,0x75,
+0x00,0x14,0xfc,0x87,0x00,0x18,0xe2,0x99,0x00,0x00,0x01,0x00,0x13,0xa1,0xbd,0x00,
+0x35,0x72,0x00,0x00,0x41,0x02,0x0e,0x08,0x00,0x72,0xeb,0xbb,0xbb,0xbb,0xbb,0xb2,
+0xff,0x5f,0x05,0x1f,0x00,0x08,0x00,0x07,0x53,0xea,0xaa,0xaa,0xaa,0xa7,0x48,0x00,
+0x1e,0xfb,0x08,0x00,0x0f,0x40,0x00,0x0e,0x0c,0x08,0x00,0x01,0x78,0x00,0x1e,0xb3,
+0x98,0x00,0x09,0x08,0x00,0x12,0xdf,0x07,0x00,0x15,0xfd,0x0f,0x00,0x10,0xfe,0x36,
+0x00,0x12,0xb9,0x46,0x00,0x00,0xd7,0x01,0x08,0x55,0x00,0x0d,0x0f,0x00,0x01,0x01,
+0x00,0x13,0xb0,0xa3,0x00,0x06,0x0f,0x00,0x00,0x7a,0x00,0x1e,0xb8,0x3c,0x00,0x0f,
+0x0f,0x00,0x1f,0x01,0xec,0x02,0x23,0xfe,0xc8,0x6e,0x06,0x00,0x65,0x00,0x11,0x20,
+0x99,0x02,0x00,0x01,0x00,0x11,0xe2,0x4b,0x02,0x50,0xfc,0xce,0xff,0xff,0xfd,0x3c,
+0x04,0x11,0xf7,0x3e,0x06,0x20,0x50,0x0a,0x2f,0x05,0x01,0x18,0x02,0x32,0x0f,0xff,
+0xfe,0xd0,0x02,0x25,0xe0,0x4f,0xd0,0x04,0x12,0x6f,0xb7,0x02,0x01,0x4e,0x00,0x13,
+0xf4,0x0a,0x00,0x01,0x04,0x03,0x00,0x26,0x07,0x16,0xf0,0x0a,0x00,0x01,0x1e,0x00,
+0x01,0x0a,0x00,0x10,0x6f,0xd4,0x04,0x82,0x56,0x66,0xcf,0xff,0xf0,0x3f,0xff,0xf9,
+0x50,0x00,0x15,0xf0,0x5a,0x00,0x21,0xf0,0x0a,0x99,0x04,0x00,0x0a,0x00,0x50,0x02,
+0xff,0xff,0xf9,0x10,0x6e,0x07,0x10,0xf0,0xa9,0x00,0x10,0xfd,0x2f,0x02,0x10,0xf0,
+0x56,0x03,0x04,0xa2,0x03,0x11,0x6e,0x09,0x00,0x10,0xb3,0x38,0x00,0x53,0x6a,0xdf,
 0xfe,0xda,0x62,0xeb,0x00,0x00,0xaa,0x00,0x32,0x8f,0xff,0xfb,0x56,0x05,0x1f,0xf8,
 0x13,0x00,0x31,0x03,0x01,0x00,0x14,0xf8,0x09,0x00,0x09,0x13,0x00,0x00,0x99,0x01,
 0x1f,0xbc,0x72,0x00,0x3d,0x04,0x13,0x00,0x3f,0xaf,0xff,0xf0,0x03,0x00,0x2c,0x03,
-0x69,0x06,0x1f,0xfe,0x08,0x00,0x5d,0x30,0x4d,0xdd,0xd5,0xd6,0x0b,0x11,0xfd,0x29,
-0x02,0x11,0x1f,0xca,0x02,0xb1,0x30,0x01,0xbf,0xff,0xf6,0x0a,0xff,0xff,0xfd,0xcf,
-0xff,0x36,0x0c,0x02,0xa9,0x0e,0x14,0x2c,0x10,0x0e,0x11,0x5a,0x74,0x11,0x02,0x05,
-0x01,0x31,0xcf,0xff,0xfd,0xe1,0x05,0x00,0x8f,0x02,0x10,0x20,0x13,0x00,0x00,0x77,
-0x05,0x11,0x40,0xc3,0x02,0x10,0x3f,0x8e,0x02,0x00,0x13,0x00,0x10,0x1e,0x27,0x05,
-0x00,0x13,0x00,0x10,0x0c,0x2e,0x0e,0x00,0x13,0x00,0x10,0x0a,0xd7,0x04,0x00,0x13,
-0x00,0x41,0x06,0xff,0xff,0xf3,0xfa,0x02,0x12,0xb3,0x79,0x16,0x42,0x0f,0xff,0xfc,
-0xdf,0xb1,0x02,0x02,0x4f,0x03,0x05,0x69,0x03,0x15,0x60,0x66,0x04,0x02,0x18,0x07,
-0x21,0xfc,0xaf,0x2d,0x07,0x11,0xff,0xc2,0x0e,0x10,0xf7,0x13,0x00,0x01,0x9e,0x12,
-0x12,0xf2,0x98,0x00,0x10,0x09,0x34,0x18,0x01,0x85,0x00,0x10,0x1e,0xa5,0x02,0x00,
-0x49,0x00,0x00,0x10,0x10,0x12,0x30,0x5b,0x03,0x00,0x0c,0x0c,0x00,0x13,0x00,0x00,
-0x41,0x0d,0x11,0xf8,0x13,0x00,0x00,0xdb,0x06,0x1e,0xf3,0xac,0x03,0x0f,0x0f,0x00,
-0x64,0x01,0xbc,0x04,0x13,0x7f,0x51,0x07,0x03,0xc0,0x02,0x16,0xaf,0x0f,0x00,0x11,
-0x50,0x42,0x0c,0x03,0x70,0x04,0x02,0x68,0x08,0x06,0x9d,0x0b,0x17,0x1f,0x95,0x10,
-0x14,0x7f,0x9c,0x07,0x01,0x6b,0x08,0x05,0x3e,0x01,0x03,0xaf,0x0d,0x30,0xbf,0xff,
-0x80,0xd5,0x06,0x10,0xfb,0x0c,0x00,0x30,0x6f,0xff,0xe0,0x04,0x02,0x10,0xf6,0x0c,
-0x00,0x12,0x6a,0x8e,0x0d,0x10,0xa6,0x0c,0x00,0x30,0x64,0xff,0xfa,0x2f,0x01,0x11,
-0x47,0xc0,0x0d,0x00,0x06,0x18,0x31,0xff,0xfe,0x07,0x91,0x07,0x71,0x8f,0xff,0x50,
-0x06,0xff,0xf8,0x08,0x0c,0x00,0x71,0x2f,0xff,0xb0,0x0b,0xff,0xf2,0x09,0x84,0x07,
-0x10,0x0c,0x14,0x14,0x21,0xc0,0x0a,0xbd,0x07,0x60,0x06,0xff,0xf7,0x7f,0xff,0x60,
-0x0c,0x00,0x00,0x93,0x18,0x32,0xfd,0xdf,0xff,0xa9,0x00,0x10,0xb0,0x19,0x07,0x14,
-0xfa,0x0c,0x00,0x10,0x4f,0xc8,0x08,0x03,0x0c,0x00,0x10,0x0e,0xdf,0x08,0x03,0x0c,
-0x00,0x10,0x09,0xb8,0x01,0x03,0x0c,0x00,0x10,0x03,0xb7,0x00,0x03,0x0c,0x00,0x01,
-0x9d,0x17,0x01,0x0c,0x00,0x15,0xe1,0xf5,0x03,0x14,0xa0,0x96,0x03,0x24,0xff,0x40,
-0x13,0x00,0x15,0xfe,0x13,0x00,0x15,0xf8,0x1b,0x04,0x14,0xf3,0x13,0x00,0x22,0xff,
-0xc0,0x13,0x00,0x10,0xfe,0xa1,0x02,0x01,0x13,0x00,0x42,0xba,0xff,0xff,0x10,0xcf,
-0x03,0x00,0xcd,0x02,0x02,0xe2,0x03,0x33,0x6f,0xff,0xf5,0xe2,0x03,0x32,0xcf,0xff,
-0xe1,0x13,0x00,0x42,0x02,0xff,0xff,0x92,0x13,0x00,0x10,0x08,0x0b,0x09,0x01,0x08,
-0x04,0x33,0x0d,0xff,0xfe,0x08,0x04,0x12,0x4f,0x67,0x04,0x12,0xb0,0x98,0x11,0x11,
-0x8f,0xd5,0x08,0x14,0xef,0x13,0x00,0x14,0x05,0x13,0x00,0x00,0xbd,0x00,0x03,0x41,
-0x04,0x15,0x2f,0x41,0x04,0x11,0x7f,0xf4,0x02,0x12,0x6b,0x90,0x13,0x03,0x30,0x05,
-0x14,0xe6,0x7f,0x15,0x01,0xe1,0x00,0x00,0xd4,0x00,0x00,0x4d,0x00,0x00,0xba,0x00,
-0x42,0xf8,0x10,0x01,0x7f,0xaf,0x0f,0x11,0x70,0xa6,0x0a,0x42,0xb0,0x1f,0xff,0xfd,
-0x97,0x19,0x13,0xf1,0x3f,0x14,0x62,0x6f,0xff,0xf6,0x8f,0xff,0xf4,0x21,0x0b,0x13,
-0xf8,0xc2,0x08,0x10,0x1f,0x6b,0x13,0x13,0xf1,0x6a,0x02,0x06,0x0a,0x00,0x06,0x1e,
-0x00,0x05,0x32,0x00,0x16,0xf9,0x46,0x00,0x05,0x5a,0x00,0x11,0xf2,0x6e,0x00,0x00,
-0xc7,0x00,0x11,0xc0,0x82,0x00,0x23,0x00,0x7f,0xa3,0x13,0x10,0xfd,0xb4,0x0b,0x08,
-0xaa,0x00,0x26,0x00,0x5e,0x16,0x13,0x00,0xd2,0x00,0x13,0x10,0xb9,0x03,0x04,0xee,
-0x08,0x01,0xcd,0x03,0x05,0xc0,0x19,0x00,0xc2,0x0a,0x10,0xcd,0x13,0x00,0x01,0x13,
-0x01,0x14,0x09,0x7c,0x0a,0x24,0x00,0xbf,0x9d,0x08,0x1d,0x6f,0xc1,0x08,0x12,0x9f,
-0x1b,0x00,0x00,0x6e,0x09,0x14,0xf0,0x3f,0x00,0x2a,0x90,0xff,0x88,0x0a,0x22,0xff,
-0x90,0x09,0x00,0x26,0xeb,0x82,0x15,0x08,0x0f,0x09,0x00,0x2d,0x0f,0xa2,0x01,0x09,
-0x17,0x90,0xa2,0x01,0x11,0x03,0xa2,0x01,0x51,0x8f,0xff,0xff,0x30,0x0b,0xb8,0x04,
-0x02,0xa2,0x01,0x1a,0xfc,0xa2,0x01,0x33,0x7f,0xff,0xf5,0x80,0x0a,0x10,0x3f,0x3d,
-0x06,0x1a,0xf1,0xa2,0x01,0x0f,0x0a,0x00,0x04,0x06,0x32,0x00,0x05,0xa2,0x01,0x16,
-0xf5,0xfc,0x01,0x06,0x6e,0x00,0x14,0x03,0xa2,0x01,0x11,0x20,0x9a,0x13,0x11,0xdf,
-0x8f,0x01,0x15,0x09,0xf6,0x18,0x03,0x90,0x07,0x13,0x40,0xd2,0x00,0x06,0xf2,0x0c,
-0x11,0x7f,0x0e,0x12,0x21,0x00,0x00,0x3a,0x0f,0x13,0xe3,0x15,0x00,0x34,0x1c,0xfd,
-0x20,0xff,0x00,0x12,0x71,0x55,0x01,0x25,0xda,0x60,0xa6,0x0a,0x05,0xca,0x01,0x11,
-0xf7,0xb8,0x04,0x24,0xcd,0xff,0x06,0x06,0x11,0x2c,0x94,0x01,0x08,0x55,0x0a,0x00,
-0x2a,0x11,0x04,0x03,0x0c,0x02,0x09,0x00,0x10,0x04,0xe2,0x0b,0x00,0x48,0x0c,0x16,
-0x7e,0xb3,0x1e,0x1b,0xfa,0xc1,0x01,0x00,0xf2,0x00,0x00,0xe5,0x01,0x00,0xa9,0x10,
-0x00,0x8b,0x01,0x00,0xdc,0x10,0x02,0x09,0x00,0x10,0x0a,0x0a,0x05,0x01,0x3f,0x00,
-0x00,0xed,0x05,0x01,0x51,0x00,0x32,0x9f,0xff,0xf6,0x09,0x00,0x44,0x1f,0xff,0xfe,
-0x00,0x51,0x02,0x12,0x70,0xeb,0x05,0x05,0x5a,0x02,0x10,0x8f,0x0d,0x01,0x55,0x17,
-0xbd,0xff,0xec,0x72,0xbf,0x01,0x14,0x90,0x55,0x0d,0x10,0xfc,0x11,0x00,0x70,0xfe,
-0xcb,0xef,0xff,0xff,0x90,0x0f,0x4e,0x01,0x00,0x52,0x06,0x32,0x2f,0xff,0xfa,0x04,
-0x0d,0x11,0x2f,0x28,0x01,0x43,0x2b,0xbb,0xb5,0x0e,0xde,0x16,0x00,0x82,0x02,0x23,
-0xfa,0x30,0x39,0x0c,0x34,0xff,0xfe,0x94,0x3f,0x1e,0x02,0xc4,0x0f,0x24,0x19,0xef,
-0x08,0x1d,0x33,0x05,0xaf,0xff,0x3c,0x0c,0x00,0x82,0x11,0x42,0xd0,0x12,0x22,0x10,
-0xe1,0x02,0x31,0xef,0xff,0xd0,0x1a,0x0d,0x42,0xf7,0xbf,0xff,0xf2,0x09,0x00,0x40,
-0x6f,0xff,0xfd,0x30,0x35,0x1e,0x61,0xf5,0x0c,0xff,0xff,0xfd,0xba,0x7e,0x07,0x14,
-0xdf,0x28,0x16,0x02,0xab,0x00,0x10,0xd4,0x09,0x10,0x46,0xad,0xef,0xed,0xa5,0x13,
-0x0e,0x2f,0xff,0xf2,0x0a,0x00,0x01,0xa9,0x4b,0xbb,0xbb,0xbd,0xff,0xff,0xcb,0xbb,
-0xbb,0xb1,0xbc,0x0c,0x0f,0x0a,0x00,0x93,0x00,0xe3,0x02,0x02,0x4d,0x01,0x11,0x43,
-0x65,0x0a,0x00,0xb2,0x0a,0x0f,0x13,0x00,0x5f,0x14,0x2f,0x13,0x00,0x12,0x31,0xd9,
-0x04,0x10,0xaf,0xfe,0x21,0x10,0xfe,0x5d,0x19,0x00,0x7d,0x16,0x00,0x9c,0x11,0x40,
-0x2b,0xff,0xff,0x90,0x69,0x1c,0x20,0xdc,0xdf,0x7f,0x07,0x14,0x04,0x98,0x0f,0x02,
-0x17,0x21,0x02,0xfd,0x01,0x50,0x49,0xde,0xfe,0xda,0x50,0xef,0x01,0x13,0xf7,0x6b,
-0x0e,0x22,0xa5,0xff,0x49,0x16,0x10,0xdf,0x70,0x0f,0x21,0xff,0x10,0x08,0x06,0x31,
-0xfe,0x00,0xaf,0xff,0x08,0x00,0xce,0x16,0x12,0x04,0x6d,0x00,0x00,0xba,0x0e,0x02,
-0xca,0x0f,0x01,0xe2,0x03,0x10,0x9f,0x57,0x00,0x01,0x25,0x17,0x11,0x03,0xb0,0x02,
-0x12,0xbf,0x96,0x1e,0x11,0xfe,0x33,0x09,0x01,0xaf,0x00,0x10,0xf3,0x80,0x00,0x11,
-0x60,0x71,0x03,0x12,0x70,0x61,0x10,0x00,0x66,0x19,0x04,0x8b,0x17,0x41,0x6f,0xff,
-0xf1,0x03,0xf3,0x03,0x00,0x0a,0x03,0x13,0x60,0xa9,0x16,0x43,0x0b,0xff,0xfb,0x0d,
-0x13,0x11,0x10,0x5f,0xd3,0x0f,0x13,0x30,0xf1,0x04,0x13,0xcf,0x8d,0x1a,0x12,0x09,
-0x40,0x07,0x04,0x4e,0x19,0x14,0x20,0xec,0x10,0x25,0xff,0xc0,0xad,0x01,0x25,0xf6,
-0x00,0x17,0x11,0x14,0x10,0x1b,0x0f,0x11,0x01,0x2b,0x00,0x10,0x4f,0x9c,0x04,0x11,
-0xf8,0xf4,0x1a,0x00,0xb8,0x17,0x00,0x3c,0x01,0x11,0xfb,0x33,0x00,0x11,0x90,0x98,
-0x0c,0x01,0x10,0x1b,0x11,0x0c,0xdc,0x21,0x10,0xdf,0x2c,0x08,0x20,0xff,0x10,0xd7,
-0x09,0x10,0xf1,0x7f,0x00,0x11,0x70,0xaa,0x00,0x01,0x1a,0x08,0x00,0x6e,0x13,0x00,
-0x12,0x00,0x00,0xc8,0x04,0x10,0xf8,0x00,0x01,0x10,0x00,0x78,0x15,0x50,0x00,0xcf,
-0xff,0xef,0xfc,0x9c,0x19,0x02,0x73,0x17,0x00,0xcf,0x06,0x20,0x00,0x0d,0x6c,0x00,
-0x10,0x4f,0xe6,0x00,0x20,0xf7,0x6f,0xe9,0x09,0x10,0xf4,0x1a,0x01,0x82,0xf4,0x07,
-0xff,0xf3,0x2f,0xff,0x70,0x3f,0x2d,0x01,0x50,0xf7,0x0b,0xff,0xf0,0x0e,0xd9,0x07,
-0x10,0xd0,0xdb,0x00,0x20,0xfa,0x0f,0x88,0x0a,0x40,0xe0,0x9f,0xff,0x90,0xa4,0x00,
-0xa3,0xfe,0x3f,0xff,0x70,0x06,0xff,0xf2,0xcf,0xff,0x60,0x30,0x08,0x20,0x30,0x02,
-0x70,0x06,0x11,0x20,0xf0,0x00,0x64,0xef,0xfe,0x00,0x00,0xef,0xfc,0xf9,0x0c,0x24,
-0xff,0xfb,0x06,0x00,0x01,0x32,0x05,0x01,0x4d,0x13,0x02,0xde,0x01,0x13,0x3f,0x65,
-0x08,0x23,0xff,0xf3,0x22,0x0e,0x01,0x56,0x09,0x02,0xdb,0x0b,0x11,0x0c,0x7e,0x04,
-0x13,0x0a,0x3c,0x01,0x14,0x08,0xbc,0x07,0x11,0x80,0x36,0x00,0x11,0x30,0x10,0x02,
-0x21,0xf8,0x09,0x24,0x00,0x10,0x06,0x38,0x00,0x12,0xef,0x6c,0x17,0x20,0xff,0x40,
-0x54,0x19,0x00,0x68,0x00,0x11,0xfb,0x43,0x00,0x20,0x60,0x01,0xe4,0x0a,0x00,0xa2,
-0x00,0x10,0xe0,0xdb,0x04,0x02,0xcf,0x04,0x12,0x2f,0x03,0x06,0x10,0x0e,0xb9,0x01,
-0x15,0xf4,0x1d,0x0a,0x13,0xa0,0xef,0x11,0x06,0x4f,0x1a,0x24,0xff,0xf7,0x35,0x13,
-0x04,0x08,0x13,0x14,0xdf,0x99,0x04,0x12,0x07,0x17,0x09,0x02,0x41,0x0a,0x12,0xcf,
-0xd6,0x01,0x10,0xaf,0x5a,0x00,0x00,0xbc,0x22,0x12,0x04,0x6e,0x00,0x11,0xa0,0x5f,
-0x12,0x50,0x50,0x01,0xef,0xff,0xf3,0x77,0x00,0x10,0xfc,0x96,0x00,0x10,0xfd,0x8b,
-0x00,0x11,0xf3,0x19,0x00,0x21,0x70,0x0b,0x23,0x00,0x20,0x04,0xff,0xe4,0x06,0x12,
-0xff,0xe3,0x04,0x27,0xfb,0xbf,0x4b,0x00,0x22,0xfd,0x00,0x87,0x05,0x01,0xb9,0x05,
-0x00,0x5c,0x02,0x10,0x60,0x1c,0x06,0x08,0xe0,0x02,0x31,0x8f,0xff,0xf5,0x83,0x0c,
-0x00,0x74,0x01,0x12,0xc0,0x0c,0x04,0x12,0x07,0xb5,0x02,0x44,0xef,0xff,0xa0,0x0e,
-0x72,0x01,0x24,0xf2,0x5f,0x72,0x22,0x10,0xf9,0x30,0x22,0x02,0xaa,0x13,0x04,0x9e,
-0x02,0x02,0x8e,0x08,0x03,0xb2,0x02,0x15,0xf1,0xbe,0x13,0x15,0x80,0xb1,0x02,0x1f,
-0x40,0x0a,0x00,0x36,0x04,0x53,0x0b,0x1d,0xf3,0x09,0x00,0x20,0xf2,0x9b,0xc2,0x0b,
-0x14,0xbe,0x89,0x1b,0x14,0x3f,0x29,0x1a,0x13,0xdf,0x72,0x12,0x14,0x09,0xd1,0x19,
-0x02,0x4f,0x13,0x01,0x28,0x0a,0x14,0xe1,0xab,0x00,0x13,0x40,0x99,0x0f,0x12,0xf9,
-0x22,0x16,0x13,0xff,0x8c,0x03,0x14,0x1e,0xe2,0x00,0x13,0xaf,0x74,0x03,0x14,0x06,
-0x99,0x08,0x02,0xa5,0x01,0x02,0x52,0x04,0x04,0x5f,0x00,0x14,0x80,0x03,0x01,0x10,
+0x69,0x06,0x1f,0xfe,0x08,0x00,0x5d,0x81,0x4d,0xdd,0xd5,0x00,0x00,0x0e,0xff,0xfd,
+0x29,0x02,0x11,0x1f,0xca,0x02,0xe0,0x30,0x01,0xbf,0xff,0xf6,0x0a,0xff,0xff,0xfd,
+0xcf,0xff,0xff,0xe0,0x01,0x0b,0x02,0x00,0xff,0x06,0x12,0x2c,0x2d,0x06,0x64,0x00,
+0x00,0x5a,0xdf,0xfe,0xb6,0xc3,0x01,0x31,0xcf,0xff,0xfd,0xe1,0x05,0x00,0x8f,0x02,
+0x10,0x20,0x13,0x00,0x00,0x77,0x05,0x11,0x40,0xc3,0x02,0x10,0x3f,0x8e,0x02,0x00,
+0x13,0x00,0x40,0x1e,0xff,0xff,0xa0,0xd6,0x02,0x00,0x58,0x04,0x11,0xc0,0x39,0x00,
+0x10,0x0a,0xd7,0x04,0x00,0x13,0x00,0x41,0x06,0xff,0xff,0xf3,0xfa,0x02,0x41,0xb3,
+0xff,0xff,0xf5,0xfc,0x02,0x22,0xfc,0xdf,0xb1,0x02,0x02,0x4f,0x03,0x05,0x69,0x03,
+0x15,0x60,0x66,0x04,0x02,0x18,0x07,0x21,0xfc,0xaf,0x2d,0x07,0x00,0x7a,0x06,0x30,
+0xef,0xff,0xf7,0x13,0x00,0x61,0xfe,0x10,0x04,0xff,0xff,0xf2,0x98,0x00,0x00,0x7c,
+0x02,0x12,0xd0,0x48,0x03,0x10,0x1e,0xa5,0x02,0x01,0x49,0x00,0x42,0x4f,0xff,0xff,
+0x30,0x5b,0x03,0x32,0xaf,0xff,0xfd,0x13,0x00,0x41,0x01,0xef,0xff,0xf8,0x13,0x00,
+0x00,0xdb,0x06,0x1e,0xf3,0xac,0x03,0x0f,0x0f,0x00,0x64,0x01,0xbc,0x04,0x13,0x7f,
+0x51,0x07,0x03,0xc0,0x02,0x16,0xaf,0x0f,0x00,0x22,0x50,0x00,0xb1,0x00,0x04,0x21,
+0x01,0x04,0x01,0x07,0x12,0xf1,0x69,0x08,0x15,0xff,0x63,0x06,0x14,0x7f,0x9c,0x07,
+0x01,0x6b,0x08,0x05,0x3e,0x01,0x12,0x03,0x0a,0x00,0x30,0xbf,0xff,0x80,0xd5,0x06,
+0x10,0xfb,0x0c,0x00,0x30,0x6f,0xff,0xe0,0x04,0x02,0x10,0xf6,0x0c,0x00,0x30,0x6a,
+0xff,0xf4,0x2d,0x01,0x10,0xa6,0x0c,0x00,0x30,0x64,0xff,0xfa,0x2f,0x01,0x20,0x47,
+0xff,0x56,0x07,0x71,0xef,0xff,0x00,0x00,0xff,0xfe,0x07,0x91,0x07,0x71,0x8f,0xff,
+0x50,0x06,0xff,0xf8,0x08,0x0c,0x00,0x71,0x2f,0xff,0xb0,0x0b,0xff,0xf2,0x09,0x84,
+0x07,0x71,0x0c,0xff,0xf1,0x1f,0xff,0xc0,0x0a,0xbd,0x07,0x71,0x06,0xff,0xf7,0x7f,
+0xff,0x60,0x0a,0xa7,0x00,0x52,0x01,0xff,0xfd,0xdf,0xff,0xa9,0x00,0x10,0xb0,0x19,
+0x07,0x14,0xfa,0x0c,0x00,0x10,0x4f,0xc8,0x08,0x03,0x0c,0x00,0x10,0x0e,0xdf,0x08,
+0x03,0x0c,0x00,0x10,0x09,0xb8,0x01,0x03,0x0c,0x00,0x10,0x03,0xb7,0x00,0x13,0x0b,
+0xef,0x00,0x23,0xdf,0xfc,0xf1,0x00,0x15,0xe1,0xf5,0x03,0x14,0xa0,0x96,0x03,0x24,
+0xff,0x40,0x13,0x00,0x15,0xfe,0x13,0x00,0x15,0xf8,0x1b,0x04,0x14,0xf3,0x13,0x00,
+0x22,0xff,0xc0,0x13,0x00,0x10,0xfe,0xa1,0x02,0x01,0x13,0x00,0x42,0xba,0xff,0xff,
+0x10,0xcf,0x03,0x00,0xcd,0x02,0x02,0xe2,0x03,0x33,0x6f,0xff,0xf5,0xe2,0x03,0x32,
+0xcf,0xff,0xe1,0x13,0x00,0x42,0x02,0xff,0xff,0x92,0x13,0x00,0x10,0x08,0x0b,0x09,
+0x01,0x08,0x04,0x33,0x0d,0xff,0xfe,0x08,0x04,0x12,0x4f,0x67,0x04,0x10,0xb0,0x32,
+0x01,0x03,0x13,0x00,0x24,0x01,0xef,0x13,0x00,0x14,0x05,0x13,0x00,0x00,0xbd,0x00,
+0x03,0x41,0x04,0x15,0x2f,0x41,0x04,0x11,0x7f,0xf4,0x02,0x20,0x6b,0xef,0x58,0x03,
+0x13,0x00,0x30,0x05,0x12,0xe6,0x9a,0x08,0x12,0xff,0x70,0x0a,0x00,0xd4,0x00,0x00,
+0x4d,0x00,0x00,0xba,0x00,0x71,0xf8,0x10,0x01,0x7f,0xff,0xff,0x30,0xee,0x05,0x00,
+0x6b,0x08,0x22,0xb0,0x1f,0x71,0x0a,0x62,0xcf,0xff,0xf1,0x5f,0xff,0xf7,0xeb,0x05,
+0x42,0xf6,0x8f,0xff,0xf4,0x21,0x0b,0x13,0xf8,0xc2,0x08,0x32,0x1f,0xff,0xfa,0xdf,
+0x08,0x00,0x6a,0x02,0x06,0x0a,0x00,0x06,0x1e,0x00,0x05,0x32,0x00,0x16,0xf9,0x46,
+0x00,0x05,0x5a,0x00,0x11,0xf2,0x6e,0x00,0x00,0xc7,0x00,0x11,0xc0,0x82,0x00,0x00,
+0x5d,0x02,0x11,0x40,0xee,0x05,0x00,0xb4,0x0b,0x08,0xaa,0x00,0x25,0x00,0x5e,0x81,
+0x02,0x01,0xd2,0x00,0x13,0x10,0xb9,0x03,0x04,0xee,0x08,0x01,0xcd,0x03,0x23,0xff,
+0xff,0x8f,0x0b,0x00,0xc2,0x0a,0x10,0xcd,0x13,0x00,0x01,0x13,0x01,0x14,0x09,0x7c,
+0x0a,0x24,0x00,0xbf,0x9d,0x08,0x1d,0x6f,0xc1,0x08,0x12,0x9f,0x1b,0x00,0x00,0x6e,
+0x09,0x14,0xf0,0x3f,0x00,0x2a,0x90,0xff,0x88,0x0a,0x22,0xff,0x90,0x09,0x00,0x26,
+0xeb,0x82,0x15,0x08,0x0f,0x09,0x00,0x2d,0x0f,0xa2,0x01,0x09,0x17,0x90,0xa2,0x01,
+0x11,0x03,0xa2,0x01,0x51,0x8f,0xff,0xff,0x30,0x0b,0xb8,0x04,0x02,0xa2,0x01,0x1a,
+0xfc,0xa2,0x01,0x33,0x7f,0xff,0xf5,0x80,0x0a,0x10,0x3f,0x3d,0x06,0x1a,0xf1,0xa2,
+0x01,0x0f,0x0a,0x00,0x04,0x06,0x32,0x00,0x05,0xa2,0x01,0x16,0xf5,0xfc,0x01,0x06,
+0x6e,0x00,0x14,0x03,0xa2,0x01,0x32,0x20,0x00,0x8f,0xa2,0x01,0x15,0xf7,0xaa,0x00,
+0x24,0x70,0x00,0x90,0x07,0x13,0x40,0xd2,0x00,0x05,0xf2,0x0c,0x00,0x32,0x00,0x11,
+0xb1,0x0a,0x00,0x00,0xcc,0x07,0x13,0xe3,0x15,0x00,0xd0,0x1c,0xfd,0x20,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x00,0x10,0xff,0x01,0x00,0x51,0xda,0x60,0x00,
+0x00,0xff,0x01,0x00,0x23,0xfe,0x60,0x09,0x00,0xf1,0x06,0xff,0xf7,0x00,0xff,0xff,
+0xeb,0xbb,0xcd,0xff,0xff,0xff,0x20,0xff,0xff,0xb0,0x00,0x00,0x2c,0xff,0xff,0x90,
+0x09,0x00,0x41,0x02,0xff,0xff,0xc0,0x09,0x00,0x42,0x00,0xdf,0xff,0xd0,0x09,0x00,
+0x13,0xef,0x09,0x00,0x40,0x04,0xff,0xff,0xa0,0x09,0x00,0x53,0x02,0x7e,0xff,0xff,
+0x40,0x48,0x00,0x14,0xfa,0x51,0x00,0x13,0x90,0x09,0x00,0x10,0xf3,0x6c,0x00,0x70,
+0xec,0xcc,0xdf,0xff,0xf4,0x00,0x00,0x2d,0x00,0x32,0x2f,0xff,0xfd,0x09,0x00,0x40,
+0x0a,0xff,0xff,0x50,0x09,0x00,0x00,0x62,0x00,0x21,0xd0,0x00,0x51,0x00,0x32,0x9f,
+0xff,0xf6,0x09,0x00,0x32,0x1f,0xff,0xfe,0x09,0x00,0x41,0x09,0xff,0xff,0x70,0x09,
+0x00,0x42,0x01,0xff,0xff,0xe0,0x7e,0x00,0xb1,0x8f,0xff,0xf7,0x00,0x00,0x17,0xbd,
+0xff,0xec,0x72,0x00,0x20,0x00,0x01,0x6c,0x00,0x21,0x00,0xcf,0x09,0x00,0x10,0xfc,
+0x11,0x00,0xa0,0xfe,0xcb,0xef,0xff,0xff,0x90,0x0f,0xff,0xff,0x60,0xa2,0x00,0xf0,
+0x09,0xf2,0x2f,0xff,0xfa,0x00,0x00,0x00,0x7f,0xff,0xf6,0x2f,0xff,0xf8,0x00,0x00,
+0x00,0x2b,0xbb,0xb5,0x0e,0xff,0xfe,0x30,0x00,0x01,0x00,0x42,0x07,0xff,0xff,0xfa,
+0x0a,0x00,0x53,0xaf,0xff,0xff,0xfe,0x94,0x13,0x00,0x30,0xff,0xff,0xe7,0x0a,0x00,
+0x60,0x19,0xef,0xff,0xff,0xff,0xd3,0x0a,0x00,0x52,0x05,0xaf,0xff,0xff,0xff,0x28,
+0x00,0xf2,0x0a,0x5c,0xff,0xff,0xd0,0x12,0x22,0x10,0x00,0x00,0x00,0xbf,0xff,0xf4,
+0xef,0xff,0xd0,0x00,0x00,0x00,0x4f,0xff,0xf7,0xbf,0xff,0xf2,0x09,0x00,0xf2,0x05,
+0x6f,0xff,0xfd,0x30,0x00,0x02,0xdf,0xff,0xf5,0x0c,0xff,0xff,0xfd,0xba,0xcf,0xff,
+0xff,0xe0,0x01,0xdf,0x07,0x01,0x13,0x40,0xab,0x00,0xd3,0xd4,0x00,0x00,0x00,0x16,
+0xad,0xef,0xed,0xa5,0x00,0x00,0x6f,0xff,0x01,0x00,0x1f,0xf2,0x0a,0x00,0x01,0xe4,
+0x4b,0xbb,0xbb,0xbd,0xff,0xff,0xcb,0xbb,0xbb,0xb1,0x00,0x00,0x00,0x08,0x80,0x00,
+0x0f,0x0a,0x00,0x95,0x32,0x3f,0xff,0xf8,0x4d,0x01,0x41,0x43,0xff,0xff,0x80,0x7f,
+0x01,0x1f,0xf4,0x13,0x00,0x5f,0x14,0x2f,0x13,0x00,0x41,0x31,0xff,0xff,0xa0,0xe5,
+0x01,0xf1,0x10,0xf2,0x0e,0xff,0xfe,0x00,0x00,0x00,0x1e,0xff,0xfe,0x00,0x9f,0xff,
+0xfc,0x20,0x00,0x2b,0xff,0xff,0x90,0x01,0xff,0xff,0xff,0xdc,0xdf,0xff,0xff,0xf1,
+0x00,0x04,0x7b,0x01,0x00,0xa9,0x02,0x34,0x03,0xdf,0xff,0xfd,0x01,0x50,0x49,0xde,
+0xfe,0xda,0x50,0xef,0x01,0x22,0xf7,0x00,0x70,0x02,0x51,0xa5,0xff,0xff,0xc0,0x00,
+0x0f,0x03,0x40,0xf4,0x0f,0xff,0xff,0x0b,0x02,0x72,0x2f,0xff,0xfe,0x00,0xaf,0xff,
+0xf5,0x6c,0x00,0x22,0x80,0x04,0x6d,0x00,0xb0,0xcf,0xff,0xf3,0x00,0x0e,0xff,0xff,
+0x00,0x00,0x00,0x1f,0xf2,0x02,0x10,0x9f,0x57,0x00,0x61,0x06,0xff,0xff,0x70,0x00,
+0x03,0xb0,0x02,0x60,0xbf,0xff,0xf1,0x00,0x00,0x0d,0x8e,0x00,0x31,0x0f,0xff,0xfc,
+0xaf,0x00,0x10,0xf3,0x80,0x00,0x11,0x60,0x71,0x03,0xd0,0x70,0x00,0x9f,0xff,0xf0,
+0x00,0x00,0x00,0x0c,0xff,0xfc,0x00,0x0e,0xbf,0x02,0x00,0x2d,0x02,0x20,0xf1,0x03,
+0x46,0x02,0x01,0x0a,0x03,0x40,0x60,0x8f,0xff,0xe0,0x15,0x00,0x61,0x0b,0xff,0xfb,
+0x0d,0xff,0xf9,0x78,0x01,0x34,0x5f,0xff,0xf2,0x84,0x01,0x31,0xff,0xff,0xcf,0x99,
+0x02,0x02,0x1e,0x03,0x12,0xf8,0x98,0x01,0x10,0x4f,0xda,0x03,0x02,0x0b,0x00,0x13,
+0xef,0xc1,0x00,0x01,0xad,0x01,0x22,0xf6,0x00,0x01,0x00,0x12,0x2f,0xcb,0x00,0x31,
+0x5f,0xff,0xf5,0x62,0x00,0x10,0x20,0x32,0x00,0x20,0xf5,0x1f,0x3e,0x00,0x10,0x05,
+0xa8,0x03,0x20,0x00,0x7f,0x3c,0x01,0x11,0xfb,0x33,0x00,0x10,0x90,0x4a,0x01,0x40,
+0xe0,0x0a,0xff,0xfe,0xa1,0x00,0x20,0xff,0xd0,0x0a,0x01,0x20,0xa0,0x06,0x3f,0x00,
+0x40,0x0f,0xff,0xff,0xf1,0x7f,0x00,0x11,0x70,0xaa,0x00,0x10,0x4f,0x4a,0x01,0x10,
+0x03,0x95,0x00,0x00,0xd1,0x00,0x40,0x8f,0xff,0xff,0xf8,0x00,0x01,0x00,0xfa,0x00,
+0x80,0xb0,0x00,0xcf,0xff,0xef,0xfc,0x00,0x0a,0xf9,0x00,0x00,0xca,0x00,0x80,0xff,
+0xfb,0xaf,0xff,0x00,0x0d,0xff,0xf8,0x74,0x00,0x20,0xf1,0x03,0x46,0x03,0x40,0x30,
+0x0f,0xff,0xf4,0x1a,0x01,0x82,0xf4,0x07,0xff,0xf3,0x2f,0xff,0x70,0x3f,0x2d,0x01,
+0xa0,0xf7,0x0b,0xff,0xf0,0x0e,0xff,0xb0,0x6f,0xff,0xd0,0xdb,0x00,0xa0,0xfa,0x0f,
+0xff,0xb0,0x0a,0xff,0xe0,0x9f,0xff,0x90,0xa4,0x00,0x83,0xfe,0x3f,0xff,0x70,0x06,
+0xff,0xf2,0xcf,0x42,0x01,0x62,0x8f,0xff,0x30,0x02,0xff,0xf6,0xf3,0x00,0xa3,0xef,
+0xff,0xef,0xfe,0x00,0x00,0xef,0xfc,0xff,0xfe,0xea,0x03,0x14,0xfb,0x06,0x00,0x00,
+0xd7,0x00,0x21,0xff,0xf7,0x8a,0x03,0x01,0xde,0x01,0x11,0x3f,0xaf,0x04,0x11,0x2f,
+0x06,0x00,0x00,0x7f,0x00,0x00,0x66,0x01,0x21,0x0e,0xff,0x8b,0x01,0x21,0x00,0x0c,
+0x7e,0x04,0x13,0x0a,0x3c,0x01,0x10,0x08,0xd4,0x00,0x00,0xd0,0x00,0x11,0x80,0x36,
+0x00,0x11,0x30,0x10,0x02,0x21,0xf8,0x09,0x24,0x00,0x10,0x06,0x38,0x00,0x10,0xef,
+0xc1,0x00,0x10,0x0e,0x08,0x01,0x30,0x5f,0xff,0xfd,0x68,0x00,0x11,0xfb,0x43,0x00,
+0x51,0x60,0x01,0xff,0xff,0xf2,0xa2,0x00,0x10,0xe0,0xdb,0x04,0x02,0xcf,0x04,0x01,
+0x13,0x05,0x01,0x2e,0x00,0x10,0xcf,0x36,0x00,0x01,0x73,0x01,0x02,0x45,0x02,0x00,
+0x2e,0x01,0x02,0x99,0x01,0x01,0x97,0x00,0x01,0xa5,0x00,0x01,0x71,0x00,0x12,0xf9,
+0x0a,0x00,0x14,0xdf,0x99,0x04,0x01,0xb7,0x04,0x01,0x9a,0x00,0x10,0x1f,0x46,0x00,
+0x11,0xf6,0xea,0x00,0x00,0x5a,0x00,0x21,0xfe,0x10,0xa8,0x05,0x00,0x6e,0x00,0x10,
+0xa0,0x44,0x01,0x60,0xff,0x50,0x01,0xef,0xff,0xf3,0x77,0x00,0x10,0xfc,0x96,0x00,
+0x10,0xfd,0x8b,0x00,0x11,0xf3,0x19,0x00,0x20,0x70,0x0b,0x23,0x00,0x00,0x2d,0x00,
+0x42,0xf1,0x5f,0xff,0xff,0xe3,0x04,0x27,0xfb,0xbf,0x4b,0x00,0x22,0xfd,0x00,0x87,
+0x05,0x01,0xb9,0x05,0x00,0x5c,0x02,0x10,0x60,0x1c,0x06,0x08,0xe0,0x02,0x30,0x8f,
+0xff,0xf5,0x0f,0x00,0x10,0xfb,0x74,0x01,0x12,0xc0,0x0c,0x04,0x12,0x07,0xb5,0x02,
+0x44,0xef,0xff,0xa0,0x0e,0x72,0x01,0x42,0xf2,0x5f,0xff,0xf3,0xf0,0x00,0x22,0xf9,
+0xdf,0xe6,0x00,0x25,0x06,0xff,0x9e,0x02,0x15,0xdf,0xdc,0x00,0x11,0x4f,0x4e,0x02,
+0x03,0x7b,0x01,0x15,0x80,0xb1,0x02,0x1f,0x40,0x0a,0x00,0x36,0x23,0xdf,0xff,0xa2,
+0x06,0x0d,0x09,0x00,0x71,0xf2,0x9b,0xbb,0xbb,0xbb,0xbb,0xbe,0xeb,0x02,0x01,0x70,
+0x01,0x14,0xfd,0x6f,0x01,0x14,0xf3,0x58,0x03,0x13,0x70,0x76,0x03,0x11,0xfb,0x08,
+0x00,0x44,0x01,0xef,0xff,0xe1,0xab,0x00,0x02,0x65,0x00,0x13,0x8f,0xc7,0x00,0x23,
+0x03,0xff,0x8c,0x03,0x14,0x1e,0xe2,0x00,0x13,0xaf,0x74,0x03,0x12,0x06,0xcf,0x06,
+0x22,0x00,0x00,0xa5,0x01,0x02,0x52,0x04,0x04,0x5f,0x00,0x14,0x80,0x03,0x01,0x10,
 0xbb,0x01,0x00,0x24,0xb5,0xdf,0xa6,0x07,0x0e,0x09,0x00,0x86,0x07,0x77,0x77,0x74,
 0x2f,0xff,0xff,0xfa,0x04,0x00,0x2f,0xf6,0x00,0x04,0x00,0x4b,0x19,0xfa,0x70,0x00,
-0x38,0xcf,0xff,0xc0,0x07,0x1b,0x13,0x1f,0xf8,0x00,0x12,0xaf,0xa2,0x04,0x13,0x04,
-0xef,0x0c,0x13,0x0d,0x29,0x01,0x12,0x7f,0xae,0x0a,0x13,0x01,0xe2,0x00,0x13,0x0b,
-0xc7,0x0e,0x13,0x5f,0xfa,0x00,0x14,0xef,0x95,0x17,0x13,0xff,0x6a,0x18,0x02,0xf2,
-0x02,0x03,0xd0,0x04,0x04,0x64,0x00,0x01,0x20,0x1b,0x06,0x18,0x1d,0x01,0x7c,0x15,
-0x07,0x81,0x1b,0x0b,0x64,0x00,0x12,0x0a,0x64,0x00,0x00,0xd0,0x04,0x08,0xb9,0x1b,
-0x90,0x04,0x88,0x87,0x00,0x57,0x77,0x77,0x6c,0xff,0x30,0x03,0x50,0xff,0xfc,0xff,
-0xff,0xff,0x50,0x00,0x1f,0x09,0x07,0x00,0x3c,0x47,0x57,0xcf,0xff,0xfc,0x62,0x00,
-0x02,0x05,0x24,0x00,0x8c,0x00,0x22,0xf4,0x00,0x61,0x03,0x03,0x49,0x19,0x10,0x20,
-0xf5,0x00,0x30,0xcc,0xff,0x80,0x16,0x03,0x12,0x66,0xed,0x17,0x10,0x00,0x28,0x02,
-0xb0,0xdf,0xfa,0x00,0xaf,0xfd,0x00,0x04,0xff,0xf3,0x00,0x3f,0x31,0x0c,0x50,0xd0,
-0x00,0x0d,0xff,0xa0,0x8a,0x24,0x42,0x07,0xff,0xf1,0x77,0x01,0x00,0x1a,0x1f,0x13,
-0x13,0x13,0x4f,0x0f,0x00,0x30,0x0a,0xcc,0xcb,0xfa,0x18,0x01,0x41,0x1c,0x10,0xf3,
-0x71,0x00,0x10,0xd0,0x66,0x01,0x83,0x80,0x00,0x02,0x7c,0xef,0xfc,0x82,0x00,0xc7,
-0x1e,0x13,0x70,0x95,0x08,0x10,0xf6,0xe3,0x02,0x41,0x65,0x8f,0xff,0xfe,0xdd,0x16,
-0x00,0x67,0x01,0x00,0x55,0x19,0x11,0x02,0x58,0x01,0x30,0x36,0x89,0x9a,0x08,0x00,
-0x12,0x6e,0xf9,0x0b,0x13,0x0a,0x01,0x0c,0x40,0x5f,0xff,0xfb,0x31,0x89,0x06,0x00,
-0xa6,0x1b,0x00,0x08,0x00,0x00,0x1c,0x17,0x02,0x08,0x00,0x11,0xd0,0x1a,0x04,0x93,
-0xaf,0xff,0xfc,0x77,0xdf,0xff,0xff,0x60,0x3f,0xb5,0x0a,0x10,0x05,0xa7,0x13,0x00,
-0x25,0x00,0x41,0x29,0xdf,0xfc,0x70,0xd6,0x12,0x02,0xf1,0x01,0x0f,0x08,0x00,0x20,
-0x10,0x3a,0x47,0x18,0x31,0x4f,0xff,0xfa,0xb5,0x0a,0x13,0x4f,0x90,0x00,0x13,0x4f,
-0x43,0x1d,0x40,0x4f,0xff,0xfc,0x10,0x47,0x0a,0x12,0x4f,0x40,0x06,0x11,0xfa,0x08,
-0x00,0x10,0x0b,0x1d,0x11,0x10,0xf4,0x58,0x03,0x23,0xfe,0x4f,0x19,0x1f,0x09,0x10,
-0x00,0x03,0x20,0x00,0x00,0x6b,0x07,0x06,0x40,0x00,0x01,0xb1,0x22,0x16,0xf0,0x60,
-0x00,0x01,0x8c,0x0e,0x00,0x48,0x01,0x03,0x6b,0x28,0x42,0x5b,0xef,0xfd,0x92,0x21,
-0x28,0x23,0xff,0xf8,0x36,0x22,0x10,0xf8,0x4e,0x11,0x70,0xab,0xff,0xff,0xf2,0x4f,
-0xff,0xf9,0x96,0x02,0x30,0x89,0xff,0xfe,0x65,0x00,0x11,0xfb,0x9d,0x1a,0x58,0x37,
-0x77,0x5e,0xff,0xf9,0x5d,0x1e,0x04,0x53,0x1e,0x03,0xbb,0x1a,0x10,0x09,0x2d,0x00,
-0x10,0x08,0x43,0x23,0x01,0x4f,0x00,0x84,0x90,0xcf,0xff,0xfd,0x9b,0xff,0xff,0xf2,
-0x5a,0x00,0x01,0x69,0x00,0x11,0xf7,0x78,0x00,0x23,0xed,0x82,0xb4,0x07,0x0f,0x45,
-0x01,0x21,0x40,0x03,0xae,0xfe,0xa3,0x08,0x00,0x11,0x6f,0x94,0x10,0x23,0xf4,0x05,
-0x2f,0x02,0xb0,0x0e,0xff,0xff,0xea,0xbf,0xff,0xff,0xf4,0x5f,0xff,0xfb,0xaf,0x1a,
-0x10,0xf4,0xb4,0x0c,0x00,0x30,0x00,0x00,0xe2,0x18,0x00,0x08,0x00,0x01,0xfc,0x18,
-0x10,0x4f,0x66,0x02,0x19,0x80,0x10,0x00,0x12,0xdf,0x9a,0x11,0x23,0xf4,0x9f,0x30,
-0x00,0x03,0x2e,0x23,0x00,0x50,0x00,0x10,0xda,0x50,0x00,0x05,0x53,0x09,0x10,0x6f,
-0x40,0x0f,0x00,0xf3,0x18,0x61,0x9e,0xfe,0xb3,0x0d,0xff,0xf4,0x5b,0x1e,0x14,0xa4,
-0xc1,0x0b,0x13,0xa0,0xc0,0x0b,0x01,0x98,0x0f,0x60,0xeb,0xbe,0xff,0xff,0x60,0x1f,
-0x88,0x01,0x10,0xbf,0x5b,0x1e,0x10,0xf3,0xc2,0x02,0x11,0xf2,0x4f,0x04,0x33,0x1f,
-0xff,0xf5,0x3c,0x19,0x2a,0xf6,0xdf,0x07,0x05,0x14,0xf7,0x7f,0x23,0x02,0x1a,0x15,
-0x30,0x10,0x00,0x2f,0xc6,0x17,0x20,0x03,0xda,0x5f,0x00,0x20,0xfc,0xaa,0x66,0x06,
-0x13,0xbf,0xdf,0x0e,0x12,0x09,0x4f,0x01,0x00,0xc0,0x17,0x11,0xfe,0xce,0x26,0x43,
-0x02,0x9d,0xff,0xd5,0x02,0x08,0x10,0x03,0x63,0x01,0x00,0xe3,0x07,0x20,0xeb,0xa4,
-0x51,0x13,0x14,0x00,0x2d,0x24,0x01,0x06,0x00,0x01,0x31,0x03,0x18,0xd0,0x06,0x00,
-0x68,0x24,0x4f,0xff,0xfa,0x44,0x30,0x24,0x00,0x0f,0x06,0x00,0x30,0x51,0x01,0x8d,
-0xff,0xc7,0x09,0x69,0x02,0x00,0x0c,0x19,0x23,0xf8,0x03,0xfe,0x14,0x12,0x0d,0xb9,
-0x25,0x21,0xf8,0x4f,0xbb,0x1f,0x00,0x14,0x10,0x11,0xf3,0x32,0x00,0x12,0xcf,0xd3,
-0x28,0x10,0xf8,0x49,0x07,0x00,0x08,0x00,0x01,0x98,0x01,0x07,0x10,0x00,0x04,0x20,
-0x00,0x04,0x30,0x00,0x00,0xe0,0x02,0x00,0x40,0x00,0x12,0x0c,0xe0,0x02,0x05,0x60,
-0x00,0x21,0x00,0x4e,0x52,0x12,0x10,0xf8,0x80,0x00,0x11,0xc6,0xbe,0x25,0x03,0x32,
-0x05,0x50,0x6c,0x20,0x00,0x02,0xdf,0x96,0x09,0x74,0xfc,0x88,0xaf,0xff,0xff,0x90,
-0x0a,0x92,0x12,0x12,0x8f,0x43,0x18,0x00,0x50,0x04,0x26,0xec,0x83,0x17,0x21,0x0f,
-0x08,0x00,0x20,0x42,0x19,0xdf,0xec,0x60,0x26,0x10,0x24,0xff,0xfa,0x14,0x0d,0x70,
-0x60,0x6f,0xff,0xff,0xea,0xbe,0xff,0x00,0x02,0x10,0xfa,0x1c,0x02,0x11,0xf0,0x30,
-0x00,0x10,0x6f,0x20,0x0d,0x10,0xf2,0x98,0x00,0x1f,0xf3,0x08,0x00,0x3d,0xe2,0x05,
-0xef,0xa1,0x2f,0xff,0xf9,0x3f,0xff,0xfb,0x0e,0xff,0xf6,0x01,0x78,0x28,0x08,0x00,
-0x30,0x01,0x0f,0x03,0x00,0x1d,0x42,0x00,0x00,0x6e,0xfa,0x2e,0x25,0x01,0x23,0x2d,
-0x10,0x1e,0x8f,0x02,0x27,0x18,0x84,0xe3,0x1c,0x01,0x24,0x00,0x00,0x46,0x03,0x0f,
-0x09,0x00,0x33,0x10,0x70,0x57,0x11,0x22,0x5b,0xbf,0x17,0x26,0x95,0xb0,0x7f,0xff,
-0xff,0xd1,0x06,0xef,0xfc,0x70,0xf2,0x03,0x14,0x04,0x8f,0x08,0x0f,0x11,0x00,0x1b,
-0x00,0xad,0x08,0x40,0x70,0x4f,0xff,0xf4,0xcf,0x08,0x10,0x90,0x11,0x00,0x12,0x0a,
-0xeb,0x13,0x50,0xf4,0x08,0xff,0xff,0xc0,0x22,0x00,0x10,0x45,0xbf,0x13,0x00,0xf1,
-0x0e,0x13,0xff,0xdd,0x23,0x01,0x36,0x0d,0x02,0x8e,0x05,0x13,0x10,0x11,0x00,0x14,
-0xfb,0x11,0x00,0x11,0xf6,0x11,0x00,0x22,0xf9,0xef,0x23,0x04,0x01,0x63,0x21,0x13,
-0x00,0x55,0x00,0x10,0x60,0x77,0x00,0x00,0x6e,0x00,0x11,0x10,0x77,0x00,0x32,0x6f,
-0xff,0xfb,0x88,0x00,0x31,0xbf,0xff,0xf6,0x11,0x00,0x20,0x02,0xff,0x2f,0x24,0x1f,
-0xf8,0x03,0x00,0x32,0xd0,0x4f,0xff,0xf0,0x18,0xdf,0xfc,0x70,0x00,0x4a,0xef,0xeb,
-0x40,0x04,0x33,0x15,0x51,0xff,0xff,0xb0,0xaf,0xff,0xe9,0x00,0x06,0x4d,0x1a,0xd0,
-0x34,0xff,0xff,0xfe,0xbb,0xef,0xff,0xff,0xfe,0xab,0xff,0xff,0xf9,0x2d,0x03,0x40,
-0x01,0xdf,0xff,0xfb,0xda,0x06,0x10,0xc4,0x8f,0x00,0x10,0x08,0xa9,0x07,0x12,0x0a,
-0x36,0x06,0x00,0x92,0x0d,0x03,0xcc,0x12,0x01,0x30,0x1c,0x01,0xf4,0x1d,0x0f,0x19,
-0x00,0x5d,0x40,0xf0,0x5f,0xff,0xe0,0x52,0x07,0x00,0xb8,0x0d,0x01,0x98,0x03,0x13,
-0x5f,0x70,0x07,0x13,0x5f,0x40,0x03,0x01,0xa1,0x0a,0x01,0xb6,0x12,0x02,0x40,0x03,
-0x13,0x5f,0xf0,0x02,0x0f,0x08,0x00,0x3d,0x00,0x48,0x29,0x01,0xd0,0x05,0x21,0x01,
-0xbf,0xb3,0x21,0x00,0x05,0x06,0x02,0xea,0x29,0xb1,0xaf,0xff,0xfe,0xaa,0xef,0xff,
-0xfc,0x00,0x2f,0xff,0xfb,0x35,0x11,0x00,0xdc,0x09,0x00,0x51,0x01,0x10,0xa0,0x39,
-0x0a,0x00,0x3c,0x2a,0x02,0x08,0x07,0x10,0x8f,0x0c,0x14,0x11,0x80,0xc9,0x0c,0x05,
-0x11,0x00,0x12,0xcf,0x2f,0x1d,0x24,0xfe,0x09,0x33,0x00,0x12,0x3f,0xbb,0x0d,0x33,
-0xf4,0x00,0xbf,0x55,0x00,0x23,0x01,0xef,0x66,0x00,0x01,0xa3,0x1d,0x01,0x6d,0x21,
-0x12,0x4a,0xf9,0x2a,0x5e,0x4f,0xff,0xf0,0x4b,0xef,0x29,0x08,0x22,0x50,0x4f,0x49,
-0x05,0x00,0x29,0x08,0x00,0x8f,0x00,0x11,0xf5,0x4e,0x01,0x13,0x1f,0x29,0x08,0x1b,
-0x0c,0x29,0x08,0x04,0x6e,0x01,0x04,0xf3,0x01,0x04,0x20,0x00,0x10,0x1f,0x1c,0x02,
-0x00,0x8b,0x00,0x00,0x40,0x00,0x22,0xff,0xea,0x79,0x08,0x02,0xe7,0x11,0x02,0x70,
-0x00,0x13,0xf6,0xa9,0x08,0x1f,0x20,0xa4,0x07,0x1e,0x00,0xa1,0x07,0x41,0xb4,0x0c,
-0xff,0xf4,0xfd,0x17,0x1a,0x9e,0xa1,0x07,0x52,0xae,0xff,0xff,0xf4,0x6f,0xd1,0x01,
-0x0f,0xa1,0x07,0x16,0x1f,0xcf,0xa1,0x07,0x01,0x12,0xcf,0xa1,0x07,0x1c,0xae,0xa1,
-0x07,0x10,0xbf,0xa1,0x07,0x3f,0xae,0xfe,0xb3,0x59,0x08,0x20,0xb1,0x4f,0xff,0xf0,
-0x4c,0xff,0x44,0xff,0xff,0x7f,0xff,0xf4,0x0b,0x01,0x11,0x44,0x51,0x0d,0x61,0x4f,
-0xff,0xff,0xd7,0x66,0x14,0xe1,0x07,0x01,0x2c,0x00,0x02,0x6e,0x04,0x0f,0x0b,0x00,
-0x1e,0x15,0x00,0xa7,0x2b,0x13,0x0a,0xfa,0x26,0x02,0xcf,0x07,0x00,0xc8,0x03,0x62,
-0xa4,0x37,0xff,0xff,0xd0,0x08,0x64,0x0f,0x20,0xf2,0x08,0x45,0x09,0x84,0x15,0x55,
-0x51,0x05,0xff,0xff,0xd7,0x30,0x3f,0x0f,0x14,0xb6,0x67,0x08,0x10,0xe6,0xf7,0x07,
-0x23,0xcf,0xff,0x2f,0x0c,0x11,0x4a,0x3d,0x28,0x11,0x92,0xa4,0x28,0x00,0x4e,0x05,
-0x00,0x29,0x0b,0xa3,0x09,0xff,0xff,0x94,0x35,0xdf,0xff,0xf0,0x01,0xdf,0xe8,0x16,
-0x14,0x1b,0x0c,0x17,0x12,0x49,0x12,0x27,0x01,0x30,0x06,0x11,0x06,0xb0,0x0b,0x06,
-0x0b,0x00,0x01,0x2d,0x00,0x11,0x0d,0x8e,0x28,0x01,0x0b,0x00,0x6e,0x03,0x48,0xff,
-0xff,0x54,0x40,0x2c,0x00,0x0f,0x0b,0x00,0x08,0x00,0x78,0x11,0x00,0x80,0x08,0x41,
-0xfb,0xb2,0x00,0x0e,0xd4,0x0f,0x11,0x5f,0x5a,0x05,0x4f,0x4b,0xef,0xec,0x20,0xeb,
-0x06,0x3d,0x06,0xbb,0x03,0x11,0xf3,0x08,0x00,0x12,0x3f,0x12,0x02,0x22,0xf3,0x0f,
-0xb3,0x09,0x24,0xf3,0x09,0xb8,0x15,0x11,0xcf,0x23,0x0a,0x91,0xf3,0x00,0x07,0xcf,
-0xfe,0xa4,0x0f,0xff,0xf3,0x72,0x02,0x10,0x0e,0xa1,0x0a,0x11,0xf5,0x69,0x25,0x00,
-0xa7,0x03,0x00,0x30,0x0c,0x01,0x60,0x0d,0x10,0xcf,0xff,0x2f,0x30,0xff,0x20,0x01,
-0x34,0x01,0x11,0xef,0xef,0x0b,0x00,0x47,0x0b,0x22,0xb0,0x09,0x58,0x19,0x21,0xf0,
-0x0e,0xae,0x2a,0x00,0x92,0x13,0x10,0xf1,0x8c,0x01,0x22,0xf9,0x7f,0x3f,0x16,0x21,
-0xfd,0xbf,0x8b,0x01,0x13,0xef,0xe4,0x10,0x13,0x9f,0x95,0x11,0x13,0x4f,0x97,0x12,
-0x13,0x0e,0x02,0x10,0x13,0x09,0x2a,0x0f,0x02,0x20,0x13,0x10,0x7f,0xe0,0x2b,0x21,
-0xff,0xf8,0x09,0x00,0x00,0x50,0x00,0x10,0x05,0xca,0x03,0x10,0xaf,0x60,0x10,0x12,
-0xf4,0x7c,0x23,0x10,0xdf,0xa7,0x0c,0x10,0xf8,0x3e,0x00,0x10,0x50,0xca,0x12,0x30,
-0x06,0xff,0xfb,0x32,0x11,0x21,0xa0,0x04,0xed,0x10,0x10,0xfe,0x59,0x03,0x40,0xe0,
-0x07,0xff,0xf9,0x77,0x00,0x80,0x10,0xcf,0xfd,0xff,0xf3,0x0b,0xff,0xf5,0x40,0x00,
-0x80,0x51,0xff,0xf5,0xef,0xf8,0x0e,0xff,0xf1,0x97,0x01,0x80,0x85,0xff,0xf1,0x9f,
-0xfd,0x1f,0xff,0xd0,0x82,0x0e,0x80,0xba,0xff,0xc0,0x5f,0xff,0x7f,0xff,0x90,0x8f,
-0x00,0x82,0xee,0xff,0x70,0x0f,0xff,0xef,0xff,0x50,0x88,0x02,0x22,0x20,0x0b,0xb8,
-0x00,0x10,0x06,0xc5,0x1f,0x12,0x06,0x2b,0x33,0x13,0x02,0xe3,0x19,0x01,0xdb,0x0b,
-0x01,0x04,0x12,0x12,0xdf,0x77,0x0e,0x01,0x21,0x1e,0x12,0x8f,0xd0,0x00,0x10,0x6f,
-0x10,0x03,0x11,0x3f,0x5f,0x00,0x00,0xdf,0x08,0x00,0xf2,0x0b,0x30,0x9f,0xff,0xf3,
-0x0e,0x14,0x00,0xd1,0x04,0x10,0xc0,0xf3,0x28,0x00,0x08,0x05,0x10,0x51,0x45,0x11,
-0x00,0x74,0x26,0x01,0xbd,0x09,0x01,0xc2,0x04,0x18,0xfa,0x13,0x12,0x23,0x02,0xff,
-0x4a,0x0c,0x13,0x0d,0xb1,0x12,0x14,0x05,0x51,0x1c,0x13,0xef,0x1e,0x18,0x30,0x7f,
-0xff,0xfe,0x96,0x00,0x00,0x93,0x11,0x12,0x5f,0x41,0x32,0x51,0xff,0x20,0xcf,0xff,
-0xe1,0x83,0x14,0x00,0x87,0x14,0x00,0x1a,0x06,0x00,0x15,0x00,0x22,0x30,0x6f,0xb0,
-0x2f,0x32,0xfc,0x00,0xcf,0x59,0x32,0x20,0xfd,0x06,0xb8,0x0f,0x00,0xb8,0x2a,0x00,
-0x78,0x23,0x00,0x5f,0x25,0x00,0xa4,0x22,0x00,0xe1,0x24,0x00,0x65,0x00,0x11,0x40,
-0x1a,0x0e,0x00,0x00,0x02,0x12,0x7f,0x87,0x06,0x41,0xd0,0x0c,0xff,0xfa,0xbf,0x02,
-0x13,0x21,0x50,0x2e,0x10,0xf7,0x91,0x1c,0x00,0xf0,0x00,0x33,0xcb,0xff,0xf9,0xaa,
-0x00,0x03,0x84,0x27,0x03,0xdd,0x2d,0x13,0x6f,0x99,0x14,0x14,0x01,0xf9,0x11,0x14,
-0x0b,0x95,0x14,0x04,0x41,0x2f,0x14,0x02,0xf8,0x12,0x13,0x7f,0x27,0x11,0x12,0x2e,
-0x15,0x02,0x22,0x1a,0xcf,0xd0,0x0f,0x14,0x02,0xc8,0x03,0x13,0x2f,0xa7,0x11,0x43,
-0x01,0xdf,0xec,0x50,0x17,0x10,0x01,0x01,0x00,0x13,0x09,0x21,0x2c,0x12,0x9f,0xea,
-0x18,0x40,0x05,0x99,0x99,0x99,0xb5,0x2a,0x02,0x5f,0x10,0x12,0x80,0x4f,0x02,0x12,
-0xc0,0xbc,0x11,0x12,0xe2,0x65,0x10,0x17,0xf5,0xb9,0x11,0x01,0x20,0x06,0x05,0xb6,
-0x11,0x12,0x0c,0xc7,0x10,0x12,0x08,0x6b,0x00,0x00,0xce,0x30,0x43,0x99,0x99,0x99,
-0x91,0x7d,0x0c,0x1a,0x3d,0x3e,0x12,0x10,0x30,0x54,0x00,0x11,0x73,0x2e,0x00,0x13,
-0x90,0xe2,0x10,0x10,0x07,0xb6,0x0b,0x01,0x80,0x35,0x02,0x89,0x0f,0x13,0x06,0x93,
-0x18,0x10,0x90,0x1b,0x00,0x1a,0xf9,0x0b,0x00,0x10,0x9f,0x5b,0x12,0x01,0x22,0x0d,
-0x10,0x5c,0xbc,0x01,0x10,0x4f,0x46,0x37,0x02,0x86,0x26,0x00,0x01,0x1f,0x00,0x3e,
-0x2a,0x11,0xfe,0xf3,0x01,0x11,0xf5,0x2c,0x00,0x1e,0x80,0x42,0x00,0x02,0x0b,0x00,
-0x00,0xf6,0x02,0x00,0x65,0x02,0x11,0xe0,0x62,0x0e,0x11,0x40,0x23,0x15,0x14,0x40,
-0xf4,0x2c,0x21,0x04,0xdf,0xbf,0x12,0x4f,0x41,0x00,0x4f,0xf7,0x02,0x00,0x1f,0x41,
-0x2a,0xa4,0x07,0x50,0x3a,0x34,0x13,0x30,0xb8,0x11,0x11,0x06,0xaa,0x01,0x12,0xaf,
-0x79,0x06,0x01,0x10,0x14,0x01,0x07,0x2c,0x0e,0x05,0x00,0x30,0x0e,0xff,0xf2,0x11,
-0x01,0x11,0xf7,0x42,0x01,0x11,0x83,0x7f,0x14,0x00,0xdd,0x03,0x12,0xfd,0xd2,0x1f,
-0x10,0x06,0x60,0x2e,0x10,0x0c,0xd8,0x00,0x12,0x0f,0x85,0x02,0x0e,0x41,0x00,0x01,
-0x52,0x2f,0x10,0x5f,0x64,0x00,0x00,0x39,0x04,0x11,0x19,0x20,0x01,0x00,0xbd,0x01,
-0x20,0x0e,0xfa,0x75,0x0a,0x11,0x10,0x24,0x12,0x71,0xcf,0xeb,0x40,0x00,0x00,0x27,
-0x77,0xa2,0x03,0x10,0x80,0x7c,0x33,0x11,0x06,0x25,0x2d,0x20,0x01,0xdf,0x9e,0x36,
-0x50,0xcb,0xff,0xff,0xeb,0xef,0xf2,0x1e,0x11,0x90,0x50,0x0f,0x20,0xf1,0x04,0x47,
-0x31,0x10,0xbf,0xbb,0x20,0x62,0x26,0x66,0x00,0x00,0x00,0x6c,0xe4,0x22,0x51,0x33,
-0x10,0x00,0x00,0x4e,0xc3,0x0f,0x00,0x12,0x1f,0xf0,0x07,0xfd,0x20,0x9f,0xf2,0x0f,
-0xf5,0x00,0x0f,0xf5,0x0f,0xf6,0x00,0x0f,0xf5,0x0a,0xff,0x75,0xcf,0xf1,0x01,0xef,
-0xff,0x80,0x00,0x42,0xef,0xc4,0x00,0x0a,0x0a,0x14,0x11,0x1f,0xbf,0x03,0x23,0xff,
-0x30,0x81,0x2e,0x02,0x2c,0x15,0x10,0x4f,0xae,0x00,0x01,0xc1,0x0c,0x10,0x06,0xb4,
-0x01,0x00,0xde,0x1a,0x00,0x5f,0x02,0x11,0xc0,0x92,0x01,0x52,0xf2,0x00,0x0c,0xff,
-0xf8,0xad,0x02,0x21,0xd0,0x01,0x3a,0x00,0x10,0xcf,0x6e,0x00,0x12,0xaf,0x82,0x21,
-0x10,0xfb,0x8c,0x07,0x11,0xe2,0xe7,0x01,0x11,0x0c,0x44,0x1b,0x00,0x58,0x00,0x00,
-0xea,0x02,0x11,0xf4,0x3c,0x03,0x22,0xb0,0x00,0x19,0x28,0x00,0x29,0x0e,0x03,0x50,
-0x14,0x31,0xdf,0xff,0x50,0x57,0x00,0x00,0x2a,0x01,0x13,0xf3,0x77,0x14,0x11,0x03,
-0x7f,0x18,0x00,0xcc,0x39,0x03,0xfe,0x34,0x11,0x0a,0xc2,0x11,0x14,0xfa,0xd9,0x02,
-0x34,0xdf,0xff,0x70,0xdf,0x14,0x15,0x0f,0xa0,0x27,0x05,0x08,0x1e,0x15,0x0f,0xa2,
-0x20,0x22,0xcc,0xcc,0xe3,0x1d,0x04,0x65,0x1c,0x15,0xfc,0x7d,0x24,0x2a,0xf0,0x00,
-0x76,0x2f,0x00,0xb3,0x17,0x05,0x88,0x29,0x1f,0x40,0x13,0x00,0x26,0x31,0x08,0xcc,
-0xcc,0x17,0x29,0x34,0xfd,0xc4,0xbf,0x10,0x1b,0x14,0x5b,0x09,0x00,0x15,0xf5,0x13,
-0x00,0x51,0x50,0x00,0x8f,0xff,0xec,0x0c,0x28,0x03,0x09,0x05,0x12,0x8f,0x7e,0x03,
-0x59,0x06,0xcc,0xef,0xff,0xfa,0xa1,0x00,0x12,0xef,0x66,0x00,0x13,0x0a,0x0d,0x19,
-0x12,0x5f,0x6b,0x04,0x12,0x01,0x68,0x29,0x12,0x16,0x5a,0x29,0x12,0x7f,0x5c,0x1d,
-0x12,0x8f,0xba,0x0c,0x12,0x3f,0x36,0x2f,0x11,0x09,0x91,0x1e,0x00,0x17,0x3b,0x10,
-0x50,0xb8,0x02,0x00,0x88,0x18,0x10,0x8f,0xed,0x18,0x00,0x93,0x13,0x00,0xf4,0x19,
-0x30,0x90,0x00,0x0f,0x18,0x19,0x00,0xa9,0x13,0x00,0x14,0x13,0x03,0xc4,0x1e,0x0e,
-0x09,0x00,0x13,0x4c,0xd0,0x00,0x35,0xc9,0x00,0x00,0xbd,0x03,0x0f,0x09,0x00,0x69,
-0x11,0xaf,0x75,0x39,0x13,0x82,0x82,0x32,0x00,0xd6,0x04,0x14,0xaf,0xbf,0x1d,0x13,
-0x7c,0xee,0x01,0x02,0x98,0x01,0x14,0x18,0x2d,0x2b,0x00,0xe5,0x39,0x04,0x3e,0x29,
+0x12,0xcf,0x77,0x02,0x13,0x06,0x89,0x02,0x13,0x1f,0xf8,0x00,0x12,0xaf,0xa2,0x04,
+0x11,0x04,0x2c,0x02,0x00,0x60,0x02,0x23,0xfb,0x00,0xfe,0x01,0x12,0x00,0x47,0x02,
+0x12,0x80,0xc1,0x04,0x13,0xfe,0x48,0x01,0x13,0xf4,0x9b,0x04,0x13,0xa0,0xa1,0x01,
+0x12,0x10,0x1a,0x01,0x02,0xf2,0x02,0x03,0xd0,0x04,0x04,0x64,0x00,0x13,0x0f,0x64,
+0x00,0x02,0x25,0x05,0x00,0x63,0x01,0x12,0x60,0x64,0x00,0x1f,0xfc,0x64,0x00,0x01,
+0x12,0x0a,0x64,0x00,0x00,0xd0,0x04,0x03,0x64,0x00,0x11,0xb0,0x9a,0x00,0x80,0x88,
+0x87,0x00,0x57,0x77,0x77,0x6c,0xff,0x30,0x03,0x50,0xff,0xfc,0xff,0xff,0xff,0x50,
+0x00,0x1f,0x09,0x07,0x00,0x3c,0x47,0x57,0xcf,0xff,0xfc,0x62,0x00,0x22,0x00,0x0d,
+0xca,0x00,0x12,0x4f,0xf0,0x00,0x11,0xbf,0x16,0x01,0x12,0x02,0xfd,0x02,0x50,0x08,
+0xff,0xcc,0xff,0x80,0x16,0x03,0x30,0x66,0xff,0xe0,0x93,0x04,0x10,0x00,0x28,0x02,
+0xf2,0x0d,0xdf,0xfa,0x00,0xaf,0xfd,0x00,0x04,0xff,0xf3,0x00,0x3f,0xff,0x30,0x0a,
+0xff,0xd0,0x00,0x0d,0xff,0xa0,0x1f,0xff,0x70,0x00,0x07,0xff,0xf1,0x77,0x01,0x00,
+0x13,0x1f,0xb5,0x06,0x03,0x10,0x02,0x13,0x4f,0x0f,0x00,0x80,0x0a,0xcc,0xcb,0x00,
+0x00,0x2e,0xff,0xf9,0xbe,0x02,0x10,0xf3,0x71,0x00,0x10,0xd0,0x66,0x01,0x71,0x80,
+0x00,0x02,0x7c,0xef,0xfc,0x82,0xa0,0x02,0x10,0xff,0xc5,0x02,0x02,0x95,0x08,0x10,
+0xf6,0xe3,0x02,0x81,0x65,0x8f,0xff,0xfe,0x00,0x7f,0xff,0xf1,0x67,0x01,0x51,0x01,
+0x11,0x10,0x00,0x02,0x58,0x01,0x30,0x36,0x89,0x9a,0x08,0x00,0x11,0x6e,0x29,0x00,
+0x32,0x60,0x0a,0xff,0x08,0x00,0x40,0x5f,0xff,0xfb,0x31,0x89,0x06,0x31,0xbf,0xff,
+0xd0,0x91,0x06,0x33,0xef,0xff,0x90,0x08,0x00,0x11,0xd0,0x1a,0x04,0x92,0xaf,0xff,
+0xfc,0x77,0xdf,0xff,0xff,0x60,0x3f,0x30,0x00,0x10,0x70,0xd2,0x04,0x10,0xfd,0x25,
+0x00,0x83,0x29,0xdf,0xfc,0x70,0xaf,0xff,0xe0,0x4f,0xf1,0x01,0x0f,0x08,0x00,0x20,
+0x81,0x3a,0xef,0xea,0x30,0x00,0x4f,0xff,0xfa,0xb5,0x0a,0x13,0x4f,0x90,0x00,0x60,
+0x4f,0xff,0xff,0xfb,0xad,0xff,0x58,0x00,0x20,0xfc,0x10,0x47,0x0a,0x12,0x4f,0x40,
+0x06,0x11,0xfa,0x08,0x00,0x31,0x0b,0xff,0xfd,0x08,0x00,0x30,0x09,0xff,0xfe,0x08,
+0x00,0x00,0x5f,0x02,0x09,0x10,0x00,0x03,0x20,0x00,0x00,0x6b,0x07,0x06,0x40,0x00,
+0x66,0xff,0xfa,0xad,0xff,0xff,0xf0,0x60,0x00,0x10,0xf8,0x4c,0x07,0x00,0x48,0x01,
+0x30,0x4b,0xef,0xea,0x86,0x02,0x50,0x5b,0xef,0xfd,0x92,0x00,0xec,0x09,0x00,0x17,
+0x00,0x31,0x02,0xef,0xff,0x08,0x00,0xa0,0xcf,0xff,0xfd,0xab,0xff,0xff,0xf2,0x4f,
+0xff,0xf9,0x96,0x02,0x30,0x89,0xff,0xfe,0x65,0x00,0x20,0xfb,0xdf,0x72,0x02,0x33,
+0x37,0x77,0x5e,0xb7,0x02,0x03,0x98,0x02,0x13,0x0e,0x0f,0x00,0x01,0x1e,0x00,0x01,
+0x8d,0x00,0x00,0x9a,0x00,0x22,0xfc,0x4f,0x4f,0x00,0x84,0x90,0xcf,0xff,0xfd,0x9b,
+0xff,0xff,0xf2,0x5a,0x00,0x01,0x69,0x00,0x11,0xf7,0x78,0x00,0x23,0xed,0x82,0xb4,
+0x07,0x0f,0x45,0x01,0x21,0x40,0x03,0xae,0xfe,0xa3,0x08,0x00,0x00,0x69,0x0a,0x43,
+0xaf,0xff,0xf4,0x05,0x2f,0x02,0x80,0x0e,0xff,0xff,0xea,0xbf,0xff,0xff,0xf4,0xd1,
+0x04,0x71,0x01,0xdf,0xff,0xf4,0xaf,0xff,0xf1,0x30,0x00,0x31,0xdf,0xff,0xc0,0x08,
+0x00,0x00,0xbb,0x01,0x00,0x08,0x00,0x01,0xbc,0x00,0x07,0x10,0x00,0x00,0xbd,0x00,
+0x00,0x08,0x00,0x13,0x9f,0x30,0x00,0x30,0x5f,0xff,0xfa,0x40,0x00,0x00,0x50,0x00,
+0x10,0xda,0x50,0x00,0x05,0x53,0x09,0x20,0x6f,0xff,0x95,0x07,0x70,0xf4,0x00,0x02,
+0x9e,0xfe,0xb3,0x0d,0x90,0x00,0x44,0x39,0xdf,0xfd,0xa4,0xc1,0x0b,0x13,0xa0,0xc0,
+0x0b,0x10,0xfb,0x9b,0x01,0x60,0xeb,0xbe,0xff,0xff,0x60,0x1f,0x88,0x01,0x60,0xbf,
+0xff,0xd0,0x6f,0xff,0xf3,0xc2,0x02,0x11,0xf2,0x4f,0x04,0x52,0x1f,0xff,0xf5,0xcf,
+0xff,0xb1,0x02,0x1a,0xdf,0x07,0x05,0x23,0xf7,0xbf,0x66,0x05,0x11,0x7f,0xeb,0x00,
+0x10,0x10,0x54,0x05,0x40,0x40,0x00,0x03,0xda,0x5f,0x00,0x20,0xfc,0xaa,0x66,0x06,
+0x22,0xbf,0xff,0x69,0x00,0x23,0x09,0xff,0x14,0x09,0x50,0x28,0xce,0xfe,0xc7,0x20,
+0x7e,0x03,0x33,0x9d,0xff,0xd5,0x02,0x08,0x10,0x03,0x63,0x01,0x00,0xe3,0x07,0x61,
+0xeb,0xa4,0x00,0x0e,0xff,0xfd,0x6a,0x04,0x14,0xf8,0x06,0x00,0x01,0x31,0x03,0x18,
+0xd0,0x06,0x00,0x68,0x24,0x4f,0xff,0xfa,0x44,0x30,0x24,0x00,0x0f,0x06,0x00,0x30,
+0x71,0x01,0x8d,0xff,0xc7,0x09,0xff,0xf8,0xd9,0x02,0x42,0xdd,0xff,0xf8,0x03,0xe0,
+0x00,0xf1,0x05,0xf8,0x0d,0xff,0xff,0xfb,0xae,0xff,0xff,0xf8,0x4f,0xff,0xfd,0x10,
+0x00,0x8f,0xff,0xf8,0x9f,0xff,0xf3,0x32,0x00,0x00,0x1a,0x05,0x00,0x08,0x00,0x00,
+0x49,0x07,0x00,0x08,0x00,0x01,0x98,0x01,0x07,0x10,0x00,0x04,0x20,0x00,0x04,0x30,
+0x00,0x00,0xe0,0x02,0x00,0x40,0x00,0x12,0x0c,0xe0,0x02,0x05,0x60,0x00,0x80,0x00,
+0x4e,0xff,0xff,0xff,0xbf,0xff,0xf8,0x80,0x00,0x45,0xc6,0x1f,0xff,0xf7,0x32,0x05,
+0x50,0x6c,0x20,0x00,0x02,0xdf,0x96,0x09,0x73,0xfc,0x88,0xaf,0xff,0xff,0x90,0x0a,
+0x67,0x0d,0x02,0x0f,0x01,0x20,0xa1,0x00,0x50,0x04,0x20,0xec,0x83,0x40,0x01,0x01,
+0x74,0x05,0x0f,0x08,0x00,0x21,0x81,0x19,0xdf,0xec,0x60,0x00,0x6f,0xff,0xf6,0x3d,
+0x0e,0x13,0x6f,0x70,0x03,0x60,0x6f,0xff,0xff,0xea,0xbe,0xff,0x00,0x02,0x10,0xfa,
+0x1c,0x02,0x11,0xf0,0x30,0x00,0x10,0x6f,0x20,0x0d,0x10,0xf2,0x98,0x00,0x1f,0xf3,
+0x08,0x00,0x3d,0xe2,0x05,0xef,0xa1,0x2f,0xff,0xf9,0x3f,0xff,0xfb,0x0e,0xff,0xf6,
+0x01,0x78,0x28,0x08,0x00,0x30,0x01,0x0f,0x03,0x00,0x1d,0x40,0x00,0x00,0x6e,0xfa,
+0xb1,0x02,0x30,0xf7,0x00,0x05,0x6e,0x02,0x10,0x1e,0x8f,0x02,0x23,0x18,0x84,0xb0,
+0x03,0x03,0x54,0x00,0x02,0x02,0x04,0x0f,0x09,0x00,0x33,0xf0,0x08,0x70,0x00,0x5f,
+0xff,0xf6,0x5b,0xbf,0xff,0xff,0x27,0xff,0xff,0xff,0xb0,0x7f,0xff,0xff,0xd1,0x06,
+0xef,0xfc,0x70,0x00,0x40,0x4f,0xff,0xf4,0x00,0x01,0x00,0x41,0x04,0xff,0xff,0x40,
+0x09,0x00,0x0f,0x11,0x00,0x1c,0x40,0x1e,0xff,0xff,0x70,0x11,0x00,0x40,0x0c,0xff,
+0xff,0x90,0x11,0x00,0x40,0x0a,0xff,0xff,0xb0,0x22,0x00,0x40,0x08,0xff,0xff,0xc0,
+0x22,0x00,0x40,0x45,0xff,0xff,0xe1,0x33,0x00,0x41,0xf7,0xff,0xff,0xf3,0x33,0x00,
+0x11,0xff,0x3e,0x00,0x10,0x4f,0x09,0x00,0x13,0x10,0x11,0x00,0x14,0xfb,0x11,0x00,
+0x11,0xf6,0x11,0x00,0x40,0xf9,0xef,0xff,0xf1,0x11,0x00,0x20,0xf9,0x04,0x4c,0x00,
+0x03,0x55,0x00,0x10,0x60,0x77,0x00,0x00,0x6e,0x00,0x11,0x10,0x77,0x00,0x32,0x6f,
+0xff,0xfb,0x88,0x00,0x31,0xbf,0xff,0xf6,0x11,0x00,0x7f,0x02,0xff,0xff,0xf1,0x0f,
+0xff,0xf8,0x03,0x00,0x32,0xf1,0x07,0x4f,0xff,0xf0,0x18,0xdf,0xfc,0x70,0x00,0x4a,
+0xef,0xeb,0x40,0x04,0xff,0xff,0x6f,0xff,0xff,0xff,0xb0,0xaf,0xff,0xe9,0x00,0x01,
+0x01,0x00,0x10,0xdf,0x05,0x00,0xf0,0x0b,0x34,0xff,0xff,0xfe,0xbb,0xef,0xff,0xff,
+0xfe,0xab,0xff,0xff,0xf9,0x4f,0xff,0xfc,0x10,0x01,0xdf,0xff,0xfb,0x00,0x01,0xff,
+0xff,0xc4,0x8f,0x00,0x81,0x08,0xff,0xff,0x20,0x00,0x0a,0xff,0xfe,0xa4,0x00,0x10,
+0x6f,0xd0,0x00,0x30,0x9f,0xff,0xf4,0x19,0x00,0x10,0x06,0xf7,0x00,0x3f,0x09,0xff,
+0xff,0x19,0x00,0x5d,0x50,0xf0,0x5f,0xff,0xe0,0x29,0xd5,0x00,0x92,0x5f,0xff,0xf5,
+0xff,0xff,0xff,0xfc,0x00,0x5f,0xcc,0x00,0xa0,0x70,0x5f,0xff,0xff,0xea,0xbe,0xff,
+0xff,0xd0,0x5f,0x87,0x01,0x60,0xcf,0xff,0xf1,0x5f,0xff,0xf2,0x35,0x00,0x11,0xf2,
+0x08,0x00,0x3f,0x4f,0xff,0xf3,0x08,0x00,0x3d,0xb0,0x00,0x00,0x4a,0xdf,0xfd,0xa4,
+0x00,0x00,0x00,0x01,0xbf,0x88,0x00,0x31,0x10,0x00,0x01,0x4f,0x01,0xc0,0xfe,0x10,
+0x00,0xaf,0xff,0xfe,0xaa,0xef,0xff,0xfc,0x00,0x2f,0x8a,0x00,0x11,0xbf,0x43,0x02,
+0x10,0x10,0x51,0x01,0xf5,0x0b,0xa0,0xcf,0xff,0xc0,0x00,0x00,0x0a,0xff,0xfd,0x0e,
+0xff,0xf9,0x00,0x00,0x00,0x8f,0xff,0xf0,0xff,0xff,0x80,0x00,0x00,0x07,0xff,0xff,
+0x11,0x00,0x94,0xcf,0xff,0xb0,0x00,0x00,0x0b,0xff,0xfe,0x09,0x33,0x00,0x10,0x3f,
+0x44,0x00,0x53,0xaf,0xff,0xf4,0x00,0xbf,0x55,0x00,0x23,0x01,0xef,0x66,0x00,0x20,
+0x01,0xcf,0x77,0x00,0x20,0x20,0x00,0x88,0x00,0x21,0xfe,0xa5,0x7a,0x02,0xe3,0xf0,
+0x4b,0xef,0xea,0x30,0x00,0x4f,0xff,0xfa,0xff,0xff,0xff,0xf7,0x00,0xe5,0x01,0xc0,
+0x50,0x4f,0xff,0xff,0xfb,0xae,0xff,0xff,0xe0,0x4f,0xff,0xfc,0x8f,0x00,0x11,0xf5,
+0x4e,0x01,0x31,0x1f,0xff,0xfa,0x08,0x00,0x31,0x0c,0xff,0xfd,0x08,0x00,0x13,0x09,
+0xe3,0x01,0x04,0x6e,0x01,0x04,0xf3,0x01,0x04,0x20,0x00,0x10,0x1f,0x1c,0x02,0x00,
+0x8b,0x00,0x00,0x40,0x00,0x31,0xff,0xea,0xad,0x50,0x00,0x01,0x01,0x00,0x12,0x40,
+0x70,0x00,0x10,0xf6,0xc7,0x02,0x45,0x3a,0xef,0xea,0x20,0x57,0x03,0x0f,0x08,0x00,
+0x15,0xf2,0x02,0x00,0x03,0xae,0xfe,0xb4,0x0c,0xff,0xf4,0x00,0x7f,0xff,0xff,0xff,
+0x9e,0xff,0xf4,0x05,0x58,0x00,0xa2,0xf4,0x0e,0xff,0xff,0xea,0xae,0xff,0xff,0xf4,
+0x6f,0xd1,0x01,0x22,0xf4,0xaf,0x4e,0x03,0x41,0xf4,0xdf,0xff,0xc0,0x08,0x00,0x31,
+0xef,0xff,0x90,0x08,0x00,0x01,0x45,0x01,0x07,0x10,0x00,0x00,0x44,0x01,0x00,0x08,
+0x00,0x13,0x9f,0x30,0x00,0x30,0x5f,0xff,0xfa,0x2d,0x01,0x00,0x50,0x00,0x10,0xda,
+0x50,0x00,0x13,0x04,0x60,0x00,0x10,0x00,0x10,0x03,0x8f,0xbf,0xff,0xf4,0x00,0x02,
+0xae,0xfe,0xb3,0xb5,0x00,0x1c,0x00,0x08,0x00,0xb1,0x4f,0xff,0xf0,0x4c,0xff,0x44,
+0xff,0xff,0x7f,0xff,0xf4,0x0b,0x01,0x10,0x44,0x05,0x00,0xa3,0xf3,0x4f,0xff,0xff,
+0xd7,0x66,0x14,0xff,0xff,0xa0,0x2c,0x00,0x02,0x6e,0x04,0x0f,0x0b,0x00,0x1e,0x02,
+0xd7,0x01,0x50,0xb7,0x10,0x00,0x00,0x0a,0x57,0x00,0x10,0xe5,0xba,0x01,0x00,0x6e,
+0x01,0x00,0xc8,0x03,0xf2,0x0d,0xa4,0x37,0xff,0xff,0xd0,0x08,0xff,0xfd,0x00,0x00,
+0x7f,0xff,0xf2,0x08,0xff,0xfe,0x00,0x00,0x15,0x55,0x51,0x05,0xff,0xff,0xd7,0x30,
+0x00,0x00,0x28,0x00,0x21,0xb6,0x00,0xca,0x01,0x70,0xff,0xff,0xe6,0x00,0x00,0x00,
+0x28,0x29,0x02,0x11,0x60,0x52,0x00,0xf1,0x0c,0xff,0xff,0xf0,0x09,0x99,0x92,0x00,
+0x00,0x5f,0xff,0xf3,0x0f,0xff,0xf8,0x00,0x00,0x3f,0xff,0xf3,0x09,0xff,0xff,0x94,
+0x35,0xdf,0xff,0xf0,0xbe,0x02,0x00,0x28,0x00,0x21,0x1b,0xff,0x3e,0x02,0x71,0x00,
+0x00,0x49,0xdf,0xfe,0xc7,0x10,0x43,0x03,0x10,0x00,0x8a,0x03,0x18,0x20,0x0b,0x00,
+0x01,0x2d,0x00,0x10,0x0d,0x05,0x00,0x11,0xf0,0x0b,0x00,0x6e,0x03,0x48,0xff,0xff,
+0x54,0x40,0x2c,0x00,0x0f,0x0b,0x00,0x07,0x00,0xc0,0x03,0xf1,0x00,0x00,0x00,0x03,
+0xff,0xff,0xfb,0xb2,0x00,0x0e,0xff,0xff,0xff,0x30,0x00,0x5f,0x5a,0x05,0x53,0x4b,
+0xef,0xec,0x20,0x6f,0x63,0x03,0x0f,0x08,0x00,0x35,0x06,0xbb,0x03,0x11,0xf3,0x08,
+0x00,0x11,0x3f,0x12,0x02,0x00,0x04,0x01,0x41,0xff,0xda,0xbf,0xff,0x04,0x01,0x01,
+0xbc,0x01,0x10,0x00,0x2a,0x01,0xb1,0xaf,0xff,0xf3,0x00,0x07,0xcf,0xfe,0xa4,0x0f,
+0xff,0xf3,0x72,0x02,0x60,0x0e,0xff,0xfc,0x4f,0xff,0xf5,0x2c,0x01,0x11,0xf6,0xa7,
+0x03,0x60,0x7f,0xff,0xf1,0x0a,0xff,0xfe,0x92,0x02,0x60,0xb0,0x04,0xff,0xff,0x20,
+0x01,0x34,0x01,0x40,0xef,0xff,0x70,0x05,0xb2,0x03,0x61,0x9f,0xff,0xb0,0x09,0xff,
+0xfb,0x8b,0x03,0x30,0x0e,0xff,0xf6,0x3c,0x00,0x40,0xf4,0x2f,0xff,0xf1,0x8c,0x01,
+0x40,0xf9,0x7f,0xff,0xb0,0xe1,0x01,0x21,0xfd,0xbf,0x8b,0x01,0x12,0xef,0x36,0x06,
+0x22,0x00,0x9f,0x35,0x06,0x21,0x00,0x4f,0x34,0x06,0x00,0x31,0x00,0x00,0x2f,0x00,
+0x01,0xbd,0x01,0x13,0xb0,0x9b,0x06,0x10,0x60,0x73,0x00,0x51,0xe0,0x00,0x01,0xff,
+0xf8,0x09,0x00,0x00,0x50,0x00,0x30,0x05,0xff,0xfc,0x8a,0x03,0x51,0xa0,0x0e,0xff,
+0xf4,0x00,0x2a,0x04,0x60,0xdf,0xff,0x60,0x0a,0xff,0xf8,0x3e,0x00,0xf0,0x05,0x50,
+0x01,0xff,0xff,0x20,0x06,0xff,0xfb,0x00,0x3f,0xff,0xff,0xa0,0x04,0xff,0xfd,0x00,
+0x02,0xff,0xfe,0x59,0x03,0x40,0xe0,0x07,0xff,0xf9,0x77,0x00,0x80,0x10,0xcf,0xfd,
+0xff,0xf3,0x0b,0xff,0xf5,0x40,0x00,0x80,0x51,0xff,0xf5,0xef,0xf8,0x0e,0xff,0xf1,
+0x97,0x01,0xf0,0x05,0x85,0xff,0xf1,0x9f,0xfd,0x1f,0xff,0xd0,0x00,0x00,0x2f,0xff,
+0xba,0xff,0xc0,0x5f,0xff,0x7f,0xff,0x90,0x8f,0x00,0x82,0xee,0xff,0x70,0x0f,0xff,
+0xef,0xff,0x50,0x88,0x02,0x21,0x20,0x0b,0xb8,0x00,0x00,0xc2,0x01,0x12,0xfd,0x05,
+0x00,0x10,0x00,0xb1,0x06,0x10,0xf8,0x05,0x00,0x20,0xf9,0x00,0xd8,0x00,0x00,0xbc,
+0x02,0x10,0xdf,0x5f,0x00,0x00,0x61,0x00,0x10,0xf0,0xd4,0x04,0x01,0xd0,0x00,0x10,
+0x6f,0x10,0x03,0x12,0x3f,0x5f,0x00,0x10,0xfa,0xef,0x00,0x90,0xf8,0x00,0x9f,0xff,
+0xf3,0x00,0x0d,0xff,0xfe,0xd1,0x04,0x50,0xc0,0x06,0xff,0xff,0x60,0x08,0x05,0x20,
+0x51,0xef,0xdc,0x03,0x30,0x0d,0xff,0xfd,0x1d,0x00,0x02,0x4c,0x07,0x14,0xfa,0xd4,
+0x02,0x12,0x10,0x6c,0x00,0x00,0xed,0x03,0x00,0x23,0x00,0x01,0x21,0x00,0x20,0x00,
+0x05,0xd3,0x06,0x02,0x79,0x00,0x02,0xd6,0x07,0x31,0x7f,0xff,0xfe,0x96,0x00,0x61,
+0x1f,0xff,0xfb,0x5f,0xff,0xf7,0xb6,0x00,0x40,0x20,0xcf,0xff,0xe1,0x69,0x02,0x10,
+0x90,0x04,0x00,0x00,0x1a,0x06,0x00,0x15,0x00,0x40,0x30,0x6f,0xff,0xf7,0x26,0x00,
+0x11,0xfc,0x11,0x00,0x80,0x00,0x0f,0xff,0xfd,0x06,0xff,0xff,0x50,0x70,0x01,0x20,
+0x70,0x1f,0x74,0x00,0x00,0x3d,0x04,0x30,0xbf,0xff,0xf0,0xfe,0x01,0x00,0x65,0x00,
+0x20,0x40,0x02,0xa2,0x00,0x00,0x00,0x02,0x12,0x7f,0x87,0x06,0x41,0xd0,0x0c,0xff,
+0xfa,0xbf,0x02,0x40,0x21,0xff,0xff,0x50,0x90,0x00,0x41,0xf7,0x6f,0xff,0xe0,0xc4,
+0x05,0x32,0xcb,0xff,0xf9,0xaa,0x00,0x00,0xd4,0x02,0x10,0x00,0x50,0x08,0x22,0xff,
+0xe0,0x03,0x01,0x00,0xc2,0x01,0x10,0x00,0xd6,0x05,0x00,0xff,0x02,0x00,0xe7,0x05,
+0x21,0xff,0xc0,0xe9,0x03,0x01,0xa9,0x00,0x02,0x34,0x00,0x11,0x10,0x09,0x00,0x12,
+0x7f,0xd4,0x00,0x22,0x00,0x2e,0x15,0x02,0x43,0x1a,0xcf,0xff,0xfe,0x20,0x00,0x02,
+0xc8,0x03,0x10,0x2f,0xc9,0x00,0x00,0x4b,0x00,0x31,0xdf,0xec,0x50,0x29,0x00,0x12,
+0x9f,0xc1,0x02,0x03,0xc8,0x02,0x12,0xf0,0x0f,0x00,0x62,0xfe,0x05,0x99,0x99,0x99,
+0xaf,0x17,0x01,0x12,0x08,0x38,0x01,0x11,0x04,0x73,0x00,0x00,0x73,0x01,0x10,0xe2,
+0x37,0x00,0x12,0xcf,0xa9,0x01,0x12,0x8f,0xbc,0x01,0x01,0x20,0x06,0x10,0x00,0x9b,
+0x08,0x12,0x20,0xb8,0x00,0x12,0x50,0x39,0x00,0x12,0x90,0x39,0x00,0x62,0xfa,0x99,
+0x99,0x99,0x91,0xdf,0x62,0x00,0x13,0x3d,0x31,0x03,0x03,0x0f,0x00,0x10,0x30,0x54,
+0x00,0x11,0x73,0x2e,0x00,0x11,0x90,0xbf,0x06,0x00,0xd5,0x06,0x20,0xfd,0x10,0x96,
+0x01,0x10,0x20,0x58,0x00,0x10,0xd0,0x32,0x02,0x00,0xc9,0x01,0x01,0x55,0x02,0x01,
+0x8a,0x02,0x08,0x0b,0x00,0x60,0x9f,0xff,0x70,0x00,0x00,0x0d,0x3a,0x02,0x30,0x5c,
+0xff,0xfd,0x30,0x00,0x41,0xfd,0x20,0x00,0x04,0x56,0x00,0x11,0x4f,0x06,0x00,0x31,
+0x29,0xff,0xfe,0xf3,0x01,0x11,0xf5,0x2c,0x00,0x1e,0x80,0x42,0x00,0x02,0x0b,0x00,
+0x11,0x06,0x4b,0x03,0x11,0x3f,0x6e,0x01,0x30,0xdf,0xff,0x40,0x1d,0x02,0x20,0xfe,
+0x40,0x94,0x00,0x10,0xfd,0xc1,0x00,0x20,0xdf,0x70,0xdd,0x00,0x4f,0x41,0x00,0x4f,
+0xf7,0x02,0x00,0x1f,0x30,0x2a,0xa4,0x07,0x0c,0x01,0x30,0x0f,0xfd,0x30,0xad,0x01,
+0x22,0xf4,0x00,0x99,0x08,0x22,0x00,0xaf,0x79,0x06,0x10,0xc0,0x48,0x02,0x10,0xf0,
+0x44,0x02,0x0e,0x05,0x00,0x30,0x0e,0xff,0xf2,0x11,0x01,0x11,0xf7,0x42,0x01,0x10,
+0x83,0xa9,0x00,0x10,0xfd,0xdd,0x03,0x10,0xfd,0x3d,0x00,0x00,0x42,0x03,0x40,0xfe,
+0x50,0x00,0x0c,0xd8,0x00,0x12,0x0f,0x85,0x02,0x0e,0x41,0x00,0x10,0x2f,0x05,0x00,
+0x10,0x5f,0x64,0x00,0x00,0x39,0x04,0x11,0x19,0x20,0x01,0x00,0xbd,0x01,0x20,0x0e,
+0xfa,0x75,0x0a,0x01,0x2f,0x02,0xa1,0x06,0xcf,0xeb,0x40,0x00,0x00,0x27,0x77,0x00,
+0x0a,0x1e,0x03,0x40,0x06,0xff,0xf0,0x06,0x95,0x01,0xf0,0x03,0xb1,0x01,0xdf,0xfd,
+0x00,0xdf,0xff,0xcb,0xff,0xff,0xeb,0xef,0xff,0x80,0x2f,0xff,0x90,0x02,0xae,0x01,
+0x41,0xf1,0x04,0xff,0xf2,0xb2,0x08,0xa0,0xf5,0x00,0x26,0x66,0x00,0x00,0x00,0x6c,
+0xff,0xb3,0x44,0x00,0x70,0x33,0x10,0x00,0x00,0x4e,0xff,0xf9,0xd1,0x02,0xf0,0x0a,
+0xff,0x90,0x0c,0xfd,0x20,0x9f,0xf2,0x0f,0xf5,0x00,0x0f,0xf5,0x0f,0xf6,0x00,0x0f,
+0xf5,0x0a,0xff,0x75,0xcf,0xf1,0x01,0xef,0xff,0x80,0x00,0x20,0xef,0xc4,0x66,0x00,
+0x11,0x70,0x61,0x03,0x00,0xbf,0x03,0x00,0x9f,0x01,0x10,0x02,0x31,0x02,0x32,0x2f,
+0xff,0xfd,0x83,0x08,0x00,0xe9,0x02,0x20,0xfa,0x00,0xdb,0x00,0x01,0xae,0x01,0x10,
+0xf6,0x5f,0x02,0x11,0xc0,0x92,0x01,0x52,0xf2,0x00,0x0c,0xff,0xf8,0xad,0x02,0x21,
+0xd0,0x01,0x3a,0x00,0x10,0xcf,0x6e,0x00,0x40,0xaf,0xff,0xb0,0x00,0x07,0x0b,0x00,
+0x8c,0x07,0x11,0xe2,0xe7,0x01,0x11,0x0c,0x8c,0x05,0x00,0x58,0x00,0x00,0xea,0x02,
+0x11,0xf4,0x3c,0x03,0x20,0xb0,0x00,0xc7,0x07,0x00,0x3c,0x01,0x10,0xf8,0x3c,0x01,
+0x11,0xf6,0x52,0x00,0x11,0x50,0x57,0x00,0x00,0x2a,0x01,0x11,0xf3,0x8c,0x03,0x10,
+0xd0,0x05,0x00,0x00,0x12,0x01,0x00,0x7f,0x07,0x40,0x7f,0xff,0xd0,0x00,0x00,0x04,
+0x00,0x1b,0x05,0x14,0xfa,0xd9,0x02,0x10,0xdf,0xbc,0x00,0x00,0x25,0x02,0x30,0xfd,
+0x00,0x0f,0x23,0x03,0x10,0xb8,0xeb,0x02,0x02,0xc5,0x02,0x21,0xa0,0x00,0x13,0x00,
+0x02,0x51,0x04,0x44,0xcc,0xcc,0xcc,0xcd,0x6e,0x03,0x00,0xb6,0x01,0x01,0x1a,0x03,
+0x02,0xa3,0x09,0x14,0x00,0xac,0x03,0x12,0x20,0x0a,0x00,0x14,0x0f,0xc7,0x08,0x14,
+0x00,0x58,0x0c,0x0f,0x13,0x00,0x21,0x20,0x08,0xcc,0x01,0x00,0x63,0xcf,0xff,0xfd,
+0xc4,0xbf,0xff,0x01,0x00,0x14,0x5b,0x09,0x00,0x15,0xf5,0x13,0x00,0x62,0x50,0x00,
+0x8f,0xff,0xec,0x60,0x97,0x03,0x01,0xd1,0x03,0x12,0x8f,0x7e,0x03,0x59,0x06,0xcc,
+0xef,0xff,0xfa,0xa1,0x00,0x12,0xef,0x66,0x00,0x12,0x0a,0x74,0x04,0x02,0x42,0x02,
+0x01,0x7c,0x04,0x00,0x07,0x00,0x21,0x16,0xbf,0x7b,0x00,0x10,0x7f,0x37,0x0b,0x02,
+0x44,0x00,0x10,0xfb,0x14,0x01,0x90,0xfb,0x7f,0xff,0xf0,0x00,0x09,0xff,0xfc,0x00,
+0x54,0x00,0x30,0xef,0xff,0x50,0xb8,0x02,0xf0,0x07,0x3f,0xff,0xf1,0x00,0x8f,0xff,
+0xa0,0x06,0xff,0xfd,0x00,0x04,0xff,0xfe,0x00,0xaf,0xff,0x90,0x00,0x0f,0xff,0xf2,
+0xdd,0x06,0x00,0x75,0x06,0x13,0x5f,0x98,0x00,0x1e,0xfc,0x09,0x00,0x13,0x4c,0xd0,
+0x00,0x35,0xc9,0x00,0x00,0xbd,0x03,0x0f,0x09,0x00,0x69,0x10,0xaf,0x96,0x00,0x32,
+0xec,0x82,0x00,0x09,0x00,0x00,0xd6,0x04,0x03,0x09,0x00,0x33,0xfa,0x00,0x7c,0xee,
+0x01,0x02,0x98,0x01,0x11,0x18,0x0b,0x02,0x02,0xc1,0x06,0x23,0xd0,0x00,0x3e,0x01,
 0x41,0xf0,0x3c,0xcc,0xb0,0x38,0x02,0x00,0x7f,0x0c,0x01,0x82,0x05,0x1f,0xf1,0x09,
-0x00,0x47,0x01,0xd4,0x0a,0x0f,0x05,0x00,0x17,0x32,0xf0,0x2a,0x50,0xd4,0x02,0x12,
-0xa5,0x29,0x19,0x41,0xfa,0x40,0x00,0x3f,0xab,0x10,0x21,0x06,0xcf,0x49,0x03,0x21,
-0x01,0x6c,0x4f,0x03,0x11,0x09,0x06,0x00,0x40,0xbf,0xff,0xd4,0x72,0x8c,0x04,0x11,
-0x10,0x49,0x23,0x11,0x00,0x9b,0x08,0x01,0x28,0x02,0x0f,0x06,0x00,0x20,0x01,0xf6,
-0x0a,0x00,0xd7,0x1d,0x03,0x0a,0x0c,0x14,0xe5,0x09,0x00,0x00,0x14,0x0c,0x41,0xfc,
-0xcc,0xcc,0xef,0x25,0x0c,0x11,0xf0,0x6a,0x36,0x21,0xf5,0x4f,0x99,0x02,0x10,0x1e,
-0x47,0x0c,0x11,0xf0,0x41,0x00,0x12,0xfb,0x09,0x00,0x10,0x07,0x5f,0x09,0x12,0xf0,
-0x79,0x33,0x0f,0x09,0x00,0x47,0x80,0x7f,0xff,0xc0,0x00,0x4b,0xef,0xfd,0x92,0x6f,
-0x00,0x01,0x3d,0x03,0x00,0x6e,0x0c,0x12,0xc0,0x0f,0x2d,0x01,0x13,0x00,0x50,0xfe,
-0xdf,0xff,0xff,0x80,0x13,0x00,0x10,0x43,0x4b,0x2f,0x00,0x13,0x00,0x02,0x4d,0x03,
-0x00,0x13,0x00,0x01,0x5c,0x04,0x11,0x27,0x13,0x00,0x00,0xf7,0x04,0x01,0x13,0x00,
-0x00,0x4b,0x03,0x1a,0x47,0x13,0x00,0x00,0x14,0x04,0x12,0x26,0x38,0x19,0x10,0x5f,
-0xce,0x01,0x12,0xf0,0xe3,0x14,0x10,0x03,0x49,0x07,0x00,0x1c,0x00,0x20,0xa0,0x0e,
-0xef,0x05,0x10,0x05,0x23,0x09,0x03,0xe3,0x20,0x14,0xfb,0x92,0x19,0x00,0xcf,0x0d,
-0x11,0xbf,0x42,0x10,0x01,0x83,0x32,0x12,0xce,0xe9,0x2d,0x0f,0xf4,0x01,0x06,0x40,
-0x14,0x44,0x40,0x6f,0x5e,0x16,0x23,0xb7,0x10,0x3e,0x12,0x14,0xf7,0x46,0x12,0x10,
-0x70,0x77,0x03,0x13,0xef,0x45,0x0a,0x13,0x02,0xcb,0x1a,0x00,0x91,0x32,0x03,0x06,
-0x1a,0x14,0xfc,0xe4,0x34,0x02,0xd4,0x31,0x05,0x08,0x00,0x1f,0xfe,0x08,0x00,0x65,
-0x12,0xcf,0xc7,0x00,0x13,0x0c,0x35,0x2e,0x02,0xed,0x14,0x53,0xc0,0x09,0xcc,0xcc,
-0xce,0xe2,0x04,0x23,0x01,0x8f,0x16,0x09,0x15,0x6f,0x1a,0x19,0x18,0xa0,0xcb,0x34,
-0x02,0x36,0x03,0x05,0x53,0x00,0x03,0x0f,0x00,0x04,0x1e,0x00,0x03,0x2d,0x00,0x01,
-0x16,0x2a,0x01,0x4b,0x00,0x13,0x19,0x5a,0x00,0x12,0xcf,0xea,0x05,0x07,0x78,0x00,
-0x83,0xed,0xa6,0x10,0x00,0x00,0xab,0xbb,0x40,0x3f,0x05,0x1f,0x60,0x08,0x00,0x1c,
-0x00,0x65,0x22,0x11,0x50,0x08,0x00,0x00,0x0d,0x10,0x03,0x48,0x32,0x73,0xc0,0xbc,
-0xcc,0xcc,0xcc,0xdf,0xff,0xe9,0x05,0x13,0x7f,0xff,0x16,0x13,0x0b,0x1a,0x1a,0x02,
-0x81,0x03,0x01,0xd9,0x1d,0x03,0xa7,0x01,0x13,0xf8,0x7d,0x1b,0x18,0xf3,0x4d,0x35,
-0x13,0x0a,0x88,0x06,0x12,0xaf,0xd4,0x00,0x21,0x3d,0xff,0x49,0x14,0x12,0x3a,0xb1,
-0x04,0x13,0x6c,0x88,0x12,0x13,0xff,0x7c,0x40,0x04,0x21,0x0b,0x02,0xd7,0x38,0x42,
-0x00,0x00,0xfc,0x71,0xc3,0x04,0x16,0x20,0x14,0x1f,0x54,0xff,0xfe,0xc9,0x30,0x00,
-0xce,0x36,0x15,0xc2,0xb4,0x03,0x52,0xd1,0x04,0xff,0xff,0xcc,0x9a,0x24,0x01,0x37,
-0x03,0x00,0x15,0x25,0x12,0x04,0x30,0x06,0x10,0x5f,0xd7,0x0e,0x12,0xf0,0x57,0x00,
-0x12,0x64,0x13,0x00,0x10,0x0c,0xfe,0x38,0x12,0xf0,0x63,0x01,0x1f,0x74,0x13,0x00,
-0x28,0x02,0x26,0x06,0x24,0xf7,0x4f,0xe2,0x06,0x14,0x74,0x09,0x00,0x06,0x13,0x00,
-0x10,0x70,0x10,0x20,0x51,0x03,0x8d,0xff,0xeb,0x60,0xf4,0x1f,0x04,0x48,0x3b,0x31,
-0xcf,0xff,0xaa,0x1f,0x00,0x01,0xdc,0x0b,0x02,0x50,0x03,0x11,0x90,0xf5,0x0e,0x10,
-0xb1,0x6d,0x36,0x01,0x16,0x1e,0x13,0xd0,0xfe,0x39,0x01,0x85,0x24,0x00,0xa5,0x0d,
-0x00,0xe0,0x30,0x01,0x81,0x01,0x11,0xf9,0xbb,0x19,0x01,0x8d,0x08,0x10,0xa0,0xae,
-0x03,0x03,0x86,0x01,0x01,0xa0,0x1f,0x02,0x15,0x00,0x00,0x2e,0x00,0x02,0x15,0x00,
-0x02,0x8f,0x01,0x00,0x15,0x00,0x34,0x07,0xff,0xff,0xb0,0x01,0x00,0xd3,0x1f,0x02,
-0x15,0x00,0x10,0x0f,0xfa,0x14,0x00,0x56,0x02,0x11,0xfa,0xb4,0x0a,0x11,0x6f,0x4c,
-0x08,0x00,0xe4,0x1f,0x11,0x06,0x5e,0x06,0x10,0x0c,0xe5,0x01,0x02,0x15,0x00,0x0f,
-0xd8,0x05,0x1c,0x0b,0xe7,0x05,0x00,0xc7,0x2c,0x31,0xb5,0x00,0x00,0x83,0x26,0x11,
-0x0f,0x4d,0x37,0x21,0xcc,0xdf,0xcf,0x0b,0x11,0x1c,0x96,0x00,0x01,0x45,0x36,0x02,
-0x57,0x09,0x13,0x0f,0xa1,0x2a,0x0f,0x0b,0x00,0x0e,0x10,0x3a,0x7c,0x01,0x11,0xf3,
-0xac,0x02,0x11,0x3e,0xd0,0x0b,0x11,0xef,0xce,0x0b,0x22,0x3f,0xff,0xbc,0x30,0x14,
-0x30,0x78,0x29,0x00,0x54,0x01,0x24,0x3f,0xff,0x28,0x02,0x52,0x02,0xcc,0xdf,0xff,
-0xdc,0x29,0x02,0x21,0x00,0x0b,0x3b,0x01,0x11,0x7f,0x8c,0x28,0x14,0xfc,0x8e,0x18,
-0x03,0x68,0x34,0x01,0x60,0x1f,0x12,0xf8,0xd6,0x0e,0x10,0xf8,0x95,0x41,0x02,0xd4,
-0x02,0x44,0x90,0x0e,0xff,0xf7,0xee,0x02,0x11,0xef,0xad,0x02,0x00,0x6c,0x01,0x03,
-0xa3,0x04,0x00,0x98,0x38,0x02,0x48,0x1d,0x12,0x05,0x4a,0x1f,0x13,0x60,0x08,0x03,
-0x10,0x1f,0xab,0x08,0x10,0x02,0xaf,0x17,0x00,0x40,0x0a,0x31,0xfd,0xce,0xff,0x42,
-0x1e,0x07,0x80,0x0c,0x01,0xce,0x07,0x02,0xa5,0x34,0x13,0x28,0x40,0x05,0x02,0x68,
-0x10,0x00,0xaa,0x09,0x01,0xd6,0x21,0x01,0xcc,0x08,0x01,0xd4,0x07,0x12,0x03,0x7e,
-0x15,0x12,0x30,0xb1,0x0a,0x01,0x50,0x22,0x10,0x05,0x45,0x01,0x01,0x36,0x38,0x12,
-0x7f,0xe0,0x1b,0x10,0x50,0xc7,0x1a,0x03,0xac,0x03,0x10,0xcf,0xa7,0x00,0x00,0x26,
-0x02,0x11,0x0f,0x52,0x08,0x04,0xee,0x0f,0x01,0x66,0x04,0x13,0xdf,0x18,0x29,0x12,
-0xf3,0x8c,0x28,0x00,0xe8,0x21,0x02,0x0a,0x01,0x12,0x05,0x9a,0x00,0x41,0x01,0x23,
-0x57,0xbf,0xba,0x09,0x15,0x05,0x5c,0x2e,0x11,0x5f,0xab,0x00,0x13,0x30,0x23,0x00,
-0x11,0xb4,0x62,0x03,0x46,0xfe,0xca,0x84,0x10,0x4a,0x04,0x23,0xdb,0x71,0x09,0x00,
-0x00,0xce,0x03,0x14,0xef,0x79,0x28,0x31,0xef,0xff,0xdc,0xbd,0x04,0x11,0x30,0xdd,
-0x09,0x00,0xc9,0x23,0x13,0xef,0xd6,0x1f,0x23,0xd0,0xef,0xfd,0x0e,0x11,0xf0,0x09,
-0x00,0x00,0xd7,0x00,0x00,0x2d,0x00,0x10,0x10,0xb1,0x08,0x02,0x6b,0x10,0x0f,0x09,
-0x00,0x02,0x04,0x5c,0x21,0x0f,0x09,0x00,0x5a,0x01,0x76,0x3e,0x23,0xd9,0x50,0xc0,
-0x26,0x00,0x3e,0x26,0x14,0xcf,0x91,0x13,0x40,0xcf,0xff,0xec,0xcc,0xda,0x01,0x01,
-0x71,0x01,0x00,0xb2,0x3b,0x11,0x60,0x09,0x00,0x00,0x64,0x01,0x13,0xcf,0xe2,0x24,
-0x10,0xf0,0x24,0x00,0x14,0x30,0x48,0x00,0x10,0x40,0x2f,0x09,0x0b,0x09,0x00,0x01,
-0x3a,0x23,0x03,0xb6,0x09,0x0a,0xc8,0x09,0x14,0x03,0xde,0x20,0x00,0x8b,0x2a,0x12,
-0x7c,0x9a,0x05,0x14,0xfa,0x3c,0x0f,0x00,0xda,0x35,0x03,0x6f,0x35,0x13,0x9f,0x5c,
-0x07,0x02,0xdd,0x21,0x00,0x46,0x3b,0x31,0xdf,0xff,0xe1,0xb3,0x08,0x11,0x03,0x1c,
-0x0a,0x31,0xbf,0xff,0x90,0x50,0x21,0x00,0xc2,0x02,0x01,0x20,0x37,0x11,0xef,0xd6,
-0x17,0x11,0xf5,0xd2,0x0b,0x00,0x1a,0x04,0x01,0x1e,0x02,0x00,0x65,0x09,0x12,0xbf,
-0x70,0x43,0x12,0xf5,0x49,0x00,0x13,0xcf,0x23,0x18,0x17,0x0b,0xd7,0x10,0x12,0xa3,
-0x11,0x06,0x13,0xf8,0x13,0x37,0x03,0x65,0x21,0x01,0x32,0x0e,0x0f,0x11,0x00,0x44,
-0x01,0x86,0x06,0x00,0xa0,0x0d,0x02,0xd5,0x22,0x02,0xc4,0x02,0x11,0xf2,0xb6,0x1d,
-0x02,0xc6,0x0d,0x00,0x1e,0x05,0x10,0x05,0x2b,0x01,0x01,0xa9,0x03,0x00,0xc3,0x0d,
-0x10,0x1f,0xbf,0x00,0x00,0x30,0x34,0x00,0x21,0x03,0x00,0xab,0x1d,0x12,0xd6,0x4a,
-0x01,0x14,0x4f,0xab,0x2d,0x04,0x8f,0x0c,0x01,0x60,0x16,0x13,0x00,0xfd,0x21,0x24,
-0xfe,0x20,0x76,0x01,0x15,0xc0,0xec,0x36,0x05,0xab,0x34,0x32,0x60,0x07,0xcc,0x76,
-0x0b,0x24,0xf3,0x09,0x32,0x0c,0x0e,0x09,0x00,0x23,0x1f,0xff,0x6c,0x34,0x14,0x01,
-0x0a,0x0d,0x03,0x2d,0x2e,0x00,0xcb,0x0a,0x01,0x31,0x0d,0x14,0xef,0xeb,0x2a,0x00,
-0x17,0x07,0x05,0x24,0x1e,0x03,0x01,0x02,0x00,0x0b,0x13,0x32,0x4e,0xee,0xd0,0x55,
-0x0b,0x02,0xcb,0x06,0x00,0x06,0x00,0x01,0x7f,0x06,0x00,0xd6,0x01,0x13,0x04,0xac,
-0x26,0x12,0xf7,0x13,0x00,0x12,0x0a,0x16,0x04,0x02,0xd3,0x26,0x01,0x13,0x00,0x10,
-0x08,0xbb,0x11,0x00,0x13,0x00,0x21,0x3c,0xff,0x3a,0x14,0x00,0x55,0x32,0x03,0xa8,
-0x15,0x21,0x03,0xff,0x6e,0x2a,0x01,0x13,0x00,0x22,0xb1,0x00,0x13,0x00,0x32,0xfd,
-0x40,0x00,0x13,0x00,0x14,0x24,0x57,0x1a,0x05,0x92,0x00,0x2f,0xf0,0x00,0x13,0x00,
-0x0f,0x0f,0xd3,0x09,0x12,0x1f,0xaf,0xd3,0x09,0x0e,0x0f,0xa3,0x09,0x3e,0x31,0x0f,
-0xff,0xf6,0xe1,0x12,0x01,0xf9,0x04,0x31,0xdf,0xff,0x90,0xf0,0x02,0x00,0xd6,0x02,
-0x01,0x2e,0x07,0x00,0xf4,0x02,0x00,0x77,0x06,0x00,0x1b,0x02,0x00,0x5e,0x06,0x00,
-0x80,0x03,0x01,0xfe,0x2e,0x02,0xa9,0x14,0x11,0xff,0x34,0x05,0x01,0xe5,0x00,0x00,
-0x59,0x05,0x30,0xdf,0xff,0x80,0x08,0x00,0x00,0x6d,0x02,0x00,0x50,0x03,0x01,0xc7,
-0x00,0x00,0x50,0x03,0x52,0x00,0x7f,0xff,0xe1,0x4b,0xde,0x3a,0x13,0xf7,0x9c,0x08,
-0x01,0x77,0x31,0x03,0x7f,0x3f,0x12,0xa0,0xe0,0x06,0x00,0x7c,0x49,0x23,0xb7,0x20,
-0xe0,0x22,0x03,0x46,0x09,0x02,0xd5,0x03,0x02,0x1e,0x28,0x11,0x04,0xe8,0x25,0x01,
-0x7e,0x03,0x21,0x02,0x6b,0x6c,0x03,0x00,0xd2,0x02,0x00,0x3d,0x01,0x01,0x8e,0x12,
-0x04,0x4a,0x05,0x26,0xfb,0x10,0x82,0x30,0x13,0xa4,0x36,0x0f,0x43,0xfe,0xdc,0xa8,
-0x63,0xf7,0x3e,0x02,0x23,0x09,0x15,0x40,0x2f,0x00,0x23,0xff,0xc2,0x15,0x00,0x01,
-0x6d,0x08,0x62,0xac,0xcf,0xff,0xfd,0xcc,0xcd,0xf0,0x02,0x00,0x18,0x15,0x00,0x27,
-0x09,0x00,0x36,0x00,0x12,0xf5,0x92,0x28,0x03,0x15,0x00,0x01,0xbb,0x00,0x22,0x0e,
-0xff,0x5c,0x49,0x13,0xf6,0x15,0x00,0x00,0x32,0x0f,0x0f,0x15,0x00,0x05,0x14,0xf4,
-0x15,0x00,0x04,0xa9,0x25,0x13,0x60,0xc7,0x3f,0x00,0x15,0x00,0x12,0x0b,0x03,0x0b,
-0x10,0xdf,0x10,0x05,0x22,0xff,0xd0,0x15,0x00,0x12,0x0f,0x32,0x16,0x00,0x15,0x00,
-0x03,0x4e,0x04,0x00,0x15,0x00,0x03,0xec,0x2d,0x00,0x3f,0x00,0xf0,0x01,0x8e,0xee,
-0x90,0x09,0xee,0xe8,0x00,0xcf,0xff,0x40,0x0d,0xff,0xf3,0x00,0xff,0xfe,0x3d,0x47,
-0x11,0x03,0x67,0x1f,0xb0,0x80,0x07,0xff,0xf2,0x00,0x7f,0xff,0x20,0x0a,0xff,0xd0,
-0x93,0x3b,0x10,0x0e,0xf1,0x3a,0x00,0xe5,0x03,0x10,0x10,0x85,0x3b,0x60,0x5f,0xfb,
-0x00,0x05,0xff,0xb0,0xb1,0x4b,0x3a,0x08,0xff,0x50,0x34,0x3d,0x0f,0x4b,0x3d,0x04,
-0x13,0xf7,0x08,0x00,0x17,0xe2,0x14,0x00,0x72,0xf4,0xf1,0x00,0xfb,0xe9,0x00,0xe9,
-0x16,0x47,0x0d,0x4b,0x3e,0x3d,0x0a,0x00,0x06,0x15,0x00,0x2f,0xb9,0x00,0x01,0x00,
-0x14,0x1f,0xc2,0x1d,0x00,0x09,0x03,0x84,0x00,0xb2,0xec,0x00,0xfb,0x00,0x00,0xe2,
-0xfc,0xed,0xf6,0x00,0xdb,0x8f,0x00,0x7c,0xfd,0x00,0x00,0xfc,0xfd,0xf4,0xf8,0x8e,
-0x00,0x7e,0xf9,0x00,0xfa,0x00,0x00,0xf2,0x00,0x01,0x00,0x17,0xfa,0x23,0x00,0x01,
-0x01,0x00,0x19,0xfd,0x1f,0x00,0x15,0xfc,0x6d,0x00,0x00,0x64,0x02,0x7f,0xeb,0x00,
-0xfb,0x00,0xfb,0xf5,0xfa,0x3e,0x3f,0x0a,0x04,0x09,0x00,0x21,0xfb,0xfc,0x33,0x00,
-0x34,0xfc,0xfa,0xfb,0x12,0x00,0x75,0xbc,0x00,0x00,0x00,0xd0,0x00,0xcc,0x23,0x00,
-0x62,0xf8,0xfb,0x00,0x00,0xfb,0xfa,0x04,0x00,0x0b,0x42,0x00,0x10,0xf9,0xe4,0x02,
-0x1f,0xf9,0x65,0x00,0x06,0x1f,0xfb,0x3a,0x01,0x0c,0x10,0xd7,0x5e,0x00,0x0a,0xe5,
-0x00,0x10,0xf9,0x07,0x00,0x11,0xf6,0x8b,0x04,0x14,0xb8,0x69,0x00,0x96,0xf0,0x00,
-0x00,0xcd,0xfa,0xcd,0xe9,0x00,0xba,0x2a,0x00,0x34,0xfd,0xe1,0xf3,0x0b,0x00,0x62,
-0x9b,0x00,0x00,0x00,0xd4,0x00,0xc3,0x3c,0x61,0xf3,0x00,0xf7,0x00,0xfd,0xfd,0x1d,
-0x01,0x3d,0x04,0x00,0x04,0x70,0x00,0x6f,0xf8,0x00,0xf9,0xfb,0x00,0xf7,0x93,0x00,
-0x0a,0x10,0xf4,0xb5,0x00,0x04,0x07,0x13,0x0a,0x69,0x02,0xb1,0xc0,0xbc,0x00,0x00,
-0xe2,0xf9,0xca,0xfc,0x04,0x00,0x04,0x5d,0x00,0xd2,0xd6,0xea,0x00,0xea,0xcc,0xf0,
-0xed,0x00,0xf0,0xec,0xf4,0xed,0xf1,0x12,0x01,0x66,0xca,0xd9,0x00,0x00,0xed,0xfd,
-0x73,0x40,0xa3,0xf5,0xf5,0x00,0x00,0xf5,0xf9,0x00,0x00,0xf9,0xfd,0x31,0x01,0x71,
-0x04,0x00,0xdc,0xf1,0x00,0x00,0xf5,0x0a,0x00,0x02,0x8d,0x06,0x23,0xf8,0xf8,0x62,
-0x01,0x16,0x00,0x15,0x00,0x14,0xd9,0xf1,0x01,0x15,0x04,0x18,0x01,0x10,0xfb,0x4f,
-0x01,0x13,0xf8,0x02,0x02,0xf5,0x11,0x05,0xf4,0xc6,0xda,0x00,0x00,0xdb,0xf9,0xe8,
-0xfc,0x04,0xe8,0x05,0x04,0x03,0x05,0x00,0x05,0xf0,0xf0,0xfb,0xf6,0xf0,0xf6,0xf2,
-0xfb,0xf6,0xfb,0x00,0xfa,0xf9,0x05,0x81,0x00,0x2a,0x03,0xfa,0x8e,0x01,0x01,0x46,
-0x00,0x1b,0xf9,0xb1,0x01,0x14,0xfc,0x3f,0x02,0x0c,0x01,0x00,0x0e,0x16,0x00,0x0d,
-0x1d,0x00,0x0f,0xfc,0x01,0x07,0x01,0xa3,0x02,0x2c,0xfc,0xfc,0xa9,0x02,0x0f,0x29,
-0x00,0x04,0x0f,0x1d,0x00,0x0e,0x3e,0x04,0x00,0x05,0xc3,0x02,0x19,0xfa,0x0e,0x00,
-0x2f,0xec,0x00,0x01,0x00,0x23,0x0a,0xa6,0x02,0x1f,0xea,0xf5,0x00,0x0b,0x22,0xfb,
-0xfc,0x96,0x01,0x2b,0xd5,0x00,0xb9,0x03,0x20,0xfb,0x05,0x5a,0x02,0x4f,0x0d,0x00,
-0x05,0x04,0x41,0x00,0x09,0x07,0x30,0x01,0x00,0x28,0x00,0x1c,0xd6,0x60,0x00,0x2c,
-0xfd,0x03,0x76,0x01,0x1f,0xe1,0xd2,0x00,0x23,0x1e,0xf6,0x23,0x00,0x0f,0xf5,0x01,
-0x12,0x1f,0xfb,0xb6,0x03,0x05,0x31,0x01,0x00,0x02,0xf0,0x07,0x21,0x03,0x00,0x5c,
-0x03,0x1d,0x05,0x21,0x00,0xf2,0x0c,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,
-0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,
-0x18,0x19,0x3d,0x40,0x70,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0xfb,0x0f,0xff,0x00,
-0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0xd1,
-0x00,0x0e,0x02,0x7d,0x00,0x20,0x03,0x02,0x78,0x00,0x4b,0x06,0x07,0x06,0x08,0x1f,
-0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,
-0xa2,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x04,0x4d,0x81,0x16,0x00,
-0x17,0x17,0x17,0x18,0x17,0x00,0x55,0x32,0xff,0x01,0x19,0x1a,0x19,0x17,0x1b,0x1c,
-0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x77,0x00,0x06,0x50,0x00,0x00,
-0x00,0x00,0x00,
+0x00,0x47,0x01,0xd4,0x0a,0x0f,0x05,0x00,0x17,0x32,0xf0,0x2a,0x50,0xd4,0x02,0x11,
+0xa5,0x06,0x00,0x50,0xff,0xfa,0x40,0x00,0x3f,0xd9,0x00,0x31,0xa1,0x06,0xcf,0x49,
+0x03,0x21,0x01,0x6c,0x4f,0x03,0x11,0x09,0x06,0x00,0x61,0xbf,0xff,0xd4,0x72,0x00,
+0x04,0xbf,0x04,0x11,0x08,0x30,0x05,0x11,0x09,0x41,0x05,0x1f,0x0a,0x06,0x00,0x1c,
+0x50,0x0a,0xff,0xf9,0x00,0x00,0xb1,0x4f,0xff,0xff,0xff,0xff,0xed,0xa5,0x00,0x00,
+0x4f,0xff,0x01,0x00,0x14,0xe5,0x09,0x00,0xf1,0x05,0xff,0x40,0x4f,0xff,0xfc,0xcc,
+0xcc,0xef,0xff,0xff,0xe0,0x4f,0xff,0xf0,0x00,0x00,0x02,0xcf,0xff,0xf5,0x09,0x00,
+0x42,0x00,0x1e,0xff,0xf9,0x09,0x00,0x32,0x0a,0xff,0xfb,0x09,0x00,0x32,0x07,0xff,
+0xfc,0x09,0x00,0x3f,0x06,0xff,0xfd,0x09,0x00,0x47,0x80,0x7f,0xff,0xc0,0x00,0x4b,
+0xef,0xfd,0x92,0x6f,0x00,0x70,0x00,0x08,0xff,0xff,0xff,0xf4,0x00,0x13,0x00,0x51,
+0x8f,0xff,0xff,0xff,0xf1,0x13,0x00,0x50,0xfe,0xdf,0xff,0xff,0x80,0x13,0x00,0x50,
+0x43,0x00,0x2e,0xff,0xfd,0x13,0x00,0x60,0x00,0x00,0x00,0x8f,0xff,0xf0,0x13,0x00,
+0x62,0x00,0x00,0x03,0xff,0xff,0x27,0x13,0x00,0x32,0x1f,0xff,0xf3,0x13,0x00,0x4b,
+0x01,0xff,0xff,0x47,0x13,0x00,0x60,0x02,0xff,0xff,0x26,0xff,0xfd,0x13,0x00,0x41,
+0x5f,0xff,0xf1,0x5f,0x7b,0x00,0x71,0x09,0xff,0xfe,0x03,0xff,0xff,0x50,0x1c,0x00,
+0xa0,0xa0,0x0e,0xff,0xfe,0x50,0x00,0x05,0xef,0xff,0xf4,0x78,0x00,0x81,0xfd,0xdf,
+0xff,0xff,0xfb,0x00,0x00,0xdf,0x30,0x01,0x50,0xfe,0x10,0x00,0x01,0xbf,0x09,0x00,
+0xb0,0xfb,0x10,0x00,0x00,0x00,0x39,0xce,0xff,0xec,0x83,0x00,0x57,0x01,0x3f,0xf4,
+0xff,0xff,0x05,0x00,0x01,0xc1,0x14,0x44,0x40,0x6f,0xff,0xff,0xff,0xfd,0xb7,0x10,
+0x00,0x6f,0x40,0x00,0x13,0xf7,0x08,0x00,0x41,0xff,0x70,0x4c,0xcc,0x78,0x01,0x20,
+0xf1,0x00,0x90,0x00,0x40,0xbf,0xff,0xf6,0x00,0x01,0x00,0x31,0x0d,0xff,0xfa,0x08,
+0x00,0x12,0x08,0xb1,0x00,0x00,0x11,0x01,0x01,0x08,0x00,0x15,0x05,0x08,0x00,0x1f,
+0xfe,0x08,0x00,0x65,0x12,0xcf,0xc7,0x00,0x11,0x0c,0xbe,0x00,0x31,0x80,0x00,0xcf,
+0x08,0x00,0x50,0xc0,0x09,0xcc,0xcc,0xce,0x10,0x00,0x00,0x68,0x01,0x40,0x8f,0xff,
+0xff,0x10,0x2d,0x00,0x31,0x6f,0xff,0xf7,0x35,0x00,0x32,0xcf,0xff,0xa0,0xcc,0x00,
+0x22,0xfd,0x00,0x6b,0x01,0x18,0xe0,0x53,0x00,0x03,0x0f,0x00,0x04,0x1e,0x00,0x03,
+0x2d,0x00,0x33,0x6f,0xff,0xf6,0x4b,0x00,0x13,0x19,0x5a,0x00,0x02,0x69,0x00,0x17,
+0xb0,0x78,0x00,0x81,0xed,0xa6,0x10,0x00,0x00,0xab,0xbb,0x40,0x38,0x00,0x3f,0xef,
+0xff,0x60,0x08,0x00,0x1b,0x00,0x47,0x00,0x22,0xda,0x50,0x08,0x00,0x52,0xff,0xfc,
+0x10,0xef,0xff,0xc9,0x00,0x50,0xbc,0xcc,0xcc,0xcc,0xdf,0x6e,0x02,0x00,0x01,0x00,
+0x31,0x7f,0xff,0xf9,0x08,0x00,0x33,0x0b,0xff,0xfb,0x8f,0x01,0x02,0x08,0x00,0x33,
+0x09,0xff,0xfa,0xa7,0x01,0x11,0xf8,0x08,0x00,0x31,0x3f,0xff,0xf3,0x08,0x00,0x12,
+0xdf,0xcc,0x00,0x22,0x0a,0xff,0x65,0x00,0x12,0xaf,0xd4,0x00,0x80,0x3d,0xff,0xff,
+0xf2,0x00,0x00,0x00,0x3a,0x67,0x03,0x42,0x00,0x00,0x6c,0xff,0x5e,0x00,0x00,0x0f,
+0x02,0x12,0x20,0x08,0x00,0x21,0x80,0x00,0x08,0x00,0x11,0x91,0x44,0x00,0x31,0xfc,
+0x71,0x00,0x01,0x00,0x12,0x20,0x07,0x00,0x11,0x4f,0x6e,0x02,0x43,0xc9,0x30,0x00,
+0x04,0xaa,0x03,0x15,0xc2,0xb4,0x03,0xb2,0xd1,0x04,0xff,0xff,0xcc,0xcc,0xcd,0xff,
+0xff,0xff,0x90,0x37,0x03,0x62,0x5e,0xff,0xff,0x04,0xff,0xff,0x55,0x01,0x11,0xf3,
+0x13,0x00,0x00,0x57,0x00,0x12,0x64,0x13,0x00,0x33,0x0c,0xff,0xf7,0x13,0x00,0x3f,
+0xcf,0xff,0x74,0x13,0x00,0x28,0x50,0xcc,0xcc,0xcc,0xcc,0xcf,0x13,0x00,0x03,0x01,
+0x00,0x14,0x74,0x09,0x00,0x06,0x13,0x00,0xa0,0x70,0x0e,0xff,0xfa,0x00,0x03,0x8d,
+0xff,0xeb,0x60,0x8a,0x00,0x20,0xf2,0x09,0x14,0x00,0x10,0xd2,0x3f,0x00,0x11,0xaa,
+0x1f,0x00,0x10,0xe1,0x9e,0x03,0x02,0x50,0x03,0x20,0x90,0x00,0x1d,0x00,0x50,0xb1,
+0x00,0x2d,0xff,0xff,0x97,0x03,0x20,0xff,0xd0,0x4c,0x01,0x10,0xf4,0xc8,0x03,0x11,
+0xf3,0xa4,0x01,0x51,0x70,0x00,0x0b,0xff,0xfc,0x81,0x01,0x32,0xf9,0x00,0x01,0x56,
+0x01,0x30,0x9f,0xff,0xa0,0xae,0x03,0x03,0x86,0x01,0x12,0x0a,0x21,0x03,0x00,0x15,
+0x00,0x00,0x2e,0x00,0x02,0x15,0x00,0x02,0x8f,0x01,0x00,0x15,0x00,0x34,0x07,0xff,
+0xff,0xb0,0x01,0x33,0xbf,0xff,0xb0,0x15,0x00,0x50,0x0f,0xff,0xf7,0x00,0x05,0x56,
+0x02,0x52,0xfa,0x04,0xff,0xff,0x30,0x89,0x03,0x60,0xa0,0x8f,0xff,0xe0,0x00,0x06,
+0x0a,0x00,0x20,0xfa,0x0c,0xe5,0x01,0x02,0x15,0x00,0x0e,0xd0,0x03,0x0f,0x05,0x00,
+0x19,0x51,0xf0,0x0f,0xff,0xfe,0xb5,0xe1,0x01,0xb0,0xf9,0x00,0x0f,0xff,0xff,0xff,
+0xf5,0x00,0xcc,0xdf,0xff,0x78,0x04,0x11,0x1c,0x96,0x00,0x10,0x4f,0x16,0x02,0x10,
+0x01,0x82,0x00,0x21,0x00,0x0f,0xb1,0x00,0x0f,0x0b,0x00,0x10,0x10,0x3a,0x7c,0x01,
+0x11,0xf3,0xac,0x02,0x10,0x3e,0x05,0x00,0x02,0x0b,0x00,0x22,0x30,0x3f,0x94,0x04,
+0x22,0xb8,0x30,0x5a,0x01,0x11,0xff,0x54,0x01,0x24,0x3f,0xff,0x28,0x02,0x52,0x02,
+0xcc,0xdf,0xff,0xdc,0x29,0x02,0x41,0x00,0x0b,0xff,0xf1,0xd9,0x02,0x32,0xff,0x10,
+0x02,0x3b,0x01,0x11,0x7f,0x5a,0x05,0x12,0xa0,0x2c,0x02,0x22,0x70,0x0b,0xd2,0x02,
+0x72,0x0e,0xff,0xf8,0x00,0xdf,0xff,0x70,0xd4,0x02,0x44,0x90,0x0e,0xff,0xf7,0xee,
+0x02,0x11,0xef,0xad,0x02,0x00,0x6c,0x01,0x03,0xa3,0x04,0x71,0x1f,0xff,0xf6,0x00,
+0xaf,0xff,0xe0,0xd1,0x03,0x31,0xff,0x30,0x07,0xa4,0x01,0x00,0x08,0x03,0x00,0xce,
+0x01,0x10,0x70,0xd1,0x04,0x10,0xf8,0x74,0x01,0x31,0xff,0xfd,0xce,0x34,0x05,0x03,
+0x3e,0x05,0x21,0xff,0x30,0x1e,0x03,0x00,0x79,0x03,0x01,0xe7,0x02,0x12,0x28,0x40,
+0x05,0x00,0x81,0x01,0x11,0x20,0x7a,0x05,0x41,0x20,0x1f,0xff,0xf8,0x58,0x03,0x51,
+0xf1,0x00,0xaf,0xff,0xd0,0xcf,0x05,0x21,0x10,0x04,0x37,0x00,0x00,0x8b,0x02,0x31,
+0x0d,0xff,0xf9,0x6f,0x00,0x00,0xbd,0x00,0x10,0xf0,0x05,0x00,0x30,0xd0,0x00,0x01,
+0xb4,0x05,0x33,0x09,0xff,0xfb,0xac,0x03,0x10,0xcf,0xa7,0x00,0x00,0x26,0x02,0x32,
+0x0f,0xff,0xf5,0xaf,0x00,0x11,0x05,0x95,0x04,0x00,0x66,0x04,0x11,0xdf,0x09,0x02,
+0x62,0x2f,0xff,0xf3,0x8f,0xff,0xf4,0xd6,0x02,0x12,0xef,0x0a,0x01,0x12,0x05,0x9a,
+0x00,0x30,0x01,0x23,0x57,0xda,0x05,0x12,0x50,0x10,0x00,0x01,0xd1,0x00,0x11,0x5f,
+0xab,0x00,0x13,0x30,0x23,0x00,0x11,0xb4,0x62,0x03,0x46,0xfe,0xca,0x84,0x10,0x4a,
+0x04,0x23,0xdb,0x71,0x09,0x00,0x00,0xce,0x03,0x03,0x09,0x00,0x51,0xf9,0x00,0xef,
+0xff,0xdc,0xbd,0x04,0x20,0x30,0xef,0xfa,0x03,0x40,0x2b,0xff,0xff,0x90,0x09,0x00,
+0x00,0x06,0x01,0x11,0xd0,0x09,0x00,0x00,0xc0,0x00,0x01,0x09,0x00,0x00,0xd7,0x00,
+0x00,0x2d,0x00,0x50,0x10,0x00,0x3f,0xff,0xf0,0x3f,0x00,0x0f,0x09,0x00,0x04,0x02,
+0x14,0x04,0x0f,0x09,0x00,0x5c,0x10,0xcf,0x5c,0x02,0x33,0xd9,0x50,0x00,0xec,0x05,
+0x22,0xfd,0x30,0x09,0x00,0x00,0xc7,0x04,0x40,0xcf,0xff,0xec,0xcc,0xda,0x01,0x02,
+0x71,0x01,0x41,0x3c,0xff,0xff,0x60,0x09,0x00,0x00,0x64,0x01,0x01,0x09,0x00,0x00,
+0xe1,0x00,0x00,0x24,0x00,0x14,0x30,0x48,0x00,0x5b,0x40,0x00,0x2f,0xff,0xf1,0x09,
+0x00,0x00,0xe6,0x01,0x03,0x0b,0x06,0x03,0x75,0x00,0x01,0xf4,0x01,0x02,0xc6,0x07,
+0x13,0x90,0x89,0x05,0x32,0xff,0x30,0x7c,0x9a,0x05,0x32,0xfa,0x00,0x9f,0x7e,0x00,
+0x13,0xd0,0x09,0x00,0x11,0xf9,0x61,0x02,0x00,0x95,0x06,0x00,0x38,0x04,0x11,0xf5,
+0xe4,0x03,0x41,0xc0,0xdf,0xff,0xe1,0xb3,0x08,0x20,0x03,0xff,0xdb,0x02,0x40,0xbf,
+0xff,0x90,0x08,0x6a,0x00,0x00,0xc2,0x02,0x32,0x0d,0xff,0xfd,0x06,0x06,0x80,0x4f,
+0xff,0xf5,0x00,0x0f,0xff,0xf4,0x00,0x1a,0x04,0x00,0x1e,0x02,0x00,0x62,0x05,0x50,
+0x10,0xbf,0xff,0xc0,0x00,0x35,0x02,0x02,0x49,0x00,0x10,0xcf,0xe1,0x07,0x01,0x7f,
+0x04,0x12,0xff,0xee,0x02,0x42,0xbf,0xff,0xff,0xa3,0x11,0x06,0x01,0xf9,0x05,0x00,
+0x11,0x00,0x13,0x70,0x22,0x06,0x1f,0xf7,0x11,0x00,0x46,0x02,0x86,0x06,0x41,0x06,
+0xff,0xfe,0x0a,0x99,0x08,0x02,0xc4,0x02,0x21,0xf2,0x00,0xef,0x02,0x32,0x2f,0xff,
+0xfd,0x1e,0x05,0x10,0x05,0x2b,0x01,0x01,0xa9,0x03,0x80,0x9f,0xff,0xf6,0x00,0x1f,
+0xff,0xf5,0x00,0xa3,0x07,0x21,0x20,0x7f,0xce,0x09,0x32,0xef,0xff,0xd6,0x4a,0x01,
+0x10,0x4f,0xc8,0x02,0x02,0xca,0x06,0x03,0x77,0x06,0x21,0x00,0xbf,0xea,0x00,0x01,
+0xea,0x09,0x24,0xfe,0x20,0x76,0x01,0x12,0xc0,0x13,0x00,0x13,0x6f,0x00,0x07,0x01,
+0xd2,0x06,0x31,0x07,0xcc,0xcc,0x6e,0x06,0x23,0xf3,0x09,0x58,0x04,0x1e,0xfc,0x09,
+0x00,0x11,0x1f,0x07,0x00,0x43,0xeb,0x71,0x00,0x01,0x12,0x00,0x33,0xf5,0x00,0x1f,
+0x0a,0x00,0x42,0xf3,0x00,0xcc,0xcc,0xeb,0x08,0x01,0x88,0x05,0x01,0x17,0x07,0x14,
+0x00,0xe4,0x06,0x02,0x01,0x02,0x00,0x36,0x00,0x41,0x20,0x4e,0xee,0xd0,0x9f,0x03,
+0x12,0xf1,0xcb,0x06,0x00,0x06,0x00,0x01,0x7f,0x06,0x00,0xd6,0x01,0x02,0x13,0x00,
+0x32,0x1f,0xff,0xf7,0x13,0x00,0x12,0x0a,0x16,0x04,0x00,0x93,0x0a,0x20,0xff,0x80,
+0x13,0x00,0x00,0xd7,0x00,0x11,0xe0,0x33,0x00,0x10,0x3c,0x71,0x00,0x00,0x13,0x00,
+0x10,0x3f,0x6e,0x07,0x00,0x13,0x00,0x53,0x03,0xff,0xff,0xe3,0x00,0x13,0x00,0x22,
+0xb1,0x00,0x13,0x00,0x32,0xfd,0x40,0x00,0x13,0x00,0x11,0x24,0x7f,0x00,0x17,0x04,
+0x92,0x00,0x2f,0xf0,0x00,0x13,0x00,0x0f,0x0f,0xd3,0x09,0x12,0x1f,0xaf,0xd3,0x09,
+0x0e,0x0f,0xa3,0x09,0x3e,0x30,0x0f,0xff,0xf6,0x70,0x00,0x11,0xf7,0xf9,0x04,0x31,
+0xdf,0xff,0x90,0xf0,0x02,0x00,0xd6,0x02,0x01,0x2e,0x07,0x00,0xf4,0x02,0x00,0x77,
+0x06,0x00,0x1b,0x02,0x00,0x5e,0x06,0x00,0x80,0x03,0x40,0x03,0xff,0xff,0x20,0x74,
+0x01,0x01,0x56,0x05,0x00,0x34,0x05,0x01,0xe5,0x00,0x00,0x59,0x05,0x30,0xdf,0xff,
+0x80,0x08,0x00,0x00,0x6d,0x02,0x00,0x50,0x03,0x01,0xc7,0x00,0x00,0x50,0x03,0x50,
+0x00,0x7f,0xff,0xe1,0x4b,0x90,0x02,0x00,0x68,0x00,0x12,0x04,0x3c,0x09,0x00,0x4f,
+0x00,0x12,0x50,0xf1,0x01,0x13,0xa0,0xe0,0x06,0x50,0xef,0xff,0xfe,0xb7,0x20,0xaa,
+0x01,0x15,0xfe,0x46,0x09,0x02,0xd5,0x03,0x11,0x8f,0x34,0x06,0x20,0x04,0xef,0xa7,
+0x01,0x01,0x7e,0x03,0x21,0x02,0x6b,0x6c,0x03,0x00,0xd2,0x02,0x20,0xcc,0xef,0x59,
+0x01,0x14,0x10,0x5c,0x05,0x03,0x65,0x0b,0x12,0x0b,0x0c,0x00,0x22,0xa4,0x00,0xe9,
+0x0b,0x52,0xfe,0xdc,0xa8,0x63,0x00,0xac,0x06,0x02,0x23,0x09,0x15,0x40,0x2f,0x00,
+0x23,0xff,0xc2,0x15,0x00,0x01,0x6d,0x08,0x41,0xac,0xcf,0xff,0xfd,0xfd,0x06,0x10,
+0x80,0x21,0x00,0x11,0x50,0x27,0x09,0x00,0x36,0x00,0x21,0xf5,0x00,0x9e,0x08,0x03,
+0x15,0x00,0x01,0xbb,0x00,0x02,0x15,0x00,0x34,0x0d,0xff,0xf6,0x15,0x00,0x3f,0xdf,
+0xff,0x60,0x15,0x00,0x05,0x14,0xf4,0x15,0x00,0x13,0xff,0xd3,0x05,0x10,0x60,0x54,
+0x06,0x03,0x15,0x00,0x12,0x0b,0x03,0x0b,0x10,0xdf,0x10,0x05,0x22,0xff,0xd0,0x15,
+0x00,0x21,0x0f,0xff,0x0a,0x02,0x00,0x15,0x00,0x03,0x4e,0x04,0x00,0x15,0x00,0x43,
+0xfe,0xb6,0x00,0x00,0x3f,0x00,0xf0,0x1f,0x8e,0xee,0x90,0x09,0xee,0xe8,0x00,0xcf,
+0xff,0x40,0x0d,0xff,0xf3,0x00,0xff,0xfe,0x00,0x0f,0xff,0xe0,0x03,0xff,0xf8,0x00,
+0x4f,0xff,0x80,0x07,0xff,0xf2,0x00,0x7f,0xff,0x20,0x0a,0xff,0xd0,0x00,0xbf,0xfc,
+0x00,0x0e,0xff,0x70,0x00,0xef,0xe5,0x03,0xf0,0x04,0x10,0x01,0xff,0xf1,0x00,0x5f,
+0xfb,0x00,0x05,0xff,0xb0,0x00,0x8f,0xf5,0x00,0x08,0xff,0x50,0x00,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -739,11 +810,19 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 1524, .range_length = 1, .glyph_id_start = 124, .list_length = 0, .type = 2, .unicode_list = 0, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[22497] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 1603, .size = 4072, .comp_size = 2691 },
+{ .bitmap_start = 4072, .comp_offset = 4294, .size = 3930, .comp_size = 2114 },
+{ .bitmap_start = 8002, .comp_offset = 6408, .size = 4071, .comp_size = 2204 },
+{ .bitmap_start = 12073, .comp_offset = 8612, .size = 3955, .comp_size = 2258 },
+{ .bitmap_start = 16028, .comp_offset = 10870, .size = 3555, .comp_size = 1911 },
+};
+
+static uint8_t etxUncompBuf[2914] __SDRAMFONTS;
 
 const etxLz4Font lv_font_he_bold_XL = {
-.uncomp_size = 22233,
-.comp_size = 11635,
+.uncomp_size = 2650,
+.comp_size = 1603,
 .line_height = 35,
 .base_line = 8,
 .subpx = 0,
@@ -756,12 +835,13 @@ const etxLz4Font lv_font_he_bold_XL = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 35,
-.glyph_bitmap = 1000,
-.class_pair_values = 20583,
-.left_class_mapping = 21983,
-.right_class_mapping = 22108,
+.class_pair_values = 1000,
+.left_class_mapping = 2400,
+.right_class_mapping = 2525,
+.block_num = 5,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 22497,
+.lvglFontBufSize = 2914,
 };
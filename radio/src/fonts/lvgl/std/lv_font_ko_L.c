@@ -198,7 +198,7 @@ static const uint8_t lz4FontData[] ={
 0x75,0x7d,0x08,0x00,0x22,0x5b,0x7e,0x08,0x00,0x22,0x41,0x7f,0x08,0x00,0x22,0x27,
 0x80,0x08,0x00,0x22,0x0d,0x81,0x60,0x00,0xa2,0xd1,0x81,0x81,0x12,0x12,0x13,0x00,
 0x00,0x7c,0x82,0xd0,0x02,0xa2,0x60,0x83,0x01,0x12,0x11,0x18,0x00,0xfc,0x2c,0x84,
-0xf0,0x02,0x22,0x04,0x85,0x98,0x00,0x13,0xbf,0x08,0x00,0xf1,0xff,0xff,0xff,0x7e,
+0xf0,0x02,0x22,0x04,0x85,0x98,0x00,0x13,0xbf,0x08,0x00,0xf8,0xff,0xff,0xff,0x7d,
 0x00,0x00,0x50,0xab,0x54,0xab,0x58,0xab,0x60,0xab,0x62,0xab,0x65,0xab,0x69,0xab,
 0x6c,0xab,0x81,0xab,0xc0,0xab,0xc4,0xab,0xd0,0xab,0xdc,0xab,0xf0,0xab,0xf8,0xab,
 0xf9,0xab,0x00,0xac,0x0d,0xac,0x14,0xac,0x30,0xac,0x31,0xac,0x41,0xac,0x45,0xac,
@@ -255,16 +255,57 @@ static const uint8_t lz4FontData[] ={
 0xb0,0xd4,0xb8,0xd4,0xb9,0xd4,0xbd,0xd4,0xc4,0xd4,0xd9,0xd4,0xf5,0xd4,0x18,0xd5,
 0x28,0xd5,0x2d,0xd5,0x3c,0xd5,0x54,0xd5,0x65,0xd5,0x88,0xd5,0x90,0xd5,0x9d,0xd5,
 0xa4,0xd5,0xa5,0xd5,0xa8,0xd5,0xac,0xd5,0xb9,0xd5,0xdc,0xd5,0xf8,0xd5,0x14,0xd6,
-0x70,0xd6,0x84,0xd6,0xc0,0xd6,0xd8,0xd6,0x0f,0xf3,0x02,0x00,0x15,0xf2,0x02,0x00,
-0x21,0xf1,0x0e,0x02,0x00,0xf0,0x32,0x04,0x50,0x00,0x00,0x04,0x60,0x1f,0xf5,0x0c,
-0xe3,0x6f,0x43,0xf6,0x6f,0x33,0xf6,0x6f,0x23,0xf5,0x6f,0x13,0xf4,0x6f,0x03,0xf2,
-0x5c,0x03,0xd1,0x00,0x00,0x08,0xf2,0x00,0xbf,0x00,0x00,0x00,0x0b,0xf0,0x00,0xec,
-0x00,0x00,0x00,0x0e,0xc0,0x02,0xf8,0x00,0x00,0x00,0x1f,0x90,0x05,0xf5,0x00,0x00,
-0x00,0x4f,0x60,0x08,0xf2,0x00,0x0b,0xff,0x01,0x00,0xf1,0x16,0xf7,0x07,0xaa,0xef,
-0xaa,0xaf,0xea,0xa4,0x00,0x00,0xec,0x00,0x1f,0x90,0x00,0x00,0x01,0xf9,0x00,0x5f,
-0x50,0x00,0x00,0x05,0xf5,0x00,0x8f,0x20,0x00,0x6a,0xac,0xfb,0xaa,0xef,0xaa,0x50,
-0x9f,0x2a,0x00,0x1f,0x90,0x45,0x00,0x01,0xd0,0x00,0x00,0x7f,0x30,0x0b,0xf0,0x00,
-0x00,0x00,0xaf,0x00,0x0e,0xc0,0xbb,0x15,0x20,0x06,0x60,0x06,0x00,0x25,0x0d,0xe0,
+0x70,0xd6,0x84,0xd6,0xc0,0xd6,0xd8,0xd6,0x00,0x01,0x00,0x2f,0xf9,0x00,0x01,0x00,
+0x02,0x13,0xec,0x08,0x00,0x17,0xea,0x14,0x00,0xbe,0xf7,0xf5,0x00,0xfc,0xf5,0x00,
+0xf1,0x00,0x00,0x00,0x02,0x31,0x00,0x4d,0x04,0x03,0x00,0x04,0x15,0x00,0x2f,0xe0,
+0x00,0x01,0x00,0x14,0x1f,0xd6,0x1d,0x00,0x09,0x03,0x84,0x00,0xb1,0xf5,0x00,0xfe,
+0x00,0x00,0xe8,0xfd,0xf0,0xf3,0x00,0xee,0x11,0x00,0x00,0x0f,0x00,0x4c,0xfd,0xfe,
+0xf7,0xfa,0x8e,0x00,0x7e,0xfb,0x00,0xfc,0x00,0x00,0xf6,0x00,0x01,0x00,0x1c,0xfb,
+0x0a,0x00,0x19,0xfe,0x1f,0x00,0x11,0xfd,0x06,0x00,0x53,0xed,0x00,0x00,0x00,0xfc,
+0x46,0x00,0x3f,0xfc,0xf8,0xfc,0x98,0x00,0x09,0x05,0xf0,0x00,0x21,0xfc,0xfd,0x33,
+0x00,0x25,0xfd,0xfb,0x2f,0x00,0x11,0xd4,0xfd,0x00,0x15,0xcf,0x23,0x00,0x9a,0xfa,
+0xfc,0x00,0x00,0xfc,0xfb,0x00,0x00,0xfc,0x51,0x00,0x13,0x03,0x8c,0x00,0x2f,0x03,
+0xfb,0x65,0x00,0x06,0x1f,0xfc,0x3a,0x01,0x0c,0x10,0xf4,0x5e,0x00,0x0a,0xfe,0x00,
+0x10,0xfb,0x37,0x00,0x20,0xf9,0xf4,0x0e,0x00,0x14,0xc1,0xab,0x00,0x96,0xf4,0x00,
+0x00,0xcc,0xf6,0xdf,0xe5,0x00,0xd3,0x2a,0x00,0x34,0xf8,0xe7,0xef,0x0b,0x00,0x72,
+0xc3,0x00,0x00,0x00,0xe6,0x00,0xdb,0xab,0x00,0x51,0x00,0xfb,0x00,0xfe,0xfe,0x1d,
+0x01,0x3d,0x03,0x00,0x03,0x70,0x00,0x4e,0xf8,0x00,0xfb,0xfc,0x35,0x02,0x09,0x01,
+0x00,0x10,0xf1,0xb5,0x00,0x1c,0xf7,0x16,0x00,0x01,0x34,0x00,0xb1,0xd7,0xd5,0x00,
+0x00,0xf1,0xfb,0xd3,0xfd,0x03,0x00,0x03,0x5d,0x00,0xd2,0xeb,0xed,0x00,0xec,0xed,
+0xf2,0xea,0x00,0xee,0xf3,0xf5,0xf2,0xf5,0x54,0x01,0x66,0xd6,0xf9,0x00,0x00,0xf2,
+0xfe,0x23,0x01,0xa3,0xf7,0xf8,0x00,0x00,0xf7,0xfa,0x00,0x00,0xfb,0xfe,0x73,0x01,
+0x40,0x03,0x00,0xe9,0xf5,0x88,0x00,0x14,0x00,0x9e,0x00,0x33,0x02,0xfa,0xfa,0x62,
+0x01,0x16,0x00,0x15,0x00,0x14,0xf7,0xe7,0x01,0x15,0x03,0xf3,0x01,0x10,0xfc,0x18,
+0x01,0x13,0xfa,0x91,0x01,0xf6,0x10,0x04,0xf7,0xd8,0xf6,0x00,0x00,0xee,0xfb,0xee,
+0xfd,0x03,0xee,0x03,0x03,0x02,0x03,0x00,0x03,0xf2,0xf4,0xfc,0xf9,0xf4,0xf9,0xf5,
+0xfc,0xf9,0xfc,0x00,0xfc,0xfa,0xcc,0x02,0x2a,0x02,0xfb,0x8e,0x01,0x01,0x46,0x00,
+0x1b,0xfb,0xb1,0x01,0x14,0xfd,0x3f,0x02,0x0c,0x01,0x00,0x1e,0xf3,0x29,0x01,0x0c,
+0x72,0x02,0x0f,0xfc,0x01,0x07,0x01,0xa3,0x02,0x2c,0xfd,0xfd,0xa9,0x02,0x0f,0x4c,
+0x00,0x08,0x0f,0x46,0x00,0x06,0x02,0x0a,0x01,0x0d,0xa2,0x03,0x19,0x03,0x60,0x02,
+0x11,0x04,0xfe,0x02,0x0f,0x01,0x00,0x21,0x0a,0xa6,0x02,0x1f,0xe7,0xa9,0x00,0x0b,
+0x22,0xfc,0xfd,0x96,0x01,0x1c,0xe9,0x22,0x02,0x11,0xfc,0x8f,0x00,0x10,0x09,0x1c,
+0x02,0x0f,0x6c,0x00,0x13,0x17,0x03,0xaa,0x04,0x05,0x60,0x00,0x2c,0xfe,0x02,0x0d,
+0x01,0x1f,0xe9,0xd2,0x00,0x23,0x0e,0x7b,0x03,0x0e,0xf5,0x01,0x0f,0x3b,0x00,0x1a,
+0x12,0x01,0xab,0x04,0x21,0x02,0x03,0x6c,0x01,0x2d,0x04,0x05,0x21,0x00,0xf1,0x0c,
+0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,
+0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,0xff,0x0d,0x1a,
+0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,
+0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x00,0x01,0x00,0xff,0xc4,0x02,
+0x33,0x02,0x20,0x03,0x02,0x2e,0x02,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,
+0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xf1,0x08,0x0b,
+0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x00,0x00,0x00,0x16,
+0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,
+0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x2d,0x02,0xff,0xbd,0x50,
+0x00,0x00,0x00,0x00,0x00,0x21,0x0f,0xf3,0x02,0x00,0x15,0xf2,0x02,0x00,0x21,0xf1,
+0x0e,0x02,0x00,0xf0,0x32,0x04,0x50,0x00,0x00,0x04,0x60,0x1f,0xf5,0x0c,0xe3,0x6f,
+0x43,0xf6,0x6f,0x33,0xf6,0x6f,0x23,0xf5,0x6f,0x13,0xf4,0x6f,0x03,0xf2,0x5c,0x03,
+0xd1,0x00,0x00,0x08,0xf2,0x00,0xbf,0x00,0x00,0x00,0x0b,0xf0,0x00,0xec,0x00,0x00,
+0x00,0x0e,0xc0,0x02,0xf8,0x00,0x00,0x00,0x1f,0x90,0x05,0xf5,0x00,0x00,0x00,0x4f,
+0x60,0x08,0xf2,0x00,0x0b,0xff,0x01,0x00,0xf1,0x16,0xf7,0x07,0xaa,0xef,0xaa,0xaf,
+0xea,0xa4,0x00,0x00,0xec,0x00,0x1f,0x90,0x00,0x00,0x01,0xf9,0x00,0x5f,0x50,0x00,
+0x00,0x05,0xf5,0x00,0x8f,0x20,0x00,0x6a,0xac,0xfb,0xaa,0xef,0xaa,0x50,0x9f,0x2a,
+0x00,0x1f,0x90,0x45,0x00,0x01,0xf0,0x04,0x00,0x00,0x7f,0x30,0x0b,0xf0,0x00,0x00,
+0x00,0xaf,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,0x06,0x60,0x06,0x00,0x25,0x0d,0xe0,
 0x06,0x00,0xf0,0x16,0x06,0xbf,0xfb,0x50,0x00,0x00,0xbf,0xff,0xff,0xf9,0x00,0x08,
 0xfe,0x51,0x18,0xff,0x50,0x0e,0xf6,0x00,0x00,0xaf,0xc0,0x0f,0xf2,0x00,0x00,0x4f,
 0xf0,0x0f,0xf3,0x00,0x00,0x1a,0xa0,0x0b,0xfc,0x2e,0x00,0x30,0x03,0xff,0xd6,0x07,
@@ -272,3174 +313,3918 @@ static const uint8_t lz4FontData[] ={
 0xff,0x70,0x07,0x00,0xf0,0x10,0x9f,0xe0,0x58,0x40,0x00,0x00,0x1f,0xf2,0x9f,0x90,
 0x00,0x00,0x0f,0xf2,0x6f,0xe1,0x00,0x00,0x6f,0xf0,0x0e,0xfd,0x52,0x37,0xff,0x90,
 0x03,0xef,0xff,0xff,0xfa,0x66,0x00,0x20,0xe8,0x40,0x9b,0x00,0x23,0xa0,0x00,0x06,
-0x00,0x31,0x04,0xcf,0xd8,0x4b,0x16,0x31,0x3f,0xd7,0x9f,0x14,0x00,0xf2,0x1e,0xaf,
-0x10,0x09,0xf1,0x00,0x1e,0x40,0x00,0xcd,0x00,0x06,0xf3,0x00,0xbe,0x00,0x00,0xae,
-0x00,0x07,0xf2,0x06,0xf4,0x00,0x00,0x6f,0x92,0x4e,0xd0,0x1e,0xa0,0x00,0x00,0x08,
-0xff,0xfd,0x20,0xae,0x10,0x00,0x00,0x00,0x13,0x20,0x05,0xf5,0x86,0x16,0x41,0x1e,
-0xb0,0x01,0x10,0x3b,0x00,0xc0,0x12,0xcf,0xfc,0x30,0x00,0x00,0x04,0xf6,0x0d,0xe7,
-0x6e,0xe0,0x4b,0x01,0x20,0x4f,0x50,0x23,0x00,0xf0,0x0f,0x9f,0x20,0x6f,0x20,0x01,
-0xf8,0x00,0x03,0xf7,0x00,0x6f,0x20,0x01,0xf7,0x00,0x0c,0xd0,0x00,0x4f,0x60,0x05,
-0xf5,0x00,0x01,0x20,0x00,0x0c,0xf8,0x8f,0xd0,0x39,0x00,0x90,0x01,0x9e,0xfb,0x10,
-0x00,0x07,0xdf,0xea,0x20,0x45,0x00,0xf0,0x10,0xfd,0xef,0xf3,0x00,0x00,0x02,0xff,
-0x50,0x09,0xfb,0x00,0x00,0x06,0xfd,0x00,0x02,0xfd,0x00,0x00,0x05,0xfd,0x00,0x05,
-0xfb,0x00,0x00,0x01,0xff,0x40,0x4e,0xf3,0x4a,0x01,0xa0,0xe9,0xff,0x50,0x00,0x00,
-0x00,0x0c,0xff,0xd2,0x00,0x0e,0x00,0xf0,0xa4,0xff,0xb0,0x00,0x00,0x00,0x09,0xff,
-0x5e,0xf9,0x00,0x2e,0xc0,0x5f,0xf3,0x03,0xff,0x60,0x4f,0xb0,0xbf,0x90,0x00,0x5f,
-0xf4,0x8f,0x80,0xcf,0x60,0x00,0x08,0xff,0xef,0x30,0xaf,0x90,0x00,0x00,0xaf,0xfb,
-0x00,0x4f,0xf4,0x00,0x00,0x9f,0xfc,0x00,0x08,0xff,0xb9,0xae,0xfe,0xef,0x90,0x00,
-0x3a,0xef,0xfc,0x71,0x3f,0xf6,0xcf,0xcf,0xce,0xcd,0xcc,0x87,0x00,0x00,0x00,0x10,
-0x00,0x01,0xc9,0x00,0x00,0xcf,0x40,0x00,0x9f,0x60,0x00,0x3f,0xb0,0x00,0x0c,0xf3,
-0x00,0x03,0xfd,0x00,0x00,0x9f,0x80,0x00,0x0d,0xf3,0x00,0x01,0xff,0x00,0x00,0x4f,
-0xe0,0x00,0x05,0xfc,0x00,0x00,0x6f,0xb0,0x00,0x06,0xfb,0x00,0x00,0x5f,0xc0,0x00,
-0x04,0xfd,0x00,0x00,0x1f,0xf0,0x00,0x00,0xef,0x20,0x00,0x0a,0xf6,0x00,0x00,0x4f,
-0xb0,0x00,0x00,0xdf,0x20,0x00,0x05,0xfa,0x00,0x00,0x0b,0xf4,0x00,0x00,0x1e,0xe2,
-0x00,0x00,0x2e,0x90,0x00,0x00,0x12,0x01,0x00,0x00,0x06,0xe3,0x00,0x00,0x2e,0xe2,
-0x00,0x00,0x3f,0xc0,0x00,0x00,0x8f,0x60,0x00,0x01,0xfe,0x00,0x32,0x00,0x00,0x44,
-0x00,0xf1,0x05,0x00,0xff,0x00,0x00,0x0d,0xf4,0x00,0x00,0xbf,0x70,0x00,0x09,0xf8,
-0x00,0x00,0x8f,0x90,0x00,0x08,0xf9,0x75,0x00,0x21,0x0a,0xf7,0x8c,0x00,0x21,0x0f,
-0xf1,0x86,0x00,0xf0,0x06,0x8f,0x70,0x00,0x0e,0xf1,0x00,0x06,0xf8,0x00,0x01,0xee,
-0x00,0x00,0xcf,0x30,0x00,0x6f,0x40,0x00,0x01,0x20,0xfc,0x00,0x21,0xbf,0x10,0x52,
-0x02,0x02,0x05,0x00,0xf0,0x09,0x5f,0xa4,0x9f,0x17,0xda,0x5d,0xff,0xff,0xff,0xfb,
-0x00,0x29,0xff,0xc5,0x10,0x00,0x0c,0xfe,0xe1,0x00,0x00,0x8f,0x85,0xfb,0x43,0x00,
-0xb1,0xaf,0x60,0x00,0x83,0x00,0x1b,0x10,0x00,0x00,0x02,0x86,0xb3,0x01,0x11,0x5f,
-0x78,0x01,0x2c,0x05,0xfd,0x0d,0x00,0x71,0x11,0x11,0x5f,0xd1,0x11,0x10,0x1f,0xc8,
-0x02,0x11,0x91,0x06,0x00,0x1e,0xf9,0x27,0x00,0x0b,0x0d,0x00,0xf0,0x0a,0x08,0xf9,
-0x08,0xf9,0x09,0xf8,0x0d,0xf3,0x4f,0xc0,0x3c,0x20,0x7c,0xcc,0xcc,0x19,0xff,0xff,
-0xf2,0x07,0x70,0x4f,0xf5,0x1d,0xe2,0xda,0x02,0x10,0xf0,0x5b,0x02,0x10,0x90,0x9a,
-0x02,0x50,0x30,0x00,0x00,0x00,0xfd,0xe8,0x02,0x10,0xf7,0xbc,0x01,0x50,0xf1,0x00,
-0x00,0x00,0x2f,0xb9,0x01,0x10,0x8f,0x8f,0x02,0x10,0xee,0x4c,0x00,0x10,0xf8,0x86,
-0x03,0x10,0xf2,0x97,0x02,0x10,0xc0,0xd7,0x01,0x00,0x20,0x03,0x10,0xdf,0xef,0x02,
-0x50,0xf9,0x00,0x00,0x00,0x0a,0xf8,0x01,0x10,0x0f,0x74,0x00,0x10,0x6f,0xe8,0x02,
-0x11,0x58,0x70,0x02,0xf0,0x0a,0x19,0xdf,0xeb,0x50,0x00,0x02,0xef,0xfd,0xef,0xf8,
-0x00,0x0c,0xfb,0x10,0x05,0xff,0x30,0x2f,0xf1,0x00,0x00,0x9f,0xa0,0x6f,0xb0,0xae,
-0x01,0x20,0x9f,0x90,0x9f,0x01,0x80,0xaf,0x80,0x00,0x00,0x1f,0xf1,0xaf,0x80,0x0e,
-0x03,0x07,0x06,0x00,0x12,0xf1,0x06,0x00,0xc1,0x8f,0x90,0x00,0x00,0x2f,0xf0,0x6f,
-0xc0,0x00,0x00,0x4f,0xd0,0x3c,0x00,0x30,0x90,0x0b,0xfc,0x48,0x00,0x50,0x02,0xef,
-0xfc,0xef,0xf8,0x60,0x00,0x10,0xfc,0x68,0x02,0xff,0x05,0x5b,0x80,0x39,0xff,0xf8,
-0xdf,0xff,0xef,0x8f,0xb5,0x0a,0xf8,0x10,0x00,0xaf,0x80,0x00,0x0a,0xf8,0x00,0x07,
-0x00,0x13,0x00,0x64,0x02,0xf0,0x0c,0x50,0x00,0x06,0xff,0xfd,0xff,0xfa,0x00,0x3f,
-0xf7,0x00,0x06,0xff,0x50,0xaf,0xa0,0x00,0x00,0xaf,0xb0,0xdf,0x50,0x00,0x00,0x6f,
-0xc0,0x23,0xe6,0x00,0x01,0x74,0x03,0x20,0xcf,0x40,0x18,0x01,0x01,0xdd,0x03,0x10,
-0x4f,0x01,0x01,0x20,0x02,0xef,0x78,0x00,0x20,0x2e,0xf7,0x1b,0x03,0x20,0xdf,0x80,
-0x47,0x01,0x11,0xf9,0x27,0x00,0x10,0xa0,0x22,0x01,0x11,0xfb,0xf5,0x02,0x62,0xfc,
-0xcc,0xcc,0xcc,0xc7,0x9f,0xa1,0x01,0xf0,0x01,0x3a,0xef,0xeb,0x40,0x00,0x7f,0xff,
-0xde,0xff,0x80,0x3f,0xf6,0x00,0x06,0xff,0x39,0x83,0x02,0x61,0xf8,0x57,0x30,0x00,
-0x00,0x8f,0x31,0x00,0x10,0xf7,0xa4,0x01,0xc0,0xfe,0x00,0x00,0x5c,0xdf,0xfc,0x20,
-0x00,0x06,0xff,0xff,0xb2,0x62,0x00,0x21,0xaf,0xe2,0x36,0x02,0x11,0xa0,0xc5,0x01,
-0xf0,0x09,0x9b,0x30,0x00,0x00,0x5f,0xeb,0xf9,0x00,0x00,0x08,0xfb,0x5f,0xf6,0x00,
-0x05,0xff,0x50,0x9f,0xfe,0xde,0xff,0x80,0x00,0x4b,0x58,0x00,0x10,0x00,0x78,0x03,
-0x11,0x90,0x6d,0x02,0x11,0xf9,0xf9,0x01,0x01,0x0d,0x00,0x21,0x1e,0xfb,0x96,0x01,
-0x10,0xf6,0x66,0x01,0xa0,0x05,0xfc,0x09,0xf9,0x00,0x00,0x01,0xef,0x20,0x9f,0x68,
-0x03,0x30,0x70,0x09,0xf9,0x4f,0x01,0x91,0x00,0x9f,0x90,0x00,0x0e,0xf3,0x00,0x09,
-0xf9,0xd9,0x02,0xa1,0x9f,0x90,0x03,0xff,0xdc,0xcc,0xce,0xfe,0xcb,0x6f,0x54,0x02,
-0x10,0xf0,0xb1,0x03,0x01,0x4e,0x00,0x00,0x27,0x00,0x0a,0x0d,0x00,0x11,0xcf,0x20,
-0x00,0x11,0xdf,0x06,0x00,0x21,0xff,0x10,0x7e,0x00,0x10,0x00,0xb1,0x00,0x01,0x77,
-0x02,0x31,0x04,0xfb,0x00,0x2a,0x01,0xf1,0x01,0x9e,0xfe,0x91,0x00,0x07,0xff,0xff,
-0xff,0xfe,0x20,0x05,0xdb,0x30,0x15,0xef,0xd0,0xc1,0x04,0x20,0xf3,0x00,0x59,0x02,
-0x20,0xf7,0x00,0x99,0x00,0x30,0xf8,0x19,0x80,0x0c,0x00,0x00,0x37,0x05,0xf0,0x15,
-0x1f,0xf3,0x09,0xfd,0x20,0x01,0xcf,0xd0,0x00,0xcf,0xfd,0xdf,0xfe,0x20,0x00,0x07,
-0xcf,0xfd,0x91,0x00,0x00,0x00,0x18,0xce,0xe0,0x00,0x00,0x06,0xff,0xfe,0xc0,0x00,
-0x00,0x7f,0xf8,0x10,0x71,0x04,0x10,0x30,0x88,0x00,0x20,0xf6,0x00,0x04,0x06,0x70,
-0xf1,0x7b,0xcb,0x50,0x00,0x2f,0xed,0x31,0x05,0xe0,0x5f,0xff,0x71,0x06,0xff,0x70,
-0x6f,0xf4,0x00,0x00,0x7f,0xe0,0x7f,0xc0,0x5b,0x05,0x00,0x06,0x00,0x40,0x0e,0xf4,
-0x5f,0xe0,0xba,0x03,0x20,0x3f,0xf1,0x53,0x02,0xf2,0x09,0x0d,0xf8,0x00,0x00,0x6f,
-0xe0,0x05,0xff,0x50,0x03,0xef,0x70,0x00,0x9f,0xfe,0xdf,0xfb,0x00,0x00,0x05,0xcf,
-0xfc,0x60,0x00,0x47,0x03,0x71,0x71,0xcc,0xcc,0xcc,0xcc,0xcf,0xf4,0xba,0x05,0x02,
-0x3c,0x03,0x11,0xaf,0xfb,0x05,0x21,0x2f,0xe0,0xfa,0x00,0x12,0xf8,0x62,0x01,0x01,
-0xd1,0x02,0x21,0x8f,0xa0,0x7f,0x00,0x11,0xf2,0xe5,0x00,0x11,0xfb,0x2c,0x00,0x26,
-0xef,0x40,0x6e,0x03,0x21,0x0d,0xf6,0x04,0x01,0x21,0xfe,0x00,0x0d,0x02,0x11,0x70,
-0xf5,0x00,0x11,0xf1,0xef,0x00,0x02,0x3f,0x01,0x10,0x29,0x6e,0x02,0xd1,0x03,0xff,
-0xfd,0xef,0xfa,0x00,0x0d,0xfb,0x10,0x06,0xff,0x50,0x3f,0x10,0x03,0x80,0x3f,0xe0,
-0x00,0x00,0x7f,0xb0,0x1f,0xf2,0x92,0x02,0xf0,0x09,0x08,0xfd,0x40,0x18,0xfe,0x10,
-0x00,0x7f,0xff,0xff,0xc2,0x00,0x01,0xbf,0xfd,0xef,0xe5,0x00,0x0c,0xfa,0x00,0x05,
-0xff,0x40,0x61,0x00,0x44,0x6f,0xd0,0x9f,0x90,0x2e,0x03,0x02,0xe7,0x00,0xf0,0x04,
-0x5f,0xf0,0x2f,0xf9,0x00,0x03,0xef,0x90,0x05,0xff,0xfd,0xef,0xfc,0x00,0x00,0x2a,
-0xef,0xfc,0x60,0x06,0x00,0xf0,0x0b,0xe9,0x10,0x00,0x5f,0xff,0xdf,0xfe,0x20,0x1f,
-0xf9,0x00,0x1b,0xfd,0x07,0xfc,0x00,0x00,0x0e,0xf5,0xbf,0x70,0x00,0x00,0x8f,0x9c,
-0xf5,0x0d,0x02,0x00,0x0b,0x00,0xf0,0x09,0x4f,0xe8,0xfc,0x00,0x00,0x09,0xfe,0x2f,
-0xf8,0x00,0x08,0xff,0xd0,0x6f,0xff,0xdf,0xfb,0xfc,0x00,0x4b,0xff,0xb3,0x6f,0xa0,
-0xac,0x00,0x11,0xf7,0xf0,0x00,0x01,0xeb,0x05,0xf9,0x0a,0xb0,0x00,0x00,0x03,0xcf,
-0xf2,0x00,0x05,0xdf,0xff,0xd3,0x00,0x00,0x6f,0xeb,0x60,0x00,0x00,0x2e,0xd1,0x5f,
-0xf3,0x08,0x70,0x00,0x01,0x00,0xca,0x07,0x60,0x5f,0xf3,0x2e,0xd1,0x06,0xfa,0x0a,
-0xff,0x02,0x84,0x1a,0x00,0xc2,0x05,0xea,0x06,0xfb,0x06,0xfa,0x0a,0xf6,0x1f,0xe1,
-0x3d,0x40,0x12,0x00,0xf0,0x06,0x18,0x50,0x00,0x00,0x02,0x9f,0xf7,0x00,0x00,0x2a,
-0xff,0xfc,0x30,0x04,0xbf,0xff,0x92,0x00,0x1c,0xff,0xd6,0xde,0x01,0x20,0xa1,0x00,
-0xbb,0x06,0x10,0xf9,0xe5,0x01,0x30,0x7e,0xff,0xc6,0x60,0x01,0x20,0xdf,0xff,0x34,
-0x00,0x21,0x5c,0xf7,0x54,0x01,0x73,0x40,0x3e,0xee,0xee,0xee,0xee,0x83,0xf1,0x04,
-0x0a,0x01,0x00,0x10,0x03,0x1b,0x00,0x21,0xe8,0x3f,0xdb,0x07,0x01,0x79,0x04,0x41,
-0x06,0xff,0xa3,0x00,0x62,0x00,0x11,0x50,0x80,0x07,0x10,0xd6,0x24,0x00,0x30,0xaf,
-0xfe,0x50,0x9d,0x04,0x80,0xf9,0x00,0x00,0x28,0xef,0xfb,0x30,0x05,0x7a,0x00,0x70,
-0x4e,0xff,0xe7,0x10,0x00,0x06,0xfd,0xed,0x01,0x33,0x44,0x00,0x00,0xb1,0x04,0xf0,
-0x09,0x40,0x00,0x2e,0xff,0xff,0xff,0x60,0x0b,0xfc,0x20,0x09,0xff,0x10,0xff,0x30,
-0x00,0x0e,0xf4,0x02,0x20,0x00,0x00,0xdf,0x50,0xdf,0x04,0x10,0xf3,0x10,0x02,0x10,
-0xfc,0xa9,0x00,0x00,0x1f,0x01,0x10,0x07,0xa0,0x00,0x11,0x03,0xa5,0x00,0x25,0x9f,
-0xa0,0xda,0x02,0x16,0x12,0x98,0x00,0x25,0x26,0x10,0x1a,0x04,0x21,0x9f,0x50,0x12,
-0x00,0x41,0x38,0xcf,0xfe,0xc8,0x18,0x06,0x61,0x1a,0xff,0xc9,0x9a,0xdf,0xf9,0x4a,
-0x04,0xa1,0x81,0x00,0x00,0x01,0x9f,0xc0,0x00,0x00,0x1e,0xf3,0x32,0x01,0x42,0xf9,
-0x00,0x00,0xaf,0x2c,0x01,0x20,0x8f,0x20,0x5a,0x05,0xf0,0x37,0x4c,0xfd,0x91,0x00,
-0x0e,0x90,0x0a,0xf1,0x00,0x06,0xfd,0x8a,0xfd,0x00,0x09,0xe0,0x0f,0xc0,0x00,0x2f,
-0xc0,0x00,0xed,0x00,0x05,0xf2,0x4f,0x70,0x00,0xbf,0x20,0x00,0xfb,0x00,0x03,0xf4,
-0x7f,0x40,0x01,0xfc,0x00,0x01,0xfa,0x00,0x02,0xf5,0x8f,0x20,0x04,0xf8,0x00,0x03,
-0xf8,0x00,0x02,0xf5,0x9f,0x10,0x07,0xf6,0x00,0x04,0xf7,0x00,0x03,0xf4,0x9f,0x20,
-0x08,0xf5,0x07,0x09,0xf0,0x10,0x05,0xf2,0x8f,0x20,0x08,0xf6,0x00,0x0a,0xf5,0x00,
-0x0b,0xe0,0x6f,0x50,0x05,0xfc,0x00,0x5f,0xf7,0x00,0x3f,0x70,0x2f,0x90,0x00,0xef,
-0xdc,0xf7,0xff,0x78,0xfc,0xe5,0x08,0x60,0x2c,0xfd,0x50,0x3c,0xfe,0x80,0xc9,0x06,
-0x04,0x01,0x00,0x24,0xcf,0x60,0x0a,0x00,0x11,0x1d,0x86,0x03,0x01,0x0d,0x03,0x52,
-0xbf,0xfb,0x88,0x9b,0xfb,0x7b,0x01,0x52,0x9d,0xff,0xec,0x82,0x00,0x71,0x06,0x12,
-0xf0,0x08,0x00,0x32,0xbf,0xf6,0x00,0x32,0x03,0x00,0x2f,0x05,0x00,0x7d,0x06,0x21,
-0xef,0x20,0x1c,0x03,0x31,0xf3,0x9f,0x80,0x40,0x05,0x10,0xe0,0xef,0x02,0x00,0xeb,
-0x02,0x22,0x0d,0xf4,0x69,0x02,0x32,0x08,0xfb,0x00,0x49,0x08,0x22,0xff,0x10,0x45,
-0x01,0x00,0x3a,0x03,0x00,0xee,0x05,0x41,0x7f,0xd0,0x00,0x00,0x42,0x05,0xe0,0xf3,
-0x00,0x00,0xef,0xed,0xdd,0xdd,0xdf,0xf9,0x00,0x05,0xff,0x00,0x00,0x05,0x00,0x21,
-0x0b,0xf9,0x7c,0x03,0x31,0x60,0x1f,0xf3,0x2a,0x01,0x31,0xc0,0x7f,0xd0,0xb2,0x03,
-0xe0,0xf2,0x0f,0xff,0xff,0xff,0xc8,0x10,0x00,0xff,0xee,0xee,0xff,0xfe,0x20,0xb0,
-0x01,0x40,0x4e,0xfb,0x00,0xff,0x3d,0x05,0x00,0xa1,0x09,0x00,0x62,0x00,0x06,0x0d,
-0x00,0xa1,0x4e,0xf7,0x00,0xff,0xdd,0xdd,0xef,0xf7,0x00,0x0f,0x14,0x0a,0x00,0x27,
-0x00,0x51,0x14,0xcf,0xb0,0x0f,0xf3,0xc7,0x08,0x00,0x27,0x00,0x21,0x0c,0xf8,0xf1,
-0x01,0x20,0xbf,0x80,0x0d,0x00,0x20,0x1f,0xf6,0x0d,0x00,0x90,0x2c,0xff,0x10,0xff,
-0xed,0xdd,0xef,0xff,0x40,0x34,0x00,0x10,0xd9,0xd8,0x00,0xf0,0x07,0x6c,0xef,0xea,
-0x40,0x00,0x00,0x2d,0xff,0xfe,0xff,0xf9,0x00,0x01,0xef,0xc3,0x00,0x07,0xff,0x70,
-0x0a,0xfc,0x00,0xd6,0x09,0x20,0x1f,0xf4,0x33,0x02,0x30,0xf5,0x5f,0xe0,0x22,0x03,
-0x20,0x94,0x7f,0x4b,0x07,0x03,0x29,0x02,0x0c,0x07,0x00,0x22,0x8f,0xb0,0x41,0x01,
-0x01,0x65,0x0a,0x31,0x83,0x1f,0xf3,0x38,0x00,0x12,0x0b,0x46,0x00,0xb0,0x01,0xff,
-0xb2,0x00,0x06,0xff,0x70,0x00,0x3e,0xff,0xee,0x48,0x0a,0x50,0x01,0x8d,0xff,0xea,
-0x30,0xb2,0x00,0xa0,0xec,0x81,0x00,0x00,0x0f,0xfe,0xee,0xef,0xff,0x60,0x97,0x02,
-0x31,0x01,0x8f,0xf7,0x9e,0x02,0x51,0x05,0xff,0x30,0x0f,0xf3,0x37,0x06,0x01,0x07,
-0x00,0x10,0x3f,0xe9,0x00,0x00,0x01,0x05,0x01,0x07,0x00,0x22,0x0e,0xf4,0x07,0x00,
-0x12,0xf5,0x15,0x00,0x18,0xf4,0x1c,0x00,0x27,0x4f,0xf0,0x38,0x00,0x02,0x46,0x00,
-0x01,0x54,0x00,0x21,0xfd,0xdd,0x62,0x00,0x03,0x70,0x00,0x10,0xff,0xbc,0x08,0x71,
-0x0f,0xfe,0xee,0xee,0xee,0xe9,0x0f,0x79,0x01,0x0f,0x06,0x00,0x06,0x51,0xfe,0xdd,
-0xdd,0xdd,0x80,0x30,0x00,0x1f,0xa0,0x2a,0x00,0x0c,0x06,0x30,0x00,0x11,0xdb,0x30,
-0x00,0x11,0xfd,0x06,0x00,0x11,0xf8,0x66,0x00,0x1f,0xe7,0x36,0x00,0x10,0x11,0x50,
-0x30,0x00,0x1f,0x60,0x66,0x00,0x12,0x07,0x06,0x00,0xf1,0x08,0x00,0x01,0x7c,0xef,
-0xeb,0x50,0x00,0x00,0x3e,0xff,0xfe,0xff,0xfb,0x00,0x02,0xff,0xc3,0x00,0x06,0xff,
-0xa0,0x0a,0xfc,0xe1,0x07,0x21,0x1f,0xf4,0xce,0x03,0x03,0xd1,0x02,0x28,0x7f,0xc0,
-0xa5,0x01,0xe1,0x9f,0xb0,0x00,0x08,0xdd,0xdd,0xd7,0x8f,0xb0,0x00,0x09,0xff,0xff,
-0xf9,0x1c,0x00,0x41,0x0a,0xf9,0x4f,0xf0,0x07,0x00,0x21,0x0f,0xf6,0x07,0x00,0x31,
-0x08,0xfe,0x10,0xf2,0x05,0xb0,0xdf,0xe4,0x00,0x01,0x7f,0xf7,0x00,0x1c,0xff,0xfd,
-0xef,0x93,0x07,0x42,0x5b,0xef,0xed,0x93,0x7d,0x00,0x02,0x87,0x02,0x00,0xe4,0x02,
-0x0f,0x0f,0x00,0x14,0x71,0xed,0xdd,0xdd,0xdd,0xdf,0xf1,0x0f,0xae,0x06,0x0f,0x3c,
-0x00,0x1d,0x0a,0x0f,0x00,0x3f,0xdf,0x6d,0xf6,0x03,0x00,0x03,0x11,0x60,0xd9,0x06,
-0x1f,0xf6,0x06,0x00,0x2f,0x20,0x4e,0xd0,0xbe,0x02,0x20,0x3f,0xf2,0x49,0x01,0xf2,
-0x03,0x0d,0xfc,0x20,0x03,0xef,0xc0,0x03,0xef,0xfe,0xef,0xfe,0x20,0x00,0x19,0xdf,
-0xfd,0x81,0x00,0x66,0x02,0x11,0xe2,0x94,0x03,0x21,0x8f,0xf3,0x0f,0x00,0x30,0x7f,
-0xf4,0x00,0x0f,0x00,0x21,0x5f,0xf6,0x9b,0x01,0x30,0x4f,0xf7,0x00,0x0f,0x00,0x21,
-0x3f,0xf9,0xaa,0x01,0x11,0x2e,0x66,0x04,0x32,0xff,0x5d,0xff,0xef,0x01,0x02,0xfb,
-0x05,0x40,0xff,0xfd,0x6f,0xf5,0x0f,0x00,0x40,0xfd,0x10,0x9f,0xf2,0x0f,0x00,0x41,
-0x40,0x00,0xcf,0xd0,0x3c,0x00,0x31,0x02,0xef,0xa0,0x4b,0x00,0x12,0x05,0x15,0x03,
-0x01,0xa6,0x05,0x01,0xc9,0x03,0x12,0xfd,0x78,0x00,0x41,0x1e,0xfa,0x00,0x0f,0xe7,
-0x07,0x0f,0x06,0x00,0x42,0x00,0x8d,0x02,0x11,0xd4,0xa4,0x01,0x22,0xf5,0x0f,0x2e,
-0x08,0x32,0x2f,0xff,0x0f,0xf5,0x0d,0x51,0x8f,0xff,0x0f,0xff,0xe0,0xb1,0x04,0x40,
-0xff,0x0f,0xfe,0xf4,0xc2,0x04,0x60,0xfe,0xff,0x0f,0xf8,0xfb,0x00,0x64,0x04,0x30,
-0xff,0x0f,0xf2,0x2e,0x00,0x32,0x2f,0xf3,0xff,0xf5,0x0a,0xf0,0x16,0x9f,0x92,0xff,
-0x0f,0xf2,0x4f,0xe0,0x00,0x00,0xef,0x33,0xff,0x0f,0xf2,0x0d,0xf4,0x00,0x05,0xfc,
-0x03,0xff,0x0f,0xf3,0x07,0xfb,0x00,0x0c,0xf6,0x04,0xff,0x0f,0xf3,0x01,0xff,0x10,
-0x2f,0xe0,0x09,0x00,0x51,0x00,0xaf,0x80,0x9f,0x90,0x09,0x00,0x41,0x3f,0xe0,0xff,
-0x20,0x09,0x00,0x41,0x0d,0xfb,0xfc,0x00,0x09,0x00,0x32,0x06,0xff,0xf5,0x09,0x00,
-0x33,0x00,0xff,0xe0,0x09,0x00,0x20,0x9f,0x80,0x09,0x00,0x13,0xf9,0x16,0x02,0x12,
-0xf3,0x16,0x02,0x22,0xff,0xd0,0x0f,0x00,0x21,0xff,0x80,0x0f,0x00,0x31,0xf9,0xff,
-0x30,0x0f,0x00,0x21,0x4b,0xfd,0x0f,0x00,0x31,0xf4,0x1f,0xf8,0x0f,0x00,0x31,0x40,
-0x6f,0xf2,0x0f,0x00,0x31,0x00,0xbf,0xc0,0x0f,0x00,0x31,0x02,0xff,0x70,0x0f,0x00,
-0x30,0x06,0xff,0x22,0x0f,0x00,0x31,0x00,0x0c,0xfc,0x0f,0x00,0x30,0x00,0x2f,0xf9,
-0x0f,0x00,0x00,0xf1,0x0d,0x11,0xf1,0x14,0x01,0x12,0xcf,0x0f,0x00,0x13,0x02,0x0f,
-0x00,0x30,0x08,0xff,0x10,0x30,0x05,0x00,0x37,0x05,0x40,0x02,0xdf,0xff,0xff,0x1b,
-0x01,0x90,0xef,0xd4,0x00,0x28,0xff,0x70,0x00,0x9f,0xd1,0xb4,0x07,0x31,0x20,0x0f,
-0xf4,0x12,0x01,0x11,0x05,0x40,0x09,0x41,0x6f,0xd0,0x7f,0xb0,0x4c,0x0f,0x31,0x09,
-0xfa,0x00,0xad,0x00,0x21,0x9f,0xa0,0xbc,0x00,0x13,0x19,0x0f,0x00,0x03,0x1e,0x00,
-0x04,0x2d,0x00,0x03,0x3c,0x00,0x01,0x4b,0x00,0x30,0x05,0xff,0x20,0x5a,0x00,0x32,
-0x17,0xff,0x70,0x69,0x00,0x11,0x80,0xa8,0x05,0x22,0xda,0x30,0xc2,0x04,0x30,0xeb,
-0x50,0x00,0x5d,0x04,0x21,0xff,0xfb,0x15,0x02,0x41,0x07,0xff,0x90,0x0f,0xb3,0x0e,
-0x02,0x01,0x05,0x28,0x1f,0xf3,0x07,0x00,0x10,0x6f,0x15,0x00,0x00,0x19,0x04,0x71,
-0x0f,0xfe,0xdd,0xde,0xff,0xfc,0x10,0x3f,0x00,0x14,0x60,0x42,0x04,0x0f,0x07,0x00,
-0x17,0x32,0x00,0x00,0x7c,0xf7,0x00,0x10,0xef,0xab,0x04,0xf1,0x03,0x00,0x01,0xff,
-0xc4,0x00,0x29,0xff,0x50,0x00,0xbf,0xc0,0x00,0x00,0x07,0xfe,0x10,0x1f,0xf3,0x3b,
-0x0a,0x22,0x06,0xfd,0x67,0x04,0x21,0x9f,0xa0,0x21,0x02,0x00,0xa1,0x0c,0x00,0x98,
-0x05,0x21,0xbf,0x80,0xe8,0x00,0x04,0x0f,0x00,0x03,0x1e,0x00,0x04,0x2d,0x00,0x03,
-0x3c,0x00,0x04,0x4b,0x00,0x92,0x01,0xff,0xc3,0x00,0x18,0xff,0x50,0x00,0x03,0x69,
-0x00,0x00,0x78,0x00,0x41,0xdf,0xfc,0x10,0x00,0x8e,0x10,0x21,0xfe,0x30,0x08,0x00,
-0x23,0x2c,0xfb,0xb5,0x09,0x13,0x00,0x2c,0x07,0x01,0x46,0x06,0x11,0xf4,0xab,0x00,
-0x32,0x3c,0xfe,0x10,0x00,0x07,0x02,0x4f,0x05,0x23,0xcf,0x80,0x01,0x07,0x02,0x15,
-0x00,0x10,0x50,0x07,0x00,0x20,0x3d,0xfd,0xea,0x02,0x31,0xdf,0xff,0xd2,0x3f,0x00,
-0x11,0xfa,0xe3,0x00,0x22,0x08,0xfd,0xea,0x00,0x22,0xef,0x60,0xd1,0x03,0x11,0xe0,
-0x07,0x00,0x32,0x0e,0xf7,0x00,0x3e,0x01,0x11,0x10,0x46,0x00,0x12,0xdf,0x4d,0x00,
-0x50,0x5f,0xf1,0x00,0x01,0x7c,0xc4,0x06,0x00,0x7a,0x05,0x00,0xd0,0x03,0x20,0xef,
-0xc3,0xe0,0x06,0x30,0x05,0xff,0x10,0x6f,0x01,0x21,0x07,0xfc,0x35,0x01,0x01,0x0e,
-0x00,0x00,0x2f,0x03,0x11,0xd3,0x07,0x00,0x31,0x2d,0xff,0xd8,0xbc,0x00,0x41,0x7d,
-0xff,0xfd,0x60,0x46,0x09,0x03,0xd4,0x00,0x32,0x04,0xef,0xc0,0x1a,0x11,0x31,0xf2,
-0x0f,0xf4,0x88,0x03,0x30,0x0b,0xfa,0x00,0x4a,0x03,0xe0,0x03,0xff,0xa2,0x00,0x04,
-0xdf,0xd0,0x00,0x4e,0xff,0xfd,0xff,0xfd,0x20,0xea,0x05,0x32,0xec,0x70,0x00,0xd9,
-0x0c,0x82,0xfc,0x5e,0xee,0xee,0xff,0xee,0xee,0xea,0x38,0x04,0x1f,0x00,0x07,0x00,
-0x4f,0x01,0xd5,0x07,0x30,0x4f,0xf5,0xfe,0xaf,0x00,0x1f,0xff,0x0d,0x00,0x2e,0x30,
-0x3f,0xf0,0x00,0xca,0x0c,0x00,0xdb,0x01,0xf2,0x08,0x0c,0xf9,0x07,0xff,0x70,0x00,
-0x2b,0xff,0x20,0x09,0xff,0xfe,0xef,0xff,0x40,0x00,0x04,0xae,0xff,0xd8,0x10,0x00,
-0x7f,0x5c,0x09,0x11,0xc1,0x82,0x00,0x41,0x0f,0xf6,0x0b,0xfa,0x2f,0x09,0x11,0x10,
-0xcb,0x06,0x30,0xbf,0xa0,0x00,0x97,0x11,0x40,0x1f,0xf4,0x00,0x0a,0x68,0x12,0x30,
-0xfe,0x00,0x00,0xb8,0x06,0x00,0x60,0x02,0x30,0xef,0x50,0x00,0x7e,0x0c,0x22,0x08,
-0xfa,0xe4,0x0e,0x22,0x2f,0xf0,0xf7,0x09,0x41,0xcf,0x50,0x1f,0xf1,0xe9,0x0c,0x21,
-0x07,0xfa,0x8d,0x12,0x31,0xf1,0xcf,0x50,0x5e,0x00,0x21,0x8f,0xe0,0x7e,0x01,0x03,
-0x89,0x0b,0x32,0x0e,0xff,0x30,0x21,0x07,0x11,0xd0,0x98,0x03,0x03,0x00,0x0d,0x20,
-0x9f,0xa0,0x23,0x0f,0x20,0x9f,0xf2,0x9e,0x02,0x00,0xbc,0x02,0x10,0x0d,0xef,0x03,
-0x80,0xff,0x20,0x6f,0xc0,0x00,0x02,0xfe,0xfb,0x06,0x0a,0xa0,0x03,0xff,0x00,0x00,
-0x7f,0x8e,0xf0,0x00,0x08,0xfa,0x27,0x02,0x70,0x0b,0xf4,0xaf,0x40,0x00,0xbf,0x70,
-0x03,0x00,0x30,0xff,0x06,0xf8,0x12,0x00,0x70,0x07,0xfb,0x00,0x4f,0xa0,0x1f,0xd0,
-0x27,0x00,0x90,0x3f,0xe0,0x09,0xf6,0x00,0xdf,0x10,0x6f,0xb0,0x42,0x00,0x40,0xdf,
-0x10,0x08,0xf6,0xa3,0x0c,0xf0,0x02,0x0b,0xf6,0x2f,0xc0,0x00,0x4f,0xa0,0xdf,0x30,
-0x00,0x00,0x7f,0x96,0xf8,0x00,0x00,0xfe,0xeb,0x11,0x80,0x04,0xfc,0xbf,0x30,0x00,
-0x0a,0xf7,0xfb,0xfd,0x00,0x70,0xee,0xe0,0x00,0x00,0x6f,0xdf,0x70,0xc8,0x00,0x10,
-0xf9,0xbf,0x02,0x11,0xf3,0x83,0x04,0x10,0x50,0x8b,0x00,0x02,0x4b,0x03,0x01,0x39,
-0x0a,0x40,0x00,0x00,0x0d,0xfb,0xb6,0x07,0x40,0xfe,0x00,0x3f,0xf5,0xd4,0x00,0xf1,
-0x00,0x50,0x00,0x9f,0xe1,0x00,0x00,0xdf,0xa0,0x00,0x00,0xef,0x90,0x00,0x8f,0xf1,
-0x0d,0x09,0x11,0x2f,0xd8,0x07,0x31,0xfd,0x0c,0xfc,0x06,0x01,0x31,0xfc,0xff,0x20,
-0x73,0x04,0x22,0xff,0x70,0xa4,0x02,0x12,0xf1,0x26,0x08,0x02,0x83,0x0f,0x21,0x2f,
-0xfc,0x0e,0x01,0x41,0x0c,0xfd,0x0b,0xfd,0x88,0x0c,0x30,0x30,0x2f,0xf8,0x7c,0x00,
-0xf0,0x00,0x80,0x00,0x7f,0xf2,0x00,0x00,0xbf,0xe0,0x00,0x00,0xdf,0xc0,0x00,0x5f,
-0xf4,0xd1,0x03,0x31,0x70,0x1e,0xfa,0x16,0x13,0x40,0x20,0x8f,0xf1,0x00,0x8b,0x0d,
-0x31,0x01,0xef,0x80,0x56,0x13,0x30,0x07,0xff,0x10,0x56,0x14,0x10,0x00,0xb4,0x0e,
-0x21,0x2f,0xf4,0x31,0x03,0x20,0x0a,0xfb,0xc5,0x00,0x40,0x90,0x03,0xff,0x20,0x39,
-0x00,0x31,0x10,0xbf,0x90,0x67,0x08,0x02,0x5a,0x0e,0x32,0x2f,0xfd,0xf7,0x98,0x08,
-0x13,0xfe,0x76,0x0b,0x12,0x60,0x79,0x04,0x03,0xfa,0x13,0x2f,0xff,0x50,0x0f,0x00,
-0x0e,0x11,0xdf,0x19,0x03,0x10,0x1b,0x44,0x0d,0x21,0xff,0xf0,0x53,0x00,0x01,0x52,
-0x00,0x02,0xee,0x00,0x11,0x07,0xed,0x00,0x12,0x02,0x56,0x00,0x21,0xdf,0xb0,0xe8,
-0x01,0x11,0xe1,0x3f,0x01,0x11,0xf4,0xfc,0x01,0x21,0xf9,0x00,0x1b,0x01,0x01,0xba,
-0x0c,0x01,0xfa,0x00,0x01,0xc7,0x00,0x10,0x00,0x90,0x04,0x00,0x24,0x01,0x11,0xf2,
-0x6e,0x00,0x62,0xff,0xdd,0xdd,0xdd,0xdd,0xd5,0xbe,0x08,0xaf,0x70,0x4f,0xff,0xf2,
-0x4f,0xfc,0xc1,0x4f,0xe0,0x00,0x03,0x00,0x23,0x00,0x3c,0x00,0x41,0xff,0xf2,0x5f,
-0xb0,0x06,0x10,0x00,0x39,0x01,0x15,0xf7,0x7c,0x10,0x01,0xa5,0x11,0x01,0xc3,0x0e,
-0x00,0xb7,0x02,0x00,0xc2,0x13,0x00,0x11,0x02,0x01,0xb9,0x00,0x10,0x30,0xa2,0x01,
-0x10,0x90,0x1a,0x00,0x10,0xe0,0x71,0x11,0x10,0xf5,0xaf,0x00,0x11,0xfb,0xbe,0x01,
-0x10,0x10,0x3c,0x01,0x14,0x70,0xee,0x0f,0x20,0x0c,0xf4,0x34,0x00,0xaf,0x84,0xef,
-0xff,0x8b,0xce,0xf8,0x00,0xaf,0x80,0x0a,0x05,0x00,0x18,0x40,0x8b,0xce,0xf8,0xef,
-0x6a,0x06,0x11,0x66,0x30,0x01,0x10,0x20,0xdb,0x01,0x10,0x90,0x86,0x02,0xf0,0x0d,
-0xf0,0x00,0x00,0x6f,0x88,0xf6,0x00,0x00,0xcf,0x22,0xfc,0x00,0x03,0xfb,0x00,0xcf,
-0x30,0x0a,0xf5,0x00,0x5f,0x90,0x1f,0xe0,0x00,0x0e,0xf1,0xbc,0x79,0x10,0x11,0x9f,
-0x97,0x04,0x51,0x17,0x83,0x00,0x07,0xfe,0x60,0x11,0x20,0x0b,0xf3,0x2f,0x12,0xe4,
-0x30,0x00,0x6f,0xfe,0xce,0xff,0x50,0x2f,0xf5,0x00,0x08,0xfe,0x04,0xa8,0x49,0x06,
-0xe0,0xef,0x40,0x04,0xae,0xff,0xff,0xf4,0x09,0xff,0xca,0x88,0xff,0x45,0xfe,0x9c,
-0x0e,0x10,0xaf,0xbe,0x03,0x20,0x4b,0xf9,0x2b,0x02,0xf2,0x02,0x7f,0xf4,0x00,0x4e,
-0xff,0x50,0xdf,0xff,0xff,0xee,0xf7,0x01,0x9e,0xfe,0x91,0x7c,0x80,0x94,0x10,0x0f,
-0x06,0x00,0x06,0xf0,0x04,0xd1,0x9e,0xfd,0x80,0x00,0x5f,0xee,0xfe,0xef,0xfc,0x00,
-0x5f,0xfc,0x20,0x04,0xff,0x80,0x5f,0xe1,0x5c,0x04,0x20,0x5f,0xd0,0x15,0x0c,0x00,
-0x06,0x00,0x20,0x0d,0xf5,0x06,0x00,0x26,0x0c,0xf5,0x0c,0x00,0x23,0x0f,0xf3,0x24,
-0x00,0x00,0x30,0x00,0x31,0x70,0x5f,0xde,0x3c,0x00,0x10,0xa1,0x48,0x00,0x20,0x00,
-0x18,0x3a,0x0f,0xc0,0x3e,0xff,0xde,0xff,0x70,0x0e,0xf9,0x00,0x06,0xff,0x36,0xfd,
-0x34,0x12,0x00,0x6a,0x10,0x35,0x38,0x6d,0xf4,0x27,0x11,0x11,0x0d,0x78,0x02,0x00,
-0x16,0x00,0x30,0x03,0x26,0xfd,0x1b,0x0e,0x20,0x0e,0xf9,0x37,0x02,0xa6,0x3e,0xff,
-0xce,0xff,0x60,0x00,0x19,0xdf,0xea,0x30,0xba,0x14,0x2d,0x05,0xfd,0x0b,0x00,0xf0,
-0x08,0x03,0xbe,0xfc,0x65,0xfd,0x04,0xff,0xfd,0xff,0xdf,0xd1,0xef,0xb1,0x00,0x6f,
-0xfd,0x6f,0xe0,0x00,0x00,0x8f,0xdb,0xf8,0x21,0x00,0x00,0x9f,0x0f,0x35,0x5f,0xde,
-0xf4,0x0b,0x00,0x20,0xda,0xf7,0x0b,0x00,0x11,0x6f,0x34,0x11,0xf0,0x13,0xef,0x70,
-0x00,0x3e,0xfd,0x04,0xff,0xda,0xbf,0xef,0xd0,0x03,0xbf,0xfd,0x73,0xfd,0x00,0x07,
-0xdf,0xeb,0x30,0x00,0x1d,0xff,0xde,0xff,0x50,0x0c,0xfa,0x10,0x07,0xff,0x15,0xfd,
-0x83,0x13,0x00,0x49,0x01,0x80,0x6f,0xbd,0xfd,0xcc,0xcc,0xcd,0xfc,0xef,0x92,0x01,
-0x12,0xdd,0xab,0x00,0x10,0x80,0xc6,0x03,0x00,0x92,0x03,0xf0,0x02,0x40,0x0d,0xfc,
-0x20,0x01,0xaf,0x60,0x2e,0xff,0xdd,0xff,0xc0,0x00,0x18,0xdf,0xfc,0x70,0x54,0x08,
-0x90,0xfe,0x40,0x00,0x9f,0xff,0xe4,0x00,0x1f,0xf7,0x3a,0x04,0x11,0x00,0x83,0x16,
-0x10,0x04,0x4c,0x0e,0x42,0x3a,0xcf,0xfa,0xa6,0x07,0x05,0x00,0xc9,0x09,0x0f,0x09,
-0x00,0x16,0xb0,0x3b,0xef,0xc6,0x2f,0xd0,0x4f,0xff,0xef,0xfc,0xfd,0x1e,0x1e,0x12,
-0x60,0xd6,0xfe,0x00,0x00,0x07,0xfd,0x1c,0x17,0x35,0x5f,0xdd,0xf6,0xdb,0x00,0x11,
-0xdc,0x0b,0x00,0x01,0x16,0x00,0x02,0x21,0x00,0x10,0x0e,0x2c,0x00,0xa1,0xd0,0x4f,
-0xff,0xdf,0xfd,0xfd,0x00,0x3b,0xff,0xc6,0x33,0x01,0xfe,0x08,0x07,0xfc,0x03,0x10,
-0x00,0x00,0xcf,0x91,0xed,0x40,0x00,0x9f,0xf2,0x08,0xff,0xed,0xff,0xf6,0x00,0x03,
-0xae,0xfe,0xa3,0x5b,0x01,0x08,0x0b,0x00,0xf1,0x06,0x08,0xdf,0xe9,0x10,0x5f,0xdd,
-0xfe,0xef,0xfc,0x05,0xff,0xd3,0x00,0x5f,0xf4,0x5f,0xf1,0x00,0x00,0xbf,0x85,0xc8,
-0x01,0x00,0x21,0x00,0x21,0x8f,0x95,0xb2,0x01,0x0f,0x0b,0x00,0x0e,0x60,0x1e,0xd0,
-0x4f,0xf2,0x06,0x50,0x45,0x06,0x0f,0x02,0x00,0x05,0x81,0x00,0x3e,0xb0,0x00,0x7f,
-0xf0,0x00,0x07,0x25,0x07,0x0f,0xfa,0x03,0x17,0x00,0xb3,0x14,0x6e,0xb0,0xbe,0xff,
-0x50,0xaf,0xd7,0xd4,0x02,0x0c,0x06,0x00,0xf0,0x03,0x08,0xfe,0x20,0x5f,0xd0,0x00,
-0x7f,0xf3,0x00,0x5f,0xd0,0x06,0xff,0x40,0x00,0x5f,0xd0,0x5f,0xcf,0x17,0x10,0xd3,
-0xb3,0x05,0x31,0x5f,0xee,0xfd,0x25,0x15,0x00,0xd3,0x04,0x40,0x5f,0xfb,0x7f,0xf2,
-0xa3,0x07,0x20,0x0b,0xfd,0x36,0x00,0x30,0x01,0xef,0x90,0x3c,0x00,0x22,0x4f,0xf5,
-0x42,0x00,0x10,0x10,0x4e,0x00,0x5f,0xcf,0xc0,0x2f,0xf2,0xff,0x03,0x00,0x05,0xf0,
-0x13,0x6f,0xb1,0x9e,0xfe,0x80,0x03,0xbe,0xfd,0x70,0x06,0xfd,0xef,0xef,0xff,0xc6,
-0xff,0xef,0xff,0x90,0x6f,0xfa,0x10,0x06,0xff,0xfa,0x10,0x08,0xff,0x16,0xfe,0x00,
-0x00,0x0c,0xfe,0x6e,0x0f,0x22,0x6f,0xc0,0xe9,0x0f,0x32,0xcf,0x66,0xfc,0x48,0x15,
-0x21,0x0c,0xf6,0x13,0x00,0x1f,0x90,0x13,0x00,0x29,0xf0,0x09,0x60,0x5f,0xb0,0x8d,
-0xfe,0x91,0x05,0xfd,0xdf,0xee,0xff,0xc0,0x5f,0xfd,0x30,0x05,0xff,0x45,0xff,0x10,
-0x00,0x0b,0xf8,0x5f,0x32,0x11,0x0f,0xa9,0x01,0x14,0x21,0x5f,0xd0,0xd0,0x18,0xa0,
-0x17,0xdf,0xec,0x50,0x00,0x02,0xdf,0xfd,0xdf,0xfa,0xa4,0x17,0x50,0x03,0xef,0x80,
-0x5f,0xe0,0x75,0x06,0x20,0xbf,0x80,0xaf,0x03,0x20,0xdf,0x50,0xab,0x15,0x20,0xef,
-0x40,0x80,0x00,0x02,0x0c,0x00,0x02,0x18,0x00,0x00,0x7b,0x03,0x31,0x4f,0xf1,0x0d,
-0x30,0x00,0x20,0x02,0xef,0x3c,0x00,0x20,0x00,0x18,0xec,0x17,0x30,0x5f,0xa3,0xae,
-0x55,0x04,0xa1,0xef,0xda,0xbf,0xfc,0x00,0x5f,0xf8,0x00,0x02,0xef,0x85,0x04,0x17,
-0x7f,0x55,0x04,0x26,0x0e,0xf4,0x4f,0x04,0x02,0x0c,0x00,0x41,0x1f,0xf2,0x5f,0xe0,
-0x24,0x00,0x80,0xfa,0x10,0x05,0xff,0x70,0x5f,0xef,0xfd,0x55,0x04,0x11,0xd2,0x48,
-0x00,0x0f,0xe7,0x01,0x09,0x00,0x2f,0x03,0xf0,0x00,0xd6,0x3f,0xc0,0x4f,0xff,0xde,
-0xfd,0xfc,0x1e,0xfb,0x10,0x04,0xff,0xc7,0xfe,0x79,0x16,0x00,0xa0,0x00,0x21,0x5f,
-0xcd,0xe8,0x14,0x20,0xef,0x40,0x0b,0x00,0x00,0x2f,0x03,0x02,0x16,0x00,0x20,0xc6,
-0xfe,0x19,0x03,0x10,0x1e,0x4f,0x15,0x60,0xc0,0x4f,0xff,0xce,0xfe,0xfc,0x42,0x00,
-0x20,0x5f,0xc0,0xfc,0x02,0x01,0x26,0x06,0x0e,0x0b,0x00,0x01,0x05,0x00,0x80,0x3c,
-0xfc,0x5f,0xef,0xfe,0xb5,0xff,0xb1,0xcb,0x09,0x11,0x05,0x29,0x02,0x0f,0x07,0x00,
-0x07,0x50,0x00,0x5c,0xff,0xd9,0x10,0x62,0x16,0x90,0xfe,0x20,0x3f,0xf4,0x00,0x1c,
-0xfc,0x06,0xfc,0xbe,0x08,0x21,0x4f,0xf2,0x4c,0x04,0x61,0xfb,0x73,0x00,0x00,0x00,
-0x6d,0xc4,0x0a,0x50,0x01,0x5a,0xff,0x90,0x11,0x35,0x04,0x20,0x1c,0xf7,0x19,0x01,
-0x20,0x7f,0xe3,0x00,0x18,0xa2,0xbf,0xfe,0xdf,0xff,0x50,0x00,0x6b,0xef,0xda,0x20,
-0xe5,0x01,0x03,0x04,0x00,0x88,0xef,0xff,0xff,0xf0,0x9a,0xdf,0xda,0xa0,0x14,0x00,
-0x0f,0x04,0x00,0x02,0x00,0x8d,0x10,0x71,0x2f,0xfe,0xe0,0x00,0x05,0xdf,0xd0,0x28,
-0x02,0x11,0x96,0x37,0x02,0x0f,0x0b,0x00,0x13,0xf0,0x0a,0x94,0xfe,0x00,0x00,0x0b,
-0xf9,0x1f,0xf8,0x00,0x19,0xff,0x90,0x8f,0xff,0xef,0xfd,0xf9,0x00,0x7d,0xff,0xb4,
-0x8f,0x90,0x6f,0xc0,0x45,0x12,0x20,0x1f,0xf1,0xfa,0x16,0xf0,0x02,0x0b,0xf6,0x00,
-0x00,0xdf,0x40,0x06,0xfc,0x00,0x02,0xfe,0x00,0x00,0xff,0x10,0x07,0xf9,0x28,0x17,
-0x10,0x0c,0xa2,0x08,0x30,0xb0,0x1f,0xe0,0x8e,0x07,0x20,0x7f,0x90,0xa0,0x17,0x20,
-0xcf,0x30,0x76,0x07,0x11,0xfd,0xf4,0x05,0x11,0xf8,0x30,0x08,0x11,0xf2,0xa4,0x0b,
-0x16,0xd0,0x50,0x1b,0x30,0xf5,0x1f,0xf0,0xc4,0x18,0xf0,0x0c,0x00,0x1f,0xf0,0x0c,
-0xf4,0x00,0x0a,0xff,0xa0,0x00,0x5f,0xc0,0x08,0xf8,0x00,0x0e,0xde,0xe0,0x00,0x9f,
-0x70,0x03,0xfc,0x00,0x4f,0x8a,0xf3,0xb2,0x07,0x50,0xef,0x10,0x8f,0x35,0xf8,0x8b,
-0x1b,0x70,0xaf,0x50,0xde,0x00,0xfd,0x05,0xf9,0xe2,0x1c,0xe0,0xf9,0x00,0xbf,0x29,
+0x00,0x40,0x04,0xcf,0xd8,0x00,0x01,0x00,0x31,0x3f,0xd7,0x9f,0x14,0x00,0xf0,0x1c,
+0xaf,0x10,0x09,0xf1,0x00,0x1e,0x40,0x00,0xcd,0x00,0x06,0xf3,0x00,0xbe,0x00,0x00,
+0xae,0x00,0x07,0xf2,0x06,0xf4,0x00,0x00,0x6f,0x92,0x4e,0xd0,0x1e,0xa0,0x00,0x00,
+0x08,0xff,0xfd,0x20,0xae,0x10,0x00,0x00,0x00,0x13,0x20,0xde,0x00,0x00,0x01,0x00,
+0x41,0x1e,0xb0,0x01,0x10,0x3b,0x00,0xc0,0x12,0xcf,0xfc,0x30,0x00,0x00,0x04,0xf6,
+0x0d,0xe7,0x6e,0xe0,0x4b,0x01,0x20,0x4f,0x50,0x23,0x00,0xf0,0x0f,0x9f,0x20,0x6f,
+0x20,0x01,0xf8,0x00,0x03,0xf7,0x00,0x6f,0x20,0x01,0xf7,0x00,0x0c,0xd0,0x00,0x4f,
+0x60,0x05,0xf5,0x00,0x01,0x20,0x00,0x0c,0xf8,0x8f,0xd0,0x39,0x00,0x90,0x01,0x9e,
+0xfb,0x10,0x00,0x07,0xdf,0xea,0x20,0x45,0x00,0xf0,0x10,0xfd,0xef,0xf3,0x00,0x00,
+0x02,0xff,0x50,0x09,0xfb,0x00,0x00,0x06,0xfd,0x00,0x02,0xfd,0x00,0x00,0x05,0xfd,
+0x00,0x05,0xfb,0x00,0x00,0x01,0xff,0x40,0x4e,0xf3,0x4a,0x01,0xa0,0xe9,0xff,0x50,
+0x00,0x00,0x00,0x0c,0xff,0xd2,0x00,0x0e,0x00,0xf0,0xa4,0xff,0xb0,0x00,0x00,0x00,
+0x09,0xff,0x5e,0xf9,0x00,0x2e,0xc0,0x5f,0xf3,0x03,0xff,0x60,0x4f,0xb0,0xbf,0x90,
+0x00,0x5f,0xf4,0x8f,0x80,0xcf,0x60,0x00,0x08,0xff,0xef,0x30,0xaf,0x90,0x00,0x00,
+0xaf,0xfb,0x00,0x4f,0xf4,0x00,0x00,0x9f,0xfc,0x00,0x08,0xff,0xb9,0xae,0xfe,0xef,
+0x90,0x00,0x3a,0xef,0xfc,0x71,0x3f,0xf6,0xcf,0xcf,0xce,0xcd,0xcc,0x87,0x00,0x00,
+0x00,0x10,0x00,0x01,0xc9,0x00,0x00,0xcf,0x40,0x00,0x9f,0x60,0x00,0x3f,0xb0,0x00,
+0x0c,0xf3,0x00,0x03,0xfd,0x00,0x00,0x9f,0x80,0x00,0x0d,0xf3,0x00,0x01,0xff,0x00,
+0x00,0x4f,0xe0,0x00,0x05,0xfc,0x00,0x00,0x6f,0xb0,0x00,0x06,0xfb,0x00,0x00,0x5f,
+0xc0,0x00,0x04,0xfd,0x00,0x00,0x1f,0xf0,0x00,0x00,0xef,0x20,0x00,0x0a,0xf6,0x00,
+0x00,0x4f,0xb0,0x00,0x00,0xdf,0x20,0x00,0x05,0xfa,0x00,0x00,0x0b,0xf4,0x00,0x00,
+0x1e,0xe2,0x00,0x00,0x2e,0x90,0x00,0x00,0x12,0x01,0x00,0x00,0x06,0xe3,0x00,0x00,
+0x2e,0xe2,0x00,0x00,0x3f,0xc0,0x00,0x00,0x8f,0x60,0x00,0x01,0xfe,0x00,0x32,0x00,
+0x00,0x44,0x00,0xf1,0x05,0x00,0xff,0x00,0x00,0x0d,0xf4,0x00,0x00,0xbf,0x70,0x00,
+0x09,0xf8,0x00,0x00,0x8f,0x90,0x00,0x08,0xf9,0x75,0x00,0x21,0x0a,0xf7,0x8c,0x00,
+0x21,0x0f,0xf1,0x86,0x00,0xf0,0x06,0x8f,0x70,0x00,0x0e,0xf1,0x00,0x06,0xf8,0x00,
+0x01,0xee,0x00,0x00,0xcf,0x30,0x00,0x6f,0x40,0x00,0x01,0x20,0xfc,0x00,0x21,0xbf,
+0x10,0x52,0x02,0x02,0x05,0x00,0xf0,0x09,0x5f,0xa4,0x9f,0x17,0xda,0x5d,0xff,0xff,
+0xff,0xfb,0x00,0x29,0xff,0xc5,0x10,0x00,0x0c,0xfe,0xe1,0x00,0x00,0x8f,0x85,0xfb,
+0x43,0x00,0xb1,0xaf,0x60,0x00,0x83,0x00,0x1b,0x10,0x00,0x00,0x02,0x86,0xb3,0x01,
+0x11,0x5f,0x78,0x01,0x2c,0x05,0xfd,0x0d,0x00,0x71,0x11,0x11,0x5f,0xd1,0x11,0x10,
+0x1f,0xc8,0x02,0x11,0x91,0x06,0x00,0x1e,0xf9,0x27,0x00,0x0b,0x0d,0x00,0xf0,0x0a,
+0x08,0xf9,0x08,0xf9,0x09,0xf8,0x0d,0xf3,0x4f,0xc0,0x3c,0x20,0x7c,0xcc,0xcc,0x19,
+0xff,0xff,0xf2,0x07,0x70,0x4f,0xf5,0x1d,0xe2,0xda,0x02,0x10,0xf0,0x5b,0x02,0x10,
+0x90,0x9a,0x02,0x50,0x30,0x00,0x00,0x00,0xfd,0xe8,0x02,0x10,0xf7,0xbc,0x01,0x50,
+0xf1,0x00,0x00,0x00,0x2f,0xb9,0x01,0x10,0x8f,0x8f,0x02,0x10,0xee,0x4c,0x00,0x10,
+0xf8,0x86,0x03,0x10,0xf2,0x97,0x02,0x10,0xc0,0xd7,0x01,0x00,0x20,0x03,0x10,0xdf,
+0xef,0x02,0x50,0xf9,0x00,0x00,0x00,0x0a,0xf8,0x01,0x10,0x0f,0x74,0x00,0x10,0x6f,
+0xe8,0x02,0x11,0x58,0x70,0x02,0xf0,0x0a,0x19,0xdf,0xeb,0x50,0x00,0x02,0xef,0xfd,
+0xef,0xf8,0x00,0x0c,0xfb,0x10,0x05,0xff,0x30,0x2f,0xf1,0x00,0x00,0x9f,0xa0,0x6f,
+0xb0,0xae,0x01,0x20,0x9f,0x90,0x9f,0x01,0x80,0xaf,0x80,0x00,0x00,0x1f,0xf1,0xaf,
+0x80,0x0e,0x03,0x07,0x06,0x00,0x12,0xf1,0x06,0x00,0xc1,0x8f,0x90,0x00,0x00,0x2f,
+0xf0,0x6f,0xc0,0x00,0x00,0x4f,0xd0,0x3c,0x00,0x30,0x90,0x0b,0xfc,0x48,0x00,0x50,
+0x02,0xef,0xfc,0xef,0xf8,0x60,0x00,0x10,0xfc,0x68,0x02,0xff,0x05,0x5b,0x80,0x39,
+0xff,0xf8,0xdf,0xff,0xef,0x8f,0xb5,0x0a,0xf8,0x10,0x00,0xaf,0x80,0x00,0x0a,0xf8,
+0x00,0x07,0x00,0x13,0x00,0x64,0x02,0xf0,0x0c,0x50,0x00,0x06,0xff,0xfd,0xff,0xfa,
+0x00,0x3f,0xf7,0x00,0x06,0xff,0x50,0xaf,0xa0,0x00,0x00,0xaf,0xb0,0xdf,0x50,0x00,
+0x00,0x6f,0xc0,0x23,0xe6,0x00,0x01,0x74,0x03,0x20,0xcf,0x40,0x18,0x01,0x01,0xdd,
+0x03,0x10,0x4f,0x01,0x01,0x20,0x02,0xef,0x78,0x00,0x20,0x2e,0xf7,0x1b,0x03,0x20,
+0xdf,0x80,0x47,0x01,0x11,0xf9,0x27,0x00,0x10,0xa0,0x22,0x01,0x11,0xfb,0xf5,0x02,
+0x62,0xfc,0xcc,0xcc,0xcc,0xc7,0x9f,0xa1,0x01,0xf0,0x01,0x3a,0xef,0xeb,0x40,0x00,
+0x7f,0xff,0xde,0xff,0x80,0x3f,0xf6,0x00,0x06,0xff,0x39,0x83,0x02,0x61,0xf8,0x57,
+0x30,0x00,0x00,0x8f,0x31,0x00,0x10,0xf7,0xa4,0x01,0xc0,0xfe,0x00,0x00,0x5c,0xdf,
+0xfc,0x20,0x00,0x06,0xff,0xff,0xb2,0x62,0x00,0x21,0xaf,0xe2,0x36,0x02,0x11,0xa0,
+0xc5,0x01,0xf0,0x09,0x9b,0x30,0x00,0x00,0x5f,0xeb,0xf9,0x00,0x00,0x08,0xfb,0x5f,
+0xf6,0x00,0x05,0xff,0x50,0x9f,0xfe,0xde,0xff,0x80,0x00,0x4b,0x58,0x00,0x10,0x00,
+0x78,0x03,0x11,0x90,0x6d,0x02,0x11,0xf9,0xf9,0x01,0x01,0x0d,0x00,0x21,0x1e,0xfb,
+0x96,0x01,0x10,0xf6,0x66,0x01,0xa0,0x05,0xfc,0x09,0xf9,0x00,0x00,0x01,0xef,0x20,
+0x9f,0x68,0x03,0x30,0x70,0x09,0xf9,0x4f,0x01,0x91,0x00,0x9f,0x90,0x00,0x0e,0xf3,
+0x00,0x09,0xf9,0xd9,0x02,0xa1,0x9f,0x90,0x03,0xff,0xdc,0xcc,0xce,0xfe,0xcb,0x6f,
+0x54,0x02,0x10,0xf0,0xb1,0x03,0x01,0x4e,0x00,0x00,0x27,0x00,0x0a,0x0d,0x00,0x11,
+0xcf,0x20,0x00,0x11,0xdf,0x06,0x00,0x21,0xff,0x10,0x7e,0x00,0x10,0x00,0xb1,0x00,
+0x01,0x77,0x02,0x31,0x04,0xfb,0x00,0x2a,0x01,0xf1,0x01,0x9e,0xfe,0x91,0x00,0x07,
+0xff,0xff,0xff,0xfe,0x20,0x05,0xdb,0x30,0x15,0xef,0xd0,0xc1,0x04,0x20,0xf3,0x00,
+0x59,0x02,0x20,0xf7,0x00,0x99,0x00,0x30,0xf8,0x19,0x80,0x0c,0x00,0x00,0x37,0x05,
+0xf0,0x15,0x1f,0xf3,0x09,0xfd,0x20,0x01,0xcf,0xd0,0x00,0xcf,0xfd,0xdf,0xfe,0x20,
+0x00,0x07,0xcf,0xfd,0x91,0x00,0x00,0x00,0x18,0xce,0xe0,0x00,0x00,0x06,0xff,0xfe,
+0xc0,0x00,0x00,0x7f,0xf8,0x10,0x71,0x04,0x10,0x30,0x88,0x00,0x20,0xf6,0x00,0x04,
+0x06,0x70,0xf1,0x7b,0xcb,0x50,0x00,0x2f,0xed,0x31,0x05,0xe0,0x5f,0xff,0x71,0x06,
+0xff,0x70,0x6f,0xf4,0x00,0x00,0x7f,0xe0,0x7f,0xc0,0x5b,0x05,0x00,0x06,0x00,0x40,
+0x0e,0xf4,0x5f,0xe0,0xba,0x03,0x20,0x3f,0xf1,0x53,0x02,0xf2,0x09,0x0d,0xf8,0x00,
+0x00,0x6f,0xe0,0x05,0xff,0x50,0x03,0xef,0x70,0x00,0x9f,0xfe,0xdf,0xfb,0x00,0x00,
+0x05,0xcf,0xfc,0x60,0x00,0x47,0x03,0x71,0x71,0xcc,0xcc,0xcc,0xcc,0xcf,0xf4,0xba,
+0x05,0x02,0x3c,0x03,0x11,0xaf,0xfb,0x05,0x21,0x2f,0xe0,0xfa,0x00,0x12,0xf8,0x62,
+0x01,0x01,0xd1,0x02,0x21,0x8f,0xa0,0x7f,0x00,0x11,0xf2,0xe5,0x00,0x11,0xfb,0x2c,
+0x00,0x26,0xef,0x40,0x6e,0x03,0x21,0x0d,0xf6,0x04,0x01,0x21,0xfe,0x00,0x0d,0x02,
+0x11,0x70,0xf5,0x00,0x11,0xf1,0xef,0x00,0x02,0x3f,0x01,0x10,0x29,0x6e,0x02,0xd1,
+0x03,0xff,0xfd,0xef,0xfa,0x00,0x0d,0xfb,0x10,0x06,0xff,0x50,0x3f,0x10,0x03,0x80,
+0x3f,0xe0,0x00,0x00,0x7f,0xb0,0x1f,0xf2,0x92,0x02,0xf0,0x09,0x08,0xfd,0x40,0x18,
+0xfe,0x10,0x00,0x7f,0xff,0xff,0xc2,0x00,0x01,0xbf,0xfd,0xef,0xe5,0x00,0x0c,0xfa,
+0x00,0x05,0xff,0x40,0x61,0x00,0x44,0x6f,0xd0,0x9f,0x90,0x2e,0x03,0x02,0xe7,0x00,
+0xf0,0x04,0x5f,0xf0,0x2f,0xf9,0x00,0x03,0xef,0x90,0x05,0xff,0xfd,0xef,0xfc,0x00,
+0x00,0x2a,0xef,0xfc,0x60,0x06,0x00,0xf0,0x0b,0xe9,0x10,0x00,0x5f,0xff,0xdf,0xfe,
+0x20,0x1f,0xf9,0x00,0x1b,0xfd,0x07,0xfc,0x00,0x00,0x0e,0xf5,0xbf,0x70,0x00,0x00,
+0x8f,0x9c,0xf5,0x0d,0x02,0x00,0x0b,0x00,0xf0,0x09,0x4f,0xe8,0xfc,0x00,0x00,0x09,
+0xfe,0x2f,0xf8,0x00,0x08,0xff,0xd0,0x6f,0xff,0xdf,0xfb,0xfc,0x00,0x4b,0xff,0xb3,
+0x6f,0xa0,0xac,0x00,0x11,0xf7,0xf0,0x00,0x01,0xeb,0x05,0xf9,0x0a,0xb0,0x00,0x00,
+0x03,0xcf,0xf2,0x00,0x05,0xdf,0xff,0xd3,0x00,0x00,0x6f,0xeb,0x60,0x00,0x00,0x2e,
+0xd1,0x5f,0xf3,0x08,0x70,0x00,0x01,0x00,0xca,0x07,0x60,0x5f,0xf3,0x2e,0xd1,0x06,
+0xfa,0x0a,0xff,0x02,0x84,0x1a,0x00,0xc2,0x05,0xea,0x06,0xfb,0x06,0xfa,0x0a,0xf6,
+0x1f,0xe1,0x3d,0x40,0x12,0x00,0xf0,0x06,0x18,0x50,0x00,0x00,0x02,0x9f,0xf7,0x00,
+0x00,0x2a,0xff,0xfc,0x30,0x04,0xbf,0xff,0x92,0x00,0x1c,0xff,0xd6,0xde,0x01,0x20,
+0xa1,0x00,0xbb,0x06,0x10,0xf9,0xe5,0x01,0x30,0x7e,0xff,0xc6,0x60,0x01,0x20,0xdf,
+0xff,0x34,0x00,0x21,0x5c,0xf7,0x54,0x01,0x73,0x40,0x3e,0xee,0xee,0xee,0xee,0x83,
+0xf1,0x04,0x0a,0x01,0x00,0x10,0x03,0x1b,0x00,0x21,0xe8,0x3f,0xdb,0x07,0x01,0x79,
+0x04,0x41,0x06,0xff,0xa3,0x00,0x62,0x00,0x11,0x50,0x80,0x07,0x10,0xd6,0x24,0x00,
+0x30,0xaf,0xfe,0x50,0x9d,0x04,0x80,0xf9,0x00,0x00,0x28,0xef,0xfb,0x30,0x05,0x7a,
+0x00,0x70,0x4e,0xff,0xe7,0x10,0x00,0x06,0xfd,0xed,0x01,0x33,0x44,0x00,0x00,0xb1,
+0x04,0xf0,0x09,0x40,0x00,0x2e,0xff,0xff,0xff,0x60,0x0b,0xfc,0x20,0x09,0xff,0x10,
+0xff,0x30,0x00,0x0e,0xf4,0x02,0x20,0x00,0x00,0xdf,0x50,0xdf,0x04,0x10,0xf3,0x10,
+0x02,0x10,0xfc,0xa9,0x00,0x00,0x1f,0x01,0x10,0x07,0xa0,0x00,0x11,0x03,0xa5,0x00,
+0x25,0x9f,0xa0,0xda,0x02,0x16,0x12,0x98,0x00,0x25,0x26,0x10,0x1a,0x04,0x21,0x9f,
+0x50,0x12,0x00,0x41,0x38,0xcf,0xfe,0xc8,0x18,0x06,0x61,0x1a,0xff,0xc9,0x9a,0xdf,
+0xf9,0x4a,0x04,0xa1,0x81,0x00,0x00,0x01,0x9f,0xc0,0x00,0x00,0x1e,0xf3,0x32,0x01,
+0x42,0xf9,0x00,0x00,0xaf,0x2c,0x01,0x20,0x8f,0x20,0x5a,0x05,0xf0,0x37,0x4c,0xfd,
+0x91,0x00,0x0e,0x90,0x0a,0xf1,0x00,0x06,0xfd,0x8a,0xfd,0x00,0x09,0xe0,0x0f,0xc0,
+0x00,0x2f,0xc0,0x00,0xed,0x00,0x05,0xf2,0x4f,0x70,0x00,0xbf,0x20,0x00,0xfb,0x00,
+0x03,0xf4,0x7f,0x40,0x01,0xfc,0x00,0x01,0xfa,0x00,0x02,0xf5,0x8f,0x20,0x04,0xf8,
+0x00,0x03,0xf8,0x00,0x02,0xf5,0x9f,0x10,0x07,0xf6,0x00,0x04,0xf7,0x00,0x03,0xf4,
+0x9f,0x20,0x08,0xf5,0x07,0x09,0xf0,0x10,0x05,0xf2,0x8f,0x20,0x08,0xf6,0x00,0x0a,
+0xf5,0x00,0x0b,0xe0,0x6f,0x50,0x05,0xfc,0x00,0x5f,0xf7,0x00,0x3f,0x70,0x2f,0x90,
+0x00,0xef,0xdc,0xf7,0xff,0x78,0xfc,0xe5,0x08,0x60,0x2c,0xfd,0x50,0x3c,0xfe,0x80,
+0xc9,0x06,0x04,0x01,0x00,0x24,0xcf,0x60,0x0a,0x00,0x11,0x1d,0x86,0x03,0x01,0x0d,
+0x03,0x52,0xbf,0xfb,0x88,0x9b,0xfb,0x7b,0x01,0x52,0x9d,0xff,0xec,0x82,0x00,0x71,
+0x06,0x12,0xf0,0x08,0x00,0x32,0xbf,0xf6,0x00,0x32,0x03,0x00,0x2f,0x05,0x00,0x7d,
+0x06,0x21,0xef,0x20,0x1c,0x03,0x31,0xf3,0x9f,0x80,0x40,0x05,0x10,0xe0,0xef,0x02,
+0x00,0xeb,0x02,0x22,0x0d,0xf4,0x69,0x02,0x32,0x08,0xfb,0x00,0x49,0x08,0x22,0xff,
+0x10,0x45,0x01,0x00,0x3a,0x03,0x00,0xee,0x05,0x41,0x7f,0xd0,0x00,0x00,0x42,0x05,
+0xe0,0xf3,0x00,0x00,0xef,0xed,0xdd,0xdd,0xdf,0xf9,0x00,0x05,0xff,0x00,0x00,0x05,
+0x00,0x21,0x0b,0xf9,0x7c,0x03,0x31,0x60,0x1f,0xf3,0x2a,0x01,0x31,0xc0,0x7f,0xd0,
+0xb2,0x03,0xe0,0xf2,0x0f,0xff,0xff,0xff,0xc8,0x10,0x00,0xff,0xee,0xee,0xff,0xfe,
+0x20,0xb0,0x01,0x40,0x4e,0xfb,0x00,0xff,0x3d,0x05,0x00,0xa1,0x09,0x00,0x62,0x00,
+0x06,0x0d,0x00,0xa1,0x4e,0xf7,0x00,0xff,0xdd,0xdd,0xef,0xf7,0x00,0x0f,0x14,0x0a,
+0x00,0x27,0x00,0x51,0x14,0xcf,0xb0,0x0f,0xf3,0xc7,0x08,0x00,0x27,0x00,0x21,0x0c,
+0xf8,0xf1,0x01,0x20,0xbf,0x80,0x0d,0x00,0x20,0x1f,0xf6,0x0d,0x00,0x90,0x2c,0xff,
+0x10,0xff,0xed,0xdd,0xef,0xff,0x40,0x34,0x00,0x10,0xd9,0xd8,0x00,0xf0,0x07,0x6c,
+0xef,0xea,0x40,0x00,0x00,0x2d,0xff,0xfe,0xff,0xf9,0x00,0x01,0xef,0xc3,0x00,0x07,
+0xff,0x70,0x0a,0xfc,0x00,0xd6,0x09,0x20,0x1f,0xf4,0x33,0x02,0x30,0xf5,0x5f,0xe0,
+0x22,0x03,0x20,0x94,0x7f,0x4b,0x07,0x03,0x29,0x02,0x0c,0x07,0x00,0x22,0x8f,0xb0,
+0x41,0x01,0x01,0x65,0x0a,0x31,0x83,0x1f,0xf3,0x38,0x00,0x12,0x0b,0x46,0x00,0xb0,
+0x01,0xff,0xb2,0x00,0x06,0xff,0x70,0x00,0x3e,0xff,0xee,0x48,0x0a,0x50,0x01,0x8d,
+0xff,0xea,0x30,0xb2,0x00,0xa0,0xec,0x81,0x00,0x00,0x0f,0xfe,0xee,0xef,0xff,0x60,
+0x97,0x02,0x31,0x01,0x8f,0xf7,0x9e,0x02,0x51,0x05,0xff,0x30,0x0f,0xf3,0x37,0x06,
+0x01,0x07,0x00,0x10,0x3f,0xe9,0x00,0x00,0x01,0x05,0x01,0x07,0x00,0x22,0x0e,0xf4,
+0x07,0x00,0x12,0xf5,0x15,0x00,0x18,0xf4,0x1c,0x00,0x27,0x4f,0xf0,0x38,0x00,0x02,
+0x46,0x00,0x01,0x54,0x00,0x21,0xfd,0xdd,0x62,0x00,0x03,0x70,0x00,0x10,0xff,0xbc,
+0x08,0x71,0x0f,0xfe,0xee,0xee,0xee,0xe9,0x0f,0x79,0x01,0x0f,0x06,0x00,0x06,0x51,
+0xfe,0xdd,0xdd,0xdd,0x80,0x30,0x00,0x1f,0xa0,0x2a,0x00,0x0c,0x06,0x30,0x00,0x11,
+0xdb,0x30,0x00,0x11,0xfd,0x06,0x00,0x11,0xf8,0x66,0x00,0x1f,0xe7,0x36,0x00,0x10,
+0x11,0x50,0x30,0x00,0x1f,0x60,0x66,0x00,0x12,0x07,0x06,0x00,0xf1,0x08,0x00,0x01,
+0x7c,0xef,0xeb,0x50,0x00,0x00,0x3e,0xff,0xfe,0xff,0xfb,0x00,0x02,0xff,0xc3,0x00,
+0x06,0xff,0xa0,0x0a,0xfc,0xe1,0x07,0x21,0x1f,0xf4,0xce,0x03,0x03,0xd1,0x02,0x28,
+0x7f,0xc0,0xa5,0x01,0xe1,0x9f,0xb0,0x00,0x08,0xdd,0xdd,0xd7,0x8f,0xb0,0x00,0x09,
+0xff,0xff,0xf9,0x1c,0x00,0x41,0x0a,0xf9,0x4f,0xf0,0x07,0x00,0x21,0x0f,0xf6,0x07,
+0x00,0x31,0x08,0xfe,0x10,0xf2,0x05,0xb0,0xdf,0xe4,0x00,0x01,0x7f,0xf7,0x00,0x1c,
+0xff,0xfd,0xef,0x93,0x07,0x42,0x5b,0xef,0xed,0x93,0x7d,0x00,0x02,0x87,0x02,0x00,
+0xe4,0x02,0x0f,0x0f,0x00,0x14,0x71,0xed,0xdd,0xdd,0xdd,0xdf,0xf1,0x0f,0xae,0x06,
+0x0f,0x3c,0x00,0x1d,0x0a,0x0f,0x00,0x3f,0xdf,0x6d,0xf6,0x03,0x00,0x03,0x11,0x60,
+0xd9,0x06,0x1f,0xf6,0x06,0x00,0x2f,0x20,0x4e,0xd0,0xbe,0x02,0x20,0x3f,0xf2,0x49,
+0x01,0xf2,0x03,0x0d,0xfc,0x20,0x03,0xef,0xc0,0x03,0xef,0xfe,0xef,0xfe,0x20,0x00,
+0x19,0xdf,0xfd,0x81,0x00,0x66,0x02,0x11,0xe2,0x94,0x03,0x21,0x8f,0xf3,0x0f,0x00,
+0x30,0x7f,0xf4,0x00,0x0f,0x00,0x21,0x5f,0xf6,0x9b,0x01,0x30,0x4f,0xf7,0x00,0x0f,
+0x00,0x21,0x3f,0xf9,0xaa,0x01,0x11,0x2e,0x66,0x04,0x32,0xff,0x5d,0xff,0xef,0x01,
+0x02,0xfb,0x05,0x40,0xff,0xfd,0x6f,0xf5,0x0f,0x00,0x40,0xfd,0x10,0x9f,0xf2,0x0f,
+0x00,0x41,0x40,0x00,0xcf,0xd0,0x3c,0x00,0x31,0x02,0xef,0xa0,0x4b,0x00,0x12,0x05,
+0x15,0x03,0x01,0xa6,0x05,0x01,0xc9,0x03,0x12,0xfd,0x78,0x00,0x41,0x1e,0xfa,0x00,
+0x0f,0xe7,0x07,0x0f,0x06,0x00,0x42,0x00,0x8d,0x02,0x11,0xd4,0xa4,0x01,0x22,0xf5,
+0x0f,0x2e,0x08,0x32,0x2f,0xff,0x0f,0xf5,0x0d,0x51,0x8f,0xff,0x0f,0xff,0xe0,0xb1,
+0x04,0x40,0xff,0x0f,0xfe,0xf4,0xc2,0x04,0x60,0xfe,0xff,0x0f,0xf8,0xfb,0x00,0x64,
+0x04,0x30,0xff,0x0f,0xf2,0x2e,0x00,0x32,0x2f,0xf3,0xff,0xf5,0x0a,0xf0,0x16,0x9f,
+0x92,0xff,0x0f,0xf2,0x4f,0xe0,0x00,0x00,0xef,0x33,0xff,0x0f,0xf2,0x0d,0xf4,0x00,
+0x05,0xfc,0x03,0xff,0x0f,0xf3,0x07,0xfb,0x00,0x0c,0xf6,0x04,0xff,0x0f,0xf3,0x01,
+0xff,0x10,0x2f,0xe0,0x09,0x00,0x51,0x00,0xaf,0x80,0x9f,0x90,0x09,0x00,0x41,0x3f,
+0xe0,0xff,0x20,0x09,0x00,0x41,0x0d,0xfb,0xfc,0x00,0x09,0x00,0x32,0x06,0xff,0xf5,
+0x09,0x00,0x33,0x00,0xff,0xe0,0x09,0x00,0x50,0x9f,0x80,0x00,0x04,0xff,0xf2,0x03,
+0x0f,0xf9,0x00,0x00,0x00,0x02,0xff,0x10,0xff,0xf3,0x00,0x00,0x00,0x2f,0xf1,0x0f,
+0xff,0xd0,0x0f,0x00,0x21,0xff,0x80,0x0f,0x00,0x31,0xf9,0xff,0x30,0x0f,0x00,0x21,
+0x4b,0xfd,0x0f,0x00,0x31,0xf4,0x1f,0xf8,0x0f,0x00,0x31,0x40,0x6f,0xf2,0x0f,0x00,
+0x31,0x00,0xbf,0xc0,0x0f,0x00,0x31,0x02,0xff,0x70,0x0f,0x00,0x30,0x06,0xff,0x22,
+0x0f,0x00,0x31,0x00,0x0c,0xfc,0x0f,0x00,0x31,0x00,0x2f,0xf9,0x0f,0x00,0x31,0x00,
+0x7f,0xff,0x0f,0x00,0x22,0x00,0xcf,0x0f,0x00,0x13,0x02,0x0f,0x00,0xf1,0x12,0x08,
+0xff,0x10,0x00,0x00,0x6c,0xef,0xd9,0x20,0x00,0x00,0x02,0xdf,0xff,0xff,0xff,0x70,
+0x00,0x00,0xef,0xd4,0x00,0x28,0xff,0x70,0x00,0x9f,0xd1,0x00,0x00,0x06,0xff,0x20,
+0x26,0x00,0xf1,0x05,0x0c,0xf8,0x05,0xfe,0x00,0x00,0x00,0x00,0x6f,0xd0,0x7f,0xb0,
+0x00,0x00,0x00,0x03,0xff,0x09,0xfa,0x00,0xad,0x00,0x21,0x9f,0xa0,0xbc,0x00,0x13,
+0x19,0x0f,0x00,0x03,0x1e,0x00,0x04,0x2d,0x00,0x03,0x3c,0x00,0x01,0x4b,0x00,0x30,
+0x05,0xff,0x20,0x5a,0x00,0x32,0x17,0xff,0x70,0x69,0x00,0x20,0x80,0x00,0x78,0x00,
+0xf0,0x0b,0xda,0x30,0x00,0x00,0x0f,0xff,0xff,0xff,0xeb,0x50,0x00,0x0f,0xfe,0xee,
+0xee,0xff,0xfb,0x00,0x0f,0xf3,0x00,0x00,0x07,0xff,0x90,0x0f,0x0d,0x01,0x21,0x7f,
+0xf0,0x07,0x00,0x28,0x1f,0xf3,0x07,0x00,0x11,0x6f,0x15,0x00,0xa1,0x06,0xff,0xa0,
+0x0f,0xfe,0xdd,0xde,0xff,0xfc,0x10,0x3f,0x00,0x21,0x60,0x00,0x1c,0x00,0x1f,0x00,
+0x07,0x00,0x18,0x32,0x00,0x00,0x7c,0xf7,0x00,0xf0,0x07,0xef,0xff,0xff,0xff,0x60,
+0x00,0x01,0xff,0xc4,0x00,0x29,0xff,0x50,0x00,0xbf,0xc0,0x00,0x00,0x07,0xfe,0x10,
+0x1f,0x25,0x00,0x40,0x0d,0xf6,0x06,0xfd,0x29,0x00,0x21,0x8f,0xb0,0xe8,0x00,0x40,
+0x05,0xfe,0x0a,0xf8,0x0f,0x00,0x41,0x4f,0xf0,0xbf,0x80,0xe8,0x00,0x04,0x0f,0x00,
+0x03,0x1e,0x00,0x04,0x2d,0x00,0x03,0x3c,0x00,0x04,0x4b,0x00,0x92,0x01,0xff,0xc3,
+0x00,0x18,0xff,0x50,0x00,0x03,0x69,0x00,0x00,0x78,0x00,0x31,0xdf,0xfc,0x10,0x82,
+0x00,0x31,0x4e,0xfe,0x30,0x08,0x00,0x22,0x2c,0xfb,0x92,0x00,0x11,0x07,0x0d,0x01,
+0x20,0xc8,0x10,0x0d,0x01,0x31,0xef,0xff,0xf4,0xab,0x00,0x30,0x3c,0xfe,0x10,0x07,
+0x00,0x31,0x01,0xff,0x60,0xb9,0x00,0x21,0xcf,0x80,0x07,0x00,0x22,0xbf,0x80,0x15,
+0x00,0x10,0x50,0x07,0x00,0x91,0x3d,0xfd,0x00,0x0f,0xfe,0xdd,0xdf,0xff,0xd2,0x3f,
+0x00,0x11,0xfa,0xe3,0x00,0x22,0x08,0xfd,0xea,0x00,0x12,0xef,0x1b,0x01,0x21,0x7f,
+0xe0,0x07,0x00,0x32,0x0e,0xf7,0x00,0x3e,0x01,0x11,0x10,0x46,0x00,0x12,0xdf,0x4d,
+0x00,0xf0,0x0b,0x5f,0xf1,0x00,0x01,0x7c,0xff,0xea,0x30,0x00,0x00,0x3e,0xff,0xfe,
+0xff,0xf9,0x00,0x00,0xef,0xc3,0x00,0x06,0xff,0x70,0x05,0xff,0x10,0x6f,0x01,0x21,
+0x07,0xfc,0x35,0x01,0x22,0x05,0xff,0xb4,0x00,0x21,0xef,0xd3,0x07,0x00,0x31,0x2d,
+0xff,0xd8,0xbc,0x00,0x40,0x7d,0xff,0xfd,0x60,0x08,0x00,0x13,0x38,0xd4,0x00,0x31,
+0x04,0xef,0xc0,0x20,0x00,0x21,0x3f,0xf2,0xfe,0x01,0x40,0x0f,0xf4,0x0b,0xfa,0x1b,
+0x02,0xf0,0x09,0xf3,0x03,0xff,0xa2,0x00,0x04,0xdf,0xd0,0x00,0x4e,0xff,0xfd,0xff,
+0xfd,0x20,0x00,0x01,0x7c,0xef,0xec,0x70,0x00,0x6f,0xff,0x01,0x00,0xb0,0xfc,0x5e,
+0xee,0xee,0xff,0xee,0xee,0xea,0x00,0x00,0x00,0x9b,0x02,0x0f,0x07,0x00,0x4f,0x20,
+0x5f,0xe0,0xb7,0x01,0x20,0xf5,0xfe,0xaf,0x00,0x1f,0xff,0x0d,0x00,0x2e,0x20,0x3f,
+0xf0,0x96,0x02,0x10,0xe0,0xdb,0x01,0xf0,0x09,0x0c,0xf9,0x07,0xff,0x70,0x00,0x2b,
+0xff,0x20,0x09,0xff,0xfe,0xef,0xff,0x40,0x00,0x04,0xae,0xff,0xd8,0x10,0x00,0x7f,
+0xe0,0x79,0x00,0x21,0xaf,0xc1,0x82,0x00,0x21,0x0f,0xf6,0x11,0x01,0x50,0x05,0xff,
+0x10,0x5f,0xf0,0xc8,0x01,0xf0,0x00,0xa0,0x00,0xff,0x50,0x00,0x00,0x1f,0xf4,0x00,
+0x0a,0xfa,0x00,0x00,0x06,0xfe,0x4f,0x02,0x20,0x00,0x00,0x60,0x02,0xc0,0xef,0x50,
+0x00,0x1f,0xf2,0x00,0x00,0x08,0xfa,0x00,0x06,0xfc,0x42,0x01,0x40,0xf0,0x00,0xcf,
+0x60,0x00,0x02,0x91,0x50,0x1f,0xf1,0x00,0x00,0x00,0x06,0xfb,0x07,0x74,0x03,0x41,
+0x1f,0xf1,0xcf,0x50,0x5e,0x00,0x31,0x8f,0xe0,0x00,0x8e,0x00,0x11,0xf9,0xe6,0x00,
+0x22,0x0e,0xff,0x59,0x02,0x21,0x8f,0xd0,0x98,0x03,0x30,0x00,0x00,0x04,0xac,0x00,
+0x80,0x9f,0xa0,0xef,0x50,0x00,0x00,0x9f,0xf2,0x9e,0x02,0x00,0xbc,0x02,0x10,0x0d,
+0xef,0x03,0xf0,0x07,0xff,0x20,0x6f,0xc0,0x00,0x02,0xfe,0xfb,0x00,0x00,0x4f,0xe0,
+0x03,0xff,0x00,0x00,0x7f,0x8e,0xf0,0x00,0x08,0xfa,0x27,0x02,0x70,0x0b,0xf4,0xaf,
+0x40,0x00,0xbf,0x70,0x03,0x00,0x30,0xff,0x06,0xf8,0x12,0x00,0x70,0x07,0xfb,0x00,
+0x4f,0xa0,0x1f,0xd0,0x27,0x00,0x90,0x3f,0xe0,0x09,0xf6,0x00,0xdf,0x10,0x6f,0xb0,
+0x42,0x00,0xf0,0x16,0xdf,0x10,0x08,0xf6,0x0a,0xf7,0x00,0x00,0x0b,0xf6,0x2f,0xc0,
+0x00,0x4f,0xa0,0xdf,0x30,0x00,0x00,0x7f,0x96,0xf8,0x00,0x00,0xfe,0x1f,0xf0,0x00,
+0x00,0x04,0xfc,0xbf,0x30,0x00,0x0a,0xf7,0xfb,0xfd,0x00,0x70,0xee,0xe0,0x00,0x00,
+0x6f,0xdf,0x70,0xc8,0x00,0x10,0xf9,0xbf,0x02,0x11,0xf3,0x83,0x04,0x10,0x50,0x8b,
+0x00,0x02,0x4b,0x03,0x00,0xb4,0x00,0x40,0xc0,0x00,0x00,0x0d,0x2e,0x00,0x50,0x0a,
+0xfe,0x00,0x3f,0xf5,0xd4,0x00,0xf0,0x00,0x50,0x00,0x9f,0xe1,0x00,0x00,0xdf,0xa0,
+0x00,0x00,0xef,0x90,0x00,0x8f,0xf1,0x3e,0x01,0x30,0x30,0x2f,0xf6,0x22,0x00,0x31,
+0xfd,0x0c,0xfc,0x06,0x01,0x31,0xfc,0xff,0x20,0x73,0x04,0x22,0xff,0x70,0xa4,0x02,
+0x00,0x23,0x01,0x00,0xf4,0x04,0x11,0x90,0x98,0x04,0x11,0xfc,0x0e,0x01,0x50,0x0c,
+0xfd,0x0b,0xfd,0x00,0xfc,0x02,0x30,0x30,0x2f,0xf8,0x7c,0x00,0xf0,0x00,0x80,0x00,
+0x7f,0xf2,0x00,0x00,0xbf,0xe0,0x00,0x00,0xdf,0xc0,0x00,0x5f,0xf4,0xd1,0x03,0x20,
+0x70,0x1e,0x55,0x01,0x50,0x09,0xff,0x20,0x8f,0xf1,0x08,0x00,0x40,0xfe,0x01,0xef,
+0x80,0xdf,0x04,0x20,0x50,0x07,0xfc,0x02,0x91,0xaf,0xc0,0x00,0x0d,0xf8,0x00,0x00,
+0x2f,0xf4,0x31,0x03,0x20,0x0a,0xfb,0xc5,0x00,0x40,0x90,0x03,0xff,0x20,0x39,0x00,
+0x30,0x10,0xbf,0x90,0x8f,0x00,0x31,0xf9,0x3f,0xf1,0x71,0x00,0x21,0xfd,0xf7,0x80,
+0x00,0x11,0x9f,0x08,0x05,0x00,0xbb,0x03,0x02,0x79,0x04,0x22,0xf5,0x00,0x83,0x02,
+0x1f,0x50,0x0f,0x00,0x0e,0x11,0xdf,0x19,0x03,0x71,0x1b,0xee,0xee,0xee,0xee,0xff,
+0xf0,0x53,0x00,0x01,0x52,0x00,0x02,0xee,0x00,0x11,0x07,0xed,0x00,0x12,0x02,0x56,
+0x00,0x21,0xdf,0xb0,0xe8,0x01,0x11,0xe1,0x3f,0x01,0x11,0xf4,0xfc,0x01,0x01,0x03,
+0x02,0x11,0x0a,0x8d,0x04,0x11,0x05,0xfa,0x00,0x01,0xc7,0x00,0x10,0x00,0x90,0x04,
+0x00,0x24,0x01,0x11,0xf2,0x6e,0x00,0x71,0xff,0xdd,0xdd,0xdd,0xdd,0xd5,0xff,0x01,
+0x00,0xaf,0x70,0x4f,0xff,0xf2,0x4f,0xfc,0xc1,0x4f,0xe0,0x00,0x03,0x00,0x23,0x00,
+0x3c,0x00,0x40,0xff,0xf2,0x5f,0xb0,0x7d,0x00,0x01,0x39,0x01,0x10,0xf7,0xa0,0x00,
+0x01,0x81,0x00,0x20,0xcf,0x40,0x73,0x00,0x11,0xa0,0xaa,0x02,0x00,0x96,0x00,0x20,
+0xf6,0x00,0x11,0x02,0x01,0xb9,0x00,0x10,0x30,0xa2,0x01,0x10,0x90,0x1a,0x00,0x00,
+0xbb,0x02,0x20,0x0b,0xf5,0xaf,0x00,0x11,0xfb,0xbe,0x01,0x10,0x10,0x3c,0x01,0x10,
+0x70,0xf6,0x00,0x10,0xe0,0xf5,0x00,0x10,0xf4,0x34,0x00,0xaf,0x84,0xef,0xff,0x8b,
+0xce,0xf8,0x00,0xaf,0x80,0x0a,0x05,0x00,0x18,0x40,0x8b,0xce,0xf8,0xef,0x6a,0x06,
+0x11,0x66,0x30,0x01,0x10,0x20,0xdb,0x01,0x10,0x90,0x86,0x02,0xf1,0x12,0xf0,0x00,
+0x00,0x6f,0x88,0xf6,0x00,0x00,0xcf,0x22,0xfc,0x00,0x03,0xfb,0x00,0xcf,0x30,0x0a,
+0xf5,0x00,0x5f,0x90,0x1f,0xe0,0x00,0x0e,0xf1,0xbc,0xcc,0xcc,0xcc,0xcc,0x9f,0x97,
+0x04,0xf4,0x0f,0x17,0x83,0x00,0x07,0xfe,0x00,0x00,0x9f,0x90,0x00,0x0b,0xf3,0x00,
+0x3a,0xef,0xeb,0x30,0x00,0x6f,0xfe,0xce,0xff,0x50,0x2f,0xf5,0x00,0x08,0xfe,0x04,
+0xa8,0x49,0x06,0xf0,0x04,0xef,0x40,0x04,0xae,0xff,0xff,0xf4,0x09,0xff,0xca,0x88,
+0xff,0x45,0xfe,0x30,0x00,0x0e,0xf4,0xaf,0xbe,0x03,0x20,0x4b,0xf9,0x2b,0x02,0xf0,
+0x04,0x7f,0xf4,0x00,0x4e,0xff,0x50,0xdf,0xff,0xff,0xee,0xf7,0x01,0x9e,0xfe,0x91,
+0x7c,0x80,0x5f,0xd0,0x34,0x00,0x0f,0x06,0x00,0x06,0xf0,0x04,0xd1,0x9e,0xfd,0x80,
+0x00,0x5f,0xee,0xfe,0xef,0xfc,0x00,0x5f,0xfc,0x20,0x04,0xff,0x80,0x5f,0xe1,0x5c,
+0x04,0x00,0x1e,0x00,0x20,0x0f,0xf2,0x06,0x00,0x20,0x0d,0xf5,0x06,0x00,0x26,0x0c,
+0xf5,0x0c,0x00,0x23,0x0f,0xf3,0x24,0x00,0x00,0x30,0x00,0x31,0x70,0x5f,0xde,0x3c,
+0x00,0x10,0xa1,0x48,0x00,0xf2,0x0e,0x00,0x18,0xdf,0xeb,0x40,0x00,0x3e,0xff,0xde,
+0xff,0x70,0x0e,0xf9,0x00,0x06,0xff,0x36,0xfd,0x00,0x00,0x09,0xf9,0xbf,0x70,0x00,
+0x00,0x38,0x6d,0xf4,0xbb,0x00,0x00,0xa9,0x06,0x01,0x78,0x02,0x00,0x16,0x00,0x90,
+0x03,0x26,0xfd,0x00,0x00,0x08,0xf9,0x0e,0xf9,0x37,0x02,0x80,0x3e,0xff,0xce,0xff,
+0x60,0x00,0x19,0xdf,0x16,0x06,0x04,0xa0,0x00,0x2d,0x05,0xfd,0x0b,0x00,0xf0,0x08,
+0x03,0xbe,0xfc,0x65,0xfd,0x04,0xff,0xfd,0xff,0xdf,0xd1,0xef,0xb1,0x00,0x6f,0xfd,
+0x6f,0xe0,0x00,0x00,0x8f,0xdb,0xf8,0x21,0x00,0x75,0xdf,0x50,0x00,0x00,0x5f,0xde,
+0xf4,0x0b,0x00,0x20,0xda,0xf7,0x0b,0x00,0x20,0x6f,0xd0,0x1a,0x08,0xf0,0x17,0xef,
+0x70,0x00,0x3e,0xfd,0x04,0xff,0xda,0xbf,0xef,0xd0,0x03,0xbf,0xfd,0x73,0xfd,0x00,
+0x07,0xdf,0xeb,0x30,0x00,0x1d,0xff,0xde,0xff,0x50,0x0c,0xfa,0x10,0x07,0xff,0x15,
+0xfd,0x00,0x00,0x0b,0xf7,0x49,0x01,0x80,0x6f,0xbd,0xfd,0xcc,0xcc,0xcd,0xfc,0xef,
+0x92,0x01,0x12,0xdd,0xab,0x00,0x10,0x80,0xc6,0x03,0x00,0x92,0x03,0xf0,0x02,0x40,
+0x0d,0xfc,0x20,0x01,0xaf,0x60,0x2e,0xff,0xdd,0xff,0xc0,0x00,0x18,0xdf,0xfc,0x70,
+0x54,0x08,0x90,0xfe,0x40,0x00,0x9f,0xff,0xe4,0x00,0x1f,0xf7,0x3a,0x04,0x20,0x00,
+0x00,0xa0,0x02,0x91,0x04,0xff,0xff,0xff,0x90,0x3a,0xcf,0xfa,0xa6,0x07,0x05,0x00,
+0x12,0x00,0x0f,0x09,0x00,0x17,0xf5,0x0d,0x3b,0xef,0xc6,0x2f,0xd0,0x4f,0xff,0xef,
+0xfc,0xfd,0x1e,0xfb,0x10,0x06,0xff,0xd6,0xfe,0x00,0x00,0x07,0xfd,0xaf,0x90,0x00,
+0x00,0x5f,0xdd,0xf6,0xdb,0x00,0x11,0xdc,0x0b,0x00,0x01,0x16,0x00,0x02,0x21,0x00,
+0x10,0x0e,0x2c,0x00,0xa1,0xd0,0x4f,0xff,0xdf,0xfd,0xfd,0x00,0x3b,0xff,0xc6,0x33,
+0x01,0xfe,0x08,0x07,0xfc,0x03,0x10,0x00,0x00,0xcf,0x91,0xed,0x40,0x00,0x9f,0xf2,
+0x08,0xff,0xed,0xff,0xf6,0x00,0x03,0xae,0xfe,0xa3,0x5b,0x01,0x08,0x0b,0x00,0xf1,
+0x06,0x08,0xdf,0xe9,0x10,0x5f,0xdd,0xfe,0xef,0xfc,0x05,0xff,0xd3,0x00,0x5f,0xf4,
+0x5f,0xf1,0x00,0x00,0xbf,0x85,0xc8,0x01,0x00,0x21,0x00,0x21,0x8f,0x95,0xb2,0x01,
+0x0f,0x0b,0x00,0x0e,0x60,0x1e,0xd0,0x4f,0xf2,0x06,0x50,0x45,0x06,0x0f,0x02,0x00,
+0x05,0x81,0x00,0x3e,0xb0,0x00,0x7f,0xf0,0x00,0x07,0x25,0x07,0x0f,0xfa,0x03,0x18,
+0x9e,0xd0,0x00,0x9f,0xb0,0xbe,0xff,0x50,0xaf,0xd7,0xd4,0x02,0x0c,0x06,0x00,0xf0,
+0x08,0x08,0xfe,0x20,0x5f,0xd0,0x00,0x7f,0xf3,0x00,0x5f,0xd0,0x06,0xff,0x40,0x00,
+0x5f,0xd0,0x5f,0xf6,0x00,0x00,0x5f,0xd3,0xb3,0x05,0x30,0x5f,0xee,0xfd,0x24,0x00,
+0x01,0x1f,0x09,0x40,0x5f,0xfb,0x7f,0xf2,0xa3,0x07,0x20,0x0b,0xfd,0x36,0x00,0x30,
+0x01,0xef,0x90,0x3c,0x00,0x22,0x4f,0xf5,0x42,0x00,0x10,0x10,0x4e,0x00,0x5f,0xcf,
+0xc0,0x2f,0xf2,0xff,0x03,0x00,0x05,0xf0,0x1b,0x6f,0xb1,0x9e,0xfe,0x80,0x03,0xbe,
+0xfd,0x70,0x06,0xfd,0xef,0xef,0xff,0xc6,0xff,0xef,0xff,0x90,0x6f,0xfa,0x10,0x06,
+0xff,0xfa,0x10,0x08,0xff,0x16,0xfe,0x00,0x00,0x0c,0xfe,0x00,0x00,0x0e,0xf5,0x6f,
+0xc0,0x00,0x00,0xb6,0x09,0x30,0xcf,0x66,0xfc,0x4c,0x01,0x41,0x00,0x00,0x0c,0xf6,
+0x13,0x00,0x1f,0x90,0x13,0x00,0x29,0xf0,0x08,0x60,0x5f,0xb0,0x8d,0xfe,0x91,0x05,
+0xfd,0xdf,0xee,0xff,0xc0,0x5f,0xfd,0x30,0x05,0xff,0x45,0xff,0x10,0x00,0x0b,0xf8,
+0xb3,0x00,0x1f,0x9f,0xa9,0x01,0x14,0x01,0x0b,0x00,0xf0,0x06,0x90,0x00,0x17,0xdf,
+0xec,0x50,0x00,0x02,0xdf,0xfd,0xdf,0xfa,0x00,0x0c,0xfb,0x10,0x03,0xef,0x80,0x5f,
+0xe0,0x75,0x06,0x20,0xbf,0x80,0xaf,0x03,0x00,0x72,0x02,0x40,0x0a,0xf8,0xef,0x40,
+0x80,0x00,0x02,0x0c,0x00,0x02,0x18,0x00,0x00,0x7b,0x03,0x31,0x4f,0xf1,0x0d,0x30,
+0x00,0x20,0x02,0xef,0x3c,0x00,0x00,0x01,0x04,0x50,0x50,0x00,0x5f,0xa3,0xae,0x55,
+0x04,0xa1,0xef,0xda,0xbf,0xfc,0x00,0x5f,0xf8,0x00,0x02,0xef,0x85,0x04,0x17,0x7f,
+0x55,0x04,0x26,0x0e,0xf4,0x4f,0x04,0x02,0x0c,0x00,0x41,0x1f,0xf2,0x5f,0xe0,0x24,
+0x00,0x80,0xfa,0x10,0x05,0xff,0x70,0x5f,0xef,0xfd,0x55,0x04,0x11,0xd2,0x48,0x00,
+0x0f,0xe7,0x01,0x09,0x00,0x2f,0x03,0xf0,0x04,0xd6,0x3f,0xc0,0x4f,0xff,0xde,0xfd,
+0xfc,0x1e,0xfb,0x10,0x04,0xff,0xc7,0xfe,0x00,0x00,0x06,0xfc,0xa0,0x00,0x90,0x5f,
+0xcd,0xf5,0x00,0x00,0x05,0xfc,0xef,0x40,0x0b,0x00,0x00,0x2f,0x03,0x02,0x16,0x00,
+0x20,0xc6,0xfe,0x19,0x03,0xb0,0x1e,0xfa,0x00,0x05,0xff,0xc0,0x4f,0xff,0xce,0xfe,
+0xfc,0x42,0x00,0x20,0x5f,0xc0,0xfc,0x02,0x01,0x26,0x06,0x0e,0x0b,0x00,0x01,0x05,
+0x00,0x80,0x3c,0xfc,0x5f,0xef,0xfe,0xb5,0xff,0xb1,0xcb,0x09,0x11,0x05,0x29,0x02,
+0x0f,0x07,0x00,0x07,0xf0,0x03,0x00,0x5c,0xff,0xd9,0x10,0x00,0x9f,0xfe,0xdf,0xfe,
+0x20,0x3f,0xf4,0x00,0x1c,0xfc,0x06,0xfc,0xbe,0x08,0x21,0x4f,0xf2,0x4c,0x04,0x61,
+0xfb,0x73,0x00,0x00,0x00,0x6d,0xc4,0x0a,0x50,0x01,0x5a,0xff,0x90,0x11,0x35,0x04,
+0x20,0x1c,0xf7,0x19,0x01,0xf2,0x01,0x7f,0xe3,0x00,0x08,0xfe,0x00,0xbf,0xfe,0xdf,
+0xff,0x50,0x00,0x6b,0xef,0xda,0x20,0xe5,0x01,0x03,0x04,0x00,0x88,0xef,0xff,0xff,
+0xf0,0x9a,0xdf,0xda,0xa0,0x14,0x00,0x0f,0x04,0x00,0x02,0xb1,0x7f,0xc0,0x00,0x00,
+0x2f,0xfe,0xe0,0x00,0x05,0xdf,0xd0,0x28,0x02,0x11,0x96,0x37,0x02,0x0f,0x0b,0x00,
+0x13,0xf0,0x08,0x94,0xfe,0x00,0x00,0x0b,0xf9,0x1f,0xf8,0x00,0x19,0xff,0x90,0x8f,
+0xff,0xef,0xfd,0xf9,0x00,0x7d,0xff,0xb4,0x8f,0x90,0x1c,0x00,0x20,0x3f,0xf0,0x4f,
+0x07,0xf0,0x09,0x8f,0xa0,0x0b,0xf6,0x00,0x00,0xdf,0x40,0x06,0xfc,0x00,0x02,0xfe,
+0x00,0x00,0xff,0x10,0x07,0xf9,0x00,0x00,0xaf,0x60,0x0c,0xa2,0x08,0x30,0xb0,0x1f,
+0xe0,0x8e,0x07,0x00,0x61,0x07,0x40,0x09,0xf6,0xcf,0x30,0x76,0x07,0x11,0xfd,0xf4,
+0x05,0x11,0xf8,0x30,0x08,0x11,0xf2,0xa4,0x0b,0x12,0xd0,0x56,0x01,0x10,0xff,0xfd,
+0x01,0xf0,0x12,0x1f,0xf0,0x00,0x05,0xff,0x50,0x00,0x1f,0xf0,0x0c,0xf4,0x00,0x0a,
+0xff,0xa0,0x00,0x5f,0xc0,0x08,0xf8,0x00,0x0e,0xde,0xe0,0x00,0x9f,0x70,0x03,0xfc,
+0x00,0x4f,0x8a,0xf3,0xb2,0x07,0xf0,0x13,0xef,0x10,0x8f,0x35,0xf8,0x01,0xfe,0x00,
+0x00,0xaf,0x50,0xde,0x00,0xfd,0x05,0xf9,0x00,0x00,0x6f,0x92,0xf9,0x00,0xbf,0x29,
 0xf5,0x00,0x00,0x1f,0xd7,0xf4,0x00,0x6f,0x7d,0xf1,0x68,0x09,0x50,0xf0,0x00,0x1f,
 0xdf,0xc0,0xd9,0x09,0x50,0xb0,0x00,0x0c,0xff,0x70,0x20,0x09,0x31,0x60,0x00,0x07,
-0x8a,0x08,0x21,0xff,0x10,0xaa,0x00,0xa0,0x1f,0xf6,0x00,0x00,0x9f,0xd0,0x06,0xfe,
-0x10,0x03,0x29,0x10,0x30,0x90,0x0c,0xf9,0x22,0x0c,0x20,0x6f,0xe1,0x0b,0x02,0x11,
-0xef,0xff,0x08,0x11,0xfb,0xaa,0x08,0x02,0xa5,0x06,0x10,0xfc,0x52,0x08,0x30,0xfb,
-0xdf,0x70,0x54,0x0c,0x20,0x3f,0xf2,0xb5,0x0c,0x50,0x0a,0xfb,0x00,0x08,0xfd,0x57,
-0x09,0x10,0x3f,0x62,0x18,0x30,0xf1,0x8f,0xc0,0x00,0x07,0x20,0x3f,0xf1,0x1b,0x06,
-0x20,0x0d,0xf7,0x6e,0x10,0x41,0x07,0xfc,0x00,0x05,0xbc,0x14,0x20,0x0a,0xf8,0xba,
-0x14,0x20,0x0e,0xf2,0x3a,0x1a,0x20,0x4f,0xd0,0x85,0x08,0x20,0x9f,0x70,0x5a,0x06,
-0x20,0xdf,0x20,0xb1,0x0d,0x11,0xfc,0x70,0x09,0x11,0xf7,0x40,0x0b,0x15,0xf1,0x63,
-0x02,0x00,0x6e,0x1c,0x04,0x86,0x08,0x21,0x1a,0xf9,0x2c,0x09,0x10,0xe1,0xda,0x08,
-0x23,0xfb,0x20,0x99,0x09,0x70,0xfc,0x0a,0xcc,0xcc,0xcc,0xff,0xa0,0xbf,0x08,0x10,
-0xe1,0x46,0x01,0x10,0xf5,0xc7,0x10,0x13,0xf9,0x74,0x09,0x00,0x34,0x0f,0x04,0x9d,
-0x09,0x00,0xb2,0x0a,0x01,0xbb,0x0a,0x31,0x00,0x5f,0xf3,0x95,0x0b,0x42,0xcc,0xcc,
-0xcc,0xc1,0x30,0x12,0x02,0x95,0x16,0x00,0xae,0x1d,0x61,0xaf,0xc2,0x00,0x03,0xfe,
-0x10,0xc3,0x1c,0x20,0x0b,0xf7,0x50,0x04,0x06,0x04,0x00,0x20,0x0e,0xf4,0xd9,0x00,
-0xc2,0x00,0x2d,0xff,0x40,0x00,0x4f,0xfd,0x10,0x00,0x02,0xaf,0xc0,0x75,0x08,0x26,
-0x0d,0xf5,0x24,0x00,0x00,0x02,0x02,0x00,0xe6,0x00,0x01,0x7d,0x0e,0x00,0xf7,0x1a,
-0x10,0x2d,0xc3,0x0a,0x3e,0x65,0xfc,0xfc,0x01,0x00,0x23,0x76,0x22,0x2e,0x1a,0x32,
-0x1b,0xfb,0x00,0x3e,0x17,0x22,0x8f,0xa0,0xb9,0x03,0x04,0x04,0x00,0x00,0xf6,0x06,
-0x00,0xcf,0x0c,0x00,0xe8,0x0a,0xb1,0x03,0xef,0xd4,0x00,0x00,0xaf,0xf5,0x00,0x0a,
-0xfb,0x20,0xbc,0x09,0x2a,0x4f,0xe0,0x2c,0x00,0x20,0x7f,0xb0,0x15,0x16,0x00,0xe1,
-0x0e,0x70,0x00,0x9f,0xd2,0x00,0x00,0x45,0x00,0x7d,0x07,0xf1,0x12,0xeb,0x30,0x00,
-0x00,0x97,0x07,0xff,0xff,0xf6,0x00,0x02,0xfa,0x1f,0xf4,0x16,0xff,0x90,0x1b,0xf5,
-0x5f,0x90,0x00,0x4e,0xff,0xff,0xc0,0x49,0x40,0x00,0x02,0xaf,0xf9,0x10,0x96,0x1a,
-0x14,0x20,0xbf,0x16,0x12,0x0a,0x6c,0x15,0x05,0x88,0x1a,0x02,0x93,0x03,0x04,0x42,
-0x18,0x12,0xff,0xc5,0x0c,0x00,0xb4,0x1e,0x22,0xff,0xc0,0x0a,0x00,0x42,0x4f,0xf9,
-0x9f,0xf4,0x0a,0x00,0x52,0xdf,0xf1,0x1f,0xfd,0x00,0xe3,0x0a,0x22,0x70,0x08,0x43,
-0x0b,0x42,0x0d,0xfe,0x00,0x00,0xd6,0x1a,0x22,0x6f,0xf6,0x04,0x00,0x02,0x10,0x00,
-0x21,0x0e,0xfe,0x35,0x0b,0x00,0x78,0x20,0x00,0x8e,0x02,0x21,0x0e,0xfd,0x40,0x00,
-0x00,0xa9,0x08,0x11,0xf4,0x54,0x00,0x52,0xf8,0x00,0x01,0xff,0xc0,0x68,0x00,0x40,
-0x10,0x09,0xff,0xdc,0x01,0x0a,0x53,0xcd,0xff,0x90,0x1f,0xff,0x01,0x00,0x24,0xf1,
-0xaf,0x0a,0x00,0x22,0xfa,0x00,0x32,0x1a,0x13,0xcc,0x6c,0x19,0x22,0x04,0xff,0x50,
-0x17,0x00,0x1d,0x02,0x11,0x46,0x64,0x0b,0x41,0x38,0xb5,0x6f,0xe0,0x5f,0x0e,0x50,
-0x2b,0xff,0xfa,0x9f,0xb0,0x4c,0x01,0x60,0x03,0xef,0xfb,0x60,0xcf,0xe1,0x37,0x17,
-0xe0,0x2f,0xfc,0x20,0x00,0xef,0xfe,0x89,0xff,0x50,0x00,0xcf,0xc0,0x00,0x01,0x50,
-0x15,0x01,0x15,0x11,0x00,0x9d,0x08,0x50,0x54,0x00,0x0b,0xfa,0x00,0x9c,0x1b,0x30,
-0xc2,0x5f,0xa0,0xf5,0x01,0x80,0x0a,0xff,0xf8,0x00,0x4f,0xe0,0x0f,0xf2,0xd4,0x00,
-0x50,0x40,0x00,0x1f,0xf0,0x0f,0x32,0x1b,0x10,0xc1,0x9b,0x1d,0x00,0x1e,0x00,0x11,
-0x28,0xa3,0x07,0x13,0x09,0x73,0x19,0x00,0x70,0x12,0x11,0x20,0x57,0x01,0x00,0x4c,
-0x03,0x11,0xc0,0x09,0x01,0xc0,0xfc,0x00,0x00,0x2e,0xfd,0x30,0x00,0x00,0x03,0xdf,
-0xe2,0x00,0x82,0x00,0x31,0x75,0x57,0xbf,0x6a,0x10,0x10,0x1a,0xc6,0x00,0x11,0xa1,
-0x37,0x00,0x42,0x27,0xbd,0xcb,0x72,0x41,0x00,0x53,0x59,0x99,0x99,0x99,0x81,0x94,
-0x20,0x00,0x1c,0x16,0x01,0x3f,0x1c,0x80,0xb5,0x04,0xff,0xff,0xfe,0x01,0xec,0x10,
-0x8c,0x00,0x50,0x50,0x7f,0xff,0xf4,0x0d,0x8c,0x01,0xf0,0x07,0x21,0xdf,0x60,0x0a,
-0xff,0x90,0x07,0xf5,0x56,0x00,0x01,0xfd,0x85,0x00,0x00,0xdd,0x00,0x00,0x3d,0xff,
-0x10,0x06,0xb0,0x12,0x20,0x23,0x00,0x3d,0x1b,0x32,0x00,0x4b,0x50,0xba,0x01,0x53,
-0x75,0x50,0x0d,0xed,0x00,0xfc,0x0c,0x43,0xf0,0x0f,0xff,0x00,0xda,0x0c,0x33,0xd0,
-0x06,0x78,0x0b,0x00,0x53,0x84,0x00,0x05,0xcf,0x40,0xe6,0x01,0x21,0xd0,0x09,0x0d,
-0x12,0x00,0x3b,0x10,0x42,0xa0,0x03,0xa6,0x92,0x5e,0x10,0x52,0x42,0x10,0x00,0x1b,
-0xfd,0x10,0x02,0xb0,0xf7,0x00,0x00,0x2f,0xfb,0x83,0x00,0x00,0x00,0x3c,0x5d,0xbb,
-0x10,0x80,0x73,0xff,0x66,0x32,0x65,0xef,0xc0,0x30,0x34,0x0c,0x42,0xfe,0x7f,0xf8,
-0xfd,0xd0,0x0c,0x63,0x02,0xc5,0x9f,0xc5,0xff,0x18,0x59,0x02,0x32,0x5b,0x81,0xb8,
-0x09,0x00,0x15,0x2a,0x6a,0x02,0x71,0x02,0xef,0xe4,0x6b,0xde,0xda,0x50,0x34,0x19,
-0x01,0xcc,0x01,0x20,0xfe,0x70,0x27,0x1e,0xf0,0x00,0xd1,0xbf,0xfa,0x33,0x47,0xcf,
-0xfb,0x10,0x00,0x0c,0xfd,0x10,0x0b,0xff,0x50,0x86,0x06,0xf0,0x05,0x00,0x0e,0xfc,
-0x10,0x00,0xaf,0xf6,0x00,0x00,0x2e,0xf9,0x00,0x02,0xef,0xd1,0x00,0x09,0xff,0x40,
-0x00,0x62,0x01,0x40,0xaf,0xfd,0x10,0x05,0x44,0x02,0x90,0xaf,0x90,0x00,0xff,0xef,
-0xd2,0x4f,0xfa,0x00,0x46,0x06,0x41,0x03,0xfe,0x1d,0xfe,0x4a,0x21,0x52,0x0f,0xf1,
-0x04,0xfc,0x01,0xb7,0x04,0x72,0x0e,0xf3,0x04,0xfd,0x00,0x1b,0xb0,0x0b,0x00,0x22,
-0x02,0xfe,0x81,0x00,0x00,0x95,0x20,0x02,0x74,0x19,0x01,0x77,0x05,0x02,0xc1,0x1d,
-0x01,0x4d,0x00,0x11,0x2f,0xc0,0x00,0x01,0x63,0x00,0x21,0x09,0xfd,0x20,0x03,0x20,
+0x8a,0x08,0x21,0xff,0x10,0xaa,0x00,0xf0,0x02,0x1f,0xf6,0x00,0x00,0x9f,0xd0,0x06,
+0xfe,0x10,0x03,0xff,0x40,0x00,0xcf,0x90,0x0c,0xf9,0x22,0x0c,0x20,0x6f,0xe1,0x0b,
+0x02,0x11,0xef,0xff,0x08,0x11,0xfb,0xaa,0x08,0x02,0xa5,0x06,0x10,0xfc,0x52,0x08,
+0x30,0xfb,0xdf,0x70,0x54,0x0c,0x20,0x3f,0xf2,0xb5,0x0c,0x50,0x0a,0xfb,0x00,0x08,
+0xfd,0x57,0x09,0x80,0x3f,0xf4,0x00,0x00,0x7f,0xf1,0x8f,0xc0,0x00,0x07,0x20,0x3f,
+0xf1,0x1b,0x06,0xb0,0x0d,0xf7,0x00,0x00,0xff,0x30,0x07,0xfc,0x00,0x05,0xfd,0x27,
+0x0f,0x00,0xe6,0x0a,0xa0,0xcf,0x70,0x0e,0xf2,0x00,0x00,0x6f,0xc0,0x4f,0xd0,0x85,
+0x08,0x20,0x9f,0x70,0x5a,0x06,0x20,0xdf,0x20,0xb1,0x0d,0x11,0xfc,0x70,0x09,0x11,
+0xf7,0x40,0x0b,0x15,0xf1,0x63,0x02,0x35,0x00,0x8f,0x60,0x86,0x08,0x21,0x1a,0xf9,
+0x2c,0x09,0x10,0xe1,0xda,0x08,0x23,0xfb,0x20,0x99,0x09,0x70,0xfc,0x0a,0xcc,0xcc,
+0xcc,0xff,0xa0,0xbf,0x08,0x10,0xe1,0x46,0x01,0x00,0x96,0x06,0x23,0x1e,0xf9,0x74,
+0x09,0x00,0x34,0x0f,0x04,0x9d,0x09,0x00,0xb2,0x0a,0x01,0xbb,0x0a,0x31,0x00,0x5f,
+0xf3,0x95,0x0b,0xa0,0xcc,0xcc,0xcc,0xc1,0xff,0xff,0xff,0xff,0xff,0x10,0xf6,0x0c,
+0x00,0x00,0x00,0x12,0x00,0x00,0x09,0xfb,0x00,0x00,0xaf,0xc2,0x00,0x03,0xfe,0x10,
+0x00,0x08,0xf9,0x00,0x00,0x0b,0xf7,0x00,0x00,0x0c,0xf6,0x04,0x00,0xf6,0x0b,0x0e,
+0xf4,0x00,0x00,0x6f,0xe0,0x00,0x2d,0xff,0x40,0x00,0x4f,0xfd,0x10,0x00,0x02,0xaf,
+0xc0,0x00,0x00,0x0f,0xf3,0x00,0x00,0x0d,0xf5,0x24,0x00,0xfe,0x0a,0x0b,0xf6,0x00,
+0x00,0x0a,0xf8,0x00,0x00,0x06,0xfd,0x00,0x00,0x00,0xdf,0x80,0x00,0x00,0x2d,0xfa,
+0x00,0x00,0x00,0x65,0xfc,0xfc,0x01,0x00,0xb0,0x76,0x22,0x00,0x00,0x00,0x9f,0x90,
+0x00,0x00,0x1b,0xfb,0x2c,0x00,0x96,0x50,0x00,0x00,0x8f,0xa0,0x00,0x00,0x5f,0xd0,
+0x04,0x00,0xf2,0x0b,0x4f,0xe0,0x00,0x00,0x3f,0xf0,0x00,0x00,0x0d,0xf8,0x00,0x00,
+0x03,0xef,0xd4,0x00,0x00,0xaf,0xf5,0x00,0x0a,0xfb,0x20,0x00,0x1f,0xf1,0x1c,0x00,
+0x08,0x2c,0x00,0xf0,0x27,0x7f,0xb0,0x00,0x00,0xcf,0x70,0x00,0x07,0xfe,0x10,0x00,
+0x9f,0xd2,0x00,0x00,0x45,0x00,0x00,0x00,0x00,0x6c,0xeb,0x30,0x00,0x00,0x97,0x07,
+0xff,0xff,0xf6,0x00,0x02,0xfa,0x1f,0xf4,0x16,0xff,0x90,0x1b,0xf5,0x5f,0x90,0x00,
+0x4e,0xff,0xff,0xc0,0x49,0x40,0x00,0x02,0xaf,0xf9,0x10,0x26,0x00,0x33,0x02,0x20,
+0x00,0x01,0x00,0x24,0x0a,0xa0,0x0a,0x00,0x24,0x3f,0xf3,0x0a,0x00,0x23,0xbf,0xfb,
+0x09,0x00,0x42,0x03,0xff,0xff,0x30,0x0a,0x00,0x42,0x0c,0xff,0xff,0xc0,0x0a,0x00,
+0x42,0x4f,0xf9,0x9f,0xf4,0x0a,0x00,0x41,0xdf,0xf1,0x1f,0xfd,0x09,0x00,0x60,0x05,
+0xff,0x70,0x08,0xff,0x50,0x0a,0x00,0x60,0x0d,0xfe,0x00,0x00,0xef,0xd0,0x0a,0x00,
+0x22,0x6f,0xf6,0x04,0x00,0x02,0x10,0x00,0x81,0x0e,0xfe,0x00,0x00,0x00,0x07,0xff,
+0x50,0x2c,0x00,0x41,0x00,0x00,0x0e,0xfd,0x40,0x00,0x51,0xe0,0x00,0x00,0x8f,0xf4,
+0x54,0x00,0x52,0xf8,0x00,0x01,0xff,0xc0,0x68,0x00,0xd3,0x10,0x09,0xff,0xdc,0xcc,
+0xcc,0xcc,0xcc,0xcd,0xff,0x90,0x1f,0xff,0x01,0x00,0x24,0xf1,0xaf,0x0a,0x00,0x12,
+0xfa,0x7b,0x00,0x32,0x29,0xcc,0x70,0x09,0x00,0x42,0x04,0xff,0xff,0xfc,0x0a,0x00,
+0xf0,0x07,0x0e,0xfb,0x46,0xef,0x80,0x00,0x00,0x00,0x38,0xb5,0x6f,0xe0,0x00,0x5f,
+0xe0,0x00,0x00,0x2b,0xff,0xfa,0x9f,0xb0,0x4c,0x01,0xf0,0x11,0x03,0xef,0xfb,0x60,
+0xcf,0xe1,0x00,0x7f,0xd0,0x00,0x2f,0xfc,0x20,0x00,0xef,0xfe,0x89,0xff,0x50,0x00,
+0xcf,0xc0,0x00,0x01,0xff,0xff,0xff,0xf8,0x00,0x05,0xff,0x20,0x45,0x00,0x50,0xff,
+0x54,0x00,0x0b,0xfa,0xa3,0x00,0x40,0xff,0xc2,0x5f,0xa0,0xf5,0x01,0x80,0x0a,0xff,
+0xf8,0x00,0x4f,0xe0,0x0f,0xf2,0xd4,0x00,0xe0,0x40,0x00,0x1f,0xf0,0x0f,0xf1,0x00,
+0x00,0x0f,0xc1,0x00,0x00,0x1f,0xf0,0x1e,0x00,0x20,0x28,0x00,0x8e,0x01,0x22,0x09,
+0xf9,0x7b,0x00,0x51,0x9f,0x90,0x04,0xff,0x20,0x57,0x01,0x20,0xff,0x40,0x5a,0x00,
+0x00,0x09,0x01,0xc0,0xfc,0x00,0x00,0x2e,0xfd,0x30,0x00,0x00,0x03,0xdf,0xe2,0x00,
+0x82,0x00,0x40,0x75,0x57,0xbf,0xfe,0x4c,0x01,0x10,0x1a,0xc6,0x00,0x11,0xa1,0x37,
+0x00,0x42,0x27,0xbd,0xcb,0x72,0x41,0x00,0x52,0x59,0x99,0x99,0x99,0x81,0x0b,0x00,
+0x50,0x1e,0xff,0xff,0xff,0xa0,0xa4,0x01,0x90,0x01,0xb5,0x04,0xff,0xff,0xfe,0x01,
+0xec,0x10,0x8c,0x00,0x50,0x50,0x7f,0xff,0xf4,0x0d,0x8c,0x01,0xf2,0x14,0x21,0xdf,
+0x60,0x0a,0xff,0x90,0x07,0xf5,0x56,0x00,0x01,0xfd,0x85,0x00,0x00,0xdd,0x00,0x00,
+0x3d,0xff,0x10,0x06,0xff,0xd0,0x00,0x00,0x23,0x00,0x00,0x0d,0xfb,0x10,0x00,0x4b,
+0x50,0xba,0x01,0x42,0x75,0x50,0x0d,0xed,0x52,0x00,0x53,0x01,0xff,0xf0,0x0f,0xff,
+0xd1,0x01,0x43,0xff,0xd0,0x06,0x78,0x0b,0x00,0x53,0x84,0x00,0x05,0xcf,0x40,0xe6,
+0x01,0x42,0xd0,0x09,0xff,0x80,0x4f,0x01,0x51,0xef,0xa0,0x03,0xa6,0x92,0x0b,0x00,
+0x62,0x2d,0x42,0x10,0x00,0x1b,0xfd,0x10,0x02,0xf0,0x07,0xf7,0x00,0x00,0x2f,0xfb,
+0x83,0x00,0x00,0x00,0x3c,0x5d,0xf3,0x00,0x00,0x06,0x73,0xff,0x66,0x32,0x65,0xef,
+0xc0,0xcf,0x00,0x71,0x0b,0xfe,0x7f,0xf8,0xfd,0x6f,0xf2,0xfd,0x00,0x53,0xc5,0x9f,
+0xc5,0xff,0x18,0x59,0x02,0x32,0x5b,0x81,0xb8,0x09,0x00,0x15,0x2a,0x6a,0x02,0x61,
+0x02,0xef,0xe4,0x6b,0xde,0xda,0x9f,0x00,0x11,0x1d,0xcc,0x01,0xf0,0x1e,0xfe,0x70,
+0x00,0x00,0x01,0xdf,0xd1,0xbf,0xfa,0x33,0x47,0xcf,0xfb,0x10,0x00,0x0c,0xfd,0x10,
+0x0b,0xff,0x50,0x00,0x05,0xff,0xc0,0x00,0x0e,0xfc,0x10,0x00,0xaf,0xf6,0x00,0x00,
+0x2e,0xf9,0x00,0x02,0xef,0xd1,0x00,0x09,0xff,0x40,0x00,0x62,0x01,0x40,0xaf,0xfd,
+0x10,0x05,0x44,0x02,0x80,0xaf,0x90,0x00,0xff,0xef,0xd2,0x4f,0xfa,0xb5,0x02,0xf1,
+0x02,0xe0,0x03,0xfe,0x1d,0xfe,0xff,0xb0,0x00,0x00,0x00,0x0f,0xf1,0x04,0xfc,0x01,
+0xdf,0xfb,0x0c,0x02,0x62,0xf3,0x04,0xfd,0x00,0x1b,0xb0,0x0b,0x00,0x23,0x02,0xfe,
+0x81,0x00,0x53,0x0f,0xf1,0x00,0xef,0x20,0xec,0x02,0x11,0xd0,0x86,0x03,0x21,0x00,
+0x00,0x4d,0x00,0x11,0x2f,0xc0,0x00,0x01,0x63,0x00,0x21,0x09,0xfd,0x20,0x03,0x20,
 0x2e,0xf8,0xa0,0x02,0x11,0xe4,0xdc,0x02,0x00,0xd0,0x01,0x62,0x1b,0xff,0xc7,0x54,
 0x58,0xdf,0x17,0x03,0x10,0x7e,0xbb,0x00,0x13,0x60,0xb9,0x01,0x22,0xcd,0xc9,0x70,
-0x01,0x70,0x09,0x99,0x98,0x88,0x88,0x88,0x85,0x42,0x09,0x00,0x01,0x00,0x00,0x02,
-0x23,0x50,0xff,0xff,0xee,0xee,0xef,0x68,0x21,0x21,0xf0,0x00,0x52,0x08,0x11,0x04,
-0x0b,0x0f,0x62,0xef,0x30,0x00,0x09,0xff,0x30,0x36,0x1f,0x32,0x0e,0xfc,0x00,0x42,
-0x04,0x20,0x0f,0xfa,0x46,0x02,0x10,0xf0,0x80,0x02,0x51,0x00,0x00,0x2c,0xfc,0x20,
-0x2c,0x03,0x31,0x04,0xef,0x80,0x2d,0x14,0x31,0xb0,0x1f,0xe3,0x69,0x01,0x41,0x6f,
-0xc0,0x6f,0xf4,0x88,0x17,0x41,0x3f,0x70,0xdf,0xfd,0xb9,0x00,0x50,0x7f,0x23,0xf5,
-0xff,0x20,0x90,0x10,0xd3,0xad,0x09,0xd0,0xdf,0x40,0x00,0x00,0xbf,0x50,0xb6,0x03,
-0x00,0xdf,0x40,0x1f,0x10,0x02,0xf4,0x01,0x00,0xa3,0x0f,0x21,0x1c,0xf9,0xe2,0x0f,
-0x42,0xa5,0x47,0xef,0xe1,0x75,0x15,0x22,0xff,0xfd,0xad,0x02,0x22,0x8c,0xdb,0xc6,
-0x00,0x00,0xf0,0x1d,0x12,0xf5,0x99,0x15,0x24,0xff,0xf6,0x08,0x00,0x42,0x11,0x10,
-0xcf,0xff,0x1b,0x12,0xa2,0xfa,0x66,0x65,0x55,0x55,0x44,0x44,0x9e,0xf7,0x00,0xff,
-0x00,0x06,0x08,0x00,0x10,0xef,0xb3,0x21,0x02,0x08,0x00,0x90,0xfc,0x00,0x7e,0xe7,
-0x00,0x22,0x22,0x22,0x21,0x08,0x00,0x02,0x20,0x00,0x06,0x10,0x00,0x02,0x20,0x00,
-0x12,0xe8,0x30,0x00,0x22,0x7f,0xe8,0x20,0x00,0x05,0x08,0x00,0xfa,0x01,0xeb,0x66,
-0x66,0x77,0x77,0x77,0x77,0xbf,0xbf,0xff,0xef,0xff,0xff,0xfe,0xdd,0xda,0x88,0x00,
-0x10,0x00,0x7e,0x01,0x34,0xbb,0xbb,0xb4,0x46,0x02,0x23,0x01,0x10,0x09,0x00,0x60,
-0x5a,0xef,0xff,0xe9,0x20,0x03,0x94,0x02,0x01,0x9a,0x1f,0xf0,0x01,0x0f,0x90,0x00,
-0x05,0xff,0xff,0xeb,0xab,0xef,0xc0,0x0f,0xfe,0x40,0x4f,0xff,0xc4,0x94,0x1b,0x52,
-0x0f,0x7a,0xfa,0xef,0xf9,0xfb,0x01,0x43,0x50,0x4e,0xff,0xb0,0x0a,0x00,0x34,0x00,
-0x8f,0xc3,0x0a,0x00,0x32,0x03,0xcf,0x80,0x0a,0x00,0x00,0xbd,0x05,0x13,0x40,0x0a,
-0x00,0x12,0x02,0xd5,0x1c,0x00,0x55,0x0c,0x13,0xc2,0x1e,0x00,0x23,0x09,0xf8,0x32,
-0x00,0x33,0x02,0xcf,0x40,0x0a,0x00,0x23,0x5f,0xff,0x0a,0x00,0x21,0x69,0xfc,0x9c,
-0x06,0x00,0xa4,0x06,0x22,0x60,0xbf,0x4d,0x14,0xb0,0x0f,0xd2,0x00,0x1d,0xff,0xfa,
-0x52,0x12,0x69,0x40,0x0a,0x16,0x1c,0x04,0x3a,0x20,0x00,0x30,0x1e,0x00,0x52,0x1b,
-0x01,0x6c,0x02,0x53,0x8a,0xa9,0x62,0x00,0x3e,0xd5,0x04,0xd0,0xf3,0x5f,0x55,0xff,
-0xfb,0x55,0x55,0x55,0x55,0xf5,0x5f,0x00,0xef,0x95,0x11,0xc0,0x12,0xe5,0x5f,0x00,
-0xcf,0xf7,0x00,0x04,0xdf,0xff,0xf5,0x5f,0xaa,0x01,0x20,0xbf,0xff,0x09,0x00,0x41,
-0x47,0x73,0x2d,0xff,0x09,0x00,0x41,0xdf,0xfa,0x00,0x6e,0x09,0x00,0xa1,0xef,0xfb,
-0x00,0x00,0x7c,0xcb,0xf5,0x5f,0x00,0xcf,0xe7,0x00,0x10,0xe5,0x2d,0x00,0x0c,0x09,
-0x00,0x05,0x1b,0x00,0x23,0xef,0xfb,0x09,0x00,0x23,0xdf,0xfa,0x09,0x00,0x23,0x58,
-0x83,0x09,0x00,0x24,0x13,0x31,0x2d,0x00,0x05,0x24,0x00,0x14,0xfc,0x12,0x00,0x03,
-0x09,0x00,0x03,0xab,0x00,0x32,0xf5,0x05,0x55,0x01,0x00,0x10,0x50,0xc5,0x00,0x42,
-0x9c,0xee,0xc9,0x40,0xcf,0x00,0x10,0xdf,0xa3,0x1a,0x12,0x40,0x60,0x02,0x51,0xaf,
-0x6b,0xd7,0xef,0xf8,0x74,0x02,0x80,0xa1,0x0f,0x6a,0xc0,0x08,0xff,0x80,0x00,0x53,
-0x1d,0x40,0x0f,0x6a,0xc0,0x00,0xa1,0x18,0x20,0xdf,0x90,0x0b,0x00,0x00,0x3e,0x08,
-0x10,0x05,0x87,0x08,0x20,0x6a,0xc0,0x68,0x13,0x00,0x3f,0x07,0x30,0x1f,0xbd,0xc0,
-0x58,0x22,0x20,0x0e,0xf3,0x8b,0x12,0x10,0x90,0x7a,0x10,0x21,0x0f,0xf1,0x6c,0x11,
-0x60,0x50,0x00,0x0f,0xf0,0x0f,0xf1,0xe4,0x20,0xf0,0x1a,0x6f,0xfa,0x10,0x0f,0xf0,
-0x0e,0xf2,0x00,0xbf,0xcf,0x41,0xfb,0x6f,0xe5,0x1f,0xe0,0x0b,0xf6,0x2d,0xf5,0x4f,
-0xa1,0xdf,0x72,0xbf,0xcf,0xb0,0x06,0xfd,0xee,0x36,0xfb,0x00,0x08,0xfc,0x26,0xff,
-0x60,0x00,0xef,0xd2,0xdd,0x03,0x30,0x3c,0xf9,0xfe,0x9d,0x1f,0x11,0xf6,0xa2,0x05,
-0x10,0xf6,0x46,0x05,0x01,0x33,0x16,0x20,0xef,0xa0,0x3c,0x03,0x62,0xfa,0x40,0x00,
-0x04,0xaf,0xfa,0xcb,0x11,0x33,0xff,0xee,0xff,0xb5,0x12,0x54,0x17,0xcf,0xff,0xfc,
-0x71,0x6a,0x02,0x13,0x22,0x62,0x06,0x22,0xac,0xb7,0x73,0x02,0x00,0xd2,0x03,0x12,
-0xf4,0xed,0x03,0x52,0xfe,0x62,0x39,0xff,0x20,0x5a,0x1d,0x04,0x02,0x1b,0xf0,0x07,
-0x7f,0x80,0x00,0x00,0x0e,0xf0,0x00,0x46,0x40,0x00,0x9f,0x40,0x00,0x00,0x0c,0xf3,
-0x3d,0xff,0xfd,0x20,0x8f,0x50,0x6c,0x21,0x50,0xef,0xff,0xff,0xe1,0x5f,0x31,0x0a,
-0x10,0xe9,0x71,0x06,0x60,0x0e,0xf9,0x00,0x02,0xdf,0x7c,0x58,0x03,0x61,0x03,0xff,
-0xea,0xbf,0xfb,0x0b,0xf7,0x24,0x51,0x2b,0xff,0xff,0xfb,0x47,0x37,0x04,0xc1,0x2d,
-0xff,0xed,0xff,0xfe,0xff,0xff,0xff,0xc0,0x02,0xef,0xa2,0xae,0x16,0x61,0xfc,0x00,
-0x0b,0xf8,0x00,0x4f,0x7c,0x01,0x51,0x40,0x2f,0xd0,0x02,0xef,0x0a,0x00,0x42,0xd0,
-0x7f,0x60,0x0b,0x90,0x01,0x42,0xf4,0xaf,0x20,0x4f,0x0a,0x00,0x43,0xf8,0xcf,0x10,
-0xaf,0x24,0x07,0x23,0xcf,0xdd,0xae,0x01,0x51,0xfb,0xaf,0xff,0xfe,0xdd,0x01,0x00,
-0x1a,0xd8,0x1b,0x20,0x03,0x76,0x20,0x04,0x99,0x22,0x04,0xc3,0x1b,0x03,0x01,0x00,
-0x13,0x09,0x1c,0x17,0x00,0xce,0x01,0x14,0xd1,0x0a,0x00,0x10,0x08,0x36,0x04,0x80,
-0x12,0x22,0x22,0x11,0x11,0x10,0x8f,0xe2,0xd9,0x13,0x02,0xc4,0x05,0x13,0x30,0x0a,
-0x00,0x00,0x1c,0x01,0x22,0x5c,0xcc,0x01,0x00,0x40,0xdc,0x30,0x01,0x22,0x01,0x00,
-0x00,0x2c,0x00,0x01,0x6a,0x18,0x01,0x88,0x28,0x25,0x00,0x1d,0x0a,0x00,0xb2,0x01,
-0xcf,0xfc,0xbc,0xcc,0xcd,0xdd,0xee,0xe6,0x00,0x00,0x1b,0x28,0x02,0x60,0x01,0x15,
-0xc0,0x95,0x08,0x16,0xfc,0x96,0x00,0x15,0xc1,0x81,0x00,0x06,0x96,0x00,0x25,0x7e,
-0x20,0x0f,0x04,0x04,0x09,0x00,0x33,0xcc,0xa7,0x30,0x0a,0x00,0x54,0x9a,0xdf,0xfe,
-0x91,0x00,0x25,0x04,0x12,0xff,0x0b,0x00,0x51,0xcb,0x96,0x10,0x18,0xfe,0xf5,0x00,
-0x62,0x9b,0xdf,0xfb,0x30,0x2c,0xf5,0x91,0x06,0x31,0x7d,0xfb,0x10,0xbe,0x05,0x52,
-0x98,0x40,0x00,0x6e,0xe1,0xd7,0x1f,0x33,0xff,0x91,0x01,0x48,0x00,0x31,0x38,0xef,
-0x50,0x21,0x01,0x41,0x8b,0xbb,0x94,0x06,0xbd,0x03,0x51,0xef,0x71,0x03,0x9f,0xc3,
-0x93,0x00,0x11,0xf3,0x12,0x15,0x00,0xcb,0x12,0x31,0x70,0x05,0x95,0xc3,0x08,0x80,
-0x4f,0xff,0x10,0x7f,0xff,0x60,0x2f,0xfe,0x25,0x02,0x01,0xb3,0x05,0x20,0xff,0x30,
-0x14,0x00,0x51,0xaf,0xff,0x80,0x2f,0xfe,0x28,0x00,0x50,0x1a,0xda,0x00,0x8f,0xf5,
-0x4b,0x07,0x10,0xf2,0x70,0x07,0x11,0x80,0xe3,0x14,0x32,0x71,0x01,0x7f,0x4c,0x05,
-0x59,0x28,0xdf,0xff,0xc7,0x10,0xa0,0x01,0x11,0x8f,0x23,0x1e,0x03,0x85,0x14,0xb0,
-0xfb,0x00,0x00,0xdf,0x31,0x11,0x11,0x44,0xef,0xa0,0x00,0x35,0x0b,0x32,0xf6,0x3f,
-0xfa,0x08,0x00,0x30,0x04,0xff,0x90,0x08,0x00,0x40,0xfa,0x66,0x9f,0xf2,0x08,0x00,
-0x61,0xff,0xff,0x8c,0xf3,0xdf,0x20,0x45,0x09,0x0f,0x08,0x00,0x3f,0x10,0xee,0x01,
-0x00,0x23,0xef,0xf3,0x62,0x02,0x18,0xe1,0xcc,0x22,0x24,0x76,0x30,0x0a,0x00,0x33,
+0x01,0xa1,0x09,0x99,0x98,0x88,0x88,0x88,0x85,0x00,0x00,0x5f,0xdb,0x00,0xc0,0xf6,
+0x00,0x00,0xaf,0xff,0xff,0xee,0xee,0xef,0xf0,0x00,0x00,0x04,0x00,0x70,0x00,0x8f,
+0x90,0x00,0x04,0xff,0x90,0x0e,0x03,0x30,0x30,0x00,0x09,0xc9,0x01,0x72,0x06,0xfc,
+0x00,0x00,0x0e,0xfc,0x00,0x42,0x04,0x20,0x0f,0xfa,0x46,0x02,0x10,0xf0,0x80,0x02,
+0x51,0x00,0x00,0x2c,0xfc,0x20,0x2c,0x03,0x11,0x04,0xcf,0x02,0x51,0xcf,0xff,0xb0,
+0x1f,0xe3,0x69,0x01,0x40,0x6f,0xc0,0x6f,0xf4,0x77,0x02,0x51,0xf2,0x3f,0x70,0xdf,
+0xfd,0xb9,0x00,0x30,0x7f,0x23,0xf5,0x78,0x02,0xf2,0x01,0xcf,0x50,0xad,0x09,0xd0,
+0xdf,0x40,0x00,0x00,0xbf,0x50,0xb6,0x03,0x00,0xdf,0x30,0x55,0x04,0x10,0x02,0xf4,
+0x01,0x50,0x2f,0xf6,0x00,0x00,0x1c,0xa6,0x02,0x70,0x08,0xff,0xa5,0x47,0xef,0xe1,
+0x00,0x8a,0x00,0x32,0xff,0xff,0xfd,0xad,0x02,0x23,0x8c,0xdb,0xc6,0x00,0x50,0x1f,
+0xff,0xff,0xf5,0x00,0x2e,0x00,0x01,0xb9,0x00,0x02,0x08,0x00,0x32,0x11,0x10,0xcf,
+0x72,0x03,0xb2,0xfc,0xfa,0x66,0x65,0x55,0x55,0x44,0x44,0x9e,0xf7,0x00,0xff,0x00,
+0x06,0x08,0x00,0x43,0xef,0xff,0xff,0xfb,0x08,0x00,0x90,0xfc,0x00,0x7e,0xe7,0x00,
+0x22,0x22,0x22,0x21,0x08,0x00,0x02,0x20,0x00,0x06,0x10,0x00,0x02,0x20,0x00,0x12,
+0xe8,0x30,0x00,0x22,0x7f,0xe8,0x20,0x00,0x05,0x08,0x00,0xfa,0x01,0xeb,0x66,0x66,
+0x77,0x77,0x77,0x77,0xbf,0xbf,0xff,0xef,0xff,0xff,0xfe,0xdd,0xda,0x88,0x00,0x10,
+0x00,0x7e,0x01,0x34,0xbb,0xbb,0xb4,0x46,0x02,0x23,0x01,0x10,0x09,0x00,0x60,0x5a,
+0xef,0xff,0xe9,0x20,0x03,0x94,0x02,0x00,0xa6,0x00,0xf2,0x0b,0xf0,0x0f,0x90,0x00,
+0x05,0xff,0xff,0xeb,0xab,0xef,0xc0,0x0f,0xfe,0x40,0x4f,0xff,0xc4,0x00,0x00,0x02,
+0x00,0x0f,0x7a,0xfa,0xef,0xf9,0xfb,0x01,0x43,0x50,0x4e,0xff,0xb0,0x0a,0x00,0x34,
+0x00,0x8f,0xc3,0x0a,0x00,0x32,0x03,0xcf,0x80,0x0a,0x00,0x00,0xbd,0x05,0x13,0x40,
+0x0a,0x00,0x33,0x02,0xdf,0x50,0x0a,0x00,0x23,0x5f,0xc2,0x1e,0x00,0x23,0x09,0xf8,
+0x32,0x00,0x33,0x02,0xcf,0x40,0x0a,0x00,0x23,0x5f,0xff,0x0a,0x00,0x42,0x69,0xfc,
+0xff,0xe1,0x0a,0x00,0x22,0xff,0x60,0xe3,0x03,0xf1,0x01,0x00,0x0f,0xd2,0x00,0x1d,
+0xff,0xfa,0x52,0x12,0x69,0x40,0x0a,0x00,0x00,0x01,0xbf,0xa0,0x00,0x01,0x28,0x05,
+0x52,0xdf,0xff,0xff,0xff,0x90,0x6c,0x02,0x53,0x8a,0xa9,0x62,0x00,0x3e,0xd5,0x04,
+0xc0,0xf3,0x5f,0x55,0xff,0xfb,0x55,0x55,0x55,0x55,0xf5,0x5f,0x00,0xb1,0x00,0xd0,
+0x01,0x12,0xe5,0x5f,0x00,0xcf,0xf7,0x00,0x04,0xdf,0xff,0xf5,0x5f,0xaa,0x01,0x20,
+0xbf,0xff,0x09,0x00,0x41,0x47,0x73,0x2d,0xff,0x09,0x00,0x41,0xdf,0xfa,0x00,0x6e,
+0x09,0x00,0xa1,0xef,0xfb,0x00,0x00,0x7c,0xcb,0xf5,0x5f,0x00,0xcf,0xe7,0x00,0x10,
+0xe5,0x2d,0x00,0x0c,0x09,0x00,0x05,0x1b,0x00,0x23,0xef,0xfb,0x09,0x00,0x23,0xdf,
+0xfa,0x09,0x00,0x23,0x58,0x83,0x09,0x00,0x24,0x13,0x31,0x2d,0x00,0x05,0x24,0x00,
+0x14,0xfc,0x12,0x00,0x03,0x09,0x00,0x03,0xab,0x00,0x32,0xf5,0x05,0x55,0x01,0x00,
+0x10,0x50,0xc5,0x00,0x42,0x9c,0xee,0xc9,0x40,0xcf,0x00,0x00,0xda,0x00,0x22,0xfd,
+0x40,0x60,0x02,0x51,0xaf,0x6b,0xd7,0xef,0xf8,0x74,0x02,0x50,0xa1,0x0f,0x6a,0xc0,
+0x08,0x5b,0x04,0xd1,0x5f,0xf7,0x00,0x0f,0x6a,0xc0,0x00,0x6f,0xf5,0x00,0x00,0xdf,
+0x90,0x0b,0x00,0xe0,0x08,0xfd,0x00,0x05,0xfe,0x00,0x00,0x1f,0x6a,0xc0,0x00,0x00,
+0xef,0x50,0x3f,0x07,0x80,0x1f,0xbd,0xc0,0x00,0x00,0x7f,0xa0,0x0e,0x5e,0x07,0x00,
+0x26,0x01,0x50,0x2f,0xe0,0x0f,0xf1,0x00,0x37,0x06,0x30,0x50,0x00,0x0f,0x7f,0x05,
+0xf0,0x1d,0x09,0xf6,0x00,0x6f,0xfa,0x10,0x0f,0xf0,0x0e,0xf2,0x00,0xbf,0xcf,0x41,
+0xfb,0x6f,0xe5,0x1f,0xe0,0x0b,0xf6,0x2d,0xf5,0x4f,0xa1,0xdf,0x72,0xbf,0xcf,0xb0,
+0x06,0xfd,0xee,0x36,0xfb,0x00,0x08,0xfc,0x26,0xff,0x60,0x00,0xef,0xd2,0xdd,0x03,
+0x81,0x3c,0xf9,0xfe,0x00,0x00,0x6f,0xeb,0xf6,0xa2,0x05,0x00,0xa3,0x07,0x01,0xe4,
+0x04,0x30,0x03,0xef,0xa0,0x3c,0x03,0x50,0xfa,0x40,0x00,0x04,0xaf,0x08,0x01,0x00,
+0xf3,0x05,0x32,0xee,0xff,0xff,0x4f,0x06,0x54,0x17,0xcf,0xff,0xfc,0x71,0x6a,0x02,
+0x13,0x22,0x62,0x06,0x22,0xac,0xb7,0x73,0x02,0x00,0xd2,0x03,0x12,0xf4,0xed,0x03,
+0x32,0xfe,0x62,0x39,0xf1,0x05,0x00,0x3a,0x04,0x21,0x8f,0xb0,0xc7,0x02,0xf0,0x14,
+0x80,0x00,0x00,0x0e,0xf0,0x00,0x46,0x40,0x00,0x9f,0x40,0x00,0x00,0x0c,0xf3,0x3d,
+0xff,0xfd,0x20,0x8f,0x50,0x00,0x00,0x0d,0xf4,0xef,0xff,0xff,0xe1,0x5f,0xc0,0x00,
+0x00,0x3f,0xe9,0x71,0x06,0x60,0x0e,0xf9,0x00,0x02,0xdf,0x7c,0x58,0x03,0x70,0x03,
+0xff,0xea,0xbf,0xfb,0x0b,0xff,0x14,0x03,0x51,0x2b,0xff,0xff,0xfb,0x47,0x37,0x04,
+0xe0,0x2d,0xff,0xed,0xff,0xfe,0xff,0xff,0xff,0xc0,0x02,0xef,0xa2,0x03,0xef,0x27,
+0x00,0x51,0x00,0x0b,0xf8,0x00,0x4f,0x7c,0x01,0x51,0x40,0x2f,0xd0,0x02,0xef,0x0a,
+0x00,0x42,0xd0,0x7f,0x60,0x0b,0x90,0x01,0x42,0xf4,0xaf,0x20,0x4f,0x0a,0x00,0x43,
+0xf8,0xcf,0x10,0xaf,0x24,0x07,0x23,0xcf,0xdd,0xae,0x01,0x51,0xfb,0xaf,0xff,0xfe,
+0xdd,0x01,0x00,0x29,0xd8,0x00,0x01,0x00,0x14,0x40,0x09,0x00,0x25,0x04,0xfb,0x14,
+0x00,0x24,0x9f,0xb0,0x0a,0x00,0x34,0x09,0xfc,0x10,0x0b,0x00,0x24,0x8f,0xd1,0x0a,
+0x00,0x10,0x08,0x36,0x04,0xc2,0x12,0x22,0x22,0x11,0x11,0x10,0x8f,0xe2,0x00,0x00,
+0x7f,0xff,0xc4,0x05,0x13,0x30,0x0a,0x00,0x00,0x1c,0x01,0x22,0x5c,0xcc,0x01,0x00,
+0x40,0xdc,0x30,0x01,0x22,0x01,0x00,0x00,0x2c,0x00,0x23,0x02,0xdf,0x1f,0x00,0x35,
+0xf7,0x00,0x1d,0x0a,0x00,0xd5,0x01,0xcf,0xfc,0xbc,0xcc,0xcd,0xdd,0xee,0xe6,0x00,
+0x00,0x0b,0xfc,0x81,0x00,0x25,0xaf,0xc0,0x95,0x08,0x16,0xfc,0x96,0x00,0x15,0xc1,
+0x81,0x00,0x06,0x96,0x00,0x25,0x7e,0x20,0x0f,0x04,0x04,0x09,0x00,0x33,0xcc,0xa7,
+0x30,0x0a,0x00,0x54,0x9a,0xdf,0xfe,0x91,0x00,0x25,0x04,0x12,0xff,0x0b,0x00,0x51,
+0xcb,0x96,0x10,0x18,0xfe,0xf5,0x00,0x62,0x9b,0xdf,0xfb,0x30,0x2c,0xf5,0x91,0x06,
+0x31,0x7d,0xfb,0x10,0xbe,0x05,0x42,0x98,0x40,0x00,0x6e,0xc4,0x03,0x43,0xcf,0xff,
+0x91,0x01,0x48,0x00,0x31,0x38,0xef,0x50,0x21,0x01,0x41,0x8b,0xbb,0x94,0x06,0xbd,
+0x03,0x51,0xef,0x71,0x03,0x9f,0xc3,0x93,0x00,0x40,0xf3,0x00,0x00,0x04,0x88,0x06,
+0x51,0x09,0xff,0x70,0x05,0x95,0xc3,0x08,0x80,0x4f,0xff,0x10,0x7f,0xff,0x60,0x2f,
+0xfe,0x25,0x02,0x01,0xb3,0x05,0x20,0xff,0x30,0x14,0x00,0x51,0xaf,0xff,0x80,0x2f,
+0xfe,0x28,0x00,0x50,0x1a,0xda,0x00,0x8f,0xf5,0x4b,0x07,0x10,0xf2,0x70,0x07,0x20,
+0x80,0x00,0x15,0x00,0x32,0x71,0x01,0x7f,0x4c,0x05,0x59,0x28,0xdf,0xff,0xc7,0x10,
+0xa0,0x01,0x20,0x8f,0xff,0x07,0x08,0x41,0x00,0x00,0xdf,0xff,0x20,0x02,0xf2,0x01,
+0x00,0xdf,0x31,0x11,0x11,0x44,0xef,0xa0,0x00,0xdf,0x20,0x00,0x00,0xf6,0x3f,0xfa,
+0x08,0x00,0x30,0x04,0xff,0x90,0x08,0x00,0x40,0xfa,0x66,0x9f,0xf2,0x08,0x00,0x61,
+0xff,0xff,0x8c,0xf3,0xdf,0x20,0x45,0x09,0x0f,0x08,0x00,0x3f,0x10,0xee,0x01,0x00,
+0x23,0xef,0xf3,0x62,0x02,0x17,0xe1,0xab,0x00,0x34,0x05,0x76,0x30,0x0a,0x00,0x33,
 0xef,0xef,0xfd,0x99,0x01,0x52,0x6f,0x91,0x00,0x3c,0xf2,0xa1,0x01,0x00,0x0a,0x04,
-0x30,0xcd,0xce,0xb4,0xc1,0x01,0x10,0xe0,0x7a,0x07,0x20,0xa8,0xdf,0xa6,0x17,0x11,
-0xa0,0xbc,0x01,0x10,0x08,0xec,0x03,0x03,0x88,0x07,0x41,0xda,0x00,0x00,0x3f,0x8c,
-0x0a,0x41,0x45,0x00,0x7e,0x00,0xd3,0x2a,0xf0,0x13,0x48,0xcf,0xfe,0x00,0x6f,0x00,
-0x07,0xf2,0x00,0x48,0xcf,0xff,0xff,0xd9,0x00,0x8e,0x00,0x0d,0xa0,0x0e,0xff,0xff,
-0xd9,0x51,0x00,0x00,0xdb,0x00,0x1f,0x40,0x0a,0xc8,0x41,0x75,0x51,0x01,0x20,0x30,
-0x2f,0xed,0x0b,0x00,0x5c,0x1e,0x70,0x0d,0xb0,0x2f,0x30,0x00,0x00,0x0b,0x38,0x01,
-0x21,0x06,0xf1,0xc0,0x05,0x10,0xff,0x53,0x16,0x80,0xf2,0x0b,0xb0,0x00,0x01,0xef,
-0xff,0xfd,0x0b,0x00,0xe3,0x04,0xf4,0x00,0x01,0x44,0x44,0x44,0x10,0x00,0x06,0xf0,
-0x00,0xaf,0x30,0x39,0x0a,0x41,0xa0,0x00,0x1b,0xf9,0xb8,0x00,0x32,0x13,0xce,0x10,
-0xdf,0x07,0x12,0xff,0x6d,0x26,0x20,0x00,0x35,0xfb,0x06,0x14,0x52,0xea,0x00,0x15,
-0x4c,0x8b,0x02,0x26,0x6f,0xf2,0x0a,0x00,0x24,0x04,0x95,0x0a,0x00,0x24,0x0a,0xf7,
-0x0a,0x00,0x21,0x0f,0xf2,0x99,0x29,0x50,0x09,0xff,0xfe,0x56,0xb0,0xac,0x21,0xe0,
-0x91,0x8f,0xfb,0xdf,0xf2,0x10,0x00,0x0c,0xff,0xdf,0xf1,0xff,0x40,0x0a,0xb3,0x0d,
-0x41,0xd2,0x01,0x82,0xff,0x6c,0x15,0x20,0xdf,0x30,0x2e,0x0d,0x50,0x09,0xf9,0x00,
-0x03,0xfc,0x5b,0x02,0x60,0xfa,0xcf,0xf3,0x00,0x08,0xf7,0x03,0x03,0x00,0x8a,0x11,
-0x01,0x56,0x28,0x01,0x24,0x17,0x24,0x0e,0xf0,0x78,0x00,0x15,0x1f,0x43,0x16,0x24,
+0x30,0xcd,0xce,0xb4,0xc1,0x01,0x10,0xe0,0x7a,0x07,0x71,0xa8,0xdf,0x60,0x00,0x00,
+0x0c,0xa0,0xbc,0x01,0x10,0x08,0xec,0x03,0x03,0x88,0x07,0x41,0xda,0x00,0x00,0x3f,
+0x8c,0x0a,0xf0,0x1c,0x45,0x00,0x7e,0x00,0x00,0xec,0x00,0x00,0x00,0x48,0xcf,0xfe,
+0x00,0x6f,0x00,0x07,0xf2,0x00,0x48,0xcf,0xff,0xff,0xd9,0x00,0x8e,0x00,0x0d,0xa0,
+0x0e,0xff,0xff,0xd9,0x51,0x00,0x00,0xdb,0x00,0x1f,0x40,0x0a,0xc8,0x41,0x75,0x51,
+0x01,0xf0,0x02,0x30,0x2f,0x20,0x00,0x00,0x02,0xfe,0x10,0x00,0x00,0x0d,0xb0,0x2f,
+0x30,0x00,0x00,0x0b,0x38,0x01,0x21,0x06,0xf1,0xc0,0x05,0x00,0xb0,0x03,0x90,0x03,
+0xf2,0x0b,0xb0,0x00,0x01,0xef,0xff,0xfd,0x0b,0x00,0xe3,0x04,0xf4,0x00,0x01,0x44,
+0x44,0x44,0x10,0x00,0x06,0xf0,0x00,0xaf,0x30,0x39,0x0a,0x41,0xa0,0x00,0x1b,0xf9,
+0xb8,0x00,0x31,0x13,0xce,0x10,0xdf,0x07,0x00,0x01,0x00,0x10,0xb2,0x11,0x00,0x10,
+0x35,0xfb,0x06,0x14,0x52,0xea,0x00,0x15,0x4c,0x8b,0x02,0x26,0x6f,0xf2,0x0a,0x00,
+0x24,0x04,0x95,0x0a,0x00,0x24,0x0a,0xf7,0x0a,0x00,0x10,0x0f,0x20,0x00,0xf1,0x16,
+0x10,0x00,0x09,0xff,0xfe,0x56,0xb0,0x00,0x00,0x9f,0xff,0x91,0x8f,0xfb,0xdf,0xf2,
+0x10,0x00,0x0c,0xff,0xdf,0xf1,0xff,0x40,0x0a,0xf9,0x00,0x00,0x6f,0xd2,0x01,0x82,
+0xff,0x00,0x05,0xfb,0x00,0xaf,0x07,0x70,0xff,0x30,0x09,0xf9,0x00,0x03,0xfc,0x5b,
+0x02,0x70,0xfa,0xcf,0xf3,0x00,0x08,0xf7,0x00,0xae,0x04,0x51,0xff,0x60,0x00,0x0b,
+0xf2,0x5b,0x04,0x11,0xf2,0x5b,0x04,0x03,0x78,0x00,0x24,0x1f,0xc0,0x0a,0x00,0x24,
 0x3f,0xa0,0x0a,0x00,0x24,0x5f,0x80,0x0a,0x00,0x24,0x7f,0x60,0x0a,0x00,0x24,0x8f,
 0x50,0x0a,0x00,0x2a,0x9f,0x40,0xb4,0x00,0x01,0xf4,0x09,0xf3,0x05,0xcf,0xc2,0x01,
 0xed,0x8d,0xe1,0x5f,0x20,0x1f,0x56,0xf1,0x01,0xf5,0x1e,0xd8,0xde,0x10,0x3c,0xfc,
-0x30,0x13,0x04,0x15,0x70,0x87,0x03,0x40,0xd0,0x00,0x00,0x07,0x33,0x22,0xd2,0x10,
-0x0a,0xe0,0x00,0x00,0x02,0x77,0x66,0x66,0xbf,0x20,0x09,0xe0,0x1c,0x00,0x24,0xbe,
-0x00,0x0a,0x00,0x42,0xfa,0x00,0x09,0xf0,0x00,0x02,0x14,0xf4,0x0a,0x00,0x24,0x0c,
-0xd0,0x0a,0x00,0x42,0x4f,0x60,0x00,0x08,0x0a,0x00,0x10,0xdd,0x11,0x06,0x00,0xef,
-0x1d,0x82,0x07,0xf4,0x00,0x00,0x08,0xf7,0x77,0x50,0x60,0x29,0x01,0x15,0x02,0x24,
-0x01,0xed,0x1f,0x02,0x24,0x0c,0xe2,0x0a,0x00,0x22,0xbf,0x30,0x0a,0x00,0x00,0xfa,
-0x15,0x03,0x0a,0x00,0x11,0x0a,0xa6,0x01,0x03,0x50,0x00,0x0f,0x0a,0x00,0x18,0x25,
-0x05,0xc0,0xf8,0x00,0x05,0x67,0x03,0x90,0xad,0x00,0x00,0x03,0xbc,0xcd,0xdd,0xe9,
-0x00,0xdb,0x00,0x72,0x28,0x88,0x77,0x7d,0xe0,0x00,0xae,0x1a,0x00,0x14,0xeb,0xda,
-0x00,0x42,0x3f,0x70,0x00,0x9e,0x10,0x05,0x13,0xf1,0x13,0x00,0x33,0x02,0xf9,0x00,
-0x13,0x00,0x72,0xde,0x10,0x00,0x08,0xfe,0xee,0xa0,0xa7,0x00,0x30,0x8f,0x99,0x96,
-0x7d,0x09,0x11,0x00,0xf5,0x00,0x21,0x02,0xdf,0xfa,0x24,0x00,0x49,0x0f,0x22,0x20,
-0x00,0x13,0x00,0x02,0x22,0x02,0x15,0x9e,0x57,0x01,0x01,0xe9,0x00,0x12,0x50,0x85,
-0x00,0x30,0x00,0x00,0xf9,0xb2,0x0e,0x10,0x80,0x37,0x08,0x14,0x80,0x22,0x00,0x05,
-0x68,0x24,0x24,0x1f,0x80,0xe8,0x04,0x60,0xfc,0x65,0x55,0x55,0x56,0x60,0x5a,0x0c,
-0x02,0x0c,0x06,0x00,0x14,0x00,0x36,0x11,0x11,0x11,0xd2,0x01,0x20,0x04,0x20,0x39,
-0x08,0x21,0x23,0x33,0x51,0x00,0x11,0x09,0x10,0x26,0xb4,0x0f,0x90,0x00,0x00,0x13,
-0x33,0x32,0x3f,0x80,0x00,0xf9,0xa1,0x01,0x24,0x0f,0x90,0x8d,0x01,0x21,0xfb,0x33,
-0xfe,0x17,0x31,0x50,0x00,0x0e,0xfe,0x06,0xa0,0x4f,0xa0,0x00,0x00,0xeb,0x44,0x30,
-0x00,0x00,0x4f,0x27,0x28,0x14,0x90,0xe3,0x29,0x10,0xe9,0x2b,0x02,0x21,0x70,0x00,
+0x30,0x13,0x04,0x15,0x70,0x87,0x03,0xf2,0x06,0xd0,0x00,0x00,0x07,0xee,0xee,0xff,
+0xfe,0x10,0x0a,0xe0,0x00,0x00,0x02,0x77,0x66,0x66,0xbf,0x20,0x09,0xe0,0x1c,0x00,
+0x24,0xbe,0x00,0x0a,0x00,0x42,0xfa,0x00,0x09,0xf0,0x00,0x02,0x14,0xf4,0x0a,0x00,
+0x24,0x0c,0xd0,0x0a,0x00,0x42,0x4f,0x60,0x00,0x08,0x0a,0x00,0x10,0xdd,0x11,0x06,
+0xf3,0x01,0xff,0xe0,0x00,0x00,0x07,0xf4,0x00,0x00,0x08,0xf7,0x77,0x50,0x00,0x00,
+0x3f,0x90,0x15,0x02,0x24,0x01,0xed,0x1f,0x02,0x24,0x0c,0xe2,0x0a,0x00,0x23,0xbf,
+0x30,0x0a,0x00,0x33,0x0b,0xf3,0x00,0x0a,0x00,0x11,0x0a,0xa6,0x01,0x03,0x50,0x00,
+0x0f,0x0a,0x00,0x18,0x25,0x05,0xc0,0xf8,0x00,0x05,0x67,0x03,0x90,0xad,0x00,0x00,
+0x03,0xbc,0xcd,0xdd,0xe9,0x00,0xdb,0x00,0x72,0x28,0x88,0x77,0x7d,0xe0,0x00,0xae,
+0x1a,0x00,0x14,0xeb,0xda,0x00,0x42,0x3f,0x70,0x00,0x9e,0x10,0x05,0x13,0xf1,0x13,
+0x00,0x33,0x02,0xf9,0x00,0x13,0x00,0x72,0xde,0x10,0x00,0x08,0xfe,0xee,0xa0,0xa7,
+0x00,0x30,0x8f,0x99,0x96,0x7d,0x09,0x11,0x00,0xf5,0x00,0x30,0x02,0xdf,0x40,0xc9,
+0x01,0x30,0x00,0x00,0x07,0xc8,0x09,0x01,0x13,0x00,0x02,0x22,0x02,0x15,0x9e,0x57,
+0x01,0x01,0xe9,0x00,0x12,0x50,0x85,0x00,0x20,0x00,0x00,0xa0,0x07,0x20,0x06,0x80,
+0x37,0x08,0x14,0x80,0x22,0x00,0x14,0xf8,0x09,0x00,0x24,0x1f,0x80,0xe8,0x04,0x60,
+0xfc,0x65,0x55,0x55,0x56,0x60,0x5a,0x0c,0x02,0x0c,0x06,0x00,0x14,0x00,0x36,0x11,
+0x11,0x11,0xd2,0x01,0x20,0x04,0x20,0x39,0x08,0x21,0x23,0x33,0x51,0x00,0xf4,0x02,
+0x09,0xff,0xff,0xff,0xf9,0x00,0x0f,0x90,0x00,0x00,0x13,0x33,0x32,0x3f,0x80,0x00,
+0xf9,0xa1,0x01,0x24,0x0f,0x90,0x8d,0x01,0x30,0xfb,0x33,0x30,0x5c,0x02,0x31,0x50,
+0x00,0x0e,0xfe,0x06,0xe0,0x4f,0xa0,0x00,0x00,0xeb,0x44,0x30,0x00,0x00,0x4f,0xc0,
+0x00,0x00,0x0e,0x26,0x00,0x10,0x7f,0x5f,0x02,0x10,0xe9,0x2b,0x02,0x21,0x70,0x00,
 0x13,0x00,0x21,0x01,0xfa,0x3e,0x01,0x19,0x95,0xaa,0x04,0x62,0x27,0x88,0x88,0x88,
-0x8a,0xc5,0x48,0x07,0x10,0xff,0x9f,0x2c,0x03,0x01,0x00,0x14,0xe9,0x09,0x00,0x01,
-0x4c,0x00,0x11,0x5e,0xa2,0x06,0x01,0x31,0x29,0x41,0x88,0x88,0x88,0x87,0x5e,0x18,
-0x14,0x10,0x6e,0x06,0x14,0xf1,0x2b,0x00,0x20,0x7f,0xfe,0xdf,0x06,0x00,0x36,0x01,
-0x65,0x67,0x77,0x77,0x76,0x66,0x40,0xc0,0x01,0x21,0x30,0x00,0xe3,0x2b,0x01,0x25,
-0x04,0x11,0x06,0x06,0x0e,0xb4,0x0d,0xa0,0x00,0x00,0x15,0x54,0x44,0x3e,0xb0,0x00,
-0xda,0x67,0x04,0x22,0x0d,0xa0,0x27,0x17,0x13,0x40,0x13,0x00,0x41,0x0c,0xe0,0x00,
-0x0d,0xdb,0x00,0x72,0x06,0xf6,0x00,0x00,0xdd,0x88,0x72,0xf6,0x18,0x01,0x26,0x00,
-0x10,0x06,0xe6,0x0b,0x10,0xda,0xd9,0x26,0x22,0xfc,0x10,0x13,0x00,0x23,0x6f,0xf7,
-0x84,0x04,0x21,0x09,0x70,0x94,0x00,0x19,0x60,0xaf,0x27,0x00,0xfc,0x04,0x01,0x4f,
-0x10,0x51,0x8f,0x98,0x77,0x77,0x77,0x50,0x0b,0x14,0xf1,0xdb,0x00,0x23,0x8f,0x10,
-0xee,0x00,0x0f,0x13,0x00,0x01,0x41,0xf4,0x22,0x22,0x23,0x46,0x2c,0x13,0x4f,0x16,
-0x0c,0x01,0x43,0x07,0x26,0x22,0x10,0x88,0x03,0x01,0xbd,0x00,0x40,0x12,0x00,0x00,
-0x7f,0xef,0x0a,0x00,0x28,0x0a,0x71,0x7f,0x10,0x00,0x05,0x54,0x44,0x3b,0x09,0x00,
-0x02,0x4b,0x03,0x02,0x09,0x00,0x23,0x0f,0xa0,0x09,0x00,0x60,0x7f,0x40,0x00,0x7f,
-0x88,0x85,0x13,0x02,0x00,0x86,0x07,0x40,0xea,0x00,0x00,0x0c,0x5c,0x11,0x13,0x00,
-0xb9,0x0a,0x00,0x09,0x00,0x31,0x6e,0xe4,0x00,0x09,0x00,0x32,0x3d,0xfa,0x10,0x09,
-0x00,0x11,0x69,0x39,0x03,0x21,0x3a,0x00,0xa9,0x26,0x11,0x30,0xfe,0x07,0x61,0x8e,
-0x00,0x05,0xf0,0x00,0xf5,0x09,0x00,0x34,0x06,0xf0,0x02,0x09,0x00,0x22,0x04,0xf4,
-0x7d,0x06,0x11,0xf0,0xdb,0x0e,0x70,0x8f,0x77,0x7a,0xf0,0x0e,0xff,0x10,0x1b,0x00,
-0x51,0x07,0xf0,0x7f,0x4e,0xa0,0x09,0x00,0x41,0xf1,0xfa,0x06,0xf4,0x24,0x00,0xd3,
-0xd9,0xd0,0x00,0xbd,0x00,0x00,0x04,0x55,0x54,0x11,0x10,0x00,0x04,0xcf,0x00,0x21,
-0x14,0x00,0xaa,0x01,0x41,0x00,0x00,0x8f,0x00,0xde,0x0a,0x10,0xd0,0x09,0x00,0x72,
-0x06,0x65,0x55,0x4d,0xe0,0x00,0x8f,0x0e,0x02,0x34,0xb0,0x00,0x8f,0x5d,0x03,0x22,
-0x8f,0x00,0xb8,0x2f,0x80,0x00,0x8f,0x54,0x42,0x00,0x00,0x03,0xf8,0x56,0x00,0x40,
-0xfe,0x00,0x00,0x1e,0x81,0x15,0x40,0x32,0x21,0x00,0x01,0x7d,0x06,0x10,0x7f,0x8a,
-0x0e,0x21,0xe3,0x00,0x09,0x00,0x11,0x06,0x5e,0x06,0x10,0x7f,0xac,0x2b,0x12,0x00,
-0x09,0x00,0x11,0x42,0x42,0x00,0x11,0x15,0xa4,0x01,0x32,0xbe,0xfd,0xc7,0x50,0x00,
-0x40,0xc7,0x67,0xbf,0xe2,0x90,0x02,0x20,0xf7,0x00,0x59,0x1a,0x01,0x42,0x01,0x02,
-0x93,0x01,0x20,0x0e,0xa0,0x1f,0x02,0x44,0x30,0x00,0x00,0x0d,0x12,0x00,0x10,0x07,
-0x65,0x11,0x11,0xfc,0xe3,0x0e,0x41,0xd9,0x78,0xcf,0xd2,0x48,0x00,0x3f,0xad,0xdc,
-0xa6,0x54,0x03,0x03,0x11,0x07,0x79,0x02,0x03,0x54,0x03,0x23,0x2f,0xa0,0x54,0x03,
-0x24,0x04,0xf6,0x54,0x03,0x12,0xbf,0xcb,0x03,0x01,0x8e,0x05,0x11,0x0e,0x48,0x17,
-0x50,0x2f,0xd0,0x00,0x00,0xec,0x79,0x02,0x23,0x1d,0xf2,0x1a,0x02,0x23,0x2d,0xf3,
-0x1a,0x02,0x23,0x6f,0xd2,0x2d,0x02,0x11,0xcf,0x3d,0x00,0x54,0xd9,0x00,0x00,0x06,
-0x20,0x72,0x00,0x71,0x00,0x02,0x33,0x33,0x33,0x44,0x42,0x7d,0x0e,0x00,0x01,0x00,
-0x10,0xe0,0x30,0x00,0x60,0x43,0x33,0x33,0x33,0x20,0x00,0xda,0x06,0x05,0x7b,0x06,
-0x51,0x87,0x88,0x88,0x88,0x84,0x7a,0x03,0x00,0xa4,0x1c,0x01,0x0d,0x13,0x05,0x7b,
-0x2a,0x15,0xf0,0x54,0x03,0x04,0x2f,0x04,0x66,0x01,0x67,0x78,0x88,0x77,0x76,0xd8,
-0x02,0x03,0xe8,0x08,0xf0,0x05,0xc7,0x00,0x8e,0x05,0x99,0xaa,0xbc,0x70,0x0e,0x80,
-0x08,0xe0,0x6b,0xcb,0xba,0xfb,0x00,0xe7,0x00,0x8e,0x6e,0x02,0x30,0x90,0x0e,0x70,
-0x73,0x05,0x41,0x03,0xf6,0x00,0xf7,0x11,0x00,0x41,0x7f,0x20,0x0f,0x70,0x8e,0x05,
-0x11,0xe0,0x11,0x00,0x00,0x47,0x32,0x41,0x0f,0xa5,0x5b,0xe0,0x8f,0x02,0x31,0xff,
-0xff,0xfe,0x55,0x01,0x01,0x33,0x00,0x00,0x3a,0x31,0x01,0x44,0x00,0x22,0xdd,0x00,
-0x11,0x00,0x22,0x8f,0x30,0x11,0x00,0x22,0x3f,0x90,0x11,0x00,0x10,0x1e,0x8e,0x05,
-0x40,0xe8,0x00,0x8e,0x0c,0xd3,0x13,0x00,0x77,0x00,0x01,0x70,0x10,0x11,0xe8,0x66,
-0x00,0x02,0x11,0x00,0x1b,0x00,0x11,0x00,0x02,0xcd,0x00,0x3c,0x94,0x00,0x7e,0xc6,
-0x05,0x11,0x01,0x6d,0x02,0x50,0x06,0xb0,0x04,0xf1,0x4f,0xd2,0x13,0xb0,0x9e,0x00,
-0x5f,0x21,0x55,0x54,0x4a,0xf1,0x08,0xe0,0x05,0xed,0x06,0xe1,0xce,0x00,0x8f,0x00,
-0x4f,0x20,0x00,0x00,0x2f,0x90,0x08,0xf0,0x04,0xf2,0x8c,0x2f,0x20,0x8f,0xee,0xef,
-0x11,0xc0,0xfa,0x00,0x08,0xf7,0x79,0xf2,0x00,0x01,0xde,0x10,0x00,0x8e,0x22,0x00,
-0xb0,0xcf,0x30,0x00,0x08,0xe0,0x04,0xf2,0x01,0xbf,0x40,0x00,0x11,0x00,0x10,0x22,
-0xc2,0x05,0x00,0x44,0x00,0x10,0xbb,0x71,0x01,0x43,0x8c,0x00,0x5f,0x10,0xc1,0x10,
-0x01,0xab,0x01,0x32,0x57,0x76,0x40,0x37,0x0c,0x30,0xfe,0xff,0xe6,0x08,0x00,0x40,
-0xfb,0x30,0x00,0x3c,0x3f,0x03,0x10,0xfc,0x9c,0x05,0x00,0x6b,0x16,0x12,0x70,0xec,
-0x05,0x00,0xf9,0x08,0x00,0x2e,0x01,0x00,0x92,0x31,0x02,0x3a,0x2a,0x51,0x2e,0xfb,
-0x87,0x9d,0xfb,0x3c,0x00,0x3a,0xbd,0xdc,0x94,0x87,0x01,0x00,0xb2,0x01,0xd2,0x2a,
-0xbb,0xbb,0xcc,0xc3,0x00,0x08,0xf0,0x2a,0xaa,0x99,0x9b,0xf6,0xbe,0x06,0x22,0x06,
-0xf3,0x08,0x00,0x22,0x0a,0xf0,0x08,0x00,0x22,0x0f,0x90,0x08,0x00,0x22,0x6f,0x30,
-0x08,0x00,0x12,0xec,0xe6,0x06,0x31,0x07,0xf4,0x0e,0x6a,0x10,0xa1,0x2f,0xa0,0x07,
-0x88,0x8c,0xf0,0x00,0x00,0xce,0x10,0x18,0x00,0x22,0x08,0xf4,0x06,0x07,0x21,0x5f,
-0x80,0x60,0x00,0x21,0x05,0xf9,0x68,0x00,0x32,0xe0,0x5f,0xa0,0x08,0x00,0x22,0xb8,
-0x00,0x08,0x00,0x1f,0x00,0x08,0x00,0x12,0x23,0x05,0xb0,0xb0,0x00,0xa0,0x40,0x00,
-0x11,0x22,0x33,0x20,0x00,0x08,0xf0,0x1f,0x99,0x13,0x82,0x00,0x08,0xf0,0x03,0x33,
-0x32,0x29,0xf1,0x72,0x02,0x22,0x0b,0xe0,0x08,0x00,0x22,0x0f,0xa0,0x08,0x00,0x21,
-0x6f,0x40,0x08,0x00,0x31,0x01,0xec,0x07,0x02,0x0f,0x70,0x0a,0xf3,0x03,0x77,0x7b,
-0xf0,0x00,0xaa,0x32,0x00,0x18,0x00,0x21,0x1b,0xf7,0x98,0x00,0x31,0x03,0xef,0x60,
-0x08,0x00,0x22,0x4f,0xc2,0x08,0x01,0x19,0x25,0xc2,0x02,0x00,0x08,0x00,0x13,0xd6,
-0x08,0x00,0x01,0xa6,0x25,0x14,0x50,0x67,0x03,0x05,0x27,0x07,0x14,0x01,0x08,0x00,
-0x63,0xfb,0x55,0x55,0x56,0x67,0x71,0x36,0x0b,0x1b,0xe3,0x0e,0x2d,0x10,0x42,0x2c,
-0x02,0x52,0x10,0x00,0x00,0xf8,0x07,0x2c,0x2d,0x62,0xf9,0x02,0x55,0x54,0x44,0xfa,
-0x4d,0x00,0x22,0x03,0xf7,0x08,0x00,0x22,0x08,0xf2,0x08,0x00,0x31,0x1e,0xc0,0xef,
-0xc6,0x21,0x30,0x9f,0x40,0x57,0xee,0x05,0x22,0x06,0xf9,0xa7,0x07,0x21,0x7f,0xb0,
-0x75,0x00,0x02,0x7a,0x25,0x22,0xf8,0x04,0x1d,0x28,0x22,0xf8,0x0e,0xce,0x13,0x16,
-0xe7,0x6b,0x00,0x63,0x17,0x77,0x77,0x77,0x78,0x82,0x7c,0x03,0x16,0xf9,0x10,0x06,
-0x0f,0x08,0x00,0x06,0x52,0x42,0x22,0x22,0x33,0xf9,0x3c,0x12,0x00,0x8a,0x11,0x11,
-0x01,0x39,0x11,0x08,0x22,0x06,0xf0,0x0e,0x00,0x01,0xe2,0x05,0xf1,0x39,0x9a,0xab,
+0x8a,0xc5,0x48,0x07,0x44,0xff,0xfe,0xef,0x90,0x18,0x00,0x14,0xe9,0x09,0x00,0x01,
+0x4c,0x00,0x11,0x5e,0xa2,0x06,0x00,0x0f,0x01,0x60,0xf9,0x88,0x88,0x88,0x87,0x10,
+0x22,0x01,0x14,0x10,0x6e,0x06,0x14,0xf1,0x2b,0x00,0x20,0x7f,0xfe,0xdf,0x06,0x00,
+0x36,0x01,0x80,0x67,0x77,0x77,0x76,0x66,0x40,0x00,0x00,0x11,0x00,0x01,0x00,0x20,
+0x05,0x30,0x06,0x00,0xf1,0x09,0x11,0x11,0x00,0x00,0xda,0x00,0x00,0x06,0xff,0xff,
+0xff,0xfa,0x00,0x0d,0xa0,0x00,0x00,0x15,0x54,0x44,0x3e,0xb0,0x00,0xda,0x23,0x00,
+0x20,0x01,0xf8,0x13,0x00,0x00,0x01,0x00,0x23,0x5f,0x40,0x13,0x00,0xf2,0x06,0x0c,
+0xe0,0x00,0x0d,0xff,0xff,0x70,0x00,0x00,0x06,0xf6,0x00,0x00,0xdd,0x88,0x72,0x00,
+0x00,0x04,0xfc,0x00,0x26,0x00,0x41,0x06,0xfd,0x10,0x00,0x26,0x00,0x32,0x19,0xfc,
+0x10,0x13,0x00,0x41,0x6f,0xf7,0x00,0x00,0x13,0x00,0x20,0x09,0x70,0x09,0x00,0x37,
+0x09,0x60,0x00,0x01,0x00,0x60,0x05,0xee,0xee,0xee,0xef,0xff,0x13,0x00,0xf0,0x01,
+0x8f,0x98,0x77,0x77,0x77,0xf9,0x00,0x00,0x00,0x08,0xf1,0x00,0x00,0x00,0x0e,0x90,
+0x13,0x00,0x5f,0x10,0x00,0x00,0x00,0xe9,0x13,0x00,0x04,0x50,0xf4,0x22,0x22,0x23,
+0x3f,0x13,0x00,0x60,0x4f,0xff,0xff,0xff,0xff,0xf6,0x4d,0x00,0x55,0x12,0x22,0x22,
+0x22,0x10,0x5b,0x00,0x11,0x03,0xbd,0x00,0xf1,0x04,0x12,0x00,0x00,0x7f,0x00,0x00,
+0x2f,0xff,0xff,0xff,0xf0,0x00,0x7f,0x10,0x00,0x05,0x54,0x44,0x3b,0x09,0x00,0x00,
+0xc6,0x00,0x13,0xd0,0x09,0x00,0x23,0x0f,0xa0,0x09,0x00,0xf2,0x0d,0x7f,0x40,0x00,
+0x7f,0x88,0x85,0x00,0x00,0x01,0xfc,0x00,0x00,0x7f,0xff,0xea,0x00,0x00,0x0c,0xf2,
+0x00,0x00,0x6f,0x00,0x00,0x00,0x02,0xdf,0x50,0x09,0x00,0x31,0x6e,0xe4,0x00,0x09,
+0x00,0x32,0x3d,0xfa,0x10,0x09,0x00,0x20,0x69,0x20,0x39,0x00,0x10,0x3a,0x24,0x00,
+0xe1,0x00,0x00,0x30,0x00,0x40,0x00,0x00,0x00,0x8e,0x00,0x05,0xf0,0x00,0xf5,0x09,
+0x00,0x34,0x06,0xf0,0x02,0x09,0x00,0x20,0x04,0xf4,0xbf,0x00,0x50,0xff,0xff,0xf0,
+0x09,0xf9,0x09,0x00,0x60,0x77,0x7a,0xf0,0x0e,0xff,0x10,0x1b,0x00,0x51,0x07,0xf0,
+0x7f,0x4e,0xa0,0x09,0x00,0x41,0xf1,0xfa,0x06,0xf4,0x24,0x00,0xd3,0xd9,0xd0,0x00,
+0xbd,0x00,0x00,0x04,0x55,0x54,0x11,0x10,0x00,0x04,0xcf,0x00,0x21,0x14,0x00,0xaa,
+0x01,0xa0,0x00,0x00,0x8f,0x00,0x00,0x3e,0xff,0xff,0xff,0xd0,0x09,0x00,0x50,0x06,
+0x65,0x55,0x4d,0xe0,0x09,0x00,0x00,0x20,0x01,0x13,0xb0,0x09,0x00,0x23,0x3f,0x70,
+0x09,0x00,0xa0,0xaf,0x10,0x00,0x8f,0x54,0x42,0x00,0x00,0x03,0xf8,0x56,0x00,0xe1,
+0xfe,0x00,0x00,0x1e,0xd0,0x00,0x00,0x8f,0x32,0x21,0x00,0x01,0xdf,0x20,0x17,0x01,
+0x30,0x00,0x2d,0xe3,0xf6,0x00,0x00,0xb6,0x01,0x12,0x20,0x09,0x00,0x32,0xaf,0x70,
+0x00,0x09,0x00,0x11,0x42,0x42,0x00,0x11,0x15,0xa4,0x01,0x32,0xbe,0xfd,0xc7,0x50,
+0x00,0xd2,0xc7,0x67,0xbf,0xe2,0x00,0x00,0x00,0x07,0xf7,0x00,0x00,0x03,0xfb,0x42,
+0x01,0x02,0x93,0x01,0x20,0x0e,0xa0,0x1f,0x02,0x44,0x30,0x00,0x00,0x0d,0x12,0x00,
+0x60,0x07,0xf8,0x00,0x00,0x03,0xfc,0x36,0x00,0x51,0xbf,0xd9,0x78,0xcf,0xd2,0x48,
+0x00,0x35,0xad,0xdc,0xa6,0x9e,0x01,0x20,0x04,0x20,0x9d,0x01,0x81,0x23,0x33,0x00,
+0x00,0xf9,0x00,0x00,0x07,0x79,0x02,0xb2,0x0f,0x90,0x00,0x00,0x13,0x33,0x32,0x2f,
+0xa0,0x00,0xf9,0x23,0x00,0x11,0xf6,0x13,0x00,0x00,0x43,0x00,0x13,0x00,0x13,0x00,
+0x50,0x5f,0x80,0x00,0x0e,0xff,0x2f,0x02,0x50,0x2f,0xd0,0x00,0x00,0xec,0x79,0x02,
+0x23,0x1d,0xf2,0x1a,0x02,0x23,0x2d,0xf3,0x1a,0x02,0x23,0x6f,0xd2,0x2d,0x02,0x11,
+0xcf,0x3d,0x00,0x54,0xd9,0x00,0x00,0x06,0x20,0x72,0x00,0x70,0x00,0x02,0x33,0x33,
+0x33,0x44,0x42,0x8d,0x00,0x10,0xff,0x01,0x00,0x10,0xe0,0x30,0x00,0x50,0x43,0x33,
+0x33,0x33,0x20,0xbb,0x02,0x14,0xf1,0x9d,0x00,0x70,0x6f,0x87,0x88,0x88,0x88,0x84,
+0x00,0x99,0x00,0x52,0xee,0xee,0xee,0xff,0xa0,0x13,0x01,0x02,0x01,0x00,0x24,0x07,
+0xf0,0x0a,0x00,0x11,0x7f,0x43,0x00,0x96,0x40,0x00,0x00,0x01,0x67,0x78,0x88,0x77,
+0x76,0xd8,0x02,0x21,0x01,0x30,0x07,0x00,0xf0,0x05,0xc7,0x00,0x8e,0x05,0x99,0xaa,
+0xbc,0x70,0x0e,0x80,0x08,0xe0,0x6b,0xcb,0xba,0xfb,0x00,0xe7,0x00,0x8e,0x6e,0x02,
+0xb1,0x90,0x0e,0x70,0x08,0xe0,0x00,0x00,0x03,0xf6,0x00,0xf7,0x11,0x00,0x31,0x7f,
+0x20,0x0f,0x11,0x00,0x22,0x0b,0xe0,0x11,0x00,0x71,0x01,0xf9,0x00,0x0f,0xa5,0x5b,
+0xe0,0x8f,0x02,0x31,0xff,0xff,0xfe,0x55,0x01,0x01,0x33,0x00,0x32,0x05,0xf5,0x00,
+0x44,0x00,0x22,0xdd,0x00,0x11,0x00,0x22,0x8f,0x30,0x11,0x00,0x22,0x3f,0x90,0x11,
+0x00,0xd0,0x1e,0xc0,0x00,0x00,0x00,0xe8,0x00,0x8e,0x0c,0xe1,0x00,0x00,0x00,0x77,
+0x00,0x22,0x92,0x00,0x11,0x00,0x23,0x00,0x00,0x11,0x00,0x1b,0x00,0x11,0x00,0x02,
+0xcd,0x00,0x34,0x94,0x00,0x7e,0xbc,0x00,0x14,0x10,0xc4,0x00,0x01,0x6d,0x02,0x40,
+0x06,0xb0,0x04,0xf1,0x60,0x03,0xf0,0x26,0x10,0x9e,0x00,0x5f,0x21,0x55,0x54,0x4a,
+0xf1,0x08,0xe0,0x05,0xf2,0x00,0x00,0x00,0xce,0x00,0x8f,0x00,0x4f,0x20,0x00,0x00,
+0x2f,0x90,0x08,0xf0,0x04,0xf2,0x00,0x00,0x0a,0xf3,0x00,0x8f,0xee,0xff,0x20,0x00,
+0x04,0xfa,0x00,0x08,0xf7,0x79,0xf2,0x00,0x01,0xde,0x10,0x00,0x8e,0x22,0x00,0xb0,
+0xcf,0x30,0x00,0x08,0xe0,0x04,0xf2,0x01,0xbf,0x40,0x00,0x11,0x00,0x50,0x22,0xdf,
+0x40,0x00,0x00,0x44,0x00,0x10,0xbb,0x71,0x01,0x33,0x8c,0x00,0x5f,0x6f,0x00,0x11,
+0x02,0xab,0x01,0x41,0x57,0x76,0x40,0x00,0x75,0x01,0x30,0xfe,0xff,0xe6,0x08,0x00,
+0x40,0xfb,0x30,0x00,0x3c,0x3f,0x03,0x00,0x47,0x02,0x50,0x0d,0xc0,0x00,0x00,0x2f,
+0x9d,0x02,0x11,0x9e,0x92,0x04,0x01,0x2e,0x01,0x60,0x00,0x0c,0xf3,0x00,0x00,0x06,
+0x0d,0x00,0x51,0x2e,0xfb,0x87,0x9d,0xfb,0x3c,0x00,0x3a,0xbd,0xdc,0x94,0x87,0x01,
+0x00,0xb2,0x01,0xe1,0x2a,0xbb,0xbb,0xcc,0xc3,0x00,0x08,0xf0,0x2a,0xaa,0x99,0x9b,
+0xf6,0x00,0xf5,0x00,0x22,0x06,0xf3,0x08,0x00,0x22,0x0a,0xf0,0x08,0x00,0x22,0x0f,
+0x90,0x08,0x00,0x22,0x6f,0x30,0x08,0x00,0x21,0xec,0x00,0x08,0x00,0xf1,0x03,0x07,
+0xf4,0x0e,0xee,0xef,0xf0,0x00,0x00,0x2f,0xa0,0x07,0x88,0x8c,0xf0,0x00,0x00,0xce,
+0x10,0x18,0x00,0x31,0x08,0xf4,0x00,0x08,0x00,0x21,0x5f,0x80,0x60,0x00,0x21,0x05,
+0xf9,0x68,0x00,0x32,0xe0,0x5f,0xa0,0x08,0x00,0x22,0xb8,0x00,0x08,0x00,0x1f,0x00,
+0x08,0x00,0x12,0x23,0x05,0xb0,0xb0,0x00,0xf2,0x07,0x40,0x00,0x11,0x22,0x33,0x20,
+0x00,0x08,0xf0,0x1f,0xff,0xff,0xff,0xf1,0x00,0x08,0xf0,0x03,0x33,0x32,0x29,0xf1,
+0x72,0x02,0x22,0x0b,0xe0,0x08,0x00,0x22,0x0f,0xa0,0x08,0x00,0x21,0x6f,0x40,0x08,
+0x00,0x60,0x01,0xec,0x07,0xff,0xff,0xf0,0x81,0x01,0x81,0x03,0x77,0x7b,0xf0,0x00,
+0x00,0x9f,0x60,0xa2,0x02,0x21,0x1b,0xf7,0x98,0x00,0x31,0x03,0xef,0x60,0x08,0x00,
+0x22,0x4f,0xc2,0x08,0x01,0x19,0x25,0xc2,0x02,0x00,0x08,0x00,0x13,0xd6,0x08,0x00,
+0x10,0xf9,0x85,0x01,0x14,0x50,0x67,0x03,0x33,0x00,0x00,0xf8,0x93,0x00,0x04,0x08,
+0x00,0x90,0xfb,0x55,0x55,0x56,0x67,0x71,0x00,0x00,0xdf,0xf3,0x02,0x2a,0xe3,0x00,
+0x01,0x00,0x10,0x42,0x2c,0x02,0x40,0x10,0x00,0x00,0xf8,0xc8,0x03,0x92,0xf9,0x00,
+0x00,0xf9,0x02,0x55,0x54,0x44,0xfa,0x4d,0x00,0x22,0x03,0xf7,0x08,0x00,0x22,0x08,
+0xf2,0x08,0x00,0x40,0x1e,0xc0,0xef,0xff,0x08,0x00,0x30,0x9f,0x40,0x57,0xee,0x05,
+0x31,0x06,0xf9,0x00,0x18,0x00,0x21,0x7f,0xb0,0x75,0x00,0x21,0x09,0xfa,0x7d,0x00,
+0x31,0x04,0xdf,0x60,0x08,0x00,0x21,0x0e,0xa1,0x60,0x00,0x16,0xe7,0x6b,0x00,0x63,
+0x17,0x77,0x77,0x77,0x78,0x82,0x7c,0x03,0x16,0xf9,0x10,0x06,0x0f,0x08,0x00,0x06,
+0x80,0x42,0x22,0x22,0x33,0xf9,0x00,0x00,0x5f,0x30,0x00,0x89,0xf5,0x00,0x00,0x01,
+0x22,0x22,0x22,0x21,0x22,0x06,0xf0,0x0e,0x00,0x01,0xe2,0x05,0xf1,0x39,0x9a,0xab,
 0xc6,0x00,0x3f,0x30,0x5f,0x14,0xbb,0xbb,0xaf,0xa0,0x03,0xf3,0x05,0xf1,0x00,0x00,
-0x01,0xf7,0x00,0x3f,0x20,0xa0,0x02,0xf0,0x00,0x4f,0x40,0x03,0xf2,0x04,0xf1,0x00,
-0x00,0x07,0xf1,0x00,0x3f,0x20,0x4f,0x10,0xff,0x34,0x02,0x11,0x00,0x40,0x0f,0x92,
-0x44,0x7f,0x11,0x00,0x41,0x06,0xf4,0xcf,0xff,0x11,0x00,0x70,0xbe,0x00,0x11,0x4f,
-0x20,0x4f,0x10,0x81,0x05,0x41,0x03,0xf3,0x04,0xf1,0xa3,0x02,0x71,0x3f,0x30,0x4f,
-0x10,0x05,0xf6,0x00,0x11,0x00,0x32,0x01,0xfb,0x00,0x11,0x00,0x22,0xce,0x10,0x11,
-0x00,0x11,0xaf,0x2b,0x29,0x40,0x30,0x4f,0x28,0x30,0x7f,0x01,0x10,0xf3,0x4a,0x03,
-0x02,0x11,0x00,0x02,0x46,0x12,0x0c,0x11,0x00,0x4c,0x00,0xb1,0x03,0xf1,0x9d,0x0d,
-0x12,0x03,0xb9,0x11,0x41,0x1f,0x40,0x7f,0x00,0xa9,0x03,0xd1,0x2f,0x60,0x7f,0x10,
-0x15,0x55,0x44,0xaf,0x10,0x1f,0x60,0x7f,0x10,0xaa,0x03,0x41,0x1f,0x60,0x6f,0x10,
-0x60,0x09,0x02,0x09,0x00,0x41,0x0a,0xf3,0x66,0x6f,0x09,0x00,0x40,0x4f,0xa2,0xff,
-0xff,0x09,0x00,0x00,0xac,0x03,0x10,0x0f,0x09,0x00,0x00,0x4e,0x03,0x41,0x0f,0x70,
-0x6f,0x10,0xad,0x03,0x00,0x09,0x00,0x20,0x2d,0xf4,0x28,0x09,0x31,0x70,0x6f,0x00,
-0xae,0x03,0x35,0x0e,0x50,0x6f,0x70,0x14,0x01,0x0d,0x0e,0x31,0x00,0x00,0x4d,0x0e,
-0x00,0x11,0xdc,0x94,0x06,0x02,0xc8,0x01,0x22,0xcd,0x00,0xb7,0x32,0x21,0x01,0xfd,
-0xab,0x15,0x31,0xef,0x90,0x09,0x1d,0x12,0x61,0x6f,0x37,0xf5,0x2f,0x86,0xfa,0xb9,
-0x33,0x20,0x9f,0xdd,0x32,0x21,0x50,0x0d,0xb0,0x00,0x0c,0xe1,0x36,0x09,0x56,0x05,
-0x00,0x00,0x03,0x20,0x77,0x04,0x14,0x13,0x87,0x0e,0xe2,0x05,0xab,0xbb,0xbc,0xcc,
-0x20,0x00,0x7e,0x05,0xaa,0xa9,0x99,0xbf,0x60,0xa0,0x04,0x22,0x6f,0x30,0x08,0x00,
-0x50,0xbe,0x28,0x88,0xbe,0x00,0x28,0x05,0x21,0x3e,0xee,0xfd,0x16,0x42,0xf3,0x00,
-0x00,0x7e,0x01,0x07,0x01,0x08,0x00,0x00,0x16,0x05,0x12,0x7e,0x25,0x34,0x00,0x08,
-0x00,0x60,0x1d,0xd0,0x00,0x34,0x44,0x9e,0x4f,0x0a,0x00,0x8d,0x16,0x83,0x00,0x08,
-0xf5,0x00,0x00,0x22,0x22,0x8f,0x08,0x19,0x32,0x7f,0x09,0xf5,0xcc,0x05,0x33,0x1d,
-0x40,0x00,0xfa,0x06,0x0f,0x08,0x00,0x0a,0x04,0x28,0x05,0x16,0x4b,0x63,0x04,0x00,
-0x37,0x13,0x21,0x9e,0x3f,0x4d,0x06,0x62,0x09,0xe0,0x55,0x54,0x44,0xce,0x90,0x0a,
-0x21,0x0e,0xb2,0x5f,0x06,0x52,0x04,0xf6,0x06,0x67,0xce,0x97,0x35,0x21,0x09,0xe0,
-0x4f,0x0c,0x00,0x1e,0x00,0xa0,0x2f,0xc0,0x05,0x66,0x6c,0xe0,0x00,0x3e,0xe1,0x01,
-0xe1,0x05,0x20,0x6f,0xd1,0x89,0x04,0x31,0xe1,0xbf,0x90,0xcc,0x0a,0x11,0xac,0xb7,
-0x04,0x04,0x03,0x0c,0x12,0x47,0xd7,0x08,0x13,0x22,0xb9,0x0e,0x93,0xfc,0x00,0x01,
-0x44,0x33,0x33,0x33,0x3b,0xf0,0xc3,0x0f,0x03,0xe8,0x09,0x0f,0x0f,0x00,0x03,0x13,
-0xae,0x23,0x02,0x15,0x40,0x77,0x11,0x00,0x72,0x07,0x50,0x10,0x00,0x0c,0xc0,0x05,
-0x54,0x12,0x00,0xae,0x01,0x80,0x03,0x33,0x22,0x2e,0xc0,0x44,0x4d,0xd0,0xd5,0x01,
-0x20,0xf7,0x5f,0x14,0x00,0x00,0x3f,0x0a,0x30,0x22,0x1b,0xd0,0x59,0x09,0x20,0x80,
-0x00,0x87,0x08,0x00,0xfd,0x2f,0x30,0x00,0x0b,0xd0,0x89,0x31,0xe2,0x04,0xed,0xdd,
-0xfc,0x00,0x00,0x5f,0xc1,0x00,0x17,0x88,0x7e,0xc0,0x02,0xb0,0x00,0x31,0xcc,0x00,
-0xdc,0xb1,0x00,0x27,0x0b,0x90,0x03,0x0d,0x62,0x78,0x88,0x88,0x88,0xac,0x50,0xb4,
-0x00,0x24,0xee,0xf9,0xaf,0x0a,0x04,0x10,0x19,0x41,0xea,0x00,0x00,0x06,0x6e,0x11,
-0x00,0x7d,0x2a,0x00,0xdd,0x15,0x16,0x71,0xb4,0x00,0x05,0xbd,0x0a,0x10,0x08,0x3c,
-0x12,0xa4,0xff,0xf2,0x00,0x00,0x06,0x77,0x77,0x77,0x66,0x65,0x7a,0x02,0x12,0x20,
-0x71,0x01,0x21,0xbd,0x2e,0x03,0x09,0x90,0x0b,0xd0,0x66,0x55,0x54,0xcf,0x00,0x00,
-0xbe,0x5f,0x00,0x11,0xc2,0x71,0x01,0x52,0x03,0xf7,0x06,0x67,0xde,0xfd,0x08,0x10,
-0x0a,0x34,0x1e,0x11,0x90,0x0c,0x0c,0xa0,0x1e,0xd0,0x05,0x66,0x6c,0xd0,0x00,0x1c,
-0xf3,0x02,0xf9,0x00,0x30,0x1d,0xf4,0x00,0xd3,0x00,0x11,0x6f,0x97,0x08,0x12,0xbd,
-0x26,0x30,0x22,0x0b,0xc4,0x64,0x03,0x10,0x65,0xc4,0x28,0x30,0xff,0xdb,0x50,0x41,
-0x17,0x42,0xa7,0x67,0xcf,0xb0,0x88,0x0c,0x22,0x7f,0x70,0x31,0x0c,0x10,0xcc,0xb7,
-0x07,0x01,0x68,0x0c,0x01,0x0f,0x00,0x11,0xdc,0x04,0x24,0x00,0x1e,0x00,0x50,0x02,
-0xef,0xb8,0x89,0xef,0xeb,0x02,0x44,0x7b,0xdd,0xb9,0x40,0x26,0x03,0x12,0x17,0x09,
-0x00,0xf0,0x05,0xf6,0x05,0xf1,0x4a,0xaa,0xbc,0xd8,0x00,0x0f,0x60,0x5f,0x14,0xab,
-0xaa,0x9f,0xc0,0x00,0xf5,0x05,0xf1,0x2f,0x03,0x00,0xec,0x14,0x11,0x20,0xd7,0x06,
-0x30,0xf5,0x05,0xf2,0x44,0x0c,0x21,0xcd,0xdf,0x11,0x00,0x31,0x9f,0x08,0x99,0x11,
-0x00,0x22,0x0e,0xb0,0x22,0x00,0x00,0xf8,0x07,0x01,0x11,0x00,0x22,0xbe,0x00,0x11,
-0x00,0x40,0x3f,0x71,0x66,0x66,0x11,0x00,0x80,0x0b,0xe0,0x4f,0xff,0xff,0x50,0x5f,
-0x20,0x87,0x0b,0x00,0x22,0x00,0x11,0x02,0x87,0x26,0x51,0x60,0x5f,0x20,0xde,0x10,
-0x77,0x00,0x32,0xf2,0xae,0x20,0x11,0x00,0x22,0x27,0x30,0x88,0x00,0x02,0x50,0x04,
-0x00,0x22,0x00,0x1f,0x00,0x11,0x00,0x02,0x27,0xa3,0x04,0x61,0x04,0x61,0x01,0x33,
-0x44,0x44,0x55,0x55,0x80,0x09,0x02,0x5c,0x12,0x00,0x43,0x02,0x4e,0x21,0x11,0x11,
-0x2f,0x4d,0x0d,0x24,0x0f,0x70,0x37,0x00,0x14,0xf7,0x13,0x00,0x12,0x2f,0x10,0x09,
-0x21,0x62,0x00,0x02,0x0b,0x01,0x83,0x0d,0x12,0x3f,0x3b,0x36,0x44,0xf9,0x00,0x05,
-0xf3,0x83,0x0d,0x23,0x6f,0x10,0x67,0x06,0x2b,0x02,0x60,0x96,0x0d,0x06,0xa9,0x0d,
-0x23,0x70,0x00,0x04,0x0d,0x02,0x29,0x36,0x30,0x27,0x76,0x66,0x01,0x00,0x50,0x77,
-0x75,0x00,0x00,0x01,0xde,0x16,0x32,0x88,0x40,0x00,0xe0,0x05,0x15,0xfe,0xdb,0x12,
-0x24,0x0b,0xd0,0x0a,0x00,0x15,0xbc,0x13,0x00,0x02,0xa9,0x0e,0x44,0x78,0x00,0x00,
-0xcb,0x23,0x00,0x01,0x2a,0x11,0x01,0xe3,0x02,0x18,0x96,0x36,0x00,0x50,0x22,0x22,
-0x33,0xcd,0x33,0x13,0x0a,0x14,0x8f,0x73,0x00,0x30,0x01,0x44,0x44,0x37,0x0a,0x25,
-0x44,0x44,0x1c,0x13,0x08,0x32,0x17,0x12,0x08,0x48,0x1b,0x00,0x7e,0x33,0x54,0x66,
-0x66,0x66,0x65,0xaf,0x25,0x00,0x16,0x06,0xca,0x10,0x0f,0x13,0x00,0x12,0x27,0x17,
-0x00,0xd1,0x00,0x01,0x9f,0x0a,0x2c,0xef,0xd0,0xd0,0x00,0x28,0x0b,0xc0,0x09,0x00,
-0x00,0xdc,0x0e,0x23,0x0c,0xb0,0x21,0x00,0x23,0x0d,0xa0,0x09,0x00,0x26,0x0a,0x60,
-0x33,0x00,0x94,0x03,0x44,0x44,0x4c,0xd4,0x44,0x44,0x44,0x43,0x4a,0x14,0x22,0xfe,
-0x03,0x3f,0x14,0x05,0x05,0x07,0x00,0xa8,0x02,0x10,0xc1,0x2a,0x00,0x22,0xb0,0x00,
-0x97,0x01,0x23,0x05,0xf0,0x09,0x00,0x10,0x06,0x09,0x00,0x01,0xc2,0x15,0x10,0xf0,
-0x8a,0x39,0x40,0x77,0x77,0x66,0x6a,0xf0,0x28,0x13,0xf3,0x32,0x08,0x06,0x09,0x00,
-0x01,0x38,0x15,0x00,0x6f,0x00,0x10,0x55,0x98,0x01,0x14,0x20,0xc6,0x00,0x14,0x30,
-0xc6,0x00,0x1f,0xc0,0xc6,0x00,0x04,0x13,0x10,0x09,0x00,0x3e,0x0a,0xc0,0x00,0xc6,
-0x00,0x26,0x0b,0x70,0x2a,0x00,0x50,0x17,0x77,0x78,0x8d,0xe8,0x04,0x1a,0x14,0x5f,
-0x7d,0x15,0x0c,0x90,0x35,0x02,0x92,0x14,0x03,0x03,0x1b,0x51,0x1c,0xfc,0x87,0x8e,
-0xfa,0xb0,0x0c,0x11,0x50,0x28,0x3b,0x00,0x48,0x11,0x02,0xac,0x0c,0x24,0x02,0xf7,
-0x24,0x10,0x23,0xf9,0x00,0xac,0x0c,0x23,0xaf,0x50,0x8e,0x27,0x42,0x1d,0xfc,0x88,
-0x9e,0xaa,0x04,0x45,0x6b,0xdd,0xb8,0x30,0x55,0x00,0x15,0x50,0xec,0x01,0xb1,0xf6,
-0x00,0x00,0x02,0x66,0x66,0x77,0x87,0x00,0x00,0xf6,0x2b,0x0f,0x55,0xfe,0xff,0x50,
-0x00,0xf6,0xec,0x02,0x1d,0xf7,0x0a,0x00,0x14,0x50,0x1f,0x03,0x42,0x2f,0x40,0x00,
-0xf8,0xf0,0x00,0x22,0x3f,0x30,0x0a,0x00,0x10,0xd9,0x1b,0x0b,0x11,0xf9,0x17,0x0f,
-0x00,0x03,0x0b,0x01,0x3e,0x02,0x10,0xca,0x64,0x06,0x30,0xfc,0x66,0x50,0xa1,0x02,
-0x13,0x8d,0x5b,0x03,0x35,0xcb,0x00,0x46,0x0a,0x00,0x1b,0x00,0x0a,0x00,0x81,0x15,
-0x55,0xdd,0x67,0x8a,0xbe,0x70,0xf8,0xfc,0x02,0x46,0xfe,0xdb,0x96,0x10,0x42,0x35,
-0x0e,0x0a,0x00,0x06,0xd9,0x09,0x08,0x4e,0x09,0x19,0x10,0xe6,0x00,0x73,0x35,0x55,
-0x56,0x66,0x10,0x01,0xf6,0x07,0x20,0x14,0x80,0xc8,0x00,0x24,0x0f,0x90,0x0a,0x00,
-0x18,0x0e,0x0a,0x00,0x02,0xa4,0x38,0x05,0x0a,0x00,0x15,0xac,0x0a,0x00,0x80,0x9e,
-0x00,0x0e,0x80,0x00,0xfc,0x78,0x70,0xf0,0x0b,0x10,0x04,0xdc,0x00,0x00,0x72,0x3c,
-0x05,0xb4,0x00,0x18,0xbf,0xb4,0x00,0x2f,0x97,0x10,0xaa,0x00,0x06,0x15,0x36,0x14,
-0x00,0x12,0x9f,0x46,0x04,0x06,0xde,0x06,0x0f,0x0a,0x00,0x05,0x64,0x87,0x77,0x77,
-0x77,0x84,0x00,0x12,0x11,0x11,0xea,0xed,0x0d,0x03,0xc1,0x04,0x21,0x0e,0xff,0xb2,
-0x33,0x00,0xff,0x09,0x5c,0x11,0x11,0x11,0x2f,0x70,0xb6,0x04,0x15,0x1f,0x09,0x00,
-0x25,0x60,0x00,0xbe,0x01,0x00,0xc1,0x05,0x41,0x01,0x10,0x3f,0x30,0xc2,0x01,0x21,
-0x0b,0xb0,0x22,0x05,0x63,0x3f,0x50,0x0c,0xc0,0x6f,0x00,0x09,0x00,0x13,0x7e,0x09,
-0x00,0x24,0xb0,0x01,0x09,0x00,0x02,0x7f,0x0f,0x13,0x40,0x09,0x00,0x11,0x4f,0x12,
-0x00,0x24,0x10,0x6f,0x7b,0x03,0x92,0x16,0x66,0x66,0x65,0x55,0x56,0x66,0x66,0x63,
-0x60,0x12,0x15,0x21,0xd6,0x04,0x00,0x6c,0x06,0x5d,0x55,0x55,0x54,0x44,0x5f,0x90,
-0x00,0x1d,0x0f,0x99,0x00,0x0a,0xa2,0x00,0x02,0x1e,0x0a,0x04,0x4c,0x11,0x07,0x0c,
-0x03,0x40,0x5e,0xee,0xdd,0xdd,0x5a,0x11,0x80,0xfe,0x27,0x88,0x88,0x87,0xcf,0x77,
-0x76,0x75,0x00,0x04,0xa7,0x09,0x0f,0x09,0x00,0x14,0x1d,0x9f,0x09,0x00,0x1a,0x8d,
-0x70,0x03,0x10,0x02,0x86,0x05,0x10,0x88,0xd1,0x0d,0x0a,0xe7,0x03,0x0f,0x09,0x00,
-0x07,0x03,0x19,0x01,0x03,0x2b,0x12,0x01,0xc2,0x04,0x33,0x40,0x00,0x02,0x92,0x04,
-0x25,0x31,0x6f,0xa4,0x04,0x61,0x44,0x44,0x44,0x9f,0x54,0x44,0xa8,0x0f,0x03,0x22,
-0x06,0x06,0x09,0x00,0x51,0x11,0x11,0x7f,0x32,0x23,0xba,0x1f,0x03,0x77,0x05,0x74,
-0x01,0x45,0x55,0x55,0x44,0x49,0xf2,0x9f,0x0f,0x1c,0xf2,0x59,0x05,0x1d,0x06,0x1b,
-0x00,0x14,0x07,0xe5,0x06,0x00,0x75,0x06,0x11,0x08,0x82,0x12,0x00,0x99,0x00,0x10,
-0x37,0xb7,0x04,0x15,0xcf,0xaa,0x19,0x1d,0xf0,0x00,0x01,0x24,0x09,0xe0,0x0a,0x00,
-0x15,0x9d,0x0e,0x10,0x17,0x90,0x11,0x01,0x31,0x4f,0xfe,0xee,0xd4,0x2c,0xb3,0xff,
-0x01,0x67,0x77,0x77,0x78,0xfa,0x77,0x77,0x66,0x50,0x00,0x04,0x03,0x6f,0x00,0x12,
-0xf4,0x91,0x00,0x60,0x77,0x78,0x56,0x47,0x77,0x73,0xba,0x2c,0x64,0xfe,0xfe,0x08,
-0xee,0xef,0xc0,0x5c,0x00,0x14,0xad,0xcd,0x14,0x10,0x0a,0xb1,0x26,0x01,0x54,0x05,
-0x10,0xad,0x7c,0x0d,0x21,0x66,0x62,0x25,0x05,0x03,0x1d,0x07,0x14,0xac,0x1d,0x07,
-0x10,0x0a,0x31,0x23,0x01,0xc8,0x09,0x11,0xac,0xbe,0x00,0x44,0x76,0x40,0x00,0x02,
-0xb9,0x04,0x00,0xba,0x11,0x40,0x21,0x11,0x22,0x20,0xa2,0x05,0x11,0xbf,0xf1,0x18,
-0x71,0x7f,0x00,0x02,0x44,0x44,0x44,0xdb,0xd7,0x05,0x01,0x8a,0x01,0x13,0x6f,0x1c,
-0x18,0x23,0x06,0xf0,0xd3,0x03,0x13,0x6f,0x1f,0x04,0x23,0x06,0xf0,0xe4,0x0b,0xf3,
-0x03,0x6f,0x01,0x66,0x66,0x77,0x89,0xac,0xeb,0x06,0xf0,0x5e,0xee,0xef,0xfd,0xcb,
-0x86,0x20,0x6f,0x52,0x07,0x20,0x06,0xf0,0xd5,0x01,0x00,0xe6,0x21,0x01,0x11,0x00,
-0x11,0x05,0x1a,0x06,0x11,0x05,0xee,0x3a,0x03,0x75,0x01,0x00,0x22,0x00,0x11,0x5d,
-0xa5,0x20,0x07,0x2e,0x16,0x1c,0x8f,0x3f,0x16,0x20,0x8f,0x87,0xcf,0x0d,0x31,0x10,
-0x00,0x04,0x0e,0x0a,0x13,0xe4,0x16,0x00,0x91,0x51,0x00,0x23,0x33,0x33,0x43,0x00,
-0x01,0xf6,0x5a,0x06,0x00,0x65,0x05,0x52,0x33,0x33,0x32,0x4f,0x70,0x7d,0x04,0x1c,
-0x1f,0x08,0x00,0x13,0x60,0x08,0x00,0x32,0x50,0x00,0xf7,0x7e,0x03,0x02,0x08,0x00,
-0x22,0x4f,0x20,0x08,0x00,0x34,0x29,0x00,0x00,0x93,0x08,0xf3,0x02,0xf7,0x16,0x66,
-0x66,0x78,0x9a,0xce,0x70,0xf7,0x5e,0xef,0xff,0xfd,0xca,0x85,0x10,0xf7,0xe5,0x01,
-0x0e,0x08,0x00,0x02,0xea,0x01,0x0c,0x08,0x00,0x16,0xf8,0x08,0x00,0x27,0x05,0x90,
-0x49,0x05,0x1f,0x20,0xd0,0x03,0x5b,0x71,0x8f,0xc8,0x87,0x7b,0xf7,0x66,0x64,0xb3,
-0x01,0x02,0xca,0x02,0x0f,0x09,0x00,0x15,0x19,0xf0,0x09,0x00,0x5c,0x0d,0x70,0x00,
-0x06,0xe0,0xd0,0x03,0x34,0x66,0x77,0x20,0x5b,0x03,0x05,0xb5,0x03,0x0e,0x09,0x00,
-0x04,0xc7,0x03,0x03,0x42,0x09,0x06,0x6a,0x1a,0x25,0x00,0x0d,0xc0,0x09,0x01,0xac,
-0x0f,0x10,0x66,0x81,0x20,0x14,0x75,0xb7,0x07,0x01,0xc8,0x11,0x34,0xb0,0x00,0xf9,
-0x03,0x04,0x11,0xf8,0x3e,0x01,0x03,0x09,0x00,0x23,0x03,0xf3,0x09,0x00,0x61,0x04,
-0xf4,0x0a,0x70,0x00,0xc5,0x09,0x00,0x04,0x2c,0x14,0x0e,0x09,0x00,0x63,0xfa,0x66,
-0x66,0x66,0x67,0x73,0xe0,0x34,0x28,0xff,0xfa,0x94,0x09,0x00,0xf5,0x05,0x33,0x54,
-0x00,0x00,0xa4,0x45,0x00,0x4d,0x01,0x00,0xf5,0x05,0x24,0x5f,0x40,0xa5,0x03,0x04,
-0x09,0x00,0x24,0x5f,0x30,0x09,0x00,0x1a,0x20,0x62,0x04,0x07,0x04,0x05,0x1d,0x9e,
-0x48,0x0a,0x1e,0xc9,0x3d,0x07,0x08,0xa7,0x01,0x04,0xea,0x00,0x31,0x28,0x88,0x87,
-0x05,0x09,0x31,0x85,0x00,0x01,0x26,0x05,0x13,0x10,0xa4,0x0a,0x16,0xef,0x33,0x0b,
-0x0e,0x46,0x0b,0x06,0x13,0x00,0x15,0xf6,0xfd,0x0a,0x05,0x80,0x08,0x17,0x91,0x67,
-0x00,0x23,0x06,0xee,0x69,0x04,0x20,0xd0,0x27,0x65,0x00,0x4e,0x88,0x88,0x88,0x86,
-0x12,0x09,0x03,0x91,0x0a,0x25,0x67,0x76,0xa4,0x0a,0x14,0xf2,0x43,0x16,0x24,0x6f,
-0x30,0x49,0x00,0x05,0x99,0x26,0x0f,0x13,0x00,0x01,0x0e,0xa4,0x0a,0x10,0x16,0x05,
-0x00,0x00,0x0c,0x0b,0x15,0x55,0x55,0x00,0x00,0xb4,0x00,0x00,0xbf,0x05,0x05,0x16,
-0x0c,0x1e,0x0f,0x09,0x00,0x0e,0xff,0x02,0x14,0x50,0x40,0x05,0x07,0x47,0x01,0x04,
-0x27,0x02,0x50,0xfd,0x16,0x66,0x67,0x77,0x01,0x00,0x17,0x74,0xcb,0x00,0x1c,0x93,
-0x61,0x0c,0x1f,0x02,0x09,0x00,0x08,0x14,0xf6,0x09,0x00,0x64,0xfb,0x66,0x55,0x55,
-0x66,0x63,0x73,0x32,0x1b,0xfa,0x43,0x01,0x01,0xaa,0x03,0x6f,0x02,0x88,0x88,0x87,
-0x77,0x7f,0xbd,0x00,0x10,0x05,0xaa,0x03,0x17,0x0b,0x07,0x0c,0x13,0x6f,0x8a,0x01,
-0x41,0xfc,0x27,0x88,0x88,0xa8,0x24,0x08,0xb4,0x00,0x05,0xec,0x16,0x61,0x88,0x88,
-0x89,0x99,0x9b,0xb0,0xf2,0x1b,0x4c,0xed,0xdd,0xde,0xf1,0x87,0x06,0x24,0x07,0xf1,
-0x11,0x0f,0x10,0xf0,0xfe,0x41,0x57,0x77,0x76,0x66,0x66,0x40,0xbd,0x19,0x02,0x09,
-0x00,0x10,0x10,0x71,0x01,0x22,0xfe,0xee,0xfd,0x0a,0x10,0x67,0x14,0x0f,0x14,0x52,
-0x6a,0x0b,0x00,0xef,0x29,0x09,0x23,0x1a,0x2f,0x0f,0x90,0xcf,0x00,0x18,0x28,0x08,
-0x20,0x67,0x04,0x12,0xee,0x83,0x07,0x31,0x28,0x88,0x77,0x01,0x00,0x00,0x08,0x1e,
-0x0d,0xfd,0x40,0x10,0xe1,0xd4,0x00,0x53,0xc0,0x00,0x00,0x05,0xf2,0x03,0x0c,0x15,
-0x06,0x09,0x00,0x04,0x30,0x0c,0x14,0x06,0x30,0x0c,0x05,0x24,0x00,0x06,0x09,0x00,
-0x05,0x7a,0x17,0x04,0x30,0x0c,0x0b,0xae,0x15,0xd3,0x08,0xbb,0xbb,0xcc,0xc8,0x00,
-0x08,0xf0,0x08,0xaa,0xa9,0x99,0xfd,0x2d,0x06,0x12,0xfa,0x08,0x00,0x13,0x03,0xbe,
-0x15,0x23,0x09,0xf1,0xb6,0x15,0x12,0xa0,0x08,0x00,0x12,0x7f,0xb6,0x15,0x22,0x01,
-0xfa,0x5d,0x06,0x22,0x0a,0xf2,0x08,0x00,0x21,0x6f,0x70,0x08,0x00,0x22,0x02,0xfb,
-0x75,0x06,0x21,0x1d,0xd1,0x08,0x00,0x31,0x01,0xde,0x20,0xf6,0x1c,0x22,0x0c,0xe2,
-0xfe,0x1c,0x24,0x5c,0x20,0x06,0x1d,0x0f,0x08,0x00,0x11,0x04,0xae,0x15,0xb1,0x02,
-0x30,0x01,0x22,0x33,0x44,0x20,0x00,0x0b,0xc0,0x4f,0xb9,0x01,0x60,0x0b,0xd0,0x02,
-0x32,0x21,0x1b,0x08,0x00,0x01,0x33,0x4a,0x02,0x08,0x00,0x21,0x5f,0x60,0x08,0x00,
-0x22,0x01,0xed,0xfe,0x0c,0x21,0x0c,0xf3,0x08,0x00,0x00,0x4e,0x1a,0x00,0x08,0x00,
+0x01,0xf7,0x00,0x3f,0x20,0xa0,0x02,0xf2,0x04,0x4f,0x40,0x03,0xf2,0x04,0xf1,0x00,
+0x00,0x07,0xf1,0x00,0x3f,0x20,0x4f,0x10,0x00,0x00,0xae,0x00,0x11,0x00,0x40,0x0f,
+0x92,0x44,0x7f,0x11,0x00,0x41,0x06,0xf4,0xcf,0xff,0x11,0x00,0x70,0xbe,0x00,0x11,
+0x4f,0x20,0x4f,0x10,0x81,0x05,0x41,0x03,0xf3,0x04,0xf1,0xa3,0x02,0x71,0x3f,0x30,
+0x4f,0x10,0x05,0xf6,0x00,0x11,0x00,0x32,0x01,0xfb,0x00,0x11,0x00,0x22,0xce,0x10,
+0x11,0x00,0x10,0xaf,0xa2,0x02,0x50,0x2f,0x30,0x4f,0x28,0x30,0x7f,0x01,0x10,0xf3,
+0x4a,0x03,0x02,0x11,0x00,0x01,0xb1,0x04,0x0d,0x11,0x00,0x47,0x00,0xb1,0x03,0xf1,
+0x9f,0x03,0x05,0xc4,0x00,0x71,0x01,0x10,0x00,0x1f,0x40,0x7f,0x00,0xa9,0x03,0xd1,
+0x2f,0x60,0x7f,0x10,0x15,0x55,0x44,0xaf,0x10,0x1f,0x60,0x7f,0x10,0xaa,0x03,0x83,
+0x1f,0x60,0x6f,0x10,0x00,0x00,0x02,0xf9,0x09,0x00,0x41,0x0a,0xf3,0x66,0x6f,0x09,
+0x00,0x40,0x4f,0xa2,0xff,0xff,0x09,0x00,0x00,0xac,0x03,0x10,0x0f,0x09,0x00,0x00,
+0x4e,0x03,0x41,0x0f,0x70,0x6f,0x10,0xad,0x03,0x00,0x09,0x00,0x10,0x2d,0xe6,0x02,
+0x41,0x1f,0x70,0x6f,0x00,0xae,0x03,0x34,0x0e,0x50,0x6f,0x75,0x00,0x10,0x02,0x05,
+0x00,0x41,0x9a,0x00,0x00,0x4d,0x0e,0x00,0x11,0xdc,0x94,0x06,0x02,0xc8,0x01,0x20,
+0xcd,0x00,0x5c,0x03,0x50,0xfc,0x00,0x01,0xfd,0x00,0xb5,0x03,0x50,0xef,0x90,0x09,
+0xff,0xb0,0xae,0x02,0xf6,0x0f,0x37,0xf5,0x2f,0x86,0xfa,0x00,0x00,0x03,0xf9,0x00,
+0x9f,0xdd,0x00,0x6f,0xa0,0x00,0x0d,0xb0,0x00,0x0c,0xe1,0x00,0x05,0xf4,0x00,0x05,
+0x00,0x00,0x03,0x20,0x77,0x04,0x13,0x13,0x08,0x00,0xf2,0x00,0x7e,0x05,0xab,0xbb,
+0xbc,0xcc,0x20,0x00,0x7e,0x05,0xaa,0xa9,0x99,0xbf,0x60,0xa0,0x04,0x22,0x6f,0x30,
+0x08,0x00,0x50,0xbe,0x28,0x88,0xbe,0x00,0x28,0x05,0x30,0x3e,0xee,0xfe,0xc0,0x02,
+0x42,0xf3,0x00,0x00,0x7e,0x01,0x07,0x01,0x08,0x00,0x00,0x16,0x05,0x11,0x7e,0x6c,
+0x00,0x01,0x08,0x00,0xf1,0x0a,0x1d,0xd0,0x00,0x34,0x44,0x9e,0x00,0x00,0xbf,0x30,
+0x04,0xff,0xff,0xff,0x00,0x08,0xf5,0x00,0x00,0x22,0x22,0x8f,0x00,0x8f,0x60,0xc4,
+0x05,0x22,0x09,0xf5,0xcc,0x05,0x33,0x1d,0x40,0x00,0xfa,0x06,0x0f,0x08,0x00,0x0a,
+0x04,0x28,0x05,0x15,0x4b,0x63,0x04,0x00,0x7e,0x01,0x31,0x00,0x9e,0x3f,0x4d,0x06,
+0x61,0x09,0xe0,0x55,0x54,0x44,0xce,0xa4,0x04,0x31,0x00,0x0e,0xb2,0x5f,0x06,0x50,
+0x04,0xf6,0x06,0x67,0xce,0xc3,0x06,0x41,0x10,0x00,0x09,0xe0,0xc1,0x06,0x00,0x1e,
+0x00,0xa0,0x2f,0xc0,0x05,0x66,0x6c,0xe0,0x00,0x3e,0xe1,0x01,0xe1,0x05,0x20,0x6f,
+0xd1,0x89,0x04,0x21,0xe1,0xbf,0x05,0x05,0x31,0x9e,0xac,0x30,0x27,0x09,0x03,0x1d,
+0x04,0x12,0x47,0xd7,0x08,0x11,0x22,0x18,0x08,0xa3,0xff,0xff,0xfc,0x00,0x01,0x44,
+0x33,0x33,0x33,0x3b,0xc3,0x03,0x12,0x9f,0x07,0x00,0x1f,0x09,0x0f,0x00,0x03,0x13,
+0xae,0x23,0x02,0x13,0x40,0xb5,0x00,0x11,0x22,0x72,0x07,0x40,0x10,0x00,0x0c,0xc0,
+0xfe,0x06,0x10,0xfd,0xae,0x01,0x80,0x03,0x33,0x22,0x2e,0xc0,0x44,0x4d,0xd0,0xd5,
+0x01,0x41,0xf7,0x5f,0xff,0xfd,0x46,0x00,0x40,0x10,0x22,0x1b,0xd0,0x59,0x09,0x50,
+0x80,0x00,0x00,0xbd,0x00,0xad,0x00,0xf2,0x07,0x00,0x00,0x0b,0xd0,0x00,0x00,0x2e,
+0xd1,0x04,0xed,0xdd,0xfc,0x00,0x00,0x5f,0xc1,0x00,0x17,0x88,0x7e,0xc0,0x02,0xb0,
+0x00,0x31,0xcc,0x00,0xdc,0xb1,0x00,0x36,0x0b,0x90,0x00,0x7b,0x09,0x62,0x78,0x88,
+0x88,0x88,0xac,0x50,0xb4,0x00,0x14,0xee,0x54,0x04,0x23,0x0e,0xa0,0x09,0x00,0x50,
+0xea,0x00,0x00,0x06,0xef,0xce,0x00,0x96,0x80,0x00,0x00,0x9f,0x98,0x88,0x88,0x88,
+0x71,0xb4,0x00,0x23,0x00,0x9f,0x0b,0x02,0xf4,0x00,0x08,0xff,0xee,0xff,0xff,0xff,
+0xf2,0x00,0x00,0x06,0x77,0x77,0x77,0x66,0x65,0x7a,0x02,0x12,0x20,0x71,0x01,0x21,
+0xbd,0x2e,0x03,0x09,0x90,0x0b,0xd0,0x66,0x55,0x54,0xcf,0x00,0x00,0xbe,0x5f,0x00,
+0x11,0xc2,0x71,0x01,0x52,0x03,0xf7,0x06,0x67,0xde,0xfd,0x08,0x90,0x0a,0xe0,0x00,
+0x00,0x4f,0x90,0x00,0x00,0xad,0xfa,0x08,0x80,0x05,0x66,0x6c,0xd0,0x00,0x1c,0xf3,
+0x02,0xf9,0x00,0x30,0x1d,0xf4,0x00,0xd3,0x00,0x11,0x6f,0x97,0x08,0x31,0xbd,0x9f,
+0x80,0xc0,0x00,0x12,0xc4,0x64,0x03,0x00,0x6a,0x00,0xc0,0x7c,0xff,0xdb,0x50,0x00,
+0x00,0x01,0xdf,0xa7,0x67,0xcf,0xb0,0x39,0x02,0x71,0x00,0x00,0x7f,0x70,0x00,0x1f,
+0x80,0xee,0x00,0x20,0x03,0xf6,0xad,0x01,0x11,0xe0,0x0f,0x00,0x00,0xfb,0x02,0x21,
+0xcf,0x40,0x1e,0x00,0x50,0x02,0xef,0xb8,0x89,0xef,0xeb,0x02,0x44,0x7b,0xdd,0xb9,
+0x40,0x26,0x03,0x12,0x17,0x09,0x00,0xf1,0x05,0xf6,0x05,0xf1,0x4a,0xaa,0xbc,0xd8,
+0x00,0x0f,0x60,0x5f,0x14,0xab,0xaa,0x9f,0xc0,0x00,0xf5,0x05,0xf1,0x2f,0x03,0x41,
+0x0f,0x50,0x5f,0x20,0xd7,0x06,0x10,0xf5,0x56,0x07,0x41,0x05,0xf4,0xcd,0xdf,0x11,
+0x00,0x31,0x9f,0x08,0x99,0x11,0x00,0x22,0x0e,0xb0,0x22,0x00,0x00,0xf8,0x07,0x01,
+0x11,0x00,0x22,0xbe,0x00,0x11,0x00,0x40,0x3f,0x71,0x66,0x66,0x11,0x00,0x80,0x0b,
+0xe0,0x4f,0xff,0xff,0x50,0x5f,0x20,0x87,0x0b,0x00,0x22,0x00,0x40,0x02,0xfb,0x00,
+0x00,0x66,0x00,0x31,0x20,0xde,0x10,0x77,0x00,0x32,0xf2,0xae,0x20,0x11,0x00,0x22,
+0x27,0x30,0x88,0x00,0x02,0x50,0x04,0x00,0x22,0x00,0x1f,0x00,0x11,0x00,0x02,0x27,
+0xa3,0x04,0x61,0x04,0x61,0x01,0x33,0x44,0x44,0x55,0x55,0x80,0x09,0x00,0xad,0x01,
+0x11,0xf7,0x43,0x02,0x6a,0x21,0x11,0x11,0x2f,0x80,0x00,0x26,0x06,0x00,0x2e,0x04,
+0x04,0x37,0x00,0x14,0xf7,0x13,0x00,0x12,0x2f,0x10,0x09,0x42,0x62,0x00,0x02,0xf5,
+0x23,0x00,0x30,0x80,0x00,0x3f,0x19,0x01,0x00,0xdf,0x08,0x20,0x05,0xf3,0x13,0x00,
+0x00,0x43,0x01,0x23,0x6f,0x10,0x67,0x06,0x24,0x02,0x60,0x13,0x00,0x0a,0x7a,0x06,
+0x00,0x81,0x04,0x02,0x15,0x08,0x03,0x01,0x00,0x40,0xf0,0x27,0x76,0x66,0x01,0x00,
+0xc2,0x77,0x75,0x00,0x00,0x01,0x77,0x77,0x77,0x77,0x88,0x40,0x00,0xe0,0x05,0x24,
+0xfe,0xfc,0x33,0x00,0x24,0x0b,0xd0,0x0a,0x00,0x15,0xbc,0x13,0x00,0x11,0xc0,0x07,
+0x00,0x44,0x78,0x00,0x00,0xcb,0x23,0x00,0x11,0x0c,0x90,0x02,0x00,0xe3,0x02,0x18,
+0x96,0x36,0x00,0x50,0x22,0x22,0x33,0xcd,0x33,0x13,0x0a,0x14,0x8f,0x73,0x00,0x30,
+0x01,0x44,0x44,0x37,0x0a,0x3b,0x44,0x44,0x20,0xf9,0x06,0x21,0x01,0x10,0xa9,0x02,
+0x00,0x01,0x00,0x00,0x38,0x01,0x64,0x26,0x66,0x66,0x66,0x65,0xaf,0x25,0x00,0x25,
+0x06,0xf2,0x4f,0x0a,0x0f,0x13,0x00,0x12,0x27,0x17,0x00,0xd1,0x00,0x01,0x9f,0x0a,
+0x2c,0xef,0xd0,0xd0,0x00,0x29,0x0b,0xc0,0x09,0x00,0x53,0x06,0x80,0x00,0x0c,0xb0,
+0x21,0x00,0x23,0x0d,0xa0,0x09,0x00,0x26,0x0a,0x60,0x33,0x00,0xa3,0x03,0x44,0x44,
+0x4c,0xd4,0x44,0x44,0x44,0x43,0x7f,0xcb,0x00,0x20,0xfe,0x03,0x4d,0x04,0x07,0x05,
+0x07,0x00,0xa8,0x02,0x10,0xc1,0x2a,0x00,0x22,0xb0,0x00,0x97,0x01,0x23,0x05,0xf0,
+0x09,0x00,0x21,0x06,0xf0,0x87,0x00,0x11,0xee,0x60,0x08,0xb3,0x05,0xf8,0x77,0x77,
+0x66,0x6a,0xf0,0x00,0x00,0x04,0xf3,0x32,0x08,0x06,0x09,0x00,0x01,0x59,0x00,0x00,
+0x6f,0x00,0x10,0x55,0x98,0x01,0x14,0x20,0xc6,0x00,0x14,0x30,0xc6,0x00,0x1f,0xc0,
+0xc6,0x00,0x04,0x13,0x10,0x09,0x00,0x3e,0x0a,0xc0,0x00,0xc6,0x00,0x26,0x0b,0x70,
+0x2a,0x00,0xa3,0x17,0x77,0x78,0x8d,0xe8,0x88,0x88,0x88,0x85,0x5f,0xc6,0x00,0x01,
+0xeb,0x09,0x0d,0x01,0x00,0x40,0x5a,0xde,0xda,0x50,0x08,0x00,0x51,0x1c,0xfc,0x87,
+0x8e,0xfa,0xb0,0x0c,0x00,0x82,0x04,0x00,0x48,0x00,0x13,0xfa,0xac,0x0c,0x22,0x02,
+0xf7,0xbc,0x03,0x02,0x8b,0x08,0x23,0x0d,0xd0,0x24,0x00,0x10,0x9f,0x24,0x00,0x42,
+0x1d,0xfc,0x88,0x9e,0xaa,0x04,0x60,0x6b,0xdd,0xb8,0x30,0x00,0x00,0x12,0x00,0x01,
+0x00,0x23,0x50,0x00,0x01,0x00,0xf2,0x07,0x01,0xf6,0x00,0x00,0x02,0x66,0x66,0x77,
+0x87,0x00,0x00,0xf6,0x00,0x00,0x06,0xff,0xff,0xfe,0xff,0x50,0x00,0xf6,0x1c,0x00,
+0x4d,0x2f,0x60,0x00,0xf7,0x0a,0x00,0x33,0x50,0x00,0xf8,0x0a,0x00,0x12,0x40,0x0a,
+0x00,0x42,0x10,0x00,0x3f,0x30,0x0a,0x00,0x60,0xd9,0x00,0x4f,0x20,0x00,0xf9,0x0a,
+0x00,0xf2,0x09,0xda,0x00,0x5f,0x10,0x00,0xff,0xff,0xf1,0x00,0x00,0xca,0x00,0x7f,
+0x00,0x00,0xfc,0x66,0x50,0x00,0x00,0xcb,0x00,0x8d,0x00,0x28,0x00,0x35,0xcb,0x00,
+0x46,0x0a,0x00,0x1b,0x00,0x0a,0x00,0xf3,0x02,0x15,0x55,0xdd,0x67,0x8a,0xbe,0x70,
+0xf8,0x00,0x00,0x5f,0xff,0xff,0xfe,0xdb,0x96,0x10,0x6e,0x00,0x04,0x28,0x00,0x0b,
+0x0a,0x00,0x15,0xf9,0x0a,0x00,0x15,0xe7,0x0a,0x00,0x37,0x10,0x00,0x00,0xe6,0x00,
+0x60,0x35,0x55,0x56,0x66,0x10,0x01,0xd2,0x00,0x54,0xdf,0xff,0xff,0xff,0x80,0xc8,
+0x00,0x24,0x0f,0x90,0x0a,0x00,0x18,0x0e,0x0a,0x00,0x11,0xf8,0x14,0x01,0x05,0x0a,
+0x00,0x15,0xac,0x0a,0x00,0xd0,0x9e,0x00,0x0e,0x80,0x00,0xfc,0x78,0x70,0x00,0x00,
+0x8e,0x00,0x04,0xdc,0x00,0x45,0xe1,0x00,0x00,0x8f,0xb4,0x00,0x18,0xbf,0xb4,0x00,
+0x2f,0x97,0x10,0xaa,0x00,0x06,0x15,0x36,0x14,0x00,0x10,0x9f,0x05,0x00,0x15,0x62,
+0x0a,0x00,0x1f,0x00,0x0a,0x00,0x06,0x50,0x87,0x77,0x77,0x77,0x84,0x0a,0x00,0xf0,
+0x00,0x5e,0xff,0xff,0xff,0xff,0xea,0x00,0x00,0x00,0x02,0x33,0x44,0x44,0x55,0x55,
+0xb0,0x00,0x10,0xff,0x01,0x00,0xb3,0x60,0x00,0x00,0x01,0x22,0x11,0x11,0x11,0x2f,
+0x70,0x00,0xdb,0x00,0x04,0x09,0x00,0x15,0x1f,0x09,0x00,0x24,0x60,0x00,0xbe,0x01,
+0x00,0x40,0x00,0x51,0x00,0x01,0x10,0x3f,0x30,0xc2,0x01,0xd3,0x0b,0xb0,0x5f,0x20,
+0x00,0x00,0x00,0x3f,0x50,0x0c,0xc0,0x6f,0x00,0x09,0x00,0x13,0x7e,0x09,0x00,0x24,
+0xb0,0x01,0x09,0x00,0x11,0x00,0x09,0x00,0x13,0x40,0x09,0x00,0x11,0x4f,0x12,0x00,
+0x32,0x10,0x6f,0xff,0x01,0x00,0xf1,0x06,0xfe,0x16,0x66,0x66,0x65,0x55,0x56,0x66,
+0x66,0x63,0x00,0x00,0x01,0x11,0x11,0x11,0x21,0x00,0x00,0x00,0x07,0x1a,0x00,0x9d,
+0x50,0x00,0x00,0x01,0x55,0x55,0x54,0x44,0x5f,0x90,0x00,0x1d,0x0f,0x99,0x00,0x0a,
+0xa2,0x00,0x01,0x09,0x00,0x13,0x30,0x09,0x00,0x26,0x05,0x00,0x01,0x00,0xf0,0x01,
+0x5e,0xee,0xdd,0xdd,0xee,0xee,0xef,0xff,0xfe,0x27,0x88,0x88,0x87,0xcf,0x77,0x76,
+0x75,0x00,0x03,0x88,0x01,0x0f,0x09,0x00,0x15,0x1d,0x9f,0x09,0x00,0x28,0x8d,0x00,
+0x01,0x00,0x00,0x0e,0x03,0x70,0x66,0x77,0x88,0x40,0x00,0x00,0x08,0xc5,0x00,0x23,
+0xef,0xc0,0x17,0x00,0x1f,0x0b,0x09,0x00,0x07,0x23,0x0c,0xb0,0x09,0x00,0x23,0x0d,
+0xa0,0x09,0x00,0x52,0x06,0x40,0x00,0x02,0x22,0x01,0x00,0x15,0x31,0x29,0x01,0x90,
+0x03,0x44,0x44,0x44,0x9f,0x54,0x44,0x44,0x42,0x22,0x00,0x14,0x6f,0xa6,0x02,0x03,
+0x09,0x00,0x90,0x11,0x11,0x7f,0x32,0x23,0x10,0x00,0x00,0x0a,0x2c,0x00,0x00,0x39,
+0x03,0x73,0x01,0x45,0x55,0x55,0x44,0x49,0xf2,0x26,0x00,0x24,0x07,0xf2,0x5a,0x00,
+0x0d,0x09,0x00,0x15,0x07,0x09,0x00,0x14,0xf1,0xc2,0x00,0x50,0x60,0x00,0x00,0x08,
+0xee,0x28,0x01,0x00,0x99,0x00,0x64,0x37,0x77,0x77,0x77,0x77,0xcf,0xde,0x00,0x2d,
+0x09,0xf0,0x00,0x01,0x24,0x09,0xe0,0x0a,0x00,0x24,0x9d,0x00,0x4b,0x00,0x17,0x90,
+0x11,0x01,0x30,0x4f,0xfe,0xee,0x01,0x00,0xc3,0xff,0xff,0x01,0x67,0x77,0x77,0x78,
+0xfa,0x77,0x77,0x66,0x50,0x00,0x04,0x03,0x6f,0x00,0x12,0xf4,0x91,0x00,0xe2,0x77,
+0x78,0x56,0x47,0x77,0x73,0x00,0x00,0x01,0xef,0xfe,0xfe,0x08,0xee,0x39,0x01,0x00,
+0x5c,0x00,0x22,0xad,0x00,0x41,0x03,0x91,0x00,0x0a,0xd0,0x00,0x00,0x0d,0xff,0xff,
+0xd0,0x13,0x00,0xc2,0x01,0xfb,0x66,0x62,0x00,0x00,0x0a,0xc0,0x00,0x00,0x1f,0x80,
+0x6b,0x03,0x21,0x00,0x01,0x1a,0x03,0x00,0x13,0x00,0x40,0x0f,0xff,0xff,0xfd,0x13,
+0x00,0x00,0xbe,0x00,0x54,0x76,0x40,0x00,0x02,0x30,0x8c,0x00,0xf3,0x0c,0x15,0x00,
+0x00,0x21,0x11,0x22,0x20,0x00,0x07,0xf0,0x00,0xbf,0xff,0xff,0xff,0xa0,0x00,0x7f,
+0x00,0x02,0x44,0x44,0x44,0xdb,0x00,0x06,0xf0,0x8a,0x01,0x22,0x6f,0x00,0x81,0x04,
+0x23,0x06,0xf0,0xd3,0x03,0x13,0x6f,0x1f,0x04,0x02,0x11,0x00,0xf0,0x05,0x02,0x00,
+0x00,0x6f,0x01,0x66,0x66,0x77,0x89,0xac,0xeb,0x06,0xf0,0x5e,0xee,0xef,0xfd,0xcb,
+0x86,0x20,0x22,0x00,0x10,0xbc,0xc2,0x00,0x10,0xf0,0xd5,0x01,0x41,0x01,0xff,0xff,
+0xff,0x11,0x00,0x70,0x05,0x66,0x6a,0xf0,0x00,0x00,0x05,0xed,0x00,0x02,0x44,0x00,
+0x02,0x22,0x00,0x10,0x5d,0x09,0x00,0x5b,0x2a,0x00,0x00,0x08,0xf0,0x5b,0x02,0x06,
+0x11,0x00,0x00,0xb4,0x03,0x50,0x78,0x10,0x00,0x04,0xef,0xcc,0x01,0x13,0xe4,0x16,
+0x00,0xa2,0x51,0x00,0x23,0x33,0x33,0x43,0x00,0x01,0xf6,0x04,0x1d,0x03,0x72,0xf6,
+0x00,0x33,0x33,0x32,0x4f,0x70,0x7d,0x04,0x1c,0x1f,0x08,0x00,0x13,0x60,0x08,0x00,
+0x32,0x50,0x00,0xf7,0x7e,0x03,0x02,0x08,0x00,0x22,0x4f,0x20,0x08,0x00,0x24,0x29,
+0x00,0xb5,0x04,0xf3,0x03,0x00,0xf7,0x16,0x66,0x66,0x78,0x9a,0xce,0x70,0xf7,0x5e,
+0xef,0xff,0xfd,0xca,0x85,0x10,0xf7,0xe5,0x01,0x0e,0x08,0x00,0x02,0xea,0x01,0x0c,
+0x08,0x00,0x16,0xf8,0x08,0x00,0x27,0x05,0x90,0x49,0x05,0x1f,0x20,0xd0,0x03,0x5b,
+0x71,0x8f,0xc8,0x87,0x7b,0xf7,0x66,0x64,0xb3,0x01,0x02,0xca,0x02,0x0f,0x09,0x00,
+0x15,0x19,0xf0,0x09,0x00,0x5c,0x0d,0x70,0x00,0x06,0xe0,0xd0,0x03,0x34,0x66,0x77,
+0x20,0x5b,0x03,0x05,0xb5,0x03,0x0e,0x09,0x00,0x14,0xb0,0x09,0x00,0x14,0xa0,0xd0,
+0x03,0x14,0x90,0x09,0x00,0x14,0x80,0x2f,0x07,0x50,0x00,0x00,0x17,0x77,0x77,0x51,
+0x00,0x33,0x77,0x75,0x5f,0xd9,0x03,0x10,0xfc,0x21,0x00,0x34,0xb0,0x00,0xf9,0x03,
+0x04,0x11,0xf8,0x3e,0x01,0x03,0x09,0x00,0x23,0x03,0xf3,0x09,0x00,0x61,0x04,0xf4,
+0x0a,0x70,0x00,0xc5,0x09,0x00,0x03,0x4c,0x00,0x1e,0x04,0x09,0x00,0x91,0xfa,0x66,
+0x66,0x66,0x67,0x73,0x00,0x00,0x02,0x3a,0x02,0x17,0xfa,0xc6,0x00,0x10,0x01,0xf5,
+0x05,0x10,0x54,0x76,0x04,0x01,0x74,0x00,0x00,0x4d,0x01,0x00,0xf5,0x05,0x24,0x5f,
+0x40,0xa5,0x03,0x04,0x09,0x00,0x24,0x5f,0x30,0x09,0x00,0x1a,0x20,0x62,0x04,0x07,
+0x04,0x05,0x14,0x9e,0x09,0x00,0x14,0xbc,0x09,0x00,0x1e,0xc9,0x3d,0x07,0x08,0xa7,
+0x01,0x04,0xea,0x00,0x30,0x28,0x88,0x87,0x4e,0x04,0x41,0x88,0x85,0x00,0x01,0x26,
+0x05,0x10,0x10,0x68,0x00,0x00,0x26,0x05,0x05,0xe8,0x06,0x2d,0x0f,0x80,0xfb,0x06,
+0x06,0x13,0x00,0x24,0xf6,0x00,0x1f,0x02,0x05,0x80,0x08,0x17,0x91,0x67,0x00,0x23,
+0x06,0xee,0x69,0x04,0x20,0xd0,0x27,0x65,0x00,0x5f,0x88,0x88,0x88,0x86,0x00,0x01,
+0x00,0x01,0x10,0x26,0x26,0x01,0x23,0x76,0x00,0xa2,0x05,0x22,0xff,0xf2,0x41,0x05,
+0x44,0x00,0x00,0x6f,0x30,0x49,0x00,0x14,0xf3,0x2b,0x00,0x0f,0x13,0x00,0x01,0x1c,
+0x20,0x42,0x05,0x20,0x00,0x16,0x05,0x00,0x55,0x33,0x33,0x33,0x44,0x55,0x55,0x00,
+0x00,0xb4,0x00,0x00,0xbf,0x05,0x2c,0x2f,0x80,0xc6,0x00,0x06,0x09,0x00,0x0e,0xff,
+0x02,0x14,0x50,0x40,0x05,0x07,0x47,0x01,0x04,0x27,0x02,0x50,0xfd,0x16,0x66,0x67,
+0x77,0x01,0x00,0x17,0x74,0xcb,0x00,0x14,0x93,0xdf,0x01,0x14,0xf7,0xae,0x02,0x0f,
+0x09,0x00,0x08,0x14,0xf6,0x09,0x00,0x41,0xfb,0x66,0x55,0x55,0xfb,0x06,0x1c,0xdf,
+0x27,0x02,0x00,0x43,0x01,0x01,0xaa,0x03,0x6f,0x02,0x88,0x88,0x87,0x77,0x7f,0xbd,
+0x00,0x10,0x05,0xaa,0x03,0x26,0x0b,0x20,0x47,0x00,0x13,0x6f,0x8a,0x01,0xbe,0xfc,
+0x27,0x88,0x88,0x99,0x98,0x88,0x88,0x88,0x74,0x00,0x01,0x00,0xfc,0x01,0x04,0x88,
+0x88,0x89,0x99,0x9b,0xb0,0x00,0x00,0x07,0xee,0xee,0xed,0xdd,0xde,0xf1,0x87,0x06,
+0x00,0x09,0x00,0x11,0x06,0xc9,0x02,0xd4,0xf0,0x00,0x00,0x09,0xf8,0x77,0x76,0x66,
+0x66,0x40,0x00,0x00,0x09,0x1f,0x00,0x02,0x09,0x00,0x10,0x10,0x71,0x01,0x80,0xfe,
+0xee,0xff,0xff,0xfb,0x00,0x00,0x00,0x20,0x01,0x51,0x66,0x52,0x00,0x00,0x01,0x65,
+0x02,0x40,0x20,0x00,0x00,0x05,0x38,0x07,0x35,0xef,0x90,0x00,0xb4,0x09,0x0f,0xcf,
+0x00,0x17,0x28,0x08,0x20,0x67,0x04,0x12,0xee,0x83,0x07,0x31,0x28,0x88,0x77,0x01,
+0x00,0x2e,0x75,0x00,0x01,0x00,0x20,0x03,0xe1,0xd4,0x00,0x40,0xc0,0x00,0x00,0x05,
+0x18,0x02,0x00,0x4d,0x04,0x15,0x06,0x09,0x00,0x31,0xff,0xff,0xee,0xc6,0x00,0x42,
+0x06,0xf8,0x77,0x77,0x16,0x06,0x04,0x1b,0x00,0x06,0x09,0x00,0x01,0x62,0x00,0x00,
+0x7a,0x04,0x10,0x55,0x71,0x04,0x14,0x20,0xd9,0x01,0x13,0x30,0x0d,0x01,0xe3,0xf0,
+0x08,0xbb,0xbb,0xcc,0xc8,0x00,0x08,0xf0,0x08,0xaa,0xa9,0x99,0xfd,0x2d,0x06,0x12,
+0xfa,0x08,0x00,0x22,0x03,0xf6,0x08,0x00,0x22,0x09,0xf1,0x08,0x00,0x22,0x0f,0xa0,
+0x08,0x00,0x21,0x7f,0x30,0x08,0x00,0x22,0x01,0xfa,0x5d,0x06,0x22,0x0a,0xf2,0x08,
+0x00,0x21,0x6f,0x70,0x08,0x00,0x22,0x02,0xfb,0x75,0x06,0x21,0x1d,0xd1,0x08,0x00,
+0x30,0x01,0xde,0x20,0x08,0x00,0x41,0xe0,0x0c,0xe2,0x00,0x08,0x00,0x22,0x5c,0x20,
+0x08,0x00,0x2f,0x00,0x00,0x08,0x00,0x11,0x23,0x05,0xb0,0x5c,0x02,0xa1,0x30,0x01,
+0x22,0x33,0x44,0x20,0x00,0x0b,0xc0,0x4f,0xb9,0x01,0x60,0x0b,0xd0,0x02,0x32,0x21,
+0x1b,0x08,0x00,0x00,0x65,0x05,0x12,0xc0,0x08,0x00,0x21,0x5f,0x60,0x08,0x00,0x31,
+0x01,0xed,0x00,0x08,0x00,0x21,0x0c,0xf3,0x08,0x00,0x31,0x02,0xdf,0x50,0x08,0x00,
 0x21,0x7f,0xe4,0x1d,0x09,0x31,0x4d,0xf9,0x10,0x5e,0x05,0x21,0x79,0x20,0x5e,0x02,
-0x1d,0xa0,0x47,0x11,0x18,0x08,0xdd,0x01,0x25,0x0e,0xa0,0x08,0x00,0x04,0x45,0x11,
-0x04,0xfa,0x1b,0x2a,0x09,0xf0,0xf7,0x1b,0x05,0x43,0x11,0x01,0xf4,0x1b,0x13,0x50,
-0x8d,0x02,0x03,0xb3,0x12,0x21,0xea,0x4f,0xe4,0x05,0x61,0x0e,0xa1,0x55,0x54,0x44,
-0xdd,0x94,0x11,0x00,0x4e,0x01,0x10,0x0e,0xe2,0x1f,0x12,0xf5,0x0f,0x00,0x12,0xde,
-0x6d,0x00,0x21,0xaf,0x50,0xbe,0x1b,0x21,0x6f,0x90,0xb4,0x05,0x01,0xa9,0x15,0x40,
-0xda,0x01,0xaf,0x90,0xc3,0x05,0x31,0xa5,0xee,0x50,0xcf,0x0c,0x12,0x87,0xba,0x01,
-0x12,0x40,0xbf,0x13,0x12,0x21,0x61,0x06,0x13,0x0e,0x87,0x1a,0xb2,0xe8,0x00,0x08,
-0xf2,0x11,0x11,0x11,0x2e,0x80,0x00,0x8f,0xab,0x1c,0x72,0x08,0xf6,0x66,0x66,0x55,
-0x5f,0x70,0x54,0x13,0x13,0xf7,0xd7,0x16,0x33,0x70,0x00,0x7f,0xa3,0x15,0x54,0x45,
-0x55,0x55,0x55,0x54,0x03,0x01,0x18,0x73,0x21,0x0c,0x70,0x2e,0xff,0xf9,0x6f,0xff,
-0xd1,0x00,0x10,0x2c,0x52,0x66,0xec,0x27,0x7a,0xf3,0x4a,0x06,0x10,0xf9,0x40,0x03,
-0x12,0xf9,0xf7,0x03,0x21,0x0a,0xf0,0x03,0x1a,0x20,0x05,0xf3,0xdd,0x0d,0x11,0xea,
-0xc6,0x09,0x00,0x0d,0x03,0x12,0xea,0x70,0x06,0x90,0x4f,0x50,0x00,0xeb,0x44,0x40,
-0x00,0x2f,0x50,0xa0,0x4b,0x30,0xef,0xff,0xf7,0x6c,0x12,0x00,0xfb,0x00,0x41,0x33,
-0x20,0x00,0xe9,0x25,0x1b,0x11,0xe9,0x25,0x0a,0x00,0x3f,0x01,0x10,0xe9,0xab,0x4b,
-0x00,0x0d,0x4b,0x00,0x40,0x1a,0x20,0x9e,0x10,0x31,0x00,0x00,0x0a,0x00,0x12,0x33,
-0x56,0x14,0x15,0xd9,0x6c,0x1e,0x11,0xd9,0x0b,0x02,0x12,0x10,0xe1,0x1c,0x03,0x01,
-0x00,0x0f,0x0a,0x00,0x0b,0x1f,0xc9,0x52,0x03,0x01,0x05,0x36,0x09,0xe1,0x1b,0xcc,
-0xc8,0x4c,0xcc,0x90,0x00,0x7f,0x00,0x89,0x9e,0xd3,0xa9,0xdf,0x1c,0x01,0x10,0xea,
-0xd6,0x00,0x11,0x7f,0x45,0x08,0x10,0xcd,0x11,0x00,0x21,0x04,0xf4,0xb1,0x1c,0x50,
-0x00,0x00,0x7f,0x10,0x02,0x3e,0x01,0x00,0x98,0x07,0x40,0x6f,0x4c,0xdd,0xef,0x1b,
-0x05,0x50,0x0a,0xf0,0x8a,0xac,0xf0,0xb9,0x05,0x10,0xeb,0x8b,0x09,0x20,0x0d,0xb0,
-0x81,0x02,0x70,0x06,0xf1,0x05,0xf4,0x00,0x0b,0xf0,0xdf,0x06,0x11,0xec,0x67,0x1f,
-0x60,0x06,0xf1,0x7f,0x20,0x00,0xaf,0xfe,0x3a,0x52,0x04,0x50,0x00,0x3f,0x80,0xad,
-0x09,0x11,0x0c,0x49,0x49,0x03,0xcd,0x17,0x02,0x02,0x0a,0x0b,0xcf,0x09,0x09,0x08,
-0x15,0xa1,0x05,0xd0,0x00,0x03,0x44,0x45,0x10,0x45,0x56,0x50,0x31,0x43,0x11,0x86,
-0x32,0x43,0x73,0x02,0x22,0x3f,0x70,0x01,0x15,0xf4,0x87,0x09,0x02,0xe5,0x11,0x23,
-0x7f,0x10,0x3f,0x06,0x14,0xae,0xf1,0x04,0x23,0xe9,0x00,0xcc,0x03,0x13,0xf5,0x50,
-0x09,0x11,0x08,0x4e,0x0a,0x03,0x00,0x4d,0x2f,0x06,0x50,0xc5,0x0c,0x08,0x1f,0x64,
-0xc5,0x0c,0x3f,0x71,0x15,0x66,0x66,0x01,0x67,0x78,0x70,0xce,0x06,0x32,0xf7,0x5f,
-0xff,0x6c,0x2d,0x21,0x3f,0x60,0x9e,0x00,0x01,0xd7,0x1f,0x03,0x31,0x08,0x23,0x8f,
-0x10,0xd1,0x00,0x24,0x0b,0xe0,0x1a,0x07,0x14,0xfa,0xd2,0x00,0x23,0x3f,0x60,0x60,
-0x00,0x23,0x08,0xf1,0x17,0x02,0x24,0x00,0xdc,0x34,0x08,0x14,0x3f,0x93,0x23,0x01,
-0x2a,0x21,0x06,0x00,0x1d,0x09,0xff,0x01,0x00,0x5d,0x12,0x00,0xa6,0x11,0x15,0x08,
-0xe5,0x12,0x20,0x03,0x33,0x54,0x07,0xc1,0x33,0x33,0x31,0x00,0x00,0x26,0x77,0x77,
-0x31,0x78,0x89,0x70,0x4d,0x15,0x43,0x93,0xde,0xef,0xf3,0x51,0x0a,0x23,0x05,0xf3,
-0xce,0x08,0x02,0x5f,0x01,0x17,0x9e,0x5f,0x01,0x13,0x09,0xe1,0x1a,0x01,0x22,0x0c,
-0x30,0x00,0x08,0xa0,0x30,0x47,0x0a,0x43,0x19,0x00,0x01,0x00,0x15,0x85,0xad,0x08,
-0x0e,0x93,0x00,0x01,0xb6,0x08,0x34,0x67,0x77,0x50,0xd2,0x0a,0x12,0xf1,0xc1,0x19,
-0x01,0x63,0x00,0x11,0x08,0xa2,0x3b,0x0f,0x09,0x00,0x03,0x51,0xf4,0x21,0x11,0x22,
-0x38,0xc3,0x3a,0x04,0x14,0x12,0x54,0x24,0x44,0x44,0x33,0x22,0x56,0x00,0x12,0x11,
-0x36,0x1d,0x11,0x83,0x95,0x04,0x73,0x37,0x66,0x7f,0x90,0x55,0x59,0xf4,0x25,0x01,
-0x0b,0x2e,0x02,0x13,0xdb,0xa7,0x1a,0x14,0x04,0x25,0x02,0x62,0x09,0xd0,0x00,0x00,
-0x0a,0xb0,0x74,0x13,0x00,0x71,0x03,0x21,0x16,0x66,0x2c,0x29,0x33,0x66,0x65,0x5e,
-0x35,0x0e,0x1f,0xec,0x5a,0x01,0x01,0x00,0xc5,0x00,0x10,0x78,0xa8,0x20,0x01,0x24,
-0x00,0x17,0xd1,0xe4,0x1d,0x05,0xd2,0x02,0x11,0x07,0x1a,0x21,0x10,0xe0,0xb2,0x1e,
-0x00,0x49,0x09,0x17,0x70,0xe2,0x1d,0x15,0x08,0x24,0x00,0x04,0x7a,0x2c,0x78,0x01,
-0x67,0x77,0x88,0x77,0x76,0x61,0x07,0x19,0x13,0x00,0x9d,0x00,0x24,0x0e,0x80,0x31,
-0x0a,0x14,0xf9,0xd0,0x0d,0x2a,0x0f,0x90,0x13,0x00,0x14,0xf0,0x13,0x00,0x14,0x9f,
-0x13,0x00,0x24,0x08,0xf0,0x9b,0x07,0x31,0x8f,0x87,0x86,0x09,0x0a,0x00,0x88,0x02,
-0x13,0xd0,0x13,0x00,0x04,0x1c,0x0a,0x07,0x26,0x00,0x09,0x13,0x00,0x61,0xa3,0x34,
-0x57,0x9b,0x20,0x8f,0xe5,0x41,0x31,0xff,0xfd,0xa1,0x01,0x07,0x37,0x33,0x32,0x10,
-0xfe,0x02,0x06,0xa8,0x23,0x0f,0x13,0x00,0x09,0x0a,0x06,0x0c,0x03,0x7c,0x22,0x44,
-0x00,0x00,0x00,0xa5,0x9c,0x08,0x23,0x0f,0x90,0x9c,0x01,0x02,0xb5,0x00,0x24,0x06,
-0xf1,0x8f,0x00,0x23,0x6f,0x10,0x8f,0x00,0x62,0x06,0xf9,0x89,0x70,0x1f,0x70,0x11,
-0x09,0x33,0xec,0x01,0xf7,0x26,0x00,0x00,0xa7,0x02,0x30,0x01,0x36,0x20,0x64,0x1a,
-0x51,0xff,0xee,0xef,0xff,0xf6,0xfe,0x07,0x6e,0x89,0x88,0x86,0x41,0x00,0x7f,0x7c,
-0x00,0x01,0x45,0x11,0x63,0x68,0x88,0x88,0x88,0x89,0x80,0xb2,0x11,0x3c,0xfe,0xff,
-0x30,0xf8,0x0b,0x02,0x8d,0x03,0x10,0xad,0x73,0x09,0x10,0xf2,0x36,0x06,0x53,0xd9,
-0x99,0x99,0x99,0x97,0x8c,0x03,0x03,0xe0,0x08,0x05,0x3f,0x07,0x32,0xef,0xfe,0xef,
-0xdc,0x02,0x20,0x02,0x78,0x89,0x0c,0x05,0xe6,0x08,0x13,0x24,0xe5,0x04,0x02,0x44,
-0x01,0x14,0x90,0xd6,0x04,0x02,0xc3,0x1d,0x05,0x6a,0x01,0x14,0x7f,0x6a,0x01,0x43,
-0x07,0xf6,0x55,0x40,0xee,0x00,0x23,0xff,0xfe,0xdb,0x00,0x33,0xf2,0x22,0x00,0xee,
-0x00,0x01,0x8c,0x0f,0x30,0x01,0x25,0x72,0x4f,0x02,0x10,0x1f,0xb4,0x00,0x10,0x50,
-0x39,0x00,0x47,0x46,0x76,0x66,0x42,0x29,0x20,0x19,0x4b,0x5b,0x01,0x10,0x0d,0xd3,
-0x04,0x11,0xfd,0x55,0x1d,0x54,0x87,0x77,0x77,0x7b,0xf1,0x20,0x0e,0x23,0x7f,0x10,
-0xde,0x0a,0x11,0x07,0x09,0x4f,0x04,0x13,0x00,0x15,0x02,0x13,0x00,0x51,0x1f,0x92,
-0x22,0x22,0x23,0x1f,0x19,0x14,0xef,0x5e,0x03,0x01,0x08,0x2e,0x07,0x43,0x0b,0x21,
-0x50,0x11,0xd9,0x0d,0x31,0x03,0xf4,0xcb,0xf4,0x09,0x31,0x04,0xf3,0xdb,0x08,0x00,
-0x15,0x03,0x08,0x00,0x13,0xeb,0x08,0x00,0x11,0xea,0xff,0x1f,0x0b,0x08,0x00,0x42,
-0xb5,0x58,0xf3,0xea,0x7c,0x01,0x05,0x18,0x00,0x13,0xfa,0x08,0x00,0x1b,0xf9,0x08,
-0x00,0x40,0xfa,0x11,0x24,0x67,0x08,0x00,0x00,0x3f,0x28,0x00,0x08,0x00,0x30,0x03,
-0x33,0x20,0x18,0x00,0x02,0xa3,0x3d,0x0c,0x08,0x00,0x1a,0x90,0x08,0x00,0x4a,0x08,
-0x40,0x02,0xf3,0x45,0x0d,0x22,0x30,0x13,0xa1,0x0f,0x12,0x9f,0xe2,0x0b,0x03,0x07,
-0x00,0x1f,0xaf,0x07,0x00,0x04,0x50,0x38,0x88,0x88,0xf7,0xae,0x4e,0x28,0x22,0xee,
-0xf7,0xe2,0x1a,0x0b,0x07,0x00,0x1a,0xbe,0x07,0x00,0xf5,0x02,0x22,0x34,0x68,0xb3,
-0x00,0xf7,0x9f,0xff,0xff,0xfe,0xc3,0x00,0xf7,0x02,0x32,0x21,0x00,0x12,0x10,0x0e,
-0x07,0x00,0x06,0x60,0x0c,0x12,0xd5,0x07,0x00,0x23,0x55,0x05,0x91,0x16,0x12,0xaf,
-0x2c,0x18,0x22,0x09,0xf0,0x0f,0x00,0x20,0xae,0x00,0xb8,0x12,0x31,0xbd,0x0a,0xe0,
-0x1c,0x04,0x21,0xd0,0xbe,0xc5,0x05,0x32,0xcd,0x0b,0xd0,0x1e,0x00,0x12,0xbd,0x34,
-0x0e,0xd3,0x0b,0xf7,0x66,0x78,0xad,0xc0,0x0b,0xc0,0x7f,0xff,0xff,0xec,0x95,0x78,
-0x18,0x07,0xe0,0x09,0x72,0x01,0x56,0x66,0x66,0x66,0x7a,0x40,0x17,0x09,0x10,0xfa,
-0xda,0x12,0x44,0x11,0x10,0x0e,0xb0,0x2a,0x27,0x02,0xdd,0x09,0x11,0x90,0x21,0x1b,
-0x25,0x77,0x71,0xd4,0x09,0x23,0x9f,0x20,0x92,0x04,0x02,0xdb,0x09,0x01,0x1d,0x1b,
-0x13,0x64,0x51,0x00,0x32,0x46,0x05,0xa0,0x99,0x08,0x12,0xaf,0xff,0x1b,0x22,0x09,
-0xf0,0x0f,0x00,0x02,0xad,0x00,0x13,0xbe,0xad,0x00,0x12,0xe0,0xad,0x00,0x32,0xbe,
-0x0b,0xd0,0x1e,0x00,0xf6,0x07,0xbd,0x00,0x00,0x02,0x43,0x00,0xad,0x0b,0xfd,0xdd,
-0xdf,0xff,0xd0,0x0a,0xd0,0x39,0xa9,0x98,0x75,0x30,0x00,0xbc,0xba,0x13,0xca,0x2b,
-0xa8,0x66,0x50,0x33,0x00,0x00,0x01,0x9b,0xde,0xed,0x20,0xe9,0x0e,0x20,0xee,0xe6,
-0x27,0x06,0x03,0xf4,0x17,0x01,0x7a,0x25,0xe1,0x02,0xae,0xff,0xff,0xfb,0x30,0x00,
-0x00,0xee,0x63,0x22,0x36,0xcf,0x20,0xb1,0x12,0x10,0x03,0x8a,0x3e,0x50,0xa7,0x55,
-0x69,0xef,0x20,0x58,0x1b,0x2c,0xff,0xd9,0x38,0x0f,0x20,0x41,0x11,0x1d,0x07,0x41,
-0xe0,0x00,0xf6,0xca,0x80,0x03,0x32,0x01,0xf6,0xdb,0x88,0x03,0x05,0x08,0x00,0x1e,
-0xea,0x08,0x00,0x21,0x11,0x18,0x08,0x00,0x10,0x0e,0x78,0x0b,0x61,0xf6,0xe9,0x00,
-0x03,0x54,0x49,0x08,0x00,0x02,0x20,0x00,0x0f,0x08,0x00,0x05,0x40,0xfa,0x23,0x46,
-0x88,0x08,0x00,0x00,0xb3,0x02,0x00,0x08,0x00,0x21,0x03,0x33,0x1e,0x13,0x01,0x2c,
-0x0e,0x07,0x08,0x00,0x1f,0xf7,0x08,0x00,0x01,0x26,0x03,0x90,0x93,0x0f,0x05,0x1c,
-0x02,0x07,0xd8,0x11,0x2f,0x01,0xf7,0x13,0x00,0x12,0x19,0xf6,0x1d,0x1b,0x02,0xca,
-0x50,0x04,0xcb,0x03,0x10,0x05,0xca,0x01,0x12,0x53,0x1f,0x00,0x2c,0x33,0x00,0x6a,
-0x11,0x2e,0x00,0xcc,0x13,0x00,0x11,0xdb,0xa2,0x00,0x00,0x4e,0x04,0x01,0x51,0x0d,
-0x10,0x38,0x73,0x10,0x1b,0x78,0x0b,0x10,0x1d,0xd6,0x65,0x10,0x05,0x09,0x00,0x1c,
-0xf7,0x09,0x00,0x61,0x01,0xfa,0x44,0x33,0x33,0x45,0xc9,0x38,0x04,0xa2,0x0d,0x34,
-0x13,0x33,0x9f,0xbe,0x07,0x18,0x7f,0x38,0x06,0x24,0x10,0x5f,0xac,0x15,0x22,0x17,
-0x66,0x01,0x00,0x18,0x64,0x82,0x11,0x00,0x01,0x00,0x12,0x30,0x2b,0x29,0x02,0xd9,
-0x2f,0x00,0x11,0x00,0x22,0x32,0x10,0xf0,0x05,0x23,0x04,0xf1,0x5a,0x01,0x02,0xde,
-0x20,0x13,0x08,0x09,0x00,0x74,0x01,0x28,0xf2,0x22,0x26,0xf5,0x42,0x86,0x29,0x12,
-0xfe,0xac,0x25,0x37,0x33,0x22,0x10,0x54,0x2f,0x1e,0x06,0x3b,0x0f,0x0e,0x09,0x00,
-0x0d,0xbe,0x07,0x73,0x08,0xf7,0x66,0x66,0x66,0x78,0x50,0x96,0x08,0x00,0x5a,0x2a,
-0x0f,0x01,0x00,0x07,0xfe,0x03,0x8e,0xee,0xed,0xdd,0xdd,0xde,0xee,0xff,0xfd,0x37,
-0x88,0x88,0x88,0xcf,0x77,0x77,0x66,0x63,0x46,0x0a,0x0f,0x09,0x00,0x0c,0x05,0x34,
-0x12,0x1b,0x8c,0x5c,0x00,0x1f,0x20,0x7a,0x01,0x07,0x1c,0xf7,0x22,0x02,0x23,0x02,
-0xf7,0xeb,0x08,0x15,0x01,0x8c,0x01,0x67,0x46,0x66,0x66,0x65,0x54,0x20,0xa3,0x07,
-0x00,0x42,0x2d,0x52,0x55,0x56,0x66,0x75,0x6e,0x01,0x02,0x2e,0xee,0xea,0x03,0x0b,
-0x00,0x7b,0x10,0x14,0xcf,0x7b,0x10,0x16,0xee,0x7b,0x10,0x18,0x08,0x09,0x00,0x07,
-0x7b,0x10,0x00,0xb1,0x13,0x1f,0x30,0x7b,0x10,0x03,0x00,0x1a,0x10,0x13,0xfc,0xa3,
-0x07,0x27,0x77,0x62,0x1a,0x1b,0x0e,0x69,0x17,0x0f,0x9e,0x01,0x08,0x0f,0x95,0x01,
-0x05,0x1f,0x90,0x95,0x01,0x09,0x10,0x7e,0x08,0x0c,0x00,0xfa,0x10,0x91,0x37,0x88,
-0x8f,0xb8,0x87,0x7a,0xf7,0x66,0x62,0x31,0x0e,0x02,0x0e,0x02,0x0f,0x09,0x00,0x1a,
-0x20,0x0e,0x40,0x6b,0x04,0x0e,0x21,0x03,0x08,0x83,0x01,0x0f,0x09,0x00,0x11,0x18,
-0xf6,0x6a,0x12,0x19,0x01,0xc8,0x03,0x7f,0x57,0x77,0x77,0x76,0x65,0x30,0x00,0x01,
-0x00,0x11,0x00,0xe8,0x18,0x01,0xf8,0x0b,0x2e,0x6f,0xff,0x9e,0x1d,0x1e,0xb6,0xba,
-0x03,0x0f,0xc3,0x03,0x0e,0x00,0xba,0x03,0x03,0xcd,0x18,0x45,0x47,0x77,0x77,0x77,
-0x3f,0x30,0x09,0xda,0x09,0x13,0x77,0xda,0x11,0x0f,0xff,0x0b,0x09,0x05,0xa1,0x07,
-0x24,0x03,0xf5,0x83,0x09,0x0e,0x09,0x00,0x0a,0x8d,0x15,0x10,0x71,0xd0,0x18,0x05,
-0x8b,0x2b,0x0d,0x01,0x00,0x1f,0xd6,0x80,0x04,0x10,0x06,0x89,0x04,0x45,0x55,0x55,
-0x55,0x67,0x2a,0x46,0x1f,0xc0,0x53,0x13,0x01,0x00,0xda,0x1b,0x00,0x29,0x10,0x05,
-0x35,0x14,0x10,0x02,0xe6,0x15,0x00,0x43,0x07,0x09,0x62,0x01,0x23,0x67,0x53,0x40,
-0x31,0x02,0x53,0x28,0x51,0x00,0x6f,0xb3,0x00,0x03,0x54,0x48,0x14,0xed,0xbf,0x2a,
-0x14,0xf8,0x96,0x02,0x12,0xfa,0x0e,0x28,0x02,0x0d,0x53,0x01,0xca,0x27,0x42,0x1d,
-0xfb,0x87,0x8c,0x1a,0x33,0x45,0x6a,0xcd,0xca,0x50,0x64,0x09,0x11,0x13,0x22,0x01,
-0x12,0xf5,0xa6,0x08,0x03,0x07,0x00,0x18,0xf6,0x07,0x00,0x32,0x00,0xf6,0x9e,0xd9,
-0x00,0x1e,0x9e,0x9f,0x08,0x04,0x07,0x00,0x13,0xf6,0x07,0x00,0x12,0xad,0x07,0x00,
-0x12,0xbd,0x3f,0x00,0x70,0xbe,0x32,0x34,0x68,0xb6,0x01,0xf6,0xad,0x08,0x65,0xc5,
-0x01,0xf6,0x03,0x33,0x32,0x6c,0x02,0x0f,0x07,0x00,0x09,0x29,0x00,0xf5,0x1c,0x01,
-0x22,0x32,0x25,0x99,0x33,0x12,0x9f,0x26,0x06,0x12,0x9f,0xa5,0x25,0x18,0xae,0x07,
-0x00,0x22,0xcc,0xae,0x23,0x00,0x0a,0x07,0x00,0xf2,0x06,0xbe,0x00,0x00,0x01,0x44,
-0x00,0xcb,0xaf,0xed,0xde,0xff,0xfd,0x00,0xcb,0x29,0x99,0x99,0x76,0x30,0x00,0xca,
-0x54,0x00,0x1b,0xca,0x81,0x27,0x03,0x80,0x27,0x01,0x67,0x27,0x14,0xea,0x6e,0x27,
-0x0b,0x07,0x00,0x02,0x7b,0x27,0x03,0x9f,0x2d,0x08,0x79,0x27,0x3e,0x32,0x24,0x00,
-0xa1,0x00,0x2f,0xdb,0xae,0x07,0x00,0x01,0x12,0xbe,0x2a,0x00,0x12,0xbd,0x85,0x00,
-0x81,0xbe,0x00,0x00,0x24,0x76,0x00,0xca,0xaf,0x30,0x09,0x21,0xca,0x16,0x30,0x07,
-0x03,0x9a,0x00,0x14,0x64,0x7c,0x12,0x01,0xa8,0x06,0x11,0xd8,0xff,0x04,0x00,0x85,
-0x00,0x54,0x22,0x11,0x11,0x12,0xe9,0x7a,0x12,0x10,0x8f,0x82,0x1d,0x14,0xe8,0x97,
-0x12,0x03,0x07,0x00,0x12,0x7f,0xa1,0x00,0x10,0x04,0x4f,0x02,0x16,0x40,0x23,0x0c,
-0x05,0xa7,0x31,0x51,0x4e,0xee,0xee,0xee,0xb0,0xbf,0x10,0x41,0xf9,0x89,0x88,0x74,
-0xd9,0x0d,0x29,0x7f,0x10,0x73,0x0f,0x0f,0x13,0x00,0x01,0x14,0xf0,0x13,0x00,0x33,
+0x16,0xa0,0x69,0x01,0x88,0x78,0x88,0x88,0x88,0xac,0x50,0x00,0x08,0xdd,0x01,0x25,
+0x0e,0xa0,0x08,0x00,0x22,0x06,0xef,0x81,0x03,0x75,0x09,0xf9,0x88,0x88,0x88,0x87,
+0x10,0xb3,0x08,0x04,0x3a,0x02,0x31,0x08,0xff,0xee,0xf6,0x03,0x00,0x2f,0x02,0x33,
+0x76,0x66,0x50,0x8d,0x02,0x91,0x30,0x00,0x00,0x01,0x10,0x00,0x00,0xea,0x4f,0xe4,
+0x05,0x92,0x0e,0xa1,0x55,0x54,0x44,0xdd,0x00,0x00,0xea,0x4e,0x01,0x00,0x5e,0x00,
+0x22,0x06,0xf5,0x0f,0x00,0x12,0xde,0x6d,0x00,0x20,0xaf,0x50,0x26,0x08,0x31,0x00,
+0x6f,0x90,0xb4,0x05,0x20,0x7f,0xb0,0x35,0x08,0x30,0x01,0xaf,0x90,0xc3,0x05,0x31,
+0xa5,0xee,0x50,0xcf,0x0c,0x12,0x87,0xba,0x01,0x30,0x40,0x00,0x13,0x08,0x00,0x12,
+0x21,0x61,0x06,0x22,0x0e,0x70,0x48,0x05,0xb0,0xe8,0x00,0x08,0xf2,0x11,0x11,0x11,
+0x2e,0x80,0x00,0x8f,0xaf,0x00,0xb1,0xf8,0x00,0x08,0xf6,0x66,0x66,0x55,0x5f,0x70,
+0x00,0x7f,0x95,0x07,0x01,0x2d,0x00,0x00,0x97,0x02,0x10,0x7f,0x1e,0x00,0x84,0xf5,
+0x00,0x00,0x45,0x55,0x55,0x55,0x54,0x03,0x01,0x18,0x73,0x21,0x0c,0x60,0x2e,0xff,
+0xf9,0x6f,0xff,0xd1,0x0a,0x00,0x62,0x06,0x66,0xec,0x27,0x7a,0xf3,0x4a,0x06,0x10,
+0xf9,0x40,0x03,0x12,0xf9,0xf7,0x03,0x40,0x0a,0xf0,0x00,0xe9,0xa4,0x01,0x61,0xf3,
+0x00,0x0d,0xd0,0x00,0xea,0xc6,0x09,0x00,0x0d,0x03,0x12,0xea,0x70,0x06,0x60,0x4f,
+0x50,0x00,0xeb,0x44,0x40,0x6a,0x07,0xa0,0x8f,0x20,0x00,0xef,0xff,0xf7,0x00,0x9f,
+0x10,0x00,0xfb,0x00,0xa1,0x33,0x20,0x00,0xe9,0x00,0x03,0xf8,0x00,0x00,0xe9,0x25,
+0x0a,0x21,0x09,0xf1,0x0a,0x00,0x50,0x1f,0x90,0x00,0x1f,0xa0,0xac,0x0d,0x30,0x00,
+0x9e,0x10,0x31,0x00,0x00,0x0a,0x00,0x41,0x33,0x00,0x03,0xf9,0xc0,0x0d,0x00,0x7f,
+0x09,0x14,0xe0,0x0a,0x00,0x21,0x02,0x10,0x49,0x09,0x04,0x01,0x00,0x0f,0x0a,0x00,
+0x0b,0x1f,0xc9,0x52,0x03,0x01,0x05,0x36,0x09,0xe1,0x1b,0xcc,0xc8,0x4c,0xcc,0x90,
+0x00,0x7f,0x00,0x89,0x9e,0xd3,0xa9,0xdf,0x1c,0x01,0x10,0xea,0xd6,0x00,0x11,0x7f,
+0x45,0x08,0x40,0xcd,0x00,0x07,0xf0,0x05,0x07,0x20,0x0f,0xa0,0x11,0x00,0x30,0x7f,
+0x10,0x02,0x3e,0x01,0x00,0x98,0x07,0x40,0x6f,0x4c,0xdd,0xef,0x1b,0x05,0x50,0x0a,
+0xf0,0x8a,0xac,0xf0,0xb9,0x05,0x10,0xeb,0x8b,0x09,0x20,0x0d,0xb0,0x81,0x02,0x70,
+0x06,0xf1,0x05,0xf4,0x00,0x0b,0xf0,0xdf,0x06,0xf2,0x06,0xec,0x00,0x02,0xf9,0x00,
+0x00,0x06,0xf1,0x7f,0x20,0x00,0xaf,0x10,0x00,0x00,0x6f,0x04,0x50,0x00,0x3f,0x80,
+0xad,0x09,0x23,0x0c,0xd0,0xbe,0x09,0x00,0x75,0x0b,0x02,0x02,0x0a,0x0b,0xcf,0x09,
+0x01,0x01,0x00,0x14,0x7f,0x9c,0x08,0xf3,0x0c,0xd0,0x00,0x03,0x44,0x45,0x10,0x45,
+0x56,0x50,0x00,0x00,0x9f,0xff,0xff,0x86,0xff,0xff,0xf3,0x00,0x00,0x02,0x22,0x3f,
+0x70,0x01,0x15,0xf4,0x87,0x09,0x21,0x05,0xf3,0x31,0x00,0x13,0x10,0x3f,0x06,0x14,
+0xae,0xf1,0x04,0x23,0xe9,0x00,0xcc,0x03,0x13,0xf5,0x50,0x09,0x23,0x08,0xf0,0x23,
+0x0c,0x6f,0x06,0x60,0x00,0x00,0x06,0x50,0xc5,0x0c,0x08,0x1f,0x64,0xc5,0x0c,0x39,
+0x50,0x00,0x00,0x00,0x00,0x00,0xf0,0x0c,0x00,0x15,0x66,0x66,0x01,0x67,0x78,0x70,
+0x00,0x00,0x08,0xff,0xff,0xf7,0x5f,0xff,0xff,0x50,0x00,0x00,0x00,0x00,0x3f,0x60,
+0x00,0x03,0xf5,0x09,0x00,0x60,0x05,0xf4,0x00,0x00,0x4f,0x40,0x0a,0x00,0x50,0x8f,
+0x10,0x00,0x05,0xf3,0x09,0x00,0x60,0x0b,0xe0,0x00,0x00,0x6f,0x20,0x0a,0x00,0x53,
+0xfa,0x00,0x00,0x07,0xf1,0x2f,0x00,0x20,0x00,0x9f,0x09,0x00,0x60,0x08,0xf1,0x00,
+0x00,0x0a,0xe0,0x0a,0x00,0x54,0xdc,0x00,0x00,0x00,0xbc,0x1c,0x00,0x20,0x0c,0xa0,
+0x4b,0x00,0x6f,0xc0,0x00,0x00,0x00,0xa6,0x00,0x01,0x00,0x01,0x40,0x03,0x33,0x33,
+0x44,0x01,0x00,0x33,0x43,0x08,0xff,0x01,0x00,0xf1,0x0c,0xf0,0x03,0x33,0x22,0x22,
+0x22,0x22,0x33,0x33,0x31,0x00,0x00,0x26,0x77,0x77,0x31,0x78,0x89,0x70,0x00,0x00,
+0x8f,0xff,0xff,0x93,0xde,0xef,0x85,0x00,0x22,0x1f,0x70,0x8e,0x00,0x00,0x9d,0x00,
+0x20,0x06,0xf2,0x09,0x00,0x14,0x9e,0x8d,0x00,0xe0,0xe9,0x00,0x00,0x09,0xf0,0x00,
+0x00,0x00,0x06,0xf3,0x00,0x00,0x0a,0xc0,0x95,0x00,0x56,0xa0,0x00,0x00,0x07,0x60,
+0x6e,0x00,0x22,0x17,0x77,0x01,0x00,0x23,0x85,0x5e,0x6d,0x00,0x2e,0xfc,0x00,0x01,
+0x00,0xa1,0x01,0x66,0x66,0x66,0x67,0x77,0x50,0x00,0x00,0x07,0x23,0x00,0x62,0xf1,
+0x00,0x00,0x08,0xf2,0x00,0x63,0x00,0x20,0x08,0xf1,0x5e,0x00,0x0f,0x09,0x00,0x03,
+0x91,0xf4,0x21,0x11,0x22,0x38,0xf1,0x00,0x00,0x05,0x36,0x00,0x94,0xd0,0x00,0x00,
+0x00,0x24,0x44,0x44,0x33,0x22,0x56,0x00,0xf3,0x05,0x11,0x00,0x00,0x00,0x7f,0xff,
+0xff,0x83,0xff,0xff,0xf2,0x00,0x00,0x37,0x66,0x7f,0x90,0x55,0x59,0xf4,0x25,0x01,
+0x02,0xcf,0x00,0x23,0x7f,0x10,0xcf,0x00,0x40,0xdb,0x00,0x00,0x07,0xc6,0x00,0x50,
+0x04,0xf5,0x00,0x00,0x09,0x52,0x01,0x60,0x09,0xd0,0x00,0x00,0x0a,0xb0,0x9a,0x00,
+0x90,0x10,0x00,0x00,0x02,0x10,0x00,0x16,0x66,0x55,0x01,0x00,0x23,0x66,0x65,0xc6,
+0x00,0x2f,0xfe,0xec,0x5a,0x01,0x01,0x00,0xc5,0x00,0x00,0xdd,0x01,0x11,0x06,0x24,
+0x00,0x12,0xd1,0xa6,0x00,0x01,0x01,0x00,0x23,0x06,0xf0,0x09,0x00,0xf3,0x01,0x07,
+0xfe,0xef,0xff,0xff,0xff,0xe0,0x00,0x00,0x07,0xf8,0x88,0x88,0x88,0x88,0x70,0x79,
+0x00,0x01,0xcf,0x01,0x05,0x24,0x00,0x01,0x3f,0x00,0xa3,0xf6,0x00,0x00,0x01,0x67,
+0x77,0x88,0x77,0x76,0x61,0x17,0x00,0x14,0x02,0x67,0x00,0x00,0x9d,0x00,0x23,0x0e,
+0x80,0x87,0x01,0x42,0x00,0xf9,0x00,0x00,0xb5,0x00,0x2a,0x0f,0x90,0x13,0x00,0x14,
+0xf0,0x13,0x00,0x14,0x9f,0x13,0x00,0x10,0x08,0x13,0x00,0x11,0x80,0x60,0x02,0x61,
+0x87,0x86,0x00,0xf8,0x00,0x00,0x88,0x02,0x13,0xd0,0x13,0x00,0x4b,0x00,0x00,0x00,
+0xf8,0x26,0x00,0x09,0x13,0x00,0x50,0xa3,0x34,0x57,0x9b,0x20,0x13,0x00,0x50,0xef,
+0xff,0xff,0xfd,0xa1,0x13,0x00,0x42,0x01,0x33,0x32,0x10,0x26,0x00,0x0a,0xc1,0x00,
+0x0f,0x13,0x00,0x0a,0x2e,0x06,0xe0,0x39,0x01,0x63,0x27,0x00,0x00,0x00,0xa5,0x00,
+0xf2,0x01,0x23,0x0f,0x90,0x9c,0x01,0x02,0xb5,0x00,0x24,0x06,0xf1,0x8f,0x00,0x23,
+0x6f,0x10,0x8f,0x00,0x61,0x06,0xf9,0x89,0x70,0x1f,0x70,0x13,0x00,0x43,0xee,0xec,
+0x01,0xf7,0x26,0x00,0x00,0xa7,0x02,0xc0,0x01,0x36,0x20,0x6f,0x10,0x00,0x01,0xff,
+0xee,0xef,0xff,0xf6,0x59,0x01,0x7e,0x05,0x89,0x88,0x86,0x41,0x00,0x7f,0x7c,0x00,
+0x10,0x01,0x05,0x00,0x50,0x68,0x88,0x88,0x88,0x89,0x5b,0x00,0x10,0x0e,0xd3,0x01,
+0x23,0xff,0x30,0x1c,0x00,0x24,0x04,0xf4,0x26,0x00,0x01,0x8d,0x03,0x50,0xad,0xee,
+0xee,0xee,0xee,0x27,0x02,0x63,0x0f,0xd9,0x99,0x99,0x99,0x97,0x8c,0x03,0x02,0x01,
+0x00,0x24,0x0f,0xa0,0x0a,0x00,0x32,0xef,0xfe,0xef,0xdc,0x02,0x74,0x02,0x78,0x77,
+0x77,0x66,0x66,0x20,0x18,0x00,0x55,0x24,0x00,0x00,0x00,0x42,0x44,0x01,0x02,0xdb,
+0x00,0x04,0x90,0x01,0x15,0x07,0x6a,0x01,0x14,0x7f,0x6a,0x01,0x43,0x07,0xf6,0x55,
+0x40,0xee,0x00,0x23,0xff,0xfe,0xdb,0x00,0x33,0xf2,0x22,0x00,0xee,0x00,0x80,0x00,
+0x00,0x01,0xf8,0x00,0x01,0x25,0x72,0x4f,0x02,0x10,0x1f,0xb4,0x00,0x10,0x50,0x39,
+0x00,0x46,0x46,0x76,0x66,0x42,0x47,0x02,0x29,0x00,0x4b,0x5b,0x01,0x60,0x0d,0xee,
+0xee,0xef,0xff,0xfd,0xf2,0x00,0x62,0xfb,0x87,0x77,0x77,0x7b,0xf1,0xcf,0x03,0x02,
+0x60,0x01,0x01,0x60,0x00,0x01,0xc8,0x03,0x14,0x2f,0x13,0x00,0x15,0x02,0x13,0x00,
+0x72,0x1f,0x92,0x22,0x22,0x23,0x9f,0x10,0xf0,0x01,0x02,0x5e,0x03,0x66,0x00,0x22,
+0x22,0x22,0x21,0x10,0x5c,0x00,0x20,0x50,0x11,0x61,0x00,0x50,0x70,0x03,0xf4,0xcb,
+0x00,0xc9,0x00,0x31,0x04,0xf3,0xdb,0x08,0x00,0x15,0x03,0x08,0x00,0x13,0xeb,0x08,
+0x00,0x10,0xea,0x64,0x01,0x0c,0x08,0x00,0x42,0xb5,0x58,0xf3,0xea,0x7c,0x01,0x05,
+0x18,0x00,0x13,0xfa,0x08,0x00,0x1b,0xf9,0x08,0x00,0x40,0xfa,0x11,0x24,0x67,0x08,
+0x00,0x40,0xcf,0xff,0xff,0xd9,0x08,0x00,0x30,0x03,0x33,0x20,0x18,0x00,0x01,0xa8,
+0x01,0x0d,0x08,0x00,0x1a,0x90,0x08,0x00,0x43,0x08,0x40,0x02,0xf3,0xb0,0x00,0x03,
+0xbb,0x00,0x21,0x30,0x13,0x07,0x00,0x21,0xf7,0x9f,0x09,0x02,0x04,0x07,0x00,0x1f,
+0xaf,0x07,0x00,0x04,0xc2,0x38,0x88,0x88,0xf7,0xae,0x00,0x00,0x7e,0xff,0xee,0xf7,
+0xae,0x38,0x00,0x0a,0x07,0x00,0x1a,0xbe,0x07,0x00,0xf0,0x01,0x22,0x34,0x68,0xb3,
+0x00,0xf7,0x9f,0xff,0xff,0xfe,0xc3,0x00,0xf7,0x02,0x32,0x21,0x15,0x00,0x02,0x77,
+0x00,0x0f,0x07,0x00,0x01,0x13,0x01,0x0e,0x00,0x12,0xd5,0x07,0x00,0x31,0x55,0x05,
+0xa0,0xf5,0x05,0x21,0xd0,0xaf,0x0f,0x00,0x32,0xbd,0x09,0xf0,0x0f,0x00,0x91,0xae,
+0x00,0x00,0x02,0x22,0x22,0xbd,0x0a,0xe0,0x1c,0x04,0x21,0xd0,0xbe,0xc5,0x05,0x32,
+0xcd,0x0b,0xd0,0x1e,0x00,0x11,0xbd,0x2d,0x00,0xf2,0x01,0xbc,0x0b,0xf7,0x66,0x78,
+0xad,0xc0,0x0b,0xc0,0x7f,0xff,0xff,0xec,0x95,0x00,0xcb,0x52,0x00,0x25,0x0b,0xa0,
+0xf2,0x02,0x80,0x56,0x66,0x66,0x66,0x7a,0x40,0x00,0x8f,0xce,0x01,0x92,0xfa,0x00,
+0x00,0x11,0x11,0x11,0x10,0x0e,0xb0,0x1c,0x00,0x31,0xeb,0x00,0x06,0xe5,0x01,0xa3,
+0x90,0x00,0x9f,0x98,0x88,0x88,0x77,0x71,0x00,0x09,0xb9,0x04,0x23,0x9f,0x20,0x92,
+0x04,0x20,0xee,0xff,0x46,0x05,0x63,0x06,0x77,0x77,0x77,0x66,0x64,0x51,0x00,0x12,
+0x46,0xad,0x00,0x22,0x0a,0xe0,0xad,0x00,0x32,0xae,0x09,0xf0,0x0f,0x00,0x02,0xad,
+0x00,0x13,0xbe,0xad,0x00,0x12,0xe0,0xad,0x00,0x32,0xbe,0x0b,0xd0,0x1e,0x00,0xf3,
+0x07,0xbd,0x00,0x00,0x02,0x43,0x00,0xad,0x0b,0xfd,0xdd,0xdf,0xff,0xd0,0x0a,0xd0,
+0x39,0xa9,0x98,0x75,0x30,0x00,0xbc,0xad,0x00,0xe5,0xc0,0x00,0x00,0x2b,0xa8,0x66,
+0x50,0x33,0x00,0x00,0x01,0x9b,0xde,0xed,0x44,0x03,0x11,0x00,0x76,0x05,0x20,0xee,
+0xe6,0x27,0x06,0x11,0x66,0x5c,0x03,0x30,0x01,0x22,0x10,0x6b,0x03,0xfb,0x14,0xae,
+0xff,0xff,0xfb,0x30,0x00,0x00,0xee,0x63,0x22,0x36,0xcf,0x20,0x00,0x1f,0x80,0x00,
+0x00,0x03,0xf6,0x00,0x00,0xcf,0xa7,0x55,0x69,0xef,0x20,0x00,0x00,0x7c,0xff,0xff,
+0xd9,0x10,0x6a,0x04,0x20,0x41,0x11,0x1d,0x07,0x41,0xe0,0x00,0xf6,0xca,0x80,0x03,
+0x32,0x01,0xf6,0xdb,0x88,0x03,0x05,0x08,0x00,0x1e,0xea,0x08,0x00,0x20,0x11,0x18,
+0x08,0x00,0x00,0xa9,0x02,0x81,0xf0,0x00,0xf6,0xe9,0x00,0x03,0x54,0x49,0x08,0x00,
+0x02,0x20,0x00,0x0f,0x08,0x00,0x05,0x40,0xfa,0x23,0x46,0x88,0x08,0x00,0x00,0xb3,
+0x02,0x00,0x08,0x00,0x00,0xb3,0x02,0x00,0x08,0x00,0x03,0xf8,0x03,0x04,0x08,0x00,
+0x1f,0xf7,0x08,0x00,0x01,0x22,0x03,0x90,0x20,0x00,0x09,0x1c,0x02,0x03,0xb8,0x03,
+0x08,0x36,0x02,0x0f,0x13,0x00,0x0c,0x05,0x44,0x00,0x23,0x2f,0x60,0xfd,0x02,0x15,
+0x01,0x29,0x07,0x10,0x05,0xca,0x01,0x12,0x53,0x1f,0x00,0x14,0x33,0x28,0x00,0x24,
+0x0c,0xb0,0x0a,0x00,0x1e,0xcc,0x13,0x00,0x11,0xdb,0xa2,0x00,0x00,0x4e,0x04,0x10,
+0xff,0xd7,0x01,0x98,0x38,0x88,0x87,0x77,0x77,0x78,0x88,0x88,0x86,0x5e,0x01,0x14,
+0xd6,0x09,0x00,0x1d,0xf8,0x09,0x00,0x1c,0xf7,0x09,0x00,0x60,0x01,0xfa,0x44,0x33,
+0x33,0x45,0x74,0x05,0x01,0x51,0x00,0x00,0x9a,0x05,0x34,0x13,0x33,0x9f,0xbe,0x07,
+0x18,0x7f,0x38,0x06,0x33,0x10,0x5f,0xff,0x77,0x07,0x22,0x17,0x66,0x01,0x00,0x17,
+0x64,0x3c,0x08,0x10,0x33,0x01,0x00,0x41,0x30,0x00,0x00,0x09,0x23,0x00,0x00,0xf4,
+0x03,0x00,0x11,0x00,0x22,0x32,0x10,0xf0,0x05,0x23,0x04,0xf1,0x5a,0x01,0x23,0x04,
+0xf2,0x86,0x05,0x01,0x09,0x00,0xa2,0x01,0x28,0xf2,0x22,0x26,0xf5,0x42,0x00,0x00,
+0x0d,0x59,0x00,0x30,0x00,0x00,0x02,0x36,0x00,0x01,0x57,0x02,0x14,0x40,0x2e,0x06,
+0x14,0xf1,0x91,0x07,0x0f,0x09,0x00,0x08,0x0d,0xbe,0x07,0x73,0x08,0xf7,0x66,0x66,
+0x66,0x78,0x50,0x96,0x08,0x3f,0xee,0xa0,0x00,0x01,0x00,0x08,0xf4,0x03,0x8e,0xee,
+0xed,0xdd,0xdd,0xde,0xee,0xff,0xfd,0x37,0x88,0x88,0x88,0xcf,0x77,0x77,0x66,0x63,
+0xb0,0x07,0x1f,0x00,0x09,0x00,0x15,0x14,0x9e,0x09,0x00,0x1b,0x8c,0x5c,0x00,0x1f,
+0x20,0x7a,0x01,0x07,0x1c,0xf7,0x22,0x02,0x23,0x02,0xf7,0xeb,0x08,0x15,0x01,0x8c,
+0x01,0x67,0x46,0x66,0x66,0x65,0x54,0x20,0xa3,0x07,0x92,0x66,0x65,0x55,0x55,0x55,
+0x56,0x66,0x75,0x6e,0x01,0x02,0x29,0xee,0xea,0xd6,0x07,0x12,0x8f,0x3a,0x07,0x61,
+0x88,0x88,0xcf,0x99,0x9b,0xb0,0x28,0x02,0x44,0xee,0xdd,0xde,0xf1,0x13,0x01,0x08,
+0x09,0x00,0x02,0x6a,0x04,0xb5,0xf0,0x00,0x00,0x09,0xf8,0x77,0x66,0x66,0x66,0x30,
+0x00,0x6d,0x04,0x03,0x09,0x00,0x10,0x10,0x96,0x08,0x22,0xee,0xee,0x4e,0x07,0x00,
+0xa3,0x07,0x20,0x77,0x62,0x6c,0x06,0x04,0x95,0x01,0x1c,0xf2,0x09,0x00,0x0f,0x9e,
+0x01,0x08,0x0f,0x95,0x01,0x05,0x1f,0x90,0x95,0x01,0x09,0x40,0x7e,0xee,0xdd,0xdd,
+0x7f,0x00,0xe3,0xfb,0x37,0x88,0x8f,0xb8,0x87,0x7a,0xf7,0x66,0x62,0x00,0x00,0x0f,
+0x70,0x0e,0x02,0x0f,0x09,0x00,0x1a,0x20,0x0e,0x40,0x6b,0x04,0x0e,0x21,0x03,0x08,
+0x83,0x01,0x0f,0x09,0x00,0x11,0x05,0xa7,0x01,0x13,0xf6,0xba,0x08,0x06,0xc8,0x03,
+0x7f,0x57,0x77,0x77,0x76,0x65,0x30,0x00,0x01,0x00,0x11,0x32,0x03,0x44,0x44,0xf8,
+0x0b,0x14,0x6f,0x4e,0x03,0x22,0x03,0x22,0x01,0x00,0x4e,0x21,0x00,0x00,0xb6,0xba,
+0x03,0x0f,0xc3,0x03,0x0f,0x20,0x00,0xff,0x69,0x09,0x00,0x22,0x04,0x5f,0x47,0x77,
+0x77,0x77,0x76,0x87,0x00,0x01,0x13,0x27,0xff,0x0b,0x1f,0x75,0xff,0x0b,0x09,0x05,
+0xa1,0x07,0x24,0x03,0xf5,0x83,0x09,0x0e,0x09,0x00,0x14,0xf4,0x09,0x00,0x10,0xfa,
+0x2d,0x0c,0x41,0x71,0x00,0x00,0x01,0x49,0x02,0x07,0x29,0x05,0x0f,0x89,0x04,0x0a,
+0x0f,0x06,0x03,0x08,0x50,0xfa,0x55,0x55,0x55,0x67,0x60,0x02,0x10,0xdf,0x51,0x00,
+0x2e,0xc0,0x00,0x01,0x00,0x31,0x04,0x44,0x44,0x00,0x0c,0x14,0x54,0x89,0x04,0x41,
+0xfd,0x02,0x22,0x11,0x01,0x00,0x19,0x10,0x62,0x01,0x12,0x67,0x52,0x05,0x51,0x05,
+0xef,0xfe,0xff,0xe6,0xb1,0x09,0x40,0xb3,0x00,0x03,0xcf,0x5a,0x00,0x10,0xed,0x4b,
+0x05,0x13,0xd0,0x90,0x00,0x23,0x08,0xf0,0x43,0x0a,0x10,0x0a,0x09,0x00,0x50,0xaf,
+0x40,0x00,0x00,0x5f,0x26,0x04,0x51,0x1d,0xfb,0x87,0x8c,0xfc,0x50,0x00,0x45,0x6a,
+0xcd,0xca,0x50,0x64,0x09,0x11,0x13,0x22,0x01,0x12,0xf5,0xa6,0x08,0x03,0x07,0x00,
+0x18,0xf6,0x07,0x00,0x32,0x00,0xf6,0x9e,0xd9,0x00,0x1e,0x9e,0x9f,0x08,0x04,0x07,
+0x00,0x13,0xf6,0x07,0x00,0x12,0xad,0x07,0x00,0x12,0xbd,0x3f,0x00,0x70,0xbe,0x32,
+0x34,0x68,0xb6,0x01,0xf6,0xad,0x08,0x65,0xc5,0x01,0xf6,0x03,0x33,0x32,0x6c,0x02,
+0x0f,0x07,0x00,0x09,0x29,0x00,0xf5,0x1c,0x01,0x21,0x32,0x25,0x07,0x00,0x22,0xcb,
+0x9f,0x26,0x06,0x02,0x07,0x00,0x28,0xdc,0xae,0x07,0x00,0x22,0xcc,0xae,0x23,0x00,
+0x0a,0x07,0x00,0xf2,0x06,0xbe,0x00,0x00,0x01,0x44,0x00,0xcb,0xaf,0xed,0xde,0xff,
+0xfd,0x00,0xcb,0x29,0x99,0x99,0x76,0x30,0x00,0xca,0x54,0x00,0x18,0xca,0x3e,0x0e,
+0x40,0x78,0x82,0x00,0x7f,0x74,0x01,0x30,0xf9,0x00,0x8f,0x1e,0x01,0x12,0xea,0x07,
+0x00,0x1c,0xe9,0x07,0x00,0x72,0x42,0x22,0x22,0x33,0xf9,0x00,0x4f,0x14,0x02,0x60,
+0x01,0x22,0x22,0x22,0x21,0x00,0x11,0x00,0x01,0x00,0x21,0x32,0x24,0x07,0x00,0x21,
+0xcb,0x9f,0x07,0x00,0x13,0xdb,0x07,0x00,0x1f,0xae,0x07,0x00,0x01,0x12,0xbe,0x2a,
+0x00,0x11,0xbd,0x07,0x00,0xf2,0x07,0xca,0xbe,0x00,0x00,0x24,0x76,0x00,0xca,0xaf,
+0xff,0xff,0xff,0xfa,0x00,0xca,0x16,0x77,0x66,0x53,0x00,0x00,0xca,0x54,0x00,0x30,
+0x64,0x00,0x13,0x07,0x00,0x30,0x21,0x00,0x7f,0x07,0x00,0x30,0xd8,0x00,0x8f,0x07,
+0x00,0xf2,0x07,0xe9,0x00,0x8f,0x22,0x11,0x11,0x12,0xe9,0x00,0x8f,0xff,0xff,0xff,
+0xff,0xf8,0x00,0x8f,0x66,0x66,0x65,0x55,0xe8,0x1c,0x00,0x05,0x07,0x00,0x10,0x7f,
+0x1c,0x00,0x82,0xf6,0x00,0x04,0x55,0x55,0x55,0x55,0x40,0x4d,0x00,0x23,0x24,0x00,
+0x01,0x00,0xf0,0x0a,0x0a,0xd0,0x00,0x00,0x4e,0xee,0xee,0xee,0xb0,0x00,0xae,0x00,
+0x00,0x07,0xf9,0x89,0x88,0x74,0x00,0x09,0xe0,0x00,0x00,0x7f,0x10,0x1d,0x00,0x50,
+0x9e,0x00,0x00,0x07,0xf1,0x09,0x00,0x0f,0x13,0x00,0x01,0x14,0xf0,0x13,0x00,0x33,
 0x9f,0x44,0x43,0x13,0x00,0x33,0xff,0xff,0xf0,0x26,0x00,0x22,0x22,0x21,0x13,0x00,
-0x14,0x08,0x39,0x00,0x00,0x91,0x2b,0x07,0x13,0x00,0x63,0x21,0x01,0x23,0x57,0x10,
-0x8e,0x1c,0x05,0x11,0xe3,0x2d,0x2c,0x31,0x45,0x54,0x32,0x26,0x00,0x0a,0x8d,0x14,
-0x0f,0xd9,0x0d,0x0b,0x1e,0x07,0xd9,0x0d,0x00,0xcc,0x3c,0x11,0x04,0xa7,0x33,0x21,
-0xad,0x00,0xa1,0x4c,0x10,0x90,0xda,0x00,0x31,0x7f,0x32,0x21,0xd8,0x28,0x03,0x8d,
-0x00,0x17,0xae,0xcf,0x00,0x0b,0x09,0x00,0x33,0x9f,0xff,0xfb,0x09,0x00,0x28,0x88,
-0x85,0x1b,0x00,0x42,0x02,0x44,0x00,0x9e,0x51,0x00,0x10,0xfd,0x09,0x00,0x56,0x05,
-0x67,0x66,0x53,0x10,0x0a,0x07,0x09,0x09,0x00,0x23,0x2b,0x20,0x09,0x00,0x10,0x4f,
-0x53,0x03,0x18,0x34,0x93,0x19,0x1e,0x4f,0x09,0x00,0x10,0x96,0xe5,0x0f,0x02,0xb1,
-0x3a,0x03,0xc1,0x30,0x08,0xe4,0x03,0x00,0x67,0x40,0x54,0x04,0x33,0x33,0x34,0x10,
-0x7e,0x00,0x12,0x80,0xcf,0x00,0x2f,0x22,0x11,0xc6,0x00,0x0b,0x24,0x88,0x85,0xcf,
-0x00,0x13,0xfa,0x09,0x00,0x03,0xc6,0x00,0x00,0x63,0x01,0x20,0x6f,0xfe,0xa0,0x0d,
-0x10,0x8e,0x93,0x09,0x36,0x76,0x54,0x20,0x75,0x01,0x15,0x25,0x55,0x30,0x00,0x99,
-0x00,0x10,0x30,0x0e,0x30,0x04,0x47,0x1a,0x10,0x7f,0x09,0x00,0x20,0x52,0x22,0x58,
-0x28,0x04,0xc8,0x18,0x00,0x09,0x00,0x54,0x64,0x44,0x43,0x33,0x9f,0x2d,0x00,0x14,
-0x7f,0x09,0x00,0x14,0x8e,0xb5,0x30,0x10,0xfd,0x9a,0x04,0x00,0xcb,0x17,0x16,0x62,
-0x10,0x31,0x02,0x23,0x0e,0xf0,0x01,0x60,0x03,0xf3,0x0c,0xed,0xdd,0xed,0x10,0xf8,
-0x00,0x4f,0x30,0xfc,0x88,0x88,0x60,0xcb,0x0d,0x21,0x1f,0x70,0xae,0x04,0x33,0x3f,
-0x31,0xf7,0x84,0x0d,0x01,0x11,0x00,0x1c,0xe8,0x11,0x00,0x53,0xeb,0x66,0x8f,0x31,
-0xf7,0xc6,0x0d,0x0e,0x22,0x00,0x0d,0x11,0x00,0xc0,0x92,0x33,0x58,0x60,0xe8,0x00,
-0x3f,0x30,0xef,0xff,0xff,0xd8,0x11,0x00,0x31,0x00,0x33,0x21,0x22,0x00,0x13,0x30,
-0xc2,0x0d,0x02,0x09,0x06,0x07,0x11,0x00,0x13,0xf4,0xc6,0x05,0x02,0xcd,0x25,0x16,
-0x09,0xcc,0x0d,0x04,0x93,0x2a,0x13,0x30,0xe8,0x05,0xe2,0xae,0xee,0xee,0xee,0x20,
-0x00,0xf8,0xed,0x88,0x98,0x86,0x00,0x00,0xf8,0xf5,0x1b,0x0f,0x07,0x00,0x06,0x30,
-0x7c,0xcc,0xcd,0x07,0x00,0x3f,0x4a,0xaa,0xa9,0x2a,0x00,0x0a,0x80,0xfa,0x22,0x34,
-0x57,0x95,0x00,0xf8,0xcf,0x20,0x05,0x56,0x00,0xf8,0x02,0x33,0x21,0x51,0x06,0x0f,
-0x07,0x00,0x09,0x19,0xd6,0x03,0x03,0xa1,0x12,0x02,0x43,0x33,0x34,0x30,0x00,0x09,
-0xe0,0xdf,0x52,0x02,0x50,0x9f,0x0e,0xa2,0x22,0x21,0xb2,0x03,0x12,0xe9,0x3e,0x03,
-0x20,0x0f,0x90,0x3e,0x07,0x23,0x7b,0xf0,0xec,0x33,0x22,0x0f,0x90,0x5e,0x03,0x13,
-0xf9,0x1e,0x00,0xc4,0xc7,0x66,0x78,0xad,0x60,0x08,0xe0,0x8e,0xff,0xee,0xdc,0xa3,
-0xd9,0x02,0x25,0x08,0xd0,0xfc,0x0a,0x00,0x8f,0x1b,0x21,0x89,0x60,0xe0,0x22,0x2a,
-0xee,0xfe,0x37,0x20,0x33,0x9e,0x00,0x04,0xb9,0x0f,0x61,0x7f,0x98,0x88,0x88,0x87,
-0x73,0xb9,0x2a,0x07,0x7c,0x1b,0x11,0x05,0x64,0x09,0x30,0xf6,0x00,0x05,0xc9,0x0b,
-0x23,0x66,0x10,0xb0,0x03,0x02,0xad,0x00,0x31,0x0a,0xd0,0xdf,0x59,0x43,0x50,0xad,
-0x0e,0xa2,0x22,0x11,0x98,0x04,0x12,0xe9,0x6b,0x35,0x20,0x0e,0x90,0x63,0x13,0x31,
-0x4c,0xd0,0xf9,0x38,0x0b,0x30,0xfd,0x0f,0x90,0xeb,0x0d,0x32,0x2b,0xd0,0xf9,0x1e,
-0x00,0x00,0x0f,0x00,0xf3,0x03,0x14,0x10,0x0b,0xd0,0xef,0xdd,0xee,0xff,0xf6,0x00,
-0xad,0x03,0x78,0x87,0x77,0x74,0x00,0x0a,0x50,0x07,0x15,0x56,0x11,0x01,0x11,0xdf,
-0x7c,0x08,0x10,0x10,0x82,0x0c,0x00,0xb3,0x20,0x00,0x75,0x17,0x12,0x48,0x2a,0x1e,
-0x22,0x08,0xe0,0x52,0x14,0x16,0x8e,0x0f,0x00,0x83,0x12,0xea,0x22,0x22,0x9f,0x34,
-0x20,0x2f,0x89,0x25,0x01,0xda,0x0b,0x1a,0x21,0xbf,0x02,0xf1,0x08,0x06,0xd0,0x05,
-0xf1,0x0c,0xcc,0xcc,0xcb,0x00,0x8f,0x00,0x5f,0x12,0xfb,0x99,0x98,0x60,0x08,0xf0,
-0x06,0xf1,0x2f,0x50,0x9b,0x04,0x31,0x6f,0x12,0xf5,0xa5,0x0b,0x03,0x11,0x00,0x1a,
-0x7f,0x11,0x00,0xe1,0x7c,0xcc,0xdf,0x00,0x6f,0x13,0xf4,0x00,0x06,0xaa,0xad,0xf0,
-0x06,0xf1,0x63,0x02,0x52,0x7f,0x00,0x5f,0x13,0xf4,0x66,0x2f,0x1e,0xf1,0x11,0x00,
-0xc0,0x62,0x23,0x57,0x50,0x7f,0x00,0x5f,0x11,0xff,0xff,0xff,0xe8,0x11,0x00,0x63,
-0x02,0x44,0x43,0x10,0x00,0x7f,0x58,0x30,0x00,0x11,0x00,0x02,0xd6,0x0b,0x03,0x11,
-0x00,0x03,0xbe,0x30,0x01,0x11,0x00,0x11,0x20,0xb0,0x00,0x15,0x80,0x52,0x2d,0x06,
-0x16,0x25,0xf0,0x05,0x01,0x11,0x12,0x00,0x04,0xf1,0x04,0xf2,0xcf,0xff,0xff,0xc0,
-0x05,0xf3,0x05,0xf3,0xec,0x45,0x54,0x20,0x08,0x00,0x20,0xea,0x00,0xf6,0x26,0x35,
-0x04,0xf4,0xe9,0x08,0x00,0xe1,0x04,0xbc,0xcd,0xf4,0x04,0xf4,0xf9,0x00,0x04,0xba,
-0xab,0xf4,0x04,0xf3,0xef,0x2e,0x07,0x08,0x00,0x70,0xfa,0x23,0x36,0x84,0x03,0xf4,
-0x04,0x24,0x11,0x10,0xd5,0x08,0x00,0x30,0x03,0x33,0x10,0xf6,0x2d,0x12,0xf3,0x26,
-0x03,0x16,0x01,0xd3,0x5c,0x02,0xaa,0x1e,0x30,0xb0,0x00,0x05,0x7f,0x0b,0x14,0x6c,
-0xc5,0x19,0x0e,0x08,0x00,0x09,0x4e,0x02,0x14,0x0a,0x90,0x1a,0x13,0x70,0x76,0x03,
-0x10,0x50,0x83,0x03,0xf2,0x03,0x07,0xf0,0x04,0xf2,0xbf,0xff,0xff,0x90,0x08,0xf1,
-0x03,0xf3,0xec,0x56,0x65,0x10,0x07,0xf1,0xdc,0x11,0x00,0x08,0x00,0x13,0xe9,0x08,
-0x00,0x50,0xf9,0x00,0x02,0x66,0x6a,0x08,0x00,0x00,0xe0,0x02,0x12,0xf1,0xd4,0x11,
-0x1d,0x06,0x08,0x00,0x60,0x04,0xf2,0xfd,0x88,0x9b,0xe8,0x08,0x00,0x62,0x7d,0xdd,
-0xba,0x72,0x06,0xf1,0xae,0x0d,0x06,0x08,0x00,0x70,0x05,0xf2,0x00,0x08,0xc0,0x00,
-0x05,0x52,0x01,0x01,0x36,0x09,0x22,0x01,0x70,0x08,0x00,0x07,0x9b,0x00,0x05,0x08,
-0x00,0x63,0xf6,0x55,0x55,0x56,0x78,0x80,0x86,0x15,0x10,0xe2,0x2f,0x21,0x04,0xfc,
-0x00,0x00,0x33,0x35,0x00,0x70,0x01,0x36,0x05,0xf2,0x05,0x70,0x01,0x44,0x44,0x44,
-0x10,0x04,0x70,0x01,0x01,0x60,0x01,0x30,0x01,0x55,0x58,0x08,0x00,0x00,0x41,0x00,
-0x01,0x08,0x00,0x39,0x00,0x11,0x03,0x70,0x01,0x20,0x02,0x42,0x08,0x00,0x40,0xdf,
-0xff,0xff,0xf8,0x08,0x00,0x54,0x26,0x76,0x53,0x10,0x02,0x68,0x01,0x32,0x10,0x00,
-0x40,0x69,0x11,0x44,0x64,0x20,0x00,0x07,0x6a,0x60,0x17,0x10,0x30,0x07,0x20,0x08,
-0xf0,0xb5,0x03,0x10,0x78,0xde,0x31,0x01,0x68,0x1b,0x25,0xee,0x90,0x1e,0x0d,0x04,
-0x08,0x00,0x11,0x07,0x99,0x03,0x10,0xf8,0xfc,0x0c,0x10,0x77,0xfe,0x15,0x20,0x01,
-0xce,0x1f,0x59,0x11,0x10,0x73,0x3b,0x4e,0x88,0x88,0x87,0x60,0xa2,0x14,0x1f,0x00,
-0x13,0x00,0x16,0x51,0x02,0xfe,0xdd,0xdd,0xee,0xba,0x40,0x6a,0x06,0x99,0x99,0x88,
-0x87,0x62,0x07,0x2f,0x07,0x73,0x24,0x1e,0xae,0x13,0x00,0x15,0x9e,0x01,0x10,0x00,
-0x79,0x24,0x0e,0x01,0x10,0x05,0xdc,0x03,0x11,0x80,0x46,0x24,0x47,0x77,0x77,0x66,
-0x20,0x59,0x2b,0x1d,0x02,0x09,0x00,0x65,0x01,0xfa,0x22,0x22,0x23,0x34,0x01,0x10,
-0x11,0xf2,0x43,0x27,0x4a,0x9f,0x43,0x22,0x10,0x01,0x10,0x19,0x7f,0xad,0x1f,0x03,
-0x50,0x0c,0x2e,0x78,0x85,0xa6,0x0b,0x01,0x75,0x0e,0x10,0xee,0x01,0x28,0x10,0x03,
-0x5b,0x17,0x24,0x7b,0xf3,0x26,0x04,0x0f,0x09,0x00,0x10,0x05,0x4d,0x0e,0x2f,0x01,
-0x50,0xcf,0x00,0x0a,0x0f,0x07,0x20,0x09,0x0f,0xcf,0x00,0x02,0x02,0x52,0x10,0x0c,
-0x29,0x0f,0x05,0xa3,0x22,0x0f,0xcf,0x00,0x02,0x3a,0x03,0x57,0x54,0x47,0x0c,0x41,
-0x5f,0xc3,0x00,0x03,0xb1,0x54,0x14,0xdd,0x47,0x0c,0x1f,0xf9,0x47,0x0c,0x1d,0x26,
-0x00,0x14,0xb1,0x10,0xd0,0xbd,0xdd,0xdd,0xde,0xc0,0x00,0x7f,0x00,0x1f,0xc8,0x88,
-0x88,0x75,0x05,0x13,0x13,0xf8,0x7e,0x1b,0x01,0x55,0x21,0x00,0x46,0x38,0x0b,0x11,
-0x00,0x14,0xf1,0x22,0x00,0x60,0x10,0x1f,0x91,0x11,0x12,0x34,0xde,0x0e,0x02,0xc6,
-0x0a,0x72,0x6f,0x10,0x01,0x55,0x55,0x44,0x32,0xef,0x0e,0x13,0x20,0xa3,0x17,0x22,
-0x2f,0x30,0x3b,0x11,0x23,0x03,0xf4,0x11,0x00,0x24,0x3f,0x40,0x11,0x00,0x51,0x12,
-0x47,0x70,0x6f,0x11,0xfa,0x00,0x86,0xe9,0x06,0xf1,0x05,0x56,0x65,0x54,0x32,0x07,
-0x23,0x2b,0x06,0xf1,0x09,0x22,0x15,0x04,0x63,0x0a,0x06,0x66,0x26,0x01,0x02,0x14,
-0x00,0xc4,0x00,0x11,0x7f,0xdb,0x03,0x13,0x7f,0xc7,0x0a,0x21,0x06,0xf1,0x07,0x0c,
-0x00,0x4d,0x00,0x14,0x08,0x11,0x00,0x13,0x7f,0x11,0x00,0x90,0x07,0xf7,0x44,0x55,
-0x66,0x20,0x06,0xf1,0x00,0x35,0x31,0x11,0xe6,0x6f,0x00,0x23,0x1f,0x70,0x6f,0x00,
-0x13,0xf7,0xa2,0x00,0x70,0x0f,0x70,0x24,0x65,0x06,0xf1,0x2e,0x78,0x03,0x96,0xfe,
-0x90,0x6f,0x10,0x67,0x77,0x76,0x65,0x31,0x91,0x00,0x00,0x4a,0x00,0x04,0xb2,0x37,
-0x01,0x56,0x00,0x17,0x3a,0x63,0x10,0x02,0x67,0x00,0x08,0x11,0x00,0x62,0x97,0x77,
-0x77,0x77,0x86,0x00,0xa3,0x58,0x25,0xfe,0xd0,0xbd,0x19,0x02,0xbb,0x00,0x23,0x05,
-0xf1,0xbb,0x00,0x43,0x6f,0x20,0x07,0xf1,0x7a,0x02,0x13,0x8f,0xf7,0x00,0x23,0x08,
-0xf0,0x11,0x00,0x13,0x7f,0x11,0x00,0x10,0x06,0x0a,0x04,0x91,0x70,0x06,0xf2,0x00,
-0x05,0x78,0xfb,0x76,0x51,0x19,0x01,0x23,0x0f,0x70,0xad,0x02,0x11,0xf7,0x22,0x00,
-0xf4,0x00,0x45,0x55,0x5f,0xb7,0x9b,0xda,0x06,0xf2,0x1f,0xff,0xff,0xfe,0xdc,0xa7,
-0x30,0x3b,0x01,0x08,0x67,0x06,0x20,0x03,0x77,0xa7,0x03,0x01,0xd9,0x69,0x00,0x2f,
-0x21,0x02,0x53,0x1c,0x01,0xe0,0x05,0x13,0xbe,0x8b,0x0a,0x06,0x11,0x00,0x54,0x43,
-0x33,0x33,0x34,0xbe,0x6b,0x23,0x00,0x1c,0x63,0x22,0x34,0x43,0xc1,0x02,0x01,0x22,
-0x23,0x04,0xf9,0x21,0x27,0xed,0x70,0xb8,0x23,0x0f,0x09,0x00,0x11,0xa0,0x05,0xf9,
-0x66,0x66,0x77,0x8a,0xa0,0x00,0x00,0x01,0x51,0x03,0x2f,0xed,0xb0,0xa6,0x10,0x09,
-0x08,0x86,0x1d,0x33,0x88,0xbf,0x87,0x13,0x13,0x0c,0x97,0x29,0x0f,0x09,0x00,0x13,
-0x1c,0x5e,0x67,0x1c,0x00,0xb2,0x0f,0x05,0x3f,0x11,0x10,0x80,0xb5,0x33,0x00,0x11,
-0x11,0x00,0x1f,0x35,0x04,0x47,0x10,0x06,0x09,0x00,0x05,0xd8,0x03,0x01,0x95,0x39,
-0x10,0xf2,0x13,0x13,0x03,0xb1,0x08,0x05,0x8f,0x02,0x11,0x55,0x50,0x11,0x36,0x55,
-0x54,0x6f,0xdc,0x10,0x2f,0x11,0x11,0x13,0x13,0x01,0x1f,0x9c,0x13,0x13,0x0c,0x16,
-0xee,0x13,0x13,0x1f,0x77,0x13,0x13,0x0a,0x18,0xfb,0x13,0x13,0x03,0xd8,0x03,0x01,
-0x96,0x23,0x21,0x00,0x06,0x14,0x03,0x43,0xfe,0xd2,0x00,0x6f,0x6c,0x06,0x00,0x14,
-0x03,0x13,0x00,0x14,0x03,0x02,0xb5,0x46,0x04,0x11,0x00,0x40,0x5f,0x10,0x08,0xf1,
-0x42,0x17,0x03,0x8c,0x02,0x10,0xfa,0xaf,0x08,0x64,0x56,0x66,0x65,0x43,0x00,0x05,
-0x76,0x00,0x04,0x29,0x39,0xf1,0x02,0x05,0xf1,0x05,0x66,0x66,0x67,0x8a,0xbd,0xe0,
-0x5f,0x10,0xde,0xff,0xff,0xfd,0xba,0x73,0x22,0x00,0x13,0xe9,0x22,0x00,0x00,0x0e,
-0x0a,0x0f,0x11,0x00,0x0b,0x23,0x0f,0x80,0x11,0x00,0x13,0xf8,0xf9,0x26,0x55,0x0a,
-0x40,0x00,0x00,0x04,0x10,0x2b,0x04,0x59,0x02,0x05,0x53,0x31,0x1f,0xe9,0x25,0x26,
-0x0e,0x0e,0x13,0x00,0x73,0x5f,0x96,0x66,0x67,0x78,0x98,0x10,0x5d,0x02,0x11,0xee,
-0x7c,0x38,0x0f,0x5f,0x02,0x0f,0xb1,0xff,0x02,0x78,0x88,0xfd,0x88,0x77,0x7f,0xb6,
-0x66,0x40,0x78,0x22,0x03,0x0e,0x12,0x14,0xea,0x40,0x17,0x0f,0x13,0x00,0x0e,0x14,
-0x60,0x80,0x28,0x1f,0xe4,0x64,0x02,0x4a,0x22,0x27,0x77,0x7f,0x32,0x41,0x76,0x5d,
-0xee,0xef,0x7c,0x03,0x11,0xda,0x93,0x07,0x02,0x9c,0x04,0x04,0x09,0x00,0x65,0x04,
-0x8c,0xf8,0x89,0x9c,0xfc,0x64,0x02,0x14,0xf2,0x5b,0x02,0x08,0x09,0x00,0x02,0x77,
-0x15,0x14,0xf1,0x77,0x15,0x1f,0x40,0x64,0x02,0x13,0x05,0x7c,0x08,0x61,0x04,0xfa,
-0x88,0x88,0x88,0x76,0x8b,0x0a,0x0f,0x57,0x07,0x18,0x15,0x04,0xd9,0x13,0x05,0x78,
-0x08,0x6f,0x69,0x99,0x99,0x88,0x76,0x10,0xb1,0x14,0x11,0x00,0x3a,0x10,0x39,0x43,
-0x33,0x34,0xb1,0x14,0x12,0x33,0x01,0x00,0x1f,0x21,0x73,0x08,0x38,0x13,0x23,0xf6,
-0x17,0x0c,0x01,0x00,0x08,0x73,0x08,0x2e,0x76,0x66,0x9d,0x26,0x0f,0x73,0x08,0x3b,
-0x14,0x56,0x9d,0x26,0x14,0x1f,0xfd,0x34,0x16,0x02,0xdc,0x34,0x1c,0x70,0x6c,0x08,
-0x07,0x13,0x00,0x10,0xfb,0x1e,0x02,0x10,0x70,0x18,0x08,0x10,0xef,0x5c,0x05,0x0e,
-0x5a,0x01,0x04,0x94,0x02,0x00,0xc9,0x10,0x14,0x06,0xf2,0x21,0x12,0xe0,0xd1,0x20,
-0x09,0x49,0x19,0x07,0x7e,0x32,0x2c,0x3f,0x50,0x7f,0x15,0x0f,0x56,0x0a,0x02,0x10,
-0xa6,0x8a,0x15,0x1e,0x30,0x17,0x2b,0x08,0x08,0x03,0x12,0x00,0x59,0x1c,0x00,0xa0,
-0x01,0x51,0x44,0x55,0x55,0x44,0x10,0x92,0x35,0x0b,0x75,0x35,0x15,0x01,0x2f,0x32,
-0x01,0x08,0x03,0x10,0xf5,0x92,0x31,0x57,0x67,0x77,0x77,0x66,0x51,0x0c,0x02,0x11,
-0x43,0xf9,0x01,0x06,0x0c,0x02,0x69,0xfd,0x00,0x11,0x11,0x22,0x21,0x39,0x43,0x02,
-0x85,0x01,0x23,0x99,0x70,0x42,0x21,0x14,0xef,0x40,0x08,0x09,0xe9,0x02,0x32,0x05,
-0xcd,0xde,0xce,0x4d,0x7f,0x09,0xf9,0x99,0x99,0x99,0x99,0x50,0x08,0x03,0x04,0x02,
-0xac,0x70,0x02,0xcb,0x26,0x1f,0x62,0xe2,0x0a,0x13,0x0e,0x09,0x00,0x06,0x6f,0x02,
-0x1f,0xef,0x6f,0x02,0x16,0x04,0x13,0x0a,0x1f,0x88,0x13,0x0a,0x0f,0x1f,0xbf,0x13,
-0x0a,0x03,0x14,0xfb,0xbf,0x0d,0x21,0xaf,0x50,0x0e,0x44,0x00,0x6d,0x34,0x0f,0x13,
-0x0a,0x01,0x1a,0x31,0x3a,0x11,0x72,0xec,0x88,0x87,0x76,0x00,0x00,0xf8,0xcd,0x4d,
-0x04,0x07,0x00,0x1f,0xf8,0x07,0x00,0x07,0x1f,0xf9,0x07,0x00,0x09,0xf6,0x02,0xeb,
-0x44,0x45,0x68,0xa6,0x00,0xf9,0xaf,0xff,0xff,0xfd,0xb5,0x00,0xf9,0x01,0x11,0x10,
-0x14,0x34,0x0e,0x07,0x00,0x0f,0x3a,0x11,0x05,0x20,0x23,0x24,0x99,0x2f,0x22,0x00,
-0xbd,0x8c,0x10,0x21,0xbd,0xea,0x7c,0x20,0x12,0xbd,0x8b,0x10,0x04,0x07,0x00,0x1f,
-0xf9,0x07,0x00,0x07,0xd4,0xbc,0xfd,0x77,0x78,0x9b,0xd5,0x00,0xbc,0x8e,0xee,0xed,
-0xcb,0x81,0x63,0x1e,0x03,0x07,0x00,0x10,0x44,0x20,0x42,0xa1,0xdb,0x93,0x00,0x00,
-0x01,0xcf,0xc8,0x89,0xef,0x90,0x31,0x71,0x21,0x07,0xf6,0x57,0x73,0x21,0x00,0xdc,
-0x46,0x25,0x22,0x00,0xad,0xfe,0x0a,0x12,0xdc,0xf7,0x3f,0x10,0xf7,0x73,0x39,0x10,
-0x79,0x21,0x5e,0x25,0x17,0xbc,0xf4,0x3f,0x27,0x05,0x10,0x55,0x18,0xf1,0x02,0xae,
-0xee,0xc0,0xae,0xee,0xd0,0x0f,0x70,0x00,0x0e,0xd7,0x75,0x0e,0xd7,0x75,0x00,0xf7,
-0x28,0x06,0x11,0xea,0x05,0x07,0x12,0x0e,0xeb,0x28,0x02,0xf4,0x27,0x12,0xe9,0x13,
-0x00,0x11,0x90,0x2f,0x07,0x11,0xf8,0x03,0x01,0x11,0xf9,0x1b,0x22,0x01,0x03,0x00,
-0x00,0x9b,0x04,0x13,0xf2,0x13,0x00,0x23,0xb7,0x75,0x13,0x00,0x06,0x26,0x00,0x26,
-0x80,0x00,0x13,0x00,0xf0,0x00,0xea,0x01,0x00,0xea,0x11,0x30,0x0f,0x80,0x00,0x0c,
-0xff,0xfe,0x0c,0xff,0xff,0xe9,0x34,0x6f,0x14,0x44,0x20,0x14,0x44,0x20,0xed,0x2d,
-0x01,0x1d,0x90,0x9b,0x35,0x06,0x13,0x00,0x1f,0xd8,0x2e,0x1a,0x01,0x02,0xdc,0x00,
-0xf0,0x06,0x6d,0x00,0xe8,0x3e,0xee,0x54,0xee,0xe7,0x08,0xe0,0x0f,0x86,0xf7,0x62,
-0x8f,0x76,0x20,0x8e,0x00,0xf8,0x6f,0x9a,0x11,0x70,0x08,0xe0,0x0e,0x87,0xf0,0x00,
-0x8e,0xdd,0x10,0x2f,0xe8,0x7f,0x11,0x00,0x03,0x22,0xfa,0xaf,0x11,0x00,0x31,0x8f,
-0xbb,0xf8,0x11,0x00,0x14,0x07,0x22,0x00,0x13,0x7e,0x22,0x00,0x0c,0x11,0x00,0xf3,
-0x07,0x12,0x07,0xe0,0x0e,0x85,0xff,0xfc,0x6f,0xff,0xf4,0x7e,0x00,0xe8,0x03,0x44,
-0x10,0x34,0x42,0x07,0xe0,0x0e,0x80,0x0a,0x3d,0x02,0x92,0x02,0x05,0x11,0x00,0x14,
-0x7f,0x11,0x00,0x13,0xf0,0x11,0x00,0x18,0x48,0xc7,0x00,0x70,0x3e,0xee,0xee,0x23,
-0xee,0xee,0xf6,0x67,0x25,0x67,0x77,0x70,0x6f,0x87,0x77,0x20,0xed,0x25,0x14,0x07,
-0xc7,0x0b,0x00,0x06,0x00,0x2f,0x07,0xf1,0x13,0x00,0x08,0x02,0x4f,0x0b,0x71,0x5f,
-0xfe,0xff,0x85,0xff,0xef,0xfc,0x32,0x42,0x55,0x62,0x05,0x77,0x77,0x50,0x9f,0x15,
-0x0b,0x0a,0x17,0x1e,0x9f,0xcd,0x33,0x0f,0x34,0x0f,0x06,0x00,0x97,0x0b,0x40,0x20,
-0x67,0x77,0x61,0x96,0x54,0x21,0xff,0x75,0xb7,0x1e,0x00,0x63,0x2b,0x14,0xf3,0x6c,
-0x2b,0x1f,0xf2,0x09,0x00,0x0d,0x61,0xc5,0x55,0x35,0xf8,0x55,0x63,0x3e,0x31,0x48,
-0xb2,0xef,0xff,0xfa,0xa5,0x3f,0x0c,0x01,0x00,0x13,0x6e,0xf4,0x08,0x19,0xfd,0x53,
-0x0b,0x04,0xb9,0x0c,0x0f,0x09,0x00,0x13,0x05,0x4c,0x00,0x0f,0xa9,0x07,0x02,0xf1,
-0x0d,0x00,0x04,0x55,0x40,0x05,0x44,0x40,0x03,0xf4,0x02,0xff,0xff,0x68,0xff,0xff,
-0x30,0x2f,0x40,0x3f,0x41,0x10,0x9d,0x11,0x00,0x02,0xf4,0x03,0xf3,0xaf,0x26,0x40,
-0x2f,0x40,0x4f,0x30,0xc7,0x34,0x32,0x01,0xf4,0x04,0x11,0x00,0x15,0x1f,0x11,0x00,
-0xf4,0x02,0x03,0xff,0xef,0x88,0xfe,0xef,0x60,0x1f,0x40,0x05,0x77,0x62,0x16,0x77,
-0x61,0x01,0xf4,0xc8,0x20,0x13,0x40,0x45,0x05,0x20,0xf4,0x05,0x18,0x34,0x50,0xbd,
-0xf2,0x1f,0x40,0xde,0x4a,0x33,0x11,0x84,0x22,0x00,0x13,0xe9,0x22,0x00,0x00,0x44,
-0x03,0x0e,0x11,0x00,0x14,0xf5,0x11,0x00,0x12,0x50,0x84,0x0a,0x01,0x15,0x3c,0x13,
-0xf8,0xf7,0x32,0x23,0x0a,0x40,0x22,0x00,0x08,0x55,0x27,0x27,0x04,0x20,0x33,0x03,
-0x20,0x0c,0xee,0x27,0x35,0x00,0x39,0x00,0x44,0x78,0x98,0x88,0xcf,0x33,0x03,0x02,
-0xdd,0x2b,0x03,0xe9,0x01,0x14,0xe9,0x1d,0x11,0x03,0x21,0x2d,0x11,0x9e,0xeb,0x03,
-0xb1,0x04,0x77,0x77,0x8c,0xf0,0x00,0x0e,0xb4,0x34,0x10,0xdf,0x0e,0x0c,0x42,0xef,
-0xff,0xfb,0x0e,0x52,0x71,0x53,0xa3,0x32,0x10,0xea,0x00,0x21,0x46,0x24,0x0e,0xa0,
-0xc5,0x32,0x1e,0xea,0x13,0x00,0x71,0xdd,0x77,0x78,0x9b,0xd9,0x00,0xd9,0x36,0x02,
-0x20,0xca,0x86,0xaf,0x32,0x0c,0xd4,0x2b,0x0f,0x13,0x00,0x0a,0x1d,0xca,0x5f,0x53,
-0x20,0x00,0x23,0x17,0x04,0x21,0x44,0x45,0xd4,0x11,0x11,0x8f,0x43,0x46,0x10,0xaf,
-0xb7,0x15,0x33,0x21,0x3f,0x50,0xb2,0x02,0x1a,0x2f,0x09,0x00,0x41,0x28,0x88,0x88,
-0xaf,0x09,0x00,0xb2,0x9f,0xee,0xdd,0xdc,0x30,0x00,0x9f,0x66,0x64,0x9e,0x00,0xbe,
-0x18,0x13,0xfc,0x09,0x00,0x34,0x11,0x00,0x9e,0xe2,0x0c,0x50,0x9f,0x76,0x78,0x9a,
-0xdd,0x09,0x00,0x5f,0x4d,0xee,0xed,0xb9,0x73,0x1c,0x2b,0x04,0x24,0x06,0x10,0x88,
-0x18,0x10,0x50,0x3b,0x75,0x0f,0x84,0x19,0x2e,0x11,0x27,0xc7,0x35,0x12,0xae,0x84,
-0x19,0x34,0x50,0x00,0xae,0xbd,0x00,0x1f,0xaf,0xcf,0x00,0x01,0xe0,0x5d,0xdd,0xdd,
-0xef,0x50,0x00,0x9f,0x99,0x96,0xaf,0x99,0x99,0x88,0x10,0x53,0x1a,0x05,0xbd,0x00,
-0x06,0xc6,0x00,0x61,0x33,0x34,0x57,0x9a,0x00,0x8f,0x51,0x00,0x41,0xfe,0xc8,0x00,
-0x8f,0xbb,0x39,0x17,0x00,0x02,0x1b,0x18,0x13,0x56,0x01,0x14,0x2e,0x4e,0x19,0x20,
-0x4f,0xa7,0xef,0x54,0x04,0xbd,0x00,0x1f,0x8f,0x09,0x00,0x03,0x54,0x73,0x22,0x22,
-0x23,0xaf,0xcf,0x00,0x10,0xfd,0x73,0x02,0x22,0x44,0x43,0x9e,0x22,0x0a,0xcf,0x00,
-0x03,0x53,0x1a,0x07,0xbd,0x00,0x17,0x8f,0x09,0x00,0x41,0x01,0x11,0x12,0x4f,0x09,
-0x00,0x11,0x8f,0x24,0x00,0xcf,0x8f,0xff,0xfc,0xaf,0x44,0x44,0x43,0x00,0x00,0x8f,
-0x88,0x85,0xcf,0x00,0x0e,0x1d,0x8e,0xcf,0x00,0x12,0x37,0xc1,0x25,0x22,0x76,0x41,
-0xd4,0x03,0x41,0xff,0xee,0xff,0x80,0x08,0x67,0x45,0x20,0x00,0x28,0xf8,0xab,0x3c,
-0x04,0x23,0x06,0x21,0x6f,0x10,0x62,0x30,0x02,0xe0,0x04,0x61,0x08,0xfa,0x20,0x00,
-0x18,0xfa,0x68,0x00,0x43,0xfe,0xde,0xff,0x90,0x48,0x00,0x17,0x40,0x63,0x4b,0x03,
-0xb1,0x2d,0xf1,0x04,0x02,0xf4,0x5e,0xee,0xee,0xf4,0x00,0x7e,0x00,0x3f,0x42,0x89,
-0x88,0x8f,0x70,0x08,0xe0,0x02,0xf4,0x28,0x07,0x11,0x7e,0xa1,0x38,0x31,0x1f,0x70,
-0x07,0x11,0x00,0x1a,0x01,0x11,0x00,0xb0,0x17,0x77,0x78,0xf7,0x00,0x7f,0x66,0x7f,
-0x48,0xff,0xff,0x29,0x66,0x20,0xff,0xf4,0xd6,0x11,0x00,0x22,0x00,0x10,0x48,0x52,
-0x05,0x00,0x22,0x00,0x2f,0x8f,0x00,0x11,0x00,0x04,0x50,0x47,0xfa,0x9a,0xbd,0xf7,
-0x11,0x00,0x63,0x2b,0xcc,0xb9,0x75,0x00,0x7f,0x07,0x39,0x23,0x07,0xf0,0x06,0x39,
-0x0f,0x11,0x00,0x06,0x25,0x03,0x90,0x72,0x04,0x16,0x01,0x1d,0x2a,0xc0,0x24,0x44,
-0x45,0x30,0x06,0xd0,0x04,0xf2,0x0d,0xff,0xff,0xfe,0x7d,0x48,0x91,0x30,0x02,0x22,
-0x2a,0xf0,0x08,0xf0,0x04,0xf3,0x46,0x01,0x31,0x7f,0x00,0x4f,0x59,0x48,0xf0,0x06,
-0x07,0xf0,0x04,0xf4,0x08,0xaa,0xab,0xdf,0x00,0x7f,0xbb,0xcf,0x40,0xfe,0xcc,0xcb,
-0x90,0x07,0xfb,0xbc,0xf3,0x7d,0x07,0x00,0x22,0x00,0x21,0x30,0xf8,0x6f,0x00,0x10,
-0x04,0x11,0x00,0x20,0x02,0x40,0x11,0x00,0xe2,0xef,0xdd,0xef,0xff,0x27,0xf0,0x04,
-0xf3,0x03,0x78,0x87,0x53,0x10,0x6f,0x9e,0x1b,0x0a,0x9b,0x17,0x24,0x00,0x0a,0x7a,
-0x11,0x10,0x47,0x77,0x40,0x1c,0xcf,0x50,0x06,0x1e,0x9f,0x11,0x00,0x0a,0xfc,0x16,
-0x26,0x00,0x57,0xb1,0x02,0x02,0x57,0x02,0x14,0x8f,0x57,0x02,0x06,0x4e,0x02,0x23,
-0x33,0x31,0x09,0x00,0x24,0xff,0xfb,0x12,0x00,0x24,0x30,0x6e,0x24,0x00,0x57,0xaf,
-0x77,0x77,0x76,0x10,0x4e,0x02,0x33,0x22,0x20,0x9e,0xc9,0x52,0x10,0xf9,0x57,0x02,
-0x50,0x99,0x00,0x8f,0x44,0x30,0x57,0x02,0x30,0xc7,0x00,0x7f,0x57,0x02,0x18,0x21,
-0xec,0x03,0x19,0x4a,0x0f,0x02,0x0f,0x57,0x02,0x3a,0x04,0x0d,0x06,0xe2,0xf3,0x1d,
-0xee,0xee,0xef,0x60,0x00,0x02,0xf3,0x08,0x99,0x88,0x7f,0x80,0x3a,0x22,0x1f,0x0f,
-0x08,0x00,0x09,0x90,0x05,0x77,0x77,0x8f,0x80,0xef,0xff,0xf3,0x0f,0x93,0x3d,0x32,
-0x67,0x78,0xf4,0x1c,0x09,0x1f,0x02,0x08,0x00,0x04,0x16,0x01,0x08,0x00,0xd4,0xd9,
-0x9a,0xbc,0xdf,0x80,0x01,0xf4,0x07,0xcc,0xcb,0xa9,0x75,0x10,0x24,0x02,0x0f,0x08,
-0x00,0x05,0x14,0x02,0x44,0x02,0x14,0xd2,0xb0,0x00,0x12,0x05,0x6b,0x3a,0x21,0xf3,
-0x0c,0x0b,0x3e,0x22,0x04,0xf3,0x18,0x24,0x29,0x04,0xf4,0x08,0x00,0x30,0x22,0x26,
-0xf4,0x20,0x00,0xb3,0x72,0xff,0xff,0xf4,0x0f,0xb7,0x77,0x76,0x10,0x34,0x47,0x80,
-0x00,0x25,0x04,0xf3,0x08,0x00,0x80,0xa3,0x34,0x56,0x8a,0x40,0x04,0xf3,0x0d,0x9b,
-0x6d,0x41,0x30,0x04,0xf3,0x00,0x73,0x01,0x14,0x04,0x3d,0x0e,0x11,0x60,0x03,0x24,
-0x10,0x77,0xe0,0x13,0x04,0x6f,0x18,0x13,0xf8,0xbe,0x08,0x03,0x08,0x00,0x19,0x01,
-0x08,0x00,0x11,0xf0,0x95,0x0c,0x33,0x22,0x39,0xf0,0xca,0x0c,0x11,0xd0,0xad,0x29,
-0x01,0x1e,0x04,0x0f,0xb8,0x00,0x14,0x00,0xd2,0x3e,0x44,0x55,0x58,0xf4,0x0e,0xb8,
-0x00,0x30,0xa5,0x55,0x44,0xd6,0x0e,0x0d,0xb8,0x00,0xd4,0xc7,0x67,0x89,0xbe,0x60,
-0x04,0xf3,0x09,0xee,0xee,0xdc,0xa8,0x10,0xb0,0x00,0x23,0x01,0x80,0xcb,0x01,0x12,
-0x30,0x76,0x38,0x21,0x05,0xf0,0x56,0x22,0x00,0x25,0x12,0x93,0x01,0xf7,0x21,0x11,
-0x11,0x27,0xf1,0x00,0x01,0xc8,0x00,0x72,0x01,0xf9,0x66,0x66,0x55,0x59,0xf0,0x28,
-0x00,0x17,0x06,0x08,0x00,0x04,0xa3,0x26,0x10,0x35,0xc2,0x0e,0x19,0x20,0x77,0x04,
-0xf1,0x06,0x03,0xf1,0x02,0xf4,0x7e,0xee,0xef,0xe0,0x00,0x4f,0x20,0x3f,0x43,0x88,
-0x87,0xbf,0x10,0x04,0xf2,0x03,0xf4,0xfe,0x00,0x40,0x4f,0x30,0x3f,0x40,0xd0,0x08,
-0x21,0x04,0xf3,0x11,0x00,0x14,0xf0,0x11,0x00,0xf2,0x06,0x00,0x03,0xf3,0x03,0xf4,
-0x17,0x77,0x7b,0xf1,0x67,0x9f,0x30,0x3f,0x48,0xff,0xff,0xfd,0x1d,0xef,0xf3,0x03,
-0x77,0x04,0x51,0x3f,0x30,0x3f,0x48,0xf0,0x2b,0x3a,0x03,0x66,0x04,0x3b,0x3f,0x30,
-0x2f,0x11,0x00,0x11,0x20,0x77,0x04,0x33,0xf6,0x03,0xf2,0x77,0x04,0x22,0x4f,0x20,
-0x55,0x04,0x23,0x04,0xf2,0x11,0x02,0x04,0x11,0x00,0x43,0x05,0xf1,0x02,0xf5,0x5a,
-0x13,0x02,0x7a,0x3b,0x4d,0x02,0xa0,0x01,0xf4,0xa7,0x0f,0x20,0x00,0x34,0xa7,0x07,
-0x40,0xe5,0x04,0xf2,0x0e,0x9b,0x34,0x20,0x0f,0x70,0x77,0x04,0x61,0x4f,0x60,0x00,
-0xf8,0x04,0xf3,0xb2,0x08,0x41,0x0f,0x80,0x4f,0x40,0xd4,0x08,0x11,0xf8,0x77,0x04,
-0x50,0xf5,0xaf,0xff,0x80,0x4f,0x77,0x04,0x33,0x23,0x66,0xf8,0x78,0x01,0x22,0x0f,
-0x80,0x77,0x04,0x23,0x00,0xf8,0x77,0x04,0x22,0x0f,0x80,0x77,0x04,0x20,0x10,0xf8,
-0x77,0x04,0x5e,0x77,0x53,0x00,0x0e,0x70,0x77,0x04,0x06,0x13,0x1c,0x2f,0x00,0x57,
-0x77,0x04,0x24,0x14,0x58,0x4e,0x09,0x12,0x15,0x78,0x31,0x50,0xf8,0x05,0xf1,0x0d,
-0xff,0x75,0x6f,0x70,0x80,0x5f,0x10,0x35,0x55,0x6f,0x60,0x11,0x00,0x01,0x41,0x24,
-0x00,0x11,0x00,0x01,0x3e,0x13,0xf1,0x09,0xf8,0x05,0xf2,0x02,0x44,0x46,0xf6,0x48,
-0x8f,0x80,0x5f,0x20,0xff,0xff,0xff,0x58,0xee,0xf8,0x05,0xf1,0x0f,0x92,0x22,0x10,
-0x22,0x00,0x02,0xc4,0x00,0x23,0x05,0xf1,0xd5,0x00,0xb0,0x5f,0x10,0xfa,0x44,0x56,
-0x85,0x00,0xf7,0x05,0xf1,0x0c,0xdf,0x70,0x01,0x36,0x4a,0x10,0x11,0x4e,0x06,0x02,
-0xa3,0x17,0x00,0x3e,0x4a,0x02,0x9a,0x1c,0x01,0xf4,0x2f,0x10,0xaf,0x0e,0x02,0x13,
-0x4b,0x17,0x19,0x03,0x9a,0x7e,0x0a,0xae,0x00,0x63,0xaf,0x65,0x55,0x56,0x77,0x88,
-0xa8,0x31,0x2c,0xfe,0xd0,0x5f,0x3b,0x05,0x6c,0x04,0x13,0x0b,0x6c,0x04,0x3e,0x06,
-0x89,0x88,0x6c,0x04,0x22,0xcd,0xde,0x08,0x00,0x2a,0x79,0x9a,0x6c,0x04,0x22,0x00,
-0x02,0x6c,0x04,0x0c,0x5c,0x04,0x22,0x89,0x9a,0x08,0x00,0x2f,0xcd,0xdd,0x6c,0x04,
-0x02,0x2f,0xef,0x70,0x6c,0x04,0x15,0x1c,0x01,0x6c,0x04,0x30,0x10,0x03,0x44,0x22,
-0x3b,0x01,0x37,0x02,0x11,0xff,0xdc,0x32,0x61,0x22,0x11,0x1f,0x70,0x01,0x15,0x98,
-0x00,0x32,0x72,0xff,0xff,0xc4,0x03,0x80,0x55,0x58,0xf3,0x05,0x88,0x88,0x9f,0x70,
-0x9c,0x03,0x43,0xfe,0xee,0xdd,0x40,0xac,0x03,0x32,0x01,0x99,0x9b,0x08,0x00,0x22,
-0xcd,0xde,0x08,0x00,0xf2,0x01,0x00,0x04,0xf2,0x0f,0xd9,0x99,0xac,0xef,0x40,0x05,
-0xf2,0x07,0xbc,0xbb,0xa9,0x74,0x4b,0x39,0x00,0xc8,0x00,0x16,0xc0,0xf1,0x0b,0x21,
-0xee,0xef,0x2a,0x27,0x10,0x02,0xd0,0x0c,0x2a,0x7c,0xf2,0xf1,0x40,0x2a,0x07,0xf2,
-0x12,0x19,0x0c,0x08,0x00,0x24,0x04,0xa0,0x8d,0x1d,0x93,0x04,0x66,0x66,0x77,0x10,
-0x00,0x05,0xf2,0x0c,0xb8,0x00,0x00,0xa8,0x00,0x31,0x71,0x88,0x8b,0x08,0x00,0x80,
-0x73,0xdd,0xde,0xf3,0x01,0x22,0x22,0x3f,0xb0,0x00,0x13,0x0e,0x8c,0x04,0x63,0x0f,
-0x93,0x22,0x22,0x03,0xed,0xa8,0x00,0x50,0x88,0x8a,0xf3,0x0f,0x80,0xf1,0x31,0x30,
-0x05,0xf2,0x0f,0x7c,0x31,0x50,0x60,0x05,0xf2,0x02,0x67,0x42,0x23,0x05,0xc6,0x16,
-0x15,0x40,0xcd,0x4a,0x05,0x1c,0x05,0x56,0x35,0x55,0x44,0x44,0x49,0x90,0x00,0x00,
-0x3c,0x05,0x54,0x78,0x8b,0xf1,0x00,0x00,0x00,0x03,0x1b,0xf9,0x25,0x0f,0x04,0x8b,
-0x1d,0x10,0x37,0xa1,0x3a,0x12,0x61,0xd6,0x12,0x12,0x10,0x50,0x63,0x01,0x7a,0x3f,
-0x00,0x40,0x38,0x4e,0x54,0x44,0x4f,0x70,0x7b,0x3c,0x03,0xdc,0x16,0x14,0x7f,0x0f,
-0x34,0x2e,0xee,0x50,0xbc,0x2a,0x03,0x09,0x00,0x10,0x02,0x52,0x66,0x01,0x6a,0x00,
-0x12,0xf3,0xd2,0x29,0x13,0x66,0x1a,0x26,0x19,0x5c,0x04,0x1d,0x0d,0x09,0x00,0x00,
-0x2c,0x26,0x10,0xff,0x32,0x13,0x20,0xfc,0x28,0x56,0x3c,0x11,0x78,0xb7,0x60,0x04,
-0xf9,0x34,0x02,0xd9,0x2c,0x12,0xfd,0xfd,0x58,0x49,0x55,0x55,0x4b,0xe0,0xa6,0x0e,
-0x00,0xf6,0x38,0x21,0x5b,0xe0,0xec,0x5e,0x04,0x26,0x00,0x14,0xf8,0x4c,0x13,0x15,
-0x1f,0x19,0x04,0x60,0xfc,0x76,0x66,0x66,0x79,0xd5,0xf9,0x03,0x10,0xef,0x7b,0x16,
-0x1a,0x40,0x5e,0x19,0x02,0x7d,0x03,0x40,0x6f,0xfe,0xee,0xed,0xf1,0x21,0x21,0xfe,
-0x02,0x1a,0x3e,0x38,0x88,0x77,0x77,0x42,0x1d,0x01,0x01,0x53,0x15,0x54,0xbe,0x3d,
-0x23,0xf4,0x00,0x54,0x1a,0x1f,0x6f,0x61,0x14,0x13,0x04,0xee,0x17,0x01,0xac,0x04,
-0x00,0xb8,0x1c,0x41,0xdd,0xde,0x90,0x00,0x96,0x0d,0x37,0x88,0x7d,0xc0,0x35,0x27,
-0x01,0x98,0x01,0x10,0x2b,0x09,0x00,0x05,0x4c,0x40,0x22,0xfa,0x54,0x76,0x17,0x06,
-0xe7,0x29,0x10,0xfb,0xae,0x14,0x10,0x81,0xdc,0x1e,0x00,0xf6,0x03,0x1b,0xd3,0x76,
-0x0c,0x00,0x6b,0x00,0x00,0x13,0x5f,0x55,0x8f,0x75,0x55,0x55,0x53,0xfc,0x15,0x05,
-0x3a,0x15,0x06,0x23,0x04,0x2d,0x05,0xf2,0xe8,0x1a,0x0e,0xf3,0x43,0x13,0xf9,0x31,
-0x40,0x12,0x03,0xd2,0x5d,0x0c,0xea,0x05,0x15,0x13,0x43,0x02,0x12,0x70,0xfc,0x15,
-0x37,0x55,0x5f,0x90,0x66,0x57,0x14,0x01,0x34,0x15,0x20,0x02,0xfa,0x58,0x2b,0x19,
-0x20,0x64,0x3e,0x00,0xcf,0x1b,0x20,0x80,0x00,0x70,0x12,0x46,0xff,0xee,0xdd,0xc1,
-0x93,0x01,0xa4,0x14,0x43,0x33,0x22,0x7f,0x32,0x23,0x34,0x42,0x7f,0xb7,0x48,0x22,
-0x01,0x11,0xbb,0x5d,0x07,0xdf,0x0a,0x14,0x0b,0x39,0x2c,0x10,0x04,0x59,0x00,0x27,
-0x6c,0xe0,0x1a,0x05,0x20,0x01,0x55,0x0f,0x22,0x14,0xe0,0x48,0x2f,0x1f,0xa0,0x21,
-0x18,0x07,0x12,0xf8,0x21,0x18,0x37,0x87,0x76,0x51,0x69,0x37,0x05,0x4f,0x08,0x00,
-0x3a,0x2e,0x02,0x5c,0x02,0x04,0x33,0x06,0x00,0x12,0x00,0x37,0x66,0x6b,0xe0,0x9e,
-0x01,0x3c,0x01,0xf8,0x10,0x78,0x4b,0x00,0xc9,0x02,0x01,0xcd,0x2b,0x6e,0x26,0x67,
-0xbf,0x76,0x65,0x51,0x88,0x10,0x02,0xee,0x02,0x52,0xfe,0xee,0xef,0xfc,0x28,0x68,
-0x02,0x29,0x77,0x74,0xb5,0x0b,0x05,0x61,0x41,0x24,0xaf,0x20,0xf4,0x66,0x03,0x69,
-0x04,0x23,0x2e,0xe9,0xcc,0x7d,0x32,0xef,0x40,0x6f,0xb1,0x85,0x30,0xe3,0x00,0x03,
-0x15,0x5e,0x10,0x1d,0xe7,0x03,0x00,0xbd,0x52,0x11,0x07,0x33,0x00,0x12,0x43,0x6b,
-0x0e,0x25,0x11,0x22,0x9e,0x01,0x01,0x3a,0x7f,0x2f,0x44,0x44,0xe1,0x03,0x04,0x10,
-0x01,0x3f,0x36,0x20,0x9f,0x70,0xa4,0x6e,0x57,0xdd,0xdd,0xdd,0xdc,0x40,0x05,0x1e,
-0x29,0x06,0xf1,0x1c,0x02,0x12,0x10,0x6f,0x25,0x11,0xef,0xe1,0x03,0x33,0x56,0x67,
-0x66,0xe1,0x03,0x12,0x40,0xbf,0x67,0x00,0x66,0x09,0x23,0x0b,0xb0,0x1d,0x18,0x09,
-0x09,0x00,0x10,0x4e,0x68,0x05,0x46,0xef,0xfe,0xee,0xfb,0xe1,0x03,0x20,0x03,0xdd,
-0x06,0x03,0x10,0x30,0x6a,0x80,0x55,0x99,0x88,0x88,0x88,0xf6,0xce,0x13,0x18,0x60,
-0xce,0x41,0x01,0x64,0x22,0x01,0x74,0x50,0x10,0x7f,0x7a,0x12,0x18,0xd4,0xa1,0x1e,
-0x06,0x57,0x01,0x22,0x07,0xf7,0x2a,0x23,0x02,0xe3,0x57,0x17,0xfe,0x71,0x33,0x08,
-0xc3,0x03,0x11,0x11,0x14,0x01,0x35,0x23,0x33,0x08,0x3d,0x18,0x9b,0x14,0x45,0x55,
-0x55,0xaf,0x44,0x43,0x33,0x31,0xa2,0x56,0x1e,0x00,0xb5,0x56,0x0e,0x26,0x13,0x1e,
-0x7e,0x11,0x4a,0x03,0x42,0x02,0x04,0x78,0x02,0x69,0x00,0x46,0x65,0x55,0x55,0x4d,
-0xcf,0x47,0x00,0xb0,0x04,0x24,0x5d,0xc0,0x56,0x1b,0x10,0xb0,0xd7,0x03,0x03,0xaf,
-0x04,0x07,0xe0,0x03,0x00,0xae,0x04,0x13,0xc3,0xe0,0x03,0x26,0xee,0xd3,0x5d,0x00,
-0x13,0x16,0x35,0x32,0x15,0x65,0xa8,0x1d,0x18,0x01,0xe4,0x18,0x12,0x3f,0x08,0x0e,
-0x61,0xf2,0x00,0x3f,0x30,0x04,0xd0,0x7b,0x01,0x13,0x01,0x8e,0x4c,0x00,0x46,0x79,
-0x03,0x8e,0x4c,0x24,0x77,0x7a,0xa9,0x4c,0x01,0x57,0x38,0x0a,0x8e,0x4c,0x14,0xf0,
-0xc9,0x1c,0x00,0x0c,0x19,0x00,0xa0,0x01,0x10,0xee,0x18,0x18,0x69,0x89,0x98,0x88,
-0x88,0x9f,0x40,0x65,0x00,0x03,0x09,0x00,0x01,0x9e,0x01,0x22,0xaf,0x40,0xb3,0x62,
-0x3e,0xee,0xed,0x20,0xc4,0x30,0x02,0x9c,0x01,0x33,0x66,0x78,0x80,0x48,0x20,0x2f,
-0xee,0xc0,0x9a,0x01,0x08,0x24,0x42,0x6f,0x54,0x69,0x91,0x04,0x45,0x5f,0xb5,0x44,
-0x48,0xf4,0x33,0x30,0x48,0x04,0x03,0x85,0x30,0x05,0x09,0x00,0x1f,0x80,0x09,0x00,
-0x07,0x13,0x70,0xa2,0x3a,0x18,0x01,0x97,0x01,0x06,0xbf,0x19,0x13,0xb0,0xd7,0x03,
-0x28,0x5c,0xd0,0x75,0x05,0x00,0x79,0x0c,0x14,0x7d,0x75,0x05,0x2d,0xfe,0xa0,0x5c,
-0x2f,0x14,0x10,0xd4,0x01,0x13,0xf4,0x1d,0x44,0x27,0x55,0x50,0x28,0x10,0x04,0x95,
-0x01,0x16,0x5f,0x95,0x01,0x23,0x04,0xf3,0x63,0x0a,0x13,0x04,0x2f,0x57,0x74,0x01,
-0x7a,0xf9,0x77,0x7c,0xf8,0x60,0x52,0x3b,0x13,0xf2,0x50,0x03,0x1f,0x05,0x09,0x00,
-0x03,0x64,0xf6,0x43,0x33,0x34,0x48,0xf2,0xbc,0x03,0x11,0xe0,0xa3,0x5b,0x0a,0x2c,
-0x1c,0x30,0x00,0x01,0xde,0x80,0x49,0x10,0x40,0x44,0x06,0x12,0x87,0x9d,0x07,0x0e,
-0xb8,0x07,0x01,0x6d,0x02,0x24,0x5f,0x70,0xdd,0x01,0x10,0x60,0x98,0x3d,0x3f,0x21,
-0x11,0x11,0xcf,0x1b,0x04,0x64,0xf8,0x55,0x55,0x66,0x79,0xb2,0x7e,0x1e,0x1f,0xd2,
-0x81,0x31,0x0a,0x21,0x33,0x34,0x31,0x20,0x15,0x42,0xc4,0x1a,0x33,0x03,0x33,0x33,
-0x78,0x3d,0x11,0x03,0x37,0x02,0x00,0x55,0x27,0x00,0x86,0x41,0x1e,0x7f,0x5b,0x43,
-0x13,0x90,0xd8,0x00,0x00,0x53,0x0f,0x20,0x04,0xf9,0x39,0x01,0x00,0x55,0x04,0x04,
-0x2b,0x07,0x01,0x09,0x8b,0x11,0x01,0x3f,0x77,0x04,0x15,0x31,0x6e,0x25,0x56,0x66,
-0x65,0x54,0x40,0x06,0x03,0x25,0x64,0x5f,0x42,0x1b,0x0d,0x7b,0x5e,0x0b,0x12,0x34,
-0x0f,0xe7,0x44,0x05,0x00,0xdd,0x06,0x14,0x72,0xf3,0x05,0x18,0xf7,0xe3,0x00,0x00,
-0xe1,0x00,0x15,0x45,0xfe,0x1e,0x11,0x70,0x83,0x01,0x2a,0x21,0x11,0x91,0x48,0x01,
-0x83,0x01,0x10,0x70,0x48,0x00,0x00,0xc7,0x05,0x13,0x20,0x9e,0x15,0x02,0x43,0x25,
-0x04,0xa3,0x07,0x21,0xbf,0xff,0xcc,0x20,0x07,0x3b,0x01,0x11,0x22,0xa2,0x3e,0x15,
-0x42,0x0b,0x1e,0x03,0x99,0x64,0x08,0x8f,0x3a,0x05,0x71,0x27,0x64,0x02,0x78,0x88,
-0x87,0x77,0x6a,0x4a,0x03,0x01,0x7a,0x0c,0x00,0xe4,0x45,0x23,0x7a,0xf1,0x24,0x00,
-0x2b,0xee,0xc0,0x81,0x21,0x01,0xac,0x02,0x1e,0x06,0x62,0x21,0x00,0x10,0x06,0x19,
-0x12,0xac,0x07,0x00,0xfe,0x4b,0x28,0x4f,0x90,0x12,0x5f,0x10,0x55,0x2e,0x02,0x14,
-0x90,0x2e,0x02,0x10,0x70,0xc0,0x08,0x1c,0x11,0x2e,0x02,0x00,0xb0,0x01,0x20,0x69,
-0xb0,0x6e,0x1a,0x00,0xbb,0x00,0x17,0xd1,0xc3,0x03,0x04,0x82,0x33,0x05,0x13,0x02,
-0x00,0x2f,0x2f,0x00,0x81,0x02,0x17,0x42,0x25,0x00,0x01,0x23,0x26,0x17,0x50,0x85,
-0x4c,0x32,0x0a,0xf1,0x10,0x2b,0x04,0x11,0x0a,0x7c,0x3f,0x09,0x09,0x00,0x10,0xf2,
-0x15,0x3f,0x01,0x82,0x6a,0x04,0x91,0x07,0x18,0x34,0x15,0x3f,0x04,0x31,0x6e,0x21,
-0xba,0x1d,0x86,0x01,0x62,0x0c,0xa0,0x89,0x98,0x87,0xfa,0x38,0x16,0x22,0x0e,0xa0,
-0x3c,0x40,0x1d,0xea,0x0f,0x00,0x10,0xcb,0xda,0x0c,0x42,0xa0,0x00,0x0c,0xb0,0xcd,
-0x08,0x32,0xcb,0x0f,0x80,0x1c,0x38,0x02,0xbe,0x07,0x0f,0x0f,0x00,0x05,0xd4,0xfd,
-0x99,0xaa,0xbd,0xfc,0x00,0xcb,0x07,0xbc,0xcb,0xa9,0x86,0x20,0x49,0x38,0x1a,0xcb,
-0x58,0x38,0x0b,0x0f,0x00,0x14,0x98,0x9c,0x5a,0x11,0x05,0xf2,0x00,0x31,0x08,0xf0,
-0x0c,0xca,0x03,0x02,0x86,0x45,0x03,0x3c,0x5b,0x18,0x08,0x08,0x00,0x00,0x20,0x00,
-0x00,0x08,0x00,0x20,0x0f,0xb7,0x47,0x22,0x22,0x08,0xf0,0x7c,0x00,0x07,0x08,0x00,
-0x00,0x3f,0x11,0x32,0x50,0x08,0xf0,0x3f,0x11,0x22,0x08,0xf0,0x3f,0x11,0x04,0xa1,
-0x06,0x16,0x01,0x23,0x0c,0x04,0x86,0x4a,0x10,0x02,0x38,0x0a,0x1c,0x3c,0x53,0x2a,
-0x0f,0x08,0x00,0x05,0x1b,0xd0,0xf4,0x56,0x60,0x10,0x01,0x22,0x23,0x33,0x20,0x0c,
-0x1b,0x03,0xb8,0x00,0x43,0x01,0x33,0x32,0x2a,0xc0,0x00,0x00,0xf1,0x1a,0x05,0x08,
+0x15,0x08,0x39,0x00,0x37,0x8e,0x00,0x00,0x13,0x00,0x90,0x21,0x01,0x23,0x57,0x10,
+0x8e,0x00,0x00,0x05,0x9b,0x00,0x10,0xe3,0x13,0x00,0x41,0x03,0x45,0x54,0x32,0x26,
+0x00,0x24,0x00,0x00,0x26,0x00,0x02,0x01,0x00,0x15,0x8f,0x13,0x00,0x1d,0xf0,0x13,
+0x00,0x3d,0x07,0xe0,0x00,0x01,0x00,0xf0,0x02,0x23,0x00,0x00,0x04,0x44,0x44,0x44,
+0x10,0x00,0xad,0x00,0x00,0x6f,0xff,0xff,0xff,0x90,0xda,0x00,0x74,0x7f,0x32,0x21,
+0x10,0x00,0x00,0xae,0x8d,0x00,0x17,0xae,0xcf,0x00,0x0b,0x09,0x00,0x33,0x9f,0xff,
+0xfb,0x09,0x00,0x28,0x88,0x85,0x1b,0x00,0x42,0x02,0x44,0x00,0x9e,0x51,0x00,0x10,
+0xfd,0x09,0x00,0x74,0x05,0x67,0x66,0x53,0x10,0x00,0x9e,0x75,0x00,0x09,0x09,0x00,
+0x23,0x2b,0x20,0x09,0x00,0x60,0x4f,0x50,0x00,0x00,0x00,0x34,0x09,0x00,0x03,0x77,
+0x01,0x0f,0x09,0x00,0x01,0xa0,0x96,0x55,0x55,0x55,0x66,0x00,0x00,0x00,0x2f,0xff,
+0x01,0x00,0x00,0x3b,0x00,0x45,0x11,0x11,0x11,0x10,0xcf,0x00,0x84,0x12,0x00,0x00,
+0x04,0x33,0x33,0x34,0x10,0x7e,0x00,0x12,0x80,0xcf,0x00,0x2f,0x22,0x11,0xc6,0x00,
+0x0b,0x24,0x88,0x85,0xcf,0x00,0x13,0xfa,0x09,0x00,0x03,0xc6,0x00,0x00,0x63,0x01,
+0x60,0x6f,0xfe,0xef,0xff,0xfd,0x00,0x7f,0x01,0x46,0x77,0x76,0x54,0x20,0x75,0x01,
+0x50,0x25,0x00,0x00,0x00,0x03,0x09,0x00,0x10,0x01,0x99,0x00,0x90,0x30,0x00,0x00,
+0x00,0x6e,0x00,0x00,0x00,0x5f,0x09,0x00,0x10,0x7f,0x09,0x00,0x50,0x52,0x22,0x22,
+0x22,0x8f,0x09,0x00,0x01,0xab,0x00,0x00,0x09,0x00,0x54,0x64,0x44,0x43,0x33,0x9f,
+0x2d,0x00,0x14,0x7f,0x09,0x00,0x10,0x8e,0x09,0x00,0x11,0xff,0x2b,0x01,0x00,0x2a,
+0x01,0x45,0x77,0x77,0x77,0x62,0xd0,0x00,0x11,0x05,0x06,0x00,0xf2,0x16,0x0d,0x60,
+0x03,0xf3,0x0c,0xed,0xdd,0xed,0x10,0xf8,0x00,0x4f,0x30,0xfc,0x88,0x88,0x60,0x0f,
+0x80,0x04,0xf3,0x1f,0x70,0x00,0x00,0x00,0xf8,0x00,0x3f,0x31,0xf7,0x00,0x00,0x00,
+0x0e,0x80,0x03,0x11,0x00,0x1c,0xe8,0x11,0x00,0x32,0xeb,0x66,0x8f,0x11,0x00,0x2e,
+0xff,0xff,0x22,0x00,0x0e,0x11,0x00,0xc0,0x92,0x33,0x58,0x60,0xe8,0x00,0x3f,0x30,
+0xef,0xff,0xff,0xd8,0x11,0x00,0x31,0x00,0x33,0x21,0x22,0x00,0x23,0x30,0x00,0x22,
+0x00,0x01,0x91,0x00,0x07,0x11,0x00,0x32,0xf4,0x00,0x00,0x88,0x00,0x11,0x40,0xd5,
+0x02,0x33,0x40,0x02,0xf3,0xbb,0x00,0x13,0x01,0x08,0x00,0x22,0x30,0x00,0x22,0x00,
+0xf2,0x00,0xae,0xee,0xee,0xee,0x20,0x00,0xf8,0xed,0x88,0x98,0x86,0x00,0x00,0xf8,
+0xf9,0x15,0x00,0x0f,0x07,0x00,0x05,0x30,0x7c,0xcc,0xcd,0x07,0x00,0x3f,0x4a,0xaa,
+0xa9,0x2a,0x00,0x0a,0xf1,0x02,0xfa,0x22,0x34,0x57,0x95,0x00,0xf8,0xcf,0xff,0xff,
+0xfe,0xc5,0x00,0xf8,0x02,0x33,0x21,0x8b,0x00,0x2f,0x00,0x00,0x07,0x00,0x0c,0x19,
+0xd6,0x03,0x03,0xa1,0x12,0x02,0x43,0x33,0x34,0x30,0x00,0x09,0xe0,0xdf,0x52,0x02,
+0x50,0x9f,0x0e,0xa2,0x22,0x21,0xb2,0x03,0x12,0xe9,0x3e,0x03,0x91,0x0f,0x90,0x00,
+0x00,0x47,0x77,0x7b,0xf0,0xf9,0xb3,0x03,0x32,0xff,0x0f,0x90,0x5e,0x03,0x13,0xf9,
+0x1e,0x00,0xc4,0xc7,0x66,0x78,0xad,0x60,0x08,0xe0,0x8e,0xff,0xee,0xdc,0xa3,0xd9,
+0x02,0x34,0x08,0xd0,0x00,0x05,0x01,0x60,0x77,0x77,0x88,0x88,0x89,0x60,0x04,0x02,
+0x54,0xfe,0xee,0xfe,0x00,0x00,0x1f,0x04,0x02,0x7f,0x02,0x20,0x04,0xef,0xf7,0x01,
+0xa3,0xd0,0x00,0x7f,0x98,0x88,0x88,0x87,0x73,0x00,0x07,0x3b,0x01,0x22,0x6f,0x30,
+0xfc,0x01,0x30,0xff,0xee,0xee,0x8a,0x04,0x73,0x05,0x88,0x87,0x77,0x77,0x66,0x10,
+0xb0,0x03,0x02,0xad,0x00,0x20,0x0a,0xd0,0xad,0x00,0x70,0x10,0x00,0xad,0x0e,0xa2,
+0x22,0x11,0x98,0x04,0x02,0xad,0x00,0xf0,0x01,0xad,0x0e,0x90,0x00,0x00,0x24,0x44,
+0x4c,0xd0,0xf9,0x00,0x00,0x0d,0xff,0xff,0xfd,0xad,0x00,0x52,0x02,0x22,0x2b,0xd0,
+0xf9,0x1e,0x00,0x00,0x0f,0x00,0xf2,0x04,0x14,0x10,0x0b,0xd0,0xef,0xdd,0xee,0xff,
+0xf6,0x00,0xad,0x03,0x78,0x87,0x77,0x74,0x00,0x0a,0xc0,0x5a,0x00,0x15,0x56,0x11,
+0x01,0x10,0xdf,0x96,0x00,0xf0,0x00,0xfe,0x10,0x05,0x77,0x77,0x77,0x77,0x66,0x50,
+0x00,0x00,0x73,0x00,0x00,0x48,0xed,0x01,0x12,0x90,0x68,0x04,0x12,0xe9,0xb3,0x02,
+0x03,0x0f,0x00,0x72,0x12,0xea,0x22,0x22,0x9f,0x34,0x20,0x90,0x03,0x8a,0xfb,0x00,
+0x33,0x33,0x33,0x33,0x32,0x21,0xbf,0x02,0xf1,0x08,0x06,0xd0,0x05,0xf1,0x0c,0xcc,
+0xcc,0xcb,0x00,0x8f,0x00,0x5f,0x12,0xfb,0x99,0x98,0x60,0x08,0xf0,0x06,0xf1,0x2f,
+0x50,0x9b,0x04,0x30,0x6f,0x12,0xf5,0x9a,0x04,0x04,0x11,0x00,0x1a,0x7f,0x11,0x00,
+0xe1,0x7c,0xcc,0xdf,0x00,0x6f,0x13,0xf4,0x00,0x06,0xaa,0xad,0xf0,0x06,0xf1,0x63,
+0x02,0x51,0x7f,0x00,0x5f,0x13,0xf4,0x22,0x00,0x2e,0x05,0xf1,0x11,0x00,0xc0,0x62,
+0x23,0x57,0x50,0x7f,0x00,0x5f,0x11,0xff,0xff,0xff,0xe8,0x11,0x00,0x40,0x02,0x44,
+0x43,0x10,0x22,0x00,0x23,0x10,0x00,0x22,0x00,0x12,0x00,0x5e,0x05,0x22,0x5f,0x10,
+0x37,0x05,0x24,0x05,0xf2,0x11,0x00,0x11,0x20,0xb0,0x00,0x3c,0x80,0x03,0xf1,0x22,
+0x05,0xf0,0x06,0x10,0x01,0x11,0x12,0x00,0x04,0xf1,0x04,0xf2,0xcf,0xff,0xff,0xc0,
+0x05,0xf3,0x05,0xf3,0xec,0x45,0x54,0x20,0x08,0x00,0x95,0xea,0x00,0x00,0x00,0x04,
+0xf3,0x04,0xf4,0xe9,0x08,0x00,0xe0,0x04,0xbc,0xcd,0xf4,0x04,0xf4,0xf9,0x00,0x04,
+0xba,0xab,0xf4,0x04,0xf3,0x75,0x01,0x17,0x03,0x08,0x00,0x40,0xfa,0x23,0x36,0x84,
+0x08,0x00,0x40,0xcf,0xff,0xff,0xd5,0x08,0x00,0x82,0x03,0x33,0x10,0x00,0x03,0xf3,
+0x04,0xf3,0x26,0x03,0x25,0x01,0x70,0x72,0x00,0x11,0x0b,0x4c,0x01,0x93,0xb0,0x00,
+0x05,0x77,0x66,0x66,0x66,0x6c,0xf0,0x36,0x02,0x0e,0x08,0x00,0x09,0x4e,0x02,0x23,
+0x0a,0xe0,0x73,0x01,0x13,0x70,0x76,0x03,0x10,0x50,0x83,0x03,0xf1,0x04,0x07,0xf0,
+0x04,0xf2,0xbf,0xff,0xff,0x90,0x08,0xf1,0x03,0xf3,0xec,0x56,0x65,0x10,0x07,0xf1,
+0x03,0xb8,0x00,0x00,0x08,0x00,0x13,0xe9,0x08,0x00,0x50,0xf9,0x00,0x02,0x66,0x6a,
+0x08,0x00,0x00,0xe0,0x02,0x00,0x08,0x00,0x00,0xb3,0x01,0x0d,0x08,0x00,0x60,0x04,
+0xf2,0xfd,0x88,0x9b,0xe8,0x08,0x00,0x40,0x7d,0xdd,0xba,0x72,0x08,0x00,0x01,0xdb,
+0x01,0x05,0x08,0x00,0x70,0x05,0xf2,0x00,0x08,0xc0,0x00,0x05,0x52,0x01,0x20,0x0a,
+0xf0,0xfa,0x02,0x12,0x70,0x08,0x00,0x07,0x9b,0x00,0x05,0x08,0x00,0x81,0xf6,0x55,
+0x55,0x56,0x78,0x80,0x00,0x06,0xe8,0x00,0x75,0xe2,0x00,0x00,0x01,0x11,0x00,0x00,
+0x2e,0x04,0x10,0x40,0x70,0x01,0x36,0x05,0xf2,0x05,0x70,0x01,0x44,0x44,0x44,0x10,
+0x04,0x70,0x01,0x01,0x60,0x01,0x30,0x01,0x55,0x58,0x08,0x00,0x00,0x41,0x00,0x01,
+0x08,0x00,0x39,0x00,0x11,0x03,0x70,0x01,0x20,0x02,0x42,0x08,0x00,0x40,0xdf,0xff,
+0xff,0xf8,0x08,0x00,0x54,0x26,0x76,0x53,0x10,0x02,0x68,0x01,0xd1,0x10,0x00,0x40,
+0x00,0x01,0x56,0x66,0x66,0x66,0x64,0x20,0x00,0x07,0x80,0x00,0x10,0xf0,0x15,0x00,
+0x06,0x30,0x07,0x20,0x08,0xf0,0xb5,0x03,0x70,0x78,0x88,0x8c,0xf0,0x00,0x08,0xff,
+0xb6,0x03,0x33,0x90,0x00,0x08,0x14,0x02,0x04,0x08,0x00,0x11,0x07,0x99,0x03,0xf0,
+0x01,0xf8,0x00,0x00,0x68,0x88,0x77,0x77,0x76,0x61,0x00,0x01,0xce,0xed,0xdd,0xdd,
+0xdd,0x45,0x00,0x61,0x3f,0xa8,0x88,0x88,0x87,0x60,0xa8,0x00,0x1c,0x00,0xbb,0x06,
+0x0f,0x13,0x00,0x13,0x70,0x02,0xfe,0xdd,0xdd,0xee,0xff,0x90,0x53,0x01,0x43,0x99,
+0x99,0x88,0x87,0x0a,0x06,0x01,0xcc,0x08,0x08,0xee,0x01,0x01,0xcf,0x06,0x0c,0x13,
+0x00,0x11,0x9e,0x9d,0x00,0xc0,0xee,0xee,0xef,0xff,0xfe,0xee,0xee,0xee,0xe0,0x38,
+0x88,0x87,0xc9,0x00,0x28,0x88,0x86,0xce,0x02,0x21,0xdf,0xff,0x16,0x07,0xc4,0x00,
+0x01,0xfb,0x66,0x77,0x77,0x66,0x20,0x00,0x00,0x01,0xf8,0x7a,0x00,0x0d,0x09,0x00,
+0x60,0x01,0xfa,0x22,0x22,0x23,0x34,0x8d,0x04,0x01,0x29,0x01,0x10,0xf2,0x1c,0x00,
+0x42,0x33,0x9f,0x43,0x22,0x8b,0x04,0x01,0x59,0x09,0x05,0x09,0x00,0x01,0xe5,0x06,
+0x00,0xc4,0x06,0x21,0x27,0x77,0x01,0x00,0x2e,0x78,0x85,0x6c,0x08,0x00,0x9c,0x00,
+0xd4,0xee,0xee,0xff,0xe1,0x00,0x00,0x03,0x88,0x88,0x88,0x88,0x7b,0xf3,0x26,0x04,
+0x0f,0x09,0x00,0x10,0x24,0x06,0xf2,0x95,0x00,0x1f,0x50,0xcf,0x00,0x0a,0x24,0x02,
+0xf7,0xc6,0x00,0x0e,0x09,0x00,0x0f,0xcf,0x00,0x02,0x3a,0x33,0x22,0x10,0x26,0x09,
+0x18,0x8f,0xcf,0x00,0x1f,0xfc,0xcf,0x00,0x02,0x32,0x03,0x57,0x54,0x9e,0x00,0x41,
+0xef,0xfe,0xff,0xe6,0x2f,0x00,0x40,0xc3,0x00,0x03,0xcf,0xf8,0x01,0x50,0xdd,0x00,
+0x00,0x00,0x0c,0xfe,0x05,0x14,0xf9,0x53,0x02,0x32,0xfa,0x00,0x00,0x09,0x03,0xe1,
+0xaf,0x40,0x00,0x00,0x5f,0xa0,0x00,0x00,0x00,0x1d,0xfb,0x87,0x8c,0xfc,0x75,0x00,
+0x36,0x6a,0xcd,0xca,0xce,0x00,0x14,0x14,0x25,0x01,0xf3,0x03,0xf0,0x00,0xbd,0xdd,
+0xdd,0xde,0xc0,0x00,0x7f,0x00,0x1f,0xc8,0x88,0x88,0x75,0x00,0x07,0xf0,0xa4,0x01,
+0x41,0x6f,0x00,0x2f,0x80,0x0c,0x01,0x2b,0xf0,0x02,0x11,0x00,0x14,0xf1,0x22,0x00,
+0xa2,0x10,0x1f,0x91,0x11,0x12,0x34,0x00,0x06,0xf1,0x00,0xc6,0x0a,0x90,0x6f,0x10,
+0x01,0x55,0x55,0x44,0x32,0x00,0x06,0xbb,0x02,0x11,0x20,0x22,0x00,0x40,0x00,0x00,
+0x2f,0x30,0x33,0x00,0x00,0x2d,0x03,0x03,0x11,0x00,0x24,0x3f,0x40,0x11,0x00,0x51,
+0x12,0x47,0x70,0x6f,0x11,0xfa,0x00,0x82,0xe9,0x06,0xf1,0x05,0x56,0x65,0x54,0x32,
+0x22,0x00,0x02,0x66,0x00,0x13,0x00,0xa0,0x06,0x13,0x20,0xbf,0x02,0x1c,0xf0,0xe1,
+0x01,0x70,0x15,0x00,0x01,0x66,0x66,0x66,0x66,0xc4,0x00,0x11,0x7f,0xdb,0x03,0x12,
+0x7f,0xc7,0x0a,0x00,0x3c,0x00,0x22,0x8f,0x10,0xa2,0x00,0x14,0x08,0x11,0x00,0x13,
+0x7f,0x11,0x00,0xe1,0x07,0xf7,0x44,0x55,0x66,0x20,0x06,0xf1,0x00,0x3f,0xff,0xff,
+0xff,0xe6,0x6f,0x00,0x23,0x1f,0x70,0x6f,0x00,0x13,0xf7,0xa2,0x00,0x70,0x0f,0x70,
+0x24,0x65,0x06,0xf1,0x2e,0x78,0x03,0x96,0xfe,0x90,0x6f,0x10,0x67,0x77,0x76,0x65,
+0x31,0x91,0x00,0x00,0x4a,0x00,0x13,0x20,0xa2,0x00,0x01,0x56,0x00,0x14,0x3a,0x3f,
+0x0b,0x14,0x00,0xe3,0x09,0x08,0x11,0x00,0x90,0x97,0x77,0x77,0x77,0x86,0x00,0x00,
+0x03,0xef,0xe0,0x03,0x14,0xd0,0x1e,0x02,0x03,0xbb,0x00,0x23,0x05,0xf1,0xbb,0x00,
+0x43,0x6f,0x20,0x07,0xf1,0x7a,0x02,0x13,0x8f,0xf7,0x00,0x23,0x08,0xf0,0x11,0x00,
+0x13,0x7f,0x11,0x00,0x10,0x06,0x0a,0x04,0x91,0x70,0x06,0xf2,0x00,0x05,0x78,0xfb,
+0x76,0x51,0x19,0x01,0x23,0x0f,0x70,0xad,0x02,0x11,0xf7,0x22,0x00,0xf4,0x00,0x45,
+0x55,0x5f,0xb7,0x9b,0xda,0x06,0xf2,0x1f,0xff,0xff,0xfe,0xdc,0xa7,0x30,0x3b,0x01,
+0x08,0x67,0x06,0x20,0x03,0x77,0xa7,0x03,0xd3,0x50,0x00,0x00,0xbf,0xff,0xff,0xff,
+0xee,0xff,0x00,0x00,0x0b,0xe0,0xe0,0x05,0x13,0xbe,0x8b,0x0a,0x06,0x11,0x00,0x83,
+0x43,0x33,0x33,0x34,0xbe,0x00,0x00,0x08,0x22,0x06,0x42,0x00,0x03,0x34,0x43,0xc1,
+0x02,0x10,0x67,0xa6,0x02,0x12,0x20,0x23,0x0c,0x20,0xfe,0xed,0x84,0x00,0x05,0x3a,
+0x03,0x0f,0x09,0x00,0x10,0xa0,0x05,0xf9,0x66,0x66,0x77,0x8a,0xa0,0x00,0x00,0x01,
+0x51,0x03,0x3f,0xed,0xb0,0x00,0x01,0x00,0x08,0x41,0x5e,0xee,0xdd,0xdd,0x64,0x04,
+0xb6,0x27,0x88,0x88,0x88,0xbf,0x87,0x77,0x66,0x63,0x00,0x00,0x25,0x02,0x0f,0x09,
+0x00,0x1b,0x1b,0x5e,0x5c,0x00,0x50,0x01,0x11,0x11,0x11,0x11,0x08,0x00,0x13,0xff,
+0xd8,0x03,0x31,0x03,0xf9,0x44,0x9e,0x0c,0x34,0x00,0x03,0xf6,0x2e,0x01,0x05,0x09,
+0x00,0x05,0xd8,0x03,0x10,0xff,0x56,0x04,0x00,0x73,0x01,0x13,0x46,0xb1,0x08,0x05,
+0x8f,0x02,0x20,0x55,0x44,0x01,0x00,0x34,0x55,0x54,0x6f,0xcf,0x03,0x00,0x2f,0x0c,
+0x1a,0x8f,0x19,0x0d,0x72,0x04,0x88,0x88,0xcf,0x99,0x9c,0xb0,0x9e,0x04,0x34,0xdd,
+0xde,0xf1,0x40,0x0d,0x08,0x09,0x00,0x23,0x06,0xee,0x2a,0x06,0xa4,0x09,0xf8,0x77,
+0x77,0x66,0x66,0x30,0x00,0x00,0x09,0x1f,0x00,0x02,0x09,0x00,0x10,0x10,0x94,0x01,
+0x20,0xee,0xee,0x02,0x09,0x00,0x17,0x06,0x46,0x88,0x88,0x77,0x62,0xd8,0x03,0x10,
+0x01,0x9c,0x01,0x21,0x00,0x06,0x14,0x03,0x43,0xfe,0xd2,0x00,0x6f,0x6c,0x06,0x00,
+0x14,0x03,0x03,0x0f,0x01,0x02,0x11,0x00,0x14,0x05,0x11,0x00,0x10,0x5f,0x25,0x03,
+0x33,0x01,0x22,0x10,0x8c,0x02,0x10,0xfa,0xaf,0x08,0x64,0x56,0x66,0x65,0x43,0x00,
+0x05,0x76,0x00,0x02,0xc0,0x08,0x00,0x33,0x00,0xf1,0x00,0x05,0x66,0x66,0x67,0x8a,
+0xbd,0xe0,0x5f,0x10,0xde,0xff,0xff,0xfd,0xba,0x73,0x22,0x00,0x13,0xe9,0x22,0x00,
+0x00,0x0e,0x0a,0x0f,0x11,0x00,0x0b,0x23,0x0f,0x80,0x11,0x00,0x00,0x40,0x04,0x00,
+0x04,0x09,0xf0,0x00,0x0a,0x40,0x00,0x00,0x04,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0xf3,0x08,0x00,0x00,0x67,0x77,0x77,0x77,0x77,0x40,0x00,0x00,0x00,
+0x5f,0xff,0xff,0xff,0xfe,0xe9,0x00,0x00,0x00,0x06,0xf3,0x00,0x01,0x00,0x23,0x6f,
+0x30,0x09,0x00,0x0f,0x13,0x00,0x0a,0xff,0x02,0x5f,0x96,0x66,0x67,0x78,0x98,0x10,
+0x00,0x00,0x01,0xdf,0xff,0xff,0xff,0xee,0xc2,0x00,0x01,0x00,0x0a,0xf1,0x0b,0x5e,
+0xee,0xdd,0xdd,0xee,0xee,0xef,0xff,0xff,0x02,0x78,0x88,0xfd,0x88,0x77,0x7f,0xb6,
+0x66,0x40,0x00,0x00,0x0e,0xa0,0x00,0x01,0xf7,0x1f,0x00,0x7f,0xea,0x00,0x00,0x1f,
+0x70,0x00,0x00,0x13,0x00,0x10,0x10,0x60,0x09,0x00,0x5a,0x0d,0x80,0x00,0x00,0xe4,
+0x61,0x00,0x50,0x01,0x11,0x11,0x11,0x11,0x08,0x00,0x10,0xff,0x01,0x00,0xe3,0x80,
+0x00,0x00,0x03,0xf9,0x44,0x44,0x44,0x44,0x10,0x00,0x00,0x03,0xf6,0x23,0x00,0x06,
+0x09,0x00,0x13,0xf7,0x09,0x00,0xf6,0x01,0x02,0xff,0xee,0xee,0xee,0xff,0xf2,0x00,
+0x00,0x00,0x46,0x77,0x77,0x77,0x66,0x50,0x4f,0x00,0x30,0x27,0x77,0x66,0x01,0x00,
+0x50,0x77,0x76,0x5d,0xee,0xef,0x22,0x01,0xb6,0xed,0xda,0x00,0x00,0x09,0xe0,0x00,
+0x06,0xf1,0x00,0x00,0x09,0x00,0xf3,0x01,0x04,0x8c,0xf8,0x89,0x9c,0xfc,0xb0,0x00,
+0x00,0x07,0xee,0xee,0xee,0xdd,0xde,0xf2,0x3c,0x00,0x18,0x08,0x09,0x00,0x20,0x06,
+0xef,0x90,0x00,0x80,0xf1,0x00,0x00,0x09,0xf8,0x77,0x66,0x66,0xf6,0x00,0x23,0x09,
+0xf1,0x1f,0x00,0x02,0x09,0x00,0xf0,0x15,0x10,0x00,0x00,0x08,0xff,0xee,0xee,0xff,
+0xff,0xfb,0x00,0x00,0x00,0x68,0x88,0x88,0x88,0x77,0x62,0x00,0x00,0x01,0xce,0xed,
+0xdd,0xdd,0xdd,0x10,0x00,0x00,0x04,0xfa,0x88,0x88,0x88,0x76,0x6c,0x00,0x04,0x79,
+0x01,0x1f,0x05,0x09,0x00,0x10,0x05,0x2d,0x00,0xff,0x02,0x03,0xfe,0xdd,0xdd,0xee,
+0xff,0x90,0x00,0x00,0x00,0x69,0x99,0x99,0x88,0x76,0x10,0x00,0x01,0x00,0x11,0xb2,
+0x04,0x44,0x44,0x43,0x33,0x34,0x44,0x44,0x43,0x6f,0xff,0x01,0x00,0x32,0xfe,0x03,
+0x33,0x01,0x00,0x17,0x21,0x26,0x00,0x13,0xdf,0x68,0x01,0xb4,0x01,0xfb,0x66,0x77,
+0x77,0x66,0x20,0x00,0x00,0x01,0xf8,0x56,0x01,0x0d,0x09,0x00,0x60,0x01,0xfa,0x22,
+0x22,0x23,0x34,0x44,0x02,0x01,0x50,0x00,0x10,0xf2,0x1c,0x00,0x4f,0x23,0x33,0x33,
+0x22,0x90,0x00,0x01,0x13,0x5f,0x75,0x00,0xae,0xfd,0x27,0x77,0x77,0x76,0x66,0x77,
+0x77,0x77,0x75,0x25,0x00,0x01,0x71,0x01,0xbf,0xee,0xff,0xe1,0x00,0x00,0x03,0x88,
+0x88,0x88,0x88,0x7b,0x1c,0x01,0x19,0x24,0x06,0xf2,0x95,0x00,0x00,0xef,0x01,0x40,
+0x56,0x66,0x66,0x66,0xbd,0x00,0x20,0x00,0x1f,0x74,0x00,0x10,0xf7,0x99,0x00,0x14,
+0xf7,0x65,0x00,0x11,0x2f,0x7f,0x02,0x0f,0x13,0x00,0x04,0x10,0xfb,0x1e,0x02,0x00,
+0x0e,0x00,0x10,0x0c,0xe1,0x01,0x1e,0xed,0x5a,0x01,0x03,0x94,0x02,0x00,0x01,0x00,
+0x33,0x10,0x06,0xff,0x01,0x00,0xa8,0xe0,0x16,0x66,0x55,0x55,0x55,0x55,0x66,0x66,
+0x64,0x28,0x00,0x05,0x78,0x02,0x24,0x3f,0x50,0x83,0x01,0x14,0xf5,0x13,0x00,0x24,
+0x4f,0x40,0x13,0x00,0x15,0xf4,0x13,0x00,0x91,0xa6,0x66,0x66,0x66,0x67,0x30,0x00,
+0x00,0x02,0x5c,0x02,0x1f,0xfa,0x08,0x03,0x02,0x11,0x00,0x1c,0x00,0x10,0x90,0xa0,
+0x01,0x40,0x44,0x55,0x55,0x44,0xa8,0x03,0x14,0xf9,0x23,0x00,0x05,0x97,0x01,0x14,
+0xf9,0x36,0x00,0x01,0x08,0x03,0x00,0x74,0x00,0x67,0x36,0x67,0x77,0x77,0x66,0x51,
+0x0c,0x02,0x11,0x43,0xf9,0x01,0x06,0x0c,0x02,0x63,0xfd,0x00,0x11,0x11,0x22,0x21,
+0x64,0x00,0x04,0x66,0x02,0x00,0x85,0x01,0x50,0x99,0x70,0x00,0x00,0x07,0x22,0x00,
+0x29,0xef,0xf0,0xe0,0x02,0x03,0x09,0x00,0x50,0x05,0xcd,0xde,0xee,0xee,0x1b,0x00,
+0x7f,0x09,0xf9,0x99,0x99,0x99,0x99,0x50,0x08,0x03,0x04,0x12,0xef,0xd0,0x00,0x10,
+0x67,0xfc,0x01,0x2f,0x62,0x00,0x6f,0x02,0x12,0x0e,0x09,0x00,0x06,0x6f,0x02,0x1f,
+0xef,0x6f,0x02,0x16,0x31,0xfc,0x27,0x77,0x01,0x00,0x38,0x88,0x85,0x00,0xda,0x00,
+0x22,0x57,0x54,0x3e,0x02,0x41,0xef,0xfe,0xff,0xe6,0x2f,0x00,0x40,0xc3,0x00,0x03,
+0xbf,0x84,0x04,0x10,0xdd,0xfb,0x01,0x50,0xd0,0x00,0x00,0x00,0xf9,0xe9,0x03,0x00,
+0xf3,0x00,0x10,0xfb,0xcb,0x00,0x00,0x09,0x00,0xe1,0xaf,0x50,0x00,0x00,0x4f,0xa0,
+0x00,0x00,0x00,0x1d,0xfc,0x87,0x8c,0xfc,0x75,0x00,0x35,0x6a,0xcd,0xca,0xe5,0x01,
+0x12,0x31,0x07,0x00,0xf2,0x01,0xf8,0xae,0xee,0xee,0xee,0x20,0x00,0xf8,0xec,0x88,
+0x87,0x76,0x00,0x00,0xf8,0xe8,0x15,0x00,0x03,0x07,0x00,0x1f,0xf8,0x07,0x00,0x07,
+0x1f,0xf9,0x07,0x00,0x09,0xf3,0x02,0xeb,0x44,0x45,0x68,0xa6,0x00,0xf9,0xaf,0xff,
+0xff,0xfd,0xb5,0x00,0xf9,0x01,0x11,0x10,0xa1,0x00,0x0f,0x07,0x00,0x05,0x03,0x32,
+0x01,0x19,0xd6,0x13,0x01,0x80,0x23,0x24,0x33,0x33,0x43,0x00,0x00,0xbd,0x73,0x01,
+0xa0,0x10,0x00,0xbd,0xea,0x22,0x21,0x10,0x00,0x00,0xbd,0x24,0x06,0x06,0x07,0x00,
+0x1f,0xf9,0x07,0x00,0x07,0xf2,0x00,0xbc,0xfd,0x77,0x78,0x9b,0xd5,0x00,0xbc,0x8e,
+0xee,0xed,0xcb,0x81,0x00,0xbc,0x54,0x00,0x03,0x07,0x00,0xf0,0x09,0x44,0x00,0x00,
+0x05,0xad,0xdb,0x93,0x00,0x00,0x01,0xcf,0xc8,0x89,0xef,0x90,0x00,0x0b,0xf4,0x00,
+0x00,0x07,0xf6,0x00,0x1f,0xa2,0x04,0x30,0xdc,0x00,0x3f,0x59,0x01,0x41,0xad,0x00,
+0x2f,0x80,0x0e,0x00,0xf4,0x04,0x0c,0xf3,0x00,0x00,0x06,0xf7,0x00,0x02,0xef,0xb8,
+0x79,0xdf,0xb0,0x00,0x00,0x17,0xbc,0xdc,0x94,0xcc,0x03,0x05,0xc9,0x01,0xf0,0x03,
+0xf7,0x00,0x00,0xae,0xee,0xc0,0xae,0xee,0xd0,0x0f,0x70,0x00,0x0e,0xd7,0x75,0x0e,
+0xd7,0x75,0x13,0x00,0x11,0xea,0x03,0x00,0x20,0x0f,0x80,0x3b,0x06,0x21,0x0e,0xa0,
+0xe6,0x00,0x11,0xe9,0x03,0x00,0x00,0x13,0x00,0x10,0x90,0x03,0x00,0x00,0x13,0x00,
+0x11,0xf9,0x03,0x00,0x22,0x0f,0x90,0x03,0x00,0x00,0x9b,0x04,0x13,0xf2,0x13,0x00,
+0x23,0xb7,0x75,0x13,0x00,0x06,0x26,0x00,0x26,0x80,0x00,0x13,0x00,0xf4,0x0c,0xea,
+0x01,0x00,0xea,0x11,0x30,0x0f,0x80,0x00,0x0c,0xff,0xfe,0x0c,0xff,0xff,0x70,0xf8,
+0x00,0x00,0x14,0x44,0x20,0x14,0x44,0x20,0x0f,0x80,0x98,0x00,0x04,0x8a,0x02,0x01,
+0x33,0x00,0x09,0x72,0x01,0x08,0x13,0x00,0x2e,0xd8,0x00,0x01,0x00,0x12,0x03,0xdc,
+0x00,0xff,0x17,0x6d,0x00,0xe8,0x3e,0xee,0x54,0xee,0xe7,0x08,0xe0,0x0f,0x86,0xf7,
+0x62,0x8f,0x76,0x20,0x8e,0x00,0xf8,0x6f,0x00,0x08,0xe0,0x00,0x08,0xe0,0x0e,0x87,
+0xf0,0x00,0x8e,0x00,0x00,0x8e,0x00,0xe8,0x7f,0x11,0x00,0x03,0x22,0xfa,0xaf,0x11,
+0x00,0x31,0x8f,0xbb,0xf8,0x11,0x00,0x14,0x07,0x22,0x00,0x13,0x7e,0x22,0x00,0x0c,
+0x11,0x00,0xf2,0x06,0x12,0x07,0xe0,0x0e,0x85,0xff,0xfc,0x6f,0xff,0xf4,0x7e,0x00,
+0xe8,0x03,0x44,0x10,0x34,0x42,0x07,0xe0,0x0e,0xcc,0x00,0x22,0x7e,0x00,0x92,0x02,
+0x05,0x11,0x00,0x14,0x7f,0x11,0x00,0x13,0xf0,0x11,0x00,0x18,0x48,0xc7,0x00,0xf3,
+0x06,0x3e,0xee,0xee,0x23,0xee,0xee,0xf6,0x00,0x00,0x07,0xf8,0x77,0x70,0x6f,0x87,
+0x77,0x20,0x00,0x00,0x7f,0x10,0x73,0x05,0x21,0x07,0xf1,0x0d,0x00,0x11,0x00,0x06,
+0x00,0x2f,0x07,0xf1,0x13,0x00,0x08,0x21,0x6f,0x20,0x6b,0x03,0xf2,0x00,0xfe,0xff,
+0x85,0xff,0xef,0xfc,0x00,0x00,0x00,0x57,0x76,0x62,0x05,0x77,0x77,0x41,0x03,0x24,
+0x25,0x00,0x5d,0x07,0x14,0xf0,0x0a,0x00,0x24,0x9f,0x00,0x49,0x04,0x05,0x13,0x00,
+0x13,0x9e,0x25,0x06,0xf1,0x13,0xef,0xff,0xfe,0xee,0xee,0xee,0xe0,0x38,0x88,0x87,
+0x77,0x77,0x78,0x88,0x88,0x86,0x00,0x00,0x03,0x77,0x77,0x20,0x67,0x77,0x61,0x00,
+0x00,0x0d,0xfe,0xff,0x75,0xff,0xff,0xf4,0x60,0x08,0x02,0xd6,0x08,0x00,0x09,0x00,
+0x1f,0xf2,0x09,0x00,0x0d,0xd1,0xc5,0x55,0x35,0xf8,0x55,0x63,0x00,0x00,0x0a,0xff,
+0xff,0xb2,0xef,0xac,0x04,0x1f,0x01,0x48,0x07,0x05,0x13,0x6e,0xf4,0x08,0xc4,0xfd,
+0x27,0x88,0x88,0x88,0xbf,0x87,0x77,0x66,0x63,0x00,0x00,0xf0,0x00,0x0f,0x09,0x00,
+0x15,0x05,0x4c,0x00,0x0f,0xa9,0x07,0x02,0xf2,0x1d,0x00,0x04,0x55,0x40,0x05,0x44,
+0x40,0x03,0xf4,0x02,0xff,0xff,0x68,0xff,0xff,0x30,0x2f,0x40,0x3f,0x41,0x10,0x9d,
+0x11,0x00,0x02,0xf4,0x03,0xf3,0x00,0x09,0xd0,0x00,0x00,0x2f,0x40,0x4f,0x30,0x00,
+0x9d,0x00,0x00,0x01,0xf4,0x04,0x11,0x00,0x15,0x1f,0x11,0x00,0xf4,0x01,0x03,0xff,
+0xef,0x88,0xfe,0xef,0x60,0x1f,0x40,0x05,0x77,0x62,0x16,0x77,0x61,0x01,0x5f,0x06,
+0x23,0x1f,0x40,0x45,0x05,0xf1,0x01,0xf4,0x05,0x66,0x66,0x77,0x89,0xbd,0xf2,0x1f,
+0x40,0xde,0xef,0xff,0xfd,0xca,0x84,0x22,0x00,0x13,0xe9,0x22,0x00,0x00,0x44,0x03,
+0x0e,0x11,0x00,0x14,0xf5,0x11,0x00,0x11,0x50,0x33,0x03,0x33,0x00,0x02,0xf5,0x0c,
+0x03,0x63,0x2f,0x50,0x00,0x00,0x0a,0x40,0x22,0x00,0x01,0x40,0x07,0x04,0xc3,0x00,
+0x17,0x20,0x33,0x03,0x51,0x0c,0xee,0xee,0xef,0xc0,0x39,0x00,0x44,0x78,0x98,0x88,
+0xcf,0x33,0x03,0x24,0x09,0xf0,0x33,0x03,0x12,0x9f,0x5e,0x00,0x01,0x81,0x09,0x23,
+0x0e,0xa0,0xe9,0x01,0x00,0xeb,0x03,0xe0,0x04,0x77,0x77,0x8c,0xf0,0x00,0x0e,0xb4,
+0x34,0x10,0xdf,0xff,0xff,0xfc,0xf7,0x05,0x12,0xfb,0x20,0x00,0x51,0x0e,0xa3,0x32,
+0x10,0xea,0x29,0x00,0x23,0xd9,0x00,0x33,0x00,0x21,0x0d,0x90,0x33,0x00,0x0c,0x13,
+0x00,0x71,0xdd,0x77,0x78,0x9b,0xd9,0x00,0xd9,0x36,0x02,0x54,0xca,0x86,0x20,0x0d,
+0xa0,0x98,0x00,0x14,0xda,0x09,0x00,0x0f,0x13,0x00,0x0a,0x15,0xca,0x80,0x07,0x15,
+0x10,0x47,0x05,0x00,0x17,0x04,0xf3,0x06,0x44,0x45,0x00,0x00,0xae,0x00,0x00,0x8f,
+0xff,0xff,0xff,0x40,0x00,0xaf,0x00,0x00,0x02,0x22,0x21,0x3f,0x50,0xb2,0x02,0x1a,
+0x2f,0x09,0x00,0x41,0x28,0x88,0x88,0xaf,0x09,0x00,0xa2,0x9f,0xee,0xdd,0xdc,0x30,
+0x00,0x9f,0x66,0x64,0x9e,0xf6,0x00,0x23,0xff,0xfc,0x09,0x00,0x22,0x11,0x00,0x09,
+0x00,0x80,0x8f,0x00,0x00,0x9f,0x76,0x78,0x9a,0xdd,0x09,0x00,0x74,0x4d,0xee,0xed,
+0xb9,0x73,0x00,0x8f,0x75,0x00,0x09,0x09,0x00,0x10,0x06,0x8c,0x00,0x10,0x8e,0x32,
+0x08,0x00,0x3c,0x03,0x18,0x58,0x4e,0x08,0x1e,0x4f,0x09,0x00,0x10,0x96,0x99,0x08,
+0x00,0x8e,0x00,0x01,0x10,0x07,0x00,0x98,0x01,0x00,0xbb,0x08,0x05,0x6d,0x02,0x10,
+0x12,0x15,0x0b,0x30,0x77,0x78,0x10,0xcf,0x00,0x00,0x0d,0x08,0x34,0x50,0x00,0xae,
+0xbd,0x00,0x1f,0xaf,0xcf,0x00,0x01,0xf5,0x03,0x5d,0xdd,0xdd,0xef,0x50,0x00,0x9f,
+0x99,0x96,0xaf,0x99,0x99,0x88,0x10,0x00,0x9f,0xff,0xfb,0xbd,0x00,0x06,0xc6,0x00,
+0x61,0x33,0x34,0x57,0x9a,0x00,0x8f,0x51,0x00,0x20,0xfe,0xc8,0x09,0x00,0x33,0x01,
+0x22,0x11,0xb4,0x00,0x01,0x01,0x00,0x18,0x13,0x56,0x01,0x11,0x2e,0x80,0x08,0x00,
+0xab,0x00,0x54,0xa7,0x77,0x77,0x77,0xbf,0xbd,0x00,0x1f,0x8f,0x09,0x00,0x03,0x54,
+0x73,0x22,0x22,0x23,0xaf,0xcf,0x00,0x10,0xfd,0x73,0x02,0x5d,0x44,0x43,0x33,0x32,
+0x10,0xcf,0x00,0x14,0x9e,0xcf,0x00,0x05,0xbd,0x00,0x17,0x8f,0x09,0x00,0x41,0x01,
+0x11,0x12,0x4f,0x09,0x00,0x11,0x8f,0x24,0x00,0xcf,0x8f,0xff,0xfc,0xaf,0x44,0x44,
+0x43,0x00,0x00,0x8f,0x88,0x85,0xcf,0x00,0x0e,0x1d,0x8e,0xcf,0x00,0x11,0x37,0x06,
+0x00,0x32,0x46,0x76,0x41,0xd4,0x03,0x40,0xff,0xee,0xff,0x80,0xa7,0x01,0x50,0xfb,
+0x20,0x00,0x28,0xf8,0x4f,0x02,0x10,0xd0,0x3e,0x08,0x04,0x23,0x06,0x63,0x6f,0x10,
+0x00,0x00,0x0e,0xc0,0xe0,0x04,0x61,0x08,0xfa,0x20,0x00,0x18,0xfa,0x68,0x00,0x43,
+0xfe,0xde,0xff,0x90,0x48,0x00,0x16,0x40,0x0c,0x04,0x12,0x05,0x06,0x00,0xf1,0x05,
+0xd0,0x02,0xf4,0x5e,0xee,0xee,0xf4,0x00,0x7e,0x00,0x3f,0x42,0x89,0x88,0x8f,0x70,
+0x08,0xe0,0x02,0xf4,0x28,0x07,0x40,0x7e,0x00,0x2f,0x40,0x52,0x0d,0x11,0x07,0x11,
+0x00,0x1a,0x01,0x11,0x00,0x90,0x17,0x77,0x78,0xf7,0x00,0x7f,0x66,0x7f,0x48,0xe5,
+0x00,0x61,0x07,0xff,0xff,0xf4,0x8f,0x10,0xfc,0x05,0x20,0x2f,0x48,0x52,0x05,0x00,
+0x22,0x00,0x2f,0x8f,0x00,0x11,0x00,0x04,0x50,0x47,0xfa,0x9a,0xbd,0xf7,0x11,0x00,
+0x61,0x2b,0xcc,0xb9,0x75,0x00,0x7f,0x55,0x00,0x00,0x1e,0x06,0x12,0x02,0x50,0x04,
+0x0f,0x11,0x00,0x06,0x25,0x03,0x90,0x72,0x04,0x25,0x01,0x00,0x09,0x00,0xf1,0x0a,
+0x24,0x44,0x45,0x30,0x06,0xd0,0x04,0xf2,0x0d,0xff,0xff,0xfe,0x00,0x8f,0x00,0x4f,
+0x30,0x02,0x22,0x2a,0xf0,0x08,0xf0,0x04,0xf3,0x46,0x01,0x11,0x7f,0xdf,0x01,0xf0,
+0x08,0x08,0xe0,0x07,0xf0,0x04,0xf4,0x08,0xaa,0xab,0xdf,0x00,0x7f,0xbb,0xcf,0x40,
+0xfe,0xcc,0xcb,0x90,0x07,0xfb,0xbc,0xf3,0x7d,0x07,0x00,0x22,0x00,0x21,0x30,0xf8,
+0x6f,0x00,0x10,0x04,0x11,0x00,0x20,0x02,0x40,0x11,0x00,0xf2,0x01,0xef,0xdd,0xef,
+0xff,0x27,0xf0,0x04,0xf3,0x03,0x78,0x87,0x53,0x10,0x6f,0x00,0x4f,0xcc,0x0e,0x36,
+0x30,0x01,0x70,0x3e,0x01,0x11,0x0a,0xf4,0x02,0x9c,0xb0,0x00,0x00,0x47,0x76,0x66,
+0x66,0x66,0xcf,0x50,0x06,0x1f,0x9f,0x11,0x00,0x05,0xb0,0x0a,0xe0,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x57,0x00,0x11,0x00,0x01,0x00,0xf1,0x04,0x13,0x00,0x00,0x27,
+0x77,0x77,0x78,0x10,0x00,0x8f,0x00,0x00,0x6f,0xff,0xff,0xff,0x50,0x00,0x8f,0x18,
+0x00,0x63,0x2f,0x50,0x00,0x8f,0x33,0x31,0x09,0x00,0x24,0xff,0xfb,0x12,0x00,0x24,
+0x30,0x6e,0x24,0x00,0x41,0xaf,0x77,0x77,0x76,0x36,0x00,0x11,0x9e,0x30,0x00,0x33,
+0x8f,0x22,0x20,0x09,0x00,0xf0,0x08,0xff,0xf9,0x9f,0x33,0x34,0x57,0x99,0x00,0x8f,
+0x44,0x30,0x6f,0xff,0xff,0xfe,0xc7,0x00,0x7f,0x00,0x00,0x01,0x22,0x21,0x1b,0x00,
+0x13,0x00,0x01,0x00,0x11,0x4a,0x06,0x00,0x31,0x46,0x76,0x40,0x08,0x00,0xf1,0x23,
+0x6e,0xff,0xee,0xff,0x80,0x00,0x00,0x00,0x06,0xfb,0x20,0x00,0x28,0xf8,0x00,0x00,
+0x00,0x0d,0xd0,0x00,0x00,0x00,0xaf,0x00,0x00,0x00,0x0f,0x90,0x00,0x00,0x00,0x6f,
+0x10,0x00,0x00,0x0e,0xc0,0x00,0x00,0x00,0x9f,0x00,0x00,0x00,0x08,0xfa,0x20,0x00,
+0x18,0xfa,0x68,0x00,0x49,0xfe,0xde,0xff,0x90,0x48,0x00,0x01,0x01,0x00,0x03,0x0b,
+0x00,0xf0,0x03,0x01,0xf3,0x1d,0xee,0xee,0xef,0x60,0x00,0x02,0xf3,0x08,0x99,0x88,
+0x7f,0x80,0x00,0x02,0xf3,0x4f,0x00,0x0f,0x08,0x00,0x09,0xf0,0x03,0x05,0x77,0x77,
+0x8f,0x80,0xef,0xff,0xf3,0x0f,0xff,0xff,0xff,0x60,0x67,0x78,0xf4,0x0f,0x80,0x48,
+0x00,0x1f,0x02,0x08,0x00,0x04,0x16,0x01,0x08,0x00,0xf3,0x00,0xd9,0x9a,0xbc,0xdf,
+0x80,0x01,0xf4,0x07,0xcc,0xcb,0xa9,0x75,0x10,0x01,0xf4,0x80,0x00,0x0f,0x08,0x00,
+0x04,0x23,0x02,0xf4,0xa8,0x00,0x14,0xd2,0xb0,0x00,0x11,0x05,0x7e,0x01,0x30,0x04,
+0xf3,0x0c,0x78,0x00,0x21,0x00,0x04,0x90,0x00,0x49,0x70,0x00,0x04,0xf4,0x08,0x00,
+0x30,0x22,0x26,0xf4,0x20,0x00,0xb3,0x72,0xff,0xff,0xf4,0x0f,0xb7,0x77,0x76,0x10,
+0x34,0x47,0x80,0x00,0x25,0x04,0xf3,0x08,0x00,0xf1,0x01,0xa3,0x34,0x56,0x8a,0x40,
+0x04,0xf3,0x0d,0xff,0xff,0xff,0xeb,0x30,0x04,0xf3,0x00,0x73,0x01,0x23,0x04,0xf2,
+0x68,0x00,0xc0,0x60,0x00,0x00,0x57,0x77,0x77,0x77,0x88,0x50,0x00,0x00,0xff,0x01,
+0x00,0x30,0xf0,0x00,0x00,0x6b,0x01,0x25,0x07,0xf1,0x08,0x00,0x19,0x01,0x08,0x00,
+0xc0,0xf0,0x00,0x01,0xfa,0x22,0x22,0x22,0x39,0xf0,0x00,0x00,0xdf,0x30,0x00,0x9f,
+0xd0,0x00,0x00,0x02,0x22,0x22,0x22,0x11,0x00,0xb8,0x00,0x16,0x84,0x11,0x11,0x2f,
+0x70,0x55,0x58,0xf4,0x0e,0xb8,0x00,0x7d,0xa5,0x55,0x44,0x00,0x00,0x05,0xf3,0xb8,
+0x00,0xd4,0xc7,0x67,0x89,0xbe,0x60,0x04,0xf3,0x09,0xee,0xee,0xdc,0xa8,0x10,0xb0,
+0x00,0x23,0x01,0x80,0xcb,0x01,0xb1,0x30,0x00,0x00,0xf6,0x00,0x00,0x00,0x05,0xf0,
+0x00,0x01,0x08,0x00,0xb3,0xf1,0x00,0x01,0xf7,0x21,0x11,0x11,0x27,0xf1,0x00,0x01,
+0xc8,0x00,0x72,0x01,0xf9,0x66,0x66,0x55,0x59,0xf0,0x28,0x00,0x17,0x06,0x08,0x00,
+0x01,0x20,0x00,0x93,0xe0,0x00,0x00,0x35,0x55,0x55,0x55,0x55,0x20,0xb8,0x00,0x11,
+0x05,0x06,0x00,0xf1,0x06,0x03,0xf1,0x02,0xf4,0x7e,0xee,0xef,0xe0,0x00,0x4f,0x20,
+0x3f,0x43,0x88,0x87,0xbf,0x10,0x04,0xf2,0x03,0xf4,0xfe,0x00,0xa1,0x4f,0x30,0x3f,
+0x40,0x00,0x00,0x7f,0x10,0x04,0xf3,0x11,0x00,0x14,0xf0,0x11,0x00,0xf0,0x11,0x00,
+0x03,0xf3,0x03,0xf4,0x17,0x77,0x7b,0xf1,0x67,0x9f,0x30,0x3f,0x48,0xff,0xff,0xfd,
+0x1d,0xef,0xf3,0x03,0xf4,0x8f,0x10,0x00,0x00,0x00,0x3f,0x30,0x3f,0x48,0xf0,0x55,
+0x00,0x51,0xf3,0x02,0xf4,0x8f,0x00,0x11,0x00,0x1b,0x2f,0x11,0x00,0xf1,0x06,0x20,
+0x2f,0x47,0xfa,0x9a,0xbd,0xf6,0x03,0xf2,0x02,0xf4,0x2b,0xcc,0xb9,0x75,0x00,0x4f,
+0x20,0x2f,0x40,0x00,0x9f,0x01,0x03,0x11,0x02,0x04,0x11,0x00,0x41,0x05,0xf1,0x02,
+0xf5,0x11,0x00,0x41,0x5f,0x10,0x2f,0x50,0x31,0x02,0x14,0xa0,0x3b,0x02,0x06,0x01,
+0x00,0xf0,0x0a,0x01,0x00,0x34,0x44,0x45,0x00,0x00,0xe5,0x04,0xf2,0x0e,0xff,0xff,
+0xf5,0x00,0x0f,0x70,0x4f,0x30,0x02,0x22,0x4f,0x60,0x00,0xf8,0x86,0x01,0xf2,0x0f,
+0x01,0xf5,0x00,0x0f,0x80,0x4f,0x40,0x00,0x00,0x1f,0x50,0x00,0xf8,0x04,0xf4,0x08,
+0xaa,0xab,0xf5,0xaf,0xff,0x80,0x4f,0x40,0xfe,0xcc,0xcb,0x23,0x66,0xf8,0x78,0x01,
+0x00,0x22,0x00,0x20,0x30,0xf8,0x4b,0x00,0x02,0x11,0x00,0x20,0x02,0x40,0x11,0x00,
+0xf1,0x03,0xef,0xdd,0xef,0xff,0x10,0xf8,0x04,0xf3,0x03,0x78,0x77,0x53,0x00,0x0e,
+0x70,0x4f,0x30,0x00,0x81,0x01,0x26,0x01,0x70,0x7a,0x00,0x11,0x0b,0x54,0x01,0x93,
+0xb0,0x00,0x00,0x57,0x76,0x66,0x66,0x66,0xcf,0x16,0x00,0x23,0x09,0xf0,0x09,0x00,
+0x1f,0x9f,0x11,0x00,0x05,0x23,0x0a,0xe0,0x09,0x00,0x13,0x58,0x07,0x03,0xf0,0x09,
+0x00,0x15,0x00,0x00,0x00,0x11,0x00,0x00,0xf8,0x05,0xf1,0x0d,0xff,0xff,0xf4,0x00,
+0x0f,0x80,0x5f,0x10,0x35,0x55,0x6f,0x60,0x11,0x00,0x10,0x00,0xeb,0x01,0x00,0x11,
+0x00,0x30,0x00,0x00,0x1f,0x11,0x00,0xf1,0x07,0xf2,0x02,0x44,0x46,0xf6,0x48,0x8f,
+0x80,0x5f,0x20,0xff,0xff,0xff,0x58,0xee,0xf8,0x05,0xf1,0x0f,0x92,0x22,0x10,0x22,
+0x00,0x02,0xc4,0x00,0x23,0x05,0xf1,0xd5,0x00,0xf0,0x05,0x5f,0x10,0xfa,0x44,0x56,
+0x85,0x00,0xf7,0x05,0xf1,0x0c,0xff,0xff,0xeb,0x50,0x0f,0x70,0x6f,0x10,0x01,0xb2,
+0x02,0x51,0xf7,0x06,0xf1,0x00,0x00,0x99,0x02,0xa1,0x6f,0x00,0x00,0x05,0x70,0x00,
+0x00,0xf6,0x07,0xf0,0x62,0x04,0x64,0x05,0x00,0x4b,0x00,0x00,0x0a,0xae,0x00,0x1c,
+0xaf,0xae,0x00,0x90,0xaf,0x65,0x55,0x56,0x77,0x88,0x00,0x00,0x06,0xf6,0x00,0x10,
+0xfe,0x96,0x04,0x00,0xf0,0x01,0x0e,0x6c,0x04,0x13,0x0b,0x6c,0x04,0x3e,0x06,0x89,
+0x88,0x6c,0x04,0x22,0xcd,0xde,0x08,0x00,0x2a,0x79,0x9a,0x6c,0x04,0x22,0x00,0x02,
+0x6c,0x04,0x0c,0x5c,0x04,0x22,0x89,0x9a,0x08,0x00,0x2f,0xcd,0xdd,0x6c,0x04,0x02,
+0x2f,0xef,0x70,0x6c,0x04,0x15,0x1c,0x01,0x6c,0x04,0x50,0x10,0x03,0x44,0x44,0x55,
+0x75,0x02,0x11,0x0e,0x78,0x00,0x91,0x05,0xf3,0x00,0x22,0x11,0x1f,0x70,0x01,0x15,
+0x98,0x00,0x32,0x72,0xff,0xff,0xc4,0x03,0x80,0x55,0x58,0xf3,0x05,0x88,0x88,0x9f,
+0x70,0x9c,0x03,0x43,0xfe,0xee,0xdd,0x40,0xac,0x03,0x32,0x01,0x99,0x9b,0x08,0x00,
+0x22,0xcd,0xde,0x08,0x00,0xf3,0x04,0x00,0x04,0xf2,0x0f,0xd9,0x99,0xac,0xef,0x40,
+0x05,0xf2,0x07,0xbc,0xbb,0xa9,0x74,0x00,0x05,0xf2,0xdd,0x01,0x15,0xc0,0x22,0x01,
+0xe3,0x04,0xee,0xef,0xff,0xff,0xff,0xc0,0x00,0x02,0x88,0x87,0x77,0x77,0x7c,0x20,
+0x00,0x1c,0x07,0x08,0x00,0x1f,0xf1,0x08,0x00,0x03,0x23,0x04,0xa0,0x46,0x00,0xa3,
+0x30,0x04,0x66,0x66,0x77,0x10,0x00,0x05,0xf2,0x0c,0xb8,0x00,0x00,0xa8,0x00,0x31,
+0x71,0x88,0x8b,0x08,0x00,0x80,0x73,0xdd,0xde,0xf3,0x01,0x22,0x22,0x3f,0xb0,0x00,
+0x13,0x0e,0x8c,0x04,0x63,0x0f,0x93,0x22,0x22,0x03,0xed,0xa8,0x00,0x20,0x88,0x8a,
+0x08,0x00,0xf0,0x03,0x01,0x36,0x20,0x05,0xf2,0x0f,0xfe,0xef,0xff,0xff,0x60,0x05,
+0xf2,0x02,0x67,0x76,0x54,0x20,0x4c,0x04,0x05,0xc8,0x01,0x66,0x12,0x22,0x22,0x22,
+0x22,0x00,0x1c,0x05,0x56,0x35,0x55,0x44,0x44,0x49,0x90,0x00,0x00,0x3c,0x05,0x54,
+0x78,0x8b,0xf1,0x00,0x00,0x00,0x03,0x13,0xf9,0x3b,0x00,0x04,0x08,0x00,0xf0,0x06,
+0xff,0xee,0xee,0xff,0xff,0xf8,0x00,0x00,0x37,0x88,0x77,0x77,0x77,0x61,0x00,0x00,
+0x01,0x11,0x11,0x11,0x10,0x03,0x04,0x01,0x31,0x00,0x00,0xca,0x03,0x54,0x45,0x55,
+0x54,0x44,0x4f,0x4b,0x03,0x19,0x0f,0x09,0x00,0x63,0x67,0x77,0x77,0x77,0x7f,0x70,
+0x67,0x02,0x54,0xee,0x50,0x00,0x00,0x06,0xb6,0x05,0x0a,0x09,0x00,0x51,0x02,0x30,
+0x00,0x00,0x04,0x6a,0x00,0x21,0xf3,0x00,0x93,0x00,0x22,0x66,0x55,0x83,0x02,0x14,
+0x5c,0x70,0x01,0x1f,0x7f,0x09,0x00,0x03,0x10,0x4e,0x34,0x00,0xd2,0xee,0xee,0xee,
+0xfc,0x28,0x88,0x88,0x87,0x77,0x78,0x88,0x88,0x85,0x1d,0x00,0x01,0xce,0x05,0x10,
+0x0d,0x76,0x00,0x10,0xfd,0x0a,0x00,0x78,0x35,0x66,0x55,0x55,0x4b,0xe0,0x00,0xbc,
+0x03,0x60,0x45,0x55,0x55,0x55,0x5b,0xe0,0xa9,0x00,0x05,0x26,0x00,0x32,0xf8,0x11,
+0x11,0x06,0x06,0x15,0x1f,0x19,0x04,0x60,0xfc,0x76,0x66,0x66,0x79,0xd5,0xf9,0x03,
+0x52,0xef,0xff,0xff,0xfe,0xed,0x95,0x00,0x14,0x6f,0x2c,0x03,0x02,0x7d,0x03,0xc0,
+0x6f,0xfe,0xee,0xed,0xef,0xdd,0xee,0xff,0xfe,0x02,0x77,0x88,0x01,0x00,0x37,0x77,
+0x77,0x50,0x4b,0x03,0x60,0x02,0x33,0x33,0x33,0x44,0x54,0xe1,0x07,0x01,0x31,0x01,
+0x10,0xf4,0x3b,0x01,0x64,0x34,0x43,0x33,0x22,0x6f,0x50,0x4a,0x02,0x14,0xf5,0x2b,
+0x00,0x24,0x4f,0x40,0x13,0x00,0x15,0xf4,0x13,0x00,0x14,0x30,0x1a,0x05,0x01,0x93,
+0x00,0x50,0xbd,0xdd,0xdd,0xdd,0xde,0x1c,0x08,0x64,0x78,0x98,0x88,0x88,0x7d,0xc0,
+0xd6,0x03,0x22,0xd0,0x00,0x98,0x01,0x24,0x2b,0xd0,0xe9,0x01,0x00,0x1b,0x00,0xa4,
+0xfa,0x54,0x44,0x44,0x44,0x10,0x00,0x00,0x01,0xf7,0x44,0x00,0xa0,0xfb,0x66,0x66,
+0x66,0x67,0x81,0x00,0x00,0x00,0xae,0xf6,0x03,0x1a,0xd3,0x75,0x00,0x01,0x6b,0x00,
+0xb2,0x05,0x55,0x55,0x55,0x8f,0x75,0x55,0x55,0x53,0x5f,0xff,0x01,0x00,0x32,0xfd,
+0x01,0x11,0x01,0x00,0x16,0x10,0x23,0x04,0x15,0x05,0xbc,0x01,0x1c,0xf3,0xce,0x01,
+0x15,0x07,0x09,0x00,0x10,0xf9,0x6c,0x00,0x14,0x73,0x28,0x02,0x1c,0xf8,0xea,0x05,
+0x15,0x13,0x43,0x02,0x00,0xd9,0x00,0x63,0x56,0x66,0x66,0x55,0x5f,0x90,0x1b,0x00,
+0x50,0x0e,0x90,0x00,0x00,0x01,0x5e,0x03,0x00,0x06,0x09,0xb4,0x02,0xfa,0x77,0x77,
+0x77,0x76,0x20,0x00,0x00,0x02,0xf6,0x51,0x01,0x60,0xfb,0x77,0x77,0x77,0x78,0x80,
+0xc6,0x00,0x56,0xee,0xff,0xee,0xdd,0xc1,0x93,0x01,0xa3,0x14,0x43,0x33,0x22,0x7f,
+0x32,0x23,0x34,0x42,0x7f,0xbd,0x00,0x40,0xfb,0x01,0x11,0x22,0xdb,0x07,0x15,0x11,
+0x5f,0x06,0x03,0xe9,0x05,0x00,0xf5,0x07,0x10,0x04,0x59,0x00,0x27,0x6c,0xe0,0x1a,
+0x05,0x50,0x01,0x55,0x66,0x66,0x66,0x12,0x00,0x11,0x09,0x24,0x00,0x44,0xa0,0x00,
+0x00,0x09,0x49,0x03,0x02,0x09,0x00,0x10,0x10,0xc6,0x01,0x03,0x10,0x03,0x87,0x00,
+0x68,0x88,0x88,0x87,0x76,0x51,0x00,0x70,0x02,0x04,0x4f,0x08,0x42,0x00,0x46,0x66,
+0x66,0x5c,0x02,0x04,0x33,0x06,0x00,0x12,0x00,0x37,0x66,0x6b,0xe0,0x9e,0x01,0x33,
+0x01,0xf8,0x10,0x94,0x00,0x05,0x1b,0x01,0x10,0xff,0x5b,0x00,0x00,0xe6,0x00,0x62,
+0x26,0x67,0xbf,0x76,0x65,0x51,0xe5,0x02,0x14,0x10,0xee,0x02,0x14,0x10,0xee,0x02,
+0x52,0xfe,0xee,0xef,0xfc,0x28,0x68,0x02,0x24,0x77,0x74,0xd6,0x00,0x02,0x5a,0x07,
+0x14,0x30,0xde,0x05,0x03,0x14,0x08,0x23,0x03,0xff,0x69,0x04,0x32,0x2e,0xe9,0xfb,
+0x11,0x00,0x41,0xef,0x40,0x6f,0xd2,0x4f,0x00,0x80,0xe3,0x00,0x03,0xef,0x50,0x00,
+0x00,0x1d,0xe7,0x03,0x51,0x1b,0xf7,0x00,0x00,0x07,0x33,0x00,0x40,0x43,0x00,0x00,
+0x00,0xed,0x01,0x15,0x22,0x9e,0x01,0x7f,0x60,0x00,0x00,0x00,0x44,0x44,0x44,0xe1,
+0x03,0x04,0xf6,0x01,0x01,0x88,0x88,0x88,0x89,0x9f,0x70,0x00,0x00,0x07,0xfd,0xdd,
+0xdd,0xdd,0xdc,0x40,0xe3,0x04,0x03,0x1c,0x03,0x04,0x1c,0x02,0x00,0x3b,0x01,0x51,
+0x05,0xff,0xee,0xee,0xef,0xe1,0x03,0x33,0x56,0x67,0x66,0xe1,0x03,0x42,0x40,0x00,
+0x02,0x20,0x2e,0x09,0x31,0x00,0x0b,0xb0,0x5c,0x02,0x0b,0x09,0x00,0x10,0x4e,0x68,
+0x05,0x46,0xef,0xfe,0xee,0xfb,0xe1,0x03,0x20,0x03,0xdd,0x06,0x03,0x00,0xec,0x00,
+0x74,0x18,0x99,0x88,0x88,0x88,0xf6,0x00,0x91,0x00,0x14,0x60,0x0a,0x00,0x10,0xf6,
+0x16,0x01,0x60,0x77,0x77,0x78,0x88,0x8f,0x60,0xec,0x00,0x57,0xff,0xfe,0xee,0xee,
+0xd4,0x7f,0x05,0x07,0x57,0x01,0x51,0x07,0xf7,0x55,0x55,0x56,0x4d,0x02,0x20,0x3e,
+0xff,0xe1,0x03,0x1c,0x20,0xa8,0x02,0x01,0x72,0x02,0x11,0x11,0x14,0x01,0x22,0x23,
+0x33,0xc3,0x03,0x00,0x7c,0x09,0x71,0x14,0x45,0x55,0x55,0xaf,0x44,0x43,0x48,0x0c,
+0x00,0x4c,0x09,0x0c,0x9d,0x04,0x1e,0x07,0x13,0x00,0x15,0x08,0x13,0x00,0x15,0x7e,
+0x5a,0x00,0x07,0x75,0x07,0x01,0x42,0x02,0x04,0x78,0x02,0x74,0x00,0x46,0x65,0x55,
+0x55,0x4d,0xc0,0x9c,0x08,0x13,0xc0,0xb0,0x04,0x10,0x5d,0x39,0x02,0x04,0xa9,0x05,
+0x23,0x01,0xf7,0xaf,0x04,0x07,0xe0,0x03,0x00,0xae,0x04,0x13,0xc3,0xe0,0x03,0x26,
+0xee,0xd3,0x5d,0x00,0x22,0x16,0x66,0x01,0x00,0x23,0x65,0x6f,0xc1,0x00,0x20,0xfc,
+0x01,0xbd,0x09,0x04,0x83,0x04,0x21,0x3f,0x40,0x1d,0x02,0x61,0xf2,0x00,0x3f,0x30,
+0x04,0xd0,0x7b,0x01,0x11,0x01,0x68,0x0a,0x10,0x05,0x3a,0x01,0x10,0xff,0x09,0x00,
+0x72,0xf8,0x77,0x77,0x77,0x7a,0xf0,0x00,0xa2,0x06,0x18,0x07,0x09,0x00,0x14,0x04,
+0x59,0x06,0x01,0xed,0x05,0x50,0x77,0x30,0x00,0x00,0x02,0xa0,0x01,0xb9,0xee,0x20,
+0x00,0x00,0x01,0x89,0x98,0x88,0x88,0x9f,0x40,0x65,0x00,0x03,0x09,0x00,0x01,0x9e,
+0x01,0x10,0xaf,0x30,0x02,0x00,0xf6,0x02,0x27,0xed,0x20,0x9d,0x01,0x27,0x07,0xf1,
+0x9c,0x01,0x30,0x66,0x78,0x80,0xb6,0x02,0x00,0xcf,0x00,0x1f,0xc0,0x9a,0x01,0x08,
+0x14,0x42,0xd8,0x00,0xa1,0xfa,0x04,0x45,0x5f,0xb5,0x44,0x48,0xf4,0x33,0x30,0x48,
+0x04,0x02,0x85,0x02,0x06,0x09,0x00,0x1f,0x80,0x09,0x00,0x07,0x11,0x70,0xf2,0x00,
+0x02,0x4e,0x03,0x19,0x10,0x95,0x01,0x13,0xef,0x71,0x01,0x01,0xd7,0x03,0x28,0x5c,
+0xd0,0x75,0x05,0x00,0x79,0x0c,0x14,0x7d,0x75,0x05,0x10,0xfe,0xb9,0x01,0x05,0x8c,
+0x01,0x14,0xf7,0xe0,0x01,0x05,0xf7,0x05,0x57,0x26,0x66,0x66,0x66,0x55,0x1b,0x06,
+0x14,0x05,0x95,0x01,0x16,0x5f,0x95,0x01,0x23,0x04,0xf3,0x63,0x0a,0x22,0x04,0xf3,
+0x31,0x02,0x73,0x01,0x7a,0xf9,0x77,0x7c,0xf8,0x60,0x43,0x07,0x23,0xff,0xf2,0x50,
+0x03,0x1f,0x05,0x09,0x00,0x03,0x64,0xf6,0x43,0x33,0x34,0x48,0xf2,0xbc,0x03,0x20,
+0xe0,0x00,0xff,0x07,0x39,0x33,0x33,0x21,0x63,0x0b,0x60,0xde,0xee,0xee,0xee,0xef,
+0x40,0x44,0x06,0x12,0x87,0x9d,0x07,0x0e,0xb8,0x07,0x01,0x6d,0x02,0x23,0x5f,0x70,
+0xdd,0x01,0x00,0x04,0x04,0x32,0x05,0xf4,0x21,0x6d,0x02,0x01,0xf8,0x01,0x0a,0x09,
+0x00,0xa0,0xf8,0x55,0x55,0x66,0x79,0xb2,0x00,0x00,0x01,0xdf,0xa7,0x01,0x2f,0xd2,
+0x00,0x01,0x00,0x08,0x40,0x03,0x33,0x34,0x44,0x01,0x00,0x05,0xb0,0x01,0xa0,0xfd,
+0x03,0x33,0x33,0x22,0x22,0x22,0x33,0x33,0x31,0xf2,0x03,0x00,0x03,0xdd,0xdd,0xdd,
+0xdd,0xee,0x50,0x00,0x00,0x01,0x78,0x88,0x88,0x88,0x7f,0x90,0x00,0x01,0x00,0x18,
+0x0f,0x09,0x00,0x20,0x03,0xff,0x01,0x00,0xe3,0x80,0x00,0x00,0x04,0xf9,0x66,0x66,
+0x66,0x65,0x10,0x00,0x00,0x05,0xf4,0x1f,0x00,0x74,0x05,0xf5,0x00,0x00,0x00,0x01,
+0x20,0x24,0x00,0xb5,0xf6,0x00,0x00,0x00,0x25,0x56,0x66,0x65,0x54,0x40,0x00,0x01,
+0x00,0x22,0x16,0x66,0x01,0x00,0x32,0x64,0x5f,0xff,0x01,0x00,0x20,0xfd,0x00,0x34,
+0x00,0x46,0x11,0x11,0x11,0x00,0x01,0x00,0x23,0x01,0xf6,0x09,0x00,0x2d,0x02,0xf7,
+0x09,0x00,0x05,0x1b,0x00,0xa0,0xfb,0x66,0x66,0x66,0x67,0x72,0x00,0x00,0x00,0xdf,
+0x47,0x00,0x27,0xf7,0x00,0x01,0x00,0x50,0x34,0x44,0x44,0x44,0x45,0x48,0x00,0x01,
+0x62,0x00,0xa4,0x70,0x00,0x00,0x00,0x12,0x22,0x21,0x11,0x1f,0x70,0xc6,0x00,0x00,
+0x09,0x00,0x60,0xde,0xee,0xee,0xee,0xef,0x70,0x48,0x00,0x94,0x88,0x88,0x88,0x77,
+0x20,0x00,0x00,0x02,0xf5,0x5a,0x00,0x10,0xfa,0x5a,0x00,0xa6,0x81,0x00,0x00,0x00,
+0xbf,0xff,0xff,0xff,0xfe,0xd2,0x58,0x00,0x30,0x03,0x33,0x22,0x01,0x00,0x33,0x33,
+0x42,0x6f,0xbd,0x00,0x31,0xfe,0x01,0x22,0x01,0x00,0x26,0x21,0x10,0x25,0x00,0x11,
+0x07,0x1a,0x00,0xa4,0xf0,0x00,0x00,0x02,0x78,0x88,0x87,0x77,0x6a,0xf1,0x1c,0x01,
+0xa3,0xf1,0x00,0x00,0x01,0x66,0x67,0x77,0x77,0x7a,0xf1,0x24,0x00,0x54,0xee,0xc0,
+0x00,0x00,0x08,0x1f,0x00,0x02,0x09,0x00,0xe0,0x10,0x00,0x00,0x06,0xff,0xee,0xee,
+0xff,0xff,0xfb,0x00,0x00,0x00,0x68,0x99,0x00,0x11,0x62,0x1e,0x00,0x30,0x11,0x11,
+0x12,0x7f,0x00,0x05,0xcf,0x00,0x54,0x45,0x55,0x55,0x44,0x4f,0x95,0x01,0x10,0x0e,
+0x09,0x00,0x94,0x55,0x55,0x55,0x55,0x5f,0x90,0x00,0x00,0x04,0x24,0x00,0x23,0x04,
+0xf4,0x54,0x01,0x24,0x05,0xf3,0x82,0x00,0x00,0xb0,0x01,0x60,0x69,0xb0,0x00,0x00,
+0x01,0xcf,0xbb,0x00,0x16,0xd1,0xb3,0x00,0x23,0x02,0x22,0xc7,0x00,0x14,0x6f,0x95,
+0x01,0x10,0x04,0x42,0x01,0x47,0x55,0x55,0x55,0x42,0x25,0x00,0x91,0x77,0x77,0x77,
+0x77,0x78,0x50,0x00,0x00,0x0a,0x23,0x00,0x90,0xf1,0x00,0x00,0x0a,0xf1,0x10,0x00,
+0x00,0x07,0x09,0x00,0x59,0xf0,0x00,0x00,0x00,0x06,0x09,0x00,0x64,0xf2,0x21,0x11,
+0x22,0x38,0xf0,0x0e,0x01,0x12,0xd0,0x95,0x01,0x25,0x33,0x22,0x4d,0x00,0x12,0x20,
+0x08,0x00,0x21,0xba,0x1d,0x86,0x01,0x90,0x0c,0xa0,0x89,0x98,0x87,0xfa,0x00,0x00,
+0xca,0xcf,0x00,0x8d,0xa0,0x00,0x0c,0xa0,0x00,0x00,0x00,0xea,0x0f,0x00,0xf0,0x03,
+0xcb,0x05,0x77,0x77,0x8f,0xa0,0x00,0x0c,0xb0,0xff,0xff,0xff,0xf8,0x00,0x00,0xcb,
+0x0f,0x80,0x43,0x00,0x31,0x0c,0xb0,0xf8,0x4b,0x00,0x0f,0x0f,0x00,0x05,0xf2,0x01,
+0xfd,0x99,0xaa,0xbd,0xfc,0x00,0xcb,0x07,0xbc,0xcb,0xa9,0x86,0x20,0x0c,0xb0,0x00,
+0x1e,0x00,0x02,0x07,0x00,0x0f,0x0f,0x00,0x04,0x13,0x98,0x87,0x02,0x21,0x40,0x05,
+0xf2,0x00,0x90,0x08,0xf0,0x0c,0xff,0xff,0xff,0xe0,0x00,0x08,0xde,0x00,0x22,0x09,
+0xf0,0x08,0x00,0x18,0x08,0x08,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x50,0x0f,0xb7,
+0x77,0x77,0x40,0x08,0x00,0x01,0x7c,0x00,0x07,0x08,0x00,0xf0,0x03,0xa3,0x34,0x56,
+0x8a,0x50,0x08,0xf0,0x0d,0xff,0xff,0xff,0xeb,0x30,0x08,0xf0,0x00,0x22,0x21,0x2a,
+0x02,0x14,0xf0,0x68,0x00,0x30,0x00,0x00,0x12,0x80,0x01,0x04,0x5c,0x01,0x92,0xc0,
+0x00,0x02,0x54,0x44,0x44,0x44,0x3c,0xe0,0x20,0x00,0x1f,0x0a,0x08,0x00,0x0d,0x13,
+0xd0,0x9f,0x02,0x04,0x68,0x03,0xa3,0x10,0x01,0x22,0x23,0x33,0x20,0x00,0x08,0xe0,
+0x0e,0xb8,0x00,0x53,0x01,0x33,0x32,0x2a,0xe0,0xb0,0x00,0x35,0xe0,0x00,0x07,0x08,
 0x00,0x40,0x02,0x44,0x44,0x4b,0x08,0x00,0x10,0x0f,0xa4,0x01,0x00,0x08,0x00,0x30,
-0x91,0x11,0x10,0x98,0x00,0x0e,0xc0,0x00,0x42,0x33,0x45,0x69,0x70,0xc0,0x00,0x86,
-0xfd,0x60,0x08,0xe0,0x00,0x23,0x32,0x10,0x95,0x29,0x00,0x08,0x00,0x13,0x52,0x08,
-0x00,0x22,0xf8,0x00,0x29,0x4c,0x1b,0xf8,0xfb,0x1b,0x05,0x54,0x5b,0x03,0x78,0x62,
-0x13,0xdf,0x4a,0x05,0x08,0xfa,0x03,0x22,0x01,0x30,0x70,0x01,0x11,0x07,0x68,0x00,
-0x12,0xe0,0x86,0x06,0x22,0x09,0xf0,0x08,0x00,0x18,0x08,0x08,0x00,0x02,0x70,0x01,
-0x22,0x07,0xf1,0x70,0x01,0x04,0xb0,0x00,0x07,0x08,0x00,0x01,0x70,0x01,0x13,0x07,
-0x70,0x01,0x1b,0x07,0x70,0x01,0x25,0x00,0x10,0x74,0x54,0x02,0xc6,0x4f,0x33,0xe0,
-0x00,0x08,0x6b,0x00,0x0f,0x08,0x00,0x03,0x12,0xe0,0x7a,0x61,0x23,0x3b,0xe0,0xe4,
-0x41,0x12,0xb0,0xb0,0x01,0x05,0xd3,0x0a,0x87,0x40,0x57,0x77,0x77,0x85,0x00,0x00,
-0x8f,0x27,0x02,0x12,0x9f,0x91,0x14,0x01,0x1e,0x02,0x30,0x01,0x11,0x11,0x0f,0x00,
-0x13,0x0e,0x25,0x02,0x20,0xfa,0x55,0xa0,0x60,0x14,0x8f,0x5c,0x01,0x13,0xf8,0x64,
-0x2f,0x00,0xaa,0x12,0x84,0x70,0x08,0xf0,0x9e,0xee,0xed,0xca,0x71,0xcd,0x14,0x22,
-0x03,0x70,0x0b,0x61,0x12,0x12,0x2b,0x1a,0x22,0x08,0xd0,0xf2,0x23,0x12,0x9e,0xa7,
-0x12,0x22,0x2a,0xe0,0xa8,0x21,0x12,0xfd,0xa6,0x12,0x13,0x5b,0x1e,0x00,0x12,0x9d,
-0x40,0x05,0x23,0x09,0xd0,0x4a,0x86,0x03,0xa4,0x12,0x17,0x10,0x65,0x01,0x27,0x79,
-0x80,0xb5,0x02,0x0f,0xd5,0x02,0x06,0x4e,0xee,0xef,0xff,0xe0,0xd5,0x02,0x08,0x08,
-0x00,0x61,0x13,0x57,0x30,0x08,0xf0,0x0e,0x03,0x40,0x73,0x08,0xf0,0x01,0x55,0x54,
-0x32,0x10,0x63,0x09,0x13,0x01,0x08,0x00,0x22,0x2f,0x60,0x90,0x33,0x23,0x6f,0x40,
-0xb8,0x20,0x04,0xca,0x3d,0x12,0xd2,0xf0,0x0c,0x31,0xc4,0xee,0x30,0xcb,0x8b,0x30,
-0x20,0x2d,0xf5,0xa8,0x09,0x11,0xd2,0x0c,0x7a,0x11,0x09,0x45,0x20,0x13,0xf8,0xa8,
-0x63,0x13,0x34,0xb8,0x00,0x12,0x20,0x1d,0x02,0x32,0x09,0xe0,0x0c,0x77,0x5a,0x03,
-0xb8,0x00,0x1f,0x09,0xb8,0x00,0x02,0x1f,0xf0,0xb8,0x00,0x0b,0x32,0x12,0x47,0x20,
-0xb8,0x00,0x96,0xff,0x60,0x08,0xe0,0x02,0x56,0x65,0x43,0x10,0xeb,0x48,0x00,0x4e,
-0x05,0x41,0x39,0xcd,0xca,0x60,0x2e,0x8e,0x20,0x98,0x9c,0x25,0x62,0x00,0x59,0x05,
-0x22,0x2e,0xc0,0xab,0x28,0x00,0xe9,0x07,0x13,0xdc,0x20,0x0e,0x13,0xce,0x80,0x0d,
-0x00,0x4a,0x4b,0x10,0x2e,0xcd,0x60,0x31,0xfd,0x97,0x8b,0xb3,0x6d,0x4c,0x5a,0xcd,
-0xca,0x61,0x9e,0x1f,0x22,0x01,0xf5,0x02,0x33,0x10,0x40,0x09,0x3d,0x51,0x06,0xf6,
-0x66,0x66,0xf6,0xa8,0x01,0x10,0x6f,0x89,0x5c,0x00,0xb9,0x01,0x00,0x37,0x05,0x11,
-0xf7,0xb4,0x08,0x11,0x6f,0xa3,0x06,0x21,0x1f,0x70,0xb1,0x02,0x11,0xf7,0x03,0x00,
-0x11,0x7f,0x13,0x00,0x42,0x0f,0xb7,0x77,0x27,0x13,0x00,0x33,0xff,0xff,0xf7,0x13,
-0x00,0x0e,0x26,0x00,0x00,0x13,0x00,0x15,0xe0,0x13,0x00,0x10,0x11,0xf8,0x06,0x00,
-0x0c,0x3a,0x02,0x91,0x07,0x11,0xf7,0xd1,0x24,0x17,0x33,0x6d,0x08,0x2d,0x00,0xf7,
-0xd1,0x58,0x0f,0x9e,0x4d,0x01,0x1e,0xe6,0x4a,0x08,0x00,0x88,0x34,0x01,0x6c,0x54,
-0x13,0xbc,0xde,0x17,0x00,0xb1,0x3d,0x42,0x8f,0x11,0x00,0x2f,0x09,0x00,0x01,0xd5,
-0x17,0x1d,0xbc,0x09,0x00,0x32,0xbe,0x88,0x85,0x09,0x00,0x41,0xbf,0xff,0xfa,0x7f,
-0x09,0x00,0x21,0xbd,0x00,0xeb,0x47,0x10,0x50,0xd3,0x51,0x40,0x6f,0x65,0x66,0x7f,
-0x09,0x00,0x00,0x28,0x2b,0x44,0xed,0x20,0x00,0xac,0x6c,0x00,0x05,0x09,0x00,0x14,
-0x35,0xb0,0x06,0x14,0x20,0xa4,0x59,0x10,0xf8,0x16,0x00,0x00,0xd2,0x08,0x05,0xfb,
-0x23,0x1f,0xea,0x09,0x00,0x10,0x05,0x81,0x20,0x17,0x63,0xcf,0x00,0x11,0x02,0xeb,
-0x21,0x03,0x04,0x1b,0x11,0x40,0x21,0x35,0x04,0xa2,0x1c,0x02,0xab,0x00,0x14,0x9e,
-0x09,0x00,0x1a,0x8e,0x09,0x00,0x11,0x1f,0xd1,0x18,0x03,0x09,0x00,0x32,0xff,0xfc,
-0x6f,0x09,0x00,0x30,0x55,0x52,0x5f,0x13,0x0d,0x00,0xf9,0x00,0x50,0x4f,0xcb,0xbb,
-0xcf,0x60,0x2d,0x00,0x56,0x09,0xaa,0xa9,0x98,0x10,0x04,0x1b,0x18,0x8e,0xa4,0x1f,
-0x23,0x1a,0x30,0x67,0x53,0x01,0xfb,0x21,0x14,0x69,0x09,0x00,0x09,0x0c,0x25,0x06,
-0x09,0x00,0x13,0xa6,0xa2,0x1c,0x1f,0x1e,0xa2,0x1c,0x03,0x14,0x25,0x9e,0x01,0x05,
-0xd3,0x1b,0x14,0x9e,0x9e,0x01,0x14,0x9e,0x8c,0x01,0x05,0x09,0x00,0x13,0x9f,0x09,
-0x00,0x00,0xbd,0x00,0x03,0x09,0x00,0x2b,0x88,0x85,0xe1,0x00,0x10,0x9e,0x63,0x7f,
-0x21,0x88,0x9f,0x09,0x00,0x54,0x3d,0xdd,0xdd,0xcb,0x20,0x70,0x15,0x33,0x04,0x53,
-0x32,0x09,0x06,0x10,0xef,0x87,0x00,0x16,0x77,0xbf,0x3f,0x12,0x05,0x91,0x25,0x10,
-0xcb,0xc0,0x0e,0x21,0x45,0x53,0x09,0x00,0x32,0x03,0xbe,0xd6,0x71,0x07,0x20,0x1f,
-0xc6,0x97,0x0c,0x10,0xcb,0x8d,0x16,0x00,0xc1,0x28,0x70,0xcd,0x56,0x73,0x6f,0x00,
-0x0c,0x90,0xe3,0x19,0x53,0xe7,0x2f,0x93,0x6f,0x50,0x69,0x24,0x1d,0xf8,0x76,0x02,
-0x14,0x24,0xd8,0x00,0x16,0x9f,0xab,0x1c,0x00,0xe7,0x02,0x08,0xa7,0x01,0x05,0x09,
-0x00,0x35,0x8f,0x10,0x10,0x95,0x01,0x14,0x7f,0x95,0x01,0x02,0x9e,0x01,0x00,0x93,
-0x1a,0x31,0x32,0x22,0x3f,0x9e,0x01,0x11,0x3f,0xef,0x01,0x10,0x8f,0x01,0x02,0x28,
-0x32,0x21,0x1d,0x0e,0x03,0x23,0x0c,0x24,0x67,0x74,0xbf,0x36,0x12,0xff,0xae,0x0a,
-0x1a,0x10,0x04,0x3f,0x22,0x2d,0xee,0xbe,0x3f,0x60,0x00,0x5f,0xa8,0x88,0x88,0x88,
-0x07,0x71,0x06,0x7b,0x51,0x05,0xb0,0x01,0x00,0x01,0x86,0x00,0x9a,0x09,0x09,0xeb,
-0x34,0x0f,0xa7,0x01,0x1b,0x06,0xb0,0x01,0x23,0xff,0xfb,0x09,0x00,0x22,0x87,0x74,
-0xd8,0x00,0x12,0x9f,0xa7,0x01,0x19,0x60,0x48,0x00,0x47,0x06,0x66,0x66,0x54,0x8a,
-0x38,0x1c,0x48,0xd8,0x00,0x23,0x66,0x61,0x13,0x1e,0x05,0x68,0x01,0x23,0x6f,0xd1,
-0x54,0x08,0x22,0xfb,0x10,0x82,0x06,0x22,0xdf,0x90,0xbe,0x04,0x31,0x9f,0xff,0xc3,
-0x08,0x00,0x51,0x8f,0xf8,0x16,0xef,0x91,0x70,0x73,0x30,0x10,0x00,0x07,0x41,0x0b,
-0x11,0x86,0x61,0x10,0x16,0x90,0x86,0x21,0x01,0x4a,0x09,0xf0,0x04,0x70,0x05,0xf1,
+0x91,0x11,0x10,0x98,0x00,0x0e,0xc0,0x00,0x42,0x33,0x45,0x69,0x70,0xc0,0x00,0xb3,
+0xfd,0x60,0x08,0xe0,0x00,0x23,0x32,0x10,0x00,0x00,0x09,0x80,0x00,0x00,0x08,0x00,
+0x13,0x52,0x08,0x00,0x10,0xf8,0x69,0x02,0x32,0x90,0x00,0x00,0x85,0x01,0x0d,0x08,
+0x00,0x73,0x01,0xfb,0x65,0x55,0x55,0x56,0x60,0xb5,0x03,0x1a,0xf2,0xfa,0x03,0x22,
+0x01,0x30,0x70,0x01,0x11,0x07,0x68,0x00,0x11,0xe0,0x5b,0x02,0x00,0x70,0x01,0x01,
+0x08,0x00,0x18,0x08,0x08,0x00,0x02,0x70,0x01,0x22,0x07,0xf1,0x70,0x01,0x04,0xb0,
+0x00,0x07,0x08,0x00,0x01,0x70,0x01,0x13,0x07,0x70,0x01,0x1a,0x07,0x70,0x01,0x00,
+0x67,0x03,0x10,0x01,0xcd,0x02,0x40,0x88,0x40,0x00,0x08,0x87,0x00,0x43,0xef,0xe0,
+0x00,0x08,0x6b,0x00,0x0e,0x08,0x00,0x02,0xd8,0x00,0x91,0x08,0xf4,0x22,0x22,0x23,
+0x3b,0xe0,0x00,0x05,0xa0,0x01,0x12,0xb0,0xb0,0x01,0x24,0x11,0x00,0xc0,0x01,0x77,
+0x57,0x77,0x77,0x85,0x00,0x00,0x8f,0x27,0x02,0x44,0x9f,0x00,0x00,0x8f,0x1e,0x02,
+0x30,0x01,0x11,0x11,0x0f,0x00,0x13,0x0e,0x25,0x02,0x74,0xfa,0x55,0x54,0x42,0x00,
+0x00,0x8f,0x5c,0x01,0x02,0x1a,0x01,0xe1,0x8f,0x0f,0xc7,0x67,0x89,0xbe,0x70,0x08,
+0xf0,0x9e,0xee,0xed,0xca,0x71,0x3c,0x00,0x00,0xd2,0x01,0x40,0x70,0x00,0x04,0x00,
+0xbf,0x04,0x30,0x00,0x01,0xf5,0x2d,0x00,0xf2,0x03,0xd0,0x00,0x1f,0x60,0x00,0x00,
+0x00,0x9e,0x00,0x01,0xf7,0x21,0x11,0x11,0x2a,0xe0,0x00,0x1f,0x43,0x05,0x63,0x01,
+0xf9,0x66,0x66,0x55,0x5b,0x1e,0x00,0x12,0x9d,0x40,0x05,0x30,0x09,0xd0,0x00,0xd7,
+0x01,0x00,0x4b,0x04,0x10,0x35,0x1e,0x04,0x17,0x10,0x65,0x01,0x27,0x79,0x80,0xb5,
+0x02,0x0f,0xd5,0x02,0x06,0x4e,0xee,0xef,0xff,0xe0,0xd5,0x02,0x08,0x08,0x00,0x60,
+0x13,0x57,0x30,0x08,0xf0,0x0e,0x4e,0x04,0x82,0x50,0x08,0xf0,0x01,0x55,0x54,0x32,
+0x10,0x40,0x00,0x23,0x00,0x01,0x08,0x00,0x31,0x2f,0x60,0x07,0x25,0x02,0x13,0x6f,
+0x9b,0x02,0x23,0xdf,0x20,0x24,0x05,0x02,0x56,0x05,0xb0,0x4f,0xc4,0xee,0x30,0x00,
+0x00,0x00,0x04,0xfe,0x20,0x2d,0xe0,0x00,0x90,0x7f,0xd2,0x00,0x00,0xbf,0x80,0x00,
+0x09,0xf9,0x60,0x00,0x41,0xf8,0x00,0x05,0x30,0xcd,0x05,0x03,0xb8,0x00,0x12,0x20,
+0x1d,0x02,0x22,0x09,0xe0,0x66,0x01,0x13,0x09,0xb8,0x00,0x1f,0x09,0xb8,0x00,0x02,
+0x1f,0xf0,0xb8,0x00,0x0b,0x32,0x12,0x47,0x20,0xb8,0x00,0x90,0xff,0x60,0x08,0xe0,
+0x02,0x56,0x65,0x43,0x10,0x10,0x03,0x02,0x26,0x05,0x00,0x4e,0x05,0x40,0x39,0xcd,
+0xca,0x60,0x2c,0x00,0x70,0xfe,0x98,0x9c,0xfd,0x20,0x00,0x00,0x59,0x05,0x50,0x2e,
+0xc0,0x00,0x00,0xbe,0xde,0x04,0x50,0xf2,0x00,0x00,0xdc,0x00,0x60,0x05,0x30,0x00,
+0x00,0xce,0x10,0x00,0xf0,0x01,0xf3,0x00,0x00,0x7f,0x80,0x00,0x00,0x2e,0xe0,0x00,
+0x00,0x0b,0xfd,0x97,0x8b,0xfe,0xb5,0x00,0x44,0x5a,0xcd,0xca,0x61,0x76,0x05,0x04,
+0x1b,0x06,0x00,0xc2,0x01,0xe1,0x4f,0xff,0xff,0xff,0x40,0x00,0x2f,0x60,0x00,0x06,
+0xf6,0x66,0x66,0xf6,0xa8,0x01,0x50,0x6f,0x10,0x00,0x0f,0x60,0xb9,0x01,0x00,0x37,
+0x05,0x71,0xf7,0x00,0x01,0xf7,0x00,0x00,0x6f,0xa3,0x06,0x21,0x1f,0x70,0xb1,0x02,
+0x11,0xf7,0x03,0x00,0x11,0x7f,0x13,0x00,0x42,0x0f,0xb7,0x77,0x27,0x13,0x00,0x33,
+0xff,0xff,0xf7,0x13,0x00,0x0e,0x26,0x00,0x00,0x13,0x00,0x15,0xe0,0x13,0x00,0x31,
+0x11,0x11,0x1f,0x13,0x00,0x11,0x06,0x91,0x07,0x00,0x13,0x00,0x43,0x04,0x44,0x44,
+0x33,0x05,0x07,0x01,0x01,0x00,0x05,0x3b,0x07,0x06,0x13,0x00,0x15,0xf8,0x13,0x00,
+0x14,0x80,0x0a,0x00,0x2d,0xe6,0x00,0x01,0x00,0x10,0x12,0x4c,0x00,0x70,0x55,0x55,
+0x00,0x00,0xbc,0x00,0x00,0x3a,0x06,0x92,0x50,0x00,0xcc,0x00,0x00,0x8f,0x11,0x00,
+0x2f,0x09,0x00,0x10,0x00,0x09,0x00,0x1d,0xbc,0x09,0x00,0x32,0xbe,0x88,0x85,0x09,
+0x00,0x41,0xbf,0xff,0xfa,0x7f,0x09,0x00,0x11,0xbd,0xba,0x00,0xa1,0x1f,0x50,0x00,
+0xac,0x00,0x00,0x6f,0x65,0x66,0x7f,0x09,0x00,0x74,0x3f,0xff,0xff,0xed,0x20,0x00,
+0xac,0x6c,0x00,0x05,0x09,0x00,0x14,0x35,0xb0,0x06,0x13,0x20,0xa1,0x07,0x20,0xff,
+0xf8,0x16,0x00,0x54,0x44,0x44,0x44,0x44,0xfa,0x24,0x00,0x1f,0xea,0x09,0x00,0x10,
+0x14,0xf9,0x09,0x00,0x17,0x63,0xcf,0x00,0x40,0x02,0x33,0x33,0x43,0x5f,0x03,0x01,
+0xcf,0x00,0x10,0x40,0xc5,0x03,0x51,0x7f,0x22,0x21,0x3f,0x50,0x09,0x00,0x01,0xab,
+0x00,0x14,0x9e,0x09,0x00,0x19,0x8e,0x09,0x00,0x00,0xbd,0x00,0x33,0x8f,0x33,0x31,
+0x09,0x00,0x32,0xff,0xfc,0x6f,0x09,0x00,0x70,0x55,0x52,0x5f,0x00,0x00,0x0f,0x60,
+0xf9,0x00,0x50,0x4f,0xcb,0xbb,0xcf,0x60,0x2d,0x00,0x74,0x09,0xaa,0xa9,0x98,0x10,
+0x00,0x8e,0x75,0x00,0x04,0x09,0x00,0x00,0x5a,0x00,0x31,0x00,0x1a,0x30,0xbf,0x03,
+0x30,0x00,0x00,0x3f,0x7e,0x02,0x14,0x69,0x09,0x00,0x10,0x00,0x09,0x00,0x1d,0x50,
+0x09,0x00,0x91,0xa6,0x55,0x55,0x55,0x66,0x00,0x00,0x00,0x1e,0x94,0x04,0x11,0x20,
+0x27,0x08,0x16,0x11,0x89,0x08,0x14,0x25,0x9e,0x01,0x14,0x9e,0x9e,0x01,0x14,0x9e,
+0x9e,0x01,0x14,0x9e,0x8c,0x01,0x05,0x09,0x00,0x13,0x9f,0x09,0x00,0x00,0xbd,0x00,
+0x03,0x09,0x00,0x2b,0x88,0x85,0xe1,0x00,0x00,0x48,0x00,0x31,0x88,0x88,0x9f,0x09,
+0x00,0x72,0x3d,0xdd,0xdd,0xcb,0x20,0x00,0x58,0x6a,0x00,0x33,0x04,0x53,0x32,0x09,
+0x06,0x10,0xef,0x87,0x00,0x14,0x77,0x82,0x00,0x11,0xcc,0x2f,0x05,0x11,0xfa,0x5f,
+0x07,0x41,0x44,0x44,0x45,0x53,0x09,0x00,0x32,0x03,0xbe,0xd6,0x71,0x07,0x41,0x1f,
+0xc6,0x9f,0x40,0x09,0x00,0xf2,0x07,0x5f,0x10,0x0d,0x80,0x00,0x00,0xcd,0x56,0x73,
+0x6f,0x00,0x0c,0x90,0x00,0x00,0x8f,0xff,0xe7,0x2f,0x93,0x6f,0x50,0x3d,0x03,0x2d,
+0xef,0xf8,0x76,0x02,0x14,0x24,0xd8,0x00,0x14,0x9f,0xd8,0x00,0x11,0x9f,0xe7,0x02,
+0x08,0xa7,0x01,0x05,0x09,0x00,0x35,0x8f,0x10,0x10,0x95,0x01,0x14,0x7f,0x95,0x01,
+0x03,0x9e,0x01,0x61,0x00,0x00,0x6f,0x32,0x22,0x3f,0x9e,0x01,0x11,0x3f,0xef,0x01,
+0x10,0x8f,0x01,0x02,0x58,0x32,0x21,0x00,0x00,0x7e,0x70,0x00,0x10,0x05,0x0e,0x0a,
+0x10,0x74,0xad,0x04,0x01,0x68,0x01,0x02,0xae,0x0a,0x34,0x10,0x00,0x9f,0x20,0x00,
+0x00,0x09,0x00,0x20,0x2d,0xee,0x04,0x05,0x90,0x00,0x00,0x00,0x5f,0xa8,0x88,0x88,
+0x88,0x83,0x09,0x00,0x04,0x8c,0x07,0x15,0x4f,0xb0,0x01,0x31,0xfe,0xee,0xef,0x9a,
+0x09,0x7f,0x05,0x88,0x87,0x77,0x77,0x66,0x10,0xa7,0x01,0x21,0x06,0xb0,0x01,0x23,
+0xff,0xfb,0x09,0x00,0x22,0x87,0x74,0xd8,0x00,0x12,0x9f,0xa7,0x01,0x19,0x60,0x48,
+0x00,0x42,0x06,0x66,0x66,0x54,0x5b,0x02,0x01,0x01,0x00,0x1c,0x48,0xd8,0x00,0x20,
+0x66,0x61,0xa4,0x05,0x00,0x03,0x07,0x04,0x68,0x01,0x23,0x6f,0xd1,0x54,0x08,0x22,
+0xfb,0x10,0x82,0x06,0x22,0xdf,0x90,0xbe,0x04,0x31,0x9f,0xff,0xc3,0x08,0x00,0x50,
+0x8f,0xf8,0x16,0xef,0x91,0xac,0x05,0x40,0xe8,0x10,0x00,0x07,0x41,0x0b,0x20,0x86,
+0x00,0x06,0x05,0x14,0x90,0x57,0x00,0x12,0x04,0x4a,0x09,0xf0,0x13,0x70,0x05,0xf1,
 0x0c,0xdd,0xde,0xd3,0x00,0xe8,0x00,0x5f,0x12,0xfa,0x77,0x7f,0x70,0x0e,0x70,0x05,
-0xec,0x34,0xb0,0xe7,0x00,0xe7,0x00,0x5f,0x12,0xf5,0x00,0x0e,0x70,0x0f,0x11,0x00,
-0xb4,0x40,0x00,0xe7,0x00,0xf7,0x00,0x5f,0x12,0xf4,0x00,0x0f,0x11,0x00,0x70,0xf7,
-0x00,0xfa,0x55,0x9f,0x12,0xf3,0x11,0x00,0x71,0xff,0xff,0xf1,0x2f,0x30,0x00,0xf7,
-0x33,0x00,0x00,0x11,0x00,0x00,0x44,0x00,0x13,0x3f,0x11,0x00,0x42,0x13,0xf3,0x00,
-0x0e,0x55,0x00,0x52,0x75,0x44,0xf8,0x00,0xe7,0x0e,0x35,0x33,0x60,0x0e,0x80,0x77,
-0x15,0x13,0xe8,0x3d,0x2c,0x0f,0x11,0x00,0x0f,0x3d,0x09,0x40,0x04,0x60,0x62,0xb3,
-0x06,0x00,0x34,0x55,0x56,0x30,0x06,0xc0,0x04,0xf3,0x1f,0x7a,0x1d,0x40,0x42,0xf6,
-0x11,0x08,0x7a,0x1d,0x20,0xf4,0x3f,0x39,0x02,0xe0,0x7f,0x00,0x3f,0x43,0xf4,0x00,
-0x08,0xf0,0x07,0xf0,0x03,0xf4,0x3f,0x40,0x11,0x00,0x21,0xff,0xff,0x11,0x00,0x60,
-0x06,0xf7,0x68,0xf4,0x3f,0x30,0xf2,0x35,0x22,0x10,0x3f,0x11,0x00,0x41,0xf1,0x04,
-0xf4,0x2f,0xef,0x60,0x93,0x10,0x4f,0x30,0x57,0x66,0x65,0x20,0x06,0xf0,0x8e,0x2a,
-0x11,0x03,0xfc,0x5c,0x04,0x86,0x1a,0x01,0xb9,0x07,0x23,0x4f,0x00,0x87,0x1a,0x00,
-0x58,0x47,0x00,0x5b,0x3e,0x14,0x6f,0xc3,0x0c,0x00,0x11,0x00,0x53,0xa7,0x77,0x76,
-0x66,0xaf,0x22,0x00,0x23,0x07,0xf0,0x33,0x00,0x00,0xda,0x10,0x04,0x62,0x0b,0x10,
-0x03,0xe6,0x07,0x15,0x51,0x5f,0x4d,0x00,0xc4,0x00,0x53,0x20,0x07,0xe0,0x07,0xf0,
-0xc4,0x00,0xb0,0x7f,0x12,0xf6,0x11,0x09,0xe0,0x08,0xf0,0x07,0xf1,0x3f,0xd5,0x03,
-0x11,0x8f,0x74,0x36,0x00,0x3e,0x1e,0x01,0x74,0x36,0x10,0x8e,0xc4,0x00,0x01,0x11,
-0x00,0x32,0x06,0xf7,0x7a,0x11,0x00,0x50,0x6f,0x10,0x6f,0x13,0xf3,0x11,0x00,0x70,
-0xf1,0x06,0xf1,0x2f,0x85,0x56,0xbe,0x11,0x00,0x50,0x10,0xef,0xff,0xff,0xa0,0x11,
-0x00,0x03,0xda,0x2e,0x27,0x7f,0x10,0x5a,0x4a,0x00,0x10,0x1c,0x19,0x02,0xd0,0x60,
-0x14,0x0e,0x22,0x0a,0x03,0x2e,0x75,0x52,0x05,0xfb,0x7f,0xc1,0x00,0x87,0x90,0x23,
-0x4f,0xd2,0x84,0x71,0x32,0x2d,0xe4,0x00,0x68,0x90,0x56,0x1b,0xf4,0x00,0x00,0x83,
-0xa0,0x6b,0x02,0x4a,0x0e,0x00,0x13,0x0d,0x21,0x8d,0x2f,0xd0,0x02,0xb0,0x09,0xe4,
-0xf7,0x55,0x55,0xf8,0x00,0x00,0x8e,0x4f,0x30,0x34,0x10,0x60,0x08,0xe4,0xf2,0x00,
-0x00,0xe8,0x0f,0x00,0x11,0x20,0x0f,0x00,0x13,0xe5,0x0f,0x00,0xf2,0x02,0x5f,0x10,
-0x00,0x0e,0x84,0xdd,0xde,0xe5,0xf1,0x00,0x00,0xe8,0x29,0xaa,0xde,0x5f,0x10,0x1e,
-0x00,0x11,0xf1,0x1e,0x00,0x13,0x8f,0x0f,0x00,0x22,0xf5,0xf0,0x2a,0x65,0x03,0x0f,
-0x00,0x12,0xe4,0x47,0x06,0x12,0x8e,0x1b,0x07,0x29,0x08,0xe0,0x9c,0x05,0x0b,0x0f,
-0x00,0x04,0xf6,0x0a,0x15,0x6b,0xb7,0x0a,0x30,0x22,0x22,0x23,0xe0,0x0d,0x11,0x1f,
-0x79,0x0d,0x70,0x06,0xf2,0x3f,0x85,0x44,0x4f,0x80,0x08,0x00,0x10,0x40,0x3f,0x07,
-0x19,0x05,0x08,0x00,0xd2,0x81,0x66,0x69,0xf2,0x2f,0x40,0x00,0x0f,0x84,0xff,0xff,
-0xf2,0x2f,0x18,0x00,0x00,0xf5,0x02,0x01,0x03,0x11,0x22,0x1f,0x50,0x26,0x11,0xd5,
-0x0f,0xdb,0xbb,0xbf,0xb0,0x00,0x06,0xf1,0x07,0xaa,0xaa,0x99,0x30,0xc4,0x13,0x26,
-0x06,0xf0,0x08,0x00,0x13,0x97,0x08,0x00,0x13,0xeb,0xc4,0x5e,0x04,0xd5,0x06,0x0c,
-0x08,0x00,0x63,0xed,0x65,0x55,0x66,0x67,0x82,0x27,0x07,0x1b,0xe5,0xb7,0x11,0x50,
-0x70,0x03,0x44,0x55,0x56,0xc0,0x0d,0x03,0xb8,0x00,0x71,0xf1,0x2f,0x61,0x11,0x1f,
-0x80,0x00,0x93,0x38,0x23,0x0f,0x70,0x08,0x00,0x31,0x71,0x77,0x7a,0x08,0x00,0x35,
-0x74,0xef,0xff,0x18,0x00,0x21,0x1f,0x50,0xb0,0x00,0x60,0xf0,0x1f,0x72,0x22,0x3e,
-0xa0,0xfa,0x26,0x01,0x26,0x16,0x10,0x07,0x65,0x0c,0x19,0x21,0x59,0x4b,0x02,0xec,
-0x47,0x16,0x70,0x12,0x0f,0x00,0xa0,0x06,0x16,0x09,0x83,0x36,0x04,0x1a,0x3a,0x20,
-0x07,0xf9,0xea,0x0e,0x1b,0x30,0xa3,0x19,0x10,0x10,0x0b,0x0f,0x02,0xb5,0x08,0x10,
-0x57,0x00,0x2b,0x19,0x60,0x64,0x1d,0x23,0x02,0xf1,0x61,0x04,0x31,0x4f,0x20,0x6f,
-0x61,0x04,0x32,0x04,0xf3,0x06,0x61,0x04,0x31,0x4f,0x30,0x6f,0x61,0x04,0x32,0x03,
-0xf3,0x06,0x61,0x04,0x31,0x3f,0x30,0x6f,0x61,0x04,0x03,0x11,0x00,0x50,0xfd,0xbb,
-0xcf,0x30,0x6f,0x50,0x04,0x42,0xda,0xab,0xf3,0x06,0x61,0x04,0x12,0x3f,0x11,0x00,
-0x01,0x22,0x00,0x13,0x3f,0x11,0x00,0x12,0x13,0x11,0x00,0x41,0x05,0xf1,0x2f,0x41,
-0x0a,0x3c,0x01,0x61,0x04,0x10,0x80,0x11,0x00,0x40,0x02,0x33,0x44,0x40,0x11,0x00,
-0x12,0x10,0xb1,0x13,0x03,0x50,0x04,0x11,0x4f,0x38,0x67,0x00,0x04,0x03,0x23,0x05,
-0xf2,0x64,0x1d,0x22,0x5f,0x20,0x64,0x1d,0x0d,0x6f,0x39,0x60,0x01,0x30,0x03,0x44,
-0x45,0x56,0xbf,0x0a,0x02,0x7c,0x01,0xa1,0x09,0xf0,0x3f,0x62,0x22,0x2f,0x80,0x12,
-0x2a,0xf0,0x2c,0x02,0x22,0xff,0xff,0x08,0x00,0x21,0x33,0x3a,0x08,0x00,0x00,0xac,
-0x0b,0x1b,0x2f,0x08,0x00,0x80,0x1f,0x40,0x00,0x0e,0x82,0xbb,0xbd,0xe0,0x8c,0x01,
-0x51,0xa2,0x9a,0xad,0xe0,0x0f,0xb4,0x14,0x31,0x09,0xe0,0x04,0x92,0x11,0x13,0x09,
-0x11,0x0e,0x07,0x08,0x00,0x22,0x04,0xb0,0x08,0x00,0x11,0x08,0xaa,0x2f,0x1d,0x60,
-0xef,0x37,0x05,0x08,0x00,0x63,0xf7,0x65,0x55,0x66,0x77,0x81,0x48,0x10,0x1c,0xd2,
-0xce,0x45,0x40,0x02,0x33,0x33,0x44,0x7f,0x04,0x11,0x1f,0x03,0x12,0xf1,0x02,0x07,
-0xf0,0x2f,0x72,0x22,0x1f,0x90,0x67,0x7b,0xf0,0x2f,0x50,0x00,0x0e,0x93,0xef,0xff,
-0x08,0x00,0x00,0x0c,0x02,0x0a,0x08,0x00,0x11,0x08,0x08,0x00,0x31,0x91,0x99,0x9c,
-0x08,0x00,0x80,0x92,0xcd,0xde,0xf0,0x1f,0x95,0x56,0x6e,0x18,0x00,0x00,0xda,0x22,
-0x00,0x61,0x0f,0x0a,0xb2,0x15,0x20,0x02,0x70,0xc7,0x21,0x31,0xcd,0xb9,0x50,0x82,
-0x7f,0x42,0x98,0x9d,0xfc,0x10,0xd4,0x60,0x00,0xf3,0x10,0x13,0xec,0xcf,0x17,0x13,
-0xf9,0x29,0x02,0x13,0xeb,0x10,0x00,0x22,0x9f,0x60,0x7c,0x9c,0x00,0x66,0x2c,0x2c,
-0xfd,0x10,0x78,0x36,0x08,0x34,0x70,0x74,0x08,0xf8,0x87,0x77,0x77,0x7e,0xb0,0x33,
-0x22,0x14,0xcb,0x18,0x16,0x1f,0x0c,0x13,0x00,0x17,0x10,0x7f,0x94,0x15,0x21,0xfa,
-0x00,0x71,0x15,0x49,0x76,0x66,0x54,0x10,0xcd,0x55,0x07,0xd5,0x09,0x1f,0x09,0x96,
-0x29,0x05,0x13,0x7e,0x34,0x1b,0x42,0xee,0x03,0x88,0x88,0xce,0x58,0x08,0x22,0x70,
-0x10,0xef,0xa5,0x17,0x14,0xd0,0x2d,0x4d,0x17,0xf0,0xf5,0x05,0x1e,0x01,0x09,0x00,
-0x63,0xfa,0x54,0x44,0x55,0x6b,0xf0,0x08,0x13,0x2a,0xfe,0xb0,0x86,0x18,0x28,0x4f,
-0x20,0x09,0x00,0x14,0x5e,0xdf,0x11,0x14,0x28,0x10,0x45,0x0f,0x4d,0x30,0x17,0x0f,
-0x62,0x35,0x09,0x1f,0xf2,0xc0,0x38,0x0c,0x0d,0xcf,0x00,0x14,0xf7,0xbd,0x00,0x0e,
-0x09,0x00,0x00,0x01,0x1c,0x28,0x28,0xf0,0x90,0x49,0x6d,0x14,0x44,0x9f,0x53,0x32,
-0x10,0x5d,0x35,0x00,0x23,0x28,0x30,0x99,0x99,0xcf,0x0d,0x4f,0x31,0x4e,0xee,0xee,
-0x96,0x78,0x19,0xda,0xc9,0x00,0x15,0x18,0x2d,0x00,0x14,0x40,0x89,0x80,0x14,0x10,
-0xe6,0x7f,0x04,0x94,0x19,0x14,0xe8,0x94,0x19,0x13,0x20,0x94,0x19,0x4e,0xd2,0x00,
-0x04,0xef,0x94,0x19,0x13,0x44,0x76,0x58,0x24,0x77,0x20,0x44,0x1c,0x13,0x90,0x0f,
-0x02,0x1f,0x0e,0x09,0x00,0x15,0x64,0xf4,0x33,0x33,0x34,0x5f,0x90,0x26,0x52,0x13,
-0x60,0x94,0x14,0x0f,0x2a,0x2b,0x3d,0x1f,0x00,0x2a,0x2b,0x0d,0x00,0xc5,0x00,0x11,
-0x89,0xdf,0x61,0x00,0x80,0x02,0x14,0xfa,0xee,0x46,0x24,0x0d,0xa0,0x5b,0x0c,0x1f,
-0xda,0x13,0x00,0x03,0x11,0x02,0x39,0x1a,0x10,0x90,0x3d,0x01,0x00,0xec,0x47,0x1e,
-0x41,0xb9,0x00,0x07,0x67,0x47,0x12,0x86,0xe7,0x33,0x04,0xb0,0x4f,0x2b,0x0d,0xb0,
-0x2b,0x2a,0x14,0xe6,0x2b,0x2a,0x26,0x1f,0x80,0x70,0x73,0x2a,0x0c,0x80,0x0d,0x67,
-0x07,0x67,0x32,0x13,0xc6,0xe2,0x31,0x0e,0xd2,0x5a,0x02,0x41,0x12,0x11,0x12,0xa1,
-0x00,0x03,0xd6,0x1b,0x73,0x03,0xf8,0x55,0x55,0x55,0x4c,0xd0,0xfa,0x39,0x19,0x0a,
-0x09,0x00,0x13,0xf5,0x09,0x00,0x15,0x02,0xa1,0x1d,0x31,0x35,0x56,0x65,0x0f,0x32,
-0x06,0xa0,0x16,0x12,0x55,0x61,0x4a,0x25,0x5e,0xff,0x61,0x4a,0x04,0x7b,0x12,0x00,
-0x09,0x00,0x0e,0xea,0x34,0x0f,0xdc,0x5a,0x10,0x0f,0xea,0x34,0x17,0x06,0x4e,0x42,
-0x00,0x30,0xa1,0x01,0x5b,0x07,0x10,0xc0,0x6f,0x05,0x40,0x95,0x55,0x5b,0xe0,0x08,
-0x00,0x12,0x60,0xb8,0x13,0x0d,0x08,0x00,0x1f,0x50,0x08,0x00,0x0f,0x10,0xf0,0x8f,
-0x05,0x1a,0x40,0x08,0x00,0x10,0x1f,0x50,0x11,0x03,0x00,0x14,0x10,0xe0,0x3c,0x6f,
-0x45,0x54,0x44,0x43,0x20,0x87,0x05,0x1e,0x06,0x08,0x00,0x09,0xa7,0x05,0x14,0x05,
-0x88,0x19,0x01,0xcf,0x06,0x10,0x10,0x1b,0x08,0x02,0x17,0x06,0x93,0xf1,0x2f,0x61,
-0x10,0x0f,0x90,0x00,0x07,0xf2,0x07,0x06,0x0f,0x08,0x00,0x05,0x1c,0xf1,0x08,0x00,
-0x02,0x17,0x06,0x22,0x07,0xf1,0x17,0x06,0x0c,0x88,0x00,0x25,0x01,0x50,0x28,0x15,
-0x13,0x08,0x5e,0x02,0x01,0x28,0x15,0x1f,0x3b,0x3e,0x40,0x0d,0x0b,0x46,0x40,0x24,
-0x03,0x50,0xb8,0x13,0x0a,0x03,0x09,0x14,0x07,0x03,0x09,0x13,0xf2,0xeb,0x08,0x0c,
-0x08,0x00,0x0f,0x03,0x09,0x24,0x00,0xa3,0x14,0x04,0xce,0x04,0x00,0x03,0x09,0x05,
-0x33,0x40,0x31,0xf0,0x00,0x04,0xea,0x03,0x00,0xa6,0x30,0x00,0x07,0x34,0x1b,0x40,
-0x8f,0x07,0x10,0x10,0x86,0x3f,0x11,0xef,0x03,0x09,0x18,0x67,0x03,0x09,0x1f,0x20,
-0x70,0x01,0x04,0x1f,0xf1,0x70,0x01,0x2c,0x2d,0xf1,0x00,0x2c,0x71,0x00,0x6b,0x05,
-0x02,0x80,0x01,0x13,0xaf,0xbd,0x4f,0x14,0xfd,0xad,0x25,0x12,0x90,0x5d,0x05,0x12,
-0xa9,0x84,0x72,0x42,0xfc,0x00,0x6f,0xc1,0xf6,0x7d,0x60,0x04,0xee,0x30,0x00,0x0c,
-0xf8,0x04,0x95,0x13,0xf3,0x68,0x5d,0x14,0x73,0x0b,0x23,0x0f,0xb8,0x00,0x0c,0x0f,
+0xf1,0x2f,0x50,0x00,0xe7,0x00,0xe7,0x00,0x5f,0x12,0xf5,0x00,0x0e,0x70,0x0f,0x11,
+0x00,0xb4,0x40,0x00,0xe7,0x00,0xf7,0x00,0x5f,0x12,0xf4,0x00,0x0f,0x11,0x00,0x70,
+0xf7,0x00,0xfa,0x55,0x9f,0x12,0xf3,0x11,0x00,0x71,0xff,0xff,0xf1,0x2f,0x30,0x00,
+0xf7,0x33,0x00,0x00,0x11,0x00,0x00,0x44,0x00,0x13,0x3f,0x11,0x00,0x42,0x13,0xf3,
+0x00,0x0e,0x55,0x00,0x30,0x75,0x44,0xf8,0x11,0x00,0x10,0x11,0xcd,0x05,0x31,0x0e,
+0x80,0x05,0x51,0x0b,0x00,0x77,0x00,0x01,0xc0,0x00,0x0f,0x11,0x00,0x0f,0x44,0x09,
+0x40,0x04,0xf1,0xa2,0x05,0x04,0xc4,0x00,0xb0,0x06,0x00,0x34,0x55,0x56,0x30,0x06,
+0xc0,0x04,0xf3,0x1f,0xd7,0x01,0xd0,0x8f,0x00,0x4f,0x42,0xf6,0x11,0x08,0xf0,0x08,
+0xf0,0x04,0xf4,0x3f,0x39,0x02,0xe0,0x7f,0x00,0x3f,0x43,0xf4,0x00,0x08,0xf0,0x07,
+0xf0,0x03,0xf4,0x3f,0x40,0x11,0x00,0x21,0xff,0xff,0x11,0x00,0xc2,0x06,0xf7,0x68,
+0xf4,0x3f,0x30,0x00,0x8f,0x00,0x6f,0x10,0x3f,0x11,0x00,0x40,0xf1,0x04,0xf4,0x2f,
+0x44,0x00,0xc2,0x6f,0x10,0x4f,0x30,0x57,0x66,0x65,0x20,0x06,0xf0,0x04,0xf3,0x59,
+0x01,0x51,0x00,0x17,0x00,0x00,0x00,0x26,0x02,0x22,0x30,0x00,0xb9,0x07,0x13,0x4f,
+0xfa,0x0c,0xa4,0x05,0xf0,0x00,0x00,0x1f,0x71,0x00,0x00,0x01,0x6f,0xc3,0x0c,0x00,
+0x11,0x00,0x53,0xa7,0x77,0x76,0x66,0xaf,0x22,0x00,0x22,0x07,0xf0,0x33,0x00,0x00,
+0xf3,0x01,0x14,0x00,0x62,0x0b,0x10,0x03,0xe6,0x07,0x15,0x51,0xac,0x0c,0x00,0xc4,
+0x00,0x53,0x20,0x07,0xe0,0x07,0xf0,0xc4,0x00,0xe0,0x7f,0x12,0xf6,0x11,0x09,0xe0,
+0x08,0xf0,0x07,0xf1,0x3f,0x50,0x00,0x8e,0xa4,0x00,0xd0,0x13,0xf4,0x00,0x08,0xe0,
+0x07,0xf0,0x06,0xf1,0x3f,0x40,0x00,0x8e,0xc4,0x00,0x01,0x11,0x00,0x32,0x06,0xf7,
+0x7a,0x11,0x00,0x50,0x6f,0x10,0x6f,0x13,0xf3,0x11,0x00,0x70,0xf1,0x06,0xf1,0x2f,
+0x85,0x56,0xbe,0x11,0x00,0x50,0x10,0xef,0xff,0xff,0xa0,0x11,0x00,0x01,0x64,0x00,
+0x43,0x5e,0x00,0x7f,0x10,0x32,0x01,0x11,0xf0,0xfc,0x01,0x32,0xf2,0x00,0x02,0x14,
+0x03,0x13,0x10,0x9b,0x0c,0x04,0x22,0x0a,0x22,0xff,0xb0,0x74,0x02,0x31,0xfb,0x7f,
+0xc1,0x2f,0x00,0x40,0xfd,0x00,0x4f,0xd2,0x61,0x07,0x80,0xfc,0x10,0x00,0x2d,0xe4,
+0x00,0x00,0x0b,0x8e,0x05,0x51,0x1b,0xf4,0x00,0x00,0x83,0x26,0x00,0x14,0x30,0xf3,
+0x07,0x02,0x13,0x0d,0x21,0x8d,0x2f,0xd0,0x02,0xf0,0x06,0x09,0xe4,0xf7,0x55,0x55,
+0xf8,0x00,0x00,0x8e,0x4f,0x30,0x00,0x0e,0x80,0x00,0x08,0xe4,0xf2,0x00,0x00,0xe8,
+0x0f,0x00,0x11,0x20,0x0f,0x00,0x13,0xe5,0x0f,0x00,0xf2,0x02,0x5f,0x10,0x00,0x0e,
+0x84,0xdd,0xde,0xe5,0xf1,0x00,0x00,0xe8,0x29,0xaa,0xde,0x5f,0x10,0x1e,0x00,0x11,
+0xf1,0x1e,0x00,0x13,0x8f,0x0f,0x00,0x56,0xf5,0xf0,0x00,0x00,0xe9,0x0f,0x00,0x12,
+0xe4,0x47,0x06,0x12,0x8e,0x1b,0x07,0x29,0x08,0xe0,0x9c,0x05,0x0b,0x0f,0x00,0x04,
+0xf6,0x0a,0x15,0x6b,0xb7,0x0a,0x30,0x22,0x22,0x23,0xe0,0x0d,0x11,0x1f,0x79,0x0d,
+0x70,0x06,0xf2,0x3f,0x85,0x44,0x4f,0x80,0x08,0x00,0x10,0x40,0x3f,0x07,0x19,0x05,
+0x08,0x00,0xd1,0x81,0x66,0x69,0xf2,0x2f,0x40,0x00,0x0f,0x84,0xff,0xff,0xf2,0x2f,
+0x18,0x00,0x00,0xf5,0x02,0x00,0x84,0x00,0x40,0x06,0xf1,0x1f,0x50,0xcb,0x0d,0xf1,
+0x00,0x06,0xf1,0x0f,0xdb,0xbb,0xbf,0xb0,0x00,0x06,0xf1,0x07,0xaa,0xaa,0x99,0x30,
+0x17,0x08,0x06,0x62,0x01,0x02,0x08,0x00,0x13,0x97,0x08,0x00,0x10,0xeb,0xe8,0x01,
+0x16,0xb0,0xd5,0x06,0x0c,0x08,0x00,0x63,0xed,0x65,0x55,0x66,0x67,0x82,0x27,0x07,
+0x90,0xe5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x01,0x00,0xf0,0x08,
+0x02,0x70,0x03,0x44,0x55,0x56,0x00,0x00,0x07,0xf1,0x1f,0xff,0xff,0xff,0x70,0x00,
+0x06,0xf1,0x2f,0x61,0x11,0x1f,0x80,0x08,0x00,0x43,0x50,0x00,0x0f,0x70,0x08,0x00,
+0x31,0x71,0x77,0x7a,0x08,0x00,0x35,0x74,0xef,0xff,0x18,0x00,0xf4,0x12,0x1f,0x50,
+0x00,0x0e,0x80,0x00,0x06,0xf0,0x1f,0x72,0x22,0x3e,0xa0,0x00,0x07,0xf0,0x0e,0xff,
+0xff,0xff,0x90,0x00,0x07,0xf0,0x01,0x33,0x32,0x21,0x00,0x00,0x06,0xe0,0x00,0x01,
+0x00,0xa0,0x01,0x56,0x66,0x66,0x66,0x7a,0x70,0x00,0x07,0xff,0x01,0x00,0x92,0xf0,
+0x00,0x00,0x11,0x11,0x11,0x10,0x09,0xf0,0x1d,0x00,0x50,0x08,0xf0,0x00,0x04,0xef,
+0x18,0x00,0xc2,0xd0,0x00,0x07,0xf9,0x88,0x88,0x88,0x77,0x30,0x00,0x07,0xf1,0x1b,
+0x00,0x02,0x08,0x00,0xf3,0x02,0x10,0x00,0x06,0xff,0xee,0xff,0xff,0xff,0xf6,0x00,
+0x00,0x57,0x77,0x77,0x76,0x66,0x60,0x56,0x00,0x12,0x05,0xbf,0x00,0xf1,0x03,0xf1,
+0x05,0xf1,0x0c,0xdd,0xde,0xd3,0x00,0x4f,0x20,0x6f,0x12,0xfa,0x77,0x7f,0x70,0x04,
+0xf3,0xb2,0x00,0xb0,0xe7,0x00,0x4f,0x30,0x6f,0x12,0xf5,0x00,0x0e,0x70,0x03,0x11,
+0x00,0xb4,0x40,0x00,0xe7,0x00,0x3f,0x30,0x6f,0x12,0xf4,0x00,0x0f,0x11,0x00,0xb0,
+0xfd,0xbb,0xcf,0x30,0x6f,0x12,0xf3,0x00,0x0f,0xda,0xab,0x11,0x00,0x31,0x30,0x00,
+0xf7,0x22,0x00,0x13,0xf3,0x22,0x00,0x13,0x3f,0x11,0x00,0x12,0x13,0x11,0x00,0xf0,
+0x00,0x05,0xf1,0x2f,0x41,0x00,0xe8,0x00,0x3f,0x30,0x5f,0x11,0xff,0xff,0xff,0x80,
+0x11,0x00,0x40,0x02,0x33,0x44,0x40,0x11,0x00,0x10,0x10,0x88,0x00,0x32,0x03,0xf2,
+0x05,0xb6,0x00,0x22,0x4f,0x20,0x11,0x00,0x41,0x04,0xf2,0x05,0xf2,0x11,0x00,0x41,
+0x5f,0x10,0x5f,0x20,0xaa,0x00,0x23,0xa0,0x03,0xd8,0x00,0x06,0x19,0x01,0x92,0x30,
+0x03,0x44,0x45,0x56,0x00,0x00,0x09,0xf0,0x7c,0x01,0xf2,0x02,0x09,0xf0,0x3f,0x62,
+0x22,0x2f,0x80,0x12,0x2a,0xf0,0x3f,0x40,0x00,0x0f,0x80,0xff,0xff,0x08,0x00,0x22,
+0x33,0x3a,0x08,0x00,0x4b,0x00,0x08,0xf0,0x2f,0x08,0x00,0x80,0x1f,0x40,0x00,0x0e,
+0x82,0xbb,0xbd,0xe0,0x8c,0x01,0xf2,0x05,0xa2,0x9a,0xad,0xe0,0x0f,0xff,0xff,0xff,
+0xa0,0x00,0x09,0xe0,0x04,0x66,0x66,0x65,0x10,0x00,0x09,0xd0,0x68,0x00,0x07,0x08,
+0x00,0x22,0x04,0xb0,0x08,0x00,0x20,0x08,0xf1,0xa4,0x00,0x33,0x60,0x00,0x08,0x94,
+0x00,0x0d,0x08,0x00,0x81,0xf7,0x65,0x55,0x66,0x77,0x81,0x00,0x04,0xb4,0x01,0x1b,
+0xd2,0xb9,0x00,0x81,0x20,0x02,0x33,0x33,0x44,0x00,0x00,0x07,0xb8,0x00,0xf1,0x04,
+0x80,0x00,0x07,0xf0,0x2f,0x72,0x22,0x1f,0x90,0x67,0x7b,0xf0,0x2f,0x50,0x00,0x0e,
+0x93,0xef,0xff,0x08,0x00,0x00,0x0c,0x02,0x0a,0x08,0x00,0x11,0x08,0x08,0x00,0x31,
+0x91,0x99,0x9c,0x08,0x00,0x80,0x92,0xcd,0xde,0xf0,0x1f,0x95,0x56,0x6e,0x18,0x00,
+0x50,0x0d,0xff,0xff,0xfe,0x50,0x0c,0x02,0x02,0xf9,0x01,0x14,0xf0,0x9c,0x02,0xf0,
+0x0f,0x00,0x00,0x00,0x4a,0xcd,0xb9,0x50,0x00,0x00,0x00,0x0a,0xfd,0x98,0x9d,0xfc,
+0x10,0x00,0x00,0x8f,0x70,0x00,0x00,0x4f,0x90,0x00,0x00,0xec,0x00,0x00,0x00,0x44,
+0x02,0x13,0xf9,0x29,0x02,0x13,0xeb,0x10,0x00,0xd0,0x9f,0x60,0x00,0x00,0x4f,0xb0,
+0x00,0x00,0x1d,0xfc,0x87,0x8c,0xfd,0x8a,0x01,0x48,0x6a,0xcd,0xca,0x50,0xbc,0x00,
+0x10,0x5e,0xd1,0x00,0x10,0xf8,0xe3,0x00,0x50,0xf8,0x87,0x77,0x77,0x7e,0x10,0x01,
+0x10,0x8f,0x18,0x00,0x32,0xcb,0x00,0x00,0x81,0x00,0x1f,0x0c,0x13,0x00,0x17,0x60,
+0x7f,0xfe,0xee,0xee,0xff,0xfa,0x18,0x00,0x63,0x67,0x77,0x76,0x66,0x54,0x10,0xd6,
+0x01,0x04,0x6b,0x00,0x14,0x8e,0x09,0x00,0x24,0x09,0xf0,0x0a,0x00,0x1a,0x9f,0x13,
+0x00,0xf7,0x04,0x7e,0xee,0xee,0xff,0xff,0xee,0xee,0xee,0xee,0x03,0x88,0x88,0x77,
+0x77,0x77,0x88,0x88,0x88,0x60,0xab,0x00,0xf3,0x04,0xef,0xee,0xee,0xef,0xff,0xd0,
+0x00,0x00,0x01,0xfb,0x87,0x77,0x77,0x7b,0xf0,0x00,0x00,0x01,0xf6,0x1e,0x01,0x1e,
+0x01,0x09,0x00,0x50,0xfa,0x54,0x44,0x55,0x6b,0x55,0x00,0x62,0xdf,0xff,0xff,0xff,
+0xfe,0xb0,0x7c,0x02,0x04,0x8b,0x00,0x28,0x4f,0x20,0x09,0x00,0x22,0x5e,0xff,0x01,
+0x00,0x32,0xfd,0x28,0x77,0x01,0x00,0x2e,0x75,0x00,0x01,0x00,0x10,0x07,0x97,0x00,
+0xb3,0xff,0xe1,0x00,0x00,0x03,0x88,0x88,0x88,0x88,0x7b,0xf3,0x17,0x00,0x1f,0x06,
+0x09,0x00,0x08,0x1c,0xf2,0x09,0x00,0x19,0x01,0x7a,0x01,0x1d,0xdf,0xcf,0x00,0x14,
+0xf7,0xbd,0x00,0x0e,0x09,0x00,0x50,0xf8,0x11,0x11,0x11,0x28,0xcf,0x00,0x01,0xaa,
+0x00,0x00,0x4d,0x04,0x52,0x14,0x44,0x9f,0x53,0x32,0x63,0x01,0x12,0x6f,0x07,0x00,
+0x03,0x09,0x00,0xd0,0x28,0x88,0x99,0x99,0xcf,0x99,0x99,0x99,0x97,0x4e,0xee,0xee,
+0xdd,0x01,0x00,0x19,0xda,0xc9,0x00,0x15,0x18,0x2d,0x00,0x13,0x40,0x09,0x00,0x13,
+0xbf,0x12,0x00,0x32,0x04,0xff,0xa0,0x09,0x00,0x41,0x2e,0xe8,0xfb,0x00,0xc6,0x03,
+0x31,0xef,0x20,0x6f,0xec,0x02,0x90,0x7f,0xd2,0x00,0x04,0xef,0x50,0x00,0x00,0x1d,
+0x5f,0x02,0x51,0x1b,0xf7,0x00,0x00,0x07,0x41,0x01,0x41,0x44,0x00,0x00,0x01,0x31,
+0x01,0x41,0x20,0x00,0x00,0x08,0x99,0x00,0x13,0x90,0x0f,0x02,0x1f,0x0e,0x09,0x00,
+0x15,0x91,0xf4,0x33,0x33,0x34,0x5f,0x90,0x00,0x00,0x05,0x3f,0x00,0x00,0xee,0x01,
+0x5f,0x12,0x22,0x21,0x11,0x00,0x01,0x00,0x01,0x40,0x6e,0xee,0xdd,0xdd,0x33,0x01,
+0xa1,0xfd,0x27,0x88,0x88,0x88,0xbf,0x87,0x77,0x66,0x63,0x9b,0x00,0x04,0xcf,0x00,
+0x0f,0x09,0x00,0x09,0x1c,0x00,0x09,0x00,0x1b,0x6e,0x5c,0x00,0x00,0xc5,0x00,0x10,
+0x89,0x1e,0x02,0x10,0x2f,0x80,0x02,0x10,0xfa,0xfc,0x00,0x50,0xf5,0x00,0x00,0x00,
+0x0d,0x11,0x01,0x10,0x3f,0xb6,0x01,0x1f,0xda,0x13,0x00,0x03,0x20,0x02,0xff,0x92,
+0x00,0x10,0x90,0x3d,0x01,0x5f,0x77,0x77,0x76,0x65,0x41,0xb9,0x00,0x02,0x13,0x27,
+0x57,0x02,0x33,0x86,0x06,0xef,0x6a,0x02,0x01,0x81,0x04,0x24,0x0d,0xb0,0x21,0x00,
+0x03,0xa1,0x01,0x32,0xe6,0x00,0x0d,0x81,0x01,0x23,0x1f,0x80,0x13,0x00,0x54,0x01,
+0xf8,0x00,0x0c,0x80,0x13,0x00,0x03,0x05,0x04,0x14,0xf7,0x36,0x00,0x73,0x2f,0xc6,
+0x66,0x66,0x66,0x67,0x30,0xe3,0x02,0x2a,0xff,0xfa,0x4c,0x05,0x41,0x11,0x11,0x11,
+0x12,0xa1,0x00,0x00,0x01,0x00,0xe0,0xc0,0x00,0x00,0x03,0xf8,0x55,0x55,0x55,0x4c,
+0xd0,0x00,0x00,0x03,0xf4,0x3f,0x04,0x09,0x09,0x00,0x13,0xf5,0x09,0x00,0x05,0x2d,
+0x00,0x76,0x00,0x35,0x56,0x65,0x55,0x44,0x10,0x4f,0x00,0x93,0x16,0x66,0x55,0x55,
+0x55,0x55,0x56,0x66,0x75,0x2c,0x03,0x21,0xee,0xea,0xc5,0x01,0x23,0x07,0xf1,0xb4,
+0x06,0x11,0x06,0x40,0x05,0x62,0x8c,0xf8,0x89,0x9c,0xfc,0xb0,0x2c,0x03,0x34,0xdd,
+0xde,0xf1,0x3a,0x03,0x08,0x09,0x00,0x23,0x06,0xef,0xf5,0x06,0xb4,0x09,0xf8,0x77,
+0x66,0x66,0x66,0x40,0x00,0x00,0x09,0xf1,0x03,0x04,0x02,0xe0,0x06,0x00,0x4b,0x02,
+0x00,0x07,0x04,0x00,0x83,0x02,0x10,0x68,0x02,0x07,0x14,0x62,0x85,0x00,0x10,0x30,
+0xd8,0x00,0x31,0x00,0x00,0x06,0x5b,0x07,0x10,0xc0,0x6f,0x05,0x40,0x95,0x55,0x5b,
+0xe0,0x08,0x00,0x3f,0x60,0x00,0x08,0x08,0x00,0x02,0x1f,0x50,0x08,0x00,0x0f,0x10,
+0xf0,0x8f,0x05,0x19,0x40,0x08,0x00,0x00,0x18,0x00,0x10,0x09,0x20,0x00,0x00,0x3f,
+0x06,0x00,0x08,0x00,0x55,0x03,0x54,0x44,0x43,0x20,0x87,0x05,0x1e,0x06,0x08,0x00,
+0x09,0xa7,0x05,0x24,0x05,0xd0,0xb0,0x00,0x00,0xcf,0x06,0x10,0x10,0x1b,0x08,0x02,
+0x17,0x06,0x93,0xf1,0x2f,0x61,0x10,0x0f,0x90,0x00,0x07,0xf2,0x07,0x06,0x0f,0x08,
+0x00,0x05,0x1c,0xf1,0x08,0x00,0x02,0x17,0x06,0x22,0x07,0xf1,0x17,0x06,0x0c,0x88,
+0x00,0x20,0x01,0x50,0x35,0x03,0x34,0x22,0x22,0x22,0x85,0x03,0x9a,0xd0,0x00,0x02,
+0x54,0x44,0x44,0x44,0x3b,0xf0,0x6e,0x05,0x0f,0x08,0x00,0x06,0x03,0x9b,0x08,0x23,
+0x03,0x50,0x50,0x00,0x1a,0x40,0x03,0x09,0x14,0x07,0x03,0x09,0x13,0xf2,0xeb,0x08,
+0x0c,0x08,0x00,0x0f,0x03,0x09,0x24,0x23,0x77,0x40,0x03,0x09,0x12,0xe0,0x03,0x09,
+0x13,0x0a,0x90,0x00,0x41,0x0a,0xf0,0x00,0x04,0xea,0x03,0x9b,0xe0,0x00,0x08,0xfa,
+0x99,0x99,0x99,0x99,0x40,0x8f,0x07,0x61,0x10,0x00,0x07,0xff,0xee,0xef,0x03,0x09,
+0x18,0x67,0x03,0x09,0x1f,0x20,0x70,0x01,0x04,0x1f,0xf1,0x70,0x01,0x2c,0x04,0x80,
+0x09,0x09,0xe8,0x01,0x22,0x6f,0x10,0x80,0x01,0x11,0xaf,0xb3,0x02,0x32,0x00,0x01,
+0xfd,0x1d,0x00,0x32,0x0b,0xff,0x90,0x5d,0x05,0x21,0xa9,0xfb,0x2c,0x00,0x40,0xfc,
+0x00,0x6f,0xc1,0xe8,0x06,0x70,0xb0,0x00,0x04,0xee,0x30,0x00,0x0c,0x69,0x07,0x41,
+0x2c,0xf3,0x00,0x08,0x3f,0x05,0x13,0x73,0xb8,0x00,0x1f,0x40,0xb8,0x00,0x0c,0x0f,
 0x08,0x00,0x16,0x03,0xb8,0x00,0x1a,0xf0,0x28,0x02,0x09,0x3f,0x08,0x38,0x49,0xcd,
-0xba,0x3f,0x08,0x13,0x7f,0x94,0x78,0x08,0x3f,0x08,0x00,0xaf,0x06,0x13,0xeb,0x6d,
-0x01,0x22,0x9f,0x60,0x98,0xa4,0x10,0x1c,0x3f,0x08,0x12,0x20,0x3f,0x08,0x16,0x60,
-0x90,0x03,0x41,0x67,0x77,0x88,0x82,0xae,0x2b,0x30,0xff,0xfe,0xef,0xb9,0x00,0x00,
-0x2d,0x1a,0x10,0xf8,0x79,0x05,0x04,0x22,0x02,0x00,0x11,0x00,0x10,0xf7,0xac,0x31,
-0x04,0x11,0x00,0x00,0xef,0x13,0x10,0xe8,0x11,0x00,0x23,0x0f,0x60,0xfd,0x1c,0x11,
-0xff,0x33,0x08,0x22,0x7f,0x10,0xa4,0x09,0x19,0x07,0x6f,0x5a,0x14,0x54,0x49,0x84,
-0x04,0xdf,0x04,0x21,0x01,0x34,0x96,0x04,0x10,0x04,0xda,0x3b,0x14,0x53,0x36,0x06,
-0x11,0xf0,0xef,0x04,0x32,0x00,0x4d,0xf5,0xc7,0x02,0x22,0xbf,0xc2,0x6a,0x55,0x02,
-0xce,0x06,0x80,0x37,0xdf,0xd8,0xdf,0xd7,0x20,0x00,0x02,0x2a,0x9d,0x61,0x49,0xef,
-0xc2,0x00,0x16,0x20,0x54,0x68,0x2e,0x10,0x00,0x87,0x14,0x11,0x7c,0xa4,0x02,0x22,
-0x2f,0x60,0xc5,0x49,0x01,0x4c,0x08,0x11,0x9e,0x3f,0x01,0x1f,0x1f,0x13,0x00,0x03,
-0x41,0xf4,0x44,0x44,0x9f,0xdf,0x00,0x11,0x8f,0x85,0x00,0x50,0x0f,0xa6,0x66,0x28,
-0xf1,0x63,0x3c,0x00,0x87,0x14,0x11,0x8f,0x73,0x49,0x21,0x0f,0x70,0xeb,0x06,0x12,
-0x8e,0x26,0x00,0x01,0x34,0x0d,0x0a,0x13,0x00,0x44,0x22,0x11,0x19,0xe0,0x87,0x14,
-0x11,0xfc,0x13,0x00,0x00,0x95,0x23,0x0f,0x87,0x14,0x31,0x00,0x5a,0x30,0x74,0x3c,
-0x00,0x00,0x0b,0x30,0x00,0xad,0x4e,0x15,0x12,0xae,0x44,0x15,0x0b,0x09,0x00,0x32,
-0xdd,0xdd,0xef,0x1e,0x11,0x91,0x77,0x77,0x8f,0x60,0x00,0x9f,0xff,0xf9,0x6f,0x45,
-0x0f,0x45,0x9f,0x88,0x84,0x6f,0xe0,0x12,0x04,0x66,0x11,0x50,0x6f,0x66,0x66,0x7f,
-0x40,0x8b,0x13,0x41,0x2d,0xfe,0xee,0xec,0x38,0x4a,0x02,0x01,0x00,0x18,0x9c,0x96,
-0x1e,0x0f,0x87,0x14,0x43,0x10,0x14,0x0f,0x88,0x00,0x78,0x08,0x14,0x8f,0xcf,0x00,
-0x14,0x8f,0xc6,0x00,0x04,0x09,0x00,0x00,0xdf,0x07,0x42,0x6f,0x33,0x33,0x3f,0x09,
-0x00,0x01,0x4f,0x08,0x00,0x09,0x00,0x82,0x11,0x11,0x2f,0x60,0x00,0x7f,0x65,0x53,
-0xd8,0x00,0x32,0x7f,0xff,0xfd,0xd8,0x00,0x33,0x7f,0x21,0x10,0x09,0x00,0x00,0x5f,
-0x15,0x30,0x55,0x6f,0x40,0x09,0x00,0x10,0x3e,0xfd,0x46,0x0f,0xd2,0x25,0x04,0x14,
-0x03,0x32,0x31,0x01,0xbc,0x12,0x18,0x5c,0xc5,0x12,0x0f,0x29,0x31,0x04,0x15,0x65,
-0x29,0x31,0x1b,0x10,0x87,0x14,0x00,0x8b,0x29,0x52,0x04,0xe0,0x00,0x00,0xc3,0xcb,
-0x34,0x01,0xbe,0x00,0x23,0x6f,0x20,0x4a,0x2b,0x10,0x06,0x6a,0x7a,0x32,0x44,0x44,
-0x5f,0x13,0x00,0x01,0xec,0x0d,0x90,0x06,0xf5,0x44,0x20,0x6f,0x21,0x11,0x2f,0x60,
-0x7a,0x58,0x20,0x06,0xf0,0xaf,0x02,0x42,0x06,0xf5,0x33,0x10,0x99,0x01,0x20,0x6f,
-0x20,0x87,0x58,0x21,0x24,0xf4,0x86,0x07,0x01,0xfa,0x73,0x00,0x09,0x0a,0x00,0x14,
-0x06,0x02,0x35,0x11,0x06,0xc7,0x11,0x10,0x01,0x84,0x65,0x11,0x78,0xaa,0x94,0x03,
-0x59,0x53,0x01,0x97,0x00,0x0b,0x91,0x0b,0x20,0x03,0xcd,0x7e,0x05,0x10,0xd0,0xf7,
-0x00,0x5e,0xba,0xaa,0xaa,0xaa,0x94,0xe5,0x3d,0x12,0x01,0xa3,0x48,0x03,0x61,0x1e,
-0x01,0xaf,0x54,0x27,0x66,0x10,0x8a,0x14,0x11,0x4e,0xc9,0x33,0x02,0x98,0x01,0x24,
-0x0e,0x70,0x09,0x00,0x02,0x8f,0x01,0x38,0x43,0x44,0x4f,0xa1,0x01,0x55,0x44,0x42,
-0x6f,0x21,0x11,0x98,0x01,0x00,0xc5,0x01,0x20,0x33,0x31,0x09,0x00,0x02,0x98,0x01,
-0x22,0x22,0x22,0x62,0x31,0x11,0x4f,0xcb,0x15,0x11,0x7f,0x56,0x10,0x17,0x20,0x8a,
-0x14,0x11,0x02,0xe4,0x1d,0x41,0x63,0x05,0x66,0x64,0x08,0x1e,0x21,0xfe,0x2e,0xf2,
-0x15,0x34,0x01,0x00,0xae,0xcb,0x65,0x12,0x8e,0xe4,0x0b,0x31,0x56,0x67,0xcf,0x09,
-0x00,0x11,0x03,0x0e,0x6c,0x00,0x09,0x00,0x13,0xf3,0xef,0x65,0x06,0x09,0x00,0x41,
-0xff,0xee,0xef,0x80,0xfe,0x12,0x10,0x57,0xd6,0x25,0x17,0x17,0x0f,0x26,0x5f,0x4c,
-0x00,0x00,0x0d,0x40,0x79,0x02,0x0d,0x01,0x48,0x03,0x14,0x7f,0x48,0x03,0x33,0x7f,
-0xff,0xfb,0x70,0x02,0x26,0x98,0x85,0x67,0x02,0x01,0xaf,0x01,0x14,0x7f,0x48,0x03,
-0x12,0x8f,0x48,0x03,0x07,0xa4,0x2f,0x1b,0x7f,0x04,0x32,0x16,0x75,0xad,0x2f,0x13,
-0x70,0xad,0x2f,0x24,0x29,0xf7,0xad,0x2f,0x14,0xbe,0x83,0x20,0x14,0x7f,0xec,0x5a,
-0x22,0x9f,0x00,0x5e,0xaa,0x00,0x78,0x96,0x00,0x13,0x39,0x31,0x78,0xbf,0xe2,0x01,
-0x06,0x37,0xbc,0xdc,0xa6,0x10,0x36,0x10,0x10,0x43,0x07,0xf4,0x0e,0x05,0xe0,0x00,
+0xba,0x3f,0x08,0x10,0x7f,0x3f,0x08,0x1a,0xa0,0x3f,0x08,0x00,0xaf,0x06,0x13,0xeb,
+0x6d,0x01,0x00,0x3f,0x08,0x50,0x3f,0xc0,0x00,0x00,0x1c,0x3f,0x08,0x12,0x20,0x3f,
+0x08,0x16,0x60,0x90,0x03,0x40,0x67,0x77,0x88,0x82,0x56,0x05,0x40,0x2f,0xff,0xfe,
+0xef,0xb9,0x00,0x50,0x02,0xf5,0x00,0x00,0xf8,0x79,0x05,0x04,0x22,0x02,0x00,0x11,
+0x00,0x54,0xf7,0x00,0x00,0x6f,0x20,0x11,0x00,0x50,0x01,0xf5,0x00,0x00,0xe8,0x11,
+0x00,0x50,0x0f,0x60,0x00,0x0e,0x90,0x38,0x04,0x11,0xff,0x33,0x08,0x22,0x7f,0x10,
+0xa4,0x09,0x24,0x07,0xf0,0x9e,0x06,0x00,0x05,0x00,0x13,0x54,0xa8,0x07,0x14,0x3f,
+0xdf,0x04,0x21,0x01,0x34,0x96,0x04,0x64,0x04,0x44,0x44,0x44,0x55,0x53,0x36,0x06,
+0x11,0xf0,0xef,0x04,0x32,0x00,0x4d,0xf5,0xc7,0x02,0x21,0xbf,0xc2,0x08,0x00,0x12,
+0x4b,0xce,0x06,0xf1,0x02,0x37,0xdf,0xd8,0xdf,0xd7,0x20,0x00,0x02,0xef,0xea,0x40,
+0x00,0x49,0xef,0xc2,0x00,0x16,0x53,0x00,0x23,0x36,0x10,0xac,0x03,0x04,0xe4,0x04,
+0x00,0x98,0x00,0x11,0x7c,0xa4,0x02,0x21,0x2f,0x60,0x12,0x03,0x11,0x7f,0x4c,0x08,
+0x11,0x9e,0x3f,0x01,0x1f,0x1f,0x13,0x00,0x03,0x41,0xf4,0x44,0x44,0x9f,0xdf,0x00,
+0x11,0x8f,0x85,0x00,0x80,0x0f,0xa6,0x66,0x28,0xf1,0x11,0x11,0x8f,0xa4,0x07,0x60,
+0xf7,0x8f,0x00,0x00,0x07,0xe0,0xf3,0x00,0x21,0x08,0xf0,0xf9,0x08,0x11,0xf7,0x31,
+0x09,0x1c,0x08,0x13,0x00,0x41,0x22,0x11,0x19,0xe0,0x19,0x01,0x41,0xff,0xff,0xff,
+0xfc,0x13,0x00,0x50,0x02,0x33,0x33,0x33,0x00,0x13,0x00,0x03,0x01,0x00,0x05,0xef,
+0x05,0x06,0x13,0x00,0x15,0xf8,0x13,0x00,0x14,0x80,0x0a,0x00,0x1e,0xe6,0x76,0x06,
+0xa1,0x23,0x00,0x00,0x3c,0x00,0x00,0x0b,0x30,0x00,0xad,0x18,0x08,0x41,0x0f,0x60,
+0x00,0xae,0x56,0x01,0x0c,0x09,0x00,0x40,0xdd,0xdd,0xef,0x60,0xd5,0x00,0xb0,0x6f,
+0x77,0x77,0x8f,0x60,0x00,0x9f,0xff,0xf9,0x6f,0x00,0xde,0x00,0x30,0x9f,0x88,0x84,
+0x09,0x00,0x31,0x50,0x00,0x9e,0x2d,0x00,0x12,0x2f,0x09,0x00,0xd0,0x66,0x66,0x7f,
+0x40,0x00,0x9d,0x00,0x00,0x2d,0xfe,0xee,0xec,0x10,0x5a,0x00,0x02,0x01,0x00,0x14,
+0x9c,0x09,0x00,0x10,0x11,0x68,0x02,0x00,0x8c,0x04,0x10,0x20,0x58,0x08,0x04,0x5b,
+0x0a,0x55,0x35,0x44,0x44,0x44,0x44,0xa0,0x06,0x1f,0xea,0x09,0x00,0x10,0x14,0xf9,
+0x09,0x00,0x14,0x63,0x09,0x00,0x41,0x14,0x00,0x00,0x28,0x78,0x08,0x14,0x8f,0xcf,
+0x00,0x14,0x8f,0xc6,0x00,0x04,0x09,0x00,0x00,0xdf,0x07,0x42,0x6f,0x33,0x33,0x3f,
+0x09,0x00,0x01,0x4f,0x08,0x00,0x09,0x00,0x82,0x11,0x11,0x2f,0x60,0x00,0x7f,0x65,
+0x53,0xd8,0x00,0x32,0x7f,0xff,0xfd,0xd8,0x00,0x32,0x7f,0x21,0x10,0x09,0x00,0x00,
+0x24,0x00,0x40,0x65,0x55,0x6f,0x40,0x09,0x00,0x5e,0x3e,0xff,0xff,0xfe,0x10,0x30,
+0x08,0x01,0x09,0x00,0x23,0x03,0x00,0xf6,0x0a,0x10,0x4f,0x42,0x03,0x14,0x5c,0x09,
+0x00,0x01,0x47,0x0a,0x1d,0x40,0x09,0x00,0x51,0x96,0x55,0x55,0x55,0x65,0x51,0x08,
+0x00,0x01,0x00,0x22,0x10,0x00,0xe4,0x04,0x05,0x9e,0x01,0x81,0x15,0x00,0x00,0x04,
+0xe0,0x00,0x00,0xc3,0x5e,0x04,0x02,0xbe,0x00,0x21,0x6f,0x20,0xd3,0x05,0x11,0xf6,
+0x81,0x03,0x42,0x6f,0x44,0x44,0x5f,0x13,0x00,0x01,0xec,0x0d,0x60,0x06,0xf5,0x44,
+0x20,0x6f,0x21,0xc9,0x00,0x50,0x6f,0xff,0xfe,0x06,0xf0,0xaf,0x02,0x42,0x06,0xf5,
+0x33,0x10,0x99,0x01,0x00,0x26,0x00,0x41,0xf2,0x22,0x24,0xf4,0x86,0x07,0x11,0x4f,
+0x6e,0x00,0x00,0x09,0x0a,0x10,0x12,0x12,0x06,0x25,0x05,0xf0,0x74,0x05,0x00,0x04,
+0x00,0x72,0x66,0x66,0x77,0x77,0x78,0x40,0x00,0x1f,0x01,0x32,0xff,0xfe,0x00,0x97,
+0x00,0x0b,0x91,0x0b,0x20,0x03,0xcd,0x7e,0x05,0x10,0xd0,0xf7,0x00,0x58,0xba,0xaa,
+0xaa,0xaa,0x94,0xd5,0x0a,0x33,0x00,0x6f,0x30,0x4c,0x00,0x11,0x05,0x87,0x0e,0x10,
+0xf7,0x0a,0x00,0x80,0x77,0x77,0x77,0x66,0x66,0x10,0x00,0x00,0x11,0x00,0x01,0x00,
+0xf4,0x02,0x24,0x00,0x00,0x4e,0x00,0x00,0x0a,0x40,0x00,0x8f,0x00,0x00,0x6f,0x00,
+0x00,0x0e,0x70,0x09,0x00,0x92,0x60,0x00,0x7f,0x00,0x00,0x6f,0x43,0x44,0x4f,0x09,
+0x00,0xf0,0x0b,0xff,0xff,0xff,0x60,0x00,0x7f,0x44,0x42,0x6f,0x21,0x11,0x1f,0x60,
+0x00,0x7f,0xff,0xfd,0x6f,0x00,0x00,0x0f,0x60,0x00,0x7f,0x33,0x31,0x09,0x00,0x11,
+0x50,0x24,0x00,0x40,0x22,0x22,0x2f,0x50,0x3f,0x00,0x50,0x4f,0xff,0xff,0xff,0x20,
+0x12,0x00,0x83,0x01,0x22,0x22,0x20,0x00,0x00,0x7e,0x00,0x01,0x00,0xf0,0x02,0x02,
+0x00,0x00,0x00,0x55,0x55,0x63,0x05,0x66,0x64,0x00,0x00,0x03,0xff,0xff,0xfe,0x2e,
+0x27,0x00,0x80,0x00,0x01,0x00,0xae,0x00,0x00,0x5f,0x20,0x21,0x00,0xa0,0x8e,0x00,
+0x00,0x4f,0x20,0x00,0x00,0x56,0x67,0xcf,0x09,0x00,0x00,0x24,0x00,0x12,0xea,0x09,
+0x00,0x10,0xf3,0x1e,0x00,0x18,0x5f,0x09,0x00,0xf4,0x00,0xff,0xee,0xef,0x80,0x00,
+0x5f,0x10,0x00,0x00,0x57,0x77,0x76,0x20,0x00,0x17,0x63,0x00,0x72,0x13,0x00,0x00,
+0x4c,0x00,0x00,0x0d,0xcf,0x00,0x10,0x10,0xa2,0x00,0x02,0xcf,0x00,0x08,0x09,0x00,
+0x00,0xab,0x00,0x32,0xdd,0xdd,0xef,0x09,0x00,0x30,0x77,0x77,0x8f,0xcf,0x00,0x40,
+0xfb,0x6f,0x00,0x00,0xd8,0x00,0x20,0x98,0x85,0x09,0x00,0x02,0xcf,0x00,0x32,0x00,
+0x00,0x2f,0x09,0x00,0x31,0x66,0x66,0x7f,0x51,0x00,0x74,0x2d,0xfe,0xee,0xec,0x00,
+0x00,0x8f,0x6c,0x00,0x14,0x7f,0x09,0x00,0x11,0x37,0x06,0x00,0x31,0x46,0x75,0x40,
+0x08,0x00,0xf3,0x0d,0x6e,0xff,0xee,0xff,0x70,0x00,0x00,0x00,0x06,0xfb,0x20,0x00,
+0x29,0xf7,0x00,0x00,0x00,0x0d,0xd0,0x00,0x00,0x00,0xbe,0x00,0x00,0x00,0x0f,0x90,
+0x36,0x00,0xf0,0x00,0x0f,0xa0,0x00,0x00,0x00,0x9f,0x00,0x00,0x00,0x0b,0xf4,0x00,
+0x00,0x04,0xfc,0x1b,0x01,0x50,0xef,0xb8,0x78,0xbf,0xe2,0x3f,0x00,0x55,0x07,0xbc,
+0xdc,0xa6,0x00,0x01,0x00,0xf4,0x14,0x04,0x10,0x00,0x00,0x00,0x10,0x05,0xe0,0x00,
 0xe8,0x3e,0x10,0x00,0x6e,0x00,0x7f,0x00,0x0f,0x84,0xf3,0x00,0x07,0xf0,0x07,0xf0,
 0x00,0xf8,0x4f,0x30,0x00,0x7f,0x00,0x7f,0x00,0x0e,0x11,0x00,0x15,0xe8,0x11,0x00,
-0x32,0xf7,0x44,0x49,0x11,0x00,0x00,0xeb,0x15,0xf1,0x06,0x7f,0x66,0x6f,0x84,0xf5,
-0x11,0x18,0xe0,0x07,0xff,0xff,0xf8,0x4f,0x40,0x00,0x7e,0x00,0x6f,0x00,0x0e,0x84,
-0x24,0x13,0x32,0xf0,0x00,0xe8,0x24,0x13,0x44,0x00,0x0e,0x83,0xf3,0x11,0x00,0x30,
-0x52,0x21,0xae,0x11,0x00,0x10,0x82,0x22,0x1c,0x00,0x11,0x00,0x40,0x01,0x33,0x33,
-0x20,0x11,0x00,0x03,0xd0,0x44,0x03,0x2b,0x38,0x0d,0x11,0x00,0x12,0x7f,0x11,0x00,
-0x00,0x70,0x57,0x1e,0xd8,0x8d,0x2d,0x81,0x92,0x00,0x02,0x70,0x06,0xe0,0x04,0xf3,
-0x50,0x01,0x00,0x8a,0x14,0x31,0xf4,0x00,0x07,0x8a,0x14,0x21,0x2f,0x40,0xb3,0x00,
-0x51,0x4f,0x42,0xf9,0x77,0x7b,0x8a,0x14,0x40,0x2f,0xfe,0xee,0xff,0x04,0x32,0x11,
-0x42,0x79,0x14,0x42,0xfb,0xbc,0xf4,0x2f,0xc6,0x13,0xe0,0x3f,0x42,0xf4,0x00,0x09,
-0xe0,0x06,0xf1,0x03,0xf4,0x2f,0x51,0x11,0xad,0x8a,0x14,0x11,0x41,0xa2,0x00,0x8e,
-0xf1,0x04,0xf3,0x01,0x44,0x44,0x30,0x00,0x04,0x32,0x06,0x8d,0x2d,0x1f,0xc0,0x04,
-0x32,0x1e,0x1b,0x09,0x8d,0x2d,0x06,0x03,0x56,0xa2,0xf5,0x4e,0x10,0x00,0x06,0xd0,
-0x00,0x00,0xf5,0x6f,0xfe,0x06,0x0f,0x08,0x00,0x07,0x31,0x54,0x44,0x49,0x08,0x00,
-0x00,0x6e,0x06,0xd1,0x6a,0xaa,0xf5,0x6f,0x21,0x11,0x17,0xe0,0x6b,0xbb,0xf5,0x5f,
-0x10,0xd9,0x1a,0x04,0x08,0x00,0x1d,0xf6,0x08,0x00,0x30,0x32,0x11,0x18,0x08,0x00,
-0x12,0x4f,0xb9,0x00,0x66,0xf6,0x01,0x33,0x43,0x33,0x10,0x58,0x68,0x0f,0x08,0x00,
-0x0d,0x1c,0xe4,0x14,0x4b,0x52,0x09,0x20,0x00,0x05,0x40,0xf6,0x09,0x20,0x0c,0x90,
-0x06,0x0a,0x14,0x40,0x08,0x00,0x00,0x24,0x37,0x61,0x05,0xf2,0x2f,0x63,0x33,0x4e,
-0x08,0x00,0x00,0xfe,0x09,0x82,0x11,0x16,0xf2,0x2f,0x51,0x11,0x1e,0x95,0xd9,0x13,
-0x40,0x0e,0x90,0x44,0x48,0x5c,0x12,0x01,0xd9,0x13,0x05,0x08,0x00,0x30,0x97,0x77,
-0x7f,0x3e,0x0a,0x5e,0x0b,0xdd,0xdd,0xdc,0x20,0x56,0x0b,0x03,0xd9,0x13,0x14,0x07,
-0xd9,0x13,0x1f,0xa0,0xd9,0x13,0x25,0x20,0x1e,0x30,0x71,0x80,0x22,0x07,0xf1,0xa8,
-0x00,0x03,0x08,0x00,0x00,0xb8,0x00,0x31,0x73,0x44,0x4e,0x08,0x00,0x00,0xd5,0xac,
-0x21,0x77,0x7a,0xb0,0x00,0x10,0x94,0xd9,0x13,0x00,0xb0,0x00,0x06,0xa8,0x00,0x63,
-0xf0,0x2f,0x52,0x22,0x2f,0x70,0x16,0x0c,0x01,0x72,0x7b,0x2f,0x22,0x22,0xd9,0x13,
-0x03,0x18,0x09,0xd9,0x13,0x07,0xd6,0x0a,0x13,0x06,0xd9,0x13,0x20,0x09,0xf9,0x31,
-0x28,0x15,0x30,0xfa,0x0c,0x25,0x09,0xf2,0xd6,0x0a,0x1e,0xff,0xd6,0x0a,0x21,0x40,
-0x1c,0xb8,0x00,0x14,0x06,0xb0,0x00,0x0e,0x08,0x00,0xd3,0xcb,0xbb,0xbf,0x90,0x11,
-0x17,0xf1,0x2f,0xba,0xa9,0x9f,0x92,0xff,0xb8,0x00,0x26,0x45,0x59,0xc0,0x00,0x00,
-0x1d,0x13,0x00,0x08,0x00,0x30,0x86,0x66,0x6f,0x68,0x01,0x7c,0x0c,0xee,0xee,0xed,
-0x30,0x00,0x06,0xae,0x0c,0x03,0x34,0x26,0x00,0xc5,0x6f,0x03,0xfe,0x1f,0x23,0x00,
-0xf8,0xca,0x02,0x03,0x08,0x00,0x19,0x01,0x08,0x00,0x12,0xe0,0xad,0x32,0x23,0x3a,
-0xe0,0x80,0x0e,0x1a,0xb0,0xad,0x32,0x70,0x01,0x50,0x1e,0x40,0x00,0x08,0x60,0x96,
-0x0a,0x10,0x50,0xab,0x22,0x01,0xa6,0x0a,0x22,0x0d,0xa0,0x76,0x0b,0x00,0x80,0x01,
-0x02,0x20,0x02,0x70,0x66,0x6a,0xf2,0x2f,0x96,0x65,0x5e,0xb8,0x00,0x23,0x1f,0x40,
-0xc6,0x0a,0x01,0xf9,0x15,0x06,0x08,0x00,0x10,0x0f,0xe7,0x16,0x00,0x96,0x21,0x01,
-0x0c,0x66,0x26,0x06,0xf0,0x0e,0x0e,0x13,0x51,0xfe,0x0c,0x13,0xf7,0x30,0x02,0x14,
-0xf7,0xc2,0x7c,0x56,0x33,0x32,0x33,0x39,0xf0,0x25,0x18,0x00,0xe5,0x43,0x1f,0x38,
-0xad,0x32,0x1a,0x10,0x10,0x49,0x15,0x00,0x20,0x05,0x00,0xf4,0x14,0x50,0x14,0xf3,
-0x00,0x06,0xf0,0x05,0x15,0x10,0x4f,0x16,0x04,0x0f,0x11,0x00,0x02,0x00,0x20,0x05,
-0x00,0x11,0x00,0x00,0x64,0x03,0xf1,0x00,0xbb,0xcf,0x40,0x6f,0x14,0xf5,0x11,0x17,
-0xfa,0xab,0xf4,0x06,0xf1,0x4f,0x40,0xcd,0x36,0x31,0x6f,0x14,0xf4,0x11,0x37,0x00,
-0x55,0x18,0x00,0x11,0x37,0x12,0x30,0x44,0x18,0xd0,0x02,0xf3,0x05,0xf1,0x3f,0x52,
-0x21,0x9e,0x00,0x2f,0x30,0x5f,0x12,0x9f,0x03,0x00,0x49,0x15,0x01,0x20,0x05,0x05,
-0x49,0x15,0x13,0xf3,0x49,0x15,0x1c,0x3f,0x49,0x15,0x2e,0x4f,0x20,0x49,0x15,0x06,
-0x20,0x05,0x40,0xa2,0x00,0x03,0x70,0xd0,0x3b,0x01,0xaa,0x1c,0x40,0x1f,0x60,0x4f,
-0x42,0xa0,0x05,0x32,0x01,0xf6,0x04,0xfe,0x04,0xf1,0x04,0x0f,0x60,0x4f,0x42,0xfd,
-0xcc,0xce,0xe3,0x34,0xf7,0x03,0xf4,0x2f,0xb9,0x99,0xdf,0xff,0xff,0x70,0x0f,0x05,
-0x40,0xe3,0x23,0xf7,0x03,0x22,0x00,0x30,0xad,0x00,0x0f,0x11,0x00,0x00,0x15,0x10,
-0x40,0xf7,0x04,0xf4,0x1f,0x8d,0x0f,0x00,0xf1,0x32,0x10,0x35,0x2f,0x21,0x16,0xf5,
-0x38,0x44,0x15,0x00,0x4f,0x4d,0x03,0x01,0x81,0x03,0x58,0x28,0x08,0xe6,0x6f,0x04,
-0x51,0x4d,0x02,0x00,0x7a,0x17,0xea,0xdc,0x25,0x2b,0x8f,0x10,0x53,0x4d,0x31,0x06,
-0x88,0x87,0xe0,0x36,0x03,0xe6,0x18,0x11,0x08,0x68,0x04,0x22,0x09,0xf0,0x68,0x04,
-0x22,0x09,0xf0,0x68,0x04,0x01,0xed,0x15,0x20,0x0d,0x92,0x55,0x15,0x00,0x68,0x04,
-0x30,0x66,0x6b,0xf0,0x48,0x02,0x00,0x18,0x00,0x00,0xb8,0x03,0x03,0x20,0x00,0x02,
-0x5d,0x15,0x00,0xb8,0x03,0x30,0x88,0x8c,0xe0,0x08,0x00,0x92,0x82,0xde,0xef,0xe0,
-0x2f,0x86,0x65,0x5f,0x70,0x29,0x21,0x2f,0xed,0x30,0x0d,0x16,0x01,0x23,0x00,0x97,
-0x08,0x00,0x12,0xeb,0x0d,0x16,0x0f,0x68,0x04,0x2a,0x18,0x08,0xb0,0x00,0x51,0x0c,
-0x90,0x9a,0xad,0xf0,0x68,0x04,0x23,0xbc,0xce,0xb0,0x00,0x13,0x07,0xb0,0x00,0x12,
-0x07,0xb0,0x00,0x22,0x23,0x39,0xb0,0x00,0x22,0xff,0xff,0x68,0x04,0x2b,0x23,0x39,
-0x68,0x04,0x16,0x07,0xee,0x0f,0x0f,0x68,0x04,0x3e,0x14,0x20,0x6c,0x3d,0x14,0x2f,
-0x7e,0x3d,0x24,0x03,0xf5,0x17,0x6c,0x01,0xeb,0x12,0x11,0xf6,0x19,0x47,0x31,0x22,
-0x22,0x22,0x79,0x1f,0x01,0xec,0xac,0x02,0x13,0x00,0x53,0x33,0x33,0x33,0x4f,0x60,
-0xa2,0x2f,0x24,0x02,0xf5,0x55,0x46,0x01,0x46,0x35,0x14,0x3f,0x13,0x00,0x15,0x03,
-0x7d,0x6f,0x22,0x03,0x66,0xf3,0x11,0x0f,0xd7,0x4e,0x04,0x1a,0x9e,0x13,0x00,0x10,
-0x6e,0x71,0x15,0x03,0x0d,0x16,0x02,0x01,0x00,0x12,0x60,0x18,0x43,0x21,0x02,0x20,
-0xa9,0x1c,0x03,0x05,0x66,0x14,0xf8,0x09,0x00,0x10,0xfb,0x23,0x2f,0x18,0xb0,0x67,
-0x30,0x01,0xe3,0x77,0x04,0x09,0x00,0x24,0x0b,0xb0,0x31,0x2b,0x11,0xa0,0x77,0x31,
-0x3e,0xbf,0x77,0x66,0xfe,0x4d,0x02,0xd5,0x58,0x10,0xcf,0x80,0x2f,0x08,0xaa,0x70,
-0x0f,0x0d,0x16,0x46,0x14,0x20,0xcf,0x00,0x1d,0xf7,0xcf,0x00,0x10,0xf9,0xdc,0x7d,
-0x05,0xcf,0x00,0x01,0x1b,0x00,0x58,0x22,0x22,0x22,0x2b,0xb0,0xcf,0x00,0x00,0x12,
-0x00,0x27,0x1c,0xb0,0xc8,0x45,0x6a,0x00,0x13,0x34,0xbf,0x44,0x33,0x5a,0x35,0x2f,
-0x00,0xaf,0xd6,0x4e,0x0e,0x1e,0x51,0xe8,0x5c,0x0e,0x64,0x6f,0x08,0x62,0x2a,0x24,
-0x66,0x75,0x77,0x14,0x18,0xfd,0x18,0x01,0x22,0xa4,0x00,0xc2,0x3f,0x21,0x00,0xf8,
-0xb8,0x2c,0x00,0xc6,0x00,0x54,0x11,0x11,0x11,0x1e,0x70,0xc6,0x00,0x01,0x81,0x79,
-0x04,0xb3,0x2f,0x14,0xf7,0xd5,0x0e,0x41,0xfc,0x98,0x88,0x88,0x9c,0x79,0x30,0xac,
-0xdd,0xef,0x03,0x08,0x0e,0x95,0x01,0xa2,0x6f,0xee,0xdd,0xdd,0xef,0xdd,0xdd,0xee,
-0xfb,0x26,0xbd,0x00,0x2a,0x66,0x63,0x63,0x60,0x25,0x34,0x42,0xb3,0x89,0x10,0xd0,
-0x25,0x10,0x49,0x43,0x33,0x32,0x2b,0x3f,0x31,0x10,0x66,0x0e,0x2d,0x03,0x3f,0x31,
-0x3f,0xee,0xee,0x90,0x76,0x14,0x07,0x18,0xf7,0x3f,0x31,0x05,0x6d,0x02,0x14,0xf8,
-0xc3,0x97,0x0f,0x6d,0x02,0x04,0x09,0x95,0x01,0x05,0x09,0x00,0x64,0xfb,0x77,0x77,
-0x66,0x6d,0xa0,0xd4,0x32,0x1d,0x60,0xd8,0x00,0x00,0x31,0x07,0x30,0x33,0x33,0x9f,
-0x36,0x55,0x05,0x3a,0x2b,0x21,0x04,0x44,0x4c,0x47,0x02,0xf0,0x76,0x24,0x19,0x20,
-0x3f,0x31,0x1b,0x50,0x3f,0x31,0x14,0x04,0x0a,0x5d,0x42,0x2e,0xe7,0xfc,0x10,0xab,
-0x17,0x31,0x30,0x5f,0xe3,0x37,0x0b,0x50,0xe2,0x00,0x03,0xdf,0x60,0xfa,0xaf,0x12,
-0x10,0x30,0x99,0x24,0x07,0x20,0x2f,0x26,0x14,0xb4,0x9e,0x01,0x03,0xfb,0x57,0x03,
-0xde,0x01,0x01,0x67,0x0b,0x68,0x1f,0x82,0x22,0x22,0x22,0xe8,0x1b,0x4b,0x74,0x00,
-0x1f,0x83,0x33,0x33,0x33,0xf8,0x78,0x2c,0x24,0x0e,0x80,0x12,0x04,0x11,0xf8,0x3d,
-0x47,0x45,0x77,0x66,0x66,0x6f,0xda,0x48,0x0c,0x06,0x84,0x03,0xe4,0x0e,0x02,0x82,
-0x4d,0x26,0x56,0x66,0x9d,0x30,0x54,0x01,0x12,0x22,0x22,0x8f,0x07,0x0f,0x0f,0x9d,
-0x30,0x13,0x1e,0x07,0x9d,0x30,0x0d,0x71,0x73,0x10,0xd7,0xc9,0x01,0x18,0x90,0xa0,
-0x01,0x05,0x09,0x00,0x05,0xa0,0x01,0x05,0xb2,0x01,0x05,0x6b,0x03,0x05,0xa9,0x01,
-0x03,0xbb,0x18,0x00,0x16,0x04,0x3e,0x67,0x66,0x66,0x70,0x4a,0x09,0x90,0x72,0x43,
-0x77,0x77,0x7d,0xe7,0xdf,0x32,0x03,0xcd,0x78,0x14,0x42,0x09,0x00,0x1e,0xf9,0x09,
-0x00,0x01,0xd2,0x82,0x08,0xd1,0x10,0x10,0xfc,0x3e,0x03,0x11,0x76,0x05,0x91,0x04,
-0x82,0x0f,0x04,0x01,0x00,0x11,0x94,0x78,0x21,0x03,0x99,0x00,0x23,0x0e,0x80,0xf7,
-0x35,0x10,0x1e,0x09,0x00,0x05,0x95,0x01,0x00,0xcb,0x08,0x10,0x4e,0x09,0x00,0x05,
-0x94,0x01,0x05,0x8a,0x01,0x12,0xbe,0x29,0x92,0x1b,0x00,0x65,0x42,0x15,0x11,0x76,
-0x7a,0xa5,0xfb,0x03,0x44,0x55,0x55,0xbf,0x44,0x44,0x44,0x31,0x9a,0x0c,0x00,0x3e,
-0x03,0x35,0xaf,0x33,0x32,0xdd,0x3e,0x01,0x92,0x2c,0x0c,0x3e,0x03,0x1f,0x02,0x3e,
-0x03,0x16,0x09,0x7d,0x34,0x10,0x95,0xa8,0x02,0x13,0x90,0xfc,0x00,0x01,0xf0,0x28,
-0x67,0xfa,0x11,0x11,0x11,0x17,0xe0,0xf2,0x37,0x01,0x0d,0x04,0x10,0x49,0x09,0x00,
-0x03,0x00,0x3d,0x00,0x35,0x03,0x12,0x76,0x8f,0x34,0x14,0xbe,0x95,0x01,0x0c,0xcf,
-0x00,0x16,0x7f,0x8e,0x2d,0x43,0x55,0x55,0xaf,0x54,0xcf,0x00,0x06,0x94,0x64,0x20,
-0x10,0x01,0x13,0x4d,0x05,0x94,0x30,0x10,0xf7,0x8f,0x2f,0x18,0x40,0x31,0x64,0x05,
-0xdd,0x6b,0x01,0x5e,0x06,0x1f,0xd0,0xe6,0x6b,0x14,0x10,0xa4,0x17,0x00,0x14,0x70,
-0x76,0x13,0x14,0xbc,0x89,0x13,0x01,0x60,0x06,0x78,0x0f,0x92,0x22,0x22,0x22,0xbc,
-0x00,0x7c,0x06,0x74,0x0f,0x93,0x33,0x33,0x33,0xcc,0x00,0x67,0x02,0x14,0xc0,0xed,
-0x04,0x21,0xbc,0x00,0xe5,0x00,0x40,0x66,0x66,0x6d,0xb0,0x18,0x00,0x11,0xef,0xf8,
-0x52,0x0f,0x3e,0x03,0x0a,0x17,0x06,0x3e,0x03,0x54,0x2d,0xb2,0x11,0x12,0xf7,0xf2,
-0x65,0x23,0x1f,0x70,0x47,0x1a,0x1f,0x01,0x13,0x00,0x06,0x15,0xda,0x0d,0x4f,0x16,
-0x90,0x57,0x45,0x03,0xd2,0x23,0x05,0xf6,0x07,0x01,0xaa,0x07,0x14,0xf4,0xdd,0x37,
-0x23,0x2f,0x50,0xc8,0x12,0x02,0xd0,0x07,0x00,0xf6,0x07,0x28,0x4f,0x60,0x5c,0x8d,
-0x73,0x04,0xf5,0x33,0x33,0x33,0x5f,0x50,0x3e,0x1d,0x24,0x03,0xf5,0xf2,0x3e,0x23,
-0x3f,0x40,0x09,0x08,0x2f,0x03,0xf4,0xf6,0x07,0x06,0x0f,0x01,0x00,0x06,0x00,0x57,
-0x81,0x00,0xfb,0x6e,0x16,0x30,0x6a,0x81,0x03,0x4f,0x4e,0x00,0xac,0x0e,0x10,0xa3,
-0x69,0x01,0x18,0x30,0x34,0x06,0x1d,0xf8,0x58,0x06,0x13,0xf8,0x58,0x06,0x24,0x01,
-0xf6,0x24,0x00,0x01,0x1a,0x03,0x10,0x60,0xf9,0x86,0x0b,0x1a,0x03,0x17,0x00,0xb7,
-0x8b,0x01,0xfc,0x75,0x50,0xf9,0x15,0x66,0x66,0x77,0xd1,0x0f,0x1a,0x52,0x1e,0x39,
-0x25,0x34,0x42,0x32,0x7e,0x13,0xc0,0x58,0x06,0x18,0x2c,0x89,0x81,0x02,0x1a,0x03,
-0x14,0xd0,0x1a,0x03,0x17,0x80,0xd8,0x3c,0x14,0x0a,0x1a,0x03,0x14,0x09,0x1a,0x03,
-0x19,0x01,0x97,0x37,0x02,0xc4,0x04,0x00,0x23,0x93,0x50,0x1e,0x30,0x00,0x02,0xf2,
-0x60,0x0e,0x10,0x50,0xbe,0x3c,0x01,0x58,0x0f,0x0d,0x08,0x00,0x10,0xf4,0x08,0x00,
-0x31,0x94,0x44,0x46,0x10,0x00,0x01,0x94,0xb4,0x01,0x99,0x22,0x11,0x13,0x08,0x00,
-0x39,0x60,0x00,0x03,0x08,0x00,0x11,0x50,0x08,0x00,0x00,0xc6,0x1a,0x21,0x04,0xf3,
-0x8e,0x19,0x20,0x11,0x15,0x60,0x00,0x11,0x0f,0x9f,0x30,0x31,0x06,0xf0,0x01,0x54,
-0x01,0x0e,0xc6,0x1a,0x0a,0x1d,0x37,0x04,0x08,0x00,0x27,0x03,0xb0,0xf8,0x0f,0x10,
-0x02,0x40,0x0b,0x20,0x2f,0x50,0x2d,0x00,0x01,0x90,0x0b,0x10,0x07,0x51,0x2c,0x05,
-0x08,0x00,0x31,0x63,0x33,0x49,0x08,0x00,0x03,0x41,0x2d,0x20,0x2f,0x51,0x9c,0x69,
-0x13,0x08,0x56,0x1b,0x01,0x90,0x0b,0x01,0x8a,0x4a,0x05,0x08,0x00,0x40,0x97,0x77,
-0x7c,0xd0,0x90,0x0b,0x00,0xae,0xb3,0x06,0x36,0x2f,0x07,0x90,0x0b,0x12,0xb5,0x08,
-0x00,0x21,0x01,0xf8,0x9f,0x5b,0x06,0x82,0x8a,0x0d,0x92,0x8a,0x00,0x90,0x0b,0x1f,
-0x81,0x92,0x8a,0x03,0x60,0x04,0x50,0x1e,0x30,0x00,0x04,0x84,0x75,0x02,0xa8,0x00,
-0x07,0x08,0x00,0x10,0x73,0x7b,0x04,0x22,0x0a,0xd0,0xb0,0x00,0x22,0x0a,0xd0,0xb0,
-0x00,0x22,0x0a,0xd0,0xb0,0x00,0x22,0x0b,0xd0,0xa8,0x00,0x60,0x0b,0xc0,0x2f,0x52,
-0x22,0x29,0x08,0x00,0x02,0x4d,0x22,0x20,0x0c,0xb0,0x69,0x6d,0x09,0x9c,0x75,0x04,
-0xbd,0x6b,0x05,0x9c,0x39,0x08,0xbe,0x6b,0x25,0x0e,0xb0,0xbf,0x6b,0x02,0x90,0x0b,
-0x16,0x10,0x90,0x0b,0x0e,0x9c,0x75,0x07,0x90,0x91,0x19,0x42,0xef,0x74,0x70,0x10,
-0xd6,0x1e,0x20,0xc7,0x00,0xf8,0x61,0x03,0x61,0xd7,0x3f,0x40,0xd8,0x00,0xf9,0x0a,
-0x00,0x12,0x2f,0x0a,0x00,0x12,0x3f,0x0a,0x00,0x10,0xe9,0x0a,0x00,0x40,0xd8,0x2f,
-0x40,0xd8,0xa9,0x0c,0x61,0x3f,0x74,0xe7,0x2f,0x84,0xe8,0x0a,0x00,0xf2,0x0a,0xff,
-0xf7,0x2f,0xff,0xf8,0x00,0xec,0x66,0x50,0x3f,0x41,0xe7,0x2f,0x51,0xd7,0x00,0xef,
-0xff,0xd0,0x3f,0x40,0xe7,0x2f,0x50,0xd7,0x32,0x00,0x4c,0xe7,0x2f,0x50,0xe7,0x0a,
-0x00,0x60,0xf7,0x1f,0x40,0xe7,0x00,0xd9,0x2f,0x58,0x60,0xf6,0x1f,0x40,0xf7,0x00,
-0xd9,0xfb,0x50,0x60,0xf5,0x1f,0xff,0xf5,0x00,0xd9,0xd0,0x03,0x42,0x50,0x03,0x66,
-0x50,0xef,0x74,0x04,0x23,0x49,0x0f,0xef,0x74,0x12,0x1f,0xb8,0x5c,0x70,0x02,0x50,
-0x62,0x05,0x10,0x60,0x08,0x19,0x70,0x80,0xf7,0x0e,0x71,0xf4,0x0f,0x60,0x6f,0x20,
-0x09,0x00,0x14,0xf3,0x09,0x00,0x11,0xf4,0x90,0x86,0xf0,0x04,0xfe,0xdf,0x71,0xfe,
-0xdf,0x60,0x5f,0x54,0x41,0xec,0x8f,0x71,0xfa,0x8f,0x60,0x5f,0xff,0xfb,0xe8,0x1b,
-0x00,0x70,0x50,0x6f,0x53,0x31,0xe8,0x0f,0x61,0x09,0x00,0xf8,0x0c,0x20,0x00,0xe9,
-0x2f,0x61,0xf5,0x2f,0x50,0x6f,0x10,0x00,0xcf,0xff,0x40,0xff,0xff,0x30,0x6f,0x10,
-0x00,0x02,0x32,0x00,0x02,0x31,0x00,0x5f,0xf6,0x04,0x01,0x4f,0x7a,0x14,0x85,0xb1,
-0x8f,0x1f,0xfe,0xb6,0x2a,0x02,0x51,0x4d,0xdd,0xde,0xee,0xee,0x46,0xae,0x04,0xfe,
-0x16,0x28,0x9f,0x10,0xb3,0x0e,0x15,0x01,0x44,0x93,0x00,0x3f,0x3e,0x0a,0xfc,0x16,
-0x13,0x30,0x3c,0x04,0xf6,0x0b,0xf2,0xd5,0x05,0xe0,0xd5,0x05,0xe0,0x03,0xf2,0xf7,
-0x06,0xf0,0xf7,0x06,0xf0,0x03,0xf2,0xf7,0x05,0xf0,0xf7,0x05,0xf0,0x03,0xf2,0xf8,
-0x08,0x00,0x10,0xf8,0x08,0x00,0xb0,0xfa,0x48,0xf0,0xfa,0x48,0xf0,0x03,0xf2,0xff,
-0xff,0xf0,0xeb,0x73,0xf5,0x00,0xf2,0xf9,0x16,0xf0,0xf9,0x16,0xf0,0x03,0xf2,0xe8,
-0x06,0xe0,0xe8,0x06,0xe0,0x08,0x00,0x7e,0xf3,0xe8,0x07,0xe0,0xe8,0x07,0xe0,0x08,
-0x00,0xe3,0xdf,0xef,0xd0,0xdf,0xef,0xd0,0x03,0xf3,0x36,0x76,0x30,0x36,0x76,0x30,
-0xa3,0x61,0x1f,0x00,0x08,0x00,0x0d,0x2b,0x02,0xf1,0x25,0x03,0x11,0x60,0xf3,0x03,
-0x14,0x30,0x35,0x33,0x24,0x0e,0x90,0x47,0x33,0x24,0x0f,0x90,0x8f,0x0d,0x24,0x0f,
-0x80,0x0a,0x00,0x24,0x2f,0x70,0xe1,0x14,0x13,0x4f,0x8e,0x95,0x02,0xec,0x2f,0x02,
-0x0a,0x00,0x24,0xbf,0xe0,0x48,0x07,0x23,0xfd,0xf5,0x8d,0x96,0x33,0x06,0xf3,0xdc,
-0x8d,0x96,0x42,0x0d,0xd0,0x5f,0x40,0x3a,0x28,0x42,0x5f,0x50,0x0d,0xc0,0x0a,0x00,
-0x10,0xec,0x21,0x37,0x22,0x08,0xe0,0x0a,0x55,0x11,0xce,0x0a,0x00,0x10,0x2f,0xd7,
-0x91,0x01,0x09,0x91,0x20,0x27,0x00,0x15,0x8c,0x0f,0x8d,0x96,0x29,0x02,0x0b,0xc1,
-0x14,0x66,0x7b,0x07,0x24,0x0c,0xc0,0xbe,0x7e,0x14,0xdb,0x4b,0x6d,0x23,0x0f,0x90,
-0xa1,0x07,0x24,0x04,0xf5,0x26,0x00,0x10,0xaf,0x13,0x00,0x80,0xe8,0x88,0x50,0x00,
-0x2f,0xff,0x40,0x00,0x93,0x2f,0x51,0x00,0x0b,0xf2,0xde,0x10,0xf4,0x05,0x40,0x06,
-0xf6,0x01,0xed,0x79,0x2f,0x00,0xe1,0x90,0x20,0x02,0xec,0x00,0x08,0x00,0xde,0x9b,
-0x20,0x02,0xda,0x13,0x00,0x11,0xb9,0xf0,0x24,0x04,0x56,0x61,0x03,0xa5,0x31,0x13,
-0x22,0xe7,0x40,0x06,0x10,0x1b,0x20,0x03,0x54,0xac,0x06,0x1d,0xa0,0xf6,0x1a,0x1f,
-0x0e,0x13,0x00,0x09,0x05,0x42,0x0a,0x00,0xa7,0x01,0x08,0x50,0x24,0x24,0x03,0x70,
-0x56,0x0e,0x14,0x08,0x5c,0x7b,0x01,0xa9,0x01,0x23,0x05,0xf2,0xda,0x94,0x03,0x0a,
+0x31,0xf7,0x44,0x49,0x11,0x00,0x00,0x88,0x01,0xf0,0x13,0x00,0x7f,0x66,0x6f,0x84,
+0xf5,0x11,0x18,0xe0,0x07,0xff,0xff,0xf8,0x4f,0x40,0x00,0x7e,0x00,0x6f,0x00,0x0e,
+0x84,0xf4,0x00,0x08,0xe0,0x06,0xf0,0x00,0xe8,0x3f,0x40,0x00,0x8e,0x11,0x00,0x24,
+0x83,0xf3,0x11,0x00,0x30,0x52,0x21,0xae,0x11,0x00,0x50,0x82,0xff,0xff,0xff,0xb0,
+0x11,0x00,0x40,0x01,0x33,0x33,0x20,0x11,0x00,0x10,0x80,0x8e,0x00,0x00,0x11,0x00,
+0x01,0x97,0x00,0x0d,0x11,0x00,0x13,0x7f,0x11,0x00,0x5b,0x03,0x90,0x00,0xd8,0x00,
+0x01,0x00,0xa1,0x01,0x00,0x92,0x00,0x02,0x70,0x06,0xe0,0x04,0xf3,0x50,0x01,0xe1,
+0x8f,0x00,0x4f,0x42,0xf4,0x00,0x07,0xf0,0x08,0xf0,0x04,0xf4,0x2f,0x40,0xb3,0x00,
+0xf1,0x0d,0x4f,0x42,0xf9,0x77,0x7b,0xf0,0x07,0xf0,0x03,0xf4,0x2f,0xfe,0xee,0xff,
+0x00,0x7f,0xbb,0xcf,0x42,0xf4,0x00,0x08,0xf0,0x06,0xfb,0xbc,0xf4,0x2f,0xa2,0x00,
+0xf1,0x05,0x10,0x3f,0x42,0xf4,0x00,0x09,0xe0,0x06,0xf1,0x03,0xf4,0x2f,0x51,0x11,
+0xad,0x00,0x6f,0x10,0x4f,0x41,0xa2,0x00,0xc1,0xf1,0x04,0xf3,0x01,0x44,0x44,0x30,
+0x00,0x6f,0x00,0x4f,0x30,0x6d,0x00,0x36,0x30,0x01,0x70,0x7a,0x00,0x20,0x0b,0xff,
+0x01,0x00,0x93,0xc0,0x00,0x00,0x47,0x76,0x66,0x66,0x66,0xcf,0x16,0x00,0x23,0x09,
+0xf0,0x09,0x00,0x1f,0x9f,0x11,0x00,0x06,0x13,0xe0,0x09,0x00,0x14,0x58,0x4a,0x00,
+0x13,0x20,0x08,0x00,0xef,0xf5,0x4e,0x10,0x00,0x06,0xd0,0x00,0x00,0xf5,0x6f,0x10,
+0x00,0x07,0xf0,0x08,0x00,0x09,0x30,0x54,0x44,0x49,0x08,0x00,0x00,0x39,0x03,0xf4,
+0x04,0xf0,0x6a,0xaa,0xf5,0x6f,0x21,0x11,0x17,0xe0,0x6b,0xbb,0xf5,0x5f,0x10,0x00,
+0x07,0xe0,0x00,0x00,0x08,0x00,0x1d,0xf6,0x08,0x00,0x30,0x32,0x11,0x18,0x08,0x00,
+0x12,0x4f,0xb9,0x00,0x93,0xf6,0x01,0x33,0x43,0x33,0x10,0x00,0x00,0xf6,0x80,0x00,
+0x0f,0x08,0x00,0x0d,0x1b,0xe4,0x7c,0x01,0xf5,0x04,0x10,0x09,0x20,0x00,0x05,0x40,
+0x00,0x06,0xf1,0x2f,0x50,0x00,0x0c,0x90,0x00,0x06,0xf2,0x2f,0x40,0x08,0x00,0x91,
+0x0d,0x90,0x00,0x05,0xf2,0x2f,0x63,0x33,0x4e,0x08,0x00,0xe0,0xff,0xff,0xff,0x90,
+0x11,0x16,0xf2,0x2f,0x51,0x11,0x1e,0x95,0xff,0xff,0x20,0x00,0x70,0x0e,0x90,0x44,
+0x48,0xf1,0x2f,0x30,0xda,0x01,0x16,0x06,0x08,0x00,0xe3,0x97,0x77,0x7f,0x70,0x00,
+0x06,0xf1,0x0b,0xdd,0xdd,0xdc,0x20,0x00,0x06,0x3a,0x01,0x04,0x08,0x00,0x00,0xfb,
+0x00,0x13,0x97,0x08,0x00,0x10,0xeb,0x0f,0x02,0x43,0xa0,0x00,0x00,0xea,0x8b,0x00,
+0x0c,0x08,0x00,0x90,0xed,0x65,0x55,0x66,0x67,0x82,0x00,0x00,0xbf,0xa4,0x01,0x1a,
+0xe5,0xb7,0x00,0xa2,0x02,0x70,0x1e,0x30,0x00,0x09,0x60,0x00,0x07,0xf1,0xa8,0x00,
+0x03,0x08,0x00,0x00,0xb8,0x00,0x30,0x73,0x44,0x4e,0x08,0x00,0x00,0xb0,0x00,0x31,
+0x91,0x77,0x7a,0xb0,0x00,0x41,0x94,0xef,0xff,0xf1,0xb0,0x00,0x06,0xa8,0x00,0xe0,
+0xf0,0x2f,0x52,0x22,0x2f,0x70,0x00,0x07,0xf0,0x0f,0xff,0xff,0xff,0x40,0x90,0x00,
+0x76,0x22,0x22,0x21,0x00,0x00,0x06,0xe0,0x96,0x02,0x81,0x56,0x66,0x66,0x66,0x7a,
+0x70,0x00,0x09,0x24,0x02,0x83,0xf0,0x00,0x00,0x11,0x11,0x11,0x10,0x0a,0xc8,0x00,
+0x50,0x0a,0xf0,0x00,0x06,0xef,0x18,0x00,0xc3,0xd0,0x00,0x09,0xf9,0x88,0x88,0x87,
+0x77,0x30,0x00,0x09,0xf1,0x1c,0x02,0x11,0xf2,0x58,0x01,0xf3,0x01,0x00,0x07,0xff,
+0xee,0xff,0xff,0xff,0xf6,0x00,0x00,0x67,0x77,0x77,0x76,0x66,0x60,0x56,0x00,0x21,
+0x40,0x1c,0xb8,0x00,0x14,0x06,0xb0,0x00,0x0e,0x08,0x00,0xd3,0xcb,0xbb,0xbf,0x90,
+0x11,0x17,0xf1,0x2f,0xba,0xa9,0x9f,0x92,0xff,0xb8,0x00,0x26,0x45,0x59,0xc0,0x00,
+0x31,0x40,0x00,0x0f,0x68,0x01,0x30,0x86,0x66,0x6f,0x68,0x01,0x55,0x0c,0xee,0xee,
+0xed,0x30,0x60,0x01,0x26,0x05,0xd0,0x24,0x01,0x80,0x57,0x77,0x77,0x77,0x88,0x40,
+0x00,0x00,0xa7,0x00,0x53,0xef,0xe0,0x00,0x00,0xf8,0xca,0x02,0x03,0x08,0x00,0x19,
+0x01,0x08,0x00,0xd0,0xe0,0x00,0x01,0xfa,0x22,0x22,0x22,0x3a,0xe0,0x00,0x00,0xdf,
+0xff,0x3a,0x03,0x74,0x00,0x00,0x02,0x22,0x22,0x22,0x11,0x0d,0x01,0x50,0x50,0x1e,
+0x40,0x00,0x08,0x70,0x01,0x70,0x1f,0x50,0x00,0x0c,0xa0,0x00,0x07,0x30,0x02,0x71,
+0x0d,0xa0,0x00,0x07,0xf2,0x2f,0x50,0x80,0x01,0x02,0x20,0x02,0x70,0x66,0x6a,0xf2,
+0x2f,0x96,0x65,0x5e,0xb8,0x00,0x11,0x1f,0xb0,0x00,0x11,0x07,0x08,0x00,0x17,0x80,
+0x08,0x00,0x00,0x70,0x01,0x86,0x50,0x00,0x07,0xf0,0x02,0x55,0x55,0x54,0x18,0x02,
+0x51,0x00,0x30,0x00,0x00,0x51,0x68,0x00,0x33,0x00,0x00,0xf7,0x30,0x02,0x13,0xf7,
+0x28,0x02,0x84,0xf9,0x33,0x32,0x33,0x39,0xf0,0x00,0x01,0x88,0x01,0x62,0xf9,0x44,
+0x44,0x44,0x38,0xf0,0xd3,0x02,0x17,0x06,0x08,0x00,0x01,0x20,0x00,0x84,0xe0,0x00,
+0x00,0x35,0x55,0x55,0x55,0x55,0x90,0x03,0x11,0x05,0x8d,0x01,0x41,0x02,0xf1,0x05,
+0xf1,0x20,0x05,0xd0,0x3f,0x30,0x6f,0x14,0xf3,0x00,0x06,0xf0,0x03,0xf3,0x06,0xf1,
+0x4f,0x16,0x04,0x0f,0x11,0x00,0x02,0x00,0x20,0x05,0x00,0x11,0x00,0x00,0x64,0x03,
+0xe0,0xbb,0xcf,0x40,0x6f,0x14,0xf5,0x11,0x17,0xfa,0xab,0xf4,0x06,0xf1,0x4f,0x8f,
+0x04,0xd0,0x2f,0x40,0x6f,0x14,0xf4,0x00,0x07,0xe0,0x02,0xf4,0x06,0xf1,0x3f,0x31,
+0x05,0x40,0x2f,0x30,0x6f,0x13,0x20,0x05,0xd0,0x02,0xf3,0x05,0xf1,0x3f,0x52,0x21,
+0x9e,0x00,0x2f,0x30,0x5f,0x12,0x9f,0x03,0x41,0x03,0xf3,0x05,0xf1,0x20,0x05,0x41,
+0x3f,0x30,0x5f,0x10,0xfe,0x04,0x22,0xf3,0x05,0x26,0x02,0x22,0x3f,0x20,0x11,0x00,
+0x30,0x04,0xf2,0x05,0x2f,0x02,0x00,0xc5,0x06,0x02,0xe2,0x06,0x4e,0x02,0xa0,0x03,
+0xf1,0x20,0x05,0x61,0xa2,0x00,0x03,0x70,0x01,0xf4,0x20,0x05,0x60,0x8e,0x00,0x1f,
+0x60,0x4f,0x42,0xa0,0x05,0x32,0x01,0xf6,0x04,0xfe,0x04,0xf1,0x04,0x0f,0x60,0x4f,
+0x42,0xfd,0xcc,0xce,0xe3,0x34,0xf7,0x03,0xf4,0x2f,0xb9,0x99,0xdf,0xff,0xff,0x70,
+0x0f,0x05,0x40,0xe3,0x23,0xf7,0x03,0x22,0x00,0x31,0xad,0x00,0x0f,0x11,0x00,0xf3,
+0x08,0x0a,0xd0,0x00,0xf7,0x04,0xf4,0x1f,0xff,0xff,0xfb,0x00,0x0f,0x70,0x4f,0x30,
+0x35,0x55,0x55,0x10,0x00,0xf5,0x04,0xf3,0x66,0x00,0x13,0x03,0xf3,0x02,0x51,0x64,
+0x20,0x00,0x00,0x7f,0x4c,0x01,0x01,0xc7,0x02,0x33,0x00,0x00,0x08,0xa4,0x01,0x00,
+0xd9,0x06,0xf4,0x04,0x01,0x77,0x77,0x78,0x88,0x8c,0xf0,0x00,0x00,0x8f,0xff,0xff,
+0xff,0xee,0xea,0x00,0x00,0x08,0xf1,0x1d,0x00,0x13,0x10,0xe2,0x03,0xe3,0xff,0xee,
+0xee,0xff,0xff,0xf8,0x00,0x00,0x06,0x88,0x87,0x77,0x77,0x76,0x16,0x00,0x31,0x01,
+0x20,0x08,0x68,0x04,0x22,0x09,0xf0,0x68,0x04,0x22,0x09,0xf0,0x68,0x04,0x20,0x08,
+0xf0,0xf8,0x02,0x41,0x92,0xef,0xff,0xf0,0x68,0x04,0x30,0x66,0x6b,0xf0,0x48,0x02,
+0x00,0x18,0x00,0x00,0xb8,0x03,0x03,0x20,0x00,0x11,0x0e,0x08,0x00,0x00,0xb8,0x03,
+0x30,0x88,0x8c,0xe0,0x08,0x00,0xf3,0x04,0x82,0xde,0xef,0xe0,0x2f,0x86,0x65,0x5f,
+0x70,0x00,0x09,0xe0,0x0c,0xff,0xff,0xed,0x30,0x00,0x09,0xf8,0x02,0x08,0x08,0x00,
+0x13,0x97,0x08,0x00,0x10,0xeb,0x68,0x01,0x1f,0x60,0x68,0x04,0x2b,0x18,0x08,0xb0,
+0x00,0x51,0x0c,0x90,0x9a,0xad,0xf0,0x68,0x04,0x23,0xbc,0xce,0xb0,0x00,0x13,0x07,
+0xb0,0x00,0x12,0x07,0xb0,0x00,0x22,0x23,0x39,0xb0,0x00,0x22,0xff,0xff,0x68,0x04,
+0x2b,0x23,0x39,0x68,0x04,0x24,0x07,0xf0,0x58,0x03,0x0f,0x68,0x04,0x3f,0x13,0x20,
+0x4a,0x09,0x70,0x00,0x2f,0x40,0x00,0x00,0x01,0xf5,0xdb,0x01,0x20,0xf5,0x00,0xbe,
+0x08,0x00,0x78,0x02,0x13,0x50,0x0c,0x06,0x61,0x03,0xf6,0x22,0x22,0x22,0x3f,0x13,
+0x00,0x00,0x5f,0x00,0x02,0x13,0x00,0x40,0x33,0x33,0x33,0x4f,0x13,0x00,0x00,0x2b,
+0x07,0x10,0x02,0x34,0x00,0x01,0x1d,0x02,0x20,0x2f,0x50,0x26,0x00,0x04,0x13,0x00,
+0x11,0x03,0xa7,0x00,0x10,0x30,0x0a,0x00,0x55,0x66,0x66,0x66,0x66,0x40,0x57,0x09,
+0x0b,0x1a,0x07,0x2a,0x00,0x9e,0x13,0x00,0xb3,0x6e,0xee,0xee,0xee,0xff,0xee,0xee,
+0xee,0xee,0x03,0x88,0x01,0x00,0x40,0x60,0x00,0x00,0x31,0xab,0x00,0x00,0xb0,0x00,
+0x10,0xe8,0xec,0x00,0x22,0xb0,0x00,0x9d,0x04,0x01,0x09,0x00,0x50,0xfb,0x66,0x66,
+0x66,0x6c,0x09,0x00,0x04,0xa3,0x07,0x01,0x10,0x04,0x14,0x0a,0x09,0x00,0x10,0x0b,
+0x1b,0x00,0x01,0x1a,0x01,0x00,0x2b,0x09,0x64,0x35,0x66,0xbf,0x77,0x66,0x10,0xa5,
+0x02,0x16,0x00,0x09,0x00,0xb2,0x17,0x77,0x77,0x77,0xcf,0x77,0x77,0x77,0x76,0x5f,
+0xff,0x01,0x00,0x2e,0xfc,0x00,0x01,0x00,0x20,0x07,0xee,0x9c,0x00,0x31,0xe1,0x00,
+0x00,0x9b,0x00,0x14,0x7b,0x11,0x03,0x1f,0x06,0x09,0x00,0x08,0x1c,0xf2,0x09,0x00,
+0x23,0x01,0x50,0x05,0x08,0x01,0xcf,0x00,0x1d,0xf7,0xcf,0x00,0x55,0xf9,0x33,0x33,
+0x33,0x3b,0xcf,0x00,0x01,0x1b,0x00,0x58,0x22,0x22,0x22,0x2b,0xb0,0xcf,0x00,0x00,
+0x12,0x00,0x15,0x1c,0xd8,0x00,0x10,0x90,0x57,0x01,0x42,0x34,0xbf,0x44,0x33,0x61,
+0x00,0x37,0xaf,0x00,0x00,0x09,0x00,0x05,0xcf,0x00,0x21,0x27,0x77,0x01,0x00,0x27,
+0x78,0x85,0xd0,0x00,0x14,0x51,0x94,0x00,0x1f,0xf7,0x09,0x00,0x06,0x15,0x02,0x09,
+0x00,0x10,0xfb,0xc6,0x01,0x23,0x75,0x00,0xf7,0x05,0x18,0xfd,0x18,0x01,0x21,0xa4,
+0x00,0xf9,0x0b,0x02,0xc6,0x00,0x20,0x0e,0x70,0xc6,0x00,0x54,0x11,0x11,0x11,0x1e,
+0x70,0xc6,0x00,0x00,0x09,0x00,0x63,0xfa,0x44,0x44,0x44,0x4f,0x70,0xc6,0x00,0x10,
+0x0f,0x09,0x00,0x50,0xfc,0x98,0x88,0x88,0x8f,0x09,0x00,0x30,0xac,0xdd,0xef,0x03,
+0x08,0x0e,0x95,0x01,0xa2,0x6f,0xee,0xdd,0xdd,0xef,0xdd,0xdd,0xee,0xfb,0x26,0xbd,
+0x00,0x27,0x66,0x63,0xec,0x04,0x50,0x33,0x33,0x33,0x34,0x42,0x15,0x0b,0x12,0xff,
+0xf7,0x02,0x74,0x00,0x01,0x34,0x43,0x33,0x32,0x2b,0x57,0x02,0xc1,0x0a,0xe0,0x00,
+0x00,0x01,0x66,0x77,0x77,0x77,0x7d,0xe0,0x00,0x33,0x03,0x45,0xee,0xee,0x90,0x00,
+0x14,0x03,0x02,0x09,0x00,0x00,0xb6,0x04,0x11,0x08,0x87,0x04,0x00,0x95,0x00,0x77,
+0x68,0x88,0x88,0x87,0x76,0x51,0x00,0x6d,0x02,0x01,0x95,0x01,0x1f,0xa0,0x6d,0x02,
+0x07,0x09,0x95,0x01,0x05,0x09,0x00,0x50,0xfb,0x77,0x77,0x66,0x6d,0x36,0x00,0x6d,
+0xae,0xff,0xff,0xff,0xfe,0x60,0xd8,0x00,0x00,0x31,0x07,0x83,0x33,0x33,0x9f,0x33,
+0x33,0x33,0x32,0x6f,0x9e,0x01,0xa0,0xfe,0x04,0x44,0x43,0x33,0x33,0x33,0x33,0x44,
+0x42,0x1f,0x00,0x14,0x19,0x94,0x06,0x24,0x5f,0x50,0xcb,0x01,0x13,0x20,0xc5,0x0b,
+0x22,0xff,0xc0,0x09,0x00,0x32,0x2e,0xe7,0xfc,0x28,0x06,0x41,0xef,0x30,0x5f,0xe3,
+0x37,0x0b,0xf1,0x02,0xe2,0x00,0x03,0xdf,0x60,0x00,0x00,0x0d,0xf9,0x10,0x00,0x00,
+0x0a,0xf8,0x00,0x00,0x07,0x33,0x00,0x54,0x34,0x00,0x00,0x00,0xb4,0x9e,0x01,0x23,
+0x1f,0x70,0x41,0x03,0x01,0xde,0x01,0x01,0x67,0x0b,0x51,0x1f,0x82,0x22,0x22,0x22,
+0x13,0x00,0x01,0x88,0x00,0x01,0x13,0x00,0x50,0x83,0x33,0x33,0x33,0xf8,0x13,0x00,
+0x15,0xf6,0x26,0x00,0x13,0x60,0x04,0x01,0x60,0x01,0xfa,0x77,0x66,0x66,0x6f,0x47,
+0x00,0x10,0x0c,0x7b,0x02,0x01,0x7a,0x00,0x0d,0x01,0x00,0x20,0x15,0x44,0x01,0x00,
+0x53,0x55,0x56,0x66,0x08,0xff,0x01,0x00,0x86,0xe0,0x01,0x12,0x22,0x22,0x8f,0x11,
+0x10,0xdb,0x09,0x0b,0xf8,0x0c,0x0f,0x13,0x00,0x0a,0x16,0x7e,0x84,0x0a,0x0b,0x6a,
+0x00,0x10,0xd7,0xc9,0x01,0x18,0x90,0xa0,0x01,0x05,0x09,0x00,0x05,0xa0,0x01,0x05,
+0xb2,0x01,0x05,0x6b,0x03,0x05,0xa9,0x01,0x14,0xff,0x3e,0x03,0x5c,0x35,0x66,0x67,
+0x66,0x66,0x5d,0x00,0x08,0x3e,0x03,0xa1,0xfd,0x16,0x66,0x77,0x77,0x7d,0xe7,0x77,
+0x77,0x74,0x0d,0x0c,0x02,0x85,0x01,0x14,0x42,0x09,0x00,0x2e,0xf9,0x00,0x09,0x00,
+0x23,0x03,0x20,0x09,0x00,0x03,0x01,0x00,0x10,0xfc,0x3e,0x03,0x51,0x76,0x00,0x00,
+0x00,0xcf,0xf0,0x01,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,
+0x0a,0x00,0x00,0x94,0x00,0x00,0x00,0x09,0x40,0x00,0x00,0x00,0xf7,0x00,0x00,0x00,
+0x0e,0x80,0x00,0x00,0x00,0xf8,0x11,0x11,0x11,0x1e,0x09,0x00,0x10,0xff,0x01,0x00,
+0x00,0x09,0x00,0x50,0xf9,0x44,0x44,0x44,0x4e,0x09,0x00,0x14,0xf6,0x24,0x00,0xf5,
+0x01,0xfa,0x77,0x66,0x66,0x6f,0x70,0x00,0x00,0x00,0xbe,0xff,0xff,0xff,0xfe,0x30,
+0x00,0x01,0x00,0x21,0x01,0x10,0x07,0x00,0x42,0x11,0x10,0x6f,0xff,0x01,0x00,0xa0,
+0xfb,0x03,0x44,0x55,0x55,0xbf,0x44,0x44,0x44,0x31,0x18,0x00,0x12,0x9f,0x25,0x00,
+0x91,0x33,0x33,0xaf,0x33,0x32,0x00,0x00,0x00,0x0a,0x23,0x00,0xa3,0xd0,0x00,0x00,
+0x00,0x34,0x43,0x33,0x32,0x2b,0xe0,0x45,0x00,0xf3,0x09,0x0a,0xe0,0x00,0x00,0x02,
+0x66,0x77,0x77,0x77,0x7d,0xe0,0x00,0x00,0x09,0xff,0xff,0xff,0xee,0xee,0x90,0x00,
+0x00,0x09,0xf1,0x1f,0x00,0x02,0x09,0x00,0xf0,0x0d,0x10,0x00,0x00,0x08,0xff,0xee,
+0xee,0xff,0xff,0xf8,0x00,0x00,0x00,0x68,0x88,0x88,0x87,0x76,0x51,0x00,0x00,0x00,
+0x95,0x00,0x00,0x00,0x04,0x90,0xb4,0x00,0x50,0x00,0x00,0x00,0x07,0xe0,0xab,0x00,
+0x54,0x11,0x11,0x11,0x17,0xe0,0xcf,0x00,0x10,0xf0,0x12,0x00,0x50,0x44,0x44,0x44,
+0x49,0xf0,0xea,0x00,0x00,0x24,0x00,0x00,0x09,0x00,0x63,0xfb,0x77,0x76,0x66,0x6b,
+0xe0,0xcf,0x00,0x3e,0xff,0x90,0x00,0xcf,0x00,0x13,0x7f,0xcf,0x00,0x73,0xfd,0x04,
+0x44,0x55,0x55,0xaf,0x54,0xcf,0x00,0x14,0x7f,0x28,0x00,0x20,0x8f,0x10,0x2a,0x00,
+0x11,0x04,0x23,0x00,0xd4,0xf2,0x00,0x00,0x06,0xf7,0x66,0x66,0x66,0x65,0x40,0x00,
+0x00,0x06,0xb4,0x00,0xf3,0x01,0x07,0xf8,0x88,0x88,0x88,0x88,0x70,0x00,0x00,0x07,
+0xff,0xee,0xee,0xee,0xee,0xd0,0x79,0x00,0x00,0x01,0x00,0x24,0x08,0xf0,0x24,0x00,
+0x01,0x3f,0x00,0xe0,0xf6,0x00,0x00,0x01,0x67,0x77,0x88,0x77,0x76,0x61,0x00,0x00,
+0x00,0xa4,0x17,0x00,0x00,0x68,0x01,0x10,0x0f,0x76,0x01,0x23,0xbc,0x00,0xb5,0x00,
+0x20,0x0a,0xc0,0x13,0x00,0x64,0x92,0x22,0x22,0x22,0xbc,0x00,0xda,0x00,0x01,0x13,
+0x00,0x63,0x93,0x33,0x33,0x33,0xcc,0x00,0xce,0x01,0x11,0x0b,0x13,0x00,0x14,0x70,
+0x39,0x00,0x60,0xfb,0x77,0x66,0x66,0x6d,0xb0,0x18,0x00,0x6f,0xef,0xff,0xff,0xff,
+0xe6,0x00,0x01,0x00,0x01,0x20,0x15,0x44,0x01,0x00,0x53,0x55,0x56,0x66,0x06,0xff,
+0x01,0x00,0x81,0xe0,0x01,0x12,0x2d,0xb2,0x11,0x12,0xf7,0x1f,0x00,0x50,0xdb,0x00,
+0x00,0x1f,0x70,0x09,0x00,0x4f,0x0d,0xb0,0x00,0x01,0x13,0x00,0x06,0x51,0xda,0x00,
+0x00,0x1f,0x60,0x13,0x00,0x45,0x90,0x00,0x01,0xf5,0x4b,0x01,0x01,0x06,0x00,0x50,
+0x20,0x00,0x00,0x00,0x02,0x09,0x00,0x60,0x3f,0x30,0x00,0x00,0x02,0xf4,0xae,0x01,
+0x00,0x05,0x00,0xb0,0x2f,0x50,0x00,0x00,0x00,0x4f,0x40,0x00,0x00,0x02,0xf5,0x13,
+0x00,0x60,0xf6,0x22,0x22,0x22,0x4f,0x60,0x13,0x00,0x03,0x12,0x01,0x71,0x00,0x04,
+0xf5,0x33,0x33,0x33,0x5f,0x26,0x00,0x41,0x20,0x00,0x00,0x03,0x26,0x00,0x10,0xf2,
+0x47,0x00,0x10,0x40,0x13,0x00,0x40,0x30,0x00,0x00,0x03,0x47,0x00,0x11,0x03,0xb3,
+0x00,0x10,0x30,0x0a,0x00,0x6f,0x66,0x66,0x66,0x66,0x40,0x00,0x01,0x00,0x0b,0xa4,
+0x44,0x44,0x33,0x33,0x33,0x33,0x44,0x44,0x30,0x8f,0xee,0x00,0x23,0x01,0x33,0x01,
+0x00,0x40,0x10,0x00,0x00,0xa3,0x69,0x01,0x13,0x30,0x4c,0x01,0x24,0x0f,0x70,0x1a,
+0x03,0x14,0x70,0x71,0x01,0x01,0x12,0x00,0x94,0x44,0x44,0x44,0x4f,0x70,0x00,0x00,
+0x01,0xf6,0x24,0x00,0x01,0x1a,0x03,0x00,0xbb,0x00,0x1b,0xce,0x1a,0x03,0x05,0x01,
+0x00,0x40,0x7f,0xff,0xff,0xee,0xb8,0x02,0xa6,0xf9,0x15,0x66,0x66,0x77,0x76,0x66,
+0x66,0x66,0x52,0x1c,0x00,0x60,0x02,0x33,0x33,0x33,0x34,0x42,0x66,0x03,0x04,0xd4,
+0x01,0x10,0x01,0x1a,0x03,0x23,0x2c,0xd0,0x20,0x00,0x24,0x0b,0xd0,0x1a,0x03,0x14,
+0xd0,0x1a,0x03,0x54,0x80,0x00,0x00,0x0a,0xf0,0x39,0x03,0x04,0x1a,0x03,0x14,0x09,
+0x1a,0x03,0x15,0x01,0x1a,0x03,0x13,0x00,0x1b,0x00,0x00,0x05,0x00,0xff,0x03,0x06,
+0xf0,0x1e,0x30,0x00,0x02,0xf2,0x00,0x06,0xf0,0x2f,0x50,0x00,0x02,0xf3,0x00,0x06,
+0xf1,0x08,0x00,0x01,0x10,0xf4,0x08,0x00,0x31,0x94,0x44,0x46,0x10,0x00,0x31,0xff,
+0xff,0xff,0x08,0x00,0x31,0x61,0x11,0x13,0x08,0x00,0x39,0x60,0x00,0x03,0x08,0x00,
+0x11,0x50,0x08,0x00,0x51,0xf0,0x1f,0x50,0x00,0x04,0x08,0x00,0x30,0x72,0x11,0x15,
+0x60,0x00,0x91,0x0f,0xff,0xff,0xff,0xf1,0x00,0x06,0xf0,0x01,0x54,0x01,0x13,0x06,
+0xa9,0x00,0x0d,0x08,0x00,0x1a,0xf1,0x08,0x00,0x24,0x03,0xb0,0xb0,0x00,0xa0,0x09,
+0x20,0x00,0x02,0x70,0x00,0x09,0xe0,0x2f,0x50,0x2d,0x00,0x40,0x09,0xf0,0x2f,0x40,
+0x39,0x03,0x16,0x08,0x08,0x00,0x31,0x63,0x33,0x49,0x08,0x00,0x00,0xdc,0x03,0x00,
+0x08,0x00,0x33,0x51,0x11,0x18,0x20,0x00,0x11,0x08,0x08,0x00,0x75,0x30,0x00,0x08,
+0xe0,0x00,0x08,0xe0,0x08,0x00,0xe3,0x97,0x77,0x7c,0xd0,0x00,0x09,0xe0,0x0c,0xdd,
+0xdd,0xdd,0x80,0x00,0x09,0x72,0x04,0x26,0x09,0xd0,0x08,0x00,0x12,0xb5,0x08,0x00,
+0x10,0x01,0x68,0x03,0x22,0x05,0x80,0x08,0x00,0x2e,0x00,0x00,0x08,0x00,0x90,0xfb,
+0x65,0x55,0x66,0x67,0x81,0x00,0x00,0xdf,0xa9,0x01,0x1a,0xe3,0xe3,0x01,0xa2,0x04,
+0x50,0x1e,0x30,0x00,0x04,0xc0,0x00,0x0b,0xd0,0xa8,0x00,0x07,0x08,0x00,0x10,0x73,
+0x7b,0x04,0x22,0x0a,0xd0,0xb0,0x00,0x22,0x0a,0xd0,0xb0,0x00,0x22,0x0a,0xd0,0xb0,
+0x00,0x22,0x0b,0xd0,0xa8,0x00,0x60,0x0b,0xc0,0x2f,0x52,0x22,0x29,0x08,0x00,0x00,
+0x40,0x01,0xc6,0xa0,0x00,0x0c,0xb0,0x00,0x22,0x22,0x22,0x00,0x00,0x0b,0xa0,0x9a,
+0x04,0x61,0x56,0x66,0x66,0x66,0x7a,0x40,0x05,0x02,0x00,0x23,0x00,0x63,0x00,0x11,
+0x11,0x11,0x10,0x0e,0x38,0x01,0x52,0x0e,0xb0,0x00,0x06,0xef,0xcb,0x04,0x75,0x09,
+0xf9,0x88,0x88,0x87,0x77,0x10,0x3e,0x05,0x03,0x08,0x00,0x00,0x3c,0x05,0x02,0xac,
+0x04,0x45,0x67,0x77,0x77,0x76,0x2a,0x03,0x14,0x42,0x60,0x00,0x00,0x67,0x04,0x80,
+0x2e,0x10,0xd6,0x1e,0x20,0xc7,0x00,0xf8,0x61,0x03,0x61,0xd7,0x3f,0x40,0xd8,0x00,
+0xf9,0x0a,0x00,0x12,0x2f,0x0a,0x00,0x12,0x3f,0x0a,0x00,0x10,0xe9,0x0a,0x00,0x10,
+0xd8,0x0a,0x00,0x91,0xea,0x00,0x00,0x3f,0x74,0xe7,0x2f,0x84,0xe8,0x0a,0x00,0xf2,
+0x0a,0xff,0xf7,0x2f,0xff,0xf8,0x00,0xec,0x66,0x50,0x3f,0x41,0xe7,0x2f,0x51,0xd7,
+0x00,0xef,0xff,0xd0,0x3f,0x40,0xe7,0x2f,0x50,0xd7,0x32,0x00,0x4c,0xe7,0x2f,0x50,
+0xe7,0x0a,0x00,0xe0,0xf7,0x1f,0x40,0xe7,0x00,0xd9,0x00,0x00,0x2f,0x30,0xf6,0x1f,
+0x40,0xf7,0x0a,0x00,0x80,0x1f,0xff,0xf5,0x1f,0xff,0xf5,0x00,0xd9,0xd0,0x03,0x65,
+0x50,0x03,0x66,0x50,0x00,0xd9,0xa0,0x00,0x06,0x0a,0x00,0x1f,0xda,0x0a,0x00,0x0a,
+0x1e,0xb8,0x81,0x03,0xf0,0x05,0x27,0x00,0x00,0x62,0x05,0x10,0x60,0x08,0x20,0x6f,
+0x10,0x00,0xf7,0x0e,0x71,0xf4,0x0f,0x60,0x6f,0x20,0x09,0x00,0x13,0xf3,0x09,0x00,
+0x00,0x12,0x00,0xf0,0x07,0x5f,0x20,0x00,0xfe,0xdf,0x71,0xfe,0xdf,0x60,0x5f,0x54,
+0x41,0xec,0x8f,0x71,0xfa,0x8f,0x60,0x5f,0xff,0xfb,0xe8,0x1b,0x00,0x70,0x50,0x6f,
+0x53,0x31,0xe8,0x0f,0x61,0x09,0x00,0xf8,0x0c,0x20,0x00,0xe9,0x2f,0x61,0xf5,0x2f,
+0x50,0x6f,0x10,0x00,0xcf,0xff,0x40,0xff,0xff,0x30,0x6f,0x10,0x00,0x02,0x32,0x00,
+0x02,0x31,0x00,0x5f,0xf6,0x04,0x61,0x16,0x66,0x67,0x77,0x77,0x85,0xfa,0x03,0x00,
+0x14,0x04,0x00,0x16,0x00,0x33,0x11,0x11,0x10,0x0c,0x07,0x03,0x15,0x07,0x60,0x4d,
+0xdd,0xde,0xee,0xee,0xfe,0x0d,0x00,0x50,0xba,0xaa,0xaa,0xaa,0x94,0x09,0x00,0x15,
+0x10,0x5c,0x06,0x03,0x48,0x00,0x32,0x7f,0xfe,0xef,0x77,0x04,0x74,0x06,0x77,0x77,
+0x77,0x66,0x66,0x10,0x40,0x00,0x13,0x30,0x3c,0x04,0xf6,0x0b,0xf2,0xd5,0x05,0xe0,
+0xd5,0x05,0xe0,0x03,0xf2,0xf7,0x06,0xf0,0xf7,0x06,0xf0,0x03,0xf2,0xf7,0x05,0xf0,
+0xf7,0x05,0xf0,0x03,0xf2,0xf8,0x08,0x00,0x10,0xf8,0x08,0x00,0xf5,0x0f,0xfa,0x48,
+0xf0,0xfa,0x48,0xf0,0x03,0xf2,0xff,0xff,0xf0,0xff,0xff,0xf0,0x03,0xf2,0xf9,0x16,
+0xf0,0xf9,0x16,0xf0,0x03,0xf2,0xe8,0x06,0xe0,0xe8,0x06,0xe0,0x08,0x00,0x7e,0xf3,
+0xe8,0x07,0xe0,0xe8,0x07,0xe0,0x08,0x00,0xf3,0x01,0xdf,0xef,0xd0,0xdf,0xef,0xd0,
+0x03,0xf3,0x36,0x76,0x30,0x36,0x76,0x30,0x03,0xf3,0xb5,0x03,0x0f,0x08,0x00,0x0c,
+0x2b,0x02,0xf1,0x25,0x03,0x11,0x60,0xf3,0x03,0x51,0x30,0x00,0x00,0x0a,0xd0,0xb5,
+0x02,0x11,0x90,0xfa,0x07,0x00,0x49,0x05,0x00,0xee,0x07,0x02,0x0a,0x00,0x14,0x80,
+0x0a,0x00,0x51,0x2f,0x70,0x00,0x00,0x09,0x2f,0x04,0x24,0x4f,0x50,0x0a,0x00,0x24,
+0x7f,0x80,0x0a,0x00,0x24,0xbf,0xe0,0x48,0x07,0x20,0xfd,0xf5,0xdc,0x02,0xf0,0x04,
+0xff,0xe0,0x00,0x06,0xf3,0xdc,0x00,0x00,0x08,0xf7,0x77,0x50,0x00,0x0d,0xd0,0x5f,
+0x40,0x00,0x08,0x46,0x00,0x42,0x5f,0x50,0x0d,0xc0,0x0a,0x00,0x41,0xec,0x00,0x05,
+0xf5,0x0a,0x00,0x51,0x08,0xf2,0x00,0x00,0xce,0x0a,0x00,0x20,0x2f,0x60,0x66,0x00,
+0x00,0x0a,0x00,0x10,0x27,0xb6,0x00,0x15,0x20,0x98,0x07,0x1f,0x00,0x0a,0x00,0x15,
+0x25,0x05,0xc0,0xf7,0x01,0x10,0x20,0x06,0x00,0x14,0x66,0x7b,0x07,0x22,0x0c,0xc0,
+0x04,0x00,0x01,0x2f,0x07,0x24,0x00,0xcc,0xe4,0x00,0x21,0x0b,0xc0,0xda,0x06,0x04,
+0x26,0x00,0x10,0xaf,0x13,0x00,0xf1,0x02,0xe8,0x88,0x50,0x00,0x2f,0xff,0x40,0x00,
+0x00,0xbf,0xff,0xfa,0x00,0x0b,0xf2,0xde,0x10,0xf4,0x05,0xe0,0x06,0xf6,0x01,0xed,
+0x00,0x00,0xac,0x00,0x00,0x04,0xfa,0x00,0x02,0xec,0x00,0x08,0x60,0x04,0xfb,0x00,
+0x00,0x02,0xda,0x13,0x00,0x10,0xb9,0x70,0x00,0x25,0x30,0x0a,0x7c,0x00,0x10,0x34,
+0x05,0x00,0x21,0x22,0x22,0x31,0x04,0x00,0x47,0x00,0x12,0xff,0x23,0x09,0x20,0x03,
+0x54,0xac,0x06,0x05,0x41,0x04,0x14,0xea,0x09,0x00,0x1f,0x0e,0x13,0x00,0x09,0x14,
+0xf9,0x09,0x00,0x25,0x06,0x30,0xdb,0x00,0x11,0x50,0xd5,0x01,0x00,0x87,0x02,0x14,
+0xf2,0xff,0x00,0x21,0x05,0xf2,0x5b,0x04,0x14,0xe0,0x0a,0x00,0x24,0x0c,0xd0,0x0a,
 0x00,0x24,0x1f,0x90,0x0a,0x00,0x24,0x7f,0x80,0x0a,0x00,0x23,0xdf,0xf3,0x0a,0x00,
-0x60,0x06,0xf7,0xdd,0x10,0x00,0x05,0x21,0x06,0x40,0x1f,0xc0,0x2e,0xb0,0x56,0x3b,
-0x81,0x50,0x00,0xce,0x20,0x03,0xfa,0x00,0x05,0xd3,0x91,0x00,0x46,0x98,0x00,0x89,
-0x12,0x10,0x7e,0x75,0xbc,0x01,0x2c,0x2c,0x15,0x11,0xbf,0x37,0x02,0xcb,0x06,0x02,
-0x0a,0x00,0x14,0xf8,0x0a,0x00,0x01,0x9c,0x05,0x29,0x02,0x80,0x46,0x3e,0x0e,0x0a,
-0x00,0x07,0xfa,0x34,0x03,0xbe,0x05,0x1e,0xf4,0xf8,0x38,0x02,0x55,0x03,0x24,0x04,
-0x80,0xa8,0x09,0x15,0x09,0x61,0x02,0x24,0x0a,0xd0,0x0a,0x00,0x24,0x0d,0xa0,0x1e,
-0x00,0x15,0x2f,0xb6,0x75,0x21,0x9f,0xd0,0xec,0x09,0x42,0x60,0x00,0x01,0xfd,0x58,
-0x94,0x62,0xc0,0x00,0x0b,0xf2,0x8f,0x60,0xd0,0x1f,0x42,0x6f,0x60,0x09,0xf4,0x49,
-0x3c,0x10,0xfa,0x81,0x90,0x22,0x06,0xf0,0x08,0x1f,0x20,0x09,0xe0,0x0a,0x00,0x17,
-0x67,0x5e,0x01,0x15,0x30,0xac,0x17,0x23,0xf6,0x00,0x1f,0x59,0x04,0x15,0x47,0x12,
-0x00,0x70,0x34,0x25,0x26,0xf1,0x37,0x0d,0x02,0xfa,0x00,0x00,0x6e,0x14,0x0b,0x28,
-0x00,0x04,0x72,0x14,0x07,0xfb,0x0a,0x20,0x00,0x35,0x99,0x0a,0x1a,0x20,0xdf,0x0a,
-0x14,0x44,0x07,0x11,0x24,0x0b,0xc0,0x6e,0x03,0x14,0xcb,0x13,0x00,0x05,0x8b,0x03,
-0x24,0x03,0xf5,0x13,0x00,0x10,0xaf,0x8a,0x03,0x00,0x58,0x03,0x00,0x0a,0x9d,0x00,
-0x04,0x4e,0x42,0x00,0x0a,0xf2,0xde,0x5e,0x8e,0x40,0x06,0xf7,0x02,0xec,0x26,0x00,
-0x00,0x9e,0x95,0x11,0x03,0x6d,0x99,0x00,0x83,0x95,0x20,0x02,0xe9,0x13,0x00,0x11,
-0xba,0xe6,0x21,0x06,0x79,0x11,0x12,0x7c,0x05,0x04,0x24,0x78,0x64,0x13,0x28,0x39,
-0xef,0xff,0x70,0xc8,0x54,0x33,0x0e,0xd0,0x00,0xd0,0x8f,0x05,0x23,0x6b,0x05,0x71,
-0x1a,0x01,0xca,0x54,0x21,0x5f,0xa0,0x8d,0xc2,0x43,0xc8,0x79,0xcf,0xc1,0x38,0x89,
-0x2a,0xb9,0x50,0xb5,0x45,0x10,0x04,0xfe,0x2e,0x10,0x04,0x50,0x9b,0x00,0x98,0x2c,
-0x00,0x09,0x00,0x00,0xb0,0x2c,0x00,0x12,0x00,0x00,0x7d,0x1b,0x32,0x0f,0x70,0x04,
-0x5f,0x97,0x02,0x09,0x00,0x14,0x8e,0x09,0x00,0x13,0xbe,0x09,0x00,0x00,0xc2,0xaf,
-0x41,0x0f,0xa5,0x58,0xf2,0x38,0x40,0x10,0x0f,0x2d,0x07,0x32,0x09,0xe8,0xf1,0x1b,
-0x00,0x32,0x0f,0x91,0xf8,0x09,0x00,0x31,0x7f,0x10,0x8e,0x51,0x00,0x50,0x01,0xf9,
-0x00,0x1f,0x70,0x63,0x00,0x50,0x09,0xe1,0x00,0x08,0xe1,0x09,0x00,0x50,0x4f,0x40,
-0x00,0x01,0xe8,0x09,0x00,0x10,0x67,0x25,0x3a,0x23,0x0e,0x80,0xf1,0x48,0x0f,0x09,
-0x00,0x11,0x4d,0x08,0x40,0x03,0xf1,0x76,0x0e,0x00,0x30,0x5a,0x00,0x3e,0x6e,0x21,
-0x04,0xf3,0x60,0x03,0x00,0x6a,0x4c,0x01,0x96,0x94,0x20,0x07,0xf1,0x09,0x00,0x40,
-0x0f,0xb0,0x00,0x06,0x09,0x00,0x00,0x50,0x7b,0x00,0x5f,0x1a,0x01,0x70,0x03,0x90,
-0x06,0xfc,0xbc,0xf4,0x00,0x00,0xef,0xf2,0x00,0x82,0x1a,0x42,0x00,0x06,0xf6,0xdc,
-0x1b,0x00,0x41,0x1f,0xc0,0x3f,0x90,0x09,0x00,0x40,0xce,0x10,0x06,0xf7,0x36,0x00,
-0x00,0x87,0x9b,0x60,0x8f,0x26,0xf1,0x04,0xf3,0x2d,0x34,0x8b,0x14,0x16,0x17,0x2f,
-0x0a,0x85,0x1a,0x06,0x86,0x1a,0x18,0x04,0x27,0x64,0x2f,0x00,0x09,0x09,0x00,0x11,
-0x14,0xe0,0x22,0x05,0x16,0x80,0x9e,0x01,0x00,0xe6,0x10,0x2f,0x04,0xc0,0xcf,0x00,
-0x0d,0x12,0x70,0xcf,0x00,0x00,0xf8,0xa4,0x11,0x06,0xaa,0x03,0xc1,0xfe,0xf4,0x00,
-0x06,0xf8,0x79,0xf4,0x00,0x08,0xf3,0xbe,0x10,0x1b,0x00,0x40,0x3f,0x90,0x1e,0xc0,
-0x09,0x00,0x50,0x02,0xed,0x00,0x03,0xfa,0x36,0x00,0xa0,0x0d,0xd1,0x00,0x00,0x5f,
-0x36,0xf1,0x04,0xf3,0x19,0xbf,0x76,0x48,0x04,0xc0,0x03,0xe2,0x77,0x06,0x04,0x1d,
-0x4b,0x14,0x02,0x15,0x03,0x01,0x7d,0x5b,0x1f,0x08,0x09,0x00,0x0c,0x10,0xf8,0x76,
-0x18,0x14,0xf0,0x89,0x43,0x2b,0xc0,0x00,0x25,0x4b,0x21,0x00,0x10,0xcf,0x00,0x41,
-0x07,0xb0,0x06,0xf1,0xcf,0x00,0x41,0x0a,0xe0,0x06,0xf2,0xcf,0x00,0x41,0x09,0xf0,
-0x06,0xf2,0xcf,0x00,0x02,0x09,0x00,0x10,0x3f,0x61,0x2c,0x21,0x05,0xf2,0x43,0x2b,
-0x60,0x09,0xfe,0xef,0xf2,0x00,0x00,0x56,0x02,0x72,0xf7,0x7a,0xf2,0x00,0x09,0xf3,
-0xdc,0x1b,0x00,0x40,0x3f,0x90,0x2f,0xa0,0x09,0x00,0x90,0x02,0xed,0x00,0x05,0xf8,
-0x09,0xe0,0x06,0xf2,0xcf,0x00,0x51,0x6f,0x19,0xe0,0x06,0xf2,0xcf,0x00,0x25,0x08,
-0xc0,0x54,0x0e,0x21,0x03,0xc0,0x06,0x00,0x11,0x55,0x01,0x28,0x00,0x3d,0xc2,0x02,
-0x17,0x32,0x60,0x8f,0xb4,0x10,0x16,0xef,0x20,0xe6,0x04,0x04,0x4f,0xc9,0x13,0xf5,
-0xdc,0x03,0x23,0x03,0xf6,0xc9,0x96,0x10,0x00,0x8f,0x40,0x01,0xec,0x3e,0x52,0x4f,
-0xfa,0x77,0x9d,0xfa,0x1d,0xbe,0x39,0xdd,0xb9,0x30,0x75,0x02,0x14,0x25,0xf1,0x03,
-0x24,0x08,0xf0,0xc2,0x01,0x14,0xae,0x13,0x00,0x20,0x0c,0xc0,0xa2,0x4d,0x22,0xaa,
-0x50,0x55,0x05,0x32,0x8f,0xcc,0xc6,0x59,0xb6,0x01,0xa5,0x03,0x10,0x1f,0xdd,0xa6,
-0x11,0x8f,0x21,0xc7,0x11,0x9f,0x50,0x2c,0x00,0x47,0xc7,0x20,0xaf,0x30,0xee,0x33,
-0x10,0x03,0x92,0xab,0x60,0x30,0x08,0xff,0xff,0x83,0xfc,0x4e,0x00,0x00,0x26,0x00,
-0x11,0x79,0xeb,0x04,0x2b,0x08,0xf0,0x90,0x15,0x13,0x3e,0x8e,0x9e,0x00,0xa0,0x07,
-0x13,0x47,0xbb,0x2a,0x05,0x41,0x0d,0x14,0xf9,0xc7,0x33,0x23,0xda,0xfa,0xf9,0x20,
-0x13,0xe2,0x42,0xa2,0x41,0x6f,0xe2,0x00,0x05,0x33,0x24,0x20,0x9f,0xb1,0x35,0x9b,
-0x00,0x5c,0x08,0x01,0x13,0x04,0x18,0x85,0x29,0x37,0x01,0x1d,0x2c,0x13,0x8d,0x4d,
-0x30,0x13,0x9e,0xdc,0x00,0x13,0x8e,0x87,0x08,0x13,0x8e,0xaa,0x07,0x13,0x8e,0x07,
-0x07,0x13,0x8e,0x97,0x9f,0x10,0x9e,0x67,0xac,0x11,0x04,0xbf,0x09,0xa2,0xaf,0xf9,
-0x00,0x56,0x66,0xbe,0x00,0x00,0xfa,0x8f,0x40,0x9b,0x21,0xf3,0x1f,0xf1,0x00,0x50,
-0x0e,0xc0,0x09,0xf1,0x00,0xdd,0x31,0x20,0x30,0x01,0x19,0x96,0x30,0x02,0xf8,0x00,
-0xb6,0x7f,0x31,0x8e,0x0b,0xd0,0x1c,0x0f,0x31,0x8e,0x0b,0x30,0x0e,0x25,0x04,0x90,
-0x2c,0x0f,0x08,0x00,0x0d,0x17,0x6b,0xab,0xa4,0x12,0x92,0x92,0x05,0x01,0x70,0x3f,
-0x13,0xcb,0x8b,0x05,0x13,0xcb,0x4e,0x3e,0x11,0xcb,0x67,0x03,0x40,0x24,0x44,0xdb,
-0x00,0xdc,0xc6,0x10,0xbf,0xc2,0x28,0xb0,0x7f,0xed,0x00,0x01,0x11,0xcb,0x00,0x01,
-0xeb,0x3f,0xa0,0x20,0x00,0x40,0x0c,0xe2,0x05,0xf8,0x08,0x00,0x20,0xaf,0x40,0x90,
-0x82,0x31,0xcb,0x0a,0xf5,0x22,0x16,0x31,0xcb,0x2c,0x30,0x64,0x06,0x14,0xca,0x14,
-0x6f,0x06,0x44,0x23,0x13,0xcf,0x33,0x08,0x09,0x42,0x23,0x1f,0xea,0x08,0x00,0x0c,
-0x04,0x15,0x9e,0x17,0x52,0xad,0x6c,0x10,0x09,0x6a,0x29,0x04,0x69,0x11,0x14,0x9f,
-0xcf,0x09,0x13,0xf0,0xd8,0x15,0x13,0x8f,0xd9,0x21,0x21,0x08,0xf0,0x09,0xa0,0x31,
-0x8d,0xdd,0xef,0xb0,0xaa,0x30,0x04,0x99,0x9c,0xa4,0xb9,0x12,0x5f,0x45,0x02,0x30,
-0x6f,0x70,0x8f,0x1a,0x0d,0x00,0x98,0xc9,0x10,0xbe,0x87,0x23,0x80,0x2e,0xd1,0x00,
-0x00,0xcd,0x10,0x08,0xf0,0x15,0x03,0x10,0x01,0x98,0x53,0x15,0x50,0x84,0x09,0x14,
-0x01,0x4c,0x0b,0x13,0xf8,0x29,0x32,0x05,0xaa,0x24,0x1b,0xf8,0xbb,0x24,0x05,0x0a,
-0x08,0x7e,0x1f,0xb6,0x55,0x56,0x66,0x78,0x10,0x57,0x98,0x06,0x07,0x03,0x13,0x5d,
-0xf3,0x12,0x01,0xc1,0x07,0x01,0x39,0x98,0x03,0xab,0x0a,0x01,0x48,0x03,0x11,0xe9,
-0x8a,0xb7,0x30,0x0b,0xcc,0xcf,0x67,0xc8,0x40,0xf7,0x00,0x9a,0xaa,0x19,0x0d,0x21,
-0x88,0xf3,0x22,0x00,0x40,0x1e,0xd0,0x0b,0xe2,0x22,0x00,0x20,0x0c,0xf2,0xf9,0x83,
-0x21,0x0e,0x90,0x83,0xcb,0x51,0xc0,0x00,0xe9,0x07,0xe3,0x6d,0x91,0x27,0x0e,0x90,
-0xc0,0x16,0x21,0x23,0x33,0x6b,0x7f,0x02,0xfc,0xc3,0x10,0xf7,0x7b,0x47,0x56,0x54,
-0x44,0x44,0x3f,0x90,0x5c,0x01,0x51,0x02,0x88,0x89,0x99,0x99,0xf7,0xb0,0x03,0xaa,
-0x8a,0x2e,0x09,0xf1,0xb0,0x94,0x02,0xd0,0x04,0x09,0x93,0x79,0x01,0x9d,0xc5,0x23,
-0x09,0x20,0x54,0x13,0x13,0xf6,0xc4,0x03,0x01,0xf5,0x56,0x13,0xe0,0x2e,0x42,0x11,
-0x9e,0xd5,0x00,0x10,0x02,0x7e,0x3e,0x00,0x43,0x02,0x30,0x9f,0xff,0xfe,0x2b,0xbb,
-0xa1,0xd0,0x00,0x11,0x1a,0xe0,0x00,0x01,0xeb,0x2f,0xa0,0x22,0x00,0x31,0xbf,0x20,
-0x4f,0x2f,0x0f,0x02,0x45,0x02,0x11,0x9e,0x80,0x07,0x61,0x6f,0x30,0x0a,0xe0,0x1c,
-0x30,0xf5,0x70,0x14,0xae,0x0c,0x0b,0x1b,0xc0,0x48,0x9b,0x13,0xf7,0x48,0x9b,0x23,
-0x3b,0xf6,0x48,0x9b,0x23,0x0c,0xd0,0x7e,0x78,0x13,0x8f,0x86,0x5f,0x23,0x0a,0xf0,
-0x48,0x9b,0x13,0xfa,0x48,0x9b,0x2b,0xfc,0x10,0x48,0x9b,0x00,0x87,0x5e,0x00,0xbb,
-0x19,0x43,0x06,0xc0,0x05,0xf1,0xb9,0x03,0x21,0x06,0xf1,0x96,0x00,0x00,0xd5,0x35,
-0x01,0xa4,0x8c,0x02,0x09,0x00,0x14,0xbb,0x09,0x00,0x12,0xd9,0xd1,0x6b,0x02,0xdc,
-0x9d,0x00,0x09,0x00,0x80,0x03,0xfe,0x02,0xef,0xff,0xf0,0x06,0xf1,0xc2,0xc6,0x20,
-0x66,0x6a,0x09,0x00,0x32,0x0c,0xbd,0xa0,0x1b,0x00,0x32,0x3f,0x57,0xf1,0x09,0x00,
-0x31,0xae,0x01,0xf8,0x09,0x00,0x41,0x03,0xf6,0x00,0x9e,0xbb,0x6b,0x50,0x0c,0xc0,
-0x00,0x1f,0x60,0x09,0x00,0xa0,0x6f,0x20,0x00,0x09,0xe0,0x07,0xe0,0x05,0xf1,0x86,
-0xb0,0x50,0x00,0x09,0x00,0x03,0x8d,0x34,0x0d,0x09,0x00,0x13,0xd0,0x28,0x1d,0x14,
-0x09,0x09,0x00,0x0e,0xe1,0x6b,0x03,0xcb,0x07,0x10,0x30,0xc5,0x99,0x11,0xf3,0x6d,
-0x04,0x23,0x05,0xf4,0xfc,0x06,0x00,0x6d,0x6a,0x01,0xe5,0x08,0x23,0x04,0xf4,0xfc,
-0x06,0x11,0x14,0x09,0x00,0x60,0x7f,0x90,0x3f,0xff,0xf4,0x03,0xcb,0x07,0x30,0xf3,
-0x05,0x57,0x09,0x00,0x60,0x06,0xf5,0xdd,0x00,0x02,0xf4,0xcb,0x07,0x51,0xb0,0x2f,
-0xa0,0x02,0xf4,0xcb,0x07,0x80,0x05,0xf8,0x02,0xf4,0x04,0xf4,0x0b,0xf4,0x7f,0x70,
-0x12,0xf4,0xcb,0x07,0x3a,0x04,0x12,0xf4,0xcb,0x07,0x13,0x11,0x16,0x0c,0x15,0x0c,
-0xa8,0x36,0x00,0x68,0x02,0x1f,0x4b,0xcb,0x07,0x2e,0x00,0x9a,0x08,0x32,0x03,0xf2,
-0x03,0xcb,0x07,0x32,0x05,0xf4,0x03,0xd8,0x00,0x11,0x04,0x09,0x00,0x23,0x0e,0xb0,
-0x09,0x00,0x41,0x2f,0x80,0x01,0x15,0xc6,0x00,0x23,0x6f,0x80,0xcf,0x00,0x40,0xdf,
-0xf1,0x04,0x46,0x1b,0x00,0x50,0x05,0xf8,0xeb,0x00,0x03,0x09,0x00,0x40,0x0e,0xd0,
-0x4f,0x70,0x09,0x00,0x00,0x25,0x06,0x10,0xf5,0x2b,0x5a,0x20,0x09,0xf5,0xc3,0xcf,
-0x40,0xf4,0x03,0xf3,0x2f,0x2a,0x8f,0x11,0x22,0x48,0x00,0x01,0x41,0x4f,0x12,0x04,
-0x87,0xa5,0x01,0x09,0x00,0x00,0x94,0x00,0x11,0x02,0xa2,0x1e,0x02,0x09,0x6c,0x09,
-0x12,0x13,0x0e,0x09,0x00,0x00,0x0d,0x6c,0x36,0x77,0x81,0x00,0x0e,0x6c,0x08,0x0f,
-0x6c,0x03,0xf9,0x43,0x14,0x60,0xcf,0x00,0x01,0x9e,0x01,0x00,0xcb,0xa6,0x04,0xcf,
-0x00,0x22,0x0f,0xa0,0xab,0x00,0x51,0x00,0x4f,0x70,0x06,0x79,0xc6,0x00,0xd0,0x9f,
-0xc0,0x2e,0xff,0xf4,0x02,0xf4,0x00,0x01,0xfd,0xf7,0x00,0x02,0x09,0x00,0x41,0x09,
-0xf2,0x9f,0x30,0x09,0x00,0x40,0x4f,0x80,0x0c,0xe2,0x09,0x00,0x50,0x02,0xec,0x00,
-0x01,0xdd,0xa7,0x01,0x92,0x1e,0xd1,0x00,0x00,0x1c,0x42,0xf4,0x03,0xf3,0x10,0x31,
-0x37,0x70,0x01,0xb1,0xce,0x1e,0x15,0x06,0xa6,0x0b,0x19,0x10,0xa9,0x78,0x17,0xf0,
-0xd0,0x1e,0x11,0x07,0x22,0x6c,0x00,0x78,0x0c,0x0e,0x70,0x90,0x07,0x0d,0x17,0x02,
-0x9b,0x4e,0x05,0xc9,0x0c,0x01,0x9e,0x01,0x23,0x07,0xf0,0x9e,0x01,0x23,0x07,0xf1,
-0x9e,0x01,0x01,0x5b,0x81,0x13,0xb0,0x09,0x00,0x73,0x2f,0x80,0x04,0x57,0xf4,0x06,
-0xf1,0x6d,0x02,0x00,0x09,0x00,0x40,0xdf,0xf2,0x00,0x03,0x09,0x00,0x50,0x06,0xf6,
-0xdd,0x00,0x02,0x09,0x00,0x41,0x1e,0xc0,0x2f,0xa0,0x09,0x00,0x40,0xbf,0x20,0x05,
-0xf7,0x09,0x00,0x20,0x0a,0xf4,0x95,0x3d,0x40,0xf4,0x06,0xf1,0x2e,0x6c,0x0b,0x23,
-0x11,0xf2,0xb5,0x2c,0x02,0x2d,0x49,0x02,0xe1,0x26,0x14,0x10,0x09,0xa2,0x02,0x1a,
-0x00,0x15,0xfe,0x4c,0x0a,0x13,0xc0,0xcc,0x07,0x11,0x95,0x96,0xaf,0x00,0xfc,0xbe,
-0x32,0x3e,0xe3,0x00,0x81,0xcb,0x01,0x9f,0x88,0x11,0x0c,0x32,0x19,0x14,0xf4,0x3d,
-0xa1,0x17,0x42,0x3d,0x81,0x22,0x1a,0x10,0x90,0x02,0x01,0x3a,0x16,0x13,0x9f,0x63,
-0x33,0x21,0x09,0xf0,0x0c,0x01,0x31,0x5c,0xcc,0xef,0x7d,0x1c,0x43,0x03,0x99,0x9d,
-0xf0,0xfc,0xbc,0x00,0x03,0x2b,0x03,0x24,0x32,0x70,0x01,0xeb,0x8f,0x40,0x14,0x44,
-0xaf,0xd3,0x1a,0x20,0xce,0x17,0x6c,0x01,0x70,0x6f,0x60,0x01,0xec,0x01,0x11,0x9f,
-0x56,0x40,0x60,0x02,0xeb,0x00,0x08,0xf0,0x3f,0x55,0x47,0x5f,0xe3,0x00,0x8f,0x01,
-0x40,0x57,0x06,0x07,0x1d,0x1f,0x46,0x06,0x0f,0x57,0x06,0x19,0x2c,0x03,0x00,0x3e,
-0x47,0x06,0x69,0x1b,0x15,0x09,0xa7,0x1d,0x24,0xff,0x40,0x7c,0x1b,0x23,0xfe,0x10,
-0x25,0x00,0x33,0xa4,0xfd,0x10,0xe0,0xb0,0x12,0x06,0xec,0x08,0x23,0x3e,0xd1,0xec,
-0x08,0x20,0x5f,0xc1,0x11,0xcc,0x11,0x40,0x1c,0x41,0x41,0x01,0x00,0x01,0xae,0xd8,
-0x07,0x2f,0x07,0xe0,0x85,0x5e,0x0d,0x06,0xce,0x03,0x0f,0x02,0x35,0x04,0x1d,0x25,
-0x42,0x00,0x14,0xdd,0xfc,0x03,0x23,0xff,0x50,0x0a,0x1c,0x22,0xdd,0xf4,0xcd,0x00,
-0x41,0xdf,0x21,0xdf,0x50,0xa7,0x00,0x31,0xe3,0x00,0x1b,0xb0,0x33,0x31,0xfb,0x10,
-0x13,0x44,0x42,0x10,0x4b,0xfb,0x21,0x2f,0x02,0x94,0xf5,0x1e,0x6e,0x06,0xf0,0x6c,
-0x06,0x87,0x00,0x15,0xbe,0x04,0x6f,0x14,0x10,0x0b,0xb5,0x13,0xd1,0x77,0x01,0x11,
-0x64,0x6e,0x01,0x00,0x77,0x34,0x30,0x4e,0xe3,0x00,0x42,0x32,0x40,0x50,0x00,0x02,
-0xcf,0xee,0xae,0x61,0xa1,0x00,0x7d,0x00,0x07,0xe6,0x17,0x02,0x0f,0xf7,0x87,0x04,
-0x13,0x5e,0x4e,0x01,0x1b,0xfd,0x84,0x51,0x09,0x51,0x65,0x0f,0xd8,0x7a,0x16,0x24,
-0x66,0x74,0x75,0x0c,0x1a,0xfa,0x1a,0x01,0x1d,0x37,0x9e,0x01,0x15,0xed,0x0a,0x04,
-0x13,0x60,0x20,0x0b,0x23,0xcc,0xf5,0x9d,0x53,0x33,0x10,0xcf,0x70,0x53,0x35,0x10,
-0x09,0x4d,0x3e,0xa0,0x2d,0xf9,0x00,0x36,0x00,0x5e,0xe3,0x00,0x00,0x39,0x5f,0x76,
-0x2e,0x01,0x73,0xb4,0x88,0x09,0xc6,0x00,0x01,0x14,0x02,0x1a,0x85,0xd8,0x7a,0x1f,
-0x64,0x91,0x6e,0x29,0x34,0xfc,0x87,0x9d,0x7e,0x64,0x06,0xb3,0x0f,0x22,0x02,0x40,
-0x04,0x00,0x23,0x09,0xe0,0x6f,0x11,0x00,0xc6,0x43,0x03,0x6d,0x11,0x22,0x0e,0xb0,
-0x61,0x11,0x13,0x2f,0x91,0x11,0x21,0x9f,0xe1,0x08,0x00,0x41,0x02,0xfc,0xfa,0x00,
-0x82,0x8a,0x21,0xf1,0x6f,0x7c,0x43,0x90,0x9f,0x50,0x08,0xf5,0x00,0x07,0xf0,0x09,
-0xf7,0x5f,0x11,0x40,0x07,0xf0,0x7f,0x60,0x92,0x08,0x53,0x07,0xf0,0x32,0x00,0x0d,
-0xa1,0x11,0x2f,0x0e,0x90,0x08,0x00,0x04,0x51,0x91,0x24,0x67,0x07,0xf0,0xf9,0x0a,
-0x8d,0xeb,0x07,0xf0,0x45,0x66,0x65,0x54,0x31,0xcb,0x30,0x05,0x6b,0x33,0x1f,0xe0,
-0x9c,0x68,0x03,0x06,0x4e,0x4f,0x1c,0x20,0x74,0x06,0x03,0x4e,0xc2,0x00,0x81,0x1d,
-0x02,0x66,0xb2,0x00,0x01,0x0e,0x13,0xdf,0xf4,0xce,0x41,0xa0,0x01,0xcf,0x60,0x63,
-0xce,0x12,0x90,0x03,0x14,0x11,0x04,0xd5,0x8c,0x00,0x88,0xba,0x1a,0x36,0xb5,0x22,
-0x19,0x00,0x3f,0x90,0x10,0xed,0x32,0x16,0x00,0x8f,0x9c,0x03,0x99,0x36,0x2e,0x64,
-0x00,0xd3,0x4f,0x0f,0x13,0x00,0x17,0x0e,0x84,0x87,0x07,0x31,0x03,0x1f,0x9f,0x31,
-0x03,0x08,0x14,0xc0,0x41,0x57,0x03,0x31,0x03,0x3c,0xf8,0x00,0x4f,0x31,0x03,0x01,
-0x49,0x65,0x0e,0x8d,0x62,0x05,0xa2,0x36,0x09,0x09,0x7e,0x0b,0xac,0x91,0x23,0x03,
-0xe2,0x09,0x00,0x10,0x05,0x04,0x3c,0x03,0xe9,0x03,0x2f,0x0f,0x50,0xfb,0x03,0x04,
-0x0a,0x65,0x53,0x0b,0x36,0xd1,0x19,0x49,0x9b,0x22,0x08,0x31,0x03,0x33,0x07,0xff,
-0x80,0x48,0x0e,0x32,0xba,0xf7,0x00,0x44,0xd6,0x31,0x10,0xaf,0x90,0x6a,0x41,0x30,
-0xc1,0x00,0x08,0xec,0xab,0x20,0x3e,0xf7,0xa4,0x17,0x58,0xf4,0x00,0x00,0x27,0x10,
-0xe5,0x0c,0x01,0xb9,0x17,0x10,0xdd,0x38,0x34,0x83,0xee,0xec,0x29,0x99,0x88,0x88,
-0xbf,0x98,0xfe,0x72,0x05,0x1d,0x39,0x1d,0x5f,0xf8,0x05,0x2d,0x4f,0x30,0x57,0x21,
-0x13,0xd1,0xf4,0x0e,0x11,0xe6,0x64,0xaf,0x00,0x83,0x47,0x21,0x3e,0xe4,0x1b,0x02,
-0x52,0xd2,0x00,0x01,0xcf,0x80,0x31,0xba,0x00,0x36,0xc6,0x03,0x3a,0x32,0x2e,0x23,
-0x00,0xe7,0x52,0x02,0x3e,0xd1,0x0c,0xe1,0x00,0x15,0xfd,0xe1,0x00,0x13,0x50,0xbf,
-0x37,0x23,0xbc,0xf3,0x88,0x02,0x11,0x21,0x22,0xc4,0x00,0xba,0x2d,0x30,0x1d,0xe3,
-0x00,0x88,0x4c,0x30,0x50,0x00,0x01,0x92,0x02,0x23,0x3e,0xe4,0xa0,0xd5,0x15,0x47,
-0x1c,0x14,0x0f,0x8f,0x6b,0x09,0x11,0x44,0x15,0x33,0x05,0xc2,0x05,0x04,0xbe,0x4c,
-0x19,0x20,0xa2,0x04,0x15,0xae,0x88,0x20,0x14,0x00,0xac,0x0c,0x13,0x70,0xd9,0x2f,
-0x23,0xab,0xf7,0x01,0xb2,0x02,0xf8,0xd5,0x60,0x03,0xcf,0xa0,0x00,0x06,0xfe,0xdc,
-0x13,0x10,0xd4,0xbc,0x97,0x14,0xf5,0xfe,0x02,0x19,0x10,0x40,0xb1,0x01,0xaf,0x6d,
-0x21,0xfd,0x15,0xbf,0x91,0x09,0x18,0x4d,0x10,0x01,0x30,0x38,0x24,0x69,0x80,0x94,
-0x36,0x13,0xf0,0x01,0x31,0x09,0x4c,0x09,0x02,0xaa,0x58,0x00,0x2e,0x08,0x04,0x5b,
-0x6f,0x1a,0x08,0x35,0x38,0x11,0x10,0x85,0xd5,0x12,0xee,0x40,0x02,0x25,0x57,0x78,
-0x76,0x6a,0x1e,0x37,0x40,0x02,0x0d,0x71,0x05,0x32,0xcb,0xf6,0x00,0xc2,0x01,0x33,
-0x10,0xbf,0x70,0x64,0xb3,0x02,0x71,0x05,0x00,0xc2,0x01,0x03,0x71,0x05,0x04,0x4f,
-0x9c,0x03,0x4b,0x03,0x21,0x21,0x10,0x27,0xac,0x15,0x21,0x44,0x01,0x30,0x04,0x45,
-0x55,0x5a,0x83,0x27,0x54,0x42,0x6f,0x05,0x01,0x9d,0xbf,0x01,0xfd,0xb0,0x03,0x85,
-0x08,0x15,0x07,0x09,0x00,0x01,0xf2,0x92,0x12,0xe0,0xcf,0x00,0x01,0xd2,0x3b,0x04,
-0x9b,0x4b,0x06,0x24,0x00,0x19,0x06,0x22,0x9f,0x03,0xff,0x15,0x1e,0x37,0x17,0x08,
-0x04,0xd0,0x00,0x03,0x33,0xad,0x07,0xd1,0x00,0x63,0x00,0x4e,0xe1,0x0b,0xf8,0x00,
-0x43,0x06,0x30,0x08,0xfb,0x10,0xf2,0x07,0x10,0x90,0x54,0xba,0x1e,0x40,0xd3,0x00,
-0x05,0xd4,0x00,0x26,0x11,0x21,0x35,0xa1,0x22,0x04,0x45,0x2f,0x81,0x2e,0x43,0x00,
-0xc5,0x6a,0x02,0xfe,0x15,0x29,0xfe,0x60,0x48,0x06,0x15,0x0d,0xfe,0x15,0x19,0xf9,
-0xfe,0x15,0x02,0x5a,0xda,0x15,0x40,0xfe,0x15,0x23,0xb8,0x78,0xfe,0x15,0x09,0x64,
-0x3e,0x22,0x02,0x10,0x6b,0x07,0x12,0xe8,0xec,0x0e,0x22,0x0e,0x80,0x71,0x07,0x12,
-0xe8,0x65,0x20,0x22,0x0e,0x80,0x1d,0x08,0x13,0xe8,0x3d,0xac,0x33,0x80,0x00,0x0a,
-0xbd,0xab,0x21,0xff,0x90,0x14,0x06,0x30,0x4f,0xef,0x10,0x0f,0x00,0x30,0x0a,0xf2,
-0xf8,0x0f,0x00,0x40,0x02,0xf9,0x0a,0xe0,0x0f,0x00,0x30,0x9f,0x10,0x2f,0xa6,0x69,
-0x20,0x2f,0x80,0x74,0x0f,0x30,0xe9,0x0c,0xd0,0xef,0x93,0x31,0x0e,0x96,0xf3,0x81,
-0x04,0x30,0xe9,0x86,0x00,0xf6,0x24,0x29,0x0e,0x90,0x0e,0x11,0x0f,0x0f,0x00,0x04,
-0x1b,0xc7,0xdc,0x11,0x13,0xdb,0x10,0x08,0x13,0xdb,0xc7,0x20,0x13,0xdc,0xbd,0x08,
-0x13,0xdc,0x43,0x06,0x10,0xdc,0x9f,0xcd,0x02,0x39,0x1a,0x20,0x7f,0xfd,0x08,0x00,
-0x00,0xdc,0x11,0x10,0x90,0x08,0x00,0x40,0x0b,0xf2,0x05,0xf7,0x08,0x00,0x20,0xaf,
-0x40,0x1f,0xb2,0x31,0xdb,0x0b,0xf5,0x05,0x0b,0x11,0xdb,0xdc,0x11,0x12,0x30,0xa1,
-0x87,0x14,0x00,0x5f,0xa2,0x01,0xdf,0x18,0x13,0xcf,0x51,0x21,0x10,0x47,0x3c,0x03,
-0x0f,0xdc,0x11,0x1d,0x17,0x62,0xad,0x58,0x2b,0x09,0x30,0xdc,0x11,0x13,0x1f,0xa1,
-0x1b,0x2c,0x03,0xf6,0xdc,0x11,0x13,0xf2,0xee,0x0f,0x13,0xff,0x22,0x14,0x22,0xaf,
-0x6f,0xdc,0x11,0x21,0x4f,0x80,0xdc,0x11,0x00,0x15,0x11,0x10,0xbf,0xdc,0x11,0x00,
-0x9e,0xdb,0xa9,0xce,0x20,0x08,0xf0,0x0d,0xd2,0x00,0x00,0x01,0xb9,0xdc,0x11,0x05,
-0x87,0x06,0x18,0xc6,0x8f,0x8e,0x1f,0x02,0xdc,0x11,0x28,0x01,0x08,0xbd,0x12,0x30,
-0x6a,0x08,0x0d,0x49,0x0c,0x23,0x09,0xf1,0x11,0x00,0x13,0xef,0x6b,0x0c,0x22,0x6f,
-0xfb,0xc4,0x00,0x31,0x0e,0xc5,0xf6,0x80,0x00,0x30,0x0a,0xf2,0x08,0x94,0x16,0x00,
-0x80,0xb0,0x10,0x0a,0xa3,0x54,0x00,0x6e,0xae,0x61,0x0b,0xe1,0x00,0x9f,0x04,0xf7,
-0x54,0x98,0x05,0x53,0x03,0x17,0x59,0xdc,0x11,0x13,0xaf,0xe4,0x06,0x01,0xdc,0x11,
-0x26,0x3b,0xe0,0xd5,0x00,0x01,0xdc,0x11,0x23,0x9d,0xe0,0x22,0x00,0x21,0xe8,0x00,
-0x2d,0x93,0x04,0x78,0xae,0x03,0x96,0xb8,0x30,0xdd,0xee,0xef,0xb7,0x01,0x10,0x17,
-0x53,0x0a,0x05,0x2d,0x71,0x13,0x02,0x99,0x1b,0x01,0x9a,0x08,0x14,0xe9,0x95,0x33,
-0x03,0xd3,0x08,0x01,0x64,0x13,0x13,0x7f,0x73,0x3f,0x22,0x07,0xf0,0xcc,0xc0,0x20,
-0x00,0x7f,0x1d,0x07,0x12,0xe1,0x11,0x00,0x20,0xce,0x2e,0x96,0xb9,0x00,0x29,0xb2,
-0x11,0x3f,0xd5,0xab,0x20,0x5f,0x80,0xd6,0x41,0x11,0x7f,0x63,0x4d,0x61,0x5f,0x60,
-0x07,0xf0,0x0d,0x70,0xa4,0x02,0x17,0x6f,0x3d,0x32,0x10,0x05,0xc5,0x29,0x17,0x86,
-0x2e,0x71,0x23,0x0f,0x80,0xa0,0x77,0x13,0xf8,0x72,0x0b,0x13,0x1f,0x11,0x00,0x15,
-0x01,0x11,0x00,0x54,0xa2,0x22,0x22,0x23,0x8f,0x88,0x01,0x13,0xe0,0x9c,0x1c,0x09,
-0x53,0x56,0x23,0x08,0x20,0x0b,0x3e,0x04,0xa0,0x12,0x18,0x3f,0xa0,0x12,0x13,0xaf,
-0x8c,0x01,0x21,0x09,0xf0,0xa0,0x12,0x01,0x0d,0x00,0x01,0x17,0xbf,0x00,0x0e,0x30,
-0x33,0xec,0x3f,0x90,0xa0,0x12,0x01,0x67,0x2d,0x00,0x76,0xd8,0x10,0x7f,0x5a,0x38,
-0x20,0x9f,0x60,0x88,0xa9,0x40,0x0a,0xe0,0x2e,0x40,0xe3,0x8b,0x0b,0xa0,0x12,0x12,
-0x47,0xa0,0x12,0x22,0x06,0xef,0xa0,0x12,0x23,0x06,0xfc,0xa0,0x12,0x04,0x94,0x85,
-0x23,0x1f,0x80,0xc3,0x02,0x13,0xf9,0xc5,0x09,0x22,0x0b,0xf4,0xb4,0x1b,0x00,0x4b,
-0x79,0x21,0x9c,0xfc,0x48,0x8a,0x26,0xbd,0xdc,0x2d,0xb3,0x12,0x81,0x49,0x9a,0x12,
-0x26,0xbe,0x24,0x01,0x9b,0x35,0x22,0x02,0xf6,0xba,0x28,0x12,0x8f,0x87,0x1b,0x20,
-0x1f,0x50,0x68,0x0b,0x12,0xf7,0xb1,0x24,0x00,0x33,0x50,0x02,0xc8,0x1e,0x11,0xbe,
-0x0a,0x00,0x00,0x79,0x01,0x12,0xcf,0x67,0x24,0x20,0x7f,0xb0,0x46,0xbe,0x11,0xf7,
-0x36,0xe1,0x40,0x01,0xff,0x70,0x00,0x75,0x23,0xe1,0xdd,0xf2,0x04,0xfe,0xb0,0x00,
-0xfb,0x77,0x71,0x01,0xf7,0xf7,0x08,0xe6,0x11,0x8c,0x80,0x05,0xf2,0xbc,0x0d,0x92,
-0xf4,0x00,0xf7,0xd7,0x17,0x60,0x7f,0x5f,0x30,0xd9,0x00,0xf7,0x34,0x01,0x40,0x1f,
-0xfc,0x00,0x8e,0x0a,0x00,0x10,0xad,0xb0,0x00,0x60,0x2f,0x40,0xf7,0x00,0x00,0x73,
-0x72,0x16,0x16,0x05,0xcf,0x39,0x0e,0x0a,0x00,0x0f,0xae,0xa3,0x04,0x19,0xc5,0x0a,
-0x18,0x23,0x09,0xd0,0xcf,0x64,0x23,0x0b,0xe0,0xa7,0x0c,0x23,0x0d,0xc0,0x76,0x09,
-0x31,0x0f,0xe0,0x00,0xc2,0xaa,0x00,0x84,0xc3,0x21,0x0e,0xfa,0x24,0x0a,0x50,0xf9,
-0x00,0x4f,0xef,0x20,0xcb,0x74,0x50,0x8f,0x10,0xcf,0x2f,0xa0,0xad,0xb3,0x50,0x1f,
-0x94,0xf8,0x07,0xf3,0x4f,0xb0,0x50,0x06,0xfd,0xd0,0x00,0xcd,0x12,0x01,0x00,0xcd,
-0x15,0x42,0x1e,0x50,0x00,0x30,0xe8,0xa7,0x0f,0x23,0x57,0x0b,0x02,0x01,0x00,0x1d,
-0x32,0xf3,0x73,0x16,0x31,0x37,0x0c,0x08,0x84,0x53,0x23,0x34,0x10,0x0a,0x00,0x32,
-0x6e,0xff,0xf8,0x0a,0x00,0x51,0x04,0xfa,0x31,0x8f,0x60,0x0a,0x00,0x01,0x9a,0x19,
-0x01,0xf3,0x03,0x20,0x1f,0x70,0x40,0x26,0x21,0x09,0xf0,0x89,0x26,0x21,0x02,0xf5,
-0x0a,0x00,0x20,0x5f,0x20,0x9b,0x00,0x31,0x09,0xf4,0x34,0xe5,0x30,0x11,0xf6,0x31,
-0x85,0x20,0x4f,0x20,0xc3,0x26,0x60,0x09,0xe3,0x33,0x10,0x3f,0x40,0x28,0x04,0x01,
-0x58,0x16,0x00,0x9f,0x3e,0x02,0xb6,0xb6,0x41,0xe0,0x00,0x1e,0xb0,0x0a,0x00,0x52,
-0x02,0xed,0x77,0xdf,0x30,0x52,0x18,0x38,0x2b,0xee,0xb3,0x21,0x85,0x2f,0x08,0xe0,
-0x47,0x20,0x1d,0x0e,0x37,0x85,0x02,0xc7,0x15,0x31,0x28,0xaa,0x50,0x2a,0x20,0x41,
-0x06,0xfe,0xac,0xfa,0x0d,0x06,0x20,0x1f,0xb0,0xdd,0x03,0x11,0xcc,0x70,0x03,0x20,
-0x0e,0x90,0x1b,0x00,0x11,0x9e,0x5d,0x2a,0x11,0xbc,0x14,0x15,0x20,0x0a,0xd0,0xe0,
-0x4f,0x11,0x9e,0x2e,0x28,0x10,0xbf,0x68,0x84,0x00,0x12,0x33,0x10,0xbd,0x57,0x14,
-0x00,0x81,0x15,0x10,0xac,0x51,0xcf,0x22,0x67,0xed,0xce,0x4f,0x10,0x8e,0xb7,0xc2,
-0x0e,0xe0,0x4f,0x1f,0x34,0x59,0x3b,0x46,0x21,0x15,0x00,0xf5,0x8f,0x00,0x29,0x0b,
-0x00,0x46,0xbf,0x11,0xe3,0x09,0x00,0x41,0x0b,0xf4,0x02,0xce,0x46,0x3a,0x20,0x3f,
-0x60,0x52,0x1f,0x20,0x6f,0x10,0x9e,0x07,0x20,0x0d,0xa0,0x09,0x00,0x11,0xae,0xc6,
-0x00,0x01,0x09,0x00,0x00,0x8e,0x02,0x41,0x6f,0x43,0x31,0x9f,0x50,0x2b,0x51,0x6f,
-0xff,0xfd,0x6f,0x30,0x3c,0xa2,0x21,0x64,0x42,0x0e,0x01,0x00,0x0b,0x01,0x42,0x07,
-0xfc,0x9b,0xfa,0x83,0x0b,0x3f,0x5b,0xdc,0x70,0x0f,0x7a,0x05,0x14,0x0a,0x2e,0xa2,
-0x01,0xce,0x38,0x1e,0x27,0xac,0x9c,0x08,0x00,0x43,0x23,0x1f,0xc6,0xe0,0x4f,0x15,
-0x0d,0x61,0x28,0x09,0x59,0x3b,0x10,0x16,0xa9,0x02,0x23,0x9c,0xb6,0x6e,0x42,0x20,
-0xfc,0x8a,0x5c,0x3e,0x01,0x81,0x1b,0x10,0x06,0x22,0x38,0x04,0xa0,0x01,0x12,0x7f,
-0x22,0x9b,0x11,0xbb,0xc6,0x09,0x10,0xae,0xa1,0x01,0x00,0x59,0x3b,0x20,0x09,0xe0,
-0x72,0x01,0x54,0x06,0xf9,0x88,0x60,0x7f,0xee,0x00,0x20,0x03,0xf8,0x7c,0xb4,0x21,
-0x06,0xf0,0x34,0xe1,0x12,0xfd,0xc6,0x05,0x42,0x09,0xff,0xfb,0x10,0x29,0x63,0x00,
-0xf7,0x14,0x24,0x54,0x32,0x9f,0x2c,0x01,0xbd,0x20,0x17,0x49,0xcc,0x09,0x11,0x2f,
-0xeb,0x09,0x00,0x0a,0x02,0x42,0x33,0x35,0x43,0x32,0xe1,0x06,0x02,0x22,0xc1,0x10,
-0x9e,0x15,0xae,0x20,0x4f,0x70,0x13,0x00,0x00,0x95,0x23,0x10,0xab,0x66,0x04,0x61,
-0x55,0x75,0x2f,0x30,0x0a,0xb0,0xf2,0x0a,0x33,0x90,0xdb,0x36,0xa5,0x5b,0x2d,0x03,
-0xcf,0x71,0xde,0x03,0xb3,0x01,0x23,0x7a,0x94,0xe4,0x00,0x31,0xff,0xbc,0xf9,0x3e,
-0x0e,0x12,0x03,0xe4,0x00,0x11,0xf1,0x4a,0x09,0x11,0x0e,0xc8,0xb6,0x00,0xb4,0x0f,
-0x11,0xbd,0xb7,0x94,0x10,0xbd,0xad,0x01,0x00,0xf6,0x24,0x12,0x29,0xe4,0x00,0x51,
-0xf3,0x22,0x10,0x6f,0x40,0xae,0x01,0x00,0x0f,0x06,0x30,0x63,0x4c,0xf2,0x0a,0x01,
-0x00,0x00,0x02,0x13,0xd4,0x9d,0x01,0x28,0x12,0x10,0x3d,0x3c,0x11,0x02,0x26,0x84,
-0x04,0xb2,0x0a,0x05,0xd6,0x86,0x01,0x3d,0x3c,0x1a,0x08,0xc3,0x0e,0x64,0x67,0x88,
-0x88,0x88,0x8c,0xf1,0x26,0x00,0x13,0xea,0x3a,0x99,0x0b,0x5f,0x13,0x42,0x04,0xff,
-0xed,0xee,0xfd,0xb1,0x20,0x06,0x88,0xf6,0x33,0x1d,0x20,0x5d,0x03,0x14,0x9e,0x5d,
+0x60,0x06,0xf7,0xdd,0x10,0x00,0x05,0x21,0x06,0xe1,0x1f,0xc0,0x2e,0xb0,0x00,0x05,
+0xf8,0x77,0x50,0x00,0xce,0x20,0x03,0xfa,0x1e,0x00,0xf0,0x01,0x0a,0xf3,0x00,0x00,
+0x3f,0x90,0x05,0xf1,0x00,0x00,0x7e,0x40,0x00,0x00,0x03,0x80,0x0a,0x00,0x12,0x11,
+0x67,0x01,0x04,0xe6,0x06,0x03,0x0a,0x00,0x14,0xf8,0x0a,0x00,0x01,0x9c,0x05,0x27,
+0x02,0x80,0xa6,0x05,0x0e,0x0a,0x00,0x04,0xbc,0x05,0x21,0x55,0x56,0x7f,0x02,0x01,
+0xbe,0x05,0x22,0xf4,0x00,0x94,0x03,0x02,0x5f,0x00,0x07,0x55,0x03,0x24,0x04,0x80,
+0xa8,0x09,0x15,0x09,0x61,0x02,0x24,0x0a,0xd0,0x0a,0x00,0x24,0x0d,0xa0,0x1e,0x00,
+0x24,0x2f,0x70,0x0a,0x00,0x21,0x9f,0xd0,0xec,0x09,0x51,0x60,0x00,0x01,0xfd,0xf9,
+0xd2,0x09,0x80,0xc0,0x00,0x0b,0xf2,0x8f,0x60,0x00,0x07,0xa0,0x00,0x41,0x6f,0x60,
+0x09,0xf4,0xf4,0x06,0x60,0x05,0xfa,0x00,0x00,0x9f,0x40,0x0a,0x00,0x20,0x4f,0xa0,
+0x5c,0x00,0x00,0x0a,0x00,0x17,0x67,0x5e,0x01,0x14,0x30,0x2b,0x09,0x11,0x00,0xfc,
+0x08,0x01,0xdc,0x00,0x15,0xf6,0xe6,0x00,0x51,0xf7,0x21,0x11,0x11,0x26,0x0a,0x00,
+0x01,0xfc,0x05,0x01,0xfa,0x00,0x00,0x89,0x08,0x1b,0x38,0x28,0x00,0x15,0xf6,0x62,
+0x07,0x05,0xfb,0x0a,0x20,0x00,0x35,0x99,0x0a,0x1a,0x20,0xdf,0x0a,0x63,0x44,0x00,
+0x00,0x00,0x9e,0x00,0x31,0x0a,0x02,0x6e,0x03,0x14,0xcb,0x13,0x00,0x05,0x8b,0x03,
+0x24,0x03,0xf5,0x13,0x00,0x10,0xaf,0x8a,0x03,0x00,0x58,0x03,0x10,0x1f,0x6a,0x09,
+0x50,0x9f,0xff,0xfc,0x00,0x0a,0xa7,0x02,0x20,0x09,0xe0,0xd1,0x01,0x21,0x02,0xec,
+0x26,0x00,0x50,0x03,0xfb,0x00,0x03,0xeb,0x13,0x00,0x60,0x03,0xfc,0x00,0x00,0x02,
+0xe9,0x13,0x00,0x10,0xba,0x70,0x00,0x34,0x40,0x09,0xe0,0x7c,0x00,0x12,0x7c,0x05,
+0x04,0x22,0x78,0x64,0x0f,0x00,0x41,0x5e,0xff,0xef,0xff,0x48,0x0a,0x60,0x5f,0xc3,
+0x00,0x03,0xbf,0x60,0x86,0x02,0x00,0x16,0x04,0x14,0xcd,0xe1,0x01,0x01,0x73,0x01,
+0x24,0x0f,0xa0,0x44,0x0c,0x60,0xaf,0x50,0x00,0x00,0x5f,0xa0,0x53,0x00,0x51,0xdf,
+0xc8,0x79,0xcf,0xc1,0x43,0x00,0x47,0x6b,0xdd,0xb9,0x50,0xc2,0x01,0x80,0x40,0x00,
+0x00,0x04,0x00,0x00,0x0c,0x70,0x28,0x0a,0x71,0x3f,0x20,0x00,0x0e,0x80,0x04,0xf2,
+0x2b,0x0a,0x11,0x0e,0x12,0x00,0x41,0x5f,0x20,0x00,0x0f,0x09,0x00,0x23,0x6f,0x00,
+0x09,0x00,0x14,0x8e,0x09,0x00,0x14,0xbe,0x09,0x00,0xd0,0xef,0x40,0x00,0x0f,0xa5,
+0x58,0xf2,0x00,0x03,0xff,0xa0,0x00,0x0f,0x2d,0x07,0x32,0x09,0xe8,0xf1,0x1b,0x00,
+0x32,0x0f,0x91,0xf8,0x09,0x00,0x31,0x7f,0x10,0x8e,0x51,0x00,0x50,0x01,0xf9,0x00,
+0x1f,0x70,0x63,0x00,0x50,0x09,0xe1,0x00,0x08,0xe1,0x09,0x00,0x50,0x4f,0x40,0x00,
+0x01,0xe8,0x09,0x00,0x00,0xd9,0x01,0x12,0x45,0x7e,0x00,0x01,0x3f,0x0d,0x0f,0x09,
+0x00,0x0f,0x49,0x08,0x40,0x03,0xf1,0xb2,0x09,0x03,0x09,0x00,0x71,0x03,0x40,0x00,
+0x05,0xe0,0x04,0xf3,0x60,0x03,0x20,0x07,0xf0,0x39,0x0b,0x50,0x0d,0xc0,0x00,0x07,
+0xf1,0x09,0x00,0x41,0x0f,0xb0,0x00,0x06,0x09,0x00,0x71,0x3f,0x80,0x00,0x06,0xf1,
+0x03,0xf4,0x70,0x03,0xf2,0x02,0x06,0xfc,0xbc,0xf4,0x00,0x00,0xef,0xf2,0x00,0x06,
+0xfb,0xbc,0xf4,0x00,0x06,0xf6,0xdc,0x1b,0x00,0x41,0x1f,0xc0,0x3f,0x90,0x09,0x00,
+0x40,0xce,0x10,0x06,0xf7,0x36,0x00,0xf3,0x03,0x0b,0xf3,0x00,0x00,0x8f,0x26,0xf1,
+0x04,0xf3,0x2d,0x30,0x00,0x00,0x05,0x16,0xf0,0x04,0xf3,0x04,0x03,0x27,0x01,0x70,
+0x50,0x01,0x14,0x0b,0x93,0x0a,0x74,0x04,0x77,0x66,0x66,0x66,0x6c,0xf0,0x8e,0x0d,
+0x0f,0x09,0x00,0x11,0x14,0xe0,0x22,0x05,0x17,0x80,0x9e,0x01,0x5f,0x02,0x20,0x00,
+0x04,0xc0,0xcf,0x00,0x0d,0x13,0x70,0xcf,0x00,0x41,0x8f,0xa0,0x00,0x06,0xaa,0x03,
+0xc1,0xfe,0xf4,0x00,0x06,0xf8,0x79,0xf4,0x00,0x08,0xf3,0xbe,0x10,0x1b,0x00,0x40,
+0x3f,0x90,0x1e,0xc0,0x09,0x00,0x50,0x02,0xed,0x00,0x03,0xfa,0x36,0x00,0xf8,0x03,
+0x0d,0xd1,0x00,0x00,0x5f,0x36,0xf1,0x04,0xf3,0x19,0x10,0x00,0x00,0x02,0x04,0xc0,
+0x03,0xe2,0x77,0x06,0x94,0x57,0x77,0x77,0x77,0x88,0x50,0x00,0x00,0x02,0x15,0x03,
+0x23,0x03,0xf6,0x5f,0x02,0x0f,0x09,0x00,0x09,0xa4,0xf8,0x22,0x22,0x22,0x3a,0xf0,
+0x00,0x00,0x01,0xef,0x6c,0x0d,0x60,0x02,0x22,0x22,0x22,0x11,0x00,0x13,0x00,0x01,
+0x00,0xf0,0x0b,0x10,0x00,0x00,0x02,0x20,0x00,0x07,0xb0,0x06,0xf1,0x00,0x00,0x0c,
+0xd0,0x00,0x0a,0xe0,0x06,0xf2,0x00,0x00,0x0d,0xc0,0x00,0x09,0xf0,0x09,0x00,0x23,
+0x0f,0xb0,0x09,0x00,0xf2,0x0e,0x3f,0x70,0x00,0x09,0xf0,0x05,0xf2,0x00,0x00,0x8f,
+0x70,0x00,0x09,0xfe,0xef,0xf2,0x00,0x00,0xff,0xf2,0x00,0x09,0xf7,0x7a,0xf2,0x00,
+0x09,0xf3,0xdc,0x1b,0x00,0x40,0x3f,0x90,0x2f,0xa0,0x09,0x00,0xf0,0x04,0x02,0xed,
+0x00,0x05,0xf8,0x09,0xe0,0x06,0xf2,0x0d,0xd1,0x00,0x00,0x6f,0x19,0xe0,0x06,0xf2,
+0x19,0x65,0x00,0x43,0x08,0xc0,0x06,0xf1,0x74,0x00,0x21,0x03,0xc0,0x06,0x00,0x21,
+0x55,0x41,0x0e,0x00,0x50,0x06,0xdf,0xff,0xff,0xc3,0x09,0x00,0xf1,0x0e,0x8f,0xb4,
+0x10,0x16,0xef,0x20,0x00,0x00,0x01,0xfb,0x00,0x00,0x00,0x1f,0xa0,0x00,0x00,0x04,
+0xf5,0x00,0x00,0x00,0x0b,0xc0,0x00,0x00,0x03,0xf6,0x00,0x95,0x00,0xf0,0x01,0x00,
+0x00,0xee,0x20,0x00,0x00,0x7f,0x70,0x00,0x00,0x00,0x4f,0xfa,0x77,0x9d,0xfa,0x36,
+0x00,0x57,0x01,0x7c,0xdd,0xb9,0x30,0xce,0x00,0x70,0x00,0x00,0x25,0x00,0x00,0x00,
+0x9e,0x09,0x00,0x60,0x08,0xf0,0x00,0x00,0x09,0xe0,0x0a,0x00,0x14,0xae,0x13,0x00,
+0xb0,0x0c,0xc0,0x00,0x00,0x08,0xfa,0xaa,0x50,0x00,0x01,0xf8,0x72,0x00,0x62,0xcc,
+0xc6,0x00,0x00,0x8f,0xc0,0x2a,0x00,0xe1,0x00,0x1f,0xef,0x80,0x00,0x00,0x8f,0x00,
+0x00,0x00,0x0a,0xf3,0x9f,0x50,0x13,0x00,0xf0,0x05,0x05,0xf8,0x00,0xaf,0x30,0x00,
+0x8f,0x55,0x52,0x03,0xfb,0x00,0x00,0xaf,0x30,0x08,0xff,0xff,0x83,0xfc,0x4e,0x00,
+0x00,0x26,0x00,0x10,0x79,0x4f,0x00,0x34,0x20,0x08,0xf0,0x7b,0x00,0x12,0x9e,0x07,
+0x00,0x22,0x3e,0x20,0x72,0x00,0x52,0x00,0x08,0xf2,0x00,0x47,0x13,0x00,0x14,0xdf,
+0x23,0x00,0x23,0x7f,0xf9,0x09,0x00,0x32,0x3f,0xda,0xfa,0x09,0x00,0x41,0x4f,0xe2,
+0x08,0xfc,0xb4,0x00,0xf0,0x05,0x6f,0xe2,0x00,0x05,0xfd,0x20,0x00,0x00,0x00,0x9f,
+0xb1,0x00,0x00,0x02,0xdf,0x30,0x00,0x00,0x0a,0x50,0x18,0x00,0x24,0x85,0x00,0x01,
+0x00,0x40,0x12,0x00,0x00,0x01,0xe8,0x00,0x52,0x8d,0x00,0x00,0x08,0xe0,0x70,0x00,
+0x01,0x6a,0x00,0x52,0x8e,0x00,0x00,0x0a,0xd0,0x08,0x00,0x22,0x0c,0xc0,0x08,0x00,
+0x22,0x0e,0xa0,0x08,0x00,0x22,0x1f,0xc0,0x28,0x00,0xf0,0x04,0x5f,0xf3,0x04,0xff,
+0xff,0xfe,0x00,0x00,0xaf,0xf9,0x00,0x56,0x66,0xbe,0x00,0x00,0xfa,0x8f,0x10,0x20,
+0x00,0x31,0x07,0xf3,0x1f,0xf1,0x00,0x40,0x0e,0xc0,0x09,0xf1,0x08,0x00,0xf3,0x10,
+0x7f,0x30,0x01,0xf9,0x00,0x00,0x8f,0x02,0xf8,0x00,0x00,0x8f,0x20,0x00,0x8e,0x0b,
+0xd0,0x00,0x00,0x0d,0xb0,0x00,0x8e,0x0b,0x30,0x00,0x00,0x02,0x70,0x00,0x8e,0x88,
+0x00,0x0f,0x08,0x00,0x0d,0x13,0x6b,0x08,0x00,0xd2,0x22,0x00,0x00,0x00,0x92,0x00,
+0x00,0x00,0xcb,0x00,0x00,0x02,0xf6,0x08,0x00,0x22,0x03,0xf5,0x08,0x00,0x22,0x05,
+0xf3,0x08,0x00,0xf0,0x0c,0x09,0xf0,0x00,0x24,0x44,0xdb,0x00,0x00,0x0e,0xf3,0x00,
+0xbf,0xff,0xfb,0x00,0x00,0x7f,0xed,0x00,0x01,0x11,0xcb,0x00,0x01,0xeb,0x3f,0xa0,
+0x20,0x00,0x40,0x0c,0xe2,0x05,0xf8,0x08,0x00,0xf0,0x02,0xaf,0x40,0x00,0x6f,0x70,
+0x00,0xcb,0x0a,0xf5,0x00,0x00,0x06,0xf3,0x00,0xcb,0x2c,0x30,0x79,0x01,0x23,0x00,
+0xca,0x68,0x00,0xf3,0x0a,0x32,0x00,0x00,0x02,0x22,0x22,0x22,0x22,0x20,0x00,0x00,
+0xcf,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,0x35,0x44,0x44,0x44,0x44,0xfa,0x20,0x00,
+0x1f,0xea,0x08,0x00,0x0c,0x13,0xe9,0x08,0x00,0x13,0x52,0x08,0x00,0x00,0x3e,0x02,
+0x21,0x09,0x40,0x9d,0x00,0x30,0x00,0x00,0xf8,0x92,0x01,0x52,0x00,0x00,0x00,0x0f,
+0x80,0x11,0x00,0x32,0x02,0xf7,0x00,0x23,0x02,0x22,0x6f,0x30,0x35,0x02,0xf2,0x04,
+0x0b,0xf3,0x00,0x8d,0xdd,0xef,0x00,0x00,0x03,0xff,0xd0,0x04,0x99,0x9c,0xf0,0x00,
+0x00,0xbf,0x5f,0x45,0x02,0x40,0x6f,0x70,0x8f,0x40,0x22,0x00,0xf0,0x01,0x2f,0xb0,
+0x00,0xbe,0x20,0x00,0x8f,0x00,0x2e,0xd1,0x00,0x00,0xcd,0x10,0x08,0xf0,0x15,0x03,
+0x74,0x01,0xc8,0x00,0x8f,0x00,0x50,0x00,0xa3,0x02,0x23,0x01,0x00,0x66,0x00,0x22,
+0xf8,0x00,0xdc,0x01,0x23,0x0f,0x80,0x8c,0x00,0x13,0xf8,0x08,0x00,0x04,0x11,0x00,
+0x14,0x01,0x11,0x00,0xa0,0x1f,0xb6,0x55,0x56,0x66,0x78,0x10,0x00,0x00,0xdf,0xf3,
+0x00,0x15,0xe3,0x25,0x02,0x07,0x07,0x03,0x90,0x5d,0x00,0x00,0x00,0x0e,0x80,0x00,
+0x00,0x07,0x76,0x03,0x13,0xf9,0x62,0x00,0x22,0x0e,0x90,0x48,0x03,0x00,0xf6,0x00,
+0xf1,0x05,0x02,0xfd,0x00,0x0b,0xcc,0xcf,0x90,0x00,0x00,0xaf,0xf7,0x00,0x9a,0xaa,
+0xf9,0x00,0x00,0x3f,0x88,0xf3,0x22,0x00,0x40,0x1e,0xd0,0x0b,0xe2,0x22,0x00,0xf0,
+0x02,0x0c,0xf2,0x00,0x1d,0xd1,0x00,0x0e,0x90,0x0b,0xf4,0x00,0x00,0x1e,0xc0,0x00,
+0xe9,0x07,0x68,0x00,0x11,0x17,0x44,0x00,0x01,0x01,0x00,0x90,0xa4,0x00,0x00,0x00,
+0x23,0x33,0x33,0x33,0x31,0x5d,0x00,0x00,0x88,0x00,0xa6,0xf7,0x00,0x00,0x01,0x55,
+0x54,0x44,0x44,0x3f,0x90,0x5c,0x01,0x73,0x02,0x88,0x89,0x99,0x99,0x9f,0x90,0x22,
+0x00,0x44,0xe4,0x00,0x00,0x09,0x06,0x04,0x32,0x9f,0x10,0x00,0x03,0x01,0xe7,0xff,
+0xee,0xff,0xff,0xff,0xf0,0x00,0x00,0x06,0x77,0x77,0x77,0x66,0x64,0xf0,0x02,0x73,
+0x00,0x09,0x20,0x00,0x00,0x0a,0xe0,0x41,0x02,0x00,0xc4,0x03,0x22,0x2f,0x50,0x11,
+0x00,0x23,0x05,0xf4,0x72,0x03,0x61,0x9f,0x00,0x02,0x44,0x4b,0xe0,0x43,0x02,0x10,
+0x9f,0xe3,0x02,0xc1,0x06,0xfe,0xd0,0x00,0x11,0x1a,0xe0,0x00,0x01,0xeb,0x2f,0xa0,
+0x22,0x00,0x40,0xbf,0x20,0x4f,0x80,0x29,0x03,0x02,0x45,0x02,0x40,0x9e,0x00,0xaf,
+0x50,0xbd,0x01,0x30,0x0a,0xe0,0x1c,0x46,0x02,0x11,0x21,0x55,0x00,0x01,0x85,0x00,
+0x01,0x93,0x04,0x30,0x57,0x76,0x40,0x07,0x00,0x50,0x07,0xff,0xfe,0xff,0xf7,0x08,
+0x00,0x40,0xfb,0x30,0x00,0x3b,0x7b,0x00,0x21,0xfc,0x00,0x1d,0x05,0x32,0x00,0x2f,
+0x60,0xff,0x01,0x20,0x02,0xf8,0x26,0x04,0x80,0xf0,0x00,0x00,0x0c,0xf3,0x00,0x00,
+0x06,0x6a,0x02,0x41,0x2e,0xfb,0x87,0x9d,0xca,0x03,0x45,0x07,0xbd,0xdc,0x94,0x89,
+0x01,0x00,0xe5,0x01,0x73,0x13,0x00,0x00,0x06,0xc0,0x05,0xf1,0xb9,0x03,0x00,0x04,
+0x05,0x10,0x9e,0xf7,0x01,0x00,0x09,0x00,0x14,0xad,0x09,0x00,0x14,0xbb,0x09,0x00,
+0x41,0xd9,0x00,0x00,0x07,0x09,0x00,0x13,0xf9,0x09,0x00,0x50,0x03,0xfe,0x02,0xef,
+0xff,0x09,0x00,0x50,0x07,0xff,0x40,0x66,0x6a,0x09,0x00,0x32,0x0c,0xbd,0xa0,0x1b,
+0x00,0x32,0x3f,0x57,0xf1,0x09,0x00,0x31,0xae,0x01,0xf8,0x09,0x00,0xe0,0x03,0xf6,
+0x00,0x9e,0x00,0x07,0xf0,0x05,0xf1,0x0c,0xc0,0x00,0x1f,0x60,0x09,0x00,0xe0,0x6f,
+0x20,0x00,0x09,0xe0,0x07,0xe0,0x05,0xf1,0x86,0x00,0x00,0x01,0x80,0x09,0x00,0x02,
+0xed,0x00,0x0e,0x09,0x00,0x10,0xd0,0xdc,0x05,0x00,0x72,0x01,0x04,0x09,0x00,0x34,
+0x05,0x80,0x03,0xa9,0x01,0x09,0x58,0x02,0x71,0x03,0x30,0x00,0x03,0xf2,0x04,0xf3,
+0x6d,0x04,0x41,0x05,0xf4,0x04,0xf4,0x50,0x02,0x11,0x04,0x09,0x00,0x22,0x0f,0xa0,
+0x09,0x00,0x00,0x2d,0x06,0x11,0x14,0x09,0x00,0xd0,0x7f,0x90,0x3f,0xff,0xf4,0x03,
+0xf4,0x00,0x00,0xef,0xf3,0x05,0x57,0x09,0x00,0x50,0x06,0xf5,0xdd,0x00,0x02,0x09,
+0x00,0x41,0x1f,0xb0,0x2f,0xa0,0x09,0x00,0x90,0xce,0x10,0x05,0xf8,0x02,0xf4,0x04,
+0xf4,0x0b,0x2f,0x00,0xd2,0x32,0xf4,0x04,0xf3,0x2d,0x30,0x00,0x00,0x04,0x12,0xf4,
+0x04,0xf3,0x73,0x00,0x20,0x30,0x01,0xee,0x05,0x10,0x11,0xe2,0x03,0x00,0x85,0x01,
+0x10,0xff,0x01,0x00,0x40,0xd0,0x00,0x00,0x03,0x68,0x02,0x14,0x4b,0x7d,0x05,0x1f,
+0x09,0x09,0x00,0x11,0x02,0x97,0x05,0x00,0xda,0x00,0x04,0xcf,0x00,0xa1,0x40,0x00,
+0x00,0x03,0x40,0x00,0x03,0xf2,0x03,0xf3,0xdf,0x01,0x32,0x05,0xf4,0x03,0xd8,0x00,
+0x11,0x04,0x09,0x00,0x23,0x0e,0xb0,0x09,0x00,0x41,0x2f,0x80,0x01,0x15,0xc6,0x00,
+0x23,0x6f,0x80,0xcf,0x00,0x40,0xdf,0xf1,0x04,0x46,0x1b,0x00,0x50,0x05,0xf8,0xeb,
+0x00,0x03,0x09,0x00,0x40,0x0e,0xd0,0x4f,0x70,0x09,0x00,0x00,0x25,0x06,0xe0,0xf5,
+0x02,0xf4,0x03,0xf3,0x09,0xf5,0x00,0x00,0xaf,0x12,0xf4,0x03,0xf3,0x33,0x02,0x42,
+0x08,0x22,0xf4,0x03,0xcf,0x00,0x41,0x02,0xf4,0x04,0xf2,0x48,0x01,0x01,0x09,0x00,
+0x00,0x94,0x00,0x41,0x02,0xf2,0x05,0xf2,0x4c,0x02,0x00,0xa2,0x01,0x03,0x09,0x00,
+0x2f,0x00,0x00,0x09,0x00,0x02,0x91,0xf6,0x55,0x55,0x56,0x77,0x81,0x00,0x00,0x06,
+0x05,0x01,0x10,0xe2,0x32,0x00,0x1b,0x11,0x9e,0x01,0x24,0x06,0x60,0xcf,0x00,0x01,
+0x9e,0x01,0x13,0xf3,0x9e,0x01,0x21,0x03,0xf3,0x9e,0x01,0x11,0x03,0x09,0x00,0x41,
+0x4f,0x70,0x06,0x79,0xc6,0x00,0xd0,0x9f,0xc0,0x2e,0xff,0xf4,0x02,0xf4,0x00,0x01,
+0xfd,0xf7,0x00,0x02,0x09,0x00,0x41,0x09,0xf2,0x9f,0x30,0x09,0x00,0x40,0x4f,0x80,
+0x0c,0xe2,0x09,0x00,0x50,0x02,0xec,0x00,0x01,0xdd,0xa7,0x01,0xa1,0x1e,0xd1,0x00,
+0x00,0x1c,0x42,0xf4,0x03,0xf3,0x18,0xb5,0x03,0xc4,0x70,0x01,0xb1,0x00,0x00,0x01,
+0x56,0x66,0x66,0x66,0x64,0x20,0x90,0x00,0x13,0xf0,0x78,0x04,0x05,0x12,0x07,0x01,
+0xdb,0x04,0x60,0x77,0x77,0x78,0x88,0x8c,0xf0,0x53,0x03,0x82,0xff,0xff,0xfe,0xee,
+0xa0,0x00,0x00,0x07,0x5f,0x02,0x07,0x09,0x00,0x41,0x06,0xff,0xee,0xee,0xb7,0x05,
+0x74,0x00,0x68,0x88,0x77,0x77,0x77,0x61,0xcf,0x00,0x13,0x30,0x9e,0x01,0x23,0x07,
+0xf0,0x9e,0x01,0x23,0x07,0xf1,0x9e,0x01,0x21,0x07,0xf1,0x9a,0x08,0x02,0x09,0x00,
+0x73,0x2f,0x80,0x04,0x57,0xf4,0x06,0xf1,0x6d,0x02,0x00,0x09,0x00,0x40,0xdf,0xf2,
+0x00,0x03,0x09,0x00,0x50,0x06,0xf6,0xdd,0x00,0x02,0x09,0x00,0x41,0x1e,0xc0,0x2f,
+0xa0,0x09,0x00,0x40,0xbf,0x20,0x05,0xf7,0x09,0x00,0x10,0x0a,0x6d,0x02,0xb1,0x22,
+0xf4,0x06,0xf1,0x2e,0x40,0x00,0x00,0x04,0x11,0xf2,0x24,0x05,0x00,0x89,0x05,0x12,
+0x06,0xbd,0x00,0x32,0x5f,0x20,0x00,0x9d,0x04,0x23,0xaf,0x10,0x79,0x05,0x13,0xfe,
+0x95,0x00,0x33,0x0b,0xff,0xc0,0xcc,0x07,0x41,0x95,0xfd,0x10,0x00,0x24,0x04,0x31,
+0x00,0x3e,0xe3,0x2b,0x00,0x80,0xb0,0x00,0x02,0xdf,0x50,0x00,0x00,0x0c,0x3a,0x04,
+0x00,0x61,0x00,0x20,0x06,0x20,0x17,0x00,0x13,0x42,0x39,0x00,0x62,0x24,0x00,0x00,
+0x00,0x1a,0x10,0x90,0x02,0x23,0x04,0xf4,0x8f,0x05,0x21,0x5f,0x30,0x11,0x00,0x00,
+0x0c,0x01,0x30,0x5c,0xcc,0xef,0x45,0x00,0x92,0x00,0x03,0x99,0x9d,0xf0,0x00,0x00,
+0x1f,0xe0,0x69,0x04,0x31,0x08,0xff,0x90,0x49,0x01,0xd0,0x01,0xeb,0x8f,0x40,0x14,
+0x44,0xaf,0x00,0x00,0xaf,0x20,0xce,0x17,0x6c,0x01,0xf0,0x01,0x6f,0x60,0x01,0xec,
+0x01,0x11,0x9f,0x00,0x5f,0x90,0x00,0x02,0xeb,0x00,0x08,0xf0,0x73,0x05,0x6f,0x03,
+0xe3,0x00,0x8f,0x01,0x40,0x57,0x06,0x07,0x1d,0x1f,0x46,0x06,0x0f,0x57,0x06,0x19,
+0x14,0x03,0x09,0x00,0x01,0x8d,0x05,0x02,0x27,0x01,0x14,0x50,0x5c,0x03,0x04,0xcc,
+0x01,0x33,0x01,0xff,0x40,0x0a,0x00,0x33,0xaf,0xfe,0x10,0x25,0x00,0x32,0xa4,0xfd,
+0x10,0xf5,0x08,0x22,0xd0,0x06,0xec,0x08,0x23,0x3e,0xd1,0xec,0x08,0x80,0x5f,0xc1,
+0x00,0x00,0x03,0xee,0x40,0x00,0xc6,0x00,0x41,0x01,0x00,0x01,0xae,0xd8,0x07,0x14,
+0x07,0xa8,0x03,0x01,0xbc,0x00,0x0a,0xc4,0x03,0x04,0x65,0x09,0x04,0xce,0x03,0x10,
+0x7e,0x3a,0x02,0x60,0xee,0xee,0xee,0xee,0x03,0x88,0x3b,0x02,0x44,0x88,0x88,0x88,
+0x60,0xc3,0x07,0x0a,0x42,0x00,0x14,0xdd,0xfc,0x03,0x13,0xff,0xb3,0x00,0x32,0x2e,
+0xdd,0xf4,0xcd,0x00,0x41,0xdf,0x21,0xdf,0x50,0xa7,0x00,0x30,0xe3,0x00,0x1b,0x26,
+0x07,0xf2,0x00,0x1b,0xfb,0x10,0x13,0x00,0x7f,0xd2,0x00,0x00,0x4b,0x40,0x00,0x8e,
+0x00,0x02,0xcc,0x05,0x00,0xf2,0x07,0x06,0x09,0x00,0xb2,0x17,0x77,0x77,0x77,0xcf,
+0x77,0x77,0x77,0x76,0x5f,0xff,0x01,0x00,0x2e,0xfc,0x00,0x01,0x00,0x10,0x07,0x97,
+0x00,0xb4,0xff,0xe1,0x00,0x00,0x03,0x88,0x88,0x88,0x88,0x7b,0xf3,0xed,0x02,0x0f,
+0x09,0x00,0x08,0x1c,0xf2,0x09,0x00,0x12,0x01,0xad,0x00,0x19,0x14,0x7e,0x00,0x00,
+0x01,0x00,0x14,0xbe,0x8b,0x01,0x04,0x65,0x01,0x33,0x0c,0xff,0xd1,0x77,0x01,0x12,
+0x64,0x6e,0x01,0x50,0x1b,0xf7,0x00,0x4e,0xe3,0x4c,0x00,0xf1,0x00,0xef,0x50,0x00,
+0x02,0xcf,0x80,0x00,0x00,0x5f,0xa1,0x00,0x7d,0x00,0x07,0xe6,0x17,0x02,0x0a,0xcf,
+0x00,0x05,0x09,0x00,0x13,0x5e,0x4e,0x01,0xb9,0xfd,0x28,0x88,0x88,0x87,0x77,0x78,
+0x88,0x88,0x85,0x00,0xca,0x06,0x02,0x07,0x02,0x13,0xf5,0x09,0x00,0x1e,0x04,0x09,
+0x00,0x14,0xf4,0x09,0x00,0xa0,0xfa,0x66,0x66,0x66,0x66,0x74,0x00,0x00,0x01,0xef,
+0x1f,0x01,0x1a,0xfa,0x1a,0x01,0x1d,0x37,0x9e,0x01,0x15,0xed,0x0a,0x04,0x13,0x60,
+0x20,0x0b,0x22,0xcc,0xf5,0x49,0x00,0x30,0xee,0x10,0xcf,0xff,0x05,0x00,0x91,0x01,
+0xfa,0x06,0x09,0xfb,0x10,0x00,0x00,0x2d,0xf9,0x00,0x36,0x00,0x5e,0xe3,0x00,0x00,
+0x39,0x20,0x00,0x8e,0x00,0x01,0x73,0xc6,0x00,0x1c,0x9f,0xc6,0x00,0x01,0x14,0x02,
+0x19,0x85,0xc6,0x02,0x22,0x67,0x64,0x09,0x02,0x41,0xef,0xfe,0xff,0xe6,0xf8,0x01,
+0x53,0xc3,0x00,0x03,0xcf,0x60,0x23,0x02,0x23,0x0c,0xd0,0x2c,0x09,0x01,0xc5,0x04,
+0x14,0xfa,0x7e,0x05,0x10,0xaf,0xa3,0x02,0x00,0x54,0x0b,0x23,0x1d,0xfc,0xe6,0x07,
+0x55,0x00,0x6a,0xcd,0xb9,0x50,0x11,0x03,0x12,0x40,0x04,0x00,0x22,0x09,0xe0,0x04,
+0x00,0x00,0x6c,0x03,0x22,0x0b,0xd0,0x45,0x00,0x20,0x0e,0xb0,0xc9,0x07,0x00,0xa6,
+0x04,0x02,0x08,0x00,0x21,0x9f,0xe1,0x08,0x00,0x31,0x02,0xfc,0xfa,0x08,0x00,0x40,
+0x0c,0xf1,0x6f,0x70,0x08,0x00,0xf0,0x02,0x9f,0x50,0x08,0xf5,0x00,0x07,0xf0,0x09,
+0xf7,0x00,0x00,0x9f,0x40,0x07,0xf0,0x7f,0x60,0x92,0x08,0x62,0x07,0xf0,0x32,0x00,
+0x0d,0x70,0x38,0x00,0x2f,0x0e,0x90,0x08,0x00,0x04,0x51,0x91,0x24,0x67,0x07,0xf0,
+0xf9,0x0a,0xa3,0xeb,0x07,0xf0,0x45,0x66,0x65,0x54,0x31,0x00,0x07,0x2f,0x03,0x0c,
+0x08,0x00,0x2e,0x05,0xe0,0xa8,0x02,0x00,0x65,0x01,0x15,0xf1,0xa0,0x0c,0x1c,0x20,
+0x74,0x06,0x14,0x02,0x92,0x01,0x43,0x00,0xcf,0xcf,0x40,0x2b,0x02,0x32,0x70,0xdf,
+0x40,0x09,0x00,0x21,0xa0,0x01,0x39,0x01,0x20,0x01,0xbf,0x44,0x0a,0x10,0x90,0xae,
+0x01,0x10,0x50,0x1a,0x0b,0x41,0xc0,0x00,0x00,0x36,0x21,0x00,0x1f,0x13,0x6e,0x00,
+0x01,0x50,0x06,0xee,0xed,0xdd,0xde,0xa3,0x01,0x73,0xf0,0x27,0x88,0x88,0x88,0xbf,
+0x87,0xf2,0x09,0x16,0x07,0x85,0x00,0x03,0xd3,0x02,0x0f,0x13,0x00,0x14,0x1e,0x06,
+0xd5,0x00,0x06,0x31,0x03,0x1f,0x9f,0x31,0x03,0x08,0x13,0xc0,0x31,0x03,0x13,0x65,
+0x31,0x03,0x3b,0xf8,0x00,0x4f,0x31,0x03,0x00,0x71,0x00,0x13,0xf6,0x48,0x05,0x08,
+0x01,0x00,0x22,0x27,0x77,0x01,0x00,0x28,0x86,0x5e,0x00,0x04,0x11,0x0f,0xa9,0x02,
+0x05,0x09,0x00,0x23,0x03,0xe2,0x09,0x00,0x22,0x05,0xf3,0x09,0x00,0x00,0xe9,0x03,
+0x2f,0x0f,0x50,0xfb,0x03,0x04,0x60,0xf9,0x66,0x66,0x66,0x67,0x73,0x47,0x0c,0x00,
+0x01,0x00,0xb0,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x00,
+0x00,0x00,0x00,0x49,0x00,0x01,0x00,0x14,0xaf,0x09,0x00,0x13,0xed,0x08,0x00,0x32,
+0x07,0xff,0x80,0x09,0x00,0x31,0x4f,0xba,0xf7,0x08,0x00,0xf0,0x03,0x05,0xfd,0x10,
+0xaf,0x90,0x00,0x00,0x00,0x01,0x9f,0xc1,0x00,0x08,0xfc,0x20,0x00,0x00,0x3e,0x18,
+0x00,0x60,0x4d,0xf4,0x00,0x00,0x27,0x10,0x20,0x00,0x25,0x52,0x00,0x01,0x00,0xf0,
+0x03,0x4d,0xdd,0xdd,0xdd,0xdd,0xee,0xee,0xee,0xec,0x29,0x99,0x88,0x88,0xbf,0x98,
+0x88,0x88,0x86,0x16,0x00,0x23,0x6f,0x10,0x1f,0x00,0x14,0x5f,0x28,0x00,0x14,0x03,
+0x09,0x00,0x24,0x4f,0x30,0x87,0x00,0x12,0x20,0x08,0x00,0x32,0x04,0xff,0xd1,0x09,
+0x00,0x41,0x3e,0xe6,0xfd,0x20,0x11,0x00,0x40,0xfe,0x20,0x3e,0xe4,0x09,0x00,0xf1,
+0x03,0x8f,0xd2,0x00,0x01,0xcf,0x80,0x00,0x00,0x0d,0xf8,0x00,0x00,0x00,0x08,0xfa,
+0x00,0x00,0x05,0x57,0x00,0x11,0x23,0x2e,0x00,0x24,0x01,0x00,0x63,0x00,0x04,0x51,
+0x00,0x2c,0x8f,0x20,0xe1,0x00,0x15,0xfd,0xe1,0x00,0x12,0x50,0x09,0x00,0x32,0x2f,
+0xbc,0xf3,0x09,0x00,0x31,0xcf,0x21,0xdf,0x37,0x00,0x50,0x0b,0xf4,0x00,0x1d,0xe3,
+0x4e,0x00,0x81,0xcf,0x50,0x00,0x01,0xdf,0x40,0x00,0x00,0x7a,0x00,0x51,0x0b,0xf7,
+0x00,0x00,0x47,0x6c,0x00,0x2f,0x44,0x00,0x01,0x00,0x08,0x21,0x04,0x44,0x01,0x00,
+0x42,0x55,0x53,0x5f,0xff,0x01,0x00,0x32,0xfc,0x02,0x22,0x01,0x00,0x01,0x8a,0x00,
+0x14,0x37,0x28,0x00,0x14,0xae,0x09,0x00,0x13,0xfc,0x08,0x00,0x32,0x08,0xff,0x70,
+0x09,0x00,0x32,0x6f,0xab,0xf7,0x11,0x00,0x40,0xfc,0x00,0xaf,0xa0,0x26,0x01,0xf1,
+0x03,0xcf,0xa0,0x00,0x06,0xfe,0x50,0x00,0x00,0x5f,0xd4,0x00,0x00,0x00,0x2a,0xf5,
+0x00,0x00,0x13,0x20,0x00,0x16,0x10,0x75,0x00,0xf6,0x03,0x8f,0xff,0xff,0xee,0xee,
+0xef,0xff,0xff,0xfd,0x15,0x55,0x66,0x66,0x66,0x66,0x55,0x55,0x42,0x1c,0x00,0x70,
+0x01,0x55,0x55,0x55,0x56,0x69,0x80,0x61,0x00,0x00,0x01,0x00,0xa3,0xf0,0x00,0x00,
+0x00,0x11,0x11,0x11,0x10,0x08,0xf0,0x78,0x00,0x00,0x09,0x00,0x32,0x04,0xee,0xef,
+0x1b,0x00,0xb4,0x07,0xf8,0x77,0x77,0x66,0x66,0x30,0x00,0x00,0x08,0xf1,0x27,0x01,
+0x13,0xf1,0x6c,0x00,0xf9,0x02,0x06,0xff,0xfe,0xee,0xff,0xff,0xf9,0x00,0x00,0x00,
+0x57,0x78,0x77,0x77,0x66,0x51,0x00,0xcf,0x00,0x0d,0x40,0x02,0x32,0x06,0xff,0x60,
+0x09,0x00,0x42,0x3f,0xcb,0xf6,0x00,0xc2,0x01,0x31,0x10,0xbf,0x70,0xad,0x00,0x80,
+0xd1,0x00,0x09,0xfb,0x10,0x00,0x00,0x2d,0xc2,0x01,0x51,0x5e,0xe3,0x00,0x00,0x39,
+0x1a,0x01,0x16,0x62,0xb3,0x00,0x30,0x02,0x21,0x10,0xb9,0x00,0x25,0x12,0x21,0x44,
+0x01,0x87,0x04,0x45,0x55,0x66,0x65,0x55,0x55,0x54,0xd8,0x00,0x20,0x03,0xc0,0x95,
+0x02,0x50,0xa0,0x00,0x00,0x06,0xf1,0xc6,0x00,0x13,0xe0,0xab,0x00,0x01,0x09,0x00,
+0x62,0xff,0xff,0xee,0xff,0xff,0xe0,0xcf,0x00,0x34,0x77,0x7b,0xf0,0x1b,0x00,0x17,
+0xf0,0x24,0x00,0x11,0x06,0x59,0x00,0x40,0xd0,0x00,0x00,0x00,0x33,0x01,0x2a,0x65,
+0x20,0xcf,0x00,0x2c,0x09,0xf0,0xd0,0x00,0x4a,0x00,0x6f,0xf7,0x00,0xd1,0x00,0x51,
+0x00,0x4e,0xe1,0x0b,0xf8,0x09,0x00,0x40,0x7f,0xd2,0x00,0x08,0xd2,0x00,0x8e,0x02,
+0xdf,0x90,0x00,0x00,0x04,0xef,0x40,0xd3,0x00,0x05,0xd4,0x00,0x43,0x11,0x21,0x07,
+0xff,0x01,0x00,0x40,0xf0,0x04,0x45,0x55,0x01,0x00,0x29,0x54,0x43,0x41,0x02,0x32,
+0x03,0x57,0x54,0x09,0x00,0x51,0x5e,0xff,0xef,0xfe,0x60,0xcd,0x02,0x40,0xc3,0x00,
+0x03,0xcf,0x0a,0x00,0x10,0x0d,0xaf,0x00,0x10,0xcd,0x13,0x00,0x13,0xf9,0xcf,0x00,
+0x34,0x00,0x0f,0xa0,0x7d,0x01,0x60,0xaf,0x40,0x00,0x00,0x5f,0xa0,0x64,0x00,0x51,
+0xdf,0xb8,0x78,0xcf,0xc1,0x43,0x00,0x46,0x6a,0xcd,0xca,0x50,0x82,0x00,0x30,0x10,
+0x00,0x00,0x0e,0x00,0xc2,0xe8,0x00,0x00,0x2f,0x50,0x00,0x00,0x0e,0x80,0x00,0x03,
+0xf5,0x0f,0x00,0x21,0x4f,0x40,0x0f,0x00,0x22,0x06,0xf2,0x0f,0x00,0x21,0x8f,0x10,
+0x0f,0x00,0x10,0x0a,0x17,0x03,0xd0,0xe9,0x00,0x00,0xff,0x90,0x00,0x00,0x0e,0x90,
+0x00,0x4f,0xef,0x10,0x0f,0x00,0x30,0x0a,0xf2,0xf8,0x0f,0x00,0x40,0x02,0xf9,0x0a,
+0xe0,0x0f,0x00,0xf0,0x0f,0x9f,0x10,0x2f,0x80,0x00,0x0e,0x90,0x2f,0x80,0x00,0x9f,
+0x10,0x00,0xe9,0x0c,0xd0,0x00,0x01,0xfa,0x00,0x0e,0x96,0xf3,0x00,0x00,0x06,0xf3,
+0x00,0xe9,0x86,0x40,0x02,0x32,0x20,0x0e,0x90,0x80,0x00,0x12,0xe9,0x07,0x00,0x0f,
+0x0f,0x00,0x04,0x13,0xc7,0xa6,0x00,0xa2,0x22,0x00,0x00,0x00,0x92,0x00,0x00,0x00,
+0xdb,0x00,0x9f,0x00,0x00,0x08,0x00,0x61,0xf4,0x00,0x00,0x00,0xdc,0x00,0xa0,0x00,
+0x00,0x08,0x00,0x22,0x0a,0xf0,0x08,0x00,0x10,0x1f,0xa1,0x00,0x51,0xcc,0x00,0x00,
+0x7f,0xfd,0x08,0x00,0x40,0x01,0xeb,0x3f,0x90,0x08,0x00,0x70,0x0b,0xf2,0x05,0xf7,
+0x00,0x00,0xcc,0x11,0x01,0xd0,0x7f,0x60,0x00,0xdb,0x0b,0xf5,0x00,0x00,0x07,0xf2,
+0x00,0xdb,0x2c,0xdc,0x03,0x33,0x30,0x00,0xdb,0x68,0x00,0x31,0x96,0x00,0x00,0x0a,
+0x03,0x00,0xf8,0x03,0x00,0x8e,0x01,0x40,0xf6,0x00,0x00,0x47,0x3c,0x03,0x13,0xfa,
+0x20,0x00,0x1f,0xea,0x08,0x00,0x0c,0x03,0xbf,0x00,0x05,0xe4,0x01,0x10,0x13,0x36,
+0x02,0x13,0x30,0x3a,0x02,0x00,0x17,0x02,0x62,0x9f,0x00,0x00,0x00,0x1f,0x70,0x11,
+0x00,0x20,0x03,0xf6,0xf8,0x02,0x00,0x45,0x02,0x12,0x30,0xb8,0x01,0x22,0x0b,0xf2,
+0x11,0x00,0x32,0x02,0xff,0xc0,0x11,0x00,0x31,0xaf,0x6f,0x80,0x11,0x00,0x40,0x4f,
+0x80,0x8f,0x40,0x11,0x00,0xf2,0x0a,0x1e,0xc0,0x00,0xbf,0x20,0x00,0x8f,0x00,0x1d,
+0xe2,0x00,0x00,0xce,0x20,0x08,0xf0,0x0d,0xd2,0x00,0x00,0x01,0xb9,0x00,0x8f,0x00,
+0xd0,0x01,0x05,0xbe,0x03,0x00,0x66,0x00,0x13,0xc6,0x11,0x00,0x20,0x0f,0x80,0xe6,
+0x01,0x03,0x7f,0x00,0x23,0x00,0x00,0x11,0x00,0x00,0x12,0x02,0x04,0x11,0x00,0xa0,
+0x1f,0xb6,0x55,0x56,0x66,0x78,0x10,0x00,0x00,0xdf,0xf3,0x00,0x1f,0xe3,0xc0,0x04,
+0x01,0x10,0x2d,0xc4,0x00,0x53,0xe0,0x00,0x00,0x04,0xf4,0x5e,0x00,0x13,0x5f,0xd5,
+0x00,0x23,0x09,0xf1,0x11,0x00,0x22,0xef,0x10,0x11,0x00,0x22,0x6f,0xfb,0xc4,0x00,
+0x31,0x0e,0xc5,0xf6,0x80,0x00,0x40,0x0a,0xf2,0x08,0xf4,0x11,0x00,0x20,0x06,0xf6,
+0x3b,0x02,0xc0,0x09,0xf0,0x07,0xf8,0x00,0x00,0x0b,0xe1,0x00,0x9f,0x04,0xf7,0x07,
+0x02,0x15,0x10,0x53,0x03,0x10,0x59,0xaf,0x05,0x40,0x33,0x33,0x33,0x31,0xb5,0x02,
+0x01,0xde,0x03,0x00,0xa5,0x04,0x56,0x54,0x44,0x44,0x3b,0xe0,0xd5,0x00,0x73,0x02,
+0x88,0x89,0x99,0x99,0x9d,0xe0,0x22,0x00,0x44,0xe8,0x00,0x00,0x0b,0x3f,0x00,0x14,
+0xbf,0xa3,0x03,0x40,0xfe,0xdd,0xee,0xef,0xb7,0x01,0x74,0x17,0x88,0x88,0x87,0x77,
+0x76,0x10,0xe6,0x02,0x00,0x7c,0x04,0x53,0x30,0x00,0x00,0x07,0xf0,0xa5,0x01,0x10,
+0x7f,0x09,0x01,0x12,0x90,0x11,0x00,0x23,0x02,0xf7,0x11,0x00,0x22,0x6f,0x40,0x11,
+0x00,0x22,0x0b,0xf6,0x11,0x00,0x32,0x03,0xff,0xe1,0x11,0x00,0x31,0xce,0x2e,0xc0,
+0x11,0x00,0x40,0x7f,0x50,0x3f,0xa0,0x11,0x00,0xf1,0x03,0x5f,0x80,0x00,0x4f,0x90,
+0x00,0x7f,0x00,0x5f,0x90,0x00,0x00,0x5f,0x60,0x07,0xf0,0x0d,0x70,0xa4,0x02,0x14,
+0x6f,0x2f,0x01,0x80,0x20,0x00,0x00,0x05,0x77,0x77,0x77,0x78,0xeb,0x02,0x01,0xd6,
+0x03,0x13,0xf2,0x77,0x01,0x22,0x6f,0x20,0x88,0x01,0x00,0xb5,0x02,0x13,0x1f,0x11,
+0x00,0x15,0x01,0x11,0x00,0x54,0xa2,0x22,0x22,0x23,0x8f,0x88,0x01,0x00,0xf7,0x00,
+0x00,0x21,0x06,0x05,0xd1,0x05,0x10,0x11,0xd1,0x01,0x93,0x20,0x00,0x00,0x0a,0xd0,
+0x00,0x00,0x02,0xf6,0x2d,0x06,0x40,0x3f,0x50,0x00,0x00,0x74,0x03,0x23,0x05,0xf4,
+0xf2,0x03,0x13,0x9f,0xa8,0x04,0x22,0x0e,0xf3,0x0d,0x00,0x31,0x06,0xff,0xd0,0xbb,
+0x01,0x20,0x01,0xec,0x08,0x03,0x70,0x9e,0x00,0x00,0xbf,0x20,0x5f,0x70,0x11,0x00,
+0x20,0x9f,0x50,0x09,0x03,0xf5,0x01,0x9e,0x00,0x9f,0x60,0x00,0x00,0x8f,0x30,0x0a,
+0xe0,0x2e,0x40,0x00,0x00,0x00,0x41,0x82,0x06,0x20,0x08,0xc0,0x06,0x00,0x31,0x47,
+0x76,0x40,0xb7,0x05,0x40,0xef,0xfe,0xff,0xf7,0x08,0x00,0x53,0xfc,0x30,0x00,0x3b,
+0xf6,0x00,0x05,0x23,0x0c,0xd0,0xc4,0x00,0x13,0x8f,0x7b,0x04,0x21,0x0a,0xf0,0x26,
+0x07,0x20,0x00,0x05,0x2e,0x03,0x60,0x1d,0xfb,0x87,0x9c,0xfc,0x10,0x34,0x00,0x35,
+0xbd,0xdc,0x95,0x48,0x02,0x11,0x81,0xf5,0x01,0x50,0x00,0x26,0x00,0x02,0xf5,0x81,
+0x01,0x32,0x60,0x00,0x7f,0xcb,0x00,0x61,0x1f,0x60,0x00,0x8f,0x00,0x01,0x0a,0x00,
+0x60,0x50,0x00,0x8e,0x00,0x01,0xf7,0xdb,0x00,0x32,0x40,0x00,0x9e,0x0a,0x00,0x41,
+0x4f,0x50,0x00,0xbe,0x0a,0x00,0x00,0x79,0x01,0x31,0xcf,0x00,0x00,0xb0,0x01,0x41,
+0xb0,0x00,0xef,0x30,0x0a,0x00,0xf0,0x0a,0x9f,0xe0,0x01,0xff,0x70,0x00,0xff,0xff,
+0xf3,0x00,0xdd,0xf2,0x04,0xfe,0xb0,0x00,0xfb,0x77,0x71,0x01,0xf7,0xf7,0x08,0xe6,
+0xf0,0x1e,0x00,0x60,0x05,0xf2,0xbc,0x0d,0x92,0xf4,0x0a,0x00,0x80,0x0b,0xc0,0x7f,
+0x5f,0x30,0xd9,0x00,0xf7,0x34,0x01,0x40,0x1f,0xfc,0x00,0x8e,0x0a,0x00,0x10,0xad,
+0xb0,0x00,0xd5,0x2f,0x40,0xf7,0x00,0x00,0x73,0x00,0x02,0x70,0x00,0x05,0x00,0xf7,
+0xaa,0x00,0x0e,0x0a,0x00,0x06,0x42,0x03,0x08,0x0a,0x00,0x14,0xc5,0x09,0x00,0x11,
+0x10,0x7f,0x02,0x41,0xd0,0x00,0x02,0xf4,0x2e,0x08,0x50,0xe0,0x00,0x04,0xf5,0x00,
+0x9e,0x05,0x10,0xc0,0xf5,0x04,0x00,0xed,0x00,0x41,0xe0,0x00,0x09,0xf5,0xb9,0x05,
+0x31,0xf3,0x00,0x0e,0x50,0x04,0xf1,0x12,0xbe,0xf9,0x00,0x4f,0xef,0x20,0x00,0x00,
+0x03,0xf7,0x8f,0x10,0xcf,0x2f,0xa0,0x00,0x00,0x0c,0xe0,0x1f,0x94,0xf8,0x07,0xf3,
+0x00,0x00,0x7f,0x40,0x06,0xfd,0xd0,0x00,0xcd,0x12,0x01,0x71,0xbe,0x20,0x00,0x1e,
+0x50,0x00,0x30,0xc7,0x08,0x1f,0x01,0x64,0x08,0x09,0x22,0x03,0x33,0x01,0x00,0x23,
+0x32,0x6f,0x4b,0x06,0x14,0xfe,0x12,0x00,0x13,0x31,0x05,0x03,0x14,0x40,0x2b,0x00,
+0x11,0x0a,0x54,0x03,0x23,0x34,0x10,0x0a,0x00,0x32,0x6e,0xff,0xf8,0x0a,0x00,0x51,
+0x04,0xfa,0x31,0x8f,0x60,0x0a,0x00,0x20,0x0c,0xd0,0x07,0x00,0x21,0x09,0xe0,0xae,
+0x04,0x21,0x04,0xf2,0x53,0x02,0x20,0x3f,0x30,0xb7,0x01,0x00,0x0a,0x00,0x20,0x5f,
+0x20,0x9b,0x00,0xf0,0x0b,0x09,0xf4,0x34,0x20,0x5f,0x20,0x00,0x00,0xf6,0x00,0x09,
+0xff,0xff,0xf0,0x4f,0x20,0x00,0x01,0xf5,0x00,0x09,0xe3,0x33,0x10,0x3f,0x40,0x28,
+0x04,0x00,0x4f,0x07,0x20,0x0f,0x70,0x5b,0x07,0x21,0x08,0xe0,0x5e,0x00,0x21,0x1e,
+0xb0,0x0a,0x00,0x51,0x02,0xed,0x77,0xdf,0x30,0x0a,0x00,0x42,0x00,0x2b,0xee,0xb3,
+0x77,0x07,0x03,0x73,0x02,0x06,0x0a,0x00,0x1f,0xf0,0x0a,0x00,0x13,0x2e,0x07,0xe0,
+0x07,0x01,0xf1,0x01,0x12,0x00,0x00,0x00,0x28,0xaa,0x50,0x00,0x00,0xbc,0x00,0x00,
+0x06,0xfe,0xac,0xfa,0x0d,0x06,0x20,0x1f,0xb0,0xdd,0x03,0x10,0xcc,0x70,0x03,0x00,
+0x5c,0x06,0x11,0xbc,0x0a,0x03,0x20,0x0b,0xb0,0x09,0x00,0x11,0xad,0x52,0x03,0xf0,
+0x14,0xbe,0x88,0x85,0x9e,0x00,0x00,0x0a,0xc0,0x00,0xbf,0xff,0xfa,0x7f,0x10,0x00,
+0x0c,0xa0,0x00,0xbd,0x00,0x00,0x3f,0x70,0x00,0x2f,0x60,0x00,0xac,0x00,0x00,0x0a,
+0xf9,0x67,0xed,0x00,0x09,0x00,0x42,0x00,0x8e,0xff,0xa1,0x09,0x00,0x01,0x01,0x00,
+0x05,0x09,0x00,0x10,0x34,0x5f,0x01,0x04,0xcf,0x09,0x10,0xbf,0x7d,0x01,0x00,0x22,
+0x02,0x10,0x35,0xf4,0x09,0x2b,0xfa,0x00,0x24,0x06,0x0f,0x09,0x00,0x09,0x14,0xf9,
+0x09,0x00,0x14,0x63,0x09,0x00,0x10,0x15,0x5a,0x00,0x12,0x43,0x29,0x0b,0x41,0x01,
+0xbf,0xff,0xe3,0x09,0x00,0x50,0x0b,0xf4,0x02,0xce,0x10,0x09,0x00,0x80,0x3f,0x60,
+0x00,0x2f,0x70,0x00,0x6f,0x10,0x9e,0x07,0x20,0x0d,0xa0,0x09,0x00,0x11,0xae,0xc6,
+0x00,0x01,0x09,0x00,0x00,0x8e,0x02,0xe0,0x6f,0x43,0x31,0x9f,0x00,0x00,0x0a,0xb0,
+0x00,0x6f,0xff,0xfd,0x6f,0x30,0xfc,0x00,0x31,0x6f,0x64,0x42,0x0e,0x01,0x00,0x0b,
+0x01,0x42,0x07,0xfc,0x9b,0xfa,0x83,0x0b,0x37,0x5b,0xdc,0x70,0x8c,0x0b,0x09,0x09,
+0x00,0x20,0x0a,0x50,0x09,0x00,0x03,0x30,0x05,0x27,0x00,0x27,0x42,0x06,0x06,0x09,
+0x00,0x15,0x1f,0x09,0x00,0x50,0xc6,0x55,0x55,0x55,0x66,0xf8,0x02,0x01,0x83,0x02,
+0x13,0x30,0x58,0x0a,0x05,0x9e,0x01,0x10,0x16,0xa9,0x02,0x22,0x9c,0xb6,0x73,0x09,
+0x41,0x06,0xfc,0x8a,0xfa,0x58,0x05,0x51,0x01,0xfb,0x00,0x06,0xf4,0x6a,0x05,0x02,
+0xa0,0x01,0x21,0x7f,0x10,0x67,0x02,0x11,0xbb,0xc6,0x09,0x11,0xae,0xa1,0x01,0x50,
+0x6f,0xff,0xfe,0x09,0xe0,0x72,0x01,0x54,0x06,0xf9,0x88,0x60,0x7f,0xee,0x00,0x70,
+0x03,0xf8,0x00,0x04,0xf6,0x00,0x06,0x79,0x04,0x32,0xf8,0x57,0xfd,0xc6,0x05,0x72,
+0x09,0xff,0xfb,0x10,0x00,0x04,0xa0,0x94,0x03,0x33,0x02,0x54,0x32,0x7a,0x00,0x37,
+0x7e,0xff,0xf4,0xdb,0x0c,0x00,0x60,0x00,0x11,0x2f,0xeb,0x09,0x00,0x0a,0x02,0x42,
+0x33,0x35,0x43,0x32,0xe1,0x06,0x41,0x4e,0xff,0xb0,0x00,0x13,0x00,0x41,0x0e,0xb2,
+0x4f,0x70,0x13,0x00,0x40,0x03,0xf3,0x00,0xab,0x66,0x04,0x61,0x55,0x75,0x2f,0x30,
+0x0a,0xb0,0xf2,0x0a,0x42,0x90,0xdb,0x36,0xf7,0x5f,0x00,0x3e,0x03,0xcf,0xf9,0x82,
+0x02,0x01,0xb3,0x01,0x23,0x7a,0x94,0xe4,0x00,0x40,0xff,0xbc,0xf9,0x00,0xd1,0x00,
+0x12,0x03,0xe4,0x00,0x11,0xf1,0x4a,0x09,0x20,0x0e,0xa0,0x13,0x00,0xb1,0x0b,0xd0,
+0x00,0x00,0xbd,0x00,0x07,0xf6,0x55,0x40,0xbd,0xad,0x01,0x42,0x7f,0xff,0xff,0x29,
+0xe4,0x00,0x51,0xf3,0x22,0x10,0x6f,0x40,0xae,0x01,0x00,0x0f,0x06,0x30,0x63,0x4c,
+0xf2,0x0a,0x01,0x00,0x00,0x02,0x13,0xd4,0x9d,0x01,0x77,0x12,0x10,0x00,0x00,0x05,
+0xf0,0x00,0xdf,0x06,0x24,0x00,0x56,0xb2,0x0a,0x02,0x20,0x0b,0x12,0x00,0x7b,0x01,
+0x06,0xb4,0x0b,0x20,0x00,0x7f,0x39,0x00,0x64,0x67,0x88,0x88,0x88,0x8c,0xf1,0x26,
+0x00,0x23,0xea,0x00,0x3b,0x06,0x02,0x20,0x0d,0x24,0x50,0x00,0x69,0x0d,0x31,0xed,
+0xee,0xef,0xd6,0x0b,0x10,0x06,0x47,0x07,0x2d,0x77,0x20,0x5d,0x03,0x14,0x9e,0x5d,
 0x03,0x14,0xae,0x5d,0x03,0x14,0xae,0xbd,0x01,0x14,0x9e,0x5d,0x03,0x14,0x9e,0x5d,
-0x03,0x32,0x9f,0x77,0x74,0x5d,0x03,0x01,0x94,0x88,0x00,0x5d,0x03,0x14,0x9f,0x5d,
-0x03,0x14,0x8e,0x5d,0x03,0x14,0x8e,0x5d,0x03,0x05,0x87,0x48,0x19,0x7d,0xc6,0x0f,
-0x00,0x4f,0x07,0x13,0x84,0xde,0x32,0x24,0xfe,0xfe,0xde,0x3d,0x1f,0x9f,0x09,0x00,
-0x07,0x01,0xb8,0x88,0x54,0x72,0x22,0x22,0x23,0xae,0x1a,0x78,0x1d,0xfb,0x87,0x95,
-0x0f,0xcf,0x00,0x24,0x04,0x2c,0x04,0x02,0x94,0x88,0x0f,0xcf,0x00,0x14,0x14,0x25,
-0x67,0x50,0x14,0x02,0x8d,0x2b,0x14,0x6f,0x92,0x3e,0x01,0x70,0x88,0x58,0x52,0x11,
-0x11,0x12,0x8f,0xb1,0x51,0x64,0x4f,0x86,0x66,0x65,0x55,0xaf,0x2d,0x00,0x14,0x7f,
-0x09,0x00,0x14,0x8e,0xe3,0x33,0x10,0xfd,0x51,0x00,0x09,0x3e,0x4f,0x14,0x36,0xcf,
-0x00,0x14,0xae,0xcf,0x00,0x14,0x9e,0xcf,0x00,0x14,0x9e,0xcf,0x00,0x14,0x9f,0xcf,
-0x00,0x15,0x9f,0xcf,0x00,0x23,0xff,0xfb,0xcf,0x00,0x22,0x88,0x84,0xcf,0x00,0x14,
-0x9e,0xcf,0x00,0x14,0x9e,0xcf,0x00,0x14,0x9e,0xcf,0x00,0x0e,0x29,0x8a,0x19,0x47,
-0x71,0x6c,0x13,0x7f,0xb9,0x6c,0x62,0x07,0xfa,0x20,0x00,0x29,0xf8,0x60,0x9f,0x07,
-0xb9,0x6c,0x21,0x7f,0x10,0x49,0x17,0x02,0x12,0x00,0x52,0x08,0xf9,0x10,0x00,0x18,
-0x02,0xe1,0x04,0xb9,0x6c,0x18,0x01,0xb9,0x6c,0x1e,0x36,0x9e,0x01,0x0d,0xcf,0x00,
-0x1f,0x9e,0xcf,0x00,0x08,0x2f,0x77,0x74,0x9e,0x01,0x17,0x18,0x5a,0x6d,0x02,0x14,
-0x9f,0x9c,0x54,0x01,0x68,0xa8,0x13,0x65,0x04,0x0e,0x14,0x29,0x76,0x1e,0x14,0x6f,
-0x05,0x14,0x0a,0x09,0x00,0x73,0x12,0x9f,0x22,0x22,0x8f,0x34,0x20,0xee,0x33,0x00,
-0xc3,0x0b,0x18,0x23,0x72,0x87,0x00,0xfe,0x01,0x40,0x01,0x56,0x40,0x00,0xa1,0x51,
-0x40,0x04,0xff,0xef,0xd1,0x17,0x3d,0x50,0x40,0xed,0x10,0x2e,0xa0,0x17,0x3d,0x13,
-0x4f,0x17,0x3d,0xa0,0x47,0xf0,0x00,0x03,0xf3,0x07,0xf1,0x03,0xf4,0x8f,0xee,0x35,
-0x50,0x7f,0xff,0xff,0x48,0xf0,0x52,0x18,0x30,0xf7,0x79,0xf4,0xed,0x05,0x10,0x20,
-0x17,0x3d,0x40,0xf6,0x00,0x09,0xd0,0xc5,0x21,0x40,0x0b,0xf6,0x37,0xf6,0x17,0x3d,
-0x50,0x40,0x1a,0xff,0xf8,0x00,0x17,0x3d,0x01,0x4b,0x27,0x47,0x4c,0x00,0x2e,0x20,
-0x2e,0x53,0x04,0x4a,0x34,0x04,0xe5,0x0f,0x14,0x0f,0xb0,0x09,0x04,0x29,0x24,0x04,
-0xc1,0x09,0x15,0x01,0x11,0x00,0x13,0xa2,0x74,0x71,0x05,0xd1,0x8f,0x08,0x32,0x03,
-0x06,0x43,0x08,0x14,0x9e,0x42,0x08,0x01,0xce,0x24,0x11,0xef,0x21,0xb2,0x04,0x41,
-0x08,0x21,0x09,0xf0,0x91,0x0e,0x11,0xae,0x63,0x71,0x01,0x40,0x08,0x00,0x67,0x10,
-0x24,0xb3,0xf3,0x91,0x71,0x02,0x3f,0x08,0x21,0x08,0xf0,0xbe,0x26,0x03,0x6a,0x56,
-0x00,0x3e,0x08,0x00,0x13,0x00,0x12,0x03,0xc8,0x9d,0x14,0x8f,0x3d,0x08,0x00,0x65,
-0x9b,0x92,0xae,0x00,0x01,0xeb,0x00,0x00,0x7f,0x77,0x74,0x3c,0x08,0x01,0xb4,0x0b,
-0x3e,0xbe,0xeb,0x30,0x99,0x32,0x0f,0xac,0x32,0x16,0x1f,0x6f,0xb6,0x05,0x03,0x01,
-0x6e,0x02,0x22,0x6f,0x10,0x6e,0x02,0x00,0x09,0x00,0x03,0x2a,0x07,0x21,0x43,0x42,
-0x6e,0x02,0x00,0x45,0x07,0x02,0x6e,0x02,0x31,0x6f,0x53,0x31,0x6e,0x02,0x00,0x86,
-0x02,0x01,0x6e,0x02,0x00,0x09,0x00,0x02,0x6e,0x02,0x32,0x6f,0x42,0x20,0x6e,0x02,
-0x32,0x6f,0xff,0xfc,0x6e,0x02,0x32,0x6f,0x54,0x41,0x6e,0x02,0x06,0x57,0x07,0x05,
-0x4e,0xc1,0x02,0x1e,0x58,0x22,0x76,0x52,0x22,0x13,0x41,0xff,0xef,0xff,0xb1,0xb3,
-0xd6,0x44,0x40,0x00,0x16,0xfd,0xe7,0x18,0x23,0x6f,0x40,0x67,0x82,0x23,0x2f,0x60,
-0xe6,0x0e,0x20,0x5f,0x40,0x45,0x40,0x42,0x30,0x00,0x05,0xee,0x7f,0x40,0x33,0xde,
-0xff,0xc2,0x85,0x03,0x1b,0x52,0x97,0x27,0x01,0x9c,0x63,0x22,0x00,0x23,0x08,0x00,
-0x31,0x5e,0xff,0xf7,0xff,0xc1,0x30,0xfa,0x22,0x8f,0xb6,0x1b,0x02,0xe3,0x09,0x40,
-0x03,0xf2,0x1f,0x60,0x88,0x01,0x40,0x03,0xf2,0x4f,0x30,0xbc,0x0a,0x21,0x03,0xf2,
-0x9e,0x01,0x20,0x46,0x68,0x08,0x00,0x00,0x83,0x97,0x11,0xf2,0x9b,0x01,0x32,0x01,
-0x14,0xf2,0xd7,0x09,0x22,0x03,0xf2,0x98,0x01,0x40,0x03,0xf2,0x0a,0xd0,0xd3,0x09,
-0x20,0x03,0xf2,0x95,0x01,0x10,0x20,0x60,0x00,0x3f,0x2a,0xdd,0xa2,0xdc,0x2a,0x08,
-0x1f,0xf2,0x08,0x00,0x03,0x26,0x02,0xe1,0xc1,0x0a,0x21,0x66,0x20,0x91,0x27,0x11,
-0xbf,0x6e,0x3a,0x50,0xf2,0x08,0xf6,0x00,0x8f,0x34,0x9f,0x20,0x0f,0x90,0x16,0x22,
-0x10,0x05,0x27,0x26,0x00,0x5a,0xbb,0x11,0xf2,0x89,0x43,0x31,0x56,0x69,0xf2,0x58,
-0x43,0x40,0xff,0xff,0xf2,0x5f,0x12,0x02,0x00,0x92,0x52,0x10,0x70,0x91,0x01,0x61,
-0x06,0xf1,0x0d,0xe1,0x00,0x4f,0x0c,0x25,0x31,0xfe,0xab,0xfc,0x08,0x12,0x4f,0x18,
-0xba,0x60,0x00,0x92,0x52,0x48,0x41,0x00,0x16,0x99,0x50,0xaf,0x89,0x21,0xef,0xcb,
-0x70,0x00,0x22,0x0e,0xd1,0x5b,0x26,0x40,0x5f,0x50,0x00,0x0a,0x65,0x80,0x01,0x17,
-0x79,0x30,0x57,0x7a,0xf1,0xd4,0xbe,0x50,0xf1,0xbf,0xff,0xf1,0x5f,0xac,0x4a,0x00,
-0x09,0x30,0x30,0x80,0x00,0x0c,0xb0,0x00,0x51,0x0a,0xf8,0x34,0xaf,0x50,0x94,0x17,
-0x22,0xff,0xe6,0xa4,0x02,0x1a,0x22,0x67,0x5f,0x0f,0x92,0x52,0x43,0x12,0x40,0xb8,
-0x00,0x1f,0x06,0xb8,0x00,0x0c,0x1f,0x7b,0xb8,0x00,0x0c,0x22,0x06,0xf1,0xb8,0x00,
-0x22,0x06,0xf1,0xb8,0x00,0x17,0x06,0xcf,0x48,0x12,0x40,0x0c,0x0f,0x11,0x06,0x75,
-0xa0,0x02,0x70,0x81,0x00,0xb3,0x0b,0x31,0x07,0xf3,0x21,0x2e,0x4f,0x04,0xd0,0x00,
-0x10,0x06,0x66,0xa4,0x22,0x5a,0xf0,0x3b,0x00,0x16,0x07,0x08,0x00,0x14,0x05,0x48,
-0x05,0x17,0x45,0x0a,0x5e,0x00,0x25,0x8a,0x21,0x69,0x95,0xaa,0x52,0x01,0xb9,0x00,
-0x00,0x31,0x02,0x40,0xed,0x10,0x03,0xf8,0x56,0x04,0x02,0xba,0x00,0x21,0x05,0xf2,
-0x93,0x7a,0x44,0x15,0x77,0xaf,0x20,0xbb,0x00,0x10,0x05,0x15,0xc4,0x01,0x41,0x70,
-0x00,0xbc,0x00,0x00,0x33,0x00,0x41,0xaf,0x83,0x4a,0xf5,0x68,0x83,0x01,0xbd,0x00,
-0x23,0x05,0xf1,0x4a,0x38,0x26,0x5f,0x10,0x09,0x1b,0x52,0x53,0x00,0x03,0x50,0x01,
-0xe6,0x12,0x31,0x8c,0x00,0x4f,0xe7,0x12,0x43,0x08,0xc0,0x05,0xf0,0x11,0x00,0x03,
-0xcd,0x9f,0xc0,0xc0,0x0c,0xf5,0x00,0x00,0x0e,0xc7,0x77,0xcc,0x02,0xff,0xd0,0x27,
-0x13,0x41,0x0a,0xc0,0xae,0x5f,0x67,0x4b,0x50,0xac,0x4f,0x60,0xae,0x10,0x45,0x05,
-0xa5,0x9c,0xa0,0x01,0xe8,0x00,0x02,0x45,0x55,0x40,0x20,0xf4,0xad,0x00,0xbd,0x68,
-0x30,0x9c,0xc9,0x10,0xb3,0x00,0x50,0x04,0xfe,0x89,0xee,0x10,0x80,0x03,0x40,0xed,
-0x10,0x01,0xfa,0x57,0x11,0x11,0x4f,0x3f,0x05,0x21,0x05,0xf3,0x66,0x46,0x30,0x14,
-0x66,0x9f,0x2a,0x2f,0x10,0x04,0xe7,0x02,0x21,0x05,0xf3,0x41,0x04,0x42,0x5f,0x20,
-0x2f,0x80,0xe6,0x00,0x50,0x00,0xaf,0x40,0x06,0xf7,0x44,0x00,0x42,0x01,0xdf,0xee,
-0xfa,0x28,0x2c,0x27,0x58,0x74,0x25,0xab,0x2b,0x02,0x80,0x27,0x96,0x13,0xe7,0x1a,
-0xc2,0x22,0x2f,0x70,0x3f,0x4a,0x23,0x04,0xf4,0x00,0xdb,0x21,0xaf,0x80,0xab,0x7b,
-0x20,0x10,0x2f,0x45,0x50,0xf1,0x03,0x1e,0xb2,0xec,0x0c,0xe1,0xbf,0x40,0x00,0x0c,
-0xe1,0x03,0xfd,0xf4,0x00,0xbf,0x40,0x06,0xf3,0x67,0xa6,0x37,0x9c,0x00,0x11,0x47,
-0xa1,0x06,0xf4,0xac,0x60,0xe5,0x01,0xf4,0x00,0x01,0x32,0xc7,0x05,0xe1,0x2f,0x40,
-0x08,0xff,0xfc,0x10,0x00,0xf6,0x02,0xf4,0x05,0xf6,0x02,0xea,0x11,0x00,0x40,0xcc,
-0x00,0x06,0xf1,0x11,0x00,0x91,0x0f,0x70,0x00,0x2f,0x50,0x0f,0x60,0x2f,0x42,0x70,
-0x4a,0x20,0xf7,0x02,0x80,0x58,0xd0,0x0e,0xc8,0x8f,0x70,0x2f,0x43,0xf3,0x00,0x00,
-0xee,0xdd,0xf7,0x02,0xd6,0x3e,0x00,0x4d,0x59,0x60,0x2f,0x40,0xf6,0x00,0x01,0xf5,
-0x22,0x00,0xf1,0x0f,0x0c,0xa0,0x00,0x5f,0x20,0x0f,0x80,0x2f,0x40,0x7f,0x20,0x0b,
-0xc0,0x00,0xe8,0x02,0xf4,0x00,0xed,0x7b,0xf5,0x00,0x0e,0x80,0x2f,0x40,0x02,0xad,
-0xc5,0x00,0x11,0x00,0x02,0x0a,0x2a,0x03,0xb4,0xaf,0x24,0xe8,0x01,0x11,0x00,0x03,
-0xb2,0xaa,0x33,0xe7,0x01,0xf5,0x1e,0x19,0x03,0x11,0x00,0x1d,0x62,0xad,0x76,0x00,
-0xc3,0x06,0x00,0xb1,0x07,0x71,0xe5,0x03,0xf2,0x03,0xef,0xff,0xc1,0x45,0x3f,0x90,
-0xed,0x30,0x5f,0x90,0x00,0xf8,0x03,0xf3,0x5f,0xeb,0x79,0x41,0x0f,0x80,0x3f,0x38,
-0x3e,0x4f,0x41,0xf8,0x03,0xf4,0x9f,0x33,0x0b,0x40,0x80,0x2f,0x47,0xf0,0x7f,0x2d,
-0x70,0xf9,0x02,0xf4,0x6f,0x20,0x00,0x7e,0xe5,0x14,0x11,0x41,0x76,0xc3,0xf4,0x03,
-0xe9,0x02,0xf4,0x08,0xfa,0x8d,0xf2,0x00,0x0e,0x90,0x3f,0x40,0x06,0xcd,0xa3,0x00,
-0x00,0xe8,0x82,0x21,0x2f,0x00,0x07,0x89,0x3f,0x49,0x26,0x00,0x40,0x50,0x05,0x12,
-0x33,0x08,0x00,0x31,0x6e,0xff,0xf6,0xe3,0x55,0x30,0xfa,0x22,0x9f,0xcf,0x20,0x80,
-0x0d,0xc0,0x00,0x0c,0xc0,0x78,0x8a,0xf2,0xae,0x5f,0x30,0xf0,0xde,0xee,0xe8,0x05,
-0x22,0x04,0xf2,0xe8,0x05,0x27,0x03,0xf4,0x08,0x00,0x02,0x77,0x47,0x30,0x03,0xf2,
-0x3f,0x75,0x05,0x40,0x34,0x46,0xf2,0x0f,0x82,0x29,0xf0,0x01,0xff,0xff,0xf2,0x0b,
-0xd0,0x00,0x1f,0x90,0x22,0x25,0xf2,0x02,0xfc,0x77,0xee,0x10,0x60,0x00,0x3f,0x3a,
-0xdd,0x91,0xe8,0x05,0x1f,0x25,0x01,0xd1,0x28,0x11,0x40,0x17,0xaa,0x50,0x00,0xa2,
-0x41,0x40,0xee,0xac,0xfb,0x00,0x0f,0x4d,0xe0,0xe1,0x00,0x6f,0x50,0x67,0x7b,0xf0,
-0x3f,0x50,0x00,0x0e,0xb0,0xde,0xef,0x7a,0x95,0x20,0x0a,0xd0,0x6c,0xc3,0x03,0xef,
-0x63,0x21,0x6f,0x00,0x91,0x34,0xf1,0x06,0xf0,0x4f,0x40,0x00,0x0b,0xc1,0x88,0x8c,
-0xf0,0x0e,0xb0,0x00,0x2f,0x72,0xdd,0xde,0xf0,0x06,0xfb,0x67,0xed,0x44,0x01,0x3e,
-0x6d,0xff,0xa1,0x7c,0x1c,0x2d,0x01,0x40,0x77,0x4f,0x1f,0x01,0x77,0x4f,0x2a,0x50,
-0x30,0x00,0x05,0x87,0x20,0x70,0x00,0x50,0x02,0xdf,0xde,0xf7,0x00,0xb2,0x61,0x80,
-0xe2,0x00,0x8f,0x30,0x12,0x29,0xf0,0x3f,0x2b,0x4d,0xd2,0xff,0xff,0xf0,0x6f,0x10,
-0x00,0x0a,0xc0,0x23,0x39,0xf0,0x8f,0x00,0x9f,0x50,0x13,0x8f,0xc0,0x00,0x00,0xcd,
-0x0e,0x10,0xc0,0xdb,0xbf,0xf1,0x04,0x60,0x00,0x0e,0xa1,0xaa,0xad,0xf0,0x0d,0xe2,
-0x00,0x9f,0x41,0xbc,0xce,0xf0,0x03,0xef,0xef,0xf7,0xc0,0x00,0x12,0x16,0x58,0x00,
-0x0d,0xc5,0xaa,0x01,0xfe,0x56,0x13,0x08,0xe7,0x63,0x2e,0x03,0x70,0xf6,0x56,0x1f,
-0xf0,0xfe,0x56,0x01,0x1b,0xe2,0xa0,0x06,0x1f,0x80,0xa0,0x06,0x02,0x21,0x66,0x7a,
-0xe8,0x05,0x32,0xe1,0xef,0xff,0xe8,0x05,0x02,0xf0,0x05,0x10,0x05,0x08,0x00,0x08,
-0xe8,0x05,0x32,0xd2,0xde,0xee,0xe8,0x05,0x2f,0x78,0x8b,0xa0,0x06,0x5b,0x00,0xf1,
-0xb3,0x32,0x17,0xa9,0x50,0x1b,0xc1,0x14,0xbc,0x28,0x02,0x40,0x5f,0x60,0xde,0xff,
-0x48,0x01,0x31,0x0c,0xc0,0x67,0x98,0x06,0x10,0x08,0x6f,0x65,0x22,0x8f,0x00,0xe1,
-0x36,0x01,0x89,0x47,0x00,0x28,0x02,0xf1,0x04,0x50,0x00,0x0a,0xd2,0xde,0xef,0xf0,
-0x0e,0xc0,0x00,0x3f,0x61,0x89,0x9c,0xf0,0x05,0xfd,0x89,0xfc,0x88,0x00,0x27,0x4b,
-0xdc,0x33,0xa6,0x07,0x57,0x65,0x00,0x01,0xe6,0x01,0x06,0xd2,0x54,0x1c,0xfb,0x76,
-0x7c,0xfc,0x33,0x2f,0x13,0x90,0x90,0x1f,0x16,0xe0,0x1c,0x0b,0x13,0xfa,0x55,0xa8,
-0x01,0xd3,0x27,0x17,0x90,0x9e,0x1f,0x4b,0x6b,0xdd,0xc9,0x50,0x18,0x05,0x23,0xd6,
-0x02,0x18,0x05,0x40,0x70,0x3f,0x40,0x09,0x92,0x20,0x71,0xf7,0x03,0xf4,0x05,0xf6,
-0x03,0xf8,0x11,0x00,0x70,0xcc,0x00,0x08,0xf4,0x44,0xf7,0x03,0x18,0x05,0x11,0x4f,
-0xdd,0x43,0x10,0xf5,0x07,0x15,0x02,0x18,0x05,0x32,0x0f,0x60,0x0f,0x18,0x05,0x22,
-0xf6,0x00,0x18,0x05,0x40,0x1f,0x50,0x0f,0x80,0x18,0x05,0xa0,0x03,0xf8,0x66,0xf8,
-0x02,0xf4,0x0d,0x90,0x00,0x7f,0x87,0x04,0xe0,0x40,0x8f,0x10,0x0c,0xb0,0x00,0xf8,
-0x02,0xf4,0x01,0xec,0x7b,0xf4,0x00,0x22,0x00,0x40,0x02,0xbd,0xc4,0x00,0x11,0x00,
-0x03,0x9a,0x11,0x03,0x18,0x05,0x24,0xf8,0x01,0x11,0x00,0x03,0x07,0x05,0x1f,0xf8,
-0x18,0x05,0x0d,0x13,0x24,0xa6,0x06,0x14,0x1a,0x18,0x1e,0x41,0x1e,0xf7,0x21,0x28,
-0x3c,0x0f,0x00,0xca,0x17,0x02,0x0a,0x95,0x14,0xdc,0xa7,0x3e,0x24,0x0f,0xa0,0xf6,
-0x18,0x03,0xba,0xab,0x07,0xac,0x9b,0x01,0x1e,0xf4,0x11,0x7f,0x91,0x4c,0x31,0xee,
-0x62,0x24,0x27,0x1e,0x00,0xc6,0xd1,0x23,0xfe,0x70,0x1c,0x19,0x18,0x31,0xc3,0xa6,
-0x0f,0x06,0xa7,0x0b,0x13,0x27,0x02,0x23,0x23,0x75,0x06,0x4f,0xb1,0x02,0x33,0xe9,
-0x0e,0xae,0x87,0x22,0x8c,0xff,0xf6,0xf2,0x63,0x2e,0xfa,0x76,0x7c,0xf8,0x00,0x42,
-0xcb,0x01,0x8a,0xa3,0x14,0xfb,0x21,0x3f,0x14,0xf9,0x09,0x00,0x21,0xce,0x20,0x82,
-0xc0,0x00,0x95,0xd0,0x31,0x77,0x8c,0xf9,0x3f,0x00,0x4e,0x8b,0xff,0xda,0x40,0x25,
-0xa0,0x01,0xad,0x7b,0x20,0x11,0xae,0xd7,0x02,0x05,0x5c,0x15,0x40,0x15,0x55,0x55,
-0x54,0xd9,0x9c,0x17,0x53,0x7e,0x00,0x05,0x99,0x58,0x1d,0xeb,0x09,0x00,0x05,0xe2,
-0x13,0x15,0xfa,0x72,0x1e,0x12,0x76,0x82,0x1f,0x2e,0x00,0xbf,0xb3,0x22,0x33,0x04,
-0x66,0x52,0x82,0x5e,0x31,0xed,0xef,0xc2,0x8e,0x00,0x44,0x71,0x00,0x03,0xdd,0x3f,
-0x00,0x23,0x5f,0x30,0xb0,0x0d,0x01,0x3d,0x10,0x14,0xed,0x6b,0xa4,0x61,0x5f,0xd9,
-0x77,0x8c,0xfa,0x00,0x60,0x13,0x3e,0xff,0xda,0x50,0xa9,0x63,0x00,0xd4,0x4d,0x21,
-0xee,0xee,0xfe,0xee,0x12,0x15,0xcf,0x6c,0x08,0xbd,0x00,0x11,0x03,0x5c,0x68,0x14,
-0x70,0x23,0xb8,0x0e,0x1e,0x56,0x0f,0x7f,0xa0,0x1a,0x1a,0xfa,0x1e,0x56,0x13,0x22,
-0x97,0x61,0x32,0xaf,0xff,0xfe,0xe8,0xef,0x44,0xc5,0x22,0x38,0xfc,0x27,0x25,0x01,
-0x75,0x62,0x15,0xf9,0x16,0x3c,0x03,0x40,0x64,0x00,0x3d,0x33,0x31,0x03,0xdf,0x10,
-0x88,0x02,0x32,0xee,0xff,0xd4,0x43,0x11,0x2e,0xcf,0x63,0x36,0xac,0x0f,0x22,0x5a,
-0x0c,0x23,0x01,0x90,0x8d,0x0a,0x06,0x2a,0xbd,0x05,0x8a,0x70,0x0d,0x33,0xbd,0x0e,
-0xa5,0x70,0x0e,0x33,0xbd,0x07,0x5e,0x0d,0x23,0x03,0x42,0x1f,0x18,0x11,0x05,0xb8,
-0x0d,0x01,0xb5,0x18,0x32,0xb2,0x15,0xfb,0x0a,0x00,0x11,0xbe,0xa9,0x01,0x22,0xf7,
-0x00,0xb5,0x86,0x02,0xfc,0xb6,0x11,0xf7,0x43,0x1d,0x19,0xf8,0x0a,0x00,0x12,0xda,
-0xd3,0x79,0x01,0xc6,0x01,0x00,0x2f,0x1d,0xa1,0xfb,0x66,0x61,0x00,0x1d,0xf9,0x8c,
-0xf6,0x00,0x00,0x64,0xaf,0x30,0x8c,0xdb,0x40,0xa7,0x43,0x0a,0x79,0x18,0x04,0x93,
-0x83,0x02,0x15,0x19,0x0d,0x0a,0x00,0x43,0x24,0x68,0x60,0xf8,0x44,0x50,0x11,0xfd,
-0xda,0x86,0x20,0x55,0x55,0x86,0x3f,0x0f,0x77,0xbc,0x0b,0x1e,0xd7,0x4f,0x03,0x02,
-0x79,0x44,0x32,0x7b,0xdc,0x70,0x5e,0x00,0x41,0x0c,0xfa,0x8a,0xfa,0x0a,0x00,0x00,
-0xd5,0x03,0x12,0x4f,0x2b,0xbd,0x15,0xbc,0xc8,0x00,0x11,0xcb,0x3e,0xad,0x22,0xf8,
-0x00,0x16,0x34,0x02,0x14,0x00,0xa1,0x4f,0x92,0x02,0xbf,0x30,0x00,0xf9,0x22,0x10,
-0x00,0x8c,0xdb,0x02,0x3f,0xbd,0x30,0x17,0xf7,0x10,0x5a,0x40,0x04,0x8a,0x3e,0x12,
-0xf8,0xe5,0x25,0x32,0x13,0x57,0x30,0x6d,0xbc,0x00,0x43,0xd5,0x11,0xf8,0xee,0xad,
-0x2d,0x54,0x32,0xaa,0x00,0x15,0x31,0x0a,0x00,0x15,0xea,0x67,0x1d,0x05,0x5b,0x03,
-0x0f,0x0a,0x00,0x02,0x24,0xed,0x77,0x6d,0xbc,0x11,0xaf,0x3c,0x93,0x08,0x9d,0x37,
-0x22,0x14,0x30,0x83,0xc7,0x03,0x8f,0x55,0x31,0xbf,0x50,0x3b,0x3a,0x4a,0x10,0xf6,
-0x40,0x00,0x11,0x06,0x16,0x2d,0x00,0x0f,0xcc,0x01,0x9f,0xb2,0x03,0x08,0x00,0x31,
-0x7f,0x00,0x05,0x9e,0x32,0x90,0xad,0x00,0x05,0xf0,0x01,0xf9,0x00,0x02,0xf8,0x85,
-0x15,0x40,0x7f,0xc8,0x9f,0xd0,0x08,0x00,0x45,0x04,0xad,0xc8,0x10,0x95,0x15,0x00,
-0x08,0x00,0x00,0x17,0x1c,0x03,0x31,0x0c,0x09,0x08,0x00,0x00,0x44,0x25,0x31,0x06,
-0xf0,0xbf,0x44,0x25,0x31,0x06,0xf1,0x35,0x44,0x25,0x2e,0x06,0xf1,0xe1,0x3d,0x0e,
-0xca,0x93,0x02,0xa8,0x10,0x31,0x05,0xbd,0xc8,0xec,0x06,0xb0,0x0a,0xfb,0x89,0xed,
-0x10,0x00,0x7f,0x10,0x03,0xf6,0x00,0x92,0x2d,0x00,0xa4,0x90,0x00,0x8b,0x10,0x11,
-0x7f,0xc7,0x21,0x40,0x8d,0x00,0x07,0xf1,0x61,0x25,0x10,0x0b,0x11,0x00,0x51,0x01,
-0xec,0x30,0x18,0xf5,0xb7,0x0f,0x32,0xdf,0xff,0xf7,0x87,0x13,0x23,0x2f,0x90,0xde,
-0x03,0x14,0xf8,0x98,0x13,0x62,0x81,0x34,0x75,0x07,0xf1,0x2e,0x36,0x02,0x31,0x7f,
-0x10,0x56,0xc4,0xa4,0x08,0xac,0x93,0x01,0x0e,0x32,0x03,0x92,0x17,0x01,0x88,0x00,
-0x2b,0x0b,0xe0,0xee,0x24,0x05,0x11,0x00,0x11,0xbf,0xaf,0x24,0x04,0x26,0x7c,0x11,
-0xc0,0x8c,0x23,0x06,0x57,0x06,0x13,0xf8,0x57,0x06,0x34,0x31,0x28,0xfa,0x57,0x06,
-0x2a,0x08,0xf2,0x57,0x06,0x14,0x90,0x0d,0x19,0x14,0xfa,0x0e,0x20,0x14,0x0d,0x2a,
-0x48,0x01,0xb4,0x05,0x03,0x57,0x06,0x23,0x51,0x13,0x57,0x06,0x15,0xcf,0x57,0x06,
-0x25,0x14,0x42,0xc2,0xd1,0x2a,0x06,0x90,0xdf,0x83,0x24,0x08,0xf0,0xd7,0x09,0x03,
-0x13,0x00,0x40,0x27,0x77,0x7c,0xf7,0x03,0x00,0x38,0x76,0x07,0xff,0xfb,0x5b,0x04,
-0x74,0x1d,0x14,0x3b,0x02,0x07,0x51,0x3f,0xd5,0x22,0x37,0xfc,0xc6,0x25,0x14,0xe1,
-0x76,0x28,0x14,0xfa,0xb1,0x04,0x24,0x0f,0xa0,0x87,0x47,0x23,0xaf,0x30,0x67,0xd2,
-0x00,0x62,0xc4,0x12,0xdf,0xe1,0xa9,0x44,0xeb,0xdd,0xcc,0xf1,0x6b,0xd1,0x02,0xff,
-0x11,0x01,0xa4,0x10,0x00,0x01,0x77,0xaf,0x77,0xde,0x66,0x66,0xaf,0x77,0x78,0x60,
-0x4e,0xef,0x17,0xaf,0x08,0x00,0xec,0xf8,0x22,0xed,0xb7,0x0f,0x25,0x22,0xfa,0x76,
-0x24,0x60,0x23,0x0e,0xd1,0x70,0xfb,0x24,0x02,0xf7,0xec,0xb9,0x24,0x3f,0x60,0x2e,
-0x3b,0x23,0xfc,0x10,0xb3,0xfb,0x61,0x05,0xfe,0x97,0x78,0xbf,0xd1,0x1d,0x01,0x4c,
-0x9b,0xdd,0xca,0x60,0x16,0x27,0x22,0xbe,0xfe,0x4e,0xda,0x42,0x1c,0xfb,0x75,0x6c,
-0x76,0xf9,0x14,0xf4,0x57,0x2b,0x14,0xfa,0x86,0x01,0x01,0x05,0x00,0x14,0xe9,0x2b,
-0x20,0x23,0x0e,0x90,0xcf,0x15,0x02,0x90,0x2b,0x62,0x7f,0xa1,0x00,0x04,0xde,0x10,
-0x77,0x82,0x04,0xf3,0xd4,0x27,0x15,0x77,0xfa,0x47,0x0f,0x85,0x27,0x08,0x04,0x77,
-0x31,0x0f,0xb7,0x13,0x1d,0x06,0x8d,0xae,0x1f,0xd0,0x08,0x1d,0x07,0x41,0x6c,0xff,
-0xda,0x30,0x60,0xdd,0x44,0xfa,0x76,0x8e,0xf6,0x98,0x01,0x01,0x45,0x5f,0x14,0xfb,
-0xd0,0xa9,0x14,0xf9,0xdd,0x00,0x14,0xdd,0x69,0x5f,0x52,0x4f,0xd6,0x33,0x49,0xfb,
-0xa0,0x58,0x03,0xa4,0x06,0x02,0x64,0x19,0x0f,0x85,0x27,0x0d,0x19,0x0e,0xd0,0x72,
-0x33,0x00,0x01,0xe4,0x09,0x00,0x26,0x02,0xf6,0x09,0x00,0x2a,0x0d,0x70,0xba,0x92,
-0x14,0xf5,0x09,0x00,0x13,0xfb,0x85,0x27,0x02,0xb6,0x2a,0x1b,0xf9,0x03,0x08,0x13,
-0x53,0x01,0x26,0x31,0xed,0xef,0xd2,0x66,0x01,0x41,0x81,0x00,0x02,0xde,0x9e,0x44,
-0x04,0xfa,0x07,0x14,0xf9,0x00,0x4c,0x23,0xdd,0x10,0xc9,0x08,0x23,0x5f,0xe9,0x03,
-0x08,0x48,0x02,0x9c,0xde,0xdb,0xe2,0x39,0x0e,0x03,0x90,0x00,0xe1,0x7a,0x23,0x8f,
-0x21,0xc9,0x3b,0x14,0x8f,0x03,0x08,0x11,0xbf,0x84,0xb1,0x1f,0x07,0x03,0x08,0x07,
-0x24,0x05,0xef,0x65,0xb2,0x04,0x21,0x5e,0x0e,0x0d,0x74,0x1e,0x07,0x21,0x5e,0x52,
-0x01,0x8c,0xee,0xdb,0x60,0x50,0x7a,0x43,0x65,0x6a,0xfa,0x00,0x7d,0x09,0x28,0x7f,
-0x30,0x6e,0x02,0x05,0x95,0x01,0x24,0xde,0x10,0x95,0x01,0x33,0xe9,0x77,0x9c,0xd2,
-0x08,0x2b,0xde,0xda,0xcf,0x00,0x65,0x32,0x22,0x22,0x23,0x33,0x42,0x6d,0x46,0x00,
-0x0f,0x44,0x23,0x9f,0x43,0xb2,0x76,0x07,0xbf,0x1c,0x24,0x01,0x00,0xd5,0x25,0x13,
-0xe0,0xca,0xa8,0x14,0x6b,0x07,0xb3,0x1f,0x07,0x09,0x00,0x03,0x00,0x3f,0x45,0x28,
-0x49,0xf0,0x19,0xb3,0x25,0x23,0x44,0x0a,0x77,0x06,0xc9,0x08,0x23,0xff,0xa1,0xc9,
-0x08,0x21,0x26,0xed,0xcf,0x00,0x04,0x85,0x03,0x14,0xfa,0x17,0x1d,0x13,0xeb,0xcf,
-0x00,0x00,0x61,0x21,0x31,0x02,0xaf,0x30,0x40,0xdf,0x13,0xee,0x73,0xa7,0x19,0x35,
-0x31,0xbb,0x0f,0x1a,0x29,0x44,0x14,0x4e,0x1a,0x29,0x1f,0x02,0x1a,0x29,0x06,0x01,
-0x3f,0x10,0x40,0x03,0xad,0xc9,0x10,0x93,0x04,0x30,0x6f,0xc8,0x9e,0x1b,0x13,0x20,
-0x01,0xfa,0x58,0x04,0x40,0x05,0xf2,0x06,0xf2,0x81,0x1d,0x40,0x04,0xf2,0x08,0xf0,
-0xde,0x6d,0x11,0x04,0x16,0x31,0x10,0x8e,0xe0,0x50,0x10,0xf1,0xf6,0x07,0x00,0xc8,
-0x3b,0x00,0xd3,0x02,0x00,0xd9,0x3b,0x30,0xb8,0x9f,0xc0,0x08,0x00,0x35,0x05,0xbd,
-0xc7,0x5d,0x85,0x00,0x20,0x00,0x71,0x11,0x11,0x23,0x46,0x89,0x24,0xf2,0xe7,0x06,
-0x70,0xda,0x24,0xf2,0x24,0x44,0x4e,0xa2,0xcb,0x12,0x02,0x2b,0x03,0x02,0x08,0x00,
-0x31,0x09,0xee,0xee,0x08,0x00,0x39,0x04,0x88,0x8a,0x18,0x00,0x02,0xa9,0x4e,0x04,
-0x08,0x00,0x2e,0x07,0x30,0x13,0x41,0x03,0x07,0x07,0x01,0x1d,0x04,0x70,0x09,0xfb,
-0x89,0xfd,0x10,0x00,0x7f,0x13,0x96,0x20,0x01,0xf9,0xe3,0x09,0x12,0x8f,0xfb,0x1e,
-0x01,0xcc,0x0f,0x31,0x9e,0x00,0x06,0x67,0xb7,0x02,0x47,0xc1,0x30,0xed,0x40,0x29,
-0x58,0x3e,0x00,0x30,0x06,0x12,0xe5,0x87,0x17,0x21,0x14,0x30,0xb6,0x9b,0x81,0x22,
-0x22,0x23,0x46,0x8a,0x80,0x6f,0x06,0x4d,0x02,0x70,0xa5,0x06,0xf0,0x02,0x33,0x3a,
-0xe1,0x87,0x02,0x01,0x3b,0x0b,0x31,0x08,0x88,0x8b,0xd9,0x39,0x43,0x01,0xcd,0xdd,
-0xef,0x24,0x56,0x00,0x49,0x0a,0x13,0x26,0xcb,0x17,0x21,0x07,0xf2,0xe8,0x51,0x06,
-0xcf,0x2c,0x05,0x3d,0x96,0x2e,0x8f,0x97,0x36,0xc1,0x01,0xbb,0x00,0x10,0x3b,0xea,
-0xe7,0x00,0xad,0x37,0x30,0xc5,0x45,0xaf,0x5f,0xb9,0x11,0x08,0x9d,0x35,0x00,0x04,
-0x16,0x00,0x3d,0x10,0x00,0x67,0x08,0x41,0xf7,0x00,0x02,0xea,0xdd,0x00,0x41,0xff,
-0xee,0xfc,0x10,0x24,0x1f,0x23,0x57,0x63,0x0b,0x05,0x52,0x01,0x23,0x57,0x60,0x7f,
-0x9f,0x02,0x82,0xd7,0x07,0xf0,0x15,0x55,0x5b,0xf4,0x32,0x1b,0x05,0x52,0x9e,0x00,
-0x1d,0xdd,0xde,0x83,0x3a,0x33,0x67,0x88,0xbf,0x9c,0x1b,0x24,0x06,0xf0,0x72,0x62,
-0x07,0xd1,0xbb,0x01,0x31,0x62,0x17,0xbf,0x63,0x0d,0x13,0x4f,0x71,0x43,0x00,0x19,
-0x2c,0x01,0x6d,0x53,0x04,0x7f,0x64,0x14,0x05,0x76,0x12,0x18,0x05,0x76,0x12,0x00,
-0x34,0x28,0xd0,0x02,0x9b,0xb7,0x00,0x00,0xe6,0x01,0xf5,0x00,0x4f,0xe9,0xbf,0xc0,
-0xac,0x0e,0x90,0x00,0xdd,0x10,0x04,0xf5,0x00,0xf7,0x01,0xf4,0x21,0x06,0x10,0xd9,
-0x09,0x00,0x00,0xbe,0x01,0x10,0xab,0x09,0x00,0x00,0x1e,0x12,0x10,0xbb,0x09,0x00,
-0x00,0xd2,0x22,0x10,0xe8,0x09,0x00,0x51,0x00,0xbd,0x10,0x08,0xf2,0x09,0x00,0x41,
-0x2e,0xfd,0xef,0x70,0x09,0x00,0x64,0x00,0x58,0x72,0x00,0x00,0xf7,0x8e,0x0e,0x00,
-0x48,0x00,0xe0,0x44,0x44,0x56,0x8a,0xa0,0xf7,0x01,0xf4,0x0f,0xff,0xff,0xfe,0xda,
-0x60,0x1b,0x00,0x00,0x64,0x5b,0x02,0x24,0x00,0x16,0x1f,0x09,0x00,0x50,0x5e,0xdd,
-0xf7,0x01,0xf5,0x09,0x00,0x23,0x17,0x88,0x09,0x00,0x21,0x00,0x00,0x09,0x00,0x1d,
-0x2f,0x09,0x00,0x00,0xe1,0x37,0x16,0xa3,0x3f,0x86,0x06,0xef,0x15,0x22,0x03,0xad,
-0x54,0x09,0x40,0x6f,0xc8,0xaf,0xd0,0x86,0x47,0x12,0xfa,0x59,0x20,0x20,0x06,0xf2,
-0xd1,0x77,0x40,0x06,0xf1,0x08,0xf0,0x03,0x15,0x40,0x05,0xf1,0x08,0xe0,0x0e,0x03,
-0x30,0x05,0xf1,0x06,0x9f,0x20,0x00,0x9b,0x86,0x40,0xf7,0x00,0x02,0xf6,0x38,0x11,
-0x40,0x9f,0x95,0x8e,0xc0,0x08,0x00,0x45,0x07,0xdf,0xe9,0x10,0x47,0x83,0x06,0x08,
-0x00,0x90,0x46,0x66,0x67,0x78,0xab,0xdf,0x15,0xf1,0xae,0x87,0x8f,0x36,0x74,0x05,
-0xf1,0xf1,0x99,0x0f,0x08,0x00,0x11,0x22,0x06,0xf1,0x23,0x3a,0x05,0x9f,0x83,0x09,
-0x9a,0x06,0x43,0x6b,0xef,0xeb,0x40,0xcb,0x07,0x24,0x6b,0xf7,0xf5,0x29,0x27,0x9f,
-0x20,0x5c,0x05,0x02,0x49,0x4e,0x13,0xa0,0xc9,0x07,0x01,0x03,0xc2,0x15,0xec,0xba,
-0xb4,0x04,0xc8,0x07,0x00,0x17,0x39,0x1f,0xd2,0xc7,0x07,0x0a,0x07,0x60,0x9c,0x71,
-0x8e,0xe8,0x87,0x77,0xfb,0x66,0x63,0x7f,0x08,0x02,0xfe,0x08,0x0f,0x09,0x00,0x1a,
-0x5f,0x0a,0x80,0x00,0x00,0xd4,0xe8,0x06,0x06,0x02,0xeb,0x0e,0x14,0xeb,0xe9,0x04,
-0x09,0xe8,0x06,0x01,0xd8,0x00,0x1f,0x4f,0xe8,0x06,0x16,0x91,0xfc,0x00,0x11,0x24,
-0xf6,0x22,0x28,0xf2,0x11,0x09,0xac,0x02,0x56,0x0b,0x7e,0x03,0x78,0xfa,0x77,0x7b,
-0xfc,0xa0,0xeb,0x0e,0x0d,0xe8,0x06,0x14,0xf0,0xe8,0x06,0x1f,0x30,0xe8,0x06,0x13,
-0x00,0x59,0x05,0x15,0x20,0x3c,0x0a,0x12,0xe5,0x3c,0x0a,0x41,0xe6,0x21,0x3b,0xf6,
-0xfd,0x00,0x11,0xf1,0x8f,0xd9,0x03,0xb3,0x97,0x23,0x5f,0x30,0x32,0x06,0x02,0x85,
-0x53,0x14,0xf6,0x9b,0x08,0x01,0x89,0xb3,0x01,0xa0,0x02,0x01,0x1b,0xcf,0x02,0x80,
-0x6e,0x32,0x20,0x02,0xaf,0x03,0x46,0x06,0x75,0xe5,0x2f,0x46,0x64,0x04,0x9a,0x0e,
-0x13,0x44,0x01,0x00,0x24,0x20,0x7f,0xde,0x0a,0x02,0xed,0x44,0x38,0x23,0x33,0x33,
-0xae,0x80,0x02,0x37,0xfe,0x02,0x34,0x11,0x02,0x31,0x09,0x22,0xcf,0x20,0x31,0x09,
-0x14,0x01,0x7a,0x01,0x24,0x01,0xf8,0x7a,0x4c,0x14,0xed,0x3e,0x2f,0x51,0x5f,0xd6,
-0x33,0x5a,0xf9,0x73,0x01,0x13,0xbf,0x7a,0xf7,0x02,0x4f,0x21,0x07,0x31,0x09,0x30,
-0x76,0x66,0x65,0x95,0x66,0x2f,0x74,0x6f,0x0c,0xcc,0x08,0x2f,0x04,0xc0,0xf3,0xc7,
-0x06,0x1e,0x07,0xf0,0x9d,0x10,0xf8,0x31,0x09,0x17,0x70,0x3f,0x4e,0x0f,0x31,0x09,
-0x04,0x11,0xc2,0x2d,0x0a,0x31,0x91,0x00,0x03,0x31,0x09,0x18,0xec,0x31,0x09,0x14,
-0x2f,0x7b,0x33,0x11,0x7f,0x31,0x09,0x41,0xd7,0x44,0x6a,0xfb,0x3e,0x00,0x21,0xbe,
-0xff,0xb7,0xf1,0x0c,0xcf,0x4e,0x18,0x21,0xeb,0xc8,0x10,0x55,0x41,0x16,0x1b,0x32,
-0x87,0xc5,0x24,0x7a,0xa0,0x31,0x09,0x0e,0xc7,0xc8,0x08,0x3c,0x9c,0x20,0x08,0xf7,
-0x6e,0x3c,0x18,0x40,0xb0,0x38,0x05,0xea,0x00,0x01,0xb5,0x2a,0x03,0xb3,0xb1,0x3f,
-0x77,0x77,0x73,0x34,0x11,0x2f,0x00,0x6b,0x08,0x12,0xd3,0x34,0x11,0x2e,0x77,0x62,
-0xcc,0x03,0x0f,0x56,0x6b,0x11,0x12,0x01,0x59,0xea,0x02,0xe9,0xe0,0x10,0x06,0x7a,
-0x01,0x1f,0x6a,0x44,0x80,0x0c,0x00,0x6f,0x56,0x00,0x44,0x80,0x16,0x04,0x95,0xb4,
-0x0e,0x3a,0x09,0x0f,0xcf,0x00,0x0b,0x1f,0x1f,0xcf,0x00,0x1c,0x04,0x64,0x86,0x27,
-0x11,0x5f,0x98,0x13,0x01,0x01,0x00,0x19,0x53,0x1b,0x29,0x03,0x1c,0x02,0x00,0x68,
-0x3d,0x11,0xe5,0x1c,0x02,0x31,0xa3,0x00,0x04,0x56,0x34,0x13,0xfb,0x8e,0xd4,0x05,
-0x70,0xce,0x24,0x01,0xf8,0xc3,0x14,0x20,0xcf,0x30,0x81,0x3b,0x08,0xb3,0xd8,0x5e,
-0x01,0x7b,0xcd,0xc9,0x40,0x41,0x10,0x01,0xa7,0xe0,0x00,0x08,0x00,0x43,0xaf,0x61,
-0x2a,0xf4,0x03,0xa4,0x00,0xbe,0xc9,0x22,0x05,0xf2,0x41,0x10,0x11,0x07,0x41,0x10,
-0x13,0x05,0x49,0x10,0x10,0x05,0x59,0x10,0x00,0x44,0x06,0x10,0xf0,0x74,0x00,0x10,
-0xe9,0x11,0x10,0x60,0xaf,0x72,0x3c,0xf2,0x00,0x05,0xec,0x07,0x21,0xfd,0x30,0x21,
-0x10,0x26,0x02,0x20,0xde,0x25,0x0e,0x08,0x00,0x00,0x4c,0x06,0xae,0xac,0xef,0x16,
-0xf0,0xae,0xee,0xee,0xdd,0xb9,0x74,0x39,0x10,0x0a,0x08,0x00,0x05,0x34,0x06,0x17,
-0x30,0x61,0x60,0x01,0xd3,0x2f,0x21,0x01,0x33,0xb8,0x0c,0x20,0x08,0xff,0x47,0x32,
-0xa1,0xe9,0x08,0xf8,0x23,0xbf,0x30,0x00,0x0d,0x91,0xfa,0x7a,0x05,0x21,0xd9,0x5f,
-0xa8,0xc3,0x22,0x0d,0x97,0xee,0x29,0x21,0xd8,0x9e,0x96,0x04,0x31,0x0d,0x89,0xe0,
-0x86,0x24,0x21,0xd8,0x8f,0x9a,0x09,0x31,0x0d,0x87,0xf1,0xa7,0x0a,0x30,0xd8,0x4f,
-0x40,0x3c,0x01,0x31,0x0e,0x80,0xeb,0x9c,0xc1,0x60,0xe8,0x04,0xfb,0x78,0xee,0x10,
-0xa5,0x45,0x10,0xce,0x44,0xb8,0x03,0xe3,0xe8,0x03,0x6b,0x98,0x0c,0x0f,0x00,0x0b,
-0xf1,0x2f,0x1b,0xc8,0xbe,0x18,0x40,0x20,0x01,0x7a,0xa7,0xdb,0x0e,0x40,0x03,0xef,
-0xbb,0xfd,0x40,0x06,0x20,0xce,0x10,0x5e,0x01,0x31,0xcc,0x2f,0x60,0x17,0xd2,0x12,
-0xc5,0xd8,0x1d,0x21,0xcc,0x6f,0xc1,0x0a,0x22,0x0c,0xc5,0xa5,0x46,0x21,0xcc,0x3f,
-0x41,0x6a,0x31,0x0c,0xc0,0xfb,0x5e,0x13,0x50,0xcb,0x07,0xfb,0x66,0xcf,0x01,0x0a,
-0x20,0x06,0xdf,0xf1,0xb8,0x04,0xdd,0xb9,0x15,0xb0,0xce,0x41,0x03,0x02,0x4a,0x03,
-0xcd,0x41,0x09,0xfe,0x49,0x1a,0xea,0xe7,0x49,0x0b,0x0f,0x00,0x13,0xe9,0x62,0x01,
-0x1a,0x20,0xc3,0x20,0x22,0x08,0xe0,0xc3,0x20,0x22,0x09,0xf0,0xc3,0x20,0x22,0x08,
-0xf0,0xc3,0x20,0x01,0xc3,0x1a,0x01,0xcb,0x1a,0x02,0x4c,0x64,0x02,0x08,0x00,0x00,
-0x20,0xc5,0x23,0x5f,0x30,0xa4,0x4f,0x01,0xc3,0x20,0x22,0x08,0xf0,0xc3,0x20,0x22,
-0x08,0xf0,0xc3,0x20,0x22,0x08,0xe0,0xc3,0x20,0x0c,0xe0,0xc4,0x23,0x09,0xe0,0x84,
-0x4f,0x1f,0xe0,0x84,0x4f,0x2b,0x22,0x05,0x50,0x23,0x1a,0x22,0x0c,0xb0,0x23,0x1a,
-0x22,0x0c,0xb0,0x0b,0x20,0x22,0x0c,0xb0,0x51,0x1f,0x22,0x0b,0xb0,0x23,0x1a,0x22,
-0x0b,0xb0,0x23,0x1a,0x01,0x62,0xcf,0x00,0x4c,0x38,0x12,0xb0,0x4f,0x1f,0x22,0x0c,
-0xa0,0x0b,0x20,0x22,0x0c,0xa0,0x23,0x1a,0x00,0xfa,0x80,0x01,0x3c,0x3f,0x1a,0x90,
-0x84,0x4f,0x14,0x8a,0x84,0x4f,0x13,0x90,0x84,0x4f,0x15,0x90,0xfc,0x01,0x05,0x20,
-0xc5,0x10,0xf8,0x85,0x51,0x1d,0x10,0x8e,0x1b,0x02,0xb3,0x41,0x1a,0xf1,0x84,0x4f,
-0x13,0x01,0xc3,0x20,0x22,0x08,0xf0,0xb8,0x00,0x21,0x08,0xf0,0xb8,0x00,0x00,0x50,
-0x01,0x12,0x50,0x48,0x01,0x13,0x7f,0x13,0x1a,0x01,0xb8,0x00,0x00,0x18,0x00,0x13,
-0x20,0x68,0x01,0x10,0x80,0x8b,0x08,0x22,0x08,0xf0,0xb8,0x00,0x13,0x08,0xdb,0x1a,
-0x00,0x50,0x01,0x16,0x22,0xe4,0x50,0x00,0xf0,0x12,0x70,0x25,0x55,0x66,0x11,0x66,
-0x65,0x30,0x12,0x26,0x11,0x76,0x59,0x91,0x33,0x10,0x0f,0x80,0x07,0xc5,0x01,0x08,
-0x00,0x42,0x16,0x67,0x7f,0x80,0xbb,0x21,0x02,0x43,0x14,0x13,0x9e,0xb0,0x10,0x04,
-0x0e,0x46,0x41,0x8f,0xee,0xef,0xf3,0xe3,0x1b,0x34,0x78,0x77,0x50,0x39,0xd5,0x05,
+0x03,0x32,0x9f,0x77,0x74,0x5d,0x03,0x32,0x9f,0xff,0xfb,0x5d,0x03,0x14,0x9f,0x5d,
+0x03,0x14,0x8e,0x5d,0x03,0x14,0x8e,0x5d,0x03,0x14,0x8e,0x6c,0x00,0x18,0x7d,0x54,
+0x01,0x10,0x06,0x4f,0x07,0x10,0x84,0x16,0x06,0x00,0xd9,0x04,0x12,0xfe,0x15,0x06,
+0x02,0xee,0x06,0x0f,0x09,0x00,0x04,0x10,0x9e,0x09,0x00,0x50,0x72,0x22,0x22,0x23,
+0xae,0x97,0x02,0x00,0xed,0x00,0x22,0xfb,0x00,0x53,0x07,0x2f,0x21,0x10,0xcf,0x00,
+0x2c,0x24,0x88,0x85,0xcf,0x00,0x1f,0xfa,0xcf,0x00,0x17,0x10,0x25,0x58,0x01,0x04,
+0xad,0x01,0x23,0x3f,0x40,0x54,0x03,0x23,0x4f,0x40,0x7c,0x08,0x60,0x4f,0x52,0x11,
+0x11,0x12,0x8f,0x09,0x00,0x04,0xbe,0x01,0x64,0x4f,0x86,0x66,0x65,0x55,0xaf,0x2d,
+0x00,0x14,0x7f,0x09,0x00,0x13,0x8e,0x05,0x01,0x10,0xff,0xe0,0x0a,0x80,0x04,0x55,
+0x55,0x55,0x55,0x51,0x00,0x00,0x11,0x00,0x01,0x00,0xf0,0x0b,0x36,0x00,0x00,0x00,
+0x28,0xaa,0x50,0x00,0x00,0xae,0x00,0x00,0x06,0xfe,0xac,0xfa,0x00,0x00,0x9e,0x00,
+0x00,0x1f,0xb0,0x00,0x6f,0x40,0x09,0x00,0x71,0x6f,0x20,0x00,0x0e,0x90,0x00,0x9f,
+0x15,0x00,0x20,0x0b,0xb0,0x09,0x00,0xf0,0x08,0xad,0x00,0x00,0x0a,0xd0,0x00,0x9f,
+0xff,0xfb,0x9e,0x00,0x00,0x0a,0xc0,0x00,0x9f,0x88,0x84,0x7f,0x10,0x00,0x0c,0xa0,
+0x21,0x00,0x60,0x3f,0x70,0x00,0x2f,0x60,0x00,0x18,0x00,0x31,0xf9,0x67,0xed,0x33,
+0x00,0x42,0x00,0x8e,0xff,0xa1,0x09,0x00,0x01,0x01,0x00,0x05,0x09,0x00,0x11,0x47,
+0x06,0x00,0x31,0x46,0x76,0x40,0x08,0x00,0xf0,0x0d,0x7f,0xff,0xee,0xff,0x80,0x00,
+0x00,0x00,0x07,0xfa,0x20,0x00,0x29,0xf8,0x00,0x00,0x00,0x0e,0xc0,0x00,0x00,0x00,
+0xaf,0x00,0x00,0x00,0x0f,0x90,0x1f,0x00,0x53,0x10,0x00,0x00,0x0f,0xb0,0x12,0x00,
+0x60,0x08,0xf9,0x10,0x00,0x18,0xf9,0x36,0x00,0x50,0x9f,0xfe,0xde,0xff,0x90,0x09,
+0x00,0x14,0x01,0x48,0x00,0x09,0xcf,0x00,0x14,0x9e,0xcf,0x00,0x1d,0xae,0xcf,0x00,
+0x1f,0x9e,0xcf,0x00,0x08,0x22,0x77,0x74,0xcf,0x00,0x14,0x9f,0xcf,0x00,0x14,0x8e,
+0xcf,0x00,0x14,0x8e,0xcf,0x00,0x14,0x8e,0x6c,0x00,0x27,0x5a,0x00,0x01,0x00,0x20,
+0x9f,0xff,0x01,0x00,0x90,0x20,0x00,0x00,0x37,0x77,0x77,0x77,0x77,0x65,0x13,0x00,
+0x40,0x37,0x00,0x00,0x29,0x1c,0x00,0x00,0x32,0x00,0x11,0x6f,0x09,0x00,0x1c,0x8f,
+0x09,0x00,0xa1,0x12,0x9f,0x22,0x22,0x8f,0x34,0x20,0x00,0x00,0xef,0x3f,0x00,0x95,
+0xc0,0x00,0x00,0x23,0x33,0x33,0x33,0x32,0x21,0x57,0x00,0xf6,0x59,0x04,0x00,0x01,
+0x56,0x40,0x00,0x06,0xc0,0x04,0xf3,0x04,0xff,0xef,0xd1,0x00,0x8f,0x00,0x4f,0x40,
+0xed,0x10,0x2e,0xa0,0x08,0xf0,0x04,0xf4,0x4f,0x40,0x00,0x7f,0x00,0x7f,0x00,0x4f,
+0x47,0xf0,0x00,0x03,0xf3,0x07,0xf1,0x03,0xf4,0x8f,0x00,0x00,0x2f,0x40,0x7f,0xff,
+0xff,0x48,0xf0,0x00,0x02,0xf4,0x06,0xf7,0x79,0xf4,0x6f,0x10,0x00,0x3f,0x20,0x6f,
+0x10,0x3f,0x42,0xf6,0x00,0x09,0xd0,0x06,0xf1,0x03,0xf4,0x0b,0xf6,0x37,0xf6,0x00,
+0x6f,0x10,0x4f,0x40,0x1a,0xff,0xf8,0x00,0x06,0xf1,0x04,0xf3,0x00,0x01,0x20,0x00,
+0x00,0x4c,0x00,0x2e,0x20,0xc9,0x00,0x91,0x05,0x77,0x77,0x77,0x78,0x85,0x00,0x00,
+0x00,0x92,0x00,0x52,0xf0,0x00,0x00,0x0f,0x80,0xb1,0x00,0x20,0x00,0xf8,0x80,0x01,
+0x43,0xf0,0x00,0x00,0x1f,0x11,0x00,0x15,0x01,0x11,0x00,0x40,0xa2,0x22,0x22,0x23,
+0x9e,0x01,0x13,0xdf,0xc5,0x00,0x63,0x00,0x22,0x22,0x22,0x21,0x10,0x51,0x00,0x29,
+0x02,0x40,0x00,0x02,0xd0,0x34,0x10,0x00,0x00,0x09,0xe0,0x00,0x00,0x06,0xef,0xff,
+0x80,0x00,0x68,0x01,0xb1,0x04,0xfa,0x31,0x8f,0x60,0x00,0x09,0xf0,0x00,0x00,0xcd,
+0xae,0x01,0xf0,0x03,0x8f,0x88,0x85,0x1f,0x70,0x00,0x04,0xf2,0x00,0x08,0xff,0xff,
+0xb3,0xf3,0x00,0x00,0x2f,0x50,0x6d,0x00,0x50,0x5f,0x20,0x00,0x01,0xf6,0x6e,0x00,
+0x60,0x05,0xf2,0x00,0x00,0x0f,0x60,0x13,0x00,0x50,0x4f,0x20,0x00,0x01,0xf5,0x13,
+0x00,0x60,0x03,0xf4,0x00,0x00,0x4f,0x40,0x13,0x00,0x50,0x0f,0x70,0x00,0x07,0xf1,
+0x39,0x00,0xf4,0x0c,0xd0,0xae,0x00,0x01,0xeb,0x00,0x00,0x7f,0x77,0x74,0x02,0xed,
+0x77,0xdf,0x30,0x00,0x07,0xf0,0x00,0x00,0x02,0xbe,0xeb,0x30,0x00,0x00,0x7f,0x8e,
+0x00,0x24,0x07,0xf0,0x0a,0x00,0x0f,0x13,0x00,0x13,0x2d,0x6f,0x00,0x01,0x00,0x14,
+0x15,0x6e,0x02,0x23,0x6f,0x10,0x6e,0x02,0x23,0x6f,0x10,0x6e,0x02,0x32,0x6f,0x43,
+0x42,0x6e,0x02,0x32,0x6f,0xff,0xfd,0x6e,0x02,0x31,0x6f,0x53,0x31,0x6e,0x02,0x00,
+0x86,0x02,0x01,0x6e,0x02,0x00,0x09,0x00,0x02,0x6e,0x02,0x32,0x6f,0x42,0x20,0x6e,
+0x02,0x32,0x6f,0xff,0xfc,0x6e,0x02,0x32,0x6f,0x54,0x41,0x6e,0x02,0x2c,0x6f,0x10,
+0x7f,0x00,0x11,0x4c,0x06,0x00,0x31,0x35,0x76,0x52,0x08,0x00,0x50,0x4d,0xff,0xef,
+0xff,0xb1,0x66,0x01,0xc0,0xfd,0x40,0x00,0x16,0xfd,0x00,0x00,0x00,0x09,0xf2,0x00,
+0x00,0x81,0x00,0x50,0x00,0x0b,0xe0,0x00,0x00,0x54,0x00,0x20,0x00,0x0a,0xc3,0x00,
+0xa0,0x5f,0x40,0x00,0x00,0x04,0xfc,0x30,0x00,0x05,0xee,0x36,0x00,0x53,0x6e,0xff,
+0xde,0xff,0xc2,0x85,0x03,0x16,0x52,0xd0,0x00,0x12,0x30,0x07,0x00,0x52,0x03,0xf2,
+0x00,0x00,0x23,0x08,0x00,0x30,0x5e,0xff,0xf7,0x08,0x00,0xf0,0x03,0x04,0xfa,0x22,
+0x8f,0x60,0x00,0x03,0xf2,0x0c,0xd0,0x00,0x0a,0xe0,0x00,0x03,0xf2,0x1f,0x60,0x88,
+0x01,0xa1,0x03,0xf2,0x4f,0x30,0x00,0x02,0xf4,0x00,0x03,0xf2,0x9e,0x01,0x20,0x46,
+0x68,0x08,0x00,0x51,0x00,0xf6,0xcf,0xff,0xf2,0x9b,0x01,0x70,0x01,0x14,0xf2,0x3f,
+0x40,0x00,0x04,0x20,0x00,0x02,0x98,0x01,0xa0,0x03,0xf2,0x0a,0xd0,0x00,0x1e,0xb0,
+0x00,0x03,0xf2,0x95,0x01,0x10,0x20,0x60,0x00,0x73,0x2a,0xdd,0xa2,0x00,0x00,0x03,
+0xf3,0x78,0x00,0x0c,0x08,0x00,0x1f,0xf2,0x08,0x00,0x03,0x25,0x02,0xe1,0xb2,0x00,
+0xf1,0x1f,0x03,0x66,0x20,0x00,0x00,0x05,0xf1,0x00,0xbf,0xff,0xf8,0x00,0x00,0x06,
+0xf2,0x08,0xf6,0x00,0x8f,0x40,0x00,0x06,0xf2,0x0f,0x90,0x00,0x0d,0xb0,0x00,0x05,
+0xf2,0x4f,0x40,0x00,0x08,0xe0,0x00,0x05,0xf2,0x6f,0x20,0x00,0x06,0xf0,0x56,0x69,
+0x08,0x00,0x51,0xf2,0xff,0xff,0xf2,0x5f,0x12,0x02,0x40,0x05,0xf1,0x2f,0x70,0x91,
+0x01,0xf1,0x07,0x06,0xf1,0x0d,0xe1,0x00,0x4f,0x70,0x00,0x06,0xf1,0x03,0xfe,0xab,
+0xfc,0x00,0x00,0x06,0xf1,0x00,0x18,0xba,0x60,0x08,0x00,0x01,0x01,0x00,0x26,0x06,
+0xf0,0x08,0x00,0x13,0x97,0x08,0x00,0x10,0xeb,0x7d,0x00,0x43,0xb0,0x00,0x00,0xea,
+0x89,0x00,0x0c,0x08,0x00,0x90,0xed,0x65,0x55,0x66,0x67,0x82,0x00,0x00,0xbf,0x13,
+0x03,0x1a,0xe5,0x37,0x02,0xd1,0x02,0x70,0x00,0x16,0x99,0x50,0x00,0x00,0x07,0xf1,
+0x03,0xef,0xcb,0x70,0x00,0xa0,0x0e,0xd1,0x00,0x3f,0x80,0x00,0x06,0xf1,0x5f,0x50,
+0x60,0x01,0x90,0x06,0xf1,0x7f,0x10,0x00,0x07,0xf1,0x57,0x7a,0x08,0x00,0x70,0x05,
+0xf1,0xbf,0xff,0xf1,0x5f,0x20,0xb0,0x00,0x60,0x06,0xf1,0x2f,0x80,0x00,0x0c,0xb0,
+0x00,0x50,0x0a,0xf8,0x34,0xaf,0x50,0x13,0x00,0x32,0x9f,0xff,0xe6,0xa4,0x02,0x17,
+0x22,0xac,0x02,0xc4,0x01,0x40,0x00,0x01,0x56,0x66,0x66,0x66,0x7a,0x70,0x00,0x07,
+0xc6,0x03,0x52,0x11,0x11,0x11,0x10,0x09,0x20,0x00,0x00,0x33,0x03,0x11,0x04,0x71,
+0x04,0xb3,0xd0,0x00,0x07,0xf9,0x88,0x88,0x88,0x77,0x30,0x00,0x07,0xeb,0x00,0x02,
+0x08,0x00,0xf3,0x02,0x10,0x00,0x06,0xff,0xee,0xff,0xff,0xff,0xf6,0x00,0x00,0x57,
+0x77,0x77,0x76,0x66,0x60,0xb9,0x00,0x12,0x40,0xb8,0x00,0x1f,0x06,0xb8,0x00,0x0c,
+0x1f,0x7b,0xb8,0x00,0x0c,0x22,0x06,0xf1,0xb8,0x00,0x00,0x60,0x01,0x16,0x22,0x60,
+0x01,0x00,0x18,0x01,0x11,0x00,0x2d,0x04,0x12,0x20,0x7b,0x01,0x22,0x06,0xe0,0x08,
+0x00,0xa5,0x07,0xe0,0x00,0x07,0xf3,0x21,0x11,0x11,0x28,0xf0,0xd0,0x00,0x72,0x06,
+0xf6,0x66,0x66,0x55,0x5a,0xf0,0x3b,0x00,0x16,0x07,0x08,0x00,0x14,0x05,0x48,0x05,
+0x65,0x45,0x55,0x55,0x55,0x55,0x10,0xb8,0x00,0x30,0x01,0x69,0x95,0x05,0x03,0x11,
+0x10,0xb9,0x00,0x00,0x31,0x02,0x40,0xed,0x10,0x03,0xf8,0x56,0x04,0x02,0xba,0x00,
+0x20,0x05,0xf2,0xf9,0x00,0x54,0x7f,0x15,0x77,0xaf,0x20,0xbb,0x00,0x00,0x68,0x04,
+0x10,0x7f,0x33,0x00,0x01,0xbc,0x00,0x00,0x33,0x00,0x40,0xaf,0x83,0x4a,0xf5,0x11,
+0x00,0x01,0xbd,0x00,0x00,0x11,0x00,0x31,0x00,0x02,0x20,0x55,0x00,0x03,0x76,0x01,
+0xa0,0x50,0x00,0x00,0x53,0x00,0x03,0x50,0x01,0x90,0x00,0xf8,0x03,0xc3,0x8c,0x00,
+0x4f,0x10,0x00,0x00,0xe9,0x00,0x08,0xc0,0x05,0xf0,0x11,0x00,0x21,0x8f,0x00,0xe9,
+0x05,0xf0,0x0f,0xc0,0x0c,0xf5,0x00,0x00,0x0e,0xc7,0x77,0xcc,0x02,0xff,0xd0,0x00,
+0x00,0xe8,0x00,0x0a,0xc0,0xae,0x5f,0x50,0x00,0x0e,0x80,0x00,0xac,0x4f,0x60,0xae,
+0x10,0x45,0x05,0xd5,0x9c,0xa0,0x01,0xe8,0x00,0x02,0x45,0x55,0x40,0x20,0x00,0x02,
+0x30,0xc4,0x00,0x40,0x02,0x9c,0xc9,0x10,0xb3,0x00,0x50,0x04,0xfe,0x89,0xee,0x10,
+0x80,0x03,0x91,0xed,0x10,0x01,0xfa,0x00,0x00,0x5f,0x30,0x4f,0x3f,0x05,0xf0,0x00,
+0x05,0xf3,0x06,0xf2,0x00,0x00,0x6f,0x14,0x66,0x9f,0x30,0x6f,0x10,0x00,0x04,0xe7,
+0x02,0x21,0x05,0xf3,0x41,0x04,0x42,0x5f,0x20,0x2f,0x80,0xe6,0x00,0x50,0x00,0xaf,
+0x40,0x06,0xf7,0x44,0x00,0x51,0x01,0xdf,0xee,0xfa,0x00,0x4c,0x05,0x31,0x58,0x74,
+0x00,0x5e,0x05,0x02,0x82,0x01,0x18,0x80,0xa7,0x02,0x52,0xf3,0x00,0x00,0xe7,0x00,
+0x3c,0x04,0x20,0x2f,0x70,0x38,0x02,0x10,0xf1,0xce,0x03,0x00,0xe8,0x05,0x40,0x30,
+0x00,0xaf,0x80,0x19,0x00,0xf7,0x16,0xfe,0x10,0x2f,0xef,0x50,0x00,0x00,0x1e,0xb2,
+0xec,0x0c,0xe1,0xbf,0x40,0x00,0x0c,0xe1,0x03,0xfd,0xf4,0x00,0xbf,0x40,0x06,0xf3,
+0x00,0x06,0xf5,0x00,0x00,0x9c,0x00,0x11,0x00,0x00,0x02,0x00,0x5c,0x06,0x02,0x07,
+0x00,0x60,0xe5,0x01,0xf4,0x00,0x01,0x32,0xc7,0x05,0xe1,0x2f,0x40,0x08,0xff,0xfc,
+0x10,0x00,0xf6,0x02,0xf4,0x05,0xf6,0x02,0xea,0x11,0x00,0x40,0xcc,0x00,0x06,0xf1,
+0x11,0x00,0xf0,0x20,0x0f,0x70,0x00,0x2f,0x50,0x0f,0x60,0x2f,0x42,0xf5,0x00,0x00,
+0xf7,0x00,0xf7,0x02,0xf4,0x3f,0x40,0x00,0x0e,0xc8,0x8f,0x70,0x2f,0x43,0xf3,0x00,
+0x00,0xee,0xdd,0xf7,0x02,0xf4,0x2f,0x40,0x00,0x0f,0x70,0x0f,0x70,0x2f,0x40,0xf6,
+0x00,0x01,0xf5,0x22,0x00,0xf1,0x0f,0x0c,0xa0,0x00,0x5f,0x20,0x0f,0x80,0x2f,0x40,
+0x7f,0x20,0x0b,0xc0,0x00,0xe8,0x02,0xf4,0x00,0xed,0x7b,0xf5,0x00,0x0e,0x80,0x2f,
+0x40,0x02,0xad,0xc5,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x11,0x00,0x01,0x09,0x00,
+0x24,0xe8,0x01,0x11,0x00,0x21,0x1f,0x50,0x09,0x00,0x31,0xe7,0x01,0xf5,0x08,0x00,
+0x23,0x0f,0x70,0x11,0x00,0x12,0x62,0x22,0x00,0x00,0xde,0x01,0x07,0xc7,0x00,0x00,
+0xb1,0x07,0xf0,0x0f,0xe5,0x03,0xf2,0x03,0xef,0xff,0xc1,0x00,0x0f,0x70,0x4f,0x30,
+0xed,0x30,0x5f,0x90,0x00,0xf8,0x03,0xf3,0x5f,0x40,0x00,0xaf,0x00,0x0f,0x80,0x3f,
+0x38,0xf0,0xc4,0x00,0xf3,0x25,0xf8,0x03,0xf4,0x9f,0x00,0x00,0x5f,0xff,0xff,0x80,
+0x2f,0x47,0xf0,0x00,0x05,0xf8,0x77,0xf9,0x02,0xf4,0x6f,0x20,0x00,0x7e,0x00,0x0e,
+0x90,0x2f,0x41,0xf8,0x00,0x0d,0xa0,0x00,0xe9,0x02,0xf4,0x08,0xfa,0x8d,0xf2,0x00,
+0x0e,0x90,0x3f,0x40,0x06,0xcd,0xa3,0x00,0x00,0xe8,0xfa,0x04,0x42,0x02,0x00,0x07,
+0x00,0xc3,0x03,0x20,0x64,0x20,0x20,0x09,0x00,0x01,0x00,0x01,0x97,0x03,0x02,0x70,
+0x07,0x04,0x43,0x08,0xf1,0x00,0x01,0x77,0x77,0x78,0x88,0x8c,0xf0,0x00,0x00,0x8f,
+0xff,0xff,0xff,0xee,0xea,0xa1,0x01,0x03,0x1d,0x00,0x13,0x10,0xcf,0x03,0x41,0xff,
+0xee,0xee,0xff,0x1b,0x05,0x56,0x88,0x87,0x77,0x77,0x76,0x10,0x03,0x05,0x50,0x05,
+0x12,0x33,0x08,0x00,0x30,0x6e,0xff,0xf6,0x08,0x00,0xf0,0x00,0x05,0xfa,0x22,0x9f,
+0x40,0x00,0x03,0xf2,0x0d,0xc0,0x00,0x0c,0xc0,0x78,0x8a,0xe8,0x05,0x40,0x06,0xf0,
+0xde,0xee,0xe8,0x05,0x22,0x04,0xf2,0xe8,0x05,0x27,0x03,0xf4,0x08,0x00,0x20,0x4f,
+0x20,0xad,0x05,0x30,0x03,0xf2,0x3f,0x75,0x05,0x20,0x34,0x46,0xe8,0x05,0xf0,0x03,
+0x09,0xf0,0xff,0xff,0xf2,0x0b,0xd0,0x00,0x1f,0x90,0x22,0x25,0xf2,0x02,0xfc,0x77,
+0xee,0x10,0x60,0x00,0x3f,0x3a,0xdd,0x91,0xe8,0x05,0x1f,0x23,0x01,0xd1,0xb0,0x00,
+0x50,0x10,0x00,0x17,0xaa,0x50,0x28,0x04,0x40,0x03,0xee,0xac,0xfb,0xe8,0x03,0xf0,
+0x03,0x0d,0xe1,0x00,0x6f,0x50,0x67,0x7b,0xf0,0x3f,0x50,0x00,0x0e,0xb0,0xde,0xef,
+0xf0,0x7f,0x10,0xc8,0x05,0x40,0x07,0xf0,0x7f,0x00,0xf0,0x05,0x31,0x07,0xf0,0x6f,
+0x08,0x00,0xf1,0x07,0x08,0xf0,0x4f,0x40,0x00,0x0b,0xc1,0x88,0x8c,0xf0,0x0e,0xb0,
+0x00,0x2f,0x72,0xdd,0xde,0xf0,0x06,0xfb,0x67,0xed,0x44,0x01,0x36,0x6d,0xff,0xa1,
+0x30,0x05,0x07,0x38,0x05,0x70,0x00,0x12,0x22,0x22,0x22,0x22,0x00,0x43,0x08,0x01,
+0x20,0x05,0x63,0x01,0x54,0x44,0x44,0x44,0x3b,0x20,0x00,0x1f,0x09,0x08,0x00,0x0d,
+0x13,0xe0,0xc0,0x00,0x13,0x50,0x50,0x00,0x50,0x30,0x00,0x05,0x87,0x20,0x70,0x00,
+0x40,0x02,0xdf,0xde,0xf7,0x08,0x00,0xf1,0x0a,0x0c,0xe2,0x00,0x8f,0x30,0x12,0x29,
+0xf0,0x3f,0x60,0x00,0x0e,0x90,0xff,0xff,0xf0,0x6f,0x10,0x00,0x0a,0xc0,0x23,0x39,
+0xf0,0x8f,0x3d,0x00,0x32,0x07,0xf0,0x8f,0xc0,0x00,0x00,0xd0,0x00,0xf1,0x0a,0x09,
+0xc0,0x00,0x07,0xf0,0x4f,0x60,0x00,0x0e,0xa1,0xaa,0xad,0xf0,0x0d,0xe2,0x00,0x9f,
+0x41,0xbc,0xce,0xf0,0x03,0xef,0xef,0xf7,0xc0,0x00,0x12,0x16,0x58,0x00,0x03,0xd0,
+0x05,0x15,0xe0,0x08,0x00,0x22,0x04,0xb0,0x08,0x00,0x01,0x0a,0x02,0x25,0x03,0x70,
+0x12,0x02,0x05,0x08,0x00,0x04,0x33,0x00,0x81,0xf7,0x65,0x55,0x66,0x77,0x81,0x00,
+0x04,0xe8,0x00,0x1b,0xe2,0xa0,0x06,0x1f,0x80,0xa0,0x06,0x02,0x21,0x66,0x7a,0xe8,
+0x05,0x32,0xe1,0xef,0xff,0xe8,0x05,0x02,0xf0,0x05,0x10,0x05,0x08,0x00,0x08,0xe8,
+0x05,0x32,0xd2,0xde,0xee,0xe8,0x05,0x2f,0x78,0x8b,0xa0,0x06,0x5c,0x60,0x02,0x60,
+0x00,0x17,0xa9,0x50,0x68,0x00,0x34,0x03,0xef,0xbc,0x28,0x02,0x40,0x5f,0x60,0xde,
+0xff,0x48,0x01,0x31,0x0c,0xc0,0x67,0x98,0x06,0x00,0x60,0x01,0x21,0xf1,0x8f,0x8d,
+0x00,0x10,0x08,0x80,0x01,0x01,0x08,0x00,0xf1,0x05,0x4f,0x50,0x00,0x0a,0xd2,0xde,
+0xef,0xf0,0x0e,0xc0,0x00,0x3f,0x61,0x89,0x9c,0xf0,0x05,0xfd,0x89,0xfc,0x88,0x00,
+0x3e,0x4b,0xdc,0x70,0x28,0x02,0x01,0x89,0x03,0x30,0x6c,0xef,0xdb,0x77,0x00,0x50,
+0x1c,0xfb,0x76,0x7c,0xfc,0x9d,0x0c,0xa0,0x50,0x00,0x00,0x5f,0x90,0x00,0x00,0xfa,
+0x00,0x00,0x6b,0x05,0x05,0x1c,0x0b,0x22,0xfa,0x00,0x8a,0x09,0x10,0xaf,0x26,0x0a,
+0x80,0x90,0x00,0x00,0x1d,0xfc,0x87,0x9d,0xfc,0x40,0x00,0x4b,0x6b,0xdd,0xc9,0x50,
+0x18,0x05,0x23,0xd6,0x02,0x18,0x05,0xf1,0x00,0x70,0x3f,0x40,0x09,0xff,0xfa,0x00,
+0x00,0xf7,0x03,0xf4,0x05,0xf6,0x03,0xf8,0x11,0x00,0x70,0xcc,0x00,0x08,0xf4,0x44,
+0xf7,0x03,0x18,0x05,0xa3,0x4f,0xff,0xff,0x70,0x3f,0x42,0xf5,0x00,0x02,0xf6,0x18,
+0x05,0x32,0x0f,0x60,0x0f,0x18,0x05,0x22,0xf6,0x00,0x18,0x05,0x40,0x1f,0x50,0x0f,
+0x80,0x18,0x05,0xa0,0x03,0xf8,0x66,0xf8,0x02,0xf4,0x0d,0x90,0x00,0x7f,0x87,0x04,
+0xe0,0x40,0x8f,0x10,0x0c,0xb0,0x00,0xf8,0x02,0xf4,0x01,0xec,0x7b,0xf4,0x00,0x22,
+0x00,0x40,0x02,0xbd,0xc4,0x00,0x11,0x00,0x02,0xf6,0x04,0x04,0x18,0x05,0x24,0xf8,
+0x01,0x11,0x00,0x03,0x07,0x05,0x1f,0xf8,0x18,0x05,0x0d,0x13,0x24,0xa6,0x06,0x41,
+0x1a,0xff,0xff,0xf9,0x09,0x00,0x51,0x1e,0xf7,0x21,0x28,0xfb,0xcc,0x01,0x41,0xf4,
+0x00,0x00,0x07,0xe8,0x03,0x60,0xdc,0x00,0x00,0x00,0x1f,0x70,0x46,0x00,0x20,0xa0,
+0x00,0x19,0x07,0x03,0x2d,0x09,0x10,0x0d,0x0e,0x00,0x23,0x0c,0xd0,0x60,0x0c,0x00,
+0xbf,0x09,0x30,0x00,0x7f,0x30,0x59,0x00,0x51,0xee,0x62,0x24,0xaf,0x90,0xd7,0x01,
+0x42,0xbf,0xff,0xfe,0x70,0x60,0x00,0x24,0x13,0x31,0x33,0x01,0x3a,0x27,0x00,0x00,
+0xd2,0x02,0x02,0xa4,0x0c,0x07,0x13,0x00,0xe0,0x27,0x77,0x77,0x77,0xcf,0x77,0x77,
+0x77,0x75,0x06,0xee,0xee,0xee,0xee,0x2f,0x02,0x1e,0xe0,0xc2,0x0b,0x00,0x69,0x00,
+0x31,0x8c,0xff,0xeb,0xf8,0x00,0x41,0x2e,0xfa,0x76,0x7c,0x84,0x00,0x50,0xbf,0x30,
+0x00,0x00,0x9f,0x12,0x07,0x10,0xfb,0xb3,0x00,0x00,0xe6,0x01,0x14,0xf9,0x09,0x00,
+0x50,0xce,0x20,0x00,0x00,0x8f,0x9f,0x00,0x51,0x3f,0xe9,0x77,0x8c,0xf9,0x3f,0x00,
+0x43,0x8b,0xff,0xda,0x40,0x04,0x0e,0x09,0xe9,0x0c,0x50,0x01,0x22,0x21,0x11,0xae,
+0xd7,0x02,0x22,0x6f,0xff,0x01,0x00,0xa7,0xfe,0x15,0x55,0x55,0x54,0x44,0x55,0x55,
+0x55,0x53,0x7e,0x00,0x14,0x75,0x09,0x00,0x1d,0xeb,0x09,0x00,0x14,0xea,0x09,0x00,
+0x14,0xfa,0x09,0x00,0x72,0xfd,0x76,0x66,0x66,0x67,0x73,0x00,0x56,0x0a,0x00,0x21,
+0x02,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x04,0x66,
+0x52,0x00,0x01,0x00,0x50,0x09,0xff,0xed,0xef,0xc2,0x09,0x00,0x50,0x9f,0x71,0x00,
+0x03,0xdd,0x09,0x00,0xf0,0x04,0xfa,0x00,0x00,0x00,0x5f,0x30,0x00,0x00,0x01,0xf8,
+0x00,0x00,0x00,0x4f,0x40,0x00,0x00,0x00,0xed,0x1f,0x00,0x10,0x20,0x17,0x00,0x40,
+0xd9,0x77,0x8c,0xfa,0x24,0x00,0x61,0x03,0x9c,0xff,0xda,0x50,0x00,0x01,0x00,0x23,
+0x8e,0x00,0x01,0x00,0x10,0x9e,0x05,0x00,0x40,0x6f,0xff,0xee,0xee,0x03,0x00,0x31,
+0xfe,0x15,0x66,0x01,0x00,0x35,0x55,0x53,0x00,0x01,0x00,0xf3,0x01,0x03,0x77,0x77,
+0x77,0x77,0x88,0x70,0x00,0x00,0x08,0xff,0xff,0xff,0xff,0xef,0xf1,0x17,0x00,0x18,
+0x07,0x09,0x00,0x20,0x06,0xef,0x1c,0x00,0xd4,0xf0,0x00,0x00,0x09,0xf8,0x77,0x66,
+0x66,0x66,0x30,0x00,0x00,0x09,0x1f,0x00,0x02,0x09,0x00,0x40,0x10,0x00,0x00,0x08,
+0x61,0x00,0x10,0xff,0x88,0x00,0x61,0x68,0x88,0x88,0x88,0x77,0x62,0x1e,0x00,0x22,
+0x22,0x10,0x64,0x00,0x50,0xaf,0xff,0xfe,0x80,0x00,0xb9,0x00,0x40,0xc5,0x22,0x38,
+0xfc,0x09,0x00,0x10,0xdd,0xb8,0x00,0x00,0xc6,0x00,0x63,0xf9,0x00,0x00,0x00,0x0f,
+0x70,0xe1,0x00,0xa0,0x3f,0x60,0x00,0x00,0x00,0xaf,0x70,0x00,0x03,0xdf,0x38,0x00,
+0x51,0x1a,0xff,0xee,0xff,0xd4,0x40,0x00,0x33,0x25,0xcf,0x63,0x6f,0x00,0x14,0x8f,
+0xb7,0x00,0x10,0x9f,0x05,0x00,0x22,0x5e,0xff,0x01,0x00,0x32,0xfd,0x28,0x77,0x01,
+0x00,0x16,0x75,0xd8,0x00,0xf3,0x01,0x01,0x90,0x00,0x00,0x00,0x02,0x70,0x00,0x00,
+0x05,0xf3,0x00,0x00,0x00,0x06,0xf0,0x09,0x00,0x10,0x07,0x09,0x00,0x31,0xff,0xff,
+0xee,0xcf,0x00,0x69,0x05,0xf8,0x77,0x77,0x66,0x6a,0x1b,0x00,0x04,0x09,0x00,0x11,
+0x04,0x59,0x00,0x50,0xd0,0x00,0x00,0x00,0x55,0x32,0x01,0x14,0x20,0x57,0x00,0x11,
+0x30,0xd0,0x00,0xc2,0x42,0x00,0x00,0x00,0xf7,0x00,0x00,0x00,0x05,0xef,0xff,0xb1,
+0x0a,0x00,0x42,0x3f,0xb2,0x15,0xfb,0x0a,0x00,0x11,0xbe,0xa9,0x01,0x00,0x0a,0x00,
+0x72,0xe9,0x00,0x00,0x0f,0x60,0x00,0xf7,0x2c,0x00,0x49,0x0e,0x80,0x00,0xf8,0x0a,
+0x00,0x72,0xda,0x00,0x00,0x1f,0x60,0x00,0xf8,0xc6,0x01,0xf4,0x0a,0x9f,0x10,0x00,
+0xfb,0x66,0x61,0x00,0x1d,0xf9,0x8c,0xf6,0x00,0x00,0xff,0xff,0xf5,0x00,0x00,0x8c,
+0xdb,0x40,0x00,0x00,0xf9,0x11,0x78,0x00,0x11,0xf8,0x06,0x00,0x14,0xf5,0x0a,0x00,
+0x2f,0x01,0xf7,0x0a,0x00,0x01,0x40,0x24,0x68,0x60,0xf8,0xee,0x01,0x00,0x13,0x01,
+0x94,0x70,0xf8,0x00,0x00,0x14,0x55,0x55,0x44,0x31,0x3c,0x00,0x06,0x46,0x00,0x0a,
+0x0a,0x00,0x2e,0xd7,0x00,0x01,0x00,0x10,0x51,0x05,0x00,0x32,0x7b,0xdc,0x70,0x5e,
+0x00,0x42,0x0c,0xfa,0x8a,0xfa,0x0a,0x00,0x20,0x7f,0x30,0x7c,0x02,0x00,0x3c,0x00,
+0x15,0xbc,0xc8,0x00,0x72,0xcb,0x00,0x00,0x0c,0xa0,0x00,0xf8,0xfa,0x00,0x12,0x0f,
+0x14,0x00,0xd1,0x4f,0x92,0x02,0xbf,0x30,0x00,0xf9,0x22,0x10,0x00,0x07,0xff,0xff,
+0xd2,0x00,0xf4,0x00,0xf1,0x00,0x00,0x17,0xf7,0x10,0x00,0x00,0xfa,0x44,0x30,0x00,
+0x00,0x03,0xf4,0x82,0x00,0x91,0x03,0xf5,0x13,0x57,0x30,0xf8,0x00,0x00,0x5f,0xb4,
+0x00,0x9d,0x40,0xf8,0x00,0x00,0x15,0x66,0x66,0x54,0x32,0xaa,0x00,0x15,0x31,0x0a,
+0x00,0x10,0xea,0x05,0x00,0x15,0x62,0x0a,0x00,0x1f,0x00,0x0a,0x00,0x05,0x10,0xed,
+0x10,0x02,0x20,0x84,0x00,0x51,0x02,0x00,0x5c,0x00,0x15,0xe9,0x18,0x02,0x51,0x50,
+0x00,0x00,0x14,0x30,0xe5,0x01,0x40,0x1b,0xff,0xfe,0x50,0x08,0x00,0x90,0xbf,0x50,
+0x3b,0xf3,0x00,0x06,0xf0,0x03,0xf6,0x40,0x00,0x40,0x06,0xf0,0x06,0xf1,0x40,0x03,
+0x73,0x06,0xf0,0x08,0xf0,0x00,0x00,0x6f,0x08,0x00,0xf0,0x0a,0x7f,0x00,0x05,0xf0,
+0x06,0xf2,0x00,0x00,0xad,0x00,0x05,0xf0,0x01,0xf9,0x00,0x02,0xf8,0x00,0x05,0xf0,
+0x00,0x7f,0xc8,0x9f,0xd0,0x08,0x00,0x40,0x04,0xad,0xc8,0x10,0x08,0x00,0x01,0x01,
+0x00,0x00,0x08,0x00,0x22,0x0d,0x70,0x08,0x00,0x2b,0x0e,0x90,0x08,0x00,0x60,0x91,
+0x24,0x67,0x06,0xf0,0xbf,0x90,0x00,0xa3,0xeb,0x06,0xf1,0x35,0x66,0x65,0x54,0x31,
+0x00,0x06,0x4a,0x03,0x0c,0x08,0x00,0x2b,0x04,0xf0,0x94,0x01,0x70,0x15,0x00,0x00,
+0x05,0xbd,0xc8,0x10,0xb1,0x00,0xa0,0x0a,0xfb,0x89,0xed,0x10,0x00,0x7f,0x10,0x03,
+0xf6,0x10,0x04,0x20,0x07,0xf1,0x17,0x03,0x50,0x0a,0xc0,0x00,0x7f,0x10,0xab,0x00,
+0x10,0x8d,0x11,0x00,0x40,0x7f,0x20,0x00,0x0b,0x11,0x00,0x50,0x01,0xec,0x30,0x18,
+0xf5,0x11,0x00,0xc3,0x03,0xdf,0xff,0xf7,0x00,0x00,0x7f,0x10,0x00,0x00,0x2f,0x90,
+0xde,0x03,0x22,0xf8,0x00,0x11,0x00,0x72,0x0f,0x81,0x34,0x75,0x07,0xf1,0x2e,0x36,
+0x02,0x75,0x7f,0x10,0x56,0x66,0x65,0x54,0x20,0x00,0x04,0x00,0x22,0x00,0x23,0x01,
+0x30,0x98,0x00,0x13,0xae,0x88,0x00,0x23,0x0b,0xe0,0x1d,0x00,0x13,0xbe,0x08,0x00,
+0x05,0x11,0x00,0x10,0xbf,0x76,0x01,0x40,0x86,0x00,0x00,0x06,0x4e,0x00,0x20,0xfe,
+0xc0,0x13,0x00,0x11,0x23,0x33,0x03,0x00,0xcf,0x03,0x12,0xff,0xd5,0x01,0x41,0x1e,
+0xf7,0x31,0x28,0xb0,0x04,0x60,0x08,0xf4,0x00,0x00,0x08,0xf2,0x0a,0x00,0x60,0xdc,
+0x00,0x00,0x00,0x1f,0x70,0x0b,0x04,0x13,0x90,0x14,0x04,0x01,0x10,0x04,0x10,0x0e,
+0x0e,0x00,0x23,0x0d,0xc0,0x6d,0x03,0x30,0x00,0x8f,0x30,0x82,0x02,0x00,0xc4,0x01,
+0x60,0xee,0x51,0x13,0xaf,0x90,0x00,0xe1,0x03,0x42,0xcf,0xff,0xfe,0x70,0x60,0x00,
+0x23,0x14,0x42,0x39,0x01,0x44,0x70,0x00,0x06,0x90,0x2d,0x04,0x21,0x9e,0x00,0x69,
+0x00,0x48,0xf0,0x00,0x09,0xe0,0x13,0x00,0x40,0x27,0x77,0x7c,0xf7,0x03,0x00,0x33,
+0x76,0x07,0xff,0x01,0x00,0x17,0xd0,0xaf,0x04,0x51,0x00,0x3b,0xff,0xff,0xf9,0x09,
+0x00,0x41,0x3f,0xd5,0x22,0x37,0xb0,0x04,0x64,0x0c,0xe1,0x00,0x00,0x04,0xf4,0x98,
+0x00,0x11,0x0f,0xab,0x00,0x13,0xa0,0x7d,0x03,0x70,0x00,0xaf,0x30,0x00,0x00,0x9f,
+0x40,0x8e,0x00,0x50,0xef,0xb8,0x89,0xdf,0xa0,0x13,0x00,0x42,0x0a,0xeb,0xdd,0xcc,
+0x42,0x01,0x51,0xad,0x00,0x00,0x6f,0x10,0x13,0x00,0x11,0xd0,0x44,0x01,0xd1,0x01,
+0x88,0x77,0xde,0x66,0x66,0xaf,0x77,0x78,0x60,0x4e,0xef,0xff,0x26,0x01,0x2f,0xec,
+0x00,0x01,0x00,0x02,0x51,0x18,0xce,0xed,0xb7,0x00,0x35,0x05,0x50,0xfa,0x76,0x8c,
+0xfd,0x10,0x0f,0x01,0x10,0xd1,0xb3,0x04,0x00,0x68,0x00,0x01,0x96,0x03,0x14,0xc0,
+0x32,0x05,0x10,0xcc,0x26,0x00,0x60,0xfc,0x10,0x00,0x00,0x3f,0x90,0x81,0x02,0x51,
+0xfe,0x97,0x78,0xbf,0xd1,0x1d,0x01,0x4b,0x9b,0xdd,0xca,0x60,0x56,0x00,0x41,0x06,
+0xbe,0xfe,0xb4,0x09,0x00,0x51,0x1c,0xfb,0x75,0x6c,0xf7,0x98,0x00,0x54,0xf4,0x00,
+0x00,0x09,0xf2,0xdb,0x00,0x24,0x1f,0x70,0x05,0x00,0x23,0xe9,0x00,0x6e,0x06,0x01,
+0x86,0x01,0x61,0x0e,0xc0,0x00,0x00,0x02,0xf6,0x11,0x02,0x51,0xa1,0x00,0x04,0xde,
+0x10,0x4d,0x01,0x42,0xfe,0xef,0xfd,0x20,0x9c,0x02,0x14,0x77,0xa1,0x05,0x0c,0x6f,
+0x00,0x50,0xee,0xed,0xdd,0xde,0xee,0x6e,0x05,0xa3,0x27,0x88,0x88,0x88,0xbf,0x77,
+0x77,0x66,0x64,0x00,0x62,0x05,0x03,0x5f,0x02,0x04,0x09,0x00,0x0f,0x13,0x00,0x13,
+0x3f,0x06,0xd0,0x00,0x01,0x00,0x06,0x31,0x6c,0xff,0xda,0x6b,0x02,0x54,0x1d,0xfa,
+0x76,0x8e,0xf6,0x98,0x01,0x10,0xbf,0xaa,0x00,0x63,0xfb,0x00,0x00,0x00,0x2f,0x60,
+0x5a,0x02,0x23,0x1f,0x70,0x80,0x06,0x20,0x6f,0x40,0x5d,0x01,0x41,0xd6,0x33,0x49,
+0xfb,0x8a,0x04,0x13,0xbf,0xa4,0x06,0x48,0x00,0x00,0x12,0x10,0x57,0x00,0x13,0x27,
+0x5c,0x06,0x14,0x86,0x6e,0x06,0x24,0xfc,0x00,0x15,0x01,0x06,0x09,0x00,0x23,0x01,
+0xe4,0x09,0x00,0x26,0x02,0xf6,0x09,0x00,0x21,0x0d,0x70,0x59,0x00,0x14,0xf6,0x6a,
+0x07,0x14,0xf5,0x09,0x00,0x91,0xfb,0x66,0x66,0x66,0x67,0x73,0x00,0x00,0x01,0x02,
+0x02,0x19,0xf9,0xc6,0x00,0x32,0x04,0x66,0x53,0xb4,0x02,0x41,0xff,0xed,0xef,0xd2,
+0x66,0x01,0x53,0x81,0x00,0x02,0xde,0x00,0xc6,0x00,0x14,0x4f,0x34,0x07,0x20,0x3f,
+0x50,0xc6,0x00,0x12,0x10,0x15,0x03,0x33,0x00,0x5f,0xe9,0x03,0x08,0x58,0x02,0x9c,
+0xde,0xdb,0x50,0x4e,0x00,0x20,0x43,0x33,0x01,0x00,0x34,0x44,0x43,0x6f,0x2b,0x07,
+0x86,0x01,0x11,0x22,0x22,0x8f,0x21,0x11,0x11,0x4f,0x07,0x00,0x03,0x08,0x7f,0xbf,
+0x77,0x78,0x70,0x00,0x00,0x07,0x03,0x08,0x07,0x10,0x05,0xab,0x00,0x00,0xc6,0x05,
+0x11,0x08,0x03,0x08,0x44,0x40,0x00,0x00,0x08,0x1f,0x00,0x14,0x08,0x03,0x08,0x11,
+0x07,0x03,0x08,0x18,0xfb,0x03,0x08,0x41,0x01,0x8c,0xee,0xdb,0x83,0x02,0x41,0x2e,
+0xe9,0x65,0x6a,0xa2,0x00,0x23,0xce,0x20,0xc5,0x03,0x05,0x6e,0x02,0x05,0x95,0x01,
+0x24,0xde,0x10,0x95,0x01,0x33,0xe9,0x77,0x9c,0xd2,0x08,0x2b,0xde,0xda,0xcf,0x00,
+0x74,0x32,0x22,0x22,0x23,0x33,0x42,0x7f,0xcf,0x00,0xb4,0x02,0x33,0x33,0x33,0x9f,
+0x43,0x33,0x33,0x21,0x00,0x00,0x69,0x03,0x01,0x09,0x00,0x23,0x01,0x00,0x85,0x04,
+0xb3,0xff,0xe0,0x00,0x00,0x08,0xf7,0x66,0x66,0x66,0x6b,0xf1,0xab,0x00,0x1f,0x07,
+0x09,0x00,0x03,0x52,0xf5,0x33,0x33,0x33,0x49,0x1e,0x08,0x03,0x10,0x04,0x23,0x23,
+0x44,0x58,0x00,0x08,0xc9,0x08,0x23,0xff,0xa1,0xc9,0x08,0x21,0x26,0xed,0xcf,0x00,
+0x04,0x85,0x03,0x01,0x18,0x04,0x00,0x41,0x02,0x14,0xeb,0xcf,0x00,0x50,0x9f,0x60,
+0x00,0x02,0xaf,0xea,0x00,0x42,0x1b,0xff,0xee,0xff,0x05,0x02,0x38,0x35,0x77,0x74,
+0xec,0x01,0xf9,0x03,0x4d,0xdd,0xdd,0xdd,0xdd,0xee,0xee,0xee,0xec,0x29,0x99,0x88,
+0x88,0xbf,0x98,0x88,0x88,0x86,0xc6,0x00,0x15,0x5f,0xa4,0x09,0x04,0x09,0x00,0x23,
+0x4f,0x30,0x09,0x00,0x23,0xaf,0x20,0x11,0x01,0x22,0xff,0xd1,0x09,0x00,0x22,0x3e,
+0xe6,0x8b,0x03,0x51,0x04,0xfe,0x20,0x4e,0xe4,0xdb,0x01,0x90,0xd2,0x00,0x02,0xcf,
+0x80,0x00,0x00,0x0d,0xf8,0xa3,0x01,0x51,0xfa,0x00,0x00,0x05,0x10,0x8e,0x05,0x04,
+0x4b,0x00,0x60,0x40,0x00,0x03,0xad,0xc9,0x10,0x93,0x04,0x90,0x6f,0xc8,0x9e,0xd0,
+0x00,0x05,0xf1,0x01,0xfa,0x58,0x04,0x20,0x05,0xf2,0xe7,0x06,0x40,0xbb,0x00,0x04,
+0xf2,0x4c,0x06,0x60,0x9d,0x00,0x04,0xf2,0x07,0xf0,0x0f,0x07,0x40,0x04,0xf2,0x05,
+0xf1,0xf6,0x07,0x40,0x04,0xf2,0x01,0xf9,0xd3,0x02,0x70,0x04,0xf2,0x00,0x7f,0xb8,
+0x9f,0xc0,0x08,0x00,0x40,0x05,0xbd,0xc7,0x00,0x08,0x00,0x02,0x91,0x00,0x91,0xf2,
+0x01,0x11,0x11,0x23,0x46,0x89,0x24,0xf2,0xe7,0x06,0x81,0xda,0x24,0xf2,0x24,0x44,
+0x4e,0xa2,0x10,0x20,0x00,0x00,0x19,0x03,0x02,0x08,0x00,0x31,0x09,0xee,0xee,0x08,
+0x00,0x38,0x04,0x88,0x8a,0x18,0x00,0x00,0x08,0x00,0x16,0xf3,0x08,0x00,0x6f,0x07,
+0x30,0x00,0x00,0x02,0xf1,0x07,0x07,0x02,0x01,0x1d,0x04,0xd0,0x09,0xfb,0x89,0xfd,
+0x10,0x00,0x7f,0x00,0x03,0xf7,0x00,0x01,0xf9,0xe3,0x09,0xd0,0x8f,0x00,0x00,0x09,
+0xd0,0x00,0x6f,0x00,0x09,0xf0,0x00,0x00,0x9e,0x11,0x00,0xd0,0x6f,0x20,0x00,0x0c,
+0xb0,0x00,0x6f,0x00,0x00,0xed,0x40,0x29,0xf4,0x11,0x00,0x40,0x02,0xcf,0xff,0xe5,
+0xd6,0x07,0x02,0x04,0x08,0xb1,0x06,0xf0,0x02,0x22,0x22,0x23,0x46,0x8a,0x80,0x6f,
+0x06,0x4d,0x02,0x70,0xa5,0x06,0xf0,0x02,0x33,0x3a,0xe1,0x87,0x02,0x01,0x3b,0x0b,
+0x30,0x08,0x88,0x8b,0xf5,0x0a,0x93,0xe0,0x01,0xcd,0xdd,0xef,0x00,0x00,0x00,0x58,
+0x49,0x0a,0x31,0x26,0x00,0x00,0x22,0x00,0x20,0x07,0xf2,0x72,0x03,0x20,0xa0,0x00,
+0x6e,0x07,0x02,0x0a,0x03,0x14,0xf2,0xa7,0x0a,0x81,0x97,0x77,0x77,0x77,0x78,0x10,
+0x00,0x04,0x36,0x03,0x16,0xe4,0xbb,0x00,0x40,0x3b,0xff,0xfd,0x60,0x8f,0x06,0x71,
+0x2f,0xc5,0x45,0xaf,0x70,0x00,0x7f,0x7f,0x02,0x10,0xad,0xcc,0x00,0x10,0x9f,0x68,
+0x00,0x00,0x67,0x08,0x41,0xf7,0x00,0x02,0xea,0xdd,0x00,0x40,0xff,0xee,0xfc,0x10,
+0xf9,0x04,0x33,0x01,0x57,0x63,0x0b,0x05,0x52,0x01,0x23,0x57,0x60,0x7f,0x9f,0x02,
+0x82,0xd7,0x07,0xf0,0x15,0x55,0x5b,0xf4,0x32,0x1b,0x05,0x61,0x9e,0x00,0x1d,0xdd,
+0xde,0xf0,0x42,0x00,0x73,0x67,0x88,0xbf,0x00,0x00,0x00,0x47,0xaa,0x00,0x00,0x35,
+0x00,0x00,0xeb,0x03,0x14,0x05,0x0a,0x03,0x63,0x16,0x66,0x55,0x55,0x55,0xbf,0xb9,
+0x03,0x00,0xe2,0x01,0x11,0x4f,0x83,0x06,0x93,0x00,0x00,0x06,0xf9,0x66,0x66,0x55,
+0x55,0x20,0x81,0x03,0x00,0x47,0x06,0x00,0xcd,0x03,0x00,0xb2,0x07,0x65,0x05,0x88,
+0x87,0x77,0x77,0x76,0x13,0x05,0xf0,0x0d,0x50,0x00,0x02,0x9b,0xb7,0x00,0x00,0xe6,
+0x01,0xf5,0x00,0x4f,0xe9,0xbf,0xc0,0x00,0xf7,0x02,0xf4,0x00,0xdd,0x10,0x04,0xf5,
+0x00,0xf7,0x01,0xf4,0x21,0x06,0x10,0xd9,0x09,0x00,0x00,0xbe,0x01,0x10,0xab,0x09,
+0x00,0x50,0x03,0xf3,0x00,0x00,0xbb,0x09,0x00,0x50,0x01,0xf6,0x00,0x00,0xe8,0x09,
+0x00,0x51,0x00,0xbd,0x10,0x08,0xf2,0x09,0x00,0x41,0x2e,0xfd,0xef,0x70,0x09,0x00,
+0x42,0x00,0x58,0x72,0x00,0x09,0x00,0x00,0x01,0x00,0x00,0x48,0x00,0xe0,0x44,0x44,
+0x56,0x8a,0xa0,0xf7,0x01,0xf4,0x0f,0xff,0xff,0xfe,0xda,0x60,0x1b,0x00,0x33,0x11,
+0x2f,0x60,0x24,0x00,0x16,0x1f,0x09,0x00,0x50,0x5e,0xdd,0xf7,0x01,0xf5,0x09,0x00,
+0x23,0x17,0x88,0x09,0x00,0x21,0x00,0x00,0x09,0x00,0x1d,0x2f,0x09,0x00,0x54,0x09,
+0x20,0x00,0x00,0xa3,0x63,0x00,0x01,0xae,0x04,0x03,0x0d,0x0a,0x22,0x03,0xad,0x54,
+0x09,0xe1,0x6f,0xc8,0xaf,0xd0,0x00,0x06,0xf0,0x01,0xfa,0x00,0x04,0xf6,0x00,0x06,
+0xed,0x09,0x40,0xca,0x00,0x06,0xf1,0x24,0x01,0x60,0x9c,0x00,0x05,0xf1,0x08,0xe0,
+0x0e,0x03,0x40,0x05,0xf1,0x06,0xf0,0xd1,0x00,0x40,0x05,0xf1,0x02,0xf7,0xe2,0x05,
+0x70,0x05,0xf1,0x00,0x9f,0x95,0x8e,0xc0,0x08,0x00,0x63,0x07,0xdf,0xe9,0x10,0x00,
+0x05,0xae,0x02,0x06,0x08,0x00,0xe0,0x46,0x66,0x67,0x78,0xab,0xdf,0x15,0xf1,0xae,
+0xef,0xff,0xfd,0xca,0x74,0x18,0x00,0x01,0x0d,0x0a,0x0f,0x08,0x00,0x14,0x00,0x31,
+0x08,0x26,0x09,0x40,0x50,0x00,0x19,0x00,0x9a,0x06,0x43,0x6b,0xef,0xeb,0x40,0xcb,
+0x07,0x12,0x6b,0x89,0x08,0x13,0x40,0x13,0x0e,0x04,0x5c,0x05,0x01,0xa0,0x08,0x23,
+0x0e,0xa0,0xc9,0x07,0x10,0x0d,0x99,0x06,0x10,0xec,0x0c,0x07,0x17,0x70,0xc8,0x07,
+0x00,0xba,0x0d,0x2f,0xff,0xd2,0xc7,0x07,0x0a,0x20,0x5e,0xee,0xa7,0x04,0xc1,0xef,
+0xff,0xfe,0x27,0x88,0x8e,0xe8,0x87,0x77,0xfb,0x66,0x63,0x7f,0x08,0x02,0xfe,0x08,
+0x0f,0x09,0x00,0x1a,0x5f,0x0a,0x80,0x00,0x00,0xd4,0xe8,0x06,0x06,0x02,0xeb,0x0e,
+0x14,0xeb,0xe9,0x04,0x09,0xe8,0x06,0x01,0xd8,0x00,0x1f,0x4f,0xe8,0x06,0x16,0x90,
+0xfc,0x00,0x11,0x24,0xf6,0x22,0x28,0xf2,0x11,0x2d,0x00,0x12,0xf5,0x56,0x0b,0x7e,
+0x03,0x78,0xfa,0x77,0x7b,0xfc,0xa0,0xeb,0x0e,0x0d,0xe8,0x06,0x14,0xf0,0xe8,0x06,
+0x1f,0x30,0xe8,0x06,0x0d,0x50,0x88,0x88,0x77,0x62,0x00,0x71,0x00,0x00,0x00,0x00,
+0x23,0x20,0x00,0x01,0x00,0x41,0x3b,0xff,0xff,0xe5,0x09,0x00,0x50,0x3f,0xe6,0x21,
+0x3b,0xf6,0x09,0x00,0xf0,0x01,0x0c,0xf1,0x00,0x00,0x0c,0xe0,0x00,0x00,0x00,0x01,
+0xf9,0x00,0x00,0x00,0x5f,0x30,0x1c,0x00,0x90,0x60,0x00,0x00,0x02,0xf5,0x00,0x00,
+0x00,0x03,0x22,0x00,0xb0,0x2f,0x60,0x00,0x00,0x00,0x1f,0x80,0x00,0x00,0x03,0xf4,
+0x30,0x00,0x50,0xde,0x00,0x00,0x00,0xaf,0x09,0x00,0x60,0x05,0xfb,0x20,0x02,0xaf,
+0x60,0x0a,0x00,0x52,0x06,0xff,0xff,0xfe,0x60,0x60,0x00,0x3f,0x46,0x64,0x00,0x01,
+0x00,0x0d,0x13,0x44,0x01,0x00,0x33,0x20,0x7f,0xff,0x01,0x00,0x20,0x00,0x22,0x01,
+0x00,0x47,0x23,0x33,0x33,0x20,0x27,0x00,0x50,0x01,0x8d,0xff,0xea,0x30,0x09,0x00,
+0x41,0x2e,0xfa,0x76,0x8e,0xaa,0x00,0x63,0xcf,0x20,0x00,0x00,0xbf,0x10,0xa9,0x00,
+0x60,0x3f,0x50,0x00,0x00,0x01,0xf8,0x9f,0x00,0xa0,0x50,0x00,0x00,0x00,0xed,0x00,
+0x00,0x00,0x8f,0x20,0xc0,0x00,0x40,0xd6,0x33,0x5a,0xf9,0x2d,0x00,0x43,0x04,0xbf,
+0xff,0xfd,0x94,0x00,0x19,0x12,0x7f,0x00,0xa3,0x27,0x76,0x66,0x65,0x55,0x55,0x56,
+0x66,0x74,0x6f,0x7e,0x00,0x2e,0xfb,0x00,0x01,0x00,0x23,0x04,0xc0,0x09,0x00,0x24,
+0x07,0xf2,0x09,0x00,0x1c,0xf1,0x09,0x00,0x15,0x08,0x09,0x00,0x91,0xf8,0x66,0x66,
+0x66,0x67,0x70,0x00,0x00,0x04,0x50,0x00,0x1a,0xf2,0x4a,0x00,0x22,0x66,0x53,0x25,
+0x00,0x40,0xff,0xed,0xef,0xc2,0x09,0x00,0x50,0x7f,0x91,0x00,0x03,0xde,0x09,0x00,
+0xa4,0xec,0x00,0x00,0x00,0x4f,0x40,0x00,0x00,0x00,0xf9,0x65,0x01,0x10,0xdd,0x1f,
+0x00,0x10,0x30,0xc6,0x00,0x41,0xd7,0x44,0x6a,0xfb,0x3e,0x00,0x48,0xbe,0xff,0xfc,
+0x70,0x15,0x01,0x11,0x10,0x07,0x00,0x24,0x11,0x21,0xbd,0x00,0xa6,0xfe,0x03,0x44,
+0x44,0x55,0x54,0x44,0x44,0x44,0x32,0x25,0x00,0xa0,0x02,0x66,0x66,0x66,0x66,0x7a,
+0xa0,0x00,0x00,0x07,0x22,0x00,0x14,0xef,0x90,0x00,0x27,0x06,0xf2,0xd4,0x00,0x20,
+0x06,0xef,0x1c,0x00,0xec,0xf1,0x00,0x00,0x08,0xf7,0x77,0x77,0x77,0x66,0x40,0x00,
+0x00,0x08,0xf0,0xd8,0x00,0xf1,0x01,0x07,0xfe,0xdd,0xee,0xef,0xff,0xfc,0x00,0x00,
+0x00,0x68,0x88,0x88,0x77,0x77,0x73,0x15,0x00,0x12,0x22,0x82,0x00,0x60,0x03,0xaf,
+0xff,0xfe,0x80,0x00,0xc2,0x00,0x53,0xc5,0x22,0x38,0xfc,0x00,0xbd,0x00,0x14,0x5f,
+0xcf,0x00,0x10,0x0f,0xb5,0x00,0x13,0xfa,0x4b,0x02,0x60,0x00,0xaf,0x70,0x00,0x03,
+0xdf,0x38,0x00,0x51,0x1b,0xff,0xee,0xff,0xd3,0x40,0x00,0x3f,0x25,0x77,0x62,0x1d,
+0x02,0x02,0x13,0x5e,0xd8,0x00,0x32,0xfd,0x28,0x77,0x01,0x00,0x1b,0x75,0x21,0x00,
+0x24,0x01,0x00,0x68,0x01,0x40,0xe1,0x00,0x00,0x06,0x7a,0x01,0x23,0x6a,0xf2,0xdc,
+0x00,0x1f,0x05,0x09,0x00,0x03,0x64,0xf6,0x33,0x33,0x33,0x48,0xf2,0x36,0x00,0x00,
+0xea,0x02,0x6f,0x13,0x44,0x33,0x33,0x21,0x00,0xcf,0x00,0x18,0x1f,0x1f,0xcf,0x00,
+0x1c,0x23,0x01,0x11,0x01,0x00,0x14,0x5f,0xa7,0x01,0x22,0x15,0x55,0x01,0x00,0x18,
+0x53,0x27,0x00,0x13,0x03,0x1c,0x02,0x32,0x07,0xff,0xfe,0x96,0x03,0x50,0x7f,0xa3,
+0x00,0x04,0xdf,0x75,0x00,0x00,0xfd,0x01,0xb3,0x0e,0xb0,0x00,0x00,0x02,0xf7,0x00,
+0x00,0x00,0x0a,0xe0,0xeb,0x02,0x20,0x0c,0xd0,0x06,0x03,0x50,0x30,0x00,0x00,0x6f,
+0x80,0x18,0x03,0x41,0xfb,0x87,0x9d,0xfb,0x6e,0x00,0x45,0x7b,0xcd,0xc9,0x40,0x7b,
+0x00,0xe0,0x50,0x00,0x00,0x14,0x30,0x00,0x00,0x07,0xf0,0x00,0x0a,0xff,0xff,0x60,
+0x08,0x00,0xf0,0x00,0xaf,0x61,0x2a,0xf4,0x00,0x06,0xf0,0x02,0xf8,0x00,0x00,0xdb,
+0x00,0x06,0xf0,0x15,0x01,0xd3,0x8e,0x00,0x06,0xf0,0x07,0xf0,0x00,0x00,0x6f,0x00,
+0x05,0xf0,0x08,0x08,0x00,0x80,0x06,0xf1,0x00,0x00,0x9d,0x00,0x05,0xf0,0x74,0x00,
+0x90,0xe9,0x00,0x05,0xf0,0x00,0xaf,0x72,0x3c,0xf2,0x08,0x00,0x40,0x09,0xff,0xfd,
+0x30,0x08,0x00,0x63,0x00,0x02,0x20,0x00,0x00,0x05,0x27,0x02,0x0e,0x08,0x00,0xf3,
+0x00,0x46,0x66,0x67,0x78,0xac,0xef,0x16,0xf0,0xae,0xee,0xee,0xdd,0xb9,0x74,0x06,
+0x46,0x02,0x0f,0x08,0x00,0x05,0x14,0x05,0x66,0x02,0x13,0x30,0x28,0x03,0x12,0x10,
+0x08,0x00,0x40,0xe8,0x00,0x01,0x33,0xfd,0x00,0xf0,0x0a,0x90,0x08,0xff,0xfe,0x50,
+0x00,0x00,0xe9,0x08,0xf8,0x23,0xbf,0x30,0x00,0x0d,0x91,0xfa,0x00,0x00,0xeb,0x00,
+0x00,0xd9,0x5f,0x30,0xa9,0x02,0xa1,0x0d,0x97,0xf0,0x00,0x00,0x5f,0x20,0x00,0xd8,
+0x9e,0x96,0x04,0xf0,0x0b,0x0d,0x89,0xe0,0x00,0x00,0x3f,0x40,0x00,0xd8,0x8f,0x00,
+0x00,0x04,0xf3,0x00,0x0d,0x87,0xf1,0x00,0x00,0x6f,0x10,0x00,0xd8,0x4f,0x40,0x3c,
+0x01,0xf0,0x06,0x0e,0x80,0xeb,0x00,0x03,0xf8,0x00,0x00,0xe8,0x04,0xfb,0x78,0xee,
+0x10,0x00,0x0e,0x80,0x04,0xce,0xd9,0x10,0x69,0x00,0x01,0x01,0x00,0x11,0x0e,0xf7,
+0x01,0x0d,0x0f,0x00,0x13,0xe9,0x0f,0x00,0x12,0x90,0x08,0x00,0x1a,0xc8,0x85,0x02,
+0xf0,0x04,0x02,0x20,0x01,0x7a,0xa7,0x00,0x00,0x00,0xcc,0x03,0xef,0xbb,0xfd,0x00,
+0x00,0x0c,0xc0,0xce,0x10,0x5e,0x01,0xf0,0x03,0xcc,0x2f,0x60,0x00,0x0b,0xd0,0x00,
+0x0c,0xc5,0xf2,0x00,0x00,0x7f,0x00,0x00,0xcc,0x6f,0x10,0xef,0x00,0x01,0x0f,0x00,
+0xf2,0x13,0x6f,0x00,0x00,0xcc,0x3f,0x50,0x00,0x08,0xe0,0x00,0x0c,0xc0,0xfb,0x00,
+0x00,0xda,0x00,0x00,0xcb,0x07,0xfb,0x66,0xcf,0x20,0x00,0x0c,0xb0,0x06,0xdf,0xfb,
+0x30,0x00,0x00,0xcb,0x5a,0x00,0x22,0x0b,0xb0,0x08,0x00,0x22,0x32,0x00,0x15,0x05,
+0x30,0x00,0x00,0xcf,0x40,0x02,0x30,0xf8,0x00,0x03,0xe5,0x03,0x22,0x4f,0xa0,0x1e,
+0x00,0x13,0xea,0x9e,0x00,0x0e,0x0f,0x00,0x07,0xbc,0x00,0x27,0x05,0x20,0x69,0x02,
+0x20,0x20,0x00,0x7c,0x00,0xf0,0x0a,0xbf,0xff,0xf8,0x00,0x00,0x09,0xf0,0x08,0xf6,
+0x00,0x8f,0x40,0x00,0x08,0xf0,0x0f,0x90,0x00,0x0d,0xb0,0x00,0x08,0xf0,0x4f,0x40,
+0x1d,0x00,0x73,0x08,0xf0,0x6f,0x20,0x00,0x06,0xf0,0x08,0x00,0x80,0xf1,0x00,0x08,
+0xf0,0x5f,0x30,0x00,0x07,0x10,0x00,0xf1,0x05,0x2f,0x70,0x00,0x0a,0xd0,0x00,0x08,
+0xf0,0x0d,0xe1,0x00,0x4f,0x70,0x00,0x08,0xf0,0x03,0xfe,0xab,0xfc,0x50,0x00,0x31,
+0x18,0xba,0x60,0x08,0x00,0x02,0x38,0x04,0x03,0x08,0x00,0x52,0x09,0xe0,0x00,0x00,
+0xb5,0x08,0x00,0x01,0xb6,0x02,0x22,0x05,0x80,0x08,0x00,0x2e,0x00,0x00,0x08,0x00,
+0x90,0xfb,0x65,0x55,0x66,0x67,0x81,0x00,0x00,0xdf,0xe5,0x00,0x1a,0xe3,0x65,0x01,
+0xe0,0x05,0x50,0x00,0x16,0x99,0x50,0x00,0x00,0x0c,0xb0,0x03,0xef,0xcb,0xfc,0x08,
+0x00,0xa0,0x0e,0xd1,0x00,0x3f,0x80,0x00,0x0c,0xb0,0x5f,0x50,0xd8,0x01,0x40,0x0b,
+0xb0,0x7f,0x10,0x8e,0x05,0x01,0x08,0x00,0x10,0x05,0x08,0x00,0x20,0x5f,0x20,0xb0,
+0x00,0x40,0x0c,0xb0,0x2f,0x80,0x2b,0x03,0xf0,0x00,0x0c,0xa0,0x0a,0xf8,0x34,0xaf,
+0x50,0x00,0x0c,0xa0,0x00,0x9f,0xff,0xe6,0x00,0x08,0x00,0x20,0x00,0x22,0x46,0x03,
+0x16,0x90,0xa8,0x03,0x81,0x56,0x66,0x66,0x66,0x8a,0x40,0x00,0x09,0xa5,0x03,0x95,
+0x90,0x00,0x00,0x11,0x11,0x11,0x10,0x0e,0x90,0xfc,0x01,0x02,0x26,0x05,0xb3,0x80,
+0x00,0x09,0xf8,0x88,0x88,0x87,0x76,0x10,0x00,0x09,0xed,0x02,0x04,0x08,0x00,0x32,
+0x08,0xff,0xee,0x46,0x05,0x63,0x67,0x77,0x77,0x76,0x66,0x40,0x55,0x00,0x12,0x40,
+0xb8,0x00,0x22,0x08,0xf0,0xb8,0x00,0x21,0x08,0xf0,0xb8,0x00,0x00,0x50,0x01,0x12,
+0x50,0x48,0x01,0x22,0x7f,0x10,0x58,0x01,0x01,0xb8,0x00,0x00,0x18,0x00,0x12,0x20,
+0x68,0x01,0x00,0xb8,0x00,0x42,0xc0,0x00,0x08,0xf0,0xb8,0x00,0x22,0x08,0xf0,0xb8,
+0x00,0x22,0x09,0xe0,0xb8,0x00,0x23,0x09,0xd0,0x60,0x00,0xf0,0x09,0x30,0x00,0x25,
+0x55,0x66,0x11,0x66,0x65,0x30,0x00,0x9f,0xff,0xff,0x76,0xff,0xff,0xf0,0x00,0x01,
+0x10,0x0f,0x80,0x00,0x07,0x95,0x00,0x02,0x08,0x00,0x31,0x16,0x67,0x7f,0x08,0x00,
+0x40,0x9f,0xff,0xfe,0x50,0x08,0x00,0x11,0x9e,0x66,0x04,0x02,0x08,0x00,0x00,0x58,
+0x00,0x40,0x8f,0xee,0xef,0xf3,0x08,0x00,0x7a,0x16,0x78,0x77,0x50,0x00,0x02,0x60,
 0xd5,0x02,0x13,0xcb,0xd5,0x02,0x12,0xb0,0xd5,0x02,0x13,0xcb,0xd5,0x02,0x12,0xb5,
 0xd5,0x02,0x13,0xcb,0xd5,0x02,0x12,0xb5,0xd5,0x02,0x13,0xcb,0xd5,0x02,0x1f,0xb0,
-0xd5,0x02,0x11,0x33,0x11,0x00,0x02,0x6f,0xc8,0x12,0x8f,0x5a,0x10,0x02,0x97,0xe1,
-0x14,0xa0,0xf1,0xb3,0x04,0xa6,0xe1,0x04,0x0f,0x00,0x03,0xa2,0xe1,0x13,0x5f,0xf3,
-0x32,0x08,0x9e,0xe1,0x22,0x02,0x30,0x6f,0x21,0x12,0xbc,0x64,0x01,0x22,0x0b,0xc0,
-0x6d,0x21,0x13,0xbc,0x1b,0x02,0x12,0xc7,0xfe,0x9b,0x13,0xbc,0x1a,0x02,0x03,0x91,
-0x03,0x12,0xbc,0x19,0x02,0x22,0x0b,0xc0,0x67,0x21,0x12,0xbc,0x60,0x01,0x22,0x0b,
-0xc0,0x65,0x21,0x14,0xbc,0xfb,0x51,0x02,0xb3,0x36,0x12,0x11,0x12,0x07,0x22,0x0b,
-0x90,0x87,0x10,0x94,0xba,0x00,0x08,0xf2,0x21,0x11,0x11,0x2c,0xa0,0x6e,0xbd,0x01,
-0x85,0xc6,0x22,0x5e,0xa0,0x1e,0x00,0x12,0xda,0x2d,0x00,0x00,0xdf,0xc6,0x03,0x01,
-0x44,0x07,0x85,0xc6,0x00,0x32,0xc7,0x31,0x04,0xac,0xc7,0x20,0x34,0x40,0x07,0xfc,
-0x89,0xfc,0x4f,0x46,0x50,0x02,0xfb,0x00,0x04,0xf6,0x11,0x00,0x20,0x7f,0x20,0x84,
-0x03,0x32,0x0d,0xb0,0x0a,0xbf,0xcf,0x31,0xdb,0x00,0xad,0x4a,0x03,0x22,0x0d,0xb0,
-0xe1,0x0e,0x20,0x00,0xdb,0xf3,0x0c,0x11,0x0d,0xf0,0xda,0x40,0xee,0x20,0x09,0xf3,
-0x6b,0x00,0x01,0xa2,0x1d,0x00,0x14,0x00,0x37,0x01,0x68,0x72,0x2b,0x51,0x18,0x06,
-0x2e,0x55,0x23,0x0a,0xc0,0x9a,0x05,0x13,0xec,0x8d,0x18,0x21,0x1f,0x90,0x92,0x35,
-0x00,0x91,0xf2,0x11,0x02,0xe0,0x7c,0x50,0xec,0xfc,0x00,0xaf,0xfd,0xa2,0x11,0x51,
-0x24,0xf9,0x3f,0x63,0xfc,0x0f,0x41,0x40,0xff,0xb0,0x04,0xfc,0x8f,0x01,0x50,0x0b,
-0xd1,0x00,0x03,0xd5,0x99,0x05,0x07,0x69,0x87,0x18,0x35,0xd2,0xb4,0x41,0x6e,0xee,
-0xef,0xff,0xcb,0x2d,0x54,0x03,0x78,0x87,0x7c,0xf1,0x3c,0x83,0x14,0xbd,0xd1,0x14,
-0x10,0x0f,0x79,0x5f,0x04,0xfe,0xc4,0x14,0x9f,0x1c,0x00,0x15,0x09,0x6a,0x4d,0x11,
-0x9f,0x44,0x03,0x04,0xe8,0x4f,0x01,0x57,0x34,0x10,0x8f,0xe9,0x07,0x23,0xbe,0x7f,
-0xe7,0x4f,0x32,0x4f,0x60,0xec,0x25,0x1a,0x41,0x0d,0xc0,0x05,0xf6,0x13,0x00,0x20,
-0x09,0xf2,0xe5,0x14,0x12,0x8e,0x66,0x3d,0x20,0x2f,0x90,0x13,0x00,0x11,0xa9,0xf4,
-0x0e,0x0f,0xab,0xc2,0x1c,0x0c,0x6f,0xe6,0x00,0x75,0xcf,0x12,0x9e,0x73,0x0b,0x02,
-0xaa,0x88,0x31,0x25,0x54,0x44,0xcc,0x34,0x01,0x34,0x01,0x13,0xb0,0x43,0x00,0x23,
-0x09,0xf4,0x43,0x00,0x00,0x00,0x49,0x20,0x08,0xf6,0xea,0x03,0x00,0xa7,0x07,0x10,
-0x8f,0x1d,0x09,0x23,0x9f,0xfd,0x33,0x09,0x33,0x6f,0x93,0xfb,0x38,0x35,0x32,0xb0,
-0x05,0xf8,0x3e,0xca,0x41,0xb0,0x00,0x07,0xf5,0x65,0x7c,0x10,0x90,0x93,0x42,0x00,
-0xb5,0x00,0x1e,0x30,0xd9,0xbb,0x02,0xbe,0x3f,0x11,0xe9,0x59,0xa8,0x00,0x19,0x56,
-0x1d,0xf0,0xa7,0x38,0x1e,0x0a,0xc4,0xad,0x06,0x13,0x00,0x15,0xad,0x7d,0x14,0x1a,
-0x70,0xe2,0x4f,0x00,0x52,0xdf,0x13,0x07,0x20,0x87,0x02,0x63,0x0c,0x42,0x02,0x55,
-0x54,0x4a,0xf0,0x69,0x02,0xa0,0x37,0x03,0x0a,0x00,0x12,0x6f,0x30,0x81,0x02,0x8f,
-0x6e,0x02,0x0a,0x00,0x24,0x0b,0xf6,0x0a,0x00,0x10,0x8f,0x14,0x00,0x00,0xa7,0x01,
-0x40,0x05,0xfa,0x3f,0xa0,0x18,0x59,0x61,0x40,0x00,0x5f,0xc0,0x06,0xf7,0x1e,0x00,
-0x24,0x06,0xfb,0x06,0x4f,0x20,0x2f,0xa0,0xce,0x2f,0x10,0x06,0x9a,0x1a,0x0a,0x1d,
-0xc5,0x03,0x0a,0x00,0x15,0xd6,0x0a,0x00,0x14,0xf8,0x54,0x6e,0x0e,0xee,0x19,0x0f,
-0xe2,0x4f,0x1c,0x10,0x02,0xb7,0x44,0x33,0x56,0x66,0x78,0x1a,0x32,0x35,0xff,0xfe,
-0xef,0x8a,0x02,0x24,0x0e,0xc0,0x0a,0x00,0x23,0x8f,0x40,0x0a,0x00,0x20,0x03,0xfa,
-0x22,0xdd,0x10,0x11,0xe1,0x17,0x00,0xb6,0x0e,0x01,0x36,0x05,0x20,0xdf,0xf9,0x87,
-0x02,0x62,0x55,0x30,0x00,0x0c,0xf4,0x9f,0xad,0x6d,0x51,0x01,0xcf,0x40,0x0a,0xf5,
-0x0a,0x00,0x20,0x2d,0xe3,0xa2,0x15,0x00,0x0a,0x00,0x10,0x5c,0x3c,0x07,0x16,0x50,
-0xf8,0x4e,0x00,0xe6,0xe0,0x06,0x3a,0x23,0x05,0xc7,0x21,0x03,0xd8,0x2e,0x29,0x0a,
-0xe0,0xa3,0x01,0x01,0x43,0x91,0x11,0x8d,0x8e,0xab,0x01,0x08,0x0a,0x19,0x80,0x55,
-0xe7,0x06,0x0a,0x00,0x11,0x08,0xdb,0x2e,0x11,0xf6,0x62,0xda,0x00,0x6d,0x0b,0x19,
-0x61,0xe6,0x00,0x22,0x34,0x45,0xa3,0x7f,0x11,0x0a,0x0a,0x01,0x01,0x81,0x49,0x44,
-0x11,0x10,0xbf,0x10,0x01,0x9a,0x03,0x7a,0xe2,0x01,0xa9,0x37,0x12,0x8f,0xc3,0x8a,
-0x03,0x3a,0x53,0x20,0x01,0xef,0xa7,0x02,0x73,0xee,0xeb,0x00,0x00,0xcf,0xde,0x10,
-0x4d,0x85,0x12,0x51,0x3c,0x6a,0x00,0xb9,0xf8,0x01,0x15,0xcd,0x00,0xbe,0xd8,0x10,
-0x05,0x33,0x47,0x01,0x85,0x0c,0x17,0x04,0xe2,0x4f,0x12,0x6b,0x8b,0x01,0x13,0x45,
-0xf4,0x39,0x14,0x2b,0x1e,0xf5,0x51,0x1e,0xe6,0x10,0x02,0x8f,0x06,0x22,0x14,0xf3,
-0xdc,0x6b,0x14,0xbe,0x11,0x43,0x24,0x0a,0xf0,0x17,0x0f,0x00,0xa5,0x0a,0x23,0x1b,
-0xf1,0xc1,0xe5,0x22,0xae,0xf6,0xd0,0x2c,0x5c,0xcd,0xcb,0x82,0x00,0x00,0xed,0xb3,
-0x60,0x03,0xf2,0x08,0x9a,0xab,0xc3,0xdf,0xe3,0x50,0x21,0xbc,0xcc,0xdf,0x60,0xf0,
-0xe3,0x01,0xec,0x1c,0x11,0x8e,0x2c,0x5a,0x10,0x9f,0x8b,0x79,0x11,0xf2,0x28,0x06,
-0x10,0x9e,0x11,0x00,0x23,0x04,0xf5,0x11,0x00,0x10,0xae,0xff,0x30,0x21,0x8f,0x20,
-0x9d,0x4d,0x00,0x77,0x0d,0x23,0x07,0xff,0x34,0xe4,0x31,0xec,0xf7,0x00,0x44,0x00,
-0x31,0x6f,0x3a,0xe0,0x11,0x00,0x31,0x0e,0xa0,0x3f,0x55,0x00,0x41,0x09,0xf2,0x00,
-0xbd,0x45,0xe4,0x40,0xf7,0x00,0x03,0xf5,0x11,0x00,0x10,0xbc,0xb6,0x02,0x40,0x8e,
-0x00,0x4f,0x24,0xd1,0x47,0x02,0x77,0x00,0x01,0x9e,0x1e,0x02,0xc9,0x14,0x14,0x08,
-0x48,0x4f,0x13,0x8f,0x11,0x00,0x4d,0x04,0x90,0x03,0xf2,0xac,0x25,0x11,0x10,0x7f,
-0x46,0x00,0xd7,0x4f,0x10,0x08,0xdd,0x55,0x00,0x08,0x4f,0x51,0x02,0x55,0x54,0x8f,
-0x70,0x08,0x4f,0x00,0xb1,0x0e,0x02,0x08,0x4f,0x23,0x03,0xf9,0x08,0x4f,0x22,0x0d,
-0xf1,0xce,0x4f,0x23,0x00,0x7f,0x09,0x00,0x32,0x03,0xfc,0xeb,0x1b,0x00,0x41,0x1d,
-0xe1,0x4f,0x80,0x09,0x00,0x40,0xbf,0x30,0x07,0xf4,0x36,0x00,0x01,0x3d,0x47,0x32,
-0x16,0xf1,0x04,0x3d,0x47,0x00,0xd7,0x4f,0x1f,0x01,0xd7,0x4f,0x4e,0x03,0x27,0x22,
-0xc2,0x6c,0xcd,0xde,0xee,0x30,0x00,0x0e,0x74,0x99,0x98,0x8b,0xf4,0xa3,0x27,0x12,
-0x8f,0x9c,0x61,0x00,0xf0,0x1a,0x12,0xe7,0x99,0x0c,0x22,0x0e,0x70,0x06,0x26,0x10,
-0xe8,0x9c,0x01,0x20,0x17,0x77,0xb0,0x50,0x21,0xf7,0x03,0x95,0x13,0x12,0xdf,0xcf,
-0xc8,0x30,0x6f,0xaf,0x50,0x1e,0x00,0x31,0x0e,0xa0,0xeb,0x2b,0xe6,0x10,0xf2,0x72,
-0x36,0x31,0xd9,0x03,0xf7,0xf1,0x06,0x21,0x90,0xdb,0x6d,0x10,0x30,0xd9,0x8e,0x10,
-0xd2,0xcc,0x31,0x0c,0x93,0x20,0x74,0x55,0x13,0xc8,0x96,0x40,0x19,0x80,0xc6,0xa4,
-0x13,0x0e,0xef,0x00,0x17,0x83,0x62,0x0d,0x62,0x12,0x20,0x00,0x00,0xab,0x03,0xa3,
-0x20,0x62,0xbd,0x00,0x44,0x44,0x46,0xf9,0x6c,0xe0,0x23,0x09,0xf2,0x74,0xe0,0x12,
-0xa0,0x08,0x00,0x50,0xcf,0x10,0x02,0x22,0xbd,0x4e,0xe8,0x00,0x26,0x2d,0x00,0x39,
-0x82,0x90,0x10,0x03,0x33,0xcd,0x00,0x01,0xee,0x5f,0xb0,0x3b,0x05,0x20,0x1d,0xf2,
-0x7a,0xe5,0x40,0xad,0x01,0xde,0x30,0xcf,0xe1,0x31,0xbd,0x0d,0xe2,0x7d,0x07,0x13,
-0xbc,0x55,0xd2,0x16,0xab,0x70,0x00,0x10,0xac,0x0c,0x17,0x40,0xd4,0x00,0x00,0x8a,
-0x5b,0x74,0x04,0x16,0x21,0x0f,0x7f,0x3b,0x0d,0x15,0xf9,0xcf,0xf7,0x09,0x01,0x00,
-0x00,0x54,0x67,0x40,0xbc,0xdd,0xde,0xe9,0x54,0x01,0x53,0x07,0x87,0x77,0x7f,0xb0,
-0x51,0xe6,0x13,0xf5,0xbe,0x03,0x02,0x3f,0x26,0x02,0xa8,0x22,0x10,0x8f,0x4e,0x03,
-0x21,0xb0,0x03,0xf4,0x11,0x60,0x0d,0xfd,0x00,0x06,0x66,0xbf,0x2d,0x30,0x12,0xf9,
-0x9e,0x87,0x12,0xf7,0x98,0x06,0x20,0x08,0xf9,0x9b,0xed,0x41,0x08,0xe0,0x08,0xf8,
-0xa0,0x4c,0x11,0x9e,0xfa,0xbf,0x16,0x17,0xdd,0x01,0x25,0x9d,0x00,0x15,0x5b,0x02,
-0x59,0x2f,0x1f,0x59,0xfc,0x46,0x25,0x01,0x38,0x28,0x40,0x05,0x56,0x66,0x77,0xfd,
-0xb8,0x54,0x03,0xff,0xff,0xee,0xfb,0x28,0x64,0x12,0x70,0x55,0x02,0x23,0x0d,0xe0,
-0xfd,0x9d,0x20,0xf6,0x01,0x36,0x28,0x00,0x54,0x6e,0x30,0x3d,0xdd,0xff,0x7b,0x1c,
-0x11,0xf3,0x77,0x02,0x40,0x02,0xee,0x3d,0xe2,0x22,0x00,0xf0,0x04,0x03,0xee,0x20,
-0x2e,0xd1,0x00,0x09,0xf0,0x04,0xfd,0x20,0x00,0x2e,0xd0,0x00,0x9e,0x00,0xeb,0x10,
-0x17,0x48,0x35,0x09,0xe0,0x01,0x26,0x48,0x02,0xfa,0xa9,0x12,0x60,0x21,0x1f,0x2c,
-0xee,0xfe,0xb2,0x02,0x13,0x9e,0x5b,0x46,0x00,0x72,0x70,0x68,0xbf,0xa9,0x99,0x99,
-0x99,0x94,0xe8,0x1d,0x03,0xa3,0x03,0x10,0x09,0xf2,0x75,0x00,0xaf,0x20,0x17,0x16,
-0x03,0xe2,0x00,0xd7,0x08,0x30,0x23,0x34,0x45,0xab,0xf0,0x12,0x04,0x30,0x1b,0x51,
-0xdb,0x00,0x21,0x11,0x16,0x63,0x4f,0x01,0x9f,0x03,0x01,0x08,0x00,0x00,0x1d,0x61,
-0x11,0xcb,0x1d,0x4e,0xf1,0x00,0x4d,0xdd,0xfb,0x00,0x00,0x0c,0xfb,0x00,0x28,0x88,
-0xeb,0x00,0x00,0xaf,0xaf,0x18,0x00,0x10,0x09,0x7b,0x01,0x00,0x93,0x4f,0x10,0x80,
-0xfa,0x3c,0x31,0xcb,0x0a,0xf7,0x26,0xe4,0x20,0xdb,0x0c,0x95,0x12,0x15,0x60,0x93,
-0x4f,0x12,0x21,0x79,0x00,0x2f,0x78,0x72,0x6f,0xe6,0x34,0x40,0x13,0x00,0x34,0x44,
-0xf3,0xf0,0x22,0x9e,0x02,0xb8,0x00,0x62,0xad,0x00,0x11,0x11,0x14,0xf8,0x03,0x08,
-0x11,0x0b,0x48,0x4d,0x00,0x8b,0x3a,0x30,0x02,0x22,0xad,0xcf,0x38,0x30,0x00,0x7f,
-0xff,0xc6,0x0b,0xa1,0xfe,0x10,0x04,0x44,0xbd,0x00,0x00,0xbf,0x7e,0xc0,0x58,0x3a,
-0x30,0xf5,0x03,0xfb,0x08,0x00,0x20,0xbf,0x50,0x4a,0x26,0x11,0xad,0x17,0x3b,0x54,
-0xe1,0x00,0x9d,0x07,0x20,0x34,0x33,0x03,0x22,0x8b,0x02,0xe6,0x19,0x13,0x9b,0x9d,
-0x35,0x10,0xab,0x93,0x4c,0x43,0x11,0x11,0x12,0xbb,0xc8,0x00,0x00,0xa3,0x50,0x00,
-0x09,0xbf,0x13,0xdc,0x33,0x30,0x00,0xc1,0x38,0x03,0x75,0x56,0x13,0x6f,0x65,0x38,
-0x08,0x0d,0xbf,0x20,0x00,0x13,0x70,0x01,0x07,0xb8,0x00,0x63,0x9f,0x00,0x12,0x11,
-0x14,0xf9,0x7a,0x70,0x12,0xf2,0x08,0x00,0x22,0x3f,0x90,0xed,0x02,0x20,0xdf,0x10,
-0x31,0x02,0x00,0x50,0x42,0x10,0x18,0xa8,0xa5,0x30,0x5f,0xdf,0x70,0x18,0x00,0x22,
-0x03,0xfc,0xeb,0x02,0x20,0x3f,0xd1,0x06,0x14,0x40,0x9f,0x04,0xfd,0x10,0x70,0x01,
-0x31,0x9f,0x0e,0xb0,0x70,0x01,0x27,0x9f,0x02,0x57,0x24,0x33,0x35,0x54,0x20,0x0a,
-0xfa,0x20,0xfd,0x50,0x5b,0x1a,0x43,0x30,0x01,0x4c,0xf4,0xde,0x33,0x13,0xdb,0xc1,
-0x11,0x12,0xae,0x64,0x16,0x00,0x20,0x04,0x20,0x0e,0xe2,0xcc,0x8f,0x00,0x1d,0x12,
-0x40,0xa8,0x78,0xcf,0xd1,0x6c,0x31,0x16,0xbd,0xf7,0x70,0x13,0x04,0x35,0x9c,0x60,
-0x04,0xf2,0x09,0xbb,0xbb,0xb2,0xf2,0xa6,0x52,0x21,0xbc,0xcb,0xdf,0x50,0xb4,0x4c,
-0x20,0x06,0xf2,0x11,0x00,0x10,0x20,0x4e,0x00,0x22,0x02,0xf4,0xa0,0x06,0x00,0x11,
-0x00,0x40,0x10,0x00,0x04,0xf5,0x11,0x00,0x00,0x90,0x20,0x30,0x03,0x99,0xaf,0x11,
-0x00,0x60,0x1f,0xc0,0x4c,0xcc,0xf4,0x04,0xbb,0x4e,0x12,0x20,0x22,0x00,0x22,0xec,
-0xf9,0x22,0x00,0x31,0x7f,0x38,0xf1,0x11,0x00,0x40,0x0e,0xb0,0x1f,0x80,0x11,0x00,
-0x40,0x08,0xf3,0x00,0x9e,0x11,0x00,0x40,0x12,0xf8,0x00,0x01,0xa7,0x18,0x20,0xf1,
-0xad,0x92,0x4e,0x40,0x1f,0x40,0x4f,0x23,0x8f,0x3b,0x12,0x01,0x34,0x4d,0x01,0x69,
-0xa7,0x17,0x20,0x45,0x4d,0x07,0xdf,0xe7,0x1e,0x70,0xa0,0x06,0x01,0xa3,0x3b,0x70,
-0x22,0x00,0x01,0xf3,0x07,0xf0,0x09,0xcc,0x0e,0xd1,0x02,0xf5,0x07,0xf1,0x02,0x55,
-0x44,0x8f,0x60,0x02,0xf6,0x07,0xf1,0x22,0x1c,0x21,0x01,0xf6,0x5a,0x16,0x00,0x42,
-0x8b,0x00,0xd5,0x09,0x41,0x1e,0xe0,0x1e,0xff,0x09,0x00,0x50,0xaf,0xf6,0x06,0x66,
-0xf6,0x3f,0x4c,0x50,0xf7,0xaf,0x20,0x00,0xf6,0x69,0x4f,0x30,0xa0,0x0d,0xd0,0x09,
-0x00,0x50,0x02,0xec,0x00,0x02,0xfa,0x09,0x00,0x00,0xc4,0x51,0x70,0x4f,0x21,0xf6,
-0x07,0xf1,0x09,0x10,0x72,0x00,0x13,0xc3,0x1b,0x15,0x14,0x04,0x1f,0x6e,0x05,0x00,
-0xd8,0x1c,0xbf,0x77,0x46,0x14,0x0d,0x10,0x2a,0x20,0xaf,0x73,0xb5,0x8c,0x00,0xd4,
-0x04,0x11,0x00,0xb6,0x8c,0x10,0x02,0xa4,0xff,0x10,0xaf,0xb0,0xf7,0x13,0xd4,0x77,
-0x46,0x1f,0x03,0xbc,0x65,0x01,0xd2,0xe5,0x7c,0xdd,0xde,0xfe,0x20,0x00,0x0f,0x65,
-0x99,0x98,0x8c,0xf3,0x65,0x59,0x12,0xae,0x31,0x97,0x50,0x0e,0xa0,0x01,0x11,0xf6,
-0x27,0x0c,0x11,0x0d,0x19,0x7e,0x52,0xae,0x00,0x35,0x55,0xf6,0xc6,0x5a,0x00,0x21,
-0x32,0x12,0xf5,0xad,0x21,0x21,0xef,0xc0,0x0f,0x00,0xf0,0x01,0x8f,0xaf,0x30,0x8a,
-0xaa,0xf7,0x00,0x1f,0x91,0xfa,0x09,0xbb,0xbf,0x70,0x0a,0xe1,0x21,0x1b,0xa1,0xe7,
-0x05,0xf6,0x00,0x1e,0x90,0x00,0x0e,0x71,0xea,0xfd,0x02,0x21,0xe7,0x9d,0x84,0x24,
-0x31,0x0e,0x73,0x10,0x7d,0x15,0x1a,0xe7,0x56,0x77,0x19,0xf6,0xa9,0x97,0x00,0x0b,
-0x42,0x41,0xbe,0xee,0xee,0xef,0xb5,0x45,0x00,0x8b,0xbb,0x24,0xaf,0xa0,0x75,0x7d,
-0x04,0x4e,0x32,0x24,0x1d,0xf4,0x09,0x00,0x14,0xf6,0x09,0x00,0x04,0x13,0x01,0x33,
-0x4e,0xfa,0xfd,0xc5,0x68,0x10,0xe4,0x36,0x7f,0x00,0xec,0x17,0x50,0xa1,0x00,0x01,
-0xaf,0xa1,0x69,0x17,0x10,0x30,0x1a,0x15,0x11,0xc0,0xd6,0x01,0x14,0x3e,0xdc,0x01,
-0x0e,0x0b,0xe4,0x08,0x80,0xee,0x15,0x10,0xda,0xc9,0x0c,0xd9,0xb9,0x10,0x56,0xb5,
-0x62,0x03,0x47,0xce,0x15,0xed,0xad,0x16,0x23,0x6f,0xe4,0xa2,0x01,0x24,0xcf,0xc2,
-0xd7,0x2d,0x13,0xf6,0xf5,0x7e,0x21,0xfa,0x5c,0x3d,0xfa,0xfe,0x02,0x08,0xef,0xa2,
-0x00,0x05,0xdf,0xc4,0x00,0x00,0x03,0xc7,0x10,0x07,0xd0,0x00,0x49,0x70,0x9c,0x4c,
-0x01,0x8e,0x20,0x12,0x88,0x11,0x29,0x01,0x1e,0xab,0x04,0x19,0x0b,0x0f,0x15,0x4c,
-0x06,0x20,0x00,0x38,0x79,0xd6,0x1f,0xbf,0x4e,0xda,0x25,0x13,0x15,0xf9,0x9c,0x23,
-0x66,0x66,0xd8,0x96,0x01,0x34,0x8b,0x01,0x4e,0x01,0x13,0xf5,0x97,0x00,0x23,0xfd,
-0x30,0xe8,0x4a,0x22,0xf5,0x00,0xe7,0xfb,0x31,0xb6,0xdf,0xb2,0x6d,0x57,0xea,0xc4,
-0x00,0x06,0xef,0xa3,0x00,0x00,0x4e,0x92,0x00,0x47,0x00,0x06,0xc9,0x97,0x28,0x14,
-0x8f,0x6e,0x0c,0x19,0x9f,0x5d,0x29,0x11,0x16,0x31,0xc9,0x02,0x10,0xda,0x0f,0x10,
-0x4c,0x3d,0x04,0x97,0x01,0x00,0x4c,0x95,0x14,0xdf,0xc6,0x00,0x23,0x7f,0xe3,0x8a,
-0x1f,0x22,0xfa,0x10,0xb1,0xff,0x12,0xff,0x09,0x00,0x40,0x3a,0xfe,0x61,0x8f,0xaa,
-0x69,0xb0,0x2c,0xfd,0x60,0x24,0x01,0x8e,0xf7,0x00,0x00,0x27,0x30,0xb4,0x00,0x1f,
-0x54,0x98,0xba,0x06,0x40,0xfe,0xee,0xec,0x27,0xab,0x64,0x1b,0x77,0xdd,0xbb,0x17,
-0x04,0x82,0x16,0x02,0x98,0x1f,0x1f,0xa2,0x82,0x16,0x02,0x18,0xd0,0x82,0x16,0x10,
-0xce,0xe9,0x24,0x01,0x63,0x9a,0x07,0x82,0x16,0x2e,0xb9,0x40,0xc1,0xfa,0x22,0x01,
-0xf6,0xb1,0x44,0x11,0xfb,0x0a,0x00,0x00,0x25,0x13,0x14,0xfd,0x34,0x03,0x24,0x07,
-0xf6,0x0a,0x00,0x24,0x1f,0xc0,0x0a,0x00,0x00,0xe0,0x19,0x12,0xf7,0x60,0x2a,0x14,
-0x20,0x54,0x25,0x23,0xae,0xd0,0xa1,0x71,0xb0,0xf9,0x04,0xfa,0x00,0x00,0xfb,0x88,
-0x81,0x00,0x8f,0x90,0x9c,0x07,0x00,0xd6,0xc4,0x11,0xf7,0xd3,0x1e,0x00,0x4e,0x41,
-0x43,0x40,0x03,0xb0,0x00,0xb7,0xdf,0x01,0x84,0x04,0x0f,0x0a,0x00,0x08,0x30,0x12,
-0x46,0x50,0x6c,0x41,0x02,0x8d,0x0d,0x11,0xf7,0xba,0x8b,0x3f,0x55,0x43,0x00,0x62,
-0x41,0x0c,0x0a,0x5d,0x35,0x00,0xac,0x01,0x23,0x67,0x75,0x05,0xff,0x25,0xfe,0xff,
-0xf5,0x68,0x14,0xf4,0x09,0x00,0x04,0x39,0x00,0x24,0x1c,0xf6,0xbc,0xae,0x04,0x60,
-0x48,0x42,0x8f,0xc5,0xcf,0xa1,0xba,0x42,0x41,0x70,0x00,0x7f,0xe6,0x0e,0x24,0x40,
-0x20,0x00,0x00,0x1a,0x58,0xfe,0x12,0x72,0xd7,0x12,0x0f,0xc4,0x82,0x02,0x00,0x53,
-0xcc,0x00,0xe1,0x1c,0x64,0x02,0x88,0x88,0x88,0x8b,0xf8,0x6b,0x14,0x0b,0xb7,0x9f,
-0x0f,0x13,0x00,0x17,0x02,0x76,0xed,0x0f,0x3a,0x03,0x0d,0x1a,0xfe,0x3a,0x03,0x71,
-0x04,0xcf,0xc7,0xef,0xa2,0x00,0x00,0x04,0x04,0x10,0x07,0x0a,0x00,0x20,0x4f,0x93,
-0x55,0x00,0x1f,0xc9,0xbb,0x82,0x06,0x58,0x78,0x88,0x86,0x5e,0xee,0x19,0x4c,0x0a,
-0x9f,0x3f,0x00,0x19,0x4c,0x14,0x80,0x19,0x4c,0x13,0x80,0xeb,0x03,0x2f,0x0b,0x40,
-0x19,0x4c,0x1f,0x0e,0x3a,0x03,0x07,0xd0,0x04,0x33,0x2c,0xfc,0x20,0x60,0x0f,0x12,
-0xf7,0x7e,0xc8,0x40,0xef,0x94,0xbf,0xd5,0x25,0x6d,0xa0,0xff,0x92,0x00,0x04,0xcf,
-0xd4,0x00,0x00,0x3b,0x61,0x8c,0x00,0x1c,0x97,0xde,0xd6,0x40,0x78,0x88,0x87,0x5f,
-0x44,0x4a,0x00,0x8b,0xa1,0x0f,0x0d,0x84,0x03,0x33,0x9f,0x31,0x00,0x99,0x25,0x22,
-0xff,0xc4,0x7f,0x93,0x31,0x00,0x05,0xcf,0x0f,0x1e,0x04,0xfd,0x48,0x0e,0x41,0x4f,
-0x14,0xbf,0xf7,0x48,0x23,0x1e,0xfb,0x59,0x87,0x23,0x00,0x7a,0xf6,0x48,0x0f,0x97,
-0x05,0x03,0x24,0x7f,0xe4,0x13,0xfa,0x13,0xc1,0x77,0x27,0x13,0xff,0x66,0xd2,0x51,
-0x7f,0xf9,0x4b,0xfd,0x50,0xc9,0x00,0x12,0x91,0xc9,0x00,0x30,0x03,0xb6,0x10,0x50,
-0x05,0x0c,0x52,0x27,0x02,0x0e,0x01,0x05,0x90,0x24,0x00,0x32,0x4b,0x00,0xde,0x00,
-0x1f,0x60,0x97,0x05,0x4e,0x04,0xae,0x11,0x15,0x02,0x6c,0x69,0x43,0x34,0x44,0x43,
-0x4c,0x28,0xfe,0x33,0x06,0xef,0x80,0x08,0x00,0x02,0x35,0x03,0x50,0x29,0xff,0xb7,
-0xef,0xa4,0x20,0x7d,0xa1,0xfe,0x82,0x00,0x05,0xcf,0xd6,0x00,0x00,0xa9,0x40,0x78,
-0xd5,0x0d,0xab,0x4c,0x36,0x33,0x32,0x7f,0xab,0x4c,0x11,0x21,0xc5,0x9e,0x1b,0x31,
-0x51,0xe6,0x24,0x77,0x60,0xf1,0xa0,0x13,0xf1,0x32,0x1d,0x09,0xbc,0x1d,0x01,0xd6,
-0x6f,0x24,0x7b,0xf1,0x91,0x11,0x1f,0xc0,0x4c,0x84,0x0a,0x20,0x01,0x67,0x69,0x40,
-0x1b,0x62,0x66,0x02,0x1f,0xde,0x66,0x02,0x05,0x15,0x18,0x66,0x02,0x33,0x93,0xbf,
-0xe6,0x9d,0x01,0x70,0x03,0xbf,0xe5,0x00,0x00,0x3a,0x61,0x9e,0x00,0x1c,0x86,0x16,
-0x45,0x07,0x26,0x9a,0x03,0x16,0x45,0x03,0xb4,0xe6,0x0f,0x22,0x1c,0x49,0x04,0x01,
-0x00,0x40,0xe8,0x3c,0xcc,0xcd,0xe4,0x0f,0x52,0x92,0x9a,0x99,0x9b,0xf4,0x36,0x1a,
-0x12,0x8f,0x45,0x1a,0x21,0x0d,0xc0,0x56,0x16,0x12,0x01,0x66,0x16,0x01,0x9c,0x0c,
-0x12,0xdb,0x6e,0x00,0x20,0x0d,0xb0,0x38,0xb5,0x01,0x0f,0x00,0x12,0xdf,0x17,0x5d,
-0x21,0x7f,0x9f,0xde,0xdd,0x30,0x1e,0xa0,0xdd,0x2d,0x00,0x20,0x09,0xf1,0xd6,0x16,
-0x30,0xda,0x04,0xf6,0x4d,0x49,0x31,0x0d,0xa1,0xea,0x9d,0x12,0x21,0xda,0x8d,0x87,
-0x5b,0x29,0x0d,0xa1,0xdb,0x67,0x04,0xc9,0x86,0x1a,0xdb,0x0f,0x00,0x1b,0x97,0xe4,
-0x0f,0x10,0xd9,0x1d,0x24,0x01,0x1a,0xb5,0x42,0x54,0x44,0x38,0xf7,0x7f,0x21,0x22,
-0x0d,0xe0,0x08,0x00,0x00,0xd2,0x9d,0x13,0xeb,0xa2,0xfc,0x10,0xdb,0x6c,0x43,0x02,
-0x08,0x00,0x31,0x8f,0xdf,0x30,0xea,0x1c,0x31,0xfa,0x0d,0xe1,0x40,0x17,0x10,0xb0,
-0xd4,0x62,0x31,0xeb,0x07,0xfa,0x96,0xfd,0x31,0xea,0x0f,0x80,0x61,0x6e,0x2d,0xea,
-0x01,0xda,0x1b,0xde,0x9b,0xbb,0xbb,0xcc,0xcc,0xb2,0x00,0x00,0xbb,0xbb,0xbb,0xba,
-0xab,0x74,0x99,0x0e,0x08,0x00,0x08,0x25,0x06,0x1b,0x93,0xe3,0x0f,0x50,0xd0,0x0b,
-0xcd,0xdd,0xee,0x36,0x60,0x00,0xe2,0x0f,0x12,0xc0,0x1f,0x09,0x13,0x6f,0x71,0xfd,
-0x12,0xde,0x18,0x04,0x22,0x08,0xf5,0x08,0x00,0x22,0x3f,0xd0,0xdc,0x56,0x21,0xef,
-0xf4,0x08,0x00,0x31,0x0c,0xf3,0xce,0xab,0x13,0x30,0xbf,0x40,0x2e,0x0d,0x1a,0xa0,
-0x1c,0xf5,0x00,0x04,0xf9,0x00,0x08,0xe0,0xae,0x30,0xf3,0x1c,0x39,0x08,0xe0,0x32,
-0x08,0x0f,0x07,0x6d,0x1b,0x23,0x00,0xf9,0xc9,0x11,0x0c,0x27,0x9a,0x09,0x6d,0x1b,
-0x13,0x82,0xd9,0x0f,0x0c,0xa1,0x7b,0x41,0x22,0x00,0x33,0x44,0x14,0x0f,0x12,0x06,
-0x60,0x05,0x00,0x14,0x0f,0x00,0x2f,0x0b,0x13,0xcb,0xc9,0x63,0x22,0xcb,0x00,0xb7,
-0xfe,0x21,0xcc,0x00,0xba,0x66,0x00,0x08,0x00,0x22,0x2e,0xfc,0xcb,0x4c,0x21,0xdf,
-0x7f,0xcb,0x4c,0x20,0x1c,0xf4,0xd5,0x07,0x40,0xcc,0x01,0xdf,0x50,0x6f,0x2c,0x31,
-0xcb,0x0d,0xe3,0xfe,0x53,0x31,0xdb,0x08,0x20,0x6e,0x3b,0x16,0xda,0x33,0x4d,0x10,
-0x26,0x55,0xdb,0x24,0x71,0x00,0x05,0x1a,0x02,0x44,0x0a,0x1f,0xe9,0x08,0x00,0x08,
-0x17,0x32,0x14,0x0f,0x1b,0xf6,0x14,0x0f,0x14,0x42,0xb8,0x00,0x03,0x1f,0x95,0x10,
-0xdc,0xb8,0x00,0x12,0xf6,0xb4,0x2d,0x22,0x0e,0xd0,0x7e,0x2c,0x0c,0xb8,0x00,0x13,
-0xfd,0xb8,0x00,0x20,0x6f,0xa0,0x08,0x00,0x20,0x1d,0xf3,0xd3,0x02,0x40,0xcb,0x01,
-0xdf,0x40,0x29,0x00,0x31,0xdb,0x0d,0xe3,0x50,0x03,0x31,0xdb,0x07,0x10,0x0c,0x04,
-0x24,0x64,0x00,0x18,0xce,0x23,0x00,0x8e,0x30,0x02,0x13,0x9e,0x86,0xdf,0x63,0x9e,
-0x21,0x11,0x11,0x12,0xd9,0x98,0x41,0x00,0x7e,0xfe,0x00,0x14,0x0f,0x13,0xe9,0x20,
-0x00,0x07,0x08,0x00,0x13,0x8f,0xb8,0x00,0x18,0x14,0x14,0x0f,0x18,0x62,0xfe,0x16,
-0x61,0x1d,0xef,0xf8,0x5e,0xff,0xf2,0x98,0xe0,0x71,0x77,0xf9,0x27,0x7b,0xf2,0x00,
-0xf9,0x3e,0x09,0x00,0x36,0x02,0x11,0xf9,0x41,0x0a,0x00,0xa5,0x1a,0x02,0x7e,0xc7,
-0x00,0x20,0x1b,0x12,0xe9,0x49,0x6e,0x24,0x2f,0x60,0x75,0xe1,0x21,0x6f,0x20,0x0a,
-0x00,0x20,0x3f,0xa0,0x7a,0x29,0x00,0x93,0xa4,0xe1,0x8f,0xf0,0x00,0xff,0x70,0x00,
-0xec,0x77,0x60,0x00,0xde,0xf5,0x04,0xfe,0x3c,0x00,0x62,0x03,0xf6,0xda,0x09,0xe6,
-0xf2,0xde,0xdd,0x60,0x7f,0x2e,0x80,0xf8,0x00,0xd9,0xa9,0x19,0x60,0x1f,0xcf,0x20,
-0x9e,0x00,0xd9,0xc6,0x05,0x90,0x0a,0xfb,0x00,0x2f,0x60,0xd9,0x00,0x00,0xba,0x40,
-0x59,0x35,0x0a,0x80,0xd9,0x74,0x0d,0x0f,0xa9,0x6b,0x15,0x1d,0xa7,0x6f,0xab,0xf0,
-0x06,0xd7,0x04,0xf2,0x08,0xcd,0xc2,0xbc,0xca,0x00,0xe8,0x04,0xf2,0x07,0xab,0xf5,
-0x9a,0xdf,0x00,0xe7,0x04,0xf2,0x4c,0x29,0x50,0xad,0x00,0xf7,0x04,0xf2,0x11,0x18,
-0x10,0xca,0x09,0x00,0x00,0xbd,0x02,0x11,0xe8,0x09,0x00,0x41,0x0c,0xb0,0x02,0xf5,
-0x09,0x00,0xe0,0x0f,0x70,0x05,0xf2,0x00,0xfa,0x68,0xf2,0x00,0x3f,0x60,0x08,0xf2,
-0x00,0xdd,0x15,0x41,0x7f,0xa0,0x0c,0xf7,0x3f,0x00,0x41,0xcf,0xf0,0x1f,0xfc,0x09,
-0x00,0x60,0xf9,0xf4,0x5f,0x7f,0x10,0xe7,0xfa,0x29,0xf0,0x0b,0xd9,0xac,0x1f,0x60,
-0xe7,0x04,0xf2,0x0a,0xc0,0x8e,0xe7,0x0b,0xb0,0xe7,0x04,0xf2,0x0f,0x60,0x2f,0xf1,
-0x05,0xf1,0xe7,0x04,0xf2,0x5f,0x60,0x29,0x51,0xe3,0xe8,0x04,0xf2,0x13,0x35,0x0d,
-0x14,0xe8,0x07,0x2a,0x0f,0x09,0x00,0x08,0x1f,0x83,0xba,0x65,0x03,0x01,0x15,0x15,
-0x70,0x04,0xf3,0x0a,0xff,0xf6,0xff,0xfb,0x8b,0xad,0x90,0x02,0x68,0xf4,0x56,0xea,
-0x00,0xe8,0x04,0xf3,0x57,0x09,0x11,0xf7,0x09,0x00,0x40,0x0a,0xd0,0x03,0xf3,0x5f,
-0x3b,0x00,0xbc,0x20,0x50,0xf0,0x00,0xdf,0xef,0xf3,0x31,0x0f,0xf0,0x1b,0xf4,0x00,
-0xdc,0x79,0xf3,0x00,0xaf,0xe0,0x3f,0xea,0x00,0xd9,0x03,0xf3,0x01,0xf8,0xf4,0xad,
-0x5f,0x10,0xd9,0x03,0xf3,0x08,0xe0,0xab,0xf6,0x0d,0x80,0xd9,0x03,0xf3,0x0f,0x70,
-0x3f,0xd0,0x05,0xf0,0xe9,0x04,0xf3,0x1c,0x65,0x75,0x2e,0x50,0xd8,0xba,0x65,0x19,
-0x11,0xe3,0x15,0x5f,0x76,0x66,0x66,0x65,0x5c,0xe3,0x15,0x2d,0x00,0x57,0x29,0x11,
-0x67,0xe0,0x74,0x51,0x04,0x44,0xaf,0x31,0x44,0x46,0x77,0x00,0xe7,0x3d,0x13,0xdd,
-0x45,0x18,0x12,0x09,0x4b,0xdf,0x40,0xfa,0x00,0x6f,0xfa,0x39,0x00,0x60,0xf7,0x4f,
-0x84,0xf8,0x5f,0xa0,0x5b,0x12,0x30,0x05,0xff,0x80,0x87,0x0b,0x11,0x76,0x3b,0x11,
-0x14,0x26,0xd9,0x1b,0x16,0x00,0x09,0x00,0x05,0xf0,0x22,0x0f,0x15,0x8f,0x16,0x1f,
-0x87,0x15,0x8f,0x2d,0xf1,0x03,0x04,0x00,0x14,0x45,0x11,0x44,0x52,0x00,0x06,0xf0,
-0x0a,0xff,0xfa,0x8f,0xff,0xb0,0x00,0x7f,0xd5,0x14,0x13,0xe9,0xea,0xe2,0x21,0x3f,
-0x50,0x96,0xfe,0x02,0xa3,0x8b,0x50,0x00,0x0e,0xf0,0x00,0xdf,0x12,0x84,0x51,0x04,
-0xff,0x50,0x3f,0xf8,0x39,0xc7,0x40,0xdb,0x0a,0xda,0xe0,0x6d,0x7d,0xf0,0x0a,0x56,
-0xf4,0xf6,0x3f,0x50,0x07,0xf0,0x0b,0xc0,0x0e,0xfd,0x00,0xcb,0x00,0x7f,0x03,0xf3,
-0x00,0x7f,0x40,0x04,0xf0,0x07,0xf0,0x15,0x42,0x11,0x37,0x01,0x00,0x7f,0xf1,0xed,
-0x13,0x01,0x52,0x4b,0x05,0xfa,0x19,0x10,0x15,0x83,0xd5,0x1d,0xbf,0x9c,0xec,0x0e,
-0x11,0x00,0x0b,0x93,0x01,0x17,0x24,0x28,0x49,0x42,0x09,0xa7,0x66,0x40,0x4e,0x06,
-0x38,0x6b,0xde,0xed,0xa5,0x87,0x10,0xf9,0x7a,0x98,0x60,0x77,0x89,0x81,0x00,0x0f,
-0x90,0x96,0xbf,0x54,0xfe,0xff,0x40,0x00,0xe9,0x9d,0x58,0x03,0xde,0x2f,0x14,0xfa,
-0x73,0x16,0x23,0x8f,0x30,0x05,0x22,0x10,0x1f,0x9e,0x89,0x22,0x44,0x42,0xc9,0xe6,
-0x10,0x0e,0x5f,0x70,0x20,0x04,0xff,0x9b,0x7c,0x63,0x22,0x20,0x00,0x01,0xec,0xcd,
-0xd8,0x22,0x32,0xce,0x23,0xf7,0xde,0x03,0x41,0x9f,0x40,0x09,0xf2,0x7f,0x29,0x20,
-0x6f,0x60,0x3c,0x43,0x10,0xd9,0x85,0x68,0x00,0x9c,0x26,0x22,0x0d,0x90,0x1d,0x20,
-0x1f,0x41,0xaa,0xb8,0x14,0x0a,0x0c,0x0c,0x33,0x28,0x64,0x33,0xdf,0x23,0x36,0x2b,
-0xef,0xff,0xa3,0x81,0x03,0x86,0x09,0x44,0x56,0x66,0x77,0x71,0x9f,0x1c,0x24,0xef,
-0xf8,0xa3,0x09,0x24,0x0a,0xf2,0x0a,0x00,0x20,0x6f,0x80,0x11,0x55,0x21,0x60,0x00,
-0x81,0x6a,0x11,0x06,0x67,0x01,0x32,0x2e,0xfd,0x10,0xc5,0x0c,0x42,0x02,0xde,0x6f,
-0xc1,0x0a,0x00,0x50,0x2e,0xe2,0x03,0xfc,0x10,0x0a,0x00,0x00,0x49,0x16,0x11,0x3e,
-0x5a,0x67,0x20,0x0e,0xa1,0x14,0x14,0x2a,0x05,0xf0,0x72,0x44,0x10,0x34,0x15,0x75,
-0x01,0x0a,0x00,0x05,0x1a,0x0a,0x01,0x66,0x7a,0x15,0x17,0x81,0x6c,0x15,0x06,0x81,
-0x6c,0x0c,0x0a,0x00,0x01,0x5e,0xb3,0x19,0xf1,0x11,0xab,0x06,0x3d,0x68,0x32,0x38,
-0x64,0x43,0xa5,0x1b,0x31,0x04,0xcf,0xff,0xd8,0x2d,0x07,0x81,0x03,0x41,0x48,0x88,
-0x99,0xa9,0x27,0x70,0x54,0x08,0xdd,0xdc,0xce,0xf5,0x09,0x02,0x14,0xdd,0x0a,0x02,
-0x11,0x9f,0x33,0xa1,0x12,0xc0,0xb5,0x3b,0x10,0x8f,0xdd,0x2a,0x23,0x5f,0xfd,0xa5,
-0x1b,0x33,0x5f,0xc5,0xfc,0x4c,0x1e,0x41,0xc0,0x04,0xfc,0x10,0xa5,0x1b,0x40,0xa0,
-0x00,0x03,0xeb,0x83,0x06,0x20,0x2e,0x60,0x63,0x22,0x2a,0x08,0xd0,0x16,0x27,0x14,
-0xe3,0x6a,0xbf,0x04,0x49,0x41,0x00,0x94,0x1e,0x03,0x43,0x4b,0x42,0xef,0x20,0x00,
-0xaf,0x9c,0x55,0x12,0xfd,0x9a,0x6e,0x80,0x00,0x0e,0xc4,0xfa,0x0a,0xe2,0xdf,0x30,
-0x2e,0x19,0x30,0x05,0xfb,0xf5,0xfe,0x18,0x20,0x05,0xf4,0x23,0x19,0x21,0x01,0xcc,
-0x95,0x02,0x12,0x05,0xf4,0x04,0x20,0x38,0x64,0xb6,0xdd,0x05,0xdb,0x00,0x09,0x57,
-0x1f,0x51,0x25,0x66,0x67,0x77,0x10,0xd9,0x35,0x35,0xff,0xfe,0xef,0xdb,0x00,0x10,
-0xce,0x6e,0x9b,0x12,0x10,0x72,0x07,0x02,0xdb,0x00,0x10,0x5f,0xdb,0x00,0x00,0xb4,
-0x16,0x14,0x4f,0xdb,0x00,0x14,0x4f,0xdb,0x00,0x41,0x5f,0xc1,0x04,0xfc,0x13,0x00,
-0x50,0x8f,0xb0,0x00,0x04,0xeb,0x13,0x00,0x20,0x1e,0x70,0x70,0x00,0x0b,0x3e,0x4f,
-0x01,0x47,0xc3,0x14,0x10,0x5b,0x9b,0x14,0xf9,0x09,0x04,0x23,0xfd,0x10,0x68,0x01,
-0x03,0x52,0x0c,0x00,0x13,0x5d,0x04,0x60,0x58,0x12,0xd3,0x67,0x02,0x41,0xef,0x81,
-0x6e,0xf9,0x6d,0xb8,0x64,0xf9,0x20,0x00,0x07,0xef,0x80,0xc5,0xe4,0x17,0x6a,0x20,
-0x5b,0xb0,0x1d,0xb9,0x84,0x00,0x06,0xd0,0x07,0xf0,0x00,0x69,0xbb,0x88,0x49,0x02,
-0xe6,0x03,0x00,0xc8,0x99,0x41,0x0b,0xcc,0xcd,0xe6,0x11,0x00,0x60,0x9a,0xaa,0xaf,
-0xa0,0x09,0xe0,0x5c,0x23,0x01,0x57,0x64,0x11,0x7f,0xfa,0x40,0x01,0x11,0x00,0x00,
-0x27,0x0b,0x31,0x9f,0x55,0xaf,0xe9,0x11,0x00,0x50,0x1e,0x00,0x6c,0x1a,0x02,0x44,
-0x00,0x21,0x4f,0xf7,0x44,0x00,0x41,0x00,0x0d,0xdc,0xd0,0x11,0x00,0x40,0x07,0xf4,
-0x4f,0x40,0x11,0x00,0x41,0x02,0xfa,0x00,0xcc,0x11,0x00,0x40,0xce,0x10,0x03,0xf4,
-0x11,0x00,0x80,0x7f,0x40,0x00,0x0a,0xc0,0x8f,0x00,0x7f,0xb4,0xe6,0x10,0x16,0x03,
-0x9b,0x03,0x28,0x04,0x03,0x88,0x00,0x0c,0x11,0x00,0x46,0x04,0x90,0x06,0xf0,0xe0,
-0x15,0x31,0x18,0x64,0x33,0x5c,0x17,0x47,0x01,0xbe,0xff,0xf4,0xa6,0x50,0x51,0x8f,
-0x00,0x15,0x56,0x66,0xac,0xa1,0x12,0x05,0x38,0x19,0x13,0x8f,0xa1,0x19,0x01,0x7e,
-0x01,0x22,0x2f,0xd0,0x11,0x00,0x31,0x1d,0xf2,0x04,0xb3,0x00,0x31,0x1d,0xff,0x30,
-0x54,0x1a,0x31,0x2d,0xf5,0xde,0xb8,0x3e,0x41,0x4e,0xe3,0x02,0xed,0xc6,0x00,0x30,
-0xc1,0x00,0x02,0x00,0x6e,0x21,0x1e,0x70,0xac,0x3f,0x19,0x9e,0xbb,0x04,0x49,0x02,
-0xd2,0x00,0x8d,0xb1,0x5a,0x14,0x0e,0x18,0x25,0x03,0x4e,0x5c,0x42,0x06,0xfb,0x6f,
-0xd1,0x08,0x00,0x02,0x4d,0x5c,0x20,0x09,0xfb,0x62,0x00,0x04,0x14,0x62,0x13,0xf5,
-0xfe,0x08,0x25,0x04,0x30,0xc4,0x00,0x46,0x1b,0xef,0xff,0x40,0x3d,0x03,0x31,0x9f,
-0x01,0x55,0x26,0x9e,0x13,0x9f,0xc2,0x00,0x11,0x9f,0x86,0x06,0x02,0x08,0x00,0x50,
-0x2f,0xd0,0x02,0x22,0x9f,0x38,0x58,0x41,0x20,0x4f,0xff,0xff,0xc0,0x00,0x81,0x03,
-0x44,0xaf,0x00,0x02,0xdf,0x5d,0xe1,0xa8,0x1d,0x60,0xe2,0x02,0xed,0x00,0x00,0x8f,
-0x4d,0x6a,0x43,0x3e,0xb0,0x00,0x9f,0xbe,0x00,0x2a,0x9f,0x00,0x20,0x18,0x1f,0x01,
-0x20,0x18,0x36,0x00,0x40,0x02,0x10,0x04,0xfe,0x6f,0x73,0x69,0xab,0x60,0x00,0x6f,
-0x00,0x7f,0xf3,0x20,0x03,0x40,0x02,0x10,0x6f,0x40,0x02,0x53,0xa9,0x9f,0xa0,0x06,
-0xf0,0x40,0x02,0x13,0x6f,0x40,0x02,0x23,0x06,0xf0,0x40,0x02,0x01,0x11,0x00,0x41,
-0x05,0xf5,0x29,0x9c,0x11,0x00,0x43,0xcf,0x13,0xdd,0xef,0x40,0x02,0x23,0x06,0xf0,
-0x40,0x02,0x13,0x5f,0x40,0x02,0x32,0x05,0xf0,0x06,0x40,0x02,0x31,0x5f,0x10,0x6f,
-0x40,0x02,0x32,0x04,0xf1,0x06,0x40,0x02,0x31,0x4f,0x10,0x6f,0x40,0x02,0x00,0x11,
-0x00,0x02,0xde,0x07,0x23,0x10,0x6f,0x63,0x29,0x04,0xc7,0x63,0x22,0x10,0x6f,0xef,
-0x7d,0x27,0xa0,0x05,0x40,0x02,0x07,0x64,0x97,0x43,0x9f,0xfe,0xdd,0xb0,0x93,0x06,
-0x2b,0x56,0x65,0x0a,0x2d,0x03,0xe0,0x7e,0x00,0xcb,0x1a,0x44,0x66,0x66,0xef,0x40,
-0x32,0x00,0x14,0x90,0x6f,0x02,0x14,0xb0,0x12,0x00,0x04,0x9f,0x26,0x33,0xbf,0xff,
-0x80,0x39,0x12,0x12,0x72,0x55,0x8f,0x60,0x5d,0xfb,0x20,0x00,0x6e,0xf9,0x2c,0x00,
-0x10,0xb3,0x24,0x0f,0x11,0xe7,0x95,0x0f,0x1f,0x06,0x81,0xd8,0x09,0x13,0x9f,0x24,
-0xa9,0x20,0x78,0x8c,0x9e,0x2c,0x10,0x70,0xf1,0xae,0x03,0x5b,0x4e,0x31,0x58,0x54,
-0x31,0x94,0x04,0x38,0x6d,0xff,0xf9,0x82,0xd1,0x00,0x77,0xb4,0x11,0x50,0x3c,0x92,
-0x00,0x06,0x22,0x11,0x07,0xea,0x02,0x12,0xb0,0x08,0x00,0x12,0xdf,0x84,0x93,0x22,
-0x0a,0xf6,0x82,0x22,0x31,0x9f,0xfa,0x00,0xe5,0x28,0x21,0xf9,0x7f,0x21,0xad,0x90,
-0x9f,0x80,0x09,0xf5,0x00,0x06,0xf0,0x0b,0xf7,0xee,0x21,0x93,0x06,0xf0,0x4e,0x40,
-0x06,0x30,0x08,0x70,0x06,0x15,0x3b,0x0f,0x08,0x00,0x02,0x18,0xa1,0x69,0x60,0x1f,
-0x35,0x69,0x60,0x17,0x25,0x31,0x00,0xbc,0xa0,0x23,0xdd,0xa0,0x80,0x04,0x2b,0x56,
-0x64,0x2c,0x55,0x14,0xef,0x1c,0x81,0x64,0x06,0x76,0x66,0x66,0xdf,0x80,0x09,0x24,
-0x14,0xb0,0x9d,0x17,0x14,0x90,0xb0,0x5c,0x03,0x5a,0x14,0x50,0x5d,0xfa,0x5d,0xfb,
-0x20,0x71,0x10,0x60,0xdf,0xc3,0x00,0x07,0xef,0x91,0x48,0x19,0x10,0x30,0xdd,0x02,
-0x1f,0x90,0xcd,0xf1,0x03,0x20,0x55,0x55,0x20,0x11,0x23,0x87,0x07,0x8f,0x95,0x02,
-0x83,0xae,0x1e,0xbd,0xf5,0xfc,0x0f,0x13,0x00,0x13,0x1d,0xbc,0x99,0xc0,0x05,0xfd,
-0x95,0x14,0xdf,0xe2,0x81,0x32,0x01,0x34,0x42,0x80,0x30,0x00,0x29,0xad,0x18,0x10,
-0x46,0xac,0x54,0x01,0x11,0x10,0x2b,0xfb,0xcf,0x00,0x13,0x80,0x9d,0x17,0x13,0xf6,
-0x0a,0x6f,0x31,0xd9,0xef,0x92,0x16,0x12,0x11,0xc5,0x77,0x18,0x3b,0x00,0x7b,0x61,
-0x6b,0x14,0x21,0x28,0x88,0xc9,0x12,0x38,0x78,0x86,0x5e,0xa6,0x3a,0x28,0x5f,0x20,
-0x91,0xf3,0x00,0x41,0x02,0x42,0xaf,0x98,0x89,0x80,0x6a,0x37,0x25,0xee,0xef,0x4d,
-0x0a,0x1d,0xf4,0xcd,0xce,0x0e,0x09,0x00,0x05,0x7c,0x42,0x14,0x81,0xe8,0x5b,0x03,
-0x13,0xe8,0x13,0xdb,0xaa,0x01,0x0b,0xbb,0x01,0x17,0x01,0x4f,0xac,0x43,0x54,0x4b,
-0xfd,0x20,0xb0,0x01,0x13,0xb1,0xe3,0x02,0x03,0x6e,0xdd,0x31,0x8e,0xfe,0xfb,0xdc,
-0x7c,0x50,0x9f,0xfa,0x20,0x6e,0xfb,0x46,0x17,0x64,0xd7,0x10,0x00,0x00,0x6c,0xf9,
-0xa3,0x30,0x05,0x67,0x00,0x0a,0xf4,0xf9,0x33,0x66,0x6f,0xb6,0xd6,0xc9,0x03,0x16,
-0x0a,0x1c,0x30,0x3a,0x15,0x1f,0x05,0x3a,0x15,0x23,0x08,0xb0,0x01,0x1a,0xfc,0xb0,
-0x01,0x10,0x33,0xb0,0x01,0x05,0xbe,0x13,0x12,0x60,0xdd,0x24,0x23,0x4d,0xf9,0x45,
-0x32,0x22,0xfd,0x50,0xcd,0xb6,0x30,0xff,0xf8,0x20,0x7e,0x00,0xa0,0xaf,0xfb,0x52,
-0x8e,0xfc,0x82,0x00,0x00,0x6e,0xa6,0x36,0x08,0x17,0xc7,0x4c,0x15,0x21,0x66,0x65,
-0x93,0xca,0x23,0x74,0x4e,0x62,0xe2,0x1f,0xe9,0x62,0xe2,0x01,0x00,0x79,0x9a,0x23,
-0x9a,0x90,0x01,0x98,0x19,0xce,0x68,0x31,0x00,0xcb,0x42,0x24,0x5a,0xf1,0xd0,0x13,
-0x00,0x08,0x28,0x13,0xf3,0xb8,0x55,0x0e,0xda,0x41,0x00,0x44,0x54,0x3f,0x77,0x76,
-0x62,0x88,0x02,0x21,0x14,0xfa,0xf4,0x1a,0x13,0x70,0x80,0x02,0x13,0xf6,0xc7,0x13,
-0x30,0xc7,0xdf,0xb3,0x6f,0x19,0x40,0xff,0xa3,0x00,0x06,0x0a,0x00,0x20,0x6a,0x50,
-0xb0,0x00,0x19,0xa7,0x23,0x39,0x01,0xfa,0x43,0x11,0xed,0x23,0x39,0x04,0x47,0xf5,
-0x1b,0x7f,0x9e,0x63,0x51,0x02,0x9e,0xff,0xfe,0x81,0x9a,0x05,0x31,0xe8,0x43,0x59,
-0xf0,0x1b,0x21,0xed,0x10,0xae,0x0f,0x06,0x5e,0x19,0x02,0x34,0x3d,0x14,0xd0,0xff,
-0x43,0x11,0x70,0xbe,0x13,0x04,0x50,0xfe,0x50,0x7b,0xdd,0xb7,0x20,0x00,0x53,0x5d,
-0x21,0x66,0x50,0xd5,0x63,0x46,0x08,0xcd,0xed,0x20,0xe2,0x0d,0x11,0x8f,0xe8,0xb5,
-0x11,0x61,0xd8,0x2b,0x42,0xff,0xfe,0xff,0x90,0x7f,0x00,0x22,0x0c,0xf2,0x87,0x04,
-0x22,0x1d,0xf4,0x90,0x00,0x31,0x4e,0xff,0x50,0x2b,0xbe,0x40,0x9f,0xb2,0xbf,0x60,
-0xc9,0x37,0xa0,0xef,0x70,0x00,0x9f,0x60,0x07,0xf0,0x01,0xe9,0x10,0x1d,0xa7,0x15,
-0x7f,0xd4,0x3c,0x00,0x81,0xa1,0x42,0x45,0x79,0x90,0x7f,0xf9,0x01,0x82,0xd8,0x07,
-0xf0,0x02,0x33,0x33,0xeb,0x43,0x44,0x00,0x04,0x6d,0x65,0x01,0x6e,0x0c,0x13,0x7f,
-0x72,0x2e,0x09,0x11,0x00,0x14,0x0f,0x22,0x00,0x13,0xf9,0x11,0x00,0x2c,0x07,0x30,
-0x9b,0x64,0x05,0x9c,0x01,0x02,0xa0,0xfa,0x08,0x9d,0x01,0x10,0x02,0x00,0x15,0x18,
-0x41,0x4e,0x03,0x00,0x77,0x02,0x39,0x02,0xbf,0xa0,0x9f,0x01,0x00,0x5b,0x50,0x14,
-0x60,0xa0,0x01,0x21,0xef,0xb3,0xbe,0x31,0x31,0xfa,0x30,0x00,0x51,0x03,0x11,0x6a,
-0x39,0x1d,0x08,0x33,0x7c,0x02,0x79,0x31,0x36,0x44,0x44,0x43,0x4c,0x3f,0x01,0xbc,
-0xca,0x0a,0x2d,0x78,0x03,0x53,0xd3,0x11,0x70,0x19,0x08,0x00,0x80,0x43,0x1f,0x20,
-0xfb,0x16,0x24,0x16,0x28,0x53,0x00,0x40,0x1d,0xb9,0x88,0x50,0x2c,0x25,0x37,0x59,
-0xab,0xb8,0x49,0x60,0xc1,0x39,0x9a,0xaa,0xbc,0xa0,0x00,0x0d,0x95,0xcc,0xcc,0xbb,
-0xff,0x45,0x0d,0x00,0x58,0x15,0x13,0x0d,0x35,0xf3,0x12,0xda,0x1d,0x14,0x21,0x0d,
-0xa0,0x8b,0x0d,0x00,0x0f,0x00,0x21,0x1e,0xd0,0x0f,0x00,0x30,0x09,0xff,0x10,0x0f,
-0x00,0x30,0x05,0xfa,0xfa,0x0f,0x00,0x40,0x02,0xfc,0x07,0xf4,0x44,0xf3,0x90,0xde,
-0x10,0x0c,0xe0,0x00,0x0d,0xa0,0xbe,0x20,0xee,0x24,0x30,0xda,0x8f,0x30,0xa5,0x00,
-0x38,0x0d,0xa5,0x30,0xb2,0x0d,0x04,0x9d,0x0d,0x0b,0x0f,0x00,0x1f,0x97,0x7a,0x09,
-0x04,0x1f,0xaf,0x7a,0x09,0x0a,0x22,0x00,0x00,0x7a,0x09,0x01,0xba,0x03,0x31,0x1d,
-0xff,0x20,0x7c,0x02,0x30,0xdf,0x6e,0xd1,0x18,0x00,0x30,0x3e,0xe3,0x03,0xda,0x21,
-0x30,0x06,0xfd,0x20,0xd9,0x02,0x31,0x9f,0x1f,0x90,0x75,0x8f,0x18,0x9e,0xe8,0x45,
-0x07,0x7a,0x09,0x12,0x40,0x7a,0x09,0x14,0x4d,0x7a,0x09,0x1f,0xeb,0x7a,0x09,0x1b,
-0x28,0x02,0x80,0x85,0x3f,0x10,0x07,0xe7,0x1e,0x32,0x10,0x07,0xf0,0x00,0x18,0x24,
-0xbf,0x20,0xef,0x17,0x15,0xaf,0xf9,0x17,0x14,0xeb,0xfd,0x1a,0x11,0x04,0x28,0x95,
-0x00,0xc9,0xfc,0x21,0x5b,0xf0,0x0a,0x00,0x00,0x10,0x5a,0x00,0xc7,0x8f,0x01,0x6a,
-0x02,0x11,0xaf,0x39,0x95,0x10,0xe2,0x2e,0x76,0x01,0x81,0xf6,0x12,0x60,0x1a,0x37,
-0x03,0x09,0x2b,0x04,0x0e,0x84,0x15,0x05,0xaf,0x7a,0x23,0x3f,0xb0,0x0a,0x00,0x24,
-0x03,0xfc,0xd3,0x32,0x25,0x0d,0xb0,0xa0,0xb2,0x0a,0x5b,0xba,0x0f,0x0a,0x00,0x0c,
-0x2d,0x03,0xd1,0x6f,0xc5,0xf1,0x04,0x01,0xf5,0x29,0xaa,0xab,0xbb,0x30,0x7e,0x00,
-0x2f,0x54,0xbc,0xcb,0xbc,0xf6,0x07,0xe0,0x02,0xf5,0x32,0x36,0x31,0x8e,0x00,0x1f,
-0x39,0x4b,0x21,0x08,0xe0,0x33,0x49,0x00,0xd2,0x28,0x01,0x15,0xc9,0x10,0x90,0x11,
-0x00,0xc0,0xbe,0xee,0xef,0xf4,0x00,0x8e,0x22,0x3f,0x54,0x77,0x77,0xee,0x83,0x0d,
-0x11,0xf5,0x65,0x56,0x40,0x8e,0x44,0x5f,0x50,0xcb,0x00,0x01,0x33,0x00,0x20,0x05,
-0xf6,0x15,0x87,0x40,0x1f,0x50,0x01,0xec,0xf7,0x50,0x20,0x01,0xf5,0xc2,0x24,0x01,
-0x11,0x00,0x22,0x8f,0x50,0x11,0x00,0x00,0xba,0x73,0x00,0x11,0x00,0x33,0x5a,0x80,
-0x00,0x22,0x00,0x02,0xd5,0x04,0x23,0x1f,0x50,0x23,0x04,0x0a,0x11,0x00,0x1e,0x04,
-0x6f,0xc5,0x24,0x01,0x30,0xe9,0x26,0xc3,0x0a,0xbb,0xbb,0xcc,0xc6,0x00,0x08,0xf0,
-0x09,0xaa,0xa9,0x99,0x83,0xf7,0x23,0x02,0xf7,0xf0,0x26,0x13,0xf3,0x62,0x2f,0x11,
-0xe0,0xd7,0xaf,0x11,0x12,0x23,0x31,0x10,0x6f,0xe2,0x56,0x82,0x11,0x19,0xf0,0x03,
-0x44,0x45,0xfa,0x0c,0xd5,0x47,0x52,0xf2,0x03,0x55,0x5b,0xf0,0x93,0x10,0x22,0x08,
-0xf0,0xa5,0x12,0x00,0x6a,0x81,0x13,0xf2,0xcb,0x30,0x11,0x50,0x08,0x00,0x22,0x08,
-0xf6,0x09,0x0a,0x22,0x5f,0x60,0x08,0x00,0x1a,0x12,0x8b,0x4c,0x0f,0x08,0x00,0x04,
-0x26,0x06,0xb0,0x96,0x4d,0x20,0x00,0x11,0x18,0x00,0x10,0x1d,0x1d,0x10,0x00,0x3c,
-0x0d,0x33,0x55,0x44,0x4a,0x49,0x0a,0x23,0x0b,0xf0,0x8f,0xf6,0x00,0x51,0x0a,0x40,
-0x3d,0xdd,0xde,0xef,0x55,0x35,0x52,0x16,0x77,0x77,0xfe,0x07,0x86,0x66,0x21,0xf6,
-0x03,0xb6,0x65,0x22,0x5f,0xb0,0x26,0x52,0x12,0xfd,0x24,0x01,0x21,0xaf,0xb0,0x08,
-0x00,0x13,0x3e,0x06,0xec,0x2c,0x38,0x10,0x21,0x0a,0x14,0xd6,0x77,0x90,0x03,0x53,
-0x2c,0x1f,0xf9,0xb6,0x17,0x05,0x5f,0x55,0x55,0x56,0x67,0x71,0x8f,0x27,0x04,0x40,
-0x45,0x00,0x15,0x66,0x8e,0x27,0x20,0x0b,0xd0,0xb1,0x03,0x13,0xfd,0xa7,0x09,0x22,
-0x0e,0xb0,0xa6,0x09,0x20,0x03,0xf6,0xec,0x25,0x40,0x6a,0xbb,0xbb,0xdf,0x65,0x06,
-0x81,0x06,0xaa,0xaa,0xdf,0x70,0xbf,0xff,0xfd,0xb9,0x02,0x30,0x04,0x67,0x7d,0x9a,
-0xe4,0x13,0xd1,0x03,0x44,0x11,0xb0,0x61,0x78,0x32,0x03,0xcf,0x80,0xd8,0x09,0x34,
-0xdb,0x20,0x00,0xef,0x88,0x03,0xd7,0x01,0x04,0xae,0x82,0x02,0xed,0x16,0x12,0xfa,
-0x5e,0x2e,0x01,0x13,0x1a,0x04,0x51,0x4a,0x04,0xb0,0x82,0x04,0x70,0xee,0x0f,0xe1,
-0x74,0x05,0x1c,0xf2,0xe1,0x74,0x40,0x42,0x01,0x33,0x34,0x2d,0x5a,0x22,0xf8,0x09,
-0x5a,0x00,0x52,0xf9,0x00,0x21,0x10,0x01,0x1c,0xcf,0x01,0x44,0x21,0x50,0xf9,0x03,
-0x44,0x44,0x5b,0x0b,0x74,0x10,0x0e,0x28,0x83,0x01,0x00,0x5c,0x62,0x01,0xcf,0x10,
-0x57,0x77,0xf9,0x4b,0x0e,0x00,0x28,0x00,0x12,0xbf,0xda,0xe2,0x21,0x3d,0xf5,0x41,
-0x01,0x12,0x09,0x8e,0x1b,0x11,0xf8,0x16,0x89,0x06,0x66,0xff,0x06,0x7c,0xe6,0x0f,
-0x8e,0x27,0x32,0x60,0x01,0x30,0x02,0x33,0x44,0x45,0x33,0x60,0x03,0xbb,0x84,0x62,
-0xe0,0x02,0x21,0x11,0x0a,0xf0,0x89,0x0f,0x00,0xa6,0x80,0x01,0x09,0x2d,0x10,0x70,
-0x94,0x02,0x00,0x5d,0x99,0x71,0x22,0x29,0xf0,0x15,0x55,0x59,0xf8,0x76,0x0f,0x00,
-0x1f,0x1e,0x31,0x34,0x49,0xf0,0xf2,0x20,0x00,0x04,0x02,0x12,0x1c,0x8e,0xe0,0x10,
-0x03,0x04,0xbc,0x00,0xa2,0x4f,0x12,0xa1,0x24,0x02,0x10,0x64,0x42,0x1c,0x01,0xd8,
-0x04,0x00,0xd7,0x11,0x03,0x39,0x9e,0x37,0x10,0x01,0x50,0x88,0x71,0x32,0x0a,0xff,
-0xc1,0x8c,0x03,0x31,0x85,0xfd,0x10,0xdf,0x5a,0x32,0x00,0x3e,0xe2,0x89,0x80,0x60,
-0x02,0xde,0x30,0x00,0x0c,0xf6,0x85,0x20,0x38,0xf3,0x00,0x07,0xe1,0x67,0x14,0x20,
-0x5a,0x16,0xf0,0x02,0xd7,0x05,0xf1,0x04,0xbb,0xbb,0xcc,0xb0,0x00,0xe7,0x05,0xf1,
-0x04,0xab,0xaa,0x9d,0xf0,0x8e,0xc3,0x02,0x4d,0x1c,0x02,0x09,0x00,0x23,0x0d,0xb0,
-0x09,0x00,0x23,0x1f,0x80,0x09,0x00,0x20,0x5f,0x40,0x2d,0x00,0x00,0x29,0x9e,0xb1,
-0x05,0x55,0xf7,0x05,0xf1,0x04,0x66,0x67,0xf9,0x4f,0xff,0x1b,0x00,0x11,0x07,0x3b,
-0x25,0x12,0xf1,0x13,0x02,0x01,0x09,0x00,0x22,0x8f,0x20,0x09,0x00,0x01,0xf0,0xf8,
-0x00,0x09,0x00,0x23,0x0d,0xd0,0x09,0x00,0x01,0x76,0x42,0x30,0xe8,0x05,0xf1,0x8e,
-0x25,0x00,0x09,0x00,0x33,0xf2,0x0b,0x60,0x09,0x00,0x2f,0x00,0x00,0x09,0x00,0x0c,
-0x2c,0x94,0x04,0x9e,0x17,0x0f,0x6b,0x04,0x1b,0x31,0xe5,0xff,0xff,0x6b,0x04,0x32,
-0x81,0x77,0x7c,0x6b,0x04,0x21,0x00,0x08,0x6b,0x04,0x03,0x24,0x7b,0x13,0xf2,0x91,
-0x1b,0x40,0x80,0x03,0x32,0x29,0x6b,0x04,0x00,0x29,0x17,0x01,0x6b,0x04,0x3f,0x03,
-0x44,0x4a,0x6b,0x04,0x34,0x2f,0x00,0x31,0xef,0x02,0x0a,0xb1,0x9f,0xff,0xf9,0x02,
-0x33,0x33,0x3b,0xf1,0x25,0x55,0xf9,0x08,0xa1,0x00,0x18,0x00,0x31,0x22,0x22,0xdf,
-0x3a,0xf5,0x00,0x33,0x33,0x30,0x89,0x99,0xf9,0x81,0x3a,0x71,0x01,0xdd,0xdd,0xf8,
-0x00,0x2d,0xf6,0xe7,0x02,0x13,0x08,0xef,0x02,0x29,0x0b,0x50,0x99,0x1c,0x1f,0x42,
-0xef,0x02,0x36,0x23,0x02,0x67,0x24,0xfe,0x01,0x49,0x00,0x15,0xfe,0x30,0x3d,0x01,
-0xfb,0x48,0x08,0xf3,0xb7,0x03,0xff,0x06,0x10,0x8e,0x78,0x26,0x14,0xfa,0xbd,0x4d,
-0x2e,0x6f,0xa0,0x82,0x9e,0x13,0x70,0xcf,0x2d,0x24,0x01,0xf6,0x11,0x22,0x02,0x4d,
-0xbd,0x00,0x0b,0xf5,0x05,0xcd,0xa4,0x0c,0x13,0x32,0x02,0xa6,0x8a,0x06,0x92,0x6a,
-0x22,0x27,0x76,0x48,0xd9,0x10,0x75,0x72,0x49,0x04,0x51,0xa5,0x14,0x77,0xc1,0xbc,
-0x05,0xab,0x0e,0x04,0x68,0xbe,0x04,0x6e,0xb6,0x00,0xcf,0x04,0x13,0x20,0x09,0x09,
-0x22,0x06,0xf0,0x76,0x40,0x00,0x29,0x08,0x20,0x04,0x10,0x95,0x1f,0x20,0x39,0xf4,
-0x1d,0x5d,0x1e,0x7f,0xab,0x64,0x06,0x64,0x20,0x00,0x23,0xc0,0x23,0x9b,0xa0,0x51,
-0x00,0x05,0x5e,0x3d,0x09,0x44,0x0e,0x14,0x04,0x5e,0x3d,0x10,0x07,0x64,0xd9,0x00,
-0x07,0x0a,0x04,0xaa,0xe5,0x02,0x09,0x00,0x11,0x11,0x3e,0xc0,0x04,0x4a,0x05,0x10,
-0x57,0xb8,0x2f,0x12,0x51,0x2f,0x01,0x33,0x88,0x99,0x20,0xea,0x5d,0x1f,0xee,0xe9,
-0xd3,0x0e,0x10,0x02,0x35,0x3f,0x01,0x56,0x97,0x05,0xe9,0x8d,0x10,0x14,0x24,0x21,
-0x19,0xf7,0x25,0xf2,0x09,0x9d,0x26,0x06,0xa3,0x45,0x2a,0x05,0xf1,0xe6,0x2a,0x0b,
-0x4f,0x48,0x09,0x7b,0x4a,0x04,0x00,0x02,0x20,0x03,0xef,0x47,0xfe,0x1b,0xa0,0x65,
-0x84,0x34,0x11,0x1d,0xa0,0xcd,0x46,0x10,0xa0,0x29,0x06,0x5c,0x55,0x55,0x55,0x4f,
-0x90,0x8a,0x63,0x52,0x08,0x30,0x00,0x26,0x65,0x71,0xf9,0x14,0x64,0x5e,0x01,0x1d,
-0xe9,0xa4,0x10,0x00,0xcf,0x43,0x40,0x88,0x89,0x99,0x9c,0x05,0x41,0x01,0x0e,0xa6,
-0x0f,0xd8,0x1a,0x02,0x0f,0xf0,0x4f,0x17,0x13,0xf9,0x05,0x41,0x01,0x8b,0x8d,0x01,
-0xc6,0x00,0x13,0x30,0xed,0xcf,0x25,0xee,0xfc,0x0f,0xf3,0x09,0xc6,0x02,0x15,0x05,
-0x1d,0xbf,0x10,0x27,0xa5,0x06,0x06,0x52,0x85,0x0e,0x35,0xa1,0x13,0x01,0xc7,0xbb,
-0x00,0x01,0x00,0x16,0x60,0xc4,0xd8,0x0e,0x01,0x00,0x01,0xa9,0xbd,0x11,0x67,0x41,
-0x88,0x05,0x0d,0xfb,0x02,0x3b,0x15,0x27,0x7f,0x10,0xfc,0xfa,0x02,0x87,0x03,0x1a,
-0x6f,0x13,0x00,0x31,0x42,0x11,0x12,0x7c,0x69,0x05,0xf7,0x47,0x00,0xbc,0x0a,0x4f,
-0x43,0x32,0x20,0x00,0x6a,0x09,0x33,0x0e,0xff,0x04,0x0f,0x6a,0x09,0x4d,0x10,0x10,
-0xbe,0x92,0x00,0xff,0x4d,0x00,0x91,0x9c,0x00,0x31,0x8b,0x40,0x03,0x33,0x22,0x1b,
-0x08,0x00,0x04,0xb8,0x08,0x91,0x14,0x55,0x55,0x8f,0x50,0x00,0x0b,0xd0,0x9f,0x4d,
-0x01,0x22,0x0b,0xd0,0xbd,0x69,0x21,0x0b,0xd0,0xa8,0x34,0x00,0x08,0x00,0x21,0x0a,
-0xf8,0xad,0x08,0x02,0x25,0x2b,0x42,0x0c,0xc0,0x8f,0xa1,0xac,0x08,0x18,0x32,0x5c,
-0xbd,0x33,0x78,0x88,0x30,0x47,0x43,0x03,0xa5,0x02,0x07,0x59,0x8b,0x20,0x05,0xdd,
-0x2e,0x04,0x30,0x90,0x00,0x09,0x27,0xa6,0x2f,0x98,0x20,0x59,0x8b,0x13,0x17,0x24,
-0x71,0x77,0x00,0x8b,0xd6,0x21,0xee,0xa0,0xff,0x61,0x05,0xd1,0xed,0x14,0x6f,0x20,
-0xec,0x14,0x06,0xdd,0xa8,0x03,0xfd,0x0f,0x00,0x07,0x56,0x06,0x13,0x00,0x10,0x43,
-0xfc,0x00,0x41,0x8f,0x33,0x43,0x07,0x15,0x27,0x10,0x08,0xd1,0xed,0x10,0x43,0xc9,
-0xbd,0x15,0x8f,0xd1,0xed,0x0e,0x39,0x00,0x25,0x07,0xf0,0xca,0xd6,0x00,0x08,0x29,
-0x40,0x87,0x89,0xac,0xe4,0x13,0x00,0x5f,0x2c,0xee,0xed,0xca,0x86,0xa1,0x4c,0x1e,
-0x09,0xd9,0xa1,0x05,0x24,0xa3,0x00,0x7f,0xc5,0x11,0x40,0x8b,0xd2,0x10,0xee,0x0b,
-0xe2,0x14,0x8f,0xd8,0x2b,0x09,0x09,0x00,0x00,0x01,0x8e,0x00,0x04,0xb6,0x00,0x9d,
-0x04,0x00,0x06,0x3b,0x40,0xfd,0x9f,0x34,0x43,0xe2,0x47,0x33,0x55,0x52,0x9e,0x65,
-0x00,0x00,0x00,0x01,0x40,0x01,0x35,0x00,0x7f,0x7c,0x4d,0x00,0x93,0x0d,0x14,0x7f,
-0x02,0xed,0x18,0x7f,0x6e,0x64,0x04,0x3f,0x1d,0x04,0xdd,0x47,0x00,0x2d,0x30,0x49,
-0x54,0x44,0x43,0xaf,0x5f,0xd4,0x10,0x77,0x49,0x2c,0x04,0x24,0x00,0x19,0xfa,0x36,
-0xa3,0x0f,0x04,0xb6,0x0b,0x00,0x43,0x4a,0x11,0x18,0x74,0x05,0x10,0xad,0x02,0x96,
-0x33,0xfe,0xed,0x90,0x34,0x65,0x1f,0x00,0xa0,0xee,0x05,0xd6,0xcc,0xcc,0xcd,0xa0,
-0x00,0x9f,0x99,0x95,0x7f,0xba,0xaa,0x99,0x50,0xa0,0xee,0x09,0xf5,0xed,0x62,0x53,
-0x33,0x45,0x8a,0x20,0x9e,0x8f,0x00,0x20,0xec,0x20,0xe7,0x00,0x01,0x8b,0x3c,0x18,
-0x9d,0xb2,0x65,0x05,0x0a,0x15,0x05,0x07,0x65,0x20,0x5f,0x97,0x20,0x56,0x04,0x56,
-0x45,0x1f,0x8f,0x09,0x00,0x03,0x13,0x63,0xd9,0x62,0x1e,0x3f,0x4d,0xd4,0x09,0x25,
-0x37,0xe0,0x02,0xf4,0x0d,0xee,0xee,0xee,0x10,0x8e,0x00,0x3f,0x41,0xfb,0x88,0x87,
-0x6b,0xbb,0x31,0xf4,0x1f,0x70,0xd5,0x18,0x21,0x2f,0x41,0xe6,0x84,0x00,0x11,0x00,
-0x12,0x60,0x3a,0xd3,0x23,0x41,0xf6,0x4b,0xd3,0xd0,0x1f,0xb8,0x88,0x88,0x00,0x7e,
-0x33,0x5f,0x41,0xff,0xee,0xed,0xb0,0x7e,0xd3,0x02,0x22,0x00,0x26,0x22,0x4f,0x22,
-0x00,0x0d,0x33,0x00,0x40,0x60,0x00,0x13,0x20,0xc2,0xd3,0x40,0xfe,0xde,0xef,0xfc,
-0x11,0x00,0x4f,0x04,0x88,0x76,0x52,0x7e,0xd3,0x10,0x23,0x8f,0x00,0x29,0xcf,0x0f,
-0x7e,0xd3,0x02,0x90,0x35,0x44,0x45,0x40,0x07,0xc0,0x05,0xf2,0x0f,0x76,0x04,0x70,
-0x8e,0x00,0x5f,0x31,0xf7,0x11,0x11,0x77,0x7f,0x22,0xf3,0x1f,0x4b,0x80,0x22,0x5f,
-0x31,0xaa,0x85,0xfe,0x03,0x05,0xf3,0x1f,0xca,0xaa,0xba,0x00,0x8f,0xbb,0xdf,0x31,
-0xfd,0xcc,0xcb,0x90,0x08,0xfb,0xbc,0x22,0x00,0x00,0xa2,0x00,0xf5,0x02,0x30,0x8f,
-0x00,0x5f,0x20,0xfe,0xde,0xff,0xfd,0x08,0xf0,0x05,0xf2,0x04,0x88,0x76,0x53,0x92,
-0xeb,0x28,0x01,0x20,0x1e,0x37,0x14,0x0d,0x98,0x06,0x10,0x67,0x2e,0x08,0x1c,0xde,
-0x3e,0x3b,0x1f,0xae,0x11,0x00,0x06,0x04,0x44,0x08,0x16,0x67,0x27,0x03,0x62,0x45,
-0x54,0x55,0x50,0x08,0xc0,0x5b,0x9e,0x80,0x20,0xae,0x00,0x7f,0x11,0xf7,0x11,0x11,
-0x58,0x80,0x13,0xf1,0x48,0xbe,0x10,0x6f,0x79,0x30,0x01,0x1e,0xa2,0x10,0x1f,0xbb,
-0xed,0xc3,0x9f,0xee,0xff,0x11,0xfb,0x88,0x87,0x50,0x08,0xf8,0x7b,0xf1,0xc4,0x00,
-0x02,0x22,0x00,0x00,0xe3,0x80,0x50,0x1f,0x83,0x34,0x68,0x80,0xdb,0xb6,0x00,0x37,
-0xef,0x00,0x48,0xb6,0x30,0x00,0x23,0x21,0x71,0x39,0x18,0x6f,0x41,0x1f,0x03,0x78,
-0x3d,0x23,0x05,0xf2,0x32,0x94,0x22,0x5f,0x10,0xdd,0x6b,0x05,0x82,0x60,0x10,0x5f,
-0xfc,0x4a,0x13,0xcc,0xcd,0x07,0x05,0x22,0x00,0x14,0xbc,0x22,0x00,0x13,0xa0,0x99,
-0xb8,0x1a,0x51,0xa9,0x4d,0x20,0x05,0xf0,0x20,0xde,0xc2,0x30,0x00,0x6f,0x0e,0xd8,
-0x89,0x88,0x61,0x00,0x06,0xf0,0xea,0xce,0x12,0x13,0x0e,0x14,0x09,0x13,0xe9,0x0f,
-0x00,0x12,0x90,0x0f,0x00,0xe3,0xfc,0x77,0x88,0x80,0x26,0x66,0xaf,0x0f,0xfe,0xee,
-0xdc,0x19,0xff,0xff,0xc7,0xee,0x23,0x6f,0x0f,0x1e,0x00,0x0e,0x0f,0x00,0xfa,0x04,
-0x01,0x31,0x00,0x6f,0x0e,0xfd,0xdd,0xef,0xff,0x70,0x06,0xf0,0x38,0x88,0x87,0x65,
-0x30,0x00,0x5f,0x2b,0x44,0x0b,0x0f,0x00,0x13,0x6f,0x87,0x08,0x1e,0xd0,0x47,0xed,
-0x00,0xeb,0x15,0x11,0x04,0x34,0x02,0x10,0xf2,0x90,0xd2,0x53,0x94,0x45,0x44,0x20,
-0x00,0xc8,0xf0,0x08,0x08,0x00,0xe4,0xc8,0x88,0x99,0x60,0xac,0xcd,0xf3,0x1f,0xed,
-0xdd,0xcb,0x70,0x79,0xab,0x18,0x00,0x18,0xf2,0x08,0x00,0x51,0x14,0x10,0x05,0xf2,
-0x0f,0x95,0x00,0x75,0x05,0xf2,0x03,0x78,0x87,0x65,0x42,0x7c,0x11,0x08,0x15,0x4b,
-0x13,0x97,0x08,0x00,0x10,0xeb,0x87,0x03,0x16,0xb0,0x28,0x59,0x0f,0x7a,0x63,0x02,
-0x13,0x83,0xbc,0x55,0x0c,0x89,0x95,0x80,0x30,0x06,0x88,0x88,0x88,0x80,0x00,0x06,
-0xc4,0xce,0x20,0xee,0xc1,0x08,0x00,0x12,0x70,0xec,0x11,0x14,0x1f,0x08,0x00,0x80,
-0x94,0x44,0x45,0x20,0x68,0x7a,0xf2,0x1f,0xa3,0x01,0x79,0xce,0xff,0xf2,0x1f,0x82,
-0x22,0x10,0x20,0x00,0x71,0x70,0x00,0x01,0x35,0x20,0x05,0xf1,0x72,0xc0,0x00,0x12,
-0x3a,0x47,0x67,0x76,0x54,0x31,0x57,0x6b,0x0b,0x04,0xcf,0x10,0xe0,0xe4,0x0a,0x37,
-0x44,0x44,0x4a,0x72,0x07,0x10,0x57,0x3b,0x1b,0x16,0xf0,0x7f,0xc9,0x1f,0xf8,0x04,
-0xcf,0x0c,0x02,0xb5,0x25,0x02,0xb8,0x00,0x13,0x05,0xb8,0x00,0x1e,0x05,0xb8,0x00,
-0x10,0x70,0x4f,0x09,0x11,0x8a,0xb8,0x00,0x10,0xb0,0xb8,0x00,0x10,0xa6,0xd9,0x6b,
-0x04,0x20,0x00,0x16,0x06,0x08,0x00,0x80,0xb7,0x77,0x89,0xbe,0x70,0x06,0xf2,0x0a,
-0x28,0xd4,0x1c,0x20,0x75,0x4c,0x2f,0x01,0x50,0xe0,0xd4,0x03,0x16,0x08,0x08,0x00,
-0x1c,0x01,0x08,0x00,0x13,0xfa,0xbd,0x89,0x04,0xfd,0x67,0x09,0xbb,0x89,0x04,0xc4,
-0xb6,0x60,0x02,0xf4,0x1e,0xee,0xee,0xe9,0x28,0xd4,0x50,0x44,0xf9,0x88,0x87,0x30,
-0x17,0xd4,0x00,0xee,0x0a,0x00,0x17,0xd4,0x10,0x44,0x75,0x0b,0x00,0x17,0xd4,0x22,
-0x5f,0x30,0x06,0xd4,0x15,0x45,0x11,0x00,0x30,0x98,0x89,0x50,0x28,0xd4,0x6e,0x45,
-0xfe,0xdd,0xc8,0x0e,0xff,0x22,0x00,0x14,0x02,0x11,0x00,0x18,0x2f,0x11,0x00,0x10,
-0x02,0x11,0x00,0x50,0x44,0xfd,0xcc,0xef,0xf8,0x28,0xd4,0x4f,0x07,0x99,0x97,0x63,
-0x28,0xd4,0x18,0x1e,0x03,0x28,0xd4,0x02,0x21,0x05,0x31,0x30,0x01,0xf4,0x21,0x05,
-0x42,0xfd,0x00,0x2f,0x60,0x21,0x05,0x22,0x01,0xf6,0x21,0x05,0x00,0x8c,0xa1,0x21,
-0x31,0xf6,0x14,0x28,0x10,0x04,0x21,0x05,0xd3,0xa3,0xbf,0xff,0x60,0x4f,0x31,0xfd,
-0xcc,0xba,0x23,0x67,0xf7,0x04,0x22,0x00,0x12,0x70,0x21,0x05,0x23,0x00,0xf7,0x21,
-0x05,0x22,0x0f,0x70,0x21,0x05,0x23,0x00,0xf7,0x21,0x05,0x01,0x14,0x93,0x0d,0x3f,
-0x3c,0x0f,0x21,0x05,0x35,0x10,0x02,0xcb,0xeb,0x30,0x10,0x11,0x00,0x2a,0x10,0x10,
-0x0e,0xc4,0x00,0x01,0xe4,0xd3,0x31,0x55,0x54,0x20,0xf5,0xd3,0x11,0x70,0xf6,0x0d,
-0x32,0x5f,0x11,0xf7,0xa2,0x00,0x00,0x03,0x03,0xa0,0x50,0x25,0x5f,0x70,0x5f,0x21,
-0xff,0xff,0xff,0x5b,0x42,0x10,0x66,0x1f,0x82,0x21,0x00,0x01,0x1f,0x22,0x00,0x24,
-0xf1,0x1f,0x33,0x00,0x61,0xf9,0x45,0x68,0xa9,0x00,0xf7,0x76,0x10,0x25,0xec,0x70,
-0x28,0xd4,0x01,0xa2,0x36,0x01,0x19,0x01,0x11,0x6f,0x1f,0x83,0x2f,0x01,0xf5,0x28,
-0xd4,0x32,0x12,0x02,0x88,0x01,0x40,0xf3,0x06,0xf2,0x0f,0x9b,0x08,0x40,0x2f,0x50,
-0x6f,0x21,0x88,0x01,0x43,0x02,0xf6,0x06,0xf2,0x88,0x01,0x01,0x66,0x01,0x40,0x02,
-0x45,0xf6,0x05,0xcf,0xbc,0xb0,0xf5,0xcf,0xff,0x70,0x5f,0x31,0xfa,0x76,0x64,0x00,
-0x12,0xd5,0x00,0x12,0x60,0xb3,0x00,0x24,0x21,0xf6,0xe6,0x00,0xe4,0xc8,0x99,0xbe,
-0xd0,0x1f,0x70,0x5f,0x20,0x9d,0xdd,0xca,0x83,0x01,0xf6,0x5b,0x86,0x36,0x20,0x3d,
-0x10,0xe0,0x91,0x13,0x9f,0xf7,0x07,0x10,0x01,0x1a,0xe7,0x17,0x3b,0x2a,0x77,0x00,
-0xc7,0x0a,0x01,0x44,0x3b,0x13,0x9f,0x39,0x1b,0x0d,0xd5,0x00,0x05,0x7c,0x9e,0x19,
-0x06,0x01,0x09,0x93,0x13,0x04,0x55,0x45,0x53,0x00,0x1f,0x40,0x9e,0x4b,0x02,0x40,
-0xaf,0x1f,0x71,0x11,0xba,0x00,0x13,0x9f,0xc2,0x00,0x01,0x08,0x00,0xf3,0x04,0x24,
-0x5f,0x60,0x9f,0x1f,0xfe,0xee,0xf4,0xcf,0xff,0x60,0x9f,0x1f,0xb8,0x87,0x61,0x02,
-0x3f,0x70,0x20,0x00,0x03,0x08,0x00,0x11,0x0f,0x08,0x00,0x60,0x25,0x40,0x0f,0x70,
-0x9e,0x0f,0x75,0x03,0xb3,0x0f,0x70,0x9e,0x03,0x66,0x65,0x31,0x00,0x0f,0x60,0x9e,
-0x36,0x0e,0x24,0x24,0x00,0x66,0x42,0x02,0x60,0x30,0x00,0x9a,0xae,0x5f,0x76,0x55,
-0x55,0x55,0xfa,0x61,0x10,0x14,0x07,0xca,0x2b,0x14,0x11,0x5a,0xe6,0x14,0x3f,0xa4,
-0x1c,0x40,0x05,0xf6,0x44,0x55,0x8a,0xf3,0x0f,0x65,0x19,0x02,0x70,0x6f,0x98,0x88,
-0x89,0x99,0x92,0x00,0x7f,0x6d,0x5e,0xee,0xee,0xed,0xdc,0x30,0x26,0x00,0x09,0x0e,
-0x1e,0x24,0x04,0xff,0x3b,0x15,0x10,0x05,0xd2,0x0b,0x1a,0x53,0x27,0xe0,0x07,0xe0,
-0x73,0x0e,0xcd,0x36,0x01,0xde,0x5f,0x21,0x77,0x07,0x15,0xfd,0x0b,0xcd,0x36,0x14,
-0xcf,0x2f,0xd4,0x01,0x36,0xe6,0x19,0x10,0x5f,0xfd,0x03,0x72,0xd0,0x15,0x00,0x3d,
-0x1d,0x14,0xfa,0x3a,0x7b,0x05,0x9c,0x0f,0x01,0x65,0x57,0x14,0x60,0x18,0xcb,0x1e,
-0xc0,0x11,0xae,0x02,0xbb,0xd2,0x1f,0x85,0xbb,0xd2,0x0c,0x2d,0x02,0xf5,0x82,0xea,
-0x0e,0x80,0x36,0x19,0xfa,0xd1,0x57,0x2e,0xf8,0x00,0x51,0x4e,0x03,0x72,0x1b,0x13,
-0x30,0xf2,0xb5,0x19,0x54,0x10,0x58,0x10,0xf9,0x04,0x01,0x04,0x1e,0x9d,0x28,0xed,
-0x30,0x1b,0x00,0x13,0xf5,0xe6,0x09,0x07,0x04,0xb6,0x56,0x66,0xaf,0x75,0x54,0x20,
-0x1f,0x1b,0x68,0x02,0x32,0x22,0x22,0x8f,0x42,0x0f,0xcb,0x0e,0xf2,0xe9,0x01,0x89,
-0x57,0x21,0xec,0x81,0x2a,0x35,0x53,0xfa,0x76,0x7a,0xff,0x30,0x07,0x1d,0x11,0x2e,
-0xd2,0xa2,0x04,0x90,0x01,0x05,0x09,0x00,0x05,0x1b,0x00,0x61,0x3f,0xfa,0x87,0x8b,
-0xfe,0x20,0x21,0x61,0x43,0xcd,0xca,0x71,0x00,0xed,0x0f,0x20,0x88,0x10,0xc7,0x02,
-0x59,0xed,0xde,0xed,0xdd,0xc3,0xa6,0x85,0x05,0x0e,0x11,0x01,0xa6,0xcc,0x11,0x88,
-0x13,0x00,0x00,0x40,0x02,0x1f,0xc1,0x26,0x00,0x04,0x01,0x44,0xfe,0x14,0x60,0x23,
-0x05,0x15,0xfc,0xae,0x54,0x0f,0x4a,0xd1,0x02,0x06,0x97,0x12,0x00,0x4a,0xd1,0x24,
-0x9f,0x54,0x4a,0xd1,0x0f,0xbc,0x81,0x0a,0x0f,0xa9,0x0d,0x08,0x04,0xe1,0x01,0x04,
-0x1a,0x03,0x14,0x04,0xe3,0x11,0x14,0x06,0x19,0x03,0x1e,0x06,0x7a,0xd6,0x13,0xf8,
-0xa9,0x01,0x02,0x9e,0xd6,0x1f,0x40,0x9e,0xd6,0x06,0x15,0x01,0x51,0x10,0x13,0xf4,
-0x9e,0xd6,0x2f,0x65,0x30,0xc3,0x77,0x1a,0x17,0xfd,0x18,0x13,0x23,0x01,0x10,0xe9,
-0x0b,0x14,0xdf,0xed,0x02,0x14,0xfc,0xfb,0x48,0x06,0x55,0x62,0x00,0xcb,0x3f,0x01,
-0xa4,0xeb,0x00,0xb0,0x03,0x18,0x40,0xca,0x12,0x05,0xe7,0xe4,0x05,0xf1,0x7f,0x12,
-0x24,0xe3,0x5d,0x0e,0xec,0xd1,0x06,0x25,0x5a,0x1e,0x10,0x62,0x63,0x01,0x0b,0x14,
-0x05,0x57,0xd0,0x13,0xf4,0xdc,0x02,0x1f,0x04,0x96,0x39,0x11,0x1b,0xf3,0x9c,0x6e,
-0x07,0x16,0xea,0x00,0xe3,0x57,0x01,0xe0,0x03,0x0a,0x7c,0xec,0x45,0x11,0x11,0x22,
-0x22,0xf6,0x02,0x10,0x50,0x2c,0x02,0x00,0x95,0x01,0x09,0xf0,0xa4,0x21,0xfc,0x66,
-0x93,0x24,0x02,0x47,0x9e,0x1f,0xee,0x20,0xf1,0x01,0x23,0x17,0x87,0x23,0x2d,0x01,
-0x13,0xd4,0x0e,0x89,0x52,0x0f,0xbe,0xcf,0x20,0x1d,0xef,0xbe,0xcf,0x05,0x9e,0x01,
-0x13,0xef,0xab,0x00,0x23,0x01,0xfb,0x9e,0x01,0x06,0xcf,0x00,0x01,0x3a,0x88,0x10,
-0x40,0xb4,0x00,0x00,0x2b,0x13,0x18,0x10,0xee,0xea,0x13,0xfc,0x56,0x01,0x2b,0x00,
-0xbe,0xc6,0x00,0x40,0x16,0x65,0x55,0x54,0x53,0x2b,0x05,0xec,0xd1,0x0f,0x27,0x5e,
-0x01,0x1f,0x08,0xbe,0xcf,0x10,0x1e,0x08,0xbe,0xcf,0x0f,0xc9,0x54,0x0a,0x0f,0xc6,
-0x0c,0x03,0x33,0x71,0x00,0x05,0xb7,0x0c,0x12,0x5f,0xb7,0x0c,0x0d,0x0f,0x00,0x00,
-0xdc,0x00,0xa3,0x20,0x00,0x5f,0x0f,0xfe,0xee,0xed,0xc3,0x00,0x05,0xb7,0x0c,0x12,
-0x5f,0xb7,0x0c,0x0e,0x0f,0x00,0x01,0x82,0x4f,0x8f,0x5f,0x0e,0xfd,0xdd,0xde,0xff,
-0xb0,0x05,0xc6,0x0c,0x12,0x13,0x5f,0x9d,0x00,0x0c,0xc6,0x0c,0x0f,0x56,0x0b,0x13,
-0x00,0x08,0x00,0x02,0xe6,0x0c,0x6e,0xf2,0x1f,0xa7,0x77,0x65,0x40,0x20,0x00,0x01,
-0x56,0x0b,0x31,0xad,0x80,0x05,0x56,0x0b,0x2d,0xb9,0x30,0x56,0x0b,0x15,0x80,0x16,
-0x0c,0x04,0x1f,0xb9,0x01,0x58,0x6a,0x1c,0x3a,0x8a,0xf8,0x0b,0xa3,0x26,0x0c,0xa8,
-0x13,0x2a,0x02,0x50,0x60,0x2f,0x12,0x01,0xb6,0x87,0x01,0x52,0x00,0x11,0x07,0x9c,
-0x90,0x32,0x76,0x66,0x65,0x62,0x1f,0x31,0x05,0x00,0x02,0x73,0x71,0x00,0xda,0x0a,
-0x01,0x9a,0x69,0x05,0x0a,0x00,0x1d,0xf2,0x0a,0x00,0x00,0x9c,0x04,0x13,0x70,0x0a,
-0x00,0x00,0x62,0x1f,0x08,0x32,0x00,0x16,0x08,0x0a,0x00,0x03,0x8d,0x6f,0x63,0x4f,
-0x10,0x09,0xe0,0x00,0x05,0x0a,0x00,0x10,0xd0,0xd5,0xf2,0x02,0x08,0x12,0x32,0xfb,
-0x05,0xf1,0x87,0x28,0x26,0x65,0x41,0xbf,0x16,0x2f,0x05,0xf1,0x62,0x1f,0x14,0x0e,
-0xc7,0x8f,0x01,0xb8,0x2d,0x00,0x72,0x84,0x11,0x63,0xfe,0x48,0x01,0xc0,0x1c,0x01,
-0x4b,0x37,0x32,0x21,0x10,0x21,0xb4,0x20,0x10,0x6e,0x10,0xf2,0x03,0x3b,0x9a,0x10,
-0xe9,0xca,0x1c,0x10,0x10,0x28,0x94,0x10,0x80,0x72,0x17,0x21,0xc0,0x08,0x74,0xb2,
-0x30,0x9f,0x66,0x63,0x75,0xb2,0x12,0x70,0xcc,0x83,0x63,0xf0,0x00,0xf7,0x22,0x00,
-0x8e,0x50,0xe6,0x01,0x96,0x59,0x11,0x66,0x22,0x28,0x25,0x8e,0x00,0xdf,0xce,0x08,
-0x70,0x77,0x14,0x03,0xfd,0x65,0x06,0xe1,0xff,0x22,0x04,0xf4,0x86,0x70,0x07,0x72,
-0x77,0x22,0x04,0xf7,0x89,0x70,0x08,0x26,0x00,0x14,0xf3,0xb9,0x08,0x05,0x37,0x12,
-0x0a,0x8f,0x70,0x05,0x85,0x33,0xe0,0x04,0xf0,0x06,0xf1,0x0b,0xee,0xdd,0xdd,0xed,
-0x16,0xf1,0x06,0xf1,0x06,0xe1,0x03,0x01,0x43,0x64,0x32,0x04,0x00,0x03,0x4c,0x64,
+0xd5,0x02,0x11,0x30,0x11,0x00,0x02,0xd3,0x05,0x40,0x88,0x20,0x00,0x8f,0x58,0x01,
+0x11,0xf9,0x6b,0x06,0x00,0xb7,0x02,0x21,0x8f,0x10,0xb7,0x02,0x02,0x0f,0x00,0x15,
+0x90,0x0f,0x00,0x71,0xf4,0x22,0x22,0x23,0x3f,0x90,0x00,0x45,0x05,0x84,0xf6,0x00,
+0x00,0x12,0x22,0x22,0x22,0x10,0x82,0x03,0x82,0x30,0x01,0x69,0x95,0x00,0x00,0x00,
+0xbc,0x64,0x01,0x40,0x0b,0xc0,0xed,0x10,0xe4,0x03,0x13,0xbc,0x1b,0x02,0x83,0xc7,
+0xf1,0x00,0x00,0x7f,0x10,0x00,0xbc,0x1a,0x02,0x03,0x91,0x03,0x12,0xbc,0x19,0x02,
+0x92,0x0b,0xc0,0xaf,0x83,0x4a,0xf5,0x00,0x00,0xbc,0x60,0x01,0x21,0x0b,0xc0,0xd9,
+0x04,0x23,0x00,0xbc,0x89,0x04,0x32,0x50,0x00,0x13,0xad,0x00,0x01,0x12,0x07,0x40,
+0x0b,0x90,0x00,0x8f,0x0f,0x00,0x92,0xba,0x00,0x08,0xf2,0x21,0x11,0x11,0x2c,0xa0,
+0xbc,0x00,0x92,0xfa,0x00,0x08,0xf6,0x66,0x66,0x55,0x5e,0xa0,0x1e,0x00,0x12,0xda,
+0x2d,0x00,0x31,0x0d,0xa0,0x00,0xd5,0x08,0x84,0xf7,0x00,0x00,0x45,0x55,0x55,0x55,
+0x54,0x04,0x08,0x60,0x30,0x00,0x04,0xac,0xc7,0x00,0x7f,0x05,0xd0,0x07,0xfc,0x89,
+0xfc,0x00,0x00,0x0d,0xb0,0x02,0xfb,0x00,0x04,0xf6,0x11,0x00,0x20,0x7f,0x20,0x84,
+0x03,0x20,0x0d,0xb0,0xe5,0x05,0x10,0xad,0x11,0x00,0x11,0xad,0x4a,0x03,0x20,0x0d,
+0xb0,0x51,0x00,0x10,0x9d,0x11,0x00,0x50,0x6f,0x40,0x00,0x0d,0xa0,0x25,0x00,0x40,
+0xee,0x20,0x09,0xf3,0x6b,0x00,0x41,0x03,0xef,0xef,0xf7,0x6c,0x00,0x31,0x01,0x68,
+0x72,0x7c,0x00,0x03,0x5a,0x05,0x17,0x40,0x3d,0x03,0x22,0x0a,0xc0,0x9a,0x05,0x00,
+0x66,0x08,0x20,0x9f,0x00,0xc3,0x06,0x41,0x90,0x00,0x0d,0xd0,0xd5,0x07,0x40,0x10,
+0x02,0xff,0x20,0x19,0x00,0xf0,0x07,0xfc,0x00,0xaf,0xfd,0x10,0x00,0x00,0x8f,0x24,
+0xf9,0x3f,0x63,0xfc,0x00,0x00,0x4f,0x70,0x06,0xff,0xb0,0x04,0xfc,0x8f,0x01,0x50,
+0x0b,0xd1,0x00,0x03,0xd5,0x99,0x05,0x16,0x21,0x51,0x00,0x15,0x35,0x5a,0x00,0xf2,
+0x04,0xd0,0x00,0x00,0x6e,0xee,0xef,0xff,0x10,0x00,0xae,0x00,0x00,0x03,0x78,0x87,
+0x7c,0xf1,0x00,0x0a,0xfa,0x03,0x22,0xbd,0x00,0x61,0x02,0x33,0x00,0x0f,0x90,0x22,
+0x03,0x23,0x05,0xf4,0x7e,0x00,0x24,0x00,0xbd,0x35,0x03,0x23,0x2f,0x70,0x13,0x00,
+0x50,0x09,0xf5,0x00,0x00,0x08,0x90,0x07,0x60,0x02,0xff,0xc0,0x00,0x00,0x8f,0xe9,
+0x07,0x32,0xbe,0x7f,0x40,0x46,0x04,0x60,0x4f,0x60,0xec,0x00,0x00,0x8e,0x51,0x01,
+0x31,0xc0,0x05,0xf6,0x13,0x00,0x50,0x09,0xf2,0x00,0x0c,0xe1,0x13,0x00,0x60,0x04,
+0xf5,0x00,0x00,0x2f,0x90,0x13,0x00,0x74,0xa9,0x00,0x00,0x00,0x58,0x00,0x8f,0x98,
+0x00,0x05,0xc0,0x08,0x0f,0x13,0x00,0x0a,0x25,0x05,0xc0,0xd2,0x00,0x12,0x10,0x4a,
+0x09,0x00,0xb5,0x00,0x00,0x89,0x00,0x21,0xff,0xf3,0xa2,0x00,0x53,0x25,0x54,0x44,
+0xbf,0x20,0x30,0x00,0x23,0x1f,0xb0,0x43,0x00,0x23,0x09,0xf4,0x43,0x00,0x60,0x03,
+0xfb,0x00,0x00,0x08,0xf6,0xea,0x03,0x00,0xa7,0x07,0x10,0x8f,0x1d,0x09,0x23,0x9f,
+0xfd,0x33,0x09,0x32,0x6f,0x93,0xfb,0x26,0x00,0x51,0x6f,0xb0,0x05,0xf8,0x00,0x56,
+0x07,0x60,0xb0,0x00,0x07,0xf5,0x00,0x8f,0xb1,0x00,0x64,0x00,0x00,0x06,0x60,0x08,
+0xe0,0xee,0x06,0x19,0x8c,0xe9,0x04,0x60,0x7e,0xee,0xee,0xff,0xff,0xe9,0x28,0x02,
+0x55,0x88,0x77,0x77,0x77,0x7d,0xb5,0x00,0x15,0xaf,0x73,0x01,0x14,0xe0,0x0a,0x00,
+0x1e,0xae,0x13,0x00,0x24,0xad,0x00,0x00,0x02,0x18,0x70,0x04,0x08,0x00,0xdc,0x00,
+0x01,0x1f,0x05,0x01,0x06,0x0a,0x11,0xf5,0x78,0x07,0x54,0x02,0x55,0x54,0x4a,0xf4,
+0x82,0x07,0x24,0x0d,0xd0,0x0a,0x00,0x23,0x6f,0x60,0x0a,0x00,0x24,0x01,0xfd,0xa0,
+0x07,0x24,0x0b,0xf6,0x0a,0x00,0x10,0x8f,0x14,0x00,0x00,0xa7,0x01,0xe1,0x05,0xfa,
+0x3f,0xa0,0x00,0x06,0xf7,0x66,0x40,0x00,0x5f,0xc0,0x06,0xf7,0x1e,0x00,0xf0,0x01,
+0x06,0xfb,0x00,0x00,0x9f,0x40,0x06,0xf0,0x00,0x00,0x2f,0xa0,0x00,0x00,0x0a,0xb0,
+0x0a,0x00,0x12,0x04,0x8c,0x00,0x05,0xc5,0x00,0x02,0x0a,0x00,0x15,0xd6,0x0a,0x00,
+0x10,0xf8,0xbd,0x03,0x01,0xaa,0x00,0x03,0x04,0x06,0x08,0x0a,0x00,0x16,0x01,0x0a,
+0x00,0x10,0xfb,0xa5,0x0b,0x01,0x9a,0x04,0x01,0x1c,0x06,0x14,0xf4,0x57,0x09,0x07,
+0x85,0x07,0x81,0x40,0x00,0x00,0x03,0x56,0x66,0x78,0x60,0x0d,0x01,0x45,0x0c,0xff,
+0xfe,0xef,0x8a,0x02,0x24,0x0e,0xc0,0x0a,0x00,0x23,0x8f,0x40,0x0a,0x00,0x60,0x03,
+0xfa,0x00,0x00,0x0a,0xe1,0x3f,0x00,0x51,0x1e,0xf1,0x00,0x00,0x09,0x36,0x05,0x20,
+0xdf,0xf9,0x87,0x02,0x71,0x55,0x30,0x00,0x0c,0xf4,0x9f,0x60,0x68,0x05,0x51,0x01,
+0xcf,0x40,0x0a,0xf5,0x0a,0x00,0x60,0x2d,0xe3,0x00,0x00,0xaf,0x30,0x0a,0x00,0x10,
+0x5c,0x3c,0x07,0x35,0x50,0x09,0xe0,0x78,0x00,0x14,0x50,0x3a,0x06,0x21,0x64,0x20,
+0x04,0x06,0x00,0x01,0x00,0x01,0x9c,0x05,0x00,0x9f,0x00,0x29,0x0a,0xe0,0xa3,0x01,
+0x60,0x02,0x77,0x88,0x88,0x88,0x8d,0x0a,0x00,0x01,0x64,0x06,0x01,0x65,0x0a,0x14,
+0x09,0xfb,0x08,0x06,0x0a,0x00,0x00,0x1f,0x0c,0x31,0xee,0xef,0xff,0xe7,0x0c,0x10,
+0x78,0x6d,0x0b,0x19,0x61,0xe6,0x00,0x31,0x34,0x45,0x55,0x36,0x03,0x11,0x0a,0x0a,
+0x01,0x10,0x09,0x8b,0x09,0x43,0x11,0x10,0xbf,0x10,0xa7,0x02,0x23,0x2f,0x90,0xa7,
+0x02,0x23,0x0b,0xf2,0xa7,0x02,0x21,0x05,0xf8,0xd9,0x0b,0x40,0x50,0x00,0x01,0xef,
+0xa7,0x02,0x72,0xee,0xeb,0x00,0x00,0xcf,0xde,0x10,0x26,0x00,0x32,0x9f,0x51,0xec,
+0x26,0x00,0x41,0x9f,0x70,0x03,0xfa,0x13,0x00,0x72,0x9f,0x70,0x00,0x05,0xf6,0x00,
+0x9e,0x85,0x0c,0x26,0x04,0x40,0xea,0x00,0x12,0x6b,0x8b,0x01,0x22,0x45,0x43,0x0f,
+0x00,0x60,0x2b,0xff,0xff,0xff,0xa1,0x00,0x42,0x01,0x50,0xe6,0x10,0x02,0x8f,0xb0,
+0xb6,0x00,0x10,0xf3,0x3f,0x02,0x00,0xd4,0x02,0x10,0xbe,0xab,0x00,0x10,0xf6,0xf6,
+0x00,0x13,0xf0,0x9d,0x0d,0x01,0xa5,0x0a,0x11,0x1b,0xe1,0x00,0x51,0xbf,0xd9,0x78,
+0xae,0xf6,0x43,0x00,0x47,0x5a,0xcd,0xcb,0x82,0xe2,0x07,0x02,0x22,0x02,0xf0,0x09,
+0xd0,0x03,0xf2,0x08,0x9a,0xab,0xc3,0x00,0x8e,0x00,0x4f,0x21,0xbc,0xcc,0xdf,0x60,
+0x08,0xe0,0x04,0xf2,0x00,0x00,0x05,0xf3,0x11,0x00,0x10,0x20,0xf8,0x00,0x10,0x09,
+0x11,0x00,0x00,0x99,0x04,0x10,0x9e,0x11,0x00,0x22,0x04,0xf5,0x11,0x00,0x00,0x0d,
+0x03,0x90,0x9f,0x55,0x8f,0x20,0x00,0x0f,0xb0,0x00,0x09,0x77,0x0d,0x32,0x07,0xff,
+0x10,0x33,0x00,0x31,0xec,0xf7,0x00,0x44,0x00,0x31,0x6f,0x3a,0xe0,0x11,0x00,0x31,
+0x0e,0xa0,0x3f,0x55,0x00,0x40,0x09,0xf2,0x00,0xbd,0x11,0x00,0x50,0x22,0xf7,0x00,
+0x03,0xf5,0x11,0x00,0x10,0xbc,0xb6,0x02,0x82,0x8e,0x00,0x4f,0x24,0x10,0x00,0x00,
+0x03,0x77,0x00,0x20,0x00,0x00,0x22,0x00,0x12,0x30,0x3f,0x04,0x23,0x04,0xf3,0x3e,
+0x04,0x02,0x11,0x00,0xd0,0x04,0x90,0x03,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x13,0x00,0x01,0x00,0xf1,0x13,0x10,0x00,0x00,0x01,0x11,0x00,0x05,0xe0,
+0x04,0xf3,0x08,0xff,0xff,0xff,0x70,0x07,0xf0,0x04,0xf4,0x02,0x55,0x54,0x8f,0x70,
+0x07,0xf1,0x04,0xf4,0x00,0x00,0x00,0xbf,0x10,0x06,0x09,0x00,0xf3,0x04,0x03,0xf9,
+0x00,0x06,0xf1,0x03,0xf4,0x00,0x00,0x0d,0xf1,0x00,0x06,0xfb,0xbc,0xf4,0x00,0x00,
+0x7f,0x09,0x00,0x32,0x03,0xfc,0xeb,0x1b,0x00,0x41,0x1d,0xe1,0x4f,0x80,0x09,0x00,
+0x40,0xbf,0x30,0x07,0xf4,0x36,0x00,0xf1,0x04,0x09,0xf5,0x00,0x00,0xaf,0x16,0xf1,
+0x04,0xf3,0x2f,0x60,0x00,0x00,0x08,0x16,0xf0,0x04,0xf3,0x01,0x73,0x00,0x46,0x30,
+0x01,0x70,0x00,0x01,0x00,0x20,0x0b,0xff,0x01,0x00,0xa3,0xc0,0x00,0x00,0x04,0x77,
+0x66,0x66,0x66,0x6c,0xf0,0x17,0x00,0x1f,0x09,0x09,0x00,0x11,0x13,0xe0,0x09,0x00,
+0x39,0x05,0x80,0x00,0x01,0x00,0xf1,0x0d,0xd6,0x6c,0xcd,0xde,0xee,0x30,0x00,0x0e,
+0x74,0x99,0x98,0x8b,0xf4,0x00,0x00,0xe7,0x00,0x00,0x00,0x8f,0x00,0x00,0x0e,0x70,
+0x00,0x00,0x0d,0xc0,0x0f,0x00,0x22,0x02,0xf7,0x0f,0x00,0xf0,0x11,0x8f,0x10,0x00,
+0x00,0xe8,0x00,0x00,0x0e,0xa0,0x17,0x77,0x7f,0x80,0x00,0x06,0xf7,0x03,0xff,0xff,
+0xf8,0x00,0x00,0xdf,0xd0,0x00,0x00,0x0e,0x80,0x00,0x6f,0xaf,0x50,0x1e,0x00,0x30,
+0x0e,0xa0,0xeb,0x0f,0x00,0xf2,0x16,0x08,0xf2,0x06,0xf3,0x00,0x00,0xd9,0x03,0xf7,
+0x00,0x0d,0xb0,0x00,0x0d,0x90,0xdb,0x00,0x00,0x5f,0x30,0x00,0xd9,0x8e,0x10,0x00,
+0x00,0xc9,0x00,0x0c,0x93,0x20,0x00,0x00,0x01,0x20,0x00,0xc8,0x7f,0x00,0x13,0x0c,
+0x8f,0x00,0x12,0xd8,0x07,0x00,0x13,0x0e,0xef,0x00,0x16,0x83,0xa1,0x00,0xf0,0x07,
+0x01,0x12,0x20,0x00,0x00,0xab,0x03,0xff,0xff,0xff,0xfa,0x00,0x00,0xbd,0x00,0x44,
+0x44,0x46,0xf9,0x00,0x00,0xbd,0xd3,0x00,0x12,0xf2,0x08,0x00,0x22,0x2f,0xa0,0x08,
+0x00,0xf1,0x28,0xcf,0x10,0x02,0x22,0xbd,0x00,0x00,0x07,0xf8,0x00,0x6f,0xff,0xfd,
+0x00,0x00,0x3f,0xfe,0x10,0x03,0x33,0xcd,0x00,0x01,0xee,0x5f,0xb0,0x00,0x00,0xad,
+0x00,0x1d,0xf2,0x05,0xf9,0x00,0x00,0xad,0x01,0xde,0x30,0x00,0x8f,0x60,0x00,0xbd,
+0x0d,0xe2,0x00,0x00,0x08,0xe0,0x00,0xbc,0x07,0x10,0x65,0x00,0x16,0xab,0x70,0x00,
+0xe3,0xac,0xdd,0xdd,0xdd,0xdd,0xd4,0x00,0x00,0x8a,0x99,0x99,0x99,0x99,0xfa,0x15,
+0x00,0x04,0x08,0x00,0x1f,0xea,0x08,0x00,0x04,0x13,0xf9,0x08,0x00,0x19,0x84,0x5d,
+0x01,0x00,0x63,0x00,0x50,0x01,0xbc,0xdd,0xde,0xe9,0x54,0x01,0x70,0x07,0x87,0x77,
+0x7f,0xb0,0x00,0x08,0x91,0x01,0x21,0x06,0xf5,0x65,0x01,0x42,0x00,0x00,0xed,0x00,
+0x11,0x00,0x22,0x8f,0x40,0x11,0x00,0xf1,0x04,0x3f,0xb0,0x03,0xff,0xff,0xf0,0x00,
+0x00,0x0d,0xfd,0x00,0x06,0x66,0xbf,0x00,0x00,0x0a,0xf9,0xf9,0x22,0x00,0x40,0x08,
+0xf7,0x09,0xf4,0x22,0x00,0xf6,0x07,0x08,0xf9,0x00,0x0c,0xe2,0x00,0x08,0xe0,0x08,
+0xf8,0x00,0x00,0x1e,0xc0,0x00,0x9e,0x00,0xb6,0x00,0x00,0x00,0x17,0xdd,0x01,0x50,
+0x9d,0x00,0x00,0x00,0xb5,0x1b,0x01,0x40,0xd0,0x00,0x00,0x1f,0x5a,0x01,0x53,0x59,
+0x00,0x00,0x01,0xf8,0x1d,0x00,0x13,0x1f,0x6b,0x01,0x06,0x11,0x00,0x90,0xb6,0x55,
+0x56,0x66,0x78,0x10,0x00,0x00,0xdf,0x57,0x02,0x2b,0xe3,0x00,0x01,0x00,0xf0,0x03,
+0x02,0x00,0x05,0x56,0x66,0x77,0x30,0x00,0x09,0xe0,0x03,0xff,0xff,0xee,0xfb,0x00,
+0x00,0xaf,0x16,0x00,0x22,0x5f,0x70,0x55,0x02,0x50,0x0d,0xe0,0x00,0x00,0x9f,0xe2,
+0x00,0xf1,0x03,0xf6,0x01,0x88,0x8c,0xf0,0x00,0x00,0x04,0xfc,0x00,0x3d,0xdd,0xff,
+0x00,0x00,0x02,0xef,0xf3,0x77,0x02,0x40,0x02,0xee,0x3d,0xe2,0x22,0x00,0xf2,0x0b,
+0x03,0xee,0x20,0x2e,0xd1,0x00,0x09,0xf0,0x04,0xfd,0x20,0x00,0x2e,0xd0,0x00,0x9e,
+0x00,0xeb,0x10,0x00,0x00,0x1a,0x10,0x09,0xe0,0x01,0x66,0x00,0xfc,0x03,0x24,0x00,
+0x00,0x03,0x88,0x88,0x88,0x88,0x99,0x60,0x00,0x00,0xaf,0xff,0xff,0xff,0xee,0xfe,
+0xb2,0x02,0xf4,0x06,0x9e,0x00,0x00,0x07,0xee,0xee,0xee,0xee,0xef,0xd0,0x00,0x00,
+0xbf,0xa9,0x99,0x99,0x99,0x94,0x00,0x00,0x0b,0x1d,0x00,0x11,0xbf,0xd2,0x00,0xf4,
+0x02,0x00,0x00,0x09,0xff,0xee,0xef,0xff,0xff,0xf5,0x00,0x00,0x16,0x77,0x77,0x77,
+0x66,0x65,0xc4,0x00,0xf1,0x0b,0x21,0x00,0x23,0x34,0x45,0x51,0x00,0x00,0xdb,0x04,
+0xff,0xff,0xff,0xfc,0x00,0x00,0xdb,0x00,0x21,0x11,0x16,0xf8,0x00,0x00,0xcb,0x00,
+0x9f,0x03,0x01,0x08,0x00,0x21,0x6f,0x70,0x08,0x00,0xf1,0x03,0x02,0xfd,0x00,0x4d,
+0xdd,0xfb,0x00,0x00,0x0c,0xfb,0x00,0x28,0x88,0xeb,0x00,0x00,0xaf,0xaf,0x18,0x00,
+0x11,0x09,0x7b,0x01,0xf5,0x0a,0xcb,0x00,0xaf,0x80,0x00,0xbf,0x20,0x00,0xcb,0x0a,
+0xf7,0x00,0x00,0x1d,0xd0,0x00,0xdb,0x0c,0x50,0x00,0x00,0x01,0x60,0x00,0xca,0x68,
+0x00,0x01,0x79,0x00,0x50,0x78,0x72,0x00,0x00,0x7f,0x4d,0x01,0x12,0xf9,0x30,0x03,
+0x2f,0x00,0xe9,0x08,0x00,0x08,0xa1,0x42,0x22,0x22,0x33,0xf9,0x00,0x00,0x5f,0xff,
+0xff,0xb9,0x00,0x54,0x01,0x22,0x22,0x22,0x21,0xb8,0x00,0xa2,0x13,0x00,0x34,0x44,
+0x55,0x52,0x00,0x00,0x9e,0x02,0xb8,0x00,0x90,0xad,0x00,0x11,0x11,0x14,0xf8,0x00,
+0x00,0xad,0x06,0x04,0x12,0xf1,0x08,0x00,0xb0,0x5f,0x80,0x02,0x22,0xad,0x00,0x00,
+0x02,0xed,0x00,0x7f,0xf0,0x02,0xb0,0x0c,0xfe,0x10,0x04,0x44,0xbd,0x00,0x00,0xbf,
+0x7e,0xc0,0x20,0x00,0x40,0x0b,0xf5,0x03,0xfb,0x08,0x00,0xf1,0x02,0xbf,0x50,0x00,
+0x5f,0x90,0x00,0xad,0x0b,0xf4,0x00,0x00,0x05,0xe1,0x00,0x9d,0x07,0x20,0x60,0x00,
+0x40,0x47,0x00,0x00,0x04,0x08,0x00,0x40,0x12,0x00,0x00,0x6f,0x90,0x00,0x52,0x9b,
+0x00,0x00,0x7f,0x10,0x08,0x03,0x63,0x7f,0x32,0x11,0x11,0x12,0xbb,0xc8,0x00,0xc0,
+0xfb,0x00,0x00,0x7f,0x66,0x66,0x65,0x55,0xdc,0x00,0x00,0x6f,0x30,0x00,0x12,0xcc,
+0x08,0x00,0x00,0x30,0x01,0x31,0x6f,0xff,0xff,0x02,0x04,0x64,0x04,0x55,0x55,0x55,
+0x55,0x40,0xb8,0x00,0x00,0x70,0x01,0x07,0xb8,0x00,0x62,0x9f,0x00,0x12,0x11,0x14,
+0xf9,0x2a,0x02,0x22,0x0b,0xf2,0x08,0x00,0x22,0x3f,0x90,0xed,0x02,0x21,0xdf,0x10,
+0x31,0x02,0xb0,0x08,0xfc,0x00,0x18,0x88,0xcf,0x00,0x00,0x5f,0xdf,0x70,0x18,0x00,
+0x22,0x03,0xfc,0xeb,0x02,0xa0,0x3f,0xd1,0x00,0xcf,0x20,0x00,0x9f,0x04,0xfd,0x10,
+0x70,0x01,0x31,0x9f,0x0e,0xb0,0x70,0x01,0x22,0x9f,0x02,0x68,0x00,0x10,0x8e,0x05,
+0x00,0x21,0x35,0x54,0xcd,0x00,0xf0,0x03,0x7e,0xff,0xff,0xfd,0x50,0x00,0x00,0x08,
+0xfa,0x30,0x01,0x4c,0xf4,0x00,0x00,0x0f,0xb0,0x00,0xe8,0x01,0xc1,0x00,0x3f,0x60,
+0x00,0x00,0x00,0xae,0x00,0x00,0x2f,0x70,0x00,0x20,0x04,0x40,0x0e,0xe2,0x00,0x00,
+0x03,0x04,0xd4,0x04,0xff,0xa8,0x78,0xcf,0xd1,0x00,0x00,0x00,0x28,0xbd,0xdc,0xa6,
+0x70,0x01,0x12,0x04,0x1a,0x03,0xf0,0x09,0xf3,0x04,0xf2,0x09,0xbb,0xbb,0xb2,0x00,
+0x2f,0x40,0x4f,0x21,0xbc,0xcb,0xdf,0x50,0x02,0xf4,0x04,0xf2,0x00,0x00,0x06,0xf2,
+0x11,0x00,0x10,0x20,0x4e,0x00,0x02,0x11,0x00,0x20,0x0e,0xa0,0x11,0x00,0x40,0x10,
+0x00,0x04,0xf5,0x11,0x00,0x70,0xf1,0x00,0x00,0xae,0x03,0x99,0xaf,0x11,0x00,0x40,
+0x1f,0xc0,0x4c,0xcc,0x11,0x00,0x32,0x07,0xff,0x20,0x22,0x00,0x22,0xec,0xf9,0x22,
+0x00,0x31,0x7f,0x38,0xf1,0x11,0x00,0x40,0x0e,0xb0,0x1f,0x80,0x11,0x00,0x40,0x08,
+0xf3,0x00,0x9e,0x11,0x00,0xf1,0x08,0x12,0xf8,0x00,0x01,0xf7,0x01,0xf4,0x04,0xf1,
+0xad,0x00,0x00,0x08,0xd0,0x1f,0x40,0x4f,0x23,0x20,0x00,0x00,0x03,0x01,0x66,0x00,
+0x00,0xa2,0x03,0x01,0x77,0x00,0x13,0x00,0x77,0x00,0x00,0xec,0x04,0x22,0x30,0x4f,
+0xc1,0x01,0x34,0x70,0x03,0xf2,0x20,0x05,0x05,0xb1,0x03,0x10,0x30,0x45,0x02,0xf1,
+0x0e,0x00,0x01,0xf3,0x07,0xf0,0x09,0xff,0xff,0xff,0x80,0x02,0xf5,0x07,0xf1,0x02,
+0x55,0x44,0x8f,0x60,0x02,0xf6,0x07,0xf1,0x00,0x00,0x00,0xce,0x00,0x01,0x09,0x00,
+0xd1,0x05,0xf6,0x00,0x01,0xf6,0x06,0xf1,0x00,0x00,0x1e,0xe0,0x1e,0xff,0x09,0x00,
+0x40,0xaf,0xf6,0x06,0x66,0x09,0x00,0x50,0x06,0xf7,0xaf,0x20,0x00,0x09,0x00,0x40,
+0x3f,0xa0,0x0d,0xd0,0x09,0x00,0x50,0x02,0xec,0x00,0x02,0xfa,0x09,0x00,0xb0,0x0d,
+0xd1,0x00,0x00,0x4f,0x21,0xf6,0x07,0xf1,0x09,0x10,0x72,0x00,0x33,0xc3,0x07,0xf1,
+0x37,0x01,0x21,0x05,0xd0,0x09,0x00,0x28,0x6f,0x20,0x90,0x03,0x00,0xb2,0x00,0x22,
+0xfe,0x10,0x09,0x00,0x32,0x0d,0xff,0xe2,0x09,0x00,0x60,0xaf,0x73,0xee,0x30,0x00,
+0x00,0xd4,0x04,0x30,0x00,0x2d,0xf5,0x22,0x00,0x30,0xdf,0x80,0x00,0x56,0x03,0xb4,
+0x00,0x0e,0xd4,0x00,0x00,0x00,0x07,0xf6,0x00,0x00,0x03,0x66,0x07,0x08,0x01,0x00,
+0xf2,0x01,0xe5,0x7c,0xdd,0xde,0xfe,0x20,0x00,0x0f,0x65,0x99,0x98,0x8c,0xf3,0x00,
+0x00,0xf6,0xd5,0x01,0x20,0x0f,0x60,0x86,0x01,0xb0,0x01,0x11,0xf6,0x00,0x00,0x04,
+0xf5,0x0d,0xff,0xff,0x60,0x16,0x00,0xd0,0x35,0x55,0xf6,0x00,0x00,0x1f,0x90,0x00,
+0x00,0x0f,0x70,0x00,0x07,0x63,0x00,0x51,0xf7,0x00,0x00,0xef,0xc0,0x0f,0x00,0xf1,
+0x0f,0x8f,0xaf,0x30,0x8a,0xaa,0xf7,0x00,0x1f,0x91,0xfa,0x09,0xbb,0xbf,0x70,0x0a,
+0xe1,0x08,0xf2,0x00,0x00,0xe7,0x05,0xf6,0x00,0x1e,0x90,0x00,0x0e,0x71,0xea,0xfd,
+0x02,0x10,0xe7,0x3d,0x05,0x40,0xd7,0x00,0x0e,0x73,0xe2,0x00,0x32,0x10,0x00,0xe7,
+0x7f,0x00,0x13,0x0f,0x91,0x06,0x13,0xf6,0x0f,0x00,0x12,0x60,0x08,0x00,0x81,0x92,
+0x00,0x00,0xbe,0xee,0xee,0xef,0xfd,0x52,0x07,0x53,0x77,0x66,0x66,0xaf,0xa0,0xaf,
+0x00,0x23,0x2f,0xe1,0x09,0x00,0x24,0x1d,0xf4,0x09,0x00,0x14,0xf6,0x09,0x00,0x04,
+0x13,0x01,0x32,0x4e,0xfa,0xfd,0x2f,0x01,0x50,0x8f,0xe4,0x04,0xef,0x50,0x42,0x00,
+0xa0,0xef,0xa1,0x00,0x01,0xaf,0xa1,0x00,0x00,0x05,0xfb,0x23,0x01,0x21,0x5e,0xc0,
+0xd6,0x01,0x14,0x3e,0xdc,0x01,0x14,0x06,0xeb,0x01,0x06,0x67,0x01,0x25,0x06,0xf1,
+0x13,0x00,0x20,0x10,0x00,0x20,0x05,0x00,0xfe,0x04,0xf1,0x06,0xee,0xee,0xee,0xe0,
+0x38,0x88,0x87,0x77,0x77,0x78,0x88,0x88,0x86,0x00,0x00,0x00,0x56,0x66,0x66,0x77,
+0x76,0x84,0x01,0x54,0xee,0xee,0xed,0xff,0xf2,0x31,0x00,0x13,0xe4,0xa2,0x01,0x22,
+0xcf,0xc2,0x09,0x00,0x23,0x07,0xff,0xa2,0x00,0x50,0x6e,0xfa,0x5c,0xfd,0x40,0xd3,
+0x05,0xf2,0x00,0xef,0xa2,0x00,0x05,0xdf,0xc4,0x00,0x00,0x03,0xc7,0x10,0x07,0xd0,
+0x00,0x49,0x03,0x01,0x29,0x9f,0x00,0x54,0x08,0xfe,0x05,0x27,0x77,0x77,0x88,0xcf,
+0x77,0x77,0x77,0x75,0x06,0xff,0xfe,0xee,0xee,0xee,0xff,0xff,0xff,0xd0,0x00,0x01,
+0x00,0x02,0xba,0x05,0x10,0xff,0x15,0x01,0x74,0x38,0x88,0x88,0x88,0x87,0xbf,0x30,
+0xc1,0x00,0x15,0xf3,0xc1,0x00,0x0e,0x13,0x00,0x06,0xe7,0x00,0x05,0xfa,0x00,0x10,
+0x15,0x05,0x00,0x50,0x45,0x55,0x55,0x66,0x66,0x09,0x00,0x63,0xef,0xff,0xff,0xef,
+0xff,0x20,0x4e,0x01,0x13,0xf5,0x97,0x00,0x22,0xfd,0x30,0xe1,0x08,0x22,0xef,0xf5,
+0x08,0x00,0x40,0xdf,0xb6,0xdf,0xb2,0x44,0x00,0xf6,0x00,0xdf,0xc4,0x00,0x06,0xef,
+0xa3,0x00,0x00,0x4e,0x92,0x00,0x47,0x00,0x06,0xc9,0x40,0x04,0x12,0x00,0xec,0x08,
+0x00,0xd6,0x09,0x92,0x11,0x11,0x9f,0x11,0x11,0x11,0x10,0x6f,0xff,0x01,0x00,0x40,
+0xfe,0x16,0x66,0x65,0xd7,0x04,0x27,0x66,0x63,0xcb,0x00,0x13,0x50,0x08,0x00,0x24,
+0x03,0xf5,0x35,0x04,0x0e,0x09,0x00,0x14,0xf4,0x09,0x00,0xb2,0xfa,0x66,0x66,0x66,
+0x66,0x74,0x00,0x00,0x01,0xef,0xff,0xba,0x08,0x06,0x01,0x00,0x05,0x97,0x01,0x44,
+0xde,0xee,0xee,0xdf,0xc6,0x00,0x13,0x7f,0x7f,0x07,0x22,0x4d,0xfa,0x25,0x02,0x22,
+0x2a,0xff,0x09,0x00,0xf0,0x04,0x3a,0xfe,0x61,0x8f,0xf9,0x10,0x00,0x00,0x2c,0xfd,
+0x60,0x24,0x01,0x8e,0xf7,0x00,0x00,0x27,0x30,0xb4,0x00,0x16,0x54,0xbd,0x00,0x05,
+0x09,0x00,0x12,0x5f,0xbb,0x00,0x82,0xee,0xec,0x27,0x77,0x76,0x66,0x66,0x77,0x04,
+0x02,0x15,0x00,0xe2,0x04,0x23,0x66,0x53,0xee,0x01,0x31,0xfe,0xff,0xe4,0x34,0x00,
+0x40,0xa2,0x00,0x04,0xdf,0xef,0x01,0x10,0xfb,0x78,0x09,0x12,0xb0,0xe9,0x09,0x33,
+0x00,0x0a,0xd0,0x21,0x08,0x20,0x0c,0xd0,0x33,0x04,0x40,0x30,0x00,0x00,0x7f,0x37,
+0x08,0x51,0x3e,0xfb,0x87,0x9d,0xfb,0x2b,0x01,0x45,0x7b,0xcd,0xb9,0x40,0x55,0x00,
+0x15,0x40,0xa5,0x09,0x10,0xf6,0x81,0x09,0x00,0x30,0x06,0x01,0x0a,0x00,0x44,0x67,
+0x77,0x77,0xfd,0x34,0x03,0x24,0x07,0xf6,0x0a,0x00,0x24,0x1f,0xc0,0x0a,0x00,0x21,
+0xcf,0x20,0x9d,0x03,0x00,0xb7,0x07,0x04,0x0a,0x00,0x32,0x8f,0xae,0xd0,0x0a,0x00,
+0xc0,0x07,0xf9,0x04,0xfa,0x00,0x00,0xfb,0x88,0x81,0x00,0x8f,0x90,0x9c,0x07,0x90,
+0xff,0xff,0xe3,0x08,0xf7,0x00,0x00,0x08,0xf2,0x1e,0x00,0x62,0x05,0x40,0x03,0xb0,
+0x00,0x40,0x32,0x00,0x01,0x84,0x04,0x0f,0x0a,0x00,0x08,0x71,0x12,0x46,0x50,0xf7,
+0x00,0x00,0x3f,0x15,0x01,0x10,0x80,0x3c,0x00,0x43,0x66,0x66,0x55,0x43,0x1e,0x00,
+0x01,0x01,0x00,0x0f,0x0a,0x00,0x01,0x3b,0xe5,0x00,0x00,0xac,0x01,0x21,0x67,0x75,
+0xd8,0x03,0x44,0xff,0xff,0xfe,0xff,0x75,0x08,0x24,0x0a,0xf4,0x09,0x00,0x04,0x39,
+0x00,0x14,0x1c,0xe5,0x03,0x33,0x3e,0xff,0x60,0x93,0x01,0x31,0xc5,0xcf,0xa1,0xc3,
+0x02,0x50,0xef,0x70,0x00,0x7f,0xe6,0xff,0x03,0xa1,0xfa,0x20,0x00,0x00,0x1a,0xf9,
+0x00,0x00,0x01,0x72,0x7f,0x03,0x1f,0x30,0x2f,0x03,0x01,0xf5,0x04,0x6e,0xed,0xdd,
+0xdd,0xde,0xee,0xef,0xff,0xfe,0x02,0x88,0x88,0x88,0x8b,0xf8,0x77,0x76,0x66,0x40,
+0xe5,0x03,0x0e,0xf8,0x03,0x0f,0x13,0x00,0x0f,0x13,0x4d,0x08,0x00,0x0f,0x3a,0x03,
+0x0b,0x1a,0xfe,0x3a,0x03,0x71,0x04,0xcf,0xc7,0xef,0xa2,0x00,0x00,0x04,0x04,0x10,
+0x07,0x0a,0x00,0x20,0x4f,0x93,0x55,0x00,0x1e,0xc9,0xb0,0x00,0x00,0x06,0x04,0x10,
+0x77,0x70,0x04,0x32,0x86,0x5e,0xee,0x3a,0x03,0x11,0xfc,0x26,0x05,0x04,0x64,0x0c,
+0x02,0x09,0x00,0x23,0x03,0xe2,0x09,0x00,0x22,0x05,0xf3,0x09,0x00,0x00,0xeb,0x03,
+0x29,0x0b,0x40,0xf4,0x03,0x06,0x09,0x00,0xa3,0xf9,0x66,0x66,0x66,0x67,0x73,0x00,
+0x00,0x03,0xff,0x49,0x09,0x0f,0x3a,0x03,0x0c,0x04,0xd0,0x04,0x32,0x2c,0xfc,0x20,
+0x73,0x0b,0x12,0xff,0x95,0x01,0xf0,0x04,0x17,0xef,0x94,0xbf,0xd5,0x00,0x00,0x00,
+0x19,0xff,0x92,0x00,0x04,0xcf,0xd4,0x00,0x00,0x3b,0x61,0x8c,0x00,0x16,0x97,0x4f,
+0x00,0x13,0x17,0xbd,0x00,0x50,0x87,0x5f,0xff,0xfe,0xee,0x3e,0x05,0x11,0xfc,0x8a,
+0x03,0x04,0x1f,0x00,0x05,0x09,0x00,0x22,0x9f,0x31,0xf8,0x03,0x40,0xbf,0xff,0xff,
+0xc4,0x09,0x00,0x50,0x4f,0xc4,0x00,0x05,0xcf,0x0e,0x04,0x10,0xdd,0x5c,0x05,0x13,
+0xd0,0xff,0x0b,0x23,0x08,0xf0,0x28,0x0c,0x20,0x0a,0xf0,0x08,0x07,0x40,0x40,0x00,
+0x00,0x5f,0x15,0x06,0x51,0x1e,0xfb,0x87,0x8c,0xfd,0x99,0x01,0x5f,0x7a,0xcd,0xca,
+0x50,0x00,0x97,0x05,0x06,0x23,0x7f,0xe4,0x5e,0x04,0x22,0xcf,0xc1,0x09,0x00,0x13,
+0x18,0xc8,0x00,0x61,0x01,0x7f,0xf9,0x4b,0xfd,0x50,0xc9,0x00,0x12,0x91,0xc9,0x00,
+0x30,0x03,0xb6,0x10,0x50,0x05,0x1f,0x60,0x41,0x02,0x01,0x04,0xc2,0x04,0x60,0xfd,
+0x02,0x77,0x77,0x66,0x66,0xde,0x00,0x1f,0x60,0x97,0x05,0x4e,0x01,0x40,0x05,0x00,
+0xd3,0x02,0x01,0x7a,0x00,0x00,0x2e,0x06,0x72,0x34,0x44,0x43,0x4c,0xfc,0x10,0x00,
+0x00,0x03,0x13,0x80,0x08,0x00,0x02,0x35,0x03,0xf0,0x04,0x29,0xff,0xb7,0xef,0xa4,
+0x00,0x00,0x00,0x5c,0xfe,0x82,0x00,0x05,0xcf,0xd6,0x00,0x00,0xa9,0x40,0x3b,0x00,
+0x17,0x78,0xaa,0x04,0x11,0x44,0x01,0x00,0x43,0x33,0x32,0x7f,0xff,0x54,0x02,0x97,
+0x02,0x22,0x21,0x11,0x11,0x22,0x23,0x33,0x31,0x9d,0x0c,0x10,0x66,0xde,0x00,0x10,
+0x60,0x42,0x04,0x00,0x01,0x00,0x21,0xf1,0x00,0xb5,0x07,0x02,0x00,0x04,0x04,0x09,
+0x04,0x73,0x01,0x66,0x77,0x77,0x77,0x7b,0xf1,0x24,0x00,0x54,0xfe,0xc0,0x00,0x00,
+0x09,0x1f,0x00,0x02,0x09,0x00,0x10,0x10,0x2e,0x02,0x21,0xee,0xee,0xe7,0x0a,0x80,
+0x01,0x67,0x88,0x88,0x87,0x77,0x62,0x00,0xf1,0x03,0x00,0x00,0x56,0x66,0x66,0x77,
+0x76,0x00,0x00,0x00,0x00,0xde,0xee,0xee,0xde,0xff,0x20,0x00,0x01,0x00,0x22,0x6f,
+0xe4,0x08,0x00,0x22,0x2c,0xfc,0x11,0x00,0x31,0x18,0xff,0xf7,0x08,0x00,0xf5,0x0a,
+0x17,0xef,0x93,0xbf,0xe6,0x00,0x00,0x00,0x19,0xff,0x91,0x00,0x03,0xbf,0xe5,0x00,
+0x00,0x3a,0x61,0x00,0x00,0x00,0x02,0x86,0x00,0x01,0x00,0x20,0x03,0x33,0x01,0x00,
+0x52,0x22,0x22,0x21,0x6f,0xff,0x01,0x00,0x12,0xfe,0x12,0x00,0x57,0x44,0x44,0x42,
+0x00,0x00,0x27,0x00,0x21,0x66,0x53,0x08,0x00,0x50,0x07,0xff,0xfe,0xff,0xe5,0x09,
+0x00,0xf0,0x03,0x7f,0xa3,0x00,0x04,0xdf,0x40,0x00,0x00,0x00,0xfb,0x00,0x00,0x00,
+0x0e,0xb0,0x00,0x00,0x02,0x72,0x00,0xf0,0x0d,0x0a,0xe0,0x00,0x00,0x01,0xf8,0x00,
+0x00,0x00,0x0c,0xd0,0x00,0x00,0x00,0xcf,0x30,0x00,0x00,0x6f,0x80,0x00,0x00,0x00,
+0x2e,0xfb,0x87,0x9d,0xfb,0x36,0x00,0x6b,0x01,0x7b,0xcd,0xc9,0x40,0x00,0x01,0x00,
+0xf2,0x1f,0xe8,0x3c,0xcc,0xcd,0xee,0x30,0x00,0x0e,0x92,0x9a,0x99,0x9b,0xf4,0x00,
+0x00,0xe9,0x00,0x00,0x00,0x8f,0x00,0x00,0x0e,0xa0,0x00,0x00,0x0d,0xc0,0x00,0x00,
+0xda,0x00,0x00,0x01,0xf7,0x00,0x00,0x0d,0xa0,0x00,0x00,0x8f,0x10,0x00,0x00,0xdb,
+0x6e,0x00,0x61,0x0d,0xb0,0x00,0x06,0xf7,0x00,0x0f,0x00,0x21,0xdf,0xd0,0x0f,0x00,
+0x30,0x7f,0x9f,0x50,0x2d,0x00,0x30,0x1e,0xa0,0xdd,0x2d,0x00,0xf2,0x0f,0x09,0xf1,
+0x04,0xf6,0x00,0x00,0xda,0x04,0xf6,0x00,0x0b,0xe1,0x00,0x0d,0xa1,0xea,0x00,0x00,
+0x2f,0x90,0x00,0xda,0x8d,0x00,0x00,0x00,0x5d,0x00,0x0d,0xa1,0x78,0x00,0x12,0xda,
+0x07,0x00,0x22,0x0d,0xb0,0x08,0x00,0x1a,0xdb,0x0f,0x00,0x16,0x97,0xa1,0x00,0xf0,
+0x07,0x01,0x12,0x20,0x00,0x00,0xd9,0x05,0xff,0xff,0xff,0xf8,0x00,0x00,0xea,0x01,
+0x54,0x44,0x38,0xf7,0x00,0x00,0xeb,0x2c,0x00,0x12,0xe0,0x08,0x00,0x21,0x5f,0x70,
+0x08,0x00,0x22,0x01,0xed,0x47,0x00,0x22,0x0b,0xf8,0x08,0x00,0x30,0x8f,0xdf,0x30,
+0x08,0x00,0x40,0x06,0xfa,0x0d,0xe1,0x08,0x00,0xf2,0x09,0x6f,0xb0,0x02,0xec,0x00,
+0x00,0xeb,0x07,0xfa,0x00,0x00,0x3f,0xa0,0x00,0xea,0x0f,0x80,0x00,0x00,0x04,0x90,
+0x00,0xea,0x01,0x65,0x00,0x16,0xc8,0x70,0x00,0xe3,0x9b,0xbb,0xbb,0xcc,0xcc,0xb2,
+0x00,0x00,0xbb,0xbb,0xbb,0xba,0xab,0xf8,0x15,0x00,0x0f,0x08,0x00,0x0d,0x13,0xf7,
+0x08,0x00,0x1a,0x93,0x5d,0x01,0xf0,0x03,0x08,0xd0,0x0b,0xcd,0xdd,0xee,0xb0,0x00,
+0x09,0xf0,0x07,0x87,0x77,0x7f,0xc0,0x00,0x09,0xf0,0x2f,0x02,0x40,0x60,0x00,0x08,
+0xf0,0x43,0x02,0x11,0x00,0x08,0x00,0x22,0x08,0xf5,0x08,0x00,0x21,0x3f,0xd0,0x08,
+0x00,0x31,0x01,0xef,0xf4,0x08,0x00,0x40,0x0c,0xf3,0xce,0x10,0x08,0x00,0xf1,0x09,
+0xbf,0x40,0x2e,0xc0,0x00,0x08,0xf0,0x1c,0xf5,0x00,0x04,0xf9,0x00,0x08,0xe0,0xae,
+0x30,0x00,0x00,0x5f,0x20,0x08,0xe0,0x32,0x60,0x00,0x35,0x09,0xe0,0x00,0x08,0x00,
+0x13,0xb5,0x08,0x00,0x6d,0xf9,0x00,0x00,0x00,0x05,0x80,0xa3,0x00,0x14,0x01,0x08,
+0x00,0x90,0xfb,0x65,0x55,0x66,0x67,0x82,0x00,0x00,0xdf,0x70,0x02,0x1b,0xe4,0x0e,
+0x02,0xe0,0x22,0x00,0x33,0x44,0x45,0x51,0x00,0x00,0xdb,0x06,0xff,0xff,0xff,0xf9,
+0x38,0x01,0x70,0x21,0x11,0x07,0xf5,0x00,0x00,0xcb,0x68,0x02,0x12,0xd0,0x08,0x00,
+0xa1,0x8f,0x50,0x00,0x00,0xcc,0x00,0x00,0x04,0xfb,0x00,0x08,0x00,0x21,0x2e,0xfc,
+0x08,0x00,0x40,0x01,0xdf,0x7f,0x90,0x08,0x00,0xf0,0x09,0x1c,0xf4,0x07,0xf6,0x00,
+0x00,0xcc,0x01,0xdf,0x50,0x00,0x9f,0x40,0x00,0xcb,0x0d,0xe3,0x00,0x00,0x0b,0xd0,
+0x00,0xdb,0x08,0x1b,0x03,0x35,0x20,0x00,0xda,0x68,0x00,0xb2,0x00,0x26,0x66,0x66,
+0x67,0x77,0x71,0x00,0x00,0x8f,0xff,0x6b,0x00,0x10,0x9f,0x18,0x00,0x1f,0xe9,0x08,
+0x00,0x08,0x80,0x32,0x22,0x22,0x33,0xf9,0x00,0x00,0x5f,0x30,0x00,0x84,0xf6,0x00,
+0x00,0x01,0x22,0x22,0x22,0x21,0xb8,0x00,0x14,0x42,0xb8,0x00,0x00,0x28,0x02,0x40,
+0xfa,0x00,0x00,0xdc,0xb8,0x00,0x10,0xf6,0x08,0x00,0x02,0xb8,0x00,0x2e,0xcc,0x00,
+0xb8,0x00,0x13,0xfd,0xb8,0x00,0x20,0x6f,0xa0,0x08,0x00,0x20,0x1d,0xf3,0xd3,0x02,
+0x40,0xcb,0x01,0xdf,0x40,0x29,0x00,0x31,0xdb,0x0d,0xe3,0x50,0x03,0xc0,0xdb,0x07,
+0x10,0x00,0x00,0x00,0x10,0x00,0x64,0x00,0x00,0x13,0x68,0x00,0x43,0x21,0x00,0x00,
+0x8e,0x30,0x02,0x10,0x9e,0x08,0x00,0xc3,0xc9,0x00,0x00,0x9e,0x21,0x11,0x11,0x12,
+0xd9,0x00,0x00,0x9f,0xc8,0x00,0x63,0x9e,0x66,0x66,0x65,0x55,0xe9,0x20,0x00,0x07,
+0x08,0x00,0x13,0x8f,0xb8,0x00,0x54,0x14,0x55,0x55,0x55,0x55,0x87,0x03,0x36,0x62,
+0x00,0x00,0xa7,0x01,0x60,0x1d,0xef,0xf8,0x5e,0xff,0xf2,0x0a,0x00,0x61,0x06,0x77,
+0xf9,0x27,0x7b,0xf2,0xcb,0x01,0x20,0x01,0xf6,0x36,0x02,0x00,0x0a,0x00,0x51,0x04,
+0xf4,0x00,0x0b,0xc0,0xa1,0x03,0x50,0x07,0xf1,0x00,0x0e,0x90,0x0a,0x00,0x00,0x5b,
+0x01,0xc0,0x2f,0x60,0x00,0xea,0x00,0x00,0x00,0x0f,0xa0,0x00,0x6f,0x20,0x0a,0x00,
+0x00,0xdf,0x02,0xf1,0x06,0xaf,0x20,0x00,0xef,0xff,0xf3,0x00,0x8f,0xf0,0x00,0xff,
+0x70,0x00,0xec,0x77,0x60,0x00,0xde,0xf5,0x04,0xfe,0x3c,0x00,0x60,0x03,0xf6,0xda,
+0x09,0xe6,0xf2,0x0a,0x00,0xf0,0x01,0x09,0xf0,0x7f,0x2e,0x80,0xf8,0x00,0xd9,0x00,
+0x00,0x0f,0x90,0x1f,0xcf,0x20,0x9e,0x0a,0x00,0xf0,0x03,0x6f,0x20,0x0a,0xfb,0x00,
+0x2f,0x60,0xd9,0x00,0x00,0xba,0x00,0x03,0xe3,0x00,0x0a,0x80,0xd9,0xfd,0x00,0x01,
+0x01,0x00,0x15,0xd9,0xaa,0x00,0x1f,0xda,0x0a,0x00,0x0a,0x16,0xa7,0x4d,0x02,0x03,
+0xe5,0x00,0xf0,0x14,0xd7,0x04,0xf2,0x08,0xcd,0xc2,0xbc,0xca,0x00,0xe8,0x04,0xf2,
+0x07,0xab,0xf5,0x9a,0xdf,0x00,0xe7,0x04,0xf2,0x00,0x04,0xf2,0x00,0xad,0x00,0xf7,
+0x04,0xf2,0x00,0x06,0xf0,0x00,0xca,0x09,0x00,0x00,0xbd,0x02,0x11,0xe8,0x09,0x00,
+0x41,0x0c,0xb0,0x02,0xf5,0x09,0x00,0xf1,0x07,0x0f,0x70,0x05,0xf2,0x00,0xfa,0x68,
+0xf2,0x00,0x3f,0x60,0x08,0xf2,0x00,0xff,0xff,0xf2,0x00,0x7f,0xa0,0x0c,0xf7,0x3f,
+0x00,0x41,0xcf,0xf0,0x1f,0xfc,0x09,0x00,0xf0,0x22,0xf9,0xf4,0x5f,0x7f,0x10,0xe7,
+0x04,0xf2,0x05,0xf1,0xd9,0xac,0x1f,0x60,0xe7,0x04,0xf2,0x0a,0xc0,0x8e,0xe7,0x0b,
+0xb0,0xe7,0x04,0xf2,0x0f,0x60,0x2f,0xf1,0x05,0xf1,0xe7,0x04,0xf2,0x5f,0x00,0x0c,
+0xb0,0x00,0xe3,0xe8,0x04,0xf2,0x13,0x00,0x01,0x00,0x00,0x87,0x00,0x03,0xfb,0x04,
+0x0f,0x09,0x00,0x07,0x34,0x83,0x03,0xf1,0xc6,0x00,0x1b,0x10,0x09,0x00,0xf1,0x0b,
+0xd6,0x04,0xf3,0x0a,0xff,0xf6,0xff,0xfb,0x00,0xf8,0x04,0xf3,0x02,0x68,0xf4,0x56,
+0xea,0x00,0xe8,0x04,0xf3,0x00,0x06,0xf1,0x00,0xf7,0x09,0x00,0xf2,0x38,0x0a,0xd0,
+0x03,0xf3,0x00,0xe8,0x03,0xf3,0x00,0x0e,0x90,0x08,0xf0,0x00,0xdf,0xef,0xf3,0x00,
+0x3f,0xa0,0x0d,0xf4,0x00,0xdc,0x79,0xf3,0x00,0xaf,0xe0,0x3f,0xea,0x00,0xd9,0x03,
+0xf3,0x01,0xf8,0xf4,0xad,0x5f,0x10,0xd9,0x03,0xf3,0x08,0xe0,0xab,0xf6,0x0d,0x80,
+0xd9,0x03,0xf3,0x0f,0x70,0x3f,0xd0,0x05,0xf0,0xe9,0x04,0xf3,0x1c,0x00,0x0a,0x40,
+0x00,0x50,0xd8,0x04,0xf3,0x6c,0x00,0x33,0x30,0x01,0x70,0x7d,0x00,0x10,0x11,0xed,
+0x01,0x01,0x23,0x06,0xb3,0xc0,0x00,0x00,0x04,0x76,0x66,0x66,0x65,0x5c,0xf0,0x00,
+0xfd,0x03,0x0f,0x09,0x00,0x11,0x03,0x29,0x04,0x01,0x1a,0x04,0x04,0x01,0x00,0xf0,
+0x01,0x4f,0xff,0xff,0x67,0xff,0xff,0xb0,0x00,0x00,0x04,0x44,0xaf,0x31,0x44,0x8f,
+0x70,0x6e,0x02,0x50,0xfa,0x00,0x00,0xdd,0x00,0x6c,0x00,0x41,0xf2,0x00,0x09,0xf3,
+0x6b,0x06,0x40,0xfa,0x00,0x6f,0xfa,0x39,0x00,0xf1,0x09,0xf7,0x4f,0x84,0xf8,0x5f,
+0xa0,0x00,0x00,0x5f,0x80,0x05,0xff,0x80,0x04,0xfa,0x00,0x00,0x76,0x00,0x00,0xbd,
+0x00,0x00,0x26,0x4b,0x00,0x14,0xbd,0x54,0x00,0x01,0x09,0x00,0x14,0x5f,0xce,0x06,
+0x22,0x28,0x77,0x01,0x00,0x2e,0x75,0x00,0x01,0x00,0xf3,0x01,0x07,0xee,0xee,0xee,
+0xee,0xff,0xe1,0x00,0x00,0x03,0x88,0x88,0x88,0x87,0x7b,0xf3,0x17,0x00,0x1f,0x06,
+0x09,0x00,0x08,0x1c,0xf2,0x09,0x00,0x24,0x01,0x50,0x4e,0x00,0xf0,0x0c,0x04,0x00,
+0x14,0x45,0x11,0x44,0x52,0x00,0x06,0xf0,0x0a,0xff,0xfa,0x8f,0xff,0xb0,0x00,0x7f,
+0x00,0x00,0x1f,0x80,0x00,0xe9,0x00,0x07,0xf0,0x39,0x03,0x20,0x3f,0x50,0x11,0x00,
+0x40,0xaf,0x00,0x08,0xf0,0x11,0x00,0xd0,0x0e,0xf0,0x00,0xdf,0x20,0x00,0x7f,0x00,
+0x04,0xff,0x50,0x3f,0xf8,0x11,0x00,0xf3,0x1a,0xbd,0xdb,0x0a,0xda,0xe0,0x00,0x7f,
+0x00,0x2f,0x56,0xf4,0xf6,0x3f,0x50,0x07,0xf0,0x0b,0xc0,0x0e,0xfd,0x00,0xcb,0x00,
+0x7f,0x03,0xf3,0x00,0x7f,0x40,0x04,0xf0,0x07,0xf0,0x15,0x00,0x00,0x30,0x00,0x01,
+0x00,0x7f,0x6e,0x00,0x22,0x02,0x60,0x80,0x04,0x51,0x22,0x20,0x00,0x00,0x08,0xeb,
+0x00,0x94,0xd0,0x00,0x00,0x15,0x44,0x44,0x44,0x43,0xbf,0xfa,0x05,0x04,0x7a,0x01,
+0x1e,0x8f,0x11,0x00,0x0b,0x93,0x01,0x14,0x24,0x55,0x00,0x00,0x15,0x00,0x32,0xa7,
+0x66,0x40,0x4e,0x06,0x64,0x6b,0xde,0xed,0x00,0x00,0x0f,0xae,0x01,0x00,0x01,0x04,
+0xf0,0x00,0x06,0x66,0x77,0x89,0x81,0x00,0x0f,0x90,0x00,0x02,0xef,0xff,0xfe,0xff,
+0x40,0x00,0x04,0x00,0xf5,0x07,0x10,0xf0,0x0c,0x04,0x03,0xbb,0x01,0x12,0xea,0x62,
+0x00,0x11,0x30,0xc0,0x07,0x70,0x00,0x00,0x1f,0xa0,0x00,0x00,0xec,0x4b,0x08,0xf2,
+0x07,0x0a,0xf2,0x00,0x00,0x0e,0xff,0xff,0xa0,0x00,0x04,0xff,0x60,0x00,0x00,0xea,
+0x22,0x20,0x00,0x01,0xec,0xcd,0x00,0x39,0x00,0x32,0xce,0x23,0xf7,0xde,0x03,0x71,
+0x9f,0x40,0x09,0xf2,0x00,0x0d,0x90,0xa1,0x06,0x20,0x1e,0xb0,0x13,0x00,0x81,0x3f,
+0x80,0x00,0x00,0x4f,0x40,0x0d,0x90,0xf0,0x00,0x26,0x00,0x41,0xe6,0x03,0x2d,0x0d,
+0xa0,0xf9,0x03,0x06,0x13,0x00,0x19,0xc9,0xe7,0x01,0x40,0x28,0x64,0x33,0x00,0x3d,
+0x01,0x84,0x00,0x00,0x2b,0xef,0xff,0x20,0x00,0x06,0x07,0x01,0x00,0xc5,0x04,0x61,
+0x00,0x01,0x56,0x66,0x77,0x71,0x0a,0x00,0x51,0x07,0xff,0xff,0xef,0xf8,0x0a,0x00,
+0x11,0x00,0xaf,0x00,0x02,0x0a,0x00,0x00,0xc1,0x08,0xb1,0x07,0xf8,0x77,0x60,0x00,
+0x00,0x03,0xfc,0x00,0x00,0x06,0x67,0x01,0x60,0x2e,0xfd,0x10,0x00,0x06,0xf1,0x30,
+0x01,0x32,0xde,0x6f,0xc1,0x0a,0x00,0x50,0x2e,0xe2,0x03,0xfc,0x10,0x0a,0x00,0x60,
+0x04,0xfd,0x20,0x00,0x3e,0xc0,0x0a,0x00,0x75,0x0e,0xa1,0x00,0x00,0x01,0x60,0x05,
+0x6e,0x00,0x01,0x82,0x00,0x61,0x00,0x34,0x44,0x44,0x55,0x56,0x0a,0x00,0x01,0xb5,
+0x01,0x11,0xf1,0x5a,0x01,0x54,0x11,0x11,0x11,0x17,0xf1,0x2a,0x07,0x24,0x06,0xf1,
+0x2c,0x07,0x0c,0x0a,0x00,0x51,0xfa,0x22,0x22,0x22,0x39,0x28,0x00,0x12,0xdf,0xf1,
+0x01,0x00,0x83,0x00,0x40,0x22,0x22,0x22,0x11,0x09,0x00,0xd3,0x38,0x64,0x43,0x00,
+0x00,0x02,0x40,0x00,0x00,0x04,0xcf,0xff,0xf0,0xf4,0x05,0x04,0x81,0x03,0x50,0x48,
+0x88,0x99,0xa9,0x10,0xc7,0x06,0x54,0x08,0xdd,0xdc,0xce,0xf5,0x09,0x02,0x13,0xdd,
+0x0a,0x02,0x00,0x26,0x07,0x11,0x08,0xd6,0x03,0xc2,0x6f,0x90,0x00,0x00,0x8f,0x77,
+0x63,0x00,0x00,0x5f,0xfd,0x10,0x26,0x00,0x32,0x5f,0xc5,0xfc,0x26,0x00,0x50,0x6f,
+0xc0,0x04,0xfc,0x10,0x13,0x00,0x50,0x9f,0xa0,0x00,0x03,0xeb,0x83,0x06,0x10,0x2e,
+0x82,0x02,0x39,0x40,0x08,0xd0,0x6c,0x01,0x61,0x01,0xe3,0x00,0x00,0xd6,0x00,0x82,
+0x03,0x41,0x40,0x00,0x2f,0x70,0x77,0x02,0x41,0xf1,0x00,0x05,0xf4,0x13,0x00,0x51,
+0xef,0x20,0x00,0xaf,0x60,0x1c,0x00,0x50,0xfd,0x00,0x2f,0xff,0x40,0x19,0x07,0x40,
+0xc4,0xfa,0x0a,0xe2,0x26,0x09,0x80,0x09,0xf2,0x05,0xfb,0xf5,0x01,0xde,0x30,0x2b,
+0x00,0x51,0x07,0xf8,0x00,0x01,0xcc,0x95,0x02,0x12,0x05,0xf4,0x04,0x10,0x38,0xc1,
+0x01,0x15,0x01,0xdb,0x00,0x27,0x8f,0x00,0xd1,0x02,0x50,0x25,0x66,0x67,0x77,0x10,
+0x13,0x00,0x45,0x0a,0xff,0xfe,0xef,0xdb,0x00,0x62,0xce,0x00,0x00,0x8f,0x11,0x10,
+0x72,0x07,0x02,0xdb,0x00,0x10,0x5f,0xdb,0x00,0x54,0x55,0x52,0x00,0x00,0x4f,0xdb,
+0x00,0x14,0x4f,0xdb,0x00,0x41,0x5f,0xc1,0x04,0xfc,0x13,0x00,0x50,0x8f,0xb0,0x00,
+0x04,0xeb,0x13,0x00,0x20,0x1e,0x70,0x70,0x00,0x28,0x07,0xe0,0xdb,0x00,0x00,0x79,
+0x0b,0x20,0x66,0x66,0x54,0x00,0x64,0x2f,0xff,0xff,0xff,0xef,0xf9,0x09,0x04,0x23,
+0xfd,0x10,0x68,0x01,0x13,0xfc,0x09,0x00,0x24,0x2d,0xf9,0x67,0x03,0x22,0xff,0xd3,
+0x67,0x02,0x40,0xef,0x81,0x6e,0xf9,0x1d,0x00,0xa1,0x7e,0xf9,0x20,0x00,0x07,0xef,
+0x80,0x00,0x00,0x07,0x06,0x01,0x15,0x6a,0x5b,0x00,0xf3,0x01,0x14,0x00,0x1d,0xb9,
+0x84,0x00,0x06,0xd0,0x07,0xf0,0x00,0x69,0xbb,0x60,0x00,0x8e,0xe6,0x03,0x81,0x08,
+0xe0,0x07,0xf0,0x0b,0xcc,0xcd,0xe6,0x11,0x00,0x80,0x9a,0xaa,0xaf,0xa0,0x09,0xe0,
+0x07,0xf0,0x41,0x07,0x21,0x00,0x9e,0x22,0x00,0x21,0x8f,0x10,0x11,0x00,0x00,0x27,
+0x0b,0xa0,0x9f,0x55,0xaf,0x00,0x00,0x04,0xf5,0x00,0x09,0xff,0x22,0x01,0x22,0xcf,
+0x10,0x44,0x00,0x21,0x4f,0xf7,0x44,0x00,0x41,0x00,0x0d,0xdc,0xd0,0x11,0x00,0x40,
+0x07,0xf4,0x4f,0x40,0x11,0x00,0x41,0x02,0xfa,0x00,0xcc,0x11,0x00,0x40,0xce,0x10,
+0x03,0xf4,0x11,0x00,0xf3,0x02,0x7f,0x40,0x00,0x0a,0xc0,0x8f,0x00,0x7f,0x06,0x50,
+0x00,0x00,0x16,0x08,0xf0,0x07,0xf0,0x28,0x04,0x03,0x88,0x00,0x0c,0x11,0x00,0x24,
+0x04,0x90,0x45,0x03,0x00,0xcf,0x06,0x11,0x18,0x60,0x03,0x60,0x13,0x00,0x01,0xbe,
+0xff,0xf4,0xb5,0x00,0x05,0x66,0x04,0xd3,0x15,0x56,0x66,0x77,0x40,0x00,0x08,0xf0,
+0x05,0xff,0xff,0xee,0xfe,0xb8,0x01,0x22,0x5f,0x70,0x7e,0x01,0x22,0x2f,0xd0,0x11,
+0x00,0x31,0x1d,0xf2,0x04,0xb3,0x00,0xc0,0x1d,0xff,0x30,0x06,0x66,0xbf,0x00,0x00,
+0x2d,0xf5,0xde,0x10,0x44,0x00,0x41,0x4e,0xe3,0x02,0xed,0xc6,0x00,0x70,0xc1,0x00,
+0x02,0xeb,0x00,0x09,0xe0,0x93,0x01,0x49,0x02,0x80,0x00,0x9e,0xbb,0x04,0x42,0x02,
+0xd2,0x00,0x8d,0x6c,0x00,0x03,0x08,0x0d,0x23,0x0e,0xf0,0x1f,0x00,0x22,0xff,0xc0,
+0x9e,0x01,0x32,0xfb,0x6f,0xd1,0x08,0x00,0x30,0x00,0x4f,0xe3,0x18,0x00,0x10,0xfb,
+0x62,0x00,0x31,0x00,0x00,0x0c,0xad,0x0c,0x13,0xf5,0xfe,0x08,0x25,0x04,0x30,0xc4,
+0x00,0x46,0x1b,0xef,0xff,0x40,0x3d,0x03,0x93,0x9f,0x01,0x55,0x66,0x67,0x74,0x00,
+0x00,0x9f,0xc2,0x00,0x11,0x9f,0x86,0x06,0x02,0x08,0x00,0xd1,0x2f,0xd0,0x02,0x22,
+0x9f,0x00,0x00,0x01,0xdf,0x20,0x4f,0xff,0xff,0xc0,0x00,0x80,0x03,0x44,0xaf,0x00,
+0x02,0xdf,0x5d,0xe1,0xd9,0x00,0xf3,0x00,0x4f,0xe2,0x02,0xed,0x00,0x00,0x8f,0x08,
+0xfc,0x10,0x00,0x3e,0xb0,0x00,0x9f,0xbe,0x00,0x13,0x9f,0x58,0x00,0x01,0xc1,0x09,
+0x40,0x35,0x54,0x20,0x01,0x15,0x02,0xf2,0x01,0xff,0xff,0xfd,0x50,0x00,0x00,0x08,
+0xfa,0x30,0x01,0x4c,0xf4,0x00,0x00,0x0f,0xb0,0x3c,0x0c,0x10,0x3f,0x23,0x02,0x21,
+0xae,0x00,0x44,0x03,0x00,0xd3,0x06,0xe0,0x0e,0xe2,0x00,0x00,0x05,0xf9,0x00,0x00,
+0x04,0xff,0xa8,0x78,0xcf,0xd1,0xd6,0x04,0x36,0xbd,0xdc,0xa6,0x7b,0x06,0x00,0x40,
+0x02,0xa3,0x04,0xe0,0x06,0xf0,0x00,0x69,0xab,0x60,0x00,0x6f,0xa7,0x01,0x23,0x06,
+0xf0,0x40,0x02,0x10,0x6f,0x40,0x02,0x53,0xa9,0x9f,0xa0,0x06,0xf0,0x40,0x02,0x13,
+0x6f,0x40,0x02,0x23,0x06,0xf0,0x40,0x02,0x01,0x11,0x00,0x41,0x05,0xf5,0x29,0x9c,
+0x11,0x00,0x43,0xcf,0x13,0xdd,0xef,0x40,0x02,0x23,0x06,0xf0,0x40,0x02,0x13,0x5f,
+0x40,0x02,0x32,0x05,0xf0,0x06,0x40,0x02,0x31,0x5f,0x10,0x6f,0x40,0x02,0x32,0x04,
+0xf1,0x06,0x40,0x02,0x31,0x4f,0x10,0x6f,0x40,0x02,0x00,0x11,0x00,0x02,0xde,0x07,
+0x22,0x10,0x6f,0xf2,0x07,0x03,0x11,0x00,0x00,0x33,0x00,0x11,0x10,0x4e,0x0e,0x27,
+0xa0,0x05,0x40,0x02,0x44,0x00,0x01,0x30,0x00,0x71,0x01,0x33,0xfe,0xdd,0xb0,0x93,
+0x06,0x2a,0x56,0x65,0xad,0x07,0x42,0x04,0xee,0xee,0xff,0xd6,0x0e,0x64,0x16,0x77,
+0x66,0x66,0xef,0x40,0x32,0x00,0x14,0x90,0x6f,0x02,0x14,0xb0,0x12,0x00,0x13,0xd0,
+0x5a,0x00,0x32,0xbf,0xff,0x80,0x7f,0x00,0x50,0xef,0x72,0xbf,0xc2,0x00,0xfb,0x0d,
+0x50,0xfb,0x20,0x00,0x6e,0xf9,0x2c,0x00,0x10,0xb3,0x24,0x0f,0x75,0xe7,0x00,0x00,
+0x01,0x10,0x00,0x06,0xe6,0x03,0x09,0x58,0x04,0x03,0x4c,0x00,0x01,0x66,0x02,0xf0,
+0x04,0x77,0x77,0x78,0x8c,0xf7,0x77,0x77,0x77,0x70,0x7f,0xff,0xfe,0xee,0xff,0xff,
+0xff,0xff,0xfd,0x00,0xf1,0x02,0x00,0x58,0x54,0x31,0x00,0x00,0x01,0x40,0x00,0x6d,
+0xff,0xf9,0x00,0x00,0x08,0xf0,0x00,0x01,0x00,0xf0,0x02,0x08,0xf0,0x04,0x66,0x66,
+0x77,0x50,0x00,0x07,0xf0,0x0e,0xff,0xfe,0xef,0xf1,0x00,0x07,0x18,0x00,0x22,0x2f,
+0xb0,0x08,0x00,0x21,0xdf,0x20,0x08,0x00,0xa1,0x0a,0xf6,0x00,0x00,0x06,0xf0,0x00,
+0x00,0x9f,0xfa,0x08,0x00,0x40,0x08,0xf9,0x7f,0x70,0x08,0x00,0xf0,0x06,0x9f,0x80,
+0x09,0xf5,0x00,0x06,0xf0,0x0b,0xf7,0x00,0x00,0xaf,0x30,0x06,0xf0,0x4e,0x40,0x06,
+0x30,0x08,0x70,0x28,0x00,0x22,0x0e,0x90,0x30,0x00,0x0d,0x08,0x00,0xf3,0x05,0xa1,
+0x24,0x67,0x07,0xf0,0xcf,0xff,0xff,0xff,0xff,0xeb,0x07,0xf0,0x35,0x66,0x65,0x54,
+0x31,0x00,0x07,0x88,0x00,0x0c,0x08,0x00,0x36,0x05,0xe0,0x00,0x01,0x00,0x14,0x31,
+0x09,0x00,0x42,0x3f,0xfe,0xdd,0xa0,0x0a,0x00,0x49,0x14,0x56,0x64,0x00,0x01,0x00,
+0x60,0x03,0xef,0xff,0xff,0xff,0xfd,0x0a,0x00,0x63,0x06,0x76,0x66,0x66,0xdf,0x80,
+0x17,0x00,0x22,0xaf,0xb0,0x08,0x00,0x32,0x02,0xcf,0x90,0x09,0x00,0x32,0x06,0xff,
+0xf6,0x09,0x00,0xf3,0x09,0x5d,0xfa,0x5d,0xfb,0x20,0x00,0x00,0x00,0x17,0xdf,0xc3,
+0x00,0x07,0xef,0x91,0x00,0x00,0x0a,0xf9,0x30,0x00,0x00,0x00,0x7e,0x28,0x00,0x0a,
+0x01,0x00,0xb1,0x26,0x66,0x55,0x55,0x66,0x66,0x77,0x77,0x87,0x07,0xff,0x01,0x00,
+0x30,0xee,0xee,0xc0,0x17,0x00,0x14,0xbd,0x20,0x00,0x24,0x0b,0xd0,0x0a,0x00,0x0f,
+0x13,0x00,0x13,0x14,0xbc,0x09,0x00,0x23,0x01,0x10,0x09,0x00,0x14,0x44,0x09,0x00,
+0x33,0xdf,0xff,0xfd,0x1b,0x00,0x21,0x34,0x42,0x08,0x00,0x40,0x23,0x33,0x34,0x44,
+0x1e,0x00,0x11,0x01,0x7a,0x00,0x10,0x70,0x1a,0x00,0x44,0x11,0x10,0x2b,0xfb,0xcf,
+0x00,0x12,0x80,0x30,0x01,0x22,0xdf,0xf6,0x10,0x00,0xf0,0x03,0xdf,0xd9,0xef,0x92,
+0x00,0x00,0x00,0x29,0xff,0xc5,0x00,0x08,0xef,0xa2,0x00,0x00,0x7b,0x61,0x16,0x00,
+0x16,0xc9,0xcb,0x00,0xb1,0x28,0x88,0x77,0x77,0x66,0x66,0x77,0x78,0x86,0x5e,0xef,
+0x51,0x00,0x20,0xfe,0xec,0x16,0x00,0x10,0x5f,0x0b,0x01,0x06,0x09,0x00,0xa0,0x02,
+0x77,0x77,0xaf,0x98,0x89,0x80,0x00,0x00,0x06,0xed,0x00,0x33,0xef,0xf3,0x00,0x6e,
+0x00,0x14,0xf4,0x09,0x00,0x04,0x12,0x00,0x1e,0x05,0x09,0x00,0x14,0xf4,0xdb,0x00,
+0x10,0x81,0x06,0x00,0x14,0x22,0x78,0x00,0x33,0xef,0xfe,0xdb,0xaa,0x01,0x0b,0xbb,
+0x01,0x06,0xd8,0x00,0x63,0x45,0x55,0x54,0x4b,0xfd,0x20,0xb0,0x01,0x12,0xb1,0x1e,
+0x00,0x22,0x8f,0xf6,0x25,0x00,0x40,0x8e,0xfe,0xfb,0x30,0x3d,0x00,0x40,0x9f,0xfa,
+0x20,0x6e,0x0a,0x00,0xb9,0x7f,0xd7,0x10,0x00,0x00,0x6c,0xf9,0x00,0x00,0x12,0x00,
+0x67,0x00,0x52,0x00,0x10,0x6f,0xff,0xff,0xd9,0x00,0x81,0x16,0x66,0x66,0x66,0x6f,
+0xb6,0x66,0x66,0x6f,0x00,0x12,0x0f,0x28,0x01,0x13,0x30,0x09,0x00,0x26,0x05,0xf3,
+0x09,0x00,0x29,0x0b,0x40,0xd3,0x00,0x06,0x09,0x00,0x91,0xf9,0x66,0x66,0x66,0x67,
+0x73,0x00,0x00,0x03,0x50,0x00,0x19,0xf9,0xb6,0x00,0x07,0xb0,0x01,0x1a,0xfc,0xb0,
+0x01,0x10,0x33,0xb0,0x01,0x00,0xc3,0x00,0x01,0x36,0x00,0x83,0x60,0x00,0x00,0x00,
+0x11,0x11,0x11,0x4d,0x3e,0x00,0x31,0x3b,0xfd,0x50,0x08,0x00,0x40,0x5c,0xff,0xf8,
+0x20,0x7e,0x00,0xf6,0x00,0xaf,0xfb,0x52,0x8e,0xfc,0x82,0x00,0x00,0x6e,0xa6,0x10,
+0x00,0x00,0x38,0xc7,0x60,0x00,0x40,0x17,0x66,0x65,0x55,0x74,0x02,0x32,0x74,0x4e,
+0xef,0x72,0x02,0x11,0xe9,0x0e,0x01,0x04,0x1f,0x00,0x02,0x09,0x00,0xf3,0x02,0x04,
+0x99,0x99,0xcf,0x99,0x9a,0x90,0x00,0x00,0x07,0xee,0xee,0xee,0xdd,0xce,0xf1,0x00,
+0x45,0x03,0x10,0xf1,0xa1,0x00,0x81,0x55,0x55,0x55,0x5a,0xf1,0x00,0x00,0x09,0x3f,
+0x00,0x80,0xe0,0x00,0x00,0x09,0xf3,0x11,0x11,0x11,0xb6,0x00,0x21,0x09,0xf1,0x28,
+0x01,0xff,0x03,0x00,0x00,0x08,0xff,0xee,0xee,0xff,0xff,0xfa,0x00,0x00,0x00,0x67,
+0x88,0x88,0x77,0x76,0x62,0x88,0x02,0x21,0x13,0xfa,0x73,0x00,0x23,0xff,0x70,0x80,
+0x02,0x12,0xf6,0xbf,0x00,0xc0,0xef,0xc7,0xdf,0xb3,0x00,0x00,0x00,0x3a,0xff,0xa3,
+0x00,0x06,0x0a,0x00,0x20,0x6a,0x50,0xb0,0x00,0x16,0xa7,0xe1,0x00,0x40,0x4d,0xdd,
+0xdd,0xee,0x01,0x00,0xa0,0xed,0x29,0x99,0x88,0x88,0xbf,0x88,0x88,0x88,0x86,0x16,
+0x00,0x14,0x7f,0x1f,0x00,0x22,0x7f,0x10,0x08,0x02,0x31,0x9e,0xff,0xfe,0x48,0x02,
+0x50,0x4f,0xe8,0x43,0x59,0xfe,0x14,0x00,0xf3,0x00,0xed,0x10,0x00,0x00,0x3f,0xa0,
+0x00,0x00,0x02,0xf7,0x00,0x00,0x00,0x0a,0xd0,0x09,0x00,0x10,0x0c,0x5b,0x03,0x50,
+0xce,0x20,0x00,0x00,0x8f,0x88,0x00,0x42,0x2e,0xfb,0x88,0x9e,0x71,0x01,0x40,0x7b,
+0xdd,0xb7,0x20,0xaa,0x00,0xf5,0x00,0xb9,0x66,0x50,0x00,0x00,0x14,0x00,0x00,0x08,
+0xcd,0xed,0x20,0x00,0x09,0xf0,0x46,0x01,0x50,0x01,0x55,0x66,0x66,0x61,0x0e,0x05,
+0x52,0x8f,0xff,0xfe,0xff,0x90,0x7f,0x00,0x22,0x0c,0xf2,0x87,0x04,0x22,0x1d,0xf4,
+0x90,0x00,0x30,0x4e,0xff,0x50,0x11,0x00,0xf5,0x07,0x01,0x9f,0xb2,0xbf,0x60,0x00,
+0x7f,0x00,0x05,0xef,0x70,0x00,0x9f,0x60,0x07,0xf0,0x01,0xe9,0x10,0x00,0x00,0x69,
+0xb2,0x00,0xa2,0x07,0xf0,0x01,0x22,0x22,0x23,0x45,0x79,0x90,0x7f,0xf9,0x01,0x82,
+0xd8,0x07,0xf0,0x02,0x33,0x33,0xeb,0x43,0x44,0x00,0x23,0x0e,0x90,0xdc,0x04,0x23,
+0xea,0x00,0x11,0x00,0x1b,0xa0,0x11,0x00,0x14,0x0f,0x22,0x00,0x13,0xf9,0x11,0x00,
+0x6f,0x07,0x30,0x00,0x00,0x06,0xe0,0x74,0x02,0x02,0x4a,0x0d,0xff,0xff,0xd0,0x9d,
+0x01,0x68,0x02,0x33,0x33,0x44,0x44,0x41,0x4e,0x03,0x00,0x77,0x02,0x3a,0x02,0xbf,
+0xa0,0x9f,0x01,0x44,0x00,0x6e,0xff,0x60,0xa0,0x01,0x20,0xef,0xb3,0x50,0x03,0x41,
+0xaf,0xfa,0x30,0x00,0x51,0x03,0x01,0xa1,0x01,0x27,0x05,0xb8,0x6f,0x00,0x20,0x15,
+0x55,0x01,0x00,0x53,0x44,0x44,0x43,0x07,0xff,0x01,0x00,0x41,0xd0,0x01,0x11,0x10,
+0xcf,0x02,0x09,0x7a,0x05,0x60,0x77,0x77,0x77,0x78,0x88,0x70,0x3c,0x05,0x00,0xa8,
+0x02,0x2c,0xff,0x20,0x48,0x03,0x3e,0x00,0x6f,0x30,0x13,0x00,0x05,0x26,0x00,0x15,
+0xf2,0x99,0x04,0x06,0x53,0x00,0xb2,0x1d,0xb9,0x88,0x50,0x00,0x00,0xe7,0x00,0x59,
+0xab,0xb8,0x3b,0x01,0x00,0x01,0x00,0xf0,0x01,0xe9,0x39,0x9a,0xaa,0xbc,0xa0,0x00,
+0x0d,0x95,0xcc,0xcc,0xbb,0xff,0x00,0x00,0xda,0x45,0x01,0x82,0xb0,0x00,0x0d,0xa0,
+0x00,0x00,0x06,0xf5,0x0f,0x00,0x21,0xde,0x00,0x0f,0x00,0x21,0x6f,0x60,0x0f,0x00,
+0x21,0x1e,0xd0,0x0f,0x00,0x30,0x09,0xff,0x10,0x0f,0x00,0x30,0x05,0xfa,0xfa,0x0f,
+0x00,0xf0,0x09,0x02,0xfc,0x07,0xf4,0x00,0x00,0xda,0x01,0xde,0x10,0x0c,0xe0,0x00,
+0x0d,0xa0,0xbe,0x20,0x00,0x2f,0xa0,0x00,0xda,0x8f,0x30,0xa5,0x00,0x20,0x0d,0xa5,
+0xa8,0x00,0x33,0x41,0x00,0xda,0x65,0x01,0x03,0x3c,0x01,0x0b,0x0f,0x00,0xf4,0x02,
+0x97,0x00,0x18,0x64,0x33,0x00,0x00,0x00,0x13,0x00,0x1b,0xef,0xff,0x40,0x00,0x00,
+0x9e,0x6a,0x06,0xf0,0x01,0x01,0x55,0x66,0x67,0x74,0x00,0x00,0x9f,0x05,0xff,0xff,
+0xee,0xfe,0x00,0x00,0x9f,0x4f,0x01,0x12,0xf7,0x08,0x00,0x21,0x2f,0xd0,0x08,0x00,
+0x31,0x01,0xdf,0x20,0xba,0x03,0x31,0x1d,0xff,0x20,0x7c,0x02,0x30,0xdf,0x6e,0xd1,
+0x18,0x00,0xa0,0x3e,0xe3,0x03,0xfc,0x00,0x00,0x9f,0x06,0xfd,0x20,0xd9,0x02,0x75,
+0x9f,0x1f,0x90,0x00,0x00,0x03,0xa0,0x58,0x00,0x01,0x08,0x00,0x42,0x35,0x54,0x20,
+0x01,0x61,0x01,0xd0,0xfd,0x40,0x00,0x00,0x08,0xfa,0x30,0x01,0x4d,0xf4,0x00,0x00,
+0x0f,0xdd,0x06,0x40,0xeb,0x00,0x00,0x3f,0xd4,0x01,0x52,0xae,0x00,0x00,0x2f,0x70,
+0x6e,0x06,0xe0,0x0e,0xe2,0x00,0x00,0x05,0xf9,0x00,0x00,0x04,0xff,0xa8,0x78,0xcf,
+0xd1,0x5b,0x01,0x43,0xbd,0xdc,0xa6,0x00,0x09,0x07,0x25,0x80,0x00,0xb1,0x02,0x00,
+0x38,0x04,0x40,0xef,0xff,0xff,0x10,0x0a,0x00,0x83,0x02,0x66,0x66,0x66,0xbf,0x20,
+0x07,0xf1,0xcd,0x00,0x02,0x44,0x04,0x01,0x5f,0x00,0x22,0x06,0xf1,0x6c,0x04,0x11,
+0xf6,0xac,0x01,0x50,0x02,0x44,0x44,0x5b,0xf0,0x0a,0x00,0x00,0x85,0x02,0x22,0xff,
+0x90,0xc0,0x01,0x40,0x11,0x11,0xaf,0x20,0x2b,0x06,0xf3,0x01,0xe2,0x00,0x00,0x03,
+0xf8,0x00,0x00,0x06,0xf8,0x77,0x60,0x00,0x00,0x0c,0xe0,0x00,0x3c,0x00,0x23,0x8f,
+0x40,0x0a,0x00,0x20,0x05,0xf8,0x05,0x00,0x10,0xf1,0xca,0x07,0x13,0xb0,0x0a,0x00,
+0x00,0xfb,0x00,0x02,0x0a,0x00,0x24,0x0d,0xb0,0x0a,0x00,0x12,0x01,0x49,0x06,0x05,
+0x1a,0x02,0x0f,0x0a,0x00,0x0b,0x35,0x03,0xd1,0x00,0x15,0x00,0x02,0x06,0x00,0xf0,
+0x05,0xd0,0x01,0xf5,0x29,0xaa,0xab,0xbb,0x30,0x7e,0x00,0x2f,0x54,0xbc,0xcb,0xbc,
+0xf6,0x07,0xe0,0x02,0xf5,0x43,0x04,0x50,0x40,0x8e,0x00,0x1f,0x50,0x1f,0x05,0x41,
+0x08,0xe0,0x01,0xf5,0x2b,0x01,0x02,0x11,0x00,0x20,0x0f,0x90,0x11,0x00,0xf0,0x0b,
+0xbe,0xee,0xef,0xf4,0x00,0x8e,0x22,0x3f,0x54,0x77,0x77,0xee,0x00,0x08,0xff,0xff,
+0xf5,0x00,0x00,0x3f,0x70,0x00,0x8e,0x44,0x5f,0x50,0xcb,0x00,0x01,0x33,0x00,0xd0,
+0x05,0xf6,0x00,0x00,0x7e,0x00,0x1f,0x50,0x01,0xec,0x00,0x00,0x07,0x11,0x00,0x22,
+0xbf,0x20,0x11,0x00,0x22,0x8f,0x50,0x11,0x00,0x31,0x5f,0x80,0x00,0x11,0x00,0x33,
+0x5a,0x80,0x00,0x22,0x00,0x02,0xd5,0x04,0x23,0x1f,0x50,0x23,0x04,0x0a,0x11,0x00,
+0x35,0x04,0x90,0x01,0x2e,0x07,0x04,0x08,0x00,0x13,0x30,0x99,0x09,0xe2,0xe0,0x0a,
+0xbb,0xbb,0xcc,0xc6,0x00,0x08,0xf0,0x09,0xaa,0xa9,0x99,0xfa,0xb1,0x09,0x22,0x02,
+0xf7,0x08,0x00,0x22,0x06,0xf3,0x08,0x00,0xd0,0x0b,0xe0,0x00,0x08,0xf0,0x01,0x11,
+0x12,0x3f,0x80,0x00,0x08,0xf0,0xf8,0x06,0xf2,0x09,0x20,0x11,0x19,0xf0,0x03,0x44,
+0x45,0xfa,0x0c,0xff,0xff,0xf0,0x00,0x00,0x09,0xf2,0x03,0x55,0x5b,0xf0,0x00,0x00,
+0x3f,0x80,0xf1,0x09,0x21,0xdd,0x00,0x08,0x00,0x22,0x0b,0xf2,0x08,0x00,0x21,0x8f,
+0x50,0x08,0x00,0x22,0x08,0xf6,0x09,0x0a,0x22,0x5f,0x60,0x08,0x00,0x13,0x12,0x19,
+0x0a,0x1f,0x00,0x08,0x00,0x0a,0x23,0x06,0xb0,0xb0,0x00,0x10,0x40,0x00,0x02,0x00,
+0x18,0x00,0xc3,0x1d,0xff,0xff,0xff,0xf1,0x00,0x08,0xf0,0x05,0x55,0x44,0x4a,0x49,
+0x0a,0x22,0x0b,0xf0,0x08,0x00,0x10,0x0e,0x51,0x0a,0xd1,0x3d,0xdd,0xde,0xef,0x60,
+0x00,0x07,0xf0,0x16,0x77,0x77,0xfe,0x07,0xa0,0x00,0xa1,0x07,0xf6,0x03,0x77,0x7b,
+0xf0,0x00,0x00,0x5f,0xb0,0x8e,0x02,0x22,0x06,0xfd,0x24,0x01,0x21,0xaf,0xb0,0x08,
+0x00,0x22,0x3e,0xf7,0x34,0x01,0x2c,0x38,0x10,0x21,0x0a,0x13,0xd6,0x08,0x00,0x10,
+0xf9,0x13,0x01,0x34,0x50,0x00,0x00,0x9a,0x07,0x13,0xf8,0x93,0x00,0x04,0x08,0x00,
+0x90,0xfb,0x55,0x55,0x56,0x67,0x71,0x00,0x00,0xdf,0xbc,0x04,0x1b,0xe3,0xd3,0x09,
+0xa0,0x45,0x00,0x15,0x66,0x66,0x77,0x30,0x00,0x0b,0xd0,0xb1,0x03,0x13,0xfd,0xa7,
+0x09,0x22,0x0e,0xb0,0xa6,0x09,0xa0,0x03,0xf6,0x00,0x00,0xad,0x00,0x6a,0xbb,0xbb,
+0xdf,0x65,0x06,0x81,0x06,0xaa,0xaa,0xdf,0x70,0xbf,0xff,0xfd,0xb9,0x02,0x90,0x04,
+0x67,0x7d,0xd0,0x00,0x00,0x4e,0xd1,0x00,0x22,0x00,0x30,0x00,0x6f,0xb0,0xe8,0x00,
+0x42,0xc0,0x03,0xcf,0x80,0xd8,0x09,0x11,0xdb,0xd9,0x04,0x26,0x0a,0xb0,0xd7,0x01,
+0xc2,0x01,0x56,0x66,0x66,0x66,0x7a,0x40,0x00,0x00,0x9f,0xff,0xff,0x6e,0x07,0x21,
+0x11,0x10,0x69,0x00,0x04,0x61,0x03,0x41,0x00,0x06,0xef,0xff,0x4c,0x03,0x73,0x00,
+0x9f,0x98,0x88,0x88,0x77,0x71,0xa2,0x07,0x00,0x01,0x00,0x12,0x9f,0xf2,0x05,0x00,
+0xaa,0x07,0xb5,0xff,0xff,0xff,0xf2,0x00,0x00,0x06,0x77,0x77,0x77,0x66,0x40,0x09,
+0xa2,0x42,0x01,0x33,0x34,0x55,0x51,0x00,0x00,0xf8,0x09,0x5a,0x00,0x62,0xf9,0x00,
+0x21,0x10,0x01,0xf9,0x11,0x01,0xf0,0x04,0x04,0xf5,0x00,0x00,0xf9,0x03,0x44,0x44,
+0x5b,0xf1,0x00,0x00,0xf9,0x0e,0xff,0xff,0xff,0xa0,0xef,0xc3,0x08,0xa2,0x01,0xcf,
+0x10,0x57,0x77,0xf9,0x00,0x00,0x0a,0xf5,0x6b,0x06,0x21,0xbf,0x70,0x39,0x01,0x21,
+0x3d,0xf5,0x41,0x01,0x32,0x09,0xfc,0x20,0x08,0x00,0x11,0x40,0x60,0x00,0x17,0xe7,
+0x90,0x08,0x00,0xe6,0x05,0x43,0x82,0x00,0x00,0x7f,0x0b,0x09,0x20,0x8f,0x10,0x93,
+0x05,0x0f,0x08,0x00,0x08,0xa1,0x42,0x22,0x22,0x33,0xf9,0x00,0x00,0x5f,0xff,0xff,
+0x4b,0x03,0x55,0x01,0x22,0x22,0x22,0x21,0xe4,0x02,0xa0,0x02,0x33,0x44,0x45,0x30,
+0x00,0x08,0xe0,0x2f,0xff,0x09,0x02,0x60,0x08,0xe0,0x02,0x21,0x11,0x0a,0x08,0x00,
+0x00,0x68,0x05,0x11,0xc0,0x64,0x02,0x00,0x7c,0x03,0x20,0x08,0xf0,0x3e,0x00,0x91,
+0x10,0x22,0x29,0xf0,0x15,0x55,0x59,0xf8,0x04,0x34,0x02,0xa1,0x0d,0xd0,0x00,0x34,
+0x49,0xf0,0x00,0x00,0xcf,0x20,0x04,0x02,0x21,0x1c,0xf4,0x0c,0x02,0x31,0x03,0xde,
+0x30,0x08,0x00,0x22,0x8f,0xa1,0x24,0x02,0x00,0x22,0x01,0x22,0x19,0x10,0x34,0x02,
+0x41,0x5f,0x40,0x06,0xf0,0xd4,0x04,0x30,0x10,0x01,0x50,0x7d,0x00,0x12,0xfe,0x85,
+0x00,0x32,0x0a,0xff,0xc1,0x8c,0x03,0x30,0x85,0xfd,0x10,0x34,0x00,0x40,0xfa,0x00,
+0x3e,0xe2,0x26,0x00,0x70,0x90,0x00,0x02,0xde,0x30,0x00,0x0c,0x15,0x03,0x41,0x1c,
+0xf3,0x00,0x07,0x10,0x01,0x12,0x62,0x33,0x00,0x23,0x20,0x01,0x46,0x07,0xf1,0x04,
+0xd7,0x05,0xf1,0x04,0xbb,0xbb,0xcc,0xb0,0x00,0xe7,0x05,0xf1,0x04,0xab,0xaa,0x9d,
+0xf0,0x00,0xf7,0xd6,0x04,0x23,0x0a,0xe0,0x09,0x00,0x23,0x0d,0xb0,0x09,0x00,0x23,
+0x1f,0x80,0x09,0x00,0x20,0x5f,0x40,0x2d,0x00,0xf1,0x00,0x0d,0xff,0xff,0xfe,0x05,
+0x55,0xf7,0x05,0xf1,0x04,0x66,0x67,0xf9,0x4f,0xff,0x1b,0x00,0x30,0x07,0xf2,0x00,
+0x1b,0x00,0x02,0x13,0x02,0x01,0x09,0x00,0x22,0x8f,0x20,0x09,0x00,0x32,0x03,0xf9,
+0x00,0x09,0x00,0x23,0x0d,0xd0,0x09,0x00,0x10,0xaf,0xe7,0x00,0x61,0xe8,0x05,0xf1,
+0x07,0xf5,0x00,0x09,0x00,0x33,0xf2,0x0b,0x60,0x09,0x00,0x2f,0x00,0x00,0x09,0x00,
+0x0c,0x35,0x94,0x04,0xf1,0x23,0x0b,0x0f,0x6b,0x04,0x21,0x31,0xe5,0xff,0xff,0x6b,
+0x04,0x32,0x81,0x77,0x7c,0x6b,0x04,0x21,0x00,0x08,0x6b,0x04,0x02,0x13,0x04,0x22,
+0x09,0xf2,0x08,0x00,0x51,0x3f,0x80,0x03,0x32,0x29,0x6b,0x04,0x31,0x4f,0xff,0xff,
+0x6b,0x04,0x3f,0x03,0x44,0x4a,0x6b,0x04,0x34,0x2f,0x00,0x31,0xef,0x02,0x0a,0xa1,
+0x9f,0xff,0xf9,0x02,0x33,0x33,0x3b,0xf1,0x25,0x55,0xef,0x02,0x10,0x90,0x18,0x00,
+0x41,0x22,0x22,0xdf,0x10,0x20,0x00,0xf1,0x02,0x09,0xf5,0x00,0x89,0x99,0xf9,0x00,
+0x00,0xaf,0x70,0x01,0xdd,0xdd,0xf8,0x00,0x2d,0xf6,0xe7,0x02,0x13,0x08,0xef,0x02,
+0x28,0x0b,0x50,0x40,0x04,0x2f,0x00,0x42,0xef,0x02,0x30,0x50,0x22,0x22,0x22,0x21,
+0x00,0xf3,0x03,0x00,0x02,0x67,0x77,0x77,0x77,0x88,0x20,0x00,0x00,0x00,0x7f,0xff,
+0xff,0xff,0xfe,0xfb,0x00,0x01,0x00,0x24,0x0d,0xc0,0x0a,0x00,0x15,0xcb,0x13,0x00,
+0xf4,0x05,0xb0,0x00,0x00,0x00,0x8e,0xee,0xee,0xef,0xff,0xfa,0x00,0x00,0x00,0x03,
+0x77,0x77,0x77,0x77,0x6f,0xa0,0x1d,0x00,0x14,0xf8,0x09,0x00,0x21,0x0f,0x70,0x07,
+0x00,0x42,0x83,0x00,0x01,0xf6,0x10,0x00,0x40,0x80,0x00,0x3f,0x40,0x09,0x00,0x42,
+0x01,0xf8,0x00,0x01,0x2f,0x00,0x23,0x1f,0x80,0x2c,0x00,0x15,0x01,0x36,0x00,0x11,
+0x1f,0x36,0x00,0x23,0x07,0xff,0x01,0x00,0x40,0xf0,0x27,0x76,0x66,0x01,0x00,0x60,
+0x77,0x75,0x00,0x00,0x01,0xee,0x73,0x00,0x40,0x90,0x00,0x00,0x00,0x72,0x00,0x23,
+0x7d,0xd0,0x32,0x00,0x10,0x0b,0x09,0x00,0x91,0x45,0x55,0x55,0x55,0x5d,0xc0,0x00,
+0x00,0x05,0x36,0x00,0x10,0xb0,0x53,0x00,0x41,0x00,0x20,0x00,0x0d,0x67,0x00,0x51,
+0x06,0xf0,0x00,0x0d,0x90,0x56,0x00,0xf3,0x00,0xf1,0x00,0x04,0x10,0x00,0x03,0x33,
+0x33,0x39,0xf4,0x33,0x33,0x33,0x32,0x7f,0x64,0x00,0x32,0xfe,0x03,0x33,0x01,0x00,
+0x25,0x31,0x00,0x01,0x00,0x73,0x02,0x88,0x88,0x88,0x89,0x9b,0xa0,0x51,0x00,0x23,
+0xef,0xf2,0x17,0x00,0x27,0x05,0xf3,0x09,0x00,0x20,0x04,0xef,0x1c,0x00,0xd4,0xf1,
+0x00,0x00,0x07,0xfa,0x88,0x88,0x88,0x88,0x50,0x00,0x00,0x07,0x1f,0x00,0x01,0x09,
+0x00,0x24,0x11,0x10,0x90,0x00,0x00,0x27,0x01,0x62,0x57,0x77,0x66,0x66,0x66,0x51,
+0x2f,0x01,0x20,0x88,0x99,0x68,0x01,0x56,0x9f,0xff,0xff,0xff,0xee,0x2f,0x01,0x14,
+0x90,0x0a,0x00,0x19,0xf9,0x13,0x00,0x50,0x02,0x22,0x22,0x22,0x23,0x26,0x00,0x11,
+0x09,0x4b,0x00,0x00,0x32,0x01,0x64,0x14,0x44,0x44,0x44,0x44,0xf7,0x26,0x00,0x23,
+0x2f,0x60,0x09,0x00,0x24,0x03,0xf5,0x13,0x00,0x24,0x4f,0x30,0xa7,0x00,0x14,0xf1,
+0x13,0x00,0x27,0x04,0x00,0x01,0x00,0x22,0x27,0x77,0x01,0x00,0x15,0x76,0x68,0x01,
+0x34,0xd0,0x00,0x00,0x00,0x02,0x64,0x03,0xef,0xff,0xff,0xfe,0xef,0xd0,0x01,0x13,
+0x0e,0x09,0x00,0x61,0x11,0x1d,0xa0,0x00,0x00,0x06,0x2c,0x00,0xa4,0xa0,0x00,0x00,
+0x01,0x56,0x55,0x55,0x55,0x4f,0x90,0xa8,0x00,0x04,0xc7,0x01,0x60,0x08,0x30,0x00,
+0x26,0x65,0x55,0x01,0x00,0x24,0x66,0x64,0x5e,0x01,0x2e,0xe9,0x00,0x01,0x00,0xf3,
+0x01,0x05,0x88,0x88,0x89,0x99,0x9c,0xa0,0x00,0x00,0x08,0xee,0xee,0xee,0xdd,0xde,
+0xf0,0x17,0x00,0x18,0x09,0x09,0x00,0x21,0x06,0xef,0x00,0x02,0x40,0x00,0x00,0x09,
+0xf8,0x3a,0x01,0x44,0x30,0x00,0x00,0x09,0xcd,0x00,0x02,0x09,0x00,0x90,0x10,0x00,
+0x00,0x08,0xff,0xee,0xee,0xff,0xff,0x30,0x01,0x73,0x68,0x88,0x88,0x88,0x76,0x61,
+0x00,0xc6,0x00,0x00,0xff,0x00,0x10,0x2e,0x5e,0x01,0x14,0xfc,0x72,0x00,0x19,0x0c,
+0xc6,0x02,0x24,0x05,0xef,0x26,0x02,0x00,0x0a,0x01,0x34,0x66,0xea,0x00,0xed,0x00,
+0x14,0x80,0x0a,0x00,0x24,0xe6,0x00,0x9a,0x02,0x43,0x00,0x00,0x02,0x77,0x01,0x00,
+0x23,0x60,0x6f,0xd4,0x00,0x2f,0xfd,0x00,0x01,0x00,0x01,0x65,0x16,0x66,0x66,0x67,
+0x77,0x85,0xbe,0x02,0x00,0xa5,0x00,0x11,0x8f,0x50,0x03,0x00,0xaa,0x00,0x10,0xf1,
+0x89,0x02,0x01,0x13,0x00,0x5a,0x10,0x00,0x00,0x00,0x6f,0x13,0x00,0x55,0x42,0x11,
+0x12,0x23,0x8f,0x2e,0x02,0x10,0xd0,0xf6,0x01,0x55,0x44,0x44,0x43,0x32,0x20,0x85,
+0x00,0x13,0x30,0x60,0x01,0xf0,0x02,0xe0,0x0a,0xbb,0xbb,0xcc,0xc6,0x00,0x08,0xf0,
+0x09,0xaa,0xa9,0x99,0xfa,0x00,0x08,0xf0,0x2b,0x00,0x12,0xf7,0x08,0x00,0x22,0x06,
+0xf3,0x08,0x00,0xd0,0x0b,0xe0,0x00,0x08,0xf0,0x01,0x11,0x12,0x3f,0x80,0x00,0x08,
+0xf0,0xb2,0x00,0x91,0x20,0x00,0x08,0xf0,0x03,0x44,0x45,0xfa,0x00,0x20,0x00,0x22,
+0x09,0xf2,0x08,0x00,0x22,0x3f,0x80,0x08,0x00,0x21,0xdd,0x00,0x08,0x00,0x22,0x0b,
+0xf2,0x08,0x00,0x21,0x8f,0x50,0x08,0x00,0x31,0x08,0xf6,0x00,0x08,0x00,0x22,0x5f,
+0x60,0x08,0x00,0x32,0x12,0x00,0x00,0x20,0x00,0x0f,0x08,0x00,0x0a,0x23,0x06,0xb0,
+0xb0,0x00,0xa1,0x10,0x02,0x22,0x33,0x33,0x20,0x00,0x0b,0xc0,0x6f,0xc4,0x01,0x72,
+0x0b,0xd0,0x03,0x33,0x22,0x1b,0xf0,0xab,0x03,0xe1,0x0e,0xb0,0x00,0x0b,0xd0,0x14,
+0x55,0x55,0x8f,0x50,0x00,0x0b,0xd0,0x9f,0x4d,0x01,0x00,0x18,0x00,0x22,0x0b,0xf4,
+0x08,0x00,0x21,0x9f,0x70,0x08,0x00,0x20,0x0a,0xf8,0xcb,0x00,0x41,0xc0,0x04,0xef,
+0x50,0xbe,0x01,0x20,0x8f,0xa1,0x58,0x00,0x34,0x0a,0xb0,0x32,0xa1,0x03,0x00,0x95,
+0x01,0x51,0x78,0x88,0x30,0x00,0x08,0xa0,0x03,0x13,0xa0,0xc0,0x01,0x15,0xb0,0x08,
+0x00,0x20,0x05,0xdd,0x2e,0x04,0x95,0x90,0x00,0x09,0xfa,0x99,0x99,0x99,0x98,0x20,
+0x3d,0x02,0x03,0x08,0x00,0x00,0x3b,0x02,0x41,0xff,0xff,0xff,0xf2,0x31,0x02,0x32,
+0x76,0x66,0x40,0x15,0x00,0x24,0x24,0x00,0x62,0x02,0xf1,0x02,0xe0,0x00,0x00,0x3e,
+0xee,0xee,0xee,0xa0,0x00,0x9e,0x00,0x00,0x06,0xf9,0x89,0x88,0x74,0x13,0x00,0x10,
+0x6f,0xbc,0x01,0x01,0x13,0x00,0x14,0xf1,0xf7,0x00,0x11,0x7f,0x13,0x00,0x11,0x8f,
+0x5d,0x04,0x04,0x13,0x00,0x10,0x43,0xfc,0x00,0x30,0x8f,0x33,0x43,0x08,0x02,0x10,
+0xfc,0xa2,0x00,0xbf,0xf0,0x7f,0x43,0x33,0x22,0x00,0x00,0x8f,0x22,0x21,0x07,0x39,
+0x00,0x05,0x15,0x07,0x13,0x00,0x90,0x7f,0x00,0x00,0x07,0xf9,0x87,0x89,0xac,0xe4,
+0x13,0x00,0x50,0x2c,0xee,0xed,0xca,0x86,0x13,0x00,0x03,0x58,0x04,0x04,0x22,0x03,
+0x0f,0x13,0x00,0x0a,0x27,0x06,0xf0,0xbe,0x02,0x03,0x01,0x00,0x80,0x14,0x00,0x00,
+0x28,0x88,0x88,0x88,0x40,0x72,0x00,0x50,0x8f,0xee,0xfe,0xed,0x70,0x09,0x00,0x11,
+0x9f,0x1b,0x00,0x09,0x09,0x00,0x91,0x33,0x33,0x33,0x10,0x00,0x8f,0x10,0x10,0x9f,
+0xe9,0x03,0xd3,0x8f,0xff,0xfd,0x9f,0x34,0x43,0x32,0x00,0x00,0x7f,0x55,0x52,0x9e,
+0x65,0x00,0x00,0x00,0x01,0x20,0x01,0x35,0x09,0x00,0xe6,0x8f,0xfe,0xef,0xff,0xff,
+0x10,0x7f,0x00,0x00,0x05,0x77,0x76,0x54,0x20,0x80,0x00,0x10,0x25,0x7a,0x00,0x50,
+0x22,0x22,0x22,0x22,0x20,0x8c,0x04,0x01,0x63,0x05,0x00,0x82,0x04,0x54,0x55,0x54,
+0x44,0x43,0xaf,0x24,0x00,0x10,0x8f,0xa8,0x00,0x00,0xac,0x03,0x14,0xcf,0x24,0x00,
+0x10,0xfa,0x09,0x00,0x14,0x50,0xc2,0x04,0x04,0x09,0x00,0x70,0x3f,0xfe,0xee,0xef,
+0xff,0xff,0x70,0x34,0x04,0x53,0x87,0x77,0x77,0x66,0x10,0x17,0x00,0x41,0x23,0x00,
+0x00,0x18,0x74,0x05,0xd1,0xad,0x00,0x00,0x6f,0xee,0xfe,0xed,0x90,0x00,0xae,0x00,
+0x00,0x6f,0x31,0x03,0x14,0xae,0x49,0x01,0x04,0x09,0x00,0x00,0xb1,0x00,0xf6,0x03,
+0x7f,0xcc,0xcc,0xcd,0xa0,0x00,0x9f,0x99,0x95,0x7f,0xba,0xaa,0x99,0x50,0x00,0x9f,
+0xff,0xfb,0x1b,0x00,0x05,0x09,0x00,0x62,0x53,0x33,0x45,0x8a,0x20,0x9e,0x8f,0x00,
+0x31,0xec,0x20,0x9e,0xc5,0x00,0x44,0x10,0x00,0x00,0x9d,0xb4,0x00,0x24,0x12,0x00,
+0xdf,0x02,0x00,0x99,0x00,0x04,0x09,0x04,0x60,0x5f,0x97,0x77,0x77,0x77,0xcf,0x09,
+0x00,0x13,0x30,0xd8,0x00,0x1e,0x5f,0x09,0x00,0x58,0x63,0x22,0x22,0x23,0xaf,0x36,
+0x00,0x66,0x02,0x44,0x43,0x33,0x32,0x10,0x12,0x05,0x02,0xb9,0x01,0xf1,0x05,0xd0,
+0x02,0xf4,0x0d,0xee,0xee,0xee,0x10,0x8e,0x00,0x3f,0x41,0xfb,0x88,0x87,0x60,0x08,
+0xe0,0x02,0xf4,0x12,0x07,0x40,0x8e,0x00,0x2f,0x41,0x93,0x03,0x01,0x11,0x00,0x00,
+0x94,0x03,0x13,0x7e,0x11,0x00,0x10,0x07,0x11,0x00,0xf3,0x00,0xb8,0x88,0x88,0x00,
+0x7e,0x33,0x5f,0x41,0xff,0xee,0xed,0xb0,0x07,0xff,0xff,0x22,0x00,0x26,0x22,0x4f,
+0x22,0x00,0x0d,0x33,0x00,0xc0,0x60,0x00,0x13,0x20,0x7e,0x00,0x2f,0x40,0xfe,0xde,
+0xef,0xfc,0x11,0x00,0x92,0x04,0x88,0x76,0x52,0x00,0x7f,0x00,0x2f,0x40,0x54,0x02,
+0x23,0x02,0xf4,0xee,0x01,0x0b,0x11,0x00,0x13,0x8f,0x11,0x00,0x4c,0x04,0x90,0x01,
+0xf4,0x64,0x02,0xb0,0x01,0x00,0x35,0x44,0x45,0x40,0x07,0xc0,0x05,0xf2,0x0f,0x76,
+0x04,0xe1,0x8e,0x00,0x5f,0x31,0xf7,0x11,0x11,0x00,0x08,0xe0,0x05,0xf3,0x1f,0x60,
+0x3c,0x00,0x31,0x5f,0x31,0xf6,0xfe,0x02,0xfe,0x03,0x05,0xf3,0x1f,0xca,0xaa,0xba,
+0x00,0x8f,0xbb,0xdf,0x31,0xfd,0xcc,0xcb,0x90,0x08,0xfb,0xbc,0x22,0x00,0x00,0xa2,
+0x00,0xf1,0x07,0x30,0x8f,0x00,0x5f,0x20,0xfe,0xde,0xff,0xfd,0x08,0xf0,0x05,0xf2,
+0x04,0x88,0x76,0x53,0x00,0x8e,0x00,0x5f,0x20,0x6c,0x00,0x36,0x20,0x01,0x70,0x7a,
+0x05,0x14,0x0d,0x98,0x06,0x10,0x67,0x2e,0x08,0x13,0xde,0x16,0x00,0x23,0x0a,0xe0,
+0x09,0x00,0x1f,0xae,0x11,0x00,0x06,0x04,0x44,0x08,0x16,0x67,0x27,0x03,0x81,0x45,
+0x54,0x55,0x50,0x08,0xc0,0x07,0xf1,0xc4,0x00,0x40,0xae,0x00,0x7f,0x11,0xc4,0x00,
+0x61,0x09,0xe0,0x07,0xf1,0x1f,0x60,0x27,0x02,0x31,0x6f,0x11,0xf6,0x21,0x04,0xf3,
+0x04,0x06,0xf1,0x1f,0xfe,0xee,0xfe,0x00,0x9f,0xee,0xff,0x11,0xfb,0x88,0x87,0x50,
+0x08,0xf8,0x7b,0xf1,0xc4,0x00,0x22,0x6f,0x11,0xc4,0x00,0xf7,0x0c,0x06,0xf1,0x1f,
+0x83,0x34,0x68,0x80,0x8f,0x00,0x6f,0x10,0xef,0xff,0xff,0xd8,0x08,0xf0,0x07,0xf1,
+0x00,0x23,0x21,0x00,0x00,0x6b,0x00,0x6f,0x36,0x06,0x10,0x28,0x05,0x00,0x50,0x35,
+0x00,0x00,0x05,0xf2,0x91,0x00,0x40,0xc0,0x00,0x00,0x5f,0x16,0x02,0x14,0xac,0x0d,
+0x06,0x00,0x11,0x00,0x53,0x87,0x77,0x77,0x76,0xcc,0xcd,0x07,0x05,0x22,0x00,0x14,
+0xbc,0x22,0x00,0x00,0xa5,0x08,0x12,0x66,0x5c,0x08,0x02,0x07,0x08,0x03,0x52,0x02,
+0xf2,0x01,0xf0,0xae,0xee,0xee,0xee,0x30,0x00,0x6f,0x0e,0xd8,0x89,0x88,0x61,0x00,
+0x06,0xf0,0xe6,0x06,0x23,0x6f,0x0e,0x14,0x09,0x13,0xe9,0x0f,0x00,0x12,0x90,0x0f,
+0x00,0xf2,0x01,0xfc,0x77,0x88,0x80,0x26,0x66,0xaf,0x0f,0xfe,0xee,0xdc,0x19,0xff,
+0xff,0xf0,0xf9,0x1e,0x00,0x13,0x0f,0x1e,0x00,0x0e,0x0f,0x00,0xf4,0x04,0x01,0x31,
+0x00,0x6f,0x0e,0xfd,0xdd,0xef,0xff,0x70,0x06,0xf0,0x38,0x88,0x87,0x65,0x30,0x00,
+0x5f,0x78,0x00,0x02,0x08,0x00,0x0b,0x0f,0x00,0x13,0x6f,0x87,0x08,0x1b,0xd0,0x35,
+0x07,0xa1,0x10,0x01,0x11,0x11,0x11,0x10,0x00,0x04,0xf2,0x0f,0x8f,0x05,0xa2,0x05,
+0xf3,0x0f,0x94,0x45,0x44,0x20,0x00,0x04,0xf3,0x09,0x0a,0x07,0x08,0x00,0xe4,0xc8,
+0x88,0x99,0x60,0xac,0xcd,0xf3,0x1f,0xed,0xdd,0xcb,0x70,0x79,0xab,0x18,0x00,0x18,
+0xf2,0x08,0x00,0x51,0x14,0x10,0x05,0xf2,0x0f,0x95,0x00,0x72,0x05,0xf2,0x03,0x78,
+0x87,0x65,0x42,0x56,0x01,0x07,0x09,0x09,0x00,0x08,0x00,0x13,0x97,0x08,0x00,0x10,
+0xeb,0x87,0x03,0x12,0xb0,0x08,0x00,0x00,0x01,0x00,0x1b,0xea,0x08,0x00,0x90,0xed,
+0x65,0x55,0x66,0x67,0x83,0x00,0x00,0xaf,0x66,0x01,0x1b,0xe6,0xb8,0x00,0xe0,0x30,
+0x06,0x88,0x88,0x88,0x80,0x00,0x06,0xf2,0x0f,0xfe,0xef,0xee,0xc1,0x08,0x00,0x11,
+0x70,0x60,0x00,0x24,0xf2,0x1f,0x08,0x00,0x80,0x94,0x44,0x45,0x20,0x68,0x7a,0xf2,
+0x1f,0xa3,0x01,0x79,0xce,0xff,0xf2,0x1f,0x82,0x22,0x10,0x20,0x00,0x81,0x70,0x00,
+0x01,0x35,0x20,0x05,0xf1,0x0f,0xd6,0x09,0x75,0x06,0xf1,0x03,0x67,0x76,0x54,0x31,
+0x2f,0x01,0x01,0x6f,0x04,0x00,0x43,0x05,0x31,0x00,0x00,0x00,0xe6,0x01,0x10,0xe0,
+0xe4,0x0a,0x37,0x44,0x44,0x4a,0x72,0x07,0x84,0x57,0x77,0x77,0x78,0x8c,0xf0,0x00,
+0x00,0x06,0x02,0x1b,0xf8,0x40,0x0a,0x01,0x1d,0x09,0x93,0xf8,0x00,0x00,0x37,0x88,
+0x77,0x77,0x77,0x61,0x15,0x00,0x12,0x40,0xb8,0x00,0x13,0x05,0xb8,0x00,0x1e,0x05,
+0xb8,0x00,0x10,0x70,0x4f,0x09,0x11,0x8a,0xb8,0x00,0x10,0xb0,0xb8,0x00,0x45,0xa6,
+0x66,0x65,0x20,0x20,0x00,0x16,0x06,0x08,0x00,0xd8,0xb7,0x77,0x89,0xbe,0x70,0x06,
+0xf2,0x0a,0xee,0xee,0xdc,0xa8,0x20,0x60,0x01,0x01,0xa0,0x03,0x11,0x50,0xa0,0x00,
+0x10,0x77,0x16,0x0b,0x02,0xc9,0x0b,0x02,0xa0,0x00,0x16,0x08,0x08,0x00,0x1c,0x01,
+0x08,0x00,0x93,0xfa,0x22,0x22,0x22,0x3a,0xf0,0x00,0x00,0xdf,0xf8,0x02,0x00,0xfa,
+0x0a,0x1a,0x11,0x21,0x05,0xf1,0x08,0x02,0xf1,0x02,0xf4,0x1e,0xee,0xee,0xe9,0x00,
+0x4f,0x20,0x3f,0x44,0xf9,0x88,0x87,0x30,0x04,0xf3,0x03,0xf4,0x4f,0x30,0xf3,0x0a,
+0x30,0x3f,0x44,0xf3,0xfe,0x02,0x31,0xf3,0x03,0xf4,0x77,0x05,0x45,0x3f,0x30,0x3f,
+0x45,0x11,0x00,0xde,0x98,0x89,0x50,0x67,0x9f,0x30,0x3f,0x45,0xfe,0xdd,0xc8,0x0e,
+0xff,0x22,0x00,0x14,0x02,0x11,0x00,0x18,0x2f,0x11,0x00,0x10,0x02,0x11,0x00,0xf3,
+0x01,0x44,0xfd,0xcc,0xef,0xf8,0x03,0xf2,0x02,0xf4,0x07,0x99,0x97,0x63,0x00,0x4f,
+0x20,0xff,0x04,0x13,0xf2,0x10,0x05,0x04,0x11,0x00,0x42,0x05,0xf1,0x02,0xf5,0xf7,
+0x02,0x31,0x10,0x2f,0x50,0x86,0x03,0x15,0xa0,0x21,0x05,0x19,0x00,0x21,0x05,0x31,
+0x30,0x01,0xf4,0x21,0x05,0x42,0xfd,0x00,0x2f,0x60,0x21,0x05,0x23,0x01,0xf6,0x21,
+0x05,0x31,0x1f,0x60,0x4f,0xff,0x04,0x30,0x01,0xf6,0x04,0x21,0x05,0xd3,0xa3,0xbf,
+0xff,0x60,0x4f,0x31,0xfd,0xcc,0xba,0x23,0x67,0xf7,0x04,0x22,0x00,0x12,0x70,0x21,
+0x05,0x23,0x00,0xf7,0x21,0x05,0x22,0x0f,0x70,0x21,0x05,0x23,0x00,0xf7,0x21,0x05,
+0x42,0x0f,0x60,0x5f,0x20,0xa1,0x02,0x0f,0x21,0x05,0x41,0x70,0x02,0x00,0x15,0x00,
+0x01,0x10,0x11,0x80,0x00,0x20,0xf1,0x0e,0xc4,0x00,0xe1,0x0f,0x80,0x5f,0x10,0xfa,
+0x55,0x54,0x20,0x00,0xf8,0x05,0xf1,0x0f,0x70,0xf6,0x0d,0x32,0x5f,0x11,0xf7,0xa2,
+0x00,0x00,0x03,0x03,0xf6,0x05,0x50,0x25,0x5f,0x70,0x5f,0x21,0xff,0xff,0xff,0x5b,
+0xff,0xf7,0x05,0xf1,0x1f,0x82,0x21,0x00,0x01,0x1f,0x22,0x00,0x24,0xf1,0x1f,0x33,
+0x00,0x40,0xf9,0x45,0x68,0xa9,0x11,0x00,0xa0,0x0d,0xff,0xff,0xec,0x70,0x0f,0x70,
+0x6f,0x10,0x01,0xfa,0x01,0x11,0xf6,0x68,0x09,0x00,0x19,0x01,0x80,0x6f,0x00,0x00,
+0x03,0x40,0x00,0x01,0xf5,0xee,0x08,0x10,0xaf,0x0e,0x02,0x44,0x4b,0x00,0x00,0x0a,
+0x2c,0x03,0x1c,0xaf,0xbf,0x00,0x63,0xaf,0x65,0x55,0x56,0x77,0x88,0xb0,0x0c,0x22,
+0xfe,0xd0,0x2d,0x0c,0x07,0xdd,0x0d,0x02,0x88,0x01,0x40,0xf3,0x06,0xf2,0x0f,0x9b,
+0x08,0x40,0x2f,0x50,0x6f,0x21,0x88,0x01,0x43,0x02,0xf6,0x06,0xf2,0x88,0x01,0x01,
+0x66,0x01,0x20,0x02,0x45,0x99,0x01,0xd0,0xff,0xff,0xf5,0xcf,0xff,0x70,0x5f,0x31,
+0xfa,0x76,0x64,0x00,0x12,0xd5,0x00,0x12,0x60,0xb3,0x00,0x24,0x21,0xf6,0xe6,0x00,
+0xe3,0xc8,0x99,0xbe,0xd0,0x1f,0x70,0x5f,0x20,0x9d,0xdd,0xca,0x83,0x01,0xf6,0x72,
+0x04,0x73,0x09,0x20,0x3d,0x10,0x00,0x00,0x22,0xc3,0x03,0x13,0x9f,0xf7,0x07,0x64,
+0x01,0x44,0x44,0x43,0x33,0x3b,0xb8,0x00,0x12,0x9f,0xc7,0x0a,0x33,0x88,0x8c,0xf0,
+0x0d,0x0e,0x1e,0xe9,0xd5,0x00,0x03,0xe4,0x0c,0xa0,0xf7,0x00,0x00,0x06,0x88,0x87,
+0x77,0x77,0x66,0x10,0x12,0x00,0x01,0x00,0xf5,0x0d,0x13,0x04,0x55,0x45,0x53,0x00,
+0x1f,0x40,0x9e,0x0f,0xff,0xff,0xfd,0x00,0x2f,0x60,0xaf,0x1f,0x71,0x11,0x00,0x00,
+0x1f,0x60,0x9f,0x1f,0x60,0x00,0x08,0x00,0xf3,0x04,0x24,0x5f,0x60,0x9f,0x1f,0xfe,
+0xee,0xf4,0xcf,0xff,0x60,0x9f,0x1f,0xb8,0x87,0x61,0x02,0x3f,0x70,0x20,0x00,0x03,
+0x08,0x00,0x11,0x0f,0x08,0x00,0x40,0x25,0x40,0x0f,0x70,0x48,0x00,0xd1,0xff,0xc0,
+0x0f,0x70,0x9e,0x03,0x66,0x65,0x31,0x00,0x0f,0x60,0x9e,0x66,0x00,0x32,0x04,0x00,
+0x24,0x6f,0x00,0xfe,0x0c,0x11,0x10,0x00,0x00,0x6f,0xff,0xff,0xff,0xff,0xf7,0x00,
+0x00,0x8f,0x76,0x55,0x55,0x55,0xfa,0x00,0x00,0x8f,0x10,0x00,0x00,0x00,0xe9,0x00,
+0x08,0x00,0x80,0x42,0x22,0x22,0x33,0xf9,0x00,0x00,0x5f,0x30,0x00,0x80,0xf6,0x00,
+0x00,0x01,0x22,0x22,0x22,0x21,0x44,0x00,0x00,0x01,0x00,0x00,0x4d,0x00,0x10,0x3f,
+0x19,0x00,0xa0,0xf9,0x00,0x00,0x00,0x05,0xf6,0x44,0x55,0x44,0x43,0x37,0x00,0x23,
+0x6f,0x20,0xd8,0x00,0x33,0x06,0xf2,0x00,0x01,0x00,0x60,0x6f,0x98,0x88,0x89,0x99,
+0x92,0x13,0x00,0x6f,0xfe,0xee,0xee,0xed,0xdc,0x30,0x26,0x00,0x03,0x14,0x5f,0x13,
+0x00,0x20,0x04,0xff,0x01,0x00,0x10,0xe3,0x56,0x00,0x52,0x77,0x77,0x76,0x66,0x53,
+0x16,0x00,0x14,0x02,0x28,0x00,0x24,0x08,0xe0,0x0a,0x00,0x14,0x9f,0x09,0x00,0x20,
+0x09,0xf0,0x06,0x00,0xe0,0x27,0x77,0x77,0x77,0xcf,0x77,0x77,0x77,0x77,0x07,0xff,
+0xff,0xee,0xef,0x44,0x00,0x26,0xd0,0x00,0x01,0x00,0x10,0xcf,0x11,0x00,0x90,0x50,
+0x00,0x00,0x00,0xfb,0x66,0x77,0x77,0x66,0xaa,0x00,0x14,0xf8,0x1b,0x00,0x50,0xf8,
+0x11,0x11,0x11,0x22,0x09,0x00,0x01,0x79,0x00,0x00,0x4e,0x01,0x50,0xfa,0x55,0x55,
+0x54,0x43,0x12,0x00,0x14,0xf7,0x24,0x00,0x50,0xfb,0x66,0x66,0x66,0x67,0x1b,0x00,
+0x61,0xbf,0xff,0xff,0xff,0xfe,0xc0,0x14,0x00,0x46,0x4f,0x40,0x00,0x00,0x09,0x00,
+0xb2,0x05,0x55,0x55,0x55,0x8f,0x85,0x55,0x55,0x53,0x5f,0xff,0x01,0x00,0x31,0xfd,
+0x01,0x11,0x01,0x00,0x00,0x72,0x01,0x23,0x10,0x00,0xc6,0x00,0x13,0xf5,0x09,0x00,
+0x24,0x03,0xf6,0x09,0x00,0x14,0xf5,0xf7,0x00,0x05,0x09,0x00,0x10,0xfa,0x6c,0x00,
+0x41,0x73,0x00,0x00,0x01,0xc5,0x00,0x27,0xf8,0x00,0x01,0x00,0x23,0x01,0x10,0x08,
+0x00,0x01,0x62,0x00,0x98,0x30,0x00,0x00,0x03,0xf8,0x55,0x55,0x55,0x54,0x48,0x00,
+0x20,0x03,0xf9,0x04,0x01,0x13,0x10,0x48,0x01,0x28,0xed,0x30,0x1b,0x00,0x10,0xf5,
+0x3b,0x00,0x00,0x87,0x00,0x01,0x3f,0x00,0x00,0xc6,0x00,0x52,0x35,0x66,0xaf,0x75,
+0x54,0x7a,0x01,0x01,0x94,0x01,0x40,0x02,0x32,0x22,0x22,0xf7,0x01,0x24,0x21,0x6f,
+0xc6,0x00,0x22,0x03,0x33,0x01,0x00,0x18,0x21,0x87,0x00,0x40,0x8c,0xee,0xec,0x81,
+0x09,0x00,0x50,0x3e,0xfa,0x76,0x7a,0xff,0xd1,0x01,0xa4,0xce,0x20,0x00,0x00,0x2e,
+0xb0,0x00,0x00,0x00,0xf9,0x90,0x01,0x05,0x09,0x00,0x05,0x1b,0x00,0x60,0x3f,0xfa,
+0x87,0x8b,0xfe,0x20,0x3f,0x00,0x40,0x8b,0xcd,0xca,0x71,0x3f,0x00,0x60,0x68,0x88,
+0x88,0x88,0x88,0x10,0xc7,0x02,0x50,0xed,0xde,0xed,0xdd,0xc3,0x80,0x00,0x14,0xf6,
+0x64,0x00,0x24,0x2f,0x60,0x34,0x01,0x10,0xfb,0x26,0x00,0x01,0x13,0x00,0x00,0x40,
+0x02,0x1f,0xc1,0x26,0x00,0x04,0x41,0xfa,0x55,0x55,0x55,0xa2,0x01,0x10,0x0d,0xb7,
+0x00,0x11,0xfc,0xa7,0x00,0x02,0xa6,0x02,0x06,0x01,0x00,0x11,0x02,0x90,0x01,0x53,
+0x22,0x23,0x33,0x07,0xff,0x01,0x00,0xa0,0xf0,0x14,0x45,0x55,0x55,0x9f,0x54,0x43,
+0x33,0x31,0x20,0x00,0x24,0x07,0xf1,0x2a,0x00,0x14,0x7f,0xb2,0x01,0x07,0x13,0x00,
+0x14,0x00,0x13,0x00,0x1d,0xf0,0x13,0x00,0x04,0xe1,0x01,0x04,0x1a,0x03,0x02,0xc4,
+0x02,0x44,0x80,0x00,0x00,0x06,0x19,0x03,0x05,0xe9,0x02,0x06,0x09,0x00,0x13,0xf8,
+0xa9,0x01,0x10,0x06,0x2c,0x00,0x2f,0xee,0x40,0x24,0x00,0x02,0x13,0xf2,0xf5,0x01,
+0x11,0x05,0x51,0x00,0xbf,0xf4,0x00,0x00,0x00,0x57,0x77,0x77,0x66,0x65,0x30,0x00,
+0x01,0x00,0x08,0x04,0xb2,0x01,0x1d,0x32,0xc4,0x01,0x12,0x31,0x4d,0x00,0x10,0x01,
+0x26,0x00,0x14,0xdf,0xed,0x02,0x13,0xfc,0x42,0x02,0x24,0x00,0xfa,0x41,0x00,0x60,
+0xfd,0x88,0x88,0x88,0x99,0x30,0x11,0x03,0x00,0xb0,0x03,0x13,0x40,0xcd,0x01,0x14,
+0x00,0x24,0x00,0x15,0x01,0x2c,0x03,0x00,0x09,0x01,0x66,0x24,0x56,0x66,0x65,0x54,
+0x20,0x7e,0x00,0x22,0x16,0x66,0x01,0x00,0x15,0x65,0x7e,0x00,0x04,0xb5,0x02,0x08,
+0x41,0x02,0x00,0x22,0x00,0x23,0x77,0x60,0xfc,0x00,0x23,0xff,0xf4,0xdc,0x02,0x06,
+0x04,0x03,0x0e,0x09,0x00,0x14,0xf4,0x09,0x00,0x14,0xf3,0x45,0x00,0x09,0x05,0x01,
+0x13,0xdf,0x11,0x03,0x11,0x02,0xe0,0x03,0x00,0xec,0x01,0x14,0xf8,0xf5,0x01,0x55,
+0xf8,0x11,0x11,0x22,0x22,0xf6,0x02,0x10,0x50,0x2c,0x02,0x00,0x95,0x01,0x00,0x12,
+0x00,0x14,0xf7,0x24,0x00,0x10,0xfc,0x90,0x00,0x10,0x50,0xae,0x02,0x00,0x8c,0x01,
+0x2e,0xb0,0x00,0x01,0x00,0x31,0x17,0x87,0x77,0x01,0x00,0x22,0x75,0x4e,0x5d,0x04,
+0x4e,0xff,0xfb,0x00,0x00,0xd8,0x00,0x14,0xf6,0x51,0x00,0x1d,0xf7,0x09,0x00,0x05,
+0x1b,0x00,0x01,0x4c,0x04,0x53,0x72,0x00,0x00,0x00,0xef,0x88,0x05,0x0a,0xe0,0x03,
+0x01,0x5f,0x01,0x13,0xef,0xab,0x00,0x23,0x01,0xfb,0x9e,0x01,0x06,0xcf,0x00,0x60,
+0xff,0xee,0xee,0xee,0xee,0x40,0xb4,0x00,0x40,0x88,0x88,0x88,0x76,0x31,0x00,0x14,
+0xf8,0x3e,0x00,0x13,0xfc,0x56,0x01,0x2b,0x00,0xbe,0xc6,0x00,0x94,0x16,0x65,0x55,
+0x54,0x44,0x44,0x55,0x56,0x65,0x9d,0x04,0x2e,0xec,0x00,0x01,0x00,0x14,0x08,0xd4,
+0x01,0x64,0x02,0x78,0x88,0x87,0x77,0x6a,0xf9,0x02,0x20,0x05,0xf1,0xb0,0x01,0x53,
+0x67,0x77,0x77,0x7a,0xf1,0x24,0x00,0x64,0xee,0xc0,0x00,0x00,0x08,0xf1,0x36,0x00,
+0x13,0xf1,0x00,0x03,0x42,0x07,0xff,0xee,0xee,0x16,0x01,0x00,0xd7,0x03,0x24,0x77,
+0x62,0x8e,0x02,0x03,0x46,0x00,0xf2,0x02,0xf0,0xae,0xee,0xee,0xee,0x30,0x00,0x6f,
+0x0e,0xd8,0x89,0x88,0x71,0x00,0x05,0xf0,0xe9,0xf6,0x05,0x22,0x0e,0x90,0x1e,0x00,
+0x0b,0x0f,0x00,0x00,0xdc,0x00,0xc2,0x20,0x00,0x5f,0x0f,0xfe,0xee,0xed,0xc3,0x00,
+0x05,0xf0,0xf9,0x1e,0x00,0x13,0x0f,0x1e,0x00,0x1e,0xf9,0x0f,0x00,0xf4,0x03,0x32,
+0x00,0x5f,0x0e,0xfd,0xdd,0xde,0xff,0xb0,0x05,0xf0,0x38,0x88,0x87,0x65,0x30,0x00,
+0x5f,0x78,0x00,0x03,0x5f,0x06,0x0f,0x0f,0x00,0x02,0x2b,0x03,0xd0,0x04,0x01,0xe0,
+0x40,0x06,0x88,0x88,0x88,0x80,0x00,0x05,0xf2,0x0f,0xfe,0xef,0xee,0xc1,0x08,0x00,
+0x11,0x70,0x37,0x00,0x2c,0xf2,0x1f,0x08,0x00,0x40,0xff,0xff,0xff,0xf2,0x08,0x00,
+0x4f,0xa7,0x77,0x65,0x40,0x20,0x00,0x01,0xe3,0xb7,0x77,0x89,0xad,0x80,0x05,0xf2,
+0x0a,0xee,0xee,0xdc,0xb9,0x30,0x05,0x2e,0x01,0x04,0x08,0x00,0x70,0x01,0x80,0x00,
+0x00,0x12,0x22,0x22,0x97,0x02,0x02,0x8b,0x04,0x98,0xe0,0x00,0x01,0x54,0x44,0x44,
+0x44,0x3a,0xf1,0x55,0x01,0x06,0x6b,0x04,0x04,0x08,0x00,0x1b,0x08,0x08,0x00,0x23,
+0x02,0x50,0x50,0x00,0x04,0x08,0x00,0x01,0x2a,0x00,0x11,0x2f,0x52,0x00,0x00,0x0a,
+0x00,0x61,0x06,0x77,0x76,0x66,0x65,0x20,0xc4,0x04,0x42,0x05,0x00,0x02,0x70,0xce,
+0x04,0x66,0x5f,0x10,0x07,0xf0,0x00,0x06,0x0a,0x00,0x1d,0xf2,0x0a,0x00,0x00,0x9c,
+0x04,0x13,0x70,0x0a,0x00,0x39,0xff,0xff,0xe2,0x32,0x00,0x16,0x08,0x0a,0x00,0x12,
+0xe0,0x0a,0x00,0x63,0x4f,0x10,0x09,0xe0,0x00,0x05,0x0a,0x00,0x20,0xd0,0x10,0x0a,
+0x00,0x11,0x4f,0x21,0x03,0x00,0x0a,0x00,0x75,0x16,0x77,0x66,0x66,0x65,0x41,0x05,
+0x46,0x05,0x07,0x0a,0x00,0x1f,0xf2,0x0a,0x00,0x09,0x2e,0x03,0xf1,0xa1,0x02,0xb3,
+0x02,0x40,0x00,0x00,0x55,0x55,0x55,0x56,0x63,0x00,0x9e,0xe5,0x00,0xb0,0x90,0x0a,
+0xe0,0x00,0x00,0x01,0x21,0x10,0x21,0x00,0x00,0xe8,0x08,0x70,0x6e,0x00,0x0d,0x80,
+0x00,0x09,0xe0,0x20,0x01,0x00,0xc0,0x08,0xf0,0x0c,0x9f,0x10,0x10,0x00,0x8f,0x00,
+0x0e,0x80,0x00,0x09,0xff,0xff,0xc0,0x08,0xf0,0x00,0xe8,0x00,0x00,0x9f,0x66,0x63,
+0x00,0x7f,0x00,0x0e,0x70,0x47,0x08,0x00,0x2c,0x01,0x70,0xf7,0x22,0x00,0x8e,0x00,
+0x00,0x2e,0x4c,0x00,0x10,0xf1,0x13,0x00,0x75,0x66,0x66,0x65,0x54,0x31,0x00,0x8e,
+0x90,0x03,0x11,0x40,0x3c,0x09,0x03,0x80,0x08,0x20,0x03,0xf3,0x93,0x05,0x10,0xf0,
+0xe9,0x00,0x13,0x30,0xfe,0x05,0x61,0x04,0xf4,0x21,0x11,0x11,0x28,0x13,0x00,0x01,
+0xc8,0x01,0x00,0x13,0x00,0x5a,0xf7,0x66,0x66,0x55,0x5a,0x26,0x00,0x14,0xf3,0xb9,
+0x08,0x11,0x3f,0x12,0x05,0x00,0x51,0x00,0x67,0x45,0x55,0x55,0x55,0x55,0x10,0x7a,
+0x02,0x02,0xde,0x04,0xd0,0xf0,0x06,0xf1,0x0b,0xee,0xdd,0xdd,0xed,0x16,0xf1,0x06,
+0xf1,0x06,0xe1,0x03,0x91,0x06,0xf0,0x06,0xf1,0x00,0x04,0x00,0x03,0x00,0x09,0x00,
 0x4f,0x3f,0x30,0x1f,0x60,0x09,0x00,0x05,0x61,0x20,0x1f,0x60,0x06,0xf6,0x59,0x09,
 0x00,0x43,0x50,0x06,0xff,0xff,0x09,0x00,0x02,0x1b,0x00,0x23,0x2f,0x50,0x2d,0x00,
-0x33,0x2f,0x50,0x05,0x09,0x00,0x12,0x40,0x09,0x00,0x62,0x41,0x4f,0x53,0x15,0xf0,
-0x06,0xbe,0x0e,0x10,0x85,0x8f,0x91,0x54,0x44,0x44,0x43,0x31,0x05,0xe7,0xc6,0x05,
-0x09,0x00,0x1f,0x06,0x09,0x00,0x07,0x2d,0x03,0xb0,0xe7,0x1b,0x30,0x02,0x70,0x49,
-0x44,0x06,0x80,0x10,0x07,0xf1,0x8d,0xee,0xdd,0xdd,0xcb,0xf4,0x2f,0x10,0x10,0x48,
-0x01,0x00,0xc9,0x6f,0x00,0x1d,0x9a,0x01,0x08,0x00,0x41,0x4f,0x20,0x66,0x6a,0x08,
-0x00,0x32,0x21,0xef,0xff,0x10,0x00,0x02,0x18,0x00,0x21,0x5f,0x10,0xa6,0x33,0x52,
-0x11,0x6f,0x34,0x20,0x07,0xe0,0x64,0xa7,0x90,0x07,0xf0,0x24,0x44,0x44,0x33,0x21,
-0x00,0x07,0x19,0xb0,0x03,0x30,0x6c,0x1f,0x05,0x30,0x6c,0x04,0x13,0x03,0x03,0x0a,
-0x22,0x06,0xfa,0x30,0x6c,0x27,0x06,0xf3,0xfa,0x19,0x00,0x8e,0x00,0x0e,0x30,0x6c,
-0x00,0x48,0x03,0x11,0x25,0x7a,0x7c,0x30,0x06,0xf1,0xaf,0xe8,0x09,0x71,0x20,0x06,
-0xf1,0x01,0x11,0x11,0x01,0xb8,0x00,0x17,0xd5,0xb8,0x00,0x03,0x08,0x00,0x23,0x22,
-0xff,0xb8,0x00,0x21,0x67,0x7a,0x08,0x00,0x02,0xb8,0x00,0x02,0xc0,0x00,0x61,0x25,
-0xfa,0x55,0x9f,0x78,0x50,0x48,0x00,0x4e,0xfe,0xed,0x60,0x06,0xcf,0xbd,0x02,0xe1,
-0x18,0x12,0x40,0x2b,0x08,0x13,0xef,0xe9,0x7f,0x2f,0x09,0xf0,0x08,0x00,0x04,0x42,
-0xe0,0x00,0x04,0xf7,0x89,0xb1,0x2e,0x01,0xff,0x89,0xb1,0x06,0xd9,0x40,0x20,0xe5,
-0x05,0x63,0xb3,0x42,0xde,0xeb,0x00,0xf6,0x3f,0x02,0x11,0x74,0xa3,0xe1,0x10,0x04,
-0x7c,0x01,0x12,0xf7,0x2d,0x02,0x13,0x50,0x09,0x00,0x1c,0x2f,0x09,0x00,0x43,0x20,
-0x2f,0x52,0x66,0x09,0x00,0x23,0x59,0xff,0x09,0x00,0x2a,0x40,0x00,0x09,0x00,0x25,
-0x30,0x3f,0x09,0x00,0x11,0x30,0x65,0x1e,0x63,0x3f,0x41,0x5f,0x53,0x00,0xf7,0xfd,
-0x10,0x32,0x60,0xf6,0x05,0x3f,0x02,0x24,0x00,0xf6,0xe7,0x03,0x0e,0x09,0x00,0x33,
-0xf5,0x05,0xf2,0x8d,0xbb,0x04,0xed,0x03,0x1f,0xa2,0xb3,0x93,0x01,0x81,0x04,0x55,
-0x55,0x56,0x64,0x00,0xe5,0x04,0xcb,0xe1,0x10,0xfb,0x71,0xe3,0x51,0x00,0x13,0x10,
-0x02,0x00,0x09,0x00,0x41,0x2f,0x30,0x0f,0x50,0x09,0x00,0x53,0x3f,0x40,0x1f,0x50,
-0x11,0x09,0x00,0x10,0x5c,0x0d,0xfe,0x00,0x09,0x00,0x23,0x52,0x55,0x09,0x00,0x40,
-0x40,0x00,0xf8,0x03,0x99,0x81,0x20,0x2f,0x30,0x09,0x00,0x71,0x05,0x7f,0x96,0x8f,
-0xa9,0x40,0xf8,0xea,0xb0,0x44,0xee,0xdc,0x40,0xf8,0x48,0x08,0x34,0xe7,0x04,0xf3,
-0x6f,0x83,0x10,0x60,0xd5,0x29,0x03,0x8e,0xa6,0x14,0x0c,0xad,0x11,0x19,0x02,0xea,
-0x0d,0x0f,0xc4,0x35,0x24,0x40,0x13,0x33,0x33,0x33,0xde,0xf7,0x11,0xaf,0x13,0x7a,
-0x61,0x06,0xf2,0x02,0x22,0x11,0x12,0xde,0x09,0x00,0x56,0x02,0x31,0x9c,0xcd,0xf2,
-0x46,0x02,0x32,0x69,0x9b,0xf2,0x5e,0x02,0x18,0x05,0x08,0x00,0x42,0x5f,0x20,0x6a,
-0xac,0x16,0x03,0x21,0x8b,0xbd,0x08,0x00,0x00,0x8e,0x02,0x40,0x8d,0xfe,0xdd,0xef,
-0x8d,0xca,0x6f,0x58,0x88,0x88,0x77,0x65,0x10,0x96,0x76,0x0d,0x2f,0x02,0x70,0x96,
-0x76,0x23,0x22,0x01,0x40,0x0e,0x03,0x22,0x07,0xf0,0x0e,0x03,0x21,0x07,0xf0,0x0e,
-0x03,0x80,0x01,0x18,0xf0,0x00,0xb4,0x00,0x3f,0x20,0x67,0x32,0x00,0xa8,0x00,0x32,
-0x35,0x5a,0xf0,0xb0,0x00,0x13,0x07,0x08,0x00,0x21,0x08,0xf0,0x0e,0x03,0x00,0x20,
-0x00,0x00,0x0e,0x03,0x41,0x46,0x6b,0xf0,0x35,0x0e,0x03,0x30,0x08,0xf0,0xbf,0xfc,
-0x2b,0x1f,0x60,0xb5,0xbe,0x04,0x19,0xb9,0xb5,0xbe,0x12,0x80,0xf4,0xc6,0x13,0xed,
-0x5a,0x01,0x13,0xfa,0x8c,0x0b,0x1f,0xec,0xf4,0xc6,0x07,0x2d,0xba,0x60,0x11,0x0a,
-0x22,0xff,0x60,0x9d,0x18,0x03,0x69,0x2a,0x14,0x01,0x65,0x8d,0x04,0x0a,0xd6,0x13,
-0x00,0x3c,0xce,0x02,0x55,0x00,0x15,0x06,0x13,0x00,0x1a,0x6f,0x13,0x00,0x50,0x66,
-0xbf,0x66,0x66,0xaf,0xd4,0x64,0x11,0x2f,0x9d,0x43,0x1b,0xeb,0xad,0x02,0x1f,0x5c,
-0xc2,0x52,0x08,0x02,0x16,0x02,0x1e,0x6e,0xf2,0x91,0x02,0x2d,0x0c,0x00,0x1e,0x66,
-0x14,0x0d,0x6b,0x02,0x11,0x03,0xfa,0x28,0x01,0xa4,0x2b,0x13,0x70,0x49,0x9b,0x23,
-0x0a,0xd0,0x8c,0x28,0x04,0x09,0x00,0xfd,0x01,0x06,0x7d,0xe7,0x77,0x7f,0xc9,0x92,
-0x00,0x00,0x1e,0xee,0xee,0xff,0xed,0xdc,0xb2,0xa1,0x6d,0x00,0x84,0x75,0x02,0xa1,
-0x6d,0x13,0xfc,0xf1,0xa8,0x0f,0xa1,0x6d,0x4a,0x29,0x01,0x78,0xbf,0xc3,0x05,0xa3,
-0x12,0x19,0xf6,0x79,0x01,0x13,0x10,0xae,0x0b,0x00,0x33,0x08,0x19,0xf0,0x5b,0x01,
-0x0f,0x09,0x00,0x07,0x73,0x05,0x6b,0xf6,0x66,0x6a,0xf7,0x77,0xea,0x07,0x02,0x75,
-0x01,0x13,0x20,0xa7,0xa1,0x04,0xe0,0x77,0x09,0xa0,0xc4,0x06,0x09,0x00,0x1a,0xf0,
-0x3d,0xf8,0x0d,0xdb,0x38,0x11,0xde,0xd3,0x38,0x00,0x1c,0x02,0x01,0x8f,0x01,0x13,
-0x62,0x14,0x1a,0x1b,0x15,0x1c,0x02,0x15,0x9e,0x1c,0x02,0x04,0xb7,0x00,0x02,0x29,
-0xbf,0x00,0x48,0x01,0x64,0x3a,0xf3,0x33,0x39,0xf4,0x54,0xa8,0x2d,0x04,0xc6,0xe9,
-0x0e,0xd6,0xc6,0x0f,0x3e,0x90,0x3a,0x1f,0x00,0x3e,0x90,0x08,0x07,0x93,0x30,0x01,
-0x09,0x0d,0x25,0x17,0x77,0xc9,0xfa,0x14,0x22,0x4a,0xd6,0x24,0x0c,0xa0,0xb4,0xae,
-0x13,0xdb,0x77,0x84,0x00,0x03,0x22,0x1f,0x0a,0x13,0x00,0x04,0x70,0x01,0x55,0xdc,
-0x55,0x55,0xce,0x67,0x7f,0x71,0x0f,0x01,0x20,0x06,0x0f,0x3f,0x71,0x02,0x02,0x65,
-0xdd,0x08,0xe8,0xab,0x23,0x00,0x32,0xa9,0x8e,0x13,0x10,0xf7,0x02,0x05,0x73,0xab,
-0x03,0xf7,0x02,0x21,0x47,0x53,0x26,0x2e,0x13,0xc0,0xba,0x1f,0x2b,0x0a,0xc0,0xf7,
-0x02,0x20,0x0d,0xef,0x3f,0x1c,0x14,0xf4,0x8c,0xa7,0x17,0x40,0xf2,0x00,0x12,0x32,
-0x8f,0x60,0x15,0x32,0x76,0xe3,0x22,0x02,0x22,0xad,0x41,0x17,0x10,0x17,0x33,0x00,
-0xa8,0x20,0x24,0x9b,0xb0,0xa8,0x20,0x0e,0x04,0xfe,0x0f,0x98,0x70,0x29,0x04,0x08,
-0x46,0x51,0x01,0x00,0x09,0xd0,0xbf,0xf8,0x0f,0x30,0x09,0xe0,0x47,0xf7,0x0a,0x00,
-0x22,0x0b,0x10,0x41,0x7c,0xf1,0x01,0x11,0x05,0x22,0x0f,0x60,0x08,0x00,0x1e,0x1f,
-0x08,0x00,0x1f,0x07,0x08,0x00,0x02,0x1a,0x50,0x08,0x00,0x21,0x2f,0x50,0xb1,0x0a,
-0x11,0x00,0xdb,0xaa,0xee,0x9d,0xfe,0xdd,0xdf,0xee,0xf1,0x07,0xf0,0x58,0x99,0x88,
-0x88,0x77,0x40,0xd2,0x32,0x0e,0x08,0x00,0x0e,0x38,0x02,0x06,0x99,0x06,0x22,0x06,
-0xf0,0x99,0x06,0x22,0x07,0xf1,0x99,0x06,0x1e,0x07,0xef,0x08,0x0e,0x08,0x00,0x17,
-0x5f,0xaf,0x09,0x13,0xf0,0x99,0x06,0x11,0xf0,0x99,0x06,0x31,0xe0,0x06,0xf0,0x99,
-0x06,0x1c,0x20,0x36,0xc7,0x0c,0xe8,0xbb,0x1f,0x04,0xe8,0xbb,0x26,0x0f,0x5f,0x0a,
-0x12,0x0e,0xb8,0x00,0x09,0x5f,0x0a,0x23,0x33,0x30,0x5f,0x0a,0x12,0xd0,0x5f,0x0a,
-0x1f,0x22,0x5f,0x0a,0x4e,0x2a,0x00,0x40,0x5f,0x0a,0x10,0x07,0x5f,0x0a,0x02,0xe3,
-0x03,0x31,0xb4,0x00,0x2e,0x00,0x58,0x02,0x49,0x07,0x0f,0x08,0x00,0x02,0x01,0x20,
-0x00,0x01,0x5f,0x0a,0x21,0x07,0xf0,0x5f,0x0a,0x31,0x70,0x07,0xf0,0x5f,0x0a,0x1f,
-0x90,0x06,0xc6,0x12,0x12,0x80,0xfe,0xa6,0x08,0x51,0x07,0x00,0xf1,0x0d,0x1f,0xec,
-0x06,0xc6,0x11,0x10,0x20,0x36,0x45,0x32,0xa8,0x66,0x40,0xe2,0x06,0x4b,0x18,0xbd,
-0xde,0xb0,0x4a,0x89,0x10,0x36,0xf2,0x11,0x11,0x51,0xfa,0x3a,0x00,0xaf,0x21,0x01,
-0xdf,0x17,0x07,0xbf,0x04,0x33,0x01,0x9c,0xc8,0xd7,0xf7,0x42,0x1d,0xe8,0x8e,0xe1,
-0x0a,0x00,0x42,0x8f,0x30,0x01,0xe9,0x0a,0x00,0x00,0x7d,0x41,0x00,0x08,0x0f,0x30,
-0xf1,0x01,0xf5,0x9a,0x0f,0x41,0x07,0xf7,0x66,0x50,0xf2,0x9b,0x01,0xb9,0x0e,0x20,
-0x02,0xf4,0x6c,0x0e,0x13,0x06,0x64,0x70,0x12,0x9e,0x73,0x0e,0x43,0xae,0x10,0x02,
-0xf9,0x53,0x3c,0x00,0x50,0x00,0x02,0xf9,0x3b,0x00,0x0d,0x7d,0x06,0x36,0x49,0x0f,
-0x0a,0x00,0x0b,0x29,0x05,0xf1,0xbb,0x13,0x60,0x0b,0x97,0x66,0x20,0x00,0x04,0x56,
-0x04,0x36,0x8a,0xdd,0xd6,0x2b,0x35,0x00,0x2e,0x05,0x10,0x06,0x4b,0x54,0x33,0xc9,
-0x00,0xbd,0x6d,0x25,0x11,0x50,0xfb,0x22,0x32,0x16,0x98,0x40,0xc0,0x51,0x41,0x3e,
-0xea,0xcf,0x80,0x5d,0x19,0x20,0x0e,0xb0,0x24,0x24,0x41,0xaf,0xaa,0xa6,0x04,0xe1,
-0x4e,0x60,0x0a,0xfe,0xee,0xa0,0x5f,0x10,0x3b,0x27,0x11,0xad,0xc3,0x00,0x21,0x02,
-0xf5,0x26,0x00,0x42,0x0b,0xe5,0x24,0xce,0x53,0xc5,0x43,0x1b,0xff,0xfc,0x30,0x96,
-0x19,0x12,0x20,0xbc,0x51,0x08,0x6c,0x98,0x00,0x22,0x08,0x11,0x72,0x4a,0x40,0x00,
-0x4e,0x01,0x1d,0xa0,0x09,0x76,0x0f,0x45,0xaa,0x0a,0x28,0xe9,0x00,0x53,0xf7,0x24,
-0x02,0x10,0xf7,0x56,0x33,0xff,0xfd,0xd6,0x80,0x5a,0x31,0x35,0x55,0x10,0x93,0x78,
-0x00,0xa2,0x47,0x11,0x31,0x5f,0x21,0x01,0x10,0x16,0x19,0x0a,0xa6,0xb9,0x33,0x07,
-0xdf,0xe8,0x19,0x98,0x21,0xf9,0x57,0x05,0x86,0x00,0x69,0x12,0x20,0x06,0xf2,0x5e,
-0x5f,0x31,0x50,0x3f,0x30,0x3f,0xc6,0x41,0xff,0xfb,0x03,0xf2,0xba,0x8b,0x02,0x94,
-0xd5,0x21,0x3f,0x40,0x94,0x17,0x40,0xae,0x30,0x2d,0xd0,0x13,0x00,0x00,0x5c,0x38,
-0x13,0xd2,0x94,0x08,0x2d,0x24,0x20,0x05,0xba,0x14,0xd8,0x97,0x1a,0x01,0xc7,0x11,
-0x1f,0x58,0x1a,0xfb,0x04,0x10,0xfb,0xa3,0x6d,0x15,0x30,0x2f,0x06,0x12,0x20,0x68,
-0xe9,0x02,0x7c,0x66,0x10,0x1b,0xb6,0x01,0x01,0x53,0x25,0x10,0x8b,0xb6,0x01,0x17,
-0x9e,0xcb,0x59,0x12,0x07,0xa2,0x13,0x13,0xae,0x64,0x27,0x11,0x30,0x7c,0x00,0x32,
-0x39,0xba,0x50,0x26,0x00,0x41,0x6f,0xd9,0xbf,0x90,0xc8,0x00,0x50,0x1f,0xa0,0x00,
-0x6f,0x30,0xc8,0x00,0x15,0x05,0xc8,0x00,0x00,0xb6,0x01,0x01,0xe5,0x85,0x00,0xc0,
-0x6c,0x12,0xf4,0xb4,0xac,0x32,0xfa,0x79,0xfb,0x65,0x09,0x37,0x05,0xbd,0xb6,0x1c,
-0x2a,0x03,0xb8,0x3c,0x04,0x7c,0xe5,0x00,0x9f,0x1d,0x29,0x76,0xcf,0xf9,0x09,0x23,
-0x16,0x77,0x53,0x22,0x05,0xb3,0x60,0x06,0x68,0xae,0x06,0x4e,0x5a,0x20,0x8f,0xed,
-0x30,0x4c,0x18,0x60,0x4d,0x5a,0x42,0x0a,0x86,0x55,0x10,0x57,0x06,0x37,0x9c,0xef,
-0xe7,0x36,0x5c,0x04,0xdb,0x00,0x33,0xeb,0x00,0xae,0x2d,0x33,0x11,0x30,0xb6,0x01,
-0x33,0x17,0xa9,0x40,0xad,0x88,0x30,0xfc,0xdf,0x80,0x2f,0xaa,0x31,0x40,0x0e,0xc0,
-0x0b,0x76,0x41,0xff,0xfc,0x04,0xf3,0x9c,0x44,0x32,0xe1,0x11,0x00,0x91,0x02,0x14,
-0x9e,0x91,0x02,0x10,0x09,0x88,0x5b,0x41,0xd3,0x12,0xbf,0x10,0x39,0x00,0x10,0x1c,
-0x37,0x64,0x11,0x09,0x5a,0x68,0x18,0x31,0x41,0x5e,0x02,0xae,0x3d,0x04,0x54,0x17,
-0x20,0x04,0xfa,0xfa,0x89,0x18,0xf0,0x60,0xf7,0x01,0x7d,0x37,0x02,0x07,0x3f,0x05,
-0x13,0x00,0x22,0xf7,0x32,0x02,0x1e,0x07,0xf0,0x10,0x14,0x24,0xc6,0x65,0x02,0xdb,
-0x00,0x14,0x40,0xdb,0x00,0x1e,0xae,0xdb,0x00,0x14,0x9e,0xdb,0x00,0x1a,0x09,0xdb,
-0x00,0x10,0xeb,0xdb,0x00,0x3c,0xf2,0x22,0x00,0xdb,0x00,0x3f,0xf5,0x54,0x20,0xdb,
-0x00,0x0f,0x15,0x08,0xdb,0x00,0x15,0x24,0xa9,0x10,0x14,0x40,0xe6,0xfa,0x14,0x6f,
-0x9c,0x19,0x11,0x06,0x8c,0x3a,0x00,0x60,0x4d,0x11,0xff,0x55,0x18,0x00,0x05,0x9d,
-0x14,0xf0,0xb7,0x68,0x14,0x7f,0x26,0x00,0x11,0x07,0x78,0xa7,0x05,0xdb,0x00,0x14,
-0x34,0xcb,0x11,0x16,0x1a,0xb6,0x01,0x27,0xee,0xe6,0xdb,0x00,0x1e,0x09,0xdb,0x00,
-0x01,0x1f,0x02,0x32,0x04,0x65,0x10,0xc7,0x1a,0x40,0x4e,0xfe,0xff,0x50,0x6c,0xca,
-0x50,0x20,0x0e,0xb1,0x00,0xaf,0x4f,0x82,0x31,0xfd,0x03,0xf3,0xc8,0x00,0x50,0xf3,
-0x33,0x10,0x4f,0x20,0x91,0x02,0x11,0x9e,0x7b,0x00,0x22,0x03,0xf4,0xdb,0x00,0x33,
-0xd4,0x24,0xdd,0x37,0xdd,0x33,0xff,0xfc,0x20,0x59,0x03,0x15,0x21,0xe5,0xab,0x34,
-0x03,0x45,0x43,0x7a,0x35,0x03,0xd1,0x74,0x64,0x6f,0xb3,0x00,0x03,0x9f,0x80,0x49,
-0x89,0x01,0x98,0x00,0x04,0x45,0xd4,0x02,0xd2,0x33,0x11,0x9f,0xf9,0x0c,0x52,0x81,
-0x00,0x01,0x8f,0xa0,0x07,0x9f,0x32,0xde,0xff,0xa1,0x91,0x35,0x39,0x67,0x64,0x10,
-0x40,0x51,0xf3,0x00,0x7e,0xb9,0x87,0x00,0x04,0xe0,0x03,0xf2,0x00,0x17,0x9b,0xbb,
-0x00,0x06,0xf0,0x89,0x45,0x00,0x09,0x00,0x01,0x86,0x4c,0x00,0x09,0x00,0x68,0x5c,
-0xcc,0xcc,0xcc,0xcc,0x16,0x1b,0x00,0x60,0x00,0x04,0xbd,0xb3,0x00,0x05,0x09,0x00,
-0x41,0x5f,0xb7,0xcf,0x30,0x09,0x00,0x70,0xcc,0x00,0x0d,0xb0,0x05,0xf0,0x04,0x2d,
-0xcc,0x10,0x07,0xfc,0x3e,0x10,0xf2,0x99,0xa2,0x40,0xf1,0x05,0xf6,0x69,0x09,0x00,
-0x20,0x04,0xf2,0x1b,0x00,0x01,0x12,0xb5,0x01,0x2d,0x00,0x41,0xf8,0x00,0x0a,0xe0,
-0x09,0x00,0x41,0x9f,0x41,0x6f,0x80,0x09,0x00,0x32,0x0b,0xff,0xfa,0x51,0x00,0x00,
-0x5b,0x04,0x14,0x05,0x6c,0x00,0x14,0x05,0x04,0x5c,0x0e,0x09,0x00,0x46,0x02,0xa0,
-0x02,0xf2,0xf3,0x05,0x31,0x69,0x75,0x51,0x9c,0x16,0x83,0x05,0xbd,0xfe,0x60,0x04,
-0xd1,0x03,0xf3,0x34,0x36,0x20,0x3f,0x4c,0xcd,0x03,0x40,0x75,0xf3,0x03,0xf4,0x2f,
-0xc2,0x20,0x52,0x5f,0xf0,0x10,0xf0,0x0b,0x47,0x73,0x00,0x05,0xf3,0x02,0xf4,0x00,
-0xaf,0xff,0xf8,0x00,0x5f,0x97,0x9f,0x40,0x6f,0x60,0x09,0xf3,0x05,0xff,0xff,0xf4,
-0x0c,0xb0,0x3e,0x1e,0x70,0x30,0x2f,0x40,0xca,0x00,0x00,0xe8,0x22,0x00,0xe0,0x09,
-0xd0,0x00,0x2f,0x50,0x5f,0x20,0x2f,0x40,0x2f,0xc7,0x7e,0xc0,0x05,0xc7,0x00,0x74,
-0x3a,0xdc,0x80,0x00,0x4e,0x10,0x3f,0xa9,0x18,0x1b,0x91,0xad,0xa5,0x13,0xe6,0xad,
-0xa5,0x23,0x3c,0xf5,0xac,0x99,0x23,0x0d,0xc0,0x51,0x35,0x02,0x6d,0x05,0x02,0x23,
-0x59,0x01,0xad,0xa5,0x18,0xf8,0x20,0x4c,0x03,0xad,0xa5,0x16,0x1a,0x49,0x03,0x2a,
-0xee,0xe6,0x65,0xa0,0xf1,0x02,0x05,0xcc,0xcc,0xcc,0xbb,0xb8,0x00,0x9f,0x33,0x41,
-0x39,0x98,0x88,0x88,0x89,0x70,0x09,0x54,0x44,0x01,0x6e,0x02,0x23,0x32,0x20,0x6e,
-0x02,0x00,0x7f,0xa6,0x00,0x6e,0x02,0x00,0xd9,0x04,0x02,0x6e,0x02,0x41,0x08,0xe2,
-0x22,0x00,0x6e,0x02,0x00,0x6c,0xf8,0x02,0x6e,0x02,0x33,0x08,0xf4,0x43,0x6e,0x02,
-0x1e,0x8e,0x6e,0x02,0x1f,0x7d,0x6e,0x02,0x4b,0x00,0xd2,0x09,0x40,0xad,0xb9,0x88,
-0x20,0xeb,0x9d,0x40,0x03,0x8a,0xbb,0xb4,0x60,0x16,0x04,0xfc,0x9d,0x10,0x07,0x14,
-0x1c,0x40,0x75,0x00,0x4f,0x11,0x6b,0x02,0x16,0xcd,0x81,0x14,0x00,0xd1,0x57,0x21,
-0xbd,0xb5,0x1e,0x9e,0x41,0x06,0xfb,0x7a,0xf8,0x11,0x00,0x10,0xea,0xef,0x30,0x20,
-0x04,0xf1,0xe1,0x1c,0x50,0x0f,0x72,0x55,0x8f,0x10,0x59,0x5b,0x60,0xc9,0x9f,0xff,
-0xf1,0x00,0xac,0x12,0x0d,0x21,0x11,0x5f,0x11,0x00,0x20,0xda,0x00,0xe2,0x57,0x10,
-0x10,0xb7,0x2e,0x10,0x4f,0x45,0x85,0x21,0x0a,0xf1,0x44,0x00,0x31,0xfc,0x9c,0xf6,
-0x44,0x00,0x37,0x03,0x9b,0x93,0x73,0x9e,0x06,0x88,0x00,0x0b,0x11,0x00,0x62,0x02,
-0xd0,0x00,0x06,0xa7,0x55,0x0a,0xaf,0x37,0x5b,0xde,0xed,0x72,0x08,0x31,0x6f,0x20,
-0xdf,0xa1,0xb8,0x21,0x06,0xf2,0x6c,0x59,0x11,0x50,0xb4,0x95,0x21,0x66,0x30,0x84,
-0x09,0x11,0x06,0xf8,0x2a,0xa0,0x6f,0x20,0x03,0xf7,0x00,0x5f,0x60,0x34,0x48,0xf2,
-0xef,0x05,0x70,0xac,0x0e,0xff,0xff,0x20,0x0c,0xa0,0x28,0x28,0x20,0x27,0xf1,0x6a,
-0xa7,0x11,0x9d,0x8f,0xd0,0x13,0xf1,0x51,0xcf,0x41,0x0c,0xe8,0x7d,0xf2,0xc7,0x2a,
-0x37,0x08,0xdd,0xa2,0x28,0x2a,0x25,0x02,0x00,0xdf,0xe5,0x24,0x00,0x5f,0x8d,0x71,
-0x13,0xf3,0x8e,0x06,0x01,0x13,0x39,0x18,0x9f,0x11,0x00,0x40,0x62,0x22,0x22,0x22,
-0x17,0x64,0x05,0xd4,0xed,0x30,0x23,0x33,0x32,0x37,0x0d,0x0e,0xc4,0x00,0x03,0x93,
-0x0e,0x01,0xec,0x06,0x32,0x40,0x07,0xf1,0x32,0x8e,0x00,0x30,0x01,0x31,0x02,0x56,
-0x30,0xda,0x01,0x40,0x09,0xff,0xef,0xc1,0x22,0x00,0x80,0x06,0xf5,0x00,0x3f,0x90,
-0x23,0x38,0xf1,0x44,0x09,0x51,0x9d,0x0e,0xff,0xff,0x10,0xc4,0x00,0x50,0x13,0x39,
-0xf1,0x00,0xad,0x58,0x09,0x00,0xcd,0x47,0x41,0xf9,0x32,0x7f,0x60,0x9a,0x87,0x32,
-0xdf,0xff,0x80,0x55,0x05,0x15,0x11,0xc4,0x6d,0x12,0x35,0x12,0xfd,0x31,0x04,0xef,
-0xfe,0x58,0x20,0x63,0x03,0xfd,0x40,0x00,0x28,0xf9,0xbf,0xd6,0x23,0x08,0xf1,0xc5,
-0x30,0x00,0x58,0x17,0x13,0xdd,0xdb,0x39,0x20,0x08,0xf6,0x54,0xec,0x00,0xdc,0x0e,
-0x31,0xfc,0x87,0x8b,0x2e,0x45,0xa0,0x06,0xac,0xdc,0xa7,0x10,0x00,0x00,0x7b,0x86,
-0x61,0x47,0x14,0x93,0x00,0x03,0x9c,0xdc,0x40,0x00,0x7d,0x03,0xf4,0x1b,0x03,0x01,
-0xe2,0x03,0xf0,0x22,0xff,0x40,0x8e,0x03,0xf4,0x24,0x44,0x44,0x44,0x40,0x08,0xe0,
-0x2f,0x40,0x01,0x8b,0xb7,0x00,0x00,0x8e,0x02,0xf4,0x02,0xed,0x89,0xfc,0x01,0x29,
-0xe0,0x2f,0x40,0x9e,0x00,0x04,0xf5,0xff,0xfe,0x02,0xf4,0x0d,0xa0,0x00,0x0f,0x82,
-0x4a,0xe0,0x2f,0x50,0xbb,0x7c,0x0a,0xf0,0x01,0x8e,0x03,0xf4,0x07,0xf4,0x00,0x8f,
-0x30,0x08,0xe0,0x3f,0x40,0x0a,0xfe,0xff,0x60,0x11,0x00,0x96,0x00,0x02,0x55,0x10,
-0x00,0x06,0xc0,0x2f,0x30,0x4c,0x0a,0x12,0x4e,0xe9,0x05,0x01,0x88,0x01,0x26,0x76,
-0x6b,0xf9,0x7a,0x00,0x5c,0x18,0x02,0xca,0x50,0x13,0x6f,0x4d,0x07,0x05,0xda,0x3e,
-0x0a,0x26,0x73,0x14,0xf9,0x26,0x73,0x50,0x20,0x00,0x25,0x31,0x10,0x34,0x2e,0x00,
-0x9f,0x09,0x02,0x63,0x07,0x20,0x12,0x21,0x08,0x00,0x11,0x35,0x14,0x1c,0x12,0x08,
-0xd7,0x40,0x17,0x30,0x14,0x1a,0xf2,0x02,0x07,0xce,0xc4,0x00,0x57,0x7b,0xf0,0x00,
-0xbe,0x86,0xcf,0x30,0xef,0xff,0xf0,0x05,0xf3,0x31,0x6a,0x01,0x09,0x85,0x00,0x08,
-0x00,0x12,0xc0,0x31,0x6a,0x10,0x08,0x10,0x00,0x40,0x89,0x9c,0xf0,0x04,0x20,0x00,
-0x81,0xac,0xce,0xe0,0x00,0xbf,0x87,0xcf,0x30,0xa5,0x06,0x39,0xcc,0xa2,0x00,0xa5,
-0xb9,0x17,0x51,0x9d,0xb9,0x26,0x04,0x70,0xe6,0x36,0x03,0xb5,0x1c,0x01,0xea,0x25,
-0x23,0x34,0x41,0x0e,0x1e,0x10,0xf7,0xe5,0x07,0x10,0x44,0x9b,0x09,0x31,0x5a,0x75,
-0x54,0x3c,0x19,0x37,0x5b,0xde,0xfd,0xfd,0x0d,0x23,0xf1,0xcf,0xf5,0x0c,0x01,0x8b,
-0xc7,0x01,0x0f,0x04,0xf0,0x04,0x24,0x10,0x00,0x45,0x5a,0xf1,0x00,0x4e,0xff,0xf8,
-0x00,0xdf,0xff,0xf1,0x02,0xfa,0x21,0x6f,0x50,0x50,0xa2,0x12,0xe0,0xbc,0x85,0x11,
-0x0b,0x14,0x42,0x30,0x07,0xf0,0x0a,0x45,0xb6,0x20,0xdf,0xff,0x47,0x73,0x82,0x0e,
-0xa0,0x46,0x6a,0xf0,0x00,0xce,0x88,0x27,0x42,0x36,0x07,0xcc,0x91,0x60,0x00,0x20,
-0x04,0xa0,0x56,0xaf,0x34,0xef,0xed,0x92,0x98,0x20,0x12,0x40,0x7c,0x20,0x26,0x1d,
-0xd0,0xdc,0x53,0x03,0xdb,0x53,0x00,0x7c,0x04,0x31,0x02,0x9f,0x90,0x72,0x5e,0x22,
-0xff,0xf8,0x79,0x04,0x19,0x63,0x91,0xb9,0x11,0x03,0x98,0xc5,0x01,0x53,0x03,0x34,
-0x34,0x44,0x00,0xab,0x31,0x24,0x44,0x41,0x0c,0x11,0x19,0xfb,0xf1,0x18,0x41,0x5a,
-0xdc,0xb7,0x10,0x42,0x56,0x41,0xfa,0x77,0x9e,0xe3,0xdc,0x04,0x44,0x30,0x00,0x01,
-0xdc,0xf8,0x04,0x14,0x6f,0x4a,0x22,0x01,0x09,0x00,0x23,0xcd,0x10,0x1b,0x00,0x52,
-0x2e,0xe9,0x77,0x9e,0xe2,0xb9,0x63,0x2c,0xcc,0xb6,0x03,0xa2,0x0a,0x75,0x3f,0x5d,
-0x16,0x76,0x66,0x66,0xbf,0x3a,0xee,0x04,0x10,0x22,0x23,0x99,0x76,0xd8,0xc8,0x22,
-0x9c,0xde,0x9a,0x41,0x04,0x76,0x22,0x13,0x0b,0x97,0x01,0x00,0xbf,0x24,0x12,0x33,
-0xc5,0x2d,0x51,0x01,0x9e,0xff,0xfc,0x50,0xe5,0x11,0x44,0xe6,0x22,0x4a,0xf7,0xbd,
-0x22,0x14,0xbd,0x5e,0xe5,0x11,0xcc,0xf5,0x0c,0x43,0xf9,0x65,0x6b,0xf5,0x14,0x74,
-0x28,0xca,0x30,0x9d,0x58,0x03,0x6a,0xf6,0x14,0xfd,0x4a,0xbd,0x16,0x53,0x54,0x24,
-0x14,0x08,0x2b,0x31,0x10,0x01,0x0a,0x0e,0x18,0x59,0xc1,0x20,0x25,0x05,0xff,0xee,
-0x79,0x10,0x65,0xfb,0x08,0x04,0xdb,0x76,0x02,0xf2,0xed,0x12,0xef,0x4d,0x01,0x10,
-0x57,0x0e,0x40,0x01,0xb0,0x82,0x44,0xa9,0x76,0x55,0x10,0xcf,0x00,0x18,0x60,0xcf,
-0x00,0x02,0x59,0x14,0x11,0xf5,0x12,0x00,0x42,0x23,0x11,0x22,0x20,0x9b,0xe3,0x21,
-0xfb,0x40,0xbe,0x3d,0x44,0xe6,0x22,0x5c,0xf4,0xf8,0x3d,0x14,0xdb,0xa7,0xa1,0x11,
-0xdb,0x19,0x0d,0x32,0xe7,0x43,0x4b,0x61,0x20,0x13,0x9d,0xa3,0x72,0x03,0x2c,0x07,
-0x86,0x05,0x44,0x33,0x33,0xae,0x33,0x33,0x44,0x4f,0xa1,0x00,0xba,0xc2,0x00,0xc5,
-0x13,0x11,0x10,0xe6,0x2e,0x14,0x42,0x6a,0x7e,0x02,0x39,0x82,0x50,0xcf,0x71,0x00,
-0x03,0xcf,0xdf,0x65,0x04,0x07,0x75,0x23,0x04,0xf5,0x14,0xdd,0x11,0x01,0x4d,0x7b,
-0x10,0x80,0xe7,0x03,0x41,0xd9,0x77,0x8b,0xfd,0x9f,0xf8,0x12,0x9b,0xcd,0x85,0x20,
-0x04,0x75,0x0b,0xf2,0x11,0x40,0x4f,0x0d,0x26,0xff,0xf2,0x20,0x20,0x01,0x0a,0x00,
-0x12,0x06,0xee,0x2b,0x11,0xf6,0xcd,0x15,0x55,0xee,0xef,0xf6,0x00,0xf6,0x53,0x02,
-0x12,0xf6,0xe6,0x84,0x12,0x90,0x39,0x02,0x30,0x2f,0xd5,0x47,0xfc,0x85,0x05,0x0b,
-0x2f,0x12,0xf7,0x23,0x3e,0x21,0x3f,0x40,0x63,0x59,0x11,0xda,0x55,0x99,0x00,0x33,
-0x25,0x20,0x8f,0x20,0x21,0x00,0x01,0x3d,0xd0,0x33,0xe9,0x8c,0xf5,0xbf,0x24,0x10,
-0x8c,0xc4,0x01,0x15,0xf7,0x7e,0x32,0x15,0xf7,0x81,0xbd,0x09,0x0a,0x00,0x73,0x15,
-0x55,0x5c,0xe6,0x79,0xbd,0xa0,0x6d,0x59,0x3f,0xec,0xa7,0x30,0x63,0x59,0x0b,0x19,
-0xe6,0x3f,0x0f,0x43,0x01,0xb9,0x76,0x60,0x0a,0x00,0x35,0x9b,0xdd,0xd2,0x9e,0x6f,
-0x02,0x00,0x03,0x10,0x0c,0xbe,0x15,0x11,0xe8,0xd4,0x50,0x01,0x7c,0xf1,0x21,0x00,
-0xea,0x42,0x24,0x22,0xdc,0x71,0xbd,0x0e,0x42,0x2e,0xd7,0x57,0xed,0x0a,0x00,0x11,
-0xae,0xd2,0x00,0x51,0xed,0x77,0x70,0x00,0xcb,0xc2,0x9b,0x80,0xef,0xff,0xe2,0x00,
-0x8f,0x40,0x01,0xaf,0xc2,0x07,0x01,0x42,0x0d,0x13,0xe4,0xef,0x0e,0x24,0x17,0xf4,
-0xf9,0x0e,0x64,0x05,0xf2,0x02,0x46,0x30,0xea,0x9a,0xf6,0x21,0x50,0xea,0x72,0x0d,
-0x2d,0x65,0x42,0x02,0x70,0x10,0x67,0x2f,0x08,0x15,0x71,0x3e,0x21,0x0e,0xc4,0x82,
-0x0e,0xe0,0x68,0x08,0x18,0xc7,0x02,0x37,0xa0,0x40,0x01,0xba,0x77,0x60,0xac,0x3f,
-0x01,0x70,0x0e,0x1b,0xd2,0xd3,0x9b,0x30,0x0c,0xee,0xee,0xcf,0x2a,0x13,0xf8,0x8c,
-0xe4,0x12,0x53,0x7b,0xc5,0x10,0x7b,0xb0,0x7c,0x11,0xe8,0xf7,0x10,0x22,0x68,0xfc,
-0x0a,0x00,0x42,0x9e,0x10,0x00,0x4f,0x14,0x4e,0x11,0xbc,0x8b,0x5e,0x60,0xec,0x88,
-0x70,0x00,0x8f,0x10,0xaf,0x02,0x83,0xef,0xff,0xe1,0x00,0x1d,0xe8,0x7a,0xf9,0xc2,
-0x0f,0x33,0x7c,0xfa,0x40,0x0a,0x00,0x13,0x05,0x25,0x11,0x00,0x92,0x3a,0x41,0x89,
-0xbd,0x80,0xe9,0x6d,0x1e,0x69,0xed,0xcb,0x86,0x20,0xe9,0x00,0xf4,0x0f,0x15,0x44,
-0x85,0x65,0x15,0xcc,0xd1,0xb8,0x15,0xcc,0x23,0x00,0x16,0xdc,0xff,0x16,0x12,0x55,
-0x93,0xe8,0x06,0x24,0x9f,0x03,0x04,0x73,0x02,0xcc,0x01,0x00,0x7f,0x35,0x12,0x61,
-0xe6,0x00,0x12,0xc2,0xe6,0x00,0x01,0xd6,0x24,0x01,0x60,0x56,0x02,0xe0,0x31,0x02,
-0x14,0x00,0x00,0x28,0x03,0x01,0xd0,0x9d,0x33,0xcf,0xff,0xb4,0x4f,0x9d,0x44,0x72,
-0x23,0xaf,0x20,0xc8,0x83,0x21,0x1f,0x50,0xaa,0x83,0x20,0x9e,0x20,0x25,0x75,0x83,
-0xfb,0x55,0x40,0x00,0x0b,0xfe,0xdf,0xf7,0x5e,0x01,0x33,0x28,0xf5,0x10,0x0a,0x00,
-0x01,0xc2,0x01,0x13,0xf8,0xc2,0x01,0x31,0xfd,0x50,0xf8,0x41,0x24,0x22,0x54,0x32,
-0x27,0x55,0x0a,0xb3,0x17,0x12,0xef,0xab,0x05,0x10,0x68,0x4d,0x46,0x1a,0xfa,0xa5,
-0x83,0x15,0xce,0x2d,0x45,0x10,0xfd,0xd6,0x53,0x14,0x51,0xe2,0x7e,0x03,0x42,0xf5,
-0x23,0xfe,0xee,0xcf,0x05,0x7e,0x26,0x78,0x87,0x77,0x76,0x54,0x00,0xb2,0x02,0x18,
-0xf5,0xe4,0x02,0x10,0x0b,0xcc,0x01,0x33,0xe8,0x00,0xf7,0xc5,0xbb,0x32,0x52,0x00,
-0xf7,0xb2,0x02,0x12,0x81,0xb4,0x00,0x02,0xb2,0x02,0x13,0xf8,0xb2,0x02,0x17,0x50,
-0xf0,0x00,0x33,0xfe,0xdd,0xc0,0xb2,0x02,0x33,0xfd,0xaa,0x90,0xb2,0x02,0x15,0xf8,
-0xb2,0x02,0x0e,0xf0,0x00,0x35,0xfe,0x50,0xf9,0xb2,0x02,0x13,0xe8,0x3c,0x17,0x32,
-0x43,0x10,0x31,0xc0,0x5b,0x10,0xff,0x22,0x12,0x01,0x37,0x82,0x44,0x21,0x12,0x5e,
-0xf1,0x9a,0x3d,0x02,0x47,0x24,0x15,0x9f,0x9e,0x02,0x62,0x5f,0xb2,0x00,0x00,0x3c,
-0xf3,0x52,0x0c,0x42,0xfd,0xef,0xfe,0x50,0x0b,0x07,0x12,0x67,0x22,0x26,0x41,0x02,
-0x86,0x43,0x30,0xf0,0x0e,0x23,0x4d,0xff,0xf2,0x0b,0x03,0x2f,0x1a,0x11,0x46,0xe6,
-0x99,0x30,0x08,0xe0,0x0c,0xf7,0x5f,0x11,0xfa,0xdc,0x0b,0x11,0x01,0xfb,0x18,0x00,
-0x52,0x05,0x11,0xb1,0x86,0xc7,0x40,0xce,0x64,0x6e,0xd0,0x68,0x91,0x20,0x6f,0x30,
-0xe4,0x00,0x11,0x7e,0xab,0x11,0x10,0xf7,0x11,0x00,0x11,0x9e,0x12,0x3a,0x10,0x7e,
-0xff,0x04,0x20,0x06,0xf3,0x11,0x00,0x41,0x0a,0xfa,0x8a,0xf9,0x33,0x00,0x33,0x06,
-0xcd,0xb5,0x4e,0x9d,0x13,0x20,0xca,0xc7,0x10,0x5f,0x18,0x24,0x04,0x94,0x41,0xfe,
-0x02,0x8e,0x00,0x56,0x55,0x9f,0x78,0x9b,0xdb,0x08,0xf0,0x1e,0xff,0xff,0xfe,0xdc,
-0xa7,0x30,0x73,0x51,0x0c,0x62,0x27,0x1f,0x02,0x94,0x07,0x04,0x25,0x45,0x54,0x94,
-0x07,0x27,0x43,0x31,0x94,0x07,0x02,0x73,0x29,0x0d,0x94,0x07,0x13,0xe2,0xc1,0x81,
-0x1e,0x01,0x94,0x07,0x19,0x7f,0x94,0x07,0x14,0x3e,0x94,0x07,0x23,0x01,0x7b,0x94,
-0x07,0x21,0x0a,0x70,0x09,0xa6,0x01,0xf2,0x05,0x23,0x09,0xe0,0x69,0x72,0x20,0x09,
-0xe0,0x60,0x19,0x20,0x7f,0xc7,0xf6,0x83,0x27,0x75,0x5f,0x99,0x78,0x15,0x31,0x98,
-0x28,0x00,0x0b,0x02,0x02,0xd3,0x07,0x1b,0x66,0xa3,0x4b,0x15,0x2f,0x92,0xfc,0x02,
-0xa4,0xa5,0x12,0x20,0xd2,0x00,0x13,0x30,0x23,0x4a,0x01,0x92,0xa2,0x00,0x3b,0x01,
-0x44,0xb3,0x00,0x06,0xf9,0xdd,0xbd,0x02,0x11,0x01,0x14,0xda,0xb9,0x00,0x23,0x0a,
-0xe1,0x7e,0x46,0x01,0x45,0x08,0x12,0xf4,0xa0,0x26,0x39,0xbd,0xdb,0x71,0x68,0x00,
-0x21,0x55,0x44,0xc9,0xf4,0x25,0x66,0x60,0x35,0x08,0x00,0x1f,0x01,0x3c,0x16,0xf3,
-0x11,0x71,0x2b,0x1e,0x05,0x84,0x2b,0x07,0x13,0x00,0x0c,0x57,0x55,0x32,0x68,0x64,
-0x41,0xa4,0x01,0x36,0xce,0xff,0x80,0xd8,0x53,0x12,0x8f,0x84,0x01,0x41,0xf1,0x07,
-0xf0,0x00,0x7b,0x28,0x01,0xfd,0x36,0x21,0xbd,0xca,0x86,0xc3,0x41,0x1d,0xe7,0x56,
-0xaf,0xc5,0x46,0x10,0xf2,0x62,0x1a,0x20,0x07,0xf0,0x67,0x3f,0x21,0x3e,0xa0,0x0a,
-0xa3,0x32,0xed,0xff,0xb1,0x21,0x89,0x20,0x54,0x20,0x8b,0x01,0x91,0x11,0x11,0x22,
-0x34,0x57,0x97,0x07,0xf0,0x6f,0x44,0x0b,0x73,0x60,0x7f,0x00,0x34,0x43,0xcd,0x21,
-0x4e,0xa3,0x13,0xc0,0xfd,0x00,0x13,0x55,0xa0,0x17,0x10,0x17,0x37,0x38,0x13,0x64,
-0x25,0xfa,0x18,0xef,0x04,0x91,0x13,0x67,0x8a,0x2d,0x10,0x7f,0xbf,0x28,0x17,0xd9,
-0x15,0x7a,0x11,0x5f,0x83,0x36,0x17,0x80,0xb2,0xb1,0x15,0x31,0x55,0x27,0x2e,0xed,
-0xdc,0xaf,0x01,0x09,0xae,0x01,0x11,0x04,0xad,0x01,0x18,0x52,0xad,0x01,0x23,0x05,
-0xdf,0x87,0x78,0x05,0xac,0x01,0x14,0xcd,0x52,0x02,0x05,0xab,0x01,0x23,0xae,0x10,
-0x57,0xa7,0x05,0xaa,0x01,0x58,0x01,0x7b,0xdd,0xb7,0x10,0x44,0x3b,0x01,0x9b,0x27,
-0x46,0x55,0x66,0x76,0x4f,0xa8,0x01,0x23,0x18,0xf1,0x49,0x40,0x01,0x00,0x0b,0x0f,
-0x09,0x00,0x0d,0x14,0xe0,0xc3,0xa0,0x04,0x6a,0x2c,0x31,0x8b,0x87,0x73,0x79,0x27,
-0x32,0x05,0xac,0xdd,0x24,0xf1,0x03,0x84,0x0c,0x10,0x6e,0xd9,0x04,0x51,0xd1,0x06,
-0xf1,0x01,0x55,0x82,0x0b,0x00,0x15,0x94,0x22,0xad,0xc9,0x3e,0x76,0x91,0xfa,0x67,
-0xcf,0x30,0x00,0x6f,0x10,0x03,0xf7,0x8c,0x5b,0x10,0xf1,0x0b,0x02,0x00,0x99,0x98,
-0x20,0x10,0x02,0x21,0x5c,0x00,0x11,0x00,0x50,0x09,0xf9,0x67,0xde,0x20,0x33,0x00,
-0x01,0x38,0x88,0x06,0xd8,0x0e,0x71,0x10,0x66,0x66,0x67,0x79,0xac,0xea,0xf4,0x87,
-0x30,0xee,0xdb,0x96,0x2e,0x95,0x05,0xf8,0x17,0x13,0x68,0x6b,0x27,0x02,0xea,0x69,
-0x1f,0x20,0xe3,0x87,0x05,0x18,0x87,0xe1,0x2f,0x03,0x07,0x0b,0x31,0x9d,0xb9,0x88,
-0x01,0xea,0x46,0x02,0x7a,0xbb,0xb4,0x16,0x61,0x12,0x06,0xf9,0x0f,0x31,0x76,0x00,
-0x5f,0xf9,0x0f,0x25,0xcc,0xb0,0xc8,0x17,0x10,0x5f,0xf9,0x0f,0x11,0xb6,0x2c,0x07,
-0x40,0x05,0xfb,0x7a,0xf9,0x11,0x00,0x00,0x48,0x46,0x00,0x54,0x12,0x01,0x7c,0xbe,
-0x12,0x80,0xb1,0x26,0x20,0x00,0xca,0x11,0x00,0x10,0xac,0xe5,0x74,0x00,0x11,0x00,
-0x13,0xd0,0x11,0x00,0x11,0x6f,0xf9,0x0f,0x10,0x5f,0xf9,0x0f,0x21,0x09,0xf1,0xc1,
-0x90,0x10,0xfd,0xf9,0x0f,0x13,0x5f,0xf9,0x0f,0x2b,0x05,0xf1,0x0e,0x03,0x0d,0x11,
-0x00,0x1a,0x02,0x49,0x28,0x1f,0xf9,0x1a,0x1d,0x03,0x1c,0xec,0x59,0x8a,0x00,0x85,
-0x04,0x68,0xf5,0x00,0xfc,0xf5,0x00,0xf1,0xe3,0x2e,0x07,0x02,0x11,0x3d,0x03,0x00,
-0x04,0x15,0x00,0x2f,0xe0,0x00,0x01,0x00,0x14,0x1f,0xd6,0x1d,0x00,0x09,0x23,0xea,
-0x00,0x05,0x8c,0x91,0xfe,0x00,0x00,0xe8,0xfd,0xf0,0xf3,0x00,0xee,0x11,0x00,0x00,
-0x0f,0x00,0x4c,0xfd,0xfe,0xf7,0xfa,0x8e,0x00,0x36,0xfb,0x00,0xfc,0x2f,0xd8,0x0a,
-0x19,0x00,0x0b,0x0a,0x00,0x19,0xfe,0x1f,0x00,0x15,0xfd,0xea,0xaa,0x13,0xfc,0x46,
-0x00,0x3f,0xfc,0xf8,0xfc,0xe5,0xac,0x0a,0x05,0xbd,0xac,0x11,0xfd,0x33,0x00,0x25,
-0xfd,0xfb,0x2f,0x00,0x11,0xd4,0xfd,0x00,0x15,0xcf,0x23,0x00,0xad,0xfa,0xfc,0x00,
-0x00,0xfc,0xfb,0x00,0x00,0xfc,0xfc,0xf3,0xb3,0x13,0xfb,0xfe,0x73,0x0f,0x01,0x00,
-0x04,0x1f,0xfc,0x3a,0x01,0x0c,0x18,0xf4,0x0f,0x2d,0x02,0xb8,0x00,0x10,0xfb,0x37,
-0x00,0x11,0xf9,0xc2,0x03,0x17,0xc1,0x94,0x2c,0x57,0xcc,0xf6,0xdf,0xe5,0x00,0xeb,
-0xfe,0x34,0xf8,0xe7,0xef,0x0b,0x00,0x11,0xc3,0x28,0x0b,0x13,0xdb,0x38,0x2d,0x41,
-0xfb,0x00,0xfe,0xfe,0x1d,0x01,0x16,0x03,0x82,0x85,0x07,0x41,0x0a,0x2e,0xfb,0xfc,
-0x35,0x02,0x09,0x01,0x00,0x38,0xf1,0x00,0xfc,0x73,0x0a,0x08,0x69,0x02,0xb1,0xd7,
-0xd5,0x00,0x00,0xf1,0xfb,0xd3,0xfd,0x03,0x00,0x03,0x5d,0x00,0xd2,0xeb,0xed,0x00,
-0xec,0xed,0xf2,0xea,0x00,0xee,0xf3,0xf5,0xf2,0xf5,0x54,0x01,0x66,0xd6,0xf9,0x00,
-0x00,0xf2,0xfe,0x23,0x01,0x50,0xf7,0xf8,0x00,0x00,0xf7,0xa3,0x65,0x01,0xd1,0x3b,
-0x01,0x35,0x01,0x22,0xe9,0xf5,0xa3,0x08,0x14,0x03,0x51,0x2f,0x13,0xfa,0x62,0x01,
-0x07,0xc6,0x2b,0x14,0xf7,0xe7,0x01,0x15,0x03,0xf3,0x01,0x10,0xfc,0x18,0x01,0x13,
-0xfa,0x91,0x01,0xf6,0x11,0x04,0xf7,0xd8,0xf6,0x00,0x00,0xee,0xfb,0xee,0xfd,0x03,
-0xee,0x03,0x03,0x02,0x03,0x00,0x03,0xf2,0xf4,0xfc,0xf9,0xf4,0xf9,0xf5,0xfc,0xf9,
-0xfc,0x00,0xfc,0xfa,0x04,0xc2,0x1d,0x1a,0xfb,0x8e,0x01,0x01,0x46,0x00,0x3c,0xfb,
-0xfb,0x00,0x3c,0x02,0x0f,0xa1,0x3f,0x03,0x1e,0xf3,0x29,0x01,0x0c,0x72,0x02,0x0f,
-0xfc,0x01,0x07,0x01,0xa3,0x02,0x2c,0xfd,0xfd,0xa9,0x02,0x0f,0x4c,0x00,0x08,0x0f,
-0x46,0x00,0x06,0x02,0x0a,0x01,0x1d,0x04,0x85,0x21,0x09,0x60,0x02,0x16,0x04,0xe8,
-0xad,0x0f,0x01,0x00,0x1c,0x0a,0xa6,0x02,0x1f,0xe7,0xa9,0x00,0x0b,0x22,0xfc,0xfd,
-0x96,0x01,0x1c,0xe9,0x22,0x02,0x11,0xfc,0x8f,0x00,0x10,0x09,0x1c,0x02,0x0f,0x6c,
-0x00,0x13,0x17,0x03,0xaa,0x04,0x05,0x60,0x00,0x2c,0xfe,0x02,0x0d,0x01,0x1f,0xe9,
-0xd2,0x00,0x23,0x0e,0x7b,0x03,0x0e,0xf5,0x01,0x0f,0x3b,0x00,0x1a,0x12,0x01,0xab,
-0x04,0x21,0x02,0x03,0x6c,0x01,0x2e,0x04,0x05,0x7e,0x23,0xf2,0x0b,0x07,0x08,0x09,
-0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,
-0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0xe2,0x0f,0x70,0x1b,0x1c,0x00,0x1d,0x1e,0x00,
-0x1f,0xa2,0x06,0xe7,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,
-0x24,0x27,0x1f,0x4e,0x0f,0x01,0x00,0xff,0xbb,0x12,0x01,0xcf,0x2d,0x10,0x02,0x2e,
-0x02,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,
-0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xa2,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,
-0x13,0x14,0x26,0x26,0x62,0x16,0x00,0x17,0x17,0x17,0x18,0x3f,0xe2,0xe7,0x19,0x19,
-0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x15,0x8b,0x0f,0x01,
-0x00,0xff,0xb5,0x50,0x00,0x00,0x00,0x00,0x00,
+0x33,0x2f,0x50,0x05,0x09,0x00,0x12,0x40,0x09,0x00,0x80,0x41,0x4f,0x53,0x15,0xf0,
+0x06,0xf1,0x0f,0x99,0x00,0xc2,0x85,0xf0,0x06,0xf1,0x03,0x44,0x44,0x43,0x31,0x05,
+0xf1,0x06,0x80,0x01,0x05,0x09,0x00,0x1f,0x06,0x09,0x00,0x07,0x4b,0x03,0xb0,0x04,
+0xf1,0x08,0x07,0x30,0x02,0x70,0x49,0x44,0x06,0xd0,0x10,0x07,0xf1,0x8d,0xee,0xdd,
+0xdd,0xcb,0x10,0x06,0xf1,0x00,0x10,0x48,0x01,0x72,0x06,0xf1,0x00,0xf6,0x00,0x3f,
+0x20,0x08,0x00,0x41,0x4f,0x20,0x66,0x6a,0x08,0x00,0x32,0x21,0xef,0xff,0x10,0x00,
+0x02,0x18,0x00,0x20,0x5f,0x10,0x08,0x00,0x81,0xf7,0x11,0x6f,0x34,0x20,0x07,0xf0,
+0xbf,0xe7,0x01,0x75,0x07,0xf0,0x24,0x44,0x44,0x33,0x21,0x7b,0x07,0x00,0xfc,0x05,
+0x84,0x56,0x66,0x66,0x66,0x7a,0x70,0x00,0x05,0xb6,0x04,0x00,0x6a,0x09,0x16,0x09,
+0x20,0x03,0x13,0x03,0x03,0x0a,0x20,0x06,0xfa,0x8e,0x04,0x43,0x30,0x00,0x06,0xf3,
+0x63,0x02,0x12,0xf3,0xa8,0x00,0x32,0x04,0xff,0xee,0xd6,0x0a,0x10,0x57,0x66,0x0a,
+0x14,0x60,0x48,0x03,0x90,0x25,0x55,0x55,0x55,0x66,0x00,0x06,0xf1,0xaf,0xe8,0x09,
+0x71,0x20,0x06,0xf1,0x01,0x11,0x11,0x01,0xb8,0x00,0x17,0xd5,0xb8,0x00,0x03,0x08,
+0x00,0x23,0x22,0xff,0xb8,0x00,0x21,0x67,0x7a,0x08,0x00,0x02,0xb8,0x00,0x02,0xc0,
+0x00,0x61,0x25,0xfa,0x55,0x9f,0x78,0x50,0x48,0x00,0x31,0xfe,0xed,0x60,0x35,0x02,
+0x04,0x3d,0x02,0x03,0xb0,0x03,0x62,0x67,0x77,0x77,0x77,0x88,0x40,0x2b,0x08,0x22,
+0xef,0xe0,0xea,0x06,0x2f,0x09,0xf0,0x08,0x00,0x04,0x93,0xe0,0x00,0x04,0xf7,0x22,
+0x22,0x22,0x3a,0xe0,0xfb,0x09,0x76,0xb0,0x00,0x00,0x02,0x22,0x22,0x22,0xe0,0x08,
+0x03,0x01,0x04,0xa2,0xe5,0x05,0xf1,0x0b,0xdd,0xdd,0xde,0xeb,0x00,0xf6,0x3f,0x02,
+0x30,0x74,0x00,0xf7,0x3f,0x02,0x00,0x7c,0x01,0x12,0xf7,0x2d,0x02,0x13,0x50,0x09,
+0x00,0x1c,0x2f,0x09,0x00,0x43,0x20,0x2f,0x52,0x66,0x09,0x00,0x23,0x59,0xff,0x09,
+0x00,0x2a,0x40,0x00,0x09,0x00,0x25,0x30,0x3f,0x09,0x00,0x40,0x30,0x00,0xf7,0x05,
+0x3f,0x02,0x20,0x5f,0x53,0x09,0x00,0x11,0x0f,0x4e,0x08,0x22,0xf6,0x05,0x3f,0x02,
+0x24,0x00,0xf6,0xe7,0x03,0x0e,0x09,0x00,0x13,0xf5,0xe4,0x03,0x24,0x01,0xf5,0xed,
+0x03,0x2e,0xa2,0x03,0xec,0x03,0xb1,0x10,0x04,0x55,0x55,0x56,0x64,0x00,0xe5,0x04,
+0xf3,0x0f,0x6b,0x07,0x81,0xf8,0x04,0xf4,0x00,0x13,0x10,0x02,0x00,0x09,0x00,0x41,
+0x2f,0x30,0x0f,0x50,0x09,0x00,0x53,0x3f,0x40,0x1f,0x50,0x11,0x09,0x00,0x41,0x5c,
+0xff,0xf8,0x03,0x09,0x00,0x23,0x52,0x55,0x09,0x00,0x20,0x40,0x00,0x09,0x00,0x40,
+0x2f,0x40,0x2f,0x30,0x09,0x00,0xf4,0x01,0x05,0x7f,0x96,0x8f,0xa9,0x40,0xf8,0x04,
+0xf4,0x1f,0xff,0xff,0xee,0xdc,0x40,0xf8,0x48,0x08,0x14,0xe7,0x09,0x00,0x20,0x20,
+0x00,0x05,0x02,0x10,0x22,0x28,0x09,0x43,0x10,0x00,0x00,0x0c,0x97,0x05,0x89,0x00,
+0x02,0x44,0x44,0x43,0x33,0x3b,0xf0,0x6b,0x0c,0x0f,0x09,0x00,0x0c,0x14,0xe0,0xce,
+0x04,0x24,0x80,0x00,0xe5,0x0d,0x61,0x33,0x33,0x33,0x43,0x00,0x05,0x56,0x02,0x81,
+0xff,0x20,0x06,0xf2,0x02,0x22,0x11,0x12,0xde,0x09,0x00,0x56,0x02,0x31,0x9c,0xcd,
+0xf2,0x46,0x02,0x32,0x69,0x9b,0xf2,0x5e,0x02,0x18,0x05,0x08,0x00,0x42,0x5f,0x20,
+0x6a,0xac,0x16,0x03,0x21,0x8b,0xbd,0x08,0x00,0x00,0x8e,0x02,0xe3,0x8d,0xfe,0xdd,
+0xef,0xff,0xa0,0x06,0xf1,0x58,0x88,0x88,0x77,0x65,0x10,0x88,0x03,0x18,0x00,0x66,
+0x02,0x13,0x97,0x08,0x00,0x11,0xeb,0x8e,0x03,0x33,0x00,0x00,0xea,0x8a,0x00,0x0c,
+0x08,0x00,0x62,0xed,0x65,0x55,0x66,0x67,0x82,0xd8,0x0c,0x2b,0xff,0xe5,0xce,0x08,
+0x12,0x40,0x0e,0x03,0x22,0x07,0xf0,0x0e,0x03,0x21,0x07,0xf0,0x0e,0x03,0xb1,0x01,
+0x18,0xf0,0x00,0xb4,0x00,0x3f,0x20,0xcf,0xff,0xf0,0xa8,0x00,0x32,0x35,0x5a,0xf0,
+0xb0,0x00,0x13,0x07,0x08,0x00,0x21,0x08,0xf0,0x0e,0x03,0x00,0x20,0x00,0x00,0x0e,
+0x03,0x41,0x46,0x6b,0xf0,0x35,0x0e,0x03,0x10,0x08,0xce,0x03,0x3c,0xfe,0xec,0x60,
+0xd6,0x06,0x10,0x02,0x34,0x07,0x30,0x49,0xcd,0xb9,0xc4,0x02,0xf3,0x02,0x0a,0xfd,
+0x98,0x9d,0xfc,0x10,0x00,0x00,0x7f,0x80,0x00,0x00,0x4f,0x90,0x00,0x00,0xed,0x5a,
+0x01,0x13,0xfa,0x8c,0x0b,0x13,0xec,0x10,0x00,0xd0,0x9f,0x60,0x00,0x00,0x4f,0xb0,
+0x00,0x00,0x1d,0xfc,0x87,0x8c,0xfd,0x76,0x04,0x4d,0x6a,0xcd,0xba,0x60,0x11,0x0a,
+0x10,0xff,0x63,0x0a,0x00,0xb6,0x09,0x32,0x76,0x62,0x00,0xba,0x0a,0x14,0x14,0x45,
+0x0e,0x24,0x07,0xf0,0x45,0x0e,0x14,0x7f,0xbf,0x01,0x15,0x06,0x13,0x00,0x1a,0x6f,
+0x13,0x00,0x72,0x66,0xbf,0x66,0x66,0xaf,0x78,0x70,0x75,0x06,0x3b,0xfe,0xee,0xeb,
+0xad,0x02,0x15,0x5c,0x42,0x09,0x05,0x1a,0x0c,0x1a,0x8f,0x9c,0x0e,0x10,0x6e,0x1b,
+0x09,0x00,0xb8,0x09,0xa0,0x03,0x88,0x88,0x77,0x77,0x77,0x88,0x88,0x88,0x60,0xc0,
+0x00,0x00,0x11,0x11,0x11,0x11,0x12,0x10,0x00,0x00,0x0d,0xff,0x01,0x00,0xf8,0x0c,
+0xe0,0x00,0x00,0x03,0x55,0x55,0x44,0x44,0x43,0x20,0x00,0x00,0x00,0x05,0x70,0x00,
+0x0a,0x50,0x00,0x00,0x00,0x00,0x0a,0xd0,0x00,0x0e,0x90,0x09,0x00,0xf0,0x02,0x06,
+0x7d,0xe7,0x77,0x7f,0xc9,0x92,0x00,0x00,0x1e,0xee,0xee,0xff,0xed,0xdc,0xb2,0x00,
+0x01,0x00,0x23,0x8e,0x00,0x01,0x00,0x10,0x9e,0x05,0x00,0xf5,0x04,0x5f,0xfe,0xee,
+0xee,0xff,0xee,0xee,0xff,0xfc,0x15,0x66,0x66,0x77,0x76,0x66,0x66,0x55,0x53,0x00,
+0x01,0x00,0xa0,0x03,0x77,0x77,0x77,0x77,0x88,0x70,0x00,0x00,0x08,0x74,0x00,0x23,
+0xef,0xf1,0x17,0x00,0x18,0x07,0x09,0x00,0x20,0x06,0xef,0x1c,0x00,0xd4,0xf0,0x00,
+0x00,0x09,0xf8,0x77,0x66,0x66,0x66,0x30,0x00,0x00,0x09,0x1f,0x00,0x02,0x09,0x00,
+0x40,0x10,0x00,0x00,0x08,0x61,0x00,0xb6,0xff,0xfa,0x00,0x00,0x01,0x78,0x88,0x88,
+0x88,0x77,0x62,0x62,0x00,0x03,0xcf,0x00,0x40,0xf6,0x00,0x00,0x06,0x6c,0x00,0x23,
+0x76,0x62,0x32,0x00,0x10,0x30,0x08,0x00,0x51,0x08,0xe0,0x00,0x06,0xf0,0x49,0x00,
+0x1f,0xf0,0x09,0x00,0x0e,0xa0,0x05,0x6b,0xf6,0x66,0x6a,0xf7,0x77,0x00,0x00,0x2f,
+0x50,0x00,0x20,0xee,0xeb,0x1c,0x00,0x10,0x20,0x03,0x00,0x00,0xa7,0x00,0x04,0x2d,
+0x00,0x23,0x08,0xf0,0xbc,0x00,0x09,0x09,0x00,0x52,0xf0,0x00,0x00,0x5f,0xff,0x01,
+0x00,0x32,0xfd,0x27,0x77,0x01,0x00,0x17,0x75,0xa3,0x00,0xe2,0xde,0xee,0xee,0xee,
+0xee,0xff,0x60,0x00,0x00,0x06,0x88,0x88,0x77,0x77,0xbe,0x00,0x53,0x12,0x00,0x00,
+0x15,0x00,0xa4,0x00,0x24,0x07,0xf0,0x4e,0x01,0x12,0x7f,0xf7,0x00,0x04,0xb7,0x00,
+0x00,0x13,0x00,0x11,0x6f,0x48,0x01,0x92,0x3a,0xf3,0x33,0x39,0xf4,0x54,0x00,0x00,
+0x03,0x67,0x00,0xaf,0xd0,0x00,0x00,0x02,0x22,0x22,0x22,0x21,0x11,0x00,0x01,0x00,
+0x01,0x50,0x06,0xee,0xed,0xdd,0xde,0x31,0x01,0xa9,0xf0,0x27,0x88,0x88,0x88,0xbf,
+0x87,0x77,0x66,0x64,0x76,0x01,0x3c,0x00,0x7f,0x10,0x89,0x01,0x0f,0x13,0x00,0x02,
+0x05,0x50,0x00,0x1e,0xe0,0x67,0x00,0x03,0xe0,0x01,0x11,0xef,0x8f,0x00,0x40,0x30,
+0x00,0x00,0x17,0xf5,0x00,0x11,0x66,0x45,0x02,0x41,0x22,0x00,0x00,0x34,0x1e,0x00,
+0x51,0x0c,0xa0,0x00,0x0b,0xc0,0x0a,0x00,0x42,0xdb,0x00,0x00,0xac,0xae,0x01,0x3f,
+0xb0,0x00,0x0a,0x13,0x00,0x04,0xb1,0x01,0x55,0xdc,0x55,0x55,0xce,0x67,0x40,0x00,
+0x00,0x7f,0x55,0x00,0x2f,0xe9,0x00,0x01,0x00,0x13,0x32,0x01,0x34,0x44,0x01,0x00,
+0x33,0x30,0x8f,0xff,0x01,0x00,0x32,0x00,0x32,0x22,0x01,0x00,0x13,0x10,0xf7,0x02,
+0x48,0x00,0x00,0x00,0x0e,0xf7,0x02,0x30,0x47,0x53,0x10,0x68,0x01,0x41,0xc0,0x00,
+0x0e,0x80,0xee,0x02,0x1b,0xc0,0xf7,0x02,0x72,0x0d,0xef,0xfe,0xee,0xef,0xff,0xf4,
+0x55,0x02,0x37,0x66,0x66,0x40,0xf2,0x00,0x02,0x5b,0x00,0x33,0x23,0x32,0x7f,0x6c,
+0x00,0x71,0xfb,0x02,0x22,0x33,0x33,0x33,0x33,0x6c,0x00,0x04,0x01,0x00,0xf4,0x00,
+0x04,0x88,0x88,0x89,0x99,0x9b,0xb0,0x00,0x00,0x08,0xee,0xee,0xee,0xdd,0xde,0x52,
+0x01,0x18,0x08,0x09,0x00,0x0f,0xf7,0x02,0x1a,0x28,0x00,0x68,0xf7,0x02,0x21,0x02,
+0x30,0xf8,0x00,0x40,0x00,0x09,0xd0,0xbf,0x44,0x00,0xf0,0x01,0x80,0x09,0xe0,0x47,
+0x77,0x66,0x66,0x65,0x10,0x08,0xe0,0x00,0x41,0x00,0x06,0x10,0x94,0x02,0x42,0xf6,
+0x00,0x0f,0x60,0x08,0x00,0x1e,0x1f,0x08,0x00,0x1f,0x07,0x08,0x00,0x02,0x1a,0x50,
+0x08,0x00,0x11,0x2f,0x08,0x00,0xf3,0x06,0xf7,0x00,0x2f,0x40,0x00,0x07,0xf0,0x9d,
+0xfe,0xdd,0xdf,0xee,0xf1,0x07,0xf0,0x58,0x99,0x88,0x88,0x77,0x40,0xb0,0x02,0x1f,
+0x00,0x08,0x00,0x0d,0x0e,0x38,0x02,0x90,0x13,0x33,0x33,0x33,0x43,0x00,0x06,0xf0,
+0xaf,0xb8,0x00,0x71,0x20,0x07,0xf1,0x02,0x22,0x11,0x12,0x73,0x02,0xbf,0xd5,0x00,
+0x3f,0x20,0x00,0x06,0xf1,0x00,0xf6,0x00,0x4f,0x08,0x00,0x04,0x14,0x5f,0x08,0x00,
+0x40,0x10,0x00,0x06,0xf0,0x08,0x00,0xfe,0x05,0x00,0x00,0x06,0xf0,0x8d,0xfe,0xdd,
+0xef,0xff,0xe0,0x06,0xf0,0x58,0x88,0x88,0x77,0x65,0x20,0x06,0xf0,0x88,0x00,0x13,
+0x97,0x08,0x00,0x10,0xeb,0x97,0x01,0x43,0xa0,0x00,0x00,0xea,0x8a,0x00,0x0c,0x08,
+0x00,0x81,0xed,0x65,0x55,0x66,0x67,0x82,0x00,0x00,0x52,0x01,0x1a,0xe5,0xb6,0x00,
+0xf2,0x08,0x02,0x70,0x49,0x88,0x88,0x88,0x99,0x10,0x07,0xf1,0x8d,0xee,0xdd,0xdd,
+0xcb,0x10,0x06,0xf1,0x00,0x10,0x00,0x04,0x00,0x90,0x00,0x0f,0xb8,0x00,0x0e,0x10,
+0x10,0x08,0x00,0x81,0xf7,0x11,0x6f,0x33,0x30,0x07,0xf0,0xbf,0xbd,0x03,0x75,0x07,
+0xf0,0x24,0x44,0x44,0x33,0x22,0xa8,0x00,0x00,0xad,0x04,0x92,0x56,0x66,0x66,0x66,
+0x7a,0x70,0x00,0x05,0xff,0x16,0x02,0x00,0xb7,0x02,0x33,0x10,0x09,0xf0,0x2f,0x02,
+0x13,0xf0,0x69,0x03,0x40,0xd0,0x00,0x06,0xfa,0x09,0x02,0x42,0x30,0x00,0x06,0xf3,
+0x1b,0x00,0x22,0x05,0xf3,0x2b,0x02,0x32,0x04,0xff,0xee,0x06,0x05,0x63,0x57,0x77,
+0x77,0x76,0x66,0x60,0x58,0x00,0x90,0x40,0x25,0x55,0x55,0x55,0x66,0x00,0x06,0xf1,
+0x70,0x01,0x72,0xfe,0x20,0x07,0xf1,0x01,0x11,0x11,0xe3,0x03,0x63,0xb4,0x00,0x2e,
+0x10,0x00,0x07,0xa8,0x00,0x0f,0x08,0x00,0x03,0x01,0x20,0x00,0x10,0xf7,0xc0,0x00,
+0x90,0x07,0xf0,0x25,0xfa,0x55,0x9f,0x78,0x70,0x07,0xb8,0x01,0x3c,0xfe,0xed,0x90,
+0xe8,0x01,0x90,0x02,0x70,0x00,0x00,0x00,0x49,0xcd,0xba,0x50,0x42,0x03,0xf2,0x01,
+0xfd,0x98,0x9d,0xfc,0x10,0x00,0x00,0x7f,0x80,0x00,0x00,0x4f,0xa0,0x00,0x00,0xed,
+0x63,0x05,0x20,0x00,0xfa,0x10,0x02,0x43,0xf2,0x00,0x00,0xec,0xff,0x02,0xd0,0x9f,
+0x60,0x00,0x00,0x3f,0xc0,0x00,0x00,0x1c,0xfc,0x87,0x8c,0xfd,0x65,0x05,0x34,0x6a,
+0xcd,0xca,0xb7,0x00,0x01,0x75,0x05,0x60,0x2c,0xa8,0x66,0x40,0x00,0x08,0x62,0x00,
+0x42,0x18,0xbd,0xde,0xb0,0x0a,0x00,0x04,0x0e,0x01,0x70,0x00,0x36,0x66,0x66,0x66,
+0x65,0x51,0x0a,0x00,0x65,0x9f,0xee,0xee,0xee,0xef,0xf5,0x4a,0x01,0x02,0xbf,0x04,
+0x42,0x01,0x9c,0xc8,0x10,0x0a,0x00,0x42,0x1d,0xe8,0x8e,0xe1,0x0a,0x00,0x42,0x8f,
+0x30,0x01,0xe9,0x0a,0x00,0x10,0xe9,0x58,0x05,0xf0,0x05,0x07,0xff,0xff,0xf1,0x01,
+0xf5,0x00,0x00,0x5f,0x00,0x07,0xf7,0x66,0x50,0x03,0xf3,0x00,0x00,0x4f,0x20,0x1e,
+0x00,0x70,0x02,0xf4,0x00,0x00,0x5f,0x10,0x06,0x28,0x00,0x10,0xf8,0x28,0x00,0x01,
+0x0a,0x00,0x42,0xae,0x10,0x02,0xf9,0x0a,0x00,0x10,0x2e,0x50,0x00,0x12,0x06,0x64,
+0x00,0x11,0xc9,0xda,0x01,0x04,0x24,0x05,0x0f,0x0a,0x00,0x0a,0x25,0x05,0xf1,0x4d,
+0x02,0x00,0x27,0x04,0x60,0x0b,0x97,0x66,0x20,0x00,0x04,0x56,0x04,0x63,0x8a,0xdd,
+0xd6,0x00,0x00,0xbc,0x1c,0x00,0x00,0x2e,0x05,0xa1,0x06,0xdd,0xdd,0xdd,0xdd,0xc9,
+0x00,0xbd,0x00,0x00,0x4a,0x06,0xf0,0x04,0x50,0x0b,0xd0,0x00,0x00,0x00,0x16,0x98,
+0x40,0x00,0x00,0xad,0x00,0x00,0x00,0x3e,0xea,0xcf,0x80,0xa5,0x04,0xf1,0x0c,0x00,
+0x0e,0xb0,0x00,0x8f,0x20,0x00,0xaf,0xaa,0xa6,0x04,0xf3,0x00,0x00,0xf6,0x00,0x0a,
+0xfe,0xee,0xa0,0x5f,0x10,0x00,0x0f,0x70,0x00,0xad,0xc3,0x00,0x21,0x02,0xf5,0x26,
+0x00,0x51,0x0b,0xe5,0x24,0xce,0x10,0x39,0x00,0x41,0x1b,0xff,0xfc,0x30,0x13,0x00,
+0x02,0x5d,0x01,0x19,0x9b,0xe0,0x02,0x60,0x37,0x77,0x88,0x88,0x88,0x72,0x80,0x00,
+0x10,0xff,0x4e,0x01,0x14,0xa0,0x18,0x00,0x14,0xeb,0x09,0x00,0x15,0x0e,0x13,0x00,
+0x1e,0xea,0x13,0x00,0x15,0xe9,0xf6,0x04,0x10,0x20,0x0c,0x02,0x13,0x10,0xe5,0x00,
+0x42,0x01,0xff,0xfd,0xd6,0xb5,0x00,0xf3,0x01,0x00,0x35,0x55,0x10,0x00,0x0a,0xe0,
+0x00,0x01,0x44,0x44,0x44,0x33,0x31,0x00,0xae,0xe1,0x05,0x38,0xc0,0x0a,0xe0,0x48,
+0x08,0x31,0x07,0xdf,0xe8,0xfa,0x06,0x51,0x00,0x08,0xf9,0x57,0xfa,0x13,0x00,0x20,
+0x01,0xf8,0x32,0x02,0x60,0x09,0xf8,0x88,0x50,0x3f,0x30,0xa7,0x04,0x80,0x9f,0xff,
+0xfb,0x03,0xf2,0x00,0x00,0xf6,0x50,0x02,0x00,0x10,0x00,0x40,0x3f,0x40,0x00,0x9f,
+0x9d,0x01,0x31,0x30,0x2d,0xd0,0x13,0x00,0x43,0x01,0xbf,0xff,0xd2,0x94,0x08,0x22,
+0x24,0x20,0x4c,0x00,0x07,0xa7,0x08,0x32,0xd8,0x00,0x00,0x01,0x01,0x10,0x0f,0xe1,
+0x05,0x10,0x58,0x13,0x00,0x14,0xf9,0x21,0x00,0x24,0x0f,0x90,0x0a,0x00,0x65,0xfb,
+0x32,0x22,0x22,0x23,0x30,0x2f,0x06,0x00,0xd2,0x00,0x60,0x14,0x43,0x33,0x33,0x33,
+0x20,0x44,0x01,0x00,0xb6,0x01,0x10,0x01,0x1d,0x00,0x10,0x8b,0xb6,0x01,0x13,0x9e,
+0x34,0x00,0x00,0xdb,0x00,0x11,0x07,0x0a,0x06,0x00,0xdb,0x00,0x11,0x14,0x8a,0x06,
+0x01,0x7c,0x00,0x32,0x39,0xba,0x50,0x26,0x00,0x41,0x6f,0xd9,0xbf,0x90,0xc8,0x00,
+0x50,0x1f,0xa0,0x00,0x6f,0x30,0xc8,0x00,0x15,0x05,0xc8,0x00,0x00,0xb6,0x01,0x10,
+0x60,0x52,0x09,0x70,0x02,0xf7,0x00,0x05,0xf4,0x00,0x08,0x01,0x01,0x32,0xfa,0x79,
+0xfb,0x65,0x09,0x78,0x05,0xbd,0xb6,0x00,0x00,0x06,0xb0,0xac,0x01,0x20,0x07,0xef,
+0xcb,0x03,0x10,0xa0,0xb6,0x01,0x54,0x88,0x77,0x77,0x76,0xcf,0x18,0x00,0x01,0x2c,
+0x04,0x10,0x16,0x33,0x02,0x10,0xcf,0x0e,0x00,0x01,0xbe,0x00,0x00,0xd6,0x00,0x29,
+0x9f,0x10,0x55,0x06,0x10,0x00,0x0a,0x03,0x00,0x1e,0x08,0x10,0xef,0x6d,0x03,0x10,
+0x78,0x90,0x08,0x10,0x61,0xc3,0x00,0x32,0x86,0x55,0x10,0x57,0x06,0x33,0x9c,0xef,
+0xe7,0xb6,0x01,0x08,0xdb,0x00,0x10,0xeb,0xdb,0x00,0x61,0x15,0x55,0x55,0x55,0x55,
+0x30,0xb6,0x01,0x32,0x17,0xa9,0x40,0xdb,0x00,0xf2,0x0d,0x4f,0xfc,0xdf,0x80,0x00,
+0x09,0xf7,0x77,0x40,0x0e,0xc0,0x00,0x9f,0x20,0x00,0x9f,0xff,0xfc,0x04,0xf3,0x00,
+0x01,0xf6,0x00,0x09,0xe1,0x11,0x00,0x91,0x02,0x14,0x9e,0x91,0x02,0x00,0x14,0x01,
+0x51,0x0c,0xd3,0x12,0xbf,0x10,0x39,0x00,0x42,0x1c,0xff,0xfd,0x30,0xa3,0x01,0x20,
+0x01,0x31,0x23,0x02,0x09,0x91,0x02,0x10,0x2d,0x74,0x00,0x10,0xfc,0x53,0x02,0x00,
+0xef,0x04,0x20,0x8c,0xf0,0x69,0x00,0x10,0x40,0xba,0x00,0x00,0x14,0x01,0x13,0xf4,
+0x04,0x04,0x25,0x00,0x5f,0x13,0x00,0x50,0xf7,0x32,0x22,0x22,0x3a,0x13,0x00,0x11,
+0x3f,0x84,0x09,0x01,0x02,0x02,0x55,0x44,0x33,0x33,0x21,0x00,0xdb,0x00,0x14,0x40,
+0xdb,0x00,0x1e,0xae,0xdb,0x00,0x14,0x9e,0xdb,0x00,0x1a,0x09,0xdb,0x00,0x10,0xeb,
+0xdb,0x00,0x3c,0xf2,0x22,0x00,0xdb,0x00,0x3f,0xf5,0x54,0x20,0xdb,0x00,0x0f,0x15,
+0x08,0xdb,0x00,0x14,0x24,0xf6,0x03,0x10,0x00,0x85,0x00,0x31,0x1f,0x40,0x00,0xd4,
+0x09,0x00,0x37,0x00,0x11,0x00,0xe7,0x09,0x00,0x71,0x0a,0x30,0xef,0xff,0xff,0x13,
+0x00,0x00,0xee,0x00,0x11,0x7b,0x13,0x00,0x13,0x50,0x80,0x09,0x24,0x02,0xf5,0x68,
+0x05,0x15,0x1f,0xdb,0x00,0x10,0x34,0xad,0x00,0x00,0x51,0x00,0x16,0x1a,0xb6,0x01,
+0x27,0xee,0xe6,0xdb,0x00,0x1e,0x09,0xdb,0x00,0x01,0x1f,0x02,0x41,0x04,0x65,0x10,
+0x00,0x33,0x03,0xf1,0x05,0x4e,0xfe,0xff,0x50,0x00,0x09,0xf4,0x44,0x20,0x0e,0xb1,
+0x00,0xaf,0x10,0x00,0x9f,0xff,0xfd,0x03,0xf3,0xc8,0x00,0x50,0xf3,0x33,0x10,0x4f,
+0x20,0x91,0x02,0x11,0x9e,0x7b,0x00,0x22,0x03,0xf4,0xdb,0x00,0x32,0xd4,0x24,0xdd,
+0x14,0x01,0x43,0x1a,0xff,0xfc,0x20,0x59,0x03,0x00,0x5d,0x01,0x12,0x7c,0x13,0x09,
+0x22,0x45,0x43,0x78,0x00,0x60,0x6e,0xff,0xff,0xfe,0x70,0x00,0xe0,0x00,0x70,0xb3,
+0x00,0x03,0x9f,0x80,0x00,0x00,0x3b,0x01,0x03,0x98,0x00,0x14,0xf9,0x9c,0x05,0x32,
+0x0f,0xb0,0x00,0x85,0x00,0x61,0x00,0x9f,0x81,0x00,0x01,0x8f,0x47,0x04,0x51,0xaf,
+0xfe,0xde,0xff,0xa1,0x43,0x00,0x47,0x15,0x67,0x64,0x10,0x09,0x02,0xf1,0x04,0x50,
+0x00,0x7e,0xb9,0x87,0x00,0x04,0xe0,0x03,0xf2,0x00,0x17,0x9b,0xbb,0x00,0x06,0xf0,
+0x04,0xf2,0x5a,0x05,0x00,0x09,0x00,0x50,0x38,0x88,0x88,0x88,0x87,0x09,0x00,0x68,
+0x5c,0xcc,0xcc,0xcc,0xcc,0x16,0x1b,0x00,0x60,0x00,0x04,0xbd,0xb3,0x00,0x05,0x09,
+0x00,0x41,0x5f,0xb7,0xcf,0x30,0x09,0x00,0x40,0xcc,0x00,0x0d,0xb0,0x09,0x00,0xf0,
+0x02,0x01,0xf5,0x00,0x07,0xf0,0x05,0xff,0xff,0xf2,0x03,0xf3,0x00,0x05,0xf1,0x05,
+0xf6,0x69,0x09,0x00,0x20,0x04,0xf2,0x1b,0x00,0x51,0x02,0xf4,0x00,0x06,0xf1,0x2d,
+0x00,0x41,0xf8,0x00,0x0a,0xe0,0x09,0x00,0x41,0x9f,0x41,0x6f,0x80,0x09,0x00,0x32,
+0x0b,0xff,0xfa,0x51,0x00,0x00,0x5b,0x04,0x13,0x05,0x6c,0x00,0x00,0x09,0x00,0x1f,
+0xf3,0x09,0x00,0x04,0x46,0x02,0xa0,0x02,0xf2,0xf3,0x05,0x30,0x69,0x75,0x51,0x29,
+0x01,0x82,0x00,0x05,0xbd,0xfe,0x60,0x04,0xd1,0x03,0x23,0x00,0x40,0x6f,0x30,0x3f,
+0x4c,0xcd,0x03,0xf0,0x24,0x75,0xf3,0x03,0xf4,0x35,0x55,0x55,0x55,0x52,0x5f,0x30,
+0x3f,0x40,0x00,0x47,0x73,0x00,0x05,0xf3,0x02,0xf4,0x00,0xaf,0xff,0xf8,0x00,0x5f,
+0x97,0x9f,0x40,0x6f,0x60,0x09,0xf3,0x05,0xff,0xff,0xf4,0x0c,0xb0,0x00,0x0f,0x70,
+0x5f,0x30,0x2f,0x40,0xca,0x00,0x00,0xe8,0x22,0x00,0xe0,0x09,0xd0,0x00,0x2f,0x50,
+0x5f,0x20,0x2f,0x40,0x2f,0xc7,0x7e,0xc0,0x05,0xc7,0x00,0x83,0x3a,0xdc,0x80,0x00,
+0x4e,0x10,0x3f,0x30,0x77,0x00,0x10,0x91,0x05,0x00,0x31,0x57,0x76,0x40,0x37,0x04,
+0x40,0xff,0xfe,0xff,0xe6,0x08,0x00,0x40,0xfb,0x30,0x00,0x3c,0x54,0x02,0x10,0xfc,
+0xe6,0x0a,0x63,0xc0,0x00,0x00,0x2f,0x70,0x00,0x6d,0x05,0x00,0x00,0x06,0x00,0xed,
+0x01,0x50,0xf3,0x00,0x00,0x06,0xf8,0xeb,0x06,0x41,0xfb,0x87,0x9d,0xfb,0x3c,0x00,
+0x35,0xbd,0xdc,0x94,0x6e,0x02,0x14,0x40,0x6e,0x02,0x17,0x9e,0x6e,0x02,0xf3,0x05,
+0x05,0xcc,0xcc,0xcc,0xbb,0xb8,0x00,0x9f,0x33,0x41,0x39,0x98,0x88,0x88,0x89,0x70,
+0x09,0xff,0xff,0xa0,0x6e,0x02,0x22,0x32,0x20,0x6e,0x02,0x00,0x35,0x02,0x01,0x6e,
+0x02,0x00,0xd9,0x04,0x02,0x6e,0x02,0x42,0x08,0xe2,0x22,0x00,0x6e,0x02,0x32,0x8f,
+0xff,0xf9,0x6e,0x02,0x33,0x08,0xf4,0x43,0x6e,0x02,0x1e,0x8e,0x6e,0x02,0x1f,0x7d,
+0x6e,0x02,0x4b,0x00,0xd2,0x09,0xd0,0xad,0xb9,0x88,0x20,0x00,0x04,0xf1,0x00,0x03,
+0x8a,0xbb,0xb4,0x00,0x03,0x09,0x02,0x19,0x00,0xa0,0xf1,0x07,0x88,0x88,0x88,0x88,
+0x75,0x00,0x4f,0x11,0x6b,0x02,0x33,0xcd,0xb0,0x04,0x4c,0x05,0x00,0x22,0x00,0x40,
+0x04,0xbd,0xb5,0x00,0x33,0x00,0x41,0x06,0xfb,0x7a,0xf8,0x11,0x00,0x40,0xea,0x00,
+0x07,0xf2,0x11,0x00,0xf0,0x03,0x6f,0x20,0x00,0x0f,0x72,0x55,0x8f,0x10,0x09,0xd0,
+0x00,0x00,0xc9,0x9f,0xff,0xf1,0x00,0xac,0x12,0x0d,0x21,0x11,0x5f,0x11,0x00,0x40,
+0xda,0x00,0x04,0xf1,0x74,0x0d,0xa1,0x1f,0x70,0x00,0x4f,0x10,0x01,0xfa,0x00,0x0a,
+0xf1,0x44,0x00,0x31,0xfc,0x9c,0xf6,0x44,0x00,0x58,0x03,0x9b,0x93,0x00,0x00,0x66,
+0x00,0x03,0x88,0x00,0x08,0x11,0x00,0x50,0x00,0x00,0x00,0x02,0xd0,0xf2,0x03,0x00,
+0x06,0xa7,0x55,0x40,0x00,0x00,0x04,0x00,0x00,0x5b,0xde,0xed,0x00,0x00,0x06,0xf1,
+0x00,0x01,0x00,0xf0,0x11,0x6f,0x20,0xdf,0xff,0xff,0xff,0xfe,0x30,0x06,0xf2,0x04,
+0x55,0x55,0x55,0x55,0x50,0x00,0x6f,0x20,0x00,0x01,0x66,0x30,0x00,0x00,0x06,0xf2,
+0x00,0x06,0xff,0xef,0xa0,0x22,0x00,0xf0,0x18,0x03,0xf7,0x00,0x5f,0x60,0x34,0x48,
+0xf2,0x00,0xad,0x00,0x00,0xac,0x0e,0xff,0xff,0x20,0x0c,0xa0,0x00,0x08,0xe0,0x02,
+0x27,0xf1,0x00,0xbb,0x00,0x00,0x9d,0x00,0x00,0x6f,0x10,0x06,0xf1,0x00,0x0e,0x90,
+0x55,0x00,0x40,0x0c,0xe8,0x7d,0xf2,0x11,0x00,0x83,0x00,0x08,0xdd,0xa2,0x00,0x00,
+0x06,0xf0,0x66,0x00,0xe0,0x02,0x00,0x00,0x01,0x77,0x77,0x77,0x77,0x88,0x40,0x00,
+0x00,0x5f,0xff,0x71,0x00,0xf8,0x02,0x00,0x00,0x06,0xf3,0x00,0x00,0x00,0x09,0xf0,
+0x00,0x00,0x6f,0x30,0x00,0x00,0x00,0x9f,0x11,0x00,0x90,0x62,0x22,0x22,0x22,0xae,
+0x00,0x00,0x03,0xff,0x01,0x00,0xaf,0xb0,0x00,0x00,0x01,0x23,0x33,0x32,0x22,0x10,
+0x00,0xc4,0x00,0x05,0x30,0x7f,0x10,0xef,0x53,0x00,0x31,0x40,0x07,0xf1,0xc4,0x00,
+0xf0,0x02,0x51,0x00,0x7f,0x10,0x00,0x02,0x56,0x30,0x00,0x00,0x07,0xf1,0x00,0x09,
+0xff,0xef,0xc1,0x22,0x00,0xf1,0x02,0x06,0xf5,0x00,0x3f,0x90,0x23,0x38,0xf1,0x00,
+0xbc,0x00,0x00,0x9d,0x0e,0xff,0xff,0x10,0xc4,0x00,0x60,0x13,0x39,0xf1,0x00,0xad,
+0x00,0x14,0x00,0xf0,0x00,0x7f,0x00,0x04,0xf9,0x32,0x7f,0x60,0x00,0x07,0xf0,0x00,
+0x05,0xdf,0xff,0x80,0x11,0x00,0x80,0x00,0x00,0x11,0x00,0x00,0x00,0x04,0xc0,0x63,
+0x00,0x40,0x35,0x76,0x41,0x00,0x0d,0x00,0xc0,0xef,0xfe,0xff,0xf9,0x00,0x00,0x00,
+0x03,0xfd,0x40,0x00,0x28,0x09,0x00,0x90,0xbf,0x10,0x00,0x00,0x08,0xf1,0x00,0x00,
+0x0d,0x26,0x00,0x62,0x4f,0x30,0x00,0x00,0xdd,0x00,0xc9,0x00,0xf0,0x00,0x08,0xf6,
+0x00,0x00,0x01,0xde,0x00,0x00,0x00,0x0c,0xfc,0x87,0x8b,0xff,0x40,0x16,0x00,0xf1,
+0x07,0xac,0xdc,0xa7,0x10,0x00,0x00,0x7b,0x86,0x61,0x00,0x00,0x10,0x04,0x00,0x03,
+0x9c,0xdc,0x40,0x00,0x7d,0x03,0xf4,0xc2,0x00,0x40,0x09,0xe0,0x3f,0x4c,0xec,0x00,
+0xf0,0x35,0x40,0x8e,0x03,0xf4,0x24,0x44,0x44,0x44,0x40,0x08,0xe0,0x2f,0x40,0x01,
+0x8b,0xb7,0x00,0x00,0x8e,0x02,0xf4,0x02,0xed,0x89,0xfc,0x01,0x29,0xe0,0x2f,0x40,
+0x9e,0x00,0x04,0xf5,0xff,0xfe,0x02,0xf4,0x0d,0xa0,0x00,0x0f,0x82,0x4a,0xe0,0x2f,
+0x50,0xbb,0x00,0x00,0xf8,0x00,0x8e,0x03,0xf4,0x07,0xf4,0x00,0x8f,0x30,0x08,0xe0,
+0x3f,0x40,0x0a,0xfe,0xff,0x60,0x11,0x00,0x93,0x00,0x02,0x55,0x10,0x00,0x06,0xc0,
+0x2f,0x30,0x22,0x01,0x40,0x10,0x00,0x00,0x4e,0x60,0x00,0x12,0xeb,0x88,0x01,0x26,
+0x76,0x6b,0x3b,0x01,0xb0,0x00,0x00,0x66,0x66,0x77,0x77,0x7b,0xf1,0x00,0x00,0x6f,
+0x22,0x00,0x54,0xfc,0x00,0x00,0x06,0xf4,0x1c,0x02,0x12,0x40,0x08,0x00,0x50,0x05,
+0xff,0xee,0xee,0xff,0xf8,0x00,0xf0,0x0c,0x05,0x88,0x87,0x77,0x77,0x76,0x20,0x00,
+0x25,0x31,0x10,0x00,0x00,0x01,0x30,0x00,0x7f,0xff,0xff,0x00,0x00,0x08,0xf0,0x00,
+0x00,0x12,0x21,0x08,0x00,0x90,0x35,0x55,0x55,0x55,0x54,0x00,0x08,0xf0,0xcf,0x49,
+0x00,0x22,0x30,0x08,0xfd,0x01,0x00,0x20,0x00,0xf0,0x0d,0x07,0xce,0xc4,0x00,0x57,
+0x7b,0xf0,0x00,0xbe,0x86,0xcf,0x30,0xef,0xff,0xf0,0x05,0xf3,0x00,0x0d,0xb0,0x00,
+0x08,0xf0,0x0a,0xd0,0x00,0x07,0xf0,0x08,0x00,0x30,0xc0,0x00,0x06,0x08,0x00,0x10,
+0x08,0x10,0x00,0x40,0x89,0x9c,0xf0,0x04,0x20,0x00,0xf0,0x01,0xac,0xce,0xe0,0x00,
+0xbf,0x87,0xcf,0x30,0x00,0x09,0xe0,0x00,0x07,0xcc,0xa2,0x00,0x08,0x00,0x02,0x2c,
+0x01,0x42,0xd0,0x00,0x00,0x51,0x08,0x00,0x20,0x01,0xf8,0x94,0x01,0x11,0x70,0x08,
+0x00,0x00,0x01,0x00,0x23,0x01,0xf7,0x08,0x00,0x81,0xfa,0x22,0x22,0x22,0x34,0x41,
+0x00,0x00,0x41,0x02,0xf3,0x09,0xf7,0x00,0x00,0x24,0x44,0x44,0x33,0x33,0x20,0x00,
+0x5a,0x75,0x54,0x00,0x00,0x01,0x40,0x00,0x5b,0xde,0xfd,0x00,0x00,0x07,0xa0,0x00,
+0x30,0x07,0xf1,0xcf,0x3e,0x02,0x40,0x20,0x07,0xf1,0x35,0x3e,0x02,0x00,0x35,0x02,
+0xf1,0x0b,0x00,0x24,0x10,0x00,0x45,0x5a,0xf1,0x00,0x4e,0xff,0xf8,0x00,0xdf,0xff,
+0xf1,0x02,0xfa,0x21,0x6f,0x50,0x00,0x07,0xf0,0x09,0xe0,0x00,0xb3,0x00,0x20,0x0b,
+0xb0,0x3d,0x00,0x10,0x07,0xb8,0x00,0xf1,0x03,0x08,0xe0,0xdf,0xff,0xf0,0x06,0xf2,
+0x00,0x0e,0xa0,0x46,0x6a,0xf0,0x00,0xce,0x88,0xdf,0x20,0x1b,0x00,0x26,0xcc,0x91,
+0x60,0x00,0xf0,0x01,0x04,0xa0,0x00,0x00,0x01,0x7c,0xef,0xed,0x92,0x00,0x00,0x00,
+0x3e,0xfa,0x76,0x7a,0x0d,0x02,0xa2,0xce,0x20,0x00,0x00,0x1d,0xd0,0x00,0x00,0xf9,
+0x00,0x40,0x01,0xf1,0x05,0xfa,0x00,0x00,0x00,0x0a,0xf0,0x00,0x00,0x9f,0x81,0x00,
+0x02,0x9f,0x90,0x00,0x00,0x09,0xff,0xee,0xff,0xd4,0x00,0x31,0x15,0x67,0x63,0x45,
+0x00,0x13,0x42,0x93,0x01,0x10,0x03,0x25,0x02,0x02,0x53,0x03,0x20,0x34,0x44,0x07,
+0x00,0x20,0x14,0x44,0x01,0x00,0x41,0x41,0x00,0x00,0x7f,0xec,0x00,0x26,0xfb,0x00,
+0xf2,0x01,0x51,0x00,0x00,0x5a,0xdc,0xb7,0x08,0x00,0x60,0x1c,0xfa,0x77,0x9e,0xe3,
+0x00,0x66,0x03,0x62,0x30,0x00,0x01,0xdc,0x00,0x00,0x79,0x00,0x10,0x6f,0x09,0x00,
+0x14,0xf7,0x09,0x00,0x23,0xcd,0x10,0x1b,0x00,0x51,0x2e,0xe9,0x77,0x9e,0xe2,0x44,
+0x00,0x33,0x6b,0xcc,0xb6,0x4e,0x00,0x14,0x14,0x57,0x00,0x19,0x8f,0x09,0x00,0xb2,
+0x16,0x76,0x66,0x66,0xbf,0x66,0x66,0x66,0x64,0x5f,0xff,0x01,0x00,0x23,0xfd,0x00,
+0x81,0x01,0x00,0x77,0x00,0x41,0x99,0x76,0x55,0x20,0x0e,0x00,0x50,0x9c,0xde,0xff,
+0x80,0x00,0x4f,0x03,0x00,0x01,0x00,0x44,0x10,0x00,0x00,0x0b,0x97,0x01,0x70,0x00,
+0x22,0x22,0x33,0x22,0x22,0x20,0x31,0x00,0x40,0x9e,0xff,0xfc,0x50,0x24,0x00,0x41,
+0x0d,0xe6,0x22,0x4a,0xc6,0x01,0x50,0x4f,0x40,0x00,0x00,0xbd,0x09,0x00,0x50,0x3f,
+0x50,0x00,0x00,0xcc,0x09,0x00,0x52,0x0b,0xf9,0x65,0x6b,0xf5,0x99,0x00,0x37,0xef,
+0xca,0x30,0x87,0x00,0xf2,0x03,0x5f,0xfe,0xee,0xed,0xef,0xdd,0xee,0xff,0xfd,0x15,
+0x66,0x66,0x77,0x76,0x66,0x66,0x66,0x53,0x1d,0x00,0x10,0x11,0x9d,0x03,0x01,0x6c,
+0x00,0xa3,0xf1,0x00,0x00,0x01,0x66,0x66,0x66,0x65,0x59,0xf2,0xa1,0x00,0x20,0x06,
+0xf2,0xd7,0x02,0x03,0x1b,0x00,0xb3,0x08,0xf8,0x65,0x55,0x55,0x55,0x30,0x00,0x00,
+0x08,0xf2,0x3b,0x01,0x42,0x06,0xff,0xee,0xef,0x4d,0x01,0x60,0x57,0x88,0x88,0x77,
+0x76,0x52,0x17,0x00,0x44,0xa9,0x76,0x55,0x10,0xcf,0x00,0x18,0x60,0xcf,0x00,0x11,
+0x0d,0x48,0x00,0x11,0xf5,0x12,0x00,0x22,0x23,0x11,0xcf,0x00,0x31,0x9f,0xff,0xfb,
+0xa7,0x01,0x41,0x1d,0xe6,0x22,0x5c,0x4f,0x03,0x00,0xe5,0x04,0x11,0xdb,0xad,0x00,
+0x04,0x09,0x00,0x51,0x0e,0xe7,0x43,0x4b,0xf4,0x2d,0x01,0x33,0x9d,0xff,0xea,0xcf,
+0x00,0x11,0x9e,0x6f,0x03,0x84,0x44,0x33,0x33,0xae,0x33,0x33,0x44,0x53,0x56,0x01,
+0xa0,0xfc,0x01,0x12,0x22,0x22,0x22,0x22,0x21,0x11,0x10,0x4f,0x02,0x12,0x55,0x0c,
+0x02,0x50,0x1a,0xff,0xff,0xff,0xd4,0x09,0x00,0xa0,0xcf,0x71,0x00,0x03,0xcf,0x40,
+0x00,0x00,0x03,0xf7,0x55,0x00,0x50,0xa0,0x00,0x00,0x04,0xf5,0x77,0x04,0x00,0x37,
+0x05,0x10,0xfb,0x48,0x01,0x10,0x80,0xe7,0x03,0x50,0xd9,0x77,0x8b,0xfd,0x10,0x40,
+0x02,0x40,0x9b,0xdd,0xc9,0x50,0x46,0x00,0x60,0x75,0x33,0x30,0x00,0x00,0x40,0xff,
+0x02,0x64,0xdf,0xff,0xf2,0x00,0x01,0xf6,0xd8,0x01,0x00,0x0a,0x00,0xf5,0x03,0x06,
+0x66,0x66,0x66,0x66,0x51,0x00,0xf6,0x00,0x00,0x1e,0xee,0xee,0xee,0xef,0xf6,0x00,
+0xf6,0x53,0x02,0x10,0xf6,0x7a,0x02,0x32,0xbf,0xff,0x90,0x39,0x02,0x42,0x2f,0xd5,
+0x47,0xfa,0x0a,0x00,0x11,0xae,0x4b,0x04,0x00,0x0a,0x00,0x91,0xda,0x00,0x00,0x3f,
+0x40,0x00,0xfb,0x88,0x81,0x0a,0x00,0xa2,0x30,0x00,0xff,0xff,0xe3,0x00,0x8f,0x20,
+0x00,0xae,0x28,0x00,0x42,0x0d,0xe9,0x8c,0xf5,0x0a,0x00,0x43,0x00,0x8c,0xca,0x30,
+0x0a,0x00,0x23,0x01,0x30,0x89,0x02,0x01,0xdc,0x03,0x0a,0x0a,0x00,0xf3,0x02,0x15,
+0x55,0x5c,0xe6,0x79,0xbd,0xa0,0xf7,0x00,0x00,0x3f,0xff,0xff,0xff,0xec,0xa7,0x30,
+0xe3,0x03,0x04,0x28,0x00,0x0b,0x0a,0x00,0x28,0xe6,0x00,0x01,0x03,0x43,0x01,0xb9,
+0x76,0x60,0x0a,0x00,0x64,0x9b,0xdd,0xd2,0x00,0x00,0xe8,0x1e,0x00,0x00,0x00,0x03,
+0xb0,0x0c,0xff,0xff,0xff,0xee,0xe8,0x00,0xe9,0x00,0x00,0x03,0x43,0x03,0x30,0x42,
+0x00,0xea,0x28,0x00,0x41,0x8c,0xdc,0x71,0x00,0x0a,0x00,0x42,0x2e,0xd7,0x57,0xed,
+0x0a,0x00,0x11,0xae,0xd2,0x00,0xf1,0x04,0xed,0x77,0x70,0x00,0xcb,0x00,0x00,0x1f,
+0x50,0x00,0xef,0xff,0xe2,0x00,0x8f,0x40,0x01,0xaf,0x10,0x1e,0x00,0x42,0x09,0xff,
+0xff,0xe4,0x28,0x00,0x43,0x00,0x17,0xf4,0x00,0x0a,0x00,0x90,0x05,0xf2,0x02,0x46,
+0x30,0xea,0x00,0x00,0x4e,0x39,0x05,0xe9,0xfe,0x50,0xea,0x00,0x00,0x16,0x77,0x77,
+0x65,0x42,0x00,0x00,0xc8,0x00,0x01,0x00,0x60,0x67,0x88,0x88,0x88,0x88,0x71,0x54,
+0x01,0x65,0xff,0xee,0xee,0xee,0xee,0xf8,0x19,0x00,0x0f,0x0a,0x00,0x0a,0x16,0x01,
+0xf0,0x00,0x10,0x92,0x0f,0x00,0x51,0xba,0x77,0x60,0x00,0x00,0xa0,0x06,0x10,0x8b,
+0xe6,0x00,0x18,0xf7,0x32,0x00,0x10,0x0c,0x58,0x00,0x10,0xe9,0x0a,0x00,0x10,0x03,
+0xde,0x04,0x11,0x53,0x04,0x01,0x42,0x01,0x7b,0xdb,0x60,0x0e,0x01,0x42,0x1d,0xe8,
+0x68,0xfc,0x0a,0x00,0x20,0x9e,0x10,0x73,0x03,0x21,0xe9,0x00,0x0e,0x07,0x90,0x0f,
+0x60,0x00,0xec,0x88,0x70,0x00,0x8f,0x10,0xaf,0x02,0x91,0xef,0xff,0xe1,0x00,0x1d,
+0xe8,0x7a,0xf9,0x00,0x1e,0x00,0x43,0x00,0x7c,0xfa,0x40,0x0a,0x00,0x10,0x05,0x46,
+0x06,0x10,0xe9,0xa4,0x01,0xf5,0x01,0x59,0xf8,0x89,0xbd,0x80,0xe9,0x00,0x00,0x4f,
+0xff,0xff,0xed,0xcb,0x86,0x20,0xe9,0x82,0x00,0x01,0x0a,0x00,0x01,0xa9,0x04,0x33,
+0xd8,0x00,0x00,0xc8,0x03,0x15,0x20,0x0a,0x00,0x01,0x01,0x00,0x15,0xdc,0x0a,0x00,
+0x51,0xde,0x55,0x44,0x44,0x45,0xbc,0x03,0x12,0xaf,0x8b,0x06,0x00,0xab,0x00,0x03,
+0x65,0x03,0x00,0xcc,0x01,0x42,0x61,0x00,0x00,0x61,0xe6,0x00,0x12,0xc2,0xe6,0x00,
+0x00,0x1c,0x00,0x01,0x0e,0x01,0x01,0x83,0x03,0x13,0xfa,0x14,0x00,0x22,0x21,0x11,
+0x8a,0x02,0x42,0x06,0xcf,0xff,0xb4,0x28,0x00,0x51,0x7f,0x72,0x23,0xaf,0x20,0x40,
+0x01,0x02,0xc2,0x01,0x00,0xf6,0x03,0xe3,0x9e,0x20,0x00,0x7f,0x30,0x00,0xfb,0x55,
+0x40,0x00,0x0b,0xfe,0xdf,0xf7,0x5e,0x01,0x33,0x28,0xf5,0x10,0x0a,0x00,0x01,0xc2,
+0x01,0x13,0xf8,0xc2,0x01,0xda,0xfd,0x50,0xf8,0x00,0x00,0x16,0x66,0x66,0x54,0x32,
+0x00,0x00,0xb5,0xc2,0x01,0x42,0xde,0xee,0xee,0xef,0xab,0x05,0x65,0x68,0x88,0x77,
+0x77,0x66,0xfa,0x19,0x00,0x01,0x08,0x02,0x10,0xce,0x98,0x00,0x10,0xf9,0x0a,0x00,
+0x60,0xfd,0x66,0x66,0x65,0x55,0x51,0x0a,0x00,0x23,0xfb,0x00,0x5a,0x08,0x43,0x00,
+0xef,0xfe,0xee,0xcf,0x05,0x7e,0x26,0x78,0x87,0x77,0x76,0x54,0x00,0xb2,0x02,0x18,
+0xf5,0xe4,0x02,0x10,0x0b,0xcc,0x01,0x10,0xe8,0x0a,0x00,0x82,0x03,0x54,0x44,0x44,
+0x44,0x52,0x00,0xf7,0xb2,0x02,0x12,0x81,0xb4,0x00,0x02,0xb2,0x02,0x13,0xf8,0xb2,
+0x02,0x17,0x50,0xf0,0x00,0x33,0xfe,0xdd,0xc0,0xb2,0x02,0x33,0xfd,0xaa,0x90,0xb2,
+0x02,0x15,0xf8,0xb2,0x02,0x0e,0xf0,0x00,0x35,0xfe,0x50,0xf9,0xb2,0x02,0x12,0xe8,
+0x73,0x02,0x41,0x34,0x43,0x10,0x31,0xce,0x06,0x51,0xcf,0xff,0xff,0xfc,0x30,0x98,
+0x05,0x51,0xd5,0x21,0x12,0x5e,0xf1,0x56,0x06,0x51,0x10,0x00,0x00,0x02,0xf6,0x0a,
+0x00,0x05,0x9e,0x02,0x61,0x5f,0xb2,0x00,0x00,0x3c,0xf3,0x60,0x07,0x52,0xff,0xfd,
+0xef,0xfe,0x50,0x0b,0x07,0x31,0x67,0x65,0x30,0xbc,0x06,0xc5,0x86,0x43,0x30,0x00,
+0x00,0x24,0x00,0x00,0x4d,0xff,0xff,0x50,0xd9,0x07,0x40,0x00,0x8e,0x00,0x46,0xa5,
+0x05,0xb0,0x20,0x08,0xe0,0x0c,0xfe,0xee,0xee,0xee,0xfa,0x00,0x8e,0x4f,0x00,0x00,
+0x23,0x07,0x10,0xe0,0x52,0x05,0xd0,0xb1,0x00,0x00,0x7e,0x00,0x00,0xce,0x64,0x6e,
+0xd0,0x00,0x07,0xe0,0x51,0x05,0x70,0x3f,0x50,0x00,0x7e,0x00,0x0a,0xd0,0x1c,0x01,
+0x20,0x07,0xe0,0x3c,0x05,0x40,0x0f,0x70,0x00,0x7e,0xff,0x04,0x20,0x06,0xf3,0x11,
+0x00,0x41,0x0a,0xfa,0x8a,0xf9,0x33,0x00,0x40,0x06,0xcd,0xb5,0x00,0x11,0x00,0x02,
+0x7b,0x02,0x10,0x7e,0x9e,0x00,0x12,0x10,0x11,0x00,0x21,0x06,0xf1,0x77,0x00,0xf5,
+0x02,0x56,0x55,0x9f,0x78,0x9b,0xdb,0x08,0xf0,0x1e,0xff,0xff,0xfe,0xdc,0xa7,0x30,
+0x8f,0x00,0xba,0x08,0x0a,0xf6,0x06,0x17,0x07,0xd0,0x0a,0x0f,0x94,0x07,0x02,0x25,
+0x45,0x54,0x94,0x07,0x27,0x43,0x31,0x94,0x07,0x14,0x01,0x2c,0x06,0x0a,0x94,0x07,
+0x11,0xe2,0xec,0x02,0x0f,0x94,0x07,0x02,0x19,0x7f,0x94,0x07,0x14,0x3e,0x94,0x07,
+0x23,0x01,0x7b,0x94,0x07,0x62,0x0a,0x70,0x00,0x05,0xa0,0x00,0xf2,0x05,0x02,0x41,
+0x01,0x21,0x0e,0x90,0x09,0x00,0x94,0x17,0x77,0x7f,0xc7,0x77,0x7c,0xf7,0x77,0x75,
+0x3e,0x06,0x00,0x70,0x02,0x14,0x31,0x46,0x02,0x10,0x2f,0x0b,0x02,0x02,0xd3,0x07,
+0x2a,0x66,0x65,0xca,0x02,0x11,0x2f,0x2e,0x00,0x00,0x0d,0x02,0x20,0x45,0x55,0x01,
+0x00,0x12,0x20,0xd2,0x00,0x03,0x9a,0x06,0x32,0x5d,0xff,0xff,0x0a,0x02,0x41,0x5f,
+0xb3,0x00,0x06,0xd2,0x02,0x24,0x0c,0xd0,0x11,0x01,0x14,0xda,0xb9,0x00,0x22,0x0a,
+0xe1,0x17,0x00,0x02,0x45,0x08,0x02,0x47,0x0a,0x49,0x17,0xbd,0xdb,0x71,0x68,0x00,
+0x10,0x55,0x1e,0x01,0x45,0x45,0x55,0x66,0x60,0x35,0x08,0x00,0x1f,0x01,0x33,0x16,
+0xf3,0x11,0x20,0x00,0x12,0x5f,0x35,0x08,0x00,0x93,0x02,0x1f,0x00,0x13,0x00,0x08,
+0x18,0x10,0xea,0x08,0x00,0x7f,0x03,0x22,0x64,0x41,0xa4,0x01,0x65,0xce,0xff,0x80,
+0x00,0x01,0x50,0xba,0x01,0x11,0x7f,0xe5,0x07,0x80,0x07,0xf0,0x00,0x33,0x33,0x33,
+0x33,0x32,0x58,0x01,0x40,0x07,0xbd,0xca,0x40,0xba,0x00,0x71,0x1d,0xe7,0x56,0xaf,
+0x60,0x00,0x7f,0x55,0x00,0x10,0xac,0x11,0x00,0x50,0x3f,0x70,0x00,0x3e,0xa0,0x22,
+0x00,0x41,0x7f,0xed,0xff,0xb1,0xdc,0x00,0x30,0x04,0x54,0x20,0x8b,0x01,0x91,0x11,
+0x11,0x22,0x34,0x57,0x97,0x07,0xf0,0x6f,0x44,0x0b,0x72,0x60,0x7f,0x00,0x34,0x43,
+0xcd,0x21,0xfe,0x00,0x23,0x0b,0xc0,0xfd,0x00,0x10,0x55,0x6f,0x00,0x10,0x30,0x80,
+0x01,0x40,0x77,0x78,0x88,0x64,0x5e,0x08,0x47,0xfe,0xee,0xee,0xef,0x42,0x02,0x70,
+0x01,0x67,0x77,0x77,0x88,0x8c,0xf0,0x16,0x02,0x84,0xee,0xee,0xed,0xd9,0x00,0x00,
+0x07,0xf2,0xcc,0x00,0x10,0xfe,0x6e,0x08,0x12,0x80,0x43,0x04,0x27,0x77,0x61,0xb0,
+0x01,0x4e,0x02,0xff,0xed,0xdc,0xaf,0x01,0x09,0xae,0x01,0x11,0x04,0xad,0x01,0x17,
+0x52,0xad,0x01,0x00,0xc1,0x0c,0x29,0xfe,0x80,0xac,0x01,0x14,0xcd,0x52,0x02,0x05,
+0xab,0x01,0x22,0xae,0x10,0x16,0x00,0x06,0xaa,0x01,0x32,0x01,0x7b,0xdd,0x9a,0x02,
+0x04,0x6c,0x01,0x96,0x55,0x54,0x44,0x44,0x55,0x55,0x66,0x76,0x4f,0xa8,0x01,0x53,
+0x18,0xf1,0x10,0x07,0xf0,0x0a,0x03,0x0f,0x09,0x00,0x0f,0x12,0xe0,0x75,0x03,0x01,
+0xa3,0x01,0x11,0x10,0xb9,0x05,0xb6,0x87,0x73,0x00,0x00,0x03,0x00,0x00,0x05,0xac,
+0xdd,0x70,0x4d,0x03,0x30,0x7f,0x10,0x6e,0xd9,0x04,0x41,0xd1,0x06,0xf1,0x01,0xcc,
+0x00,0x00,0x3f,0x0e,0x40,0x04,0xad,0xc9,0x20,0x9e,0x03,0x80,0x08,0xfa,0x67,0xcf,
+0x30,0x00,0x6f,0x10,0xdd,0x08,0x10,0xdb,0x11,0x00,0x20,0x5f,0x20,0xf2,0x03,0x20,
+0x6f,0x10,0x70,0x04,0x10,0xda,0x11,0x00,0x50,0x09,0xf9,0x67,0xde,0x20,0x33,0x00,
+0x47,0x05,0xbd,0xc8,0x10,0xd8,0x0e,0xf3,0x02,0x10,0x66,0x66,0x67,0x79,0xac,0xea,
+0x07,0xf1,0x2e,0xff,0xff,0xee,0xdb,0x96,0x20,0x7f,0xdc,0x00,0x00,0xdf,0x0b,0x11,
+0x68,0x1d,0x01,0x43,0x00,0x00,0x0b,0xe0,0x90,0x06,0x13,0xbe,0x36,0x00,0x14,0x0b,
+0x8b,0x04,0x10,0xbf,0xae,0x0e,0x10,0x87,0x09,0x0a,0x00,0x1c,0x0c,0x16,0xd0,0x07,
+0x0b,0x40,0x9d,0xb9,0x88,0x30,0x66,0x00,0x41,0x02,0x7a,0xbb,0xb4,0xe9,0x0e,0x02,
+0x4f,0x0a,0x20,0xf1,0x07,0xca,0x07,0x50,0x76,0x00,0x5f,0x11,0xcc,0x01,0x00,0x36,
+0xb0,0x05,0xf1,0xa8,0x02,0x31,0x04,0xbd,0xb6,0x2c,0x07,0x41,0x05,0xfb,0x7a,0xf9,
+0x11,0x00,0x10,0xeb,0xa1,0x04,0x11,0x05,0xcc,0x00,0xa0,0x0f,0x80,0x00,0x5f,0x10,
+0x08,0xe0,0x00,0x00,0xca,0x11,0x00,0x50,0xac,0x00,0x00,0x0b,0xb0,0x11,0x00,0x12,
+0xd0,0x11,0x00,0x00,0x60,0x00,0xa0,0x1f,0x70,0x00,0x5f,0x10,0x01,0xfa,0x00,0x09,
+0xf1,0x11,0x00,0x41,0x06,0xfd,0x9c,0xf6,0x44,0x00,0x33,0x03,0x9b,0x93,0x81,0x07,
+0x08,0x0e,0x03,0x0a,0x11,0x00,0x50,0x00,0x00,0x00,0x02,0xd0,
 };
 
 static const etxFontCmap cmaps[] = {
@@ -3448,11 +4233,39 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 176, .range_length = 55001, .glyph_id_start = 111, .list_length = 452, .type = 3, .unicode_list = 4504, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[108128] __SDRAMFONTS;
+static const etxFontBlock blocks[] = {
+{ .bitmap_start = 0, .comp_offset = 4709, .size = 3969, .comp_size = 2905 },
+{ .bitmap_start = 3969, .comp_offset = 7614, .size = 4085, .comp_size = 2768 },
+{ .bitmap_start = 8054, .comp_offset = 10382, .size = 4004, .comp_size = 2861 },
+{ .bitmap_start = 12058, .comp_offset = 13243, .size = 3872, .comp_size = 2642 },
+{ .bitmap_start = 15930, .comp_offset = 15885, .size = 4070, .comp_size = 2169 },
+{ .bitmap_start = 20000, .comp_offset = 18054, .size = 3951, .comp_size = 2064 },
+{ .bitmap_start = 23951, .comp_offset = 20118, .size = 4001, .comp_size = 2349 },
+{ .bitmap_start = 27952, .comp_offset = 22467, .size = 3924, .comp_size = 2195 },
+{ .bitmap_start = 31876, .comp_offset = 24662, .size = 4021, .comp_size = 2403 },
+{ .bitmap_start = 35897, .comp_offset = 27065, .size = 4070, .comp_size = 2481 },
+{ .bitmap_start = 39967, .comp_offset = 29546, .size = 3907, .comp_size = 2162 },
+{ .bitmap_start = 43874, .comp_offset = 31708, .size = 3901, .comp_size = 2387 },
+{ .bitmap_start = 47775, .comp_offset = 34095, .size = 3905, .comp_size = 2462 },
+{ .bitmap_start = 51680, .comp_offset = 36557, .size = 4007, .comp_size = 2561 },
+{ .bitmap_start = 55687, .comp_offset = 39118, .size = 4022, .comp_size = 2536 },
+{ .bitmap_start = 59709, .comp_offset = 41654, .size = 4044, .comp_size = 2708 },
+{ .bitmap_start = 63753, .comp_offset = 44362, .size = 4026, .comp_size = 2497 },
+{ .bitmap_start = 67779, .comp_offset = 46859, .size = 3926, .comp_size = 2567 },
+{ .bitmap_start = 71705, .comp_offset = 49426, .size = 4077, .comp_size = 2710 },
+{ .bitmap_start = 75782, .comp_offset = 52136, .size = 3976, .comp_size = 2780 },
+{ .bitmap_start = 79758, .comp_offset = 54916, .size = 3956, .comp_size = 2477 },
+{ .bitmap_start = 83714, .comp_offset = 57393, .size = 4009, .comp_size = 2483 },
+{ .bitmap_start = 87723, .comp_offset = 59876, .size = 4095, .comp_size = 2363 },
+{ .bitmap_start = 91818, .comp_offset = 62239, .size = 4055, .comp_size = 2494 },
+{ .bitmap_start = 95873, .comp_offset = 64733, .size = 4089, .comp_size = 2831 },
+};
+
+static uint8_t etxUncompBuf[8166] __SDRAMFONTS;
 
 const etxLz4Font lv_font_ko_L = {
-.uncomp_size = 107896,
-.comp_size = 55001,
+.uncomp_size = 7934,
+.comp_size = 4709,
 .line_height = 27,
 .base_line = 6,
 .subpx = 0,
@@ -3465,12 +4278,13 @@ const etxLz4Font lv_font_ko_L = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 35,
-.glyph_bitmap = 5408,
-.class_pair_values = 105370,
-.left_class_mapping = 106770,
-.right_class_mapping = 107333,
+.class_pair_values = 5408,
+.left_class_mapping = 6808,
+.right_class_mapping = 7371,
+.block_num = 25,
+.blocks = blocks,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 108128,
+.lvglFontBufSize = 8166,
 };